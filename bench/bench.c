@@ -0,0 +1,493 @@
+/*
+ * Script Preprocessor.
+ * Copyright (C) 2019, 2021  Michael Federczuk
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Benchmark harness of spp.
+ *
+ * Runs spp over every shape of the corpus generated by spp-corpus, plus
+ * micro-benchmarks of checkln() and processln(), and reports throughput,
+ * allocations and syscalls per run. The results can be compared against, or
+ * saved as, a baseline file.
+ *
+ * Allocations are counted by wrapping malloc(3) and friends at link time, so
+ * only allocations made by spp itself are counted, not the ones made inside of
+ * the C library. Syscalls are counted by tracing a single run in a child
+ * process with ptrace(2).
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <spp/ctx.h>
+#include <spp/resolve.h>
+#include <spp/spp.h>
+#include <spp/types.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ptrace.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define USAGE "usage: %s [--runs=<n>] [--baseline=<file>] [--save=<file>] " \
+                  "<corpus>\n"
+
+#define errprintf(msg, ...) fprintf(stderr, (msg), __VA_ARGS__)
+
+#define MICRO_ITERATIONS 2000000
+
+// linked with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t nmemb, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+static atomic_size_t allocs;
+
+void* __wrap_malloc(size_t size) {
+	atomic_fetch_add_explicit(&allocs, 1, memory_order_relaxed);
+	return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t nmemb, size_t size) {
+	atomic_fetch_add_explicit(&allocs, 1, memory_order_relaxed);
+	return __real_calloc(nmemb, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+	atomic_fetch_add_explicit(&allocs, 1, memory_order_relaxed);
+	return __real_realloc(ptr, size);
+}
+
+static cstr_t prog;
+static cstr_t corpus;
+static FILE* devnull;
+
+struct bench {
+	cstr_t name;
+	cstr_t arg;
+	// performs a single run; adds the amount of processed bytes and lines
+	int (*run)(const struct bench* bench, size_t* bytes, size_t* lines);
+};
+
+/*
+ * Counts the bytes and lines that were written into the stream OUT.
+ */
+static void count_output(FILE* out, size_t* bytes, size_t* lines) {
+	rewind(out);
+
+	char buf[64 * 1024];
+	size_t n;
+	while((n = fread(buf, 1, sizeof(buf), out)) > 0) {
+		*bytes += n;
+		for(cstr_t p = buf; (p = memchr(p, '\n', n - (size_t)(p - buf))) != NULL;
+		    ++p) {
+			++*lines;
+		}
+	}
+}
+
+/*
+ * Processes the root.sh file of the corpus shape BENCH->arg with a fresh
+ * context. The output is discarded, unless BYTES is not NULL, in which case it
+ * is counted instead.
+ */
+static int run_shape_into(const struct bench* bench, size_t* bytes,
+                          size_t* lines) {
+	char dir[4096];
+	char path[4096 + 16];
+	snprintf(dir, sizeof(dir), "%s/%s", corpus, bench->arg);
+	snprintf(path, sizeof(path), "%s/root.sh", dir);
+
+	FILE* in = fopen(path, "r");
+	if(in == NULL) return 1;
+
+	FILE* out = devnull;
+	if(bytes != NULL) {
+		out = tmpfile();
+		if(out == NULL) {
+			int tmp = errno;
+			fclose(in);
+			errno = tmp;
+			return 1;
+		}
+	}
+
+	// every run starts out cold, just like a fresh spp process would
+	spp_resolve_clear();
+
+	struct spp_ctx ctx;
+	spp_ctx_init(&ctx);
+	int res = spp_process(&ctx, in, out, dir);
+	int tmp = errno;
+	fclose(in);
+	if(res == 0 && fflush(out) == EOF) {
+		res = 1;
+		tmp = errno;
+	}
+
+	if(bytes != NULL) {
+		if(res == 0) count_output(out, bytes, lines);
+		fclose(out);
+	}
+	errno = tmp;
+	return res;
+}
+
+static int run_shape(const struct bench* bench, size_t* bytes, size_t* lines) {
+	(void)bytes;
+	(void)lines;
+	return run_shape_into(bench, NULL, NULL);
+}
+
+// not const, since cstr_t is not either
+static char micro_lines[][64] = {
+	"\techo \"$@\" | grep -v '^#' >/dev/null 2>&1\n",
+	"# a regular shell comment, not a directive\n",
+	"\t# an indented comment\n",
+	"#include some/file.sh\n",
+	"  #unknown-directive argument\n",
+	"\n"
+};
+#define MICRO_LINES_AMOUNT (sizeof(micro_lines) / sizeof(*micro_lines))
+
+static int run_checkln(const struct bench* bench, size_t* bytes,
+                       size_t* lines) {
+	(void)bench;
+	size_t lens[MICRO_LINES_AMOUNT];
+	for(size_t i = 0; i < MICRO_LINES_AMOUNT; ++i) {
+		lens[i] = strlen(micro_lines[i]);
+	}
+
+	struct spp_strview cmd, arg;
+	for(size_t i = 0; i < MICRO_ITERATIONS; ++i) {
+		size_t j = i % MICRO_LINES_AMOUNT;
+		if(checkln(micro_lines[j], lens[j], &cmd, &arg) != 0) return 1;
+		// keeps the compiler from throwing the calls away
+		__asm__ volatile("" : : "r"(cmd.str), "r"(arg.len) : "memory");
+		*bytes += lens[j];
+	}
+	*lines += MICRO_ITERATIONS;
+	return 0;
+}
+
+static int run_processln(const struct bench* bench, size_t* bytes,
+                         size_t* lines) {
+	(void)bench;
+	// lines that processln() passes through without touching the filesystem
+	static const size_t indices[] = { 0, 1, 2, 4, 5 };
+	static const size_t indices_amount = sizeof(indices) / sizeof(*indices);
+
+	size_t lens[MICRO_LINES_AMOUNT];
+	for(size_t i = 0; i < MICRO_LINES_AMOUNT; ++i) {
+		lens[i] = strlen(micro_lines[i]);
+	}
+
+	struct spp_stat stat = {
+		.ignore = false,
+		.ignore_next = false,
+		.pwd = corpus,
+		.ctx = NULL
+	};
+	for(size_t i = 0; i < MICRO_ITERATIONS; ++i) {
+		size_t j = indices[i % indices_amount];
+		if(processln(micro_lines[j], lens[j], devnull, &stat) != 0) return 1;
+		*bytes += lens[j];
+	}
+	*lines += MICRO_ITERATIONS;
+	return fflush(devnull) == EOF;
+}
+
+static const struct bench benches[] = {
+	{ "flat", "flat", run_shape },
+	{ "chain", "chain", run_shape },
+	{ "fanout", "fanout", run_shape },
+	{ "longlines", "longlines", run_shape },
+	{ "dense", "dense", run_shape },
+	{ "comments", "comments", run_shape },
+	{ "insert", "insert", run_shape },
+	{ "checkln", NULL, run_checkln },
+	{ "processln", NULL, run_processln }
+};
+#define BENCHES_AMOUNT (sizeof(benches) / sizeof(*benches))
+
+struct result {
+	double mb_s;
+	double lines_s;
+	long allocs; // per run, -1 if unknown
+	long syscalls; // per run, -1 if unknown
+};
+
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/*
+ * Counts the syscalls of a single run of BENCH by tracing it in a child
+ * process. Returns -1 if tracing is not possible.
+ */
+static long count_syscalls(const struct bench* bench) {
+	fflush(NULL);
+	pid_t pid = fork();
+	if(pid < 0) return -1;
+
+	if(pid == 0) {
+		if(ptrace(PTRACE_TRACEME, 0, NULL, NULL) != 0) _exit(2);
+		raise(SIGSTOP);
+		size_t bytes = 0, lines = 0;
+		_exit(bench->run(bench, &bytes, &lines) == 0 ? 0 : 1);
+	}
+
+	int status;
+	if(waitpid(pid, &status, 0) != pid || !WIFSTOPPED(status)) {
+		waitpid(pid, &status, 0);
+		return -1;
+	}
+	ptrace(PTRACE_SETOPTIONS, pid, NULL,
+	       (void*)(PTRACE_O_TRACESYSGOOD | PTRACE_O_EXITKILL));
+
+	// every syscall stops twice; once when entering and once when leaving
+	long stops = 0;
+	int sig = 0;
+	while(true) {
+		if(ptrace(PTRACE_SYSCALL, pid, NULL, (void*)(long)sig) != 0) break;
+		if(waitpid(pid, &status, 0) != pid) break;
+		if(WIFEXITED(status) || WIFSIGNALED(status)) break;
+
+		sig = 0;
+		if(WSTOPSIG(status) == (SIGTRAP | 0x80)) {
+			++stops;
+		} else if(WSTOPSIG(status) != SIGSTOP) {
+			sig = WSTOPSIG(status);
+		}
+	}
+
+	if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) return -1;
+	// the exit_group(2) call never returns
+	return (stops + 1) / 2;
+}
+
+static int measure(const struct bench* bench, unsigned int runs,
+                   struct result* res) {
+	size_t bytes = 0, lines = 0;
+	if(bench->run == run_shape) {
+		if(run_shape_into(bench, &bytes, &lines) != 0) return 1;
+	}
+
+	double best = 0;
+	size_t allocs_total = 0;
+	for(unsigned int i = 0; i < runs; ++i) {
+		size_t run_bytes = 0, run_lines = 0;
+		size_t allocs_before = atomic_load(&allocs);
+		double start = now();
+		if(bench->run(bench, &run_bytes, &run_lines) != 0) return 1;
+		double time = now() - start;
+		allocs_total += atomic_load(&allocs) - allocs_before;
+
+		if(bench->run != run_shape) {
+			bytes = run_bytes;
+			lines = run_lines;
+		}
+		if(i == 0 || time < best) best = time;
+	}
+	if(best <= 0) best = 1e-9;
+
+	res->mb_s = (double)bytes / (1024 * 1024) / best;
+	res->lines_s = (double)lines / best;
+	res->allocs = (long)(allocs_total / runs);
+	res->syscalls = count_syscalls(bench);
+	return 0;
+}
+
+struct baseline_entry {
+	char name[64];
+	struct result res;
+};
+
+static struct baseline_entry baseline[BENCHES_AMOUNT];
+static size_t baseline_amount = 0;
+
+/*
+ * Reads the baseline file at PATH. Lines starting with a '#' are comments,
+ * every other line is "name<TAB>mb_s<TAB>lines_s<TAB>allocs<TAB>syscalls".
+ */
+static int read_baseline(cstr_t path) {
+	FILE* file = fopen(path, "r");
+	if(file == NULL) return 1;
+
+	char line[256];
+	while(baseline_amount < BENCHES_AMOUNT && fgets(line, sizeof(line), file)) {
+		if(line[0] == '#' || line[0] == '\n') continue;
+
+		struct baseline_entry* entry = &baseline[baseline_amount];
+		if(sscanf(line, "%63s %lf %lf %ld %ld", entry->name, &entry->res.mb_s,
+		          &entry->res.lines_s, &entry->res.allocs,
+		          &entry->res.syscalls) == 5) {
+			++baseline_amount;
+		}
+	}
+
+	int tmp = errno;
+	bool err = ferror(file);
+	fclose(file);
+	errno = tmp;
+	return err;
+}
+
+static const struct result* find_baseline(cstr_t name) {
+	for(size_t i = 0; i < baseline_amount; ++i) {
+		if(strcmp(baseline[i].name, name) == 0) return &baseline[i].res;
+	}
+	return NULL;
+}
+
+static int save_baseline(cstr_t path, const struct result* results) {
+	FILE* file = fopen(path, "w");
+	if(file == NULL) return 1;
+
+	fprintf(file, "# generated by `make bench-baseline`; throughput depends "
+	              "on the machine\n");
+	fprintf(file, "# name\tmb_s\tlines_s\tallocs\tsyscalls\n");
+	for(size_t i = 0; i < BENCHES_AMOUNT; ++i) {
+		fprintf(file, "%s\t%.1f\t%.0f\t%ld\t%ld\n", benches[i].name,
+		        results[i].mb_s, results[i].lines_s, results[i].allocs,
+		        results[i].syscalls);
+	}
+
+	if(fclose(file) == EOF) return 1;
+	return 0;
+}
+
+static void print_delta(double value, double base) {
+	if(base <= 0) {
+		printf(" %8s", "");
+		return;
+	}
+	printf(" %+7.1f%%", (value - base) / base * 100);
+}
+
+static void print_count(long value, const struct result* base,
+                        long base_value) {
+	if(value < 0) {
+		printf(" %10s", "-");
+	} else {
+		printf(" %10ld", value);
+	}
+
+	if(base == NULL || value < 0 || base_value < 0) {
+		printf(" %8s", "");
+		return;
+	}
+	printf(" %+8ld", value - base_value);
+}
+
+static void print_result(cstr_t name, const struct result* res) {
+	const struct result* base = find_baseline(name);
+
+	printf("%-10s %10.1f", name, res->mb_s);
+	if(base != NULL) print_delta(res->mb_s, base->mb_s);
+	else printf(" %8s", "");
+
+	printf(" %12.0f", res->lines_s);
+	if(base != NULL) print_delta(res->lines_s, base->lines_s);
+	else printf(" %8s", "");
+
+	print_count(res->allocs, base, (base != NULL ? base->allocs : -1));
+	print_count(res->syscalls, base, (base != NULL ? base->syscalls : -1));
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	prog = argv[0];
+
+	unsigned int runs = 3;
+	cstr_t baseline_path = NULL;
+	cstr_t save_path = NULL;
+
+	for(int i = 1; i < argc; ++i) {
+		cstr_t arg = argv[i];
+		if(strncmp(arg, "--runs=", 7) == 0) {
+			runs = (unsigned int)strtoul(arg + 7, NULL, 10);
+			if(runs == 0) {
+				errprintf("%s: %s: invalid amount of runs\n", prog, arg + 7);
+				return 3;
+			}
+		} else if(strncmp(arg, "--baseline=", 11) == 0) {
+			baseline_path = arg + 11;
+		} else if(strncmp(arg, "--save=", 7) == 0) {
+			save_path = arg + 7;
+		} else if(arg[0] == '-') {
+			errprintf("%s: %s: invalid option\n", prog, arg);
+			errprintf(USAGE, prog);
+			return 3;
+		} else if(corpus == NULL) {
+			corpus = arg;
+		} else {
+			errprintf("%s: too many arguments\n", prog);
+			errprintf(USAGE, prog);
+			return 3;
+		}
+	}
+
+	if(corpus == NULL) {
+		errprintf("%s: missing corpus directory\n", prog);
+		errprintf(USAGE, prog);
+		return 3;
+	}
+
+	if(baseline_path != NULL && read_baseline(baseline_path) != 0) {
+		if(errno != ENOENT) {
+			errprintf("%s: %s: %s\n", prog, baseline_path, strerror(errno));
+			return 1;
+		}
+		errprintf("%s: %s: no baseline yet\n", prog, baseline_path);
+	}
+
+	devnull = fopen("/dev/null", "w");
+	if(devnull == NULL) {
+		errprintf("%s: /dev/null: %s\n", prog, strerror(errno));
+		return 1;
+	}
+
+	printf("%-10s %10s %8s %12s %8s %10s %8s %10s %8s\n", "bench", "MB/s",
+	       "delta", "lines/s", "delta", "allocs", "delta", "syscalls", "delta");
+
+	struct result results[BENCHES_AMOUNT];
+	for(size_t i = 0; i < BENCHES_AMOUNT; ++i) {
+		if(measure(&benches[i], runs, &results[i]) != 0) {
+			errprintf("%s: %s: %s\n", prog, benches[i].name, strerror(errno));
+			fclose(devnull);
+			return 1;
+		}
+		print_result(benches[i].name, &results[i]);
+		fflush(stdout);
+	}
+	fclose(devnull);
+
+	if(save_path != NULL && save_baseline(save_path, results) != 0) {
+		errprintf("%s: %s: %s\n", prog, save_path, strerror(errno));
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,276 @@
+/*
+ * Script Preprocessor.
+ * Copyright (C) 2019, 2021  Michael Federczuk
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Generates the synthetic corpus that `make bench` runs spp on.
+ * Every shape is written into its own subdirectory of the output directory,
+ * with the file to process named root.sh. The contents only depend on the
+ * shape, so the same corpus is generated on every machine.
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <spp/types.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#define errprintf(msg, ...) fprintf(stderr, (msg), __VA_ARGS__)
+
+#define MIB (1024 * 1024)
+
+#define FLAT_SIZE (64 * MIB)
+#define CHAIN_DEPTH 256
+#define CHAIN_LINES 2000
+#define FANOUT_FILES 4096
+#define FANOUT_LINES 64
+#define LONG_LINE_SIZE (1 * MIB)
+#define LONG_LINES 32
+#define DENSE_LINES 1000000
+#define COMMENTS_LINES 1000000
+#define INSERT_FILES 16
+#define INSERT_SIZE (8 * MIB)
+
+static cstr_t prog;
+static cstr_t out_dir;
+
+// fixed seed; the corpus has to be the same every time
+static unsigned long long rand_state = 0x5eed;
+
+static unsigned long next_rand(void) {
+	rand_state = rand_state * 6364136223846793005ULL + 1442695040888963407ULL;
+	return (unsigned long)(rand_state >> 33);
+}
+
+static const char* const words[] = {
+	"echo", "printf", "local", "readonly", "export", "test", "then", "done",
+	"\"$@\"", "\"$1\"", "${HOME}", "/usr/bin", "--verbose", "-eu", "|", "&&",
+	"2>/dev/null", "$(pwd)", "'quoted text'", "x=1", "grep", "sed", "awk", "cd"
+};
+#define WORDS_AMOUNT (sizeof(words) / sizeof(*words))
+
+/*
+ * Writes a line of plain shell code, roughly WIDTH characters long.
+ */
+static void shell_line(FILE* file, size_t width) {
+	size_t len = 0;
+	size_t indent = next_rand() % 3;
+	for(size_t i = 0; i < indent; ++i) fputc('\t', file);
+
+	while(len < width) {
+		const char* word = words[next_rand() % WORDS_AMOUNT];
+		if(len > 0) {
+			fputc(' ', file);
+			++len;
+		}
+		fputs(word, file);
+		len += strlen(word);
+	}
+	fputc('\n', file);
+}
+
+static FILE* create(cstr_t shape, cstr_t name) {
+	char path[4096];
+	snprintf(path, sizeof(path), "%s/%s", out_dir, shape);
+	if(mkdir(path, 0777) != 0 && errno != EEXIST) {
+		errprintf("%s: %s: %s\n", prog, path, strerror(errno));
+		exit(1);
+	}
+
+	snprintf(path, sizeof(path), "%s/%s/%s", out_dir, shape, name);
+	FILE* file = fopen(path, "w");
+	if(file == NULL) {
+		errprintf("%s: %s: %s\n", prog, path, strerror(errno));
+		exit(1);
+	}
+	return file;
+}
+
+static void finish(FILE* file) {
+	if(fclose(file) == EOF) {
+		errprintf("%s: %s\n", prog, strerror(errno));
+		exit(1);
+	}
+}
+
+// one huge file without any directives
+static void gen_flat(void) {
+	FILE* root = create("flat", "root.sh");
+	fputs("#!/bin/sh\n", root);
+	while(ftell(root) < FLAT_SIZE) shell_line(root, 20 + next_rand() % 80);
+	finish(root);
+}
+
+// every file includes the next one, in the middle of its own lines
+static void gen_chain(void) {
+	char name[64];
+	for(size_t i = 0; i < CHAIN_DEPTH; ++i) {
+		if(i == 0) {
+			snprintf(name, sizeof(name), "root.sh");
+		} else {
+			snprintf(name, sizeof(name), "c%zu.sh", i);
+		}
+		FILE* file = create("chain", name);
+
+		for(size_t j = 0; j < CHAIN_LINES; ++j) {
+			if(j == CHAIN_LINES / 2 && i + 1 < CHAIN_DEPTH) {
+				fprintf(file, "#include c%zu.sh\n", i + 1);
+			}
+			shell_line(file, 20 + next_rand() % 60);
+		}
+		finish(file);
+	}
+}
+
+// one file that includes many small files
+static void gen_fanout(void) {
+	FILE* root = create("fanout", "root.sh");
+	char name[64];
+	for(size_t i = 0; i < FANOUT_FILES; ++i) {
+		snprintf(name, sizeof(name), "f%zu.sh", i);
+		FILE* file = create("fanout", name);
+		for(size_t j = 0; j < FANOUT_LINES; ++j) {
+			shell_line(file, 20 + next_rand() % 60);
+		}
+		finish(file);
+
+		shell_line(root, 40);
+		fprintf(root, "#include %s\n", name);
+	}
+	finish(root);
+}
+
+// few lines that are very long
+static void gen_longlines(void) {
+	FILE* root = create("longlines", "root.sh");
+	for(size_t i = 0; i < LONG_LINES; ++i) {
+		if(i % 8 == 0) fputs("#ignorenext\n", root);
+		shell_line(root, LONG_LINE_SIZE);
+	}
+	finish(root);
+}
+
+// directives all over the place
+static void gen_dense(void) {
+	FILE* payload = create("dense", "payload.txt");
+	fputs("inserted line\n", payload);
+	finish(payload);
+
+	FILE* root = create("dense", "root.sh");
+	for(size_t i = 0; i < DENSE_LINES; ) {
+		switch(next_rand() % 6) {
+		case 0: {
+			fputs("#ignorenext\n", root);
+			shell_line(root, 30);
+			i += 2;
+			break;
+		}
+		case 1: {
+			fputs("#ignore\n", root);
+			for(size_t j = 0; j < 3; ++j) shell_line(root, 30);
+			fputs("  #end-ignore\n", root);
+			i += 5;
+			break;
+		}
+		case 2: {
+			fputs("#insert payload.txt\n", root);
+			++i;
+			break;
+		}
+		case 3: {
+			fputs("\t#unknown-directive argument\n", root);
+			++i;
+			break;
+		}
+		default: {
+			shell_line(root, 30);
+			++i;
+			break;
+		}
+		}
+	}
+	finish(root);
+}
+
+// shell code with lots of comments, which all look like directives at first
+static void gen_comments(void) {
+	FILE* root = create("comments", "root.sh");
+	fputs("#!/bin/sh\n", root);
+	for(size_t i = 0; i < COMMENTS_LINES; ++i) {
+		if(next_rand() % 10 < 7) {
+			fputs((next_rand() % 2 == 0 ? "# " : "\t# "), root);
+			shell_line(root, 20 + next_rand() % 60);
+		} else {
+			shell_line(root, 20 + next_rand() % 60);
+		}
+	}
+	finish(root);
+}
+
+// big files inserted as they are
+static void gen_insert(void) {
+	FILE* root = create("insert", "root.sh");
+	char name[64];
+	for(size_t i = 0; i < INSERT_FILES; ++i) {
+		snprintf(name, sizeof(name), "payload%zu.bin", i);
+		FILE* file = create("insert", name);
+		while(ftell(file) < INSERT_SIZE) shell_line(file, 100);
+		finish(file);
+
+		shell_line(root, 40);
+		fprintf(root, "#insert %s\n", name);
+	}
+	finish(root);
+}
+
+static const struct {
+	cstr_t name;
+	void (*gen)(void);
+} shapes[] = {
+	{ "flat", gen_flat },
+	{ "chain", gen_chain },
+	{ "fanout", gen_fanout },
+	{ "longlines", gen_longlines },
+	{ "dense", gen_dense },
+	{ "comments", gen_comments },
+	{ "insert", gen_insert }
+};
+#define SHAPES_AMOUNT (sizeof(shapes) / sizeof(*shapes))
+
+int main(int argc, char** argv) {
+	prog = argv[0];
+	if(argc != 2) {
+		errprintf("usage: %s <directory>\n", prog);
+		return 3;
+	}
+	out_dir = argv[1];
+
+	if(mkdir(out_dir, 0777) != 0 && errno != EEXIST) {
+		errprintf("%s: %s: %s\n", prog, out_dir, strerror(errno));
+		return 1;
+	}
+
+	for(size_t i = 0; i < SHAPES_AMOUNT; ++i) {
+		rand_state = 0x5eed + i;
+		shapes[i].gen();
+	}
+	return 0;
+}
@@ -0,0 +1,2001 @@
+		x=1 "$@" cd cd /usr/bin
+test cd printf && export echo "$@" "$@" -eu | test grep
+	-eu grep /usr/bin && | readonly 2>/dev/null /usr/bin | sed --verbose
+	grep "$@" "$@" "$@" printf awk | --verbose
+	"$1" awk awk /usr/bin export readonly grep sed | export awk
+	'quoted text' echo 'quoted text' $(pwd) readonly cd | then test printf
+awk | x=1 x=1 awk x=1 printf
+export "$@" export | readonly local echo "$1" "$1" -eu readonly
+	x=1 echo export -eu --verbose done | export
+${HOME} && 'quoted text' local awk "$1" $(pwd)
+	'quoted text' sed then --verbose ${HOME}
+"$@" x=1 && sed x=1 ${HOME} "$@" done
+		"$@" printf cd $(pwd) grep
+| test | ${HOME} grep awk "$1" $(pwd) echo $(pwd) done x=1 cd
+	"$@" -eu sed "$1" x=1 cd done
+		readonly echo sed --verbose readonly cd
+		&& done printf echo 2>/dev/null export "$1"
+$(pwd) --verbose readonly $(pwd) && export awk $(pwd) done "$1" && $(pwd)
+	printf sed -eu 2>/dev/null $(pwd) 'quoted text' --verbose grep
+${HOME} done -eu sed --verbose local && && local "$1" printf
+sed "$@" cd "$1" "$@" -eu export echo export ${HOME} x=1
+		cd "$1" | -eu ${HOME} "$1" | awk --verbose echo 2>/dev/null sed ${HOME}
+		2>/dev/null "$@" x=1 2>/dev/null
+		awk echo export export "$1" test grep "$1"
+then readonly x=1 grep $(pwd) export 'quoted text' echo sed cd export 'quoted text'
+	'quoted text' grep then
+		x=1 "$1" cd 2>/dev/null done cd readonly "$1"
+	export | -eu 2>/dev/null printf echo
+	/usr/bin && done local then 'quoted text' --verbose "$1" local readonly
+	then | /usr/bin done --verbose
+test $(pwd) /usr/bin --verbose readonly "$@" printf sed 'quoted text'
+local $(pwd) echo local readonly
+	readonly /usr/bin sed ${HOME} "$@" done --verbose local
+		x=1 && local readonly 'quoted text' local grep
+	"$1" readonly cd 'quoted text' readonly cd /usr/bin x=1 then |
+sed "$@" 2>/dev/null "$1" grep local
+		export $(pwd) cd "$@" -eu local 'quoted text' echo 'quoted text'
+		'quoted text' && awk cd
+x=1 $(pwd) 2>/dev/null test
+	sed && -eu | test "$1" /usr/bin && x=1 sed
+echo "$1" 2>/dev/null 2>/dev/null | readonly | echo
+	sed echo 'quoted text' | | --verbose
+	printf "$@" "$@" /usr/bin $(pwd)
+"$@" cd --verbose grep $(pwd) $(pwd)
+	grep "$@" --verbose -eu --verbose
+grep 'quoted text' test grep "$1" then then | 'quoted text'
+	then ${HOME} 'quoted text' /usr/bin 2>/dev/null
+		export printf then local local "$1" 'quoted text' printf then cd printf
+		then "$@" then test 2>/dev/null 'quoted text' ${HOME} printf echo grep test sed
+	echo --verbose --verbose ${HOME} printf -eu -eu "$1" -eu export
+test 2>/dev/null readonly then export sed 'quoted text' "$@" | readonly
+	done | cd --verbose &&
+		echo "$1" echo ${HOME} grep
+	&& "$1" /usr/bin /usr/bin echo 2>/dev/null sed local
+	/usr/bin ${HOME} echo export test "$1" | "$1"
+	grep && 2>/dev/null local 2>/dev/null "$@" cd "$@" then 'quoted text'
+	readonly done cd then grep cd then
+done then --verbose "$1" "$@" local awk printf grep
+"$1" "$1" -eu /usr/bin x=1 sed printf
+	printf x=1 readonly --verbose readonly
+&& --verbose --verbose 'quoted text' /usr/bin
+awk "$@" --verbose grep /usr/bin printf cd "$@" local $(pwd)
+		&& 2>/dev/null /usr/bin export local x=1 then then printf --verbose |
+		2>/dev/null "$@" cd $(pwd) grep awk then echo cd test sed cd && --verbose done
+then $(pwd) sed awk readonly $(pwd) -eu then |
+		echo export | | local readonly cd -eu export ${HOME}
+		"$@" x=1 --verbose x=1 test awk "$@" "$@" printf "$@" sed --verbose
+"$1" then export $(pwd) 2>/dev/null && --verbose cd echo
+	then printf $(pwd) test sed echo
+"$@" export grep done sed test
+"$@" ${HOME} readonly /usr/bin 'quoted text' test /usr/bin
+		"$1" then printf cd export | -eu local 2>/dev/null sed | 'quoted text' ${HOME}
+	${HOME} -eu cd cd x=1 "$@" local
+	cd -eu grep 2>/dev/null sed 'quoted text' | echo $(pwd) -eu --verbose "$@"
+	then local $(pwd) ${HOME} then --verbose then grep printf /usr/bin "$@" $(pwd) export
+		| local readonly readonly "$@" "$@" readonly export $(pwd) then then
+-eu 'quoted text' echo local --verbose then /usr/bin x=1 sed
+$(pwd) sed /usr/bin local "$1" "$@" grep awk 'quoted text' && /usr/bin
+		"$1" && && -eu ${HOME} cd && cd export grep export
+2>/dev/null 'quoted text' x=1 /usr/bin $(pwd) export
+cd done awk "$1" cd export /usr/bin
+printf "$1" grep local echo
+	x=1 "$@" echo 2>/dev/null grep /usr/bin && echo local
+		"$1" "$1" echo $(pwd) echo awk cd done 'quoted text' 'quoted text' printf echo
+		readonly test ${HOME} local --verbose grep done /usr/bin /usr/bin | then &&
+"$1" "$1" grep ${HOME} done ${HOME}
+	readonly -eu 2>/dev/null 'quoted text' --verbose $(pwd)
+	/usr/bin && 'quoted text' $(pwd) "$1"
+		local awk $(pwd) done local
+		&& $(pwd) grep -eu done awk grep ${HOME} "$1" printf
+	${HOME} && 'quoted text' cd | sed ${HOME}
+		then "$@" && --verbose | echo printf then readonly sed cd | cd && readonly
+	"$1" $(pwd) | echo grep 2>/dev/null
+	test && awk then --verbose
+		2>/dev/null readonly --verbose grep
+printf test -eu export $(pwd)
+		"$1" readonly printf --verbose "$1" cd 'quoted text'
+		export "$1" /usr/bin 2>/dev/null $(pwd) readonly
+	awk echo -eu 'quoted text' local ${HOME} grep export -eu then
+	--verbose "$@" 2>/dev/null sed then printf /usr/bin /usr/bin cd | ${HOME}
+--verbose 2>/dev/null echo "$@" local local /usr/bin /usr/bin /usr/bin
+"$1" --verbose "$@" | x=1 cd "$@" then then done echo | ${HOME}
+2>/dev/null cd "$1" then -eu local | echo && && -eu sed echo 2>/dev/null
+"$1" cd cd test cd export | then $(pwd) 'quoted text'
+		$(pwd) 2>/dev/null 'quoted text' echo printf /usr/bin test ${HOME} then --verbose
+	${HOME} grep sed awk --verbose
+		readonly printf sed 2>/dev/null "$@"
+cd sed 'quoted text' readonly -eu &&
+2>/dev/null grep readonly ${HOME}
+	2>/dev/null --verbose /usr/bin
+printf 'quoted text' grep $(pwd) awk "$@" --verbose "$@" test awk echo local --verbose
+	local grep /usr/bin "$1" | 'quoted text' -eu
+		/usr/bin readonly ${HOME} echo "$@" /usr/bin cd
+/usr/bin | printf 2>/dev/null -eu $(pwd) --verbose -eu then test "$@"
+		cd grep local /usr/bin then readonly awk && grep | readonly
+		-eu "$1" then --verbose
+	--verbose 2>/dev/null --verbose
+echo sed grep /usr/bin local /usr/bin $(pwd)
+	grep /usr/bin local cd readonly $(pwd) "$1" $(pwd) "$1"
+		readonly local printf && "$1" x=1 2>/dev/null
+	printf echo /usr/bin "$@" "$1" 'quoted text' --verbose grep | "$@"
+$(pwd) done 2>/dev/null grep
+	$(pwd) done done -eu ${HOME}
+	| x=1 local 'quoted text' /usr/bin printf export --verbose then awk done
+readonly 2>/dev/null x=1 local --verbose
+		-eu grep --verbose grep cd | "$@" $(pwd) 2>/dev/null
+-eu local echo 2>/dev/null 'quoted text' 'quoted text' "$1" 'quoted text'
+	printf x=1 readonly export
+	awk 'quoted text' ${HOME} $(pwd) local "$@" readonly then export
+	cd "$@" "$@" -eu -eu | export local printf
+		--verbose grep "$@" done awk -eu -eu | local sed local x=1
+	test "$@" readonly readonly
+		awk ${HOME} "$@" awk test readonly awk
+	cd ${HOME} sed "$@" 'quoted text' 2>/dev/null
+	2>/dev/null | 'quoted text' printf
+		-eu 2>/dev/null -eu ${HOME} sed 'quoted text' 2>/dev/null readonly printf
+	sed ${HOME} cd cd --verbose
+	cd printf /usr/bin cd $(pwd) --verbose grep && printf 'quoted text' sed /usr/bin
+x=1 -eu $(pwd) then done
+	echo --verbose grep "$@" "$1" 'quoted text' local cd cd
+	grep "$@" readonly "$1" printf --verbose
+/usr/bin ${HOME} && local
+		--verbose ${HOME} ${HOME} &&
+		"$@" -eu && local $(pwd) | ${HOME} export grep cd echo --verbose --verbose
+	cd grep local && done cd && sed local
+	| | then --verbose ${HOME} $(pwd) readonly
+| readonly done cd sed 'quoted text' export $(pwd) readonly --verbose
+	then done printf && | --verbose && awk 'quoted text' &&
+-eu --verbose 2>/dev/null sed test $(pwd)
+		awk then x=1 printf "$1" $(pwd) done x=1 sed "$1"
+	test export grep | "$@" 2>/dev/null then x=1 done $(pwd) ${HOME} grep
+	echo x=1 /usr/bin /usr/bin
+		"$1" done "$1" && grep
+	2>/dev/null printf echo $(pwd) then "$1" /usr/bin 2>/dev/null
+		local --verbose echo export
+printf x=1 printf ${HOME} --verbose grep export
+	${HOME} awk 2>/dev/null
+	awk $(pwd) 'quoted text' done awk
+	grep "$1" "$@" export awk
+/usr/bin "$@" done 2>/dev/null printf $(pwd) "$1" export -eu "$1" printf
+		cd then $(pwd) /usr/bin && x=1
+	"$1" -eu echo --verbose sed sed done x=1 "$@" echo -eu
+-eu done --verbose 'quoted text' && 2>/dev/null export -eu x=1
+		"$1" x=1 sed cd export cd cd printf 2>/dev/null 2>/dev/null --verbose then sed local
+	grep test cd && sed export ${HOME} export "$1" printf sed then readonly local
+		$(pwd) && 'quoted text' "$@" ${HOME} "$@" awk
+"$@" /usr/bin export --verbose $(pwd) && | echo then |
+awk then x=1 2>/dev/null awk export
+		done printf && test && 'quoted text' x=1 $(pwd) /usr/bin done
+		$(pwd) grep -eu local /usr/bin x=1 "$@" "$1" | grep then "$@" x=1 export
+| "$1" -eu ${HOME} $(pwd) "$@" | readonly cd /usr/bin /usr/bin
+${HOME} x=1 done "$1" "$@" -eu sed test x=1 awk local local local
+	local grep then cd sed "$1" done test 2>/dev/null
+		${HOME} local readonly done then x=1 /usr/bin ${HOME} printf
+		$(pwd) export printf then "$@"
+		'quoted text' done printf grep
+then /usr/bin export sed sed 'quoted text' -eu && local test sed && "$1"
+	readonly awk test x=1 && x=1 | export /usr/bin
+	2>/dev/null done -eu x=1 -eu "$1" && ${HOME}
+		test export | sed then /usr/bin && -eu sed sed grep --verbose
+	then export /usr/bin echo done 2>/dev/null "$@"
+-eu x=1 ${HOME} | && --verbose grep local local grep "$@" x=1 2>/dev/null
+sed readonly && && awk -eu readonly 2>/dev/null "$1"
+sed export --verbose $(pwd)
+		${HOME} --verbose /usr/bin readonly && awk --verbose /usr/bin
+		printf x=1 local 'quoted text'
+		-eu ${HOME} "$@" test /usr/bin grep cd then | 2>/dev/null
+		&& && -eu awk local export x=1 'quoted text' 'quoted text'
+		/usr/bin printf && export 2>/dev/null readonly -eu "$@" done then
+		then sed grep printf readonly ${HOME} export then && && -eu export x=1
+	grep awk "$1" cd $(pwd) test "$1" sed -eu test echo test | awk readonly export echo
+		&& awk echo test /usr/bin ${HOME} "$@" 'quoted text' | "$@" --verbose
+&& sed 'quoted text' | grep done x=1 readonly then sed cd readonly
+cd local ${HOME} readonly then then sed ${HOME}
+	local local readonly 2>/dev/null /usr/bin /usr/bin then grep && &&
+awk /usr/bin 2>/dev/null 'quoted text' /usr/bin | $(pwd) export | /usr/bin
+	readonly cd done "$@" export --verbose
+		&& "$@" -eu 'quoted text' x=1 readonly /usr/bin
+	"$1" echo /usr/bin echo
+	done | --verbose echo 'quoted text'
+awk "$@" grep /usr/bin awk --verbose && awk sed
+		&& $(pwd) grep echo 'quoted text' /usr/bin "$@" local echo "$@"
+		echo "$@" "$1" cd | "$@" 'quoted text' then "$@"
+readonly "$@" grep -eu && "$@" printf
+	sed awk sed then echo local ${HOME} && x=1 readonly /usr/bin
+test ${HOME} export echo grep
+		export | awk | --verbose && grep test /usr/bin printf && /usr/bin sed test
+	| /usr/bin $(pwd) cd grep x=1 readonly
+		x=1 x=1 readonly "$1" ${HOME} awk
+"$@" printf --verbose 2>/dev/null then cd cd
+		--verbose test local ${HOME} cd --verbose
+${HOME} -eu && 2>/dev/null "$1" 'quoted text' x=1
+		test "$1" done cd echo 'quoted text' -eu sed x=1 sed then grep sed cd
+&& "$1" 'quoted text' awk local readonly x=1 x=1 echo grep | test test "$@"
+		"$1" 2>/dev/null "$@" && "$1"
+	| then /usr/bin $(pwd) "$@"
+		echo grep local $(pwd) then
+		test 2>/dev/null cd "$1"
+sed export local sed 'quoted text'
+		"$1" --verbose then local local local "$@" | "$@" "$@" && -eu grep
+	${HOME} -eu x=1 -eu test
+	-eu cd awk done awk done export
+echo "$@" cd x=1 "$1" cd echo readonly
+		test -eu x=1 /usr/bin readonly $(pwd) readonly
+		grep $(pwd) done && -eu sed
+	"$@" done then echo grep then -eu 'quoted text'
+	done -eu -eu done cd "$@" readonly | 'quoted text' x=1
+	done awk && | $(pwd) grep 2>/dev/null
+	--verbose --verbose cd "$@" ${HOME} awk
+		$(pwd) printf "$1" "$1" -eu
+	readonly printf printf done export
+		sed "$@" 'quoted text' echo awk printf "$1" --verbose /usr/bin |
+/usr/bin 2>/dev/null "$1" ${HOME} "$1" export test && 2>/dev/null sed $(pwd)
+	local local grep --verbose x=1 -eu sed then
+		test -eu 2>/dev/null local && ${HOME} "$1"
+		export x=1 export 'quoted text' ${HOME} printf $(pwd) echo grep |
+	sed readonly test x=1 cd && test grep local 2>/dev/null 'quoted text'
+echo "$@" | -eu local grep --verbose /usr/bin grep
+readonly echo 'quoted text' test
+	then local export -eu ${HOME} x=1 export --verbose awk
+	sed awk "$@" /usr/bin test "$1" ${HOME} --verbose 'quoted text'
+		test "$@" test then && printf &&
+-eu --verbose test -eu cd printf export local local local cd awk "$@"
+		&& | x=1 --verbose x=1 done printf 'quoted text' | "$1"
+		printf printf printf sed && then done printf x=1 --verbose 'quoted text'
+/usr/bin readonly done echo printf awk $(pwd) export $(pwd) readonly grep test
+	done -eu 2>/dev/null --verbose
+/usr/bin printf ${HOME} local 'quoted text' /usr/bin sed awk ${HOME}
+		then sed readonly $(pwd) echo then grep local printf 'quoted text' then grep
+grep cd | --verbose | 2>/dev/null export
+'quoted text' echo "$1" x=1 local "$1" -eu echo $(pwd) --verbose
+	export -eu grep /usr/bin $(pwd) awk $(pwd) export --verbose
+grep then "$1" "$1" $(pwd) $(pwd) cd $(pwd)
+		awk local "$1" test sed readonly
+		-eu 'quoted text' /usr/bin
+	2>/dev/null awk /usr/bin --verbose printf done test
+	2>/dev/null && test ${HOME}
+		"$@" x=1 && 'quoted text' ${HOME}
+	-eu $(pwd) readonly 'quoted text' /usr/bin local 'quoted text'
+${HOME} sed done export local test export test awk && then $(pwd)
+local && && echo ${HOME} | printf export
+		done test awk sed 'quoted text' grep done grep readonly -eu done &&
+	done x=1 local x=1 --verbose export awk x=1
+| 2>/dev/null test test 2>/dev/null "$@" | readonly "$@" then local local printf
+		2>/dev/null local cd then
+x=1 && 'quoted text' test export "$@" $(pwd) awk cd cd -eu ${HOME} grep
+awk 2>/dev/null awk "$1" /usr/bin then local $(pwd) sed
+		-eu "$1" printf awk printf cd echo export sed /usr/bin
+x=1 then echo 'quoted text' then then grep printf /usr/bin -eu
+		sed $(pwd) printf printf $(pwd) local readonly
+		"$@" | /usr/bin awk 'quoted text' printf --verbose grep readonly
+		"$@" grep | sed /usr/bin printf ${HOME} -eu -eu printf /usr/bin "$1" local &&
+	awk cd then | x=1 && | test && grep local cd --verbose done -eu
+	-eu then awk printf 2>/dev/null /usr/bin readonly export export awk export
+x=1 ${HOME} && readonly export readonly ${HOME} echo done done 2>/dev/null
+| cd then /usr/bin then /usr/bin awk && $(pwd) x=1 /usr/bin
+		| -eu 'quoted text' "$@" sed
+		'quoted text' "$1" -eu "$@" cd -eu | printf 2>/dev/null local $(pwd)
+		test --verbose "$1" | grep cd 'quoted text' x=1 "$@" && done ${HOME} grep
+		awk "$@" echo echo /usr/bin printf
+	"$@" $(pwd) && "$1" "$@" test
+-eu "$@" x=1 awk readonly
+		test 'quoted text' grep test
+printf --verbose -eu x=1 /usr/bin "$@" --verbose sed cd /usr/bin then
+| $(pwd) --verbose $(pwd) -eu -eu "$@" 2>/dev/null
+		--verbose grep cd test --verbose cd
+${HOME} -eu done awk awk | x=1 awk
+		/usr/bin cd 2>/dev/null | 'quoted text' sed local
+	printf "$1" echo x=1 'quoted text'
+	echo readonly /usr/bin | awk cd --verbose
+test export readonly awk 2>/dev/null cd
+	| awk sed printf --verbose cd test then then $(pwd) done done 2>/dev/null awk
+		printf 2>/dev/null done x=1 grep awk test cd ${HOME} -eu 2>/dev/null
+/usr/bin sed 2>/dev/null cd export cd && readonly then /usr/bin
+	local then local --verbose --verbose 'quoted text' -eu x=1 x=1 | grep
+	then test cd "$@" -eu awk "$@" $(pwd)
+		local "$@" local printf --verbose ${HOME}
+		sed readonly 'quoted text' 2>/dev/null test cd $(pwd) printf
+	readonly | export test printf 2>/dev/null | test local
+	grep x=1 readonly /usr/bin awk grep export then /usr/bin printf
+		echo cd ${HOME} 2>/dev/null --verbose
+		| --verbose x=1 $(pwd) test test
+		&& local --verbose /usr/bin $(pwd) export
+		-eu | echo printf grep cd "$@"
+		cd printf cd cd awk readonly
+	readonly x=1 local export test $(pwd) $(pwd)
+	| /usr/bin sed ${HOME} x=1 x=1 | then $(pwd) "$1" | echo test $(pwd)
+		"$@" local --verbose 2>/dev/null
+then x=1 echo local awk export
+		2>/dev/null -eu then test
+sed -eu 'quoted text' && printf export
+2>/dev/null --verbose sed grep
+	done 2>/dev/null readonly
+${HOME} echo ${HOME} ${HOME} 2>/dev/null
+		cd --verbose $(pwd) local --verbose
+		2>/dev/null "$@" awk -eu
+	grep local then ${HOME} -eu test sed sed cd test test /usr/bin
+/usr/bin --verbose ${HOME} | --verbose
+	| /usr/bin awk && --verbose
+	test --verbose cd /usr/bin grep then local then awk cd &&
+		2>/dev/null awk -eu export "$@" -eu "$@" 2>/dev/null
+-eu --verbose "$1" | ${HOME} awk ${HOME} | 2>/dev/null test 2>/dev/null
+		$(pwd) 2>/dev/null 2>/dev/null echo 'quoted text' printf local
+	| && x=1 printf local 'quoted text'
+		-eu /usr/bin 'quoted text' "$1" "$@" awk done x=1 -eu 'quoted text'
+"$1" test "$@" ${HOME} $(pwd) ${HOME} readonly local printf
+		x=1 done then /usr/bin echo /usr/bin "$@" /usr/bin
+--verbose x=1 2>/dev/null "$@" x=1 | x=1 export $(pwd) "$1" x=1 local
+		--verbose awk x=1 --verbose
+done 'quoted text' /usr/bin grep awk $(pwd)
+| | local && export | then --verbose
+	'quoted text' "$@" done test --verbose && awk -eu
+/usr/bin sed x=1 --verbose /usr/bin
+printf | -eu --verbose export ${HOME} test local then "$@"
+	sed $(pwd) done export printf /usr/bin && echo
+	-eu 2>/dev/null -eu local printf
+	readonly "$1" -eu readonly awk $(pwd) 'quoted text' then sed then && local
+		-eu | printf -eu "$@" 2>/dev/null 'quoted text' "$@" awk readonly sed
+		"$1" done && test && export printf readonly grep sed grep then
+		grep $(pwd) export | sed 'quoted text'
+	/usr/bin cd --verbose awk "$1" readonly 'quoted text'
+		&& | awk done echo "$@" -eu readonly 2>/dev/null
+	echo local local | 'quoted text'
+$(pwd) $(pwd) sed x=1 test echo | 2>/dev/null
+	printf /usr/bin x=1 "$@" export "$1" local | ${HOME} printf test sed 'quoted text'
+		local sed awk | ${HOME} && | awk x=1 sed then -eu $(pwd) cd sed "$1" 2>/dev/null
+	/usr/bin /usr/bin then sed sed test echo test cd test
+'quoted text' printf "$@" echo local
+-eu | 2>/dev/null ${HOME} test readonly local printf
+		awk export 'quoted text' test && local test grep x=1
+	done $(pwd) $(pwd) sed done done awk test "$@" test 2>/dev/null /usr/bin
+	"$1" x=1 /usr/bin && -eu printf readonly done /usr/bin readonly
+${HOME} -eu printf awk sed readonly done | -eu
+export grep grep printf echo readonly 'quoted text' test x=1 'quoted text'
+"$@" cd readonly then 2>/dev/null done export
+--verbose 'quoted text' sed -eu x=1 'quoted text'
+	local "$1" /usr/bin echo test $(pwd)
+	"$@" ${HOME} "$1" sed /usr/bin readonly
+	"$@" 'quoted text' echo x=1 test printf
+	-eu --verbose x=1 then "$@" echo ${HOME} --verbose 2>/dev/null
+done && awk --verbose && "$1" --verbose ${HOME} readonly echo --verbose
+"$@" export /usr/bin /usr/bin
+		'quoted text' awk "$1" then x=1 ${HOME} export
+cd $(pwd) --verbose 'quoted text' 2>/dev/null
+		x=1 2>/dev/null test | printf "$@" ${HOME} grep && 'quoted text'
+		readonly /usr/bin | -eu && local sed
+test && local | grep then done then 2>/dev/null ${HOME}
+		'quoted text' cd printf local
+		export && printf export -eu local 2>/dev/null
+	sed then test && -eu awk done echo "$1" -eu sed
+		'quoted text' "$1" awk && echo -eu && awk -eu
+		'quoted text' test --verbose awk "$@"
+		"$1" printf /usr/bin $(pwd) echo
+grep local "$1" sed -eu done done $(pwd)
+"$1" /usr/bin grep done export echo readonly
+		local done printf x=1 printf then ${HOME} $(pwd) local local
+x=1 local sed cd --verbose /usr/bin "$@" 2>/dev/null test cd
+		done readonly 'quoted text' grep x=1 local 2>/dev/null awk test cd
+	&& then export local printf "$1" then printf ${HOME} x=1 cd --verbose -eu echo
+	x=1 test echo done test
+	/usr/bin x=1 "$@" 'quoted text' && then sed printf then readonly
+	cd && cd grep 'quoted text' 2>/dev/null "$1" "$1" sed test
+then "$@" export sed readonly
+	${HOME} --verbose awk test awk 2>/dev/null /usr/bin 'quoted text' /usr/bin
+	&& cd printf --verbose "$@" ${HOME} printf echo sed
+grep ${HOME} ${HOME} cd test sed
+		$(pwd) cd printf -eu test | grep --verbose x=1 export
+		/usr/bin --verbose $(pwd) readonly printf readonly x=1
+		printf then "$@" --verbose then "$@" test awk /usr/bin x=1 /usr/bin "$1" export
+	'quoted text' $(pwd) 2>/dev/null readonly test
+		-eu "$@" "$@" sed test ${HOME} ${HOME} && cd | done local
+	local sed "$1" | readonly -eu "$1" -eu awk && "$1" $(pwd) printf
+	${HOME} readonly | done export /usr/bin ${HOME} done && test | printf
+	"$@" echo 'quoted text' ${HOME} /usr/bin ${HOME} readonly
+	export test ${HOME} readonly export
+		/usr/bin awk grep readonly x=1
+	| && cd --verbose /usr/bin 'quoted text' grep ${HOME}
+	"$1" test -eu --verbose grep awk sed export sed ${HOME} | -eu
+		'quoted text' grep 2>/dev/null local awk | -eu cd "$@"
+		readonly $(pwd) printf done ${HOME} grep $(pwd)
+		awk test | -eu local printf grep grep ${HOME} ${HOME} "$1"
+	| --verbose && 2>/dev/null
+		--verbose x=1 done -eu awk export echo && 'quoted text' -eu $(pwd) &&
+		local awk ${HOME} 'quoted text' then $(pwd) --verbose echo done export
+	local awk /usr/bin --verbose sed "$1" /usr/bin
+		export -eu 'quoted text' grep 2>/dev/null | then x=1 -eu x=1 'quoted text'
+		awk done 2>/dev/null ${HOME} $(pwd) | readonly printf "$1" $(pwd) export then
+	x=1 test | --verbose 'quoted text'
+--verbose then && ${HOME} /usr/bin awk $(pwd)
+"$1" x=1 cd cd "$@" $(pwd) test awk 'quoted text' && /usr/bin
+		$(pwd) awk test | x=1 sed -eu ${HOME} echo "$1" then readonly
+		&& grep 'quoted text' export then x=1
+	done grep /usr/bin grep printf "$1" printf 'quoted text'
+		$(pwd) 'quoted text' x=1 echo ${HOME} x=1 printf local "$1" | cd grep
+		then 2>/dev/null grep readonly
+| test ${HOME} printf then 'quoted text'
+	| $(pwd) local grep 2>/dev/null readonly awk && export "$@"
+"$@" test --verbose cd then 2>/dev/null
+done 2>/dev/null awk -eu $(pwd) -eu /usr/bin "$@" && awk && && printf
+	"$@" done readonly local local cd grep awk "$1" printf x=1 "$@"
+		| export 'quoted text' ${HOME} -eu readonly sed ${HOME} -eu
+		&& awk && "$@" sed | 2>/dev/null x=1 && $(pwd)
+	"$1" | awk | sed -eu sed local
+	cd cd readonly export -eu echo --verbose echo test readonly -eu local then $(pwd)
+--verbose 'quoted text' -eu $(pwd) export | /usr/bin
+	"$1" echo then sed readonly test printf && ${HOME} "$1" done local sed cd test
+x=1 test | x=1 /usr/bin cd echo sed then
+"$1" "$@" awk && ${HOME} test local readonly
+	x=1 x=1 export export readonly 'quoted text' cd echo echo grep export
+	done --verbose readonly && ${HOME} /usr/bin then test x=1 "$1" ${HOME} "$1"
+echo local export 2>/dev/null awk awk | "$1" export 2>/dev/null 2>/dev/null echo
+		awk test --verbose ${HOME} local $(pwd) grep
+	then x=1 then then "$1" test && --verbose "$@" printf then 'quoted text' readonly
+		sed ${HOME} 'quoted text' "$1" readonly /usr/bin awk
+	x=1 test --verbose ${HOME} then
+	| | ${HOME} && && local && --verbose
+	-eu export echo then export 'quoted text'
+export 2>/dev/null printf 'quoted text' test $(pwd) cd then /usr/bin
+--verbose export "$1" local done cd then export "$1" local ${HOME} test
+'quoted text' "$@" 2>/dev/null
+2>/dev/null awk /usr/bin 'quoted text' export ${HOME} "$@" echo sed grep printf
+	printf done "$1" echo echo sed "$@" test readonly grep 'quoted text'
+test done 'quoted text' 2>/dev/null
+	/usr/bin x=1 x=1 sed && local $(pwd) ${HOME} --verbose
+"$@" x=1 printf $(pwd) -eu local --verbose "$1" x=1
+"$@" export -eu 'quoted text' then 'quoted text' sed readonly done echo /usr/bin
+"$@" --verbose then awk test -eu -eu |
+		readonly 'quoted text' x=1 'quoted text' /usr/bin cd
+		${HOME} "$@" $(pwd) 2>/dev/null "$1" sed 2>/dev/null
+		cd printf echo "$@" grep printf "$@" | ${HOME} then
+		-eu local 'quoted text' test && test 2>/dev/null ${HOME} /usr/bin --verbose
+| readonly 'quoted text'
+	| 2>/dev/null local /usr/bin 2>/dev/null printf local cd $(pwd) ${HOME} 2>/dev/null
+		${HOME} echo then x=1 export "$@" printf 2>/dev/null
+cd /usr/bin export --verbose
+		'quoted text' grep export local x=1 echo x=1 2>/dev/null /usr/bin printf
+		--verbose "$@" $(pwd) -eu grep "$@" -eu
+cd printf then ${HOME} grep test test cd cd
+sed && 2>/dev/null readonly sed sed
+| export export "$@" readonly grep x=1 awk local readonly -eu
+		local awk ${HOME} 'quoted text' x=1 --verbose
+'quoted text' x=1 test 2>/dev/null /usr/bin
+		&& x=1 readonly x=1 readonly 2>/dev/null "$1" grep x=1 "$1" | done then -eu
+	cd then echo export awk && --verbose -eu $(pwd) done export 2>/dev/null
+${HOME} printf 2>/dev/null /usr/bin | $(pwd) -eu
+${HOME} && | grep sed 'quoted text' awk &&
+	then awk test "$@" /usr/bin echo echo readonly
+		"$@" local printf then | export
+	/usr/bin x=1 cd "$@" export "$@" --verbose
+		sed local echo printf echo
+2>/dev/null 2>/dev/null $(pwd) "$@" then
+export | 2>/dev/null cd test export cd $(pwd) 'quoted text'
+		cd cd x=1 then x=1 echo export ${HOME} 'quoted text'
+	then echo cd printf test awk /usr/bin export then
+grep awk echo ${HOME} 'quoted text'
+	&& awk grep | echo 'quoted text'
+&& x=1 --verbose -eu export 'quoted text'
+		x=1 printf awk then done 'quoted text' echo /usr/bin
+		| /usr/bin export then echo echo awk x=1 echo done x=1 && | local "$1"
+	printf 2>/dev/null x=1 then cd -eu export test grep cd && ${HOME}
+"$1" /usr/bin printf readonly "$1" readonly
+${HOME} cd cd grep "$1" grep printf readonly
+/usr/bin ${HOME} /usr/bin
+/usr/bin test grep --verbose
+	/usr/bin $(pwd) done 2>/dev/null sed printf -eu /usr/bin awk test grep
+		then | grep && /usr/bin cd -eu test local --verbose
+		x=1 ${HOME} export "$1" 'quoted text'
+	| sed export "$1" && -eu readonly "$1" done -eu -eu 'quoted text'
+awk "$@" 'quoted text' then printf local done | done export -eu grep cd 2>/dev/null
+		local echo awk /usr/bin
+local "$1" --verbose export local -eu done test echo grep printf -eu export
+'quoted text' $(pwd) ${HOME} $(pwd) grep 2>/dev/null readonly
+-eu then | done ${HOME} "$1"
+	cd grep ${HOME} cd echo readonly
+		'quoted text' x=1 echo "$@" | export ${HOME} 'quoted text'
+	--verbose 2>/dev/null ${HOME} awk ${HOME}
+--verbose echo then done /usr/bin cd local --verbose
+	awk local | --verbose --verbose then x=1 sed 2>/dev/null echo grep then export
+	2>/dev/null export -eu /usr/bin export printf $(pwd) printf "$@" 2>/dev/null &&
+	/usr/bin printf /usr/bin grep ${HOME} && awk "$@"
+		${HOME} "$1" x=1 test readonly sed cd -eu local
+then local -eu "$@" 2>/dev/null printf -eu sed $(pwd) cd awk awk cd 2>/dev/null
+${HOME} $(pwd) awk x=1 export echo | printf 2>/dev/null
+then echo /usr/bin printf done done test cd | cd local
+		grep done local /usr/bin printf echo /usr/bin grep awk test "$@" cd "$1"
+2>/dev/null ${HOME} export 'quoted text' cd 2>/dev/null awk
+	sed 2>/dev/null cd readonly
+		| $(pwd) /usr/bin readonly grep --verbose && 'quoted text' done && x=1
+		${HOME} /usr/bin /usr/bin test cd test export
+	$(pwd) --verbose export awk --verbose sed awk "$@"
+--verbose --verbose --verbose printf done printf sed 2>/dev/null export sed
+| ${HOME} && $(pwd) readonly ${HOME} --verbose local test test
+		readonly done test echo done local --verbose x=1 export local
+		local echo /usr/bin -eu && sed | && readonly
+"$1" then sed -eu test awk done $(pwd) done
+'quoted text' done x=1 printf 'quoted text' && "$@" --verbose | readonly /usr/bin
+		"$@" export "$@" $(pwd) done local sed
+	cd 'quoted text' $(pwd) ${HOME} /usr/bin sed sed | && then -eu -eu printf sed test
+readonly ${HOME} awk local done
+		grep local grep && then --verbose && && grep local -eu | x=1
+		done done grep local /usr/bin ${HOME}
+		grep test printf /usr/bin "$1" "$@" cd done printf sed
+		"$@" test 2>/dev/null /usr/bin export | printf readonly done test sed
+		sed test done 2>/dev/null "$1" cd -eu
+done export -eu x=1 echo "$@"
+&& export 'quoted text' $(pwd)
+		"$@" | /usr/bin then --verbose 'quoted text'
+--verbose readonly $(pwd) | 2>/dev/null $(pwd) test ${HOME} printf cd
+awk x=1 export export cd 2>/dev/null $(pwd) echo $(pwd) test
+	--verbose then 2>/dev/null
+	test grep ${HOME} local local cd
+${HOME} awk grep | --verbose $(pwd) printf cd ${HOME} | printf -eu 2>/dev/null
+sed /usr/bin "$1" ${HOME} "$@" &&
+x=1 cd && test 2>/dev/null $(pwd) local "$@" awk
+		sed --verbose 2>/dev/null
+		cd ${HOME} && /usr/bin local "$1" x=1 --verbose
+		sed /usr/bin echo printf 'quoted text'
+		x=1 sed test grep printf -eu /usr/bin --verbose readonly test x=1 --verbose done
+		${HOME} readonly sed local
+		done "$@" && x=1 readonly echo echo | &&
+-eu sed then $(pwd) cd grep
+	/usr/bin "$1" 'quoted text' --verbose -eu export && printf echo
+		export "$@" && readonly then "$@" awk then "$1" export 2>/dev/null
+		-eu sed printf && then x=1 done echo
+	readonly --verbose $(pwd) done cd "$@" $(pwd) printf
+test ${HOME} then && awk readonly
+		$(pwd) sed "$@" grep -eu $(pwd) && 2>/dev/null done "$1" "$@" | echo echo awk readonly
+		&& sed done "$1" printf 'quoted text' export sed
+'quoted text' x=1 && test 'quoted text'
+	grep && $(pwd) -eu test export echo
+		sed x=1 sed | "$1" printf readonly
+/usr/bin cd cd cd sed | then echo grep echo -eu
+	'quoted text' awk && then local 2>/dev/null cd && --verbose | /usr/bin readonly
+	sed "$1" "$@" local echo 2>/dev/null grep sed -eu "$1" x=1 ${HOME} grep
+		x=1 /usr/bin printf local 'quoted text'
+		grep "$1" x=1 $(pwd) "$1" "$1" printf
+	test "$@" --verbose awk "$@" readonly awk | export && cd sed -eu "$1"
+local printf 'quoted text' ${HOME} then grep $(pwd) done "$1" sed "$1" sed sed
+	echo --verbose /usr/bin ${HOME} printf readonly x=1 -eu "$1" local test
+	/usr/bin && done --verbose sed 'quoted text' && ${HOME} 'quoted text' ${HOME}
+	/usr/bin done 2>/dev/null x=1 "$@" ${HOME} "$@" grep local sed export -eu printf
+	sed --verbose local readonly local cd test
+	-eu && grep awk done cd readonly done
+		then cd 2>/dev/null echo grep echo readonly
+		echo 2>/dev/null cd /usr/bin 'quoted text' then --verbose 'quoted text'
+		"$1" export test /usr/bin $(pwd) 'quoted text' x=1 x=1 then sed
+	cd && x=1 local --verbose --verbose printf sed "$1" ${HOME}
+export awk -eu export sed 2>/dev/null
+		local printf grep cd 2>/dev/null
+		grep | test 'quoted text' printf /usr/bin && awk "$@" 2>/dev/null $(pwd)
+sed ${HOME} printf "$@" cd grep
+	export --verbose "$@" echo "$@" awk grep test sed -eu export $(pwd) "$1" 2>/dev/null
+	/usr/bin echo cd printf | cd | x=1 test export done ${HOME} 'quoted text' --verbose
+	&& && test "$@" && readonly test $(pwd) 2>/dev/null printf 2>/dev/null
+/usr/bin | test printf -eu ${HOME}
+echo printf readonly printf 2>/dev/null -eu --verbose done "$@" echo
+&& ${HOME} -eu -eu readonly
+2>/dev/null 2>/dev/null export -eu "$1" "$1" $(pwd) --verbose "$1" cd
+echo printf echo | -eu grep test cd x=1 done ${HOME} x=1 | 2>/dev/null cd $(pwd)
+-eu readonly 2>/dev/null "$@" $(pwd) echo | --verbose
+		$(pwd) echo x=1 | 'quoted text' && ${HOME} test sed
+test $(pwd) readonly done 2>/dev/null grep grep --verbose cd then "$1" && $(pwd)
+| awk x=1 ${HOME} printf printf /usr/bin done /usr/bin cd
+done then "$1" then ${HOME} $(pwd) cd -eu done -eu readonly
+grep printf printf 2>/dev/null --verbose test $(pwd) grep /usr/bin
+	readonly $(pwd) sed local x=1 printf 'quoted text' x=1 && ${HOME}
+	echo "$@" awk export
+		x=1 echo done done done x=1 "$@" awk printf "$@" 'quoted text' then $(pwd)
+		local local 'quoted text' cd readonly "$1" x=1 cd grep
+	2>/dev/null /usr/bin awk -eu test printf --verbose
+"$1" local test export printf done local "$1" ${HOME} ${HOME} local cd cd --verbose
+		cd export cd x=1 && && --verbose then cd -eu "$1"
+'quoted text' readonly cd -eu /usr/bin x=1 awk /usr/bin 'quoted text' printf
+then test done printf done --verbose echo echo && 'quoted text' echo "$1" 'quoted text'
+	| "$@" 2>/dev/null readonly awk test cd "$@" readonly
+	echo printf awk readonly x=1 printf | test "$@"
+	awk printf 2>/dev/null
+x=1 'quoted text' "$1" awk grep printf -eu
+		-eu -eu grep cd readonly awk echo grep "$1" echo
+	-eu 'quoted text' echo "$1"
+printf ${HOME} awk sed readonly export "$1" awk 'quoted text'
+		printf "$1" "$1" --verbose grep awk "$@" grep
+	--verbose cd x=1 x=1 echo
+		2>/dev/null export $(pwd) $(pwd) /usr/bin x=1 cd | 'quoted text' | then
+echo /usr/bin "$1" awk test local readonly
+		sed | && ${HOME} export --verbose sed /usr/bin
+	| x=1 && -eu local cd 'quoted text' echo -eu ${HOME} --verbose "$1" export 2>/dev/null
+		test export "$1" awk awk ${HOME} 2>/dev/null readonly
+	echo awk $(pwd) awk $(pwd) && | cd echo --verbose grep test sed readonly | readonly
+echo awk then export done done -eu local
+		done sed awk 'quoted text' /usr/bin /usr/bin && grep
+		-eu grep then grep | echo then /usr/bin /usr/bin export export 2>/dev/null
+		'quoted text' 2>/dev/null readonly local
+	echo 'quoted text' x=1 test export grep test --verbose x=1 test /usr/bin then cd
+		cd x=1 "$@" 'quoted text' readonly /usr/bin "$@" 2>/dev/null cd
+		local $(pwd) /usr/bin then -eu "$1" 2>/dev/null 2>/dev/null
+-eu ${HOME} echo "$1" "$@"
+		readonly export then 'quoted text' done
+		cd && 2>/dev/null "$1" echo local local echo
+	then ${HOME} --verbose $(pwd) echo then
+"$@" awk 'quoted text' test /usr/bin $(pwd) x=1
+		| test then "$@" $(pwd) then awk 'quoted text' /usr/bin 'quoted text'
+		/usr/bin echo "$@" /usr/bin "$1" export "$@" export
+	"$@" test x=1 "$1" --verbose x=1 local printf then awk printf done
+	"$1" readonly grep -eu 'quoted text' $(pwd) done | x=1 test 'quoted text' printf
+		/usr/bin export && /usr/bin
+	sed --verbose awk | 'quoted text' awk /usr/bin test /usr/bin
+	cd test then cd export
+	local "$@" test export "$@"
+		cd then && grep x=1 --verbose --verbose local test cd sed x=1 local && awk sed
+readonly export 'quoted text' ${HOME} printf grep --verbose sed done
+		then "$1" printf 'quoted text' grep $(pwd) awk done test --verbose /usr/bin && printf
+		| /usr/bin ${HOME} 'quoted text' 2>/dev/null done echo grep x=1
+		| ${HOME} && && sed ${HOME} done done "$1" cd awk export ${HOME}
+		| $(pwd) printf readonly 2>/dev/null "$1" then | --verbose
+test 'quoted text' printf --verbose -eu "$@" done | | "$1" "$@" 'quoted text'
+		${HOME} 'quoted text' x=1
+		local $(pwd) then 2>/dev/null echo grep 'quoted text' && local -eu
+		"$1" sed 2>/dev/null sed --verbose done test $(pwd) awk
+	$(pwd) | echo 'quoted text' printf done
+"$@" sed grep && sed grep --verbose local done cd $(pwd)
+		done ${HOME} --verbose
+	'quoted text' | 'quoted text'
+"$@" echo | "$1" export then sed test /usr/bin then && -eu x=1 -eu |
+		x=1 then /usr/bin local then /usr/bin
+	/usr/bin awk 'quoted text' "$1" grep
+		2>/dev/null | 2>/dev/null done "$1" test cd test && "$@"
+then --verbose awk -eu test then local done grep $(pwd) ${HOME} $(pwd)
+		--verbose /usr/bin readonly local printf x=1 x=1 done "$1" -eu export 'quoted text'
+--verbose ${HOME} "$1" "$1" -eu ${HOME} sed | sed
+	test local $(pwd) test sed done /usr/bin echo
+	--verbose && export x=1 done | sed local
+readonly -eu --verbose local local local
+		local && -eu readonly x=1 awk "$1" | 2>/dev/null 'quoted text' awk
+	done --verbose 2>/dev/null readonly
+awk local cd 'quoted text' x=1 | "$@" grep -eu sed "$@" sed
+sed export done readonly then "$1" && echo /usr/bin
+sed grep export | 2>/dev/null --verbose export $(pwd) x=1
+	sed ${HOME} "$@" ${HOME}
+	echo /usr/bin "$1" "$@" readonly $(pwd) export
+		-eu x=1 ${HOME} | 2>/dev/null | test done "$@" --verbose
+	readonly | then export && grep /usr/bin then grep $(pwd)
+	"$@" --verbose sed ${HOME} 'quoted text' sed --verbose
+	then "$@" 2>/dev/null test sed "$1"
+	| test echo local x=1 done $(pwd) 2>/dev/null
+		${HOME} printf echo done --verbose sed then --verbose sed /usr/bin local echo
+/usr/bin awk "$@" 'quoted text'
+	"$@" "$@" --verbose -eu -eu --verbose
+awk grep --verbose printf --verbose
+		"$@" local 2>/dev/null local && readonly awk && /usr/bin sed
+		awk test 2>/dev/null --verbose export
+		| sed awk test cd done x=1 && export 'quoted text' readonly
+		grep test done $(pwd) grep
+	echo readonly echo --verbose sed done done && local awk
+		${HOME} awk ${HOME} 'quoted text' awk then printf -eu awk "$1" $(pwd) 2>/dev/null
+		-eu --verbose awk local x=1 awk printf
+export cd | "$@" /usr/bin 'quoted text' echo --verbose grep /usr/bin
+		sed && then printf "$1" done grep test ${HOME} $(pwd)
+	-eu export echo local 2>/dev/null cd && echo 'quoted text' printf cd
+		printf --verbose grep /usr/bin export sed then $(pwd)
+		sed ${HOME} 2>/dev/null --verbose -eu printf -eu "$1" readonly echo local
+done && x=1 2>/dev/null --verbose "$1" "$1"
+	export 2>/dev/null printf "$@" 'quoted text' printf ${HOME} $(pwd)
+		${HOME} cd export grep && local 2>/dev/null --verbose then --verbose readonly
+	local readonly readonly test "$@" test printf /usr/bin $(pwd) awk 2>/dev/null
+$(pwd) $(pwd) | x=1 "$@" sed local then grep export awk cd sed local && | | x=1
+		$(pwd) test "$@" then --verbose x=1 && "$1"
+	then $(pwd) echo local sed test done | "$1"
+	printf sed -eu cd local awk then cd export local export 2>/dev/null echo
+	then printf local "$@" printf then /usr/bin grep -eu test
+	export 'quoted text' readonly
+-eu x=1 | export cd sed
+		test x=1 -eu local --verbose x=1 local
+	"$1" && -eu export done then then sed echo grep readonly | printf cd --verbose
+${HOME} readonly export awk "$@" local --verbose | x=1 test x=1 -eu export
+	readonly printf && local test --verbose done readonly --verbose
+		awk then x=1 "$1" ${HOME}
+&& test export readonly /usr/bin then local 2>/dev/null | sed /usr/bin echo | export
+	/usr/bin readonly grep
+test local x=1 cd $(pwd) printf printf "$1" then --verbose
+${HOME} sed 'quoted text'
+then x=1 then test ${HOME} ${HOME} echo grep
+	export test test | 2>/dev/null && -eu "$@" local 2>/dev/null
+grep then local grep x=1 $(pwd) sed export && local grep readonly
+local 2>/dev/null export --verbose
+		${HOME} sed -eu --verbose test "$@" 2>/dev/null "$1" awk
+		x=1 test done echo grep -eu done local local done ${HOME} done awk sed sed |
+local $(pwd) 2>/dev/null -eu x=1 2>/dev/null
+--verbose export "$1" x=1 sed cd x=1
+	readonly && echo -eu 'quoted text' $(pwd) 'quoted text'
+	2>/dev/null echo awk sed done printf echo
+		test printf 2>/dev/null awk "$@" x=1 ${HOME}
+	2>/dev/null --verbose --verbose then -eu awk cd "$1" $(pwd) "$1" then cd /usr/bin
+		${HOME} printf export x=1 "$1" local local done
+export -eu echo "$@" sed done 2>/dev/null
+	cd "$@" ${HOME} -eu /usr/bin | $(pwd) ${HOME}
+		local -eu -eu grep /usr/bin grep --verbose 'quoted text'
+readonly 2>/dev/null ${HOME}
+		&& cd -eu printf export readonly then --verbose readonly
+		&& | printf local export $(pwd) awk /usr/bin sed echo "$@" cd --verbose
+	readonly "$@" x=1 --verbose /usr/bin
+	-eu $(pwd) | test done "$@" ${HOME} -eu grep /usr/bin 2>/dev/null
+		printf printf cd "$1" cd export then x=1 cd | -eu printf -eu readonly cd then
+	'quoted text' ${HOME} "$1" 2>/dev/null grep grep | ${HOME} ${HOME} cd $(pwd) /usr/bin
+echo "$1" awk done ${HOME}
+readonly | 'quoted text' grep done "$@" export "$1" readonly
+		echo test then cd readonly echo $(pwd)
+	-eu 'quoted text' export ${HOME} x=1 grep readonly | -eu 'quoted text' awk
+${HOME} /usr/bin --verbose sed done
+		sed 'quoted text' test export sed
+"$@" local sed test sed 2>/dev/null ${HOME} readonly $(pwd)
+printf -eu 'quoted text' 2>/dev/null --verbose
+	"$1" && sed local "$@"
+	${HOME} /usr/bin local test 'quoted text' 'quoted text'
+then done local && /usr/bin then x=1 then export x=1 sed sed done
+		"$1" 'quoted text' local
+		${HOME} readonly echo echo "$1" x=1 grep then && export
+		then test ${HOME} ${HOME} $(pwd) export local | awk awk ${HOME} awk
+		sed echo readonly --verbose -eu then "$@" $(pwd) grep -eu "$@" echo $(pwd) |
+	'quoted text' grep "$1"
+		readonly && x=1 --verbose done export done
+		--verbose /usr/bin echo printf ${HOME} && echo $(pwd) &&
+		${HOME} 2>/dev/null export x=1 echo readonly ${HOME} $(pwd) done local grep 2>/dev/null
+		2>/dev/null x=1 ${HOME}
+	echo test 'quoted text' readonly echo local && "$1" export
+		"$1" $(pwd) 'quoted text'
+readonly ${HOME} printf grep /usr/bin grep
+	test awk echo --verbose &&
+		grep echo "$@" | -eu test awk local local readonly
+	${HOME} /usr/bin --verbose ${HOME}
+	echo local grep $(pwd) readonly readonly $(pwd) --verbose
+		'quoted text' /usr/bin $(pwd) sed && | $(pwd)
+	-eu cd 'quoted text' "$1" sed cd test done 'quoted text' grep local export
+	"$1" $(pwd) 2>/dev/null then "$1" 'quoted text'
+$(pwd) "$@" 2>/dev/null awk then && grep /usr/bin export && readonly
+"$@" x=1 | test echo echo /usr/bin $(pwd)
+		then cd "$1" ${HOME} 2>/dev/null x=1
+		test export 'quoted text' ${HOME} -eu /usr/bin local
+		test cd local ${HOME} "$@" grep echo awk $(pwd) $(pwd) cd $(pwd)
+echo "$1" cd ${HOME} awk | export printf
+		${HOME} printf "$1" readonly "$@" ${HOME} printf $(pwd)
+then echo --verbose then -eu readonly x=1 echo grep
+		echo --verbose awk sed $(pwd) grep sed
+	test "$@" 'quoted text' -eu "$@" | -eu local
+		echo cd export 'quoted text' test export export
+	then readonly printf test export
+	&& cd 2>/dev/null test ${HOME} cd 'quoted text' "$@" | awk "$@"
+--verbose grep /usr/bin "$1" local ${HOME} && |
+	2>/dev/null readonly | "$@" "$@" && done printf awk "$@" /usr/bin
+	'quoted text' grep 'quoted text' "$1" 'quoted text'
+	--verbose awk x=1 $(pwd) && readonly test
+		x=1 "$@" printf printf -eu sed 2>/dev/null export awk $(pwd) 2>/dev/null
+		| sed then -eu printf 2>/dev/null cd done local grep done
+"$@" $(pwd) -eu awk cd printf sed sed --verbose x=1 x=1 "$1" "$1"
+		awk "$1" && /usr/bin 2>/dev/null export -eu | x=1 2>/dev/null
+-eu grep export cd then cd readonly cd done 'quoted text' x=1 'quoted text' then
+export grep test test done export
+	&& $(pwd) sed | cd 'quoted text' then grep local --verbose
+'quoted text' -eu /usr/bin ${HOME} grep
+	--verbose sed --verbose
+	done --verbose | printf local && "$@" echo
+	| grep grep sed 'quoted text' export && done x=1 echo /usr/bin
+	| sed readonly 'quoted text' awk printf 2>/dev/null 2>/dev/null
+	grep "$@" echo "$1" then && x=1 then awk printf --verbose && x=1 echo export readonly
+	x=1 awk x=1 cd grep /usr/bin export export printf $(pwd) "$1" 2>/dev/null local
+		&& 2>/dev/null | "$@" readonly done --verbose test && | cd export
+		--verbose 2>/dev/null grep && && awk grep 2>/dev/null $(pwd)
+"$1" "$@" $(pwd) "$@" "$1" 2>/dev/null local "$1" 2>/dev/null ${HOME} grep 2>/dev/null
+	awk local x=1 test ${HOME} cd local awk ${HOME}
+	-eu done "$1" grep -eu /usr/bin echo echo readonly readonly
+	${HOME} ${HOME} x=1 echo && done
+		sed && export cd $(pwd) done 'quoted text' test --verbose
+awk x=1 grep test "$@" "$1" 2>/dev/null
+	printf cd /usr/bin printf "$1" && readonly readonly "$@" 'quoted text' "$1" x=1
+"$@" cd export sed 2>/dev/null
+	$(pwd) test echo "$1" test ${HOME} done $(pwd) && cd sed "$1" |
+	-eu done && printf 2>/dev/null &&
+&& local awk done x=1 && sed cd echo $(pwd) "$@" --verbose 'quoted text' awk
+sed awk awk --verbose ${HOME} ${HOME} test printf
+	$(pwd) cd done readonly readonly x=1
+	&& | grep cd test "$@" ${HOME} readonly
+		--verbose test cd cd local 'quoted text'
+		x=1 | -eu test then $(pwd) done echo "$1" "$1" $(pwd) echo local done
+x=1 sed cd done export cd local
+		sed --verbose $(pwd) --verbose --verbose 'quoted text'
+x=1 --verbose sed $(pwd) printf ${HOME} test /usr/bin
+then 'quoted text' | echo
+		local cd readonly done /usr/bin | 2>/dev/null
+echo printf echo && 2>/dev/null printf test 'quoted text'
+	x=1 "$@" printf echo test -eu --verbose && -eu && $(pwd) done echo |
+		readonly ${HOME} "$1" local 2>/dev/null
+		--verbose done echo sed awk readonly then sed $(pwd) "$1" -eu x=1 grep grep
+test sed /usr/bin /usr/bin ${HOME} /usr/bin
+sed echo "$1" export "$@" 2>/dev/null
+	--verbose done /usr/bin
+grep --verbose 2>/dev/null sed awk cd --verbose
+cd export local local ${HOME} 'quoted text' $(pwd)
+printf awk done -eu cd awk local export
+		&& 'quoted text' awk $(pwd) grep 'quoted text'
+	readonly && sed 2>/dev/null grep "$1" | && "$1" readonly test "$@" test sed printf
+	${HOME} printf 2>/dev/null then printf "$@" --verbose "$1" ${HOME} done test 'quoted text'
+"$1" echo cd --verbose grep grep --verbose done test 'quoted text'
+echo awk | readonly grep test readonly readonly $(pwd) 'quoted text'
+grep grep /usr/bin local readonly local done awk x=1 readonly --verbose --verbose
+sed local ${HOME} 2>/dev/null $(pwd) 2>/dev/null done echo
+${HOME} && sed --verbose readonly sed sed
+	--verbose test sed 2>/dev/null && | /usr/bin sed readonly
+test && done local then $(pwd) readonly $(pwd) export sed echo 'quoted text'
+	$(pwd) cd 'quoted text' ${HOME} grep | | x=1 "$1" ${HOME}
+		cd -eu | echo echo local printf then grep export /usr/bin done
+	"$1" | --verbose $(pwd) ${HOME} done then x=1 then echo sed sed grep x=1 x=1
+grep readonly 'quoted text' test echo x=1
+echo sed "$@" export awk /usr/bin &&
+		--verbose | sed x=1 x=1 printf then --verbose readonly 'quoted text'
+	grep then "$1" | cd -eu | done done sed done printf export grep
+		&& /usr/bin -eu done grep && local then awk echo $(pwd) "$1" 'quoted text' /usr/bin
+		awk 'quoted text' ${HOME} then awk x=1 test x=1 --verbose sed /usr/bin cd
+	sed && $(pwd) 'quoted text' 2>/dev/null export 'quoted text'
+	"$@" grep then /usr/bin export then 'quoted text' 'quoted text'
+		/usr/bin sed "$1" -eu "$@" -eu local test --verbose sed awk printf then 'quoted text'
+	grep readonly echo && done cd awk "$@" then /usr/bin done sed /usr/bin
+	'quoted text' /usr/bin echo x=1 export sed "$1" cd | printf
+		&& x=1 && awk && && then && ${HOME} /usr/bin export
+	test /usr/bin local 2>/dev/null /usr/bin /usr/bin echo
+	"$@" local local ${HOME} echo then "$@" "$@" 'quoted text' --verbose 2>/dev/null
+	$(pwd) grep 'quoted text' sed done done 2>/dev/null grep --verbose test 2>/dev/null
+	export -eu --verbose 2>/dev/null sed --verbose && | /usr/bin done 'quoted text'
+	"$@" | -eu echo done -eu 'quoted text' test /usr/bin test printf 2>/dev/null
+		/usr/bin 'quoted text' 2>/dev/null cd "$@" ${HOME}
+/usr/bin echo 'quoted text' && "$1" "$1" grep -eu cd local
+test 'quoted text' printf -eu echo 'quoted text' --verbose
+cd "$1" x=1 ${HOME} /usr/bin -eu printf printf ${HOME} && $(pwd) $(pwd) local grep
+	printf sed /usr/bin test /usr/bin sed readonly echo x=1
+	then awk && $(pwd) sed "$1" && 'quoted text' 'quoted text' 2>/dev/null
+	--verbose ${HOME} "$@" done ${HOME}
+		readonly ${HOME} && printf ${HOME} ${HOME} 'quoted text'
+-eu -eu awk "$@" then export test test "$1" 2>/dev/null $(pwd) | then
+local | $(pwd) readonly awk "$@"
+export test ${HOME} done 'quoted text'
+		| ${HOME} 2>/dev/null
+-eu 'quoted text' local ${HOME}
+grep /usr/bin 'quoted text' /usr/bin done local
+test export export sed | echo x=1 'quoted text'
+	'quoted text' export ${HOME} grep --verbose --verbose "$1" echo
+	/usr/bin $(pwd) grep && "$1" then then /usr/bin export grep -eu readonly $(pwd)
+${HOME} --verbose "$@" "$@" $(pwd) $(pwd)
+	x=1 echo done --verbose $(pwd)
+/usr/bin local grep local "$@" readonly
+		-eu then && --verbose ${HOME}
+		&& "$1" $(pwd) echo then grep readonly awk --verbose 2>/dev/null sed readonly
+	readonly "$@" done local printf $(pwd) cd ${HOME} printf -eu
+		"$@" | local | -eu "$1"
+	x=1 readonly cd 'quoted text' /usr/bin -eu && grep
+/usr/bin 2>/dev/null readonly done --verbose test done sed 2>/dev/null
+then sed "$@" -eu ${HOME} -eu local | local "$1"
+readonly ${HOME} "$@" && --verbose
+	x=1 awk && grep && test grep test printf echo export "$@" export "$1"
+		local export local -eu echo test
+	$(pwd) && ${HOME} awk "$@" awk | /usr/bin -eu grep "$1" "$1" awk done
+	| cd awk 2>/dev/null test test then readonly
+	awk awk --verbose grep echo "$@"
+echo x=1 | ${HOME} readonly
+		grep grep cd awk cd | "$1" readonly 'quoted text' x=1
+		sed readonly --verbose printf awk 'quoted text' 2>/dev/null
+	echo 2>/dev/null 'quoted text'
+export readonly cd local "$1"
+awk printf cd 2>/dev/null --verbose printf x=1 readonly 2>/dev/null done "$@"
+grep -eu readonly readonly | then grep then
+then --verbose x=1 awk 2>/dev/null && 2>/dev/null done
+	sed 'quoted text' --verbose
+grep "$1" grep sed sed 2>/dev/null 'quoted text' grep export
+	$(pwd) local ${HOME} /usr/bin then test local cd /usr/bin done --verbose
+"$@" $(pwd) && sed test test done done grep -eu /usr/bin
+	echo "$1" && readonly export "$@" export 'quoted text' --verbose
+		"$@" "$@" -eu "$@" export 2>/dev/null | /usr/bin | cd -eu done 2>/dev/null
+	| test 2>/dev/null && 2>/dev/null $(pwd)
+	2>/dev/null readonly local cd "$1" printf x=1 echo ${HOME} $(pwd)
+	then readonly grep $(pwd) then 'quoted text' awk ${HOME} printf local readonly
+		test awk | "$1" -eu x=1 test cd
+	${HOME} printf && done export ${HOME} grep done 2>/dev/null
+		-eu "$1" echo grep && test && done 'quoted text' --verbose then test 2>/dev/null
+	$(pwd) "$@" printf ${HOME} done /usr/bin
+		test | $(pwd) ${HOME} cd then | awk | $(pwd) "$1" printf readonly
+	--verbose local 'quoted text' local then test printf ${HOME} "$@" "$1" ${HOME}
+		grep echo $(pwd) local awk sed $(pwd) && awk test $(pwd) grep ${HOME} sed && local
+/usr/bin cd done grep /usr/bin /usr/bin test grep -eu
+2>/dev/null echo sed echo && /usr/bin then "$1" echo -eu 'quoted text'
+	2>/dev/null echo cd export /usr/bin cd cd test echo awk --verbose x=1 'quoted text'
+echo "$1" grep "$1" sed
+	'quoted text' then | readonly -eu
+		readonly $(pwd) 'quoted text' echo then sed $(pwd) test && 'quoted text'
+	readonly | 2>/dev/null echo test --verbose | "$@" "$@" grep readonly
+'quoted text' export local /usr/bin printf printf
+local && awk awk printf test printf "$1" 2>/dev/null
+then $(pwd) /usr/bin sed printf test done done x=1
+	"$@" 2>/dev/null 'quoted text' printf grep 'quoted text' printf "$@" readonly
+	${HOME} /usr/bin --verbose sed readonly 'quoted text' --verbose
+	| printf printf ${HOME} export -eu 2>/dev/null local -eu /usr/bin
+	sed done | x=1 cd 'quoted text' "$@" echo local local printf "$1" cd 2>/dev/null
+--verbose test ${HOME} sed cd
+	then awk cd grep cd 'quoted text' $(pwd) "$1" x=1 export done grep grep "$1" test
+		/usr/bin && printf export then | $(pwd) awk /usr/bin grep echo ${HOME} --verbose
+| 2>/dev/null local done x=1 done /usr/bin && echo echo test "$@" readonly local
+--verbose readonly done local
+	grep | $(pwd) | export "$1" /usr/bin 2>/dev/null
+		sed $(pwd) /usr/bin 'quoted text' readonly echo printf done local && local
+$(pwd) test awk done | awk then --verbose readonly test test /usr/bin
+		${HOME} ${HOME} test x=1 && /usr/bin | 'quoted text' then local
+sed "$1" --verbose then --verbose then | then export cd $(pwd) echo grep
+'quoted text' 'quoted text' /usr/bin echo 'quoted text' x=1 done --verbose
+$(pwd) cd x=1 | done /usr/bin
+| local $(pwd) then cd grep x=1 local 'quoted text'
+		"$@" export "$1" sed then
+		${HOME} /usr/bin awk "$1" done --verbose $(pwd) readonly
+	readonly awk echo grep &&
+		-eu readonly $(pwd) | 2>/dev/null /usr/bin -eu &&
+echo grep x=1 /usr/bin 'quoted text' grep
+	| export export printf ${HOME} echo --verbose awk sed 2>/dev/null readonly
+	echo then export export local x=1 cd then
+		-eu awk "$@" test local ${HOME} grep done cd grep export x=1 awk 'quoted text'
+local readonly export grep "$@" awk local local readonly cd export
+		$(pwd) $(pwd) $(pwd) done readonly /usr/bin echo printf awk 2>/dev/null
+	'quoted text' sed local
+then --verbose x=1 'quoted text' export cd then local | local
+	grep sed /usr/bin $(pwd) | --verbose ${HOME} local grep --verbose
+readonly test 'quoted text' $(pwd) -eu "$@" -eu
+	local local then x=1 "$@" $(pwd) then cd done
+	-eu /usr/bin --verbose && test -eu "$@" -eu readonly export
+		&& "$1" local readonly "$@" /usr/bin 2>/dev/null test export export
+		2>/dev/null test 2>/dev/null "$@" then export --verbose printf
+awk cd grep sed -eu done | $(pwd) done ${HOME} "$1" awk then | then
+-eu done export awk then "$1"
+	export 'quoted text' readonly
+	| 2>/dev/null /usr/bin && awk then 2>/dev/null sed "$1" "$1" "$1" | sed 'quoted text'
+sed /usr/bin /usr/bin awk | | test --verbose 2>/dev/null $(pwd) done /usr/bin
+	grep printf && 'quoted text'
+local awk $(pwd) local done readonly ${HOME} test "$1"
+		--verbose readonly $(pwd) --verbose then 'quoted text' sed "$1"
+$(pwd) ${HOME} "$@" | awk ${HOME}
+awk cd "$1" local --verbose awk $(pwd) ${HOME} 'quoted text' then ${HOME} /usr/bin
+		&& then "$@" echo $(pwd) "$@" && 'quoted text' ${HOME} x=1
+		--verbose done grep grep 'quoted text' test /usr/bin export
+		| "$1" | sed then ${HOME} "$1" local export -eu readonly ${HOME} $(pwd) ${HOME}
+sed "$@" local | "$1" printf ${HOME}
+	sed && ${HOME} -eu $(pwd) | ${HOME} grep ${HOME}
+then awk export "$1" --verbose test x=1 --verbose --verbose local /usr/bin
+		'quoted text' readonly done x=1 && echo grep local "$1" "$@" cd "$@" && sed
+		&& export x=1 then x=1 echo 2>/dev/null
+		cd --verbose local -eu $(pwd) "$1" /usr/bin done
+	done "$@" "$1" local --verbose | echo test local awk sed ${HOME} && "$1" done
+	${HOME} /usr/bin 2>/dev/null then /usr/bin
+"$1" sed done then x=1 x=1 /usr/bin -eu echo test "$1" 'quoted text'
+	test && 'quoted text' x=1 then 2>/dev/null x=1
+		$(pwd) --verbose | | sed | export --verbose 2>/dev/null --verbose then
+	$(pwd) 2>/dev/null printf --verbose printf && --verbose
+echo --verbose 2>/dev/null local --verbose cd
+local then "$1" printf "$@" grep && 2>/dev/null
+		export done ${HOME} ${HOME} --verbose local echo
+		readonly /usr/bin export local
+then cd cd cd test 'quoted text' test ${HOME}
+'quoted text' readonly local -eu echo -eu echo done 'quoted text'
+	sed export "$1" test ${HOME} grep local /usr/bin cd -eu x=1 grep -eu ${HOME}
+	${HOME} sed then /usr/bin test "$@"
+local then | grep echo then 2>/dev/null grep "$1" echo -eu /usr/bin readonly printf
+$(pwd) "$1" done $(pwd) local x=1 echo printf "$1" then sed readonly
+&& echo $(pwd) --verbose export ${HOME} sed local x=1 && x=1
+		/usr/bin export grep | x=1 test export ${HOME} test
+		printf ${HOME} ${HOME}
+| 'quoted text' | cd awk "$@" x=1 cd grep cd 'quoted text' test 'quoted text'
+	echo /usr/bin $(pwd) grep | then
+test then --verbose "$1" export readonly --verbose
+		export local done done 2>/dev/null printf test test -eu test
+--verbose echo sed 'quoted text' "$@" /usr/bin --verbose ${HOME}
+&& sed local done ${HOME} "$1" "$@" $(pwd) then
+		'quoted text' local local echo -eu 'quoted text'
+		--verbose local /usr/bin -eu && done readonly
+cd ${HOME} echo done export cd cd export
+		readonly export local
+awk && readonly /usr/bin done "$@" x=1 local x=1 x=1 sed
+	2>/dev/null x=1 done /usr/bin sed
+#include c2.sh
+export readonly cd x=1 2>/dev/null readonly "$@" readonly grep 'quoted text'
+		awk --verbose done $(pwd) /usr/bin cd echo $(pwd) | -eu
+	export "$1" --verbose "$@" grep $(pwd) /usr/bin sed awk export readonly
+/usr/bin export $(pwd) $(pwd)
+grep local --verbose |
+"$1" 'quoted text' echo && export export --verbose | $(pwd) -eu x=1 "$@"
+		2>/dev/null -eu local printf
+'quoted text' local sed 'quoted text' export /usr/bin
+		/usr/bin test -eu done "$1" -eu awk "$@"
+	"$@" 2>/dev/null grep && cd awk /usr/bin "$@" local
+		/usr/bin readonly 2>/dev/null done echo local "$1" --verbose
+		--verbose | x=1 'quoted text' $(pwd)
+		--verbose awk x=1 | -eu x=1 then grep 2>/dev/null echo && readonly
+x=1 then "$@" /usr/bin /usr/bin $(pwd) awk --verbose | && grep
+/usr/bin "$@" 2>/dev/null
+	-eu test done $(pwd) --verbose export 'quoted text' printf "$1"
+		done export done printf grep
+grep readonly printf "$1" -eu test ${HOME} local awk 'quoted text'
+	test ${HOME} test "$1" /usr/bin "$1" echo readonly /usr/bin
+echo x=1 test 'quoted text' 'quoted text'
+$(pwd) && readonly x=1 $(pwd) done then x=1 local readonly
+	| "$1" done sed printf export sed -eu echo test
+	grep printf cd printf awk /usr/bin "$1" ${HOME} printf
+		sed printf echo export && done
+${HOME} readonly then
+then ${HOME} x=1 && echo cd sed "$@" readonly local then
+		2>/dev/null x=1 awk && "$1" 2>/dev/null awk x=1 export awk test "$@"
+	then "$1" "$@" "$1" -eu 'quoted text' printf -eu cd done grep 'quoted text'
+	test "$1" $(pwd) then && 'quoted text' local awk grep x=1 ${HOME} ${HOME}
+	local -eu x=1 "$1" | 'quoted text' echo 'quoted text' && ${HOME} local
+	then && echo -eu "$@" sed x=1 |
+cd | "$1" --verbose | awk echo awk echo done sed x=1 sed cd -eu then
+	test /usr/bin export "$1" 2>/dev/null /usr/bin grep --verbose
+printf --verbose then ${HOME} done
+cd local | 2>/dev/null $(pwd)
+'quoted text' "$@" test grep
+	printf done -eu awk && 2>/dev/null
+	-eu -eu grep test local cd printf
+	local | export $(pwd) sed --verbose
+		printf "$@" awk x=1 grep ${HOME} cd "$1" x=1 cd x=1 /usr/bin 2>/dev/null
+		| sed "$@" then | 'quoted text' $(pwd) ${HOME} 'quoted text'
+awk readonly && /usr/bin local 'quoted text'
+grep readonly $(pwd) x=1 ${HOME} done
+		local export cd grep local 2>/dev/null grep echo ${HOME} export
+	test local /usr/bin printf
+/usr/bin echo cd export ${HOME} /usr/bin done done $(pwd) --verbose local
+echo ${HOME} test ${HOME} export && 2>/dev/null |
+| grep readonly awk "$@" x=1 done && cd echo then local local -eu --verbose
+done 'quoted text' export cd | -eu export ${HOME} readonly | "$1" x=1 cd sed
+	grep sed grep "$1" awk | && "$1" test 'quoted text'
+		grep "$@" printf then export export
+	done echo /usr/bin $(pwd) "$@" cd ${HOME} test
+		test "$1" then awk /usr/bin
+	awk local printf local
+		then "$@" x=1 ${HOME} "$@" "$1" $(pwd) $(pwd) printf -eu
+	then sed readonly "$1" export export printf --verbose readonly &&
+		/usr/bin --verbose "$@" printf grep 2>/dev/null 'quoted text'
+&& --verbose cd /usr/bin then /usr/bin
+"$1" /usr/bin "$@" then /usr/bin
+		awk 'quoted text' -eu echo
+	--verbose sed $(pwd) && /usr/bin cd && export 2>/dev/null 2>/dev/null
+	export awk export grep test "$1" ${HOME} export x=1 done grep
+		then | printf && sed $(pwd) "$@" sed echo echo $(pwd) && "$@"
+		--verbose && 'quoted text' export
+echo 2>/dev/null local local | awk 'quoted text' done done /usr/bin
+	"$@" cd 2>/dev/null sed
+	done 2>/dev/null | echo "$@" "$1" ${HOME} grep echo grep export printf grep "$1"
+--verbose /usr/bin x=1 'quoted text' export
+	echo | echo "$@" grep 'quoted text' x=1 'quoted text' echo export sed
+/usr/bin | cd 2>/dev/null cd | 2>/dev/null x=1 /usr/bin -eu
+	"$1" sed "$@" export | sed local /usr/bin sed 'quoted text' test grep "$1" "$@"
+		"$@" awk sed ${HOME} /usr/bin x=1
+	done export sed "$1" 'quoted text' export | test $(pwd) ${HOME} 2>/dev/null
+		-eu sed grep sed --verbose awk ${HOME} && printf --verbose local then 2>/dev/null
+| then -eu export 2>/dev/null $(pwd) then awk cd "$@"
+	"$@" && "$@" local test "$1" $(pwd) "$@" 2>/dev/null x=1 'quoted text' done
+		then test cd $(pwd) grep -eu local echo done "$@" export x=1 echo
+	2>/dev/null "$1" "$1" echo --verbose test
+--verbose "$@" ${HOME} readonly done echo local test 2>/dev/null "$1" x=1
+	then -eu /usr/bin | grep awk export -eu local then --verbose /usr/bin "$@" $(pwd)
+'quoted text' "$@" cd x=1
+	then cd /usr/bin sed "$1" x=1 "$1" then awk "$1" readonly
+	&& cd awk | && "$@" 2>/dev/null "$1" "$1" 'quoted text' "$@" --verbose export
+		x=1 x=1 2>/dev/null local local --verbose sed 'quoted text'
+		-eu /usr/bin "$@" $(pwd) | sed echo 'quoted text'
+cd $(pwd) -eu x=1 awk x=1 && && -eu -eu x=1 -eu echo -eu /usr/bin "$1"
+	"$@" -eu test sed ${HOME} 2>/dev/null
+/usr/bin echo $(pwd) sed 'quoted text' grep
+	awk local && "$@" ${HOME} local "$1" -eu
+'quoted text' "$1" awk ${HOME} cd cd |
+-eu | 'quoted text' "$@" then readonly /usr/bin x=1 readonly echo
+	done -eu echo then && readonly $(pwd) "$1" &&
+		readonly 2>/dev/null then local test --verbose readonly awk "$@" "$1" x=1
+		${HOME} grep /usr/bin done local -eu then ${HOME} sed awk local
+		then $(pwd) 'quoted text' "$1" test local readonly --verbose
+'quoted text' "$@" "$1" x=1 grep awk awk
+local local -eu awk printf $(pwd) printf sed && --verbose awk echo cd awk
+x=1 ${HOME} export done "$1" awk echo then && "$@" awk "$1" test done done
+	echo | export echo 2>/dev/null done done
+	-eu grep sed export 'quoted text'
+grep | 'quoted text' -eu && test sed x=1 $(pwd) $(pwd) then printf
+readonly ${HOME} printf test printf export /usr/bin && 2>/dev/null
+	then echo $(pwd) $(pwd) echo test export then export readonly /usr/bin
+		${HOME} readonly "$1" /usr/bin done --verbose 2>/dev/null | export | ${HOME}
+| done then "$1" --verbose grep local "$1" done
+	awk export ${HOME} -eu 2>/dev/null /usr/bin then readonly echo awk awk $(pwd)
+		"$1" then -eu grep "$@" 2>/dev/null $(pwd)
+	"$@" done -eu --verbose local echo ${HOME} x=1
+		&& export export 2>/dev/null export "$1" --verbose test sed
+		awk | -eu | grep 2>/dev/null readonly sed local 'quoted text' "$@" local readonly
+awk cd readonly /usr/bin
+	${HOME} && printf && 'quoted text'
+		awk "$1" | "$1" printf readonly /usr/bin test echo /usr/bin --verbose 'quoted text'
+		then grep "$1" done printf
+	/usr/bin $(pwd) && grep | export 'quoted text' 2>/dev/null
+	awk && export x=1 'quoted text' then cd grep 'quoted text'
+	$(pwd) then | then 'quoted text' cd /usr/bin -eu 2>/dev/null awk local /usr/bin
+done ${HOME} sed export /usr/bin sed 2>/dev/null x=1 test ${HOME} cd
+		--verbose /usr/bin --verbose ${HOME} readonly test
+	x=1 && /usr/bin export "$1" then done done $(pwd) 2>/dev/null
+		readonly printf "$@" printf "$@" "$1" local
+		test local done /usr/bin local awk /usr/bin && && && && cd
+	export printf /usr/bin ${HOME} cd printf ${HOME} "$1" --verbose echo /usr/bin
+"$@" "$@" sed done && "$1" printf
+	awk done printf test sed grep 2>/dev/null cd local ${HOME}
+	sed readonly -eu echo local x=1 | cd local x=1
+done printf && export printf
+		"$1" 'quoted text' printf test printf "$1"
+		test local awk --verbose "$1" grep && test ${HOME}
+		-eu 'quoted text' -eu 'quoted text' 2>/dev/null
+		done readonly test sed && && 'quoted text' -eu &&
+	sed sed "$@" 2>/dev/null cd | then echo | grep then cd 2>/dev/null awk
+		readonly 2>/dev/null readonly "$1" local export
+	x=1 grep "$@" sed 2>/dev/null
+	2>/dev/null -eu sed -eu | -eu "$@"
+		then --verbose /usr/bin $(pwd)
+'quoted text' readonly test printf
+	grep 'quoted text' "$@"
+	printf ${HOME} 2>/dev/null local
+&& -eu | | sed then "$@" | local printf /usr/bin "$1" -eu grep
+		-eu then --verbose test local printf ${HOME} done cd export -eu 'quoted text'
+	echo 'quoted text' sed
+		readonly export then 'quoted text' echo -eu /usr/bin | test then test
+test awk ${HOME} printf 2>/dev/null readonly
+$(pwd) export $(pwd) /usr/bin cd done x=1 | then printf -eu $(pwd)
+		printf | readonly "$1" --verbose $(pwd) grep
+		/usr/bin test | 'quoted text' ${HOME} test grep awk done
+		then echo readonly /usr/bin x=1 -eu
+	awk sed done local "$@" 'quoted text' -eu printf -eu test then
+		then grep readonly awk ${HOME}
+	export ${HOME} sed x=1 -eu 2>/dev/null /usr/bin
+		$(pwd) printf 'quoted text' -eu
+	&& | echo -eu done "$1" -eu x=1 sed "$1" then then printf $(pwd)
+--verbose x=1 cd done "$1" && test echo done printf local local | ${HOME} | local
+		awk awk 'quoted text' "$@" local x=1 2>/dev/null then --verbose
+'quoted text' then awk then printf ${HOME} readonly --verbose sed
+		grep x=1 printf grep then | readonly
+	grep x=1 -eu && grep grep
+test $(pwd) && local export 'quoted text' 'quoted text'
+echo done -eu awk printf "$@" ${HOME} local readonly done --verbose done sed ${HOME}
+readonly test awk --verbose local export awk
+echo awk done awk done readonly printf done test "$@" $(pwd) $(pwd)
+		--verbose 2>/dev/null -eu "$@" "$1" sed
+sed echo x=1 export "$@" local 'quoted text' printf then printf
+		'quoted text' export --verbose export
+	export sed export local x=1 "$@" x=1
+		${HOME} $(pwd) $(pwd) export sed /usr/bin | export printf
+cd x=1 readonly && test then /usr/bin "$@"
+local 'quoted text' printf export "$1" echo "$@" ${HOME} "$@" 'quoted text' cd export
+		sed awk 'quoted text' --verbose
+		$(pwd) cd --verbose 2>/dev/null sed | sed | then x=1
+	export "$@" "$@" cd local readonly ${HOME} readonly
+	/usr/bin | printf printf test "$@" $(pwd) test 2>/dev/null /usr/bin | awk
+	export "$1" sed printf then "$@" grep $(pwd)
+		done --verbose -eu -eu 2>/dev/null "$@" cd "$1" cd $(pwd)
+		test "$1" $(pwd) "$@" printf then local export cd 2>/dev/null
+		| sed $(pwd) 'quoted text' 'quoted text' 'quoted text' -eu sed /usr/bin
+"$@" echo readonly | local $(pwd) grep then $(pwd) then printf | /usr/bin ${HOME}
+local "$1" ${HOME} test grep then --verbose then printf --verbose
+		then readonly cd | --verbose done echo "$1" 2>/dev/null
+	sed 'quoted text' printf 'quoted text' "$@" printf $(pwd) -eu test -eu | &&
+		2>/dev/null export --verbose then export done "$1" "$@"
+${HOME} awk 2>/dev/null 2>/dev/null x=1 grep
+echo -eu | --verbose local awk /usr/bin
+		readonly grep $(pwd) printf && export echo grep $(pwd) awk test --verbose
+	printf readonly done cd 2>/dev/null readonly echo done export
+		local "$1" "$@" cd && awk cd readonly done /usr/bin cd 2>/dev/null export 'quoted text'
+		sed "$@" done grep echo -eu sed $(pwd) then && sed done test test -eu local |
+"$1" /usr/bin /usr/bin then grep
+		x=1 awk local test cd | grep ${HOME} "$@"
+		printf grep then ${HOME} cd local --verbose "$1" echo $(pwd) sed /usr/bin
+	then ${HOME} awk local done sed done --verbose "$1" echo
+		then 'quoted text' printf | local echo printf "$1" | "$1" -eu 'quoted text' -eu
+	"$@" done readonly -eu test ${HOME} 'quoted text'
+		x=1 'quoted text' cd $(pwd) sed test x=1 echo printf && readonly cd --verbose
+grep -eu awk | test grep sed "$1" 2>/dev/null local
+	local -eu awk done ${HOME}
+	then "$1" test x=1 "$1" "$@" x=1 'quoted text' ${HOME} 2>/dev/null
+	cd awk local cd sed x=1 cd readonly 2>/dev/null
+		&& /usr/bin ${HOME} echo sed done && readonly | export x=1
+	grep -eu export /usr/bin grep grep sed then ${HOME} $(pwd) cd "$@" local
+	2>/dev/null | grep readonly && && "$@"
+		then /usr/bin test echo $(pwd) readonly 'quoted text'
+	| done export sed cd x=1 test x=1 grep -eu "$1" "$@" x=1 awk then export done done
+x=1 'quoted text' export echo cd 2>/dev/null 'quoted text' local -eu --verbose
+"$@" export --verbose -eu done /usr/bin awk $(pwd) then | | ${HOME} 'quoted text'
+local echo "$@" awk ${HOME} "$1" test printf sed 'quoted text'
+		awk x=1 printf -eu /usr/bin -eu cd readonly && --verbose
+export -eu echo done
+		local local "$1" -eu "$@" 'quoted text' && then "$@" echo --verbose
+		local export 'quoted text' ${HOME} | "$@" echo then done 2>/dev/null echo
+	"$@" /usr/bin then echo && | cd cd sed -eu 'quoted text'
+cd | && grep "$1" --verbose grep test $(pwd) $(pwd) --verbose readonly
+then then grep "$1" done ${HOME} printf
+"$@" awk x=1 export -eu &&
+		-eu echo awk local "$1" | 'quoted text' local sed $(pwd) cd grep echo | echo
+	export ${HOME} && awk $(pwd) /usr/bin 2>/dev/null awk 'quoted text' awk
+	then local 'quoted text' then "$@" 'quoted text'
+		export "$@" grep /usr/bin
+x=1 | local then $(pwd) test export
+	test x=1 ${HOME} --verbose local printf 2>/dev/null $(pwd) && then /usr/bin
+x=1 /usr/bin "$@" "$1" export awk local export export
+		"$@" $(pwd) sed && 'quoted text' | awk cd done $(pwd) cd -eu test printf x=1
+awk sed local "$@" grep "$1" -eu then local cd x=1 readonly $(pwd) --verbose sed
+		| printf "$1" -eu -eu local --verbose 'quoted text'
+"$@" export local /usr/bin awk x=1 sed cd
+--verbose && x=1 "$@" cd sed echo x=1 ${HOME}
+grep sed grep $(pwd) && done export --verbose -eu done | && | --verbose
+		&& 'quoted text' then "$1" then local
+--verbose $(pwd) && | $(pwd) grep readonly 'quoted text'
+	readonly "$1" local | && local printf 'quoted text'
+export test --verbose 'quoted text' -eu && done done cd done then
+	${HOME} then done then | echo sed sed
+		sed cd x=1 echo x=1 then local --verbose
+	"$@" /usr/bin export grep | grep
+sed --verbose printf $(pwd) $(pwd) sed
+test test test 2>/dev/null "$@" sed | && printf
+echo && --verbose readonly echo local
+		awk | $(pwd) printf export done 2>/dev/null
+x=1 -eu grep local cd export && && grep $(pwd) grep export --verbose
+		then "$@" && printf x=1 export cd 2>/dev/null echo grep then 2>/dev/null
+"$1" grep --verbose --verbose cd readonly --verbose export
+	grep -eu awk test ${HOME} then -eu 2>/dev/null 'quoted text' sed test
+	awk printf -eu done 2>/dev/null
+local printf ${HOME} then
+	-eu /usr/bin 'quoted text' | &&
+		cd echo echo 'quoted text' "$1" "$@" ${HOME} done ${HOME}
+awk 2>/dev/null ${HOME} --verbose -eu cd x=1
+	&& test grep /usr/bin "$@" ${HOME}
+	sed readonly x=1 awk --verbose echo
+		$(pwd) cd awk $(pwd) done export
+		| x=1 cd printf /usr/bin
+	/usr/bin $(pwd) grep "$@" printf 2>/dev/null &&
+	export /usr/bin done awk
+		sed printf /usr/bin 'quoted text' sed local test
+	then "$@" x=1 then && $(pwd) 2>/dev/null sed &&
+&& local --verbose grep && ${HOME} | --verbose x=1 | && --verbose done ${HOME}
+		-eu | cd "$@" 2>/dev/null -eu "$1" test --verbose export 'quoted text'
+	&& readonly readonly readonly $(pwd) printf local
+		local local export awk $(pwd)
+	/usr/bin $(pwd) then then "$@" export $(pwd) readonly /usr/bin 'quoted text'
+		$(pwd) local then ${HOME} 2>/dev/null
+printf cd /usr/bin then cd --verbose 'quoted text' printf
+	printf grep "$1" 2>/dev/null x=1 test "$1" readonly "$@" | ${HOME} ${HOME}
+	2>/dev/null readonly | "$@" -eu /usr/bin $(pwd) test "$@" ${HOME}
+sed done && export test /usr/bin cd local export test local cd printf awk cd |
+		local 'quoted text' "$@" && "$@" grep readonly cd test echo
+then --verbose 'quoted text' "$1" awk 2>/dev/null $(pwd)
+	then 2>/dev/null readonly test awk "$1" local "$@" local && ${HOME}
+then awk sed 2>/dev/null "$1" readonly done --verbose "$1" && && "$@" "$@" 'quoted text'
+	readonly | cd echo /usr/bin --verbose grep
+/usr/bin test 'quoted text' -eu x=1 test 2>/dev/null done /usr/bin | then
+$(pwd) export grep /usr/bin readonly /usr/bin ${HOME}
+		x=1 echo sed "$1" then echo echo printf grep "$@" then
+2>/dev/null echo test awk 'quoted text' 2>/dev/null
+	echo echo | --verbose && && readonly 2>/dev/null then sed --verbose 2>/dev/null
+		printf test done $(pwd) cd $(pwd) "$@" --verbose printf
+&& cd "$@" export 'quoted text'
+	| $(pwd) local $(pwd) --verbose && cd x=1
+		| --verbose printf grep -eu local /usr/bin | -eu export |
+	export sed export -eu local /usr/bin
+'quoted text' test x=1 'quoted text' done
+	grep | 2>/dev/null $(pwd)
+		${HOME} export then --verbose ${HOME} cd done cd grep 'quoted text'
+"$1" echo /usr/bin grep && cd readonly echo x=1
+	"$1" x=1 --verbose export ${HOME} "$1"
+-eu then grep then ${HOME} 2>/dev/null done --verbose printf "$@"
+"$1" grep -eu -eu "$@" test export printf grep export 'quoted text' x=1
+	export 'quoted text' readonly done readonly readonly
+grep cd 2>/dev/null echo ${HOME} --verbose
+	echo printf "$1" "$@" local grep done
+export $(pwd) -eu test cd
+${HOME} $(pwd) "$1" export printf
+readonly 2>/dev/null 2>/dev/null | ${HOME} "$@" ${HOME} done && done
+		x=1 && then /usr/bin | printf -eu export grep echo /usr/bin
+${HOME} -eu readonly grep cd export local done && readonly echo 2>/dev/null
+	2>/dev/null local echo 2>/dev/null then test cd then "$@" printf /usr/bin
+		x=1 /usr/bin printf then -eu test
+		awk grep export echo export awk awk
+sed printf | 'quoted text'
+		-eu export && -eu $(pwd) then awk 2>/dev/null && cd $(pwd)
+x=1 export done printf test $(pwd) export echo done /usr/bin | $(pwd)
+	'quoted text' readonly && | sed /usr/bin /usr/bin awk x=1 $(pwd) then 'quoted text'
+	printf --verbose then && export test | 2>/dev/null readonly grep "$1" "$@" export
+export sed done -eu "$@" readonly $(pwd)
+/usr/bin x=1 ${HOME} x=1 --verbose "$@"
+	"$1" -eu $(pwd) grep printf 'quoted text' x=1 /usr/bin
+		"$@" grep done 2>/dev/null done /usr/bin -eu echo -eu grep $(pwd) --verbose 2>/dev/null
+| -eu done --verbose cd && then export
+	printf readonly test "$1" then readonly grep export test printf readonly
+		sed | then -eu $(pwd) "$@" x=1
+		--verbose "$1" cd "$@" | x=1 test $(pwd) ${HOME} 2>/dev/null 'quoted text'
+	echo echo x=1 readonly export then ${HOME} echo printf
+		local cd done $(pwd) awk
+	cd x=1 awk local ${HOME} "$@" cd && test /usr/bin
+cd | 'quoted text' ${HOME} export readonly sed --verbose
+	-eu test 'quoted text' local $(pwd) --verbose $(pwd) cd done
+	then ${HOME} x=1 readonly "$@" 'quoted text'
+		test "$@" awk x=1 --verbose 'quoted text'
+	| -eu "$1" $(pwd) | then 'quoted text'
+	'quoted text' x=1 grep cd --verbose $(pwd) -eu cd done | ${HOME}
+readonly done local "$1" && /usr/bin test test
+	cd awk echo "$1" | grep then local then export
+local grep local 2>/dev/null awk cd grep awk printf
+-eu printf cd export x=1 sed export $(pwd) printf test done export
+		local test then "$1" local local cd printf printf
+${HOME} "$1" $(pwd) export ${HOME} then sed awk && done echo grep echo
+		awk x=1 test awk echo then 'quoted text' awk | --verbose --verbose 2>/dev/null
+		&& | awk /usr/bin echo awk x=1 ${HOME} | export export
+	cd readonly /usr/bin then $(pwd) 'quoted text' $(pwd) -eu -eu cd
+		echo ${HOME} export printf "$@" 2>/dev/null
+		| readonly readonly awk -eu sed grep done /usr/bin
+${HOME} "$1" "$@" sed test awk cd grep /usr/bin cd && /usr/bin | | "$1" |
+awk then 2>/dev/null readonly "$1" && done -eu then local sed 'quoted text'
+&& readonly export $(pwd) | "$1" 2>/dev/null $(pwd) export local awk printf
+echo echo grep then export ${HOME} /usr/bin printf printf done --verbose then test
+	${HOME} x=1 2>/dev/null done local then -eu export --verbose
+		done sed --verbose | 2>/dev/null then
+		--verbose export && cd then readonly ${HOME} | 'quoted text'
+		cd printf export 'quoted text' /usr/bin -eu awk | readonly && -eu
+awk "$@" | x=1 then "$@" --verbose "$@" ${HOME} cd /usr/bin "$@" --verbose then
+		export -eu 'quoted text' 2>/dev/null /usr/bin
+| printf local readonly grep grep local
+	done 2>/dev/null local echo x=1 readonly /usr/bin
+printf 'quoted text' 'quoted text' then "$1" "$1" | readonly awk awk "$@" /usr/bin
+		local grep export x=1 local local /usr/bin readonly done sed -eu
+	readonly $(pwd) awk local done echo /usr/bin
+cd test "$@" awk /usr/bin then x=1 echo -eu grep 2>/dev/null
+		$(pwd) readonly test test ${HOME} -eu
+		2>/dev/null export $(pwd) awk |
+		"$1" "$@" local x=1 echo awk cd
+test sed cd cd 2>/dev/null test 'quoted text' x=1 x=1 "$1" test "$1" sed 'quoted text'
+	readonly && | then sed "$@" readonly test -eu printf then echo printf sed "$@"
+		printf 2>/dev/null x=1 "$1" "$@" then
+		2>/dev/null /usr/bin echo printf 2>/dev/null then done ${HOME} cd
+/usr/bin then --verbose export export grep /usr/bin "$@" cd
+	$(pwd) local grep local ${HOME} 2>/dev/null "$1" x=1 ${HOME}
+		test cd | readonly | x=1 grep && sed "$1"
+"$1" $(pwd) printf test |
+	export 'quoted text' sed grep 'quoted text' /usr/bin cd grep local done --verbose
+	local export echo --verbose "$@" done "$1" && ${HOME} printf local
+	export "$@" --verbose grep
+readonly "$@" -eu 'quoted text'
+	"$@" readonly done cd done /usr/bin | readonly test | awk local echo sed test &&
+	--verbose && export printf sed "$1"
+'quoted text' 'quoted text' | local
+		--verbose then && local -eu sed 2>/dev/null /usr/bin test echo "$@"
+printf ${HOME} /usr/bin test && awk "$1" |
+'quoted text' done -eu ${HOME} "$1" && --verbose echo
+	local "$@" then cd readonly 'quoted text' "$@" | 'quoted text'
+--verbose 'quoted text' | then "$@" then -eu echo "$@" test
+	"$@" | | sed local sed echo ${HOME} echo printf | /usr/bin
+	local grep then 'quoted text' 2>/dev/null -eu
+grep "$@" x=1 2>/dev/null $(pwd) 'quoted text'
+	awk --verbose cd 2>/dev/null && 2>/dev/null local && then $(pwd) 2>/dev/null
+&& awk ${HOME} export cd export | sed
+	done x=1 --verbose | x=1 cd 'quoted text'
+	awk | awk 2>/dev/null local local
+	done "$1" $(pwd) ${HOME} /usr/bin printf sed grep
+		done | $(pwd) $(pwd) /usr/bin /usr/bin sed x=1 --verbose
+then -eu -eu $(pwd) 'quoted text' "$@"
+printf /usr/bin 'quoted text' readonly awk test && cd grep 2>/dev/null
+	export ${HOME} then readonly /usr/bin 'quoted text' $(pwd) ${HOME} 2>/dev/null
+${HOME} | ${HOME} local cd /usr/bin /usr/bin sed $(pwd) sed readonly
+local cd printf $(pwd) && "$@" printf cd "$1" test readonly
+		cd 2>/dev/null printf x=1 local --verbose ${HOME} -eu export readonly x=1
+	grep then readonly then test
+		then -eu local 'quoted text' awk -eu | done echo readonly done readonly
+	then sed --verbose --verbose -eu $(pwd) --verbose
+	test awk readonly "$1" grep done ${HOME} && then "$1" printf x=1
+	readonly ${HOME} && echo then -eu printf | "$@" done && local echo cd "$@"
+local test export x=1 --verbose local --verbose /usr/bin printf printf x=1
+	'quoted text' grep --verbose sed sed local test printf "$@" local $(pwd)
+x=1 grep | export readonly 'quoted text' export echo /usr/bin
+/usr/bin 'quoted text' "$1" /usr/bin
+	test && "$@" /usr/bin printf && -eu 2>/dev/null local export export $(pwd)
+| "$1" grep 'quoted text' 2>/dev/null printf "$1"
+	"$1" printf done printf echo x=1 readonly
+'quoted text' sed "$@" printf /usr/bin
+		"$1" sed done printf awk x=1 -eu readonly printf
+		test $(pwd) sed "$1" sed test
+		| then sed $(pwd) echo local done grep local printf test && cd $(pwd) ${HOME} awk
+		&& echo grep x=1 printf --verbose | -eu | echo --verbose
+		printf awk ${HOME} $(pwd) sed ${HOME} /usr/bin
+	sed test --verbose then local --verbose awk
+	printf export 'quoted text'
+readonly echo "$1" x=1 export /usr/bin export local x=1 ${HOME}
+		/usr/bin $(pwd) 'quoted text' && echo /usr/bin "$@"
+${HOME} grep grep -eu
+		'quoted text' --verbose echo test 2>/dev/null 2>/dev/null awk echo
+		'quoted text' -eu "$1" readonly "$1" grep printf then 'quoted text'
+	test cd grep awk -eu echo printf awk awk $(pwd) grep
+		--verbose | -eu -eu 'quoted text' | x=1 "$@"
+cd cd x=1 cd "$@" readonly
+	then test printf then && -eu done 'quoted text'
+	'quoted text' sed test local /usr/bin sed echo
+"$@" cd x=1 -eu sed sed $(pwd) test -eu awk cd $(pwd) | grep then sed test --verbose
+		readonly $(pwd) then echo "$1" 2>/dev/null "$@" 'quoted text' $(pwd)
+		local /usr/bin /usr/bin -eu cd ${HOME} /usr/bin cd local
+		readonly && then export done export | cd then done grep | cd local
+		'quoted text' echo test sed 'quoted text' /usr/bin 'quoted text'
+sed $(pwd) export $(pwd) cd sed sed 2>/dev/null export $(pwd) x=1 test sed
+		| ${HOME} readonly printf 'quoted text' --verbose /usr/bin then sed awk
+		grep readonly local --verbose awk x=1 test then $(pwd) local
+then "$1" sed 2>/dev/null
+	sed -eu printf readonly
+	cd echo "$1" readonly awk sed test printf done export done grep echo $(pwd)
+	2>/dev/null ${HOME} awk grep --verbose $(pwd) 'quoted text' grep test 'quoted text'
+		printf --verbose printf export
+"$1" printf grep 2>/dev/null then -eu test echo /usr/bin done $(pwd)
+export local | local cd x=1 2>/dev/null local /usr/bin echo echo local
+		--verbose cd awk ${HOME} /usr/bin 'quoted text' sed echo $(pwd) cd
+		x=1 sed then done then readonly ${HOME} /usr/bin sed local cd ${HOME} sed readonly
+	printf readonly sed x=1 test "$1"
+cd test cd cd local | && then cd cd printf 2>/dev/null local
+	test then done then export $(pwd) ${HOME} awk --verbose done readonly | &&
+	"$@" echo cd $(pwd) "$@" printf export echo --verbose x=1 && ${HOME}
+x=1 done 'quoted text' /usr/bin cd readonly 'quoted text' then test done
+"$1" sed done $(pwd) printf echo local grep
+		&& "$@" x=1 x=1 ${HOME} awk | x=1
+	printf | readonly --verbose /usr/bin readonly |
+		-eu /usr/bin grep printf cd local awk grep test | /usr/bin 2>/dev/null
+	done readonly test | grep sed 'quoted text' $(pwd) echo grep done && export
+"$@" printf then export export | --verbose
+	--verbose test export then export | echo done --verbose | local &&
+readonly echo x=1 test "$1" test && echo && && grep ${HOME} | cd awk export
+		/usr/bin done 'quoted text' sed readonly sed local "$@" grep "$@"
+done cd sed && printf "$@" grep 'quoted text' readonly printf echo printf
+		"$@" test ${HOME} -eu awk 'quoted text'
+then /usr/bin 'quoted text' local then local done grep grep
+then local && -eu grep --verbose "$1"
+		readonly --verbose printf cd echo test && test echo
+	"$1" --verbose "$@" grep sed
+	test "$@" 'quoted text' test "$1" echo -eu awk awk
+	$(pwd) printf test | done readonly 2>/dev/null x=1 2>/dev/null
+${HOME} -eu ${HOME} x=1 echo test sed -eu
+	| then ${HOME} test readonly 2>/dev/null printf "$1" grep grep readonly awk done
+	grep cd grep printf grep x=1 sed then grep "$@" grep && awk /usr/bin
+-eu echo sed | /usr/bin 2>/dev/null cd ${HOME} sed then $(pwd) local 2>/dev/null
+		readonly printf --verbose
+$(pwd) ${HOME} export awk sed "$@" "$@" /usr/bin cd
+		readonly $(pwd) then sed printf 'quoted text' readonly 2>/dev/null
+x=1 grep sed export test --verbose
+		'quoted text' "$1" done /usr/bin -eu cd /usr/bin echo cd ${HOME} /usr/bin ${HOME}
+		cd then readonly x=1 | $(pwd) 'quoted text' echo export sed --verbose
+	echo "$@" 2>/dev/null "$1" done local done local printf cd sed printf
+	printf "$@" done -eu x=1 printf $(pwd) -eu sed export test -eu
+		awk && ${HOME} echo /usr/bin sed $(pwd) --verbose | &&
+		'quoted text' | local && $(pwd) x=1 --verbose -eu "$@" 2>/dev/null
+	sed x=1 awk cd $(pwd) x=1 "$@" 'quoted text'
+printf | awk $(pwd) echo -eu cd 2>/dev/null "$@" | $(pwd)
+"$@" /usr/bin -eu awk 'quoted text' printf
+		done then readonly sed /usr/bin awk "$1" cd
+		export export done done 2>/dev/null sed local x=1 | "$@" grep local | "$1"
+	x=1 --verbose printf test "$@" && export done echo 'quoted text' 2>/dev/null
+"$@" then sed | readonly test | readonly
+		&& 2>/dev/null 'quoted text' grep $(pwd) 2>/dev/null echo echo export
+grep cd 'quoted text' cd | 2>/dev/null done
+	echo printf /usr/bin --verbose -eu printf printf readonly "$1" awk
+	export /usr/bin 'quoted text' local -eu local ${HOME} $(pwd) | x=1 /usr/bin echo
+	"$1" local 2>/dev/null "$1" local x=1 export
+	/usr/bin "$1" "$@" -eu ${HOME} cd 2>/dev/null sed && "$1" --verbose test
+	x=1 ${HOME} then -eu sed then then &&
+		$(pwd) | 2>/dev/null local cd x=1
+	sed echo --verbose $(pwd)
+	awk 'quoted text' echo && cd grep printf 2>/dev/null "$1"
+	then sed grep "$1" 'quoted text'
+		export local echo --verbose 'quoted text' readonly
+	/usr/bin done "$@" printf done done test -eu local /usr/bin "$1" && then
+		$(pwd) done "$1" ${HOME} | test sed readonly
+		| 2>/dev/null export printf --verbose sed readonly && 'quoted text' export
+	readonly then printf grep
+sed then | --verbose printf local 2>/dev/null grep echo printf
+		$(pwd) && && -eu local 'quoted text' | grep awk
+'quoted text' --verbose printf && then 2>/dev/null test
+awk 2>/dev/null --verbose export awk cd readonly | echo grep "$@" echo then
+done | local | sed printf readonly export "$@"
+| local readonly local 2>/dev/null
+export test $(pwd) grep cd readonly /usr/bin $(pwd) 2>/dev/null
+	'quoted text' 2>/dev/null printf "$1" readonly echo
+	readonly echo "$@" export -eu awk "$@" "$1" sed "$@" awk
+	&& local printf /usr/bin ${HOME} local && readonly sed cd grep "$@" ${HOME}
+sed done "$@" test grep cd cd 'quoted text'
+	echo export 2>/dev/null | 'quoted text'
+	export export then x=1 /usr/bin cd echo 'quoted text' 2>/dev/null grep $(pwd)
+then done 2>/dev/null -eu x=1 printf --verbose printf 2>/dev/null sed
+sed then grep | ${HOME} grep awk
+	x=1 then ${HOME} $(pwd) --verbose grep then grep 'quoted text' sed /usr/bin &&
+		x=1 2>/dev/null echo export sed printf $(pwd) "$1"
+	echo local test test x=1 $(pwd) ${HOME} grep -eu
+		| then -eu --verbose && $(pwd) &&
+	'quoted text' $(pwd) 2>/dev/null x=1 echo
+		test --verbose local --verbose $(pwd) awk
+		local $(pwd) ${HOME} 'quoted text'
+export export x=1 sed readonly readonly 2>/dev/null
+	'quoted text' then 'quoted text'
+awk awk awk printf test && test test cd
+grep | "$@" grep x=1 test printf
+	$(pwd) grep -eu "$1" echo printf $(pwd) done
+$(pwd) done echo local /usr/bin "$@" cd cd grep ${HOME}
+		export "$1" then "$1" 2>/dev/null 2>/dev/null "$1" && "$1"
+"$@" sed test "$@" -eu awk then local ${HOME} export grep /usr/bin
+		--verbose sed then "$@"
+	sed readonly echo | export local done printf 'quoted text'
+		$(pwd) echo /usr/bin awk then then sed awk awk export
+	${HOME} --verbose $(pwd) $(pwd) cd ${HOME} local sed grep awk
+	grep readonly ${HOME} "$@" local then -eu
+	"$@" 'quoted text' export test grep sed && --verbose $(pwd) "$@" local "$1"
+'quoted text' $(pwd) 'quoted text'
+	sed grep printf readonly printf /usr/bin readonly test -eu
+"$@" ${HOME} 'quoted text' export
+		grep && sed -eu x=1 x=1 sed | "$1"
+$(pwd) x=1 -eu grep echo 2>/dev/null grep "$@" $(pwd) 2>/dev/null --verbose
+	-eu "$1" awk && grep "$@" grep | readonly cd 'quoted text'
+export 2>/dev/null ${HOME} "$@" echo ${HOME} x=1 --verbose sed done grep grep
+	-eu && printf printf readonly $(pwd) | done then done
+		$(pwd) | then awk --verbose 'quoted text'
+	grep $(pwd) sed test | | export then test /usr/bin echo local readonly
+		$(pwd) cd 'quoted text' printf x=1 sed printf
+		${HOME} $(pwd) printf then /usr/bin local cd then sed --verbose awk ${HOME}
+		&& sed x=1 | awk 2>/dev/null then cd -eu
+'quoted text' && done && 'quoted text' test "$1" awk --verbose x=1 readonly
+	cd && awk && done echo "$@" x=1 done && test
+	cd --verbose ${HOME} 'quoted text'
+-eu printf local echo -eu export readonly 2>/dev/null
+		"$1" sed $(pwd) ${HOME} awk -eu done done
+"$1" && ${HOME} /usr/bin sed ${HOME} && cd done "$@" ${HOME} readonly then $(pwd)
+	"$1" sed test local echo cd -eu test 'quoted text'
+		grep "$@" x=1 local awk awk
+	${HOME} local "$@" 'quoted text' done /usr/bin then ${HOME} printf "$1" /usr/bin
+		&& echo cd "$@" $(pwd) printf
+| x=1 /usr/bin 'quoted text' -eu x=1 readonly export sed
+		'quoted text' echo 2>/dev/null 'quoted text'
+${HOME} export local cd 2>/dev/null
+		echo x=1 $(pwd) && awk $(pwd) then
+		2>/dev/null -eu readonly x=1
+	printf /usr/bin /usr/bin
+-eu test -eu && export then
+	/usr/bin then "$1" "$@" "$@" ${HOME} "$@" | 2>/dev/null
+	printf x=1 'quoted text' export x=1 $(pwd) export awk test /usr/bin awk
+	sed ${HOME} x=1 x=1 /usr/bin echo
+--verbose printf export
+		local | "$1" awk awk && grep /usr/bin export 'quoted text'
+done awk awk awk grep grep ${HOME} "$1" 'quoted text'
+"$@" cd | $(pwd) local ${HOME} readonly awk
+	"$1" 'quoted text' done x=1
+		done -eu done $(pwd) sed "$1" $(pwd) cd x=1 2>/dev/null
+	'quoted text' 2>/dev/null x=1 cd test "$1" done export cd
+		then 'quoted text' then -eu
+"$@" echo sed then printf 'quoted text' export x=1 x=1 /usr/bin readonly
+	awk echo local readonly ${HOME} done local grep grep echo printf
+	grep | --verbose | /usr/bin done -eu "$1" then readonly
+		cd echo sed ${HOME} | readonly "$@" then
+	done --verbose echo x=1 printf then --verbose --verbose cd --verbose done
+readonly test readonly 'quoted text' $(pwd) 'quoted text'
+		cd $(pwd) test /usr/bin 2>/dev/null
+2>/dev/null awk cd ${HOME} local | && cd
+	then | awk cd awk | grep awk x=1 x=1 cd 2>/dev/null
+awk done then ${HOME} /usr/bin $(pwd) --verbose -eu cd local x=1
+	then grep then && "$@" cd "$@" printf 'quoted text' /usr/bin cd x=1
+	grep $(pwd) x=1 "$@" x=1 'quoted text' export done printf
+		&& readonly grep printf "$1" readonly readonly | ${HOME} sed x=1 2>/dev/null
+local "$@" --verbose printf printf "$1" readonly $(pwd) sed
+	"$@" /usr/bin readonly grep 2>/dev/null -eu sed x=1 awk cd /usr/bin && -eu
+		$(pwd) echo 2>/dev/null export 'quoted text' test then x=1 readonly $(pwd)
+&& sed -eu test test cd 'quoted text'
+	test cd "$@" --verbose /usr/bin
+		| cd echo export | done test readonly -eu
+		"$1" 2>/dev/null ${HOME} printf echo $(pwd) --verbose $(pwd)
+		then --verbose -eu then sed ${HOME} sed ${HOME} /usr/bin "$1"
+		echo && 'quoted text' -eu local export /usr/bin x=1 cd test "$1"
+		${HOME} 2>/dev/null --verbose x=1 && -eu -eu awk readonly local cd cd echo
+&& export grep echo 'quoted text' readonly "$@" "$@" -eu /usr/bin awk
+	export && "$@" -eu sed done && grep --verbose "$@"
+	export sed $(pwd) sed awk -eu /usr/bin "$1" export /usr/bin -eu done cd
+	| cd "$@" 'quoted text' /usr/bin "$@"
+'quoted text' && "$1" 'quoted text'
+		readonly local readonly
+		&& x=1 $(pwd) --verbose "$@" done /usr/bin x=1
+x=1 echo readonly sed --verbose
+	&& 'quoted text' readonly test sed | printf -eu readonly sed $(pwd) awk readonly
+		&& "$@" test test ${HOME} cd grep awk
+	done sed done $(pwd) local cd printf
+local $(pwd) export printf 2>/dev/null
+	done export | ${HOME} | export
+		test local "$@" /usr/bin -eu --verbose --verbose
+		/usr/bin 'quoted text' then 2>/dev/null
+| -eu then readonly "$@" x=1 && cd done cd cd ${HOME} local done
+		2>/dev/null "$@" 2>/dev/null done readonly 2>/dev/null
+test /usr/bin "$@" readonly -eu local
+/usr/bin /usr/bin --verbose echo test
+		sed 2>/dev/null /usr/bin && grep printf
+2>/dev/null "$1" -eu "$@" | then --verbose 2>/dev/null cd $(pwd) awk ${HOME}
+		echo x=1 local printf test $(pwd) "$1" local | cd echo -eu 2>/dev/null
+	done /usr/bin sed /usr/bin "$1" && | -eu -eu x=1 | 'quoted text' ${HOME} readonly
+		&& | local grep cd local 2>/dev/null
+		readonly awk sed && $(pwd)
+	export echo awk && sed | /usr/bin
+"$1" cd sed 2>/dev/null test
+cd cd $(pwd) readonly | -eu then ${HOME} readonly awk grep
+		done done echo "$1" printf
+		${HOME} done echo local | | printf ${HOME} -eu done 2>/dev/null
+	-eu echo echo /usr/bin "$@" sed /usr/bin sed test --verbose
+		grep awk ${HOME} local done echo local /usr/bin | /usr/bin
+		sed then --verbose | --verbose
+	&& local grep printf done local x=1 readonly cd grep "$@"
+		--verbose grep /usr/bin
+		readonly -eu sed export
+		-eu x=1 local awk 2>/dev/null 'quoted text'
+	"$@" && echo local done x=1 printf
+		then done awk x=1 grep test printf 'quoted text' 2>/dev/null -eu /usr/bin --verbose
+		/usr/bin readonly export done done "$1" cd export -eu test test
+		'quoted text' export /usr/bin
+		${HOME} 'quoted text' local "$@" export local
+2>/dev/null -eu sed done "$1" | 'quoted text' sed readonly -eu cd "$@" "$@"
+	--verbose $(pwd) && 2>/dev/null grep 2>/dev/null 2>/dev/null export
+	then echo /usr/bin printf ${HOME} test x=1 readonly
+	2>/dev/null 'quoted text' done ${HOME} export awk 'quoted text' -eu then grep ${HOME}
+&& "$1" printf | grep local readonly local done awk && /usr/bin --verbose local
+	x=1 --verbose readonly then --verbose 'quoted text' printf
+		test --verbose printf ${HOME}
+export grep x=1 local "$1" $(pwd) 'quoted text' local export then x=1 | echo test
+	export | 2>/dev/null cd export done awk $(pwd) ${HOME} -eu sed test ${HOME}
+		export grep export done $(pwd) export awk "$1"
+then | $(pwd) "$@" /usr/bin /usr/bin
+		test export done test test printf awk test awk
+		done | done x=1 'quoted text'
+	"$@" $(pwd) echo local local 2>/dev/null
+		awk | -eu x=1 "$@" && ${HOME} awk
+	'quoted text' done awk ${HOME} --verbose
+	awk awk echo printf grep readonly "$1"
+&& && local --verbose && 'quoted text' $(pwd) ${HOME} x=1
+"$1" grep export /usr/bin awk
+		"$@" readonly test then
+	'quoted text' "$1" | grep 2>/dev/null "$1" awk x=1 printf
+cd awk /usr/bin x=1 readonly && cd test -eu -eu "$@" |
+| | $(pwd) test && done --verbose
+		/usr/bin | done done local | echo ${HOME} 'quoted text' cd /usr/bin 2>/dev/null
+done | done export grep $(pwd)
+		test | && done "$@" "$1"
+readonly test then --verbose && echo --verbose cd
+		--verbose /usr/bin x=1 2>/dev/null -eu "$@" -eu -eu then
+sed test x=1 done "$1" done cd readonly awk | --verbose
+	readonly $(pwd) "$@" done "$@" /usr/bin ${HOME} && --verbose ${HOME}
+&& cd done | /usr/bin then -eu awk done local done "$1" "$@"
+		test "$1" "$1" echo echo sed /usr/bin awk
+		"$1" local 2>/dev/null awk /usr/bin
+	readonly /usr/bin local 'quoted text'
+		"$@" 2>/dev/null awk && ${HOME}
+	cd && /usr/bin awk grep && printf test 'quoted text' ${HOME} 'quoted text'
+	local then grep $(pwd) --verbose readonly 2>/dev/null test ${HOME} x=1
+	${HOME} test awk 'quoted text' export cd "$@" local sed /usr/bin
+${HOME} -eu test ${HOME} x=1 $(pwd) 2>/dev/null then test test x=1
+"$@" awk cd readonly && echo --verbose $(pwd) x=1 "$@" && then grep test test
+		cd local grep cd local then sed
+local -eu 'quoted text' $(pwd) cd
+	grep printf readonly x=1 test $(pwd) export local
+		printf --verbose export awk --verbose sed --verbose grep
+		echo sed then 'quoted text' "$@" awk export -eu export
+then | && echo test 2>/dev/null -eu 2>/dev/null -eu |
+		readonly | | && x=1 grep 2>/dev/null
+		printf | --verbose local test test test "$1"
+		| /usr/bin cd echo test grep x=1 ${HOME} then
+	awk $(pwd) done cd export "$1" "$@" done -eu printf && grep | done then
+	test echo /usr/bin printf readonly printf printf -eu printf cd --verbose
+		x=1 'quoted text' readonly -eu ${HOME} printf
+"$1" done "$1" ${HOME} grep export echo "$1" echo && local readonly
+readonly export "$@" echo cd done 'quoted text'
+	"$@" 2>/dev/null "$1" $(pwd) grep local x=1 $(pwd)
+	-eu ${HOME} grep "$1"
+		echo local grep cd local /usr/bin && done awk && "$@" 'quoted text'
+'quoted text' /usr/bin --verbose then
+'quoted text' $(pwd) --verbose && grep 2>/dev/null cd awk
+		done --verbose then done | echo sed
+grep echo sed /usr/bin readonly 'quoted text' readonly
+		2>/dev/null ${HOME} export then ${HOME} 'quoted text'
+	sed "$1" 'quoted text' test echo | then -eu
+		printf cd cd | local done grep echo local -eu $(pwd) echo cd /usr/bin
+	awk test grep test printf
+	"$@" then done done then 'quoted text'
+		"$@" --verbose "$1" echo
+"$@" export && printf test printf
+		test sed readonly /usr/bin done echo x=1 | && printf $(pwd) echo readonly
+		2>/dev/null /usr/bin awk "$@" -eu awk 'quoted text' sed && test
+grep 'quoted text' awk "$@" awk -eu | -eu $(pwd) "$@" then sed ${HOME} "$@"
+export ${HOME} 'quoted text' "$@" printf 2>/dev/null
+sed "$1" then -eu -eu echo 'quoted text'
+| 2>/dev/null cd readonly then grep "$@" printf 2>/dev/null printf 2>/dev/null
+2>/dev/null 'quoted text' cd ${HOME} echo -eu 'quoted text' readonly /usr/bin
+${HOME} "$1" then | test grep readonly cd sed local test export
+	printf $(pwd) 2>/dev/null --verbose --verbose 2>/dev/null --verbose --verbose
+	/usr/bin -eu then 2>/dev/null /usr/bin "$@" |
+		printf | echo 2>/dev/null | ${HOME} readonly
+	$(pwd) 'quoted text' cd | cd printf && cd grep && ${HOME} then x=1 'quoted text'
+${HOME} local x=1 /usr/bin test | readonly local
+awk "$1" | 'quoted text' /usr/bin ${HOME} then 'quoted text' && grep export -eu
+	echo sed 2>/dev/null $(pwd) echo awk awk 2>/dev/null local ${HOME}
+awk readonly --verbose 2>/dev/null 2>/dev/null
+$(pwd) "$1" local printf
+test sed done && local | 'quoted text' "$1" $(pwd)
+	"$@" ${HOME} --verbose -eu -eu "$1" 'quoted text' /usr/bin && "$@" --verbose --verbose
+	then /usr/bin x=1 "$@" grep -eu
+	awk done then "$@" 2>/dev/null x=1
+		readonly "$1" "$1" grep grep
+printf echo test then sed export echo readonly then "$1" then
+	test "$@" done --verbose local "$@" readonly "$@"
+'quoted text' printf 'quoted text' -eu 'quoted text'
+	grep | "$1" cd && readonly
+'quoted text' echo sed /usr/bin "$1" -eu ${HOME} done "$1" --verbose
+		--verbose printf sed 2>/dev/null
+		"$@" && 2>/dev/null local awk 2>/dev/null x=1 local echo printf /usr/bin
+| test grep export x=1 done 'quoted text' && && grep "$1" "$1" && cd export readonly
+		printf x=1 test test 'quoted text' grep local | grep /usr/bin /usr/bin
+	'quoted text' cd printf grep echo test $(pwd) 'quoted text'
+	local -eu /usr/bin grep done $(pwd)
+	| local $(pwd) -eu 'quoted text'
+	cd cd export | cd export sed --verbose export done "$1" local ${HOME} $(pwd)
+cd $(pwd) --verbose "$@" then -eu cd readonly /usr/bin then then
+		/usr/bin /usr/bin 'quoted text' ${HOME}
+		2>/dev/null then local sed test
+sed ${HOME} test readonly local
+	grep sed ${HOME} | then local printf "$1" echo $(pwd) x=1 printf /usr/bin
+"$@" printf 'quoted text' /usr/bin done test --verbose -eu
+cd "$1" ${HOME} awk $(pwd) 2>/dev/null
+		export x=1 2>/dev/null && ${HOME} ${HOME} && /usr/bin /usr/bin
+		x=1 printf | awk printf
+local --verbose export $(pwd) grep --verbose printf then x=1
+	export 2>/dev/null done printf echo echo awk test grep ${HOME} sed
+		grep && export cd cd ${HOME} $(pwd) awk cd done
+	grep 'quoted text' --verbose -eu grep "$@" test ${HOME} /usr/bin -eu 2>/dev/null
+		awk then ${HOME} "$1" test
+		/usr/bin local readonly /usr/bin export local done then printf awk $(pwd)
+		/usr/bin done 'quoted text' done cd cd readonly grep $(pwd) "$@" ${HOME} |
+| ${HOME} ${HOME} awk -eu readonly ${HOME} "$1" $(pwd)
+		echo sed -eu printf "$@" local cd grep local
+		grep then sed export | x=1 sed x=1 "$@" readonly cd 2>/dev/null /usr/bin echo
+	local $(pwd) ${HOME} awk echo 2>/dev/null local
+2>/dev/null then "$1" local
+&& && x=1 2>/dev/null && "$@" test awk 'quoted text' "$@" local
+${HOME} 2>/dev/null ${HOME} echo $(pwd) 2>/dev/null
+		--verbose | -eu $(pwd) readonly && $(pwd)
+	cd grep local sed ${HOME}
+/usr/bin | grep export cd -eu cd 2>/dev/null then && readonly readonly
+"$@" grep readonly done echo export && && local
+		&& --verbose printf && done
+cd | -eu readonly | $(pwd) $(pwd) $(pwd) 2>/dev/null echo export x=1
+'quoted text' x=1 | then 'quoted text' $(pwd) readonly
+		x=1 --verbose test awk done then readonly x=1 x=1
+		"$@" $(pwd) echo && then && cd cd test local test awk
+		2>/dev/null echo --verbose | printf
+		-eu export export -eu readonly
+	"$1" test then done /usr/bin
+| done --verbose 'quoted text' |
+grep then && test && done
+--verbose && | test 2>/dev/null printf grep "$1" --verbose 'quoted text'
+	readonly $(pwd) "$@" test | $(pwd) grep awk awk | then sed
+	then x=1 x=1 "$@" $(pwd) local export "$1" 'quoted text'
+		x=1 /usr/bin echo done && -eu
+${HOME} ${HOME} /usr/bin cd cd x=1 && done export echo x=1 printf
+		echo awk grep "$@" local /usr/bin readonly | -eu echo export ${HOME} echo
+	then -eu "$1" $(pwd) printf printf | /usr/bin
+then sed | test "$1" "$@" /usr/bin cd test
+		sed awk "$1" echo printf grep
+| "$@" 2>/dev/null 'quoted text' cd --verbose test $(pwd)
+	test 'quoted text' 'quoted text' readonly printf local grep sed ${HOME}
+	readonly x=1 test sed x=1
+		readonly then readonly | "$1" $(pwd) awk x=1
+	echo done "$1" readonly test | x=1 x=1 cd cd local x=1 awk | &&
+		-eu grep grep x=1 'quoted text' "$1" readonly ${HOME} readonly echo && "$@" -eu
+printf local && 2>/dev/null ${HOME} grep "$@"
+		test grep sed -eu grep -eu 'quoted text' done done $(pwd)
+		${HOME} sed ${HOME} test
+local cd test && readonly grep sed | readonly
+		printf | sed cd done grep "$@" "$@" --verbose "$@" grep grep | done
+		done -eu /usr/bin printf test grep
+	| export ${HOME} 'quoted text'
+		local awk cd --verbose test
+-eu -eu "$1" -eu "$@" --verbose awk 'quoted text'
+awk ${HOME} test && export local then "$@" | readonly | --verbose done
+local awk grep then ${HOME} | export ${HOME} readonly x=1 2>/dev/null x=1
+	'quoted text' /usr/bin ${HOME} ${HOME} "$1" ${HOME} sed x=1 readonly cd
+local "$1" printf printf
+'quoted text' echo "$@" echo export && -eu readonly local "$@" -eu -eu
+${HOME} printf local -eu then ${HOME} "$@" 'quoted text'
+	sed "$1" printf printf test -eu awk ${HOME} "$@"
+printf then 2>/dev/null then local local
+${HOME} "$@" grep && "$@" printf
+	grep /usr/bin ${HOME}
+	sed local x=1 sed "$1" readonly -eu readonly
+| 2>/dev/null echo sed echo
+echo then echo --verbose export && /usr/bin awk sed 'quoted text' --verbose readonly
+test cd 'quoted text' printf --verbose sed printf 'quoted text' x=1 sed
+	${HOME} export export done
+	"$@" | cd echo 2>/dev/null && export then && | printf "$@" /usr/bin done
+	printf done done /usr/bin sed && "$@" export awk done then x=1 -eu sed cd grep
+	done test echo grep | x=1 test 'quoted text' -eu | awk -eu && |
+	local x=1 x=1 && 2>/dev/null ${HOME} awk /usr/bin
+		export test readonly local
+		cd "$@" "$1" local done awk -eu printf readonly
+	then 2>/dev/null -eu then "$1" cd "$1" ${HOME}
+		2>/dev/null && x=1 x=1 "$@" grep --verbose echo && sed /usr/bin echo
+	then sed x=1 2>/dev/null -eu readonly export /usr/bin
+	&& readonly | local local local | && export
+	${HOME} /usr/bin test /usr/bin "$@" awk --verbose test "$1" 2>/dev/null
+| $(pwd) awk export cd && && test printf
+		/usr/bin cd local sed export ${HOME} --verbose -eu | sed "$1" && x=1 sed done
+echo readonly /usr/bin export echo 2>/dev/null | local sed readonly sed x=1
+done echo printf "$@" readonly 'quoted text' -eu awk | "$1" echo export
+| "$@" awk grep -eu --verbose awk && ${HOME} then sed
+sed local done 'quoted text' cd x=1 test
+	"$@" cd test export -eu -eu local "$@" /usr/bin /usr/bin
+		readonly cd export 'quoted text' local
+	"$1" x=1 awk sed export
+awk export awk sed ${HOME} 2>/dev/null sed done -eu 2>/dev/null cd ${HOME}
+"$1" then local "$1" && ${HOME}
+	&& awk 2>/dev/null && then 'quoted text'
+		$(pwd) sed test done $(pwd) "$@" --verbose /usr/bin x=1 /usr/bin x=1 printf
+test -eu ${HOME} /usr/bin /usr/bin readonly "$@" test
+	x=1 -eu cd readonly local sed awk test $(pwd) $(pwd) then awk
+	echo awk x=1 printf echo $(pwd) | "$1" ${HOME} echo test "$1" 'quoted text'
+		-eu /usr/bin cd then ${HOME} readonly "$1"
+&& -eu "$1" x=1 grep 2>/dev/null then
+		'quoted text' cd awk cd readonly echo local cd ${HOME} | | printf $(pwd) 2>/dev/null
+		done printf && then 2>/dev/null local $(pwd) awk -eu /usr/bin done 2>/dev/null
+then local done ${HOME} then "$@" --verbose printf awk echo "$1"
+	grep awk /usr/bin grep local echo
+		&& cd "$1" cd && ${HOME} ${HOME} /usr/bin echo
+	local local export /usr/bin
+--verbose sed local cd && "$@" 'quoted text' readonly
+		'quoted text' --verbose | "$1" readonly
+		"$1" then --verbose 'quoted text' grep awk
+		$(pwd) x=1 awk export grep
+x=1 then export printf test /usr/bin x=1 2>/dev/null --verbose done /usr/bin
+	printf /usr/bin -eu echo 2>/dev/null export then sed
+		$(pwd) 2>/dev/null /usr/bin
+		printf sed awk "$@" ${HOME} && then x=1 export local test "$1"
+"$1" "$1" export sed 2>/dev/null 'quoted text'
+		echo grep --verbose cd $(pwd)
+	then test && "$1" local grep grep export
+	"$@" -eu 'quoted text' readonly
+		awk --verbose --verbose done readonly $(pwd) --verbose awk 'quoted text' sed
+	"$1" test $(pwd) grep $(pwd) printf printf then 'quoted text'
+		printf "$@" /usr/bin then printf "$1" &&
+		done && 'quoted text' 'quoted text' printf
+awk printf echo echo then x=1 'quoted text' awk done then
+echo done readonly 'quoted text' test echo 'quoted text'
+		awk awk /usr/bin local grep readonly 'quoted text' | done
+local "$1" sed cd grep then $(pwd)
+	${HOME} cd -eu readonly cd && then ${HOME} awk sed 'quoted text' awk && | awk 'quoted text'
+cd sed grep ${HOME} 'quoted text' done then ${HOME} echo && export | sed &&
+	'quoted text' /usr/bin
+	| && then sed --verbose ${HOME} test then cd awk --verbose done export awk
+	echo echo cd "$@" ${HOME} | "$1"
+| readonly export printf -eu cd then 2>/dev/null -eu && export cd 2>/dev/null
+	export done grep export 2>/dev/null
+	readonly local sed sed /usr/bin 'quoted text' local | cd 'quoted text' done echo
+export 2>/dev/null test -eu x=1 "$@" && cd "$@" local
+		cd --verbose cd export echo
+		--verbose awk 2>/dev/null sed
+echo ${HOME} 2>/dev/null export sed sed "$1" echo
+		"$@" test "$1" grep /usr/bin echo cd then "$@" 'quoted text' grep $(pwd) 2>/dev/null
+	2>/dev/null | printf sed export grep done local export readonly grep grep local
+		x=1 $(pwd) awk -eu $(pwd) done "$1" | "$@" done ${HOME} echo cd
+local "$@" printf "$1" printf cd sed "$1" cd awk | echo
+	| test --verbose then grep "$1" then /usr/bin
+/usr/bin ${HOME} $(pwd) printf 2>/dev/null 'quoted text'
+		2>/dev/null "$1" then done && printf cd cd
+printf -eu $(pwd) done ${HOME} 2>/dev/null readonly then export echo local
+		--verbose then cd "$@" then export
+printf echo | --verbose ${HOME}
+		then ${HOME} 'quoted text' echo | echo echo
+		done readonly then -eu echo | cd x=1 sed cd
+	-eu awk echo awk /usr/bin grep
+	2>/dev/null sed printf 'quoted text'
+		grep then done cd awk $(pwd) cd readonly && awk
+		'quoted text' "$@" local sed ${HOME} $(pwd) readonly "$@" $(pwd) "$@" --verbose
+	&& --verbose test readonly
+	sed done ${HOME} /usr/bin done /usr/bin export
+		echo readonly $(pwd) -eu "$@" then test "$1" $(pwd) test test | "$1" --verbose
+'quoted text' printf x=1 printf readonly then local "$1" x=1
+		export --verbose readonly export x=1 $(pwd) ${HOME} --verbose /usr/bin awk cd "$1"
+	x=1 cd readonly $(pwd) x=1
+	local grep local sed && test awk --verbose | grep /usr/bin
+	/usr/bin awk | 'quoted text'
+		sed "$@" then local done 2>/dev/null grep echo cd done grep x=1 | "$@" 2>/dev/null
+	"$@" sed cd readonly then then export test "$@" readonly /usr/bin 'quoted text'
+	--verbose echo 'quoted text' awk "$@" ${HOME} then "$@" /usr/bin done then &&
+echo test 'quoted text' then echo local
+		-eu --verbose readonly x=1 export -eu printf printf
+		-eu cd grep /usr/bin && -eu "$1" cd export "$@" 2>/dev/null test sed export 2>/dev/null
+	"$1" 'quoted text' export export export | echo
+printf /usr/bin "$@" printf x=1 printf "$@" sed awk x=1 printf
+printf | readonly | test
+	awk test printf "$@" && ${HOME}
+		grep && | readonly 'quoted text' cd | && ${HOME} readonly ${HOME}
+cd && 2>/dev/null cd
+		readonly ${HOME} --verbose grep --verbose local sed
+export test --verbose 'quoted text' -eu $(pwd) test awk "$@" -eu /usr/bin cd
+test 2>/dev/null -eu -eu echo /usr/bin done 'quoted text' &&
+	printf 'quoted text' grep --verbose 2>/dev/null export
+		cd /usr/bin $(pwd) "$1" test
+	&& && $(pwd) /usr/bin printf grep x=1 && awk
+	x=1 test && /usr/bin 2>/dev/null grep echo
+	'quoted text' $(pwd) -eu cd $(pwd) "$@" then
+	done 2>/dev/null 'quoted text' sed done sed "$1" "$@" cd ${HOME} awk 'quoted text'
+local readonly -eu "$@" 'quoted text' done 2>/dev/null "$@" test
+done --verbose readonly export echo -eu -eu
+	-eu export done 2>/dev/null
+	| printf readonly local | local readonly
+--verbose -eu --verbose printf grep awk -eu export
+cd sed 2>/dev/null export ${HOME} done "$1" local /usr/bin
+awk $(pwd) -eu cd ${HOME} 2>/dev/null 2>/dev/null "$@" done -eu echo
+	export readonly test "$@" cd | printf --verbose 2>/dev/null local awk ${HOME}
+2>/dev/null test echo && -eu export
+	-eu test echo ${HOME} "$1" local awk printf echo && cd --verbose cd
+	"$@" --verbose sed /usr/bin /usr/bin grep export | "$@" "$1"
+		x=1 then sed && "$1" --verbose x=1 cd sed
+test -eu /usr/bin 'quoted text' -eu grep
+readonly test | $(pwd) $(pwd) echo export 'quoted text'
+	"$1" x=1 done echo $(pwd)
+	grep && printf 2>/dev/null "$1" 'quoted text' --verbose
+		grep && sed echo --verbose --verbose local then $(pwd)
+		export sed sed cd "$1" done test "$1" -eu readonly "$1" cd x=1 done done
+'quoted text' $(pwd) cd --verbose cd echo echo grep 'quoted text' readonly -eu
+		readonly sed readonly && $(pwd)
+		readonly /usr/bin readonly 2>/dev/null local sed printf then
+		-eu export "$1" 'quoted text'
+readonly /usr/bin /usr/bin
+	/usr/bin $(pwd) 2>/dev/null
+cd awk ${HOME} awk echo ${HOME} ${HOME} echo grep awk local 'quoted text'
+		echo readonly sed $(pwd) 2>/dev/null done local 2>/dev/null ${HOME}
+	2>/dev/null && then then -eu 2>/dev/null
+	$(pwd) 'quoted text' echo | "$1"
+printf sed && $(pwd) test --verbose
+		test --verbose readonly 2>/dev/null "$@" done export printf x=1 cd then readonly
+		2>/dev/null test 2>/dev/null echo ${HOME} "$1" cd
+		${HOME} sed echo | ${HOME} "$1" cd cd | test --verbose cd sed 2>/dev/null
+	printf -eu sed -eu test done then $(pwd) 'quoted text' grep
+	'quoted text' done printf printf
+		"$1" "$@" grep grep cd export ${HOME} -eu
+		then test awk 2>/dev/null x=1 awk grep test | grep then
+	grep -eu "$@" /usr/bin then export
+	x=1 'quoted text' awk cd $(pwd) x=1 export 2>/dev/null
+local && test 2>/dev/null done 'quoted text' | "$@" x=1 $(pwd) done /usr/bin local
+		| 2>/dev/null awk $(pwd) grep x=1 ${HOME} 'quoted text'
+| export "$@" test $(pwd) local readonly cd && sed | && echo "$1" awk -eu | echo
+	2>/dev/null cd x=1 done awk $(pwd) cd readonly local ${HOME}
+test 'quoted text' awk awk
+2>/dev/null sed 2>/dev/null /usr/bin local x=1 "$@" echo 'quoted text'
+awk | test "$1" 'quoted text' echo "$1" $(pwd) "$@" "$@" awk awk
+	cd awk x=1 "$1" then 2>/dev/null test 'quoted text'
+		readonly ${HOME} local then sed "$@" && x=1 | ${HOME} /usr/bin
+		"$1" done done done "$@" -eu | printf echo -eu cd export ${HOME}
+2>/dev/null test done readonly
+"$@" | test sed && ${HOME}
+sed cd readonly 'quoted text' ${HOME} && "$@" echo readonly
+	"$1" $(pwd) grep awk grep 2>/dev/null
+readonly | ${HOME} ${HOME} /usr/bin readonly
+	$(pwd) echo sed --verbose export
+-eu "$@" && test grep && readonly
+-eu readonly 2>/dev/null
+		/usr/bin readonly ${HOME} sed $(pwd) local "$@" x=1 echo
+	"$@" echo 2>/dev/null -eu x=1 'quoted text' awk | | -eu -eu x=1 ${HOME}
+readonly 2>/dev/null 'quoted text' && "$@" export "$@" -eu 2>/dev/null
+		export then then 'quoted text' echo export printf "$@"
+	awk 2>/dev/null x=1 test && readonly | sed x=1 --verbose x=1
+/usr/bin readonly --verbose export echo
+	awk && 2>/dev/null cd export --verbose
+'quoted text' sed grep awk printf
+	readonly test x=1 cd $(pwd) local printf awk echo -eu --verbose -eu grep
+	"$@" sed grep && grep sed then
+		grep sed "$@" $(pwd) $(pwd) | --verbose done awk test done
+	export $(pwd) -eu 'quoted text'
+	/usr/bin $(pwd) "$1" ${HOME} readonly "$1" cd -eu | then 2>/dev/null
+		| awk 2>/dev/null | "$1" test local
+| done done then ${HOME} 'quoted text' &&
+	| sed test printf cd 2>/dev/null
+"$@" sed local $(pwd) cd sed "$1" "$1" readonly
+		--verbose x=1 sed ${HOME} grep ${HOME} local 'quoted text' 'quoted text' ${HOME}
+		-eu --verbose 'quoted text' ${HOME} test export x=1 awk "$1" grep -eu test awk /usr/bin
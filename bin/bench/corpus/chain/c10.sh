@@ -0,0 +1,2001 @@
+printf readonly readonly -eu printf cd printf | | ${HOME} grep 'quoted text'
+	awk local then then ${HOME} -eu ${HOME} readonly && test
+readonly | sed done cd printf
+&& | -eu 'quoted text' local printf --verbose
+		2>/dev/null --verbose test
+	$(pwd) readonly "$@" --verbose "$@"
+	"$1" sed "$1" $(pwd) sed | sed echo test
+"$@" $(pwd) echo echo "$@" done "$1" /usr/bin grep grep printf x=1 "$@" readonly
+2>/dev/null -eu /usr/bin done --verbose readonly "$@" /usr/bin x=1 local
+	&& "$1" echo "$@" readonly grep echo printf | 'quoted text'
+--verbose ${HOME} test x=1 ${HOME} echo done --verbose |
+		--verbose | readonly grep 'quoted text' printf | test
+sed x=1 'quoted text' export 'quoted text' /usr/bin x=1 export echo local
+readonly grep x=1 | -eu $(pwd) /usr/bin -eu && echo 'quoted text' sed done --verbose
+--verbose 'quoted text' grep done awk grep awk ${HOME} -eu -eu grep
+x=1 "$1" local x=1 done export test printf | export readonly export --verbose
+		readonly cd printf | printf echo
+	export done /usr/bin local echo awk cd done && echo test
+--verbose cd --verbose
+		cd test grep then --verbose ${HOME} --verbose cd /usr/bin cd then
+	"$1" sed export && -eu export | ${HOME} 2>/dev/null -eu && ${HOME} && x=1
+-eu 'quoted text' done sed "$@" done printf local /usr/bin printf printf then
+	awk then cd /usr/bin && echo printf cd readonly 'quoted text' &&
+export sed printf $(pwd) ${HOME} cd "$1" && -eu | $(pwd) ${HOME} "$@"
+echo 2>/dev/null 2>/dev/null echo done then
+$(pwd) cd && echo -eu echo && "$1" && $(pwd) printf /usr/bin
+		${HOME} "$@" | sed then -eu -eu then 'quoted text' export /usr/bin
+	/usr/bin -eu grep echo 2>/dev/null readonly
+x=1 printf "$1" ${HOME} x=1 sed printf export ${HOME} local 2>/dev/null
+2>/dev/null && -eu /usr/bin
+cd test readonly sed "$1" &&
+"$1" awk "$1" 'quoted text' 'quoted text' cd sed /usr/bin
+		"$1" "$@" export then local export printf test "$1"
+	printf awk echo local then awk echo 'quoted text' done x=1 --verbose
+	--verbose "$1" $(pwd) grep --verbose | "$1" readonly
+	/usr/bin then done "$1" awk /usr/bin 2>/dev/null "$@" done $(pwd)
+		done $(pwd) test /usr/bin x=1 | | done 'quoted text'
+		awk done sed ${HOME}
+cd $(pwd) readonly | "$@" 'quoted text'
+		grep /usr/bin done ${HOME} 'quoted text'
+		&& awk $(pwd) awk 2>/dev/null
+		local -eu x=1 ${HOME} x=1 -eu
+readonly echo export awk then sed sed local awk printf then grep sed 2>/dev/null
+	-eu echo sed echo readonly export | sed awk && cd grep 2>/dev/null local readonly
+		2>/dev/null $(pwd) --verbose &&
+test "$@" export "$@" echo sed local done
+	readonly local readonly export
+test awk "$@" done --verbose sed --verbose
+'quoted text' export readonly grep | cd /usr/bin && sed echo
+		&& && export $(pwd) && --verbose then && && test -eu grep "$@" printf test $(pwd)
+	cd test cd 2>/dev/null && --verbose
+x=1 then "$1" $(pwd) readonly "$1" done "$@" $(pwd) $(pwd)
+		$(pwd) printf --verbose x=1 done sed "$@" then 'quoted text' cd "$1"
+export $(pwd) -eu /usr/bin x=1 cd 'quoted text' grep printf
+	${HOME} grep -eu printf then awk test test sed readonly local
+local test cd 2>/dev/null readonly then "$@"
+	| readonly ${HOME} test -eu then grep 'quoted text'
+	then echo 'quoted text' awk ${HOME} export /usr/bin export 'quoted text'
+		export readonly sed awk --verbose grep local -eu awk && &&
+		cd | /usr/bin test awk then test | ${HOME} awk readonly x=1 local grep
+sed test then export grep echo awk 2>/dev/null
+		"$1" echo 'quoted text'
+	| | then /usr/bin -eu then && printf local /usr/bin | echo sed && printf &&
+awk && test then --verbose sed && "$1" | cd | echo awk --verbose sed
+/usr/bin printf $(pwd) --verbose x=1 -eu cd local "$@" readonly export printf local
+		sed 2>/dev/null $(pwd)
+	&& awk done && awk 2>/dev/null "$1" x=1
+awk 2>/dev/null "$1" done | grep && test $(pwd) local cd echo then
+	done $(pwd) -eu printf ${HOME} test echo cd readonly cd ${HOME} test
+		test done cd $(pwd) "$@" /usr/bin grep awk /usr/bin $(pwd) printf local
+	&& cd export test done | "$@" x=1
+		readonly && test 2>/dev/null
+'quoted text' 'quoted text' grep grep
+export && --verbose "$@" "$@" -eu -eu --verbose
+		&& done readonly --verbose test $(pwd) done
+&& "$@" 2>/dev/null 2>/dev/null 2>/dev/null then awk
+		/usr/bin 'quoted text' echo /usr/bin cd
+		"$@" readonly export test awk 'quoted text' cd awk readonly
+	cd $(pwd) awk sed 'quoted text' done then awk x=1 printf
+		${HOME} && readonly "$@" readonly "$1" cd then "$@" awk sed
+"$1" grep 2>/dev/null then "$1" readonly -eu cd $(pwd) sed
+	cd export then sed --verbose test 'quoted text' test --verbose
+	/usr/bin ${HOME} 2>/dev/null
+	x=1 test sed grep /usr/bin cd echo grep cd done --verbose
+		x=1 /usr/bin done --verbose && local "$@" cd && cd ${HOME} 2>/dev/null
+	cd echo echo --verbose export echo then test export printf then
+	${HOME} then echo && sed "$1"
+		then | grep echo /usr/bin
+	done cd -eu local sed $(pwd)
+| then | | sed then --verbose done $(pwd)
+	test /usr/bin printf /usr/bin --verbose readonly "$@"
+	&& "$@" --verbose ${HOME} -eu grep local readonly echo 'quoted text' readonly then
+		-eu grep x=1 readonly
+	2>/dev/null --verbose
+local 2>/dev/null $(pwd) --verbose 2>/dev/null local echo grep readonly local
+		readonly x=1 'quoted text' sed /usr/bin 2>/dev/null
+	cd $(pwd) "$@" test | -eu $(pwd) "$1"
+"$@" test local sed "$1" -eu
+	$(pwd) local x=1 2>/dev/null "$@" ${HOME} echo sed "$1" -eu export
+x=1 ${HOME} && cd then | echo
+		${HOME} cd test then && cd awk done ${HOME} cd cd | ${HOME} export 'quoted text'
+| "$1" awk cd done --verbose && readonly grep "$1" local x=1 x=1 "$@" export
+		"$1" done /usr/bin done 2>/dev/null 2>/dev/null && x=1 'quoted text' /usr/bin
+	cd $(pwd) then awk $(pwd) | awk 2>/dev/null cd
+	&& 'quoted text' grep sed /usr/bin sed local
+-eu && cd | grep /usr/bin && cd "$@" /usr/bin 'quoted text' /usr/bin printf local
+	"$1" ${HOME} x=1 cd "$@" test ${HOME} export
+done cd && | | x=1 2>/dev/null x=1 -eu awk 'quoted text'
+		$(pwd) cd x=1 x=1 local cd awk "$1" then ${HOME} 'quoted text' echo then
+		${HOME} "$1" test x=1 sed awk grep export "$@" /usr/bin local sed then then
+$(pwd) printf echo -eu x=1 $(pwd) export /usr/bin 2>/dev/null 2>/dev/null --verbose
+	printf "$@" x=1 done export
+"$1" x=1 "$@" | awk local then readonly && 2>/dev/null done $(pwd) sed --verbose
+		/usr/bin test done ${HOME} cd echo
+	${HOME} | ${HOME} "$1" export then echo $(pwd) $(pwd) x=1 awk awk readonly
+/usr/bin "$@" local "$1" grep export ${HOME} && grep done
+	readonly ${HOME} cd ${HOME} readonly 2>/dev/null local
+		"$1" /usr/bin /usr/bin done
+		then export grep local
+	test readonly | $(pwd) cd "$@" /usr/bin
+	echo grep cd readonly cd printf
+		${HOME} export && | local /usr/bin cd 'quoted text' --verbose readonly
+		2>/dev/null then grep | test && local
+		sed printf printf readonly --verbose
+cd cd echo "$1" x=1 sed printf ${HOME} 2>/dev/null "$1" readonly
+	2>/dev/null echo local printf readonly grep 'quoted text'
+		| | 'quoted text' $(pwd) then awk done | "$@" 2>/dev/null x=1 printf done test
+		-eu | "$1" "$1" $(pwd) echo ${HOME} 'quoted text' local done sed
+echo "$1" then 2>/dev/null $(pwd) echo export "$@"
+&& 'quoted text' echo export then readonly local readonly
+	/usr/bin awk printf -eu sed cd ${HOME} ${HOME} export "$1" -eu
+	done echo x=1 | 'quoted text'
+/usr/bin x=1 test | export printf test x=1 --verbose then cd
+local test done printf grep cd ${HOME}
+	done then readonly && cd echo echo
+	test -eu x=1 local export grep export export ${HOME} $(pwd) && ${HOME} 2>/dev/null
+	awk awk done done 2>/dev/null
+	grep grep cd $(pwd) ${HOME}
+	sed done echo sed "$1" ${HOME} "$@" awk local grep then | done readonly
+		x=1 sed export echo printf | local | cd export grep --verbose sed echo grep |
+		done x=1 ${HOME} ${HOME} "$@" echo 'quoted text' test echo
+sed $(pwd) test test 'quoted text' sed && sed cd export
+"$@" x=1 then && sed -eu printf &&
+x=1 test readonly awk export done test --verbose readonly -eu grep x=1 echo &&
+	local printf -eu export $(pwd) cd /usr/bin && then test sed x=1 test cd readonly
+	${HOME} sed && readonly | export
+	export --verbose sed export "$1" local test then --verbose
+	$(pwd) && "$@" echo ${HOME} --verbose --verbose echo local sed | x=1
+${HOME} --verbose | done 'quoted text' 'quoted text' $(pwd) readonly "$@"
+		done echo 2>/dev/null readonly readonly local /usr/bin
+	"$@" ${HOME} "$@" awk cd -eu x=1 sed then "$1"
+--verbose printf sed test ${HOME} then printf && printf $(pwd) local
+	export --verbose cd -eu export ${HOME}
+	${HOME} x=1 cd x=1 readonly /usr/bin 'quoted text' $(pwd)
+		echo -eu 2>/dev/null | cd done $(pwd) cd x=1 ${HOME} x=1 ${HOME} sed 2>/dev/null
+		x=1 /usr/bin 2>/dev/null /usr/bin -eu --verbose grep /usr/bin --verbose --verbose
+	--verbose printf echo "$1" --verbose cd printf -eu readonly --verbose $(pwd)
+echo 2>/dev/null /usr/bin done "$1" readonly $(pwd)
+		'quoted text' test && $(pwd) 2>/dev/null | local then then readonly
+		test x=1 grep "$1" export then --verbose test done --verbose then 2>/dev/null
+	echo "$1" "$1" | awk "$1" then then export sed $(pwd) echo
+		test printf 'quoted text' /usr/bin 2>/dev/null awk local
+		sed -eu 2>/dev/null done -eu local
+--verbose sed sed grep grep export $(pwd) then x=1 echo | x=1 awk $(pwd) 2>/dev/null
+	sed "$@" printf /usr/bin printf --verbose export 'quoted text'
+echo grep export then && x=1 'quoted text' -eu awk readonly echo "$@" /usr/bin
+	awk local grep printf 'quoted text'
+2>/dev/null && 'quoted text' "$@" local "$@" test test "$1" && "$@" $(pwd)
+cd 'quoted text' 'quoted text' $(pwd) $(pwd) readonly
+		'quoted text' grep x=1 && awk test echo then echo sed done cd -eu
+		echo $(pwd) ${HOME} && printf /usr/bin
+"$@" awk $(pwd) printf -eu $(pwd) /usr/bin
+		${HOME} echo grep "$1" done done export 2>/dev/null
+		test cd $(pwd) done awk -eu $(pwd) | ${HOME}
+test then then 2>/dev/null then test grep
+		$(pwd) $(pwd) printf ${HOME}
+		x=1 grep done "$@" then cd local test cd $(pwd) 'quoted text' /usr/bin
+		2>/dev/null test | export "$1" $(pwd) "$@" "$@" cd x=1 grep 'quoted text'
+done cd then --verbose ${HOME} grep 'quoted text' then awk | export &&
+		export --verbose --verbose
+		x=1 awk echo local cd then --verbose /usr/bin cd && -eu then x=1
+readonly --verbose done x=1 printf
+x=1 grep $(pwd) echo export --verbose done $(pwd) echo $(pwd) "$1" /usr/bin
+test grep sed ${HOME} awk then -eu grep printf
+	"$1" export -eu | /usr/bin readonly x=1
+		&& --verbose ${HOME} readonly
+done grep "$@" "$@" grep readonly | $(pwd) then --verbose ${HOME} local
+		local ${HOME} echo "$@" "$@" then 2>/dev/null
+/usr/bin export --verbose $(pwd) printf --verbose export cd grep
+readonly /usr/bin "$@" 'quoted text'
+	readonly && x=1 test sed echo x=1 2>/dev/null | ${HOME} local then cd
+x=1 printf -eu | export test sed test 2>/dev/null grep "$@"
+		test x=1 -eu then x=1 && readonly "$@" "$@" awk ${HOME}
+$(pwd) readonly echo cd | /usr/bin readonly 'quoted text'
+	grep sed x=1 then x=1 then awk sed $(pwd) test "$1" 2>/dev/null
+	'quoted text' /usr/bin $(pwd) | local x=1 test printf test done && -eu
+		grep /usr/bin printf | test ${HOME}
+		${HOME} $(pwd) echo readonly
+| test "$1" sed ${HOME} test "$@" done readonly export grep
+		"$1" --verbose export awk export && "$@"
+-eu $(pwd) x=1 "$@" -eu | --verbose ${HOME} "$1" echo
+then done 2>/dev/null "$@" local cd ${HOME} grep export
+		"$@" local "$1" x=1 "$@" && 'quoted text'
+echo && 'quoted text' local -eu 2>/dev/null
+export /usr/bin readonly ${HOME} && export
+	/usr/bin "$1" --verbose
+		$(pwd) ${HOME} "$@" --verbose
+	readonly local 2>/dev/null sed echo "$@" ${HOME} ${HOME} export awk sed
+echo | && x=1 then && cd -eu x=1 && export readonly "$@"
+	"$@" ${HOME} "$@" /usr/bin export "$1" readonly -eu
+		x=1 local echo "$1" 2>/dev/null $(pwd) 2>/dev/null | export readonly grep ${HOME}
+"$1" export then local /usr/bin
+	readonly ${HOME} "$@" "$@" $(pwd) && export -eu $(pwd) printf /usr/bin then
+/usr/bin x=1 readonly done export done echo echo | | readonly cd cd local sed
+		&& readonly awk --verbose -eu then done "$@" echo done --verbose 'quoted text'
+	readonly $(pwd) test then --verbose
+		local export -eu cd ${HOME} then then grep /usr/bin ${HOME} 2>/dev/null
+	-eu export | sed $(pwd) &&
+local awk then "$@" done then && "$1" awk test readonly
+	cd -eu 'quoted text' awk printf | -eu && test test echo
+		'quoted text' printf then done test echo "$1" awk
+echo test "$1" && 'quoted text' "$1"
+	--verbose "$@" "$@" test ${HOME}
+	export printf x=1 ${HOME} -eu done x=1 printf grep && grep "$1" sed export cd
+done readonly test 2>/dev/null local "$1" $(pwd) readonly x=1 readonly $(pwd)
+done test -eu printf then $(pwd) cd 2>/dev/null --verbose local
+	readonly printf x=1 && $(pwd) x=1
+		| done printf readonly awk
+/usr/bin sed --verbose
+--verbose /usr/bin 2>/dev/null /usr/bin export awk 2>/dev/null 'quoted text' test
+	"$1" "$@" $(pwd) grep 'quoted text' "$1" test awk then echo x=1 awk $(pwd) sed
+local 2>/dev/null sed test local 2>/dev/null
+		-eu && printf cd printf "$1" --verbose printf local && && awk local | 2>/dev/null
+		"$@" x=1 grep 'quoted text' sed done $(pwd) local ${HOME} && && echo
+		cd test sed x=1 then cd -eu 'quoted text' && && x=1 x=1 $(pwd)
+readonly | awk "$1" -eu readonly -eu printf sed printf
+		"$@" export test x=1 awk $(pwd) grep x=1 x=1 sed /usr/bin --verbose
+sed --verbose cd done && then sed "$1" cd export readonly
+		/usr/bin sed $(pwd) printf done then
+		done awk "$1" 'quoted text' x=1 /usr/bin echo x=1 then --verbose done then
+	then -eu echo "$@" done sed local
+		cd x=1 printf cd export --verbose sed -eu
+	cd readonly echo ${HOME} awk test x=1 $(pwd) then echo && /usr/bin done grep --verbose
+then local --verbose printf ${HOME} then done 'quoted text'
+		2>/dev/null echo "$@" ${HOME}
+		readonly echo $(pwd) test echo ${HOME} sed awk
+"$@" export local && --verbose "$1" x=1 export sed "$1" "$1" grep
+sed -eu | sed test done local awk "$1" ${HOME} | printf && --verbose $(pwd) &&
+	export && $(pwd) local export cd 'quoted text' awk
+		x=1 "$@" "$@" then "$@" echo grep readonly sed "$1" awk ${HOME} "$@"
+		-eu 2>/dev/null --verbose | then $(pwd)
+		x=1 sed cd printf awk "$1" "$@" test
+echo "$1" export /usr/bin 'quoted text' printf --verbose 'quoted text'
+		local 2>/dev/null --verbose awk then cd then local x=1 "$@"
+| 2>/dev/null /usr/bin |
+cd echo sed then awk then "$@" "$1" awk test | cd | awk -eu printf 'quoted text'
+		local local x=1 local grep printf export printf
+test /usr/bin && $(pwd) ${HOME} then 2>/dev/null grep 'quoted text' echo test $(pwd)
+	$(pwd) awk $(pwd) 'quoted text'
+$(pwd) readonly -eu awk done grep 'quoted text' "$@" echo
+		'quoted text' $(pwd) $(pwd) grep readonly $(pwd) echo readonly x=1 --verbose sed
+		done "$1" export && | -eu | -eu 'quoted text'
+	done "$1" cd local echo | awk $(pwd) echo echo grep
+export "$1" done done readonly then 2>/dev/null
+		grep x=1 'quoted text' awk ${HOME} | test readonly --verbose
+'quoted text' $(pwd) awk -eu 2>/dev/null done
+	"$1" /usr/bin "$1" grep 'quoted text' test "$1" local
+		local done export -eu | export
+	awk "$1" local then 'quoted text'
+	awk --verbose -eu local -eu readonly
+'quoted text' export printf ${HOME} x=1 then sed --verbose && /usr/bin
+| --verbose done x=1 cd 2>/dev/null test grep 'quoted text' test /usr/bin
+		$(pwd) done printf readonly then "$1" grep cd awk "$1" && sed | 'quoted text'
+	"$@" --verbose awk ${HOME} readonly
+		| local echo --verbose
+/usr/bin grep /usr/bin | ${HOME} done done test
+		then export x=1 export printf
+$(pwd) "$@" && x=1 $(pwd) 2>/dev/null -eu | | "$1" 'quoted text' grep awk printf
+--verbose -eu | awk "$@" then
+echo readonly readonly local --verbose echo 'quoted text' awk
+	'quoted text' grep sed readonly cd "$1" awk echo
+		grep sed /usr/bin 2>/dev/null -eu export done export -eu
+local echo cd 'quoted text' "$1" sed x=1 | "$1" --verbose done cd
+	"$1" $(pwd) test 2>/dev/null readonly 'quoted text' printf -eu $(pwd)
+awk -eu then 'quoted text'
+sed 'quoted text' sed grep test --verbose
+test x=1 done cd sed ${HOME} echo $(pwd)
+		cd done ${HOME} ${HOME} "$@" awk
+export printf then then /usr/bin /usr/bin sed
+grep ${HOME} && readonly "$@" awk readonly /usr/bin then ${HOME} --verbose
+		${HOME} "$@" 'quoted text' readonly 'quoted text' readonly ${HOME} 'quoted text'
+/usr/bin local done $(pwd)
+"$@" awk sed test done echo "$1"
+2>/dev/null x=1 x=1 | /usr/bin && 2>/dev/null "$@" && then x=1 export echo 'quoted text'
+	export && cd -eu -eu -eu --verbose test cd test echo then ${HOME}
+	x=1 readonly /usr/bin "$1" "$@" && test printf test x=1
+	-eu then "$@" | echo test export readonly "$1" --verbose grep
+	| printf done x=1 local /usr/bin local export 'quoted text'
+	done grep done 'quoted text' echo
+	sed done "$1" "$@" readonly
+		${HOME} 'quoted text'
+	printf "$@" 2>/dev/null -eu -eu done 2>/dev/null --verbose
+	grep echo -eu then "$@" | sed cd x=1 'quoted text'
+		$(pwd) grep cd --verbose done test 'quoted text' printf --verbose
+sed -eu x=1 test -eu local $(pwd) sed "$@" 2>/dev/null sed $(pwd)
+| sed -eu "$1" && 2>/dev/null "$1" &&
+		grep -eu grep "$1" export echo awk x=1 -eu echo grep x=1 "$1" done /usr/bin
+	${HOME} printf awk echo "$1" readonly &&
+	| echo x=1 export done cd done -eu 'quoted text' $(pwd) ${HOME} -eu export
+		then -eu grep ${HOME} "$1" local
+${HOME} 'quoted text' echo then test
+test x=1 done export sed export --verbose "$@"
+local local cd ${HOME} | export && cd awk cd printf done $(pwd) grep x=1 sed
+echo "$@" 'quoted text' cd 'quoted text'
+-eu -eu 'quoted text' then sed "$1" grep test ${HOME} printf
+	x=1 $(pwd) ${HOME} -eu
+--verbose /usr/bin "$1" awk $(pwd) "$@" cd test done echo
+	local 'quoted text' export
+	/usr/bin -eu printf /usr/bin export printf x=1 --verbose /usr/bin echo awk --verbose
+		/usr/bin readonly $(pwd) |
+	readonly local cd test then awk
+		test x=1 2>/dev/null x=1 grep 'quoted text' awk
+	--verbose readonly | x=1 cd printf "$@" printf | | awk && && cd cd
+		grep "$1" readonly $(pwd) readonly test && done | test readonly
+	| then && then 2>/dev/null
+	"$1" /usr/bin echo grep 2>/dev/null | awk awk awk "$1" -eu ${HOME} -eu local
+		readonly export cd export "$@" "$1"
+	echo export awk --verbose "$@" 2>/dev/null echo -eu local 'quoted text'
+	grep done grep | 2>/dev/null 'quoted text'
+printf awk /usr/bin $(pwd) | done
+	awk "$1" test done 2>/dev/null x=1 ${HOME}
+	| awk 'quoted text' echo grep ${HOME} --verbose $(pwd) awk 'quoted text'
+	/usr/bin x=1 done done grep test local ${HOME}
+	$(pwd) sed $(pwd) x=1 && awk sed ${HOME} echo
+x=1 x=1 export grep awk cd "$1" sed export cd ${HOME} grep readonly 2>/dev/null
+	local ${HOME} done echo "$@" /usr/bin grep $(pwd) readonly "$@" test test "$1"
+	echo | 2>/dev/null x=1 'quoted text' --verbose 'quoted text' readonly ${HOME}
+$(pwd) /usr/bin 2>/dev/null awk local ${HOME} 'quoted text' 2>/dev/null
+	--verbose grep x=1 &&
+	${HOME} local grep printf done /usr/bin | export echo $(pwd)
+	then then test then ${HOME} awk sed readonly readonly
+	test cd -eu ${HOME} "$1" 'quoted text'
+	echo sed echo done cd && echo -eu cd /usr/bin test && readonly awk export
+	export 'quoted text' export | echo export 'quoted text' printf test
+		'quoted text' awk | local ${HOME} x=1 -eu printf "$1"
+	&& printf cd cd --verbose readonly 2>/dev/null readonly echo awk 2>/dev/null
+--verbose test -eu awk "$1"
+	readonly test printf "$1" cd readonly && "$@" echo test grep
+sed readonly printf "$@" 2>/dev/null
+readonly test readonly cd grep printf
+	cd readonly 'quoted text' -eu | cd sed -eu sed x=1 2>/dev/null
+		"$1" $(pwd) export "$@" grep
+	-eu -eu done && $(pwd) 2>/dev/null -eu $(pwd) export test "$1"
+		readonly -eu x=1 readonly --verbose 2>/dev/null local
+-eu 2>/dev/null -eu awk --verbose
+		echo --verbose done ${HOME}
+$(pwd) cd then test -eu readonly grep grep x=1 done ${HOME}
+export printf --verbose /usr/bin
+cd "$@" 2>/dev/null -eu -eu readonly | grep echo
+	done test done ${HOME} export 'quoted text' sed awk ${HOME} done "$1"
+	| ${HOME} export test x=1 $(pwd) "$@" grep then export --verbose ${HOME} awk
+local 'quoted text' ${HOME} x=1
+		x=1 | awk "$@" sed /usr/bin
+/usr/bin x=1 test $(pwd) local cd 2>/dev/null cd test "$1" x=1 then echo done
+	awk readonly 'quoted text' done sed
+	awk $(pwd) sed ${HOME} done readonly $(pwd) 2>/dev/null awk printf 2>/dev/null
+		--verbose cd "$@" "$1" test && -eu then $(pwd) printf -eu | ${HOME}
+		cd x=1 --verbose echo && "$@" 'quoted text' awk awk | 'quoted text'
+		2>/dev/null /usr/bin then done done | --verbose
+&& echo 2>/dev/null -eu
+	/usr/bin then "$1" test awk grep -eu /usr/bin local 2>/dev/null
+		$(pwd) | grep test local echo $(pwd) 2>/dev/null $(pwd)
+	sed readonly export cd local -eu
+'quoted text' "$@" --verbose grep
+&& cd then "$1" ${HOME} &&
+		export /usr/bin | test
+		$(pwd) $(pwd) sed x=1 then readonly cd echo done
+${HOME} readonly --verbose -eu x=1 echo "$@"
+	sed local awk "$@" then 2>/dev/null | done "$@" && /usr/bin local cd
+then then --verbose x=1 x=1 cd $(pwd) cd $(pwd)
+export test 'quoted text' grep | sed && then "$1" "$@"
+		awk "$1" awk grep | ${HOME} 2>/dev/null awk readonly
+/usr/bin -eu x=1 "$@" readonly then
+export 'quoted text' $(pwd)
+grep done | readonly ${HOME} printf awk
+	| "$1" then && $(pwd) sed readonly $(pwd) 2>/dev/null cd local local test | local
+	sed cd sed sed "$1" awk sed test
+	grep $(pwd) readonly
+	local 2>/dev/null --verbose grep |
+		readonly 2>/dev/null "$1" sed cd /usr/bin -eu done readonly --verbose
+	${HOME} && "$@" export echo "$@" readonly test 'quoted text' ${HOME} && printf
+'quoted text' printf then grep /usr/bin "$@" "$@" done --verbose then readonly
+	echo x=1 | printf test printf
+	export --verbose test ${HOME} $(pwd) printf printf
+		2>/dev/null grep x=1
+"$1" export sed --verbose x=1 local export
+		--verbose sed done -eu export export "$@" export local ${HOME}
+	awk 2>/dev/null printf $(pwd) $(pwd)
+	"$@" sed cd printf "$1" $(pwd) cd | sed ${HOME} --verbose export
+-eu test 'quoted text' x=1 sed printf readonly "$@" awk printf
+		${HOME} "$1" then awk | --verbose echo printf
+		&& $(pwd) local ${HOME} cd
+		printf done export export readonly /usr/bin
+		done printf sed sed echo done test 'quoted text'
+"$1" awk local done test sed cd -eu && done $(pwd)
+${HOME} $(pwd) echo $(pwd) echo grep local cd x=1 readonly ${HOME} --verbose ${HOME}
+readonly then -eu && --verbose $(pwd) readonly "$@" ${HOME}
+awk ${HOME} local grep awk printf grep 'quoted text' 'quoted text' ${HOME}
+		sed "$@" sed readonly then 2>/dev/null /usr/bin cd echo awk
+	readonly done cd sed sed 2>/dev/null
+		| printf awk "$1" /usr/bin sed cd --verbose x=1 export done
+		| readonly readonly printf echo ${HOME} then x=1 cd ${HOME} then awk 'quoted text'
+		"$1" --verbose "$@" done grep readonly then --verbose
+	cd 2>/dev/null 2>/dev/null --verbose cd export export /usr/bin | then
+	-eu 2>/dev/null cd "$1" && test export
+		2>/dev/null "$1" local test | echo | export -eu echo local echo done cd 'quoted text'
+		${HOME} awk cd | -eu "$@" --verbose x=1 ${HOME} sed -eu done export "$1"
+		then 2>/dev/null $(pwd) 'quoted text' readonly local 'quoted text'
+		x=1 local done cd -eu readonly /usr/bin echo readonly printf
+	/usr/bin --verbose /usr/bin
+	echo ${HOME} echo 'quoted text' then then /usr/bin sed --verbose sed "$@" $(pwd)
+		2>/dev/null 2>/dev/null readonly
+		"$@" export 2>/dev/null "$1" readonly
+		done then x=1 --verbose local local "$@"
+grep readonly -eu $(pwd) echo done x=1 ${HOME} local grep local done ${HOME} local
+		'quoted text' sed done && | $(pwd)
+	printf "$1" export "$@" echo
+&& export ${HOME} "$@" then then
+local cd export done sed --verbose 2>/dev/null export cd -eu local
+	-eu 'quoted text' cd export test "$1" "$1" 'quoted text' export && 2>/dev/null
+	printf $(pwd) echo awk grep local readonly && 2>/dev/null --verbose
+x=1 --verbose readonly ${HOME} --verbose 2>/dev/null /usr/bin && ${HOME}
+	test && printf ${HOME} 2>/dev/null /usr/bin
+		'quoted text' export echo readonly echo local ${HOME} $(pwd)
+	-eu --verbose printf ${HOME} -eu readonly "$1" printf 2>/dev/null
+		then ${HOME} awk | done "$1" test /usr/bin
+x=1 local 2>/dev/null grep done awk export then readonly local /usr/bin
+awk $(pwd) ${HOME} -eu $(pwd) then echo | | sed /usr/bin sed /usr/bin "$1"
+		/usr/bin ${HOME} "$@" "$1" printf local
+grep -eu local $(pwd) $(pwd) && --verbose readonly --verbose cd then "$@" local
+2>/dev/null ${HOME} "$@"
+${HOME} local test sed done 'quoted text' --verbose
+local 'quoted text' 2>/dev/null
+	export /usr/bin awk --verbose && 'quoted text' awk
+	-eu -eu sed $(pwd) sed 2>/dev/null echo awk export echo "$1" | cd then
+	done export "$@" "$1" done echo
+		export printf export cd printf x=1 cd awk local "$@"
+	| "$@" local sed && "$@" export --verbose
+		readonly then | | grep export /usr/bin
+	done "$@" local local grep /usr/bin
+| sed printf awk --verbose -eu "$@"
+		x=1 && --verbose local --verbose && grep echo -eu printf &&
+		-eu x=1 done then $(pwd) 2>/dev/null export cd done
+readonly test ${HOME} readonly $(pwd) cd cd && x=1 echo /usr/bin
+then readonly $(pwd) 'quoted text' x=1 'quoted text' -eu -eu local 2>/dev/null
+	then grep x=1 local local readonly && -eu "$@" grep readonly &&
+	grep | local then ${HOME}
+then sed cd && --verbose cd /usr/bin grep ${HOME} 'quoted text'
+	printf sed 'quoted text' cd 2>/dev/null export awk
+		--verbose "$1" ${HOME} sed 2>/dev/null
+${HOME} export /usr/bin 2>/dev/null sed sed 'quoted text'
+	printf 2>/dev/null | sed /usr/bin export "$1" readonly done
+		sed && test 'quoted text' cd "$1" "$1"
+		then x=1 /usr/bin -eu sed
+${HOME} cd $(pwd) x=1 done /usr/bin cd ${HOME} local -eu local
+	"$@" --verbose then && "$@" -eu sed sed "$1" --verbose
+--verbose /usr/bin "$1" echo
+	test /usr/bin "$@" echo ${HOME} readonly x=1 then ${HOME} $(pwd) $(pwd) "$@" 2>/dev/null
+		local local 'quoted text' /usr/bin | x=1 readonly
+		test local "$1" then /usr/bin
+test | "$1" /usr/bin | x=1
+sed 2>/dev/null ${HOME} sed $(pwd) awk /usr/bin echo -eu awk
+		"$1" export -eu cd sed -eu x=1 test $(pwd) --verbose
+done /usr/bin test then
+		"$1" | /usr/bin grep x=1 sed cd echo "$@" then 2>/dev/null
+export | $(pwd) echo "$@" --verbose printf then /usr/bin /usr/bin 2>/dev/null
+local test $(pwd) sed ${HOME} $(pwd) $(pwd) $(pwd) sed | awk && grep
+		/usr/bin --verbose --verbose $(pwd) $(pwd) /usr/bin
+sed | ${HOME} grep --verbose
+	"$1" 2>/dev/null | echo x=1 'quoted text' -eu | export sed -eu
+cd 'quoted text' awk /usr/bin | --verbose grep then
+	grep -eu then | /usr/bin --verbose --verbose then 'quoted text'
+		sed printf | && 2>/dev/null 'quoted text' ${HOME} $(pwd) -eu echo export export
+'quoted text' -eu readonly grep ${HOME} echo awk "$1" awk $(pwd) | then x=1
+	done readonly "$1" && | 'quoted text' --verbose test export
+	x=1 x=1 "$1" 2>/dev/null "$@" -eu "$1" | test cd then grep echo $(pwd) ${HOME}
+	--verbose readonly x=1
+printf $(pwd) cd echo x=1 done local awk && --verbose readonly
+		cd $(pwd) echo "$@" x=1 --verbose
+	grep cd done local /usr/bin "$1" sed 2>/dev/null
+		/usr/bin echo local sed then cd export "$@" "$1" grep done
+		'quoted text' x=1 readonly awk -eu
+		printf $(pwd) awk done && && test echo readonly done grep printf
+	/usr/bin "$@" echo grep grep readonly 2>/dev/null $(pwd)
+	"$1" -eu grep x=1 $(pwd) sed printf --verbose -eu echo sed printf
+		echo printf cd -eu "$@" /usr/bin && local ${HOME} 2>/dev/null
+test grep --verbose printf "$1" "$@" && -eu "$@" 'quoted text'
+	awk done local cd cd cd 'quoted text'
+		grep local /usr/bin export 2>/dev/null
+	cd grep $(pwd) awk ${HOME} export done --verbose
+/usr/bin 'quoted text' x=1 $(pwd) local --verbose && ${HOME} | x=1 ${HOME} 'quoted text'
+		"$1" && x=1 cd sed --verbose readonly echo export test awk cd x=1 readonly ${HOME}
+then ${HOME} | sed x=1 cd 'quoted text'
+	x=1 cd "$1" then then $(pwd) printf $(pwd) 'quoted text'
+		2>/dev/null --verbose test
+local ${HOME} ${HOME} done grep readonly
+		test ${HOME} test x=1 ${HOME} readonly
+	printf -eu cd ${HOME} grep local x=1 awk local readonly local
+awk awk $(pwd) 2>/dev/null
+printf readonly cd x=1 awk /usr/bin then -eu done awk
+&& awk cd local printf test 'quoted text' local grep 2>/dev/null readonly sed local
+	-eu cd awk test sed -eu export test awk cd grep /usr/bin
+	printf sed && "$@" 'quoted text' | && "$@" --verbose --verbose |
+		cd grep done export awk awk readonly test $(pwd)
+&& export x=1 -eu && done
+		"$1" | cd && 2>/dev/null sed "$1" -eu ${HOME} /usr/bin 'quoted text'
+		cd 'quoted text' 2>/dev/null /usr/bin
+		export then grep printf | awk --verbose
+	test "$1" | sed | export | --verbose readonly readonly readonly
+/usr/bin "$1" cd --verbose
+		${HOME} awk readonly $(pwd) export sed | readonly sed -eu
+2>/dev/null done | $(pwd) cd sed "$1" 'quoted text' x=1 x=1 local
+	--verbose printf x=1 test 'quoted text' ${HOME} $(pwd) export grep awk | echo
+		readonly x=1 -eu 'quoted text'
+		| cd x=1 $(pwd) awk /usr/bin "$@"
+2>/dev/null 'quoted text' 2>/dev/null done ${HOME} /usr/bin awk then
+grep test $(pwd) export sed done
+	awk export && then | readonly --verbose readonly
+	/usr/bin x=1 sed awk local
+		| echo local printf "$1" local
+	${HOME} $(pwd) "$@" test --verbose test export /usr/bin done "$1"
+	sed sed /usr/bin local sed export --verbose $(pwd) --verbose ${HOME} "$1" |
+		grep then x=1 /usr/bin -eu "$@" sed grep && local sed 2>/dev/null | "$1"
+		local test export ${HOME} awk printf grep --verbose
+		"$@" x=1 export then then then $(pwd) 'quoted text'
+		2>/dev/null awk 'quoted text'
+		"$@" -eu "$1" awk "$@" | export readonly -eu test /usr/bin readonly --verbose "$@"
+		cd local 2>/dev/null 'quoted text'
+echo export cd echo grep && local ${HOME} readonly test $(pwd) local printf |
+	--verbose /usr/bin local
+then 'quoted text' | export | printf cd cd awk -eu ${HOME} done test local cd "$1"
+/usr/bin test "$1" done "$@" awk done test
+	grep then test "$@" echo --verbose "$@" echo && --verbose
+	cd 2>/dev/null ${HOME} cd ${HOME} printf cd /usr/bin cd then test $(pwd)
+	'quoted text' "$@" /usr/bin local
+	&& && test awk local done printf --verbose printf
+${HOME} test && "$@" local $(pwd) done local local
+/usr/bin "$@" printf ${HOME} | -eu --verbose awk grep cd ${HOME}
+	"$@" ${HOME} echo printf export
+		printf echo printf then | export cd echo cd ${HOME}
+		| then && export "$@" "$@" printf x=1
+printf "$1" sed && 'quoted text' grep | test printf local then "$1"
+		test -eu printf /usr/bin ${HOME} --verbose printf x=1 sed 'quoted text'
+"$@" sed $(pwd) --verbose
+	readonly ${HOME} export done export x=1 readonly then echo
+	then x=1 "$1" sed /usr/bin $(pwd)
+		test "$@" readonly sed "$1" echo local x=1 readonly
+done /usr/bin && cd awk readonly /usr/bin
+	${HOME} export ${HOME} ${HOME} sed awk export grep
+		"$1" -eu grep "$@" printf --verbose x=1 x=1 sed 2>/dev/null cd then local && "$@"
+		grep echo "$1" "$1" awk awk test
+	local ${HOME} /usr/bin ${HOME} grep local awk awk grep export "$1" ${HOME}
+echo local done then then printf 'quoted text' awk
+	grep $(pwd) | | test export -eu done x=1 && sed printf test then awk
+	| $(pwd) -eu 'quoted text' test test local && ${HOME} printf
+"$@" then sed readonly && -eu 'quoted text' printf echo /usr/bin local
+		"$1" grep ${HOME} $(pwd) readonly
+	readonly export ${HOME} then | --verbose sed export grep echo
+	grep x=1 awk ${HOME} export ${HOME} echo ${HOME}
+		'quoted text' printf sed done export readonly /usr/bin "$@" x=1 grep local local
+2>/dev/null "$@" local "$1" --verbose /usr/bin "$@"
+		printf $(pwd) cd echo /usr/bin | done $(pwd) test printf readonly
+		sed "$@" done echo x=1
+	&& x=1 'quoted text' "$1"
+&& cd /usr/bin /usr/bin sed -eu cd done /usr/bin -eu /usr/bin $(pwd) export sed
+then x=1 cd local $(pwd) | $(pwd) export
+$(pwd) sed -eu then cd done && | "$1" ${HOME}
+'quoted text' test readonly sed grep
+	--verbose x=1 | $(pwd) test test local 'quoted text' grep cd ${HOME} then
+$(pwd) | sed ${HOME} | export x=1 && $(pwd) test && printf then awk done --verbose
+		awk echo -eu "$@" "$1" $(pwd) && -eu $(pwd) && && test
+		| -eu then grep && /usr/bin
+printf --verbose printf then --verbose grep grep --verbose 2>/dev/null "$1" x=1
+printf && done ${HOME} /usr/bin
+		awk x=1 awk local && --verbose "$1" "$@" 'quoted text' --verbose $(pwd) printf
+printf /usr/bin export && printf "$@"
+&& grep then grep echo printf | done export $(pwd) x=1 test test
+		"$1" x=1 ${HOME} x=1 --verbose 2>/dev/null
+		$(pwd) cd "$@" echo export
+	cd done ${HOME} | local ${HOME}
+"$@" x=1 done local ${HOME} export printf /usr/bin printf | grep ${HOME} sed
+		printf sed readonly cd readonly "$@" cd local "$@" "$@" awk
+		then local grep sed local --verbose printf ${HOME}
+		cd 2>/dev/null grep export --verbose -eu /usr/bin "$1" awk ${HOME} $(pwd)
+		x=1 then awk ${HOME} -eu && test x=1 'quoted text' test then export
+		readonly cd x=1 && $(pwd) echo && echo "$@"
+then awk printf local grep echo && --verbose cd 2>/dev/null
+	$(pwd) x=1 --verbose "$@"
+		${HOME} | sed awk && printf "$1" printf $(pwd) ${HOME} sed local x=1 test
+	done "$@" -eu | /usr/bin -eu "$@" local -eu 2>/dev/null ${HOME} awk x=1 "$@" -eu
+		/usr/bin /usr/bin test $(pwd) "$1" printf 'quoted text'
+		then | readonly x=1 grep sed grep grep | x=1 "$@" local
+		grep done x=1 readonly local sed $(pwd) | 'quoted text'
+x=1 "$1" test awk readonly && "$1" "$@" done local "$1" grep printf
+		then /usr/bin test /usr/bin && echo
+	2>/dev/null done /usr/bin 'quoted text' | grep && awk test test cd
+		test ${HOME} readonly $(pwd) test sed ${HOME} cd /usr/bin
+echo awk "$@" local 2>/dev/null
+		$(pwd) awk | sed $(pwd) --verbose /usr/bin --verbose && $(pwd) awk awk /usr/bin
+		then "$1" echo "$@" local readonly test 'quoted text' sed local then
+		&& "$@" test done readonly x=1 ${HOME}
+	cd "$@" printf then "$1" sed printf echo export then ${HOME} 2>/dev/null $(pwd)
+	awk cd then export "$1" $(pwd)
+		x=1 x=1 grep sed $(pwd) printf test -eu then 'quoted text' 2>/dev/null
+		${HOME} "$@" local readonly "$1" export done test printf
+awk /usr/bin /usr/bin && x=1 local local
+readonly then -eu 'quoted text' "$1" sed
+cd $(pwd) | done ${HOME} /usr/bin local readonly cd &&
+--verbose $(pwd) cd local echo
+export /usr/bin printf test done test x=1 'quoted text'
+done | 2>/dev/null local x=1 sed ${HOME} awk export readonly
+		${HOME} local echo export sed ${HOME}
+	${HOME} readonly local "$1" --verbose -eu awk 'quoted text'
+-eu $(pwd) test 2>/dev/null
+		awk grep --verbose --verbose $(pwd) x=1 printf
+sed test "$1" x=1 -eu then --verbose then x=1 printf test test cd -eu
+	${HOME} sed && echo done x=1 /usr/bin
+	local awk x=1 cd x=1 /usr/bin | test
+		awk | echo 'quoted text' done
+		&& "$1" "$@" local "$@" cd 2>/dev/null ${HOME} 'quoted text'
+	"$@" test ${HOME} $(pwd) local $(pwd) done test -eu readonly test local 'quoted text'
+		awk && cd x=1 readonly ${HOME} test export printf test 2>/dev/null
+	"$@" sed echo grep done printf awk export grep
+x=1 local "$@" 'quoted text' awk ${HOME} export sed
+		/usr/bin then sed -eu readonly 2>/dev/null $(pwd) --verbose | printf
+cd --verbose awk done awk "$1" echo x=1 export "$@" ${HOME} "$1" then cd grep local
+	grep cd printf sed awk local printf done /usr/bin local
+		"$@" awk ${HOME} readonly then --verbose | && sed
+	done sed ${HOME} 2>/dev/null ${HOME} grep test
+echo $(pwd) grep ${HOME} grep readonly sed test sed grep --verbose ${HOME}
+	test printf 'quoted text' x=1 test ${HOME}
+	awk sed export grep "$@" ${HOME} "$1" x=1 x=1 printf
+		cd echo ${HOME} readonly && sed readonly
+	'quoted text' printf | readonly sed "$@" sed | && | cd
+	readonly 2>/dev/null export then x=1 -eu -eu awk readonly 2>/dev/null
+	grep --verbose $(pwd) $(pwd) grep | export $(pwd) cd
+	&& export $(pwd) | | done ${HOME} "$@" --verbose
+		echo $(pwd) $(pwd) /usr/bin && printf printf ${HOME} $(pwd) "$@" readonly
+	${HOME} "$@" ${HOME} | -eu
+		local local readonly sed | 'quoted text' readonly 2>/dev/null
+	x=1 cd && awk done export "$@" ${HOME} /usr/bin && echo ${HOME} cd "$1"
+sed 'quoted text' printf ${HOME} sed -eu && sed -eu readonly
+	--verbose export done -eu cd --verbose local && --verbose
+grep $(pwd) | printf -eu export -eu test sed 'quoted text'
+local local test ${HOME} test readonly $(pwd)
+-eu test ${HOME} "$1" /usr/bin
+		echo done /usr/bin -eu echo sed
+		grep done $(pwd) grep 'quoted text' done printf cd "$@" ${HOME}
+		test /usr/bin ${HOME} $(pwd) | | "$1" test echo export 'quoted text'
+"$@" done x=1 awk cd cd "$@" ${HOME} export 2>/dev/null readonly
+	grep export grep readonly | local awk printf echo printf echo x=1 cd
+		'quoted text' $(pwd) printf $(pwd) --verbose 2>/dev/null 'quoted text' 'quoted text'
+| test /usr/bin grep x=1 echo "$1" cd 'quoted text' x=1 $(pwd)
+printf readonly readonly echo "$1" then sed export done
+then test ${HOME} /usr/bin readonly
+		export ${HOME} --verbose x=1 x=1 sed awk done 'quoted text' printf readonly
+		x=1 "$1" $(pwd) x=1 --verbose | "$1" x=1 export ${HOME}
+	export export echo grep cd readonly test && 'quoted text' awk
+| && local then local test sed grep done x=1 $(pwd)
+		"$1" export -eu --verbose ${HOME}
+	printf export 'quoted text' cd | echo ${HOME} $(pwd) x=1
+	"$@" /usr/bin 'quoted text' local then printf cd test --verbose
+--verbose test cd -eu 'quoted text' 'quoted text' 'quoted text'
+		local 'quoted text' --verbose "$1" done "$@" echo "$1" 'quoted text' $(pwd)
+readonly ${HOME} 2>/dev/null export cd export
+done -eu sed ${HOME}
+	export cd test -eu -eu 2>/dev/null "$1" --verbose "$@" printf --verbose --verbose
+local "$@" ${HOME} /usr/bin | && ${HOME} cd awk echo -eu grep local export /usr/bin
+test --verbose "$1" 2>/dev/null printf cd then /usr/bin then
+		then sed sed local then | 'quoted text'
+	grep 2>/dev/null export cd export test
+		done -eu --verbose test readonly grep ${HOME} ${HOME} cd 'quoted text' grep
+	--verbose then sed "$@" --verbose
+"$1" test "$@" then export awk then printf 2>/dev/null
+	readonly && printf export --verbose local && /usr/bin grep "$@" cd 2>/dev/null
+	"$1" printf "$1" cd cd echo grep sed done && local "$@" done readonly printf
+	export local local -eu local 'quoted text'
+printf | echo | cd $(pwd) then
+	test && export ${HOME} ${HOME} sed test ${HOME} done export
+		sed test grep && /usr/bin x=1 2>/dev/null
+x=1 /usr/bin done readonly echo then local | echo
+		&& -eu /usr/bin ${HOME} /usr/bin 2>/dev/null printf sed "$1" x=1
+	echo test export "$1" 2>/dev/null x=1
+	grep echo sed readonly cd /usr/bin
+test test $(pwd) 2>/dev/null
+		export test x=1 -eu ${HOME} && "$1" 2>/dev/null readonly
+		export "$1" -eu | x=1 printf $(pwd)
+&& $(pwd) /usr/bin 2>/dev/null export 'quoted text' x=1 sed awk cd export sed "$@"
+		cd 2>/dev/null grep && then 2>/dev/null
+		-eu awk ${HOME} readonly --verbose 'quoted text' /usr/bin 2>/dev/null
+		echo test cd | export "$@" cd readonly
+then readonly /usr/bin 'quoted text' export export "$1" printf
+| cd test x=1 /usr/bin sed
+	"$@" "$1" /usr/bin cd ${HOME} echo test echo printf readonly readonly local &&
+test $(pwd) cd done sed cd cd --verbose
+		&& "$@" local "$@" test "$@" --verbose
+printf readonly --verbose -eu cd test --verbose done export cd test ${HOME}
+		echo readonly readonly echo 'quoted text' echo grep && sed test sed ${HOME} readonly
+	$(pwd) | 'quoted text' printf done printf "$@" export
+$(pwd) done local echo /usr/bin $(pwd) "$1"
+	echo | -eu cd -eu --verbose then cd "$@" then
+printf sed printf then "$@" grep 'quoted text' echo test done 2>/dev/null
+grep x=1 done | --verbose local | "$@" 'quoted text' "$1" ${HOME}
+	&& -eu "$@" ${HOME} ${HOME}
+test done -eu readonly echo
+	x=1 $(pwd) cd awk $(pwd) awk -eu && then --verbose ${HOME} &&
+then 'quoted text' "$1" 2>/dev/null $(pwd)
+2>/dev/null cd grep && -eu x=1 readonly "$1" $(pwd) readonly printf local
+	cd printf sed --verbose printf
+then printf cd -eu --verbose | awk then grep 'quoted text' --verbose $(pwd)
+	then awk cd grep /usr/bin --verbose local ${HOME} /usr/bin cd grep ${HOME} "$@"
+		done && && ${HOME} | ${HOME} sed
+	done export test $(pwd) awk local --verbose sed $(pwd) grep local $(pwd)
+awk done "$1" /usr/bin awk |
+	x=1 2>/dev/null sed $(pwd) /usr/bin
+${HOME} then echo awk --verbose --verbose
+	${HOME} 2>/dev/null cd /usr/bin $(pwd) x=1 -eu sed "$@" x=1 export "$@"
+echo awk then then | sed --verbose x=1 readonly "$1" printf cd echo done /usr/bin
+		-eu 2>/dev/null ${HOME} local && /usr/bin then
+		${HOME} printf sed "$@" -eu "$@"
+		local -eu -eu /usr/bin test | local 'quoted text' x=1 local
+		--verbose local | --verbose sed x=1 "$@" cd "$1" --verbose
+		x=1 done && x=1 | /usr/bin 'quoted text'
+	grep cd "$1" sed "$@" local 'quoted text'
+		printf /usr/bin --verbose ${HOME} "$@" | readonly /usr/bin
+	'quoted text' grep awk --verbose
+export "$@" && sed cd -eu 2>/dev/null 'quoted text' | /usr/bin
+		done then grep cd awk ${HOME} && sed awk "$@" --verbose
+	"$1" | 'quoted text' awk export printf test ${HOME} -eu grep
+2>/dev/null 'quoted text' export "$@" test export -eu 'quoted text'
+2>/dev/null "$@" readonly "$@" grep $(pwd) | 'quoted text'
+	-eu export /usr/bin awk
+		'quoted text' x=1 -eu readonly $(pwd)
+		local grep readonly 2>/dev/null /usr/bin printf export sed
+/usr/bin /usr/bin 'quoted text' awk grep "$1" awk ${HOME}
+		x=1 | done awk sed "$1" x=1 export
+	| readonly local export printf done -eu awk printf test 'quoted text' test 'quoted text'
+'quoted text' /usr/bin printf x=1 sed ${HOME} cd readonly $(pwd) "$@" cd
+		/usr/bin then /usr/bin 'quoted text'
+cd | readonly sed grep awk 'quoted text'
+	grep cd "$1" echo && done done && then printf
+		awk echo export printf cd printf local cd "$1" "$1"
+		sed then then /usr/bin printf && sed grep /usr/bin | | "$@"
+| x=1 && /usr/bin then ${HOME} test
+		cd "$1" /usr/bin cd cd ${HOME}
+		$(pwd) | /usr/bin readonly
+	"$1" -eu done ${HOME} echo test awk printf "$1"
+x=1 2>/dev/null "$@" "$@" | echo echo -eu
+		'quoted text' -eu done 2>/dev/null then | ${HOME} echo 2>/dev/null
+		"$@" export | -eu cd then printf echo
+sed readonly done cd -eu grep "$@" readonly cd echo ${HOME}
+		2>/dev/null -eu -eu readonly export local
+		--verbose awk awk -eu && echo done echo | | test echo "$@" "$1" sed | grep readonly
+2>/dev/null test export ${HOME} "$@" printf --verbose cd done ${HOME}
+	readonly && test done $(pwd) export ${HOME} echo
+		$(pwd) export then | local 2>/dev/null
+	test grep cd echo done done then done awk
+	sed readonly readonly /usr/bin export | local 2>/dev/null /usr/bin sed | then --verbose
+readonly ${HOME} -eu grep readonly export sed && echo --verbose
+2>/dev/null "$@" 2>/dev/null
+test done | --verbose ${HOME} printf test
+		"$1" "$@" && done printf printf "$1" test 2>/dev/null cd 'quoted text'
+		&& -eu local export 'quoted text'
+		readonly "$@" export printf grep | awk
+		x=1 /usr/bin "$1" --verbose
+	2>/dev/null readonly "$@" | local
+	"$1" x=1 && awk "$1" --verbose
+sed then awk /usr/bin local $(pwd) /usr/bin awk ${HOME} "$@" | "$1" cd echo
+		| grep | ${HOME} cd 'quoted text' printf 'quoted text' done
+		printf readonly echo "$@" 'quoted text' echo | 'quoted text' "$@"
+	awk 2>/dev/null export ${HOME} echo then x=1 | /usr/bin grep printf -eu && --verbose
+readonly 2>/dev/null local -eu && $(pwd) sed awk --verbose $(pwd)
+		then printf --verbose echo
+		done 'quoted text' 2>/dev/null "$1" done
+&& x=1 sed ${HOME} awk grep ${HOME} --verbose
+		readonly x=1 ${HOME} /usr/bin test done then test
+		/usr/bin cd 2>/dev/null
+		awk --verbose test awk "$@" readonly x=1 ${HOME} cd /usr/bin grep
+		local sed ${HOME} test sed -eu echo grep done readonly /usr/bin grep ${HOME}
+echo $(pwd) awk grep sed readonly then readonly test x=1 "$1" /usr/bin
+	--verbose printf $(pwd) grep
+	cd test | 'quoted text' "$@" "$@" awk local awk readonly cd /usr/bin export
+	$(pwd) done local test | $(pwd) printf
+$(pwd) && "$1" ${HOME} local test 2>/dev/null
+		test "$1" export 'quoted text' "$1" cd $(pwd)
+&& 2>/dev/null then test done 'quoted text' --verbose | cd printf
+		awk | --verbose "$@" 2>/dev/null done awk readonly cd 'quoted text'
+test test grep | export cd $(pwd) cd ${HOME} x=1 readonly 2>/dev/null cd readonly
+-eu then test printf cd ${HOME} echo awk "$@"
+local && -eu $(pwd) printf sed 'quoted text' export printf "$1" local | cd
+		cd local local --verbose
+test cd "$1" then x=1 "$1" export printf cd printf
+	local readonly "$@" echo printf "$@" export
+		x=1 local then done x=1 'quoted text'
+readonly -eu | 'quoted text' done sed --verbose done test awk && done ${HOME} /usr/bin
+		cd sed "$@" 'quoted text'
+	done | 'quoted text' 2>/dev/null x=1
+	&& 2>/dev/null done readonly -eu | cd grep cd x=1 2>/dev/null
+	grep then echo awk local printf --verbose test | |
+	grep x=1 cd 2>/dev/null grep sed 'quoted text' --verbose awk
+		"$@" "$1" "$1" | readonly "$@" && -eu then local -eu /usr/bin x=1 then ${HOME}
+echo export grep $(pwd) && "$@" printf | /usr/bin readonly && grep
+	2>/dev/null ${HOME} readonly 'quoted text'
+	awk ${HOME} export ${HOME} readonly 'quoted text' readonly
+		"$@" then done -eu done grep awk sed export local then readonly 'quoted text'
+		export 'quoted text' echo /usr/bin && 'quoted text' printf 2>/dev/null "$1"
+		/usr/bin x=1 'quoted text' cd local export readonly x=1 printf
+then local printf 2>/dev/null grep 'quoted text' "$1"
+	&& ${HOME} $(pwd) echo "$@"
+grep x=1 awk 2>/dev/null then x=1 | local cd "$1" echo "$1" /usr/bin sed
+	-eu x=1 2>/dev/null -eu done
+$(pwd) readonly x=1 cd 'quoted text' /usr/bin test export | 'quoted text'
+	"$@" && echo grep test printf export /usr/bin
+	grep awk test done ${HOME}
+		test awk export "$1" | "$1" 'quoted text' done export
+		/usr/bin local awk && grep --verbose ${HOME} "$1" x=1 "$1"
+		export -eu 'quoted text' sed test local sed "$1" cd done then then
+	-eu $(pwd) local echo && grep done test $(pwd) grep && printf
+grep then | test 'quoted text' 2>/dev/null cd 'quoted text'
+		test printf /usr/bin local /usr/bin done "$@"
+		export $(pwd) local ${HOME} $(pwd) /usr/bin sed "$1" echo x=1 sed "$1"
+-eu test readonly printf $(pwd) local echo echo /usr/bin local ${HOME}
+/usr/bin readonly && -eu local /usr/bin && /usr/bin printf
+	"$@" local -eu awk then $(pwd) 'quoted text' test cd
+	printf "$@" printf && 'quoted text'
+${HOME} x=1 test test x=1 test "$1" done --verbose
+	--verbose x=1 readonly echo "$@" readonly awk cd export test
+		-eu | echo printf "$1" sed /usr/bin 2>/dev/null then cd then
+		2>/dev/null test x=1 sed awk printf ${HOME} local readonly ${HOME}
+sed -eu awk /usr/bin then
+		grep "$@" test "$1" && export
+${HOME} cd done cd /usr/bin "$1" export "$@" ${HOME}
+test | --verbose local
+	| printf --verbose test --verbose && /usr/bin
+		| 'quoted text' grep echo
+"$1" 2>/dev/null 'quoted text' cd -eu --verbose local awk --verbose export
+	--verbose export sed
+done test x=1 printf
+/usr/bin awk readonly -eu export printf
+printf done ${HOME} 'quoted text' x=1
+		done 'quoted text' /usr/bin grep printf test /usr/bin | local done
+		$(pwd) ${HOME} echo | then sed "$1" echo ${HOME}
+$(pwd) "$1" -eu export
+		x=1 | x=1 readonly readonly done readonly grep "$1" | then then cd done /usr/bin
+	test export printf grep "$@" "$1" sed $(pwd)
+local 'quoted text' test "$1" "$1" ${HOME} /usr/bin cd grep |
+		test grep cd then -eu "$@" x=1 awk ${HOME} /usr/bin echo grep cd then 2>/dev/null
+	test awk then export cd grep "$@" $(pwd) then
+		"$1" && "$@" test -eu && local grep export grep
+	$(pwd) && readonly && --verbose export printf
+	/usr/bin $(pwd) --verbose cd
+	sed -eu "$1" 2>/dev/null local 2>/dev/null export x=1
+		/usr/bin "$1" $(pwd) printf /usr/bin
+	2>/dev/null 2>/dev/null echo --verbose sed ${HOME}
+'quoted text' ${HOME} then 'quoted text' test
+echo "$@" readonly printf echo readonly sed readonly "$@" echo
+	cd printf 'quoted text' 'quoted text' echo echo --verbose awk sed test
+2>/dev/null awk sed grep echo readonly 2>/dev/null -eu $(pwd)
+	test x=1 x=1 /usr/bin x=1 2>/dev/null
+	echo cd "$@" /usr/bin --verbose $(pwd) /usr/bin /usr/bin grep /usr/bin grep
+		done grep "$1" | awk "$1" local -eu printf
+	"$@" /usr/bin readonly
+		--verbose 2>/dev/null ${HOME} 'quoted text'
+		"$@" --verbose readonly readonly awk local
+${HOME} printf x=1 export 'quoted text' | --verbose
+		grep "$@" export awk readonly awk test cd printf ${HOME} readonly --verbose
+/usr/bin /usr/bin done awk then done
+	$(pwd) then "$1" x=1 2>/dev/null 2>/dev/null cd printf ${HOME} ${HOME}
+		then -eu sed && export printf
+	test "$1" && export readonly done ${HOME} 'quoted text'
+'quoted text' local done
+		$(pwd) -eu test test "$1" done printf
+	2>/dev/null grep -eu x=1 cd readonly local test then 2>/dev/null
+	&& "$1" 2>/dev/null /usr/bin "$@" echo cd echo "$@" | grep "$1"
+	${HOME} "$@" then done export | x=1 done "$1" x=1 local
+	printf cd echo 'quoted text' --verbose && ${HOME} grep
+		then readonly done "$@" "$@" then readonly x=1 export "$1" 'quoted text'
+2>/dev/null --verbose | done 2>/dev/null
+		printf awk local 'quoted text'
+	2>/dev/null awk cd $(pwd) "$1" $(pwd)
+	'quoted text' "$1" --verbose
+	"$@" 'quoted text' local x=1 "$1" readonly echo "$1" -eu echo local awk printf
+	done sed printf readonly export awk $(pwd) awk done then $(pwd) "$@" -eu test
+| export readonly && readonly grep -eu && sed then local --verbose
+		'quoted text' then test echo cd awk cd "$@" echo printf printf 2>/dev/null
+		grep 'quoted text' test echo local export && sed export readonly x=1 test
+		--verbose cd 'quoted text' $(pwd) && printf awk sed | grep
+		x=1 sed /usr/bin "$1" cd | "$@" x=1 readonly && readonly && 2>/dev/null
+--verbose awk -eu test -eu then done /usr/bin
+	done | --verbose done local "$@" "$@" x=1 done readonly x=1 awk x=1 -eu &&
+	${HOME} "$@" "$1" 2>/dev/null -eu local && sed /usr/bin grep 'quoted text'
+done 'quoted text' --verbose grep readonly ${HOME} awk done awk sed 2>/dev/null
+&& printf export grep && echo && readonly printf awk /usr/bin then
+then "$1" printf local $(pwd) x=1 2>/dev/null
+		grep 'quoted text' | --verbose x=1 cd done echo test done printf x=1 echo
+	| ${HOME} export local test ${HOME} local done awk done | ${HOME}
+		x=1 2>/dev/null && export
+-eu sed sed "$1" /usr/bin awk /usr/bin then printf
+		2>/dev/null cd grep done then x=1 echo "$@" local awk -eu && ${HOME} export echo
+		done "$1" --verbose grep -eu
+	/usr/bin "$@" test sed echo 'quoted text' "$1" 'quoted text' printf ${HOME} done
+echo 'quoted text' "$@" && export readonly done echo test --verbose
+"$1" sed 'quoted text' | "$1" cd readonly readonly x=1 sed $(pwd) "$@" -eu
+${HOME} local && done awk then cd export printf "$@" then --verbose
+	&& test done 2>/dev/null
+echo 'quoted text' ${HOME} echo test x=1 readonly 'quoted text' --verbose 'quoted text'
+printf grep ${HOME} | -eu done echo readonly "$1" && done
+		x=1 cd awk export printf awk cd
+		grep readonly test "$@" test awk test -eu --verbose /usr/bin readonly --verbose
+	'quoted text' readonly --verbose
+cd test then | printf -eu grep $(pwd) 'quoted text'
+| && readonly /usr/bin /usr/bin |
+local /usr/bin readonly | /usr/bin "$@" then awk ${HOME}
+		x=1 awk "$@" export "$@" done awk $(pwd) 'quoted text' -eu echo 'quoted text'
+	done ${HOME} grep --verbose 'quoted text' printf 2>/dev/null "$@" $(pwd) |
+	$(pwd) test local cd && cd "$1" local awk export x=1 $(pwd) readonly cd test -eu
+/usr/bin ${HOME} sed "$1" | local readonly sed readonly cd echo
+echo grep sed done | local readonly
+printf "$1" && "$1" local
+		echo /usr/bin "$1" done
+readonly export test ${HOME} sed
+	$(pwd) cd -eu cd "$@" export "$@" && local readonly export readonly 2>/dev/null
+	2>/dev/null sed && then export test | -eu echo awk export done -eu awk
+&& export "$@" | ${HOME} /usr/bin "$@" cd -eu then export export
+sed | -eu printf echo test grep awk --verbose "$@" -eu $(pwd)
+		'quoted text' "$1" x=1 | 'quoted text'
+		'quoted text' | local test -eu echo then x=1 echo done awk export
+echo readonly --verbose 'quoted text'
+		--verbose awk grep done && test awk export 2>/dev/null 2>/dev/null
+| sed ${HOME} 2>/dev/null export cd awk grep && echo && readonly x=1 ${HOME}
+	awk echo printf "$1" echo | 2>/dev/null awk "$@" ${HOME} sed grep "$1" $(pwd)
+		${HOME} sed sed done test
+export && | x=1 /usr/bin | && 'quoted text' "$@" -eu ${HOME} echo
+		then grep -eu $(pwd) local
+	printf && export "$@" printf
+--verbose awk $(pwd) x=1 cd --verbose
+		local grep "$1" "$@" awk awk test $(pwd) && "$1" "$@" | -eu
+"$1" 2>/dev/null "$1" test | export
+	'quoted text' ${HOME} --verbose -eu "$@" printf "$1"
+printf x=1 "$1" echo test
+		done readonly "$1" done sed export /usr/bin echo /usr/bin printf
+	2>/dev/null | "$@" readonly 2>/dev/null
+	readonly && -eu x=1 sed 2>/dev/null test 'quoted text' ${HOME} "$1" awk
+then local ${HOME} && local && local done "$@" && --verbose "$1"
+		printf awk test local grep
+	x=1 awk awk sed "$@" export && export 2>/dev/null awk echo
+	echo /usr/bin awk echo sed grep local printf echo export ${HOME} 2>/dev/null
+		cd 2>/dev/null test "$1" export /usr/bin -eu awk
+		$(pwd) test | ${HOME} -eu echo local echo -eu sed
+-eu readonly x=1 awk | /usr/bin
+test awk echo awk x=1 ${HOME} x=1 printf local grep grep "$@" local
+		| done $(pwd) x=1 x=1 done printf local printf 'quoted text' then x=1 2>/dev/null
+'quoted text' "$@" printf export cd /usr/bin --verbose then $(pwd) 'quoted text'
+	--verbose cd sed grep "$@" echo /usr/bin x=1 | x=1 test then
+	grep 2>/dev/null && -eu printf
+2>/dev/null --verbose echo then local then
+grep /usr/bin export awk printf echo local grep sed then then /usr/bin
+	--verbose readonly "$@" "$1" cd echo x=1 export readonly
+		"$1" | grep | $(pwd) test local --verbose 'quoted text' $(pwd) 2>/dev/null x=1
+		printf readonly "$1" -eu grep
+		readonly export | local awk test
+readonly "$@" --verbose "$1" local "$@" "$1"
+		"$1" sed $(pwd) grep "$@" cd /usr/bin $(pwd) cd grep && sed ${HOME} awk
+		&& grep 'quoted text' test "$@" --verbose
+	export local | | && --verbose echo printf local local done | --verbose
+		awk grep export done printf
+		grep "$1" -eu cd -eu 'quoted text' && $(pwd) then --verbose
+-eu cd && -eu done -eu -eu && $(pwd) echo -eu export
+$(pwd) export | "$@" grep readonly ${HOME}
+	"$1" && /usr/bin grep test
+	done --verbose cd printf "$@" 2>/dev/null /usr/bin sed 'quoted text'
+	/usr/bin grep --verbose awk export done | test cd export
+		${HOME} "$@" ${HOME} awk && --verbose sed "$1" local local 2>/dev/null cd x=1
+	grep /usr/bin 'quoted text'
+		"$1" $(pwd) $(pwd) $(pwd) printf cd then then 'quoted text'
+	2>/dev/null echo echo /usr/bin cd -eu echo | sed
+	awk /usr/bin 'quoted text' "$1" export
+sed then x=1 | awk cd done
+export "$1" then | 'quoted text' | readonly
+		then test printf done --verbose sed $(pwd) "$@"
+	"$1" test done test $(pwd) /usr/bin -eu "$@" -eu sed then test | | "$@" printf
+	"$1" 2>/dev/null "$1" --verbose "$1" printf -eu
+&& cd x=1 2>/dev/null $(pwd) 'quoted text' awk ${HOME} local
+grep "$1" test "$1" --verbose grep export -eu && x=1 "$@" "$@" "$@" sed printf
+awk 'quoted text' test cd "$1" -eu sed x=1 x=1
+'quoted text' /usr/bin --verbose 2>/dev/null
+	awk "$@" readonly 2>/dev/null 2>/dev/null then --verbose awk cd local local 'quoted text'
+"$1" | $(pwd) done --verbose local | awk readonly "$@" x=1 &&
+		/usr/bin && $(pwd) test cd local test local cd then 'quoted text' "$1" local then
+then cd echo sed readonly x=1 grep
+#include c11.sh
+awk sed readonly | grep awk && then cd | $(pwd) readonly awk grep && ${HOME} --verbose
+	x=1 | "$1" printf $(pwd) local x=1 printf
+	export cd readonly done done ${HOME} grep sed $(pwd) 'quoted text'
+'quoted text' 'quoted text' | ${HOME} x=1 --verbose $(pwd) $(pwd)
+		${HOME} ${HOME} awk "$1" local
+then "$@" sed cd /usr/bin echo readonly
+		awk -eu --verbose printf -eu done printf readonly
+		$(pwd) 2>/dev/null local -eu $(pwd) echo 'quoted text' sed -eu -eu
+printf -eu --verbose ${HOME}
+	cd 'quoted text' then test readonly && cd readonly $(pwd) /usr/bin "$@" grep
+		cd printf test x=1 grep $(pwd) then "$1" then
+		grep echo export --verbose awk /usr/bin
+		-eu x=1 | grep "$@" cd cd cd local && test then cd "$1" 2>/dev/null ${HOME}
+echo then $(pwd) awk readonly local test -eu 'quoted text'
+		--verbose test --verbose done done "$@" "$@" 2>/dev/null awk
+		$(pwd) 2>/dev/null then export "$1" readonly -eu --verbose
+		echo --verbose | ${HOME} x=1 done grep 'quoted text' | grep &&
+		grep -eu "$1" printf awk ${HOME} "$1" done --verbose grep echo "$@" sed ${HOME}
+		'quoted text' local printf $(pwd) printf $(pwd) x=1 printf /usr/bin
+	cd grep export 2>/dev/null grep echo then x=1 | local sed done x=1 | "$@"
+$(pwd) grep printf local then 'quoted text'
+'quoted text' /usr/bin local --verbose
+grep printf && $(pwd) sed cd
+		&& readonly local then -eu sed 2>/dev/null printf 'quoted text'
+		echo -eu && cd done 'quoted text' done readonly ${HOME} sed -eu grep local
+readonly awk && && 2>/dev/null x=1 | 'quoted text' -eu $(pwd)
+	--verbose sed /usr/bin printf cd
+		2>/dev/null awk && 'quoted text' --verbose /usr/bin readonly | sed done
+		x=1 'quoted text' test | readonly x=1 2>/dev/null
+	| 2>/dev/null $(pwd) readonly sed sed
+		printf sed export $(pwd) then readonly
+		| readonly -eu done 'quoted text' && && test | test cd test
+--verbose ${HOME} "$1" then readonly -eu export then sed && $(pwd) export
+| printf 2>/dev/null readonly | done "$1" | 2>/dev/null
+		test | echo grep local -eu sed
+"$1" printf "$1" export ${HOME} && sed "$@"
+local x=1 | /usr/bin cd export x=1 cd awk /usr/bin /usr/bin local
+'quoted text' x=1 "$@" sed --verbose
+2>/dev/null /usr/bin | echo done 2>/dev/null printf
+		&& done | test && "$1" /usr/bin ${HOME} | awk export printf sed -eu /usr/bin done
+export "$1" $(pwd) x=1 printf --verbose then "$1" printf local
+	--verbose 'quoted text' readonly
+local sed local test x=1 "$1" x=1 ${HOME} local done $(pwd) $(pwd) | printf
+	&& --verbose grep then test cd printf local --verbose
+		--verbose -eu -eu echo x=1 &&
+		/usr/bin && done 2>/dev/null /usr/bin
+$(pwd) printf 2>/dev/null | ${HOME} "$@" "$1" -eu grep 'quoted text' x=1 x=1
+cd sed sed echo "$1" "$1" echo local then printf
+	sed && printf readonly "$@" 'quoted text' -eu sed ${HOME} && && x=1
+/usr/bin x=1 | local done printf
+	"$1" awk 2>/dev/null 2>/dev/null
+-eu ${HOME} -eu awk ${HOME} grep export echo /usr/bin ${HOME}
+	-eu -eu ${HOME} awk "$1" awk
+	2>/dev/null test ${HOME} cd done && x=1 && test then 2>/dev/null --verbose grep
+		"$1" 2>/dev/null && /usr/bin && done awk then grep echo | 'quoted text'
+		done | && printf "$@" | ${HOME} then sed echo local then --verbose
+$(pwd) "$1" x=1 printf test ${HOME} && echo grep 'quoted text'
+		"$@" "$@" test && echo "$@" done echo
+	&& printf --verbose awk x=1 ${HOME} $(pwd) echo
+	export $(pwd) "$1" readonly
+		/usr/bin echo readonly echo | | 'quoted text' "$1" | done "$1"
+		&& done | export 2>/dev/null --verbose "$1" $(pwd)
+&& echo printf | | readonly ${HOME} x=1 local | "$@" /usr/bin --verbose
+	local echo $(pwd) /usr/bin awk ${HOME} awk $(pwd) sed --verbose
+"$1" && "$1" --verbose grep then /usr/bin && grep 'quoted text' awk "$@" && $(pwd)
+		sed echo "$1" grep && cd awk 2>/dev/null -eu readonly x=1 echo
+	&& done "$@" export 2>/dev/null 'quoted text' x=1 ${HOME} local
+	awk echo ${HOME} sed "$@"
+		-eu 'quoted text' test "$@" local x=1 grep sed readonly
+readonly x=1 local cd then readonly printf grep $(pwd) export x=1 cd /usr/bin
+	sed 2>/dev/null "$@" local readonly
+	&& readonly sed | | cd x=1 local -eu printf
+	export local x=1 x=1 'quoted text' readonly
+	${HOME} x=1 then -eu ${HOME} done ${HOME} ${HOME} --verbose
+echo x=1 /usr/bin awk -eu export
+		"$@" echo -eu && 'quoted text' "$1" local "$1"
+	done ${HOME} x=1 done $(pwd) "$1" "$@" 2>/dev/null done done x=1 export "$1"
+	-eu printf cd export /usr/bin
+		| 'quoted text' grep $(pwd) then x=1 "$1" export then ${HOME}
+	echo $(pwd) "$1" printf then 2>/dev/null test x=1 -eu ${HOME} "$@"
+		/usr/bin sed "$@" | test
+		--verbose $(pwd) $(pwd) | x=1 then 'quoted text'
+		-eu grep "$1" test grep "$1" test x=1 sed export && "$@" awk "$@" /usr/bin
+${HOME} grep "$1" printf 'quoted text'
+	echo --verbose export grep sed -eu test
+		| done "$1" grep awk --verbose grep then grep /usr/bin ${HOME} "$1"
+		-eu | test awk done printf
+	cd sed grep cd echo $(pwd) /usr/bin grep grep awk 'quoted text' readonly
+readonly "$@" local && then grep ${HOME} sed export x=1 ${HOME} /usr/bin
+done then done x=1 "$1" && grep "$1" "$@" export printf cd ${HOME}
+local readonly 'quoted text' then cd local then local cd local /usr/bin
+	x=1 /usr/bin echo local cd ${HOME} test /usr/bin readonly printf then
+sed --verbose "$@" then -eu
+		'quoted text' "$@" -eu local then "$@" && --verbose
+${HOME} local grep && awk ${HOME} --verbose -eu printf ${HOME} echo
+		-eu local 'quoted text' sed "$@" test | awk $(pwd) && && printf 2>/dev/null
+	'quoted text' /usr/bin grep "$1" | awk | local
+		grep ${HOME} sed done done "$@" ${HOME}
+	--verbose then sed --verbose
+	sed printf awk && test test cd | "$@" local ${HOME} export done "$1" --verbose
+	sed readonly "$@" then 2>/dev/null
+		--verbose && echo $(pwd) $(pwd) $(pwd) 'quoted text' -eu && x=1 local ${HOME} cd
+	test ${HOME} --verbose /usr/bin then grep 2>/dev/null --verbose cd
+${HOME} -eu 2>/dev/null
+	/usr/bin x=1 then awk printf printf grep
+		grep test then echo $(pwd) && && export export cd printf -eu grep cd export
+		grep "$1" $(pwd) echo /usr/bin && 2>/dev/null 2>/dev/null readonly
+		printf grep ${HOME} printf 'quoted text' && 2>/dev/null done ${HOME}
+		"$1" readonly && 2>/dev/null echo then readonly /usr/bin "$@" "$1" 2>/dev/null
+--verbose readonly 2>/dev/null x=1 printf
+		local then "$@" sed printf sed echo x=1 -eu 'quoted text'
+readonly | awk test then /usr/bin "$1" --verbose x=1 'quoted text' readonly --verbose
+	local printf /usr/bin x=1 2>/dev/null awk /usr/bin /usr/bin
+"$@" export grep awk $(pwd) grep then "$1" "$@"
+		&& cd | printf sed echo "$1" 'quoted text' | readonly "$1" -eu /usr/bin $(pwd)
+	cd "$@" export && grep grep x=1 && | 'quoted text' 2>/dev/null
+echo "$@" "$1" local done awk -eu echo cd $(pwd) 2>/dev/null test
+		test x=1 printf --verbose
+--verbose done -eu ${HOME} cd cd export cd export export grep echo readonly sed
+"$@" 2>/dev/null grep 2>/dev/null ${HOME} "$@" readonly local then
+	"$1" /usr/bin cd "$1" | done && ${HOME} awk /usr/bin grep
+	export ${HOME} "$@" test | --verbose 2>/dev/null local cd ${HOME} grep done -eu
+	&& sed "$1" sed cd readonly "$1" local printf /usr/bin "$1" 2>/dev/null
+		grep "$@" 2>/dev/null done -eu ${HOME}
+		"$@" printf readonly then awk | --verbose echo readonly "$1" printf grep
+	'quoted text' printf sed && printf local echo printf printf awk then test
+		"$1" && printf readonly "$1" export done -eu
+		--verbose 'quoted text' | done local -eu "$1" export
+		done ${HOME} readonly /usr/bin /usr/bin grep "$1" 2>/dev/null ${HOME}
+then "$1" --verbose "$@" test sed "$1" export grep sed x=1 /usr/bin then
+	"$@" && sed then 2>/dev/null ${HOME}
+		&& -eu -eu sed awk awk export done echo 2>/dev/null
+printf | "$@" done test cd ${HOME} x=1 done echo
+printf local test 'quoted text' --verbose readonly $(pwd) echo awk && 'quoted text'
+		test --verbose -eu done | --verbose
+		then then | ${HOME} "$1" readonly
+		'quoted text' export "$1" $(pwd) --verbose
+	then $(pwd) && printf | local | -eu ${HOME} awk local sed printf | && "$@"
+grep cd grep 'quoted text' done -eu sed $(pwd) cd | export grep x=1 'quoted text'
+	local --verbose then "$@"
+'quoted text' $(pwd) 'quoted text' -eu /usr/bin
+${HOME} then -eu /usr/bin /usr/bin 'quoted text' && grep test
+--verbose x=1 "$@" -eu -eu "$@" /usr/bin echo "$1"
+	'quoted text' export --verbose | $(pwd) printf --verbose
+$(pwd) readonly ${HOME} cd /usr/bin
+$(pwd) "$@" test grep echo x=1 local --verbose --verbose
+grep printf readonly then /usr/bin echo awk awk sed cd --verbose x=1 grep
+"$@" $(pwd) | --verbose export
+	| done | awk echo then test -eu local --verbose export export printf then
+	"$@" $(pwd) local -eu ${HOME} done "$@" $(pwd)
+"$1" "$1" done ${HOME} /usr/bin echo
+	x=1 "$@" /usr/bin "$@" $(pwd) printf
+	/usr/bin local 'quoted text' "$@" local
+	grep sed test -eu cd printf done done --verbose
+	| 2>/dev/null sed readonly printf echo done awk echo done test 'quoted text'
+readonly 2>/dev/null then done echo readonly grep cd -eu done
+		-eu awk local local test cd printf /usr/bin test
+		echo 'quoted text' && readonly "$@" grep 2>/dev/null export /usr/bin
+	sed "$@" $(pwd) $(pwd) | /usr/bin done x=1 export -eu 2>/dev/null "$1" then ${HOME}
+	done then printf test readonly "$@" x=1 grep sed && cd && -eu export
+	-eu -eu grep local local sed echo && printf awk 2>/dev/null echo 2>/dev/null
+		| "$1" echo grep -eu /usr/bin |
+	local grep "$1" printf test 'quoted text' cd 2>/dev/null local
+		| done sed cd | 2>/dev/null
+	sed local 2>/dev/null awk && $(pwd) $(pwd) local
+-eu sed x=1 --verbose readonly && 2>/dev/null printf export
+${HOME} | awk done awk awk sed grep 2>/dev/null
+	done readonly --verbose 2>/dev/null
+	--verbose echo export 2>/dev/null awk | | 'quoted text'
+		| && /usr/bin "$@" && /usr/bin awk x=1 -eu done
+		$(pwd) awk test done then export readonly
+	done then --verbose ${HOME} | echo 'quoted text' done /usr/bin
+	awk | cd grep printf cd -eu --verbose "$1"
+printf "$@" export then /usr/bin -eu /usr/bin
+cd --verbose then && cd | "$@" sed -eu done ${HOME} done sed then $(pwd)
+local local awk "$@" | "$@" sed sed export done "$1" && ${HOME} && $(pwd) then
+		echo /usr/bin ${HOME} | "$@" -eu -eu
+	export then then | /usr/bin | done 2>/dev/null ${HOME} done sed readonly
+	then $(pwd) awk --verbose /usr/bin printf awk "$1"
+		--verbose "$@" $(pwd) printf readonly
+	readonly cd | then 2>/dev/null grep 2>/dev/null readonly grep x=1 awk "$@"
+		printf 'quoted text' cd then awk local
+		| /usr/bin grep echo echo local "$1" x=1 -eu readonly
+		"$@" test && "$1" | 'quoted text' cd sed awk
+		2>/dev/null /usr/bin then | ${HOME} grep echo "$@" -eu sed printf then
+| 'quoted text' ${HOME} | awk sed cd local grep x=1 ${HOME} --verbose /usr/bin
+	echo printf && grep "$1" echo done sed then ${HOME} export readonly
+		echo printf grep "$@" sed "$1" 'quoted text' awk printf --verbose
+	-eu test cd cd -eu test grep echo test export
+	'quoted text' | 'quoted text' ${HOME} export local readonly 2>/dev/null
+cd | readonly echo awk awk /usr/bin then ${HOME} cd grep
+	local readonly /usr/bin test printf export $(pwd) ${HOME} readonly ${HOME} echo
+		done printf && sed "$@" done $(pwd) --verbose "$@" cd awk | readonly
+		${HOME} && done --verbose cd export --verbose
+	"$1" done then | echo done "$@" export grep --verbose ${HOME} 'quoted text'
+${HOME} then printf "$1" | x=1 $(pwd) grep "$1" $(pwd) | $(pwd) 'quoted text'
+	readonly "$@" "$@" | printf grep local -eu $(pwd) then done grep
+--verbose export "$1" /usr/bin 'quoted text' && cd --verbose awk $(pwd)
+awk && $(pwd) $(pwd) $(pwd)
+	grep awk /usr/bin 2>/dev/null
+		&& done /usr/bin | export sed "$@" --verbose
+test --verbose $(pwd) x=1 2>/dev/null awk done echo awk grep export
+"$1" ${HOME} "$1" grep then && -eu ${HOME} /usr/bin echo printf
+	sed readonly "$@" then
+	sed test printf export export echo printf then x=1 sed $(pwd) awk "$1" /usr/bin
+		grep | 2>/dev/null echo $(pwd) "$@" local /usr/bin
+	test readonly ${HOME} --verbose 'quoted text'
+2>/dev/null x=1 -eu "$@" printf
+	"$1" /usr/bin done ${HOME} /usr/bin
+'quoted text' sed grep "$@" -eu ${HOME} "$1" printf echo x=1
+	awk cd awk "$1" then | --verbose awk local cd grep readonly 2>/dev/null
+		echo readonly | | /usr/bin grep local
+cd | done | readonly 2>/dev/null sed
+	/usr/bin x=1 done $(pwd) --verbose
+		"$1" export local ${HOME} sed "$1" /usr/bin ${HOME} -eu awk
+&& echo printf done ${HOME} -eu -eu
+		done printf printf -eu cd 'quoted text'
+"$1" "$@" 2>/dev/null test
+	${HOME} 2>/dev/null "$@" --verbose test --verbose sed awk done |
+		export "$1" x=1 2>/dev/null
+| then | 'quoted text' && --verbose done sed --verbose test 'quoted text' cd
+	"$1" printf sed test local | export 2>/dev/null
+	printf 2>/dev/null "$1" cd --verbose "$@" sed
+"$@" awk test awk 'quoted text' cd ${HOME} && 2>/dev/null x=1 grep && readonly
+	/usr/bin x=1 --verbose local test
+2>/dev/null cd "$@" 2>/dev/null cd grep grep | readonly 2>/dev/null $(pwd) -eu readonly
+		grep 'quoted text' local --verbose awk local printf export -eu awk "$@"
+		/usr/bin --verbose done "$@" sed done awk done "$1" | done x=1 && && test ${HOME}
+	&& 'quoted text' | sed && grep | export export readonly 2>/dev/null ${HOME}
+'quoted text' grep $(pwd)
+	readonly /usr/bin echo done $(pwd) test echo --verbose
+x=1 x=1 | awk grep test then 'quoted text' readonly done
+$(pwd) x=1 'quoted text'
+'quoted text' echo sed awk cd cd cd $(pwd) grep grep && --verbose
+	done sed awk then then export readonly x=1
+		export grep awk then 'quoted text' then
+		| test then "$1" printf x=1 /usr/bin ${HOME}
+local $(pwd) then test grep echo readonly && $(pwd) printf sed then
+printf printf 2>/dev/null echo
+		"$@" export local test export ${HOME} x=1 "$1" local
+		then ${HOME} | test grep
+		local x=1 grep awk "$1" $(pwd) echo test
+-eu /usr/bin awk sed printf "$1" echo $(pwd)
+		then 'quoted text' $(pwd) then grep
+"$@" 'quoted text' done local
+		grep test && cd export test export echo
+grep sed done echo cd readonly ${HOME}
+--verbose --verbose "$1" /usr/bin 'quoted text' export cd /usr/bin
+		grep readonly x=1 echo readonly then ${HOME} "$@" export && 2>/dev/null
+cd sed x=1 ${HOME} x=1 readonly printf 'quoted text'
+	export $(pwd) -eu "$1" 2>/dev/null
+		"$1" done /usr/bin grep printf ${HOME} printf "$@" cd 2>/dev/null echo -eu
+		readonly awk readonly 2>/dev/null test export printf $(pwd)
+/usr/bin "$@" --verbose -eu x=1 test then printf --verbose
+	"$@" then "$1" test local export
+		export awk then ${HOME} grep readonly | "$@" x=1 /usr/bin test | 2>/dev/null
+	sed /usr/bin export readonly $(pwd) | /usr/bin --verbose export /usr/bin
+x=1 then "$1" export awk done cd printf -eu
+	x=1 grep && grep && /usr/bin grep 2>/dev/null then -eu ${HOME}
+${HOME} printf sed readonly cd
+sed -eu && cd then --verbose printf export
+	cd done test 2>/dev/null printf awk local "$@" awk --verbose export
+	"$1" --verbose && cd done
+		done sed grep test 'quoted text' | ${HOME} -eu && ${HOME} readonly --verbose
+		"$@" done x=1 $(pwd) local test printf
+		sed /usr/bin -eu awk done 2>/dev/null 2>/dev/null local $(pwd)
+		echo --verbose sed $(pwd) ${HOME} $(pwd) -eu "$@" ${HOME} /usr/bin
+		| cd 'quoted text' echo -eu test sed local sed echo done ${HOME} "$1"
+	"$1" --verbose -eu "$1" ${HOME} "$1" grep echo "$1" awk awk test test /usr/bin then
+'quoted text' readonly done test test sed | echo cd | /usr/bin
+awk "$@" sed $(pwd) "$@" -eu sed readonly
+then "$1" x=1 ${HOME} $(pwd) 'quoted text' cd cd -eu
+		"$1" --verbose printf export /usr/bin
+		&& grep sed 'quoted text'
+		"$1" then test "$1" 2>/dev/null test grep cd local x=1 "$@" x=1 readonly $(pwd)
+	$(pwd) "$@" grep ${HOME} awk --verbose x=1
+	&& "$1" echo "$@" -eu grep readonly /usr/bin
+	'quoted text' local "$1" 2>/dev/null sed export grep awk echo printf local
+		sed cd then && 2>/dev/null "$1" readonly test ${HOME} $(pwd) "$@" grep && export
+	"$1" --verbose echo x=1 awk test then "$@" $(pwd) -eu /usr/bin
+		readonly "$@" ${HOME} 2>/dev/null cd cd "$@" /usr/bin done echo
+		${HOME} "$@" "$@" awk ${HOME}
+-eu "$1" "$1" && export 2>/dev/null test printf awk x=1 2>/dev/null --verbose
+done $(pwd) awk done "$@" printf && /usr/bin | readonly
+	"$@" 'quoted text' then then $(pwd)
+/usr/bin /usr/bin readonly -eu -eu export
+	"$@" test --verbose awk test export then | 2>/dev/null $(pwd) echo
+echo "$1" done test -eu ${HOME} cd local test
+echo ${HOME} grep && echo "$@" done -eu "$@"
+cd local export "$@" cd export local sed /usr/bin
+"$@" x=1 export "$1" export 'quoted text' 2>/dev/null
+	"$@" cd "$@" "$1" --verbose test ${HOME} /usr/bin
+	$(pwd) 'quoted text' 2>/dev/null $(pwd) $(pwd) printf
+	| x=1 grep "$@" "$1" /usr/bin
+		${HOME} "$@" ${HOME} cd readonly -eu 2>/dev/null
+	$(pwd) test --verbose x=1 grep -eu x=1 $(pwd) grep test --verbose cd $(pwd)
+		printf readonly ${HOME} sed then
+	awk $(pwd) 2>/dev/null grep then && | grep $(pwd) --verbose /usr/bin
+		&& export export x=1 test test 2>/dev/null
+	test "$1" readonly x=1
+	printf x=1 "$1" "$@" sed echo done local -eu local ${HOME} echo -eu
+		sed local && local -eu $(pwd)
+		grep printf -eu 'quoted text'
+		printf x=1 done then /usr/bin local --verbose
+		awk done awk ${HOME} grep && then x=1 --verbose readonly
+	&& echo cd 'quoted text' cd | then cd test done 2>/dev/null
+		$(pwd) --verbose 2>/dev/null cd &&
+printf "$@" then echo && /usr/bin -eu done test x=1 readonly
+	test 'quoted text' | readonly export local 2>/dev/null then sed export
+local | local "$@" $(pwd) local test cd --verbose local readonly export
+$(pwd) sed ${HOME} echo 2>/dev/null local export awk && readonly awk
+	/usr/bin printf printf echo cd 2>/dev/null sed --verbose cd
+		x=1 cd echo local printf | --verbose printf /usr/bin
+		&& printf printf sed test | awk readonly
+${HOME} 2>/dev/null sed "$1" $(pwd)
+		readonly -eu then $(pwd) $(pwd) cd 'quoted text'
+"$@" done local ${HOME} then printf $(pwd) --verbose
+echo | | /usr/bin grep x=1 "$1" done done export
+		grep -eu | readonly /usr/bin | printf echo
+		readonly ${HOME} then x=1 readonly 'quoted text' && 2>/dev/null
+	'quoted text' ${HOME} 2>/dev/null echo awk local "$@" ${HOME} local grep "$@"
+	--verbose | 'quoted text' readonly sed /usr/bin test then grep 2>/dev/null
+${HOME} /usr/bin local done | ${HOME}
+awk | 'quoted text' cd "$@" 2>/dev/null cd done x=1 readonly 2>/dev/null
+		done awk ${HOME} ${HOME} cd -eu export awk $(pwd)
+"$1" "$1" -eu "$1" --verbose cd ${HOME} 'quoted text' printf "$@" | export grep
+readonly sed cd && local then test export
+local /usr/bin --verbose readonly echo grep test sed sed ${HOME}
+		readonly -eu "$@" 'quoted text' --verbose echo cd
+		test 'quoted text' test ${HOME} local cd 'quoted text' export readonly -eu cd |
+		"$1" x=1 2>/dev/null export grep && $(pwd) $(pwd) grep
+	&& "$1" cd && cd 2>/dev/null local ${HOME}
+		&& export "$1" then sed 2>/dev/null done
+	test sed "$1" -eu && 2>/dev/null printf export
+	done sed ${HOME} local "$1" "$@" export
+	--verbose -eu cd | cd export cd then
+	sed readonly readonly
+	x=1 x=1 --verbose --verbose done test x=1 x=1 && x=1 /usr/bin
+done cd && cd local ${HOME} "$1" printf ${HOME} then "$@" "$1"
+		local done readonly x=1 grep export ${HOME} export
+	cd local sed awk readonly
+	test && done && echo ${HOME} grep "$@" sed cd echo /usr/bin
+	"$1" test export x=1 echo
+grep cd test 2>/dev/null then 2>/dev/null 2>/dev/null "$1" done /usr/bin
+sed "$1" cd "$@" && x=1 --verbose awk | x=1 grep | sed echo export 'quoted text'
+sed local test && awk readonly done && then export 'quoted text'
+	-eu export 'quoted text' sed 2>/dev/null ${HOME} /usr/bin test
+${HOME} grep 2>/dev/null local
+	grep $(pwd) grep printf echo done then 'quoted text' 'quoted text' --verbose
+		test ${HOME} 'quoted text' ${HOME} "$1"
+	--verbose && export /usr/bin sed "$1" && done export 2>/dev/null
+	readonly export sed --verbose "$1" cd cd echo 2>/dev/null export test | | ${HOME}
+"$@" test "$@" && test test sed /usr/bin printf "$1"
+	/usr/bin --verbose x=1 $(pwd)
+		export sed then ${HOME} then ${HOME} export sed 2>/dev/null
+${HOME} awk 2>/dev/null
+$(pwd) && "$@" "$@" done 'quoted text' local && cd test "$1" readonly local ${HOME}
+		sed done done export awk $(pwd) 2>/dev/null
+	&& awk 'quoted text' && 'quoted text' 'quoted text' -eu echo "$1" readonly
+		| | /usr/bin export test done /usr/bin && x=1 "$1" | 'quoted text'
+		printf 2>/dev/null printf | $(pwd) grep test awk "$1" $(pwd) cd --verbose 2>/dev/null
+	sed grep test sed && then awk ${HOME} ${HOME} test x=1 "$1"
+	$(pwd) --verbose 2>/dev/null $(pwd) 'quoted text'
+		then readonly awk 2>/dev/null --verbose /usr/bin printf export then printf
+	awk ${HOME} /usr/bin echo ${HOME} 'quoted text' $(pwd) cd cd "$@" done printf
+then cd cd printf local readonly ${HOME} -eu ${HOME} local export readonly test
+export -eu printf printf 'quoted text' x=1 ${HOME} test "$@"
+		awk readonly "$@" then sed export ${HOME} then
+	echo readonly $(pwd) && awk /usr/bin then done x=1
+--verbose 'quoted text'
+		local done "$1" sed "$1" awk | "$@" test sed /usr/bin sed ${HOME} --verbose
+		-eu done printf cd x=1 'quoted text' 2>/dev/null
+		2>/dev/null local "$1" 'quoted text' export readonly
+awk $(pwd) $(pwd) $(pwd)
+	local local grep test | echo printf
+	"$@" /usr/bin readonly 2>/dev/null -eu sed
+&& echo readonly readonly cd -eu ${HOME} test done --verbose
+awk readonly echo 'quoted text' then
+	export readonly echo "$@" printf echo -eu 'quoted text' /usr/bin x=1 echo
+test | x=1 printf printf $(pwd) done 2>/dev/null
+/usr/bin local "$@" ${HOME} sed readonly "$@"
+-eu grep "$1" awk && sed ${HOME} 2>/dev/null echo "$@" done echo && x=1
+'quoted text' echo cd local echo grep grep printf echo awk grep cd readonly
+	--verbose done --verbose 'quoted text' x=1 local cd done -eu awk
+grep cd /usr/bin export /usr/bin /usr/bin cd "$1" local then --verbose then
+		/usr/bin /usr/bin local 'quoted text'
+printf grep | grep readonly /usr/bin cd -eu "$1" cd ${HOME} | 'quoted text'
+		export printf ${HOME} $(pwd) "$@" | 2>/dev/null $(pwd) grep "$1" awk && 'quoted text'
+	cd then $(pwd) readonly 'quoted text'
+'quoted text' ${HOME} && then readonly test | ${HOME} readonly echo --verbose
+		sed local export 2>/dev/null
+sed export && echo test cd
+		grep export awk | sed ${HOME} "$@" grep "$1" 'quoted text'
+awk cd /usr/bin "$1" "$@" grep "$1" /usr/bin $(pwd) awk "$@" && cd 'quoted text'
+	local "$@" -eu export && 'quoted text' printf
+		export | then done export
+		"$@" ${HOME} /usr/bin
+	| && ${HOME} "$@" test readonly && awk /usr/bin readonly
+		sed --verbose ${HOME} sed 'quoted text'
+	--verbose cd cd | -eu "$@" --verbose "$@" done | ${HOME}
+	x=1 | grep sed sed echo "$1"
+"$1" 2>/dev/null local grep printf
+readonly 2>/dev/null 'quoted text'
+	-eu -eu x=1 local export grep ${HOME} --verbose
+	&& | 2>/dev/null ${HOME} export $(pwd) awk cd grep "$1" cd ${HOME} /usr/bin echo
+		local export --verbose --verbose x=1 | done "$@"
+readonly echo --verbose ${HOME} /usr/bin $(pwd) $(pwd)
+	&& x=1 local /usr/bin 'quoted text' readonly "$@" && export echo
+printf 2>/dev/null echo echo --verbose -eu test "$@"
+2>/dev/null -eu echo local
+	cd x=1 printf then ${HOME} | awk /usr/bin --verbose && done cd echo
+	awk export "$@" "$1" x=1
+	&& --verbose printf | --verbose export x=1 x=1 "$1"
+		&& $(pwd) /usr/bin 2>/dev/null ${HOME} export
+	echo $(pwd) 'quoted text' && && local -eu x=1 grep && readonly
+	&& printf --verbose grep && $(pwd) done x=1 test awk && "$1"
+		sed 'quoted text' export "$@" cd --verbose x=1 then sed echo $(pwd)
+	'quoted text' cd ${HOME} $(pwd) readonly
+'quoted text' 2>/dev/null then test && 2>/dev/null --verbose 2>/dev/null
+export local 2>/dev/null 2>/dev/null
+grep local test cd readonly && done | x=1 test export test local
+	/usr/bin "$@" "$1" readonly
+		test cd sed | -eu 'quoted text' --verbose
+	${HOME} 'quoted text' x=1 export grep ${HOME} -eu
+		test 'quoted text' printf -eu
+		done ${HOME} local "$@" $(pwd) export "$1" "$1" cd then readonly
+done x=1 then $(pwd) printf |
+	readonly local 'quoted text'
+	${HOME} "$1" export grep readonly 2>/dev/null | -eu readonly -eu then | cd && then
+		grep x=1 $(pwd) && echo && grep export done export ${HOME}
+		2>/dev/null export sed 'quoted text'
+		&& awk ${HOME} readonly "$@" -eu | readonly ${HOME} 2>/dev/null readonly
+		${HOME} test ${HOME} ${HOME}
+grep printf $(pwd) echo x=1 printf echo test test then readonly -eu readonly --verbose
+"$1" | export sed ${HOME} test 'quoted text'
+echo | sed awk done 'quoted text'
+		| export echo sed echo && readonly -eu test cd /usr/bin grep readonly /usr/bin
+		echo grep local grep "$1" then x=1 done "$@" then -eu x=1 test
+	cd && local && export readonly "$1" | -eu sed done export done printf
+local "$@" local $(pwd) 'quoted text'
+	'quoted text' $(pwd) ${HOME} printf
+		/usr/bin readonly --verbose awk 2>/dev/null cd then sed --verbose 2>/dev/null
+'quoted text' | && export --verbose test sed grep echo ${HOME} grep x=1 printf
+	done 2>/dev/null ${HOME} && /usr/bin printf $(pwd) grep /usr/bin
+then && ${HOME} local "$1" local --verbose /usr/bin x=1 test grep
+export /usr/bin echo then printf /usr/bin awk x=1 cd awk 2>/dev/null | grep local
+awk $(pwd) "$1" 'quoted text' printf -eu readonly test
+		grep --verbose awk echo 'quoted text' test printf
+echo 'quoted text' test &&
+-eu readonly printf then printf export -eu test 2>/dev/null "$1" printf
+x=1 $(pwd) && --verbose /usr/bin
+printf grep cd "$@" then $(pwd) then printf 2>/dev/null "$@" local "$@"
+	&& done awk echo readonly
+readonly export printf cd awk
+test x=1 --verbose grep "$1" "$@" --verbose printf done printf awk
+	$(pwd) readonly test && 2>/dev/null && | -eu export test readonly then
+	${HOME} -eu readonly then
+"$@" /usr/bin x=1 awk then x=1 export "$@" /usr/bin
+		--verbose test export done printf awk sed
+		cd 2>/dev/null test awk test $(pwd)
+		done echo then "$@" && $(pwd)
+		done test -eu && awk --verbose awk done awk ${HOME}
+		"$@" x=1 "$1" 'quoted text' "$@" test
+	'quoted text' x=1 ${HOME} x=1 local 'quoted text' x=1 sed done && then local sed
+	then 2>/dev/null readonly awk grep "$@" 'quoted text' "$@" local 2>/dev/null
+	$(pwd) local 'quoted text' 2>/dev/null
+readonly 2>/dev/null awk sed awk ${HOME} readonly /usr/bin export
+done grep test export sed --verbose ${HOME} && $(pwd) sed export sed then ${HOME}
+		"$1" local export $(pwd) export sed
+sed $(pwd) | /usr/bin printf readonly echo test readonly local grep
+$(pwd) && echo -eu && local export test $(pwd) then 'quoted text'
+	x=1 grep | && echo "$@" 'quoted text' $(pwd) echo cd
+		/usr/bin 2>/dev/null printf printf 2>/dev/null && readonly
+	| grep x=1 grep 'quoted text' done then $(pwd) -eu && -eu echo awk done
+"$1" export 'quoted text' grep x=1
+&& /usr/bin local test
+done readonly 2>/dev/null 'quoted text' local "$@" 2>/dev/null
+echo export | "$@" 2>/dev/null /usr/bin 2>/dev/null
+	sed 'quoted text' && cd done
+		| ${HOME} export printf
+	"$@" /usr/bin grep grep local
+test 2>/dev/null -eu | sed 'quoted text' grep done /usr/bin ${HOME} &&
+	| then done --verbose && grep --verbose $(pwd) then sed sed
+		/usr/bin 2>/dev/null export cd then echo /usr/bin test export grep
+		awk echo test printf --verbose $(pwd) "$@" grep
+	"$@" cd --verbose --verbose 2>/dev/null "$@" $(pwd)
+	then "$@" echo 'quoted text' 2>/dev/null -eu 2>/dev/null
+		x=1 test readonly 2>/dev/null readonly -eu readonly -eu -eu
+	| awk grep cd echo -eu echo -eu -eu
+	x=1 cd 2>/dev/null cd | $(pwd) && | printf --verbose 'quoted text' then printf
+		-eu $(pwd) test /usr/bin printf
+-eu sed sed awk --verbose $(pwd)
+	"$@" x=1 echo "$@" ${HOME} ${HOME} "$1" printf | 2>/dev/null 2>/dev/null
+		--verbose export "$1" "$@" cd | grep --verbose --verbose ${HOME}
+	"$1" ${HOME} cd | awk then cd "$1" readonly printf then awk
+	/usr/bin "$@" export $(pwd) --verbose
+	test -eu echo test "$@" | 2>/dev/null export test local
+	x=1 echo echo printf /usr/bin awk 'quoted text' -eu 'quoted text'
+		grep /usr/bin test cd "$@" "$1" export "$1" cd "$@" grep printf then
+	${HOME} test cd grep printf then readonly /usr/bin x=1 && then | then awk printf
+2>/dev/null then printf ${HOME} then test --verbose local done
+		then awk $(pwd) --verbose cd -eu
+		sed awk ${HOME} && readonly -eu 2>/dev/null 'quoted text'
+local 2>/dev/null x=1 'quoted text' done
+"$1" ${HOME} test ${HOME} 2>/dev/null
+		grep done /usr/bin x=1 $(pwd) $(pwd) /usr/bin sed
+local -eu 'quoted text' | "$1" 'quoted text' done
+"$@" 2>/dev/null | x=1 echo 2>/dev/null local
+--verbose -eu sed grep sed local | 2>/dev/null && 2>/dev/null
+--verbose printf ${HOME} /usr/bin readonly
+local $(pwd) test echo grep printf awk then local local
+	-eu printf /usr/bin printf /usr/bin
+	test "$@" then readonly done x=1 "$@"
+		readonly -eu | awk "$1"
+	sed printf done /usr/bin && 'quoted text' | export readonly
+	| awk --verbose x=1 && readonly done readonly ${HOME}
+test grep echo printf printf cd echo done cd cd sed local "$1"
+		sed 'quoted text' "$1" then done
+	echo 'quoted text' 2>/dev/null && export done
+	--verbose | cd grep --verbose -eu awk local export $(pwd)
+local readonly 'quoted text' sed then awk
+local then sed "$@" awk
+		local "$@" readonly cd cd done
+	'quoted text' "$@" local
+	--verbose export export --verbose
+	x=1 grep test local $(pwd)
+| /usr/bin readonly x=1 local --verbose
+local /usr/bin grep export readonly test $(pwd)
+		printf done printf echo x=1 x=1 -eu done /usr/bin
+"$@" grep done $(pwd) sed awk cd x=1 export then done
+	export then --verbose awk done grep local x=1 $(pwd) grep test awk test
+test local && then export then && then "$1" then
+	then awk "$1" | $(pwd) test /usr/bin
+		printf done grep then grep local
+		printf cd test 2>/dev/null awk $(pwd) cd export printf 2>/dev/null
+	export readonly awk done 'quoted text'
+&& awk export "$1" -eu | "$1" 2>/dev/null
+	then readonly $(pwd) -eu $(pwd) 'quoted text' --verbose "$1" $(pwd) /usr/bin
+	echo 'quoted text' local local x=1 /usr/bin
+	| 'quoted text' grep then cd "$1" sed 2>/dev/null sed -eu
+	$(pwd) sed sed /usr/bin printf local "$@" $(pwd)
+	$(pwd) readonly && cd "$1"
+--verbose export && && cd readonly
+&& $(pwd) export local | | $(pwd) sed 2>/dev/null awk --verbose
+		&& readonly 2>/dev/null awk readonly readonly done ${HOME}
+	local x=1 then readonly "$@" sed x=1 --verbose export
+	/usr/bin ${HOME} $(pwd)
+	$(pwd) $(pwd) $(pwd) cd && then
+&& grep -eu grep echo then done ${HOME} printf
+	2>/dev/null --verbose local sed then done local 2>/dev/null 'quoted text' ${HOME}
+		| 'quoted text' grep then cd printf ${HOME} grep readonly
+	/usr/bin local test export 2>/dev/null --verbose 2>/dev/null local export "$@"
+then -eu readonly | done "$1" ${HOME} cd printf done ${HOME}
+	sed local then readonly readonly test "$@"
+	awk local done grep /usr/bin done readonly 2>/dev/null /usr/bin
+	export x=1 ${HOME} "$1" /usr/bin then 'quoted text' echo printf "$1"
+		done -eu done grep cd && &&
+done then -eu export awk test cd --verbose 'quoted text' "$1" x=1 test
+		local then "$1" printf
+	${HOME} test $(pwd) then -eu 'quoted text' 'quoted text' echo awk --verbose
+		--verbose done | "$1" cd x=1 |
+printf printf --verbose && local
+		printf /usr/bin cd && | done $(pwd) then printf | --verbose local "$@" done 2>/dev/null
+		grep 2>/dev/null "$@" readonly ${HOME} /usr/bin
+		export "$1" $(pwd) grep /usr/bin then x=1
+echo x=1 /usr/bin readonly | readonly && 2>/dev/null /usr/bin "$1" "$1" -eu ${HOME}
+-eu cd readonly && echo ${HOME} x=1 echo export --verbose /usr/bin --verbose
+		$(pwd) readonly "$1" -eu readonly
+&& -eu grep 2>/dev/null --verbose echo local 'quoted text' readonly
+		2>/dev/null $(pwd) done 'quoted text' test echo ${HOME} |
+$(pwd) test $(pwd) $(pwd) test awk then awk grep grep ${HOME} test done && sed
+	cd $(pwd) grep sed done
+		awk test sed ${HOME} 'quoted text'
+done | test --verbose && local export $(pwd) then "$1" export $(pwd) sed
+		-eu $(pwd) 'quoted text' && cd "$1" export test printf awk cd test | done
+$(pwd) "$1" ${HOME} | printf readonly "$1" -eu done cd readonly
+		$(pwd) cd "$1" export 'quoted text' /usr/bin
+done 'quoted text' $(pwd) "$@" ${HOME} local x=1 local
+		export x=1 grep then -eu
+	2>/dev/null x=1 --verbose then readonly done echo x=1 awk printf
+	x=1 local local sed grep
+		test sed awk "$1" --verbose cd awk "$1" 2>/dev/null
+done --verbose awk printf sed grep local sed then printf "$@" readonly "$@"
+		readonly sed "$1" ${HOME} grep then "$@" 2>/dev/null sed
+		printf -eu readonly printf local | "$1" $(pwd) printf test
+	${HOME} then && export ${HOME} done then "$1" printf then local sed "$1" readonly
+		export 'quoted text' awk "$1" local /usr/bin local sed then
+	cd 'quoted text' && sed local echo readonly local export echo
+		export export -eu ${HOME} echo x=1 /usr/bin
+		&& -eu awk $(pwd) x=1 'quoted text' test
+		| awk ${HOME} 'quoted text' awk 'quoted text' -eu | then local
+		readonly local done cd echo readonly
+sed /usr/bin $(pwd) 2>/dev/null x=1 echo
+	| awk $(pwd) "$1" x=1 sed $(pwd) 2>/dev/null local readonly local
+done -eu done ${HOME} grep --verbose
+	cd && test && sed && | echo --verbose test done 2>/dev/null
+/usr/bin cd "$1" readonly grep done "$@" local echo 2>/dev/null
+	export local -eu test 2>/dev/null
+		/usr/bin done export test "$1" --verbose 2>/dev/null
+		| grep cd test x=1 && --verbose "$@" | readonly printf
+then done --verbose test "$@" then /usr/bin "$1" cd grep -eu cd 'quoted text'
+--verbose --verbose ${HOME}
+	/usr/bin "$1" readonly "$1" local && done test $(pwd) printf cd sed grep
+	${HOME} readonly 2>/dev/null /usr/bin test $(pwd)
+test local ${HOME} "$1" printf export 'quoted text'
+		grep /usr/bin && "$1" test grep ${HOME} x=1 /usr/bin done
+	--verbose "$1" echo --verbose
+cd readonly sed awk local 'quoted text' $(pwd) then export test then
+	&& -eu x=1 'quoted text' grep $(pwd) /usr/bin awk "$@" -eu 2>/dev/null
+		printf 'quoted text' test
+| 2>/dev/null printf export grep "$1" && local --verbose | cd | done cd then |
+	local local 2>/dev/null 'quoted text' 2>/dev/null
+	grep /usr/bin "$1" sed
+		local 'quoted text' test then && /usr/bin "$@" printf /usr/bin
+		test export readonly "$@" awk sed "$1" "$1" "$@" | echo awk awk "$@" readonly
+		readonly 2>/dev/null /usr/bin done local ${HOME} --verbose
+		local test -eu grep "$@" readonly | sed readonly
+| "$1" printf awk printf readonly local test
+		2>/dev/null ${HOME} /usr/bin grep awk x=1 done x=1
+	${HOME} x=1 "$@" then grep echo ${HOME} "$@" export |
+		test echo x=1 readonly test "$@" 'quoted text' -eu 2>/dev/null "$@" then
+export && -eu /usr/bin then done done && x=1 'quoted text'
+	-eu --verbose --verbose done cd readonly /usr/bin /usr/bin cd
+${HOME} ${HOME} done export cd $(pwd)
+	echo "$@" local x=1 test local && done x=1 'quoted text' readonly
+		--verbose && "$@" && /usr/bin echo -eu done echo done ${HOME} printf $(pwd) sed
+	'quoted text' printf cd 'quoted text' x=1 printf 'quoted text'
+-eu awk && ${HOME} readonly ${HOME} test export -eu $(pwd)
+	cd local done x=1 cd 'quoted text' 'quoted text'
+		printf done -eu x=1 | done "$@"
+	printf /usr/bin grep export local
+${HOME} local printf "$@" && -eu sed printf 2>/dev/null grep && "$@" printf
+grep test awk test "$@" grep | awk
+local done done echo x=1 ${HOME} sed done done "$1" "$1" "$1"
+local done grep 'quoted text' x=1 test
+	$(pwd) 2>/dev/null x=1 -eu /usr/bin
+cd 'quoted text' grep awk test then readonly /usr/bin | grep awk "$1" test
+		then 'quoted text' $(pwd) "$@" readonly /usr/bin /usr/bin $(pwd)
+	-eu readonly "$1" -eu export x=1 "$1" local x=1 |
+		printf test awk --verbose "$@" && printf "$1" $(pwd) 2>/dev/null grep awk --verbose
+	echo sed local readonly /usr/bin
+		printf 2>/dev/null --verbose && ${HOME} /usr/bin $(pwd) sed test done ${HOME}
+		| test done $(pwd) export then 2>/dev/null /usr/bin done test printf
+		'quoted text' then done then local
+		grep readonly export done && echo -eu
+	x=1 grep 2>/dev/null -eu /usr/bin printf --verbose /usr/bin "$1" $(pwd) printf x=1
+		2>/dev/null done then --verbose x=1 x=1 readonly test $(pwd) awk sed "$1"
+"$1" x=1 echo && "$1" local $(pwd) /usr/bin /usr/bin readonly
+| /usr/bin && $(pwd) local 2>/dev/null x=1 2>/dev/null local cd /usr/bin
+		then cd /usr/bin sed && 2>/dev/null --verbose readonly | x=1 "$1" then then --verbose
+		--verbose local printf /usr/bin && awk printf cd test export && 2>/dev/null
+	2>/dev/null local $(pwd) 2>/dev/null --verbose sed export cd
+		echo awk -eu echo ${HOME} then
+printf "$1" sed --verbose
+export awk x=1 readonly 'quoted text'
+	local readonly 'quoted text' && |
+		'quoted text' cd printf readonly local then awk x=1 cd sed
+		$(pwd) ${HOME} echo done grep && local
+		x=1 | 'quoted text' local awk 2>/dev/null --verbose export printf awk ${HOME}
+	printf then $(pwd) | --verbose echo cd "$@" /usr/bin printf
+	done sed "$@" then printf
+	test $(pwd) | printf local readonly awk done --verbose export
+readonly test done "$@" "$@" export /usr/bin
+	local /usr/bin $(pwd) 'quoted text' /usr/bin
+echo x=1 && echo then "$1" awk "$@" grep cd cd $(pwd) echo x=1 ${HOME} "$1" -eu
+	${HOME} local $(pwd) | ${HOME} local | echo --verbose /usr/bin
+		--verbose 2>/dev/null ${HOME} x=1 printf then "$@" | "$@" grep
+	cd /usr/bin test local 2>/dev/null --verbose "$1"
+	cd awk -eu ${HOME} "$@" x=1 echo "$1" then sed /usr/bin /usr/bin export awk printf
+		${HOME} ${HOME} 2>/dev/null -eu 2>/dev/null
+--verbose then /usr/bin done 2>/dev/null 'quoted text' "$@"
+x=1 2>/dev/null sed | printf 'quoted text'
+readonly then printf cd "$@"
+		&& $(pwd) $(pwd) awk && readonly ${HOME} "$@" readonly
+grep 2>/dev/null local grep export cd --verbose /usr/bin
+'quoted text' x=1 /usr/bin
+--verbose grep "$@" 2>/dev/null cd readonly printf
+	'quoted text' -eu 'quoted text' echo -eu && printf
+		--verbose then done done && export readonly
+	grep "$1" "$@" local x=1 test $(pwd) && test readonly --verbose export
+		local && test export grep x=1 sed then
+'quoted text' test printf readonly grep 2>/dev/null
+	/usr/bin ${HOME} sed --verbose x=1 local $(pwd) local export | cd "$@"
+'quoted text' done echo done done | grep test "$1"
+		printf local ${HOME} awk then awk local 2>/dev/null readonly
+"$1" $(pwd) awk done /usr/bin echo readonly readonly test
+export "$@" done ${HOME} ${HOME} 2>/dev/null export echo
+readonly -eu | 'quoted text'
+		grep readonly then sed printf
+&& cd echo 2>/dev/null readonly "$1" printf
+cd cd then sed | -eu done --verbose sed && local test
+'quoted text' x=1 export --verbose test 2>/dev/null -eu "$1"
+		-eu sed printf /usr/bin test x=1 /usr/bin
+local "$@" grep ${HOME} test local --verbose /usr/bin done test cd
+	-eu cd printf grep "$@" export -eu --verbose 'quoted text'
+		then then cd printf cd readonly "$@" grep grep | $(pwd) readonly
+		2>/dev/null then "$@" then local 'quoted text' then done | cd &&
+&& "$1" export echo echo export 2>/dev/null cd --verbose sed
+	x=1 && -eu x=1 done cd -eu && "$@" readonly | -eu -eu x=1
+	readonly export local 2>/dev/null && --verbose
+	2>/dev/null grep local awk readonly readonly cd test "$@" test $(pwd) 'quoted text'
+local cd awk printf /usr/bin sed 'quoted text'
+	sed test x=1 /usr/bin && local
+export cd --verbose 2>/dev/null "$1" && test /usr/bin readonly sed then "$1" --verbose
+echo $(pwd) "$1" done "$@" 'quoted text' | grep -eu /usr/bin 2>/dev/null -eu readonly
+| export "$1" ${HOME} test local /usr/bin 2>/dev/null awk export "$1" | awk local
+test ${HOME} 2>/dev/null 'quoted text' awk readonly
+		${HOME} done --verbose "$@" cd --verbose $(pwd) x=1
+	/usr/bin /usr/bin sed "$1" cd && printf | echo x=1 ${HOME} grep ${HOME}
+cd 'quoted text' echo readonly "$1"
+		${HOME} readonly /usr/bin grep test "$@" --verbose export
+&& done done --verbose --verbose awk export echo done
+	sed cd -eu 'quoted text' done $(pwd) readonly echo awk
+		echo echo awk /usr/bin export $(pwd) $(pwd) readonly printf sed
+--verbose done /usr/bin
+readonly readonly 'quoted text' ${HOME} ${HOME}
+		-eu grep awk readonly
+	"$1" $(pwd) printf sed --verbose -eu echo ${HOME} /usr/bin x=1 done 'quoted text'
+	awk && sed && echo awk done
+		printf ${HOME} | --verbose -eu echo "$1"
+2>/dev/null cd done cd 2>/dev/null ${HOME} ${HOME}
+		--verbose x=1 && test grep 'quoted text'
+readonly export /usr/bin /usr/bin "$@" grep echo done 'quoted text' && "$1"
+	then /usr/bin 2>/dev/null && printf x=1 awk cd x=1 printf grep "$@" printf $(pwd)
+		| done && sed then test ${HOME} 2>/dev/null ${HOME} awk printf
+then 'quoted text' test ${HOME} "$@" && sed x=1 grep
+	${HOME} then "$@" /usr/bin printf awk 2>/dev/null
+| cd | done ${HOME} && test grep && -eu grep test "$1" printf
+		| export echo "$1" test $(pwd) x=1 local readonly echo $(pwd)
+		export 2>/dev/null sed -eu
+		/usr/bin then cd | --verbose
+	2>/dev/null 2>/dev/null /usr/bin
+cd printf done "$1" awk sed sed awk export "$1" cd local -eu x=1
+	readonly -eu 2>/dev/null $(pwd) export "$1" ${HOME} awk echo export
+		done -eu then export 'quoted text' readonly sed test && readonly ${HOME} && printf
+test -eu ${HOME} && && "$@" awk readonly readonly
+grep /usr/bin ${HOME} test && 2>/dev/null 2>/dev/null awk -eu cd
+x=1 -eu $(pwd) cd $(pwd) -eu ${HOME}
+		printf 'quoted text' -eu | echo x=1 &&
+		"$1" ${HOME} "$1" export && export x=1 && echo
+	&& x=1 printf cd echo && -eu printf --verbose cd cd sed | done export readonly
+	local local && export --verbose cd x=1 ${HOME} cd 2>/dev/null cd | "$@" /usr/bin
+		"$@" cd sed x=1 done && test grep ${HOME} readonly cd $(pwd) |
+		cd --verbose --verbose test echo
+-eu | $(pwd) $(pwd) "$@" grep && -eu "$1" 2>/dev/null | sed
+	$(pwd) echo 2>/dev/null cd echo && "$@" 2>/dev/null ${HOME} readonly
+$(pwd) cd | then done --verbose awk x=1 local grep | done x=1 sed x=1
+done printf echo --verbose /usr/bin export readonly /usr/bin echo x=1 printf
+&& readonly sed -eu 2>/dev/null local awk grep
+		'quoted text' test x=1 echo cd ${HOME} --verbose awk "$1" | then | && awk done
+	2>/dev/null export then cd -eu
+	/usr/bin "$1" local -eu $(pwd)
+x=1 "$@" "$1" 'quoted text' printf -eu test local printf x=1
+	'quoted text' "$1" -eu 'quoted text' printf
+		$(pwd) awk | echo export "$1" test
+		echo $(pwd) x=1 --verbose done grep 'quoted text' sed then awk
+		grep test 2>/dev/null
+	grep --verbose "$@" sed 'quoted text' local local 2>/dev/null then 'quoted text'
+		test x=1 -eu awk 2>/dev/null x=1 ${HOME} echo printf
+	awk 2>/dev/null 'quoted text' printf
+	sed | readonly local cd
+cd readonly readonly grep sed local x=1 then 2>/dev/null
+then /usr/bin awk test --verbose local
+	&& export grep x=1 test awk "$1" echo awk "$@" -eu "$@" | sed export && "$1" x=1
+$(pwd) /usr/bin | -eu cd readonly $(pwd) x=1 echo printf -eu
+/usr/bin 'quoted text' done done local readonly readonly ${HOME}
+grep "$@" cd && sed /usr/bin test
+test /usr/bin ${HOME} local 2>/dev/null done ${HOME} $(pwd) export export 2>/dev/null
+	"$1" 2>/dev/null x=1 $(pwd) $(pwd) grep export
+	local 2>/dev/null cd grep $(pwd) local test done -eu grep --verbose
+'quoted text' 'quoted text' sed
+	'quoted text' | then local local test /usr/bin 2>/dev/null
+local x=1 export $(pwd) | printf
+		export -eu x=1 then 'quoted text' test /usr/bin then 2>/dev/null &&
+	cd then grep echo ${HOME} && $(pwd) readonly x=1 done
+		printf "$1" awk && grep
+	readonly grep sed "$1" grep x=1 awk printf ${HOME}
+		echo then /usr/bin "$@" test then "$@"
+	-eu local grep done then done ${HOME}
+	echo local /usr/bin grep then /usr/bin && awk "$1" && x=1 /usr/bin x=1 --verbose
+'quoted text' then /usr/bin local && local
+		--verbose export cd $(pwd) readonly awk x=1 grep printf
+		${HOME} 'quoted text' --verbose cd export "$@" 2>/dev/null echo export awk
+		echo sed ${HOME} && $(pwd) $(pwd) then printf $(pwd) x=1
+	local grep "$1" --verbose local export awk local $(pwd)
+	awk "$1" ${HOME} 2>/dev/null 'quoted text' readonly
+		sed "$@" $(pwd) cd echo 'quoted text' --verbose
+	/usr/bin then -eu sed "$1" echo export "$1"
+/usr/bin then test && awk printf
+sed -eu && --verbose && then /usr/bin printf export 2>/dev/null local export
+	2>/dev/null "$1" 'quoted text' local sed | && x=1 /usr/bin export sed 'quoted text'
+"$@" done grep 2>/dev/null
+	export "$1" --verbose | --verbose && grep ${HOME} echo readonly
+test /usr/bin test | "$@" /usr/bin --verbose grep ${HOME}
+		x=1 2>/dev/null grep export x=1 ${HOME}
+		echo echo | awk then cd -eu | done x=1 x=1 awk 'quoted text'
+--verbose export cd /usr/bin local && 'quoted text' awk awk
+		"$1" -eu --verbose test export ${HOME} /usr/bin ${HOME}
+		"$@" then 2>/dev/null awk "$1" "$@" --verbose sed "$1" awk sed
+		grep readonly test export x=1 printf awk then grep then
+		"$1" "$1" ${HOME} awk then printf 'quoted text' "$1" x=1 sed printf 'quoted text'
+2>/dev/null && | -eu "$1" x=1 'quoted text' local
+		echo local 'quoted text'
+		$(pwd) then echo "$@" then then awk && 2>/dev/null cd grep $(pwd) -eu local
+		x=1 && x=1 $(pwd) export printf ${HOME} 'quoted text' cd
+"$@" printf local test && cd readonly awk | ${HOME} then "$@" 2>/dev/null
+	&& 2>/dev/null sed sed 'quoted text'
+	| && awk export /usr/bin "$1" x=1 local sed readonly cd export printf
+awk export printf "$@" grep "$1" ${HOME} local done ${HOME} 2>/dev/null
+cd cd /usr/bin ${HOME} "$@" printf
+2>/dev/null printf test printf -eu --verbose
+		done then awk $(pwd) readonly ${HOME} echo "$@"
+	local test local -eu 'quoted text' 2>/dev/null grep -eu /usr/bin 2>/dev/null
+then --verbose --verbose
+		sed ${HOME} sed done ${HOME} test sed done $(pwd)
+		"$1" | "$1" x=1 && test export ${HOME} | local sed then /usr/bin
+	printf -eu test awk && sed
+	--verbose "$@" $(pwd) "$1" "$1" "$1" done done && | x=1 grep /usr/bin && && cd
+		2>/dev/null awk --verbose --verbose readonly export
+	readonly && ${HOME} test sed cd cd ${HOME} && ${HOME} x=1 test x=1 then test then
+		| ${HOME} printf echo x=1
+		test cd | "$1" export local then export $(pwd) && echo export -eu printf cd
+		export printf -eu echo x=1 echo cd sed readonly /usr/bin --verbose
+&& | ${HOME} test local readonly 2>/dev/null done grep echo
+| awk sed && -eu cd echo "$@" "$1" echo --verbose
+x=1 grep then $(pwd) "$1" --verbose test cd 2>/dev/null && local | sed printf
+grep ${HOME} x=1 'quoted text'
+readonly sed x=1 -eu then 'quoted text'
+	cd sed ${HOME} | local
+	&& 'quoted text' test export
+cd | printf sed local done x=1 && x=1 export printf then grep /usr/bin -eu
+		local local readonly "$@"
+grep --verbose --verbose then done cd ${HOME} && cd "$1" readonly
+"$@" printf printf "$@" x=1 | echo cd --verbose ${HOME}
+	done echo sed "$1" 'quoted text' x=1
+	$(pwd) ${HOME} readonly local
+	--verbose "$@" -eu readonly && "$1" | -eu export $(pwd) "$1" grep printf | ${HOME}
+	grep $(pwd) 2>/dev/null done 'quoted text'
+| ${HOME} export export 'quoted text'
+'quoted text' x=1 sed $(pwd) then
+2>/dev/null done 2>/dev/null "$@" readonly "$1" cd $(pwd) sed done -eu 'quoted text'
+		readonly export sed readonly done -eu test awk printf
+	"$@" readonly $(pwd) local local awk grep
+	${HOME} "$1" -eu -eu awk
+		test "$@" printf --verbose | | && done echo 'quoted text' cd test x=1 grep readonly
+	x=1 then printf cd "$1" export
+	echo done test export /usr/bin ${HOME}
+	&& 'quoted text' x=1 ${HOME} local echo export sed sed 2>/dev/null && "$@" awk
+local grep | 'quoted text'
+		sed grep done ${HOME} | && done test -eu awk readonly "$1" local
+'quoted text' | grep -eu /usr/bin 2>/dev/null ${HOME} x=1 x=1 /usr/bin &&
+	2>/dev/null echo local -eu "$1" printf $(pwd) readonly echo grep done echo local
+grep sed /usr/bin "$@" sed "$@" grep cd test echo
+sed -eu echo sed readonly awk 2>/dev/null local "$@" local ${HOME} echo readonly
+grep export test 2>/dev/null test awk printf local
+	| done printf printf /usr/bin ${HOME} printf readonly readonly done x=1
+		'quoted text' export awk local cd 2>/dev/null -eu
+	-eu | 2>/dev/null local
+readonly printf | export "$@" printf -eu "$@" "$1" printf | then $(pwd)
+	echo printf local echo done awk done done --verbose 'quoted text'
+	--verbose --verbose export 'quoted text' ${HOME} /usr/bin
+export "$@" readonly export | sed sed x=1 && $(pwd) ${HOME} export done
+		/usr/bin awk -eu && | "$1" "$@" grep cd 2>/dev/null
+export sed /usr/bin -eu local awk -eu echo printf | cd printf --verbose
+	"$1" awk "$@" printf && /usr/bin
+		grep readonly -eu --verbose -eu -eu echo local
+	done readonly "$1" done
+		done awk printf -eu export cd echo printf export
+printf awk sed ${HOME} grep local readonly /usr/bin && -eu local /usr/bin echo then
+sed $(pwd) && $(pwd) "$1" -eu awk
+		| cd "$1" /usr/bin local local sed awk done cd grep cd 'quoted text' -eu
+test printf 2>/dev/null grep ${HOME} x=1 --verbose test
+export x=1 ${HOME} local | cd x=1 -eu done
+-eu awk printf awk x=1 ${HOME} $(pwd) /usr/bin --verbose
+	x=1 local awk | awk "$1" "$@"
+	sed "$1" grep --verbose export local "$1" readonly "$1" cd sed cd printf test
+	export awk local 'quoted text'
+		$(pwd) awk | grep then sed | local --verbose --verbose -eu
+	--verbose awk -eu export then sed "$1" export echo 'quoted text'
+	--verbose --verbose echo
+2>/dev/null done awk /usr/bin awk export cd
+awk cd grep x=1 $(pwd) --verbose echo test awk awk awk "$1" "$@" then done
+/usr/bin sed $(pwd) $(pwd) $(pwd)
+		readonly "$@" ${HOME} --verbose
+then x=1 "$1" -eu export done then 2>/dev/null -eu then local "$@" ${HOME} "$1"
+		"$1" done awk 'quoted text' printf awk 'quoted text' readonly
+		export | readonly grep 'quoted text' awk
+${HOME} | then local ${HOME}
+	done | cd | export echo -eu echo sed "$@" -eu /usr/bin
+x=1 then -eu "$1" grep x=1 printf /usr/bin /usr/bin 'quoted text' $(pwd) sed grep
+sed "$1" x=1 then local local 'quoted text'
+	--verbose --verbose x=1 awk
+		$(pwd) -eu $(pwd) cd echo && | ${HOME} awk && cd --verbose
+		then grep readonly then 2>/dev/null 2>/dev/null 'quoted text'
+	grep local | sed && "$@" done
+2>/dev/null grep x=1 local
+		-eu awk then sed grep x=1 local test grep local /usr/bin test
+	awk cd "$@" sed x=1 cd readonly sed "$1"
+	cd export then test echo --verbose done cd $(pwd) export then x=1 -eu
+$(pwd) export printf printf done $(pwd) local
+	local grep export | local local
+		awk && grep sed then | test 2>/dev/null && cd local done sed /usr/bin && x=1
+$(pwd) printf test printf | x=1 && readonly echo /usr/bin sed test then
+${HOME} "$@" then /usr/bin cd --verbose ${HOME} /usr/bin
+2>/dev/null sed | done done awk 2>/dev/null x=1 $(pwd) 2>/dev/null
+	readonly sed export cd 2>/dev/null | 2>/dev/null 'quoted text' cd
+		&& 2>/dev/null "$@" local
+	&& -eu echo && x=1 then -eu sed export
+	readonly sed awk awk | grep $(pwd) grep /usr/bin /usr/bin
+'quoted text' then sed x=1 /usr/bin &&
+"$@" x=1 "$@" done export | /usr/bin cd 2>/dev/null export -eu cd cd
+		sed 2>/dev/null "$1" sed -eu $(pwd)
+&& test ${HOME} ${HOME} grep test && readonly awk
+		--verbose && x=1 done cd sed awk /usr/bin | sed 2>/dev/null printf |
+sed cd awk awk test cd x=1 ${HOME} test
+awk 'quoted text' "$@" "$1" $(pwd) 2>/dev/null
+		local done 'quoted text' -eu export "$1" awk && "$1" test
+	x=1 done x=1 "$1" -eu 2>/dev/null then -eu x=1 readonly
+		test echo echo awk ${HOME} printf
+${HOME} 'quoted text' export local grep && /usr/bin ${HOME}
+		done echo 2>/dev/null done export test "$@" echo
+echo done grep awk ${HOME} "$1" awk x=1 done
+		readonly /usr/bin printf
+	sed x=1 grep awk /usr/bin export $(pwd) $(pwd) then
+		done sed cd --verbose echo readonly done
+		cd 'quoted text' printf done sed "$1" echo /usr/bin echo printf && x=1 local awk
+"$1" && done 2>/dev/null grep then ${HOME}
+		readonly ${HOME} 'quoted text' 2>/dev/null
+	'quoted text' sed local export $(pwd) $(pwd) echo export && then /usr/bin 'quoted text'
+	done sed local readonly --verbose test --verbose
+x=1 && 'quoted text' cd cd 2>/dev/null sed cd printf readonly
+		${HOME} 'quoted text' cd then readonly done 2>/dev/null
+grep awk 'quoted text' readonly 'quoted text' done ${HOME} 'quoted text' grep sed
+		sed readonly local cd
+-eu && done 2>/dev/null printf awk awk --verbose awk 'quoted text'
+	-eu -eu export "$1" cd export /usr/bin
+&& /usr/bin printf && x=1 "$@" printf 'quoted text'
+export test then echo test "$1" 'quoted text' grep then cd x=1 printf
+		${HOME} then awk then -eu ${HOME} done $(pwd) export test sed then sed printf
+/usr/bin grep /usr/bin /usr/bin done printf --verbose --verbose
+	then "$1" test "$@" local --verbose cd && then local x=1
+done cd ${HOME} x=1 ${HOME} readonly "$1" "$@"
+		grep /usr/bin | export "$@" -eu "$@" grep cd 'quoted text' grep readonly $(pwd)
+sed 2>/dev/null awk echo test | cd "$@" 'quoted text' grep
+	export $(pwd) --verbose ${HOME} export local local test x=1 "$1" done
+		$(pwd) /usr/bin then $(pwd) done "$@" 2>/dev/null
+export && awk then awk cd 'quoted text'
+		x=1 awk cd "$@" cd awk echo readonly "$@" readonly 'quoted text'
+test /usr/bin printf local && cd echo $(pwd)
+		grep --verbose export test 2>/dev/null printf --verbose
+		grep done $(pwd) $(pwd) grep "$@" local x=1 $(pwd) printf sed | grep
+/usr/bin -eu "$@" x=1 export then | "$@" grep "$@"
+	grep then cd "$1" ${HOME}
+	sed printf --verbose local && cd ${HOME} | then /usr/bin local
+	then --verbose $(pwd) test /usr/bin
+'quoted text' sed --verbose 2>/dev/null --verbose awk "$1"
+$(pwd) ${HOME} --verbose "$1" awk readonly && $(pwd) "$1" test 'quoted text' -eu
+		/usr/bin grep printf && $(pwd) && export
+	${HOME} "$@" sed | echo ${HOME} ${HOME} readonly then local export
+		/usr/bin --verbose 2>/dev/null
+grep sed 'quoted text' 'quoted text' local /usr/bin -eu
+		"$@" ${HOME} echo -eu then then then | /usr/bin 2>/dev/null test && --verbose
+done --verbose "$@" 'quoted text' /usr/bin
+		sed "$1" -eu then awk test grep then sed && && local
+		export cd readonly awk echo printf x=1 echo local --verbose
+	export $(pwd) 'quoted text' /usr/bin 'quoted text' | then grep sed
+done /usr/bin awk echo done 'quoted text' then && printf local grep done local
+--verbose && /usr/bin then local x=1 ${HOME} -eu done cd && awk --verbose
+		x=1 done "$@" ${HOME} then x=1 ${HOME}
+	awk echo $(pwd) /usr/bin grep | $(pwd) local readonly test cd then sed
+		&& local && sed x=1 && x=1 printf | 'quoted text' /usr/bin && ${HOME}
+		then x=1 -eu && sed printf --verbose
+	readonly awk 'quoted text'
+		then ${HOME} done grep 2>/dev/null readonly
+	cd echo done done /usr/bin "$1" grep /usr/bin grep test test "$1" --verbose
+local cd cd printf done
+--verbose local x=1 export | test
+	local readonly cd echo $(pwd) --verbose
+export readonly x=1 printf test $(pwd) test -eu cd awk readonly 'quoted text' |
+"$@" sed then -eu awk 2>/dev/null echo test
+		/usr/bin printf ${HOME} awk local --verbose
+		&& --verbose $(pwd) sed
+	export cd export then 2>/dev/null sed export sed awk x=1 grep --verbose then
+	/usr/bin readonly -eu "$@" "$1"
+'quoted text' printf then /usr/bin cd
+	"$@" cd 'quoted text' ${HOME} echo $(pwd) /usr/bin
+		--verbose printf readonly export
+	2>/dev/null ${HOME} -eu test cd echo && && test test test
+		then ${HOME} readonly | then sed printf readonly 'quoted text' --verbose 'quoted text'
+'quoted text' readonly 'quoted text' sed ${HOME} echo && echo | local
+cd "$@" then test && readonly $(pwd) "$@" local
+		x=1 2>/dev/null x=1 local | export printf && echo x=1 && local
+| sed x=1 printf ${HOME} 'quoted text' then done
+	sed --verbose /usr/bin test $(pwd) test
+x=1 grep echo export "$1" --verbose awk $(pwd)
+	awk "$@" 2>/dev/null readonly readonly /usr/bin echo -eu $(pwd) "$@" "$1"
+		$(pwd) 'quoted text' ${HOME} done
+	x=1 "$1" --verbose printf
+export done cd test then grep sed /usr/bin awk local sed cd echo
+		"$1" --verbose /usr/bin $(pwd) echo
@@ -0,0 +1,2001 @@
+	export ${HOME} $(pwd) test
+		local test | awk echo readonly $(pwd) cd ${HOME}
+		&& cd export "$@" --verbose cd cd ${HOME} /usr/bin x=1 printf 2>/dev/null
+		$(pwd) x=1 2>/dev/null then then awk 'quoted text' grep 2>/dev/null "$1" printf
+	readonly cd ${HOME} echo printf /usr/bin 'quoted text'
+cd cd ${HOME} ${HOME} printf printf "$1" grep "$1" echo --verbose readonly $(pwd)
+'quoted text' done "$1" ${HOME} then "$@" ${HOME} 'quoted text'
+--verbose ${HOME} sed readonly -eu done echo x=1 'quoted text' --verbose ${HOME}
+| && then "$1" done && /usr/bin test /usr/bin /usr/bin $(pwd) sed
+test local --verbose && -eu x=1 "$@" local -eu test printf
+	test test --verbose "$@" test
+x=1 done cd && cd "$@" /usr/bin grep "$1" local
+	sed x=1 readonly printf /usr/bin x=1 export $(pwd) ${HOME} && ${HOME} then
+	test /usr/bin awk 2>/dev/null
+		grep done $(pwd) grep "$@" x=1 "$@" then cd grep
+--verbose test "$1" $(pwd) grep $(pwd) sed $(pwd)
+'quoted text' readonly readonly grep local export
+		grep export readonly ${HOME} --verbose awk
+	readonly && | ${HOME} x=1 cd | export ${HOME}
+		&& ${HOME} readonly echo test printf then
+		readonly --verbose echo echo local /usr/bin export
+	test | | "$@" done test --verbose then /usr/bin then export
+	sed local ${HOME} echo --verbose export "$1" export "$@" local
+		"$@" echo grep cd printf "$@" "$1" readonly ${HOME} "$1" then export 2>/dev/null
+printf && x=1 cd | /usr/bin
+		/usr/bin "$1" test sed --verbose
+		printf printf cd awk 'quoted text' | 'quoted text' printf "$@" -eu
+"$1" sed done grep 'quoted text' then "$@" | then
+sed && grep | cd && /usr/bin readonly echo
+$(pwd) "$1" 2>/dev/null 'quoted text' 2>/dev/null local
+	'quoted text' sed export | local awk test ${HOME} grep
+	echo "$@" "$@" local test export ${HOME}
+		${HOME} && awk --verbose 2>/dev/null sed local -eu
+done echo printf "$@" then readonly echo && readonly
+	awk --verbose "$@" grep "$@" export 2>/dev/null "$@" | --verbose
+	${HOME} && ${HOME} 'quoted text' 2>/dev/null then then echo ${HOME}
+	awk sed grep then $(pwd) 2>/dev/null printf ${HOME} done awk test 'quoted text'
+'quoted text' 'quoted text' /usr/bin
+	x=1 sed test awk printf "$@" done then x=1 cd done readonly export
+test 2>/dev/null | export && | 'quoted text' then "$1" awk sed "$@" awk
+		test ${HOME} /usr/bin grep 'quoted text' done printf printf
+	| test echo sed ${HOME} /usr/bin 2>/dev/null awk readonly $(pwd) then
+		'quoted text' done 2>/dev/null "$@" $(pwd)
+	$(pwd) readonly readonly grep
+	/usr/bin --verbose then && export echo awk | printf | cd && echo && -eu /usr/bin
+readonly cd | grep export 'quoted text' export && x=1 'quoted text' --verbose
+		echo then ${HOME} printf cd 'quoted text' "$1" ${HOME} local
+	2>/dev/null && "$1" local -eu cd local done echo /usr/bin
+		'quoted text' echo done cd grep local && then readonly 'quoted text' && "$@" local
+	readonly echo done printf
+cd ${HOME} 2>/dev/null && done 2>/dev/null then --verbose
+${HOME} done awk local done $(pwd) x=1 --verbose ${HOME}
+		done "$@" done 'quoted text' $(pwd) echo
+	then $(pwd) test --verbose awk && ${HOME} local echo | printf 'quoted text'
+'quoted text' sed awk grep -eu export export 2>/dev/null /usr/bin awk
+	/usr/bin sed x=1 cd readonly | test cd
+sed /usr/bin | done printf 2>/dev/null then echo $(pwd) local -eu then $(pwd) ${HOME}
+		$(pwd) x=1 | "$1" /usr/bin
+printf then $(pwd) grep | "$@" "$1" grep
+	x=1 "$@" && 'quoted text' echo 2>/dev/null ${HOME} 2>/dev/null readonly awk
+		echo local readonly 2>/dev/null 'quoted text' 'quoted text'
+-eu 'quoted text' $(pwd) grep 'quoted text' "$1" export x=1
+printf -eu /usr/bin test x=1 grep cd ${HOME} printf
+readonly -eu awk test test then echo sed echo 2>/dev/null /usr/bin then
+	awk printf local cd cd ${HOME} grep cd printf grep /usr/bin
+		export printf 2>/dev/null then local awk echo $(pwd) /usr/bin
+	"$@" ${HOME} done ${HOME} then local local local readonly echo
+	echo $(pwd) "$@" /usr/bin 2>/dev/null
+	2>/dev/null /usr/bin x=1 "$1" echo readonly awk && grep $(pwd) && done
+	-eu --verbose && then /usr/bin local x=1
+		"$@" x=1 readonly awk echo test x=1 "$@" awk then "$@" 'quoted text'
+	-eu 'quoted text' test -eu $(pwd) awk then
+	cd sed && x=1 then export sed echo awk -eu 2>/dev/null
+	awk test | then -eu printf done | export 'quoted text' "$1" readonly
+		"$1" 2>/dev/null grep export && 'quoted text' then
+		&& 2>/dev/null ${HOME} 'quoted text' $(pwd)
+		done local $(pwd) readonly $(pwd) sed export echo /usr/bin
+	readonly -eu /usr/bin grep done --verbose test /usr/bin echo then "$@" 2>/dev/null
+/usr/bin then ${HOME} then x=1 readonly && done sed ${HOME} done printf --verbose
+	--verbose export $(pwd) "$@" 'quoted text' | "$@" && test readonly
+test x=1 x=1 /usr/bin printf 2>/dev/null printf export done sed
+	sed -eu export -eu x=1 && "$@" test /usr/bin
+	done "$@" $(pwd) readonly printf "$1" --verbose then echo /usr/bin local
+test sed grep grep $(pwd) done | done grep 'quoted text'
+"$@" -eu cd --verbose ${HOME} 'quoted text' ${HOME} --verbose $(pwd) local
+	x=1 ${HOME} local cd printf -eu readonly 2>/dev/null local
+		-eu "$1" /usr/bin export done done && cd awk x=1 /usr/bin
+		&& x=1 export printf 2>/dev/null test $(pwd) x=1 echo 'quoted text'
+	test x=1 printf --verbose then echo sed 'quoted text'
+		&& "$@" $(pwd) done then ${HOME} 2>/dev/null
+	x=1 awk then -eu x=1 done
+done export readonly printf cd x=1 | "$@" then awk /usr/bin ${HOME} x=1 grep
+'quoted text' 2>/dev/null echo && 2>/dev/null export sed readonly | 2>/dev/null
+		-eu cd 2>/dev/null -eu $(pwd) && then echo sed sed 2>/dev/null 2>/dev/null
+		sed $(pwd) x=1 test /usr/bin done cd x=1 x=1 then sed
+		printf ${HOME} $(pwd) $(pwd) ${HOME} then grep done --verbose
+		test done readonly then 'quoted text' x=1 sed echo x=1 'quoted text'
+		-eu | local printf sed grep readonly test local $(pwd) done -eu
+| local grep 'quoted text' -eu awk x=1 then cd echo
+		local sed export | ${HOME} "$1" "$1" readonly test "$1" 'quoted text' -eu awk
+		echo | && test && | grep && x=1 'quoted text' && "$1" done export
+		x=1 'quoted text' 2>/dev/null --verbose "$1" 'quoted text'
+	"$1" | grep 'quoted text' done sed sed
+	then "$1" "$1" grep awk cd 'quoted text' 2>/dev/null
+--verbose -eu && local 'quoted text' | cd done done 2>/dev/null -eu local export
+printf awk $(pwd) 2>/dev/null printf --verbose
+		2>/dev/null | && $(pwd) -eu x=1 x=1
+	cd /usr/bin && grep 2>/dev/null echo sed "$@" sed export
+		cd 2>/dev/null "$1" | && cd --verbose awk "$1" cd sed readonly
+	awk cd $(pwd) 2>/dev/null 'quoted text' ${HOME}
+	grep /usr/bin cd ${HOME} cd grep "$1" 'quoted text'
+	2>/dev/null export x=1 local | --verbose x=1 export
+printf readonly 2>/dev/null 'quoted text' done done "$1" export
+		-eu echo readonly test ${HOME} | grep cd then export sed "$1" cd
+		echo printf /usr/bin --verbose then 2>/dev/null "$1" 'quoted text' -eu
+	/usr/bin export x=1 cd grep then -eu "$1" readonly -eu local readonly /usr/bin
+		| echo 'quoted text' | grep -eu
+grep then $(pwd) sed /usr/bin x=1 && x=1 test "$1" 'quoted text'
+		&& then done test 'quoted text' && done /usr/bin ${HOME} "$@" local cd export
+	test done sed -eu readonly "$@" "$1" then test 'quoted text'
+		"$@" awk -eu sed export cd ${HOME} readonly readonly then test export
+x=1 awk local 2>/dev/null && "$@" grep
+--verbose cd && -eu local "$1"
+	&& grep awk sed x=1 echo /usr/bin echo test
+		sed x=1 /usr/bin readonly ${HOME} grep 'quoted text' $(pwd) export
+		printf printf --verbose cd 2>/dev/null 'quoted text' export
+		| sed test printf then $(pwd) readonly readonly --verbose --verbose
+	done readonly "$@" sed grep cd
+	"$1" awk printf printf echo grep cd export test /usr/bin
+		cd awk /usr/bin test readonly ${HOME} /usr/bin test $(pwd) then
+		&& ${HOME} ${HOME} && echo readonly --verbose && printf "$1" local /usr/bin
+		readonly -eu 'quoted text' /usr/bin
+&& grep ${HOME} && export export printf --verbose -eu echo
+		test && $(pwd) cd /usr/bin "$@" -eu done /usr/bin local readonly
+	&& printf awk 2>/dev/null --verbose
+	"$1" test 'quoted text' cd && 2>/dev/null "$1" --verbose
+'quoted text' awk awk export $(pwd) 'quoted text' readonly sed -eu "$@"
+--verbose done done test cd test cd | then test then "$1" ${HOME}
+awk printf sed sed done
+		"$@" /usr/bin then 'quoted text' export
+		| grep grep test --verbose 'quoted text' awk "$1" $(pwd) $(pwd) 'quoted text'
+		local echo "$@" local ${HOME} 'quoted text' /usr/bin grep -eu
+x=1 awk grep ${HOME} /usr/bin
+		-eu /usr/bin "$@" "$1" 2>/dev/null then "$1" | /usr/bin test done then awk
+	x=1 local x=1 test 'quoted text' awk grep test --verbose 'quoted text'
+	local sed $(pwd) 'quoted text' ${HOME} local cd 'quoted text'
+	then --verbose /usr/bin
+	--verbose readonly echo "$1" echo awk done awk printf x=1
+"$@" ${HOME} 2>/dev/null
+test then printf "$@" cd && "$1" | x=1 sed export | && local $(pwd) x=1 $(pwd)
+	"$@" 'quoted text' cd echo done 'quoted text' "$1" readonly export
+		cd export export $(pwd) && 2>/dev/null && 'quoted text'
+"$1" then --verbose local then cd test | /usr/bin readonly
+$(pwd) && --verbose printf cd ${HOME} -eu sed 'quoted text' "$1" readonly
+	--verbose test sed | then cd /usr/bin && cd readonly
+		sed grep done 'quoted text' --verbose done echo cd "$@" awk
+	x=1 local test x=1 readonly | grep 'quoted text' done
+	| echo ${HOME} -eu grep local
+	$(pwd) test --verbose $(pwd) then done /usr/bin && 'quoted text' test
+		local --verbose test /usr/bin $(pwd) done --verbose export
+		echo | -eu | ${HOME} export readonly /usr/bin echo printf echo
+"$@" done then "$@" -eu grep /usr/bin local sed readonly
+	&& 'quoted text' done x=1 "$@" awk | readonly echo printf 'quoted text'
+'quoted text' local grep cd && test test sed && then 2>/dev/null "$1"
+then && awk --verbose export test local 'quoted text' done
+	${HOME} $(pwd) | readonly
+	grep test x=1 then && x=1 "$1" cd sed
+--verbose && 2>/dev/null x=1 awk --verbose awk 2>/dev/null readonly --verbose
+	test -eu && sed grep local
+/usr/bin -eu x=1 printf readonly
+	/usr/bin printf printf printf done done cd "$@" readonly ${HOME} grep
+	-eu 'quoted text' $(pwd) && -eu export && sed
+		'quoted text' local $(pwd) then |
+&& | test sed echo --verbose "$@"
+		echo "$1" grep "$1" done "$@" --verbose grep cd 2>/dev/null readonly
+done echo x=1 x=1 done "$@" then /usr/bin /usr/bin 2>/dev/null then
+export local echo 'quoted text' --verbose export ${HOME} awk sed /usr/bin local
+test ${HOME} local x=1 then "$1" $(pwd) local "$1" export grep then &&
+| awk then readonly sed export local awk done printf x=1 cd
+		"$@" ${HOME} "$1" printf readonly /usr/bin /usr/bin ${HOME} $(pwd)
+--verbose && 'quoted text'
+	readonly x=1 -eu local grep 'quoted text' grep $(pwd)
+	grep echo export then x=1 | test awk -eu -eu awk x=1 then sed awk echo
+	test sed --verbose 2>/dev/null --verbose /usr/bin
+	export export readonly
+| | awk test 'quoted text' /usr/bin x=1
+	"$@" /usr/bin test ${HOME} "$1" then printf sed
+'quoted text' cd "$1" -eu then /usr/bin done "$1" ${HOME} echo local "$1"
+		local grep && --verbose echo && ${HOME} grep
+test | "$1" x=1 ${HOME} && then $(pwd) /usr/bin -eu 2>/dev/null
+	x=1 readonly 'quoted text' 2>/dev/null echo $(pwd)
+${HOME} "$@" readonly done 2>/dev/null echo readonly
+test test | echo echo grep grep sed done cd grep "$1" sed /usr/bin ${HOME} --verbose
+		'quoted text' -eu ${HOME} done awk awk readonly done "$1" echo echo sed echo
+		cd readonly then && "$1" awk
+	export sed $(pwd) cd 'quoted text' echo readonly awk && sed --verbose
+		${HOME} "$@" grep readonly done cd | awk
+	then cd export awk "$1" grep
+		then --verbose export /usr/bin
+	local echo printf local | printf echo local /usr/bin
+grep then echo local | "$@" awk /usr/bin 'quoted text' "$1" 'quoted text' printf
+		grep grep -eu -eu export local test x=1 && $(pwd) sed echo
+${HOME} $(pwd) ${HOME} done "$@" readonly test printf "$1" cd sed
+| printf -eu echo export | ${HOME} "$1" then local
+	test --verbose --verbose | 2>/dev/null "$@" cd grep sed local "$1" 'quoted text'
+		2>/dev/null -eu 'quoted text' printf then
+cd test test test /usr/bin cd then grep --verbose export grep && |
+cd then "$1" "$@" | test printf && /usr/bin test done done 'quoted text'
+	-eu -eu then $(pwd) export test done grep grep printf grep export
+	2>/dev/null cd cd && x=1 2>/dev/null 2>/dev/null test
+		test /usr/bin cd then then | grep local $(pwd) sed cd ${HOME} --verbose
+		"$@" readonly "$@" cd --verbose printf local local export -eu "$1" |
+	test cd printf 'quoted text'
+${HOME} $(pwd) test "$@" done test "$1" /usr/bin --verbose sed echo grep
+		"$@" echo echo done test printf && cd "$@" $(pwd) export
+	&& --verbose local -eu 'quoted text' grep cd x=1 echo then
+	cd -eu printf cd 2>/dev/null echo awk then sed 'quoted text'
+	printf done ${HOME} 2>/dev/null readonly --verbose
+	test then grep printf then 2>/dev/null then 'quoted text'
+	export $(pwd) cd echo /usr/bin export
+	&& sed awk -eu sed $(pwd) test && done
+"$1" export | done --verbose test local then ${HOME}
+done | done "$1" sed echo -eu awk "$@" -eu --verbose awk && 'quoted text'
+	local ${HOME} local && /usr/bin echo echo
+'quoted text' echo done "$@" | /usr/bin echo ${HOME}
+	echo /usr/bin $(pwd) ${HOME} /usr/bin
+local grep 2>/dev/null | | sed then sed done grep
+&& && --verbose x=1 done 2>/dev/null test awk $(pwd) | && sed --verbose
+		-eu --verbose --verbose done 2>/dev/null echo "$1" &&
+done 'quoted text' export export /usr/bin local
+		$(pwd) sed -eu export printf "$@" | readonly
+	export grep && echo echo grep ${HOME}
+2>/dev/null /usr/bin 2>/dev/null grep awk local 'quoted text' awk
+	&& 2>/dev/null awk readonly cd grep local --verbose cd
+	"$1" done cd echo local done sed x=1 sed printf ${HOME} sed
+		2>/dev/null 2>/dev/null done then
+	"$1" cd done printf /usr/bin sed "$1" "$@" 2>/dev/null -eu sed printf
+	local printf grep ${HOME} -eu printf sed $(pwd) && cd
+		$(pwd) grep x=1 cd "$1" done
+	2>/dev/null cd readonly readonly 2>/dev/null && ${HOME}
+done cd then cd --verbose "$1" -eu && local -eu "$1" x=1 then grep --verbose
+export ${HOME} sed 'quoted text' ${HOME} echo cd
+	x=1 ${HOME} x=1 then awk $(pwd) ${HOME} && --verbose ${HOME} cd
+test $(pwd) "$@" grep 2>/dev/null grep $(pwd)
+sed done x=1 export ${HOME} /usr/bin
+export --verbose && /usr/bin 2>/dev/null /usr/bin export
+		then echo sed sed readonly readonly "$1"
+	2>/dev/null test $(pwd) done
+		echo ${HOME} "$@" then printf && cd $(pwd) -eu 2>/dev/null
+		| | grep export awk "$@" "$@" then local $(pwd) "$1" && done
+	awk -eu -eu readonly echo cd /usr/bin local 2>/dev/null
+		printf ${HOME} test grep | done | readonly done "$1" test 'quoted text'
+	readonly && | | then then && export "$1" local printf $(pwd) | test local local
+		-eu | export && then x=1 2>/dev/null | printf local 2>/dev/null readonly cd x=1
+		printf -eu "$@" echo awk echo
+	"$1" --verbose --verbose sed && x=1 &&
+	"$@" && "$1" --verbose "$1" sed printf "$@" /usr/bin
+	&& --verbose grep then "$1" readonly then export | 'quoted text'
+		"$@" ${HOME} export then x=1 --verbose export
+		'quoted text' && -eu $(pwd) export local readonly cd "$1"
+export test awk /usr/bin readonly
+	x=1 --verbose -eu test /usr/bin ${HOME} "$@" grep done awk printf x=1 cd sed
+		"$@" x=1 -eu then grep | 'quoted text' ${HOME}
+/usr/bin 2>/dev/null cd x=1 2>/dev/null "$1" export grep x=1 done
+	grep test printf 2>/dev/null test /usr/bin
+	export local --verbose && 2>/dev/null export cd
+		--verbose test -eu readonly then 'quoted text' && cd echo then printf test echo
+	/usr/bin sed printf echo $(pwd) sed x=1 'quoted text'
+	then export 'quoted text' grep grep "$1" awk readonly
+	${HOME} --verbose ${HOME} "$1" then printf
+	grep then | printf printf local then export
+	grep "$1" x=1 'quoted text' export awk done awk
+		test grep echo grep "$@" | grep "$@" x=1 /usr/bin test /usr/bin local "$1"
+&& test local then | test x=1 --verbose
+echo "$@" x=1 2>/dev/null then grep done |
+	cd 'quoted text' "$@" sed --verbose
+	test ${HOME} x=1 test cd
+	$(pwd) readonly printf | awk sed
+test readonly test echo /usr/bin awk /usr/bin awk -eu x=1 test
+sed test ${HOME} "$@" 2>/dev/null --verbose grep -eu
+	then 'quoted text' "$@" 'quoted text'
+local $(pwd) done "$1" done "$1" done test echo
+"$1" test sed | 'quoted text' && awk --verbose test 'quoted text' local
+awk "$1" | "$1" export then test then /usr/bin then
+	&& 'quoted text' -eu readonly --verbose 2>/dev/null sed echo /usr/bin
+	-eu test printf /usr/bin "$@" 'quoted text' -eu x=1
+/usr/bin "$1" $(pwd) awk 'quoted text' /usr/bin 2>/dev/null 2>/dev/null
+-eu cd /usr/bin echo && readonly | -eu "$1" --verbose export readonly echo
+		sed printf /usr/bin /usr/bin "$1" $(pwd) --verbose "$1" cd "$1" ${HOME} test
+		"$1" echo sed export | sed ${HOME} grep 'quoted text'
+		done cd ${HOME} then "$@" x=1 local printf then awk echo 'quoted text'
+		x=1 | x=1 sed && sed readonly awk printf echo
+		cd local export "$@" readonly local
+	"$@" then sed 2>/dev/null
+	grep "$@" readonly test 'quoted text'
+2>/dev/null cd readonly | 2>/dev/null local grep --verbose then && "$1" done
+	printf 2>/dev/null grep export x=1 $(pwd) done printf then export
+		| $(pwd) /usr/bin "$1" 2>/dev/null
+	$(pwd) export "$1" printf awk
+"$@" grep readonly done test
+--verbose ${HOME} test done "$1" $(pwd) readonly
+		| test sed readonly "$1" x=1 x=1 "$@" local | "$@" cd
+export grep ${HOME} 'quoted text' $(pwd)
+2>/dev/null -eu local then then
+${HOME} sed grep | readonly
+/usr/bin $(pwd) export then && cd awk then x=1 cd local
+printf export "$@" grep then -eu grep local
+		--verbose -eu 2>/dev/null local x=1 2>/dev/null
+		/usr/bin local grep printf -eu -eu /usr/bin local -eu "$1" --verbose
+		test printf 'quoted text' then done export
+/usr/bin --verbose sed | "$1" ${HOME} awk done done sed
+		readonly && 2>/dev/null && 'quoted text' "$@" /usr/bin echo
+	test test $(pwd) 'quoted text' x=1 printf | awk 2>/dev/null
+		sed && 'quoted text' | echo -eu sed awk export 2>/dev/null printf "$1"
+	test && 2>/dev/null awk printf local | "$1" "$@" sed 'quoted text'
+		local grep then "$1" done echo "$@" awk
+	--verbose test awk awk && export test $(pwd)
+readonly --verbose /usr/bin readonly printf /usr/bin /usr/bin echo awk
+		"$@" 'quoted text' 'quoted text'
+		sed $(pwd) $(pwd) sed readonly --verbose echo readonly -eu
+&& 'quoted text' "$@" 'quoted text' sed export ${HOME} then done sed
+	cd done local ${HOME} done ${HOME} test test
+2>/dev/null done | printf
+		export done --verbose 'quoted text'
+		$(pwd) local 2>/dev/null cd "$1"
+	readonly | cd | 2>/dev/null | 'quoted text' echo 2>/dev/null -eu export
+		sed 'quoted text' | then
+done "$1" cd readonly
+	-eu "$@" 'quoted text' test --verbose
+		$(pwd) && local $(pwd) cd 'quoted text'
+	'quoted text' awk cd
+		"$1" && $(pwd) awk test local test sed
+		grep /usr/bin test awk done echo /usr/bin && && echo $(pwd) "$1" awk awk ${HOME}
+then x=1 test readonly awk awk
+echo /usr/bin -eu $(pwd) grep grep test ${HOME}
+	then "$@" /usr/bin /usr/bin printf local 'quoted text'
+	$(pwd) grep -eu ${HOME} "$1" awk readonly cd ${HOME}
+done "$1" "$1" --verbose test | readonly "$1" | "$1" x=1 |
+		${HOME} x=1 sed local "$1" echo
+		sed printf --verbose 'quoted text' done
+		export echo | "$1" export -eu | cd 2>/dev/null done 'quoted text' then
+	2>/dev/null ${HOME} sed export then 2>/dev/null
+		cd test awk 2>/dev/null $(pwd) && local local grep
+		"$1" grep export $(pwd) "$@"
+grep done ${HOME} ${HOME} "$@" "$1"
+	awk --verbose local awk "$1" && sed x=1 "$1" done cd done local done sed then $(pwd)
+	done "$1" then echo grep -eu local test $(pwd) awk local ${HOME} x=1 ${HOME} echo
+	&& --verbose then -eu grep "$@" export $(pwd) --verbose
+		test "$@" export 2>/dev/null -eu echo awk "$@" export &&
+	&& | -eu /usr/bin "$@" export | -eu && x=1 export test 2>/dev/null
+		then sed "$1" -eu printf echo && $(pwd) readonly ${HOME}
+	--verbose local cd export local --verbose "$@"
+	--verbose awk "$1" then local && /usr/bin
+	&& printf "$@" local "$@" printf export
+	"$@" done --verbose && --verbose test test sed local local printf sed
+		"$@" test --verbose x=1 'quoted text' -eu printf grep && -eu 'quoted text'
+	local && "$@" readonly
+	test /usr/bin test $(pwd)
+		readonly 'quoted text' 'quoted text' export /usr/bin /usr/bin grep
+grep export && echo && printf 2>/dev/null
+2>/dev/null then done "$@" 2>/dev/null
+		-eu cd printf --verbose awk
+		local local $(pwd) sed then /usr/bin
+readonly sed --verbose ${HOME} then readonly --verbose test
+	sed readonly local 'quoted text' /usr/bin 2>/dev/null
+		sed then --verbose /usr/bin 2>/dev/null
+		awk then -eu echo --verbose 2>/dev/null export local "$1" done $(pwd)
+		sed 'quoted text' cd sed ${HOME} 2>/dev/null "$1" cd
+	then "$@" "$1" | | awk $(pwd) cd sed test test &&
+test "$@" printf local $(pwd) "$1" done
+	${HOME} "$1" export 2>/dev/null
+		done /usr/bin readonly -eu $(pwd) export x=1 && test ${HOME} /usr/bin
+		readonly 'quoted text' done 'quoted text'
+		echo printf 'quoted text' $(pwd) export printf test ${HOME}
+test ${HOME} test done && export "$1" awk sed "$@"
+$(pwd) then sed test /usr/bin printf ${HOME} x=1 cd awk /usr/bin -eu
+	export cd -eu | cd -eu readonly cd | export printf && printf "$1" 'quoted text'
+then readonly $(pwd) local /usr/bin && awk 2>/dev/null
+	awk /usr/bin x=1 && -eu printf sed readonly
+2>/dev/null --verbose 2>/dev/null
+&& grep 2>/dev/null done 'quoted text' printf ${HOME} x=1 'quoted text'
+'quoted text' --verbose "$@"
+		-eu readonly cd && ${HOME} /usr/bin cd ${HOME} -eu -eu && | -eu x=1
+		readonly readonly x=1 | test
+	/usr/bin "$@" awk --verbose test 'quoted text'
+-eu echo done done awk then | /usr/bin
+		$(pwd) test local local readonly /usr/bin "$@" test then export cd grep
+	$(pwd) 2>/dev/null 'quoted text'
+&& awk --verbose | /usr/bin test x=1 awk | 2>/dev/null /usr/bin
+"$@" && printf "$@" ${HOME} grep done --verbose 2>/dev/null "$1" $(pwd)
+		-eu test && readonly grep then | 'quoted text' cd 'quoted text'
+		test /usr/bin grep ${HOME} done sed test -eu printf 2>/dev/null test
+		--verbose "$1" local done export | "$@" local 2>/dev/null
+		echo --verbose local then ${HOME} cd awk then echo
+		"$1" -eu | sed 2>/dev/null local | -eu readonly x=1 awk grep "$@" ${HOME}
+	sed 2>/dev/null readonly test
+	x=1 "$1" done 2>/dev/null /usr/bin
+		--verbose && awk 2>/dev/null test 'quoted text' ${HOME} | --verbose x=1 test sed
+		printf x=1 awk then printf /usr/bin
+-eu && sed readonly $(pwd) "$1" ${HOME} | local then -eu "$1" 2>/dev/null
+grep -eu ${HOME} echo test
+		2>/dev/null grep export --verbose awk sed cd grep "$1" "$@" "$@" printf
+		local test then 'quoted text' 'quoted text'
+		/usr/bin && export echo
+		/usr/bin printf | sed then
+		--verbose --verbose --verbose "$1" ${HOME} echo
+	done cd cd ${HOME} grep "$1"
+	sed 'quoted text' --verbose ${HOME} grep 2>/dev/null awk 'quoted text'
+	| local 2>/dev/null readonly readonly sed -eu local
+${HOME} ${HOME} echo ${HOME} awk "$@" sed | "$@"
+echo --verbose "$@" readonly done | cd
+--verbose /usr/bin echo $(pwd) printf echo
+2>/dev/null /usr/bin && printf 2>/dev/null
+echo test --verbose "$@" local then echo
+grep then 'quoted text' "$@" grep sed
+-eu test done $(pwd) | readonly done
+		$(pwd) awk && $(pwd) 2>/dev/null echo then
+	'quoted text' cd echo local $(pwd)
+then x=1 printf x=1 export "$@" sed printf echo done
+	readonly printf 'quoted text' done echo cd &&
+-eu | && awk /usr/bin x=1 'quoted text' cd then "$1" sed "$1" "$1"
+--verbose x=1 $(pwd) "$@" sed readonly sed $(pwd) then readonly
+	"$1" cd 2>/dev/null --verbose /usr/bin
+		$(pwd) awk ${HOME} "$1" test export
+sed echo && echo printf $(pwd) readonly export 2>/dev/null test
+x=1 && printf echo then readonly readonly | readonly 'quoted text'
+		printf then cd --verbose cd | test --verbose /usr/bin grep
+		--verbose -eu x=1 -eu readonly grep | && && 2>/dev/null printf readonly test
+$(pwd) sed readonly printf 'quoted text'
+		printf x=1 $(pwd) /usr/bin then cd --verbose sed done
+		printf && printf local awk done && export local /usr/bin awk | && --verbose sed
+| awk 'quoted text' $(pwd)
+		test test test 2>/dev/null awk "$@" test
+		| echo readonly --verbose grep local | echo local --verbose "$@" cd grep grep
+	then printf "$1" "$1" export $(pwd) printf /usr/bin echo
+readonly x=1 printf cd export /usr/bin -eu "$@"
+		x=1 done && --verbose -eu x=1 test
+	${HOME} x=1 test grep readonly printf
+&& then grep then echo ${HOME} "$1" then awk
+	echo $(pwd) 2>/dev/null x=1
+grep printf then then /usr/bin
+cd && /usr/bin done 2>/dev/null echo printf ${HOME} test "$@" $(pwd)
+		then local then x=1 "$1" "$@" grep
+echo cd | sed readonly sed sed sed sed ${HOME} $(pwd) done /usr/bin x=1 | export
+	&& done /usr/bin sed --verbose
+	awk | "$@" | ${HOME} && -eu done test echo printf awk echo cd "$@" test echo
+	-eu done local echo then cd ${HOME} sed then cd --verbose
+	&& /usr/bin "$@" sed test sed local /usr/bin done --verbose
+then readonly /usr/bin --verbose | && sed echo
+	local "$@" && --verbose cd 2>/dev/null $(pwd) cd 2>/dev/null $(pwd) sed test
+		2>/dev/null x=1 "$1" x=1 ${HOME} local test /usr/bin "$1"
+	grep && $(pwd) readonly /usr/bin awk 2>/dev/null done awk /usr/bin echo
+	$(pwd) "$1" 2>/dev/null cd -eu --verbose export -eu /usr/bin awk cd grep 2>/dev/null
+	local -eu sed local &&
+		-eu "$1" grep $(pwd) printf echo then grep cd x=1
+	awk "$@" done "$1" 'quoted text' ${HOME} && cd 2>/dev/null grep 'quoted text'
+${HOME} 'quoted text' local $(pwd) cd | echo "$1" ${HOME} && grep --verbose
+		test $(pwd) "$1" test test | | test sed
+		test "$1" && printf 'quoted text' "$1" /usr/bin grep sed
+		"$@" -eu grep then then 2>/dev/null printf "$@"
+		awk printf printf cd cd grep local echo /usr/bin &&
+x=1 'quoted text' readonly local sed -eu export
+		printf "$1" awk cd done | sed "$@" -eu echo
+	sed 'quoted text' sed printf 'quoted text' 2>/dev/null readonly echo
+cd "$1" test 2>/dev/null grep "$1" /usr/bin local cd cd done --verbose
+		readonly readonly readonly
+"$@" export cd --verbose "$1" done export /usr/bin /usr/bin -eu grep
+printf "$@" readonly echo "$1" then 2>/dev/null
+		sed /usr/bin done export printf "$@"
+	'quoted text' readonly echo "$@" then then $(pwd)
+		test sed awk "$@" readonly && --verbose
+		'quoted text' $(pwd) -eu printf 2>/dev/null --verbose "$1" sed
+printf && "$1" local 2>/dev/null -eu 'quoted text' sed readonly
+cd then 2>/dev/null printf export export 2>/dev/null "$1" | "$1" grep
+		awk printf test 'quoted text' "$1" x=1
+readonly export /usr/bin x=1 sed --verbose test local done readonly readonly
+		done printf readonly sed && 2>/dev/null
+	$(pwd) cd printf -eu cd /usr/bin grep export -eu --verbose local printf ${HOME}
+readonly echo ${HOME} done 'quoted text' awk /usr/bin "$1" export ${HOME} grep
+		x=1 $(pwd) x=1 2>/dev/null
+"$1" 2>/dev/null done test | /usr/bin local -eu --verbose then --verbose
+awk done readonly done done done test
+		printf && ${HOME} 2>/dev/null
+local echo /usr/bin --verbose "$1" $(pwd) sed then 2>/dev/null
+'quoted text' 'quoted text' 2>/dev/null ${HOME} | "$1" ${HOME} printf
+		&& 'quoted text' 2>/dev/null -eu grep done local cd $(pwd) 'quoted text'
+2>/dev/null "$@" ${HOME} test "$1" sed
+"$1" sed echo --verbose readonly sed
+		$(pwd) export awk | --verbose | /usr/bin
+x=1 grep then -eu x=1 readonly grep "$1" /usr/bin
+local 'quoted text' | grep local printf export
+	export echo x=1 test awk done done "$1" 2>/dev/null
+	--verbose echo cd -eu then && done printf then 'quoted text' | done
+2>/dev/null local test
+done 2>/dev/null local 2>/dev/null test
+	--verbose then done then 'quoted text' export done && echo "$@"
+	awk && cd test echo $(pwd) x=1 2>/dev/null grep done x=1 cd then
+local then test sed echo x=1 "$@" -eu echo then -eu --verbose "$1" done x=1
+	"$1" | then --verbose then done x=1 sed
+	x=1 readonly | echo export
+	printf grep x=1 --verbose "$@" readonly 'quoted text' test 2>/dev/null
+'quoted text' /usr/bin awk readonly -eu echo
+	test awk echo --verbose -eu test
+		"$@" readonly readonly | local readonly printf -eu test done
+		cd sed /usr/bin local
+2>/dev/null local "$1"
+		sed cd | -eu -eu sed $(pwd) 'quoted text'
+printf /usr/bin "$@" readonly
+--verbose printf sed | x=1 "$@" cd -eu test
+awk grep x=1 done grep then done --verbose then --verbose
+test 'quoted text' done --verbose cd cd printf | sed cd
+cd ${HOME} 2>/dev/null awk local /usr/bin test
+--verbose grep done 'quoted text' export readonly printf sed "$@"
+-eu awk /usr/bin 2>/dev/null 2>/dev/null
+	/usr/bin then awk test 2>/dev/null 'quoted text' awk awk
+	'quoted text' cd printf
+test echo $(pwd) --verbose "$@" 'quoted text' x=1 "$1" -eu local "$@" "$@" then
+"$1" then "$1" 'quoted text' -eu $(pwd) --verbose printf echo awk export 'quoted text'
+	&& done awk done printf /usr/bin "$@" 'quoted text'
+	x=1 && $(pwd) -eu cd "$@" $(pwd) grep grep 2>/dev/null "$@" export printf
+&& grep x=1 "$1" -eu | readonly
+		printf grep echo grep awk then test ${HOME} test "$@"
+		| echo grep test echo export 'quoted text' export cd "$@"
+		x=1 $(pwd) 'quoted text' test "$@" --verbose ${HOME} /usr/bin readonly
+	-eu 2>/dev/null 'quoted text'
+sed ${HOME} printf cd cd 'quoted text' x=1 printf -eu then readonly 'quoted text'
+		"$1" awk grep done local local $(pwd) printf $(pwd) awk 2>/dev/null --verbose
+	"$@" done test && -eu sed test /usr/bin then printf
+--verbose --verbose local --verbose | cd --verbose sed test test
+	--verbose 'quoted text' ${HOME} test printf done | x=1 export echo readonly
+		--verbose readonly x=1 && export then
+		done ${HOME} grep export $(pwd) $(pwd) then readonly | "$@"
+	printf awk | -eu | "$1" "$@" -eu test $(pwd) $(pwd) 2>/dev/null readonly readonly
+		echo echo $(pwd) then local -eu 'quoted text' local 'quoted text' readonly
+/usr/bin 'quoted text' | test test "$1" | 2>/dev/null export export local /usr/bin
+		x=1 local x=1 ${HOME} local
+	x=1 readonly awk awk "$1" x=1 test
+x=1 test $(pwd) sed echo /usr/bin
+"$@" "$@" sed then cd "$1" && --verbose ${HOME} 2>/dev/null
+	export printf grep x=1 x=1 grep cd /usr/bin && ${HOME} sed "$1"
+	export | ${HOME} x=1 'quoted text' ${HOME} 2>/dev/null local x=1 printf
+'quoted text' /usr/bin readonly | x=1 "$1" readonly $(pwd)
+'quoted text' printf printf readonly grep
+	| "$1" grep $(pwd) awk && done | ${HOME} "$@" 2>/dev/null 'quoted text' export
+	local "$@" then cd printf ${HOME}
+| && 2>/dev/null && sed done
+		awk grep -eu 2>/dev/null x=1 export cd -eu /usr/bin "$1" "$@"
+'quoted text' cd echo readonly
+then done 'quoted text'
+2>/dev/null x=1 awk then 2>/dev/null ${HOME}
+	${HOME} sed local && done export
+	x=1 ${HOME} sed readonly
+-eu grep readonly printf -eu local "$1" "$1" printf
+		--verbose x=1 --verbose /usr/bin cd export cd --verbose | | 'quoted text'
+	"$@" awk /usr/bin local sed x=1 && done
+		-eu | && export test then
+		-eu sed grep --verbose "$@" 2>/dev/null
+export grep "$@" --verbose
+		readonly x=1 cd grep "$@" -eu 'quoted text' grep --verbose
+--verbose done local 'quoted text' test "$@" done
+2>/dev/null $(pwd) test
+		-eu ${HOME} test ${HOME} done 2>/dev/null echo --verbose readonly -eu
+	2>/dev/null local 'quoted text'
+		/usr/bin 2>/dev/null printf -eu sed | --verbose "$1" then && printf readonly "$1"
+"$1" sed echo printf "$1"
+local echo ${HOME} cd /usr/bin then | grep "$@" awk grep then ${HOME} &&
+printf then -eu --verbose awk --verbose done done test x=1 done
+then awk done $(pwd) awk done -eu | && printf 'quoted text'
+cd x=1 'quoted text' && -eu local done done x=1 $(pwd) "$@" && $(pwd) echo
+${HOME} -eu sed grep "$1" && sed readonly &&
+	cd printf && then -eu && done export awk cd sed cd readonly "$1" grep "$1"
+	x=1 sed /usr/bin --verbose readonly | 2>/dev/null local --verbose -eu
+		cd -eu 'quoted text' test awk -eu x=1 then
+/usr/bin test && local /usr/bin sed "$@"
+awk "$@" sed test sed "$1" 2>/dev/null 'quoted text' printf printf echo grep
+local --verbose sed && | local /usr/bin 2>/dev/null
+		"$@" | done --verbose --verbose done /usr/bin then /usr/bin $(pwd) done awk
+		2>/dev/null "$1" /usr/bin x=1 done | 'quoted text' local /usr/bin x=1 "$@"
+printf && ${HOME} x=1 grep $(pwd) x=1 ${HOME} "$@" -eu done /usr/bin awk
+	"$@" x=1 readonly 'quoted text' then test sed test --verbose "$1" && "$1" $(pwd)
+		x=1 grep "$1" "$1" echo test echo grep
+		"$@" echo "$1" --verbose cd /usr/bin awk
+		done | "$1" awk cd then "$1" export && $(pwd) test "$@" ${HOME}
+		${HOME} local test 2>/dev/null done printf grep grep grep echo
+		"$1" 2>/dev/null 2>/dev/null
+$(pwd) readonly "$@" then test --verbose 2>/dev/null local
+		x=1 sed 2>/dev/null --verbose local echo --verbose test && awk ${HOME} 2>/dev/null
+	x=1 ${HOME} done --verbose 'quoted text' readonly printf
+"$1" ${HOME} && --verbose -eu ${HOME} local
+		'quoted text' done | x=1 readonly done
+grep x=1 "$@" sed awk local x=1 ${HOME}
+		done $(pwd) awk "$1" 'quoted text'
+/usr/bin && | 2>/dev/null export export grep
+	/usr/bin export cd local 2>/dev/null && awk 'quoted text'
+	-eu 'quoted text' 'quoted text' "$@" && 'quoted text'
+		then "$1" cd echo readonly then
+--verbose "$1" sed export test 'quoted text' "$1" --verbose local echo
+		"$1" printf -eu "$1" then 'quoted text' then sed --verbose
+	echo "$1" x=1 | then readonly "$1" "$@" sed "$1" "$@" && done /usr/bin
+		/usr/bin then test export test | 2>/dev/null &&
+	awk | sed --verbose --verbose done done -eu "$@"
+		readonly sed /usr/bin printf echo 'quoted text' /usr/bin 'quoted text'
+	| awk $(pwd) -eu sed then done grep x=1 x=1 grep awk "$1"
+export printf 'quoted text' 2>/dev/null -eu 2>/dev/null awk ${HOME}
+	awk /usr/bin local | "$1" ${HOME}
+grep test sed | export -eu /usr/bin cd export 2>/dev/null 'quoted text'
+	cd local $(pwd) test readonly local "$@" sed && export 2>/dev/null grep $(pwd)
+"$1" cd 'quoted text' "$1" export done "$1" 2>/dev/null /usr/bin
+	echo export awk sed done printf "$1" sed ${HOME} done x=1 2>/dev/null then printf
+done 2>/dev/null 'quoted text' test -eu printf done sed
+		'quoted text' echo local --verbose sed test /usr/bin printf -eu "$1"
+		test export printf awk --verbose
+	2>/dev/null x=1 readonly -eu cd
+		/usr/bin readonly printf test
+	then grep -eu cd 'quoted text' export -eu export awk readonly sed echo /usr/bin
+		echo test then then --verbose "$@" awk | done "$@" test
+export grep $(pwd) echo export 'quoted text' "$1" --verbose "$1"
+		--verbose /usr/bin done echo
+	done sed done | printf
+$(pwd) ${HOME} -eu "$@" echo
+&& ${HOME} awk && x=1 -eu awk
+local local ${HOME} x=1 export
+x=1 "$@" sed readonly --verbose $(pwd) local && done export x=1 "$1"
+grep awk 'quoted text' && x=1 then
+		"$1" $(pwd) awk $(pwd) printf awk | /usr/bin $(pwd) printf sed
+		printf test -eu 'quoted text'
+	export "$@" && local test ${HOME} "$@" $(pwd) readonly
+	--verbose echo ${HOME} && readonly x=1 2>/dev/null
+	${HOME} | test local -eu x=1 2>/dev/null x=1 grep
+	printf then sed readonly ${HOME} then "$@" grep &&
+sed $(pwd) sed 'quoted text'
+		--verbose /usr/bin 'quoted text' grep
+done readonly $(pwd) x=1 $(pwd) | 2>/dev/null
+		2>/dev/null "$1" 'quoted text' --verbose "$@" 2>/dev/null done | /usr/bin
+awk done cd printf export --verbose
+		test cd local awk $(pwd) 'quoted text' -eu /usr/bin
+	echo -eu /usr/bin grep /usr/bin grep echo 'quoted text' 2>/dev/null ${HOME} local
+		/usr/bin /usr/bin grep -eu local ${HOME} "$1" "$@" x=1 | test
+		sed x=1 $(pwd) test "$1" grep sed grep $(pwd) 'quoted text' $(pwd) "$1" printf
+		printf echo export --verbose
+		done cd grep | sed /usr/bin && "$@" cd done local sed | grep -eu sed cd awk "$@"
+"$1" /usr/bin /usr/bin -eu sed
+	&& $(pwd) echo /usr/bin done readonly echo
+		"$1" then awk local sed | sed | $(pwd) 'quoted text' export /usr/bin test printf
+	cd echo "$1" "$1" test sed echo 2>/dev/null "$@" done
+$(pwd) test local --verbose x=1 'quoted text' test grep grep
+	readonly cd sed "$1" sed 2>/dev/null grep readonly cd | -eu "$@" /usr/bin awk
+		| then -eu printf $(pwd) printf $(pwd)
+	x=1 --verbose printf grep -eu && then grep -eu -eu test readonly && 'quoted text'
+	2>/dev/null x=1 awk awk test ${HOME} x=1 awk readonly
+then test awk export local | readonly
+sed "$@" && cd ${HOME} done done 'quoted text'
+	-eu | x=1 done echo grep done export cd 2>/dev/null -eu "$1"
+		local ${HOME} x=1 /usr/bin | awk ${HOME} printf && sed test printf readonly
+	awk --verbose x=1 grep awk | 'quoted text'
+		--verbose then && && echo printf x=1 /usr/bin export $(pwd) cd "$@" printf done
+| test x=1 local echo 'quoted text' x=1 export cd
+done /usr/bin local test cd readonly /usr/bin
+	then then done sed "$@" local "$@" echo readonly 2>/dev/null local && "$@"
+"$1" test done export --verbose --verbose -eu && sed printf sed $(pwd) sed
+-eu export && test awk local awk echo $(pwd) printf "$@" && 'quoted text'
+echo 'quoted text' grep awk awk readonly printf
+		--verbose cd sed 2>/dev/null /usr/bin 'quoted text'
+		/usr/bin printf && awk /usr/bin -eu $(pwd) done
+		'quoted text' done "$1" ${HOME} export export local "$1" then readonly && sed
+		grep done local echo readonly export printf grep grep then 'quoted text'
+	awk "$@" grep cd echo test
+		awk ${HOME} $(pwd) test cd 2>/dev/null "$@" "$@" done
+		x=1 2>/dev/null printf -eu "$1" readonly "$1" 'quoted text'
+	sed printf awk grep cd "$@"
+&& readonly echo cd x=1 awk awk && awk 'quoted text'
+local sed local -eu | "$@" $(pwd)
+	${HOME} echo 'quoted text' grep grep printf awk printf $(pwd) --verbose
+		"$1" printf cd printf export
+	2>/dev/null -eu && done x=1 2>/dev/null cd 2>/dev/null --verbose
+		done -eu ${HOME} done -eu sed -eu && $(pwd) $(pwd) printf
+then | | 'quoted text' 'quoted text' && x=1 ${HOME} then && cd test -eu
+		test local -eu sed "$1" && "$1" | grep sed x=1 2>/dev/null
+		"$1" 2>/dev/null cd 'quoted text' then then /usr/bin printf grep "$1"
+grep "$1" && local printf $(pwd) test 'quoted text'
+		2>/dev/null /usr/bin export then
+	test printf echo 'quoted text' x=1 | then /usr/bin grep readonly
+test 2>/dev/null readonly $(pwd) /usr/bin
+done -eu printf 2>/dev/null local "$@" | done local
+		${HOME} test test "$@" | then awk && x=1 "$@" 2>/dev/null test cd
+		| --verbose $(pwd) cd --verbose cd echo $(pwd) readonly
+		local 2>/dev/null ${HOME} "$1" export awk
+	sed /usr/bin sed grep --verbose $(pwd) done cd x=1 done done
+		done /usr/bin sed /usr/bin done export | /usr/bin readonly echo 2>/dev/null sed
+		echo test 'quoted text' 'quoted text' ${HOME} 'quoted text' $(pwd) local
+		done "$@" && printf done $(pwd) then grep --verbose "$@" &&
+	printf "$@" /usr/bin 2>/dev/null grep $(pwd) $(pwd) echo
+2>/dev/null sed /usr/bin -eu --verbose awk readonly
+/usr/bin $(pwd) "$1" --verbose
+		| 'quoted text' "$1" grep -eu -eu echo x=1 -eu 2>/dev/null
+		export "$1" $(pwd) x=1 ${HOME}
+		grep $(pwd) ${HOME} | 'quoted text' then readonly
+${HOME} awk done test -eu /usr/bin awk | grep ${HOME} -eu sed then local &&
+	export 'quoted text' awk x=1 export $(pwd) --verbose done "$1"
+&& x=1 --verbose readonly
+grep x=1 x=1 local printf x=1 readonly sed 'quoted text' then grep echo grep --verbose
+		local export cd && test 'quoted text' test ${HOME} "$1"
+"$@" | "$1" export && "$@"
+${HOME} "$@" sed grep "$@"
+		grep x=1 --verbose cd x=1 -eu test $(pwd) "$@" | "$1" cd awk "$@" ${HOME} local
+		"$1" done export cd $(pwd) ${HOME} --verbose --verbose test -eu | ${HOME} ${HOME}
+done x=1 local local grep awk "$1" x=1 $(pwd) local sed printf
+		'quoted text' && then "$@" test grep awk /usr/bin awk 'quoted text' | echo
+		-eu && ${HOME} $(pwd) 'quoted text' readonly x=1 awk cd echo done 2>/dev/null
+	test "$@" grep local test "$@" cd cd
+		export | echo sed x=1 --verbose cd && --verbose printf
+		2>/dev/null readonly cd
+		sed "$1" -eu echo awk 'quoted text' /usr/bin done ${HOME} "$@" 2>/dev/null 2>/dev/null
+		${HOME} | local "$@" | "$@"
+		"$@" && test echo echo 'quoted text'
+&& awk ${HOME} cd grep echo done grep x=1 then echo x=1 done
+export cd echo cd "$1" 2>/dev/null
+	"$1" $(pwd) echo -eu /usr/bin "$@" "$1" then test && echo grep
+	2>/dev/null printf x=1
+/usr/bin local sed printf --verbose
+	awk | /usr/bin cd test /usr/bin /usr/bin --verbose 'quoted text' printf && 'quoted text'
+test ${HOME} x=1 2>/dev/null export
+--verbose && x=1 --verbose $(pwd) test $(pwd) ${HOME} && test readonly echo local
+readonly 2>/dev/null ${HOME} x=1 x=1 export ${HOME} cd sed --verbose "$1"
+local local "$1" export then 2>/dev/null grep printf
+		$(pwd) sed "$1" echo test
+	2>/dev/null 'quoted text' printf /usr/bin
+local /usr/bin then $(pwd) x=1 "$@" $(pwd) awk
+		then export readonly | then sed
+&& then grep test && "$1"
+	awk done then 'quoted text' sed -eu export x=1 &&
+	grep "$1" awk ${HOME} /usr/bin
+	${HOME} && awk test export ${HOME}
+		cd x=1 test ${HOME} sed cd | /usr/bin && /usr/bin printf printf test grep then "$1"
+	-eu test -eu && awk cd -eu -eu && 2>/dev/null
+&& export done && "$@" done && --verbose echo --verbose awk
+		readonly sed echo "$1" x=1 'quoted text' 'quoted text' grep sed readonly
+		sed 'quoted text' $(pwd) test "$1" cd "$@" cd test /usr/bin local
+	/usr/bin test ${HOME}
+done "$1" printf --verbose
+-eu 'quoted text' "$1" ${HOME} -eu x=1 local && grep sed
+		done export 2>/dev/null echo grep $(pwd) x=1 printf
+export ${HOME} then printf readonly 'quoted text' grep readonly "$@"
+-eu cd $(pwd) -eu awk grep "$1" grep --verbose x=1 done
+		grep "$@" 2>/dev/null export
+	--verbose test "$@" local done
+	then readonly --verbose readonly awk local 2>/dev/null x=1 export printf
+		-eu local export echo x=1 2>/dev/null
+&& awk ${HOME} done printf
+	awk readonly grep --verbose "$1"
+		${HOME} printf test done test readonly /usr/bin --verbose
+	printf && printf grep -eu sed
+		| 'quoted text' && ${HOME} export done /usr/bin
+		awk && "$1" cd -eu then then done sed --verbose
+done readonly cd 2>/dev/null -eu | --verbose printf $(pwd) printf
+readonly readonly test
+	cd /usr/bin -eu sed 2>/dev/null echo printf cd export
+		2>/dev/null $(pwd) "$1" /usr/bin export export --verbose grep 'quoted text'
+/usr/bin grep echo sed sed local 2>/dev/null 2>/dev/null awk grep "$@" /usr/bin
+2>/dev/null --verbose echo echo -eu
+		${HOME} /usr/bin echo local 2>/dev/null
+	echo test export then readonly sed grep done "$1" -eu grep test /usr/bin printf
+then printf "$@" export cd --verbose printf cd ${HOME} export awk awk
+		&& --verbose 2>/dev/null test ${HOME} | test sed local then "$@"
+	export local done 'quoted text'
+	export cd sed --verbose
+	/usr/bin 2>/dev/null ${HOME} 'quoted text' "$1" printf --verbose
+	grep && printf export readonly echo &&
+then -eu grep grep echo cd -eu /usr/bin
+		/usr/bin then | cd sed
+	2>/dev/null echo test sed | 2>/dev/null
+	"$@" echo "$@" done 2>/dev/null then ${HOME}
+		x=1 && x=1 awk done /usr/bin
+		/usr/bin "$@" cd 'quoted text' "$1"
+		then x=1 local export && $(pwd) readonly test awk local ${HOME}
+'quoted text' -eu ${HOME} | | readonly "$@" 2>/dev/null | grep ${HOME}
+	2>/dev/null cd x=1 /usr/bin
+		-eu sed printf -eu printf grep $(pwd) echo 'quoted text' ${HOME} ${HOME} local
+readonly then cd awk then 2>/dev/null sed ${HOME}
+	| then 'quoted text' local ${HOME} awk "$1" ${HOME} test | test
+cd readonly sed printf 'quoted text'
+		-eu ${HOME} local export "$@" grep printf cd
+/usr/bin local test cd then awk echo 2>/dev/null ${HOME} "$@" --verbose
+		x=1 sed local local &&
+		test $(pwd) -eu done /usr/bin 2>/dev/null
+	cd printf export printf 'quoted text'
+	2>/dev/null "$@" ${HOME} done "$@" cd 'quoted text' -eu echo x=1
+2>/dev/null echo local ${HOME} $(pwd) grep grep local awk -eu done
+		local echo "$@" cd -eu $(pwd) then 2>/dev/null
+		awk $(pwd) echo done 2>/dev/null x=1 printf -eu && readonly 'quoted text'
+	printf && grep sed x=1 x=1 && &&
+	printf done echo | | grep export /usr/bin test x=1 ${HOME} | readonly /usr/bin sed
+		/usr/bin && && sed | | $(pwd) -eu --verbose printf printf
+readonly readonly export 'quoted text' "$@"
+	&& ${HOME} 'quoted text' 2>/dev/null
+	--verbose export $(pwd) --verbose -eu grep 2>/dev/null ${HOME}
+	x=1 grep --verbose 'quoted text'
+	2>/dev/null awk awk sed readonly "$1"
+		"$@" && cd | grep -eu 'quoted text' ${HOME} grep -eu then then ${HOME} sed
+	$(pwd) 2>/dev/null then printf "$@"
+	export sed ${HOME} 'quoted text' "$1" $(pwd) --verbose
+	$(pwd) cd test 'quoted text' "$1" -eu
+		readonly printf x=1 "$@" printf /usr/bin $(pwd) cd 'quoted text' done cd
+	then /usr/bin readonly ${HOME} "$1"
+		-eu 'quoted text' "$@" "$1" sed sed awk awk test local ${HOME} "$1" -eu sed
+		--verbose | printf --verbose
+		cd -eu ${HOME} export done local "$@" awk awk cd export "$@"
+		awk && readonly printf local printf x=1 x=1 awk /usr/bin then && --verbose 2>/dev/null
+		--verbose echo test ${HOME} ${HOME} 2>/dev/null done && local test "$1" test
+	export /usr/bin ${HOME} ${HOME} "$@" --verbose $(pwd) export
+	2>/dev/null local then "$@"
+	cd /usr/bin x=1 2>/dev/null readonly
+		sed /usr/bin ${HOME} "$1" local
+x=1 then --verbose cd /usr/bin --verbose export && test done
+	"$1" then && printf awk /usr/bin sed local 2>/dev/null cd then --verbose grep
+		'quoted text' 2>/dev/null done && local
+		awk sed local | "$1" echo | /usr/bin then -eu done ${HOME} 2>/dev/null
+echo printf grep x=1 then done
+export x=1 then then "$@" "$@" readonly
+then /usr/bin && export readonly done x=1 grep export local --verbose printf
+		'quoted text' 2>/dev/null cd && -eu grep 'quoted text'
+	done --verbose 'quoted text' --verbose --verbose
+	export test then x=1 2>/dev/null grep cd "$@" printf printf ${HOME}
+	"$@" 2>/dev/null done then --verbose 2>/dev/null
+/usr/bin --verbose test "$@" awk cd export
+	echo readonly && awk /usr/bin sed 2>/dev/null
+		--verbose && $(pwd) echo export 'quoted text' printf export printf
+		then | "$1" $(pwd) awk done echo test cd sed 'quoted text'
+	export x=1 x=1 awk && && grep cd awk "$1" export x=1 $(pwd)
+	${HOME} done grep 2>/dev/null cd
+--verbose $(pwd) sed | $(pwd) then && ${HOME} awk $(pwd) printf "$@" |
+	/usr/bin cd -eu | x=1 printf export cd awk cd awk ${HOME} "$@" "$1"
+		readonly done "$@" ${HOME} 'quoted text' /usr/bin done "$@" 'quoted text'
+sed | ${HOME} readonly readonly
+"$1" export awk export readonly 2>/dev/null ${HOME} && | 'quoted text'
+/usr/bin -eu 'quoted text' cd "$@" && --verbose
+		--verbose done printf -eu cd 'quoted text' printf /usr/bin && | | done local --verbose
+	x=1 readonly done && export /usr/bin echo $(pwd) echo echo 2>/dev/null then echo
+	readonly local | local local
+	| local local then ${HOME} echo done printf grep
+	&& export local && printf printf awk echo --verbose /usr/bin -eu cd readonly
+		/usr/bin done "$1" -eu "$@" local then export sed /usr/bin export
+		echo 'quoted text' "$@" cd
+"$@" local $(pwd) echo sed
+echo -eu x=1 | ${HOME} /usr/bin
+/usr/bin "$1" /usr/bin x=1 printf
+		awk "$@" --verbose /usr/bin /usr/bin $(pwd) test --verbose
+		sed && "$@" grep echo $(pwd) x=1 && --verbose
+	$(pwd) /usr/bin ${HOME} && echo grep 2>/dev/null 2>/dev/null local "$@" cd test
+	x=1 sed test grep "$1" "$@" --verbose | && "$@" echo --verbose echo |
+		grep echo 'quoted text' "$1" ${HOME} sed sed ${HOME} -eu && --verbose -eu test
+${HOME} /usr/bin printf x=1 ${HOME}
+	done done x=1 "$1" done awk -eu printf x=1 'quoted text' echo test |
+local x=1 x=1 awk local /usr/bin 2>/dev/null /usr/bin cd grep && then
+	awk echo "$1" readonly 2>/dev/null 2>/dev/null local
+	"$@" --verbose printf /usr/bin cd -eu -eu printf printf
+		${HOME} awk grep done then x=1
+	${HOME} --verbose done -eu
+	awk export | cd done awk test /usr/bin "$1" done x=1 "$@" local echo $(pwd) test
+		-eu 'quoted text' --verbose /usr/bin test -eu $(pwd) printf
+	then test | ${HOME} grep printf cd ${HOME} awk $(pwd) cd cd local readonly grep
+2>/dev/null grep echo cd --verbose
+	awk 2>/dev/null "$1" 2>/dev/null /usr/bin 2>/dev/null 2>/dev/null sed
+		/usr/bin x=1 awk --verbose
+	then readonly && 2>/dev/null sed --verbose
+then | echo /usr/bin "$1" | /usr/bin -eu sed --verbose readonly readonly
+		readonly cd sed /usr/bin done ${HOME} ${HOME} 'quoted text' echo && "$1" 2>/dev/null
+$(pwd) | 'quoted text' x=1 --verbose test printf $(pwd) $(pwd)
+	then echo /usr/bin -eu export local printf sed | readonly
+		readonly cd awk "$@" cd /usr/bin
+$(pwd) export export done local "$@" 2>/dev/null && printf 'quoted text'
+		x=1 /usr/bin --verbose && then awk echo $(pwd)
+	${HOME} then "$1" test "$@" export done -eu ${HOME} export cd "$@" awk printf grep
+grep "$@" "$1" "$1" sed echo x=1 -eu then awk $(pwd)
+		printf awk sed readonly && "$@" then /usr/bin
+		-eu export 'quoted text'
+-eu -eu printf grep awk readonly sed $(pwd) "$1" printf
+	/usr/bin export done 2>/dev/null awk 'quoted text'
+	cd printf grep 2>/dev/null local awk echo cd 2>/dev/null
+		/usr/bin printf -eu ${HOME} 2>/dev/null 2>/dev/null awk sed test
+export then printf then "$@" 2>/dev/null /usr/bin
+then done test then export "$@" ${HOME}
+/usr/bin 2>/dev/null /usr/bin
+test export "$@" --verbose
+	export grep test grep local echo
+		&& ${HOME} cd x=1 "$@" awk echo local
+		$(pwd) awk export done | grep --verbose echo export sed grep && echo $(pwd) /usr/bin
+sed printf test /usr/bin local && local cd done x=1 then --verbose
+	"$@" awk /usr/bin 2>/dev/null 'quoted text' done echo
+		/usr/bin grep | export && $(pwd) local done | --verbose && x=1 readonly
+		2>/dev/null /usr/bin 2>/dev/null "$@" readonly && ${HOME} --verbose x=1 cd
+	/usr/bin 2>/dev/null
+done sed x=1 grep printf awk --verbose readonly printf ${HOME} grep grep readonly
+test readonly sed "$1" &&
+		"$@" "$1" ${HOME} $(pwd) $(pwd) "$@"
+	"$1" x=1 printf printf sed $(pwd)
+		-eu ${HOME} x=1 $(pwd) ${HOME} 2>/dev/null
+	2>/dev/null "$@" -eu && awk cd test | test
+then -eu ${HOME} cd ${HOME} | local ${HOME}
+then 'quoted text' readonly done printf "$1" awk "$@"
+	test x=1 awk export test 'quoted text' &&
+	export cd | --verbose "$1" local
+	--verbose local x=1 x=1 awk 2>/dev/null sed test "$@" sed grep sed test | --verbose
+	done && /usr/bin -eu && 'quoted text'
+	export "$1" x=1 2>/dev/null echo local "$1" /usr/bin $(pwd)
+"$1" $(pwd) | sed done sed awk | echo
+	| "$@" "$1" sed x=1 done local
+test local test --verbose
+	'quoted text' printf x=1 readonly | awk -eu sed export "$1" awk local sed grep
+	awk grep 2>/dev/null local --verbose ${HOME} done then export
+	2>/dev/null cd then printf 2>/dev/null /usr/bin -eu awk && "$@" && "$@" 2>/dev/null
+		sed readonly then done export ${HOME} $(pwd) --verbose
+		then $(pwd) awk /usr/bin grep then test
+		echo ${HOME} /usr/bin sed ${HOME} $(pwd) grep local 'quoted text' $(pwd) grep
+$(pwd) test ${HOME} "$@" | sed export --verbose /usr/bin $(pwd)
+	cd ${HOME} -eu $(pwd) grep local then done | x=1 cd x=1 'quoted text'
+	${HOME} export "$1" | --verbose x=1 && "$1" export echo
+	grep $(pwd) /usr/bin awk export echo && /usr/bin printf
+	readonly && | && sed printf then --verbose local && --verbose readonly
+	awk --verbose test --verbose export $(pwd) export -eu cd --verbose
+		'quoted text' done export export echo
+/usr/bin $(pwd) sed cd ${HOME} &&
+--verbose then readonly
+done | | && sed export /usr/bin /usr/bin test echo export export |
+		echo test && local /usr/bin ${HOME} local
+		test x=1 cd echo echo 'quoted text'
+		sed awk local "$@" test
+then | local -eu "$1" -eu "$@" cd cd grep then
+		${HOME} export export sed && echo
+		local $(pwd) | x=1 /usr/bin
+awk 2>/dev/null -eu /usr/bin test $(pwd) echo printf
+&& printf 'quoted text' --verbose x=1 then
+		printf $(pwd) printf grep 2>/dev/null x=1 "$1" 2>/dev/null
+done $(pwd) readonly export ${HOME} export printf -eu $(pwd) -eu | x=1 export
+printf done export x=1 ${HOME} "$@" then local | test done $(pwd)
+		x=1 echo && | x=1 -eu awk -eu
+/usr/bin awk "$1" 'quoted text' grep cd local 'quoted text' cd done "$1" |
+awk --verbose | grep local --verbose && done 2>/dev/null
+| cd 'quoted text' echo export test
+export ${HOME} $(pwd) &&
+	local test readonly then ${HOME} then && echo printf "$@" x=1
+		"$1" done awk && 'quoted text'
+	$(pwd) "$@" cd export echo test $(pwd) | $(pwd) then 2>/dev/null 'quoted text'
+	-eu done done sed readonly
+x=1 'quoted text' awk done awk local done --verbose sed -eu $(pwd) export
+	readonly export "$1" "$@" 'quoted text' test "$1"
+		$(pwd) ${HOME} test local export awk /usr/bin sed ${HOME} done awk
+readonly ${HOME} "$1" ${HOME} grep
+"$@" readonly ${HOME} local /usr/bin -eu ${HOME} cd "$@"
+		/usr/bin --verbose | --verbose sed 2>/dev/null "$1" "$1" echo then test
+		test 'quoted text' x=1 local printf 2>/dev/null && local "$1" --verbose grep
+readonly /usr/bin echo -eu test | then x=1 | x=1 sed 2>/dev/null export sed
+printf echo "$1" x=1 printf "$@" /usr/bin export /usr/bin
+		echo done grep readonly readonly
+		export printf done test grep $(pwd) export "$@" test printf -eu grep "$@"
+	awk printf done cd grep printf grep local 2>/dev/null x=1
+	export test local sed --verbose done grep --verbose test 'quoted text'
+&& sed -eu local readonly --verbose echo $(pwd) then -eu sed readonly
+awk 'quoted text' test
+	sed $(pwd) | printf | "$1" test
+		echo -eu -eu cd echo --verbose | 'quoted text' | 'quoted text'
+/usr/bin echo "$1" export printf awk done done grep awk
+		echo cd export done printf x=1 2>/dev/null local
+	echo grep done -eu --verbose "$@" ${HOME}
+$(pwd) $(pwd) printf 'quoted text' /usr/bin grep echo
+		--verbose "$@" grep test 2>/dev/null "$@" export "$1" export
+	test | done printf $(pwd)
+	$(pwd) "$1" then x=1 "$@" test $(pwd) /usr/bin then cd printf printf
+awk echo then --verbose local
+	&& "$1" /usr/bin test echo local cd "$@" echo grep /usr/bin && && /usr/bin 'quoted text'
+	cd done x=1 done test cd --verbose
+		-eu /usr/bin | cd 'quoted text' printf 'quoted text'
+	local export --verbose
+		local awk done awk readonly cd done "$@" ${HOME} cd
+		"$@" ${HOME} cd x=1 readonly 2>/dev/null 'quoted text'
+test test then "$1" "$@" $(pwd) "$@" readonly $(pwd) export printf local
+	then 'quoted text' sed /usr/bin "$@" /usr/bin "$@" $(pwd) done local
+	--verbose 2>/dev/null done test | readonly 'quoted text' --verbose --verbose
+	local sed awk && grep && "$@" done grep echo readonly sed grep done
+test ${HOME} test | export readonly export done printf
+		grep | cd cd export --verbose echo readonly | sed printf --verbose readonly
+${HOME} awk "$@" echo then "$@" cd printf --verbose export done
+	export test ${HOME} x=1 local ${HOME} echo
+		| export $(pwd) cd done $(pwd)
+printf -eu $(pwd) && && -eu 2>/dev/null ${HOME} --verbose
+	echo -eu "$1" then $(pwd) ${HOME} ${HOME} --verbose done echo | "$1" local local
+done printf then readonly 'quoted text' 2>/dev/null && printf cd readonly
+	test printf "$1" awk then x=1 x=1 export $(pwd) | 2>/dev/null done && test
+	done "$@" echo printf /usr/bin "$1" sed then && grep ${HOME} echo
+		&& "$1" 'quoted text'
+done /usr/bin cd ${HOME} --verbose grep
+"$1" grep && && cd | 'quoted text' echo export "$@" x=1 /usr/bin "$@"
+		echo printf printf --verbose
+	| grep readonly printf "$@" "$@" sed cd "$1" /usr/bin awk
+		--verbose then then awk 'quoted text' awk grep done cd readonly "$@" then x=1
+2>/dev/null 'quoted text' ${HOME} grep printf printf "$1"
+--verbose cd local awk ${HOME} printf
+	export -eu /usr/bin x=1 2>/dev/null done /usr/bin grep |
+		readonly awk ${HOME} /usr/bin ${HOME} 2>/dev/null /usr/bin local | done
+		| done sed done && /usr/bin done "$@" test ${HOME} done printf cd --verbose "$1"
+#include c101.sh
+'quoted text' readonly x=1 then $(pwd) x=1 $(pwd) export grep ${HOME}
+	readonly printf done && grep /usr/bin "$@" x=1
+		${HOME} done -eu readonly ${HOME} cd 2>/dev/null 'quoted text' export
+		then export cd --verbose sed 'quoted text' then local 2>/dev/null awk ${HOME} |
+	x=1 done printf local "$@"
+	cd printf echo test export
+2>/dev/null 2>/dev/null "$@" /usr/bin
+	"$1" /usr/bin awk then local printf
+		-eu local && export "$@" "$@" -eu -eu "$@" echo $(pwd) echo export test
+		grep sed "$1" awk echo then test /usr/bin then export grep echo export
+	$(pwd) cd -eu export 2>/dev/null
+	| cd local printf done | sed grep | readonly -eu cd test /usr/bin
+	cd 2>/dev/null ${HOME} x=1 --verbose test "$@" echo --verbose
+'quoted text' --verbose "$@" -eu export export
+		&& 2>/dev/null /usr/bin x=1 sed
+export local && 2>/dev/null 2>/dev/null
+		printf -eu | cd done export x=1 echo local "$1" 2>/dev/null printf then
+		cd $(pwd) --verbose readonly export 2>/dev/null --verbose "$@" 'quoted text'
+grep x=1 echo && ${HOME} export -eu readonly
+	&& test local then done then
+	test 'quoted text' --verbose --verbose sed /usr/bin
+	$(pwd) --verbose ${HOME} 2>/dev/null "$1" readonly "$@" test
+		"$@" ${HOME} | then local readonly x=1 ${HOME} "$@" "$1" ${HOME}
+		then | grep echo "$1" --verbose
+		x=1 sed cd | export cd && readonly readonly 'quoted text' "$@" "$@" --verbose
+| awk 2>/dev/null local $(pwd) export | -eu awk
+	readonly test readonly --verbose done then awk
+		&& ${HOME} | x=1 "$@" | test 'quoted text' 2>/dev/null
+	| awk printf test "$@" 2>/dev/null
+		awk done 2>/dev/null echo /usr/bin then
+	test done awk 2>/dev/null export printf
+'quoted text' && x=1 local 'quoted text' "$1" | echo "$1" /usr/bin test
+		local $(pwd) | "$1" test "$@" /usr/bin 'quoted text' sed local ${HOME} ${HOME}
+		export grep /usr/bin printf test sed
+	awk test 'quoted text' sed test |
+2>/dev/null | done grep readonly
+cd "$@" done cd then awk then "$1" x=1
+-eu export && cd export export export
+		--verbose --verbose 2>/dev/null done
+${HOME} "$@" printf -eu --verbose "$1" awk test "$@" --verbose
+		| then /usr/bin sed 'quoted text' /usr/bin awk 2>/dev/null
+		sed "$1" "$@" printf export | export -eu
+		echo then --verbose 2>/dev/null printf
+| "$@" ${HOME} && cd readonly test | --verbose grep "$@" -eu cd
+-eu && $(pwd) sed ${HOME} cd export test $(pwd) export cd readonly
+	${HOME} readonly cd "$@" done ${HOME}
+		| cd echo && local ${HOME} "$1" /usr/bin awk echo 'quoted text'
+		2>/dev/null "$@" 2>/dev/null then $(pwd) && "$@" 'quoted text' 'quoted text'
+	test --verbose printf then grep 2>/dev/null grep 2>/dev/null "$@"
+	${HOME} | echo x=1 done 2>/dev/null "$@" x=1 $(pwd)
+	| echo local awk export 'quoted text' printf awk && "$@"
+		printf $(pwd) x=1 ${HOME} 'quoted text'
+sed -eu ${HOME} x=1 done $(pwd) 'quoted text' then ${HOME} cd echo cd --verbose
+		local done ${HOME} $(pwd) x=1 "$1" echo "$@"
+		export ${HOME} grep x=1 cd sed "$@" done --verbose test
+		awk local awk printf
+	done export 'quoted text' grep export /usr/bin -eu -eu "$1" -eu /usr/bin 'quoted text'
+$(pwd) grep grep test then -eu 2>/dev/null done test grep
+	x=1 | export local done export 2>/dev/null /usr/bin && printf
+	--verbose printf 'quoted text' "$1"
+&& done && export -eu "$@"
+		$(pwd) awk sed 2>/dev/null printf echo
+	&& done export export then | $(pwd)
+	grep test printf ${HOME} | $(pwd)
+		x=1 grep 2>/dev/null printf "$1" local /usr/bin export /usr/bin |
+	awk grep local echo test export
+awk x=1 test awk ${HOME}
+/usr/bin ${HOME} cd | done printf "$1" then
+	-eu -eu /usr/bin printf sed grep grep export done -eu "$1"
+	x=1 printf 2>/dev/null 'quoted text' "$1" && | sed
+	awk readonly /usr/bin 2>/dev/null done 2>/dev/null then readonly ${HOME} && then
+	--verbose readonly /usr/bin local awk 2>/dev/null $(pwd) grep readonly
+readonly readonly $(pwd) "$@" printf cd | && -eu done 2>/dev/null
+then then $(pwd) | done done 'quoted text'
+then x=1 $(pwd) x=1 test sed /usr/bin awk local
+		| /usr/bin test x=1 printf 2>/dev/null 'quoted text' awk -eu x=1 $(pwd)
+	awk -eu then done then "$@" echo done cd --verbose ${HOME}
+		then ${HOME} -eu 'quoted text' then sed then
+	-eu && grep export ${HOME} readonly | ${HOME} test 'quoted text'
+-eu printf then 2>/dev/null printf export | "$1" awk "$@" 2>/dev/null
+		done readonly then test printf readonly
+$(pwd) 'quoted text' 2>/dev/null --verbose echo && local -eu "$1" ${HOME}
+	printf export 'quoted text'
+	x=1 done $(pwd) 'quoted text' cd && awk
+	echo && test && $(pwd) "$@" done test 2>/dev/null && x=1 test
+		cd 'quoted text' printf then 2>/dev/null test echo
+$(pwd) cd cd "$1" export printf $(pwd) 'quoted text'
+	export ${HOME} export 'quoted text'
+/usr/bin "$1" export --verbose -eu 2>/dev/null "$1"
+	cd echo /usr/bin | /usr/bin "$1" awk awk | x=1 local x=1 $(pwd) $(pwd) done
+	readonly readonly "$1" done readonly && cd x=1 then then
+	grep x=1 sed | local | --verbose printf
+	echo export /usr/bin "$@" cd awk export 2>/dev/null ${HOME} sed | printf
+/usr/bin done "$@" readonly && "$@" | sed /usr/bin --verbose ${HOME} test
+'quoted text' cd "$1" 'quoted text'
+	-eu "$1" echo /usr/bin printf "$1" "$1" && 2>/dev/null done ${HOME}
+	printf --verbose && awk readonly local -eu $(pwd) /usr/bin
+		x=1 && --verbose && echo test "$@" grep printf then export "$@" && /usr/bin
+		then 'quoted text' printf -eu done done readonly echo /usr/bin echo then
+test 2>/dev/null echo then echo printf $(pwd) ${HOME} 'quoted text'
+		sed x=1 grep 'quoted text' test -eu "$@"
+${HOME} 2>/dev/null 2>/dev/null && "$@" local
+	-eu awk ${HOME} echo grep printf
+		local /usr/bin printf then 2>/dev/null x=1 $(pwd) /usr/bin "$1" |
+		awk ${HOME} 'quoted text' -eu /usr/bin readonly
+	export ${HOME} echo local printf 'quoted text' "$@" "$@" 'quoted text' cd local
+	sed ${HOME} /usr/bin then export /usr/bin local printf
+		local then "$@" awk local && 'quoted text' $(pwd) cd
+	x=1 2>/dev/null "$1" 2>/dev/null "$@" && -eu echo then
+x=1 2>/dev/null "$@" echo --verbose 'quoted text' $(pwd)
+	then sed test printf | done test readonly test x=1 && "$@" local --verbose
+	/usr/bin | awk 2>/dev/null printf export export
+grep ${HOME} --verbose 'quoted text'
+	test sed /usr/bin 2>/dev/null export x=1 && grep local
+awk && | local 2>/dev/null
+x=1 -eu "$1" cd export --verbose echo export "$@" echo && export "$@"
+	grep cd export then $(pwd) $(pwd) /usr/bin /usr/bin grep awk readonly local
+	then readonly sed readonly sed
+	test printf -eu done "$1" && "$@" "$@" "$@" "$@" x=1 'quoted text'
+		sed "$1" /usr/bin x=1 readonly --verbose readonly then
+	sed "$1" /usr/bin grep printf grep 'quoted text' then awk
+--verbose grep done echo 'quoted text'
+	printf /usr/bin export echo done done "$1" test sed $(pwd) readonly
+grep && 'quoted text' cd printf $(pwd) 'quoted text' $(pwd) "$1"
+		"$@" test 2>/dev/null 'quoted text' echo --verbose --verbose
+	cd printf echo then done printf && readonly "$1" local export "$1" cd readonly
+grep ${HOME} $(pwd) --verbose
+then test echo test 2>/dev/null printf -eu awk $(pwd) && $(pwd)
+	-eu "$@" | local && local && readonly test --verbose 2>/dev/null
+	&& test x=1 sed grep x=1 test $(pwd) printf grep sed 'quoted text' cd
+		| "$1" 'quoted text' ${HOME} done export /usr/bin sed $(pwd) /usr/bin awk "$@"
+	"$1" "$1" cd x=1 readonly | -eu && -eu "$@" echo cd test export
+"$@" test then "$@" $(pwd) --verbose done /usr/bin "$@" | then
+		cd && sed printf done echo "$1" cd --verbose
+		echo -eu test then $(pwd) && echo | readonly local done printf "$@" "$1" export
+		2>/dev/null printf $(pwd) readonly 2>/dev/null done $(pwd)
+	${HOME} /usr/bin sed x=1 "$@" && test local
+		x=1 cd echo export 'quoted text' sed export test --verbose $(pwd)
+	printf cd grep export cd grep "$1" "$1" /usr/bin echo
+	printf readonly test then 2>/dev/null --verbose --verbose local
+		2>/dev/null ${HOME} && -eu "$1" --verbose x=1 cd -eu
+printf -eu -eu $(pwd) grep --verbose $(pwd)
+		sed $(pwd) done --verbose export x=1 -eu | ${HOME} done
+		--verbose -eu readonly
+2>/dev/null x=1 export 'quoted text' sed readonly test --verbose "$1" local
+		&& sed -eu /usr/bin x=1 readonly then export printf | test "$1" then
+	x=1 x=1 test echo sed --verbose
+		"$@" ${HOME} | && export --verbose export ${HOME}
+&& $(pwd) awk printf x=1 --verbose $(pwd) cd "$@" done 2>/dev/null /usr/bin test
+	--verbose then cd cd && $(pwd) -eu test -eu local --verbose -eu x=1 grep "$1" then
+printf 2>/dev/null /usr/bin sed sed && && cd test --verbose "$1" then 2>/dev/null
+"$1" x=1 readonly export grep "$@" x=1 "$1" done local | $(pwd)
+test ${HOME} $(pwd) local
+| --verbose cd done --verbose readonly sed local | readonly sed sed /usr/bin
+$(pwd) printf export test done ${HOME} local
+		${HOME} sed /usr/bin grep then ${HOME}
+	-eu done readonly grep 2>/dev/null /usr/bin done --verbose grep printf
+		cd readonly "$@" test test awk sed readonly 2>/dev/null awk cd
+		--verbose x=1 local done 'quoted text'
+		cd local $(pwd) local done export "$1" "$@" "$@" printf "$1"
+local | x=1 local --verbose
+	printf && 'quoted text' readonly 'quoted text' sed test done grep cd done
+		test cd printf local 'quoted text'
+		--verbose then 'quoted text' | 2>/dev/null
+		echo 'quoted text' x=1 then echo export
+	readonly 2>/dev/null /usr/bin 2>/dev/null sed
+		"$1" then --verbose ${HOME} test 2>/dev/null printf export
+2>/dev/null export sed /usr/bin -eu | "$@" ${HOME}
+		local "$1" | cd export readonly then "$@" $(pwd)
+	/usr/bin cd | export echo grep export
+${HOME} awk awk 'quoted text' -eu cd ${HOME} test printf "$@" then 'quoted text'
+		&& 'quoted text' grep -eu grep 'quoted text' 2>/dev/null
+		awk $(pwd) && done "$1" done export readonly
+		awk "$1" --verbose /usr/bin sed grep x=1 local
+local ${HOME} then ${HOME} cd $(pwd)
+	2>/dev/null --verbose --verbose
+	"$@" $(pwd) grep "$1" then
+&& cd x=1 sed export test printf done --verbose && --verbose
+${HOME} cd /usr/bin awk "$1" then readonly then "$1" ${HOME}
+	echo | then -eu -eu echo cd sed test then awk && printf --verbose
+	readonly export export -eu /usr/bin cd -eu done awk | x=1 -eu sed 'quoted text'
+	readonly awk export local awk $(pwd) "$1" awk printf 2>/dev/null
+grep cd cd --verbose printf -eu
+		sed readonly "$@" "$1" x=1
+		${HOME} ${HOME} awk cd | ${HOME} export ${HOME} -eu ${HOME}
+x=1 export export cd && grep done echo
+		done readonly export cd printf ${HOME} /usr/bin "$@" printf 2>/dev/null
+		| /usr/bin -eu local 2>/dev/null export | printf -eu "$@" printf
+	cd /usr/bin ${HOME} echo && grep -eu x=1 |
+| sed export done 'quoted text' test local echo x=1 export 'quoted text'
+	test 2>/dev/null then echo "$1" $(pwd) done
+		${HOME} 2>/dev/null sed "$@" done /usr/bin
+		"$1" cd awk grep done $(pwd) && $(pwd) echo then ${HOME} local then
+		2>/dev/null printf ${HOME} x=1 test cd 'quoted text' -eu
+	2>/dev/null local $(pwd) echo export done printf -eu "$@" echo printf 'quoted text'
+	awk /usr/bin 'quoted text' ${HOME} cd
+		done echo -eu grep x=1 $(pwd) | -eu cd then /usr/bin grep local 2>/dev/null |
+		2>/dev/null 'quoted text' test && && | "$@" "$@" done -eu /usr/bin readonly sed
+--verbose | awk test $(pwd)
+2>/dev/null then then then "$@" sed test cd $(pwd) then $(pwd)
+then awk "$1" readonly then -eu export test awk local printf |
+	-eu /usr/bin -eu awk echo x=1 done 'quoted text'
+		awk x=1 --verbose then 'quoted text'
+$(pwd) done readonly
+/usr/bin echo ${HOME} awk && awk -eu ${HOME} then awk readonly
+		grep -eu ${HOME} export printf test readonly
+${HOME} "$@" $(pwd) readonly
+		"$1" -eu printf 2>/dev/null export --verbose echo 2>/dev/null readonly
+		then -eu sed local $(pwd) $(pwd) &&
+printf "$1" x=1 awk 'quoted text' then then grep -eu "$@" && done
+		test grep -eu /usr/bin test -eu -eu sed --verbose
+		2>/dev/null --verbose export 2>/dev/null test "$1" -eu | sed --verbose 'quoted text'
+-eu local -eu --verbose readonly "$@" printf readonly --verbose
+	2>/dev/null printf 'quoted text'
+		"$@" printf --verbose x=1 x=1 /usr/bin -eu -eu "$@" "$1" 2>/dev/null
+&& ${HOME} awk 2>/dev/null 'quoted text' x=1
+cd local export --verbose done /usr/bin
+	&& | | && --verbose "$1" 2>/dev/null 2>/dev/null
+'quoted text' done echo export local local echo echo done | | echo "$1"
+	test x=1 echo -eu x=1 /usr/bin sed 'quoted text' | "$@" 'quoted text' awk ${HOME}
+		awk done local ${HOME} /usr/bin x=1 awk grep sed echo grep echo cd sed cd then
+--verbose done && export printf ${HOME} /usr/bin test local then
+--verbose awk then sed x=1 grep
+test grep sed printf "$@"
+	"$1" then printf "$1" then grep test test x=1
+	-eu -eu echo export done then --verbose "$1" ${HOME} "$@"
+		local export grep grep awk --verbose cd | local | printf local
+test export --verbose
+		&& cd then "$@" "$1" test ${HOME} 2>/dev/null readonly "$@" && then && echo $(pwd)
+--verbose && --verbose $(pwd) &&
+test ${HOME} | /usr/bin
+	awk sed done readonly 2>/dev/null done --verbose -eu then awk grep
+	test && grep readonly -eu awk
+	readonly -eu && awk local export awk grep /usr/bin
+awk awk export readonly cd --verbose
+	x=1 awk printf /usr/bin $(pwd) sed 2>/dev/null sed test x=1 "$@" done test
+		"$1" printf 'quoted text' --verbose /usr/bin x=1 ${HOME} printf
+		test echo --verbose export && | && done grep
+	"$1" test sed 'quoted text' local export test 2>/dev/null
+x=1 $(pwd) done echo then sed ${HOME}
+		export cd /usr/bin export test echo then echo awk 'quoted text'
+		local -eu cd then --verbose sed test $(pwd) "$@" then "$@" 'quoted text' cd
+	| -eu $(pwd) printf export | cd awk cd sed 2>/dev/null 2>/dev/null
+echo 'quoted text' export --verbose readonly
+	-eu | echo ${HOME} sed
+		cd 2>/dev/null 2>/dev/null 2>/dev/null ${HOME} export
+cd readonly --verbose readonly
+	${HOME} test x=1 && --verbose /usr/bin 2>/dev/null
+		--verbose awk && readonly sed /usr/bin $(pwd) echo --verbose
+	--verbose ${HOME} -eu "$1" printf /usr/bin /usr/bin cd local cd "$@" && export
+	export then cd test cd -eu cd test sed "$1"
+-eu test x=1 then test local test local $(pwd) /usr/bin
+		echo && -eu printf 'quoted text'
+		cd "$1" test /usr/bin export --verbose grep ${HOME}
+	2>/dev/null sed 'quoted text' --verbose
+grep grep ${HOME} -eu awk cd x=1 "$1" /usr/bin then sed --verbose
+"$@" export echo grep sed grep echo printf
+		local awk "$@" readonly local
+cd local local -eu 'quoted text' "$1" ${HOME} printf
+	&& /usr/bin 'quoted text' echo /usr/bin -eu $(pwd) -eu x=1 --verbose
+		done && x=1 | readonly export --verbose
+cd readonly awk printf
+		local echo readonly ${HOME} /usr/bin printf grep grep test $(pwd) local
+		echo ${HOME} 2>/dev/null export --verbose printf && readonly grep
+	test $(pwd) -eu ${HOME} done grep echo $(pwd) --verbose "$@"
+		'quoted text' --verbose /usr/bin | echo printf local -eu grep $(pwd) --verbose
+"$1" then $(pwd) $(pwd) 'quoted text' printf --verbose
+		then "$@" "$1" done 'quoted text' readonly cd --verbose sed ${HOME} cd
+&& echo $(pwd) test -eu x=1 "$1" 2>/dev/null "$1" "$@" readonly "$@" 'quoted text'
+	echo export export local local export --verbose
+grep | 2>/dev/null printf "$1" 'quoted text' echo printf
+'quoted text' grep "$@" printf then "$@" sed test printf printf echo test
+	/usr/bin $(pwd) sed awk test echo
+	2>/dev/null $(pwd) -eu awk "$@" x=1 'quoted text' export readonly
+"$@" sed done echo sed export sed "$@" test cd sed
+	2>/dev/null then "$1" cd | 'quoted text' $(pwd) 2>/dev/null
+x=1 "$@" awk then sed -eu 'quoted text' /usr/bin && | ${HOME}
+	-eu export --verbose local readonly /usr/bin sed && readonly done
+/usr/bin test && echo --verbose
+x=1 2>/dev/null --verbose done "$@" --verbose
+export readonly && "$1" ${HOME}
+	'quoted text' echo && local
+	sed --verbose done -eu
+awk $(pwd) x=1 printf -eu sed awk local ${HOME} done grep local
+local $(pwd) /usr/bin $(pwd) | done "$@" /usr/bin
+printf 2>/dev/null awk test sed x=1 sed then awk readonly
+'quoted text' 'quoted text'
+sed local cd $(pwd) cd "$@" $(pwd) --verbose /usr/bin --verbose
+'quoted text' sed test /usr/bin /usr/bin $(pwd)
+	"$@" grep local "$1" --verbose && echo x=1 awk $(pwd) sed -eu && export --verbose
+export then test grep ${HOME} grep "$1" | 2>/dev/null
+	printf --verbose "$1" x=1 done test sed export awk -eu 2>/dev/null
+	"$@" printf /usr/bin x=1 printf 'quoted text' grep 2>/dev/null
+	| awk done --verbose 2>/dev/null -eu readonly readonly
+		"$1" /usr/bin x=1 -eu sed test $(pwd) 2>/dev/null
+x=1 cd /usr/bin 'quoted text' export awk grep 2>/dev/null $(pwd) local
+		| x=1 readonly x=1 -eu | cd 2>/dev/null /usr/bin
+		2>/dev/null ${HOME} readonly awk | $(pwd)
+	sed then && $(pwd) "$@" ${HOME} && "$@" -eu local | grep 2>/dev/null /usr/bin
+		grep local | grep export "$1" $(pwd) printf
+		2>/dev/null printf export local x=1 x=1 /usr/bin then
+		"$@" && test printf then readonly
+	/usr/bin "$@" awk sed -eu export test sed x=1
+awk local cd local printf x=1 x=1 done 'quoted text' ${HOME} grep | --verbose -eu
+		awk -eu cd done sed then --verbose x=1
+		test echo | && "$1" awk then | done 2>/dev/null cd 2>/dev/null
+	&& export $(pwd) sed cd $(pwd) | x=1 printf "$@" cd && ${HOME}
+		${HOME} | /usr/bin done local ${HOME}
+2>/dev/null "$1" grep local printf
+	test $(pwd) | test printf grep | ${HOME} done cd "$@" ${HOME}
+awk awk 'quoted text' awk |
+	awk readonly printf "$1" ${HOME} sed
+		&& then "$@" export ${HOME} test $(pwd) -eu --verbose
+--verbose 'quoted text' $(pwd) readonly --verbose printf echo
+	readonly && done test && 2>/dev/null then awk readonly awk |
+		$(pwd) then $(pwd) -eu printf
+$(pwd) | then "$1" && x=1 | 'quoted text' awk 2>/dev/null echo ${HOME}
+	'quoted text' test then $(pwd) -eu awk 'quoted text' 2>/dev/null
+	| test "$1" done $(pwd) done "$@" | grep
+export "$@" readonly $(pwd) printf -eu test && $(pwd) readonly "$1"
+'quoted text' "$1" cd $(pwd) "$1" --verbose
+done && --verbose x=1 --verbose "$@" printf "$1" 2>/dev/null 2>/dev/null sed
+		"$@" "$1" 2>/dev/null awk /usr/bin "$1" sed awk readonly grep "$@"
+		--verbose -eu sed cd
+	cd sed /usr/bin test printf
+	test 2>/dev/null x=1 echo ${HOME} ${HOME}
+"$1" "$1" 2>/dev/null "$@" cd readonly "$@" ${HOME} cd done cd
+		${HOME} | done "$1" then
+2>/dev/null then readonly printf | /usr/bin
+	"$@" ${HOME} done -eu then local "$@" awk readonly export awk x=1 done export
+	readonly cd "$1" local --verbose test awk awk readonly awk "$1" "$@" $(pwd) printf
+grep --verbose 2>/dev/null sed --verbose local
+then x=1 $(pwd) "$1" then sed sed --verbose
+		-eu echo cd -eu cd awk then $(pwd) /usr/bin && && --verbose echo 'quoted text'
+		done "$1" printf test 2>/dev/null then "$@" "$1" awk printf awk
+		2>/dev/null "$1" readonly /usr/bin sed grep -eu cd "$1"
+	x=1 awk local grep --verbose
+		'quoted text' done awk local | done 2>/dev/null /usr/bin printf sed echo awk
+		--verbose $(pwd) cd "$1" "$1" 2>/dev/null $(pwd)
+x=1 ${HOME} /usr/bin printf awk cd /usr/bin -eu
+		'quoted text' awk done 'quoted text'
+	| printf sed export $(pwd) printf /usr/bin "$1" -eu "$1" | | 2>/dev/null echo
+		cd "$@" cd local done grep done -eu export /usr/bin $(pwd) --verbose "$1"
+readonly test local cd test export
+		cd then x=1 cd then awk printf /usr/bin
+--verbose readonly -eu awk 2>/dev/null printf "$@" printf
+		'quoted text' grep echo "$@" $(pwd) readonly
+		/usr/bin -eu /usr/bin test 2>/dev/null ${HOME} --verbose test "$1" then | x=1
+--verbose cd awk awk | /usr/bin grep 'quoted text' local done "$@" 2>/dev/null sed
+$(pwd) $(pwd) /usr/bin then printf local x=1 ${HOME} && "$@" sed
+	${HOME} grep readonly "$@" ${HOME} printf $(pwd)
+		${HOME} awk /usr/bin x=1 | awk readonly $(pwd) 'quoted text' $(pwd) readonly
+	then "$1" -eu $(pwd) "$@" ${HOME}
+-eu export "$1" 2>/dev/null
+	/usr/bin printf local /usr/bin cd cd done -eu local $(pwd)
+	&& grep -eu ${HOME} $(pwd) awk --verbose && echo cd awk test
+	$(pwd) done && readonly echo export /usr/bin echo grep
+	sed x=1 then -eu -eu && done then export echo awk ${HOME} && export 2>/dev/null
+		--verbose printf done --verbose sed sed ${HOME}
+printf && readonly $(pwd) x=1 sed
+done readonly export |
+2>/dev/null "$1" then local /usr/bin export
+2>/dev/null readonly -eu export ${HOME} export -eu -eu grep
+"$1" /usr/bin "$1" /usr/bin done ${HOME} done local done cd sed local readonly
+		${HOME} sed 2>/dev/null $(pwd) readonly ${HOME} printf ${HOME} --verbose "$@"
+then -eu done "$1" 'quoted text' test 2>/dev/null /usr/bin done -eu cd
+| --verbose cd export x=1 test /usr/bin readonly readonly x=1
+printf done --verbose sed | 2>/dev/null test readonly cd sed 2>/dev/null
+		'quoted text' awk local ${HOME} sed echo 2>/dev/null
+		export export printf printf sed x=1 'quoted text' | /usr/bin cd echo
+		2>/dev/null $(pwd) readonly test "$@" --verbose
+		"$@" export $(pwd) ${HOME}
+-eu printf "$@" printf /usr/bin printf "$1" then
+	printf 'quoted text' --verbose 2>/dev/null /usr/bin
+	awk readonly x=1 'quoted text' cd ${HOME} sed printf ${HOME} 2>/dev/null test
+	echo "$1" $(pwd) 'quoted text' "$1" && ${HOME} grep awk -eu 2>/dev/null
+		done && "$1" sed sed readonly | sed
+	grep done export test && local
+test printf -eu && test /usr/bin "$1"
+		--verbose grep | readonly printf test sed done export export
+	then 'quoted text' ${HOME} "$1"
+	cd sed readonly --verbose -eu "$1" echo sed $(pwd) then 2>/dev/null
+	&& sed x=1 then local "$@" && x=1 cd
+		printf done 'quoted text' 'quoted text' test awk 2>/dev/null "$@"
+	sed done readonly /usr/bin done grep
+sed local --verbose && 2>/dev/null
+	x=1 export awk | then
+	/usr/bin x=1 2>/dev/null echo printf done x=1 ${HOME} ${HOME} printf
+		printf | echo awk 2>/dev/null x=1 $(pwd) --verbose $(pwd) | "$1" "$@"
+	export | export $(pwd) echo -eu 2>/dev/null x=1 local "$1" /usr/bin
+		cd 2>/dev/null sed done cd test awk &&
+	grep sed awk $(pwd) 'quoted text' x=1
+		$(pwd) awk && readonly echo done readonly "$@" done
+sed done $(pwd) done "$1" awk
+		| /usr/bin ${HOME} | x=1 cd 'quoted text'
+	local | "$1" export readonly grep
+	export cd "$@" grep then | -eu
+	2>/dev/null grep -eu test echo 2>/dev/null && x=1 awk --verbose
+		test --verbose "$1" 2>/dev/null | "$@" /usr/bin done /usr/bin
+	'quoted text' $(pwd) | && -eu awk 2>/dev/null grep grep $(pwd) export
+		grep grep | ${HOME} "$1" done --verbose $(pwd) "$@" done
+	${HOME} awk 2>/dev/null "$@" export
+		export echo local export printf ${HOME} "$@" "$1" test grep
+		2>/dev/null readonly sed && ${HOME} ${HOME} printf awk
+	2>/dev/null sed awk x=1 x=1 /usr/bin | | 'quoted text' printf "$@" ${HOME} printf
+${HOME} cd printf ${HOME} /usr/bin echo sed 2>/dev/null
+x=1 -eu awk /usr/bin echo --verbose
+sed test cd readonly -eu echo awk | readonly readonly test cd sed sed /usr/bin
+	| sed 2>/dev/null -eu && | "$@" test "$@" printf "$@" "$@" x=1 /usr/bin x=1 grep
+		awk x=1 cd "$1" 2>/dev/null x=1 /usr/bin ${HOME} echo
+readonly readonly export grep grep | cd cd --verbose --verbose
+local sed $(pwd) --verbose export | 'quoted text' --verbose printf ${HOME}
+	${HOME} grep "$1" sed printf | | test cd "$@" done export /usr/bin
+2>/dev/null 2>/dev/null done /usr/bin export
+echo 2>/dev/null "$1" | readonly
+	export sed awk "$@" echo export "$1" grep
+| cd test sed cd | awk "$1"
+x=1 | 'quoted text' --verbose printf awk --verbose
+cd awk "$1" "$@" test printf readonly $(pwd)
+'quoted text' && x=1 sed
+		$(pwd) "$1" awk done && && readonly
+x=1 awk echo "$1" printf 'quoted text'
+		test printf | test export
+		printf 'quoted text' cd 2>/dev/null export && -eu "$@" 'quoted text' /usr/bin
+readonly echo "$1" x=1 grep done
+		"$@" -eu sed sed awk $(pwd)
+	awk awk x=1 then test | local cd
+	'quoted text' /usr/bin && sed export | export -eu | /usr/bin /usr/bin
+	'quoted text' test test sed $(pwd) ${HOME} local /usr/bin 2>/dev/null
+	export echo 'quoted text' $(pwd) local echo grep echo then 'quoted text'
+		| x=1 /usr/bin then readonly test
+	export 2>/dev/null then test
+	2>/dev/null /usr/bin -eu test export "$@"
+${HOME} "$@" test printf
+	x=1 "$1" then "$@" --verbose export /usr/bin local then 2>/dev/null
+		${HOME} "$@" cd test 'quoted text' export $(pwd) printf readonly -eu | then
+	'quoted text' "$@" /usr/bin local | then /usr/bin
+	export | done test printf && echo grep local test then local 2>/dev/null
+local ${HOME} printf then ${HOME} "$@" export --verbose
+	/usr/bin x=1 ${HOME} sed ${HOME} && test
+export done x=1 sed export -eu
+		awk echo readonly x=1 --verbose $(pwd) x=1 "$@" ${HOME} cd
+		printf export echo printf printf readonly cd printf awk done
+	${HOME} ${HOME} x=1 'quoted text'
+	'quoted text' readonly readonly readonly "$1"
+local sed printf then x=1 grep $(pwd) readonly --verbose "$@" $(pwd) printf /usr/bin
+/usr/bin sed local $(pwd) awk "$1" printf printf then "$@" test | /usr/bin grep
+		export --verbose awk grep local ${HOME} local printf x=1 echo
+--verbose x=1 local $(pwd) 2>/dev/null ${HOME} | 2>/dev/null grep cd && export
+		sed 2>/dev/null | 'quoted text'
+echo "$@" then grep $(pwd) ${HOME} | export then -eu echo $(pwd) local ${HOME}
+grep "$@" "$1" then "$@" sed sed done | | grep && done test
+	x=1 /usr/bin /usr/bin x=1 then 'quoted text' "$@" | readonly
+2>/dev/null printf 2>/dev/null "$1" readonly ${HOME} echo x=1 awk "$1"
+export | 2>/dev/null --verbose then cd echo /usr/bin readonly
+	test --verbose "$1" readonly printf $(pwd) $(pwd) echo awk
+--verbose grep x=1 local test 'quoted text'
+sed sed | printf && done ${HOME} $(pwd)
+		test 'quoted text' "$@" then done "$@" ${HOME} readonly
+	awk "$@" "$@" && printf && export done 'quoted text'
+	"$1" 'quoted text' /usr/bin
+2>/dev/null sed "$@" -eu && 'quoted text'
+readonly grep done test printf readonly awk sed printf ${HOME} && "$@" readonly
+		${HOME} "$@" done "$1" ${HOME} x=1 grep && awk cd readonly
+"$1" ${HOME} readonly test | 2>/dev/null "$1" x=1 cd readonly awk readonly
+"$1" test $(pwd) printf x=1 grep printf
+		"$@" | local x=1 --verbose 'quoted text' cd
+		-eu done -eu readonly grep $(pwd) awk echo $(pwd) local ${HOME}
+	readonly printf local local local export x=1 awk
+	/usr/bin 'quoted text' ${HOME} readonly done readonly 'quoted text' sed x=1 readonly
+		'quoted text' x=1 readonly $(pwd) 'quoted text' -eu printf readonly readonly
+/usr/bin grep cd export "$@" echo grep then printf 2>/dev/null -eu
+		&& "$@" ${HOME} && grep | x=1
+	/usr/bin -eu test 'quoted text' | then then 'quoted text'
+	-eu cd /usr/bin local "$@"
+		sed readonly 2>/dev/null then && readonly | x=1
+	then sed printf awk x=1 done $(pwd)
+		awk $(pwd) awk --verbose done done && -eu | local | && awk --verbose
+		awk $(pwd) "$1" -eu test ${HOME} ${HOME} "$1"
+		${HOME} 'quoted text' $(pwd) then local then test
+		$(pwd) "$1" sed --verbose grep export $(pwd) printf then -eu local
+		"$1" && then /usr/bin 2>/dev/null cd x=1 grep
+		export ${HOME} --verbose x=1 local export echo then x=1 test cd done x=1 "$@"
+2>/dev/null awk x=1 local
+		done $(pwd) then printf local test | ${HOME} readonly
+		"$@" awk grep echo cd 2>/dev/null -eu ${HOME}
+'quoted text' grep "$@" sed export $(pwd) x=1 readonly && test /usr/bin then
+| sed printf awk "$@" /usr/bin echo
+echo echo cd local cd "$@" done echo $(pwd) sed done 2>/dev/null local local
+x=1 echo | export printf 2>/dev/null /usr/bin then awk local echo /usr/bin
+cd 'quoted text' awk -eu sed "$@" awk "$@" && export -eu 2>/dev/null
+		test -eu then | then done echo done 'quoted text'
+		--verbose ${HOME} export -eu cd awk grep cd "$@" then --verbose x=1 done
+		2>/dev/null done readonly "$@" "$@" "$@" local
+	cd sed x=1 && -eu 'quoted text' -eu --verbose sed
+export && "$1" then 'quoted text' sed done "$@" "$@" -eu 'quoted text'
+	&& x=1 export then local test x=1 sed 'quoted text' printf
+| awk --verbose awk x=1 -eu "$1" 2>/dev/null
+		export test grep 'quoted text' local
+	${HOME} cd then sed done sed 'quoted text' /usr/bin printf local
+	done 'quoted text' $(pwd) --verbose
+cd -eu x=1 "$@" sed local echo
+		readonly "$@" 2>/dev/null sed grep 2>/dev/null
+'quoted text' export -eu printf done readonly x=1 sed done
+		echo --verbose && "$@" | grep local "$1" -eu test /usr/bin grep local
+		then cd --verbose $(pwd) printf "$1" $(pwd) ${HOME} "$1" echo -eu echo
+	2>/dev/null /usr/bin ${HOME} "$1" awk $(pwd) | 'quoted text'
+		local | 'quoted text' export "$@" done awk ${HOME} then grep printf
+readonly -eu sed | 2>/dev/null echo 2>/dev/null local test test printf 2>/dev/null
+$(pwd) printf printf x=1 x=1 local --verbose sed then x=1 -eu grep
+		--verbose ${HOME} | local printf printf $(pwd) readonly cd local "$1" ${HOME} -eu
+echo $(pwd) then awk ${HOME} | x=1 -eu awk "$@" sed grep --verbose
+		local sed --verbose grep && sed --verbose done sed | export sed
+		awk echo $(pwd) grep
+done /usr/bin x=1 then "$@" then echo test --verbose
+readonly x=1 awk x=1 done && grep readonly
+		test echo 2>/dev/null awk readonly ${HOME} /usr/bin | cd echo printf $(pwd)
+local sed 2>/dev/null test "$@" test $(pwd) cd "$1" -eu ${HOME} export
+${HOME} done local grep cd printf && cd awk /usr/bin awk test awk test x=1
+	| test $(pwd) x=1 | printf "$1" | ${HOME}
+done export "$1" 2>/dev/null
+	"$@" readonly --verbose export -eu readonly cd -eu local
+grep export x=1 printf ${HOME} /usr/bin cd x=1 x=1 /usr/bin cd 2>/dev/null grep
+echo grep ${HOME} $(pwd)
+	x=1 then then test "$1" 2>/dev/null then | $(pwd)
+	test -eu cd echo done awk $(pwd) done local /usr/bin 'quoted text'
+	$(pwd) --verbose 2>/dev/null | grep awk done
+-eu grep local then && awk 'quoted text' x=1 'quoted text'
+	test ${HOME} | done "$@" ${HOME} "$1" readonly | | sed -eu -eu "$1"
+	test sed $(pwd) local 'quoted text' cd cd local
+		&& sed grep readonly then x=1 then 'quoted text'
+		grep --verbose local cd "$@"
+		'quoted text' /usr/bin export grep local "$@" done x=1 cd local && echo
+	"$@" && -eu printf 2>/dev/null ${HOME} done printf 2>/dev/null
+echo done export local echo local then x=1 grep 2>/dev/null
+export printf awk local done cd sed test
+	2>/dev/null --verbose grep echo 2>/dev/null | /usr/bin
+		x=1 /usr/bin 'quoted text' ${HOME}
+		2>/dev/null cd echo echo done ${HOME} x=1 /usr/bin "$@" --verbose test | 'quoted text'
+	sed | --verbose --verbose
+grep then 'quoted text' sed "$@" "$@" 'quoted text' 'quoted text' && | x=1 $(pwd)
+		sed | done done | ${HOME} printf x=1 'quoted text' echo
+x=1 && then printf export printf -eu ${HOME} x=1 $(pwd)
+	--verbose /usr/bin grep && export -eu --verbose cd local "$@" | "$@" test
+		"$1" cd "$@" "$1" cd ${HOME} awk printf && then -eu
+export 'quoted text' local &&
+	local local "$@" ${HOME} readonly ${HOME} | done echo
+	&& && /usr/bin echo then 'quoted text' echo then x=1 local -eu
+	--verbose export echo && && 'quoted text' cd ${HOME} sed
+		'quoted text' local -eu readonly "$@" awk readonly
+	2>/dev/null awk 'quoted text' test local --verbose --verbose 2>/dev/null
+-eu -eu printf && /usr/bin | test x=1 readonly 2>/dev/null
+		echo --verbose local printf | readonly sed && "$1" --verbose
+	-eu -eu sed printf export 'quoted text' awk "$1" $(pwd) awk "$@" cd
+-eu grep readonly sed /usr/bin printf done 2>/dev/null 'quoted text'
+		2>/dev/null export 'quoted text' then readonly
+	readonly $(pwd) $(pwd) echo sed printf echo 'quoted text' echo echo
+sed x=1 sed | 2>/dev/null export $(pwd) x=1 "$@" awk readonly echo $(pwd)
+grep && $(pwd) 2>/dev/null sed grep | then export /usr/bin export
+	-eu "$@" && then then &&
+		sed x=1 local cd "$@" && /usr/bin
+	-eu | sed done export x=1 local /usr/bin sed "$@" awk
+	2>/dev/null then 2>/dev/null done local cd test ${HOME}
+	"$1" readonly test grep local done test sed test export "$1" done
+	done 'quoted text' -eu 'quoted text' | /usr/bin /usr/bin readonly sed done
+	printf ${HOME} grep /usr/bin
+2>/dev/null -eu awk /usr/bin "$1" /usr/bin
+echo --verbose | 2>/dev/null --verbose local
+readonly x=1 done "$@" grep grep then -eu ${HOME} | "$@" readonly
+readonly 'quoted text' -eu test export done "$1" cd | cd ${HOME}
+		/usr/bin --verbose sed -eu --verbose printf done cd $(pwd)
+		--verbose "$1" $(pwd) 'quoted text' test test echo cd --verbose
+	"$@" grep echo "$@" 'quoted text' $(pwd) | printf | echo
+		'quoted text' cd readonly
+	2>/dev/null echo 2>/dev/null /usr/bin test test
+	'quoted text' export awk echo | "$@" readonly 'quoted text' then grep
+	done then 'quoted text' printf done export -eu "$1" ${HOME} $(pwd) done
+test cd -eu local "$@" "$@" --verbose local sed /usr/bin 'quoted text' ${HOME}
+2>/dev/null | x=1 $(pwd) 2>/dev/null
+	local --verbose awk echo 2>/dev/null /usr/bin x=1 readonly cd test readonly
+done readonly ${HOME} then readonly export
+		${HOME} then -eu | grep
+	awk awk export x=1 --verbose
+"$@" export export 'quoted text' awk x=1 ${HOME} "$1" 2>/dev/null
+		local --verbose sed 'quoted text' then
+$(pwd) "$@" -eu 'quoted text' |
+local export 'quoted text' 2>/dev/null readonly
+	--verbose done grep sed --verbose -eu local
+then $(pwd) test --verbose awk
+sed awk 'quoted text' test
+echo "$@" awk cd test done printf echo then export ${HOME}
+		"$@" 'quoted text' "$1" /usr/bin readonly "$1" local
+		export cd && printf grep x=1 "$@" sed && "$1" sed grep
+readonly | awk readonly 'quoted text' && test "$@" ${HOME}
+		cd x=1 grep "$1" ${HOME} && sed /usr/bin test awk then
+	local $(pwd) done 'quoted text' awk | done /usr/bin printf
+echo x=1 | echo && 'quoted text' sed
+		'quoted text' -eu awk "$1" then
+awk awk -eu && test done | awk 'quoted text'
+	x=1 --verbose --verbose printf /usr/bin 'quoted text' 'quoted text'
+	| grep grep local "$@" awk x=1 readonly "$1" /usr/bin grep "$@" test awk &&
+		x=1 sed -eu --verbose
+		printf x=1 2>/dev/null -eu x=1 local -eu "$@" local cd printf && done --verbose
+	export sed "$1" sed /usr/bin export 2>/dev/null local | printf
+		export cd ${HOME} | awk export local
+x=1 --verbose cd --verbose ${HOME} $(pwd)
+echo "$1" 2>/dev/null /usr/bin "$1" x=1 | && readonly "$@"
+done echo "$1" $(pwd) echo awk 2>/dev/null
+	-eu 2>/dev/null /usr/bin then --verbose
+grep $(pwd) echo 'quoted text' local | awk "$@" "$@" --verbose cd done 2>/dev/null
+	done local sed echo echo readonly $(pwd) then x=1 echo && $(pwd) readonly
+	-eu printf awk 2>/dev/null
+		sed echo --verbose test local printf printf $(pwd) test
+	then sed "$1" awk export export echo "$@"
+	| /usr/bin && cd sed readonly then ${HOME} local
+x=1 | "$1" then test ${HOME} grep 2>/dev/null readonly "$@"
+awk ${HOME} "$@" grep done -eu echo
+	-eu /usr/bin readonly local done && readonly sed "$@"
+	sed then --verbose test --verbose x=1 readonly --verbose awk x=1
+	"$1" printf awk --verbose export
+		cd && --verbose x=1 && 'quoted text'
+		echo done ${HOME} test /usr/bin
+		awk cd $(pwd) --verbose "$1" grep then
+readonly printf --verbose awk printf /usr/bin local
+&& | echo then local printf
+	-eu cd /usr/bin | grep printf test | done
+sed "$1" ${HOME} "$@" | awk x=1 sed -eu ${HOME} echo
+		2>/dev/null cd sed awk done && ${HOME}
+		2>/dev/null --verbose --verbose x=1 grep readonly awk $(pwd) awk x=1
+	grep grep ${HOME} ${HOME}
+	-eu export && grep /usr/bin | done test local ${HOME} -eu "$@" printf then awk
+| 'quoted text' then done test "$1" local --verbose sed export
+"$1" echo ${HOME} then $(pwd)
+then "$1" "$@" local grep printf $(pwd) echo
+	--verbose "$1" 2>/dev/null then x=1 -eu export ${HOME} printf echo sed
+		grep echo cd --verbose awk 'quoted text'
+		done echo && then grep grep "$@"
+done 2>/dev/null local done 2>/dev/null export x=1 x=1
+then grep "$@" -eu test awk grep test ${HOME}
+	"$@" x=1 "$1" export test && $(pwd) sed grep readonly
+	--verbose -eu test printf "$1" x=1 2>/dev/null
+	"$1" local readonly readonly ${HOME} --verbose local printf
+$(pwd) printf "$1" export sed done local done | echo "$@" awk 'quoted text'
+$(pwd) --verbose awk printf printf 2>/dev/null
+	printf x=1 /usr/bin /usr/bin sed "$1" readonly sed done sed awk /usr/bin ${HOME}
+then cd test printf printf /usr/bin local export /usr/bin
+		/usr/bin printf 'quoted text' /usr/bin then done ${HOME} /usr/bin
+		awk $(pwd) test "$@" readonly && readonly sed export | cd x=1 echo echo awk
+	sed readonly test grep "$1"
+-eu -eu sed -eu $(pwd) done "$@" -eu | /usr/bin then readonly readonly test
+		-eu echo test readonly &&
+	cd $(pwd) test "$@" export cd awk 2>/dev/null awk -eu $(pwd)
+sed echo awk x=1 | printf
+-eu | -eu ${HOME} grep readonly
+		awk --verbose 'quoted text'
+	"$1" echo 'quoted text' test
+	| "$1" "$@" 'quoted text' ${HOME} readonly then --verbose done
+		2>/dev/null then grep 'quoted text' export $(pwd) export
+	readonly $(pwd) export grep export done done | ${HOME} /usr/bin awk cd readonly
+awk | cd && ${HOME} x=1 grep done -eu grep "$@" export
+		export grep 2>/dev/null --verbose echo awk && test export
+export printf 2>/dev/null awk local local awk
+		readonly then readonly -eu --verbose sed -eu "$1" export sed readonly local local
+grep 'quoted text' echo && echo local "$@" /usr/bin grep x=1 -eu ${HOME}
+		echo 'quoted text' -eu
+	--verbose "$1" x=1 -eu grep -eu sed echo "$@" | ${HOME}
+	'quoted text' -eu $(pwd) ${HOME} printf /usr/bin -eu $(pwd) x=1 "$@" | grep
+		readonly x=1 readonly export test -eu -eu 2>/dev/null "$1" "$1"
+		| | && printf "$1" && printf -eu "$1" -eu echo grep /usr/bin then local /usr/bin
+cd cd echo --verbose done ${HOME} --verbose | &&
+		--verbose "$@" --verbose printf x=1 -eu export 2>/dev/null x=1 local echo /usr/bin
+		'quoted text' --verbose sed done "$@" | ${HOME} --verbose test readonly printf
+	"$@" printf cd x=1 echo printf
+$(pwd) test local /usr/bin ${HOME} -eu ${HOME} sed 2>/dev/null
+	2>/dev/null test --verbose x=1 then
+test grep -eu awk echo awk printf local echo test 'quoted text' $(pwd) | --verbose
+echo && cd ${HOME} "$@" test grep local awk export then grep 2>/dev/null done
+		--verbose grep && printf 2>/dev/null 'quoted text'
+		"$@" export -eu ${HOME} sed 'quoted text'
+		"$1" 2>/dev/null "$@" x=1 local awk printf $(pwd) -eu "$@" "$1" "$@" printf
+	'quoted text' 2>/dev/null
+	'quoted text' x=1 "$@" ${HOME}
+		printf --verbose then -eu && &&
+	echo ${HOME} && 2>/dev/null printf "$1" | local cd --verbose "$1"
+then readonly local ${HOME} printf 2>/dev/null | && then "$@" /usr/bin 'quoted text'
+	"$1" local && echo readonly
+"$1" 'quoted text' | done printf grep echo 'quoted text' done
+		test /usr/bin export
+export test test printf echo done $(pwd) readonly "$1" test cd echo
+-eu then "$1" sed x=1 test awk
+| test x=1 'quoted text' -eu "$1" | $(pwd) x=1 done test export
+		"$@" "$@" -eu 2>/dev/null awk "$1" export | echo "$1" done printf
+		"$@" cd $(pwd) 2>/dev/null "$1" export --verbose test ${HOME} sed
+cd done printf sed 2>/dev/null export
+	x=1 sed test ${HOME} echo 'quoted text' sed $(pwd) grep $(pwd) /usr/bin
+		test cd --verbose readonly | awk x=1 done done 2>/dev/null $(pwd)
+"$@" done test export cd "$@" 'quoted text' grep cd sed &&
+		awk cd 'quoted text' "$@" awk /usr/bin --verbose awk local
+	${HOME} awk done local grep
+	done readonly "$1" grep cd | test cd printf test -eu --verbose awk x=1 2>/dev/null
+	awk then "$@" awk cd -eu local --verbose $(pwd) readonly && test
+		"$@" 'quoted text' done --verbose
+		sed local ${HOME} x=1
+		test readonly /usr/bin 2>/dev/null awk cd ${HOME} $(pwd) "$@" printf
+	readonly "$1" awk test then export --verbose printf "$@" local
+		echo 2>/dev/null grep echo | local
+	readonly local ${HOME} then readonly readonly ${HOME}
+	"$1" "$@" --verbose && && x=1 'quoted text' awk | ${HOME} 'quoted text'
+	then export x=1 printf awk
+	'quoted text' test awk printf export done
+local grep awk awk x=1 local cd
+	local --verbose done local grep | /usr/bin export echo
+'quoted text' echo x=1 --verbose $(pwd) test "$@" 'quoted text'
+awk --verbose $(pwd) --verbose -eu readonly printf done /usr/bin echo "$1"
+readonly echo sed x=1 $(pwd) "$1" && cd grep then /usr/bin "$1" $(pwd)
+${HOME} --verbose ${HOME} && $(pwd)
+	2>/dev/null $(pwd) 2>/dev/null "$1" then
+		--verbose cd export -eu test x=1 local test export x=1 sed then printf test
+	readonly sed grep sed printf "$1"
+		cd | 2>/dev/null ${HOME} ${HOME} ${HOME} sed then
+--verbose && 'quoted text' "$1" && && 2>/dev/null export &&
+export test export x=1 'quoted text' printf
+	2>/dev/null test $(pwd)
+/usr/bin local | cd 'quoted text'
+		-eu -eu local "$1" --verbose readonly /usr/bin "$1" then "$1"
+		echo -eu | local -eu printf ${HOME}
+	2>/dev/null cd "$1" echo test
+		sed local && sed sed export ${HOME} "$1" echo
+	then cd $(pwd) local then
+	echo local readonly grep then done
+		echo echo && test then sed cd export grep local cd "$1" sed x=1 echo ${HOME} &&
+| echo readonly 2>/dev/null done && --verbose -eu printf 2>/dev/null grep
+	awk x=1 x=1 && local -eu printf test /usr/bin sed x=1 --verbose
+then -eu then $(pwd) -eu 'quoted text' printf test | | test
+	--verbose && /usr/bin
+		-eu done cd 'quoted text' x=1 then "$@" "$1"
+sed ${HOME} "$1" then | export grep then ${HOME}
+		export sed echo printf | | && done awk /usr/bin
+	${HOME} awk $(pwd) then && test test /usr/bin
+		${HOME} 'quoted text' printf x=1 --verbose ${HOME} readonly test readonly
+test ${HOME} "$1" && then export $(pwd) cd /usr/bin sed 'quoted text'
+		echo done x=1 && then cd 2>/dev/null "$@" "$@" done 'quoted text' --verbose "$@"
+		--verbose export sed "$1" export "$1" -eu done
+	done | --verbose -eu awk export export printf $(pwd) awk "$@" grep
+		'quoted text' done echo awk awk local
+		grep /usr/bin done ${HOME} x=1 export 'quoted text' -eu local
+	readonly | -eu | test &&
+"$@" "$1" export local export /usr/bin "$@" sed "$@" awk --verbose /usr/bin awk
+		local -eu "$@" "$1" "$1" readonly grep echo export done ${HOME}
+		echo test 2>/dev/null local sed
+	cd ${HOME} cd x=1 $(pwd) -eu
+x=1 test -eu then 2>/dev/null /usr/bin echo test test export "$@"
+	grep export grep 2>/dev/null 2>/dev/null
+		${HOME} test 'quoted text' -eu 'quoted text' echo
+	then | then | export sed export "$1" $(pwd)
+		/usr/bin awk -eu x=1 readonly && local
+	then sed 'quoted text' export readonly cd export cd $(pwd) done done --verbose
+-eu cd sed $(pwd) readonly echo /usr/bin sed done echo | export -eu echo -eu 2>/dev/null
+		test /usr/bin 2>/dev/null export --verbose
+	local "$@" x=1 && /usr/bin readonly x=1 /usr/bin /usr/bin
+/usr/bin done cd x=1 ${HOME} /usr/bin echo $(pwd) awk
+awk done --verbose $(pwd) "$1" grep ${HOME} awk -eu 2>/dev/null
+	printf export --verbose awk
+	2>/dev/null $(pwd) grep "$@" cd awk printf grep sed ${HOME} ${HOME} cd -eu
+--verbose grep readonly sed readonly
+		awk awk cd ${HOME} awk
+cd $(pwd) sed "$@" test -eu readonly | -eu done | readonly grep ${HOME} sed /usr/bin
+		${HOME} ${HOME} then done | --verbose cd cd test "$1" cd awk "$1" export test export
+		grep && "$1" ${HOME} grep 'quoted text' test then echo then ${HOME} done
+	awk awk --verbose cd 'quoted text' grep done
+	"$1" cd "$@" $(pwd) -eu done /usr/bin sed ${HOME} && sed
+then grep $(pwd) done && "$@" x=1 'quoted text'
+	test done --verbose test awk ${HOME} "$1" 'quoted text'
+-eu then done readonly sed 'quoted text' sed /usr/bin /usr/bin
+		readonly test then readonly x=1 test awk export | test 2>/dev/null "$1" grep
+printf export printf readonly sed
+	-eu cd /usr/bin $(pwd) readonly printf
+local export echo ${HOME}
+	2>/dev/null readonly sed cd echo
+export 2>/dev/null grep cd "$1" local export export
+export cd $(pwd) readonly
+test --verbose 2>/dev/null
+export sed | readonly test awk readonly printf
+	done && x=1 "$@" "$1"
+| local --verbose | /usr/bin sed $(pwd) then local 2>/dev/null awk export
+	printf printf then cd ${HOME}
+readonly test 'quoted text' x=1 ${HOME} test sed ${HOME} then cd -eu sed
+	done 2>/dev/null -eu $(pwd) done "$1" test readonly export 2>/dev/null
+'quoted text' cd --verbose done
+		export "$@" | "$@" local local sed awk grep local
+		x=1 readonly 2>/dev/null 'quoted text'
+	${HOME} grep "$@" then export sed ${HOME} sed test then test awk test
+	--verbose cd | done "$@" grep readonly sed x=1 awk test "$1"
+$(pwd) sed local awk "$1" cd local && local readonly then x=1 ${HOME}
+test /usr/bin test awk $(pwd) 'quoted text'
+	grep echo "$@" sed 'quoted text' "$1" | done cd -eu then
+	| "$1" 'quoted text' done cd printf cd "$@" 2>/dev/null
+		grep cd 2>/dev/null && sed
+		then 'quoted text' export && --verbose printf export then echo &&
+	then grep "$1" --verbose -eu "$@"
+	test | /usr/bin cd | printf 'quoted text' test "$1" /usr/bin --verbose | echo
+		printf then ${HOME} 2>/dev/null && --verbose sed
+	printf export x=1 cd $(pwd) && awk export
+		--verbose $(pwd) x=1 sed awk && echo $(pwd) | test
+"$@" echo echo export done $(pwd) "$1" -eu -eu
+		export local cd local 2>/dev/null
+		2>/dev/null test 'quoted text' && awk cd "$1" "$1" | && export
+cd /usr/bin 'quoted text' ${HOME} 'quoted text' cd | --verbose | && printf -eu
+readonly 2>/dev/null 2>/dev/null 'quoted text' test
+	"$@" | && readonly done then
+readonly local x=1 sed "$1" then
+--verbose sed local then awk --verbose then test test /usr/bin
+		${HOME} awk echo readonly 2>/dev/null
+export grep 'quoted text'
+/usr/bin echo test then local "$1" -eu x=1 'quoted text' /usr/bin cd x=1 cd -eu
+		/usr/bin then "$1" readonly printf local 2>/dev/null /usr/bin done
+sed local --verbose readonly test -eu local
+echo -eu /usr/bin /usr/bin | 'quoted text' local done cd --verbose
+then done -eu ${HOME} "$1"
+		export awk echo 'quoted text' printf
+		$(pwd) 'quoted text' $(pwd) echo
+	test /usr/bin readonly && export
+		cd grep awk && --verbose echo 2>/dev/null echo 'quoted text'
+		then test ${HOME} "$1" ${HOME} export
+	local local && done cd then | readonly
+test && done /usr/bin done 2>/dev/null
+	cd x=1 "$1" | cd ${HOME} then
+	sed && done local echo 'quoted text' export
+	| "$1" ${HOME} awk ${HOME} 'quoted text' sed x=1 sed local ${HOME}
+		test x=1 echo printf -eu printf
+	/usr/bin sed test 2>/dev/null test
+	| export awk /usr/bin then
+	done && echo x=1 local export && done readonly readonly && echo readonly --verbose
+2>/dev/null grep $(pwd) done "$@" $(pwd) done printf sed done 'quoted text'
+		echo awk readonly ${HOME} --verbose 2>/dev/null export test
+		local && x=1 export export printf x=1
+	grep -eu grep sed printf export ${HOME} && x=1 x=1 x=1 && -eu readonly
+	"$@" 'quoted text' -eu then
+		export then export test done export
+		${HOME} ${HOME} done ${HOME} 2>/dev/null readonly $(pwd) --verbose --verbose
+| --verbose then | grep export 'quoted text' test 2>/dev/null echo
+${HOME} test test awk printf "$@" --verbose "$@" 'quoted text'
+		/usr/bin export grep cd test test cd printf | /usr/bin | --verbose
+	--verbose export sed done && ${HOME} -eu x=1 cd
+		$(pwd) -eu then 2>/dev/null
+	--verbose echo awk readonly local grep x=1 /usr/bin -eu echo
+	--verbose local 2>/dev/null
+	printf 'quoted text' --verbose awk grep --verbose awk printf 2>/dev/null /usr/bin
+	then cd readonly done "$1" then export
+&& test ${HOME} /usr/bin "$@" "$@"
+	-eu export readonly 2>/dev/null && echo
+	'quoted text' cd done then ${HOME} ${HOME} /usr/bin local
+	local 'quoted text' grep $(pwd)
+		test done printf ${HOME} --verbose readonly printf
+		${HOME} x=1 test && export then && readonly
+		2>/dev/null /usr/bin --verbose
+		'quoted text' cd | 'quoted text' awk sed
+	awk && awk -eu cd $(pwd) x=1 export --verbose "$1" done printf -eu ${HOME}
+export 2>/dev/null grep
+	cd && echo "$@" "$1" sed test "$1" "$@"
+		"$1" awk export /usr/bin
+x=1 printf | awk grep x=1 --verbose sed readonly
+	grep 'quoted text' awk then readonly
+		"$1" && && readonly cd readonly
+	export sed /usr/bin grep $(pwd) echo
+"$1" --verbose readonly
+x=1 grep $(pwd) x=1 local ${HOME} cd then done
+	2>/dev/null -eu --verbose 'quoted text'
+		--verbose $(pwd) --verbose "$1"
+	local && -eu "$@" && | sed export "$@" -eu --verbose done then echo /usr/bin
+		grep sed grep "$@" grep printf done then $(pwd) awk -eu "$@" local $(pwd)
+		"$1" readonly export echo "$@" ${HOME} sed echo "$@" readonly
+	2>/dev/null sed printf $(pwd) sed --verbose x=1 'quoted text' awk && ${HOME} cd
+		local "$1" -eu test && 2>/dev/null echo done echo awk echo export
+$(pwd) sed /usr/bin readonly sed
+		x=1 done printf 2>/dev/null local x=1 grep && export && echo then echo --verbose
+/usr/bin | printf 2>/dev/null
+test -eu --verbose $(pwd) --verbose local | $(pwd) test "$@"
+	then local /usr/bin "$1" grep && "$1"
+	local done /usr/bin $(pwd) /usr/bin printf x=1 done | test printf
+		readonly local && export -eu done | awk then | "$1" "$1" | export test cd cd sed
+2>/dev/null done grep grep readonly && grep echo ${HOME}
+	sed --verbose done grep done sed cd then export x=1 grep "$1"
+sed $(pwd) test local 2>/dev/null 'quoted text'
+		| | ${HOME} test echo &&
+then test awk done grep "$1"
+		&& awk test sed printf /usr/bin
+		/usr/bin "$@" | echo --verbose --verbose && 'quoted text' "$@" 'quoted text'
+		$(pwd) printf echo ${HOME} done local 'quoted text' readonly | done
+	cd --verbose echo grep then ${HOME} sed /usr/bin echo 'quoted text'
+	"$1" 2>/dev/null 'quoted text' export done awk -eu
+	test "$1" awk /usr/bin cd echo echo echo test --verbose
+then test /usr/bin cd grep done && awk --verbose sed
+		--verbose printf -eu printf x=1 local awk test 'quoted text'
+	$(pwd) local $(pwd) test ${HOME}
+	readonly readonly 'quoted text' -eu "$1" $(pwd) /usr/bin local && |
+	"$@" ${HOME} local 2>/dev/null 'quoted text'
+		"$@" /usr/bin readonly "$@" | -eu --verbose
+	printf | awk printf $(pwd) "$1" sed /usr/bin awk
+		export readonly ${HOME} "$1" /usr/bin 2>/dev/null ${HOME}
+		$(pwd) done "$1" && local awk && 'quoted text' | 2>/dev/null --verbose done awk
+		awk 2>/dev/null $(pwd) x=1 /usr/bin
+	--verbose | -eu -eu cd 'quoted text' printf
+		awk x=1 local $(pwd) && grep ${HOME} $(pwd)
+	| grep cd /usr/bin --verbose done /usr/bin -eu test -eu awk 'quoted text'
+sed && sed grep ${HOME} cd then x=1 -eu printf
+		${HOME} "$1" && x=1 | --verbose readonly -eu ${HOME} /usr/bin /usr/bin
+-eu 'quoted text' awk local sed local
+	export 'quoted text' printf done echo done $(pwd)
+		done local awk cd x=1 then awk | readonly
+$(pwd) readonly export "$1" -eu grep /usr/bin
+		-eu printf | test $(pwd) test ${HOME} export $(pwd)
+		echo $(pwd) readonly cd done then 2>/dev/null
+		"$1" local 2>/dev/null cd local 2>/dev/null 2>/dev/null ${HOME} $(pwd) cd local
+	grep "$1" done cd 2>/dev/null /usr/bin
+	printf --verbose $(pwd)
+local /usr/bin $(pwd) --verbose done $(pwd)
+		x=1 sed sed -eu printf readonly
+	x=1 "$1" sed printf "$1" && --verbose awk cd then then 2>/dev/null
+	'quoted text' 2>/dev/null && $(pwd) readonly export
+	$(pwd) test ${HOME} && $(pwd) 'quoted text' --verbose x=1 | 'quoted text'
+2>/dev/null test done "$1" printf test sed --verbose awk awk then && sed awk
+export readonly echo sed test echo echo ${HOME} sed cd
+grep "$1" export done --verbose && "$1" /usr/bin 2>/dev/null
+	&& && /usr/bin local /usr/bin ${HOME}
+/usr/bin test /usr/bin cd printf
+awk done sed --verbose 'quoted text' test then printf printf
+	then done "$1" export 2>/dev/null
+	grep -eu export $(pwd) cd ${HOME} readonly printf ${HOME}
+	/usr/bin then then cd $(pwd) x=1 ${HOME} -eu grep sed --verbose "$1" /usr/bin
+	| && "$1" /usr/bin echo -eu 'quoted text' cd printf x=1 cd $(pwd) 2>/dev/null "$@"
+&& then printf "$1" | export x=1 ${HOME} printf
+&& grep -eu "$@" "$1" echo echo local done sed && export export
+local --verbose test /usr/bin sed -eu -eu && -eu
+then --verbose local export x=1
+	$(pwd) printf /usr/bin --verbose
+	x=1 grep --verbose /usr/bin awk "$1" ${HOME} $(pwd) test 2>/dev/null
+	echo sed "$1" ${HOME} -eu --verbose local 'quoted text' test local "$1" readonly
+	x=1 ${HOME} printf sed 2>/dev/null
+2>/dev/null x=1 /usr/bin 'quoted text'
+	readonly --verbose 2>/dev/null done 2>/dev/null done export
+	local -eu done /usr/bin ${HOME}
+	-eu $(pwd) done done echo test "$1" cd readonly | cd x=1 2>/dev/null local printf
+	readonly && sed $(pwd) 'quoted text'
+	printf readonly grep --verbose | readonly grep -eu export
+		'quoted text' grep done --verbose export
+cd && test --verbose 2>/dev/null local test then
+echo cd --verbose printf test "$@" test
+done --verbose | ${HOME} 'quoted text' x=1 export -eu | export grep export
+'quoted text' done printf "$@" readonly local 'quoted text'
+then -eu cd echo cd cd awk && -eu "$1" done readonly "$1" "$@" readonly then &&
+	&& awk printf "$1" local $(pwd) echo
+	2>/dev/null ${HOME} local sed x=1 cd $(pwd) -eu printf done "$1" ${HOME} readonly
+${HOME} ${HOME} echo done then cd cd then printf 2>/dev/null /usr/bin 2>/dev/null
+	-eu 2>/dev/null $(pwd) 'quoted text'
+		"$1" echo readonly ${HOME} 'quoted text' --verbose awk
+	then export export export 2>/dev/null local
+	readonly 'quoted text' sed export sed
+		| done then 2>/dev/null local grep ${HOME} $(pwd) -eu --verbose readonly "$1"
+		"$@" ${HOME} grep /usr/bin "$@" done printf printf 2>/dev/null
+		local ${HOME} /usr/bin && printf cd test 2>/dev/null readonly
+	cd $(pwd) 'quoted text' printf printf
+$(pwd) awk $(pwd) test readonly sed 'quoted text' 'quoted text' then $(pwd)
+	sed readonly export $(pwd)
+	grep ${HOME} awk then | "$@" "$1" | printf cd export
+	2>/dev/null /usr/bin -eu 'quoted text' ${HOME} readonly cd && printf
+		'quoted text' $(pwd) echo 2>/dev/null --verbose /usr/bin x=1 awk
+		done sed 'quoted text' | "$@" ${HOME}
+		"$@" | test printf -eu awk 'quoted text'
+&& readonly export 2>/dev/null local x=1
+	${HOME} ${HOME} sed export local 2>/dev/null then test test | local
+readonly 'quoted text' $(pwd) grep 2>/dev/null awk 2>/dev/null | awk sed
+export /usr/bin grep | done sed printf readonly sed echo sed readonly && 'quoted text'
+echo $(pwd) "$1" grep "$1" | test
+		export readonly grep --verbose printf /usr/bin 'quoted text'
+2>/dev/null then "$1" test ${HOME} sed "$1" && x=1 "$@" $(pwd) "$1"
+	-eu "$1" readonly 'quoted text' sed sed sed /usr/bin | -eu
+	&& "$1" done 'quoted text' grep
+	-eu && readonly sed readonly local awk sed sed readonly
+"$1" export printf | done 2>/dev/null cd cd test "$1" test
+	printf grep && x=1 $(pwd) 'quoted text' ${HOME} "$@" then then --verbose 2>/dev/null
+-eu local echo $(pwd) -eu
+x=1 "$1" 2>/dev/null cd
+'quoted text' -eu then awk 2>/dev/null ${HOME} x=1
+grep cd local cd echo awk -eu done 'quoted text' 2>/dev/null /usr/bin
+	&& | 'quoted text' ${HOME} "$@" && printf "$1" readonly sed $(pwd)
+	awk && 2>/dev/null export cd 2>/dev/null
+		-eu awk | awk --verbose echo 2>/dev/null && 'quoted text' readonly $(pwd) && grep
+'quoted text' && export "$1" done sed
+"$@" sed awk && grep grep awk test local echo then --verbose ${HOME}
+readonly then test --verbose sed && x=1 $(pwd) local grep readonly /usr/bin
+grep x=1 test printf && cd echo /usr/bin local printf sed printf ${HOME} 2>/dev/null
+cd printf -eu --verbose awk grep
+2>/dev/null done echo | echo $(pwd)
+	cd && cd sed x=1 /usr/bin | "$1" test -eu | readonly sed 2>/dev/null
+		${HOME} | grep awk done sed echo
+	"$1" done grep | echo "$1"
+	printf awk 'quoted text' done grep test ${HOME} 'quoted text' grep
+		"$1" "$@" $(pwd) grep "$1" /usr/bin -eu 'quoted text' x=1 -eu "$@"
+-eu export test --verbose printf "$@" $(pwd) awk printf
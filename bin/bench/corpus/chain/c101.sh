@@ -0,0 +1,2001 @@
+export sed readonly "$@" "$@" local
+-eu sed then $(pwd) grep "$1" export
+"$@" $(pwd) local grep export
+		$(pwd) | && export export -eu
+		grep cd $(pwd) sed grep local awk 'quoted text' -eu export
+	grep $(pwd) $(pwd) | then awk "$@" && local export printf /usr/bin printf
+		"$@" /usr/bin ${HOME}
+printf grep grep test cd --verbose
+		&& echo printf local readonly awk "$1" "$1" export sed
+awk cd done ${HOME} "$1" -eu
+	export test local printf readonly x=1 sed x=1 $(pwd) /usr/bin "$@"
+		export 'quoted text' then export -eu awk grep
+		| "$@" then --verbose x=1 | printf cd readonly /usr/bin
+		'quoted text' local cd 'quoted text' cd cd test test printf cd x=1
+done printf 2>/dev/null 'quoted text' /usr/bin
+		then then --verbose grep | done /usr/bin &&
+printf awk 2>/dev/null echo /usr/bin awk done test grep 2>/dev/null
+'quoted text' /usr/bin
+		'quoted text' grep sed && awk /usr/bin | awk sed
+	2>/dev/null export "$1" export
+		2>/dev/null | $(pwd) readonly
+		'quoted text' readonly cd && && /usr/bin
+		'quoted text' readonly done "$@" && "$@"
+	printf && $(pwd) readonly /usr/bin | readonly done $(pwd) -eu
+	| readonly awk -eu test /usr/bin export $(pwd)
+-eu 2>/dev/null sed 2>/dev/null printf export
+		awk "$1" echo printf local $(pwd) x=1 cd --verbose cd
+	awk $(pwd) "$1" x=1 cd done local
+	&& ${HOME} echo export | -eu ${HOME}
+		cd grep && then 2>/dev/null && export && -eu
+		x=1 done done export | ${HOME}
+	echo local $(pwd) printf -eu "$1" 2>/dev/null export printf 'quoted text'
+	/usr/bin /usr/bin printf cd x=1 readonly
+	| readonly --verbose $(pwd) && ${HOME} cd readonly sed "$@" then
+		export x=1 -eu $(pwd) "$1"
+	test && "$1" ${HOME} 'quoted text' /usr/bin --verbose then echo ${HOME} test
+		then local x=1 cd x=1 awk && 'quoted text' cd printf
+		--verbose $(pwd) ${HOME} test readonly export echo then then &&
+	readonly | awk && local
+readonly export ${HOME} --verbose grep awk export awk sed
+		test $(pwd) local --verbose 2>/dev/null
+echo echo 2>/dev/null grep | then && echo && echo readonly local
+		/usr/bin printf done 2>/dev/null grep awk ${HOME} done test
+		/usr/bin export 'quoted text' awk x=1 /usr/bin 2>/dev/null $(pwd)
+	export --verbose | test then test local --verbose
+"$1" x=1 cd test grep grep awk "$1" sed ${HOME} grep /usr/bin local
+		2>/dev/null "$@" "$1" 2>/dev/null --verbose "$@"
+		/usr/bin grep sed $(pwd) "$@" -eu test grep done readonly
+		echo && grep export then
+	${HOME} $(pwd) grep "$@" readonly && "$@" /usr/bin awk 'quoted text'
+		cd export grep echo local $(pwd) && 'quoted text' echo
+		then /usr/bin done 'quoted text' local cd test done "$1"
+		x=1 echo cd readonly 'quoted text' printf local local x=1 "$@" $(pwd) sed
+		sed 'quoted text' printf 'quoted text' --verbose awk test $(pwd) /usr/bin
+		cd grep 2>/dev/null 'quoted text' ${HOME} grep then -eu ${HOME} done then
+		--verbose /usr/bin export
+	"$@" printf $(pwd) "$1" $(pwd)
+	cd cd test && /usr/bin | 'quoted text' local export cd 'quoted text' x=1 then
+awk sed printf 'quoted text' && sed $(pwd)
+local export readonly export -eu ${HOME} cd test -eu ${HOME} printf
+	'quoted text' printf ${HOME} grep export "$@" 'quoted text'
+	--verbose awk ${HOME} local test
+then && cd && awk local echo -eu /usr/bin sed
+$(pwd) 'quoted text' export 'quoted text'
+	export printf 'quoted text' printf readonly 'quoted text' sed readonly
+		sed echo sed x=1 ${HOME} &&
+		local done | readonly 'quoted text' printf readonly x=1 cd "$@" ${HOME} | sed
+echo export "$@" --verbose
+sed "$1" readonly printf 2>/dev/null "$@" readonly ${HOME} test
+	then printf sed --verbose cd "$1" echo local echo
+	2>/dev/null done && &&
+		'quoted text' then readonly cd --verbose
+${HOME} 'quoted text' /usr/bin then
+	--verbose /usr/bin done sed $(pwd) "$@" test 2>/dev/null awk done
+$(pwd) $(pwd) -eu && grep awk local 2>/dev/null done /usr/bin echo export
+2>/dev/null 2>/dev/null sed readonly sed
+	printf sed done printf /usr/bin sed "$@" echo --verbose | grep test "$1"
+		done sed 'quoted text' echo -eu grep $(pwd) x=1 "$1" test cd
+/usr/bin 'quoted text' printf | 'quoted text'
+test --verbose cd x=1 "$@"
+		--verbose && sed done awk -eu "$1" 2>/dev/null "$1" readonly
+/usr/bin readonly export
+readonly | 2>/dev/null ${HOME}
+		"$@" done --verbose x=1 printf awk
+	then awk sed echo 'quoted text' "$@" "$@"
+	grep -eu printf "$1" | | awk then | $(pwd) "$@" printf
+		--verbose 'quoted text' | grep x=1 /usr/bin done
+		x=1 "$@" /usr/bin done && 2>/dev/null "$1" awk test printf
+		${HOME} "$1" "$1" cd --verbose ${HOME} done --verbose ${HOME} awk local 2>/dev/null
+		then export export "$1" then ${HOME} "$@" "$@"
+	2>/dev/null sed local sed test readonly "$1" $(pwd) 'quoted text'
+		export then 2>/dev/null -eu --verbose
+&& 2>/dev/null test ${HOME} -eu
+$(pwd) 'quoted text' "$@" done printf && done && | --verbose
+--verbose readonly x=1 -eu awk 'quoted text' 'quoted text' | awk /usr/bin
+then | -eu 'quoted text' readonly echo /usr/bin test -eu 'quoted text' $(pwd)
+		$(pwd) ${HOME} export /usr/bin --verbose --verbose then grep export $(pwd) then
+	grep test done 2>/dev/null 'quoted text' done sed $(pwd) x=1
+$(pwd) x=1 test --verbose x=1 local $(pwd) export && -eu /usr/bin
+--verbose 'quoted text' echo cd
+	2>/dev/null sed readonly done echo awk --verbose && sed
+		-eu awk ${HOME} ${HOME} cd /usr/bin
+	&& local $(pwd) | --verbose $(pwd) -eu && awk echo /usr/bin --verbose "$1"
+"$@" 'quoted text' export test -eu test "$1" && ${HOME} 'quoted text'
+	"$@" ${HOME} ${HOME} echo ${HOME} cd -eu
+		cd cd 2>/dev/null x=1 awk 'quoted text' $(pwd) export
+		| awk done 'quoted text' local test printf x=1 'quoted text'
+	"$@" | 'quoted text' /usr/bin then 'quoted text' x=1 $(pwd)
+/usr/bin grep $(pwd) && | -eu && 2>/dev/null -eu echo cd test cd 2>/dev/null
+		"$@" 'quoted text' --verbose
+	local sed awk grep echo /usr/bin "$@" && echo
+	printf local x=1 cd "$@" $(pwd) export ${HOME}
+	$(pwd) "$1" export echo
+		export printf x=1 /usr/bin && printf test
+	| -eu echo 2>/dev/null then x=1 $(pwd) printf readonly sed grep 'quoted text'
+printf echo "$1" local done echo /usr/bin x=1
+	"$@" x=1 /usr/bin awk
+2>/dev/null cd $(pwd) | "$1" /usr/bin cd readonly "$1" "$@" readonly
+	test printf 'quoted text' /usr/bin then
+	export local cd 'quoted text' awk 'quoted text' | echo test
+sed sed readonly /usr/bin -eu awk
+		then then grep $(pwd) sed /usr/bin /usr/bin echo
+	printf ${HOME} local ${HOME} printf echo /usr/bin readonly |
+	export x=1 sed printf ${HOME}
+$(pwd) test sed "$1" --verbose export
+	awk awk export -eu awk readonly && cd then && printf
+		"$@" && "$@" 'quoted text' /usr/bin 'quoted text' done /usr/bin /usr/bin
+export grep -eu --verbose 'quoted text' x=1 && cd $(pwd)
+export grep --verbose readonly awk grep x=1
+	| cd printf && --verbose test
+'quoted text' --verbose printf local | then export "$@" sed && -eu
+	${HOME} cd readonly 2>/dev/null 'quoted text' ${HOME} local grep
+sed x=1 grep sed cd --verbose done sed "$1" 2>/dev/null && 2>/dev/null
+		cd grep 'quoted text' ${HOME} grep "$1" cd grep | echo test 2>/dev/null
+		/usr/bin printf /usr/bin sed local "$1"
+	"$1" printf && sed ${HOME} awk 2>/dev/null
+		readonly x=1 done cd cd ${HOME} && ${HOME} awk then awk 'quoted text'
+	x=1 awk readonly "$@" test && /usr/bin "$@" "$@" grep 2>/dev/null cd sed printf
+		cd printf ${HOME} awk cd echo x=1
+export -eu "$@" /usr/bin "$1" x=1 && /usr/bin
+		'quoted text' x=1 'quoted text' 'quoted text' cd $(pwd)
+"$@" 2>/dev/null grep test done --verbose
+		${HOME} --verbose cd ${HOME} && /usr/bin $(pwd) grep | local
+		${HOME} "$@" grep "$1" "$1" -eu export --verbose "$@"
+	"$@" x=1 readonly echo readonly
+		x=1 grep ${HOME} sed sed $(pwd) readonly test local test "$1" | | ${HOME}
+		printf | then $(pwd) then done /usr/bin "$@" "$1" then -eu done ${HOME} ${HOME}
+	local 'quoted text' | $(pwd) cd done export cd /usr/bin export then /usr/bin
+x=1 $(pwd) && done /usr/bin --verbose
+		'quoted text' done 'quoted text' grep then done grep 'quoted text'
+	"$1" 'quoted text' sed readonly 'quoted text' readonly then grep then done
+'quoted text' echo -eu grep x=1 x=1 -eu /usr/bin --verbose
+	done "$@" "$1" echo sed local cd test local -eu export x=1
+"$@" awk "$1" -eu printf cd local && ${HOME}
+	local && ${HOME} x=1 echo sed printf readonly /usr/bin printf echo printf grep
+then cd x=1 --verbose awk awk then $(pwd) "$1" done "$@" -eu && && sed then sed
+		&& | /usr/bin | $(pwd) "$@" test then export local cd printf
+	local local sed x=1 "$@" echo x=1 -eu
+"$1" test -eu export -eu ${HOME} "$1" echo --verbose readonly ${HOME}
+		export awk sed --verbose done then x=1
+	local /usr/bin then test &&
+	"$1" test readonly done "$@" x=1 test then cd | grep done sed done
+test /usr/bin ${HOME} awk "$1" sed /usr/bin -eu test then 2>/dev/null done 'quoted text'
+	then /usr/bin echo export ${HOME} test && sed && echo ${HOME}
+--verbose && ${HOME} $(pwd) "$@" local x=1
+| ${HOME} then cd cd --verbose grep 'quoted text' 'quoted text'
+	export "$1" "$1" | && -eu 2>/dev/null local printf done export "$1"
+test 'quoted text' /usr/bin | /usr/bin --verbose 'quoted text'
+		&& local x=1 done $(pwd)
+	$(pwd) cd "$@" /usr/bin $(pwd) export | && x=1 done echo --verbose 'quoted text'
+	&& done sed 'quoted text' cd cd /usr/bin "$@" "$@" cd /usr/bin
+'quoted text' 'quoted text' grep grep awk grep x=1 /usr/bin
+readonly local grep $(pwd) export sed 2>/dev/null --verbose && && awk done "$1"
+	${HOME} then $(pwd) && 2>/dev/null readonly
+		"$@" ${HOME} then local 'quoted text'
+2>/dev/null 'quoted text' $(pwd) "$@" readonly -eu cd
+x=1 export $(pwd) | /usr/bin export "$@" cd test "$@" sed
+awk | readonly then awk && printf -eu
+		test local sed "$@" /usr/bin | local "$@" awk ${HOME}
+		x=1 local "$@" local -eu echo --verbose 2>/dev/null test ${HOME} then | echo
+	local 'quoted text' -eu grep && test grep readonly grep -eu x=1
+		2>/dev/null && printf local $(pwd) export -eu cd sed sed | local x=1
+		local "$1" test export && sed awk /usr/bin readonly test cd /usr/bin "$1"
+		then then -eu test x=1 "$@" "$1"
+	echo ${HOME} && sed grep local 2>/dev/null $(pwd) "$1" 2>/dev/null "$1" sed
+	sed ${HOME} "$1" readonly 2>/dev/null 'quoted text' | test ${HOME}
+	'quoted text' "$@" 'quoted text' echo $(pwd) /usr/bin
+then $(pwd) printf then
+	| local cd x=1 "$@" -eu -eu readonly && ${HOME} $(pwd) 2>/dev/null cd printf
+		"$@" "$1" "$1" 'quoted text' "$@" "$1" printf
+done 'quoted text' export done $(pwd)
+export ${HOME} awk awk local
+		${HOME} ${HOME} export
+	'quoted text' sed test -eu readonly --verbose
+		sed | export "$@" grep "$1" done cd sed 'quoted text' then -eu then /usr/bin
+	then /usr/bin x=1 "$@" readonly 'quoted text' printf test then $(pwd)
+--verbose printf sed $(pwd) 'quoted text' x=1
+	&& 2>/dev/null "$1" x=1 readonly echo export readonly "$@" then awk cd -eu
+		2>/dev/null cd && echo -eu 'quoted text' "$1" export sed awk
+	-eu echo printf --verbose 2>/dev/null export && grep "$1" $(pwd) sed 'quoted text'
+	printf "$@" ${HOME} "$@" 2>/dev/null /usr/bin /usr/bin local
+		/usr/bin printf --verbose && test
+${HOME} x=1 x=1 export x=1 sed printf | | test sed ${HOME} $(pwd) test
+local ${HOME} printf x=1 'quoted text' &&
+		cd 2>/dev/null export && --verbose readonly && test ${HOME}
+printf done /usr/bin "$@"
+		"$@" done awk | $(pwd) cd /usr/bin
+	printf x=1 2>/dev/null export awk $(pwd) readonly sed --verbose
+/usr/bin -eu 'quoted text' printf --verbose
+-eu "$@" test sed /usr/bin grep | done 2>/dev/null | readonly
+'quoted text' && echo awk
+${HOME} /usr/bin grep && echo sed x=1 done --verbose
+${HOME} $(pwd) local --verbose printf $(pwd) sed x=1 awk 'quoted text' --verbose
+	then done /usr/bin local /usr/bin done grep grep printf
+		cd awk export --verbose echo /usr/bin printf $(pwd) local
+		local grep local readonly export $(pwd) cd x=1 printf | -eu readonly echo
+export --verbose export --verbose then /usr/bin grep awk x=1 awk 'quoted text'
+		printf printf 2>/dev/null ${HOME} -eu ${HOME} 2>/dev/null /usr/bin
+		&& echo -eu ${HOME} --verbose $(pwd) ${HOME} grep --verbose
+	${HOME} cd /usr/bin sed -eu /usr/bin
+	local --verbose cd readonly local done 2>/dev/null "$1" ${HOME} x=1 test x=1 cd
+	local && ${HOME} -eu 'quoted text' done
+2>/dev/null -eu -eu grep local "$1"
+then $(pwd) done "$1" -eu
+awk ${HOME} 2>/dev/null printf readonly printf sed then
+local x=1 printf cd "$@" export
+		2>/dev/null "$@" "$1" echo
+	2>/dev/null --verbose test -eu cd ${HOME} local
+	&& export && ${HOME} x=1 $(pwd) export then export
+	cd 2>/dev/null x=1 /usr/bin
+		local readonly --verbose printf &&
+then | awk cd /usr/bin x=1 cd | readonly echo done export printf export -eu
+-eu printf sed printf echo | ${HOME} --verbose cd printf grep 'quoted text'
+	done "$1" done awk --verbose grep ${HOME} $(pwd) done --verbose local
+	grep "$@" --verbose sed x=1 x=1 && grep --verbose
+	export sed local local echo 2>/dev/null
+echo "$@" | $(pwd) "$1" export grep ${HOME}
+	local done && then echo grep then ${HOME} echo cd sed ${HOME}
+	2>/dev/null sed 'quoted text' $(pwd) done && 2>/dev/null done -eu printf -eu local
+	"$1" "$1" ${HOME} x=1 /usr/bin test "$@" awk --verbose x=1 then
+		x=1 then echo && local awk /usr/bin export /usr/bin readonly
+x=1 cd cd --verbose sed readonly
+	| "$@" export "$@" done && "$@" 2>/dev/null cd /usr/bin x=1 test local sed
+$(pwd) "$@" ${HOME} cd -eu "$@" && "$1" /usr/bin
+	$(pwd) printf "$1" $(pwd) | cd "$@" local printf local "$@" grep test
+export done local awk export | "$1" echo echo ${HOME}
+		-eu export test --verbose cd ${HOME} && printf awk
+		x=1 2>/dev/null --verbose "$@" x=1 ${HOME} $(pwd) ${HOME} x=1 then
+x=1 local readonly | "$1" "$1" /usr/bin cd | cd
+		printf echo x=1 'quoted text' echo
+	${HOME} ${HOME} export printf /usr/bin 'quoted text' /usr/bin x=1 --verbose
+		'quoted text' && readonly awk readonly $(pwd) awk
+		test && 'quoted text' && 2>/dev/null
+	-eu test then /usr/bin grep test --verbose
+echo test -eu ${HOME} printf ${HOME} echo grep
+$(pwd) | ${HOME} export && then $(pwd) | export done "$@"
+	"$@" echo printf -eu printf
+$(pwd) "$@" --verbose sed ${HOME} sed ${HOME}
+then "$@" export "$1" readonly $(pwd)
+cd readonly --verbose cd done /usr/bin
+${HOME} && echo then grep export
+		x=1 "$1" cd local | done test -eu | awk export done ${HOME} awk ${HOME}
+-eu 'quoted text' local x=1 'quoted text'
+		readonly ${HOME} "$@" $(pwd) readonly test export -eu export export $(pwd) printf
+		printf x=1 echo local grep $(pwd)
+	$(pwd) then ${HOME} echo --verbose /usr/bin "$1" --verbose "$1" ${HOME}
+"$@" $(pwd) printf "$1" readonly --verbose /usr/bin && done done --verbose
+		printf printf echo 2>/dev/null
+awk cd export $(pwd) done -eu $(pwd) printf && "$1" 'quoted text' sed
+		grep local cd 'quoted text' awk
+		/usr/bin cd printf $(pwd) printf test grep | awk grep
+grep -eu cd 2>/dev/null && "$1" 2>/dev/null local test && | /usr/bin /usr/bin
+	--verbose && export then sed "$@" echo -eu grep x=1
+	awk then local --verbose "$1" --verbose 2>/dev/null
+	2>/dev/null && && "$@" printf /usr/bin readonly
+		local export awk cd echo local
+		-eu done "$@" grep echo local export then grep && --verbose
+		echo $(pwd) ${HOME} grep readonly sed | grep 'quoted text'
+readonly test grep done 'quoted text'
+	--verbose "$1" printf /usr/bin ${HOME} "$@" --verbose export sed done awk --verbose
+	"$@" readonly echo 'quoted text' readonly $(pwd) "$1" $(pwd) x=1 x=1 export then
+	"$1" --verbose printf printf
+	local test "$1" printf "$1" && ${HOME} 'quoted text'
+	grep cd cd local /usr/bin grep readonly -eu $(pwd) grep "$1" done
+		grep $(pwd) then -eu done x=1
+echo export | export $(pwd) then test | echo 'quoted text'
+		awk ${HOME} sed -eu $(pwd) "$1"
+	test done done $(pwd) awk readonly
+		'quoted text' cd "$@" echo echo "$@" $(pwd) readonly
+	local x=1 echo done ${HOME} 'quoted text' local x=1 readonly | -eu "$1" x=1
+	then cd 2>/dev/null 'quoted text'
+then "$@" ${HOME} ${HOME} done 2>/dev/null 'quoted text'
+		"$@" printf | test done test readonly test then 'quoted text' local local $(pwd)
+	--verbose echo && cd grep cd done 2>/dev/null printf /usr/bin
+	/usr/bin -eu $(pwd) done x=1 grep test export done 2>/dev/null
+done echo export | echo 'quoted text' -eu grep then cd then awk printf awk local
+'quoted text' local && "$1"
+	"$1" grep grep --verbose
+"$@" printf printf 2>/dev/null printf grep export
+	2>/dev/null sed printf ${HOME} cd cd printf 'quoted text' | 2>/dev/null
+done ${HOME} ${HOME} && sed sed echo local "$1" export -eu "$1" 'quoted text'
+	2>/dev/null done "$1" grep && cd "$1" done cd done "$1" test echo | test 2>/dev/null
+"$@" "$1" 2>/dev/null && local 'quoted text'
+'quoted text' 'quoted text'
+	&& done test readonly $(pwd) x=1 local export export 'quoted text'
+		${HOME} echo "$1" local | cd
+		echo done echo test | --verbose ${HOME} export sed 'quoted text' "$1" "$1" done
+		printf done "$1" export printf /usr/bin
+	2>/dev/null then cd awk ${HOME} $(pwd) local readonly awk then "$1" -eu sed
+	export "$1" /usr/bin done --verbose /usr/bin local readonly "$1" /usr/bin
+	--verbose local -eu "$1" cd
+	done echo printf cd -eu x=1 "$1" -eu readonly cd
+then awk -eu echo 'quoted text'
+		grep | && grep x=1 "$@" grep
+		test 2>/dev/null test echo grep then printf
+		export "$@" 'quoted text' done readonly
+	/usr/bin /usr/bin done echo &&
+x=1 cd -eu 2>/dev/null awk printf echo done --verbose grep echo
+		done printf "$1" -eu "$@" done -eu ${HOME} /usr/bin
+	-eu --verbose awk export sed --verbose ${HOME} cd && x=1 && then
+"$@" then local /usr/bin readonly cd local readonly "$@"
+local grep echo sed ${HOME} /usr/bin
+printf readonly ${HOME} && --verbose local echo echo -eu local "$1"
+	&& awk 'quoted text' test
+test then | "$@" 2>/dev/null cd
+x=1 --verbose then local --verbose printf 2>/dev/null
+		/usr/bin printf grep -eu &&
+&& readonly "$1" --verbose
+		local x=1 then sed done readonly | printf /usr/bin grep -eu x=1 then
+done 'quoted text' cd 2>/dev/null && && 'quoted text' "$1" printf grep sed printf
+		export test --verbose
+then "$1" 2>/dev/null ${HOME} 'quoted text'
+		'quoted text' -eu echo --verbose && $(pwd) --verbose done
+$(pwd) local "$1" ${HOME} && cd
+	${HOME} && 2>/dev/null grep local export sed export -eu x=1 echo grep
+	x=1 then && x=1 -eu cd ${HOME} | readonly cd | "$@" | $(pwd)
+readonly /usr/bin echo test && | $(pwd) -eu awk "$@"
+		'quoted text' -eu readonly "$1" $(pwd)
+	/usr/bin cd export x=1 grep then local -eu done ${HOME}
+		${HOME} printf done /usr/bin
+		&& test | export x=1 echo
+		local local ${HOME} grep cd /usr/bin | grep && "$1" -eu -eu && cd "$@" done
+		export then done sed printf --verbose
+		&& awk | && 2>/dev/null grep readonly done
+"$1" then /usr/bin -eu x=1 x=1 | /usr/bin "$@" done /usr/bin /usr/bin echo
+		awk ${HOME} readonly -eu && "$1"
+cd && awk 'quoted text'
+sed $(pwd) local then awk ${HOME} grep then "$1"
+		'quoted text' ${HOME} && printf 2>/dev/null "$1" ${HOME} "$@" && ${HOME} 2>/dev/null
+	x=1 "$@" | cd echo done "$@" 2>/dev/null local export awk --verbose local
+		&& 'quoted text' "$@"
+	cd awk && sed ${HOME} done done then export test sed --verbose
+	&& -eu cd test -eu cd test 2>/dev/null test echo grep ${HOME}
+		"$1" 'quoted text' "$1" $(pwd) export
+		sed "$@" 'quoted text' readonly then
+		export printf echo "$@" x=1 export /usr/bin
+		"$1" grep done "$1" 'quoted text' local $(pwd)
+	| -eu "$1" && x=1 "$1" done ${HOME} then -eu done --verbose ${HOME}
+		awk readonly | --verbose echo $(pwd) done
+printf done readonly ${HOME} cd readonly -eu | test --verbose
+		printf 'quoted text' export printf
+		| -eu awk sed sed "$1" printf
+	local echo grep --verbose "$@" --verbose grep --verbose -eu awk
+test | grep local done $(pwd) awk grep && && "$@" grep ${HOME} local
+		'quoted text' local then
+echo printf "$@" test sed 2>/dev/null done /usr/bin cd awk sed --verbose
+awk | $(pwd) then 2>/dev/null local done /usr/bin awk test export /usr/bin
+	--verbose local sed -eu ${HOME} echo
+	local then echo --verbose sed grep sed "$1" && ${HOME} cd printf 2>/dev/null
+grep export printf grep -eu --verbose 2>/dev/null
+--verbose sed awk test export done 2>/dev/null 2>/dev/null done awk echo
+then && grep then local
+		grep --verbose cd readonly
+	'quoted text' x=1 ${HOME} printf echo done test cd
+	&& 'quoted text' grep --verbose -eu &&
+	then "$@" export done 2>/dev/null "$1" $(pwd) local grep printf
+	'quoted text' -eu cd 'quoted text' x=1 $(pwd) 'quoted text' awk sed
+		awk echo export export awk export &&
+	done export "$1" | echo x=1 done cd && --verbose echo local test done
+then cd local test export printf 'quoted text' echo grep "$@" x=1
+	echo | then export printf readonly 2>/dev/null 2>/dev/null x=1 then
+	2>/dev/null /usr/bin readonly && echo then 'quoted text' 'quoted text' | && x=1
+	done echo done 'quoted text' test then --verbose echo printf
+		/usr/bin && grep $(pwd) test x=1 printf && grep
+cd x=1 "$@" printf cd grep $(pwd) x=1 ${HOME} 'quoted text' /usr/bin 'quoted text'
+		-eu -eu readonly | "$@" ${HOME} "$@" echo
+		-eu export 2>/dev/null grep
+	${HOME} echo 2>/dev/null printf local && "$@" done "$1" --verbose
+/usr/bin | && grep ${HOME} && 'quoted text' x=1
+	"$1" /usr/bin awk sed cd printf x=1 then readonly sed cd 'quoted text' $(pwd) 2>/dev/null
+	awk printf ${HOME} export readonly /usr/bin x=1 sed printf $(pwd)
+		awk x=1 'quoted text' local ${HOME} 'quoted text'
+test "$@" "$@" "$@" local 'quoted text' -eu | -eu 'quoted text'
+		--verbose awk grep sed then 'quoted text' grep x=1
+		--verbose echo cd 2>/dev/null x=1 "$@" | then "$1" cd $(pwd) awk export -eu
+	then printf | /usr/bin sed | sed local grep printf && x=1 x=1 2>/dev/null
+		2>/dev/null test sed "$1" sed echo "$1" $(pwd)
+	$(pwd) "$1" x=1 local
+	2>/dev/null && /usr/bin export
+local ${HOME} local readonly then
+	echo local then printf x=1 then grep -eu
+	/usr/bin --verbose $(pwd) && | 'quoted text' x=1 sed && "$@" $(pwd)
+then 'quoted text' -eu cd echo 2>/dev/null
+${HOME} | grep && | cd readonly test cd readonly
+2>/dev/null grep awk sed x=1 local readonly sed grep
+		'quoted text' ${HOME} "$1" then test
+	/usr/bin local awk grep local "$@"
+		"$1" grep test 'quoted text' ${HOME} /usr/bin sed /usr/bin cd --verbose | x=1 export
+/usr/bin --verbose | x=1 done local sed then printf 'quoted text' "$@"
+export | $(pwd) --verbose -eu then 'quoted text' $(pwd)
+awk 'quoted text' export echo cd 2>/dev/null
+export -eu readonly local grep
+then echo -eu x=1 x=1 /usr/bin
+		'quoted text' done --verbose /usr/bin then
+	sed --verbose printf awk 2>/dev/null
+	'quoted text' export printf 2>/dev/null "$@" then
+		local 2>/dev/null readonly --verbose
+		done readonly echo readonly "$@"
+cd "$1" done test -eu 2>/dev/null
+	'quoted text' | export "$1" awk "$@" "$1" --verbose 'quoted text' --verbose
+	test export $(pwd) -eu --verbose $(pwd) --verbose local --verbose grep "$1"
+	readonly done local x=1 "$1" sed 2>/dev/null x=1 --verbose cd $(pwd) 2>/dev/null
+		'quoted text' grep $(pwd) grep && ${HOME} --verbose
+	--verbose done --verbose awk 2>/dev/null ${HOME} ${HOME} done then 'quoted text'
+		readonly sed sed 'quoted text'
+grep test export 'quoted text'
+	--verbose cd && local grep test && --verbose --verbose printf done export
+		awk --verbose export test && sed local sed "$1" then then
+done export sed done 'quoted text' sed 2>/dev/null
+cd echo grep sed 'quoted text' sed then local export then
+		awk printf printf printf | echo echo ${HOME}
+	test /usr/bin sed 'quoted text'
+		echo then 'quoted text' /usr/bin "$@" readonly "$1" $(pwd) local readonly
+	&& x=1 echo done $(pwd) cd local printf then "$1" local echo $(pwd) x=1
+	&& | sed sed /usr/bin cd --verbose test | echo && printf
+printf /usr/bin "$@" "$1" grep "$@" then sed && x=1 ${HOME} awk $(pwd) test
+		grep printf 2>/dev/null
+${HOME} grep -eu 'quoted text' 'quoted text'
+	grep done test && then echo sed && "$1" -eu echo && readonly
+		$(pwd) 2>/dev/null ${HOME} /usr/bin
+grep ${HOME} done awk sed cd awk /usr/bin
+		/usr/bin test -eu sed "$1" local grep 2>/dev/null --verbose | printf "$@" x=1 export
+		${HOME} sed ${HOME} export $(pwd) "$1" export
+"$@" 'quoted text' $(pwd) printf printf
+done -eu readonly grep ${HOME} export 'quoted text' -eu 2>/dev/null
+		${HOME} grep readonly readonly
+--verbose sed test && && /usr/bin then sed "$1" | 'quoted text'
+		readonly echo ${HOME} export 2>/dev/null "$@" "$@" export echo
+	&& x=1 export 'quoted text' echo | grep ${HOME} grep readonly -eu $(pwd)
+		export 2>/dev/null export "$@" grep "$1" then export export echo done readonly
+	cd 'quoted text' ${HOME}
+awk then test "$1" $(pwd) readonly local grep 2>/dev/null
+		sed awk readonly grep echo | export
+	then test /usr/bin "$1" export
+readonly echo x=1 awk
+-eu export local local cd awk 2>/dev/null
+	then test --verbose echo then 2>/dev/null sed then
+		test export --verbose awk then cd | 'quoted text'
+		export export test grep then
+	echo sed "$@" sed "$@" local echo /usr/bin | -eu 2>/dev/null
+test | readonly ${HOME} cd 'quoted text' 2>/dev/null then
+	--verbose 2>/dev/null 2>/dev/null sed --verbose ${HOME} --verbose then
+	readonly "$1" readonly local "$@"
+		'quoted text' --verbose done readonly --verbose readonly $(pwd)
+	| x=1 'quoted text' local export
+		/usr/bin grep done cd "$1"
+export | printf -eu export "$@" /usr/bin echo --verbose
+	x=1 2>/dev/null | sed local grep export 'quoted text' $(pwd) awk 2>/dev/null export
+		echo /usr/bin test "$1" && done cd
+/usr/bin done "$@" && awk cd -eu export 'quoted text'
+echo export echo readonly test readonly "$@" $(pwd) test -eu awk ${HOME} "$1" &&
+cd && /usr/bin printf "$@" --verbose echo 2>/dev/null "$1" cd echo cd done 2>/dev/null
+		'quoted text' "$1" readonly
+	export printf "$@" | 2>/dev/null && "$1" ${HOME} then /usr/bin x=1 --verbose x=1
+&& 2>/dev/null awk cd --verbose then && -eu x=1 --verbose x=1 grep echo sed readonly
+	cd x=1 2>/dev/null 2>/dev/null local /usr/bin 2>/dev/null
+		readonly printf --verbose /usr/bin sed readonly
+	-eu ${HOME} local awk 'quoted text'
+	awk cd then local x=1 'quoted text'
+		$(pwd) /usr/bin "$1" ${HOME} 'quoted text' && /usr/bin
+"$@" readonly readonly awk echo | -eu grep && local echo 2>/dev/null
+then local $(pwd) test awk | awk echo grep awk then x=1 $(pwd) local
+--verbose && x=1 x=1 'quoted text' done /usr/bin | export
+	&& sed export export -eu | -eu done --verbose
+export cd -eu 'quoted text' 'quoted text' readonly ${HOME} "$@" then
+'quoted text' echo 'quoted text'
+	grep ${HOME} test 2>/dev/null grep
+		awk -eu then grep sed -eu export done printf export done
+	| "$1" printf printf x=1 2>/dev/null && grep readonly $(pwd) awk sed done test
+		printf echo printf -eu
+		&& "$@" readonly /usr/bin && grep test
+	echo export export "$@" then "$1" "$1" /usr/bin local x=1 $(pwd)
+		test "$@" 'quoted text'
+'quoted text' local test
+	${HOME} && -eu && | cd local ${HOME} local 2>/dev/null
+		2>/dev/null "$1" printf local export -eu readonly
+	$(pwd) then 2>/dev/null "$1" readonly export
+		"$@" readonly -eu 2>/dev/null then printf export awk "$1" ${HOME}
+	/usr/bin $(pwd) cd 2>/dev/null /usr/bin
+		sed readonly test x=1 $(pwd) export x=1 export /usr/bin grep readonly grep 'quoted text'
+2>/dev/null grep done -eu ${HOME} echo test | readonly done
+		then export printf printf
+	grep test x=1 awk "$1" sed printf -eu ${HOME}
+		local /usr/bin done printf --verbose
+		2>/dev/null /usr/bin test "$1" echo awk export cd ${HOME} &&
+		2>/dev/null --verbose grep printf /usr/bin -eu printf "$@" done && sed 'quoted text'
+	awk grep sed echo sed x=1 --verbose
+"$@" "$@" readonly awk local ${HOME}
+	| grep --verbose grep | awk /usr/bin --verbose
+cd 'quoted text' -eu echo 'quoted text' x=1 "$@" local
+--verbose /usr/bin local
+	"$@" | /usr/bin /usr/bin $(pwd) 2>/dev/null awk /usr/bin /usr/bin readonly export
+sed | then printf printf 2>/dev/null
+grep 2>/dev/null awk done $(pwd) $(pwd) x=1 x=1 sed
+		2>/dev/null 'quoted text' ${HOME} test | "$1" then | test
+		awk 2>/dev/null "$@" x=1 test
+	readonly echo local cd echo -eu readonly grep grep $(pwd) then ${HOME} readonly
+	test 2>/dev/null 'quoted text' sed "$@" 2>/dev/null
+"$@" "$1" --verbose --verbose then export grep "$@" test export -eu
+"$1" x=1 readonly "$1" /usr/bin echo
+		then | then export 2>/dev/null ${HOME} echo local then && readonly
+	readonly 2>/dev/null awk "$@" cd test done $(pwd) local && readonly
+2>/dev/null awk export done then printf then readonly --verbose &&
+		local grep then export /usr/bin /usr/bin 2>/dev/null done test "$@"
+/usr/bin 'quoted text' printf 2>/dev/null
+	/usr/bin then /usr/bin cd "$@" /usr/bin
+		export done awk "$@" && 2>/dev/null sed 'quoted text'
+local printf export ${HOME} local awk awk printf && cd 'quoted text'
+		2>/dev/null 'quoted text' done x=1 local | done &&
+		sed 'quoted text' then test && /usr/bin then
+'quoted text' awk echo export then && --verbose
+&& sed echo x=1 echo test printf echo $(pwd) 2>/dev/null sed
+	cd sed "$@" export "$1" "$@" readonly local -eu "$1" done export
+		grep printf grep && "$1" awk local echo --verbose && && | grep "$@"
+	| x=1 readonly test test /usr/bin /usr/bin
+sed grep --verbose "$1" test test "$1" then test "$1" /usr/bin && echo
+	--verbose cd readonly 2>/dev/null --verbose "$1" echo echo ${HOME}
+		-eu test ${HOME} grep "$@" echo x=1 readonly test grep --verbose
+	export | printf -eu --verbose printf sed x=1 --verbose
+	--verbose grep /usr/bin $(pwd) echo $(pwd)
+cd local readonly printf 2>/dev/null sed test
+	-eu && grep | ${HOME} cd then 2>/dev/null readonly 'quoted text' export -eu
+		printf done x=1 --verbose && ${HOME} "$@" sed
+	/usr/bin export readonly ${HOME} -eu --verbose x=1 "$@" x=1
+printf local local awk done -eu echo then /usr/bin $(pwd) /usr/bin test export
+	&& done sed awk 2>/dev/null $(pwd) sed x=1 -eu
+		local x=1 | /usr/bin grep x=1 "$1"
+test local ${HOME} x=1 'quoted text' local cd printf &&
+	done printf x=1 "$@" $(pwd) sed export "$1" 'quoted text'
+		cd "$@" local ${HOME} --verbose
+	grep -eu ${HOME} -eu test local -eu /usr/bin "$@" x=1 grep awk
+awk --verbose cd ${HOME} --verbose --verbose /usr/bin "$@" -eu
+		x=1 readonly /usr/bin local awk then export | && test
+	2>/dev/null -eu cd done readonly "$@" local --verbose --verbose
+		then done ${HOME} -eu /usr/bin
+		grep "$1" $(pwd) echo grep grep then "$@" 2>/dev/null readonly
+		readonly sed awk awk export readonly awk done x=1 2>/dev/null
+		--verbose export && readonly printf awk | 'quoted text' x=1 ${HOME} "$@" /usr/bin
+	"$@" x=1 /usr/bin printf printf "$1" && awk export x=1 cd readonly -eu
+	printf local done /usr/bin x=1 2>/dev/null
+		readonly 2>/dev/null --verbose export 2>/dev/null local grep && "$1"
+	then && x=1 'quoted text' -eu "$@" --verbose awk awk export
+printf ${HOME} -eu --verbose sed local export --verbose echo --verbose -eu local
+${HOME} echo && echo ${HOME} "$@" --verbose | echo awk awk printf 2>/dev/null
+		"$1" "$@" 2>/dev/null readonly | /usr/bin
+x=1 && --verbose "$1" -eu -eu then --verbose $(pwd) awk test echo
+		/usr/bin | -eu local test local "$@" --verbose
+	${HOME} "$@" /usr/bin sed | local --verbose 'quoted text' -eu local | awk
+	2>/dev/null local test sed echo done | 'quoted text'
+	| done -eu test x=1 2>/dev/null
+"$1" sed grep "$1" cd grep test printf readonly "$1" "$@"
+	"$1" cd then --verbose test | grep test echo grep
+${HOME} readonly grep 2>/dev/null && test local $(pwd) "$@" "$1" 2>/dev/null printf
+	| 2>/dev/null ${HOME} "$1" sed sed "$1" "$1"
+cd echo echo 'quoted text' && export then
+		--verbose done printf ${HOME} local test export "$1" 'quoted text'
+grep export cd sed test done -eu readonly $(pwd) sed
+		test echo local && echo test readonly
+	2>/dev/null test x=1 printf x=1 2>/dev/null local "$1" local 2>/dev/null
+	test then test | readonly test ${HOME} echo
+		done export test local printf export /usr/bin --verbose && && awk "$@" awk $(pwd)
+	| sed /usr/bin -eu "$1" $(pwd) --verbose "$@" 'quoted text' 2>/dev/null
+"$1" --verbose /usr/bin echo /usr/bin
+printf $(pwd) sed ${HOME} test | --verbose
+		2>/dev/null "$1" done test sed printf ${HOME} export "$@" done x=1 readonly readonly
+	test export 'quoted text' 'quoted text'
+	'quoted text' | x=1 $(pwd)
+--verbose "$@" && "$@" --verbose /usr/bin echo grep done && cd readonly --verbose
+	local echo 'quoted text' echo 'quoted text'
+	test test printf then awk grep test awk sed && $(pwd) echo test local
+	"$1" grep "$1" 2>/dev/null | ${HOME} export -eu
+		printf export sed /usr/bin
+${HOME} cd ${HOME} readonly && echo test echo sed awk 'quoted text' test grep
+		${HOME} done readonly export 'quoted text'
+&& x=1 test export 2>/dev/null sed done ${HOME} done sed | x=1 printf --verbose
+		"$@" test grep /usr/bin
+	done /usr/bin | test export x=1 cd grep awk && $(pwd)
+$(pwd) local awk && "$@" ${HOME} "$@" test "$@" export
+	printf && done $(pwd) "$@" --verbose x=1 export 2>/dev/null $(pwd) echo
+		readonly test test local "$@" ${HOME} 2>/dev/null x=1
+		readonly | local export echo
+		test cd $(pwd) "$@" ${HOME} done then local grep done /usr/bin
+	2>/dev/null x=1 grep -eu local local
+	echo ${HOME} | "$@" /usr/bin awk done export --verbose | 2>/dev/null -eu
+	local awk local then -eu
+	"$@" -eu $(pwd) echo then echo 'quoted text' export 2>/dev/null &&
+	/usr/bin "$1" -eu then then export cd export local export
+	readonly readonly && && ${HOME} printf 2>/dev/null readonly x=1 -eu awk "$@"
+echo ${HOME} echo awk x=1 /usr/bin cd echo | awk then /usr/bin local printf
+		sed local printf done "$1" test && -eu local ${HOME} printf printf export
+	${HOME} export echo echo 'quoted text' readonly export $(pwd)
+	2>/dev/null | $(pwd) printf
+cd /usr/bin awk "$@" ${HOME} grep | sed export export local done
+done echo awk 2>/dev/null awk readonly 'quoted text' x=1 then cd "$1" | then
+	done x=1 done export && grep
+	printf | && local $(pwd) test test "$1" echo && /usr/bin
+-eu done | grep echo --verbose
+test done grep done test 2>/dev/null cd "$1" -eu test awk /usr/bin 'quoted text'
+		2>/dev/null /usr/bin "$@" $(pwd) sed grep readonly
+	2>/dev/null cd x=1 --verbose test
+/usr/bin ${HOME} | cd cd "$1" readonly && done echo printf export
+	$(pwd) awk "$1" sed test | -eu 2>/dev/null
+		'quoted text' awk cd readonly $(pwd) sed cd | $(pwd) | then test then
+		${HOME} && x=1 export test
+	then done 'quoted text' -eu 'quoted text'
+&& "$1" echo | --verbose 2>/dev/null sed echo grep /usr/bin
+	&& | export 2>/dev/null cd "$@" done "$1" 2>/dev/null -eu "$@" $(pwd) test readonly
+		$(pwd) readonly && grep "$@" 2>/dev/null echo -eu printf test "$@"
+		grep -eu local && --verbose /usr/bin test
+	cd then sed && local x=1 'quoted text' done --verbose
+"$@" x=1 -eu -eu 2>/dev/null /usr/bin done $(pwd) printf local
+		then echo then then --verbose $(pwd) local printf | then echo cd then
+/usr/bin sed readonly "$@" x=1 sed awk printf done echo "$1" && printf grep
+		printf ${HOME} local /usr/bin
+"$@" grep test grep x=1
+	"$1" then | then $(pwd) x=1 'quoted text' "$1" sed local | grep ${HOME}
+	test awk ${HOME} readonly --verbose
+done done done grep awk cd export readonly done
+-eu awk x=1 local 'quoted text'
+	cd cd echo local $(pwd) grep /usr/bin
+export done printf "$@"
+		2>/dev/null test | grep printf 2>/dev/null test printf 'quoted text' | cd done
+--verbose done --verbose x=1 printf 'quoted text' test --verbose
+/usr/bin export echo echo /usr/bin "$1" 'quoted text'
+		x=1 --verbose -eu awk && test awk 2>/dev/null -eu 'quoted text' printf 2>/dev/null
+		printf grep echo && grep -eu --verbose test done grep test /usr/bin
+	local readonly export local | x=1 2>/dev/null grep echo
+	2>/dev/null cd 'quoted text' /usr/bin "$@" "$1" x=1 $(pwd) done done
+x=1 --verbose readonly
+	test echo && done test readonly echo local
+	printf echo "$@" /usr/bin cd /usr/bin 2>/dev/null local sed "$@" ${HOME} -eu 'quoted text'
+		then test readonly echo sed awk
+		"$@" --verbose done ${HOME} sed ${HOME} echo readonly
+	--verbose 'quoted text' test test
+		"$@" awk -eu then "$1" ${HOME} export /usr/bin echo --verbose sed 2>/dev/null
+		'quoted text' && readonly sed x=1 --verbose done awk "$@"
+	cd echo $(pwd) -eu && done awk --verbose 2>/dev/null grep export sed echo export
+	printf done ${HOME} "$1" awk --verbose readonly /usr/bin "$@" sed done echo export
+	readonly awk readonly $(pwd)
+	--verbose awk 2>/dev/null && | test then 'quoted text' | -eu "$1" ${HOME}
+	echo sed | test sed done local awk --verbose printf awk x=1 $(pwd) --verbose
+then cd $(pwd) test then readonly awk
+		&& 'quoted text' export "$1" "$@" "$@" then 2>/dev/null awk -eu sed then
+		local local 2>/dev/null test $(pwd)
+		grep done ${HOME} awk "$@" x=1 printf
+	| x=1 "$@" printf test export -eu --verbose 2>/dev/null $(pwd)
+		test 'quoted text' test --verbose readonly
+	printf ${HOME} echo test $(pwd) x=1 2>/dev/null
+sed sed done sed local ${HOME} 'quoted text' | export test
+		| then x=1 awk "$1" cd ${HOME}
+	2>/dev/null printf export readonly sed "$1" -eu test local awk
+	grep readonly 'quoted text' export local export /usr/bin ${HOME} sed
+		then export | awk x=1 x=1 $(pwd) ${HOME} cd 2>/dev/null
+then then readonly 2>/dev/null test
+		awk awk local echo "$1" readonly 2>/dev/null export | sed 'quoted text' "$@" readonly
+		'quoted text' export -eu
+	&& then 2>/dev/null 'quoted text' --verbose &&
+		printf "$1" /usr/bin printf ${HOME} cd readonly 2>/dev/null printf
+	grep $(pwd) sed local done | "$@" echo
+		readonly "$@" printf readonly printf printf "$1" export
+	-eu test awk export grep "$@"
+cd grep export 'quoted text' done "$@" "$@" $(pwd) cd cd readonly /usr/bin
+	export printf x=1 test
+	done -eu grep /usr/bin echo /usr/bin awk x=1 sed --verbose then 'quoted text'
+&& echo test printf then grep sed -eu $(pwd) export
+'quoted text' grep x=1 local 2>/dev/null done $(pwd) | | 'quoted text' export then
+local -eu done printf sed test
+x=1 'quoted text' "$@" local | ${HOME} x=1 'quoted text' grep echo
+	then awk grep && echo 2>/dev/null
+	| 2>/dev/null "$@" "$1" cd 'quoted text'
+	sed | x=1 done x=1 $(pwd) test grep echo -eu
+--verbose awk test local cd readonly test done test cd sed "$1" -eu ${HOME}
+		"$1" 'quoted text' 2>/dev/null
+	readonly /usr/bin "$1"
+awk "$@" /usr/bin "$@" ${HOME} -eu readonly
+	readonly && | test && done $(pwd) export done $(pwd) readonly cd
+cd readonly then sed && ${HOME} test x=1 2>/dev/null
+		${HOME} | done /usr/bin echo sed local 2>/dev/null
+		awk grep sed then x=1 cd printf /usr/bin test awk
+	2>/dev/null then test local then grep awk x=1
+export awk 2>/dev/null && cd "$@" local then export | readonly echo local printf
+	| then ${HOME} | printf 2>/dev/null "$@" readonly printf awk
+	sed 2>/dev/null awk test cd
+		${HOME} /usr/bin done | test readonly -eu $(pwd) ${HOME} 'quoted text'
+	local then cd cd then | test printf export echo && grep awk printf
+printf x=1 then grep grep then done
+done then then done 'quoted text' grep then sed "$1"
+		printf done printf 2>/dev/null printf
+		${HOME} grep test && $(pwd) 2>/dev/null /usr/bin
+		$(pwd) ${HOME} printf test local done test awk /usr/bin 2>/dev/null sed
+/usr/bin sed readonly x=1 grep printf x=1 cd cd 'quoted text' "$@" x=1 $(pwd)
+	${HOME} "$@" 'quoted text' printf done local cd local
+| | -eu grep then printf printf
+-eu echo export printf echo printf && then x=1
+2>/dev/null test "$@" export then local x=1 x=1 | -eu printf "$@" "$1" && x=1 |
+awk then "$@" && 2>/dev/null --verbose done | "$1"
+cd /usr/bin "$@" 2>/dev/null /usr/bin "$1" -eu "$@" readonly
+sed readonly awk 'quoted text' local 2>/dev/null then test
+local "$@" && printf 2>/dev/null $(pwd) /usr/bin
+${HOME} echo then awk cd grep
+	${HOME} done $(pwd) awk echo
+		2>/dev/null local --verbose $(pwd) x=1 2>/dev/null "$1" | awk done
+	done cd $(pwd) x=1 cd local echo readonly
+	/usr/bin "$1" "$@" done echo printf local
+		sed "$@" printf && local export $(pwd) ${HOME} export
+		awk $(pwd) grep | 2>/dev/null test echo /usr/bin x=1 "$@" sed done | | -eu
+	cd sed done 'quoted text' "$1" local test x=1 /usr/bin awk x=1
+	| "$@" awk echo /usr/bin cd | 'quoted text' sed
+test ${HOME} sed /usr/bin --verbose grep $(pwd) awk --verbose sed
+	| sed x=1 && ${HOME} echo -eu cd awk printf 2>/dev/null
+${HOME} done awk test then done grep printf export x=1 echo
+grep grep echo awk printf readonly && 2>/dev/null
+		| sed 'quoted text' test "$@" sed x=1 --verbose cd -eu ${HOME} 'quoted text'
+		done printf 'quoted text' $(pwd) | then readonly ${HOME} local cd "$@" printf
+readonly $(pwd) test --verbose export readonly ${HOME} 'quoted text'
+		done grep $(pwd) grep awk then then done ${HOME} | "$1" |
+	/usr/bin --verbose x=1 x=1 echo printf cd readonly
+	x=1 echo grep printf -eu 2>/dev/null
+	grep "$1" sed done 'quoted text' sed --verbose $(pwd) /usr/bin printf echo
+-eu | printf echo grep echo /usr/bin readonly "$@" x=1 grep done sed local && ${HOME}
+	${HOME} sed -eu | | /usr/bin | done $(pwd) 'quoted text'
+"$@" printf awk -eu /usr/bin | echo readonly grep 'quoted text' $(pwd) --verbose
+		awk --verbose local "$@" --verbose $(pwd) readonly "$@" export grep printf 'quoted text'
+	local local awk printf 'quoted text' /usr/bin awk 'quoted text'
+		"$@" grep && then grep readonly cd $(pwd)
+	grep | grep echo then 2>/dev/null x=1 printf ${HOME} | /usr/bin grep $(pwd)
+		/usr/bin -eu ${HOME} local | "$@" "$1"
+	printf 'quoted text' export | $(pwd) /usr/bin done grep ${HOME} $(pwd)
+		readonly sed echo printf sed x=1 done test export | test
+	| cd $(pwd) $(pwd) cd echo awk --verbose awk sed local cd sed then
+	cd grep "$1" /usr/bin sed && echo readonly 2>/dev/null readonly ${HOME} echo grep
+		$(pwd) "$@" ${HOME} then cd ${HOME} x=1 export 'quoted text'
+readonly echo then "$@" awk "$@" $(pwd) then
+	printf 2>/dev/null -eu 'quoted text' cd then echo
+	2>/dev/null sed -eu && sed printf
+export $(pwd) x=1 && cd done | sed awk then "$1" 'quoted text'
+	-eu -eu printf done readonly grep
+	grep awk | 'quoted text' sed 'quoted text'
+	export done local then 2>/dev/null readonly
+		done $(pwd) 'quoted text'
+	| -eu echo | grep sed
+		grep x=1 then export then "$1" -eu ${HOME}
+	export 2>/dev/null /usr/bin && local local then test && grep then sed --verbose
+	then test ${HOME} "$@" "$@" 2>/dev/null x=1 "$1" /usr/bin
+	cd grep x=1 sed ${HOME} /usr/bin
+2>/dev/null cd "$@" awk | sed "$1" echo echo printf | test | printf 2>/dev/null
+&& printf | x=1 grep then local /usr/bin printf
+$(pwd) "$1" | | export 2>/dev/null ${HOME} readonly readonly $(pwd) "$1"
+readonly test "$1" echo --verbose
+		2>/dev/null "$@" grep test x=1 local export && echo | printf
+		readonly test printf cd grep local grep then "$1"
+	-eu --verbose 'quoted text' ${HOME} | done local echo 2>/dev/null readonly
+	done | export sed export && cd export 'quoted text'
+		readonly x=1 --verbose "$1" local local 2>/dev/null test test test "$@" cd | | |
+echo then "$@" printf && "$1" done
+	&& -eu sed --verbose x=1
+	then && readonly grep
+	"$1" x=1 awk 'quoted text' readonly "$1" local
+$(pwd) && $(pwd) ${HOME} $(pwd) "$@"
+		${HOME} ${HOME} "$@" "$1" grep printf 2>/dev/null
+"$@" "$1" -eu printf /usr/bin
+		grep && x=1 done "$@" 'quoted text' "$@"
+	--verbose /usr/bin printf $(pwd) awk echo "$@" ${HOME} /usr/bin cd printf
+'quoted text' 2>/dev/null then 2>/dev/null done
+	2>/dev/null readonly "$1" done then $(pwd) grep "$1" --verbose ${HOME} x=1 then
+$(pwd) /usr/bin printf test sed
+$(pwd) | --verbose $(pwd) export "$1" cd
+local local | ${HOME} grep readonly awk done printf sed done awk grep readonly
+	readonly grep local 'quoted text' test local "$@" done 'quoted text' then
+	${HOME} 'quoted text' $(pwd) 2>/dev/null sed printf 2>/dev/null
+x=1 && | grep && cd &&
+		readonly 'quoted text' export && sed cd -eu export "$1"
+$(pwd) /usr/bin sed 'quoted text'
+		done /usr/bin && local printf -eu echo done ${HOME}
+then test then ${HOME}
+--verbose $(pwd) sed && test "$@" awk export
+$(pwd) cd grep then "$@" cd x=1 then
+	local awk cd local x=1 "$1" sed cd then
+echo cd export && printf ${HOME} ${HOME}
+		"$@" 2>/dev/null | | done "$@" local test cd readonly awk 2>/dev/null x=1 sed
+x=1 grep local local x=1 grep echo awk -eu
+		x=1 grep export then x=1 $(pwd) --verbose
+		&& printf ${HOME} /usr/bin "$1" grep 2>/dev/null
+		readonly $(pwd) 2>/dev/null x=1 --verbose | grep
+		printf test sed sed "$1"
+	awk then cd awk export ${HOME} $(pwd) -eu --verbose awk
+	sed | $(pwd) && "$@" "$1"
+		echo "$1" readonly 2>/dev/null
+		done /usr/bin x=1 grep "$@"
+		${HOME} echo 'quoted text' sed grep grep awk -eu "$1" done export $(pwd)
+		sed && export "$@" local grep printf 2>/dev/null | export test && -eu ${HOME}
+	then grep test | x=1 printf sed local $(pwd) done ${HOME}
+		cd printf printf cd done
+	2>/dev/null 'quoted text' export && then 2>/dev/null -eu cd "$@" | && -eu then
+		export 2>/dev/null cd awk /usr/bin --verbose cd x=1 $(pwd) echo test "$@" printf
+	done && sed | then cd sed ${HOME}
+	test --verbose test /usr/bin ${HOME} 'quoted text'
+&& ${HOME} test -eu "$1" 2>/dev/null x=1 "$1" 2>/dev/null
+		/usr/bin /usr/bin | "$1" /usr/bin test "$@" done test /usr/bin 2>/dev/null
+	| sed local readonly awk -eu sed printf $(pwd) 2>/dev/null cd --verbose
+	-eu && 2>/dev/null -eu sed
+	then grep -eu test test printf /usr/bin /usr/bin
+	grep "$1" /usr/bin | export export "$@" done && echo 'quoted text' awk done
+"$1" $(pwd) 2>/dev/null
+	test readonly export grep cd done /usr/bin 'quoted text' test |
+local /usr/bin ${HOME} --verbose
+export awk then printf done 2>/dev/null readonly echo
+	-eu 'quoted text' "$@" readonly sed "$1" ${HOME}
+	sed sed "$1" 'quoted text' /usr/bin -eu /usr/bin
+	done test printf ${HOME}
+		"$1" --verbose --verbose sed export export "$@" x=1 -eu "$1" readonly
+| "$@" ${HOME} $(pwd) 'quoted text' echo cd done sed && 2>/dev/null
+echo cd sed --verbose grep --verbose "$1" echo readonly
+	test done 'quoted text' "$@" -eu ${HOME} cd export cd awk then
+		"$1" $(pwd) && grep echo sed grep echo
+		grep --verbose && $(pwd) readonly
+--verbose readonly "$1" printf ${HOME} done "$1" readonly
+		| awk cd readonly | 'quoted text' export --verbose
+cd "$1" /usr/bin -eu done -eu printf
+		sed cd printf readonly /usr/bin --verbose ${HOME}
+	sed ${HOME} "$1" $(pwd) sed printf readonly && test
+	$(pwd) "$1" awk awk readonly local echo && export done $(pwd) | export 2>/dev/null
+x=1 "$@" "$@" && grep local 2>/dev/null
+printf cd ${HOME} then printf ${HOME}
+'quoted text' then 2>/dev/null cd /usr/bin
+&& awk then echo cd readonly then
+		grep -eu 2>/dev/null /usr/bin
+		| 'quoted text' -eu done | -eu
+then sed /usr/bin then cd done && x=1 "$1" grep -eu
+sed 2>/dev/null ${HOME} $(pwd) x=1 'quoted text' x=1 && /usr/bin
+	sed sed "$@" $(pwd) "$1" 2>/dev/null then export grep local then grep --verbose
+done 'quoted text' awk local printf && "$@" echo
+	"$@" test grep 'quoted text' ${HOME} export "$1"
+	awk $(pwd) export awk then echo awk 'quoted text' grep
+sed printf then $(pwd) awk local done 'quoted text' 2>/dev/null ${HOME} "$1"
+2>/dev/null && test cd x=1 | && &&
+	"$@" && $(pwd) "$1" readonly
+	&& grep /usr/bin echo x=1 awk then sed done
+	$(pwd) --verbose x=1 && --verbose echo
+		$(pwd) echo --verbose 2>/dev/null echo echo then 2>/dev/null test sed cd
+"$@" --verbose cd readonly done
+		local test x=1 grep awk "$@" /usr/bin printf then grep done export
+"$@" test test test -eu "$@" ${HOME} /usr/bin done ${HOME} awk export
+cd echo 'quoted text' grep awk $(pwd)
+x=1 | readonly 2>/dev/null test 2>/dev/null 2>/dev/null --verbose
+-eu ${HOME} awk && readonly done /usr/bin done cd awk "$1"
+	2>/dev/null /usr/bin 'quoted text' | 2>/dev/null 2>/dev/null
+		"$@" printf cd done ${HOME} x=1 export /usr/bin local
+local cd export echo done cd "$1" 'quoted text' then "$1" 'quoted text'
+${HOME} then && /usr/bin | test 2>/dev/null sed sed
+	export --verbose test "$@" ${HOME} test cd
+		grep then readonly done grep printf printf -eu test 2>/dev/null
+		&& then test --verbose $(pwd) && -eu /usr/bin echo cd awk
+		readonly printf 2>/dev/null readonly
+-eu printf $(pwd) printf awk readonly "$@" echo "$1" then "$1" export
+grep test && "$1" printf
+$(pwd) x=1 local | -eu test local
+		x=1 export --verbose sed ${HOME} local $(pwd) 'quoted text' /usr/bin
+| && test grep -eu echo
+		"$@" test local x=1 ${HOME} && /usr/bin printf
+	"$1" $(pwd) --verbose readonly $(pwd) 2>/dev/null 'quoted text'
+	${HOME} cd | export /usr/bin echo 'quoted text' test "$@" $(pwd) 2>/dev/null
+	awk grep ${HOME} local ${HOME} then /usr/bin /usr/bin -eu test test && export
+x=1 && readonly grep
+	cd x=1 -eu x=1 -eu local | | local cd ${HOME}
+	"$1" "$@" -eu test && "$@" cd local 'quoted text' | --verbose $(pwd)
+${HOME} readonly ${HOME}
+echo cd x=1 awk echo && grep echo awk --verbose printf
+"$@" awk cd "$1" 2>/dev/null "$@" $(pwd) then done awk printf $(pwd) 2>/dev/null
+	${HOME} --verbose sed "$1" test x=1 2>/dev/null then && echo
+	test -eu cd test "$@" | sed -eu local && 'quoted text' grep awk
+	-eu cd x=1 /usr/bin "$1" 'quoted text' "$@" awk grep
+	${HOME} -eu 2>/dev/null 2>/dev/null then test 'quoted text' 2>/dev/null
+		$(pwd) then done ${HOME} -eu x=1 awk /usr/bin && $(pwd) sed grep /usr/bin &&
+		echo /usr/bin 'quoted text' awk cd "$1" x=1 /usr/bin sed readonly /usr/bin
+	--verbose local awk && /usr/bin then
+	readonly echo echo | && /usr/bin x=1 && /usr/bin test
+		${HOME} && echo "$1" sed | | test $(pwd) && local --verbose readonly --verbose
+	test printf printf grep | printf printf local then --verbose printf --verbose
+		"$1" cd done readonly echo readonly | readonly -eu test ${HOME} /usr/bin test
+		"$@" then export && ${HOME}
+&& test 'quoted text' --verbose 2>/dev/null
+printf && ${HOME} test printf /usr/bin test then local
+2>/dev/null done | "$1" --verbose x=1
+	awk 2>/dev/null ${HOME} done 'quoted text' export /usr/bin awk 2>/dev/null &&
+${HOME} --verbose | | /usr/bin cd then
+		sed done && echo | grep | ${HOME} | done readonly && readonly then grep
+	'quoted text' 2>/dev/null |
+		-eu && export sed readonly test export ${HOME} printf && "$@" export
+		then printf echo readonly grep
+		readonly local 'quoted text'
+export readonly ${HOME} export
+	x=1 2>/dev/null echo 2>/dev/null
+	x=1 "$1" $(pwd) && echo readonly ${HOME} ${HOME} sed 'quoted text'
+		"$@" local | done x=1 grep echo sed local echo $(pwd)
+cd -eu grep test --verbose readonly local && /usr/bin echo
+'quoted text' awk ${HOME} readonly local 2>/dev/null
+		--verbose sed && readonly test
+grep | echo awk local awk
+sed sed ${HOME} cd -eu echo $(pwd) 'quoted text'
+local cd test && local export -eu then echo $(pwd)
+/usr/bin "$1" $(pwd) cd done | echo export export /usr/bin
+		local then /usr/bin printf test x=1 ${HOME} then readonly | $(pwd) cd printf
+		--verbose echo --verbose then x=1 /usr/bin 2>/dev/null $(pwd) done printf
+		-eu cd x=1 grep 2>/dev/null test grep test $(pwd)
+x=1 "$1" echo done "$@" && && x=1 2>/dev/null $(pwd) readonly test
+		local x=1 readonly /usr/bin cd printf x=1 /usr/bin sed
+	grep ${HOME} | 'quoted text'
+	local done sed then printf && 'quoted text'
+		x=1 /usr/bin done "$@" printf 2>/dev/null "$@" 'quoted text' echo -eu cd export
+"$1" --verbose --verbose test awk echo done
+echo | | echo echo ${HOME} && cd "$@" sed "$1"
+then $(pwd) -eu awk $(pwd) "$@"
+	-eu echo 'quoted text' done ${HOME}
+sed awk /usr/bin ${HOME} --verbose -eu -eu /usr/bin done done -eu | cd local 2>/dev/null
+echo done && grep "$@" && /usr/bin echo "$1" |
+	test test echo $(pwd) grep echo readonly x=1
+	"$1" printf && "$@" -eu
+		"$1" | test readonly printf
+		local printf ${HOME} "$1" awk echo done
+		"$1" $(pwd) 'quoted text' local echo "$1" sed
+		done /usr/bin local test
+	$(pwd) 'quoted text' "$1" export
+	2>/dev/null export x=1 sed export local && "$1" /usr/bin x=1 /usr/bin awk
+awk | 2>/dev/null sed printf -eu awk /usr/bin
+		echo cd local cd ${HOME}
+	printf then then export 'quoted text' x=1 local sed printf
+	x=1 test export && done --verbose
+grep echo done 'quoted text' /usr/bin echo grep -eu
+export then printf sed
+	-eu done 2>/dev/null $(pwd) "$1" --verbose
+	done cd ${HOME} printf cd 'quoted text' /usr/bin
+&& x=1 awk export $(pwd) sed awk && done awk $(pwd) | grep 2>/dev/null 'quoted text'
+	then grep ${HOME} --verbose "$@" 'quoted text' then 'quoted text' done
+		&& sed local done export | $(pwd) printf sed x=1 x=1 /usr/bin
+		test && --verbose done printf export x=1 awk "$1" done
+then readonly export awk printf readonly done && echo
+	readonly /usr/bin x=1 2>/dev/null cd "$1" test
+		cd test export then cd && awk ${HOME} readonly grep ${HOME}
+		/usr/bin 2>/dev/null 'quoted text'
+		x=1 $(pwd) sed "$1" echo test -eu "$1"
+cd --verbose grep /usr/bin sed --verbose | done ${HOME} 2>/dev/null
+	--verbose /usr/bin "$1" && export --verbose | sed cd
+--verbose awk $(pwd) printf done
+then /usr/bin test --verbose /usr/bin test --verbose -eu $(pwd)
+${HOME} && printf ${HOME}
+	done sed 2>/dev/null -eu
+		done export 2>/dev/null x=1 sed "$@" then test
+		2>/dev/null local $(pwd) sed 'quoted text' $(pwd) export printf 2>/dev/null
+	$(pwd) local test | $(pwd) "$1"
+cd $(pwd) -eu export
+		| 2>/dev/null "$@" $(pwd)
+	/usr/bin $(pwd) ${HOME} -eu done
+--verbose 2>/dev/null export
+2>/dev/null readonly -eu "$1" cd printf awk 2>/dev/null /usr/bin
+/usr/bin "$1" && cd "$1" then "$1" && "$1" && local sed --verbose printf
+		cd echo grep 2>/dev/null ${HOME} echo done "$1" -eu done --verbose
+		sed done -eu | --verbose sed local 'quoted text' x=1 cd printf
+	done test --verbose $(pwd) sed "$1" done x=1 local x=1 /usr/bin
+done export x=1 export && | sed awk
+		cd && x=1 /usr/bin export && x=1 grep 'quoted text' --verbose export then $(pwd)
+done test readonly "$@" --verbose
+		-eu awk readonly awk then export sed && /usr/bin test 'quoted text' grep
+		sed ${HOME} /usr/bin grep
+		${HOME} sed test echo "$@" -eu export export && 2>/dev/null --verbose && |
+		'quoted text' $(pwd) "$1" export local -eu local 2>/dev/null
+		-eu | test local ${HOME} test
+		test grep "$@" local && "$@" "$@" readonly echo sed x=1 sed
+printf local ${HOME} local | echo sed grep "$@" --verbose /usr/bin echo
+	${HOME} --verbose printf
+		readonly sed printf readonly cd /usr/bin export echo echo -eu 2>/dev/null
+'quoted text' echo "$@" --verbose test 'quoted text' /usr/bin
+	| "$@" x=1 "$1" readonly ${HOME} readonly sed -eu awk --verbose done then $(pwd)
+/usr/bin ${HOME} sed --verbose
+		"$1" then awk --verbose 2>/dev/null
+"$@" | --verbose $(pwd) 2>/dev/null
+"$1" sed "$@" echo |
+		printf && 2>/dev/null printf ${HOME}
+printf x=1 'quoted text' $(pwd) done
+&& grep export /usr/bin -eu test "$@" x=1
+#include c102.sh
+printf $(pwd) printf then "$1" -eu /usr/bin then ${HOME} /usr/bin done
+		local cd grep && ${HOME} -eu readonly
+grep x=1 then printf ${HOME} "$@" "$@" "$@" -eu /usr/bin
+	/usr/bin printf 'quoted text' | -eu 2>/dev/null --verbose
+		x=1 x=1 local | then grep grep then 2>/dev/null -eu /usr/bin
+		then sed ${HOME} readonly export /usr/bin cd done cd
+'quoted text' $(pwd) test done local
+x=1 readonly -eu awk test
+	then 2>/dev/null "$1" 'quoted text' 2>/dev/null grep --verbose sed cd && echo
+x=1 then ${HOME} then done echo x=1 'quoted text' test "$1" 2>/dev/null
+	/usr/bin --verbose x=1 local cd x=1 sed
+"$1" grep export sed awk ${HOME} | done x=1 x=1
+"$1" 'quoted text' "$1" && $(pwd) done && done printf done 2>/dev/null
+then test --verbose -eu $(pwd) --verbose local $(pwd) awk /usr/bin echo && $(pwd)
+$(pwd) test -eu export && --verbose "$1" $(pwd) 2>/dev/null --verbose
+	/usr/bin printf $(pwd) cd "$1" local test --verbose ${HOME} test "$1" 2>/dev/null
+		${HOME} "$@" "$@" $(pwd) grep printf -eu readonly local sed cd readonly
+		$(pwd) -eu $(pwd) /usr/bin $(pwd) && echo printf export | readonly
+		-eu export done export export 2>/dev/null "$@" $(pwd) 2>/dev/null
+		done done && sed 2>/dev/null test 'quoted text' 2>/dev/null
+	export echo && ${HOME} local
+"$@" $(pwd) 'quoted text'
+echo printf grep grep done sed cd
+awk 2>/dev/null | sed "$1"
+printf "$@" "$1" printf printf /usr/bin --verbose
+		-eu local 'quoted text' test -eu "$1" /usr/bin /usr/bin test
+&& | "$1" x=1 | "$@" grep /usr/bin 2>/dev/null 'quoted text' done done readonly
+		${HOME} local | awk printf /usr/bin then done ${HOME}
+	| -eu --verbose test local $(pwd) test then test x=1 "$1" 2>/dev/null
+		local grep && x=1 then ${HOME} $(pwd)
+	done 2>/dev/null readonly "$@" awk cd --verbose
+/usr/bin /usr/bin --verbose | local ${HOME}
+		cd local $(pwd) export echo "$@"
+		export sed | --verbose && printf readonly export local awk readonly cd 'quoted text'
+	| x=1 $(pwd) 'quoted text' $(pwd) readonly
+2>/dev/null local readonly done then readonly x=1
+	printf ${HOME} readonly -eu grep
+"$1" -eu /usr/bin -eu "$@" echo /usr/bin 'quoted text' sed 'quoted text' $(pwd)
+&& cd sed 2>/dev/null printf export
+		local export test $(pwd) | "$@"
+		sed /usr/bin $(pwd) sed x=1
+		-eu local "$1" $(pwd) cd --verbose
+		export awk "$1" cd export printf grep "$@" -eu "$@" 2>/dev/null
+	echo ${HOME} local && sed | awk 2>/dev/null cd readonly printf then echo 2>/dev/null
+	echo done local cd --verbose --verbose
+	&& test ${HOME} 2>/dev/null /usr/bin printf 'quoted text' 2>/dev/null x=1
+	'quoted text' "$1" local | --verbose 2>/dev/null | export "$1" test
+	${HOME} && -eu --verbose
+	local "$1" "$@" test --verbose done ${HOME}
+	&& echo 'quoted text' && printf "$@" "$1" 'quoted text' "$@" && awk &&
+then $(pwd) printf then awk 2>/dev/null && 2>/dev/null readonly /usr/bin
+		local export local -eu sed export cd -eu $(pwd)
+		cd "$@" then printf export $(pwd) export export "$1" -eu echo 2>/dev/null
+test "$1" ${HOME} cd echo sed 'quoted text' printf | local --verbose done $(pwd)
+--verbose echo printf readonly --verbose readonly export x=1
+	| test 2>/dev/null echo test readonly test ${HOME}
+	local "$@" test && local awk grep && test grep | grep test local export
+test sed sed ${HOME} then
+	'quoted text' -eu /usr/bin awk x=1 | $(pwd) export done export -eu awk awk cd
+/usr/bin | /usr/bin ${HOME} readonly done
+	cd echo local done sed 'quoted text' then | cd /usr/bin 'quoted text'
+$(pwd) --verbose ${HOME} awk done export
+		-eu sed && --verbose local ${HOME} export printf $(pwd) export 2>/dev/null
+2>/dev/null x=1 "$1" 'quoted text'
+		"$1" /usr/bin export
+		test sed echo x=1 printf $(pwd) test -eu /usr/bin
+x=1 readonly export x=1 'quoted text' local
+	2>/dev/null local echo echo readonly export
+		readonly local readonly grep export $(pwd) grep
+/usr/bin ${HOME} local -eu test
+readonly readonly 2>/dev/null "$1" local | printf --verbose 'quoted text'
+		export "$1" echo readonly cd readonly export export then -eu 2>/dev/null 2>/dev/null
+	awk | echo awk readonly readonly awk --verbose | x=1 ${HOME} 'quoted text'
+	"$1" 2>/dev/null export x=1 awk 2>/dev/null
+	done "$@" sed awk "$1" 2>/dev/null local printf
+	then test x=1 export "$1" echo ${HOME} | test ${HOME} && "$@" sed
+"$1" "$1" echo x=1 done 2>/dev/null printf cd && && &&
+		awk /usr/bin 2>/dev/null readonly ${HOME} $(pwd) done cd /usr/bin $(pwd) -eu "$@"
+	export awk x=1 -eu 2>/dev/null /usr/bin then then then --verbose
+		2>/dev/null echo grep test "$@" 'quoted text' ${HOME} test readonly printf
+		2>/dev/null | printf readonly readonly
+		echo readonly awk grep /usr/bin
+| readonly done /usr/bin export x=1 2>/dev/null 'quoted text' readonly local then
+	printf then $(pwd) ${HOME}
+	2>/dev/null grep "$1" $(pwd) 'quoted text'
+		grep done grep --verbose "$@" printf && 2>/dev/null
+	--verbose ${HOME} -eu "$1" grep ${HOME}
+		2>/dev/null && echo then -eu grep $(pwd) "$1" cd 2>/dev/null
+		printf "$@" $(pwd) readonly printf
+		echo | awk ${HOME} $(pwd) -eu "$@" 2>/dev/null grep
+	awk cd sed sed | printf export cd --verbose
+x=1 test -eu local done && grep printf test sed "$1"
+	done local grep sed cd done ${HOME} printf export && export
+		cd sed echo ${HOME} | --verbose then $(pwd) $(pwd) | && readonly
+		sed test && "$@" local "$@" then done $(pwd) awk /usr/bin
+-eu "$@" | "$@" export export && && "$1" done cd $(pwd) "$@" -eu 2>/dev/null
+		grep | | grep "$@" 'quoted text' | sed
+		$(pwd) $(pwd) ${HOME} done printf echo then | ${HOME} printf $(pwd)
+		/usr/bin "$@" test 2>/dev/null cd echo $(pwd)
+		&& -eu export ${HOME} printf readonly && grep | 'quoted text' test --verbose
+/usr/bin export 'quoted text' local
+'quoted text' "$@" readonly "$1"
+/usr/bin "$@" "$1" 'quoted text' "$@" echo export then ${HOME} /usr/bin
+	"$1" local "$1" | export then $(pwd) && grep | --verbose $(pwd) /usr/bin x=1
+		sed sed | --verbose sed "$@" "$@" ${HOME}
+		x=1 /usr/bin test printf sed "$1" --verbose 'quoted text'
+		| grep sed test printf --verbose "$1" $(pwd) "$1" printf
+		/usr/bin x=1 grep /usr/bin grep
+		cd "$@" x=1 --verbose then 2>/dev/null /usr/bin readonly
+awk echo /usr/bin $(pwd) -eu cd 2>/dev/null -eu grep $(pwd)
+	"$@" $(pwd) test x=1 2>/dev/null /usr/bin
+		x=1 'quoted text' export | /usr/bin | "$@" printf
+cd export readonly && printf test
+echo /usr/bin && printf then grep test awk readonly local test "$1" $(pwd)
+	-eu readonly $(pwd) 'quoted text' sed x=1 ${HOME} -eu printf
+		export done grep | x=1 x=1 "$1" "$@" && export --verbose local ${HOME} then
+		| grep | | local "$@" /usr/bin
+		-eu -eu && --verbose -eu export
+	grep && "$1" printf "$1" awk readonly sed export /usr/bin 'quoted text' sed
+	test | done printf 2>/dev/null test then 2>/dev/null readonly "$@" -eu export
+	awk cd local printf x=1
+		grep export "$@" | grep readonly /usr/bin "$1" "$@" local
+sed "$@" /usr/bin -eu
+		"$1" done x=1 'quoted text' export | then grep /usr/bin -eu "$@" echo echo export
+	2>/dev/null then && --verbose --verbose awk "$@" readonly local local local grep
+readonly then cd cd then sed | sed printf test echo && awk x=1
+&& /usr/bin "$@" && && readonly test -eu then && x=1 'quoted text' awk --verbose
+${HOME} /usr/bin && --verbose grep done "$1" export
+		cd -eu "$@" test then | --verbose
+	local awk 'quoted text' test /usr/bin then && $(pwd) export "$1" ${HOME} readonly
+-eu "$1" ${HOME} test echo "$1" 2>/dev/null
+	&& test "$1" x=1 echo local export "$1" sed cd grep ${HOME} sed | | "$1"
+awk done --verbose then done 'quoted text' --verbose $(pwd) "$@" &&
+2>/dev/null /usr/bin printf done
+export 'quoted text' | sed readonly done
+	${HOME} then awk | done export grep --verbose && test $(pwd)
+		readonly --verbose test test test --verbose then sed -eu /usr/bin
+| then "$1" cd grep awk local 'quoted text' cd $(pwd)
+"$1" -eu echo sed test && ${HOME} -eu /usr/bin sed echo "$@"
+		then printf sed --verbose -eu then
+	printf then local --verbose | echo "$@" export 'quoted text' ${HOME} printf
+		done export --verbose cd --verbose $(pwd) -eu awk ${HOME}
+${HOME} awk /usr/bin echo grep $(pwd) readonly then | then done $(pwd) | cd &&
+	printf $(pwd) "$1" done cd echo
+	cd test sed readonly readonly local
+	then "$@" $(pwd) ${HOME} cd "$@"
+	${HOME} | /usr/bin 'quoted text' awk echo export /usr/bin ${HOME}
+		&& echo then grep awk | && echo "$@" "$@" -eu local $(pwd) then export
+sed | /usr/bin done "$@" echo awk printf -eu /usr/bin echo $(pwd) x=1 x=1 "$1"
+	sed 'quoted text' ${HOME}
+		&& then test local test
+		cd ${HOME} -eu grep awk "$1" "$1"
+	local cd local sed --verbose cd /usr/bin done done done readonly $(pwd) 'quoted text'
+printf readonly /usr/bin local
+'quoted text' && $(pwd) sed local grep --verbose x=1 done export grep
+echo local echo 2>/dev/null 2>/dev/null "$1" 2>/dev/null
+		--verbose --verbose then 'quoted text' cd ${HOME} && export local
+	local && readonly sed x=1 ${HOME} done -eu printf $(pwd) && printf x=1 "$@" x=1
+-eu readonly --verbose awk x=1 x=1 "$@" printf && -eu readonly ${HOME} readonly
+		readonly --verbose $(pwd) done 'quoted text'
+2>/dev/null /usr/bin printf export readonly
+		local test x=1 export then then awk x=1 readonly 'quoted text'
+awk x=1 -eu done sed awk done export | | printf awk --verbose
+	-eu printf export echo printf ${HOME} cd sed 'quoted text'
+	"$1" --verbose ${HOME} sed local printf then sed
+		--verbose -eu $(pwd) x=1 | sed x=1
+printf local printf "$@" local $(pwd) -eu echo test "$@" export | | --verbose
+		--verbose test -eu echo test 'quoted text' ${HOME} cd -eu -eu awk
+	test -eu $(pwd) | then export --verbose ${HOME}
+		export echo printf | printf -eu test 'quoted text' "$1" printf awk
+		--verbose echo && local | 2>/dev/null
+| grep cd ${HOME} --verbose done --verbose awk then
+| "$1" echo export sed ${HOME} /usr/bin export 2>/dev/null printf
+awk $(pwd) echo x=1 x=1 'quoted text' export done 2>/dev/null && then
+		/usr/bin /usr/bin export then awk export readonly test readonly
+	2>/dev/null local readonly --verbose then "$@" local cd test export | printf
+		--verbose local 2>/dev/null test "$1" && ${HOME} readonly grep echo
+	export printf "$1" | test $(pwd) && $(pwd) cd -eu export
+	then done ${HOME} printf grep printf --verbose ${HOME} ${HOME}
+		grep "$1" x=1 ${HOME} && $(pwd)
+	export sed readonly 'quoted text' local test
+sed 'quoted text' cd echo ${HOME} && sed sed 2>/dev/null readonly printf
+		done grep local /usr/bin && done local cd /usr/bin x=1 echo --verbose sed 2>/dev/null
+readonly "$@" then /usr/bin
+local awk | "$@" "$@" then ${HOME} --verbose printf grep grep printf
+		'quoted text' /usr/bin --verbose local sed $(pwd) ${HOME} awk &&
+	"$1" /usr/bin -eu done && readonly export then 2>/dev/null
+	printf | "$@" then -eu /usr/bin test 'quoted text' then then
+-eu x=1 && x=1 cd cd 'quoted text'
+		done local x=1 2>/dev/null
+echo cd then --verbose | grep 2>/dev/null printf echo ${HOME}
+grep 2>/dev/null cd then sed then | awk "$1" $(pwd) -eu cd && | | export test
+| | --verbose grep "$1" --verbose echo x=1 /usr/bin readonly /usr/bin
+		--verbose | x=1 then /usr/bin --verbose -eu awk cd export 'quoted text'
+		"$@" | x=1 readonly then readonly test 2>/dev/null "$1" "$@"
+test 'quoted text' 2>/dev/null ${HOME} "$@" ${HOME} grep
+		&& "$@" export /usr/bin echo | printf grep grep "$1" "$1"
+	export $(pwd) "$@" ${HOME} /usr/bin ${HOME} printf cd --verbose
+		echo sed "$1" "$@" /usr/bin readonly
+	"$1" "$1" done export && then test done "$@" --verbose cd
+local local test local x=1 echo sed sed --verbose
+	cd printf echo --verbose && cd /usr/bin x=1 /usr/bin $(pwd)
+done sed readonly "$1" echo local cd "$1" local awk done && --verbose $(pwd) local
+-eu test ${HOME} x=1 grep /usr/bin 'quoted text'
+printf 'quoted text' local done -eu
+sed sed readonly -eu done $(pwd)
+		$(pwd) /usr/bin --verbose $(pwd) x=1
+local grep ${HOME} readonly local readonly
+		2>/dev/null | && $(pwd) 'quoted text' then |
+		echo ${HOME} test grep cd 'quoted text' 'quoted text' printf export
+		done "$@" 2>/dev/null readonly --verbose export
+		test echo $(pwd) local "$@" export && done export && $(pwd) readonly local
+	done && done $(pwd) 'quoted text' ${HOME} "$@" done then "$@"
+"$1" $(pwd) ${HOME} awk 'quoted text' "$@" printf 2>/dev/null "$@"
+		$(pwd) ${HOME} readonly done /usr/bin
+then $(pwd) x=1 cd | cd grep grep x=1
+test echo local && cd done && readonly
+	2>/dev/null cd sed readonly x=1 export test "$1"
+	printf x=1 export readonly grep done && 'quoted text' readonly
+	done sed $(pwd) 'quoted text'
+		/usr/bin local --verbose -eu
+		local test awk "$@" printf done
+	test --verbose cd printf | then local
+		awk printf readonly echo && ${HOME} local "$@" "$@" --verbose sed ${HOME}
+		printf cd sed test --verbose && --verbose ${HOME} readonly
+		${HOME} && test "$@" x=1 awk done -eu local cd local x=1 && local
+	| $(pwd) grep awk --verbose "$1" done printf | grep x=1
+		then done -eu | --verbose 2>/dev/null
+	printf printf export $(pwd) 'quoted text' then /usr/bin export export | && 'quoted text'
+		&& /usr/bin echo echo ${HOME} | export && done readonly
+		"$1" readonly grep /usr/bin -eu
+"$@" ${HOME} -eu -eu 2>/dev/null 'quoted text' cd awk | $(pwd)
+	awk 'quoted text' readonly /usr/bin done echo cd printf x=1 readonly --verbose
+	$(pwd) echo grep readonly grep sed awk local -eu -eu "$1" then $(pwd)
+	echo export export readonly sed -eu "$1"
+'quoted text' readonly /usr/bin && cd 'quoted text' cd export && echo echo ${HOME}
+		then sed && /usr/bin $(pwd) ${HOME} sed ${HOME} echo --verbose x=1 'quoted text'
+	"$@" -eu then local "$1" awk done sed -eu /usr/bin awk readonly --verbose /usr/bin
+	local cd grep && readonly --verbose export export "$@" | 'quoted text' && grep
+	export ${HOME} done --verbose --verbose -eu export x=1 | readonly
+		awk export sed echo export /usr/bin echo
+/usr/bin sed test $(pwd) --verbose "$@" "$1" printf 2>/dev/null -eu cd "$1"
+-eu --verbose export local grep printf 'quoted text'
+test x=1 printf readonly $(pwd) /usr/bin test --verbose grep --verbose readonly
+		readonly | then readonly export done sed
+		done && ${HOME} sed sed echo test -eu local then printf echo "$@" cd && test |
+	'quoted text' | awk 'quoted text' test 'quoted text'
+readonly /usr/bin | local | 2>/dev/null --verbose
+		grep sed ${HOME} readonly awk readonly "$@"
+export 'quoted text' && awk 2>/dev/null
+	then local printf 2>/dev/null
+		$(pwd) awk 2>/dev/null local
+done 2>/dev/null ${HOME} "$@" echo grep "$@" test printf
+	"$@" $(pwd) x=1 'quoted text'
+-eu done done local | awk
+	grep then cd && "$1" test cd then 2>/dev/null "$@" test done cd sed sed $(pwd)
+	printf x=1 /usr/bin 2>/dev/null
+local && test done done local test
+		grep sed --verbose -eu readonly /usr/bin $(pwd) local 'quoted text'
+	grep 2>/dev/null echo awk --verbose
+	x=1 then printf 2>/dev/null "$1"
+$(pwd) 2>/dev/null printf cd "$@" /usr/bin x=1 local grep --verbose
+	${HOME} test echo x=1 printf echo 2>/dev/null export export sed
+	'quoted text' --verbose cd awk
+	&& --verbose export && awk printf local x=1 grep /usr/bin
+	&& 'quoted text' done --verbose printf && | local printf -eu
+cd "$@" test "$1" export local then && then done --verbose "$1" cd
+test test test readonly local printf && ${HOME} cd && printf "$@" $(pwd)
+	then | test ${HOME} 2>/dev/null
+${HOME} awk --verbose awk x=1 /usr/bin 'quoted text'
+	/usr/bin export local printf 2>/dev/null 2>/dev/null
+	'quoted text' printf x=1 "$@" 2>/dev/null -eu cd "$@"
+	&& | then export done test sed then 'quoted text' 'quoted text' x=1
+	echo --verbose | cd 'quoted text' local done awk cd echo awk -eu
+echo ${HOME} readonly && echo /usr/bin echo && &&
+	"$@" grep | 2>/dev/null export
+&& grep test sed echo "$@" $(pwd) echo | --verbose && cd cd x=1 echo -eu done
+| 'quoted text' sed x=1 readonly
+	sed ${HOME} awk awk -eu --verbose awk --verbose cd $(pwd) "$1" -eu done then
+	export echo local --verbose
+		x=1 cd cd --verbose cd ${HOME} ${HOME}
+	--verbose | echo test x=1 grep "$@" cd 'quoted text' sed --verbose && |
+	x=1 /usr/bin 2>/dev/null then
+	/usr/bin cd 2>/dev/null "$@" export awk cd cd "$1" "$1" test awk cd "$1" export
+		test | then ${HOME} /usr/bin cd done test $(pwd) then then | test cd
+	readonly export grep "$@" echo --verbose -eu local "$1" local
+	printf 'quoted text' 2>/dev/null -eu test "$@" "$1" | | $(pwd) grep readonly
+		"$@" readonly local $(pwd) $(pwd) && readonly 'quoted text' && readonly -eu echo
+	readonly grep x=1 /usr/bin export then ${HOME} then echo grep done
+then --verbose 2>/dev/null /usr/bin
+/usr/bin --verbose test -eu "$@" ${HOME}
+done /usr/bin awk cd ${HOME} "$1" then printf export test /usr/bin
+done /usr/bin "$@" /usr/bin /usr/bin
+		"$@" printf readonly x=1 /usr/bin printf readonly
+	awk then /usr/bin "$1" -eu x=1 awk printf 'quoted text' local
+	echo awk awk local awk -eu 'quoted text' readonly
+/usr/bin 'quoted text' sed awk --verbose
+	then then local /usr/bin 'quoted text' cd printf 2>/dev/null sed $(pwd)
+	--verbose --verbose --verbose
+		-eu 'quoted text' then grep -eu
+printf grep "$@" -eu echo sed cd && awk cd echo grep x=1 "$1" test printf
+grep && x=1 printf -eu grep $(pwd) awk /usr/bin 2>/dev/null
+		test then $(pwd) grep readonly /usr/bin x=1 && 'quoted text' export
+	test 2>/dev/null ${HOME}
+		&& echo 2>/dev/null x=1 x=1 -eu "$1" 'quoted text' $(pwd) readonly echo grep
+cd export ${HOME} awk grep -eu echo /usr/bin $(pwd) 'quoted text' export "$@"
+	"$@" "$1" 2>/dev/null local done ${HOME}
+	/usr/bin "$@" "$@" then printf /usr/bin -eu /usr/bin
+	local cd /usr/bin --verbose | readonly export echo --verbose
+	${HOME} local then readonly done --verbose
+x=1 echo grep && test done grep
+	2>/dev/null echo awk then then test test "$1" /usr/bin
+	$(pwd) $(pwd) /usr/bin 'quoted text'
+		test && readonly "$1" && /usr/bin export $(pwd) && | readonly
+local export 'quoted text' "$1" export
+readonly | export readonly | export /usr/bin readonly "$@"
+		export | sed echo grep done "$1" cd -eu $(pwd) $(pwd) printf && "$1" local 2>/dev/null
+	local -eu ${HOME} && printf cd 'quoted text'
+	'quoted text' echo sed x=1 2>/dev/null
+${HOME} printf --verbose && $(pwd) $(pwd) then export 2>/dev/null
+		--verbose ${HOME} /usr/bin echo
+test /usr/bin grep && -eu $(pwd) 2>/dev/null && $(pwd) ${HOME} --verbose
+cd echo printf /usr/bin
+		&& 'quoted text' 'quoted text' 2>/dev/null
+cd ${HOME} then local local 'quoted text'
+/usr/bin then "$1" ${HOME} then grep x=1 "$1" ${HOME} "$@" readonly awk
+awk export "$1" printf done printf "$1" "$@" "$@" sed ${HOME} --verbose
+		'quoted text' $(pwd) done "$@" test readonly | "$1" "$@" local export &&
+	$(pwd) then 2>/dev/null "$1" --verbose -eu done test
+		test "$@" "$1" && 'quoted text' --verbose --verbose
+		cd /usr/bin ${HOME} test --verbose then "$1" | "$1" 'quoted text' local
+	$(pwd) && 'quoted text' --verbose export "$1" x=1 "$@" grep local sed cd then local
+	x=1 grep && $(pwd) 2>/dev/null
+grep sed --verbose "$1" x=1 --verbose
+done 'quoted text' awk "$1" awk printf /usr/bin "$@" && "$1" 2>/dev/null
+test sed ${HOME} ${HOME} readonly /usr/bin grep "$@" local "$1"
+	&& printf readonly cd test printf 2>/dev/null local
+		readonly "$@" echo $(pwd) export --verbose ${HOME} then export done "$@" 'quoted text'
+readonly export local | -eu 2>/dev/null "$1" done |
+	printf -eu done ${HOME} awk --verbose | x=1 /usr/bin
+	'quoted text' 2>/dev/null 'quoted text' 2>/dev/null | && sed ${HOME}
+done "$1" printf x=1 awk | && -eu "$@" --verbose --verbose | printf
+export export cd then && "$1" && &&
+		&& "$@" 2>/dev/null test "$1" "$1" x=1 sed local
+export done --verbose printf 2>/dev/null
+	cd "$1" -eu readonly "$@" ${HOME} -eu
+		sed ${HOME} local sed /usr/bin --verbose test && printf 2>/dev/null
+	'quoted text' printf --verbose && --verbose
+		then 'quoted text' ${HOME} sed printf
+	-eu | awk "$1" x=1 test ${HOME} local && sed 'quoted text'
+export ${HOME} /usr/bin $(pwd) "$@" /usr/bin grep 2>/dev/null export ${HOME} awk
+		$(pwd) ${HOME} local echo /usr/bin export sed "$@" awk echo
+'quoted text' echo cd export readonly
+	&& | --verbose 'quoted text' /usr/bin ${HOME} /usr/bin "$1" && sed grep
+	| test "$1" then echo echo /usr/bin --verbose
+	'quoted text' /usr/bin local local
+awk | x=1 done sed -eu local printf /usr/bin
+		test sed "$@" done $(pwd) 'quoted text' ${HOME}
+| 'quoted text' 2>/dev/null sed "$@" cd "$1" $(pwd) awk --verbose sed local
+	&& /usr/bin x=1 done /usr/bin done
+	&& -eu | && export && $(pwd) && grep 'quoted text'
+		done awk echo "$1" echo /usr/bin grep sed "$1" "$1"
+		-eu "$@" --verbose echo "$1" test awk | -eu ${HOME}
+		test awk /usr/bin awk done | grep printf x=1 2>/dev/null grep readonly 'quoted text'
+	sed then then ${HOME} 2>/dev/null export
+		-eu export sed grep export | 'quoted text' && sed | --verbose
+then && ${HOME} x=1 'quoted text' && && printf grep local done local
+	&& done /usr/bin "$@" x=1 test
+		grep then 'quoted text' printf 2>/dev/null
+	--verbose "$1" 'quoted text' $(pwd) |
+	"$@" 2>/dev/null sed awk --verbose x=1 2>/dev/null --verbose "$@" done 2>/dev/null
+		printf x=1 sed "$1" | echo x=1 grep readonly export $(pwd)
+		x=1 cd | $(pwd) 2>/dev/null 'quoted text' grep printf 'quoted text'
+	&& /usr/bin sed --verbose echo echo "$@" -eu
+| test grep printf $(pwd) --verbose echo echo
+cd $(pwd) echo /usr/bin grep
+-eu && 'quoted text' printf
+		local cd --verbose "$1" "$1" test $(pwd) $(pwd)
+${HOME} "$1" sed "$@" done --verbose -eu &&
+	"$1" $(pwd) /usr/bin --verbose export readonly && echo test --verbose
+then x=1 export "$@" grep printf
+	${HOME} "$1" && sed && local done /usr/bin grep awk 2>/dev/null
+	"$@" 2>/dev/null printf awk $(pwd) 2>/dev/null x=1 readonly ${HOME} /usr/bin --verbose
+readonly export | printf readonly cd -eu cd export "$1" 2>/dev/null "$@" cd "$1"
+-eu test 'quoted text' local 'quoted text' echo | /usr/bin test -eu --verbose
+	done printf -eu x=1 test awk then
+		x=1 done cd x=1 then test printf ${HOME} test --verbose /usr/bin
+		| cd --verbose test 'quoted text' | printf
+	then "$1" grep done | sed --verbose "$1" sed && | 2>/dev/null echo
+	grep $(pwd) ${HOME} printf echo $(pwd) cd 2>/dev/null -eu then done
+	"$@" --verbose then export 'quoted text' /usr/bin
+		readonly local "$1" "$@" awk ${HOME} /usr/bin export awk /usr/bin then
+	test printf "$@" awk then --verbose /usr/bin "$@" "$1" x=1 printf echo
+		"$1" awk -eu export -eu "$@" --verbose
+		$(pwd) then echo grep awk test then && --verbose -eu sed /usr/bin
+		"$1" $(pwd) $(pwd) --verbose && printf --verbose
+	cd 'quoted text' --verbose && test readonly 'quoted text' $(pwd)
+	cd then -eu /usr/bin && awk | --verbose
+-eu "$1" then printf | then grep 'quoted text' "$@" --verbose export
+2>/dev/null echo && cd --verbose
+	grep && | x=1 then test export export 'quoted text'
+	&& printf test | /usr/bin export /usr/bin -eu test readonly
+	${HOME} "$1" $(pwd) test -eu --verbose awk echo &&
+	${HOME} && 2>/dev/null printf local x=1 printf awk awk 'quoted text'
+	sed readonly $(pwd) "$@" readonly && && readonly -eu
+		-eu "$@" "$@" $(pwd) test cd "$@" awk | && grep grep
+test "$1" echo grep "$@" export "$1" export | 2>/dev/null
+		printf x=1 test | $(pwd)
+echo --verbose x=1 x=1 && 'quoted text'
+		-eu done && "$@" echo printf "$1" --verbose ${HOME} export
+	done "$@" done test "$1"
+test ${HOME} --verbose && cd "$1" ${HOME} readonly
+		sed $(pwd) readonly 2>/dev/null $(pwd) | "$1"
+		printf readonly export sed grep export test
+'quoted text' | local "$@" export "$1" export
+		grep then --verbose echo printf | --verbose local
+		-eu 'quoted text' --verbose awk cd "$1" | test local then "$@" 'quoted text' --verbose
+	export 2>/dev/null grep readonly /usr/bin
+done 'quoted text' && cd
+done local cd printf local 'quoted text' x=1
+		/usr/bin done 2>/dev/null export $(pwd) sed ${HOME} -eu printf --verbose
+		&& -eu "$1" local x=1 2>/dev/null /usr/bin local grep x=1 test readonly $(pwd)
+	x=1 export 2>/dev/null "$1" -eu export 2>/dev/null
+		"$1" x=1 $(pwd) test export --verbose "$1" awk 'quoted text' export local done
+		"$@" x=1 export --verbose grep --verbose test export "$@" --verbose then
+		cd x=1 ${HOME} test cd /usr/bin ${HOME} 'quoted text'
+		export grep then -eu then && awk awk awk --verbose sed cd awk | "$1" 'quoted text'
+		'quoted text' && /usr/bin export "$@" -eu test "$1" ${HOME} | | x=1 2>/dev/null
+	cd "$@" ${HOME} --verbose
+cd $(pwd) 2>/dev/null && $(pwd) && export --verbose | /usr/bin /usr/bin
+"$1" grep readonly echo
+		echo && 2>/dev/null test echo done export printf
+	&& ${HOME} ${HOME} $(pwd) "$1" printf awk local cd | x=1 export
+	'quoted text' "$1" grep ${HOME} grep 2>/dev/null "$@" ${HOME} printf
+grep readonly --verbose "$1"
+	cd cd readonly | test 'quoted text'
+		done $(pwd) 2>/dev/null --verbose --verbose "$@" echo test echo 'quoted text'
+	test 'quoted text' $(pwd) "$@" $(pwd) ${HOME} printf grep "$@" echo x=1 2>/dev/null
+	readonly -eu x=1 printf local /usr/bin --verbose
+	readonly cd sed -eu ${HOME} | grep echo cd grep "$@" -eu cd readonly readonly
+		x=1 | sed local sed export grep |
+	x=1 "$1" /usr/bin 'quoted text' printf readonly test
+	'quoted text' 2>/dev/null --verbose /usr/bin done /usr/bin
+echo cd then x=1 ${HOME} && -eu && sed grep ${HOME} "$@" sed sed test grep
+	2>/dev/null /usr/bin $(pwd) && readonly
+		grep ${HOME} export "$1"
+		then 2>/dev/null /usr/bin done readonly "$@" "$@" export "$@" "$@"
+${HOME} ${HOME} "$1" "$1" echo echo echo $(pwd) done local && --verbose
+		done done /usr/bin --verbose local /usr/bin --verbose "$@" done "$@"
+	"$@" printf $(pwd) grep then --verbose 2>/dev/null --verbose 'quoted text' "$@"
+		"$1" echo 2>/dev/null "$@" --verbose done echo printf
+		awk printf 'quoted text'
+-eu local test test | cd local echo done | /usr/bin
+	awk "$1" --verbose printf --verbose done awk cd test printf /usr/bin
+	printf && -eu 'quoted text' grep grep cd then | ${HOME} echo local
+-eu test then printf sed
+awk | "$1" grep && local export
+	${HOME} printf printf cd "$@" sed echo printf then echo "$1" /usr/bin
+	x=1 x=1 echo -eu "$1" /usr/bin
+		x=1 | --verbose 'quoted text' --verbose "$@" done local test printf readonly "$1"
+	then awk export awk ${HOME} done --verbose readonly grep then then
+		printf test && $(pwd) readonly
+awk local printf export | test && readonly test && 'quoted text' x=1
+"$1" cd ${HOME} echo ${HOME} awk $(pwd) x=1 readonly x=1
+		${HOME} local done awk /usr/bin
+	${HOME} 2>/dev/null | readonly awk printf "$1" grep export
+	&& test sed then cd | 2>/dev/null ${HOME} cd awk | echo local -eu sed
+		grep sed 2>/dev/null export /usr/bin local
+		readonly 'quoted text' && then ${HOME}
+		'quoted text' 2>/dev/null
+${HOME} x=1 /usr/bin 'quoted text' ${HOME}
+	--verbose "$1" | x=1 export readonly
+done $(pwd) 2>/dev/null local then
+		then -eu test ${HOME} printf test echo && awk
+	then awk then awk x=1 done grep export test readonly then ${HOME}
+		"$1" echo | test test | printf
+	awk 'quoted text' /usr/bin done --verbose "$1" echo "$@"
+		readonly ${HOME} | x=1 'quoted text' echo && 2>/dev/null --verbose
+'quoted text' --verbose grep x=1 test --verbose $(pwd) -eu echo $(pwd)
+	grep awk sed local awk $(pwd) export
+export export "$@" 'quoted text'
+awk -eu 'quoted text' local 'quoted text' /usr/bin sed 2>/dev/null
+		sed cd "$1" "$1" printf 'quoted text' | done test test cd awk done awk
+		&& done test 'quoted text' test export ${HOME} cd local -eu --verbose awk /usr/bin
+		done -eu local then ${HOME}
+	export sed readonly test echo local readonly
+	export 2>/dev/null $(pwd) 2>/dev/null local $(pwd) done test local "$1" ${HOME}
+	"$@" local then export "$@" x=1 grep local printf export awk test &&
+		x=1 sed x=1 | 2>/dev/null export cd local -eu
+	2>/dev/null awk awk readonly echo $(pwd) x=1 $(pwd) awk echo
+		x=1 "$@" local -eu /usr/bin then awk && then local readonly then | awk echo
+awk /usr/bin /usr/bin then 2>/dev/null
+&& ${HOME} -eu readonly $(pwd) readonly
+awk export && then -eu -eu test local ${HOME}
+$(pwd) printf readonly $(pwd)
+		cd && cd grep sed | && grep $(pwd) "$@" then 'quoted text' done 'quoted text'
+awk local ${HOME} printf ${HOME} echo awk && printf $(pwd) | readonly $(pwd)
+	sed $(pwd) "$@" sed export awk done grep done sed echo
+	then test grep sed /usr/bin readonly
+		x=1 test printf grep && test echo /usr/bin
+		export grep ${HOME} then /usr/bin local
+		&& $(pwd) ${HOME} local ${HOME} local echo && $(pwd)
+		--verbose "$1" 'quoted text' readonly export echo local -eu $(pwd)
+	2>/dev/null "$@" printf export sed "$1" "$@"
+$(pwd) done $(pwd) 'quoted text' awk grep then | 'quoted text' -eu readonly export
+	echo "$1" 'quoted text' && printf
+		echo && "$@" && ${HOME} printf | --verbose x=1 /usr/bin then -eu awk x=1 echo
+	| ${HOME} awk "$1" awk cd
+	| && | then test done && printf "$@" $(pwd) grep && "$1" $(pwd) /usr/bin readonly
+		| awk local local "$@" ${HOME} ${HOME} 'quoted text'
+&& $(pwd) awk /usr/bin then sed grep 'quoted text' -eu printf
+	local | export 'quoted text' -eu /usr/bin done ${HOME} $(pwd) | -eu cd then
+		local x=1 readonly 'quoted text' | "$1" echo test
+local "$1" && "$1" local export test readonly | export $(pwd) x=1
+	cd "$1" printf --verbose local test readonly test grep
+		${HOME} readonly && readonly | --verbose | readonly done test readonly 2>/dev/null
+	echo "$@" $(pwd) printf export then awk "$@"
+	grep echo "$1" x=1 awk cd printf grep --verbose x=1 2>/dev/null /usr/bin
+	test printf 2>/dev/null && done ${HOME}
+"$1" 2>/dev/null test 'quoted text' export
+-eu grep test "$1" test /usr/bin "$1" export -eu
+		done && --verbose local then echo export printf "$1"
+$(pwd) printf export export
+		-eu echo -eu ${HOME} export export x=1 -eu && readonly -eu 'quoted text'
+local grep local 2>/dev/null ${HOME} printf -eu | printf echo printf
+		--verbose grep /usr/bin local then then sed "$1" && export
+	echo ${HOME} /usr/bin printf $(pwd) && awk done
+	then grep "$1" printf printf test && 'quoted text' printf "$1"
+		cd done ${HOME} --verbose local ${HOME} then awk done printf test -eu grep local
+x=1 $(pwd) grep echo x=1 | sed done --verbose
+x=1 'quoted text' 2>/dev/null ${HOME} then && test
+	-eu local cd --verbose
+		readonly | --verbose | then test local then && ${HOME} done && /usr/bin printf
+	printf echo cd "$1" printf local x=1
+"$1" export | 'quoted text' test
+		awk /usr/bin --verbose 'quoted text'
+		| "$@" then done cd ${HOME}
+sed 'quoted text' echo -eu && then echo 2>/dev/null
+printf --verbose then | grep export
+	sed $(pwd) "$1" $(pwd) local awk readonly then awk "$@" 'quoted text' | $(pwd)
+	/usr/bin $(pwd) grep | x=1 "$@" /usr/bin 2>/dev/null
+test $(pwd) readonly x=1 "$1"
+		&& then done /usr/bin x=1 /usr/bin
+/usr/bin local "$@" x=1 grep cd grep "$1" done "$@" then readonly
+		'quoted text' echo $(pwd) done "$@" -eu
+${HOME} awk -eu /usr/bin awk echo -eu grep awk printf x=1
+	grep | "$1" 2>/dev/null grep printf local 2>/dev/null
+--verbose | --verbose "$@" | cd &&
+		"$@" awk $(pwd) /usr/bin cd 'quoted text'
+		sed 'quoted text' then cd && done 2>/dev/null
+	2>/dev/null | && test printf --verbose x=1 x=1 local
+echo sed export awk cd echo "$@" then -eu
+cd /usr/bin cd --verbose done x=1 $(pwd) ${HOME} /usr/bin
+		test --verbose cd test test grep "$1" echo ${HOME}
+&& ${HOME} cd 2>/dev/null x=1 /usr/bin echo local local cd test local
+		x=1 local x=1 && then -eu cd 'quoted text' -eu export test readonly
+		awk 2>/dev/null awk local /usr/bin | export
+| awk -eu then -eu "$1" && ${HOME}
+	sed | 'quoted text' 'quoted text' done awk
+		'quoted text' "$1" x=1 -eu 'quoted text' --verbose ${HOME} sed readonly
+	test "$@" local | && test done grep local export awk test done export $(pwd) printf
+	echo then "$1" -eu echo echo echo printf sed test /usr/bin
+-eu readonly "$@" cd grep done x=1 && then && echo /usr/bin /usr/bin
+	done awk awk grep ${HOME} test export test grep export
+export done export done then --verbose
+		awk ${HOME} printf "$@" echo
+	readonly /usr/bin grep readonly -eu readonly 'quoted text' x=1 --verbose then
+	printf --verbose 'quoted text' -eu /usr/bin readonly 'quoted text' grep
+	${HOME} done done && 'quoted text'
+	sed grep local echo then | $(pwd) "$@" readonly
+-eu "$1" | printf then awk then test 'quoted text' awk printf ${HOME}
+/usr/bin ${HOME} "$1" "$@" $(pwd) local "$1" && /usr/bin local ${HOME}
+	--verbose /usr/bin printf "$1" ${HOME} 2>/dev/null
+readonly /usr/bin | && then sed $(pwd) | then test -eu ${HOME}
+x=1 test then printf readonly readonly printf | test
+export --verbose test $(pwd) --verbose
+		"$1" | local 2>/dev/null /usr/bin 2>/dev/null then
+test $(pwd) grep x=1 local ${HOME} $(pwd) 2>/dev/null 'quoted text'
+		&& $(pwd) ${HOME} 2>/dev/null then done printf sed cd then $(pwd)
+printf && test -eu -eu then
+| 2>/dev/null $(pwd) readonly "$1" /usr/bin -eu &&
+		"$@" x=1 2>/dev/null | readonly "$@" $(pwd) export "$1" | readonly export
+done sed grep awk $(pwd) readonly printf echo x=1
+test x=1 | | $(pwd) then 2>/dev/null | --verbose "$@" printf
+		readonly "$1" $(pwd) export 'quoted text' && local sed done
+		local then 'quoted text'
+	"$@" | done grep ${HOME} test 2>/dev/null
+		2>/dev/null readonly grep ${HOME} /usr/bin 'quoted text' -eu printf -eu
+		/usr/bin "$@" 'quoted text' $(pwd) 2>/dev/null
+/usr/bin --verbose x=1 done cd printf readonly && | "$1" 'quoted text' && awk
+		printf cd cd "$@" printf $(pwd) local awk $(pwd) export local echo cd 2>/dev/null
+		local | grep done --verbose -eu grep local
+"$@" ${HOME} awk --verbose test readonly --verbose sed --verbose --verbose
+sed | grep 'quoted text' test cd && -eu done ${HOME} ${HOME} "$1" readonly
+		"$1" -eu awk export && "$1" $(pwd)
+x=1 grep echo readonly readonly done printf sed done printf x=1 $(pwd)
+	'quoted text' && ${HOME} /usr/bin printf
+&& /usr/bin then "$1" echo x=1 grep cd x=1 test test -eu readonly 2>/dev/null
+test x=1 --verbose echo /usr/bin "$@"
+cd test -eu done readonly printf --verbose -eu grep export -eu export 2>/dev/null
+echo done readonly printf awk $(pwd) test
+		awk -eu --verbose cd export echo cd 'quoted text' /usr/bin
+| && echo then printf local echo /usr/bin 2>/dev/null
+	"$1" x=1 echo done --verbose done $(pwd)
+sed sed ${HOME} "$1" /usr/bin readonly 'quoted text' printf 'quoted text' awk &&
+	local done --verbose "$1" -eu --verbose export
+"$1" /usr/bin 2>/dev/null ${HOME} "$1" && echo export test $(pwd)
+	echo && "$1" done x=1 sed echo $(pwd) | cd
+	"$1" "$@" printf then export && --verbose
+	| cd local done "$1" 'quoted text'
+x=1 local local $(pwd) export cd "$@" local && "$1" x=1 "$@"
+local then local export readonly && 2>/dev/null echo ${HOME} "$1" ${HOME}
+	2>/dev/null test "$1"
+		/usr/bin done "$1" sed "$1" --verbose 2>/dev/null 2>/dev/null | /usr/bin
+	"$@" "$@" export && | $(pwd)
+printf $(pwd) "$1" done -eu test awk "$@" readonly "$@"
+		local && then test printf sed grep ${HOME} && $(pwd) sed export grep grep
+-eu --verbose echo | test "$1"
+	grep -eu printf x=1 /usr/bin "$1" && x=1 && test cd 2>/dev/null sed
+done x=1 x=1 x=1 2>/dev/null x=1 then
+readonly test $(pwd) 2>/dev/null --verbose x=1 grep printf && sed
+	sed "$1" | ${HOME} then /usr/bin
+	$(pwd) echo echo test export done
+	test --verbose done | done /usr/bin test printf printf ${HOME}
+	--verbose grep x=1 local
+		awk --verbose ${HOME} printf grep /usr/bin local done echo 2>/dev/null
+&& 2>/dev/null "$@" $(pwd)
+&& --verbose /usr/bin $(pwd) readonly
+	sed then "$1" ${HOME}
+		cd printf awk -eu done && test
+${HOME} local /usr/bin -eu readonly --verbose -eu x=1 then ${HOME} then awk 2>/dev/null
+--verbose $(pwd) grep ${HOME} printf -eu printf 'quoted text'
+printf x=1 test readonly --verbose done readonly then | printf local
+		'quoted text' x=1 cd /usr/bin | "$1" | local cd awk -eu local /usr/bin
+		echo x=1 "$@" 2>/dev/null && "$@" && done
+		"$@" "$@" printf "$1" | $(pwd) printf export awk printf | x=1 | "$1" 2>/dev/null
+		-eu 2>/dev/null done x=1 ${HOME} cd grep "$1" local done test
+grep -eu echo sed "$@" "$1" grep x=1 local
+		sed 'quoted text' && local echo -eu --verbose
+readonly then export -eu && ${HOME} "$@" --verbose export test x=1 /usr/bin
+		$(pwd) cd --verbose printf local "$@" | 2>/dev/null
+	printf $(pwd) sed && sed
+sed x=1 -eu done "$1" ${HOME} local done cd "$1" 2>/dev/null
+	$(pwd) cd readonly done /usr/bin then grep done 'quoted text'
+	export done readonly && printf "$1" then "$1" then | "$1"
+	--verbose printf export "$@" -eu readonly | --verbose
+	test printf echo -eu 'quoted text' --verbose --verbose then test $(pwd) grep x=1
+$(pwd) test local echo export local ${HOME} -eu 2>/dev/null grep /usr/bin --verbose
+x=1 printf | x=1 'quoted text' 'quoted text' /usr/bin grep sed done "$1" -eu 2>/dev/null
+	readonly test done 2>/dev/null | ${HOME}
+	local echo echo ${HOME} sed
+then done sed && "$1" sed done 2>/dev/null
+		awk echo /usr/bin sed && -eu
+	"$1" -eu sed x=1 "$@" sed readonly && 'quoted text' "$1" cd | grep
+		"$1" awk | "$@" /usr/bin export "$1"
+	--verbose $(pwd) local
+	&& test | readonly readonly grep 'quoted text' /usr/bin
+	local awk | 2>/dev/null awk $(pwd) --verbose
+	local test sed echo awk test echo done /usr/bin echo x=1 sed local
+/usr/bin x=1 && readonly x=1 /usr/bin 2>/dev/null 'quoted text'
+		| cd ${HOME} 'quoted text' --verbose printf "$@"
+$(pwd) /usr/bin local local && readonly $(pwd) && done "$1" /usr/bin
+--verbose readonly grep test awk local sed cd done | -eu cd grep
+		local grep "$@" cd -eu /usr/bin 2>/dev/null sed cd 'quoted text'
+		then $(pwd) printf $(pwd) && -eu local cd
+&& export -eu --verbose "$1" 'quoted text' sed
+		readonly 'quoted text' then
+		"$@" printf --verbose sed $(pwd) && done && 'quoted text'
+'quoted text' then --verbose x=1
+	readonly readonly test readonly "$1" printf done cd readonly then --verbose
+awk && readonly sed cd && awk /usr/bin ${HOME} -eu local
+	&& awk && echo printf readonly readonly &&
+	x=1 -eu "$@" "$1" export local export grep --verbose
+		printf ${HOME} | export 'quoted text' | awk && 2>/dev/null
+x=1 /usr/bin grep local && grep $(pwd)
+		"$1" awk 'quoted text' grep printf
+		x=1 | export "$@" test awk cd "$1"
+		readonly -eu sed --verbose | ${HOME} export grep
+		"$@" cd local printf 'quoted text' sed
+		sed "$@" ${HOME} x=1 cd
+		test grep cd 2>/dev/null 'quoted text' awk done |
+		local ${HOME} -eu printf && sed | export awk
+		${HOME} /usr/bin x=1 done export
+		sed cd local readonly 'quoted text' -eu "$@" sed
+	'quoted text' export local && echo sed ${HOME}
+		grep awk ${HOME} 'quoted text' echo /usr/bin
+		&& "$1" done x=1 sed printf
+	sed sed ${HOME} 2>/dev/null export && printf | printf $(pwd) export
+| readonly sed printf grep cd export local /usr/bin && --verbose
+	${HOME} 2>/dev/null export /usr/bin sed grep export export 'quoted text'
+	grep done test sed then local /usr/bin printf grep $(pwd)
+x=1 readonly "$@" /usr/bin done
+		"$@" echo /usr/bin cd cd $(pwd)
+	--verbose done grep printf export "$@" $(pwd) cd awk x=1 2>/dev/null cd
+x=1 test "$1" then test cd && cd awk x=1 cd
+		| | cd /usr/bin printf awk grep 2>/dev/null ${HOME} x=1 | printf printf 2>/dev/null
+--verbose sed awk then x=1 'quoted text' x=1 /usr/bin "$1" sed ${HOME} | then
+		${HOME} test echo export x=1 local x=1 2>/dev/null
+		/usr/bin && x=1 sed 2>/dev/null then && "$1" 2>/dev/null
+		2>/dev/null && 'quoted text' $(pwd) local /usr/bin export sed
+/usr/bin x=1 --verbose then printf --verbose done "$1" && local
+readonly --verbose test grep readonly
+then | cd /usr/bin && "$@" -eu "$@" 2>/dev/null 2>/dev/null
+$(pwd) | 'quoted text' readonly && readonly x=1 echo /usr/bin && 'quoted text'
+'quoted text' done --verbose
+	${HOME} --verbose "$1" -eu then 'quoted text' --verbose
+&& echo grep awk /usr/bin done
+	2>/dev/null $(pwd) /usr/bin
+		x=1 done 2>/dev/null $(pwd)
+export test 2>/dev/null grep sed "$@" $(pwd) cd local printf /usr/bin
+	cd printf export echo && local cd x=1 /usr/bin --verbose done "$1"
+	"$1" -eu x=1 | readonly done --verbose
+'quoted text' export -eu test readonly | "$@" $(pwd) "$1"
+		cd 'quoted text' readonly &&
+		"$@" readonly then x=1 -eu
+	test ${HOME} | then --verbose /usr/bin --verbose x=1 test awk awk printf
+test --verbose awk && test ${HOME} 'quoted text' ${HOME} /usr/bin
+	"$1" /usr/bin export export sed local grep &&
+	grep $(pwd) then "$1" --verbose ${HOME}
+		export awk | readonly cd "$@" done "$1" /usr/bin
+		-eu --verbose then printf -eu then 'quoted text' then
+	$(pwd) && grep --verbose "$@" | done then 'quoted text' 2>/dev/null
+		local cd readonly cd sed -eu --verbose | 2>/dev/null local
+		--verbose echo "$@" -eu printf readonly 2>/dev/null
+printf 'quoted text' 'quoted text' /usr/bin /usr/bin
+x=1 echo "$@" 2>/dev/null cd 'quoted text' && "$1"
+echo done done --verbose /usr/bin --verbose ${HOME} "$@" 2>/dev/null
+		test readonly x=1 printf x=1 grep && $(pwd) sed | local cd printf "$1" then -eu
+	$(pwd) echo local && "$@" awk done | done "$@" sed printf cd test
+	"$@" then -eu 'quoted text' cd 'quoted text'
+	${HOME} "$@" --verbose x=1 export && | cd sed 2>/dev/null /usr/bin && export
+		-eu grep ${HOME} -eu && x=1 sed test then ${HOME}
+/usr/bin export | /usr/bin echo local && ${HOME} && 'quoted text'
+		echo export ${HOME} "$1" printf && $(pwd) grep |
+	x=1 | local $(pwd) test printf test sed awk readonly x=1 2>/dev/null local -eu
+		-eu --verbose cd 'quoted text' "$@" then local
+		export awk --verbose && |
+		grep awk --verbose x=1 "$@" sed "$@" 'quoted text' test && test -eu
+'quoted text' cd awk grep
+	/usr/bin printf | test test test /usr/bin -eu $(pwd) x=1 -eu 'quoted text'
+	--verbose cd -eu printf awk x=1 ${HOME} printf grep
+	-eu echo "$@" grep "$1" | | printf "$@" x=1 awk $(pwd) | sed "$@" cd
+readonly awk x=1 readonly local echo readonly echo x=1 "$@" done $(pwd) export
+--verbose x=1 done 2>/dev/null --verbose "$1"
+then grep 2>/dev/null readonly then 'quoted text' sed
+"$@" grep local && sed sed | "$@" $(pwd)
+'quoted text' 2>/dev/null --verbose test | -eu
+	export then "$1" -eu done readonly
+	2>/dev/null 2>/dev/null 'quoted text' -eu --verbose grep test then ${HOME} readonly
+	/usr/bin /usr/bin echo -eu test then then readonly 'quoted text'
+		x=1 local $(pwd) 2>/dev/null | "$@" /usr/bin
+	--verbose "$1" 'quoted text' ${HOME}
+		cd "$@" /usr/bin export && "$@" export test local awk | "$@"
+	printf 2>/dev/null done
+		--verbose awk ${HOME} then ${HOME} done
+	-eu export && done $(pwd) /usr/bin printf export awk export printf readonly
+	grep /usr/bin sed "$@" grep grep test
+		-eu /usr/bin | $(pwd)
+	x=1 2>/dev/null cd $(pwd) grep "$1" | $(pwd) -eu printf -eu then $(pwd)
+	$(pwd) --verbose "$@" /usr/bin && cd | done
+	$(pwd) ${HOME} 2>/dev/null --verbose
+grep printf sed -eu test echo then grep /usr/bin sed | /usr/bin
+		&& done /usr/bin --verbose
+	${HOME} sed cd local && | echo echo
+	2>/dev/null local $(pwd) "$@" --verbose then && /usr/bin
+		echo 'quoted text' grep done "$1"
+		"$1" sed $(pwd) "$1" export "$@" /usr/bin "$@" /usr/bin
+		$(pwd) 2>/dev/null /usr/bin cd
+awk printf export -eu
+	x=1 then sed local 'quoted text' sed "$@" echo readonly
+	export -eu test --verbose readonly printf readonly
+		'quoted text' then cd test export
+x=1 "$1" -eu && test cd --verbose
+--verbose | | echo cd export /usr/bin 2>/dev/null
+test echo x=1 then && local awk cd $(pwd)
+		echo "$1" x=1 sed test then export
+		cd 2>/dev/null /usr/bin | done 'quoted text' printf 2>/dev/null printf
+test ${HOME} x=1 -eu test ${HOME} done 'quoted text' grep "$1" awk printf 2>/dev/null
+test | test cd 2>/dev/null 2>/dev/null x=1
+	x=1 | 'quoted text' /usr/bin
+		printf $(pwd) grep "$@" test sed /usr/bin --verbose
+	'quoted text' cd "$@" cd && test local cd awk -eu "$@" x=1
+	"$@" printf awk printf --verbose $(pwd)
+		| ${HOME} ${HOME} "$@" "$1" | grep
+	"$@" local grep done && "$1" grep sed printf
+--verbose test | --verbose 'quoted text'
+	&& printf $(pwd) "$1" awk
+printf printf ${HOME} sed local -eu echo
+		echo /usr/bin echo -eu export local echo readonly $(pwd)
+	echo "$@" | then sed -eu printf 2>/dev/null then 2>/dev/null -eu export sed printf
+awk /usr/bin readonly then test done 'quoted text'
+echo grep export /usr/bin x=1 grep awk && $(pwd) -eu "$@" | local test
+${HOME} cd ${HOME} $(pwd) done
+${HOME} test grep then
+	"$1" readonly cd done
+printf 'quoted text' 'quoted text' test
+-eu export readonly test ${HOME} --verbose
+		/usr/bin x=1 echo "$@" grep "$1" sed readonly cd
+	'quoted text' $(pwd) ${HOME} /usr/bin
+		readonly grep ${HOME} "$@" "$1" export local
+&& "$1" printf ${HOME} readonly
+awk 2>/dev/null then && ${HOME}
+	test && cd printf ${HOME} | test 2>/dev/null test
+then local ${HOME} 'quoted text'
+	printf export export done echo 'quoted text' grep
+	printf -eu ${HOME} done x=1 --verbose ${HOME} local then ${HOME} then 'quoted text'
+	/usr/bin 2>/dev/null 2>/dev/null x=1
+		-eu 2>/dev/null -eu done "$@" local $(pwd) printf --verbose local
+	sed --verbose x=1 'quoted text' /usr/bin | export "$@" sed $(pwd)
+	cd local cd test grep "$1" awk x=1 $(pwd)
+'quoted text' "$1" "$1" | test awk 2>/dev/null -eu -eu 2>/dev/null
+'quoted text' x=1 x=1 | grep "$1" export | 2>/dev/null
+		${HOME} test echo 'quoted text' local $(pwd) cd test cd then then x=1 grep "$@"
+done -eu done $(pwd) export cd done awk
+	done "$1" sed local x=1 printf grep local echo done -eu -eu printf echo
+"$@" | x=1 /usr/bin | grep && $(pwd)
+	grep readonly sed local "$@" grep local printf awk done then
+| | ${HOME} --verbose ${HOME} cd --verbose printf "$1" -eu $(pwd) ${HOME}
+	cd awk done && echo done 2>/dev/null
+export && -eu 2>/dev/null && echo x=1 "$@" then "$@"
+cd | && awk export -eu then sed 2>/dev/null
+	"$1" -eu readonly grep 2>/dev/null -eu readonly $(pwd)
+readonly -eu | "$@" --verbose awk $(pwd)
+&& readonly export && /usr/bin $(pwd)
+grep done echo "$1" "$1" readonly 2>/dev/null echo -eu printf
+	local done done readonly $(pwd) cd awk then $(pwd) | 'quoted text' -eu
+		then sed echo 2>/dev/null /usr/bin /usr/bin local | export
+&& --verbose done cd && awk /usr/bin awk
+	&& $(pwd) echo --verbose "$1" && printf -eu /usr/bin sed then export
+	cd | grep $(pwd) && local test 2>/dev/null
+		x=1 awk 2>/dev/null done ${HOME} echo $(pwd)
+export $(pwd) /usr/bin -eu --verbose cd test sed readonly
+	test awk "$1" echo && export ${HOME} then
+"$1" done sed echo 'quoted text' local "$1" local echo cd sed -eu done /usr/bin
+/usr/bin local | && "$@" /usr/bin && grep --verbose export sed sed printf
+2>/dev/null printf local
+grep test x=1 -eu -eu cd done export grep readonly done
+		--verbose printf echo
+-eu --verbose echo "$@" $(pwd)
+		readonly awk cd && ${HOME} /usr/bin
+		$(pwd) awk local 'quoted text' grep then
+		&& grep $(pwd) && local sed 'quoted text' cd 2>/dev/null
+	readonly 'quoted text' | $(pwd) grep printf /usr/bin awk ${HOME} ${HOME}
+		echo sed cd ${HOME} cd $(pwd) cd grep ${HOME} 'quoted text' /usr/bin local
+	$(pwd) | sed printf cd sed
+		done sed readonly --verbose printf sed done 2>/dev/null
+sed x=1 ${HOME} local cd "$@"
+	echo sed cd x=1 test 'quoted text' readonly echo awk | sed grep readonly | local
+grep -eu 'quoted text' --verbose export x=1 /usr/bin && grep printf "$@"
+	sed 'quoted text' --verbose /usr/bin ${HOME} /usr/bin
+	${HOME} -eu | readonly "$@" && &&
+$(pwd) 2>/dev/null x=1 echo readonly
+${HOME} local printf local local cd cd ${HOME}
+"$@" test -eu x=1 "$1" done done "$@" done echo local $(pwd) x=1
+		&& --verbose export "$@" cd --verbose done "$1" export printf
+	sed && echo -eu then ${HOME} test --verbose /usr/bin
+	-eu readonly $(pwd) echo grep export sed echo /usr/bin awk | awk "$@" cd -eu printf
+	'quoted text' /usr/bin test local ${HOME} sed then done x=1 echo $(pwd)
+	cd -eu test grep sed
+	printf x=1 "$@" printf 2>/dev/null readonly $(pwd) sed printf test x=1 'quoted text'
+&& echo grep local test && grep then $(pwd) 2>/dev/null grep "$1" grep
+		&& -eu local /usr/bin --verbose
+x=1 ${HOME} done echo readonly grep /usr/bin | readonly test 'quoted text'
+cd echo readonly && "$1" local cd
+${HOME} printf /usr/bin test sed test sed ${HOME}
+	x=1 "$1" 'quoted text' grep printf awk awk readonly readonly "$1" echo -eu
+sed 2>/dev/null export --verbose cd --verbose export
+		--verbose sed "$1" && done sed "$1" grep awk printf
+local -eu export -eu done sed $(pwd) awk "$1" --verbose x=1 export ${HOME} -eu
+| && readonly sed printf readonly export $(pwd) 'quoted text'
+		$(pwd) printf then readonly echo 'quoted text'
+		${HOME} | then ${HOME} | $(pwd) sed ${HOME}
+	printf printf | ${HOME} 2>/dev/null done
+		"$1" local export "$1" 2>/dev/null grep | "$@" /usr/bin echo --verbose
+		sed $(pwd) printf "$1" 'quoted text' cd then | && export printf
+		sed done local 'quoted text'
+	"$1" export 'quoted text' test 'quoted text' sed 'quoted text'
+	done 'quoted text' awk
+	-eu local printf awk export
+	cd awk done export sed x=1 x=1 done echo export ${HOME} 2>/dev/null
+/usr/bin $(pwd) cd cd cd done
+--verbose awk export --verbose readonly sed sed
+		2>/dev/null && --verbose printf test readonly | "$@" local "$1" sed grep &&
+	$(pwd) sed printf then then awk | awk x=1 cd sed /usr/bin 2>/dev/null
+$(pwd) sed cd | then && cd cd
+		echo done done echo export 'quoted text' | $(pwd) then grep export
+		-eu 'quoted text' local 'quoted text'
+"$1" awk readonly $(pwd) && awk 'quoted text' && x=1 grep printf
+	| done then test echo 'quoted text'
+/usr/bin local | x=1 grep "$@" 'quoted text'
+awk cd printf /usr/bin grep then 2>/dev/null grep --verbose 'quoted text'
+sed "$@" sed grep x=1 "$1" echo awk 'quoted text' cd | awk x=1
+		readonly then sed sed test "$@" cd echo "$1" /usr/bin readonly awk
+	test "$1" 'quoted text' | printf done /usr/bin local
+test export | 2>/dev/null cd done /usr/bin 2>/dev/null
+	${HOME} test local sed done ${HOME} 2>/dev/null $(pwd) grep /usr/bin test export
+	done $(pwd) --verbose x=1 printf "$1"
+cd sed echo x=1 cd then grep && --verbose sed echo echo
+	then test 2>/dev/null local --verbose test -eu "$@" | 2>/dev/null readonly
+		awk 2>/dev/null | 2>/dev/null echo grep cd local done test $(pwd) "$1"
+	echo sed cd done readonly ${HOME} test | "$@"
+cd 'quoted text' sed | echo --verbose x=1 readonly
+	&& then grep 2>/dev/null readonly printf 'quoted text'
+		done ${HOME} /usr/bin /usr/bin cd -eu cd
+		--verbose awk then 2>/dev/null && then readonly readonly echo
+	printf --verbose readonly then 2>/dev/null export --verbose
+		"$@" sed -eu "$@" /usr/bin test awk | local readonly echo $(pwd) ${HOME}
+	$(pwd) 2>/dev/null echo 2>/dev/null echo 2>/dev/null | export
+--verbose "$@" export x=1
+		2>/dev/null then export grep "$@" 2>/dev/null
+-eu -eu && local then test awk sed
+sed "$1" $(pwd) grep test x=1 export echo && export 2>/dev/null printf export
+		awk test && 2>/dev/null awk sed readonly grep done --verbose /usr/bin readonly
+		local printf sed /usr/bin then grep awk -eu printf readonly x=1 | printf
+		sed done done -eu readonly then ${HOME} x=1 echo x=1
+		readonly "$@" ${HOME} "$1" test /usr/bin local grep done readonly done grep
+	"$1" ${HOME} printf | "$@" sed /usr/bin
+		readonly cd -eu ${HOME} local done -eu done
+"$@" export x=1 readonly "$1" x=1 -eu | test grep done readonly 2>/dev/null
+	export /usr/bin readonly grep sed | test $(pwd) --verbose $(pwd) sed -eu test
+		printf ${HOME} done done |
+		--verbose export -eu echo && "$@" $(pwd) export $(pwd)
+echo /usr/bin --verbose then test
+		test /usr/bin done echo done x=1 echo x=1 ${HOME} export /usr/bin readonly
+	-eu awk | sed && cd readonly 'quoted text' cd /usr/bin export /usr/bin -eu
+		test | /usr/bin printf | sed "$@"
+2>/dev/null export "$1" local then && "$1" cd 2>/dev/null awk x=1 printf $(pwd)
+	printf /usr/bin grep | x=1 /usr/bin grep
+	grep x=1 export --verbose local -eu $(pwd) grep 'quoted text'
+		then readonly sed ${HOME} && local printf -eu
+	| test x=1 -eu awk sed test done "$@" x=1 /usr/bin then cd /usr/bin sed local x=1
+	"$1" --verbose sed "$1"
+	export "$@" export readonly 2>/dev/null 2>/dev/null &&
+-eu "$@" "$@" done export done | 'quoted text'
+-eu awk | && "$@" && && then $(pwd) export then test | cd
+		| "$1" readonly && "$@"
+		awk echo awk 'quoted text' sed then --verbose then x=1 "$@"
+		'quoted text' test grep 2>/dev/null
+	test printf "$@" test readonly echo cd readonly printf "$1" sed echo --verbose
+	local $(pwd) "$@" local awk 2>/dev/null ${HOME} $(pwd)
+	done $(pwd) x=1 "$@" ${HOME} grep readonly 2>/dev/null 2>/dev/null "$@" 'quoted text'
+		| sed -eu "$1" --verbose $(pwd)
+	sed --verbose awk $(pwd) readonly "$@" sed
+	'quoted text' --verbose "$@" local "$1" x=1 && done /usr/bin
+done /usr/bin 'quoted text' done awk echo awk && | /usr/bin | x=1 'quoted text'
+	$(pwd) test ${HOME} done && $(pwd) 'quoted text' readonly && 2>/dev/null ${HOME}
+	/usr/bin then echo then cd grep && "$@" "$1" printf
+	echo 'quoted text' export echo | local x=1 && done $(pwd) -eu
+	${HOME} && | "$@" test ${HOME} $(pwd) done test "$@"
+		test $(pwd) awk test /usr/bin export 'quoted text' ${HOME} readonly cd --verbose
+	'quoted text' sed && local
+-eu cd then ${HOME} echo grep "$1"
+		"$@" echo "$@" printf | "$@" echo --verbose export
+-eu export /usr/bin export "$1" awk cd --verbose
+		sed && x=1 sed printf echo /usr/bin 'quoted text' $(pwd)
+	/usr/bin echo --verbose awk local
+	local echo export x=1 awk &&
+"$@" printf "$@" $(pwd) local 'quoted text' "$@" awk sed local then
+	'quoted text' -eu | echo grep printf /usr/bin export "$@" | cd &&
+	$(pwd) then then cd cd x=1 'quoted text'
+readonly 2>/dev/null printf | cd local test then
+-eu printf ${HOME} | sed $(pwd) $(pwd) export 2>/dev/null grep sed "$@" "$1"
+local local $(pwd) cd sed readonly "$@" awk ${HOME} "$1" x=1 "$1" -eu /usr/bin
+"$@" printf local 2>/dev/null "$1" awk ${HOME} /usr/bin "$@" "$1"
+		printf --verbose sed && done sed sed $(pwd) export /usr/bin --verbose ${HOME}
+		--verbose x=1 done awk 'quoted text' sed /usr/bin "$1" -eu local --verbose
+awk | printf printf local $(pwd) -eu
+$(pwd) sed local grep /usr/bin grep x=1 local && &&
+grep awk export echo done $(pwd) "$@" awk export 'quoted text'
+	test x=1 export && grep 2>/dev/null
+		printf sed readonly awk test x=1 done ${HOME} then
+	| x=1 && $(pwd) printf grep | && readonly 2>/dev/null
+| cd local sed $(pwd) then
+		printf grep printf --verbose -eu then "$1" sed cd 2>/dev/null
+sed readonly cd -eu awk test 'quoted text' --verbose then
+	readonly "$@" $(pwd) 'quoted text' cd test grep cd | --verbose
+		/usr/bin -eu sed && ${HOME} printf $(pwd) then test
+		${HOME} echo 'quoted text' printf x=1
+		"$1" 2>/dev/null x=1 /usr/bin printf /usr/bin test
+		echo | printf --verbose
+sed 2>/dev/null /usr/bin export -eu "$@" --verbose ${HOME} $(pwd)
+	/usr/bin local printf then ${HOME} 2>/dev/null
+	then grep echo 'quoted text' awk cd cd printf
+'quoted text' x=1 x=1 2>/dev/null "$1" | grep echo --verbose | awk export "$@"
+"$@" cd | x=1 grep x=1 ${HOME} 2>/dev/null awk &&
+	awk $(pwd) | printf x=1 "$@" /usr/bin then
+$(pwd) echo 2>/dev/null "$1" 'quoted text' -eu | | readonly local
+	awk | echo ${HOME} && 'quoted text' printf 'quoted text' sed local
+		"$1" $(pwd) x=1 "$1" -eu --verbose 2>/dev/null
+$(pwd) printf 2>/dev/null readonly -eu awk grep then /usr/bin awk then 'quoted text'
+	awk local sed --verbose && "$@" export ${HOME} grep echo awk
+		/usr/bin "$1" echo done export cd /usr/bin | test
+test "$@" "$@" /usr/bin -eu $(pwd) 'quoted text'
+		"$1" --verbose grep "$1" then | export echo cd readonly printf
+	export sed -eu echo printf --verbose done
+		echo local awk /usr/bin | "$@" local $(pwd) | 2>/dev/null "$@"
+	-eu "$@" | readonly x=1 'quoted text'
+		'quoted text' $(pwd) $(pwd) "$1" sed grep then test then 2>/dev/null
+done 2>/dev/null grep | "$1"
+test done $(pwd) $(pwd) grep ${HOME} printf
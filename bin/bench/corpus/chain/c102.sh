@@ -0,0 +1,2001 @@
+x=1 sed printf ${HOME} $(pwd) --verbose ${HOME} awk grep /usr/bin -eu cd &&
+		/usr/bin --verbose -eu echo cd ${HOME} test "$1" ${HOME}
+test ${HOME} printf grep grep 2>/dev/null awk awk | "$@" 2>/dev/null
+printf done ${HOME} && 'quoted text'
+		echo echo export cd then sed | 2>/dev/null --verbose $(pwd) 'quoted text' printf
+printf test printf printf -eu grep /usr/bin
+	local /usr/bin local readonly 'quoted text'
+		awk --verbose cd && cd $(pwd) local /usr/bin
+		export test printf readonly test
+	echo printf ${HOME} sed ${HOME} test
+	-eu 2>/dev/null 'quoted text' grep grep "$1" local done 'quoted text'
+		readonly --verbose 'quoted text' echo ${HOME} "$@" echo awk x=1 test
+export readonly ${HOME} local &&
+| $(pwd) readonly awk && -eu awk sed --verbose printf export echo
+		export | test --verbose local && && ${HOME} && | "$1" && "$1" ${HOME}
+	2>/dev/null done "$1" printf then | $(pwd) printf awk "$1"
+cd /usr/bin export readonly /usr/bin local export readonly ${HOME} x=1 $(pwd)
+		then awk test | test test echo cd "$1"
+printf cd 2>/dev/null echo echo
+		${HOME} cd awk -eu readonly readonly awk 2>/dev/null
+	export | -eu then -eu "$@"
+	grep | 'quoted text' awk then &&
+"$1" && "$1" awk local export "$@" -eu
+	sed sed test sed then grep echo | then ${HOME} && readonly grep --verbose
+grep done 'quoted text' awk 'quoted text' cd sed /usr/bin printf
+	export export 2>/dev/null grep export sed
+		printf "$1" readonly | $(pwd) export local x=1 then sed done 'quoted text' 'quoted text'
+		| test | | then done local test export /usr/bin export "$@" --verbose
+		grep readonly "$@" then local then && "$@" 'quoted text'
+	$(pwd) test 2>/dev/null $(pwd)
+		done ${HOME} readonly grep local "$1" $(pwd) && /usr/bin test
+echo $(pwd) ${HOME} readonly --verbose done "$1" $(pwd) echo readonly printf
+&& && 'quoted text' | x=1 "$1" grep grep
+--verbose test && awk then sed test -eu && then && awk 'quoted text'
+		export --verbose 2>/dev/null "$@" printf sed local ${HOME} local
+		/usr/bin export readonly 2>/dev/null export cd 2>/dev/null
+		sed cd cd /usr/bin "$@"
+		&& done -eu --verbose "$@" $(pwd) x=1 test "$1" local 'quoted text'
+then "$1" test $(pwd) export awk echo x=1 sed 'quoted text'
+		sed "$@" "$1" done local $(pwd) --verbose
+/usr/bin $(pwd) echo 2>/dev/null
+		printf --verbose done echo printf export export awk
+		test ${HOME} awk then --verbose done done cd echo sed "$@" then -eu | /usr/bin
+		grep -eu 2>/dev/null local sed sed "$1"
+	test 'quoted text' --verbose
+	$(pwd) "$@" local 2>/dev/null -eu test export $(pwd) --verbose then "$@" && cd
+		export sed awk "$@" then readonly x=1 $(pwd) grep
+	"$@" "$1" readonly --verbose ${HOME} done "$1" 2>/dev/null printf export
+cd 'quoted text' test /usr/bin 2>/dev/null "$1" then awk awk echo
+		grep cd done done 'quoted text'
+	local readonly | local sed local readonly sed awk
+	sed awk "$@" echo readonly done x=1 x=1 cd x=1 printf grep "$1"
+	&& echo ${HOME} "$@" then test sed ${HOME}
+		'quoted text' "$1" test echo sed "$@" export grep
+		'quoted text' local x=1 readonly 'quoted text' $(pwd) ${HOME} readonly
+$(pwd) cd ${HOME} -eu 'quoted text' test cd sed 2>/dev/null
+		export readonly --verbose local sed | x=1 /usr/bin $(pwd) grep grep "$1" "$1"
+then -eu then then 'quoted text' done awk test done | 'quoted text'
+		x=1 2>/dev/null ${HOME} | done && printf "$@" "$@"
+		export export export sed "$@" done echo export -eu 'quoted text' /usr/bin
+		then 2>/dev/null "$1" && 2>/dev/null done "$@" "$@" cd --verbose $(pwd) awk
+		cd ${HOME} | 'quoted text' -eu | && export
+	then | echo awk ${HOME} 'quoted text'
+	grep echo readonly printf grep printf test "$@" && -eu grep "$1" x=1 && 2>/dev/null
+-eu echo /usr/bin ${HOME}
+	cd echo -eu "$1" && echo printf /usr/bin
+	echo printf | 'quoted text' local $(pwd)
+grep x=1 2>/dev/null $(pwd) 2>/dev/null -eu done && ${HOME} echo
+/usr/bin ${HOME} "$1" ${HOME} awk sed echo sed ${HOME} 'quoted text'
+	&& /usr/bin export done done && /usr/bin | "$@" done 'quoted text' test
+	grep sed then 2>/dev/null /usr/bin grep "$@" x=1 "$@" -eu
+	readonly local 2>/dev/null
+		printf x=1 export local
+		local /usr/bin "$@" export | x=1 local test
+		&& printf test printf 2>/dev/null readonly x=1 && echo printf 2>/dev/null
+		grep sed done awk readonly ${HOME} sed test printf
+		&& awk 'quoted text' readonly done test "$1" "$1" "$1" --verbose
+-eu cd grep local -eu /usr/bin grep printf sed && | local 2>/dev/null
+		grep x=1 test "$1" local then /usr/bin "$@" | readonly then /usr/bin cd then
+test | x=1 sed 'quoted text' echo $(pwd) --verbose
+sed 2>/dev/null | | /usr/bin | test awk 2>/dev/null echo then test /usr/bin
+		done sed sed sed 'quoted text' then "$1" /usr/bin printf printf echo test 'quoted text'
+2>/dev/null -eu -eu local
+		readonly 2>/dev/null readonly 'quoted text' 'quoted text' awk --verbose
+		${HOME} sed test grep readonly --verbose --verbose
+		${HOME} -eu $(pwd) echo x=1 && && 'quoted text' export export echo cd | echo
+		--verbose -eu -eu echo readonly 'quoted text'
+	/usr/bin | && "$@" --verbose 'quoted text' export 'quoted text'
+		${HOME} --verbose then x=1 sed | 2>/dev/null
+	-eu "$1" local export then $(pwd) export done
+/usr/bin x=1 grep "$1" grep "$1" test echo ${HOME} /usr/bin --verbose
+	${HOME} "$@" 'quoted text' sed
+$(pwd) x=1 && && x=1 grep ${HOME} --verbose readonly $(pwd) cd /usr/bin done x=1
+'quoted text' /usr/bin "$1" -eu "$@" 'quoted text' --verbose cd && echo
+/usr/bin /usr/bin ${HOME} local printf then local "$1" /usr/bin test
+	2>/dev/null 2>/dev/null test ${HOME} -eu export done x=1 awk x=1 "$@" "$1"
+then test ${HOME} awk $(pwd) then awk ${HOME} x=1 'quoted text' export
+	x=1 'quoted text' ${HOME} printf 'quoted text' && ${HOME}
+	printf $(pwd) cd local -eu cd grep 2>/dev/null
+echo awk "$1" 2>/dev/null printf -eu "$1" ${HOME} grep | $(pwd) &&
+	echo --verbose done x=1 grep awk
+local -eu cd readonly "$@"
+	then --verbose readonly sed export $(pwd) done -eu done --verbose cd grep
+	x=1 ${HOME} 2>/dev/null --verbose export local -eu ${HOME} readonly
+	printf test $(pwd) export 'quoted text' cd x=1
+		done -eu export then done done ${HOME} 'quoted text' then x=1 test $(pwd) "$@"
+	export && test ${HOME} ${HOME} -eu awk local
+	-eu -eu done then cd printf | --verbose export sed local grep test 2>/dev/null
+then awk x=1 "$1" "$@"
+		grep export ${HOME} /usr/bin local -eu cd
+	-eu grep /usr/bin done export awk 2>/dev/null x=1 test 'quoted text'
+then && x=1 done grep printf
+	printf x=1 awk local && done done ${HOME} ${HOME} "$1"
+local awk "$1" printf local 'quoted text' test
+test ${HOME} printf done done export
+export then test export "$@" x=1 x=1 $(pwd) 'quoted text'
+	'quoted text' export -eu x=1
+done x=1 -eu awk 2>/dev/null $(pwd) && sed && "$1" --verbose
+		sed 2>/dev/null /usr/bin local
+		"$1" echo sed ${HOME} "$@" local
+	printf printf 2>/dev/null "$1" local && &&
+| "$@" then "$@" cd local export "$@" | then cd sed printf
+	"$@" cd done done awk awk then 'quoted text'
+		x=1 test cd grep x=1 echo local "$1" cd export then
+	$(pwd) /usr/bin export 2>/dev/null readonly test "$1" done readonly
+		&& export $(pwd) /usr/bin x=1 awk -eu $(pwd) -eu grep grep
+		readonly && local /usr/bin --verbose done 2>/dev/null ${HOME} && 2>/dev/null
+	grep 'quoted text' test
+		readonly local printf && echo $(pwd) grep echo "$@" 2>/dev/null
+	--verbose --verbose printf $(pwd) test "$@" "$@" /usr/bin x=1 export done awk
+	${HOME} cd -eu printf echo | $(pwd)
+	--verbose readonly grep $(pwd) awk --verbose
+readonly local readonly grep echo | ${HOME}
+	x=1 && && | grep echo && grep "$@" cd /usr/bin 2>/dev/null x=1 cd done "$1" then
+cd 'quoted text' /usr/bin "$@" then && sed --verbose sed cd ${HOME} --verbose then
+	echo "$1" export local -eu $(pwd) 'quoted text' echo --verbose $(pwd) "$@" "$1"
+&& then | cd awk x=1 printf 'quoted text'
+	$(pwd) | then 2>/dev/null cd readonly
+readonly then -eu ${HOME} test grep 'quoted text'
+	"$@" $(pwd) awk awk then sed readonly printf test then
+	"$1" --verbose -eu "$@" grep && /usr/bin && x=1 test
+		done readonly readonly ${HOME} ${HOME} printf test echo
+/usr/bin sed awk 2>/dev/null awk export then ${HOME}
+/usr/bin x=1 awk test x=1 readonly readonly --verbose "$@" grep local
+	$(pwd) local then done 'quoted text' done readonly
+		readonly --verbose awk grep 2>/dev/null printf local local "$1"
+x=1 export $(pwd) "$1" && | "$1" awk /usr/bin -eu && printf
+done | "$@" test printf awk done local --verbose | x=1 "$@" local local "$1"
+"$1" $(pwd) printf test grep "$@" printf export x=1 test -eu
+$(pwd) /usr/bin ${HOME} 2>/dev/null sed local echo | sed
+	readonly cd awk echo "$@" 'quoted text' awk grep 'quoted text' sed "$@"
+sed cd "$1" grep "$@" "$1" ${HOME} "$1" echo done
+		awk test readonly "$1" echo "$1" $(pwd) test -eu "$@" /usr/bin
+	awk echo -eu 2>/dev/null 'quoted text' $(pwd)
+	$(pwd) && "$1" cd ${HOME} -eu done printf done sed ${HOME} 2>/dev/null
+	then 'quoted text' $(pwd) grep --verbose && -eu x=1 'quoted text'
+	&& test export && done /usr/bin printf awk cd $(pwd) x=1 | done
+		/usr/bin local "$@" export export "$@" then
+	&& grep done "$@" local printf
+	sed ${HOME} readonly 2>/dev/null -eu /usr/bin /usr/bin
+x=1 readonly echo -eu
+		&& 2>/dev/null 'quoted text' test 'quoted text'
+		"$@" printf sed grep printf local test $(pwd) 2>/dev/null test
+		export echo -eu cd printf x=1
+		cd done awk $(pwd) done export 'quoted text'
+	awk "$1" x=1 $(pwd) sed /usr/bin "$@" /usr/bin test awk readonly
+		"$@" --verbose grep -eu export "$1" awk x=1 'quoted text' test -eu --verbose
+	awk x=1 cd x=1 local printf
+-eu then local 'quoted text'
+	2>/dev/null /usr/bin done x=1 $(pwd)
+	printf grep then grep 2>/dev/null ${HOME} echo echo
+	$(pwd) && done sed 'quoted text' x=1 cd grep echo && export 2>/dev/null
+printf "$@" --verbose done "$@"
+	"$1" local 2>/dev/null awk --verbose
+		local ${HOME} printf -eu awk done sed then "$1" test echo && echo printf /usr/bin
+		cd sed then x=1 $(pwd) echo | readonly echo sed echo /usr/bin
+'quoted text' test readonly x=1 2>/dev/null
+	readonly awk && && export done then
+grep echo /usr/bin cd -eu test 2>/dev/null | local 2>/dev/null done test readonly
+	-eu | then then | printf
+		2>/dev/null "$1" printf printf readonly | echo local |
+		test done -eu then readonly "$@"
+		| --verbose | test local $(pwd) done --verbose | ${HOME} ${HOME}
+	'quoted text' && awk then
+	local "$1" -eu -eu ${HOME} grep 'quoted text' ${HOME} 'quoted text'
+2>/dev/null $(pwd) | echo
+	export "$1" grep /usr/bin ${HOME} cd -eu awk grep --verbose awk | sed
+		/usr/bin done sed "$@" -eu && "$1"
+	test && cd x=1 export test "$@" sed "$1" 2>/dev/null test
+		${HOME} sed /usr/bin -eu local test grep 'quoted text'
+	x=1 "$1" local ${HOME} cd readonly sed 'quoted text' cd /usr/bin ${HOME}
+		done readonly sed x=1 2>/dev/null echo printf
+		&& "$1" ${HOME} "$1" sed export -eu cd local then done awk | $(pwd) grep export
+		x=1 --verbose then cd $(pwd) ${HOME}
+| "$@" grep then printf grep
+		readonly grep /usr/bin 'quoted text' test -eu /usr/bin -eu 2>/dev/null
+	"$@" echo grep echo echo cd -eu $(pwd) && "$@" | grep cd awk --verbose $(pwd)
+		'quoted text' grep "$@" test readonly
+x=1 grep ${HOME} /usr/bin
+		test "$@" x=1 echo printf | $(pwd) && printf readonly -eu readonly
+	| grep printf "$@" printf --verbose "$@"
+		| cd awk test sed -eu readonly sed && ${HOME} "$@" local 2>/dev/null
+		"$1" awk export 'quoted text' | then
+x=1 readonly -eu "$1" x=1 test /usr/bin local 2>/dev/null test
+		x=1 readonly ${HOME} x=1 export "$@" && printf 'quoted text'
+		awk printf local done 2>/dev/null
+${HOME} grep /usr/bin ${HOME} printf done readonly $(pwd) readonly
+		--verbose done /usr/bin 'quoted text'
+	'quoted text' awk awk /usr/bin ${HOME} "$1"
+printf sed readonly /usr/bin
+		echo $(pwd) x=1 $(pwd) local "$1" done --verbose
+cd $(pwd) readonly /usr/bin export ${HOME}
+	test | export | done x=1 sed ${HOME} $(pwd) grep sed ${HOME} "$1"
+		2>/dev/null export then grep test local "$@" local
+		test "$1" --verbose local done "$@" /usr/bin echo ${HOME} export export
+		/usr/bin && 'quoted text' -eu
+local awk "$1" local && --verbose x=1 local
+	$(pwd) test "$1" sed done echo done done /usr/bin readonly sed
+		export ${HOME} "$@" ${HOME} --verbose
+	printf done readonly echo x=1 test "$@"
+	cd then /usr/bin echo "$@" $(pwd) awk local 'quoted text'
+x=1 2>/dev/null local 'quoted text' then
+	export echo local /usr/bin test echo 2>/dev/null grep printf
+&& then readonly grep x=1 ${HOME} /usr/bin ${HOME} echo 2>/dev/null export
+--verbose local readonly cd 2>/dev/null readonly local then grep $(pwd)
+	2>/dev/null test then 'quoted text' "$1" echo cd /usr/bin 2>/dev/null
+		readonly test test | grep "$@" ${HOME} readonly
+sed | /usr/bin "$1" awk && && /usr/bin awk 2>/dev/null
+	test cd printf grep then awk echo local /usr/bin grep done && $(pwd) x=1 --verbose
+${HOME} "$1" echo "$1" | test done awk printf $(pwd) echo
+		&& printf x=1 'quoted text' test done && -eu export --verbose
+		echo local sed then /usr/bin export "$@" "$@" -eu "$@" 2>/dev/null $(pwd)
+"$1" readonly "$@" -eu $(pwd) && 'quoted text'
+	${HOME} printf printf local export awk /usr/bin echo /usr/bin -eu then 2>/dev/null
+		local done cd export 2>/dev/null test ${HOME} "$1" awk local cd
+		$(pwd) $(pwd) done printf echo /usr/bin $(pwd) x=1 cd awk --verbose "$1" readonly
+	/usr/bin sed local then "$1" grep 2>/dev/null && x=1 'quoted text' readonly
+	local && awk /usr/bin awk 'quoted text' local done awk grep | awk export
+		"$@" printf readonly -eu grep awk done $(pwd) then "$@" && -eu echo
+"$1" awk local export test
+		printf export | done printf echo sed /usr/bin
+		grep /usr/bin awk test --verbose sed 'quoted text' ${HOME} readonly export
+		local x=1 | local && export ${HOME} grep done readonly "$@" awk $(pwd) test
+	"$@" "$1" readonly ${HOME} grep x=1 sed cd x=1
+	$(pwd) ${HOME} 2>/dev/null "$1" -eu && /usr/bin --verbose
+$(pwd) export -eu -eu cd export ${HOME}
+${HOME} | --verbose /usr/bin
+		"$1" "$@" echo && awk awk printf x=1 -eu echo readonly test echo awk test | export
+		cd && 2>/dev/null ${HOME} "$@" readonly 'quoted text'
+		local awk then x=1 2>/dev/null grep $(pwd) awk --verbose
+		/usr/bin cd then 2>/dev/null readonly x=1 export /usr/bin then | ${HOME}
+| grep export grep awk -eu test awk readonly cd printf readonly
+	local | | 'quoted text' local
+		test $(pwd) -eu -eu x=1 'quoted text' "$1" done /usr/bin -eu test &&
+		&& --verbose echo "$@" x=1 "$1"
+	x=1 readonly $(pwd) cd sed
+		"$1" --verbose test sed "$1" local cd echo
+		local -eu readonly awk && readonly /usr/bin local $(pwd)
+done local "$1" grep -eu done printf | --verbose --verbose sed ${HOME} /usr/bin
+--verbose then -eu "$@" sed echo
+	-eu grep test awk sed export
+	awk x=1 local done ${HOME} "$1" x=1 sed readonly awk
+awk test "$1" local /usr/bin
+	| ${HOME} test test -eu $(pwd) x=1 $(pwd)
+		awk awk echo printf sed printf
+		cd && cd awk then cd --verbose
+	-eu -eu && "$1" done /usr/bin ${HOME} ${HOME} ${HOME} export x=1 "$1" -eu awk ${HOME}
+"$1" $(pwd) x=1 x=1 | x=1 "$@" ${HOME}
+export | local 2>/dev/null printf
+		export readonly | && printf export x=1 /usr/bin done then
+	--verbose test x=1 --verbose
+		"$1" 2>/dev/null -eu "$@" echo export readonly awk
+	done printf $(pwd) 'quoted text' -eu --verbose "$@" export $(pwd)
+	awk "$@" grep | 2>/dev/null sed done -eu /usr/bin
+		&& -eu export x=1 export "$@" && sed "$1" /usr/bin grep sed test
+"$1" export then --verbose "$@" $(pwd) && $(pwd) readonly && awk
+cd grep /usr/bin ${HOME} export local /usr/bin test
+	awk local ${HOME} 2>/dev/null x=1 local test | ${HOME} readonly done export
+		done ${HOME} | | x=1 sed ${HOME} export test x=1 --verbose
+"$1" $(pwd) readonly then sed then sed sed export awk ${HOME} done
+		"$1" /usr/bin && done awk && ${HOME} | awk ${HOME} echo "$1" x=1
+		test && readonly readonly awk /usr/bin && awk --verbose done
+--verbose readonly printf 2>/dev/null sed --verbose
+"$@" grep 'quoted text' 2>/dev/null
+	--verbose -eu echo /usr/bin -eu -eu ${HOME}
+		printf export 2>/dev/null "$@" $(pwd) sed printf local local export ${HOME} grep
+	test x=1 2>/dev/null sed ${HOME} sed grep test readonly
+		$(pwd) echo 2>/dev/null -eu /usr/bin | echo grep x=1 then | x=1
+		"$1" test --verbose grep 'quoted text' echo "$@"
+"$@" /usr/bin echo 'quoted text' done
+	test -eu | readonly done
+"$@" local | test 2>/dev/null test done --verbose printf ${HOME} $(pwd) grep
+"$@" "$@" /usr/bin printf echo grep printf "$@" export
+"$1" && then test awk echo $(pwd) echo readonly readonly
+test local sed local sed x=1 awk echo x=1 test printf
+		awk printf x=1 export echo "$1" readonly sed local
+cd --verbose awk test x=1 --verbose
+	cd 2>/dev/null | "$1" cd "$1" && | $(pwd)
+	| grep printf ${HOME} --verbose grep 'quoted text'
+sed | ${HOME} readonly "$1" | "$1" --verbose | export cd -eu sed local ${HOME}
+	${HOME} && --verbose cd 2>/dev/null "$1" test x=1 "$1"
+		&& "$@" awk -eu 2>/dev/null
+		${HOME} grep grep | then --verbose awk
+	done 2>/dev/null ${HOME} /usr/bin /usr/bin printf awk
+	$(pwd) cd then readonly export cd
+	export printf grep --verbose done 2>/dev/null
+	'quoted text' done cd export 2>/dev/null "$@" $(pwd) printf echo
+	readonly /usr/bin sed "$@" awk
+		${HOME} && --verbose printf -eu readonly 2>/dev/null
+		done done ${HOME} ${HOME} then grep cd -eu 'quoted text'
+	echo readonly awk echo then "$@" x=1 'quoted text' test ${HOME}
+	&& sed echo /usr/bin x=1 -eu local --verbose cd printf 2>/dev/null
+		grep "$@" local 'quoted text' -eu grep 2>/dev/null "$@" "$@" /usr/bin then
+		printf && 2>/dev/null
+	-eu | "$1" done done x=1 --verbose --verbose cd && -eu readonly
+&& /usr/bin --verbose printf
+		readonly ${HOME} && awk test x=1 echo x=1
+		"$@" ${HOME} done local $(pwd) 2>/dev/null "$@" test
+	readonly awk ${HOME} awk && echo export "$@" grep echo
+		sed && echo done 'quoted text' done export 2>/dev/null x=1 cd done /usr/bin
+then local /usr/bin local awk grep 'quoted text' done /usr/bin
+	grep readonly /usr/bin | sed test local printf /usr/bin cd &&
+	sed | /usr/bin test && "$@" local -eu awk then echo
+&& then 2>/dev/null "$1" x=1 'quoted text' 'quoted text'
+	'quoted text' grep grep local local 2>/dev/null /usr/bin
+2>/dev/null -eu then -eu 2>/dev/null
+		'quoted text' x=1 && "$@" -eu | echo sed grep echo awk --verbose
+		readonly local then ${HOME} cd "$@" ${HOME}
+	${HOME} --verbose cd x=1 /usr/bin 'quoted text' x=1 /usr/bin grep
+		local "$1" $(pwd) x=1 export "$1" echo 2>/dev/null | echo grep then 2>/dev/null
+test awk x=1 && export test -eu /usr/bin
+/usr/bin grep readonly
+		${HOME} cd ${HOME} sed 2>/dev/null
+	readonly then 'quoted text' grep done grep
+		2>/dev/null then sed test local $(pwd) $(pwd) $(pwd)
+		'quoted text' readonly
+grep 'quoted text' awk "$1" 2>/dev/null then awk | ${HOME}
+	local then ${HOME} 'quoted text' readonly
+2>/dev/null ${HOME} test test local local export --verbose 2>/dev/null
+	local echo test awk --verbose 'quoted text' -eu /usr/bin "$@" && then cd done grep
+	sed $(pwd) awk echo echo
+	| 2>/dev/null x=1 sed | then cd done
+sed -eu cd $(pwd) grep
+	2>/dev/null echo && x=1 -eu then
+grep awk 'quoted text' -eu awk | |
+echo then | "$1" /usr/bin cd -eu $(pwd) 2>/dev/null
+	x=1 cd /usr/bin --verbose done --verbose awk /usr/bin
+	$(pwd) -eu cd --verbose && cd test test --verbose x=1 test awk x=1 x=1 done
+	awk sed "$@" ${HOME} --verbose -eu | cd ${HOME} $(pwd)
+		x=1 --verbose $(pwd) done "$1" cd ${HOME} ${HOME} ${HOME} done test x=1 awk ${HOME}
+	echo export export done then export awk 2>/dev/null && | "$@" then
+		&& sed grep sed echo cd export "$1" export readonly /usr/bin -eu "$@" sed 2>/dev/null
+sed && x=1 echo export sed awk "$@"
+cd && "$@" ${HOME} 2>/dev/null && cd printf cd /usr/bin && --verbose
+		&& && 2>/dev/null | then -eu awk 'quoted text' "$@" cd x=1 readonly
+		echo local test --verbose then then "$1" ${HOME} "$@"
+$(pwd) 'quoted text' readonly 2>/dev/null
+then grep export "$1" then awk readonly $(pwd) echo export x=1
+	&& test /usr/bin readonly cd 'quoted text'
+"$1" -eu sed test $(pwd) 2>/dev/null
+2>/dev/null 'quoted text' "$1" readonly sed echo readonly
+-eu $(pwd) echo cd x=1 --verbose test sed sed ${HOME} x=1 test echo
+	test /usr/bin 'quoted text' sed test readonly && &&
+		"$1" 'quoted text' echo
+	"$@" cd printf | "$@" /usr/bin --verbose
+		sed ${HOME} x=1 export test 'quoted text' x=1 then $(pwd)
+	${HOME} /usr/bin readonly "$1" &&
+	${HOME} -eu x=1 readonly printf ${HOME} grep "$1"
+${HOME} 2>/dev/null cd /usr/bin
+		done readonly cd then echo test | awk test /usr/bin "$@" --verbose
+	sed "$1" awk $(pwd) | 'quoted text' awk done awk "$1" "$1" 2>/dev/null
+local x=1 sed local awk ${HOME}
+	&& -eu done "$@" "$1" grep && local export awk "$1"
+grep | 'quoted text' printf export
+	local sed && /usr/bin done done
+	awk /usr/bin done ${HOME} x=1
+"$@" $(pwd) 'quoted text' export
+	x=1 then grep 2>/dev/null --verbose /usr/bin local --verbose then x=1 echo
+test && | local x=1 then 'quoted text' x=1 cd
+	$(pwd) "$@" printf 2>/dev/null
+done readonly 2>/dev/null "$@" cd -eu echo then "$1" | export
+		| && "$@" awk ${HOME} printf sed 'quoted text' printf "$1" cd
+-eu awk readonly && local && | local awk
+	then 2>/dev/null ${HOME} -eu $(pwd)
+		${HOME} sed sed /usr/bin | "$@" &&
+		$(pwd) export echo export && printf $(pwd) $(pwd) test cd && &&
+	local 'quoted text' printf "$1" sed then grep "$1" echo cd | 'quoted text'
+		sed readonly | $(pwd) 'quoted text' export /usr/bin done echo readonly --verbose
+		done /usr/bin export test -eu local $(pwd) echo ${HOME} readonly x=1 $(pwd)
+		/usr/bin -eu awk | --verbose | | done /usr/bin 2>/dev/null
+		/usr/bin printf | && echo $(pwd)
+		done echo 2>/dev/null "$@" 2>/dev/null | printf grep
+	awk ${HOME} -eu sed done cd cd 'quoted text'
+	"$1" /usr/bin local "$1" awk $(pwd) echo printf $(pwd)
+		"$@" x=1 x=1 local test printf done
+"$@" $(pwd) && | cd 2>/dev/null echo sed "$1" sed export
+	printf 'quoted text' && x=1 local then export ${HOME} sed local sed
+printf local "$@" "$@" then "$@" $(pwd) done test export then 2>/dev/null
+		test -eu 2>/dev/null grep -eu test test echo local &&
+done x=1 2>/dev/null /usr/bin done awk grep 2>/dev/null then "$1"
+cd --verbose awk | -eu done 2>/dev/null ${HOME} $(pwd) |
+		then local ${HOME} 'quoted text' done /usr/bin local
+	printf then readonly cd -eu local
+	| grep --verbose local 2>/dev/null awk test
+	awk "$1" sed $(pwd) export
+		readonly $(pwd) | sed cd ${HOME} cd "$1" ${HOME} printf test "$1"
+		/usr/bin readonly echo
+	printf printf local 'quoted text' printf
+	&& local 'quoted text' "$1" "$1" grep -eu "$@"
+| | grep done awk export ${HOME} $(pwd) x=1 grep x=1 "$@" --verbose 'quoted text'
+	local readonly awk ${HOME} awk test | && echo then
+		then printf test /usr/bin awk local done 'quoted text'
+cd "$1" local | $(pwd) cd "$1" readonly cd 2>/dev/null && printf sed then grep
+		then done printf awk --verbose "$@"
+		$(pwd) $(pwd) --verbose echo readonly
+	&& 'quoted text' $(pwd) sed awk x=1 x=1 local x=1 done "$@" grep /usr/bin
+		export printf "$1" x=1 2>/dev/null x=1 test 'quoted text'
+		/usr/bin grep ${HOME} export awk "$@"
+	&& awk | "$@" "$@" 2>/dev/null
+	${HOME} local echo export cd /usr/bin
+&& /usr/bin --verbose && "$@" | /usr/bin 2>/dev/null --verbose
+		"$@" sed cd echo then "$1" "$1" done ${HOME} |
+		-eu awk ${HOME} done grep 2>/dev/null echo echo
+export done | /usr/bin cd sed
+	sed test --verbose && "$@" | awk && done -eu test --verbose
+	/usr/bin sed | 2>/dev/null printf cd sed cd | sed done then -eu -eu
+		"$1" local export done "$1" 'quoted text' test "$1" awk ${HOME} grep "$@"
+	printf x=1 grep ${HOME} --verbose done x=1
+	${HOME} 'quoted text' echo 'quoted text' local
+	${HOME} "$1" 2>/dev/null && 'quoted text' "$1" readonly
+x=1 x=1 done "$1" printf
+	grep then cd grep x=1 local && export ${HOME} then
+awk 2>/dev/null export && && --verbose
+		$(pwd) 2>/dev/null 'quoted text'
+		cd export "$@" done && | ${HOME} sed | 'quoted text'
+echo test $(pwd) test ${HOME} x=1 'quoted text' awk | local printf /usr/bin
+	-eu test -eu test done ${HOME} sed cd "$@" 2>/dev/null
+test local && readonly grep $(pwd) cd -eu x=1
+	done ${HOME} --verbose -eu /usr/bin
+		2>/dev/null && cd cd done && -eu test then
+		"$@" --verbose "$1" local x=1 awk 'quoted text' readonly $(pwd) /usr/bin export
+	sed grep 2>/dev/null 2>/dev/null ${HOME}
+	cd | cd awk --verbose "$@" readonly
+		readonly x=1 test test && then readonly "$@" ${HOME}
+x=1 'quoted text' done 'quoted text' echo $(pwd)
+	printf then /usr/bin && | readonly ${HOME} 'quoted text'
+	test readonly echo 2>/dev/null readonly -eu printf
+	x=1 "$1" sed 2>/dev/null && && -eu --verbose $(pwd) /usr/bin
+printf test $(pwd) done 2>/dev/null cd x=1 /usr/bin awk
+		$(pwd) echo 2>/dev/null local --verbose --verbose
+	local -eu --verbose -eu echo done done && $(pwd)
+	printf done local -eu x=1 $(pwd)
+	-eu x=1 done awk "$1" then x=1 && test && readonly grep --verbose
+	"$@" sed local cd 'quoted text' | 'quoted text' 'quoted text' 'quoted text'
+		readonly export ${HOME} --verbose awk "$1" readonly --verbose
+	--verbose | local cd -eu && then "$1"
+| 'quoted text' cd grep "$1" --verbose $(pwd) --verbose /usr/bin
+awk grep | awk && printf 2>/dev/null test local local export
+2>/dev/null printf ${HOME} $(pwd) cd sed x=1 | local sed /usr/bin
+| "$1" 'quoted text' readonly && && /usr/bin 'quoted text' --verbose 2>/dev/null
+grep 2>/dev/null export && sed "$1" x=1 | && --verbose
+	${HOME} ${HOME} 2>/dev/null echo "$1" $(pwd)
+		${HOME} awk --verbose /usr/bin "$@" ${HOME} -eu cd && then cd then
+		readonly readonly "$@" | sed readonly ${HOME} 'quoted text'
+		grep then sed cd "$@" --verbose grep /usr/bin done awk printf && && sed test
+	2>/dev/null then "$1" done sed done
+		readonly | then printf export readonly
+grep awk | export done --verbose "$1" "$@" && echo
+		$(pwd) echo ${HOME} echo grep && "$@" echo cd then local && 2>/dev/null
+		readonly sed "$@" echo /usr/bin ${HOME} printf sed "$@" 2>/dev/null
+		| cd && && && printf test --verbose 2>/dev/null test
+	/usr/bin 2>/dev/null echo x=1 x=1 local then ${HOME} done 'quoted text'
+	printf grep echo --verbose local readonly
+	echo "$1" echo 2>/dev/null test "$@"
+	export awk "$1" $(pwd) sed
+test sed cd export "$@" then local "$1" /usr/bin readonly readonly test -eu awk
+	2>/dev/null "$@" export "$@" "$@"
+grep ${HOME} then ${HOME} test echo test cd
+x=1 cd done export readonly sed cd readonly then | $(pwd) | 2>/dev/null
+		$(pwd) export export export cd done
+${HOME} | --verbose readonly
+		"$@" && $(pwd) | x=1 /usr/bin
+		-eu readonly | /usr/bin --verbose
+	awk echo then echo ${HOME} cd "$1" test sed cd export "$1"
+	x=1 grep && 'quoted text' --verbose
+2>/dev/null echo sed "$1" then then 'quoted text' $(pwd) awk -eu 'quoted text'
+2>/dev/null ${HOME} then readonly local printf --verbose 2>/dev/null ${HOME}
+	sed /usr/bin x=1 then 'quoted text' $(pwd) $(pwd)
+	| | -eu cd done done readonly
+		echo export local then cd "$1" sed then export
+printf printf 2>/dev/null
+		&& then readonly grep $(pwd) ${HOME}
+"$1" 'quoted text' && x=1 then 'quoted text' then then test
+/usr/bin sed "$1" && | $(pwd) | -eu && | cd && sed 'quoted text' -eu ${HOME}
+		sed awk readonly then && "$@" cd sed x=1 echo test awk test awk | x=1
+		${HOME} echo then x=1 cd -eu --verbose cd 'quoted text'
+	-eu sed echo cd export "$1" /usr/bin 'quoted text' readonly | readonly |
+test grep echo grep "$1" export readonly | 'quoted text' && printf && 'quoted text'
+	awk 'quoted text' x=1 -eu --verbose done then "$@" sed -eu export
+	--verbose 2>/dev/null "$1"
+	x=1 --verbose then sed test grep && $(pwd) echo done | echo echo "$@"
+${HOME} then local -eu 'quoted text' test -eu 2>/dev/null ${HOME} $(pwd)
+&& 2>/dev/null ${HOME} ${HOME} grep grep grep printf echo |
+2>/dev/null "$1" test echo
+printf sed awk $(pwd) 2>/dev/null sed "$1" export
+		'quoted text' readonly x=1 cd cd | "$1" | --verbose x=1 test awk |
+		-eu test then printf test | /usr/bin
+		awk export then sed awk done ${HOME} readonly
+printf printf then sed test ${HOME} 'quoted text' readonly
+then local then test test sed then then
+	echo local test test x=1 cd then
+--verbose "$1" "$1" 'quoted text'
+		x=1 export done x=1 "$@" ${HOME} then
+	awk /usr/bin $(pwd) "$@" grep 'quoted text' 'quoted text'
+		done $(pwd) 2>/dev/null /usr/bin
+'quoted text' export /usr/bin $(pwd) echo printf test
+-eu awk readonly | sed 2>/dev/null --verbose | 'quoted text' echo -eu
+	| 2>/dev/null readonly test --verbose test local --verbose --verbose readonly
+	x=1 awk 'quoted text' local then 2>/dev/null "$1" then -eu grep | $(pwd) export
+	'quoted text' $(pwd) x=1 test test && "$1" "$@" awk test x=1
+	"$@" | /usr/bin && --verbose | x=1 awk printf local x=1 2>/dev/null | "$@"
+	2>/dev/null && readonly readonly 2>/dev/null sed then && --verbose --verbose export
+-eu x=1 test grep cd ${HOME} 'quoted text' then readonly 2>/dev/null
+	2>/dev/null 'quoted text' export grep grep sed /usr/bin readonly done
+		x=1 echo | $(pwd) readonly local 'quoted text'
+-eu printf $(pwd) sed grep "$1" sed awk printf | done x=1 "$@" awk
+grep --verbose -eu grep
+		cd then awk 'quoted text' done cd "$1" -eu local grep export sed "$@" grep grep
+&& sed | test awk cd test x=1 local printf x=1 then "$1" $(pwd)
+cd echo awk $(pwd) done "$1" "$1"
+		echo done done readonly echo done | 2>/dev/null --verbose done readonly
+"$@" cd x=1 printf 2>/dev/null
+	| ${HOME} "$1" "$@" ${HOME} local grep "$@" && echo echo cd "$@" test readonly
+	readonly x=1 then | 2>/dev/null -eu "$1" awk -eu sed sed -eu readonly -eu
+test && 2>/dev/null $(pwd) export /usr/bin "$@" echo
+	then x=1 --verbose local -eu 'quoted text' readonly test 'quoted text'
+	sed test "$@" printf x=1 x=1 x=1 awk local echo printf printf
+test ${HOME} done x=1 cd $(pwd)
+		2>/dev/null readonly echo
+"$1" sed "$@" 'quoted text' test export test echo $(pwd) done --verbose
+	2>/dev/null sed done | $(pwd) "$@" "$1" /usr/bin /usr/bin 2>/dev/null
+	export echo printf $(pwd) export ${HOME} printf $(pwd)
+'quoted text' cd --verbose readonly 2>/dev/null 'quoted text' "$@" 'quoted text'
+${HOME} awk x=1 test awk 'quoted text' echo then "$@" done --verbose
+	x=1 --verbose "$1" echo && /usr/bin |
+		export --verbose && readonly "$1" 'quoted text' "$1" done ${HOME}
+x=1 done --verbose /usr/bin /usr/bin 2>/dev/null
+	grep grep awk readonly x=1 $(pwd) echo | readonly $(pwd) then test then grep
+		"$1" printf printf && ${HOME} &&
+	readonly grep 'quoted text' /usr/bin grep done done echo
+	/usr/bin && export $(pwd) $(pwd) "$@" $(pwd) x=1 |
+		printf | --verbose readonly 2>/dev/null
+test then && -eu "$@" echo grep printf
+sed awk | export 'quoted text' awk "$1" done x=1 | x=1 && grep
+		&& printf ${HOME} 2>/dev/null export && local $(pwd) && sed sed 'quoted text' "$@"
+test --verbose grep ${HOME} ${HOME} export "$@" readonly
+		&& ${HOME} awk "$1" 'quoted text' --verbose 'quoted text'
+		'quoted text' grep cd -eu x=1 "$1" test ${HOME}
+echo $(pwd) x=1 readonly ${HOME} -eu printf
+export export grep $(pwd) 'quoted text' cd
+cd "$@" awk grep readonly --verbose awk readonly 'quoted text'
+printf export ${HOME} | test awk 'quoted text' "$1"
+$(pwd) grep echo --verbose printf
+	'quoted text' awk echo | readonly then 'quoted text'
+	&& x=1 echo sed 'quoted text' 'quoted text'
+	awk sed "$@" done export local -eu $(pwd) -eu "$1" test
+	then readonly "$1" echo && "$1" 'quoted text'
+	local | -eu | $(pwd) $(pwd) sed then sed test export | ${HOME}
+${HOME} then "$@" $(pwd) export /usr/bin 'quoted text' readonly
+${HOME} cd cd && 'quoted text' /usr/bin && echo echo && export 2>/dev/null sed
+	done -eu then 'quoted text' ${HOME} | cd -eu ${HOME} "$1" sed 'quoted text'
+&& readonly grep x=1 echo done x=1 echo /usr/bin &&
+	printf sed test ${HOME} 'quoted text' printf readonly && | readonly
+"$1" test "$1" 2>/dev/null local test export x=1 printf --verbose | "$@"
+		'quoted text' done cd
+		then "$1" printf echo grep export 2>/dev/null awk -eu | $(pwd) export readonly
+echo test -eu /usr/bin "$@"
+	| echo 'quoted text' 2>/dev/null && x=1
+		test grep sed test --verbose
+export 'quoted text' x=1 | cd echo cd export local
+		-eu "$1" then local | local /usr/bin
+	printf echo printf "$@" && printf echo && readonly x=1 "$1"
+	readonly | --verbose export done grep | && cd 2>/dev/null cd grep
+	then 'quoted text' export done 2>/dev/null done "$1" local printf --verbose 2>/dev/null
+		sed x=1 -eu 2>/dev/null then printf local readonly --verbose then 'quoted text'
+	&& | grep cd 'quoted text' then -eu done
+--verbose sed /usr/bin /usr/bin
+	--verbose grep test done readonly -eu 2>/dev/null
+		done 'quoted text' echo readonly --verbose printf then grep echo local done
+		printf | local test --verbose 'quoted text' echo echo
+	export /usr/bin export 'quoted text'
+		$(pwd) sed awk grep --verbose
+	echo test echo $(pwd) cd --verbose grep $(pwd) && "$@"
+2>/dev/null sed grep cd "$1" test x=1 then 2>/dev/null awk sed test --verbose
+		grep then "$1" ${HOME}
+sed then "$1" local --verbose
+&& && export awk $(pwd) -eu grep /usr/bin 'quoted text' "$1" -eu printf "$1"
+		awk then 2>/dev/null "$1" /usr/bin then cd |
+	test "$1" ${HOME} | /usr/bin -eu -eu
+	"$1" ${HOME} --verbose "$1" awk sed
+	local 'quoted text' readonly cd 2>/dev/null $(pwd) -eu x=1 ${HOME} export
+		/usr/bin grep ${HOME} grep
+x=1 local grep --verbose export --verbose sed | echo readonly local
+	'quoted text' done x=1 ${HOME} echo $(pwd) /usr/bin readonly
+		$(pwd) local -eu test printf
+"$1" done 2>/dev/null export local /usr/bin test | cd
+	readonly --verbose test echo |
+	echo printf x=1 2>/dev/null 'quoted text' --verbose $(pwd) sed $(pwd)
+	sed -eu -eu 2>/dev/null x=1 test
+	sed echo readonly && $(pwd) ${HOME} echo echo sed export sed 2>/dev/null
+sed awk sed echo export
+	then then 2>/dev/null $(pwd) local
+'quoted text' echo local
+done cd --verbose "$@" 'quoted text' sed 2>/dev/null
+"$@" printf printf sed sed -eu sed done cd --verbose
+		grep "$1" | /usr/bin 2>/dev/null -eu export echo ${HOME}
+readonly then export done /usr/bin
+		&& test 2>/dev/null sed /usr/bin /usr/bin echo done export
+	cd done awk cd "$1" printf
+&& $(pwd) local ${HOME} local echo ${HOME}
+local | export 2>/dev/null
+		done done done | cd ${HOME}
+	echo ${HOME} echo printf && sed -eu grep --verbose readonly 'quoted text' /usr/bin
+		| done 2>/dev/null cd done sed --verbose echo cd cd sed ${HOME} ${HOME}
+&& "$1" test /usr/bin /usr/bin
+		export done test readonly && 'quoted text' sed --verbose
+--verbose -eu cd echo grep local done | -eu awk
+		then ${HOME} readonly /usr/bin sed test printf ${HOME} "$@" done /usr/bin
+	/usr/bin 'quoted text' local "$@" && 2>/dev/null then -eu "$@" local 2>/dev/null
+&& "$1" cd cd "$1" 'quoted text' awk -eu
+	/usr/bin sed cd -eu readonly x=1 --verbose echo 2>/dev/null "$1"
+"$@" $(pwd) "$1" -eu ${HOME} ${HOME} printf ${HOME} 2>/dev/null
+		printf local readonly 'quoted text' 'quoted text'
+		2>/dev/null -eu sed 2>/dev/null
+	cd ${HOME} grep done printf x=1
+	--verbose -eu done x=1 printf grep cd $(pwd) sed awk readonly
+	2>/dev/null --verbose $(pwd) -eu grep readonly then &&
+"$@" $(pwd) /usr/bin "$@" --verbose test printf | $(pwd) export -eu
+	2>/dev/null export grep "$@" done cd ${HOME} "$1" test
+2>/dev/null export done test sed awk
+	${HOME} then "$1" 2>/dev/null --verbose then local x=1 --verbose
+	export "$1" sed ${HOME} cd echo | readonly x=1
+"$1" --verbose cd 2>/dev/null | && test
+		"$1" /usr/bin test "$@"
+		"$1" readonly test -eu 'quoted text'
+	"$1" cd echo test && export 'quoted text' awk grep grep "$@" awk 'quoted text'
+		awk x=1 readonly "$1" cd readonly "$@" local --verbose ${HOME}
+	${HOME} 'quoted text' && "$1" sed
+| /usr/bin awk $(pwd) readonly x=1 echo --verbose /usr/bin
+		${HOME} "$1" local cd grep grep export done done /usr/bin "$1" "$1"
+	2>/dev/null test "$@" local $(pwd) awk readonly sed "$@" cd
+		2>/dev/null test echo grep
+		| 2>/dev/null x=1 export 2>/dev/null
+		cd test then echo grep 'quoted text' x=1 test awk ${HOME}
+$(pwd) "$@" --verbose --verbose
+		grep echo sed -eu $(pwd) 'quoted text' awk -eu /usr/bin 2>/dev/null "$1" "$1"
+printf grep sed done cd &&
+		'quoted text' done readonly 'quoted text' export "$@" grep local
+		test test test grep echo /usr/bin then 2>/dev/null
+	readonly /usr/bin local
+	printf 'quoted text' 2>/dev/null awk 2>/dev/null grep awk --verbose cd export
+		then local printf sed local | 'quoted text' /usr/bin test && x=1 awk
+		${HOME} --verbose "$1" local --verbose "$@" readonly
+${HOME} 'quoted text' printf readonly cd | done export ${HOME} $(pwd) x=1 awk --verbose
+		done echo sed then echo 'quoted text' ${HOME} -eu awk echo
+	"$1" | && done | grep
+		--verbose cd ${HOME} awk -eu printf --verbose
+	echo ${HOME} && "$1" 'quoted text' echo | | 'quoted text' cd grep && 2>/dev/null
+/usr/bin && test x=1 'quoted text' awk cd -eu $(pwd) printf echo
+		-eu done -eu 2>/dev/null local sed x=1 done
+		| 'quoted text' then "$@" "$@" x=1 "$@" readonly sed ${HOME}
+		grep done test 'quoted text' then ${HOME} then test then /usr/bin
+	grep echo --verbose test "$1" printf /usr/bin grep awk ${HOME} ${HOME} "$@"
+&& | grep /usr/bin test $(pwd) $(pwd)
+	x=1 export done ${HOME} --verbose
+		awk ${HOME} /usr/bin export echo 2>/dev/null
+	x=1 /usr/bin | -eu done awk test ${HOME} test local readonly test test /usr/bin
+	| /usr/bin /usr/bin | -eu && echo sed "$@" 'quoted text' 2>/dev/null cd "$@"
+		-eu "$1" $(pwd) /usr/bin done "$1" "$@" $(pwd) echo ${HOME} export | | $(pwd)
+	$(pwd) printf 'quoted text'
+	-eu cd -eu printf awk echo && local 2>/dev/null
+	| cd 2>/dev/null /usr/bin echo --verbose $(pwd) readonly printf
+export grep grep /usr/bin
+		"$1" readonly cd local
+grep "$@" x=1 2>/dev/null /usr/bin echo "$@"
+--verbose && local ${HOME} sed grep && 'quoted text'
+		cd --verbose "$1" "$1" awk done "$1" done sed export export /usr/bin local grep
+awk awk cd readonly && | ${HOME}
+		"$@" echo ${HOME} sed | x=1 "$1" -eu grep export grep "$1" cd export done x=1 done
+	readonly x=1 "$@" grep
+done local -eu -eu export printf grep grep grep
+&& then echo done test test
+readonly cd "$@" cd "$1" awk test ${HOME} $(pwd)
+"$@" test grep "$1" x=1 readonly 'quoted text' test "$@" test x=1
+		done "$1" then --verbose --verbose
+grep 2>/dev/null cd "$1" "$@" cd grep -eu
+		&& echo 2>/dev/null printf
+		awk ${HOME} && | && printf
+sed echo readonly && /usr/bin "$@" 2>/dev/null
+		2>/dev/null --verbose | | --verbose then "$1" ${HOME}
+	"$1" "$1" export x=1 ${HOME} test printf
+	'quoted text' $(pwd) --verbose echo
+"$@" readonly cd awk test | readonly "$1"
+$(pwd) "$1" && printf --verbose readonly x=1 "$@" "$@" readonly
+sed sed echo grep cd done -eu $(pwd) sed
+&& local ${HOME} "$1" export then
+		| ${HOME} readonly 'quoted text' && "$@" cd --verbose export printf
+	--verbose "$@" /usr/bin grep "$1"
+	'quoted text' done done x=1 | grep sed --verbose 'quoted text' | | $(pwd) | readonly
+		| $(pwd) "$@" echo echo printf x=1 cd echo && /usr/bin echo ${HOME} 'quoted text'
+	export $(pwd) awk "$1" && x=1 $(pwd) done export printf -eu x=1 -eu
+done --verbose --verbose echo /usr/bin test --verbose && ${HOME}
+grep printf awk echo -eu "$1" | "$1" 2>/dev/null
+		x=1 "$1" cd x=1 cd | ${HOME} $(pwd) awk cd readonly grep $(pwd) "$@" "$1" $(pwd)
+awk 'quoted text' "$1" /usr/bin $(pwd) grep ${HOME} "$1" grep
+2>/dev/null done printf grep
+		printf sed 'quoted text' cd 'quoted text'
+	${HOME} 'quoted text' cd 'quoted text'
+		then local /usr/bin grep && export $(pwd) awk grep test $(pwd)
+		&& 2>/dev/null "$@" awk
+	--verbose $(pwd) local "$1" /usr/bin ${HOME} 2>/dev/null sed printf ${HOME}
+		test "$1" grep readonly test done
+	then && cd -eu && grep && -eu
+${HOME} ${HOME} grep cd --verbose test
+local $(pwd) test "$1" /usr/bin test x=1 done && --verbose "$1" echo
+		-eu readonly readonly $(pwd) -eu sed ${HOME} export "$1" | 2>/dev/null
+test awk /usr/bin echo "$@" /usr/bin x=1 "$1" echo
+	printf then export | /usr/bin then echo -eu 2>/dev/null local -eu test
+	test local cd awk "$@" grep $(pwd)
+		readonly && -eu --verbose grep 'quoted text' echo --verbose echo /usr/bin awk
+x=1 readonly && x=1 -eu | printf && | cd awk 2>/dev/null
+readonly printf --verbose x=1 readonly -eu awk "$@" grep test printf printf
+		2>/dev/null && readonly
+awk /usr/bin ${HOME} awk "$1" test cd
+	&& -eu "$@" printf readonly
+	echo export "$1" /usr/bin printf
+${HOME} export /usr/bin grep /usr/bin
+local 2>/dev/null $(pwd)
+"$1" test awk test "$1" "$1" $(pwd) readonly /usr/bin $(pwd) "$1" ${HOME}
+		grep 'quoted text' x=1 sed readonly ${HOME} -eu echo awk 'quoted text' /usr/bin
+	/usr/bin /usr/bin export sed cd readonly 'quoted text'
+${HOME} | && 2>/dev/null -eu $(pwd) local 2>/dev/null awk export $(pwd)
+awk /usr/bin $(pwd) ${HOME} "$@"
+	--verbose awk export export "$@" /usr/bin cd | done 'quoted text'
+test grep 2>/dev/null then export ${HOME} | -eu export
+local printf x=1 2>/dev/null -eu x=1 printf readonly echo
+		cd export local sed printf "$1" awk ${HOME} readonly --verbose "$@"
+	echo | | 'quoted text' 'quoted text'
+		| && awk "$1" /usr/bin sed 2>/dev/null grep 'quoted text' -eu
+test awk 2>/dev/null 'quoted text' $(pwd) done -eu $(pwd)
+		cd printf | && grep ${HOME} then then readonly awk readonly
+		awk "$@" "$1" --verbose test done echo 'quoted text' then
+	"$1" export test then done ${HOME} awk | test cd | done "$@"
+	done | done ${HOME} sed /usr/bin && ${HOME} -eu
+		test && awk awk x=1 x=1 done sed 2>/dev/null
+	| "$@" echo x=1 | "$@" echo grep --verbose
+		--verbose then "$1" printf
+printf done | awk --verbose sed x=1 ${HOME} readonly --verbose ${HOME} --verbose
+	&& x=1 grep local $(pwd) local echo export printf cd -eu grep sed test $(pwd) &&
+	"$@" grep x=1 "$1" --verbose awk local --verbose x=1 /usr/bin export readonly
+&& awk --verbose ${HOME} 'quoted text' sed 2>/dev/null "$1"
+		echo grep && done then readonly 'quoted text'
+--verbose printf readonly "$1" readonly 'quoted text' --verbose
+	cd done sed x=1 $(pwd) awk $(pwd) grep printf grep echo && "$1" cd /usr/bin
+echo x=1 --verbose test /usr/bin awk
+		2>/dev/null grep 'quoted text' --verbose --verbose && readonly
+local x=1 echo "$@" | export export
+"$@" -eu then --verbose 'quoted text' $(pwd) | done sed
+		2>/dev/null done readonly then ${HOME} | /usr/bin | --verbose
+cd cd awk printf && -eu export && 2>/dev/null "$1" "$1"
+		done grep test /usr/bin local test printf printf export x=1 grep
+	$(pwd) cd 2>/dev/null ${HOME} awk printf 'quoted text' grep then
+		export grep printf sed && echo --verbose
+		done /usr/bin grep x=1 $(pwd)
+cd "$1" x=1 --verbose | cd printf test
+"$@" export sed readonly then 'quoted text' ${HOME}
+	${HOME} echo "$1" 2>/dev/null done sed --verbose "$1" test ${HOME} && |
+	local 'quoted text' then x=1 --verbose
+		test "$@" --verbose --verbose echo ${HOME} && local -eu /usr/bin
+"$1" done done grep cd done | echo 'quoted text' "$1" $(pwd)
+	-eu -eu x=1 readonly grep grep awk "$@" then done grep
+	done grep sed test --verbose printf "$@" 'quoted text' cd
+readonly /usr/bin done &&
+		then --verbose /usr/bin grep --verbose grep printf 'quoted text'
+done echo local grep 2>/dev/null sed
+	-eu then then /usr/bin "$@" grep
+		local -eu readonly x=1 done export --verbose test "$@" $(pwd) && printf cd "$1"
+	"$1" export done cd ${HOME} then --verbose then then done
+${HOME} local x=1 /usr/bin "$1" grep echo --verbose ${HOME} local
+		'quoted text' echo done "$@"
+	&& ${HOME} x=1 2>/dev/null then --verbose awk 2>/dev/null 2>/dev/null
+	grep | awk 'quoted text'
+	printf ${HOME} && export && /usr/bin awk sed -eu "$1" 'quoted text'
+	export x=1 'quoted text' echo cd cd x=1 test 2>/dev/null
+then printf awk awk && x=1
+		&& "$@" readonly && cd readonly --verbose cd | sed awk awk export $(pwd) awk
+"$@" "$@" 2>/dev/null
+| | then $(pwd) /usr/bin --verbose
+/usr/bin test --verbose readonly -eu 2>/dev/null cd ${HOME} echo
+	/usr/bin then $(pwd) sed cd readonly cd $(pwd) awk "$@" /usr/bin --verbose
+		test 'quoted text' export ${HOME}
+		then grep | 2>/dev/null then 'quoted text' ${HOME} grep | then sed
+test export printf -eu then then && echo --verbose printf sed
+	| export --verbose "$1" awk test sed 'quoted text' && "$@" /usr/bin echo
+test 'quoted text' $(pwd) | done "$@" grep export
+	done awk printf | --verbose echo -eu | $(pwd) ${HOME}
+		echo "$1" grep | grep /usr/bin "$1" echo --verbose
+	--verbose then readonly test $(pwd) then grep ${HOME} "$1"
+x=1 sed printf sed grep cd test local $(pwd) sed cd --verbose
+	sed ${HOME} 'quoted text' done echo
+		done readonly "$@" -eu sed &&
+		grep | grep ${HOME} 2>/dev/null local
+		--verbose $(pwd) cd test 2>/dev/null printf x=1
+		sed echo --verbose sed readonly printf sed "$@" local sed echo local
+		${HOME} /usr/bin "$@" | 'quoted text' echo test x=1 printf
+	cd export grep ${HOME}
+awk && printf 'quoted text' $(pwd) local sed "$@" x=1 sed && local 2>/dev/null
+		awk readonly cd done 2>/dev/null
+		/usr/bin grep 2>/dev/null 2>/dev/null
+		printf then printf -eu | "$@" "$1" 2>/dev/null 2>/dev/null
+		${HOME} $(pwd) ${HOME} -eu done grep then 'quoted text' sed grep
+	done -eu -eu test 'quoted text'
+	then cd x=1 && awk readonly $(pwd) ${HOME} cd echo awk "$@" | sed
+then --verbose then 2>/dev/null then 'quoted text'
+		echo readonly && 2>/dev/null export readonly grep /usr/bin done readonly
+		sed 'quoted text' $(pwd) "$1" local -eu "$@" sed grep ${HOME} /usr/bin
+$(pwd) -eu echo && 'quoted text' 'quoted text'
+		"$@" cd grep cd then x=1 $(pwd) 'quoted text'
+		'quoted text' done export done echo done
+		"$1" readonly echo printf /usr/bin /usr/bin x=1 done test awk ${HOME} printf
+	sed "$@" 'quoted text' x=1 $(pwd) -eu ${HOME} 'quoted text'
+		test done echo then 2>/dev/null sed "$1" grep test
+	printf x=1 printf /usr/bin
+		| x=1 2>/dev/null cd -eu /usr/bin cd done "$@"
+then grep test awk printf && cd 'quoted text' "$1" $(pwd) 'quoted text'
+		echo -eu readonly done && "$@" echo && echo ${HOME}
+		2>/dev/null $(pwd) 'quoted text'
+	"$@" x=1 readonly then 'quoted text' then grep export "$@" ${HOME} /usr/bin
+$(pwd) done done --verbose $(pwd) grep then "$@" --verbose ${HOME} sed "$@"
+		printf ${HOME} then 2>/dev/null sed --verbose grep x=1 --verbose ${HOME} /usr/bin
+sed $(pwd) $(pwd) -eu "$1" sed export /usr/bin test test /usr/bin then 'quoted text'
+then | && cd --verbose cd test readonly -eu grep sed && done then --verbose
+	/usr/bin done awk /usr/bin cd -eu ${HOME} echo cd x=1 readonly sed ${HOME} 'quoted text'
+	'quoted text' 'quoted text' export
+		export /usr/bin cd printf 'quoted text' done done $(pwd) printf
+printf local printf 2>/dev/null --verbose /usr/bin
+--verbose readonly export export --verbose -eu | printf
+		echo "$1" && local awk cd | export printf 'quoted text' echo
+		&& --verbose | && /usr/bin --verbose -eu then awk
+| test "$@" "$@" export && x=1 "$@" $(pwd) export x=1 ${HOME} && export grep test
+	local -eu awk x=1 --verbose cd $(pwd)
+2>/dev/null done grep sed /usr/bin ${HOME} export "$1" grep /usr/bin -eu echo
+		x=1 'quoted text' 2>/dev/null printf x=1 --verbose -eu local 2>/dev/null
+sed --verbose export export | export
+		&& | -eu /usr/bin sed "$1" 2>/dev/null
+	export 'quoted text' && 'quoted text' ${HOME} ${HOME} && | export "$1"
+awk --verbose $(pwd) && echo "$1" 'quoted text'
+	cd readonly "$@" $(pwd) test test | "$@" local "$1" readonly ${HOME} 2>/dev/null
+		/usr/bin done printf "$1" 'quoted text' 2>/dev/null /usr/bin && readonly -eu export
+		then test readonly "$1" "$@" awk x=1 "$1" --verbose
+	--verbose | /usr/bin then echo "$1" export "$@"
+	--verbose echo ${HOME} cd local 'quoted text'
+		"$@" 2>/dev/null readonly 'quoted text' "$@" --verbose && readonly
+"$@" test ${HOME} /usr/bin done | x=1 'quoted text' then
+	$(pwd) readonly readonly echo $(pwd) sed then | awk ${HOME} printf "$@"
+	x=1 "$1" 2>/dev/null ${HOME} then "$@" then | done sed 2>/dev/null
+		then sed 2>/dev/null ${HOME} && 'quoted text'
+then 'quoted text' sed local && "$@"
+	export --verbose export printf then awk echo test awk ${HOME} ${HOME} ${HOME}
+	echo "$1" /usr/bin | readonly "$@" grep
+	echo "$1" readonly cd "$@" awk /usr/bin /usr/bin export
+		cd cd done done 2>/dev/null grep && ${HOME} echo "$@" 'quoted text'
+	&& readonly | readonly then $(pwd) $(pwd) && sed awk readonly printf
+awk "$@" 'quoted text' "$@" sed x=1 2>/dev/null grep -eu readonly /usr/bin
+		"$1" cd "$1" echo done done "$@" "$@" cd ${HOME} sed cd local echo then
+	export test "$@" grep --verbose
+done export -eu export "$@" /usr/bin
+		test local done /usr/bin sed echo local then
+		--verbose cd local grep 2>/dev/null cd echo
+	${HOME} sed readonly grep readonly $(pwd) ${HOME} ${HOME}
+2>/dev/null test local then 2>/dev/null test
+printf x=1 done then | sed test
+		printf $(pwd) "$@" readonly
+		&& 2>/dev/null awk && /usr/bin export readonly -eu echo -eu | echo -eu export
+		readonly x=1 -eu $(pwd) grep grep awk "$@" "$@"
+	grep then x=1 "$@" "$@" | echo x=1 done "$@" /usr/bin
+2>/dev/null cd $(pwd) 2>/dev/null
+	'quoted text' 2>/dev/null $(pwd) | $(pwd) ${HOME} done
+		echo 2>/dev/null readonly grep -eu sed sed | 2>/dev/null done
+local local /usr/bin echo
+cd 'quoted text' local sed x=1
+done x=1 -eu x=1 local /usr/bin readonly done $(pwd) sed
+		&& echo | | x=1 'quoted text' /usr/bin $(pwd) local
+	local local done | x=1 echo echo done echo echo x=1 local --verbose echo "$1"
+		${HOME} cd 2>/dev/null readonly cd /usr/bin /usr/bin
+cd x=1 /usr/bin | 'quoted text' --verbose 2>/dev/null | 2>/dev/null echo ${HOME}
+printf export cd then /usr/bin echo readonly
+	'quoted text' $(pwd) ${HOME} --verbose 2>/dev/null | printf "$1" x=1 local 'quoted text'
+	grep "$@" echo | x=1 cd then "$1"
+	"$@" 'quoted text' /usr/bin --verbose
+	printf /usr/bin done --verbose
+	done local ${HOME} /usr/bin
+		cd test printf "$1" awk awk cd $(pwd) then printf
+		-eu grep awk awk 2>/dev/null -eu | && cd done 2>/dev/null
+sed /usr/bin export /usr/bin --verbose 'quoted text'
+	"$@" cd then awk x=1 sed test
+grep $(pwd) local ${HOME} ${HOME} "$1" grep /usr/bin
+		"$@" cd | then grep local printf then x=1 cd /usr/bin awk /usr/bin ${HOME}
+cd "$1" ${HOME} | test -eu echo /usr/bin awk local /usr/bin 2>/dev/null
+		&& export ${HOME} "$1" sed
+echo 2>/dev/null awk printf done readonly
+		$(pwd) printf --verbose &&
+	printf readonly readonly "$1" echo
+	'quoted text' cd test "$@" /usr/bin $(pwd) echo local && echo echo
+		readonly echo cd x=1 -eu echo --verbose
+	"$1" awk --verbose then "$@" readonly --verbose
+		&& local done 2>/dev/null sed grep export --verbose export -eu /usr/bin
+	sed "$@" "$1" printf ${HOME} readonly "$@" printf sed readonly
+cd echo done ${HOME} -eu 'quoted text' local printf "$1" "$1" /usr/bin
+	export done ${HOME} printf local 'quoted text'
+sed local grep grep done then readonly done && local
+	&& --verbose 2>/dev/null done grep printf /usr/bin "$@" then /usr/bin ${HOME} then
+		$(pwd) "$@" export grep then echo 2>/dev/null $(pwd) "$1" grep
+echo x=1 echo 2>/dev/null awk readonly && 'quoted text'
+	export 2>/dev/null then done /usr/bin echo && "$1" test $(pwd) | test export
+		'quoted text' then | awk --verbose
+${HOME} ${HOME} echo 'quoted text' done && --verbose -eu done local
+'quoted text' grep --verbose -eu 'quoted text' printf cd done
+--verbose 'quoted text' 2>/dev/null
+	$(pwd) test 2>/dev/null && "$@" done 2>/dev/null readonly readonly
+	echo 2>/dev/null readonly | "$@" ${HOME} readonly "$1" readonly --verbose
+		$(pwd) && | awk "$@" "$@" $(pwd) done && test cd --verbose local "$1" then 'quoted text'
+	$(pwd) "$1" sed grep grep grep export printf then
+	x=1 $(pwd) then test 'quoted text' awk ${HOME}
+--verbose local 2>/dev/null 'quoted text' test
+	${HOME} readonly export
+		grep cd "$@" 'quoted text' sed x=1 && printf --verbose local
+		readonly --verbose local sed awk | cd then ${HOME} | ${HOME} 2>/dev/null
+	printf -eu --verbose grep echo
+		"$1" done ${HOME} --verbose then printf "$@" /usr/bin readonly done test export
+	test --verbose sed 2>/dev/null echo -eu && ${HOME} /usr/bin then echo echo
+	local x=1 printf && cd x=1
+	&& readonly x=1 cd printf 2>/dev/null printf | "$@" /usr/bin
+		| echo export -eu x=1 -eu "$1" cd "$@" 'quoted text' $(pwd) echo "$1"
+readonly 'quoted text' readonly
+-eu echo local readonly x=1 awk local
+"$@" $(pwd) 2>/dev/null --verbose
+		--verbose grep export echo ${HOME} x=1
+	printf 'quoted text' 2>/dev/null readonly
+		readonly printf test /usr/bin sed x=1 echo test -eu /usr/bin then $(pwd) grep
+		x=1 export cd awk sed "$@" 2>/dev/null printf export 'quoted text'
+		2>/dev/null readonly $(pwd) --verbose export ${HOME}
+'quoted text' echo /usr/bin 'quoted text' ${HOME} -eu done
+grep "$1" grep x=1 test ${HOME} /usr/bin
+/usr/bin | cd | test sed "$@" /usr/bin ${HOME} "$1" awk grep 'quoted text'
+	${HOME} $(pwd) then printf awk x=1 then test cd |
+	awk export export 'quoted text' $(pwd) 'quoted text'
+echo 2>/dev/null /usr/bin "$1" local done $(pwd) export
+readonly readonly $(pwd) local grep sed echo
+		&& -eu cd export x=1 --verbose local --verbose sed local test /usr/bin
+	printf local printf export "$1" 2>/dev/null
+awk printf local local echo
+	awk "$1" then /usr/bin ${HOME} /usr/bin local
+	sed done "$@" export 2>/dev/null "$1"
+		| | $(pwd) awk echo "$@" sed && 'quoted text'
+	"$1" sed --verbose then /usr/bin 2>/dev/null --verbose && /usr/bin
+	grep test test awk grep printf --verbose echo -eu
+		-eu 2>/dev/null --verbose done /usr/bin ${HOME} sed $(pwd)
+$(pwd) 'quoted text' export -eu printf done sed "$@" -eu
+	"$@" "$@" x=1 x=1 local cd && 'quoted text' printf "$1" && "$@"
+	2>/dev/null --verbose 2>/dev/null export cd 2>/dev/null
+x=1 grep export x=1 done "$1" done echo echo then ${HOME}
+	"$1" $(pwd) test 'quoted text' sed /usr/bin sed x=1 printf
+	"$1" cd "$1" readonly readonly x=1 local | /usr/bin 2>/dev/null $(pwd) then
+		test export && $(pwd) -eu 'quoted text' then test awk sed grep
+		then printf "$1" && 2>/dev/null
+/usr/bin --verbose "$1" test ${HOME} awk /usr/bin x=1 grep $(pwd) ${HOME}
+		echo grep then "$1" /usr/bin grep done readonly
+	echo x=1 "$@" readonly | export 'quoted text'
+	2>/dev/null sed grep printf then local cd awk ${HOME} sed -eu x=1 x=1
+		x=1 cd sed test grep echo 2>/dev/null
+	export /usr/bin local /usr/bin
+	printf 2>/dev/null local cd $(pwd) /usr/bin
+cd /usr/bin 'quoted text' local cd 2>/dev/null done -eu "$1" "$1" "$1" "$1"
+${HOME} then readonly export --verbose && "$@" readonly
+		local --verbose x=1 x=1 'quoted text'
+	${HOME} $(pwd) sed readonly test done done x=1 --verbose $(pwd) "$1" export
+	$(pwd) readonly printf $(pwd) local | -eu then ${HOME} echo
+	$(pwd) then --verbose
+		echo -eu -eu echo sed echo --verbose awk then 'quoted text' &&
+		export printf cd echo done "$1" | sed local grep --verbose && echo
+		echo local x=1 export $(pwd) && echo export | 2>/dev/null then
+test "$1" ${HOME} 2>/dev/null
+done export local && && awk "$@"
+		${HOME} 2>/dev/null "$@" 'quoted text' && then done 'quoted text' -eu cd $(pwd)
+	| awk $(pwd) 2>/dev/null then 'quoted text' x=1 2>/dev/null readonly "$1" done
+		test $(pwd) 2>/dev/null --verbose then -eu awk readonly test sed "$@"
+		grep 2>/dev/null local "$1" | "$1" printf $(pwd) -eu -eu cd printf
+local test --verbose grep local 'quoted text' readonly done ${HOME} printf awk
+	"$1" "$1" printf | grep 2>/dev/null local cd sed x=1 grep |
+#include c103.sh
+		then local export x=1 export | local printf awk && "$@" readonly printf sed cd "$@"
+2>/dev/null sed local test echo "$1" then grep
+'quoted text' readonly export echo cd echo 2>/dev/null "$@"
+	grep printf cd "$1" local readonly --verbose ${HOME} 2>/dev/null then test local
+	cd cd grep awk ${HOME} done ${HOME} printf sed -eu local && export export
+x=1 printf done "$@" test --verbose
+readonly readonly local 'quoted text' 2>/dev/null $(pwd) readonly
+sed done /usr/bin test readonly --verbose -eu "$1" x=1 'quoted text' | export --verbose
+	$(pwd) cd ${HOME} then then --verbose cd done /usr/bin
+		&& sed | 'quoted text' readonly $(pwd) | 2>/dev/null x=1 "$1" test -eu && -eu
+| $(pwd) readonly 'quoted text' grep
+		grep readonly readonly grep "$@" $(pwd) sed 'quoted text' -eu 'quoted text'
+readonly export x=1 'quoted text' && printf
+	sed done echo echo export && readonly cd /usr/bin then -eu x=1 --verbose
+"$1" x=1 readonly 'quoted text' then export 2>/dev/null cd --verbose --verbose
+local cd printf 2>/dev/null
+cd ${HOME} | $(pwd) printf 2>/dev/null x=1
+	| sed 'quoted text' grep "$@" echo "$@" done 2>/dev/null done && /usr/bin 'quoted text'
+		then export sed then awk readonly sed test
+		2>/dev/null readonly 'quoted text' x=1 --verbose -eu export --verbose
+readonly export test then ${HOME} export | readonly $(pwd) grep
+		x=1 -eu && sed local 'quoted text'
+"$@" test then local 'quoted text' && local printf echo
+	printf test && $(pwd) 2>/dev/null
+$(pwd) then | local echo grep && done cd && "$@" done ${HOME}
+		done /usr/bin grep ${HOME} /usr/bin
+"$@" then ${HOME} "$@" local --verbose ${HOME} readonly awk 'quoted text' x=1
+&& | then grep x=1 2>/dev/null echo awk local | printf
+	$(pwd) -eu && local 'quoted text'
+		printf export $(pwd) --verbose
+		sed ${HOME} && printf sed
+-eu cd test done $(pwd) "$@" /usr/bin cd $(pwd)
+	printf export "$@" printf cd "$@" && 'quoted text'
+		done then done readonly --verbose readonly 2>/dev/null
+		"$@" 'quoted text' sed export export -eu x=1 local grep 'quoted text'
+	then then "$1" -eu | awk done /usr/bin grep then && test "$@" ${HOME} local
+		'quoted text' "$@" then x=1 --verbose "$1" done export | ${HOME} 2>/dev/null
+-eu "$1" $(pwd) grep grep && printf 2>/dev/null
+		readonly "$@" echo sed grep export x=1
+		sed "$@" done local echo "$1" x=1 "$@" && -eu grep sed "$1" &&
+		test ${HOME} x=1 readonly export 2>/dev/null
+		export readonly local ${HOME} awk then 2>/dev/null &&
+		grep then sed | /usr/bin x=1 local /usr/bin 'quoted text' "$1"
+		2>/dev/null x=1 done && && cd "$@" -eu
+		"$@" 2>/dev/null ${HOME} "$1" --verbose 'quoted text' 'quoted text' ${HOME}
+	'quoted text' export && test
+	readonly done -eu awk readonly readonly
+	local then test done "$1"
+		then $(pwd) echo /usr/bin && done test -eu /usr/bin export
+done "$1" grep 'quoted text' "$1"
+		sed local "$@" done local $(pwd)
+	awk 2>/dev/null && /usr/bin 2>/dev/null && sed "$@"
+		awk && cd export done printf local echo
+		$(pwd) test $(pwd) done test sed awk -eu echo
+	sed awk ${HOME} && echo
+	local 'quoted text' "$1" /usr/bin echo
+		$(pwd) /usr/bin "$1" cd && echo
+	x=1 'quoted text' --verbose test awk "$@" -eu ${HOME}
+	x=1 "$@" cd awk $(pwd) /usr/bin grep ${HOME} cd awk 'quoted text'
+	${HOME} local echo sed x=1 sed readonly 'quoted text' /usr/bin local | 'quoted text'
+x=1 sed /usr/bin /usr/bin sed readonly && "$1" 'quoted text'
+	echo "$@" export export done test local local
+	awk | export echo printf ${HOME} "$@" "$1" x=1 "$@" cd "$@" --verbose |
+		"$1" done then sed readonly printf export awk $(pwd) grep
+	readonly "$@" x=1 then readonly done $(pwd) && |
+	/usr/bin | export "$1" /usr/bin
+		test "$@" printf | local printf grep sed awk $(pwd) export 'quoted text' test done
+x=1 $(pwd) echo $(pwd) /usr/bin
+sed | $(pwd) 2>/dev/null "$1" echo awk /usr/bin ${HOME} awk
+		--verbose local -eu awk then local done 2>/dev/null "$@" | x=1 then 2>/dev/null
+	done done && && -eu 'quoted text' "$1" local /usr/bin "$@" test readonly
+${HOME} sed echo -eu sed $(pwd) | && export
+		"$@" "$1" $(pwd) readonly sed local
+	done done 'quoted text' -eu /usr/bin --verbose
+		printf then readonly then sed readonly grep grep $(pwd)
+	/usr/bin echo done printf 'quoted text'
+		export then "$1" cd readonly export 2>/dev/null $(pwd)
+		sed echo "$1" --verbose 2>/dev/null -eu sed grep grep 2>/dev/null readonly echo
+	2>/dev/null grep "$1" echo && test local 'quoted text'
+	grep 'quoted text' then awk /usr/bin cd && grep -eu
+	cd $(pwd) ${HOME} grep export then echo /usr/bin grep printf cd ${HOME}
+-eu sed /usr/bin printf echo echo printf readonly local local ${HOME}
+${HOME} grep then echo 'quoted text' 2>/dev/null 'quoted text'
+local x=1 sed x=1 | awk ${HOME} local -eu --verbose done then -eu local | done
+/usr/bin test test 'quoted text'
+	test done printf done 2>/dev/null "$@" --verbose printf
+"$@" && "$1" readonly -eu sed test printf sed 'quoted text' test --verbose printf
+		awk cd "$@" awk then then ${HOME} "$1" export "$@" echo
+		cd x=1 printf sed && | --verbose
+	test "$@" then "$@" sed ${HOME} printf 'quoted text' --verbose grep export "$1"
+grep "$@" && x=1 'quoted text'
+	done grep local cd export --verbose echo awk awk local local
+	sed local x=1 export test local done | x=1 2>/dev/null
+	printf export echo --verbose /usr/bin cd 2>/dev/null readonly
+	sed x=1 test --verbose 2>/dev/null $(pwd) 'quoted text' awk /usr/bin
+"$@" cd then awk $(pwd) && grep cd readonly then -eu
+readonly && readonly "$@" grep cd echo $(pwd) -eu readonly "$1" --verbose
+	'quoted text' -eu export && ${HOME} test
+echo cd readonly grep --verbose export 2>/dev/null "$1" | $(pwd)
+'quoted text' grep done --verbose done && cd ${HOME} 2>/dev/null
+	readonly && -eu ${HOME} echo then awk | --verbose printf readonly printf
+		&& /usr/bin 2>/dev/null done 2>/dev/null /usr/bin x=1 awk grep
+		&& 'quoted text' && && sed "$1" 'quoted text' /usr/bin
+		--verbose 2>/dev/null then "$1" grep | cd ${HOME}
+	'quoted text' awk "$@" --verbose echo awk /usr/bin printf sed
+	export export readonly echo cd --verbose readonly /usr/bin "$@" -eu
+	cd && "$1" cd ${HOME} -eu "$@" printf ${HOME} --verbose -eu export
+grep cd test 2>/dev/null printf "$@" /usr/bin readonly 2>/dev/null
+"$@" local sed printf ${HOME} awk echo local
+	2>/dev/null | $(pwd) printf
+'quoted text' x=1 "$1" grep grep /usr/bin local
+grep "$1" sed sed "$@" /usr/bin local | "$@" local ${HOME}
+		--verbose 'quoted text' 'quoted text' sed done sed | grep 2>/dev/null done grep
+--verbose "$@" "$1" -eu | awk echo sed x=1 export sed sed done sed | done sed cd
+		readonly test then 'quoted text' 2>/dev/null sed test then echo
+done sed 'quoted text' 'quoted text' --verbose 'quoted text' --verbose
+--verbose printf readonly &&
+	test 2>/dev/null /usr/bin local test -eu x=1 --verbose
+		export done 'quoted text' /usr/bin printf "$@" then
+		awk -eu test local cd "$@" 'quoted text' printf "$1" 'quoted text' 'quoted text'
+	echo done "$1" "$1" $(pwd) 2>/dev/null -eu /usr/bin x=1 grep
+		echo local sed "$1" 2>/dev/null sed
+	2>/dev/null "$1" | && -eu local
+		-eu -eu awk local test echo grep awk /usr/bin ${HOME}
+"$@" 2>/dev/null printf done export grep
+	cd echo printf done 2>/dev/null --verbose $(pwd) 2>/dev/null 2>/dev/null
+		done done test x=1 "$@" | then ${HOME} $(pwd) echo sed then "$@"
+		x=1 printf then 'quoted text' 'quoted text' 'quoted text' 'quoted text'
+	2>/dev/null export $(pwd) echo 2>/dev/null
+	| --verbose 2>/dev/null /usr/bin /usr/bin ${HOME} $(pwd)
+done "$1" --verbose grep
+	--verbose x=1 cd "$1" cd test
+	${HOME} && grep readonly "$@" export 'quoted text' $(pwd) echo cd 'quoted text'
+--verbose then export | /usr/bin 'quoted text'
+		sed 'quoted text' ${HOME}
+		echo sed 2>/dev/null 'quoted text'
+		-eu test grep awk x=1
+		export | cd $(pwd) | --verbose sed cd "$@"
+"$1" then test sed echo sed echo awk readonly
+	done grep | readonly --verbose export x=1 && local grep local
+-eu done grep echo | $(pwd) x=1 local /usr/bin | ${HOME} |
+		| "$1" -eu | | 2>/dev/null printf "$@" cd -eu
+		&& grep grep sed grep | /usr/bin awk "$1" 2>/dev/null
+		test /usr/bin sed -eu export x=1 echo /usr/bin x=1 grep local 2>/dev/null
+&& x=1 grep then --verbose test awk local echo --verbose readonly "$@"
+then printf grep 2>/dev/null /usr/bin -eu awk --verbose "$1" done
+${HOME} ${HOME} ${HOME} --verbose | && x=1 && grep | grep
+	$(pwd) --verbose "$1" awk ${HOME} echo
+		&& sed export | /usr/bin sed
+		cd 'quoted text' export --verbose --verbose sed && echo local $(pwd) 'quoted text'
+	"$1" x=1 echo echo sed cd -eu x=1 grep sed ${HOME} ${HOME} 2>/dev/null
+| then then | 'quoted text' echo && sed done test grep ${HOME} done
+2>/dev/null 'quoted text' /usr/bin printf
+		-eu "$1" -eu x=1 2>/dev/null $(pwd) 2>/dev/null export ${HOME} 2>/dev/null grep
+		sed done /usr/bin "$1" printf -eu "$1" | grep local then local
+		grep | -eu test --verbose "$@" 'quoted text'
+		cd echo local sed then && "$1" x=1 'quoted text' awk
+		"$@" sed echo | /usr/bin grep printf printf /usr/bin test
+		test local done grep /usr/bin | grep "$1" printf x=1 export "$@" export
+test "$1" grep x=1 awk
+	cd -eu cd test x=1 /usr/bin 'quoted text' then 'quoted text' "$1"
+--verbose echo "$@" cd awk && cd sed echo local "$@" local 'quoted text'
+awk --verbose 'quoted text' -eu "$@" x=1 x=1 2>/dev/null awk
+		2>/dev/null $(pwd) echo -eu awk
+		2>/dev/null 'quoted text' done then awk cd grep -eu readonly
+	x=1 /usr/bin echo echo then printf local "$@" ${HOME} test | awk then
+readonly "$@" export /usr/bin
+		done x=1 awk 2>/dev/null $(pwd) then ${HOME}
+		grep cd -eu printf awk sed echo ${HOME} $(pwd) sed export | awk --verbose cd cd
+sed "$1" -eu -eu cd printf printf | readonly -eu awk awk then test | awk
+		done sed 'quoted text' "$1" awk 'quoted text' ${HOME}
+		"$@" "$@" -eu --verbose printf "$@" 2>/dev/null printf awk echo x=1
+		echo "$@" "$@" local local cd grep export awk
+"$1" $(pwd) 2>/dev/null local echo then awk | grep
+		export then grep "$@" --verbose sed $(pwd) cd grep local 2>/dev/null
+	x=1 -eu /usr/bin "$@" grep x=1 readonly cd "$1" --verbose -eu x=1 then
+		grep awk -eu test $(pwd) printf
+	awk "$@" readonly "$@" -eu | | test -eu printf
+"$@" awk -eu then printf /usr/bin done done ${HOME} grep local
+	awk awk "$1" | grep printf x=1 $(pwd) cd x=1
+		then "$@" ${HOME} printf echo grep readonly printf 'quoted text' export
+		grep export cd readonly
+	${HOME} ${HOME} grep && -eu
+		--verbose -eu grep --verbose -eu 'quoted text'
+	$(pwd) awk test -eu test cd readonly
+then 2>/dev/null && --verbose ${HOME} echo -eu -eu x=1 ${HOME}
+2>/dev/null && export x=1 /usr/bin 'quoted text'
+		--verbose | local -eu /usr/bin test sed 'quoted text' readonly
+sed $(pwd) -eu 'quoted text' && then ${HOME} "$1" x=1 &&
+	printf sed "$1" done readonly
+	"$@" 'quoted text' sed
+		/usr/bin -eu then test export "$1" |
+	$(pwd) 2>/dev/null grep
+		2>/dev/null 2>/dev/null test sed $(pwd) done $(pwd)
+		then "$1" --verbose printf | echo
+		2>/dev/null grep | done
+test 'quoted text' local then x=1 cd | grep /usr/bin /usr/bin
+	-eu export export done /usr/bin x=1 --verbose then 2>/dev/null -eu awk
+local then | /usr/bin grep export 'quoted text' | then 'quoted text'
+export && awk | x=1 $(pwd) local | echo cd cd -eu /usr/bin | sed 'quoted text'
+		printf --verbose test cd ${HOME} "$1" -eu -eu export
+	sed | "$1" readonly $(pwd) then "$1"
+		sed then && ${HOME} printf sed cd | echo done local "$@" local
+	sed printf --verbose export && then "$1" test --verbose 2>/dev/null test done
+		cd then readonly grep -eu ${HOME}
+	sed "$@" -eu /usr/bin readonly echo
+	2>/dev/null x=1 x=1 echo 2>/dev/null echo "$@" -eu test 'quoted text' $(pwd)
+		awk ${HOME} awk echo local && then then
+	local && local readonly
+		'quoted text' -eu done x=1 done -eu echo x=1 "$@" grep echo /usr/bin
+		--verbose --verbose done cd /usr/bin grep 'quoted text' export
+		&& awk /usr/bin local
+done x=1 "$@" | then -eu done export |
+	--verbose $(pwd) | "$1" 'quoted text' sed
+	-eu --verbose local x=1 test awk grep export 'quoted text' readonly awk printf
+${HOME} export grep export grep /usr/bin
+		cd "$@" export awk | /usr/bin /usr/bin /usr/bin 2>/dev/null
+	-eu $(pwd) -eu 2>/dev/null 2>/dev/null /usr/bin && grep /usr/bin
+		done "$@" -eu "$1" "$1" "$@" awk -eu export $(pwd) readonly /usr/bin grep
+	grep | -eu ${HOME} done cd echo grep test "$@" "$1" export -eu test sed
+	export awk test "$1" && done grep printf "$1" echo
+$(pwd) -eu "$1" test -eu printf then grep "$@"
+'quoted text' export --verbose
+	readonly "$1" && grep && | awk 'quoted text' printf ${HOME} 'quoted text'
+${HOME} "$@" printf ${HOME} export
+		2>/dev/null $(pwd) sed test "$@" --verbose
+	awk grep awk 2>/dev/null x=1
+	$(pwd) /usr/bin local "$@" && ${HOME} 'quoted text' cd local printf cd then 2>/dev/null
+	'quoted text' --verbose local
+	local ${HOME} done test local -eu readonly
+	readonly "$@" grep readonly
+		readonly /usr/bin done sed 'quoted text' "$@" $(pwd) 'quoted text' local
+	| --verbose sed cd x=1 /usr/bin
+	test echo 'quoted text' ${HOME}
+	/usr/bin local done printf echo 2>/dev/null local echo readonly
+sed 2>/dev/null $(pwd) grep echo /usr/bin
+	"$1" awk x=1 readonly cd 2>/dev/null
+local cd 2>/dev/null | && x=1 done test | 2>/dev/null | done --verbose
+/usr/bin readonly -eu 'quoted text'
+		readonly x=1 $(pwd) /usr/bin && echo | then "$@" export /usr/bin
+--verbose grep export awk 2>/dev/null
+	printf done "$@" | "$@" 2>/dev/null "$1" echo cd grep 2>/dev/null
+		sed echo readonly /usr/bin grep sed
+	/usr/bin sed | /usr/bin printf "$1" /usr/bin
+--verbose 'quoted text' $(pwd) readonly grep 2>/dev/null | && x=1
+"$1" awk export sed ${HOME} ${HOME}
+	echo test awk --verbose $(pwd) sed -eu
+	'quoted text' readonly | "$1" | x=1 sed printf export local
+		/usr/bin then "$@" --verbose
+| && "$@" readonly readonly "$@" 2>/dev/null cd
+	-eu -eu --verbose done "$@"
+		2>/dev/null 2>/dev/null /usr/bin ${HOME} done -eu
+		'quoted text' printf done 2>/dev/null
+		grep ${HOME} /usr/bin | "$1" /usr/bin grep done test "$1" echo ${HOME}
+		"$@" -eu awk awk cd done done awk && readonly test 2>/dev/null ${HOME} $(pwd)
+	/usr/bin --verbose sed
+		'quoted text' -eu awk readonly 2>/dev/null /usr/bin $(pwd)
+	| 'quoted text' awk printf done --verbose sed readonly
+	/usr/bin grep 2>/dev/null grep --verbose $(pwd) /usr/bin local then grep && echo
+"$@" test x=1 ${HOME} printf readonly
+	&& export sed "$@" cd $(pwd) printf | grep sed local 2>/dev/null /usr/bin
+		sed printf test grep 2>/dev/null $(pwd)
+		echo --verbose && 2>/dev/null "$@"
+cd readonly $(pwd) | export sed -eu "$1" -eu 2>/dev/null local
+		x=1 grep "$1" --verbose then
+2>/dev/null done sed "$@" export 'quoted text' local && "$1" ${HOME}
+${HOME} printf grep -eu -eu 'quoted text' && $(pwd) | readonly
+		| grep cd echo 'quoted text' "$1"
+	local done awk test cd then ${HOME} | test done echo
+echo grep ${HOME} cd /usr/bin --verbose readonly then "$1" /usr/bin ${HOME}
+readonly "$1" $(pwd) test | && x=1 printf sed test then ${HOME} &&
+	2>/dev/null test then 2>/dev/null && sed
+--verbose /usr/bin --verbose ${HOME} grep && -eu ${HOME}
+then 'quoted text' && readonly test done readonly
+	x=1 echo done cd readonly --verbose sed
+		"$1" && sed export local --verbose readonly && printf
+	printf sed 'quoted text' cd awk done "$1" local ${HOME} 2>/dev/null -eu --verbose
+		printf test cd echo x=1 "$1" grep -eu -eu done "$@" cd --verbose
+	test test export x=1 done "$@" export -eu then /usr/bin then -eu
+		${HOME} sed awk export --verbose
+		"$@" readonly cd cd sed | $(pwd) x=1 readonly --verbose
+test "$1" local --verbose printf /usr/bin -eu $(pwd) $(pwd)
+	local readonly awk 2>/dev/null ${HOME} echo
+	local then 'quoted text' "$@" &&
+then && --verbose | && grep printf "$1" $(pwd) readonly ${HOME} "$1" grep 2>/dev/null
+		printf -eu 2>/dev/null then test sed done ${HOME} printf "$1" "$@"
+	awk sed export export && 'quoted text' cd
+	x=1 cd printf local | test then ${HOME} export --verbose test 'quoted text'
+		cd | printf sed test export awk cd "$1" readonly readonly 2>/dev/null cd 'quoted text'
+		cd | test $(pwd) 2>/dev/null ${HOME} then "$1" -eu --verbose grep printf grep
+		export test grep done sed "$1" echo printf
+	&& && -eu x=1 --verbose
+		x=1 $(pwd) readonly awk "$1" printf sed ${HOME} 2>/dev/null echo
+	2>/dev/null "$@" done "$@"
+'quoted text' "$1" 2>/dev/null "$@" 2>/dev/null /usr/bin
+	-eu then then test readonly $(pwd) grep echo $(pwd) 'quoted text'
+	test echo test local awk
+	then "$1" 'quoted text' readonly
+		"$1" x=1 grep test | awk grep "$@" --verbose test sed ${HOME}
+export printf grep $(pwd) -eu grep
+		"$@" && /usr/bin /usr/bin 'quoted text' 2>/dev/null awk 'quoted text' then
+done 'quoted text' sed $(pwd) cd x=1 x=1 awk export local /usr/bin /usr/bin 'quoted text'
+${HOME} done x=1 'quoted text' echo printf "$1" export
+		test done -eu readonly -eu printf awk cd
+		| awk awk echo "$1" 2>/dev/null grep $(pwd)
+echo $(pwd) 2>/dev/null /usr/bin local
+		/usr/bin done grep export echo export 2>/dev/null 'quoted text'
+${HOME} && --verbose sed ${HOME} "$@" done -eu test /usr/bin -eu ${HOME}
+echo "$1" $(pwd) printf -eu $(pwd) 2>/dev/null
+		'quoted text' 'quoted text' && && test && x=1 awk 2>/dev/null export
+	--verbose done --verbose test awk
+		local "$@" export | "$1" -eu test printf sed done 'quoted text' "$@"
+'quoted text' --verbose -eu awk 'quoted text'
+		readonly 2>/dev/null then local cd test 'quoted text' sed awk
+'quoted text' x=1 $(pwd) x=1 cd "$@" $(pwd)
+		test test "$@" | "$@" echo export export local export -eu 2>/dev/null
+	2>/dev/null printf awk echo printf export /usr/bin 'quoted text'
+sed sed printf "$1" local then
+-eu ${HOME} readonly readonly
+		readonly grep "$1" cd export /usr/bin "$1" export /usr/bin x=1
+/usr/bin sed then -eu -eu awk awk test -eu readonly -eu grep 'quoted text'
+	done awk sed export printf --verbose ${HOME} sed ${HOME} sed --verbose
+		x=1 "$1" sed 'quoted text' grep export "$@" grep then cd test cd ${HOME} "$@" |
+	export then done --verbose
+	then 'quoted text' local 2>/dev/null --verbose sed grep | printf readonly /usr/bin
+${HOME} export printf --verbose /usr/bin test | /usr/bin "$1" "$1" $(pwd) export
+	export test && 'quoted text' 'quoted text' --verbose local
+		&& export /usr/bin 'quoted text' "$1" grep | printf
+x=1 local printf printf "$@" 2>/dev/null awk then
+	/usr/bin 'quoted text'
+	readonly done cd "$@" 2>/dev/null
+		-eu ${HOME} ${HOME} local
+${HOME} test -eu -eu echo 'quoted text'
+		readonly "$@" "$1" 'quoted text' readonly 2>/dev/null
+grep && sed cd grep then printf local local "$1" $(pwd) ${HOME} awk --verbose
+	local x=1 printf "$@" ${HOME} then ${HOME}
+		x=1 /usr/bin cd sed then --verbose -eu echo awk $(pwd) grep $(pwd) x=1 export -eu
+	printf "$1" "$1" done readonly test
+		awk cd "$1" cd "$@" test printf grep grep printf local
+grep sed ${HOME} grep then "$1" readonly --verbose
+${HOME} ${HOME} $(pwd) /usr/bin readonly
+	cd 2>/dev/null 2>/dev/null && | cd
+		$(pwd) done local "$@" 2>/dev/null printf 'quoted text' /usr/bin 'quoted text'
+printf grep test awk cd "$1"
+	-eu echo done echo x=1 'quoted text'
+	-eu x=1 'quoted text' then --verbose done readonly
+| readonly export done sed done $(pwd)
+	then local sed grep -eu printf echo -eu
+		2>/dev/null test && &&
+		&& test awk printf -eu test cd --verbose printf awk 2>/dev/null
+$(pwd) && grep grep $(pwd) grep && export cd "$@" echo $(pwd)
+	echo "$1" -eu readonly "$1"
+"$@" "$1" printf readonly --verbose sed $(pwd) --verbose echo
+		| local done export awk sed
+	readonly awk cd readonly 'quoted text'
+		$(pwd) --verbose $(pwd) done awk grep then export readonly ${HOME} done echo
+		$(pwd) "$1" | "$1" done then printf
+x=1 sed test 2>/dev/null export sed && /usr/bin export -eu then | sed readonly
+	readonly 2>/dev/null --verbose
+		/usr/bin /usr/bin echo
+		test && --verbose cd -eu -eu then
+		"$1" /usr/bin --verbose
+		2>/dev/null printf then done grep done grep test readonly $(pwd) awk cd
+		--verbose ${HOME} awk printf local /usr/bin readonly cd "$@"
+	awk echo ${HOME} --verbose && export echo echo sed local test awk export
+x=1 awk test cd readonly --verbose x=1 --verbose --verbose
+	'quoted text' local echo echo && export "$1" --verbose
+| "$1" test grep "$@" grep ${HOME} sed awk done grep --verbose
+	--verbose ${HOME} ${HOME} cd -eu "$@"
+-eu done awk echo -eu local 'quoted text' test awk
+	export then x=1 export "$@" done awk | echo x=1 sed export &&
+	echo 'quoted text' --verbose echo
+	--verbose printf awk sed
+		-eu grep grep /usr/bin test cd --verbose done echo 2>/dev/null
+	awk export grep $(pwd) ${HOME}
+	${HOME} ${HOME} "$1" --verbose --verbose --verbose
+2>/dev/null x=1 done done 'quoted text'
+${HOME} export --verbose x=1
+	cd test done done -eu 2>/dev/null | $(pwd) done cd && | awk 2>/dev/null grep
+-eu readonly -eu test test 'quoted text' x=1 'quoted text' | "$@"
+	2>/dev/null --verbose && /usr/bin | printf "$1" grep && printf && -eu
+	local grep && cd "$1" 2>/dev/null x=1 grep then readonly --verbose -eu then x=1
+awk 2>/dev/null | "$@" local local
+"$1" test "$1" "$@" /usr/bin export $(pwd) 'quoted text' echo -eu test 2>/dev/null
+		grep ${HOME} sed "$1" export
+		grep -eu $(pwd) local test done grep ${HOME} /usr/bin
+	$(pwd) then sed -eu 'quoted text' cd 'quoted text' ${HOME}
+readonly done | echo printf /usr/bin
+	${HOME} && "$@" printf local test done printf
+	${HOME} printf "$@" sed grep test readonly local done test then
+	printf && test 2>/dev/null echo test x=1 && ${HOME} readonly -eu | "$1" printf
+		test printf && | /usr/bin ${HOME} test | $(pwd)
+local "$@" ${HOME} done "$1" grep done ${HOME} 'quoted text' printf
+		export done cd && test then test printf readonly readonly |
+done 'quoted text' readonly
+		printf ${HOME} 2>/dev/null
+local --verbose | then grep local -eu --verbose printf
+	grep export echo -eu cd printf 2>/dev/null && $(pwd)
+| 2>/dev/null grep && awk "$@" "$@" --verbose
+--verbose "$1" grep awk && done "$1" "$@" -eu printf
+		sed "$1" $(pwd) "$1" $(pwd) 2>/dev/null awk
+"$1" export done test 2>/dev/null echo --verbose
+		echo ${HOME} x=1 x=1 readonly awk cd "$@" ${HOME} 2>/dev/null 'quoted text'
+		cd /usr/bin x=1 sed printf | && /usr/bin $(pwd) --verbose sed test --verbose
+	grep readonly cd && "$1" $(pwd) test $(pwd) "$@" readonly readonly x=1 cd done
+		test | ${HOME} local done sed --verbose test
+--verbose done $(pwd) readonly
+	x=1 awk -eu awk ${HOME} echo readonly --verbose printf && 2>/dev/null test
+		'quoted text' local "$@" && export echo "$@" "$1" readonly && --verbose
+	$(pwd) --verbose x=1 cd echo readonly
+		readonly local grep --verbose awk &&
+'quoted text' 'quoted text' echo x=1 ${HOME} printf awk 'quoted text' sed
+		2>/dev/null $(pwd) &&
+"$@" then 2>/dev/null && done | then x=1 awk local |
+x=1 grep then 'quoted text' export 2>/dev/null local test | x=1
+/usr/bin x=1 printf /usr/bin done | sed
+	"$@" grep $(pwd) test
+2>/dev/null x=1 --verbose export /usr/bin "$@" printf echo sed 2>/dev/null
+		export 2>/dev/null 2>/dev/null -eu $(pwd) && --verbose -eu done awk | test
+		echo echo grep "$@" awk "$@"
+'quoted text' "$@" "$@" cd grep 2>/dev/null "$1" local printf 2>/dev/null cd
+		$(pwd) /usr/bin --verbose
+	2>/dev/null local done --verbose
+		--verbose "$1" ${HOME}
+&& cd sed done printf export
+		cd awk local -eu awk $(pwd) 2>/dev/null grep test test
+		readonly $(pwd) "$1" readonly "$@" cd -eu sed
+cd --verbose readonly 'quoted text' 'quoted text' sed /usr/bin then grep 'quoted text'
+		grep printf && done sed local --verbose
+| grep && then "$1" readonly $(pwd) $(pwd)
+sed awk "$1" sed ${HOME} readonly -eu
+sed echo printf 'quoted text'
+$(pwd) 2>/dev/null && awk
+| "$1" cd $(pwd) "$1" $(pwd) | "$1" 'quoted text'
+	grep cd 'quoted text' readonly test
+		echo awk readonly readonly echo readonly sed then printf "$1"
+x=1 x=1 test cd ${HOME} $(pwd) cd sed sed -eu
+		done $(pwd) --verbose /usr/bin /usr/bin /usr/bin
+		2>/dev/null test grep --verbose echo grep 'quoted text'
+		local echo then local local test local printf cd readonly $(pwd) "$@"
+		&& x=1 "$1" echo sed ${HOME} /usr/bin grep then then
+	readonly 2>/dev/null | sed printf "$@"
+	"$1" export "$1" "$1" /usr/bin local
+	grep readonly /usr/bin -eu
+	/usr/bin /usr/bin --verbose awk grep echo printf "$1" x=1 grep ${HOME} 'quoted text'
+		local 'quoted text' echo ${HOME} sed x=1 then local local "$@" printf export x=1
+	/usr/bin x=1 -eu awk x=1 grep
+then export ${HOME} $(pwd) 2>/dev/null -eu echo readonly awk local 'quoted text'
+		2>/dev/null printf /usr/bin export | 'quoted text' readonly export
+		$(pwd) ${HOME} x=1 test sed
+	then printf x=1 | sed done
+		2>/dev/null then export then /usr/bin "$@" cd ${HOME} --verbose --verbose
+2>/dev/null -eu awk cd grep /usr/bin 'quoted text' readonly awk cd awk then
+		export && | then sed sed x=1 "$1" echo
+		sed | then && ${HOME} ${HOME} awk grep
+	grep x=1 x=1 /usr/bin printf echo -eu "$1" /usr/bin test | test then
+		x=1 x=1 cd 2>/dev/null
+		/usr/bin --verbose grep echo "$@" | awk "$1" "$@" then
+export x=1 readonly 'quoted text' cd "$1"
+		2>/dev/null "$1" --verbose
+		-eu done grep ${HOME} export "$@" ${HOME} && cd $(pwd) readonly
+	x=1 printf 2>/dev/null test export grep --verbose | && cd export $(pwd)
+printf cd && && -eu | -eu export sed
+		cd awk sed x=1 -eu --verbose && local readonly
+then sed done 'quoted text' | cd "$@" test "$@" /usr/bin echo
+--verbose && sed ${HOME} then then grep --verbose export "$@"
+	readonly 2>/dev/null "$@" test /usr/bin ${HOME} && 'quoted text' done --verbose
+		done $(pwd) /usr/bin 2>/dev/null done
+--verbose sed "$1" sed "$1" "$1" cd
+	2>/dev/null printf "$1" done printf "$@" x=1
+		$(pwd) 2>/dev/null echo | ${HOME} printf echo done local
+	"$1" test /usr/bin && test printf 2>/dev/null | export
+"$1" grep $(pwd) && ${HOME} export test 'quoted text' &&
+	readonly readonly readonly
+		export --verbose ${HOME} 2>/dev/null sed sed done sed -eu "$@" 'quoted text' sed
+	done && local test printf 2>/dev/null && 'quoted text'
+		&& 'quoted text' grep ${HOME}
+2>/dev/null readonly "$@" x=1 $(pwd) ${HOME} cd && x=1 /usr/bin then
+'quoted text' local "$@" test
+	export sed --verbose "$1" 'quoted text' test echo cd /usr/bin printf "$@" printf
+export export test /usr/bin done ${HOME}
+done x=1 echo awk export "$1"
+2>/dev/null /usr/bin "$1" sed
+		echo -eu --verbose test export
+		readonly export && /usr/bin local sed echo $(pwd) awk
+export awk x=1 done 'quoted text' "$@" export then | ${HOME} $(pwd)
+test x=1 sed ${HOME} test local
+	2>/dev/null cd local -eu "$@" 2>/dev/null "$@"
+		readonly -eu test printf printf awk then 'quoted text' x=1
+	-eu 2>/dev/null test grep export cd awk local done awk ${HOME} awk --verbose
+awk | printf then | cd cd -eu
+printf "$@" $(pwd) then cd && "$1" ${HOME} | /usr/bin "$1" 'quoted text'
+| done sed /usr/bin 2>/dev/null
+readonly grep echo sed && ${HOME} readonly awk awk 'quoted text'
+		x=1 test | grep 'quoted text' printf then
+		&& | "$@" ${HOME} "$@" test grep then $(pwd) /usr/bin done grep $(pwd)
+		cd done -eu $(pwd) readonly grep echo ${HOME} export
+		readonly sed test grep readonly awk "$1" $(pwd)
+	awk -eu 'quoted text'
+x=1 "$1" readonly "$@" --verbose
+	local $(pwd) x=1 2>/dev/null x=1 awk printf sed grep "$@" printf ${HOME} test echo
+echo ${HOME} sed $(pwd) 'quoted text' test 'quoted text' "$@" awk $(pwd) echo
+		-eu cd --verbose --verbose then readonly 2>/dev/null cd
+"$@" readonly awk echo x=1 readonly "$@" cd
+local test 2>/dev/null "$1" | awk export sed x=1 --verbose export
+	echo then 'quoted text' "$1" sed done readonly "$@" |
+	cd then awk grep x=1 grep readonly readonly sed cd then
+		| 2>/dev/null grep local --verbose
+	grep 2>/dev/null test done
+		${HOME} | "$@" $(pwd) readonly -eu readonly -eu test cd readonly awk $(pwd)
+	${HOME} /usr/bin x=1 'quoted text' readonly | -eu printf
+		/usr/bin cd 2>/dev/null 2>/dev/null awk local local 'quoted text'
+| done done local "$@" export ${HOME}
+		2>/dev/null local --verbose done cd /usr/bin ${HOME}
+	--verbose --verbose 2>/dev/null && "$1" "$1"
+	cd 'quoted text' sed $(pwd) then "$1" x=1 printf
+	printf export -eu awk readonly ${HOME} awk grep echo /usr/bin grep "$1" 'quoted text'
+		--verbose -eu readonly cd && -eu awk sed
+${HOME} done export 2>/dev/null
+/usr/bin "$@" ${HOME} 'quoted text' "$@" export 'quoted text'
+		grep done /usr/bin cd -eu then /usr/bin
+		test awk done printf readonly /usr/bin printf local 2>/dev/null
+		test awk echo readonly sed ${HOME} "$1" awk /usr/bin readonly && x=1 grep
+		$(pwd) "$@" && --verbose sed grep | x=1 sed cd x=1 "$@" 2>/dev/null /usr/bin
+$(pwd) grep --verbose done && /usr/bin
+	export --verbose | ${HOME} done printf ${HOME} echo grep x=1 $(pwd) cd
+local grep 2>/dev/null
+		done --verbose "$1" cd then | x=1 "$@" 2>/dev/null -eu test done "$@" --verbose
+local | awk readonly 'quoted text'
+$(pwd) export then printf ${HOME} export
+		sed grep --verbose 2>/dev/null
+2>/dev/null -eu export $(pwd)
+echo done export x=1 test local /usr/bin 'quoted text' echo -eu
+	grep printf readonly && export x=1 local then grep done "$@"
+local "$1" "$@" grep test x=1 $(pwd)
+	sed echo $(pwd) export x=1 "$@" 'quoted text'
+| ${HOME} awk test && grep done "$@" "$@" done done done
+	awk --verbose readonly then then export
+		then x=1 local cd sed ${HOME} 2>/dev/null sed 'quoted text' printf readonly
+"$1" awk then sed export export
+$(pwd) /usr/bin /usr/bin -eu && --verbose export grep ${HOME} then 2>/dev/null
+$(pwd) awk export cd local awk cd readonly grep | local $(pwd) $(pwd) then
+		&& ${HOME} readonly 2>/dev/null ${HOME} 'quoted text' && | done 2>/dev/null done
+		x=1 cd $(pwd) export done ${HOME} $(pwd) 'quoted text'
+2>/dev/null local "$@" x=1 readonly
+readonly | | then | echo
+--verbose echo --verbose then 2>/dev/null
+"$1" local printf printf printf -eu grep cd readonly test readonly "$1"
+	export printf --verbose "$1" $(pwd)
+readonly /usr/bin | done sed /usr/bin -eu /usr/bin $(pwd) awk -eu then
+	then "$@" 2>/dev/null done cd readonly
+/usr/bin then local export then -eu cd echo printf ${HOME} then
+		printf "$@" export sed | ${HOME} export 'quoted text'
+readonly 2>/dev/null "$1" x=1 'quoted text' export && --verbose
+	'quoted text' $(pwd) done local | --verbose readonly
+	then readonly readonly | readonly then done grep 'quoted text' x=1 | done local
+	| echo -eu x=1 x=1 cd readonly ${HOME} $(pwd)
+--verbose sed -eu 2>/dev/null 'quoted text' then
+		| x=1 printf $(pwd) cd -eu x=1 sed
+x=1 cd /usr/bin awk | && grep --verbose export "$1" /usr/bin $(pwd) && local sed
+	export --verbose printf test ${HOME} grep done /usr/bin readonly grep done
+'quoted text' | test ${HOME} --verbose
+		printf | sed then done ${HOME} 2>/dev/null "$1" test cd ${HOME} "$@"
+done --verbose "$@" -eu sed echo done printf $(pwd) ${HOME} ${HOME}
+printf -eu readonly 'quoted text' "$1" $(pwd)
+		${HOME} "$@" test --verbose cd grep 'quoted text'
+	printf 2>/dev/null cd export done "$1" grep done --verbose
+		"$@" -eu printf ${HOME} ${HOME} then $(pwd) echo 2>/dev/null
+		${HOME} -eu awk 'quoted text' printf 2>/dev/null
+then --verbose -eu | && readonly -eu /usr/bin grep then then "$@"
+grep awk local awk --verbose readonly ${HOME} cd local && ${HOME} "$@" export
+		x=1 awk --verbose "$1" local $(pwd) ${HOME} echo printf awk sed
+	awk && test cd local /usr/bin $(pwd) ${HOME}
+		'quoted text' $(pwd) grep 'quoted text' 'quoted text' cd $(pwd) "$@"
+local /usr/bin sed awk local x=1 x=1 export grep x=1 | done awk
+		2>/dev/null then echo ${HOME} | | | "$@"
+	cd then -eu test cd local export test readonly ${HOME} test 2>/dev/null
+	sed grep cd ${HOME} printf -eu echo "$@" --verbose $(pwd) done awk printf
+	sed "$@" then sed export | && && --verbose -eu ${HOME} --verbose sed test sed |
+	--verbose done "$@" --verbose then
+	awk /usr/bin x=1 /usr/bin 'quoted text' $(pwd) 'quoted text' ${HOME}
+awk readonly ${HOME}
+	x=1 ${HOME} awk | ${HOME} awk && -eu $(pwd)
+printf cd cd --verbose sed cd sed 'quoted text'
+echo 2>/dev/null local export --verbose echo readonly
+/usr/bin 2>/dev/null local /usr/bin ${HOME} -eu --verbose
+		export readonly awk /usr/bin 'quoted text' | $(pwd) cd export
+		${HOME} "$@" sed awk cd cd && local awk done ${HOME} $(pwd) "$1" then test x=1 'quoted text'
+		"$1" ${HOME} "$1" "$@" awk && "$1" readonly | "$1"
+		then "$1" printf -eu sed x=1 readonly printf cd "$@" export --verbose printf
+		"$@" then -eu -eu grep then 'quoted text' /usr/bin then readonly 'quoted text'
+		'quoted text' "$1" cd /usr/bin &&
+awk sed done export cd --verbose
+		echo test && printf $(pwd) grep ${HOME} $(pwd) done done "$1"
+		printf local "$1" local export awk done echo grep sed export x=1 ${HOME}
+		echo && awk cd export cd printf | then $(pwd)
+	printf cd export test --verbose test /usr/bin local then -eu --verbose
+	local then x=1 /usr/bin -eu grep grep printf local sed test grep done awk
+	echo grep echo 'quoted text' awk echo grep | printf then -eu "$1"
+	sed -eu "$1" then /usr/bin readonly -eu "$1" grep cd printf -eu test
+	export ${HOME} -eu 2>/dev/null
+test 2>/dev/null && -eu 2>/dev/null 2>/dev/null grep 'quoted text' grep
+	awk readonly | printf -eu /usr/bin local grep export
+		printf x=1 "$1" grep "$@" done grep "$1" awk echo done $(pwd)
+x=1 then -eu "$@" echo $(pwd) export "$@" $(pwd) grep export --verbose
+		${HOME} sed export "$@" printf local export
+		x=1 printf --verbose $(pwd) | "$1" ${HOME} --verbose cd -eu grep readonly
+		"$1" cd export $(pwd) && && 'quoted text'
+	$(pwd) printf && readonly readonly "$1" done
+		$(pwd) -eu echo "$@" && cd -eu ${HOME}
+2>/dev/null echo grep grep
+	grep -eu then sed export done readonly grep
+printf printf && "$1" readonly test awk -eu export test cd test awk /usr/bin
+readonly ${HOME} --verbose cd echo "$@" local "$1" && "$@" "$1" awk --verbose
+		local cd cd grep -eu | x=1 x=1 readonly sed | --verbose readonly $(pwd)
+		--verbose "$1" export x=1 readonly | -eu done "$1" test cd done ${HOME} 'quoted text'
+		"$1" 'quoted text' then echo cd then | sed then "$@" printf && "$1"
+	"$1" ${HOME} local grep && printf local awk "$1" -eu
+export awk cd then done -eu "$1" awk then echo test echo ${HOME}
+/usr/bin sed "$@" $(pwd) awk && test "$1" && cd 2>/dev/null
+"$@" 2>/dev/null test 'quoted text' 'quoted text'
+	local 2>/dev/null local -eu readonly export 2>/dev/null 'quoted text'
+/usr/bin then /usr/bin export
+		-eu local awk $(pwd) "$@" -eu $(pwd) export
+	local readonly export --verbose readonly ${HOME} "$@"
+| 2>/dev/null -eu $(pwd) /usr/bin cd "$1" then awk 2>/dev/null
+		-eu "$@" export local echo x=1 "$1" && sed awk 'quoted text'
+"$@" printf then "$@" -eu sed
+	test cd echo echo local echo 'quoted text' done
+$(pwd) ${HOME} /usr/bin then then "$@"
+	grep 'quoted text' then done awk -eu grep cd sed test /usr/bin sed
+	test printf 2>/dev/null | ${HOME} 2>/dev/null
+	sed readonly "$1" grep test cd grep printf 2>/dev/null
+	${HOME} x=1 cd 2>/dev/null export
+cd | test printf printf awk ${HOME} cd && echo $(pwd) test
+	then "$@" "$@" cd cd $(pwd) ${HOME} -eu "$1" | --verbose 'quoted text'
+echo export local test x=1 local "$1" "$@" --verbose awk cd echo sed && /usr/bin
+'quoted text' then local
+	| x=1 sed 'quoted text'
+	readonly "$1" done --verbose /usr/bin
+		"$1" /usr/bin then $(pwd) /usr/bin "$1" grep test "$@"
+		done printf --verbose local -eu "$@"
+	test local awk 2>/dev/null --verbose done 2>/dev/null
+		then sed readonly printf then grep
+x=1 then --verbose printf $(pwd) cd readonly
+	$(pwd) echo "$@" then
+	${HOME} ${HOME} 2>/dev/null
+awk $(pwd) grep "$1" | --verbose
+	echo 'quoted text' echo printf x=1 /usr/bin test printf awk cd awk test /usr/bin
+	&& test | ${HOME} sed done -eu printf export test | --verbose printf x=1
+		echo "$@" | "$@" test 2>/dev/null -eu export -eu $(pwd)
+local --verbose grep /usr/bin local /usr/bin 'quoted text' printf
+'quoted text' printf "$1" cd done printf --verbose done printf && &&
+"$@" --verbose /usr/bin awk
+	-eu | $(pwd) done awk -eu export -eu export readonly
+		x=1 grep -eu && | ${HOME} --verbose --verbose && done grep
+		sed sed awk ${HOME} readonly
+	done "$@" grep test export x=1
+sed test export --verbose /usr/bin awk echo sed echo "$1" x=1 cd | /usr/bin
+	${HOME} $(pwd) printf x=1 && export done readonly 2>/dev/null test "$@" done |
+	readonly $(pwd) /usr/bin awk export
+sed "$1" && local echo readonly
+| | 2>/dev/null then | 2>/dev/null --verbose done awk done awk echo export "$@"
+	--verbose 'quoted text' | --verbose $(pwd)
+		test printf ${HOME} awk then x=1 "$@"
+2>/dev/null /usr/bin echo 'quoted text'
+x=1 | test export ${HOME} x=1 "$1" done "$@" done --verbose x=1 --verbose done
+		"$1" "$@" "$@" --verbose && "$1" "$@" printf
+local export 'quoted text' sed awk done test awk "$@" test -eu printf
+	| --verbose printf "$@" "$@" export /usr/bin "$1" ${HOME}
+grep /usr/bin readonly -eu sed $(pwd) cd /usr/bin | export then
+		then cd local cd cd grep -eu --verbose export sed "$1" && $(pwd)
+	-eu cd --verbose grep local cd 'quoted text' awk done && grep test done grep
+	export --verbose && sed x=1 && readonly export x=1 readonly $(pwd) $(pwd)
+		awk | --verbose x=1 | 2>/dev/null "$@" printf test ${HOME} 'quoted text' "$1"
+		then done test cd export $(pwd) x=1 then then done sed sed done
+		"$1" awk local cd echo "$@" 2>/dev/null done done 2>/dev/null awk | "$1"
+		export ${HOME} cd /usr/bin $(pwd) echo "$1" ${HOME} x=1 readonly printf
+${HOME} printf done -eu -eu readonly 'quoted text' "$@"
+		"$@" readonly export && /usr/bin
+		echo -eu x=1 awk "$1"
+	awk 'quoted text' -eu |
+		test && export /usr/bin export local 'quoted text' --verbose "$@" done 2>/dev/null
+"$1" grep grep then 2>/dev/null then
+		echo grep done export $(pwd) sed "$1" 'quoted text' grep
+sed local done x=1 | --verbose export -eu --verbose
+	sed 'quoted text' then then
+	printf $(pwd) x=1 "$1" && /usr/bin
+	export then grep awk cd && ${HOME} ${HOME}
+-eu 2>/dev/null -eu export && test readonly export export x=1 |
+	x=1 sed sed echo x=1 echo
+x=1 'quoted text' && && printf test
+		printf $(pwd) test -eu 'quoted text' ${HOME} local printf
+	export /usr/bin 2>/dev/null grep /usr/bin
+cd grep ${HOME} done sed sed awk
+	done --verbose printf test export done printf test
+'quoted text' then /usr/bin test $(pwd) $(pwd)
+		sed /usr/bin export test echo cd x=1 then ${HOME} done $(pwd) test
+	&& --verbose grep echo sed "$1" awk printf x=1 'quoted text' cd awk --verbose |
+		-eu && ${HOME} "$1" grep then
+awk export sed readonly done 2>/dev/null
+		"$@" "$1" sed "$1" "$@" -eu 2>/dev/null 'quoted text'
+'quoted text' 2>/dev/null local 2>/dev/null --verbose ${HOME} awk ${HOME}
+echo readonly $(pwd) ${HOME}
+	'quoted text' then "$@" x=1 cd ${HOME} --verbose
+export done -eu cd export | | readonly "$@" export awk -eu --verbose export
+		test x=1 -eu -eu readonly test cd done export readonly cd test "$1" "$@" awk x=1
+$(pwd) $(pwd) test "$1"
+		readonly export -eu echo printf "$1" ${HOME} && -eu then then
+		x=1 cd export readonly 2>/dev/null 'quoted text' --verbose --verbose then grep
+	${HOME} "$@" then grep sed -eu &&
+		echo 'quoted text' export && ${HOME} sed sed && --verbose
+	echo local $(pwd) local "$@" test printf echo printf 'quoted text'
+'quoted text' 'quoted text'
+$(pwd) then cd --verbose 2>/dev/null "$@" local cd export printf $(pwd) $(pwd) export
+		-eu | printf 'quoted text' 'quoted text' 'quoted text'
+	test awk grep --verbose test | done sed echo 2>/dev/null local
+	sed printf awk cd done x=1 2>/dev/null readonly awk printf local
+	export $(pwd) 'quoted text' then sed "$@" ${HOME} grep 2>/dev/null test ${HOME}
+		cd "$@" ${HOME} cd x=1 | done x=1 export | 'quoted text' | /usr/bin "$1"
+		done --verbose sed cd x=1 grep
+	awk printf awk cd -eu ${HOME} /usr/bin
+	printf done printf ${HOME} cd grep 'quoted text'
+then awk then printf grep 2>/dev/null x=1
+	grep | 2>/dev/null $(pwd) 'quoted text'
+/usr/bin echo local awk "$@" $(pwd)
+		| --verbose readonly | cd | x=1 export $(pwd) echo done ${HOME} /usr/bin printf
+	/usr/bin grep x=1 sed cd 2>/dev/null cd "$1" echo readonly
+	--verbose printf "$@"
+		&& printf awk awk "$@" --verbose --verbose export x=1 printf "$@" awk
+awk local printf "$1" x=1 test
+	printf printf export ${HOME} 'quoted text'
+	done export "$@" done --verbose x=1 x=1 awk |
+		"$@" then -eu then printf sed --verbose local --verbose grep printf 2>/dev/null
+	echo && $(pwd) "$@" test "$1" grep test "$@" "$1" echo cd echo
+${HOME} sed x=1 sed /usr/bin -eu x=1 && readonly --verbose awk
+	$(pwd) sed local | "$1" 2>/dev/null export && && && export 2>/dev/null /usr/bin
+	'quoted text' export done local grep "$1" echo export done
+	sed $(pwd) cd cd printf --verbose cd grep test
+		cd | readonly echo local | && "$1"
+		local readonly export sed
+		awk grep ${HOME} | cd | cd /usr/bin
+sed --verbose 'quoted text' $(pwd) readonly readonly sed --verbose 'quoted text'
+done then export | done --verbose
+local /usr/bin grep sed grep readonly then "$@" awk | $(pwd) test "$@"
+		&& $(pwd) done --verbose export -eu export then ${HOME} /usr/bin x=1 --verbose
+sed awk x=1 then readonly export $(pwd) /usr/bin
+		cd echo --verbose -eu /usr/bin then echo readonly x=1 then done $(pwd) --verbose
+	echo then --verbose grep $(pwd) export readonly local "$@" export
+		export awk "$@" done
+	-eu done cd 'quoted text' export 2>/dev/null readonly export cd -eu done 'quoted text'
+	-eu echo ${HOME} readonly x=1
+		${HOME} local test -eu printf grep done readonly "$1" 2>/dev/null local then
+		$(pwd) 2>/dev/null then grep 2>/dev/null awk test then ${HOME} cd grep
+		${HOME} ${HOME} 'quoted text' echo printf 2>/dev/null then sed local -eu -eu ${HOME}
+		&& then "$@" "$1" local
+		sed 'quoted text' -eu --verbose sed done done printf printf readonly
+export "$1" awk --verbose "$@" && echo cd printf
+		cd /usr/bin 'quoted text' local 'quoted text' local -eu "$@" -eu then "$@" grep
+	test | then && printf && echo --verbose done
+then readonly -eu awk readonly $(pwd) /usr/bin /usr/bin
+		cd export --verbose sed done
+		sed 'quoted text' | cd 2>/dev/null ${HOME} | 'quoted text'
+		$(pwd) done awk printf -eu ${HOME} local $(pwd)
+	"$@" $(pwd) cd -eu && then export awk printf && --verbose -eu -eu export export
+grep --verbose ${HOME} sed test 2>/dev/null cd | grep --verbose
+		2>/dev/null -eu -eu /usr/bin 'quoted text' --verbose ${HOME} $(pwd) local ${HOME}
+--verbose printf | && "$1" awk $(pwd) then echo sed then | "$@" $(pwd) echo sed
+	readonly sed export && local 2>/dev/null
+		--verbose && --verbose 'quoted text' then echo done -eu | printf local
+	then sed 'quoted text' then grep grep | sed && "$1" /usr/bin done x=1
+done $(pwd) printf cd printf readonly ${HOME} /usr/bin -eu $(pwd) ${HOME} && then
+	test x=1 then "$1" x=1 printf echo then export 2>/dev/null local grep
+		awk ${HOME} readonly 'quoted text' test cd /usr/bin awk printf then | sed sed
+		$(pwd) grep cd | cd 2>/dev/null echo -eu echo x=1 grep
+sed $(pwd) cd "$1" grep printf 'quoted text' export test x=1
+	x=1 ${HOME} awk | "$1"
+		2>/dev/null | then 'quoted text' export $(pwd) test /usr/bin
+	2>/dev/null "$@" printf echo done export export
+&& grep awk && 'quoted text' x=1 done /usr/bin readonly
+	grep && local --verbose local readonly 2>/dev/null 2>/dev/null -eu export test
+	&& local | awk | ${HOME} cd $(pwd) -eu cd then /usr/bin
+		sed echo printf $(pwd) | $(pwd) && "$@" done x=1 readonly echo
+	--verbose | then x=1 export export printf
+-eu && test x=1 readonly "$1" echo
+$(pwd) 2>/dev/null printf "$1" export -eu
+--verbose local grep -eu test test export grep cd awk then then grep
+	"$@" export && sed --verbose
+		x=1 "$@" local test test "$@"
+	local cd && echo printf
+		"$1" echo && grep $(pwd) ${HOME} readonly grep /usr/bin
+done done ${HOME} "$1" grep printf 2>/dev/null /usr/bin | "$1"
+-eu export test test then local | | "$1" printf cd && 2>/dev/null /usr/bin
+--verbose grep echo | && ${HOME} export sed /usr/bin then -eu $(pwd)
+--verbose ${HOME} local sed x=1 && printf
+	--verbose sed x=1 | --verbose
+		--verbose test sed /usr/bin readonly echo export "$1" "$@"
+readonly sed -eu test local test local
+	then | && done grep -eu local export printf done echo "$1" export sed export
+--verbose x=1 --verbose echo /usr/bin "$1" export 2>/dev/null && echo sed then
+		--verbose cd x=1 then --verbose 'quoted text'
+	then "$1" | 'quoted text' 'quoted text' /usr/bin readonly done printf 2>/dev/null
+		export grep | -eu "$@" $(pwd)
+x=1 'quoted text' then printf done /usr/bin -eu "$1" readonly
+	$(pwd) 2>/dev/null 'quoted text' "$1" awk --verbose readonly sed 2>/dev/null
+/usr/bin done $(pwd) local
+	x=1 'quoted text' awk export then cd export ${HOME} then local echo readonly
+$(pwd) test | "$@" grep readonly x=1 x=1 sed /usr/bin export x=1 x=1 --verbose
+done $(pwd) readonly echo awk ${HOME}
+	printf then awk then readonly test | $(pwd) done echo $(pwd) $(pwd) ${HOME}
+printf | -eu | grep test then $(pwd) grep && test /usr/bin
+	echo --verbose export grep ${HOME} cd
+x=1 /usr/bin && "$@" x=1 --verbose && export
+		printf ${HOME} | $(pwd) echo x=1 done $(pwd) sed cd ${HOME} | sed echo awk awk
+done | echo 2>/dev/null
+		grep 'quoted text' "$@" 'quoted text' then ${HOME} "$1"
+cd sed done && grep readonly sed
+done /usr/bin cd 'quoted text' cd sed -eu -eu ${HOME} /usr/bin local
+local then printf && done x=1
+		&& && printf --verbose echo test "$@" && 'quoted text' 'quoted text'
+	export x=1 sed printf
+/usr/bin $(pwd) then local $(pwd) ${HOME} grep done -eu $(pwd)
+local sed printf sed /usr/bin --verbose 2>/dev/null -eu 2>/dev/null 'quoted text'
+	local then ${HOME} export && && $(pwd) 'quoted text' printf | awk $(pwd)
+	awk sed | x=1 'quoted text' 'quoted text' grep
+		then local 2>/dev/null then 'quoted text' --verbose
+		test x=1 /usr/bin "$1" then echo 2>/dev/null
+		export --verbose then --verbose "$1" test local test test x=1 printf
+export /usr/bin export $(pwd) printf x=1 grep done $(pwd) ${HOME} then && $(pwd)
+		/usr/bin test /usr/bin local grep ${HOME} "$@"
+	export cd grep /usr/bin /usr/bin x=1 x=1 $(pwd) $(pwd) | x=1 printf 2>/dev/null
+echo /usr/bin then $(pwd) printf ${HOME} x=1 "$1" local grep grep readonly &&
+	printf done --verbose export /usr/bin 'quoted text'
+	&& grep 2>/dev/null $(pwd) x=1 local awk ${HOME} local
+		x=1 readonly | && 2>/dev/null echo $(pwd)
+	"$@" awk echo -eu then && /usr/bin ${HOME}
+"$@" printf printf local export 'quoted text' export awk local grep
+	| $(pwd) cd -eu then cd $(pwd) x=1 /usr/bin $(pwd)
+		'quoted text' --verbose local ${HOME} echo export "$1"
+	local grep "$1" grep sed sed sed $(pwd)
+2>/dev/null /usr/bin local "$1" 2>/dev/null | ${HOME} x=1 awk echo then
+$(pwd) awk "$1" --verbose | sed 2>/dev/null
+${HOME} /usr/bin test "$1" readonly 'quoted text' export
+		'quoted text' 'quoted text' 'quoted text' cd cd
+$(pwd) "$@" grep done --verbose 'quoted text' readonly export /usr/bin
+	printf $(pwd) done sed x=1 echo test $(pwd) | export sed x=1 x=1 | done local
+		| ${HOME} export "$1" readonly local awk "$1" -eu "$1" | echo cd export | export
+sed then cd export done /usr/bin && export | "$1" /usr/bin /usr/bin "$@" printf
+	test 'quoted text' grep ${HOME} readonly &&
+		readonly done awk 'quoted text' readonly export echo | --verbose
+	cd /usr/bin echo ${HOME} $(pwd) 2>/dev/null x=1 export readonly export x=1 export
+		2>/dev/null && test echo x=1 readonly test sed cd 2>/dev/null
+		local | "$1" sed grep grep 2>/dev/null "$1" "$1" 'quoted text'
+export --verbose --verbose then test readonly --verbose 2>/dev/null
+		${HOME} ${HOME} grep then export 2>/dev/null && -eu
+		"$1" x=1 test x=1 grep "$1" readonly "$1" x=1
+-eu export ${HOME} 'quoted text' then x=1 test ${HOME} test "$1"
+	local 'quoted text' -eu export done "$@"
+'quoted text' sed 'quoted text' export 2>/dev/null
+grep readonly /usr/bin done grep --verbose cd grep && printf
+		${HOME} readonly export done local printf local "$@" 'quoted text'
+done echo then test awk -eu x=1 --verbose awk --verbose printf
+		$(pwd) | grep 'quoted text' "$@" echo -eu cd sed | local "$1"
+local export echo && cd 2>/dev/null "$1" ${HOME} echo
+export grep then then "$@"
+test "$1" cd printf "$@" echo /usr/bin --verbose cd then -eu
+export cd test x=1 --verbose done | &&
+		readonly readonly test
+	then /usr/bin export export echo "$@" x=1 readonly 2>/dev/null local
+	local x=1 awk grep 'quoted text'
+		${HOME} "$@" then -eu readonly
+		cd $(pwd) 'quoted text' cd $(pwd) 2>/dev/null grep && test readonly printf
+grep --verbose local /usr/bin 2>/dev/null ${HOME} test --verbose
+		sed printf echo done ${HOME} cd --verbose grep echo export &&
+		&& readonly 'quoted text' $(pwd) -eu "$@" done /usr/bin sed x=1 -eu done printf
+x=1 export --verbose test readonly && then export readonly sed 2>/dev/null
+		2>/dev/null sed -eu x=1 done sed && then "$1" x=1 cd then awk x=1 $(pwd) 'quoted text'
+	awk awk export ${HOME} readonly $(pwd) readonly --verbose $(pwd) echo export
+then echo done test sed
+	echo echo 'quoted text' readonly
+		grep /usr/bin then printf
+	x=1 done 'quoted text' && 'quoted text'
+		-eu local then 'quoted text' && done awk
+	x=1 grep "$1" 2>/dev/null
+grep cd -eu -eu | | $(pwd) echo awk export $(pwd) /usr/bin then
+'quoted text' && && cd |
+	export awk done x=1 done ${HOME} local | /usr/bin x=1 readonly grep
+	-eu printf 2>/dev/null 2>/dev/null grep sed
+		test awk readonly --verbose test
+	-eu "$@" | awk awk $(pwd)
+x=1 readonly --verbose sed grep export local
+		$(pwd) sed --verbose 'quoted text' 2>/dev/null done | $(pwd)
+	| x=1 test ${HOME} --verbose then 2>/dev/null export printf "$@" sed
+	/usr/bin $(pwd) | printf && $(pwd) --verbose -eu echo
+	done && | $(pwd) /usr/bin "$@" then grep x=1 export /usr/bin
+| grep local x=1 -eu | $(pwd) 'quoted text' $(pwd) printf
+		&& "$@" done done && /usr/bin && 2>/dev/null local | | /usr/bin then cd "$@"
+&& cd then grep grep ${HOME} x=1 printf done
+		awk 'quoted text' awk | --verbose x=1
+done done echo x=1 done x=1 echo
+grep --verbose "$@" && x=1
+-eu export --verbose export 'quoted text' printf
+		cd $(pwd) grep 'quoted text' "$@" local
+	export -eu --verbose 2>/dev/null done -eu x=1
+-eu awk grep x=1 2>/dev/null 'quoted text' && printf echo
+		local | && printf done printf done x=1 ${HOME}
+		"$1" && "$1" "$@" printf cd export "$@"
+&& 'quoted text' 'quoted text' grep 'quoted text'
+		-eu x=1 ${HOME} --verbose "$1" printf grep
+		echo && --verbose x=1 "$1" "$1" && echo -eu
+		done cd readonly test printf | cd sed grep cd local grep done sed --verbose
+	test cd done echo done /usr/bin
+$(pwd) 2>/dev/null -eu grep
+		&& $(pwd) sed sed local then $(pwd)
+echo "$1" 2>/dev/null cd /usr/bin /usr/bin
+		export local ${HOME} cd done grep awk | &&
+then 'quoted text' | | && x=1 | done 'quoted text' && awk then sed 2>/dev/null
+	cd | 'quoted text' "$@" "$@" echo x=1 /usr/bin
+		cd 'quoted text' 'quoted text' 'quoted text'
+	| 'quoted text' local export test awk then 2>/dev/null test x=1 grep /usr/bin
+${HOME} | /usr/bin then "$@" test awk 'quoted text' 2>/dev/null sed 2>/dev/null
+cd sed "$1" "$1" awk && && done --verbose printf x=1
+"$@" /usr/bin readonly export -eu 2>/dev/null echo sed ${HOME} awk
+readonly $(pwd) done cd printf local
+		export 'quoted text' ${HOME} 2>/dev/null test grep 2>/dev/null done local grep then
+grep 'quoted text' -eu done x=1 ${HOME} -eu 'quoted text'
+"$1" $(pwd) && -eu sed 2>/dev/null
+		export cd printf x=1 local && test grep awk --verbose "$1" "$@"
+	| sed grep sed sed readonly echo echo grep echo --verbose sed
+	grep | sed 'quoted text'
+export x=1 | done awk ${HOME}
+		test local grep /usr/bin printf test x=1
+	"$1" local -eu test then done grep x=1 echo "$@"
+	'quoted text' 'quoted text' ${HOME}
+${HOME} local awk | --verbose printf echo && 2>/dev/null export
+		then awk "$@" 'quoted text' "$@" --verbose
+		x=1 "$@" readonly x=1 'quoted text' --verbose local grep cd x=1
+	$(pwd) readonly 2>/dev/null grep 'quoted text'
+		&& echo local grep local | export x=1 "$1"
+echo echo -eu "$@" --verbose "$1" readonly readonly readonly cd /usr/bin cd
+readonly grep "$@" printf | grep then $(pwd) "$@" test test --verbose
+then cd export export
+x=1 && awk 'quoted text' test x=1 ${HOME}
+${HOME} echo && then -eu
+		x=1 && awk echo 2>/dev/null cd x=1 sed awk && done "$@" local /usr/bin
+x=1 && && awk cd 2>/dev/null /usr/bin
+	"$@" awk awk cd awk local echo then "$@" && 'quoted text' awk then cd "$1" 'quoted text'
+		local 'quoted text' -eu x=1 $(pwd)
+		cd 'quoted text' echo x=1 "$1" cd ${HOME} --verbose cd /usr/bin then
+	"$1" sed "$@" grep echo cd test -eu x=1 export awk && awk test /usr/bin readonly
+grep ${HOME} /usr/bin | readonly
+	readonly "$1" x=1 done $(pwd) && printf "$@" export then
+		then cd awk export echo readonly $(pwd)
+		-eu 2>/dev/null "$1" local done "$@" export test x=1 x=1 test
+test awk 'quoted text' 2>/dev/null
+		$(pwd) "$@" x=1 test ${HOME} ${HOME} "$@" $(pwd) then grep $(pwd)
+-eu sed export awk done --verbose /usr/bin -eu "$@" ${HOME} | 'quoted text'
+local | export 'quoted text' -eu "$1" x=1 | cd cd local cd then 2>/dev/null
+-eu awk then printf /usr/bin local | $(pwd) then -eu /usr/bin
+2>/dev/null test export && && x=1 test 2>/dev/null
+		2>/dev/null done echo cd && test done "$@"
+	then /usr/bin grep $(pwd) export export cd echo local "$1" &&
+x=1 -eu grep export grep done cd then readonly awk 'quoted text'
+		| "$1" | printf 2>/dev/null 2>/dev/null | | | $(pwd) $(pwd) printf
+		local $(pwd) grep sed then 'quoted text' then "$1" 'quoted text'
+	/usr/bin printf export --verbose readonly
+	2>/dev/null | export echo 'quoted text' local local test 2>/dev/null
+	&& /usr/bin $(pwd) then
+local $(pwd) grep echo grep then | --verbose printf -eu echo "$1"
+		2>/dev/null then 'quoted text' x=1 && cd
+		done $(pwd) --verbose sed "$1" | x=1 grep
+		echo readonly cd $(pwd) cd sed grep awk "$@" "$@" x=1 sed &&
+--verbose grep "$1" awk ${HOME} /usr/bin /usr/bin
+$(pwd) "$@" cd sed sed readonly export "$1" cd
+	&& grep -eu export readonly --verbose then done -eu printf
+'quoted text' 'quoted text' x=1 sed --verbose
+	done cd ${HOME} $(pwd) awk x=1 grep ${HOME} done $(pwd) readonly
+printf ${HOME} echo "$1" sed $(pwd) | awk 2>/dev/null x=1 /usr/bin done
+--verbose export cd 2>/dev/null done printf | -eu && grep then
+	$(pwd) "$@" printf "$@" ${HOME} sed echo local awk test then grep
+	'quoted text' && local grep done
+	"$1" printf -eu -eu x=1 --verbose x=1 x=1 x=1 echo awk readonly $(pwd) export
+		export ${HOME} /usr/bin 2>/dev/null "$1" then --verbose export grep x=1 && x=1
+	done cd awk local x=1 grep echo
+"$@" | --verbose $(pwd) readonly test --verbose 'quoted text' echo --verbose
+		awk printf $(pwd) 2>/dev/null done export
+		sed export | readonly export ${HOME} "$@" test then awk "$@" then
+	then grep grep && printf cd local x=1
+/usr/bin grep export /usr/bin "$1"
+"$1" "$1" cd x=1 readonly --verbose readonly printf x=1 cd ${HOME} then local
+| /usr/bin ${HOME} --verbose && /usr/bin
+		awk && /usr/bin cd export /usr/bin printf export
+readonly 'quoted text' export 'quoted text' && sed | cd ${HOME} 'quoted text'
+		2>/dev/null ${HOME} -eu readonly
+2>/dev/null 2>/dev/null sed awk 2>/dev/null | grep cd grep then printf cd printf
+&& 2>/dev/null printf readonly /usr/bin /usr/bin
+	| echo "$@" local cd printf awk then && $(pwd) /usr/bin echo done awk
+-eu x=1 && local export 'quoted text'
+		sed "$@" && x=1 "$@" $(pwd) test | then 2>/dev/null sed
+		printf /usr/bin cd "$1" "$@" readonly 2>/dev/null then done /usr/bin --verbose
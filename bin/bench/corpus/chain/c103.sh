@@ -0,0 +1,2001 @@
+	| /usr/bin printf x=1 "$1" "$1" x=1 printf $(pwd) grep cd echo $(pwd)
+	test "$1" x=1 echo test 'quoted text' printf cd 'quoted text'
+		done awk /usr/bin test 'quoted text' export cd test x=1 "$1" then
+	2>/dev/null test test export x=1 ${HOME} "$@" 'quoted text'
+		echo sed | | local && /usr/bin && then done -eu
+	local | -eu sed readonly "$1" | | 'quoted text' && && --verbose | echo sed grep
+		cd local "$@" 2>/dev/null
+sed ${HOME} -eu readonly cd "$1" echo
+sed grep printf --verbose | cd readonly 'quoted text'
+	sed "$@" sed echo grep test done test 2>/dev/null
+$(pwd) 'quoted text' echo echo sed export --verbose
+		echo "$@" 2>/dev/null then /usr/bin
+		sed 2>/dev/null $(pwd) && "$1" sed $(pwd) "$1" then then -eu readonly x=1
+	2>/dev/null 'quoted text'
+		local printf | "$@" readonly "$@" | -eu done echo && ${HOME} local
+		| readonly "$1" x=1 then then -eu
+		cd 'quoted text' -eu printf then grep grep echo echo
+x=1 -eu x=1 awk 2>/dev/null cd 'quoted text' then done --verbose
+		grep sed /usr/bin && x=1 ${HOME} done test printf cd done ${HOME}
+	--verbose --verbose echo readonly --verbose done --verbose /usr/bin grep
+		echo && 2>/dev/null "$1" -eu 'quoted text' export ${HOME}
+		x=1 local done | test "$1" cd && 'quoted text' awk "$1" awk "$1" ${HOME} cd printf
+		| ${HOME} sed && ${HOME} test --verbose sed x=1 && "$1" test
+		done 2>/dev/null -eu 2>/dev/null awk "$@" x=1 /usr/bin
+	/usr/bin ${HOME} local $(pwd) 2>/dev/null /usr/bin
+$(pwd) | ${HOME} local ${HOME} ${HOME} && awk
+	${HOME} printf "$@" export echo 2>/dev/null x=1 | x=1
+	local ${HOME} export grep grep -eu
+		awk && 2>/dev/null "$1" "$1" && then | "$@" ${HOME} grep | "$@"
+"$@" /usr/bin "$1" readonly then done $(pwd) awk export printf readonly then
+	'quoted text' printf x=1 --verbose done 2>/dev/null
+--verbose | sed export readonly 2>/dev/null test printf $(pwd) test
+		'quoted text' test && sed local sed x=1 "$@" export export ${HOME} 'quoted text'
+awk export && && $(pwd) test "$1" --verbose then cd printf
+		local "$1" --verbose $(pwd)
+--verbose test cd cd "$@" readonly --verbose ${HOME} | test
+/usr/bin "$1" awk test
+export then done readonly done printf sed x=1
+	then export /usr/bin
+export test done done "$1" done sed awk "$@"
+		-eu sed "$1" "$@" awk printf grep
+		| grep $(pwd) --verbose awk "$1"
+	done sed export printf readonly grep printf "$@" cd grep "$1" --verbose printf
+	export export sed then "$@" | 2>/dev/null 2>/dev/null 'quoted text' cd && 'quoted text'
+		$(pwd) x=1 --verbose test then local sed
+		--verbose export | test "$@" 2>/dev/null | -eu export 2>/dev/null echo
+	${HOME} 2>/dev/null then | local
+done /usr/bin cd sed cd -eu x=1 then 2>/dev/null $(pwd) export
+		x=1 'quoted text' --verbose sed $(pwd) test 'quoted text'
+$(pwd) 'quoted text' ${HOME} ${HOME} -eu
+		echo --verbose && 2>/dev/null "$@" sed && x=1 && cd cd sed printf
+		test 'quoted text' grep && sed x=1 -eu echo export local x=1
+		then 2>/dev/null export
+	cd /usr/bin done -eu local awk && done
+	'quoted text' && && readonly
+	/usr/bin then readonly ${HOME} 'quoted text'
+	$(pwd) awk printf local
+--verbose then sed export "$1" && local
+	grep test && -eu grep test --verbose export $(pwd) readonly $(pwd)
+&& grep sed $(pwd) "$@" grep "$1" sed 2>/dev/null --verbose readonly
+grep --verbose done then --verbose echo --verbose
+--verbose readonly export cd echo echo readonly 2>/dev/null
+cd sed "$1" -eu | $(pwd) $(pwd) $(pwd) awk cd 'quoted text' local
+"$1" 'quoted text' "$1" ${HOME}
+	grep printf ${HOME} test ${HOME} -eu grep grep readonly
+	x=1 done 2>/dev/null sed sed then 2>/dev/null cd awk -eu
+	x=1 local "$1" done && sed export "$@" cd grep ${HOME} awk awk readonly
+-eu local 2>/dev/null done cd "$@" test "$@" cd | $(pwd) echo
+	awk --verbose -eu $(pwd) readonly
+		local -eu -eu $(pwd) then -eu sed $(pwd) sed printf export test 'quoted text' ${HOME}
+then test echo | echo 2>/dev/null && printf export
+		x=1 x=1 $(pwd) echo local local cd -eu readonly
+	'quoted text' "$@" readonly then sed cd | ${HOME} grep
+		${HOME} awk -eu awk x=1 && test && echo test 2>/dev/null
+		cd echo grep test test cd local awk 2>/dev/null printf /usr/bin cd
+		readonly 'quoted text' export export
+	readonly export echo "$1" "$1" && cd local
+printf "$@" ${HOME} local | printf local test then done grep echo cd
+		printf 'quoted text' awk
+		'quoted text' printf test "$1" | "$1" ${HOME}
+--verbose x=1 then echo then --verbose
+test cd printf 2>/dev/null | x=1
+	readonly 'quoted text'
+		| grep awk --verbose sed grep awk
+		cd then then grep "$@"
+	grep printf export $(pwd) local ${HOME}
+x=1 sed --verbose cd local export test echo --verbose printf
+		$(pwd) "$@" cd local readonly x=1 awk done cd test $(pwd) $(pwd) "$@" then
+		echo done 2>/dev/null /usr/bin /usr/bin
+readonly printf local test --verbose 'quoted text' cd /usr/bin 2>/dev/null
+		grep echo --verbose "$@" $(pwd) grep test test test "$@" &&
+		"$1" sed ${HOME} x=1 grep
+		cd /usr/bin ${HOME} done sed "$@" awk echo "$1" | /usr/bin
+	sed $(pwd) sed 2>/dev/null 'quoted text'
+--verbose echo "$@" && grep readonly --verbose --verbose x=1 --verbose awk then
+		x=1 && 2>/dev/null printf
+/usr/bin readonly ${HOME}
+		echo cd 2>/dev/null test sed ${HOME} "$1" 2>/dev/null then ${HOME} then
+echo ${HOME} grep -eu ${HOME} | export grep cd "$@" x=1 "$1" -eu ${HOME} 'quoted text'
+${HOME} readonly -eu -eu x=1 export grep | 'quoted text'
+	2>/dev/null grep 'quoted text' /usr/bin "$1" "$@" ${HOME} /usr/bin awk $(pwd)
+	'quoted text' test grep 'quoted text' done export local 2>/dev/null x=1
+&& printf test awk | echo awk test x=1 2>/dev/null readonly
+$(pwd) awk readonly -eu
+&& --verbose sed awk "$@" --verbose
+		${HOME} $(pwd) then 'quoted text' sed 'quoted text' x=1 local && done
+	export && && "$@" 2>/dev/null --verbose
+	x=1 cd && echo export local x=1 cd -eu $(pwd) echo readonly
+	'quoted text' test echo x=1 export
+awk printf /usr/bin test
+		-eu then ${HOME} -eu "$@" cd x=1 sed &&
+${HOME} | x=1 export done test ${HOME} 'quoted text' && $(pwd) printf cd x=1 readonly
+awk x=1 ${HOME} -eu done "$@" "$@" 'quoted text' cd
+done "$1" done export test "$@" -eu test export
+printf -eu "$@" --verbose done echo
+		export local 2>/dev/null
+		then printf 2>/dev/null -eu -eu done "$@" test --verbose -eu
+cd echo --verbose "$@" "$1" printf sed $(pwd) | readonly /usr/bin echo
+grep grep readonly cd grep export $(pwd)
+| test then sed export cd "$@" export done
+&& && x=1 | | "$@" sed cd export sed export local test sed x=1 /usr/bin printf then
+	"$1" then 'quoted text'
+	--verbose -eu -eu /usr/bin sed export 'quoted text'
+	-eu -eu -eu awk $(pwd) sed ${HOME} x=1 $(pwd) awk then x=1 test grep
+"$1" ${HOME} then | printf /usr/bin done "$@" | cd -eu x=1
+${HOME} grep x=1 && 'quoted text' grep awk
+	echo 'quoted text' test --verbose "$@" x=1
+		local 2>/dev/null && /usr/bin $(pwd)
+		readonly "$1" x=1 test /usr/bin 2>/dev/null export echo ${HOME} cd sed
+	$(pwd) awk $(pwd) cd local
+echo $(pwd) echo --verbose readonly | | "$1" --verbose ${HOME} $(pwd) grep
+	awk ${HOME} "$@" $(pwd) done --verbose $(pwd) | printf grep readonly && sed awk
+		--verbose ${HOME} ${HOME} readonly sed -eu cd
+readonly -eu printf "$@" local awk "$@" printf test
+cd $(pwd) echo "$1" local export -eu sed grep $(pwd) && test
+		${HOME} && grep && "$1" -eu then then $(pwd) && test
+	${HOME} 'quoted text' test 'quoted text' local -eu
+	sed "$@" 2>/dev/null ${HOME}
+echo cd ${HOME} --verbose && 2>/dev/null | x=1 grep && echo local sed "$1"
+&& test done $(pwd) | export local then 'quoted text' $(pwd) printf cd x=1 test
+	sed cd --verbose /usr/bin sed -eu /usr/bin "$1" printf
+	awk 'quoted text' echo /usr/bin printf sed --verbose
+	test 'quoted text' 'quoted text' $(pwd) --verbose sed readonly
+		&& grep echo readonly sed echo local printf 'quoted text' "$1" grep readonly
+		grep 'quoted text' awk local "$@" sed "$@" /usr/bin test printf
+	x=1 ${HOME} cd test local readonly export "$1"
+		printf awk test /usr/bin 2>/dev/null && "$1" cd echo 'quoted text'
+&& cd "$@" test "$@" done awk $(pwd) sed then -eu ${HOME} done "$@" printf
+	sed && cd /usr/bin $(pwd) cd "$@" "$1" | x=1 sed export x=1 then --verbose
+"$1" done export sed | "$1" cd 2>/dev/null printf "$1" export --verbose
+	done | 'quoted text' x=1 "$@" 'quoted text' local local grep -eu
+	test sed cd printf readonly readonly && x=1 'quoted text' cd &&
+--verbose test x=1 && export cd $(pwd) printf x=1 local -eu then cd "$1" readonly
+	'quoted text' && x=1 ${HOME}
+	sed readonly printf then sed export /usr/bin 2>/dev/null sed export
+	-eu ${HOME} 2>/dev/null --verbose 'quoted text'
+		| awk | readonly readonly "$1" grep /usr/bin echo local
+	echo printf -eu local && 'quoted text' awk echo | 'quoted text'
+		awk cd sed export sed done
+	awk local grep "$@" /usr/bin done $(pwd) && readonly cd awk ${HOME} local
+$(pwd) /usr/bin local "$1" export 'quoted text' test 2>/dev/null printf sed
+	2>/dev/null export "$@" 2>/dev/null
+		test "$@" readonly sed echo $(pwd) then x=1 local -eu 'quoted text'
+		| --verbose 'quoted text' 2>/dev/null awk -eu sed "$1" 2>/dev/null sed
+	then export then /usr/bin x=1 "$@" && "$1" 'quoted text' | 2>/dev/null
+		export x=1 --verbose awk readonly echo
+printf grep -eu && awk 'quoted text' readonly printf 2>/dev/null
+sed 2>/dev/null printf "$@" export "$1" sed grep done local 'quoted text'
+		--verbose test local --verbose
+		"$1" cd ${HOME} "$@" cd "$1" | sed -eu --verbose /usr/bin
+		$(pwd) 'quoted text' $(pwd) then printf
+		x=1 x=1 readonly --verbose "$@" $(pwd) readonly -eu export x=1 grep
+	sed done cd ${HOME} local | awk export "$@" 2>/dev/null /usr/bin awk x=1 cd
+		cd | ${HOME} done then 2>/dev/null -eu then cd readonly "$1" local
+	"$1" awk done done 2>/dev/null /usr/bin
+&& && --verbose done printf printf printf done 'quoted text' "$@" --verbose
+	awk printf 2>/dev/null 2>/dev/null done test printf local "$1"
+-eu x=1 /usr/bin /usr/bin "$@" awk local "$1" ${HOME} test awk ${HOME} echo $(pwd)
+		done local awk && | x=1 sed --verbose then
+		sed sed grep readonly then 2>/dev/null 'quoted text' printf
+	x=1 --verbose x=1 test grep cd local /usr/bin
+sed cd x=1 2>/dev/null grep test | readonly echo
+		export "$1" -eu "$@" test export printf -eu && then printf printf
+		test grep "$@" cd local | awk --verbose 2>/dev/null awk then "$@" cd "$@" then
+awk grep ${HOME} ${HOME} export readonly | 2>/dev/null test | cd done
+	then 2>/dev/null grep | "$@" | ${HOME}
+x=1 then 2>/dev/null /usr/bin 2>/dev/null && local then
+/usr/bin printf /usr/bin "$@" | sed --verbose /usr/bin /usr/bin /usr/bin
+		/usr/bin sed sed readonly ${HOME} --verbose readonly
+	awk && | -eu /usr/bin printf awk | cd export x=1 2>/dev/null test "$1" && | sed
+	&& local "$@" readonly /usr/bin printf readonly |
+	awk x=1 "$1" "$1" then readonly x=1 test cd done awk 'quoted text'
+$(pwd) printf test local readonly cd sed export
+printf | | ${HOME} echo readonly x=1 /usr/bin
+/usr/bin 2>/dev/null readonly awk readonly 'quoted text' && local
+		echo 2>/dev/null --verbose $(pwd) ${HOME} done printf readonly | -eu then sed
+		/usr/bin && x=1 readonly && $(pwd) x=1 --verbose
+	then x=1 sed --verbose sed
+--verbose sed && cd 2>/dev/null | $(pwd) | test done export awk then
+x=1 local echo done readonly local awk | -eu
+grep export && "$1" printf grep /usr/bin /usr/bin | done readonly grep --verbose
+		'quoted text' then awk then ${HOME} 'quoted text' && && 'quoted text'
+&& awk "$@" then sed grep 2>/dev/null
+		"$@" readonly test export export "$@"
+		readonly readonly then done 2>/dev/null readonly
+	2>/dev/null /usr/bin /usr/bin
+		then sed echo --verbose -eu /usr/bin
+test echo then && --verbose "$@" 'quoted text' local cd done
+--verbose && export /usr/bin then "$@" sed |
+	"$@" | -eu /usr/bin grep export awk $(pwd) -eu test 'quoted text' 2>/dev/null
+		| sed done test 2>/dev/null "$1" ${HOME} test | -eu echo
+export export readonly ${HOME} awk 'quoted text' test
+	export 'quoted text' test awk awk cd done | grep echo
+		"$@" test test && "$@" "$1" --verbose awk export done 'quoted text'
+-eu ${HOME} 'quoted text' 'quoted text'
+"$@" printf sed cd printf printf test
+/usr/bin done 2>/dev/null cd readonly
+cd ${HOME} awk | printf test $(pwd) test local done ${HOME} --verbose
+	grep "$1" grep done cd echo echo echo then then --verbose
+	--verbose && test "$1" echo cd 'quoted text' readonly cd test readonly 'quoted text'
+	export printf then && readonly ${HOME} ${HOME} test then $(pwd) 2>/dev/null
+'quoted text' | 'quoted text' 'quoted text' then readonly printf
+printf "$@" sed grep grep local cd | | "$1" "$@"
+		cd x=1 -eu printf test x=1 && then $(pwd) "$@" "$@" printf --verbose
+grep awk printf then sed cd done printf awk test printf local -eu then
+		echo sed awk | cd -eu cd then x=1 "$@" "$1" "$1" local local cd sed echo "$@"
+		local echo 2>/dev/null cd 2>/dev/null awk $(pwd)
+export 2>/dev/null test grep --verbose "$1" 'quoted text' x=1 2>/dev/null ${HOME}
+	grep "$1" echo sed -eu 2>/dev/null $(pwd) --verbose "$@" --verbose grep
+	local $(pwd) | "$@" cd export "$1" ${HOME} "$1" printf
+	echo 2>/dev/null done test
+x=1 grep done 'quoted text'
+	$(pwd) readonly && 'quoted text'
+	local done x=1 "$1" 2>/dev/null then 'quoted text' --verbose "$@"
+	&& then cd export && --verbose && $(pwd)
+2>/dev/null then /usr/bin "$1" sed local local
+x=1 grep done then test local then x=1 "$@" 'quoted text' --verbose
+		printf 'quoted text' echo -eu done sed export 2>/dev/null
+	$(pwd) "$@" ${HOME} readonly printf awk x=1 awk grep
+		x=1 x=1 grep "$1" "$@"
+	2>/dev/null "$@" && awk
+then "$@" && -eu sed test awk --verbose
+		| ${HOME} "$@" export ${HOME} echo cd -eu && 2>/dev/null && awk "$1"
+	-eu "$@" && --verbose -eu 2>/dev/null --verbose echo -eu --verbose
+/usr/bin "$1" x=1 'quoted text'
+	x=1 awk ${HOME} $(pwd) cd /usr/bin readonly
+		printf -eu test readonly test awk 'quoted text' |
+--verbose 'quoted text' then then && printf
+	test test | printf "$@" cd awk ${HOME} awk cd | cd cd
+'quoted text' "$1" done local
+printf "$1" echo echo
+--verbose printf && test test
+cd -eu grep test then -eu awk | x=1 test printf then 'quoted text'
+		"$@" cd done | "$@" 2>/dev/null printf -eu
+	awk test $(pwd) test then | | then ${HOME} &&
+"$1" --verbose sed "$1" ${HOME} awk /usr/bin x=1 cd
+export "$@" awk echo $(pwd) grep 'quoted text' x=1 $(pwd) "$@" awk
+		"$@" sed awk readonly sed cd -eu --verbose -eu
+		&& sed sed ${HOME} sed ${HOME} printf
+printf done done "$@" 2>/dev/null export readonly
+	cd printf echo /usr/bin x=1 -eu then cd --verbose grep readonly cd done
+	/usr/bin echo $(pwd)
+		printf local then --verbose done --verbose sed "$1" cd
+		x=1 | echo awk x=1 grep done export $(pwd) grep --verbose --verbose
+		echo grep 'quoted text' sed $(pwd) |
+		${HOME} | --verbose ${HOME}
+	printf printf && ${HOME} "$1" grep grep $(pwd) sed readonly --verbose sed
+		'quoted text' cd readonly
+		-eu grep 2>/dev/null 2>/dev/null | done "$1" echo && local test -eu done
+	test export ${HOME} export 'quoted text' ${HOME} ${HOME} grep -eu sed ${HOME}
+	awk "$@" export sed --verbose 2>/dev/null -eu 'quoted text' local | printf |
+	"$1" "$1" cd $(pwd) "$@" cd "$1" cd ${HOME} -eu grep awk test
+	--verbose ${HOME} test ${HOME} -eu printf && grep sed
+		echo -eu $(pwd) grep export "$1" awk local x=1 then readonly /usr/bin
+x=1 2>/dev/null "$1" then sed export -eu awk ${HOME}
+	2>/dev/null printf export
+echo "$1" cd | $(pwd) grep test done --verbose ${HOME} /usr/bin
+	export cd --verbose "$1" sed cd /usr/bin /usr/bin done
+then --verbose printf && $(pwd) local
+then awk -eu /usr/bin awk | export ${HOME} x=1
+	'quoted text' x=1 sed x=1 export $(pwd) export -eu awk awk done test export $(pwd)
+test "$@" export ${HOME} test -eu
+	--verbose sed $(pwd) local readonly sed 2>/dev/null cd done ${HOME} x=1 2>/dev/null
+'quoted text' $(pwd) "$1" --verbose done grep
+		done awk /usr/bin test $(pwd) sed printf cd grep test grep 'quoted text'
+readonly printf local sed ${HOME} 2>/dev/null printf cd printf echo awk 'quoted text'
+echo ${HOME} 2>/dev/null && /usr/bin grep cd x=1 test grep readonly
+'quoted text' 2>/dev/null | --verbose export printf | echo
+'quoted text' "$1" done $(pwd)
+		${HOME} sed done 'quoted text' 2>/dev/null "$1" 'quoted text'
+	--verbose x=1 done ${HOME}
+	cd readonly echo cd local ${HOME} sed
+	export "$1" grep then && --verbose 2>/dev/null $(pwd) | awk then readonly
+	readonly "$1" sed "$@" printf /usr/bin x=1 cd -eu $(pwd) export
+		&& then cd --verbose grep then | echo && awk echo "$1" x=1
+		done "$1" -eu cd done readonly echo echo then
+then 'quoted text' sed
+	&& x=1 "$1" grep local --verbose grep awk cd grep then "$@" | export
+--verbose | readonly cd echo "$1" done /usr/bin echo printf done
+sed "$@" awk local grep 'quoted text' done done readonly printf then
+		echo "$1" 'quoted text' done echo "$1"
+	'quoted text' then sed
+/usr/bin done done export grep x=1 awk ${HOME} awk test sed done then echo
+		sed | && then | "$@" --verbose echo grep ${HOME} sed export cd awk awk
+	awk 2>/dev/null ${HOME}
+--verbose readonly 2>/dev/null test ${HOME} --verbose
+cd then done done cd && && | grep -eu ${HOME} awk cd 2>/dev/null readonly local
+	done done cd 'quoted text'
+		printf && ${HOME} readonly local sed -eu sed
+		&& && sed done "$@" &&
+		then local && grep 'quoted text'
+		-eu sed cd && grep $(pwd) done "$1" | then x=1 && readonly printf test cd done
+		x=1 --verbose echo cd then test then
+		-eu $(pwd) $(pwd) local sed "$@" export local ${HOME}
+		cd ${HOME} 2>/dev/null local
+	done done "$@" grep ${HOME}
+test -eu ${HOME} readonly 2>/dev/null test echo sed local $(pwd) test 'quoted text'
+		grep ${HOME} test test "$1" grep 2>/dev/null $(pwd) $(pwd) awk
+	$(pwd) test grep grep echo
+		| local /usr/bin 2>/dev/null "$1"
+'quoted text' readonly "$1" 2>/dev/null done x=1 then local
+local cd cd export awk
+		grep "$1" test | 'quoted text' export $(pwd) then grep "$1" then printf
+readonly 'quoted text' readonly -eu printf /usr/bin export "$@" && -eu done
+	&& done x=1 ${HOME} ${HOME} cd
+	$(pwd) | ${HOME} echo readonly
+		grep ${HOME} && export then sed 'quoted text' awk awk done && done $(pwd) readonly
+'quoted text' 2>/dev/null ${HOME} echo local ${HOME} awk done ${HOME} 'quoted text'
+awk test local awk awk grep awk "$1" test printf
+readonly test sed echo export grep
+	done sed 'quoted text' grep local --verbose
+readonly --verbose echo cd printf awk readonly grep cd then
+echo awk && readonly export --verbose 'quoted text' local
+"$1" && done readonly echo "$@" done printf
+		2>/dev/null "$@" echo --verbose echo "$1" sed ${HOME} "$1"
+		"$1" sed x=1 $(pwd) ${HOME} -eu ${HOME} readonly
+		"$@" "$@" test grep local readonly sed export | readonly sed sed
+		&& | ${HOME} | then && local && /usr/bin sed 2>/dev/null printf local echo /usr/bin
+	cd sed test done "$@" "$@" x=1 test printf $(pwd) readonly grep
+	done --verbose $(pwd) "$1" ${HOME} $(pwd) export sed "$@" "$@"
+	2>/dev/null 'quoted text' local awk local 'quoted text' local
+	${HOME} echo then sed && grep /usr/bin "$@" "$1" printf | $(pwd) 2>/dev/null
+"$@" 'quoted text' ${HOME} test 2>/dev/null /usr/bin "$@" -eu echo 2>/dev/null
+awk cd -eu cd ${HOME} "$@" readonly
+		export --verbose ${HOME} x=1 | $(pwd) ${HOME} export then ${HOME} then local grep
+	x=1 cd "$1" ${HOME} $(pwd) sed | local
+		x=1 /usr/bin printf -eu done local sed | then echo local done cd "$1" $(pwd)
+	| -eu awk 'quoted text' 2>/dev/null export -eu ${HOME} awk
+	"$@" $(pwd) ${HOME} cd $(pwd) grep | awk x=1 ${HOME} ${HOME} printf printf
+		sed cd done grep 2>/dev/null done then
+		/usr/bin then awk ${HOME}
+	printf && done awk sed readonly printf awk | /usr/bin
+		2>/dev/null ${HOME} $(pwd) then awk echo $(pwd) test echo local
+	2>/dev/null x=1 && && sed
+grep grep sed readonly then cd "$@" echo then then
+awk 2>/dev/null done "$1" awk then awk local -eu 'quoted text' /usr/bin
+		readonly local x=1 "$1" -eu awk done 'quoted text'
+		done && export 'quoted text'
+&& 2>/dev/null sed $(pwd) grep -eu
+	export -eu done printf cd cd test 2>/dev/null
+	grep export cd "$@" awk echo printf "$@" echo /usr/bin ${HOME} then $(pwd)
+| "$1" "$@" $(pwd) sed done /usr/bin ${HOME} --verbose
+		export "$@" awk printf --verbose awk cd --verbose export -eu && ${HOME} printf
+	done -eu && ${HOME} /usr/bin x=1 /usr/bin "$1" cd echo /usr/bin
+		2>/dev/null ${HOME} test /usr/bin sed -eu done | then /usr/bin then
+		'quoted text' "$1" local done cd -eu "$@" "$1" readonly --verbose
+		export $(pwd) "$@" printf awk
+	x=1 --verbose 2>/dev/null x=1 && | ${HOME} "$@" && "$1" then local $(pwd)
+	cd 'quoted text' sed grep cd then echo done done local grep grep export | grep
+"$1" printf --verbose -eu grep ${HOME}
+		x=1 "$1" $(pwd) then echo printf /usr/bin ${HOME} | export sed test test
+		&& && 2>/dev/null $(pwd) awk sed | echo ${HOME} -eu
+		echo | /usr/bin 'quoted text' x=1 ${HOME} 'quoted text'
+	$(pwd) readonly 'quoted text' readonly "$1"
+/usr/bin export /usr/bin awk 2>/dev/null
+		cd "$1" 2>/dev/null echo "$@" sed 2>/dev/null
+	&& --verbose grep awk grep readonly awk sed x=1 then sed grep
+		export echo test grep echo x=1 echo grep "$1" "$1" sed
+		grep grep echo ${HOME} echo "$@" -eu test --verbose cd readonly 2>/dev/null
+grep printf --verbose 2>/dev/null
+	grep 2>/dev/null awk $(pwd) "$@" 2>/dev/null 'quoted text' $(pwd)
+cd export then done x=1 then readonly && export && "$1" echo | | grep cd
+'quoted text' $(pwd) "$1" readonly && --verbose local
+2>/dev/null 2>/dev/null cd grep "$@" grep 2>/dev/null /usr/bin
+	readonly $(pwd) grep local
+		2>/dev/null echo ${HOME} --verbose
+| -eu cd echo ${HOME} then awk test | "$1" export -eu done grep
+2>/dev/null "$1" awk 'quoted text' sed cd 2>/dev/null
+		&& /usr/bin cd readonly then $(pwd) "$1" 2>/dev/null "$1" | | cd
+		cd "$1" local printf /usr/bin grep
+		done "$1" ${HOME} done awk 2>/dev/null readonly local | awk
+	export cd echo cd local local x=1 && export --verbose done sed
+	'quoted text' "$@" --verbose readonly -eu test "$1" -eu x=1 x=1 "$@" 2>/dev/null
+	| | cd 2>/dev/null readonly x=1 awk -eu
+		local sed awk /usr/bin awk printf printf
+	2>/dev/null ${HOME} "$@" grep 2>/dev/null
+	/usr/bin test cd echo "$@" | awk
+	${HOME} grep ${HOME} ${HOME} local $(pwd) export test local test test ${HOME}
+'quoted text' local then ${HOME} | grep -eu cd then echo export
+	awk "$@" test export -eu x=1 -eu readonly sed grep 2>/dev/null
+	--verbose 2>/dev/null printf
+		readonly 'quoted text' done grep test && test /usr/bin grep
+printf done export /usr/bin 'quoted text' | /usr/bin
+	'quoted text' readonly awk ${HOME} then 2>/dev/null
+		sed local && 2>/dev/null | cd then "$@" then export -eu cd ${HOME}
+	readonly sed | grep ${HOME} x=1 -eu /usr/bin $(pwd) done cd test
+		echo "$1" 2>/dev/null $(pwd) sed awk | | grep
+cd 'quoted text' && test sed 'quoted text' local
+	test | export awk grep -eu ${HOME} done --verbose done export grep /usr/bin
+		"$1" 2>/dev/null "$1" awk sed readonly "$1" printf
+export test local then echo | --verbose cd export /usr/bin cd
+grep 'quoted text' && "$@" then 'quoted text' 2>/dev/null
+		then 2>/dev/null | local | $(pwd) readonly done sed then /usr/bin "$1"
+grep "$1" awk -eu grep $(pwd)
+readonly done -eu 2>/dev/null
+	grep sed then sed ${HOME} && echo 2>/dev/null grep local export x=1 &&
+		-eu $(pwd) ${HOME} done then test
+	${HOME} then 2>/dev/null grep | then $(pwd) 2>/dev/null $(pwd) sed ${HOME}
+	'quoted text' 'quoted text' readonly
+		"$@" && echo /usr/bin awk test --verbose | "$@" then | | --verbose "$@"
+	"$@" echo && export "$1" $(pwd) $(pwd) /usr/bin x=1 sed export $(pwd)
+		then then awk cd cd $(pwd) awk grep sed 'quoted text' awk printf awk sed awk
+		done "$1" "$1" readonly export
+	grep readonly 'quoted text' 'quoted text'
+		grep && cd test awk echo awk "$1" then export done /usr/bin
+	sed readonly "$1" export --verbose then echo
+		'quoted text' --verbose 'quoted text'
+		local export echo awk readonly ${HOME}
+		&& done awk echo local awk done $(pwd) --verbose
+		${HOME} sed ${HOME} echo x=1 done done /usr/bin 'quoted text'
+	printf awk "$@" echo readonly "$1" && --verbose
+	| then awk readonly -eu sed readonly cd printf && x=1 printf -eu test
+done 'quoted text' --verbose then then ${HOME}
+		printf grep "$1" printf &&
+	grep x=1 echo $(pwd) echo
+		readonly /usr/bin && local done export
+$(pwd) x=1 export then "$1" test ${HOME} 'quoted text' echo "$@" --verbose "$1"
+		test export ${HOME} "$@" x=1 x=1 readonly 2>/dev/null
+'quoted text' ${HOME} x=1 /usr/bin $(pwd)
+	grep printf 2>/dev/null export && --verbose -eu ${HOME} readonly sed "$@" export
+2>/dev/null local --verbose readonly
+export cd | printf local sed awk -eu readonly x=1 && -eu && done ${HOME}
+		| readonly then grep readonly export export cd "$@" local "$1" 'quoted text'
+sed --verbose ${HOME} "$@" awk /usr/bin
+	awk && test grep sed then local done -eu && test
+		export ${HOME} ${HOME} echo /usr/bin ${HOME}
+	readonly export x=1 local
+	export $(pwd) -eu /usr/bin echo "$1" sed done test sed $(pwd) | x=1 then
+	done 2>/dev/null && 2>/dev/null
+		sed 2>/dev/null printf 2>/dev/null done "$1" "$1" grep ${HOME} &&
+	then test /usr/bin && done cd 2>/dev/null --verbose test printf && then
+	&& test 2>/dev/null 2>/dev/null
+	grep -eu printf 'quoted text' ${HOME} -eu sed export 'quoted text' 2>/dev/null
+| /usr/bin export then local printf test ${HOME} printf |
+		grep cd then 'quoted text' then sed done --verbose
+		printf 'quoted text' cd export done awk export sed
+grep | ${HOME} $(pwd) $(pwd) sed
+		awk $(pwd) x=1 $(pwd) "$1" "$1" done cd | -eu
+	'quoted text' "$@" x=1 grep $(pwd) $(pwd)
+	done echo readonly done && then "$1" 'quoted text'
+2>/dev/null readonly x=1 "$@" echo 2>/dev/null "$1"
+	$(pwd) x=1 $(pwd) ${HOME} "$1"
+${HOME} echo test ${HOME} -eu done sed
+local $(pwd) done local sed --verbose cd && test
+"$1" done local -eu done "$@" printf /usr/bin /usr/bin x=1 | | x=1
+export printf test 'quoted text' local cd | && | /usr/bin awk ${HOME}
+		export /usr/bin cd 2>/dev/null /usr/bin echo && echo && ${HOME} cd printf
+local then /usr/bin local readonly test
+"$@" -eu printf echo "$1" readonly grep readonly cd ${HOME} export x=1
+'quoted text' then $(pwd) echo awk && local local "$1" --verbose test
+	local --verbose printf ${HOME} then grep cd export
+		| && sed "$1" && readonly sed test then export printf readonly
+	sed "$1" export "$@" "$1" local x=1 sed ${HOME} awk printf
+	'quoted text' local --verbose ${HOME} 2>/dev/null
+	"$@" && && && cd printf
+		then -eu readonly --verbose export
+	x=1 readonly then 'quoted text' done printf "$@" cd grep cd readonly
+done -eu then local 'quoted text'
+-eu | readonly echo $(pwd) && grep 'quoted text' -eu local
+done -eu 2>/dev/null ${HOME} "$1" echo cd -eu
+awk | then | export 2>/dev/null | export "$@" ${HOME} test export $(pwd)
+awk done test $(pwd) && x=1 -eu | grep sed export --verbose export /usr/bin
+sed | $(pwd) export local
+	$(pwd) done 2>/dev/null awk
+	awk x=1 then test 'quoted text' local 2>/dev/null "$@" awk "$@" "$1"
+		then "$@" "$@" "$1" sed grep then && x=1 'quoted text' grep
+export grep printf readonly
+		grep done ${HOME} ${HOME} |
+grep printf echo /usr/bin "$1" grep
+	'quoted text' --verbose grep then done local
+"$1" echo echo done readonly
+	x=1 "$@" "$@" echo echo /usr/bin
+$(pwd) && done local then ${HOME} 2>/dev/null
+x=1 "$1" "$@" printf 'quoted text' --verbose printf readonly
+		local && | then /usr/bin
+		"$@" local && readonly done x=1 sed /usr/bin 'quoted text'
+"$@" then "$@" 'quoted text' ${HOME} x=1 x=1 local
+	awk && echo 2>/dev/null "$1" ${HOME} "$@" "$@" x=1 cd --verbose /usr/bin | then
+	done awk 2>/dev/null ${HOME} echo 'quoted text' echo /usr/bin then test done
+	sed awk echo echo | /usr/bin done $(pwd)
+		local readonly 2>/dev/null readonly cd ${HOME} x=1 echo printf
+		| ${HOME} 'quoted text' done && export awk && grep 'quoted text' "$@" ${HOME}
+		-eu $(pwd) 2>/dev/null export | readonly
+export sed awk --verbose local
+	x=1 -eu done "$@" 2>/dev/null
+	'quoted text' grep local --verbose
+${HOME} local export local done cd local printf readonly done
+		printf x=1 "$@" /usr/bin
+		"$@" echo readonly readonly
+&& x=1 2>/dev/null $(pwd) && test | --verbose then test $(pwd) "$1"
+	readonly "$@" x=1 test export awk test printf test 2>/dev/null readonly test
+	"$1" export printf echo ${HOME} then export 2>/dev/null /usr/bin echo grep
+x=1 printf ${HOME} export -eu export && done x=1 "$@" echo export echo
+	-eu sed | ${HOME} sed -eu "$@"
+readonly test grep test 2>/dev/null ${HOME} echo printf && printf -eu $(pwd)
+-eu printf && "$@" ${HOME} awk --verbose grep 2>/dev/null "$@" printf echo 2>/dev/null
+'quoted text' awk echo local sed echo readonly
+cd && echo 'quoted text' echo sed --verbose --verbose 2>/dev/null done /usr/bin
+		"$1" && /usr/bin local sed cd x=1 /usr/bin echo -eu /usr/bin
+	readonly test && then --verbose cd ${HOME}
+		"$1" awk "$@" && /usr/bin 'quoted text' && $(pwd) "$@" then | $(pwd) echo
+	test x=1 | "$1" $(pwd) sed test /usr/bin
+		"$@" /usr/bin ${HOME} --verbose 2>/dev/null
+printf export then readonly cd test local export readonly 'quoted text' grep
+	grep "$1" then "$@" cd test 2>/dev/null 'quoted text' printf
+	cd printf "$@" | export
+		$(pwd) echo 2>/dev/null 'quoted text' sed /usr/bin 'quoted text' local && 2>/dev/null
+		local "$@" cd cd ${HOME} done --verbose awk readonly
+awk done echo 2>/dev/null readonly
+	grep | done && x=1 $(pwd) readonly "$1" ${HOME}
+| "$1" local then 'quoted text' && echo test /usr/bin local sed |
+		${HOME} | --verbose -eu $(pwd) test local "$1" printf grep -eu | cd x=1 "$@"
+		cd awk local ${HOME} test done export done ${HOME}
+| 'quoted text' readonly $(pwd) done
+	test "$1" local echo printf readonly export
+	x=1 local && --verbose 2>/dev/null "$1"
+	export ${HOME} --verbose printf
+${HOME} done done test
+	cd echo printf done sed sed local grep
+		$(pwd) printf test && /usr/bin --verbose --verbose echo $(pwd) ${HOME}
+	/usr/bin --verbose then | /usr/bin cd printf && printf done $(pwd) -eu
+	export test test x=1 "$1" && echo && x=1 ${HOME} -eu 2>/dev/null 'quoted text'
+	"$1" | "$@" cd --verbose -eu export grep ${HOME} $(pwd) -eu "$@" "$@"
+readonly "$@" echo 2>/dev/null
+printf $(pwd) $(pwd) /usr/bin "$@" grep cd /usr/bin test && then "$@"
+		printf test --verbose export export $(pwd) x=1 done ${HOME}
+		/usr/bin test sed 2>/dev/null export local sed "$@" grep readonly cd --verbose
+cd 'quoted text' then && /usr/bin
+		"$@" printf x=1 local --verbose grep $(pwd) done local -eu
+printf && sed readonly awk awk 2>/dev/null
+cd | "$1" | awk then ${HOME} echo -eu ${HOME} readonly
+	test 'quoted text' echo cd export "$@" -eu --verbose
+	x=1 local --verbose export x=1 test /usr/bin
+readonly test awk readonly readonly grep -eu echo
+done grep done x=1 local cd "$@" test 'quoted text' x=1
+test 2>/dev/null local sed
+		awk "$@" 2>/dev/null done grep local local
+	'quoted text' cd | && readonly sed /usr/bin 2>/dev/null sed x=1 then
+-eu -eu sed | awk printf done 2>/dev/null | test local "$1" awk grep
+2>/dev/null | && readonly "$1" done -eu then printf 'quoted text'
+$(pwd) --verbose "$1" cd 'quoted text' local
+	readonly 'quoted text'
+	| test ${HOME} printf printf cd -eu | printf grep awk cd export
+	grep -eu ${HOME} readonly echo readonly export 2>/dev/null |
+export | $(pwd) export 2>/dev/null printf
+awk echo && "$@" local export readonly sed cd |
+	test readonly && "$@" && && echo grep cd local
+	export /usr/bin "$@" cd x=1 readonly
+awk | 2>/dev/null && "$@"
+"$1" export $(pwd) export /usr/bin "$@" ${HOME} /usr/bin
+		test readonly -eu sed -eu awk awk | sed done 2>/dev/null "$1" done then echo x=1
+		printf sed test "$1" /usr/bin x=1 printf test local
+sed 'quoted text' ${HOME} export
+x=1 "$1" | done grep cd local
+echo local export 2>/dev/null ${HOME} test done cd cd && --verbose x=1 "$1"
+local done && readonly cd export
+	--verbose awk echo printf "$1" then | then awk -eu test local
+&& readonly test -eu $(pwd) $(pwd)
+		export awk $(pwd) ${HOME} x=1 "$@" -eu export && $(pwd) cd then 2>/dev/null
+		local done /usr/bin "$1" && grep
+&& cd && printf /usr/bin then --verbose 'quoted text' test done -eu cd
+"$@" 'quoted text' x=1 cd local awk ${HOME}
+		done done | awk 2>/dev/null printf awk printf printf -eu $(pwd)
+		2>/dev/null sed "$1" -eu x=1 local x=1 /usr/bin readonly 2>/dev/null done
+	--verbose readonly readonly done x=1 grep $(pwd)
+printf /usr/bin done "$1"
+then $(pwd) printf | readonly test
+&& ${HOME} test /usr/bin "$@" export "$@" "$1" done cd sed /usr/bin
+	export echo then "$1" awk grep readonly 2>/dev/null x=1 "$@" /usr/bin
+		x=1 2>/dev/null -eu --verbose printf grep printf "$@" $(pwd) --verbose
+	sed --verbose --verbose $(pwd) then | /usr/bin && printf local
+		$(pwd) ${HOME} && done "$1"
+		x=1 x=1 x=1 "$1" export && "$1"
+	printf done readonly x=1 $(pwd) done done 2>/dev/null /usr/bin awk
+	$(pwd) x=1 cd ${HOME} echo 2>/dev/null "$@" export 'quoted text'
+awk done echo awk export readonly local | 'quoted text' --verbose
+grep | awk "$1" sed "$1" "$@" then --verbose | | /usr/bin
+		awk $(pwd) readonly awk --verbose 'quoted text' grep printf echo printf
+&& ${HOME} test done && -eu awk echo
+	&& grep grep 2>/dev/null echo && | "$@"
+		&& done 'quoted text' /usr/bin then $(pwd)
+	"$1" 2>/dev/null local "$1" readonly 'quoted text'
+	export test && /usr/bin test sed cd ${HOME} readonly 2>/dev/null -eu
+		export local --verbose grep
+		'quoted text' --verbose /usr/bin
+		"$1" readonly export sed -eu 2>/dev/null readonly
+		'quoted text' printf then
+		${HOME} done cd sed "$1" 2>/dev/null ${HOME} done export 2>/dev/null
+readonly -eu && sed | local printf echo
+"$1" done then echo then grep export --verbose --verbose $(pwd) grep $(pwd) --verbose
+	export sed readonly /usr/bin done "$1" 'quoted text' $(pwd) done then echo
+done done /usr/bin "$@" $(pwd) /usr/bin echo readonly export 'quoted text'
+		done echo 2>/dev/null $(pwd) x=1 /usr/bin grep test printf printf "$@"
+	-eu test echo export echo
+	local echo x=1 --verbose | readonly
+		"$1" echo test cd done x=1 echo export echo "$1" test
+	printf "$@" export 'quoted text' | | grep
+awk x=1 | done test grep $(pwd) cd ${HOME} awk x=1 sed && && cd -eu then 'quoted text'
+		grep printf done | awk 2>/dev/null printf -eu then local $(pwd) "$@" then
+		echo local | sed then export 2>/dev/null
+		&& "$@" export printf && printf
+grep 2>/dev/null | done then "$1" x=1 awk -eu grep sed
+	$(pwd) 2>/dev/null 'quoted text'
+		| $(pwd) export sed 'quoted text' | echo local export
+		then export test printf done $(pwd)
+readonly printf then /usr/bin then sed "$@" sed cd $(pwd)
+	done grep x=1 "$@" done printf "$1" printf
+	done then awk echo /usr/bin echo done 'quoted text' $(pwd) test --verbose
+&& 'quoted text' readonly 2>/dev/null printf
+'quoted text' "$@" 'quoted text' printf "$1" ${HOME} done -eu -eu
+	test --verbose awk test sed /usr/bin
+	| --verbose grep /usr/bin
+	grep test echo x=1 grep awk /usr/bin done done awk && then grep
+		| /usr/bin local printf "$@" sed printf echo |
+"$1" done 2>/dev/null x=1 x=1 "$@" 2>/dev/null -eu awk readonly
+echo "$1" local 2>/dev/null /usr/bin printf /usr/bin then -eu then --verbose
+	readonly 2>/dev/null 'quoted text' $(pwd) grep
+	sed local test 'quoted text' x=1 && -eu test readonly "$@" | x=1 "$@" ${HOME} ${HOME}
+	2>/dev/null $(pwd) then -eu printf export && /usr/bin then 2>/dev/null
+	readonly printf x=1 --verbose
+		/usr/bin | readonly $(pwd) /usr/bin printf local -eu sed test
+/usr/bin "$@" done then grep sed
+export grep -eu 'quoted text' x=1 | export ${HOME} "$1" && cd test -eu --verbose
+		readonly awk ${HOME} then 2>/dev/null
+	test "$@" awk /usr/bin readonly export printf grep x=1 ${HOME}
+x=1 $(pwd) test local $(pwd) $(pwd)
+		2>/dev/null "$1" ${HOME} | test | done readonly
+	--verbose x=1 "$@" test -eu 'quoted text'
+grep printf | $(pwd) 'quoted text' readonly
+-eu readonly /usr/bin export -eu printf 'quoted text'
+	"$@" test && cd local
+$(pwd) | echo "$@" readonly --verbose
+printf "$1" $(pwd) readonly -eu then
+		&& "$@" done echo 2>/dev/null cd /usr/bin "$1" then export
+		$(pwd) readonly readonly
+		-eu test $(pwd) awk test 'quoted text'
+	local 2>/dev/null awk -eu
+	"$@" export $(pwd) echo test readonly printf local
+	--verbose "$1" 'quoted text' echo ${HOME} --verbose ${HOME} done "$@" ${HOME}
+		export export local /usr/bin x=1 --verbose $(pwd) | --verbose export -eu
+	/usr/bin printf echo x=1 && 2>/dev/null ${HOME}
+	export local then then printf x=1 awk --verbose
+		-eu | "$1" printf done --verbose x=1 awk then --verbose sed && --verbose x=1
+	echo done echo $(pwd) -eu 2>/dev/null "$@" "$@" printf 'quoted text' then then echo
+${HOME} --verbose grep sed ${HOME} test --verbose | $(pwd)
+	awk "$1" && cd test awk export -eu printf
+		test "$1" sed cd readonly echo
+	x=1 | x=1 'quoted text' /usr/bin export 'quoted text' 'quoted text' done
+--verbose -eu -eu export awk 2>/dev/null export export
+		sed "$1" ${HOME} local export readonly --verbose "$@" readonly &&
+		-eu export "$1" -eu done /usr/bin x=1
+	export local && /usr/bin printf "$@" grep printf echo $(pwd)
+		cd awk && && "$1" && echo done 2>/dev/null $(pwd) done then
+		done -eu sed export grep grep 'quoted text' grep then readonly
+		x=1 ${HOME} /usr/bin then done done | local then then grep
+	echo cd ${HOME} then "$1" printf /usr/bin x=1 | done printf cd $(pwd) 2>/dev/null
+		local --verbose $(pwd) sed ${HOME} test x=1 /usr/bin awk readonly /usr/bin
+"$1" awk 'quoted text' $(pwd) done echo | --verbose ${HOME} test x=1 readonly
+	$(pwd) sed "$@" "$@" printf local $(pwd) ${HOME} | | && &&
+printf $(pwd) 'quoted text'
+	${HOME} && x=1 grep printf ${HOME} export cd -eu echo --verbose 'quoted text'
+local --verbose 2>/dev/null | x=1 local printf 2>/dev/null
+		done -eu "$@" "$1" | /usr/bin
+		/usr/bin export cd sed && grep --verbose awk cd ${HOME} then -eu
+printf /usr/bin done $(pwd) --verbose
+test $(pwd) local then $(pwd) /usr/bin grep /usr/bin
+grep "$1" /usr/bin 2>/dev/null grep
+		${HOME} && /usr/bin export
+	then echo echo test $(pwd) "$@" $(pwd)
+	$(pwd) x=1 printf local ${HOME} | test
+	x=1 readonly readonly test printf "$@" | "$1" export echo 2>/dev/null /usr/bin 'quoted text'
+then grep && done echo 'quoted text' -eu awk sed --verbose
+		test sed done sed x=1 test "$1" done "$1" readonly "$@" ${HOME} x=1 ${HOME}
+done cd 'quoted text' $(pwd) && 'quoted text' x=1 cd local
+echo "$1" test 'quoted text' |
+		echo grep done export awk $(pwd) echo "$1" "$1" sed "$@" readonly
+grep | $(pwd) "$@" && 2>/dev/null /usr/bin /usr/bin cd
+		-eu done readonly "$1" grep local
+		local then printf export x=1 then /usr/bin awk sed "$1" then
+		grep ${HOME} | test test then | grep export printf "$1"
+	export test then ${HOME} 'quoted text' /usr/bin
+	"$1" ${HOME} && awk then -eu sed printf export
+	2>/dev/null | && local x=1 awk export done sed 'quoted text'
+local "$1" export readonly
+		2>/dev/null 'quoted text' cd 2>/dev/null printf
+$(pwd) | 'quoted text' "$@"
+		done awk grep awk readonly ${HOME} then cd readonly "$1" awk | "$1"
+		--verbose $(pwd) /usr/bin /usr/bin test 2>/dev/null
+	x=1 echo test $(pwd) readonly "$@" "$@" "$1" 'quoted text'
+		"$@" "$1" cd ${HOME} x=1 export sed awk -eu 'quoted text'
+2>/dev/null local | | 2>/dev/null grep $(pwd) echo -eu "$@" $(pwd) export /usr/bin
+		x=1 x=1 | readonly && 'quoted text' done
+	grep printf test x=1 export -eu local "$1" export && "$1"
+		2>/dev/null $(pwd) "$1" --verbose cd ${HOME} -eu echo && 2>/dev/null
+		export 'quoted text' | "$1" 2>/dev/null test | local ${HOME} sed awk $(pwd)
+then readonly printf 2>/dev/null x=1 readonly then "$@" awk then awk
+readonly 'quoted text' done cd -eu echo /usr/bin sed export | readonly printf --verbose
+$(pwd) readonly sed readonly 'quoted text' sed --verbose "$@" -eu printf &&
+echo /usr/bin x=1 && 'quoted text'
+		test grep $(pwd) export cd -eu done --verbose
+		/usr/bin test -eu export
+done "$1" echo sed | export -eu grep x=1
+		$(pwd) printf x=1 awk export "$@" export "$1" export awk awk | "$@"
+"$1" cd /usr/bin ${HOME} "$1"
+	readonly "$1" sed printf "$@" 'quoted text'
+	then awk "$1" && done cd sed "$@" 2>/dev/null -eu echo "$@"
+		export sed awk 2>/dev/null export export "$@"
+${HOME} "$1" "$@" then 'quoted text' --verbose $(pwd) echo done
+		grep export echo --verbose printf grep /usr/bin printf sed export echo local export
+	printf 'quoted text' readonly /usr/bin export echo x=1 $(pwd) $(pwd) $(pwd) awk
+	-eu local $(pwd) printf done /usr/bin -eu 'quoted text'
+		test --verbose local $(pwd) x=1
+		--verbose | && test then 'quoted text' sed then printf
+export "$1" | && "$1"
+/usr/bin printf "$1" 'quoted text' 'quoted text'
+	/usr/bin 2>/dev/null
+		sed readonly printf done --verbose echo sed awk ${HOME} ${HOME} ${HOME} printf
+2>/dev/null 2>/dev/null --verbose done
+	done --verbose 2>/dev/null local $(pwd)
+		-eu then --verbose /usr/bin sed --verbose /usr/bin "$@" grep
+		readonly printf local local echo ${HOME} sed echo --verbose "$@"
+	--verbose grep | -eu "$@" grep x=1 test
+		echo printf 'quoted text' -eu grep --verbose
+		--verbose then export local done /usr/bin 'quoted text' echo
+		cd /usr/bin done printf && ${HOME} awk export x=1 && "$1" 2>/dev/null done grep
+local ${HOME} awk then cd | readonly
+	grep awk /usr/bin "$@" printf "$@" done | test local "$1" $(pwd) && -eu done
+sed "$@" done test echo then "$1" sed
+test test echo export done cd $(pwd) echo --verbose grep && cd 2>/dev/null
+	x=1 grep export done 'quoted text' echo sed x=1 grep export
+cd then export printf grep test --verbose /usr/bin /usr/bin export printf
+	done --verbose local ${HOME} grep x=1 /usr/bin grep /usr/bin printf export
+		test "$@" "$@" readonly awk 'quoted text' --verbose cd sed done "$@" then ${HOME}
+	grep local -eu 'quoted text' | then printf && -eu -eu done --verbose
+/usr/bin -eu | export local cd cd "$1"
+		-eu | "$1" sed --verbose "$1" "$1" grep -eu x=1
+	2>/dev/null awk readonly $(pwd)
+		"$1" "$@" sed | x=1 cd "$1" then awk sed ${HOME} "$@" && cd 2>/dev/null
+	echo 2>/dev/null grep readonly
+then echo awk cd grep "$@" then awk
+		done awk grep "$@" printf "$@" /usr/bin
+		${HOME} sed --verbose then $(pwd) $(pwd) cd x=1 ${HOME} -eu
+2>/dev/null local sed export
+--verbose 'quoted text' $(pwd) done "$1" "$1"
+		sed awk -eu done && ${HOME} -eu
+then sed local echo grep -eu readonly readonly then 2>/dev/null local "$@" export
+	local --verbose 'quoted text' echo "$@" "$1" then export 'quoted text'
+		sed export 2>/dev/null readonly local 'quoted text' | then
+	local echo readonly sed grep ${HOME} export readonly --verbose
+	"$1" -eu "$1" ${HOME} x=1 test $(pwd) then test
+		echo "$1" then --verbose 2>/dev/null then printf then awk "$1" sed "$@" ${HOME}
+sed "$@" local printf
+	done 'quoted text' sed then
+	readonly "$@" "$@" export
+		| done readonly printf
+readonly test 2>/dev/null /usr/bin
+	/usr/bin ${HOME} test --verbose done printf readonly sed --verbose
+2>/dev/null sed "$@" sed -eu x=1 printf echo printf | ${HOME} "$@" "$@" local
+awk "$1" $(pwd) x=1 x=1 local sed | x=1 "$1"
+	'quoted text' echo $(pwd) sed echo x=1 done 'quoted text' test local test
+| awk --verbose "$@" printf $(pwd) 'quoted text'
+${HOME} cd | "$1" "$@" local && then printf && | -eu "$@" -eu
+	sed grep "$1" --verbose -eu
+/usr/bin grep "$1" | export export 2>/dev/null -eu $(pwd)
+	printf local && printf $(pwd) 'quoted text' | "$1" x=1
+		local export then grep --verbose printf grep
+$(pwd) awk $(pwd) done printf
+		&& local --verbose --verbose x=1 && | local "$1" ${HOME} export test
+	readonly then $(pwd) readonly grep test awk
+		printf readonly echo 2>/dev/null 'quoted text' grep local
+		local 'quoted text' | 2>/dev/null export then --verbose
+echo printf grep x=1 done export 'quoted text' echo grep
+		printf $(pwd) echo done
+printf $(pwd) then printf
+		"$@" done x=1 x=1 cd readonly | printf "$1" done /usr/bin
+"$@" done 'quoted text' $(pwd) cd sed x=1 | 'quoted text' 2>/dev/null then "$1"
+	printf $(pwd) "$@" x=1 /usr/bin $(pwd) | then cd
+	| x=1 sed /usr/bin echo awk | x=1 "$1" export --verbose 'quoted text' -eu
+		'quoted text' test "$@" --verbose
+		test | ${HOME} "$@" | "$@" grep
+test test x=1 sed | 2>/dev/null "$@" grep
+grep local export /usr/bin sed sed "$1" $(pwd)
+		readonly test printf --verbose sed "$@" done
+--verbose -eu done done | test
+test x=1 /usr/bin export local awk readonly cd test
+		export /usr/bin "$@" grep && echo done && $(pwd) x=1 printf && local --verbose
+/usr/bin "$@" export 'quoted text' --verbose /usr/bin sed
+&& && test sed "$@" x=1 | ${HOME} sed 2>/dev/null
+	&& printf "$@" grep -eu awk printf grep echo "$1" then test "$@"
+"$1" grep export /usr/bin echo 'quoted text'
+		/usr/bin 'quoted text' /usr/bin local done 'quoted text' sed "$1" local x=1 awk
+	-eu x=1 echo grep "$1" cd export
+	awk $(pwd) test -eu -eu --verbose
+	test x=1 | "$@" $(pwd)
+		done awk then $(pwd) 'quoted text' 2>/dev/null | 'quoted text' printf 'quoted text'
+	${HOME} sed --verbose --verbose x=1 echo $(pwd) x=1 printf
+	cd export export sed done sed export
+		x=1 x=1 "$1" | printf then printf
+	&& readonly ${HOME} /usr/bin -eu then export --verbose
+		'quoted text' "$@" 2>/dev/null && "$1"
+		awk "$@" echo awk 2>/dev/null x=1 "$1" && sed awk test /usr/bin
+	done --verbose -eu then 'quoted text' cd grep -eu export ${HOME}
+		sed echo local --verbose "$@" /usr/bin ${HOME} readonly "$@" x=1
+		| $(pwd) printf 'quoted text' "$1" 2>/dev/null test | 'quoted text' | cd
+		readonly ${HOME} /usr/bin local
+	x=1 && printf done export /usr/bin --verbose
+done ${HOME} -eu then |
+	done --verbose test done ${HOME} && -eu echo $(pwd) test $(pwd)
+		-eu --verbose local x=1 test && test --verbose
+printf 'quoted text' 'quoted text' --verbose awk | 2>/dev/null
+${HOME} readonly readonly export "$1" awk
+		sed done ${HOME} done echo | && printf cd "$1" $(pwd) "$@"
+	'quoted text' printf awk | -eu export
+	done --verbose sed x=1 export local 2>/dev/null && x=1 && "$1"
+		/usr/bin ${HOME} local && cd
+		local ${HOME} awk ${HOME}
+echo ${HOME} | export x=1 "$1" cd | readonly "$@" printf echo export sed awk
+		done readonly readonly "$1" local readonly 'quoted text' "$@" readonly "$@" done
+x=1 local sed then -eu
+2>/dev/null echo done echo $(pwd) x=1
+&& readonly awk export then sed 2>/dev/null 2>/dev/null -eu printf "$1" cd readonly
+		done $(pwd) $(pwd) ${HOME} done /usr/bin 'quoted text' grep awk
+	printf printf test printf export | done
+	x=1 'quoted text' | $(pwd) then 'quoted text' done && export "$@" echo &&
+		2>/dev/null && readonly "$@" printf cd cd 'quoted text' 2>/dev/null
+		cd export cd test export -eu printf export awk grep test awk export
+		| -eu done local cd grep sed
+	done printf x=1 "$@" | "$@" awk x=1
+/usr/bin cd -eu grep awk export |
+	&& $(pwd) local echo export /usr/bin echo local 'quoted text' readonly awk &&
+	printf -eu | $(pwd) /usr/bin echo ${HOME} ${HOME} --verbose grep
+		${HOME} 2>/dev/null export export awk | ${HOME} echo "$1"
+"$@" "$1" printf test awk $(pwd) awk export && --verbose readonly
+local sed readonly printf
+	cd | ${HOME} then -eu
+	/usr/bin | export cd readonly printf local echo local "$1"
+		local --verbose done "$@" done sed
+	"$@" local -eu -eu x=1 --verbose
+	echo export local | 2>/dev/null grep
+	printf sed -eu 2>/dev/null test local awk
+echo ${HOME} echo "$@" done x=1 then readonly && ${HOME} && -eu printf
+export grep test x=1 test grep -eu local ${HOME} 'quoted text' awk &&
+		x=1 'quoted text' "$1" "$@" ${HOME} -eu
+"$@" done export cd printf "$1" 2>/dev/null
+	x=1 readonly /usr/bin grep --verbose
+sed 2>/dev/null awk /usr/bin export x=1 export sed
+		grep done readonly echo 2>/dev/null export -eu printf test grep echo "$@" $(pwd)
+		&& test awk readonly "$@" local --verbose ${HOME} 'quoted text' --verbose test 2>/dev/null
+then echo awk | ${HOME} 2>/dev/null test then -eu test
+	echo && $(pwd) test $(pwd) 2>/dev/null local "$1" awk "$@" /usr/bin
+		--verbose export printf
+	echo done printf 2>/dev/null grep echo
+	cd cd done awk | local -eu ${HOME} --verbose readonly
+local cd test x=1 "$@" export echo && --verbose test | sed
+done -eu -eu sed local |
+	--verbose readonly "$1" local awk /usr/bin
+		local test local awk 'quoted text' | 'quoted text' ${HOME} "$@" local --verbose
+	awk | x=1 2>/dev/null then grep sed | x=1 &&
+		-eu sed cd cd $(pwd) then "$1" awk echo --verbose
+	local then "$1" --verbose done grep
+		${HOME} export export ${HOME} 2>/dev/null awk "$1" echo done 'quoted text' then
+--verbose cd cd ${HOME} && export cd readonly readonly test ${HOME} local
+done /usr/bin done sed -eu awk /usr/bin
+		cd grep 2>/dev/null "$1"
+	echo done ${HOME} -eu | "$1" && --verbose "$@" | awk
+	2>/dev/null export 'quoted text'
+	&& 'quoted text' "$1" 2>/dev/null 2>/dev/null ${HOME} printf
+		${HOME} "$1" $(pwd) cd cd --verbose readonly then export -eu awk awk sed &&
+	$(pwd) x=1 done && /usr/bin
+	readonly done ${HOME} x=1 $(pwd) sed then printf
+	| export -eu test done 'quoted text' /usr/bin
+readonly local x=1 readonly $(pwd) 2>/dev/null readonly printf
+2>/dev/null done | grep export
+/usr/bin then $(pwd) ${HOME} test test x=1
+		awk then | "$1" 'quoted text' sed | && --verbose /usr/bin
+	"$1" then "$1" --verbose --verbose grep
+		test "$1" printf grep echo test x=1 echo "$1"
+	readonly then test grep "$1" | $(pwd) --verbose
+/usr/bin "$1" /usr/bin /usr/bin printf "$1" ${HOME} 2>/dev/null x=1 -eu $(pwd)
+		&& awk sed then && then --verbose
+	awk | grep && x=1 done "$@"
+--verbose && readonly --verbose printf -eu 2>/dev/null $(pwd) --verbose
+	readonly printf 2>/dev/null | /usr/bin 'quoted text' then sed x=1 cd readonly
+		done grep done grep then local "$1" --verbose $(pwd)
+	then 'quoted text' ${HOME} "$@" --verbose grep | printf sed 'quoted text'
+"$1" export test | sed test -eu && echo 2>/dev/null /usr/bin "$1" cd 'quoted text'
+		| x=1 | done sed $(pwd) echo
+grep echo && test awk -eu && cd && readonly then "$1"
+	/usr/bin awk printf printf 'quoted text' 'quoted text'
+-eu 2>/dev/null "$@" sed -eu awk --verbose echo cd /usr/bin x=1 export 2>/dev/null
+		-eu echo --verbose cd
+/usr/bin 2>/dev/null 2>/dev/null grep awk | "$@"
+test x=1 sed readonly ${HOME} done ${HOME} $(pwd) ${HOME} printf then test
+		echo $(pwd) done 2>/dev/null cd printf readonly then /usr/bin cd test grep "$@"
+-eu && -eu 2>/dev/null 2>/dev/null x=1 'quoted text' awk && then
+echo export 'quoted text' 2>/dev/null && local local "$1" grep local
+2>/dev/null cd "$@" done grep | done 'quoted text' then /usr/bin awk local
+export && --verbose grep
+${HOME} /usr/bin cd awk -eu ${HOME} --verbose
+"$1" then ${HOME} then /usr/bin test
+	| | 2>/dev/null 'quoted text'
+		--verbose $(pwd) x=1 "$1" test $(pwd) echo 2>/dev/null sed ${HOME}
+		"$@" printf then test --verbose awk sed $(pwd) 'quoted text'
+	test then /usr/bin printf x=1 echo ${HOME} readonly 2>/dev/null
+	&& --verbose 2>/dev/null cd export readonly sed then ${HOME} "$1" export
+		export 2>/dev/null test awk sed 2>/dev/null x=1 test && x=1 'quoted text'
+--verbose 2>/dev/null -eu awk "$1" sed test "$1" cd "$@" x=1
+	-eu --verbose | --verbose
+	x=1 awk awk 'quoted text' "$1" 2>/dev/null
+		${HOME} 2>/dev/null -eu local
+		/usr/bin "$1" awk $(pwd) 2>/dev/null sed test grep /usr/bin local readonly
+	${HOME} $(pwd) 'quoted text' -eu | cd 2>/dev/null
+	sed cd grep "$@" sed done x=1 export 2>/dev/null "$1" echo export
+	done && readonly echo 'quoted text' printf
+grep grep test 'quoted text' awk echo
+--verbose && 'quoted text' "$@" 'quoted text' --verbose echo awk done
+	"$1" | then 'quoted text' x=1 then grep test $(pwd)
+		done $(pwd) | x=1 ${HOME} $(pwd) done done "$@" x=1 readonly
+	${HOME} awk export awk && $(pwd) done local --verbose | echo export test echo done
+export 'quoted text' "$@" cd echo echo local readonly &&
+		"$@" readonly local echo -eu export x=1 | | $(pwd) 2>/dev/null readonly | && test
+	cd export echo readonly
+	then cd then 2>/dev/null -eu "$@" readonly
+		"$1" && awk | x=1 awk --verbose
+		sed then export sed /usr/bin readonly cd readonly sed | -eu cd "$@" printf
+	sed echo export 'quoted text'
+echo grep && then echo cd
+$(pwd) grep /usr/bin sed | 2>/dev/null local && local &&
+	test echo -eu export readonly
+		then /usr/bin printf 2>/dev/null x=1 2>/dev/null
+	"$1" ${HOME} -eu 2>/dev/null cd export test cd ${HOME} 2>/dev/null $(pwd)
+	printf local 'quoted text' echo
+	'quoted text' "$@" sed "$@" "$@" echo ${HOME} printf sed cd && 2>/dev/null then
+	local 2>/dev/null local test local "$1" -eu ${HOME}
+		printf cd ${HOME} export done "$1" grep local && test cd cd cd printf
+"$1" ${HOME} sed x=1 | cd 2>/dev/null | printf
+'quoted text' --verbose sed
+	${HOME} local /usr/bin
+	local local grep x=1 export echo && test 'quoted text' 'quoted text' readonly local
+sed --verbose grep -eu && cd "$@" | --verbose
+-eu -eu export awk sed
+cd --verbose readonly sed done readonly /usr/bin
+awk test readonly local export
+done | readonly --verbose "$@" cd local "$1" readonly printf | $(pwd)
+sed x=1 x=1 then -eu then awk "$@" cd "$@" && --verbose
+		export cd export echo sed /usr/bin then $(pwd)
+		$(pwd) readonly export done $(pwd) done -eu -eu test x=1 $(pwd)
+local echo done readonly sed --verbose "$@" echo
+	| readonly 2>/dev/null done cd echo --verbose 2>/dev/null grep readonly $(pwd)
+${HOME} 2>/dev/null && echo readonly printf export readonly
+	printf local 'quoted text' grep $(pwd) --verbose 2>/dev/null printf "$@"
+cd -eu export awk && awk ${HOME} then done --verbose x=1 readonly | done
+	done cd then local ${HOME} --verbose -eu sed "$1" /usr/bin ${HOME} && echo
+x=1 local echo test | test grep sed export export echo then /usr/bin then awk --verbose
+	echo "$1" echo then test 2>/dev/null printf then $(pwd) awk --verbose
+x=1 local && --verbose "$@" echo readonly then sed 2>/dev/null readonly
+		x=1 echo x=1 grep -eu && cd | awk sed local
+		local echo done then /usr/bin done && "$@" 2>/dev/null local then /usr/bin readonly
+	readonly "$1" --verbose echo x=1 /usr/bin 2>/dev/null
+		done readonly then awk && ${HOME} done sed then readonly -eu ${HOME}
+"$@" awk test --verbose | 'quoted text' export printf readonly "$@" --verbose
+		&& printf awk readonly cd local
+local awk && -eu ${HOME} && then 2>/dev/null
+		2>/dev/null grep "$@" -eu echo x=1 && grep | grep "$1" sed
+$(pwd) local "$@" then
+		export echo 2>/dev/null -eu "$@" --verbose x=1 done readonly 2>/dev/null
+	x=1 /usr/bin readonly
+done x=1 awk cd && test ${HOME} x=1 local --verbose 'quoted text' awk
+	grep 'quoted text' 'quoted text' echo && 'quoted text' x=1 grep && "$@" cd export
+		then "$@" /usr/bin $(pwd) readonly
+	'quoted text' awk then --verbose echo echo grep $(pwd) "$@" then cd
+		done "$1" 2>/dev/null then awk then && /usr/bin then && ${HOME}
+		grep && "$@" printf cd printf test /usr/bin x=1 "$1" cd done then $(pwd)
+	local 'quoted text' done readonly && test |
+		awk done sed readonly && ${HOME} sed printf x=1 --verbose export "$@" cd local
+		echo printf export local
+/usr/bin 2>/dev/null
+2>/dev/null awk echo grep && sed sed 'quoted text' |
+		x=1 && $(pwd) grep local readonly export $(pwd)
+	/usr/bin then printf cd x=1 "$@" $(pwd) then export
+#include c104.sh
+		local && "$@" grep grep && printf ${HOME} sed then awk printf echo 'quoted text'
+		awk cd then "$1" "$@" readonly local grep
+	--verbose export local cd /usr/bin
+		2>/dev/null | readonly ${HOME} test test 2>/dev/null
+	done awk test cd done test x=1 grep $(pwd) ${HOME} done $(pwd) local
+	${HOME} then 2>/dev/null --verbose test
+		$(pwd) -eu x=1 $(pwd)
+		cd then /usr/bin printf 2>/dev/null readonly --verbose
+	/usr/bin awk sed export /usr/bin --verbose local local
+x=1 awk test "$1" 'quoted text' x=1 /usr/bin
+		"$1" readonly readonly echo
+&& sed && /usr/bin $(pwd) echo
+cd /usr/bin -eu then cd export 2>/dev/null --verbose export "$@"
+/usr/bin done printf done $(pwd) printf test
+	${HOME} grep then --verbose readonly "$1"
+echo echo "$1" local then echo readonly test printf then
+		| grep grep printf | done "$1"
+		--verbose readonly done awk ${HOME} printf test export sed $(pwd) local
+--verbose test 'quoted text' /usr/bin
+$(pwd) -eu echo echo /usr/bin
+test 2>/dev/null | $(pwd) ${HOME}
+		$(pwd) | | --verbose /usr/bin x=1 2>/dev/null --verbose x=1 done --verbose sed
+		readonly grep "$1" then done grep local grep
+		sed 'quoted text' printf readonly sed x=1 $(pwd) printf awk done "$1" echo
+then export | echo 2>/dev/null $(pwd) $(pwd)
+echo 2>/dev/null ${HOME} "$@" local 'quoted text' cd cd readonly "$@" 2>/dev/null
+	"$1" --verbose then printf
+	| echo test /usr/bin sed echo && ${HOME} then 2>/dev/null readonly /usr/bin
+| 'quoted text' export then --verbose ${HOME} /usr/bin local 'quoted text'
+		awk export && sed readonly
+		grep sed local export awk done local readonly
+done grep readonly printf ${HOME} awk "$@" "$1" done 2>/dev/null done
+	2>/dev/null /usr/bin | x=1 cd awk $(pwd) export -eu x=1 ${HOME}
+/usr/bin echo --verbose | test "$1" test local "$@" readonly "$1" then printf
+	&& "$@" --verbose export ${HOME}
+	done && echo sed readonly awk -eu printf readonly done local 'quoted text' export
+		${HOME} awk sed export -eu ${HOME} | sed echo
+	grep | done && export "$@" 'quoted text' x=1 "$@" grep done readonly awk &&
+	cd --verbose echo $(pwd) cd "$@" export "$@" echo --verbose sed local echo "$@"
+		local cd 2>/dev/null grep x=1
+&& cd x=1 then sed 2>/dev/null
+	grep awk 2>/dev/null -eu x=1 ${HOME} $(pwd)
+--verbose export then -eu "$@" cd sed /usr/bin local 2>/dev/null awk x=1 -eu "$@"
+	-eu awk cd awk 2>/dev/null
+'quoted text' && 'quoted text' readonly readonly cd ${HOME} "$@" $(pwd) done then
+	export "$@" 2>/dev/null echo cd -eu && -eu echo test $(pwd)
+/usr/bin cd then readonly done readonly export
+	readonly export && -eu 'quoted text' "$@" "$1" test test ${HOME}
+		sed local "$@" ${HOME} done /usr/bin sed
+		then export | awk then test export test 'quoted text' | ${HOME} --verbose
+'quoted text' grep $(pwd) -eu done printf --verbose x=1 grep /usr/bin readonly
+		grep x=1 ${HOME} local --verbose $(pwd)
+	sed "$1" "$@" done local | | "$@" echo printf
+sed $(pwd) test printf | 'quoted text' grep readonly
+	then "$@" ${HOME} echo 'quoted text' export readonly
+cd printf x=1 printf --verbose /usr/bin 2>/dev/null $(pwd) 'quoted text'
+grep /usr/bin test readonly
+	x=1 2>/dev/null $(pwd) readonly 2>/dev/null
+$(pwd) 'quoted text' sed ${HOME} local 2>/dev/null cd then /usr/bin
+		then then "$@" local then export local sed awk /usr/bin export 2>/dev/null
+	$(pwd) echo echo test done x=1 'quoted text' 'quoted text' awk local export
+	printf echo printf local &&
+		readonly $(pwd) "$1" awk grep "$1" && done "$1" 'quoted text' && $(pwd)
+sed | then $(pwd) then echo sed ${HOME} export sed cd done --verbose
+'quoted text' printf 'quoted text' "$@" then x=1 --verbose ${HOME}
+2>/dev/null | 2>/dev/null done then export test
+		then cd x=1 && 'quoted text' 2>/dev/null ${HOME} readonly
+"$@" x=1 | | awk --verbose done ${HOME} local
+	export test --verbose x=1 && ${HOME} sed && test 2>/dev/null
+		"$1" awk x=1 "$@" printf echo "$1" | echo x=1 2>/dev/null
+		${HOME} /usr/bin x=1 "$1" -eu $(pwd) $(pwd) "$1" --verbose
+	x=1 echo grep printf sed done awk -eu test | awk | -eu printf 'quoted text'
+readonly --verbose awk awk grep /usr/bin cd echo local echo "$1" sed
+	| -eu sed done -eu grep 'quoted text' /usr/bin
+		"$@" 'quoted text' then ${HOME} sed --verbose
+		awk "$1" cd -eu awk ${HOME}
+	"$1" "$@" then export grep local "$@" readonly x=1 test sed | sed
+	cd && && echo "$1" echo printf then test grep export "$1" export done /usr/bin ${HOME}
+	x=1 cd then done done && awk 'quoted text' | x=1 'quoted text'
+test sed grep ${HOME} local test then "$1" -eu export x=1 sed ${HOME} --verbose
+&& x=1 cd then 'quoted text' awk /usr/bin printf
+		"$1" test $(pwd) && --verbose "$1" cd 'quoted text'
+	"$1" export && test done | "$@" export
+done | --verbose $(pwd) /usr/bin 'quoted text' -eu $(pwd)
+		sed x=1 2>/dev/null "$1" sed local sed
+	test test x=1 echo "$1" test x=1 2>/dev/null done "$1" sed x=1 test | 'quoted text'
+printf "$@" awk done sed sed 2>/dev/null | "$@" 2>/dev/null
+		$(pwd) done && "$@" then done && /usr/bin 2>/dev/null --verbose -eu $(pwd)
+"$@" x=1 "$@" echo "$@" $(pwd)
+sed x=1 && then export -eu sed
+		local then 2>/dev/null 2>/dev/null "$@" printf --verbose export
+		'quoted text' --verbose | sed 'quoted text' done ${HOME} printf
+	sed -eu x=1 x=1 -eu sed
+	x=1 && local printf && "$1" -eu -eu sed "$@" "$1" export then --verbose
+printf x=1 'quoted text' export local awk printf 2>/dev/null -eu
+&& readonly cd --verbose
+echo $(pwd) ${HOME} local
+	awk -eu ${HOME} && local local sed done printf && --verbose cd -eu $(pwd)
+	echo then export printf $(pwd) 'quoted text' ${HOME} test
+	readonly local grep --verbose $(pwd) x=1 cd readonly
+awk sed "$@" sed 2>/dev/null "$1" --verbose -eu x=1 export
+	printf --verbose test | x=1
+&& $(pwd) 2>/dev/null done $(pwd) 'quoted text'
+local 2>/dev/null 2>/dev/null /usr/bin
+		cd 'quoted text' 2>/dev/null cd ${HOME} /usr/bin done ${HOME} 2>/dev/null
+	$(pwd) | ${HOME} -eu ${HOME}
+	"$@" test cd 'quoted text' then "$1" done printf echo
+done && | then cd /usr/bin "$@" -eu 'quoted text' ${HOME} |
+	readonly ${HOME} local 2>/dev/null --verbose grep export
+	done "$1" grep --verbose && export readonly done grep export readonly
+		local 'quoted text' "$1"
+/usr/bin test && done | sed x=1 then awk x=1 | -eu echo awk $(pwd) -eu then
+		awk "$1" grep 'quoted text' 'quoted text' /usr/bin 'quoted text'
+	"$@" sed local | readonly export grep 'quoted text' echo "$@"
+readonly --verbose local printf "$1" $(pwd)
+		--verbose --verbose $(pwd) awk 'quoted text' /usr/bin
+		awk test done -eu cd test 'quoted text' "$@" echo test && done cd -eu
+	x=1 "$@" "$@" test local -eu 'quoted text'
+	x=1 grep local /usr/bin cd | echo echo sed 2>/dev/null | echo /usr/bin local
+		cd "$@" 2>/dev/null x=1 /usr/bin export cd export echo then && 2>/dev/null $(pwd)
+		$(pwd) then sed export "$1" cd $(pwd) "$@" "$1"
+	2>/dev/null "$1" echo test "$@" local test readonly export -eu readonly then
+		"$@" done $(pwd) 2>/dev/null 2>/dev/null awk grep export
+done printf echo | x=1 | ${HOME} x=1 /usr/bin local $(pwd) export
+		${HOME} "$@" printf "$@" ${HOME}
+	&& awk /usr/bin "$1" $(pwd) -eu local readonly
+export then ${HOME} /usr/bin
+	--verbose | readonly then x=1 'quoted text' test $(pwd)
+printf readonly "$@" $(pwd) done sed then ${HOME}
+	/usr/bin | grep readonly "$1" 2>/dev/null cd printf done sed awk "$@"
+-eu awk export /usr/bin done | done "$1" cd 2>/dev/null grep /usr/bin 'quoted text'
+	awk $(pwd) ${HOME} export done /usr/bin done cd "$1" readonly test readonly
+$(pwd) sed then /usr/bin x=1 $(pwd) ${HOME} cd local "$@" "$1" 2>/dev/null $(pwd)
+	awk /usr/bin 2>/dev/null export "$@" ${HOME} 'quoted text' local -eu -eu 'quoted text'
+	grep "$1" "$1" /usr/bin test ${HOME} 'quoted text' && ${HOME}
+	test && sed --verbose readonly && "$1"
+		--verbose awk $(pwd) x=1 $(pwd) -eu cd
+		${HOME} --verbose 'quoted text' grep 2>/dev/null
+	grep echo grep export then && then $(pwd) | local ${HOME}
+"$1" grep test local grep | export awk "$@" "$@" then |
+"$@" local sed printf test 'quoted text'
+	"$1" --verbose then "$@" "$@" --verbose x=1 $(pwd) "$1" test -eu | echo awk cd
+export then "$1" && awk 'quoted text'
+	2>/dev/null echo local awk printf "$1" "$@" 'quoted text' then
+	readonly --verbose -eu --verbose sed && 'quoted text' 'quoted text'
+	local test test then --verbose cd --verbose sed
+		echo ${HOME} --verbose readonly x=1 awk sed "$1" | 'quoted text'
+		&& awk $(pwd) echo 2>/dev/null | done x=1 | ${HOME} test then done
+readonly done test done then /usr/bin sed 'quoted text' cd | echo
+/usr/bin sed awk export 2>/dev/null awk cd echo printf
+"$1" $(pwd) --verbose echo -eu | && /usr/bin
+		awk export echo echo 2>/dev/null
+		test 'quoted text' "$1" "$@" -eu -eu sed
+sed 2>/dev/null printf printf --verbose then ${HOME}
+		local -eu && then "$@" "$@" && "$1" -eu
+--verbose done $(pwd) local export -eu 'quoted text'
+	test local grep echo --verbose test grep --verbose --verbose
+	2>/dev/null sed x=1 echo --verbose local -eu grep -eu
+		"$@" 2>/dev/null cd /usr/bin grep /usr/bin x=1 done cd -eu | -eu done done
+		awk cd local | readonly test -eu done
+		| ${HOME} ${HOME} cd "$1"
+	awk 'quoted text' done local
+		&& then test /usr/bin 2>/dev/null
+&& --verbose x=1 /usr/bin
+grep $(pwd) then export -eu && then && grep echo
+	/usr/bin && echo --verbose /usr/bin printf && 'quoted text' echo "$1"
+		then grep test cd $(pwd) test
+	${HOME} $(pwd) -eu local local --verbose -eu 2>/dev/null grep readonly
+		'quoted text' test test ${HOME} local 2>/dev/null done
+"$1" ${HOME} 'quoted text' "$1" 'quoted text'
+	"$@" grep done done printf
+		"$@" "$1" cd export $(pwd) | local then ${HOME} 2>/dev/null && $(pwd) echo readonly
+		"$1" then local grep test --verbose /usr/bin
+	x=1 "$@" grep -eu test
+printf ${HOME} awk $(pwd) x=1 done "$@" 2>/dev/null echo
+		grep export then $(pwd) 'quoted text' grep printf $(pwd) done "$@"
+awk --verbose "$1" done 'quoted text' awk 2>/dev/null
+		--verbose test && done 'quoted text' --verbose
+		'quoted text' export cd "$1" /usr/bin 2>/dev/null 2>/dev/null readonly printf
+	sed ${HOME} echo /usr/bin -eu 2>/dev/null then printf 2>/dev/null
+x=1 x=1 x=1 | 'quoted text' ${HOME} 2>/dev/null
+2>/dev/null done local echo sed readonly then awk $(pwd) test
+		readonly | ${HOME} &&
+	done 2>/dev/null grep -eu "$@" cd --verbose "$@" grep printf
+		"$@" && local awk cd x=1 grep grep echo
+		--verbose awk awk test /usr/bin sed 2>/dev/null $(pwd) done grep done
+done x=1 ${HOME} readonly awk export -eu /usr/bin
+		| "$1" echo "$1" -eu && 'quoted text' test export
+	done 2>/dev/null cd test sed
+	2>/dev/null grep printf done export
+		/usr/bin printf | ${HOME} echo && "$1" 2>/dev/null sed grep && "$1" export
+		| done ${HOME} x=1 sed sed "$@" "$1" -eu then &&
+		${HOME} sed && "$1" ${HOME} "$@" done awk && && 'quoted text' 'quoted text' ${HOME}
+test sed done done | awk awk /usr/bin "$1"
+	2>/dev/null -eu grep && 'quoted text'
+test "$1" "$@" echo | "$1" echo export cd export
+	/usr/bin printf $(pwd) $(pwd) then | "$1" then export x=1 then awk cd
+		x=1 "$1" export printf --verbose "$@" x=1 "$1" test grep x=1 --verbose cd test readonly
+cd "$@" -eu 2>/dev/null echo "$@" awk x=1 'quoted text'
+grep echo readonly export printf readonly 'quoted text'
+		sed test echo then "$@" && export 'quoted text'
+		done 'quoted text' "$1" $(pwd) test printf
+		&& 2>/dev/null -eu grep /usr/bin $(pwd) 'quoted text' 'quoted text' $(pwd) grep
+		readonly /usr/bin export export then -eu done | /usr/bin "$1" printf
+echo printf && | x=1 2>/dev/null "$@" -eu awk /usr/bin local echo $(pwd)
+then readonly --verbose then sed cd printf export $(pwd) $(pwd)
+		readonly 'quoted text' /usr/bin /usr/bin -eu ${HOME}
+	awk | printf readonly local $(pwd) 2>/dev/null
+		"$@" export --verbose --verbose sed
+	"$@" done 2>/dev/null grep
+export ${HOME} cd sed cd "$1" 'quoted text' awk $(pwd)
+cd awk readonly then ${HOME} && | $(pwd)
+	printf 2>/dev/null printf 'quoted text' "$1" $(pwd) readonly
+		"$1" ${HOME} readonly && grep 'quoted text' "$@" "$@" --verbose then
+printf export x=1 local
+	done readonly $(pwd) --verbose ${HOME}
+		| test "$1" readonly then && echo sed ${HOME} test $(pwd)
+--verbose "$@" cd && sed | /usr/bin 'quoted text' "$1" cd
+		grep 'quoted text' sed "$1" "$@" test --verbose "$@" "$@"
+	test -eu echo test -eu export /usr/bin | awk 2>/dev/null
+		$(pwd) then local ${HOME} local "$1"
+	"$@" -eu --verbose readonly sed readonly then cd -eu --verbose
+test readonly echo grep 'quoted text' && echo 'quoted text'
+	"$@" sed cd "$1" "$1"
+		readonly 2>/dev/null test | 2>/dev/null grep export --verbose sed
+	"$1" grep awk /usr/bin /usr/bin $(pwd) test local
+	-eu 'quoted text' 'quoted text' export ${HOME} export | test
+"$1" 'quoted text' "$1" readonly
+		readonly "$@" $(pwd) $(pwd) awk export x=1 printf readonly printf
+readonly cd grep sed -eu cd test 'quoted text'
+	| readonly done echo $(pwd) 2>/dev/null
+		${HOME} readonly x=1 "$@" && 2>/dev/null 'quoted text' |
+	| export $(pwd) then ${HOME} export done export ${HOME} local 2>/dev/null "$@"
+		done cd local awk then grep then local "$@" && grep then export test awk $(pwd)
+		&& && export test && then
+2>/dev/null export local readonly -eu "$1" readonly cd --verbose readonly
+		then awk && export | /usr/bin export 2>/dev/null ${HOME} -eu echo | sed export
+	sed export && /usr/bin $(pwd) ${HOME} printf 'quoted text' sed /usr/bin
+grep echo cd 'quoted text' && /usr/bin grep echo echo cd printf cd "$1" $(pwd)
+		| printf then test printf
+	x=1 local x=1 | ${HOME} "$1" echo 2>/dev/null 'quoted text' cd x=1 "$@"
+	"$1" -eu 2>/dev/null && /usr/bin
+then --verbose 2>/dev/null then test
+		local -eu done -eu | local export export ${HOME} local 2>/dev/null
+| test sed -eu grep test echo 'quoted text'
+		readonly -eu printf && local /usr/bin grep done -eu test 2>/dev/null x=1 | grep
+$(pwd) "$1" export cd grep
+		&& | test 'quoted text' grep export cd readonly local ${HOME} awk export "$1"
+	-eu x=1 grep grep x=1 readonly test ${HOME} then
+local test 'quoted text' echo done cd && test | "$@" printf
+2>/dev/null -eu readonly printf done cd grep | echo ${HOME}
+		done -eu | "$@" "$@" printf cd /usr/bin then grep $(pwd) x=1 echo --verbose
+		readonly printf done "$@"
+export done "$1" $(pwd)
+${HOME} awk --verbose "$@" -eu ${HOME} "$@" /usr/bin "$1" $(pwd)
+	awk sed "$1" grep --verbose readonly test "$1" ${HOME}
+echo printf "$1" then &&
+	sed sed "$1" | local local -eu 'quoted text' x=1 readonly
+	readonly sed | | printf x=1 x=1 test
+| done export readonly export export local --verbose
+| && done awk | export
+	readonly grep "$@" local -eu | $(pwd) local echo | then export
+export $(pwd) then 'quoted text'
+		--verbose --verbose "$@" done "$@" grep printf --verbose
+x=1 readonly x=1 /usr/bin export --verbose local done 2>/dev/null
+		"$1" --verbose cd done 'quoted text' cd --verbose cd awk echo then grep
+		${HOME} cd then --verbose export then x=1
+		"$1" readonly /usr/bin printf -eu "$@" sed grep test done cd "$@" awk awk -eu
+		${HOME} then grep "$@" 2>/dev/null /usr/bin 2>/dev/null printf | ${HOME} --verbose
+printf awk /usr/bin grep awk printf x=1 'quoted text'
+		-eu printf --verbose echo sed then awk | ${HOME} 'quoted text' export echo /usr/bin
+local x=1 -eu then 'quoted text' then done done 2>/dev/null
+	"$@" local then "$@" echo done | /usr/bin
+		"$@" local awk 2>/dev/null "$1" --verbose printf "$1" awk done
+		sed 2>/dev/null 'quoted text' ${HOME} local --verbose cd test
+		$(pwd) printf done printf
+	printf ${HOME} "$1" echo 'quoted text'
+/usr/bin $(pwd) sed readonly test export awk 'quoted text' sed
+${HOME} $(pwd) "$1" 2>/dev/null then
+		/usr/bin 'quoted text' test printf local | 2>/dev/null test awk $(pwd) grep 2>/dev/null
+| printf --verbose 'quoted text' "$1" echo
+| /usr/bin grep awk test then grep /usr/bin grep && "$@" readonly
+grep echo grep done printf test | "$@" echo |
+2>/dev/null 'quoted text' done test && && sed grep local done then
+	--verbose done sed sed --verbose 'quoted text'
+		--verbose echo local export -eu then done readonly $(pwd) sed /usr/bin
+		2>/dev/null grep --verbose export && then "$@"
+		&& -eu sed local 'quoted text' awk echo "$1" -eu 2>/dev/null /usr/bin awk
+--verbose grep test cd "$1" printf $(pwd) 'quoted text'
+		$(pwd) "$@" -eu /usr/bin sed x=1 cd then test x=1 "$1" cd echo && export x=1 awk
+$(pwd) cd printf done /usr/bin awk cd "$@" ${HOME}
+		then && grep "$1" "$1" printf 2>/dev/null | test then export /usr/bin local
+"$@" /usr/bin | $(pwd) printf
+		grep /usr/bin 'quoted text' test done
+	echo grep /usr/bin sed x=1 x=1 cd echo cd
+'quoted text' test ${HOME} export then $(pwd) -eu cd echo "$@"
+		'quoted text' export test local cd $(pwd) test $(pwd)
+${HOME} --verbose awk then x=1 -eu -eu $(pwd) sed -eu export
+		done readonly done test local local export 2>/dev/null
+x=1 done export done test /usr/bin readonly awk export done export local local
+	x=1 done local test awk readonly $(pwd) test local echo /usr/bin
+	&& && --verbose "$@" $(pwd) echo local ${HOME} local && printf
+	cd printf then done && | 2>/dev/null
+		done "$1" done sed && printf | local 'quoted text' readonly
+--verbose cd then sed local "$1" "$1" readonly awk then test sed sed test
+2>/dev/null "$@" "$1"
+"$@" $(pwd) sed sed sed ${HOME} grep ${HOME} printf ${HOME} &&
+-eu 'quoted text' done x=1 grep readonly ${HOME} $(pwd) awk x=1
+x=1 'quoted text' 'quoted text' 2>/dev/null "$1" done
+echo ${HOME} 'quoted text' then 2>/dev/null cd awk "$1" awk 'quoted text'
+		&& -eu "$@" grep sed "$@" sed $(pwd) readonly
+	$(pwd) 'quoted text' local
+export && /usr/bin | echo "$@" $(pwd)
+echo "$1" grep "$1" sed | | printf $(pwd) sed 'quoted text'
+		$(pwd) "$@" "$@" 2>/dev/null done | "$1" awk
+-eu sed x=1 2>/dev/null "$@" sed local x=1 test echo local test $(pwd)
+x=1 test done 'quoted text' 'quoted text' readonly test sed 'quoted text'
+	done cd awk test "$@" then readonly then | x=1 $(pwd)
+	/usr/bin ${HOME} 'quoted text' $(pwd) sed "$1" awk "$@"
+		2>/dev/null "$1" | echo cd awk "$@" 'quoted text' echo cd done --verbose
+sed ${HOME} readonly | grep
+	local echo && "$1" sed grep /usr/bin grep
+		--verbose --verbose "$1" "$1" $(pwd) -eu --verbose x=1 echo
+test --verbose --verbose ${HOME} local readonly
+		2>/dev/null 'quoted text'
+/usr/bin x=1 readonly ${HOME}
+		cd awk sed | export done ${HOME} x=1 cd
+		--verbose x=1 echo sed
+--verbose sed "$1" readonly echo echo
+		"$1" && local awk /usr/bin
+	awk /usr/bin echo cd awk "$1" && printf echo readonly echo
+&& 2>/dev/null then $(pwd) 2>/dev/null test grep then cd $(pwd) sed local done
+echo $(pwd) sed "$@" ${HOME} 2>/dev/null && 2>/dev/null test test ${HOME} cd test
+export printf export "$1" --verbose
+		then && 2>/dev/null awk /usr/bin x=1 awk -eu -eu 2>/dev/null done readonly
+	/usr/bin done 'quoted text' local awk sed -eu awk "$1"
+		done -eu then $(pwd) x=1 -eu then 2>/dev/null local
+export "$1" then then -eu echo local export | ${HOME} printf 'quoted text'
+	echo 2>/dev/null $(pwd) printf readonly
+		"$@" "$1" 'quoted text'
+		then "$@" export readonly && sed 'quoted text' /usr/bin printf
+export awk readonly then x=1 awk export --verbose cd 2>/dev/null "$@" /usr/bin
+		$(pwd) -eu "$1" test "$1" cd 2>/dev/null
+x=1 | "$@" export "$@" sed "$1" /usr/bin $(pwd) local 2>/dev/null
+	x=1 local test 'quoted text' "$@" readonly then cd --verbose 2>/dev/null
+	export /usr/bin awk --verbose
+-eu --verbose cd x=1 grep test $(pwd) -eu 'quoted text'
+sed $(pwd) "$1" local export done -eu done && sed done | cd grep
+	printf "$1" "$@" 2>/dev/null --verbose echo sed | "$1" x=1 cd "$1"
+-eu /usr/bin test -eu -eu ${HOME} | "$1"
+		"$@" local sed awk /usr/bin cd -eu | $(pwd) awk then awk
+	$(pwd) printf ${HOME} |
+echo then x=1 /usr/bin "$1" /usr/bin printf test --verbose
+'quoted text' 2>/dev/null echo test readonly awk then --verbose
+2>/dev/null awk readonly 'quoted text' done -eu x=1 awk "$1"
+cd && 2>/dev/null 'quoted text' echo done awk local "$1" done 2>/dev/null
+	-eu grep awk printf && $(pwd) cd grep cd ${HOME} readonly | x=1 |
+		'quoted text' x=1 printf then readonly
+		x=1 2>/dev/null cd && local 2>/dev/null "$@" 2>/dev/null | -eu /usr/bin ${HOME}
+	then "$@" $(pwd) test local readonly x=1 --verbose
+sed /usr/bin && && ${HOME} --verbose readonly printf sed cd ${HOME} /usr/bin
+		&& cd 2>/dev/null ${HOME} 2>/dev/null local
+	2>/dev/null 'quoted text' 2>/dev/null
+	printf -eu then && test grep sed
+		sed cd "$1" $(pwd) readonly sed $(pwd)
+		readonly "$1" "$@" done && /usr/bin readonly /usr/bin done &&
+		grep $(pwd) grep local "$1"
+export 'quoted text' /usr/bin awk awk done /usr/bin cd | printf ${HOME} sed
+$(pwd) --verbose test echo then --verbose --verbose |
+sed echo --verbose test /usr/bin sed --verbose ${HOME} | then |
+	export 2>/dev/null grep /usr/bin local
+	readonly -eu printf done 'quoted text' printf then 2>/dev/null $(pwd)
+	--verbose $(pwd) test | readonly
+${HOME} then x=1 -eu -eu "$@" local x=1 export readonly done sed /usr/bin "$@"
+		export grep 2>/dev/null readonly
+sed | export x=1 "$1" grep printf echo sed 2>/dev/null "$@" local /usr/bin
+--verbose awk 'quoted text' --verbose local
+		local printf echo "$@" | 'quoted text' export local "$1" 'quoted text'
+export test sed readonly --verbose sed done /usr/bin awk
+	| | export test cd echo 'quoted text' x=1 ${HOME} $(pwd) done "$1" "$@" 2>/dev/null
+	test sed 2>/dev/null "$@" "$1" readonly echo done "$@" done && --verbose
+x=1 sed cd "$1" export $(pwd) "$1" printf cd "$@" --verbose echo "$1" 2>/dev/null
+-eu -eu 'quoted text' cd -eu export
+	x=1 export && 2>/dev/null $(pwd) local "$1" "$@" ${HOME} | readonly ${HOME}
+	local 'quoted text' x=1 2>/dev/null
+sed export /usr/bin ${HOME} test sed echo printf
+		/usr/bin ${HOME} cd awk "$@" readonly echo local 2>/dev/null --verbose export export
+$(pwd) --verbose awk grep
+2>/dev/null cd printf done
+export sed "$1" $(pwd) sed
+		local $(pwd) ${HOME} x=1 2>/dev/null
+		"$@" grep awk export -eu grep $(pwd) printf cd test then
+awk grep echo export 2>/dev/null export
+export cd test test /usr/bin awk 2>/dev/null grep "$@" printf -eu then
+	$(pwd) | printf "$@" /usr/bin export 2>/dev/null
+&& $(pwd) && x=1 then local "$@" grep "$1" awk local $(pwd) | then x=1
+		grep $(pwd) done 2>/dev/null cd
+		sed 'quoted text' export awk printf $(pwd) x=1 printf "$1"
+printf sed echo 'quoted text'
+export then "$@" 'quoted text' readonly ${HOME} sed "$1"
+		| --verbose /usr/bin grep then x=1 printf cd readonly export /usr/bin local
+		then ${HOME} sed "$1" grep ${HOME} readonly
+"$@" "$1" printf "$1" x=1 "$@" sed test && sed sed | echo echo /usr/bin
+		-eu echo "$1" $(pwd) $(pwd)
+	test echo && "$@" printf 'quoted text' 'quoted text'
+	then done awk sed grep awk then x=1 cd sed export
+	test 2>/dev/null grep 'quoted text' sed -eu "$1" local /usr/bin readonly
+	x=1 printf export --verbose
+$(pwd) grep cd done --verbose ${HOME} awk "$@" 2>/dev/null awk test
+	export then x=1 | readonly
+	local x=1 "$@" grep grep cd readonly readonly 2>/dev/null sed "$@"
+	printf local awk | --verbose "$1" x=1 | --verbose readonly 2>/dev/null
+done echo cd -eu -eu /usr/bin x=1 2>/dev/null then
+		/usr/bin echo -eu test $(pwd) $(pwd) readonly
+$(pwd) | --verbose | 'quoted text'
+printf printf export awk
+		/usr/bin export "$1" -eu "$@" done awk sed
+		awk local && then "$@" /usr/bin -eu
+		| -eu export grep printf
+	$(pwd) 'quoted text' then
+${HOME} sed $(pwd) 2>/dev/null done && export && /usr/bin "$1" 'quoted text' test
+		export | awk sed "$@" sed test
+"$@" printf export then ${HOME} ${HOME} x=1 echo && test cd ${HOME}
+echo echo /usr/bin then done echo
+	&& 'quoted text' ${HOME} then
+	echo export 2>/dev/null x=1 cd export -eu readonly export readonly -eu 2>/dev/null
+-eu -eu x=1 awk sed grep local && echo x=1 /usr/bin printf --verbose | test
+		readonly export then export cd
+test 2>/dev/null cd export readonly echo && x=1 sed done cd local then /usr/bin
+sed readonly sed x=1 && printf
+		awk awk | x=1 | "$1" x=1
+| && done sed "$1" echo grep -eu grep "$@" 'quoted text' /usr/bin test
+	readonly test local echo then 2>/dev/null readonly
+		grep test 2>/dev/null grep awk printf done grep export 'quoted text'
+'quoted text' "$@" $(pwd) |
+sed "$1" done sed "$1" -eu 2>/dev/null done -eu readonly
+'quoted text' sed ${HOME}
+		${HOME} echo grep && 2>/dev/null awk -eu printf /usr/bin -eu printf
+		test grep && then export cd printf "$1" ${HOME} --verbose 'quoted text'
+	-eu $(pwd) 2>/dev/null
+		readonly export done && readonly --verbose
+		x=1 -eu echo "$@" sed local grep $(pwd) 2>/dev/null ${HOME} && done readonly readonly
+	x=1 -eu printf --verbose echo /usr/bin -eu export local export --verbose
+		-eu readonly -eu awk grep readonly "$1" export sed /usr/bin cd readonly -eu
+| ${HOME} awk readonly then
+		echo local ${HOME} awk awk then then "$1" readonly done /usr/bin &&
+export export sed --verbose grep
+	test -eu $(pwd) x=1 2>/dev/null
+		cd awk "$@" $(pwd) done -eu grep grep then echo cd &&
+	-eu awk printf cd echo echo done ${HOME}
+--verbose 2>/dev/null 'quoted text' x=1 /usr/bin readonly
+		sed grep ${HOME} done 'quoted text' local then test /usr/bin sed
+	2>/dev/null then done local $(pwd) printf /usr/bin 2>/dev/null 2>/dev/null
+	2>/dev/null --verbose then x=1
+printf ${HOME} "$@" sed "$1"
+awk "$1" ${HOME} "$@" readonly printf 2>/dev/null
+		"$@" grep $(pwd) --verbose | local "$1" ${HOME} sed awk
+		test readonly sed then printf printf readonly local 'quoted text' /usr/bin export
+--verbose "$@" -eu readonly sed then done --verbose "$@" readonly ${HOME}
+		--verbose awk "$1" echo "$1" grep readonly echo awk awk then cd done echo
+	local export /usr/bin --verbose ${HOME} 'quoted text' grep x=1 grep
+	local then export then
+/usr/bin ${HOME} export ${HOME}
+		x=1 'quoted text' x=1 printf "$1" "$@" cd readonly /usr/bin -eu echo grep
+| local cd then /usr/bin x=1 echo test echo awk --verbose 2>/dev/null
+	2>/dev/null done "$@" printf export x=1 | echo "$@" ${HOME}
+	/usr/bin test awk --verbose printf cd && awk --verbose awk echo
+	/usr/bin x=1 | sed sed readonly grep && | awk x=1 cd "$1"
+	| && done 2>/dev/null local ${HOME} readonly "$@" --verbose awk local 2>/dev/null
+done done grep "$1" && printf "$@" "$1" x=1 sed
+		echo --verbose 'quoted text' --verbose
+	cd echo 'quoted text' -eu -eu "$@" "$@" 'quoted text' 'quoted text' "$@"
+	-eu test awk $(pwd) then local --verbose test -eu test ${HOME}
+		test local --verbose printf echo grep sed local ${HOME} -eu x=1 /usr/bin 'quoted text'
+		| ${HOME} | export "$1" cd done test
+echo /usr/bin export -eu grep done ${HOME} readonly
+		printf --verbose | 'quoted text' && ${HOME} && 2>/dev/null
+	sed && "$@" /usr/bin done local x=1 2>/dev/null | x=1 printf test sed done then
+	&& | 'quoted text' ${HOME} --verbose --verbose readonly 2>/dev/null grep cd ${HOME}
+		-eu x=1 readonly 'quoted text' && "$@" grep done -eu done echo 2>/dev/null $(pwd)
+		awk ${HOME} local "$@" "$@" -eu done | -eu export
+		-eu test done "$1" then 2>/dev/null
+		$(pwd) "$1" cd test export then ${HOME} "$@" readonly $(pwd)
+		cd 2>/dev/null cd $(pwd) 'quoted text'
+2>/dev/null /usr/bin local 2>/dev/null awk && 'quoted text'
+	printf echo ${HOME} readonly x=1 cd && echo export | export cd export printf printf
+echo readonly "$@" grep done readonly echo ${HOME} ${HOME} readonly printf
+		export done | ${HOME} "$@" export
+		local grep 'quoted text' ${HOME} $(pwd)
+		local && "$1" grep "$@" "$1" cd $(pwd) cd sed 2>/dev/null awk && ${HOME}
+	&& sed --verbose grep --verbose /usr/bin cd x=1 2>/dev/null then && /usr/bin
+$(pwd) -eu local cd printf sed export /usr/bin
+/usr/bin $(pwd) | cd /usr/bin -eu | --verbose local ${HOME} echo $(pwd) grep
+		/usr/bin 'quoted text' export readonly cd "$@" test "$@" printf && 2>/dev/null
+"$@" && "$1" --verbose x=1 local ${HOME} echo
+awk && | export export "$1" ${HOME} $(pwd) printf /usr/bin
+readonly printf then --verbose | && 2>/dev/null echo awk local sed --verbose
+		2>/dev/null test test "$@" -eu awk local ${HOME}
+		&& /usr/bin awk "$1" then --verbose local 2>/dev/null | readonly 'quoted text'
+printf 2>/dev/null $(pwd)
+local done ${HOME} export 'quoted text' 'quoted text' echo
+	"$1" readonly sed cd -eu 'quoted text' /usr/bin && 2>/dev/null test && 2>/dev/null
+'quoted text' readonly awk ${HOME}
+local | /usr/bin ${HOME} echo "$@" --verbose x=1 grep readonly
+		/usr/bin "$@" export cd echo && local test done printf export
+		local -eu "$@" x=1 done then --verbose
+	&& && then "$1" $(pwd)
+	then test 'quoted text'
+then | x=1 then /usr/bin local 2>/dev/null done "$@" sed /usr/bin readonly echo
+$(pwd) 'quoted text' "$@" $(pwd) "$@"
+	&& && "$1" 2>/dev/null test ${HOME} readonly done
+		readonly export --verbose 'quoted text'
+	"$1" local -eu && then export readonly
+sed 'quoted text' then
+	| printf 2>/dev/null grep test "$1" $(pwd) --verbose awk 'quoted text' "$1" awk
+	sed 'quoted text' && printf 'quoted text'
+	then && -eu grep --verbose awk && /usr/bin local "$@" --verbose && echo
+	-eu awk && && 2>/dev/null x=1 -eu
+		done /usr/bin then export && | x=1 2>/dev/null awk "$1"
+-eu 2>/dev/null export sed 2>/dev/null "$1" x=1 --verbose
+echo 2>/dev/null then 2>/dev/null local echo local sed test printf
+	-eu export readonly && readonly 'quoted text'
+	'quoted text' --verbose test | 2>/dev/null && done --verbose
+		--verbose /usr/bin grep sed export readonly 'quoted text' done ${HOME} sed
+	--verbose && grep test awk | | then ${HOME} | /usr/bin
+sed export echo echo echo cd /usr/bin $(pwd) echo export
+echo then awk awk "$1"
+'quoted text' test test | sed test 2>/dev/null 2>/dev/null cd awk 2>/dev/null
+"$@" readonly sed /usr/bin readonly 'quoted text'
+	--verbose echo 2>/dev/null --verbose x=1 ${HOME}
+		sed "$1" done printf cd $(pwd)
+		done sed echo readonly /usr/bin x=1 "$1" done
+		export /usr/bin readonly
+		awk "$1" printf 2>/dev/null cd | && && local /usr/bin
+		cd export && test export
+	cd "$1" done cd test $(pwd) "$@" -eu
+export readonly awk test printf "$@" test x=1 local awk grep awk
+		--verbose awk local 2>/dev/null test echo echo /usr/bin
+	readonly export 'quoted text' cd readonly echo local export done && && local
+"$@" x=1 x=1 sed local 2>/dev/null && printf done test echo sed
+	-eu grep -eu export then x=1
+	"$@" | export cd | sed cd $(pwd)
+		then x=1 x=1 export && export "$@" test done export local readonly awk | --verbose
+		/usr/bin --verbose echo sed "$1" awk export
+grep done --verbose sed echo awk export awk "$@" then local
+	test -eu 'quoted text' printf $(pwd) export grep "$@" ${HOME} x=1
+		$(pwd) /usr/bin 2>/dev/null local grep printf
+	readonly | && test export && then --verbose | x=1 'quoted text'
+		x=1 then done -eu test cd 2>/dev/null && test
+		"$@" readonly test grep sed printf "$1" 2>/dev/null | then export -eu
+	local sed 2>/dev/null /usr/bin sed sed sed ${HOME} 'quoted text'
+		| sed cd | && $(pwd) local 'quoted text' "$1" "$1" awk 2>/dev/null x=1 sed echo
+	printf $(pwd) export ${HOME} "$1" --verbose done export cd 'quoted text'
+	${HOME} export --verbose "$1" then
+	-eu | readonly -eu readonly done export
+		| test "$1" x=1 2>/dev/null "$@" "$@" done done test then grep "$1" grep
+		&& grep cd sed x=1 awk local ${HOME} 'quoted text' awk ${HOME}
+| 'quoted text' "$@" sed test cd export /usr/bin -eu test sed
+	| "$@" local 2>/dev/null 'quoted text' echo --verbose --verbose done ${HOME}
+		then $(pwd) export &&
+echo x=1 -eu && "$1" sed && 'quoted text' then -eu done 'quoted text'
+	local sed && | printf /usr/bin cd printf -eu
+	sed then 'quoted text' local awk | | $(pwd) sed export test sed && "$1"
+		&& readonly ${HOME} -eu x=1
+		x=1 --verbose done then && awk --verbose local echo -eu cd x=1 $(pwd) && -eu local
+	local /usr/bin $(pwd) readonly 2>/dev/null awk x=1 'quoted text' ${HOME}
+	x=1 readonly ${HOME} ${HOME} test
+	&& local /usr/bin sed cd |
+	echo ${HOME} done -eu 2>/dev/null grep done "$@" readonly | "$@" 'quoted text'
+		$(pwd) awk awk -eu "$1" awk local | 'quoted text' && 2>/dev/null
+done echo | done -eu 2>/dev/null printf echo echo local 2>/dev/null $(pwd) 'quoted text'
+	readonly 'quoted text' && 2>/dev/null sed /usr/bin && readonly grep
+	done ${HOME} && printf export grep && $(pwd) "$@" && sed sed "$1" && /usr/bin
+		done done ${HOME} awk printf printf then && sed test local 'quoted text' "$@" awk
+| done cd export awk echo readonly -eu done
+--verbose ${HOME} -eu then -eu -eu | --verbose
+		done then grep readonly test x=1 test "$@"
+		--verbose ${HOME} cd awk -eu 'quoted text' $(pwd) --verbose
+		'quoted text' | --verbose
+		-eu readonly test 2>/dev/null $(pwd) ${HOME} "$1"
+"$@" $(pwd) readonly 2>/dev/null -eu ${HOME} -eu done $(pwd) x=1 cd test
+		test "$1" $(pwd) sed echo $(pwd) readonly /usr/bin ${HOME} /usr/bin
+2>/dev/null && "$1" cd readonly -eu -eu readonly x=1
+	then then echo "$@" export then
+test && $(pwd) then readonly /usr/bin sed /usr/bin echo grep "$@" local awk echo
+	"$1" then export x=1 then -eu readonly grep test $(pwd) local printf --verbose
+sed done ${HOME} awk echo /usr/bin then --verbose
+	"$1" ${HOME} "$1" && grep $(pwd) then done x=1 "$@" -eu readonly
+	/usr/bin | -eu "$@" "$1" --verbose 2>/dev/null --verbose
+		export ${HOME} --verbose "$1" | printf x=1 /usr/bin $(pwd) | 2>/dev/null
+		2>/dev/null -eu then /usr/bin "$1" printf done && awk
+&& x=1 -eu ${HOME} cd "$@" readonly test export readonly && readonly | --verbose
+	&& "$1" local "$1" x=1 ${HOME} "$1" readonly local readonly x=1 echo /usr/bin
+	| sed /usr/bin local awk 2>/dev/null echo awk export && cd /usr/bin local
+	cd -eu 2>/dev/null "$@" sed grep 'quoted text' --verbose local --verbose 'quoted text'
+sed test done export && "$@" | grep 'quoted text' awk awk done then /usr/bin
+sed 2>/dev/null test "$@" sed grep $(pwd) echo 'quoted text' "$@" -eu test grep
+		then local grep $(pwd) awk readonly then 'quoted text' done local 'quoted text'
+		$(pwd) echo local && x=1 printf readonly
+	-eu && export 'quoted text' $(pwd) x=1 then sed $(pwd) export "$1" cd
+	| --verbose then "$@" 'quoted text' sed grep done sed grep
+readonly then 'quoted text' awk awk echo
+done grep -eu -eu sed "$@" done 'quoted text'
+/usr/bin printf echo
+	'quoted text' "$@" /usr/bin printf test awk && local 'quoted text' ${HOME}
+grep 2>/dev/null test sed ${HOME} x=1 'quoted text' $(pwd) "$1"
+sed ${HOME} sed -eu export
+	/usr/bin && test /usr/bin readonly
+test /usr/bin && printf -eu done sed
+	export sed local && grep sed
+	/usr/bin 2>/dev/null export /usr/bin | cd && printf --verbose "$@" 'quoted text'
+	${HOME} x=1 -eu awk "$1" done then local x=1 export export
+--verbose local 2>/dev/null "$1" "$@" test done cd grep
+		awk cd sed sed 2>/dev/null local "$@" && "$@" ${HOME} export
+	then 'quoted text' awk -eu echo printf | /usr/bin
+&& readonly x=1 ${HOME} echo x=1 x=1 -eu "$@" && /usr/bin && readonly /usr/bin
+		test && $(pwd) printf then test 'quoted text' grep $(pwd) sed 2>/dev/null awk
+local | test "$1" "$1" done then printf echo /usr/bin 2>/dev/null
+		"$@" awk x=1 $(pwd) test done && --verbose /usr/bin
+	/usr/bin local awk export | awk "$1" $(pwd) -eu test grep ${HOME} 2>/dev/null
+		test "$1" 2>/dev/null x=1 export grep 'quoted text'
+	$(pwd) grep awk grep grep /usr/bin awk | echo grep cd export printf 'quoted text'
+test then printf cd cd | awk cd --verbose x=1 "$1" "$@" -eu "$1" export readonly
+		printf --verbose | ${HOME} -eu -eu awk test grep
+	2>/dev/null printf | "$@" /usr/bin "$@" test 'quoted text'
+$(pwd) echo --verbose 2>/dev/null readonly
+$(pwd) "$@" local then local && | 2>/dev/null
+'quoted text' test && echo && printf awk -eu 'quoted text'
+		local cd 2>/dev/null x=1 $(pwd) then grep export 'quoted text'
+		2>/dev/null awk awk echo sed readonly sed then grep
+	local cd awk readonly x=1 /usr/bin
+	done export | /usr/bin ${HOME} grep local ${HOME} grep "$1" sed readonly done
+		$(pwd) --verbose cd 'quoted text' done grep 'quoted text'
+	| ${HOME} -eu | 2>/dev/null 'quoted text' printf local awk "$1" 'quoted text'
+		echo done --verbose readonly sed done
+		| printf $(pwd) test $(pwd) 2>/dev/null -eu cd $(pwd) cd /usr/bin | test
+local local awk "$1" done grep 'quoted text' readonly
+&& "$@" $(pwd) export && x=1 2>/dev/null 2>/dev/null | echo echo
+	| && grep awk | grep /usr/bin $(pwd) export /usr/bin awk
+	grep $(pwd) | readonly readonly --verbose export
+"$@" echo x=1 ${HOME} --verbose echo $(pwd)
+		"$@" && | --verbose awk done done grep "$1" done test $(pwd) awk cd
+	x=1 -eu echo test then 'quoted text' "$1" --verbose -eu "$1" x=1 test
+		2>/dev/null "$1" then -eu sed readonly local sed --verbose
+	test printf $(pwd) $(pwd) done /usr/bin test then
+		"$1" test export --verbose printf
+		readonly local grep "$1" "$@" sed then 2>/dev/null test "$@" awk readonly "$1"
+printf 2>/dev/null then
+"$1" export then | grep 'quoted text' grep printf test sed
+test printf x=1 'quoted text' | | &&
+		| printf then local | && /usr/bin $(pwd)
+2>/dev/null "$1" --verbose echo grep "$1" --verbose printf cd x=1
+		awk x=1 sed then $(pwd) echo "$@" printf -eu sed
+	local then done echo test export --verbose echo 'quoted text'
+awk | grep 'quoted text' x=1 grep x=1 sed readonly
+grep "$@" x=1 then sed readonly "$1"
+2>/dev/null sed "$@" "$@" readonly cd x=1 'quoted text' /usr/bin ${HOME} cd awk
+		awk /usr/bin local awk -eu 'quoted text' | readonly awk readonly
+/usr/bin cd /usr/bin done --verbose echo echo printf local --verbose
+		'quoted text' export --verbose readonly 'quoted text' local | $(pwd) x=1 awk
+	awk ${HOME} export "$@" 2>/dev/null "$1" readonly
+$(pwd) "$@" && ${HOME} 'quoted text' 2>/dev/null echo
+"$@" --verbose "$1" 2>/dev/null done "$@" grep /usr/bin sed |
+		readonly | printf then readonly /usr/bin
+	cd "$@" awk 2>/dev/null grep test cd && local grep
+test local --verbose && "$@" test $(pwd) awk
+		${HOME} --verbose local echo -eu x=1 && | ${HOME} cd &&
+"$1" "$1" test x=1 local
+export 2>/dev/null echo echo awk x=1 $(pwd) 2>/dev/null
+	2>/dev/null x=1 grep $(pwd) ${HOME}
+		printf test done "$1" $(pwd) x=1 "$@" printf local | --verbose
+		--verbose echo export export test -eu -eu export
+printf 'quoted text' "$1" "$1" 'quoted text' readonly -eu then $(pwd)
+"$1" done -eu awk done "$1" 2>/dev/null grep local && "$@" 'quoted text' printf
+	-eu echo --verbose test export -eu test export -eu export --verbose
+		"$1" "$1" ${HOME} local -eu then grep local
+		grep "$1" then "$1" "$1" printf
+		--verbose 'quoted text' test ${HOME} 2>/dev/null export
+sed readonly then export -eu && -eu done awk readonly done 'quoted text'
+	"$@" printf echo then
+sed | | awk cd ${HOME} -eu
+	'quoted text' grep readonly awk awk done && awk echo ${HOME} "$1" $(pwd)
+"$1" export && sed && local echo --verbose $(pwd) sed x=1 "$@" awk
+	done && $(pwd) awk grep ${HOME} 'quoted text' && && 'quoted text'
+/usr/bin done 2>/dev/null export awk printf
+then awk --verbose test "$@" test cd "$@" grep 'quoted text'
+		"$@" --verbose then local cd /usr/bin $(pwd) local awk
+| grep | && test 'quoted text' $(pwd) x=1 $(pwd) printf "$1" $(pwd)
+	grep | $(pwd) local echo sed "$@" $(pwd) export
+		/usr/bin && echo printf awk x=1 printf ${HOME} -eu local && 'quoted text' |
+	2>/dev/null export "$@" done | then then -eu local cd sed then then
+then ${HOME} "$1" "$1" | "$1" 'quoted text' --verbose 'quoted text' sed
+		sed $(pwd) local 'quoted text' printf "$1"
+	awk ${HOME} then then echo "$1" echo sed then export
+then --verbose awk /usr/bin
+	x=1 "$@" grep done 'quoted text' $(pwd) -eu export "$@" printf
+		printf $(pwd) sed awk "$@" echo readonly echo "$@" export readonly /usr/bin
+	"$1" echo grep awk grep test readonly --verbose
+	export "$1" | local readonly done -eu echo printf --verbose
+| "$1" 2>/dev/null awk --verbose printf 'quoted text' echo "$@" readonly
+	printf done /usr/bin cd export readonly awk readonly awk local
+		echo printf readonly "$@" then done
+grep -eu then echo 'quoted text' readonly test x=1 then then
+	/usr/bin sed test cd readonly export -eu local grep grep grep "$1" printf test
+		2>/dev/null done done readonly
+	done local "$1" cd | local
+'quoted text' $(pwd) printf printf -eu -eu ${HOME} "$@" export && sed
+	"$1" readonly x=1 &&
+		echo 2>/dev/null -eu $(pwd) ${HOME} then -eu then sed
+	cd && cd 2>/dev/null done x=1
+| grep 'quoted text' | printf printf
+	$(pwd) printf cd cd "$1" 'quoted text' local
+	--verbose echo then echo ${HOME} "$@" && "$@" x=1 x=1 readonly done echo test
+		'quoted text' x=1 grep grep x=1 done echo &&
+| awk $(pwd) done awk "$@" $(pwd) sed $(pwd)
+		"$@" echo "$@" --verbose printf ${HOME} 'quoted text'
+	test local 'quoted text' printf
+		"$@" | then export 'quoted text'
+	"$1" -eu echo done test 'quoted text' 'quoted text' | $(pwd) --verbose "$@"
+done sed "$@" echo awk done
+printf test then && -eu sed | export then x=1 done cd "$1" $(pwd)
+	'quoted text' ${HOME} $(pwd) 2>/dev/null "$@" "$1" export export "$1" /usr/bin &&
+	"$1" grep export awk
+awk printf 'quoted text' --verbose $(pwd) local $(pwd) /usr/bin
+		-eu then --verbose readonly
+		test -eu test $(pwd) "$@" "$1" "$1" cd awk ${HOME}
+		then "$1" x=1 'quoted text' ${HOME} -eu x=1 cd export
+printf | "$1" /usr/bin awk
+'quoted text' --verbose cd
+		"$1" 'quoted text' grep cd $(pwd) done 2>/dev/null
+cd ${HOME} local then /usr/bin export sed -eu
+	&& echo "$1" ${HOME} done printf printf --verbose /usr/bin && grep | $(pwd)
+	done /usr/bin then sed -eu then |
+test 2>/dev/null | then "$@" grep local "$1"
+		awk awk cd echo sed --verbose ${HOME} sed local -eu /usr/bin 2>/dev/null
+		local local printf "$1" 'quoted text' done x=1 2>/dev/null
+	sed done sed then $(pwd)
+		$(pwd) "$1" sed x=1 awk && | x=1 local cd -eu /usr/bin $(pwd) $(pwd)
+	"$1" test readonly | 'quoted text' /usr/bin printf printf x=1 cd printf "$1"
+	grep done sed printf 2>/dev/null
+		awk | sed sed $(pwd) 'quoted text'
+	x=1 --verbose x=1 "$@" sed cd done then
+		2>/dev/null $(pwd) "$@" then && echo -eu echo && local local --verbose
+then | sed && grep "$@" test printf ${HOME} 'quoted text'
+	"$1" readonly printf ${HOME} echo --verbose sed awk echo done -eu "$1" "$@" "$@"
+	$(pwd) ${HOME} test printf echo
+grep x=1 ${HOME} grep 'quoted text' local
+$(pwd) done grep done readonly
+	test "$1" export cd readonly x=1 "$1" --verbose $(pwd) export then
+		then readonly awk --verbose export local -eu /usr/bin test
+grep /usr/bin "$1" 2>/dev/null test ${HOME} -eu && sed && 'quoted text' $(pwd) export
+	grep && cd test readonly local -eu
+		local 2>/dev/null echo "$1" ${HOME} -eu | echo 2>/dev/null done "$1"
+		echo grep --verbose local grep
+"$@" 2>/dev/null grep then readonly done "$1" grep "$1"
+		"$@" cd readonly printf $(pwd) | --verbose 2>/dev/null local then 2>/dev/null
+	export "$1" readonly cd "$1" echo done awk -eu
+	-eu --verbose --verbose $(pwd) readonly
+--verbose sed --verbose --verbose grep /usr/bin
+	test /usr/bin done awk done 'quoted text' |
+2>/dev/null awk cd /usr/bin readonly && test local test
+		-eu "$1" ${HOME} cd 2>/dev/null "$@" export
+then ${HOME} grep done echo grep done export printf export test then 2>/dev/null
+2>/dev/null --verbose local "$1"
+		cd export x=1 done readonly done "$1" "$1" cd /usr/bin
+	/usr/bin echo cd cd readonly ${HOME}
+		local cd printf ${HOME} export
+	export ${HOME} grep "$@" printf && done sed awk echo "$1" awk echo cd
+"$@" readonly export echo $(pwd)
+	done ${HOME} 'quoted text' x=1 /usr/bin /usr/bin awk ${HOME} | "$@"
+	readonly cd ${HOME} $(pwd) --verbose
+		--verbose grep -eu echo -eu cd test
+${HOME} /usr/bin 2>/dev/null export then $(pwd) sed
+		sed && export test done printf grep
+test ${HOME} "$1" readonly 'quoted text' then /usr/bin 2>/dev/null
+	-eu "$@" then 2>/dev/null echo --verbose | "$@" && $(pwd)
+$(pwd) sed /usr/bin && $(pwd)
+	-eu awk readonly local test grep
+	readonly local ${HOME}
+	"$1" "$@" 'quoted text' 'quoted text'
+		sed then 'quoted text'
+then | printf ${HOME} test 'quoted text' -eu | 2>/dev/null "$1"
+${HOME} -eu awk export then printf
+		printf "$1" cd printf
+	"$@" done /usr/bin test && ${HOME} done && printf "$1" local ${HOME} -eu -eu echo
+	echo 2>/dev/null 'quoted text' 2>/dev/null done
+printf test "$1" $(pwd) sed "$1" $(pwd) /usr/bin readonly grep
+		echo grep cd cd readonly x=1 2>/dev/null --verbose
+-eu -eu --verbose printf done echo /usr/bin
+	"$@" 2>/dev/null $(pwd) then 2>/dev/null -eu printf
+grep cd awk done 'quoted text'
+		'quoted text' done export awk 2>/dev/null -eu /usr/bin test "$1" $(pwd)
+export 2>/dev/null | local --verbose x=1
+	grep export export ${HOME} "$1" $(pwd) 2>/dev/null 2>/dev/null export | grep
+awk $(pwd) && "$@" | ${HOME}
+		'quoted text' /usr/bin sed --verbose ${HOME} --verbose $(pwd) --verbose echo
+echo local -eu --verbose 'quoted text'
+		test sed readonly readonly printf 'quoted text' -eu
+		/usr/bin echo echo readonly echo test 2>/dev/null
+	$(pwd) $(pwd) "$1" ${HOME} sed readonly x=1 "$@" readonly | "$@" export
+	&& x=1 ${HOME} && readonly $(pwd) 'quoted text' /usr/bin /usr/bin
+cd readonly test awk echo awk $(pwd) x=1 "$1" export "$1" 2>/dev/null
+		-eu grep sed ${HOME} awk "$1" /usr/bin
+	grep printf x=1 "$@" grep then | local echo 'quoted text' done
+		2>/dev/null local $(pwd) /usr/bin
+	$(pwd) ${HOME} printf sed awk 'quoted text'
+test test done /usr/bin test 2>/dev/null
+${HOME} readonly --verbose echo |
+	&& x=1 test grep grep cd grep echo cd
+		cd local ${HOME} && done printf x=1 "$1" 2>/dev/null 2>/dev/null
+	"$1" awk "$@" x=1 -eu readonly local sed | readonly "$@" "$@" then
+		done awk /usr/bin -eu $(pwd)
+	grep /usr/bin printf then
+	echo awk readonly "$1" local | -eu x=1 then -eu | echo
+	readonly $(pwd) echo test sed /usr/bin
+		test -eu $(pwd) readonly x=1 ${HOME} | -eu readonly | /usr/bin
+awk echo ${HOME} test echo 2>/dev/null ${HOME}
+2>/dev/null grep 'quoted text' awk "$1" "$@" 'quoted text' grep "$1" | awk &&
+		export sed 'quoted text' "$@"
+		$(pwd) $(pwd) readonly "$@" local local -eu local x=1 readonly $(pwd)
+${HOME} 2>/dev/null "$1" test | --verbose
+		then -eu readonly 2>/dev/null ${HOME} ${HOME} then $(pwd) "$1"
+		readonly printf /usr/bin awk
+	cd readonly test echo local ${HOME} echo x=1 grep sed 2>/dev/null
+	${HOME} | /usr/bin --verbose awk "$1" --verbose $(pwd) printf -eu
+done /usr/bin 'quoted text' then /usr/bin --verbose ${HOME} "$@" readonly
+	"$1" "$@" 2>/dev/null sed export echo printf local "$1" 2>/dev/null
+	${HOME} -eu sed echo 'quoted text' 2>/dev/null 'quoted text'
+"$@" test && awk readonly $(pwd) awk /usr/bin export awk then
+	sed test ${HOME} "$1" export local x=1 test --verbose printf 'quoted text'
+printf sed 'quoted text' echo ${HOME}
+		export awk "$1" grep test done ${HOME} 2>/dev/null grep export
+| /usr/bin x=1 $(pwd) /usr/bin --verbose readonly
+	"$@" x=1 "$@" | "$@"
+	test done printf grep grep /usr/bin test printf local
+| --verbose sed "$1" |
+	'quoted text' x=1 export done ${HOME} readonly done printf local echo
+'quoted text' ${HOME} 2>/dev/null test x=1 ${HOME} printf "$@" x=1 echo test
+		done grep grep sed local export
+		"$1" | local echo | export done grep then printf -eu done
+echo | awk printf test x=1 sed echo readonly echo ${HOME} printf local local "$@"
+		${HOME} grep then "$@" | cd done --verbose readonly echo done
+	local cd sed -eu cd grep 'quoted text' "$@" test 2>/dev/null ${HOME}
+	then grep ${HOME} | $(pwd) sed echo grep
+cd | 2>/dev/null done cd "$1" /usr/bin done
+	$(pwd) && printf printf sed "$@" --verbose 'quoted text' -eu -eu 2>/dev/null
+"$1" sed -eu local -eu --verbose | sed ${HOME} | -eu readonly ${HOME} grep
+		-eu | "$@" /usr/bin then cd echo echo 'quoted text' "$1" echo echo
+	awk --verbose cd echo sed then grep then "$1" ${HOME} done x=1 | echo 'quoted text'
+		awk then -eu --verbose /usr/bin local ${HOME} echo echo | ${HOME}
+		readonly ${HOME} awk $(pwd)
+		2>/dev/null ${HOME} awk "$1" export test printf local | local readonly
+"$@" test "$@" sed then echo
+	/usr/bin -eu cd awk x=1 echo x=1 --verbose "$@" /usr/bin -eu --verbose
+		${HOME} 2>/dev/null test /usr/bin grep -eu
+${HOME} ${HOME} sed --verbose grep
+	${HOME} x=1 'quoted text' awk && local 'quoted text'
+	2>/dev/null $(pwd) && awk "$1" local $(pwd) grep test 'quoted text' |
+	then export $(pwd) $(pwd) "$1" sed -eu && sed cd
+echo "$@" "$@" /usr/bin
+	local && 'quoted text'
+	"$1" "$@" printf sed ${HOME} printf readonly
+	'quoted text' $(pwd) 'quoted text' /usr/bin
+	2>/dev/null --verbose sed done test printf readonly -eu
+		done /usr/bin sed local then | $(pwd) 2>/dev/null /usr/bin --verbose grep &&
+	local awk $(pwd) grep -eu
+	local printf x=1 | 'quoted text'
+'quoted text' 2>/dev/null x=1
+	then 2>/dev/null --verbose | -eu readonly readonly sed test local local done sed
+		'quoted text' cd printf done cd grep && test "$@"
+	local local done test then $(pwd) 2>/dev/null "$@" sed then local then
+	-eu 'quoted text' grep --verbose export
+grep printf && readonly "$@" -eu x=1 -eu -eu "$1" "$1" then "$1"
+grep | local then done
+		sed 'quoted text' done --verbose
+--verbose /usr/bin grep --verbose
+awk then -eu "$1" grep | done grep export
+| "$@" -eu "$1" echo echo /usr/bin ${HOME} 'quoted text' sed done
+	x=1 | then | --verbose sed $(pwd) 2>/dev/null $(pwd) | echo export -eu
+	then echo export export
+	local readonly then "$1" "$1" export printf ${HOME} --verbose
+		"$@" $(pwd) | ${HOME} /usr/bin test --verbose x=1 x=1 /usr/bin "$@" 'quoted text'
+		export cd "$1" /usr/bin printf local awk awk local local sed | awk
+	export 2>/dev/null printf local "$@" -eu
+		echo $(pwd) 'quoted text' grep -eu then printf x=1 then then
+		export then ${HOME} /usr/bin export "$@" cd -eu $(pwd)
+		/usr/bin && | --verbose awk readonly echo ${HOME} then /usr/bin -eu $(pwd)
+-eu local export export readonly test readonly then export local -eu
+	/usr/bin done readonly test cd -eu | printf cd awk
+"$@" ${HOME} 'quoted text' | /usr/bin ${HOME} /usr/bin 'quoted text'
+	readonly sed test -eu sed ${HOME} | 'quoted text' 'quoted text' | cd cd sed awk
+	"$1" | done | "$1" printf
+x=1 "$@" $(pwd) "$1" readonly sed ${HOME} test cd --verbose sed -eu
+	x=1 local | local echo | sed --verbose
+	"$@" sed awk ${HOME} 'quoted text' done grep 'quoted text' then 2>/dev/null
+	x=1 then && then $(pwd) printf cd then "$1" export "$@" awk ${HOME}
+'quoted text' | 2>/dev/null done
+	-eu /usr/bin "$1" && $(pwd) -eu /usr/bin done local cd
+		sed ${HOME} test grep
+| "$@" local ${HOME} $(pwd)
+echo grep cd ${HOME} awk 'quoted text' printf
+		grep && $(pwd) -eu "$@" readonly awk
+		-eu -eu echo done -eu readonly
+		local 'quoted text' x=1 --verbose
+		readonly sed awk grep | /usr/bin --verbose local sed readonly && "$1" --verbose
+"$@" grep && 'quoted text' printf ${HOME} "$@" 'quoted text' export sed ${HOME}
+	local readonly cd "$@" --verbose local && awk test done grep --verbose /usr/bin
+awk printf cd ${HOME} | x=1 --verbose then $(pwd) done grep
+		test done test printf awk $(pwd) 2>/dev/null "$1" "$1" /usr/bin $(pwd) cd
+	then readonly test test 'quoted text' ${HOME}
+	$(pwd) test sed "$@" && "$@" awk test test local "$1"
+"$1" ${HOME} done readonly grep "$@" 2>/dev/null ${HOME} && test echo && ${HOME}
+		&& --verbose done then "$@" done cd awk $(pwd)
+'quoted text' && printf then export then ${HOME} 'quoted text' done 'quoted text'
+	local /usr/bin "$1" 2>/dev/null "$1" ${HOME} --verbose /usr/bin
+		cd sed then x=1 | then
+		printf 'quoted text' 'quoted text' x=1 sed "$1" "$@" && printf -eu
+--verbose $(pwd) cd $(pwd)
+		local readonly x=1 export export printf "$1"
+		done x=1 grep x=1 then "$@" readonly readonly | printf -eu "$1"
+	"$1" echo local ${HOME} $(pwd)
+$(pwd) $(pwd) 2>/dev/null local readonly done awk echo
+export test local --verbose readonly x=1 -eu printf /usr/bin printf --verbose
+	sed readonly done /usr/bin then ${HOME} grep
+--verbose then printf done && 2>/dev/null
+done done readonly readonly printf grep awk --verbose
+'quoted text' echo grep local $(pwd)
+		local $(pwd) printf x=1 $(pwd) awk | $(pwd) "$@" test local "$1" x=1 readonly
+export | readonly then /usr/bin 2>/dev/null | readonly
+		"$1" printf export x=1 "$1"
+	"$1" 'quoted text' readonly test -eu --verbose
+		2>/dev/null readonly --verbose then --verbose
+	-eu && sed 2>/dev/null x=1 'quoted text'
+		2>/dev/null -eu 2>/dev/null 2>/dev/null -eu $(pwd) /usr/bin grep
+		done $(pwd) sed cd ${HOME} /usr/bin
+	-eu 'quoted text' echo then done test | grep $(pwd)
+		awk echo printf local local printf printf "$@" echo "$1" local
+	${HOME} && -eu cd done export | test sed echo
+		-eu -eu x=1 'quoted text' 2>/dev/null | export echo && | /usr/bin readonly
+		2>/dev/null /usr/bin then awk -eu "$@" grep done export -eu local
+		done grep awk "$1" test --verbose awk 2>/dev/null then 'quoted text'
+cd then $(pwd) 'quoted text' "$@" /usr/bin export x=1 && && test && x=1
+$(pwd) 2>/dev/null "$@" grep done printf /usr/bin 2>/dev/null && x=1 done
+		2>/dev/null --verbose "$@" &&
+	"$@" grep awk "$1" then grep export then 2>/dev/null echo 'quoted text'
+	$(pwd) cd cd test readonly export grep then printf x=1 "$@" readonly ${HOME}
+		test 'quoted text' awk local "$1" local done x=1 sed
+	cd export "$1" "$1" | "$@" /usr/bin 'quoted text'
+readonly -eu export echo 2>/dev/null 'quoted text' sed "$@" echo "$@" --verbose
+	cd -eu 'quoted text' cd local echo export sed awk grep ${HOME} then awk && | grep
+	&& sed 2>/dev/null --verbose ${HOME}
+	2>/dev/null -eu 'quoted text' /usr/bin then | cd -eu
+	--verbose test export x=1 && x=1 grep grep "$@" local --verbose -eu
+	readonly grep echo then export x=1 &&
+		'quoted text' echo readonly "$@" $(pwd) test awk "$1" | cd
+| awk 2>/dev/null done local x=1 2>/dev/null
+		'quoted text' grep "$@" 2>/dev/null readonly /usr/bin
+	done --verbose /usr/bin done -eu x=1 cd --verbose
+done then grep && && cd done export grep sed 'quoted text' awk 'quoted text'
+	-eu ${HOME} awk /usr/bin local ${HOME} export "$1" sed "$1"
+		/usr/bin 2>/dev/null test -eu readonly echo grep | sed "$@" test
+		--verbose $(pwd) grep export 'quoted text'
+		/usr/bin done "$1" -eu ${HOME} && done test 2>/dev/null
+	-eu grep -eu && 'quoted text' "$@"
+		$(pwd) printf | done printf echo echo 'quoted text' --verbose
+2>/dev/null -eu /usr/bin local && "$1" 'quoted text' ${HOME}
+grep "$@" 2>/dev/null done cd test
+echo ${HOME} $(pwd) x=1 done sed test
+		| printf ${HOME} test $(pwd) done -eu test 2>/dev/null
+local ${HOME} --verbose sed --verbose
+		cd ${HOME} -eu "$@" /usr/bin readonly done
+	/usr/bin --verbose "$@" "$@" 2>/dev/null 2>/dev/null
+		| printf printf 2>/dev/null $(pwd) && awk readonly ${HOME} 2>/dev/null readonly
+		export && awk --verbose | sed printf ${HOME} "$1" &&
+	${HOME} --verbose test then --verbose
+		"$1" | grep readonly "$1" "$@" x=1 "$@" /usr/bin local $(pwd)
+readonly "$1" done readonly awk /usr/bin
+$(pwd) test ${HOME} -eu 'quoted text'
+echo && test test 'quoted text' ${HOME} test awk local
+	${HOME} export printf ${HOME}
+		local && "$1" awk ${HOME} 'quoted text' test /usr/bin -eu test sed 2>/dev/null
+	echo then | && $(pwd) awk | export readonly -eu cd x=1 readonly done
+	export -eu awk -eu $(pwd) 2>/dev/null grep
+	printf /usr/bin | printf test done
+		printf /usr/bin export cd "$@" echo then grep 2>/dev/null 'quoted text'
+		local "$@" && sed "$@" printf /usr/bin sed
+then awk cd | awk 'quoted text' awk
+		/usr/bin 'quoted text' -eu cd echo 'quoted text'
+	local cd --verbose | test ${HOME} && | $(pwd) export awk "$@"
+	sed echo $(pwd) sed test "$@" --verbose
+		export done "$@" ${HOME} test echo cd 'quoted text' "$1" /usr/bin
+	"$1" ${HOME} /usr/bin $(pwd) && 2>/dev/null ${HOME}
+awk x=1 2>/dev/null 2>/dev/null 2>/dev/null local done then local
+"$@" done 2>/dev/null export $(pwd) cd test local
+	then export 2>/dev/null echo "$1" ${HOME} printf
+readonly /usr/bin echo
+		local export && && ${HOME} --verbose ${HOME} --verbose sed /usr/bin awk
+export --verbose then grep --verbose -eu local done
+	cd printf awk /usr/bin echo test sed test cd x=1 grep && ${HOME} "$1" sed
+	"$1" ${HOME} grep 2>/dev/null cd grep printf then
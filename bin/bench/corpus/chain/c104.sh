@@ -0,0 +1,2001 @@
+	"$1" printf ${HOME} -eu cd 2>/dev/null
+then echo $(pwd) -eu done awk awk test -eu --verbose printf
+		readonly 2>/dev/null echo "$@" done -eu ${HOME} readonly printf
+		'quoted text' $(pwd) printf then cd /usr/bin "$1" 2>/dev/null 2>/dev/null
+	${HOME} -eu 'quoted text' cd &&
+	grep x=1 test --verbose cd --verbose test 2>/dev/null
+readonly "$@" done 2>/dev/null then
+	$(pwd) export then local printf
+test ${HOME} $(pwd) awk 2>/dev/null
+echo && 2>/dev/null | 'quoted text' test export then 'quoted text' sed readonly
+/usr/bin && cd 2>/dev/null $(pwd) local 2>/dev/null local printf "$1" "$1"
+| done "$1" x=1 'quoted text' | printf && grep x=1 2>/dev/null ${HOME} done
+		readonly done "$@" "$@" -eu $(pwd) sed test
+		sed local && cd export "$1" -eu sed echo && echo && printf
+		$(pwd) printf done export local cd printf 2>/dev/null
+-eu --verbose cd && --verbose export local sed readonly
+	grep test sed grep /usr/bin awk awk then local -eu 2>/dev/null x=1 && ${HOME}
+awk echo cd then x=1 /usr/bin | "$1" sed | $(pwd)
+	readonly 'quoted text' printf local printf cd done readonly grep &&
+		&& grep 'quoted text' x=1 ${HOME} /usr/bin
+	'quoted text' export x=1 && 2>/dev/null x=1 2>/dev/null -eu then -eu &&
+		export 2>/dev/null x=1 &&
+	awk cd cd --verbose && ${HOME} x=1 test
+		export x=1 'quoted text' &&
+-eu ${HOME} cd | grep grep && "$@" ${HOME}
+	--verbose cd 'quoted text' $(pwd) --verbose "$@" printf /usr/bin
+	x=1 "$1" | grep 2>/dev/null "$1" && $(pwd) sed sed $(pwd) 2>/dev/null
+"$@" test then x=1 test ${HOME} then 'quoted text' sed export 'quoted text'
+		| "$1" 2>/dev/null -eu readonly test then
+	awk awk local cd 'quoted text' export cd export
+	--verbose /usr/bin sed then $(pwd) $(pwd) sed then local test export
+		"$1" | --verbose test -eu sed "$@" done export && /usr/bin
+	/usr/bin done 'quoted text' echo test local "$@" 'quoted text'
+local echo "$1" grep --verbose cd cd "$@"
+&& done -eu ${HOME} grep "$1" readonly ${HOME} ${HOME} | /usr/bin
+		$(pwd) echo test "$1" -eu test 2>/dev/null
+	| sed 2>/dev/null && ${HOME} export grep ${HOME} printf
+	| -eu x=1 -eu && | export sed --verbose -eu ${HOME}
+	-eu | | "$1" printf cd /usr/bin 2>/dev/null printf then /usr/bin x=1 --verbose
+		$(pwd) 2>/dev/null local --verbose awk -eu
+export echo local --verbose | local sed $(pwd) grep then sed
+		export --verbose $(pwd) && sed /usr/bin
+		awk printf "$@" -eu -eu -eu "$1" done "$1" readonly | | $(pwd)
+printf sed awk printf test local echo then test | "$1" 'quoted text' 2>/dev/null
+grep --verbose $(pwd) "$1" then
+	awk sed $(pwd) grep --verbose ${HOME} done $(pwd) "$1" local printf
+	| grep readonly x=1 'quoted text' grep sed | export echo grep awk
+		&& local done "$@" -eu then local $(pwd) "$@" "$1" ${HOME} 'quoted text'
+		"$1" /usr/bin export ${HOME} /usr/bin
+	--verbose && local | 'quoted text' then $(pwd) cd ${HOME} /usr/bin
+printf | then then grep /usr/bin cd readonly printf
+		--verbose sed done 'quoted text' grep 2>/dev/null readonly /usr/bin --verbose
+		--verbose then test grep awk cd "$@" ${HOME} cd printf test
+"$@" && echo $(pwd) "$@" $(pwd) cd echo readonly && echo grep /usr/bin printf
+then /usr/bin -eu test "$@" echo 2>/dev/null
+| echo $(pwd) grep /usr/bin -eu --verbose done $(pwd) x=1
+/usr/bin && awk export $(pwd) 2>/dev/null $(pwd) 'quoted text' grep then -eu
+--verbose | ${HOME} /usr/bin
+		awk "$@" && /usr/bin --verbose local 2>/dev/null
+		local grep && "$1" $(pwd) grep done 2>/dev/null "$1" done -eu test
+		"$1" grep | "$@" "$1" x=1 test export test
+$(pwd) -eu $(pwd) | cd sed sed
+	${HOME} readonly $(pwd) readonly ${HOME} readonly 'quoted text' "$@" done
+	x=1 grep --verbose "$1" 2>/dev/null cd echo done ${HOME} | grep test cd
+--verbose "$1" x=1 /usr/bin | sed && local test $(pwd) -eu printf "$1"
+	export grep "$1" x=1 readonly grep
+		done && cd x=1 $(pwd) "$@" awk x=1 awk -eu 2>/dev/null done --verbose "$@" 2>/dev/null
+cd grep 2>/dev/null ${HOME}
+/usr/bin echo | -eu sed /usr/bin readonly done /usr/bin awk printf | echo done
+		then ${HOME} sed "$1"
+/usr/bin --verbose then | export done grep -eu cd then sed
+	-eu then ${HOME} "$1" $(pwd)
+	printf then sed /usr/bin "$1" --verbose export test && awk awk 'quoted text' |
+	export export sed "$@" "$1" readonly test --verbose
+readonly 2>/dev/null export
+| readonly local local awk awk && /usr/bin
+		$(pwd) && done && test awk | ${HOME} x=1 --verbose export ${HOME}
+echo "$@" x=1 test && 'quoted text' $(pwd) printf
+	"$@" readonly 'quoted text' awk awk "$1" printf 2>/dev/null test 'quoted text' 2>/dev/null
+		readonly printf readonly /usr/bin awk printf | awk awk && 'quoted text' /usr/bin
+		local printf 2>/dev/null /usr/bin awk "$1" 2>/dev/null
+		done readonly $(pwd) cd echo grep
+	| sed x=1 grep then grep ${HOME} done local then test then 2>/dev/null && done
+	readonly x=1 then 2>/dev/null then test printf ${HOME}
+	cd done sed readonly printf ${HOME} "$1" export $(pwd) readonly then |
+x=1 printf echo done 2>/dev/null readonly ${HOME} done | --verbose ${HOME}
+	grep 'quoted text' cd | /usr/bin grep "$1" readonly
+"$@" readonly sed x=1 grep | 2>/dev/null done "$1" then "$@"
+| awk local grep "$1" /usr/bin test done x=1 -eu /usr/bin
+	"$@" | done /usr/bin "$@" 'quoted text' printf 2>/dev/null export local ${HOME}
+		readonly printf --verbose sed export printf ${HOME} awk 'quoted text' x=1
+	--verbose $(pwd) sed test /usr/bin /usr/bin --verbose readonly
+		"$@" 2>/dev/null "$@" "$@" local done -eu readonly "$1" -eu test
+sed grep --verbose then cd readonly readonly $(pwd) printf cd 2>/dev/null
+		${HOME} export grep cd done then && echo grep && --verbose /usr/bin --verbose
+		x=1 && printf /usr/bin echo echo local 2>/dev/null
+	awk -eu readonly "$@" x=1 x=1 x=1 readonly cd | 2>/dev/null 2>/dev/null
+		| done --verbose test done /usr/bin 2>/dev/null local export ${HOME}
+sed "$@" | x=1 export "$1" | export export 2>/dev/null "$1" "$1" "$1"
+		sed sed test test ${HOME} awk $(pwd) && done
+		x=1 "$1" grep sed awk $(pwd) local test "$1" test ${HOME} ${HOME}
+$(pwd) 2>/dev/null done | 'quoted text'
+	export -eu | sed x=1 done | | --verbose
+	"$1" local 2>/dev/null cd 2>/dev/null "$@" /usr/bin awk && grep "$1" /usr/bin then
+		export "$@" echo && x=1 export sed awk then -eu ${HOME}
+		export then sed grep $(pwd)
+	${HOME} --verbose echo then printf test grep export
+printf $(pwd) awk then x=1 test /usr/bin local | $(pwd) $(pwd) readonly printf
+$(pwd) echo 2>/dev/null "$1" sed $(pwd)
+	grep printf echo then x=1 ${HOME} test ${HOME} /usr/bin cd cd 2>/dev/null "$@"
+	"$1" local then awk awk 2>/dev/null 'quoted text' cd 'quoted text' awk 'quoted text'
+awk --verbose printf export --verbose | x=1 &&
+	"$@" echo /usr/bin awk ${HOME}
+	test /usr/bin sed test readonly /usr/bin --verbose printf
+		--verbose --verbose "$@" grep sed $(pwd) export readonly then
+	x=1 2>/dev/null local && --verbose printf export /usr/bin | export && echo
+		| export 2>/dev/null /usr/bin | | then done grep "$@" x=1 cd && echo sed 2>/dev/null
+printf /usr/bin 'quoted text' 2>/dev/null -eu "$1" sed /usr/bin awk export grep
+local && $(pwd) x=1 test /usr/bin grep 'quoted text' printf readonly
+	printf -eu awk awk 'quoted text' readonly
+	test echo awk 2>/dev/null -eu readonly -eu 2>/dev/null x=1 grep /usr/bin
+		readonly "$1" awk readonly export
+		&& $(pwd) awk test x=1 grep
+	printf && test awk grep printf --verbose /usr/bin done /usr/bin
+	x=1 awk --verbose echo export awk "$@" export --verbose /usr/bin
+	$(pwd) x=1 /usr/bin cd "$@"
+then && then && cd "$@" /usr/bin export 2>/dev/null "$@" /usr/bin $(pwd)
+readonly local --verbose x=1 readonly done "$@" --verbose 2>/dev/null readonly
+"$1" "$1" "$@" cd /usr/bin cd printf "$1" x=1 x=1 printf then test
+readonly x=1 ${HOME} x=1 x=1 echo x=1 | --verbose test then --verbose done "$@"
+		/usr/bin -eu test test | export 'quoted text' sed then readonly readonly
+printf $(pwd) && test -eu then awk --verbose $(pwd)
+${HOME} | "$@" | done cd grep
+		test "$@" --verbose $(pwd) x=1 then cd 2>/dev/null
+awk printf export "$@" printf
+'quoted text' "$1" "$@" then "$1" cd
+		&& then && x=1 "$1" /usr/bin
+"$1" "$1" -eu sed cd --verbose awk /usr/bin
+	-eu "$1" export done 2>/dev/null then | ${HOME} -eu then 'quoted text' ${HOME} then
+		echo local "$1" awk ${HOME} local ${HOME}
+	cd ${HOME} awk awk awk "$@" printf "$1" /usr/bin echo 'quoted text' |
+	"$@" export local $(pwd) -eu
+then /usr/bin test local ${HOME} --verbose
+	-eu "$1" x=1 sed 2>/dev/null
+		done local local echo then cd 2>/dev/null --verbose x=1 grep $(pwd) "$@"
+		&& then printf && --verbose test done $(pwd) sed
+	done cd | "$1" "$@" readonly done then && test
+	| test 2>/dev/null "$@" x=1 export | then 'quoted text' --verbose sed x=1
+	grep /usr/bin echo done "$@" && test
+	2>/dev/null grep x=1 readonly grep --verbose 'quoted text'
+--verbose "$1" grep "$@" 2>/dev/null 2>/dev/null then -eu "$1"
+		printf export echo 2>/dev/null 2>/dev/null "$1" grep test
+printf 2>/dev/null sed --verbose cd sed && |
+	done 'quoted text' printf -eu sed
+then | grep | ${HOME} echo done /usr/bin local
+		done grep "$1" x=1 awk ${HOME} cd "$@" | export 'quoted text'
+local printf grep /usr/bin grep then readonly $(pwd)
+/usr/bin export 'quoted text' awk local --verbose
+		sed sed "$@" ${HOME} "$1"
+test export $(pwd) --verbose
+--verbose 'quoted text' ${HOME} $(pwd) cd readonly
+	"$@" x=1 $(pwd) printf sed test "$1" test "$@" echo /usr/bin test sed
+	done echo sed then --verbose && $(pwd) local 2>/dev/null
+		then && done test /usr/bin test
+	-eu x=1 x=1 x=1 --verbose printf
+local sed test -eu "$@" cd readonly 'quoted text' 2>/dev/null 2>/dev/null
+		printf test local -eu "$@" && -eu
+test --verbose 2>/dev/null "$1" grep -eu readonly export | "$1"
+test printf echo && printf
+		-eu awk awk local then "$@" /usr/bin x=1 -eu 'quoted text' --verbose && --verbose
+	x=1 cd "$1" then | sed export 'quoted text' 'quoted text'
+	"$1" local readonly -eu local ${HOME} 'quoted text' "$@"
+		sed export then export /usr/bin local echo --verbose sed 'quoted text'
+	awk done printf awk "$1" "$1" $(pwd) 2>/dev/null sed | then "$@" cd
+		/usr/bin --verbose && $(pwd) then test sed local printf grep
+		x=1 | then /usr/bin "$1" export "$1" && "$1" then printf
+		&& "$1" x=1 printf done && --verbose sed 'quoted text' readonly --verbose $(pwd)
+		&& done sed export -eu local printf then echo -eu --verbose --verbose ${HOME}
+${HOME} /usr/bin cd grep echo $(pwd) x=1 readonly --verbose && then --verbose then
+		export then sed ${HOME} x=1 "$1"
+		echo ${HOME} done cd sed x=1 export | test echo readonly
+	readonly 2>/dev/null sed sed cd awk local awk printf test readonly local --verbose
+--verbose | cd $(pwd) local awk "$1" readonly test cd test
+	readonly ${HOME} -eu -eu /usr/bin
+cd "$@" done && sed ${HOME} ${HOME} awk "$1"
+		--verbose printf 'quoted text' /usr/bin done test grep printf --verbose
+	--verbose --verbose x=1 echo
+		2>/dev/null --verbose "$@" 2>/dev/null cd -eu 2>/dev/null -eu then
+		${HOME} -eu $(pwd) readonly awk 'quoted text' $(pwd) echo export /usr/bin
+	done sed local && cd done -eu $(pwd) cd local $(pwd) local test --verbose printf
+'quoted text' -eu awk $(pwd) then 2>/dev/null
+done && test 2>/dev/null --verbose /usr/bin
+	/usr/bin $(pwd) echo echo test awk grep "$@"
+	x=1 | /usr/bin && sed ${HOME} $(pwd) test x=1 ${HOME} done --verbose
+		--verbose then /usr/bin
+2>/dev/null local awk 2>/dev/null "$@"
+local && 'quoted text' "$@" export export 'quoted text' sed
+"$1" 'quoted text' x=1 -eu
+cd 'quoted text' cd | cd 'quoted text'
+/usr/bin 'quoted text' done awk ${HOME} readonly "$@" x=1
+readonly readonly echo done /usr/bin awk done $(pwd) /usr/bin 'quoted text'
+2>/dev/null done $(pwd) grep echo && printf done sed "$1"
+	2>/dev/null -eu /usr/bin --verbose "$@" 2>/dev/null readonly /usr/bin
+	"$@" x=1 "$1" ${HOME} local echo printf cd then ${HOME} export grep
+| export 'quoted text' cd $(pwd)
+		readonly sed 2>/dev/null cd local readonly
+--verbose && "$@" -eu "$@" x=1 awk then -eu awk printf | --verbose
+		/usr/bin ${HOME} | x=1 then -eu cd 2>/dev/null -eu test done | local 'quoted text'
+	local "$@" test --verbose test
+	awk 2>/dev/null grep readonly
+| test /usr/bin 2>/dev/null grep $(pwd) done ${HOME} printf 'quoted text'
+	sed --verbose 'quoted text' export
+then --verbose awk cd x=1 export sed ${HOME}
+	grep --verbose sed /usr/bin "$1" "$@" 'quoted text'
+	${HOME} echo $(pwd) 'quoted text' echo "$1" then -eu then
+	grep then done /usr/bin readonly /usr/bin echo x=1 local 'quoted text' then &&
+		readonly ${HOME} "$1" x=1 grep sed 'quoted text' local ${HOME}
+--verbose done sed cd then
+		echo /usr/bin grep "$@" printf then
+awk && sed readonly grep done printf ${HOME} "$1" awk cd echo readonly export
+	| grep cd grep /usr/bin ${HOME} x=1 local "$@" grep "$@"
+		| cd x=1 -eu local done grep "$@" sed done test local ${HOME} cd 2>/dev/null |
+		then export | /usr/bin grep test
+		'quoted text' test echo local "$@" 'quoted text'
+${HOME} export "$1" awk ${HOME} printf grep printf | -eu /usr/bin
+	readonly "$@" 'quoted text' local test | readonly
+		'quoted text' ${HOME} 2>/dev/null && awk
+		export cd -eu then 'quoted text' | echo && 'quoted text' local printf /usr/bin
+	'quoted text' "$1" $(pwd) 2>/dev/null -eu x=1 sed printf
+$(pwd) | sed | | done grep grep /usr/bin --verbose "$@" readonly test /usr/bin -eu
+		test awk ${HOME} done grep
+	readonly export -eu 2>/dev/null echo --verbose readonly echo -eu
+awk test awk "$@" ${HOME} 'quoted text' cd "$@" then
+"$@" ${HOME} --verbose awk 2>/dev/null echo sed awk sed sed -eu cd x=1
+		"$@" grep 'quoted text' x=1 x=1 echo | /usr/bin local 'quoted text'
+	readonly echo readonly ${HOME} printf
+	| awk export --verbose then printf grep awk $(pwd) local cd then 'quoted text'
+		export 2>/dev/null && awk cd 2>/dev/null
+	--verbose "$@" /usr/bin | --verbose export echo "$@" printf awk
+	sed cd /usr/bin 'quoted text'
+		&& /usr/bin printf "$@" then grep x=1 'quoted text'
+	grep export 2>/dev/null local test && 2>/dev/null
+		local $(pwd) awk done awk "$@" 2>/dev/null
+	then readonly done $(pwd) ${HOME}
+/usr/bin readonly sed test x=1 --verbose 2>/dev/null
+	printf ${HOME} test echo --verbose local sed grep "$@" local /usr/bin
+echo echo -eu "$1" 'quoted text' |
+	readonly then readonly printf
+		${HOME} && "$@" sed "$@" && then | test done 2>/dev/null ${HOME}
+x=1 && grep cd export x=1 local $(pwd) grep $(pwd) -eu x=1 'quoted text'
+		done test then -eu echo && echo echo done
+	--verbose && done readonly "$1" readonly printf x=1 $(pwd) /usr/bin
+		-eu "$@" "$1" printf local $(pwd) then ${HOME}
+echo ${HOME} cd 'quoted text'
+		2>/dev/null $(pwd) | grep
+		| $(pwd) 'quoted text' grep sed 'quoted text'
+	-eu sed "$1" 'quoted text' done cd sed -eu grep grep ${HOME}
+		/usr/bin grep readonly export awk -eu && /usr/bin done x=1 export
+| "$@" ${HOME} awk "$@" /usr/bin --verbose
+		${HOME} sed awk --verbose local cd | x=1 awk sed ${HOME} 2>/dev/null
+-eu grep cd cd --verbose sed grep $(pwd) sed printf 'quoted text'
+		${HOME} then --verbose /usr/bin /usr/bin echo /usr/bin
+&& export ${HOME} --verbose | 2>/dev/null
+		x=1 sed | done local x=1 then
+sed printf grep sed "$@" 'quoted text' sed --verbose /usr/bin readonly
+	"$1" cd | printf && 2>/dev/null "$1"
+		echo then grep 'quoted text'
+		| /usr/bin test then test
+| && readonly | grep cd local | "$@"
+$(pwd) readonly echo readonly cd $(pwd)
+export then printf readonly
+	x=1 'quoted text' && /usr/bin printf cd x=1
+	--verbose printf test /usr/bin /usr/bin --verbose ${HOME} cd test && done
+		${HOME} -eu then export x=1 sed sed -eu
+	readonly printf local export echo --verbose "$@" /usr/bin x=1 sed local test
+	then readonly local "$@" then && awk readonly
+	done local done export local $(pwd) 'quoted text'
+		"$1" ${HOME} 'quoted text' export -eu echo /usr/bin
+2>/dev/null awk 2>/dev/null cd readonly awk test printf -eu 'quoted text'
+	-eu "$@" ${HOME} then awk "$@" grep 2>/dev/null
+	done sed awk 2>/dev/null -eu --verbose sed &&
+	$(pwd) 'quoted text' test 2>/dev/null printf then 2>/dev/null sed then
+		--verbose local test export readonly --verbose
+cd awk --verbose ${HOME} && sed
+	cd -eu $(pwd) local printf
+awk test $(pwd) then 2>/dev/null && printf
+$(pwd) ${HOME} ${HOME} "$@" printf -eu "$1" --verbose test
+		"$1" 2>/dev/null readonly
+		| && --verbose echo "$1" cd /usr/bin $(pwd) cd test "$1" cd
+then done readonly sed grep $(pwd) printf | done -eu cd echo -eu then
+	done printf $(pwd) x=1 test ${HOME}
+		x=1 awk "$1" ${HOME} /usr/bin && cd | /usr/bin done sed
+$(pwd) grep cd cd readonly done 'quoted text' 2>/dev/null test echo 2>/dev/null
+export then readonly then
+${HOME} grep "$@" "$@" done ${HOME}
+		| test "$@" | "$@" --verbose --verbose "$@" x=1 /usr/bin
+	/usr/bin test sed export 2>/dev/null grep 'quoted text'
+2>/dev/null x=1 | awk readonly awk ${HOME} done $(pwd) done
+	awk then cd local cd && cd cd echo --verbose 'quoted text'
+	${HOME} x=1 readonly awk | 'quoted text' | 2>/dev/null cd "$@" x=1 then
+	${HOME} echo echo grep done export 2>/dev/null
+	-eu test test "$@" printf --verbose $(pwd) printf cd export test done
+		"$@" --verbose readonly awk export x=1
+		| x=1 2>/dev/null 2>/dev/null sed readonly
+		awk $(pwd) "$@" export "$1" && 'quoted text'
+awk readonly && readonly
+/usr/bin -eu -eu export printf "$@" sed sed
+	-eu "$1" echo awk --verbose x=1 then ${HOME} readonly
+local | | test | then x=1 echo 2>/dev/null
+		readonly printf cd cd --verbose echo x=1 'quoted text'
+		export -eu /usr/bin /usr/bin done echo $(pwd) |
+sed -eu awk printf awk local sed local x=1 x=1 /usr/bin "$@" local echo /usr/bin
+	--verbose done echo && grep $(pwd) echo "$1" ${HOME} ${HOME} export && awk 'quoted text'
+		echo cd sed 2>/dev/null grep then then
+	printf /usr/bin 'quoted text' -eu --verbose && export | "$@" -eu ${HOME}
+		echo export x=1 readonly
+		/usr/bin local 2>/dev/null | x=1 then "$@"
+	echo test 'quoted text' -eu /usr/bin ${HOME} 'quoted text' test
+		x=1 grep --verbose export -eu ${HOME} printf cd awk 2>/dev/null "$1" x=1
+		export readonly test 'quoted text' 2>/dev/null ${HOME} awk readonly
+2>/dev/null "$@" awk export printf 2>/dev/null 'quoted text'
+x=1 local sed cd cd echo export test local && |
+| "$@" x=1 ${HOME} sed && | done $(pwd) | x=1 ${HOME} test /usr/bin
+	"$1" awk ${HOME} awk x=1 echo local --verbose "$@"
+test /usr/bin x=1 /usr/bin $(pwd) echo then /usr/bin
+	&& export --verbose 2>/dev/null
+cd readonly $(pwd) $(pwd) test local cd export x=1 && $(pwd)
+${HOME} --verbose -eu cd done 2>/dev/null "$1" grep readonly --verbose
+| ${HOME} /usr/bin cd local readonly -eu x=1 --verbose
+		echo export --verbose 2>/dev/null
+"$@" "$1" "$@" 2>/dev/null
+cd /usr/bin echo done grep cd export grep sed -eu
+		"$1" -eu then --verbose
+	cd ${HOME} then /usr/bin printf echo 2>/dev/null
+&& readonly $(pwd) cd done grep cd /usr/bin
+	| printf readonly sed grep cd -eu
+		cd local test /usr/bin 2>/dev/null sed awk | printf -eu
+"$1" | export sed -eu --verbose "$@"
+	--verbose done $(pwd) cd && 2>/dev/null -eu
+	| -eu | done "$1" echo -eu local 'quoted text' then awk
+		sed x=1 test x=1 $(pwd) local
+	| printf $(pwd) then | x=1 --verbose "$@" 2>/dev/null "$1" readonly
+		sed 2>/dev/null test printf | sed -eu done
+then printf 2>/dev/null ${HOME}
+${HOME} local "$1" "$1" cd cd then | ${HOME} sed && test && then
+		done | cd | -eu echo export ${HOME} cd export local "$1" -eu test x=1
+&& 2>/dev/null sed x=1 then && "$@" /usr/bin echo | done then
+	export x=1 --verbose &&
+		awk readonly export "$1" cd 2>/dev/null
+${HOME} "$@" then 'quoted text' printf /usr/bin printf awk
+		then 'quoted text' cd 'quoted text' $(pwd) then
+x=1 | ${HOME} /usr/bin grep cd $(pwd) $(pwd) $(pwd) awk sed
+		test 2>/dev/null awk done "$1" sed
+	export export $(pwd) --verbose x=1 echo 'quoted text' 2>/dev/null "$@" "$1"
+cd $(pwd) sed done -eu done --verbose --verbose 2>/dev/null then
+	awk local echo "$1" "$1" /usr/bin test /usr/bin "$1" ${HOME}
+--verbose "$@" local done 'quoted text'
+then | sed grep export --verbose echo local
+local then "$1" 2>/dev/null grep test readonly
+echo readonly sed 2>/dev/null test cd -eu 2>/dev/null
+	readonly /usr/bin && grep
+	2>/dev/null done sed "$@" "$@" sed -eu && then ${HOME} test awk echo
+		cd --verbose && echo readonly printf readonly
+&& test x=1 awk --verbose
+	'quoted text' then test --verbose "$@" readonly then | readonly
+export cd export -eu 'quoted text'
+then test | test $(pwd) then test && -eu readonly local --verbose
+readonly done then | 2>/dev/null | && 2>/dev/null awk -eu /usr/bin then x=1 "$1"
+	local grep export | && "$1" 'quoted text' 2>/dev/null "$@" done "$@" sed --verbose
+		&& then export | | test -eu awk x=1 "$1" grep --verbose
+	| echo echo 'quoted text' printf
+"$@" x=1 && readonly grep
+		'quoted text' local --verbose --verbose then sed 2>/dev/null
+		awk awk cd done 2>/dev/null export && | done -eu | ${HOME} test done | $(pwd)
+test && /usr/bin | ${HOME} test 'quoted text' export grep readonly -eu
+local "$@" echo --verbose | --verbose printf
+	"$1" local "$@" /usr/bin echo test && printf ${HOME} /usr/bin 'quoted text'
+awk "$@" "$1" readonly then | cd local printf grep | test "$@"
+	/usr/bin done x=1 | 2>/dev/null
+		export && "$1" printf local "$1" 'quoted text'
+		--verbose ${HOME} x=1 test 2>/dev/null local /usr/bin cd "$1" test then sed printf
+		printf 2>/dev/null /usr/bin 2>/dev/null "$1" then "$1" 2>/dev/null done
+	test export test $(pwd) && && then 'quoted text' x=1 export done
+	local --verbose grep test
+test $(pwd) ${HOME} | test readonly "$1" 'quoted text' grep export $(pwd) readonly
+echo printf 'quoted text' readonly awk export
+export x=1 --verbose 2>/dev/null
+	"$@" printf echo $(pwd)
+		echo "$@" awk --verbose readonly && --verbose --verbose
+/usr/bin then && "$@" $(pwd) 2>/dev/null 'quoted text' printf
+		/usr/bin test printf $(pwd) sed --verbose readonly | readonly x=1 awk printf
+	awk printf then echo test ${HOME} then ${HOME} "$1" echo
+		readonly echo export x=1 2>/dev/null "$@" /usr/bin
+		'quoted text' then 'quoted text' readonly cd | sed
+		"$1" "$1" 2>/dev/null grep 'quoted text'
+		"$1" x=1 awk printf -eu "$@" test printf
+		2>/dev/null 2>/dev/null $(pwd) "$@"
+		2>/dev/null export "$@" cd done printf done done /usr/bin export cd && -eu
+		"$@" 2>/dev/null -eu printf export echo echo 'quoted text'
+		test sed /usr/bin test awk "$@" x=1 cd 2>/dev/null local readonly printf cd
+		2>/dev/null "$1" $(pwd) local ${HOME} echo then grep 'quoted text'
+	then awk && $(pwd) then readonly
+-eu "$1" readonly $(pwd) && -eu 'quoted text'
+	then | $(pwd) ${HOME} 'quoted text' then printf grep | && /usr/bin x=1 "$1" echo
+		'quoted text' done cd awk readonly
+${HOME} done done local /usr/bin echo grep sed ${HOME} | "$@" export
+'quoted text' echo && "$1" 2>/dev/null x=1 "$@" grep printf then grep && ${HOME}
+| 'quoted text' local test "$1" sed local echo x=1 -eu "$1" $(pwd) 2>/dev/null
+${HOME} 'quoted text' grep
+	"$1" -eu readonly x=1 'quoted text' 'quoted text'
+	sed then 2>/dev/null export readonly && local "$@" test 2>/dev/null
+	x=1 "$@" export ${HOME} $(pwd)
+		| grep | test cd then readonly /usr/bin export
+		printf test echo | "$@" $(pwd) $(pwd)
+	'quoted text' ${HOME} | x=1 'quoted text' -eu x=1 export
+	printf 2>/dev/null readonly sed ${HOME}
+	| cd /usr/bin | 2>/dev/null ${HOME} ${HOME} grep ${HOME} ${HOME} $(pwd)
+	x=1 echo ${HOME} export x=1 | echo printf
+$(pwd) "$1" /usr/bin test | | "$1"
+		${HOME} sed local done readonly
+		printf --verbose "$@" /usr/bin | readonly grep
+	grep then "$@" && && cd x=1 /usr/bin | cd --verbose --verbose printf
+	test echo awk awk grep | then
+awk "$@" -eu --verbose awk $(pwd) && done echo /usr/bin /usr/bin x=1 echo local
+x=1 awk readonly sed local cd $(pwd) "$@" -eu awk
+		local awk echo "$@" cd
+	| awk --verbose "$@" readonly then ${HOME}
+	sed echo done echo printf &&
+	cd "$1" local readonly -eu printf then --verbose
+		/usr/bin local -eu then 2>/dev/null then export ${HOME}
+local awk ${HOME} sed 2>/dev/null
+"$@" "$1" 'quoted text'
+	cd "$1" awk grep --verbose cd local cd export -eu grep && local | 'quoted text'
+	"$1" | /usr/bin /usr/bin test --verbose done "$1" sed --verbose echo readonly
+| cd "$@" "$1" then $(pwd) echo readonly
+awk $(pwd) --verbose echo && /usr/bin echo | printf 'quoted text' printf $(pwd)
+	/usr/bin $(pwd) ${HOME} awk 2>/dev/null cd ${HOME} -eu
+&& awk -eu grep 2>/dev/null printf "$1" then test &&
+	local readonly printf x=1 local cd readonly && $(pwd)
+		"$1" printf local 'quoted text'
+		cd export local readonly readonly readonly 2>/dev/null cd 2>/dev/null done done
+		test "$1" echo echo echo "$@" test local x=1 'quoted text' && local readonly
+		sed $(pwd) ${HOME} ${HOME} $(pwd) "$1" ${HOME} readonly cd awk
+		grep /usr/bin sed echo local sed "$@" cd
+		-eu ${HOME} test export $(pwd) "$@"
+	"$@" test $(pwd) --verbose readonly "$@" export local cd sed export x=1 --verbose
+		grep local awk sed done --verbose test && grep grep 'quoted text' export
+	--verbose "$@" 'quoted text' echo grep 'quoted text'
+grep echo "$@" -eu 'quoted text' 2>/dev/null -eu grep then
+&& ${HOME} local echo export echo cd echo printf export && $(pwd)
+		done --verbose x=1 printf grep 'quoted text' cd grep readonly
+		${HOME} && "$1" local /usr/bin local 2>/dev/null then $(pwd) 2>/dev/null
+"$@" awk x=1 -eu printf --verbose ${HOME} x=1
+awk | export sed ${HOME} printf 'quoted text' 'quoted text'
+		"$@" "$1" /usr/bin local local cd echo done x=1 ${HOME} -eu echo 2>/dev/null 'quoted text'
+		-eu "$@" "$@" x=1 && sed awk sed echo --verbose cd readonly export
+	readonly ${HOME} cd readonly
+	grep echo 'quoted text'
+		local /usr/bin awk then sed -eu -eu "$@" export readonly test sed cd
+		echo cd local | readonly $(pwd) cd -eu /usr/bin local
+	awk --verbose sed printf 'quoted text'
+	readonly printf grep export --verbose echo x=1 readonly 'quoted text'
+--verbose -eu 2>/dev/null grep test export $(pwd)
+		export sed $(pwd) grep cd && --verbose ${HOME}
+&& 'quoted text' printf local x=1 done echo && local
+		grep readonly "$@" cd grep
+		local cd grep grep ${HOME}
+'quoted text' then "$1" export export sed then
+		readonly echo 2>/dev/null sed echo -eu test $(pwd) grep $(pwd) /usr/bin readonly
+	${HOME} 'quoted text' export echo local && ${HOME} sed && -eu local
+--verbose then export "$1"
+"$1" sed --verbose cd "$1" 2>/dev/null /usr/bin
+	test test 'quoted text' then "$1"
+		local && awk "$1" test printf && /usr/bin cd $(pwd)
+		$(pwd) | done ${HOME} --verbose 2>/dev/null local --verbose local
+	cd echo ${HOME} "$@" export "$1" && cd awk readonly readonly ${HOME}
+		local x=1 readonly /usr/bin ${HOME} awk ${HOME} --verbose
+		grep test grep local 'quoted text' echo done $(pwd) done echo readonly
+local --verbose sed awk done grep then
+	grep --verbose /usr/bin 'quoted text' 2>/dev/null
+		"$@" export readonly local "$1" 2>/dev/null readonly readonly
+	--verbose local export awk && | export echo ${HOME} $(pwd)
+	x=1 2>/dev/null $(pwd) readonly -eu printf $(pwd) grep | export ${HOME}
+printf local export local echo && && /usr/bin printf then $(pwd) /usr/bin printf
+		'quoted text' done done then printf "$@" "$@" && sed readonly 'quoted text'
+&& local "$@" readonly readonly printf && readonly
+		-eu 'quoted text' awk sed
+	cd test $(pwd) cd cd echo ${HOME} | x=1
+	then then /usr/bin "$1" printf local | export 'quoted text' $(pwd)
+"$1" /usr/bin "$@" | ${HOME} -eu awk done then test local $(pwd)
+export ${HOME} 2>/dev/null
+		export awk "$1" | echo test grep test "$1" readonly cd -eu | $(pwd) 2>/dev/null
+		done done then ${HOME} && grep grep test && | 'quoted text' echo printf $(pwd) local
+sed 2>/dev/null && awk $(pwd) /usr/bin /usr/bin
+	cd "$@" 2>/dev/null done $(pwd) readonly echo $(pwd)
+		echo done -eu done "$@" awk export grep printf | test test echo 2>/dev/null
+cd then ${HOME} sed "$1" then && 'quoted text' echo test local -eu sed done -eu
+	$(pwd) awk -eu local "$@" sed --verbose "$@" x=1 ${HOME} export sed
+		--verbose readonly /usr/bin readonly local
+&& /usr/bin test ${HOME} && "$@" ${HOME}
+		${HOME} local "$1" "$@" local -eu export printf printf test test local "$@" ${HOME}
+		printf echo "$@" --verbose readonly test local | test 2>/dev/null x=1
+	2>/dev/null x=1 local cd -eu 2>/dev/null
+		| "$@" local /usr/bin ${HOME} -eu &&
+-eu x=1 'quoted text' done echo ${HOME} grep then local export | $(pwd)
+	"$1" 2>/dev/null export && done awk export && --verbose
+done && x=1 echo x=1 grep 'quoted text' echo $(pwd)
+done readonly sed ${HOME} "$@" printf
+done --verbose /usr/bin then printf x=1 cd x=1 && /usr/bin done | 'quoted text'
+grep --verbose "$@" /usr/bin readonly printf
+cd awk then then printf --verbose export test ${HOME} sed ${HOME} | 2>/dev/null
+		/usr/bin --verbose sed --verbose cd done then grep test
+/usr/bin awk x=1 2>/dev/null printf echo test
+		sed sed printf echo export | --verbose then x=1 done awk sed export
+	x=1 --verbose | "$@" /usr/bin export -eu then --verbose 'quoted text' export printf
+	${HOME} 2>/dev/null -eu 2>/dev/null -eu 2>/dev/null readonly | ${HOME}
+		2>/dev/null printf done 'quoted text' test | && grep grep awk done sed
+		echo then ${HOME} && "$1" local 2>/dev/null done "$@" awk then export -eu
+	2>/dev/null local then echo export ${HOME}
+		${HOME} 2>/dev/null readonly test -eu readonly 2>/dev/null --verbose
+		export ${HOME} grep --verbose done local done test && /usr/bin local
+	2>/dev/null cd done export -eu | echo
+cd grep test "$@" "$@" x=1 -eu export sed then grep "$@" test "$@"
+	"$1" readonly sed then 2>/dev/null printf echo "$1"
+		echo done x=1 awk && export | export local readonly
+${HOME} /usr/bin "$@" cd readonly
+-eu sed /usr/bin -eu then local sed x=1 && awk 'quoted text' readonly
+	'quoted text' && done local echo echo export then x=1
+	done then printf cd "$1" x=1 test test local
+		sed | sed export x=1 local printf printf -eu then
+	'quoted text' --verbose cd test -eu x=1 done && $(pwd) | readonly then export
+		"$@" 'quoted text' local
+-eu export awk readonly then "$1" grep --verbose
+	printf -eu -eu | | x=1
+echo "$@" | | done cd printf cd echo $(pwd)
+	readonly 'quoted text'
+awk grep x=1 done done sed echo awk awk ${HOME}
+		local awk awk awk "$1" /usr/bin sed grep export /usr/bin | export x=1 ${HOME}
+/usr/bin "$@" export grep
+	printf 'quoted text' done test ${HOME}
+grep | readonly test ${HOME} awk
+"$1" "$@" "$1" local cd $(pwd)
+		--verbose 2>/dev/null /usr/bin "$@" cd cd local test
+	"$@" 2>/dev/null local && then
+		readonly printf -eu awk
+		&& x=1 x=1 | "$@" test awk echo readonly then /usr/bin && "$@" 'quoted text'
+	&& readonly done x=1 x=1 grep
+	grep ${HOME} ${HOME} $(pwd) grep && 'quoted text' grep ${HOME}
+		printf "$@" 'quoted text' 2>/dev/null
+cd printf done test "$@" -eu echo sed test
+		"$1" echo $(pwd) then grep done printf x=1 sed x=1 local printf
+${HOME} "$1" ${HOME} x=1 /usr/bin
+printf && echo -eu local awk | /usr/bin awk readonly export
+		done -eu done 2>/dev/null export --verbose cd sed grep
+| "$1" test export echo sed $(pwd) --verbose && done /usr/bin /usr/bin
+	"$1" then "$1" test ${HOME} "$@" -eu "$@" && cd $(pwd)
+		readonly grep && x=1 echo awk --verbose echo -eu readonly done echo export
+$(pwd) readonly 2>/dev/null "$@" readonly | then
+	| printf done test then test ${HOME} --verbose x=1 cd sed
+echo cd test x=1 x=1 --verbose export test local test
+	echo local --verbose echo readonly export ${HOME} grep ${HOME} sed ${HOME}
+then sed -eu "$@" 'quoted text'
+	printf then -eu test sed awk sed -eu ${HOME} then "$@"
+2>/dev/null grep | $(pwd) export -eu /usr/bin local 'quoted text' sed
+2>/dev/null 2>/dev/null && then awk export awk
+		--verbose done local local $(pwd) local printf printf local --verbose test printf
+export echo test export local -eu "$1"
+	local ${HOME} sed sed printf 'quoted text' ${HOME} "$1"
+	&& -eu sed 2>/dev/null /usr/bin then
+'quoted text' && -eu then echo echo echo local export export && 2>/dev/null grep
+	2>/dev/null ${HOME} then awk 'quoted text' --verbose cd printf
+	2>/dev/null export --verbose "$@"
+		--verbose $(pwd) -eu export -eu export then export echo
+export "$1" 2>/dev/null done printf -eu grep ${HOME} local "$1" echo && "$1"
+	awk export --verbose /usr/bin test export then "$1" "$@" ${HOME}
+	| /usr/bin echo -eu x=1 "$1" --verbose "$@" "$1" --verbose local
+		"$@" "$@" grep && printf awk test -eu readonly
+	"$1" echo local printf "$@" ${HOME} "$1"
+	sed 2>/dev/null $(pwd) 2>/dev/null local && --verbose sed then local export
+| x=1 then awk readonly local export local
+	--verbose test -eu | then 2>/dev/null --verbose printf echo "$1" grep x=1 export
+readonly $(pwd) local ${HOME}
+sed then then cd 2>/dev/null done local 'quoted text' then $(pwd) /usr/bin
+test sed sed cd cd local readonly grep "$@" && export echo "$1"
+"$@" -eu then "$@" echo 'quoted text' && export
+	"$@" "$1" $(pwd) 2>/dev/null --verbose && | $(pwd)
+sed && grep -eu export printf /usr/bin sed cd /usr/bin then test
+		echo | -eu && export $(pwd) "$1" sed grep $(pwd) /usr/bin sed
+	done | local awk x=1 test then test sed --verbose test printf
+	"$1" grep 'quoted text' then echo done readonly -eu cd local
+cd local && -eu "$@" ${HOME} x=1 awk $(pwd) test awk
+	done then "$1" grep --verbose | -eu grep
+${HOME} && && --verbose export local x=1 -eu readonly local export
+	x=1 cd printf grep "$1" x=1 done "$1" local
+	--verbose export echo -eu "$@" /usr/bin -eu readonly cd ${HOME}
+	x=1 grep echo readonly then done "$@" cd x=1 2>/dev/null
+	${HOME} x=1 "$@" --verbose echo -eu "$@" /usr/bin
+export test -eu -eu ${HOME} echo && "$@"
+	sed awk --verbose --verbose done readonly local 2>/dev/null 2>/dev/null
+	x=1 grep $(pwd) /usr/bin sed
+	sed readonly readonly 2>/dev/null cd awk awk echo local
+grep ${HOME} readonly readonly echo /usr/bin local && done ${HOME} "$1" readonly
+| 2>/dev/null $(pwd) done
+2>/dev/null cd 'quoted text' "$@" x=1 done --verbose
+	done test then && readonly -eu --verbose grep export
+printf $(pwd) "$@" local -eu then
+	--verbose && local -eu printf
+2>/dev/null test "$1" "$1" grep readonly test
+"$@" sed done test printf printf && then "$1" 2>/dev/null | then
+readonly --verbose "$1" grep test cd x=1
+	done 2>/dev/null done echo awk readonly
+x=1 -eu then -eu x=1 done && && "$1" x=1 && export
+		then -eu sed local "$1" grep printf --verbose cd --verbose
+x=1 "$1" && $(pwd) printf
+awk x=1 sed readonly test printf | -eu && ${HOME} cd "$1" sed done 'quoted text'
+echo cd cd local -eu done readonly grep --verbose | done
+	echo readonly printf test cd then && ${HOME} ${HOME} x=1 test echo cd x=1 sed
+	awk | "$@" "$1" grep -eu x=1
+	$(pwd) then | "$1" "$1" then test echo local
+		then 2>/dev/null echo x=1 test $(pwd) $(pwd) ${HOME}
+-eu $(pwd) -eu && 'quoted text' awk export then
+"$@" "$@" x=1 done test x=1 $(pwd) $(pwd) && sed local grep ${HOME} grep -eu
+		2>/dev/null awk cd --verbose | $(pwd) sed "$1" 'quoted text' sed sed cd awk
+'quoted text' 'quoted text' 'quoted text'
+	cd 'quoted text' export 2>/dev/null
+		x=1 grep test echo $(pwd) awk readonly readonly
+${HOME} "$@" 2>/dev/null /usr/bin "$@"
+		readonly test $(pwd) /usr/bin --verbose | readonly local then export then
+	cd local "$1" sed --verbose echo 'quoted text' "$@" "$@" readonly ${HOME}
+		'quoted text' done --verbose x=1 /usr/bin 2>/dev/null -eu -eu -eu /usr/bin "$1"
+		sed local && /usr/bin sed then grep cd done | done 'quoted text' readonly
+	readonly "$@" local "$1" then readonly
+	printf echo done | done then export printf 'quoted text'
+	| "$1" awk "$@" sed "$1" readonly sed grep "$1" grep x=1 && printf
+	2>/dev/null && | -eu /usr/bin printf echo done "$@" 'quoted text' cd 'quoted text'
+	export echo $(pwd) ${HOME} | local $(pwd) printf
+grep export /usr/bin $(pwd) --verbose cd grep test
+'quoted text' export 'quoted text'
+		$(pwd) cd $(pwd) awk local x=1 "$@" awk
+done echo && -eu readonly --verbose test done
+	then /usr/bin readonly done printf && "$1" 2>/dev/null done
+		local sed ${HOME} /usr/bin local
+printf /usr/bin then then local /usr/bin && export then 'quoted text' grep export
+	echo export 'quoted text' echo "$@" printf
+${HOME} printf printf echo -eu
+		printf printf "$1" echo done awk
+"$1" awk | -eu local x=1 printf
+		readonly cd readonly echo cd "$1" echo then then sed
+	$(pwd) echo awk --verbose --verbose x=1 |
+	--verbose "$@" readonly -eu cd cd cd echo export /usr/bin | echo export 'quoted text'
+		printf export readonly ${HOME} awk 2>/dev/null x=1 sed local /usr/bin "$@" readonly
+	echo test test --verbose printf awk printf
+		-eu $(pwd) x=1 done $(pwd) 'quoted text' | --verbose
+	test test export local -eu cd -eu local 'quoted text' ${HOME} printf
+		| /usr/bin /usr/bin 'quoted text' "$1"
+	export echo sed printf x=1 export done readonly local
+&& "$@" done 'quoted text' grep awk 'quoted text' 'quoted text' done
+printf && 'quoted text' echo 2>/dev/null --verbose sed
+grep local $(pwd) x=1 then sed "$1" ${HOME} ${HOME} readonly
+	sed 'quoted text' -eu --verbose export --verbose awk then done "$1" export && x=1
+readonly export --verbose readonly ${HOME} 'quoted text' done
+	grep -eu | awk done printf
+sed sed "$1" grep 'quoted text' export done cd "$1" printf awk ${HOME} readonly
+| x=1 cd ${HOME} readonly local
+sed done cd echo 'quoted text' test 2>/dev/null grep sed export export ${HOME}
+	--verbose && echo 2>/dev/null
+	export sed cd awk export grep sed ${HOME} | $(pwd) done
+	"$@" export -eu "$@" then readonly cd echo echo x=1 grep ${HOME}
+	then sed -eu && "$1" test && then grep sed echo export echo 2>/dev/null ${HOME}
+		awk printf 2>/dev/null done 2>/dev/null
+	${HOME} | readonly /usr/bin --verbose printf done
+		readonly $(pwd) printf then "$@" echo printf sed test local cd
+export | then "$@" grep test 'quoted text' && printf
+		"$1" sed --verbose sed then awk local 'quoted text'
+readonly sed "$1" ${HOME} --verbose ${HOME}
+	printf grep 'quoted text' $(pwd) local 2>/dev/null 2>/dev/null && readonly --verbose
+--verbose 2>/dev/null then echo sed awk test "$@" export -eu
+	echo local "$1" "$@" --verbose -eu test printf | -eu /usr/bin sed test ${HOME}
+		printf --verbose /usr/bin 2>/dev/null sed &&
+	export -eu $(pwd) 'quoted text' sed export $(pwd) && sed "$@" local
+		sed awk then -eu 'quoted text' then cd --verbose export "$@" ${HOME}
+	${HOME} | $(pwd) 'quoted text'
+		printf awk "$1" sed $(pwd)
+	"$1" -eu --verbose ${HOME}
+	local cd sed done then
+	test 'quoted text' x=1 then "$@" local grep export "$1" local export readonly 2>/dev/null
+		then printf local readonly 'quoted text'
+		then x=1 printf grep /usr/bin $(pwd) "$@" "$@"
+		&& cd readonly x=1 --verbose grep
+	--verbose && -eu local
+		"$@" readonly then sed awk --verbose cd local "$@"
+printf grep test ${HOME} printf
+		cd readonly 'quoted text' test && grep && awk grep x=1 $(pwd)
+done "$1" "$1" "$@" 2>/dev/null
+		sed printf cd 'quoted text' "$@" grep test sed | 2>/dev/null ${HOME}
+x=1 cd $(pwd) local sed local
+	"$@" cd test printf printf
+	| readonly grep && local
+	sed 'quoted text' 'quoted text'
+"$1" "$1" grep -eu sed echo -eu -eu --verbose
+		"$@" cd readonly | /usr/bin test | printf sed --verbose
+grep done done echo 'quoted text' -eu $(pwd) 'quoted text' x=1 /usr/bin "$@" local
+grep readonly local local echo | /usr/bin --verbose
+$(pwd) -eu readonly grep grep export done 2>/dev/null
+		"$1" then readonly test cd $(pwd) -eu printf && 'quoted text' -eu
+	/usr/bin printf && then
+		test sed echo | --verbose --verbose x=1 "$1"
+	echo $(pwd) printf x=1
+	-eu "$@" && 'quoted text' done
+		test ${HOME} 2>/dev/null local /usr/bin
+	echo -eu echo export done && sed export "$@" | x=1 sed local x=1 "$1"
+		"$@" 2>/dev/null local x=1 cd done test awk then
+		printf printf $(pwd) "$1" export ${HOME}
+${HOME} sed done sed "$@" printf cd readonly echo /usr/bin echo done
+	--verbose $(pwd) $(pwd) local local local cd cd readonly
+	sed export /usr/bin "$@" echo 'quoted text' printf then test
+		grep -eu export readonly
+	| && $(pwd) printf awk
+	then grep /usr/bin 2>/dev/null grep -eu done readonly printf "$1"
+$(pwd) awk "$1" -eu 'quoted text' | cd awk then
+		&& done "$1" -eu "$1" --verbose cd | $(pwd) && $(pwd) ${HOME} done sed
+		x=1 export && awk --verbose awk ${HOME} "$1" echo cd /usr/bin 2>/dev/null local
+	cd 'quoted text' "$@" /usr/bin
+| echo awk "$1" export 'quoted text' x=1 sed grep
+		&& cd /usr/bin x=1 2>/dev/null echo sed 2>/dev/null then echo export -eu test
+/usr/bin awk --verbose grep printf readonly 2>/dev/null echo ${HOME}
+		2>/dev/null sed sed local --verbose "$1" readonly cd
+x=1 -eu echo done local printf test "$@" 2>/dev/null cd /usr/bin
+grep ${HOME} $(pwd) "$1" done $(pwd)
+echo cd readonly export test -eu
+	echo echo /usr/bin /usr/bin x=1 printf /usr/bin
+		done test printf -eu "$@" grep "$@" sed grep
+		export then 2>/dev/null -eu | "$1" --verbose printf readonly
+	--verbose -eu test --verbose
+-eu /usr/bin done sed sed printf printf | echo
+local && awk test awk --verbose
+awk && test ${HOME} /usr/bin then echo test --verbose --verbose awk cd echo
+		done 2>/dev/null awk 2>/dev/null printf
+-eu printf cd grep done sed then x=1 "$@" | -eu x=1 ${HOME} "$1" ${HOME}
+	'quoted text' x=1 grep printf grep then done "$1" awk readonly printf "$1" done
+sed /usr/bin done sed grep cd local /usr/bin export done echo awk
+		sed printf x=1 2>/dev/null test --verbose "$@" sed done
+export done local /usr/bin then then
+	| 2>/dev/null /usr/bin x=1 && grep then "$1" | then grep
+cd cd --verbose test awk then awk test export x=1 done
+	grep grep readonly ${HOME} 'quoted text' grep export "$1" | 'quoted text' printf
+--verbose --verbose sed --verbose
+		/usr/bin cd -eu cd local test export readonly then local sed "$@" "$1" | printf
+	| $(pwd) test -eu ${HOME} 2>/dev/null then /usr/bin $(pwd)
+	$(pwd) "$1" grep -eu awk cd --verbose grep printf cd --verbose
+test x=1 printf ${HOME} -eu "$1" done then | && grep local readonly printf done
+	x=1 /usr/bin done $(pwd) done local test readonly grep ${HOME} ${HOME} local
+	test local then $(pwd) printf local
+local sed cd | done 'quoted text' echo test x=1 export sed awk readonly
+	printf -eu local test grep --verbose grep "$1" --verbose "$1" local awk done awk
+	printf x=1 -eu sed echo
+"$1" x=1 | printf $(pwd) 'quoted text' x=1 $(pwd)
+		readonly 2>/dev/null --verbose && 2>/dev/null test ${HOME} cd --verbose 2>/dev/null
+		'quoted text' ${HOME} cd then --verbose ${HOME} $(pwd) "$@" 2>/dev/null ${HOME}
+	/usr/bin printf cd -eu done ${HOME} $(pwd) 'quoted text' --verbose && x=1 export
+-eu export 'quoted text' 2>/dev/null printf readonly cd --verbose
+		grep printf 'quoted text' awk 'quoted text'
+2>/dev/null cd --verbose $(pwd) ${HOME} then $(pwd) echo | 2>/dev/null printf -eu
+	grep $(pwd) -eu -eu grep grep 2>/dev/null ${HOME} x=1 /usr/bin "$1"
+"$1" then printf "$@" sed readonly
+	x=1 -eu done awk done --verbose ${HOME} awk -eu /usr/bin readonly "$@" -eu 2>/dev/null
+		$(pwd) echo ${HOME} ${HOME} $(pwd) x=1 echo && 2>/dev/null "$1" $(pwd) test
+	&& "$@" test readonly readonly printf |
+	"$@" awk test | && sed cd $(pwd)
+cd readonly 2>/dev/null printf printf --verbose 2>/dev/null 'quoted text'
+	--verbose 2>/dev/null readonly export ${HOME} | "$1" -eu readonly
+awk --verbose "$@" /usr/bin
+		"$@" test export 2>/dev/null readonly export
+		2>/dev/null | /usr/bin x=1 echo cd
+'quoted text' echo local readonly ${HOME}
+		local "$@" ${HOME} echo $(pwd) grep x=1 2>/dev/null
+		awk x=1 2>/dev/null /usr/bin
+		&& x=1 grep x=1 ${HOME} done local echo /usr/bin x=1 sed 2>/dev/null
+grep | 'quoted text' grep 'quoted text'
+	cd test export awk readonly /usr/bin
+		awk test $(pwd) printf 2>/dev/null
+"$@" cd | $(pwd) /usr/bin
+	done | | --verbose ${HOME} $(pwd)
+"$1" cd cd "$@" test cd done x=1 sed cd | ${HOME} && echo
+		x=1 "$1" $(pwd) && cd printf x=1
+"$@" awk 2>/dev/null ${HOME} then cd then 2>/dev/null
+	then 2>/dev/null printf
+	| "$@" 'quoted text' "$1"
+	awk | "$@" readonly && awk /usr/bin then "$@" x=1 grep
+		--verbose --verbose $(pwd) test
+		sed && readonly -eu awk |
+	"$1" x=1 export printf cd test
+	printf -eu x=1 "$1" test cd printf $(pwd) sed local grep
+		-eu readonly "$1" 2>/dev/null ${HOME} "$@" && readonly
+		readonly -eu printf local grep 2>/dev/null ${HOME} done ${HOME}
+	| test ${HOME} 'quoted text' -eu
+		awk -eu echo then 'quoted text' $(pwd) export then local
+		export $(pwd) -eu printf -eu export
+	awk --verbose sed grep done && 'quoted text' --verbose ${HOME}
+grep test cd sed echo
+	export && cd "$1" --verbose x=1 "$1" x=1 --verbose
+	2>/dev/null "$@" ${HOME}
+	sed x=1 then export ${HOME} printf grep /usr/bin --verbose local sed then -eu local
+	| awk cd printf && "$1" x=1 && && x=1 --verbose test ${HOME} $(pwd) | printf
+cd "$@" "$@" $(pwd) readonly "$1" "$@" -eu "$@" /usr/bin local | cd --verbose
+	readonly "$@" grep printf printf $(pwd) sed "$1" $(pwd) grep test "$@"
+then cd awk grep export
+	printf grep /usr/bin 'quoted text' done -eu
+	| "$@" then ${HOME} cd 2>/dev/null x=1 then "$@" then 2>/dev/null sed then /usr/bin
+done grep awk | then ${HOME} && -eu echo
+	printf ${HOME} export local then done ${HOME} export grep | sed awk test
+	| export x=1 cd ${HOME} sed readonly grep test && $(pwd)
+		local cd "$@" grep x=1 2>/dev/null | test 'quoted text'
+		test --verbose cd ${HOME} "$@" -eu export && then && then cd "$1" ${HOME}
+printf printf | cd 'quoted text'
+		grep done local | -eu "$@" $(pwd)
+		x=1 local printf readonly then "$1" then x=1 $(pwd) $(pwd) && $(pwd) local awk
+	local test export x=1 grep | 'quoted text' 'quoted text' then --verbose 2>/dev/null
+		export 2>/dev/null readonly 2>/dev/null 2>/dev/null then && done
+		test ${HOME} -eu cd printf sed test local ${HOME} ${HOME}
+&& done "$@" x=1 "$@" ${HOME} export export
+awk readonly --verbose done x=1 ${HOME} /usr/bin
+		x=1 2>/dev/null 'quoted text'
+		"$1" x=1 ${HOME} test && echo sed "$1" export awk && then echo
+		$(pwd) printf export && sed -eu "$@" /usr/bin awk export then local
+	export -eu /usr/bin /usr/bin 2>/dev/null
+	'quoted text' test awk ${HOME} local then echo
+	${HOME} /usr/bin readonly sed grep echo /usr/bin "$@" "$1" local
+&& | $(pwd) cd cd grep "$@" && readonly
+done --verbose grep local printf done ${HOME} awk test && printf && export
+grep --verbose readonly $(pwd) --verbose cd printf | | printf
+		done 2>/dev/null done | && $(pwd) /usr/bin /usr/bin local /usr/bin
+		export && | printf readonly
+		$(pwd) printf "$1" -eu test && --verbose 2>/dev/null local
+	x=1 echo && local readonly readonly
+printf "$1" "$@" export then | cd | grep cd cd then
+	&& ${HOME} export sed test && /usr/bin sed 'quoted text'
+	echo readonly sed awk echo | export done echo then export 2>/dev/null $(pwd) $(pwd)
+	done test export test 2>/dev/null then echo grep then x=1 | grep echo test -eu --verbose
+export awk export readonly x=1 | && cd test x=1 export printf local done
+	| /usr/bin awk && "$1" local -eu --verbose /usr/bin --verbose cd "$1"
+grep sed 2>/dev/null | 'quoted text' ${HOME}
+readonly test 'quoted text' "$1" sed awk && "$@" ${HOME}
+	test test done 'quoted text' grep grep "$@"
+		awk && && sed grep /usr/bin cd $(pwd) sed ${HOME} sed cd -eu --verbose ${HOME}
+	$(pwd) sed export x=1
+-eu echo /usr/bin done $(pwd) test "$@"
+done 2>/dev/null echo -eu test cd done grep echo 'quoted text' then awk $(pwd)
+&& "$@" cd grep echo --verbose printf "$@" export x=1 readonly then
+		export 2>/dev/null $(pwd) sed echo -eu 2>/dev/null
+awk test done cd "$@"
+		cd x=1 /usr/bin done echo sed 2>/dev/null export printf "$@" && /usr/bin
+	${HOME} 'quoted text' awk && done readonly sed
+		test awk grep x=1 done "$@"
+	echo awk export 2>/dev/null awk --verbose 'quoted text'
+	done test 'quoted text' export done echo ${HOME} grep 'quoted text'
+		done local "$1" done $(pwd) --verbose && -eu readonly
+	/usr/bin cd done && grep /usr/bin 2>/dev/null export "$1" && printf test "$1"
+		${HOME} printf echo printf
+${HOME} grep /usr/bin | /usr/bin test
+		&& ${HOME} readonly echo awk sed --verbose --verbose local
+	export "$@" | sed $(pwd) "$1" x=1 | /usr/bin echo awk done --verbose
+		awk | 2>/dev/null $(pwd) cd done readonly $(pwd) "$@"
+		&& grep $(pwd) --verbose 'quoted text'
+	cd --verbose -eu && cd 'quoted text' readonly
+local 2>/dev/null ${HOME} sed "$1" readonly export 'quoted text' readonly
+local 'quoted text' echo 'quoted text' $(pwd)
+		grep cd x=1 grep test $(pwd) ${HOME} --verbose test printf
+local export then "$@" done && test export "$1" 2>/dev/null 'quoted text' -eu readonly
+		grep 2>/dev/null grep readonly
+then then printf && /usr/bin
+cd grep x=1 export printf -eu cd local 'quoted text'
+		$(pwd) local /usr/bin 2>/dev/null echo 2>/dev/null sed export /usr/bin $(pwd)
+grep cd printf cd readonly then
+awk cd && export test readonly readonly && | grep test | --verbose
+		echo "$1" sed done test awk 2>/dev/null
+echo printf printf | ${HOME} ${HOME} done
+${HOME} --verbose && /usr/bin /usr/bin | export
+	"$@" then "$@" --verbose && cd && | test
+local cd test && export done x=1 'quoted text' $(pwd) $(pwd) test "$1" cd &&
+		done sed x=1 2>/dev/null ${HOME} --verbose
+		then 'quoted text' sed --verbose $(pwd) readonly export
+	test sed $(pwd) echo readonly ${HOME} 2>/dev/null
+$(pwd) ${HOME} 'quoted text' --verbose x=1 $(pwd) && sed
+then done export readonly && 2>/dev/null $(pwd) --verbose
+| cd "$@" test then --verbose
+2>/dev/null done /usr/bin | 2>/dev/null readonly ${HOME} /usr/bin local
+	/usr/bin export ${HOME} x=1
+readonly local test | printf &&
+	"$1" cd then x=1 | ${HOME}
+$(pwd) ${HOME} "$1" readonly -eu then printf 2>/dev/null ${HOME} "$1"
+		awk "$@" -eu test readonly 'quoted text' "$@" sed
+local 'quoted text' -eu $(pwd) 'quoted text' "$1" echo ${HOME} ${HOME} sed
+	x=1 cd awk 2>/dev/null done echo test done echo done
+	test ${HOME} | printf then echo readonly export
+	"$1" x=1 then readonly -eu "$1" test export /usr/bin "$1" 'quoted text'
+awk -eu "$1" sed readonly local --verbose 'quoted text'
+		grep local export && local awk printf -eu $(pwd) ${HOME} echo
+		"$1" echo echo 'quoted text' "$1" -eu
+		x=1 /usr/bin readonly done "$1" -eu --verbose cd grep export awk
+	printf --verbose export then grep "$1" local echo awk | x=1
+		echo printf test printf 'quoted text' /usr/bin 2>/dev/null
+	test test printf /usr/bin done 2>/dev/null sed 'quoted text'
+	x=1 local then /usr/bin -eu -eu local export sed "$@" "$@" "$@"
+		| "$@" echo then readonly x=1 | ${HOME}
+	local ${HOME} | -eu /usr/bin ${HOME} cd 'quoted text' printf
+done done --verbose -eu local $(pwd) x=1 && echo "$@" $(pwd) awk ${HOME}
+'quoted text' grep local done cd cd && "$1" "$1"
+	2>/dev/null /usr/bin ${HOME} "$@" "$@"
+| "$1" echo x=1 x=1 cd readonly grep /usr/bin
+/usr/bin grep export echo 'quoted text' $(pwd) export export grep cd
+export --verbose grep grep "$1"
+--verbose done 2>/dev/null $(pwd) /usr/bin -eu /usr/bin
+		local test grep /usr/bin
+		'quoted text' awk -eu x=1 printf -eu sed 'quoted text' ${HOME} &&
+		/usr/bin then "$1" --verbose then $(pwd) local 'quoted text' awk 'quoted text'
+	cd | 2>/dev/null -eu | 'quoted text'
+		local --verbose -eu -eu printf && readonly printf $(pwd) done awk --verbose
+		'quoted text' awk x=1 &&
+		grep | readonly echo local x=1 "$@" grep | export /usr/bin "$@" awk export done
+		readonly $(pwd) done local then 2>/dev/null
+grep ${HOME} echo readonly "$@" readonly | then "$@" && "$@" && x=1 sed x=1
+		'quoted text' sed ${HOME} then local cd done then echo ${HOME}
+		cd grep 2>/dev/null grep --verbose | local "$1"
+awk cd x=1 awk 'quoted text' awk "$1" && then "$@" readonly ${HOME}
+'quoted text' export $(pwd) test readonly
+		sed x=1 test grep then "$1" test -eu $(pwd) 'quoted text' test export 'quoted text'
+	| printf printf && then "$@" "$1" --verbose local echo cd | $(pwd) printf
+&& sed then done done "$@" echo x=1 "$@" 'quoted text' sed printf printf printf
+	grep export 'quoted text' "$@" test export echo "$1"
+	readonly local echo test sed printf test
+		&& "$1" --verbose local done readonly export
+then echo "$1" export grep sed done /usr/bin awk awk
+	-eu done sed ${HOME} x=1 'quoted text'
+		${HOME} ${HOME} $(pwd) --verbose echo --verbose then
+	x=1 done "$1" local grep $(pwd)
+		${HOME} -eu printf 2>/dev/null export printf /usr/bin && "$@" test 2>/dev/null
+export -eu sed then then sed x=1 | 2>/dev/null echo readonly readonly
+	readonly && | "$1" "$1" printf 2>/dev/null && done --verbose
+	printf done export 'quoted text' /usr/bin
+	test sed /usr/bin /usr/bin readonly readonly grep readonly --verbose
+		echo grep | printf printf export x=1 echo printf echo readonly then awk
+x=1 echo sed x=1 then "$@" && | export
+		awk x=1 export export awk
+		$(pwd) test "$1" x=1 readonly ${HOME} test $(pwd) local local
+2>/dev/null 'quoted text' "$@" 2>/dev/null
+	'quoted text' /usr/bin "$@" echo cd /usr/bin echo readonly
+done x=1 2>/dev/null "$@" --verbose 2>/dev/null printf
+		echo cd $(pwd) export awk grep test 'quoted text'
+done $(pwd) --verbose --verbose
+done cd printf export
+		"$@" echo && grep then readonly
+	| && local 2>/dev/null grep "$1" cd done done test
+	${HOME} sed sed "$@" then && cd test | "$@"
+		readonly done awk "$@" export && 2>/dev/null /usr/bin grep
+echo done "$@" /usr/bin --verbose
+readonly && cd | printf ${HOME} local printf "$@" readonly
+		awk ${HOME} grep $(pwd) ${HOME}
+		'quoted text' done grep 'quoted text' && awk test $(pwd) "$1" printf
+		x=1 'quoted text' ${HOME} "$@" cd cd awk echo $(pwd) -eu $(pwd) |
+export sed $(pwd) local export sed export done done readonly "$@" x=1 "$1"
+		-eu && --verbose ${HOME} echo readonly --verbose $(pwd) "$@" readonly echo
+readonly 'quoted text' x=1 "$1" "$@" && --verbose $(pwd)
+--verbose test readonly sed "$@" "$@" --verbose --verbose local export "$@" then
+	echo cd then test local grep 2>/dev/null -eu test ${HOME} local /usr/bin
+		--verbose sed then readonly sed && --verbose cd $(pwd) $(pwd) cd 2>/dev/null
+$(pwd) sed $(pwd) done ${HOME} -eu export -eu
+--verbose --verbose cd 'quoted text' "$1"
+		"$@" echo 2>/dev/null echo ${HOME} "$1"
+		cd then && --verbose printf echo $(pwd) -eu awk sed --verbose
+	/usr/bin -eu export "$1" /usr/bin
+		| test then sed awk then --verbose 'quoted text'
+	awk $(pwd) test ${HOME} cd ${HOME} done "$1" 2>/dev/null -eu "$@"
+sed echo cd "$1" 2>/dev/null grep readonly sed grep $(pwd) x=1
+	--verbose x=1 readonly export && /usr/bin $(pwd) ${HOME} export
+"$1" grep ${HOME} done awk -eu export cd /usr/bin | x=1 sed "$@" && --verbose
+		readonly --verbose cd | cd | test readonly "$1" x=1 --verbose | 2>/dev/null
+		$(pwd) x=1 awk local sed "$@" export --verbose
+$(pwd) test grep | | printf
+/usr/bin x=1 then printf awk export "$@" sed awk
+		${HOME} | done test /usr/bin sed x=1 test /usr/bin 'quoted text'
+then --verbose cd echo export --verbose
+		done then cd printf -eu -eu test "$@" "$@"
+awk ${HOME} 2>/dev/null | 'quoted text' && done done local grep then $(pwd) x=1
+awk awk echo $(pwd) "$1" "$@" $(pwd)
+| "$1" cd echo ${HOME} cd local /usr/bin local --verbose | done "$@" &&
+/usr/bin $(pwd) 2>/dev/null 2>/dev/null
+	"$@" -eu done done 2>/dev/null test 2>/dev/null cd test cd | | $(pwd) printf
+"$@" local ${HOME} --verbose then && | ${HOME} echo
+		awk -eu cd local awk ${HOME} echo readonly
+export sed 2>/dev/null --verbose grep cd && printf 'quoted text'
+local test printf done readonly && cd then | -eu printf
+		local export 'quoted text' "$1" -eu -eu grep "$1" | $(pwd) /usr/bin sed
+		$(pwd) | local done $(pwd) | local -eu "$1"
+sed $(pwd) -eu && /usr/bin -eu test readonly
+		$(pwd) | sed 2>/dev/null $(pwd) "$1" --verbose sed ${HOME} && sed done --verbose
+		cd 'quoted text' "$@" printf local then && export grep "$1" /usr/bin
+	2>/dev/null grep -eu awk && then x=1 "$@" --verbose | awk 2>/dev/null
+		done /usr/bin --verbose 'quoted text' test ${HOME} sed -eu
+/usr/bin 'quoted text' | && | awk 2>/dev/null cd 'quoted text' "$@" |
+#include c105.sh
+done "$@" ${HOME} ${HOME} "$@" | cd "$@" readonly ${HOME} $(pwd) x=1
+	readonly "$1" && "$@" 'quoted text' then awk
+	/usr/bin 'quoted text' x=1 $(pwd) test ${HOME} &&
+	local 'quoted text' export test echo 'quoted text'
+export ${HOME} 'quoted text' | ${HOME} 2>/dev/null sed /usr/bin "$1" awk x=1
+	local local sed | cd $(pwd) /usr/bin x=1
+local x=1 sed grep export $(pwd) /usr/bin
+	test local sed echo "$@" $(pwd) 'quoted text'
+		| export | && $(pwd) ${HOME}
+	"$@" -eu /usr/bin readonly ${HOME} -eu done
+export 'quoted text' 2>/dev/null ${HOME}
+		test then printf then awk awk then
+	awk awk $(pwd) export /usr/bin && printf
+$(pwd) then then && ${HOME}
+		2>/dev/null /usr/bin readonly test && -eu local
+/usr/bin | --verbose awk printf printf done cd /usr/bin then
+	--verbose awk grep awk "$@" done awk local && /usr/bin "$@"
+cd readonly /usr/bin then | --verbose
+		printf && && | 2>/dev/null -eu | awk
+		done | test -eu awk local $(pwd)
+		'quoted text' 'quoted text' x=1 $(pwd) done 'quoted text'
+grep printf done && 'quoted text'
+		then echo awk ${HOME} /usr/bin
+	${HOME} export sed readonly printf -eu test x=1 $(pwd) "$1"
+		echo local --verbose -eu export then local local grep local x=1
+		sed x=1 awk /usr/bin --verbose --verbose
+		readonly "$@" "$@" cd | && --verbose
+		printf && 'quoted text' readonly awk "$@" /usr/bin
+	/usr/bin local printf then "$@" --verbose ${HOME} cd printf 2>/dev/null
+printf done awk /usr/bin export export sed awk 'quoted text' "$1" cd ${HOME}
+sed x=1 printf && /usr/bin echo 2>/dev/null cd |
+sed --verbose 'quoted text' 2>/dev/null "$@" "$1"
+		--verbose cd cd --verbose test sed 'quoted text'
+		printf x=1 done readonly -eu sed &&
+	'quoted text' test 'quoted text' | then grep
+'quoted text' $(pwd) $(pwd) grep echo grep local | $(pwd)
+	x=1 -eu "$1" 2>/dev/null ${HOME} 2>/dev/null
+echo cd grep /usr/bin -eu done
+	readonly | export 2>/dev/null awk echo cd local /usr/bin export 'quoted text'
+export "$1" sed "$@" --verbose "$1" "$1" readonly "$1" readonly
+		2>/dev/null "$@" then export
+done local grep | done sed ${HOME} export x=1
+		${HOME} --verbose grep export local test done local
+--verbose && cd readonly 2>/dev/null x=1 --verbose 'quoted text' "$1"
+&& then local $(pwd) "$1" --verbose
+cd 2>/dev/null local "$1" && sed test
+		&& then test x=1 --verbose ${HOME} grep grep $(pwd) --verbose echo local
+2>/dev/null "$1" x=1 sed /usr/bin /usr/bin echo x=1 /usr/bin local &&
+		"$1" printf readonly && cd test then --verbose "$@" awk sed
+	test "$@" -eu "$1" then | export -eu export x=1 /usr/bin echo then --verbose
+	awk "$@" test "$1" done
+		echo cd awk -eu 'quoted text' sed
+"$1" 'quoted text' $(pwd) cd ${HOME} awk && sed --verbose
+		local readonly ${HOME} x=1 readonly cd /usr/bin ${HOME} --verbose $(pwd)
+	"$1" sed sed cd x=1 cd | cd local
+awk -eu done printf "$1"
+		printf echo readonly /usr/bin
+	x=1 && x=1 then test ${HOME} && test && -eu export test /usr/bin test sed x=1
+	--verbose readonly grep printf readonly
+		-eu test --verbose x=1 --verbose test $(pwd) readonly /usr/bin export ${HOME}
+	local -eu -eu done $(pwd) readonly
+		"$1" -eu cd $(pwd) awk x=1 local done then 'quoted text' echo x=1 local
+		'quoted text' x=1 echo test /usr/bin x=1 'quoted text' printf
+		$(pwd) done done test
+cd printf readonly export echo
+	echo done grep | awk --verbose grep grep
+	| /usr/bin awk /usr/bin export
+	--verbose $(pwd) ${HOME} grep
+		"$1" 2>/dev/null "$1" 2>/dev/null "$@" -eu awk then echo --verbose | then
+		printf local /usr/bin "$1" -eu cd awk --verbose echo
+	printf ${HOME} -eu grep --verbose
+	echo | 2>/dev/null --verbose x=1 x=1 export $(pwd) sed grep
+	printf | x=1 /usr/bin 'quoted text' sed grep 'quoted text'
+		test test sed printf readonly | echo 'quoted text' 'quoted text'
+		export readonly local printf "$@" "$@" awk done echo readonly
+2>/dev/null --verbose grep 'quoted text' local "$1" | $(pwd) local export test
+		done then sed | /usr/bin printf test readonly export
+	local | ${HOME} x=1 ${HOME} -eu &&
+test done grep echo awk printf 2>/dev/null
+	'quoted text' awk $(pwd) done export --verbose awk sed done
+	--verbose x=1 -eu x=1 -eu ${HOME} $(pwd) "$@"
+"$1" local awk readonly 'quoted text' readonly
+"$@" export awk | readonly echo x=1 2>/dev/null 'quoted text' then && sed ${HOME}
+		echo "$1" local then then -eu /usr/bin 2>/dev/null "$@" awk cd echo
+	local echo x=1 2>/dev/null cd readonly then /usr/bin test $(pwd) then $(pwd)
+cd --verbose awk test done |
+		done -eu x=1 "$@" && | x=1 $(pwd) ${HOME}
+	"$1" export readonly 2>/dev/null
+	"$@" test x=1 awk x=1 $(pwd) echo --verbose done
+	/usr/bin awk 2>/dev/null $(pwd)
+-eu done done ${HOME}
+	x=1 /usr/bin then awk export | -eu awk echo /usr/bin sed grep local echo then
+	done | -eu test x=1 /usr/bin
+local grep grep awk ${HOME} done /usr/bin x=1 x=1 /usr/bin
+/usr/bin done readonly /usr/bin 'quoted text' done
+	"$1" then && $(pwd) && cd cd cd sed ${HOME} test 2>/dev/null 'quoted text'
+printf done export done
+| awk "$@" done export 2>/dev/null
+	export /usr/bin export && /usr/bin "$1" -eu
+		test readonly printf && test | done export x=1 "$1" test local 'quoted text'
+2>/dev/null $(pwd) "$@" 2>/dev/null && "$@" sed ${HOME} sed sed &&
+printf && 'quoted text' 'quoted text' /usr/bin 2>/dev/null grep readonly --verbose
+${HOME} local $(pwd) echo sed "$@" ${HOME}
+		cd grep 2>/dev/null awk sed $(pwd) 'quoted text' x=1 "$1" echo done
+"$1" | readonly /usr/bin export "$@" cd awk awk cd | readonly x=1
+	echo ${HOME} then grep $(pwd) | test export
+		/usr/bin local then then -eu | && echo cd -eu 2>/dev/null -eu
+awk printf export done printf x=1 --verbose
+printf /usr/bin 2>/dev/null done "$@" local && sed "$@" then
+	--verbose printf "$@" 2>/dev/null cd
+		${HOME} 'quoted text' "$1" && sed /usr/bin printf
+		test cd then local ${HOME} echo 'quoted text' ${HOME} ${HOME} &&
+		| local -eu test --verbose 'quoted text'
+awk sed printf grep sed /usr/bin /usr/bin $(pwd) awk test cd sed --verbose
+&& echo readonly /usr/bin x=1 sed -eu sed done "$@" "$@" ${HOME} test echo
+	printf cd done local "$@"
+printf test -eu then readonly then --verbose 2>/dev/null cd readonly "$1"
+		&& sed 'quoted text' /usr/bin && 'quoted text'
+-eu done x=1 export echo x=1 /usr/bin then | $(pwd) && x=1 /usr/bin
+grep done $(pwd) --verbose printf
+-eu awk x=1 done ${HOME} 'quoted text'
+printf $(pwd) $(pwd) test printf then "$1" export awk export 2>/dev/null "$1"
+sed done ${HOME} awk awk --verbose printf -eu -eu done awk "$1"
+then | test printf -eu $(pwd) ${HOME}
+	cd test cd x=1 then export test ${HOME} readonly then x=1
+		"$1" | echo local $(pwd) printf $(pwd) 'quoted text' grep 2>/dev/null test
+		awk "$@" "$@" "$1" -eu ${HOME} readonly test | 'quoted text'
+	"$@" export then x=1 "$@" | export done && -eu /usr/bin
+printf then $(pwd) "$1" "$@"
+then /usr/bin 2>/dev/null cd "$1" export sed test sed
+		test sed $(pwd) printf /usr/bin "$1"
+		then local "$1" && "$@" /usr/bin done readonly "$@" "$@" echo ${HOME} cd 'quoted text'
+		echo awk -eu | cd | | ${HOME} $(pwd) printf 2>/dev/null cd x=1 grep readonly
+		'quoted text' ${HOME} export export
+		"$@" 2>/dev/null | printf local export cd "$@" $(pwd) && /usr/bin export
+		x=1 echo done && "$@" "$1" 2>/dev/null ${HOME} 'quoted text'
+		2>/dev/null local awk done test -eu
+		$(pwd) awk "$1" sed --verbose readonly -eu awk "$@" test | 2>/dev/null "$1"
+	x=1 -eu sed "$1" -eu && $(pwd) "$@" -eu echo --verbose readonly
+	2>/dev/null /usr/bin 2>/dev/null | 'quoted text' /usr/bin then then
+	${HOME} && then printf --verbose printf 'quoted text'
+	/usr/bin export $(pwd) local
+		x=1 x=1 readonly x=1 cd
+		local test x=1 'quoted text' x=1 awk
+$(pwd) test /usr/bin done ${HOME}
+		cd $(pwd) 'quoted text' export -eu ${HOME} "$@" grep
+		sed -eu test -eu $(pwd)
+	test -eu | printf "$@" "$@"
+grep test sed 'quoted text' sed then
+		x=1 printf readonly -eu test ${HOME} &&
+2>/dev/null done printf --verbose
+	test sed then 'quoted text' "$@" 'quoted text'
+	"$@" "$1" readonly "$@" 2>/dev/null awk then echo 'quoted text' 'quoted text'
+"$1" | grep awk grep printf "$@" printf cd awk /usr/bin
+| cd --verbose -eu x=1 sed | awk echo x=1 x=1 x=1 grep awk ${HOME} x=1 x=1 2>/dev/null
+--verbose readonly 2>/dev/null $(pwd) -eu done 'quoted text'
+grep ${HOME} grep "$@" export
+	"$@" readonly test export local 2>/dev/null printf done -eu ${HOME}
+		"$1" | 'quoted text' --verbose $(pwd) && sed cd readonly
+test export x=1 local 2>/dev/null done echo x=1 $(pwd) "$1"
+echo 2>/dev/null done "$@" "$@" 'quoted text' "$@" local
+awk test then done 2>/dev/null "$1" done test "$@" 'quoted text' $(pwd)
+		--verbose readonly test done && ${HOME} local /usr/bin "$@" $(pwd)
+		export "$@" readonly readonly test done readonly
+		sed -eu /usr/bin | export export --verbose echo -eu local echo sed printf cd
+		2>/dev/null echo printf readonly "$@" sed sed test
+printf export readonly 2>/dev/null local
+grep x=1 "$1" -eu -eu then | printf --verbose
+&& --verbose local local --verbose printf --verbose 'quoted text'
+		&& export && awk -eu && /usr/bin
+	test 2>/dev/null grep awk 2>/dev/null --verbose sed -eu grep | echo ${HOME}
+	${HOME} then local $(pwd) "$@" | "$@"
+	local 2>/dev/null 'quoted text' | printf
+	"$1" ${HOME} && then x=1 "$1" 2>/dev/null "$@" done "$1" | printf --verbose
+	then printf awk echo printf | echo -eu printf "$1" export $(pwd)
+echo /usr/bin readonly local ${HOME} 2>/dev/null -eu grep readonly echo then
+		${HOME} "$1" test "$1" 'quoted text'
+sed $(pwd) $(pwd) then export printf then printf | local
+	$(pwd) $(pwd) export grep ${HOME} -eu sed test "$@" export local
+		export export test cd sed done ${HOME} readonly
+	grep export x=1 readonly echo grep "$@" 2>/dev/null export printf export
+		--verbose cd awk readonly "$1" "$@" && printf "$@" ${HOME} --verbose -eu
+		then printf awk cd && readonly sed awk ${HOME} test test
+	done x=1 awk export then && cd 2>/dev/null then awk 'quoted text' x=1 sed
+	sed /usr/bin local x=1 -eu "$1" then x=1 export && then
+x=1 /usr/bin $(pwd) --verbose x=1 local $(pwd)
+		&& sed grep $(pwd) cd /usr/bin 'quoted text' 2>/dev/null test 'quoted text'
+		test --verbose then grep readonly local cd -eu /usr/bin
+| | sed cd $(pwd) $(pwd) 'quoted text' echo
+/usr/bin 2>/dev/null ${HOME} grep /usr/bin "$@" "$@"
+2>/dev/null | ${HOME} /usr/bin /usr/bin sed done
+		| -eu | 2>/dev/null done /usr/bin local "$@" $(pwd)
+printf local cd awk x=1 cd test "$1" $(pwd) grep export
+	echo done && 'quoted text' --verbose done echo local
+-eu && then "$1" "$1" "$@" then 2>/dev/null local
+	sed export readonly "$1" $(pwd) readonly done /usr/bin local 2>/dev/null
+grep echo "$1" awk readonly local "$1" $(pwd) ${HOME} awk test sed -eu | "$1"
+done done "$1" sed "$1" /usr/bin
+	2>/dev/null local 'quoted text'
+	| cd -eu $(pwd) sed sed printf cd 'quoted text' printf "$1"
+	/usr/bin -eu grep --verbose
+	printf "$@" "$@" $(pwd) /usr/bin --verbose ${HOME}
+	printf readonly -eu cd grep printf printf | then
+then export printf then readonly echo /usr/bin 'quoted text'
+		x=1 -eu 2>/dev/null && "$1" readonly 'quoted text'
+	local 2>/dev/null export cd export echo "$1" "$1" printf
+'quoted text' ${HOME} sed 2>/dev/null --verbose 'quoted text' ${HOME}
+$(pwd) awk && | test grep && -eu ${HOME} printf $(pwd) |
+		"$@" cd $(pwd) export -eu test "$@" grep then export
+$(pwd) "$1" ${HOME} export && done "$1" awk && done
+	test test "$@" echo x=1
+	readonly printf -eu printf cd export -eu export $(pwd) printf -eu printf
+--verbose && -eu 2>/dev/null awk echo done && "$@" "$1" grep local
+local -eu local x=1 x=1 local /usr/bin x=1 | &&
+test --verbose | export grep ${HOME} then grep sed --verbose sed $(pwd) then
+"$@" readonly cd && test 'quoted text'
+		$(pwd) | export "$1" done -eu done $(pwd) | 2>/dev/null
+	x=1 $(pwd) done --verbose | printf done 'quoted text'
+		printf export printf "$@" "$@" printf $(pwd) printf test local echo "$1" export
+	| "$@" -eu then awk "$1" done export then done && cd --verbose 'quoted text'
+	"$1" -eu 'quoted text' export test export -eu 2>/dev/null echo done
+	echo sed test done --verbose
+	'quoted text' | echo done && echo readonly test $(pwd)
+'quoted text' sed "$@" local echo awk echo 'quoted text' | grep 'quoted text'
+	'quoted text' printf $(pwd) | x=1 then --verbose 2>/dev/null
+	sed | --verbose cd "$1" grep printf "$1" awk local
+		-eu export "$1" local "$1" && test ${HOME} | test test readonly 'quoted text'
+	echo done x=1 done 2>/dev/null --verbose ${HOME}
+		echo done --verbose printf | echo echo export $(pwd) && --verbose 'quoted text'
+		sed "$1" local x=1 'quoted text' test local && x=1 2>/dev/null
+'quoted text' awk ${HOME} cd readonly done "$@" test local
+		'quoted text' | "$@" printf "$1" $(pwd) cd "$1"
+	printf sed awk && test awk sed x=1 test test "$1" export local
+		readonly -eu readonly export "$@" export "$@" 2>/dev/null 'quoted text'
+		"$1" then echo readonly echo 'quoted text'
+then 2>/dev/null export | readonly export test
+		| then && $(pwd) $(pwd) x=1 | done $(pwd) sed --verbose
+sed done then -eu 2>/dev/null readonly readonly
+$(pwd) $(pwd) -eu test
+		${HOME} $(pwd) test awk x=1 awk printf && printf
+printf export export grep ${HOME} && export 'quoted text' then ${HOME}
+	'quoted text' test printf 2>/dev/null $(pwd) awk done /usr/bin $(pwd) 'quoted text'
+| 2>/dev/null "$1" readonly
+/usr/bin x=1 then "$@" ${HOME} export cd
+		then --verbose x=1 done "$@" echo | awk
+$(pwd) export && --verbose printf echo printf readonly
+	2>/dev/null readonly sed cd "$1" readonly
+		awk printf x=1 then ${HOME} 'quoted text'
+	readonly | "$1" then local local awk 2>/dev/null --verbose
+	printf /usr/bin local "$@" test | --verbose 2>/dev/null
+		$(pwd) "$@" printf grep grep readonly
+	$(pwd) | /usr/bin /usr/bin
+	echo $(pwd) printf done "$@" $(pwd)
+	$(pwd) $(pwd) echo awk
+-eu done /usr/bin /usr/bin ${HOME} cd --verbose $(pwd) --verbose
+sed | cd --verbose readonly test echo 'quoted text' && cd then | readonly
+	"$1" x=1 printf cd /usr/bin
+	x=1 grep local cd then printf echo /usr/bin
+		export readonly sed -eu "$1" awk readonly 'quoted text' export
+		2>/dev/null local "$@" | ${HOME} then ${HOME}
+"$@" then echo ${HOME} echo cd then echo | 2>/dev/null local printf x=1
+		x=1 x=1 "$@" local test 'quoted text'
+"$1" echo | 'quoted text' sed readonly 2>/dev/null ${HOME} sed &&
+awk | --verbose awk ${HOME} && grep then 'quoted text'
+	awk ${HOME} 'quoted text' echo local
+--verbose test sed readonly | $(pwd)
+grep /usr/bin -eu --verbose /usr/bin then ${HOME} echo grep 'quoted text'
+$(pwd) "$1" --verbose printf 'quoted text' ${HOME} && then
+		echo readonly printf local test && test 'quoted text' --verbose
+	'quoted text' readonly $(pwd) sed readonly "$@" cd
+		test echo /usr/bin | ${HOME} --verbose ${HOME} ${HOME} cd done &&
+	printf then ${HOME} sed -eu
+test test sed 'quoted text' then done awk "$@" cd
+	-eu local --verbose local then then done $(pwd) && readonly | local
+		--verbose readonly --verbose "$@" then 'quoted text' | readonly 2>/dev/null
+/usr/bin && 2>/dev/null x=1 done && test export 'quoted text' done "$1" local echo
+	2>/dev/null | grep 'quoted text' x=1 sed --verbose local 'quoted text'
+	awk /usr/bin done ${HOME}
+"$1" then x=1 /usr/bin "$@" | echo ${HOME} export | $(pwd) "$@" $(pwd)
+	grep printf then echo $(pwd) printf done
+local awk printf readonly x=1 "$@" x=1 local local export readonly x=1
+sed $(pwd) echo | $(pwd) awk "$@" $(pwd) then | ${HOME} test
+	${HOME} "$1" 'quoted text' cd local 'quoted text'
+/usr/bin 'quoted text' readonly sed -eu --verbose printf /usr/bin test
+		then 'quoted text' grep cd then "$1"
+export --verbose then cd echo
+export local test echo && sed $(pwd) awk && done export
+	readonly grep readonly 'quoted text' test "$1" 2>/dev/null
+"$@" cd && --verbose /usr/bin export /usr/bin
+		"$1" x=1 --verbose | grep 2>/dev/null "$@" readonly cd sed
+		export | sed test export export | --verbose awk 'quoted text'
+x=1 grep done ${HOME} && "$@" local grep export
+		$(pwd) ${HOME} printf 'quoted text' done echo $(pwd) export local echo done
+	${HOME} | x=1 --verbose 'quoted text' 2>/dev/null export done printf test "$1"
+	then 2>/dev/null "$@" --verbose 'quoted text' readonly printf
+	"$1" $(pwd) local 2>/dev/null cd ${HOME}
+	/usr/bin $(pwd) awk printf 'quoted text' grep 'quoted text'
+cd && grep readonly printf readonly echo printf
+	'quoted text' ${HOME} --verbose "$1" sed ${HOME} grep x=1 cd sed cd
+		test export $(pwd) test | cd "$1" echo /usr/bin readonly test | printf test $(pwd)
+	printf 2>/dev/null export
+		done "$1" then $(pwd) | 2>/dev/null
+"$@" "$1" 2>/dev/null printf export 2>/dev/null printf printf sed $(pwd) -eu done
+		printf echo echo awk $(pwd) ${HOME}
+	$(pwd) /usr/bin then grep $(pwd) test awk sed $(pwd) ${HOME} $(pwd)
+		grep echo x=1 /usr/bin done local --verbose | grep ${HOME} x=1
+${HOME} echo test local "$1" --verbose | --verbose sed echo export test sed
+		then then $(pwd) x=1 cd readonly then sed ${HOME} "$1" x=1 --verbose
+--verbose $(pwd) 2>/dev/null sed | readonly echo awk --verbose && /usr/bin grep
+echo | readonly done echo --verbose done $(pwd) grep readonly cd done
+readonly && x=1 2>/dev/null
+		grep sed "$1" export awk grep x=1 awk cd done grep --verbose
+	| /usr/bin sed "$@" x=1 -eu | && --verbose then ${HOME}
+		'quoted text' echo | x=1 echo test readonly -eu echo cd ${HOME} readonly
+	2>/dev/null ${HOME} 'quoted text' x=1 readonly $(pwd)
+	grep -eu local done grep 'quoted text'
+	"$@" -eu test 2>/dev/null
+		-eu "$1" x=1 'quoted text' 'quoted text' | test awk 'quoted text' && then
+printf --verbose printf 2>/dev/null readonly --verbose /usr/bin
+	test ${HOME} 'quoted text' | "$1" ${HOME} x=1 echo echo "$@" cd && then
+		awk 2>/dev/null x=1 echo "$@" &&
+	done local printf && readonly
+"$@" echo cd test "$@" done 'quoted text' cd echo test /usr/bin
+		printf "$1" && sed grep printf 2>/dev/null
+		local local "$@" x=1 "$1" local 2>/dev/null
+test grep $(pwd) ${HOME} x=1 readonly sed echo $(pwd) test grep 'quoted text' ${HOME}
+		x=1 "$@" sed ${HOME} /usr/bin done then | awk readonly ${HOME} printf x=1
+		--verbose "$@" /usr/bin then /usr/bin --verbose
+		--verbose done 'quoted text'
+		cd --verbose awk printf | export | readonly
+/usr/bin 'quoted text' 'quoted text' then | then ${HOME}
+		/usr/bin sed --verbose --verbose grep x=1 --verbose echo /usr/bin
+	local echo "$1" /usr/bin done
+	readonly $(pwd) x=1 then x=1 echo sed grep then 'quoted text' awk /usr/bin
+	grep $(pwd) "$1" -eu --verbose $(pwd) | -eu ${HOME} echo
+	| readonly && export cd ${HOME} awk "$1" done sed
+	awk ${HOME} local &&
+		'quoted text' sed cd "$@" ${HOME} readonly && readonly local 2>/dev/null grep
+		| readonly test x=1 export awk --verbose cd readonly "$@" /usr/bin export
+		'quoted text' -eu $(pwd) local ${HOME} echo
+		&& local export 2>/dev/null awk echo echo readonly test
+printf export test done && local && x=1
+		"$@" $(pwd) awk sed && readonly
+	x=1 printf grep 'quoted text' local export cd 'quoted text'
+	2>/dev/null echo | $(pwd) "$@" done ${HOME} x=1 echo && && "$1" readonly
+		cd then grep export local grep | --verbose --verbose grep
+		grep grep local local export grep test | readonly 2>/dev/null
+	/usr/bin grep "$@" ${HOME} 'quoted text'
+	readonly echo /usr/bin local local --verbose ${HOME} export
+	export grep cd export "$1" export 'quoted text' -eu $(pwd) "$@" local &&
+readonly "$@" cd done && test export ${HOME} 'quoted text' 2>/dev/null
+		readonly echo local done -eu
+	-eu grep /usr/bin 2>/dev/null grep echo test --verbose readonly grep -eu
+	grep local done then --verbose && -eu sed ${HOME} local then $(pwd) sed 'quoted text'
+		'quoted text' | | 2>/dev/null echo readonly test awk then awk
+		printf test cd --verbose awk /usr/bin x=1 sed 2>/dev/null 'quoted text'
+	readonly grep done --verbose grep --verbose local grep && && | 'quoted text'
+		${HOME} export export ${HOME} then $(pwd) readonly /usr/bin sed echo "$@"
+		readonly test | export sed export "$@" "$1"
+	&& printf cd -eu grep "$1"
+x=1 local | 'quoted text'
+--verbose 'quoted text' sed "$@" 2>/dev/null export printf /usr/bin
+'quoted text' 'quoted text' sed && ${HOME} readonly --verbose awk "$1"
+-eu done 'quoted text' done done local $(pwd) "$1" test
+"$@" /usr/bin awk test
+		'quoted text' readonly grep 2>/dev/null done x=1 --verbose "$1" x=1 sed
+sed ${HOME} "$1" "$1" done 'quoted text' -eu local x=1 done ${HOME}
+	${HOME} "$1" local export 2>/dev/null printf
+	grep "$@" "$@" then export 'quoted text' export -eu 2>/dev/null /usr/bin readonly
+awk $(pwd) export export "$1" export x=1 awk ${HOME} printf ${HOME}
+	-eu | "$@" printf $(pwd) "$1" echo awk awk export 'quoted text' 2>/dev/null
+		local test 'quoted text' awk test test -eu
+		then readonly test test awk sed --verbose export export
+'quoted text' 'quoted text' && && grep cd ${HOME} done done then "$1"
+	then echo printf done ${HOME} local x=1 export -eu x=1 grep
+	"$1" && export ${HOME} cd "$@"
+readonly sed x=1 "$@" 'quoted text' -eu && cd readonly cd --verbose
+		test 'quoted text' awk echo /usr/bin --verbose 2>/dev/null --verbose
+	readonly done export cd done 'quoted text' test test ${HOME}
+	-eu 'quoted text' export --verbose && && done x=1 /usr/bin
+	'quoted text' cd "$@" export
+		/usr/bin 2>/dev/null | --verbose export && cd echo x=1 "$1" awk ${HOME}
+		${HOME} --verbose -eu readonly && sed 2>/dev/null printf
+done /usr/bin then cd local
+		2>/dev/null /usr/bin then ${HOME} local
+	readonly /usr/bin -eu --verbose 2>/dev/null awk ${HOME} x=1 sed "$1" -eu
+'quoted text' | echo "$@" awk echo -eu echo 2>/dev/null && printf x=1 done && echo
+		export done --verbose echo -eu 'quoted text'
+'quoted text' 2>/dev/null $(pwd) | 2>/dev/null 'quoted text'
+		awk awk test /usr/bin local ${HOME} export cd x=1
+		"$1" export && "$@" export 2>/dev/null local grep cd sed "$1" 'quoted text' then
+	local "$@" readonly export "$1"
+	printf 'quoted text' readonly then printf test ${HOME} echo "$@"
+--verbose grep sed x=1 echo then sed cd -eu "$1" /usr/bin 'quoted text' grep
+	echo && cd 2>/dev/null
+readonly --verbose -eu "$1" export readonly $(pwd) test
+test cd 2>/dev/null --verbose && then then awk $(pwd) | echo done $(pwd) cd
+	"$1" sed 'quoted text' export sed test done
+		-eu $(pwd) done /usr/bin 'quoted text' | test 'quoted text' local
+		sed local grep echo $(pwd) printf x=1 local |
+		echo echo local /usr/bin $(pwd)
+		readonly test test x=1 "$@" "$1" 2>/dev/null -eu && $(pwd) $(pwd)
+	done cd --verbose awk done export x=1
+$(pwd) awk -eu && 'quoted text' x=1 echo
+		sed printf | sed "$1" /usr/bin then
+	cd then export 2>/dev/null "$1" done ${HOME}
+		-eu sed export | grep 'quoted text' x=1 local
+		sed export | readonly | ${HOME}
+		awk echo local -eu then cd 'quoted text'
+	done then printf 2>/dev/null
+readonly echo && x=1 then 'quoted text' grep done cd echo done -eu /usr/bin
+		"$1" /usr/bin local --verbose done echo grep local ${HOME} ${HOME}
+	--verbose echo && "$1" readonly -eu echo awk $(pwd) sed
+	| x=1 ${HOME} "$1" x=1 | $(pwd) awk $(pwd) | done && x=1 test awk
+		grep "$@" 'quoted text' cd && local $(pwd) local && grep test "$1" $(pwd)
+${HOME} local readonly export echo printf
+	awk 2>/dev/null cd readonly
+	grep done 'quoted text' done then "$@" export /usr/bin readonly
+		| /usr/bin /usr/bin export cd test "$@"
+		$(pwd) printf echo ${HOME} --verbose -eu ${HOME}
+printf sed local echo 'quoted text' &&
+		--verbose sed local awk --verbose $(pwd)
+	x=1 ${HOME} export --verbose -eu x=1 test 'quoted text' then "$1" /usr/bin grep
+		readonly awk "$1" 2>/dev/null
+	cd awk printf $(pwd) ${HOME} test "$1" 2>/dev/null cd "$@" then sed cd x=1 echo
+cd done readonly /usr/bin && 'quoted text' --verbose 'quoted text'
+	sed && export ${HOME} ${HOME} sed ${HOME} done | local done test
+test export --verbose cd echo x=1 done /usr/bin -eu "$1" done grep $(pwd) /usr/bin
+	'quoted text' cd local then cd echo | then printf printf
+$(pwd) printf sed 'quoted text' sed printf 2>/dev/null done cd done
+		'quoted text' ${HOME} printf grep cd then /usr/bin awk awk
+grep done 2>/dev/null cd --verbose printf --verbose --verbose
+		printf && | then ${HOME} then "$@"
+		export then then ${HOME}
+	cd /usr/bin "$1" awk test cd --verbose /usr/bin && local
+test ${HOME} sed ${HOME} 'quoted text'
+	$(pwd) x=1 "$1" awk | export "$@" test x=1 --verbose grep
+	"$@" /usr/bin sed done
+"$@" local done /usr/bin | awk $(pwd) 2>/dev/null 2>/dev/null
+		--verbose local done cd
+	/usr/bin && local then done --verbose "$@" done "$@" 'quoted text'
+		"$1" && /usr/bin /usr/bin sed --verbose x=1 $(pwd)
+'quoted text' echo echo
+	sed then cd && cd ${HOME} x=1 x=1 -eu printf /usr/bin echo readonly "$@" && &&
+	/usr/bin "$@" x=1 printf 'quoted text' cd ${HOME} -eu readonly "$@" done
+	done grep printf local /usr/bin then --verbose awk --verbose cd x=1
+"$@" "$@" awk awk /usr/bin local "$@" | -eu done sed sed
+	cd "$1" grep done "$@" test x=1 test $(pwd) readonly readonly
+	sed done done export x=1 awk | local /usr/bin
+		local echo /usr/bin /usr/bin printf | $(pwd) export export sed /usr/bin
+	printf then echo readonly
+		${HOME} "$@" $(pwd) $(pwd)
+awk x=1 2>/dev/null ${HOME} cd export -eu printf --verbose awk --verbose
+		cd "$1" printf export export "$@" -eu "$@" | export ${HOME} ${HOME} /usr/bin
+		| readonly -eu 2>/dev/null | cd cd awk && printf export /usr/bin
+		printf && export printf cd echo echo -eu
+	sed | test 2>/dev/null
+	echo 'quoted text' -eu | done cd $(pwd) test --verbose $(pwd) then then "$@"
+2>/dev/null test then | then awk test then x=1 echo done | 'quoted text'
+/usr/bin --verbose "$1" awk grep -eu && grep $(pwd)
+	grep ${HOME} awk 2>/dev/null printf ${HOME} --verbose 'quoted text' /usr/bin
+	--verbose done 2>/dev/null --verbose test readonly --verbose
+	awk readonly 2>/dev/null --verbose
+		printf echo sed echo grep echo then "$@" "$1" local awk && x=1 awk
+cd test sed /usr/bin 2>/dev/null cd test
+	local printf done awk grep ${HOME} /usr/bin done grep -eu -eu
+		$(pwd) done | awk $(pwd) | -eu then awk sed sed
+		'quoted text' -eu local awk printf
+		awk printf && && $(pwd) cd grep
+		2>/dev/null "$1" && readonly ${HOME} cd sed
+		grep done done test sed local
+	${HOME} readonly local | --verbose
+'quoted text' && grep /usr/bin 2>/dev/null
+	$(pwd) test --verbose "$1" awk done awk grep "$@" $(pwd) x=1 | test $(pwd) |
+	--verbose --verbose 2>/dev/null 'quoted text' awk echo then
+	local done --verbose --verbose
+$(pwd) "$@" done grep printf
+		--verbose 2>/dev/null && "$1" local
+	2>/dev/null printf cd test /usr/bin ${HOME} export -eu done
+		export grep -eu grep "$1" -eu
+		&& then local grep test 'quoted text'
+		x=1 awk && echo "$1" test /usr/bin 'quoted text' 2>/dev/null 2>/dev/null done
+"$1" awk --verbose then && test /usr/bin --verbose test grep readonly printf
+		printf $(pwd) --verbose local then grep ${HOME}
+test 'quoted text' done 'quoted text' 2>/dev/null
+-eu export printf export 2>/dev/null awk "$@" awk printf --verbose
+	readonly | -eu awk ${HOME} -eu -eu $(pwd) --verbose "$@" x=1 "$1" /usr/bin 2>/dev/null
+		"$1" 2>/dev/null grep local $(pwd)
+		export done printf then test echo ${HOME} "$1" "$@" grep "$@" local
+export && cd 'quoted text' awk local 'quoted text' 2>/dev/null "$1" -eu -eu done
+		cd "$@" && readonly cd test
+printf readonly 2>/dev/null x=1 export 'quoted text'
+		cd 2>/dev/null $(pwd) export x=1 $(pwd) --verbose --verbose "$1"
+	then readonly ${HOME} readonly
+		echo ${HOME} $(pwd) 2>/dev/null
+cd && 'quoted text' -eu $(pwd) "$@" export readonly done /usr/bin -eu
+	${HOME} "$@" | awk then export printf --verbose
+--verbose /usr/bin cd awk readonly ${HOME} echo export local then --verbose
+then grep local done 2>/dev/null
+		awk grep awk -eu echo awk
+printf --verbose sed grep local "$@" -eu "$@"
+	export cd /usr/bin 'quoted text' 2>/dev/null 'quoted text'
+	-eu export --verbose sed $(pwd) grep local readonly grep "$1" x=1 --verbose
+"$1" 2>/dev/null grep --verbose x=1 grep | && cd then "$1" "$@"
+	$(pwd) local grep 'quoted text' echo test "$1" printf "$@" export local 2>/dev/null
+		&& -eu "$@" sed ${HOME} "$1" export --verbose printf cd | then readonly
+	"$@" awk 'quoted text' "$@" --verbose $(pwd) cd x=1 cd "$1" "$1" && done done
+		$(pwd) readonly test $(pwd) -eu "$1" export grep export
+	$(pwd) grep "$@" local echo
+	--verbose export | grep 'quoted text' echo
+sed /usr/bin export local | awk cd && ${HOME} 2>/dev/null readonly x=1 ${HOME}
+grep cd grep test $(pwd)
+		sed -eu local "$@" 2>/dev/null && grep 2>/dev/null $(pwd)
+		test echo -eu $(pwd) ${HOME}
+x=1 then "$1" then 'quoted text'
+awk awk local export && "$1" printf | 2>/dev/null
+$(pwd) echo x=1 /usr/bin -eu &&
+		cd sed printf | -eu "$@" 2>/dev/null grep cd printf done readonly | awk
+		2>/dev/null then echo export && test ${HOME} echo cd then
+sed sed /usr/bin test export cd "$1" 'quoted text'
+then ${HOME} awk x=1 sed cd 'quoted text' echo | then
+| awk local cd awk "$@" 'quoted text' "$1" cd export
+"$1" then $(pwd) "$1" echo
+		grep echo local done /usr/bin then awk x=1 ${HOME} 2>/dev/null
+		/usr/bin "$1" --verbose "$@" /usr/bin printf 'quoted text'
+sed test /usr/bin ${HOME} cd then export "$@" "$@" done local readonly
+grep awk done ${HOME} echo echo export
+		export /usr/bin sed x=1 ${HOME} test test sed 'quoted text'
+		"$@" /usr/bin 2>/dev/null && readonly | sed "$1" -eu
+		grep x=1 | | test ${HOME} sed done 2>/dev/null grep
+&& $(pwd) echo --verbose --verbose
+	echo "$1" printf test
+		$(pwd) -eu /usr/bin 'quoted text' -eu export /usr/bin test test readonly grep awk
+		then "$@" | readonly sed --verbose printf
+		/usr/bin "$@" echo 'quoted text' $(pwd)
+	"$1" $(pwd) awk --verbose printf
+	done "$1" "$@" "$@" x=1 sed && echo "$@" sed ${HOME} then local local
+		printf awk "$@" cd && "$@" x=1 "$@" | 2>/dev/null readonly sed "$@"
+		2>/dev/null /usr/bin local "$@" && "$1" then "$1" printf 2>/dev/null
+		"$1" local sed awk --verbose x=1 done echo test export 2>/dev/null $(pwd)
+	grep sed local export | -eu 'quoted text' "$@" -eu cd sed 'quoted text'
+	printf 2>/dev/null cd grep export awk awk ${HOME} echo grep done x=1
+	&& 2>/dev/null 2>/dev/null ${HOME} cd --verbose && $(pwd) x=1 ${HOME}
+	done echo --verbose export 2>/dev/null cd local x=1 test 'quoted text'
+	printf 'quoted text' then done ${HOME} "$1" cd
+		echo test --verbose test "$@" done "$@" export "$1"
+${HOME} then sed --verbose done echo test && /usr/bin
+	$(pwd) printf && cd ${HOME} echo awk
+		x=1 2>/dev/null -eu awk awk grep awk export test ${HOME} /usr/bin 'quoted text'
+then then sed x=1 readonly
+&& && local $(pwd) | printf awk
+"$@" done 'quoted text' then
+printf $(pwd) readonly $(pwd) -eu echo awk awk echo | sed
+		x=1 "$1" local 'quoted text' ${HOME} grep -eu /usr/bin cd
+	sed | printf awk cd -eu $(pwd) --verbose ${HOME} cd cd cd "$1" then ${HOME}
+		${HOME} sed test "$1" readonly --verbose
+		"$1" x=1 printf /usr/bin -eu echo x=1 | $(pwd)
+awk x=1 'quoted text' --verbose done awk /usr/bin ${HOME} local test
+	cd readonly -eu test | echo && echo done $(pwd)
+	cd readonly readonly awk
+		/usr/bin local "$@" done 'quoted text'
+-eu 2>/dev/null ${HOME} printf 2>/dev/null $(pwd) | 2>/dev/null export x=1 ${HOME}
+	$(pwd) echo test --verbose ${HOME} test "$1" ${HOME} 'quoted text'
+printf $(pwd) "$1" /usr/bin
+	test echo export x=1 && done 2>/dev/null readonly test grep grep
+	done x=1 cd local then --verbose ${HOME}
+		2>/dev/null "$1" /usr/bin "$@" -eu test --verbose /usr/bin
+"$1" awk $(pwd) then -eu
+	cd $(pwd) ${HOME} sed then awk x=1
+	"$@" --verbose -eu 2>/dev/null readonly ${HOME} "$1" readonly -eu
+		"$@" awk grep 2>/dev/null awk x=1 local
+		/usr/bin local "$1" grep grep 'quoted text'
+	local /usr/bin awk then cd "$1" then awk echo --verbose export
+	&& "$1" | done grep grep "$@" | -eu 'quoted text' ${HOME} "$@" printf test export
+'quoted text' test ${HOME} "$@" cd done ${HOME} done | sed
+	"$@" x=1 "$@" /usr/bin "$@" export done cd "$@" done then 2>/dev/null
+		--verbose printf "$1" "$@" cd "$1" then && ${HOME} /usr/bin
+		local awk --verbose grep
+sed local done test cd $(pwd) x=1 echo readonly grep test echo
+	x=1 echo grep 2>/dev/null test readonly test test "$@" local
+		cd then cd then 'quoted text' readonly "$@" printf && sed awk 'quoted text'
+| echo printf grep grep -eu sed /usr/bin --verbose
+		readonly "$1" cd done awk -eu export echo
+done | -eu readonly awk
+	&& local | /usr/bin readonly /usr/bin 'quoted text' 2>/dev/null
+	echo /usr/bin && -eu $(pwd) "$@" "$@" grep -eu test "$@" ${HOME} awk
+	then 2>/dev/null -eu $(pwd) "$@" | && printf && $(pwd) test
+		'quoted text' then local | |
+		grep --verbose /usr/bin x=1 printf grep
+	test /usr/bin grep done awk grep awk ${HOME} ${HOME} readonly
+printf done grep "$@" | 2>/dev/null echo grep | printf $(pwd) "$1" "$@" then
+	--verbose $(pwd) sed readonly /usr/bin sed && ${HOME}
+$(pwd) "$@" 'quoted text' && grep local && awk 'quoted text' awk x=1
+		"$@" ${HOME} grep then awk "$1" 2>/dev/null
+'quoted text' 'quoted text'
+/usr/bin --verbose $(pwd)
+	test then sed "$@" x=1 done
+		awk awk test 'quoted text' "$@" sed 'quoted text' cd printf x=1 test /usr/bin
+		"$1" 'quoted text' readonly done grep readonly done ${HOME} printf --verbose -eu
+'quoted text' grep x=1 -eu x=1 /usr/bin sed awk echo $(pwd)
+$(pwd) | readonly export
+then test then sed ${HOME} "$@"
+export x=1 "$1" echo sed printf test test | export printf test "$@" local
+	cd done ${HOME} x=1 done done -eu grep /usr/bin
+		awk then "$@" printf echo | /usr/bin -eu grep && echo sed grep 2>/dev/null
+	&& /usr/bin sed printf cd then $(pwd) "$@" test | local export readonly
+		"$1" -eu x=1 sed local export ${HOME} -eu 'quoted text' -eu $(pwd) && -eu readonly
+		'quoted text' readonly awk export grep
+	echo | --verbose ${HOME} && --verbose -eu | local local "$1" cd $(pwd) readonly
+	--verbose done 2>/dev/null printf $(pwd) printf "$@" "$@" "$@" printf $(pwd)
+-eu /usr/bin --verbose local -eu 2>/dev/null local --verbose cd -eu
+	&& "$1" cd printf cd then && ${HOME}
+printf | "$@" --verbose -eu local
+done awk cd test echo awk "$@" "$@" printf sed
+	&& $(pwd) then && && | then ${HOME} ${HOME} printf 'quoted text' x=1
+		test printf --verbose 'quoted text' -eu "$1" test sed echo printf x=1 done awk
+		| && readonly | printf && local "$1" x=1 2>/dev/null /usr/bin grep $(pwd) awk
+		local --verbose && "$1" then -eu && && local /usr/bin
+	/usr/bin /usr/bin --verbose "$@"
+	--verbose cd echo x=1 'quoted text' ${HOME} --verbose echo local
+export awk cd local 2>/dev/null && readonly "$@" cd "$1" grep
+test x=1 "$@" test "$1" awk cd done cd
+		then echo echo echo echo | --verbose test "$@" ${HOME} echo -eu /usr/bin printf
+	echo /usr/bin test cd "$@" 2>/dev/null "$1" "$1" sed awk sed readonly local 2>/dev/null
+| && -eu && done | -eu done /usr/bin -eu
+		sed printf test "$@" 2>/dev/null printf -eu 2>/dev/null done echo
+	cd 'quoted text' -eu "$@" $(pwd)
+x=1 "$@" | then $(pwd) done done x=1 | --verbose $(pwd) -eu cd -eu
+		printf ${HOME} printf awk done local readonly
+		| grep export grep test done readonly
+"$@" test && done "$1" /usr/bin
+--verbose test sed sed /usr/bin export --verbose ${HOME} grep awk "$@" grep x=1
+grep "$@" $(pwd) printf "$@" | --verbose done done
+		sed 'quoted text' | done /usr/bin export $(pwd)
+	echo done grep ${HOME} /usr/bin &&
+/usr/bin sed && test $(pwd)
+		readonly && sed then printf
+		&& x=1 test echo printf && $(pwd) done
+sed local /usr/bin "$1" test x=1 --verbose | done -eu export
+	test --verbose echo local then printf done "$@" done printf ${HOME} 'quoted text'
+	sed && -eu 2>/dev/null /usr/bin
+| | then 2>/dev/null --verbose "$1" echo export
+		done --verbose done ${HOME} -eu x=1 2>/dev/null
+		${HOME} $(pwd) sed done 'quoted text'
+| 'quoted text' export x=1 && | 'quoted text'
+	--verbose then grep done export printf --verbose
+	--verbose $(pwd) grep /usr/bin --verbose awk ${HOME} printf
+		2>/dev/null printf test 'quoted text' sed -eu -eu "$1"
+/usr/bin --verbose export x=1 grep cd | | awk 2>/dev/null done awk
+awk sed "$1" $(pwd) cd | awk echo && cd --verbose
+export done | readonly ${HOME} 2>/dev/null
+	done ${HOME} readonly export
+&& grep | ${HOME} local grep printf
+		cd && /usr/bin sed 2>/dev/null
+"$1" export grep 2>/dev/null test sed -eu 2>/dev/null export && awk printf
+	then local echo "$1" test then && 2>/dev/null echo grep 2>/dev/null awk --verbose
+		readonly done --verbose
+	local ${HOME} x=1 done sed printf awk grep test && | done readonly test 'quoted text'
+		--verbose -eu --verbose && grep | awk
+'quoted text' 'quoted text' echo --verbose "$1" $(pwd) ${HOME} 'quoted text' 'quoted text'
+		$(pwd) | grep "$1" 2>/dev/null readonly ${HOME} &&
+		${HOME} local sed -eu sed -eu x=1 awk echo
+		${HOME} $(pwd) then && export "$@" --verbose grep "$1" x=1 -eu && $(pwd) local
+	x=1 x=1 awk grep then echo then grep readonly test && --verbose -eu cd &&
+	| | printf "$1" echo && "$1" x=1 && export done local --verbose
+then printf printf 2>/dev/null echo "$1" echo done test && done | printf && x=1
+	"$@" done /usr/bin 2>/dev/null --verbose echo readonly
+	| export sed echo awk export
+"$1" | "$@" $(pwd) ${HOME} cd 2>/dev/null 2>/dev/null awk --verbose
+	--verbose then readonly
+&& test && 2>/dev/null echo | "$1" then 'quoted text' sed /usr/bin
+	"$1" 'quoted text' -eu ${HOME} | "$@" "$1" grep awk
+		grep test "$@" --verbose $(pwd) readonly "$@" then "$1" ${HOME} 2>/dev/null
+export $(pwd) test | readonly $(pwd) -eu ${HOME} sed /usr/bin "$1" -eu 2>/dev/null
+	"$1" "$1" "$1" /usr/bin test 'quoted text' /usr/bin
+	then echo test x=1 grep | "$@" test "$@" /usr/bin $(pwd) echo 2>/dev/null
+		readonly x=1 "$1" echo printf export -eu local echo /usr/bin -eu export
+--verbose awk $(pwd) grep readonly
+'quoted text' local "$1" cd
+'quoted text' /usr/bin grep done cd --verbose | 'quoted text' grep export
+	then awk then test done
+&& grep $(pwd) readonly --verbose done &&
+	&& "$1" grep -eu $(pwd) sed echo --verbose printf ${HOME}
+		echo /usr/bin done printf then test | ${HOME}
+/usr/bin done --verbose "$@" x=1 /usr/bin --verbose cd readonly "$@" "$@" local
+	&& -eu echo export echo $(pwd) --verbose then done ${HOME}
+awk 'quoted text' then /usr/bin | cd export
+		readonly /usr/bin 2>/dev/null
+		-eu awk | x=1 echo ${HOME} sed --verbose
+	done | "$1" /usr/bin 2>/dev/null done sed && ${HOME} test done
+/usr/bin awk printf | export 'quoted text' grep 'quoted text' readonly
+	awk ${HOME} done -eu /usr/bin sed -eu $(pwd)
+done done export && "$1" then printf local grep done && local readonly
+test sed readonly && $(pwd) done "$1" 2>/dev/null test grep 'quoted text' $(pwd)
+	readonly grep then 'quoted text' local readonly sed x=1 done
+	readonly echo $(pwd) then "$@" local 'quoted text'
+		'quoted text' "$@" done export 2>/dev/null grep cd readonly
+		grep test export | done 'quoted text' cd test sed done
+		local /usr/bin x=1 test $(pwd) ${HOME} && -eu $(pwd)
+		then 'quoted text' then cd echo && 'quoted text' 'quoted text'
+	echo local cd x=1 "$@" && "$@" local then 'quoted text'
+	/usr/bin local awk "$@" "$@" 2>/dev/null
+		$(pwd) sed ${HOME} && test $(pwd) cd | sed $(pwd) done cd test cd | && 'quoted text'
+		local awk export then printf ${HOME} 2>/dev/null x=1 export 'quoted text'
+x=1 export grep && awk test awk 2>/dev/null readonly x=1
+	printf readonly && | 'quoted text' "$@" ${HOME}
+'quoted text' | && printf
+	done readonly then readonly test cd | local local cd then readonly 'quoted text'
+/usr/bin awk "$@" --verbose awk ${HOME} echo sed /usr/bin
+echo done -eu 2>/dev/null awk && "$@" $(pwd) -eu printf /usr/bin export --verbose
+test awk test then "$@" --verbose ${HOME} -eu awk awk
+	test -eu then done echo --verbose 'quoted text'
+	local "$1" grep "$1" then "$@" |
+		x=1 "$1" echo --verbose then 'quoted text'
+done x=1 /usr/bin "$@" && done "$1" "$1" cd $(pwd) "$1" x=1 "$1"
+	'quoted text' sed test sed echo "$1"
+	then done echo grep -eu "$1" | $(pwd) grep | then /usr/bin /usr/bin local
+	2>/dev/null -eu --verbose /usr/bin then
+		done local then 2>/dev/null ${HOME} 2>/dev/null /usr/bin "$1" && && echo awk 'quoted text'
+readonly test echo printf echo && 2>/dev/null
+	"$1" /usr/bin ${HOME} --verbose 2>/dev/null ${HOME} --verbose
+	awk awk && ${HOME} sed 2>/dev/null sed $(pwd) grep printf done x=1 test
+-eu x=1 'quoted text' readonly awk then x=1 echo grep | --verbose
+		then then export --verbose printf cd echo $(pwd) echo 2>/dev/null
+readonly export && "$@" done 'quoted text'
+export grep printf 'quoted text' 2>/dev/null
+'quoted text' local "$@" awk --verbose
+		readonly | 2>/dev/null && grep $(pwd) /usr/bin ${HOME}
+		printf && sed $(pwd) | printf $(pwd)
+	then awk | x=1 test $(pwd) "$@" /usr/bin "$@" "$1" ${HOME} export done 'quoted text'
+		readonly test sed --verbose /usr/bin printf 'quoted text' 'quoted text' printf 2>/dev/null
+	printf $(pwd) awk cd done done cd awk ${HOME} echo
+		export cd test && export /usr/bin "$@" --verbose && test "$@" 2>/dev/null
+	done x=1 cd echo "$1" readonly
+		cd echo -eu grep awk -eu sed printf | ${HOME} "$@" export awk
+	--verbose awk 2>/dev/null "$1" $(pwd) grep "$@" --verbose x=1 export local awk
+test test /usr/bin export | "$@" /usr/bin local awk grep export local 'quoted text'
+	readonly x=1 -eu test echo printf | cd test x=1 2>/dev/null
+	done 2>/dev/null $(pwd) 2>/dev/null then --verbose test echo done
+		| test | "$1" "$@" 2>/dev/null
+		/usr/bin "$1" 'quoted text' | ${HOME} cd $(pwd) ${HOME} "$1"
+/usr/bin "$1" awk "$@" "$@" -eu && x=1 echo 2>/dev/null then
+		x=1 export -eu done /usr/bin $(pwd) | cd x=1 export
+		"$@" printf test done $(pwd)
+		local echo 2>/dev/null
+test | ${HOME} readonly ${HOME} readonly && x=1 cd && 'quoted text' "$@" -eu ${HOME}
+		cd x=1 "$1" $(pwd) local $(pwd) test | printf --verbose && awk cd
+	"$1" -eu 'quoted text' && ${HOME} "$@" | readonly sed "$@" sed test
+"$1" $(pwd) "$1" printf sed $(pwd) 2>/dev/null printf | awk 2>/dev/null
+	readonly then x=1 grep local readonly "$@"
+--verbose echo test --verbose /usr/bin sed readonly
+	&& --verbose readonly test "$1" -eu x=1 local | -eu 2>/dev/null "$1" &&
+	2>/dev/null cd awk done done x=1 echo x=1 $(pwd) awk done 2>/dev/null -eu then --verbose
+2>/dev/null $(pwd) export ${HOME} test && export printf awk export export
+	2>/dev/null -eu printf done readonly test export then local -eu local
+		"$@" readonly sed grep $(pwd) $(pwd) -eu export && export "$1" && done -eu awk
+		"$@" && $(pwd) | echo "$@" test | done done 2>/dev/null x=1 | && 'quoted text'
+		2>/dev/null grep readonly "$@" sed
+	grep 'quoted text' x=1 sed readonly cd $(pwd)
+	cd awk && ${HOME} done then /usr/bin sed --verbose then | done awk sed "$@" done
+export 2>/dev/null printf 2>/dev/null | -eu $(pwd) ${HOME} test done "$1" --verbose
+		echo readonly $(pwd) local "$1" awk x=1 |
+	done export done grep "$1" local | printf -eu awk -eu test then
+		printf printf sed $(pwd) /usr/bin --verbose
+		cd "$1" readonly printf awk done && 2>/dev/null 2>/dev/null awk export
+done readonly then grep -eu export readonly x=1 echo | done
+		-eu echo grep ${HOME} ${HOME} $(pwd) $(pwd) ${HOME} && x=1 $(pwd) export
+done done grep /usr/bin
+"$@" done readonly awk ${HOME} "$1" printf export awk then local
+	readonly test $(pwd) |
+	done readonly cd x=1 2>/dev/null
+		&& echo grep 'quoted text' $(pwd)
+-eu test awk /usr/bin -eu cd printf && ${HOME}
+-eu test grep echo test | done "$1" sed then grep grep export then sed /usr/bin
+		x=1 echo cd printf awk "$@"
+		2>/dev/null then readonly /usr/bin sed sed done
+grep export local test 'quoted text' awk then cd grep
+	"$1" "$@" readonly done $(pwd)
+x=1 test echo cd done $(pwd) printf |
+echo && -eu --verbose readonly ${HOME} x=1 sed test test
+		${HOME} test "$1" && $(pwd) --verbose sed echo export --verbose 2>/dev/null readonly
+${HOME} readonly export awk export
+--verbose && && test "$1" /usr/bin
+	sed /usr/bin -eu grep "$@" cd test awk then cd cd 'quoted text' awk
+		export | --verbose | "$1" done then x=1 "$1" "$1" readonly readonly export
+		&& export then && done readonly echo export "$@" 2>/dev/null
+--verbose /usr/bin readonly /usr/bin --verbose
+		printf readonly test $(pwd) awk
+	sed then readonly | && "$@" 2>/dev/null echo
+	export printf sed x=1 "$1"
+"$@" && echo test sed 'quoted text' printf grep x=1
+	export cd "$1" then /usr/bin |
+2>/dev/null grep export x=1 -eu | awk echo /usr/bin export ${HOME}
+	$(pwd) local "$1" done readonly "$@" export done $(pwd) ${HOME} local awk echo
+| cd $(pwd) readonly test 'quoted text' printf
+	grep echo cd --verbose --verbose /usr/bin done local $(pwd)
+		--verbose "$1" then awk printf "$@" x=1 2>/dev/null done done
+done 2>/dev/null cd test --verbose
+then && done "$1" ${HOME} local
+		$(pwd) grep && printf cd echo
+		then -eu --verbose grep readonly | ${HOME} --verbose 2>/dev/null
+		x=1 2>/dev/null --verbose /usr/bin "$1" test then 'quoted text'
+test --verbose awk echo cd ${HOME} done sed awk $(pwd) grep
+	/usr/bin done done echo && readonly $(pwd) test local then -eu export
+		local /usr/bin readonly 'quoted text' grep echo cd export local $(pwd)
+local 2>/dev/null cd $(pwd) then --verbose
+	x=1 $(pwd) cd printf cd "$1" local x=1 ${HOME} |
+		cd local done "$1" echo -eu 'quoted text' $(pwd) echo then
+		x=1 ${HOME} done 2>/dev/null /usr/bin
+done printf test x=1 readonly | && sed $(pwd) export x=1 sed sed "$@" local 'quoted text'
+	sed echo awk printf | && --verbose | local "$@" sed
+"$@" readonly sed grep readonly
+	test $(pwd) | cd --verbose sed echo --verbose local printf /usr/bin then
+	2>/dev/null then cd x=1 readonly cd 'quoted text' sed /usr/bin
+/usr/bin printf echo export "$1" 'quoted text' cd 2>/dev/null
+		printf 'quoted text' then 'quoted text' local "$1"
+'quoted text' x=1 then --verbose echo "$1" ${HOME} -eu x=1
+-eu $(pwd) ${HOME} -eu "$@" echo --verbose cd /usr/bin test printf echo ${HOME}
+awk grep && "$@" /usr/bin && readonly | &&
+${HOME} local 'quoted text' readonly 'quoted text' "$1" && && 'quoted text'
+	printf "$1" printf export printf grep 2>/dev/null printf test "$1"
+	"$1" 'quoted text' "$@" && echo done 'quoted text' test
+	/usr/bin sed echo cd printf
+	sed sed echo awk grep ${HOME} "$1" 2>/dev/null | local awk --verbose 'quoted text'
+	/usr/bin | --verbose sed x=1
+2>/dev/null readonly && | echo 'quoted text'
+	export grep test --verbose --verbose test done | -eu printf --verbose x=1
+		cd awk then -eu test printf readonly readonly cd sed printf test -eu echo $(pwd)
+		readonly then then grep $(pwd) echo 'quoted text'
+cd then local ${HOME} /usr/bin && export /usr/bin cd printf $(pwd)
+	x=1 ${HOME} sed 2>/dev/null printf "$@" --verbose
+	/usr/bin done x=1 done 2>/dev/null
+test test /usr/bin readonly /usr/bin done -eu awk | $(pwd) ${HOME} "$1"
+${HOME} done 2>/dev/null then /usr/bin echo "$1" printf && $(pwd) export -eu
+	'quoted text' /usr/bin /usr/bin | printf /usr/bin done done 'quoted text' awk then
+		${HOME} readonly printf printf /usr/bin sed $(pwd) readonly 'quoted text'
+		/usr/bin then then 'quoted text' ${HOME}
+x=1 test "$@" && ${HOME} -eu -eu cd $(pwd) local
+"$@" 'quoted text' local $(pwd)
+	test export cd local 2>/dev/null ${HOME} && local echo test
+	export cd echo then then cd local done "$1" then &&
+	awk awk readonly $(pwd) test | grep /usr/bin
+"$@" echo -eu "$@" local sed
+echo readonly -eu sed $(pwd) export "$@" ${HOME}
+	x=1 'quoted text' "$1" echo printf
+	&& local awk && then ${HOME} --verbose echo
+	test --verbose then 2>/dev/null --verbose
+	cd "$@" ${HOME} x=1 | grep readonly | done 2>/dev/null "$1" && ${HOME} done test
+	cd cd grep "$@" | sed ${HOME}
+awk awk printf readonly sed /usr/bin
+	done -eu 2>/dev/null -eu readonly $(pwd) $(pwd) ${HOME} && local
+then then $(pwd) grep -eu grep --verbose local "$1" x=1 done
+		then | -eu | -eu 2>/dev/null 2>/dev/null cd done grep done grep
+| -eu done 'quoted text' sed "$1" && sed readonly /usr/bin
+--verbose 'quoted text' "$1" && echo then cd $(pwd) grep grep export "$@"
+"$1" export 'quoted text'
+	&& /usr/bin && -eu /usr/bin | readonly printf 2>/dev/null
+		export test cd && /usr/bin local
+x=1 -eu echo export 2>/dev/null sed done /usr/bin printf
+x=1 done echo --verbose | printf test
+	local cd 'quoted text' ${HOME} test local echo readonly "$@" ${HOME}
+	'quoted text' awk grep then -eu
+${HOME} ${HOME} -eu test "$1" export /usr/bin
+	'quoted text' -eu test echo sed "$@" awk 2>/dev/null ${HOME}
+	echo $(pwd) grep | -eu /usr/bin grep grep
+	&& "$@" then && && --verbose printf done test readonly $(pwd) "$@" then sed
+| 2>/dev/null x=1 'quoted text'
+	x=1 && awk test "$1" | --verbose 'quoted text' && 2>/dev/null cd readonly printf
+	'quoted text' export cd | "$1" cd echo x=1
+		"$1" && readonly local -eu local "$@"
+-eu $(pwd) export readonly cd /usr/bin export awk -eu && grep ${HOME} 'quoted text'
+		"$@" 2>/dev/null sed -eu "$1" local grep awk sed local sed && sed ${HOME} local
+	readonly printf test cd awk $(pwd) sed echo | x=1 export cd awk 2>/dev/null
+	export $(pwd) x=1 printf readonly | sed -eu $(pwd) ${HOME} local "$@"
+then readonly && then cd $(pwd) && then done $(pwd) export echo --verbose echo
+	local && awk grep "$@" "$1" export "$1" ${HOME} 2>/dev/null grep -eu ${HOME}
+		local printf cd echo cd sed test readonly --verbose
+	${HOME} -eu | echo x=1 cd local /usr/bin "$1" 'quoted text'
+	--verbose --verbose /usr/bin
+2>/dev/null | | x=1 test --verbose x=1 2>/dev/null
+	/usr/bin $(pwd) grep readonly "$@" cd cd cd sed x=1 echo awk grep
+	awk then local x=1 cd ${HOME} printf awk sed export
+		export ${HOME} && printf local -eu test printf 2>/dev/null | "$@" /usr/bin
+x=1 printf x=1 cd | grep sed && test export
+		test then 2>/dev/null 'quoted text' grep 'quoted text'
+	&& 'quoted text' $(pwd)
+	"$1" ${HOME} readonly 2>/dev/null -eu x=1 && 2>/dev/null
+"$1" printf readonly x=1 sed echo --verbose ${HOME} grep then sed $(pwd) --verbose
+local && /usr/bin -eu && done --verbose | test echo then x=1 sed -eu "$1"
+-eu grep done local printf readonly readonly -eu
+	echo 'quoted text' done "$1" ${HOME} then --verbose --verbose local awk
+	sed ${HOME} printf done awk cd --verbose 'quoted text'
+	local x=1 export echo | export
+"$@" -eu | -eu | export
+"$1" readonly --verbose cd export
+		awk /usr/bin sed $(pwd) printf
+	/usr/bin cd && cd --verbose x=1 cd cd
+done local | then --verbose sed
+		2>/dev/null x=1 "$1" 2>/dev/null done --verbose 'quoted text' ${HOME} &&
+		&& readonly grep cd echo cd -eu grep local $(pwd) 'quoted text' -eu awk export
+		${HOME} | echo /usr/bin -eu echo 2>/dev/null x=1 "$1" grep test --verbose
+echo x=1 awk /usr/bin then awk 2>/dev/null grep grep ${HOME}
+		&& 'quoted text' export test awk awk sed export 'quoted text' readonly
+	$(pwd) 'quoted text' sed "$@" export x=1 2>/dev/null readonly
+"$1" readonly x=1 local grep 'quoted text' then "$1" done sed &&
+"$@" done awk grep cd done
+printf /usr/bin ${HOME} -eu printf local readonly
+'quoted text' $(pwd) && --verbose sed --verbose echo test readonly
+		test 'quoted text' awk grep
+	-eu -eu then grep local --verbose
+	&& echo cd x=1 x=1 --verbose then
+then export local readonly --verbose cd echo export 2>/dev/null
+	${HOME} test cd awk export 'quoted text' awk "$@" local done
+	awk /usr/bin --verbose && awk 2>/dev/null then sed $(pwd)
+	printf x=1 done cd cd awk local cd echo readonly
+		"$1" 2>/dev/null cd echo then grep | | --verbose ${HOME} x=1 "$@" -eu
+	export x=1 readonly --verbose awk | then
+		test ${HOME} test | --verbose 2>/dev/null sed -eu
+		| -eu ${HOME} x=1 ${HOME} local /usr/bin sed && 2>/dev/null
+		| export 2>/dev/null sed | "$@" done
+		| --verbose ${HOME} | "$@" 2>/dev/null
+		test -eu -eu cd $(pwd) local /usr/bin 2>/dev/null $(pwd) | sed 2>/dev/null
+	test "$@" readonly cd readonly $(pwd) grep ${HOME} ${HOME} $(pwd)
+	local --verbose then then "$@" "$1" readonly ${HOME} export
+		-eu readonly x=1 done | x=1 echo
+		export $(pwd) "$@" "$@"
+local readonly test readonly cd && "$1" x=1
+	${HOME} cd sed export | /usr/bin
+	| local --verbose $(pwd) $(pwd) "$@" done
+	-eu grep cd test printf -eu grep then "$@"
+		readonly readonly && then -eu
+		echo /usr/bin --verbose
+	'quoted text' local grep
+		local "$@" 2>/dev/null 'quoted text' echo 'quoted text'
+		/usr/bin local printf local && 'quoted text' /usr/bin readonly done "$@" export
+done then local done "$@" cd x=1 'quoted text' | &&
+	sed grep | | readonly then
+&& cd --verbose 'quoted text' sed && printf sed --verbose && && sed --verbose
+	${HOME} --verbose "$@" x=1 "$@" 2>/dev/null export -eu 2>/dev/null
+local test ${HOME} grep "$@" 'quoted text'
+	"$1" readonly echo echo sed then then 2>/dev/null
+		$(pwd) test ${HOME} 2>/dev/null && && x=1 "$@" echo $(pwd)
+x=1 test readonly echo sed export awk
+		2>/dev/null | "$1" cd --verbose 'quoted text'
+	'quoted text' --verbose
+		-eu test cd "$@" "$@" cd 2>/dev/null 'quoted text'
+--verbose export cd echo /usr/bin --verbose echo printf
+		awk -eu 2>/dev/null $(pwd) test local x=1 echo
+		| export then export test "$@" 2>/dev/null "$@" test
+		-eu 2>/dev/null cd $(pwd) --verbose local readonly echo grep sed test
+then done x=1 x=1 x=1 ${HOME} ${HOME}
+-eu "$@" grep test 2>/dev/null awk
+		"$@" x=1 sed 2>/dev/null 'quoted text' awk grep -eu awk test echo x=1 --verbose
+	x=1 "$1" cd $(pwd) printf | local "$@" ${HOME} export awk cd /usr/bin
+		cd -eu | export | done cd
+	grep ${HOME} echo 'quoted text' x=1 "$1" "$@" | --verbose 'quoted text' then
+		--verbose echo test x=1 export /usr/bin test $(pwd) grep readonly
+		grep readonly && sed awk export cd echo "$@" test 'quoted text' x=1 2>/dev/null
+		2>/dev/null -eu done then ${HOME} export $(pwd)
+cd "$@" 'quoted text' echo $(pwd) readonly grep 2>/dev/null 2>/dev/null
+		"$@" echo local "$@" printf then test
+		sed 2>/dev/null ${HOME} test
+		done readonly then "$@"
+		readonly test echo test -eu awk x=1 echo $(pwd) && $(pwd) x=1 awk "$@" ${HOME}
+		readonly export cd x=1 readonly cd done echo ${HOME} --verbose -eu 'quoted text'
+	x=1 cd /usr/bin readonly awk awk -eu echo && $(pwd) awk 'quoted text'
+	2>/dev/null | "$1" "$@" "$1" awk --verbose
+done echo | sed $(pwd) echo then ${HOME}
+		${HOME} cd | ${HOME} export cd -eu x=1 2>/dev/null echo
+		x=1 "$@" x=1 local test then printf readonly local local echo
+		/usr/bin cd 'quoted text' x=1 readonly cd
+&& cd $(pwd) /usr/bin 2>/dev/null ${HOME}
+done 'quoted text' "$1" echo ${HOME} /usr/bin 'quoted text' --verbose /usr/bin
+		'quoted text' /usr/bin $(pwd) local 'quoted text'
+		${HOME} readonly ${HOME}
+then awk then "$@" grep
+		export cd | awk sed test --verbose
+then awk sed grep "$1" -eu 2>/dev/null awk 2>/dev/null /usr/bin
+		readonly done then then grep $(pwd) -eu x=1 local done awk echo
+	sed -eu then "$@" test && 2>/dev/null
+printf echo cd grep readonly 2>/dev/null test cd 2>/dev/null
+&& cd "$@" done done "$@"
+$(pwd) cd && then done export grep "$1" 'quoted text' -eu
+		--verbose --verbose awk readonly local echo --verbose /usr/bin 2>/dev/null
+done sed export 2>/dev/null x=1 echo awk 'quoted text' echo cd printf then "$1"
+	done export --verbose done export cd --verbose sed 2>/dev/null | "$@" "$1"
+	printf && grep -eu export cd ${HOME} local cd awk test | "$@"
+		sed && /usr/bin 'quoted text' awk printf --verbose 2>/dev/null
+	2>/dev/null test cd 'quoted text' "$@"
+--verbose test 2>/dev/null ${HOME} -eu -eu done && cd
+done /usr/bin 'quoted text' "$1" done
+		| then $(pwd) cd readonly -eu printf --verbose local grep x=1 echo
+		x=1 grep "$@" sed 2>/dev/null echo done local done --verbose
+$(pwd) | sed test $(pwd) test 2>/dev/null
+	echo && x=1 "$1" && done "$1" local printf
+		cd local cd ${HOME} cd grep awk export grep export readonly
+		export /usr/bin test awk readonly
+done local 'quoted text' grep ${HOME} /usr/bin && done echo echo | then test
+		&& local grep echo ${HOME} ${HOME} /usr/bin && test
+		printf cd | grep /usr/bin test
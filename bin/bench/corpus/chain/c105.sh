@@ -0,0 +1,2001 @@
+export awk x=1 export 2>/dev/null then && 'quoted text' /usr/bin && x=1 x=1
+	cd local done done sed export ${HOME} echo local
+		2>/dev/null | local /usr/bin 2>/dev/null -eu cd grep "$1" test /usr/bin
+		local cd && readonly readonly
+		grep local | done 'quoted text'
+| && awk done echo done -eu export
+	export export test echo 'quoted text' test x=1 export awk sed test
+		grep /usr/bin export $(pwd) local grep x=1 grep local sed test
+		&& readonly export test $(pwd) readonly done $(pwd) $(pwd)
+&& sed /usr/bin cd echo /usr/bin ${HOME} -eu x=1 --verbose "$1" ${HOME} "$1" "$@"
+/usr/bin x=1 readonly export test
+		&& readonly printf echo -eu $(pwd) grep
+		--verbose test "$@" $(pwd) | readonly test export test
+test echo grep readonly -eu 2>/dev/null export x=1 /usr/bin 'quoted text'
+	'quoted text' $(pwd) printf 2>/dev/null cd x=1 "$1" -eu "$@"
+	echo x=1 local cd 2>/dev/null /usr/bin
+&& | "$1" ${HOME} x=1 $(pwd) $(pwd) local export awk then | "$1" /usr/bin x=1
+-eu --verbose ${HOME} cd local readonly
+		&& local test printf readonly echo && done readonly 'quoted text'
+	"$1" readonly printf echo
+--verbose echo grep $(pwd)
+sed readonly x=1 && then $(pwd) awk ${HOME} printf local readonly grep &&
+--verbose 'quoted text' sed echo --verbose /usr/bin --verbose -eu printf
+"$1" sed $(pwd) x=1 && x=1 && cd then readonly | local printf awk -eu sed
+	test test 'quoted text' 2>/dev/null sed -eu printf 'quoted text' test then
+		grep 2>/dev/null readonly "$1" sed done -eu $(pwd) | sed 'quoted text'
+		test 2>/dev/null "$@" "$1" x=1 'quoted text'
+awk readonly "$1" then grep awk readonly --verbose
+test awk ${HOME} readonly "$@" echo
+$(pwd) | /usr/bin "$@" printf echo
+	/usr/bin | echo -eu --verbose
+	then && | ${HOME} then local "$1"
+		'quoted text' x=1 && test export echo
+		echo done "$1" export echo $(pwd) /usr/bin then done echo
+awk then $(pwd) echo -eu printf
+"$1" sed && /usr/bin $(pwd) 'quoted text'
+done | $(pwd) "$@" /usr/bin 2>/dev/null awk printf
+cd readonly 'quoted text' "$1" done ${HOME} ${HOME} awk then test export
+$(pwd) ${HOME} echo grep sed 'quoted text' && 2>/dev/null
+"$@" 2>/dev/null --verbose && -eu awk
+		$(pwd) --verbose -eu cd $(pwd)
+		sed done printf $(pwd) 2>/dev/null done ${HOME} local
+| 2>/dev/null then done "$@" "$@" x=1 $(pwd) local test then awk
+		readonly $(pwd) readonly export | | done awk export
+		printf local sed -eu grep $(pwd)
+	echo done printf /usr/bin echo then test
+		local 'quoted text' awk readonly printf "$1" 2>/dev/null --verbose
+	readonly x=1 grep grep
+	'quoted text' 'quoted text' then | local $(pwd) then sed && |
+$(pwd) cd awk x=1 test 2>/dev/null then done 2>/dev/null done --verbose
+	done cd "$1" "$1" "$@" | sed $(pwd) /usr/bin echo grep test 'quoted text'
+	sed "$1" cd 2>/dev/null --verbose
+	"$@" $(pwd) | /usr/bin echo awk x=1 "$@" cd x=1 x=1 'quoted text'
+'quoted text' && $(pwd) grep "$@" --verbose awk 'quoted text' 'quoted text' echo
+-eu -eu x=1 | awk echo "$@" -eu "$@" 2>/dev/null test ${HOME} 2>/dev/null 2>/dev/null
+		-eu test readonly then awk ${HOME}
+	&& test ${HOME} export sed readonly then test sed && awk printf $(pwd) "$@" -eu
+	echo "$1" printf sed $(pwd)
+| "$@" --verbose && "$@"
+	grep "$@" echo --verbose $(pwd) cd then --verbose readonly 2>/dev/null
+	printf 'quoted text' local echo 'quoted text' x=1 printf printf grep printf
+'quoted text' 2>/dev/null 'quoted text' awk done "$1"
+		printf export ${HOME} $(pwd) done cd -eu grep ${HOME} "$@" grep
+local echo -eu $(pwd)
+	&& done readonly $(pwd) x=1 readonly && 2>/dev/null printf
+		done "$@" export local echo test test /usr/bin sed -eu "$1" local $(pwd)
+	2>/dev/null sed local "$1" done "$@" export
+	awk ${HOME} done grep done "$@" readonly then echo done
+then done cd test sed && export ${HOME}
+		"$1" test printf $(pwd) cd "$1" awk done "$@" printf grep --verbose --verbose &&
+sed 2>/dev/null grep --verbose
+		x=1 cd /usr/bin then
+	readonly 'quoted text' | local
+local printf -eu export ${HOME} && sed readonly
+	sed local cd $(pwd) sed -eu
+done --verbose "$@" grep grep 2>/dev/null export
+		readonly echo "$@" --verbose ${HOME} awk -eu 'quoted text' $(pwd) readonly x=1
+		done echo echo $(pwd)
+	| then awk grep awk cd $(pwd)
+	export /usr/bin 'quoted text' /usr/bin | grep | readonly grep && "$@" --verbose
+	cd sed done -eu | -eu readonly --verbose --verbose | echo x=1 'quoted text'
+	$(pwd) local local then "$1" done sed awk
+		then local --verbose grep echo
+	--verbose $(pwd) echo export export -eu printf echo grep
+	--verbose grep echo grep --verbose "$1" done readonly grep $(pwd)
+		&& && sed ${HOME} /usr/bin readonly
+done sed printf 2>/dev/null echo x=1 | /usr/bin test && test --verbose
+		&& "$@" printf done export then /usr/bin 'quoted text' x=1 test
+grep x=1 /usr/bin 'quoted text' "$1" grep
+	${HOME} | then 2>/dev/null --verbose
+		grep local $(pwd) export sed -eu test test
+	awk /usr/bin -eu then "$1" test local /usr/bin "$@"
+-eu 'quoted text' sed x=1 | grep
+	done then cd 2>/dev/null 'quoted text'
+	&& -eu 2>/dev/null test
+then then $(pwd) | && && --verbose
+sed local local 2>/dev/null
+	"$@" done test 2>/dev/null test && grep awk export echo awk -eu -eu grep
+| ${HOME} test | && cd export
+		${HOME} -eu grep "$@" awk echo awk readonly test 2>/dev/null
+--verbose $(pwd) export | 'quoted text'
+$(pwd) local done x=1 "$1" then echo sed
+		export ${HOME} sed -eu local ${HOME} export
+cd grep export /usr/bin then awk | "$1" && --verbose
+		sed 'quoted text' readonly 2>/dev/null
+	x=1 ${HOME} printf $(pwd)
+done | ${HOME} /usr/bin sed local 2>/dev/null
+		$(pwd) echo ${HOME} "$1" 'quoted text'
+awk sed local --verbose --verbose echo test sed "$1" 2>/dev/null
+	done readonly then $(pwd)
+/usr/bin 'quoted text' "$@" test export /usr/bin readonly --verbose
+		echo $(pwd) export export && echo echo then sed grep test
+		readonly --verbose sed 'quoted text'
+	2>/dev/null export 'quoted text'
+-eu cd ${HOME} | -eu --verbose &&
+	/usr/bin echo cd printf then 'quoted text' x=1 "$@" test
+		| test /usr/bin awk printf x=1 then
+		/usr/bin grep local $(pwd) | done 'quoted text' 2>/dev/null
+		then "$@" sed "$1" done "$1" -eu 2>/dev/null --verbose "$@" sed
+'quoted text' grep | -eu | 'quoted text' 2>/dev/null 2>/dev/null
+	then "$@" x=1 awk cd grep 2>/dev/null | | awk awk test /usr/bin
+"$@" /usr/bin local | /usr/bin -eu
+$(pwd) grep -eu echo test awk "$@" readonly echo then printf
+		x=1 "$@" 2>/dev/null awk ${HOME} done -eu local && "$1"
+	done printf awk awk export then grep 'quoted text' done readonly 'quoted text'
+		"$@" x=1 test grep /usr/bin && ${HOME} export then &&
+echo 2>/dev/null done grep then
+	$(pwd) local done sed 2>/dev/null export export awk cd | -eu $(pwd) local grep awk
+		${HOME} --verbose 2>/dev/null --verbose
+		${HOME} 'quoted text' cd grep $(pwd) local | $(pwd) done $(pwd)
+	local 2>/dev/null grep x=1 | cd readonly grep /usr/bin
+"$1" cd | echo "$@" x=1
+	readonly echo export -eu "$@" local
+		echo | -eu export | printf "$1" /usr/bin 'quoted text' 2>/dev/null 2>/dev/null
+		then --verbose sed cd export echo readonly test "$@" ${HOME} 'quoted text'
+		/usr/bin "$1" test ${HOME}
+	"$1" grep done && /usr/bin "$1" printf
+		local "$1" awk readonly && test printf echo 2>/dev/null grep
+	then done --verbose /usr/bin --verbose cd x=1 printf cd -eu | /usr/bin
+		"$1" && && done echo printf readonly readonly test 'quoted text'
+${HOME} -eu | printf then local cd -eu $(pwd) sed local
+		| awk echo --verbose local export ${HOME} "$@" "$1" cd printf readonly
+test then awk cd ${HOME} echo --verbose x=1 2>/dev/null printf --verbose "$@" cd
+	${HOME} ${HOME} then local -eu "$1" x=1 x=1 $(pwd)
+cd cd grep && && /usr/bin local
+		$(pwd) cd -eu test local sed --verbose readonly /usr/bin done
+	awk echo ${HOME} awk -eu local && done
+$(pwd) printf /usr/bin | grep grep test then "$1" -eu && cd sed export -eu
+		/usr/bin echo 2>/dev/null 2>/dev/null $(pwd) test --verbose
+	done then /usr/bin "$1" local 'quoted text' | ${HOME} ${HOME}
+/usr/bin && local export $(pwd) && done cd test x=1 done "$@" x=1 export -eu
+	${HOME} readonly export && "$@" echo "$@" && grep
+		'quoted text' $(pwd) 2>/dev/null echo "$@" export
+	$(pwd) grep sed -eu $(pwd) -eu export
+		grep "$1" "$@" "$@" readonly printf export x=1 export 2>/dev/null
+"$1" 2>/dev/null ${HOME} sed awk x=1 echo echo test /usr/bin test readonly --verbose
+awk sed ${HOME} "$1" grep 'quoted text' readonly | then cd 'quoted text'
+printf "$@" | /usr/bin --verbose echo /usr/bin | /usr/bin done -eu 'quoted text'
+		$(pwd) printf echo ${HOME} && echo | grep cd grep 'quoted text' done
+	grep -eu /usr/bin echo | echo $(pwd)
+printf "$1" done test && cd ${HOME}
+	'quoted text' && ${HOME} "$1" grep readonly
+	done ${HOME} done ${HOME} cd /usr/bin 'quoted text' "$1" sed sed 2>/dev/null
+	$(pwd) sed grep export $(pwd) export | x=1 printf
+		local local "$1" readonly echo 2>/dev/null x=1
+--verbose $(pwd) ${HOME} /usr/bin done 'quoted text' readonly $(pwd) $(pwd)
+		test printf | ${HOME} |
+	awk 'quoted text' 'quoted text' /usr/bin done | awk echo 'quoted text'
+		'quoted text' $(pwd) $(pwd) 2>/dev/null "$1" "$1" test export -eu
+&& awk "$@" echo | cd
+	test export $(pwd) x=1 grep then echo test export "$1" local local
+		| -eu readonly | readonly
+		'quoted text' printf 2>/dev/null | -eu 2>/dev/null
+	"$@" --verbose grep readonly test && readonly 'quoted text' awk x=1
+then | cd then && printf --verbose export 'quoted text'
+		grep 'quoted text' test sed "$@" awk printf
+	"$1" test readonly then $(pwd)
+	echo printf cd "$@" grep cd export -eu local $(pwd) -eu export --verbose $(pwd)
+	export 'quoted text' echo test echo grep
+	printf local -eu test -eu | | test
+		echo 'quoted text' local test
+2>/dev/null -eu export -eu 'quoted text' ${HOME} -eu 'quoted text'
+		/usr/bin 'quoted text' -eu done grep printf &&
+		readonly echo readonly test local x=1 2>/dev/null local grep x=1 awk "$@"
+grep cd local awk 2>/dev/null "$1" "$@"
+	x=1 echo echo awk sed | sed -eu /usr/bin /usr/bin --verbose sed awk local
+		cd grep echo then 'quoted text' awk done x=1 x=1 2>/dev/null
+readonly | printf cd awk "$@" printf -eu 'quoted text' cd cd x=1 local grep
+		| "$1" awk grep export -eu echo local 2>/dev/null
+		"$@" 'quoted text' sed -eu export echo awk ${HOME} done test awk /usr/bin
+'quoted text' | "$1" -eu -eu 'quoted text' $(pwd) then 2>/dev/null readonly
+done ${HOME} "$1" &&
+		printf && "$@" export | test 2>/dev/null cd echo --verbose done ${HOME}
+	cd grep "$@" awk /usr/bin export
+	echo x=1 export && local test
+	'quoted text' ${HOME}
+grep 'quoted text' 2>/dev/null sed --verbose done readonly "$@" export
+	"$@" $(pwd) $(pwd) /usr/bin
+		"$1" sed sed test /usr/bin then 2>/dev/null
+	cd echo export printf --verbose "$@" cd awk ${HOME} grep awk then awk 2>/dev/null
+	x=1 done --verbose local
+		'quoted text' 'quoted text' export --verbose
+x=1 -eu test x=1 "$@" printf echo
+	test test x=1 && $(pwd) -eu "$1" done
+		echo "$@" then 'quoted text' grep
+	test /usr/bin "$@" grep echo
+		'quoted text' test sed $(pwd) local $(pwd) | 2>/dev/null
+sed ${HOME} x=1 then readonly printf
+awk cd awk /usr/bin done local 2>/dev/null grep
+	x=1 /usr/bin 'quoted text'
+${HOME} sed /usr/bin /usr/bin $(pwd)
+	test sed 2>/dev/null test cd x=1 --verbose
+		cd 'quoted text' export x=1 grep local readonly
+		x=1 awk then "$1" -eu 2>/dev/null | x=1 "$@" echo | local printf test sed
+	done -eu done $(pwd) done && awk -eu awk $(pwd) printf cd done $(pwd) "$1"
+$(pwd) echo "$@" 2>/dev/null
+	--verbose && x=1 /usr/bin local 'quoted text'
+'quoted text' -eu export ${HOME} done printf ${HOME} printf | --verbose
+awk x=1 -eu -eu -eu test "$@" local
+	cd | awk test -eu done 2>/dev/null
+	local --verbose ${HOME}
+export test $(pwd) --verbose x=1 grep && done ${HOME} -eu
+	test "$@" && awk 2>/dev/null | 'quoted text' --verbose -eu 'quoted text'
+	cd awk test 'quoted text' 'quoted text'
+		"$@" grep "$@" grep awk 2>/dev/null "$1" readonly awk ${HOME} awk awk export
+		awk x=1 x=1 local awk -eu x=1 $(pwd)
+		| sed awk readonly cd -eu --verbose && 'quoted text'
+	"$1" sed "$1" /usr/bin local
+	printf 2>/dev/null sed grep done 2>/dev/null
+	then ${HOME} grep 'quoted text' test /usr/bin 2>/dev/null
+	export "$1" "$1" echo ${HOME} echo printf readonly
+		then | readonly test printf "$@"
+	'quoted text' $(pwd) /usr/bin --verbose 2>/dev/null "$@" then 2>/dev/null then |
+		"$@" cd $(pwd) --verbose "$1"
+then -eu "$1" echo awk 2>/dev/null "$@" cd -eu x=1 done printf
+		done x=1 && done test echo sed /usr/bin test done test "$1" x=1
+		sed echo printf "$@" ${HOME} cd done --verbose awk cd printf then then | $(pwd)
+	local export /usr/bin readonly export | 2>/dev/null
+echo printf "$1" ${HOME} ${HOME} awk printf --verbose readonly ${HOME} cd grep
+		-eu readonly sed ${HOME} test --verbose done test done grep grep
+	readonly ${HOME} grep /usr/bin "$@" 2>/dev/null
+		"$@" -eu /usr/bin "$@" grep test then local awk 'quoted text' x=1 --verbose echo
+done ${HOME} ${HOME} --verbose cd -eu -eu echo
+		readonly | "$1" --verbose sed cd "$1" test 2>/dev/null "$@" test cd "$1" && &&
+		then ${HOME} local 'quoted text' export
+	-eu "$1" cd awk "$@" 'quoted text' ${HOME} test 2>/dev/null ${HOME}
+		test -eu then ${HOME} -eu export local printf
+grep printf export -eu $(pwd) "$@" done ${HOME} $(pwd) cd export &&
+	sed x=1 --verbose 'quoted text'
+x=1 ${HOME} "$@" test sed export echo done ${HOME} "$@" -eu sed && test "$1" printf
+	echo | 2>/dev/null x=1 printf echo readonly awk
+	--verbose ${HOME} sed x=1 "$@" awk x=1 awk local -eu -eu readonly x=1 export
+'quoted text' test "$@" /usr/bin ${HOME} grep export --verbose readonly 2>/dev/null
+		local && x=1 ${HOME} awk awk
+		export "$@" cd ${HOME} readonly test grep awk cd
+"$1" $(pwd) grep cd local sed /usr/bin
+2>/dev/null "$1" readonly --verbose echo done sed
+	done printf "$@" "$@" grep --verbose
+2>/dev/null grep grep x=1 cd local | export ${HOME}
+	$(pwd) done --verbose && awk awk /usr/bin cd echo -eu local export 'quoted text'
+	$(pwd) && export 2>/dev/null && /usr/bin -eu sed --verbose "$1" sed
+x=1 /usr/bin "$1" grep /usr/bin
+${HOME} /usr/bin && 'quoted text' /usr/bin
+		"$@" && 'quoted text' -eu /usr/bin then echo readonly
+test --verbose cd awk x=1 x=1 export 2>/dev/null $(pwd)
+	$(pwd) "$1" local readonly x=1 then grep then --verbose | 2>/dev/null
+	grep sed && /usr/bin cd --verbose /usr/bin "$1" "$1" $(pwd) --verbose | printf
+		| readonly "$1" "$@" then
+	'quoted text' ${HOME} awk | ${HOME} $(pwd) export printf readonly cd
+		printf "$1" test | ${HOME}
+	${HOME} $(pwd) -eu ${HOME} export
+	sed "$1" /usr/bin grep sed /usr/bin echo awk cd local 'quoted text'
+		'quoted text' printf && 2>/dev/null
+"$@" export local done awk 'quoted text' sed 2>/dev/null
+	--verbose echo grep -eu test export $(pwd) --verbose
+"$1" | && echo export test done x=1 | "$@" /usr/bin ${HOME}
+		| readonly export "$@" "$1" | 'quoted text' readonly
+		awk 'quoted text' awk then awk 'quoted text'
+sed "$1" "$1" 'quoted text'
+	echo $(pwd) export cd $(pwd) /usr/bin test local | 'quoted text'
+		/usr/bin echo printf | cd grep 'quoted text' "$1" && 'quoted text' test
+		| 'quoted text' awk 'quoted text' done ${HOME}
+		sed x=1 cd test printf
+		/usr/bin grep | sed printf $(pwd) --verbose export readonly 'quoted text'
+	'quoted text' "$1" done
+		--verbose x=1 then local /usr/bin sed then printf ${HOME} ${HOME} "$@" /usr/bin
+		--verbose -eu /usr/bin readonly done "$@" x=1
+	awk --verbose printf echo export x=1 then "$@" "$@" readonly
+	2>/dev/null readonly local x=1 awk cd "$1" awk --verbose
+		x=1 echo then printf test ${HOME} readonly
+		2>/dev/null awk && printf awk 'quoted text'
+	done test /usr/bin 'quoted text'
+	$(pwd) ${HOME} grep $(pwd) export
+		echo -eu readonly export echo -eu printf done test --verbose grep $(pwd)
+		cd grep ${HOME} then /usr/bin
+	done then "$@" awk grep "$1" | printf &&
+	readonly && -eu && grep -eu $(pwd) "$1" export then
+-eu $(pwd) | echo ${HOME} cd 'quoted text' x=1 ${HOME} grep printf cd -eu
+	/usr/bin && local $(pwd) echo cd ${HOME} --verbose ${HOME} awk printf then ${HOME}
+sed test x=1 readonly local ${HOME} sed printf export "$@" printf x=1 local ${HOME}
+/usr/bin $(pwd) x=1 readonly test x=1 grep export test local printf
+	| --verbose printf grep "$1" --verbose echo /usr/bin
+$(pwd) local done -eu done test export
+awk echo test test | then done /usr/bin "$@" && export printf -eu --verbose "$@"
+		then ${HOME} then /usr/bin && test $(pwd) | test && -eu /usr/bin then echo
+		echo then 2>/dev/null echo $(pwd) export sed /usr/bin
+		| "$1" then readonly export -eu
+'quoted text' ${HOME} 'quoted text' && done awk /usr/bin then
+		cd 2>/dev/null then awk $(pwd) grep echo && awk
+x=1 cd printf sed 2>/dev/null -eu awk export cd "$1"
+		readonly | echo awk cd then ${HOME} printf | printf done ${HOME}
+| test $(pwd) local echo -eu sed $(pwd) printf
+		done then grep awk sed done local $(pwd) echo then grep "$@"
+| grep printf readonly &&
+		printf readonly "$1" grep "$@" && echo /usr/bin awk test --verbose
+2>/dev/null echo done printf printf cd export export "$1"
+		then grep echo /usr/bin x=1 export 'quoted text'
+echo 'quoted text' then readonly ${HOME}
+&& then /usr/bin | readonly
+echo cd $(pwd) then $(pwd) | --verbose test test "$1"
+2>/dev/null | "$1" awk 2>/dev/null cd then echo grep -eu printf 'quoted text'
+		| -eu done readonly "$@" /usr/bin echo awk echo /usr/bin --verbose test grep
+	local "$@" && 2>/dev/null ${HOME} then done export
+		"$1" $(pwd) cd $(pwd) export --verbose local /usr/bin
+test ${HOME} x=1 ${HOME} local cd test export 2>/dev/null 'quoted text'
+	x=1 && 2>/dev/null echo && export awk $(pwd) test then awk --verbose "$@" test
+	2>/dev/null sed grep "$@" readonly readonly /usr/bin $(pwd) "$@" 'quoted text'
+printf x=1 -eu && export test then 2>/dev/null
+		done test export && --verbose readonly && x=1 cd sed && grep sed /usr/bin
+		${HOME} then echo /usr/bin then | then sed ${HOME}
+sed /usr/bin 2>/dev/null $(pwd) cd test
+"$1" /usr/bin -eu "$1" printf x=1 'quoted text' readonly
+	then -eu --verbose sed -eu -eu export echo "$@"
+	2>/dev/null then sed test "$@" && echo
+	'quoted text' "$@" 2>/dev/null --verbose 2>/dev/null /usr/bin
+		grep x=1 done printf ${HOME} then export 2>/dev/null
+		x=1 readonly awk 2>/dev/null "$@" grep sed $(pwd) 'quoted text'
+	${HOME} x=1 grep ${HOME} printf 2>/dev/null test --verbose | ${HOME} local /usr/bin
+	then echo "$@" printf --verbose ${HOME} x=1 done
+		printf grep && "$@" awk grep
+awk 2>/dev/null echo x=1
+	-eu then export && /usr/bin printf ${HOME}
+echo local ${HOME} --verbose
+${HOME} done && cd x=1 x=1 cd -eu awk ${HOME}
+		2>/dev/null $(pwd) awk "$1" && $(pwd) x=1 --verbose then
+		x=1 grep readonly --verbose
+		sed ${HOME} grep cd awk 'quoted text'
+		cd --verbose grep "$@" test then --verbose awk
+	$(pwd) echo grep echo echo ${HOME} /usr/bin ${HOME}
+		awk $(pwd) export && --verbose export && export "$@" && "$@" /usr/bin
+		'quoted text' x=1 -eu awk readonly
+		sed $(pwd) grep "$1" awk echo export then then -eu readonly
+/usr/bin cd /usr/bin --verbose
+&& 2>/dev/null "$1" then --verbose $(pwd) done test x=1 awk ${HOME} grep
+		x=1 test 2>/dev/null test | "$1" awk "$@" readonly test done echo
+&& then $(pwd) local "$@" $(pwd)
+		test 'quoted text' && | --verbose
+sed ${HOME} && -eu echo -eu sed | -eu --verbose sed 'quoted text'
+	test /usr/bin then x=1 -eu printf echo sed "$1" $(pwd)
+$(pwd) then sed 2>/dev/null && printf 2>/dev/null echo readonly "$@"
+cd 'quoted text' x=1 'quoted text'
+		--verbose sed "$@" "$@" done $(pwd) awk -eu local awk 'quoted text' export readonly
+${HOME} awk --verbose awk readonly printf done
+		cd then --verbose local | ${HOME} printf awk readonly /usr/bin
+		test printf "$1" grep -eu sed ${HOME} local local awk echo
+local x=1 printf printf test 2>/dev/null export
+		local /usr/bin --verbose "$@"
+		cd echo readonly && printf grep printf test then ${HOME}
+--verbose $(pwd) | test then export "$1"
+export done readonly && awk 'quoted text'
+	grep cd ${HOME} export --verbose then
+	/usr/bin awk test then | readonly then grep grep local "$1" awk 'quoted text'
+		echo export ${HOME} done done --verbose "$1" ${HOME} then 2>/dev/null sed
+export export done /usr/bin readonly | local 2>/dev/null && then
+		"$@" local $(pwd) 'quoted text' test done export 2>/dev/null
+		"$1" "$1" 'quoted text' 'quoted text' cd readonly awk printf --verbose grep
+$(pwd) test readonly -eu x=1 export readonly
+		-eu test sed local then "$1" readonly
+	"$@" sed awk 'quoted text' sed 2>/dev/null grep awk readonly printf export test
+readonly cd echo awk done awk && -eu awk local /usr/bin readonly
+--verbose ${HOME} --verbose local x=1 readonly /usr/bin echo
+$(pwd) $(pwd) then cd awk export ${HOME} sed && "$1" $(pwd) cd /usr/bin
+	printf 'quoted text' local
+	2>/dev/null export | readonly then | export test local echo local 2>/dev/null echo
+'quoted text' --verbose done grep
+	then && grep | printf -eu echo local export echo echo $(pwd)
+		-eu --verbose awk && readonly $(pwd) 'quoted text' | echo grep
+	awk $(pwd) ${HOME} awk done echo /usr/bin cd && awk done then && $(pwd) awk
+"$1" ${HOME} awk $(pwd) done 2>/dev/null --verbose
+	printf test export x=1 then grep sed --verbose cd ${HOME} "$@" cd x=1
+export --verbose awk done /usr/bin export awk "$@"
+	printf 'quoted text' 2>/dev/null
+--verbose | "$1" readonly then
+	&& printf /usr/bin -eu export grep "$@" -eu -eu 'quoted text' -eu printf "$1"
+	"$@" x=1 printf x=1 export ${HOME} then
+"$1" grep 2>/dev/null | echo sed "$1" echo --verbose /usr/bin /usr/bin export
+		/usr/bin "$1" export ${HOME} echo --verbose 2>/dev/null export -eu awk
+	| printf 'quoted text' $(pwd) ${HOME} printf grep local grep cd export
+		printf ${HOME} "$@" test done
+	-eu grep sed echo ${HOME} sed /usr/bin | $(pwd) --verbose "$1" test ${HOME} 'quoted text'
+local sed "$@" grep "$@" export
+sed | local grep cd done "$@" 2>/dev/null --verbose test $(pwd) done
+| cd readonly && $(pwd) ${HOME}
+	--verbose export --verbose sed done test "$1" x=1 export | printf
+	local "$@" x=1 && && --verbose export done cd 'quoted text' cd cd awk awk
+"$1" -eu /usr/bin then 'quoted text' $(pwd) | readonly then
+${HOME} export 'quoted text' x=1 cd -eu
+&& "$1" x=1 /usr/bin -eu export export printf "$@" /usr/bin
+x=1 export | export grep readonly then awk /usr/bin grep "$@" test $(pwd) awk sed
+		${HOME} cd x=1 export --verbose "$@" $(pwd) && printf "$@" printf sed awk 2>/dev/null
+printf "$@" -eu ${HOME} "$1" x=1 --verbose && "$@" printf --verbose printf
+	${HOME} --verbose 2>/dev/null
+awk ${HOME} && echo local x=1 then awk | cd readonly
+		readonly "$@" echo export awk "$1" /usr/bin cd local $(pwd)
+readonly 2>/dev/null $(pwd) sed
+		cd cd local grep "$1" export
+	-eu x=1 "$1" awk export sed
+	grep grep local 2>/dev/null
+		echo 2>/dev/null -eu | grep x=1 cd x=1 | "$@" /usr/bin /usr/bin 'quoted text' -eu
+	"$@" done local | export | done cd readonly 2>/dev/null awk | then
+	done "$1" 'quoted text' readonly
+	awk 'quoted text' ${HOME} printf "$1" --verbose echo
+		/usr/bin $(pwd) printf "$1" echo -eu printf done then 'quoted text'
+	export | --verbose | echo test | test /usr/bin echo sed
+		| -eu $(pwd) "$@" test echo export "$@" echo $(pwd) ${HOME} &&
+		printf cd -eu export --verbose
+$(pwd) readonly $(pwd) readonly
+	sed --verbose "$@" cd && -eu /usr/bin
+--verbose | ${HOME} export then $(pwd) printf --verbose done 2>/dev/null
+	"$@" printf cd -eu && then -eu 'quoted text' done sed $(pwd) "$1" export
+		2>/dev/null sed cd --verbose local export "$@" cd printf "$1" then awk local
+		'quoted text' --verbose echo /usr/bin && $(pwd)
+	&& test cd then -eu local $(pwd) readonly --verbose "$@"
+"$@" && printf && test awk "$1" export | $(pwd) printf
+	--verbose awk then cd "$1" then cd "$@" && 2>/dev/null
+--verbose | test 2>/dev/null awk /usr/bin cd awk 2>/dev/null
+	readonly grep printf echo
+		$(pwd) "$@" awk | -eu sed "$1" cd then cd "$1" awk /usr/bin local
+sed echo --verbose test test 'quoted text'
+&& /usr/bin local awk cd sed 'quoted text' cd $(pwd) | export test export then
+		-eu awk readonly then test sed /usr/bin
+printf printf "$1" $(pwd) readonly
+/usr/bin x=1 ${HOME} ${HOME} echo "$1"
+$(pwd) printf grep sed sed "$1" awk echo ${HOME} awk
+		${HOME} then /usr/bin | cd cd done test test grep "$1"
+		"$1" 2>/dev/null cd | sed done export -eu -eu echo awk echo
+		grep $(pwd) "$@" "$1" awk "$1" 'quoted text' echo -eu sed local /usr/bin
+	&& sed export 2>/dev/null && | --verbose cd awk /usr/bin
+	-eu | /usr/bin export 2>/dev/null
+		grep local 'quoted text' /usr/bin
+		/usr/bin printf "$@" $(pwd) "$1" sed readonly --verbose test local -eu export
+		| /usr/bin 'quoted text'
+	awk then then printf grep local
+	export -eu printf $(pwd) "$1" awk 'quoted text' "$@" export "$1"
+-eu grep $(pwd) -eu x=1 $(pwd) readonly sed --verbose echo then /usr/bin x=1
+	--verbose test readonly | /usr/bin 'quoted text'
+		x=1 x=1 "$1" -eu $(pwd) --verbose printf /usr/bin
+-eu -eu cd readonly echo cd --verbose -eu $(pwd)
+		done "$@" then cd /usr/bin done
+		| "$1" echo ${HOME} ${HOME} 'quoted text'
+awk -eu cd x=1 -eu --verbose
+	-eu $(pwd) printf --verbose --verbose --verbose $(pwd) $(pwd) && --verbose
+${HOME} cd "$1" 2>/dev/null ${HOME} printf export "$1" done export
+		printf "$1" | && printf local && 'quoted text' done x=1 readonly 2>/dev/null
+export "$@" printf sed then echo then "$1" echo
+	readonly --verbose done 'quoted text'
+| --verbose local 'quoted text' "$1" --verbose ${HOME} readonly
+"$@" ${HOME} readonly awk readonly
+		2>/dev/null export then echo 2>/dev/null then x=1 echo "$@" export grep
+sed export -eu done done -eu x=1 2>/dev/null
+	2>/dev/null && done done then printf then
+printf | 2>/dev/null test 2>/dev/null && sed readonly
+		cd && done | 'quoted text' -eu export cd readonly
+	printf -eu $(pwd) grep ${HOME} $(pwd) grep
+	--verbose done 2>/dev/null echo ${HOME} --verbose readonly "$@" x=1
+	echo then done -eu awk printf "$@" export "$1" "$@" -eu /usr/bin /usr/bin
+		/usr/bin | "$1" "$@" printf sed done local cd then awk grep 'quoted text'
+	${HOME} 2>/dev/null -eu sed -eu
+/usr/bin x=1 $(pwd) then sed $(pwd) $(pwd)
+	echo printf sed local done | printf sed then && "$@" grep -eu | $(pwd)
+		grep "$1" readonly sed | local && x=1 then -eu 2>/dev/null
+	| export readonly $(pwd) "$1" export local "$@" 'quoted text' cd then
+x=1 | echo export 2>/dev/null local grep $(pwd)
+x=1 export readonly -eu "$1" readonly /usr/bin "$1" then grep 'quoted text'
+&& local | | -eu grep && sed printf x=1 --verbose local "$1" export awk ${HOME}
+done export grep 'quoted text' | grep echo sed 'quoted text' | test sed
+		echo -eu -eu -eu done printf test --verbose test
+		cd grep && awk export test then $(pwd) awk && sed then
+"$@" test then && readonly --verbose grep local -eu "$1" awk readonly printf
+		sed local 2>/dev/null --verbose
+	/usr/bin sed 'quoted text' export
+"$1" "$@" cd 'quoted text' -eu readonly 'quoted text' then test
+"$@" ${HOME} ${HOME} "$@" local 2>/dev/null printf --verbose sed --verbose 2>/dev/null
+		| printf readonly export awk
+	/usr/bin "$1" "$@" awk sed && "$@" 2>/dev/null
+		$(pwd) "$@" awk ${HOME} /usr/bin x=1 cd -eu
+		sed export ${HOME} printf local | -eu x=1 cd 'quoted text' printf /usr/bin grep
+		echo cd && 'quoted text' export
+	then ${HOME} -eu | ${HOME} 'quoted text' && test done echo /usr/bin "$1" cd readonly
+		awk "$@" test && export --verbose done local test
+then "$1" sed echo readonly then -eu "$@" $(pwd) $(pwd) readonly
+	"$@" 2>/dev/null export cd "$@"
+	then x=1 then --verbose "$1" readonly /usr/bin
+		-eu --verbose then done && 2>/dev/null x=1 x=1 then "$1" export
+		local $(pwd) local | 'quoted text' 2>/dev/null 'quoted text' echo cd $(pwd)
+| x=1 readonly 2>/dev/null "$1" readonly printf "$@" test echo 2>/dev/null | &&
+"$@" 'quoted text' readonly 2>/dev/null 2>/dev/null -eu echo
+${HOME} done -eu awk grep 2>/dev/null -eu && cd sed && awk
+	${HOME} x=1 $(pwd) then 2>/dev/null export sed $(pwd) --verbose /usr/bin
+		$(pwd) --verbose printf | echo 'quoted text' --verbose export
+| ${HOME} x=1 "$1" $(pwd) 2>/dev/null x=1 sed /usr/bin awk
+	/usr/bin printf echo echo 'quoted text'
+	readonly readonly "$1" cd | 2>/dev/null export /usr/bin grep | x=1 export $(pwd)
+then awk readonly sed echo readonly then sed awk export
+	$(pwd) echo ${HOME} test ${HOME} && awk done "$1" awk export grep done readonly
+/usr/bin echo $(pwd) 2>/dev/null
+	awk grep cd x=1 ${HOME} --verbose then sed "$@" test | grep $(pwd)
+export x=1 'quoted text' test export echo -eu 'quoted text' --verbose 'quoted text'
+export printf x=1 printf | cd export $(pwd) awk "$1" cd 2>/dev/null "$1" /usr/bin
+	test done --verbose sed done
+/usr/bin 'quoted text' done /usr/bin
+then && ${HOME} sed cd 2>/dev/null grep -eu
+	done printf printf echo $(pwd) sed 'quoted text' sed then $(pwd) cd test
+-eu test ${HOME} grep -eu cd /usr/bin 2>/dev/null $(pwd) then readonly && 'quoted text'
+	echo -eu /usr/bin readonly grep /usr/bin ${HOME}
+		export ${HOME} "$@" ${HOME} /usr/bin local awk "$1"
+/usr/bin "$1" sed done
+test awk 'quoted text' && 'quoted text' then test awk "$@" $(pwd) x=1
+echo | grep echo readonly test 2>/dev/null $(pwd) then x=1 sed
+		${HOME} | x=1 readonly grep "$1" export done sed then readonly export x=1 done
+sed local cd "$@" sed "$@" export
+	-eu done 'quoted text' done /usr/bin /usr/bin 2>/dev/null 2>/dev/null -eu
+2>/dev/null -eu ${HOME} "$1" | /usr/bin /usr/bin "$1" then -eu ${HOME}
+printf echo x=1 echo sed export -eu -eu $(pwd) 'quoted text'
+		cd test --verbose readonly awk local done | --verbose sed
+local test && export /usr/bin
+		readonly -eu ${HOME} | readonly --verbose local ${HOME}
+		${HOME} grep test awk && then test "$1" export /usr/bin
+-eu done -eu --verbose 'quoted text' && && "$1" 'quoted text'
+	then ${HOME} local cd local $(pwd) && $(pwd) grep done grep test
+		awk 2>/dev/null | &&
+&& 2>/dev/null 2>/dev/null done done "$1" test
+	&& export readonly x=1 &&
+		2>/dev/null readonly x=1 local 'quoted text' grep
+		sed then /usr/bin done echo sed $(pwd) cd
+sed $(pwd) readonly "$1" --verbose "$1" $(pwd) echo
+		${HOME} && cd readonly readonly sed then ${HOME} -eu
+		test export done 2>/dev/null grep /usr/bin "$1" && && then 'quoted text' done x=1
+	test local /usr/bin --verbose 'quoted text' echo /usr/bin grep echo /usr/bin
+		&& && readonly awk | && cd $(pwd) "$1"
+	readonly export 2>/dev/null then --verbose 'quoted text' then export "$@" printf
+awk ${HOME} x=1 done test 2>/dev/null
+		awk /usr/bin "$1" export local grep readonly
+		2>/dev/null 'quoted text' && then then sed -eu | $(pwd) awk
+		local "$@" local cd $(pwd) awk --verbose
+| x=1 'quoted text' $(pwd) test printf
+	2>/dev/null x=1 grep $(pwd) && "$@" local done
+test 'quoted text' --verbose | local -eu printf awk 2>/dev/null export |
+	"$1" -eu x=1 "$1" sed --verbose then ${HOME} sed | readonly
+		x=1 "$1" sed "$@" x=1 ${HOME} --verbose awk
+		then cd -eu "$1" --verbose then test cd then $(pwd) "$1" local ${HOME} 2>/dev/null
+'quoted text' grep cd cd ${HOME} done && local
+"$1" "$@" grep grep then echo && -eu then $(pwd) awk | x=1 then
+		$(pwd) sed echo x=1 grep test | local readonly local $(pwd) "$1"
+--verbose 2>/dev/null done echo 'quoted text'
+	${HOME} done x=1 x=1 printf x=1 "$1" 2>/dev/null /usr/bin readonly x=1 && cd
+	2>/dev/null 'quoted text' sed 'quoted text' local cd grep readonly local
+	test sed echo echo local local sed
+	readonly local | then readonly "$1" | test
+	local 'quoted text' sed 2>/dev/null readonly done readonly local 'quoted text' test
+grep && "$@" /usr/bin sed
+		"$1" printf /usr/bin awk x=1 then "$@" then /usr/bin grep awk awk --verbose
+	export readonly printf sed cd | readonly cd readonly "$1" sed then printf
+	local $(pwd) $(pwd) /usr/bin export test 'quoted text'
+	awk "$@" grep x=1 $(pwd) "$@" then x=1 awk "$@" | grep awk
+		-eu sed -eu printf /usr/bin echo readonly
+	echo grep sed $(pwd) /usr/bin
+		"$1" 2>/dev/null echo readonly x=1 x=1 2>/dev/null awk sed local
+		grep | --verbose printf ${HOME} test 'quoted text'
+local test echo awk 2>/dev/null ${HOME} -eu $(pwd) then |
+		'quoted text' "$1" export
+	local printf "$@" printf | /usr/bin | cd --verbose | test sed 2>/dev/null
+		&& "$@" -eu cd grep done cd test $(pwd) awk 2>/dev/null 2>/dev/null readonly
+	/usr/bin | $(pwd) "$@" then test "$1" "$1"
+local -eu test 2>/dev/null done sed
+	sed && grep | && ${HOME} grep test readonly sed echo sed /usr/bin &&
+	test export local x=1 | "$@" "$@"
+	readonly "$1" "$@" "$1" --verbose | local done "$1" && then --verbose
+awk 2>/dev/null awk x=1
+grep printf awk echo | test
+	awk -eu x=1 then test echo sed 2>/dev/null printf test | readonly test sed test
+		--verbose export grep then awk test | /usr/bin && grep grep "$1"
+	"$@" local export --verbose printf done --verbose readonly "$1" "$1" test readonly
+		-eu | readonly echo test grep -eu grep | sed
+"$@" export x=1 /usr/bin && "$@" local printf printf test
+		${HOME} --verbose then ${HOME} "$1" 2>/dev/null 'quoted text'
+	grep grep --verbose $(pwd) awk readonly sed x=1 && printf
+		"$@" export awk ${HOME} 'quoted text' 'quoted text' | "$1" 'quoted text'
+		readonly $(pwd) ${HOME} $(pwd)
+--verbose export -eu echo 2>/dev/null --verbose
+	2>/dev/null -eu then readonly 'quoted text' local 2>/dev/null
+printf -eu echo awk /usr/bin
+		-eu && /usr/bin readonly ${HOME} -eu x=1 && local $(pwd)
+x=1 awk | echo && 2>/dev/null
+| done $(pwd) x=1 done printf $(pwd) 2>/dev/null then 'quoted text'
+	grep grep done grep awk sed done "$@" awk
+		$(pwd) ${HOME} awk -eu cd "$@" local sed test /usr/bin -eu | local grep
+/usr/bin ${HOME} sed 'quoted text' -eu | local printf
+	"$@" /usr/bin && grep "$1" printf && --verbose
+		then 'quoted text' echo /usr/bin x=1 -eu && 2>/dev/null ${HOME} "$@"
+		local ${HOME} local printf | "$@" ${HOME} export done | export readonly ${HOME}
+		readonly grep | done echo ${HOME} --verbose ${HOME} "$1" --verbose printf 2>/dev/null
+	done done then grep /usr/bin "$1" grep cd local
+	local cd done export local grep && cd then cd && export && && export
+printf then grep /usr/bin --verbose 2>/dev/null ${HOME} --verbose readonly -eu
+then -eu readonly echo awk | grep
+		${HOME} 2>/dev/null sed -eu readonly $(pwd)
+		done x=1 'quoted text' /usr/bin
+		then --verbose $(pwd) -eu x=1 grep
+		x=1 "$@" --verbose -eu local sed --verbose
+	${HOME} && --verbose 'quoted text'
+	printf 'quoted text' export local export 'quoted text' --verbose done /usr/bin
+		test 'quoted text' awk cd echo | x=1 x=1 -eu | "$1" local
+-eu "$@" 'quoted text' -eu /usr/bin cd test awk awk "$@" 2>/dev/null done cd
+	/usr/bin ${HOME} local echo -eu "$@" local export $(pwd) sed &&
+		export done $(pwd) export $(pwd) sed export | ${HOME}
+		sed "$1" x=1 | x=1 export 'quoted text' && then 'quoted text'
+	2>/dev/null --verbose readonly $(pwd) export && done export && cd
+| readonly test cd | readonly grep && -eu --verbose
+		&& 'quoted text' awk | grep grep awk then
+		2>/dev/null cd "$1" --verbose --verbose sed sed export
+printf readonly /usr/bin 2>/dev/null cd export x=1 test local grep cd ${HOME}
+	sed "$1" 'quoted text' "$1"
+done --verbose "$1" && "$@" export /usr/bin --verbose
+		| && done grep -eu "$@" /usr/bin "$1"
+	'quoted text' export grep
+	${HOME} done sed /usr/bin | "$@" 2>/dev/null
+awk --verbose 2>/dev/null test ${HOME} done
+test $(pwd) printf export ${HOME} printf | | && then /usr/bin
+	cd cd ${HOME} x=1 /usr/bin ${HOME} ${HOME} | awk cd cd | | 2>/dev/null
+		grep done grep "$1" cd ${HOME} --verbose
+"$@" && | $(pwd) x=1 2>/dev/null $(pwd) /usr/bin printf then x=1 export
+		echo export 2>/dev/null --verbose "$@" readonly
+export readonly 'quoted text'
+	printf done test x=1 export grep
+	-eu then sed $(pwd) "$1" "$@" "$1" printf
+		cd awk 'quoted text' test $(pwd) grep
+		-eu export export then x=1 -eu local x=1 /usr/bin
+--verbose "$1" && then echo 'quoted text' ${HOME} $(pwd)
+	x=1 "$@" ${HOME} 'quoted text' export -eu x=1 $(pwd) done $(pwd)
+		'quoted text' export echo "$@" then grep printf 'quoted text'
+		cd grep "$@" --verbose printf --verbose --verbose echo cd printf
+printf export readonly cd | x=1 grep
+	done /usr/bin sed -eu readonly "$1" /usr/bin awk | then "$1" readonly
+	$(pwd) x=1 done test x=1 grep "$@" local 2>/dev/null $(pwd) -eu
+&& readonly && then awk x=1 readonly readonly grep
+		$(pwd) readonly -eu | echo cd cd done cd
+		export 'quoted text' --verbose awk x=1
+&& awk printf cd then && $(pwd)
+grep x=1 readonly -eu x=1 printf /usr/bin
+	x=1 x=1 readonly readonly test cd /usr/bin | "$1" grep done local
+	done readonly test x=1 && x=1 awk && && && 2>/dev/null
+printf then then test 2>/dev/null
+	cd echo ${HOME} export sed /usr/bin --verbose 2>/dev/null 'quoted text'
+		printf test 2>/dev/null 'quoted text' sed local done printf awk
+		test cd x=1 sed && 'quoted text' then then sed cd
+sed 'quoted text' readonly then && then cd && done | done grep
+	--verbose "$1" x=1 | && $(pwd) | local "$@" /usr/bin
+&& /usr/bin | test | ${HOME} done "$1" 2>/dev/null x=1 'quoted text'
+2>/dev/null test --verbose cd $(pwd) x=1 local awk "$@"
+	-eu grep local "$@" -eu done readonly sed &&
+		--verbose "$@" 'quoted text' test echo done sed x=1 "$1" $(pwd)
+		test | --verbose ${HOME} /usr/bin grep test echo -eu "$1"
+	printf "$@" | then --verbose 'quoted text'
+	"$@" export local export readonly /usr/bin x=1 'quoted text' export && awk --verbose
+cd /usr/bin -eu && --verbose
+		awk $(pwd) then sed export local "$1" "$@" awk x=1 2>/dev/null -eu
+	printf test echo export awk
+	test "$1" awk /usr/bin readonly 'quoted text' /usr/bin
+printf 'quoted text' x=1 --verbose
+"$1" -eu echo && awk x=1 | echo "$1"
+	&& echo /usr/bin cd x=1 printf "$@" /usr/bin | | | --verbose done
+		export "$@" done cd test readonly
+"$@" 2>/dev/null && 2>/dev/null test then
+test | sed && echo printf printf echo -eu -eu local then 2>/dev/null $(pwd)
+done "$1" export && ${HOME} /usr/bin /usr/bin printf awk
+export ${HOME} 2>/dev/null x=1 sed x=1 done awk done
+	sed | $(pwd) cd "$1" ${HOME} /usr/bin --verbose printf local "$1" export echo 2>/dev/null
+	printf sed /usr/bin export 2>/dev/null x=1
+		&& grep -eu x=1 readonly grep
+		--verbose local echo "$@" | /usr/bin printf
+	"$@" done -eu && then "$1"
+		then 'quoted text' /usr/bin export done 2>/dev/null cd "$@" "$1" sed
+	readonly "$1" 'quoted text' echo 'quoted text' ${HOME}
+		--verbose echo sed $(pwd)
+	cd cd 2>/dev/null 2>/dev/null readonly x=1 local 'quoted text'
+	cd done "$1" grep test awk awk x=1
+		'quoted text' && readonly echo 2>/dev/null x=1 --verbose x=1 readonly $(pwd)
+export ${HOME} cd ${HOME} x=1 sed then printf export x=1 done x=1 "$@"
+	&& grep $(pwd) /usr/bin export done "$1"
+$(pwd) -eu then ${HOME} awk
+		test && then "$@" echo then cd --verbose "$1" readonly $(pwd) /usr/bin
+printf readonly readonly cd export && -eu
+"$1" && && cd export | printf | "$1" cd grep --verbose test
+	sed done -eu ${HOME} "$@" then done 2>/dev/null awk grep
+		--verbose then grep x=1 grep x=1 echo test readonly test
+x=1 then --verbose printf sed cd x=1 done 'quoted text' 2>/dev/null
+		local | && done echo then 'quoted text' test $(pwd) awk cd readonly
+		readonly | echo ${HOME} x=1 sed printf grep then && | grep
+		2>/dev/null --verbose readonly && 'quoted text' ${HOME} /usr/bin
+	${HOME} readonly cd ${HOME}
+		${HOME} -eu cd done ${HOME} cd $(pwd) 2>/dev/null
+	| $(pwd) test "$@" /usr/bin
+		sed ${HOME} done && cd sed sed echo printf "$@" done
+/usr/bin grep "$1" grep ${HOME} -eu export awk && echo --verbose "$@" awk sed
+		then echo && sed export then readonly done export done "$@" test awk done ${HOME}
+		test echo cd && $(pwd) /usr/bin "$1" sed
+sed | ${HOME} /usr/bin echo /usr/bin sed --verbose
+		/usr/bin "$1" grep test export -eu
+		then sed x=1 export 'quoted text' 2>/dev/null echo cd --verbose
+		awk 'quoted text' printf && sed then then -eu local export
+		export export sed && 2>/dev/null "$@" | done printf -eu && "$@" -eu readonly export
+test x=1 grep then sed ${HOME} 'quoted text'
+	"$@" then "$1" readonly | ${HOME}
+	'quoted text' export 2>/dev/null 2>/dev/null
+| then "$@" $(pwd) -eu local -eu grep
+	sed && cd 'quoted text' | then done && --verbose && 2>/dev/null
+&& readonly awk done -eu grep echo echo awk --verbose 'quoted text'
+	cd printf printf /usr/bin then
+	$(pwd) local awk x=1 sed $(pwd) grep awk --verbose echo grep -eu -eu --verbose
+then echo export printf | "$1" 'quoted text'
+		"$@" && x=1 printf "$1" export /usr/bin done ${HOME} /usr/bin
+		sed local echo -eu -eu
+	--verbose $(pwd) export --verbose "$1" && echo export sed
+	-eu --verbose | test 'quoted text' awk echo
+	export then | 'quoted text' local "$@" export -eu export "$@" echo x=1
+		echo awk ${HOME} /usr/bin && "$@" |
+	'quoted text' && "$@" cd cd done /usr/bin then 'quoted text'
+		"$1" "$@" grep test test $(pwd) /usr/bin | then echo ${HOME}
+		"$1" "$1" && printf "$@" cd readonly | /usr/bin | local readonly
+	echo --verbose "$1" readonly
+		x=1 "$@" readonly $(pwd) x=1 test printf local local
+		/usr/bin /usr/bin then x=1 echo export "$@" export
+	"$@" export printf /usr/bin -eu export then "$1" export && ${HOME} "$@"
+/usr/bin x=1 $(pwd) test sed -eu ${HOME}
+		--verbose "$@" done awk ${HOME} cd --verbose 2>/dev/null --verbose /usr/bin readonly
+| sed grep --verbose readonly | printf local 2>/dev/null -eu -eu ${HOME} $(pwd)
+		grep printf --verbose echo readonly -eu 'quoted text'
+	test | awk -eu done grep | x=1 "$@" printf then sed grep 2>/dev/null
+	--verbose local "$1" $(pwd) sed readonly x=1 echo &&
+-eu sed local -eu -eu x=1 done awk ${HOME} /usr/bin 2>/dev/null export echo &&
+awk /usr/bin sed 'quoted text'
+	${HOME} then --verbose printf |
+	sed && then done printf then ${HOME} echo
+	$(pwd) cd 'quoted text' export x=1 printf then
+	| "$@" printf 2>/dev/null
+		x=1 x=1 /usr/bin ${HOME} 'quoted text'
+	done -eu 'quoted text' test
+awk echo done $(pwd) | ${HOME} echo export then printf x=1
+-eu export | awk readonly
+	| 2>/dev/null x=1 local printf "$@" && "$@" local
+"$@" "$@" sed sed export grep --verbose local "$@"
+	export printf && && && "$1" test readonly awk test done sed
+		cd test $(pwd) test cd printf x=1 readonly
+		cd then sed echo --verbose /usr/bin printf sed
+		sed cd cd "$@" cd 'quoted text' --verbose export test
+&& -eu readonly 2>/dev/null $(pwd) then test awk
+printf /usr/bin cd grep local done export printf test --verbose
+x=1 -eu echo then && "$1" -eu "$@" ${HOME} | && 'quoted text' $(pwd) -eu
+--verbose done $(pwd) export
+		export printf then --verbose "$@" awk /usr/bin && $(pwd)
+		then | then && export grep test "$@"
+done sed ${HOME} done echo printf local x=1 sed then $(pwd) "$1" 2>/dev/null
+	"$1" sed awk "$1" | 'quoted text' && grep printf then x=1 "$1"
+grep -eu 2>/dev/null export sed | then 'quoted text'
+-eu /usr/bin echo printf "$@" printf
+local printf | --verbose x=1 echo then sed --verbose "$1" -eu
+		then done "$1" | awk cd && --verbose done sed && /usr/bin export test echo 'quoted text'
+		readonly then x=1 export sed cd awk
+/usr/bin && export printf local
+test ${HOME} 'quoted text'
+	&& export && printf export
+		test ${HOME} x=1 "$1" 2>/dev/null printf then
+sed "$1" 'quoted text' "$1" $(pwd) -eu ${HOME} /usr/bin
+		"$1" 2>/dev/null -eu /usr/bin cd && test "$1"
+	export $(pwd) 2>/dev/null export sed local cd /usr/bin 'quoted text' 'quoted text'
+	echo $(pwd) sed 2>/dev/null |
+"$@" "$1" "$1" 'quoted text' local printf done printf sed --verbose /usr/bin
+		2>/dev/null test cd $(pwd) echo export test echo /usr/bin
+$(pwd) -eu then x=1 "$@" echo
+cd awk "$1" "$1" /usr/bin 2>/dev/null done test
+printf awk "$@" grep readonly | test echo export
+	/usr/bin 'quoted text' export --verbose
+2>/dev/null "$@" -eu "$1" x=1 test local -eu /usr/bin
+		then done echo 'quoted text' 2>/dev/null grep sed local | awk 'quoted text'
+| && grep awk test "$1"
+		printf printf --verbose
+local done | done export "$1" printf echo ${HOME}
+--verbose done --verbose "$@" $(pwd) sed 2>/dev/null readonly grep done readonly
+test done then 2>/dev/null 2>/dev/null awk readonly -eu -eu
+	/usr/bin "$1" -eu && ${HOME} | echo | "$1"
+2>/dev/null done printf 'quoted text'
+local 2>/dev/null cd sed
+	sed --verbose x=1 awk 'quoted text' | readonly cd echo $(pwd)
+	"$@" done "$@" export "$1" awk then then
+2>/dev/null cd export --verbose $(pwd) awk 'quoted text'
+done export 'quoted text' local 'quoted text'
+		echo x=1 2>/dev/null done then cd then cd echo -eu export awk sed
+2>/dev/null done printf --verbose x=1 then 2>/dev/null /usr/bin $(pwd) sed local
+2>/dev/null then readonly printf 'quoted text' sed readonly export "$@" sed
+printf 'quoted text' ${HOME} export readonly echo grep cd $(pwd) 2>/dev/null
+		printf grep grep | -eu sed && -eu cd
+	readonly echo readonly grep 2>/dev/null done /usr/bin 'quoted text'
+	2>/dev/null cd ${HOME} 2>/dev/null "$@" printf then -eu
+	${HOME} --verbose --verbose export printf
+/usr/bin --verbose x=1 ${HOME} echo grep readonly
+	&& test done echo && cd sed
+		local $(pwd) -eu echo readonly
+x=1 awk sed && printf export --verbose "$1"
+	echo export "$@" local echo 2>/dev/null
+		export --verbose printf awk echo | cd --verbose echo
+	local then --verbose | export /usr/bin
+	sed test readonly $(pwd) && "$@" readonly | | 'quoted text'
+	then cd readonly readonly test sed then /usr/bin /usr/bin test export readonly
+		local echo sed echo --verbose /usr/bin test 2>/dev/null then local cd printf
+	"$@" x=1 x=1 cd $(pwd) x=1 test printf
+done local x=1 test done local grep local export x=1 printf
+		x=1 | $(pwd) && awk 2>/dev/null local readonly
+	| done "$@" echo "$@" readonly $(pwd) -eu /usr/bin
+		-eu $(pwd) grep grep echo
+		grep "$1" printf $(pwd) grep x=1
+	"$1" /usr/bin $(pwd) readonly echo export | x=1 && done cd /usr/bin 2>/dev/null
+printf awk 'quoted text'
+		"$1" 'quoted text' "$@" readonly local grep printf export local cd printf
+		export grep | cd -eu --verbose -eu grep echo | grep then "$@"
+awk $(pwd) export echo ${HOME} local awk | test 'quoted text' readonly test
+		test ${HOME} grep test sed done ${HOME} done local test | "$@" then export
+		&& echo export then ${HOME} x=1 done then 'quoted text' done local /usr/bin
+		export ${HOME} test --verbose "$@" x=1 sed
+		| 'quoted text' | then -eu
+	awk && "$1" export 'quoted text'
+		"$@" $(pwd) --verbose x=1 done readonly readonly ${HOME} $(pwd) export /usr/bin
+		/usr/bin x=1 -eu export --verbose 'quoted text' readonly "$1"
+	then $(pwd) ${HOME} cd --verbose | 'quoted text' then 2>/dev/null
+		cd && 2>/dev/null "$@" echo awk echo sed 2>/dev/null | cd export /usr/bin
+		local sed export 'quoted text' x=1 --verbose export grep grep "$@" sed --verbose
+		done 'quoted text' printf 2>/dev/null then export cd awk test "$1" | | test $(pwd)
+	sed $(pwd) x=1 $(pwd) local sed && sed "$1" test grep export
+grep 'quoted text' export then 2>/dev/null -eu local then done sed
+	grep "$@" && done x=1 done | grep test done echo awk
+	${HOME} "$1" --verbose 'quoted text' ${HOME}
+	&& export export readonly -eu /usr/bin
+	/usr/bin --verbose x=1 $(pwd) 2>/dev/null "$1" done 2>/dev/null x=1 'quoted text'
+		done then cd "$@" && /usr/bin -eu -eu export
+		test ${HOME} -eu 'quoted text' printf sed /usr/bin "$@" && | done -eu /usr/bin
+		awk readonly $(pwd) "$1" -eu && "$@" --verbose x=1 | x=1 grep
+	x=1 --verbose "$@" then | readonly cd | -eu then echo export export
+readonly done readonly
+	$(pwd) grep "$@" -eu -eu $(pwd) test --verbose awk 'quoted text'
+'quoted text' "$@" "$1" 'quoted text' ${HOME} local then x=1 awk "$@"
+| awk export cd $(pwd) sed -eu done /usr/bin
+		sed x=1 cd sed /usr/bin && /usr/bin export "$@" cd | | awk sed echo -eu test sed
+&& --verbose then ${HOME} awk $(pwd) grep x=1 done export | /usr/bin --verbose
+		echo | printf done "$@" /usr/bin --verbose test echo 'quoted text'
+	$(pwd) && local $(pwd) cd test export
+x=1 -eu local -eu 2>/dev/null local printf x=1 2>/dev/null "$1"
+2>/dev/null test readonly
+local done /usr/bin then --verbose grep
+		export grep | && echo "$@" done -eu "$1" readonly | printf x=1 test && echo
+		test readonly && echo "$@" test readonly x=1 then |
+$(pwd) echo && -eu grep cd then /usr/bin then x=1 "$@" |
+test ${HOME} readonly cd awk 'quoted text' 2>/dev/null awk && then "$1"
+	sed /usr/bin cd --verbose $(pwd) 'quoted text'
+readonly ${HOME} echo --verbose
+	-eu export readonly ${HOME} x=1 'quoted text' 'quoted text' awk printf done
+'quoted text' && 'quoted text' done done -eu readonly
+	echo | readonly test --verbose then sed grep test
+"$@" && && -eu "$1" $(pwd)
+"$1" && "$1" echo test && 'quoted text' "$1" printf then -eu awk test
+printf done 2>/dev/null
+'quoted text' && printf cd cd --verbose --verbose awk cd /usr/bin
+		2>/dev/null local printf /usr/bin printf "$1" awk 'quoted text'
+		'quoted text' echo local awk sed echo "$@"
+'quoted text' sed 2>/dev/null export printf && /usr/bin x=1 && cd done /usr/bin
+then x=1 printf 2>/dev/null done cd && sed
+	done --verbose echo --verbose export
+	${HOME} $(pwd) sed "$1" 2>/dev/null
+	grep local $(pwd) echo grep cd grep sed awk echo x=1 grep "$@" "$@" -eu done
+		export export cd | local $(pwd) awk local x=1
+		| $(pwd) cd | 2>/dev/null $(pwd) x=1 cd | "$@" $(pwd) "$@" then -eu /usr/bin
+		local echo | test | local grep grep "$1" ${HOME} && 'quoted text' -eu
+		"$@" cd ${HOME} --verbose && 'quoted text' sed done -eu "$1" "$1" printf cd
+	then echo export cd done sed --verbose /usr/bin /usr/bin printf awk
+	"$@" $(pwd) awk "$1" local echo export 2>/dev/null && local "$@" grep -eu && 'quoted text'
+printf -eu sed test readonly export export sed awk awk "$@" "$@" | $(pwd) && 'quoted text'
+/usr/bin then readonly cd grep cd grep test 2>/dev/null local
+		test echo "$1" test "$@" grep --verbose ${HOME} export
+$(pwd) export 2>/dev/null printf test $(pwd) sed export 'quoted text' sed 'quoted text'
+${HOME} | | local "$1" -eu grep cd | ${HOME} echo grep 2>/dev/null -eu awk ${HOME}
+	cd --verbose 'quoted text' "$@" 2>/dev/null awk "$1"
+| "$1" grep x=1 -eu test -eu 'quoted text' "$@" local export 'quoted text' ${HOME}
+	&& | ${HOME} readonly awk x=1
+		cd "$@" -eu 2>/dev/null then then
+		test test test "$1" "$1" cd 'quoted text' done sed then local export
+	readonly local test local x=1 "$1" done $(pwd) $(pwd) "$1" awk --verbose
+&& printf 2>/dev/null x=1 | readonly && awk printf
+"$@" $(pwd) $(pwd) $(pwd) "$1" "$1"
+	then /usr/bin $(pwd) grep printf sed "$@" 2>/dev/null export 'quoted text'
+		cd then /usr/bin grep x=1 test | $(pwd) "$@" done cd
+		--verbose grep test x=1 -eu then
+	sed $(pwd) printf ${HOME} done 2>/dev/null printf "$1" ${HOME} sed printf
+	grep done printf cd echo ${HOME} local /usr/bin sed
+		sed grep -eu then printf readonly
+	test test /usr/bin 2>/dev/null x=1 readonly printf test 'quoted text'
+	"$1" echo ${HOME} printf | -eu -eu
+		2>/dev/null test /usr/bin readonly local
+test && $(pwd) && 'quoted text' --verbose
+awk awk awk readonly --verbose echo -eu printf local
+		printf "$@" cd awk cd done then 2>/dev/null echo echo "$1" && x=1
+	printf "$1" then | && local 'quoted text' local then $(pwd) && "$1" "$@" done
+		echo sed printf sed export 2>/dev/null x=1 awk ${HOME} then "$1" grep
+		'quoted text' "$@" 'quoted text' ${HOME} test -eu
+	printf "$1" 'quoted text' printf
+	readonly export printf readonly cd test readonly echo --verbose
+	test --verbose && local grep "$1" sed $(pwd) printf done printf x=1 |
+		2>/dev/null 2>/dev/null --verbose cd cd then printf then "$@" grep
+	'quoted text' 2>/dev/null -eu then $(pwd) "$1" test ${HOME}
+		--verbose echo ${HOME} -eu
+	x=1 -eu export then && test /usr/bin sed 'quoted text' | $(pwd) 2>/dev/null
+	cd && cd 'quoted text' test test sed readonly
+	'quoted text' echo grep export printf | echo ${HOME} -eu -eu | sed 2>/dev/null
+		"$@" echo readonly awk -eu | x=1 x=1 then "$@" then done | | awk -eu
+printf readonly echo 2>/dev/null ${HOME} "$1" --verbose 'quoted text' $(pwd)
+${HOME} 'quoted text' | 'quoted text' awk
+2>/dev/null 2>/dev/null 'quoted text'
+		2>/dev/null "$@" --verbose | x=1 sed awk sed echo export "$1" readonly grep 'quoted text'
+		"$1" x=1 local done echo ${HOME} readonly "$1" printf && export | "$@" test
+	"$1" $(pwd) test "$1" 'quoted text' grep "$1" sed $(pwd) "$1" "$@"
+		local export 'quoted text'
+awk && readonly /usr/bin $(pwd) awk
+/usr/bin --verbose "$1" 2>/dev/null 2>/dev/null
+local done cd local 'quoted text'
+grep 'quoted text' -eu --verbose echo local ${HOME}
+		${HOME} printf | readonly /usr/bin | cd cd -eu echo test then 2>/dev/null -eu readonly
+	readonly echo "$@" /usr/bin then then "$1" echo awk -eu local grep local
+/usr/bin x=1 readonly $(pwd)
+	x=1 ${HOME} ${HOME} readonly --verbose echo grep then --verbose
+	x=1 export && | then export done 'quoted text' awk -eu echo readonly
+	&& $(pwd) --verbose && test /usr/bin
+cd --verbose printf export $(pwd) cd $(pwd)
+	grep "$@" then sed done grep sed --verbose done awk test readonly
+		sed /usr/bin grep ${HOME}
+		echo $(pwd) sed done 'quoted text' $(pwd) && export printf
+test /usr/bin x=1 "$1" readonly 'quoted text' then /usr/bin
+/usr/bin --verbose $(pwd) export readonly /usr/bin
+	/usr/bin export && cd local "$1" readonly cd "$@" local
+		printf cd -eu 2>/dev/null "$1"
+	--verbose && "$1" x=1 ${HOME} test readonly readonly then 'quoted text' 'quoted text'
+/usr/bin readonly readonly grep "$1" export | -eu done &&
+	${HOME} awk then then cd awk x=1
+		'quoted text' | -eu then printf ${HOME} then sed printf export sed ${HOME} ${HOME}
+		${HOME} "$1" "$@" grep echo test x=1 $(pwd)
+		awk done "$1" -eu && "$@"
+	x=1 'quoted text' "$@" && local then
+	local export 2>/dev/null export echo 2>/dev/null 'quoted text' grep test "$@" $(pwd)
+	&& readonly 'quoted text' printf export test 2>/dev/null 'quoted text'
+"$@" | export $(pwd) ${HOME} --verbose done 'quoted text' /usr/bin "$@"
+	export done /usr/bin -eu -eu cd 2>/dev/null sed sed /usr/bin 'quoted text'
+export -eu $(pwd) "$@" /usr/bin
+		| grep then done "$1" grep then local | ${HOME} | 'quoted text' awk printf
+		$(pwd) then sed export -eu test --verbose test x=1 sed
+'quoted text' /usr/bin &&
+"$1" $(pwd) printf "$1" test "$1"
+		printf cd test -eu 'quoted text' grep $(pwd) /usr/bin ${HOME} 'quoted text' -eu
+	grep --verbose -eu awk local then echo cd "$1"
+then awk --verbose grep done sed then $(pwd) awk sed 2>/dev/null
+		"$@" local awk local 2>/dev/null then
+/usr/bin --verbose x=1
+$(pwd) readonly 2>/dev/null 'quoted text' "$1"
+&& /usr/bin $(pwd) grep 2>/dev/null sed then sed printf && $(pwd)
+	awk /usr/bin "$1" awk
+	sed "$1" export $(pwd) export /usr/bin awk 'quoted text'
+&& 'quoted text' ${HOME}
+	'quoted text' --verbose "$@" 'quoted text' printf
+		then readonly readonly readonly && test /usr/bin -eu cd /usr/bin export
+"$1" x=1 | && "$@" && $(pwd) $(pwd) export readonly
+| ${HOME} 'quoted text' && -eu
+	readonly grep "$@" awk 'quoted text'
+	'quoted text' readonly "$@" echo local then x=1 2>/dev/null 2>/dev/null
+then grep ${HOME} awk printf done local 2>/dev/null sed 'quoted text' awk "$1"
+	awk readonly "$1" cd
+x=1 cd $(pwd) "$1" then echo local cd 'quoted text'
+	${HOME} && awk -eu 'quoted text' grep test && export --verbose |
+		cd x=1 readonly then | awk --verbose test cd x=1 test $(pwd)
+		${HOME} readonly echo sed | local cd -eu x=1 done test && then 'quoted text'
+		'quoted text' then cd "$@" "$@" "$1" awk cd awk 2>/dev/null
+	"$@" done printf x=1 2>/dev/null echo grep 2>/dev/null
+then local done awk -eu "$@" export
+	echo -eu /usr/bin --verbose echo export x=1 && sed ${HOME}
+	$(pwd) "$1" test -eu "$@" --verbose ${HOME} "$1" test x=1
+#include c106.sh
+sed awk --verbose 2>/dev/null x=1 export echo sed
+		&& --verbose /usr/bin 2>/dev/null
+	sed --verbose x=1 awk export
+done readonly $(pwd) then cd 2>/dev/null sed "$@" done
+2>/dev/null sed export -eu readonly
+		printf readonly 2>/dev/null 2>/dev/null local | printf done "$1"
+		echo -eu 'quoted text' echo --verbose local awk local printf $(pwd) done awk
+	cd then printf | "$@" printf -eu --verbose cd awk && 'quoted text'
+		echo awk local printf awk $(pwd)
+		"$@" echo local awk sed printf "$1" export echo --verbose echo
+then x=1 2>/dev/null awk
+| "$@" cd && 2>/dev/null /usr/bin
+	done "$@" echo cd ${HOME} grep
+		${HOME} then echo cd 'quoted text' grep
+		x=1 local then --verbose 2>/dev/null
+		-eu then x=1 then 'quoted text'
+sed "$1" readonly && readonly sed && readonly cd /usr/bin echo /usr/bin "$@" x=1
+	'quoted text' grep printf --verbose done
+	local --verbose awk -eu done 'quoted text' ${HOME} printf "$@" | 2>/dev/null
+	export --verbose 'quoted text' awk $(pwd) printf "$1" | | $(pwd) -eu -eu grep
+	awk "$1" test /usr/bin && --verbose x=1 grep -eu printf
+	local $(pwd) awk ${HOME} $(pwd) cd | test ${HOME} ${HOME}
+	sed 'quoted text' done test ${HOME}
+test sed x=1 ${HOME} $(pwd) printf 'quoted text' 'quoted text' $(pwd) "$1" 2>/dev/null
+x=1 cd grep awk "$1" readonly readonly "$1" && $(pwd) /usr/bin test grep
+	export printf "$1" -eu local done sed test --verbose
+	--verbose 2>/dev/null local 2>/dev/null x=1
+--verbose grep grep 'quoted text' "$1" local "$1" 'quoted text' | x=1
+	sed "$@" && "$@" -eu && /usr/bin
+		2>/dev/null sed "$@" | readonly
+		/usr/bin x=1 --verbose echo x=1 2>/dev/null -eu cd "$1" done x=1 x=1 -eu
+		grep 'quoted text' then sed
+	${HOME} "$@" --verbose ${HOME} ${HOME} 'quoted text'
+		2>/dev/null local "$1" readonly 2>/dev/null awk
+	2>/dev/null echo awk &&
+		test $(pwd) sed awk local export 'quoted text'
+		sed done /usr/bin "$@" test then awk done "$1" $(pwd) done cd export
+then awk 'quoted text' export 2>/dev/null test --verbose cd --verbose sed
+		printf cd 'quoted text' sed && ${HOME} then $(pwd) awk
+	x=1 awk 2>/dev/null ${HOME}
+	'quoted text' sed echo sed ${HOME}
+		local then ${HOME} cd 'quoted text'
+	local x=1 printf $(pwd) then export && sed printf
+		export test -eu "$@" "$@" 'quoted text' cd cd
+		test test 2>/dev/null $(pwd) "$@" done awk then 2>/dev/null then ${HOME} $(pwd)
+	echo done x=1 | --verbose then awk && export
+	echo echo export "$@" "$1" test /usr/bin /usr/bin grep
+	readonly "$1" 2>/dev/null ${HOME} local
+x=1 then readonly grep echo "$@" ${HOME} x=1 echo done 2>/dev/null
+echo grep 2>/dev/null 2>/dev/null export "$1" echo printf local $(pwd) done
+	| --verbose readonly then $(pwd) --verbose
+		x=1 done ${HOME} 'quoted text' awk cd sed test | done ${HOME}
+readonly 2>/dev/null test printf
+	grep $(pwd) export && | echo -eu echo "$1" echo "$@"
+| 2>/dev/null && /usr/bin && --verbose x=1 test ${HOME} "$@" ${HOME}
+export sed "$@" readonly && cd local cd --verbose echo 'quoted text'
+test ${HOME} "$1" cd done --verbose export $(pwd) "$1" $(pwd)
+	cd grep test local grep echo awk && -eu | --verbose done "$@" /usr/bin
+	-eu 2>/dev/null echo
+	local "$@" 'quoted text' readonly echo -eu echo --verbose test sed cd echo
+	echo echo | x=1 $(pwd) $(pwd) done 'quoted text' echo "$@" x=1 awk local
+		&& "$1" --verbose awk | /usr/bin --verbose /usr/bin echo 2>/dev/null
+readonly grep -eu grep sed test awk /usr/bin grep /usr/bin $(pwd) export |
+	sed awk x=1 2>/dev/null |
+		2>/dev/null awk sed $(pwd) echo && && x=1 x=1 'quoted text' /usr/bin
+		export && 2>/dev/null grep readonly printf
+		'quoted text' /usr/bin cd -eu
+		--verbose awk readonly local printf awk printf local -eu
+${HOME} printf cd done done then 2>/dev/null cd then grep export "$1" &&
+		--verbose 'quoted text' echo grep "$@" ${HOME}
+		awk "$@" readonly "$1" export | echo printf cd printf sed 'quoted text'
+		${HOME} "$1" --verbose -eu -eu sed && "$@"
+&& "$@" printf | test test ${HOME} then export "$1" printf done
+		| "$1" done x=1 echo done | $(pwd)
+done --verbose ${HOME} cd --verbose
+	x=1 && printf ${HOME} grep sed $(pwd) "$1" local -eu cd test
+	"$@" test test sed done && --verbose export 2>/dev/null
+		done 'quoted text' readonly sed sed grep "$@" "$1" cd 2>/dev/null sed "$@"
+cd 2>/dev/null "$@" sed --verbose "$@" && cd cd sed
+		--verbose --verbose cd "$@" "$@" test x=1 sed grep echo x=1 $(pwd) echo
+printf echo "$@" 2>/dev/null cd ${HOME} echo "$@" | -eu
+readonly awk sed | printf local local echo export cd sed cd "$@" done
+		$(pwd) "$1" readonly awk "$@" cd cd done echo "$@" $(pwd) ${HOME}
+awk "$@" printf done /usr/bin awk export x=1 | x=1
+awk echo -eu "$@" | readonly grep export export echo
+	"$@" --verbose $(pwd) awk ${HOME} cd
+	'quoted text' cd x=1 echo $(pwd)
+done test grep && 2>/dev/null 2>/dev/null local 'quoted text' "$@"
+	local done "$1" echo --verbose
+		| printf awk -eu awk ${HOME} && |
+	cd test ${HOME} local && && -eu "$1" then echo sed | done 2>/dev/null && export
+-eu local -eu "$1" ${HOME} x=1 cd test -eu /usr/bin /usr/bin x=1 "$@" &&
+cd printf "$1" x=1 export cd --verbose sed ${HOME}
+		cd $(pwd) export local test $(pwd)
+${HOME} $(pwd) readonly done
+	then -eu local printf $(pwd) /usr/bin
+cd && /usr/bin x=1 awk -eu done awk "$@" && "$@" "$@" 2>/dev/null echo --verbose
+	${HOME} "$@" readonly local echo && readonly awk "$@" -eu export 'quoted text'
+$(pwd) export sed x=1 | "$1" then --verbose
+"$@" local ${HOME} cd | echo export 'quoted text'
+awk -eu && test grep sed &&
+| x=1 && readonly && printf cd awk export "$1" printf
+readonly --verbose then ${HOME} cd then $(pwd) then 2>/dev/null readonly
+	"$@" -eu --verbose $(pwd) then /usr/bin -eu x=1 done 'quoted text'
+		then "$1" test "$1" done && --verbose $(pwd) /usr/bin echo sed $(pwd)
+sed cd "$@" | test -eu export awk awk printf "$@" local -eu -eu 2>/dev/null "$@"
+	test printf && then grep grep /usr/bin printf
+		sed printf printf test echo awk export printf export 2>/dev/null "$1"
+		done readonly echo then --verbose && export "$1" sed sed echo x=1 /usr/bin
+		&& export "$1" export x=1 $(pwd) export sed
+	"$1" export 'quoted text' readonly "$@" export /usr/bin export local
+	&& "$1" echo awk local /usr/bin "$@" x=1 local
+		'quoted text' export "$1" echo readonly cd local readonly awk readonly
+"$1" -eu $(pwd) | awk grep 2>/dev/null 2>/dev/null
+		$(pwd) printf $(pwd) $(pwd) && $(pwd) | local printf
+		--verbose then "$@" "$1" export | | printf printf ${HOME}
+		| awk then sed /usr/bin echo printf | && | then sed 2>/dev/null done echo cd printf
+	&& done export awk "$1" "$1" | readonly sed ${HOME} then | export ${HOME}
+		export test ${HOME} awk 2>/dev/null local local x=1 then --verbose
+		x=1 ${HOME} echo -eu grep -eu echo /usr/bin sed echo then --verbose awk local /usr/bin
+readonly echo sed -eu -eu
+		'quoted text' sed x=1 echo export --verbose ${HOME} awk
+		-eu sed $(pwd) test --verbose
+"$1" local | | | sed local echo echo
+		cd ${HOME} test grep /usr/bin grep export ${HOME}
+readonly 2>/dev/null && awk sed local cd
+test local echo cd printf $(pwd) | --verbose grep "$1" "$@" then readonly
+		-eu export export readonly && awk "$@" awk $(pwd) "$1" | 2>/dev/null
+		&& $(pwd) cd grep printf /usr/bin echo local done
+		then x=1 printf local readonly "$@" readonly ${HOME} echo
+grep ${HOME} local printf local /usr/bin ${HOME}
+		--verbose printf && grep /usr/bin $(pwd) export done
+-eu then /usr/bin && /usr/bin "$1" echo 2>/dev/null
+		cd | cd --verbose 2>/dev/null 2>/dev/null grep $(pwd) then && test --verbose
+2>/dev/null cd ${HOME} -eu $(pwd) $(pwd) "$1"
+		readonly sed -eu | ${HOME} cd grep readonly sed readonly
+	printf local grep cd -eu
+		"$1" "$@" && 'quoted text' /usr/bin "$@" local "$1" sed $(pwd)
+		export 'quoted text' "$1" cd "$@" echo $(pwd) -eu test export printf awk -eu done
+${HOME} 'quoted text' 2>/dev/null echo cd then $(pwd) ${HOME} "$@" --verbose
+test done /usr/bin $(pwd) 'quoted text' /usr/bin 'quoted text' "$1" 2>/dev/null
+--verbose awk local done && printf | echo
+/usr/bin x=1 -eu grep awk ${HOME} grep --verbose "$@" readonly echo 'quoted text'
+	-eu && awk local "$1" --verbose
+	'quoted text' x=1 test --verbose readonly local local export cd 2>/dev/null
+		"$@" "$@" cd echo sed /usr/bin printf echo x=1 "$@" 'quoted text'
+		awk x=1 grep /usr/bin && local test test 'quoted text'
+	then local local -eu cd export 2>/dev/null grep then 'quoted text' "$@" x=1 "$@"
+	"$1" "$1" export export done readonly sed /usr/bin ${HOME} then x=1 printf test
+		"$@" printf "$1" echo awk printf readonly cd local 'quoted text'
+		&& sed && printf local cd --verbose
+		done "$1" x=1 $(pwd) readonly
+sed awk "$@" -eu sed test
+		grep "$@" grep echo sed readonly /usr/bin
+	local awk | "$1" x=1 then && printf cd $(pwd) sed 'quoted text' sed ${HOME}
+local awk done "$@" 2>/dev/null
+		readonly printf "$1" local --verbose $(pwd)
+	"$1" readonly "$1" "$@" readonly
+		readonly --verbose cd test
+sed -eu --verbose cd -eu --verbose
+	${HOME} readonly readonly
+		test 2>/dev/null $(pwd) "$@"
+		done | "$1" -eu "$1" "$1" -eu | x=1 ${HOME} export readonly && /usr/bin
+	cd echo done "$@" local && awk x=1 x=1 && "$1"
+test x=1 readonly export | ${HOME} 'quoted text'
+then grep cd 'quoted text' printf done
+"$1" local "$@" 2>/dev/null
+sed 2>/dev/null /usr/bin test 'quoted text'
+	"$1" "$@" && test -eu sed cd local echo local -eu then /usr/bin
+	"$@" 2>/dev/null x=1 export
+		--verbose cd then printf x=1 local grep then "$1" then
+x=1 /usr/bin | 'quoted text' $(pwd) x=1 $(pwd) 2>/dev/null |
+		echo sed echo --verbose && test readonly
+		then test readonly "$1" export
+done && ${HOME} done awk local x=1 test sed echo done /usr/bin
+&& sed "$@" printf /usr/bin /usr/bin /usr/bin done
+		printf --verbose grep then "$@" readonly && "$@"
+	--verbose readonly local 'quoted text'
+		local | done -eu 'quoted text' 2>/dev/null export -eu | | ${HOME} $(pwd) "$@"
+cd export cd readonly && test 'quoted text' && cd | cd echo sed
+		"$@" awk echo && done sed 'quoted text' awk && 'quoted text' echo "$@" &&
+sed $(pwd) then ${HOME} printf awk awk local echo sed -eu done
+		export awk test --verbose "$1" ${HOME} 2>/dev/null printf $(pwd) 'quoted text'
+	sed awk echo $(pwd) ${HOME} --verbose
+	"$1" then then echo printf
+	$(pwd) printf grep $(pwd) "$1" printf ${HOME}
+	printf && && "$1" readonly
+done && 'quoted text' sed "$@"
+cd test --verbose $(pwd) readonly --verbose --verbose "$1" sed echo readonly
+		"$@" done local sed ${HOME} -eu ${HOME} sed awk $(pwd) export
+	2>/dev/null $(pwd) $(pwd) && 2>/dev/null
+	"$1" export -eu echo sed grep && "$1" readonly x=1 && local done readonly
+-eu -eu cd -eu $(pwd) -eu --verbose grep -eu 'quoted text'
+"$1" | -eu export sed ${HOME} then "$1" | done | readonly
+&& export 'quoted text' export --verbose 2>/dev/null
+echo 2>/dev/null | echo --verbose
+2>/dev/null printf done -eu -eu cd "$1" readonly sed && done "$1" sed && "$@" "$1"
+local 2>/dev/null "$@" "$1" printf x=1 -eu echo
+echo "$1" "$@" local echo grep test echo awk "$@" done
+${HOME} printf then x=1 export awk local then then
+	'quoted text' printf x=1 x=1 test 'quoted text' export printf --verbose ${HOME}
+x=1 ${HOME} test printf readonly local ${HOME} readonly
+sed -eu echo test awk && awk | $(pwd) "$@" local test echo test
+awk | export 2>/dev/null readonly $(pwd) ${HOME}
+"$1" ${HOME} $(pwd) echo && cd && $(pwd) /usr/bin
+	'quoted text' -eu x=1 --verbose sed "$1" "$@" printf cd "$@"
+		--verbose "$@" echo then export
+		sed "$1" -eu --verbose cd --verbose /usr/bin "$1" printf
+	"$1" test x=1 awk -eu
+		awk -eu /usr/bin $(pwd) 2>/dev/null 'quoted text' cd awk test -eu awk local
+done -eu grep 2>/dev/null printf test | 2>/dev/null test awk $(pwd) grep
+	printf 'quoted text' printf -eu cd -eu --verbose
+		| "$@" local ${HOME} ${HOME} x=1 cd /usr/bin
+		"$1" sed 'quoted text' test 2>/dev/null
+2>/dev/null x=1 cd export 2>/dev/null readonly 2>/dev/null printf readonly
+	x=1 sed 'quoted text' x=1 && ${HOME} --verbose x=1 /usr/bin ${HOME} done
+2>/dev/null -eu sed cd -eu "$1" -eu local x=1 ${HOME} ${HOME} awk test | | local
+		readonly "$@" && --verbose 'quoted text' local done test
+--verbose "$@" local --verbose
+&& 2>/dev/null $(pwd) --verbose
+		sed $(pwd) "$1" 2>/dev/null | 2>/dev/null readonly 2>/dev/null
+		cd "$1" "$1" x=1 'quoted text' printf 'quoted text'
+--verbose sed 2>/dev/null --verbose -eu local "$1" then export
+done sed ${HOME} ${HOME} "$@" x=1 then grep "$@" $(pwd)
+		2>/dev/null "$1" sed $(pwd)
+		awk test x=1 awk cd && then then done awk
+		cd printf | then local sed cd && readonly then
+		"$1" "$1" && "$@" cd sed x=1 awk
+	sed "$1" $(pwd) 2>/dev/null export 2>/dev/null
+		then echo --verbose /usr/bin done
+| 2>/dev/null test ${HOME} 2>/dev/null local 'quoted text' ${HOME}
+		cd sed sed "$@" printf x=1 $(pwd) && $(pwd) readonly echo
+		&& local echo then awk "$@" $(pwd) --verbose x=1 test local cd /usr/bin
+		echo readonly readonly grep done "$@" "$1" /usr/bin
+		${HOME} | test printf $(pwd) export $(pwd) x=1 | test cd done echo
+		echo "$@" && done cd -eu awk && 2>/dev/null 2>/dev/null then
+	'quoted text' "$@" local printf && 'quoted text'
+sed then test grep sed export x=1 | grep then 'quoted text'
+${HOME} -eu -eu 2>/dev/null printf sed --verbose local
+test /usr/bin $(pwd) grep test /usr/bin x=1 readonly grep 2>/dev/null
+	test 2>/dev/null -eu $(pwd) $(pwd) 'quoted text' local echo grep 2>/dev/null 2>/dev/null
+		sed -eu $(pwd) then local --verbose
+printf readonly readonly readonly --verbose 2>/dev/null done echo /usr/bin
+	2>/dev/null done /usr/bin ${HOME} printf $(pwd) 2>/dev/null test printf printf
+cd 'quoted text' cd --verbose 2>/dev/null cd sed awk test done | ${HOME}
+		'quoted text' done "$1" 'quoted text'
+		${HOME} grep echo then sed awk printf cd x=1 then 'quoted text' done "$1" -eu
+		"$1" done echo printf "$@" sed export $(pwd) grep export
+	"$@" cd 2>/dev/null /usr/bin printf readonly done
+	sed 2>/dev/null cd grep --verbose printf
+'quoted text' -eu local 'quoted text' sed
+'quoted text' printf sed then x=1 2>/dev/null
+		echo export grep cd "$@" then | x=1 x=1 awk
+		-eu && export --verbose echo readonly
+	&& | sed /usr/bin /usr/bin $(pwd) -eu ${HOME} 2>/dev/null printf 2>/dev/null
+		echo "$1" done awk "$@" cd grep -eu --verbose awk x=1 x=1 cd
+--verbose 'quoted text' /usr/bin x=1 then printf local
+'quoted text' && 'quoted text' grep --verbose "$1" x=1 x=1 awk printf cd
+		then echo echo 2>/dev/null --verbose ${HOME} -eu /usr/bin x=1 then sed test -eu
+	test $(pwd) /usr/bin
+		test "$@" "$1" echo |
+done | export awk cd done -eu 'quoted text' cd
+		&& test && readonly awk
+		"$@" sed awk -eu grep readonly done local &&
+grep local && $(pwd) then | | then $(pwd) sed $(pwd)
+		"$@" $(pwd) export echo echo | ${HOME} sed /usr/bin ${HOME} ${HOME}
+		"$@" $(pwd) ${HOME} awk "$@" echo awk sed then
+sed done --verbose then -eu local test sed
+--verbose sed done "$1" readonly
+${HOME} then grep export $(pwd) /usr/bin grep $(pwd) then printf readonly | $(pwd)
+	readonly cd awk test $(pwd) sed done x=1 test cd cd 'quoted text' &&
+		export -eu "$@" awk | readonly grep x=1 readonly /usr/bin echo /usr/bin
+		--verbose $(pwd) "$@"
+$(pwd) $(pwd) 2>/dev/null --verbose local then
+| "$@" printf /usr/bin sed sed "$1" awk readonly local | sed -eu
+	x=1 'quoted text' printf
+&& readonly 'quoted text' x=1 cd -eu x=1 sed x=1 test cd local echo grep
+test grep readonly ${HOME} cd x=1 sed awk awk printf
+2>/dev/null x=1 grep awk
+	printf readonly awk $(pwd) "$1" done then cd test
+		$(pwd) printf awk /usr/bin export cd readonly awk cd printf
+echo --verbose echo 'quoted text' ${HOME} --verbose test printf $(pwd)
+	test printf /usr/bin /usr/bin done 'quoted text' cd | cd export
+		&& 'quoted text' 2>/dev/null
+		export | done "$@" printf -eu grep && && grep printf "$1" /usr/bin
+	readonly -eu /usr/bin -eu then echo "$1" cd awk local local -eu
+		x=1 $(pwd) then awk && local
+"$1" cd "$@" export "$@"
+		&& test "$@" cd export printf /usr/bin export then done && && cd /usr/bin printf
+	-eu "$@" export awk && local "$@" 'quoted text' printf x=1 --verbose && then
+	${HOME} then sed "$1" | export cd | local /usr/bin done 2>/dev/null -eu
+	'quoted text' /usr/bin awk readonly /usr/bin $(pwd) $(pwd) --verbose test grep
+	echo readonly && then /usr/bin | echo
+"$@" sed readonly awk x=1 x=1 2>/dev/null cd
+	sed readonly awk echo local local grep printf readonly
+then grep awk export "$1" local echo export echo x=1 readonly --verbose
+		sed 'quoted text' sed export 2>/dev/null
+sed awk && sed awk "$1" test echo grep awk $(pwd) | export "$@" && test
+	grep x=1 test && /usr/bin cd $(pwd) "$1"
+		x=1 && | ${HOME} cd "$@" /usr/bin
+2>/dev/null done -eu | cd cd sed "$1" echo done readonly
+	done cd echo $(pwd) /usr/bin cd && printf then 'quoted text'
+		done --verbose x=1 x=1 echo --verbose
+local grep ${HOME} printf --verbose $(pwd) printf readonly
+	'quoted text' printf echo 2>/dev/null awk readonly test done done sed && awk test
+&& "$@" then local awk $(pwd) readonly "$1" test test $(pwd) test done
+		then 'quoted text' export done /usr/bin local awk && ${HOME}
+sed "$1" && "$@" then test | local -eu /usr/bin done export
+		&& $(pwd) test "$1" x=1
+		then printf grep then readonly
+		local && -eu done test --verbose
+	"$1" sed sed ${HOME} | && grep "$@" export
+-eu && readonly "$1" done
+		test x=1 cd test x=1 readonly 2>/dev/null
+then awk --verbose | --verbose 2>/dev/null --verbose readonly
+	awk test awk x=1 test local local -eu $(pwd) --verbose
+"$1" "$1" --verbose 'quoted text' export readonly "$1" local
+		-eu test 'quoted text' |
+awk ${HOME} "$1" local -eu readonly then export
+		sed readonly grep ${HOME} awk echo "$1" grep done $(pwd) x=1 | then then -eu 2>/dev/null
+		${HOME} 2>/dev/null then 2>/dev/null --verbose $(pwd) printf "$1"
+		| test grep "$@" awk /usr/bin
+	| printf awk local test
+	-eu grep -eu "$1" && && ${HOME} readonly awk grep done 'quoted text'
+		grep x=1 done 2>/dev/null readonly
+| -eu cd local grep test cd --verbose 'quoted text' printf export 'quoted text'
+	"$1" grep ${HOME} grep 2>/dev/null
+grep "$@" && x=1 "$@" 2>/dev/null export
+export $(pwd) $(pwd) --verbose x=1 "$@" awk then
+	test | awk $(pwd) | "$1" then readonly grep 'quoted text'
+	grep "$@" 2>/dev/null ${HOME}
+readonly sed 'quoted text' "$1" test
+	printf grep export | readonly local -eu then --verbose | -eu
+test export cd 2>/dev/null | "$@" && x=1 printf --verbose sed printf
+	2>/dev/null awk then && sed /usr/bin 'quoted text' "$1"
+	&& sed -eu printf then local /usr/bin cd
+	-eu -eu $(pwd) done echo export cd cd grep
+		then && x=1 ${HOME} printf then $(pwd)
+	printf 2>/dev/null echo -eu cd 2>/dev/null
+	printf then local awk "$@" export 2>/dev/null
+		readonly -eu "$@" 2>/dev/null grep sed
+sed then sed x=1 2>/dev/null /usr/bin /usr/bin done ${HOME} cd local
+		printf | done 'quoted text'
+		test readonly cd echo
+		| cd echo 'quoted text' then ${HOME} --verbose
+awk sed /usr/bin x=1 x=1
+	echo then x=1 then readonly 'quoted text' 'quoted text' then x=1 awk
+	2>/dev/null $(pwd) local 'quoted text' -eu
+then export x=1 $(pwd) awk 2>/dev/null --verbose
+local then readonly test
+	&& -eu echo readonly export local "$1" $(pwd) done awk grep
+		echo awk sed awk export local && printf ${HOME} ${HOME}
+	export grep printf && "$1" $(pwd)
+cd readonly then export
+	"$1" x=1 $(pwd) "$1" x=1 cd x=1 $(pwd) | echo printf sed | 'quoted text' $(pwd)
+"$@" "$1" 2>/dev/null -eu cd /usr/bin sed readonly "$1" && "$1" test
+	readonly then ${HOME} cd --verbose
+		"$@" echo ${HOME} ${HOME} export printf local sed 2>/dev/null
+	done export done "$1" grep then --verbose
+	x=1 'quoted text' $(pwd) | local readonly test sed -eu --verbose 'quoted text'
+	'quoted text' 2>/dev/null 2>/dev/null x=1 /usr/bin grep 'quoted text'
+then --verbose awk echo /usr/bin 2>/dev/null then
+	echo 'quoted text' local test | done
+	-eu export /usr/bin echo echo
+2>/dev/null sed grep /usr/bin test | 'quoted text' $(pwd) cd
+	export "$1" export | printf 2>/dev/null "$@" then "$1" && 'quoted text'
+done 'quoted text' 'quoted text'
+		${HOME} then ${HOME}
+		/usr/bin 'quoted text' --verbose && then -eu awk x=1 awk 2>/dev/null echo
+	readonly $(pwd) --verbose "$@" | grep "$@" x=1 local readonly "$1"
+	| -eu --verbose then "$@" 2>/dev/null
+	printf printf -eu printf cd -eu cd readonly
+	grep printf cd -eu --verbose grep local done
+	--verbose then cd $(pwd) echo awk export export done 'quoted text' 2>/dev/null
+		x=1 2>/dev/null printf printf
+		done readonly "$@" 'quoted text'
+	test cd printf "$@" readonly -eu export test $(pwd) sed
+	$(pwd) grep 2>/dev/null test | printf test grep -eu &&
+	'quoted text' -eu "$@" 2>/dev/null awk "$@" cd ${HOME} x=1 /usr/bin
+	-eu 2>/dev/null ${HOME} local | done
+		"$@" /usr/bin local -eu "$1" 'quoted text' done test export --verbose
+then "$@" /usr/bin 2>/dev/null -eu cd 'quoted text' "$@" 2>/dev/null
+export readonly export cd 2>/dev/null "$1" sed export then x=1 -eu then
+	&& $(pwd) x=1 && x=1 export readonly
+printf --verbose then grep export x=1 local
+		-eu ${HOME} "$1" 2>/dev/null
+	&& cd test x=1 --verbose $(pwd) awk /usr/bin
+		| x=1 ${HOME} awk $(pwd) --verbose
+grep export printf "$@" then "$@" &&
+	&& local readonly 2>/dev/null then /usr/bin ${HOME} | printf local x=1
+		cd test echo x=1 test --verbose sed
+		2>/dev/null --verbose then "$1" -eu "$@" --verbose readonly
+		cd then ${HOME} "$1" 2>/dev/null
+done echo export test /usr/bin
+		--verbose | x=1 -eu echo export 2>/dev/null grep -eu --verbose done
+	x=1 x=1 cd echo 2>/dev/null printf x=1 local test 'quoted text'
+	x=1 done awk export awk then "$1" awk | then
+		$(pwd) test echo then awk echo grep test grep ${HOME} then -eu | && sed
+	sed 2>/dev/null printf x=1 2>/dev/null
+	/usr/bin "$1" awk ${HOME} grep done 'quoted text' export test /usr/bin printf |
+		echo --verbose export $(pwd) | "$@" | && cd --verbose 'quoted text' readonly cd
+x=1 /usr/bin && 2>/dev/null &&
+		'quoted text' grep --verbose ${HOME} $(pwd) 'quoted text' sed -eu
+grep 2>/dev/null grep readonly
+	readonly readonly awk cd readonly
+		"$@" then grep x=1 echo "$1" 2>/dev/null printf echo echo 2>/dev/null
+	then 2>/dev/null "$@" "$1" --verbose
+		readonly $(pwd) export -eu test /usr/bin
+--verbose "$1" cd x=1 'quoted text' readonly "$@" 2>/dev/null "$1" $(pwd)
+"$@" /usr/bin 2>/dev/null /usr/bin && "$1" x=1 $(pwd)
+	printf echo --verbose x=1 /usr/bin cd printf "$1" then 2>/dev/null readonly &&
+/usr/bin "$1" /usr/bin
+x=1 then grep cd grep && | $(pwd) sed local "$1" then export $(pwd) readonly
+cd "$1" local 'quoted text' ${HOME} cd readonly /usr/bin "$@"
+		test --verbose then printf --verbose awk "$1" done export | test 2>/dev/null
+	export export x=1 ${HOME} local then "$@" 'quoted text' --verbose $(pwd) -eu
+		x=1 $(pwd) sed then | grep && grep printf x=1 2>/dev/null 2>/dev/null
+	cd done done local done 'quoted text' 2>/dev/null
+		| export && sed sed echo --verbose awk x=1 done sed
+awk grep printf export | local awk $(pwd) -eu sed $(pwd) echo -eu
+		'quoted text' done x=1 'quoted text' && export -eu x=1 done -eu export
+		"$1" | grep --verbose /usr/bin
+x=1 --verbose echo sed test local $(pwd)
+		/usr/bin --verbose echo
+$(pwd) printf sed local -eu then "$@" cd "$@" readonly done
+&& cd echo echo x=1 && echo "$@" done 2>/dev/null
+		grep grep $(pwd) echo 2>/dev/null --verbose export --verbose printf
+	local && --verbose awk 2>/dev/null sed then &&
+		${HOME} sed cd echo done
+test readonly "$1" echo echo cd
+	readonly sed printf x=1 "$@" sed test ${HOME} $(pwd)
+	--verbose local -eu $(pwd) | then x=1 done then then --verbose "$@" 2>/dev/null
+x=1 2>/dev/null cd readonly awk printf
+	awk then done x=1 x=1 "$1" -eu /usr/bin readonly printf $(pwd) printf $(pwd) 2>/dev/null
+		readonly awk readonly ${HOME} awk 'quoted text' readonly then grep cd 'quoted text'
+awk test grep local awk "$1" -eu
+		echo awk --verbose local -eu && local /usr/bin
+	"$1" ${HOME} readonly echo awk awk && grep | --verbose |
+export local grep sed test --verbose -eu readonly
+grep /usr/bin then then local
+-eu test --verbose ${HOME} then readonly
+	printf $(pwd) echo "$1" -eu export
+2>/dev/null then done grep readonly done x=1 /usr/bin
+	'quoted text' export | local local 'quoted text' then ${HOME}
+	test | x=1 x=1 --verbose "$1" /usr/bin export
+		${HOME} export "$@" awk
+| 2>/dev/null done awk grep 'quoted text' local readonly x=1 then grep
+	${HOME} --verbose printf cd printf local $(pwd) | local
+		| echo grep /usr/bin /usr/bin echo export -eu -eu "$1" done
+| 'quoted text' ${HOME} then
+	test /usr/bin readonly | test sed "$@" x=1 test 'quoted text' -eu then echo
+		local then | sed echo then test local "$@" && "$@" cd
+		then local cd echo sed printf
+	x=1 /usr/bin | done printf awk
+	2>/dev/null 'quoted text' 'quoted text' awk test 2>/dev/null
+	-eu grep grep /usr/bin printf
+		printf test local local "$@" /usr/bin test readonly "$1" | 2>/dev/null
+printf printf done cd readonly sed readonly | sed grep awk cd && local $(pwd)
+		&& printf | done 'quoted text' done readonly 'quoted text' && grep x=1 "$@"
+		"$1" $(pwd) -eu awk done -eu && ${HOME} --verbose "$@" "$@"
+readonly -eu cd readonly awk then x=1 awk sed 'quoted text'
+	awk readonly echo done 2>/dev/null && && $(pwd) printf ${HOME} sed | local sed
+		printf export /usr/bin && printf awk --verbose | done cd
+	/usr/bin | ${HOME} grep grep
+local /usr/bin -eu test 'quoted text' ${HOME} | 'quoted text'
+	2>/dev/null && $(pwd) then sed 2>/dev/null ${HOME} readonly echo
+	awk grep $(pwd) ${HOME} test "$1" -eu readonly $(pwd) done
+grep sed $(pwd) x=1 awk export export awk && | && echo awk echo && echo "$1"
+	"$@" | -eu readonly 'quoted text' printf /usr/bin cd printf | then && /usr/bin
+	cd export then export
+		$(pwd) cd | "$1" x=1 sed "$@"
+	readonly done ${HOME} --verbose done x=1 | sed sed | $(pwd) cd grep then
+		"$@" | && test test 'quoted text' 2>/dev/null
+done grep awk --verbose /usr/bin | awk ${HOME} done --verbose readonly
+	local awk done grep ${HOME} readonly x=1 done
+awk -eu 'quoted text' --verbose 2>/dev/null
+local --verbose --verbose readonly
+	local then 2>/dev/null echo
+&& | local && x=1 test cd then 2>/dev/null
+$(pwd) grep then 'quoted text'
+		-eu 2>/dev/null export export local export
+	done export | 'quoted text' "$@" 2>/dev/null
+"$@" readonly awk && sed /usr/bin then $(pwd) then
+$(pwd) grep export /usr/bin 'quoted text' done --verbose awk
+		&& 'quoted text' --verbose 'quoted text' export "$@" cd printf cd local readonly
+		local done done $(pwd) export $(pwd) test grep "$1"
+	/usr/bin awk "$1" /usr/bin ${HOME} | 'quoted text' printf 2>/dev/null $(pwd)
+echo && export cd x=1 printf readonly && grep | echo "$1" local
+echo echo readonly test && local readonly ${HOME} sed
+		'quoted text' printf | readonly done "$@" "$1" done export 'quoted text'
+printf sed 2>/dev/null $(pwd) 2>/dev/null
+&& done awk then done 'quoted text'
+	echo 2>/dev/null $(pwd) -eu printf $(pwd) && $(pwd) readonly
+${HOME} test done "$@" echo then awk printf && && done grep -eu ${HOME}
+"$1" "$1" echo cd | --verbose -eu echo "$1" && 'quoted text' done "$1"
+readonly --verbose 2>/dev/null x=1 printf done /usr/bin --verbose
+| export $(pwd) | export x=1 grep done test awk done cd then x=1 local 'quoted text'
+		readonly test grep 2>/dev/null ${HOME} sed x=1 done
+		awk echo done cd -eu awk printf export $(pwd)
+	/usr/bin printf 2>/dev/null x=1 "$1" local cd | "$1" "$1"
+cd cd then cd "$@" | 2>/dev/null && printf export sed cd "$@"
+	"$1" $(pwd) && x=1 local x=1 ${HOME} $(pwd) && 'quoted text'
+	printf --verbose grep "$@" | 'quoted text' printf local readonly 'quoted text'
+	cd && -eu ${HOME} echo echo printf readonly && local --verbose
+awk && grep "$1" "$1" --verbose | local done x=1 awk then $(pwd) awk export echo
+sed ${HOME} --verbose cd local 2>/dev/null x=1 &&
+	--verbose readonly --verbose ${HOME} sed x=1 "$@" --verbose 2>/dev/null --verbose
+	local local /usr/bin 'quoted text' cd && local test done readonly ${HOME}
+test grep ${HOME} printf x=1 awk cd
+readonly awk cd -eu "$@" cd "$1" 2>/dev/null 'quoted text'
+	"$@" printf done done readonly /usr/bin
+sed && 'quoted text' x=1 2>/dev/null
+		$(pwd) --verbose export | | cd echo $(pwd) done 'quoted text'
+	/usr/bin --verbose done --verbose
+then && readonly export 'quoted text' awk /usr/bin echo
+cd ${HOME} --verbose local | 'quoted text' -eu | then awk "$@" echo test x=1
+	"$1" | /usr/bin 'quoted text' --verbose --verbose
+	test sed cd $(pwd) cd readonly | ${HOME} readonly test | printf sed
+	--verbose /usr/bin test |
+printf local && grep x=1 readonly -eu
+	cd 2>/dev/null | awk done readonly ${HOME} /usr/bin
+then sed test readonly 'quoted text' printf echo
+done done --verbose $(pwd) done test printf export
+		then $(pwd) && export test readonly $(pwd) echo "$1" && "$@" -eu 2>/dev/null
+	then "$1" test readonly done grep /usr/bin local
+		2>/dev/null && done export && /usr/bin
+&& grep cd "$1" ${HOME} $(pwd) awk
+	'quoted text' "$@" /usr/bin done 'quoted text' | grep awk /usr/bin export
+		awk $(pwd) then cd sed && /usr/bin --verbose
+		local 2>/dev/null "$@" printf
+		test | 'quoted text' ${HOME} | cd then readonly ${HOME} done
+	"$1" | $(pwd) --verbose --verbose | printf grep $(pwd) awk grep
+	sed 2>/dev/null printf sed | ${HOME} done test "$@" readonly
+&& awk ${HOME} --verbose "$1" $(pwd) x=1 printf cd --verbose
+	x=1 awk | 2>/dev/null sed $(pwd) sed test x=1 grep
+then done $(pwd) && sed "$1" local | x=1 "$@" echo
+	| 2>/dev/null -eu echo --verbose echo "$@" x=1 && awk /usr/bin 'quoted text'
+&& done --verbose readonly export test "$@" echo
+		2>/dev/null local | x=1 export export
+		test then 2>/dev/null sed then | local 'quoted text'
+	echo test --verbose readonly cd $(pwd)
+-eu /usr/bin | $(pwd) sed awk | | --verbose /usr/bin
+		&& awk "$@" readonly && "$@" cd grep 'quoted text' $(pwd) done x=1 done
+		test then "$@" 2>/dev/null 'quoted text'
+		printf cd export -eu "$@" x=1 readonly --verbose
+	x=1 2>/dev/null -eu then | -eu test ${HOME}
+then then sed "$1" readonly local grep
+-eu then 'quoted text' "$@" "$1" -eu echo printf grep then "$1"
+	test test grep awk done "$1" &&
+	--verbose awk readonly x=1 printf then cd local x=1 then cd printf "$@" awk
+	&& "$1" --verbose grep readonly | 2>/dev/null "$1" | | -eu then x=1 printf
+readonly 2>/dev/null "$@" local 2>/dev/null then cd "$@" /usr/bin awk
+	${HOME} $(pwd) echo test printf sed readonly --verbose /usr/bin test $(pwd) &&
+		${HOME} /usr/bin then done local awk done
+		echo readonly awk echo test x=1 then sed
+export --verbose x=1 printf
+	--verbose done "$1" readonly && && printf echo
+	sed readonly cd echo x=1 $(pwd) grep
+$(pwd) | cd cd done 2>/dev/null sed | grep
+		/usr/bin awk 'quoted text' printf /usr/bin |
+	test cd done && ${HOME} && ${HOME}
+	readonly awk done /usr/bin | "$1" -eu test ${HOME} | awk
+local ${HOME} $(pwd)
+$(pwd) 2>/dev/null then sed $(pwd) --verbose sed 'quoted text' echo then local
+		cd x=1 ${HOME} && && test "$1"
+local x=1 $(pwd) x=1 --verbose "$@" "$@" echo
+export -eu echo cd "$@" $(pwd) grep | "$@" done grep x=1 local --verbose
+"$1" sed && | && grep sed x=1 awk "$@" local && readonly export x=1
+	cd then -eu printf "$1" "$@" readonly && awk 'quoted text'
+	--verbose grep test grep "$@" export done && "$1" sed cd cd
+echo readonly 2>/dev/null awk 2>/dev/null 'quoted text' then 2>/dev/null printf
+		export | printf local $(pwd) -eu 'quoted text' ${HOME} --verbose
+sed local printf x=1 /usr/bin $(pwd) cd ${HOME} done -eu echo test
+readonly ${HOME} --verbose
+	2>/dev/null /usr/bin x=1
+	"$@" && ${HOME} && export then 2>/dev/null sed 2>/dev/null export local sed
+export export grep sed x=1 local
+&& local export /usr/bin then "$@" x=1 | "$@" /usr/bin && cd && then x=1 | ${HOME}
+2>/dev/null $(pwd) $(pwd) then /usr/bin 2>/dev/null
+	local --verbose echo printf test then && printf readonly local
+		&& --verbose x=1 --verbose ${HOME} sed -eu ${HOME} export echo done
+	cd --verbose ${HOME} --verbose
+/usr/bin then done sed /usr/bin "$1" test 'quoted text' 'quoted text'
+		grep && "$1" then && 2>/dev/null --verbose then test x=1 awk cd export export 'quoted text'
+		&& grep /usr/bin && --verbose ${HOME} ${HOME} then
+		awk /usr/bin --verbose | printf && readonly grep test then /usr/bin
+done /usr/bin grep done cd "$@" /usr/bin
+	then done | local 2>/dev/null awk grep readonly then cd | echo
+grep export ${HOME} $(pwd) grep test && -eu 2>/dev/null ${HOME} $(pwd)
+	$(pwd) sed echo awk test x=1 && grep && done 'quoted text' "$1"
+		${HOME} /usr/bin then test test 'quoted text' -eu export && && -eu grep /usr/bin
+local $(pwd) --verbose local /usr/bin
+	$(pwd) awk --verbose /usr/bin && cd x=1 "$1" echo ${HOME} /usr/bin printf
+	$(pwd) local cd ${HOME} readonly x=1 --verbose
+	grep export export readonly --verbose $(pwd) export test && done done
+	-eu test -eu "$@" ${HOME} printf --verbose readonly
+	echo /usr/bin readonly sed echo --verbose "$@" && "$1" $(pwd) local cd x=1 export
+sed -eu -eu cd -eu --verbose readonly
+	grep | export | "$1" grep export readonly grep 'quoted text'
+$(pwd) test 'quoted text' export && export then x=1 x=1 /usr/bin
+	cd --verbose local cd 2>/dev/null $(pwd)
+cd --verbose grep --verbose 'quoted text' printf $(pwd) 'quoted text' &&
+&& cd ${HOME} | sed readonly 2>/dev/null echo x=1 sed 'quoted text'
+		awk test ${HOME} cd 'quoted text' test --verbose echo | | then local done --verbose
+	cd awk then local readonly -eu -eu "$1" $(pwd) grep "$@" | printf "$1" "$@" awk
+export "$@" $(pwd) 2>/dev/null grep -eu
+--verbose ${HOME} x=1 --verbose /usr/bin --verbose
+| "$@" $(pwd) printf local then ${HOME}
+		"$@" && | local | | export -eu ${HOME} 2>/dev/null "$1" x=1 -eu awk export
+		/usr/bin done local ${HOME} x=1 cd --verbose then sed test awk
+	&& | done /usr/bin "$1" local echo readonly done | then printf x=1 local --verbose
+grep /usr/bin && $(pwd) test 'quoted text' && test
+		cd "$1" grep 'quoted text' printf x=1 sed done readonly
+	| test then --verbose $(pwd) ${HOME} grep printf && x=1
+	"$@" readonly && 'quoted text' sed awk cd --verbose | 2>/dev/null 2>/dev/null
+		$(pwd) export x=1 done && ${HOME} readonly
+then 'quoted text' local 'quoted text'
+-eu sed echo "$1" | grep
+	2>/dev/null --verbose test printf local -eu "$@" "$@" "$@"
+		-eu --verbose echo sed printf test sed /usr/bin cd printf
+'quoted text' --verbose then grep -eu --verbose
+	readonly done echo readonly echo x=1 local 2>/dev/null
+	awk echo awk x=1 echo /usr/bin /usr/bin
+	printf x=1 done grep printf awk local cd printf ${HOME} awk cd export /usr/bin
+2>/dev/null done cd done cd echo done readonly local $(pwd) local "$1" |
+		test $(pwd) sed $(pwd) "$1" test
+then sed /usr/bin awk /usr/bin $(pwd) "$1" "$1" cd grep && /usr/bin
+		readonly 2>/dev/null x=1 --verbose --verbose export "$1" ${HOME} printf
+		printf -eu $(pwd) --verbose 2>/dev/null --verbose echo awk echo x=1 | export
+		$(pwd) $(pwd) "$@" 2>/dev/null 'quoted text' grep readonly | "$1"
+		'quoted text' ${HOME} ${HOME} done grep printf 'quoted text' "$1" done export
+		readonly x=1 readonly "$1" | $(pwd) -eu printf done --verbose grep 'quoted text'
+export export /usr/bin 'quoted text' $(pwd)
+--verbose && --verbose sed sed "$@"
+		cd "$@" "$1" echo x=1 export
+echo ${HOME} sed "$@" echo export
+		/usr/bin readonly -eu echo
+		${HOME} "$1" /usr/bin readonly --verbose
+printf 2>/dev/null && | | readonly
+	-eu readonly && readonly "$@" readonly "$1" printf export done export
+	/usr/bin 'quoted text' then then echo
+		'quoted text' echo x=1 && readonly
+sed printf | test echo "$1" printf 'quoted text' local readonly local ${HOME}
+		sed local 2>/dev/null $(pwd) x=1 $(pwd) x=1 readonly $(pwd)
+${HOME} export grep awk && "$@" echo 2>/dev/null && ${HOME} printf awk sed echo
+	sed ${HOME} echo export "$@" && ${HOME} ${HOME} |
+	&& ${HOME} printf --verbose printf export readonly "$@" export -eu test
+		&& cd printf grep grep echo x=1 export local ${HOME} ${HOME}
+		echo -eu | 'quoted text' export --verbose echo
+'quoted text' export | printf
+	'quoted text' printf && readonly grep /usr/bin 'quoted text'
+done printf --verbose /usr/bin 2>/dev/null | then 2>/dev/null 2>/dev/null local
+	printf echo ${HOME} --verbose sed then
+"$@" echo | sed | export export ${HOME} then
+		&& ${HOME} /usr/bin x=1 export
+	-eu 'quoted text' local
+		sed export ${HOME} | export test sed test && readonly
+		"$@" 'quoted text' printf -eu readonly -eu sed sed "$@"
+	-eu awk | local --verbose
+		done export ${HOME} "$@" 2>/dev/null
+		/usr/bin | local 2>/dev/null -eu | export --verbose done cd done
+-eu printf printf local
+${HOME} echo local then test sed 'quoted text'
+	'quoted text' | awk "$1" then
+	${HOME} readonly grep echo echo
+	grep && sed --verbose printf --verbose -eu -eu
+		| export 'quoted text' printf ${HOME}
+		test 2>/dev/null grep 2>/dev/null
+then && done sed sed printf printf local sed -eu grep --verbose printf
+		-eu sed grep sed echo printf "$@" done
+		printf done local -eu done export
+"$1" /usr/bin "$@" "$1" readonly | -eu printf readonly ${HOME} echo | echo 2>/dev/null
+		| export cd /usr/bin test /usr/bin
+$(pwd) "$@" test sed && x=1
+	'quoted text' readonly export
+	test /usr/bin 'quoted text' export
+2>/dev/null grep 2>/dev/null 'quoted text' /usr/bin ${HOME} $(pwd) 2>/dev/null
+then grep sed ${HOME} done
+		readonly cd sed echo then ${HOME} "$1" then /usr/bin printf
+		| test 'quoted text' x=1 printf grep local | "$1" done local
+		2>/dev/null grep echo test "$@"
+echo readonly -eu done cd cd -eu -eu && && "$@" /usr/bin && && printf "$@" "$@"
+		2>/dev/null local grep then local
+&& done awk x=1 sed -eu local "$@" x=1 2>/dev/null test done cd cd
+echo "$1" awk test printf "$@" x=1 x=1 done --verbose
+echo ${HOME} echo $(pwd) -eu awk 'quoted text'
+/usr/bin 2>/dev/null done "$1" "$@" echo $(pwd) grep "$@" awk 2>/dev/null
+		readonly | test /usr/bin x=1 $(pwd) printf awk grep
+	| export /usr/bin export done echo readonly
+		&& local readonly "$1" export echo awk then --verbose cd echo local x=1
+x=1 awk export | local export cd cd readonly export
+done $(pwd) export test cd /usr/bin
+		${HOME} x=1 x=1 'quoted text' local then echo
+then $(pwd) done export ${HOME} 2>/dev/null && awk test
+"$1" ${HOME} && $(pwd) "$@" export
+	"$@" ${HOME} printf done | -eu
+		then | done x=1 then local /usr/bin 2>/dev/null then local ${HOME} sed "$@"
+	&& 'quoted text' cd &&
+		local ${HOME} 'quoted text' export test echo local ${HOME}
+$(pwd) "$1" | "$1" local readonly
+echo -eu -eu test local export && 'quoted text'
+	then echo ${HOME} /usr/bin grep export x=1 && 2>/dev/null readonly | awk --verbose
+	done --verbose awk local x=1
+cd 2>/dev/null ${HOME} |
+	local ${HOME} && 2>/dev/null
+		readonly done /usr/bin sed /usr/bin x=1 /usr/bin awk
+	test grep grep 'quoted text' "$1" $(pwd) grep x=1 | done $(pwd)
+printf sed readonly sed echo cd export test cd && /usr/bin awk export echo echo
+		sed -eu done ${HOME} "$1" /usr/bin grep $(pwd) local sed
+		&& $(pwd) test $(pwd) 'quoted text' awk local
+		awk local local /usr/bin test export 'quoted text'
+	test ${HOME} export | then done export local then export -eu export
+readonly x=1 export then ${HOME} readonly 2>/dev/null 'quoted text'
+		export local $(pwd) sed --verbose
+test ${HOME} sed then test "$@"
+		"$1" readonly local 'quoted text' | grep export ${HOME}
+		export test export sed sed done test x=1 test sed $(pwd) cd sed "$@" "$1"
+-eu awk export 'quoted text' $(pwd) x=1 grep 2>/dev/null
+	| grep -eu done $(pwd) then $(pwd) && && grep then | "$@"
+	-eu echo printf "$1" done
+	"$1" -eu -eu "$@" cd done ${HOME} then "$1" | "$@" 'quoted text'
+	export ${HOME} 2>/dev/null echo ${HOME} --verbose grep --verbose
+		"$@" 'quoted text' echo done grep | readonly
+	/usr/bin 'quoted text' 2>/dev/null test cd echo "$@" sed done printf 'quoted text'
+readonly /usr/bin 2>/dev/null $(pwd) cd readonly --verbose && cd && "$@"
+		'quoted text' 2>/dev/null awk readonly awk sed $(pwd) 2>/dev/null cd grep
+		sed readonly | x=1 x=1 readonly 2>/dev/null done test "$1" echo && awk done
+		awk done cd | then -eu
+		| -eu 'quoted text' 2>/dev/null cd && 2>/dev/null /usr/bin --verbose cd awk
+	export echo --verbose then printf echo
+	export $(pwd) printf printf cd sed cd 2>/dev/null awk echo done awk sed
+		&& && 'quoted text' "$@" grep printf local grep then x=1 done local
+readonly && readonly then -eu echo -eu /usr/bin "$1" test
+		&& local test /usr/bin cd export awk 2>/dev/null then sed cd awk export 2>/dev/null
+		&& done $(pwd) then 2>/dev/null done sed --verbose "$1"
+"$1" -eu then x=1 echo && done test printf
+/usr/bin --verbose $(pwd) echo awk "$1" then printf printf export done awk
+'quoted text' export sed cd 2>/dev/null grep echo
+		cd test -eu --verbose echo awk "$1" readonly
+		| $(pwd) echo $(pwd) ${HOME} "$1" 'quoted text' ${HOME}
+	cd 2>/dev/null --verbose local
+		cd readonly local test export export --verbose export local export && "$@" echo
+		readonly then printf echo 2>/dev/null local awk x=1
+	${HOME} export awk "$@" -eu $(pwd) printf export
+"$1" cd awk sed $(pwd) $(pwd) /usr/bin local sed
+echo awk printf echo grep grep "$1" $(pwd) readonly sed
+		"$1" x=1 cd export export printf 'quoted text' ${HOME} ${HOME} awk sed
+	awk $(pwd) "$@" printf --verbose && && echo "$@" $(pwd) && ${HOME} local x=1 "$@"
+		'quoted text' done && 2>/dev/null printf
+	sed 'quoted text' ${HOME} 'quoted text' 2>/dev/null
+printf done --verbose awk printf "$1" export --verbose
+	"$@" done readonly printf grep grep -eu test 'quoted text'
+	done 2>/dev/null $(pwd) cd export "$1" local
+		"$@" && && --verbose 2>/dev/null 'quoted text'
+done /usr/bin 2>/dev/null -eu && 'quoted text' done
+		then export && 2>/dev/null
+'quoted text' && printf sed "$1" grep
+printf ${HOME} ${HOME} then sed
+		"$1" sed -eu readonly local 2>/dev/null printf -eu "$1" x=1
+		grep ${HOME} "$@" /usr/bin echo
+		"$1" grep grep done -eu && cd x=1 export
+	readonly ${HOME} 'quoted text' sed 2>/dev/null
+		cd ${HOME} x=1 export awk echo then ${HOME}
+		echo cd done ${HOME} printf
+	-eu export --verbose --verbose /usr/bin ${HOME} test | 'quoted text'
+	'quoted text' cd 2>/dev/null awk then $(pwd) | "$1" readonly export /usr/bin
+	x=1 sed $(pwd) | $(pwd) local -eu 2>/dev/null | local printf cd awk x=1 then
+		test sed cd done awk -eu sed export /usr/bin --verbose 2>/dev/null
+then grep export $(pwd)
+		grep "$@" "$@" printf echo && printf -eu --verbose cd awk -eu
+	/usr/bin x=1 -eu grep x=1 then echo readonly done export /usr/bin 2>/dev/null
+echo echo ${HOME} echo cd done
+		"$1" ${HOME} cd | "$1" x=1 $(pwd) && && $(pwd)
+&& local echo echo sed cd readonly
+		awk echo echo cd --verbose ${HOME} readonly
+	$(pwd) cd echo then sed readonly readonly printf | ${HOME} awk grep
+	'quoted text' && -eu done $(pwd) printf echo done local "$1" awk test 'quoted text'
+	test readonly 2>/dev/null ${HOME} cd readonly sed export -eu
+	then $(pwd) done ${HOME} grep && cd export
+"$@" then awk grep readonly
+		--verbose printf "$1" readonly "$@" readonly done ${HOME} && then cd $(pwd) grep
+		export sed && cd export export --verbose
+	readonly printf "$@" 2>/dev/null "$@" readonly sed done cd &&
+cd echo echo && | sed done test /usr/bin done -eu export x=1 export ${HOME} 2>/dev/null
+${HOME} then "$1" sed -eu x=1 echo cd -eu echo | /usr/bin
+	--verbose grep "$1" --verbose
+	2>/dev/null -eu done sed
+		local /usr/bin printf ${HOME}
+	cd | local awk $(pwd) awk && $(pwd) then 2>/dev/null printf "$@" grep 'quoted text'
+		readonly -eu /usr/bin "$@" done awk 'quoted text'
+		| sed printf awk then && $(pwd) "$1" then /usr/bin grep cd
+readonly ${HOME} local $(pwd) done --verbose
+$(pwd) sed sed -eu $(pwd) awk /usr/bin local --verbose test --verbose x=1 "$@" then
+	echo awk 2>/dev/null grep x=1 export
+done && then echo --verbose cd local local
+	'quoted text' then sed ${HOME} awk 'quoted text' "$1" export
+-eu -eu sed sed echo "$1" local cd then $(pwd) readonly local /usr/bin test
+	then | echo export sed cd "$1" "$@" local test
+$(pwd) 'quoted text' printf readonly done $(pwd) | echo
+	| -eu grep && done done grep export 2>/dev/null export ${HOME} sed
+		${HOME} done "$@" then then
+	--verbose --verbose sed "$1" --verbose --verbose ${HOME} 2>/dev/null local
+test cd echo --verbose sed ${HOME} cd then cd awk
+	| && x=1 /usr/bin sed | --verbose $(pwd) -eu --verbose readonly export printf
+	| ${HOME} done awk 'quoted text' awk "$1" export echo echo | 2>/dev/null local
+	2>/dev/null -eu $(pwd) -eu $(pwd) done export &&
+		export 2>/dev/null /usr/bin
+	printf -eu readonly "$@" -eu ${HOME} 2>/dev/null done
+readonly -eu then && cd --verbose then 2>/dev/null
+	then "$1" "$1" "$1" printf echo x=1 awk echo ${HOME} readonly
+done /usr/bin awk printf /usr/bin echo x=1 printf
+		test | --verbose then grep export then x=1 | done ${HOME} test then -eu "$@" awk
+	echo printf /usr/bin "$1" 2>/dev/null
+	-eu /usr/bin local 'quoted text' 2>/dev/null && sed -eu then test
+		cd ${HOME} 2>/dev/null
+/usr/bin export then done done -eu test done echo
+"$@" test test /usr/bin $(pwd) done echo 'quoted text' readonly -eu ${HOME}
+		${HOME} 2>/dev/null "$1" "$1" done awk grep /usr/bin | /usr/bin cd && 'quoted text'
+--verbose export --verbose readonly grep readonly "$1" | && && && /usr/bin
+	local sed test --verbose readonly ${HOME} --verbose ${HOME} 'quoted text'
+		sed printf -eu printf && cd awk ${HOME} then $(pwd) x=1 readonly grep done ${HOME}
+		/usr/bin -eu && readonly ${HOME} "$@" ${HOME} echo "$@"
+	x=1 then -eu done echo x=1 --verbose
+	awk sed && -eu then echo sed "$1" echo --verbose
+	x=1 "$1" $(pwd) -eu local echo "$1"
+test test /usr/bin -eu 'quoted text'
+-eu local echo && printf sed awk readonly
+export printf export done
+	then x=1 awk 'quoted text' done $(pwd) -eu readonly 2>/dev/null
+	test printf cd -eu grep ${HOME} --verbose
+'quoted text' cd "$@" test --verbose echo $(pwd) | local |
+	grep awk echo --verbose 'quoted text' cd | cd readonly done $(pwd) cd
+"$1" echo -eu x=1 printf sed readonly 'quoted text' sed sed
+printf ${HOME} then export 'quoted text'
+	test export grep x=1 sed then x=1 /usr/bin 2>/dev/null test --verbose
+		/usr/bin 'quoted text' --verbose ${HOME} x=1 /usr/bin "$@" "$1" /usr/bin done
+		then local -eu x=1 x=1 printf
+		"$1" 'quoted text' "$@" && test x=1 2>/dev/null then cd ${HOME} export
+readonly export ${HOME} 'quoted text' $(pwd)
+		/usr/bin /usr/bin -eu -eu awk
+sed printf 2>/dev/null grep "$@" done
+		"$1" x=1 local readonly grep
+	then x=1 export && 2>/dev/null echo | x=1 grep then done printf done local
+2>/dev/null 2>/dev/null 'quoted text' | 'quoted text' "$@" | x=1 cd /usr/bin
+	test awk 'quoted text' sed |
+		sed && printf /usr/bin echo ${HOME} --verbose
+		2>/dev/null local then export sed -eu test "$@" test "$@" "$@" local
+cd ${HOME} && awk ${HOME} grep readonly "$1" sed done export "$@" awk sed /usr/bin
+	echo done x=1 readonly done 2>/dev/null -eu printf 2>/dev/null "$1" then
+	--verbose echo | done
+local ${HOME} grep then printf
+		$(pwd) cd | "$@" 2>/dev/null readonly grep awk sed && test $(pwd) export 'quoted text'
+	2>/dev/null cd cd grep && test echo x=1
+	--verbose /usr/bin $(pwd) local /usr/bin
+$(pwd) cd printf then | export
+"$1" printf x=1 "$@" && "$@" ${HOME} sed
+"$@" local export 'quoted text'
+echo x=1 then 2>/dev/null export | | echo readonly ${HOME} echo
+	"$@" echo && printf $(pwd) printf grep --verbose then local
+	$(pwd) ${HOME} --verbose $(pwd)
+cd $(pwd) printf x=1 printf printf x=1 ${HOME} "$1" grep | printf "$1" export echo
+readonly /usr/bin /usr/bin $(pwd) grep export | readonly &&
+		echo /usr/bin | 'quoted text' done local printf then echo
+	local sed | 2>/dev/null --verbose cd export echo cd awk 2>/dev/null "$1" /usr/bin
+x=1 x=1 "$1" test done /usr/bin export
+x=1 x=1 ${HOME} "$1" x=1 grep | "$1" cd cd awk then sed echo grep
+	test && grep cd $(pwd)
+		test /usr/bin && test | "$@" -eu export printf
+${HOME} "$@" /usr/bin awk /usr/bin 2>/dev/null readonly
+	test --verbose then test export
+local x=1 done cd sed local done x=1 echo printf awk | then $(pwd) --verbose
+	grep echo awk echo sed --verbose 'quoted text'
+2>/dev/null $(pwd) export readonly done /usr/bin awk grep $(pwd) local test
+printf | && echo --verbose
+	-eu awk readonly --verbose $(pwd) cd 'quoted text' $(pwd)
+	x=1 --verbose "$1" done "$@" --verbose "$1" export /usr/bin sed
+		readonly && -eu | export $(pwd) 'quoted text' && /usr/bin /usr/bin
+	sed -eu $(pwd) test echo ${HOME} grep test "$1" local 2>/dev/null
+	| readonly local "$@" "$1" readonly x=1 /usr/bin | $(pwd) cd $(pwd) 'quoted text'
+	&& && awk readonly &&
+${HOME} ${HOME} local done local cd $(pwd)
+| ${HOME} local echo printf -eu "$@" test then test awk x=1
+		done && then --verbose echo grep readonly &&
+	awk "$1" && export --verbose --verbose && echo "$1" cd "$@" then
+$(pwd) --verbose /usr/bin
+		local 2>/dev/null export x=1 sed && grep -eu "$@"
+-eu grep --verbose test then | --verbose
+echo ${HOME} readonly "$@" 2>/dev/null x=1 readonly $(pwd) grep
+	test 2>/dev/null /usr/bin && && export awk "$1" x=1 grep
+	"$1" local -eu -eu sed
+printf test done /usr/bin grep -eu echo
+	awk grep cd --verbose $(pwd) test grep
+	grep x=1 grep && local awk cd -eu x=1 sed readonly
+	test "$@" /usr/bin done /usr/bin done /usr/bin awk grep ${HOME}
+		cd export readonly awk ${HOME} "$@" printf printf "$1"
+	--verbose done test then ${HOME} -eu ${HOME} grep "$1"
+	'quoted text' test cd --verbose
+	2>/dev/null readonly then --verbose 'quoted text' local 'quoted text' then
+readonly ${HOME} -eu ${HOME} "$1" 'quoted text'
+readonly x=1 $(pwd) "$@" "$@" grep -eu grep
+		${HOME} sed cd grep 'quoted text'
+		echo done awk "$1" printf readonly
+--verbose 'quoted text' "$1" | grep test x=1 export done grep -eu "$1"
+	$(pwd) && x=1 sed cd "$@" $(pwd) /usr/bin "$@" grep
+		done | done readonly export awk ${HOME} "$@" $(pwd) /usr/bin
+		"$1" local local "$@" | -eu && grep -eu done printf "$1"
+		"$1" "$@" "$@" local then awk /usr/bin -eu test
+cd "$@" --verbose 'quoted text' cd grep readonly /usr/bin
+&& sed awk $(pwd) printf export test cd printf awk grep && && /usr/bin
+		cd -eu cd printf cd then $(pwd) "$@" awk test echo local "$@" /usr/bin test done
+		readonly --verbose then awk ${HOME} grep readonly 'quoted text'
+		--verbose | && && "$@" printf sed readonly awk then 2>/dev/null awk
+	"$1" x=1 then awk awk
+${HOME} | then done export cd "$@" -eu -eu && done --verbose 'quoted text'
+	2>/dev/null awk -eu 2>/dev/null sed printf then done then grep cd -eu
+	| echo "$1" done /usr/bin test ${HOME} printf -eu
+done export local done "$@"
+	then $(pwd) --verbose /usr/bin $(pwd) echo cd awk
+	"$1" export echo 2>/dev/null -eu
+--verbose $(pwd) $(pwd) awk ${HOME} cd sed local cd done done awk done 2>/dev/null
+	awk printf --verbose sed sed x=1 $(pwd)
+	| && local && --verbose printf "$@" && test test readonly cd awk 2>/dev/null
+	grep readonly | /usr/bin /usr/bin $(pwd) export
+	'quoted text' && echo 2>/dev/null
+	&& /usr/bin ${HOME} then |
+		"$1" sed "$@" "$@" cd done ${HOME} done grep
+		sed /usr/bin -eu ${HOME} -eu readonly done cd
+	x=1 grep x=1 export 'quoted text' readonly printf then then $(pwd) $(pwd) cd
+export $(pwd) /usr/bin grep export sed "$1" sed
+		--verbose x=1 export && awk "$1" export --verbose ${HOME} $(pwd) test 2>/dev/null
+	test "$@" local $(pwd) grep -eu "$@" | local "$1" sed 'quoted text' export
+		then readonly test export /usr/bin then -eu echo test export && local test 2>/dev/null
+	$(pwd) local then x=1 then "$@" printf awk "$1" $(pwd) grep
+	printf | /usr/bin /usr/bin && "$1" export
+	$(pwd) "$1" echo /usr/bin x=1 && then -eu echo export readonly x=1
+awk cd readonly "$1" ${HOME} echo
+	then export export 2>/dev/null
+--verbose cd 2>/dev/null test "$@" then --verbose $(pwd) 2>/dev/null "$@" sed /usr/bin
+		$(pwd) done test $(pwd) | 'quoted text' readonly ${HOME} --verbose
+&& | x=1 readonly x=1 sed readonly $(pwd) && $(pwd)
+--verbose printf cd cd local | "$@" echo test
+	awk sed printf readonly $(pwd)
+	awk grep x=1 $(pwd) test $(pwd) then local printf $(pwd) export
+'quoted text' 'quoted text' "$@" "$1" done ${HOME}
+	then test awk sed cd then
+	sed readonly ${HOME} local echo test readonly local /usr/bin grep $(pwd) --verbose
+		/usr/bin /usr/bin local readonly 2>/dev/null test printf grep echo export
+	'quoted text' $(pwd) sed cd test awk $(pwd) grep x=1 'quoted text'
+local 'quoted text' local
+		awk "$1" readonly printf "$@" && x=1 "$1" awk ${HOME} -eu grep readonly sed
+		test done "$1" "$@" --verbose /usr/bin test |
+		${HOME} grep local readonly then grep ${HOME}
+sed "$@" "$@" cd printf readonly test -eu x=1
+	grep local --verbose 2>/dev/null -eu local then grep grep x=1 readonly
+	echo "$1" local done cd local then $(pwd) "$@" then
+	test --verbose && test 'quoted text' echo 'quoted text' echo echo && $(pwd)
+		${HOME} 'quoted text' "$1" cd done "$@" local
+		-eu sed x=1 --verbose cd awk $(pwd) readonly readonly | &&
+	export cd export echo -eu sed "$1" "$@" local test x=1 $(pwd)
+		grep awk x=1 ${HOME} /usr/bin
+"$@" "$1" /usr/bin --verbose $(pwd)
+"$@" local cd ${HOME} export --verbose grep ${HOME} local cd "$@" awk
+&& /usr/bin 'quoted text' x=1 grep ${HOME} ${HOME} 'quoted text' printf 'quoted text'
+		sed then done && readonly echo --verbose
+	| done sed -eu -eu then x=1 -eu then printf | readonly
+	/usr/bin echo echo -eu done | -eu && 'quoted text' "$1" /usr/bin done x=1 grep |
+done /usr/bin test readonly printf 2>/dev/null sed
+local sed | "$1" sed grep | -eu local readonly echo --verbose
+	'quoted text' "$1" export cd
+	local local 'quoted text' awk sed export then 2>/dev/null
+		echo grep local $(pwd) ${HOME} sed export then
+readonly ${HOME} "$@" | cd --verbose "$1" printf
+	&& "$1" $(pwd) echo done -eu --verbose && local done x=1 x=1 sed $(pwd)
+--verbose printf readonly sed -eu export test 2>/dev/null "$1" ${HOME}
+local 2>/dev/null 2>/dev/null -eu 2>/dev/null echo $(pwd) sed
+		"$1" echo export printf test ${HOME} 2>/dev/null test 'quoted text'
+printf grep grep -eu export | "$1" done $(pwd) && cd --verbose
+test --verbose local test "$1" --verbose done x=1 grep 'quoted text' awk
+&& 'quoted text' 'quoted text' $(pwd)
+printf x=1 ${HOME} echo ${HOME} local $(pwd) printf export 2>/dev/null cd ${HOME}
+		"$@" /usr/bin awk echo 2>/dev/null
+	sed "$1" 'quoted text' && ${HOME}
+	echo done then then done printf -eu cd -eu -eu export echo "$1"
+'quoted text' /usr/bin test export "$1" | local
+'quoted text' /usr/bin test awk export 'quoted text' ${HOME} "$1"
+		printf grep test then -eu test test "$@" && 2>/dev/null
+	-eu 'quoted text' /usr/bin && readonly readonly ${HOME} readonly cd 2>/dev/null
+${HOME} awk x=1 ${HOME} test && echo x=1 awk readonly && -eu readonly x=1 -eu
+		x=1 local readonly done then grep export && $(pwd) "$@" -eu
+cd printf $(pwd) 'quoted text' done 'quoted text' "$@" "$1" test /usr/bin
+-eu cd awk 2>/dev/null "$1" ${HOME} "$1" | /usr/bin "$@" printf
+	2>/dev/null cd awk "$1" ${HOME} x=1 'quoted text' readonly
+done --verbose export "$1" 2>/dev/null grep
+2>/dev/null awk grep "$@" awk /usr/bin export export
+2>/dev/null printf | then -eu local --verbose /usr/bin x=1
+/usr/bin -eu "$@" $(pwd)
+'quoted text' --verbose x=1 && then export test "$@" readonly x=1 --verbose
+		printf export 2>/dev/null 'quoted text' /usr/bin sed ${HOME}
+		${HOME} printf test ${HOME} "$1" readonly 'quoted text'
+		printf "$@" | done "$1" then -eu
@@ -0,0 +1,2001 @@
+		"$@" "$1" local export | test && "$1" -eu --verbose echo sed test -eu then
+	then 'quoted text' export done -eu "$@" echo awk -eu -eu export printf
+	'quoted text' printf sed ${HOME} local ${HOME} ${HOME} export
+	export export export "$@"
+	&& sed ${HOME} $(pwd) sed grep done x=1 --verbose export
+-eu --verbose 'quoted text' "$@" cd && "$@" then printf
+	then $(pwd) && -eu export sed test && x=1 done
+		-eu "$@" --verbose | grep sed x=1 ${HOME}
+${HOME} awk && test local export --verbose $(pwd) echo awk x=1 "$1" readonly
+	cd "$@" awk printf cd echo then printf | /usr/bin
+readonly ${HOME} 'quoted text' -eu cd awk then echo awk 2>/dev/null
+		&& local awk $(pwd) cd awk && then | then awk -eu sed
+	echo -eu --verbose && readonly x=1 grep && /usr/bin && local /usr/bin
+printf test && "$@" x=1
+	cd "$1" /usr/bin then 2>/dev/null && | "$1" grep /usr/bin
+sed then local ${HOME} local local 'quoted text' 'quoted text' printf "$@" $(pwd)
+		--verbose readonly cd 'quoted text' | local && $(pwd) /usr/bin /usr/bin
+| /usr/bin ${HOME} echo
+	--verbose sed && "$@" "$1" --verbose test $(pwd) export -eu
+		-eu export then 2>/dev/null
+then done x=1 x=1 && then readonly done "$1"
+		-eu "$1" "$1" "$@" 2>/dev/null grep cd ${HOME}
+	grep --verbose then "$@" export "$@" local export
+		x=1 && printf cd "$@" printf grep sed sed done
+		echo grep "$@" ${HOME} local grep x=1 printf sed done "$@" then && test test done
+	$(pwd) cd "$@" $(pwd) /usr/bin printf && readonly
+		cd 'quoted text' 'quoted text' --verbose export grep "$1" local x=1 sed grep
+		/usr/bin 2>/dev/null echo --verbose readonly "$@" -eu $(pwd) sed x=1 test
+	then "$1" x=1 echo done done echo x=1 echo awk
+/usr/bin readonly ${HOME} local 2>/dev/null x=1 echo 'quoted text' grep
+	"$@" readonly && test && x=1 "$@" export
+		readonly sed --verbose 'quoted text'
+then export 'quoted text' readonly -eu printf
+		done cd $(pwd) x=1 "$1" sed printf done $(pwd)
+	'quoted text' --verbose | done test "$@" ${HOME} 2>/dev/null then
+	printf 'quoted text' awk && echo "$@" local grep done
+export test --verbose |
+-eu 'quoted text' sed 2>/dev/null && grep grep local sed ${HOME} $(pwd) && -eu test
+&& $(pwd) --verbose "$1" "$1" local -eu 'quoted text'
+	"$1" awk "$1" $(pwd) cd --verbose local done "$1" printf 'quoted text'
+		--verbose cd cd done && export sed "$@" /usr/bin | printf
+x=1 x=1 -eu then grep --verbose
+done done cd export /usr/bin echo x=1
+--verbose && sed readonly awk $(pwd) cd awk grep
+		-eu 'quoted text' echo 2>/dev/null cd $(pwd) && "$@" done 2>/dev/null printf
+		2>/dev/null local ${HOME} cd then 2>/dev/null
+	grep $(pwd) readonly "$1" local then | echo then /usr/bin echo "$@"
+export -eu sed test local 'quoted text' /usr/bin
+	$(pwd) local --verbose then printf echo then local then 2>/dev/null
+	test export grep -eu /usr/bin
+		readonly && cd 2>/dev/null then cd cd 2>/dev/null "$@" $(pwd)
+		local 2>/dev/null then then cd echo then "$1" $(pwd) /usr/bin
+then && 2>/dev/null --verbose
+		export done then export /usr/bin done grep cd && 'quoted text'
+	"$1" echo "$1" 'quoted text' printf $(pwd) x=1 2>/dev/null 'quoted text'
+	test "$1" /usr/bin local && printf && -eu local ${HOME} ${HOME} grep
+sed test && then test --verbose
+then "$1" local -eu local | grep "$1" && grep local 2>/dev/null "$1" grep
+	done test grep x=1 && 2>/dev/null --verbose export "$@" test $(pwd) cd done
+$(pwd) -eu | export awk x=1 done sed grep "$1" then printf test "$1" grep
+		awk -eu grep "$1" done --verbose
+	| "$1" echo echo test cd
+	--verbose cd $(pwd) "$1" grep echo --verbose
+		awk | export "$@" sed 2>/dev/null
+		$(pwd) 'quoted text' 2>/dev/null ${HOME} grep 2>/dev/null
+x=1 ${HOME} ${HOME} awk echo && cd printf /usr/bin readonly $(pwd) echo
+		&& local "$1" -eu local "$@" echo 2>/dev/null done awk --verbose done export
+		readonly /usr/bin --verbose -eu local
+		/usr/bin ${HOME} sed 2>/dev/null sed grep
+	&& awk --verbose "$@" | sed printf cd $(pwd) printf cd && 'quoted text'
+		test readonly x=1 $(pwd) x=1 ${HOME} ${HOME} grep sed cd /usr/bin && echo
+	2>/dev/null ${HOME} readonly then ${HOME} export
+grep /usr/bin --verbose then cd printf readonly
+	${HOME} test local "$@" cd $(pwd)
+		${HOME} export "$@" readonly | awk export 'quoted text' ${HOME}
+	"$1" 2>/dev/null export then "$1" $(pwd) awk cd test "$1" cd grep export test
+	${HOME} | awk ${HOME} cd sed /usr/bin then sed x=1
+		$(pwd) "$@" "$@" local done ${HOME} done readonly then done printf
+echo test local echo 2>/dev/null echo ${HOME} readonly
+	local local awk ${HOME} "$@" /usr/bin /usr/bin test /usr/bin
+	$(pwd) echo export cd readonly local cd sed /usr/bin
+	${HOME} done --verbose test grep readonly && -eu readonly cd | export
+		"$1" && done then "$1" then
+		readonly "$@" export readonly "$@" 'quoted text' sed --verbose
+		x=1 then echo && x=1 cd
+	-eu echo ${HOME} --verbose -eu cd echo
+	$(pwd) export "$1" -eu awk local awk ${HOME} cd $(pwd) /usr/bin grep && sed cd $(pwd)
+		2>/dev/null printf 'quoted text' sed 'quoted text'
+2>/dev/null printf ${HOME} awk 'quoted text' --verbose
+test export --verbose grep --verbose "$@" --verbose "$@" && | test readonly
+		x=1 --verbose -eu "$1" | "$@" local grep 'quoted text' done
+	2>/dev/null grep local $(pwd) sed && ${HOME} local
+	awk awk echo done cd | $(pwd)
+| awk x=1 $(pwd) printf export then local 'quoted text' export 'quoted text'
+	"$@" 2>/dev/null printf printf 2>/dev/null
+		'quoted text' local test test $(pwd) --verbose readonly 2>/dev/null
+		sed x=1 sed x=1 awk && -eu 'quoted text' awk echo 2>/dev/null
+--verbose grep local $(pwd) "$1" test x=1 'quoted text' export readonly "$1" &&
+	--verbose echo sed export "$@" 2>/dev/null -eu printf done
+	| "$@" export 'quoted text' -eu "$1" 'quoted text' --verbose
+		local x=1 && export | | 'quoted text' x=1 echo done cd then local sed sed "$@"
+		"$@" "$@" -eu readonly 'quoted text' 2>/dev/null
+test local readonly cd 'quoted text'
+	-eu | sed /usr/bin && readonly /usr/bin ${HOME} awk x=1 "$@" -eu export 'quoted text'
+		"$@" && grep export ${HOME} &&
+		"$1" "$@" --verbose 'quoted text' x=1 grep echo
+	sed -eu | awk && 2>/dev/null echo cd then grep sed readonly
+	/usr/bin cd echo "$@" test --verbose "$1" grep "$1" readonly
+		-eu "$@" cd readonly -eu done test && cd x=1
+sed --verbose sed sed cd -eu --verbose /usr/bin test readonly cd x=1 printf
+	export | done readonly "$1" ${HOME} ${HOME} export "$1"
+		-eu export echo readonly
+		local sed export && sed
+	printf "$1" x=1 && "$@" $(pwd) "$1"
+x=1 $(pwd) 2>/dev/null 2>/dev/null 2>/dev/null echo && /usr/bin
+		'quoted text' cd grep "$1" /usr/bin readonly readonly "$1" | done
+	export --verbose $(pwd) grep "$1" test done $(pwd) sed grep x=1 "$1" readonly
+/usr/bin sed sed /usr/bin echo then 2>/dev/null x=1 readonly $(pwd) -eu
+	-eu readonly -eu "$@" x=1 export --verbose /usr/bin export
+| sed sed test 'quoted text' 2>/dev/null
+		then then -eu "$@" export done printf "$1" printf then "$@"
+export && && /usr/bin $(pwd) "$@" printf awk then
+--verbose printf -eu -eu --verbose readonly
+"$@" awk awk grep && x=1 "$1" cd x=1 -eu /usr/bin
+	'quoted text' local 'quoted text' x=1 grep
+		'quoted text' $(pwd) cd "$@" | 'quoted text' x=1 --verbose then | test
+then cd grep readonly awk then cd "$@" && cd "$1" echo 'quoted text'
+	$(pwd) --verbose done "$1" x=1 cd && sed printf |
+		--verbose printf cd local sed -eu cd awk "$1"
+	| x=1 "$1" -eu done -eu test then local && cd echo 2>/dev/null /usr/bin awk
+-eu export export then $(pwd) echo sed printf ${HOME} printf "$1" readonly
+	cd "$@" printf $(pwd) done x=1 -eu 2>/dev/null sed | -eu printf
+test done awk | then 'quoted text' "$1" local x=1
+	awk test | --verbose grep &&
+		--verbose /usr/bin "$@" $(pwd) readonly
+	"$1" -eu grep x=1 export && awk printf x=1 | 'quoted text' local
+		$(pwd) && then then awk sed test grep grep && cd
+		--verbose test "$1" "$@" 2>/dev/null "$@" test test awk |
+	done cd sed 2>/dev/null
+	--verbose x=1 printf 2>/dev/null readonly "$@"
+awk && then 'quoted text' then -eu
+	export 'quoted text' && cd grep export local 'quoted text'
+	&& echo local x=1 sed export cd cd "$@" 2>/dev/null "$@"
+	cd sed export echo 2>/dev/null "$@" test $(pwd) /usr/bin "$@" then readonly
+	local export "$@" awk x=1 x=1 printf
+	/usr/bin grep cd && "$@" ${HOME} test readonly --verbose export
+'quoted text' grep ${HOME} export readonly cd export "$@" sed x=1 export local &&
+awk $(pwd) readonly echo printf readonly then awk "$1" "$@"
+	x=1 -eu done x=1 sed "$1" grep --verbose
+local export "$@" awk /usr/bin cd then
+	"$1" cd cd then awk sed 'quoted text' | "$@" grep test | /usr/bin done
+		cd export --verbose local
+	| 'quoted text' sed sed test cd cd grep
+		grep "$@" "$@" sed then --verbose printf "$@" sed | sed sed
+	$(pwd) export readonly $(pwd) local -eu && then readonly 'quoted text' $(pwd)
+	'quoted text' done grep --verbose
+sed "$@" --verbose then local "$@" && done test echo printf
+	-eu ${HOME} done 'quoted text' /usr/bin
+		local /usr/bin grep x=1 ${HOME} local cd awk -eu | $(pwd)
+		x=1 printf | cd ${HOME}
+		$(pwd) x=1 local $(pwd) test && $(pwd) printf cd
+		x=1 /usr/bin echo echo
+		&& /usr/bin | && export then then sed printf | x=1 "$1"
+	2>/dev/null then printf
+	2>/dev/null --verbose cd done ${HOME} export
+		/usr/bin readonly 2>/dev/null sed readonly --verbose
+		sed sed ${HOME} | 2>/dev/null grep local local then
+"$@" 2>/dev/null x=1 x=1 --verbose test 'quoted text'
+		"$1" test $(pwd) grep local echo done -eu export awk printf -eu -eu
+"$1" "$1" ${HOME} 'quoted text'
+sed x=1 local sed $(pwd) | 'quoted text' "$1"
+		2>/dev/null awk awk x=1 done done
+awk $(pwd) ${HOME} then -eu local
+sed sed sed printf 2>/dev/null grep && local x=1 test x=1 "$@" local sed 2>/dev/null
+		x=1 awk 2>/dev/null $(pwd)
+	printf 'quoted text' done 2>/dev/null "$1" /usr/bin
+		local --verbose && done /usr/bin cd "$1"
+	done cd readonly grep 2>/dev/null 2>/dev/null -eu awk
+$(pwd) "$@" --verbose done sed printf sed --verbose
+	x=1 2>/dev/null grep x=1 cd cd "$1" readonly
+		grep "$@" $(pwd) readonly grep | /usr/bin then cd then
+		"$1" "$1" 'quoted text' grep echo sed sed then echo sed /usr/bin
+export awk cd local "$@" $(pwd) sed printf
+$(pwd) cd export 2>/dev/null cd ${HOME} local cd readonly
+		test -eu readonly sed sed /usr/bin ${HOME}
+	sed "$@" $(pwd) /usr/bin test ${HOME} $(pwd) x=1 2>/dev/null export
+${HOME} sed sed printf done export x=1 --verbose export -eu 'quoted text'
+awk $(pwd) done sed done local done readonly local "$1" 2>/dev/null
+x=1 "$1" "$1" ${HOME} cd 'quoted text' export local --verbose
+	--verbose ${HOME} test then readonly /usr/bin sed printf done
+		done sed local /usr/bin echo export --verbose "$1" x=1 then "$@" $(pwd)
+	| -eu sed ${HOME} local test /usr/bin /usr/bin test done
+	/usr/bin 'quoted text' echo "$@" "$1" export 'quoted text' readonly ${HOME}
+	cd cd echo 'quoted text' $(pwd) -eu test "$@"
+&& export -eu ${HOME} 2>/dev/null done 2>/dev/null done awk ${HOME} /usr/bin
+	${HOME} export readonly cd grep && "$1"
+		| test printf 2>/dev/null echo "$1" readonly && x=1 /usr/bin
+	"$1" done awk $(pwd) sed sed readonly && ${HOME} grep local -eu then done
+	test /usr/bin "$@" | local "$1" then sed echo 2>/dev/null | printf x=1 local echo
+	then grep 'quoted text' --verbose awk "$1" -eu "$@"
+x=1 'quoted text' local local echo /usr/bin export
+-eu --verbose "$1" --verbose
+		| 2>/dev/null cd "$1" printf 2>/dev/null 2>/dev/null
+	$(pwd) grep sed ${HOME} "$1" awk local --verbose
+grep done $(pwd) export "$@" export cd local "$1" printf
+	/usr/bin export printf local 'quoted text' "$1" x=1 /usr/bin cd
+	x=1 | grep then -eu grep x=1 local 2>/dev/null
+		awk ${HOME} $(pwd) "$1" grep awk && echo then export
+		sed local then sed grep 2>/dev/null | test export test
+	'quoted text' grep then echo done printf
+		then --verbose -eu x=1 test printf
+		/usr/bin 'quoted text' x=1 --verbose
+	grep ${HOME} ${HOME} done --verbose sed
+&& sed $(pwd) export "$1" /usr/bin |
+	sed readonly printf --verbose -eu /usr/bin local x=1 --verbose
+		$(pwd) local "$@" readonly -eu -eu then
+	export ${HOME} cd "$1" "$@" -eu cd cd | $(pwd) | | --verbose
+"$@" /usr/bin echo x=1 local | printf /usr/bin sed $(pwd) readonly echo
+	then $(pwd) --verbose "$1" local | sed && local
+	test "$1" "$1" export x=1 echo export echo awk test sed ${HOME} readonly --verbose
+		grep printf echo 'quoted text' then awk grep x=1 readonly
+	-eu cd "$@" -eu | readonly "$@" sed readonly awk
+		/usr/bin echo | 2>/dev/null export grep awk local echo local
+	sed export local 2>/dev/null && grep x=1
+	"$@" | readonly readonly --verbose readonly x=1 test done 2>/dev/null "$@" x=1
+	| then local "$@" 'quoted text' sed local sed | grep 'quoted text'
+printf readonly 'quoted text' awk readonly then /usr/bin 2>/dev/null printf readonly
+		--verbose -eu /usr/bin 'quoted text' grep x=1 echo printf awk | --verbose
+cd readonly --verbose -eu
+	$(pwd) export printf $(pwd) grep readonly x=1 && test sed -eu | /usr/bin
+	printf $(pwd) $(pwd) && cd sed /usr/bin done
+		$(pwd) $(pwd) export cd printf awk then --verbose x=1 awk
+		echo x=1 export 2>/dev/null $(pwd) --verbose /usr/bin cd done cd test echo "$@"
+	/usr/bin -eu echo echo /usr/bin
+		$(pwd) awk then readonly grep "$@" /usr/bin | echo echo sed
+	grep x=1 printf cd "$1"
+	then "$@" && --verbose sed done printf
+-eu readonly && echo awk test export ${HOME}
+2>/dev/null test -eu readonly | && $(pwd) sed sed "$@" | ${HOME} sed 2>/dev/null
+${HOME} awk /usr/bin x=1 2>/dev/null ${HOME}
+cd then "$@" echo && 2>/dev/null
+		"$1" | ${HOME} grep printf --verbose
+	&& ${HOME} -eu test /usr/bin /usr/bin "$@" ${HOME}
+	printf echo /usr/bin $(pwd) cd sed --verbose 'quoted text' ${HOME}
+	grep -eu export && sed 'quoted text' x=1 && printf grep && local
+echo ${HOME} then --verbose local sed && awk echo
+export export local readonly $(pwd)
+	/usr/bin printf "$@" x=1 done grep
+printf test "$1" printf then ${HOME}
+		"$@" /usr/bin awk readonly awk
+readonly local grep sed /usr/bin
+sed "$@" 2>/dev/null grep local 'quoted text'
+		sed grep cd | | /usr/bin x=1 cd $(pwd)
+		-eu /usr/bin 'quoted text' ${HOME} -eu 2>/dev/null "$@"
+		x=1 printf test sed readonly export echo cd awk test --verbose
+	'quoted text' sed && -eu test "$@" | | "$1" printf "$@" 'quoted text' grep
+		$(pwd) $(pwd) echo then sed awk awk awk done /usr/bin
+		sed "$1" "$1" cd x=1 export "$1" "$@"
+	"$1" sed then "$@" ${HOME}
+		| ${HOME} printf x=1 cd cd "$@" then test echo "$@" local x=1 | "$@" | --verbose
+	sed -eu grep readonly | then 'quoted text' ${HOME} "$@" --verbose --verbose
+sed awk 2>/dev/null done echo local 'quoted text' -eu readonly 'quoted text'
+		cd "$1" readonly 2>/dev/null "$1"
+	awk -eu ${HOME} local then export export cd readonly export x=1 cd -eu |
+		$(pwd) ${HOME} then sed
+	x=1 local test grep awk grep
+2>/dev/null cd cd /usr/bin
+	'quoted text' then --verbose "$@" "$@" sed ${HOME} ${HOME} x=1 local
+	done 'quoted text' | readonly | "$@" $(pwd) x=1 local | x=1
+		local --verbose "$1" test export readonly
+"$1" x=1 cd --verbose then printf -eu $(pwd)
+		| x=1 x=1 "$1" $(pwd) echo --verbose export export ${HOME}
+local cd sed /usr/bin test && then
+	printf x=1 printf 2>/dev/null cd grep "$@" export
+done then | readonly $(pwd) then && test 2>/dev/null 'quoted text'
+	/usr/bin awk 'quoted text' then ${HOME} then
+		/usr/bin sed ${HOME} printf sed 2>/dev/null local export awk "$1" -eu
+"$1" && export --verbose sed --verbose echo grep grep test done readonly readonly
+	${HOME} /usr/bin then echo readonly -eu && 'quoted text'
+"$@" done awk grep $(pwd) then test local 2>/dev/null -eu done 2>/dev/null
+		local x=1 grep $(pwd) sed sed 'quoted text' "$1" readonly
+		x=1 readonly $(pwd) -eu cd printf && awk printf && sed test 'quoted text'
+	x=1 echo export --verbose done $(pwd) --verbose
+	awk --verbose | "$@" local done "$1" -eu "$1" done export
+	x=1 then "$@" test -eu $(pwd) 2>/dev/null -eu readonly export then "$1"
+		grep printf "$@" awk "$1" x=1 sed done test awk export | | test cd
+cd printf -eu grep local then "$@" && echo --verbose
+	"$@" local | readonly
+-eu --verbose "$@" --verbose && --verbose test /usr/bin "$1" 'quoted text' local
+export /usr/bin /usr/bin -eu
+	-eu /usr/bin "$1" && readonly
+		echo ${HOME} "$1" printf echo -eu done "$@" ${HOME} ${HOME} awk "$@" test
+done 2>/dev/null | "$1" $(pwd)
+--verbose ${HOME} printf sed then ${HOME} readonly cd $(pwd) x=1 grep local
+		&& && sed 2>/dev/null && then cd | test /usr/bin local export ${HOME} printf
+	local 'quoted text' awk "$@" --verbose | $(pwd) done done cd "$1" done export
+readonly $(pwd) | sed /usr/bin
+'quoted text' 2>/dev/null awk "$1" ${HOME} 'quoted text' printf
+sed ${HOME} && readonly local /usr/bin local printf export
+	then && cd grep x=1 test local /usr/bin cd 2>/dev/null ${HOME}
+	2>/dev/null | 2>/dev/null $(pwd) printf local
+	$(pwd) -eu "$1" export --verbose && --verbose
+/usr/bin | x=1 grep export echo test sed grep 2>/dev/null cd ${HOME} test ${HOME}
+	x=1 printf export export x=1 /usr/bin --verbose done done test 'quoted text'
+		"$@" grep ${HOME} && local -eu x=1 done "$1" | 'quoted text'
+	done && export ${HOME}
+	sed local readonly awk $(pwd) grep 'quoted text' echo -eu "$1" awk $(pwd)
+	'quoted text' printf local 'quoted text' 2>/dev/null local
+	cd cd x=1 echo printf ${HOME} | grep awk x=1 |
+		&& ${HOME} && && cd ${HOME} done grep --verbose then export readonly /usr/bin
+x=1 printf sed 2>/dev/null x=1
+		readonly "$@" -eu --verbose awk && echo echo sed --verbose 2>/dev/null
+	/usr/bin readonly | export ${HOME}
+2>/dev/null "$1" "$@" awk | grep local -eu /usr/bin
+"$1" echo printf 2>/dev/null then ${HOME}
+	&& export 2>/dev/null x=1 && readonly export
+		--verbose sed printf readonly
+		| done local 'quoted text' awk local "$1" "$1" test ${HOME}
+		/usr/bin x=1 "$@" -eu "$1" cd x=1 test -eu -eu cd
+&& | export then 2>/dev/null | /usr/bin
+	test x=1 $(pwd) --verbose "$@" "$@" | --verbose
+then "$@" ${HOME} 'quoted text' x=1 printf 'quoted text' sed
+awk "$1" cd ${HOME} export done awk export then "$@"
+	-eu then sed x=1 2>/dev/null sed ${HOME} | -eu
+	| "$1" awk done readonly readonly
+		cd cd 'quoted text' | && readonly ${HOME}
+		${HOME} | sed $(pwd) -eu sed cd then
+		| ${HOME} awk awk /usr/bin --verbose && /usr/bin --verbose "$@" sed readonly
+'quoted text' sed "$1" grep done --verbose ${HOME} cd | printf ${HOME}
+-eu 2>/dev/null echo ${HOME} awk /usr/bin 2>/dev/null | local
+	grep echo export done echo && 2>/dev/null
+	&& cd done $(pwd) readonly
+		then --verbose 2>/dev/null x=1 x=1 "$1" /usr/bin /usr/bin
+		sed export 'quoted text' --verbose done --verbose cd "$1"
+		test && grep grep --verbose "$1" "$1" readonly $(pwd) $(pwd) | && | /usr/bin
+	cd 2>/dev/null echo cd export export $(pwd) sed test readonly then ${HOME}
+${HOME} ${HOME} x=1 export done "$1" done /usr/bin readonly local | local
+'quoted text' grep && grep | && printf
+		/usr/bin "$@" test done 'quoted text' test 2>/dev/null /usr/bin "$1"
+export && test $(pwd) export | /usr/bin 'quoted text' /usr/bin
+	x=1 ${HOME} && then && 2>/dev/null readonly $(pwd) done
+readonly x=1 $(pwd) grep "$@" "$@" printf ${HOME} ${HOME}
+	x=1 x=1 grep /usr/bin done -eu /usr/bin readonly
+--verbose printf echo $(pwd) x=1 2>/dev/null 'quoted text'
+| 2>/dev/null | cd echo x=1 printf "$@" -eu awk local "$@" x=1 export ${HOME} --verbose
+		2>/dev/null -eu --verbose "$@"
+/usr/bin 'quoted text' sed
+		readonly $(pwd) then ${HOME}
+		export then 2>/dev/null && grep x=1 'quoted text' 2>/dev/null 2>/dev/null
+test -eu cd test x=1 "$1" printf readonly && done then 'quoted text'
+"$1" && $(pwd) x=1 test --verbose test echo then
+		--verbose then local | done echo sed printf then 2>/dev/null --verbose /usr/bin
+	$(pwd) $(pwd) local local done echo printf ${HOME}
+		cd 'quoted text' then 'quoted text'
+		2>/dev/null "$@" then | done test
+&& 'quoted text' ${HOME}
+		&& --verbose printf then readonly "$@" 'quoted text' -eu readonly export export
+	grep && --verbose --verbose && | readonly local grep && printf 'quoted text'
+sed readonly echo then /usr/bin awk cd | ${HOME}
+		then grep grep && ${HOME} readonly
+	"$@" 2>/dev/null cd | 2>/dev/null --verbose sed 'quoted text'
+x=1 --verbose 2>/dev/null sed && awk export sed printf test
+	--verbose awk ${HOME} readonly local done
+		$(pwd) /usr/bin -eu done echo sed ${HOME} && ${HOME} test -eu export
+		readonly $(pwd) /usr/bin
+		grep test cd cd then ${HOME} && echo test readonly
+	test local ${HOME} --verbose
+"$1" done "$@" then done grep export awk 2>/dev/null ${HOME}
+	-eu ${HOME} then /usr/bin
+cd && x=1 'quoted text' "$1" local /usr/bin cd grep done --verbose sed ${HOME}
+		--verbose x=1 echo echo echo "$1" test
+	${HOME} awk echo grep $(pwd) printf printf 'quoted text' 'quoted text'
+	readonly /usr/bin 'quoted text' "$@" sed done echo x=1 | test awk $(pwd) "$1" --verbose
+done echo cd 2>/dev/null 'quoted text' sed -eu
+	| export grep && done cd | | ${HOME} $(pwd) grep "$1" awk sed
+		then echo echo -eu "$@" export 'quoted text'
+	${HOME} printf printf printf --verbose test echo && done ${HOME} ${HOME}
+"$1" && printf readonly 'quoted text' && awk x=1 printf x=1 test /usr/bin awk /usr/bin
+test grep printf "$1" x=1 cd 2>/dev/null grep 2>/dev/null
+	then test test printf sed 2>/dev/null "$1" test
+x=1 cd sed | done local printf && x=1 "$1" test "$1"
+2>/dev/null -eu x=1 awk test
+		grep && $(pwd) ${HOME} --verbose -eu x=1 cd $(pwd) sed export "$1"
+	"$1" && 'quoted text' ${HOME}
+		printf ${HOME} done sed awk echo export "$1" readonly printf $(pwd)
+		${HOME} echo ${HOME} -eu echo "$1" --verbose then
+		export $(pwd) x=1 -eu 'quoted text' awk readonly | ${HOME} 'quoted text' 'quoted text'
+	cd then ${HOME} $(pwd) test
+export sed echo then cd printf
+&& $(pwd) cd done $(pwd) 'quoted text' "$@" export echo done readonly readonly
+	test $(pwd) test "$@" then then 2>/dev/null 2>/dev/null /usr/bin &&
+		printf "$@" | then grep echo $(pwd) --verbose then -eu cd cd sed test
+2>/dev/null "$@" 2>/dev/null export
+	readonly export /usr/bin cd x=1 -eu export --verbose $(pwd) echo local
+		export /usr/bin grep printf --verbose local readonly 2>/dev/null readonly
+		&& export /usr/bin --verbose x=1 "$@" && /usr/bin "$1" awk done awk echo | then
+		"$@" test done /usr/bin echo test local 2>/dev/null sed sed sed x=1
+	"$@" 2>/dev/null -eu -eu then export "$1" printf local sed cd -eu readonly 'quoted text'
+	test local grep readonly grep | echo
+	2>/dev/null 'quoted text' | local -eu $(pwd) /usr/bin ${HOME}
+	&& then echo 'quoted text' test readonly
+		sed /usr/bin printf -eu then local -eu $(pwd) && printf
+		grep $(pwd) echo x=1 --verbose | 2>/dev/null then
+	&& export x=1 test 2>/dev/null cd sed ${HOME} 2>/dev/null $(pwd) -eu
+&& echo 2>/dev/null test printf
+	| local readonly -eu ${HOME} -eu x=1 2>/dev/null
+		'quoted text' "$1" sed echo --verbose
+	x=1 --verbose "$@" echo "$1" --verbose -eu readonly "$1" readonly echo "$1"
+		-eu done ${HOME} printf && cd x=1 --verbose 'quoted text' then export
+		${HOME} -eu printf local export | done -eu /usr/bin $(pwd) local x=1
+readonly readonly sed done --verbose local cd ${HOME} -eu ${HOME} /usr/bin
+	/usr/bin cd export cd grep sed && printf then && -eu local cd echo local 2>/dev/null
+		| test 2>/dev/null sed then grep /usr/bin
+		$(pwd) then export printf export sed cd echo export
+	$(pwd) && --verbose export && x=1 /usr/bin | 2>/dev/null /usr/bin then
+		"$@" local -eu && x=1 then readonly
+	printf then grep grep printf grep ${HOME}
+	"$@" echo readonly export | /usr/bin "$1" cd sed printf readonly
+		&& && local $(pwd) -eu 'quoted text' grep --verbose | echo done printf /usr/bin
+&& grep "$@" cd | then export --verbose /usr/bin $(pwd) test x=1
+"$@" "$@" 'quoted text' "$1" -eu 2>/dev/null
+"$1" -eu then export $(pwd) printf test
+	--verbose cd done $(pwd) sed
+printf && cd readonly export
+		grep x=1 $(pwd) printf /usr/bin "$@" -eu $(pwd) local &&
+		then echo readonly test cd grep ${HOME} echo x=1 'quoted text'
+printf printf sed sed ${HOME} /usr/bin readonly
+echo $(pwd) x=1 'quoted text' | local sed 'quoted text' | --verbose
+	done "$1" ${HOME} grep 'quoted text' grep done /usr/bin
+	grep grep echo awk echo done echo "$@" /usr/bin
+'quoted text' readonly export -eu local export $(pwd) local
+--verbose "$1" export $(pwd) x=1
+	$(pwd) grep | "$@" /usr/bin cd then 'quoted text' ${HOME}
+	readonly done grep grep ${HOME} export test && ${HOME} then ${HOME} $(pwd)
+		"$@" /usr/bin echo test echo "$@" "$1" x=1 | then grep echo x=1 awk /usr/bin
+		then x=1 "$1" 'quoted text' sed "$@" local &&
+	readonly --verbose echo && && 2>/dev/null "$1" 2>/dev/null
+		$(pwd) "$1" awk then
+		then | export /usr/bin 2>/dev/null 2>/dev/null then 2>/dev/null
+grep done cd readonly | export ${HOME} grep test done
+printf ${HOME} -eu /usr/bin --verbose
+	| sed x=1 export printf 'quoted text' echo awk grep -eu "$1" done
+cd grep $(pwd) $(pwd) "$1" x=1 cd $(pwd) readonly -eu x=1 /usr/bin $(pwd) $(pwd)
+/usr/bin local && --verbose 'quoted text' "$1" test "$1" export 2>/dev/null
+	echo "$@" | "$@" sed x=1 export export
+		awk echo grep ${HOME} && grep 2>/dev/null $(pwd) echo awk 2>/dev/null "$@" "$1"
+		then --verbose --verbose $(pwd) /usr/bin --verbose export x=1 printf echo
+		${HOME} then 2>/dev/null $(pwd) | && $(pwd) ${HOME} ${HOME} readonly /usr/bin
+	cd sed then local /usr/bin
+"$@" readonly printf printf /usr/bin
+		printf local $(pwd) echo ${HOME} then done export sed then grep export
+readonly awk -eu $(pwd) "$1" local /usr/bin export printf awk x=1 2>/dev/null
+x=1 "$1" sed | cd 'quoted text' awk -eu && grep echo 2>/dev/null
+done 'quoted text' | $(pwd) then "$@" /usr/bin
+		| test local sed readonly $(pwd)
+	'quoted text' x=1 /usr/bin --verbose grep "$@" test ${HOME} sed test
+		/usr/bin echo 2>/dev/null 'quoted text' "$1" -eu "$1" &&
+	| ${HOME} cd 'quoted text' done "$1" local local 'quoted text'
+cd --verbose done then then test readonly printf
+&& 'quoted text' done 2>/dev/null | 2>/dev/null test
+${HOME} ${HOME} readonly awk
+		x=1 awk done /usr/bin && done | cd --verbose "$1" | "$1" x=1 printf cd ${HOME}
+		$(pwd) export $(pwd) cd "$@" export --verbose local readonly $(pwd) echo
+	awk cd "$1" echo export && printf ${HOME} then
+		x=1 /usr/bin export done cd "$1" x=1 ${HOME} x=1 "$@" cd 'quoted text'
+	then echo test 'quoted text'
+"$@" 'quoted text' local done
+	2>/dev/null then grep ${HOME}
+export "$1" x=1 export cd ${HOME} -eu ${HOME} then 'quoted text' && "$@" $(pwd)
+		| done $(pwd) && grep done 2>/dev/null $(pwd)
+		awk sed sed "$1" "$1" done ${HOME} grep "$@" "$@" grep /usr/bin
+		printf "$1" x=1 "$1" echo readonly done ${HOME} 'quoted text'
+export export export
+		test $(pwd) local "$@" 2>/dev/null "$1" export && 2>/dev/null -eu 'quoted text'
+-eu --verbose printf --verbose then /usr/bin
+done /usr/bin -eu done grep $(pwd) 2>/dev/null
+sed | awk local awk /usr/bin
+		| sed --verbose test && $(pwd) 'quoted text'
+	grep && readonly sed local
+		readonly x=1 cd echo && ${HOME} "$1" done awk 2>/dev/null && $(pwd) 'quoted text'
+	local cd -eu export ${HOME} 'quoted text'
+/usr/bin sed ${HOME} | awk awk readonly done ${HOME} awk
+		x=1 then 'quoted text' && readonly
+		then ${HOME} "$1" "$@" "$1" && ${HOME} awk $(pwd) $(pwd) echo | export "$@"
+	"$@" awk "$1" "$1" cd local | "$1" readonly "$@" cd -eu sed --verbose
+	done echo done readonly printf readonly export
+	"$1" x=1 awk printf local awk printf awk awk
+		--verbose grep echo /usr/bin echo ${HOME} local
+-eu $(pwd) ${HOME} export
+		'quoted text' 2>/dev/null awk -eu readonly test "$1" cd cd grep
+	echo then -eu --verbose $(pwd) then "$1" x=1 readonly
+		-eu /usr/bin echo /usr/bin "$1" && 'quoted text'
+	${HOME} then /usr/bin "$@" -eu /usr/bin -eu echo
+${HOME} "$@" "$@" $(pwd)
+		readonly awk sed "$@" ${HOME} -eu -eu "$1" done
+&& | echo cd x=1 /usr/bin "$@" local done "$@" test readonly "$1" done
+	2>/dev/null x=1 "$1" "$@" printf test ${HOME} "$@"
+	sed sed -eu printf -eu "$@" ${HOME} awk awk x=1 done readonly export
+	local 2>/dev/null done x=1 readonly
+echo test readonly then | 2>/dev/null cd "$@" test | export | export
+/usr/bin -eu done sed export 'quoted text' $(pwd) test
+		then ${HOME} --verbose 2>/dev/null sed && printf "$@" | "$@" awk 'quoted text'
+	"$1" grep /usr/bin local 2>/dev/null x=1 awk sed
+	local | /usr/bin readonly /usr/bin echo -eu cd $(pwd) "$1" printf
+	x=1 | "$1" /usr/bin | printf "$@" $(pwd) echo test done
+	done -eu ${HOME} readonly grep test 2>/dev/null
+		test test sed done "$1" $(pwd) && done export /usr/bin 'quoted text'
+awk "$@" grep readonly x=1 echo
+	done echo $(pwd) 'quoted text' printf /usr/bin
+sed cd cd grep /usr/bin echo printf x=1 2>/dev/null ${HOME} && x=1 $(pwd)
+		export "$1" x=1 cd done ${HOME} export printf $(pwd) "$1" -eu grep then echo
+		| local printf x=1 done "$1" sed | /usr/bin 2>/dev/null x=1 | grep test
+"$@" awk 2>/dev/null cd sed && echo --verbose awk $(pwd) /usr/bin export
+x=1 2>/dev/null && 2>/dev/null
+grep -eu $(pwd) grep "$@" readonly "$1" done --verbose
+local | -eu readonly /usr/bin
+done 'quoted text' "$@" echo ${HOME} export $(pwd) -eu
+test 'quoted text' local $(pwd) /usr/bin
+x=1 local 2>/dev/null grep cd done readonly sed /usr/bin sed -eu
+	'quoted text' ${HOME} && -eu | /usr/bin sed && local sed $(pwd) --verbose
+	-eu $(pwd) awk printf x=1 "$1" readonly /usr/bin printf
+| 'quoted text' printf sed 'quoted text' local 'quoted text' printf --verbose export
+		done && printf export "$@" && then --verbose 'quoted text' cd x=1
+	'quoted text' ${HOME} && "$@" done "$@" export $(pwd)
+	/usr/bin "$@" grep printf readonly grep $(pwd) echo ${HOME} "$@" | readonly local
+		/usr/bin local then $(pwd) ${HOME} sed then then "$1" echo then
+local export "$1" --verbose printf awk done printf awk 'quoted text' $(pwd)
+readonly awk test x=1 "$@" 'quoted text' readonly readonly 'quoted text'
+local /usr/bin echo cd --verbose ${HOME}
+	"$1" -eu ${HOME} readonly printf local x=1 awk ${HOME} x=1 sed x=1 "$1" ${HOME}
+-eu echo $(pwd) 2>/dev/null
+	'quoted text' cd ${HOME} --verbose "$@"
+done | test && grep awk -eu $(pwd)
+	'quoted text' && sed x=1 echo
+then | --verbose printf ${HOME} echo
+		local awk local && "$1"
+		"$@" local "$@" sed "$@" test cd -eu
+	printf 2>/dev/null grep echo echo -eu echo readonly readonly 2>/dev/null
+	| cd $(pwd) done x=1 cd $(pwd) --verbose sed awk
+done local readonly cd test grep -eu then awk echo /usr/bin && x=1 "$@" 'quoted text'
+&& local -eu "$@" test test && test readonly "$@" sed test cd /usr/bin sed
+		&& export sed x=1 local --verbose
+x=1 done then ${HOME} && $(pwd) local /usr/bin awk echo cd
+&& grep awk "$@" 'quoted text'
+${HOME} export /usr/bin "$@" -eu /usr/bin cd local echo readonly grep | --verbose
+	| 2>/dev/null export local local -eu && "$@" grep
+grep done "$@" 2>/dev/null "$@" ${HOME} 2>/dev/null "$1" ${HOME} test
+${HOME} -eu awk "$@" readonly
+	${HOME} && grep done --verbose cd && echo export $(pwd)
+	awk echo cd then sed sed x=1 export grep ${HOME} 'quoted text'
+then export grep /usr/bin ${HOME} grep
+test test -eu readonly readonly
+	awk $(pwd) readonly cd --verbose test awk sed "$@" 'quoted text' ${HOME}
+	grep 'quoted text' 'quoted text'
+"$@" /usr/bin readonly $(pwd)
+		"$1" readonly grep "$@" | /usr/bin sed then export -eu && --verbose
+	${HOME} cd then --verbose | readonly
+	--verbose done done /usr/bin 2>/dev/null ${HOME} --verbose printf
+	"$1" $(pwd) /usr/bin awk $(pwd) /usr/bin ${HOME}
+	$(pwd) | 2>/dev/null 'quoted text' local "$1" 2>/dev/null -eu
+	awk ${HOME} | x=1 then export x=1 'quoted text' awk
+		/usr/bin cd 'quoted text' x=1 $(pwd) /usr/bin |
+	awk "$@" echo $(pwd) /usr/bin
+		cd export local sed --verbose
+	| cd 'quoted text' echo readonly 2>/dev/null "$@" /usr/bin grep test
+	cd /usr/bin echo $(pwd) echo readonly "$@" ${HOME} 'quoted text' 2>/dev/null
+		2>/dev/null done x=1 done /usr/bin
+		2>/dev/null /usr/bin $(pwd)
+		test sed cd "$@" --verbose export then done echo then
+		cd $(pwd) $(pwd) "$@" awk x=1 | local awk && cd -eu -eu export then sed ${HOME}
+sed done cd printf export "$1" done grep echo grep awk --verbose
+	test ${HOME} awk "$1" | | sed -eu "$@" "$@" test --verbose
+	cd cd ${HOME} 'quoted text' then $(pwd) printf export printf -eu
+'quoted text' x=1 test awk then done awk /usr/bin | ${HOME}
+		'quoted text' && $(pwd) $(pwd) 'quoted text' awk export
+	/usr/bin x=1 2>/dev/null done ${HOME}
+	echo done x=1 -eu x=1 printf x=1 $(pwd) 'quoted text' awk "$1" awk readonly
+	done echo readonly /usr/bin | echo $(pwd) echo /usr/bin
+		&& -eu && then ${HOME} "$@" test done readonly local grep sed sed -eu echo
+		${HOME} | $(pwd) grep test sed $(pwd) x=1 "$1"
+		&& -eu awk "$@" && 'quoted text' local cd | grep cd 2>/dev/null test | grep
+		2>/dev/null printf "$1" echo $(pwd) "$1" awk grep export "$1"
+-eu ${HOME} 2>/dev/null awk && ${HOME}
+x=1 awk readonly grep /usr/bin ${HOME} $(pwd) --verbose sed "$@"
+"$1" -eu "$1" readonly printf 2>/dev/null
+--verbose && echo --verbose done local "$1" export readonly
+printf ${HOME} cd x=1 grep then 'quoted text' "$@" sed && test | cd test grep
+$(pwd) ${HOME} | done "$1" export "$@" 'quoted text'
+then -eu "$@" grep "$@" && "$1" /usr/bin && 2>/dev/null local 2>/dev/null -eu
+		"$1" test readonly "$@" cd cd
+	local awk 2>/dev/null | grep
+&& 2>/dev/null readonly local && then export
+	grep cd --verbose --verbose
+	test x=1 ${HOME} --verbose echo x=1 'quoted text' done /usr/bin /usr/bin done readonly
+	--verbose x=1 readonly then ${HOME} 'quoted text' && grep
+	| done /usr/bin ${HOME} /usr/bin echo $(pwd) sed | -eu readonly done grep
+/usr/bin ${HOME} cd done
+"$1" grep printf grep cd ${HOME} readonly grep 2>/dev/null test "$@" export
+cd x=1 readonly && test then 2>/dev/null && printf readonly done printf local
+		grep /usr/bin 2>/dev/null done printf printf awk 'quoted text'
+		-eu $(pwd) export local 'quoted text' x=1 awk readonly 'quoted text'
+cd "$@" /usr/bin local then /usr/bin
+done awk $(pwd) --verbose
+${HOME} "$1" awk | readonly | done -eu readonly "$@"
+	awk local "$@" readonly
+		grep && | 'quoted text' $(pwd) done && sed export awk x=1 x=1 ${HOME} readonly
+	grep 'quoted text' readonly then then sed sed "$@" grep 2>/dev/null ${HOME} printf
+	${HOME} /usr/bin echo local ${HOME} --verbose -eu awk done
+	'quoted text' export done x=1 | $(pwd) "$1"
+		done test $(pwd) "$1" local $(pwd) -eu /usr/bin
+	--verbose | "$1" readonly then printf 'quoted text' awk
+'quoted text' echo cd "$@" echo echo --verbose sed then 2>/dev/null /usr/bin
+		-eu local ${HOME} local | then
+	| -eu | | done export local grep
+		/usr/bin "$@" $(pwd) ${HOME} readonly
+	grep sed -eu readonly "$1" echo grep "$@" cd done grep
+	2>/dev/null /usr/bin && && "$@" readonly echo local
+	x=1 /usr/bin | "$@" sed | --verbose 2>/dev/null cd && echo "$@" |
+	| echo --verbose done "$@" /usr/bin "$@" $(pwd) sed --verbose awk && export
+"$1" /usr/bin done echo readonly $(pwd) "$@" grep
+sed cd "$1" echo "$1" | "$@" | "$1" readonly
+grep /usr/bin echo local 'quoted text' awk awk
+	cd | x=1 done export --verbose x=1 ${HOME}
+	then | 2>/dev/null echo && 2>/dev/null
+	export then && printf ${HOME} && "$@" export
+	-eu readonly x=1 echo "$@" readonly awk awk local echo done
+test /usr/bin echo echo $(pwd) 'quoted text' 2>/dev/null ${HOME}
+		2>/dev/null /usr/bin x=1 | && "$1" 'quoted text' "$1" 2>/dev/null export 2>/dev/null
+		"$@" cd cd printf 'quoted text' /usr/bin export
+		'quoted text' echo $(pwd) readonly sed /usr/bin
+	sed --verbose export --verbose -eu -eu --verbose "$@" readonly done ${HOME}
+local done awk /usr/bin /usr/bin $(pwd) export done readonly
+		done sed ${HOME} awk sed
+		local --verbose grep local 'quoted text' && export -eu grep export done
+	| echo sed readonly --verbose printf local cd ${HOME} printf 'quoted text'
+		then 2>/dev/null done ${HOME}
+		done ${HOME} cd ${HOME} echo then export && export local export && readonly readonly
+		2>/dev/null readonly 'quoted text'
+test 'quoted text' export 'quoted text'
+	echo then awk 'quoted text'
+cd echo ${HOME} && | sed then cd export x=1 ${HOME} cd grep test /usr/bin
+export $(pwd) $(pwd) cd grep awk sed then
+&& grep $(pwd) -eu "$@" 2>/dev/null
+/usr/bin readonly cd 2>/dev/null 'quoted text'
+-eu /usr/bin "$@" "$@" printf readonly test
+		/usr/bin "$1" echo "$1" 'quoted text' grep x=1 printf --verbose printf printf
+	-eu test readonly readonly echo "$@" 'quoted text' &&
+"$@" sed /usr/bin readonly printf echo awk cd echo export
+	grep printf x=1 "$1" local local 'quoted text' --verbose
+&& | -eu 'quoted text' printf /usr/bin echo "$1" -eu test local
+	local && /usr/bin /usr/bin echo echo test grep cd printf /usr/bin sed
+		&& readonly --verbose ${HOME} $(pwd) ${HOME} 2>/dev/null
+		sed export sed readonly test sed sed grep grep -eu awk echo | local "$1" sed "$1"
+	2>/dev/null readonly "$@" | sed
+	/usr/bin cd --verbose grep x=1 | test 'quoted text' grep
+	cd cd && cd sed 2>/dev/null local
+"$1" x=1 printf $(pwd) ${HOME} -eu export /usr/bin x=1
+| | grep "$@" test -eu readonly then $(pwd)
+	2>/dev/null /usr/bin 'quoted text'
+	export echo 2>/dev/null 2>/dev/null
+printf --verbose 'quoted text'
+		printf -eu grep cd $(pwd) ${HOME} export printf cd "$1"
+		test export -eu cd 'quoted text' | grep grep --verbose export then
+| done awk /usr/bin export
+		$(pwd) 'quoted text' readonly echo $(pwd)
+	awk echo 2>/dev/null "$1"
+	${HOME} local && x=1 cd export then then --verbose awk
+	done local then then "$@" ${HOME} "$1" ${HOME} printf
+"$@" x=1 readonly 'quoted text' local echo 2>/dev/null
+	export export ${HOME} ${HOME} local
+		${HOME} -eu $(pwd) cd ${HOME} "$@" --verbose x=1 "$@"
+		cd "$@" && "$@" 'quoted text'
+		| then grep /usr/bin -eu ${HOME} echo local $(pwd) cd 2>/dev/null "$@" --verbose
+		done export sed "$1" export "$1" done awk then export
+		&& awk 'quoted text' test echo printf -eu | readonly sed x=1
+	-eu readonly 2>/dev/null /usr/bin "$1" 'quoted text' "$1" cd $(pwd)
+		| sed x=1 "$@" test done
+readonly $(pwd) 2>/dev/null local then x=1 'quoted text' export "$1" "$@" done
+	| test x=1 "$1" 'quoted text' then
+		/usr/bin cd | printf cd --verbose x=1
+		$(pwd) "$1" awk sed "$1" | && awk && export
+		-eu /usr/bin cd echo && --verbose
+grep awk local /usr/bin sed | "$@" &&
+"$1" ${HOME} echo test readonly
+cd local export echo $(pwd) $(pwd) 'quoted text' ${HOME} grep "$@" x=1 x=1
+		printf $(pwd) 2>/dev/null then
+&& "$1" "$1" 2>/dev/null "$@" "$@"
+		grep cd $(pwd) -eu export && cd "$@" export /usr/bin "$1" -eu done readonly &&
+$(pwd) readonly /usr/bin x=1 cd test "$1" grep
+printf sed x=1 $(pwd) readonly readonly
+printf /usr/bin local echo 2>/dev/null export grep /usr/bin
+'quoted text' readonly export grep && && x=1 && done 'quoted text' --verbose
+sed x=1 2>/dev/null | cd "$@" then "$@" export then cd printf
+		then done /usr/bin | 'quoted text' export
+	local printf 2>/dev/null done "$1" 'quoted text' echo "$1" sed
+export "$@" && readonly /usr/bin awk grep grep && local && 2>/dev/null export x=1
+awk /usr/bin ${HOME} readonly | awk $(pwd) ${HOME} $(pwd) ${HOME}
+		'quoted text' && test "$1" 2>/dev/null $(pwd)
+		done && "$1" /usr/bin 'quoted text'
+done -eu x=1 && test test /usr/bin && sed awk -eu local 2>/dev/null ${HOME} sed
+		sed 2>/dev/null | awk local grep then export -eu grep then awk /usr/bin --verbose
+	printf "$@" sed awk /usr/bin
+		-eu local echo then 'quoted text'
+2>/dev/null sed $(pwd) x=1 grep local done && 2>/dev/null readonly
+	x=1 /usr/bin && "$1" -eu ${HOME} 'quoted text' echo printf then
+		done | awk test then "$1" | x=1 export --verbose sed
+	sed done && then local /usr/bin -eu readonly $(pwd) local
+	readonly then 2>/dev/null cd test
+printf 'quoted text' $(pwd) printf cd test "$@" printf
+		2>/dev/null grep readonly 'quoted text' --verbose
+done /usr/bin && && ${HOME} export x=1
+	"$1" awk ${HOME} -eu "$@" x=1 cd --verbose -eu grep $(pwd) echo export sed then
+	awk x=1 --verbose | /usr/bin -eu grep
+	&& sed grep grep printf test grep 'quoted text' ${HOME} 'quoted text' export
+		local printf readonly export -eu -eu test
+		"$@" grep /usr/bin echo cd /usr/bin "$@" $(pwd) |
+	test "$@" readonly --verbose 'quoted text' ${HOME} local test
+		${HOME} $(pwd) done /usr/bin && printf test then "$@" local readonly
+	local grep --verbose 'quoted text' echo sed cd printf $(pwd) /usr/bin 2>/dev/null
+awk test test x=1 ${HOME} | readonly
+| test --verbose printf sed grep
+	local grep "$1" -eu sed then
+	local -eu printf then ${HOME} /usr/bin --verbose /usr/bin ${HOME}
+		done "$@" ${HOME} local 2>/dev/null "$@" sed 2>/dev/null
+$(pwd) && echo /usr/bin 'quoted text'
+		test $(pwd) "$1" local && $(pwd) readonly awk export
+x=1 && | x=1 "$1" $(pwd) grep && export --verbose 'quoted text' /usr/bin test
+	--verbose x=1 /usr/bin -eu /usr/bin printf -eu ${HOME} -eu then 'quoted text'
+printf $(pwd) test done ${HOME} done sed then --verbose
+		2>/dev/null -eu $(pwd) readonly awk ${HOME}
+		"$@" -eu readonly awk /usr/bin test | sed cd grep awk cd local --verbose cd sed
+	$(pwd) export awk readonly
+'quoted text' then ${HOME}
+"$@" then awk sed ${HOME} ${HOME} "$@" | && sed
+	readonly && x=1 then ${HOME} export ${HOME}
+	printf "$@" && then && && local /usr/bin grep echo "$1" local local
+export then readonly | "$1" "$1" cd | export | sed | grep printf done "$1" test
+local -eu x=1 test echo export 2>/dev/null -eu
+readonly 'quoted text' then local "$@" grep test local export local && grep
+		2>/dev/null awk /usr/bin export "$@" done x=1 echo x=1 "$@" grep
+		grep "$@" "$@" sed "$@" 'quoted text' readonly
+		2>/dev/null awk -eu awk awk && "$@" 2>/dev/null export x=1 readonly -eu $(pwd)
+sed /usr/bin 2>/dev/null 'quoted text' |
+		"$1" done /usr/bin ${HOME} done --verbose
+$(pwd) sed 2>/dev/null $(pwd) readonly export cd 'quoted text'
+		x=1 /usr/bin 'quoted text' ${HOME}
+${HOME} | local printf done x=1 printf echo local sed echo local printf -eu
+	sed awk 'quoted text' "$1" -eu &&
+${HOME} "$1" --verbose export cd | echo awk
+		test cd x=1 test && grep
+then awk "$@" -eu local 'quoted text' local sed cd && ${HOME}
+		done 2>/dev/null /usr/bin export -eu && -eu "$@"
+done x=1 2>/dev/null grep export $(pwd) x=1
+	&& && "$@" /usr/bin local echo /usr/bin -eu cd "$1" awk "$1"
+local cd /usr/bin awk -eu
+	readonly export echo printf sed export 2>/dev/null "$1" -eu sed printf
+$(pwd) /usr/bin "$@" echo /usr/bin
+	test readonly then readonly echo sed sed readonly sed cd export
+		test echo && 2>/dev/null done test --verbose "$1"
+--verbose | sed test "$@" | 2>/dev/null test /usr/bin echo readonly "$@" done 2>/dev/null
+		2>/dev/null 'quoted text' echo && --verbose /usr/bin
+$(pwd) awk readonly cd
+	then 'quoted text' -eu "$@" ${HOME} && awk export --verbose awk printf
+		echo "$1" readonly export awk
+-eu "$1" && sed && /usr/bin x=1 test test
+		then local test echo printf
+sed sed 2>/dev/null 'quoted text' export 2>/dev/null
+		done awk -eu done ${HOME} echo $(pwd)
+	--verbose $(pwd) x=1 $(pwd) grep export grep "$@" sed
+&& printf -eu grep readonly 2>/dev/null "$@" test local "$1" local export
+local grep done 2>/dev/null
+		$(pwd) | printf export 'quoted text' /usr/bin $(pwd) $(pwd) 2>/dev/null -eu ${HOME}
+	grep printf -eu sed printf local -eu ${HOME} x=1 done export 2>/dev/null
+"$1" cd done 'quoted text' echo export
+$(pwd) awk x=1 x=1 awk export x=1 2>/dev/null && local $(pwd) test /usr/bin |
+		readonly local grep done $(pwd) done export ${HOME} grep grep sed 2>/dev/null
+		2>/dev/null sed --verbose readonly readonly "$@" cd sed
+	local done ${HOME} printf --verbose x=1 done echo test $(pwd) export --verbose
+	readonly readonly | "$1" test ${HOME} ${HOME} export
+	${HOME} 'quoted text' -eu 'quoted text' printf
+cd | $(pwd) $(pwd) grep echo | awk "$1"
+awk ${HOME} | then "$@" -eu readonly test -eu
+		sed "$@" 'quoted text' readonly
+--verbose ${HOME} printf $(pwd) x=1 $(pwd) -eu awk x=1 cd printf --verbose
+		-eu /usr/bin done test grep
+test 'quoted text' local readonly done "$1" test --verbose
+	-eu grep sed 2>/dev/null
+	"$@" ${HOME} 2>/dev/null grep | /usr/bin /usr/bin echo
+	-eu awk local awk 'quoted text'
+	'quoted text' | grep local
+export && | | | $(pwd) cd then | echo $(pwd) echo --verbose
+x=1 done then test printf echo x=1 readonly ${HOME} local "$1" 'quoted text'
+done test && sed -eu done readonly "$1" && cd export ${HOME} awk
+readonly ${HOME} export ${HOME} && -eu $(pwd) awk $(pwd) -eu grep $(pwd) printf
+	"$1" sed local x=1 cd /usr/bin
+	--verbose awk ${HOME} "$1" | | -eu grep test x=1
+readonly ${HOME} $(pwd) local done done && "$1" export "$1" test awk
+/usr/bin cd awk && printf export 'quoted text'
+	then | 'quoted text' "$1" -eu echo x=1 "$@" $(pwd) 'quoted text'
+		"$@" sed -eu "$@" x=1 -eu -eu "$@" $(pwd) test 'quoted text'
+		'quoted text' done 'quoted text' done --verbose sed &&
+	$(pwd) test | export export "$@" test readonly
+		&& sed ${HOME} /usr/bin sed x=1 printf "$1" local
+		/usr/bin done "$@" awk export grep x=1 | local $(pwd) 2>/dev/null "$1" echo
+		"$@" "$@" $(pwd) echo done | readonly sed export sed && local printf
+local -eu cd echo grep x=1
+&& $(pwd) done 2>/dev/null sed printf cd --verbose printf
+'quoted text' grep cd --verbose ${HOME} ${HOME} cd "$@" --verbose printf /usr/bin
+	cd -eu /usr/bin echo x=1 export cd grep awk grep
+awk grep $(pwd) local x=1 ${HOME} sed /usr/bin
+| then readonly 2>/dev/null test export readonly "$1" x=1 sed then echo -eu
+		echo sed x=1 | $(pwd) x=1 "$1"
+grep printf printf | 2>/dev/null 'quoted text'
+	awk /usr/bin cd ${HOME} ${HOME} then "$1" && && awk cd awk test
+local local echo grep echo test readonly readonly
+&& sed /usr/bin "$@" $(pwd) readonly
+		export ${HOME} "$@" export 2>/dev/null -eu
+local 2>/dev/null readonly export readonly
+grep x=1 "$@" "$@" awk test ${HOME} readonly
+&& --verbose export printf sed printf | $(pwd) 'quoted text' 2>/dev/null 'quoted text'
+2>/dev/null grep --verbose grep
+		grep printf ${HOME} grep done grep echo export readonly
+	&& cd echo local done ${HOME} sed | ${HOME} export export grep
+	"$@" readonly x=1 awk -eu | then ${HOME}
+'quoted text' readonly then test 'quoted text' "$1" 'quoted text' 'quoted text'
+$(pwd) then | readonly cd then $(pwd) x=1
+--verbose done "$1" 2>/dev/null "$1" | 'quoted text' sed
+	'quoted text' done x=1 ${HOME} && done done 2>/dev/null
+$(pwd) -eu test awk grep awk awk && "$1" done export readonly ${HOME}
+		/usr/bin test export export then test 'quoted text' test --verbose
+		| ${HOME} ${HOME} grep grep --verbose local $(pwd) "$@" echo cd export
+		${HOME} export export echo | readonly 2>/dev/null grep --verbose
+--verbose x=1 grep /usr/bin &&
+	x=1 $(pwd) awk test "$1"
+echo && -eu then sed | done "$1" "$@" test x=1 printf --verbose x=1 /usr/bin
+	printf --verbose export grep 2>/dev/null
+echo "$1" $(pwd) ${HOME} /usr/bin
+	"$@" cd x=1 test x=1 printf cd 'quoted text'
+2>/dev/null grep 'quoted text' export then "$1" readonly
+'quoted text' export export | then
+	done && printf ${HOME} test "$1" awk printf --verbose sed
+	export 2>/dev/null $(pwd) export cd "$@" 2>/dev/null
+	sed && readonly local printf
+	2>/dev/null /usr/bin 'quoted text' echo --verbose
+done printf ${HOME} -eu 'quoted text' printf echo -eu
+| echo printf local ${HOME} echo awk "$@" test echo printf grep local awk ${HOME}
+echo local ${HOME} /usr/bin "$@" printf then cd sed test 2>/dev/null $(pwd)
+export printf export
+then /usr/bin local 2>/dev/null
+"$@" x=1 -eu cd readonly done awk "$@" test then --verbose 'quoted text'
+test 'quoted text' "$1"
+	'quoted text' 2>/dev/null
+		grep x=1 printf "$@" --verbose /usr/bin x=1
+		done sed | | "$1" ${HOME} done | awk printf -eu sed echo printf /usr/bin
+	echo sed then -eu then && -eu /usr/bin
+'quoted text' sed "$1" --verbose readonly ${HOME} printf
+	grep -eu | 2>/dev/null test grep 2>/dev/null test
+		$(pwd) 'quoted text' ${HOME}
+		| export sed && && "$1" && cd cd then
+		"$1" printf awk awk | readonly x=1
+	/usr/bin /usr/bin --verbose $(pwd) export sed /usr/bin | done && export local
+readonly -eu ${HOME} export $(pwd) readonly sed echo local awk readonly then
+test 2>/dev/null export && ${HOME} export $(pwd)
+readonly -eu export readonly echo test echo sed test 2>/dev/null
+${HOME} local | ${HOME} "$1"
+		$(pwd) then local 'quoted text' "$1" --verbose echo /usr/bin printf sed
+		local export grep sed awk ${HOME} 2>/dev/null "$1"
+local grep awk && ${HOME} done ${HOME} done test /usr/bin
+		readonly printf echo readonly then ${HOME}
+/usr/bin "$1" ${HOME} echo echo cd test | local export /usr/bin /usr/bin /usr/bin
+		done "$@" /usr/bin --verbose $(pwd) export "$1" then $(pwd) $(pwd)
+/usr/bin local x=1 done /usr/bin /usr/bin --verbose && "$1" "$1" --verbose
+	"$@" then readonly cd local printf sed cd readonly
+local readonly 'quoted text' -eu done
+2>/dev/null sed 2>/dev/null -eu grep cd --verbose cd 'quoted text'
+	echo ${HOME} local && --verbose echo "$1" && $(pwd)
+	/usr/bin test export export x=1 grep test awk
+/usr/bin export --verbose readonly
+sed 2>/dev/null "$1" cd 'quoted text'
+		test awk "$@" | 'quoted text' 'quoted text'
+readonly export sed local && then echo printf $(pwd) && cd awk
+$(pwd) | readonly "$@" "$1" /usr/bin grep 'quoted text'
+	${HOME} cd x=1 export test then done 'quoted text'
+	then printf 'quoted text' 2>/dev/null done "$@" | printf x=1 readonly
+	readonly done done 'quoted text' 'quoted text' test test "$1" "$@" printf local
+		/usr/bin ${HOME} echo && 2>/dev/null /usr/bin readonly x=1 echo -eu 2>/dev/null
+		test 2>/dev/null test | printf echo
+	x=1 export then $(pwd) cd -eu test /usr/bin 'quoted text'
+'quoted text' grep printf | printf --verbose printf echo --verbose
+cd readonly "$@" x=1 "$@" "$@" --verbose
+--verbose test export done $(pwd) readonly 'quoted text'
+-eu sed awk export x=1 done done awk test && && "$1" then 'quoted text'
+"$@" "$1" local $(pwd) cd | sed test /usr/bin
+		awk done "$1" grep cd then && done
+		| readonly && sed done -eu readonly
+	$(pwd) x=1 && --verbose --verbose test sed readonly /usr/bin done "$@" test
+		$(pwd) ${HOME} "$@" -eu then "$@" 2>/dev/null ${HOME} test
+readonly cd grep test 2>/dev/null /usr/bin "$1"
+printf "$1" test $(pwd) 2>/dev/null done local grep && "$@" ${HOME} printf readonly
+| "$1" awk | done awk && 'quoted text' printf then
+"$@" --verbose printf printf 2>/dev/null awk |
+		then sed then /usr/bin 'quoted text' "$@" test "$@" readonly then ${HOME} "$@"
+'quoted text' cd && done test printf cd done
+		${HOME} readonly local -eu /usr/bin readonly $(pwd) x=1 $(pwd) "$1" local
+test grep readonly /usr/bin /usr/bin
+	awk test "$1" 2>/dev/null sed export
+	cd /usr/bin && echo awk sed $(pwd)
+readonly "$1" "$@" then echo printf --verbose
+	-eu && export | "$1" "$@" grep "$@" "$1" -eu -eu done
+		export 'quoted text' sed -eu && -eu && x=1 export -eu done
+		then 2>/dev/null export ${HOME}
+	$(pwd) 2>/dev/null awk readonly sed 2>/dev/null && sed
+		'quoted text' $(pwd) printf export done /usr/bin && x=1 "$@" 2>/dev/null 'quoted text'
+		grep export 'quoted text' awk | 'quoted text' 2>/dev/null done printf awk export
+echo $(pwd) x=1 $(pwd) | echo cd x=1
+printf cd cd export then -eu
+		-eu /usr/bin grep cd awk awk local cd echo --verbose
+		&& /usr/bin | x=1 readonly x=1 | echo readonly
+		export -eu 'quoted text' printf export done printf local
+done --verbose -eu -eu -eu sed "$@" x=1 local 'quoted text'
+	readonly test echo $(pwd) $(pwd) --verbose done export test
+	readonly -eu echo echo echo "$@" echo
+$(pwd) $(pwd) 'quoted text' sed /usr/bin --verbose 2>/dev/null test ${HOME}
+awk $(pwd) --verbose -eu x=1 2>/dev/null
+awk /usr/bin awk 2>/dev/null
+		${HOME} readonly && then local 'quoted text' "$1" awk "$1"
+	cd "$1" "$1" grep $(pwd) grep | echo
+	printf sed awk printf done cd local readonly --verbose
+echo then /usr/bin export readonly test && test /usr/bin
+then done cd 2>/dev/null $(pwd)
+		done 2>/dev/null awk grep x=1
+$(pwd) done cd test "$1" local ${HOME} "$@" export |
+		&& ${HOME} $(pwd) "$@" awk done $(pwd)
+		| awk 2>/dev/null test printf ${HOME} "$1" 'quoted text' sed done cd readonly
+| printf done printf export
+readonly printf export "$@" 'quoted text' awk "$@"
+2>/dev/null -eu cd echo /usr/bin sed sed awk
+$(pwd) "$@" /usr/bin && 2>/dev/null local
+		echo 2>/dev/null awk /usr/bin /usr/bin
+"$1" /usr/bin then export -eu "$@" printf local | && export done ${HOME} local
+		test /usr/bin readonly echo local ${HOME} done test
+		awk export | readonly --verbose ${HOME} /usr/bin /usr/bin "$1" x=1 x=1 "$@"
+		x=1 export awk 2>/dev/null -eu awk ${HOME} local
+-eu /usr/bin x=1 awk "$@" "$1" echo done
+echo done echo readonly && awk && echo && && printf
+		'quoted text' then sed test cd ${HOME}
+		${HOME} local echo readonly then grep "$1"
+	printf awk sed 2>/dev/null "$@" echo && sed sed 2>/dev/null readonly
+local 2>/dev/null --verbose 2>/dev/null sed
+"$1" readonly "$1" x=1
+"$1" cd ${HOME} done test 2>/dev/null export
+	/usr/bin --verbose --verbose export printf ${HOME} $(pwd)
+x=1 /usr/bin awk "$@" then /usr/bin export done test awk readonly ${HOME}
+2>/dev/null /usr/bin 2>/dev/null sed export "$1" grep
+	printf export 2>/dev/null "$@" grep cd echo x=1 2>/dev/null | ${HOME} test then
+"$@" /usr/bin then test export -eu ${HOME} $(pwd) /usr/bin
+	&& export x=1 /usr/bin sed test
+	&& awk test local "$1" x=1 "$@" "$1" test 'quoted text'
+	cd printf readonly echo then /usr/bin
+		awk /usr/bin /usr/bin --verbose
+readonly | awk done --verbose sed -eu 'quoted text'
+		&& local x=1 printf "$@" $(pwd) test readonly $(pwd) export -eu readonly test
+printf export 'quoted text' awk then -eu grep ${HOME}
+	/usr/bin && cd 2>/dev/null awk awk awk test
+local echo cd x=1 --verbose
+		/usr/bin grep test --verbose grep export
+		2>/dev/null grep sed grep --verbose local
+'quoted text' export $(pwd) export readonly awk echo
+	then sed /usr/bin $(pwd) grep ${HOME} 'quoted text' readonly
+done "$@" ${HOME} export ${HOME} sed awk export 'quoted text' "$1" readonly local
+$(pwd) cd "$1" 'quoted text' /usr/bin "$@" readonly
+		awk test printf local 2>/dev/null -eu printf awk x=1
+		sed | ${HOME} && && 'quoted text' 'quoted text'
+x=1 && export sed test ${HOME} "$@" export echo && ${HOME} /usr/bin x=1 local
+		2>/dev/null readonly -eu && 'quoted text' awk
+		done then 2>/dev/null echo readonly grep 2>/dev/null
+'quoted text' ${HOME} test test 2>/dev/null --verbose /usr/bin && cd
+	/usr/bin readonly x=1 readonly grep done local
+		x=1 'quoted text' "$1" "$1" x=1 'quoted text' test "$1" "$1" $(pwd)
+"$@" awk done 2>/dev/null "$1" test local grep cd done --verbose 2>/dev/null
+		done | /usr/bin printf readonly
+"$1" cd grep 2>/dev/null x=1 printf
+--verbose -eu /usr/bin 'quoted text'
+	then printf $(pwd) ${HOME} done export grep awk sed -eu && --verbose ${HOME}
+sed $(pwd) 'quoted text' sed done readonly
+--verbose $(pwd) "$1" 2>/dev/null $(pwd)
+'quoted text' 'quoted text' export | | awk then readonly && x=1 /usr/bin $(pwd)
+		grep -eu ${HOME} "$1" "$@" echo test "$@" grep sed local
+	"$1" 2>/dev/null grep /usr/bin -eu "$@" && done
+		'quoted text' x=1 "$1" x=1 then | export
+-eu printf export 2>/dev/null awk sed cd echo "$1" 2>/dev/null readonly
+	sed printf 2>/dev/null done ${HOME}
+		awk grep cd awk export echo | printf then export 2>/dev/null printf
+	echo then printf printf printf "$@"
+		x=1 done awk -eu $(pwd) --verbose grep awk | --verbose && && $(pwd)
+	-eu test $(pwd) | local "$@" grep x=1 then printf ${HOME}
+		then x=1 awk x=1 done -eu readonly readonly
+echo 'quoted text' then readonly test then x=1 readonly local test |
+		x=1 then "$1" sed awk $(pwd) local cd readonly sed | awk cd grep /usr/bin
+"$1" "$1" readonly grep "$1"
+#include c107.sh
+		printf cd "$@" local readonly -eu --verbose --verbose
+readonly --verbose ${HOME} $(pwd) -eu cd done readonly --verbose
+done x=1 grep export then cd && test readonly "$1" echo ${HOME} grep
+	/usr/bin 2>/dev/null ${HOME} export
+		echo readonly && -eu then test 2>/dev/null
+printf readonly | 'quoted text' /usr/bin cd $(pwd) echo then --verbose grep then
+--verbose "$1" cd | && && test
+	${HOME} "$@" ${HOME} grep grep sed -eu 2>/dev/null x=1 grep /usr/bin
+		local echo sed printf local readonly sed | test && export -eu
+		&& && test "$1" x=1 sed "$@" awk
+printf "$@" awk 2>/dev/null --verbose
+| done grep ${HOME} "$1" ${HOME} echo -eu 'quoted text' done 2>/dev/null
+grep export 2>/dev/null sed export /usr/bin
+		echo awk test -eu 'quoted text' --verbose export
+local x=1 sed -eu then test
+grep -eu "$@" sed ${HOME} /usr/bin sed 2>/dev/null
+		${HOME} $(pwd) $(pwd) | export 'quoted text'
+		"$@" local readonly $(pwd) sed "$@" -eu
+	then 'quoted text' --verbose "$1" && x=1 echo local /usr/bin | x=1 | -eu /usr/bin
+	${HOME} export then cd ${HOME} local awk 'quoted text'
+	${HOME} test sed sed 2>/dev/null sed $(pwd) --verbose local sed
+		then 2>/dev/null readonly grep "$@" x=1 "$@" printf x=1 -eu test awk
+		echo sed then "$1" local /usr/bin | x=1 export sed "$1"
+--verbose then printf "$1" cd awk ${HOME} export local $(pwd) local cd --verbose
+		awk 'quoted text' --verbose local ${HOME} && --verbose
+	grep test then echo export "$@" "$@"
+	cd awk "$1" "$@" 'quoted text' echo awk "$@" x=1 ${HOME}
+readonly printf awk --verbose test grep awk x=1 readonly then
+		grep awk ${HOME} "$@" done --verbose --verbose --verbose
+${HOME} x=1 done export cd sed
+	echo && 'quoted text'
+		local grep done -eu local grep done sed 'quoted text'
+${HOME} ${HOME} readonly "$1" sed --verbose export --verbose
+2>/dev/null echo 'quoted text' --verbose 2>/dev/null grep
+	then awk -eu awk echo -eu awk sed done done cd readonly --verbose
+		grep --verbose $(pwd) "$1" export
+		then awk 'quoted text' ${HOME} $(pwd) grep done && test /usr/bin
+		grep then grep 'quoted text'
+	sed done grep then readonly $(pwd) done
+local awk $(pwd) x=1 $(pwd) ${HOME} test
+	grep awk done -eu test x=1 readonly "$1" -eu && export -eu sed && $(pwd)
+"$1" readonly test "$1" $(pwd) $(pwd) "$@" --verbose
+		export test "$1" --verbose x=1 -eu "$@" awk export --verbose readonly
+	--verbose "$1" printf "$@" awk 'quoted text' cd
+&& awk --verbose --verbose ${HOME} $(pwd) printf cd cd --verbose awk then
+	"$@" sed printf printf printf ${HOME} export -eu "$@" ${HOME} "$@" awk done local
+		local echo && ${HOME} printf --verbose export local | -eu local awk readonly
+		cd "$@" readonly -eu echo && /usr/bin
+	"$1" /usr/bin sed echo then grep printf 'quoted text' $(pwd)
+local local && "$1" && | sed local
+test /usr/bin -eu $(pwd) sed ${HOME}
+	| --verbose --verbose test readonly
+		grep readonly awk | printf test local local local
+	/usr/bin test cd ${HOME} /usr/bin "$@" -eu 2>/dev/null "$1" ${HOME}
+	"$@" export awk -eu printf local 'quoted text' readonly /usr/bin
+'quoted text' 2>/dev/null /usr/bin export test grep -eu local "$1" cd done done
+${HOME} --verbose printf x=1 /usr/bin ${HOME} | done cd "$@"
+	${HOME} "$1" test sed test ${HOME} 'quoted text' &&
+'quoted text' readonly grep --verbose && grep awk awk then
+	export cd | echo && "$@" -eu | sed readonly /usr/bin 2>/dev/null
+	-eu "$1" local x=1 --verbose "$@" cd $(pwd) /usr/bin "$1" test --verbose /usr/bin
+$(pwd) grep 2>/dev/null "$1" local readonly "$1" && sed then 'quoted text' export
+		printf && local then | ${HOME} grep grep "$1" "$@" ${HOME}
+	x=1 done $(pwd) done "$@" | awk && /usr/bin printf
+		test 2>/dev/null then readonly
+	sed printf | export $(pwd) --verbose x=1
+	done readonly "$1" readonly readonly local done readonly done printf
+	/usr/bin "$1" test cd "$@"
+"$1" printf ${HOME} done sed 2>/dev/null "$1" | "$@" ${HOME}
+	readonly awk ${HOME} "$@" sed cd echo
+	awk | $(pwd) export 2>/dev/null done && ${HOME} readonly sed && $(pwd) awk readonly
+		test awk echo && 'quoted text' "$1" readonly 'quoted text' "$1"
+	echo && printf then --verbose --verbose 'quoted text' echo grep $(pwd)
+sed echo /usr/bin $(pwd) "$@"
+		-eu awk then printf echo x=1 | export awk x=1 awk echo 2>/dev/null 'quoted text'
+	done && echo --verbose "$@" 'quoted text' ${HOME} 'quoted text' x=1 printf $(pwd)
+test awk && sed sed echo
+		| --verbose export x=1
+test readonly test -eu -eu 'quoted text'
+	/usr/bin /usr/bin test && done readonly ${HOME} -eu 2>/dev/null
+"$@" printf "$1" x=1 awk then "$@" then then --verbose readonly $(pwd)
+	done cd readonly ${HOME} $(pwd)
+		-eu $(pwd) cd printf printf readonly then export 2>/dev/null
+"$@" && $(pwd) | cd sed 2>/dev/null
+awk 2>/dev/null ${HOME} --verbose test local -eu 2>/dev/null
+sed 'quoted text' --verbose 2>/dev/null 2>/dev/null readonly printf
+	grep /usr/bin "$@" local "$@" echo
+		export export && echo awk
+	| grep /usr/bin && 'quoted text' cd local
+		"$1" "$1" "$1" done test then export sed
+local readonly --verbose "$1" awk echo export
+	sed then 2>/dev/null done readonly x=1 printf -eu "$@" x=1 cd sed cd
+	readonly export --verbose export -eu -eu -eu done $(pwd)
+$(pwd) --verbose done printf printf 'quoted text' | then && awk /usr/bin
+done readonly ${HOME} sed done | 'quoted text'
+		&& -eu done export 'quoted text'
+	/usr/bin grep 2>/dev/null grep "$1" &&
+readonly 2>/dev/null readonly
+	export "$1" --verbose -eu echo $(pwd) awk ${HOME} "$@" printf
+'quoted text' $(pwd) awk && export /usr/bin --verbose ${HOME} 'quoted text'
+		test 'quoted text' | -eu ${HOME} done --verbose ${HOME} ${HOME}
+	x=1 then && 2>/dev/null | 2>/dev/null done printf local -eu local cd
+	export readonly && cd ${HOME} test "$@" test x=1 local "$1" test export
+		"$@" $(pwd) grep ${HOME} x=1 /usr/bin awk ${HOME}
+test --verbose 'quoted text' $(pwd) x=1 cd cd grep x=1 ${HOME}
+	x=1 | --verbose then local printf -eu
+	&& && "$1" --verbose && 'quoted text' --verbose ${HOME} cd | cd
+		'quoted text' --verbose | echo
+		cd sed 2>/dev/null readonly x=1 printf export 2>/dev/null printf "$@" cd --verbose
+--verbose -eu sed "$@" awk $(pwd) $(pwd) printf test
+$(pwd) 2>/dev/null echo 'quoted text' 'quoted text'
+		test sed awk test local "$@" then done x=1 ${HOME} 2>/dev/null readonly cd sed
+	printf local readonly | grep "$1" then
+		"$@" cd done printf "$1" local | "$1" printf "$1" x=1 sed printf test printf
+echo /usr/bin --verbose export "$@" test -eu local printf done
+/usr/bin sed sed "$1" $(pwd) --verbose done 2>/dev/null awk | export "$@" $(pwd)
+echo export --verbose --verbose then 'quoted text'
+		awk sed /usr/bin awk echo export
+	awk ${HOME} "$1" -eu echo
+${HOME} cd then done echo then x=1 then readonly -eu export
+/usr/bin awk /usr/bin -eu readonly "$@" "$@" grep && $(pwd)
+	awk | export then readonly | "$1" export -eu local
+		then then export awk then | --verbose "$@" -eu 2>/dev/null
+"$@" $(pwd) /usr/bin test -eu && -eu
+$(pwd) && --verbose printf awk "$@" x=1 readonly $(pwd)
+		x=1 "$@" --verbose 2>/dev/null -eu /usr/bin
+		"$1" test export --verbose done grep | 2>/dev/null awk
+		${HOME} "$@" test export awk cd then readonly --verbose readonly local --verbose
+	awk then /usr/bin 2>/dev/null done local local ${HOME} done -eu
+x=1 x=1 awk x=1 test cd sed --verbose "$1" /usr/bin printf
+awk "$@" | 'quoted text' 2>/dev/null
+		"$1" echo 2>/dev/null printf printf done $(pwd)
+done awk test x=1 | then -eu local && readonly
+	test 'quoted text' "$1" 'quoted text' then ${HOME} -eu
+2>/dev/null printf test "$1"
+		readonly && 2>/dev/null 2>/dev/null /usr/bin export done
+x=1 test /usr/bin -eu sed printf local -eu && local grep /usr/bin /usr/bin --verbose
+then --verbose "$@" echo readonly then "$@" export
+	sed 'quoted text' readonly
+"$1" 'quoted text' ${HOME} | printf | $(pwd) | "$1" then x=1 awk
+'quoted text' grep sed done ${HOME} $(pwd) then 'quoted text' done local 'quoted text'
+	"$@" "$1" | local then 2>/dev/null awk "$1" 'quoted text' x=1
+	test export export -eu 2>/dev/null
+local --verbose | | export && local export
+2>/dev/null "$@" 2>/dev/null "$1" printf | -eu
+	awk export export "$@" then | done $(pwd)
+		sed 'quoted text' 'quoted text' "$@" | "$@" x=1 sed grep /usr/bin echo printf "$@"
+	| "$@" test $(pwd) sed "$1" "$1" && grep -eu x=1 "$@" $(pwd) "$1" then -eu test
+done "$@" "$1" x=1 $(pwd) "$@" grep x=1 printf "$@" | readonly echo
+	${HOME} | /usr/bin test printf export 2>/dev/null
+| local cd then "$@" then done x=1 sed "$1" readonly printf
+		grep export -eu -eu printf export
+-eu local local | export "$@"
+	| "$@" 'quoted text' grep && awk sed awk printf /usr/bin cd /usr/bin cd test
+		$(pwd) 2>/dev/null ${HOME} sed grep sed x=1 && then ${HOME}
+		x=1 done readonly local test
+echo test readonly awk test 2>/dev/null 'quoted text'
+		printf /usr/bin local x=1 -eu | "$@" "$@" |
+awk /usr/bin --verbose -eu "$@" -eu "$@" -eu 2>/dev/null
+		/usr/bin awk ${HOME} then local 2>/dev/null -eu test cd printf local grep
+		2>/dev/null printf "$1" cd sed local test printf 2>/dev/null
+${HOME} printf -eu 2>/dev/null
+	local | local $(pwd) "$@" $(pwd)
+	then "$1" /usr/bin $(pwd) then
+	sed then cd grep | done
+		${HOME} --verbose -eu ${HOME} printf then 2>/dev/null
+${HOME} 2>/dev/null cd && /usr/bin ${HOME} grep 'quoted text' /usr/bin printf
+/usr/bin --verbose printf | sed test readonly echo ${HOME} awk local readonly
+echo ${HOME} export x=1 -eu then && export grep printf local
+		echo --verbose awk ${HOME}
+&& && export "$@" echo printf ${HOME} local ${HOME} "$@" x=1 then sed
+		"$1" $(pwd) printf 'quoted text' --verbose grep readonly
+grep 2>/dev/null readonly
+		2>/dev/null printf echo | sed readonly readonly echo 'quoted text'
+grep x=1 2>/dev/null test
+'quoted text' ${HOME} -eu test done "$@" 'quoted text' && sed && readonly
+	printf cd done $(pwd) "$1" ${HOME} printf -eu ${HOME} "$1" readonly $(pwd)
+	"$1" printf --verbose | --verbose $(pwd) x=1 local
+| readonly $(pwd) "$@" $(pwd) "$@" echo printf awk cd printf "$@"
+	done echo done test 'quoted text' && &&
+grep sed $(pwd) printf test local test grep grep cd 2>/dev/null readonly
+	awk echo /usr/bin printf | "$1" "$@" then local x=1 -eu | x=1
+	${HOME} then | $(pwd) | $(pwd) readonly "$1" then test "$@" echo grep grep
+		--verbose "$1" ${HOME} /usr/bin
+		local $(pwd) printf 'quoted text' readonly 'quoted text' $(pwd) grep cd x=1 x=1
+--verbose awk test --verbose | | "$@" readonly
+		&& ${HOME} then -eu "$1" && -eu 'quoted text'
+	echo test 2>/dev/null | $(pwd) ${HOME} test readonly
+	readonly /usr/bin export done test grep $(pwd) | export sed cd sed
+	awk "$1" done done test
+| awk echo cd echo export sed "$@" cd grep echo awk
+		"$1" /usr/bin "$1" 'quoted text'
+"$1" echo x=1 x=1 x=1 x=1
+		printf 2>/dev/null done | readonly awk $(pwd) cd cd x=1 | | printf test
+	local readonly cd 'quoted text' 'quoted text' ${HOME} 2>/dev/null then
+	--verbose then echo /usr/bin --verbose printf echo
+	local | $(pwd) test sed "$1" echo
+done /usr/bin -eu sed grep /usr/bin awk printf
+		"$1" awk grep $(pwd) | export /usr/bin 'quoted text' &&
+		awk x=1 ${HOME} test grep
+	awk sed done ${HOME} "$1" 'quoted text' grep sed sed 'quoted text' cd sed
+		grep awk "$1" local cd sed test sed | $(pwd) grep ${HOME} 2>/dev/null
+grep echo 'quoted text' 'quoted text'
+		2>/dev/null done cd grep "$1" /usr/bin "$1"
+		${HOME} echo echo /usr/bin
+		x=1 grep /usr/bin readonly local "$@" ${HOME} export ${HOME} /usr/bin
+	"$@" readonly export | | then | cd cd
+	"$@" && readonly done export ${HOME} grep sed $(pwd) local sed printf
+echo /usr/bin sed /usr/bin "$@" readonly local --verbose "$1" ${HOME} then
+	-eu local then awk && x=1 $(pwd) grep /usr/bin
+		"$1" && grep done printf $(pwd) awk local test test && done printf
+	"$@" grep then ${HOME} && -eu 2>/dev/null --verbose
+"$@" x=1 awk $(pwd) 'quoted text' $(pwd) then
+echo x=1 -eu "$1" then x=1 ${HOME} "$1" x=1 'quoted text' "$1" &&
+	test readonly 'quoted text' done printf 'quoted text'
+		done cd grep | 'quoted text' --verbose "$1" --verbose cd /usr/bin grep "$1" test
+	2>/dev/null --verbose /usr/bin
+	x=1 && sed | then --verbose
+export export grep | x=1 sed cd grep local printf 2>/dev/null --verbose
+		export ${HOME} 2>/dev/null -eu --verbose --verbose
+2>/dev/null $(pwd) && --verbose then awk ${HOME} x=1
+	'quoted text' awk local "$1" printf sed
+	"$1" then done 'quoted text' echo &&
+	x=1 2>/dev/null sed then
+		test readonly cd x=1 -eu export $(pwd) done printf "$1" local local awk 'quoted text'
+"$@" "$@" printf 2>/dev/null sed "$@" local export "$@" -eu
+		"$1" cd then awk test echo /usr/bin
+"$@" test echo && readonly $(pwd) readonly printf $(pwd) echo --verbose
+		readonly "$@" local x=1 -eu awk "$@" readonly local
+printf grep readonly cd awk $(pwd) export awk && 2>/dev/null
+--verbose local cd -eu -eu test --verbose grep $(pwd) done
+x=1 done awk echo test $(pwd)
+		printf export "$@" --verbose grep | test $(pwd) | test x=1 then $(pwd) cd echo -eu
+		done then printf ${HOME} x=1 test
+echo done grep -eu "$1" 2>/dev/null sed -eu
+	cd -eu 2>/dev/null 'quoted text' export -eu $(pwd) sed then ${HOME} | $(pwd)
+	'quoted text' sed sed export 'quoted text'
+	readonly awk readonly then local export
+		-eu && "$1" "$1" then export done then ${HOME} readonly
+		echo --verbose cd 2>/dev/null
+		| export then && cd cd test cd | cd printf export export x=1
+		cd sed cd | "$@" printf --verbose printf 2>/dev/null grep grep then then | sed x=1
+	printf awk $(pwd) readonly -eu printf cd echo 2>/dev/null printf && && "$@" echo
+		x=1 export 'quoted text' printf readonly -eu printf test "$1"
+&& | grep ${HOME} "$1" awk 2>/dev/null /usr/bin && ${HOME} printf 2>/dev/null
+		awk | /usr/bin 2>/dev/null --verbose echo /usr/bin
+grep $(pwd) --verbose $(pwd) -eu "$@" export printf sed
+		test done --verbose then done "$1" done local
+		echo --verbose $(pwd) awk local printf
+	export ${HOME} /usr/bin printf printf readonly
+	| awk export grep test test
+		then "$1" && "$1" test "$1" readonly local -eu
+	sed "$1" "$1" x=1 ${HOME} 2>/dev/null
+	-eu | $(pwd) awk then echo "$1" printf
+export then sed 'quoted text' then sed grep && printf $(pwd) readonly grep --verbose
+		then printf --verbose then 'quoted text' echo ${HOME} ${HOME} && test printf
+		export "$1" readonly sed $(pwd) --verbose
+		--verbose echo readonly /usr/bin
+grep done $(pwd) /usr/bin /usr/bin | /usr/bin cd
+		-eu grep then grep grep /usr/bin cd sed awk
+	local awk 2>/dev/null done echo printf sed
+	-eu "$1" cd cd && "$1" -eu awk awk export "$@" readonly
+then 'quoted text' grep
+	x=1 printf --verbose echo sed x=1 /usr/bin export ${HOME} test then 'quoted text'
+	&& "$@" $(pwd) then 2>/dev/null 'quoted text'
+	awk --verbose then "$1" awk awk echo grep --verbose cd
+'quoted text' | "$@" export -eu "$@" local /usr/bin 'quoted text'
+	then export ${HOME} 2>/dev/null printf cd cd 2>/dev/null readonly echo sed
+	"$1" x=1 printf done cd then | ${HOME} done sed -eu
+"$@" /usr/bin cd | 2>/dev/null x=1 export --verbose
+		&& cd /usr/bin done && readonly grep then sed local "$1" local -eu "$@" awk readonly
+		echo 'quoted text' grep then then test
+| done 2>/dev/null $(pwd) 'quoted text' $(pwd) ${HOME} grep echo echo $(pwd) printf
+		'quoted text' test local ${HOME} 'quoted text'
+done then grep --verbose export cd grep
+| sed -eu local $(pwd) ${HOME} then then x=1 "$1"
+		${HOME} 'quoted text' awk
+	test cd ${HOME} "$@" "$1" | echo test | cd echo
+2>/dev/null test -eu "$@" | sed | -eu "$1"
+		"$@" grep 2>/dev/null sed
+test test then $(pwd) "$1" sed grep sed && -eu | 2>/dev/null | echo export
+x=1 echo test export --verbose awk awk awk awk printf cd
+		readonly x=1 "$1" local done
+		'quoted text' 'quoted text' -eu readonly ${HOME} local sed /usr/bin
+2>/dev/null /usr/bin x=1 test test | && --verbose local cd done then ${HOME}
+export echo then ${HOME}
+echo ${HOME} ${HOME} --verbose /usr/bin --verbose printf
+grep done && 'quoted text' && -eu cd -eu readonly then -eu
+readonly | "$1" 'quoted text' sed awk echo grep -eu done -eu
+		"$@" | /usr/bin readonly sed cd ${HOME} && "$1" export "$@" --verbose awk
+done /usr/bin local "$@" test done grep && | cd | 'quoted text' |
+	printf local grep export x=1 2>/dev/null readonly 2>/dev/null
+		--verbose --verbose export sed printf 2>/dev/null test -eu -eu 2>/dev/null
+	--verbose "$@" done "$@" /usr/bin -eu echo local -eu "$1"
+"$1" 2>/dev/null sed 'quoted text' 'quoted text' && then "$@" local 'quoted text'
+	| done printf "$1" local
+		x=1 ${HOME} && printf local /usr/bin 2>/dev/null ${HOME} -eu echo
+		x=1 done echo sed "$@" | -eu --verbose
+	local printf sed local grep 'quoted text' awk && export
+-eu export test "$@" "$@" awk "$@" grep sed $(pwd) cd 2>/dev/null local grep
+	cd "$1" cd ${HOME} x=1 | done | 2>/dev/null grep 'quoted text' printf
+	echo done cd ${HOME} readonly ${HOME} && readonly
+	--verbose /usr/bin export sed export sed echo echo 'quoted text' awk "$1" then
+--verbose then awk 2>/dev/null /usr/bin "$1" "$1" test export
+	readonly 2>/dev/null "$1" | &&
+	-eu sed printf printf 'quoted text' 2>/dev/null
+		then -eu ${HOME} -eu -eu readonly then "$1" x=1 export -eu test --verbose
+		$(pwd) awk x=1 readonly x=1 "$1" 2>/dev/null --verbose 'quoted text'
+"$@" grep ${HOME} $(pwd) then /usr/bin local test &&
+--verbose readonly "$1" awk awk x=1 &&
+	2>/dev/null && test /usr/bin
+echo -eu 2>/dev/null printf --verbose done awk && cd
+		then grep sed 'quoted text'
+/usr/bin awk then && --verbose then ${HOME} ${HOME} "$1" 2>/dev/null local grep
+	grep "$1" "$1" done --verbose readonly -eu "$1" 2>/dev/null
+	$(pwd) "$1" echo then printf -eu | /usr/bin export cd
+sed test && then echo echo
+		/usr/bin /usr/bin local /usr/bin "$1" 'quoted text' done | ${HOME}
+	$(pwd) echo "$1" x=1 local sed readonly $(pwd) -eu
+		-eu | cd --verbose "$@" sed sed 'quoted text' done "$1" | printf
+	sed && && /usr/bin -eu ${HOME} "$@" export
+		2>/dev/null sed --verbose cd /usr/bin --verbose "$1" readonly 2>/dev/null
+	printf then readonly sed sed 2>/dev/null
+		test --verbose then done "$@" done then && ${HOME} && --verbose
+	&& ${HOME} 2>/dev/null && /usr/bin
+"$@" && local && export /usr/bin
+x=1 && cd "$@" grep sed printf $(pwd) "$1" -eu then | --verbose
+	test --verbose | grep ${HOME} cd "$1" 2>/dev/null done
+printf "$1" -eu awk 'quoted text' export cd grep then $(pwd) "$@" | $(pwd)
+		"$1" && readonly cd sed
+	local grep local readonly echo
+		readonly $(pwd) x=1 readonly
+		grep local echo && local x=1 "$1" awk 'quoted text' 2>/dev/null grep /usr/bin
+	export then --verbose 2>/dev/null -eu "$1" awk 'quoted text' grep cd --verbose
+	awk sed export $(pwd) sed readonly -eu --verbose sed
+	done ${HOME} sed && &&
+	${HOME} grep 2>/dev/null printf
+--verbose export /usr/bin then awk $(pwd) 'quoted text'
+sed then /usr/bin /usr/bin test x=1
+&& cd "$@" 2>/dev/null ${HOME} cd cd then 'quoted text' export /usr/bin $(pwd)
+	readonly $(pwd) ${HOME} --verbose
+$(pwd) 2>/dev/null test export
+		/usr/bin 2>/dev/null 2>/dev/null cd done x=1 printf
+	export export 'quoted text' local 2>/dev/null
+2>/dev/null export echo
+		test test --verbose export readonly "$1" x=1 'quoted text' export --verbose
+echo x=1 'quoted text' /usr/bin then export x=1 sed "$@" &&
+--verbose readonly readonly test
+		awk -eu awk && ${HOME} readonly --verbose printf export | -eu
+		printf done echo "$@" test 2>/dev/null awk echo 2>/dev/null printf -eu -eu
+then awk ${HOME} 'quoted text' local test
+	printf x=1 sed --verbose
+test sed ${HOME} sed 'quoted text' sed readonly cd "$1" printf echo export
+		sed then local sed /usr/bin
+		readonly "$@" printf echo
+	| local sed test 2>/dev/null --verbose done test "$1" test sed
+	grep printf -eu -eu 'quoted text' ${HOME} "$@" "$1" "$1" && 2>/dev/null printf
+	'quoted text' /usr/bin | echo awk 'quoted text' "$1" done 'quoted text' 'quoted text'
+	echo /usr/bin sed "$1" "$@" echo ${HOME} | /usr/bin -eu | 2>/dev/null --verbose
+-eu --verbose awk export printf local readonly
+	-eu export 2>/dev/null echo ${HOME} x=1 grep "$@" $(pwd) 'quoted text' /usr/bin
+test 'quoted text' cd done grep echo then printf $(pwd) 2>/dev/null test x=1
+		x=1 --verbose local readonly /usr/bin done local "$@"
+		awk | ${HOME} $(pwd) sed export local 'quoted text' export grep
+&& cd test readonly cd && cd echo "$1"
+	"$1" printf && 2>/dev/null awk 2>/dev/null -eu ${HOME}
+		| -eu cd "$1" && 2>/dev/null -eu ${HOME} test && 'quoted text' grep
+		then grep readonly --verbose
+		export export sed grep export $(pwd) 2>/dev/null done
+	"$@" done done $(pwd) test $(pwd)
+	$(pwd) local awk | local echo printf -eu then && /usr/bin done "$1" cd --verbose
+'quoted text' $(pwd) awk $(pwd) local "$1" grep printf "$1" | awk done
+$(pwd) then $(pwd) && --verbose done 'quoted text' $(pwd) readonly "$@"
+	done "$@" awk "$1" awk echo echo printf -eu
+	x=1 local /usr/bin --verbose
+awk -eu test readonly ${HOME} && test awk -eu /usr/bin ${HOME} "$@" $(pwd)
+		printf && grep x=1 readonly | export
+	'quoted text' "$@" "$@"
+awk "$@" readonly && sed cd sed --verbose 'quoted text'
+		x=1 "$1" 'quoted text' test cd 'quoted text' export -eu readonly then export
+		&& "$1" local && printf then sed then printf readonly 'quoted text' then ${HOME}
+	done printf echo 'quoted text' grep x=1 cd grep sed done export
+	done --verbose awk awk sed local cd then && local | export local
+	local local local readonly then
+	-eu 2>/dev/null $(pwd) | "$@" $(pwd) --verbose awk printf sed then
+readonly then 'quoted text' -eu | export --verbose
+readonly test grep && 2>/dev/null
+	local test "$@" local && && $(pwd)
+cd x=1 "$1" && -eu grep $(pwd) sed echo readonly --verbose $(pwd) echo sed
+		"$@" done "$1" test then echo "$1" done grep
+		grep printf ${HOME} then
+	awk readonly readonly export awk local done awk 'quoted text' cd done then
+x=1 && cd grep x=1 /usr/bin local cd ${HOME} then readonly then
+		"$@" ${HOME} --verbose
+readonly test done | sed then --verbose test $(pwd) 'quoted text' local test grep
+	2>/dev/null grep readonly
+	--verbose /usr/bin /usr/bin /usr/bin "$1" ${HOME} /usr/bin && --verbose &&
+2>/dev/null 2>/dev/null /usr/bin sed readonly --verbose
+"$1" $(pwd) && /usr/bin
+		printf $(pwd) then export printf test test sed /usr/bin 2>/dev/null
+		printf echo 'quoted text' 2>/dev/null awk export "$@" echo 2>/dev/null
+		test 'quoted text' local echo export $(pwd)
+	'quoted text' --verbose export && readonly sed then awk ${HOME} && printf /usr/bin
+		x=1 'quoted text' done export printf printf 'quoted text' test cd | x=1
+-eu echo cd -eu --verbose then test sed /usr/bin -eu && && ${HOME} cd &&
+		cd ${HOME} $(pwd) done then export test | sed grep readonly | "$@" 'quoted text'
+--verbose $(pwd) $(pwd) echo --verbose 'quoted text' printf -eu sed then sed printf
+sed printf /usr/bin local 'quoted text'
+	readonly printf sed /usr/bin cd | 2>/dev/null --verbose 'quoted text' ${HOME}
+		--verbose x=1 done $(pwd) then printf "$@" echo sed test readonly
+		-eu -eu ${HOME} export
+		"$@" | printf then test 2>/dev/null
+	&& /usr/bin export sed
+-eu && sed local && ${HOME} printf $(pwd) | -eu 'quoted text' local
+	done local -eu done done local --verbose grep readonly "$@" 2>/dev/null
+		then "$@" grep /usr/bin 2>/dev/null 2>/dev/null sed 2>/dev/null | grep -eu
+	export 2>/dev/null grep "$@" -eu grep local printf then grep
+	| 'quoted text' /usr/bin --verbose printf /usr/bin sed
+	awk echo && sed 'quoted text' test then export printf
+		2>/dev/null 'quoted text'
+	${HOME} 2>/dev/null awk export readonly
+		-eu "$1" echo --verbose echo $(pwd) -eu export then ${HOME}
+		grep "$@" x=1 awk ${HOME}
+		cd then -eu $(pwd) sed sed && test done ${HOME} cd cd $(pwd)
+	'quoted text' printf echo
+		test awk then grep test && awk
+	"$1" sed echo awk awk local export done
+-eu export | sed echo --verbose x=1
+export printf local | ${HOME} echo 'quoted text' test local
+	| then ${HOME} test local echo "$@" cd | "$@" /usr/bin
+		printf | echo test then awk "$1" printf grep && cd "$1"
+sed then cd echo /usr/bin readonly -eu sed cd ${HOME} printf readonly --verbose
+	| $(pwd) -eu then | --verbose
+echo readonly | && export local export readonly -eu readonly
+	${HOME} printf 'quoted text' 2>/dev/null
+grep done export --verbose grep "$@" && "$@" printf ${HOME} "$1"
+		--verbose printf then printf sed grep
+	cd awk printf /usr/bin x=1 local 'quoted text'
+/usr/bin --verbose done echo test "$1" echo $(pwd) echo
+	'quoted text' "$@" awk awk awk $(pwd) -eu test --verbose
+		&& sed -eu "$@" readonly export printf done "$@" sed $(pwd) ${HOME} grep
+then test then "$1" echo | local grep echo done | sed "$@"
+&& --verbose sed /usr/bin $(pwd) done export "$@" printf cd
+sed "$@" export echo local export then echo awk /usr/bin
+	x=1 -eu ${HOME} test /usr/bin export export then
+		${HOME} -eu "$@" x=1 export "$@" "$1" -eu $(pwd) "$@" local /usr/bin
+/usr/bin echo done && --verbose then $(pwd) /usr/bin echo /usr/bin
+grep cd export done test echo && printf
+		echo readonly | export --verbose readonly sed --verbose "$1" "$@" "$1" $(pwd) printf
+/usr/bin -eu | awk echo done printf echo awk
+| "$@" grep sed /usr/bin /usr/bin grep | "$1" grep
+	sed && echo 'quoted text'
+	$(pwd) echo then test 2>/dev/null sed printf
+	awk --verbose test cd 2>/dev/null && grep echo 'quoted text' &&
+		${HOME} printf done sed done "$1" printf awk x=1 printf | 'quoted text'
+echo "$1" local export test && "$@" -eu
+		printf 'quoted text' export grep sed cd local cd test
+2>/dev/null test x=1 echo x=1 awk ${HOME}
+	sed --verbose sed readonly $(pwd) $(pwd) 'quoted text' done awk
+	grep x=1 ${HOME} printf echo sed grep
+export && /usr/bin local ${HOME} --verbose | local $(pwd)
+readonly sed grep awk "$@" readonly echo export 'quoted text'
+	readonly sed sed printf
+		/usr/bin printf --verbose cd export
+	$(pwd) echo x=1 export x=1 cd x=1 local cd | local printf
+	$(pwd) local awk /usr/bin
+	${HOME} done && readonly test "$1" readonly 2>/dev/null grep
+		local $(pwd) export /usr/bin --verbose 2>/dev/null sed "$1" cd /usr/bin
+awk | done echo then then
+--verbose grep -eu 'quoted text'
+	grep echo "$1" x=1 && echo export 2>/dev/null ${HOME} | local grep export 2>/dev/null
+		${HOME} ${HOME} && ${HOME} "$@" 2>/dev/null ${HOME} "$1" local "$@"
+| && /usr/bin ${HOME} echo export done grep 'quoted text'
+	grep x=1 2>/dev/null cd "$@" done
+$(pwd) grep echo "$1" export readonly printf then
+	done done awk cd /usr/bin
+x=1 && sed awk then && 2>/dev/null 'quoted text' "$1" 'quoted text' done
+		x=1 cd grep done readonly 2>/dev/null
+cd printf 2>/dev/null -eu sed sed local export then echo then readonly awk
+		/usr/bin 'quoted text' /usr/bin --verbose test
+-eu /usr/bin test ${HOME}
+		2>/dev/null local echo sed test sed export 'quoted text' sed awk
+	grep test done cd done then done echo $(pwd) printf test test | 'quoted text' --verbose
+		${HOME} awk done --verbose
+	x=1 "$1" /usr/bin /usr/bin done sed 2>/dev/null local test echo then &&
+		done /usr/bin "$1" done 2>/dev/null
+		export grep printf "$1" --verbose
+		${HOME} grep sed --verbose x=1 export "$1" grep ${HOME} then awk 'quoted text'
+		grep done "$1" printf -eu readonly grep x=1 -eu "$1" done printf export printf
+| /usr/bin --verbose x=1 export 2>/dev/null
+		"$1" then awk export cd "$1" then done
+"$@" 2>/dev/null local /usr/bin x=1 --verbose
+local "$@" | "$1" | ${HOME} printf x=1 readonly ${HOME} export
+readonly cd "$@" --verbose grep echo test local echo "$1" && test
+		grep "$@" printf cd x=1 readonly "$1" /usr/bin
+local "$@" grep awk "$1" "$1" | $(pwd) grep 2>/dev/null then $(pwd)
+		awk ${HOME} awk local ${HOME} local grep
+	echo printf --verbose export /usr/bin readonly sed "$@" "$1" $(pwd) x=1
+-eu "$1" --verbose ${HOME} cd | ${HOME} grep "$@" done -eu "$@"
+echo awk x=1 ${HOME} then /usr/bin
+		&& 2>/dev/null --verbose 2>/dev/null ${HOME} local "$1" awk sed ${HOME}
+grep sed test grep awk
+then --verbose | sed printf $(pwd) | --verbose ${HOME} -eu
+	awk -eu $(pwd) 'quoted text' sed export && 2>/dev/null "$@" --verbose
+awk x=1 cd cd export then ${HOME} printf "$1" /usr/bin test echo && 2>/dev/null
+		/usr/bin export then test "$1"
+done /usr/bin "$@" test "$1" done | export "$1" /usr/bin "$@" 'quoted text' export
+sed 'quoted text' "$@" sed awk ${HOME} x=1 "$1" readonly x=1 grep export "$@"
+		grep readonly readonly sed "$@" echo export && "$1" x=1
+		'quoted text' "$1" local -eu ${HOME}
+"$1" x=1 x=1 then -eu 2>/dev/null --verbose export awk --verbose
+		"$1" ${HOME} then done && awk done grep /usr/bin
+	done grep export readonly done 2>/dev/null local 2>/dev/null
+x=1 2>/dev/null | grep | "$@" "$@" local /usr/bin 'quoted text'
+		"$1" -eu readonly sed test printf
+${HOME} "$@" awk export 2>/dev/null -eu grep echo printf test export
+	sed $(pwd) $(pwd) 2>/dev/null
+-eu x=1 export | 'quoted text' ${HOME} cd printf 'quoted text' done
+		/usr/bin "$@" "$1" $(pwd) then 'quoted text' local
+		-eu ${HOME} ${HOME} 'quoted text' /usr/bin && -eu echo "$1" ${HOME}
+	$(pwd) /usr/bin echo --verbose
+		test | done export --verbose -eu -eu ${HOME} printf /usr/bin then
+$(pwd) sed 'quoted text' | | /usr/bin then
+	2>/dev/null sed awk --verbose "$@" cd printf
+awk "$@" /usr/bin | --verbose && $(pwd) export "$1" printf local sed "$1" sed
+		done awk done echo $(pwd) readonly grep grep readonly
+		"$@" sed /usr/bin awk echo x=1 && sed done --verbose sed 2>/dev/null "$1" readonly
+	--verbose cd /usr/bin --verbose
+	/usr/bin awk x=1 "$1" ${HOME} readonly
+	x=1 'quoted text' 2>/dev/null
+	"$1" 2>/dev/null sed ${HOME}
+		local then $(pwd) --verbose export -eu -eu -eu readonly sed --verbose
+--verbose local cd ${HOME} then done --verbose --verbose
+		&& | export x=1 | printf /usr/bin cd export
+	&& $(pwd) local "$1" grep ${HOME} readonly x=1 "$@"
+readonly x=1 test cd --verbose -eu --verbose "$@" x=1 'quoted text'
+		printf "$1" && sed printf | export $(pwd) "$1" awk done grep && | $(pwd)
+	awk awk 2>/dev/null printf done test 'quoted text'
+		local grep $(pwd) && "$1" done local x=1 && "$1" test ${HOME} && then sed
+grep "$1" | grep grep x=1 "$1" &&
+x=1 then cd /usr/bin $(pwd) echo "$1" ${HOME} 2>/dev/null readonly --verbose
+		"$@" test echo ${HOME} --verbose ${HOME} x=1 "$@" $(pwd) $(pwd) grep x=1 /usr/bin
+${HOME} ${HOME} test sed local
+	/usr/bin x=1 then echo && awk
+&& && awk /usr/bin 2>/dev/null 2>/dev/null
+	grep "$@" awk awk $(pwd) then local
+		2>/dev/null printf && /usr/bin
+		$(pwd) && /usr/bin ${HOME} export cd sed cd "$1" 2>/dev/null
+x=1 readonly sed readonly && /usr/bin x=1 awk 'quoted text' -eu 2>/dev/null
+	grep grep readonly $(pwd) local x=1 echo ${HOME} "$1" && && /usr/bin 'quoted text'
+		"$@" | local 'quoted text' done then test ${HOME} printf done local awk "$@"
+		local --verbose cd test sed grep awk
+		readonly awk 'quoted text' /usr/bin sed sed awk
+done --verbose ${HOME} echo /usr/bin
+	"$@" then $(pwd) && test echo "$@" done printf printf then "$1" ${HOME}
+/usr/bin && then cd readonly && local done
+		test && /usr/bin && ${HOME} ${HOME} 2>/dev/null "$@" readonly "$@" done
+--verbose sed printf | /usr/bin then /usr/bin readonly | echo -eu
+		$(pwd) readonly /usr/bin $(pwd) && grep "$1" cd "$1" "$1"
+${HOME} 2>/dev/null done /usr/bin
+	/usr/bin then -eu printf 2>/dev/null awk done cd then awk 2>/dev/null &&
+	| 'quoted text' export then awk $(pwd) $(pwd) x=1 done cd awk "$1" x=1 local
+"$@" --verbose $(pwd) /usr/bin
+then x=1 export && -eu --verbose /usr/bin done
+		readonly | $(pwd) 2>/dev/null "$@" $(pwd)
+	cd 'quoted text' grep -eu 2>/dev/null echo done
+		| /usr/bin readonly && && && done printf $(pwd)
+printf cd $(pwd) 'quoted text' readonly
+		sed test readonly -eu grep x=1 awk readonly ${HOME} "$@"
+awk | "$@" /usr/bin local export
+	x=1 then echo local | export local -eu
+2>/dev/null | cd cd -eu $(pwd) cd | readonly echo "$1" $(pwd)
+		$(pwd) 'quoted text' sed && ${HOME}
+		export x=1 /usr/bin ${HOME} "$1" 2>/dev/null && test $(pwd) cd readonly awk "$@"
+	| 2>/dev/null "$@" "$@" test "$1" grep
+"$@" x=1 --verbose printf then && "$1"
+cd $(pwd) test sed sed local /usr/bin readonly
+&& /usr/bin printf test 2>/dev/null cd --verbose 'quoted text' awk
+		then $(pwd) cd test test -eu x=1 2>/dev/null 'quoted text' then x=1 | test
+		/usr/bin local cd local "$1" done export x=1 local $(pwd) export done
+		cd ${HOME} -eu "$1" done awk --verbose /usr/bin done "$1" printf done
+		done x=1 echo "$1" x=1 'quoted text' then test /usr/bin grep "$1"
+		2>/dev/null 'quoted text' "$@" done local done ${HOME}
+	then sed --verbose echo 'quoted text' --verbose done grep test grep --verbose
+		-eu 2>/dev/null cd -eu cd printf --verbose
+		| printf -eu awk sed cd 2>/dev/null awk
+readonly "$1" export test $(pwd) grep 'quoted text' awk 'quoted text'
+	then done /usr/bin cd export
+		/usr/bin test && 'quoted text' && -eu test ${HOME}
+export "$@" cd --verbose readonly readonly export
+		done readonly readonly 'quoted text'
+&& test /usr/bin "$1" && 'quoted text'
+	"$1" done export cd && local then $(pwd) echo "$@" test x=1 grep readonly
+done grep local echo readonly 'quoted text' test x=1 x=1 "$@" export "$1"
+printf | 2>/dev/null then printf export local ${HOME} echo local printf
+	"$1" 2>/dev/null readonly | test printf cd done grep readonly
+	awk $(pwd) "$1" local local | done x=1 local "$1"
+		test export sed test done printf
+	printf awk sed grep awk 2>/dev/null
+sed printf --verbose x=1 readonly x=1 /usr/bin "$@" printf cd x=1
+		x=1 2>/dev/null $(pwd) /usr/bin grep x=1 readonly --verbose printf --verbose
+echo echo 2>/dev/null cd | export done x=1 export awk done
+	export echo -eu "$1" "$@" readonly x=1 done test 'quoted text' x=1 &&
+		sed done readonly local && --verbose
+"$@" readonly ${HOME} awk /usr/bin
+		echo /usr/bin sed /usr/bin echo ${HOME} 2>/dev/null echo
+	printf echo -eu export x=1 done local local
+	$(pwd) printf local test "$1"
+		"$1" test && grep sed echo awk grep awk
+		--verbose cd /usr/bin cd export export echo grep
+	&& cd grep done awk done
+		grep && export cd -eu /usr/bin
+		${HOME} test then then | x=1 awk
+		"$1" sed export export echo then local
+	awk "$1" "$1" readonly 2>/dev/null grep | readonly local 2>/dev/null "$1"
+local /usr/bin printf then x=1 local /usr/bin -eu
+-eu printf local echo local test readonly printf
+readonly "$@" readonly && 'quoted text' sed sed x=1 /usr/bin
+	local 2>/dev/null export printf
+		grep "$@" test cd 2>/dev/null awk cd ${HOME} 2>/dev/null cd -eu readonly grep |
+		$(pwd) 2>/dev/null "$@" 'quoted text' local
+$(pwd) done printf x=1 /usr/bin readonly x=1 $(pwd) -eu
+printf readonly && awk local /usr/bin ${HOME} printf awk ${HOME} test | ${HOME}
+		readonly awk "$1" -eu echo readonly /usr/bin -eu grep --verbose -eu printf
+	local 'quoted text' /usr/bin grep
+	&& 2>/dev/null awk echo printf $(pwd) then $(pwd)
+2>/dev/null -eu echo cd cd done export 2>/dev/null
+	x=1 /usr/bin --verbose done sed /usr/bin --verbose sed test
+	$(pwd) printf | readonly local
+		test sed --verbose $(pwd) test ${HOME} done sed "$@" readonly
+		&& -eu /usr/bin done awk done $(pwd) export done "$1" then ${HOME}
+	printf test readonly sed x=1 /usr/bin export
+	local x=1 grep local export "$@" local /usr/bin then && then done x=1 'quoted text'
+		echo cd $(pwd) 'quoted text' local 'quoted text'
+"$@" printf echo done cd done done 2>/dev/null
+test --verbose && && local grep
+		export 2>/dev/null "$@" then local awk readonly 2>/dev/null
+	echo /usr/bin --verbose readonly awk cd -eu export test
+		'quoted text' local done readonly export test cd && printf -eu /usr/bin
+		"$1" ${HOME} grep && export
+		/usr/bin test grep $(pwd) then /usr/bin |
+		done readonly grep done 'quoted text' echo
+	awk printf --verbose sed done ${HOME} ${HOME}
+x=1 sed export echo test /usr/bin /usr/bin
+-eu --verbose x=1 "$1" 'quoted text' 2>/dev/null readonly $(pwd) printf test
+awk ${HOME} local printf 2>/dev/null done
+		cd | --verbose "$1" echo done done &&
+	${HOME} awk | && then cd test $(pwd) --verbose
+	readonly ${HOME} ${HOME} sed local
+sed $(pwd) $(pwd) printf export done /usr/bin 2>/dev/null cd /usr/bin 2>/dev/null
+	grep $(pwd) ${HOME} readonly test "$1" awk | x=1 | export
+	| cd "$1" readonly /usr/bin echo --verbose test 'quoted text'
+		-eu local grep $(pwd) export
+test printf x=1 export then "$1" export awk test | local
+grep && then x=1 x=1 2>/dev/null && 'quoted text'
+2>/dev/null /usr/bin printf "$1" then | printf cd 2>/dev/null echo awk && export
+		then done grep | export x=1 "$@" | grep export printf 2>/dev/null
+		done "$@" done $(pwd) cd then awk "$1" -eu | "$@"
+		grep ${HOME} local readonly $(pwd)
+awk grep echo echo && then done readonly readonly 2>/dev/null x=1 && sed
+	&& /usr/bin awk 'quoted text' done awk ${HOME} | "$1" echo && 2>/dev/null
+test -eu | awk done cd done
+		done /usr/bin "$1" --verbose export
+		readonly echo awk grep local then test readonly
+		2>/dev/null x=1 -eu $(pwd) grep test && $(pwd) --verbose $(pwd)
+| /usr/bin grep readonly ${HOME} "$@" 'quoted text' awk "$@" -eu -eu -eu
+	/usr/bin --verbose readonly test sed 2>/dev/null printf sed x=1 $(pwd)
+x=1 ${HOME} 2>/dev/null sed ${HOME} && export echo
+test test ${HOME} cd --verbose export export --verbose ${HOME} echo
+		| test -eu cd cd then then /usr/bin
+		export "$@" printf --verbose ${HOME} | "$1" "$1" grep then
+	grep $(pwd) printf done $(pwd) grep cd done export 2>/dev/null -eu --verbose "$@"
+	test && readonly $(pwd) x=1 then x=1
+grep cd -eu local done 2>/dev/null
+local export then --verbose "$@" readonly
+	test $(pwd) printf "$@" grep "$@" "$1"
+		grep echo local "$1" ${HOME} cd && -eu awk export ${HOME} 'quoted text' test
+		grep ${HOME} "$1" -eu "$@" -eu $(pwd)
+test && then --verbose && "$1" sed test /usr/bin cd 2>/dev/null
+		local 2>/dev/null "$@" 2>/dev/null export echo readonly sed awk
+cd $(pwd) then 2>/dev/null $(pwd) && --verbose awk 'quoted text'
+	test "$@" done cd sed 2>/dev/null
+	printf test 2>/dev/null 2>/dev/null
+	$(pwd) local "$@" "$1" sed "$1" readonly
+	done printf export | 'quoted text' echo then printf export 'quoted text'
+/usr/bin 2>/dev/null then cd --verbose then "$1" sed then echo
+export done | /usr/bin "$1" done export "$1"
+local cd && ${HOME} echo then
+		&& | done && -eu x=1 -eu cd x=1 grep -eu then
+	grep --verbose grep 'quoted text'
+x=1 readonly --verbose test cd
+		awk "$1" echo then test 2>/dev/null export x=1 local printf 2>/dev/null
+	$(pwd) grep 'quoted text' echo test && ${HOME} "$@" ${HOME} cd
+	awk readonly | sed done printf test echo 2>/dev/null sed cd ${HOME} grep
+	local done printf "$@" 'quoted text'
+	grep ${HOME} grep cd "$1" "$@" grep x=1 "$1" cd test x=1 test echo "$@" echo grep
+	x=1 printf 2>/dev/null x=1 x=1
+	"$1" "$@" /usr/bin grep local --verbose done
+		'quoted text' then echo 2>/dev/null done sed local export ${HOME} awk
+		grep "$1" && -eu then | ${HOME} grep -eu
+		-eu -eu then then 2>/dev/null
+readonly "$@" then awk && "$1" done && "$@" cd ${HOME} then grep grep /usr/bin
+then && | ${HOME} /usr/bin && grep local then --verbose
+	printf echo $(pwd) 'quoted text' --verbose 2>/dev/null
+cd "$1" -eu x=1 $(pwd) export
+		export && /usr/bin sed then echo readonly ${HOME} export done --verbose
+		${HOME} export --verbose 2>/dev/null readonly && && sed sed && grep cd
+	grep ${HOME} "$@" /usr/bin | "$1" 'quoted text' --verbose --verbose
+| | test sed export done cd | grep "$1" --verbose
+	export cd sed $(pwd) then $(pwd) test | "$1" then sed && | "$1" -eu sed
+	${HOME} awk "$1" awk test done sed
+"$@" export ${HOME} 2>/dev/null sed local export cd awk
+'quoted text' readonly cd 'quoted text' 'quoted text' local grep
+		sed export --verbose && cd -eu 2>/dev/null "$1"
+x=1 printf printf awk --verbose local done ${HOME} done local printf "$1"
+	then | "$1" 'quoted text'
+	awk printf then test | 'quoted text' "$1" readonly readonly export local
+${HOME} grep | grep export echo "$@" grep
+		then readonly echo local test $(pwd) $(pwd)
+		2>/dev/null sed done | 2>/dev/null
+		awk printf export done printf readonly echo test $(pwd) test --verbose && $(pwd)
+sed | ${HOME} /usr/bin then test $(pwd) echo $(pwd) && 2>/dev/null /usr/bin cd
+| $(pwd) printf export
+printf printf printf local cd $(pwd) | sed --verbose done local test cd readonly
+sed /usr/bin local printf && grep ${HOME} sed /usr/bin -eu | -eu export readonly
+	echo done awk grep "$1" -eu then awk awk 'quoted text'
+		"$1" /usr/bin "$@" | cd done export | then | $(pwd) cd
+	done grep echo done export echo $(pwd) | /usr/bin export "$1"
+		&& 2>/dev/null done readonly grep $(pwd) "$1" && then "$1" awk && export
+readonly cd local readonly "$@"
+	"$@" $(pwd) cd then ${HOME}
+&& -eu $(pwd) grep x=1 -eu grep 2>/dev/null
+	done grep readonly /usr/bin x=1 $(pwd)
+	cd cd echo grep local "$@" export 'quoted text' x=1 $(pwd) -eu readonly
+	"$1" cd done readonly grep
+| grep grep --verbose ${HOME}
+/usr/bin x=1 "$1" -eu 'quoted text' "$@" x=1 then ${HOME} done test 2>/dev/null
+&& sed x=1 local test $(pwd) test
+		${HOME} done cd done test --verbose
+	&& /usr/bin -eu grep "$@" ${HOME} grep local
+cd export done local $(pwd) readonly
+then && $(pwd) 2>/dev/null ${HOME}
+	2>/dev/null done grep done readonly then 'quoted text' 2>/dev/null
+		awk sed 'quoted text' awk readonly && 2>/dev/null sed "$@" export echo
+sed "$@" "$@" sed echo
+	${HOME} test echo 2>/dev/null --verbose && local | cd -eu "$1" sed
+		echo awk 2>/dev/null cd | /usr/bin
+	local echo && "$1" then then && /usr/bin
+echo export export --verbose 'quoted text' cd readonly echo
+		"$@" cd "$1" 2>/dev/null
+	cd x=1 --verbose grep printf cd -eu sed
+/usr/bin grep readonly printf "$1" awk awk && x=1 $(pwd) cd x=1 /usr/bin && x=1
+	export export cd local $(pwd) /usr/bin | export
+		awk -eu printf done x=1 local 'quoted text' --verbose export readonly --verbose
+	&& -eu | export export -eu x=1
+		sed | printf | "$1" readonly && ${HOME}
+2>/dev/null local export test sed -eu printf x=1 "$@" && ${HOME} 2>/dev/null local
+	cd readonly && cd printf /usr/bin
+$(pwd) --verbose grep then cd 2>/dev/null readonly cd "$@" cd "$1"
+		'quoted text' cd then | grep /usr/bin --verbose --verbose printf cd 2>/dev/null
+		printf /usr/bin 'quoted text' export
+		-eu cd -eu -eu export && done
+		printf echo /usr/bin cd cd --verbose local readonly
+	&& cd printf done | | -eu ${HOME}
+	$(pwd) echo echo "$1" grep local "$@" ${HOME}
+export ${HOME} test sed -eu /usr/bin local printf cd "$@" done sed awk awk "$1"
+		2>/dev/null "$@" && cd && 2>/dev/null
+		-eu export printf awk ${HOME} echo
+2>/dev/null grep test echo grep |
+		x=1 cd cd --verbose "$1" "$1" x=1 $(pwd) /usr/bin printf 'quoted text' local
+	done awk export x=1 export | &&
+	printf done test "$1" 2>/dev/null x=1 $(pwd) printf grep awk local | sed
+	'quoted text' ${HOME} && readonly grep | x=1 test 2>/dev/null
+x=1 "$1" export printf 'quoted text' && local grep "$@"
+	cd "$1" -eu "$1" x=1 printf sed $(pwd) sed -eu readonly -eu ${HOME}
+		| ${HOME} -eu readonly && /usr/bin awk x=1 ${HOME} readonly then --verbose "$1"
+/usr/bin test echo cd x=1 && --verbose done ${HOME} 2>/dev/null
+echo 'quoted text' echo test local grep && sed then cd && ${HOME}
+cd ${HOME} /usr/bin "$1" $(pwd) then --verbose done sed then done done export
+		local --verbose readonly grep $(pwd) cd | local grep awk then
+		"$1" sed /usr/bin export | 2>/dev/null "$@" done "$1"
+2>/dev/null && printf | "$1" echo "$1" -eu "$1" "$@" /usr/bin -eu
+		${HOME} grep --verbose export $(pwd)
+	then 'quoted text' && $(pwd) cd local
+		then local local done 'quoted text' test |
+		grep x=1 2>/dev/null then done grep awk cd test
+		then 2>/dev/null grep x=1 printf printf "$@" grep readonly
+	export ${HOME} echo x=1 readonly
+	2>/dev/null | $(pwd) sed sed then 'quoted text'
+	-eu 'quoted text' 'quoted text' | export local grep /usr/bin awk printf && awk
+		then && ${HOME} | "$@" grep printf printf
+	printf export cd x=1 | ${HOME} ${HOME} && 'quoted text' awk local 2>/dev/null
+		/usr/bin then grep $(pwd) 2>/dev/null
+		printf --verbose -eu -eu "$@" && export printf 'quoted text'
+		-eu 2>/dev/null -eu "$@" printf | $(pwd) $(pwd) grep /usr/bin test
+	"$@" /usr/bin 'quoted text' "$1" sed
+	x=1 "$1" /usr/bin echo | --verbose sed ${HOME} then
+x=1 2>/dev/null --verbose grep && --verbose
+		grep cd then ${HOME} "$1" && done done awk
+printf "$1" grep printf /usr/bin echo sed -eu --verbose
+printf --verbose /usr/bin readonly
+	sed then sed test 'quoted text' then done grep
+	test echo grep | $(pwd) grep
+	| && local /usr/bin x=1 2>/dev/null --verbose "$1" echo
+	local sed $(pwd) ${HOME} sed
+	cd -eu grep sed then "$@" -eu grep "$1"
+	cd ${HOME} printf printf
+	-eu /usr/bin -eu 'quoted text' x=1 local
+		/usr/bin --verbose awk sed cd
+		2>/dev/null && 'quoted text' local sed "$@" --verbose
+	&& grep cd test ${HOME} x=1 && readonly $(pwd)
+		test $(pwd) $(pwd) cd 2>/dev/null printf done x=1 then
+echo awk readonly test && --verbose printf cd /usr/bin 2>/dev/null then
+	export $(pwd) "$@" echo cd /usr/bin done --verbose | 'quoted text' $(pwd) sed readonly
+		then 2>/dev/null cd x=1 x=1 done echo 2>/dev/null grep
+/usr/bin 'quoted text' "$@" --verbose echo "$1"
+	${HOME} ${HOME} echo grep /usr/bin ${HOME}
+test printf local echo ${HOME} cd ${HOME} /usr/bin sed x=1
+		2>/dev/null x=1 'quoted text' sed $(pwd)
+		| --verbose then local "$@" echo && test grep grep
+	printf && "$1" -eu 2>/dev/null /usr/bin sed awk cd export printf
+	| grep 2>/dev/null && test 'quoted text' /usr/bin local
+		--verbose grep then && --verbose $(pwd) "$1" -eu
+		local -eu sed test cd sed -eu "$@" -eu /usr/bin cd
+export 2>/dev/null | then | echo 2>/dev/null
+readonly | $(pwd) $(pwd) test $(pwd) $(pwd)
+		echo 2>/dev/null -eu then
+	'quoted text' x=1 local then readonly x=1 printf "$@" -eu grep readonly grep
+-eu ${HOME} local ${HOME} awk "$@" done | then
+	sed test awk done awk sed "$@" $(pwd) ${HOME} echo
+	-eu x=1 'quoted text' "$1" "$1" -eu printf
+	/usr/bin export 'quoted text' "$@" then --verbose && "$1" local grep awk sed 2>/dev/null
+2>/dev/null --verbose "$@" test --verbose "$@"
+	--verbose && local test 2>/dev/null -eu local 2>/dev/null
+	cd /usr/bin done then "$1" "$@" "$1" export sed readonly awk test sed readonly
+2>/dev/null && x=1 "$@" -eu awk cd grep /usr/bin readonly readonly printf
+	cd test && 'quoted text' /usr/bin cd
+		$(pwd) grep cd sed --verbose && $(pwd) x=1 && test && printf echo readonly
+then echo && x=1 /usr/bin -eu echo sed echo "$@" x=1
+	export ${HOME} | test --verbose done printf -eu && printf cd echo 'quoted text'
+$(pwd) 2>/dev/null test 2>/dev/null local "$@"
+	test sed /usr/bin "$1" export
+x=1 $(pwd) --verbose local awk done printf "$@"
+	awk printf then -eu cd sed --verbose && ${HOME} -eu grep "$@" 'quoted text'
+	awk local awk cd /usr/bin
+'quoted text' grep done "$1" 2>/dev/null --verbose
+local --verbose awk 2>/dev/null cd test --verbose sed ${HOME} 'quoted text'
+	${HOME} awk | awk printf $(pwd) done
+	$(pwd) ${HOME} "$1" "$1" $(pwd) readonly && && test local -eu
+	readonly "$1" test printf test
+awk done printf "$@" 2>/dev/null && --verbose | 'quoted text'
+	-eu readonly awk 'quoted text'
+	export export /usr/bin | 'quoted text' sed readonly x=1 grep
+		-eu grep -eu | readonly test test /usr/bin echo export ${HOME} -eu $(pwd)
+	&& /usr/bin x=1 cd x=1 --verbose test
+		--verbose grep cd "$@" | --verbose done --verbose 'quoted text'
+		"$@" ${HOME} "$@" 'quoted text'
+	"$@" $(pwd) printf sed grep grep x=1 | $(pwd) |
+"$@" $(pwd) done done --verbose export x=1 done grep awk "$@" done "$1" awk then
+$(pwd) awk 2>/dev/null test /usr/bin
+awk export ${HOME} /usr/bin local --verbose export test $(pwd) -eu
+		x=1 sed 2>/dev/null | printf done export $(pwd) | then "$1" grep awk done /usr/bin
+		"$@" awk test "$@" 2>/dev/null ${HOME} readonly
+-eu $(pwd) x=1 export x=1 awk echo x=1 --verbose then 2>/dev/null && then "$1"
+	export export test /usr/bin grep
+${HOME} cd $(pwd) "$1" ${HOME} test printf "$@" x=1
+		&& printf "$@" 'quoted text' "$@" ${HOME} done --verbose then --verbose grep
+readonly local --verbose | awk echo ${HOME} printf
+	/usr/bin && /usr/bin sed cd local awk -eu $(pwd) awk ${HOME}
+&& 2>/dev/null local printf
+		sed ${HOME} readonly echo && export
+echo $(pwd) cd echo -eu 'quoted text' | export sed -eu grep cd readonly printf
+	printf sed ${HOME} done ${HOME} done $(pwd) local
+x=1 sed --verbose && echo
+	| cd && then ${HOME} cd echo "$@" "$@" x=1 local echo 2>/dev/null
+		grep ${HOME} done | export "$1" $(pwd)
+		then awk done then readonly
+/usr/bin $(pwd) /usr/bin done /usr/bin
+		--verbose readonly | export -eu local grep cd 'quoted text' test && -eu ${HOME}
+"$@" x=1 | cd then sed -eu local ${HOME} | /usr/bin
+		cd export done -eu local done then "$@"
+	awk done /usr/bin -eu readonly
+	x=1 sed $(pwd) -eu x=1
+		"$1" readonly grep -eu "$1" x=1 'quoted text' | && sed x=1 readonly |
+"$1" local local "$@" then then | -eu /usr/bin done cd x=1
+	x=1 --verbose echo x=1 awk done local awk test cd sed && readonly $(pwd)
+	awk sed && local awk && export local 'quoted text' ${HOME} "$1" &&
+echo awk --verbose -eu "$@" then -eu 2>/dev/null
+/usr/bin x=1 echo 2>/dev/null | $(pwd) -eu ${HOME} ${HOME} awk
+done 'quoted text' echo /usr/bin 'quoted text'
+-eu export $(pwd) 2>/dev/null | test printf
+		done awk export then test local x=1 test -eu local awk --verbose 'quoted text'
+		grep then && "$1" printf awk
+local sed "$@" 2>/dev/null
+		export cd local local cd done local 2>/dev/null x=1 sed --verbose printf "$@"
+		sed test --verbose 2>/dev/null sed $(pwd) 2>/dev/null
+		| then local cd cd ${HOME} echo
+export test "$@" awk echo printf
+sed printf /usr/bin export local grep /usr/bin
+	echo sed export test test
+/usr/bin 2>/dev/null printf grep && done printf "$1" | && sed
+		done done ${HOME} $(pwd) x=1 export test $(pwd) local
+	x=1 local done "$@" test test && done
+	then -eu cd x=1 test "$1" printf $(pwd) cd readonly 2>/dev/null --verbose
+	&& 'quoted text' export done "$1" readonly cd x=1
+$(pwd) "$1" cd && /usr/bin sed --verbose
+		x=1 test test x=1 -eu "$1" export --verbose local awk awk echo cd local readonly
+export export $(pwd) test printf test x=1
+	local 'quoted text' sed printf printf done export grep
+		-eu sed readonly "$@" echo x=1 readonly test sed
+	done 2>/dev/null done "$@" --verbose then $(pwd) test printf 2>/dev/null
+--verbose 2>/dev/null test --verbose printf x=1 $(pwd) 2>/dev/null
+	awk -eu cd 'quoted text'
+	2>/dev/null readonly
+		then test | test "$@" done "$@" -eu grep
+		readonly "$1" 2>/dev/null 'quoted text' && sed "$1" $(pwd) /usr/bin sed
+	printf awk awk printf ${HOME}
+		awk 'quoted text' "$@" readonly 2>/dev/null cd
+'quoted text' sed 2>/dev/null done grep
+	${HOME} /usr/bin --verbose
+'quoted text' "$@" awk test /usr/bin export && "$1" sed printf && export
+	awk readonly "$@" /usr/bin -eu test printf && then "$1"
+		$(pwd) test 2>/dev/null export readonly local
+		"$@" | && readonly /usr/bin x=1 'quoted text' printf then
+	done ${HOME} /usr/bin cd sed x=1 done done grep /usr/bin -eu
+		| printf 2>/dev/null local /usr/bin "$@" | test $(pwd) echo printf then local local
+grep /usr/bin done local ${HOME} awk echo 2>/dev/null
+	"$@" "$1" | | 2>/dev/null printf export done -eu
+"$1" ${HOME} awk readonly test
+	done then cd ${HOME} --verbose
+	$(pwd) && && done then echo sed 2>/dev/null echo /usr/bin --verbose
+	x=1 /usr/bin export && $(pwd) sed /usr/bin test
+		local 2>/dev/null && --verbose 2>/dev/null /usr/bin $(pwd) "$@" ${HOME} $(pwd)
+	cd $(pwd) x=1 awk local 2>/dev/null cd
+		"$@" printf "$@" 2>/dev/null && x=1 done
+	-eu $(pwd) sed ${HOME}
+readonly --verbose 'quoted text'
+		done "$@" test ${HOME} sed printf /usr/bin "$1" printf printf cd printf -eu grep
+		local local done test awk printf --verbose
+echo done --verbose then |
+		2>/dev/null done $(pwd) && 2>/dev/null "$@" sed 2>/dev/null test
+	&& test /usr/bin x=1 test /usr/bin export local 2>/dev/null 2>/dev/null
+		x=1 --verbose && --verbose 2>/dev/null $(pwd)
+	then awk --verbose ${HOME} export /usr/bin
+		-eu 2>/dev/null grep sed --verbose "$@" printf "$1" 2>/dev/null && cd | grep grep
+		-eu cd x=1 -eu cd --verbose && then printf export cd done /usr/bin
+		sed printf echo sed echo | sed ${HOME} test awk 2>/dev/null 'quoted text' "$@"
+	$(pwd) printf test export --verbose
+	export readonly export then local "$1" printf -eu local sed -eu ${HOME} sed
+		&& printf "$1" /usr/bin readonly awk printf
+export --verbose ${HOME} x=1 awk cd export local "$1" readonly awk cd
+	'quoted text' test x=1 $(pwd) && printf -eu printf
+		echo readonly printf export export echo 'quoted text' sed cd x=1 "$@"
+	-eu grep echo sed awk sed /usr/bin ${HOME} /usr/bin 2>/dev/null done local then
+	readonly $(pwd) 'quoted text' 2>/dev/null grep && | "$@" awk cd "$@"
+awk 'quoted text' then
+	"$@" ${HOME} printf $(pwd) done cd /usr/bin readonly --verbose
+		export then 'quoted text' then sed then
+	cd printf readonly done $(pwd)
+		test --verbose x=1 echo "$@" printf printf done done export sed -eu x=1
+/usr/bin $(pwd) local x=1 grep done local
+		grep ${HOME} x=1 "$1" ${HOME} && echo && printf
+		then local then --verbose "$1" grep ${HOME} "$@" ${HOME} echo -eu test
+		x=1 readonly export cd done cd awk sed export readonly echo then
+/usr/bin readonly then | test printf
+	--verbose echo $(pwd) export local "$@" $(pwd)
+	2>/dev/null export echo -eu -eu && grep awk 2>/dev/null && 2>/dev/null
+		-eu grep awk /usr/bin ${HOME} 2>/dev/null
+		--verbose $(pwd) export awk --verbose
+		-eu awk 'quoted text' sed x=1 "$@" "$1" export done $(pwd)
+	then sed printf local --verbose done 2>/dev/null test
+		"$@" cd awk awk done ${HOME} 2>/dev/null
+--verbose done awk | grep ${HOME}
+	test /usr/bin 'quoted text' echo echo --verbose cd then | export grep
+	--verbose "$1" done 'quoted text' printf /usr/bin && grep -eu local sed export
+		"$@" -eu sed sed printf sed /usr/bin test --verbose
+"$@" "$@" 2>/dev/null local printf 'quoted text' cd
+then awk done local then "$1" grep --verbose test
+	test | local test then export local printf && awk
+		| test echo 'quoted text'
+		--verbose --verbose export echo local done "$1" printf readonly /usr/bin
+		--verbose grep readonly echo sed export grep cd echo /usr/bin x=1 /usr/bin then
+	--verbose cd grep x=1 test
+/usr/bin echo "$@" $(pwd) 'quoted text'
+'quoted text' x=1 $(pwd) printf printf
+local test local -eu readonly then && x=1 && -eu 2>/dev/null sed && export
+	"$@" /usr/bin printf printf 'quoted text' 'quoted text'
+		${HOME} grep sed cd local echo $(pwd)
+--verbose printf --verbose "$1" printf local readonly 'quoted text'
+		local && --verbose then "$@" echo 2>/dev/null
+	&& && local 2>/dev/null cd awk | 'quoted text'
+local sed grep export && 2>/dev/null local --verbose
+		2>/dev/null done x=1 | -eu
+readonly x=1 test ${HOME} grep /usr/bin "$1" sed local grep
+2>/dev/null && local -eu "$1" ${HOME} 2>/dev/null then /usr/bin echo then
+grep test "$@" export echo x=1 awk 'quoted text' readonly local x=1 "$@"
+"$@" cd awk readonly $(pwd)
+grep 2>/dev/null -eu awk export sed test "$1" | printf cd /usr/bin local $(pwd)
+test /usr/bin printf done cd | echo 'quoted text' && readonly echo $(pwd)
+	echo then sed 2>/dev/null test -eu printf "$@" && local
@@ -0,0 +1,2001 @@
+		${HOME} -eu export ${HOME} $(pwd) && -eu x=1 awk done
+${HOME} /usr/bin test "$@" --verbose
+sed --verbose 2>/dev/null test --verbose
+		cd test cd -eu cd && /usr/bin
+	grep then x=1 export 'quoted text' x=1 export
+		printf export done x=1 awk ${HOME} 'quoted text'
+	"$1" | readonly printf local "$@" test readonly "$1" x=1 done 'quoted text'
+	echo test | x=1 -eu 2>/dev/null $(pwd) sed export export export x=1
+grep /usr/bin export $(pwd) $(pwd) echo && && awk awk
+	'quoted text' test "$1" -eu ${HOME} printf cd then "$@"
+	test /usr/bin /usr/bin
+printf x=1 "$@" && then cd sed export $(pwd) /usr/bin test done "$1" sed $(pwd)
+sed then 'quoted text' local "$@" --verbose x=1 awk grep
+		| test export ${HOME} printf "$1" awk cd then 2>/dev/null "$1" 2>/dev/null ${HOME}
+-eu "$@" | cd ${HOME} "$1" export readonly
+		/usr/bin test readonly test then readonly 2>/dev/null | /usr/bin
+	"$1" x=1 sed --verbose | sed printf x=1 local then
+| | x=1 test readonly "$1" ${HOME} export ${HOME} awk
+--verbose readonly grep cd local 'quoted text'
+	readonly $(pwd) -eu "$@" "$1" grep ${HOME} x=1
+x=1 "$@" local "$@" sed
+		test grep awk sed /usr/bin 'quoted text' readonly echo
+	/usr/bin --verbose -eu ${HOME} sed && --verbose 'quoted text'
+-eu cd printf done -eu awk "$@" && x=1
+	2>/dev/null 2>/dev/null sed sed "$@" echo test && x=1 /usr/bin
+		local 2>/dev/null local /usr/bin then awk | 2>/dev/null
+		cd test cd grep -eu 'quoted text' "$@" echo | 2>/dev/null
+sed readonly printf awk $(pwd) local ${HOME} test then --verbose awk x=1 grep
+		test "$1" 'quoted text' then $(pwd) test cd ${HOME} export test
+		done awk /usr/bin | $(pwd) ${HOME} grep printf awk test
+	2>/dev/null export --verbose "$@" x=1 printf export
+"$1" grep x=1 "$@" $(pwd) done x=1 export "$@" readonly printf
+		export readonly readonly sed "$@" done "$@" 'quoted text' done x=1
+	done 'quoted text' export awk
+		done | awk grep && export && done
+"$1" && 2>/dev/null test grep cd && echo printf $(pwd) x=1 |
+	&& 'quoted text' /usr/bin "$1" done -eu then
+		cd echo /usr/bin -eu readonly export 'quoted text' cd awk printf done
+	export x=1 sed ${HOME} done | | done sed printf 2>/dev/null 'quoted text' awk
+	done echo done grep "$@" grep $(pwd)
+		-eu export x=1 echo && | "$1" ${HOME} $(pwd)
+-eu "$@" --verbose awk ${HOME} awk printf echo grep
+	-eu $(pwd) grep test then grep -eu && cd sed then grep
+	$(pwd) && x=1 "$@" "$@" x=1 done test echo x=1 then ${HOME} --verbose
+--verbose "$@" done echo local cd done
+x=1 ${HOME} sed awk "$1" printf test export sed printf grep
+grep awk cd --verbose && printf done --verbose printf echo "$@"
+	done "$@" ${HOME} sed 2>/dev/null done ${HOME} done $(pwd) x=1 done
+awk --verbose grep -eu && /usr/bin --verbose cd --verbose printf awk | done
+	export "$1" export --verbose done readonly test local export
+	&& 'quoted text' x=1 done then "$1" grep export export export 2>/dev/null
+		printf local && export "$@"
+cd printf local x=1 awk awk grep x=1 done
+| x=1 "$@" "$@" /usr/bin sed | sed awk ${HOME} export "$@" |
+-eu cd ${HOME} /usr/bin echo awk echo && done | cd
+		${HOME} x=1 cd grep $(pwd) x=1 then sed local done test grep "$1"
+test $(pwd) x=1 x=1 cd && done export sed -eu ${HOME} sed
+	'quoted text' ${HOME} local export cd --verbose && x=1
+printf x=1 sed 2>/dev/null export 'quoted text' 'quoted text'
+	sed --verbose awk local x=1 test | /usr/bin grep && test grep "$1" export "$1"
+	'quoted text' cd ${HOME} done export done
+&& grep 2>/dev/null echo test /usr/bin
+		x=1 --verbose "$1" readonly x=1 "$@" grep grep readonly | /usr/bin | local
+"$1" then "$1" cd sed "$1" grep local export 'quoted text' printf
+	done awk local && then sed "$@"
+	test /usr/bin x=1 ${HOME} export && --verbose 2>/dev/null
+		test awk x=1 awk | sed awk printf $(pwd) then | local x=1 && ${HOME}
+	cd export awk | 'quoted text' ${HOME} -eu grep x=1 echo /usr/bin ${HOME} "$1" &&
+	local local local readonly 2>/dev/null ${HOME} "$@"
+		| then ${HOME} --verbose then ${HOME}
+cd test $(pwd) $(pwd) echo && export
+local cd $(pwd) ${HOME} /usr/bin 2>/dev/null && --verbose && test export awk
+"$1" awk printf /usr/bin $(pwd) 'quoted text' readonly | ${HOME} awk
+	--verbose readonly -eu
+		${HOME} sed /usr/bin done grep printf
+sed sed readonly -eu cd printf "$@" --verbose /usr/bin 'quoted text' printf $(pwd)
+/usr/bin test then --verbose -eu $(pwd) "$@" export 'quoted text'
+"$@" then --verbose local export
+		--verbose && x=1 ${HOME} | grep | readonly "$1" readonly export done
+printf sed readonly x=1 export done "$@" echo x=1 then cd
+--verbose x=1 sed "$1" then done | local sed then -eu
+2>/dev/null done export echo 'quoted text'
+		then done cd then "$@" sed local 2>/dev/null "$@" sed ${HOME}
+	local done /usr/bin | export $(pwd) $(pwd) then "$@" 'quoted text' test -eu
+		then cd "$@" ${HOME} 'quoted text' -eu "$1"
+		&& echo export test then local export echo 2>/dev/null echo cd && | "$@" | local
+"$@" ${HOME} export local /usr/bin $(pwd) local done
+-eu sed done awk echo done then
+		-eu awk local readonly $(pwd)
+2>/dev/null local export ${HOME} done "$@" /usr/bin --verbose
+readonly "$@" grep sed ${HOME} /usr/bin test test
+	printf cd grep readonly | $(pwd) then
+export awk "$1" then printf
+	"$@" -eu awk local export awk 'quoted text' export awk
+	awk local then test --verbose awk x=1 readonly 'quoted text' cd "$1" readonly
+export --verbose && readonly "$1" "$@"
+2>/dev/null /usr/bin -eu
+then export grep sed 2>/dev/null
+	x=1 export 'quoted text'
+	${HOME} "$1" --verbose && $(pwd) --verbose readonly printf $(pwd) ${HOME}
+| then test -eu /usr/bin -eu then ${HOME} test | cd | done "$1" /usr/bin
+		export printf "$1" awk --verbose done | then local /usr/bin 'quoted text'
+readonly "$@" /usr/bin $(pwd)
+		grep sed /usr/bin "$1" 'quoted text' $(pwd) $(pwd) $(pwd) readonly
+sed x=1 | "$@" 'quoted text' local "$@" "$1" test ${HOME} "$1"
+		local && done then -eu test done done grep "$@" done
+then "$1" grep "$1" x=1 /usr/bin done grep local sed local test
+	'quoted text' ${HOME} test 2>/dev/null grep local
+	then "$1" 2>/dev/null | readonly ${HOME} cd "$@" /usr/bin $(pwd)
+		readonly test x=1 $(pwd)
+	awk readonly readonly then awk -eu "$1" ${HOME} readonly "$@" $(pwd) ${HOME}
+	$(pwd) x=1 export local echo "$@"
+	sed $(pwd) sed cd test done cd --verbose done
+		local grep test && local
+"$@" printf "$1" readonly 2>/dev/null local --verbose -eu test
+"$@" printf sed -eu 2>/dev/null echo sed
+	readonly | x=1 done | echo -eu x=1 readonly test then sed -eu $(pwd) /usr/bin
+		echo "$1" sed test printf
+		test local | 2>/dev/null grep -eu echo awk
+-eu awk -eu readonly printf readonly && 2>/dev/null
+	export echo "$@" grep readonly sed 'quoted text'
+test "$1" grep export | &&
+		$(pwd) | | echo local sed --verbose "$@" ${HOME} "$1"
+	then export 2>/dev/null cd
+	&& local export readonly
+then | then cd "$1" 'quoted text' -eu done readonly
+sed awk readonly 'quoted text' cd cd --verbose
+"$@" ${HOME} done && done sed | sed echo export test
+	local $(pwd) cd /usr/bin "$1" readonly -eu then then
+	"$1" 'quoted text' -eu grep grep then x=1 ${HOME} then $(pwd)
+	x=1 | x=1 export readonly | | grep -eu x=1 cd printf printf readonly --verbose
+	echo printf -eu awk then grep local echo
+"$1" "$@" readonly export -eu test echo awk then
+printf 2>/dev/null export readonly 2>/dev/null test "$1" then sed grep "$@" | local
+"$@" sed /usr/bin cd --verbose echo
+		| readonly done cd 'quoted text' echo grep | local awk
+	--verbose cd done readonly echo done
+"$@" $(pwd) test grep readonly && "$@" export -eu echo readonly -eu cd
+	sed "$1" 2>/dev/null -eu $(pwd) readonly cd grep "$1"
+		${HOME} readonly "$1" grep x=1 awk
+	-eu printf grep done $(pwd) | && awk echo sed --verbose
+		"$@" printf -eu x=1 ${HOME} printf cd && awk cd done awk -eu --verbose
+	cd cd && local x=1 'quoted text' local echo test printf
+x=1 cd "$1" cd | then "$1" local done
+	/usr/bin cd -eu && x=1 --verbose | "$@" "$@"
+2>/dev/null sed "$1" done sed printf
+	'quoted text' cd printf done && local x=1
+		local --verbose then readonly grep x=1 local
+	${HOME} printf "$@" sed
+2>/dev/null then $(pwd) ${HOME} done local echo
+$(pwd) printf export export 2>/dev/null $(pwd) then -eu && -eu x=1 x=1 -eu
+		&& | local grep cd cd "$@" test | grep $(pwd) done $(pwd) -eu
+awk "$1" 2>/dev/null printf
+/usr/bin 'quoted text' printf export
+printf $(pwd) printf done export $(pwd)
+'quoted text' cd "$@" export cd done x=1 /usr/bin
+		then then test -eu then "$1" local ${HOME} sed | x=1
+		export /usr/bin then done local -eu | "$1" cd -eu echo then
+		printf 'quoted text' "$@" && --verbose sed echo "$@" awk done
+export export cd export x=1 "$@" && printf x=1 -eu local cd cd grep 2>/dev/null
+		$(pwd) then test "$@" "$1"
+		echo --verbose 2>/dev/null
+		--verbose printf "$@" test "$1"
+		$(pwd) local $(pwd) done local
+		${HOME} printf readonly printf 2>/dev/null
+grep ${HOME} $(pwd) export
+	x=1 -eu "$1" --verbose test "$@"
+		2>/dev/null "$@" readonly then "$@" sed
+/usr/bin /usr/bin readonly 'quoted text' 'quoted text' grep done local |
+		export -eu then test | echo $(pwd) export
+		then "$1" test readonly grep done "$1" && done ${HOME} echo 'quoted text'
+echo /usr/bin done printf echo sed printf /usr/bin --verbose -eu x=1 grep
+	export printf "$@" | local export $(pwd) done /usr/bin cd cd echo
+	echo local 2>/dev/null done local sed echo
+${HOME} "$@" 2>/dev/null cd x=1 test test
+${HOME} -eu cd test 'quoted text' sed sed "$1" --verbose
+| test -eu echo grep grep /usr/bin 2>/dev/null x=1 export /usr/bin echo local test
+2>/dev/null "$@" "$@" export
+		| ${HOME} readonly grep "$@" "$@" 2>/dev/null awk echo done readonly
+	then sed awk ${HOME} --verbose echo && -eu sed printf -eu "$@" $(pwd) && readonly
+		printf test -eu -eu x=1
+		${HOME} | $(pwd) echo cd readonly /usr/bin grep | && | ${HOME} then export
+	test done printf /usr/bin sed /usr/bin
+		sed then test local readonly
+$(pwd) "$1" $(pwd) grep grep cd test export && export local printf
+	| 2>/dev/null | echo local done
+sed -eu && /usr/bin /usr/bin
+-eu /usr/bin "$@" 'quoted text'
+	| 2>/dev/null "$@" 'quoted text' $(pwd) cd ${HOME} then $(pwd) $(pwd)
+		test awk && | "$@" echo x=1 export
+2>/dev/null "$1" sed "$@" echo test ${HOME} cd
+| cd "$1" "$@" printf && then ${HOME} readonly $(pwd) ${HOME} then sed
+		/usr/bin && test --verbose local | awk /usr/bin | grep "$@"
+	x=1 --verbose echo sed local
+	"$1" "$1" export && ${HOME} --verbose $(pwd) ${HOME} sed 2>/dev/null
+	grep -eu grep grep local then
+	export $(pwd) local export -eu grep done
+	-eu grep then && ${HOME} "$1" then && done "$1" x=1 -eu
+		--verbose $(pwd) printf x=1 | ${HOME} | awk export && $(pwd)
+local --verbose grep "$1" then local -eu then readonly | export
+	local cd echo && printf $(pwd) "$@" done echo grep "$@" x=1 sed && && printf
+--verbose printf -eu export /usr/bin done x=1 done
+x=1 printf echo "$@" cd ${HOME} test "$1" -eu -eu /usr/bin 'quoted text'
+		x=1 readonly $(pwd) done then | 'quoted text' x=1 echo local test echo
+readonly cd "$1" 2>/dev/null test awk then 2>/dev/null && -eu awk ${HOME}
+sed 2>/dev/null sed ${HOME} /usr/bin "$@" --verbose
+"$1" printf awk | /usr/bin awk && done
+	echo test && local done cd 2>/dev/null sed "$1"
+grep echo "$@" /usr/bin done echo 'quoted text' 'quoted text' export
+	test "$1" printf 2>/dev/null then done
+	$(pwd) echo printf 2>/dev/null local /usr/bin cd grep
+	test 2>/dev/null export x=1 export printf local local "$1" cd
+		then cd /usr/bin printf 2>/dev/null printf export
+		cd 'quoted text' printf printf cd test | done awk -eu "$@" && 2>/dev/null
+done local then then ${HOME}
+test grep then then --verbose cd grep --verbose echo 'quoted text' local
+	cd 2>/dev/null echo /usr/bin "$1" "$1" 2>/dev/null
+2>/dev/null local $(pwd) 'quoted text'
+	readonly "$1" cd | "$1" then 2>/dev/null ${HOME} local readonly
+		/usr/bin test ${HOME} "$@"
+	grep grep $(pwd) /usr/bin then
+	"$@" local then -eu printf "$1" local ${HOME} /usr/bin 2>/dev/null
+	local local echo readonly readonly | "$@" test --verbose 2>/dev/null
+	export sed done --verbose "$1" && then
+	local grep /usr/bin ${HOME} local
+	readonly "$@" cd 2>/dev/null 2>/dev/null
+		printf 2>/dev/null ${HOME} "$@" cd $(pwd) /usr/bin sed cd $(pwd) cd 2>/dev/null
+		then 'quoted text' "$@" test echo local sed local printf cd grep grep "$1"
+--verbose -eu local ${HOME} done sed
+		${HOME} "$@" | awk readonly | | readonly
+		grep readonly --verbose "$@" && $(pwd) awk echo && --verbose then
+	cd --verbose --verbose export 'quoted text' "$1" cd
+		awk | sed "$1" cd 2>/dev/null --verbose /usr/bin export sed printf --verbose
+	'quoted text' then /usr/bin
+--verbose ${HOME} readonly done awk x=1
+		${HOME} | && 'quoted text' local x=1 'quoted text' done done
+		2>/dev/null test /usr/bin 'quoted text' && echo && 2>/dev/null /usr/bin
+local cd sed local awk 'quoted text' 2>/dev/null $(pwd) --verbose
+		grep export awk local grep test echo | | --verbose /usr/bin
+done --verbose cd ${HOME} readonly readonly
+	/usr/bin "$@" printf grep "$@" cd cd cd cd 'quoted text' then
+	${HOME} | x=1 printf printf test && local -eu "$@" /usr/bin --verbose "$1" x=1
+		export export test $(pwd) && "$@" --verbose | grep x=1 'quoted text' "$@"
+	$(pwd) "$1" grep readonly local && test grep test grep x=1 x=1 | echo then x=1
+then "$1" awk 2>/dev/null "$@" local done x=1 test echo local readonly 'quoted text'
+"$@" cd test readonly ${HOME} "$1" echo -eu readonly ${HOME}
+${HOME} ${HOME} sed local local x=1 sed | then "$@" x=1 "$@" awk then awk
+		printf test -eu 2>/dev/null
+		export sed ${HOME} printf then test then x=1
+		| x=1 2>/dev/null readonly
+export | done | $(pwd) && 'quoted text' ${HOME} cd export done ${HOME} printf
+	| readonly done printf readonly | sed awk grep printf
+"$@" /usr/bin cd awk "$1" done cd ${HOME} sed /usr/bin --verbose "$1"
+	export then "$1" && /usr/bin
+${HOME} /usr/bin x=1 local sed
+printf export then /usr/bin local test -eu $(pwd) export done
+		readonly x=1 done "$1" echo "$1" readonly sed
+	printf -eu done export $(pwd) readonly done local
+	/usr/bin readonly "$1" awk /usr/bin "$1" cd export -eu grep x=1
+	cd 2>/dev/null readonly then printf --verbose grep then $(pwd) done
+export awk 2>/dev/null -eu --verbose local
+		done 'quoted text' echo ${HOME} 'quoted text'
+		awk $(pwd) $(pwd) x=1 echo ${HOME} | grep -eu then readonly test awk export
+readonly "$@" && /usr/bin test && printf "$@" test readonly sed $(pwd) && done
+	"$1" | test echo cd 2>/dev/null ${HOME} cd readonly
+/usr/bin && 2>/dev/null then
+	readonly echo local test readonly "$@" echo printf done then
+	x=1 $(pwd) readonly done local "$@" export printf then /usr/bin
+test local 'quoted text' --verbose && /usr/bin sed --verbose grep echo
+		2>/dev/null 2>/dev/null readonly /usr/bin | printf
+		sed readonly then done ${HOME} echo printf
+--verbose /usr/bin | echo
+		--verbose sed sed --verbose
+export | done ${HOME} -eu export printf -eu export readonly --verbose readonly
+		printf cd done sed test ${HOME} local echo x=1 sed
+	"$@" 'quoted text' 2>/dev/null
+	/usr/bin 2>/dev/null /usr/bin | $(pwd) --verbose done readonly readonly
+	| local "$@" 2>/dev/null printf /usr/bin test 2>/dev/null
+cd local 'quoted text' local local export echo
+test export printf "$1"
+		printf test readonly 'quoted text' --verbose local done printf x=1 'quoted text'
+	$(pwd) echo ${HOME} done x=1 local
+sed && $(pwd) done /usr/bin 2>/dev/null
+		| x=1 && local test ${HOME} printf printf 'quoted text' cd sed &&
+	local /usr/bin /usr/bin awk export test readonly awk 'quoted text'
+printf 'quoted text' local local && /usr/bin readonly
+x=1 'quoted text' done x=1 &&
+echo 'quoted text' -eu x=1 export printf grep && x=1 $(pwd) grep /usr/bin 2>/dev/null
+printf -eu readonly local 'quoted text' ${HOME} &&
+	x=1 printf && cd sed $(pwd) "$@"
+		sed then cd echo readonly --verbose
+		printf then echo /usr/bin done then
+	readonly grep readonly then 2>/dev/null "$1" sed "$1" cd "$1"
+		2>/dev/null --verbose readonly echo -eu | export && $(pwd)
+	test echo $(pwd) && --verbose 'quoted text' --verbose x=1 /usr/bin
+	$(pwd) "$@" readonly "$1" sed $(pwd) "$1" --verbose then 2>/dev/null
+	"$1" $(pwd) 2>/dev/null 2>/dev/null x=1 "$1" test readonly then "$@" "$1"
+		'quoted text' done then sed grep export sed readonly sed done
+	export 2>/dev/null 2>/dev/null
+	done 2>/dev/null then | local cd local echo x=1 "$@" --verbose
+"$@" -eu cd sed test then ${HOME}
+	"$1" "$@" -eu | export /usr/bin 2>/dev/null "$@" export
+	awk done -eu grep readonly --verbose test sed 'quoted text'
+	awk "$1" cd 2>/dev/null awk cd test | done && ${HOME} readonly
+	done grep | 2>/dev/null && -eu test printf x=1 --verbose
+	&& x=1 cd 'quoted text' local echo export then $(pwd) 2>/dev/null && --verbose
+		then then ${HOME} && local 'quoted text'
+		2>/dev/null $(pwd) echo printf
+		"$1" echo $(pwd) grep "$@" 'quoted text'
+export --verbose cd local echo 2>/dev/null x=1 test echo cd then
+		$(pwd) then "$@" | 'quoted text' "$1" -eu --verbose
+		'quoted text' /usr/bin ${HOME} readonly ${HOME} --verbose 'quoted text' then &&
+		readonly sed && "$1" export /usr/bin cd cd test && local test /usr/bin
+sed "$1" test 2>/dev/null ${HOME} 2>/dev/null grep
+	readonly printf "$@" x=1 /usr/bin sed "$@" /usr/bin
+	"$@" $(pwd) 2>/dev/null test sed done then /usr/bin
+	--verbose echo --verbose export x=1 cd ${HOME}
+test cd then done ${HOME} 2>/dev/null 2>/dev/null then printf -eu then cd "$@" "$1"
+x=1 /usr/bin cd x=1 then echo "$@" && --verbose "$1" grep "$1"
+		--verbose grep then echo then /usr/bin
+		cd printf readonly && printf | local $(pwd) "$1" | awk ${HOME} 'quoted text'
+		export awk echo then 'quoted text' ${HOME} $(pwd) 2>/dev/null
+		readonly && --verbose "$@" test
+2>/dev/null $(pwd) cd 2>/dev/null
+"$1" readonly printf --verbose local /usr/bin then cd 2>/dev/null
+		export --verbose then echo readonly readonly 'quoted text'
+printf --verbose "$@" local cd /usr/bin ${HOME}
+-eu export ${HOME} -eu --verbose | echo local readonly cd sed cd
+		| export 2>/dev/null
+"$1" -eu 'quoted text' sed | test ${HOME}
+		then 2>/dev/null echo
+	awk "$1" "$1" /usr/bin then cd x=1 "$1" --verbose && echo -eu awk ${HOME}
+"$@" local done grep 'quoted text' "$@" x=1 printf
+		2>/dev/null 2>/dev/null grep awk "$1" readonly echo local printf ${HOME}
+		readonly && | && ${HOME} x=1 readonly "$@" local
+2>/dev/null local $(pwd) 2>/dev/null
+cd printf /usr/bin --verbose x=1 'quoted text' ${HOME} then
+		/usr/bin readonly grep sed readonly "$@" "$@" --verbose
+	sed local printf echo $(pwd) -eu -eu "$1" grep 2>/dev/null
+$(pwd) $(pwd) awk | local readonly -eu | "$@" /usr/bin | "$@" readonly
+-eu grep -eu readonly /usr/bin done -eu readonly awk
+awk export then done && --verbose ${HOME} /usr/bin test
+	then echo printf "$@" "$1" $(pwd) cd export --verbose grep
+	local ${HOME} /usr/bin "$1" then "$@" sed cd /usr/bin /usr/bin then
+	test --verbose | | local ${HOME} printf echo test $(pwd) | test cd x=1 sed
+		sed grep "$@" done awk x=1
+	${HOME} echo "$1" 2>/dev/null done "$1" $(pwd) --verbose
+		export x=1 /usr/bin 2>/dev/null done readonly -eu ${HOME}
+awk $(pwd) then | -eu 'quoted text' done echo export /usr/bin
+		'quoted text' local awk echo $(pwd) ${HOME} then grep echo then done
+		"$1" ${HOME} "$@" "$1" echo "$@" 'quoted text'
+		${HOME} local ${HOME} awk local grep local echo echo "$1" "$@"
+		then printf | $(pwd) sed "$1"
+		| 2>/dev/null && done readonly x=1 awk printf readonly "$1" $(pwd) echo
+		"$@" --verbose done 2>/dev/null /usr/bin cd done grep
+echo then ${HOME} --verbose x=1 echo --verbose awk
+		"$1" readonly | -eu $(pwd) --verbose
+	export grep 2>/dev/null &&
+-eu 2>/dev/null local ${HOME}
+test ${HOME} 'quoted text' 'quoted text' 'quoted text' printf then &&
+--verbose 2>/dev/null && export readonly then | && grep | "$1" x=1 cd export
+	grep 'quoted text' ${HOME} local done "$1" "$1" ${HOME} printf then
+	--verbose grep $(pwd) 2>/dev/null --verbose
+export printf "$1" then done awk test readonly "$@"
+${HOME} "$1" local && echo 2>/dev/null "$@" | ${HOME}
+		"$@" echo sed echo local $(pwd) cd 2>/dev/null -eu done -eu 'quoted text' 'quoted text'
+echo && -eu x=1 && ${HOME}
+	"$1" ${HOME} awk 'quoted text' && export cd export --verbose test 'quoted text'
+x=1 export test local sed | echo printf then awk -eu
+awk $(pwd) x=1 2>/dev/null test | 2>/dev/null echo | local echo -eu
+	-eu 'quoted text' local "$1" done 'quoted text'
+	awk readonly x=1 --verbose
+"$1" cd /usr/bin "$1" cd "$1" "$@" "$1" export done "$1" readonly test /usr/bin
+cd cd --verbose sed | 2>/dev/null "$1" printf grep test
+$(pwd) printf "$1" ${HOME} && x=1 x=1
+grep && awk x=1 echo readonly printf cd -eu "$1" echo
+	"$1" | $(pwd) 'quoted text' x=1 export ${HOME} -eu
+&& "$1" && "$1" awk then x=1
+		grep ${HOME} ${HOME} readonly export 2>/dev/null --verbose
+$(pwd) x=1 ${HOME} printf | echo readonly grep
+--verbose awk x=1 export --verbose /usr/bin
+	'quoted text' "$1" printf x=1 "$1" test
+		awk --verbose | ${HOME} awk readonly && -eu "$@" done then $(pwd) test awk
+		/usr/bin $(pwd) test 2>/dev/null export awk cd --verbose grep local
+awk -eu | ${HOME} $(pwd) export -eu $(pwd) $(pwd) cd export
+then printf then awk done $(pwd)
+		| ${HOME} --verbose test ${HOME} local "$@"
+		sed "$1" x=1 2>/dev/null sed /usr/bin --verbose
+		done awk readonly | -eu x=1 $(pwd) printf
+	x=1 export && $(pwd) readonly local local awk done grep readonly
+done done --verbose test -eu done x=1 ${HOME} readonly cd done awk $(pwd) "$@"
+	| "$1" printf awk | 2>/dev/null ${HOME} "$@" "$@" then awk
+	--verbose ${HOME} export
+		&& --verbose then then "$1" /usr/bin echo local && then -eu
+printf cd "$@" /usr/bin
+	cd test /usr/bin then $(pwd) /usr/bin sed printf "$@" readonly cd
+--verbose then 2>/dev/null "$1" done 'quoted text' export
+		echo ${HOME} done cd printf local printf
+${HOME} done "$1" echo 2>/dev/null x=1 readonly local 'quoted text' readonly
+		x=1 printf 'quoted text' test
+grep done 'quoted text' sed "$1" then done "$1" grep sed ${HOME}
+	local readonly awk 2>/dev/null
+		grep sed test "$@" sed awk --verbose x=1 sed export
+&& readonly -eu then local readonly
+x=1 $(pwd) "$1" echo done $(pwd) $(pwd)
+		${HOME} export 'quoted text' ${HOME} x=1 && test echo cd local "$@" done
+export printf -eu "$@" printf && readonly test 'quoted text'
+	| /usr/bin awk cd /usr/bin | awk test export "$1"
+		'quoted text' 'quoted text'
+-eu export sed "$1" 2>/dev/null
+"$@" export done awk grep
+		awk test awk "$1" ${HOME} && sed -eu 'quoted text'
+		/usr/bin /usr/bin local cd
+--verbose | /usr/bin printf done echo 2>/dev/null done --verbose
+	test sed export ${HOME} awk /usr/bin
+local awk --verbose echo --verbose echo 2>/dev/null x=1
+	${HOME} local && && then && && "$1" awk -eu $(pwd) && readonly
+		x=1 x=1 done echo export awk cd /usr/bin "$1" -eu && done export export 2>/dev/null
+		x=1 2>/dev/null --verbose
+		cd x=1 readonly "$@" export awk grep export test
+	'quoted text' test sed | readonly && && 'quoted text' test "$1" 2>/dev/null
+		-eu echo test local 'quoted text' local | done "$@" 2>/dev/null
+| awk x=1 /usr/bin grep local test local awk && /usr/bin test test && then readonly
+| readonly grep 'quoted text' local echo then test test local echo
+| 2>/dev/null printf awk -eu done
+cd echo -eu done test $(pwd) 2>/dev/null | "$1" printf echo done 2>/dev/null
+	| local grep export export
+	${HOME} done sed 2>/dev/null then && grep 'quoted text' && /usr/bin $(pwd) done
+export printf awk /usr/bin 'quoted text'
+	echo | then grep local local
+	export 2>/dev/null done --verbose then ${HOME} --verbose -eu 2>/dev/null
+		readonly test /usr/bin printf 2>/dev/null
+'quoted text' | /usr/bin local -eu "$@" "$1"
+		echo sed sed 'quoted text' local
+"$@" "$1" local echo 2>/dev/null printf 2>/dev/null
+		| 2>/dev/null x=1 "$1" local local sed -eu awk
+		printf --verbose sed cd then $(pwd) 2>/dev/null && awk
+	sed -eu "$@" local done | && done sed
+		printf "$1" -eu sed && awk -eu -eu local ${HOME} "$1" ${HOME} export | x=1
+done printf then "$1" local ${HOME} echo ${HOME}
+$(pwd) /usr/bin 2>/dev/null x=1 export 'quoted text' 'quoted text'
+	echo done "$1" -eu ${HOME} awk ${HOME} awk
+	2>/dev/null export "$1" --verbose sed printf awk test awk /usr/bin
+		echo done 2>/dev/null ${HOME} && 2>/dev/null test "$1" ${HOME} 'quoted text'
+	grep -eu x=1 cd "$1" export 'quoted text' 'quoted text' x=1 local
+printf 2>/dev/null 'quoted text'
+		readonly && sed then -eu "$@" x=1 -eu then readonly
+		readonly $(pwd) local 'quoted text' printf grep local then $(pwd) -eu
+readonly printf && | export 'quoted text' local "$@"
+awk printf && grep /usr/bin "$@" echo test done && "$1" export local done $(pwd)
+printf export | $(pwd) && readonly printf done cd export "$@" echo readonly
+	test "$@" $(pwd) done local
+"$@" then printf test sed "$1" | awk export sed awk
+"$@" export local $(pwd)
+	done ${HOME} | x=1 cd -eu | 'quoted text' $(pwd) /usr/bin | done test cd
+/usr/bin -eu awk "$1" printf "$1" --verbose
+		export export 2>/dev/null awk -eu echo sed | 2>/dev/null | ${HOME}
+	readonly done test echo --verbose -eu awk "$@" -eu
+		&& printf 2>/dev/null /usr/bin
+	sed grep awk export | | x=1 awk export printf -eu $(pwd) "$1"
+		then 'quoted text' ${HOME} && local
+	test 2>/dev/null --verbose
+done "$1" | local 2>/dev/null ${HOME}
+	cd -eu ${HOME} --verbose readonly then -eu && then "$1" ${HOME} | echo
+| $(pwd) && -eu | then x=1 then ${HOME} x=1 "$@" 'quoted text' cd echo test
+		grep readonly echo "$@"
+/usr/bin /usr/bin readonly | cd ${HOME}
+		2>/dev/null local x=1 /usr/bin 2>/dev/null 'quoted text' ${HOME} $(pwd)
+grep awk "$1" local test --verbose -eu x=1 local "$@" grep grep 2>/dev/null
+grep then | test x=1 awk "$@" cd sed &&
+"$@" 'quoted text' --verbose -eu export echo --verbose printf $(pwd) export
+		echo /usr/bin awk cd printf
+		done test 2>/dev/null printf local -eu sed test readonly $(pwd)
+		'quoted text' done /usr/bin then 2>/dev/null "$@" "$@" readonly echo -eu "$1" cd
+export then printf grep --verbose echo x=1
+&& 'quoted text' local done -eu x=1 $(pwd)
+	"$@" 2>/dev/null test | then ${HOME} printf /usr/bin ${HOME}
+	sed ${HOME} 2>/dev/null echo echo 'quoted text' ${HOME} --verbose grep --verbose
+		local -eu /usr/bin local "$1" grep printf
+then done done $(pwd) $(pwd) 2>/dev/null test 'quoted text' export
+local | sed readonly then
+		local cd done done cd then local done --verbose /usr/bin
+		"$1" && export 'quoted text'
+		&& --verbose ${HOME} then ${HOME} export sed 'quoted text'
+	readonly printf && --verbose cd readonly | | grep export 2>/dev/null done sed
+		"$@" "$@" done grep | test $(pwd) ${HOME} /usr/bin done
+		'quoted text' 2>/dev/null
+awk grep cd then "$1" && "$@" 'quoted text'
+&& then export local readonly 'quoted text'
+"$@" $(pwd) --verbose cd done readonly $(pwd) 2>/dev/null echo
+	'quoted text' /usr/bin ${HOME} "$1" printf
+		/usr/bin then 'quoted text' sed then cd x=1 grep 'quoted text'
+		awk awk then 2>/dev/null --verbose done ${HOME} sed && --verbose /usr/bin
+then readonly awk x=1 echo 2>/dev/null awk
+		&& sed printf x=1 printf
+'quoted text' --verbose $(pwd) done local
+		-eu /usr/bin "$1" /usr/bin
+	"$@" done printf "$@" $(pwd) export local cd printf then ${HOME}
+		export 'quoted text' "$1" sed
+then then && x=1 local cd grep sed sed echo
+		| ${HOME} grep readonly $(pwd) done "$1" printf
+	cd test --verbose "$1" --verbose then awk test printf test "$1"
+		done cd /usr/bin | "$@" --verbose sed /usr/bin awk -eu local
+		grep /usr/bin | 'quoted text' | ${HOME}
+		2>/dev/null $(pwd) done ${HOME}
+		$(pwd) $(pwd) /usr/bin -eu export --verbose | sed awk
+awk $(pwd) -eu && "$@" readonly awk ${HOME} cd echo readonly echo sed
+2>/dev/null 'quoted text' && ${HOME} then
+	2>/dev/null local 2>/dev/null 'quoted text' echo echo | grep
+local local "$@" local echo x=1 echo test ${HOME} 2>/dev/null done
+	x=1 test awk awk -eu awk | cd
+	&& grep cd 'quoted text' awk awk printf readonly "$@" -eu "$@"
+"$1" 'quoted text' awk | export
+echo sed grep cd ${HOME} 'quoted text' x=1 $(pwd) "$1" 'quoted text'
+		/usr/bin grep readonly echo printf printf local | done
+		/usr/bin then echo test test readonly ${HOME}
+		-eu x=1 echo -eu /usr/bin done x=1 "$@" ${HOME} 'quoted text' grep --verbose
+	readonly printf -eu ${HOME} then | then then && then | done $(pwd) cd /usr/bin
+	&& && awk then printf 2>/dev/null "$@" export
+	/usr/bin /usr/bin local /usr/bin
+"$@" done export export export -eu grep 'quoted text' | printf printf done grep
+		local export grep readonly x=1
+	-eu then -eu "$1" grep 'quoted text' ${HOME} "$1" done
+printf readonly grep grep
+		then then -eu export /usr/bin 2>/dev/null sed && 'quoted text' grep -eu
+${HOME} $(pwd) sed cd --verbose done test -eu | test /usr/bin x=1
+		/usr/bin x=1 ${HOME} readonly printf printf
+		then 2>/dev/null cd | 'quoted text' printf printf printf
+	| test grep 'quoted text' printf ${HOME} -eu &&
+cd grep 2>/dev/null then | 2>/dev/null awk export echo ${HOME} export "$@" echo
+		2>/dev/null --verbose readonly local readonly
+	/usr/bin "$1" && echo then test 'quoted text'
+	done /usr/bin printf x=1 cd awk cd local sed cd export
+grep ${HOME} -eu echo readonly then export printf ${HOME} printf done $(pwd)
+	grep cd export done 'quoted text'
+/usr/bin -eu -eu --verbose sed cd && "$@" -eu local -eu "$1"
+	-eu cd 'quoted text' done test readonly
+	cd --verbose export local 'quoted text'
+	&& /usr/bin --verbose -eu 2>/dev/null
+	2>/dev/null "$1" sed echo 2>/dev/null
+	'quoted text' x=1 done | awk x=1 grep grep
+test readonly awk then | done "$@" done awk -eu export --verbose "$@" test awk
+	grep --verbose sed awk -eu x=1 printf done
+&& 'quoted text' -eu test cd /usr/bin
+	&& echo export /usr/bin cd awk -eu && grep export ${HOME} readonly 2>/dev/null
+test && test x=1 readonly done export test ${HOME} test echo ${HOME} echo
+	readonly 'quoted text' echo /usr/bin 2>/dev/null awk
+cd $(pwd) -eu export "$1" printf grep then 2>/dev/null export grep sed && /usr/bin
+		| ${HOME} then /usr/bin 2>/dev/null
+		/usr/bin cd | && "$1" then local --verbose --verbose test awk echo cd
+grep -eu awk ${HOME} | test cd --verbose echo x=1 'quoted text' sed
+		--verbose printf 'quoted text' "$1" x=1 | && --verbose $(pwd)
+	grep export ${HOME} grep then readonly | export awk local
+'quoted text' && x=1 cd sed local awk done grep --verbose
+	"$@" sed ${HOME} "$1" 2>/dev/null printf && 2>/dev/null then
+echo /usr/bin --verbose
+	then done local 2>/dev/null && readonly --verbose echo x=1 done | then
+x=1 echo /usr/bin $(pwd)
+	'quoted text' export awk readonly done export
+	test && cd done then cd "$@" 'quoted text' export cd readonly 2>/dev/null 'quoted text'
+cd readonly printf && done then grep /usr/bin $(pwd) printf $(pwd) /usr/bin
+/usr/bin | cd export --verbose printf --verbose done done
+	grep -eu awk -eu export "$@" -eu then readonly done
+	grep sed done --verbose $(pwd)
+		printf grep grep -eu | 2>/dev/null $(pwd) echo cd
+"$1" 'quoted text' $(pwd) --verbose
+	-eu sed /usr/bin && /usr/bin done -eu grep printf "$@" -eu sed /usr/bin 'quoted text'
+		"$1" && test ${HOME} |
+readonly printf sed test 'quoted text' && export | export ${HOME} sed x=1 -eu
+readonly x=1 /usr/bin grep "$@" -eu --verbose && then
+	-eu sed then ${HOME}
+	readonly -eu | -eu echo test local ${HOME} "$1" "$1"
+'quoted text' awk awk --verbose x=1 export export test
+	/usr/bin 2>/dev/null cd echo "$@" test
+/usr/bin $(pwd) -eu sed sed
+		local awk -eu done grep "$1" local | cd cd && cd
+	-eu && grep cd 2>/dev/null awk grep
+		| then ${HOME} -eu local 'quoted text' | readonly
+	"$1" export $(pwd) cd | printf "$1" ${HOME} "$1" echo then "$1" --verbose
+| printf | ${HOME} && printf echo -eu
+echo 'quoted text' x=1 --verbose test awk grep && local printf awk local
+		${HOME} "$1" $(pwd) sed local cd readonly 2>/dev/null cd awk awk test
+	/usr/bin | $(pwd) printf cd
+sed test 'quoted text' ${HOME} cd grep cd $(pwd) export export readonly
+		x=1 done grep echo 2>/dev/null cd grep -eu /usr/bin 'quoted text'
+	sed done && sed ${HOME} $(pwd) sed sed && test
+--verbose cd | "$1" test --verbose then && cd then local /usr/bin | test
+"$1" cd /usr/bin -eu /usr/bin local $(pwd) --verbose 2>/dev/null && cd then local
+	echo --verbose sed then --verbose && then -eu x=1 "$@" --verbose
+		2>/dev/null $(pwd) readonly "$@" /usr/bin ${HOME}
+"$1" 2>/dev/null printf /usr/bin "$@"
+x=1 -eu 'quoted text' grep /usr/bin 'quoted text' $(pwd)
+"$1" export "$1" x=1 local | ${HOME} 2>/dev/null --verbose
+		local sed | export awk local awk echo && "$1"
+	cd -eu | x=1 local then && printf echo done 'quoted text' awk grep
+		2>/dev/null echo 'quoted text' grep $(pwd) grep | $(pwd) 'quoted text' export
+	| then sed $(pwd) echo cd $(pwd)
+	| | "$@" readonly test && printf echo sed
+	/usr/bin "$1" readonly export --verbose
+		/usr/bin readonly 'quoted text' /usr/bin --verbose then awk echo "$@" grep
+awk -eu ${HOME} done readonly 2>/dev/null $(pwd) then then export then
+		/usr/bin grep export test -eu export sed sed awk test x=1 sed export
+&& "$@" grep printf sed export cd --verbose
+		export grep /usr/bin -eu 'quoted text' local --verbose printf
+		'quoted text' echo ${HOME} awk export "$1"
+cd 2>/dev/null -eu x=1 test 2>/dev/null readonly
+	| --verbose && readonly x=1 then
+	printf "$1" done export x=1 $(pwd)
+	printf -eu awk readonly $(pwd) x=1 done /usr/bin grep /usr/bin
+		printf | "$@" test | local grep -eu $(pwd) /usr/bin sed -eu printf done |
+		&& awk export ${HOME} ${HOME} 2>/dev/null $(pwd) && "$1"
+	${HOME} 'quoted text' export 'quoted text' ${HOME} $(pwd)
+readonly -eu $(pwd) "$1" 'quoted text' echo && ${HOME} cd | | $(pwd) grep then
+"$1" readonly | grep 'quoted text' echo "$@" | && "$@"
+	&& 2>/dev/null done done test ${HOME}
+--verbose | 2>/dev/null 2>/dev/null cd printf printf
+		printf $(pwd) "$1" $(pwd) 'quoted text' test x=1 /usr/bin readonly /usr/bin
+		grep "$1" done 2>/dev/null cd 'quoted text' "$@" ${HOME}
+	'quoted text' x=1 export -eu ${HOME} readonly 2>/dev/null sed
+&& ${HOME} --verbose cd done
+"$1" "$1" echo readonly local local sed 'quoted text'
+	"$1" readonly | awk ${HOME} cd x=1 | readonly awk export
+	$(pwd) 2>/dev/null | x=1 && grep
+		-eu sed printf printf printf test
+		--verbose test x=1 /usr/bin awk 'quoted text' done echo sed then &&
+	x=1 printf 2>/dev/null export "$1" $(pwd) 'quoted text' grep --verbose
+grep test awk && "$@" ${HOME} echo
+	"$@" | cd export cd printf readonly echo "$@" grep --verbose
+2>/dev/null ${HOME} /usr/bin $(pwd) cd then test grep
+	-eu then && printf && "$@" "$@" 'quoted text' then export then $(pwd) export
+	2>/dev/null /usr/bin && done 2>/dev/null grep -eu cd x=1 cd --verbose export
+	| then "$1" sed | x=1 echo ${HOME} test sed x=1 $(pwd) then grep "$@" $(pwd) ${HOME}
+export -eu 2>/dev/null /usr/bin
+		cd $(pwd) 'quoted text' cd local "$1" $(pwd)
+		$(pwd) readonly --verbose readonly echo && echo | grep done
+		"$@" test 2>/dev/null "$1" then echo awk then | done /usr/bin done "$@" ${HOME}
+		--verbose then 2>/dev/null
+	2>/dev/null "$1" sed awk "$1" grep local cd --verbose "$@" export grep "$@"
+		export /usr/bin grep $(pwd) 2>/dev/null readonly
+		done grep then 'quoted text' local readonly 2>/dev/null /usr/bin
+		sed printf | local readonly echo done 'quoted text' then ${HOME} "$@" readonly
+"$@" "$1" && echo echo && cd 2>/dev/null done /usr/bin
+		cd test readonly export $(pwd) done | cd test local printf awk -eu /usr/bin
+		grep | export cd "$@" done then sed export && -eu awk local done x=1 x=1 "$1" printf
+readonly readonly && --verbose local && echo /usr/bin local | sed test
+	grep export grep awk && && "$1" awk cd $(pwd) "$@" export
+	/usr/bin done && /usr/bin grep "$@" /usr/bin export 2>/dev/null
+	x=1 awk && local /usr/bin
+	--verbose 2>/dev/null done | readonly /usr/bin
+		/usr/bin sed awk sed 2>/dev/null export --verbose ${HOME} | grep | | echo sed
+		"$@" -eu 'quoted text' $(pwd) ${HOME} local x=1 grep sed
+	"$@" grep x=1 ${HOME} /usr/bin cd grep ${HOME} ${HOME}
+	"$1" x=1 done done /usr/bin "$1" --verbose | grep ${HOME} test
+readonly /usr/bin sed cd local cd 'quoted text' $(pwd)
+	done sed $(pwd) && $(pwd) cd $(pwd)
+	sed awk echo then sed grep
+	"$@" x=1 x=1 --verbose cd awk /usr/bin echo && readonly
+		then x=1 "$@" --verbose --verbose
+		local cd local grep local grep printf then awk 'quoted text' test echo
+2>/dev/null printf printf test x=1 2>/dev/null
+		grep sed 2>/dev/null ${HOME}
+grep cd grep grep "$1" then
+		sed readonly grep 'quoted text' done
+then ${HOME} grep grep done echo $(pwd)
+	test -eu 2>/dev/null local sed done -eu $(pwd) x=1 export export 'quoted text' echo
+		'quoted text' ${HOME}
+	export "$@" "$1" cd local readonly
+		x=1 "$1" awk done sed awk
+2>/dev/null 'quoted text' done -eu test test $(pwd) --verbose x=1
+local $(pwd) /usr/bin "$1" readonly --verbose printf cd printf --verbose
+		2>/dev/null "$@" readonly then -eu done -eu x=1 test cd
+		then local --verbose grep local $(pwd) printf 'quoted text' echo --verbose
+grep --verbose --verbose done x=1 "$@" awk /usr/bin test
+		$(pwd) "$@" ${HOME} readonly
+		x=1 --verbose done sed x=1 --verbose
+awk x=1 ${HOME} "$@" awk 2>/dev/null
+		&& $(pwd) local -eu --verbose
+/usr/bin | cd x=1 test ${HOME} readonly
+		| 'quoted text' /usr/bin 2>/dev/null | cd "$@"
+		--verbose x=1 readonly awk
+	${HOME} --verbose && ${HOME} x=1 test --verbose echo
+		x=1 done "$@" test 'quoted text' then cd test printf
+		/usr/bin ${HOME} local test test "$@" --verbose awk sed $(pwd)
+	'quoted text' "$1" | "$@" local echo | grep "$1"
+	test --verbose test $(pwd) "$@" then --verbose
+		cd awk | 'quoted text' "$@" | export $(pwd) /usr/bin -eu local && 'quoted text'
+		&& -eu local $(pwd) $(pwd) "$1" --verbose "$1" | test echo
+export "$@" $(pwd) local export 2>/dev/null export --verbose
+test --verbose -eu 'quoted text'
+	cd printf | 2>/dev/null /usr/bin local awk test export
+test echo local then --verbose
+	${HOME} export "$1" && local cd -eu cd --verbose 2>/dev/null
+	printf grep awk ${HOME} printf export --verbose awk grep awk
+	-eu echo then "$@" cd $(pwd) echo then done export --verbose export "$@" export
+		/usr/bin | printf "$@" awk
+	sed | done echo ${HOME} local cd readonly then
+${HOME} -eu 'quoted text' grep
+		cd -eu test --verbose /usr/bin printf /usr/bin printf
+	cd --verbose ${HOME} 2>/dev/null ${HOME} x=1 'quoted text' "$@" grep
+		--verbose readonly | grep 'quoted text'
+	"$@" x=1 grep -eu grep ${HOME} "$1" then export "$@" then local
+${HOME} export --verbose printf local
+	done test /usr/bin done --verbose
+x=1 local -eu | 'quoted text' printf --verbose "$1"
+		export echo cd "$1" readonly -eu "$@" -eu sed sed /usr/bin export
+	'quoted text' readonly echo x=1 printf
+awk cd grep printf x=1 done | grep local grep readonly printf ${HOME} "$1" test
+		test "$@" "$@" echo $(pwd) test local "$1" && cd export
+	readonly ${HOME} x=1 then 'quoted text' x=1 -eu local cd | -eu x=1 "$1"
+	sed ${HOME} readonly cd 2>/dev/null 2>/dev/null printf readonly -eu
+awk 'quoted text' cd ${HOME} "$1"
+		"$@" ${HOME} export 2>/dev/null
+	awk ${HOME} grep ${HOME} echo $(pwd) printf then --verbose x=1 $(pwd) | "$@" /usr/bin
+		2>/dev/null $(pwd) /usr/bin ${HOME} awk --verbose cd x=1 grep printf local local
+	awk cd 'quoted text' ${HOME} local grep
+	export grep sed x=1 echo local echo grep $(pwd) grep -eu grep && 2>/dev/null |
+		sed && $(pwd) printf /usr/bin grep 'quoted text'
+'quoted text' then test then
+		export then cd $(pwd) "$1" x=1 cd echo
+'quoted text' then readonly done $(pwd) 'quoted text'
+	${HOME} test then echo && /usr/bin 'quoted text'
+awk x=1 /usr/bin echo x=1 test sed echo
+-eu awk printf x=1 2>/dev/null echo "$1"
+	/usr/bin done 2>/dev/null
+		| then -eu 2>/dev/null echo /usr/bin grep done /usr/bin awk x=1 | && "$1"
+		printf done export ${HOME} export local local --verbose then && sed --verbose
+"$1" awk /usr/bin local ${HOME} 'quoted text' test -eu then "$1" test
+-eu -eu sed readonly done ${HOME} test -eu printf $(pwd) /usr/bin "$@" /usr/bin
+then x=1 readonly | 'quoted text' $(pwd) echo ${HOME}
+		local --verbose && test cd readonly | --verbose | local printf && $(pwd) grep
+${HOME} -eu 2>/dev/null echo echo /usr/bin &&
+	echo --verbose done x=1 'quoted text' grep $(pwd)
+--verbose echo x=1 readonly
+--verbose --verbose --verbose
+	"$1" x=1 export then printf readonly export echo echo $(pwd) 'quoted text'
+	printf --verbose $(pwd) && /usr/bin /usr/bin x=1 export
+		x=1 then -eu echo | /usr/bin
+local --verbose "$1" -eu /usr/bin $(pwd) echo export cd awk && echo
+	$(pwd) then printf done local sed sed local | -eu test awk ${HOME}
+2>/dev/null -eu cd -eu export done $(pwd) printf &&
+		readonly sed ${HOME} | | x=1 $(pwd) -eu then echo local test cd
+	awk awk then 2>/dev/null
+"$@" $(pwd) -eu 'quoted text'
+| -eu $(pwd) "$1" x=1 "$1" then printf
+	2>/dev/null sed then awk local --verbose 'quoted text'
+	local done && --verbose cd ${HOME}
+${HOME} awk x=1 --verbose x=1 local 2>/dev/null local "$@" -eu readonly --verbose
+	readonly readonly 2>/dev/null $(pwd) ${HOME} grep cd 2>/dev/null --verbose
+	echo 2>/dev/null ${HOME} echo /usr/bin $(pwd) x=1 grep sed
+		x=1 && && awk | grep 'quoted text'
+	test -eu printf -eu local test --verbose 'quoted text'
+	${HOME} | /usr/bin export ${HOME} "$1" && "$1" done -eu export | $(pwd)
+	| -eu sed -eu 2>/dev/null x=1
+	sed then local done readonly printf /usr/bin
+	x=1 2>/dev/null then local ${HOME} sed
+cd then /usr/bin printf
+done 'quoted text' local printf
+	--verbose cd -eu printf printf test x=1 cd 'quoted text' --verbose "$1"
+	| "$@" "$@" $(pwd) export | $(pwd) then ${HOME} export
+		"$@" 2>/dev/null | awk x=1 "$@" --verbose | "$@" export done x=1 $(pwd) &&
+	&& 2>/dev/null local done
+		grep printf x=1 done then then awk 'quoted text' echo 'quoted text'
+"$1" && export -eu $(pwd) local "$@" && 'quoted text' echo | | printf
+		$(pwd) export export -eu grep "$1" 2>/dev/null
+"$1" --verbose echo /usr/bin printf local readonly 2>/dev/null
+&& 'quoted text' cd | awk done && "$1" 2>/dev/null
+		&& awk sed 'quoted text' "$1"
+then /usr/bin | printf cd
+	printf 2>/dev/null then "$@" test local test 'quoted text' 'quoted text' 'quoted text'
+	x=1 test test ${HOME} && x=1 grep then local --verbose cd then "$1" ${HOME}
+	"$1" 'quoted text' "$@" printf 2>/dev/null
+		printf export -eu "$@" 'quoted text' /usr/bin --verbose --verbose x=1 test test
+	awk awk | x=1 "$@" x=1 /usr/bin $(pwd)
+sed readonly -eu --verbose x=1 ${HOME} export | test
+	sed then done && && echo echo --verbose export
+	'quoted text' 'quoted text' && -eu then 'quoted text'
+	--verbose 2>/dev/null $(pwd) grep sed
+export "$@" /usr/bin done $(pwd) awk then then "$@" then
+done test ${HOME} "$1" 2>/dev/null awk && grep readonly grep done readonly
+	test printf 2>/dev/null cd 2>/dev/null /usr/bin --verbose x=1 cd printf
+		x=1 echo cd 'quoted text' echo local /usr/bin cd "$@" test | done
+		"$@" done sed -eu done 2>/dev/null printf --verbose ${HOME} grep printf sed
+grep sed export | 2>/dev/null /usr/bin echo done "$1" cd /usr/bin && readonly
+	export --verbose ${HOME} sed awk $(pwd) grep readonly && --verbose
+		done -eu /usr/bin local --verbose | 'quoted text'
+"$@" --verbose grep then $(pwd) "$1" "$1" --verbose 2>/dev/null test
+		$(pwd) local export -eu echo sed 2>/dev/null
+		awk "$1" ${HOME} done then 'quoted text' grep x=1 ${HOME} readonly
+echo local $(pwd) -eu cd $(pwd) done test then "$@"
+		done cd -eu awk /usr/bin && 'quoted text' awk /usr/bin "$@" | $(pwd) readonly
+	x=1 "$1" done 'quoted text' grep
+--verbose 'quoted text' "$@" 2>/dev/null then printf "$1" test readonly then x=1
+		cd done export echo /usr/bin
+${HOME} 'quoted text' && && cd sed "$1" /usr/bin readonly 2>/dev/null
+		done ${HOME} 'quoted text' | ${HOME} && ${HOME} test /usr/bin echo cd printf
+		$(pwd) cd readonly sed local then /usr/bin /usr/bin local
+		local export && readonly --verbose 2>/dev/null local echo awk done
+	awk awk readonly $(pwd) | x=1 2>/dev/null printf
+		export printf then export | | 'quoted text' grep grep sed /usr/bin done then local
+		"$1" "$@" $(pwd) ${HOME} readonly local awk echo /usr/bin /usr/bin "$1"
+	export grep ${HOME} | cd "$@"
+		local awk echo readonly then $(pwd) $(pwd) readonly
+		grep local x=1 done grep then echo 2>/dev/null cd --verbose
+		x=1 readonly "$@" "$@" /usr/bin --verbose
+	2>/dev/null && awk readonly
+	-eu export /usr/bin x=1 cd -eu /usr/bin echo 2>/dev/null then local
+export --verbose done then export
+	"$@" "$1" echo "$@" readonly /usr/bin done $(pwd) done test export export
+		| --verbose 'quoted text' cd cd "$1" x=1
+export local done ${HOME} ${HOME} export
+	--verbose cd then echo
+	awk printf x=1 'quoted text' done grep 2>/dev/null 'quoted text' echo
+export ${HOME} "$1" ${HOME} done 'quoted text' | grep
+		'quoted text' /usr/bin ${HOME} && export grep printf then awk sed && | && &&
+| done "$1" --verbose export
+awk export readonly /usr/bin 'quoted text' echo 'quoted text' sed
+	'quoted text' grep /usr/bin | printf
+		done cd export grep "$1" | echo printf -eu 'quoted text' cd
+echo "$1" local /usr/bin done ${HOME} 2>/dev/null test then -eu export
+--verbose awk /usr/bin 2>/dev/null ${HOME} echo
+	echo /usr/bin awk "$1" sed local 'quoted text' echo && /usr/bin && awk
+		x=1 && 'quoted text' 2>/dev/null cd cd $(pwd) "$@" printf /usr/bin
+sed -eu awk grep 'quoted text' printf "$1" printf
+x=1 | export readonly awk sed readonly printf && local awk test
+	&& sed && $(pwd) $(pwd) export local printf ${HOME} done test -eu
+	2>/dev/null x=1 readonly readonly
+		2>/dev/null export readonly
+cd local 2>/dev/null done then grep | test "$1" local cd export 2>/dev/null
+2>/dev/null "$@" -eu --verbose | 2>/dev/null -eu ${HOME} 2>/dev/null then done
+${HOME} ${HOME} | 2>/dev/null
+-eu ${HOME} local export then --verbose && |
+		${HOME} x=1 --verbose && then "$1" | echo x=1 -eu "$@" local
+		--verbose export awk 2>/dev/null grep --verbose
+'quoted text' && | 2>/dev/null then | export "$1"
+		echo -eu -eu 'quoted text' $(pwd) then test grep awk sed
+	&& awk local export awk ${HOME}
+	echo 'quoted text' awk sed x=1 test grep $(pwd) x=1 grep grep test sed &&
+	awk /usr/bin readonly cd done printf test sed x=1 grep grep
+local local x=1 "$@" cd done sed $(pwd) export readonly 2>/dev/null awk 'quoted text'
+	'quoted text' ${HOME} ${HOME} export "$1" 2>/dev/null
+readonly printf 'quoted text' --verbose printf cd test done -eu printf "$1"
+	cd export cd sed readonly | "$1" $(pwd)
+		$(pwd) 'quoted text' -eu && /usr/bin "$1" x=1 export $(pwd) awk -eu /usr/bin
+${HOME} -eu | x=1 2>/dev/null
+2>/dev/null 2>/dev/null awk done "$@" local && 'quoted text'
+	"$@" --verbose -eu &&
+		printf /usr/bin then ${HOME} done 2>/dev/null
+		export 'quoted text' | -eu export export x=1 'quoted text'
+cd export local printf printf
+		"$1" grep | echo done --verbose 'quoted text'
+		awk "$@" --verbose --verbose export done -eu
+	-eu echo && cd ${HOME} local 'quoted text' -eu &&
+&& done "$1" then /usr/bin && | echo 'quoted text'
+		${HOME} && | cd sed ${HOME} && grep /usr/bin x=1
+x=1 "$@" x=1 'quoted text' x=1 printf readonly grep ${HOME}
+	--verbose sed --verbose then ${HOME}
+	${HOME} echo /usr/bin local "$@" then | readonly
+	then export test "$@" sed /usr/bin 2>/dev/null
+		then readonly -eu echo then
+		-eu printf awk $(pwd) x=1 awk && awk
+		x=1 /usr/bin test export local ${HOME} echo "$@" grep ${HOME} -eu ${HOME}
+	'quoted text' awk && test $(pwd) cd sed && --verbose readonly 2>/dev/null
+		${HOME} -eu --verbose && ${HOME} grep -eu readonly local -eu test
+${HOME} 2>/dev/null x=1 awk x=1 test "$1"
+		$(pwd) 'quoted text' && $(pwd) cd awk x=1 "$1" x=1 then
+		-eu readonly printf readonly grep test | -eu sed /usr/bin &&
+	cd cd ${HOME} "$@" then && cd | printf 2>/dev/null
+	'quoted text' $(pwd) test && grep $(pwd) ${HOME} ${HOME} | sed done awk
+	-eu echo --verbose 2>/dev/null
+	| x=1 $(pwd) && -eu grep /usr/bin 2>/dev/null 'quoted text' -eu 'quoted text'
+	export printf sed $(pwd) grep cd awk "$1" cd then local test "$1" --verbose printf
+	-eu then --verbose readonly awk export -eu "$1" sed |
+--verbose awk && readonly && then "$@" "$@" "$1" printf sed "$1" printf
+x=1 "$@" -eu printf test printf printf
+--verbose sed printf awk grep then local grep 'quoted text'
+	"$1" test $(pwd) printf 2>/dev/null 2>/dev/null "$1" echo
+| ${HOME} readonly 'quoted text' -eu cd printf 2>/dev/null local /usr/bin
+	awk printf readonly echo --verbose 2>/dev/null printf export cd
+		readonly awk sed export export 'quoted text' 'quoted text'
+	cd local 'quoted text' cd
+${HOME} "$1" x=1 grep export
+	/usr/bin cd 'quoted text' 2>/dev/null sed printf
+		done && test "$1" $(pwd) printf /usr/bin && "$1" ${HOME}
+	test 'quoted text' && printf awk cd local $(pwd) -eu 2>/dev/null
+grep awk 2>/dev/null -eu x=1 printf && -eu /usr/bin
+awk && -eu then export && sed printf cd test export echo -eu | cd "$@" "$1" 2>/dev/null
+awk readonly awk --verbose && && | -eu
+'quoted text' "$@" sed echo export ${HOME} 2>/dev/null |
+&& test then cd cd 2>/dev/null awk
+| 'quoted text' "$1" awk &&
+		"$@" grep /usr/bin done && echo
+	cd /usr/bin 'quoted text' /usr/bin /usr/bin && awk "$1" local
+	done sed "$1" awk local
+		${HOME} 'quoted text' grep awk -eu then printf
+	2>/dev/null then /usr/bin local sed grep printf && -eu
+		&& && cd export -eu awk cd ${HOME} /usr/bin
+	then 2>/dev/null "$@" cd echo /usr/bin --verbose done /usr/bin x=1 "$@"
+cd /usr/bin done echo grep 'quoted text' $(pwd)
+	awk 'quoted text' 2>/dev/null && cd --verbose && ${HOME} cd &&
+	then "$1" readonly local test | then test $(pwd)
+		&& 'quoted text' --verbose
+&& readonly then awk --verbose "$@" 'quoted text' 2>/dev/null --verbose
+		$(pwd) test | local 'quoted text' local --verbose sed 'quoted text'
+		cd then -eu then readonly then printf export x=1 2>/dev/null readonly
+grep 'quoted text' echo && -eu
+sed printf "$1" $(pwd) ${HOME} && cd echo 2>/dev/null
+	"$@" -eu cd "$@" printf $(pwd) && sed readonly awk $(pwd) awk | 'quoted text' -eu
+${HOME} --verbose $(pwd) 2>/dev/null x=1 "$1" test "$1"
+	readonly -eu 'quoted text' --verbose awk $(pwd) local
+x=1 cd grep --verbose readonly /usr/bin 2>/dev/null
+		then then --verbose | $(pwd) --verbose export
+--verbose printf grep ${HOME}
+	awk grep awk ${HOME} export 2>/dev/null /usr/bin awk ${HOME} | /usr/bin --verbose
+	/usr/bin && then "$@" printf awk echo | /usr/bin | 'quoted text' /usr/bin
+"$@" sed cd test -eu local ${HOME} x=1 "$@" /usr/bin test export
+	x=1 2>/dev/null printf printf printf $(pwd) readonly
+sed "$@" grep | "$@" export 'quoted text'
+	sed sed && "$@" "$1" ${HOME} cd cd sed local then | "$1" ${HOME} "$@"
+	echo export /usr/bin export && --verbose test 'quoted text' readonly
+	readonly grep "$1" test echo | done done sed && export -eu grep grep local "$@"
+	$(pwd) /usr/bin 2>/dev/null
+&& 2>/dev/null --verbose 'quoted text' local
+	&& grep 'quoted text' awk grep "$1" x=1 'quoted text' awk -eu 2>/dev/null
+		"$1" done done export then test | x=1 local ${HOME} local 2>/dev/null --verbose
+		echo --verbose "$1" 'quoted text'
+	grep 'quoted text' "$1" -eu
+		${HOME} && $(pwd) done 2>/dev/null -eu --verbose
+--verbose "$@" -eu readonly
+	sed test && -eu printf done -eu 2>/dev/null printf /usr/bin awk printf grep |
+		-eu x=1 ${HOME} --verbose && --verbose echo echo $(pwd)
+		test test export 'quoted text'
+	&& export "$@" -eu -eu test grep 'quoted text'
+	x=1 local sed ${HOME} -eu $(pwd)
+| grep ${HOME} local "$@" | 2>/dev/null 2>/dev/null "$1" sed
+-eu then && echo test done printf local echo "$1" done local /usr/bin 'quoted text'
+		printf test done /usr/bin -eu && done printf /usr/bin "$@" && sed
+		sed $(pwd) awk "$@" awk printf x=1 echo "$@"
+		then "$1" then test then local 2>/dev/null x=1 "$1" ${HOME} done printf 2>/dev/null
+| -eu ${HOME} "$1" 'quoted text' $(pwd) export && --verbose
+		then /usr/bin "$@" printf "$@" local
+done | && --verbose | local ${HOME} 'quoted text' local then export
+	awk "$@" test -eu && sed readonly local echo
+	'quoted text' x=1 awk grep readonly test cd -eu local 'quoted text' awk printf
+-eu sed test x=1 'quoted text' test 'quoted text' "$1" "$1" $(pwd)
+${HOME} readonly cd local
+/usr/bin export test awk --verbose 'quoted text' 2>/dev/null x=1 && done
+		2>/dev/null then --verbose then --verbose --verbose --verbose /usr/bin
+"$@" ${HOME} $(pwd) export 2>/dev/null /usr/bin $(pwd) then readonly done -eu -eu
+	&& then done readonly -eu 'quoted text'
+	sed "$@" test readonly awk /usr/bin ${HOME}
+	$(pwd) grep "$@" cd readonly "$@" cd "$1"
+"$1" readonly sed && test
+		"$1" --verbose /usr/bin | 'quoted text' readonly ${HOME} "$1"
+		cd printf x=1 "$1" sed $(pwd) awk test readonly 'quoted text'
+		printf 2>/dev/null &&
+	"$@" && "$@" export then printf ${HOME} "$1" && 2>/dev/null ${HOME} printf readonly
+	printf local /usr/bin 2>/dev/null
+		then && printf then /usr/bin readonly
+		local readonly done grep then echo && && test sed 2>/dev/null printf
+		${HOME} x=1 printf then x=1 |
+	x=1 export x=1 local /usr/bin awk local | grep local then echo echo
+sed && printf readonly --verbose $(pwd) local test && -eu done export
+		local grep $(pwd) readonly | ${HOME} $(pwd) export /usr/bin && "$1"
+	| "$1" -eu local --verbose $(pwd)
+	$(pwd) readonly grep x=1 cd readonly grep grep cd readonly x=1 cd
+	2>/dev/null test grep done 2>/dev/null export
+		--verbose 'quoted text' 2>/dev/null x=1 cd local cd cd printf
+echo x=1 $(pwd) sed ${HOME} x=1 2>/dev/null
+	'quoted text' "$@" readonly cd then done ${HOME} test echo cd $(pwd) done cd 'quoted text'
+	echo awk local && printf "$@" test 'quoted text' sed grep then
+local cd -eu printf | test local test echo
+		test grep then export export x=1 cd
+		export "$@" local -eu x=1 echo echo local then echo x=1 /usr/bin done test
+done awk readonly readonly export printf printf
+readonly test 'quoted text' export then ${HOME} readonly /usr/bin awk echo
+&& | | local 2>/dev/null -eu awk test -eu printf $(pwd) /usr/bin
+		"$1" done then done grep x=1 x=1 $(pwd) test "$1" export
+	printf "$@" sed readonly /usr/bin awk -eu echo "$1" "$1" "$1"
+$(pwd) && 'quoted text' then $(pwd) 2>/dev/null --verbose --verbose local
+		| done awk local "$1" | echo
+export then ${HOME} ${HOME} "$@" then && "$@" "$@" ${HOME}
+		export /usr/bin --verbose "$1" 2>/dev/null && sed readonly 'quoted text'
+		-eu 'quoted text' readonly done test --verbose ${HOME} echo awk export
+		local "$1" done -eu "$@" | $(pwd) export
+		x=1 -eu export grep readonly $(pwd) && local then export
+	export cd local && awk echo | readonly export
+	&& | && readonly ${HOME} --verbose /usr/bin --verbose
+2>/dev/null readonly ${HOME} 2>/dev/null awk -eu
+"$@" local local && sed 2>/dev/null $(pwd) 'quoted text'
+		x=1 export "$@" 'quoted text'
+		then --verbose grep export test && -eu local cd 2>/dev/null x=1 readonly
+	awk --verbose /usr/bin 'quoted text' ${HOME} &&
+${HOME} printf $(pwd) -eu /usr/bin
+local awk ${HOME} $(pwd) ${HOME} then echo echo "$@" "$@" x=1
+test test grep | readonly printf export | x=1 sed awk --verbose
+"$@" then echo cd 2>/dev/null
+cd -eu export local test cd -eu && sed local --verbose
+done 'quoted text' grep 'quoted text' -eu && grep cd sed x=1 awk &&
+cd readonly test --verbose | 'quoted text'
+		-eu done $(pwd) "$@" done --verbose awk "$1" test grep sed 'quoted text'
+#include c108.sh
+	done /usr/bin echo -eu 'quoted text' cd x=1 'quoted text'
+		done local -eu $(pwd) then "$@" ${HOME}
+		$(pwd) $(pwd) "$1" local ${HOME} --verbose local sed local "$@" sed
+		${HOME} "$1" echo -eu export local --verbose
+		then -eu then "$@" 'quoted text' local $(pwd) done cd
+&& | --verbose echo echo printf echo 2>/dev/null
+	readonly -eu awk $(pwd) grep /usr/bin printf printf ${HOME} echo local /usr/bin
+	printf echo | export export "$1" x=1 awk /usr/bin /usr/bin | ${HOME} local
+		local | awk --verbose cd export then | echo ${HOME} readonly cd 'quoted text'
+		awk export "$@" 'quoted text' -eu test done echo "$1" export sed /usr/bin
+	-eu | | sed && 2>/dev/null sed $(pwd) awk grep printf test local
+--verbose done && printf "$@" 'quoted text'
+	grep | | printf cd ${HOME} sed local readonly --verbose local 'quoted text'
+		&& --verbose export printf done local sed grep /usr/bin "$1" 'quoted text'
+	sed -eu done "$@" /usr/bin -eu $(pwd) ${HOME} && sed awk echo sed $(pwd) test
+		x=1 readonly export local sed then test done ${HOME}
+x=1 export && done ${HOME} grep "$@" readonly
+	"$1" 2>/dev/null "$1" awk export
+echo local then /usr/bin 'quoted text' x=1 /usr/bin export 'quoted text'
+	$(pwd) test "$1" && /usr/bin awk cd local && "$1" | printf |
+--verbose $(pwd) -eu readonly
+	"$1" ${HOME} then done printf done test "$1" done test --verbose then sed sed &&
+		printf echo local && printf "$1" | echo grep 2>/dev/null local printf
+		"$@" awk done "$1" "$1" done cd "$1" printf local sed
+grep cd readonly readonly printf
+	-eu 'quoted text' --verbose
+		sed done echo echo done grep 'quoted text'
+	| | && -eu "$@" ${HOME}
+	| readonly /usr/bin 'quoted text' grep ${HOME} "$@" /usr/bin --verbose grep
+	sed 2>/dev/null "$@" echo readonly
+echo done export x=1 2>/dev/null
+	echo && --verbose readonly && ${HOME} -eu
+test | "$1" x=1 /usr/bin "$@"
+	--verbose export $(pwd) | printf
+x=1 then export /usr/bin then then echo echo sed $(pwd)
+"$@" export export export
+cd then | x=1 cd x=1 then /usr/bin done --verbose
+	2>/dev/null | sed readonly ${HOME}
+export /usr/bin ${HOME} local --verbose "$1" then sed "$@"
+	| ${HOME} "$1" 'quoted text' printf
+		$(pwd) 'quoted text' "$@" local readonly test echo export x=1 echo
+		readonly test done && cd
+$(pwd) export 2>/dev/null
+	grep then readonly local | grep "$@" -eu readonly test sed "$@" then
+		'quoted text' echo /usr/bin 2>/dev/null
+local export then x=1 && --verbose printf readonly printf
+	cd && 'quoted text' then $(pwd) readonly sed "$1" $(pwd) done export $(pwd)
+printf | "$1" export grep cd sed
+		$(pwd) readonly $(pwd) | | readonly $(pwd) 2>/dev/null 2>/dev/null
+local local ${HOME} readonly grep readonly readonly $(pwd) x=1 ${HOME} printf
+		"$@" awk 'quoted text' readonly cd export export
+	$(pwd) then "$@" test sed x=1
+	readonly export local x=1 --verbose
+		cd 'quoted text' grep | | then --verbose
+--verbose readonly then printf
+		local local grep "$1" readonly "$@" -eu | awk
+	"$1" done then ${HOME} done then --verbose
+/usr/bin export test --verbose sed grep --verbose local -eu
+	2>/dev/null $(pwd) &&
+	export | x=1 ${HOME}
+		$(pwd) 2>/dev/null && readonly x=1 && done printf test awk echo echo x=1
+sed && && | ${HOME} export done local test ${HOME} /usr/bin /usr/bin awk cd done
+	test echo 'quoted text' cd export /usr/bin
+	-eu readonly --verbose
+	| "$@" | echo | "$@" /usr/bin $(pwd)
+x=1 then local local readonly -eu done 2>/dev/null
+| "$@" x=1 export echo export local --verbose test
+		readonly cd x=1 x=1 awk $(pwd) x=1 && readonly done -eu 2>/dev/null
+	cd grep printf "$@" $(pwd) test
+export x=1 awk "$1" --verbose $(pwd) --verbose echo export
+		sed export sed && readonly printf printf "$1" "$1" then
+		done readonly | ${HOME} 'quoted text' ${HOME} test /usr/bin export 2>/dev/null
+	2>/dev/null 'quoted text' "$@" -eu export echo grep ${HOME}
+-eu "$@" && | cd local "$1" -eu printf printf $(pwd) awk x=1 grep /usr/bin
+	${HOME} "$@" cd | -eu cd x=1 2>/dev/null cd x=1 readonly
+	grep 'quoted text' readonly export sed sed awk 2>/dev/null $(pwd) /usr/bin
+sed | sed echo cd 'quoted text'
+sed /usr/bin 2>/dev/null readonly 2>/dev/null
+	readonly 2>/dev/null grep printf 'quoted text' awk sed grep $(pwd)
+2>/dev/null $(pwd) grep 2>/dev/null echo ${HOME} readonly "$@" -eu then
+x=1 sed "$@" "$@" $(pwd) test echo x=1 "$1"
+/usr/bin 2>/dev/null sed done cd export sed /usr/bin
+done done local | && sed "$@" "$@" readonly test awk printf /usr/bin x=1 then x=1
+test "$1" -eu $(pwd) "$1" readonly printf export $(pwd) x=1 readonly
+		$(pwd) cd cd sed printf && awk cd ${HOME} done sed x=1 2>/dev/null $(pwd) x=1 |
+		readonly "$1" ${HOME} $(pwd) test 'quoted text' "$1" -eu x=1 awk test
+	-eu ${HOME} printf x=1 x=1 then --verbose -eu sed test printf local
+awk | $(pwd) local 2>/dev/null 'quoted text' 'quoted text' cd /usr/bin
+grep then ${HOME} | -eu sed $(pwd) /usr/bin | "$@" "$@"
+cd export done grep --verbose grep -eu sed --verbose "$@"
+		test export grep printf
+sed "$@" done -eu 2>/dev/null /usr/bin 'quoted text' | $(pwd) --verbose
+		$(pwd) awk test sed sed grep export done -eu x=1 cd then
+	sed "$1" --verbose 2>/dev/null grep && done grep -eu "$@" x=1 && $(pwd)
+sed ${HOME} | test awk readonly x=1 done
+		${HOME} 'quoted text' grep grep
+	x=1 printf sed "$@" "$1" test awk cd grep printf -eu readonly "$1" | test cd
+"$1" grep grep test awk "$@" "$1" && readonly "$1" readonly "$@" $(pwd)
+	echo && printf $(pwd) x=1 $(pwd)
+readonly sed "$@" 'quoted text' ${HOME} x=1 'quoted text' x=1 echo
+	| ${HOME} 'quoted text' && done then then "$1"
+local local /usr/bin then local export 'quoted text' 2>/dev/null
+	${HOME} printf then 'quoted text'
+		printf "$1" awk /usr/bin
+		2>/dev/null 'quoted text' awk -eu test
+		x=1 $(pwd) "$@" ${HOME} export grep "$@" $(pwd) local x=1 ${HOME} x=1 x=1 "$@" local
+	--verbose -eu local done readonly sed grep "$1" "$@" echo 'quoted text' local
+		sed x=1 $(pwd) local done echo test readonly sed test $(pwd) printf grep local
+/usr/bin done done "$1" grep readonly
+		--verbose readonly --verbose 'quoted text' x=1 -eu $(pwd) "$1"
+	test awk test done then awk /usr/bin done -eu --verbose 'quoted text'
+		awk | done local awk ${HOME} done
+	done --verbose awk awk "$1" --verbose $(pwd) echo $(pwd) $(pwd) "$@" ${HOME} 2>/dev/null
+2>/dev/null | "$1" test | printf "$@" readonly |
+		$(pwd) then awk "$@" /usr/bin then test x=1 ${HOME} -eu "$1" grep awk 2>/dev/null
+	grep 'quoted text' grep sed /usr/bin cd $(pwd) "$@" /usr/bin
+	-eu sed "$@" -eu "$1" sed test 2>/dev/null -eu grep test grep 2>/dev/null
+	| test awk 'quoted text' printf sed 2>/dev/null 'quoted text' awk
+'quoted text' -eu awk x=1 x=1 $(pwd) sed "$@" echo /usr/bin awk export
+	${HOME} /usr/bin --verbose done && printf
+printf | "$1" && --verbose
+awk printf grep $(pwd) echo
+${HOME} -eu "$1" $(pwd) echo /usr/bin
+done done awk /usr/bin local test -eu
+'quoted text' sed export cd cd awk cd cd
+	cd done awk grep -eu done "$1" sed x=1 2>/dev/null echo
+		"$@" done "$@" done grep done
+		2>/dev/null "$1" local done done
+		done "$1" readonly /usr/bin "$@" printf echo then
+$(pwd) echo | cd | echo
+		cd && x=1 "$@" awk export cd | export echo 2>/dev/null local --verbose then
+test test /usr/bin readonly ${HOME} then then
+	-eu "$@" --verbose --verbose && 'quoted text' local $(pwd) "$@" test cd "$@" /usr/bin
+		test export /usr/bin 'quoted text' "$@" 'quoted text'
+		printf grep cd /usr/bin done readonly echo "$@"
+	--verbose readonly then then printf export readonly ${HOME} then "$@"
+		--verbose sed $(pwd) readonly "$1" awk 'quoted text' done done ${HOME} ${HOME}
+		"$1" test then local | grep --verbose
+cd /usr/bin /usr/bin cd "$1" | readonly "$@" awk done awk awk grep printf echo
+		/usr/bin | /usr/bin local cd printf "$1" --verbose
+| -eu x=1 -eu ${HOME} export readonly cd x=1 && 'quoted text'
+	"$@" echo "$1" -eu --verbose -eu /usr/bin x=1 grep printf
+$(pwd) cd -eu --verbose ${HOME} "$@" awk readonly x=1 awk | && test
+		printf "$1" --verbose awk 2>/dev/null then
+	$(pwd) grep $(pwd) then readonly
+	then x=1 x=1 'quoted text' --verbose awk done
+	awk grep awk $(pwd) 'quoted text'
+	echo && 'quoted text' readonly --verbose cd readonly awk printf "$1"
+		--verbose test then then "$@" echo -eu $(pwd) $(pwd)
+sed ${HOME} test readonly --verbose export grep 'quoted text'
+		/usr/bin local local awk
+		awk export sed 2>/dev/null local /usr/bin done
+		2>/dev/null $(pwd) sed sed then /usr/bin "$1" awk cd export
+${HOME} done echo -eu printf done echo
+	"$@" ${HOME} "$@" ${HOME} x=1 printf done && "$1" --verbose cd "$1" ${HOME} &&
+sed /usr/bin $(pwd) cd 2>/dev/null sed echo printf x=1 local ${HOME}
+	'quoted text' sed -eu | "$1" cd --verbose
+readonly awk readonly ${HOME} printf local sed cd "$@" | done /usr/bin
+		-eu printf echo cd --verbose readonly ${HOME} /usr/bin
+		2>/dev/null ${HOME} --verbose 'quoted text'
+	| /usr/bin echo /usr/bin printf local cd export && done
+	readonly /usr/bin -eu cd $(pwd) readonly && then $(pwd) ${HOME} && -eu
+		x=1 x=1 'quoted text' 'quoted text' printf 'quoted text' awk cd grep export cd
+		| cd echo "$1" printf grep done --verbose -eu done awk
+	grep grep $(pwd) --verbose test export $(pwd) export grep readonly --verbose
+		test grep $(pwd) "$@" | done sed "$1" $(pwd)
+		echo 'quoted text' cd echo
+		| sed ${HOME} echo test readonly x=1 x=1 awk local
+sed cd export /usr/bin echo
+		sed x=1 --verbose local then -eu -eu then "$@"
+		echo /usr/bin echo done "$1" "$1" readonly
+test grep && local grep 2>/dev/null 2>/dev/null local -eu x=1
+then printf && && readonly
+		$(pwd) awk 2>/dev/null awk grep 2>/dev/null cd | readonly
+test $(pwd) readonly | done local && printf && printf --verbose sed local
+		grep ${HOME} 'quoted text' grep readonly
+		2>/dev/null $(pwd) done local 'quoted text' 2>/dev/null
+	test printf export cd ${HOME} ${HOME} --verbose cd | -eu done echo awk
+		"$1" echo && /usr/bin --verbose done "$1" "$@" readonly "$@" sed
+	--verbose x=1 -eu x=1 --verbose
+	x=1 x=1 ${HOME} -eu && x=1 sed cd awk printf "$1" test
+-eu export $(pwd) sed && ${HOME} 'quoted text'
+	--verbose --verbose && printf x=1
+		/usr/bin awk --verbose ${HOME} -eu local local
+		-eu --verbose readonly "$1" && local sed readonly echo ${HOME} "$1" awk
+echo 2>/dev/null grep sed export echo && cd printf
+--verbose grep cd "$@" readonly --verbose cd
+		/usr/bin cd awk test -eu printf ${HOME} cd x=1 sed
+	cd cd "$1" 'quoted text' 'quoted text' grep && sed 2>/dev/null /usr/bin x=1
+		done printf printf $(pwd) test && done grep done "$@" export ${HOME}
+	&& cd export local 'quoted text' awk then && done $(pwd) test cd test "$@" 2>/dev/null
+	grep done readonly $(pwd)
+	local local "$@" 2>/dev/null grep
+	"$1" /usr/bin "$@" --verbose
+done cd test awk echo export 'quoted text'
+export readonly && && && && awk export
+	"$@" --verbose "$1" grep local
+2>/dev/null done | 'quoted text' ${HOME} x=1 done readonly $(pwd) 2>/dev/null
+readonly readonly | "$1" sed --verbose echo $(pwd) sed "$1" ${HOME} &&
+	&& -eu grep printf && printf "$1" x=1 2>/dev/null cd echo local readonly
+	readonly printf local echo done "$1" |
+	&& 2>/dev/null test printf -eu local 'quoted text'
+	"$@" printf test --verbose -eu awk printf done cd --verbose 2>/dev/null
+&& sed sed readonly --verbose --verbose "$1" cd test sed
+		test local done | cd printf "$@" --verbose "$@" readonly grep
+	sed /usr/bin local 'quoted text' --verbose local grep awk x=1
+	x=1 sed export "$@" done local "$1" 'quoted text' export
+	local 2>/dev/null "$1" done then local --verbose export test test test &&
+		--verbose echo export ${HOME} | x=1 | done echo grep printf --verbose
+		--verbose $(pwd) local done -eu --verbose local "$@"
+	$(pwd) | readonly 'quoted text' "$@" done
+	${HOME} --verbose cd && readonly cd ${HOME}
+		then "$1" done --verbose then readonly cd && done
+x=1 && | "$1" then && --verbose | sed local cd $(pwd)
+	awk "$@" x=1 readonly x=1 'quoted text' then
+		printf sed && then cd ${HOME}
+	2>/dev/null export "$@" --verbose $(pwd) printf ${HOME} /usr/bin
+sed x=1 grep test printf printf then local readonly local cd ${HOME} x=1
+		${HOME} && $(pwd) | grep
+		printf && "$@" local 2>/dev/null then then awk
+		2>/dev/null awk 'quoted text' local $(pwd) readonly 'quoted text' echo
+		2>/dev/null grep export printf local 2>/dev/null
+sed 'quoted text' x=1 "$@" local sed | --verbose
+grep cd ${HOME} $(pwd) 'quoted text' grep | 2>/dev/null 2>/dev/null "$1" cd
+	${HOME} && ${HOME} export
+printf 2>/dev/null echo "$@" -eu --verbose
+		cd readonly readonly awk $(pwd) export
+	test --verbose printf
+2>/dev/null 2>/dev/null "$@" "$1" readonly ${HOME} ${HOME}
+	done readonly /usr/bin done test echo readonly /usr/bin awk
+		test && "$1" x=1 done grep $(pwd) readonly /usr/bin /usr/bin
+awk 'quoted text' grep
+		readonly ${HOME} x=1 readonly grep awk 2>/dev/null
+		$(pwd) export done "$@" "$@" awk 2>/dev/null "$1" 2>/dev/null
+echo export | printf sed --verbose awk echo "$1"
+echo "$@" $(pwd) echo -eu && test
+		awk "$@" then x=1 "$1" --verbose "$1" -eu 'quoted text' --verbose 2>/dev/null
+	"$1" test done then "$@" ${HOME} "$@" export $(pwd) then -eu readonly
+		then echo sed "$@" awk grep awk echo
+	then cd /usr/bin 2>/dev/null "$1"
+		"$@" local export sed printf cd readonly test grep test 'quoted text'
+x=1 'quoted text' printf printf sed export local awk done x=1 "$@" "$1"
+		export echo readonly -eu 'quoted text' then then "$1" sed $(pwd) -eu export
+		| local /usr/bin echo 'quoted text' /usr/bin
+		readonly ${HOME} then /usr/bin -eu readonly test readonly 'quoted text'
+	awk x=1 $(pwd) | test 'quoted text' | cd echo -eu printf grep 2>/dev/null
+	&& awk readonly printf echo && "$1" x=1 local
+echo readonly test 2>/dev/null echo /usr/bin readonly |
+local readonly $(pwd) echo $(pwd) test "$1" $(pwd) test "$@" readonly /usr/bin
+done ${HOME} readonly /usr/bin x=1 x=1 ${HOME} && echo --verbose
+export /usr/bin sed | && export -eu 'quoted text' 2>/dev/null
+		cd done | readonly /usr/bin readonly grep cd grep /usr/bin done readonly
+	&& --verbose 'quoted text'
+		test -eu && readonly ${HOME} --verbose echo x=1 export readonly
+awk local 'quoted text' sed 'quoted text' 2>/dev/null echo
+	done $(pwd) | local "$@" | --verbose awk "$1" /usr/bin "$@" ${HOME} /usr/bin
+	"$1" "$@" export 'quoted text' && export readonly
+'quoted text' then awk test
+cd 'quoted text' awk ${HOME} then $(pwd) readonly export local
+'quoted text' export local
+	cd done printf awk | "$@" x=1 && | /usr/bin
+	"$1" readonly /usr/bin --verbose --verbose done | /usr/bin
+	--verbose sed export x=1 done cd -eu /usr/bin && printf test cd x=1
+"$@" -eu done /usr/bin 2>/dev/null
+--verbose cd $(pwd) readonly echo
+	sed --verbose x=1 | "$@" "$@" && sed grep local -eu "$1" /usr/bin
+		printf sed ${HOME} test done /usr/bin $(pwd) sed then
+		cd /usr/bin printf done "$@" -eu awk 2>/dev/null readonly x=1
+/usr/bin echo grep then export test
+		"$1" /usr/bin /usr/bin x=1 /usr/bin cd "$1" awk 'quoted text' 'quoted text'
+		printf export $(pwd) 2>/dev/null
+grep test && "$@" readonly -eu 2>/dev/null --verbose
+"$@" $(pwd) local /usr/bin ${HOME} export local then "$@"
+	awk x=1 2>/dev/null -eu | "$1" grep grep test echo x=1 --verbose grep ${HOME}
+	"$@" | && then done done
+${HOME} readonly done then sed
+		/usr/bin done $(pwd) x=1 awk --verbose --verbose 'quoted text'
+local printf --verbose then echo
+	$(pwd) --verbose readonly echo
+$(pwd) test awk done ${HOME}
+echo "$@" -eu x=1 'quoted text'
+		&& done "$@" readonly readonly -eu awk --verbose cd export
+	export readonly awk awk
+"$@" sed awk /usr/bin then
+	awk -eu | printf awk test && grep x=1 test "$1" grep $(pwd) -eu &&
+	'quoted text' $(pwd) "$1" -eu $(pwd) test done printf
+		readonly "$@" "$1" done printf sed then readonly
+| test grep 2>/dev/null --verbose && grep $(pwd) /usr/bin
+	echo --verbose --verbose done printf test sed "$@" "$1" -eu sed
+export then && echo "$@" done test
+	$(pwd) sed echo done readonly echo /usr/bin
+		| 'quoted text' done readonly "$@" -eu 'quoted text' -eu
+		readonly /usr/bin readonly export local /usr/bin | "$@"
+then /usr/bin "$1" 2>/dev/null local export x=1 "$1" | && readonly $(pwd)
+grep && 2>/dev/null readonly /usr/bin x=1 /usr/bin 2>/dev/null
+2>/dev/null "$1" readonly readonly
+		| 'quoted text' cd done && grep -eu cd 'quoted text'
+		| export awk "$1" 2>/dev/null local ${HOME} grep
+	-eu x=1 ${HOME} echo /usr/bin sed 'quoted text'
+		| echo grep awk sed "$1" "$@" test | 2>/dev/null local
+	test | test ${HOME} 'quoted text'
+	done grep $(pwd) $(pwd)
+then then "$@" "$1" -eu then "$1" then test $(pwd) ${HOME} /usr/bin
+	&& /usr/bin awk grep x=1 2>/dev/null
+grep --verbose $(pwd) done /usr/bin done local "$1" done 'quoted text' --verbose
+		awk test "$1" "$1" "$@" grep export printf readonly
+${HOME} done /usr/bin -eu $(pwd) | ${HOME} /usr/bin
+		done grep readonly && test done test && $(pwd) 2>/dev/null |
+awk x=1 "$1" 2>/dev/null $(pwd) | "$@" x=1 -eu -eu $(pwd) echo sed 'quoted text'
+cd "$@" cd -eu /usr/bin | readonly printf test local local awk
+cd /usr/bin -eu done $(pwd) done
+&& grep cd "$1" 2>/dev/null /usr/bin readonly readonly
+		x=1 | /usr/bin x=1 x=1 'quoted text' export test test echo readonly ${HOME} $(pwd)
+	"$@" local cd grep test done awk 'quoted text'
+	/usr/bin && done /usr/bin x=1 "$1" | /usr/bin --verbose local -eu "$1" grep
+		x=1 grep ${HOME} local
+	sed echo ${HOME} test then printf ${HOME}
+printf sed sed test awk | 2>/dev/null | done ${HOME} echo awk sed --verbose
+		printf printf ${HOME} export export "$1"
+	"$1" 2>/dev/null "$@" 2>/dev/null echo sed then awk echo $(pwd)
+	2>/dev/null sed "$1" -eu | printf then sed
+	"$1" done $(pwd) echo test "$@" 'quoted text'
+--verbose sed ${HOME} export local then
+done "$@" 2>/dev/null cd $(pwd)
+	${HOME} test ${HOME} 2>/dev/null x=1 | printf then
+grep x=1 2>/dev/null &&
+	$(pwd) -eu export awk 'quoted text'
+x=1 x=1 awk export local cd echo /usr/bin
+		'quoted text' then 'quoted text' x=1 readonly printf x=1 &&
+		awk sed --verbose echo grep awk "$1" --verbose
+/usr/bin sed awk awk "$@" done "$1" sed
+	"$1" then --verbose -eu $(pwd)
+	export 'quoted text' /usr/bin x=1 local $(pwd) local
+cd readonly cd $(pwd) local
+cd test $(pwd) 'quoted text' "$@" | -eu printf export done grep test "$@" --verbose
+	&& then export readonly done cd $(pwd) && && cd local -eu $(pwd) grep export 'quoted text'
+done /usr/bin awk sed 2>/dev/null | test ${HOME} local local
+	sed 'quoted text' printf /usr/bin export awk readonly
+	"$@" | cd awk sed export local local
+	done ${HOME} 'quoted text'
+${HOME} -eu -eu $(pwd) export awk
+local echo $(pwd) awk ${HOME} x=1 | -eu | 2>/dev/null local
+	/usr/bin ${HOME} | -eu && grep 'quoted text' sed "$1" -eu -eu sed echo
+	x=1 "$@" export -eu && 2>/dev/null | export printf done
+		then && 2>/dev/null | ${HOME} echo
+	local -eu then ${HOME} export export test awk ${HOME} readonly "$1" local && done
+'quoted text' then printf grep readonly sed local printf 'quoted text'
+	then 'quoted text' "$1" local done test awk && && test awk printf
+		awk | test x=1 "$1" /usr/bin local
+		awk export | && $(pwd)
+	grep export export grep /usr/bin ${HOME} -eu 'quoted text' sed "$1"
+sed awk && 'quoted text' export /usr/bin done -eu test /usr/bin
+readonly done "$@" --verbose then local test done cd export
+		done 2>/dev/null test | 2>/dev/null
+	printf awk awk 2>/dev/null
+		$(pwd) echo "$1" grep local --verbose readonly
+echo /usr/bin test echo grep $(pwd)
+	sed awk readonly cd local done cd local -eu test 2>/dev/null export --verbose &&
+		done done cd readonly cd ${HOME} then x=1 -eu done cd ${HOME}
+		printf $(pwd) cd && local --verbose cd echo 2>/dev/null cd 'quoted text'
+	| | done echo printf cd && "$@" done /usr/bin --verbose
+readonly sed sed "$1" 'quoted text' cd sed echo | && local sed --verbose $(pwd)
+		local 'quoted text' awk readonly | /usr/bin printf x=1 readonly
+x=1 local export printf 2>/dev/null -eu then printf test echo
+&& echo then -eu readonly printf
+	echo local test /usr/bin printf 2>/dev/null
+		"$1" test "$1" $(pwd) grep 2>/dev/null
+awk done && export 2>/dev/null x=1 echo && "$1" -eu /usr/bin
+	test /usr/bin cd local 'quoted text' grep 'quoted text' readonly &&
+2>/dev/null x=1 --verbose /usr/bin cd x=1 && done sed done --verbose
+		| done grep sed printf $(pwd) 'quoted text' done 'quoted text' "$@" readonly
+	x=1 printf sed "$@" local test echo
+		awk readonly done "$1" test
+	2>/dev/null export | x=1 cd test "$@" readonly sed echo export
+		local export "$1" /usr/bin "$1"
+		'quoted text' echo done sed awk $(pwd) done local echo 'quoted text' --verbose
+${HOME} /usr/bin awk export sed readonly printf "$@" /usr/bin
+		'quoted text' then readonly export echo
+		awk "$1" 2>/dev/null printf && "$1" && export ${HOME} then awk $(pwd)
+	| /usr/bin -eu printf grep
+		"$1" test cd --verbose then "$1"
+		readonly 'quoted text' grep test
+test export awk readonly readonly printf &&
+		test awk -eu $(pwd) sed
+	"$1" test --verbose cd sed
+	x=1 "$1" "$1" done /usr/bin | /usr/bin sed printf -eu
+		cd then test /usr/bin
+	grep cd ${HOME} sed export "$1" 'quoted text' printf ${HOME}
+	"$@" echo | cd 'quoted text' ${HOME} echo $(pwd) export /usr/bin /usr/bin -eu
+"$1" awk -eu && awk -eu grep 'quoted text' -eu
+'quoted text' done printf sed && echo export ${HOME} cd && awk 'quoted text'
+		$(pwd) done | /usr/bin "$1" | awk
+		local 2>/dev/null readonly x=1 grep -eu then && done
+		--verbose test grep printf readonly grep grep /usr/bin "$1" export "$1" "$@"
+	echo readonly done done "$1" printf
+-eu /usr/bin test "$@" echo readonly
+		awk 2>/dev/null "$@" 2>/dev/null
+	done done then 'quoted text' "$@" test ${HOME} --verbose
+	then 'quoted text' "$1" sed ${HOME} $(pwd) then test
+		readonly then | then local | awk | "$1" done sed --verbose $(pwd)
+		$(pwd) x=1 "$1" "$1" 2>/dev/null grep awk readonly $(pwd) local readonly
+	test cd "$1" | export --verbose local
+		$(pwd) grep cd "$1" $(pwd)
+		test test awk 'quoted text'
+readonly local "$1" "$@" grep echo test -eu then && "$1" then cd | "$1"
+		echo awk then export -eu $(pwd) echo test then "$1" | "$1" | test awk export
+sed /usr/bin /usr/bin | sed /usr/bin export echo then
+cd $(pwd) "$@" readonly cd sed grep "$1" grep local $(pwd)
+		x=1 -eu --verbose 'quoted text' test 2>/dev/null export --verbose
+	"$1" awk cd grep test /usr/bin --verbose then "$1" -eu |
+test "$1" 2>/dev/null x=1 grep
+	/usr/bin printf ${HOME} grep --verbose /usr/bin /usr/bin cd echo readonly
+test "$1" done awk grep cd grep 'quoted text' grep then ${HOME} ${HOME}
+	grep /usr/bin cd echo "$@" 2>/dev/null cd local printf x=1 -eu /usr/bin
+then done && && "$@" echo | test "$@" /usr/bin local "$1" "$@" done echo
+	$(pwd) 'quoted text' export cd 'quoted text' awk then
+		$(pwd) export awk sed && awk export readonly $(pwd) -eu "$1" readonly done "$@"
+		"$1" export "$@" then cd readonly
+| -eu readonly echo awk sed local ${HOME} "$1" test $(pwd) test | cd grep &&
+		2>/dev/null "$@" --verbose -eu -eu --verbose --verbose /usr/bin
+		| 'quoted text' local local grep 2>/dev/null awk -eu $(pwd) then
+		sed x=1 export readonly printf export /usr/bin "$@" 2>/dev/null
+		test 2>/dev/null printf ${HOME} echo ${HOME}
+	printf x=1 awk -eu 2>/dev/null test
+	test readonly /usr/bin "$1" -eu
+	export awk ${HOME} grep
+-eu echo readonly 'quoted text' /usr/bin
+		test ${HOME} "$1" readonly && cd 'quoted text'
+		awk grep export done grep 2>/dev/null then sed
+local -eu echo done -eu readonly then export x=1 echo
+		grep readonly /usr/bin 2>/dev/null sed export $(pwd) readonly --verbose readonly
+		/usr/bin echo "$1" x=1 done sed printf then cd
+readonly --verbose --verbose --verbose $(pwd) 'quoted text'
+		local sed then grep --verbose "$@" 'quoted text'
+	awk awk ${HOME} printf | ${HOME}
+printf awk done "$1" --verbose readonly --verbose export
+		/usr/bin echo 'quoted text' -eu 'quoted text'
+		x=1 awk export ${HOME} --verbose
+	--verbose local readonly done
+then awk echo && "$@" 2>/dev/null
+	-eu export sed readonly --verbose ${HOME} sed local 2>/dev/null |
+| ${HOME} 'quoted text' grep
+		x=1 ${HOME} local | then $(pwd) grep 2>/dev/null
+readonly test export "$@" x=1 -eu $(pwd) readonly
+2>/dev/null done --verbose "$@" echo
+	'quoted text' grep echo readonly
+		sed "$@" readonly -eu done sed cd && --verbose
+export 2>/dev/null 'quoted text' x=1 --verbose test x=1 cd x=1
+echo awk /usr/bin /usr/bin x=1 x=1 export done
+		x=1 export x=1 done $(pwd) awk
+/usr/bin -eu test then test awk x=1 "$1" done
+	readonly "$1" printf awk export 2>/dev/null done x=1 /usr/bin grep grep 'quoted text'
+awk cd 2>/dev/null local
+	'quoted text' test "$1" -eu | then 'quoted text' sed 2>/dev/null
+		/usr/bin ${HOME} grep local --verbose cd | grep export
+	$(pwd) ${HOME} then printf done done $(pwd) sed test
+	grep printf sed 'quoted text' -eu --verbose
+	done /usr/bin export printf awk printf awk readonly
+		&& then 2>/dev/null "$1" printf
+		printf --verbose 'quoted text' --verbose $(pwd) -eu 2>/dev/null 2>/dev/null
+printf printf export echo && ${HOME}
+	"$@" awk 2>/dev/null echo "$1" readonly
+awk 'quoted text' done echo grep export /usr/bin "$@" export local
+		printf && sed export 2>/dev/null
+$(pwd) && cd grep ${HOME} cd local awk /usr/bin readonly && printf
+	/usr/bin --verbose grep | export 2>/dev/null awk 2>/dev/null
+printf echo -eu && local readonly test
+		local export 2>/dev/null local "$1" x=1 "$1" /usr/bin "$1" echo "$@" && printf
+-eu 'quoted text' printf sed test echo done | "$@" done cd && then 2>/dev/null
+		| local readonly echo sed 'quoted text' /usr/bin done
+		--verbose "$@" then ${HOME} cd "$1" --verbose &&
+awk x=1 done cd test export sed echo x=1 echo readonly awk test
+		--verbose local $(pwd) awk cd --verbose --verbose awk readonly
+printf | "$@" local | readonly
+local echo grep --verbose then sed 'quoted text'
+	"$1" echo $(pwd) 'quoted text'
+--verbose sed "$@" grep "$@"
+	"$@" x=1 readonly local printf then $(pwd) --verbose done cd sed /usr/bin awk
+export local awk | then x=1 "$1" $(pwd) readonly awk readonly done && echo printf
+then /usr/bin done done cd
+	x=1 "$@" x=1 printf readonly 'quoted text' then
+	/usr/bin "$1" $(pwd) --verbose readonly readonly then --verbose
+cd $(pwd) then --verbose grep then printf --verbose "$1" grep then readonly
+	"$1" export 'quoted text' $(pwd) "$@"
+-eu then && $(pwd) $(pwd) | x=1 export done
+	"$1" /usr/bin "$1" 'quoted text' then
+		export done && sed sed && echo
+		--verbose 2>/dev/null awk export printf cd then --verbose cd 'quoted text'
+test echo 2>/dev/null cd "$@" sed | then x=1 grep
+	local "$@" && --verbose
+	test x=1 awk done echo -eu /usr/bin printf readonly awk "$1"
+test && --verbose export
+		"$@" awk echo sed x=1 | sed cd then x=1 -eu done && local grep readonly then
+"$1" readonly done test
+		grep readonly /usr/bin "$1" 2>/dev/null
+		x=1 done | local "$1" x=1
+readonly 'quoted text' | local grep export ${HOME} ${HOME} 'quoted text'
+	done done printf grep x=1
+grep then "$1" printf local | 2>/dev/null sed
+		"$1" /usr/bin && --verbose --verbose printf 2>/dev/null ${HOME} --verbose
+		&& | printf readonly "$1" && $(pwd) $(pwd) -eu
+"$1" test "$@" && printf ${HOME} echo --verbose "$1" export --verbose
+	x=1 $(pwd) awk "$1" export then | printf then ${HOME} echo 2>/dev/null "$1"
+	local grep --verbose --verbose cd | done "$1" |
+echo cd echo local -eu | /usr/bin echo 'quoted text'
+"$@" && -eu local then local "$1" x=1 && && "$1" grep "$@" $(pwd) echo
+cd local test readonly export readonly echo 'quoted text' echo printf
+	awk 'quoted text' $(pwd) test x=1 awk -eu readonly
+	export --verbose ${HOME} echo "$1" | printf done cd "$@" export
+sed echo 2>/dev/null $(pwd) then && readonly printf local "$@" "$@" "$@"
+	local export "$1" echo -eu "$1" /usr/bin awk cd 'quoted text'
+		${HOME} ${HOME} -eu cd export && printf -eu 2>/dev/null
+		sed | export 'quoted text' ${HOME} export ${HOME} done ${HOME} --verbose
+	| -eu grep test then --verbose
+	"$1" export ${HOME} 'quoted text' /usr/bin 'quoted text' --verbose
+		&& ${HOME} /usr/bin readonly awk "$@" 'quoted text' ${HOME}
+	printf cd readonly 'quoted text' /usr/bin "$@" sed grep
+/usr/bin "$1" export && export
+2>/dev/null /usr/bin 'quoted text'
+	printf --verbose readonly $(pwd)
+then echo 2>/dev/null export then x=1 && /usr/bin 'quoted text' echo x=1
+		cd -eu 2>/dev/null export awk "$1" sed /usr/bin sed test 'quoted text'
+	export 'quoted text' done sed && test && cd sed && 'quoted text' sed "$@" && printf
+echo local "$1" test /usr/bin cd /usr/bin 2>/dev/null
+	printf -eu 'quoted text' 'quoted text' readonly export awk "$@" 2>/dev/null
+x=1 | readonly sed test x=1 export "$1" awk
+		awk /usr/bin awk 2>/dev/null "$@" $(pwd) cd 2>/dev/null then awk x=1 printf
+| && echo --verbose --verbose cd printf /usr/bin $(pwd) -eu then 2>/dev/null printf
+		done grep test -eu -eu printf export $(pwd) local export "$@" local -eu
+	echo local then ${HOME} awk x=1 sed /usr/bin test done /usr/bin
+--verbose $(pwd) /usr/bin && readonly cd && -eu
+$(pwd) readonly echo && "$1" ${HOME} export readonly "$@" | sed done printf &&
+		$(pwd) x=1 | "$@" && awk then x=1 grep x=1
+		--verbose grep sed ${HOME} sed cd echo x=1 cd
+		x=1 $(pwd) "$@" then echo awk done done awk sed "$@" awk "$1" 'quoted text' -eu
+	cd $(pwd) /usr/bin 'quoted text' sed echo test done export
+	&& -eu readonly export sed sed grep && x=1 export local
+	--verbose && done ${HOME} &&
+	cd cd --verbose awk ${HOME} $(pwd) x=1 ${HOME} $(pwd) sed 2>/dev/null x=1
+		cd export "$1" "$1" echo
+		'quoted text' echo awk local "$@" cd x=1 'quoted text'
+		| 2>/dev/null cd sed readonly -eu "$1" awk done "$@"
+		echo printf done 'quoted text' test | $(pwd) | cd then
+&& awk export -eu 2>/dev/null --verbose 'quoted text'
+	-eu 'quoted text' && 2>/dev/null 2>/dev/null grep 2>/dev/null printf $(pwd)
+	x=1 export grep sed then /usr/bin x=1
+	"$@" x=1 $(pwd) 'quoted text' awk $(pwd) && sed x=1 "$1" 2>/dev/null "$1" readonly
+local then readonly awk echo x=1 awk local x=1 done
+		$(pwd) -eu --verbose readonly export | "$1" $(pwd) | ${HOME}
+2>/dev/null -eu test export echo awk $(pwd) local awk
+awk | $(pwd) export --verbose
+		sed ${HOME} $(pwd) then then && done
+		awk && 'quoted text' test readonly awk /usr/bin test "$1" then
+		x=1 cd then /usr/bin | x=1 export printf -eu sed -eu &&
+		done test echo $(pwd) printf test readonly done "$@" done |
+		local 'quoted text' then x=1 test -eu readonly x=1 grep
+		${HOME} echo printf sed then -eu grep 'quoted text' 2>/dev/null 'quoted text'
+export "$1" --verbose --verbose ${HOME} 2>/dev/null --verbose
+		local ${HOME} && $(pwd) local readonly 'quoted text' then readonly
+	local local $(pwd) printf /usr/bin "$@" echo export readonly --verbose -eu
+		"$@" && local | && cd -eu readonly && sed --verbose
+		then done grep --verbose test 2>/dev/null $(pwd) then | printf
+	cd "$1" && then then ${HOME} printf -eu sed printf
+export cd grep printf --verbose
+	done printf $(pwd) "$1" -eu then $(pwd) echo "$@" echo "$1"
+	x=1 echo --verbose -eu awk x=1 grep 'quoted text' "$1" sed test
+--verbose -eu done then && 2>/dev/null export
+	local local "$@" x=1 2>/dev/null && "$@" /usr/bin "$1" sed cd && done -eu then
+'quoted text' export echo 2>/dev/null local test "$@" local echo ${HOME}
+		| awk -eu test cd /usr/bin printf cd /usr/bin
+	--verbose echo 2>/dev/null x=1 cd then cd x=1
+	--verbose x=1 readonly
+		| | grep $(pwd) local "$1" | cd readonly readonly && --verbose 2>/dev/null
+	echo -eu done $(pwd) then
+then test --verbose printf "$1"
+		done export --verbose | "$@" readonly export readonly
+	${HOME} x=1 echo --verbose -eu x=1 done test done 'quoted text'
+then local printf local grep 2>/dev/null $(pwd)
+done && -eu 'quoted text' then "$1" local local 'quoted text' readonly
+	&& -eu sed echo "$1" grep $(pwd) --verbose
+	done readonly then x=1 'quoted text'
+"$@" cd -eu export test grep /usr/bin
+		printf 'quoted text' printf then
+-eu printf readonly x=1 ${HOME} 2>/dev/null | readonly "$1" local readonly
+test --verbose readonly printf
+		test done | done echo sed /usr/bin -eu /usr/bin readonly done $(pwd) 2>/dev/null
+2>/dev/null awk echo test awk && $(pwd) sed echo done --verbose done -eu then
+		awk x=1 printf 2>/dev/null export 'quoted text'
+"$1" "$1" sed local --verbose
+		grep test 'quoted text'
+	awk ${HOME} export cd printf cd awk && 2>/dev/null
+2>/dev/null printf 'quoted text' /usr/bin done 2>/dev/null -eu --verbose
+cd sed /usr/bin -eu --verbose | -eu "$1" local 'quoted text' awk printf cd
+		done done 'quoted text' readonly printf sed cd "$1" test
+	printf printf local $(pwd) awk export awk
+		cd x=1 echo --verbose "$@" --verbose cd --verbose /usr/bin --verbose cd 'quoted text'
+| printf -eu 'quoted text' && grep ${HOME} sed done -eu awk --verbose grep 'quoted text'
+		export grep awk readonly
+		echo x=1 -eu x=1 x=1 "$1" echo $(pwd)
+		-eu ${HOME} sed echo test echo "$1" cd 2>/dev/null | 'quoted text' grep "$1"
+	readonly x=1 readonly local "$@" 'quoted text'
+		| 2>/dev/null awk grep printf export --verbose
+		2>/dev/null && sed 2>/dev/null && printf --verbose echo export 2>/dev/null x=1
+		printf cd done export 2>/dev/null done
+	awk ${HOME} ${HOME} --verbose "$1" /usr/bin export awk local test local
+x=1 /usr/bin 2>/dev/null /usr/bin ${HOME} "$@" | | grep test "$1" readonly
+	done /usr/bin grep readonly
+		-eu test "$@" sed grep 'quoted text'
+--verbose -eu x=1 readonly | local
+	awk cd grep $(pwd) grep /usr/bin export /usr/bin
+local export 'quoted text'
+		local | /usr/bin && grep "$1" | readonly 2>/dev/null echo ${HOME} $(pwd) grep
+		${HOME} grep "$1" echo done "$@" x=1 | 2>/dev/null sed | test local 'quoted text'
+then done sed readonly && printf ${HOME}
+| ${HOME} /usr/bin 2>/dev/null done 2>/dev/null cd $(pwd) | 'quoted text'
+		cd echo | | done sed echo 2>/dev/null -eu echo awk then -eu -eu test test ${HOME}
+		'quoted text' printf --verbose && --verbose x=1 done
+printf cd awk ${HOME} $(pwd) ${HOME} --verbose /usr/bin readonly
+		"$1" $(pwd) -eu sed local x=1 sed
+		&& sed readonly sed 2>/dev/null
+readonly grep $(pwd) printf && && "$1"
+	test x=1 && 'quoted text'
+	readonly $(pwd) $(pwd) x=1 x=1 $(pwd) --verbose
+test export && "$1" cd echo x=1 2>/dev/null
+"$@" ${HOME} x=1 then
+		local && sed $(pwd) 'quoted text' printf --verbose ${HOME}
+	export awk $(pwd) sed ${HOME}
+		export --verbose echo "$@" "$@" | "$@" "$@" grep test
+grep cd && ${HOME} | 'quoted text' done
+printf "$1" $(pwd) ${HOME} "$1"
+		/usr/bin /usr/bin ${HOME} 2>/dev/null
+		x=1 sed | -eu x=1 x=1 printf "$1" done ${HOME} export
+		${HOME} 2>/dev/null --verbose then 'quoted text' cd awk cd
+	test cd test x=1 sed test -eu sed grep
+		cd $(pwd) printf done | 2>/dev/null
+		readonly $(pwd) && 'quoted text' -eu | /usr/bin
+-eu 'quoted text' cd grep x=1 "$1"
+printf $(pwd) local -eu "$@" cd 2>/dev/null 'quoted text'
+		| x=1 && awk x=1 --verbose echo /usr/bin echo
+	sed x=1 --verbose -eu ${HOME} awk 'quoted text' 'quoted text' |
+	grep ${HOME} export printf printf sed "$@" printf && -eu "$1"
+		"$@" cd $(pwd) grep 2>/dev/null readonly
+	-eu ${HOME} && | x=1 export /usr/bin -eu 'quoted text'
+		&& test 2>/dev/null local
+		readonly cd awk 'quoted text' /usr/bin 'quoted text' /usr/bin --verbose export
+		x=1 -eu local ${HOME} && "$1" sed awk export readonly awk --verbose readonly
+	x=1 readonly cd printf 2>/dev/null
+	readonly "$@" sed x=1 && printf && /usr/bin
+	awk local cd -eu export done test grep "$1" export ${HOME} --verbose
+		&& local ${HOME} local awk "$@" -eu 'quoted text' cd -eu readonly
+	echo ${HOME} echo printf echo x=1 local --verbose "$1" "$1" | grep printf sed local
+		2>/dev/null export x=1 /usr/bin readonly readonly export
+	grep ${HOME} echo "$1" x=1 test ${HOME} "$@" cd test x=1 "$@" local
+${HOME} ${HOME} | local 2>/dev/null
+		| done local cd readonly && x=1 then
+2>/dev/null printf then | "$1" sed then "$@" done 2>/dev/null | ${HOME} -eu local
+		awk printf -eu --verbose test 'quoted text'
+--verbose 'quoted text' 2>/dev/null sed "$1"
+		echo awk $(pwd) ${HOME} "$1" && awk 'quoted text' | done && echo 2>/dev/null test
+	printf | ${HOME} cd ${HOME} --verbose
+		then test -eu local --verbose sed cd test export
+		/usr/bin $(pwd) local "$@"
+		export 2>/dev/null done /usr/bin x=1
+awk $(pwd) "$1" x=1 | &&
+test export cd 2>/dev/null done export readonly
+readonly cd then x=1 x=1 "$@"
+		then ${HOME} "$@" local readonly export sed readonly
+'quoted text' | -eu | --verbose | cd echo && done "$@" awk done
+	echo "$@" printf sed -eu echo
+local awk --verbose cd export test 'quoted text'
+test then "$1" -eu local ${HOME} $(pwd) "$@" done local 'quoted text'
+local ${HOME} printf cd --verbose 'quoted text' x=1 --verbose ${HOME} && sed awk
+	${HOME} --verbose x=1 $(pwd) readonly test -eu 'quoted text'
+		local /usr/bin sed then readonly readonly local && done ${HOME}
+'quoted text' && x=1 printf local echo 2>/dev/null && export $(pwd) | printf
+	readonly && 2>/dev/null
+	cd cd "$1" awk | 'quoted text' ${HOME} 2>/dev/null
+| local cd awk readonly grep 'quoted text' --verbose
+	"$@" | printf 'quoted text'
+then x=1 printf grep 'quoted text' done && sed test 2>/dev/null
+		"$1" export $(pwd) done echo grep | then echo done cd --verbose
+	&& then done && awk grep awk sed sed test test printf 2>/dev/null "$@" "$@"
+	test sed "$1" cd && readonly
+	readonly then local ${HOME} grep | "$@" local then echo 'quoted text'
+printf done "$1" done -eu | /usr/bin export 2>/dev/null x=1 $(pwd) x=1
+${HOME} 'quoted text' /usr/bin awk x=1 && 'quoted text'
+	printf echo "$@" /usr/bin && 2>/dev/null cd echo -eu cd cd --verbose /usr/bin
+echo local -eu test -eu --verbose done export x=1 "$@" awk export sed grep then
+	'quoted text' grep sed
+	sed /usr/bin ${HOME} $(pwd) then 'quoted text' $(pwd) 'quoted text' sed
+'quoted text' ${HOME} readonly
+		'quoted text' | x=1 local && test -eu sed && 2>/dev/null local --verbose
+readonly cd && 'quoted text' | local cd --verbose readonly readonly "$1" test
+then | 2>/dev/null local | 'quoted text' awk printf --verbose done cd
+		2>/dev/null "$@" | 'quoted text' --verbose
+		&& 'quoted text' echo test $(pwd)
+awk then /usr/bin --verbose
+sed | local x=1 -eu $(pwd)
+&& $(pwd) test then echo | $(pwd) grep ${HOME}
+export then "$1" -eu done local /usr/bin cd 'quoted text' | printf
+		2>/dev/null 'quoted text' sed 2>/dev/null
+local $(pwd) sed 'quoted text' readonly
+then printf | 'quoted text'
+		"$1" local awk printf awk x=1 cd export awk done --verbose | x=1 /usr/bin grep
+	echo local /usr/bin | $(pwd) -eu
+	'quoted text' -eu | -eu $(pwd) readonly done &&
+		x=1 cd cd ${HOME} sed cd "$@" readonly readonly grep $(pwd) "$1" &&
+		cd && 'quoted text' then 2>/dev/null
+	/usr/bin cd grep x=1 && 2>/dev/null /usr/bin then -eu grep
+	readonly --verbose ${HOME}
+--verbose printf --verbose sed ${HOME} "$1" $(pwd) export ${HOME}
+	test 'quoted text' "$1" readonly export then
+	'quoted text' | test sed x=1 printf $(pwd) awk --verbose -eu
+awk local printf sed -eu $(pwd) printf then cd printf local test &&
+test "$1" export /usr/bin then test
+		| sed readonly $(pwd) grep
+done printf local "$1" grep x=1 | readonly --verbose "$1" "$@" -eu then test
+		printf 2>/dev/null echo readonly done /usr/bin
+/usr/bin readonly x=1 "$1" -eu test
+		export x=1 export export "$@" x=1 echo 'quoted text'
+		cd -eu "$1" && /usr/bin && test cd sed | cd local cd 'quoted text'
+	sed "$1" sed sed | printf sed grep awk
+/usr/bin x=1 export x=1 2>/dev/null && -eu | "$1"
+		"$1" local 'quoted text' ${HOME} "$@" | then awk | ${HOME} | awk --verbose
+	"$@" awk test local "$@" cd --verbose
+		test "$@" grep local
+	2>/dev/null done cd "$1" -eu 'quoted text' x=1 awk readonly
+	grep grep sed echo $(pwd) |
+		grep then | "$@" export export "$@" 'quoted text' 'quoted text' x=1
+	export $(pwd) then test
+	/usr/bin export $(pwd) local | awk
+	printf "$@" readonly 'quoted text' printf printf grep grep ${HOME} "$@" | local
+		$(pwd) grep 2>/dev/null printf
+/usr/bin $(pwd) then printf 2>/dev/null test --verbose && "$@" printf
+/usr/bin printf readonly grep 2>/dev/null readonly --verbose
+	/usr/bin && awk -eu export readonly grep sed then export
+awk -eu x=1 readonly export x=1 test --verbose test $(pwd) x=1 echo sed
+${HOME} export echo readonly
+	printf $(pwd) local "$@" "$1" | export export done
+	printf ${HOME} | --verbose
+		/usr/bin grep cd "$@" "$1" printf test printf local
+	| $(pwd) done 'quoted text' x=1
+'quoted text' export readonly && export done | "$@" echo export cd awk cd grep
+echo readonly ${HOME} readonly done test "$1" &&
+done x=1 sed ${HOME} done /usr/bin done "$1"
+	local 2>/dev/null local sed readonly printf export /usr/bin "$1" done
+		"$@" readonly cd 2>/dev/null readonly | readonly --verbose $(pwd) done | grep
+		grep "$@" 'quoted text'
+	done ${HOME} 'quoted text' 2>/dev/null
+	"$@" --verbose 2>/dev/null 2>/dev/null printf ${HOME} test | /usr/bin
+	x=1 echo | --verbose "$@" 2>/dev/null readonly "$@" -eu readonly cd local x=1 2>/dev/null
+| grep "$1" test "$@" /usr/bin awk "$@" && sed grep && then sed | test ${HOME}
+		grep ${HOME} 2>/dev/null sed 2>/dev/null 'quoted text' 2>/dev/null cd 2>/dev/null
+		${HOME} then sed ${HOME} then export 2>/dev/null local "$1" awk
+	local /usr/bin printf "$@" done 2>/dev/null
+		${HOME} echo -eu x=1 -eu $(pwd) "$1" printf "$@"
+	${HOME} && echo /usr/bin &&
+	/usr/bin export test test printf $(pwd) readonly readonly sed /usr/bin "$1" && readonly
+sed "$1" echo 2>/dev/null cd printf 'quoted text'
+2>/dev/null 2>/dev/null x=1 2>/dev/null ${HOME} && $(pwd)
+	readonly $(pwd) done --verbose then done 2>/dev/null
+		&& local "$@" $(pwd) --verbose "$@" then printf then -eu export
+	test printf readonly awk "$@" | "$@"
+		x=1 then "$1" export grep local local
+then readonly 'quoted text' sed --verbose 'quoted text'
+		test -eu -eu local /usr/bin | | -eu && awk
+		awk export export "$1"
+	awk sed awk /usr/bin echo export awk && done test $(pwd) echo
+2>/dev/null awk sed readonly ${HOME} 'quoted text'
+x=1 ${HOME} readonly /usr/bin
+		2>/dev/null && 2>/dev/null grep cd local
+&& test -eu awk x=1 local printf $(pwd) "$1" /usr/bin export then
+--verbose --verbose test awk 'quoted text'
+		printf sed local grep export cd local
+&& grep echo | test "$@" sed 2>/dev/null done 'quoted text'
+	-eu grep 2>/dev/null x=1 -eu | echo
+	$(pwd) 'quoted text' printf -eu awk 'quoted text' x=1 ${HOME} awk sed "$1" 2>/dev/null
+/usr/bin "$@" | grep ${HOME} "$@" grep
+	grep awk printf $(pwd) done local | | $(pwd) then sed /usr/bin
+${HOME} "$@" "$1" export done x=1 ${HOME} 2>/dev/null done done
+		cd sed --verbose x=1 $(pwd) test sed && grep printf 'quoted text'
+	grep awk done -eu sed awk printf then
+	awk export sed awk -eu 2>/dev/null printf 2>/dev/null readonly $(pwd) local grep
+		--verbose $(pwd) "$1"
+	awk test "$@" ${HOME} && awk local --verbose
+awk awk test printf | "$1" | "$@" done then
+		x=1 && readonly done readonly readonly then | done test 'quoted text'
+	| 'quoted text' echo --verbose then then readonly "$1" then x=1 x=1 grep
+| printf done 'quoted text' "$1" 2>/dev/null
+	--verbose test awk grep "$@" grep grep 'quoted text'
+	x=1 cd ${HOME} local printf --verbose awk export $(pwd)
+		done "$1" --verbose -eu done done printf x=1 'quoted text' done export local
+local | then sed sed local 'quoted text' x=1 "$@" awk then export grep readonly
+		test | printf grep readonly readonly
+		--verbose done sed printf cd
+${HOME} then then done done | done sed x=1 local printf
+sed sed then $(pwd) --verbose "$1" done ${HOME} ${HOME} --verbose
+		| export cd && /usr/bin test printf echo grep awk /usr/bin 'quoted text'
+		-eu grep cd | cd cd cd sed -eu && awk export "$@"
+	readonly grep readonly then cd grep printf "$1" then --verbose "$1"
+x=1 --verbose 'quoted text' "$@" --verbose done
+sed 2>/dev/null | && local sed done 'quoted text' 'quoted text' /usr/bin 'quoted text'
+then $(pwd) local readonly echo cd 2>/dev/null ${HOME} export $(pwd) local
+-eu /usr/bin 'quoted text' /usr/bin | "$@" | then -eu
+		awk "$1" grep -eu -eu readonly "$1" then cd /usr/bin
+done "$@" 'quoted text' test grep 2>/dev/null grep test ${HOME} x=1 x=1 ${HOME}
+	then done echo 2>/dev/null | readonly export echo "$@" ${HOME} readonly
+x=1 -eu "$1" -eu | "$@" grep awk done --verbose $(pwd) "$1"
+	printf export printf then "$1" $(pwd) then test then test export echo
+'quoted text' done test $(pwd) printf echo done
+echo readonly 2>/dev/null local --verbose && | /usr/bin --verbose
+-eu "$@" "$@" --verbose cd test ${HOME} -eu --verbose echo grep /usr/bin
+		done | 'quoted text' | --verbose echo &&
+"$1" -eu export test then export then printf $(pwd) "$1" sed printf echo
+printf "$@" awk $(pwd) x=1 printf echo awk
+	x=1 x=1 ${HOME} | x=1 --verbose cd 2>/dev/null 'quoted text' then 'quoted text'
+x=1 "$@" x=1 echo test "$1" && 2>/dev/null readonly $(pwd)
+	test grep | -eu sed export echo $(pwd)
+		test then done done 'quoted text' x=1
+	test done grep sed "$@" then $(pwd) 2>/dev/null
+		| test ${HOME} -eu ${HOME} x=1 printf
+export sed grep "$@" readonly echo test && readonly ${HOME} cd
+${HOME} awk "$1" $(pwd) 2>/dev/null /usr/bin
+		cd $(pwd) echo cd -eu then grep 'quoted text' cd
+	then | "$@" test printf test cd && readonly sed cd | then export cd done
+	readonly $(pwd) x=1 --verbose
+$(pwd) grep /usr/bin -eu test
+		&& awk $(pwd) test readonly && ${HOME} grep
+		"$@" printf 'quoted text' local grep printf
+		--verbose awk awk echo echo
+		printf sed /usr/bin test local /usr/bin "$@" grep 'quoted text' | echo $(pwd)
+"$@" "$@" 2>/dev/null -eu
+	"$@" export $(pwd) "$1" sed readonly --verbose --verbose
+grep $(pwd) sed 'quoted text' "$@" 2>/dev/null
+	-eu test awk test cd "$@" echo export printf then -eu | then 'quoted text'
+test local 2>/dev/null export 'quoted text' ${HOME} cd -eu test
+		readonly -eu "$@" /usr/bin sed | -eu readonly awk
+		then done readonly cd printf 'quoted text' then test ${HOME} x=1 /usr/bin
+		awk | --verbose echo --verbose 2>/dev/null ${HOME} printf done then
+then --verbose /usr/bin
+	--verbose $(pwd) local local cd readonly
+		cd cd local --verbose /usr/bin sed export sed echo 'quoted text' export 2>/dev/null
+test test done $(pwd) | readonly local /usr/bin printf done awk
+		local | export printf export awk test local "$1" printf -eu then
+	done sed $(pwd) ${HOME} && export export done printf echo --verbose 2>/dev/null
+		local ${HOME} && $(pwd) | test echo test && grep "$1"
+		grep "$@" -eu sed --verbose
+	local printf && test && printf --verbose then && "$1" "$@" cd export
+	awk ${HOME} echo test local test sed && sed local 2>/dev/null local local echo
+	| "$@" ${HOME} export && "$@" 'quoted text'
+		local cd done test && grep 2>/dev/null -eu
+	printf export readonly printf
+		'quoted text' && echo echo test readonly $(pwd) grep awk "$@" printf printf
+sed 2>/dev/null --verbose "$@" ${HOME} x=1 "$@" $(pwd) $(pwd)
+	grep grep $(pwd) done $(pwd)
+		done 'quoted text' "$1" "$1" && 2>/dev/null cd done 'quoted text'
+		$(pwd) test printf /usr/bin
+		grep | ${HOME} | local x=1 "$1" x=1 grep done readonly sed 2>/dev/null 2>/dev/null
+local sed 2>/dev/null cd local sed 'quoted text' ${HOME} export
+$(pwd) readonly x=1 readonly sed 'quoted text' awk local 'quoted text'
+		-eu "$1" ${HOME} "$@" cd
+		export $(pwd) readonly "$1" --verbose local /usr/bin awk
+		export grep awk 'quoted text' then test local && --verbose
+		done "$1" local test awk "$@" "$@" done "$1" 'quoted text'
+	/usr/bin | readonly export printf 2>/dev/null
+		"$1" /usr/bin && "$@" 2>/dev/null test grep "$@" "$@" -eu 2>/dev/null
+		cd sed cd sed then local export printf 2>/dev/null awk grep
+awk cd printf $(pwd) /usr/bin "$@" cd | grep 2>/dev/null grep "$1" x=1 local
+		local done then -eu grep "$1" --verbose
+x=1 done | --verbose awk local ${HOME} awk | sed readonly 'quoted text'
+	awk echo "$@" 'quoted text' then awk "$1" local awk grep
+		'quoted text' /usr/bin local "$1" x=1
+		printf sed 2>/dev/null grep -eu x=1 'quoted text' -eu sed then 'quoted text'
+		sed local "$@" test readonly && "$@" cd "$1" awk "$@" -eu
+		echo printf grep --verbose echo ${HOME} ${HOME} -eu --verbose done "$1" echo local
+		grep | --verbose grep "$1" test ${HOME}
+		grep 2>/dev/null 2>/dev/null echo cd 'quoted text'
+		--verbose /usr/bin export echo 'quoted text' --verbose
+		printf readonly "$@" export grep local x=1 printf
+		"$@" readonly echo && | cd echo cd then
+then test 'quoted text' --verbose ${HOME}
+x=1 readonly export local test | && /usr/bin local
+cd awk export test done -eu
+		&& --verbose printf awk ${HOME}
+	printf ${HOME} printf "$1" && cd printf
+	'quoted text' grep "$@" awk
+	echo $(pwd) && local echo x=1 --verbose cd local ${HOME} "$1" | $(pwd) sed
+sed local x=1 ${HOME} printf grep cd ${HOME} 'quoted text'
+echo 2>/dev/null printf ${HOME} then 2>/dev/null
+	cd x=1 && x=1 echo --verbose -eu "$@" --verbose awk $(pwd) 'quoted text' sed
+'quoted text' then printf $(pwd)
+	--verbose "$@" "$@" awk ${HOME}
+		test /usr/bin ${HOME} ${HOME} grep done test $(pwd) ${HOME} cd sed cd x=1
+	&& 'quoted text' then cd grep 'quoted text' -eu x=1 "$@"
+	sed echo echo cd "$1" -eu local
+		-eu cd --verbose ${HOME} echo then
+	| --verbose --verbose 2>/dev/null sed x=1 'quoted text'
+-eu && "$1" 2>/dev/null done x=1 2>/dev/null
+then export x=1 'quoted text'
+		--verbose sed awk done --verbose
+'quoted text' 2>/dev/null 2>/dev/null local done x=1 done cd "$1" ${HOME}
+		"$@" $(pwd) export cd export then 2>/dev/null
+	awk | sed && ${HOME} ${HOME} test export grep
+		awk && sed $(pwd) export
+		"$@" done printf printf export cd -eu && local sed cd && && x=1 -eu local --verbose
+	--verbose readonly printf printf printf grep local "$1"
+local grep --verbose "$1"
+--verbose "$1" $(pwd) && grep | -eu export
+	${HOME} ${HOME} echo local readonly /usr/bin 'quoted text'
+echo printf ${HOME} then test grep --verbose test ${HOME} echo cd /usr/bin
+		done readonly echo "$@" && test sed "$@" "$1" 2>/dev/null
+	&& cd test local 'quoted text'
+		sed test local 'quoted text'
+	"$@" x=1 'quoted text' /usr/bin grep done x=1 | --verbose
+		'quoted text' local "$@" cd -eu "$@" local ${HOME} "$1" | &&
+--verbose readonly 'quoted text' /usr/bin then echo then "$@"
+		readonly "$1" done printf done && sed printf readonly awk
+		echo "$1" 'quoted text' sed done "$@"
+sed then done cd /usr/bin sed "$@" ${HOME} 'quoted text'
+	awk | $(pwd) -eu cd export printf -eu local 2>/dev/null
+cd test --verbose echo 'quoted text' "$1" export
+		cd $(pwd) test readonly test echo readonly
+${HOME} local done printf "$1" $(pwd) test grep echo grep cd
+printf "$@" done "$@" test cd test echo export
+awk 'quoted text' printf then grep --verbose sed test --verbose
+		$(pwd) cd x=1 "$@" awk done x=1
+	x=1 "$1" --verbose "$1" grep local "$@"
+		${HOME} awk $(pwd) x=1 readonly /usr/bin && ${HOME} /usr/bin
+		done grep cd cd 2>/dev/null echo awk echo local "$@"
+printf echo printf awk cd $(pwd) 'quoted text' 2>/dev/null grep ${HOME} --verbose
+		printf readonly test sed | grep grep | then
+		local readonly then && awk 2>/dev/null cd grep 'quoted text' -eu sed echo test
+		test sed test | done readonly 'quoted text' local readonly
+awk sed $(pwd) then --verbose "$1" readonly -eu awk readonly echo -eu then local
+		sed then local $(pwd) then export --verbose
+--verbose -eu -eu 'quoted text'
+		x=1 -eu cd sed | test echo done 'quoted text' awk 'quoted text' "$1" --verbose
+	2>/dev/null "$1" && grep | awk
+test local readonly $(pwd) awk 2>/dev/null
+		-eu "$1" sed "$1" readonly sed
+export x=1 -eu 2>/dev/null awk x=1 /usr/bin -eu "$1" done /usr/bin
+	x=1 printf local -eu "$1" /usr/bin ${HOME} grep 'quoted text'
+		"$1" test 'quoted text' then --verbose local | then x=1 2>/dev/null awk
+"$@" sed export then grep /usr/bin
+		echo awk grep export ${HOME} x=1
+		awk readonly && 'quoted text' grep | export
+		grep "$@" awk && cd then $(pwd) awk ${HOME} $(pwd) readonly export
+	/usr/bin export /usr/bin 2>/dev/null local then awk readonly
+		test then "$@" sed export --verbose $(pwd) | ${HOME}
+		| --verbose 'quoted text' awk "$@"
+		test ${HOME} done cd then printf
+		${HOME} done readonly 'quoted text' 'quoted text' local $(pwd)
+	grep echo readonly "$1" readonly test x=1 --verbose
+	then test done printf
+		sed "$@" /usr/bin 'quoted text' awk | then awk awk "$1" readonly export
+export echo "$@" 2>/dev/null done sed "$1" $(pwd) then awk awk 'quoted text' $(pwd)
+export grep | then echo test printf "$@" grep 2>/dev/null local then readonly
+	grep -eu && --verbose
+2>/dev/null && --verbose export /usr/bin x=1 done
+		echo then "$@" export
+		cd "$1" grep | printf awk readonly "$@" "$@" 2>/dev/null
+		grep export /usr/bin 'quoted text' echo printf local awk awk
+		| 2>/dev/null readonly x=1 local export export readonly && sed
+export && cd /usr/bin /usr/bin grep sed 2>/dev/null
+		test sed ${HOME} x=1 | grep | done ${HOME} grep export $(pwd)
+		x=1 ${HOME} cd echo test -eu done echo 2>/dev/null export cd done
+	then local done cd $(pwd) local export test
+		local sed "$@" -eu readonly echo ${HOME} echo $(pwd) "$@" "$1"
+export readonly then sed "$1" cd 'quoted text' && 2>/dev/null cd
+		local local "$1" local 'quoted text'
+sed printf 2>/dev/null test "$@" readonly 'quoted text'
+	cd printf echo then export test | test export sed readonly ${HOME}
+2>/dev/null grep awk 'quoted text'
+		${HOME} grep 'quoted text' echo 'quoted text'
+export cd sed | cd && local export test $(pwd)
+		printf "$@" echo sed x=1 "$1" "$@" printf done echo
+local "$1" export sed awk -eu awk && done
+		local test done then /usr/bin "$@" echo "$@"
+	$(pwd) $(pwd) test export ${HOME} 'quoted text'
+	/usr/bin then local && 'quoted text' --verbose grep
+		echo grep grep $(pwd) /usr/bin $(pwd)
+	test /usr/bin sed --verbose "$1"
+printf done 2>/dev/null "$1" x=1
+		"$@" -eu "$@" test x=1 && $(pwd) local export sed && "$1" then
+	$(pwd) 2>/dev/null printf readonly
+	test grep awk awk export | "$@" export $(pwd) printf && readonly /usr/bin
+| --verbose awk -eu printf -eu export local grep
+done grep "$1" 'quoted text' readonly readonly "$1" ${HOME} export grep done | grep
+	"$@" local x=1 grep test local
+"$@" printf 2>/dev/null echo grep
+	$(pwd) && done 2>/dev/null
+	done then readonly -eu then
+		printf echo | ${HOME} echo "$1" /usr/bin
+		test "$1" ${HOME} echo local $(pwd) --verbose
+		$(pwd) test ${HOME} ${HOME} then --verbose echo
+	x=1 readonly local done | "$1" sed | "$1" "$1" ${HOME}
+cd sed export test export "$@"
+	${HOME} awk local -eu && /usr/bin -eu "$@" 2>/dev/null
+test --verbose $(pwd) 2>/dev/null echo awk printf
+	awk grep readonly x=1 $(pwd) grep | "$@" ${HOME}
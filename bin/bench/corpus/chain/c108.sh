@@ -0,0 +1,2001 @@
+export readonly && printf cd ${HOME} "$1" /usr/bin 'quoted text'
+		'quoted text' local "$@" local --verbose
+		x=1 'quoted text' local 2>/dev/null readonly "$1" "$1" readonly
+	| cd "$@" printf export x=1 local ${HOME} local test "$@" export echo
+		test done $(pwd) /usr/bin "$@" then printf && test export grep
+	-eu echo $(pwd) then local cd grep awk grep then readonly sed 'quoted text'
+		x=1 export "$@" then export $(pwd) sed awk $(pwd) && $(pwd) $(pwd) export
+	export /usr/bin x=1 'quoted text'
+	grep "$@" "$1" 'quoted text' $(pwd) grep awk x=1 /usr/bin 2>/dev/null
+	export then readonly echo && --verbose
+/usr/bin echo && grep awk then cd && grep cd | /usr/bin -eu sed awk awk
+| test echo then "$1" then grep -eu && test grep --verbose 2>/dev/null
+"$@" "$1" sed /usr/bin "$1" readonly printf awk --verbose && && cd echo
+-eu /usr/bin sed grep $(pwd) readonly echo ${HOME}
+printf awk $(pwd) $(pwd) x=1
+	local awk "$1" /usr/bin ${HOME} x=1 done x=1 sed awk x=1 2>/dev/null local test
+$(pwd) sed grep grep 2>/dev/null echo /usr/bin "$@" x=1 readonly && "$@" then
+	test 'quoted text' && local "$@" 2>/dev/null /usr/bin done awk 'quoted text'
+		2>/dev/null local sed printf export -eu test export printf grep $(pwd) export
+grep printf cd awk export x=1 /usr/bin -eu
+	/usr/bin 'quoted text' readonly | 'quoted text' printf
+/usr/bin -eu cd && then
+	2>/dev/null grep -eu /usr/bin ${HOME} ${HOME} awk sed
+	x=1 export awk local | --verbose 'quoted text' "$@" "$@" sed cd cd -eu &&
+--verbose cd printf x=1 "$@" 2>/dev/null sed && export awk -eu 2>/dev/null
+	then 2>/dev/null --verbose cd 'quoted text'
+	"$@" "$@" test 'quoted text' $(pwd) local export readonly printf
+	done && printf | -eu echo test test test /usr/bin echo awk 2>/dev/null "$@" ${HOME}
+		then "$1" 2>/dev/null /usr/bin grep /usr/bin readonly readonly ${HOME}
+		echo 2>/dev/null cd | 2>/dev/null printf ${HOME}
+	&& x=1 x=1 grep local /usr/bin
+${HOME} x=1 awk export x=1 test test awk -eu && grep 2>/dev/null
+		| readonly $(pwd) 2>/dev/null
+echo && "$1" 2>/dev/null
+sed | 'quoted text' -eu grep
+		sed awk local done test then readonly
+export --verbose awk ${HOME} then --verbose test awk export echo "$@" export echo
+		2>/dev/null grep readonly grep
+"$@" ${HOME} 'quoted text' grep 2>/dev/null cd
+		test -eu export local test then 2>/dev/null printf /usr/bin grep then then
+	2>/dev/null local printf $(pwd) echo sed then then | test local 'quoted text'
+		sed /usr/bin cd awk awk cd printf test $(pwd) done $(pwd) && cd export printf then
+	done "$@" /usr/bin x=1 test $(pwd) echo /usr/bin | ${HOME} awk ${HOME} local then
+grep 'quoted text' done ${HOME} 'quoted text' readonly -eu awk $(pwd) printf readonly
+		$(pwd) "$1" awk -eu echo sed 'quoted text'
+	&& cd $(pwd) 2>/dev/null -eu cd 'quoted text'
+		/usr/bin && sed | "$1" | -eu
+		printf x=1 readonly cd then
+		local printf awk 2>/dev/null grep
+	| grep echo readonly "$1" "$@" "$@" 2>/dev/null
+--verbose --verbose test export
+| 'quoted text' cd --verbose done done "$1" export "$1" | x=1 sed 2>/dev/null
+'quoted text' readonly -eu ${HOME} awk -eu "$@" cd -eu
+echo -eu sed 'quoted text' readonly
+$(pwd) awk "$1" -eu x=1 then $(pwd) /usr/bin "$1" "$1"
+		grep export readonly readonly "$1" && x=1 /usr/bin
+local printf test $(pwd) then /usr/bin
+local "$1" x=1 local then echo 2>/dev/null
+		test readonly ${HOME} test $(pwd) 2>/dev/null sed
+		&& && $(pwd) grep "$@" local "$1" export test
+	done -eu "$@" 2>/dev/null sed printf && then 'quoted text'
+x=1 "$1" sed awk --verbose $(pwd) && export sed test readonly
+		--verbose sed export 2>/dev/null then 'quoted text' printf
+"$1" cd test local sed 2>/dev/null export
+local "$1" 2>/dev/null export
+		test grep | echo && awk grep readonly done 'quoted text'
+	cd "$1" echo grep | done done 'quoted text'
+sed && 'quoted text' "$@" && /usr/bin then then -eu echo --verbose grep
+printf "$@" sed ${HOME} cd "$1" done | "$1"
+/usr/bin x=1 | cd sed | test cd -eu -eu -eu awk ${HOME} sed printf ${HOME}
+		&& local grep x=1 cd test --verbose
+--verbose printf sed /usr/bin ${HOME} --verbose awk ${HOME}
+	'quoted text' then && printf "$@" "$1" ${HOME} then "$@" test test
+	cd 'quoted text' cd readonly done "$@" test &&
+		--verbose $(pwd) echo test cd | cd 'quoted text' grep
+test test 'quoted text' ${HOME} done export grep grep awk &&
+	--verbose done | echo test "$1" "$1" -eu "$1" x=1 /usr/bin
+| sed readonly echo 2>/dev/null
+		test test test sed readonly && local test
+/usr/bin "$@" cd export 'quoted text' local "$@" cd cd
+		export cd awk "$1" ${HOME}
+	then --verbose printf echo "$@" export awk
+	then local readonly $(pwd) /usr/bin 2>/dev/null export 'quoted text'
+		"$@" "$1" test 'quoted text' grep -eu export x=1 test
+	echo -eu test printf 'quoted text' 2>/dev/null then 2>/dev/null
+		"$1" then && then ${HOME} test
+--verbose $(pwd) local ${HOME} ${HOME} --verbose
+echo x=1 awk readonly "$1"
+		awk x=1 2>/dev/null $(pwd) "$@"
+		"$1" printf local "$@" 2>/dev/null export "$@" "$@"
+'quoted text' readonly awk grep
+sed x=1 awk printf readonly
+	cd | -eu ${HOME} local
+		'quoted text' echo --verbose "$@" "$1" cd done test
+		"$@" "$@" then cd cd 2>/dev/null local cd cd | sed sed 'quoted text'
+/usr/bin awk 2>/dev/null
+	cd $(pwd) export -eu "$@" sed sed grep cd "$@" && 2>/dev/null readonly
+	awk then then export test -eu "$@" cd ${HOME} -eu done ${HOME}
+		done && then test then then printf cd "$@" grep --verbose /usr/bin awk 'quoted text'
+		export echo "$1" printf done test $(pwd) 2>/dev/null
+		2>/dev/null test -eu ${HOME} printf | then 'quoted text' grep "$@" -eu
+		--verbose cd sed local test /usr/bin local --verbose && export echo
+| cd 'quoted text' awk | "$1" awk --verbose grep sed sed printf done
+	local | $(pwd) "$@" grep | 'quoted text' readonly && test local ${HOME} grep
+	export local -eu cd then sed printf x=1 export
+$(pwd) "$@" "$1" readonly 'quoted text' done ${HOME} 'quoted text'
+		export test sed "$1" $(pwd)
+	'quoted text' export $(pwd) -eu done "$1"
+	| grep "$@" grep printf sed export "$@" printf
+	x=1 && done echo && test export 2>/dev/null "$@" $(pwd) x=1 cd export
+		/usr/bin $(pwd) 'quoted text' done ${HOME} --verbose
+		grep ${HOME} && export 'quoted text' done sed done "$1" && ${HOME} x=1 printf
+$(pwd) x=1 then ${HOME} --verbose $(pwd)
+	awk --verbose sed cd then
+"$@" x=1 export x=1 readonly /usr/bin cd 'quoted text' echo -eu x=1 export
+	x=1 "$@" test /usr/bin x=1 $(pwd) done && then grep --verbose cd --verbose
+"$@" done then test printf ${HOME} | awk test export done then
+		printf export $(pwd) grep local && x=1 "$1" x=1 -eu test then x=1
+cd 2>/dev/null /usr/bin 2>/dev/null
+export printf | 'quoted text' grep 2>/dev/null
+		echo -eu 2>/dev/null sed then export ${HOME} awk then grep export test
+	export readonly test local test
+		done 'quoted text' $(pwd)
+grep 2>/dev/null "$@" $(pwd) x=1 'quoted text' then "$1" --verbose && $(pwd)
+2>/dev/null echo -eu 'quoted text'
+	'quoted text' /usr/bin awk 'quoted text'
+	awk sed --verbose echo -eu echo
+	done sed x=1 done cd local echo && done echo && awk echo
+2>/dev/null x=1 cd grep sed sed -eu $(pwd) cd "$@" --verbose echo cd | --verbose
+awk grep local awk "$1" readonly && done test readonly x=1 readonly "$1"
+		test "$1" local then then ${HOME} local done cd printf --verbose
+		printf -eu x=1 then cd done readonly | test test
+test sed 'quoted text' cd "$@" 2>/dev/null | then then sed then "$@" local echo
+		echo test grep 2>/dev/null $(pwd) | printf && -eu
+	cd --verbose | echo | then "$@" 'quoted text'
+	2>/dev/null local done 'quoted text' sed grep -eu local cd grep -eu --verbose 'quoted text'
+	x=1 "$@" /usr/bin sed done cd then done awk "$@" 'quoted text'
+		-eu -eu readonly test cd printf grep 2>/dev/null
+		&& sed && /usr/bin "$@" "$1" grep --verbose | ${HOME} echo sed ${HOME} && then |
+	printf && test "$@" sed -eu then sed 2>/dev/null
+		then grep -eu -eu cd grep "$1" echo export /usr/bin done /usr/bin sed printf
+test 2>/dev/null cd export then && "$1"
+'quoted text' /usr/bin then then ${HOME} ${HOME} | done readonly
+	awk done /usr/bin --verbose --verbose export export done grep grep then --verbose
+	"$@" x=1 /usr/bin -eu done awk x=1 $(pwd) x=1 export --verbose awk export $(pwd)
+		$(pwd) "$@" 'quoted text' local
+"$@" x=1 | readonly grep ${HOME} -eu
+		"$1" printf 'quoted text' "$1" && echo x=1 "$1" "$@" "$1" 'quoted text' local echo
+	"$1" test grep x=1 done done "$1" awk -eu ${HOME} test echo then sed done
+$(pwd) 2>/dev/null --verbose awk ${HOME} then && done export && --verbose /usr/bin
+-eu $(pwd) "$1" "$@" --verbose grep "$1" cd
+done then /usr/bin printf $(pwd)
+	&& && awk test x=1 --verbose grep echo $(pwd) grep "$@" cd local x=1 /usr/bin
+then readonly then done 2>/dev/null
+printf --verbose && --verbose local -eu /usr/bin
+		${HOME} local ${HOME} | done
+cd done cd readonly printf sed | $(pwd) --verbose $(pwd)
+grep /usr/bin "$@" done cd -eu
+		"$@" printf echo readonly && --verbose export test done 2>/dev/null grep
+	x=1 'quoted text' test 2>/dev/null echo
+	2>/dev/null echo -eu export && local 'quoted text'
+		'quoted text' "$@" x=1 echo --verbose cd 2>/dev/null readonly local ${HOME}
+local local $(pwd) cd -eu x=1 && echo "$@" export x=1 grep "$@" export sed
+		"$@" test "$@" test export cd local /usr/bin
+"$1" awk local sed done
+		'quoted text' export --verbose awk then | then
+export 'quoted text' /usr/bin
+	/usr/bin cd --verbose "$@" x=1 done sed echo "$1" | --verbose
+echo --verbose --verbose $(pwd) sed "$1" -eu printf then grep sed grep
+		"$1" then printf 'quoted text'
+${HOME} awk "$1" "$@" && $(pwd) $(pwd) $(pwd)
+	"$1" readonly then 2>/dev/null
+		&& ${HOME} grep && x=1 && cd local then /usr/bin grep "$1" "$@" then --verbose
+then grep "$@" awk && "$@" sed done -eu -eu "$@" awk "$1" "$@" 2>/dev/null
+printf && -eu grep /usr/bin $(pwd) awk x=1 ${HOME} --verbose --verbose
+	done "$@" grep && 2>/dev/null "$1" cd -eu --verbose test | local local
+	sed awk && readonly grep
+	done ${HOME} echo | printf ${HOME} awk grep | done "$1"
+		printf grep "$@" --verbose printf export | awk 2>/dev/null
+	x=1 "$1" export | then /usr/bin then "$1" | test --verbose
+		'quoted text' local --verbose
+&& export 2>/dev/null readonly cd done && 'quoted text' local $(pwd) 2>/dev/null
+	--verbose test done "$1" "$@" sed | $(pwd) cd awk local ${HOME} $(pwd) 'quoted text'
+then sed then then && x=1 --verbose x=1
+		"$@" test export "$1" | awk readonly 2>/dev/null -eu -eu sed
+readonly grep $(pwd) | readonly printf x=1 'quoted text' cd "$1" 'quoted text'
+		'quoted text' done "$1" printf ${HOME} sed test --verbose | awk
+$(pwd) $(pwd) test export $(pwd) x=1 done awk x=1 $(pwd) test awk done
+	printf --verbose cd done sed "$@" && readonly "$@" cd x=1 -eu
+	done local grep grep && ${HOME} echo grep "$1" done done grep "$@" "$@"
+"$@" $(pwd) grep done x=1 && awk && 2>/dev/null ${HOME} test grep
+		test && cd test x=1 ${HOME} && cd grep /usr/bin && readonly && grep local sed
+		then echo export printf 'quoted text' "$@" done printf 2>/dev/null | local 'quoted text'
+printf -eu grep "$@" | echo export /usr/bin grep
+	grep x=1 echo -eu readonly "$1"
+		'quoted text' 2>/dev/null printf export grep 'quoted text' awk 2>/dev/null
+/usr/bin then x=1 grep --verbose $(pwd) 2>/dev/null 2>/dev/null test
+| "$1" grep $(pwd) grep then grep printf "$1" x=1 "$@"
+	local | then test x=1 -eu $(pwd) 2>/dev/null sed && | $(pwd) $(pwd) echo | test
+	test ${HOME} echo /usr/bin /usr/bin
+${HOME} --verbose test awk then 'quoted text'
+	then grep 2>/dev/null then cd 'quoted text' && && printf awk
+local grep export && readonly $(pwd) -eu -eu readonly local $(pwd) $(pwd)
+	printf printf 'quoted text' --verbose readonly awk awk && "$1"
+		awk $(pwd) printf grep grep done readonly | readonly
+		readonly --verbose "$1" 'quoted text' 2>/dev/null done --verbose ${HOME}
+	printf export | | && "$1" sed readonly
+		readonly cd && grep printf test local printf echo test test
+		${HOME} grep ${HOME} $(pwd) done "$@" && 'quoted text' $(pwd)
+	"$1" grep readonly && cd then
+done --verbose && readonly done then local grep 'quoted text' 2>/dev/null
+	--verbose x=1 done cd $(pwd)
+		test done awk ${HOME} grep /usr/bin grep 'quoted text' echo
+printf && readonly "$@" cd | "$1" local sed 'quoted text' /usr/bin -eu $(pwd)
+		then then --verbose cd --verbose 'quoted text' done
+		'quoted text' "$@" &&
+readonly then "$@" --verbose 2>/dev/null cd echo readonly
+	awk /usr/bin "$@" sed && cd 'quoted text' sed | 'quoted text'
+	"$@" export done 2>/dev/null cd 'quoted text' $(pwd) test 2>/dev/null
+	printf ${HOME} 'quoted text' | test "$1" x=1 awk --verbose echo ${HOME}
+${HOME} 'quoted text' 'quoted text' grep awk x=1 echo local
+	"$@" printf sed && -eu readonly local
+		test $(pwd) "$@" 2>/dev/null sed -eu local test --verbose ${HOME} cd && ${HOME}
+	"$1" readonly done done
+		2>/dev/null then grep | 2>/dev/null
+		x=1 $(pwd) /usr/bin printf echo printf && "$1" 'quoted text' | then &&
+	done ${HOME} && printf 2>/dev/null
+cd export local readonly test export x=1 grep readonly export
+		local done 2>/dev/null awk -eu x=1 "$1" -eu grep echo /usr/bin
+cd "$@" -eu then $(pwd) echo --verbose $(pwd) $(pwd) --verbose -eu $(pwd) test
+&& awk /usr/bin cd test 2>/dev/null x=1 cd 2>/dev/null awk printf done done test
+		awk then grep done then | 'quoted text' grep "$@"
+	then echo sed done && readonly | 'quoted text' /usr/bin x=1 "$1"
+		awk echo then && $(pwd) /usr/bin ${HOME} printf x=1 sed --verbose cd
+		&& "$1" | x=1 done cd -eu x=1 readonly -eu /usr/bin sed export
+		cd x=1 /usr/bin 2>/dev/null 'quoted text' cd sed test
+	$(pwd) 2>/dev/null x=1 awk done "$@" && test "$1" then
+sed readonly 2>/dev/null
+		local sed readonly && export --verbose
+	echo /usr/bin | -eu local echo 'quoted text' printf -eu 2>/dev/null
+	-eu && && grep done && "$@" && | "$1" --verbose test 'quoted text'
+	/usr/bin cd readonly readonly awk -eu test export ${HOME} ${HOME} export
+$(pwd) done 'quoted text' test sed
+printf "$@" 2>/dev/null local done echo
+		grep sed then done 'quoted text' ${HOME} done awk done
+		&& | -eu echo 2>/dev/null 'quoted text' echo ${HOME} && printf done sed done
+	&& export $(pwd) printf /usr/bin
+		test export | test grep && printf local
+		readonly done ${HOME} ${HOME} 2>/dev/null $(pwd) && --verbose
+"$1" && sed test local done grep x=1 sed --verbose grep printf $(pwd) done export
+	sed grep /usr/bin test "$1" awk echo -eu -eu local
+&& "$1" && readonly echo 'quoted text'
+		local grep test sed -eu awk "$@" 2>/dev/null "$1" cd --verbose then done
+sed x=1 cd ${HOME} ${HOME}
+		printf awk echo echo x=1 test export /usr/bin local printf | echo
+		awk cd /usr/bin echo ${HOME} printf "$1" ${HOME} "$@" sed cd
+test "$@" 'quoted text' done ${HOME} then test cd test
+test | cd "$1" echo $(pwd) awk $(pwd) --verbose awk "$@" 'quoted text'
+		$(pwd) done local awk | readonly | --verbose sed x=1 -eu "$@" && $(pwd) then --verbose
+export grep -eu "$1" && sed printf --verbose readonly 'quoted text'
+-eu grep 2>/dev/null $(pwd) then then export readonly
+		export printf x=1 /usr/bin local 'quoted text'
+		then 2>/dev/null x=1 --verbose printf
+'quoted text' --verbose cd
+		| && then then grep cd -eu -eu awk grep readonly test test export $(pwd)
+x=1 printf test -eu --verbose grep
+done -eu test $(pwd) ${HOME} awk /usr/bin 'quoted text' $(pwd) done | awk test /usr/bin
+${HOME} done then /usr/bin echo grep
+cd done awk awk printf 'quoted text' awk done "$@" cd x=1 x=1
+		x=1 --verbose then -eu echo
+	readonly 2>/dev/null sed "$1" $(pwd) 2>/dev/null test "$@" x=1
+"$@" "$1" echo then test readonly
+		awk "$@" /usr/bin sed -eu local 2>/dev/null
+export then -eu cd done grep "$1" 'quoted text' | local echo then $(pwd) test
+sed readonly echo -eu ${HOME}
+local ${HOME} awk grep -eu echo | export
+		| 'quoted text' then /usr/bin
+		${HOME} -eu ${HOME} ${HOME} grep /usr/bin echo readonly
+	| ${HOME} ${HOME} done done readonly 2>/dev/null printf 2>/dev/null
+test --verbose test "$1" 'quoted text'
+	-eu 2>/dev/null readonly export --verbose
+		then sed "$@" x=1 done | sed export test --verbose -eu "$1"
+	-eu test 'quoted text' 2>/dev/null printf "$@" "$1" done x=1 grep cd ${HOME}
+		&& cd sed $(pwd) echo -eu echo awk test ${HOME}
+	x=1 printf ${HOME} 'quoted text' 2>/dev/null 'quoted text' "$@" $(pwd)
+		| grep readonly x=1 /usr/bin && local x=1 'quoted text'
+		then 'quoted text' export cd
+x=1 readonly "$@" test x=1 --verbose $(pwd)
+	/usr/bin -eu /usr/bin grep done /usr/bin readonly 'quoted text' local
+	then -eu grep sed | 'quoted text' 2>/dev/null local grep grep 'quoted text'
+		awk 'quoted text' "$1" then $(pwd) grep grep awk 'quoted text'
+$(pwd) /usr/bin ${HOME} x=1 | awk 2>/dev/null /usr/bin export $(pwd) ${HOME}
+		cd $(pwd) echo cd grep grep readonly cd local local 2>/dev/null printf &&
+		readonly && grep -eu done
+${HOME} 'quoted text' echo | echo echo
+	&& export export --verbose 'quoted text' readonly printf export "$1" awk then
+$(pwd) --verbose x=1 readonly --verbose readonly readonly
+"$1" export done grep echo grep
+		| printf printf grep echo local grep -eu
+'quoted text' local printf "$1" export export readonly "$1" x=1
+	local then readonly echo 2>/dev/null
+	readonly sed local "$@" && x=1 /usr/bin
+		printf test test then && ${HOME} 2>/dev/null -eu export
+		test -eu done && 'quoted text' cd ${HOME}
+"$@" 'quoted text' grep "$@" export awk export ${HOME} --verbose
+		local local then x=1 'quoted text' "$@" echo readonly 2>/dev/null
+		-eu -eu echo done x=1 grep && | then $(pwd) "$1"
+		x=1 export /usr/bin readonly -eu echo printf /usr/bin "$@" awk -eu export
+	done -eu 2>/dev/null && ${HOME} --verbose /usr/bin then $(pwd) sed test $(pwd)
+	2>/dev/null /usr/bin 2>/dev/null export --verbose --verbose
+| | $(pwd) | && sed $(pwd) | 2>/dev/null --verbose readonly
+	awk grep ${HOME} $(pwd) | local test x=1 |
+grep x=1 ${HOME} test readonly grep awk "$@" --verbose
+	awk x=1 "$1" x=1 && test then test | printf
+echo echo | readonly $(pwd) test /usr/bin local
+		grep test awk cd "$1" then grep sed awk "$@" export "$@" readonly export
+		printf | 'quoted text' ${HOME} echo readonly
+		"$1" grep printf --verbose
+	"$1" export --verbose && --verbose done
+	then --verbose then "$@" local 2>/dev/null echo grep local ${HOME} "$@"
+	'quoted text' printf | "$@" export grep "$@" local sed test -eu | | sed then
+		then "$1" printf cd "$1"
+export 2>/dev/null | 2>/dev/null cd "$1" printf "$1" && "$1"
+	grep "$1" cd readonly "$@" 'quoted text' readonly && x=1
+	&& "$@" && readonly grep echo local -eu grep awk 2>/dev/null
+/usr/bin test && x=1 'quoted text' then 'quoted text'
+	| awk local export cd $(pwd) | 2>/dev/null "$@" "$1" /usr/bin 'quoted text' 2>/dev/null
+		&& local local && $(pwd) 'quoted text' sed --verbose | local grep
+	&& $(pwd) done grep printf | echo x=1 awk echo done then awk --verbose "$1" -eu
+x=1 'quoted text' awk ${HOME} $(pwd) grep awk && echo local &&
+		echo 2>/dev/null readonly $(pwd) echo sed 2>/dev/null done "$@" "$1"
+	test printf test && echo echo local
+local 2>/dev/null --verbose echo sed
+	2>/dev/null test | -eu -eu | | 2>/dev/null local 2>/dev/null
+		cd then echo readonly done && grep 'quoted text' local ${HOME} | --verbose test
+'quoted text' grep && 'quoted text' 'quoted text' cd
+	test done $(pwd) /usr/bin export "$1" printf
+grep export test $(pwd) readonly then grep && printf /usr/bin "$1" /usr/bin
+		then x=1 --verbose awk | 2>/dev/null done x=1 /usr/bin local then grep
+	grep cd ${HOME} grep test then then grep readonly printf 'quoted text'
+	awk x=1 2>/dev/null printf then test $(pwd)
+		&& "$1" && | "$1" 2>/dev/null printf grep
+	sed done readonly readonly /usr/bin test export
+awk cd "$1" "$1" $(pwd) then
+		then readonly sed export "$1" "$@" printf
+export $(pwd) local --verbose awk "$@" then ${HOME}
+		grep cd | 'quoted text' x=1 x=1 awk "$1" x=1 ${HOME}
+		local echo done sed echo echo
+	cd printf readonly x=1 sed readonly grep --verbose
+readonly 2>/dev/null readonly readonly echo
+	local printf | done then awk 2>/dev/null awk done
+	then printf done /usr/bin
+| test --verbose ${HOME} $(pwd) && awk printf && sed
+		done 'quoted text' awk && then /usr/bin 2>/dev/null sed then
+readonly x=1 | /usr/bin $(pwd)
+	sed sed "$@" readonly ${HOME} done local
+		then local && -eu test && ${HOME} echo sed sed readonly readonly "$1"
+	then ${HOME} "$1" test grep printf
+		export && cd export test ${HOME} echo 'quoted text' local then echo x=1 echo
+awk test printf grep printf
+		x=1 "$1" -eu 2>/dev/null then done cd local "$1" printf
+	-eu && --verbose /usr/bin sed x=1 ${HOME}
+		&& x=1 local sed /usr/bin ${HOME} x=1 local
+		| awk x=1 "$1" readonly echo
+		test printf "$1" | /usr/bin grep cd test cd grep readonly 2>/dev/null
+	printf "$1" $(pwd) /usr/bin 'quoted text' cd | "$@" echo test | done done
+	sed -eu echo && $(pwd) grep sed
+$(pwd) | sed cd x=1 awk --verbose readonly
+		sed export 2>/dev/null 2>/dev/null
+		${HOME} export x=1 test sed
+		printf grep sed cd -eu readonly
+		-eu echo "$@" ${HOME} $(pwd) test export then --verbose
+	printf x=1 printf test sed awk && export printf && "$@"
+	printf /usr/bin -eu 'quoted text' local --verbose 'quoted text' cd test
+	echo test "$1" cd then echo "$1" test sed echo x=1 grep
+'quoted text' grep x=1 then -eu
+	/usr/bin readonly then local done 'quoted text' ${HOME}
+-eu readonly printf /usr/bin
+		| | export cd grep local 'quoted text'
+'quoted text' then export && cd --verbose export --verbose printf echo
+		$(pwd) cd awk printf "$1" printf "$@"
+	x=1 -eu printf | test $(pwd) done ${HOME} export "$1" ${HOME} x=1
+	export sed --verbose
+	sed x=1 done | awk "$1" grep "$@" done | done 'quoted text' sed
+		printf --verbose echo then /usr/bin then
+	"$1" 2>/dev/null x=1 readonly -eu readonly && /usr/bin sed
+--verbose ${HOME} -eu 2>/dev/null
+		2>/dev/null echo --verbose && test awk -eu $(pwd) && ${HOME}
+	$(pwd) && echo "$@" "$@" 'quoted text' readonly done done echo test "$@" done readonly
+&& | /usr/bin cd -eu cd --verbose
+	awk x=1 'quoted text' echo x=1 "$1" then "$1" | grep test cd /usr/bin
+		--verbose printf /usr/bin cd awk then awk local 'quoted text'
+		then sed -eu -eu $(pwd) $(pwd) /usr/bin cd /usr/bin
+readonly 2>/dev/null done --verbose then awk 2>/dev/null echo $(pwd) x=1
+/usr/bin grep 2>/dev/null "$@" -eu "$1" cd awk test /usr/bin
+		"$@" awk test done local x=1 -eu 2>/dev/null
+	"$1" sed readonly -eu awk done sed done --verbose done && grep printf /usr/bin
+sed echo local "$@" -eu $(pwd) awk readonly readonly done | export grep sed
+'quoted text' 2>/dev/null
+		awk --verbose awk cd /usr/bin "$1" echo "$@" sed | 2>/dev/null ${HOME} printf
+		echo | 2>/dev/null done readonly sed -eu 2>/dev/null 'quoted text'
+		test done awk $(pwd) && 2>/dev/null | -eu export awk test
+awk export test sed -eu 2>/dev/null x=1 "$1" done sed /usr/bin -eu printf awk
+	-eu -eu "$@" | $(pwd) && -eu local done &&
+	"$1" ${HOME} printf 2>/dev/null local "$@" echo
+done x=1 /usr/bin done grep ${HOME} /usr/bin done 'quoted text' printf
+2>/dev/null test $(pwd)
+	done readonly echo && printf cd "$@" grep test x=1
+		&& done echo awk sed $(pwd) 'quoted text' test printf && x=1 x=1 "$@" done |
+	"$1" -eu export readonly && 'quoted text' "$1" then --verbose echo && awk then $(pwd)
+		-eu 'quoted text' -eu then "$1"
+	${HOME} grep --verbose readonly 2>/dev/null $(pwd) -eu $(pwd) then grep
+$(pwd) then sed test -eu --verbose x=1
+${HOME} /usr/bin cd printf printf "$@"
+done grep /usr/bin "$@" "$@" sed
+		| ${HOME} $(pwd) "$1" --verbose $(pwd) test local | 2>/dev/null
+	then echo echo --verbose then cd readonly test 'quoted text' "$1" ${HOME}
+"$1" "$1" cd "$1" echo cd 'quoted text' local
+	export x=1 printf x=1 "$1" local grep
+	cd 2>/dev/null 'quoted text' | -eu grep awk grep grep local
+grep done 'quoted text' /usr/bin ${HOME} 2>/dev/null
+		test done "$1" grep | sed awk -eu "$@" grep
+local printf && done -eu && echo
+	export && awk export local 'quoted text' export awk /usr/bin /usr/bin
+local x=1 sed ${HOME} awk awk $(pwd) echo ${HOME} awk done done sed sed 'quoted text'
+	local /usr/bin x=1 done x=1 local sed
+		-eu readonly sed grep echo cd "$1" cd printf "$@" --verbose "$@"
+		| x=1 local printf | local export then test /usr/bin cd done ${HOME}
+	--verbose local cd cd && grep $(pwd)
+		&& cd test cd -eu then local /usr/bin sed sed /usr/bin export readonly
+/usr/bin readonly 'quoted text' -eu "$@" --verbose readonly
+		| local -eu local --verbose "$@" "$1" 2>/dev/null readonly cd "$1" && &&
+		| -eu --verbose && printf then then done then 2>/dev/null cd sed done 2>/dev/null
+printf --verbose awk | readonly printf printf
+	'quoted text' export awk /usr/bin then && echo
+| && readonly done sed then echo printf then
+"$@" /usr/bin readonly done echo
+		x=1 done printf && readonly 'quoted text' echo $(pwd) 2>/dev/null 2>/dev/null
+	local x=1 | 'quoted text'
+echo && "$@" done grep /usr/bin $(pwd)
+		awk readonly sed 'quoted text' | ${HOME} $(pwd) local -eu $(pwd) $(pwd)
+		printf export cd done cd local local done
+done -eu echo x=1 -eu readonly /usr/bin $(pwd) 'quoted text' readonly done
+	cd awk test ${HOME} sed 'quoted text' then
+export | | done awk 'quoted text' | sed export $(pwd) -eu ${HOME} $(pwd) test
+"$@" | grep --verbose -eu --verbose 'quoted text' local "$@" local done
+	"$@" ${HOME} awk | sed 2>/dev/null
+'quoted text' ${HOME} test then echo | && local cd ${HOME} $(pwd) /usr/bin readonly
+	local printf x=1 readonly | then echo ${HOME} x=1
+		"$@" grep readonly done "$@" local awk echo 2>/dev/null local export
+cd 'quoted text' readonly "$@" test printf readonly
+		2>/dev/null awk readonly "$1" "$@" printf
+	"$1" && export printf grep awk grep awk x=1 "$@" grep ${HOME} ${HOME} ${HOME} 2>/dev/null
+	done -eu printf -eu ${HOME}
+		echo echo "$1" done echo /usr/bin local cd
+		-eu grep cd $(pwd) export |
+	local cd "$1" "$@" cd sed done
+printf ${HOME} 2>/dev/null /usr/bin done readonly
+	&& local "$@" "$@" x=1 x=1 -eu && --verbose -eu $(pwd) /usr/bin readonly test
+	readonly && x=1 done 2>/dev/null
+		-eu readonly x=1 'quoted text' --verbose
+		grep then then grep && -eu export x=1 then
+	2>/dev/null "$1" "$1" "$1" grep export 2>/dev/null "$1" 2>/dev/null
+		"$@" then then awk $(pwd) && | --verbose ${HOME} printf
+		2>/dev/null 'quoted text' 'quoted text'
+	local test x=1 'quoted text' grep 'quoted text'
+	printf "$1" echo sed then cd ${HOME} 2>/dev/null then test then 'quoted text'
+		local "$1" export 'quoted text' && then | x=1 done | && -eu $(pwd)
+	readonly test sed cd echo cd $(pwd) -eu | awk then local
+"$1" readonly export grep | | grep
+		2>/dev/null 2>/dev/null readonly grep ${HOME} $(pwd) 'quoted text' $(pwd) readonly
+local "$1" -eu printf local
+printf /usr/bin echo ${HOME} x=1 $(pwd) /usr/bin | --verbose
+grep | "$@" cd 2>/dev/null readonly done
+		sed export "$1" grep cd printf /usr/bin "$1" done ${HOME} ${HOME}
+grep readonly "$@" awk --verbose $(pwd) export echo ${HOME}
+	| local -eu grep 'quoted text' awk 2>/dev/null
+		cd | && && local printf | --verbose
+x=1 readonly && cd sed export sed test
+	x=1 local | awk "$1" x=1
+-eu 'quoted text' readonly
+	then sed && | grep grep test /usr/bin
+${HOME} then awk -eu printf echo awk -eu "$@" export "$1" $(pwd) && 2>/dev/null
+		echo then -eu 'quoted text'
+	then echo | awk then readonly && export echo --verbose
+readonly printf ${HOME} | printf
+		&& $(pwd) then awk && "$@" | ${HOME}
+		test | local --verbose echo | export "$1" awk test "$@" "$@"
+${HOME} sed grep then cd -eu test grep export 'quoted text' cd x=1 --verbose
+		test -eu local && test cd then "$1"
+	$(pwd) -eu 2>/dev/null grep 'quoted text' 'quoted text' test echo readonly
+		sed /usr/bin "$1" awk printf awk --verbose then sed 'quoted text' ${HOME}
+		--verbose | && cd 2>/dev/null
+		sed local -eu $(pwd) then -eu
+		sed local readonly 'quoted text'
+local grep then -eu printf grep test && done && /usr/bin "$1"
+		'quoted text' && "$@" "$@" export
+export --verbose sed /usr/bin 2>/dev/null cd "$1" "$@" echo sed awk /usr/bin
+		done -eu 'quoted text' readonly done awk grep readonly /usr/bin echo awk awk &&
+echo "$1" && export | test then local -eu $(pwd) then readonly && cd 2>/dev/null
+		printf $(pwd) | && grep |
+echo $(pwd) test printf ${HOME}
+	'quoted text' "$@" export
+		then test grep then done $(pwd) 2>/dev/null test ${HOME} then printf
+/usr/bin 2>/dev/null local ${HOME} readonly test &&
+		readonly readonly "$@" x=1 readonly 2>/dev/null 2>/dev/null grep readonly
+		readonly /usr/bin $(pwd) "$@" then --verbose --verbose echo export grep
+		2>/dev/null $(pwd) grep 2>/dev/null readonly then
+		sed 'quoted text' done 2>/dev/null local /usr/bin
+"$1" 2>/dev/null done sed
+	printf 'quoted text' $(pwd) $(pwd) grep /usr/bin sed && local sed $(pwd)
+"$1" | printf sed test awk 'quoted text' "$@" test && cd
+	then cd ${HOME} readonly x=1 $(pwd) grep cd && awk $(pwd) ${HOME} "$1"
+		| echo && export readonly grep then "$1" export
+	done $(pwd) $(pwd) then export local grep printf then
+-eu then echo grep local -eu
+		${HOME} sed printf $(pwd) && export --verbose &&
+export printf && export grep echo awk cd done done local echo 2>/dev/null "$1"
+	test test readonly readonly && echo | local "$1" | -eu | "$1" readonly cd
+	readonly "$1" printf then && awk awk "$1" x=1 | sed -eu local
+	printf readonly sed ${HOME} --verbose "$1" echo ${HOME} x=1 awk ${HOME}
+"$@" awk done "$@" | | export echo readonly sed "$@"
+--verbose --verbose awk -eu done
+		done printf sed done readonly
+	printf test local cd && --verbose cd
+-eu 2>/dev/null | then readonly
+	"$1" echo 'quoted text' test printf cd ${HOME} $(pwd)
+		"$@" x=1 | "$@" 2>/dev/null --verbose sed "$@" printf awk x=1 echo printf test
+	awk test test grep cd x=1 $(pwd) sed ${HOME} then && done sed cd awk /usr/bin
+/usr/bin 'quoted text' sed | x=1 export "$@" local $(pwd)
+		cd echo sed test cd "$@" readonly x=1 test && printf /usr/bin -eu echo
+		readonly local readonly cd 2>/dev/null cd "$1" grep readonly "$@" readonly
+		grep "$@" 'quoted text' 'quoted text'
+	2>/dev/null done then awk /usr/bin 2>/dev/null
+local grep && awk --verbose 'quoted text' export readonly
+readonly --verbose sed local -eu printf x=1 && -eu
+$(pwd) readonly "$@" x=1 /usr/bin
+	-eu x=1 test x=1 'quoted text' export 'quoted text' && /usr/bin
+		echo cd /usr/bin cd printf export readonly
+	sed cd grep readonly sed test awk && 'quoted text' test sed 'quoted text'
+local cd cd export grep "$@" 'quoted text' test test sed "$@" &&
+local /usr/bin "$@" -eu /usr/bin -eu test test echo 'quoted text'
+	-eu && cd sed 2>/dev/null --verbose ${HOME} "$1"
+		| 'quoted text' /usr/bin cd --verbose ${HOME} $(pwd) $(pwd)
+		printf readonly 2>/dev/null echo 2>/dev/null --verbose
+	export ${HOME} sed $(pwd) 'quoted text'
+	printf ${HOME} 2>/dev/null
+		/usr/bin done --verbose "$1" readonly
+		awk $(pwd) --verbose export awk local 'quoted text' awk local 'quoted text'
+printf -eu -eu sed x=1 printf
+done -eu printf test | readonly "$@" test |
+		done /usr/bin echo 2>/dev/null 2>/dev/null ${HOME} &&
+	x=1 export cd grep grep export done export then readonly
+x=1 ${HOME} 2>/dev/null local
+	&& -eu && export readonly ${HOME} echo readonly --verbose /usr/bin
+	&& grep 2>/dev/null /usr/bin 2>/dev/null ${HOME} /usr/bin then --verbose
+2>/dev/null local awk 'quoted text' readonly "$1" cd printf export
+	--verbose /usr/bin | echo /usr/bin 'quoted text' 'quoted text' && export "$@" "$@"
+	2>/dev/null done awk readonly cd 'quoted text' grep -eu done
+&& "$@" "$1" "$@" x=1 local ${HOME} x=1 /usr/bin -eu
+printf sed echo readonly
+		local test test | /usr/bin export readonly
+		readonly done cd "$1" export $(pwd) 'quoted text' grep readonly printf
+	--verbose -eu test x=1 then done done ${HOME} "$1" printf && local grep
+	$(pwd) export test --verbose printf local "$1" 2>/dev/null
+export | awk printf done export sed 'quoted text' ${HOME}
+x=1 test grep sed $(pwd) printf $(pwd) x=1 "$1" export
+	awk --verbose 2>/dev/null printf printf && x=1 /usr/bin echo -eu readonly
+	-eu x=1 sed printf ${HOME} sed test echo /usr/bin ${HOME} --verbose local
+	x=1 printf 2>/dev/null "$@" awk echo | awk local echo x=1
+		local echo x=1 'quoted text' 'quoted text' ${HOME}
+awk x=1 "$@" awk export sed test "$1" /usr/bin | export
+readonly --verbose test x=1 local printf --verbose /usr/bin 2>/dev/null test 2>/dev/null
+	"$@" 2>/dev/null grep | cd $(pwd) x=1 2>/dev/null readonly /usr/bin
+	2>/dev/null done $(pwd) $(pwd) 'quoted text' /usr/bin
+		-eu "$@" echo awk then readonly printf $(pwd) ${HOME} awk test
+		done printf ${HOME} cd 2>/dev/null --verbose 'quoted text' --verbose -eu then
+	grep | /usr/bin ${HOME} "$1"
+printf done x=1 awk readonly ${HOME} printf
+then then ${HOME} /usr/bin "$@" awk awk ${HOME} then awk echo -eu |
+	local | readonly test 2>/dev/null
+then 'quoted text' then test cd "$@" x=1 'quoted text'
+		test done readonly sed awk && grep | "$@"
+-eu grep echo awk done printf echo
+done sed done cd done "$1" grep "$1" | printf /usr/bin grep ${HOME} cd ${HOME}
+	sed local x=1 echo && sed 'quoted text' x=1 x=1
+/usr/bin test /usr/bin 2>/dev/null && 'quoted text' && readonly
+	test | cd && cd done readonly 2>/dev/null
+		sed cd "$1" | ${HOME} "$@" ${HOME} "$@" x=1 /usr/bin $(pwd) "$1"
+/usr/bin ${HOME} sed local export $(pwd) -eu sed local
+	sed sed cd export done cd done local grep export
+/usr/bin | local readonly /usr/bin --verbose
+	readonly $(pwd) 'quoted text'
+	cd --verbose -eu -eu printf then done ${HOME} export readonly awk "$@" x=1
+		--verbose ${HOME} x=1 printf x=1 done --verbose printf done done 2>/dev/null
+	| ${HOME} grep awk --verbose then echo done local cd local && $(pwd) cd
+test echo export && export
+	2>/dev/null grep | -eu done done export "$1" $(pwd) test test readonly local
+--verbose test && local local readonly echo
+--verbose echo sed 2>/dev/null ${HOME} $(pwd) done
+		export && && x=1 ${HOME} ${HOME} done cd --verbose && test "$@" local 2>/dev/null
+	local x=1 | /usr/bin "$1" echo --verbose && 'quoted text'
+	--verbose then done 'quoted text' cd --verbose
+sed ${HOME} local grep readonly -eu "$@" done x=1 then /usr/bin | -eu
+	-eu awk 2>/dev/null "$1" ${HOME} export x=1 echo 'quoted text' printf
+	--verbose echo x=1 printf x=1 ${HOME}
+	grep export grep grep 'quoted text' x=1 ${HOME} /usr/bin
+	printf sed x=1 && "$1" --verbose | grep
+	'quoted text' readonly --verbose export "$@" awk
+	done | readonly x=1 2>/dev/null grep test
+	x=1 export printf /usr/bin | export cd
+"$1" 2>/dev/null 2>/dev/null | "$1" test && 'quoted text'
+	done awk $(pwd) $(pwd) then grep readonly
+/usr/bin 'quoted text' cd x=1 readonly
+	grep 'quoted text' readonly "$1" readonly
+test 'quoted text' ${HOME} -eu 2>/dev/null
+test "$1" echo done sed printf cd x=1 test "$@" export
+'quoted text' ${HOME} local sed && export 'quoted text' printf sed $(pwd) readonly
+grep echo $(pwd) readonly 2>/dev/null | | && local local |
+		2>/dev/null awk --verbose awk done 2>/dev/null sed
+		$(pwd) $(pwd) printf /usr/bin && grep local test $(pwd) x=1 -eu /usr/bin $(pwd)
+	awk test echo cd | && readonly "$@" done 'quoted text'
+		cd sed export 2>/dev/null local && "$1" sed printf then "$@" printf
+&& done && 'quoted text' $(pwd) grep
+readonly "$1" printf done
+readonly grep "$@" x=1 printf
+	&& 2>/dev/null then "$1"
+		grep local local --verbose awk grep readonly "$@"
+${HOME} "$1" | readonly /usr/bin /usr/bin
+		export $(pwd) awk local awk then printf -eu -eu echo readonly export
+/usr/bin $(pwd) done 2>/dev/null done x=1
+done done /usr/bin local ${HOME} local /usr/bin
+	--verbose ${HOME} awk "$1" grep "$1" test then
+		then /usr/bin grep readonly
+grep echo "$1" awk -eu /usr/bin "$1" local test cd awk grep readonly cd grep test
+grep --verbose /usr/bin x=1 awk && | then ${HOME} x=1 cd printf
+		done $(pwd) test "$@" readonly echo ${HOME} -eu readonly x=1 | done test echo
+local ${HOME} printf export awk awk x=1 echo && && printf printf readonly
+	sed sed then grep x=1 ${HOME} then echo cd "$1" awk readonly
+awk && -eu printf -eu sed
+		-eu echo && -eu -eu awk "$@" sed then export done sed && "$1" cd && 'quoted text'
+"$@" | | cd test export /usr/bin 'quoted text' local x=1 printf
+printf grep cd readonly
+	test local 2>/dev/null echo local done "$@" 'quoted text' awk test && export
+	| local "$@" echo grep
+		${HOME} x=1 'quoted text' readonly x=1 awk -eu $(pwd) -eu done then "$@"
+$(pwd) readonly ${HOME} ${HOME}
+		export sed local --verbose then local sed cd echo printf -eu grep test test 2>/dev/null
+test 'quoted text' 'quoted text'
+		awk printf "$1" readonly "$1" 2>/dev/null cd
+		then echo --verbose | "$1" printf
+		--verbose done grep then --verbose -eu
+		x=1 done done | ${HOME} x=1 "$@" readonly | "$1" ${HOME} awk export /usr/bin
+	${HOME} | awk "$1" $(pwd) "$@" $(pwd) | local --verbose $(pwd) test x=1 $(pwd)
+	grep local export then then --verbose
+		test | $(pwd) 'quoted text' then
+/usr/bin sed local x=1 grep 'quoted text' 'quoted text' 2>/dev/null
+		then test --verbose printf export test test /usr/bin
+	/usr/bin 2>/dev/null --verbose
+${HOME} printf 2>/dev/null grep export "$@" ${HOME} | sed echo 2>/dev/null then
+		${HOME} "$@" | --verbose /usr/bin
+		"$@" $(pwd) --verbose "$@" $(pwd) awk awk $(pwd) x=1 readonly
+		cd x=1 test 'quoted text' export | -eu ${HOME} $(pwd) && then
+		test test local -eu | cd grep local --verbose cd
+		${HOME} -eu "$@" cd && $(pwd) printf echo -eu "$@" ${HOME} cd "$@"
+		grep ${HOME} grep echo ${HOME} then 2>/dev/null
+	x=1 --verbose export grep test local done readonly local export
+echo local x=1 ${HOME} ${HOME}
+	grep echo "$1" --verbose
+		${HOME} export export sed grep local | local local grep /usr/bin ${HOME} -eu
+grep ${HOME} awk readonly && cd -eu then x=1
+		local local && /usr/bin 'quoted text'
+"$@" local grep printf 'quoted text' grep -eu
+	done -eu /usr/bin && /usr/bin ${HOME} awk
+	/usr/bin cd done && /usr/bin ${HOME}
+		'quoted text' "$@" -eu 2>/dev/null test
+	test x=1 | grep test test x=1 grep sed "$1" export && cd done local sed awk then
+		test /usr/bin local | && 2>/dev/null | x=1 "$1" --verbose -eu readonly
+readonly /usr/bin test readonly then echo
+test 2>/dev/null awk --verbose x=1 echo export printf
+local local --verbose -eu sed echo printf readonly
+		x=1 awk 'quoted text' $(pwd) --verbose done $(pwd) sed $(pwd) done
+--verbose sed /usr/bin ${HOME} --verbose | 'quoted text' /usr/bin awk
+grep local awk readonly /usr/bin awk "$@"
+/usr/bin sed /usr/bin --verbose --verbose test --verbose grep
+		| grep -eu ${HOME} -eu sed x=1 cd export readonly printf
+		printf test cd | cd local --verbose -eu test local grep
+		export "$@" export readonly /usr/bin echo
+| test cd /usr/bin then x=1 test "$1" -eu cd readonly --verbose
+		grep x=1 -eu grep then local x=1 'quoted text' "$1" 2>/dev/null printf
+	-eu -eu "$@" 2>/dev/null -eu -eu test
+x=1 'quoted text' printf awk awk
+		done $(pwd) "$1" echo --verbose
+		--verbose "$1" /usr/bin awk grep 'quoted text'
+/usr/bin local cd ${HOME} test readonly awk
+grep awk sed /usr/bin awk printf awk --verbose -eu
+	echo local readonly $(pwd) x=1 ${HOME} --verbose
+	$(pwd) printf $(pwd) x=1 ${HOME} grep sed ${HOME} ${HOME} sed awk export
+	"$@" "$1" ${HOME} local local local test local
+		x=1 printf cd "$@" done 'quoted text' printf cd x=1 then awk export | --verbose
+		sed cd 'quoted text'
+	${HOME} 'quoted text' grep awk
+		local $(pwd) /usr/bin printf 2>/dev/null |
+awk | && export -eu 'quoted text' test test
+'quoted text' x=1 done --verbose local -eu 2>/dev/null
+		done ${HOME} -eu printf 2>/dev/null awk -eu local 'quoted text'
+		| sed && $(pwd) export grep then cd $(pwd) export local cd cd then
+		"$@" x=1 && $(pwd) 2>/dev/null "$1"
+	&& cd local 2>/dev/null 2>/dev/null && $(pwd)
+'quoted text' done sed test
+${HOME} cd grep $(pwd) echo sed echo awk
+	x=1 grep 2>/dev/null export && ${HOME} 2>/dev/null
+	2>/dev/null readonly echo && | export then /usr/bin grep cd grep
+grep local then printf grep
+	--verbose cd "$@" export cd x=1 /usr/bin
+		cd test $(pwd) $(pwd) awk test "$1" awk 2>/dev/null readonly $(pwd) test --verbose
+readonly sed sed cd sed | grep && --verbose
+'quoted text' local x=1 grep grep $(pwd) 2>/dev/null done then sed then $(pwd) sed
+		local awk "$@" "$@" then x=1 then
+	"$@" done /usr/bin local echo cd /usr/bin readonly then $(pwd)
+--verbose "$1" local done
+	echo cd local cd cd grep test test
+"$1" | "$1" ${HOME} | local export awk awk ${HOME} grep printf -eu grep $(pwd) sed
+	cd done cd local done "$1" -eu then ${HOME} "$@" 'quoted text'
+		-eu awk && 2>/dev/null
+	done "$@" --verbose 'quoted text'
+		"$@" "$1" cd done done "$@"
+--verbose -eu /usr/bin "$@" 2>/dev/null
+local cd test /usr/bin 'quoted text'
+	then grep echo 'quoted text' -eu | $(pwd) then
+printf 2>/dev/null x=1 cd -eu | -eu 'quoted text' readonly
+	$(pwd) test $(pwd) "$1" echo awk "$@" 2>/dev/null sed
+		$(pwd) | then && --verbose local 2>/dev/null --verbose printf
+	local $(pwd) sed && done test
+		test echo test /usr/bin
+		"$1" && x=1 "$1" $(pwd) | printf grep --verbose done done "$1" /usr/bin /usr/bin
+		grep grep && then | then local sed
+2>/dev/null x=1 2>/dev/null 2>/dev/null
+		echo grep grep "$@" then 2>/dev/null echo done grep |
+		readonly cd 2>/dev/null --verbose then grep x=1 export /usr/bin then
+		cd --verbose && grep | && test cd awk sed echo 2>/dev/null -eu cd $(pwd) sed --verbose
+		${HOME} ${HOME} 'quoted text' x=1 ${HOME} 'quoted text' ${HOME}
+	cd grep done done $(pwd) readonly "$1" done sed awk
+&& x=1 /usr/bin ${HOME} "$1" "$@" $(pwd) /usr/bin
+		done -eu 2>/dev/null && x=1 'quoted text'
+${HOME} cd x=1 test ${HOME} local 'quoted text'
+		2>/dev/null && 2>/dev/null "$1" cd readonly echo printf
+	/usr/bin "$@" readonly then 'quoted text' local awk $(pwd) local
+	awk printf done then -eu $(pwd) done cd sed readonly ${HOME} test "$@" 'quoted text'
+	local echo 'quoted text' 2>/dev/null -eu done printf
+		then "$1" then --verbose "$@" grep done
+		/usr/bin --verbose 'quoted text' $(pwd) then cd readonly
+		export ${HOME} then test /usr/bin 'quoted text'
+		"$@" printf local local ${HOME} -eu ${HOME} --verbose
+		"$1" /usr/bin && x=1 local $(pwd) printf && "$1" printf 2>/dev/null
+	local $(pwd) -eu | -eu grep echo --verbose done --verbose
+		&& then /usr/bin local /usr/bin done $(pwd) "$@" | "$@"
+$(pwd) awk echo x=1 printf grep export "$@" "$1" export
+--verbose awk --verbose then
+	export && "$1" && printf awk sed $(pwd) readonly
+		-eu local test && done --verbose -eu --verbose test 'quoted text'
+	"$@" echo awk grep local cd 'quoted text' sed awk $(pwd)
+		| cd $(pwd) && ${HOME} $(pwd) | "$@" local ${HOME} awk "$@" then sed sed $(pwd)
+		readonly printf $(pwd) && "$1" awk done export --verbose ${HOME} "$@" printf "$@"
+	done $(pwd) awk 'quoted text' echo
+sed printf cd then echo
+cd export export echo test ${HOME} grep $(pwd) then test export test 'quoted text'
+	2>/dev/null grep cd grep grep --verbose --verbose echo
+		x=1 sed test -eu readonly sed "$1" then ${HOME} /usr/bin "$@" readonly
+		done echo 'quoted text' grep
+awk --verbose printf export
+		sed cd --verbose --verbose 2>/dev/null
+echo test 2>/dev/null local sed $(pwd) && 2>/dev/null test awk --verbose /usr/bin
+	printf "$@" then readonly x=1
+	export sed "$@" "$1" done awk printf
+2>/dev/null /usr/bin then readonly &&
+cd local -eu test $(pwd)
+'quoted text' "$1" sed "$1" awk 'quoted text' "$1"
+then "$1" 'quoted text' then awk sed
+local -eu ${HOME} test done grep export local ${HOME}
+		--verbose $(pwd) export && done cd /usr/bin
+	-eu "$@" echo 'quoted text' 'quoted text' | && $(pwd) "$@" && export grep ${HOME}
+$(pwd) local | export export local grep
+export export x=1 "$1" && "$@" done --verbose test -eu
+readonly readonly "$1" /usr/bin /usr/bin 'quoted text' -eu
+	-eu 'quoted text' ${HOME}
+2>/dev/null $(pwd) sed echo export x=1 readonly
+	local 'quoted text' echo cd /usr/bin "$1" 'quoted text' ${HOME} done ${HOME}
+${HOME} --verbose -eu "$1" -eu sed --verbose && $(pwd) grep ${HOME} echo grep $(pwd)
+		x=1 then sed $(pwd) ${HOME} | sed "$@" printf awk echo grep
+	"$1" "$@" -eu /usr/bin /usr/bin
+		export 'quoted text' $(pwd) export -eu "$1" readonly
+&& "$@" ${HOME} test test awk "$@" test -eu done readonly /usr/bin 'quoted text'
+x=1 x=1 sed && test x=1 sed grep cd 'quoted text' x=1 ${HOME}
+x=1 "$@" grep && test grep "$@" then -eu "$1" echo
+	"$1" "$@" "$1" grep ${HOME} ${HOME}
+		-eu cd && printf /usr/bin && echo 2>/dev/null
+	local export test && echo
+		then /usr/bin $(pwd) ${HOME}
+	cd local done local then local grep printf test done sed 'quoted text' ${HOME}
+	test done done echo /usr/bin x=1 "$@"
+	then ${HOME} x=1 test cd 'quoted text' awk done 2>/dev/null --verbose export /usr/bin
+		printf export local | ${HOME} sed | echo
+		--verbose $(pwd) 'quoted text' export
+		-eu readonly local -eu x=1 test
+	"$@" cd printf cd readonly cd && ${HOME} local
+		-eu | "$@" --verbose grep "$@" $(pwd) local test local cd "$1" printf
+		local -eu "$1" export
+		${HOME} readonly 'quoted text' echo 'quoted text' && done readonly --verbose
+		local $(pwd) sed ${HOME} sed && printf
+printf printf export "$1" readonly
+	/usr/bin x=1 -eu awk x=1 | 2>/dev/null $(pwd) $(pwd) then then
+-eu local done $(pwd) 2>/dev/null "$@" printf ${HOME}
+		2>/dev/null "$@" x=1 echo x=1 "$@" 'quoted text' test
+echo test echo --verbose | ${HOME} --verbose then x=1 local export
+	&& --verbose 2>/dev/null local "$1" printf $(pwd) | 'quoted text' 'quoted text'
+	then -eu awk cd $(pwd) x=1 | 'quoted text' -eu echo $(pwd) readonly
+		cd printf sed $(pwd) echo $(pwd)
+		sed 2>/dev/null local local test "$1" local local
+	local export && done test $(pwd) export awk /usr/bin
+	"$@" cd 2>/dev/null $(pwd)
+	/usr/bin echo printf x=1 | &&
+local x=1 && echo test --verbose readonly
+		--verbose printf ${HOME} x=1 "$@" "$1" printf
+	sed grep 'quoted text' "$@" | x=1 2>/dev/null
+		"$1" x=1 local && /usr/bin ${HOME}
+	"$@" -eu /usr/bin ${HOME} then $(pwd) sed --verbose sed done
+local cd | export local x=1 awk
+		/usr/bin printf | grep ${HOME} then local done sed cd readonly --verbose
+	-eu ${HOME} cd ${HOME} sed printf ${HOME} echo
+	--verbose /usr/bin /usr/bin -eu -eu --verbose readonly "$1"
+		/usr/bin x=1 -eu x=1 && grep "$@" printf done sed --verbose
+export x=1 x=1 -eu x=1 ${HOME} | "$1" $(pwd) $(pwd) && cd sed done cd
+then 2>/dev/null x=1 printf
+	awk "$1" awk cd 'quoted text' then ${HOME} x=1 cd cd /usr/bin 'quoted text'
+	test export done grep test x=1 grep "$@" then /usr/bin export cd "$1"
+		/usr/bin awk "$@" -eu && export && cd sed | /usr/bin ${HOME} 2>/dev/null
+		echo local && | x=1 awk 2>/dev/null done x=1 export grep echo export echo "$@" done
+/usr/bin then export "$1" 'quoted text'
+		done ${HOME} export readonly then
+		-eu printf cd local export "$@"
+	${HOME} 'quoted text' /usr/bin
+${HOME} $(pwd) x=1 awk test export --verbose -eu awk readonly sed ${HOME} 2>/dev/null
+	then $(pwd) then /usr/bin /usr/bin then echo $(pwd) -eu 2>/dev/null
+	-eu "$1" -eu grep 'quoted text' -eu --verbose 'quoted text'
+	/usr/bin | readonly grep --verbose cd then local && cd "$@"
+		2>/dev/null 'quoted text' ${HOME} --verbose then done x=1 grep local then
+		--verbose sed /usr/bin local awk /usr/bin 'quoted text' -eu 2>/dev/null done
+		echo x=1 cd /usr/bin awk awk && --verbose
+		$(pwd) -eu --verbose done 'quoted text' ${HOME} 2>/dev/null done "$@"
+grep && printf printf cd ${HOME} 2>/dev/null then x=1 readonly
+		"$1" && 'quoted text'
+		local /usr/bin x=1 cd then x=1 printf
+	printf printf "$1" "$1" --verbose && "$@" local
+	/usr/bin ${HOME} && "$@" /usr/bin "$@" "$1" test
+	export x=1 ${HOME} x=1 "$@" readonly "$1" sed echo
+/usr/bin cd 2>/dev/null export sed
+	test done awk local -eu 2>/dev/null
+		then "$@" sed local readonly "$@" readonly | "$1" --verbose 2>/dev/null /usr/bin
+		"$@" done -eu test 'quoted text'
+	grep printf grep && printf -eu "$1" 'quoted text'
+		readonly export | grep | "$@" | "$@"
+		echo then "$@" grep readonly
+printf "$1" export -eu grep
+		done echo x=1 $(pwd) local
+	export echo then grep /usr/bin | ${HOME}
+		grep && -eu echo grep | local readonly 2>/dev/null /usr/bin 'quoted text'
+test printf then 'quoted text' ${HOME} export
+	'quoted text' x=1 /usr/bin
+		| "$1" readonly /usr/bin ${HOME} | awk && local
+		&& local "$1" "$@" "$@" done
+		grep 'quoted text' ${HOME} ${HOME} 'quoted text' awk awk --verbose
+$(pwd) /usr/bin "$@" --verbose readonly
+	printf ${HOME} "$@" echo
+sed cd local 'quoted text' "$1" awk x=1 | grep sed
+	local then done cd awk awk $(pwd) export export
+	printf ${HOME} test echo printf
+/usr/bin $(pwd) "$@" awk $(pwd) grep && cd ${HOME} 'quoted text'
+awk && test 2>/dev/null readonly done && sed done /usr/bin && 'quoted text'
+"$1" -eu sed -eu 2>/dev/null
+	x=1 | | test grep ${HOME} cd then cd "$1" grep cd readonly
+| $(pwd) grep 2>/dev/null sed cd done local x=1 done 2>/dev/null
+2>/dev/null echo then /usr/bin then
+		| local 'quoted text' && 'quoted text' ${HOME} grep -eu grep &&
+| && | "$1" awk readonly then
+		readonly 2>/dev/null local && 2>/dev/null "$@" awk ${HOME} grep printf
+	x=1 2>/dev/null local local --verbose 'quoted text'
+local echo export $(pwd) awk sed "$1" x=1 /usr/bin "$@" sed --verbose "$@" cd -eu
+2>/dev/null awk cd local 2>/dev/null | awk then 'quoted text' awk test
+then ${HOME} -eu readonly | readonly sed 'quoted text' /usr/bin
+		cd /usr/bin sed cd done
+		echo | $(pwd) | grep x=1 && && 2>/dev/null
+awk "$1" readonly sed && -eu "$@" -eu done printf local /usr/bin
+	--verbose "$1" | awk echo 2>/dev/null -eu x=1 readonly /usr/bin
+	echo grep && then "$@" 2>/dev/null
+local x=1 ${HOME} local $(pwd) /usr/bin local "$@" 2>/dev/null done |
+		then -eu --verbose grep | then ${HOME} $(pwd) test "$@" test
+	then readonly ${HOME} export then awk -eu export
+		--verbose awk 'quoted text' x=1 awk -eu /usr/bin
+		local then 'quoted text'
+	${HOME} | $(pwd) readonly $(pwd)
+done ${HOME} echo test done --verbose grep local echo cd
+	then printf | $(pwd) x=1
+		"$@" readonly /usr/bin x=1 then test
+-eu readonly cd local 'quoted text' echo ${HOME}
+	'quoted text' ${HOME} --verbose ${HOME} readonly /usr/bin
+	2>/dev/null 'quoted text' awk export "$1"
+	-eu sed 2>/dev/null export 'quoted text' -eu
+		done --verbose "$1" x=1 /usr/bin cd x=1 'quoted text' ${HOME} "$1"
+| done ${HOME} export "$@" cd $(pwd) printf | /usr/bin local 'quoted text' 'quoted text'
+cd echo done then local printf ${HOME} -eu /usr/bin 'quoted text' 'quoted text'
+		cd && && ${HOME} cd awk
+		/usr/bin --verbose grep echo grep cd readonly && $(pwd)
+/usr/bin /usr/bin "$1" -eu | local -eu grep
+-eu x=1 export cd grep 'quoted text' | && | then $(pwd) /usr/bin |
+	/usr/bin local x=1 'quoted text' x=1 printf
+sed ${HOME} printf test /usr/bin then local cd "$1" --verbose
+	-eu 2>/dev/null printf -eu 'quoted text' x=1 ${HOME} grep "$1"
+		echo then awk "$@" /usr/bin sed "$1" grep
+test "$1" grep local echo "$@" done sed
+test 2>/dev/null $(pwd) x=1
+	sed 2>/dev/null sed 2>/dev/null test "$1" --verbose
+		${HOME} sed then /usr/bin "$@" awk -eu cd sed ${HOME} $(pwd)
+	test done awk $(pwd) 2>/dev/null
+		then 2>/dev/null test export printf $(pwd) | echo local ${HOME}
+		awk | ${HOME} awk done awk readonly test 'quoted text' ${HOME} grep 2>/dev/null
+	local | --verbose test -eu ${HOME} test printf cd printf
+--verbose awk echo export 'quoted text' export /usr/bin done 'quoted text'
+grep && $(pwd) done ${HOME} $(pwd) test
+		x=1 2>/dev/null then local ${HOME} printf sed "$@" 'quoted text'
+$(pwd) sed readonly x=1 printf sed grep -eu 2>/dev/null cd --verbose done
+		--verbose 'quoted text' readonly then printf test grep && $(pwd)
+2>/dev/null local "$1" grep echo printf cd printf grep "$@" awk --verbose "$@"
+	cd grep then 2>/dev/null test then echo && awk
+	awk -eu /usr/bin "$1" $(pwd) ${HOME}
+cd /usr/bin then /usr/bin && done && test sed done
+		'quoted text' done --verbose ${HOME}
+	x=1 $(pwd) done 2>/dev/null
+-eu done printf ${HOME} "$1" 'quoted text' local then
+printf printf done | awk echo cd $(pwd)
+	done sed --verbose grep grep
+		$(pwd) cd awk grep -eu export grep export
+		test $(pwd) x=1 --verbose x=1
+grep printf | "$1" then -eu $(pwd) printf $(pwd) printf 2>/dev/null then
+	-eu export local echo && x=1 /usr/bin readonly |
+		local awk awk echo ${HOME} grep printf test sed
+	export echo 'quoted text' $(pwd) export done grep readonly then /usr/bin
+		&& -eu /usr/bin awk test | awk && -eu local done 'quoted text'
+	readonly cd grep test /usr/bin 2>/dev/null --verbose 2>/dev/null
+		&& then export readonly "$@" -eu /usr/bin ${HOME} awk readonly
+	done local 2>/dev/null x=1 done printf -eu printf
+		then x=1 then printf && done /usr/bin "$1" then
+	sed awk then "$1" "$@" printf && && grep done awk echo $(pwd)
+	cd "$@" cd grep grep echo && cd test ${HOME} $(pwd) printf sed "$@"
+		export && 2>/dev/null printf export sed /usr/bin export /usr/bin $(pwd) local
+		"$@" "$@" echo "$@" /usr/bin x=1 /usr/bin local
+	| local "$@" $(pwd) test 2>/dev/null && | echo then "$@" sed printf && $(pwd) cd
+cd && $(pwd) echo export export
+&& then "$@" | | awk done x=1 then 2>/dev/null "$1" $(pwd) 2>/dev/null local
+	sed export done $(pwd) grep "$@" awk "$1" test --verbose grep "$1"
+sed && export 2>/dev/null | readonly --verbose local
+| --verbose x=1 export printf done echo done 'quoted text' local echo
+		| cd sed "$1" local printf cd x=1 'quoted text' x=1 $(pwd)
+	awk -eu 'quoted text' readonly export
+		--verbose "$1" readonly ${HOME} x=1 --verbose "$1"
+	"$1" ${HOME} "$1" awk "$@" done |
+printf test sed 2>/dev/null grep printf 2>/dev/null
+	printf done grep printf grep done local x=1 -eu done printf grep
+x=1 ${HOME} 'quoted text' awk 'quoted text' test | cd -eu ${HOME}
+	-eu awk "$1" "$1" 2>/dev/null then --verbose grep sed
+		done "$1" local $(pwd) export
+-eu | "$@" cd && grep | sed local grep 'quoted text' readonly /usr/bin x=1
+	cd export printf $(pwd) local
+		grep grep && local "$1" && 2>/dev/null grep echo $(pwd) /usr/bin ${HOME} x=1 then
+	'quoted text' sed | $(pwd) grep then $(pwd) ${HOME} -eu
+	'quoted text' printf test ${HOME} -eu export ${HOME} 'quoted text'
+-eu /usr/bin | export sed test --verbose -eu x=1 'quoted text' awk then $(pwd) $(pwd)
+		export 2>/dev/null test awk grep $(pwd) echo export
+	-eu sed local --verbose awk awk readonly
+	&& --verbose sed then "$@" $(pwd) && -eu awk 2>/dev/null then "$1" awk x=1
+done sed local local $(pwd) local test export && echo
+test grep 2>/dev/null "$1" printf x=1 && printf
+	${HOME} export 2>/dev/null local then && awk && /usr/bin cd x=1 cd && cd cd 'quoted text'
+		export x=1 /usr/bin cd echo --verbose local /usr/bin
+		then grep ${HOME} | printf
+		2>/dev/null cd --verbose -eu echo printf -eu x=1
+awk | "$@" /usr/bin 'quoted text' ${HOME} x=1
+		x=1 grep test grep --verbose test /usr/bin /usr/bin export "$@"
+		then | ${HOME} export 'quoted text' /usr/bin export printf
+grep --verbose sed "$@"
+	export 'quoted text'
+done ${HOME} awk done 'quoted text' grep sed "$@"
+done --verbose 'quoted text' ${HOME} echo done x=1 2>/dev/null
+| then "$1" cd export readonly 2>/dev/null echo && awk --verbose 2>/dev/null
+	then $(pwd) /usr/bin awk grep cd
+		echo grep export then sed readonly
+		test echo $(pwd) --verbose "$@" 'quoted text' "$1" x=1 /usr/bin local
+		-eu awk readonly --verbose sed 2>/dev/null
+	'quoted text' ${HOME} printf x=1
+		test done "$1" "$@" printf $(pwd) "$@"
+#include c109.sh
+local test "$@" $(pwd) test 2>/dev/null awk "$@" --verbose sed 2>/dev/null
+$(pwd) x=1 $(pwd) grep 'quoted text'
+	grep --verbose && 'quoted text' readonly 2>/dev/null echo /usr/bin then "$@" then
+	"$1" local printf readonly x=1 'quoted text' awk $(pwd)
+	local "$@" cd sed readonly printf x=1 ${HOME} --verbose
+		awk printf sed 'quoted text'
+	grep then grep -eu --verbose | sed "$1" test ${HOME}
+$(pwd) | x=1 awk local echo export local
+printf && echo /usr/bin then readonly 2>/dev/null "$1"
+	'quoted text' | && sed done && --verbose local | /usr/bin "$1" cd then /usr/bin
+		readonly sed -eu local cd echo 'quoted text'
+	-eu local awk && grep | "$1" readonly then x=1 echo
+		'quoted text' x=1 test test
+	readonly cd local --verbose && sed then && && export x=1 local echo "$@"
+"$@" local -eu local 'quoted text' sed grep 'quoted text' "$@"
+	sed && grep printf awk "$1" && echo 2>/dev/null "$@"
+		printf /usr/bin echo | && awk cd cd "$1" readonly awk done --verbose
+	then "$1" "$1" x=1 "$@" cd printf | "$@" echo test awk "$@"
+	-eu readonly printf /usr/bin readonly "$@"
+	-eu 2>/dev/null local
+	-eu "$@" /usr/bin echo echo cd grep && printf
+		cd "$1" | grep done 'quoted text'
+		&& done | test x=1 --verbose
+		printf readonly echo
+		x=1 $(pwd) x=1 -eu | 'quoted text'
+then | | echo printf cd "$@" sed && "$@"
+		${HOME} 'quoted text'
+		cd $(pwd) cd "$1" $(pwd) awk
+	-eu | -eu readonly test -eu test 2>/dev/null -eu
+local readonly awk -eu --verbose readonly x=1 -eu 'quoted text'
+-eu 2>/dev/null ${HOME} sed "$@" local printf -eu "$1" -eu cd cd cd grep grep
+		test "$@" x=1 && export "$1" "$@" 2>/dev/null "$1" "$1" cd
+	export done grep /usr/bin "$@" then -eu local done
+	grep && test /usr/bin awk test grep 2>/dev/null sed done
+	2>/dev/null grep cd cd grep "$1" $(pwd) -eu
+		cd /usr/bin $(pwd) "$@" grep && done then | echo 'quoted text' ${HOME}
+	2>/dev/null /usr/bin readonly --verbose cd $(pwd) cd && printf
+		| x=1 "$1" ${HOME} done grep /usr/bin && x=1 done /usr/bin
+x=1 | 'quoted text' 'quoted text' then x=1 ${HOME} 2>/dev/null "$@" echo
+	-eu done $(pwd) readonly test then awk ${HOME} && local && | readonly printf
+${HOME} local /usr/bin then 'quoted text' readonly local sed
+done grep $(pwd) 'quoted text' 'quoted text'
+echo "$1" test --verbose "$@" readonly "$1" "$1" export sed sed $(pwd) export
+		awk export sed "$1" done awk --verbose printf readonly cd sed then sed cd
+	"$@" && sed && cd | 'quoted text' ${HOME} awk awk test --verbose readonly
+		local done --verbose done readonly
+		sed && | --verbose then done test 'quoted text' | 2>/dev/null
+-eu printf local "$@" x=1 ${HOME} then "$1" grep
+		"$1" printf "$@" awk echo
+	grep 2>/dev/null then ${HOME} printf
+	then local ${HOME} x=1 then awk grep awk "$@" && export -eu "$@" cd | ${HOME}
+	grep /usr/bin && test printf -eu echo awk --verbose | 2>/dev/null | "$1" done
+export readonly local
+	local cd 'quoted text' --verbose -eu "$1" sed
+		&& | cd readonly x=1 grep
+		test $(pwd) /usr/bin readonly ${HOME} export 2>/dev/null
+-eu 'quoted text' | done "$@" /usr/bin ${HOME} readonly echo grep then printf
+done local 'quoted text'
+	export "$@" x=1 --verbose /usr/bin 'quoted text'
+		2>/dev/null x=1 'quoted text' grep test
+then ${HOME} readonly ${HOME} cd | then "$@" cd ${HOME} grep --verbose
+local awk 'quoted text' ${HOME} "$1"
+	awk /usr/bin 2>/dev/null grep sed --verbose grep cd x=1 printf then
+	test export /usr/bin &&
+awk "$@" --verbose x=1 --verbose grep echo readonly x=1 test --verbose "$1" /usr/bin
+		then echo --verbose && then && x=1 printf readonly x=1
+awk then | local && export test cd 2>/dev/null && 2>/dev/null
+	2>/dev/null x=1 printf --verbose 'quoted text' sed --verbose done $(pwd)
+		awk /usr/bin local && --verbose | cd "$@" echo 2>/dev/null cd done awk 2>/dev/null
+		/usr/bin | done -eu -eu test then -eu | x=1 "$@" printf
+/usr/bin readonly | /usr/bin then test awk export sed then readonly "$@" /usr/bin
+		'quoted text' "$@" $(pwd) printf echo sed x=1 cd
+sed 'quoted text' echo /usr/bin export then $(pwd) sed done 2>/dev/null awk awk
+		"$@" -eu done $(pwd) then 2>/dev/null test local export grep
+		2>/dev/null "$@" cd "$1" printf test local awk -eu 2>/dev/null grep | export
+-eu grep && && cd ${HOME} 'quoted text'
+		printf x=1 x=1 grep local x=1 cd | done && ${HOME} grep sed grep
+		$(pwd) "$1" printf export test | then $(pwd) "$@" printf then awk export $(pwd)
+	done "$1" --verbose | x=1 then /usr/bin --verbose cd
+&& 2>/dev/null cd test cd -eu ${HOME}
+awk 'quoted text' "$@" | $(pwd) echo && test awk x=1 | readonly
+	"$1" && && sed && "$@"
+		then echo grep echo && --verbose | grep printf "$@" && done
+	&& printf echo test readonly local local test "$@" -eu cd && export x=1 grep local
+	&& ${HOME} 2>/dev/null readonly awk done cd $(pwd) awk printf
+		test echo test done && sed "$1" 2>/dev/null /usr/bin "$1"
+test echo 2>/dev/null
+		2>/dev/null | 'quoted text' x=1 2>/dev/null 'quoted text' --verbose ${HOME}
+		${HOME} awk && awk "$@" sed 2>/dev/null cd then "$@" "$1" | /usr/bin
+2>/dev/null done "$@" cd "$@" -eu --verbose | sed $(pwd)
+	$(pwd) "$@" done printf echo done readonly 'quoted text' "$@"
+		$(pwd) --verbose x=1 sed grep
+	printf 2>/dev/null --verbose /usr/bin /usr/bin $(pwd) echo
+/usr/bin "$@" 2>/dev/null x=1 $(pwd) --verbose && then test done |
+awk echo local ${HOME} && sed readonly
+	&& grep awk sed echo | export printf ${HOME} 'quoted text'
+		sed "$1" test then awk done sed
+		'quoted text' && /usr/bin x=1 --verbose export ${HOME} 2>/dev/null
+'quoted text' export $(pwd) awk -eu 'quoted text' -eu 'quoted text'
+		'quoted text' test awk | echo && echo ${HOME} | 2>/dev/null "$@" x=1
+		local echo then done sed ${HOME} local printf readonly
+printf "$@" $(pwd) && done awk test 2>/dev/null
+done awk test then grep
+		'quoted text' ${HOME} x=1 echo /usr/bin "$1" ${HOME}
+"$1" 2>/dev/null cd test ${HOME} printf
+		readonly x=1 -eu readonly readonly test cd cd
+		test ${HOME} -eu /usr/bin done test printf -eu
+2>/dev/null then sed /usr/bin echo echo cd $(pwd) export 2>/dev/null
+		echo cd sed local grep done
+${HOME} 'quoted text' printf printf export "$@"
+		-eu printf local --verbose x=1 -eu && sed printf $(pwd)
+		cd ${HOME} "$@" done ${HOME} sed x=1
+x=1 done -eu done && && grep local -eu done -eu
+	$(pwd) local readonly local readonly echo && "$@" export
+	$(pwd) readonly test ${HOME} && | ${HOME} --verbose "$1" "$1" /usr/bin local
+		then cd /usr/bin cd ${HOME} test
+	"$1" done cd "$@" "$1" cd printf 'quoted text'
+		'quoted text' && --verbose ${HOME} 2>/dev/null --verbose done export
+		printf "$@" printf && $(pwd) local --verbose $(pwd) -eu && awk done "$1" $(pwd)
+	'quoted text' echo $(pwd) grep
+	$(pwd) then test readonly cd awk test --verbose
+	printf /usr/bin ${HOME} $(pwd) x=1 echo export 'quoted text' /usr/bin printf sed
+		| ${HOME} 2>/dev/null x=1 /usr/bin && && cd /usr/bin local sed printf grep
+grep readonly echo printf $(pwd) ${HOME} done echo x=1 done test
+		local test /usr/bin echo done export
+	echo readonly /usr/bin --verbose
+		2>/dev/null then then -eu -eu cd printf readonly grep | sed readonly readonly
+		awk sed local && local /usr/bin -eu $(pwd) ${HOME} --verbose
+--verbose --verbose awk -eu "$@" "$1" --verbose cd ${HOME} grep
+	/usr/bin -eu awk 'quoted text' done export printf
+		grep --verbose grep $(pwd) grep /usr/bin && |
+		| 'quoted text' readonly cd done then /usr/bin && /usr/bin then |
+sed /usr/bin "$@" echo done
+	test 'quoted text' export sed | 'quoted text' 2>/dev/null
+		$(pwd) local printf x=1 sed test
+	cd "$1" local x=1 "$1"
+	${HOME} && ${HOME} ${HOME} "$1" echo
+		"$@" sed -eu awk "$1" sed "$1" readonly awk cd x=1 test readonly
+echo && then ${HOME} then readonly test "$@" awk 2>/dev/null echo readonly "$@"
+		test then $(pwd) /usr/bin
+		| printf export test export "$1" --verbose
+		done --verbose grep cd grep && readonly
+"$@" sed test echo local 2>/dev/null readonly --verbose | local grep grep printf
+		readonly echo 'quoted text' 2>/dev/null local
+		export ${HOME} "$1" echo grep sed sed x=1 x=1
+2>/dev/null 'quoted text' cd
+	"$1" test "$1" readonly
+	$(pwd) --verbose grep 2>/dev/null "$1" "$1" ${HOME} awk ${HOME} printf export
+readonly test printf then "$@" cd 2>/dev/null readonly
+test done x=1 then | -eu "$1" then -eu echo
+	x=1 "$@" then x=1 readonly
+		echo x=1 export grep
+	readonly 2>/dev/null $(pwd) echo
+	--verbose ${HOME} awk done done then /usr/bin cd readonly ${HOME} 2>/dev/null
+		test sed && -eu ${HOME} local 2>/dev/null cd 'quoted text' -eu
+sed local x=1 x=1 --verbose export done printf grep then printf
+		export cd readonly export grep 2>/dev/null "$@" -eu | $(pwd)
+		--verbose x=1 echo "$1" printf x=1 && local test && echo "$1" awk readonly
+	test --verbose && "$1" cd grep export sed grep
+	done local -eu sed local awk grep awk 2>/dev/null x=1 sed grep x=1 ${HOME}
+done test echo local --verbose
+		then | x=1 done 'quoted text' "$@" "$1" $(pwd) sed readonly printf awk
+	2>/dev/null export printf
+		"$1" cd test done ${HOME} grep test "$1" export x=1 cd /usr/bin grep
+		${HOME} printf --verbose done local then "$1" "$@" awk
+		cd done test awk sed -eu x=1 && 2>/dev/null | test ${HOME} awk | -eu done 'quoted text'
+--verbose sed readonly --verbose "$1" ${HOME} grep grep "$1" "$@" -eu awk
+		'quoted text' cd "$@" echo sed /usr/bin echo
+		"$@" readonly | | /usr/bin done && 'quoted text' export awk echo | test 2>/dev/null
+export ${HOME} $(pwd) 2>/dev/null --verbose printf done sed &&
+		--verbose printf test $(pwd) then | printf then $(pwd) 2>/dev/null sed -eu
+cd then readonly "$1"
+	readonly export cd -eu done local grep $(pwd) -eu
+	readonly -eu grep test awk --verbose test
+local readonly | test then /usr/bin /usr/bin --verbose "$@" then local then
+		-eu readonly done 'quoted text' $(pwd) readonly
+cd | printf local export local && done
+		| "$@" readonly export -eu
+		done 'quoted text' "$@" "$@"
+		"$@" sed $(pwd) /usr/bin printf awk test 2>/dev/null
+	sed 'quoted text' test printf
+	$(pwd) grep 2>/dev/null --verbose | echo export /usr/bin "$1"
+	/usr/bin 2>/dev/null $(pwd) "$1" | "$@" -eu --verbose
+--verbose $(pwd) local "$@" -eu printf
+grep "$1" --verbose done && | awk test awk sed cd test printf "$@"
+echo "$@" /usr/bin x=1 test "$@"
+		&& /usr/bin | export then readonly ${HOME} printf printf local x=1 local "$1"
+--verbose && awk local printf
+	2>/dev/null printf then && printf /usr/bin
+	local --verbose echo readonly x=1 "$1" export "$1" 'quoted text' readonly
+		export awk ${HOME} test cd --verbose $(pwd)
+	echo done x=1 && --verbose local ${HOME} 'quoted text' ${HOME} x=1 awk $(pwd)
+awk "$1" done 'quoted text' test && echo "$@" sed
+	&& x=1 done export /usr/bin 2>/dev/null "$1" local
+		readonly readonly export "$@" grep readonly 2>/dev/null sed /usr/bin
+	awk $(pwd) cd 'quoted text' "$@" sed test
+	| awk /usr/bin "$1" ${HOME} readonly "$@"
+	"$@" && then "$1" done printf -eu "$1" local test x=1 x=1 'quoted text'
+/usr/bin sed done then -eu $(pwd) export echo | then
+		x=1 cd "$1" x=1 export grep /usr/bin "$1" sed $(pwd)
+	| done 2>/dev/null 2>/dev/null
+		cd awk "$1" "$@" -eu && local readonly echo ${HOME}
+cd done --verbose -eu cd export
+	| | grep ${HOME} then awk cd && --verbose && --verbose $(pwd) sed done echo x=1
+		test --verbose local then awk test "$1"
+		echo local x=1 | echo /usr/bin "$1" cd sed
+awk /usr/bin then then $(pwd) 'quoted text' export "$@" printf cd
+printf sed -eu ${HOME} x=1 && awk -eu | printf test test echo -eu then
+2>/dev/null awk readonly
+		readonly && $(pwd) sed x=1 test
+cd test --verbose then "$1" export printf -eu sed
+		then export grep | | export readonly /usr/bin then cd /usr/bin
+	/usr/bin local 2>/dev/null --verbose -eu | "$@" grep 2>/dev/null "$1" cd echo ${HOME}
+		$(pwd) readonly export grep -eu then export sed ${HOME} cd awk sed
+printf -eu /usr/bin "$1" done $(pwd) && --verbose printf export local done
+		sed "$1" grep && --verbose printf "$1" sed test 2>/dev/null "$@"
+2>/dev/null cd $(pwd) then 'quoted text' printf printf readonly /usr/bin
+		-eu done | "$1" test
+	printf $(pwd) local ${HOME} readonly test readonly 2>/dev/null awk
+		"$@" local /usr/bin /usr/bin | | printf /usr/bin done /usr/bin x=1 | cd echo /usr/bin
+	x=1 -eu 'quoted text' export then export cd /usr/bin x=1 "$1" -eu ${HOME} then 2>/dev/null
+	2>/dev/null ${HOME} export done local 'quoted text' done cd x=1 printf grep
+cd export -eu awk ${HOME} readonly x=1 | x=1 local -eu x=1 /usr/bin sed export
+printf "$1" done awk done x=1 printf $(pwd) printf
+		test | echo | done echo && 'quoted text' sed && awk /usr/bin cd | /usr/bin
+	printf --verbose ${HOME} printf
+then $(pwd) printf "$@" awk ${HOME} readonly | 'quoted text' test then "$1"
+		"$@" && export sed test 'quoted text' $(pwd)
+	'quoted text' done grep --verbose readonly | then ${HOME} echo --verbose --verbose
+'quoted text' printf | sed cd grep then echo awk test awk /usr/bin export done
+test 2>/dev/null -eu x=1 grep ${HOME}
+x=1 /usr/bin export "$@" 2>/dev/null export
+	grep ${HOME} --verbose --verbose cd then test echo &&
+		$(pwd) $(pwd) local then ${HOME} 2>/dev/null
+done grep $(pwd) grep local && export -eu x=1
+		'quoted text' then | printf -eu /usr/bin awk -eu $(pwd)
+	$(pwd) awk 2>/dev/null "$@" && sed
+	printf | grep cd local sed readonly --verbose sed
+		"$@" awk -eu test /usr/bin done "$1" grep readonly awk cd done
+| "$@" then "$1" ${HOME} -eu
+'quoted text' "$1" export grep && "$@" && awk grep ${HOME} cd $(pwd)
+	awk ${HOME} cd printf $(pwd) | echo "$@"
+		printf readonly local then awk "$@" awk ${HOME} grep
+	then readonly -eu cd 2>/dev/null echo done ${HOME} -eu $(pwd)
+/usr/bin local grep "$1" echo -eu printf x=1 /usr/bin
+	/usr/bin readonly readonly cd "$@" grep --verbose 2>/dev/null echo
+"$1" 2>/dev/null test "$@" cd 2>/dev/null -eu 2>/dev/null
+	'quoted text' /usr/bin /usr/bin | && /usr/bin export x=1
+		local sed echo done done export --verbose $(pwd) "$@" sed $(pwd) 2>/dev/null
+	${HOME} 'quoted text' 2>/dev/null local --verbose
+	"$1" 'quoted text' -eu done
+	'quoted text' x=1 2>/dev/null
+$(pwd) test x=1 ${HOME} | echo awk /usr/bin local
+sed then 2>/dev/null ${HOME} --verbose echo
+	--verbose -eu 2>/dev/null echo 'quoted text' x=1 ${HOME} awk printf local
+&& 'quoted text' "$1" "$@" printf then | test "$@" /usr/bin cd
+awk $(pwd) ${HOME} "$1" "$1" | sed printf awk
+export local 2>/dev/null then x=1 test sed
+	then && readonly done ${HOME} "$1" -eu cd then export ${HOME} -eu | 2>/dev/null
+cd local printf ${HOME} x=1 | "$1" x=1 --verbose export | | "$@" --verbose
+echo x=1 awk /usr/bin done | readonly sed 'quoted text' grep sed --verbose
+		--verbose --verbose awk 2>/dev/null grep $(pwd)
+awk echo $(pwd) done | ${HOME} 2>/dev/null -eu && | --verbose 'quoted text'
+		cd cd done cd $(pwd) 2>/dev/null
+		printf then | $(pwd) export echo sed done -eu "$1" "$1"
+sed "$@" done $(pwd) cd /usr/bin test ${HOME} && awk local
+export | /usr/bin /usr/bin test |
+| cd local echo | cd x=1 "$1" export local
+	grep $(pwd) cd cd local | x=1
+		cd printf grep printf test export readonly export "$1" x=1
+		"$@" done then && test ${HOME} readonly
+readonly done "$1" test --verbose done | done
+		x=1 'quoted text' -eu printf grep && "$1" cd echo printf | readonly "$1" 'quoted text'
+		/usr/bin x=1 -eu grep -eu | local
+		cd "$1" --verbose export
+| test /usr/bin then 2>/dev/null awk ${HOME} -eu $(pwd) then $(pwd) test grep $(pwd)
+cd 'quoted text' | then grep /usr/bin test cd then -eu
+x=1 local -eu "$@" sed export then "$@" done test awk grep export local
+		"$@" readonly --verbose done ${HOME}
+		sed "$@" ${HOME} -eu -eu sed grep readonly test x=1 export ${HOME}
+		x=1 --verbose echo && 'quoted text'
+export echo /usr/bin 2>/dev/null ${HOME} cd test --verbose
+		export export sed 'quoted text' echo "$1" $(pwd) local done --verbose | grep
+	'quoted text' --verbose then $(pwd) --verbose readonly local sed awk sed ${HOME}
+local sed printf echo then --verbose grep ${HOME}
+	$(pwd) ${HOME} x=1 "$@" then export "$@" local sed then
+printf "$1" cd /usr/bin test awk | 'quoted text' local readonly local | "$@" 2>/dev/null
+x=1 test local --verbose $(pwd)
+"$1" $(pwd) echo awk 'quoted text' x=1 then sed export 'quoted text' awk "$@"
+	readonly test x=1 awk cd 'quoted text'
+		${HOME} then "$1" && then then "$@" /usr/bin
+		test then then grep local --verbose done -eu "$@"
+		-eu awk export "$1" -eu test $(pwd) printf done
+	test cd "$1" grep -eu
+then then 'quoted text' -eu echo test /usr/bin 'quoted text' cd
+		-eu ${HOME} 2>/dev/null export test cd -eu cd awk x=1
+	--verbose test sed sed cd local
+export "$@" done test local cd "$@" --verbose &&
+	test 2>/dev/null $(pwd) 2>/dev/null | --verbose grep
+"$@" done export | grep echo | readonly ${HOME}
+done "$1" 2>/dev/null grep cd awk 'quoted text' printf grep "$1"
+	"$1" then $(pwd) printf done test x=1
+		| sed done | awk printf 'quoted text'
+		cd "$@" && done | --verbose /usr/bin
+		done --verbose export 2>/dev/null readonly sed 2>/dev/null
+"$@" local $(pwd) grep
+		test export local "$1" then readonly readonly grep
+x=1 -eu -eu test "$@" done grep "$@" local x=1 sed grep "$@" export ${HOME}
+	"$1" grep 2>/dev/null echo local local 'quoted text'
+	printf done readonly && awk
+| readonly printf done && | 'quoted text' /usr/bin awk local test then 'quoted text'
+/usr/bin && && /usr/bin &&
+	$(pwd) && $(pwd) local x=1 $(pwd)
+	cd 'quoted text' "$@" 2>/dev/null sed | printf printf cd ${HOME}
+		awk echo "$1" 'quoted text' done test grep printf 'quoted text' -eu ${HOME}
+	test "$1" 'quoted text' $(pwd) sed --verbose
+		${HOME} echo export export readonly
+	| -eu local then 2>/dev/null
+	| readonly --verbose awk printf x=1 cd 'quoted text' local /usr/bin && readonly
+	x=1 $(pwd) ${HOME} local "$@" "$1" then -eu 2>/dev/null
+done && done export | test awk &&
+	echo 2>/dev/null "$1" awk local then awk cd 'quoted text'
+		grep ${HOME} && then /usr/bin test 2>/dev/null awk | done $(pwd) ${HOME}
+2>/dev/null awk grep sed x=1 local cd printf grep | printf && readonly "$1" awk
+		-eu -eu /usr/bin "$1" export $(pwd) echo echo -eu 'quoted text'
+		then x=1 "$1" && test | local local readonly printf "$@" && done sed | test
+		2>/dev/null && | sed readonly
+		"$@" then test $(pwd) /usr/bin $(pwd) x=1 echo awk cd printf grep /usr/bin
+		$(pwd) local --verbose ${HOME} readonly 2>/dev/null grep --verbose
+--verbose cd cd echo test local export "$@" -eu | $(pwd)
+		local --verbose -eu -eu readonly sed $(pwd)
+	awk 2>/dev/null cd readonly then | && ${HOME}
+		grep awk test -eu "$1" printf /usr/bin
+	done cd sed readonly awk | ${HOME} | cd && $(pwd) -eu local awk
+	${HOME} 2>/dev/null "$@" ${HOME}
+	printf "$@" then x=1 local /usr/bin test
+		'quoted text' printf grep -eu cd 'quoted text' test cd && | test done "$@"
+readonly printf -eu $(pwd) then "$1" printf then | echo -eu grep
+done "$1" printf local 2>/dev/null done printf echo
+	-eu "$1" $(pwd) 2>/dev/null $(pwd) /usr/bin sed 2>/dev/null
+	then then && awk then echo --verbose
+--verbose then "$@" --verbose echo awk | 2>/dev/null export
+	/usr/bin local done -eu printf "$1" "$@" 'quoted text'
+	readonly export 2>/dev/null sed --verbose echo
+		test --verbose x=1 -eu cd -eu 2>/dev/null ${HOME} then
+2>/dev/null --verbose
+	printf printf ${HOME} done done done 'quoted text' grep x=1 |
+| test then cd x=1 sed cd -eu "$@" test -eu /usr/bin test
+test printf x=1 ${HOME} sed -eu --verbose
+/usr/bin "$1" -eu --verbose awk readonly grep | x=1 done
+	then grep test && -eu ${HOME} | sed cd grep "$1" "$1" echo then
+		sed --verbose cd echo "$@" done x=1 cd
+		cd "$@" then "$1" -eu test && echo grep ${HOME} sed readonly /usr/bin
+then readonly cd test test export done awk readonly
+		export export "$1" --verbose
+		"$@" readonly "$1" done --verbose
+"$1" test sed "$1" export local "$1" done awk then
+	test $(pwd) ${HOME} cd echo test readonly
+awk export 'quoted text' sed export && local export awk awk
+	cd awk awk grep "$1" printf 2>/dev/null test ${HOME} "$@" ${HOME} printf
+		cd printf export readonly
+| /usr/bin x=1 && test cd x=1 done "$1" | readonly test
+		/usr/bin /usr/bin "$1" local ${HOME} export x=1 then grep
+	$(pwd) $(pwd) done readonly
+	x=1 printf "$1" cd grep 'quoted text' -eu "$1" 2>/dev/null "$@" local echo
+		/usr/bin /usr/bin done x=1 'quoted text' awk cd | echo export test then readonly
+	/usr/bin readonly "$@" | $(pwd) ${HOME} grep printf sed "$@" sed printf grep
+		local export echo "$1" echo | && awk "$1" sed
+		local cd printf | local cd done cd cd local 2>/dev/null done
+		$(pwd) /usr/bin $(pwd) export /usr/bin sed
+		--verbose readonly "$@" test "$@"
+--verbose local ${HOME} 2>/dev/null test
+	done test echo printf ${HOME} cd
+	grep test done readonly "$@" 2>/dev/null cd printf cd then
+readonly cd echo local test "$@" export cd sed cd "$1" awk
+	done x=1 export | local then then /usr/bin sed --verbose
+| /usr/bin ${HOME} test grep "$@" local /usr/bin && sed local printf grep x=1
+export echo /usr/bin export $(pwd) test $(pwd) --verbose done && awk 2>/dev/null
+	x=1 readonly grep $(pwd) -eu $(pwd) echo grep "$1" 'quoted text' ${HOME}
+	${HOME} 'quoted text' echo printf
+		test then awk "$1" test 2>/dev/null
+&& "$1" awk ${HOME} "$@" | "$@" printf $(pwd) 'quoted text'
+	| readonly -eu 'quoted text' export "$1" --verbose
+echo $(pwd) grep cd echo "$1" && x=1 cd 'quoted text' "$@" then
+| --verbose done sed --verbose
+	&& sed --verbose ${HOME} x=1 ${HOME} readonly -eu x=1
+'quoted text' grep 2>/dev/null 'quoted text'
+	grep sed export export 2>/dev/null
+| $(pwd) ${HOME} -eu cd -eu | local 2>/dev/null sed ${HOME}
+	readonly "$1" $(pwd)
+		sed printf grep readonly /usr/bin grep "$1" "$1" 'quoted text' --verbose echo --verbose
+done test local export cd "$@" "$@" then grep awk cd awk awk echo
+		&& --verbose -eu echo 'quoted text' done done grep done printf
+		echo test ${HOME} cd done
+${HOME} echo test done then "$@" --verbose $(pwd) local awk
+		export -eu grep | | -eu ${HOME} grep $(pwd) done 2>/dev/null local | |
+	/usr/bin $(pwd) done x=1 printf echo $(pwd) cd --verbose readonly x=1 done
+		then x=1 grep "$@" | 'quoted text' x=1
+	'quoted text' "$1" sed cd grep -eu done done
+2>/dev/null grep -eu | ${HOME} sed -eu 2>/dev/null
+-eu cd "$@" /usr/bin awk $(pwd) ${HOME} readonly local
+		$(pwd) done ${HOME} && --verbose "$@" && local 'quoted text'
+--verbose ${HOME} -eu printf 2>/dev/null grep
+		"$1" --verbose -eu /usr/bin
+	-eu test sed $(pwd) x=1 local
+then cd test printf test "$@" "$@" /usr/bin $(pwd) then 'quoted text' readonly
+	cd | /usr/bin "$1" cd $(pwd) cd x=1 sed 'quoted text'
+	local grep echo | cd test local 2>/dev/null export awk then | "$@" done ${HOME}
+cd awk | 2>/dev/null test $(pwd)
+"$@" $(pwd) readonly cd x=1 cd grep && "$1" /usr/bin printf echo local "$1"
+sed -eu awk | "$@" awk 'quoted text' /usr/bin --verbose ${HOME} readonly "$1"
+	-eu grep | grep done printf && $(pwd) printf cd | "$1" then sed readonly $(pwd)
+		cd readonly ${HOME} export sed -eu local "$@" sed echo --verbose | "$@"
+	sed then | readonly then echo sed x=1 cd ${HOME} 'quoted text' "$1"
+		'quoted text' 'quoted text' done test $(pwd) $(pwd) x=1
+	echo export && then readonly echo --verbose 'quoted text'
+printf then done export cd test && /usr/bin &&
+	"$1" readonly grep cd readonly | then --verbose awk 2>/dev/null grep | ${HOME}
+		2>/dev/null $(pwd) x=1 cd /usr/bin done && done export
+		${HOME} 'quoted text' done then test echo export grep "$@"
+		'quoted text' done export "$1" readonly echo sed echo && | 'quoted text'
+		sed grep grep done && "$@" | local
+		cd awk grep /usr/bin &&
+	&& "$@" awk printf ${HOME} echo sed && && 2>/dev/null then ${HOME} "$@" sed
+		readonly "$@" ${HOME} export export awk -eu local local x=1 --verbose printf x=1
+'quoted text' export sed --verbose cd export then ${HOME} test
+| local sed local x=1 export then 'quoted text'
+	"$1" export "$@" && printf cd "$@" $(pwd) 'quoted text'
+		"$1" $(pwd) -eu && then readonly echo ${HOME} && cd printf $(pwd) x=1 readonly
+		sed "$1" -eu cd 2>/dev/null -eu export done echo /usr/bin sed done
+	printf "$1" sed sed grep -eu /usr/bin local ${HOME} cd && 'quoted text' ${HOME}
+		--verbose cd test --verbose export && "$1" grep cd sed
+		grep awk --verbose && --verbose $(pwd)
+	x=1 readonly 'quoted text' local then --verbose echo grep /usr/bin /usr/bin
+${HOME} ${HOME} /usr/bin /usr/bin | $(pwd)
+done grep ${HOME} sed /usr/bin
+grep then 'quoted text' echo echo sed ${HOME}
+		$(pwd) 2>/dev/null --verbose | "$1" cd test local 2>/dev/null --verbose
+		printf x=1 then | -eu x=1 ${HOME} /usr/bin 'quoted text' 2>/dev/null
+x=1 grep awk printf "$1" echo echo
+	cd export /usr/bin | | cd grep -eu | $(pwd) export -eu 'quoted text' ${HOME} x=1
+		"$@" export cd -eu | then
+	readonly done local done "$@" grep grep sed -eu printf cd "$1" printf done x=1 -eu
+/usr/bin export | $(pwd) 'quoted text'
+	| awk x=1 --verbose $(pwd)
+&& grep && 2>/dev/null grep awk grep sed ${HOME} --verbose
+readonly && "$@" test then awk sed test "$@" cd test 'quoted text'
+awk sed --verbose done export $(pwd) x=1 "$@" cd local
+	sed ${HOME} printf | | grep test test 2>/dev/null 2>/dev/null && readonly
+	then x=1 'quoted text' awk grep ${HOME} done --verbose grep grep $(pwd) $(pwd) then
+readonly awk 2>/dev/null /usr/bin && local awk && then /usr/bin
+2>/dev/null then test 'quoted text'
+	"$1" ${HOME} readonly grep cd 'quoted text' awk "$@" sed "$@" --verbose grep
+		x=1 awk "$@" -eu echo $(pwd) export awk export done
+| && 2>/dev/null grep cd local done && grep "$@" export awk
+		printf then printf "$1" sed --verbose
+		readonly | -eu done && done
+	2>/dev/null --verbose
+		then printf "$@" 2>/dev/null ${HOME} ${HOME} echo 'quoted text' grep
+'quoted text' echo "$@" done export 2>/dev/null echo x=1
+	"$@" cd "$@" "$@" done echo cd --verbose readonly 'quoted text' grep
+	local awk export echo && done echo 2>/dev/null "$@" ${HOME}
+		awk "$1" $(pwd) --verbose cd grep local "$@" sed ${HOME} readonly
+	--verbose x=1 echo printf awk grep printf && --verbose
+export -eu "$1" awk 2>/dev/null -eu 2>/dev/null "$@" "$@" --verbose awk echo
+then awk --verbose ${HOME}
+	then x=1 awk sed 'quoted text' "$1" awk printf grep "$1" echo echo
+x=1 -eu printf then $(pwd) "$@" printf $(pwd) $(pwd) printf then /usr/bin
+		awk grep $(pwd) ${HOME} x=1 done 2>/dev/null printf export
+&& readonly | echo sed -eu echo grep ${HOME}
+	$(pwd) done grep readonly && grep then export
+grep awk "$1" done grep readonly sed echo echo "$1" /usr/bin sed $(pwd) |
+cd sed 2>/dev/null "$@" export --verbose local printf then && ${HOME}
+	echo local sed x=1 x=1 | "$1" "$@" /usr/bin x=1 done 'quoted text'
+	'quoted text' -eu && export printf export sed awk local awk sed
+then 2>/dev/null x=1 | then $(pwd) && "$@" /usr/bin awk "$@"
+	--verbose 'quoted text' awk sed --verbose sed echo
+	echo $(pwd) local -eu grep -eu local /usr/bin && grep -eu "$@"
+	grep awk -eu "$1" test local | export local echo done x=1 echo 'quoted text'
+-eu printf test -eu --verbose export && done test sed readonly 2>/dev/null ${HOME}
+	--verbose | readonly cd $(pwd) local -eu $(pwd) export cd local sed $(pwd)
+$(pwd) "$@" x=1 -eu --verbose
+	-eu 'quoted text' "$@" export readonly sed
+cd sed | test sed awk readonly
+		-eu --verbose cd ${HOME} x=1 "$1" test grep sed 2>/dev/null
+	cd -eu printf x=1 grep | test grep local sed done x=1 test done local
+done "$1" 2>/dev/null printf local test echo ${HOME} readonly --verbose done "$1"
+		${HOME} then "$@" test | grep x=1 x=1 /usr/bin && echo "$1" cd cd readonly
+		--verbose && 'quoted text' x=1 done &&
+	done 'quoted text' --verbose printf --verbose
+		/usr/bin -eu -eu && sed sed done $(pwd) 2>/dev/null readonly test awk grep |
+x=1 x=1 | printf cd local test
+export printf "$@" && sed done 2>/dev/null awk "$@"
+	--verbose then "$@" 'quoted text' export grep then $(pwd) | x=1 awk
+readonly "$1" $(pwd) -eu 2>/dev/null -eu readonly then
+	&& cd echo "$@" sed | $(pwd)
+	-eu $(pwd) -eu export awk "$1" -eu export "$@" grep awk echo
+	| -eu x=1 printf 2>/dev/null local $(pwd)
+export local grep then
+		x=1 /usr/bin 'quoted text' grep 2>/dev/null | test sed printf 'quoted text'
+then export "$1" printf test
+--verbose local printf cd --verbose ${HOME} then "$@" /usr/bin local test 2>/dev/null
+	"$1" sed grep sed sed
+2>/dev/null $(pwd) && -eu "$@"
+	"$1" done then export "$@" done export grep test readonly
+"$@" test test sed awk printf test -eu grep cd | then -eu x=1 then local "$@"
+grep local local 'quoted text' grep |
+test done printf -eu | | readonly $(pwd) 'quoted text' 'quoted text'
+--verbose awk done 'quoted text' export readonly
+"$@" test ${HOME} "$1" -eu done sed &&
+		echo "$@" 2>/dev/null printf "$1" $(pwd) 2>/dev/null done
+echo grep echo sed awk done "$1" awk x=1
+		x=1 echo "$1" echo local printf
+		&& test readonly awk "$@" export sed | readonly cd local export
+awk cd then done local grep |
+		x=1 "$1" test 'quoted text'
+grep readonly && printf
+	sed x=1 local printf | -eu "$@" $(pwd) "$1" done
+| && sed echo "$1" --verbose 2>/dev/null 2>/dev/null ${HOME} cd echo
+		/usr/bin done | done /usr/bin echo local --verbose 'quoted text' test grep echo
+		-eu grep test 'quoted text' awk cd /usr/bin
+	"$1" readonly && x=1 done sed local local awk cd sed done
+		echo sed printf --verbose awk $(pwd) "$@" 'quoted text' 'quoted text' 2>/dev/null
+	/usr/bin -eu /usr/bin local printf
+	| x=1 /usr/bin $(pwd) | "$1"
+	$(pwd) "$1" done "$1" ${HOME} test && x=1 test "$@" export ${HOME}
+readonly sed cd readonly sed grep -eu awk sed ${HOME} printf ${HOME}
+grep /usr/bin x=1 done local test "$@" 'quoted text' x=1 sed 2>/dev/null
+"$@" sed /usr/bin local && test $(pwd) ${HOME} grep --verbose "$@"
+	grep -eu then local then local then done -eu 2>/dev/null cd printf printf
+		"$@" echo | && cd "$1" sed cd then cd export test readonly -eu 2>/dev/null
+	x=1 --verbose $(pwd) local local x=1 /usr/bin
+	sed printf 2>/dev/null $(pwd) test ${HOME} | then $(pwd) sed echo
+x=1 | -eu x=1 /usr/bin then --verbose $(pwd) then grep local
+	grep -eu printf && sed 2>/dev/null printf test grep then test awk cd x=1
+/usr/bin export "$@" 'quoted text' local /usr/bin printf ${HOME} sed done
+test local 'quoted text' "$@" -eu printf test export test
+	$(pwd) test grep | awk test $(pwd) then
+	| readonly $(pwd) && -eu printf && cd sed readonly && local "$1" printf ${HOME}
+sed $(pwd) then grep export then x=1 export export grep then grep "$1" test "$@"
+-eu awk awk 'quoted text' 2>/dev/null sed && sed awk
+		2>/dev/null awk --verbose --verbose
+&& x=1 "$1" 'quoted text'
+"$1" | sed readonly | "$1" awk sed x=1 $(pwd) sed then $(pwd) /usr/bin sed sed
+	readonly done echo "$1"
+		done | printf && x=1 echo | sed && sed done --verbose "$1" 2>/dev/null $(pwd)
+		-eu | sed done 2>/dev/null
+		&& readonly --verbose ${HOME}
+		&& then done /usr/bin local | grep cd printf x=1 cd printf $(pwd) $(pwd) awk then
+	then test export echo test $(pwd) | ${HOME} --verbose readonly
+		'quoted text' done local local local done
+	-eu 'quoted text' | sed export done $(pwd) x=1 | readonly printf done grep
+	${HOME} export --verbose local /usr/bin
+local grep | test && local export | awk echo sed && cd -eu
+		2>/dev/null 'quoted text' "$@" --verbose /usr/bin then /usr/bin --verbose -eu
+		export /usr/bin export sed sed x=1 then && export $(pwd)
+'quoted text' /usr/bin test /usr/bin 'quoted text' x=1 "$@" grep /usr/bin
+| "$1" then readonly && 2>/dev/null && "$@"
+		/usr/bin sed -eu export ${HOME} $(pwd) /usr/bin cd sed printf -eu | /usr/bin
+export /usr/bin $(pwd) printf sed 2>/dev/null cd ${HOME} ${HOME}
+	"$1" && x=1 'quoted text'
+		${HOME} ${HOME} /usr/bin 2>/dev/null |
+	&& awk && | local /usr/bin
+test readonly ${HOME} && $(pwd) printf --verbose printf 2>/dev/null x=1 cd
+-eu done awk ${HOME} done "$@" --verbose
+		$(pwd) "$1" | /usr/bin x=1 local | -eu done -eu "$1"
+		sed export done ${HOME} /usr/bin printf /usr/bin cd local local
+		echo readonly && 'quoted text' printf sed x=1 x=1 done then --verbose test grep
+	${HOME} grep done sed echo grep awk echo then -eu
+	grep then $(pwd) local /usr/bin
+	done cd printf readonly printf "$1" ${HOME} x=1 awk awk 'quoted text' | /usr/bin
+	| sed printf 'quoted text' /usr/bin printf local $(pwd) &&
+	${HOME} 2>/dev/null -eu done /usr/bin && echo grep "$1" printf test && test
+		sed /usr/bin test 'quoted text' test
+	"$@" sed --verbose local | 'quoted text' "$@" -eu "$1" then "$@"
+	printf "$1" -eu ${HOME}
+	readonly test cd | echo echo
+--verbose --verbose $(pwd) $(pwd) && test -eu 2>/dev/null
+| ${HOME} 2>/dev/null x=1 -eu --verbose done --verbose test x=1 echo printf
+cd test --verbose x=1 ${HOME}
+-eu echo "$1" "$@" x=1 awk test awk echo sed awk printf echo && done printf
+	2>/dev/null readonly awk "$1" "$@" cd "$1" /usr/bin -eu
+readonly sed "$@" 'quoted text' readonly test awk export $(pwd) 'quoted text'
+	$(pwd) test cd --verbose local export echo
+	grep && "$@" ${HOME} grep --verbose
+	/usr/bin "$@" done 2>/dev/null ${HOME}
+	cd printf -eu --verbose
+		&& 2>/dev/null ${HOME} | awk x=1 echo $(pwd) $(pwd) "$1" /usr/bin readonly printf
+		'quoted text' done x=1 grep grep test test -eu 'quoted text'
+	${HOME} export x=1 "$1" | test local $(pwd) cd "$@" 2>/dev/null
+		sed readonly -eu done -eu "$@" | grep
+		done x=1 -eu $(pwd) x=1 2>/dev/null export ${HOME}
+	--verbose grep done awk && sed | ${HOME}
+-eu export cd $(pwd) 2>/dev/null | "$1" $(pwd)
+	readonly 'quoted text' readonly | export
+		'quoted text' sed -eu readonly 2>/dev/null $(pwd)
+printf readonly -eu grep --verbose cd printf done
+	"$1" sed "$@" x=1 $(pwd) x=1 2>/dev/null done
+cd printf "$1" readonly awk sed /usr/bin cd done printf ${HOME}
+		done then export readonly -eu | --verbose test local
+		done | "$@" printf printf readonly ${HOME}
+		export | done printf export --verbose then
+	"$1" 2>/dev/null ${HOME}
+done | done cd 'quoted text' grep "$1" ${HOME}
+"$1" /usr/bin readonly /usr/bin echo 'quoted text' grep
+--verbose grep printf -eu $(pwd) ${HOME} cd $(pwd)
+		echo "$1" --verbose $(pwd) printf awk "$1" x=1 test grep
+	cd "$1" cd printf printf cd test 2>/dev/null export -eu ${HOME} 'quoted text'
+	test | /usr/bin cd /usr/bin echo export awk /usr/bin readonly sed export
+test 2>/dev/null ${HOME} -eu /usr/bin
+/usr/bin sed /usr/bin then
+	"$@" | 2>/dev/null printf printf local 'quoted text' then
+		grep "$1" test && 'quoted text'
+	$(pwd) cd export then then "$1" x=1 local "$@" && local echo test ${HOME}
+	--verbose cd /usr/bin done then export readonly then --verbose /usr/bin
+		printf $(pwd) 'quoted text' $(pwd) /usr/bin then "$1" grep 'quoted text'
+		"$1" 'quoted text' test ${HOME} && readonly "$1"
+		"$@" local then $(pwd) sed -eu printf echo sed 2>/dev/null
+/usr/bin local "$@" "$@" grep x=1
+	local "$1" test test 'quoted text'
+		-eu 2>/dev/null readonly --verbose --verbose 2>/dev/null -eu export x=1 local
+		${HOME} ${HOME} cd ${HOME} | done | && sed local done awk |
+		cd readonly test echo echo local echo local 'quoted text'
+		--verbose -eu | printf cd "$@" awk test 'quoted text'
+		--verbose "$@" $(pwd) readonly printf x=1
+-eu 2>/dev/null export 2>/dev/null echo done "$@" && $(pwd) "$@"
+-eu /usr/bin /usr/bin $(pwd) cd "$1" grep cd --verbose
+	grep /usr/bin sed sed 2>/dev/null sed -eu grep --verbose &&
+		x=1 grep /usr/bin "$1" grep then | "$1" "$@"
+-eu $(pwd) grep 2>/dev/null | export awk | then then "$1"
+	readonly local "$@" 'quoted text' "$1"
+	cd --verbose cd sed 2>/dev/null echo sed local echo --verbose
+2>/dev/null x=1 "$1" cd done | -eu awk test $(pwd)
+grep "$1" -eu export 2>/dev/null "$@" ${HOME}
+	then x=1 -eu "$1" /usr/bin test cd && | "$@" cd 2>/dev/null
+		"$@" export done "$1" sed printf "$@" 2>/dev/null
+		cd "$1" then -eu "$@" -eu | export
+-eu echo printf $(pwd) printf printf -eu printf printf
+--verbose 2>/dev/null local ${HOME} then grep readonly readonly
+	then export 2>/dev/null sed then $(pwd) && /usr/bin x=1
+| printf $(pwd) | /usr/bin cd "$1"
+/usr/bin | ${HOME} 'quoted text' then echo "$@" readonly
+		sed | cd $(pwd) sed done -eu grep -eu | -eu "$1" cd
+sed "$@" 'quoted text' -eu readonly "$@" --verbose ${HOME} done awk done then local
+		local --verbose "$1" readonly sed export
+readonly 'quoted text' readonly /usr/bin "$1"
+		printf x=1 awk "$1" | sed --verbose then export $(pwd)
+	local echo 'quoted text' printf echo --verbose
+	cd ${HOME} awk then --verbose
+		2>/dev/null ${HOME} export done | local ${HOME} 2>/dev/null $(pwd) $(pwd) ${HOME}
+readonly then cd export x=1 'quoted text' sed done test
+		sed grep grep grep export cd local
+then x=1 ${HOME} then | awk /usr/bin
+local "$@" then x=1 /usr/bin ${HOME} && |
+printf "$@" | -eu local readonly grep sed -eu done export 'quoted text' "$@"
+	sed test && && grep echo test $(pwd) "$1" -eu 'quoted text'
+readonly "$1" 'quoted text'
+		done cd echo 'quoted text' ${HOME}
+"$@" x=1 grep test ${HOME} -eu export -eu done $(pwd) 'quoted text'
+| $(pwd) ${HOME} cd $(pwd) 'quoted text' /usr/bin -eu sed done 'quoted text'
+sed ${HOME} then grep -eu && awk echo done 'quoted text' export
+		2>/dev/null echo then
+	"$1" | x=1 done 2>/dev/null test /usr/bin | 2>/dev/null printf "$1"
+		"$1" done then 2>/dev/null printf 2>/dev/null readonly
+	grep -eu grep then ${HOME} x=1 grep printf test printf --verbose
+	${HOME} printf readonly then
+	echo ${HOME} x=1 /usr/bin $(pwd) | test "$1" printf test ${HOME}
+	$(pwd) "$1" $(pwd) "$1" awk
+	&& ${HOME} then /usr/bin
+	2>/dev/null 2>/dev/null
+awk "$1" sed export then local readonly grep | test x=1
+	| $(pwd) echo echo 'quoted text' grep local && && "$@" sed && x=1 $(pwd) then
+		/usr/bin awk local test ${HOME} x=1 --verbose sed export echo cd printf cd
+-eu 2>/dev/null 2>/dev/null ${HOME} awk /usr/bin test 2>/dev/null /usr/bin done
+		${HOME} $(pwd) sed ${HOME}
+readonly 'quoted text' readonly $(pwd) 2>/dev/null "$@" cd echo x=1 $(pwd)
+sed -eu ${HOME} -eu "$1" test awk
+		--verbose "$@" export | x=1 /usr/bin /usr/bin "$@"
+		awk "$1" readonly then done sed test
+		awk grep export 2>/dev/null "$@" echo --verbose && grep x=1 awk ${HOME} --verbose
+		| then awk x=1 readonly
+		echo test | ${HOME} grep $(pwd)
+--verbose ${HOME} --verbose -eu grep export grep && --verbose
+		2>/dev/null -eu awk | export && 2>/dev/null
+		grep readonly export printf
+	--verbose sed 2>/dev/null
+"$1" test && export readonly 2>/dev/null awk x=1 echo grep test export
+/usr/bin grep export test cd $(pwd)
+	'quoted text' x=1 'quoted text' -eu sed && grep readonly
+		'quoted text' x=1 readonly 'quoted text' -eu readonly export
+		${HOME} readonly --verbose awk x=1 -eu x=1 then $(pwd)
+		x=1 "$@" --verbose echo sed
+	x=1 done 'quoted text' $(pwd)
+$(pwd) cd export readonly test awk echo done 'quoted text' 2>/dev/null
+grep export awk export sed 'quoted text'
+		then "$1" then local grep
+| readonly readonly && --verbose -eu x=1
+	/usr/bin 2>/dev/null then echo --verbose export done echo grep |
+	printf && x=1 x=1 $(pwd) 2>/dev/null $(pwd) 2>/dev/null "$1" sed local ${HOME}
+		2>/dev/null && local "$1" "$1" awk ${HOME} --verbose
+"$@" && 'quoted text' test then done done /usr/bin
+		test -eu local done x=1 test grep export /usr/bin
+		done "$1" sed "$1" grep "$@" awk readonly done local -eu test
+		/usr/bin x=1 2>/dev/null echo printf printf cd test
+-eu "$@" done 'quoted text' test --verbose -eu
+${HOME} awk cd sed x=1 ${HOME} grep echo $(pwd) local printf ${HOME} "$@" ${HOME}
+		"$@" readonly "$@" -eu
+"$@" ${HOME} 2>/dev/null grep echo | --verbose 2>/dev/null
+		"$1" local readonly test awk grep
+	$(pwd) sed cd $(pwd) 2>/dev/null 2>/dev/null
+	echo local "$@" readonly export sed local 2>/dev/null
+	-eu then ${HOME} 'quoted text' ${HOME} export $(pwd) grep readonly
+x=1 /usr/bin ${HOME} export
+		export printf 2>/dev/null
+"$1" awk /usr/bin awk grep
+		-eu export awk export export
+	x=1 done -eu cd cd "$@" -eu printf --verbose
+	test ${HOME} ${HOME} 'quoted text'
+2>/dev/null 'quoted text' && --verbose sed export awk
+	/usr/bin then export readonly && "$1" test grep test ${HOME} $(pwd)
+"$1" awk test echo awk
+2>/dev/null local --verbose local done printf readonly
+&& printf printf sed ${HOME} && 2>/dev/null
+grep | "$1" $(pwd) done x=1 cd cd -eu -eu done 2>/dev/null sed
+	'quoted text' export ${HOME}
+		"$1" | done "$1" | grep x=1 grep 'quoted text'
+		| --verbose ${HOME} local x=1 $(pwd) /usr/bin then done sed test x=1
+		local grep cd -eu awk "$1" | awk $(pwd) &&
+	export && sed readonly $(pwd) cd awk
+	test "$@" printf then 'quoted text'
+		test done then x=1 $(pwd) echo
+		printf grep | echo 2>/dev/null
+		done readonly done then test "$@"
+		x=1 && x=1 export 'quoted text' |
+		&& "$@" | local done | done readonly /usr/bin && 2>/dev/null then readonly
+&& grep 'quoted text' 2>/dev/null
+		"$@" -eu | -eu | "$@" awk /usr/bin 2>/dev/null done
+	--verbose readonly "$@" echo $(pwd) test cd --verbose ${HOME} -eu
+	/usr/bin --verbose readonly printf "$1" local
+-eu readonly export awk awk x=1 sed
+		"$1" printf x=1 /usr/bin cd ${HOME} export cd | awk done test |
+		&& -eu 2>/dev/null "$@" test awk ${HOME} "$@" readonly 'quoted text' then
+	--verbose printf echo "$@" ${HOME} then sed $(pwd)
+x=1 | printf 2>/dev/null "$@" then
+		-eu 2>/dev/null 2>/dev/null cd echo done readonly $(pwd) | 2>/dev/null
+	grep 'quoted text' 2>/dev/null cd -eu then grep sed ${HOME}
+| readonly printf local awk cd then
+		2>/dev/null $(pwd) echo ${HOME} grep test x=1 2>/dev/null
+then echo test x=1 'quoted text' echo /usr/bin 'quoted text' x=1 sed
+		sed $(pwd) test ${HOME}
+		sed --verbose "$1" test grep cd awk grep
+	"$@" grep local printf "$@" printf 2>/dev/null
+		"$1" x=1 /usr/bin --verbose ${HOME} 'quoted text'
+		export -eu cd then -eu ${HOME} | readonly printf
+export --verbose done | cd printf test x=1 "$1" local && "$@" awk | grep done
+sed grep grep local $(pwd) echo then then export
+	/usr/bin --verbose 2>/dev/null
+	cd printf $(pwd) sed echo /usr/bin
+"$1" "$@" then local "$1" 'quoted text' "$@" sed readonly test sed awk test test
+| grep x=1 local cd grep $(pwd) 2>/dev/null
+sed sed "$@" -eu grep 'quoted text'
+	--verbose "$@" "$@" ${HOME} printf test $(pwd) -eu test "$1"
+		"$@" sed sed /usr/bin ${HOME} then readonly printf 'quoted text' | sed
+	cd printf "$1" local cd ${HOME} ${HOME} 2>/dev/null grep readonly grep x=1
+printf /usr/bin then x=1 | ${HOME} sed sed
+grep "$@" cd sed $(pwd) sed --verbose "$@" done test
+then printf x=1 printf -eu /usr/bin printf
+		&& awk done cd --verbose --verbose
+	--verbose test "$1" | printf readonly 2>/dev/null
+	| sed 'quoted text' && --verbose "$@" readonly local
+export -eu test x=1 cd export sed
+then /usr/bin $(pwd) 'quoted text'
+		grep ${HOME} printf | 2>/dev/null
+		| done x=1 export "$1" done sed cd awk export && "$@" 2>/dev/null
+$(pwd) ${HOME} grep awk export sed /usr/bin sed echo -eu
+	local 'quoted text' sed /usr/bin --verbose echo --verbose readonly "$@" -eu
+| grep local ${HOME} "$1" done ${HOME} awk
+		cd "$1" printf "$@" awk x=1 readonly && sed
+"$@" export echo ${HOME} | --verbose 'quoted text'
+$(pwd) cd "$1" grep test test && test awk && | grep | 'quoted text'
+echo /usr/bin export readonly readonly 2>/dev/null 'quoted text' && -eu cd test
+	echo 'quoted text' | $(pwd) then --verbose then ${HOME}
+		-eu x=1 cd -eu awk export ${HOME}
+"$1" ${HOME} local echo printf printf
+echo test $(pwd) export printf test 2>/dev/null 2>/dev/null cd x=1 then readonly
+&& $(pwd) test cd then local echo
+	$(pwd) --verbose ${HOME} printf
+		'quoted text' local awk echo ${HOME} 2>/dev/null done | test done then test
+	/usr/bin | /usr/bin && cd
+	/usr/bin printf done /usr/bin $(pwd)
+x=1 "$1" /usr/bin echo | awk grep
+		readonly "$@" test export cd export
+	awk sed | cd export /usr/bin
+readonly local awk "$@" /usr/bin
+		"$@" /usr/bin export cd "$1" echo awk local && $(pwd)
+	--verbose "$1" cd cd "$@" grep export x=1 ${HOME} x=1 printf echo
+		local grep done -eu --verbose -eu x=1 "$@" $(pwd) $(pwd) readonly
+	done --verbose | --verbose printf readonly
+		printf awk "$@" export printf grep "$1" grep readonly ${HOME} then | awk && awk
+		"$@" 2>/dev/null local echo x=1 'quoted text'
+	/usr/bin grep awk export awk sed cd grep | printf grep local && readonly
+/usr/bin echo sed -eu echo echo sed readonly
+		sed done 2>/dev/null awk $(pwd) && echo /usr/bin
+done ${HOME} "$1" printf printf done
+		"$@" done cd export then awk && done $(pwd) done && export "$1"
+	x=1 local x=1 2>/dev/null printf "$@" grep -eu $(pwd) readonly grep then
+$(pwd) "$1" grep cd | "$1" test cd
+		x=1 then then x=1 readonly local sed /usr/bin 2>/dev/null 2>/dev/null
+	awk then "$1" | test x=1 --verbose 'quoted text'
+		&& 2>/dev/null awk done test done done echo export --verbose
+	export $(pwd) grep | grep /usr/bin
+	awk export --verbose cd | export readonly "$@" cd x=1
+		"$@" cd "$1" 'quoted text' readonly local export local
+		2>/dev/null "$@" done -eu local export --verbose $(pwd)
+then x=1 readonly printf "$1"
+printf ${HOME} printf
+/usr/bin ${HOME} x=1 -eu echo awk test "$@" /usr/bin awk $(pwd) "$@" export
+local done ${HOME} $(pwd) test 2>/dev/null
+		"$1" awk echo awk --verbose printf awk "$1" awk | 2>/dev/null
+awk readonly readonly sed -eu
+		x=1 x=1 --verbose --verbose --verbose local | readonly "$@" && && awk
+		test readonly "$1" export /usr/bin
+		/usr/bin printf x=1 'quoted text'
+readonly printf readonly 2>/dev/null -eu "$@" 'quoted text' "$1" -eu awk
+		grep $(pwd) local then echo $(pwd) done
+		"$@" printf /usr/bin ${HOME} --verbose done sed && echo local /usr/bin readonly
+	sed sed test sed test --verbose ${HOME}
+		awk "$1" x=1 readonly grep
+| 'quoted text' "$1" sed printf "$@" "$1" && printf done
+		test echo then then 2>/dev/null "$@" $(pwd) local then readonly "$@" ${HOME} local
+	test x=1 "$@" /usr/bin
+2>/dev/null 2>/dev/null then ${HOME} | sed --verbose "$1" 2>/dev/null
+		'quoted text' local grep $(pwd) cd done then -eu 'quoted text'
+		sed ${HOME} "$1" "$1" "$@" then grep export awk done
+		printf sed --verbose ${HOME} "$@" awk echo && awk "$@" "$@"
+		export test grep x=1 printf --verbose readonly cd echo sed
+	readonly "$1" "$@" 'quoted text' /usr/bin readonly sed
+--verbose cd x=1 "$1" 2>/dev/null ${HOME} printf && 2>/dev/null readonly 2>/dev/null
+'quoted text' cd awk sed export ${HOME}
+| export local 2>/dev/null /usr/bin echo then test cd "$1" 2>/dev/null awk
+		grep /usr/bin --verbose grep && 2>/dev/null
+grep ${HOME} 'quoted text' then 2>/dev/null
+readonly -eu /usr/bin 'quoted text' $(pwd) 'quoted text' "$1" done
+	cd test ${HOME} "$@" --verbose awk /usr/bin
+		local printf echo "$1" done -eu && | echo echo 'quoted text' cd x=1 printf
+grep ${HOME} sed sed $(pwd) sed local sed x=1 awk --verbose ${HOME} test then readonly
+/usr/bin echo readonly sed x=1 "$1"
+	-eu readonly /usr/bin "$1"
+		&& $(pwd) "$@" printf export x=1 /usr/bin awk export
+printf test x=1 ${HOME} done |
+		$(pwd) readonly grep printf export export | ${HOME}
+readonly cd 'quoted text' --verbose done /usr/bin readonly
+&& --verbose readonly then local echo ${HOME}
+-eu readonly /usr/bin echo | readonly readonly && 2>/dev/null test readonly
+echo echo readonly x=1 'quoted text' readonly cd ${HOME} then /usr/bin local export
+		awk cd sed --verbose ${HOME} && test --verbose sed x=1
+-eu readonly && 'quoted text' /usr/bin x=1 x=1 awk 2>/dev/null
+then && && 'quoted text' 'quoted text' cd "$@" x=1 cd readonly sed && cd
+		sed "$@" printf sed 'quoted text' then done export export
+		sed awk done --verbose sed 'quoted text' printf && test grep grep
+	x=1 done && cd "$1" ${HOME} awk done
+	${HOME} $(pwd) 2>/dev/null awk test local test "$@"
+${HOME} 2>/dev/null local ${HOME} | readonly /usr/bin grep
+	-eu echo 'quoted text' --verbose "$1" /usr/bin "$1" echo
+	&& 2>/dev/null export cd "$@" readonly x=1 awk export cd cd then ${HOME} && ${HOME}
+		| "$1" awk | | "$1" test export /usr/bin
+		export export $(pwd) readonly export | /usr/bin
+		sed ${HOME} --verbose printf local && cd readonly export readonly x=1 cd /usr/bin
+	sed "$@" readonly x=1 echo /usr/bin
+	"$1" && ${HOME} then printf done && 2>/dev/null
+	awk x=1 | && test | printf echo sed done | "$@" -eu readonly echo
+	cd --verbose /usr/bin readonly | ${HOME} sed "$@" readonly
+/usr/bin cd readonly && then printf "$1" 'quoted text' cd local
+		done then "$@" -eu "$1" sed "$1" then 'quoted text' cd /usr/bin
+awk test done | "$1" sed grep local printf printf printf grep "$@" "$1" ${HOME}
+	done $(pwd) readonly /usr/bin cd && awk sed echo && "$@" 'quoted text' x=1 then
+	sed sed -eu sed echo /usr/bin --verbose 2>/dev/null $(pwd) 'quoted text'
+	'quoted text' cd export "$@" "$@" sed awk 'quoted text' -eu /usr/bin --verbose
+		cd x=1 2>/dev/null cd --verbose test local x=1 $(pwd) cd /usr/bin awk "$@"
+	done /usr/bin test | cd then && "$1" test -eu then x=1 && echo "$1" grep "$@"
+	"$1" done ${HOME} | $(pwd) awk echo then grep && "$1" test -eu x=1
+		printf && done && sed "$1" --verbose
+		readonly $(pwd) export "$@" "$@" "$1" $(pwd) sed local ${HOME} sed 'quoted text'
+x=1 awk "$@" cd awk grep && && sed -eu "$1"
+x=1 | sed grep sed /usr/bin cd done cd sed
+	export "$1" x=1 awk grep done "$1" --verbose export printf && sed --verbose awk
+printf then 2>/dev/null $(pwd) export
+		awk echo && cd --verbose then
+		export | /usr/bin echo "$@" -eu done cd "$@"
+		2>/dev/null 'quoted text' 'quoted text' x=1 $(pwd) && echo -eu printf
+		readonly --verbose && $(pwd) /usr/bin
+		sed | "$@" done && /usr/bin --verbose
+		-eu export sed "$1" 2>/dev/null 'quoted text'
+$(pwd) echo --verbose 'quoted text' readonly awk 2>/dev/null
+		2>/dev/null grep printf "$1" awk
+2>/dev/null printf && | export test
+	export /usr/bin readonly readonly grep test test --verbose $(pwd) $(pwd) --verbose
+	then 2>/dev/null test 'quoted text'
+	"$1" grep awk readonly awk "$@" export sed | "$@" awk --verbose
+		/usr/bin export 'quoted text' cd done readonly 'quoted text' done 'quoted text'
+cd local ${HOME} $(pwd) 2>/dev/null readonly --verbose 'quoted text'
+	test && done cd x=1 | grep && local echo local && sed readonly
+'quoted text' done "$1" export "$1" grep
+	awk local sed --verbose 2>/dev/null cd 2>/dev/null awk --verbose
+printf test "$@" x=1 readonly | readonly $(pwd)
+"$@" local local sed grep then grep export
+		sed "$1" x=1 local export local x=1 -eu readonly --verbose local local echo local
+done "$@" ${HOME} 'quoted text' readonly "$1" awk 2>/dev/null
+		| then --verbose "$@" x=1 sed x=1 /usr/bin $(pwd)
+awk "$@" $(pwd) awk printf done "$1" readonly awk /usr/bin readonly "$@"
+	echo "$1" echo export test sed 2>/dev/null /usr/bin printf
+sed x=1 "$@" 2>/dev/null 2>/dev/null grep grep 2>/dev/null then export readonly
+	export 2>/dev/null 2>/dev/null grep "$@"
+${HOME} export local echo $(pwd) ${HOME} cd printf test "$@"
+	$(pwd) readonly "$1" x=1 sed $(pwd) -eu local $(pwd)
+	'quoted text' 'quoted text' -eu awk then --verbose --verbose
+	&& grep local -eu local && done 'quoted text'
+		| "$@" x=1 cd 2>/dev/null --verbose "$@"
+${HOME} | then --verbose
+		'quoted text' done sed 2>/dev/null sed done test awk echo export | "$@"
+	--verbose 2>/dev/null "$@" 2>/dev/null ${HOME}
+		readonly -eu sed | /usr/bin x=1 --verbose test export
+		-eu cd local readonly 2>/dev/null printf printf
+		"$1" local done done printf export | "$1" grep ${HOME}
+	${HOME} -eu grep export awk 2>/dev/null
+		&& 'quoted text' done then local export
+	then done done test $(pwd) grep cd ${HOME} export local $(pwd)
+export done readonly done printf readonly 2>/dev/null --verbose
+	local 2>/dev/null sed printf x=1 --verbose x=1 cd
+		echo sed sed --verbose -eu /usr/bin
+	"$1" x=1 "$1" awk "$1" awk
+sed awk local test && cd export -eu sed echo grep grep printf /usr/bin "$1" sed
+	$(pwd) cd 2>/dev/null echo "$1" cd local export "$@"
+	printf echo | local && readonly done printf local test "$@" &&
+grep | | | awk awk sed done -eu printf -eu -eu
+	$(pwd) done printf "$1" -eu 2>/dev/null
+x=1 && grep echo && readonly printf awk 'quoted text'
+	test export && echo "$1" readonly
+$(pwd) readonly "$@" echo "$1" "$1" sed "$@" 'quoted text' 2>/dev/null grep local
+	"$1" --verbose "$@" awk | echo "$@" printf awk -eu printf echo sed | export
+/usr/bin --verbose done
+		| --verbose grep ${HOME} |
+	| "$@" then --verbose cd "$@" "$@" echo
+printf cd 'quoted text' /usr/bin sed "$@" export ${HOME} ${HOME} printf
+		readonly -eu awk -eu export
+	| --verbose printf /usr/bin 2>/dev/null
+	export done "$1" | ${HOME} 2>/dev/null && "$@"
+		| && readonly export ${HOME} sed 2>/dev/null /usr/bin awk awk printf
+-eu 2>/dev/null /usr/bin "$1" -eu export printf grep local
+export /usr/bin export done export --verbose
+| --verbose ${HOME} 2>/dev/null /usr/bin export export then
+		x=1 | export -eu sed awk $(pwd) 2>/dev/null && test local printf then
+	awk done --verbose 'quoted text' readonly echo done -eu done x=1 readonly
+then grep then ${HOME} /usr/bin local grep 2>/dev/null 2>/dev/null
+		test 2>/dev/null grep grep "$1" --verbose && printf done 2>/dev/null printf done
+		--verbose readonly "$1" ${HOME} awk echo awk
+	&& --verbose ${HOME} sed -eu cd "$@" test 'quoted text'
+&& 2>/dev/null 'quoted text' test && readonly
+		awk | printf export echo cd then
+	$(pwd) awk "$@" x=1 | awk /usr/bin -eu echo | "$1" sed
+sed test awk 2>/dev/null "$@" grep | then awk
+readonly && /usr/bin then "$1" export echo printf
+		-eu "$@" /usr/bin "$@" echo export --verbose
+done printf -eu readonly cd -eu ${HOME} ${HOME} test --verbose --verbose
+	done local test && "$1" && "$1" "$@" $(pwd) 2>/dev/null done "$@" export | test
+		'quoted text' export then test
+	"$@" readonly awk -eu $(pwd) then | 'quoted text'
+		-eu 'quoted text' test grep sed readonly
+-eu readonly local echo echo export awk test $(pwd) x=1
+		then "$@" | done echo --verbose "$1" 'quoted text'
+$(pwd) done done && "$1" 'quoted text' "$@" test sed | x=1
+'quoted text' printf then then $(pwd)
+	done sed cd | done ${HOME} test test -eu
+		&& readonly x=1 && x=1 cd 2>/dev/null
+	awk ${HOME} | ${HOME} "$1" "$1" grep 'quoted text' awk /usr/bin ${HOME}
+		export then "$@" "$1" --verbose /usr/bin |
+	2>/dev/null cd readonly --verbose "$1" sed local printf 'quoted text'
+		$(pwd) | $(pwd) 'quoted text'
+'quoted text' readonly "$1" 'quoted text' printf printf then
+		2>/dev/null then export
+		-eu printf readonly export grep && ${HOME}
+	done echo readonly 'quoted text' then local "$@" /usr/bin
+	2>/dev/null export sed 'quoted text' && export awk && done $(pwd) | local
+		/usr/bin cd echo test "$@" && --verbose
+	| export --verbose grep x=1 'quoted text' && awk "$@" -eu -eu
+		&& 2>/dev/null -eu | printf sed grep "$1" --verbose
+grep readonly x=1 done ${HOME} printf test --verbose
+2>/dev/null ${HOME} export then sed sed $(pwd) cd done
+	cd awk -eu readonly -eu
+	--verbose done | $(pwd) awk test export
+		test | export export | printf export
+export ${HOME} | && && | done /usr/bin 'quoted text' cd echo &&
+awk grep && && | "$@"
+	"$@" echo readonly 'quoted text' then $(pwd) 2>/dev/null
+	'quoted text' "$@" test -eu sed printf "$1" echo
+	done 'quoted text' test readonly echo x=1 "$1" export && --verbose -eu
+		-eu local then grep grep
+test "$1" done done $(pwd) 2>/dev/null echo export grep local grep
+	| then $(pwd) printf 'quoted text' ${HOME} ${HOME} readonly grep echo 'quoted text'
+	sed cd echo x=1 printf awk && printf && test
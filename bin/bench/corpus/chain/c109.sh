@@ -0,0 +1,2001 @@
+cd awk /usr/bin echo "$@" echo cd "$@" awk export local readonly then echo --verbose
+		x=1 sed $(pwd) -eu grep done x=1 echo 'quoted text'
+	&& grep && "$1" 'quoted text' --verbose
+	| 2>/dev/null | readonly
+	local printf local done
+	grep /usr/bin printf /usr/bin 'quoted text' local x=1
+		cd sed | && && | then export readonly printf
+	echo 2>/dev/null printf local 'quoted text' /usr/bin
+	-eu 'quoted text' echo --verbose done test
+/usr/bin sed ${HOME} -eu then --verbose awk "$1" grep "$1" 2>/dev/null
+		/usr/bin "$@" test printf &&
+	&& export cd | x=1 x=1 --verbose
+	local $(pwd) awk then "$@" test awk export grep
+		echo local 'quoted text' 2>/dev/null 2>/dev/null readonly x=1
+		x=1 ${HOME} -eu -eu printf cd echo 2>/dev/null "$@" readonly readonly echo 2>/dev/null
+	2>/dev/null cd /usr/bin "$1" printf 'quoted text' "$@" x=1
+		readonly x=1 x=1 awk sed 2>/dev/null test sed $(pwd) x=1 ${HOME} echo readonly
+	"$1" $(pwd) && $(pwd) /usr/bin export grep grep ${HOME}
+	"$@" /usr/bin awk done then sed cd ${HOME} ${HOME} sed "$@" &&
+		-eu 'quoted text' /usr/bin export &&
+--verbose "$1" sed 2>/dev/null "$@"
+		cd local "$@" test printf
+--verbose x=1 local && "$1" /usr/bin
+grep --verbose | /usr/bin $(pwd) printf --verbose | 2>/dev/null | /usr/bin
+"$1" readonly ${HOME} "$@" 'quoted text'
+"$@" 'quoted text' grep readonly grep
+	&& sed echo ${HOME} local 2>/dev/null cd x=1 x=1 grep ${HOME} -eu x=1
+	2>/dev/null then sed readonly ${HOME} sed echo
+		$(pwd) local 'quoted text' cd then awk cd printf cd test -eu --verbose 2>/dev/null
+$(pwd) then done "$@" readonly "$@" then x=1 export
+	$(pwd) sed awk "$1" --verbose cd test export
+/usr/bin 'quoted text' printf local test "$@" --verbose &&
+done x=1 ${HOME} --verbose "$@" export --verbose
+printf cd -eu local "$1" -eu grep "$@" then --verbose ${HOME} "$@" local awk 'quoted text'
+--verbose readonly printf --verbose
+		/usr/bin "$@" "$@" done readonly grep export sed grep readonly then printf
+	awk /usr/bin local printf readonly
+	local "$1" --verbose -eu then
+local && 'quoted text' 'quoted text' cd 'quoted text' && test then /usr/bin
+		&& done | local done x=1 readonly x=1 x=1 sed | | -eu readonly echo test awk |
+$(pwd) echo x=1 local grep cd && -eu && grep printf local ${HOME} echo then
+		${HOME} then x=1 2>/dev/null -eu done -eu "$1"
+		sed grep ${HOME} -eu ${HOME} export ${HOME} grep
+	${HOME} -eu $(pwd) local -eu /usr/bin | local /usr/bin readonly printf printf
+	cd $(pwd) && 'quoted text' awk export awk cd sed -eu test grep /usr/bin grep
+done 'quoted text' awk echo 2>/dev/null | "$1" printf $(pwd) && then
+	"$1" x=1 x=1 "$@" 'quoted text' cd printf x=1 cd export
+echo 'quoted text' ${HOME} echo --verbose 'quoted text' printf |
+	| done export readonly 2>/dev/null test "$1" /usr/bin awk echo "$1" export grep
+		test awk local sed then then "$@" then --verbose cd && x=1 x=1 grep
+	cd --verbose 'quoted text'
+--verbose 'quoted text' ${HOME} -eu grep local cd
+		$(pwd) cd 'quoted text' && cd
+readonly sed export local
+		printf 'quoted text' "$@" -eu --verbose
+		'quoted text' then local | sed echo awk /usr/bin
+"$@" 'quoted text' cd test --verbose --verbose "$1" done "$1" local "$@"
+		awk /usr/bin $(pwd) -eu echo cd sed then /usr/bin
+		"$1" awk --verbose then readonly export done --verbose readonly $(pwd) printf /usr/bin
+	export 'quoted text' "$1" "$1" then awk export | 2>/dev/null
+		&& "$@" "$@" ${HOME} echo "$1" 2>/dev/null -eu /usr/bin "$@" export sed
+awk ${HOME} $(pwd) readonly
+awk export /usr/bin readonly grep done ${HOME}
+		| cd grep then then test
+	/usr/bin && grep | local local test done 2>/dev/null 2>/dev/null -eu test
+	--verbose grep sed test ${HOME} 'quoted text' ${HOME} 'quoted text' local
+	cd printf sed $(pwd) printf echo ${HOME} sed
+"$@" cd sed test readonly
+	| readonly /usr/bin 'quoted text' done printf 2>/dev/null
+$(pwd) printf 2>/dev/null /usr/bin awk $(pwd) awk sed
+		then | sed /usr/bin $(pwd) sed "$@" "$@"
+		"$1" -eu "$1" && x=1 export && 'quoted text' export
+-eu "$1" echo $(pwd) 'quoted text'
+/usr/bin echo done x=1 "$@" export done --verbose
+		readonly local /usr/bin
+	cd 2>/dev/null $(pwd) x=1 -eu test done export
+		-eu sed test echo ${HOME} done x=1 export echo "$1" readonly sed
+		${HOME} -eu then x=1 local ${HOME} awk grep local
+		echo local "$1" export grep echo
+	| -eu $(pwd) grep $(pwd) cd then && --verbose ${HOME} "$@" $(pwd) 2>/dev/null
+	-eu done ${HOME} echo echo x=1 printf sed "$1" "$1"
+		/usr/bin echo $(pwd) ${HOME}
+'quoted text' awk printf done test "$1" readonly grep awk -eu
+	done printf 2>/dev/null x=1
+	2>/dev/null $(pwd) awk test /usr/bin 'quoted text' && $(pwd)
+		test done ${HOME} test /usr/bin x=1 'quoted text'
+		done sed --verbose && ${HOME} && local test -eu
+x=1 export "$@" -eu $(pwd) $(pwd) local && 2>/dev/null printf
+printf "$1" readonly $(pwd) "$@" 2>/dev/null $(pwd) test readonly
+/usr/bin export && test --verbose "$@"
+$(pwd) 2>/dev/null --verbose
+--verbose "$1" awk 2>/dev/null
+		awk $(pwd) "$@" sed grep then local /usr/bin x=1 local --verbose
+	grep cd | --verbose done
+	test "$1" grep sed cd awk sed /usr/bin sed cd readonly test -eu sed local cd awk
+		grep test && done awk
+awk done grep grep /usr/bin printf then $(pwd) then "$@" test && local "$1"
+	--verbose printf "$@"
+"$@" | then done x=1 test
+cd | --verbose "$@" && awk -eu && local grep "$@"
+grep export -eu sed done export | printf then
+2>/dev/null test done cd /usr/bin 'quoted text' ${HOME} --verbose
+		local /usr/bin $(pwd) 'quoted text' then
+	"$1" local done readonly x=1 2>/dev/null
+-eu test --verbose --verbose
+local then ${HOME} grep then 2>/dev/null --verbose
+export echo /usr/bin /usr/bin then "$1" echo printf
+	"$@" awk | then cd sed test $(pwd) then -eu "$1" test local && x=1 local
+		-eu 2>/dev/null done readonly cd 2>/dev/null
+		${HOME} 'quoted text' printf readonly "$@" sed ${HOME}
+sed 2>/dev/null x=1 | test
+	then -eu awk ${HOME} readonly printf test && "$@" -eu "$1"
+then echo | printf $(pwd) local grep echo readonly "$@" ${HOME} /usr/bin "$1"
+		/usr/bin local printf cd
+	"$1" local ${HOME} | /usr/bin ${HOME} sed ${HOME}
+	local cd echo && echo test test "$1" x=1 done 2>/dev/null grep
+		cd test -eu then && test done /usr/bin 'quoted text' local local then $(pwd) "$1"
+		/usr/bin x=1 'quoted text' cd local && readonly cd grep then sed
+local test $(pwd) readonly done readonly awk cd "$1" cd
+local local -eu $(pwd) ${HOME} sed grep "$@" done local
+	awk test then echo "$@" grep | ${HOME} echo && then local done
+		"$@" 2>/dev/null printf x=1 --verbose "$1" | test | "$@" 'quoted text' cd
+		x=1 echo ${HOME} "$@" grep 'quoted text' --verbose grep then 2>/dev/null
+awk 2>/dev/null echo /usr/bin /usr/bin /usr/bin 'quoted text'
+sed done 2>/dev/null readonly
+	sed x=1 cd 2>/dev/null | awk
+test done x=1 then --verbose "$@" echo $(pwd) sed then | /usr/bin
+		"$@" $(pwd) cd "$1" | /usr/bin
+echo sed sed -eu echo done | export echo then 'quoted text' $(pwd) ${HOME} &&
+		--verbose | awk cd && readonly
+sed test && "$1" "$@" "$@" printf ${HOME} "$@" awk then grep
+local echo /usr/bin export
+		/usr/bin awk "$@" done export echo then
+	--verbose /usr/bin 2>/dev/null x=1 local x=1 "$@" cd test readonly done
+		"$@" --verbose local echo echo -eu export then printf awk grep
+	export && grep ${HOME} --verbose
+		grep printf done /usr/bin local ${HOME} -eu --verbose && readonly
+		--verbose | /usr/bin printf sed /usr/bin | local
+"$1" export $(pwd) | ${HOME} 'quoted text' local 'quoted text'
+		readonly grep awk "$1" && | /usr/bin /usr/bin x=1 grep "$1" --verbose sed readonly
+	grep done test ${HOME} ${HOME}
+	awk grep sed grep 2>/dev/null "$1" "$1" $(pwd) printf 'quoted text' readonly
+		'quoted text' then grep ${HOME} grep readonly "$@" "$@" cd
+local sed printf | then && | local
+	"$1" ${HOME} x=1 && printf | ${HOME} printf local cd grep && echo
+	then $(pwd) echo --verbose
+awk then export printf 'quoted text' ${HOME} -eu "$@" x=1
+&& echo echo "$@" --verbose &&
+		done ${HOME} $(pwd) "$1" ${HOME}
+	--verbose test --verbose awk "$@" cd printf $(pwd) x=1
+	"$1" grep && cd done -eu sed done -eu
+	x=1 2>/dev/null then done export --verbose
+awk sed printf -eu 'quoted text' printf &&
+		sed echo 'quoted text' grep awk 2>/dev/null readonly
+	done awk $(pwd) "$@" x=1 test local $(pwd) ${HOME} test
+	awk 'quoted text' 2>/dev/null ${HOME}
+	printf && local printf "$@" $(pwd) --verbose local 'quoted text'
+	export 2>/dev/null x=1 | readonly printf test "$1"
+	echo --verbose 'quoted text' test done cd printf export done ${HOME}
+"$1" printf 'quoted text' test /usr/bin readonly cd /usr/bin cd
+	"$@" then done --verbose -eu 2>/dev/null /usr/bin
+	| printf then | && test "$1" 'quoted text' ${HOME} test readonly then echo printf
+	local printf -eu --verbose then then --verbose | echo cd done
+	-eu then | printf $(pwd) done $(pwd) -eu "$1"
+	done && sed 'quoted text' then
+	awk done /usr/bin | --verbose --verbose printf
+		readonly echo x=1 $(pwd)
+		grep then done 2>/dev/null then "$1"
+	grep sed --verbose $(pwd) $(pwd) readonly 2>/dev/null x=1 cd export -eu grep echo
+	sed cd sed --verbose "$@" 2>/dev/null 2>/dev/null
+awk "$1" readonly cd export && grep $(pwd) then export x=1
+		cd then ${HOME} | sed $(pwd) ${HOME} printf | awk awk then readonly
+		x=1 && && x=1 awk echo echo $(pwd) -eu "$1" -eu ${HOME}
+	&& x=1 export echo /usr/bin printf --verbose "$@" done cd -eu
+		"$@" | x=1 /usr/bin -eu 2>/dev/null readonly test
+export $(pwd) -eu "$1" --verbose
+done grep printf x=1 && | $(pwd) "$@" readonly sed sed then then |
+&& grep awk sed grep sed /usr/bin
+	test test export awk "$@" --verbose test
+"$@" export $(pwd) done "$@" export printf ${HOME}
+	--verbose -eu sed | cd "$1" 2>/dev/null
+	'quoted text' awk local && local sed 'quoted text'
+	cd 'quoted text' ${HOME} then 2>/dev/null /usr/bin -eu echo done 2>/dev/null --verbose
+	&& test && grep && sed "$@" then x=1 grep export
+	"$@" -eu | -eu cd grep 2>/dev/null
+	local --verbose ${HOME} | "$1" --verbose cd -eu local
+	--verbose local printf sed 'quoted text' 'quoted text' -eu 'quoted text'
+		-eu cd printf x=1 "$@" sed -eu && ${HOME} readonly
+	readonly done then done 2>/dev/null sed cd cd -eu local printf
+		-eu | done $(pwd) then local then ${HOME}
+	echo --verbose "$1" $(pwd) then sed ${HOME} cd --verbose
+	"$@" "$@" cd cd "$1" && ${HOME}
+	cd printf && echo | && --verbose "$@" /usr/bin ${HOME} 2>/dev/null test
+test -eu /usr/bin | -eu readonly
+	"$1" /usr/bin && grep export
+	2>/dev/null $(pwd) 2>/dev/null echo awk
+	readonly sed 2>/dev/null /usr/bin
+test && 'quoted text' 'quoted text' export "$1" done done -eu --verbose
+then export 2>/dev/null export $(pwd) cd awk local
+${HOME} export then grep -eu
+		echo $(pwd) && grep grep --verbose 'quoted text' cd
+	'quoted text' echo local 'quoted text' ${HOME} awk
+		test sed done printf | | --verbose ${HOME} test 'quoted text' 2>/dev/null
+&& /usr/bin "$@" 2>/dev/null local && "$1" 2>/dev/null x=1 -eu
+	&& then /usr/bin /usr/bin printf readonly /usr/bin -eu && ${HOME} x=1
+	x=1 export export 2>/dev/null
+		echo then 'quoted text' 'quoted text' $(pwd) 'quoted text' test echo
+		echo export "$@" export 'quoted text' x=1 test cd ${HOME}
+	printf 'quoted text' readonly echo ${HOME} local
+	| export test grep readonly awk | awk "$@" /usr/bin then ${HOME}
+		cd readonly grep printf "$@" 2>/dev/null -eu $(pwd) "$@" awk $(pwd)
+	"$1" readonly echo -eu ${HOME} $(pwd) /usr/bin readonly
+$(pwd) --verbose grep 'quoted text' readonly "$@" --verbose --verbose && "$1"
+		"$1" test local sed echo "$@" /usr/bin "$1" x=1 local printf
+		"$1" /usr/bin 'quoted text' printf /usr/bin -eu x=1 -eu "$1" 2>/dev/null
+test | 2>/dev/null "$@" /usr/bin sed printf
+	/usr/bin printf | "$1" "$@" local "$@" 'quoted text'
+		"$1" 2>/dev/null && ${HOME} cd /usr/bin awk test cd && awk
+		x=1 export echo "$@"
+		--verbose "$1" grep done export x=1 awk "$1" x=1 x=1 'quoted text' 2>/dev/null |
+		-eu local x=1 awk sed | x=1 awk echo readonly
+		sed /usr/bin | "$1" -eu test --verbose
+printf local -eu | echo cd export /usr/bin "$@" && export
+		&& 'quoted text' -eu cd -eu
+done -eu | -eu export -eu cd --verbose "$1" echo
+test sed readonly | readonly then /usr/bin local 2>/dev/null -eu grep
+cd awk --verbose local
+	$(pwd) ${HOME} readonly x=1 && done test test "$@" "$1" $(pwd) | "$1"
+	printf /usr/bin local 'quoted text' | $(pwd) done then
+		'quoted text' cd 'quoted text' --verbose cd readonly
+		sed 'quoted text' --verbose x=1 --verbose x=1 grep x=1 export
+	2>/dev/null && local -eu "$1" $(pwd) done cd --verbose x=1 cd printf &&
+	'quoted text' -eu --verbose test 'quoted text' -eu $(pwd) && cd readonly export
+	${HOME} awk readonly echo done --verbose 2>/dev/null -eu /usr/bin
+awk cd "$1" test cd grep cd x=1
+-eu $(pwd) --verbose awk 'quoted text' grep "$1" cd /usr/bin export 'quoted text'
+		/usr/bin "$@" 2>/dev/null sed grep
+		sed x=1 $(pwd) cd local 'quoted text' && x=1
+	echo -eu x=1 done export echo | export export export export done
+	$(pwd) && --verbose echo echo then 2>/dev/null
+echo | test done awk sed "$@" export readonly $(pwd) 'quoted text'
+		"$1" printf 2>/dev/null
+	echo then local 2>/dev/null test sed && ${HOME}
+test grep local readonly ${HOME}
+	printf sed export local done | test
+| 2>/dev/null -eu awk 'quoted text' test && 2>/dev/null $(pwd) /usr/bin echo | /usr/bin
+readonly -eu 'quoted text' sed 2>/dev/null
+x=1 x=1 test $(pwd) --verbose then test local | 'quoted text' -eu local
+		--verbose --verbose sed && then && ${HOME} local 'quoted text' "$@" local printf
+		/usr/bin | ${HOME} ${HOME} "$@" local ${HOME} awk $(pwd) awk 2>/dev/null
+	"$1" then export 2>/dev/null echo ${HOME} /usr/bin 'quoted text'
+		"$@" then then echo -eu x=1 "$@" echo x=1 | awk -eu x=1 awk then
+	x=1 "$1" 'quoted text' | awk readonly awk local local then readonly 2>/dev/null
+	&& then then 'quoted text' sed 2>/dev/null
+printf grep done --verbose /usr/bin test "$@" local && then
+	| 2>/dev/null "$@" local export "$1" export awk sed sed
+		printf "$1" 2>/dev/null && "$@" test $(pwd)
+		sed && done test cd printf
+	awk then awk 'quoted text'
+		grep --verbose grep 'quoted text' ${HOME} x=1 $(pwd) grep done -eu
+/usr/bin test awk printf && /usr/bin -eu $(pwd) export $(pwd)
+	echo test readonly local 2>/dev/null
+		2>/dev/null $(pwd) /usr/bin 2>/dev/null
+	cd export then "$@" ${HOME} echo readonly
+grep "$@" $(pwd) && printf
+		then -eu sed printf x=1 x=1 $(pwd) ${HOME}
+		export 2>/dev/null $(pwd) |
+	| echo printf readonly then export "$1" && awk x=1 && done echo | local echo sed
+		"$1" 2>/dev/null -eu "$1" printf
+		| x=1 done printf --verbose
+	readonly then x=1 then export sed grep echo 2>/dev/null /usr/bin
+		local sed && && readonly readonly ${HOME} then then
+	test local local readonly
+		printf "$@" $(pwd) x=1 grep
+	then readonly printf echo printf
+		test /usr/bin -eu /usr/bin /usr/bin "$1"
+		&& test 2>/dev/null /usr/bin
+	then ${HOME} "$@" && "$1" x=1 "$@" && && test x=1
+	local "$@" export 2>/dev/null done x=1 x=1 'quoted text' readonly local
+"$@" done "$1" sed --verbose cd --verbose
+${HOME} local x=1 done 'quoted text'
+$(pwd) export -eu printf -eu echo
+		printf then cd local done printf readonly 2>/dev/null -eu --verbose
+		export then local 'quoted text' printf
+		sed -eu x=1 $(pwd) $(pwd) ${HOME}
+	${HOME} readonly /usr/bin test -eu test x=1 echo then test then awk done test &&
+${HOME} | echo sed printf echo
+		x=1 2>/dev/null local && awk printf export done echo
+		echo cd awk | | --verbose sed sed "$@"
+echo "$1" awk cd --verbose 'quoted text' /usr/bin
+		| echo x=1 grep echo /usr/bin grep /usr/bin printf x=1
+export /usr/bin -eu test export --verbose echo && local --verbose echo readonly
+		export "$1" "$@" ${HOME} $(pwd) 'quoted text'
+'quoted text' export "$@" -eu local "$@" sed x=1 echo echo sed grep cd grep &&
+		export cd then "$1" local
+	| "$1" /usr/bin 'quoted text' echo 'quoted text' cd echo 'quoted text'
+	-eu printf "$@" | /usr/bin -eu && 2>/dev/null x=1 2>/dev/null
+		echo export sed x=1 && 2>/dev/null --verbose test local test 2>/dev/null printf
+	| 'quoted text' export x=1
+	test | echo sed awk --verbose $(pwd) test sed /usr/bin cd grep awk grep |
+		sed readonly test "$1" 2>/dev/null 2>/dev/null 'quoted text'
+local sed ${HOME} "$1" done test echo "$1" "$1" done "$@" test done
+done --verbose readonly grep test -eu awk "$1" $(pwd) $(pwd)
+| /usr/bin export && && --verbose "$@" x=1
+	| "$1" printf 2>/dev/null /usr/bin -eu sed grep ${HOME} cd readonly --verbose
+'quoted text' --verbose "$@" test &&
+		export cd echo 'quoted text' -eu "$@" /usr/bin export --verbose readonly printf
+local done 'quoted text'
+${HOME} readonly --verbose "$@" $(pwd) export "$1" /usr/bin grep "$1"
+	${HOME} sed $(pwd) then printf | | then done
+	${HOME} && printf grep $(pwd) echo "$@" readonly
+	"$1" test then readonly
+		"$1" readonly export cd local export /usr/bin $(pwd) 'quoted text'
+	x=1 awk "$1" printf export --verbose
+printf ${HOME} ${HOME} test
+/usr/bin 'quoted text' --verbose | done local cd sed test then x=1 printf
+		/usr/bin sed cd | printf sed $(pwd) x=1 ${HOME} done
+	"$1" | awk && && readonly echo echo sed ${HOME} local x=1 2>/dev/null cd
+	| $(pwd) sed -eu cd | $(pwd) $(pwd) grep
+		"$@" then "$1" -eu 2>/dev/null "$1" -eu | && awk "$@" test
+		readonly /usr/bin $(pwd) readonly 'quoted text' readonly
+printf 'quoted text' $(pwd)
+	$(pwd) cd local printf grep -eu then x=1 export | readonly
+	'quoted text' $(pwd) grep done printf 2>/dev/null && 'quoted text'
+	awk sed echo | then export
+		export echo x=1 | "$1" done && --verbose "$1" "$1" x=1 awk $(pwd)
+	grep export $(pwd) /usr/bin
+	done then done | export
+	done $(pwd) local $(pwd) x=1 cd readonly
+		export done grep readonly done grep grep cd "$1" x=1 ${HOME} sed local "$@"
+	${HOME} grep "$1" cd awk && 2>/dev/null /usr/bin "$@" done -eu local
+${HOME} 'quoted text' then $(pwd) 'quoted text' ${HOME}
+$(pwd) | grep x=1 "$1"
+		local && awk /usr/bin && x=1 printf 'quoted text' printf printf
+test printf echo --verbose printf "$1" x=1 readonly cd -eu "$1" /usr/bin awk cd
+		cd readonly printf | "$@" test readonly
+&& 2>/dev/null printf test | && "$@"
+export /usr/bin --verbose done /usr/bin
+then -eu "$@" awk printf 2>/dev/null grep local | then "$@" grep local
+done -eu 2>/dev/null 2>/dev/null && $(pwd) export | awk
+	then $(pwd) cd export echo test
+		"$@" && export readonly done cd grep printf /usr/bin
+x=1 $(pwd) | /usr/bin $(pwd) echo cd $(pwd) --verbose
+"$@" ${HOME} -eu x=1
+		export printf ${HOME} --verbose | "$1" awk
+		x=1 "$@" then awk /usr/bin printf -eu $(pwd) awk "$1" $(pwd) -eu
+		2>/dev/null cd echo awk $(pwd) x=1 --verbose "$@" -eu | cd echo && --verbose
+	-eu test && printf readonly readonly "$1" $(pwd) $(pwd)
+		x=1 /usr/bin sed readonly export test
+	$(pwd) /usr/bin 'quoted text' -eu ${HOME} cd test echo
+	export "$@" then awk echo sed
+	&& "$@" readonly local echo && then echo "$1" 2>/dev/null
+		local echo done done "$@" cd 'quoted text' --verbose test && sed then /usr/bin
+awk ${HOME} "$1" /usr/bin echo grep && test "$@"
+		"$@" ${HOME} awk echo sed 'quoted text' 'quoted text'
+${HOME} sed cd -eu "$1" | echo test 'quoted text'
+		local "$1" sed "$@" readonly export export x=1 grep /usr/bin "$@" $(pwd) test
+	echo cd /usr/bin export printf 2>/dev/null /usr/bin "$@" "$1" export 2>/dev/null
+		x=1 export "$1" "$1" export export grep ${HOME} $(pwd) "$1"
+printf echo | --verbose readonly $(pwd) awk local awk && 2>/dev/null printf ${HOME}
+		echo /usr/bin sed && 2>/dev/null test "$1" "$1"
+	${HOME} then /usr/bin /usr/bin 'quoted text' && && 'quoted text'
+	printf cd printf printf $(pwd)
+		done ${HOME} "$@" x=1 export printf export sed
+		-eu echo 2>/dev/null --verbose x=1 "$1"
+		local x=1 ${HOME} "$1" -eu "$1" test
+		-eu cd export then $(pwd)
+		grep -eu cd 'quoted text' ${HOME} echo then export
+"$@" ${HOME} done export ${HOME} test then ${HOME} 2>/dev/null "$1" $(pwd) -eu
+		'quoted text' --verbose --verbose test -eu 'quoted text'
+cd printf sed /usr/bin then echo $(pwd) 2>/dev/null -eu done cd 2>/dev/null
+--verbose x=1 && echo -eu "$1" x=1 /usr/bin ${HOME} export && export
+	then local test then test "$1" && "$@" 2>/dev/null sed -eu
+	echo && /usr/bin grep | echo then export echo --verbose echo
+"$1" local $(pwd) ${HOME} grep -eu echo sed ${HOME} 2>/dev/null done echo
+"$@" /usr/bin grep sed "$1" /usr/bin cd --verbose awk test test --verbose
+$(pwd) x=1 ${HOME} ${HOME} $(pwd) 'quoted text' readonly sed "$1" echo
+	grep printf | 'quoted text' cd printf "$1" 2>/dev/null ${HOME} readonly
+		&& "$1" ${HOME} printf $(pwd) | | "$@" "$1" | /usr/bin local /usr/bin
+test 2>/dev/null sed && grep
+x=1 test ${HOME} cd awk
+		export | readonly grep --verbose 2>/dev/null then
+		grep --verbose | echo local test "$@" echo 'quoted text'
+	test then /usr/bin && cd 'quoted text' grep export readonly 'quoted text'
+		'quoted text' then test | test sed grep grep -eu done awk
+		--verbose "$@" && /usr/bin | readonly $(pwd) x=1 cd --verbose
+$(pwd) export cd 'quoted text' | done | && sed 'quoted text' grep ${HOME} x=1
+		awk cd $(pwd) x=1 done ${HOME} echo &&
+	| grep local --verbose sed | && --verbose "$1" "$1" 'quoted text'
+		"$1" -eu "$@" readonly /usr/bin
+		then grep $(pwd) x=1 printf grep sed test | sed /usr/bin | ${HOME} $(pwd)
+sed --verbose done && --verbose -eu -eu x=1 "$@" "$@"
+	x=1 2>/dev/null "$@" |
+2>/dev/null $(pwd) export
+	"$@" -eu readonly ${HOME} readonly x=1 sed done grep "$1" readonly export
+	${HOME} "$1" /usr/bin | echo grep echo cd $(pwd) "$1" awk x=1 "$@"
+		done grep /usr/bin "$@" 'quoted text' export grep local printf
+"$1" ${HOME} echo $(pwd) && grep test && 2>/dev/null done
+		${HOME} ${HOME} test /usr/bin | -eu ${HOME} local "$1" printf
+		export echo done cd --verbose $(pwd)
+'quoted text' echo echo
+--verbose | | x=1 2>/dev/null -eu /usr/bin "$@" sed --verbose done
+	awk done awk printf --verbose local 2>/dev/null local
+	awk done local /usr/bin
+cd --verbose "$@" test 2>/dev/null
+	local test then echo then done local "$1"
+		${HOME} --verbose printf local 2>/dev/null readonly x=1 $(pwd) awk
+	-eu | | test 'quoted text' -eu 2>/dev/null && -eu readonly "$1" "$1" cd -eu
+-eu awk export ${HOME} test "$1" then $(pwd) "$1" | test test "$@" 'quoted text'
+"$@" test sed export awk awk
+	--verbose grep done "$@" then /usr/bin "$@" x=1 "$@" then 'quoted text'
+		readonly /usr/bin local echo "$1" readonly | readonly printf $(pwd) test /usr/bin
+		printf "$@" export local "$@" -eu "$1" cd | && export | done sed
+x=1 --verbose local ${HOME} done 2>/dev/null sed
+		cd readonly "$@" "$1" -eu -eu echo &&
+	--verbose echo 2>/dev/null export done test
+	export ${HOME} readonly 2>/dev/null $(pwd) 'quoted text'
+2>/dev/null done export
+"$1" cd "$@" test printf echo /usr/bin sed x=1 /usr/bin awk echo printf
+	2>/dev/null export then 'quoted text'
+	$(pwd) x=1 2>/dev/null 'quoted text' then
+	local export && $(pwd) echo --verbose $(pwd) 2>/dev/null ${HOME}
+printf local awk $(pwd) export "$1" -eu -eu
+		"$@" awk readonly grep done printf cd sed grep sed -eu "$@" grep test
+&& export 'quoted text' cd ${HOME} printf printf x=1 grep $(pwd) | readonly readonly
+	&& sed export sed cd echo cd cd sed 2>/dev/null
+		--verbose 2>/dev/null done local cd $(pwd) --verbose 2>/dev/null
+	printf cd 2>/dev/null 'quoted text' | -eu printf "$1" then 'quoted text'
+		awk --verbose readonly export -eu local done "$@"
+	/usr/bin && then awk x=1 |
+		local 'quoted text' cd --verbose echo local x=1 /usr/bin
+test /usr/bin printf && x=1 export done test "$1" 'quoted text'
+--verbose grep -eu x=1 "$@" --verbose test x=1 ${HOME} test awk "$@" local cd
+2>/dev/null --verbose test readonly printf cd
+	"$1" printf "$1" then echo
+	2>/dev/null --verbose && "$1" cd printf --verbose | echo printf "$1"
+		"$@" done | readonly local "$1" test sed grep cd sed then test | test test
+sed printf grep $(pwd) local awk local "$1"
+/usr/bin then -eu "$@" && done done && -eu --verbose
+		local /usr/bin awk | test 'quoted text' export local --verbose x=1 echo readonly
+		x=1 echo /usr/bin readonly 2>/dev/null local export local done cd && echo /usr/bin
+		'quoted text' "$@" awk 'quoted text' grep --verbose
+| awk awk then printf echo test && local
+test done test x=1 -eu sed grep grep ${HOME} local test 2>/dev/null
+&& $(pwd) 2>/dev/null cd "$@" sed then echo && ${HOME} echo then && /usr/bin
+		-eu ${HOME} "$1" sed export done "$1" "$@" "$1" /usr/bin --verbose awk "$1"
+		'quoted text' "$1" printf sed "$1" awk /usr/bin 2>/dev/null "$1" $(pwd)
+		test printf export printf readonly | "$@"
+		done x=1 local readonly export ${HOME}
+		"$@" done printf done 2>/dev/null
+readonly test test readonly x=1 x=1
+	${HOME} then 2>/dev/null x=1 && "$1" then grep -eu cd cd ${HOME} "$@" echo
+&& test sed 'quoted text' done
+&& then /usr/bin local 2>/dev/null | export then
+		'quoted text' --verbose "$@" readonly "$@" done export
+local done | $(pwd) "$1" ${HOME}
+		awk grep 'quoted text' $(pwd) "$@"
+	done && 2>/dev/null printf -eu 'quoted text' sed
+		awk cd local awk $(pwd) export done "$@" awk "$1" -eu ${HOME} /usr/bin 2>/dev/null
+$(pwd) readonly $(pwd) x=1 local /usr/bin
+		echo "$1" | "$@" 'quoted text' echo done $(pwd) cd "$@" "$1"
+	--verbose -eu | echo then ${HOME} grep
+local ${HOME} && --verbose grep
+		printf 2>/dev/null printf -eu -eu awk 2>/dev/null echo | ${HOME} then
+$(pwd) done local cd -eu local x=1 cd awk 2>/dev/null
+		--verbose 'quoted text' $(pwd) "$1" "$1" done grep cd "$1" && local grep
+		awk local x=1 done test ${HOME} && then "$@" -eu "$@" export x=1 -eu echo
+		| done && 2>/dev/null then readonly grep done $(pwd)
+		printf -eu printf --verbose done local printf $(pwd)
+		awk && 'quoted text' readonly echo export cd done
+	$(pwd) printf local --verbose readonly ${HOME} 2>/dev/null
+		local sed 2>/dev/null
+	sed then echo 2>/dev/null "$@" "$1"
+cd readonly 'quoted text' local test sed x=1 sed 2>/dev/null grep
+	grep | x=1 /usr/bin export $(pwd) 2>/dev/null grep export cd &&
+-eu readonly "$1" | "$@" grep ${HOME} readonly readonly then cd x=1 |
+	"$1" ${HOME} --verbose
+		awk export -eu sed done 2>/dev/null && sed ${HOME}
+	| && then readonly "$1" --verbose
+echo && "$@" printf x=1 x=1 "$@" awk awk --verbose sed test ${HOME}
+	"$@" awk /usr/bin $(pwd) awk x=1 ${HOME} "$@" | export then sed "$@" $(pwd)
+x=1 /usr/bin echo then awk | awk
+	"$@" --verbose | test export then then printf export
+${HOME} $(pwd) then test grep grep --verbose
+		echo export grep --verbose then && -eu 'quoted text' test echo --verbose
+	export readonly 2>/dev/null export
+		--verbose printf test then local --verbose
+	${HOME} /usr/bin -eu $(pwd) echo export export printf --verbose
+		printf then ${HOME} "$1" local
+export printf done "$@" local then test awk
+2>/dev/null sed "$1" /usr/bin sed then readonly $(pwd)
+	test ${HOME} done /usr/bin done test
+--verbose && export x=1 | 'quoted text' then
+		-eu && 'quoted text' -eu grep local /usr/bin
+		readonly readonly printf ${HOME} readonly export grep |
+	echo | grep echo grep export -eu 'quoted text'
+	sed readonly | then $(pwd) readonly -eu cd readonly
+		sed done && local $(pwd) awk 2>/dev/null
+	awk done done "$1" 2>/dev/null /usr/bin 2>/dev/null --verbose 'quoted text'
+		| echo /usr/bin 2>/dev/null
+		$(pwd) $(pwd) /usr/bin -eu sed $(pwd) sed $(pwd) x=1 2>/dev/null
+/usr/bin -eu test "$@" printf export
+		printf readonly /usr/bin export sed 2>/dev/null export 2>/dev/null
+	sed readonly && x=1 | --verbose
+-eu -eu local readonly --verbose then grep 'quoted text' then grep done
+	"$@" && --verbose && 'quoted text' awk test --verbose grep "$1" --verbose
+cd 'quoted text' test "$@" "$@" $(pwd) 2>/dev/null "$@" -eu readonly sed 'quoted text'
+	done $(pwd) ${HOME} $(pwd) test x=1
+	"$1" /usr/bin && "$1" | grep local test then --verbose
+grep cd local "$@" sed then
+awk && x=1 2>/dev/null then $(pwd) sed 'quoted text'
+echo test local done && /usr/bin readonly awk ${HOME} ${HOME} ${HOME}
+		&& "$1" "$@" "$@" --verbose readonly readonly local export awk | sed local
+	2>/dev/null grep awk /usr/bin sed awk x=1 --verbose
+	then test sed then local local grep "$1" printf
+	--verbose && test $(pwd) x=1 | | && test ${HOME} 'quoted text' x=1 done
+	${HOME} printf printf done done $(pwd) then ${HOME} x=1 readonly
+export /usr/bin then --verbose $(pwd)
+		-eu cd | then -eu test "$@" awk printf $(pwd) done x=1 local "$@"
+	readonly && "$1" test
+		echo sed then /usr/bin $(pwd) local grep export export "$1" echo grep printf
+&& -eu local "$1" | 2>/dev/null echo awk done -eu ${HOME}
+		| local printf awk sed echo "$@" sed "$@" cd 2>/dev/null done --verbose --verbose
+	grep "$@" then awk cd | then readonly 'quoted text' grep local
+		--verbose 'quoted text' done grep export test --verbose awk $(pwd) && sed local
+$(pwd) grep sed 'quoted text' "$1" ${HOME} cd cd x=1 $(pwd) --verbose
+		cd && cd $(pwd) grep "$1" $(pwd) cd
+2>/dev/null "$1" && 2>/dev/null printf grep export printf test
+readonly && -eu export ${HOME} awk readonly
+awk done 2>/dev/null done sed done "$@" -eu -eu "$@" export printf
+awk x=1 sed x=1 printf | printf export $(pwd) 2>/dev/null readonly
+/usr/bin grep local x=1
+		local /usr/bin done local
+		sed | $(pwd) | cd test awk /usr/bin --verbose && export ${HOME} -eu /usr/bin
+'quoted text' then cd --verbose 'quoted text'
+	cd printf x=1 echo test $(pwd) 'quoted text' "$@" local done cd export
+| && cd && $(pwd) grep "$@" --verbose $(pwd) 2>/dev/null -eu "$1"
+	"$1" readonly test grep x=1 ${HOME} awk local printf | readonly
+	grep local x=1 /usr/bin cd --verbose
+printf echo done readonly
+		readonly 'quoted text' /usr/bin "$1" 2>/dev/null x=1 -eu /usr/bin "$1" sed printf
+		sed --verbose "$1" $(pwd) "$@" 2>/dev/null readonly | readonly --verbose && "$1"
+		${HOME} readonly test awk
+	readonly -eu grep -eu test 'quoted text' cd -eu printf
+	echo $(pwd) --verbose sed then
+/usr/bin --verbose -eu && then $(pwd) ${HOME} "$1" done --verbose
+		-eu "$1" done $(pwd) ${HOME} export "$1"
+grep -eu && 'quoted text' cd | ${HOME} local
+printf -eu sed done printf readonly awk printf grep printf readonly
+		| then -eu local then 'quoted text'
+-eu cd x=1 test -eu cd 'quoted text' awk echo 2>/dev/null "$1"
+	${HOME} echo 2>/dev/null local
+	'quoted text' ${HOME} echo cd grep cd 2>/dev/null echo sed cd
+		echo echo sed --verbose printf --verbose ${HOME}
+	${HOME} | done $(pwd) printf
+	x=1 $(pwd) printf x=1 ${HOME}
+		'quoted text' --verbose grep local export 2>/dev/null
+		local printf "$@" export echo --verbose "$@" awk "$@" "$@" grep | --verbose
+x=1 ${HOME} "$@" sed /usr/bin 2>/dev/null done /usr/bin --verbose awk cd cd ${HOME}
+		$(pwd) sed export 'quoted text' cd 'quoted text' test printf | 'quoted text' printf
+	grep -eu ${HOME} $(pwd) /usr/bin "$@"
+		"$@" echo 'quoted text' readonly cd "$1" printf grep
+2>/dev/null test ${HOME}
+	done test x=1 2>/dev/null done /usr/bin local x=1
+	| ${HOME} ${HOME} ${HOME} "$@" -eu --verbose | "$@" && readonly local grep
+		"$1" $(pwd) grep | local && readonly 2>/dev/null sed x=1
+local grep awk x=1 sed | --verbose export awk $(pwd)
+		export $(pwd) test done --verbose then export local cd x=1 printf then cd /usr/bin
+		-eu ${HOME} test cd printf "$@" "$1" local &&
+		done "$1" grep x=1 printf done then && "$1" test x=1 | | --verbose
+printf local awk local "$1"
+	local export -eu 'quoted text' echo
+/usr/bin ${HOME} --verbose /usr/bin
+	done $(pwd) 2>/dev/null readonly export $(pwd) "$1" grep printf && "$@" sed
+		-eu 2>/dev/null test $(pwd) awk then /usr/bin
+	'quoted text' "$@" printf "$@"
+then -eu awk 'quoted text' && export | done local /usr/bin
+	export test readonly done
+	'quoted text' /usr/bin ${HOME}
+	cd ${HOME} done ${HOME} -eu local -eu then
+	"$@" 'quoted text' local $(pwd) then -eu 'quoted text' grep
+awk ${HOME} --verbose -eu awk done | done printf test x=1 --verbose
+		x=1 readonly local then echo test sed then test -eu done grep &&
+		printf 2>/dev/null then x=1 printf $(pwd) "$@" x=1 sed export done
+x=1 sed x=1 then echo awk
+		local /usr/bin sed $(pwd) x=1 /usr/bin readonly then local
+echo done /usr/bin readonly done printf --verbose
+		then 'quoted text' x=1 then $(pwd) "$@" cd readonly done ${HOME}
+"$1" awk x=1 local done ${HOME} --verbose $(pwd) --verbose 2>/dev/null "$@"
+	echo echo 'quoted text' -eu ${HOME} x=1 awk local 'quoted text'
+'quoted text' then done grep x=1 x=1 grep awk printf && && ${HOME}
+	| "$1" 'quoted text' -eu awk echo -eu test 'quoted text'
+	then 2>/dev/null local test ${HOME} printf |
+"$@" grep echo 'quoted text' 2>/dev/null "$1" test ${HOME}
+		"$@" 'quoted text' 'quoted text'
+local sed sed grep readonly cd && -eu /usr/bin ${HOME} grep readonly
+		awk --verbose echo /usr/bin sed sed 2>/dev/null printf "$@" echo grep done
+		"$@" -eu test awk && && $(pwd) && export awk ${HOME}
+	sed readonly then readonly cd local -eu | then "$1" test | ${HOME} x=1 |
+test sed grep ${HOME} local grep
+		echo -eu /usr/bin test
+	printf then local local x=1 echo | 2>/dev/null echo "$1" then "$@"
+--verbose x=1 $(pwd) grep awk sed local done $(pwd) $(pwd) 2>/dev/null
+done "$@" then && --verbose then 2>/dev/null 2>/dev/null grep x=1 done --verbose
+| "$1" readonly sed readonly 2>/dev/null readonly awk then x=1 export
+sed -eu printf then 2>/dev/null
+	export cd "$@" | ${HOME} --verbose x=1
+/usr/bin "$@" export $(pwd) grep /usr/bin 2>/dev/null readonly --verbose
+	printf ${HOME} printf
+		echo 2>/dev/null x=1 cd "$@" test
+		2>/dev/null x=1 cd 2>/dev/null ${HOME} /usr/bin local "$1" done 'quoted text'
+		grep --verbose 2>/dev/null && then -eu 'quoted text' $(pwd)
+	cd 'quoted text' readonly export 'quoted text' then /usr/bin
+		/usr/bin && export x=1
+		readonly test printf "$1" local 'quoted text' ${HOME} done local 'quoted text'
+	2>/dev/null done --verbose
+		2>/dev/null | cd -eu then "$@" 2>/dev/null
+$(pwd) -eu export --verbose -eu /usr/bin 2>/dev/null grep x=1
+	test x=1 grep then --verbose export echo ${HOME} &&
+2>/dev/null x=1 local
+		$(pwd) done readonly awk local && readonly done ${HOME} 'quoted text'
+"$@" local grep awk x=1 cd awk 2>/dev/null "$1" echo printf awk then echo
+x=1 /usr/bin $(pwd) -eu -eu -eu -eu printf /usr/bin export
+		--verbose export echo ${HOME} done 'quoted text' export --verbose
+| -eu then x=1 export && awk
+cd "$1" local /usr/bin then --verbose grep && test readonly
+	2>/dev/null grep printf -eu done
+	2>/dev/null done -eu echo && "$1" then ${HOME} &&
+		sed "$1" sed 2>/dev/null test readonly awk cd echo
+'quoted text' 'quoted text'
+		sed then done printf export printf x=1 export awk cd test x=1 'quoted text' |
+awk echo readonly awk export
+	echo awk then done --verbose local "$1" && readonly | export
+		| ${HOME} done | printf then readonly ${HOME} 2>/dev/null $(pwd) x=1 "$1"
+readonly -eu ${HOME} readonly -eu readonly $(pwd) 'quoted text' "$@"
+	export printf awk 2>/dev/null "$1" done test
+		echo "$1" "$@" grep /usr/bin
+		/usr/bin then && cd $(pwd)
+readonly local done done test $(pwd) -eu sed "$1" 2>/dev/null "$@" then readonly
+'quoted text' "$@" x=1 export /usr/bin echo x=1 ${HOME} export x=1 |
+x=1 'quoted text' grep "$@" export local test readonly -eu done then $(pwd)
+		test -eu /usr/bin cd 'quoted text'
+grep grep sed grep printf awk cd ${HOME} && --verbose 2>/dev/null
+/usr/bin $(pwd) "$@" "$1" 2>/dev/null test export -eu ${HOME} done
+		$(pwd) sed cd $(pwd) "$@" 'quoted text' $(pwd) done
+		grep done printf /usr/bin readonly
+		"$@" done | export "$1" awk export
+		echo done | ${HOME} grep 2>/dev/null
+		printf grep local export readonly sed 2>/dev/null
+'quoted text' ${HOME} $(pwd) cd
+		"$1" then "$1" sed $(pwd) && /usr/bin
+test awk sed 2>/dev/null local x=1 test x=1
+	sed --verbose export awk --verbose echo cd --verbose export grep
+test cd ${HOME} "$@" grep 'quoted text' printf 'quoted text' --verbose
+		awk /usr/bin -eu 2>/dev/null | 2>/dev/null ${HOME}
+	readonly done "$1" --verbose 'quoted text' local export sed printf 2>/dev/null
+		2>/dev/null ${HOME} && "$@" awk
+		cd local cd readonly test readonly 'quoted text' local sed "$@" "$1" /usr/bin
+		awk then cd echo readonly sed
+| -eu --verbose --verbose | done grep 2>/dev/null
+	"$1" -eu then local done /usr/bin
+${HOME} then test echo "$@" --verbose | grep
+		'quoted text' ${HOME} 2>/dev/null
+	| done 'quoted text' export
+	2>/dev/null readonly $(pwd) /usr/bin
+		2>/dev/null done test local done 'quoted text'
+| local -eu awk export awk grep sed cd
+done | | local ${HOME}
+${HOME} export then done /usr/bin
+		/usr/bin x=1 ${HOME} done $(pwd) "$@" printf sed done
+		export 'quoted text' readonly | then cd -eu && 2>/dev/null $(pwd) local cd readonly
+2>/dev/null printf ${HOME}
+	x=1 grep 'quoted text' | grep echo
+"$@" export && 'quoted text' local sed sed
+	'quoted text' grep 2>/dev/null awk | export
+		"$1" printf local cd done export
+	awk | sed echo printf 'quoted text'
+awk then 2>/dev/null export -eu
+		readonly ${HOME} printf grep grep -eu
+		&& awk 2>/dev/null && done awk
+	-eu printf 2>/dev/null awk --verbose -eu "$1"
+		awk then /usr/bin readonly sed
+		2>/dev/null grep grep "$1" readonly --verbose 2>/dev/null
+	-eu -eu test readonly "$1" x=1 awk export x=1 grep "$1" |
+test test awk x=1 readonly 'quoted text'
+	then grep sed 2>/dev/null cd "$1" && "$1" echo readonly 'quoted text'
+${HOME} "$@" export 2>/dev/null
+local printf done 'quoted text'
+		"$1" 'quoted text' readonly $(pwd) awk grep
+"$@" echo grep echo awk
+	2>/dev/null /usr/bin sed | echo awk then | x=1
+'quoted text' readonly
+		'quoted text' ${HOME} && awk 2>/dev/null local sed | --verbose printf test
+2>/dev/null done readonly printf 'quoted text' grep -eu
+	$(pwd) -eu x=1 local readonly test "$@" $(pwd) grep readonly && then
+&& && | cd test 2>/dev/null 'quoted text' echo done grep /usr/bin grep
+2>/dev/null 2>/dev/null cd grep ${HOME} printf done
+| x=1 sed grep -eu --verbose
+	printf x=1 echo printf sed
+		printf "$@" sed readonly readonly ${HOME} printf 'quoted text' done grep "$@"
+		x=1 --verbose awk --verbose
+"$1" x=1 grep echo cd 2>/dev/null /usr/bin --verbose $(pwd)
+	${HOME} x=1 | done "$@" awk 'quoted text' awk export
+		local | /usr/bin export done 'quoted text' && local x=1 2>/dev/null test $(pwd)
+awk printf test --verbose 2>/dev/null grep
+/usr/bin && readonly cd
+| x=1 --verbose awk --verbose echo done printf x=1
+		sed x=1 sed export "$@"
+	cd export --verbose "$1" local grep 'quoted text' awk grep $(pwd) awk "$1" ${HOME}
+${HOME} $(pwd) local then && "$1" "$1"
+| local cd done echo /usr/bin
+-eu awk -eu sed echo grep test $(pwd) test readonly
+export --verbose local test 'quoted text' test 'quoted text' done
+then x=1 echo $(pwd) export printf done sed $(pwd) && ${HOME}
+		'quoted text' ${HOME} /usr/bin
+		cd then "$1" sed cd export "$@" && "$@" sed cd ${HOME}
+	then $(pwd) /usr/bin "$1" -eu then 2>/dev/null test test
+	awk && "$@" sed && --verbose 2>/dev/null /usr/bin
+	then ${HOME} test then done sed && ${HOME} | done x=1 /usr/bin
+	awk echo --verbose $(pwd) | x=1 | 'quoted text' awk
+		test done && awk grep ${HOME} x=1 echo sed
+-eu test cd && "$1" $(pwd) then -eu printf
+		'quoted text' -eu ${HOME} cd cd ${HOME} $(pwd) "$@" cd local 2>/dev/null
+	-eu done 'quoted text' awk $(pwd) echo -eu printf
+	x=1 local && cd export && test echo done readonly 2>/dev/null
+	done printf "$1" sed local grep sed cd x=1 done sed local test test cd && 2>/dev/null
+		echo 'quoted text' awk && cd 'quoted text' -eu grep $(pwd) echo
+	${HOME} then "$1" local -eu readonly local printf cd --verbose $(pwd)
+readonly cd ${HOME} ${HOME} test export cd 'quoted text' then then
+		readonly awk "$@" export $(pwd) local ${HOME} x=1 cd $(pwd) done -eu echo "$1" ${HOME}
+	| "$@" --verbose readonly 2>/dev/null test awk "$1" | ${HOME} export 'quoted text'
+		"$1" sed export "$@" echo
+		x=1 --verbose 'quoted text' readonly
+2>/dev/null done printf echo cd /usr/bin local 2>/dev/null
+readonly "$1" echo export x=1 echo --verbose &&
+	readonly $(pwd) done "$1" awk
+		grep sed export /usr/bin readonly "$1" --verbose done done sed echo
+		$(pwd) awk -eu cd printf sed cd --verbose x=1 echo local
+	x=1 local cd /usr/bin $(pwd) echo 'quoted text'
+	"$@" --verbose export export /usr/bin "$@" | $(pwd) readonly local --verbose
+	awk "$@" export x=1 then printf local 'quoted text' ${HOME} export
+cd then cd then readonly --verbose
+	test --verbose --verbose
+printf local $(pwd) "$@" "$@" printf "$1" local grep
+		${HOME} printf /usr/bin --verbose sed "$1" && ${HOME}
+x=1 -eu printf && "$1" readonly local local 'quoted text' readonly
+--verbose -eu echo awk test $(pwd) x=1
+		${HOME} done grep 2>/dev/null
+	-eu && 'quoted text' /usr/bin | x=1 sed 'quoted text' export sed readonly ${HOME}
+then echo && 2>/dev/null x=1 printf -eu
+	export $(pwd) echo done readonly done
+	cd readonly /usr/bin grep local then /usr/bin local readonly
+	/usr/bin $(pwd) readonly && then then 2>/dev/null
+		cd readonly -eu | /usr/bin export
+"$@" echo local test $(pwd) echo | grep printf "$1" --verbose
+		export awk "$1" "$@" "$1" printf
+	"$1" then grep ${HOME} 'quoted text'
+	'quoted text' awk -eu ${HOME}
+local echo echo /usr/bin grep sed /usr/bin export
+		"$1" x=1 awk awk | 'quoted text' ${HOME} local x=1 && 'quoted text'
+	/usr/bin readonly "$1" grep echo readonly
+		| test test export cd printf "$1" then export "$1" grep
+/usr/bin grep echo $(pwd) --verbose "$1" -eu 2>/dev/null
+		x=1 export done 'quoted text' done awk | then awk 'quoted text'
+		-eu && grep cd grep -eu awk &&
+	test -eu --verbose && 'quoted text'
+local 'quoted text' then | then "$1" echo export
+	"$@" readonly echo -eu -eu awk ${HOME} 2>/dev/null -eu | grep
+&& printf "$@" then 2>/dev/null readonly test grep -eu printf 2>/dev/null
+		then echo ${HOME} grep | ${HOME} local ${HOME} && 'quoted text'
+	echo $(pwd) then readonly && $(pwd) echo sed local export
+| echo readonly grep local --verbose "$1" awk local sed
+	printf echo local "$@" && x=1 printf export && sed readonly printf
+	--verbose then x=1 local /usr/bin grep
+readonly sed echo ${HOME} -eu awk --verbose
+'quoted text' readonly printf ${HOME} grep grep awk
+		$(pwd) /usr/bin "$1" "$1" then 2>/dev/null
+		${HOME} done cd | && ${HOME} local | test --verbose | test
+--verbose cd ${HOME} test echo 'quoted text' "$@" | test "$@"
+	2>/dev/null readonly && 'quoted text' then echo --verbose sed export /usr/bin
+	echo /usr/bin $(pwd) "$1" readonly -eu 'quoted text' then echo "$@" cd local
+		readonly grep | 'quoted text' awk cd local then cd cd 2>/dev/null grep x=1
+-eu awk 'quoted text' | awk readonly
+awk echo x=1 grep echo ${HOME}
+	echo local printf done
+		done --verbose done x=1 test echo "$1" echo grep 'quoted text'
+		export done echo --verbose awk ${HOME} -eu export done then readonly /usr/bin
+	local export && cd readonly "$1" grep
+&& -eu done -eu 'quoted text' $(pwd) awk --verbose
+		'quoted text' sed then ${HOME}
+'quoted text' then test grep printf readonly "$1" "$1" ${HOME} 2>/dev/null awk
+		-eu local local echo done "$@" readonly export -eu grep
+| export "$@" "$@" --verbose cd | sed
+	2>/dev/null -eu | ${HOME} /usr/bin $(pwd) readonly x=1 awk done | "$1" 2>/dev/null
+		awk export | && ${HOME} $(pwd) grep --verbose grep "$@"
+--verbose x=1 awk sed sed grep $(pwd) "$@" local && 2>/dev/null "$@" readonly
+		local $(pwd) awk /usr/bin printf 2>/dev/null grep cd printf
+	then awk export $(pwd) "$1" x=1 grep printf /usr/bin
+$(pwd) grep sed then local done && echo $(pwd) echo | export "$1" printf -eu &&
+		2>/dev/null cd --verbose echo echo "$1" echo readonly local "$@" -eu
+	echo grep | local $(pwd) printf
+| -eu 2>/dev/null ${HOME} "$1" x=1 "$1" echo "$1" | readonly export "$@"
+	grep sed /usr/bin ${HOME} awk 'quoted text' -eu 'quoted text'
+	"$@" "$@" done readonly "$@" local
+		sed test --verbose then export cd grep 2>/dev/null cd then
+sed sed cd "$1" test local awk 2>/dev/null x=1 awk done then
+		printf /usr/bin local test
+	${HOME} 2>/dev/null then 2>/dev/null -eu "$@" && sed readonly
+		test done "$1" done "$1" x=1 -eu x=1
+then sed 'quoted text' export --verbose
+	then $(pwd) 2>/dev/null echo
+		"$1" 'quoted text' | printf 2>/dev/null readonly | 'quoted text' local sed then
+		grep awk local export x=1 "$@" --verbose local sed ${HOME} echo 2>/dev/null
+		readonly /usr/bin 'quoted text' done | /usr/bin
+	| 2>/dev/null printf ${HOME} test done -eu && readonly
+	awk printf --verbose "$@" echo grep echo printf
+		x=1 2>/dev/null | cd readonly
+		--verbose awk sed ${HOME} test grep 'quoted text' $(pwd)
+		sed && done export 'quoted text' printf done 2>/dev/null export export -eu
+		test done done done && $(pwd) $(pwd) export "$@" $(pwd) printf
+"$@" "$@" ${HOME} --verbose 'quoted text' local --verbose "$@"
+	2>/dev/null -eu grep 2>/dev/null done x=1 $(pwd) echo
+		then -eu -eu grep 'quoted text' done --verbose export export $(pwd)
+local readonly ${HOME} 2>/dev/null ${HOME} cd
+		${HOME} 'quoted text' && $(pwd) cd ${HOME} x=1 ${HOME} export
+		export printf awk sed "$1" && then --verbose local sed /usr/bin -eu "$@"
+sed ${HOME} 'quoted text'
+| "$@" export $(pwd) --verbose && echo /usr/bin sed
+		| "$@" grep then then /usr/bin
+		-eu then x=1 grep sed "$1"
+		test -eu x=1 local && awk local "$@"
+	${HOME} sed cd local printf sed sed | local sed 2>/dev/null | -eu && readonly
+	printf $(pwd) | 2>/dev/null done x=1 test
+		-eu 'quoted text' && "$@" then echo done printf cd local readonly x=1 && $(pwd)
+done 2>/dev/null "$1" cd ${HOME} 'quoted text' | /usr/bin export
+	"$1" -eu done done 'quoted text'
+		&& readonly -eu x=1 test "$@" sed echo awk
+	local grep -eu then printf cd awk done done
+2>/dev/null echo /usr/bin | local --verbose 2>/dev/null awk 'quoted text'
+	${HOME} /usr/bin 'quoted text' $(pwd) sed readonly -eu x=1 "$1"
+	-eu local --verbose cd $(pwd) awk
+		x=1 cd test export sed awk test export |
+'quoted text' echo && printf &&
+	sed && /usr/bin "$@" ${HOME} 'quoted text'
+	echo $(pwd) $(pwd) | 'quoted text' $(pwd) /usr/bin | x=1 echo
+done ${HOME} --verbose awk ${HOME} readonly grep then && | grep | | echo test cd
+	-eu --verbose done && export printf ${HOME} done
+	done export echo export "$@" echo ${HOME} "$1" readonly sed awk -eu 2>/dev/null
+		sed ${HOME} --verbose 'quoted text'
+		grep printf echo readonly x=1
+		then cd 'quoted text' | /usr/bin 2>/dev/null test then "$1" export 'quoted text'
+2>/dev/null done awk x=1 "$1" x=1 | sed
+	-eu local ${HOME} "$@" printf readonly test sed 2>/dev/null
+		awk --verbose 2>/dev/null cd local awk export done awk awk printf
+/usr/bin readonly 'quoted text' /usr/bin awk echo printf export cd awk 2>/dev/null
+	awk awk readonly local cd $(pwd) 2>/dev/null readonly | $(pwd) 'quoted text'
+test test sed 2>/dev/null
+2>/dev/null sed /usr/bin 'quoted text'
+then 'quoted text' done test local 2>/dev/null grep echo && -eu done
+		readonly echo test 'quoted text' "$1" printf cd local echo "$@" $(pwd) then
+		/usr/bin 'quoted text' export "$@" 'quoted text'
+awk | | cd && /usr/bin "$@" export export "$1" done -eu
+		"$1" awk cd x=1 test test local "$@" done 'quoted text'
+		"$@" 2>/dev/null readonly awk "$1" && done cd /usr/bin test cd cd then echo
+	printf printf "$@" local ${HOME} awk sed ${HOME} printf
+		$(pwd) 'quoted text' --verbose grep
+2>/dev/null x=1 ${HOME} echo local --verbose 2>/dev/null cd x=1 grep "$@"
+		"$@" 'quoted text' && readonly
+		readonly "$1" export
+	printf grep readonly export cd done $(pwd) awk
+printf cd | -eu test then then grep && local sed --verbose grep "$@" cd "$@"
+	sed $(pwd) /usr/bin readonly -eu $(pwd) readonly
+echo test && 2>/dev/null --verbose
+	printf | awk && echo && done readonly test ${HOME} "$1" grep then sed echo
+	printf export printf awk printf --verbose /usr/bin $(pwd) | $(pwd) --verbose printf
+cd -eu cd -eu awk cd x=1 test /usr/bin ${HOME} done /usr/bin x=1 /usr/bin
+	--verbose cd "$@" cd done cd sed grep 'quoted text' cd | "$@" --verbose readonly
+| ${HOME} $(pwd) --verbose
+-eu 'quoted text' test cd awk sed sed export && sed && "$1" --verbose echo
+echo test done x=1 export done awk /usr/bin readonly awk awk printf echo
+	x=1 sed done ${HOME} -eu then 2>/dev/null --verbose awk echo echo export readonly
+	echo local awk -eu | x=1 2>/dev/null echo local && grep -eu printf
+&& -eu echo export "$1" "$1" test readonly "$@" 2>/dev/null sed "$@"
+		readonly "$1" 'quoted text' -eu | -eu 2>/dev/null grep && then
+		'quoted text' sed readonly /usr/bin local $(pwd)
+	local --verbose readonly printf export done --verbose "$1" /usr/bin
+	cd done /usr/bin grep echo && 'quoted text' 2>/dev/null cd local
+printf $(pwd) 2>/dev/null echo then | awk | && echo | test local
+readonly "$1" x=1 sed "$1" readonly $(pwd) export
+	${HOME} test | "$1" awk grep test && awk local
+--verbose "$@" export awk export awk --verbose --verbose
+		/usr/bin local $(pwd) "$1" sed sed readonly grep "$@" /usr/bin $(pwd)
+		cd 2>/dev/null printf -eu "$1" printf echo test &&
+done ${HOME} grep 2>/dev/null | local | export 'quoted text' export
+	/usr/bin ${HOME} printf x=1 export
+		| done /usr/bin | awk test $(pwd) readonly "$@" export test done 'quoted text'
+-eu -eu x=1 --verbose x=1 -eu && printf test --verbose export "$1" && 2>/dev/null
+		${HOME} readonly export awk readonly
+		echo "$1" --verbose readonly awk done done test /usr/bin |
+test 'quoted text' export ${HOME} $(pwd) --verbose $(pwd) grep
+--verbose test --verbose x=1 sed readonly echo then
+sed export 2>/dev/null awk /usr/bin "$1" cd | "$1" "$1" |
+$(pwd) 2>/dev/null 2>/dev/null
+/usr/bin cd /usr/bin 'quoted text' echo
+	grep 'quoted text' grep $(pwd) -eu && echo /usr/bin -eu then readonly --verbose
+		then "$@" | local sed && | -eu
+		| 2>/dev/null echo export 2>/dev/null 'quoted text' -eu "$@"
+cd $(pwd) grep && 2>/dev/null x=1 local then local -eu printf 2>/dev/null
+echo ${HOME} "$1" && -eu "$@" cd $(pwd) sed 'quoted text' sed
+printf awk test test --verbose printf /usr/bin
+"$@" --verbose /usr/bin sed /usr/bin -eu 'quoted text' "$1" printf then
+		-eu test -eu export 'quoted text'
+| $(pwd) "$1" | grep x=1 cd 2>/dev/null "$1" $(pwd) sed $(pwd)
+| then local -eu x=1 then $(pwd) "$1" then x=1 awk cd ${HOME} ${HOME} sed "$1"
+		echo "$1" 2>/dev/null x=1 && done 2>/dev/null ${HOME}
+	echo 'quoted text' printf 2>/dev/null cd -eu 'quoted text' local test 2>/dev/null
+		&& then 'quoted text' sed export test "$1" "$@" then local awk "$1"
+		x=1 2>/dev/null /usr/bin done -eu awk export local
+x=1 export cd 'quoted text'
+	sed cd cd -eu "$1" echo cd ${HOME}
+		echo ${HOME} ${HOME} "$1" ${HOME} 'quoted text' local "$1" "$@"
+	grep -eu then ${HOME} -eu readonly x=1 /usr/bin
+	test --verbose grep --verbose sed local "$1" printf local
+echo "$@" readonly printf
+echo export "$@" $(pwd) test "$1" && "$@"
+'quoted text' && -eu && | echo --verbose /usr/bin && -eu $(pwd) $(pwd)
+		printf | echo && | grep 'quoted text'
+export test 'quoted text' | cd && && && | local -eu
+	&& test local printf -eu local printf readonly -eu grep
+	'quoted text' $(pwd) $(pwd) printf grep printf | ${HOME} test sed local
+	"$@" cd printf | x=1 sed "$1" 2>/dev/null
+	grep echo 'quoted text'
+	-eu grep | test /usr/bin -eu 2>/dev/null cd test /usr/bin printf ${HOME} echo
+"$@" test --verbose export
+		awk test | readonly "$1" 'quoted text' export $(pwd)
+/usr/bin -eu then "$@" x=1 sed grep 2>/dev/null 'quoted text' grep
+	&& local awk cd sed grep
+	$(pwd) --verbose awk 2>/dev/null
+		${HOME} && test sed | sed readonly export export --verbose done "$@" ${HOME}
+echo done readonly export awk done grep && sed "$@"
+cd local export grep readonly cd sed -eu --verbose | x=1 $(pwd)
+	printf cd /usr/bin /usr/bin awk
+test sed sed -eu echo awk echo x=1 export done printf grep awk | local printf
+		"$@" test grep readonly export ${HOME} && printf x=1
+	awk $(pwd) grep printf awk -eu -eu printf grep awk && readonly 2>/dev/null
+	printf echo "$@" x=1 "$1" test done readonly sed && && readonly export 2>/dev/null
+x=1 "$1" local && "$@" sed export "$1"
+	cd 2>/dev/null awk readonly
+$(pwd) sed cd echo awk
+echo export $(pwd) awk | && then
+	cd ${HOME} "$1" grep export
+	"$1" export "$@" /usr/bin $(pwd)
+&& done export printf cd -eu local awk /usr/bin done ${HOME}
+	/usr/bin /usr/bin --verbose printf test awk sed grep -eu
+'quoted text' 'quoted text' awk awk 'quoted text'
+		'quoted text' printf then cd && local cd export ${HOME} "$@" grep test
+		'quoted text' printf && done
+		x=1 | export 2>/dev/null grep
+	printf local done | x=1 "$1" echo && cd printf | awk echo /usr/bin test /usr/bin
+	-eu /usr/bin local 'quoted text' test 'quoted text'
+		${HOME} local && awk done local sed "$1" cd --verbose
+echo sed printf "$@" /usr/bin ${HOME} "$1" ${HOME}
+	printf sed && 2>/dev/null echo -eu awk awk export export export
+	'quoted text' "$1" | awk $(pwd) then awk readonly local export "$1" | &&
+	sed then /usr/bin grep local 2>/dev/null 2>/dev/null
+| sed awk done awk cd && awk "$@" export printf export "$1" /usr/bin export
+printf "$@" awk ${HOME} x=1 local | /usr/bin local grep then readonly
+		'quoted text' done then
+		| printf "$@" done && done echo && && awk /usr/bin
+	--verbose cd local then readonly grep test export 'quoted text'
+		x=1 then test local cd printf |
+-eu echo --verbose $(pwd) grep sed x=1 awk --verbose 2>/dev/null "$@" --verbose
+local && "$1" grep ${HOME} x=1 then | $(pwd) done -eu | $(pwd)
+	--verbose "$@" awk "$@"
+&& done 2>/dev/null -eu readonly readonly echo done ${HOME} sed
+		readonly test -eu sed ${HOME} "$1" ${HOME} 2>/dev/null
+	then echo /usr/bin | test cd done -eu
+		$(pwd) "$1" sed x=1 "$@" grep && 2>/dev/null
+		then $(pwd) echo test local
+	-eu 2>/dev/null grep readonly test test export awk echo cd awk
+	printf --verbose test $(pwd) ${HOME}
+	printf then | 2>/dev/null ${HOME} then | $(pwd) cd local
+		printf cd done awk echo --verbose then
+		echo awk printf "$@" --verbose awk /usr/bin $(pwd) grep then awk done 2>/dev/null
+&& export 'quoted text' $(pwd) export
+printf --verbose readonly $(pwd) "$1" then grep sed | $(pwd) $(pwd)
+	| "$@" /usr/bin -eu "$1" 'quoted text' grep ${HOME} $(pwd) export done printf
+		"$@" grep -eu local --verbose printf 'quoted text' readonly
+| /usr/bin test $(pwd) 2>/dev/null -eu cd x=1 readonly ${HOME} -eu "$@" $(pwd) sed
+		done --verbose grep cd export $(pwd) test echo -eu
+	test sed --verbose test -eu test
+	2>/dev/null --verbose awk /usr/bin readonly $(pwd)
+	awk local /usr/bin 2>/dev/null
+readonly "$1" sed | -eu
+		printf -eu grep awk $(pwd) done sed awk then local ${HOME} ${HOME}
+${HOME} --verbose "$@" done echo printf printf ${HOME} /usr/bin echo test
+	| 'quoted text' test done "$@" local
+		sed then cd echo sed -eu printf printf "$1" sed | | "$@" /usr/bin
+	echo x=1 export | --verbose
+'quoted text' grep export
+#include c110.sh
+2>/dev/null then x=1 then x=1 && 'quoted text'
+		done done | done 'quoted text' x=1 --verbose readonly ${HOME}
+/usr/bin then x=1 -eu "$1" local -eu done 'quoted text' | printf --verbose
+		grep x=1 ${HOME} grep awk /usr/bin test x=1 /usr/bin -eu local done ${HOME}
+	export sed cd grep "$1" sed $(pwd) -eu printf then printf printf
+${HOME} done --verbose awk then "$@" readonly
+	| "$1" 2>/dev/null test printf ${HOME} | &&
+	printf echo | sed awk test then --verbose -eu /usr/bin printf
+		readonly && local "$1" --verbose grep 2>/dev/null ${HOME}
+cd | grep x=1 "$@" awk $(pwd) --verbose ${HOME} && "$@" done
+	2>/dev/null 'quoted text' test awk
+| readonly 2>/dev/null /usr/bin --verbose sed printf x=1 $(pwd) sed printf /usr/bin
+"$1" printf export readonly export "$@"
+	echo test export "$@" ${HOME} then /usr/bin
+		awk printf ${HOME} awk sed $(pwd) "$@" "$1" | $(pwd) sed &&
+		${HOME} /usr/bin | then /usr/bin readonly ${HOME} grep 2>/dev/null && export cd
+$(pwd) /usr/bin && done "$1" && | -eu | sed sed x=1 | printf
+--verbose local sed "$@" local readonly && 'quoted text'
+		| /usr/bin grep 'quoted text' | grep sed /usr/bin x=1 then
+"$@" 'quoted text' export sed --verbose ${HOME} /usr/bin 'quoted text' x=1 -eu &&
+| "$@" "$@" "$@" | "$@" grep export 2>/dev/null grep printf awk local
+'quoted text' --verbose "$1" echo awk
+| awk /usr/bin export x=1 readonly 'quoted text' x=1 local $(pwd) local $(pwd)
+		awk -eu local x=1 x=1 &&
+	then "$@" x=1 echo && grep 'quoted text' 'quoted text'
+		cd grep printf local grep x=1 sed x=1 && export -eu
+export && x=1 "$@" sed x=1 --verbose | | ${HOME} cd 'quoted text'
+	local export && printf readonly 'quoted text' |
+	"$1" "$1" then sed -eu x=1
+2>/dev/null then --verbose &&
+	'quoted text' done 2>/dev/null test ${HOME}
+"$@" test cd export awk "$@" cd -eu
+		local sed 2>/dev/null export sed export awk --verbose
+	readonly | readonly "$1" printf
+		local then then awk /usr/bin -eu printf
+		${HOME} --verbose cd printf
+awk /usr/bin awk x=1 sed readonly export
+		"$1" 2>/dev/null | cd sed cd readonly
+	"$@" "$1" printf -eu printf $(pwd) grep 2>/dev/null then sed cd done $(pwd) grep
+		test awk grep then --verbose printf done sed $(pwd) cd grep readonly local
+		printf awk test echo then done "$@" --verbose
+export local --verbose 2>/dev/null
+cd && x=1 --verbose && | "$@" "$@" -eu --verbose 'quoted text' -eu cd local "$@"
+	done $(pwd) awk test "$@" then sed
+test printf && grep export grep --verbose /usr/bin
+${HOME} readonly printf test ${HOME}
+		test sed cd printf grep grep ${HOME} echo && test && printf "$@" export
+awk echo /usr/bin test printf
+-eu test printf then 2>/dev/null ${HOME} | /usr/bin
+	readonly export export --verbose
+	done then | grep -eu /usr/bin --verbose local done | then -eu cd
+printf "$@" "$@" x=1 | --verbose && local ${HOME}
+		$(pwd) export 'quoted text'
+		echo --verbose && echo cd -eu local export done $(pwd) echo sed
+		test | awk | 'quoted text' "$1" | echo export export ${HOME}
+${HOME} ${HOME} local x=1 "$1" $(pwd) cd 'quoted text' printf export echo
+done x=1 awk export 'quoted text' 2>/dev/null grep
+		awk printf awk echo awk x=1
+	$(pwd) ${HOME} test ${HOME}
+	"$@" local test local echo 'quoted text' /usr/bin x=1
+	local echo then then | && test $(pwd) printf --verbose test readonly readonly
+	then then grep then && grep 2>/dev/null then "$1" 2>/dev/null | -eu cd
+	printf printf readonly /usr/bin |
+	x=1 "$1" cd awk -eu -eu done cd done readonly |
+printf -eu then done export
+readonly grep --verbose sed | x=1 printf local x=1 local readonly local echo &&
+		export readonly 'quoted text' then /usr/bin
+x=1 -eu | export awk done export x=1 --verbose readonly
+	x=1 done && echo sed grep x=1 local
+		export cd && readonly "$@" done readonly then sed --verbose 2>/dev/null awk 2>/dev/null
+		readonly done echo then
+	'quoted text' "$1" "$@" export
+	local "$1" cd $(pwd) sed grep done --verbose readonly
+		test readonly "$1" "$@" -eu readonly
+	'quoted text' cd && test
+		${HOME} && echo 'quoted text' --verbose done test ${HOME} && 2>/dev/null
+	-eu "$@" -eu -eu echo cd
+echo "$1" readonly readonly ${HOME} awk --verbose export
+		readonly printf awk 2>/dev/null local done && "$@" readonly
+	/usr/bin "$@" 'quoted text' "$@" | local $(pwd)
+--verbose then -eu $(pwd) cd | echo
+	cd done | cd awk cd done
+		export $(pwd) cd ${HOME} 2>/dev/null printf 2>/dev/null printf sed
+	"$1" | sed /usr/bin done $(pwd) && | $(pwd) echo sed x=1 readonly
+		/usr/bin local awk -eu cd ${HOME} echo -eu
+"$@" awk awk "$1" /usr/bin readonly
+	${HOME} | "$@" 'quoted text' && export test $(pwd) sed awk
+"$1" readonly export |
+	-eu /usr/bin /usr/bin grep --verbose
+/usr/bin readonly cd awk $(pwd) --verbose $(pwd)
+export --verbose 'quoted text' | "$1" local echo --verbose readonly
+	| && -eu then then "$1" export -eu cd /usr/bin 'quoted text' readonly
+		echo | printf awk local /usr/bin 'quoted text' && then
+		done x=1 awk local "$1" 'quoted text' printf done sed readonly | | x=1
+/usr/bin local 'quoted text'
+"$@" 2>/dev/null ${HOME} -eu export 'quoted text' grep 2>/dev/null readonly
+		cd grep readonly echo awk done 'quoted text' export x=1 "$1" readonly
+		$(pwd) done x=1 ${HOME} "$1"
+		done $(pwd) export ${HOME} local && grep done x=1 grep
+done /usr/bin then cd cd local -eu done grep sed then done test
+	2>/dev/null 'quoted text' && cd printf awk /usr/bin "$@" done
+test cd -eu "$@" x=1 grep then sed readonly
+local echo -eu --verbose awk 'quoted text' test /usr/bin 2>/dev/null
+		${HOME} --verbose then local "$1" grep then ${HOME} export
+	| printf -eu local cd sed awk "$@" "$1" cd echo "$@"
+'quoted text' test | --verbose readonly --verbose
+	| echo echo "$1" cd printf 2>/dev/null
+		cd awk "$1" 'quoted text' 'quoted text'
+$(pwd) && sed awk printf
+	then sed x=1 "$@" | awk sed printf done
+readonly | echo "$@" readonly echo ${HOME} /usr/bin
+&& "$@" grep test --verbose readonly
+	awk | test x=1 test printf
+/usr/bin printf then x=1 'quoted text' -eu "$1" "$@"
+		awk /usr/bin ${HOME} 2>/dev/null
+		echo printf grep done "$1" -eu printf local
+${HOME} ${HOME} && test "$@" -eu done
+	sed "$@" "$@" ${HOME} 'quoted text' sed -eu && local 'quoted text' -eu --verbose
+		"$1" export sed test /usr/bin grep
+		then then ${HOME} done "$@" export "$1" /usr/bin | awk x=1 "$@" $(pwd)
+		${HOME} ${HOME} done 2>/dev/null then export "$@" export
+local cd -eu local | $(pwd) && readonly -eu sed "$@" awk grep
+	grep --verbose "$1" 2>/dev/null then "$@" printf local "$1" 2>/dev/null
+awk && "$1" local grep awk cd $(pwd) /usr/bin | "$@" ${HOME} export done export
+	x=1 "$1" -eu ${HOME} $(pwd) | 2>/dev/null 'quoted text' awk $(pwd)
+	-eu awk printf readonly $(pwd) echo
+cd test x=1 /usr/bin /usr/bin -eu
+x=1 "$1" readonly sed local && echo
+local export 'quoted text' /usr/bin
+		-eu local -eu $(pwd) 'quoted text' echo awk && /usr/bin $(pwd) awk -eu
+	printf 2>/dev/null | 'quoted text'
+		printf grep "$@" awk then readonly --verbose export export sed /usr/bin
+		done x=1 "$1" then sed -eu --verbose $(pwd) 2>/dev/null /usr/bin 2>/dev/null
+	2>/dev/null x=1 "$1" x=1 readonly 'quoted text' echo printf
+	"$@" cd x=1 "$1" && x=1 ${HOME} "$@" done done
+done x=1 -eu ${HOME} cd | 2>/dev/null --verbose
+readonly 2>/dev/null 'quoted text' awk && test
+-eu printf $(pwd) $(pwd) "$1" echo -eu grep | awk | x=1 -eu awk awk grep
+export "$1" test && done
+done /usr/bin readonly 'quoted text' --verbose -eu sed ${HOME} "$@" $(pwd)
+	| | -eu "$@" 2>/dev/null readonly echo
+local 'quoted text' ${HOME} ${HOME} x=1 then awk done printf | /usr/bin
+	&& printf x=1 printf local
+	$(pwd) 'quoted text' grep
+		printf 'quoted text' export | --verbose test "$1" export -eu local cd sed done
+'quoted text' --verbose readonly
+-eu && done "$@" "$1" "$1" grep awk --verbose sed
+	awk /usr/bin -eu local $(pwd) -eu
+	"$@" /usr/bin grep cd readonly x=1 2>/dev/null --verbose -eu awk sed /usr/bin
+/usr/bin readonly test 2>/dev/null --verbose
+| 'quoted text' 'quoted text' readonly
+$(pwd) cd -eu cd cd then
+		--verbose /usr/bin -eu printf
+x=1 x=1 | "$1" && 2>/dev/null done "$@" sed
+		$(pwd) 2>/dev/null echo 'quoted text' 'quoted text' readonly echo /usr/bin
+grep 2>/dev/null && grep done 2>/dev/null echo
+'quoted text' export x=1 grep test sed readonly export printf
+sed echo then /usr/bin --verbose sed cd "$@" readonly then
+&& done sed -eu "$1" cd readonly done
+	"$1" awk grep export export "$1" awk awk grep sed "$1" grep grep
+printf --verbose 2>/dev/null "$@" x=1 | 2>/dev/null 2>/dev/null
+then done done export cd --verbose cd printf 2>/dev/null awk grep -eu export
+		'quoted text' cd awk cd --verbose $(pwd) "$1" /usr/bin 'quoted text'
+		$(pwd) -eu done $(pwd) export
+'quoted text' echo x=1
+		&& grep /usr/bin "$1" local | && export printf && awk cd test cd readonly
+	awk test sed export awk /usr/bin grep 2>/dev/null local awk -eu && readonly
+		then 'quoted text' -eu
+		x=1 x=1 --verbose then then "$1" done
+	2>/dev/null /usr/bin readonly done "$1" && /usr/bin
+echo /usr/bin /usr/bin 2>/dev/null export x=1 /usr/bin &&
+		export && | printf done x=1 sed export printf && -eu /usr/bin
+	"$@" "$1" readonly $(pwd) done echo /usr/bin -eu then sed test --verbose sed
+export "$1" | x=1 "$@" x=1 | awk cd export export -eu cd $(pwd) ${HOME}
+		printf ${HOME} readonly export printf x=1 | export "$@" -eu $(pwd) local "$1"
+	$(pwd) --verbose test x=1 2>/dev/null echo --verbose x=1
+	/usr/bin $(pwd) | "$@" test awk readonly "$1" "$1" $(pwd) printf done
+		| "$1" ${HOME} && "$@" "$@" ${HOME} local awk 'quoted text' &&
+cd ${HOME} done 'quoted text' -eu | done
+		&& test && done && sed readonly 2>/dev/null
+		2>/dev/null "$@" | "$@" echo 'quoted text'
+		done test $(pwd) | export test echo x=1 local 2>/dev/null 2>/dev/null
+printf then -eu export "$@" && local then export | export grep
+test grep local ${HOME}
+cd && x=1 "$@" export $(pwd) cd ${HOME} $(pwd) done 2>/dev/null readonly
+	then -eu "$@" test ${HOME} test
+		--verbose $(pwd) 'quoted text' grep $(pwd) x=1 done --verbose export
+	-eu $(pwd) test x=1 test sed 'quoted text' /usr/bin awk /usr/bin "$@"
+local printf /usr/bin done
+	"$@" then grep export ${HOME} test readonly echo
+	'quoted text' "$1" ${HOME} done cd printf echo done local --verbose /usr/bin
+		cd cd printf cd readonly awk ${HOME} awk awk printf local test echo cd test
+		"$@" export echo local && sed "$1" echo && printf sed --verbose "$@" 2>/dev/null
+	-eu 'quoted text' -eu "$1" then x=1 /usr/bin $(pwd) /usr/bin done "$1"
+		awk -eu done 'quoted text' x=1 /usr/bin $(pwd) export x=1 && sed && readonly
+		"$@" -eu $(pwd) /usr/bin local
+cd done $(pwd) --verbose then -eu --verbose x=1 readonly && then printf
+	awk "$1" | printf -eu $(pwd) "$1"
+	x=1 'quoted text' | | echo 'quoted text'
+	"$@" local export | then "$1" sed then cd -eu echo awk
+	&& local x=1 awk /usr/bin local
+		2>/dev/null --verbose then 2>/dev/null
+	echo 'quoted text' "$1" export $(pwd) 'quoted text' printf && "$1" --verbose
+grep 2>/dev/null done /usr/bin sed then | | ${HOME} "$1" export local /usr/bin
+		echo export "$@" -eu export then x=1 awk then test | test "$@" printf echo
+test $(pwd) x=1 /usr/bin then echo && echo echo --verbose
+	$(pwd) export "$@" "$@" x=1 test $(pwd) "$@" then test then readonly then
+		cd /usr/bin 2>/dev/null test
+	readonly ${HOME} printf | grep test
+cd sed | local grep "$@" test export awk 2>/dev/null $(pwd) readonly ${HOME}
+		2>/dev/null ${HOME} done export cd cd -eu x=1
+| cd "$@" 'quoted text' ${HOME} /usr/bin 2>/dev/null | test
+	| | awk "$1" --verbose "$1" && awk "$1" printf
+	awk --verbose -eu | $(pwd) 'quoted text'
+		then /usr/bin readonly $(pwd) | export --verbose awk --verbose test then --verbose
+"$1" ${HOME} 'quoted text' sed | ${HOME} 'quoted text'
+test then 2>/dev/null local local $(pwd) grep grep "$1"
+		local grep awk 2>/dev/null | readonly test /usr/bin test test sed "$@"
+	sed local then "$1" cd awk test 2>/dev/null -eu cd x=1 && /usr/bin -eu awk |
+		sed 2>/dev/null ${HOME} 2>/dev/null
+		'quoted text' export "$1" readonly "$1" printf && readonly
+	sed 'quoted text' printf test ${HOME} /usr/bin x=1
+x=1 $(pwd) && export ${HOME}
+	'quoted text' cd 2>/dev/null "$@" $(pwd)
+done sed "$1" cd x=1 $(pwd) $(pwd) readonly readonly
+		| /usr/bin /usr/bin 2>/dev/null $(pwd) sed /usr/bin
+${HOME} local sed 2>/dev/null 2>/dev/null "$1" done readonly | && "$1" ${HOME}
+grep | sed then $(pwd) then /usr/bin --verbose 'quoted text' local local
+	-eu --verbose cd test test cd x=1 -eu sed printf
+	| local 'quoted text' printf
+awk "$@" ${HOME} cd -eu cd grep done test
+test && test awk 'quoted text' echo then local cd test
+	then --verbose done local --verbose printf "$1" /usr/bin ${HOME} x=1 && /usr/bin
+		--verbose export printf --verbose 'quoted text' /usr/bin
+		--verbose test echo |
+| awk grep local echo
+		&& -eu awk printf 2>/dev/null
+	$(pwd) test 'quoted text' readonly done
+		readonly $(pwd) $(pwd) readonly printf local awk ${HOME}
+		then printf readonly /usr/bin done then cd 'quoted text' export printf printf
+		2>/dev/null grep done 'quoted text'
+		echo $(pwd) readonly export echo "$1" | $(pwd) 'quoted text' /usr/bin
+	export | test 'quoted text' cd sed 2>/dev/null -eu | /usr/bin
+"$1" && -eu local x=1 cd ${HOME}
+		/usr/bin x=1 cd /usr/bin done local sed "$@" readonly x=1 test --verbose grep &&
+		"$1" | x=1 cd echo $(pwd) | --verbose "$1" readonly
+		/usr/bin done awk awk --verbose && ${HOME} done grep x=1 cd 'quoted text' test
+	then cd then && 2>/dev/null then grep grep
+	echo cd grep ${HOME} | 'quoted text' /usr/bin
+		sed then local x=1 $(pwd) | 2>/dev/null $(pwd) -eu "$1"
+		"$@" sed done then 'quoted text' readonly awk && x=1 then "$@" readonly
+then /usr/bin x=1 local printf awk 'quoted text' test
+	| -eu ${HOME} echo echo "$1" "$1" test sed local ${HOME} /usr/bin --verbose
+	"$1" && x=1 2>/dev/null
+		readonly /usr/bin test ${HOME} "$@" 'quoted text' | awk x=1 grep sed awk awk test
+	local $(pwd) x=1 readonly readonly awk --verbose 2>/dev/null
+local echo sed x=1 -eu sed done -eu
+/usr/bin done 2>/dev/null ${HOME} "$@" cd grep
+readonly $(pwd) ${HOME} x=1
+	then x=1 /usr/bin | test 2>/dev/null cd && /usr/bin | ${HOME} $(pwd) x=1 -eu "$1"
+		/usr/bin test "$@" x=1 /usr/bin && awk grep then export export x=1 2>/dev/null
+	"$@" cd grep awk test test local sed readonly
+	awk awk test | sed "$@" test "$1" grep ${HOME}
+awk -eu then printf x=1 | | printf | /usr/bin sed awk ${HOME} test done -eu
+local printf grep 2>/dev/null /usr/bin $(pwd) sed
+		local /usr/bin 2>/dev/null 2>/dev/null
+	2>/dev/null | $(pwd) -eu 'quoted text' 'quoted text' grep && export
+grep printf 'quoted text' done awk grep cd "$1" readonly
+		"$@" 'quoted text' 'quoted text' 'quoted text' local
+then awk "$@" readonly test x=1 "$1" then
+		'quoted text' readonly local done cd ${HOME} echo echo echo 'quoted text'
+	/usr/bin --verbose cd "$@" "$@" then --verbose && done cd -eu printf
+	"$1" 'quoted text' echo && then "$1" grep 'quoted text'
+	readonly readonly echo /usr/bin done readonly
+	export cd /usr/bin readonly
+		echo printf /usr/bin awk "$1" then
+		$(pwd) x=1 $(pwd) done x=1 2>/dev/null -eu 'quoted text' grep x=1 $(pwd) readonly
+/usr/bin test echo cd readonly
+		/usr/bin echo "$@" -eu /usr/bin x=1 printf grep export
+		awk sed $(pwd) 'quoted text'
+		-eu | printf /usr/bin ${HOME}
+		2>/dev/null $(pwd) done echo test done ${HOME} x=1 $(pwd) /usr/bin grep 2>/dev/null
+		readonly x=1 "$1" sed && ${HOME} sed
+	done export export test export $(pwd) local local
+		grep printf echo export "$1" -eu echo "$1" cd 'quoted text' test sed then local
+done 'quoted text' grep && local
+	-eu -eu "$1" 'quoted text' test 2>/dev/null
+	echo /usr/bin 'quoted text' done ${HOME} /usr/bin $(pwd) printf
+		printf cd /usr/bin test sed $(pwd) | test -eu | 'quoted text' 2>/dev/null
+grep echo 2>/dev/null printf
+		cd done "$1" /usr/bin readonly grep /usr/bin /usr/bin echo
+		local /usr/bin --verbose done "$@" then 2>/dev/null local $(pwd) 'quoted text'
+		then && test readonly sed done grep then 'quoted text' printf x=1 -eu --verbose
+		/usr/bin cd readonly "$@" -eu then test /usr/bin
+${HOME} | x=1 ${HOME} readonly --verbose
+		done readonly 'quoted text' grep
+"$@" grep printf grep done export
+		cd export /usr/bin "$@" /usr/bin
+cd 2>/dev/null local test local done sed cd test
+	printf grep echo -eu "$@" | grep $(pwd) x=1 grep then
+		2>/dev/null sed 'quoted text' && ${HOME}
+		"$@" cd ${HOME} echo sed $(pwd) --verbose
+	printf then echo | /usr/bin echo /usr/bin 2>/dev/null echo cd
+		$(pwd) grep "$@" | then done readonly x=1 readonly grep
+cd grep 'quoted text' export printf
+		grep ${HOME} --verbose /usr/bin
+x=1 ${HOME} && ${HOME} /usr/bin 'quoted text' echo x=1 "$@"
+	$(pwd) 2>/dev/null readonly
+		sed "$1" then 2>/dev/null done 2>/dev/null cd cd readonly --verbose done
+$(pwd) "$1" --verbose
+		export grep test --verbose printf export echo -eu sed
+	/usr/bin --verbose 2>/dev/null local ${HOME} /usr/bin awk
+		"$@" then echo done test --verbose awk 'quoted text' readonly readonly 'quoted text'
+-eu export sed done printf "$1" -eu test
+		${HOME} awk -eu grep "$@" test echo --verbose printf "$@" local "$1" -eu
+test "$1" --verbose export
+awk -eu $(pwd) readonly awk "$1" test done
+		'quoted text' grep done 'quoted text' "$1" -eu awk local --verbose
+--verbose | local x=1 | readonly ${HOME} | 2>/dev/null ${HOME} "$@"
+x=1 "$1" && --verbose readonly
+| export -eu "$@" 'quoted text'
+	"$1" echo echo 'quoted text' local 2>/dev/null awk -eu
+&& cd 2>/dev/null --verbose 'quoted text'
+		-eu | ${HOME} $(pwd) ${HOME} "$@" 'quoted text'
+		'quoted text' printf ${HOME}
+		sed awk export test --verbose /usr/bin
+	grep 'quoted text' local test -eu "$@"
+	readonly sed $(pwd) ${HOME} then readonly 2>/dev/null
+		${HOME} grep --verbose | done ${HOME} local test awk 'quoted text'
+	2>/dev/null cd "$1" then
+		readonly && --verbose --verbose ${HOME} done
+/usr/bin test x=1 test && then "$1" local
+${HOME} /usr/bin && printf echo
+	printf export printf $(pwd) "$1" ${HOME} "$1" && echo "$1" 2>/dev/null cd awk local
+		${HOME} x=1 | 2>/dev/null 'quoted text'
+		echo printf local done -eu 'quoted text' "$@" then /usr/bin awk
+&& | 2>/dev/null 'quoted text' local printf export awk | sed export cd
+sed sed -eu /usr/bin sed x=1 "$1" local 2>/dev/null
+then 'quoted text' x=1 'quoted text' cd local /usr/bin echo
+		x=1 awk grep then cd echo sed then $(pwd) echo | 2>/dev/null --verbose --verbose
+	${HOME} 'quoted text' local ${HOME}
+		"$@" --verbose "$1" && printf x=1 | /usr/bin -eu -eu -eu 'quoted text' &&
+/usr/bin awk cd readonly 2>/dev/null then export grep grep sed
+	"$1" 'quoted text' -eu readonly
+	"$@" echo "$@" --verbose
+		'quoted text' "$1" then echo --verbose printf ${HOME} grep grep
+		/usr/bin "$1" "$@" grep awk done awk | 2>/dev/null 'quoted text'
+2>/dev/null printf "$@" --verbose --verbose
+		2>/dev/null echo echo sed --verbose "$@" export x=1
+		cd test printf export awk x=1 x=1 awk cd echo then "$1" x=1 then
+	cd printf $(pwd) $(pwd) grep --verbose && awk echo 2>/dev/null
+cd done awk test -eu 2>/dev/null 2>/dev/null local done
+	/usr/bin 2>/dev/null | && /usr/bin /usr/bin then --verbose
+test readonly 'quoted text' sed "$@" "$@" test cd "$1" grep x=1 /usr/bin
+$(pwd) readonly && x=1 ${HOME} export local export echo /usr/bin
+2>/dev/null ${HOME} -eu
+test printf && | && |
+	readonly "$1" -eu ${HOME} grep test | 2>/dev/null sed x=1 test "$1" --verbose local
+2>/dev/null ${HOME} test export awk ${HOME} cd
+		sed local 'quoted text' 2>/dev/null
+	export && 2>/dev/null 2>/dev/null
+	2>/dev/null test "$@" x=1 sed && "$1" echo $(pwd) readonly done
+cd cd printf x=1 'quoted text' -eu "$@" sed local
+		--verbose -eu awk $(pwd) readonly --verbose "$1" ${HOME} awk printf readonly
+/usr/bin then grep printf done --verbose "$1" 2>/dev/null x=1 readonly 2>/dev/null
+	readonly --verbose grep | grep && done "$@"
+	${HOME} -eu echo ${HOME} sed /usr/bin
+		| /usr/bin $(pwd) done local awk x=1 readonly export
+	x=1 ${HOME} printf -eu readonly readonly
+	export awk cd && printf echo printf echo
+	-eu echo sed $(pwd) 'quoted text'
+	cd && 'quoted text' x=1 'quoted text'
+		-eu printf export sed local 2>/dev/null sed done then && -eu && x=1
+		${HOME} "$@" $(pwd) --verbose "$1" echo $(pwd) 2>/dev/null grep echo
+		sed && done --verbose 2>/dev/null --verbose awk
+	/usr/bin export then x=1 | then echo 'quoted text' |
+"$@" x=1 grep --verbose && "$@" 2>/dev/null awk done -eu
+	done awk local printf readonly echo -eu
+test "$@" sed ${HOME} sed done
+	&& "$@" /usr/bin /usr/bin test done cd -eu readonly 'quoted text'
+"$@" awk "$1" test -eu | readonly awk local cd | cd cd $(pwd) then && &&
+		${HOME} readonly "$1" export export sed ${HOME} $(pwd) /usr/bin
+test done cd printf "$1" cd then sed | cd cd then && printf done
+	&& /usr/bin "$@" x=1 readonly sed "$@" printf x=1 test 'quoted text'
+		local "$1" awk done 'quoted text'
+	awk 2>/dev/null export 2>/dev/null /usr/bin ${HOME} /usr/bin
+		"$@" echo done readonly "$@" then done $(pwd) local
+-eu cd test | echo -eu $(pwd) ${HOME}
+		then -eu "$1" "$@" 'quoted text' "$1" then "$@"
+		2>/dev/null "$1" readonly "$@" test "$@" grep ${HOME} 'quoted text'
+	sed x=1 --verbose sed printf awk done $(pwd) grep 'quoted text' x=1 'quoted text'
+sed sed ${HOME} then 'quoted text' "$1" then done /usr/bin awk printf
+$(pwd) $(pwd) export 'quoted text' $(pwd) -eu export 'quoted text' --verbose
+cd readonly /usr/bin printf
+	done && done /usr/bin | 'quoted text'
+	| local export echo test test sed
+&& "$1" test export /usr/bin ${HOME} "$1" export
+| done 'quoted text' && readonly 'quoted text' x=1 grep awk
+echo && -eu done cd done "$1" printf "$@" echo readonly
+	2>/dev/null -eu && done $(pwd) done $(pwd) 'quoted text'
+${HOME} export export grep grep x=1 'quoted text'
+	'quoted text' $(pwd) 2>/dev/null --verbose -eu grep /usr/bin /usr/bin grep ${HOME}
+	--verbose $(pwd) /usr/bin readonly local sed 2>/dev/null | "$1" awk "$1" "$1"
+	&& local $(pwd) "$1" then $(pwd) grep awk grep awk test local then sed test
+		printf "$@" -eu "$1" then printf --verbose /usr/bin "$1" sed
+	echo /usr/bin | ${HOME} cd --verbose
+		sed 'quoted text' export $(pwd) -eu /usr/bin cd done done then "$@" then test readonly
+		"$@" | "$@" --verbose readonly
+		"$1" --verbose 2>/dev/null then printf
+		done printf export && --verbose --verbose echo /usr/bin done /usr/bin "$1"
+	then echo echo $(pwd) /usr/bin then x=1 "$1" "$1" sed
+	| 'quoted text' "$1" grep 'quoted text'
+		then test -eu printf grep sed
+		"$1" readonly grep | "$1" printf && local $(pwd) $(pwd)
+	printf | export x=1 test --verbose
+	printf "$1" 'quoted text' cd | echo ${HOME} "$@" $(pwd) x=1 done &&
+	&& awk local "$@" | x=1 -eu 'quoted text'
+		test awk grep awk then "$@" --verbose /usr/bin
+&& $(pwd) grep done | "$@" "$@" ${HOME} "$@" grep export local awk then sed
+		/usr/bin printf echo awk 'quoted text' "$@" && export local
+	$(pwd) printf 'quoted text' sed -eu /usr/bin
+		done "$@" export "$@" ${HOME} readonly local -eu echo export | -eu
+&& "$@" x=1 then | 2>/dev/null ${HOME} cd
+	$(pwd) | 2>/dev/null done
+readonly 'quoted text' done 2>/dev/null readonly echo then export export | "$@"
+	'quoted text' then done ${HOME} ${HOME} cd --verbose grep x=1 sed x=1
+	then | -eu ${HOME} local local export grep sed x=1 then
+${HOME} sed /usr/bin export "$1" $(pwd) /usr/bin --verbose "$1" test
+		${HOME} x=1 && 'quoted text' done grep
+local printf grep "$1" "$1" local readonly done test
+| awk $(pwd) 'quoted text'
+		| test --verbose /usr/bin
+		test $(pwd) sed then /usr/bin 2>/dev/null done x=1 --verbose done
+	sed 2>/dev/null | -eu | "$1" export grep x=1 export
+	-eu readonly awk cd ${HOME} $(pwd) then export readonly
+		export $(pwd) readonly cd | local export
+		'quoted text' test echo "$1" $(pwd) "$@" export /usr/bin | done 'quoted text'
+		readonly cd done "$1" awk
+		"$1" -eu x=1 && /usr/bin cd echo /usr/bin | $(pwd) /usr/bin 'quoted text'
+	printf cd 'quoted text' done printf ${HOME}
+		local 2>/dev/null awk /usr/bin
+		test ${HOME} && 2>/dev/null
+'quoted text' "$1" --verbose
+		done 2>/dev/null sed "$@" done
+		printf 'quoted text' 'quoted text' sed test then printf awk local --verbose
+then sed printf test 'quoted text' sed sed "$1" done x=1 --verbose
+	local | readonly 2>/dev/null 'quoted text' 2>/dev/null cd /usr/bin
+		echo local cd --verbose 2>/dev/null cd awk done && && grep cd && --verbose printf
+printf readonly x=1 && "$@" 2>/dev/null
+		$(pwd) && grep awk "$@" grep sed echo --verbose "$@"
+	done --verbose 'quoted text'
+	2>/dev/null 2>/dev/null ${HOME} 2>/dev/null export "$1" $(pwd) then then then
+	echo -eu ${HOME} && sed x=1
+		$(pwd) "$1" "$@" 'quoted text' readonly /usr/bin sed ${HOME}
+		${HOME} 2>/dev/null 'quoted text' /usr/bin
+printf echo test /usr/bin
+	sed ${HOME} /usr/bin cd grep $(pwd) && done -eu readonly
+		| grep 2>/dev/null && then &&
+${HOME} x=1 'quoted text' grep done 'quoted text'
+2>/dev/null export ${HOME} "$1" /usr/bin -eu /usr/bin
+		then "$1" awk printf 2>/dev/null --verbose echo -eu done | test ${HOME} test
+		readonly cd "$@" cd export awk readonly /usr/bin --verbose test $(pwd) grep readonly
+	export export $(pwd) sed 2>/dev/null
+then readonly export | awk printf
+then -eu readonly echo awk export grep ${HOME} cd x=1 x=1 awk readonly | ${HOME}
+	"$1" | local -eu "$1" echo --verbose
+	/usr/bin readonly ${HOME} test grep -eu && export | test grep test sed 2>/dev/null
+	local echo then local ${HOME} echo sed cd
+then 2>/dev/null 'quoted text' -eu && done 2>/dev/null
+	&& echo done 2>/dev/null | -eu | ${HOME} "$@" done test awk sed
+	&& $(pwd) cd && "$@" /usr/bin --verbose 'quoted text' | cd
+		${HOME} "$@" printf sed x=1 local
+		cd --verbose readonly cd | "$@" ${HOME} cd 2>/dev/null -eu
+local local echo export readonly && "$1" sed test cd grep grep grep "$1"
+		test /usr/bin then "$@" grep test local readonly sed done done
+	sed /usr/bin && && sed echo
+$(pwd) cd test x=1 $(pwd) readonly
+		"$@" && done test export echo export $(pwd) ${HOME} "$@" done $(pwd) --verbose
+		sed test done grep ${HOME} local local awk
+		grep sed 'quoted text' 2>/dev/null done | 2>/dev/null printf --verbose
+	"$1" "$1" awk printf done /usr/bin
+&& "$@" | cd echo /usr/bin | --verbose $(pwd) then export export
+		echo --verbose done awk | --verbose then readonly
+		local done then awk local awk "$1" then /usr/bin awk printf "$@"
+		x=1 export then x=1 grep test | /usr/bin cd local -eu ${HOME}
+		--verbose /usr/bin grep test && ${HOME} printf sed grep ${HOME}
+	$(pwd) --verbose && $(pwd) echo then --verbose $(pwd) $(pwd)
+		${HOME} done then x=1 | x=1 done cd 2>/dev/null
+grep -eu awk -eu /usr/bin cd done --verbose printf
+printf ${HOME} 2>/dev/null "$@" done
+		test then grep && 2>/dev/null test test printf x=1 "$1" then
+		then printf 2>/dev/null 'quoted text'
+2>/dev/null echo "$1" echo
+grep $(pwd) printf && then sed 'quoted text' -eu readonly --verbose x=1 | "$@"
+		&& awk cd then ${HOME} cd "$1" test
+	"$1" local export -eu /usr/bin $(pwd) grep grep
+		printf "$1" 2>/dev/null && "$@" readonly "$1" 'quoted text' awk -eu /usr/bin
+2>/dev/null --verbose awk test done /usr/bin
+	readonly grep -eu "$@" awk "$1" echo then printf /usr/bin done
+done | | "$1" echo export
+		$(pwd) echo echo x=1 "$@" -eu $(pwd) printf
+	sed readonly printf $(pwd)
+readonly test grep | "$1" done then test --verbose -eu echo 'quoted text'
+		then ${HOME} export -eu | printf && x=1 export test 'quoted text'
+'quoted text' 'quoted text' --verbose cd $(pwd) $(pwd) ${HOME} && printf
+		-eu printf awk -eu then then ${HOME} | 2>/dev/null
+&& ${HOME} printf && x=1 | awk |
+export awk $(pwd) done grep x=1 "$@" cd grep $(pwd) --verbose 2>/dev/null "$@"
+awk 2>/dev/null awk done printf local ${HOME} export printf
+	test sed test grep readonly printf awk "$1" "$1" $(pwd)
+| /usr/bin $(pwd) /usr/bin
+	&& 2>/dev/null cd && echo awk | -eu awk
+	test sed /usr/bin | "$@" "$@" "$1" /usr/bin x=1 echo
+		then awk 'quoted text'
+	test | /usr/bin test "$@" printf $(pwd) | local grep local /usr/bin test $(pwd)
+		&& | --verbose $(pwd) "$@" 'quoted text' then test
+printf then -eu test then readonly | /usr/bin 2>/dev/null
+	'quoted text' ${HOME} --verbose then grep -eu readonly test cd --verbose
+grep /usr/bin export /usr/bin
+		export local cd x=1 awk awk ${HOME} printf /usr/bin "$1" done local -eu grep
+grep grep printf /usr/bin 'quoted text'
+		"$@" "$@" 'quoted text' readonly 'quoted text' 'quoted text'
+		| test local "$1" && "$@" $(pwd) "$@" -eu "$@" "$1" readonly "$@"
+${HOME} echo grep 'quoted text' ${HOME} then 'quoted text'
+printf | echo -eu cd && 'quoted text' awk grep test && grep ${HOME}
+	"$1" x=1 grep export sed done ${HOME} local "$@" sed | done "$@" cd printf
+2>/dev/null "$@" $(pwd)
+	&& "$@" --verbose grep && && $(pwd)
+		"$1" --verbose printf echo /usr/bin test
+		grep sed $(pwd) grep readonly cd /usr/bin | sed ${HOME} export then done
+	/usr/bin ${HOME} grep sed sed
+		x=1 $(pwd) /usr/bin ${HOME} /usr/bin echo awk echo
+	'quoted text' test readonly
+		"$@" "$@" | 'quoted text' x=1
+		awk printf export cd | "$@" test printf ${HOME} echo 2>/dev/null
+		cd x=1 export awk sed done 2>/dev/null --verbose x=1 test
+		-eu -eu then sed sed | /usr/bin
+		then grep cd | sed $(pwd) sed | then then /usr/bin x=1 | "$@" | && cd "$1" export
+local printf $(pwd) /usr/bin "$@" 'quoted text' cd x=1 awk x=1 echo "$@"
+		echo cd printf --verbose grep /usr/bin
+		sed "$@" test sed printf echo echo export cd -eu 'quoted text'
+		test test 2>/dev/null echo awk | ${HOME}
+		readonly 2>/dev/null cd grep /usr/bin then
+		"$@" sed "$@" awk local $(pwd) $(pwd) -eu "$@" $(pwd) 2>/dev/null "$@"
+		| local readonly echo -eu --verbose | $(pwd) test
+$(pwd) echo /usr/bin "$@" 2>/dev/null x=1 "$@" sed done ${HOME}
+"$@" 2>/dev/null -eu "$1" cd 'quoted text'
+	/usr/bin done test | test grep "$@" | -eu $(pwd) readonly echo readonly
+	"$@" awk grep 2>/dev/null | test | $(pwd) printf grep -eu --verbose printf
+-eu test grep ${HOME} echo &&
+'quoted text' "$@" cd done then 'quoted text' x=1 readonly
+	grep done then /usr/bin awk --verbose sed
+		--verbose /usr/bin export readonly
+&& -eu "$1" readonly x=1 cd echo
+grep ${HOME} awk grep && -eu "$@" && $(pwd)
+		| sed x=1 test awk printf echo echo test x=1 -eu
+	$(pwd) then then export -eu "$1" && local 'quoted text' local -eu x=1 done
+	echo local local export printf && echo awk "$@" /usr/bin ${HOME}
+	2>/dev/null echo printf local
+		local cd then test -eu 'quoted text' | $(pwd)
+	x=1 done --verbose sed export sed
+	${HOME} 'quoted text' readonly -eu 'quoted text'
+		readonly -eu local sed readonly test cd "$@" done test done
+	then 'quoted text' 2>/dev/null --verbose grep ${HOME}
+	export ${HOME} -eu cd ${HOME} ${HOME} cd /usr/bin awk
+test grep "$@" /usr/bin x=1 sed && awk "$@" then local -eu |
+		test readonly echo "$1" /usr/bin grep 2>/dev/null
+echo 2>/dev/null x=1 grep printf "$@"
+		readonly --verbose sed "$1" readonly $(pwd) grep grep local ${HOME}
+		'quoted text' awk | -eu echo x=1 awk "$@" ${HOME} printf
+/usr/bin /usr/bin $(pwd) $(pwd)
+	done 'quoted text' ${HOME} | "$1" readonly test printf
+echo $(pwd) "$@" ${HOME} sed 2>/dev/null sed test "$1" && test export
+	readonly | printf awk "$1" sed ${HOME}
+	2>/dev/null local grep printf && grep export && cd then readonly done export |
+	printf 2>/dev/null -eu cd local -eu echo printf /usr/bin
+		'quoted text' awk local export echo readonly export 2>/dev/null
+$(pwd) "$@" | "$1" export x=1 2>/dev/null | $(pwd) x=1 /usr/bin done sed
+&& 'quoted text' local readonly readonly grep done 'quoted text' local | local
+	test local then "$@" -eu /usr/bin "$1"
+sed /usr/bin awk echo echo "$@" readonly local --verbose --verbose echo
+--verbose $(pwd) then local "$1" /usr/bin 2>/dev/null /usr/bin
+		"$@" 'quoted text' "$1" "$1" done "$1" | --verbose readonly
+		2>/dev/null then 2>/dev/null grep grep
+	$(pwd) 2>/dev/null | && 'quoted text' && "$1" grep -eu export
+	| awk ${HOME} ${HOME} --verbose -eu && local "$1" sed "$1" 2>/dev/null &&
+		cd done then && readonly "$1" x=1 local -eu cd then | local then export
+cd test ${HOME} test cd local printf printf "$@" 2>/dev/null
+	2>/dev/null readonly "$1" echo 'quoted text' awk 'quoted text'
+	local | printf echo $(pwd) /usr/bin "$1" && "$1" awk -eu cd printf x=1 x=1
+-eu export test "$@" sed $(pwd)
+${HOME} "$1" ${HOME} done sed --verbose export
+local echo done local printf then readonly /usr/bin awk
+		--verbose test printf printf cd grep x=1 export
+		$(pwd) ${HOME} 2>/dev/null /usr/bin echo
+"$1" "$@" x=1 "$1" | "$1" cd "$@" printf test sed awk /usr/bin && printf ${HOME}
+		then "$1" readonly printf local echo ${HOME}
+	local "$@" readonly grep echo /usr/bin "$@"
+		test x=1 | export export then awk printf then | local $(pwd)
+test done awk | export --verbose "$@" then readonly echo ${HOME} done cd
+		sed /usr/bin grep && "$1" | printf
+'quoted text' | 2>/dev/null local "$1" readonly $(pwd) grep --verbose "$@" -eu
+		x=1 ${HOME} 2>/dev/null printf cd && done done | test
+		"$1" sed x=1 2>/dev/null
+	-eu x=1 && cd | && local readonly "$1"
+		then && awk cd echo local /usr/bin sed $(pwd) | | sed done
+	"$@" | echo local $(pwd) then $(pwd) "$@" then sed cd printf export test awk
+		'quoted text' ${HOME} 2>/dev/null test /usr/bin 2>/dev/null
+		cd 'quoted text' --verbose "$1" |
+		${HOME} x=1 && | local done
+export done export $(pwd) 2>/dev/null $(pwd) then printf echo then done sed
+		-eu awk export awk 2>/dev/null "$1" sed -eu 2>/dev/null x=1 awk ${HOME} awk 'quoted text'
+	local x=1 cd then cd $(pwd) && "$@" done "$1" --verbose echo -eu local | then
+"$@" echo export awk | export x=1 'quoted text' --verbose "$@" sed /usr/bin
+	$(pwd) test && $(pwd)
+		"$1" ${HOME} grep -eu sed /usr/bin done echo -eu "$@" 2>/dev/null readonly
+	readonly && "$@" 'quoted text' awk "$1" $(pwd) printf "$@" then ${HOME} sed
+		x=1 | 'quoted text' "$1" local local ${HOME} export awk local local grep grep
+	${HOME} test $(pwd) 2>/dev/null done grep test && $(pwd) -eu 'quoted text' /usr/bin
+		export /usr/bin 2>/dev/null ${HOME} local --verbose sed test /usr/bin
+	-eu x=1 2>/dev/null cd "$@" "$1" awk "$@" ${HOME} 'quoted text' test test
+	grep --verbose x=1 echo 'quoted text' then local grep -eu "$1" done $(pwd)
+	grep -eu 2>/dev/null then && printf --verbose /usr/bin export awk 2>/dev/null
+		cd ${HOME} x=1 awk 2>/dev/null 'quoted text' local
+readonly echo printf local sed && printf local done test 'quoted text' 'quoted text'
+		printf 'quoted text' sed "$1" | --verbose then $(pwd)
+		done readonly test x=1 -eu 'quoted text' $(pwd) x=1 then ${HOME} ${HOME} $(pwd)
+		cd done grep done 'quoted text' --verbose sed done $(pwd)
+	then x=1 "$1" 2>/dev/null ${HOME} export -eu done export --verbose --verbose
+		"$1" 'quoted text' | readonly
+		| ${HOME} --verbose x=1 x=1 2>/dev/null
+		cd cd --verbose local local | export then -eu 2>/dev/null /usr/bin
+		-eu 2>/dev/null awk then -eu local /usr/bin
+		awk | 'quoted text' && local
+$(pwd) "$@" printf "$@" sed sed && sed done test x=1 $(pwd) readonly sed test
+		grep printf ${HOME} 2>/dev/null
+	/usr/bin readonly -eu "$@" sed echo ${HOME} x=1 local grep
+	then awk "$1" --verbose "$1" export done cd
+	local readonly --verbose 'quoted text' && -eu /usr/bin
+${HOME} done cd grep "$1" local
+	local readonly echo "$1" cd then sed $(pwd) export awk sed ${HOME} x=1
+"$@" printf "$1" then then "$1" /usr/bin 2>/dev/null 'quoted text'
+		done 'quoted text' && $(pwd) sed
+		2>/dev/null && --verbose ${HOME} export | --verbose
+'quoted text' x=1 grep "$1" /usr/bin
+grep && export 'quoted text' "$@" /usr/bin --verbose awk cd test
+local awk awk local export 2>/dev/null
+		done "$@" 'quoted text' readonly ${HOME} ${HOME} cd
+	2>/dev/null sed echo test x=1 -eu /usr/bin export && "$1" done
+"$1" then ${HOME} 'quoted text' then then readonly echo 'quoted text' local export
+	--verbose echo sed test "$@" x=1 && $(pwd) | done done
+'quoted text' local && cd sed $(pwd)
+"$@" --verbose cd --verbose | | printf
+		sed test printf "$@" --verbose
+&& printf $(pwd) printf 'quoted text' 2>/dev/null
+	$(pwd) "$1" printf "$@" readonly -eu | | sed then local 2>/dev/null
+	then done test "$1" echo awk local export test "$1" 'quoted text'
+	x=1 echo echo 'quoted text' readonly
+	awk awk printf done printf printf
+		2>/dev/null 'quoted text' $(pwd) $(pwd) /usr/bin
+/usr/bin local then "$1" export
+		sed "$@" "$1" && x=1 test local ${HOME} /usr/bin
+	done sed then awk printf readonly
+	done grep cd export 'quoted text' 2>/dev/null readonly && done 2>/dev/null
+"$1" local printf x=1 echo test sed ${HOME} -eu --verbose
+		${HOME} $(pwd) test grep -eu
+$(pwd) export printf test sed awk grep ${HOME} 'quoted text' then 2>/dev/null
+&& /usr/bin "$@" readonly && local /usr/bin test --verbose | export test
+"$1" 'quoted text' && x=1 |
+	2>/dev/null then $(pwd) 2>/dev/null --verbose 'quoted text' ${HOME}
+	done 'quoted text' echo --verbose done cd readonly awk 'quoted text'
+	sed "$1" awk local 'quoted text' done
+	x=1 test $(pwd) 'quoted text'
+		2>/dev/null "$@" && grep cd test printf done grep printf -eu grep grep x=1 /usr/bin
+		sed readonly readonly readonly printf sed cd cd /usr/bin
+${HOME} --verbose "$@" | -eu "$1"
+		grep export cd --verbose done /usr/bin x=1 done 2>/dev/null readonly
+	"$@" readonly done $(pwd) 2>/dev/null "$1" then
+	| then printf test 'quoted text'
+'quoted text' sed readonly | ${HOME} sed -eu done
+	-eu local cd x=1 2>/dev/null /usr/bin
+		"$@" $(pwd) readonly local "$1" /usr/bin readonly 2>/dev/null && && echo | /usr/bin
+	local $(pwd) 2>/dev/null
+	/usr/bin echo export ${HOME} $(pwd) 2>/dev/null
+	2>/dev/null 2>/dev/null then $(pwd)
+	'quoted text' grep "$@" "$1" 2>/dev/null awk grep -eu sed $(pwd) 2>/dev/null
+	then x=1 sed printf done /usr/bin cd $(pwd)
+	2>/dev/null export then && readonly done test sed test "$@" local printf
+"$@" readonly printf && | --verbose then
+		export /usr/bin x=1 x=1 $(pwd) --verbose
+	readonly test $(pwd) test readonly then done grep export cd x=1
+	'quoted text' $(pwd) cd && echo cd $(pwd) "$@" "$1" then grep export done printf
+	${HOME} awk test readonly done
+	awk && readonly then && echo done then sed
+$(pwd) printf sed --verbose -eu local -eu awk test export 2>/dev/null
+		echo awk $(pwd) $(pwd) 'quoted text'
+		/usr/bin printf then awk /usr/bin "$1" then --verbose | 'quoted text'
+--verbose then test echo then | test "$1" | awk
+	/usr/bin /usr/bin "$@" "$1" 'quoted text' $(pwd) $(pwd) cd awk local export
+echo x=1 sed awk 2>/dev/null grep x=1 test
+&& then 'quoted text' "$1" then echo -eu sed readonly && $(pwd) cd ${HOME} "$1"
+		x=1 sed 'quoted text' ${HOME}
+'quoted text' printf "$@" grep readonly echo local echo $(pwd)
+	done ${HOME} cd 'quoted text' echo cd export "$1" echo ${HOME} export
+	done grep | readonly 'quoted text' cd printf
+	export "$1" --verbose -eu readonly
+	done then local echo awk awk ${HOME} $(pwd)
+	2>/dev/null test awk readonly sed echo -eu | /usr/bin 'quoted text'
+	'quoted text' cd test readonly $(pwd)
+x=1 "$1" test "$1" /usr/bin
+	then $(pwd) -eu grep 'quoted text' -eu readonly --verbose && --verbose "$@"
+	printf && local printf | sed 2>/dev/null echo | ${HOME} | /usr/bin
+	local echo 'quoted text' then ${HOME}
+'quoted text' export sed --verbose echo -eu grep
+	-eu "$@" printf 'quoted text' then 2>/dev/null /usr/bin 'quoted text'
+	export export ${HOME} readonly local $(pwd) printf
+		printf printf 2>/dev/null --verbose ${HOME} export local awk
+	awk ${HOME} readonly then $(pwd) export 'quoted text'
+		test "$1" -eu && "$1" "$1" 'quoted text' readonly
+		&& export export then "$@" x=1 "$@" cd "$1" then printf awk local readonly
+		-eu test echo readonly test -eu "$1" ${HOME} readonly
+		| 2>/dev/null echo sed "$1" done
+	2>/dev/null --verbose -eu --verbose printf export /usr/bin && cd cd --verbose
+	"$1" export "$1" then /usr/bin
+'quoted text' awk ${HOME}
+		'quoted text' && then 2>/dev/null "$1" ${HOME} cd $(pwd) && echo cd "$1" printf
+-eu sed x=1 cd done "$1" 'quoted text' &&
+	-eu -eu "$1" export 2>/dev/null ${HOME} -eu "$@" x=1 && -eu cd echo /usr/bin
+done done ${HOME} printf 'quoted text' printf printf
+"$1" /usr/bin then | | awk 2>/dev/null done | "$@" --verbose printf awk grep
+| x=1 2>/dev/null export cd "$@" 2>/dev/null
+"$@" /usr/bin echo ${HOME} 'quoted text' awk $(pwd) awk grep
+'quoted text' 'quoted text' sed echo "$@" export
+		/usr/bin local local -eu echo 'quoted text' -eu
+"$1" then done echo /usr/bin cd "$1" then awk $(pwd) | "$1" x=1 $(pwd) | -eu
+export cd sed printf | awk then && printf
+/usr/bin local --verbose | sed 'quoted text' "$1"
+	grep --verbose 'quoted text' cd echo awk
+	grep $(pwd) printf cd /usr/bin $(pwd)
+x=1 /usr/bin sed grep && $(pwd) printf "$@" awk ${HOME} test cd --verbose
+	--verbose && 'quoted text' --verbose cd 2>/dev/null
+	sed readonly --verbose "$@" sed ${HOME} cd printf "$@" sed export
+		then readonly echo awk sed --verbose
+"$@" /usr/bin done then -eu ${HOME} readonly "$1" "$1" "$1" -eu "$1"
+grep sed 'quoted text' cd "$1"
+printf echo export | "$1" | 2>/dev/null | test "$1" 'quoted text' --verbose local
+	export /usr/bin 'quoted text' --verbose && --verbose $(pwd) test && ${HOME} ${HOME}
+'quoted text' grep x=1 /usr/bin awk
+		"$@" sed printf echo && local "$@" cd && grep printf
+sed awk sed then test sed cd cd test && --verbose | printf
+export export awk awk done local echo --verbose
+	cd grep 2>/dev/null x=1 "$@" /usr/bin
+	$(pwd) awk sed x=1 then sed $(pwd) $(pwd) "$@" export echo "$1" export
+	-eu | awk readonly local
+	$(pwd) "$1" done cd $(pwd) local local local
+x=1 local local readonly grep test | && -eu "$1" &&
+		export && done readonly --verbose test printf $(pwd) sed
+	awk "$1" grep "$@" done
+x=1 ${HOME} $(pwd) --verbose
+		local "$1" ${HOME} done 2>/dev/null -eu
+	"$@" sed x=1 cd /usr/bin cd | "$@" test readonly then local printf
+		export "$1" -eu /usr/bin --verbose
+	printf printf "$@" export $(pwd) export export grep echo awk local --verbose grep
+	cd echo && -eu awk echo echo
+	2>/dev/null printf cd cd | 2>/dev/null
+	sed then $(pwd) "$1" ${HOME}
+echo cd local export /usr/bin sed test test grep cd ${HOME} 2>/dev/null
+		x=1 cd "$1" readonly "$@"
+		$(pwd) test readonly 'quoted text'
+	local test done x=1 && cd
+	-eu done "$@" echo 'quoted text' --verbose --verbose x=1 --verbose | $(pwd) 2>/dev/null
+	local "$@" | echo grep | sed | printf readonly
+		sed x=1 | local echo $(pwd) 2>/dev/null
+		--verbose readonly 2>/dev/null
+| 2>/dev/null test "$1" 'quoted text' | x=1 "$@" -eu
+$(pwd) -eu done /usr/bin awk "$1" sed test printf "$1" test grep "$@" "$1" local
+		| $(pwd) readonly "$@" awk -eu sed readonly 2>/dev/null
+	readonly readonly grep test printf "$@" echo
+		&& && --verbose export test
+done ${HOME} && --verbose "$@" 2>/dev/null awk cd awk && | echo echo
+	local readonly test test grep awk echo printf x=1 'quoted text' &&
+		&& echo /usr/bin cd $(pwd) cd printf "$1" 2>/dev/null test "$1" --verbose
+		| cd --verbose 2>/dev/null cd "$1" printf then --verbose
+	| --verbose "$@" export /usr/bin cd && sed x=1 | grep | /usr/bin
+		test && "$1" awk cd test --verbose test grep printf printf |
+		local cd 'quoted text' done export export "$1" -eu $(pwd) export done
+	-eu ${HOME} test test "$@" then done grep export local awk ${HOME}
+		--verbose then "$1" ${HOME} 'quoted text'
+		cd done "$1" ${HOME} x=1 sed printf /usr/bin /usr/bin
+		cd cd echo "$1" 'quoted text' 'quoted text'
+		readonly 2>/dev/null "$1" readonly done printf
+	grep awk $(pwd) $(pwd) && | then /usr/bin sed "$@" then && | /usr/bin
+	/usr/bin done grep export printf export
+echo && --verbose export grep sed awk
+	grep readonly --verbose -eu
+x=1 | && awk awk 2>/dev/null 'quoted text'
+cd x=1 readonly done local cd local x=1 | readonly done -eu done
+	${HOME} echo local ${HOME} && sed printf | awk "$1" cd export && local
+	$(pwd) -eu sed /usr/bin done 'quoted text' sed x=1 printf
+	-eu -eu cd -eu x=1 2>/dev/null -eu ${HOME} -eu
+	2>/dev/null grep "$@" "$1" ${HOME} sed && cd grep grep $(pwd)
+		sed ${HOME} "$1" --verbose
+	export | "$1" sed readonly done test export 2>/dev/null &&
+	printf | -eu --verbose cd local x=1 $(pwd) awk sed cd --verbose
+sed --verbose printf && grep local local $(pwd) -eu 2>/dev/null /usr/bin x=1
+		'quoted text' $(pwd) x=1 --verbose readonly
+2>/dev/null --verbose 2>/dev/null awk | then
+	export -eu local cd export export ${HOME} cd -eu
+	sed then "$@" then sed
+		${HOME} test test | "$@" sed ${HOME} "$@" "$@"
+then then ${HOME} cd | 2>/dev/null x=1
+		2>/dev/null /usr/bin "$@" "$@" 2>/dev/null grep 2>/dev/null sed
+echo local x=1 local x=1 awk local awk -eu
+		'quoted text' readonly done printf
+'quoted text' "$@" readonly awk then awk && "$1" awk /usr/bin grep
+		| echo local printf export echo readonly "$1" local
+x=1 $(pwd) x=1 grep export 'quoted text' "$@" test export
+		export -eu "$@" -eu x=1 x=1 $(pwd) cd | readonly awk "$@" --verbose
+"$1" "$@" "$@" then done readonly "$1" export test
+"$@" x=1 'quoted text' && /usr/bin
+		2>/dev/null 'quoted text' --verbose
+		"$@" cd 2>/dev/null /usr/bin | -eu $(pwd)
+${HOME} cd 2>/dev/null /usr/bin --verbose "$1" "$1"
+	echo 2>/dev/null test && x=1 2>/dev/null cd awk 2>/dev/null then && --verbose
+printf "$@" awk awk --verbose 'quoted text' local export --verbose -eu
+		then then done "$@" --verbose
+$(pwd) then printf printf $(pwd) -eu awk
+x=1 export then && grep "$@" "$@" cd sed then export local "$@" grep grep
+		local ${HOME} "$@" "$@" then grep | grep local printf -eu && "$1"
+then grep printf && cd readonly
+	printf | sed x=1 --verbose then then --verbose "$1" grep --verbose export ${HOME}
+	test echo test ${HOME} -eu readonly export export ${HOME}
+	"$@" $(pwd) x=1 2>/dev/null 'quoted text' printf export "$@" echo | ${HOME}
+2>/dev/null "$@" grep export cd echo echo --verbose
+	${HOME} 2>/dev/null ${HOME} -eu awk
+"$1" grep grep then | sed sed && | test export 'quoted text' readonly
+2>/dev/null cd cd $(pwd) done -eu printf cd done /usr/bin grep
+awk readonly grep cd printf /usr/bin 'quoted text' done awk test local
+x=1 | echo sed $(pwd) x=1 | |
+readonly 'quoted text' awk done grep -eu cd export x=1 done
+readonly /usr/bin -eu sed test awk test local sed printf local "$1"
+		--verbose 2>/dev/null "$1" "$1" test done echo x=1 && printf && --verbose x=1 awk
+	2>/dev/null && cd then |
+$(pwd) echo /usr/bin readonly
+	"$1" printf printf grep sed echo printf 2>/dev/null
+		$(pwd) --verbose --verbose ${HOME} cd "$1" 'quoted text' awk x=1 ${HOME}
+	${HOME} x=1 -eu 2>/dev/null awk test
+then readonly done awk printf "$1" /usr/bin $(pwd) 'quoted text' "$@" echo
+readonly sed x=1 sed ${HOME} -eu | ${HOME} local done -eu done printf -eu
+| cd /usr/bin -eu && readonly x=1
+	printf test | sed local awk
+cd && "$1" test local sed sed -eu then && readonly --verbose
+${HOME} echo && | -eu
+		then ${HOME} -eu printf readonly -eu /usr/bin $(pwd) test 'quoted text'
+grep sed --verbose sed awk --verbose done done cd "$1" cd sed
+	grep x=1 readonly done grep grep then grep x=1 export x=1
+	2>/dev/null $(pwd) then "$1" 2>/dev/null
+awk | cd cd $(pwd) $(pwd) ${HOME} awk
+	/usr/bin grep ${HOME} then readonly
+		-eu readonly "$@" "$1" local
+		done local echo $(pwd) --verbose export local "$@" && --verbose
+| ${HOME} "$@" && "$@" "$@" test x=1 done $(pwd) --verbose
+-eu export grep grep local test /usr/bin done cd test done
+	'quoted text' done 2>/dev/null ${HOME}
+	| cd awk /usr/bin local /usr/bin grep grep grep export cd sed printf
+awk echo --verbose printf grep x=1 ${HOME}
+	cd --verbose x=1 && ${HOME} grep then awk && local
+		grep then done cd awk sed echo | then cd export grep $(pwd) local test
+	cd /usr/bin printf readonly -eu export sed test test readonly then grep readonly
+	2>/dev/null --verbose test 2>/dev/null | sed x=1 "$1" -eu 'quoted text'
+		--verbose "$@" readonly export test | && done done "$@"
+	printf $(pwd) /usr/bin ${HOME} ${HOME} ${HOME} | ${HOME} "$@" local
+	cd grep $(pwd) "$1" "$1" done && then ${HOME} awk "$1" --verbose export
+		test cd | readonly && readonly cd readonly sed export -eu then /usr/bin
+/usr/bin local local -eu ${HOME} grep
+	'quoted text' 'quoted text' readonly ${HOME} x=1 "$@" grep x=1 then
+	/usr/bin local done 2>/dev/null done readonly grep
+	done -eu $(pwd) readonly done done "$1" echo && x=1 'quoted text' | /usr/bin
+		then then echo export | cd awk done done
+	'quoted text' printf readonly local cd "$@"
+		printf readonly "$@" -eu "$@" "$@" | 'quoted text'
+	x=1 ${HOME} 2>/dev/null readonly --verbose done cd echo /usr/bin $(pwd)
+		&& x=1 "$@" cd done awk /usr/bin 2>/dev/null "$@" && local "$1" $(pwd) readonly
+cd readonly echo ${HOME} $(pwd) grep $(pwd) grep export
+	&& grep export "$1" done local export cd
+'quoted text' then 'quoted text' then
+-eu $(pwd) printf -eu 'quoted text' done "$@" export export 2>/dev/null
+		'quoted text' /usr/bin sed grep done local test sed 'quoted text' then
+	printf printf --verbose
+	2>/dev/null printf --verbose test && export --verbose 'quoted text' readonly echo
+	awk then ${HOME} $(pwd) test local readonly 2>/dev/null echo
+then $(pwd) x=1 -eu sed && -eu then done "$@" "$1" test
+		cd echo | --verbose grep grep --verbose cd grep
+&& export $(pwd) export "$1" printf --verbose
+		"$1" then "$1" /usr/bin then 'quoted text'
+		-eu done -eu 2>/dev/null local awk "$@" --verbose sed then | 'quoted text' ${HOME}
+		sed test "$@" ${HOME} grep
+	x=1 "$@" grep echo cd
+		2>/dev/null cd | readonly x=1 readonly done --verbose $(pwd) local
+	&& "$1" awk /usr/bin sed echo cd
+--verbose local ${HOME} test 2>/dev/null
+		2>/dev/null then -eu awk --verbose $(pwd) && cd grep -eu done done -eu
+		printf grep local 'quoted text' readonly done awk done done /usr/bin
+grep awk --verbose x=1 $(pwd)
+/usr/bin x=1 "$@" test /usr/bin "$@" awk
+local echo $(pwd) | echo sed readonly grep echo | | --verbose
+		echo --verbose /usr/bin local --verbose && readonly | && printf x=1 "$@" 2>/dev/null
+	then "$@" echo local test
+	readonly test then x=1 && 'quoted text' x=1
+		"$@" local cd sed | ${HOME}
+		then cd local done --verbose "$1" local export echo grep "$@" /usr/bin | printf
+$(pwd) then -eu then -eu "$@" /usr/bin export x=1 "$1" "$@" printf /usr/bin $(pwd)
+${HOME} | cd /usr/bin /usr/bin echo -eu /usr/bin 'quoted text'
+		/usr/bin | 'quoted text' && x=1 | -eu grep ${HOME} &&
+	readonly $(pwd) echo
+	sed grep | awk 2>/dev/null 'quoted text'
+	printf cd $(pwd) 2>/dev/null ${HOME} sed export done --verbose sed 2>/dev/null
+cd awk 'quoted text' readonly cd 2>/dev/null
+	-eu --verbose test --verbose sed | done done
+	cd $(pwd) /usr/bin test "$1" x=1 echo awk
+		--verbose --verbose /usr/bin "$@" then "$1" | x=1 | && then
+		--verbose local --verbose local done
+	x=1 grep export readonly done done "$@" /usr/bin /usr/bin "$@" | grep /usr/bin
+	"$@" readonly -eu sed "$@" $(pwd) $(pwd) "$@" x=1 echo done ${HOME}
+export && --verbose --verbose && "$1" local echo
+	readonly $(pwd) printf test readonly echo --verbose
+	cd awk | /usr/bin "$@" test awk done echo done export
+		then 'quoted text' cd grep cd 2>/dev/null "$1" sed test
+echo 'quoted text' cd
+printf readonly | --verbose -eu $(pwd) | $(pwd) done grep then grep
+"$1" | echo "$1" $(pwd) "$1" "$@" "$@" --verbose "$@" readonly 2>/dev/null
+	${HOME} echo && "$1" && -eu --verbose
+		local test echo then sed printf done "$1"
+$(pwd) then cd grep export local "$@" x=1 printf
+local "$@" -eu "$1" done then cd "$@" grep | x=1 | 2>/dev/null grep readonly
+		readonly awk cd /usr/bin local printf --verbose /usr/bin ${HOME} "$1"
+	readonly export --verbose --verbose
+		--verbose "$@" awk -eu $(pwd) --verbose printf
+		echo sed printf 2>/dev/null && && -eu x=1 "$1" ${HOME} | local done x=1
+2>/dev/null 2>/dev/null ${HOME} | "$@" local awk awk
+	&& sed test grep printf then done | 2>/dev/null $(pwd) "$@" x=1 --verbose
+	sed echo readonly test export
+		done "$1" sed 2>/dev/null "$1" ${HOME} cd --verbose test local --verbose
+x=1 echo 2>/dev/null 'quoted text' grep awk 'quoted text'
+	2>/dev/null printf grep cd -eu 'quoted text' local
+-eu 2>/dev/null ${HOME} /usr/bin local "$@" grep done cd /usr/bin
+	done 2>/dev/null "$@" --verbose sed "$@"
+	--verbose "$@" echo readonly
+		local 2>/dev/null && export
+		2>/dev/null $(pwd) readonly
+		test readonly grep /usr/bin test
+	printf cd readonly grep done grep awk | local cd local ${HOME} local | "$@"
+	"$1" --verbose grep -eu grep readonly && grep test readonly sed
+	then export --verbose x=1 printf | x=1 | printf | cd ${HOME} cd
+	$(pwd) sed x=1 then "$1" "$@" done echo test local 2>/dev/null
+		cd cd && "$@" ${HOME} | -eu
+local cd sed then awk 2>/dev/null
+	'quoted text' x=1 then && "$1" export local $(pwd) | "$1" test -eu |
+'quoted text' $(pwd) 2>/dev/null 2>/dev/null 2>/dev/null /usr/bin $(pwd)
+	local sed sed sed export 'quoted text'
+	"$1" | test grep $(pwd) readonly x=1 then
+		export | x=1 done | "$@" sed --verbose --verbose
+readonly grep readonly readonly /usr/bin awk done ${HOME}
+		'quoted text' 2>/dev/null readonly sed 'quoted text' sed --verbose "$@"
+		${HOME} awk sed x=1 "$1" printf "$1" && export | 2>/dev/null
+		local done "$1" && --verbose ${HOME} ${HOME} awk 2>/dev/null $(pwd) echo
+		/usr/bin && then "$1" awk local ${HOME} 2>/dev/null
+--verbose test awk "$1" -eu export x=1 then
+	-eu local 2>/dev/null local sed $(pwd) grep 2>/dev/null
+	then /usr/bin --verbose | -eu test x=1 echo grep $(pwd) x=1 'quoted text'
+	echo echo export sed -eu then
+	2>/dev/null awk --verbose "$@" awk x=1 test "$1" printf 'quoted text'
+		| "$1" grep "$@" awk 'quoted text' x=1 | /usr/bin "$@" export --verbose
+		readonly && readonly /usr/bin cd /usr/bin export 2>/dev/null
+	$(pwd) 'quoted text' then readonly printf
+	local test awk echo 'quoted text' "$@" "$1" 2>/dev/null local -eu echo awk "$@"
+	grep then /usr/bin test cd x=1 readonly printf cd 2>/dev/null
+		'quoted text' /usr/bin /usr/bin && printf
+		cd printf then echo && x=1 $(pwd)
+		echo echo && --verbose /usr/bin x=1 -eu done test done /usr/bin
+		"$@" "$@" $(pwd) awk export cd export done --verbose
+	2>/dev/null -eu grep grep 2>/dev/null grep
+		cd ${HOME} grep printf | done 'quoted text' 'quoted text'
+/usr/bin /usr/bin "$1" ${HOME} printf
+		readonly 2>/dev/null -eu && readonly then then readonly
+	test then export readonly cd -eu sed 2>/dev/null /usr/bin 'quoted text' | echo
+| cd sed awk printf grep "$1" done /usr/bin local test /usr/bin
+then "$1" | echo /usr/bin
+	grep x=1 then export awk export awk x=1 && awk test test done awk --verbose done
+done local printf --verbose x=1 done -eu export
+	readonly && "$@" sed x=1 ${HOME} | --verbose
+'quoted text' awk echo "$1"
+"$@" test --verbose printf ${HOME}
+		echo local /usr/bin sed then -eu test printf cd "$@" x=1 2>/dev/null "$1" 2>/dev/null
+		/usr/bin cd awk /usr/bin 'quoted text' "$@" sed "$@" printf cd "$1" echo
+$(pwd) x=1 /usr/bin --verbose 'quoted text' cd test sed "$1"
+	"$1" "$@" readonly printf
+	local echo --verbose grep echo | | 'quoted text'
+		cd awk 2>/dev/null export --verbose && then "$1" x=1 | "$@"
+		x=1 test sed done /usr/bin then
@@ -0,0 +1,2001 @@
+then awk printf then ${HOME} --verbose /usr/bin $(pwd)
+printf done 2>/dev/null -eu test local test | -eu -eu then then $(pwd)
+	'quoted text' local printf
+		grep -eu sed -eu | sed | ${HOME} x=1 2>/dev/null readonly | readonly done sed
+		local export cd | cd && && 'quoted text'
+printf ${HOME} 2>/dev/null && 'quoted text' --verbose done test
+		done x=1 grep -eu -eu "$@" /usr/bin cd then readonly 2>/dev/null
+	"$@" test export 2>/dev/null /usr/bin && "$@" readonly /usr/bin
+sed grep $(pwd) ${HOME} echo /usr/bin "$@" echo grep export
+-eu "$@" && | /usr/bin sed | printf /usr/bin "$1" grep 'quoted text'
+"$@" ${HOME} --verbose 2>/dev/null
+	--verbose 2>/dev/null sed | /usr/bin readonly /usr/bin then && -eu awk cd && local
+done local readonly awk
+		grep cd echo local -eu $(pwd) 2>/dev/null | local grep awk x=1 $(pwd)
+done --verbose $(pwd) then export echo sed "$1"
+	awk sed awk $(pwd) grep x=1 sed
+test x=1 $(pwd) 'quoted text' export | done sed && awk -eu echo awk
+2>/dev/null "$@" x=1 && ${HOME} awk ${HOME} echo local --verbose
+		cd echo done ${HOME} 'quoted text'
+		| "$@" /usr/bin | "$1" echo sed "$1" "$1"
+2>/dev/null 'quoted text' && readonly then printf x=1 x=1 sed "$1" "$1" 2>/dev/null
+	'quoted text' -eu | -eu
+		done --verbose cd 'quoted text' grep --verbose 2>/dev/null
+export local local && "$1" test local printf "$1" $(pwd) grep
+	readonly /usr/bin 'quoted text' x=1 printf -eu
+		then ${HOME} grep --verbose 2>/dev/null test grep | $(pwd) ${HOME}
+done test /usr/bin $(pwd)
+		x=1 grep "$1" | echo test
+		x=1 -eu "$1" awk "$1" ${HOME} ${HOME} "$1" --verbose ${HOME} test
+	${HOME} "$@" sed --verbose echo awk awk 'quoted text'
+	grep --verbose "$@" 2>/dev/null 'quoted text' local done x=1 export done | awk
+		/usr/bin | x=1 ${HOME} /usr/bin echo
+	"$1" /usr/bin "$1" printf -eu --verbose 2>/dev/null 2>/dev/null
+		$(pwd) test local "$1" export grep done 'quoted text'
+export --verbose | 'quoted text' export ${HOME} -eu export then grep done "$1"
+		$(pwd) local sed 2>/dev/null done
+	then | grep test && --verbose -eu printf $(pwd)
+		test echo ${HOME} printf readonly 'quoted text' export /usr/bin
+	test -eu 2>/dev/null export /usr/bin --verbose /usr/bin
+	printf ${HOME} grep done --verbose done sed 2>/dev/null
+		| export cd 2>/dev/null
+	-eu test export cd x=1 done export local -eu -eu
+	"$@" | grep then printf $(pwd) cd test grep 2>/dev/null export
+echo "$@" 'quoted text' cd
+		| awk --verbose export sed "$1" cd 2>/dev/null
+	"$@" && 'quoted text' readonly
+2>/dev/null printf "$1" ${HOME}
+"$1" x=1 printf echo then cd -eu export 'quoted text' then 'quoted text'
+sed --verbose test printf 2>/dev/null cd 'quoted text' local test
+"$1" local /usr/bin $(pwd) awk -eu done awk echo 'quoted text' then 2>/dev/null
+	cd readonly readonly ${HOME} ${HOME} && then sed test printf export export
+	local echo -eu 'quoted text' x=1 ${HOME} local local
+	-eu readonly test $(pwd) x=1 "$@" echo cd /usr/bin && && echo "$1" cd
+	then | /usr/bin local awk "$@" 'quoted text' export export $(pwd) $(pwd) "$@" "$@"
+		sed && cd sed grep ${HOME} $(pwd)
+${HOME} x=1 $(pwd) "$1" printf && -eu -eu test 2>/dev/null
+"$@" export "$1" /usr/bin export printf then $(pwd)
+-eu ${HOME} test "$1" ${HOME} done done printf
+awk then done printf local sed
+$(pwd) /usr/bin 'quoted text' $(pwd) $(pwd) local export && | | --verbose
+| /usr/bin then "$1" 'quoted text' done awk /usr/bin printf 'quoted text' echo
+	echo --verbose $(pwd) echo /usr/bin grep 'quoted text' 'quoted text' && test
+"$1" readonly grep cd done | -eu echo 'quoted text'
+x=1 --verbose cd --verbose grep then /usr/bin then --verbose
+		echo 2>/dev/null cd "$@" sed 'quoted text' -eu grep -eu "$@"
+		test && -eu ${HOME} then && | /usr/bin 2>/dev/null then test echo printf
+	readonly /usr/bin grep --verbose /usr/bin then local
+	${HOME} && | "$@" ${HOME} local "$1" x=1 export then ${HOME}
+		printf grep done awk "$@" export grep -eu echo --verbose echo "$1"
+	cd 2>/dev/null --verbose -eu x=1 --verbose $(pwd) $(pwd)
+	"$1" export sed && printf
+	cd "$1" awk echo --verbose
+		2>/dev/null then sed /usr/bin "$@" grep x=1 ${HOME}
+	x=1 printf awk done grep awk
+	local --verbose awk | -eu -eu
+printf export | local test test
+	'quoted text' | && echo then | readonly
+	${HOME} "$@" -eu "$@" awk echo ${HOME} echo $(pwd) 2>/dev/null
+		local then export then test /usr/bin
+local local then "$@" sed $(pwd) && echo sed | | 'quoted text' -eu
+		local 2>/dev/null local then && $(pwd) grep 2>/dev/null
+		grep -eu 'quoted text' | ${HOME} export echo printf 'quoted text'
+echo local -eu | grep -eu | grep done 2>/dev/null "$@" then 2>/dev/null "$@"
+		x=1 printf done 'quoted text' done $(pwd) local cd "$@" |
+		$(pwd) echo --verbose "$1" local "$1" echo 'quoted text'
+	x=1 readonly && printf grep && --verbose 2>/dev/null test export
+		x=1 | test 'quoted text' -eu -eu "$1" grep local
+local $(pwd) local readonly then "$@"
+		/usr/bin x=1 'quoted text' awk done readonly 'quoted text'
+		echo then ${HOME} readonly done $(pwd)
+${HOME} export cd --verbose cd /usr/bin -eu 2>/dev/null cd --verbose
+	echo x=1 --verbose $(pwd) $(pwd) "$@" awk test done test
+${HOME} echo x=1 grep readonly -eu then
+"$1" then 2>/dev/null export
+--verbose /usr/bin x=1 "$1" -eu printf local readonly "$1"
+	"$1" awk ${HOME} cd 'quoted text'
+echo x=1 ${HOME} --verbose 'quoted text' 2>/dev/null
+		test x=1 echo "$1" local local cd grep x=1 "$@" then $(pwd) readonly
+"$1" --verbose x=1 $(pwd) "$1" grep grep $(pwd) $(pwd)
+	"$1" | awk /usr/bin 2>/dev/null
+	then $(pwd) done local
+		"$1" -eu | readonly | sed -eu awk export awk && cd x=1
+	"$@" then "$1" && && x=1 $(pwd) "$@"
+		cd "$@" sed --verbose --verbose sed done --verbose ${HOME} grep | /usr/bin
+	sed x=1 test $(pwd) echo /usr/bin cd
+	local $(pwd) echo sed
+${HOME} cd | x=1 cd printf && grep local cd
+	done echo awk grep sed /usr/bin
+	"$1" local "$@" && -eu readonly "$1" 2>/dev/null && && sed awk x=1 ${HOME} then
+test /usr/bin done "$1" 2>/dev/null
+	--verbose echo then sed /usr/bin 2>/dev/null $(pwd) readonly test "$1" ${HOME} &&
+export then cd /usr/bin readonly test "$1" /usr/bin
+| printf local awk sed grep "$1" cd |
+		&& local ${HOME} printf awk $(pwd) "$1" sed awk readonly grep local ${HOME}
+	${HOME} then "$1" local /usr/bin sed test
+		local && cd cd printf export 'quoted text' done sed ${HOME}
+		/usr/bin then echo then "$1" sed test "$1" grep 2>/dev/null "$1" local --verbose
+printf local awk x=1 echo
+	${HOME} cd local x=1 then 2>/dev/null printf test then
+	${HOME} --verbose /usr/bin 2>/dev/null
+&& 'quoted text' done printf
+	sed x=1 test grep && grep -eu ${HOME}
+	done then echo | cd awk awk test local echo done $(pwd) export && test /usr/bin
+	printf printf && 'quoted text'
+	done grep printf printf | x=1 $(pwd) --verbose echo done
+	$(pwd) 'quoted text' $(pwd) awk
+		-eu readonly x=1 && readonly x=1 done readonly then then cd readonly
+-eu grep then sed x=1 then grep --verbose export ${HOME} ${HOME}
+	"$1" sed awk done cd /usr/bin && echo sed -eu "$1" awk echo local | local
+	'quoted text' export cd --verbose readonly
+		echo -eu "$1" cd readonly /usr/bin -eu done
+export "$1" "$@" awk sed "$@" grep "$1" local cd "$1" readonly x=1 $(pwd)
+	$(pwd) x=1 && -eu done 2>/dev/null cd
+	awk $(pwd) readonly test echo ${HOME} cd export done cd echo awk
+	2>/dev/null then --verbose test ${HOME}
+'quoted text' 'quoted text' export
+$(pwd) "$1" /usr/bin then x=1
+grep -eu ${HOME} $(pwd) x=1 /usr/bin
+	2>/dev/null --verbose
+readonly then echo readonly "$1" done
+		done 2>/dev/null awk done /usr/bin sed echo sed 2>/dev/null
+then export printf local 'quoted text' sed echo
+		readonly grep "$@" ${HOME} | local "$1" readonly "$@"
+	| local then 'quoted text' cd ${HOME} --verbose && ${HOME}
+		grep 'quoted text' ${HOME} test /usr/bin awk test x=1 $(pwd)
+		readonly --verbose then sed cd sed && "$1" --verbose ${HOME} local "$@"
+	readonly export --verbose test printf ${HOME}
+		done awk x=1 grep sed $(pwd)
+'quoted text' 'quoted text' echo printf x=1 local awk then -eu | export export
+grep test x=1 ${HOME} readonly readonly "$@" "$1" $(pwd)
+		then awk then 'quoted text' readonly -eu test done local readonly export echo
+x=1 && awk cd | 'quoted text' 2>/dev/null
+"$1" done ${HOME} sed grep then export | ${HOME} $(pwd) | printf
+"$@" x=1 2>/dev/null && -eu printf export
+export printf --verbose then test
+cd $(pwd) done grep test /usr/bin x=1 sed x=1
+		/usr/bin -eu test x=1 "$@" grep done
+	'quoted text' test --verbose 'quoted text'
+	"$@" 'quoted text' 'quoted text' printf
+x=1 readonly readonly x=1 | --verbose printf "$@" /usr/bin
+		then && readonly x=1 &&
+	done printf awk 2>/dev/null -eu && test | printf printf
+		"$1" $(pwd) "$@" 2>/dev/null --verbose "$@" ${HOME}
+		cd cd local cd test ${HOME} local sed test printf printf
+		test --verbose x=1 x=1 echo
+	export printf done sed echo awk "$1" $(pwd) $(pwd)
+readonly done cd export export
+printf awk grep local "$@" $(pwd) "$@" export
+awk readonly grep /usr/bin -eu test done done test test printf "$1" done && local
+	local test x=1 sed --verbose test "$@" --verbose
+		echo test local ${HOME} sed "$1" printf
+'quoted text' then 2>/dev/null
+--verbose then "$@" /usr/bin "$1" /usr/bin export
+x=1 'quoted text' -eu -eu local printf printf readonly --verbose
+	printf $(pwd) then 'quoted text'
+		&& grep /usr/bin then x=1 2>/dev/null
+x=1 done x=1 echo ${HOME} $(pwd) 'quoted text' "$1" | --verbose $(pwd)
+	echo cd readonly --verbose "$@" test ${HOME} x=1 grep x=1 cd cd $(pwd) sed
+		test awk --verbose test done test 2>/dev/null local "$1" local $(pwd)
+	'quoted text' x=1 done | /usr/bin 2>/dev/null echo "$1" --verbose awk "$1" test
+	"$@" local x=1 "$@" printf local "$1" $(pwd) awk --verbose readonly "$@"
+		echo /usr/bin test | | local -eu printf then x=1 2>/dev/null
+test | x=1 readonly echo | local -eu export ${HOME} && && 'quoted text'
+	&& $(pwd) 2>/dev/null local export readonly test -eu echo local 2>/dev/null
+'quoted text' /usr/bin cd
+&& readonly 'quoted text' --verbose local 2>/dev/null
+	--verbose 'quoted text' $(pwd) $(pwd) awk
+-eu | ${HOME} | ${HOME} then done /usr/bin 'quoted text'
+		echo awk /usr/bin /usr/bin readonly
+		printf 'quoted text' then 'quoted text' | local test | $(pwd) "$1" grep "$@"
+	echo | ${HOME} --verbose printf 2>/dev/null export "$@" 'quoted text' printf
+		export test printf ${HOME} echo /usr/bin sed x=1 readonly done -eu "$1" ${HOME}
+	| done readonly export done
+		--verbose "$1" cd readonly ${HOME}
+		/usr/bin 2>/dev/null local local && test | ${HOME} && sed
+awk /usr/bin /usr/bin 'quoted text' x=1 readonly test | "$@" cd x=1
+sed local grep $(pwd) cd awk echo /usr/bin awk cd awk "$@" "$1" -eu
+		| echo x=1 echo done -eu echo 2>/dev/null $(pwd) /usr/bin export awk then
+	echo | test ${HOME} 2>/dev/null then x=1 test printf local 2>/dev/null
+	test done x=1 'quoted text'
+local 'quoted text' then readonly export 2>/dev/null -eu "$@" export sed awk
+		/usr/bin --verbose $(pwd) -eu done 2>/dev/null export grep -eu | && then echo
+	"$@" local "$1" readonly export ${HOME} local | cd
+"$1" awk sed /usr/bin "$1" cd cd /usr/bin local sed -eu 'quoted text'
+		export --verbose printf --verbose
+		--verbose "$1" echo grep $(pwd) "$1" ${HOME} local printf readonly
+		x=1 --verbose --verbose "$1" "$1" -eu ${HOME} grep -eu done
+	test local "$@" | local then export -eu -eu export
+--verbose 'quoted text' awk then $(pwd) test -eu /usr/bin sed done done test
+	sed readonly cd export printf 'quoted text'
+	cd "$@" grep then printf
+	'quoted text' export $(pwd)
+	${HOME} cd sed --verbose done | $(pwd) awk 'quoted text' 2>/dev/null
+x=1 && /usr/bin | /usr/bin
+	&& grep --verbose && sed grep "$1" "$@" $(pwd) "$@" x=1 2>/dev/null
+sed awk grep readonly 'quoted text' "$1" cd then awk local x=1 -eu && "$1"
+		2>/dev/null local "$1" test 'quoted text' --verbose local test local sed
+&& done /usr/bin "$1" export awk && --verbose
+echo x=1 2>/dev/null $(pwd) && | "$1" ${HOME} echo $(pwd)
+cd test then && done then then awk test
+echo cd test grep && x=1 export sed echo ${HOME} | --verbose grep
+		$(pwd) "$1" 'quoted text' | -eu then cd x=1 -eu readonly done
+	echo ${HOME} 2>/dev/null 'quoted text' |
+	&& test cd awk export 2>/dev/null
+&& --verbose awk awk grep x=1 "$1" /usr/bin
+	-eu --verbose sed x=1 | then echo sed 2>/dev/null done local then $(pwd) -eu
+${HOME} /usr/bin export echo ${HOME} && sed x=1
+'quoted text' && -eu | cd --verbose then sed /usr/bin
+	"$@" -eu test cd x=1 echo test cd /usr/bin /usr/bin && x=1 printf
+		echo printf sed export "$@"
+	"$@" ${HOME} --verbose export x=1 ${HOME} -eu && 2>/dev/null printf "$@" cd printf
+cd then local "$@" printf $(pwd) export done
+cd ${HOME} --verbose ${HOME}
+	${HOME} printf export && export $(pwd) printf echo echo 2>/dev/null && then
+echo cd | /usr/bin done /usr/bin echo sed
+	awk ${HOME} /usr/bin then -eu readonly done
+awk x=1 "$1" then test 2>/dev/null
+	'quoted text' readonly test | printf 2>/dev/null --verbose $(pwd) test
+$(pwd) ${HOME} "$1" grep 2>/dev/null "$1" readonly grep
+		done -eu test cd $(pwd) awk | -eu
+cd grep ${HOME} --verbose x=1 done
+		/usr/bin x=1 local readonly done ${HOME} --verbose
+	awk /usr/bin test ${HOME} --verbose /usr/bin && x=1 local awk local
+		then "$1" 'quoted text' local | done 2>/dev/null
+	2>/dev/null test /usr/bin /usr/bin x=1 && readonly ${HOME} x=1 test readonly
+	done | 'quoted text' sed /usr/bin
+	| awk x=1 readonly -eu grep sed awk then sed grep done then
+	| printf sed then then | 2>/dev/null sed cd 'quoted text' --verbose echo awk test
+	-eu local then readonly sed | printf awk "$@" readonly /usr/bin
+	-eu sed echo then sed done cd --verbose echo cd $(pwd) echo
+awk | awk echo && sed $(pwd) export
+	-eu local echo local then export echo /usr/bin export test printf printf
+	test ${HOME} && then cd export "$@" local echo && then printf
+awk local then 'quoted text' cd
+		readonly 2>/dev/null echo cd
+	"$@" then -eu -eu grep $(pwd) 2>/dev/null test 2>/dev/null grep ${HOME}
+		readonly ${HOME} cd readonly printf test then
+		done "$1" test "$@" grep
+printf "$@" grep awk ${HOME} grep | local -eu echo "$@" then ${HOME}
+	$(pwd) --verbose /usr/bin then local printf "$@" -eu --verbose then --verbose
+--verbose 2>/dev/null 'quoted text' $(pwd) then | --verbose done printf | 'quoted text'
+		$(pwd) 'quoted text' $(pwd) awk && "$@" "$@" | /usr/bin grep printf --verbose
+local readonly /usr/bin export printf then echo ${HOME} "$@" "$@" ${HOME}
+		echo awk --verbose export local "$@" local "$@" $(pwd) | -eu test -eu "$1"
+export cd ${HOME} export
+		done done && sed export readonly grep local ${HOME} 2>/dev/null awk
+		then sed then echo printf -eu awk /usr/bin | awk "$@" export
+echo | "$1" x=1 grep awk
+		export export cd readonly sed $(pwd)
+x=1 awk 2>/dev/null $(pwd) test ${HOME} awk export then x=1 -eu x=1 sed sed
+		$(pwd) "$1" | readonly -eu readonly readonly $(pwd) --verbose
+/usr/bin echo grep sed sed readonly && && grep
+		local grep local printf then test x=1 x=1 2>/dev/null cd readonly
+		cd "$1" printf export /usr/bin && "$@" | ${HOME} export
+		--verbose --verbose -eu 'quoted text' --verbose "$@" $(pwd)
+done 2>/dev/null local -eu 'quoted text' 2>/dev/null $(pwd) ${HOME}
+--verbose readonly /usr/bin "$1" 2>/dev/null | sed export -eu
+		--verbose | && -eu /usr/bin then printf readonly export | grep x=1 --verbose
+		"$1" grep 2>/dev/null && ${HOME} awk printf $(pwd) | && --verbose echo ${HOME}
+	$(pwd) $(pwd) then export
+	sed | "$1" "$1" done local && | "$1" 2>/dev/null readonly
+grep -eu export "$1" 2>/dev/null $(pwd) /usr/bin 2>/dev/null
+		-eu printf echo printf awk "$@" sed awk test /usr/bin ${HOME} echo
+		then export --verbose readonly
+grep ${HOME} readonly sed
+		grep awk echo grep test | awk
+		2>/dev/null -eu | 'quoted text' grep done awk /usr/bin "$1"
+local export && "$@" /usr/bin
+/usr/bin && sed x=1 $(pwd) echo /usr/bin | printf awk && test
+	readonly "$@" test echo then readonly test sed && ${HOME} then readonly
+		sed awk printf then 'quoted text' readonly && sed
+cd cd 'quoted text' --verbose "$1" awk
+	readonly "$1" echo then echo --verbose x=1 printf printf grep done export
+	done test export cd x=1 --verbose | /usr/bin 'quoted text'
+export cd printf --verbose --verbose ${HOME}
+'quoted text' echo ${HOME} --verbose
+	grep ${HOME} | /usr/bin done /usr/bin /usr/bin --verbose
+	then 2>/dev/null test "$@" "$@" grep -eu
+	cd -eu awk export ${HOME} --verbose printf sed grep cd 2>/dev/null
+		x=1 2>/dev/null 2>/dev/null | "$@" grep cd | then /usr/bin $(pwd) && "$1"
+sed && $(pwd) export --verbose awk done echo --verbose echo test then $(pwd) 'quoted text'
+	| ${HOME} && | -eu /usr/bin -eu grep echo ${HOME}
+/usr/bin local 'quoted text' done -eu printf printf echo && then /usr/bin
+		echo test | done --verbose 'quoted text' /usr/bin "$@"
+	-eu x=1 echo then 2>/dev/null
+echo ${HOME} 2>/dev/null ${HOME} | done "$1"
+	awk x=1 "$@" done $(pwd) export | -eu "$@" test /usr/bin ${HOME} cd
+	cd && cd 'quoted text'
+	| --verbose --verbose grep echo && printf | $(pwd) ${HOME}
+		"$@" export then local done awk grep /usr/bin echo -eu $(pwd)
+cd /usr/bin x=1 then done done sed sed cd | 'quoted text'
+		-eu && export export | | "$1" then "$@" test "$1" sed printf
+sed awk /usr/bin --verbose printf cd && printf sed then 2>/dev/null x=1 --verbose
+	| sed 'quoted text' cd done --verbose "$@"
+x=1 grep && export $(pwd) ${HOME} printf "$@"
+		| 2>/dev/null "$@" 2>/dev/null cd && | -eu local | | /usr/bin sed grep echo
+		&& 2>/dev/null /usr/bin readonly $(pwd) ${HOME} -eu echo
+		echo awk "$1" ${HOME} 2>/dev/null 'quoted text' -eu "$1" ${HOME}
+		awk printf awk ${HOME} readonly "$@" 'quoted text' sed $(pwd) done "$1" /usr/bin
+	readonly sed echo grep test echo -eu readonly readonly echo | --verbose
+&& export /usr/bin -eu echo grep --verbose printf
+"$1" | echo "$@" | "$1" grep /usr/bin then printf
+	/usr/bin done awk printf local x=1 x=1 grep
+	sed ${HOME} grep -eu echo ${HOME} "$@" sed test
+	test test done cd readonly readonly --verbose /usr/bin awk $(pwd) test sed export
+		then printf export export "$1" 2>/dev/null | "$@" "$@" test | sed "$1" 2>/dev/null
+	${HOME} readonly 'quoted text' then "$@" cd echo | -eu
+	awk grep echo then --verbose --verbose 'quoted text' /usr/bin x=1
+	done ${HOME} done | sed grep | -eu | done | | && then x=1
+	cd --verbose awk /usr/bin grep $(pwd) done awk local ${HOME}
+"$@" 2>/dev/null done then ${HOME} | done /usr/bin | then printf local cd x=1 echo
+	test grep export cd cd "$@" | /usr/bin | $(pwd) ${HOME} echo $(pwd)
+	-eu echo cd cd grep 2>/dev/null sed && "$@" local "$@"
+		sed ${HOME} cd 2>/dev/null local
+2>/dev/null ${HOME} ${HOME} readonly ${HOME} awk awk "$@" -eu
+	--verbose "$1" "$@" cd "$@" --verbose | done ${HOME} readonly export
+		$(pwd) awk readonly local "$1" readonly
+		done printf /usr/bin then sed 2>/dev/null x=1 x=1 printf -eu awk 2>/dev/null
+	/usr/bin test $(pwd) --verbose 'quoted text'
+		--verbose export "$@"
+		x=1 -eu x=1 $(pwd) then --verbose cd printf cd
+	then awk 'quoted text' done -eu readonly
+printf done echo /usr/bin -eu | then && /usr/bin awk
+readonly printf -eu ${HOME} | 2>/dev/null awk
+		'quoted text' grep "$1" 2>/dev/null then ${HOME} "$@" sed "$@" 'quoted text'
+cd export x=1 awk done then grep
+	done grep export x=1 local done awk test then "$1" "$1" readonly awk 'quoted text'
+	-eu done grep then && /usr/bin export then readonly $(pwd) 'quoted text' grep "$@"
+	${HOME} printf then sed readonly "$1" "$@" awk done 'quoted text' 'quoted text'
+		"$@" --verbose "$1" cd sed "$1" sed | /usr/bin /usr/bin --verbose x=1
+		--verbose done 2>/dev/null ${HOME}
+		2>/dev/null -eu test sed export
+	| | "$@" export grep --verbose ${HOME} then export
+then 'quoted text' ${HOME} 2>/dev/null
+	/usr/bin 'quoted text' "$@" ${HOME}
+		2>/dev/null x=1 sed test printf
+	"$1" --verbose awk export | printf cd test echo printf sed $(pwd) $(pwd) test
+then x=1 readonly /usr/bin awk | export x=1 printf /usr/bin grep grep readonly
+	then done /usr/bin then done done /usr/bin local 2>/dev/null local sed readonly
+	"$@" /usr/bin test readonly | "$@" "$@" test | && awk 'quoted text'
+		2>/dev/null then done -eu &&
+	-eu ${HOME} export && "$@" test
+	printf done sed $(pwd) --verbose x=1 "$1" echo done
+	2>/dev/null ${HOME} $(pwd) | $(pwd) /usr/bin grep "$@" && $(pwd) -eu /usr/bin
+		${HOME} && export readonly echo done -eu done
+cd awk local export | "$1" done 2>/dev/null --verbose printf 2>/dev/null
+/usr/bin test printf -eu | | awk /usr/bin test printf export x=1
+'quoted text' cd echo
+echo echo echo $(pwd) export done sed
+	done | test test x=1 then sed
+-eu then $(pwd) grep "$1" readonly | 'quoted text' $(pwd) test readonly
+		readonly done x=1 printf 2>/dev/null /usr/bin local | local
+test ${HOME} 2>/dev/null "$1" "$1" cd echo --verbose && | local local
+	grep $(pwd) test "$@" | $(pwd)
+	'quoted text' | export 2>/dev/null
+grep readonly cd test test awk export ${HOME}
+		export test readonly "$1" --verbose --verbose "$1" 'quoted text'
+--verbose export cd 'quoted text' 2>/dev/null | grep && /usr/bin grep readonly
+		-eu cd then "$@" "$@" /usr/bin
+${HOME} /usr/bin "$@" x=1 local ${HOME} grep --verbose && /usr/bin echo readonly
+		/usr/bin readonly then | grep "$1" awk then then x=1 readonly export x=1 ${HOME}
+	/usr/bin 2>/dev/null ${HOME} cd "$1" 'quoted text' test x=1
+&& -eu ${HOME} sed sed local
+grep 2>/dev/null 'quoted text' 2>/dev/null awk && --verbose
+	-eu "$@" awk cd && "$@" -eu ${HOME}
+		| echo 2>/dev/null /usr/bin "$1" then --verbose cd -eu then echo then
+		'quoted text' local export printf export -eu $(pwd) --verbose
+		"$@" 2>/dev/null && local
+awk 2>/dev/null /usr/bin -eu -eu sed "$@" printf local cd x=1 export test
+x=1 test -eu "$1" 2>/dev/null "$@" done grep && echo grep ${HOME} awk
+	--verbose | done 2>/dev/null "$1" echo /usr/bin --verbose &&
+		export sed echo "$1" test | ${HOME}
+	export /usr/bin /usr/bin "$@" readonly && printf cd 'quoted text' awk printf
+		| /usr/bin ${HOME} awk -eu
+		readonly local 2>/dev/null $(pwd) | "$1" x=1 /usr/bin ${HOME} local x=1
+	/usr/bin 'quoted text' cd awk awk done test "$@" /usr/bin --verbose /usr/bin
+	x=1 'quoted text' ${HOME}
+	sed $(pwd) sed then /usr/bin echo printf awk grep test $(pwd) awk $(pwd)
+		'quoted text' sed then | /usr/bin /usr/bin awk local
+'quoted text' x=1 then | grep grep then cd
+	grep readonly export cd "$@" && $(pwd) $(pwd)
+grep x=1 echo then echo 2>/dev/null 2>/dev/null 'quoted text' /usr/bin
+		-eu test sed 2>/dev/null 'quoted text' "$1" -eu "$@" "$@" ${HOME} then | --verbose
+	awk -eu | /usr/bin grep -eu echo $(pwd) printf test readonly x=1 grep grep then
+then /usr/bin 2>/dev/null "$1" sed cd 'quoted text'
+	then $(pwd) test $(pwd) export echo "$1" "$1" && /usr/bin $(pwd) x=1 echo
+test --verbose "$1" $(pwd) "$@" echo done
+	readonly sed export /usr/bin --verbose /usr/bin then $(pwd) 2>/dev/null
+	readonly -eu cd "$@" printf local /usr/bin
+'quoted text' 2>/dev/null 'quoted text' readonly
+	/usr/bin "$1" then cd echo local && export ${HOME}
+		2>/dev/null 2>/dev/null then sed
+	"$@" then 'quoted text' --verbose sed ${HOME} echo test
+		2>/dev/null grep x=1 "$1" x=1 test
+	test 2>/dev/null then 2>/dev/null | then grep
+	&& cd ${HOME} | readonly 2>/dev/null done "$1" then | test
+		echo cd x=1 2>/dev/null cd export 2>/dev/null
+		--verbose local x=1 test
+		cd --verbose "$1" printf x=1 'quoted text' local done 'quoted text'
+	--verbose "$@" awk /usr/bin sed sed cd -eu test
+grep "$1" && then echo ${HOME} $(pwd) awk
+	awk /usr/bin cd ${HOME}
+	/usr/bin then x=1 /usr/bin
+cd local then "$1" echo | test --verbose test
+	/usr/bin echo awk readonly 2>/dev/null export
+		readonly done printf 'quoted text'
+	done export cd --verbose cd ${HOME} grep awk grep sed then export
+	awk local | "$1" sed ${HOME} | /usr/bin && --verbose
+		then then done && then then cd | 'quoted text'
+"$@" printf local x=1 grep printf "$1" export
+		echo readonly echo --verbose 2>/dev/null /usr/bin
+done done printf ${HOME} test
+	x=1 --verbose export && && done --verbose readonly cd awk 2>/dev/null
+awk "$@" /usr/bin awk --verbose ${HOME} printf "$1" $(pwd)
+		"$1" 2>/dev/null /usr/bin $(pwd) && grep 2>/dev/null echo printf echo x=1 'quoted text'
+	--verbose | | done ${HOME} $(pwd) 'quoted text' local done
+sed | then test awk test | export echo then printf done
+		&& 'quoted text' "$@" echo done printf
+/usr/bin awk | $(pwd) 'quoted text' echo
+sed export "$@" grep -eu
+'quoted text' done then readonly "$@" readonly 2>/dev/null x=1 then awk awk | $(pwd)
+		"$@" awk test done awk 'quoted text' local
+	-eu $(pwd) awk export 2>/dev/null grep export cd "$@" export
+		| grep done /usr/bin --verbose done local "$1" awk
+	&& export "$1" && sed local -eu 2>/dev/null
+echo awk ${HOME} 'quoted text' $(pwd) awk awk $(pwd) ${HOME} | -eu | printf
+		'quoted text' awk | "$1" grep awk
+		$(pwd) "$1" export readonly ${HOME} --verbose cd readonly readonly
+		awk && sed echo local 2>/dev/null test printf
+echo cd echo awk cd -eu
+		$(pwd) -eu --verbose "$@" cd printf --verbose cd x=1 -eu 2>/dev/null done "$@"
+export ${HOME} cd /usr/bin "$1" -eu "$1"
+		| test -eu test 'quoted text'
+${HOME} grep && | readonly sed done $(pwd) readonly
+	sed 2>/dev/null ${HOME} done /usr/bin cd then && $(pwd) grep done cd -eu "$@"
+	then 2>/dev/null /usr/bin printf /usr/bin -eu "$@" echo
+		local sed && export 2>/dev/null $(pwd) -eu --verbose test grep export awk readonly
+		'quoted text' && /usr/bin
+	x=1 "$1" 'quoted text' local "$1" --verbose awk --verbose ${HOME} "$@" readonly
+		printf sed $(pwd) --verbose /usr/bin local --verbose
+test "$1" done "$@" /usr/bin awk "$@" $(pwd) 2>/dev/null
+&& export 'quoted text' x=1
+		$(pwd) test echo sed test sed
+	"$@" --verbose cd echo ${HOME} /usr/bin test echo awk
+	grep /usr/bin export then echo $(pwd) cd -eu -eu /usr/bin
+cd awk test --verbose | then echo $(pwd) local
+'quoted text' sed then local "$1" 'quoted text'
+		cd cd 2>/dev/null x=1 then "$1" x=1 "$1" then 'quoted text'
+	then "$1" local readonly local -eu export awk echo "$@" x=1 $(pwd) local echo
+	echo -eu /usr/bin awk done "$1" awk local grep | export
+grep grep export "$1" sed sed export export 2>/dev/null
+		grep /usr/bin export grep -eu done then | grep grep test test grep 'quoted text'
+	done $(pwd) local 2>/dev/null local awk -eu -eu printf printf "$1" ${HOME}
+	grep && "$1" printf readonly
+		'quoted text' readonly ${HOME} 'quoted text'
+		-eu ${HOME} "$1" x=1 &&
+	2>/dev/null "$@" x=1 sed
+	x=1 test export "$@" readonly readonly "$1" && grep export | readonly 2>/dev/null
+awk local x=1 test x=1 printf ${HOME} printf "$@" awk
+		done 2>/dev/null && 2>/dev/null
+"$@" then cd cd $(pwd) --verbose
+	"$@" awk echo /usr/bin local "$1" $(pwd) -eu
+		2>/dev/null then 'quoted text' grep then "$1" 'quoted text' local local
+		sed sed printf awk test 'quoted text' && done && sed echo ${HOME} awk awk
+${HOME} "$1" grep -eu x=1 x=1 then readonly 2>/dev/null
+	x=1 "$@" | printf "$@" local -eu local then echo
+		/usr/bin sed echo --verbose readonly awk "$@" sed --verbose
+		export export cd "$@" 2>/dev/null local readonly echo export
+	sed --verbose ${HOME}
+	/usr/bin x=1 done readonly ${HOME}
+		awk then readonly ${HOME} readonly cd test 2>/dev/null readonly done
+		-eu readonly echo sed readonly ${HOME} printf done $(pwd)
+		grep echo x=1 -eu -eu x=1 local && "$@" 'quoted text'
+		test test $(pwd) x=1 "$@" export ${HOME} done "$@" --verbose 2>/dev/null then
+	printf export x=1 2>/dev/null /usr/bin -eu
+	test export local && readonly "$@" cd awk $(pwd) awk "$@" $(pwd) export test
+	done readonly 2>/dev/null awk && 'quoted text' "$1" 2>/dev/null
+	'quoted text' printf ${HOME} --verbose echo "$@" test done
+/usr/bin readonly && sed && done
+	| "$@" $(pwd) then sed --verbose "$1" local echo local
+	sed export test -eu &&
+	export export test printf local ${HOME} $(pwd) "$@" readonly "$1"
+		/usr/bin then && && local x=1 readonly "$1" x=1 readonly
+	local -eu -eu echo x=1 test
+		local $(pwd) cd -eu x=1 grep $(pwd) readonly grep grep
+	test awk --verbose printf --verbose
+readonly readonly local cd /usr/bin -eu
+-eu "$@" readonly grep -eu "$1" 2>/dev/null local x=1 then
+	x=1 $(pwd) export cd $(pwd) /usr/bin &&
+	printf local test $(pwd)
+		"$@" then cd readonly export local readonly "$1" test -eu 2>/dev/null
+		/usr/bin ${HOME} --verbose then 2>/dev/null && | "$@"
+		2>/dev/null cd | x=1 $(pwd) && $(pwd) printf awk ${HOME} printf then
+local echo then $(pwd) done x=1
+		echo "$1" awk grep --verbose then awk local cd cd test export export
+awk awk && sed /usr/bin -eu
+	$(pwd) grep 2>/dev/null test /usr/bin sed done "$@" $(pwd) -eu /usr/bin awk echo
+		&& printf -eu local local echo grep -eu | | "$@" --verbose
+		export then export test 'quoted text' export
+	local printf | then --verbose /usr/bin echo export printf cd printf
+	done "$@" awk 'quoted text' 'quoted text' export x=1 test sed &&
+		readonly $(pwd) done grep
+	/usr/bin | "$@" 2>/dev/null then cd 'quoted text'
+echo awk && grep cd echo -eu awk x=1 && done "$1"
+awk x=1 echo test /usr/bin
+done readonly && cd && | /usr/bin grep cd 'quoted text' 2>/dev/null printf 'quoted text'
+		test awk test cd cd then
+	local readonly export export cd done then
+		"$1" done test cd ${HOME} $(pwd) --verbose "$1" readonly
+grep test test ${HOME}
+done | cd /usr/bin 'quoted text' x=1 awk readonly
+	| cd printf --verbose done cd export sed "$@" grep -eu 2>/dev/null
+		local done ${HOME} readonly x=1 sed $(pwd) cd then "$@" --verbose echo done "$@"
+then sed readonly 2>/dev/null readonly sed done && x=1 awk --verbose cd
+		/usr/bin -eu x=1 x=1 local sed /usr/bin local echo test sed grep "$1"
+	2>/dev/null sed -eu 2>/dev/null readonly readonly sed test sed cd 2>/dev/null
+	cd | ${HOME} awk --verbose readonly
+	grep printf printf then awk "$@" test local awk
+2>/dev/null x=1 export sed grep local --verbose
+	readonly -eu then x=1 -eu readonly
+		${HOME} x=1 test | cd
+echo sed 2>/dev/null awk --verbose
+grep && | awk then cd local grep 'quoted text' cd "$@" sed && printf then x=1
+	then ${HOME} 2>/dev/null x=1 2>/dev/null printf -eu ${HOME}
+	readonly /usr/bin cd export then done "$@" | test
+local cd sed 'quoted text' --verbose
+2>/dev/null "$1" echo /usr/bin | | export readonly grep readonly
+	cd test awk local readonly 'quoted text' 2>/dev/null then export x=1 -eu
+	grep 2>/dev/null awk "$@" printf -eu "$@" /usr/bin echo $(pwd)
+"$1" echo && sed ${HOME} awk &&
+		printf ${HOME} awk ${HOME} readonly && readonly
+	printf cd $(pwd) local && &&
+2>/dev/null | $(pwd) "$@" 'quoted text' echo awk 2>/dev/null
+export /usr/bin test
+	--verbose | test $(pwd) sed sed /usr/bin 'quoted text' printf ${HOME}
+		echo --verbose test 2>/dev/null test echo "$@"
+		cd && printf "$@" 'quoted text' cd printf awk grep cd sed echo test test
+	| "$@" then cd /usr/bin readonly "$@" printf "$1"
+	x=1 then cd ${HOME} grep /usr/bin --verbose
+done 'quoted text' | echo test /usr/bin | x=1 'quoted text' 2>/dev/null
+-eu grep --verbose printf $(pwd) local local export
+		printf x=1 /usr/bin 'quoted text' done --verbose -eu then grep
+	-eu sed awk echo 2>/dev/null $(pwd) ${HOME} 2>/dev/null
+	${HOME} printf grep "$@" /usr/bin grep
+		'quoted text' printf done test sed local grep | done sed ${HOME} "$1"
+test grep --verbose awk readonly then "$@"
+		-eu test echo ${HOME} 'quoted text' local done $(pwd) | "$@" printf "$1" | sed
+then cd awk grep "$@" local done sed /usr/bin -eu grep | test
+		export /usr/bin ${HOME}
+		done awk 'quoted text' /usr/bin grep local /usr/bin
+	'quoted text' -eu && test sed "$@"
+		/usr/bin | cd "$@" export grep done grep cd "$@"
+	"$1" "$1" 'quoted text' ${HOME}
+2>/dev/null echo 'quoted text' then readonly x=1 done sed | cd
+	grep readonly 'quoted text' cd && /usr/bin awk ${HOME} done --verbose 'quoted text'
+		done /usr/bin awk 'quoted text' && -eu awk $(pwd) cd
+--verbose -eu then cd printf cd /usr/bin sed local ${HOME} echo | echo
+	printf | | grep printf done readonly "$@"
+$(pwd) x=1 export then then "$1" done cd sed
+	/usr/bin ${HOME} 'quoted text' echo /usr/bin
+| $(pwd) x=1 export -eu /usr/bin ${HOME}
+		printf test echo local export --verbose "$@" --verbose
+		&& local $(pwd) grep done
+then $(pwd) sed 2>/dev/null
+		grep test test $(pwd) cd -eu done printf grep -eu "$@" | 'quoted text' cd printf
+| ${HOME} && 2>/dev/null /usr/bin /usr/bin
+done -eu printf grep "$1" awk /usr/bin then && printf sed "$1" export done
+'quoted text' printf && ${HOME} test echo sed --verbose
+x=1 awk printf then && 'quoted text'
+		then awk -eu x=1 test test |
+	"$@" printf export $(pwd) "$@" export
+		sed sed x=1 'quoted text' $(pwd) | $(pwd)
+		-eu "$@" x=1 local 'quoted text' echo test test $(pwd) && $(pwd) done 2>/dev/null
+--verbose "$1" sed readonly cd && -eu sed grep -eu
+		"$@" 'quoted text' /usr/bin $(pwd) grep 'quoted text'
+		| "$1" | -eu local sed ${HOME} done readonly echo "$1"
+		export readonly awk awk 'quoted text' --verbose x=1 "$@" export
+$(pwd) local sed cd local then echo 2>/dev/null -eu x=1
+done echo done /usr/bin printf cd
+/usr/bin echo awk --verbose "$@" && test -eu /usr/bin --verbose /usr/bin /usr/bin
+	grep readonly && export then
+"$@" 2>/dev/null 'quoted text' && && && x=1
+	export 2>/dev/null grep cd --verbose --verbose grep
+local local -eu "$@" export readonly
+--verbose test $(pwd) 2>/dev/null 2>/dev/null
+	"$1" "$@" "$1" awk readonly $(pwd) $(pwd) export "$@" grep
+printf 2>/dev/null $(pwd) cd x=1 cd grep
+2>/dev/null x=1 local x=1 2>/dev/null readonly local $(pwd)
+		/usr/bin grep /usr/bin -eu export cd ${HOME} 2>/dev/null "$@" test 2>/dev/null
+'quoted text' /usr/bin $(pwd)
+	x=1 -eu cd ${HOME} done | export local /usr/bin 'quoted text' "$@"
+${HOME} "$1" test x=1 'quoted text' done /usr/bin grep
+test sed $(pwd) readonly sed --verbose cd echo -eu && | 'quoted text' "$1"
+readonly cd /usr/bin sed grep awk done && printf ${HOME} done grep "$@" $(pwd)
+		done echo done x=1 grep 'quoted text'
+	x=1 -eu /usr/bin awk "$@" 2>/dev/null
+		printf x=1 grep && "$@" test 'quoted text'
+	done "$1" x=1 | $(pwd) --verbose ${HOME} --verbose test readonly
+	--verbose -eu && done /usr/bin
+	${HOME} "$1" "$1" 2>/dev/null printf $(pwd) done
+'quoted text' grep test printf -eu
+	local done "$@" x=1 --verbose $(pwd)
+	${HOME} readonly local printf -eu -eu awk done /usr/bin "$@" awk ${HOME}
+		export cd done printf echo done echo test echo sed sed
+readonly then test cd export readonly x=1 echo --verbose
+--verbose then -eu readonly test
+		'quoted text' readonly ${HOME} "$1" $(pwd) 2>/dev/null
+	-eu --verbose awk /usr/bin local 'quoted text' "$1" grep x=1 -eu 'quoted text'
+		/usr/bin readonly ${HOME} test -eu cd grep &&
+	echo then test 'quoted text' x=1 /usr/bin 'quoted text' "$1" local
+x=1 sed "$@" -eu test 2>/dev/null &&
+		/usr/bin then "$1" 'quoted text' sed 'quoted text' && && then -eu -eu 'quoted text'
+		--verbose awk | readonly -eu --verbose --verbose then
+	done $(pwd) 2>/dev/null awk echo $(pwd) 'quoted text'
+test "$1" sed readonly x=1
+		--verbose 'quoted text' local
+		2>/dev/null && grep -eu --verbose
+grep | | "$@" readonly echo test
+"$@" cd $(pwd) --verbose && export x=1 awk ${HOME}
+	'quoted text' && 'quoted text' 2>/dev/null cd echo test cd 2>/dev/null
+	export echo echo local /usr/bin --verbose
+	| awk echo "$@" readonly done echo
+${HOME} test 2>/dev/null awk
+--verbose awk ${HOME} printf then "$@" "$@" && "$1" "$1" ${HOME}
+		local 2>/dev/null $(pwd) done printf printf readonly 'quoted text'
+		"$@" then && /usr/bin then readonly echo "$@" sed "$1" sed ${HOME} cd |
+	--verbose 'quoted text' sed cd | 2>/dev/null echo /usr/bin &&
+2>/dev/null /usr/bin 2>/dev/null done
+		echo | echo printf /usr/bin | 2>/dev/null
+		${HOME} then /usr/bin cd test grep "$@" echo ${HOME} $(pwd)
+		| sed x=1 grep awk && test && | 2>/dev/null -eu echo echo
+	sed 'quoted text' ${HOME} /usr/bin
+printf "$@" -eu /usr/bin | x=1 grep --verbose ${HOME} ${HOME} then x=1 && /usr/bin
+		awk then done "$@" printf /usr/bin cd -eu ${HOME} test $(pwd)
+	$(pwd) readonly ${HOME} 2>/dev/null sed /usr/bin | "$@" cd export "$1"
+		"$@" -eu "$1" $(pwd) echo 2>/dev/null | && export && && sed awk export
+		sed readonly test $(pwd) "$@"
+grep then | && ${HOME} 2>/dev/null
+cd then test 2>/dev/null
+		'quoted text' readonly test x=1 --verbose grep "$1" 2>/dev/null test 'quoted text'
+test && printf printf --verbose 2>/dev/null printf cd awk
+		sed "$1" -eu then x=1 -eu
+'quoted text' "$1" cd
+local 2>/dev/null echo
+grep 2>/dev/null -eu x=1 2>/dev/null 2>/dev/null grep cd 'quoted text'
+		echo "$1" ${HOME} test --verbose 2>/dev/null
+		done then x=1 /usr/bin export "$@" sed grep test done -eu "$1" "$1"
+		readonly test printf readonly
+done "$1" && readonly test && $(pwd) --verbose
+x=1 printf $(pwd) readonly done -eu local | readonly
+/usr/bin "$@" printf 2>/dev/null test then "$1" sed readonly ${HOME}
+cd cd then && printf local local 'quoted text' /usr/bin printf /usr/bin -eu $(pwd)
+local local 'quoted text' x=1 | test awk
+		--verbose x=1 echo export echo test done && test then printf --verbose done
+		'quoted text' readonly /usr/bin ${HOME} test "$@" sed ${HOME} readonly 'quoted text'
+	echo $(pwd) && export readonly done -eu printf printf 2>/dev/null
+	&& $(pwd) 'quoted text' /usr/bin x=1 x=1 awk x=1 awk 2>/dev/null
+		local $(pwd) /usr/bin sed 'quoted text'
+printf ${HOME} x=1 && | awk $(pwd) done -eu readonly sed printf
+	echo ${HOME} echo "$1" done echo awk $(pwd) "$@" && | test echo && grep "$@"
+/usr/bin "$1" printf 'quoted text' "$@" readonly $(pwd) done grep
+	&& -eu && grep awk test awk x=1 && sed
+--verbose -eu && readonly readonly echo && --verbose
+		"$@" -eu && cd "$@" local echo sed
+echo ${HOME} test ${HOME} "$1"
+$(pwd) cd then printf grep
+	x=1 printf /usr/bin cd done printf then /usr/bin
+	$(pwd) 2>/dev/null && echo readonly && readonly 2>/dev/null
+	| printf ${HOME} 'quoted text' "$@" 'quoted text' 'quoted text' "$1" "$1" &&
+	done sed -eu done grep x=1 sed test 2>/dev/null printf
+grep "$1" export | printf /usr/bin then
+	done -eu done 'quoted text' && readonly --verbose local 'quoted text'
+		--verbose printf 'quoted text' export 2>/dev/null
+		printf "$1" "$1" test test -eu local x=1 cd done echo ${HOME} -eu 'quoted text'
+${HOME} -eu then cd done /usr/bin then cd printf cd grep x=1 test
+		&& test | awk --verbose
+printf then export "$@" echo readonly
+	cd then 'quoted text' x=1 "$@" 2>/dev/null echo && ${HOME}
+	| /usr/bin grep done 'quoted text' -eu
+	'quoted text' local cd 'quoted text' -eu export "$1" local | then sed x=1 echo
+		test grep | echo --verbose
+"$@" local 'quoted text' local cd && awk sed done
+	&& echo x=1 2>/dev/null
+"$1" test grep printf | "$@" export ${HOME} test "$1" --verbose -eu && grep
+| sed ${HOME} && && done local 'quoted text' --verbose
+	awk cd "$@" 'quoted text' echo printf "$1" $(pwd)
+	cd export cd awk | /usr/bin export -eu -eu awk local "$@" printf 2>/dev/null 'quoted text'
+	local -eu | cd printf grep && "$1" test "$@" "$@" | done "$1" 'quoted text'
+export x=1 "$@" awk test
+	sed cd 2>/dev/null --verbose
+sed done then $(pwd) then | 'quoted text' $(pwd)
+	readonly "$@" /usr/bin then export
+2>/dev/null readonly "$1" && | echo && "$@" x=1 --verbose
+		--verbose test x=1 'quoted text'
+	2>/dev/null "$@" test --verbose | echo export
+	"$1" export local export then done
+'quoted text' done "$1" test echo ${HOME} test 2>/dev/null /usr/bin x=1 then
+grep "$1" printf then local done "$@"
+x=1 then 'quoted text' "$1" printf "$1" /usr/bin cd awk -eu -eu test
+| /usr/bin 'quoted text' "$1" export 'quoted text' awk --verbose
+	then grep ${HOME} test cd awk "$@" --verbose done grep && test "$@"
+	--verbose --verbose -eu cd "$@" grep "$@" "$1"
+2>/dev/null "$@" --verbose awk --verbose
+sed --verbose 2>/dev/null awk export
+	local local -eu "$1" | readonly x=1 local "$1" echo | grep printf
+		grep cd printf -eu 'quoted text' | | /usr/bin local awk echo x=1
+		| echo $(pwd) grep readonly /usr/bin
+"$@" "$@" x=1 && cd done sed echo "$@"
+	/usr/bin test echo grep /usr/bin done awk
+x=1 readonly local 'quoted text'
+'quoted text' | --verbose | grep "$@" awk sed cd /usr/bin
+		--verbose 2>/dev/null 2>/dev/null awk 'quoted text'
+2>/dev/null x=1 cd sed ${HOME} x=1 awk
+		'quoted text' --verbose sed test local | test grep awk local done
+		$(pwd) /usr/bin --verbose local -eu
+cd printf $(pwd) --verbose awk echo then && test "$1" awk test /usr/bin done
+	| cd "$@" && "$1" then echo --verbose grep
+&& 'quoted text' done printf && ${HOME}
+	/usr/bin then test x=1 awk printf 'quoted text' cd && ${HOME} 'quoted text'
+--verbose awk grep x=1 printf export local $(pwd) | "$1" x=1 awk local
+		"$@" | | --verbose done sed readonly test -eu done
+-eu sed --verbose cd ${HOME} "$1" printf 'quoted text' export export "$1" export
+-eu printf then local 2>/dev/null x=1 2>/dev/null readonly /usr/bin 2>/dev/null
+		${HOME} && done 2>/dev/null "$@" printf grep && printf done readonly
+	"$@" 2>/dev/null done /usr/bin x=1 printf printf echo readonly "$@" &&
+		2>/dev/null done $(pwd) | $(pwd) 2>/dev/null 'quoted text' grep
+	x=1 echo -eu done /usr/bin readonly
+		$(pwd) --verbose awk cd then local
+		readonly printf "$@" local test
+sed --verbose "$1" sed && sed local 'quoted text' grep "$1" /usr/bin
+${HOME} && test export x=1 $(pwd) x=1 /usr/bin $(pwd) printf &&
+	-eu awk then --verbose test local printf
+		echo $(pwd) readonly /usr/bin
+grep x=1 -eu test 'quoted text'
+	local grep 2>/dev/null test 2>/dev/null /usr/bin 'quoted text'
+		export test ${HOME} "$1" then printf && awk
+export "$1" | cd then printf x=1
+	grep readonly $(pwd) echo awk local echo sed grep printf 'quoted text' && $(pwd)
+		2>/dev/null x=1 "$1" echo sed "$1" | sed | printf 2>/dev/null then
+	done local 2>/dev/null /usr/bin readonly && && "$@"
+	test ${HOME} "$1" 'quoted text' -eu grep 2>/dev/null local done awk
+	&& x=1 awk awk "$1" printf "$@" then echo printf "$@" grep "$@" echo readonly |
+		test -eu x=1 awk printf --verbose "$1" /usr/bin export
+		done done /usr/bin sed test
+awk -eu sed "$@" cd local readonly
+-eu then done then x=1 export && $(pwd) echo --verbose /usr/bin 'quoted text'
+		'quoted text' "$@" /usr/bin 2>/dev/null -eu
+"$1" /usr/bin test grep 2>/dev/null --verbose
+cd awk ${HOME} done grep "$@" printf awk ${HOME} "$1" $(pwd) printf
+	2>/dev/null && ${HOME} $(pwd) then done export && "$1" "$1" done
+	"$1" ${HOME} $(pwd) && -eu
+		${HOME} $(pwd) /usr/bin readonly echo "$1" && echo echo --verbose x=1
+	test x=1 "$1" --verbose /usr/bin "$1" export "$1" 'quoted text' "$@"
+awk && awk grep printf grep /usr/bin "$1" printf /usr/bin ${HOME} cd
+	export awk awk test && local echo readonly -eu && then $(pwd) --verbose local
+	echo 2>/dev/null x=1 | "$1" /usr/bin printf
+		| && 2>/dev/null -eu 2>/dev/null
+	| local test done x=1 ${HOME}
+local cd done local x=1 readonly readonly /usr/bin then -eu awk && sed done echo
+	local echo echo grep export then "$@"
+	then ${HOME} done local /usr/bin --verbose
+		grep ${HOME} done echo /usr/bin cd && "$@"
+	then 'quoted text' "$@" printf $(pwd) ${HOME} -eu "$1" "$@" "$1" --verbose
+cd "$@" x=1 | export sed test printf local awk grep
+		test echo done 'quoted text'
+x=1 'quoted text' sed --verbose awk test awk --verbose test cd 2>/dev/null
+		/usr/bin grep sed && && 'quoted text'
+then then awk then x=1 sed echo $(pwd) then
+	'quoted text' echo ${HOME} 'quoted text' ${HOME} cd cd 'quoted text' printf
+	${HOME} ${HOME} x=1 -eu cd awk $(pwd) export
+	sed readonly cd && echo $(pwd) 2>/dev/null sed grep then
+		readonly export | "$1"
+		export && && cd $(pwd) && cd x=1 $(pwd)
+	echo --verbose readonly readonly then then 2>/dev/null
+'quoted text' 2>/dev/null awk /usr/bin
+		-eu then test && 'quoted text' awk export 2>/dev/null $(pwd) "$@" --verbose
+export local test 'quoted text' grep -eu ${HOME}
+		"$@" -eu 'quoted text'
+'quoted text' x=1 "$1" $(pwd) "$@" 'quoted text' /usr/bin /usr/bin ${HOME}
+&& 2>/dev/null ${HOME} /usr/bin test /usr/bin &&
+	/usr/bin -eu --verbose test readonly -eu grep
+	export awk x=1 ${HOME} x=1 'quoted text' printf grep grep test && /usr/bin
+	"$1" | /usr/bin grep 'quoted text'
+then $(pwd) --verbose "$1"
+		/usr/bin x=1 $(pwd) done /usr/bin echo | export &&
+| cd awk | test echo grep /usr/bin echo
+local ${HOME} -eu echo readonly "$@" "$1" sed "$@" echo then "$1" --verbose
+		echo --verbose 2>/dev/null awk -eu
+"$@" readonly x=1 'quoted text' ${HOME} grep readonly
+		| /usr/bin "$@" echo local test
+		&& local sed 'quoted text' local 'quoted text' test &&
+grep then ${HOME} cd 'quoted text' ${HOME} -eu local --verbose
+		"$1" printf "$1" cd "$1" local --verbose export
+-eu test ${HOME} "$1" echo $(pwd)
+	'quoted text' grep sed 2>/dev/null --verbose x=1 | test | awk awk export
+grep | "$1" export /usr/bin cd grep -eu cd | cd readonly printf grep grep
+cd && -eu printf && 2>/dev/null printf
+		"$1" awk && grep | ${HOME} | grep | readonly export
+		test local local --verbose | 'quoted text' readonly | then export
+export then $(pwd) grep && grep export echo "$1" "$1" awk local --verbose
+	export test then then local sed then echo x=1 | echo ${HOME} sed local readonly
+		$(pwd) | then "$@" awk readonly readonly "$@" then "$1" sed sed
+		"$@" echo | cd -eu 2>/dev/null -eu $(pwd) done cd 'quoted text' grep
+echo done 'quoted text' $(pwd) 2>/dev/null grep
+	grep then then then 2>/dev/null "$1" &&
+		test "$@" 'quoted text' $(pwd) $(pwd)
+	cd ${HOME} then x=1 "$@" done echo printf "$@" ${HOME} test
+	printf awk awk 2>/dev/null local test 'quoted text' x=1 done
+	| printf -eu done export -eu ${HOME} done --verbose echo ${HOME} awk
+	'quoted text' echo printf "$@" echo then -eu ${HOME} then echo cd /usr/bin
+awk done /usr/bin grep x=1 -eu $(pwd) 2>/dev/null echo export ${HOME} 'quoted text'
+'quoted text' cd | x=1 /usr/bin then cd && echo
+test -eu | $(pwd) printf && ${HOME} 'quoted text'
+	"$1" readonly then then --verbose ${HOME} |
+	echo ${HOME} 'quoted text'
+	printf $(pwd) -eu /usr/bin done then "$1" sed readonly grep export then
+	&& test awk readonly
+grep readonly /usr/bin 'quoted text' readonly readonly --verbose
+		| test printf readonly then
+printf ${HOME} x=1 "$@" 'quoted text'
+	-eu x=1 cd awk echo local sed awk x=1 awk && readonly 'quoted text' grep
+printf export 2>/dev/null sed /usr/bin export $(pwd) "$@" sed test 2>/dev/null
+cd then /usr/bin 'quoted text' export sed cd printf sed /usr/bin | printf
+	sed && readonly ${HOME} printf "$@" then "$1" then | ${HOME} 2>/dev/null
+	"$@" awk | /usr/bin readonly echo echo done printf --verbose /usr/bin "$1" grep
+	2>/dev/null | --verbose $(pwd) 2>/dev/null then /usr/bin echo local sed awk readonly
+	"$1" done --verbose --verbose
+awk echo | local --verbose
+	${HOME} x=1 sed --verbose then 'quoted text'
+	done grep && | | $(pwd) awk readonly grep --verbose
+	&& "$@" /usr/bin done done $(pwd) echo ${HOME}
+echo $(pwd) done 2>/dev/null | x=1
+		"$@" --verbose awk awk grep
+	done ${HOME} local "$1" --verbose $(pwd) printf cd /usr/bin printf ${HOME}
+		then | --verbose echo test -eu awk done -eu test
+	export x=1 && echo local then echo export "$@" echo && echo
+	then test && then sed awk cd $(pwd) 2>/dev/null
+${HOME} printf x=1 --verbose -eu $(pwd) /usr/bin echo
+		awk --verbose done cd | test | -eu 'quoted text'
+sed printf sed export sed printf | 'quoted text' printf x=1 cd /usr/bin && x=1
+	grep x=1 2>/dev/null 2>/dev/null --verbose
+--verbose /usr/bin awk readonly -eu /usr/bin 2>/dev/null export $(pwd) && printf
+	cd | "$@" cd test --verbose grep done x=1 /usr/bin local cd then
+	/usr/bin done /usr/bin ${HOME} "$@" test
+grep export /usr/bin ${HOME}
+	export ${HOME} test /usr/bin x=1 printf done "$1" readonly readonly x=1 2>/dev/null
+		awk "$1" "$@" then ${HOME} sed
+		echo readonly 2>/dev/null x=1 /usr/bin --verbose 2>/dev/null --verbose "$@" cd
+	echo "$1" local $(pwd) readonly
+| /usr/bin ${HOME} grep x=1 | cd then 'quoted text'
+	| --verbose done cd | $(pwd) ${HOME} "$@" "$@" | ${HOME} "$@" && readonly
+awk $(pwd) "$@" test 2>/dev/null printf "$1" x=1 -eu ${HOME}
+		${HOME} "$1" local 2>/dev/null awk echo sed cd grep echo -eu test
+done export grep printf cd then awk -eu then "$1" && /usr/bin printf
+done grep readonly "$1" local "$@" sed "$@" -eu done $(pwd) x=1 echo "$1" local
+	test "$@" export /usr/bin echo $(pwd) -eu
+		2>/dev/null sed printf local done
+	local $(pwd) -eu echo cd echo local then grep printf export ${HOME}
+		export awk && readonly
+		"$1" done 'quoted text' 2>/dev/null local | done grep 'quoted text' cd "$@" ${HOME}
+then -eu && local ${HOME} && local test
+readonly 2>/dev/null awk readonly 'quoted text' test $(pwd) printf 'quoted text'
+&& awk && export sed && printf test x=1 awk sed sed $(pwd)
+		echo ${HOME} "$@" "$1" awk
+	cd 2>/dev/null then $(pwd) /usr/bin "$@" $(pwd)
+	'quoted text' awk printf ${HOME} then export cd cd done ${HOME}
+&& export 'quoted text'
+sed x=1 done local done done printf "$1" export
+	${HOME} echo echo printf printf local cd && export printf /usr/bin sed 'quoted text'
+	-eu printf then 'quoted text'
+${HOME} then local 2>/dev/null $(pwd) ${HOME} /usr/bin --verbose printf
+grep printf -eu -eu export
+x=1 && awk then local cd && 2>/dev/null
+		readonly cd printf then then | 'quoted text' 'quoted text'
+| "$@" -eu sed grep 2>/dev/null x=1 readonly readonly "$1"
+		then 'quoted text' "$@"
+		"$@" done | -eu 2>/dev/null
+		echo 'quoted text' /usr/bin
+x=1 grep "$@" $(pwd) --verbose test test readonly then sed && x=1
+		grep 'quoted text' grep && test grep 2>/dev/null
+printf printf sed awk $(pwd) "$1" --verbose "$1" $(pwd) cd | done "$1"
+		-eu ${HOME} x=1 then "$1" /usr/bin "$@" done ${HOME} $(pwd)
+		-eu awk $(pwd) readonly local x=1 cd printf grep then
+		"$@" 2>/dev/null echo echo "$1" local local --verbose sed done 2>/dev/null
+		test done 'quoted text' done grep local --verbose then "$1"
+| -eu echo printf x=1 sed /usr/bin test cd "$@" sed echo export 'quoted text' cd
+	export "$1" cd && 'quoted text' echo x=1 grep then --verbose | | printf
+	test sed test | /usr/bin sed readonly ${HOME} then && local 'quoted text'
+		$(pwd) /usr/bin "$1" sed $(pwd) "$@" && x=1 echo cd sed
+	| awk "$1" cd awk grep /usr/bin /usr/bin grep 2>/dev/null
+		2>/dev/null echo x=1 echo 'quoted text' readonly -eu $(pwd)
+local x=1 awk "$1" $(pwd) done $(pwd) export local done --verbose
+		export 2>/dev/null readonly done
+		${HOME} -eu grep | 'quoted text' awk | echo /usr/bin test printf ${HOME} local
+	$(pwd) test $(pwd) test $(pwd) 'quoted text' --verbose
+	export /usr/bin test awk ${HOME} grep && | 2>/dev/null
+'quoted text' $(pwd) export | ${HOME}
+		cd 2>/dev/null grep printf x=1 2>/dev/null printf | test cd -eu x=1 /usr/bin
+		2>/dev/null /usr/bin --verbose test done sed done awk
+${HOME} grep x=1 export readonly ${HOME} | then grep echo grep cd
+export | -eu export ${HOME} sed then x=1 export grep
+x=1 done awk 'quoted text' /usr/bin "$@" && 'quoted text' local -eu x=1 | echo
+		"$@" "$@" test "$1" "$1" 2>/dev/null 'quoted text' x=1
+	echo done $(pwd) sed
+		2>/dev/null export sed "$1" local awk "$@" $(pwd) 'quoted text'
+	grep && echo echo && test /usr/bin cd echo && -eu printf "$@" local x=1 2>/dev/null
+cd grep export ${HOME} echo sed $(pwd)
+	"$@" /usr/bin ${HOME} sed 2>/dev/null local echo ${HOME} 'quoted text'
+	done awk "$@" 2>/dev/null | readonly
+export | 'quoted text' sed printf echo $(pwd) done local
+		$(pwd) test echo cd export sed -eu -eu "$@" local echo
+	then && awk printf sed sed then readonly "$@"
+		/usr/bin && 'quoted text' --verbose "$1" | && cd ${HOME} 2>/dev/null cd ${HOME}
+	2>/dev/null done cd "$1" sed x=1 --verbose /usr/bin done
+	sed cd | "$1" 2>/dev/null && sed "$1" then &&
+&& awk 2>/dev/null --verbose export ${HOME} test readonly | awk local
+		awk printf printf x=1 ${HOME} awk export $(pwd) printf
+"$@" awk 'quoted text' sed ${HOME} cd export
+"$1" | printf sed 2>/dev/null --verbose
+readonly local printf 'quoted text' 2>/dev/null -eu export
+	readonly readonly "$1" test local
+&& test "$1" "$@" readonly "$1" "$@" x=1 && echo
+	"$@" cd $(pwd) | readonly then && $(pwd) /usr/bin grep sed ${HOME}
+		grep then "$1" | && -eu /usr/bin test ${HOME} cd -eu /usr/bin
+		&& "$1" && export 'quoted text' x=1 | awk -eu /usr/bin awk echo ${HOME}
+	printf 2>/dev/null printf
+"$1" printf echo cd --verbose echo local
+done sed 'quoted text' "$@" "$@" ${HOME} x=1 "$1" 'quoted text'
+		x=1 echo then ${HOME} then $(pwd) -eu $(pwd)
+-eu sed x=1 sed x=1 test
+		then 2>/dev/null awk cd readonly && && "$@" sed 'quoted text'
+		then $(pwd) echo export echo printf 2>/dev/null readonly 'quoted text' local &&
+done "$1" local && && grep done sed x=1 -eu awk test
+		printf "$@" readonly cd 'quoted text'
+awk | printf x=1 cd -eu 2>/dev/null "$@" x=1 --verbose cd 2>/dev/null
+--verbose export 2>/dev/null then --verbose
+	awk test test then 'quoted text' /usr/bin export
+grep printf x=1 local test | 2>/dev/null x=1
+${HOME} sed "$1" | $(pwd) cd export echo && local
+		"$@" readonly printf sed printf x=1 cd $(pwd) 2>/dev/null
+		x=1 test "$@" "$1" readonly readonly "$1" $(pwd) && /usr/bin "$@"
+	readonly && && 2>/dev/null 'quoted text' && 2>/dev/null
+		sed export | echo echo 2>/dev/null
+		printf then readonly printf 2>/dev/null --verbose ${HOME}
+		awk ${HOME} cd 'quoted text' awk export && awk export printf "$1" 'quoted text'
+		sed && && | done grep readonly readonly
+	2>/dev/null awk | && sed | /usr/bin "$1" &&
+awk awk echo "$1" ${HOME} export
+	| "$@" grep grep | x=1 | test local local ${HOME} -eu
+		x=1 2>/dev/null grep "$@" echo cd /usr/bin echo ${HOME}
+		'quoted text' 2>/dev/null sed awk && echo sed local
+	printf x=1 'quoted text' test echo | ${HOME} "$@" grep
+&& --verbose test export grep readonly
+"$1" --verbose "$@" echo readonly
+		$(pwd) -eu $(pwd) $(pwd) done ${HOME} echo && --verbose done readonly -eu /usr/bin
+	x=1 readonly && test sed | "$1" -eu $(pwd) 'quoted text' x=1 2>/dev/null
+	-eu printf x=1 | awk 2>/dev/null && x=1 readonly printf 2>/dev/null echo printf
+		| $(pwd) x=1 grep 'quoted text' "$@" done -eu $(pwd)
+	then -eu --verbose | test x=1 ${HOME} export "$@"
+		2>/dev/null --verbose "$@" export ${HOME} "$@" -eu export | local
+		x=1 x=1 "$@" export 2>/dev/null printf awk --verbose cd awk "$@" test
+	grep awk -eu --verbose "$@" 2>/dev/null 'quoted text' export -eu 2>/dev/null
+	cd echo test then readonly ${HOME} 'quoted text' export -eu awk "$@" --verbose
+		awk /usr/bin sed -eu -eu /usr/bin readonly echo
+2>/dev/null done --verbose /usr/bin local 'quoted text' echo --verbose
+		then printf "$@" /usr/bin then cd test awk 'quoted text' /usr/bin $(pwd)
+	sed printf $(pwd) --verbose x=1 "$1" "$1" readonly 'quoted text' | done
+${HOME} --verbose then -eu test $(pwd) export 'quoted text' done "$@" test
+	${HOME} 2>/dev/null && 2>/dev/null
+export printf sed $(pwd) x=1 2>/dev/null then local export sed "$@" 'quoted text'
+	x=1 ${HOME} "$1" 2>/dev/null && grep | sed sed echo echo done sed && grep | /usr/bin
+	/usr/bin done then then awk cd "$@" local /usr/bin 2>/dev/null | export
+		export printf echo -eu
+export ${HOME} 'quoted text' /usr/bin 2>/dev/null
+sed awk /usr/bin test export
+sed test ${HOME} export grep 2>/dev/null then | local
+grep -eu "$@" -eu /usr/bin grep
+	$(pwd) grep cd -eu export local "$@" readonly x=1 sed echo "$@" done cd &&
+export test 2>/dev/null | &&
+		${HOME} grep && readonly $(pwd) 2>/dev/null test --verbose --verbose cd -eu
+#include c12.sh
+	&& test grep --verbose x=1
+x=1 readonly export "$@" then && /usr/bin "$1" x=1 --verbose
+	"$@" printf cd then && echo readonly x=1 test $(pwd) sed printf
+'quoted text' 'quoted text' test /usr/bin export --verbose
+	$(pwd) --verbose && local x=1 printf then 'quoted text'
+		x=1 && grep readonly |
+echo $(pwd) echo -eu x=1 && 'quoted text'
+		sed | ${HOME} printf echo /usr/bin printf
+		-eu sed sed done x=1 export export
+	| cd "$@" "$@" awk awk x=1
+$(pwd) readonly awk "$@"
+	&& readonly test awk local -eu echo readonly x=1 awk 'quoted text' "$1"
+	&& -eu grep x=1 ${HOME} /usr/bin then export && then printf && sed
+2>/dev/null | printf grep | | then printf export
+$(pwd) | ${HOME} awk 'quoted text' printf local
+	awk printf "$1" "$1" ${HOME} awk | $(pwd) readonly "$@"
+		printf done "$@" export local cd && --verbose
+	echo printf export | then 'quoted text'
+		/usr/bin readonly "$@" 'quoted text' "$@" --verbose
+		test cd sed 2>/dev/null readonly export $(pwd) 2>/dev/null export sed printf
+		printf && sed done ${HOME} export ${HOME} "$1" "$@" grep
+		-eu awk /usr/bin -eu cd test -eu ${HOME} test done &&
+	--verbose cd -eu "$1" | printf --verbose /usr/bin 2>/dev/null printf
+		-eu readonly awk "$1" "$@" done sed printf
+		export /usr/bin local 'quoted text' done export && sed then
+printf then "$@" export sed |
+	&& test echo && grep ${HOME} /usr/bin x=1 "$@" grep $(pwd) cd | $(pwd) 'quoted text'
+		"$1" readonly 'quoted text' 2>/dev/null cd cd
+		$(pwd) "$1" "$@" 'quoted text' awk printf $(pwd) && 'quoted text' 'quoted text'
+		echo 'quoted text' readonly echo ${HOME} echo /usr/bin
+	test export then local sed done && test local sed
+		readonly cd 2>/dev/null printf
+	"$@" 2>/dev/null | x=1 grep readonly sed test export
+then x=1 2>/dev/null 2>/dev/null local export x=1 printf done
+		awk -eu -eu printf printf export echo awk then | /usr/bin
+2>/dev/null grep | /usr/bin echo "$1" cd local 'quoted text' $(pwd)
+	$(pwd) x=1 /usr/bin export /usr/bin "$@" printf test
+		${HOME} --verbose /usr/bin x=1 echo printf "$1" "$@" printf "$1" readonly x=1
+	printf /usr/bin printf done
+awk then local echo x=1 cd
+2>/dev/null "$1" done | printf export printf
+local && readonly test
+	| && local cd "$1" sed printf 2>/dev/null
+cd 2>/dev/null ${HOME} --verbose readonly
+printf sed x=1 && export ${HOME} test local -eu 'quoted text' done
+	printf grep test echo 2>/dev/null 2>/dev/null
+		'quoted text' --verbose local $(pwd)
+		echo 2>/dev/null 'quoted text' "$@" ${HOME} /usr/bin
+		readonly /usr/bin then "$1" awk | echo --verbose $(pwd)
+	'quoted text' 'quoted text' grep 'quoted text' "$@" sed | cd "$1" 'quoted text'
+		2>/dev/null "$@" && test readonly grep && x=1 local 'quoted text' | done
+	cd done --verbose ${HOME} readonly awk "$@" --verbose 'quoted text'
+		2>/dev/null awk 'quoted text' grep ${HOME} grep then grep 2>/dev/null 'quoted text'
+		2>/dev/null done local then ${HOME} $(pwd)
+2>/dev/null echo 'quoted text' 2>/dev/null 'quoted text'
+awk 2>/dev/null | export 2>/dev/null done $(pwd)
+		readonly export cd "$1" sed printf x=1 ${HOME}
+${HOME} grep printf "$@" export test -eu printf export printf
+	-eu $(pwd) done test "$1" $(pwd) echo "$1"
+		done /usr/bin /usr/bin readonly 2>/dev/null ${HOME}
+	awk $(pwd) ${HOME} awk awk echo export
+	then echo test done x=1 -eu && $(pwd) -eu -eu 2>/dev/null "$1" readonly echo
+		echo "$@" 'quoted text' readonly 'quoted text' && local
+${HOME} x=1 /usr/bin 2>/dev/null readonly export "$1" sed local done 'quoted text'
+		&& 2>/dev/null then local local && -eu "$1" "$@"
+	echo local | -eu | test "$1" 'quoted text'
+		x=1 test test grep "$1" local sed done && | test && awk local x=1 cd x=1 && grep
+then test printf sed 'quoted text'
+cd awk printf --verbose printf 2>/dev/null
+$(pwd) x=1 'quoted text' local readonly awk then local && done
+&& 2>/dev/null --verbose "$@" 2>/dev/null
+	then readonly local cd | printf then test export "$@" grep done
+		grep test "$1" ${HOME} "$1" local test local done test printf /usr/bin
+grep 'quoted text' then cd test
+		--verbose ${HOME} "$1"
+		readonly done x=1 printf then && && 'quoted text'
+		then readonly 'quoted text' $(pwd) export readonly echo "$@" then awk ${HOME}
+		echo test printf && cd test export echo /usr/bin test done sed --verbose
+		cd echo test export 2>/dev/null printf &&
+export && done local -eu
+		'quoted text' $(pwd) cd grep local -eu done /usr/bin awk
+sed printf 2>/dev/null test -eu $(pwd)
+	grep "$@" $(pwd) x=1 -eu done then readonly "$1" ${HOME} then /usr/bin
+		--verbose test export printf readonly
+		readonly /usr/bin local --verbose done test --verbose
+	readonly echo local --verbose
+-eu grep x=1 && readonly | 2>/dev/null ${HOME} && local awk
+		cd | export | | printf 2>/dev/null
+		echo /usr/bin then sed && && --verbose grep | --verbose
+	"$@" && -eu sed | | readonly export 'quoted text' done awk
+	awk | 'quoted text' echo 2>/dev/null | done x=1 ${HOME} -eu && ${HOME} x=1 awk
+		then --verbose -eu then -eu local then $(pwd) -eu done && then x=1
+		-eu printf /usr/bin ${HOME}
+$(pwd) export --verbose --verbose grep x=1 readonly 2>/dev/null
+	-eu ${HOME} local done /usr/bin
+awk | readonly export test echo then echo awk x=1 2>/dev/null awk 'quoted text'
+	&& 'quoted text' && done 2>/dev/null local
+		2>/dev/null awk ${HOME} grep cd -eu /usr/bin $(pwd) --verbose export
+	| export awk export readonly printf ${HOME} test /usr/bin -eu
+	readonly echo -eu x=1 grep done export printf x=1
+		then readonly /usr/bin 'quoted text' ${HOME} -eu $(pwd) && grep test sed
+2>/dev/null $(pwd) sed
+	--verbose ${HOME} readonly /usr/bin cd
+		readonly | then then local awk 2>/dev/null done x=1 ${HOME} readonly
+2>/dev/null export "$@" test
+	done /usr/bin printf --verbose
+	echo x=1 echo 'quoted text' grep done ${HOME}
+	grep test ${HOME} -eu --verbose --verbose "$@" /usr/bin
+		export local cd "$@" |
+		sed sed "$@" 2>/dev/null 'quoted text' "$@" cd "$1" then "$@" && awk
+		| then awk printf "$1" export 'quoted text' sed 2>/dev/null test then 'quoted text'
+local printf done echo export sed test printf local awk sed "$@" grep
+		$(pwd) ${HOME} grep ${HOME} 2>/dev/null export awk 'quoted text'
+x=1 -eu 2>/dev/null sed then $(pwd)
+local 'quoted text' done done
+--verbose x=1 awk grep 'quoted text' test $(pwd) done printf printf
+	echo local /usr/bin printf /usr/bin done export cd | $(pwd) local
+		${HOME} local local 'quoted text'
+	&& awk readonly cd sed "$@" 'quoted text' awk test 2>/dev/null
+		test awk sed grep echo ${HOME}
+	${HOME} export done /usr/bin cd cd --verbose
+readonly -eu --verbose | grep local sed $(pwd) local ${HOME} "$1" --verbose
+--verbose sed x=1 "$1"
+		&& -eu | --verbose "$1"
+	then ${HOME} 'quoted text' 2>/dev/null
+test cd readonly readonly -eu "$@" /usr/bin
+		readonly ${HOME} "$1" sed
+		printf printf awk export grep echo x=1 "$1" cd awk
+	sed && then "$1" -eu --verbose ${HOME} && "$1" awk
+		printf done && cd printf && awk /usr/bin
+		/usr/bin | local test grep test export 'quoted text' readonly | grep
+	echo 2>/dev/null local --verbose printf local x=1 | printf export "$@"
+	done then done "$@" && "$1" -eu then --verbose done
+grep readonly "$@" && sed export -eu --verbose
+	cd test export x=1 then $(pwd) awk "$@" grep 2>/dev/null /usr/bin export
+		done test grep /usr/bin | --verbose --verbose $(pwd) "$@" ${HOME} $(pwd) echo 'quoted text'
+	2>/dev/null then | cd echo x=1
+		${HOME} "$1" 2>/dev/null |
+	x=1 | -eu "$@" $(pwd)
+		local 2>/dev/null echo $(pwd) "$@" && | cd 2>/dev/null
+	${HOME} export --verbose done | done printf readonly
+		local export then 'quoted text' then ${HOME} && x=1
+	sed export $(pwd) $(pwd) | awk 'quoted text' sed 2>/dev/null
+		"$@" export cd 2>/dev/null --verbose --verbose
+		x=1 done /usr/bin local --verbose echo sed 'quoted text' 'quoted text' readonly
+	| cd $(pwd) 2>/dev/null "$1"
+grep x=1 echo local then -eu echo $(pwd) "$@" ${HOME} 'quoted text'
+then printf grep --verbose && export done $(pwd) "$1"
+$(pwd) cd local && printf x=1 'quoted text'
+export local /usr/bin x=1 ${HOME} -eu awk && /usr/bin printf
+		&& grep done "$1" export | --verbose awk awk then 2>/dev/null
+	printf $(pwd) grep echo $(pwd) done echo then &&
+	${HOME} test echo --verbose readonly local "$@"
+		'quoted text' done test --verbose
+		export done /usr/bin && "$@" x=1 printf then && sed -eu readonly awk | done
+	test done export "$1" export
+		grep "$1" ${HOME} 'quoted text' printf
+		cd local $(pwd) "$1" echo done echo done export done
+		x=1 done then 2>/dev/null $(pwd) local printf cd "$@" cd -eu 'quoted text'
+	$(pwd) | "$1" export echo x=1
+		"$@" awk /usr/bin grep cd --verbose readonly cd "$@"
+		-eu local -eu test test 'quoted text' --verbose then
+sed && "$@" 2>/dev/null | x=1 cd && --verbose $(pwd) "$@"
+		2>/dev/null done sed readonly 2>/dev/null --verbose
+	"$@" && then | done | export | grep grep printf $(pwd) export export
+	grep -eu "$1" readonly 'quoted text'
+${HOME} 'quoted text' cd x=1 awk -eu grep $(pwd) "$@"
+		cd local done "$1" $(pwd) then | x=1 local $(pwd) then 'quoted text'
+	-eu echo cd local ${HOME} readonly --verbose
+		export test local && awk | -eu /usr/bin "$@" readonly $(pwd) && --verbose
+| export cd "$@" | 'quoted text' -eu | ${HOME} 2>/dev/null "$1"
+	done awk /usr/bin local x=1 local test /usr/bin awk x=1 | /usr/bin done "$1" $(pwd)
+		-eu "$@" done test then awk ${HOME} echo done cd /usr/bin test /usr/bin $(pwd)
+	$(pwd) cd sed 'quoted text' && x=1 cd grep export --verbose local
+		&& sed "$@" --verbose readonly echo -eu awk done 'quoted text' export "$@"
+		/usr/bin x=1 grep local export then readonly grep -eu local printf
+		x=1 | local readonly /usr/bin --verbose
+	--verbose test awk x=1 -eu sed done
+	${HOME} 2>/dev/null export --verbose test && $(pwd) local
+		local x=1 done "$@" cd awk -eu sed echo
+	--verbose echo "$1" awk test 'quoted text' grep test done done /usr/bin
+		'quoted text' test "$1" x=1 sed awk "$@" cd
+	-eu export x=1 sed "$@" "$1" test printf
+		2>/dev/null test "$1" 2>/dev/null --verbose
+then local cd "$@" local
+	-eu --verbose export then readonly
+	-eu printf 2>/dev/null then awk 2>/dev/null then x=1 export sed && done printf
+readonly x=1 echo x=1 local
+	awk ${HOME} "$1" $(pwd) --verbose
+test x=1 echo 'quoted text' export export
+readonly done x=1 $(pwd) local done /usr/bin done | done ${HOME} echo 2>/dev/null
+		"$1" printf 'quoted text'
+	cd cd && && | test grep 'quoted text' done | echo test echo "$@" && /usr/bin
+		export readonly test awk then cd echo readonly /usr/bin --verbose
+export "$1" printf "$@" done x=1 && "$@" "$@" /usr/bin awk export
+-eu test done sed done && --verbose $(pwd) && $(pwd)
+		test | -eu -eu grep local --verbose | "$@" "$@" test | -eu
+	x=1 done echo x=1 && sed done
+	| ${HOME} sed /usr/bin | 2>/dev/null grep "$@" $(pwd) readonly grep
+	-eu done test export && | local 'quoted text'
+export printf "$1" cd 'quoted text'
+cd "$@" ${HOME} export
+		"$1" -eu 'quoted text' awk 2>/dev/null printf /usr/bin -eu ${HOME} /usr/bin readonly
+		awk sed && grep test -eu "$1" --verbose --verbose
+		'quoted text' local "$1" | x=1 awk
+-eu --verbose -eu done cd "$1" x=1 | 2>/dev/null "$@" -eu sed x=1
+		done 'quoted text' x=1 -eu then "$1" ${HOME} done && x=1 --verbose readonly "$1"
+x=1 'quoted text' cd test local "$1" "$1" 'quoted text' export done $(pwd)
+		test 2>/dev/null 'quoted text' echo
+	then export | 2>/dev/null cd "$1" && && $(pwd) --verbose cd local && /usr/bin
+		x=1 | printf local "$1" "$1" sed
+$(pwd) --verbose "$@" local local awk sed 'quoted text'
+		/usr/bin x=1 awk local | && printf "$@"
+	cd grep grep 2>/dev/null | -eu awk printf sed "$1" x=1
+		--verbose -eu $(pwd) $(pwd) cd then "$1" --verbose awk /usr/bin
+		done "$1" test --verbose
+	test 2>/dev/null then /usr/bin grep printf sed /usr/bin -eu && then cd $(pwd)
+&& $(pwd) then echo | 2>/dev/null grep done then "$1"
+		done echo grep /usr/bin then --verbose
+		export | printf local export export readonly
+		$(pwd) $(pwd) "$@" echo -eu echo && local /usr/bin /usr/bin && x=1
+		$(pwd) then /usr/bin $(pwd) test readonly printf --verbose grep
+	-eu export then x=1 2>/dev/null
+then done x=1 export cd 2>/dev/null printf /usr/bin readonly echo
+"$@" $(pwd) | local "$1" export then /usr/bin cd echo printf readonly $(pwd)
+		export export /usr/bin local
+		&& "$@" export 'quoted text' 2>/dev/null printf printf then local -eu x=1
+		sed export awk awk | "$1" ${HOME} cd printf then awk export ${HOME} cd
+		-eu done export -eu done
+	cd readonly ${HOME} ${HOME} /usr/bin && 'quoted text' export echo x=1
+test export awk -eu done --verbose -eu readonly
+		echo && echo echo local $(pwd) | readonly "$1" 2>/dev/null awk "$1" "$1" echo
+| "$@" && echo export | echo awk --verbose readonly awk then && ${HOME} ${HOME}
+grep export $(pwd) grep && sed readonly "$@" printf awk readonly then -eu 'quoted text'
+$(pwd) /usr/bin --verbose | 2>/dev/null export && /usr/bin printf grep cd
+	&& x=1 then /usr/bin -eu $(pwd) test printf
+		2>/dev/null ${HOME} local && &&
+	test export awk ${HOME}
+	/usr/bin ${HOME} $(pwd) test 2>/dev/null -eu
+export x=1 -eu "$@" export test --verbose grep export "$@" && then readonly /usr/bin
+		| 2>/dev/null sed cd
+		awk 'quoted text' done sed test $(pwd) readonly 2>/dev/null done --verbose
+	/usr/bin export cd readonly then local
+		cd test echo ${HOME} 2>/dev/null cd "$@" sed done grep local 'quoted text' readonly
+export cd grep /usr/bin 2>/dev/null
+printf --verbose | test cd 'quoted text' cd local local cd
+	export "$@" sed test "$1"
+	sed ${HOME} test test 2>/dev/null | done "$1" ${HOME} awk awk "$1" printf local
+	grep $(pwd) export 2>/dev/null grep sed
+		export --verbose x=1 | 2>/dev/null printf x=1 cd 'quoted text' done export local
+x=1 ${HOME} cd printf ${HOME} grep -eu "$@" --verbose ${HOME} sed
+"$1" $(pwd) 'quoted text' test sed | test $(pwd) local
+grep && printf /usr/bin echo grep &&
+		-eu 2>/dev/null 2>/dev/null x=1 readonly x=1 readonly echo local
+cd echo ${HOME} readonly grep sed then then echo awk
+		cd 2>/dev/null printf 2>/dev/null grep printf 2>/dev/null awk "$1" 2>/dev/null
+		readonly printf cd 'quoted text' ${HOME}
+'quoted text' printf done sed done -eu && x=1 'quoted text'
+	| readonly echo 2>/dev/null 2>/dev/null done test 'quoted text' readonly done "$1"
+	grep x=1 grep | -eu | $(pwd)
+		x=1 $(pwd) cd readonly grep
+&& awk /usr/bin printf x=1 $(pwd)
+awk echo "$1" "$@" && awk |
+&& ${HOME} "$@" "$1" "$@" /usr/bin done export "$1"
+	sed /usr/bin test && 'quoted text' x=1
+	$(pwd) $(pwd) 'quoted text'
+cd -eu x=1 test local "$@"
+		$(pwd) /usr/bin 2>/dev/null export && ${HOME} readonly printf awk awk 'quoted text'
+	2>/dev/null /usr/bin test sed test sed $(pwd)
+${HOME} ${HOME} printf grep
+-eu echo printf printf --verbose local 'quoted text'
+	/usr/bin "$@" -eu "$1" then readonly $(pwd) then awk
+/usr/bin readonly sed 2>/dev/null ${HOME} done export "$@" $(pwd)
+	then local readonly "$1" sed export 2>/dev/null grep then test 2>/dev/null
+	&& readonly | --verbose -eu done "$@" ${HOME}
+	printf 'quoted text' /usr/bin "$1"
+		'quoted text' awk --verbose
+	${HOME} /usr/bin readonly /usr/bin $(pwd)
+$(pwd) local "$1" test /usr/bin && export 'quoted text'
+"$@" $(pwd) ${HOME} local then readonly test | && && --verbose
+		"$1" -eu done then "$@" $(pwd) local "$@" grep cd cd
+		$(pwd) grep ${HOME} export export awk --verbose /usr/bin $(pwd) x=1 'quoted text'
+		awk awk x=1 x=1 $(pwd) | cd
+		readonly sed echo export /usr/bin "$@" grep then readonly 'quoted text'
+	then ${HOME} awk "$1" ${HOME}
+-eu ${HOME} printf cd then ${HOME} test ${HOME} printf local test echo grep echo
+export 'quoted text' 2>/dev/null /usr/bin && test -eu "$@"
+	x=1 --verbose -eu cd echo -eu -eu cd export x=1 then then printf done x=1 --verbose
+then -eu grep readonly -eu -eu echo sed /usr/bin "$@" -eu "$1" "$1"
+export -eu local ${HOME} export
+awk then export --verbose grep local readonly printf test /usr/bin sed | echo
+		| grep ${HOME} echo export test | && | --verbose
+$(pwd) then --verbose "$@" then cd then echo
+	/usr/bin then x=1 x=1 local | "$@"
+	$(pwd) grep cd echo test sed --verbose 'quoted text'
+	/usr/bin printf export awk --verbose printf export "$@" awk 2>/dev/null export ${HOME}
+		$(pwd) --verbose --verbose readonly "$@" export ${HOME} test -eu local
+		"$1" "$@" ${HOME} then grep $(pwd) grep 'quoted text' local sed
+		$(pwd) test printf -eu done echo done awk local awk --verbose printf export
+		done --verbose ${HOME} ${HOME} "$@" | x=1 cd 2>/dev/null && ${HOME}
+${HOME} $(pwd) done cd grep test $(pwd) test $(pwd) done && export
+		done ${HOME} -eu /usr/bin local done printf /usr/bin then
+		then 2>/dev/null "$@" --verbose ${HOME}
+-eu done then ${HOME} -eu export sed test /usr/bin x=1 awk done /usr/bin
+	printf echo then && 2>/dev/null export 2>/dev/null | x=1 -eu 2>/dev/null 'quoted text'
+/usr/bin 'quoted text' awk 'quoted text' export 'quoted text' cd 'quoted text'
+	| /usr/bin local /usr/bin ${HOME} export /usr/bin
+		$(pwd) grep "$1" done cd echo local && --verbose
+	export cd done test x=1 /usr/bin awk
+${HOME} printf grep echo
+		/usr/bin local "$@" | cd readonly
+echo x=1 test echo x=1 test ${HOME} 'quoted text' --verbose
+		cd x=1 "$@" done $(pwd) export grep $(pwd) echo
+	"$1" --verbose x=1 "$1" done 'quoted text'
+done awk ${HOME} printf /usr/bin
+	local -eu ${HOME} readonly /usr/bin test |
+		${HOME} ${HOME} echo "$@" -eu local --verbose x=1 | sed then
+--verbose 'quoted text' -eu $(pwd) echo done $(pwd) 2>/dev/null export "$@"
+test ${HOME} 'quoted text'
+${HOME} sed ${HOME} readonly sed | awk ${HOME} echo
+echo done export "$@" done printf
+		grep 'quoted text' "$@" readonly 'quoted text' readonly
+	/usr/bin /usr/bin printf cd test 2>/dev/null
+	2>/dev/null 2>/dev/null | done && "$1" readonly "$1" local
+		test awk awk $(pwd) awk
+/usr/bin x=1 awk local test "$1" $(pwd) local export
+x=1 | "$1" printf printf done then && $(pwd)
+x=1 -eu cd "$1" 2>/dev/null x=1 local x=1 'quoted text'
+		'quoted text' grep 2>/dev/null test
+	$(pwd) test then x=1 && then sed readonly done test | done --verbose printf
+	/usr/bin x=1 -eu "$@" grep && export "$1" 2>/dev/null cd then
+	sed export 2>/dev/null 2>/dev/null echo 'quoted text' local then local
+		2>/dev/null local "$@" -eu local x=1 --verbose --verbose
+printf local /usr/bin | "$@" echo
+"$@" "$@" grep ${HOME} local /usr/bin -eu ${HOME} /usr/bin
+		"$1" $(pwd) test ${HOME} "$@" grep "$1" -eu ${HOME} cd 'quoted text'
+	${HOME} echo done --verbose $(pwd)
+		-eu "$@" sed cd awk 'quoted text' then cd
+		test printf export --verbose /usr/bin sed local $(pwd) --verbose awk test
+"$1" "$1" sed awk 'quoted text' grep ${HOME} -eu
+	'quoted text' awk then
+		local cd then $(pwd) readonly -eu ${HOME} | --verbose x=1 x=1 echo grep printf
+		done local -eu -eu $(pwd) 'quoted text' printf then 2>/dev/null $(pwd) "$1" -eu
+		sed grep && test sed sed readonly -eu "$@"
+	"$@" $(pwd) 'quoted text' /usr/bin --verbose
+		2>/dev/null $(pwd) 'quoted text'
+	echo awk grep | local export local grep 'quoted text' local printf
+'quoted text' grep readonly
+-eu awk then "$1" test 2>/dev/null ${HOME} echo printf x=1 x=1
+		echo local done "$@" done $(pwd) "$1" x=1 then cd test $(pwd) -eu test
+awk then local "$@" local x=1 awk "$1" $(pwd) ${HOME}
+		--verbose done x=1 && $(pwd) then grep local then ${HOME} then
+	${HOME} readonly | local sed 2>/dev/null "$@" grep readonly -eu -eu cd test
+	--verbose 2>/dev/null 'quoted text' awk sed "$@" $(pwd) "$1" ${HOME}
+		| readonly "$1" $(pwd) "$@" echo test then | 'quoted text' printf &&
+2>/dev/null 2>/dev/null test echo sed x=1 done awk "$1" -eu && "$@" done test export
+	'quoted text' | then -eu $(pwd) done 'quoted text' grep sed awk $(pwd) then ${HOME}
+	/usr/bin 'quoted text' sed echo 'quoted text' && echo echo printf /usr/bin readonly
+x=1 echo -eu "$1" 2>/dev/null "$1" cd done readonly
+done export echo 'quoted text' test test "$1" ${HOME} 2>/dev/null done -eu ${HOME}
+-eu readonly grep grep grep awk x=1 /usr/bin echo $(pwd) | grep "$1" awk
+		awk "$@" done cd /usr/bin done x=1 2>/dev/null $(pwd)
+	readonly cd /usr/bin && echo --verbose --verbose "$1"
+	grep cd x=1 /usr/bin x=1 'quoted text' readonly -eu then export
+		grep local printf echo /usr/bin x=1 echo echo awk cd "$@" echo && "$@" $(pwd)
+"$@" done awk x=1 "$@" x=1 export -eu grep && $(pwd)
+	x=1 awk echo export awk "$1" printf echo "$1" local /usr/bin $(pwd)
+	readonly test && sed echo cd -eu printf local
+	then then cd awk $(pwd) echo test done 'quoted text' --verbose done sed "$@"
+	export "$@" x=1 awk export "$@"
+	sed /usr/bin "$@" echo printf
+	done "$1" $(pwd) test --verbose echo | echo local cd cd ${HOME} grep --verbose
+		test readonly "$@" && printf x=1 "$@" awk awk grep done readonly
+	done sed printf awk && then export $(pwd)
+		--verbose local && "$1" grep readonly $(pwd) then sed
+		"$1" cd sed "$1" export -eu | cd $(pwd) && x=1 readonly 2>/dev/null -eu
+awk "$1" echo readonly "$1"
+	done test grep "$@" ${HOME}
+		-eu x=1 cd printf -eu local
+	local "$@" && local 2>/dev/null grep awk cd awk readonly awk local
+	| test x=1 grep cd done --verbose "$@" "$@" export export done x=1 2>/dev/null
+done cd done sed $(pwd) readonly
+export /usr/bin test -eu ${HOME} sed | test /usr/bin -eu awk
+	2>/dev/null export x=1 -eu
+		${HOME} export awk grep local readonly
+export readonly grep readonly && printf readonly echo
+printf -eu | "$1" printf 2>/dev/null
+	'quoted text' && local $(pwd) x=1 'quoted text' awk
+	${HOME} 'quoted text' done $(pwd) ${HOME} readonly $(pwd) "$1" echo -eu
+2>/dev/null local test echo
+		awk cd x=1 | grep 2>/dev/null readonly
+printf echo -eu -eu done 2>/dev/null done export
+	export $(pwd) ${HOME} cd export x=1 awk -eu --verbose $(pwd)
+	2>/dev/null echo 'quoted text' "$@"
+	export 2>/dev/null readonly --verbose 'quoted text'
+awk local 2>/dev/null 2>/dev/null 2>/dev/null
+		readonly $(pwd) readonly done x=1 export -eu then x=1 /usr/bin 2>/dev/null
+test echo 2>/dev/null awk awk -eu printf awk grep export && awk ${HOME} sed ${HOME}
+	local x=1 test done cd ${HOME} 2>/dev/null grep 'quoted text'
+echo grep grep /usr/bin 2>/dev/null local | 2>/dev/null echo --verbose cd done grep
+		'quoted text' /usr/bin test cd cd then x=1 x=1 | local "$1" 'quoted text'
+		grep | grep 2>/dev/null test sed -eu readonly
+	"$@" "$@" printf grep
+		| --verbose export readonly readonly | awk 'quoted text'
+	2>/dev/null 2>/dev/null 2>/dev/null printf
+"$@" ${HOME} grep -eu local echo grep cd ${HOME} "$@" "$@" grep
+sed awk ${HOME} && readonly --verbose local sed && /usr/bin awk printf done
+export local "$@" 2>/dev/null cd "$1"
+	printf x=1 echo sed export && 2>/dev/null
+	${HOME} echo local then
+		--verbose "$@" export x=1 'quoted text' && --verbose --verbose
+		/usr/bin export 2>/dev/null "$@" test grep test
+		"$1" $(pwd) cd awk ${HOME} x=1 export -eu printf 'quoted text'
+	done sed readonly awk awk test readonly done $(pwd)
+sed /usr/bin local done $(pwd) done awk awk "$@" x=1 && -eu grep
+		"$@" then 'quoted text' /usr/bin && then printf test -eu echo awk /usr/bin
+		--verbose x=1 | readonly sed 'quoted text' 'quoted text'
+		export -eu x=1 cd ${HOME} echo x=1 echo x=1 grep then
+		grep awk x=1 sed export --verbose done "$1" -eu x=1 'quoted text' awk -eu
+		2>/dev/null local ${HOME} 2>/dev/null x=1
+&& ${HOME} /usr/bin -eu -eu sed /usr/bin 'quoted text'
+	sed && "$@" awk grep awk ${HOME} "$@" --verbose
+		then | 'quoted text' $(pwd) | --verbose $(pwd) local grep
+		2>/dev/null x=1 'quoted text' ${HOME}
+"$@" grep x=1 -eu test done && /usr/bin
+2>/dev/null /usr/bin awk --verbose cd grep local /usr/bin then grep x=1 'quoted text'
+		x=1 export "$1" cd 2>/dev/null export local
+	"$1" then "$@" "$@" 'quoted text' ${HOME} && test awk printf
+		x=1 --verbose && "$1" awk printf grep 'quoted text'
+		cd x=1 --verbose x=1 -eu | x=1 cd awk x=1 export --verbose
+		cd "$@" awk /usr/bin local test && $(pwd)
+		'quoted text' $(pwd) cd
+&& 2>/dev/null "$@" readonly grep test
+"$@" done awk | done cd --verbose
+		--verbose x=1 /usr/bin done
+$(pwd) --verbose done && sed then local readonly
+	'quoted text' | --verbose local -eu --verbose -eu --verbose sed ${HOME}
+awk "$1" | "$1" readonly awk x=1 ${HOME} &&
+		local "$1" --verbose $(pwd) sed grep x=1 | done awk && $(pwd) /usr/bin
+		/usr/bin printf local ${HOME} cd cd /usr/bin test 2>/dev/null
+	$(pwd) awk test done then "$@" done printf x=1 test done "$@" sed "$@" "$1" --verbose
+sed local x=1 -eu x=1 cd export
+--verbose sed done -eu ${HOME} then && then local $(pwd)
+	&& 2>/dev/null printf printf readonly
+x=1 local /usr/bin $(pwd)
+$(pwd) awk cd test | export
+		"$@" done awk "$1" cd | readonly ${HOME}
+${HOME} export $(pwd) echo ${HOME} "$@" "$@" /usr/bin
+		sed readonly echo --verbose x=1 "$1" echo
+		done local -eu readonly grep 2>/dev/null echo $(pwd)
+	then grep then cd printf -eu && echo
+		-eu test cd /usr/bin "$1" done test x=1 export then export /usr/bin then 2>/dev/null
+done 'quoted text' "$1" grep $(pwd) /usr/bin cd $(pwd) sed cd test grep
+x=1 | printf printf | readonly printf 2>/dev/null cd "$@" "$@" ${HOME} test --verbose
+	"$@" /usr/bin local echo sed export awk -eu
+done export 2>/dev/null && sed done /usr/bin cd -eu export
+	done "$@" awk grep printf echo printf
+		| 'quoted text' grep "$1" | "$1" /usr/bin
+		'quoted text' printf grep readonly
+	awk cd awk export echo grep 'quoted text' done done export printf "$@" cd ${HOME}
+2>/dev/null $(pwd) 2>/dev/null /usr/bin then ${HOME}
+		${HOME} /usr/bin test cd | awk ${HOME}
+	| "$@" awk cd cd x=1 sed grep
+x=1 local cd "$1" /usr/bin
+done then grep grep cd readonly echo local
+	local test done then printf
+	${HOME} test grep echo grep grep --verbose local export sed then
+	x=1 && local echo --verbose export "$1"
+		x=1 export 2>/dev/null export
+"$@" "$1" printf && export printf ${HOME} 2>/dev/null
+"$1" printf -eu done grep && "$@" $(pwd) export printf grep 2>/dev/null x=1
+/usr/bin && | awk | && export local echo "$@"
+	grep && 2>/dev/null sed "$@" 2>/dev/null cd then -eu | readonly then
+		then sed | local $(pwd) test then $(pwd) ${HOME}
+'quoted text' grep local
+${HOME} x=1 | readonly "$1" echo --verbose /usr/bin ${HOME}
+awk local local --verbose ${HOME} export && test --verbose 'quoted text'
+	x=1 awk -eu && && "$1" local $(pwd) /usr/bin test 'quoted text' 'quoted text'
+	test --verbose ${HOME} grep sed sed done
+		done | sed $(pwd) ${HOME} cd "$@" -eu "$1"
+		readonly $(pwd) local && local 2>/dev/null | local cd --verbose | $(pwd) local
+"$1" 2>/dev/null cd sed -eu ${HOME} awk | readonly export x=1
+	"$1" local done done printf export awk --verbose echo "$1" "$@" cd export
+		then 'quoted text' /usr/bin test 'quoted text'
+	-eu "$@" "$@" --verbose
+then echo export printf export ${HOME} --verbose
+		"$@" /usr/bin $(pwd) 2>/dev/null local x=1
+	test then done && ${HOME} -eu done
+		echo 'quoted text' 'quoted text' export sed readonly "$1"
+grep echo echo | x=1 'quoted text'
+		echo 2>/dev/null 2>/dev/null export readonly 2>/dev/null export
+test 2>/dev/null -eu --verbose echo x=1 grep local x=1 readonly
+then test -eu then cd ${HOME}
+	--verbose "$@" printf echo &&
+		&& local then sed "$@" export "$@" && "$1" | --verbose printf
+	-eu then readonly then "$@" test awk x=1 "$1" grep then && -eu grep
+cd test && then test cd sed x=1 local "$@" $(pwd) ${HOME} $(pwd) echo
+	sed export $(pwd) && ${HOME} echo x=1 $(pwd) test -eu
+		cd done --verbose /usr/bin ${HOME} grep echo --verbose $(pwd) --verbose
+	2>/dev/null grep then export 'quoted text' "$1" && awk
+grep export --verbose sed local
+| cd x=1 sed --verbose readonly | printf printf test 'quoted text'
+/usr/bin "$@" $(pwd) export printf "$@" test "$1" && 2>/dev/null
+	echo 2>/dev/null $(pwd) then /usr/bin
+test readonly 2>/dev/null
+		-eu awk echo readonly export x=1 "$1" readonly --verbose
+awk "$@" && echo && done
+$(pwd) /usr/bin $(pwd) printf "$@" grep then
+	&& readonly | awk -eu printf echo grep printf
+	sed | echo | "$@" then 2>/dev/null
+	done then && awk "$@" ${HOME} x=1 awk printf --verbose x=1 readonly
+	${HOME} $(pwd) -eu 'quoted text' readonly export && grep $(pwd)
+	--verbose export ${HOME} export $(pwd) 2>/dev/null ${HOME} &&
+		--verbose -eu local grep cd echo ${HOME}
+		${HOME} 2>/dev/null --verbose ${HOME} "$1" $(pwd) then test awk
+	/usr/bin 2>/dev/null && export sed && awk "$1" "$1" export export
+		'quoted text' 2>/dev/null printf grep -eu sed --verbose
+		awk local sed ${HOME} grep grep grep $(pwd) "$1" 'quoted text' ${HOME} done
+		--verbose cd cd $(pwd) echo "$@" test sed awk done printf
+test $(pwd) then printf cd cd /usr/bin --verbose done 2>/dev/null
+	${HOME} 2>/dev/null x=1 awk | ${HOME} && sed /usr/bin grep
+		--verbose done echo sed
+		--verbose echo ${HOME}
+		local --verbose $(pwd) readonly
+		sed -eu && $(pwd) test -eu awk "$@" 'quoted text' -eu export grep done
+test cd cd awk 'quoted text' 2>/dev/null cd "$@" "$@" test --verbose
+		echo && local sed ${HOME} awk printf awk test local x=1 sed grep | ${HOME}
+	2>/dev/null grep x=1 | "$1" readonly export
+	x=1 cd -eu sed | "$1" cd grep $(pwd) /usr/bin local /usr/bin
+		then sed x=1 readonly ${HOME} /usr/bin
+	x=1 2>/dev/null && awk awk awk then echo test &&
+printf 2>/dev/null done | export /usr/bin awk && 'quoted text' test
+	/usr/bin cd && 'quoted text' grep 2>/dev/null $(pwd) sed 'quoted text'
+	then echo then awk then then readonly
+sed awk | x=1 echo cd --verbose -eu -eu 'quoted text' awk then
+	then x=1 echo -eu $(pwd) "$@" -eu readonly
+		-eu /usr/bin done && sed awk printf printf cd printf export x=1 | 'quoted text'
+x=1 ${HOME} 'quoted text' | local $(pwd)
+		test cd done 2>/dev/null sed then local 'quoted text' ${HOME} echo --verbose
+	then echo -eu /usr/bin "$@" local test then test "$1" "$@" 'quoted text'
+printf --verbose grep local echo
+		done | readonly grep echo
+		grep grep -eu /usr/bin done /usr/bin done readonly -eu "$@" awk sed cd
+	"$1" ${HOME} echo ${HOME} -eu local
+--verbose awk printf local /usr/bin 'quoted text'
+	--verbose 'quoted text'
+	-eu grep awk && export ${HOME} sed --verbose cd done --verbose
+awk readonly --verbose && readonly "$1" cd x=1 echo
+		readonly readonly --verbose export x=1 /usr/bin
+	"$1" awk -eu "$1" sed awk local export "$@" x=1 printf grep echo grep test
+	$(pwd) x=1 awk awk printf echo printf -eu echo
+		x=1 then sed test x=1 | /usr/bin && sed echo 2>/dev/null
+		export cd "$@" local then grep cd printf &&
+	done "$1" awk "$1" "$@" x=1 x=1 test "$@" ${HOME} | x=1 --verbose test grep echo
+2>/dev/null readonly "$@" $(pwd) 2>/dev/null
+	${HOME} then awk --verbose then awk grep $(pwd)
+	sed "$1" | && /usr/bin echo sed cd sed 'quoted text' "$@" $(pwd) "$@" readonly
+		-eu sed grep --verbose "$1"
+	"$1" printf 'quoted text' "$@" -eu /usr/bin grep "$1" echo
+	-eu test /usr/bin echo cd cd && test then ${HOME} -eu echo grep readonly
+	'quoted text' grep then awk echo --verbose | printf echo 2>/dev/null then "$@"
+&& readonly test local /usr/bin printf /usr/bin printf cd done printf test export
+		${HOME} echo then sed grep
+then "$@" done export
+"$1" && test printf 'quoted text'
+		$(pwd) x=1 test done local -eu sed /usr/bin
+	done grep grep printf test cd /usr/bin grep done "$@" readonly awk "$1"
+		&& readonly -eu printf awk
+"$@" ${HOME} grep grep --verbose
+	"$@" && -eu -eu printf /usr/bin awk local 2>/dev/null $(pwd)
+readonly awk cd readonly local grep export local local readonly
+	/usr/bin grep cd x=1 /usr/bin x=1 -eu 2>/dev/null test then sed local test done
+		echo -eu readonly 2>/dev/null grep 2>/dev/null 'quoted text' ${HOME} -eu
+awk ${HOME} $(pwd) ${HOME} --verbose | cd "$1"
+	test done cd 2>/dev/null readonly | /usr/bin "$1" readonly printf done
+		--verbose sed 2>/dev/null export /usr/bin | printf
+		grep echo grep "$1" && $(pwd) sed --verbose
+		'quoted text' /usr/bin /usr/bin awk awk awk awk x=1 then 2>/dev/null test
+	readonly then "$@" ${HOME} --verbose grep
+local done 'quoted text' /usr/bin grep /usr/bin
+	--verbose ${HOME} then then printf | done
+		readonly awk local echo 2>/dev/null "$1" cd "$@" then sed 'quoted text'
+	-eu "$@" 'quoted text' grep local printf
+'quoted text' then --verbose awk x=1 x=1 awk done cd 'quoted text' x=1 then done
+"$1" /usr/bin "$@" 2>/dev/null sed 2>/dev/null
+	"$1" local then --verbose x=1 then | /usr/bin "$@"
+readonly /usr/bin "$1" && grep /usr/bin local printf 'quoted text'
+"$1" -eu awk --verbose --verbose /usr/bin local 'quoted text'
+/usr/bin grep x=1 sed $(pwd) /usr/bin "$@" --verbose cd "$@"
+local && 2>/dev/null then test then 'quoted text' 2>/dev/null
+then readonly /usr/bin export done --verbose
+		cd "$1" 'quoted text' local export && local export && | sed
+		/usr/bin -eu readonly export awk export test printf awk sed --verbose readonly
+echo awk && awk "$1" && && export export -eu ${HOME} awk awk 'quoted text'
+		printf done && -eu then printf 2>/dev/null /usr/bin
+	${HOME} /usr/bin && --verbose
+done "$@" test --verbose cd --verbose 2>/dev/null 2>/dev/null 'quoted text' 2>/dev/null
+then printf && sed readonly && && done x=1 "$@" then 'quoted text'
+| 'quoted text' "$1" /usr/bin grep $(pwd) "$@" then
+	-eu then 'quoted text' done printf 2>/dev/null
+grep && "$1" grep --verbose
+		'quoted text' && 'quoted text' "$1" test -eu local echo echo printf $(pwd)
+	| "$@" export export "$@" local /usr/bin printf cd sed cd /usr/bin echo --verbose
+"$@" local test local | echo -eu ${HOME} cd grep done ${HOME} sed done
+		--verbose "$1" 'quoted text' cd export printf grep awk && export
+x=1 printf | echo "$@" "$1" done sed awk -eu x=1 | local x=1 printf
+	&& /usr/bin then test
+		printf grep ${HOME} x=1 done readonly x=1 then $(pwd)
+	readonly $(pwd) export "$@" && test then "$1" cd "$1" | &&
+		"$1" --verbose 'quoted text' cd -eu done && done --verbose 'quoted text'
+	${HOME} readonly printf test then
+export readonly cd export x=1 /usr/bin done $(pwd) then grep
+	/usr/bin local | ${HOME} sed export | awk && ${HOME} grep test
+	${HOME} sed readonly echo "$@"
+		"$@" -eu && 2>/dev/null x=1 sed -eu
+		2>/dev/null sed local grep $(pwd) done
+x=1 "$1" "$1" awk -eu ${HOME}
+	test awk x=1 done grep readonly sed
+-eu "$@" test test $(pwd) --verbose local test cd $(pwd) 2>/dev/null --verbose
+awk 'quoted text' sed -eu
+	&& cd sed x=1 --verbose export -eu readonly
+		$(pwd) echo echo test readonly "$1"
+/usr/bin -eu "$1" 2>/dev/null "$1" && -eu printf grep --verbose
+	grep | echo awk 2>/dev/null "$@" 2>/dev/null && test awk export local
+${HOME} echo printf cd sed awk 'quoted text' 2>/dev/null
+cd sed export local /usr/bin
+	&& -eu "$1" x=1 "$@" "$@" readonly "$1" sed done 2>/dev/null echo sed ${HOME}
+		local echo $(pwd) done then then 'quoted text'
+	done | && done done 'quoted text' | then $(pwd) export 2>/dev/null -eu done
+	sed then printf test test --verbose | grep
+--verbose && -eu 'quoted text' && sed 2>/dev/null done
+		"$@" awk done echo local | --verbose sed /usr/bin
+| export printf awk then awk awk done cd
+	-eu | 'quoted text' x=1 then && echo "$1"
+'quoted text' test x=1 --verbose ${HOME} readonly readonly
+	"$@" $(pwd) ${HOME} local printf -eu $(pwd) && $(pwd) --verbose
+		/usr/bin then awk --verbose && $(pwd) /usr/bin
+	"$@" export done then local x=1 -eu
+x=1 -eu done echo local echo $(pwd) && x=1 then && cd
+	cd x=1 awk printf --verbose ${HOME} grep done echo x=1
+	local test test "$@" echo done && 'quoted text' --verbose
+local 2>/dev/null local | done export grep local export
+	$(pwd) "$@" sed test "$@" export export $(pwd) then then --verbose
+	--verbose test "$1" "$@" awk echo sed echo && sed local ${HOME} "$@" echo
+	| local then printf export $(pwd) $(pwd)
+$(pwd) local test echo | sed done -eu $(pwd) --verbose readonly
+	| "$1" x=1 echo ${HOME}
+grep local --verbose -eu sed "$1" then 'quoted text' 'quoted text'
+	export "$@" local grep
+		2>/dev/null grep cd "$@" ${HOME} awk then grep x=1 ${HOME} "$1" test export 'quoted text'
+	readonly awk then $(pwd) -eu printf "$1" local then 'quoted text' printf
+--verbose -eu -eu cd grep then ${HOME} $(pwd)
+then "$1" x=1 'quoted text' -eu printf 'quoted text'
+-eu awk echo "$1" ${HOME} printf "$1" $(pwd) test awk test then
+		/usr/bin done cd --verbose ${HOME} && export then "$@" grep
+		-eu grep then local | | sed test x=1 local awk /usr/bin awk "$@" local
+		then -eu | echo sed sed printf local readonly |
+		sed export grep grep | ${HOME} "$1" x=1 sed
+	'quoted text' | "$@" --verbose
+		local && && test readonly readonly | local grep $(pwd) --verbose
+	&& ${HOME} echo echo then /usr/bin test cd
+	awk "$1" cd -eu x=1 /usr/bin | x=1 /usr/bin /usr/bin | $(pwd)
+		&& /usr/bin readonly x=1 ${HOME} echo test local ${HOME} x=1 grep local
+x=1 x=1 test done grep test echo "$1" 'quoted text' cd "$@"
+		test done --verbose "$@" local
+		echo echo cd export /usr/bin 2>/dev/null | ${HOME}
+| $(pwd) -eu x=1 sed | local cd readonly cd sed /usr/bin then readonly
+x=1 cd ${HOME} grep grep test x=1 2>/dev/null
+export done readonly export
+printf 2>/dev/null && 'quoted text'
+		/usr/bin echo export 'quoted text' awk
+	grep sed "$1" x=1 then ${HOME} x=1 printf echo cd 2>/dev/null ${HOME}
+echo echo x=1 "$@" then local printf
+		"$@" cd $(pwd) printf "$1" "$1" /usr/bin 'quoted text' done readonly printf
+local && test -eu x=1 "$1" then local then x=1 2>/dev/null
+	'quoted text' cd | sed --verbose
+	2>/dev/null x=1 cd test "$1"
+"$1" test local cd x=1 &&
+		test local sed --verbose done readonly 'quoted text' && echo then /usr/bin
+		cd | test then && then awk "$1"
+${HOME} ${HOME} readonly readonly 2>/dev/null cd grep "$@" then then printf
+		awk --verbose readonly "$@" sed printf $(pwd) export grep grep
+-eu 'quoted text' && printf
+	test readonly readonly sed "$1"
+cd done readonly cd | | "$@" printf echo test ${HOME}
+readonly test "$@" cd local
+	export test then -eu awk ${HOME} printf 2>/dev/null /usr/bin export
+/usr/bin grep ${HOME} /usr/bin "$1" cd local 2>/dev/null
+		-eu /usr/bin && awk -eu -eu $(pwd) readonly
+echo | "$1" "$1" -eu "$@" | export echo
+cd readonly printf readonly 2>/dev/null
+		2>/dev/null 2>/dev/null --verbose export 'quoted text' $(pwd) local sed local
+	x=1 $(pwd) printf 'quoted text' cd -eu 2>/dev/null readonly echo export done
+		readonly then "$1" test "$1" grep ${HOME} then x=1 "$1" "$@"
+--verbose done 2>/dev/null
+sed export then awk 'quoted text'
+grep grep printf echo "$@" 2>/dev/null
+	readonly printf echo cd
+export done $(pwd) awk then -eu $(pwd)
+		2>/dev/null printf then --verbose
+	printf ${HOME} local 'quoted text' done ${HOME} readonly | sed
+	grep readonly export $(pwd) sed ${HOME} done then "$1" x=1 export -eu sed local
+	-eu --verbose then --verbose $(pwd) export "$@" /usr/bin --verbose ${HOME} -eu
+awk sed then "$1" && echo ${HOME} test test echo printf export test
+sed 'quoted text' x=1 ${HOME}
+		awk done local "$1" | cd 2>/dev/null
+		grep "$@" /usr/bin "$1" | "$@" export
+/usr/bin then awk | readonly sed "$@" "$1" test test test | export awk readonly
+	&& 'quoted text' 'quoted text' grep --verbose
+readonly 2>/dev/null test sed ${HOME} test grep cd ${HOME} test
+		&& echo "$@" $(pwd) x=1 done /usr/bin readonly
+		$(pwd) printf readonly 2>/dev/null then ${HOME} export | 2>/dev/null
+x=1 test "$1" x=1 x=1 grep local
+	readonly echo then awk /usr/bin && cd $(pwd) x=1 'quoted text' | cd readonly
+		then "$1" 2>/dev/null then 2>/dev/null
+	&& x=1 | cd $(pwd) done --verbose
+	printf $(pwd) echo test cd "$@" local --verbose 'quoted text' sed /usr/bin
+| done x=1 $(pwd) 'quoted text' export | export then &&
+	printf /usr/bin && 'quoted text' local echo | && "$1" --verbose
+	awk export export | -eu && "$@"
+	test --verbose awk done awk sed sed done sed printf local then echo &&
+'quoted text' | 2>/dev/null
+		x=1 cd test readonly readonly grep echo --verbose
+		'quoted text' echo local cd sed "$@" | readonly ${HOME} then $(pwd) -eu local
+cd printf grep grep /usr/bin
+2>/dev/null $(pwd) printf "$1" then echo echo sed cd then --verbose
+		sed done local x=1 $(pwd) "$@" "$@" sed && cd readonly done | export awk
+echo done done 'quoted text' printf | cd 'quoted text'
+		echo "$1" ${HOME} | --verbose
+	grep then /usr/bin 2>/dev/null 'quoted text'
+		'quoted text' "$@" cd | | --verbose
+		--verbose printf awk ${HOME}
+--verbose export 2>/dev/null x=1 /usr/bin ${HOME} $(pwd) | awk awk export
+		${HOME} readonly local grep awk cd $(pwd) cd echo
+grep "$@" && "$1" cd done /usr/bin
+/usr/bin -eu grep grep readonly | x=1 'quoted text'
+		x=1 local $(pwd) $(pwd) /usr/bin grep
+	cd ${HOME} --verbose grep --verbose awk printf echo grep readonly
+| readonly local 'quoted text'
+	cd export grep x=1 printf "$1"
+	"$1" local test echo "$@" test --verbose $(pwd)
+	$(pwd) | && export local printf sed 'quoted text' local
+	echo cd "$@" echo -eu "$1" /usr/bin
+		"$1" 'quoted text' done 'quoted text' done
+awk -eu && then local sed local then printf echo done printf "$1"
+export printf ${HOME} cd echo test | readonly "$@" then grep "$@" 'quoted text'
+		done | $(pwd) readonly grep x=1 cd --verbose cd /usr/bin
+awk export printf sed "$1" --verbose
+		done readonly ${HOME} awk --verbose echo
+		export done done then sed /usr/bin && sed $(pwd)
+--verbose 'quoted text' done readonly done -eu cd "$@" 'quoted text' 'quoted text'
+x=1 2>/dev/null local ${HOME} && readonly awk done
+	sed "$@" test && readonly "$@" && export /usr/bin echo ${HOME} sed /usr/bin
+readonly export 2>/dev/null | 2>/dev/null /usr/bin ${HOME}
+		--verbose ${HOME} cd export done /usr/bin "$@" local
+	"$@" cd awk /usr/bin x=1 awk test --verbose grep done
+readonly awk "$1" $(pwd) awk
+		readonly "$1" -eu -eu x=1 done x=1 2>/dev/null
+		local ${HOME} 'quoted text' | awk -eu
+printf "$1" local then
+		2>/dev/null x=1 export sed echo | printf test test readonly
+		$(pwd) readonly --verbose && printf ${HOME} /usr/bin --verbose
+		-eu then local $(pwd) then export sed | "$@" test export /usr/bin
+		cd printf cd --verbose export
+&& readonly test test cd x=1 /usr/bin
+		grep awk then readonly then grep echo /usr/bin "$1"
+	readonly printf printf 2>/dev/null "$@"
+		'quoted text' --verbose $(pwd) 'quoted text' printf $(pwd) cd 'quoted text'
+'quoted text' 2>/dev/null 'quoted text' then "$1" $(pwd) test &&
+"$@" x=1 | awk 'quoted text' cd "$@" cd "$1" 'quoted text' && echo x=1 /usr/bin
+		2>/dev/null ${HOME} awk $(pwd) cd /usr/bin 2>/dev/null printf echo
+		cd printf 2>/dev/null 2>/dev/null
+x=1 "$1" "$@" local then x=1 local /usr/bin
+| grep "$1" cd test done
+	test then readonly cd export "$@" echo --verbose echo sed echo "$1" |
+test && $(pwd) sed "$@" export local printf done -eu 2>/dev/null awk 2>/dev/null
+		--verbose 'quoted text' export printf ${HOME} /usr/bin awk echo && -eu x=1
+		'quoted text' x=1 then
+		awk done $(pwd) printf && grep x=1 echo x=1
+printf then && ${HOME} readonly
+local /usr/bin "$@" echo sed /usr/bin 'quoted text'
+		'quoted text' -eu $(pwd) awk local echo $(pwd) awk grep ${HOME} test
+$(pwd) readonly then &&
+then sed ${HOME} sed printf local
+	printf local && printf awk ${HOME} /usr/bin | cd test grep local "$1" echo
+		--verbose && printf 2>/dev/null x=1 2>/dev/null
+grep 2>/dev/null cd 2>/dev/null $(pwd) awk awk test 2>/dev/null local
+		printf "$1" readonly $(pwd) sed | awk
+	done export printf local /usr/bin
+$(pwd) local export -eu then
+	printf "$1" -eu printf "$@" $(pwd) "$@"
+		cd "$1" "$@" readonly /usr/bin grep sed test ${HOME} $(pwd)
+$(pwd) x=1 sed printf $(pwd) test test cd awk $(pwd) done "$@" done 'quoted text'
+	sed -eu local cd "$1" 2>/dev/null
+	--verbose | printf then x=1 $(pwd) | readonly export | x=1 -eu
+		2>/dev/null awk awk 2>/dev/null then /usr/bin local local local -eu 2>/dev/null
+		printf ${HOME} sed test | export local
+		/usr/bin printf export | local
+| printf echo "$1" 2>/dev/null /usr/bin
+		-eu | echo /usr/bin echo 2>/dev/null sed 'quoted text'
+grep 'quoted text' ${HOME} ${HOME} export
+2>/dev/null readonly ${HOME} export awk x=1 ${HOME} | ${HOME} && ${HOME} -eu
+	then cd grep 'quoted text' grep $(pwd) sed awk 'quoted text' cd awk $(pwd)
+	printf | --verbose ${HOME} --verbose echo awk | "$@" printf awk | "$1" "$1" /usr/bin
+-eu sed awk "$@" "$@" echo && then 2>/dev/null -eu then
+local $(pwd) sed echo readonly export grep grep grep echo
+		/usr/bin "$@" grep ${HOME} then printf /usr/bin 'quoted text' cd "$1" x=1 "$@"
+done export sed -eu && && x=1
+	| sed $(pwd) ${HOME} readonly export grep test export /usr/bin && local
+	awk awk x=1 'quoted text' && grep
+		awk "$1" $(pwd) "$@" local printf
+	sed grep local 2>/dev/null done $(pwd) cd --verbose $(pwd)
+	-eu "$1" local ${HOME} "$@" local $(pwd) printf "$@" $(pwd) printf grep "$1" ${HOME}
+	x=1 test "$@" ${HOME} 'quoted text' echo local x=1 printf
+	'quoted text' sed awk $(pwd) &&
+		awk && sed "$@" "$1" export "$1" local echo
+		sed done /usr/bin awk local 2>/dev/null "$1" done readonly test readonly
+	'quoted text' && x=1 && -eu --verbose printf | 2>/dev/null &&
+"$@" then readonly 'quoted text' "$@" printf "$1" 2>/dev/null
+	local test ${HOME} grep -eu "$@" && 2>/dev/null "$@"
+awk done x=1 awk 2>/dev/null sed $(pwd) "$1" "$1"
+		echo test sed 'quoted text' $(pwd) cd 2>/dev/null "$1" grep test then printf
+| && awk then /usr/bin --verbose 2>/dev/null && | /usr/bin
+"$@" "$1" x=1 | 2>/dev/null x=1 2>/dev/null x=1 --verbose done
+grep 2>/dev/null | --verbose
+--verbose then echo ${HOME} ${HOME} echo sed 2>/dev/null printf printf then local
+	local awk ${HOME} then x=1 awk awk sed echo | "$@" /usr/bin x=1 /usr/bin
+	sed && grep x=1 "$@" 2>/dev/null done
+"$@" $(pwd) grep 2>/dev/null && export cd
+/usr/bin then 'quoted text' sed 'quoted text'
+		$(pwd) local printf readonly
+done echo local x=1 'quoted text' awk test awk $(pwd)
+printf /usr/bin cd test "$1" cd -eu printf $(pwd)
+		readonly && done awk then sed
+	readonly x=1 'quoted text' export
+		'quoted text' done grep | "$@" 'quoted text' then local test
+awk "$@" /usr/bin sed ${HOME}
+	--verbose && then printf local --verbose --verbose /usr/bin && ${HOME} cd printf
+		local /usr/bin then echo /usr/bin test done export readonly sed ${HOME} local
+		&& "$1" readonly test | readonly --verbose then then done $(pwd) then 'quoted text'
+${HOME} "$@" export 2>/dev/null cd "$@" 'quoted text'
+	then awk then --verbose 'quoted text'
+	$(pwd) --verbose x=1 export local 'quoted text' echo 'quoted text' 'quoted text'
+		${HOME} | grep printf local ${HOME} awk x=1 grep "$1" -eu
+		"$@" done x=1 readonly /usr/bin sed /usr/bin cd printf
+		awk -eu test $(pwd) "$1" -eu --verbose local
+"$@" -eu printf readonly export "$1"
+-eu --verbose ${HOME} then 'quoted text'
+	&& cd "$1" ${HOME} grep done --verbose
+	$(pwd) then printf sed
+		'quoted text' && | 'quoted text' awk printf test -eu readonly
+	export test grep "$1" awk $(pwd) printf | sed | 'quoted text' test x=1 grep &&
+	export readonly echo echo -eu then local
+		&& awk x=1 local grep local cd 'quoted text' readonly
+		-eu local 'quoted text' | x=1 /usr/bin
+	/usr/bin export sed local test ${HOME} 2>/dev/null && readonly
+then x=1 "$@" done then sed | x=1 && grep done awk --verbose test
+		${HOME} ${HOME} 'quoted text' | sed &&
+		"$@" export 2>/dev/null test x=1 | cd printf "$1" "$@" | | grep && "$1"
+		printf 'quoted text' printf local sed x=1 done ${HOME}
+	awk $(pwd) | test $(pwd) | 'quoted text'
+grep x=1 echo 2>/dev/null then
+		readonly "$1" x=1 --verbose grep then
+		readonly echo export local
+	x=1 $(pwd) 'quoted text' "$@" done awk 'quoted text' "$@" ${HOME} 2>/dev/null
+printf grep echo "$1" grep
+export local readonly "$1" printf | readonly -eu done $(pwd) done export "$@" 'quoted text'
+sed "$1" cd local --verbose "$@" printf local export /usr/bin echo 'quoted text'
+grep --verbose printf local x=1 grep awk /usr/bin done | then done export
+	/usr/bin -eu ${HOME} ${HOME} -eu grep readonly done ${HOME} --verbose
+		2>/dev/null 'quoted text' export 2>/dev/null grep readonly export -eu &&
+then ${HOME} /usr/bin test "$1"
+		echo ${HOME} $(pwd) -eu done -eu
+	--verbose --verbose grep printf local "$@" -eu --verbose awk
+echo --verbose sed x=1 $(pwd) cd -eu 'quoted text' $(pwd)
+"$1" 'quoted text' export then sed
+	/usr/bin awk ${HOME} $(pwd)
+	"$1" $(pwd) "$1" echo | local
+		2>/dev/null awk printf
+printf /usr/bin awk "$1"
+	export printf 2>/dev/null
+-eu x=1 grep echo ${HOME} sed printf printf done "$@" | readonly
+test "$@" echo sed grep ${HOME}
+	&& readonly /usr/bin &&
+-eu readonly printf && then $(pwd) readonly -eu local test export cd
+		| readonly ${HOME} -eu test | x=1 "$1" sed "$@" "$1" test grep
+	printf 2>/dev/null ${HOME} | test then local "$@" grep
+	-eu export sed "$1" local test 'quoted text' && "$@" | --verbose awk cd | echo
+	cd grep "$@" readonly 2>/dev/null x=1 export then printf export
+		local "$@" -eu test local "$1" readonly
+done done done then echo
+cd $(pwd) && "$@" 2>/dev/null
+		export /usr/bin then x=1 'quoted text' -eu sed then $(pwd) && 2>/dev/null
+		2>/dev/null ${HOME} "$1"
+		done && echo 'quoted text' && $(pwd) 2>/dev/null
+	cd local grep "$1" $(pwd) done then printf
+	done $(pwd) test --verbose
+		"$@" local export sed export awk | printf x=1 echo $(pwd) done "$1" -eu x=1 then
+		readonly printf then test -eu --verbose grep
+		/usr/bin export local done "$1" then x=1 cd printf
+	local sed echo --verbose "$@" "$@" grep
+		&& && test "$1" then grep &&
+		done /usr/bin "$@" grep --verbose
+cd $(pwd) $(pwd) test local export then 2>/dev/null 2>/dev/null test
+	$(pwd) x=1 --verbose export
+		&& | awk then | cd local export x=1 2>/dev/null x=1 | local x=1 2>/dev/null
+x=1 then local -eu awk ${HOME} | --verbose && echo --verbose awk readonly
+		awk | | ${HOME} $(pwd) done
+	--verbose && done cd ${HOME} export /usr/bin printf "$@" 'quoted text'
+grep test --verbose readonly export | grep printf
+export local /usr/bin test cd cd /usr/bin cd then "$@"
+		echo sed x=1 grep echo "$@" && x=1 "$1" --verbose echo
+readonly ${HOME} export /usr/bin
+	awk --verbose $(pwd) 2>/dev/null | /usr/bin && 'quoted text' grep "$1" local
+	&& readonly local local &&
+	printf $(pwd) cd readonly echo && readonly
+		&& then $(pwd) $(pwd) local grep
+		${HOME} | local ${HOME} --verbose cd x=1 grep | done && "$@" then
+		"$1" 2>/dev/null $(pwd)
+	grep awk sed && ${HOME} printf echo export local sed 2>/dev/null
+		awk ${HOME} --verbose then test printf grep -eu "$@" $(pwd) awk 'quoted text'
+cd then "$@" cd sed -eu ${HOME} grep test
+		test | grep "$1" sed $(pwd) 'quoted text' && export
+-eu 'quoted text' readonly "$@" echo local x=1 'quoted text' readonly then
+	/usr/bin $(pwd) "$@" test
+		sed "$@" cd --verbose x=1 && local
+cd | then | sed ${HOME} awk sed | test readonly grep export local awk
+	grep -eu then --verbose export done cd /usr/bin local "$@" --verbose | local ${HOME}
+	printf && readonly "$@" cd && ${HOME} printf printf "$@" $(pwd) sed test && "$1"
+"$1" x=1 test printf 'quoted text' ${HOME} cd printf readonly local -eu x=1
+	sed cd 'quoted text' --verbose
+cd "$@" | -eu printf "$@" 2>/dev/null printf printf ${HOME} awk awk
+--verbose cd /usr/bin echo printf --verbose
+		&& grep /usr/bin 'quoted text' done sed | x=1 --verbose printf
+test 2>/dev/null "$@"
+		grep x=1 $(pwd) local done grep 'quoted text'
+&& ${HOME} local $(pwd) export --verbose 2>/dev/null
+	"$@" ${HOME} printf | ${HOME} done sed local awk done readonly $(pwd)
+		x=1 cd then /usr/bin grep readonly
+	awk done export printf readonly "$1" | then cd ${HOME}
+		-eu export x=1 ${HOME} "$@" "$1" printf 2>/dev/null
+	sed printf echo 'quoted text' ${HOME} -eu $(pwd) ${HOME} | | x=1 echo printf
+		readonly && export awk awk -eu readonly done echo -eu
+	/usr/bin test awk sed && readonly x=1 && cd | readonly /usr/bin
+	x=1 -eu 'quoted text' sed "$1" $(pwd) | echo cd
+	$(pwd) -eu test x=1 done /usr/bin awk printf grep awk --verbose
+$(pwd) 2>/dev/null then local && sed
+	x=1 awk --verbose echo "$@" sed "$@" 'quoted text' "$1" -eu echo
+	&& echo cd -eu local grep then cd "$1" grep 2>/dev/null
+/usr/bin readonly /usr/bin export 'quoted text'
+	done 'quoted text' 2>/dev/null printf local done $(pwd) sed printf |
+	$(pwd) local test printf printf 'quoted text'
+	$(pwd) -eu /usr/bin x=1 sed test | done |
+'quoted text' local local readonly 2>/dev/null test 2>/dev/null
+		x=1 sed "$@" readonly test "$@" readonly test local
+then printf test "$@" ${HOME}
+	| 2>/dev/null cd 2>/dev/null awk -eu echo printf printf && local
+cd export && awk | printf awk | grep $(pwd) -eu then ${HOME} ${HOME} -eu
+x=1 done /usr/bin -eu export test sed done
+	'quoted text' "$1" echo && && done 2>/dev/null
+$(pwd) x=1 x=1 echo printf export sed echo done | then | 'quoted text' x=1 2>/dev/null
+printf awk $(pwd) cd $(pwd) test cd local "$@" "$@"
+		done printf then /usr/bin | sed awk "$@" local echo /usr/bin
+-eu -eu readonly "$1" printf &&
+	test "$1" && export printf /usr/bin test cd readonly
+		-eu | --verbose printf echo readonly | test export
+	then sed && grep cd ${HOME} test echo "$@" sed ${HOME}
+	| then && x=1 grep | | | && test then | printf ${HOME} x=1 "$@" -eu /usr/bin
+--verbose 'quoted text' readonly "$@"
+		/usr/bin then then && 'quoted text'
+		/usr/bin ${HOME} && | local cd "$1" grep local && sed "$1"
+export awk 2>/dev/null echo echo 'quoted text'
+	test readonly grep awk -eu readonly printf --verbose | && "$@"
+$(pwd) echo cd ${HOME} "$1" echo "$1" cd done grep | 2>/dev/null
+	"$1" sed | "$@" then sed | /usr/bin
+	&& -eu && --verbose test /usr/bin
+	echo awk cd cd -eu ${HOME} echo local 'quoted text' export echo done
+then 'quoted text' then ${HOME} | | readonly readonly
+		local /usr/bin local sed echo x=1 done "$1" echo x=1 grep /usr/bin echo sed --verbose
+		awk 'quoted text' -eu ${HOME} x=1 --verbose
+	"$1" test done awk ${HOME} sed "$@" then grep "$1"
+		$(pwd) -eu cd test awk cd && 2>/dev/null
+local "$1" "$1" 'quoted text' --verbose done echo --verbose done && awk
+	cd local export 'quoted text' export $(pwd) awk export
+	&& sed printf "$1" 'quoted text'
+export --verbose done echo sed -eu cd && "$@" "$1" -eu /usr/bin local
+		export "$@" sed --verbose $(pwd) test x=1 ${HOME} then cd awk
+cd 2>/dev/null "$@" grep
+	--verbose then awk --verbose "$@" local /usr/bin grep awk /usr/bin -eu export
+sed cd test grep readonly grep --verbose then x=1 cd then
+		/usr/bin $(pwd) && "$@" ${HOME} $(pwd) export grep "$1" echo ${HOME}
+		export 2>/dev/null done local 2>/dev/null --verbose
+--verbose $(pwd) export grep awk grep | readonly sed
+	"$1" /usr/bin "$@" test sed printf x=1 grep readonly cd -eu grep
+${HOME} "$1" local --verbose export test --verbose
+		test x=1 /usr/bin awk &&
+2>/dev/null test x=1 && awk cd 'quoted text' readonly 'quoted text'
+	/usr/bin awk sed -eu cd readonly "$@" echo export
+'quoted text' "$1" cd x=1 test sed cd awk | printf printf -eu then local --verbose
+	$(pwd) 'quoted text' && 2>/dev/null $(pwd) && then
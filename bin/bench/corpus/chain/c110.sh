@@ -0,0 +1,2001 @@
+		${HOME} then awk awk "$@" echo 2>/dev/null
+/usr/bin export test export local local | export --verbose
+sed done ${HOME} x=1 --verbose
+sed /usr/bin local cd -eu done "$@" awk
+	--verbose x=1 then export && &&
+'quoted text' 2>/dev/null "$@" | grep -eu $(pwd) echo 2>/dev/null
+		--verbose && local | readonly ${HOME} --verbose | |
+test "$@" $(pwd) sed ${HOME} export | cd test cd local x=1 then 'quoted text'
+		'quoted text' "$1" 'quoted text'
+	'quoted text' then ${HOME} local
+		export 2>/dev/null --verbose cd | done export 'quoted text'
+		export local then then /usr/bin && 'quoted text' then x=1 $(pwd) then
+		"$@" cd 2>/dev/null test export export --verbose 2>/dev/null "$1" echo
+		/usr/bin readonly done 2>/dev/null $(pwd) cd 2>/dev/null
+readonly "$@" "$@" sed export local 2>/dev/null
+echo then ${HOME} ${HOME} readonly -eu printf
+	"$1" awk local 2>/dev/null "$1"
+		readonly && then echo /usr/bin ${HOME} --verbose
+--verbose -eu ${HOME} | --verbose "$@" && sed | x=1 grep test
+sed cd "$@" -eu local export ${HOME} local
+	--verbose 'quoted text' "$1" test "$1" 'quoted text' && test then 2>/dev/null &&
+-eu done --verbose done then -eu cd awk /usr/bin --verbose
+	'quoted text' && /usr/bin cd awk export
+	readonly x=1 sed --verbose export "$@" ${HOME} x=1 then test local
+	printf then $(pwd) 2>/dev/null
+done echo "$@" 'quoted text' $(pwd) readonly
+		awk && $(pwd) cd awk export 2>/dev/null cd echo "$@"
+echo test $(pwd) | printf then then
+		then done echo $(pwd) done -eu x=1 sed cd -eu -eu 'quoted text'
+		--verbose "$@" | test test cd then $(pwd) sed sed
+		cd readonly --verbose --verbose echo awk "$1"
+x=1 export readonly | "$@" export test x=1 | /usr/bin then
+		"$@" "$@" then | 2>/dev/null x=1 grep --verbose done export ${HOME}
+	local awk $(pwd) | ${HOME} -eu 'quoted text'
+	$(pwd) then test --verbose done cd awk cd echo cd test local 'quoted text'
+		--verbose ${HOME} printf printf "$1" echo printf export
+"$1" sed "$1" --verbose test /usr/bin 2>/dev/null
+		echo echo -eu printf
+	| -eu grep 'quoted text' $(pwd) echo echo ${HOME} local done $(pwd)
+	echo printf 2>/dev/null done local test 2>/dev/null
+x=1 done then printf awk done then test readonly "$1" test $(pwd) readonly export
+		"$@" test export /usr/bin awk x=1 --verbose "$1"
+		done "$@" 'quoted text' ${HOME} 2>/dev/null sed export "$1" echo "$@"
+export test $(pwd) ${HOME} readonly
+	$(pwd) cd 2>/dev/null | readonly export
+		| /usr/bin $(pwd) 'quoted text' 2>/dev/null sed
+sed readonly 2>/dev/null test readonly "$@" && cd
+	readonly "$@" awk 2>/dev/null done && /usr/bin ${HOME} export $(pwd) then 'quoted text'
+--verbose grep cd cd echo x=1
+		2>/dev/null done cd export | 2>/dev/null printf sed export
+	printf "$1" then ${HOME} "$@" cd "$@" sed
+export awk -eu done awk then test -eu export
+'quoted text' 2>/dev/null done ${HOME} 2>/dev/null sed cd /usr/bin
+-eu then && "$1" sed $(pwd) readonly
+| | x=1 "$@" local done
+grep cd local echo awk x=1 --verbose | then -eu export "$1" ${HOME}
+	2>/dev/null local awk local
+"$1" x=1 test then grep printf readonly && ${HOME} export $(pwd) export awk
+test test 'quoted text' "$@" && "$1" printf $(pwd) x=1 "$@" "$@" test
+	'quoted text' sed sed
+		grep x=1 --verbose export readonly done
+		$(pwd) x=1 "$@" local 'quoted text' -eu cd 2>/dev/null
+-eu && ${HOME} && $(pwd) $(pwd) done local 'quoted text'
+		awk ${HOME} "$@" 'quoted text' x=1 printf "$1" readonly | test /usr/bin
+"$1" printf | local 'quoted text' 2>/dev/null
+	test local readonly $(pwd)
+$(pwd) "$@" "$@" -eu ${HOME} /usr/bin cd awk && sed -eu cd
+| --verbose sed 2>/dev/null --verbose 2>/dev/null /usr/bin
+2>/dev/null export grep "$@" readonly && echo $(pwd)
+		then ${HOME} ${HOME} then /usr/bin local then | /usr/bin x=1 && done 2>/dev/null
+		local readonly local "$@" cd && | "$@" &&
+		--verbose export test echo echo done ${HOME} 'quoted text'
+	sed $(pwd) cd x=1 'quoted text' sed awk
+	'quoted text' test then cd | && awk awk 'quoted text' then
+'quoted text' "$1" ${HOME} 2>/dev/null ${HOME} awk grep 2>/dev/null done --verbose
+		x=1 sed awk --verbose -eu | --verbose
+		readonly export readonly -eu ${HOME} printf && | ${HOME} grep then
+readonly | /usr/bin awk local && --verbose then && 2>/dev/null 2>/dev/null
+	done 2>/dev/null && then
+		cd 2>/dev/null sed | awk "$@" /usr/bin $(pwd) test 2>/dev/null
+		printf test x=1 "$@" ${HOME} export && x=1 2>/dev/null
+		then | done $(pwd) "$@" test sed echo "$1" 'quoted text' | $(pwd) export
+		test local --verbose readonly test && --verbose test x=1
+		"$1" test echo done 'quoted text'
+"$@" $(pwd) | | echo cd x=1 x=1 readonly 2>/dev/null x=1 -eu sed 'quoted text'
+2>/dev/null ${HOME} test awk --verbose readonly ${HOME} grep
+	&& ${HOME} $(pwd) "$@" x=1 echo 2>/dev/null $(pwd) 'quoted text'
+	grep export printf && 'quoted text'
+		'quoted text' done ${HOME} 2>/dev/null
+	'quoted text' 2>/dev/null printf echo "$1" "$@" sed ${HOME}
+		&& echo echo readonly $(pwd) awk sed then x=1
+x=1 local then then && done echo
+'quoted text' $(pwd) cd then printf x=1 cd --verbose printf grep
+	cd && echo readonly sed /usr/bin | -eu | readonly
+		/usr/bin readonly -eu awk
+printf $(pwd) awk readonly 'quoted text' grep $(pwd) "$@" --verbose 2>/dev/null
+	then -eu sed | 2>/dev/null "$1" grep /usr/bin 'quoted text'
+	cd 'quoted text' && echo 'quoted text' $(pwd) 'quoted text'
+	test "$1" awk done grep $(pwd)
+${HOME} cd cd echo local sed 'quoted text' | grep
+		local done readonly awk sed export "$@" grep "$@" | echo
+echo --verbose sed "$1" --verbose readonly | x=1 local 2>/dev/null
+	"$1" x=1 "$1" cd | $(pwd) x=1 sed sed "$1" &&
+sed /usr/bin awk test "$@" /usr/bin
+	done "$1" grep && grep /usr/bin ${HOME} /usr/bin
+		${HOME} 2>/dev/null cd printf
+cd grep $(pwd) sed test --verbose local ${HOME} test /usr/bin then
+		done awk cd 'quoted text' ${HOME} ${HOME} 2>/dev/null sed echo sed grep
+	${HOME} cd local cd echo && 'quoted text' | grep export -eu -eu && ${HOME} then
+		test export sed "$1" x=1 "$@" sed -eu 'quoted text' "$@"
+	cd grep export grep "$1" readonly | grep local /usr/bin $(pwd)
+	sed cd readonly $(pwd)
+	2>/dev/null 2>/dev/null done x=1 local
+--verbose 'quoted text' echo && then ${HOME} -eu "$1" --verbose -eu "$1"
+		/usr/bin grep x=1 awk $(pwd)
+then test -eu readonly echo 'quoted text' done test
+then 2>/dev/null done awk printf then cd grep grep "$1" | 'quoted text'
+	/usr/bin awk test readonly local x=1 echo then --verbose
+-eu "$@" 2>/dev/null ${HOME}
+		grep 2>/dev/null 2>/dev/null export readonly sed -eu
+	then export then -eu test
+readonly $(pwd) -eu x=1 -eu readonly local
+	--verbose readonly |
+		x=1 "$1" done -eu ${HOME} ${HOME} cd echo done --verbose readonly 2>/dev/null
+		cd -eu ${HOME} $(pwd) readonly echo ${HOME} cd | test done awk done
+	&& local awk echo && then /usr/bin export $(pwd) test grep /usr/bin grep ${HOME}
+	export && awk 2>/dev/null then readonly readonly
+		-eu 'quoted text' export $(pwd) printf | ${HOME} printf done -eu /usr/bin
+then -eu readonly cd cd "$@" ${HOME} then awk 'quoted text' grep
+		'quoted text' -eu x=1 cd
+	${HOME} x=1 2>/dev/null then "$1" --verbose readonly --verbose
+		printf ${HOME} /usr/bin grep && grep --verbose 2>/dev/null local cd readonly
+	"$@" 'quoted text' test echo export test --verbose done x=1 awk printf local
+-eu local done x=1 cd /usr/bin printf $(pwd) echo -eu sed $(pwd) grep awk
+		$(pwd) grep readonly test "$@" --verbose --verbose && printf "$1" then
+	awk /usr/bin "$@" test local done grep export local
+x=1 local --verbose -eu
+sed --verbose done readonly 2>/dev/null
+		readonly && $(pwd) printf sed cd "$1" ${HOME} 2>/dev/null awk cd &&
+	"$1" "$@" export "$1" /usr/bin awk 'quoted text' export done && sed "$@" done
+	echo cd 'quoted text' readonly "$@" grep $(pwd)
+		--verbose -eu sed 'quoted text' export test printf $(pwd) export printf awk
+-eu sed $(pwd) && 'quoted text'
+test x=1 test done echo echo test printf x=1 'quoted text' "$1" | readonly
+		'quoted text' "$@" grep cd printf | done 2>/dev/null
+		export 'quoted text' | printf $(pwd) done
+		done --verbose /usr/bin --verbose
+$(pwd) export export /usr/bin && echo grep echo
+&& 2>/dev/null ${HOME} then
+	readonly echo ${HOME} 'quoted text'
+		cd echo then printf cd done --verbose $(pwd) && echo "$1" local 'quoted text'
+	readonly $(pwd) ${HOME} 'quoted text' echo cd
+"$1" 'quoted text' done grep printf --verbose awk awk x=1 then
+	cd readonly readonly "$1" "$@" ${HOME} sed |
+		${HOME} 2>/dev/null 2>/dev/null cd 2>/dev/null sed /usr/bin -eu cd export
+		-eu test awk ${HOME} 'quoted text' echo readonly
+then local "$@" && ${HOME} "$@" "$@" export --verbose "$@" done readonly
+		2>/dev/null 2>/dev/null test | $(pwd) sed "$1"
+		printf "$1" /usr/bin 'quoted text' grep
+	"$@" sed --verbose sed && then 'quoted text' x=1 cd | grep /usr/bin done
+		2>/dev/null export test local
+cd | awk printf x=1 'quoted text' ${HOME}
+		/usr/bin x=1 export ${HOME}
+		printf test cd --verbose done export done x=1
+		| awk --verbose export echo && "$1"
+echo local local printf --verbose --verbose
+		2>/dev/null -eu | "$1"
+	-eu readonly grep readonly "$1" test | ${HOME}
+	test sed && readonly 2>/dev/null ${HOME} ${HOME} export "$@" printf
+	cd printf echo -eu awk "$1" ${HOME} 'quoted text' 'quoted text'
+&& | 'quoted text' x=1 x=1 test done printf test 2>/dev/null
+	awk $(pwd) | --verbose sed export grep cd ${HOME} then
+		export "$1" ${HOME} test done cd readonly done cd -eu ${HOME} "$1" /usr/bin
+		2>/dev/null echo -eu 'quoted text' 'quoted text'
+done export --verbose echo
+		done "$1" x=1 test $(pwd) "$@" sed echo "$@" x=1 /usr/bin -eu
+	awk echo echo --verbose then 'quoted text' cd 2>/dev/null
+echo ${HOME} | "$1" "$1" readonly echo 'quoted text' -eu "$1" local
+	test done test $(pwd) readonly test --verbose "$1" $(pwd)
+-eu printf --verbose /usr/bin "$@" awk 'quoted text'
+echo export | $(pwd) done awk "$@" --verbose x=1 ${HOME} --verbose && sed
+echo local test awk echo echo x=1 then --verbose 2>/dev/null "$1" 2>/dev/null sed
+	2>/dev/null sed -eu 2>/dev/null 2>/dev/null
+done test x=1 $(pwd) grep --verbose | && 'quoted text' echo readonly
+		grep --verbose awk grep
+		readonly "$@" printf test test awk 'quoted text' -eu /usr/bin grep -eu
+	sed sed | 'quoted text'
+	2>/dev/null /usr/bin 'quoted text' sed then | readonly test
+		$(pwd) && export && done sed readonly --verbose readonly local
+		| x=1 $(pwd) done x=1 && 'quoted text'
+		test 'quoted text' --verbose "$@" | readonly x=1
+		export local echo grep sed awk test -eu 'quoted text' $(pwd) test
+	done --verbose export && 2>/dev/null "$1" sed done grep 'quoted text'
+"$@" readonly sed | && x=1 'quoted text' awk -eu readonly
+	echo done echo ${HOME} /usr/bin x=1 $(pwd)
+export "$1" x=1 echo 2>/dev/null echo printf 'quoted text' sed 2>/dev/null "$@"
+then grep sed 'quoted text' --verbose --verbose export 2>/dev/null
+		then echo cd done local | --verbose $(pwd) "$@" && local
+	&& readonly awk done "$@" "$@" /usr/bin echo then sed
+		/usr/bin "$@" local readonly x=1 then && cd && $(pwd)
+awk awk $(pwd) x=1 then readonly 2>/dev/null test printf /usr/bin
+		sed x=1 -eu "$1" | && echo printf x=1 $(pwd) $(pwd) echo --verbose echo
+	export test $(pwd) grep $(pwd) test readonly 2>/dev/null done export 'quoted text'
+${HOME} 'quoted text' local sed then cd local sed --verbose
+	"$@" $(pwd) printf then then echo echo test sed
+		"$1" grep test grep 'quoted text' export sed awk --verbose
+-eu local 'quoted text' "$@" | printf 2>/dev/null export
+"$1" printf sed echo sed local export readonly export "$@" ${HOME} "$1" -eu printf
+awk done sed x=1 "$1" readonly
+		&& done --verbose sed test export printf export then printf x=1 /usr/bin
+export grep readonly export && grep local
+| 2>/dev/null "$@" then test -eu 'quoted text' /usr/bin
+		"$1" ${HOME} echo grep 2>/dev/null cd $(pwd) readonly $(pwd) done
+	awk | cd "$1" then x=1 "$@" | awk ${HOME} ${HOME} readonly --verbose printf cd
+		awk echo printf "$@" sed sed done readonly
+"$@" grep sed "$@" awk test export ${HOME} done $(pwd)
+export grep then local ${HOME}
+	"$1" cd $(pwd) printf x=1 awk 2>/dev/null
+		| sed /usr/bin cd "$1" test && /usr/bin
+		"$1" test sed $(pwd) 'quoted text'
+		--verbose grep local cd echo --verbose ${HOME} then 2>/dev/null
+		done grep x=1 --verbose grep -eu done "$1" printf
+		export local sed /usr/bin --verbose printf | 'quoted text'
+		"$@" readonly done printf awk "$1" grep "$1" local 'quoted text'
+$(pwd) done printf 'quoted text' grep /usr/bin
+	x=1 -eu export printf printf grep then
+		&& cd local -eu -eu x=1 cd sed export | | echo "$@" awk $(pwd)
+	printf echo | awk /usr/bin
+	-eu "$@" readonly "$1" | sed export /usr/bin $(pwd) "$1" | 2>/dev/null
+		${HOME} x=1 | printf test
+$(pwd) echo && sed local then x=1 | cd | && readonly
+		| awk awk && printf "$@"
+		$(pwd) printf done ${HOME} /usr/bin "$1" grep x=1 echo test local ${HOME}
+	$(pwd) --verbose 2>/dev/null export $(pwd) /usr/bin
+	then local 'quoted text' /usr/bin $(pwd) echo "$1" sed && export /usr/bin
+		--verbose $(pwd) test cd test local local
+		cd then then awk 2>/dev/null ${HOME} printf done echo
+	&& done grep -eu x=1 /usr/bin awk cd
+		export "$@" -eu --verbose cd then readonly /usr/bin --verbose $(pwd) done done
+		"$@" grep cd && -eu readonly grep sed
+		| export && 2>/dev/null 'quoted text' "$@" grep then sed "$1" /usr/bin awk
+		| 'quoted text' cd local done then done done /usr/bin awk x=1
+		sed export 2>/dev/null test
+export $(pwd) --verbose sed cd printf "$@" && awk grep
+	"$1" "$@" ${HOME} | /usr/bin local 'quoted text'
+		done printf -eu "$@" awk
+"$@" local --verbose "$1" 2>/dev/null -eu printf 'quoted text'
+test x=1 x=1 local 'quoted text' done done grep export
+	cd "$@" echo ${HOME} -eu 'quoted text'
+	readonly sed "$1" && x=1 | && export
+	$(pwd) -eu | local x=1 ${HOME} local cd then --verbose "$1" --verbose 'quoted text'
+		--verbose echo readonly local then echo echo x=1 local then "$1" readonly
+echo 'quoted text' "$1" local printf
+		echo grep export local $(pwd) -eu && readonly 2>/dev/null
+	awk awk then done /usr/bin "$1" awk export 2>/dev/null printf
+		awk -eu cd "$1" --verbose sed "$@"
+export x=1 "$1" awk test awk --verbose done -eu test cd x=1 grep
+&& export $(pwd) grep cd 'quoted text'
+		${HOME} && then "$1" then -eu cd /usr/bin ${HOME}
+	/usr/bin cd x=1 test -eu -eu | readonly
+		'quoted text' /usr/bin ${HOME}
+local | 2>/dev/null 'quoted text' && test echo test
+-eu then readonly "$@"
+${HOME} local /usr/bin printf $(pwd)
+	/usr/bin readonly readonly /usr/bin | && export &&
+	local sed local done test local sed test 'quoted text' echo done
+		"$1" then $(pwd) "$1" "$@" 'quoted text' export cd "$1" export
+	then "$1" local x=1 | grep export x=1
+		-eu 2>/dev/null awk $(pwd) &&
+	| 'quoted text' -eu -eu then -eu cd --verbose 'quoted text'
+	x=1 sed x=1 echo export printf | && $(pwd) local x=1 ${HOME} && $(pwd) -eu |
+	/usr/bin test echo -eu export then then 2>/dev/null x=1 grep then readonly
+"$1" sed ${HOME} awk && local 2>/dev/null
+		&& printf echo "$1" 'quoted text' $(pwd) && echo
+printf "$@" readonly readonly "$1" "$1" "$@" grep done grep cd cd /usr/bin $(pwd)
+"$1" local "$@" done sed test awk cd awk awk
+		printf "$1" "$@" then then sed "$1" 'quoted text' done "$@" 2>/dev/null
+	grep grep awk sed -eu awk export then /usr/bin test && local
+awk test "$@" x=1 "$1" "$@" -eu ${HOME} "$1" done
+test printf /usr/bin --verbose then
+		"$@" sed readonly /usr/bin ${HOME} done 2>/dev/null sed cd /usr/bin ${HOME}
+	awk 2>/dev/null then $(pwd) /usr/bin && "$1" export 'quoted text' done
+then 'quoted text' ${HOME}
+		${HOME} local 2>/dev/null export "$1" 'quoted text' then done
+printf local test ${HOME} local readonly
+		x=1 awk --verbose 'quoted text' /usr/bin x=1 --verbose ${HOME} "$1" local
+then && "$1" test --verbose ${HOME} printf "$@" then
+	-eu && /usr/bin test | 'quoted text'
+${HOME} 'quoted text' sed test "$@" -eu local $(pwd) -eu 2>/dev/null
+		awk && --verbose echo --verbose "$1" export awk grep test cd local
+sed printf && then ${HOME} cd echo awk /usr/bin
+$(pwd) "$1" && export /usr/bin export "$1"
+cd then 'quoted text' x=1 2>/dev/null 'quoted text'
+		sed printf readonly awk ${HOME} --verbose test echo /usr/bin
+	then | "$@" "$1" sed test /usr/bin test --verbose test grep then then
+export 2>/dev/null --verbose
+&& grep local local "$1" -eu cd test && local sed x=1 /usr/bin
+		done 2>/dev/null "$@" /usr/bin /usr/bin
+local echo -eu x=1 --verbose ${HOME} --verbose $(pwd) grep local
+	/usr/bin | done --verbose
+		$(pwd) grep readonly cd export test
+	awk --verbose sed /usr/bin "$@" sed readonly $(pwd) done | "$@" echo && export
+	"$@" 'quoted text' | local export x=1 local local
+	echo echo awk local printf readonly test done echo ${HOME} grep "$1" test $(pwd)
+	&& then $(pwd) readonly 2>/dev/null awk awk /usr/bin x=1 $(pwd) export
+	echo 2>/dev/null "$1" 'quoted text' readonly then awk export
+	grep grep export printf
+then awk "$1" local /usr/bin "$@" sed sed
+		echo 2>/dev/null $(pwd) cd then export grep
+	--verbose sed done 'quoted text' printf && awk printf && 'quoted text' --verbose
+		"$@" ${HOME} "$@" "$@" test cd --verbose then sed echo done
+	/usr/bin "$@" grep && grep "$1" ${HOME}
+"$1" grep local 'quoted text' sed 2>/dev/null 'quoted text' sed "$@" "$1" printf
+	'quoted text' 'quoted text' sed readonly | grep printf cd test export echo grep
+		"$1" cd echo $(pwd) readonly
+export printf test sed
+/usr/bin x=1 readonly ${HOME} export printf
+		export "$1" | cd grep then 2>/dev/null | readonly 2>/dev/null
+		export cd readonly "$1" printf 2>/dev/null
+	test "$1" test echo "$@" awk awk sed echo 'quoted text'
+	/usr/bin readonly "$1" | "$@" then cd echo then awk ${HOME} readonly
+	readonly "$1" --verbose /usr/bin -eu then export $(pwd) export test && printf
+sed local | export sed /usr/bin local /usr/bin readonly $(pwd) $(pwd)
+		awk done then "$@" x=1 --verbose 'quoted text' "$1"
+2>/dev/null x=1 echo cd cd then 'quoted text'
+	export printf done export --verbose
+--verbose 'quoted text' | ${HOME} 2>/dev/null
+	"$1" /usr/bin "$1" local 'quoted text' awk sed "$1" "$@" cd sed
+		&& "$1" done | test && sed --verbose --verbose readonly $(pwd) grep /usr/bin
+		2>/dev/null -eu "$@" "$@" 'quoted text' --verbose --verbose /usr/bin
+		grep grep awk readonly 'quoted text' /usr/bin local echo then "$@" done ${HOME}
+		"$1" --verbose -eu export "$@" -eu sed /usr/bin
+		grep ${HOME} x=1 'quoted text'
+cd /usr/bin 'quoted text' /usr/bin then echo $(pwd) "$@" export -eu
+	"$@" grep awk then printf && 'quoted text' printf
+	readonly x=1 && "$@" | "$@" local awk done cd readonly
+	grep x=1 readonly readonly cd local cd x=1 local readonly
+/usr/bin export $(pwd) "$1" grep && &&
+	sed grep ${HOME} awk | test &&
+grep x=1 "$1" ${HOME} "$@" sed 'quoted text'
+		test local "$1" x=1 grep then done
+"$1" && echo | sed -eu printf cd x=1
+| printf local printf readonly $(pwd) -eu 'quoted text' "$1" ${HOME}
+	then awk $(pwd) "$1" -eu readonly | done ${HOME} --verbose echo x=1
+grep readonly awk && done 'quoted text' /usr/bin
+		"$1" done awk ${HOME} 2>/dev/null
+x=1 && && readonly sed then x=1 done
+		cd echo grep 2>/dev/null "$@" echo | --verbose
+	"$1" printf test "$@" readonly sed done
+		export printf echo export "$1" --verbose done cd then $(pwd) 'quoted text'
+	| awk 2>/dev/null 'quoted text'
+		cd 'quoted text' then readonly 2>/dev/null printf
+	${HOME} 2>/dev/null local
+		$(pwd) -eu done then && 'quoted text' sed readonly ${HOME} then
+	local cd done 2>/dev/null -eu /usr/bin --verbose
+| | 2>/dev/null grep /usr/bin readonly echo
+	printf test && test --verbose && | 'quoted text'
+		| && sed | done readonly local awk printf 'quoted text' -eu cd readonly done -eu
+	readonly sed /usr/bin ${HOME} 2>/dev/null test "$1" local test then "$@" printf
+		readonly cd && export grep sed sed $(pwd) readonly
+cd local -eu test /usr/bin echo readonly grep "$1" test grep --verbose
+		${HOME} -eu "$1" printf 2>/dev/null "$1" done sed "$@" 2>/dev/null then
+readonly ${HOME} export cd 2>/dev/null export then | x=1 sed
+	$(pwd) ${HOME} test readonly then
+cd awk export grep printf cd -eu
+	&& export test "$1" awk $(pwd)
+		2>/dev/null 2>/dev/null x=1 sed
+-eu "$@" --verbose cd grep
+		/usr/bin "$@" printf "$@" echo then then
+		2>/dev/null 2>/dev/null | $(pwd) ${HOME} -eu then x=1 && 'quoted text'
+		test --verbose $(pwd) cd && sed cd cd 'quoted text' then export ${HOME} && sed
+	done "$@" done 2>/dev/null "$@" | awk readonly awk | echo ${HOME}
+	"$1" ${HOME} then 'quoted text' x=1 cd local | then printf
+	sed printf export | -eu 2>/dev/null | awk x=1 export
+	echo then done $(pwd) echo $(pwd)
+		test 2>/dev/null 2>/dev/null cd test | readonly "$1" then test printf
+		then sed export readonly
+$(pwd) x=1 then /usr/bin local test "$1" -eu && x=1 printf --verbose
+		${HOME} sed local --verbose readonly $(pwd) export cd x=1 -eu
+		test && echo export export cd sed --verbose export $(pwd) 2>/dev/null 2>/dev/null
+		readonly awk ${HOME} local grep awk printf echo 2>/dev/null readonly printf
+	test local -eu 2>/dev/null export done $(pwd) /usr/bin $(pwd)
+test echo export | grep test done /usr/bin grep 'quoted text' && 'quoted text'
+	${HOME} "$@" readonly grep grep 2>/dev/null echo "$1" "$@" 'quoted text'
+		test x=1 && "$@" && readonly local --verbose printf
+test awk 'quoted text' 'quoted text'
+		"$1" | export cd test && /usr/bin -eu grep |
+		test cd test echo readonly "$@" ${HOME} local /usr/bin "$@"
+	test awk test /usr/bin ${HOME} "$1"
+	--verbose test "$@" then --verbose "$1" readonly "$@" | sed 2>/dev/null
+awk /usr/bin "$1" cd awk x=1 readonly cd x=1 echo
+		$(pwd) && 2>/dev/null 'quoted text' -eu then "$1" local sed $(pwd)
+2>/dev/null ${HOME} local done x=1 | ${HOME} done test
+		then done sed && echo ${HOME} export sed $(pwd) export sed x=1 x=1 export x=1 "$@"
+		export awk local readonly /usr/bin grep printf "$@"
+		"$1" export | done local ${HOME} "$@"
+done x=1 export /usr/bin | | "$@" printf
+	${HOME} done awk /usr/bin local $(pwd) ${HOME}
+	sed echo sed echo 'quoted text' echo
+cd 2>/dev/null 'quoted text' echo local 'quoted text' "$1"
+		| readonly | "$@" x=1 "$1"
+	'quoted text' then x=1 awk then
+	sed | 'quoted text' test ${HOME} then | printf cd "$1" sed 'quoted text'
+-eu done then done echo --verbose awk local test cd x=1
+		export readonly echo x=1 /usr/bin grep $(pwd) -eu
+/usr/bin awk | cd -eu && $(pwd) 'quoted text' | /usr/bin sed 2>/dev/null
+awk readonly -eu x=1 echo 'quoted text' 'quoted text' "$@" /usr/bin
+		--verbose -eu 'quoted text'
+then "$1" grep export
+	grep -eu sed ${HOME} grep -eu
+| x=1 then cd export "$@" awk awk x=1 test --verbose
+-eu 'quoted text' local ${HOME} --verbose && --verbose readonly && "$1" "$@"
+		"$1" 2>/dev/null test export && cd 'quoted text' cd $(pwd) ${HOME} awk ${HOME}
+2>/dev/null 'quoted text' echo "$1" | printf readonly x=1 "$@" export
+		local readonly /usr/bin done && 2>/dev/null && 2>/dev/null 'quoted text' "$@" x=1
+| readonly test $(pwd) 2>/dev/null /usr/bin local
+		sed readonly 2>/dev/null awk -eu x=1
+		awk readonly 'quoted text' -eu "$@" && sed &&
+test 'quoted text' printf "$1" --verbose 2>/dev/null "$@" && | x=1 readonly $(pwd)
+		export readonly echo export test done readonly /usr/bin cd test "$@" echo readonly
+cd 2>/dev/null sed done awk "$1" grep /usr/bin && grep
+	&& export readonly $(pwd) cd export cd then echo
+	&& printf | && echo -eu --verbose sed done
+grep && "$1" readonly 2>/dev/null $(pwd) "$1" sed cd /usr/bin
+		$(pwd) readonly "$@" && "$@" local -eu done
+	cd $(pwd) -eu readonly /usr/bin && 'quoted text'
+local /usr/bin "$1" then $(pwd) done done
+	2>/dev/null | | done echo /usr/bin printf $(pwd) readonly echo readonly awk
+	"$1" then "$1" | echo then x=1 echo x=1 ${HOME} "$@" local export
+grep then local "$@" grep "$1" awk | "$@" x=1 readonly sed
+		test awk && done export $(pwd)
+grep done cd readonly --verbose local $(pwd) done
+	| test $(pwd) $(pwd) && echo
+		awk then echo ${HOME} "$@" -eu 'quoted text'
+	$(pwd) done export /usr/bin then x=1 echo 2>/dev/null "$1" && printf
+	readonly test awk --verbose test echo done sed
+	printf grep --verbose --verbose
+	done x=1 grep grep 'quoted text' -eu | x=1 --verbose
+then test x=1 test $(pwd) --verbose
+		test --verbose grep sed -eu export | /usr/bin x=1 echo ${HOME} printf done
+	done sed cd grep 'quoted text' x=1 awk /usr/bin
+	grep && awk $(pwd) readonly --verbose && echo "$@" then
+		printf done local readonly sed x=1 | grep "$1" local
+		then grep x=1 done && x=1 sed 'quoted text'
+		then | test test 'quoted text'
+		/usr/bin grep $(pwd) /usr/bin 'quoted text'
+x=1 "$1" awk readonly test cd awk "$1" x=1 readonly local ${HOME}
+		$(pwd) done readonly x=1 then local readonly "$@" test | &&
+		export x=1 cd /usr/bin sed
+		sed && done | sed cd "$1" /usr/bin "$@" readonly
+${HOME} x=1 sed && local local --verbose echo cd export done x=1 x=1
+	echo readonly x=1 test cd
+"$@" echo cd done echo printf sed ${HOME} | && awk "$1" "$@"
+		2>/dev/null export && 'quoted text' 'quoted text'
+	printf 2>/dev/null done $(pwd) grep printf printf
+		${HOME} awk -eu printf readonly /usr/bin 2>/dev/null -eu | 2>/dev/null
+	2>/dev/null sed awk local local $(pwd)
+$(pwd) $(pwd) echo test 2>/dev/null 2>/dev/null readonly
+	done 'quoted text' then | printf export "$1" $(pwd) printf
+'quoted text' 'quoted text' test printf local /usr/bin done grep
+x=1 readonly then 2>/dev/null ${HOME} $(pwd) sed readonly echo x=1 /usr/bin
+	then then grep -eu grep cd 'quoted text' then "$1" 'quoted text'
+		test test 2>/dev/null sed awk
+	readonly --verbose local && done "$1" "$1" "$@" x=1 awk local export
+	'quoted text' sed export sed printf local "$1" echo -eu ${HOME} /usr/bin
+	2>/dev/null /usr/bin 2>/dev/null
+		"$@" then test 'quoted text' export "$@" export x=1 sed x=1
+x=1 then /usr/bin readonly export --verbose printf cd awk --verbose
+"$@" | printf cd done -eu export
+		2>/dev/null printf export
+| readonly $(pwd) --verbose && 'quoted text'
+	'quoted text' "$1" done --verbose
+"$1" 'quoted text' export
+	cd export grep sed grep printf echo grep 'quoted text' --verbose
+local 2>/dev/null "$1" 'quoted text' then "$1" printf /usr/bin | 2>/dev/null
+	2>/dev/null sed sed sed x=1 ${HOME}
+/usr/bin awk then 'quoted text' "$@" local x=1 printf
+'quoted text' done local
+		printf awk printf --verbose sed "$1" ${HOME} awk
+sed ${HOME} done | --verbose --verbose /usr/bin cd local $(pwd) && done --verbose
+		local 'quoted text' echo 'quoted text' local readonly export -eu x=1 then test
+	done "$@" -eu local $(pwd) /usr/bin export
+then && x=1 grep --verbose 'quoted text'
+	local awk grep 'quoted text' x=1 test printf | awk printf awk printf test | $(pwd)
+	"$1" grep $(pwd) x=1 grep $(pwd) --verbose then echo |
+2>/dev/null $(pwd) $(pwd) readonly
+	/usr/bin awk export --verbose -eu -eu
+		/usr/bin "$@" cd cd x=1 grep readonly
+readonly ${HOME} x=1 'quoted text' "$@" printf
+		local $(pwd) --verbose && printf readonly
+	&& | printf --verbose ${HOME} local
+		sed then /usr/bin ${HOME}
+	test $(pwd) test done ${HOME} --verbose local cd "$@" sed ${HOME} $(pwd) readonly
+	x=1 /usr/bin "$@" test cd grep readonly 2>/dev/null
+	cd -eu test cd $(pwd) local readonly
+"$1" 2>/dev/null x=1 awk -eu "$1"
+		sed 'quoted text' | /usr/bin echo grep
+	then readonly -eu test awk "$1" ${HOME} then && sed printf 2>/dev/null |
+grep $(pwd) 'quoted text'
+	done 'quoted text' "$1" | "$@" readonly awk --verbose
+x=1 printf export done | && echo
+		"$1" echo echo export | export readonly test readonly cd "$@" &&
+	test 2>/dev/null $(pwd) && echo then cd "$1" -eu test export && readonly -eu done
+'quoted text' test printf echo "$1" 2>/dev/null readonly ${HOME} &&
+	done readonly echo grep "$1" export x=1 readonly "$1"
+"$1" && -eu "$@" printf $(pwd) grep
+	awk && 2>/dev/null echo
+grep export 2>/dev/null
+		then x=1 "$@" $(pwd) && grep export | $(pwd)
+		export test --verbose -eu --verbose 2>/dev/null
+	printf local ${HOME} "$1" && -eu readonly test sed export readonly
+	2>/dev/null cd echo sed ${HOME} $(pwd) 2>/dev/null done
+	$(pwd) | --verbose local cd sed $(pwd) local then -eu test echo
+	cd x=1 sed 'quoted text' then x=1 /usr/bin
+		test | $(pwd) sed && local echo
+readonly && 'quoted text' /usr/bin printf readonly then /usr/bin
+	| $(pwd) $(pwd) awk awk test "$1" x=1 'quoted text' printf done local test
+	"$@" x=1 ${HOME} readonly 2>/dev/null && "$1" /usr/bin grep grep /usr/bin echo
+	${HOME} -eu $(pwd) && | done && test ${HOME} echo | | echo && cd cd
+cd 'quoted text' --verbose cd --verbose cd cd 'quoted text' x=1 x=1 && echo "$1"
+	x=1 --verbose local &&
+	grep printf ${HOME} "$@" printf "$@" then /usr/bin x=1 "$1"
+/usr/bin sed printf echo export readonly local
+&& $(pwd) cd awk test cd awk "$1"
+readonly local /usr/bin echo ${HOME} x=1 | printf 'quoted text' "$@" 'quoted text'
+grep printf sed 'quoted text' 2>/dev/null
+	x=1 done sed done export $(pwd) echo | x=1 cd export then done "$1" echo sed -eu
+		2>/dev/null local then ${HOME} local awk
+		awk then --verbose done awk x=1 echo 'quoted text' -eu /usr/bin $(pwd) test done
+&& readonly grep printf export sed then $(pwd) grep sed $(pwd) -eu test
+	awk printf cd test 2>/dev/null 2>/dev/null $(pwd) then sed "$1" 2>/dev/null
+	"$1" x=1 done cd -eu -eu echo export awk export "$1" ${HOME}
+		-eu cd then test grep -eu "$1" echo
+'quoted text' printf ${HOME} then | ${HOME} 'quoted text' awk $(pwd) export /usr/bin
+		--verbose && 'quoted text' ${HOME} cd local x=1 done 2>/dev/null grep
+	"$1" export && cd readonly
+/usr/bin 'quoted text' | test grep ${HOME} 2>/dev/null 2>/dev/null -eu readonly
+then "$@" export --verbose then test
+	printf readonly 'quoted text' then export awk /usr/bin grep /usr/bin
+		done 'quoted text' sed readonly awk then &&
+printf printf $(pwd) "$@" awk echo 2>/dev/null 2>/dev/null x=1 "$@"
+readonly echo | local && 2>/dev/null printf sed --verbose
+	done echo /usr/bin && "$@" echo then then test
+	$(pwd) "$@" ${HOME} && done | | test cd done "$1" printf then local 2>/dev/null
+"$@" printf echo cd awk test --verbose 'quoted text'
+		done sed then done export cd local echo $(pwd)
+		test done 'quoted text' sed x=1 && then "$@" ${HOME} && cd printf
+		"$@" awk | x=1 printf local --verbose done x=1 grep
+		'quoted text' local grep echo printf
+	2>/dev/null --verbose | cd cd | ${HOME} /usr/bin then | ${HOME} /usr/bin
+		${HOME} /usr/bin then local printf cd export readonly $(pwd) test "$@" readonly
+"$1" && printf printf awk
+	"$1" "$@" && $(pwd) 2>/dev/null printf echo /usr/bin
+		"$@" "$1" echo | "$@" grep sed "$1" | readonly 2>/dev/null
+'quoted text' "$1" echo awk test test readonly
+cd awk sed export /usr/bin /usr/bin
+		${HOME} done export readonly local && grep done x=1 test
+		-eu then cd grep -eu && --verbose "$@" -eu then readonly grep --verbose
+		done && export done echo awk --verbose /usr/bin printf echo --verbose
+	printf sed x=1 "$@" test local 2>/dev/null 2>/dev/null local "$1" awk ${HOME}
+	| $(pwd) x=1 "$@" $(pwd) sed 2>/dev/null ${HOME}
+		export -eu export cd --verbose cd sed awk
+then then 'quoted text' cd then /usr/bin
+| test x=1 cd printf local x=1 $(pwd) printf 'quoted text' $(pwd) awk then cd
+'quoted text' done "$@" printf echo
+		${HOME} done printf -eu ${HOME} grep -eu x=1 grep readonly 2>/dev/null "$1" --verbose
+-eu local grep printf 'quoted text' awk "$@"
+test export sed printf 'quoted text'
+echo -eu /usr/bin /usr/bin 2>/dev/null
+		export "$@" ${HOME} printf 2>/dev/null
+	echo /usr/bin readonly x=1 printf "$1" && export test "$1"
+		x=1 $(pwd) readonly then printf
+--verbose then 'quoted text' "$@" done /usr/bin readonly "$1" &&
+	"$@" then $(pwd) test done /usr/bin
+	export sed 'quoted text' /usr/bin local local "$@"
+		"$1" 2>/dev/null grep --verbose /usr/bin $(pwd) cd --verbose done
+	x=1 --verbose then cd -eu ${HOME} test --verbose "$@" "$1" "$@"
+'quoted text' 'quoted text' echo sed local then "$@" awk -eu
+		grep echo sed awk cd echo 2>/dev/null grep test "$@" /usr/bin
+	--verbose awk -eu done grep cd test done done /usr/bin
+-eu test --verbose readonly &&
+awk 'quoted text' --verbose --verbose 'quoted text' echo
+	| "$@" 2>/dev/null ${HOME} then && -eu
+		local /usr/bin && local $(pwd) | done "$1" local && echo export 'quoted text' grep
+		done cd $(pwd) /usr/bin -eu $(pwd)
+		${HOME} -eu | then export "$@" printf export cd readonly echo test
+	"$@" sed | --verbose export then done ${HOME}
+		${HOME} awk sed echo sed readonly awk then --verbose &&
+		grep cd readonly $(pwd) | readonly echo then /usr/bin
+readonly readonly grep "$1" grep then echo ${HOME} echo $(pwd) &&
+| 'quoted text' --verbose | | awk && "$@" grep cd grep echo local /usr/bin
+		$(pwd) done -eu export 'quoted text' grep done sed
+	cd cd cd x=1 export -eu /usr/bin
+	'quoted text' /usr/bin done export echo echo local sed then echo
+| printf "$1" sed "$1" readonly local --verbose $(pwd) sed test
+readonly $(pwd) awk export
+then 'quoted text' 'quoted text' 2>/dev/null
+	${HOME} "$@" | echo sed awk test $(pwd) printf
+		-eu then test test done export /usr/bin
+		sed sed printf && echo /usr/bin && export
+		grep $(pwd) "$@" "$1" /usr/bin printf /usr/bin export grep echo echo
+	awk sed done awk test "$@" export "$1" awk ${HOME} awk 'quoted text' awk
+		x=1 echo then then $(pwd) ${HOME} x=1 -eu readonly test "$@"
+| -eu grep sed printf /usr/bin export echo test 2>/dev/null printf x=1
+done /usr/bin sed x=1 printf readonly && --verbose
+	done x=1 done --verbose && | 2>/dev/null export && then && echo --verbose
+		$(pwd) readonly --verbose then -eu sed done ${HOME} sed echo echo $(pwd) /usr/bin
+export ${HOME} "$@" test 2>/dev/null then cd &&
+cd /usr/bin echo && && local 'quoted text' then cd echo | x=1 | local
+$(pwd) "$1" printf 'quoted text' x=1 sed $(pwd) then 2>/dev/null sed 'quoted text'
+local then | local "$1" printf echo /usr/bin
+		done | x=1 $(pwd) /usr/bin "$1"
+	&& 2>/dev/null 2>/dev/null --verbose
+	export "$1" "$@" $(pwd) done cd sed awk "$@" done | $(pwd) grep echo echo
+"$1" ${HOME} local 2>/dev/null --verbose local awk
+"$1" local 'quoted text' | cd 'quoted text' done grep export
+		echo -eu x=1 local printf printf then printf 'quoted text'
+	grep export 2>/dev/null --verbose
+	awk /usr/bin 'quoted text' echo export ${HOME} then then
+	$(pwd) echo sed echo && export awk -eu readonly done
+		$(pwd) test awk done ${HOME} 'quoted text' | test /usr/bin "$@" 2>/dev/null
+	&& && 'quoted text' ${HOME} /usr/bin --verbose echo
+		cd | awk local | readonly local then sed ${HOME} ${HOME} cd ${HOME}
+		${HOME} test "$@" 2>/dev/null "$1" --verbose awk
+	"$1" --verbose printf done printf "$1" done /usr/bin x=1 export local 2>/dev/null
+		'quoted text' | /usr/bin ${HOME}
+		local 2>/dev/null 'quoted text' cd x=1 done test awk /usr/bin cd
+$(pwd) readonly readonly readonly echo readonly grep echo 2>/dev/null
+printf x=1 --verbose ${HOME}
+	test -eu | grep -eu awk echo
+		-eu done 'quoted text' done $(pwd) then $(pwd) --verbose
+export export 'quoted text' local --verbose "$1"
+	/usr/bin printf echo sed sed done "$@" x=1 'quoted text'
+	2>/dev/null /usr/bin cd printf
+echo ${HOME} cd "$@" cd printf test
+| cd /usr/bin 'quoted text' --verbose ${HOME} sed -eu ${HOME} sed --verbose
+		cd "$1" export test 'quoted text' /usr/bin readonly ${HOME} readonly
+		readonly $(pwd) cd ${HOME} /usr/bin && && export -eu --verbose sed done echo
+$(pwd) export "$1" sed local export 'quoted text'
+		cd | /usr/bin && 'quoted text' x=1 2>/dev/null 'quoted text' local --verbose 2>/dev/null
+		"$1" && ${HOME} local export "$@" x=1 $(pwd) printf ${HOME} local -eu --verbose
+printf readonly printf | sed "$@" 2>/dev/null cd
+echo | 2>/dev/null && awk grep export -eu $(pwd)
+sed && export "$@" echo echo x=1 then x=1 -eu x=1 &&
+	cd cd $(pwd) -eu cd test -eu cd -eu
+"$1" "$1" -eu "$@" $(pwd) ${HOME} x=1 printf printf awk export && -eu
+$(pwd) done done "$@" export 'quoted text' | /usr/bin
+/usr/bin | test "$1" sed
+sed /usr/bin -eu local local awk local echo
+	| ${HOME} echo awk $(pwd) $(pwd) export test local
+--verbose grep echo export 2>/dev/null sed "$@" sed printf then awk --verbose
+then && export x=1 done export x=1 cd local 2>/dev/null export "$@" echo
+	sed 2>/dev/null grep cd done export
+		test echo done test --verbose $(pwd) then 2>/dev/null "$1" awk grep --verbose
+		awk "$@" /usr/bin cd | then $(pwd) "$@" "$1"
+		&& "$1" --verbose cd 'quoted text' cd then && x=1 "$1" x=1 test printf
+		-eu "$@" "$1" | ${HOME} echo ${HOME} cd
+	done x=1 echo "$@" --verbose && | --verbose "$1" -eu readonly grep echo sed --verbose
+readonly printf x=1 done export 2>/dev/null printf
+	"$@" x=1 readonly 'quoted text'
+	local "$@" sed | 'quoted text' cd test "$@"
+echo echo "$1" 'quoted text' then test cd "$1" | | echo sed test local
+-eu grep cd local x=1
+	grep then sed echo export readonly "$1" x=1 export
+		awk sed done readonly printf ${HOME} 2>/dev/null
+printf | printf cd /usr/bin 2>/dev/null done sed
+${HOME} $(pwd) | then "$1" --verbose awk echo then "$@" &&
+then ${HOME} then &&
+printf --verbose -eu 'quoted text' sed cd sed -eu 2>/dev/null sed 'quoted text'
+	$(pwd) ${HOME} /usr/bin && && /usr/bin grep --verbose
+echo "$@" ${HOME} cd 2>/dev/null export ${HOME} local then 'quoted text'
+/usr/bin printf 2>/dev/null $(pwd) done | printf
+${HOME} cd done printf
+	export $(pwd) printf --verbose && export cd ${HOME} "$@" "$@"
+	&& 2>/dev/null -eu 2>/dev/null -eu awk && then "$@" done test
+'quoted text' | readonly readonly -eu -eu awk test ${HOME} "$@" "$1" "$1" printf
+local readonly | 'quoted text'
+awk cd echo x=1 test awk
+then ${HOME} sed readonly awk export "$1" printf readonly && test export
+		done "$@" 'quoted text' readonly
+		cd "$@" /usr/bin sed sed "$1" -eu printf "$1" --verbose export local export "$1"
+		x=1 done ${HOME} awk "$1" grep | grep awk sed done
+	$(pwd) done && "$1" -eu x=1 then ${HOME}
+cd x=1 x=1 test 'quoted text' /usr/bin grep | awk --verbose x=1 awk test grep
+		export --verbose "$1" readonly done export && $(pwd)
+	2>/dev/null | "$@" test
+	--verbose test | $(pwd) "$@" /usr/bin readonly ${HOME} printf test
+done done echo readonly cd echo 2>/dev/null
+	then readonly readonly local --verbose echo | "$@" /usr/bin
+		readonly awk "$@" awk 'quoted text' cd cd printf -eu sed /usr/bin
+'quoted text' awk local awk 2>/dev/null grep -eu "$@" export ${HOME}
+grep test && "$1" -eu 2>/dev/null printf 2>/dev/null
+		"$@" export "$@" done "$1"
+awk -eu echo test printf ${HOME} "$@" --verbose readonly test
+	test then sed local $(pwd) "$1" /usr/bin
+	| --verbose done printf /usr/bin /usr/bin ${HOME} then /usr/bin done
+'quoted text' 2>/dev/null "$1" ${HOME} "$@" local
+grep ${HOME} | echo then | local && 2>/dev/null --verbose
+		"$1" -eu cd | /usr/bin sed x=1 /usr/bin echo
+		'quoted text' -eu printf sed
+&& export | | "$@" sed test $(pwd) echo echo "$1" then printf --verbose
+done "$1" 'quoted text' | --verbose echo awk test sed then done
+	then local -eu then then && --verbose $(pwd) /usr/bin then 2>/dev/null
+		'quoted text' ${HOME} ${HOME}
+"$1" awk sed awk sed x=1 awk then "$1" "$1" x=1 grep echo
+$(pwd) --verbose /usr/bin done | awk export
+		${HOME} then export "$@" grep | --verbose export x=1 grep -eu
+		| | ${HOME} $(pwd) "$1" sed sed test --verbose echo "$1" then "$1"
+		-eu export export printf x=1 --verbose test "$1" readonly
+&& 2>/dev/null sed then test x=1 /usr/bin echo --verbose
+		sed printf 2>/dev/null sed
+| --verbose cd then "$1" --verbose awk "$@" 'quoted text' 2>/dev/null
+cd ${HOME} grep $(pwd) test printf "$@" printf
+	sed "$@" echo awk 2>/dev/null printf -eu "$@" readonly printf local
+		$(pwd) | local cd ${HOME} export --verbose grep grep export local
+		awk done "$@" $(pwd) ${HOME} ${HOME} awk
+-eu "$1" cd test done done local sed ${HOME} ${HOME} then export
+	done then x=1 'quoted text' --verbose "$@" grep awk -eu && then $(pwd) $(pwd)
+	-eu "$@" "$1" awk sed awk | echo
+	then $(pwd) | echo readonly done "$1" | grep "$1" printf echo
+--verbose && echo done then done echo local
+2>/dev/null echo "$1" "$@" done done /usr/bin -eu x=1 awk readonly
+cd /usr/bin 2>/dev/null x=1 echo | test then --verbose -eu
+	grep && then 2>/dev/null $(pwd) grep && ${HOME} awk sed export "$1" 'quoted text'
+cd done printf export readonly "$@" --verbose cd 'quoted text'
+$(pwd) | readonly printf grep export 'quoted text' && done test
+	sed printf 2>/dev/null export export "$@" /usr/bin local x=1 &&
+		grep "$@" | && export --verbose test then /usr/bin /usr/bin grep --verbose --verbose
+	"$1" sed local 2>/dev/null awk
+2>/dev/null ${HOME} readonly readonly "$1" 'quoted text' export 2>/dev/null
+		&& export cd printf echo x=1 "$1" x=1 cd export ${HOME} "$@"
+	sed test --verbose ${HOME} 'quoted text'
+		--verbose then --verbose then echo
+	$(pwd) "$@" ${HOME} 2>/dev/null && echo &&
+then grep then 'quoted text' echo $(pwd)
+		&& export -eu x=1 'quoted text'
+		printf | readonly export | echo cd cd "$1" x=1 grep
+'quoted text' then | "$1" readonly
+	$(pwd) $(pwd) /usr/bin ${HOME} grep local test 2>/dev/null
+	${HOME} grep ${HOME} test | "$@" grep test cd 'quoted text'
+done awk grep | readonly $(pwd) test
+-eu export x=1 test 'quoted text' $(pwd) /usr/bin /usr/bin x=1 'quoted text'
+		-eu "$@" 'quoted text' --verbose readonly "$@" cd grep
+/usr/bin "$1" --verbose sed local /usr/bin printf
+	'quoted text' 2>/dev/null export printf | $(pwd)
+${HOME} local export sed echo local sed /usr/bin 'quoted text' export
+	| /usr/bin $(pwd) export | sed 2>/dev/null grep grep 2>/dev/null
+	&& "$1" done cd echo sed 2>/dev/null readonly
+	x=1 done grep && test echo $(pwd) 2>/dev/null
+	"$@" ${HOME} 2>/dev/null 2>/dev/null /usr/bin sed -eu grep awk test echo /usr/bin
+	"$1" grep /usr/bin "$1" echo cd readonly --verbose
+	"$1" "$1" 'quoted text' x=1 printf test | /usr/bin -eu ${HOME}
+	${HOME} && /usr/bin sed
+		done -eu then cd $(pwd) x=1 ${HOME}
+printf readonly printf local readonly -eu export "$1" --verbose
+		echo export echo done local
+"$1" awk cd /usr/bin local cd "$@" /usr/bin "$@" cd "$1" 2>/dev/null cd | 'quoted text'
+	sed test echo "$@" grep 'quoted text' then printf then printf | x=1 --verbose --verbose
+	"$@" | ${HOME} && awk awk "$1" awk
+"$@" --verbose local grep
+		grep && x=1 export sed cd
+| --verbose 'quoted text' done local
+"$1" x=1 test | printf /usr/bin then | 2>/dev/null x=1 grep grep then
+	| then | | | && test 2>/dev/null $(pwd) grep readonly grep
+printf --verbose cd && local export printf sed printf 'quoted text'
+grep test cd $(pwd) -eu export ${HOME} -eu echo
+printf done 'quoted text' then sed ${HOME} $(pwd) echo
+	/usr/bin --verbose /usr/bin "$@" && echo cd test 2>/dev/null
+	2>/dev/null test echo then --verbose x=1 ${HOME} local 2>/dev/null ${HOME}
+	cd x=1 test sed then readonly done
+	local export ${HOME} -eu "$@"
+local cd $(pwd) "$1" x=1 grep ${HOME} /usr/bin printf 2>/dev/null 2>/dev/null
+		| readonly ${HOME} 'quoted text' readonly
+	'quoted text' --verbose export export "$@" sed
+readonly ${HOME} --verbose | export
+-eu cd readonly printf grep
+--verbose readonly ${HOME} grep export then grep echo sed "$@" export 'quoted text'
+printf awk awk test $(pwd) cd
+		x=1 ${HOME} awk local /usr/bin then /usr/bin && |
+		done $(pwd) x=1 -eu --verbose readonly readonly "$@" grep 2>/dev/null test awk
+		readonly printf 2>/dev/null readonly 'quoted text'
+printf echo printf $(pwd) awk echo && 2>/dev/null
+	cd then 'quoted text' -eu 2>/dev/null $(pwd) test --verbose test x=1 | local $(pwd)
+printf export --verbose -eu grep local printf export cd /usr/bin
+grep "$1" awk ${HOME} 2>/dev/null 'quoted text' printf
+awk /usr/bin readonly && $(pwd)
+	cd test x=1 x=1 local printf 'quoted text' local export $(pwd) local printf
+		awk | /usr/bin printf local --verbose x=1 sed 'quoted text'
+'quoted text' echo /usr/bin
+		--verbose -eu 'quoted text' "$@" then --verbose ${HOME} done cd
+sed awk echo 'quoted text' x=1 readonly grep awk export $(pwd) grep | readonly
+		--verbose awk echo && -eu local echo local 'quoted text' 2>/dev/null grep
+	test | ${HOME} "$@" | x=1 sed 'quoted text'
+readonly x=1 cd export
+	readonly grep awk "$@" export awk then then x=1
+	then ${HOME} "$1" grep cd done /usr/bin printf "$1" grep 2>/dev/null
+"$@" printf printf | ${HOME} grep 'quoted text' "$@" $(pwd) --verbose done
+	'quoted text' cd cd 2>/dev/null -eu local
+sed x=1 ${HOME} test awk done test ${HOME} 'quoted text'
+	then && readonly ${HOME} export sed grep readonly readonly /usr/bin
+"$@" cd "$@" 2>/dev/null export printf
+done x=1 /usr/bin test awk && $(pwd) "$@" local local | local
+${HOME} awk cd awk "$1" x=1 test test cd grep done
+x=1 export 2>/dev/null | readonly
+	'quoted text' done --verbose "$1" done --verbose sed $(pwd) ${HOME}
+		${HOME} 'quoted text' then grep readonly sed | readonly
+		echo export x=1 test local
+"$@" sed test ${HOME} "$1" "$1" sed echo
+		test awk && local grep --verbose "$@" export test then echo | then test cd | grep
+		local --verbose local cd grep
+	--verbose 'quoted text' x=1 echo local
+		2>/dev/null echo then test x=1 'quoted text' sed ${HOME}
+	&& "$@" local x=1 -eu echo 'quoted text' printf grep
+"$1" $(pwd) "$1" cd then echo done
+test x=1 local /usr/bin /usr/bin readonly
+readonly awk 2>/dev/null local local "$@" cd $(pwd) -eu | "$1" $(pwd)
+		sed local sed cd awk export
+		'quoted text' local 'quoted text' && awk 2>/dev/null
+echo 'quoted text' $(pwd) | && $(pwd) then printf awk $(pwd) export
+		&& -eu sed 'quoted text' /usr/bin local cd then $(pwd)
+	&& "$@" "$1" "$1" --verbose -eu
+	"$1" local local readonly && then
+	$(pwd) x=1 grep "$@" cd test "$@" test -eu local 'quoted text'
+		done awk cd readonly "$@" "$1" local 2>/dev/null
+	&& x=1 "$1" done echo -eu test x=1 /usr/bin ${HOME} local
+		cd printf /usr/bin "$1" "$1" | --verbose cd readonly
+		2>/dev/null readonly "$1" local 'quoted text' printf
+		cd 2>/dev/null printf && "$1" local then
+	awk -eu x=1 $(pwd) export test "$@" $(pwd) grep cd
+grep echo readonly readonly $(pwd)
+		| cd -eu "$1" cd "$1" "$1" --verbose
+	export --verbose done --verbose readonly awk "$@"
+export printf ${HOME} --verbose $(pwd) grep | "$@" then "$@" &&
+		awk printf then printf 2>/dev/null --verbose $(pwd) then awk
+		2>/dev/null "$1" | then
+test "$@" grep local test && 2>/dev/null
+		2>/dev/null awk echo awk
+	$(pwd) sed ${HOME} echo -eu grep 'quoted text'
+		x=1 2>/dev/null | readonly x=1 printf
+	cd --verbose -eu /usr/bin export done "$1"
+		"$1" done readonly /usr/bin printf local $(pwd) sed done 2>/dev/null
+	| -eu cd readonly export | printf local $(pwd) sed $(pwd) readonly then grep test
+"$@" /usr/bin --verbose
+	printf readonly local 'quoted text' local 'quoted text' /usr/bin x=1 x=1
+	export test done test sed $(pwd) awk ${HOME}
+sed 2>/dev/null && export | export $(pwd)
+	grep "$@" cd done echo
+		'quoted text' "$@" -eu cd local
+		-eu "$1" $(pwd) ${HOME} /usr/bin
+	'quoted text' grep && sed readonly --verbose awk awk 2>/dev/null 'quoted text' -eu
+test /usr/bin $(pwd) x=1 grep $(pwd) && sed local -eu && "$1" grep cd awk awk
+	"$@" | awk done then printf -eu cd 'quoted text'
+		"$1" && then x=1 local -eu
+-eu done printf awk test "$1" /usr/bin /usr/bin 'quoted text' 2>/dev/null
+export cd x=1 'quoted text'
+		done awk -eu then test "$1" ${HOME} ${HOME} export /usr/bin grep sed
+then test then then export echo && $(pwd) ${HOME} test grep then
+	&& done cd 'quoted text' "$1" $(pwd) done done "$@"
+	done cd export 'quoted text' sed local
+		done sed local | printf export cd $(pwd) grep
+test cd /usr/bin local grep
+		&& ${HOME} $(pwd) echo then 2>/dev/null "$@" grep 'quoted text' local grep
+	${HOME} readonly grep local cd test
+/usr/bin sed cd 'quoted text' test -eu then echo grep "$1" grep grep x=1
+		awk --verbose "$1" printf export 2>/dev/null -eu
+		grep test x=1 done readonly x=1 cd "$1" "$1" then local sed echo ${HOME}
+	readonly done 2>/dev/null
+	x=1 then then test then /usr/bin printf | 'quoted text' | 'quoted text' | "$@"
+done readonly export $(pwd) | cd 'quoted text'
+	sed ${HOME} ${HOME} export sed | local sed
+export 2>/dev/null printf then printf x=1 --verbose --verbose
+		sed /usr/bin awk done 2>/dev/null test export
+"$1" --verbose | readonly | cd printf $(pwd) local echo ${HOME} /usr/bin grep sed
+'quoted text' ${HOME} ${HOME} $(pwd) /usr/bin printf then local x=1 sed
+	then awk /usr/bin | /usr/bin 'quoted text' test test 2>/dev/null
+		grep 'quoted text' 2>/dev/null readonly done x=1
+	sed ${HOME} sed grep local grep && grep /usr/bin x=1 local ${HOME}
+awk readonly test test | 'quoted text' | 2>/dev/null ${HOME} x=1 -eu 'quoted text'
+		awk x=1 -eu -eu awk cd --verbose && $(pwd)
+		then --verbose sed && 2>/dev/null | then -eu "$1" $(pwd) --verbose
+	| ${HOME} readonly then 2>/dev/null readonly -eu -eu readonly ${HOME} sed --verbose
+	$(pwd) "$1" ${HOME} /usr/bin /usr/bin 2>/dev/null
+done x=1 echo $(pwd) printf done x=1
+test 2>/dev/null ${HOME} "$@" 2>/dev/null cd awk "$1"
+		cd "$@" cd echo "$@" x=1
+-eu sed done awk x=1 --verbose ${HOME} printf
+	/usr/bin 'quoted text' "$1" 'quoted text' test ${HOME} && done 'quoted text' sed
+x=1 echo | $(pwd) then then
+--verbose echo then awk
+	test 'quoted text' sed "$@" /usr/bin test && export
+${HOME} 'quoted text' "$1" "$1" local -eu "$@" cd /usr/bin local test -eu x=1 local
+		| /usr/bin --verbose && readonly
+then readonly && && echo && $(pwd) local "$1" grep test /usr/bin
+	export printf printf test grep then
+		"$1" done "$1" x=1 $(pwd)
+	test readonly printf done 2>/dev/null cd $(pwd) 'quoted text' 2>/dev/null
+$(pwd) local x=1 -eu "$1" export "$1" x=1 $(pwd) | 'quoted text' readonly
+readonly then done test $(pwd) export x=1
+		sed $(pwd) test 'quoted text' grep
+		test "$1" 'quoted text' then sed test x=1 2>/dev/null "$@" test | x=1 |
+	/usr/bin | ${HOME} --verbose 'quoted text' --verbose cd cd $(pwd) readonly
+	test 'quoted text' test then grep cd $(pwd) --verbose "$1" cd export cd export
+	readonly echo grep "$@" /usr/bin x=1 /usr/bin local ${HOME} test awk && /usr/bin
+then "$1" "$1" done && done printf echo export --verbose local printf done done
+$(pwd) awk test && done done test then
+		test readonly /usr/bin cd test grep $(pwd) $(pwd)
+	done | readonly done "$1"
+		$(pwd) $(pwd) export "$1"
+	test done printf export | $(pwd) done cd done grep grep 'quoted text' /usr/bin
+		"$@" local "$@" x=1 awk "$@" sed then --verbose cd local local
+grep awk && "$@" readonly "$1" export grep --verbose
+		'quoted text' echo done && echo 2>/dev/null
+	readonly /usr/bin -eu sed sed x=1 "$1" export export /usr/bin cd export local
+	&& grep awk "$1" "$@" readonly x=1 | 2>/dev/null local 2>/dev/null
+		local /usr/bin awk ${HOME} $(pwd) --verbose cd grep 2>/dev/null
+		sed $(pwd) -eu /usr/bin "$@" done &&
+		echo awk ${HOME} | && -eu && x=1 cd $(pwd)
+--verbose readonly $(pwd) /usr/bin echo | "$1" "$@"
+	readonly ${HOME} printf
+		printf printf | awk printf ${HOME} /usr/bin 2>/dev/null "$1" readonly /usr/bin
+	"$@" echo ${HOME} test ${HOME} cd --verbose local sed -eu local
+		${HOME} -eu done sed done 2>/dev/null
+| done grep awk cd test /usr/bin readonly done --verbose && done readonly
+	/usr/bin readonly done then /usr/bin local
+	${HOME} echo x=1 sed echo sed "$1" -eu $(pwd)
+		$(pwd) sed "$1" local done && grep done $(pwd) cd grep
+	2>/dev/null grep "$@" awk x=1 awk local printf sed then $(pwd) ${HOME}
+"$@" then cd test then local sed test x=1 echo readonly
+		--verbose $(pwd) | --verbose -eu done grep echo --verbose
+	cd ${HOME} 2>/dev/null 'quoted text' | test test printf
+-eu grep ${HOME} | $(pwd) | then local /usr/bin
+	"$@" && "$1" cd export x=1 | | grep x=1 "$1" 2>/dev/null "$@" "$@"
+	&& test ${HOME} 2>/dev/null 2>/dev/null /usr/bin | 2>/dev/null /usr/bin 2>/dev/null
+	-eu echo && /usr/bin | --verbose x=1 | 2>/dev/null export echo
+		readonly then awk | -eu 'quoted text'
+echo sed local --verbose readonly awk test $(pwd) readonly awk local test
+	cd sed done $(pwd) x=1 /usr/bin grep && then sed export |
+&& local 2>/dev/null local -eu cd /usr/bin
+done ${HOME} local /usr/bin "$@" x=1 'quoted text' local awk sed
+	x=1 'quoted text' 2>/dev/null
+cd printf /usr/bin grep done test then "$1" cd
+	${HOME} | done sed done x=1
+	| printf 'quoted text' done grep --verbose cd then echo grep ${HOME} cd --verbose
+	"$@" printf "$1" $(pwd) 2>/dev/null $(pwd) grep x=1 "$@"
+cd awk 2>/dev/null | awk ${HOME} awk
+	echo done local "$1" --verbose $(pwd) export /usr/bin
+		-eu export "$@" 2>/dev/null readonly 2>/dev/null
+	test then printf then x=1
+	"$1" && export test readonly test | x=1 2>/dev/null cd "$1" then 2>/dev/null
+sed export /usr/bin readonly -eu grep --verbose readonly sed 2>/dev/null
+		done then sed -eu -eu local echo echo grep awk awk sed &&
+--verbose x=1 export ${HOME} /usr/bin awk
+	export local cd printf /usr/bin printf
+	grep awk "$1" readonly -eu printf 'quoted text'
+${HOME} /usr/bin export awk x=1 readonly export -eu &&
+	local test "$1" "$1" x=1 cd echo echo sed awk readonly
+	"$1" readonly cd done test printf printf | --verbose "$1" then ${HOME} /usr/bin
+		x=1 grep done /usr/bin local 2>/dev/null then printf grep 2>/dev/null
+	'quoted text' --verbose x=1 sed 2>/dev/null
+	done | /usr/bin && $(pwd) 'quoted text'
+"$1" "$@" -eu then --verbose done readonly --verbose x=1 cd sed | export
+echo export test x=1 "$1" then $(pwd) "$1" awk "$@" local echo
+		$(pwd) x=1 $(pwd) cd /usr/bin awk readonly sed /usr/bin readonly /usr/bin
+		"$1" ${HOME} --verbose cd export $(pwd)
+printf test cd -eu 2>/dev/null x=1 awk "$1" export
+-eu awk $(pwd) "$@" x=1 cd readonly /usr/bin
+echo 2>/dev/null 'quoted text' readonly printf test --verbose
+	--verbose test --verbose 'quoted text' export | awk "$@" printf local ${HOME}
+		'quoted text' -eu && readonly
+	"$@" printf /usr/bin local readonly
+	export sed --verbose export awk 'quoted text' printf 2>/dev/null grep
+	| done 2>/dev/null export then /usr/bin 'quoted text' readonly test
+"$@" local test done /usr/bin
+		/usr/bin readonly | printf 2>/dev/null ${HOME} readonly
+		'quoted text' readonly grep ${HOME} -eu cd awk grep test --verbose
+then 'quoted text' grep then cd "$@"
+2>/dev/null then -eu && printf
+	export x=1 -eu 2>/dev/null
+		sed ${HOME} "$@" readonly 'quoted text'
+$(pwd) $(pwd) $(pwd) echo x=1 local sed grep -eu grep /usr/bin
+		then && sed echo ${HOME} /usr/bin echo
+	awk /usr/bin | /usr/bin 2>/dev/null --verbose --verbose
+		export $(pwd) 2>/dev/null awk "$1" awk "$1" && test "$@"
+"$1" $(pwd) cd 2>/dev/null grep printf sed $(pwd) 2>/dev/null "$@" $(pwd) export
+	'quoted text' | export export printf done test cd x=1 echo x=1 echo && awk export
+		"$1" done --verbose 'quoted text'
+		done ${HOME} done ${HOME} test && "$1" awk sed
+	2>/dev/null readonly 2>/dev/null local "$1" /usr/bin
+		done test x=1 echo printf awk
+	echo "$1" $(pwd) cd "$@" "$1"
+	--verbose cd then done 2>/dev/null cd done 'quoted text' ${HOME} done --verbose
+		2>/dev/null grep sed then -eu /usr/bin /usr/bin printf local $(pwd) $(pwd) && done
+		sed "$@" readonly cd | "$@" grep "$@" readonly $(pwd) grep
+		grep awk | then local awk done grep 'quoted text' ${HOME} then 'quoted text'
+		&& export x=1 test echo ${HOME} 'quoted text' test /usr/bin && --verbose $(pwd)
+	${HOME} local test then awk cd test --verbose ${HOME} then 'quoted text' export
+	"$@" "$1" && | $(pwd) printf "$@" "$1" 2>/dev/null grep grep echo cd 'quoted text'
+		cd sed readonly cd local grep echo --verbose
+		$(pwd) grep && | test 2>/dev/null
+		"$@" cd x=1 && | readonly 2>/dev/null echo &&
+#include c111.sh
+		| $(pwd) "$1" local 'quoted text' 'quoted text' readonly | --verbose "$1"
+		x=1 printf export ${HOME} -eu export cd $(pwd) $(pwd) && 2>/dev/null awk --verbose
+	readonly readonly done $(pwd) sed x=1 then
+"$@" printf cd sed -eu printf "$@" --verbose
+local echo "$@" grep local local && printf "$@"
+		export --verbose | "$1" -eu sed export x=1
+		readonly done 2>/dev/null ${HOME} export "$1" /usr/bin | -eu 2>/dev/null
+	printf awk $(pwd) readonly -eu local local local export x=1 readonly
+x=1 && /usr/bin readonly readonly /usr/bin printf local awk cd readonly
+2>/dev/null awk /usr/bin then echo -eu ${HOME} local "$1" ${HOME}
+		2>/dev/null -eu $(pwd)
+| $(pwd) grep local export ${HOME} local then echo then "$1" x=1 /usr/bin ${HOME}
+		${HOME} --verbose && export x=1 2>/dev/null /usr/bin --verbose | | "$@"
+echo $(pwd) -eu "$1" grep x=1 'quoted text'
+		readonly | 2>/dev/null test /usr/bin | | readonly $(pwd) --verbose "$1" local
+	/usr/bin awk grep 2>/dev/null
+		then echo cd "$@" echo grep echo 'quoted text' then -eu echo readonly "$@"
+test then && echo readonly "$@" grep then 2>/dev/null awk /usr/bin
+awk test | then local test cd "$1" test export x=1 "$@" awk "$1"
+	"$1" readonly sed -eu --verbose
+		readonly 'quoted text' && x=1 /usr/bin $(pwd) x=1
+x=1 "$1" 'quoted text' test echo awk test x=1 awk x=1 test "$@" 2>/dev/null 2>/dev/null
+test grep 2>/dev/null
+		sed cd && printf x=1 | 'quoted text' "$@"
+	readonly 2>/dev/null readonly
+	echo export "$@" echo cd awk local then --verbose
+	export x=1 then printf done readonly done 'quoted text' 'quoted text' printf
+		sed test local x=1 cd 'quoted text' "$1" /usr/bin |
+		readonly -eu ${HOME} readonly /usr/bin test && sed local
+	export 2>/dev/null "$@"
+x=1 echo printf "$@" ${HOME} "$1" -eu then ${HOME}
+cd readonly 'quoted text' "$@" /usr/bin printf x=1 printf "$1" -eu
+--verbose && "$1" /usr/bin ${HOME} printf "$@" test echo /usr/bin
+		export /usr/bin $(pwd) sed $(pwd) cd grep ${HOME}
+		$(pwd) x=1 readonly && "$@" ${HOME}
+	printf test printf done sed
+done test done readonly | export printf ${HOME} local | "$@" cd
+		$(pwd) echo /usr/bin then
+		--verbose "$@" echo grep readonly "$1" && $(pwd) 'quoted text'
+		/usr/bin export awk sed
+	'quoted text' 'quoted text'
+&& grep | 2>/dev/null --verbose
+	readonly -eu x=1 sed printf sed done
+"$@" cd 'quoted text' "$1" done test
+	grep local /usr/bin sed && export printf sed x=1 cd "$@" done && then grep
+	/usr/bin done 'quoted text' ${HOME} /usr/bin -eu /usr/bin --verbose then export
+		cd x=1 local ${HOME} 2>/dev/null readonly && test --verbose printf -eu
+		echo "$@" grep --verbose "$1" "$@" $(pwd) printf ${HOME} 'quoted text'
+		printf export sed -eu echo local echo then local then 'quoted text' /usr/bin
+done done /usr/bin ${HOME} local done 'quoted text'
+	echo /usr/bin x=1 awk x=1 "$@" "$@" --verbose
+	"$@" printf sed -eu "$@" ${HOME} printf then readonly "$@" local sed 2>/dev/null
+test cd grep x=1 test
+"$@" "$1" ${HOME} export 2>/dev/null 'quoted text'
+	then awk export ${HOME} cd test | 'quoted text' then | "$@" cd done
+	grep 'quoted text' sed
+cd x=1 local grep cd $(pwd) 'quoted text'
+	printf $(pwd) echo "$1" --verbose echo readonly done then readonly ${HOME}
+	then --verbose echo then readonly local echo "$@" grep "$1"
+		export then echo "$@" -eu "$@" readonly echo "$@" cd -eu 'quoted text'
+	test local "$1" done done "$1" awk done "$1" && /usr/bin $(pwd) awk
+		done local "$1" ${HOME} readonly
+		test cd "$1" test readonly export export readonly then
+		export grep readonly /usr/bin $(pwd) | --verbose -eu -eu local | test
+${HOME} && then grep local
+		--verbose export done $(pwd) grep awk then cd export $(pwd) sed test 'quoted text'
+		done 2>/dev/null readonly cd then readonly -eu && "$1" done | local test done
+$(pwd) -eu 2>/dev/null export "$@" --verbose echo x=1 local
+"$@" --verbose | "$@" sed export x=1 readonly && sed echo cd test
+	awk -eu "$@" grep --verbose then $(pwd) 'quoted text' grep awk export
+-eu /usr/bin printf sed local sed cd done | --verbose readonly
+2>/dev/null readonly &&
+${HOME} export "$@" echo 'quoted text'
+	readonly readonly 'quoted text' | && -eu "$@" cd then -eu then ${HOME} sed
+	-eu printf awk printf /usr/bin printf printf grep | grep "$1" 2>/dev/null
+then && | printf "$1" done test "$@" $(pwd) 'quoted text'
+"$1" | 2>/dev/null "$@"
+echo "$1" cd /usr/bin awk 2>/dev/null
+	$(pwd) && printf "$@" && grep -eu /usr/bin /usr/bin
+/usr/bin -eu && sed "$@" /usr/bin printf $(pwd) grep && && grep echo echo sed test
+	| 'quoted text' done "$1" export ${HOME}
+		/usr/bin /usr/bin local echo sed echo readonly &&
+		cd echo grep cd readonly x=1 "$1" local ${HOME} 'quoted text'
+2>/dev/null 'quoted text' $(pwd) export grep
+	awk cd "$1" printf printf local --verbose -eu $(pwd) cd "$1"
+	${HOME} test | done readonly done sed export "$@" cd --verbose awk --verbose
+		local test 'quoted text' 'quoted text'
+	&& export done test test then $(pwd)
+x=1 local 'quoted text' && -eu 2>/dev/null x=1 "$1" /usr/bin --verbose x=1
+		grep -eu -eu readonly | awk 2>/dev/null "$1" 2>/dev/null
+local readonly local x=1 grep grep
+	/usr/bin 2>/dev/null cd test printf then test done readonly "$1" x=1 'quoted text'
+2>/dev/null done "$@" 2>/dev/null
+	"$1" echo ${HOME} ${HOME} echo | --verbose /usr/bin done printf done done readonly
+/usr/bin x=1 | then test
+		x=1 ${HOME} done readonly 2>/dev/null grep ${HOME}
+		${HOME} "$@" done $(pwd) cd ${HOME} "$@" && readonly awk awk /usr/bin readonly
+	awk grep x=1 then "$1"
+	awk x=1 printf ${HOME} 'quoted text' 'quoted text'
+	export export x=1 sed export --verbose
+| then cd cd done && -eu export | export ${HOME}
+-eu export sed 2>/dev/null
+	test 2>/dev/null && export
+		--verbose -eu /usr/bin readonly readonly
+	test readonly 'quoted text' grep | printf
+	${HOME} && then cd x=1 printf readonly cd 'quoted text'
+echo --verbose printf 2>/dev/null awk
+export echo export echo /usr/bin $(pwd) --verbose 'quoted text' grep local
+		done done "$1" 2>/dev/null -eu export | printf printf grep test | 'quoted text'
+		--verbose readonly x=1 grep | "$1" readonly done then && readonly local | && 'quoted text'
+	awk sed $(pwd) --verbose 'quoted text' -eu printf sed test export "$@" $(pwd)
+echo echo cd then && sed export test
+"$1" sed "$1" awk export cd "$1" x=1 local
+$(pwd) "$@" readonly "$1" /usr/bin grep 2>/dev/null 2>/dev/null
+done cd grep cd readonly "$@" /usr/bin x=1 readonly ${HOME}
+then done -eu then $(pwd) 'quoted text'
+	export --verbose 'quoted text' "$@" 2>/dev/null test echo $(pwd) $(pwd) readonly
+		done done printf export ${HOME} --verbose
+	done $(pwd) ${HOME} x=1 printf awk then -eu && /usr/bin x=1 x=1 cd grep
+readonly readonly && done -eu "$1" $(pwd) then
+		/usr/bin export awk then
+		awk | local | cd awk echo 'quoted text'
+		"$@" then x=1 -eu /usr/bin $(pwd)
+	grep 2>/dev/null x=1 $(pwd) $(pwd)
+		/usr/bin $(pwd) sed 2>/dev/null cd --verbose local awk cd
+	done grep --verbose test 2>/dev/null -eu done awk | /usr/bin test $(pwd) x=1
+		$(pwd) echo printf awk /usr/bin
+	&& ${HOME} sed grep --verbose ${HOME}
+cd test "$@" "$@" printf /usr/bin sed /usr/bin export export grep -eu
+--verbose export | echo awk && --verbose cd "$1" $(pwd) printf "$@"
+echo local export echo done readonly -eu done readonly
+	export 2>/dev/null printf done "$1" $(pwd) $(pwd) then
+	| cd /usr/bin -eu sed local printf -eu
+then $(pwd) 'quoted text' | done test
+"$1" test done awk -eu 'quoted text' readonly then $(pwd) && grep
+	echo $(pwd) 'quoted text' sed cd /usr/bin /usr/bin readonly
+		awk && x=1 grep 'quoted text' -eu $(pwd) /usr/bin 'quoted text'
+		-eu "$1" grep awk echo $(pwd) && --verbose x=1 2>/dev/null "$1" printf
+$(pwd) test then 'quoted text' 'quoted text' sed --verbose "$@"
+	2>/dev/null | 2>/dev/null | 'quoted text' cd done 'quoted text' /usr/bin awk echo
+		done readonly && grep -eu --verbose && ${HOME} "$@"
+	'quoted text' && then then --verbose "$@" test test "$@" $(pwd) 2>/dev/null
+then readonly | cd cd /usr/bin x=1 printf 2>/dev/null 2>/dev/null echo
+"$1" test echo local printf awk && "$1" x=1 sed then --verbose
+	--verbose x=1 "$1" done done awk | x=1 $(pwd) "$@"
+	readonly 2>/dev/null local readonly cd 2>/dev/null cd "$1" ${HOME}
+"$@" local /usr/bin echo | $(pwd) done done 'quoted text' grep $(pwd) echo then
+	2>/dev/null then /usr/bin
+		then $(pwd) sed done test printf echo done "$@" printf
+		'quoted text' then test cd | "$@" "$1" --verbose readonly && | 'quoted text'
+	then && test grep $(pwd)
+		&& ${HOME} 'quoted text' "$@" $(pwd) then $(pwd) --verbose printf test export
+	printf /usr/bin /usr/bin $(pwd) export && && export printf test "$1"
+	local done export printf export awk sed && readonly local echo readonly readonly
+	then -eu && 2>/dev/null | 2>/dev/null && printf -eu --verbose
+	awk $(pwd) /usr/bin done && $(pwd) awk local grep sed cd local grep | | local
+then "$@" done 2>/dev/null /usr/bin -eu cd then && readonly
+	then test "$1" --verbose
+		&& echo 2>/dev/null sed local ${HOME} printf /usr/bin
+		'quoted text' grep $(pwd) cd x=1 --verbose readonly 2>/dev/null -eu
+		echo --verbose 2>/dev/null --verbose
+x=1 export sed ${HOME} local x=1 sed "$1"
+grep test then && readonly done ${HOME} | local
+	then done local -eu test "$@" sed
+	echo echo export echo --verbose 'quoted text' export
+		then -eu x=1 | | "$1" --verbose then x=1 ${HOME}
+	printf 'quoted text' | 'quoted text' | 'quoted text'
+	${HOME} /usr/bin | --verbose
+	grep 'quoted text' "$@" grep then then printf 2>/dev/null printf
+export awk sed printf test readonly
+$(pwd) -eu then 'quoted text' "$1" ${HOME} | printf export
+		export x=1 test done test -eu cd 'quoted text' awk
+	test "$@" grep printf --verbose test test export --verbose local
+-eu 'quoted text' x=1 done 'quoted text'
+printf test /usr/bin 'quoted text' | test ${HOME} "$1" test done
+	2>/dev/null printf && cd
+${HOME} echo --verbose "$@"
+	sed grep --verbose echo -eu
+"$1" sed test $(pwd) -eu | readonly readonly "$1" awk -eu 2>/dev/null
+	$(pwd) grep local 2>/dev/null
+-eu sed export then && | test then then printf "$1"
+	$(pwd) echo x=1 echo $(pwd)
+		then then -eu "$1" && --verbose | "$1" "$@" "$@" /usr/bin | --verbose --verbose
+	&& grep "$1" && -eu x=1 test 2>/dev/null x=1
+/usr/bin cd printf $(pwd)
+test x=1 done --verbose done --verbose && local /usr/bin --verbose
+		awk then && ${HOME} x=1 awk | | test --verbose local x=1 "$@" -eu
+$(pwd) test 2>/dev/null then /usr/bin awk cd local
+	| 'quoted text' $(pwd) 2>/dev/null
+	local export test echo awk -eu ${HOME} x=1 --verbose
+printf 2>/dev/null grep && "$@"
+	local ${HOME} "$@" 'quoted text' local
+then echo "$1" -eu -eu sed x=1 echo done cd
+		test 2>/dev/null grep $(pwd) /usr/bin awk grep -eu local
+		-eu | sed "$@" sed "$@" done /usr/bin "$@" --verbose | | 'quoted text'
+		readonly "$@" readonly export ${HOME} grep /usr/bin &&
+	-eu echo local done awk done printf /usr/bin /usr/bin then test
+	done local "$@" $(pwd) export awk local 'quoted text' grep
+x=1 2>/dev/null 'quoted text'
+	'quoted text' echo && && "$@" then -eu ${HOME} && "$@" printf
+-eu echo grep local export
+	${HOME} done 2>/dev/null test readonly
+export echo export done then
+	echo grep done test sed readonly
+	export 2>/dev/null $(pwd) grep "$@" printf 'quoted text' awk awk "$1"
+		echo readonly --verbose
+	--verbose then /usr/bin grep export "$1" | /usr/bin then test | x=1 then
+	printf test 'quoted text' sed x=1 local sed test echo | --verbose
+then 'quoted text' $(pwd)
+	awk 2>/dev/null $(pwd) readonly 'quoted text'
+		then "$1" x=1 | local printf test x=1 ${HOME} ${HOME}
+/usr/bin $(pwd) cd -eu "$1"
+echo && echo echo local awk export echo export export && --verbose
+	grep -eu then 'quoted text' done export /usr/bin local echo local /usr/bin
+		x=1 'quoted text' then && local && then then cd | cd echo awk "$@" cd local awk
+	"$1" $(pwd) then awk ${HOME} sed export
+		--verbose local /usr/bin readonly
+		local $(pwd) "$1" printf awk done done test 2>/dev/null && -eu then sed
+	/usr/bin sed x=1 /usr/bin export local printf /usr/bin
+cd --verbose "$1" 2>/dev/null sed grep echo -eu grep 'quoted text'
+"$1" "$@" readonly 'quoted text'
+"$@" "$@" $(pwd) && readonly local --verbose printf grep
+echo /usr/bin local -eu x=1
+		grep 'quoted text' "$@" /usr/bin test done echo printf 'quoted text'
+x=1 x=1 x=1 echo printf $(pwd) "$@" readonly && local done 2>/dev/null
+awk printf ${HOME} grep then "$1" echo
+	x=1 --verbose printf ${HOME} && --verbose
+local grep 'quoted text' sed x=1 cd cd && test cd echo
+	"$@" printf 'quoted text' ${HOME}
+		${HOME} /usr/bin readonly "$@" $(pwd) $(pwd)
+		--verbose echo readonly | "$@" 'quoted text' then cd 2>/dev/null
+readonly --verbose "$1" "$@" done printf export done
+		export then /usr/bin awk test 'quoted text' cd
+	done done --verbose -eu readonly && ${HOME} x=1 && grep
+--verbose cd readonly test "$1" /usr/bin -eu then 2>/dev/null test printf
+"$1" -eu local cd 2>/dev/null cd 2>/dev/null "$1" cd "$@" 2>/dev/null
+		x=1 "$@" "$@" "$@" sed export test sed readonly
+	| local && x=1 2>/dev/null then -eu done local "$@" x=1 sed "$1" "$@"
+		awk --verbose awk 'quoted text' /usr/bin done printf done
+	grep ${HOME} test sed 'quoted text' done export printf then
+		test $(pwd) x=1 /usr/bin "$@" ${HOME} cd awk test local ${HOME} local "$1" "$@"
+		local test awk awk && ${HOME} ${HOME} "$@"
+	then -eu "$1" x=1 cd "$1" local cd 2>/dev/null && grep ${HOME}
+	done $(pwd) 'quoted text' $(pwd) -eu awk --verbose 'quoted text' grep
+/usr/bin "$@" local readonly
+	--verbose local grep done && -eu 2>/dev/null "$1" grep test
+		echo readonly done export test sed grep done
+cd && cd sed "$@" echo
+		/usr/bin "$@" readonly
+		| export echo 'quoted text' --verbose
+	$(pwd) -eu --verbose done "$1" "$1" 'quoted text' "$@" done
+	done done printf | grep "$@" -eu printf --verbose sed 'quoted text'
+		2>/dev/null | then x=1
+		local -eu /usr/bin 'quoted text' 'quoted text' sed grep $(pwd) local "$1" export
+awk cd sed $(pwd) $(pwd) awk | grep && readonly export -eu local
+	"$@" then awk readonly -eu grep then /usr/bin ${HOME} printf "$@" && cd awk
+		sed then cd | echo $(pwd) echo done printf /usr/bin -eu ${HOME} "$1" /usr/bin
+	then "$1" then x=1 export export "$@" "$@" -eu
+	2>/dev/null && -eu -eu | sed sed $(pwd) x=1
+	${HOME} local && 'quoted text' grep printf -eu && 'quoted text'
+		$(pwd) local sed readonly
+		${HOME} printf local printf "$1" cd test echo $(pwd) echo
+		then "$@" local grep | x=1 -eu /usr/bin local done
+		| | export done printf /usr/bin
+	-eu export awk grep x=1
+		-eu done 'quoted text' ${HOME} grep printf
+grep ${HOME} echo cd $(pwd) $(pwd) /usr/bin done done then -eu x=1 printf
+		grep -eu "$1" | && grep
+		awk "$1" ${HOME} then done "$1" 2>/dev/null echo x=1 && awk ${HOME} ${HOME} |
+		-eu awk 2>/dev/null grep cd x=1
+$(pwd) printf readonly "$1" awk --verbose --verbose
+/usr/bin readonly done sed ${HOME} 'quoted text' "$@" grep awk printf export
+sed -eu --verbose | test "$1" | readonly done export | 2>/dev/null test
+'quoted text' x=1 printf && export test 2>/dev/null /usr/bin local local
+		readonly then readonly export -eu readonly 2>/dev/null echo
+	x=1 "$@" printf test /usr/bin /usr/bin done printf "$@" -eu $(pwd) echo
+test /usr/bin /usr/bin --verbose 2>/dev/null "$1"
+x=1 grep done awk --verbose --verbose export test x=1 done cd awk echo "$@" 2>/dev/null
+		awk local x=1 test printf grep | "$1" "$@" readonly x=1 2>/dev/null
+	"$@" ${HOME} -eu sed --verbose
+local 'quoted text' export 'quoted text' grep --verbose echo
+--verbose export echo awk readonly "$1" --verbose done export
+	sed local done -eu cd && && cd 'quoted text' grep echo x=1 local ${HOME} x=1
+	echo && "$@" ${HOME} "$@" cd "$1" grep 2>/dev/null sed
+'quoted text' ${HOME} | /usr/bin done cd
+		export printf "$@" | --verbose --verbose
+	printf /usr/bin then sed -eu | sed 'quoted text' then cd echo
+		$(pwd) x=1 $(pwd) "$1" export x=1 then test awk "$@" then 2>/dev/null then awk --verbose
+		then $(pwd) 'quoted text' -eu sed --verbose local readonly x=1 ${HOME} && printf
+		awk x=1 ${HOME} grep -eu 'quoted text'
+		cd ${HOME} local awk then --verbose awk "$1" 'quoted text' /usr/bin
+done x=1 ${HOME} x=1 cd cd printf then then then ${HOME} "$@" grep | sed
+		${HOME} -eu && readonly sed
+	&& /usr/bin | printf sed printf test ${HOME}
+		sed x=1 local "$@" grep echo x=1 readonly printf awk then $(pwd) && "$@"
+		test "$@" --verbose /usr/bin 'quoted text' printf echo awk cd $(pwd) x=1 ${HOME}
+/usr/bin echo && then echo -eu $(pwd)
+'quoted text' -eu && export /usr/bin
+		printf | readonly cd done printf test /usr/bin
+	export /usr/bin 'quoted text' -eu 2>/dev/null awk /usr/bin
+x=1 'quoted text' $(pwd) 'quoted text' $(pwd) then ${HOME} x=1
+		cd then printf grep ${HOME} done local "$1" test cd readonly
+&& /usr/bin grep /usr/bin export -eu grep ${HOME} "$@" awk "$1" /usr/bin |
+	x=1 -eu test local $(pwd) cd export done $(pwd) sed echo
+--verbose test cd done --verbose ${HOME} | 2>/dev/null
+	test done --verbose "$@" printf && test -eu printf x=1 $(pwd) grep
+		&& grep --verbose readonly -eu "$1" "$@"
+&& /usr/bin --verbose && | awk /usr/bin
+| test sed 2>/dev/null then cd echo cd /usr/bin local echo "$@" /usr/bin
+done done "$@" sed grep test && $(pwd) /usr/bin sed x=1
+grep sed printf $(pwd) x=1 readonly cd echo sed
+	$(pwd) x=1 grep grep 'quoted text' "$@"
+"$@" -eu printf | | $(pwd) "$1" grep /usr/bin /usr/bin readonly sed 2>/dev/null
+		local --verbose 2>/dev/null local printf done export "$1" export then
+2>/dev/null && sed cd 'quoted text'
+		readonly 'quoted text' x=1
+2>/dev/null -eu printf test done "$@" 'quoted text'
+	printf $(pwd) local cd "$1" -eu local "$1" ${HOME} /usr/bin local
+grep done grep 'quoted text' echo --verbose test then cd done
+done -eu printf grep cd sed x=1
+		cd awk /usr/bin "$1" && cd "$@" "$1" | awk x=1 2>/dev/null --verbose
+$(pwd) "$1" && "$@" | "$1"
+		/usr/bin cd awk grep |
+	'quoted text' done export -eu | readonly x=1
+		echo grep readonly export sed /usr/bin
+grep 2>/dev/null && | ${HOME} $(pwd) x=1 sed /usr/bin 2>/dev/null
+	/usr/bin sed ${HOME} readonly cd awk then "$1"
+	$(pwd) /usr/bin /usr/bin cd sed | x=1 'quoted text' ${HOME}
+		readonly export awk 'quoted text'
+sed --verbose echo local x=1 && echo sed cd echo done readonly 2>/dev/null
+	2>/dev/null $(pwd) awk /usr/bin export
+	test ${HOME} awk 2>/dev/null | ${HOME} | 'quoted text'
+'quoted text' -eu awk cd ${HOME} "$@" cd readonly sed "$1" | local
+		printf awk ${HOME} && local x=1 cd && grep "$@" done "$1" local ${HOME}
+"$1" $(pwd) x=1 --verbose "$1" /usr/bin "$1" cd ${HOME}
+		$(pwd) x=1 -eu export then local
+	/usr/bin test echo && local $(pwd) x=1 local "$@" export x=1 grep "$1" 'quoted text'
+	awk "$@" cd cd test | /usr/bin $(pwd) sed 'quoted text'
+	'quoted text' "$1" echo "$1" && grep -eu "$1" "$@" /usr/bin
+		$(pwd) echo /usr/bin printf grep then readonly export "$1" export awk
+	awk sed cd --verbose sed grep && --verbose x=1 grep done
+	readonly -eu --verbose 'quoted text' && awk x=1 'quoted text' echo -eu echo &&
+	${HOME} 2>/dev/null /usr/bin sed then -eu readonly sed 'quoted text' grep $(pwd)
+		--verbose done awk cd $(pwd) $(pwd) -eu $(pwd) echo 2>/dev/null test
+echo done 'quoted text'
+done "$1" ${HOME} printf cd local
+	cd readonly local ${HOME} printf grep |
+x=1 ${HOME} 2>/dev/null /usr/bin --verbose printf
+${HOME} "$1" sed x=1 export printf
+		printf "$@" 'quoted text' awk export --verbose readonly "$1" printf
+${HOME} awk cd x=1 ${HOME} "$1" | -eu export test cd "$1" /usr/bin
+${HOME} then awk | done printf "$1" 2>/dev/null echo
+-eu done x=1 done && ${HOME} readonly done readonly
+	--verbose && grep echo "$@" then /usr/bin grep
+		2>/dev/null -eu 2>/dev/null readonly local /usr/bin
+		--verbose sed echo readonly && grep && export echo "$1" 2>/dev/null $(pwd) done
+		/usr/bin "$@" "$1" test "$@" /usr/bin --verbose "$@" x=1 export
+"$1" /usr/bin "$1" awk done grep grep "$@" 'quoted text' awk sed printf
+	"$1" local x=1 printf sed ${HOME} awk "$1" 'quoted text'
+		x=1 x=1 x=1 echo 2>/dev/null $(pwd) export echo "$1" | grep
+done 'quoted text' awk --verbose && grep /usr/bin
+		${HOME} x=1 "$@" done $(pwd) then test printf -eu grep $(pwd) done
+then $(pwd) | grep $(pwd) -eu printf export "$1"
+		done echo sed awk && sed -eu 2>/dev/null --verbose readonly readonly
+	awk --verbose echo $(pwd) "$@" && "$1" --verbose "$1"
+		${HOME} echo readonly | local $(pwd) readonly
+	test awk 'quoted text' | sed --verbose
+		--verbose sed awk awk -eu $(pwd) awk "$@"
+-eu "$@" export x=1 export printf then "$1" done sed
+	echo "$@" then -eu "$@"
+		&& echo awk | "$@" export /usr/bin export echo
+	--verbose then "$1" printf x=1 test /usr/bin "$1"
+		"$@" 2>/dev/null x=1 ${HOME}
+"$@" local 2>/dev/null --verbose "$1" $(pwd)
+	test export -eu grep sed printf 'quoted text' ${HOME}
+		sed -eu done printf /usr/bin test
+		cd test echo readonly ${HOME} /usr/bin cd x=1 ${HOME} /usr/bin readonly
+		local readonly grep /usr/bin "$@" /usr/bin 'quoted text' export then
+		| -eu readonly /usr/bin 2>/dev/null export 2>/dev/null && "$@" grep /usr/bin
+		-eu --verbose sed done 2>/dev/null cd "$1" test
+		"$@" --verbose $(pwd) export readonly
+		readonly sed export | 2>/dev/null echo grep local export &&
+"$@" cd 2>/dev/null ${HOME}
+		/usr/bin 2>/dev/null $(pwd)
+awk "$1" local grep cd readonly $(pwd) x=1
+	export 'quoted text' 'quoted text'
+	then echo test 2>/dev/null 'quoted text'
+		"$@" awk printf then "$1" /usr/bin grep local
+		awk export 2>/dev/null done test "$@" $(pwd) x=1
+		--verbose echo local --verbose
+		2>/dev/null grep printf /usr/bin
+		2>/dev/null export 2>/dev/null cd ${HOME} x=1 local export
+		2>/dev/null x=1 local
+-eu | -eu local test then && &&
+echo local then --verbose "$1"
+		printf 'quoted text' test echo && readonly test && /usr/bin printf done echo -eu
+2>/dev/null printf "$@" echo local then local
+--verbose test 2>/dev/null export -eu --verbose export | test local export ${HOME}
+	"$@" cd 2>/dev/null 'quoted text' --verbose
+		grep "$@" /usr/bin "$@" echo | sed 2>/dev/null cd cd -eu
+		test | readonly then export local -eu done
+	echo /usr/bin -eu "$@" "$1" test /usr/bin "$1" $(pwd) sed
+		"$@" done echo | then | 2>/dev/null "$@" sed local
+awk then | local --verbose && 2>/dev/null x=1 -eu sed then -eu export cd -eu cd
+		then x=1 x=1 $(pwd) export
+		cd /usr/bin -eu /usr/bin sed $(pwd) --verbose awk -eu export cd sed -eu $(pwd) export
+	"$1" 'quoted text' --verbose sed readonly test
+		echo && | 2>/dev/null printf $(pwd) | --verbose
+	grep x=1 printf cd done test --verbose awk "$@" "$@" awk | local
+	/usr/bin test "$@" grep done sed
+	"$1" export $(pwd) "$1" then awk printf "$@"
+grep then done printf sed done 'quoted text' --verbose && && local
+	test cd 'quoted text' 2>/dev/null echo "$@" /usr/bin local
+	sed $(pwd) "$1" done ${HOME}
+local echo --verbose /usr/bin ${HOME}
+		done "$@" ${HOME} | awk
+test local x=1 "$1" printf
+	$(pwd) awk 'quoted text' /usr/bin printf | -eu then readonly printf
+grep "$@" export x=1 sed cd done then test local | awk export
+sed x=1 awk ${HOME} x=1 "$@" printf grep "$@" cd test
+		2>/dev/null x=1 then readonly printf export then then /usr/bin
+echo printf printf 2>/dev/null readonly then echo done local
+		x=1 sed | && printf awk ${HOME} grep /usr/bin test done awk
+	export ${HOME} echo x=1 cd 2>/dev/null awk --verbose then
+/usr/bin done done "$1" | "$1" cd then
+		2>/dev/null done readonly /usr/bin -eu ${HOME} "$1" --verbose
+		cd x=1 'quoted text' ${HOME} export 'quoted text'
+sed printf local "$@" && "$@" printf
+		test test | "$@" grep cd "$1" "$@" "$@" sed echo "$@" cd readonly ${HOME}
+	export --verbose awk grep
+-eu -eu awk sed done /usr/bin export then && "$@"
+	grep -eu then test then sed test grep printf test printf grep &&
+		echo cd local sed "$@" done
+		sed ${HOME} ${HOME} cd "$1" sed
+		done local $(pwd) /usr/bin /usr/bin export 2>/dev/null --verbose --verbose cd
+echo echo export x=1 sed then ${HOME} readonly 'quoted text' local x=1 readonly
+| local test test readonly 'quoted text' | grep
+	export -eu | $(pwd) /usr/bin done then sed readonly 2>/dev/null then
+| x=1 --verbose -eu grep cd echo | 2>/dev/null test --verbose
+x=1 export 2>/dev/null "$@" x=1 local printf readonly --verbose && $(pwd) 2>/dev/null
+	--verbose "$@" ${HOME} echo x=1 awk awk -eu |
+readonly "$1" 2>/dev/null awk "$@" echo
+	export done printf then --verbose export /usr/bin done awk x=1 test
+	awk test /usr/bin x=1 readonly
+	test sed sed $(pwd) && "$@" sed
+	2>/dev/null | /usr/bin cd readonly |
+echo cd sed --verbose sed local then readonly done 'quoted text' printf --verbose
+--verbose local "$@" x=1 | && "$@" 'quoted text' "$1" "$1" echo done
+		sed | -eu awk export | -eu /usr/bin /usr/bin x=1 && /usr/bin $(pwd) "$1" 'quoted text'
+	2>/dev/null export sed awk ${HOME} | -eu $(pwd) echo export 2>/dev/null then
+grep | awk local "$@" x=1
+local echo | && --verbose cd -eu echo ${HOME} --verbose echo 2>/dev/null
+		'quoted text' sed 'quoted text' export then | then then grep $(pwd) /usr/bin
+	awk $(pwd) export done x=1 printf /usr/bin then && /usr/bin
+	x=1 awk -eu local --verbose export -eu
+	2>/dev/null local "$1" done test $(pwd) local ${HOME}
+		&& x=1 awk | awk grep printf /usr/bin done
+		then echo "$@" then local /usr/bin cd &&
+-eu cd readonly 2>/dev/null cd | readonly echo
+	done x=1 export echo
+		&& done && --verbose --verbose grep && && export ${HOME}
+		then && done then ${HOME} readonly test
+grep sed local export then "$@" echo export grep
+cd /usr/bin sed --verbose awk "$1" "$1" sed export sed
+		/usr/bin "$1" done -eu "$@"
+	then ${HOME} cd readonly "$@" cd local | readonly -eu --verbose printf
+		printf -eu then /usr/bin test cd && printf "$1" done awk $(pwd)
+then readonly sed ${HOME} --verbose && done | then $(pwd) "$@" cd /usr/bin
+	export local 2>/dev/null 'quoted text' grep ${HOME}
+		sed readonly $(pwd) grep grep
+	/usr/bin export -eu cd x=1
+export local echo echo cd ${HOME}
+		grep then 'quoted text' local printf $(pwd) cd
+		done local cd 'quoted text' x=1
+	grep && local printf printf "$1" echo x=1 2>/dev/null test 'quoted text'
+		$(pwd) echo | local "$1" /usr/bin sed -eu readonly
+printf && "$1" printf --verbose export ${HOME} cd "$1" /usr/bin && $(pwd)
+awk "$1" 2>/dev/null "$@" printf then
+	test | sed test 'quoted text' local 'quoted text'
+	local "$1" $(pwd) | ${HOME} then grep local 'quoted text'
+'quoted text' ${HOME} $(pwd) x=1 /usr/bin 2>/dev/null "$1" awk printf 'quoted text'
+	--verbose grep awk 2>/dev/null
+	cd local awk awk $(pwd) then "$@" "$1" test x=1 "$@" test
+		then "$1" export 2>/dev/null readonly sed 2>/dev/null local | cd export
+	| 'quoted text' "$1" test 2>/dev/null --verbose
+	done x=1 local && grep x=1 x=1 2>/dev/null awk export awk export cd "$1" echo
+		echo then done then | ${HOME}
+		"$1" then /usr/bin -eu done test awk done then
+	'quoted text' -eu export ${HOME} then grep && 'quoted text' readonly
+		&& $(pwd) readonly && echo "$@" awk && /usr/bin
+		2>/dev/null cd awk then done local 2>/dev/null sed export x=1 ${HOME}
+readonly readonly -eu 'quoted text' "$1" 'quoted text'
+		"$1" then printf readonly sed local $(pwd) printf "$1"
+	"$@" -eu && printf x=1 test grep -eu echo -eu -eu done echo -eu $(pwd) /usr/bin
+awk && readonly x=1 "$@" 2>/dev/null test readonly
+	2>/dev/null grep 2>/dev/null cd awk test grep "$1" | "$@" then then
+	echo local test local x=1
+	x=1 x=1 -eu "$1" "$@"
+printf readonly /usr/bin sed test sed sed echo readonly printf 'quoted text' local
+		local then "$1" readonly local
+	grep grep grep sed readonly cd printf --verbose test local grep
+		"$1" grep awk && grep local printf /usr/bin x=1 test --verbose
+2>/dev/null grep x=1 readonly "$1" 'quoted text'
+		${HOME} x=1 sed sed -eu
+	export then export readonly
+then "$1" echo echo x=1 printf --verbose 2>/dev/null readonly
+sed --verbose --verbose /usr/bin | | x=1
+${HOME} export 2>/dev/null done --verbose
+		then export done -eu done && && cd grep 'quoted text'
+done x=1 readonly grep "$@" && export
+test readonly ${HOME} 2>/dev/null grep $(pwd) awk "$@" printf
+		${HOME} export x=1 | /usr/bin ${HOME} "$@" done done x=1 cd grep
+| echo 'quoted text' $(pwd) test $(pwd) $(pwd) "$1"
+cd test grep awk cd 'quoted text'
+readonly then "$@" 2>/dev/null test echo test $(pwd) export then
+readonly awk -eu test "$@" printf -eu x=1 awk
+		/usr/bin --verbose $(pwd) --verbose
+	echo /usr/bin done "$@" test printf /usr/bin awk x=1 ${HOME} |
+-eu ${HOME} "$@" ${HOME} $(pwd) 2>/dev/null "$@" cd | /usr/bin 2>/dev/null -eu
+		local "$@" && $(pwd) $(pwd) test "$1" 2>/dev/null ${HOME} ${HOME} | $(pwd)
+		echo "$1" -eu then "$1" /usr/bin "$@" printf $(pwd) -eu -eu readonly readonly
+x=1 | printf $(pwd) -eu "$@" "$@" "$@" awk echo ${HOME}
+grep test printf ${HOME} | printf 2>/dev/null
+sed then /usr/bin test then then
+--verbose ${HOME} x=1 sed 2>/dev/null
+		'quoted text' echo awk --verbose
+		sed export sed export printf x=1 "$@" /usr/bin
+		export /usr/bin cd 'quoted text' done /usr/bin printf
+${HOME} /usr/bin ${HOME} $(pwd) printf readonly grep -eu export && awk x=1
+		"$@" 'quoted text' readonly
+/usr/bin done /usr/bin /usr/bin local readonly test printf readonly -eu &&
+	export 2>/dev/null /usr/bin cd 2>/dev/null
+		/usr/bin grep "$@" printf 2>/dev/null sed /usr/bin x=1 --verbose 'quoted text'
+	local done "$1" readonly /usr/bin "$1" $(pwd) &&
+		awk test $(pwd) 2>/dev/null local done --verbose
+		printf awk --verbose --verbose done sed readonly
+	sed /usr/bin export "$1"
+	"$@" cd "$1" awk grep x=1 printf done "$1" x=1 then test 'quoted text' printf
+	$(pwd) echo | ${HOME} /usr/bin awk echo local awk ${HOME} 2>/dev/null && printf
+		'quoted text' export && "$@" local x=1 done local
+local export local test printf | 'quoted text' "$1" awk local
+	2>/dev/null awk export "$@" cd export /usr/bin && ${HOME} sed |
+/usr/bin --verbose "$1"
+		readonly then --verbose export
+	| 2>/dev/null export x=1 && 'quoted text' grep test | grep 'quoted text' --verbose
+/usr/bin export -eu echo | done -eu grep
+x=1 sed then sed 'quoted text' then sed
+	export printf local x=1 echo 2>/dev/null
+		--verbose cd local done 2>/dev/null ${HOME} done grep
+		| $(pwd) -eu | "$1" "$@"
+		--verbose awk "$@" echo /usr/bin ${HOME}
+	local | done printf awk | local 2>/dev/null
+		test export local ${HOME} cd readonly 'quoted text'
+		then local sed && | printf $(pwd) readonly
+readonly ${HOME} done x=1 "$1" && && ${HOME} $(pwd)
+	"$1" | /usr/bin then /usr/bin then grep 2>/dev/null -eu ${HOME} sed x=1 then
+	${HOME} ${HOME} ${HOME} | awk -eu && echo 2>/dev/null
+	--verbose $(pwd) && grep echo /usr/bin ${HOME} --verbose then
+		local done "$1" local local local --verbose cd
+		cd test ${HOME} sed then 2>/dev/null 'quoted text' 'quoted text' -eu export then
+		${HOME} test "$1" grep 'quoted text' awk $(pwd) && ${HOME} "$1" "$1" "$@"
+--verbose export -eu && echo ${HOME} && "$1" | x=1
+	$(pwd) cd printf --verbose ${HOME} --verbose ${HOME} awk 'quoted text' "$1" cd
+	printf $(pwd) export | -eu cd printf readonly test
+/usr/bin | 2>/dev/null 2>/dev/null grep done done export sed
+	${HOME} readonly awk "$1" done
+	local /usr/bin local x=1 "$@" echo export readonly readonly "$@" echo
+		2>/dev/null 'quoted text' test 'quoted text'
+	$(pwd) echo printf ${HOME} awk export
+		readonly export grep sed && 'quoted text'
+${HOME} local local "$@" "$1"
+2>/dev/null "$@" then x=1 cd grep export awk 'quoted text' "$1"
+		/usr/bin "$1" readonly
+x=1 export /usr/bin $(pwd) ${HOME} grep sed export local
+${HOME} printf awk readonly x=1 local echo "$@" -eu $(pwd) && printf awk export
+export then $(pwd) awk grep sed
+${HOME} then readonly && awk -eu then local ${HOME} &&
+then /usr/bin local test local readonly awk local "$@" local ${HOME} | 'quoted text'
+	$(pwd) export then x=1 "$@" grep export -eu then "$1" ${HOME} then local
+		printf grep grep then
+		local $(pwd) | "$1" done
+cd 'quoted text' --verbose awk local grep sed sed 'quoted text'
+		| awk 'quoted text' "$@" awk
+		cd "$@" test $(pwd) export /usr/bin 2>/dev/null ${HOME} local 2>/dev/null
+	echo awk awk awk /usr/bin cd test then cd sed x=1 --verbose $(pwd) cd sed
+"$@" then && -eu "$@" -eu && printf awk awk echo cd x=1 done
+| ${HOME} readonly test sed done
+	test echo x=1 2>/dev/null $(pwd) echo /usr/bin /usr/bin 'quoted text'
+-eu sed local printf
+		local readonly | 2>/dev/null
+printf /usr/bin local /usr/bin --verbose sed cd grep /usr/bin test sed -eu
+	local | sed local 2>/dev/null "$@" ${HOME} 2>/dev/null test test "$1"
+	sed grep x=1 "$1" done echo awk $(pwd) | echo export "$1" && local -eu --verbose
+	cd sed awk test && test echo sed 2>/dev/null
+grep x=1 && readonly ${HOME} -eu -eu 2>/dev/null sed
+		grep /usr/bin then 'quoted text'
+	&& && --verbose then 'quoted text'
+	cd export test then echo -eu ${HOME}
+		--verbose awk done then local x=1 /usr/bin printf x=1 --verbose
+		--verbose done /usr/bin 'quoted text' local test ${HOME}
+sed then then $(pwd) local then "$1" awk grep cd 2>/dev/null 2>/dev/null
+		awk sed "$1" readonly "$1" done --verbose 2>/dev/null && done cd echo /usr/bin
+		echo readonly printf readonly && echo 'quoted text' 2>/dev/null 2>/dev/null
+		x=1 | && printf ${HOME} cd "$1" test echo | local local cd "$@"
+	--verbose readonly local ${HOME} 'quoted text' && x=1 /usr/bin
+sed && -eu "$@" ${HOME} $(pwd) | -eu done cd --verbose
+awk test --verbose -eu readonly grep 2>/dev/null $(pwd)
+		cd grep export /usr/bin export awk 'quoted text' $(pwd) $(pwd) printf
+	printf done cd sed 'quoted text' && cd cd 'quoted text' |
+	cd awk "$@" test sed cd --verbose sed -eu 'quoted text' grep "$1"
+	done cd test /usr/bin "$1" local $(pwd)
+x=1 then sed cd export sed sed grep /usr/bin then && 2>/dev/null
+awk 2>/dev/null -eu --verbose sed cd test --verbose --verbose 2>/dev/null "$@"
+	cd grep readonly 'quoted text' printf export "$1" 2>/dev/null cd
+	2>/dev/null grep $(pwd) then
+		grep local x=1 2>/dev/null test | test readonly export grep
+		x=1 cd 2>/dev/null $(pwd) then --verbose readonly cd cd $(pwd) -eu printf $(pwd)
+		"$@" echo readonly cd test grep awk ${HOME} export test awk awk
+	${HOME} printf x=1 printf grep
+readonly "$@" /usr/bin done x=1 cd test printf done
+-eu && --verbose /usr/bin printf $(pwd) | ${HOME} && then awk ${HOME} &&
+-eu test "$1" then readonly ${HOME} $(pwd) $(pwd) ${HOME}
+		'quoted text' --verbose cd "$1" done "$@" local --verbose
+	$(pwd) | sed awk "$@" local ${HOME} --verbose $(pwd) grep
+sed "$@" "$@" "$1" $(pwd) grep 2>/dev/null then
+-eu cd ${HOME} local $(pwd) echo "$@" /usr/bin /usr/bin
+		--verbose 2>/dev/null "$1" ${HOME} echo export
+		"$@" "$@" 2>/dev/null x=1 local /usr/bin -eu printf "$@" awk
+printf /usr/bin 'quoted text' awk test /usr/bin /usr/bin 'quoted text' ${HOME}
+	cd grep cd grep x=1 $(pwd) "$1" 'quoted text'
+sed echo grep /usr/bin --verbose printf local -eu "$1" sed
+&& echo sed ${HOME} /usr/bin awk grep readonly /usr/bin 'quoted text' then
+	&& local grep cd | printf
+		/usr/bin -eu ${HOME} test awk test && x=1
+	printf then cd 'quoted text'
+then 'quoted text' echo test $(pwd) && done readonly | ${HOME}
+		--verbose 'quoted text' 2>/dev/null done $(pwd) ${HOME} sed &&
+		awk echo && x=1 'quoted text' sed echo local local grep
+	done "$1" --verbose $(pwd) | 2>/dev/null test done local printf
+'quoted text' x=1 --verbose /usr/bin "$1" | done | export readonly test 'quoted text'
+		/usr/bin /usr/bin done && then "$@"
+		2>/dev/null printf then local export done grep
+export "$1" done cd then readonly 2>/dev/null x=1 "$@" awk echo "$1" cd && 2>/dev/null
+		-eu awk local local "$1" cd awk done
+| local 2>/dev/null "$1" /usr/bin local
+		&& 2>/dev/null local -eu "$1" awk test $(pwd) sed cd "$1" /usr/bin
+grep "$@" then grep --verbose printf local
+"$1" | $(pwd) test $(pwd) readonly echo -eu
+&& sed 2>/dev/null && | "$@" then cd test "$@" && $(pwd) $(pwd) &&
+2>/dev/null done printf ${HOME} x=1
+"$1" local readonly ${HOME} export then ${HOME} awk then 'quoted text' "$1" cd
+		/usr/bin cd sed ${HOME} done | | ${HOME}
+	-eu readonly cd -eu && echo echo readonly
+	$(pwd) "$1" done export echo --verbose
+| awk -eu "$1" -eu 2>/dev/null sed then $(pwd) test | cd | --verbose
+		local x=1 grep -eu sed grep x=1 && printf done "$1" grep $(pwd) readonly
+		printf --verbose 'quoted text' 'quoted text' cd -eu /usr/bin
+test --verbose awk awk --verbose readonly && 'quoted text' 2>/dev/null -eu done
+		2>/dev/null /usr/bin /usr/bin grep "$@" export 2>/dev/null
+		x=1 sed /usr/bin && done ${HOME} cd cd /usr/bin
+		x=1 'quoted text' && test && && cd --verbose
+x=1 sed cd 2>/dev/null test $(pwd) "$@" x=1 local grep /usr/bin echo -eu
+	/usr/bin export local --verbose 'quoted text'
+	readonly sed $(pwd) cd x=1 readonly ${HOME} 2>/dev/null
+&& done grep readonly 2>/dev/null
+		cd local "$1" test printf readonly printf awk export
+	done local /usr/bin printf readonly test --verbose
+'quoted text' test "$@" grep then done /usr/bin echo x=1
+$(pwd) readonly /usr/bin "$1" -eu 'quoted text'
+		done ${HOME} export grep
+test -eu printf sed 'quoted text'
+cd 'quoted text' -eu /usr/bin
+local ${HOME} /usr/bin cd readonly cd 2>/dev/null done && "$@" && awk
+	"$1" | export done --verbose ${HOME}
+		grep sed printf "$1" test | done ${HOME} 'quoted text'
+	export then x=1 && printf then awk printf then x=1 $(pwd) readonly "$1" /usr/bin
+		${HOME} 'quoted text' | x=1
+		${HOME} export test | grep 2>/dev/null
+| -eu grep export && "$@" awk
+	awk sed && grep 'quoted text' done sed /usr/bin $(pwd) x=1 done 'quoted text'
+--verbose grep 'quoted text' printf |
+		echo echo grep $(pwd) /usr/bin
+		export done then 'quoted text' 'quoted text' 2>/dev/null export
+		readonly done 'quoted text' test cd cd -eu printf export done test | | cd
+	--verbose echo -eu grep "$@" "$@" --verbose && /usr/bin echo
+		readonly 2>/dev/null "$1" x=1 x=1 test $(pwd) export "$1"
+	"$@" x=1 | /usr/bin "$@" 2>/dev/null test
+		2>/dev/null sed echo --verbose done cd /usr/bin 'quoted text' printf
+| printf echo --verbose local sed awk awk 2>/dev/null
+x=1 'quoted text' sed "$@"
+local | $(pwd) | local 'quoted text' 2>/dev/null sed sed "$1" local
+	x=1 readonly --verbose "$@" test /usr/bin
+		'quoted text' 'quoted text' test readonly
+-eu "$@" "$1" echo test $(pwd)
+	| local --verbose readonly local -eu cd ${HOME} sed echo export readonly 'quoted text'
+awk export "$1" -eu export
+"$@" "$1" sed | 2>/dev/null 'quoted text' export grep
+	-eu test done --verbose 'quoted text' grep echo readonly
+		export export -eu && --verbose readonly /usr/bin | -eu 'quoted text' x=1 x=1
+readonly export printf "$@" -eu "$@" 'quoted text' awk "$1" echo --verbose x=1
+		test -eu awk $(pwd) echo local /usr/bin $(pwd)
+done printf then local grep readonly | awk awk grep cd | "$@" test done printf
+	-eu printf --verbose "$1" sed x=1 ${HOME} -eu cd && "$@" readonly && then --verbose
+	$(pwd) -eu -eu ${HOME} && | test
+export printf sed export done echo x=1 -eu sed 2>/dev/null -eu "$@" x=1 grep &&
+		export x=1 done 'quoted text' && local | $(pwd) ${HOME} 2>/dev/null
+		sed awk ${HOME} -eu export
+test grep 'quoted text' && 'quoted text' "$1"
+	grep /usr/bin sed local -eu local x=1 'quoted text' readonly
+		cd echo local "$@" then done x=1 x=1 $(pwd) test "$1" then | readonly
+printf ${HOME} done grep $(pwd) test 2>/dev/null --verbose x=1 grep then cd -eu
+test done readonly 'quoted text' printf awk "$@" sed cd
+done | --verbose test $(pwd) done
+	export --verbose ${HOME} /usr/bin "$@" "$1" export awk
+		--verbose -eu ${HOME}
+	test local 'quoted text' readonly grep --verbose local grep 'quoted text' done
+then printf readonly then printf && sed -eu
+	readonly grep | /usr/bin -eu done x=1 export export awk export awk 2>/dev/null
+		x=1 cd x=1 awk local --verbose readonly ${HOME}
+	"$@" 2>/dev/null /usr/bin --verbose "$1" $(pwd) ${HOME} x=1 | done | sed
+	$(pwd) readonly -eu && "$@" grep "$@" sed "$1" printf local $(pwd) $(pwd) echo ${HOME}
+		/usr/bin && x=1 --verbose /usr/bin -eu "$1" $(pwd)
+		test echo 2>/dev/null local grep echo echo
+	'quoted text' && test --verbose x=1 grep export sed && export
+	2>/dev/null && $(pwd) cd
+&& cd sed "$1" printf cd echo $(pwd) awk then awk
+	cd /usr/bin ${HOME} ${HOME} readonly printf local then local awk local cd
+		"$1" sed awk 2>/dev/null
+then -eu done x=1 test test | x=1 printf /usr/bin && local cd grep
+cd grep awk sed then | echo -eu $(pwd) --verbose x=1 echo then
+	2>/dev/null cd 'quoted text' -eu echo done
+	--verbose sed export && | export 2>/dev/null cd readonly echo
+		-eu local && grep sed "$@" then 2>/dev/null
+then grep -eu test 2>/dev/null awk sed
+		2>/dev/null test | done test && "$@" test
+	"$@" /usr/bin test "$1" /usr/bin export "$1"
+grep "$@" --verbose sed
+		x=1 test x=1 printf "$@" export "$@" ${HOME} 2>/dev/null 2>/dev/null then
+	x=1 /usr/bin cd sed test "$1" cd grep test done then && -eu && && echo $(pwd) export
+	readonly x=1 x=1 x=1 echo then grep
+done sed | grep && 2>/dev/null
+awk test awk | && 'quoted text' done test readonly sed local
+		cd readonly x=1 printf "$@" sed x=1 "$1" 'quoted text'
+| export "$1" "$1" | sed "$1"
+"$@" echo export export awk cd 'quoted text'
+done echo echo "$@" echo ${HOME} grep sed --verbose
+	'quoted text' && && sed awk -eu done 2>/dev/null then local local x=1 'quoted text'
+		cd "$1" readonly local 'quoted text'
+echo printf 2>/dev/null /usr/bin
+	readonly | "$@" local | echo sed
+	${HOME} echo 2>/dev/null /usr/bin done /usr/bin export "$@" ${HOME} x=1
+	cd --verbose /usr/bin
+&& --verbose awk local awk then "$1" test
+echo local /usr/bin test test sed -eu && grep --verbose
+'quoted text' export local cd 'quoted text' /usr/bin done export --verbose
+		| x=1 | "$@" cd | printf -eu grep "$1"
+	grep | "$@" readonly $(pwd) readonly sed x=1 'quoted text'
+	then readonly 2>/dev/null then --verbose readonly ${HOME}
+		--verbose then local sed
+$(pwd) --verbose printf awk /usr/bin 'quoted text' $(pwd) test /usr/bin test --verbose
+	--verbose grep sed test then --verbose readonly awk
+done done then echo |
+grep test "$@" "$1" then local /usr/bin grep 2>/dev/null "$@" done
+	2>/dev/null readonly "$1" readonly -eu ${HOME} | "$1" test
+test grep ${HOME} "$@" test cd
+	done grep -eu && && &&
+sed awk --verbose done readonly $(pwd) 2>/dev/null 'quoted text' then -eu
+	export sed "$1" 2>/dev/null | 'quoted text'
+	"$@" test echo "$1" && printf --verbose awk | printf then
+x=1 /usr/bin ${HOME} printf ${HOME} test x=1 echo awk test cd "$@" "$@" 2>/dev/null
+	&& done awk && local -eu x=1 echo $(pwd) && readonly grep x=1 test local --verbose
+$(pwd) printf local test readonly local /usr/bin cd awk echo test "$@" done /usr/bin
+	| --verbose --verbose "$@" ${HOME}
+&& done awk grep --verbose export
+'quoted text' x=1 export ${HOME} "$@" awk 2>/dev/null /usr/bin cd -eu export
+	readonly test awk /usr/bin test
+	&& cd readonly x=1 | cd local
+printf printf $(pwd) grep
+	"$1" 'quoted text' /usr/bin "$1" sed 2>/dev/null export /usr/bin test awk 'quoted text'
+		x=1 echo 'quoted text' done --verbose
+		-eu | readonly $(pwd) --verbose 2>/dev/null && && /usr/bin cd cd ${HOME} $(pwd)
+		cd export --verbose "$@" 'quoted text' readonly test
+awk then echo 2>/dev/null cd | && awk 'quoted text' /usr/bin
+		export grep done echo echo /usr/bin "$@"
+readonly /usr/bin echo 'quoted text' /usr/bin $(pwd)
+| printf "$1" printf grep "$@" -eu local 2>/dev/null 'quoted text'
+	then grep -eu then test then printf /usr/bin then 'quoted text'
+done "$1" 'quoted text' test export sed grep --verbose 2>/dev/null awk
+	x=1 printf printf cd /usr/bin test awk cd 2>/dev/null awk
+printf printf -eu x=1 then ${HOME} ${HOME} ${HOME}
+	2>/dev/null "$@" && x=1
+	2>/dev/null x=1 echo ${HOME}
+then && readonly local readonly 'quoted text' /usr/bin export printf $(pwd)
+readonly "$1" --verbose test "$@" awk cd 2>/dev/null -eu
+&& local sed $(pwd) then && -eu x=1
+&& awk "$@" "$@" ${HOME} && "$@" x=1 -eu 'quoted text'
+	test $(pwd) && --verbose grep test
+		"$1" /usr/bin done --verbose --verbose | --verbose printf printf
+		grep "$1" 2>/dev/null -eu
+done local echo 'quoted text'
+		"$1" grep --verbose 2>/dev/null
+$(pwd) test "$@" ${HOME} "$@" done x=1 | --verbose && 2>/dev/null export
+	&& -eu "$@" local echo echo /usr/bin /usr/bin
+	${HOME} 'quoted text' awk printf awk done 2>/dev/null /usr/bin "$@" awk local
+	done /usr/bin then awk local "$1" grep done -eu then $(pwd) /usr/bin export
+	"$1" echo then echo && && done 2>/dev/null 2>/dev/null "$1" local -eu then printf
+awk echo --verbose cd && sed printf printf
+	${HOME} cd done awk sed | local
+sed echo then local done -eu done 2>/dev/null awk
+		--verbose -eu x=1 echo "$1" ${HOME} "$1" --verbose 'quoted text' 2>/dev/null
+	awk readonly && x=1 "$@" echo ${HOME} "$@" echo then
+		local $(pwd) sed done cd export grep
+	export /usr/bin awk | -eu | x=1 $(pwd) && cd 2>/dev/null
+	printf grep /usr/bin readonly 'quoted text' test done 2>/dev/null
+		x=1 x=1 x=1 grep done export
+/usr/bin ${HOME} readonly then x=1 "$1" /usr/bin
+	sed 'quoted text' ${HOME} && done
+		cd cd then local cd local
+		-eu done | grep 2>/dev/null
+	--verbose test 'quoted text' readonly readonly
+cd local | awk "$@" printf /usr/bin -eu readonly ${HOME} "$@"
+$(pwd) $(pwd) --verbose readonly echo awk local && $(pwd)
+echo 'quoted text' -eu echo echo sed then --verbose x=1 && export
+		echo && && grep /usr/bin 'quoted text' -eu done then awk "$@" --verbose
+		2>/dev/null grep local --verbose $(pwd) -eu printf --verbose sed $(pwd)
+		-eu echo grep $(pwd) export grep readonly export /usr/bin ${HOME} x=1 ${HOME}
+done x=1 local awk -eu done readonly readonly cd 'quoted text'
+cd export "$1" test cd /usr/bin "$1" readonly 'quoted text' grep
+"$@" done /usr/bin awk grep printf && /usr/bin
+export -eu awk -eu && readonly
+	readonly 'quoted text' -eu grep
+	readonly done grep "$@" --verbose printf | x=1 | 'quoted text' 'quoted text'
+	| /usr/bin 'quoted text' && "$@" test /usr/bin | /usr/bin
+		"$@" "$@" export && echo awk $(pwd) 'quoted text' grep ${HOME} 'quoted text'
+x=1 ${HOME} cd && 2>/dev/null export printf export grep cd done --verbose test
+	$(pwd) export -eu then "$1" && printf test | export printf -eu readonly then
+test -eu --verbose 'quoted text' echo x=1 then ${HOME}
+		x=1 cd export && export echo -eu | export "$@" 'quoted text' grep
+		| sed sed done x=1 /usr/bin --verbose --verbose local --verbose readonly
+	| $(pwd) --verbose cd readonly -eu export | -eu export "$@" --verbose test
+done && && 2>/dev/null 2>/dev/null 2>/dev/null sed local 'quoted text'
+	-eu 'quoted text' -eu done ${HOME} then 2>/dev/null ${HOME}
+then sed --verbose | then x=1 && local --verbose printf 'quoted text'
+		$(pwd) sed "$1" | printf test
+		$(pwd) $(pwd) grep readonly x=1 | /usr/bin
+export -eu test 2>/dev/null 2>/dev/null
+	-eu export local awk | readonly grep export 'quoted text' | "$1" $(pwd)
+cd test "$@" local local local
+	export -eu "$1" printf x=1 grep printf awk --verbose
+| local grep readonly cd cd export -eu awk /usr/bin
+	-eu | sed --verbose | 'quoted text' sed && "$@" printf echo awk grep
+	'quoted text' awk awk export "$@"
+	readonly echo x=1 local x=1 done 2>/dev/null sed 'quoted text'
+"$@" local export local cd
+		&& grep 2>/dev/null "$@" "$@" printf cd
+		local $(pwd) awk grep &&
+		local "$1" grep done export done test ${HOME} ${HOME} "$1"
+		-eu export --verbose done -eu
+	-eu $(pwd) ${HOME} | awk && --verbose echo && sed "$@" $(pwd) |
+		sed "$1" sed grep x=1 x=1 grep echo local echo
+	&& printf $(pwd) && "$@"
+	test $(pwd) awk && -eu echo ${HOME} grep | printf
+		readonly local /usr/bin &&
+		x=1 ${HOME} sed then 'quoted text' local printf awk
+	-eu done -eu -eu echo then $(pwd)
+		cd grep 'quoted text' /usr/bin awk
+/usr/bin ${HOME} grep then grep ${HOME} $(pwd) done --verbose
+		cd sed echo x=1 awk export done grep
+		export "$@" | "$@" grep then grep printf ${HOME}
+	export -eu grep test test cd echo $(pwd) local then printf done export awk
+		--verbose --verbose readonly ${HOME} done
+		export ${HOME} awk done && 'quoted text' cd 2>/dev/null
+	local 'quoted text' 2>/dev/null
+		sed $(pwd) /usr/bin --verbose cd grep --verbose | "$1" /usr/bin printf
+export sed export echo cd
+		done && 2>/dev/null echo $(pwd)
+		echo sed export && "$@" "$@" && && -eu --verbose then /usr/bin printf local
+--verbose | "$@" echo awk | x=1 $(pwd) echo /usr/bin export grep local cd --verbose
+	awk local printf && 2>/dev/null x=1 2>/dev/null
+	--verbose x=1 ${HOME} grep cd grep /usr/bin | export
+awk | awk "$@" -eu "$@"
+done printf echo sed 2>/dev/null /usr/bin
+		${HOME} local $(pwd) readonly readonly test grep --verbose echo done
+	'quoted text' cd --verbose 2>/dev/null local ${HOME} grep &&
+		'quoted text' readonly echo ${HOME} echo && local "$@"
+	$(pwd) x=1 && ${HOME} sed echo test readonly ${HOME}
+	cd done 'quoted text'
+		then -eu $(pwd) grep sed "$@" cd x=1 grep "$1" --verbose
+		grep 2>/dev/null done "$1" --verbose
+	echo awk awk /usr/bin grep ${HOME} x=1 | -eu cd | ${HOME} 2>/dev/null
+		x=1 local printf --verbose $(pwd) "$@" 2>/dev/null && 2>/dev/null
+"$1" sed awk export done readonly printf ${HOME} echo
+	$(pwd) sed && local /usr/bin local "$@" 'quoted text'
+	${HOME} done 2>/dev/null /usr/bin grep | export ${HOME}
+		sed /usr/bin | echo awk then /usr/bin "$@" sed cd export local
+	sed --verbose awk 2>/dev/null export
+	sed local awk | readonly
+grep 'quoted text' /usr/bin readonly awk printf local && 2>/dev/null
+	export local printf ${HOME}
+		-eu awk awk && x=1 | local
+	$(pwd) | "$@" && $(pwd) "$1" --verbose -eu 2>/dev/null ${HOME} then &&
+	/usr/bin test grep then
+	${HOME} local -eu ${HOME} 2>/dev/null /usr/bin "$1" 2>/dev/null
+		--verbose awk && readonly cd ${HOME} ${HOME}
+	/usr/bin ${HOME} readonly --verbose ${HOME}
+	'quoted text' 2>/dev/null x=1 $(pwd) 2>/dev/null then 'quoted text'
+"$1" --verbose /usr/bin && local then export export -eu readonly x=1 && "$@"
+	export /usr/bin then 2>/dev/null 'quoted text'
+		--verbose $(pwd) $(pwd)
+	$(pwd) "$1" /usr/bin
+	--verbose export test --verbose
+	cd 'quoted text' local -eu
+		'quoted text' 'quoted text' grep 'quoted text'
+done "$@" cd ${HOME} printf done --verbose sed "$@" echo then /usr/bin "$@"
+printf ${HOME} grep readonly test local "$@" "$1" local &&
+"$1" echo "$1" x=1 2>/dev/null awk "$1" $(pwd) --verbose echo
+--verbose local | grep grep && test awk awk | grep
+	| then 2>/dev/null -eu | cd
+		"$1" 'quoted text' | then local ${HOME} awk
+	then ${HOME} cd readonly 'quoted text' "$1" && -eu
+	echo $(pwd) export x=1 | -eu "$@" then readonly "$1" $(pwd) printf
+		2>/dev/null x=1 done -eu --verbose done ${HOME} ${HOME} printf x=1 2>/dev/null
+	"$@" /usr/bin printf local $(pwd) && echo 'quoted text' "$@" "$1" "$@"
+grep local -eu "$@" test grep 'quoted text' grep export /usr/bin x=1
+		"$@" --verbose then 'quoted text' "$@" printf sed cd ${HOME} export
+	"$@" cd echo -eu local sed grep then --verbose sed sed -eu "$1" $(pwd) then
+		'quoted text' done echo | local
+2>/dev/null sed ${HOME} -eu 2>/dev/null test x=1 done 2>/dev/null "$1" local
+${HOME} 'quoted text' cd echo x=1 test | printf cd readonly echo ${HOME}
+		"$1" export /usr/bin cd then
+		test -eu -eu -eu echo
+		"$@" local test cd x=1 cd then export
+		awk | 'quoted text' done "$@" | 2>/dev/null ${HOME} &&
+	local x=1 then 'quoted text' grep cd echo ${HOME} "$1" export cd 'quoted text'
+printf "$1" x=1 "$@" sed --verbose -eu && /usr/bin && sed done then
+sed $(pwd) x=1 2>/dev/null echo readonly && printf /usr/bin local 'quoted text'
+		sed sed then readonly grep awk sed /usr/bin
+	${HOME} echo 'quoted text' sed awk test test
+		local 'quoted text' "$@" /usr/bin
+		--verbose local done /usr/bin ${HOME} done
+grep 2>/dev/null /usr/bin echo /usr/bin $(pwd) printf
+		then && grep x=1 /usr/bin x=1 sed cd --verbose then local && export local 2>/dev/null
+$(pwd) local export printf
+	${HOME} test local echo export export && "$@" grep "$1" grep 'quoted text'
+	sed x=1 'quoted text' test printf
+	readonly printf --verbose 'quoted text' cd grep x=1 /usr/bin
+		"$1" && x=1 $(pwd) done printf x=1 "$1" printf export -eu sed ${HOME} 'quoted text'
+	| local "$@" | --verbose readonly readonly cd grep --verbose
+	readonly then sed 2>/dev/null ${HOME} printf
+	"$@" export echo cd $(pwd) done /usr/bin "$1" 2>/dev/null printf | readonly
+	/usr/bin "$@" local "$1" export done then -eu local ${HOME} readonly printf
+		"$@" printf then printf ${HOME} done 2>/dev/null grep local printf
+		"$@" && sed awk 2>/dev/null 'quoted text' x=1 local | local sed sed 2>/dev/null
+"$1" 'quoted text' -eu export -eu "$1" /usr/bin grep export done | |
+		printf /usr/bin export echo $(pwd) ${HOME} -eu 'quoted text' grep printf "$@"
+	done done | && then 2>/dev/null done
+	2>/dev/null x=1 2>/dev/null ${HOME} ${HOME} | printf x=1
+		test -eu -eu echo readonly local $(pwd) echo --verbose readonly done
+	$(pwd) x=1 && "$@" export then "$1" sed 2>/dev/null
+/usr/bin "$@" $(pwd) x=1 x=1 | $(pwd) done
+		| $(pwd) ${HOME} readonly "$1" done
+test x=1 'quoted text' export x=1 printf echo --verbose
+		'quoted text' grep 'quoted text' export 2>/dev/null local printf ${HOME} export
+x=1 local | awk printf test done x=1 export && grep
+export export grep $(pwd) cd cd export "$@" test --verbose
+		echo readonly echo -eu grep readonly then done $(pwd) readonly test export 'quoted text'
+echo awk local 2>/dev/null
+"$1" printf local 'quoted text' cd -eu test
+		&& $(pwd) awk "$1" then awk echo "$1" then ${HOME} done -eu
+	awk --verbose echo 2>/dev/null -eu awk x=1 x=1 awk echo /usr/bin $(pwd) 2>/dev/null
+		grep grep echo x=1 x=1 local "$@" awk grep then $(pwd)
+	printf cd printf printf $(pwd)
+		--verbose -eu echo | $(pwd) 'quoted text'
+		test ${HOME} 'quoted text' echo 'quoted text'
+		&& --verbose ${HOME} echo then
+		&& readonly then export grep
+	$(pwd) ${HOME} grep 'quoted text' test export -eu
+		"$1" then cd /usr/bin | | cd /usr/bin $(pwd)
+		| --verbose echo test test $(pwd)
+		${HOME} | local test done readonly awk sed | awk | --verbose x=1 grep 2>/dev/null
+$(pwd) test 2>/dev/null export grep 'quoted text'
+sed /usr/bin ${HOME} 'quoted text'
+		&& | test readonly x=1 "$1" 2>/dev/null -eu --verbose
+"$@" done $(pwd) awk -eu export "$@" -eu && x=1 x=1
+	printf /usr/bin ${HOME} export 'quoted text' -eu sed
+	--verbose "$@" && readonly 2>/dev/null 2>/dev/null
+cd "$1" then | printf 2>/dev/null export printf 2>/dev/null
+	| test cd then awk local
+	"$1" readonly ${HOME} cd local readonly --verbose readonly
+x=1 test grep test awk -eu awk
+		--verbose && export printf x=1 --verbose
+	"$1" awk export && --verbose x=1 | x=1 'quoted text' "$1" --verbose
+		/usr/bin export && "$@" grep && /usr/bin "$@" grep cd "$@" /usr/bin -eu "$1"
+local /usr/bin -eu --verbose
+	&& cd /usr/bin 'quoted text'
+	test then /usr/bin 'quoted text' -eu 'quoted text' done awk -eu $(pwd) readonly
+${HOME} grep grep printf
+	awk echo /usr/bin local 2>/dev/null printf done "$@" printf
+	printf done /usr/bin readonly
+grep local export /usr/bin
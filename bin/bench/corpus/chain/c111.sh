@@ -0,0 +1,2001 @@
+	readonly cd done x=1 "$1" /usr/bin grep
+		"$@" | $(pwd) export
+	then echo test 2>/dev/null --verbose /usr/bin $(pwd) -eu
+/usr/bin $(pwd) done | awk 'quoted text' readonly x=1 ${HOME} readonly
+	"$@" 2>/dev/null $(pwd) 'quoted text'
+		grep --verbose echo readonly test grep
+readonly local local 'quoted text'
+grep "$1" --verbose cd && "$@" readonly export then awk local
+		--verbose awk && awk 'quoted text' local printf done ${HOME} sed
+	$(pwd) done sed then printf "$@" local sed done x=1
+sed $(pwd) x=1 -eu local 'quoted text' -eu grep
+"$@" 'quoted text' $(pwd)
+	/usr/bin -eu printf "$@" done $(pwd) local --verbose sed export grep -eu
+	--verbose /usr/bin /usr/bin && then then ${HOME}
+		local "$1" $(pwd) done grep "$1" grep grep | ${HOME} 2>/dev/null
+	2>/dev/null x=1 2>/dev/null /usr/bin $(pwd) x=1 readonly -eu cd
+${HOME} | 'quoted text' test x=1 | && | 2>/dev/null
+		cd sed local local | $(pwd) test local /usr/bin export /usr/bin
+sed local printf -eu 'quoted text' "$1" grep && -eu 'quoted text'
+	readonly --verbose -eu local ${HOME} "$@" $(pwd) printf
+cd x=1 awk ${HOME} cd --verbose sed --verbose ${HOME} echo ${HOME}
+sed x=1 /usr/bin | cd | --verbose
+cd "$@" export /usr/bin cd readonly export /usr/bin
+	export done cd && printf -eu echo ${HOME} readonly 2>/dev/null
+	sed readonly ${HOME} && test "$@" test
+	then 2>/dev/null x=1 awk export
+awk export export cd -eu cd "$1" 'quoted text' readonly
+	| && done echo 'quoted text' then cd --verbose
+test "$1" local awk printf "$1" -eu /usr/bin /usr/bin x=1 printf export
+		&& done test 2>/dev/null echo sed sed sed
+		echo readonly sed echo then
+	local then test cd printf
+	cd done awk 2>/dev/null cd
+	"$@" 'quoted text' grep
+	x=1 echo then export then $(pwd) "$@" printf readonly done && && local test
+		&& echo $(pwd) cd then 2>/dev/null printf && "$@" printf
+	'quoted text' printf "$@" awk test x=1 x=1 x=1 done && echo x=1
+"$@" awk $(pwd) /usr/bin then "$1" /usr/bin -eu done awk cd 2>/dev/null
+sed printf 'quoted text' done && printf cd x=1 ${HOME} --verbose readonly
+local test printf printf -eu -eu x=1
+&& | -eu printf echo local sed 2>/dev/null local x=1 then cd printf
+	-eu done ${HOME} $(pwd) | 'quoted text' export local "$1" -eu readonly
+		"$@" sed echo -eu x=1 grep 'quoted text' 2>/dev/null /usr/bin echo -eu test
+		-eu -eu ${HOME} test -eu test then x=1 export "$@" awk printf
+/usr/bin done -eu sed --verbose echo sed -eu 2>/dev/null readonly 2>/dev/null
+		/usr/bin test --verbose
+		test grep "$1" test && readonly sed /usr/bin awk /usr/bin
+		| cd local $(pwd) $(pwd) export then cd awk /usr/bin x=1
+		'quoted text' echo x=1 && printf
+		then 'quoted text' $(pwd) readonly -eu "$@" local
+	"$1" | local "$@" | done sed export cd readonly
+		awk --verbose | | "$1" && sed cd readonly /usr/bin
+x=1 | grep "$@" local printf "$1" --verbose 'quoted text'
+	2>/dev/null then printf local readonly echo
+grep cd x=1 printf $(pwd) "$1" 2>/dev/null then cd "$1" then sed
+cd awk cd "$@" -eu x=1 2>/dev/null ${HOME} x=1 then printf sed echo
+"$@" /usr/bin then export done awk then && 2>/dev/null "$1" ${HOME} awk echo
+	| 'quoted text' cd --verbose
+$(pwd) && cd local test | $(pwd) | x=1 local --verbose cd echo
+-eu grep $(pwd) readonly done $(pwd)
+then -eu -eu export grep readonly $(pwd) /usr/bin
+grep readonly grep grep local done sed export echo
+		local local | 'quoted text' | echo awk -eu /usr/bin grep
+		done cd | /usr/bin printf grep /usr/bin 2>/dev/null awk 'quoted text'
+		awk 'quoted text' export local test -eu | "$@"
+	"$@" --verbose test "$@" 2>/dev/null "$1" sed -eu
+grep | grep grep readonly readonly
+-eu --verbose | 'quoted text'
+&& $(pwd) | test $(pwd) 2>/dev/null | cd "$@" then 2>/dev/null "$@" done "$@" "$@"
+$(pwd) awk x=1 'quoted text'
+	printf | "$@" printf local
+		$(pwd) --verbose ${HOME} /usr/bin awk ${HOME} "$1"
+		printf done /usr/bin printf echo export "$@" | $(pwd) ${HOME} local --verbose
+readonly --verbose awk 'quoted text' cd ${HOME} ${HOME} done
+$(pwd) -eu export awk sed --verbose $(pwd) --verbose "$1" --verbose | 2>/dev/null
+cd readonly local readonly $(pwd) 'quoted text' test test "$@" grep test 2>/dev/null
+/usr/bin grep printf cd && $(pwd) echo 'quoted text'
+	awk local grep export /usr/bin ${HOME} x=1 "$@" printf sed x=1 sed "$@"
+$(pwd) -eu ${HOME} readonly then /usr/bin /usr/bin 2>/dev/null
+		2>/dev/null echo test grep "$@" &&
+	"$@" grep export | --verbose -eu local printf /usr/bin awk "$@" $(pwd) cd /usr/bin
+		local cd awk local then "$1" x=1 then -eu export 2>/dev/null &&
+	x=1 echo && && "$1" $(pwd)
+		sed local x=1 export done echo local readonly done 2>/dev/null ${HOME} then
+	test ${HOME} cd 'quoted text' done --verbose then "$@" && test done printf test
+		-eu printf /usr/bin $(pwd) readonly
+		done then ${HOME} --verbose | "$1" "$1" printf
+2>/dev/null export printf done grep "$@" test && test test ${HOME} awk
+done awk export "$@" done 'quoted text' &&
+		$(pwd) ${HOME} | awk --verbose grep
+local printf "$1" --verbose test test readonly
+printf local -eu "$1" | "$1" awk "$@" printf cd cd x=1
+		test "$1" $(pwd) /usr/bin cd cd /usr/bin /usr/bin && && 2>/dev/null
+$(pwd) ${HOME} x=1 local local done awk 'quoted text' then done awk "$@" x=1
+	grep sed "$@" awk local test ${HOME} test && "$1"
+test "$@" && sed "$@" echo /usr/bin && grep /usr/bin -eu cd sed
+		done --verbose /usr/bin ${HOME} grep | then | awk x=1 /usr/bin grep ${HOME}
+	-eu "$1" grep awk done
+		"$@" 'quoted text' -eu readonly --verbose
+	echo then printf "$1" awk awk
+export echo 'quoted text' x=1 awk test "$1" 'quoted text' && | local cd | awk
+	'quoted text' --verbose x=1
+"$@" $(pwd) x=1 --verbose 'quoted text'
+		export -eu $(pwd) cd | "$@" local readonly awk
+	grep echo local echo readonly echo
+	echo && done "$1" && "$1" 'quoted text' printf 2>/dev/null export
+sed export ${HOME} -eu | $(pwd) 2>/dev/null
+	| echo printf 'quoted text'
+		| then done sed echo export
+--verbose --verbose 2>/dev/null && | sed | 'quoted text'
+	/usr/bin sed -eu printf $(pwd) cd local
+	cd --verbose done awk 'quoted text' | "$@" $(pwd) && printf awk sed "$1" local
+		$(pwd) 'quoted text' ${HOME} && then printf
+		"$1" && /usr/bin "$@" ${HOME} $(pwd) ${HOME} then 'quoted text' grep
+		readonly awk awk "$@" echo x=1 $(pwd) 'quoted text' grep x=1 cd cd done done
+	done export 'quoted text' 2>/dev/null done | ${HOME} && -eu local --verbose
+| --verbose sed grep && 2>/dev/null --verbose sed && ${HOME} "$1" local
+		local /usr/bin --verbose test --verbose "$@" printf
+	"$@" $(pwd) test done 2>/dev/null --verbose then | x=1 awk local export awk
+test --verbose x=1 export ${HOME} -eu
+	| $(pwd) test -eu sed && readonly -eu "$1" grep then ${HOME} sed 2>/dev/null
+	"$1" $(pwd) -eu then "$@" then test
+		cd readonly "$1" cd sed local cd
+	then 'quoted text' local "$1" done printf &&
+		-eu && cd && x=1 printf grep grep
+		export awk sed sed printf $(pwd) "$@"
+	done ${HOME} /usr/bin "$@"
+		$(pwd) "$1" 'quoted text' echo -eu export then awk cd "$1" 'quoted text'
+		2>/dev/null done 'quoted text' 2>/dev/null x=1 grep
+export "$@" "$@" grep local --verbose "$@"
+		&& printf then 2>/dev/null echo -eu
+		then then 'quoted text' "$1" grep 2>/dev/null "$@" printf 'quoted text'
+		then 2>/dev/null 'quoted text' grep then local /usr/bin grep ${HOME} grep printf
+--verbose awk then 2>/dev/null x=1 then 'quoted text'
+	${HOME} done --verbose sed --verbose && readonly x=1 printf --verbose
+grep && local | local cd export x=1 then
+		'quoted text' then test --verbose grep 'quoted text' 2>/dev/null readonly
+then local local export then sed "$1" sed
+		"$1" awk local then printf --verbose x=1 $(pwd) x=1 local done
+x=1 echo x=1 --verbose && "$@" readonly $(pwd) readonly
+		test grep $(pwd) 'quoted text' echo done "$1" ${HOME}
+$(pwd) export $(pwd) printf local sed && /usr/bin then && 'quoted text'
+/usr/bin | $(pwd) -eu $(pwd) echo /usr/bin $(pwd) local ${HOME}
+	echo 2>/dev/null 'quoted text' test local | -eu printf
+		"$1" ${HOME} sed sed ${HOME} /usr/bin /usr/bin echo cd
+	test "$1" export sed
+	grep local 2>/dev/null 2>/dev/null echo "$1" done && --verbose ${HOME} 2>/dev/null
+"$1" --verbose -eu printf sed sed awk test printf x=1 'quoted text' echo -eu --verbose
+	sed 'quoted text' "$1" export | 'quoted text' then
+		"$@" /usr/bin test --verbose cd awk grep /usr/bin
+		$(pwd) readonly sed "$@" -eu done awk awk test echo
+		printf awk done /usr/bin x=1 "$@" then printf sed /usr/bin printf
+		-eu /usr/bin "$1" && echo then
+	awk x=1 readonly ${HOME} "$@" "$1" test /usr/bin test awk 2>/dev/null
+		-eu 2>/dev/null local -eu
+		local then test local ${HOME} export done
+		test x=1 then x=1 && local "$1" sed sed local x=1 grep x=1 x=1 'quoted text'
+	done ${HOME} then echo /usr/bin done "$@" echo local
+$(pwd) done grep && sed /usr/bin sed printf done test ${HOME} /usr/bin
+'quoted text' sed /usr/bin printf sed export
+	grep local printf $(pwd) cd "$@" cd echo /usr/bin
+	--verbose local | ${HOME} then readonly export
+'quoted text' && ${HOME} cd $(pwd) $(pwd) printf
+		&& && grep readonly 'quoted text' readonly export cd "$1" && sed $(pwd)
+readonly "$1" "$1" 2>/dev/null export --verbose --verbose echo then 2>/dev/null
+	cd $(pwd) "$@" readonly sed then export 'quoted text'
+		local /usr/bin $(pwd) 'quoted text' "$@" awk cd then --verbose
+/usr/bin "$1" readonly done $(pwd) export x=1 grep export --verbose export printf
+export test sed "$@" then /usr/bin ${HOME} && "$1"
+	/usr/bin "$1" && awk $(pwd) done 'quoted text' sed 'quoted text' "$@" 2>/dev/null
+		$(pwd) 2>/dev/null awk done x=1 echo awk -eu readonly --verbose
+	--verbose "$1" ${HOME} readonly export
+	awk printf done --verbose ${HOME} readonly export ${HOME} "$1" export
+		/usr/bin $(pwd) -eu done 'quoted text'
+		awk cd && --verbose then done export then $(pwd) printf ${HOME} echo grep
+	cd ${HOME} printf readonly $(pwd) cd "$1" readonly x=1 'quoted text'
+		sed x=1 readonly test
+	/usr/bin -eu export -eu export echo 2>/dev/null 2>/dev/null /usr/bin
+grep x=1 $(pwd) "$@" echo grep | export
+${HOME} --verbose then -eu export test local echo | $(pwd) 'quoted text' test
+	echo "$@" echo 'quoted text' ${HOME} test
+echo then | readonly readonly sed printf ${HOME} sed then ${HOME}
+	printf | then "$@" awk done "$1" && cd done -eu sed
+	awk "$@" test "$1" | printf test
+local "$@" echo done local grep
+		test 2>/dev/null then $(pwd) done test ${HOME}
+export x=1 && awk awk x=1 /usr/bin test printf
+		x=1 'quoted text' x=1 |
+		&& 'quoted text' && done test grep grep -eu 2>/dev/null $(pwd)
+	--verbose "$1" cd readonly
+export && $(pwd) export && grep grep echo && export cd local ${HOME} sed &&
+export grep 2>/dev/null then local
+done echo readonly && --verbose test echo
+	awk ${HOME} 'quoted text' "$@" awk done then sed 'quoted text'
+	done grep done | | ${HOME} $(pwd) x=1 /usr/bin -eu --verbose
+x=1 "$1" "$1" done $(pwd) awk cd sed echo printf x=1 sed echo /usr/bin printf x=1
+		"$@" | --verbose awk then
+/usr/bin | echo test && "$@" test "$1" | x=1 && $(pwd) export
+		/usr/bin cd test "$1" cd 'quoted text'
+then ${HOME} /usr/bin 'quoted text'
+'quoted text' ${HOME} echo printf /usr/bin /usr/bin
+		then $(pwd) cd && done echo 2>/dev/null
+		/usr/bin --verbose -eu cd then sed sed awk grep 'quoted text'
+/usr/bin local --verbose then printf "$@" export export local | $(pwd) 2>/dev/null
+sed /usr/bin echo awk -eu sed /usr/bin ${HOME} readonly done export
+	sed done ${HOME} ${HOME}
+		test "$1" readonly --verbose done awk echo done 2>/dev/null
+		${HOME} cd test /usr/bin -eu export 'quoted text' done printf then $(pwd)
+		x=1 "$1" | | printf export x=1 /usr/bin /usr/bin x=1 --verbose "$@" /usr/bin
+		x=1 local local local awk "$1" "$@" 'quoted text' 2>/dev/null && cd | "$@"
+	echo 'quoted text' then local cd 'quoted text'
+		echo 2>/dev/null readonly printf local cd then awk
+		awk -eu | "$@" done test --verbose --verbose
+		printf /usr/bin export -eu done
+readonly then printf /usr/bin && 'quoted text'
+	'quoted text' local -eu printf && ${HOME} done printf 2>/dev/null
+printf ${HOME} sed x=1 echo done
+	| 'quoted text' export | export x=1 then cd $(pwd)
+		/usr/bin awk /usr/bin 'quoted text' grep | -eu ${HOME} test done then $(pwd)
+		--verbose export && export /usr/bin x=1 cd local && awk printf
+$(pwd) then cd grep $(pwd) sed sed local sed sed
+		"$@" "$@" -eu | $(pwd) printf readonly
+		then ${HOME} then done 'quoted text' --verbose
+		| printf export sed $(pwd) echo --verbose $(pwd) x=1
+		'quoted text' 2>/dev/null test test local
+		readonly ${HOME} && "$1" then awk echo
+readonly printf --verbose grep cd awk --verbose local
+	sed | done then -eu printf | | $(pwd) export then ${HOME} local ${HOME}
+		readonly "$@" printf local
+	export && cd local "$1" 'quoted text' ${HOME} 'quoted text' 2>/dev/null
+		/usr/bin then $(pwd) done local --verbose | grep --verbose printf sed test awk
+		2>/dev/null readonly test awk awk && /usr/bin echo done test done 2>/dev/null
+	"$1" ${HOME} export sed sed local export cd printf
+then cd readonly && -eu
+test local ${HOME} readonly done
+${HOME} "$1" awk -eu -eu && 'quoted text' echo -eu x=1 printf -eu x=1 awk
+	grep /usr/bin "$@" grep $(pwd) awk x=1
+done --verbose then $(pwd) "$@" "$@" printf ${HOME} "$@" local ${HOME}
+	${HOME} $(pwd) sed awk 2>/dev/null | awk sed "$@" grep readonly
+	sed grep export sed echo "$1" -eu "$@" -eu && ${HOME} 2>/dev/null /usr/bin
+		&& test test printf done && readonly ${HOME} 'quoted text'
+	readonly --verbose 2>/dev/null export 2>/dev/null 'quoted text' $(pwd) /usr/bin
+		echo 2>/dev/null -eu
+		-eu "$@" grep grep echo sed
+		readonly -eu 'quoted text' sed -eu 'quoted text' 'quoted text'
+		'quoted text' awk $(pwd) cd echo
+echo --verbose printf then $(pwd)
+	sed then sed sed sed export test
+local | test sed --verbose export --verbose test --verbose grep $(pwd)
+	test x=1 cd x=1 && done "$@" "$1" "$@" x=1 done echo echo local && && $(pwd) sed
+		echo /usr/bin export then "$1" test readonly sed 2>/dev/null readonly
+		/usr/bin 2>/dev/null "$@" | export 2>/dev/null export echo local grep awk grep
+		cd && echo echo local -eu export 2>/dev/null $(pwd)
+		2>/dev/null awk local echo grep x=1 ${HOME} local echo sed ${HOME} printf x=1
+	2>/dev/null readonly then local -eu ${HOME}
+	readonly sed "$1" local printf 'quoted text' done 'quoted text'
+		"$1" local -eu cd && test export x=1 printf done ${HOME} 2>/dev/null grep |
+	-eu cd && $(pwd) readonly 2>/dev/null "$@" cd test echo "$1" x=1 readonly x=1
+x=1 local $(pwd) then --verbose test
+awk test test 'quoted text'
+	$(pwd) ${HOME} | done x=1 readonly /usr/bin "$1" printf then test printf grep
+		awk 'quoted text' sed
+readonly | --verbose local | done printf
+cd | export then $(pwd) done done cd ${HOME} $(pwd) $(pwd)
+test then /usr/bin 2>/dev/null awk local && && printf | sed grep test sed -eu
+"$1" ${HOME} done grep printf export
+		grep then grep ${HOME} cd | ${HOME} $(pwd) printf /usr/bin local ${HOME}
+		printf then grep --verbose -eu $(pwd) local "$@" grep 'quoted text'
+${HOME} x=1 grep local cd readonly awk echo printf x=1 cd &&
+		test --verbose printf 2>/dev/null /usr/bin
+		local export awk && && test x=1 then grep ${HOME} "$@" x=1 x=1 echo | done "$@"
+		/usr/bin sed grep local readonly | echo export && test "$1" | test
+	| cd echo export sed echo --verbose then printf | "$1" echo && -eu local export
+&& cd 2>/dev/null awk test printf
+	awk printf ${HOME} echo "$@" ${HOME}
+	local export export | && printf ${HOME} -eu ${HOME} "$@"
+		readonly /usr/bin printf then && | local awk readonly
+	/usr/bin -eu readonly sed readonly export | 2>/dev/null 'quoted text'
+		readonly test test -eu
+		&& export grep then -eu echo
+		grep | test 2>/dev/null 'quoted text' x=1 grep "$1"
+	awk "$1" /usr/bin ${HOME} grep -eu && awk cd local
+		x=1 2>/dev/null "$@" --verbose echo then && | -eu
+	done /usr/bin echo then && -eu
+		${HOME} test "$@" then grep sed echo "$1" /usr/bin then /usr/bin &&
+		${HOME} ${HOME} 'quoted text' export $(pwd) sed |
+| echo readonly "$1" $(pwd) --verbose
+		-eu readonly ${HOME} done $(pwd) readonly "$@"
+		local | ${HOME} $(pwd) grep local local "$@" cd && readonly
+sed cd ${HOME} grep export local then ${HOME} export
+	&& test test 2>/dev/null $(pwd) then test awk "$@" x=1 ${HOME} 'quoted text' test
+		done echo cd | done readonly 2>/dev/null done
+'quoted text' 2>/dev/null
+		echo grep $(pwd) awk 2>/dev/null then -eu "$1" "$@" -eu readonly awk local x=1 then
+	export local 2>/dev/null $(pwd) readonly | test ${HOME} awk printf
+test ${HOME} -eu printf && test printf $(pwd) echo awk
+	x=1 local 2>/dev/null done export ${HOME} local x=1 sed $(pwd) ${HOME} "$@"
+		| 'quoted text' "$@" cd "$1" then
+| printf printf 2>/dev/null ${HOME}
+	awk "$@" && /usr/bin && readonly --verbose "$@" awk then
+export local 2>/dev/null printf local "$1" grep then printf --verbose
+		then -eu export -eu grep echo "$@"
+2>/dev/null printf sed -eu export
+'quoted text' | grep x=1 local test done
+	export "$@" 'quoted text' test | && 'quoted text' done $(pwd) readonly
+grep done 'quoted text' local sed awk sed /usr/bin |
+export readonly 2>/dev/null 'quoted text'
+	x=1 readonly "$1" 2>/dev/null && ${HOME} -eu readonly
+/usr/bin then $(pwd) -eu -eu -eu test sed local x=1 then grep -eu && --verbose
+	${HOME} 2>/dev/null echo | "$1" cd grep ${HOME}
+	| grep test readonly ${HOME}
+printf echo awk printf | echo local sed --verbose export
+		echo -eu grep | grep grep readonly --verbose local export | export echo
+| x=1 readonly | readonly readonly export
+${HOME} done $(pwd) cd x=1 /usr/bin 2>/dev/null
+export 2>/dev/null 'quoted text' --verbose then
+		"$@" grep x=1 "$@" "$1" echo $(pwd) printf 2>/dev/null printf
+		"$@" ${HOME} readonly then awk grep 2>/dev/null x=1 awk test done "$@" test
+	&& echo echo $(pwd) ${HOME} --verbose
+		/usr/bin && && local 'quoted text' ${HOME} "$1" ${HOME} grep $(pwd)
+"$1" echo ${HOME} -eu echo done readonly $(pwd) grep 2>/dev/null
+		printf done done grep /usr/bin awk "$@" && 2>/dev/null cd then $(pwd) ${HOME}
+	${HOME} done $(pwd) export ${HOME} x=1 test readonly --verbose
+		${HOME} export ${HOME} && grep export
+	sed readonly export 'quoted text' printf 2>/dev/null
+		| cd readonly cd cd cd printf --verbose "$1" local awk ${HOME} then "$@" --verbose
+		-eu && grep "$@" "$@" 'quoted text' "$1" awk && 'quoted text' local "$@"
+	$(pwd) x=1 && --verbose 'quoted text' | cd test -eu grep "$@"
+'quoted text' readonly done grep 2>/dev/null --verbose "$1" then echo
+x=1 done -eu --verbose readonly && echo -eu $(pwd)
+	test "$1" 2>/dev/null x=1 ${HOME} 2>/dev/null /usr/bin then local 'quoted text'
+/usr/bin "$1" done awk echo 'quoted text' readonly
+grep ${HOME} local && done printf -eu 2>/dev/null x=1 done
+	--verbose | --verbose awk $(pwd)
+		${HOME} --verbose cd 'quoted text' --verbose echo | "$@" /usr/bin awk then
+echo readonly "$@" 'quoted text' local
+		echo -eu 2>/dev/null "$1" sed echo
+	printf "$1" cd ${HOME} export printf readonly "$1" 2>/dev/null -eu test
+| readonly /usr/bin test export then ${HOME} --verbose
+	&& x=1 2>/dev/null ${HOME} grep test readonly local readonly
+		echo printf readonly | export | "$1" ${HOME} "$1" then "$@" 2>/dev/null
+	-eu -eu done sed $(pwd) x=1 local "$@" then -eu echo then local x=1 readonly
+awk /usr/bin cd && /usr/bin sed "$1" 2>/dev/null echo --verbose | 'quoted text'
+	&& --verbose "$1" "$@" -eu readonly local x=1 /usr/bin | $(pwd) local
+		done $(pwd) local test $(pwd) then 2>/dev/null test done readonly then test
+done echo done grep done "$1" "$@" awk grep printf readonly grep 'quoted text'
+cd awk $(pwd) 2>/dev/null readonly sed x=1 printf sed then $(pwd) 'quoted text'
+-eu done sed then echo sed && local "$1" export ${HOME}
+		| grep 'quoted text' echo | ${HOME} grep export then
+	cd "$1" local test 2>/dev/null /usr/bin done
+then then | | export ${HOME} x=1 $(pwd) --verbose -eu grep then done -eu
+test -eu done grep 2>/dev/null
+$(pwd) -eu $(pwd) "$@" "$@" "$1"
+		"$@" "$1" then test | sed awk
+	| --verbose done 'quoted text' -eu /usr/bin local sed sed -eu readonly
+printf 2>/dev/null sed test
+	&& echo -eu grep "$@" 'quoted text'
+echo x=1 'quoted text' --verbose local grep awk sed export 'quoted text'
+&& echo -eu sed "$@" 'quoted text' && $(pwd) --verbose "$@" x=1 --verbose 'quoted text'
+	cd done $(pwd) && ${HOME} /usr/bin test | | cd done grep /usr/bin printf "$@"
+"$1" printf grep "$@" "$1" grep grep
+	grep "$1" test -eu ${HOME} -eu export local "$@" "$@"
+	then then /usr/bin x=1 $(pwd) | readonly cd --verbose
+	sed --verbose test readonly cd sed
+'quoted text' 'quoted text'
+	done && x=1 /usr/bin 'quoted text' | export $(pwd) local test then done x=1 export
+	"$@" grep cd -eu test export export x=1 /usr/bin /usr/bin
+local "$@" --verbose -eu awk cd "$@" 2>/dev/null
+export /usr/bin /usr/bin && -eu local 2>/dev/null
+${HOME} x=1 && export awk grep /usr/bin awk
+	printf cd done 2>/dev/null --verbose /usr/bin 2>/dev/null
+		--verbose done --verbose local test "$@" $(pwd) local readonly
+		"$@" /usr/bin "$@" --verbose
+		-eu 'quoted text' -eu --verbose done
+&& cd x=1 x=1 test readonly |
+	readonly done ${HOME} "$1" -eu "$1" local "$1" awk ${HOME} export 'quoted text'
+${HOME} export sed sed
+		--verbose "$@" awk printf then "$1" local
+	printf "$@" local cd x=1 $(pwd)
+	export test echo sed local test then cd local "$1" done $(pwd) -eu /usr/bin
+| cd /usr/bin "$1" "$1"
+	sed $(pwd) grep done 'quoted text' test "$1" --verbose cd "$1" ${HOME} export
+	local readonly done grep echo $(pwd) 'quoted text' readonly
+readonly awk export -eu local echo x=1 "$@" ${HOME}
+	$(pwd) x=1 then && | /usr/bin grep --verbose test
+		printf ${HOME} "$@" $(pwd) cd 2>/dev/null echo done ${HOME} awk done "$@" grep
+| readonly $(pwd) export then then
+grep 2>/dev/null -eu awk 'quoted text'
+echo test 'quoted text' x=1 2>/dev/null done local && echo printf awk $(pwd)
+	export -eu printf grep | "$1" readonly sed
+$(pwd) "$@" awk 2>/dev/null 'quoted text'
+&& --verbose -eu export grep $(pwd)
+	then | 'quoted text' export 'quoted text'
+		x=1 cd | $(pwd) ${HOME} ${HOME}
+	"$@" "$1" grep | --verbose ${HOME} grep then grep $(pwd) export --verbose
+	test readonly local printf ${HOME} 2>/dev/null
+	printf awk -eu cd 'quoted text' test | ${HOME} test local x=1 sed ${HOME}
+	'quoted text' x=1 --verbose readonly x=1 test sed $(pwd) "$1"
+		$(pwd) cd sed printf local ${HOME} $(pwd) awk
+		sed "$1" $(pwd) 'quoted text' sed 'quoted text'
+		2>/dev/null export "$@" readonly then "$@" --verbose
+awk $(pwd) sed then /usr/bin 2>/dev/null
+'quoted text' local awk echo "$@" 2>/dev/null printf && $(pwd) echo awk readonly
+awk 2>/dev/null "$1" readonly sed sed readonly ${HOME}
+"$1" local grep /usr/bin --verbose x=1 $(pwd) test then ${HOME}
+	&& /usr/bin awk 'quoted text' readonly test readonly "$1" $(pwd) printf
+		sed -eu /usr/bin readonly "$1" cd done x=1 | 2>/dev/null 2>/dev/null
+		"$@" -eu awk grep -eu done "$1" done -eu x=1 echo --verbose ${HOME}
+local grep "$@" test printf --verbose "$1" echo done ${HOME}
+		| | grep local 'quoted text' --verbose
+		${HOME} "$@" echo $(pwd) grep export readonly ${HOME}
+	awk && grep x=1 --verbose
+	printf printf then -eu cd done "$1" done printf --verbose printf local
+	x=1 grep /usr/bin awk
+		test cd "$1" printf export awk "$1"
+		| --verbose awk $(pwd) -eu printf "$@" grep local test 'quoted text'
+		&& local local && "$@" 'quoted text' cd export
+		$(pwd) "$1" printf x=1 | grep
+		test sed cd test x=1 'quoted text' | $(pwd)
+		echo 'quoted text' x=1 x=1 done | $(pwd) export --verbose
+		'quoted text' $(pwd) x=1 'quoted text'
+		local x=1 x=1 cd echo 'quoted text'
+		then export && && printf done sed echo readonly readonly awk ${HOME}
+	2>/dev/null /usr/bin grep printf 'quoted text' sed && --verbose
+	/usr/bin "$1" sed sed -eu ${HOME} &&
+		awk x=1 /usr/bin echo then echo "$1"
+		${HOME} local $(pwd) then ${HOME} $(pwd) | | grep done
+		done export awk $(pwd) then readonly printf "$1" cd
+x=1 "$@" then --verbose local | local /usr/bin local "$@"
+x=1 && test --verbose -eu 'quoted text' awk -eu -eu grep sed test -eu local "$@"
+	--verbose -eu -eu /usr/bin 2>/dev/null 'quoted text' 2>/dev/null -eu "$@" then
+${HOME} test 2>/dev/null test /usr/bin awk x=1 "$1"
+		x=1 $(pwd) then "$1" then echo echo
+export --verbose x=1 x=1 printf readonly ${HOME} |
+	readonly readonly 'quoted text' /usr/bin local ${HOME} awk readonly | then
+		/usr/bin 'quoted text' -eu grep ${HOME}
+		${HOME} x=1 printf grep awk && && 'quoted text' -eu 'quoted text'
+	printf readonly --verbose awk "$@" grep -eu && | grep done export
+	--verbose && cd then awk cd echo $(pwd) export readonly "$@" local
+		echo then "$@" test "$@" x=1 readonly readonly 'quoted text' awk readonly
+export "$1" 'quoted text' "$1" cd
+then && $(pwd) local -eu printf x=1 then 'quoted text' --verbose
+	test sed 2>/dev/null awk export local -eu "$@"
+grep done sed echo done
+readonly -eu -eu sed printf local
+	${HOME} sed && x=1 $(pwd)
+		/usr/bin grep readonly export ${HOME} echo /usr/bin
+grep awk "$1" done 2>/dev/null cd echo --verbose grep done printf
+	test "$1" local | cd test grep then then x=1 grep ${HOME} cd "$1" 2>/dev/null x=1
+	local ${HOME} --verbose "$@" local && local | --verbose $(pwd) printf
+		then then && && && echo && printf $(pwd)
+		x=1 test "$@" then 'quoted text'
+		"$@" /usr/bin printf printf ${HOME}
+-eu local cd export --verbose done cd -eu printf
+	/usr/bin $(pwd) 'quoted text' --verbose "$@" export
+		echo $(pwd) awk 'quoted text' 'quoted text' done sed printf
+	--verbose grep done "$1" test done && echo cd test sed /usr/bin |
+	test | awk test done x=1 'quoted text'
+${HOME} /usr/bin test awk "$@" $(pwd) printf echo awk -eu
+/usr/bin readonly test -eu local grep then "$@" export /usr/bin "$1" sed /usr/bin
+done printf printf sed
+	test 'quoted text' "$@" cd test export 2>/dev/null awk
+'quoted text' 'quoted text' test
+		awk x=1 | 2>/dev/null done && local && /usr/bin done export /usr/bin && &&
+		printf then 2>/dev/null done ${HOME} 2>/dev/null cd /usr/bin x=1 awk export
+		echo echo "$@" readonly $(pwd)
+'quoted text' /usr/bin cd /usr/bin cd | then ${HOME} /usr/bin --verbose
+${HOME} "$1" echo 'quoted text'
+	${HOME} local local test export x=1 awk "$1" grep -eu export
+	test cd 'quoted text' cd awk "$1" -eu readonly && &&
+local grep ${HOME} test
+	readonly test printf --verbose
+		cd grep done $(pwd) printf sed grep awk then done -eu --verbose
+done awk /usr/bin -eu done awk
+	--verbose echo "$1" printf
+grep 'quoted text' && /usr/bin | export /usr/bin x=1 ${HOME}
+		$(pwd) && export echo "$@" test cd cd 2>/dev/null ${HOME} --verbose
+local grep grep sed $(pwd) printf 2>/dev/null test printf printf "$@" test test
+	"$1" 2>/dev/null "$1" 2>/dev/null export "$1"
+"$@" 'quoted text' /usr/bin --verbose
+x=1 ${HOME} 'quoted text' /usr/bin echo "$1" grep && --verbose local grep printf
+echo echo local done readonly cd local --verbose 'quoted text' printf
+local && 2>/dev/null local --verbose done ${HOME}
+x=1 ${HOME} sed $(pwd) done -eu echo && /usr/bin --verbose
+	cd local --verbose printf echo ${HOME} then $(pwd) readonly
+	-eu $(pwd) "$1" --verbose
+	sed "$@" readonly | "$@" 2>/dev/null local 2>/dev/null then echo
+		grep test done cd -eu /usr/bin grep /usr/bin && && &&
+		x=1 local "$1" --verbose echo printf $(pwd) | then "$1" grep cd
+awk --verbose local x=1
+	test $(pwd) grep echo echo echo export ${HOME} /usr/bin "$@"
+	printf 'quoted text' awk "$1" local ${HOME} test $(pwd) echo --verbose $(pwd) echo
+		--verbose then $(pwd) sed
+-eu then --verbose printf /usr/bin local
+${HOME} awk "$1" x=1 "$@" grep | then printf
+		printf x=1 "$1" $(pwd) grep export "$@" 'quoted text' readonly
+	x=1 printf $(pwd) $(pwd) $(pwd) echo "$1" | 'quoted text' local x=1 test local
+	local 2>/dev/null cd &&
+		grep --verbose /usr/bin then grep $(pwd) -eu local
+		'quoted text' sed "$@" "$@" x=1 sed done readonly x=1
+export -eu && ${HOME} x=1
+		then grep then test grep
+		local x=1 local --verbose grep "$1" "$1"
+then x=1 "$@" "$@" /usr/bin --verbose && x=1 | $(pwd) sed cd 'quoted text' grep
+| $(pwd) x=1 -eu 'quoted text' printf
+	grep && 2>/dev/null && readonly /usr/bin ${HOME} readonly local "$@" -eu
+awk "$@" then local "$1" | done ${HOME} -eu 'quoted text'
+printf | then readonly export done test
+		awk | --verbose ${HOME} done
+	done 'quoted text' | printf
+&& 2>/dev/null readonly awk ${HOME} export 2>/dev/null
+readonly sed grep export export local "$1" x=1 --verbose -eu $(pwd)
+		$(pwd) -eu readonly --verbose "$@" test -eu awk printf test 2>/dev/null $(pwd) 'quoted text'
+echo --verbose $(pwd) 2>/dev/null grep test done "$1" sed x=1
+		-eu cd grep "$@" && 2>/dev/null x=1 "$1" echo
+$(pwd) -eu echo 'quoted text' local readonly -eu "$@" echo /usr/bin x=1 done
+'quoted text' "$1" sed $(pwd) readonly
+	$(pwd) 2>/dev/null done done | ${HOME} readonly
+		awk export /usr/bin $(pwd) test export /usr/bin
+	sed readonly echo printf printf /usr/bin sed 'quoted text'
+	${HOME} 'quoted text' "$1" 2>/dev/null --verbose "$@" $(pwd)
+	"$@" 'quoted text' readonly printf -eu done local 'quoted text'
+export $(pwd) x=1 --verbose /usr/bin export then 'quoted text' printf x=1 readonly
+		awk sed awk "$1" x=1 printf cd 2>/dev/null
+x=1 "$1" 2>/dev/null && sed then printf done cd done then cd $(pwd) /usr/bin "$1"
+	printf grep $(pwd) "$1" 2>/dev/null grep sed -eu ${HOME}
+local readonly ${HOME} "$@" awk x=1 x=1 -eu awk test local readonly "$@" local |
+	-eu awk grep -eu "$1" | local x=1 grep echo --verbose "$@"
+	${HOME} /usr/bin printf local x=1 x=1 ${HOME} printf -eu export printf then &&
+		"$1" ${HOME} 2>/dev/null /usr/bin grep awk printf local
+	readonly done "$@" local | done then done then export "$@" /usr/bin "$@" |
+export ${HOME} grep cd 'quoted text'
+		test cd awk | awk sed "$@" $(pwd) grep
+awk 2>/dev/null "$1" "$@" $(pwd) echo local 'quoted text'
+	cd done --verbose "$1" then cd done "$@" 'quoted text'
+	'quoted text' && "$@" export /usr/bin awk done "$1"
+		&& -eu ${HOME} sed --verbose
+		awk test sed | $(pwd) 'quoted text'
+'quoted text' printf --verbose "$@" "$1" test echo ${HOME} sed then awk | &&
+	done "$1" $(pwd) readonly then echo sed /usr/bin echo "$1" 2>/dev/null
+--verbose "$@" && cd ${HOME} done
+	"$@" cd x=1 export | printf
+--verbose echo --verbose --verbose
+		--verbose x=1 'quoted text' printf /usr/bin |
+	| awk 2>/dev/null && /usr/bin ${HOME} ${HOME} | && readonly then
+	grep /usr/bin printf -eu
+${HOME} 2>/dev/null 'quoted text' && then ${HOME} /usr/bin ${HOME} printf "$1"
+&& | x=1 test readonly grep test | local ${HOME} local sed x=1 cd
+/usr/bin test grep $(pwd) printf && 'quoted text'
+		&& cd -eu x=1 grep test $(pwd) grep echo done
+2>/dev/null $(pwd) printf "$@" awk printf
+		readonly printf awk grep
+		--verbose "$@" awk && echo then 'quoted text' x=1 export
+		--verbose printf ${HOME} "$@" 2>/dev/null
+		readonly echo /usr/bin -eu echo --verbose readonly 'quoted text'
+cd printf -eu local then grep awk && readonly
+		printf 'quoted text' test 2>/dev/null awk "$1"
+		readonly -eu grep | 'quoted text' export echo 2>/dev/null
+		awk local test awk local -eu
+	sed then $(pwd) 'quoted text' test
+'quoted text' test export test x=1 x=1 then $(pwd) readonly
+"$1" 'quoted text' -eu "$@" --verbose done
+		grep --verbose test | && done readonly
+	local done 'quoted text' "$1" $(pwd) grep grep /usr/bin done -eu x=1 sed
+export export "$@" printf
+-eu 2>/dev/null /usr/bin /usr/bin 'quoted text' readonly then | | printf
+test && -eu "$1" | /usr/bin done
+		"$1" local cd x=1 && -eu x=1 && /usr/bin -eu "$@" --verbose done sed
+	printf /usr/bin local test x=1 $(pwd) "$@" 'quoted text'
+	test grep -eu 'quoted text'
+	local export $(pwd) 'quoted text' test $(pwd) export -eu readonly x=1
+		'quoted text' x=1 "$@" cd 2>/dev/null --verbose ${HOME} cd --verbose
+	printf | cd && grep local printf sed "$1" x=1 -eu && /usr/bin --verbose
+	grep --verbose export 2>/dev/null /usr/bin then printf grep 2>/dev/null
+'quoted text' echo 2>/dev/null --verbose $(pwd) 'quoted text'
+/usr/bin 'quoted text' && export "$1" done echo echo echo | 2>/dev/null then
+then readonly then grep then awk /usr/bin readonly &&
+"$@" then echo then cd
+cd x=1 /usr/bin "$1" local
+		test && local cd test "$@" && test then x=1
+		printf && "$@" echo 2>/dev/null "$@" "$1" echo && 'quoted text' --verbose sed
+'quoted text' | | | && done local -eu -eu done
+	grep -eu printf printf awk export 2>/dev/null awk |
+		grep echo 'quoted text' export readonly x=1 /usr/bin
+		test done cd cd done && cd then done ${HOME} printf
+		cd printf "$1" --verbose export $(pwd)
+		&& | "$@" -eu "$@" -eu ${HOME} awk 'quoted text' -eu awk ${HOME}
+	--verbose "$1" && grep 2>/dev/null
+	cd awk ${HOME} && | 'quoted text' 'quoted text' awk grep printf /usr/bin
+		&& cd 'quoted text' local awk "$@" && -eu
+		sed printf export readonly 2>/dev/null sed done awk $(pwd) sed "$1" done
+	then -eu $(pwd) sed "$@" test $(pwd) test local /usr/bin cd /usr/bin $(pwd)
+cd --verbose echo awk -eu x=1 test awk then readonly "$@"
+	cd "$1" -eu export 'quoted text' sed --verbose
+2>/dev/null "$1" test /usr/bin $(pwd) done "$1" "$1" x=1 $(pwd) grep ${HOME}
+	"$@" echo /usr/bin $(pwd)
+	/usr/bin cd | --verbose grep 'quoted text' cd readonly
+	"$1" "$1" 2>/dev/null $(pwd)
+		done /usr/bin 'quoted text' $(pwd)
+"$1" done sed done ${HOME} printf cd cd awk | grep export /usr/bin
+x=1 | cd /usr/bin x=1 "$@" --verbose
+/usr/bin awk /usr/bin | | test local && &&
+2>/dev/null printf awk done ${HOME} "$1" 2>/dev/null readonly printf
+	-eu "$1" && --verbose printf local x=1 | /usr/bin && then printf done -eu
+		2>/dev/null awk /usr/bin "$@" echo -eu
+local | cd /usr/bin x=1 cd "$@" ${HOME}
+		awk x=1 sed grep echo printf 'quoted text' -eu -eu sed echo printf awk
+	echo $(pwd) $(pwd) 2>/dev/null ${HOME} awk $(pwd) --verbose readonly
+&& test done && then "$@" readonly 2>/dev/null then $(pwd) awk --verbose
+		then 2>/dev/null -eu --verbose 2>/dev/null
+	--verbose /usr/bin -eu "$1" --verbose && sed export
+	echo --verbose 'quoted text' 'quoted text' awk $(pwd) done "$1" /usr/bin
+		test && 2>/dev/null 2>/dev/null
+		test cd echo then sed done export
+		local test cd /usr/bin cd ${HOME} export $(pwd)
+$(pwd) printf --verbose
+		${HOME} test "$@" readonly "$@" cd done -eu --verbose "$1"
+'quoted text' awk awk awk grep test && /usr/bin
+cd | readonly export && printf cd ${HOME} sed cd | | export local x=1 -eu cd 'quoted text'
+		local echo local 2>/dev/null cd then && 2>/dev/null
+		/usr/bin readonly printf "$1" ${HOME} && /usr/bin
+cd export "$@" printf
+	/usr/bin local /usr/bin $(pwd) then --verbose awk done grep sed --verbose awk "$@"
+		done x=1 echo echo export x=1 awk grep local --verbose local sed test sed
+		${HOME} -eu test && "$@" printf 2>/dev/null | local x=1 then
+-eu x=1 | grep test $(pwd) "$@" --verbose echo
+		2>/dev/null awk --verbose readonly | test /usr/bin /usr/bin
+		awk 'quoted text' "$@" grep "$@" -eu done done
+	export readonly grep x=1 export && echo 'quoted text'
+		&& $(pwd) "$1" x=1 readonly echo $(pwd) --verbose export "$@" grep && grep
+awk $(pwd) ${HOME} awk cd cd --verbose "$1" test cd
+"$@" test $(pwd) grep awk "$@" ${HOME} test |
+		"$@" awk readonly test | -eu ${HOME} /usr/bin $(pwd) -eu done
+awk sed && then /usr/bin done done "$1" awk $(pwd)
+		2>/dev/null "$1" x=1 | printf done then ${HOME} echo sed grep 2>/dev/null
+grep "$1" grep x=1 local sed export "$@" then
+	"$@" done then /usr/bin | /usr/bin readonly x=1 'quoted text' test
+	${HOME} readonly 2>/dev/null | printf local
+awk $(pwd) ${HOME} grep && test --verbose | --verbose
+"$@" ${HOME} --verbose export
+	local ${HOME} grep sed local "$@" then $(pwd) awk grep echo
+	printf x=1 "$1" cd cd test export readonly awk
+	"$1" | --verbose printf cd export $(pwd) && awk
+| sed cd test printf /usr/bin readonly "$@" export 'quoted text' ${HOME} | --verbose
+	'quoted text' && sed 'quoted text'
+	-eu ${HOME} /usr/bin && 2>/dev/null $(pwd) "$1" ${HOME}
+	"$1" awk cd printf printf printf 2>/dev/null export
+/usr/bin done "$@" sed $(pwd) then sed readonly done
+		| && echo echo test ${HOME}
+"$@" sed test awk && grep 'quoted text'
+		x=1 /usr/bin && ${HOME} 2>/dev/null |
+echo printf readonly --verbose awk 'quoted text' then "$1" | && test export
+echo grep readonly /usr/bin export "$1" test "$1" -eu -eu
+		grep export -eu | x=1 | sed local -eu --verbose then awk done 'quoted text'
+readonly sed /usr/bin export cd echo test
+		$(pwd) readonly cd then grep awk echo then 'quoted text' | test 2>/dev/null --verbose
+		printf 'quoted text' -eu cd "$@" "$@" cd $(pwd) then readonly -eu echo
+	then readonly ${HOME} "$@" -eu /usr/bin readonly grep "$1" then echo cd readonly
+grep cd --verbose echo export
+		2>/dev/null then grep grep cd --verbose 2>/dev/null done local $(pwd) "$@" -eu
+-eu ${HOME} done 2>/dev/null sed 'quoted text'
+		echo awk | | grep $(pwd) test grep
+done | ${HOME} grep | "$1" /usr/bin sed readonly x=1 ${HOME}
+done readonly test x=1 "$1" && then ${HOME} -eu grep echo | --verbose printf
+--verbose test cd local readonly readonly local
+sed printf then ${HOME} test 'quoted text'
+	test -eu --verbose local done test echo cd && -eu printf grep -eu
+		awk test $(pwd) "$1" && printf then test -eu test done ${HOME} echo 'quoted text'
+	-eu /usr/bin local echo -eu 'quoted text' done
+	--verbose | cd 'quoted text'
+grep && "$1" then 2>/dev/null awk
+then 'quoted text' local printf ${HOME} ${HOME} test
+	grep echo export export printf /usr/bin
+		grep local $(pwd) ${HOME} cd awk x=1 test $(pwd) --verbose done grep awk 'quoted text'
+local "$@" ${HOME} echo then local
+export 2>/dev/null local -eu grep ${HOME} ${HOME} "$1" then sed | awk export echo
+| --verbose $(pwd) test readonly
+grep done export ${HOME} local printf sed cd test grep
+		$(pwd) -eu test --verbose 'quoted text'
+		$(pwd) printf grep sed export readonly test grep echo 2>/dev/null local done
+		then echo --verbose /usr/bin "$1" local && echo x=1 cd "$1" local x=1 awk
+	printf 'quoted text' test test "$@" "$1" 2>/dev/null | readonly && awk done
+		--verbose 2>/dev/null test
+		'quoted text' && "$1" local echo ${HOME} printf /usr/bin
+/usr/bin done ${HOME} grep -eu ${HOME}
+done awk 'quoted text' 'quoted text'
+		echo 2>/dev/null 'quoted text' $(pwd) | $(pwd)
+		${HOME} test x=1 'quoted text' grep local cd awk export
+&& | echo done "$1" test "$1" test 2>/dev/null test /usr/bin $(pwd) echo
+		--verbose $(pwd) echo printf 2>/dev/null "$@"
+		-eu grep 2>/dev/null grep printf /usr/bin grep 'quoted text' --verbose
+$(pwd) printf x=1 "$1" local "$1" 'quoted text' ${HOME} printf x=1
+2>/dev/null $(pwd) | --verbose printf readonly printf grep "$@" x=1 export
+	sed grep awk 2>/dev/null
+'quoted text' x=1 printf local local grep then
+	then | 'quoted text' grep 2>/dev/null awk readonly cd done grep printf | $(pwd)
+		"$1" cd local x=1 -eu printf x=1 echo
+		"$@" /usr/bin | $(pwd) /usr/bin awk readonly -eu --verbose sed
+test test && sed readonly 2>/dev/null "$@" sed |
+	printf printf export 2>/dev/null grep grep "$1" 'quoted text'
+-eu printf && then x=1 export ${HOME} sed "$@" local grep export $(pwd)
+-eu echo --verbose grep local
+echo readonly x=1 then printf
+awk x=1 2>/dev/null && then "$@" $(pwd) "$@" x=1 | readonly local printf x=1
+| | local x=1 awk awk "$1" ${HOME} test ${HOME} "$@" "$1" ${HOME} then
+	done test && ${HOME} printf --verbose | readonly local
+	cd $(pwd) /usr/bin export test "$1" "$@" "$@" then test
+"$1" x=1 readonly readonly /usr/bin printf | test done local --verbose
+		-eu cd "$@" $(pwd) local 2>/dev/null export
+'quoted text' printf /usr/bin
+/usr/bin echo "$@" 'quoted text'
+$(pwd) | test --verbose | awk "$@" grep ${HOME} grep cd &&
+	grep test readonly test $(pwd) 'quoted text'
+export $(pwd) local done | then then printf local echo
+	x=1 readonly 2>/dev/null "$1" /usr/bin "$@"
+		done readonly --verbose 'quoted text' 2>/dev/null
+		test local x=1 grep grep $(pwd) --verbose --verbose grep --verbose
+	x=1 test grep -eu readonly awk "$@" cd ${HOME}
+	$(pwd) awk grep readonly grep cd then
+--verbose sed awk "$1" printf cd --verbose
+x=1 ${HOME} --verbose readonly x=1 && --verbose awk grep /usr/bin
+		--verbose /usr/bin cd echo printf && 'quoted text' test test then --verbose
+local test echo $(pwd) awk ${HOME}
+	x=1 | /usr/bin cd awk /usr/bin && | cd ${HOME} -eu ${HOME} local 2>/dev/null
+then awk /usr/bin "$1" awk --verbose
+	| 'quoted text' 'quoted text' cd export test sed local local 'quoted text' then
+then local done --verbose then -eu "$1" printf sed local && test --verbose done
+	${HOME} awk test --verbose
+	&& "$1" then test /usr/bin --verbose 2>/dev/null
+		done $(pwd) then awk --verbose cd sed grep
+awk --verbose sed export printf && --verbose 2>/dev/null done
+--verbose /usr/bin test -eu /usr/bin $(pwd) "$1" readonly cd /usr/bin
+"$1" sed | && /usr/bin readonly sed --verbose then awk done ${HOME} x=1 --verbose
+	awk export test 2>/dev/null --verbose ${HOME}
+	'quoted text' then test $(pwd) grep $(pwd) "$1" 'quoted text' local
+&& -eu echo 'quoted text' local test export | ${HOME}
+printf cd export -eu grep printf "$1" /usr/bin 'quoted text'
+cd x=1 then && done done "$@" 'quoted text' cd | local cd /usr/bin grep printf
+	"$1" echo done test "$1" "$@" export grep done 'quoted text'
+	readonly --verbose 'quoted text'
+		then echo x=1 ${HOME} printf export test
+cd awk 2>/dev/null test $(pwd) done "$1" x=1 && test echo
+x=1 done --verbose done --verbose local 2>/dev/null
+		cd | done --verbose 'quoted text' echo export awk "$@" "$1"
+cd awk 2>/dev/null | grep --verbose then local
+	printf --verbose echo sed cd ${HOME} printf test "$@" /usr/bin then grep
+		test $(pwd) && printf | /usr/bin
+	'quoted text' ${HOME} printf local export "$@" cd "$1" 'quoted text' sed
+${HOME} | then 2>/dev/null
+		&& $(pwd) 'quoted text' grep then readonly printf awk readonly && 2>/dev/null
+		"$@" "$@" sed readonly local local
+	done x=1 then 2>/dev/null
+		--verbose printf | awk | done ${HOME} awk "$@"
+		export local printf ${HOME} done echo then 'quoted text' 2>/dev/null local
+	export "$1" 2>/dev/null readonly sed
+${HOME} && -eu then readonly echo --verbose done x=1 sed sed x=1 "$1" && export
+sed 'quoted text' export
+	then 'quoted text' 2>/dev/null $(pwd) echo readonly -eu 'quoted text' --verbose
+	cd echo sed local test
+	'quoted text' cd 'quoted text' echo grep
+	"$1" "$@" --verbose 2>/dev/null && --verbose test then && x=1 local test cd
+	test | then --verbose
+	2>/dev/null --verbose 2>/dev/null "$@" test export /usr/bin
+"$@" ${HOME} && local /usr/bin sed 'quoted text'
+$(pwd) test $(pwd) then echo printf "$1" ${HOME} "$@" sed /usr/bin
+${HOME} "$1" /usr/bin printf sed -eu sed "$@" && && "$1" test then 'quoted text'
+	export test sed readonly "$1" cd grep --verbose export
+-eu test cd -eu then --verbose -eu | sed printf ${HOME} --verbose
+'quoted text' readonly done $(pwd) 'quoted text' echo printf then
+readonly x=1 echo printf awk then done then
+--verbose test /usr/bin $(pwd) grep "$1"
+	awk ${HOME} $(pwd) && test $(pwd) 2>/dev/null awk cd
+		cd "$1" "$@" then grep export grep then test sed
+		'quoted text' ${HOME} cd printf --verbose local
+$(pwd) printf printf "$1" sed "$1"
+	2>/dev/null /usr/bin local /usr/bin local done
+	${HOME} ${HOME} cd x=1 --verbose cd sed grep sed grep cd && --verbose echo "$@"
+	then readonly -eu readonly test $(pwd) then
+	${HOME} && --verbose done $(pwd) $(pwd) --verbose test /usr/bin sed 2>/dev/null
+local "$1" 2>/dev/null echo done && sed --verbose
+x=1 echo 2>/dev/null | export ${HOME}
+	grep ${HOME} printf --verbose $(pwd) printf
+		"$1" printf awk x=1 "$@" && done $(pwd) sed | cd 2>/dev/null cd && $(pwd) x=1 echo
+	printf /usr/bin --verbose printf "$1" cd readonly
+	| --verbose grep && $(pwd)
+-eu echo 'quoted text' readonly export 'quoted text' "$@"
+printf 'quoted text' -eu
+		"$1" echo 2>/dev/null /usr/bin $(pwd) then
+	| "$@" 'quoted text' echo --verbose printf && printf | $(pwd) awk x=1 $(pwd)
+	$(pwd) grep && "$1" ${HOME} --verbose export 2>/dev/null readonly 2>/dev/null
+	"$@" local -eu cd x=1 ${HOME} x=1 'quoted text' echo "$1" awk | printf
+export test sed "$@" /usr/bin
+| cd done x=1 /usr/bin ${HOME} sed cd -eu local cd local readonly
+cd awk 'quoted text' readonly cd readonly ${HOME}
+	grep "$1" "$1" "$@" then | 2>/dev/null | local cd x=1
+		printf && done 'quoted text' echo 'quoted text'
+		${HOME} local 2>/dev/null
+		&& 'quoted text' --verbose 2>/dev/null
+		printf x=1 2>/dev/null cd cd $(pwd) "$1" echo 'quoted text' 'quoted text' ${HOME}
+		export "$1" then /usr/bin local /usr/bin printf export sed
+	${HOME} "$@" cd 'quoted text' local test cd cd then 'quoted text' | 2>/dev/null
+echo cd test /usr/bin done echo /usr/bin $(pwd) echo
+		test --verbose echo "$@" "$@"
+		$(pwd) awk -eu /usr/bin cd | echo -eu /usr/bin --verbose sed /usr/bin
+local $(pwd) echo | && done cd local grep printf then
+test grep ${HOME} local then echo test test cd then echo -eu | 'quoted text'
+		"$@" "$@" $(pwd) "$@" | x=1 "$@"
+local /usr/bin "$@" 'quoted text' readonly echo cd readonly /usr/bin /usr/bin grep
+	-eu cd sed local grep "$1" "$@"
+		test local echo 'quoted text' awk $(pwd) --verbose 'quoted text'
+		done printf printf -eu "$1" then
+	export then x=1 "$@" echo && awk /usr/bin echo --verbose test cd "$@"
+readonly readonly printf
+$(pwd) "$1" ${HOME} echo echo "$1" && grep grep
+--verbose export cd $(pwd) ${HOME} "$1"
+		$(pwd) ${HOME} 'quoted text' && then local ${HOME} --verbose grep x=1 then
+		awk done then awk 2>/dev/null grep --verbose cd "$@" "$1"
+	sed echo 2>/dev/null 2>/dev/null awk --verbose local test
+	--verbose cd printf x=1 done && done
+awk local export && ${HOME} printf && sed then awk && 2>/dev/null then
+	grep awk 2>/dev/null 'quoted text'
+		then -eu printf | local ${HOME} awk then then 'quoted text' "$@"
+		done sed x=1 printf ${HOME} grep
+	2>/dev/null | $(pwd) local done awk "$@" readonly readonly | "$@"
+&& 2>/dev/null then done $(pwd) "$1" sed
+-eu --verbose "$1" "$1" $(pwd) echo grep printf
+local "$1" 2>/dev/null /usr/bin grep sed && | cd then grep
+		then export grep awk readonly
+grep test 'quoted text' x=1 2>/dev/null /usr/bin echo 'quoted text' x=1
+		x=1 test $(pwd) readonly local "$1"
+/usr/bin done test && test done readonly echo $(pwd)
+		-eu 'quoted text' test | x=1 local "$@" local echo then --verbose
+		x=1 --verbose && ${HOME} | ${HOME} "$1" echo -eu
+		export x=1 grep sed local printf done
+printf sed export 2>/dev/null
+	${HOME} local --verbose -eu 2>/dev/null awk 2>/dev/null
+		--verbose --verbose grep readonly -eu cd local -eu "$1"
+	export 'quoted text' ${HOME} x=1 2>/dev/null done
+printf && readonly --verbose readonly /usr/bin
+	${HOME} local done x=1 export 2>/dev/null awk $(pwd) test
+	-eu ${HOME} $(pwd) -eu readonly "$1" -eu readonly && echo grep | ${HOME}
+		local "$1" grep done /usr/bin "$1" /usr/bin "$1" readonly
+	/usr/bin readonly awk grep
+	local --verbose local test x=1 'quoted text' && --verbose
+	2>/dev/null test --verbose $(pwd) local "$@" 'quoted text' "$1" printf "$@"
+	2>/dev/null --verbose local cd && local grep sed "$1"
+'quoted text' ${HOME} grep 'quoted text'
+x=1 readonly $(pwd) export && $(pwd) readonly --verbose && local | 2>/dev/null
+		&& readonly cd grep && "$@" ${HOME}
+"$1" 'quoted text' sed printf --verbose
+'quoted text' ${HOME} done readonly "$@"
+		awk test test ${HOME} && echo then grep sed "$@" "$@"
+		test 'quoted text' readonly /usr/bin --verbose
+awk /usr/bin && x=1 "$1" --verbose -eu
+		"$@" done 2>/dev/null 'quoted text' grep export
+awk done -eu /usr/bin sed "$1" readonly "$1" 'quoted text'
+		${HOME} then local cd /usr/bin | "$@" grep x=1 "$1" | &&
+readonly -eu awk test 'quoted text' readonly local then
+	x=1 readonly printf 2>/dev/null then sed ${HOME} then
+		'quoted text' sed grep "$1" && -eu $(pwd) echo -eu grep -eu then export sed
+--verbose 2>/dev/null readonly $(pwd)
+		-eu -eu ${HOME} ${HOME} 2>/dev/null test -eu awk test -eu done --verbose
+&& local $(pwd) /usr/bin then
+done x=1 --verbose $(pwd) "$1" export ${HOME} | readonly | local
+		x=1 cd -eu 2>/dev/null then | "$@"
+		echo /usr/bin export && local
+	awk "$1" -eu --verbose | sed
+	${HOME} 'quoted text' -eu && then x=1 echo test
+	-eu "$@" --verbose -eu printf echo cd
+	sed -eu "$1" readonly --verbose | "$1" awk /usr/bin echo "$1" | --verbose
+		readonly done readonly $(pwd) awk printf cd export /usr/bin "$@" then
+| && ${HOME} cd x=1 ${HOME}
+readonly sed grep 2>/dev/null readonly ${HOME} local
+		then done printf $(pwd) $(pwd) awk 2>/dev/null awk "$@" done printf local
+		local -eu export -eu | &&
+	'quoted text' x=1 test
+printf && 2>/dev/null && --verbose readonly test echo ${HOME}
+	local awk sed 2>/dev/null "$1" cd awk grep echo
+	readonly then then /usr/bin x=1 "$@" ${HOME} /usr/bin done grep -eu "$@"
+		"$@" done cd "$1" printf ${HOME} "$1" /usr/bin readonly readonly 2>/dev/null
+	test cd ${HOME} awk then "$@"
+	grep -eu then awk then /usr/bin grep
+x=1 /usr/bin then echo /usr/bin 'quoted text' cd done printf test
+local x=1 printf ${HOME} | sed
+		test done && 'quoted text' sed && local test grep
+printf printf 2>/dev/null local && cd 2>/dev/null
+x=1 'quoted text' /usr/bin
+export "$1" then printf then test done printf done cd --verbose done && "$1" local
+	cd /usr/bin /usr/bin readonly grep ${HOME} awk 2>/dev/null
+	grep then /usr/bin printf then | x=1 sed ${HOME} test grep export "$1"
+		echo "$@" && 2>/dev/null | awk test local -eu
+		readonly | ${HOME} printf $(pwd) done done sed done | echo ${HOME}
+--verbose done export 'quoted text' -eu local readonly cd readonly sed awk
+	printf test cd then export echo then printf --verbose 2>/dev/null /usr/bin
+		2>/dev/null test test 2>/dev/null --verbose "$@" "$@" test
+x=1 done echo $(pwd) echo cd 'quoted text' then done readonly
+--verbose test cd cd awk export
+		sed readonly -eu | ${HOME}
+		&& | done readonly local done cd readonly awk &&
+	"$@" -eu 'quoted text' x=1 "$@" $(pwd) $(pwd) readonly x=1 readonly "$@"
+cd | 'quoted text' export echo 'quoted text' printf
+--verbose && /usr/bin readonly export printf
+	'quoted text' readonly echo 'quoted text'
+	$(pwd) readonly "$1" awk readonly
+		'quoted text' printf grep export --verbose echo awk /usr/bin /usr/bin
+	$(pwd) 'quoted text' x=1 x=1 "$1" 2>/dev/null test 2>/dev/null sed
+		local then readonly local cd --verbose
+		${HOME} $(pwd) export 2>/dev/null awk 2>/dev/null export cd 'quoted text' awk
+		readonly && $(pwd) 2>/dev/null export
+	/usr/bin done done cd export ${HOME} 2>/dev/null /usr/bin printf 'quoted text'
+		"$@" readonly readonly x=1 'quoted text'
+cd done $(pwd) done $(pwd) readonly sed then
+--verbose 2>/dev/null grep readonly then /usr/bin
+cd echo && && 2>/dev/null printf $(pwd) export
+$(pwd) test /usr/bin
+	| readonly | then | export readonly 2>/dev/null printf cd then ${HOME} $(pwd) $(pwd)
+	2>/dev/null 'quoted text' $(pwd) export ${HOME} $(pwd) "$1" x=1 cd grep
+--verbose test && then grep printf
+		x=1 cd then local "$1" "$1" -eu --verbose
+x=1 2>/dev/null $(pwd) 'quoted text' grep awk printf test cd /usr/bin
+sed awk grep cd -eu export local awk 'quoted text' ${HOME} echo grep test done
+x=1 local grep local test "$1" test test -eu done
+"$1" && awk done 2>/dev/null local "$@" readonly then 2>/dev/null
+	-eu echo cd ${HOME} /usr/bin && echo grep 2>/dev/null sed grep
+	then 'quoted text' readonly local readonly && $(pwd) 'quoted text'
+	/usr/bin 2>/dev/null | done sed
+done | | local ${HOME} cd 'quoted text' sed && cd
+done then then "$@" printf awk && | then 'quoted text' readonly 2>/dev/null
+	'quoted text' --verbose "$1" sed && ${HOME} sed echo "$1" readonly sed
+"$1" test /usr/bin test grep local sed "$1" "$1" 2>/dev/null 2>/dev/null
+		awk local x=1 then echo -eu x=1 --verbose x=1 $(pwd) 2>/dev/null
+	grep export then -eu 2>/dev/null sed x=1 && local awk 'quoted text'
+	"$@" 2>/dev/null done echo awk done awk && 2>/dev/null
+-eu /usr/bin done grep ${HOME} $(pwd)
+	test readonly /usr/bin cd ${HOME}
+&& "$1" /usr/bin 'quoted text' export 'quoted text' ${HOME} $(pwd) "$@" x=1
+		export then local $(pwd) 2>/dev/null grep "$1" test test ${HOME} 2>/dev/null
+		--verbose sed $(pwd) "$1" "$@" /usr/bin
+		"$@" -eu echo sed --verbose
+cd echo /usr/bin cd &&
+		-eu | 'quoted text' awk
+	export && readonly local && local
+then export ${HOME} --verbose export
+| 'quoted text' printf cd --verbose done local grep -eu "$@" done --verbose
+		${HOME} then echo 'quoted text' export | echo
+readonly /usr/bin done cd "$@" 2>/dev/null done
+	echo 2>/dev/null echo 2>/dev/null test echo printf done sed readonly
+	test readonly --verbose done test done "$@"
+		done x=1 grep sed then local -eu | $(pwd) ${HOME} "$1"
+		$(pwd) /usr/bin readonly "$1" awk "$1" local
+		'quoted text' awk grep grep && "$@" export grep | sed
+		-eu $(pwd) "$@" /usr/bin
+		2>/dev/null test 'quoted text' printf local readonly export $(pwd)
+		| "$@" local sed local local local 'quoted text' printf /usr/bin
+	/usr/bin printf ${HOME} awk printf 'quoted text' --verbose "$1" awk sed grep | done
+	cd grep && --verbose local 'quoted text' readonly | done readonly readonly
+		awk x=1 --verbose --verbose export sed 'quoted text' awk done then
+	"$1" 2>/dev/null cd local ${HOME} done | "$1" && $(pwd) echo x=1
+-eu echo printf && done done "$@" /usr/bin -eu sed "$1"
+then readonly && "$@" $(pwd) -eu local readonly && grep "$@" 'quoted text'
+printf --verbose printf "$1" "$1" done cd printf $(pwd) readonly | done
+x=1 readonly echo printf
+	--verbose ${HOME} "$1" $(pwd) && awk sed then export then
+| 2>/dev/null export /usr/bin then sed
+	grep then /usr/bin test printf readonly "$@" sed grep
+		&& "$1" "$1" echo done "$@" grep 'quoted text' export
+		'quoted text' 'quoted text' --verbose export ${HOME} test 2>/dev/null printf
+		done ${HOME} sed $(pwd) x=1 local sed -eu "$1" awk && "$1" x=1 grep sed sed "$1"
+		sed printf "$1" && readonly "$1" 2>/dev/null
+test export --verbose 2>/dev/null /usr/bin
+		/usr/bin printf echo --verbose printf $(pwd) done
+grep --verbose x=1 grep 2>/dev/null printf then -eu local ${HOME} export
+local grep x=1 cd $(pwd) -eu "$@" printf 'quoted text'
+		readonly then echo && local awk test "$@" 'quoted text' 'quoted text'
+echo sed "$1" grep done && 2>/dev/null "$1" readonly
+		$(pwd) printf "$1" ${HOME} awk -eu cd | |
+	echo printf cd | "$@" $(pwd) /usr/bin 'quoted text' && "$@" cd grep --verbose
+	x=1 printf test cd ${HOME} 2>/dev/null --verbose
+"$@" awk awk $(pwd) "$1" /usr/bin --verbose x=1 done awk $(pwd)
+		"$1" "$@" readonly /usr/bin export "$@" sed local export -eu export
+	--verbose 'quoted text' cd test test 'quoted text' sed
+		sed | x=1 --verbose -eu local done $(pwd)
+	then | && 'quoted text' 2>/dev/null cd &&
+cd "$@" "$1" readonly && && "$@" && 'quoted text' --verbose
+	-eu && awk | echo local done -eu 2>/dev/null
+	$(pwd) $(pwd) then -eu
+		printf --verbose export "$@" local
+	${HOME} export | readonly printf ${HOME} readonly "$1" $(pwd) 'quoted text'
+	cd 'quoted text' local done "$@" x=1 "$1" readonly | done && cd | /usr/bin
+	test $(pwd) echo -eu 2>/dev/null && ${HOME} echo "$1" 'quoted text' &&
+readonly local | "$@" export readonly 'quoted text' test /usr/bin /usr/bin
+		| local "$@" sed 'quoted text'
+		sed "$1" echo /usr/bin sed 2>/dev/null
+	&& x=1 ${HOME} 2>/dev/null printf | 2>/dev/null readonly
+"$1" && "$1" done $(pwd)
+$(pwd) --verbose "$@" "$@" /usr/bin export cd readonly | -eu
+test 'quoted text' 2>/dev/null
+done local 2>/dev/null | $(pwd) test readonly cd 2>/dev/null
+| echo test -eu cd x=1 x=1 x=1 "$@" |
+'quoted text' sed echo ${HOME} 'quoted text' echo
+#include c112.sh
+grep then done --verbose -eu sed | grep | $(pwd) "$1" then printf "$@" "$@" x=1
+		x=1 readonly awk cd "$@"
+		readonly ${HOME} echo "$@" 2>/dev/null
+		cd awk test -eu then local ${HOME} && "$@" && local printf test
+		${HOME} && awk test cd ${HOME} grep "$1" --verbose && && echo test &&
+		x=1 test --verbose x=1 awk 2>/dev/null -eu /usr/bin done 2>/dev/null
+	| $(pwd) ${HOME} done "$1" awk $(pwd) /usr/bin awk ${HOME}
+	export grep printf grep readonly /usr/bin then echo | then done echo done
+	$(pwd) 2>/dev/null 2>/dev/null readonly done
+"$1" echo then "$@" /usr/bin export awk ${HOME} |
+	test 2>/dev/null export test test x=1 /usr/bin local
+/usr/bin -eu printf awk local x=1 sed awk test readonly done /usr/bin
+		echo "$1" && "$@" && --verbose "$@" ${HOME} 'quoted text' "$@" "$@" $(pwd) grep
+	test readonly cd then && test 'quoted text' sed "$1" printf | test && | 'quoted text'
+	'quoted text' echo ${HOME} "$1" awk "$1" "$1"
+		${HOME} x=1 grep done 'quoted text' 2>/dev/null grep | export 2>/dev/null
+awk 'quoted text' local /usr/bin x=1 $(pwd) done local "$1" -eu then
+		test "$@" "$@" awk --verbose "$1" $(pwd) cd 2>/dev/null
+-eu | | export local awk "$@" export && $(pwd) export local /usr/bin
+	$(pwd) test --verbose echo grep sed 'quoted text' cd 2>/dev/null 2>/dev/null
+then "$1" export /usr/bin -eu cd ${HOME} 2>/dev/null 'quoted text' awk
+	"$@" export sed ${HOME} local
+/usr/bin grep x=1 ${HOME} cd sed -eu -eu | && 2>/dev/null $(pwd) 'quoted text'
+	local echo readonly "$1" done "$@" 2>/dev/null 'quoted text' then | 'quoted text'
+		2>/dev/null | printf "$@" cd 2>/dev/null then done export
+		| $(pwd) echo /usr/bin local "$1" test ${HOME}
+		"$1" sed "$1" test 'quoted text' echo
+	'quoted text' export readonly ${HOME} --verbose echo $(pwd) x=1 test grep sed
+		awk x=1 x=1 2>/dev/null 'quoted text'
+	done awk printf /usr/bin grep echo printf x=1 echo
+	--verbose "$1" /usr/bin "$1" then printf grep | sed echo 2>/dev/null ${HOME}
+	--verbose awk "$@" "$@" echo
+awk 'quoted text' --verbose
+grep export /usr/bin 2>/dev/null test local printf then 2>/dev/null ${HOME}
+-eu local export sed sed
+sed 'quoted text' readonly ${HOME} grep test printf -eu then export
+	"$@" awk done x=1 "$@" sed echo && echo "$1" --verbose printf
+	awk 2>/dev/null sed x=1 then x=1 readonly printf x=1 | | local then && local
+	$(pwd) printf /usr/bin test | readonly then export done readonly
+	-eu local "$1" grep && sed grep | $(pwd) -eu 2>/dev/null ${HOME} local
+"$1" awk /usr/bin sed && --verbose sed export /usr/bin test then sed x=1 sed x=1
+done "$@" export && $(pwd)
+then grep --verbose x=1 export --verbose
+"$@" "$@" $(pwd) 'quoted text' echo echo then grep | "$1" done done && /usr/bin
+| test | echo 2>/dev/null
+sed test printf printf printf "$1"
+		2>/dev/null && -eu sed local 'quoted text' && "$@" done sed /usr/bin "$1" x=1
+	$(pwd) then export local
+		done test /usr/bin readonly sed | x=1 2>/dev/null | cd cd grep $(pwd)
+		local "$1" awk ${HOME} 'quoted text' export then done
+	done then printf cd -eu 2>/dev/null 'quoted text' sed done then readonly
+grep && --verbose 2>/dev/null
+$(pwd) cd ${HOME} then then done "$@" sed "$1" then --verbose
+	"$@" x=1 -eu sed grep 2>/dev/null
+	-eu test test awk grep local local "$@" "$1" x=1 then readonly export && "$@" test
+x=1 $(pwd) | -eu "$1" x=1 --verbose printf local ${HOME} local 2>/dev/null
+	then local grep printf sed export $(pwd) "$1" --verbose
+	awk test --verbose echo /usr/bin x=1 local awk cd 2>/dev/null local echo
+/usr/bin printf sed /usr/bin ${HOME} readonly grep "$1" "$@" awk printf
+done -eu echo x=1 grep local echo export 'quoted text' done
+sed awk done then -eu done 2>/dev/null
+	local /usr/bin ${HOME} -eu ${HOME} "$@" $(pwd) test sed sed x=1
+	${HOME} readonly grep test $(pwd) test x=1 && -eu
+		cd test 'quoted text' $(pwd) printf --verbose
+		2>/dev/null echo test 'quoted text'
+printf local readonly $(pwd) readonly "$1" local cd
+$(pwd) test echo 2>/dev/null export test 2>/dev/null
+	"$1" 'quoted text' readonly x=1 test 'quoted text' printf test
+	$(pwd) awk then -eu $(pwd) export
+	done awk awk awk echo echo
+	sed "$@" test sed echo --verbose
+		local && /usr/bin local then test cd 2>/dev/null $(pwd) "$@" x=1 awk
+	done printf /usr/bin echo -eu done export echo
+		-eu | --verbose ${HOME} sed done cd readonly
+printf awk grep export sed --verbose
+		sed done $(pwd) grep export local "$1" x=1 cd -eu cd "$1" && awk
+	cd grep $(pwd) then cd readonly awk -eu echo export sed --verbose -eu done && /usr/bin
+then then sed x=1 $(pwd) 'quoted text'
+	sed grep 'quoted text' && readonly
+		local ${HOME} --verbose grep ${HOME} done && printf && printf -eu ${HOME} -eu
+	"$1" 2>/dev/null local test | | grep | /usr/bin $(pwd)
+		/usr/bin done awk "$@" export test export export $(pwd)
+2>/dev/null cd local export test local x=1 cd 2>/dev/null
+		readonly local awk -eu --verbose "$1" done | export
+	echo -eu "$1" then sed $(pwd) grep local && x=1
+	-eu local local local done "$@" echo echo /usr/bin "$@" | done echo -eu
+	"$@" /usr/bin grep --verbose $(pwd) ${HOME} -eu "$1" ${HOME} $(pwd) 2>/dev/null
+		test cd 2>/dev/null done 2>/dev/null /usr/bin
+$(pwd) grep ${HOME} | printf
+--verbose done grep 2>/dev/null export awk | echo done 'quoted text' 'quoted text'
+export "$@" local $(pwd) && $(pwd) export then /usr/bin | readonly && grep
+		2>/dev/null /usr/bin grep --verbose
+printf "$1" sed echo echo local /usr/bin test /usr/bin "$1" cd x=1 ${HOME}
+		2>/dev/null sed 2>/dev/null /usr/bin /usr/bin
+	'quoted text' printf grep --verbose done x=1 && $(pwd) 'quoted text'
+		export "$@" done done local
+		-eu test /usr/bin "$@" -eu local
+		${HOME} -eu -eu local /usr/bin readonly then 'quoted text' && export
+		&& /usr/bin "$@" readonly awk x=1
+&& echo x=1 then local
+		${HOME} done $(pwd) awk cd
+	'quoted text' awk | --verbose $(pwd) export done done echo
+		| 2>/dev/null "$1" then x=1 -eu 'quoted text'
+	printf ${HOME} -eu sed grep
+cd then readonly x=1 then "$@"
+		--verbose local /usr/bin export 2>/dev/null /usr/bin
+		printf 'quoted text'
+	2>/dev/null local export "$@" ${HOME} | ${HOME} grep cd "$1" | /usr/bin then x=1
+		&& sed | | local local
+2>/dev/null cd printf /usr/bin
+		local done 2>/dev/null test test readonly echo readonly && 'quoted text'
+		readonly grep echo x=1 test sed awk "$1" x=1
+		x=1 /usr/bin /usr/bin ${HOME} sed 2>/dev/null "$@" echo sed grep export local
+	sed "$1" then 2>/dev/null | echo readonly /usr/bin readonly 'quoted text'
+		'quoted text' && echo && --verbose echo "$@" cd test done ${HOME} "$1" 2>/dev/null
+	&& -eu readonly grep sed "$@" readonly --verbose cd | sed local local
+	"$1" "$@" /usr/bin echo done printf /usr/bin
+'quoted text' sed 'quoted text' local && 'quoted text' /usr/bin grep test
+		readonly echo cd done x=1 export
+	/usr/bin readonly awk then then x=1 $(pwd) done /usr/bin echo 2>/dev/null
+	"$@" echo "$@" done --verbose sed local "$1"
+	"$@" 'quoted text' x=1 printf
+		grep "$@" -eu cd sed 'quoted text'
+		2>/dev/null export export grep ${HOME} printf test
+		sed 'quoted text' grep sed && $(pwd) sed /usr/bin
+"$@" ${HOME} printf 'quoted text' readonly test | && "$@"
+sed "$1" -eu "$@" sed x=1 readonly x=1 sed "$1" ${HOME}
+	test | local cd awk test --verbose $(pwd) --verbose local echo echo readonly
+		2>/dev/null "$1" -eu $(pwd) 'quoted text' then "$1" "$@" grep && ${HOME} export
+grep 'quoted text' "$1" | awk /usr/bin 2>/dev/null "$1" "$@" "$1" then
+"$1" printf /usr/bin then awk /usr/bin "$1"
+grep then then && && 'quoted text'
+grep --verbose | local 'quoted text'
+		readonly "$@" 2>/dev/null grep $(pwd) x=1 readonly grep export 'quoted text'
+export && echo /usr/bin
+	2>/dev/null printf && -eu grep
+${HOME} ${HOME} "$@" -eu sed /usr/bin local
+printf done done && "$@" printf --verbose cd awk | ${HOME} "$1" awk cd "$1"
+		${HOME} export sed /usr/bin
+		sed readonly printf -eu grep grep
+grep && sed test "$1" readonly "$@" "$@" sed 'quoted text' awk "$1" awk --verbose
+	--verbose "$1" 'quoted text' sed printf echo
+&& "$1" sed sed | -eu cd ${HOME} printf
+		"$1" && sed local echo "$@" export -eu awk "$@" done echo awk test printf
+	then echo cd echo 'quoted text'
+		done "$1" grep done done 'quoted text' readonly && awk printf cd x=1 "$@"
+then 'quoted text' then sed export && test sed "$@" echo -eu awk /usr/bin $(pwd)
+sed "$1" local cd 'quoted text' local "$1" local done /usr/bin ${HOME} readonly
+awk test readonly readonly test x=1
+		awk --verbose printf export
+		sed $(pwd) local "$1" then grep then cd --verbose done printf "$@"
+		"$@" ${HOME} 2>/dev/null awk $(pwd) printf done -eu | local --verbose echo &&
+		readonly -eu && 'quoted text' done local x=1 sed
+	sed x=1 && printf "$1" test "$@" && sed test export $(pwd) awk && x=1
+x=1 readonly 2>/dev/null -eu
+test awk done export export printf /usr/bin 2>/dev/null printf sed 2>/dev/null
+		test export "$@" -eu | && 'quoted text' "$@" 'quoted text' printf 'quoted text'
+	readonly cd /usr/bin /usr/bin 2>/dev/null
+awk test done "$@" --verbose done --verbose && "$@" printf
+	/usr/bin -eu 'quoted text' readonly x=1 readonly &&
+2>/dev/null -eu /usr/bin cd 'quoted text' done export -eu /usr/bin ${HOME}
+	2>/dev/null $(pwd) /usr/bin 2>/dev/null /usr/bin readonly ${HOME} sed "$1"
+&& local sed && local grep printf "$1" 2>/dev/null cd --verbose --verbose
+	${HOME} ${HOME} sed echo $(pwd) 2>/dev/null ${HOME}
+"$@" "$1" | --verbose local
+		"$@" local sed /usr/bin 'quoted text' cd 2>/dev/null && 'quoted text' "$@"
+'quoted text' readonly && done $(pwd) $(pwd) -eu test
+echo export && /usr/bin --verbose
+	$(pwd) | ${HOME} awk 'quoted text'
+&& --verbose test sed --verbose "$1" local done
+echo $(pwd) 2>/dev/null printf /usr/bin | echo $(pwd) awk --verbose
+	/usr/bin x=1 cd export "$@"
+		printf test -eu echo local readonly && "$@"
+local | export readonly then sed export ${HOME} local 2>/dev/null
+	echo "$1" then test awk test sed
+	'quoted text' grep /usr/bin 'quoted text' export | cd 'quoted text'
+	2>/dev/null x=1 local grep local
+	then local then then cd local ${HOME} x=1 readonly x=1
+		$(pwd) ${HOME} awk readonly sed
+readonly test $(pwd) x=1 && grep "$@"
+/usr/bin sed ${HOME} "$1" printf ${HOME} sed -eu --verbose "$1" grep $(pwd)
+		cd export 2>/dev/null "$1" echo grep echo
+		sed awk echo printf then "$@" done
+		then /usr/bin --verbose
+${HOME} $(pwd) -eu x=1 x=1 x=1 "$@" grep "$@" "$1" x=1 --verbose 2>/dev/null
+	readonly -eu test 'quoted text' 2>/dev/null printf --verbose sed x=1
+	awk then grep x=1 export
+		test /usr/bin then printf echo /usr/bin -eu printf export $(pwd) readonly
+		awk /usr/bin ${HOME} "$1" awk /usr/bin done
+then 2>/dev/null $(pwd) /usr/bin export local local --verbose echo --verbose &&
+		2>/dev/null /usr/bin 'quoted text' "$@" printf awk sed "$1"
+printf ${HOME} then local grep awk cd then ${HOME} | echo export
+		$(pwd) then then 2>/dev/null /usr/bin --verbose echo "$1" printf "$@"
+&& "$1" /usr/bin $(pwd) x=1 then
+		--verbose | then "$1" then then awk 2>/dev/null awk $(pwd)
+	"$1" grep sed done -eu "$@" done echo sed 'quoted text'
+	echo -eu grep grep echo readonly "$1" x=1 then
+	printf export test cd 2>/dev/null
+		&& --verbose awk then "$@" x=1 x=1 "$1" x=1 'quoted text'
+		${HOME} export && then sed x=1 grep 'quoted text' x=1 done 2>/dev/null && &&
+	grep grep 'quoted text' | echo export grep $(pwd)
+	x=1 'quoted text' test test export local $(pwd)
+done printf grep readonly $(pwd) /usr/bin sed readonly
+	| /usr/bin readonly "$@" | local 'quoted text' local
+		readonly --verbose -eu sed | awk | "$1" printf local grep
+echo then done grep "$1" awk sed test sed $(pwd) 'quoted text'
+		'quoted text' done then grep echo "$1" /usr/bin "$1" /usr/bin
+| printf export grep /usr/bin export readonly -eu printf | local awk
+		echo -eu grep test printf then | 'quoted text' export -eu --verbose
+${HOME} then | readonly | $(pwd) done local "$@"
+	done 'quoted text' && -eu done grep then $(pwd) readonly 'quoted text'
+test --verbose --verbose 'quoted text' done
+	done echo 2>/dev/null $(pwd) local echo grep 'quoted text' done /usr/bin
+	| --verbose printf test --verbose ${HOME} ${HOME} -eu readonly
+		&& grep awk && $(pwd) awk grep --verbose echo awk printf readonly
+	${HOME} awk $(pwd) "$@" then 'quoted text' | | cd ${HOME} | 2>/dev/null 'quoted text'
+local "$@" export --verbose sed | local $(pwd) 'quoted text' --verbose
+local "$1" local done readonly "$1"
+	"$1" --verbose sed | /usr/bin echo test export local
+	&& then /usr/bin then local
+$(pwd) grep $(pwd) $(pwd) &&
+	--verbose "$@" | && x=1 readonly awk grep
+	/usr/bin readonly then ${HOME} export --verbose
+	"$1" x=1 local | "$@" ${HOME} /usr/bin done /usr/bin | ${HOME}
+	--verbose x=1 printf cd printf done -eu cd "$1" grep "$1" then
+	sed sed readonly export test cd "$1" sed export "$1"
+	"$@" grep "$@" --verbose --verbose ${HOME} x=1 echo readonly
+${HOME} grep | local echo
+--verbose --verbose done grep -eu echo then printf local sed echo
+local "$@" echo echo printf --verbose "$@"
+		echo readonly grep local grep test "$@" 2>/dev/null
+	done awk $(pwd) awk local then --verbose
+		printf x=1 ${HOME} cd cd -eu 2>/dev/null
+2>/dev/null grep /usr/bin x=1 awk 'quoted text'
+export | sed && export then test readonly
+	printf printf $(pwd) 'quoted text'
+export x=1 done $(pwd) ${HOME} 2>/dev/null grep
+readonly ${HOME} x=1 cd /usr/bin && x=1 printf
+		| $(pwd) awk "$@" grep | then test
+done echo -eu "$@" $(pwd) echo ${HOME} sed cd x=1 local test /usr/bin
+		"$1" echo done local && | /usr/bin --verbose ${HOME} "$1" awk cd then
+		sed done --verbose $(pwd) awk grep local /usr/bin echo 2>/dev/null x=1 "$@"
+		awk local -eu 'quoted text'
+"$@" 2>/dev/null export "$1" export local | echo awk "$1" local 2>/dev/null grep
+		cd | --verbose grep awk ${HOME} 2>/dev/null --verbose ${HOME}
+		&& done x=1 cd then 'quoted text' "$1" ${HOME} $(pwd) ${HOME} readonly grep
+2>/dev/null echo sed local /usr/bin "$@" 'quoted text'
+	done "$1" export | /usr/bin --verbose
+	-eu && --verbose local 'quoted text' printf local /usr/bin
+		cd cd 'quoted text' cd | grep sed done awk x=1 'quoted text' --verbose
+	${HOME} awk cd printf test printf
+	done x=1 readonly "$1" readonly export
+sed test "$1" test && x=1 "$1" "$1" local
+	-eu then echo "$@" echo readonly | $(pwd) readonly | awk echo --verbose | && --verbose
+grep -eu ${HOME} x=1 $(pwd) &&
+	"$1" grep x=1 /usr/bin readonly
+done | local ${HOME} done ${HOME} -eu awk export grep done awk 2>/dev/null
+		grep sed export test then x=1 then /usr/bin 2>/dev/null 2>/dev/null
+export awk test readonly "$1" local -eu
+	x=1 readonly $(pwd) 2>/dev/null cd 2>/dev/null -eu export "$@" local sed
+	$(pwd) -eu -eu readonly ${HOME} x=1 "$1" "$@" | export
+		'quoted text' sed test 'quoted text' "$@" | "$@" echo
+		/usr/bin grep readonly && x=1 export "$@" grep "$1" $(pwd)
+"$1" echo "$1" awk done test grep 'quoted text' local "$@"
+		test export then cd ${HOME} local grep export cd local
+		then | printf 'quoted text' readonly -eu sed local
+		cd printf 2>/dev/null sed && 2>/dev/null "$1" readonly done
+		local echo local done 2>/dev/null "$1" 2>/dev/null 'quoted text'
+	echo grep readonly readonly x=1
+	readonly then readonly local local grep done export "$@" test
+then && done && then echo echo cd ${HOME} done ${HOME} 2>/dev/null
+test printf && done done && "$1" test /usr/bin
+		$(pwd) cd done readonly sed sed -eu $(pwd)
+local && $(pwd) then "$1" echo done test -eu &&
+	sed && readonly | && then grep x=1 /usr/bin readonly "$@" then local --verbose
+		&& -eu done awk grep awk $(pwd) awk "$1" /usr/bin cd --verbose
+	-eu export 2>/dev/null test $(pwd) --verbose printf grep echo local
+cd && x=1 -eu cd echo printf cd printf "$@" printf
+		2>/dev/null echo test test && done local /usr/bin ${HOME} echo
+		export | printf && done export "$@" $(pwd) ${HOME} -eu x=1 done sed done
+	${HOME} export sed done readonly readonly export
+test "$1" then $(pwd)
+grep && cd export 2>/dev/null && done awk x=1 grep test cd
+	then "$1" done 'quoted text' -eu sed ${HOME} "$1" then 'quoted text'
+"$@" --verbose "$@" -eu "$1" readonly readonly "$@" echo --verbose --verbose
+export ${HOME} /usr/bin /usr/bin ${HOME} /usr/bin /usr/bin
+		'quoted text' 'quoted text' local | x=1 |
+	done $(pwd) 2>/dev/null $(pwd) "$@" done 2>/dev/null cd -eu
+		${HOME} cd -eu then | export $(pwd) $(pwd)
+		"$1" "$@" -eu test | x=1 --verbose printf
+		cd sed "$1" /usr/bin /usr/bin "$1" 2>/dev/null
+		grep export local readonly
+		| $(pwd) ${HOME} done x=1 | test "$@" --verbose -eu readonly printf
+		done grep local cd /usr/bin -eu -eu test export $(pwd) then
+	--verbose && && | && x=1 "$1" x=1
+		echo | && --verbose 'quoted text'
+printf 'quoted text' test grep printf
+x=1 sed && export --verbose awk readonly grep printf sed "$1" x=1 -eu done
+	then ${HOME} echo echo printf "$1" awk "$1" sed | x=1 test &&
+2>/dev/null ${HOME} "$1" then "$@" | cd export then
+		done "$@" export "$@" $(pwd) sed ${HOME}
+		x=1 | export -eu then echo awk -eu
+		echo 2>/dev/null 'quoted text'
+readonly sed then printf sed local printf --verbose
+sed $(pwd) --verbose | /usr/bin "$1" $(pwd) sed 'quoted text' 'quoted text'
+		grep "$@" readonly "$1"
+${HOME} | sed readonly && 2>/dev/null cd "$1" awk "$1" && printf cd "$1"
+		done done 2>/dev/null "$1" 'quoted text' 2>/dev/null printf awk --verbose
+	"$@" echo && grep done test x=1 $(pwd) cd readonly
+sed then grep && export test local sed printf then | --verbose
+		&& sed --verbose cd done awk echo then echo $(pwd) sed x=1 test --verbose
+	awk 2>/dev/null awk $(pwd) sed cd sed | cd 2>/dev/null
+	cd 2>/dev/null done grep readonly --verbose $(pwd) then
+-eu -eu x=1 grep $(pwd) sed ${HOME} x=1 && /usr/bin ${HOME} sed
+		"$1" test cd /usr/bin | $(pwd)
+'quoted text' awk "$@" sed export
+		| done "$@" printf local then cd readonly "$@" /usr/bin
+	| test "$@" $(pwd) awk $(pwd)
+		sed then ${HOME} test $(pwd) cd ${HOME}
+cd "$1" $(pwd) --verbose printf awk x=1 'quoted text' | done $(pwd)
+--verbose ${HOME} ${HOME}
+local printf local 2>/dev/null $(pwd) x=1 echo then --verbose sed
+&& /usr/bin printf /usr/bin ${HOME}
+		grep export cd | x=1 sed awk | test then "$1" readonly && 2>/dev/null printf sed
+sed 2>/dev/null ${HOME} /usr/bin | ${HOME}
+printf grep readonly echo then /usr/bin
+		--verbose then 2>/dev/null sed local grep export $(pwd)
+		${HOME} 'quoted text' local cd --verbose | then && -eu
+"$1" test echo -eu test export readonly then sed "$1" sed done export /usr/bin
+		/usr/bin 2>/dev/null /usr/bin && awk local x=1
+	x=1 ${HOME} x=1 /usr/bin "$1" local 'quoted text' /usr/bin
+	--verbose 2>/dev/null test && | ${HOME} awk cd |
+		sed test "$@" readonly export printf /usr/bin test "$1" sed && sed $(pwd) &&
+-eu echo "$@" "$@" 2>/dev/null test done 'quoted text' test
+${HOME} | x=1 --verbose 'quoted text'
+		"$@" done then grep export cd grep test
+	grep /usr/bin readonly "$@" grep then local test /usr/bin --verbose
+		readonly printf /usr/bin then ${HOME}
+		&& -eu && awk 'quoted text' awk awk "$1" export --verbose --verbose
+done "$@" done local && 'quoted text'
+$(pwd) && printf "$1" "$1" | $(pwd) cd /usr/bin
+	$(pwd) && 'quoted text' then -eu 'quoted text'
+awk awk local then export /usr/bin -eu printf sed "$@" printf 2>/dev/null
+	"$1" 'quoted text' 'quoted text'
+| printf ${HOME} 'quoted text' echo local
+	awk grep awk && echo sed x=1 export export 'quoted text'
+	printf | x=1 local $(pwd) cd awk | sed x=1 awk
+		grep awk echo ${HOME} local /usr/bin
+		/usr/bin grep test && --verbose printf export echo sed --verbose $(pwd)
+'quoted text' 2>/dev/null
+then | export -eu then readonly grep local awk then
+	cd 2>/dev/null sed export 2>/dev/null printf awk "$1" export export
+		"$1" $(pwd) readonly | done
+sed /usr/bin 'quoted text' then && --verbose "$1" --verbose
+		cd "$1" readonly && /usr/bin "$1" |
+		cd done local $(pwd) "$@" $(pwd) ${HOME}
+		| awk /usr/bin 'quoted text' local cd grep cd echo
+	readonly $(pwd) test ${HOME}
+	echo echo printf grep export
+export cd readonly "$@"
+		echo && test echo "$1" echo 'quoted text' export local
+		-eu local cd 2>/dev/null readonly
+	'quoted text' $(pwd) printf echo echo "$@" 'quoted text' grep "$@"
+		readonly && /usr/bin ${HOME} cd cd test echo /usr/bin 2>/dev/null then "$1"
+	awk printf --verbose $(pwd) done readonly
+done | -eu 2>/dev/null grep done --verbose sed -eu "$@" x=1 then
+		export | cd -eu --verbose then readonly cd export -eu export /usr/bin
+	-eu /usr/bin local --verbose 'quoted text' --verbose | sed x=1 readonly
+	x=1 $(pwd) -eu awk "$1" 2>/dev/null
+"$@" export ${HOME} "$1" then /usr/bin /usr/bin $(pwd) awk 'quoted text'
+local && cd "$@" printf export test test
+		test /usr/bin "$1" done echo echo sed ${HOME} -eu $(pwd)
+		'quoted text' 2>/dev/null then
+		local 2>/dev/null --verbose readonly cd
+	export /usr/bin /usr/bin -eu "$1" x=1 'quoted text' test sed /usr/bin
+		"$@" -eu readonly grep 2>/dev/null 'quoted text' /usr/bin
+	cd "$@" x=1 printf x=1 grep grep -eu | "$@" awk 'quoted text'
+echo grep echo test && $(pwd) ${HOME} ${HOME}
+cd $(pwd) | local test readonly
+		2>/dev/null done local 'quoted text' sed 2>/dev/null /usr/bin 'quoted text' 'quoted text'
+	cd 'quoted text' "$1" local cd
+echo cd --verbose /usr/bin "$1" 2>/dev/null
+		export sed printf readonly
+$(pwd) cd printf 'quoted text'
+		cd awk ${HOME} awk cd "$@" 'quoted text' awk -eu export
+		/usr/bin readonly printf then readonly -eu printf | && --verbose
+	readonly export "$@" readonly ${HOME} awk grep 2>/dev/null
+		local awk done echo $(pwd) 'quoted text' export cd sed cd /usr/bin
+		-eu local test 2>/dev/null printf
+		cd 2>/dev/null | readonly local x=1 $(pwd) echo done "$@" awk /usr/bin awk
+	echo grep -eu | grep done export --verbose cd printf "$1" ${HOME} test grep "$1"
+grep 'quoted text' && -eu
+	2>/dev/null export x=1 /usr/bin ${HOME} x=1 ${HOME} test readonly && then
+		/usr/bin then test done awk && x=1 $(pwd) 2>/dev/null then "$@" "$@" echo
+	"$@" done "$1" $(pwd) printf sed test test
+	test cd 'quoted text' cd cd $(pwd) done
+	local then --verbose readonly -eu | x=1 $(pwd)
+$(pwd) | echo ${HOME} done 'quoted text' export x=1 -eu export 'quoted text'
+-eu echo /usr/bin readonly && $(pwd) grep 2>/dev/null printf "$@" 2>/dev/null 2>/dev/null
+		printf echo && then cd test 2>/dev/null sed "$@" readonly
+| sed -eu 2>/dev/null /usr/bin x=1
+		done awk test printf "$1" awk x=1 'quoted text' x=1 "$@" 2>/dev/null local sed
+test readonly readonly "$@" x=1 2>/dev/null
+	'quoted text' "$@" awk /usr/bin 'quoted text'
+"$1" $(pwd) -eu printf $(pwd) &&
+		| local 'quoted text' | -eu x=1 /usr/bin sed readonly cd grep 'quoted text'
+	2>/dev/null then local cd "$1" sed test grep printf
+test 'quoted text' local test echo 2>/dev/null
+		--verbose $(pwd) grep awk cd printf awk
+		cd grep $(pwd) readonly --verbose --verbose
+	/usr/bin -eu sed printf grep echo cd cd grep echo then | 2>/dev/null -eu
+--verbose cd | $(pwd) 2>/dev/null grep "$@" printf test then $(pwd) ${HOME} test
+		--verbose --verbose 'quoted text' --verbose "$1" ${HOME}
+		${HOME} echo cd --verbose 2>/dev/null
+	readonly x=1 "$@" "$@" $(pwd) "$@" test ${HOME} -eu && test x=1 $(pwd) "$1"
+'quoted text' cd readonly echo grep local 2>/dev/null readonly
+grep cd && echo && 2>/dev/null done ${HOME} sed "$@" local sed ${HOME}
+	${HOME} 2>/dev/null printf
+"$@" readonly done -eu 'quoted text'
+		export ${HOME} -eu $(pwd) /usr/bin "$1" then "$1" "$@" x=1
+		${HOME} "$@" "$1" && done --verbose
+	-eu cd -eu /usr/bin 2>/dev/null && && ${HOME} 2>/dev/null $(pwd)
+	awk grep && printf && grep
+$(pwd) "$1" 2>/dev/null cd echo echo echo awk ${HOME} printf ${HOME}
+		export --verbose printf export
+		cd /usr/bin 2>/dev/null export local local 'quoted text'
+		| sed grep then $(pwd)
+		done -eu --verbose "$@" printf then local test done printf
+		awk && readonly local $(pwd)
+x=1 "$1" sed ${HOME} --verbose echo ${HOME} printf -eu cd --verbose "$1"
+	printf echo cd && then sed 'quoted text' done then -eu local cd |
+	test ${HOME} grep local -eu awk | sed "$@" export then grep test test local
+		sed echo ${HOME} local readonly | done sed 'quoted text' 2>/dev/null cd 'quoted text'
+	done export | | sed awk ${HOME}
+	x=1 grep && ${HOME} $(pwd)
+		export done readonly $(pwd) then --verbose printf sed $(pwd) x=1 export --verbose
+	"$1" "$@" cd /usr/bin readonly 2>/dev/null "$1" "$@" awk
+'quoted text' echo done then cd done export sed export && local then
+	export 2>/dev/null 2>/dev/null readonly x=1
+test "$@" printf readonly -eu test "$1" sed /usr/bin ${HOME} ${HOME} --verbose
+		'quoted text' echo export x=1 --verbose | 2>/dev/null
+		'quoted text' sed /usr/bin export --verbose 2>/dev/null 2>/dev/null
+		echo "$1" "$@" export -eu --verbose --verbose then readonly --verbose export awk
+	&& x=1 cd echo "$1" --verbose export "$@" local "$@" 'quoted text'
+	| -eu cd done | 'quoted text' x=1 local
+		/usr/bin readonly export printf "$1"
+	awk 'quoted text' test then
+	$(pwd) "$@" ${HOME} grep done test sed /usr/bin echo
+		-eu "$@" printf 2>/dev/null 2>/dev/null readonly /usr/bin
+		"$1" 2>/dev/null printf $(pwd)
+		printf --verbose $(pwd) && | && test done $(pwd) sed then "$1" echo 2>/dev/null
+		grep grep export --verbose x=1 echo local && cd "$@" 2>/dev/null
+		$(pwd) echo $(pwd) "$@" ${HOME} then test -eu then then "$1" local cd local |
+echo printf local then "$@" test "$1" && $(pwd) grep
+		sed && 'quoted text' | echo "$@" echo
+		&& -eu awk "$@" readonly ${HOME} 'quoted text' export cd grep
+x=1 cd && --verbose 2>/dev/null done && /usr/bin -eu awk test then $(pwd)
+		'quoted text' | test awk echo x=1 'quoted text' $(pwd) sed echo
+--verbose echo "$1" printf echo grep /usr/bin
+	then readonly /usr/bin printf
+	readonly cd 2>/dev/null cd
+	grep ${HOME} $(pwd) readonly cd /usr/bin then local cd printf x=1 sed ${HOME}
+	awk | grep /usr/bin 2>/dev/null echo local
+		| then cd | cd printf test "$1" cd 'quoted text'
+		echo -eu ${HOME} 'quoted text' printf 'quoted text' x=1 |
+	x=1 2>/dev/null local --verbose "$1" readonly 'quoted text' /usr/bin
+2>/dev/null x=1 then "$@"
+	done x=1 $(pwd) sed "$@" echo echo test grep &&
+		done test test sed "$1" 2>/dev/null readonly
+		then grep done "$@" -eu export
+		done "$@" x=1 test x=1 -eu
+done $(pwd) -eu x=1 export -eu test done cd "$@"
+--verbose 2>/dev/null printf grep local
+	cd printf | /usr/bin test 2>/dev/null awk 'quoted text' printf
+| && local readonly awk &&
+--verbose test $(pwd) cd | export done echo "$1" x=1 "$1" echo
+	x=1 "$1" then done grep && done grep /usr/bin sed /usr/bin sed ${HOME}
+sed grep printf sed -eu "$1" "$1" local |
+	/usr/bin /usr/bin awk "$1" x=1
+	test echo 'quoted text' 'quoted text' "$1" "$@" readonly
+		--verbose "$@" -eu && $(pwd) test grep | awk then awk test "$1"
+	then -eu printf "$@" $(pwd) 2>/dev/null
+	"$1" x=1 export echo $(pwd) $(pwd) test &&
+$(pwd) "$@" readonly "$@"
+&& export -eu grep 2>/dev/null then 'quoted text' $(pwd) | 2>/dev/null -eu
+	-eu export | --verbose then grep ${HOME} x=1 x=1 "$1" ${HOME} test readonly
+	$(pwd) ${HOME} ${HOME}
+		echo export ${HOME} --verbose
+		'quoted text' sed done ${HOME}
+	"$@" awk | done $(pwd) -eu then cd | && cd ${HOME}
+	awk echo "$@" sed printf done awk --verbose awk then
+	printf export awk done "$1"
+--verbose readonly /usr/bin local "$@" x=1 -eu x=1 local then 2>/dev/null x=1
+	test local test 'quoted text' echo --verbose
+		"$1" printf done cd && -eu | echo
+	awk "$1" && 2>/dev/null --verbose grep /usr/bin 'quoted text' x=1 done "$@" readonly
+		| 2>/dev/null grep 'quoted text'
+	done local -eu test test && readonly test 'quoted text'
+${HOME} grep sed local | cd test x=1 test export printf 2>/dev/null 2>/dev/null
+done 'quoted text' printf 'quoted text' /usr/bin
+	test export x=1 && readonly
+		$(pwd) printf cd sed then /usr/bin sed awk && "$@" export export "$@" then | printf
+-eu $(pwd) local $(pwd) readonly --verbose sed test readonly
+&& cd grep grep done && x=1 2>/dev/null sed 'quoted text'
+	-eu --verbose | awk local 'quoted text'
+--verbose echo && /usr/bin x=1 cd cd sed awk | grep
+export ${HOME} --verbose readonly
+		grep grep cd readonly | $(pwd) "$1" x=1
+	&& printf cd sed "$1" local test 2>/dev/null readonly | test 2>/dev/null &&
+		&& | local --verbose export awk |
+	awk then printf x=1 local
+		then local | x=1 -eu 2>/dev/null
+-eu cd echo | -eu cd $(pwd)
+--verbose printf "$@" && /usr/bin printf sed test readonly
+	$(pwd) sed then export grep then 2>/dev/null printf awk
+	awk --verbose | sed ${HOME} echo -eu | grep
+"$@" local --verbose test awk && cd then x=1 awk local echo printf
+		echo test && $(pwd) -eu then $(pwd) awk && export local && grep
+	export grep echo "$1" /usr/bin readonly local --verbose sed "$@"
+		echo && awk printf "$1" done done readonly test | test --verbose
+	2>/dev/null echo "$@" echo ${HOME} local sed printf x=1 "$@" export --verbose
+$(pwd) done /usr/bin 2>/dev/null 'quoted text' then $(pwd) readonly
+	local local 2>/dev/null then local x=1
+	export awk $(pwd) "$1" 2>/dev/null awk 'quoted text'
+		readonly grep "$1" echo done
+	-eu ${HOME} ${HOME} test export 'quoted text' 2>/dev/null
+export local 2>/dev/null /usr/bin
+test | --verbose "$1" ${HOME} export awk -eu printf sed export
+		cd && sed /usr/bin test
+test --verbose echo "$1" 2>/dev/null &&
+		awk cd 2>/dev/null 'quoted text' "$@" "$1" "$1"
+-eu done | awk --verbose
+	"$@" /usr/bin echo 2>/dev/null
+		grep readonly export ${HOME} done && $(pwd) 'quoted text' $(pwd)
+		readonly /usr/bin grep local cd
+x=1 ${HOME} echo grep awk test && ${HOME} x=1 ${HOME} readonly
+	-eu readonly "$@" "$1" export printf 2>/dev/null 'quoted text'
+grep "$@" grep /usr/bin -eu 'quoted text'
+	$(pwd) local | 'quoted text' echo --verbose && 2>/dev/null
+	done x=1 then && /usr/bin grep
+		'quoted text' /usr/bin printf -eu --verbose sed -eu --verbose cd "$@" 'quoted text'
+	'quoted text' awk readonly grep /usr/bin cd cd readonly grep
+x=1 export "$1" "$1" $(pwd) printf && $(pwd) ${HOME} readonly x=1 awk done
+		sed cd | echo printf cd "$@" "$@" done done cd sed && readonly test &&
+		readonly | awk readonly readonly export done readonly -eu $(pwd)
+2>/dev/null echo done awk grep -eu x=1 'quoted text'
+done sed awk then --verbose && 'quoted text' "$1" sed "$1"
+		-eu sed printf grep awk grep done done local echo "$@"
+	awk local test $(pwd) $(pwd) printf
+		export x=1 "$1" readonly 2>/dev/null done
+"$@" readonly export echo 2>/dev/null
+done --verbose 2>/dev/null printf
+		cd && 'quoted text' 2>/dev/null export ${HOME} sed readonly then
+		&& test test done printf readonly grep export export test
+echo local "$@" grep "$@" ${HOME}
+		| ${HOME} then sed readonly $(pwd) -eu --verbose && "$1" then
+| awk 'quoted text' then export | export && test "$1" done test 'quoted text'
+	then readonly /usr/bin && export cd export 2>/dev/null |
+'quoted text' | cd test $(pwd) export export x=1 ${HOME}
+/usr/bin then printf 'quoted text' grep --verbose
+		local ${HOME} "$@" export |
+	x=1 /usr/bin -eu | readonly printf "$@" 2>/dev/null sed sed awk
+echo /usr/bin | printf grep "$1" --verbose local && && "$@" readonly awk | done
+echo printf && "$1" echo grep -eu then $(pwd) awk done ${HOME} export
+		printf cd "$@" done done "$@"
+--verbose sed done then | echo
+	--verbose && test grep awk && echo ${HOME} awk | echo awk ${HOME} ${HOME}
+done 2>/dev/null $(pwd) printf 'quoted text'
+--verbose test x=1 "$1" awk cd cd /usr/bin 'quoted text' "$@" ${HOME}
+		test ${HOME} echo && /usr/bin export awk done awk -eu 'quoted text'
+'quoted text' "$@" cd cd test
+	| test then done awk local then
+"$@" test 'quoted text' ${HOME} awk export test -eu && then
+"$@" "$@" printf awk "$1" | ${HOME} x=1 local "$@" --verbose x=1 "$@" done
+	export --verbose | local --verbose
+"$1" readonly /usr/bin && 2>/dev/null
+'quoted text' test $(pwd) readonly awk "$@"
+--verbose sed 2>/dev/null $(pwd) done /usr/bin
+		then cd 2>/dev/null printf then cd $(pwd) "$1" "$1" readonly 'quoted text'
+/usr/bin test cd then local 'quoted text' -eu echo x=1 "$1" && grep export printf
+	cd local export 'quoted text' 'quoted text' then readonly
+	--verbose awk awk done 2>/dev/null
+&& 'quoted text' readonly /usr/bin x=1 then sed ${HOME} grep | && done /usr/bin
+&& echo ${HOME} /usr/bin local && "$1"
+${HOME} -eu /usr/bin printf
+	/usr/bin done export ${HOME} 'quoted text' grep then test
+	-eu printf -eu printf ${HOME} cd 'quoted text' echo cd cd && echo
+	then awk echo printf echo done sed /usr/bin $(pwd) cd
+	2>/dev/null cd export done && grep echo 2>/dev/null ${HOME} -eu sed 'quoted text'
+	${HOME} 'quoted text' awk -eu readonly 'quoted text'
+		${HOME} ${HOME} echo "$@" cd printf awk grep -eu "$1" -eu cd
+		/usr/bin then ${HOME} 2>/dev/null echo $(pwd) "$1" "$1" done test 2>/dev/null
+-eu 2>/dev/null printf local && | "$1" printf printf readonly
+awk "$1" && awk && printf "$1" -eu 'quoted text' test --verbose
+		2>/dev/null cd x=1 2>/dev/null sed done done
+		"$1" -eu ${HOME} "$@" sed export /usr/bin cd awk test local
+		cd -eu awk export cd grep $(pwd)
+	readonly export test ${HOME} "$@" -eu 'quoted text' "$@" ${HOME}
+$(pwd) 'quoted text' local cd $(pwd)
+	readonly "$1" && $(pwd)
+${HOME} "$@" readonly /usr/bin 'quoted text' 2>/dev/null test 'quoted text'
+		-eu 'quoted text' 2>/dev/null
+		printf 'quoted text' /usr/bin done
+awk | export /usr/bin cd "$@" done echo done then export "$1" 'quoted text' &&
+x=1 "$1" export --verbose printf done
+	printf && 2>/dev/null | done 'quoted text' --verbose ${HOME} "$1" "$@" echo
+awk readonly export 2>/dev/null echo echo export "$1" awk readonly
+export printf sed /usr/bin echo /usr/bin awk | 'quoted text'
+	$(pwd) cd && $(pwd) "$@" /usr/bin readonly
+cd local readonly sed --verbose then then printf 2>/dev/null
+	then awk cd export grep ${HOME} 'quoted text' && cd /usr/bin | -eu printf 2>/dev/null
+readonly "$1" cd x=1 cd test ${HOME} echo echo test done done "$@"
+grep -eu then echo then ${HOME}
+"$@" cd printf printf export "$1" cd ${HOME}
+	x=1 awk export x=1 -eu 'quoted text' $(pwd) $(pwd) then printf
+	echo "$1" readonly readonly grep then
+		"$@" grep 2>/dev/null && cd cd 'quoted text' done &&
+		"$1" $(pwd) && awk export sed --verbose /usr/bin done readonly 2>/dev/null
+&& export done awk awk "$@" sed done
+		then $(pwd) --verbose test | printf printf && grep grep && $(pwd) | grep
+done ${HOME} x=1 then echo then export && done
+2>/dev/null done local "$1" done
+--verbose 2>/dev/null export sed local -eu printf local sed cd printf
+--verbose && then "$@" export export echo test -eu cd echo readonly 'quoted text'
+--verbose then --verbose test
+	test test echo sed | && printf local
+	local "$@" local "$@" echo x=1
+	/usr/bin 2>/dev/null x=1 export 'quoted text' local printf then readonly then
+	--verbose -eu ${HOME} printf
+&& sed | printf -eu "$1" "$1" export export
+		-eu cd x=1 && grep echo done echo 2>/dev/null echo awk
+		${HOME} ${HOME} | local done readonly "$1" cd test | "$@"
+		| x=1 test cd echo cd done grep test awk -eu awk 2>/dev/null
+		${HOME} local readonly && awk grep "$1" sed sed
+"$@" readonly | 'quoted text' | -eu
+'quoted text' local printf local ${HOME}
+x=1 then test ${HOME} export test -eu && 2>/dev/null
+		sed $(pwd) 'quoted text' ${HOME} export awk $(pwd) && test printf echo test test
+2>/dev/null done test "$1" && awk
+		test echo test cd cd readonly test local
+		done /usr/bin 2>/dev/null readonly then then
+	/usr/bin done --verbose && awk | local |
+then awk export /usr/bin 2>/dev/null export
+	$(pwd) done grep awk /usr/bin test x=1 echo --verbose 2>/dev/null
+cd --verbose grep done | readonly --verbose "$@" readonly
+	${HOME} cd "$1" 2>/dev/null x=1 -eu x=1 cd done grep x=1 test
+&& printf && cd printf printf local cd $(pwd) 2>/dev/null test
+		then $(pwd) 'quoted text' echo x=1 /usr/bin -eu && -eu awk -eu ${HOME}
+		printf done done /usr/bin "$1" --verbose
+		&& $(pwd) readonly sed sed
+		cd sed --verbose test 'quoted text' ${HOME} ${HOME} done cd export
+	sed 'quoted text' export readonly then printf
+printf grep sed --verbose export printf "$1" local test
+		then "$1" /usr/bin echo 'quoted text' cd local
+$(pwd) echo echo -eu local | awk test | printf | "$1" $(pwd)
+grep $(pwd) sed local echo 'quoted text' ${HOME}
+	| --verbose && export local 2>/dev/null x=1 awk x=1 && cd x=1 x=1
+		2>/dev/null awk && readonly sed $(pwd) then
+$(pwd) grep then readonly echo ${HOME} echo grep -eu x=1
+		cd "$@" x=1 | 'quoted text' 2>/dev/null | then 2>/dev/null
+	-eu printf grep cd $(pwd) "$@" local
+	/usr/bin -eu && then then sed $(pwd) cd
+		/usr/bin cd local && test x=1 ${HOME} "$@" then x=1 awk export && local
+	'quoted text' -eu echo local 'quoted text' 2>/dev/null
+		grep cd "$1" | -eu echo $(pwd) x=1 awk cd "$@" x=1 "$@" ${HOME} "$1"
+grep | grep 2>/dev/null ${HOME} done done $(pwd) export "$@"
+awk x=1 'quoted text' awk readonly 'quoted text' then then "$@" 2>/dev/null
+"$1" $(pwd) /usr/bin ${HOME} "$1" then readonly
+${HOME} "$1" done --verbose readonly awk test awk ${HOME} "$1" export -eu
+		${HOME} cd grep x=1 "$@" x=1 printf
+	printf grep $(pwd) cd awk | "$1" | then "$1" readonly echo 2>/dev/null $(pwd) $(pwd)
+	then local -eu | "$1" -eu export test sed local x=1 grep
+grep -eu awk grep "$1" sed awk awk 'quoted text' readonly --verbose
+	--verbose then local 2>/dev/null x=1 /usr/bin echo -eu readonly ${HOME}
+	/usr/bin local "$1" readonly
+	'quoted text' done echo echo && /usr/bin | test sed --verbose awk grep
+done readonly 'quoted text' cd echo
+		printf | -eu done "$1" ${HOME} -eu /usr/bin then 2>/dev/null "$1"
+		then printf grep printf x=1 export
+	sed | done local export --verbose echo
+x=1 && readonly printf "$1" local "$@" $(pwd) awk local "$1" local $(pwd)
+		local /usr/bin x=1 done "$@" && 'quoted text' --verbose awk echo | cd test
+		-eu grep test grep grep "$1" done export | awk | test
+echo printf printf grep | test echo
+		-eu ${HOME} printf && sed | readonly ${HOME} export
+		'quoted text' $(pwd) sed cd then printf local
+	grep --verbose 'quoted text' -eu grep $(pwd) local export
+	"$@" cd $(pwd) cd | export local grep 'quoted text' echo ${HOME} $(pwd)
+	awk | sed 2>/dev/null done test $(pwd)
+	export printf printf printf -eu
+		awk ${HOME} "$1" && export | readonly | awk done sed local test
+export printf "$1" awk echo "$1" | then grep printf then test export
+	x=1 2>/dev/null cd test -eu done grep cd && -eu echo /usr/bin awk ${HOME} 'quoted text'
+		-eu local /usr/bin cd "$@" | "$@" done grep awk -eu | local
+then 'quoted text' 2>/dev/null grep export
+'quoted text' $(pwd) "$@" 'quoted text'
+done $(pwd) "$1" export test sed sed cd
+	cd --verbose cd done sed export echo ${HOME} sed --verbose local
+sed ${HOME} 'quoted text' then sed done awk then local "$@" export readonly
+		printf $(pwd) /usr/bin echo x=1 x=1 sed echo printf echo grep
+done test local /usr/bin printf 'quoted text' echo readonly echo | sed grep sed
+	test -eu printf awk $(pwd) /usr/bin export readonly
+	awk test then readonly -eu readonly --verbose ${HOME} then
+	cd done ${HOME} then "$1" done 'quoted text' test /usr/bin
+		awk export -eu local sed 'quoted text' ${HOME} 2>/dev/null sed
+2>/dev/null "$1" test | sed export --verbose
+		then grep cd --verbose && "$@" export $(pwd) x=1 readonly
+printf --verbose grep printf readonly cd printf
+--verbose cd then /usr/bin readonly 'quoted text' printf awk echo cd 2>/dev/null
+	local 'quoted text' "$1" readonly sed 2>/dev/null $(pwd) ${HOME} 2>/dev/null done
+"$1" --verbose export ${HOME} echo 'quoted text'
+	test -eu cd readonly -eu test ${HOME} "$1" x=1
+awk then "$@" --verbose local /usr/bin 2>/dev/null 2>/dev/null /usr/bin local
+cd && 2>/dev/null -eu grep && echo awk grep 'quoted text' && done --verbose echo
+		test readonly "$1" then 'quoted text' "$@" test export export
+		readonly test done then "$@" /usr/bin
+cd 'quoted text' done | local "$1" done $(pwd) readonly readonly grep awk /usr/bin
+		"$@" /usr/bin cd done --verbose local 'quoted text'
+	readonly export local | -eu --verbose
+		sed /usr/bin /usr/bin x=1 x=1 x=1 | --verbose -eu x=1 --verbose
+	test test printf /usr/bin sed 'quoted text' && /usr/bin local printf awk then export
+		$(pwd) --verbose sed "$@" awk --verbose
+		cd test local $(pwd) grep 2>/dev/null then printf
+		grep test printf 2>/dev/null readonly --verbose
+cd x=1 export 'quoted text' done /usr/bin local /usr/bin then test readonly
+sed --verbose "$1" test |
+		| ${HOME} awk echo echo echo x=1 readonly "$@" 'quoted text'
+		awk export 'quoted text' cd cd $(pwd) grep -eu --verbose /usr/bin
+		then "$1" echo | && x=1 ${HOME} export 'quoted text' --verbose local "$@"
+	'quoted text' done grep awk && export done
+		test grep readonly then test echo awk done
+/usr/bin test printf ${HOME} test printf && printf -eu "$@" export --verbose
+	awk then ${HOME} grep echo |
+	grep "$@" grep test grep printf printf 'quoted text'
+		${HOME} cd | -eu echo grep && echo then
+		&& "$@" export x=1 --verbose awk ${HOME} "$@" /usr/bin
+	cd 'quoted text' grep export test
+		| test test then -eu sed sed && printf local && "$@" local readonly "$1" readonly
+		sed $(pwd) -eu test printf cd x=1 ${HOME} 2>/dev/null awk ${HOME} grep | cd --verbose
+export then x=1 export local printf
+done $(pwd) then printf awk /usr/bin
+	readonly cd 2>/dev/null done export export grep done 2>/dev/null
+		sed $(pwd) && "$@" sed grep grep readonly test cd && x=1 -eu &&
+export $(pwd) awk /usr/bin readonly sed sed done -eu cd local /usr/bin |
+	sed cd | -eu --verbose test -eu readonly
+		cd awk grep /usr/bin test test x=1 && printf | ${HOME} 'quoted text'
+		readonly $(pwd) done echo && -eu sed sed | -eu "$1" && "$@"
+--verbose 2>/dev/null 2>/dev/null && ${HOME} --verbose
+	x=1 2>/dev/null printf "$1" --verbose
+	echo && --verbose "$@" printf /usr/bin awk cd "$@" $(pwd)
+	cd 2>/dev/null --verbose -eu /usr/bin
+		cd -eu 'quoted text' --verbose export "$@" then printf printf && done | echo
+		export 'quoted text' done printf $(pwd) readonly cd | echo then grep sed cd grep
+		printf export cd local /usr/bin printf cd 'quoted text' -eu /usr/bin
+grep $(pwd) | done $(pwd) 2>/dev/null done printf --verbose --verbose "$1" &&
+	grep -eu $(pwd) export --verbose echo echo
+$(pwd) readonly printf printf
+awk "$@" export sed test
+		-eu sed awk awk "$1" grep 'quoted text' "$1"
+		then test 'quoted text' --verbose ${HOME} 'quoted text'
+| -eu "$@" $(pwd) "$@" echo --verbose test printf
+	x=1 x=1 grep sed grep cd cd 'quoted text'
+		/usr/bin readonly --verbose test
+	| export local printf sed | ${HOME} test then then export x=1 /usr/bin
+	'quoted text' printf awk done echo $(pwd) "$@"
+	printf /usr/bin -eu cd 2>/dev/null | readonly
+	sed -eu awk -eu 2>/dev/null --verbose awk &&
+		"$@" cd sed local done done
+		$(pwd) echo awk $(pwd) sed awk x=1 'quoted text' "$@"
+${HOME} grep printf grep sed readonly "$@" "$1" && done
+		-eu awk readonly cd | test $(pwd) "$@" --verbose export sed ${HOME} sed "$1"
+grep x=1 --verbose grep sed 'quoted text'
+cd grep export && x=1 test 2>/dev/null
+--verbose && 2>/dev/null readonly grep sed
+awk readonly done "$@" ${HOME} grep awk test readonly
+	--verbose -eu printf echo test done ${HOME} done echo "$1" ${HOME}
+	-eu 2>/dev/null | 'quoted text' test test local ${HOME} then then
+	test /usr/bin test "$1" -eu grep
+		local done export printf -eu done -eu
+	export echo --verbose test /usr/bin -eu ${HOME} ${HOME}
+then then sed x=1 cd sed "$1" 2>/dev/null grep readonly then test
+	| $(pwd) ${HOME} $(pwd)
+then sed -eu "$@" "$@" cd grep
+		/usr/bin x=1 'quoted text' -eu -eu
+		echo $(pwd) 2>/dev/null
+		local $(pwd) --verbose "$1" 'quoted text'
+		2>/dev/null -eu --verbose cd "$@" test ${HOME} readonly
+echo echo --verbose --verbose && grep sed test printf 'quoted text' echo
+		done test export local done "$1" done && ${HOME} x=1 done "$@" export
+test done cd export -eu 'quoted text'
+	-eu echo $(pwd) printf
+"$@" grep done sed awk export /usr/bin
+"$@" echo export "$@" readonly && /usr/bin 2>/dev/null --verbose export
+		sed && 'quoted text' "$@" grep sed sed printf
+$(pwd) ${HOME} -eu grep "$1"
+		/usr/bin $(pwd) 'quoted text' done x=1
+| "$@" | 'quoted text' -eu ${HOME} export --verbose | /usr/bin
+	export /usr/bin $(pwd) done export grep sed
+&& 'quoted text' export /usr/bin printf echo export grep 2>/dev/null
+sed $(pwd) grep done -eu x=1 | sed local /usr/bin local
+	-eu && $(pwd) -eu /usr/bin 'quoted text'
+		printf /usr/bin x=1 grep $(pwd) -eu done test local export
+		&& -eu && awk /usr/bin awk "$@" cd "$1" 2>/dev/null
+	| sed cd && --verbose "$@" && cd --verbose test export readonly
+		printf $(pwd) done echo done local cd readonly readonly awk 'quoted text' cd test
+		readonly readonly "$@" echo 2>/dev/null | 'quoted text'
+x=1 echo $(pwd) "$1" then export && "$@" "$@" | then /usr/bin --verbose |
+-eu "$@" printf cd printf /usr/bin readonly x=1 readonly 2>/dev/null $(pwd)
+	&& printf ${HOME} /usr/bin readonly then /usr/bin then awk | x=1 readonly
+		-eu printf x=1 | awk && ${HOME} printf printf $(pwd) && "$@" grep
+		printf x=1 then && awk sed ${HOME} sed
+"$1" printf printf "$1" printf | echo | "$1" 2>/dev/null -eu /usr/bin
+	--verbose then test | --verbose
+		$(pwd) | done "$@" echo -eu --verbose
+		local $(pwd) 'quoted text'
+&& x=1 printf /usr/bin
+'quoted text' done export 2>/dev/null --verbose then
+--verbose --verbose /usr/bin /usr/bin local /usr/bin
+	then x=1 /usr/bin test export x=1 awk /usr/bin && $(pwd) printf
+readonly | -eu done grep export echo 'quoted text' && | x=1 "$@" /usr/bin -eu
+		printf /usr/bin readonly echo | $(pwd) grep done
+		x=1 'quoted text' ${HOME} | export readonly sed -eu "$1"
+	cd "$1" --verbose readonly "$1" 'quoted text' sed awk "$1" -eu local printf
+		'quoted text' --verbose "$@" --verbose 2>/dev/null "$1" "$@" /usr/bin
+	readonly export cd 2>/dev/null
+		awk awk echo 2>/dev/null printf 'quoted text'
+		-eu "$@" && then 'quoted text'
+	--verbose -eu -eu then export then export ${HOME}
+	'quoted text' /usr/bin cd ${HOME} | grep readonly "$1" awk 'quoted text'
+test local test echo then --verbose -eu 2>/dev/null "$@" sed
+		$(pwd) awk --verbose "$@" "$@" cd
+		--verbose --verbose "$1" /usr/bin grep | sed
+grep && "$@" local "$1" | cd printf awk done /usr/bin $(pwd) awk readonly
+		'quoted text' /usr/bin cd
+	/usr/bin local "$1" then local echo | cd cd printf x=1 test done
+		2>/dev/null readonly x=1 | && done done then printf $(pwd)
+		sed cd test cd printf "$@"
+		x=1 "$1" --verbose readonly -eu x=1 "$@" local printf
+	$(pwd) awk local then 'quoted text' cd
+		done test x=1 local "$1" then echo printf 2>/dev/null
+&& awk cd echo test --verbose
+x=1 && --verbose ${HOME} && then done --verbose && && /usr/bin
+		then grep $(pwd) sed test x=1 2>/dev/null test && grep
+	--verbose "$1" grep /usr/bin printf awk echo 2>/dev/null readonly ${HOME}
+		export 2>/dev/null echo && && test then printf cd "$@" printf | sed && test &&
+	&& done grep "$@" done && /usr/bin && sed -eu echo
+		export && then $(pwd) --verbose then
+	x=1 echo printf done && -eu -eu echo awk done && 2>/dev/null 2>/dev/null &&
+| x=1 && -eu 'quoted text' --verbose
+-eu then $(pwd) && local "$1" $(pwd) ${HOME} local && printf
+		$(pwd) printf 2>/dev/null && grep
+		&& --verbose sed cd sed ${HOME} then 2>/dev/null
+		cd 2>/dev/null export done local export sed 2>/dev/null
+${HOME} /usr/bin "$1" grep $(pwd) 2>/dev/null
+awk ${HOME} printf "$@" && && -eu echo
+x=1 readonly done && "$1" -eu printf cd $(pwd) local
+		'quoted text' $(pwd) "$@" test | grep then -eu --verbose 'quoted text' printf 'quoted text'
+/usr/bin $(pwd) awk echo
+	"$1" | "$@" awk then | x=1 readonly "$@" ${HOME} readonly
+		2>/dev/null "$1" -eu && awk test local awk sed printf done
+done test "$@" && -eu && done awk 'quoted text' done
+	done $(pwd) local ${HOME}
+sed 2>/dev/null awk local "$@" readonly | then local "$@"
+		'quoted text' "$@" 'quoted text'
+		cd 'quoted text' printf 2>/dev/null
+x=1 then /usr/bin sed --verbose cd 'quoted text' then -eu echo $(pwd)
+		x=1 cd | 2>/dev/null --verbose
+		x=1 x=1 2>/dev/null awk | | then readonly awk test grep -eu sed 2>/dev/null
+&& done awk 2>/dev/null /usr/bin
+2>/dev/null && && "$@" x=1 "$1" echo x=1
+local test ${HOME} test "$@" grep cd sed | && /usr/bin cd --verbose -eu x=1 /usr/bin
+		echo readonly 'quoted text' ${HOME} then printf "$1"
+		printf -eu -eu ${HOME} 2>/dev/null local grep 2>/dev/null
+		"$1" sed -eu x=1 export cd "$1" -eu ${HOME} then export printf
+		echo then | done /usr/bin /usr/bin 2>/dev/null | x=1 printf awk echo readonly --verbose
+		cd printf readonly "$1" 2>/dev/null
+'quoted text' sed --verbose 2>/dev/null ${HOME}
+		local "$1" x=1 ${HOME}
+sed /usr/bin 'quoted text' "$@" "$@"
+--verbose printf ${HOME} local | /usr/bin /usr/bin 2>/dev/null
+		grep -eu /usr/bin printf --verbose echo done
+	printf awk then | awk export "$@" --verbose printf | /usr/bin
+	echo "$@" awk sed "$1" grep test /usr/bin $(pwd) awk && "$@" awk $(pwd) grep
+	2>/dev/null printf && "$1" x=1 sed $(pwd)
+x=1 cd test /usr/bin -eu readonly local /usr/bin export local | -eu $(pwd)
+		test && local local ${HOME}
+printf x=1 awk printf "$1" && local
+${HOME} export printf "$@" --verbose "$@" export
+		2>/dev/null -eu --verbose -eu then
+	grep echo sed cd awk test
+grep -eu sed $(pwd) "$1" --verbose "$1" -eu
+		x=1 local local /usr/bin then
+		awk echo x=1 "$1" | x=1 "$1" 'quoted text' sed echo /usr/bin done /usr/bin
+	sed test 2>/dev/null "$@" readonly && cd "$@" ${HOME} local
+		/usr/bin readonly echo done /usr/bin ${HOME} /usr/bin
+		2>/dev/null ${HOME} x=1 printf $(pwd) printf -eu --verbose --verbose
+		| $(pwd) 'quoted text' printf && readonly echo sed printf $(pwd) "$1" then | then
+sed echo cd test 2>/dev/null done "$1" 2>/dev/null --verbose then readonly done
+| "$1" ${HOME} ${HOME} 'quoted text'
+		done done test grep "$@" local
+		2>/dev/null readonly 2>/dev/null
+	test /usr/bin "$@" cd ${HOME} test readonly | then /usr/bin local x=1 local
+		x=1 | done cd cd && export test readonly export export -eu
+	test local /usr/bin done printf "$@" 'quoted text' -eu then done
+2>/dev/null "$@" export "$1" then | "$1" test readonly
+		| --verbose test sed 2>/dev/null | echo
+	'quoted text' -eu 'quoted text' -eu "$1" done export -eu readonly
+		cd /usr/bin "$1" /usr/bin /usr/bin /usr/bin ${HOME} printf
+readonly && grep 'quoted text'
+	${HOME} grep && && 2>/dev/null x=1
+then readonly | "$1" x=1 readonly then done | /usr/bin /usr/bin test cd &&
+		'quoted text' export test | then "$@" echo
+		then export echo 2>/dev/null 2>/dev/null ${HOME} && grep readonly
+	&& readonly export then ${HOME} printf $(pwd) -eu -eu ${HOME} test local
+	$(pwd) readonly awk "$1" && "$@" $(pwd) x=1 cd awk | 'quoted text' 'quoted text'
+	"$1" done | && ${HOME} | local "$1" x=1
+	'quoted text' --verbose readonly -eu readonly /usr/bin /usr/bin 2>/dev/null
+export then 'quoted text' 'quoted text' sed /usr/bin local
+x=1 done "$@" cd printf x=1 "$@" x=1 done | local local
+		${HOME} x=1 then export printf done $(pwd) 'quoted text'
+	$(pwd) 'quoted text'
+		-eu test done export test grep printf -eu then grep echo readonly
+		| grep --verbose echo "$@" export
+	then done 'quoted text' grep ${HOME} | grep awk /usr/bin
+printf test $(pwd) sed x=1 'quoted text' sed x=1 sed && echo 2>/dev/null sed
+		&& export $(pwd) 'quoted text'
+awk /usr/bin test "$@" export
+		| sed export "$@" grep ${HOME} cd --verbose local readonly "$1"
+	$(pwd) 'quoted text' then 2>/dev/null readonly
+		'quoted text' 'quoted text' --verbose
+	${HOME} local awk then -eu
+--verbose grep export done ${HOME} -eu echo test
+echo then | x=1 -eu -eu cd && | -eu --verbose
+	"$@" && then cd "$@" x=1 export then test
+		--verbose $(pwd) --verbose done x=1
+	2>/dev/null x=1 && 'quoted text'
+	local && $(pwd) && sed /usr/bin /usr/bin test "$@" "$1" "$@"
+	echo && 2>/dev/null cd ${HOME} then | --verbose then --verbose printf grep "$1"
+then echo -eu export "$@" "$1" 'quoted text' "$1" cd
+		local -eu then then test 'quoted text' ${HOME} sed /usr/bin
+	readonly grep "$1" --verbose --verbose readonly $(pwd)
+${HOME} sed done "$1" 'quoted text'
+local --verbose test grep 2>/dev/null
+"$1" then then "$1" sed 'quoted text' && 2>/dev/null -eu done && cd printf
+		'quoted text' awk $(pwd) 'quoted text' | done awk 2>/dev/null
+	$(pwd) grep 'quoted text'
+	${HOME} "$1" then done | "$@" "$1" printf
+x=1 2>/dev/null -eu sed && -eu && 2>/dev/null grep
+	done cd 'quoted text' echo x=1 readonly echo
+${HOME} "$@" "$1" sed grep "$@" && echo readonly
+		grep -eu grep /usr/bin sed x=1 export
+		/usr/bin printf /usr/bin test x=1 done grep $(pwd) cd export
+/usr/bin x=1 test --verbose awk awk
+test grep local local sed awk $(pwd) grep local sed sed "$@" x=1 && cd -eu
+test 'quoted text' -eu awk | "$@" /usr/bin cd 'quoted text' local "$@" then
+		--verbose grep x=1 ${HOME} grep --verbose "$1" "$1" | cd echo -eu "$@"
+		grep grep && sed echo ${HOME}
+	-eu echo export printf test "$1" && $(pwd)
+	2>/dev/null test local done "$@" sed && -eu | | $(pwd) "$1" 2>/dev/null
+		| && ${HOME} ${HOME} -eu "$@" done done readonly x=1 printf test $(pwd)
+'quoted text' "$@" echo /usr/bin done -eu sed -eu test x=1 -eu
+		/usr/bin --verbose x=1 then sed -eu 2>/dev/null grep
+		"$1" awk cd 'quoted text' export grep ${HOME} ${HOME} awk readonly
+	then ${HOME} --verbose x=1 cd
+'quoted text' printf sed && export readonly cd "$@" "$@" then cd
+readonly ${HOME} echo readonly cd ${HOME} awk sed "$1" printf
+		-eu readonly sed ${HOME} 'quoted text' "$1" 'quoted text' echo done grep then
+		2>/dev/null -eu test x=1 --verbose test local -eu
+echo awk ${HOME} $(pwd) --verbose $(pwd) export "$@" 2>/dev/null
+$(pwd) /usr/bin 'quoted text' -eu then echo
+	"$1" "$@" "$1" -eu test
+"$1" $(pwd) "$@" test 'quoted text' export then -eu | | echo -eu "$1" 'quoted text'
+	readonly $(pwd) /usr/bin && --verbose --verbose x=1 /usr/bin
+awk $(pwd) "$@" grep test x=1 "$1" done /usr/bin 2>/dev/null
+	--verbose --verbose -eu "$1" printf -eu sed
+/usr/bin echo | "$@" local --verbose "$@" local then echo -eu | awk --verbose
+	"$1" export local export --verbose
+		'quoted text' then /usr/bin
+		-eu sed cd cd local awk 'quoted text' --verbose
+		printf awk then cd cd export test $(pwd) ${HOME} echo cd
+"$1" "$1" -eu grep 2>/dev/null printf done done cd echo then && cd awk && readonly
+		&& readonly readonly x=1 $(pwd) local awk awk -eu
+test 'quoted text' awk 'quoted text' $(pwd) printf && $(pwd)
+| cd sed local ${HOME} "$1" grep
+printf "$@" readonly "$@" local && readonly done
+	export awk $(pwd) | local
+	'quoted text' awk done then grep echo readonly --verbose /usr/bin x=1 x=1 ${HOME}
+	/usr/bin test export printf grep test "$1" $(pwd) printf
+	--verbose grep 'quoted text' export -eu export x=1 cd echo test 'quoted text'
+		awk test cd "$1" 2>/dev/null awk $(pwd) -eu 'quoted text' cd awk printf "$@"
+	&& -eu | sed printf then ${HOME} "$1" cd /usr/bin --verbose
+		/usr/bin && done && /usr/bin
+	"$@" 2>/dev/null && | local 'quoted text'
+	2>/dev/null "$1" ${HOME} cd "$1" -eu echo export
+test ${HOME} "$@" readonly local --verbose echo "$@" -eu cd export --verbose
+	export cd awk readonly awk "$1" test sed grep echo $(pwd) 'quoted text' local cd
+| local then 2>/dev/null --verbose && $(pwd) /usr/bin "$@" x=1
+		done 'quoted text' | local -eu done --verbose grep
+export export /usr/bin -eu echo | --verbose "$@" x=1
+--verbose awk then cd readonly /usr/bin local "$1" grep then | | echo
@@ -0,0 +1,2001 @@
+	done -eu local /usr/bin then
+$(pwd) echo done echo "$1"
+printf --verbose -eu | ${HOME}
+		/usr/bin | --verbose "$1" test grep --verbose awk local done export readonly
+echo | readonly test $(pwd) sed then "$1" export ${HOME}
+	2>/dev/null cd $(pwd) x=1 export local "$1" grep /usr/bin
+		--verbose "$1" "$1" export
+		2>/dev/null -eu awk |
+	done $(pwd) awk printf "$1" test printf x=1
+	"$1" 'quoted text' "$@" "$1" | test echo "$@" $(pwd) grep awk export cd printf
+test export then echo x=1 | $(pwd) done 2>/dev/null -eu
+then local grep "$1" "$@" "$@" x=1
+		&& x=1 then -eu then echo then printf then local -eu "$@"
+		export "$1" | then | printf awk test then "$@" echo "$@"
+	'quoted text' | done sed done
+printf grep then done ${HOME} -eu | 2>/dev/null
+cd grep export printf then export grep echo sed readonly printf
+sed | && sed "$@" "$1" test $(pwd) --verbose && && printf
+		echo | "$1" "$1" echo 'quoted text' test ${HOME} && $(pwd) test cd 'quoted text'
+	then | 'quoted text' x=1 done x=1 printf ${HOME} printf readonly
+		-eu && grep 'quoted text' done done done && then
+	grep test awk --verbose x=1 done $(pwd) grep "$@" | && ${HOME} printf 'quoted text'
+	grep x=1 "$1" sed done "$1"
+	done awk readonly -eu | echo x=1 local 'quoted text' | echo
+then ${HOME} x=1 cd | ${HOME} "$1" 'quoted text' 'quoted text'
+		-eu "$@" cd echo "$1" local printf
+		printf done done awk && then /usr/bin $(pwd) then grep ${HOME} cd | readonly
+	cd -eu --verbose --verbose cd cd
+	cd export "$1" | "$@" test test "$@" | && --verbose then grep "$@" sed x=1 readonly
+"$@" "$@" ${HOME} cd readonly
+	then test echo x=1 local | cd && grep && 'quoted text'
+	--verbose printf readonly sed $(pwd) then | -eu grep "$1" /usr/bin
+${HOME} done export 'quoted text' then grep echo $(pwd) ${HOME} $(pwd) -eu 'quoted text'
+printf "$@" "$1" export local "$@" done done
+then ${HOME} awk readonly readonly printf
+		echo done test cd x=1 export test /usr/bin then
+		$(pwd) awk x=1 export && grep
+echo && test --verbose x=1 ${HOME} awk "$@" 2>/dev/null cd /usr/bin
+	sed 'quoted text' --verbose $(pwd)
+	&& | grep readonly local then
+$(pwd) x=1 echo printf cd awk "$1" | -eu && 2>/dev/null grep test
+	x=1 local 2>/dev/null -eu --verbose "$1" $(pwd) cd
+	x=1 | "$1" && x=1 && sed test | then export 'quoted text' readonly then
+--verbose readonly | export
+cd printf grep -eu local | done echo export /usr/bin "$1"
+$(pwd) export export printf test
+	awk ${HOME} test cd ${HOME} cd local echo 2>/dev/null
+	x=1 "$1" && | test then sed printf sed
+x=1 /usr/bin -eu grep grep 'quoted text'
+		x=1 sed sed export awk 2>/dev/null done "$@" --verbose --verbose local
+cd x=1 echo test awk readonly export ${HOME} "$1" printf printf | ${HOME} -eu
+	$(pwd) cd -eu cd local "$@" ${HOME} test $(pwd) 'quoted text'
+		awk echo local test -eu cd "$@" done local sed
+		${HOME} "$1" done then $(pwd) cd then $(pwd) test echo export 2>/dev/null readonly
+	echo -eu "$@" then ${HOME} echo "$1" done 2>/dev/null export -eu
+--verbose readonly export local local done grep echo && 'quoted text'
+	then /usr/bin && --verbose local cd 'quoted text' /usr/bin
+		cd && local sed then then "$@" x=1
+"$@" awk readonly /usr/bin 2>/dev/null $(pwd) readonly
+	grep --verbose x=1 awk 'quoted text' 2>/dev/null $(pwd)
+	--verbose /usr/bin "$@" -eu readonly x=1 done
+		$(pwd) --verbose -eu local echo 2>/dev/null -eu done --verbose
+x=1 $(pwd) && x=1 cd sed sed 2>/dev/null sed echo $(pwd) $(pwd)
+-eu ${HOME} --verbose 'quoted text'
+	then 2>/dev/null readonly
+		&& cd ${HOME} | cd 'quoted text' /usr/bin export /usr/bin
+| "$1" readonly 2>/dev/null
+sed cd cd done readonly --verbose --verbose "$1" echo --verbose sed cd /usr/bin
+	-eu "$@" "$@" echo 2>/dev/null
+readonly printf ${HOME} echo x=1 cd x=1 'quoted text'
+		"$1" export "$1" echo grep "$1" | --verbose done readonly
+		local 'quoted text' 2>/dev/null grep export test export
+		2>/dev/null cd | $(pwd) done $(pwd) -eu x=1 ${HOME} "$@" test
+		"$@" 2>/dev/null echo ${HOME}
+	&& echo "$@" "$@" local --verbose echo 2>/dev/null x=1 --verbose | | $(pwd) printf
+test --verbose | | grep "$@" ${HOME} test $(pwd) test | && then "$@" $(pwd)
+	grep readonly cd $(pwd) /usr/bin awk
+	test local && "$@" && export sed awk printf
+--verbose ${HOME} "$1" then "$@" "$@"
+	${HOME} $(pwd) cd && "$1" ${HOME}
+	grep ${HOME} readonly
+	&& local printf export && export done awk 2>/dev/null readonly $(pwd) then "$1"
+cd ${HOME} awk --verbose
+		"$@" 'quoted text' sed -eu "$1" printf --verbose then grep
+	cd | ${HOME} ${HOME} ${HOME} "$@" export test $(pwd) -eu
+done grep "$@" /usr/bin
+	printf readonly readonly --verbose done /usr/bin -eu -eu sed x=1 grep ${HOME}
+	'quoted text' ${HOME} && && then echo && awk /usr/bin echo then --verbose then
+		2>/dev/null cd awk /usr/bin sed echo echo awk x=1 export "$@" then 'quoted text'
+${HOME} awk echo readonly
+	grep && && | printf test 2>/dev/null
+		awk local --verbose cd readonly echo test x=1
+		$(pwd) /usr/bin /usr/bin 2>/dev/null
+	readonly $(pwd) done "$1" test test
+readonly 'quoted text' cd done | export --verbose x=1 "$@" test | 'quoted text'
+		"$@" grep then awk grep $(pwd) --verbose
+	grep test && then x=1 done --verbose cd 'quoted text'
+awk 2>/dev/null test test 'quoted text'
+	'quoted text' "$@" cd -eu local readonly done "$@"
+		"$1" | /usr/bin done --verbose grep | "$1" | "$@" sed "$@" "$@"
+	| /usr/bin done local 'quoted text' sed
+		$(pwd) --verbose -eu 'quoted text' "$@" then "$1" export local local -eu
+		readonly -eu | 2>/dev/null done readonly awk printf x=1 'quoted text' 2>/dev/null
+		-eu --verbose readonly local /usr/bin
+		&& x=1 readonly echo awk local 2>/dev/null 'quoted text' "$1" local
+awk export then x=1 ${HOME} cd local --verbose --verbose
+	readonly cd sed $(pwd) export "$1" ${HOME} readonly
+		'quoted text' $(pwd) export && "$@" sed then then ${HOME}
+		printf export /usr/bin awk --verbose local x=1 && && --verbose then readonly
+	${HOME} "$1" export cd done -eu then
+cd done && $(pwd) /usr/bin test printf local
+		/usr/bin local done done | && done export echo /usr/bin test
+		printf awk "$@" 2>/dev/null done -eu --verbose "$@" | --verbose x=1
+| grep 'quoted text' done printf readonly
+	local "$@" grep cd done then 2>/dev/null && local export /usr/bin
+	$(pwd) test 'quoted text' done done &&
+then test readonly printf done && "$@" then --verbose local && then awk cd readonly
+	&& | $(pwd) $(pwd) grep export echo x=1 "$1"
+"$@" printf -eu | test x=1 awk done "$@" --verbose 'quoted text'
+		x=1 local ${HOME} --verbose x=1 test /usr/bin | "$@" "$1" readonly
+		"$@" export "$@" | sed && $(pwd) "$1" sed awk | "$@"
+	"$@" sed cd awk cd test /usr/bin
+	export $(pwd) done awk
+export test --verbose export export -eu 'quoted text'
+		2>/dev/null grep grep local done --verbose --verbose grep "$@" --verbose readonly
+		$(pwd) printf sed grep --verbose 2>/dev/null printf
+then then $(pwd) done sed printf "$1" "$@" "$1" done then ${HOME} then awk sed
+		"$1" local grep readonly --verbose
+| $(pwd) export cd echo grep "$@" cd test export 'quoted text' export
+readonly cd --verbose $(pwd) $(pwd) "$1" cd && awk grep ${HOME}
+cd then /usr/bin then echo | sed $(pwd) done grep test --verbose -eu
+2>/dev/null x=1 echo "$@" --verbose printf local
+	readonly --verbose export echo test
+sed export | 2>/dev/null ${HOME} -eu grep sed readonly -eu awk "$1"
+	&& export echo && awk cd export | "$@" then 'quoted text'
+--verbose && 'quoted text' printf 'quoted text' && 2>/dev/null
+	then local --verbose --verbose -eu echo echo ${HOME}
+		"$@" /usr/bin export cd 'quoted text' done then && cd printf -eu $(pwd) --verbose
+	then cd grep $(pwd) readonly cd $(pwd) ${HOME} -eu readonly
+echo x=1 export --verbose "$@" | 2>/dev/null ${HOME} ${HOME} "$@"
+	cd x=1 cd 2>/dev/null
+${HOME} local x=1 awk printf cd local "$@" --verbose test printf grep
+		| awk cd ${HOME} grep grep grep /usr/bin --verbose grep $(pwd)
+		echo "$1" awk awk --verbose ${HOME} awk ${HOME} then printf && && local
+then --verbose export cd -eu | printf then grep /usr/bin export test $(pwd) test
+	x=1 2>/dev/null x=1 $(pwd) | "$1" cd && echo cd ${HOME}
+		x=1 readonly local "$1" | export echo 'quoted text'
+		test sed readonly grep 2>/dev/null && sed readonly $(pwd)
+	&& printf grep 'quoted text' local
+-eu 'quoted text' test done then export -eu echo 'quoted text' readonly
+		"$@" -eu test 2>/dev/null $(pwd) "$1" && x=1 x=1 grep awk local
+		done cd readonly test x=1 printf then x=1 local -eu test then -eu done
+	echo local && 2>/dev/null done $(pwd) "$@" test printf echo "$@" 2>/dev/null
+		/usr/bin test "$1" x=1
+&& | ${HOME} test sed -eu $(pwd) | ${HOME}
+echo test "$1" echo -eu $(pwd) grep --verbose "$@" /usr/bin grep cd echo
+		readonly /usr/bin 'quoted text' readonly readonly 'quoted text'
+2>/dev/null && readonly cd --verbose && 'quoted text'
+sed x=1 test "$@" then test $(pwd) done local printf echo awk sed -eu grep
+	then readonly x=1 "$@" x=1 then /usr/bin awk x=1
+| sed sed ${HOME} awk test local /usr/bin awk --verbose
+		cd -eu readonly 2>/dev/null readonly "$@" | --verbose
+cd printf cd test local /usr/bin cd readonly grep printf "$1" export
+| "$@" then 2>/dev/null && 'quoted text' /usr/bin $(pwd) echo export && x=1
+		then && 'quoted text' sed readonly
+	"$@" 2>/dev/null export ${HOME} done grep local test
+	| local awk /usr/bin cd sed "$1" $(pwd) "$1" /usr/bin printf done test 2>/dev/null
+		${HOME} ${HOME} "$@" 2>/dev/null "$1" --verbose printf printf "$@" awk grep
+		then $(pwd) ${HOME} "$@" "$@" done test echo echo
+awk then export readonly local "$@" cd -eu sed -eu awk ${HOME} && awk local
+		done then ${HOME} $(pwd) local local then 2>/dev/null grep echo 'quoted text'
+		--verbose awk readonly -eu
+sed ${HOME} 2>/dev/null done grep x=1 "$1" printf grep printf done readonly
+		2>/dev/null 'quoted text' --verbose "$1" cd --verbose cd cd then printf local
+echo -eu -eu awk --verbose
+		cd done -eu && $(pwd) readonly sed --verbose
+	printf then cd | echo "$@" 'quoted text' echo 2>/dev/null
+		-eu "$@" export test then export done
+	${HOME} /usr/bin cd sed awk printf -eu -eu echo 2>/dev/null echo
+	-eu cd sed sed --verbose printf sed x=1 | -eu "$@" done cd test
+		local readonly sed test $(pwd) x=1 export
+	"$@" grep export | export -eu awk readonly
+	"$1" sed -eu grep echo "$@" test | grep
+	grep cd then printf 2>/dev/null export then x=1 "$@" readonly awk local then
+	local export printf export export | echo export cd echo --verbose done
+		printf echo -eu 'quoted text'
+	test export x=1 'quoted text' /usr/bin test test -eu x=1 echo | echo 'quoted text'
+	readonly x=1 then then -eu test ${HOME} && -eu printf 'quoted text' printf awk
+		cd "$@" --verbose local grep && --verbose printf grep
+test && ${HOME} "$1" readonly -eu test
+	2>/dev/null $(pwd) && $(pwd) | && /usr/bin
+	2>/dev/null --verbose | -eu test awk x=1 && done /usr/bin
+		grep $(pwd) local | cd && local done --verbose done | /usr/bin awk
+grep printf echo readonly && 2>/dev/null cd --verbose "$@" && -eu "$1" export
+"$1" "$1" ${HOME} 2>/dev/null local awk "$@" "$@" | /usr/bin
+	$(pwd) "$@" printf -eu && | export sed x=1 --verbose --verbose | then
+		cd | done -eu "$@" local ${HOME}
+/usr/bin 2>/dev/null cd export -eu
+	&& echo local grep awk readonly export "$1" local ${HOME} 'quoted text' printf
+$(pwd) awk /usr/bin && "$1" export
+	printf && grep sed ${HOME} "$1" test "$1" readonly local "$1"
+sed 'quoted text' echo --verbose 2>/dev/null | $(pwd) grep
+		-eu ${HOME} sed local -eu ${HOME} 'quoted text' "$1" awk "$@" done && sed
+		echo /usr/bin printf awk "$@" local $(pwd) awk
+	/usr/bin awk -eu cd /usr/bin $(pwd) ${HOME} sed ${HOME} $(pwd)
+	grep awk "$@" local "$1" /usr/bin
+	echo "$@" test then readonly sed cd test "$@" ${HOME} awk --verbose
+	'quoted text' done ${HOME} printf $(pwd) printf | grep | /usr/bin echo ${HOME}
+export export sed | test printf -eu ${HOME} sed "$@" test
+	"$@" then $(pwd) ${HOME} $(pwd) 'quoted text' --verbose then sed awk "$1" "$@"
+		awk readonly grep x=1 test sed
+local ${HOME} | /usr/bin grep
+		/usr/bin && readonly ${HOME} readonly sed 'quoted text'
+-eu x=1 | -eu awk sed readonly test then $(pwd) test $(pwd) x=1
+$(pwd) && local -eu then ${HOME} "$1" done
+"$1" $(pwd) then 'quoted text' grep echo grep sed awk grep
+		2>/dev/null sed then -eu $(pwd) awk
+2>/dev/null awk -eu done then x=1
+		/usr/bin local x=1 2>/dev/null printf local done
+done echo test test echo awk
+		grep test sed cd then | local done 2>/dev/null grep --verbose done 2>/dev/null
+	export export && -eu | grep 'quoted text' | sed 2>/dev/null /usr/bin ${HOME}
+		done export test x=1 cd --verbose grep readonly --verbose x=1 'quoted text'
+		then cd ${HOME} printf x=1
+	awk && printf --verbose | -eu cd /usr/bin
+	echo sed readonly $(pwd) 'quoted text' export then 2>/dev/null readonly
+	'quoted text' sed then $(pwd) -eu /usr/bin then grep local /usr/bin --verbose
+		printf local 2>/dev/null readonly
+--verbose && /usr/bin export test | printf cd | cd ${HOME} sed
+		sed readonly 'quoted text' "$@" x=1 --verbose printf export then
+echo x=1 cd $(pwd) sed | x=1 test /usr/bin $(pwd) sed 'quoted text'
+	echo 2>/dev/null readonly && then export -eu
+&& x=1 grep && 2>/dev/null then 2>/dev/null | 2>/dev/null
+		cd "$1" sed -eu readonly sed 'quoted text' local /usr/bin
+		--verbose 'quoted text' ${HOME} grep ${HOME} printf && --verbose grep 'quoted text'
+		done ${HOME} readonly cd -eu printf
+		| /usr/bin echo $(pwd) -eu -eu
+	x=1 test cd && sed /usr/bin "$1"
+		$(pwd) export -eu printf local 'quoted text' |
+	| cd done $(pwd) cd echo 'quoted text' local | x=1 readonly sed
+	export && "$@" $(pwd) awk
+		awk 'quoted text' "$1" export
+sed printf readonly x=1 done --verbose --verbose ${HOME}
+		test local 2>/dev/null | $(pwd) -eu "$@" 'quoted text' test export
+		cd 2>/dev/null && cd "$1" /usr/bin ${HOME} -eu done | grep cd sed /usr/bin
+		"$@" echo 2>/dev/null done --verbose printf 2>/dev/null readonly readonly
+		done 2>/dev/null "$1" cd 2>/dev/null awk x=1 export
+x=1 grep printf "$@" $(pwd) "$1" ${HOME} test test test echo ${HOME} $(pwd)
+-eu "$1" done cd readonly awk "$@" "$1" echo echo test export
+		2>/dev/null 2>/dev/null export x=1 local
+		awk $(pwd) local export readonly done printf "$1" grep 2>/dev/null
+	done $(pwd) -eu cd /usr/bin test "$1" "$@" &&
+2>/dev/null cd test echo done sed
+'quoted text' export | sed
+	-eu x=1 readonly then echo readonly local
+		"$1" printf sed 2>/dev/null --verbose sed awk
+	"$1" "$@" echo /usr/bin 'quoted text'
+2>/dev/null -eu printf local "$@"
+		local readonly 2>/dev/null && "$@" sed && 2>/dev/null ${HOME} /usr/bin
+	&& x=1 awk 2>/dev/null printf local && && 'quoted text' grep "$1"
+awk printf 2>/dev/null cd /usr/bin 'quoted text' /usr/bin
+	printf $(pwd) test export $(pwd) grep ${HOME}
+		&& | | sed grep -eu done
+	sed /usr/bin && cd "$1" then && |
+printf -eu sed then echo "$@"
+	2>/dev/null -eu x=1 awk "$@" && -eu $(pwd) done
+		"$1" | readonly /usr/bin 'quoted text'
+		local -eu then | then -eu
+		&& awk done readonly readonly /usr/bin x=1 then
+x=1 "$@" local done ${HOME} $(pwd) --verbose 'quoted text' awk "$1"
+	printf done && awk cd "$1"
+	awk test done cd 'quoted text' 2>/dev/null ${HOME}
+		'quoted text' "$@" then /usr/bin export grep | sed grep x=1 /usr/bin grep x=1 then
+		&& printf echo 'quoted text'
+		--verbose test "$@" then | ${HOME} 'quoted text' grep export
+2>/dev/null grep && 2>/dev/null "$1" ${HOME} readonly sed 2>/dev/null | ${HOME}
+		"$@" echo echo -eu printf test awk /usr/bin echo 'quoted text'
+cd printf grep then export -eu 'quoted text' --verbose
+"$1" "$1" local grep x=1 sed "$@" "$@" | ${HOME}
+awk "$@" then && then x=1 printf printf /usr/bin 2>/dev/null -eu "$@"
+		"$1" "$@" /usr/bin | "$@" test ${HOME} --verbose grep ${HOME} printf
+	cd export export then $(pwd) $(pwd) printf x=1 sed awk cd readonly 2>/dev/null
+	sed 2>/dev/null 'quoted text' $(pwd) awk test readonly printf 'quoted text'
+	x=1 --verbose /usr/bin --verbose "$@" test /usr/bin printf cd done then ${HOME}
+		2>/dev/null "$@" grep x=1 | grep ${HOME}
+		&& export awk test done
+| ${HOME} | && grep -eu printf ${HOME} && /usr/bin grep /usr/bin export --verbose
+		${HOME} /usr/bin && --verbose && done
+		&& x=1 then done awk "$@" x=1 ${HOME} x=1 test sed $(pwd) x=1 "$@" grep -eu
+	cd export x=1 && --verbose done /usr/bin grep echo x=1 x=1 cd
+		&& 'quoted text' cd -eu $(pwd) && x=1 grep $(pwd) printf
+		printf export echo "$1" "$@" grep local 'quoted text'
+	'quoted text' -eu 'quoted text' --verbose 2>/dev/null then 2>/dev/null "$@"
+'quoted text' test then test done 2>/dev/null sed "$@" echo /usr/bin x=1
+	cd "$1" x=1 readonly "$@" $(pwd) cd printf "$1"
+	grep 'quoted text' done awk x=1 cd done && 2>/dev/null 2>/dev/null
+		cd then awk done awk echo test then x=1 | ${HOME}
+&& readonly awk /usr/bin -eu then --verbose
+	done "$1" 2>/dev/null --verbose
+		/usr/bin /usr/bin ${HOME} sed done
+cd cd echo ${HOME} echo test 'quoted text' sed grep | && x=1 "$1"
+		"$@" printf ${HOME} local printf cd --verbose
+grep cd printf --verbose 'quoted text' "$@" test
+2>/dev/null --verbose 'quoted text' && $(pwd)
+	/usr/bin cd -eu && ${HOME} awk | export
+echo /usr/bin && cd ${HOME} readonly cd echo printf && then grep "$1"
+	awk | export test local 2>/dev/null x=1 --verbose done | | test echo export
+		sed 'quoted text' $(pwd) 2>/dev/null printf awk grep sed export readonly
+&& /usr/bin echo ${HOME} "$1" then awk sed
+"$@" done ${HOME} -eu local echo cd cd && x=1 awk /usr/bin
+"$@" 'quoted text' $(pwd) 2>/dev/null grep 'quoted text' cd test
+local cd sed 'quoted text' "$1" 2>/dev/null local awk
+	2>/dev/null x=1 | test test x=1 echo cd then done ${HOME} /usr/bin
+cd then | readonly && 'quoted text' /usr/bin cd ${HOME} awk done "$@" echo
+		local awk then x=1 awk | local && "$@" readonly export
+		cd /usr/bin ${HOME} x=1 test ${HOME} 'quoted text' sed 2>/dev/null | sed
+-eu export /usr/bin echo then then grep local echo /usr/bin grep echo /usr/bin
+		done 2>/dev/null 2>/dev/null
+readonly ${HOME} cd --verbose |
+sed local x=1 printf --verbose done then -eu sed "$1" awk 'quoted text'
+	2>/dev/null /usr/bin export
+	done /usr/bin sed printf grep done "$1" sed "$@"
+done "$1" awk -eu 2>/dev/null
+	export | export then ${HOME} sed echo
+		&& --verbose sed echo
+		printf cd test 2>/dev/null -eu cd printf local cd /usr/bin grep -eu test x=1
+--verbose "$@" -eu then "$1" echo done grep 2>/dev/null
+		echo readonly done "$@" done --verbose awk 'quoted text' $(pwd)
+	awk printf 2>/dev/null done awk --verbose
+	sed ${HOME} awk cd | $(pwd)
+	-eu $(pwd) printf ${HOME} then test -eu grep "$1" "$@"
+local | readonly grep "$@" echo export done then $(pwd) --verbose -eu grep echo
+	grep -eu && export ${HOME} test cd local "$1" awk cd grep
+	printf 'quoted text' "$@" "$@" echo
+		"$1" sed $(pwd) 2>/dev/null x=1 echo "$@" awk && ${HOME} "$1" cd ${HOME} awk
+		$(pwd) local export 'quoted text' local -eu $(pwd) && sed printf | -eu then readonly
+grep then x=1 local /usr/bin ${HOME} then awk
+| readonly awk sed then cd sed export then sed then --verbose
+		done echo -eu local --verbose "$@" "$1" test ${HOME} "$@" 2>/dev/null local
+		printf 'quoted text' ${HOME} test "$1" "$@" printf "$1" then then echo "$@" test
+		readonly awk "$@" -eu export awk x=1 readonly
+echo test printf && echo 2>/dev/null
+	"$1" echo -eu | grep printf readonly test ${HOME} $(pwd) printf $(pwd)
+	${HOME} /usr/bin grep local 'quoted text' | done echo && -eu ${HOME} echo
+		awk awk $(pwd) && ${HOME}
+		sed && local local | then done /usr/bin "$1"
+cd readonly "$1" local readonly -eu | export echo
+		sed 'quoted text' test grep -eu ${HOME} --verbose 'quoted text'
+--verbose /usr/bin 2>/dev/null /usr/bin export /usr/bin --verbose echo $(pwd) -eu
+		then cd then done 'quoted text'
+	then sed then done && awk test readonly x=1 export /usr/bin readonly
+local -eu --verbose cd 2>/dev/null local
+	grep /usr/bin readonly "$@" -eu cd then done --verbose local local done cd cd
+		local | sed sed 2>/dev/null local awk 2>/dev/null
+		$(pwd) awk --verbose x=1 local /usr/bin 2>/dev/null sed && then cd local "$@"
+then done test awk --verbose readonly "$1"
+		sed printf x=1 echo ${HOME} | --verbose export 'quoted text' export
+2>/dev/null ${HOME} | echo readonly /usr/bin then 2>/dev/null
+'quoted text' 2>/dev/null $(pwd) && echo cd awk then "$@" export ${HOME}
+cd | cd 'quoted text' -eu then test
+cd "$@" then local then
+done awk -eu test cd printf readonly "$@" --verbose test done "$1" 2>/dev/null
+2>/dev/null export 2>/dev/null local awk local
+		-eu sed grep readonly -eu && done x=1 | $(pwd) done 'quoted text'
+"$@" | done | printf sed /usr/bin ${HOME} 'quoted text' x=1 awk export
+		&& -eu awk done -eu /usr/bin 'quoted text'
+		-eu && --verbose done x=1 $(pwd) 'quoted text' readonly awk $(pwd) 'quoted text'
+| sed 2>/dev/null $(pwd) grep sed grep | 'quoted text' && local echo
+"$1" grep /usr/bin -eu "$@" 'quoted text' awk done
+	${HOME} --verbose awk echo && &&
+	x=1 cd grep -eu 'quoted text' 'quoted text' -eu
+		2>/dev/null "$@" local echo grep local
+-eu ${HOME} cd test then echo ${HOME} local $(pwd) echo "$@" 'quoted text'
+		then done x=1 readonly | ${HOME} sed --verbose /usr/bin done
+		then | | 'quoted text' done 2>/dev/null echo local echo grep
+	2>/dev/null -eu "$1" awk awk export /usr/bin
+		${HOME} export readonly --verbose printf "$1" ${HOME} /usr/bin
+then sed | then 2>/dev/null 2>/dev/null && awk 2>/dev/null awk local
+grep x=1 "$1" readonly echo -eu $(pwd) 'quoted text' | "$@" "$@" --verbose awk 2>/dev/null
+'quoted text' local local --verbose 'quoted text' "$@" | export done readonly
+		then test 2>/dev/null /usr/bin $(pwd) export
+	sed readonly awk | | "$1" ${HOME} x=1 export sed && grep
+	"$1" readonly -eu local done cd grep -eu 2>/dev/null --verbose
+	--verbose $(pwd) sed grep export 'quoted text'
+	echo x=1 grep 'quoted text' "$1" printf
+	done | export $(pwd) --verbose awk local done local | &&
+x=1 ${HOME} "$1" done awk /usr/bin "$@" $(pwd) export export "$@"
+	echo then grep awk && /usr/bin then awk
+	readonly x=1 $(pwd) $(pwd) printf test test
+$(pwd) awk sed local then done cd export then 'quoted text' 2>/dev/null
+		'quoted text' && "$@" awk /usr/bin export "$@" 'quoted text'
+		then ${HOME} printf x=1 'quoted text' readonly ${HOME} | "$@" -eu
+		"$@" x=1 --verbose "$@" $(pwd) local
+	echo local && then --verbose 2>/dev/null $(pwd) then /usr/bin | export
+		2>/dev/null && $(pwd)
+readonly "$1" done 'quoted text' awk then done x=1
+		test "$@" readonly 2>/dev/null 'quoted text' 2>/dev/null
+	-eu readonly export /usr/bin | export 2>/dev/null 2>/dev/null | 2>/dev/null
+${HOME} "$@" $(pwd) /usr/bin --verbose
+		done -eu awk grep --verbose && --verbose
+	printf export "$1" cd done done 2>/dev/null | echo | then
+		"$1" done cd $(pwd) --verbose
+"$@" done "$@" x=1 awk | | "$@" then local cd then
+	"$@" grep | | "$@" then
+	sed readonly ${HOME} local readonly
+awk readonly awk readonly test 2>/dev/null "$1" readonly /usr/bin export 'quoted text'
+		${HOME} echo --verbose "$1" cd export x=1 "$1" sed export "$@" printf printf
+	/usr/bin "$@" 'quoted text' then sed cd 'quoted text' --verbose
+	'quoted text' local $(pwd) sed printf then echo
+grep "$@" x=1 && grep x=1 'quoted text' printf sed done "$1"
+	readonly 2>/dev/null && grep ${HOME} printf x=1 $(pwd) |
+	then -eu -eu x=1 x=1 $(pwd) ${HOME} -eu | 'quoted text' "$1" -eu echo sed
+	done done 2>/dev/null && ${HOME} | && /usr/bin
+		$(pwd) then 2>/dev/null grep done -eu
+echo 'quoted text' && done -eu awk && test && ${HOME} local "$@"
+	x=1 local awk grep cd echo /usr/bin ${HOME}
+		export -eu 'quoted text' awk echo readonly $(pwd) export
+		x=1 -eu | done printf -eu $(pwd) done echo sed
+		test ${HOME} test done export ${HOME} | && && export ${HOME}
+	sed echo then 'quoted text'
+-eu local export printf
+$(pwd) --verbose done test grep test /usr/bin 2>/dev/null local printf
+	--verbose --verbose grep grep ${HOME} awk
+	'quoted text' "$@" "$1" && local readonly sed
+&& awk local ${HOME} cd then -eu $(pwd) | then | printf
+	cd $(pwd) echo x=1 2>/dev/null then && test printf
+/usr/bin readonly -eu -eu -eu test then 2>/dev/null readonly && --verbose
+	${HOME} "$1" export 'quoted text' ${HOME} ${HOME} then sed ${HOME} then /usr/bin
+	sed 2>/dev/null printf ${HOME} -eu && sed local "$@" | then | ${HOME}
+'quoted text' /usr/bin echo
+	then export then ${HOME}
+		then printf done then 2>/dev/null awk
+	grep /usr/bin done sed "$1" awk
+${HOME} | | awk -eu | export ${HOME} export printf then --verbose then
+		2>/dev/null sed done cd | sed x=1 grep echo "$1" export 2>/dev/null
+	--verbose export awk local -eu local -eu
+		done -eu echo -eu sed | done local
+	sed /usr/bin sed cd then /usr/bin sed awk -eu awk cd sed local --verbose 'quoted text'
+export test local cd "$@" echo test "$@" ${HOME} done readonly $(pwd)
+		then test cd test 'quoted text' grep then export test printf awk -eu && test
+done $(pwd) printf /usr/bin cd -eu /usr/bin && grep &&
+		export 2>/dev/null cd then cd /usr/bin awk
+		/usr/bin echo local ${HOME}
+	"$@" $(pwd) printf cd -eu echo printf $(pwd) grep then "$@" echo
+	| 'quoted text' cd local awk awk "$@" -eu
+		x=1 local ${HOME} printf ${HOME} "$@" sed export
+		echo | sed && --verbose then cd ${HOME} /usr/bin done 2>/dev/null cd grep
+'quoted text' printf 'quoted text'
+		then | test "$@" export cd grep local 2>/dev/null
+		then export echo awk -eu "$@"
+	awk printf readonly readonly done cd grep sed local "$@" /usr/bin --verbose
+		awk readonly echo /usr/bin export printf readonly && cd $(pwd) --verbose
+	sed ${HOME} ${HOME} test readonly /usr/bin cd ${HOME} "$1" awk
+	awk --verbose 'quoted text' 'quoted text' 2>/dev/null "$1" 'quoted text'
+cd x=1 local readonly "$1" echo 'quoted text'
+${HOME} echo cd done then then sed "$@" /usr/bin "$1" ${HOME} x=1 && awk
+	echo /usr/bin readonly $(pwd) "$1" "$@" local /usr/bin cd -eu then
+		awk local local "$1" -eu cd
+	2>/dev/null readonly x=1 /usr/bin test test readonly grep then /usr/bin
+&& && && --verbose test && 'quoted text'
+		"$1" ${HOME} "$@" /usr/bin 'quoted text' 2>/dev/null
+	-eu 'quoted text' 2>/dev/null 2>/dev/null echo awk
+		/usr/bin && done "$@" export $(pwd) cd 'quoted text'
+x=1 ${HOME} readonly sed awk
+	local export -eu | test export done -eu | echo $(pwd) done 'quoted text'
+		local && x=1 $(pwd) readonly ${HOME}
+	&& readonly echo 'quoted text'
+	sed readonly export x=1 ${HOME} awk --verbose $(pwd) && |
+		cd | $(pwd) export && && then && readonly export sed 'quoted text' | ${HOME}
+echo sed then $(pwd) awk 'quoted text' export x=1 done --verbose
+local then "$1" awk printf
+		$(pwd) done ${HOME} 'quoted text' done x=1 done --verbose && grep
+awk -eu grep 'quoted text' cd x=1
+	cd ${HOME} "$1" readonly cd echo --verbose
+2>/dev/null x=1 done local $(pwd) x=1 then cd -eu /usr/bin 'quoted text'
+		then -eu --verbose test test ${HOME} -eu grep local
+done --verbose x=1 ${HOME} readonly 2>/dev/null -eu cd $(pwd) 'quoted text'
+sed export && -eu readonly
+		${HOME} ${HOME} done --verbose echo | --verbose
+		awk -eu && cd grep awk
+		cd echo readonly local x=1 2>/dev/null readonly "$@" sed /usr/bin
+	2>/dev/null test --verbose readonly 'quoted text' 2>/dev/null "$1" "$1" x=1 sed
+echo "$1" local -eu "$@"
+		local "$@" then "$@" 'quoted text' --verbose 2>/dev/null printf x=1
+		$(pwd) cd 'quoted text' | --verbose /usr/bin /usr/bin x=1 &&
+		local $(pwd) local && local local -eu sed readonly
+then local echo 'quoted text' 2>/dev/null export 2>/dev/null local export
+	sed "$@" --verbose cd grep 2>/dev/null
+		readonly done test export done --verbose
+		-eu awk 2>/dev/null ${HOME} test export
+	cd cd ${HOME} test cd
+	export cd | cd --verbose test -eu
+		sed export readonly "$@" --verbose awk readonly
+"$@" && sed test 'quoted text' done
+-eu x=1 printf && /usr/bin "$@" "$1" done | local | then "$1" | cd
+		x=1 echo awk test sed echo readonly
+	"$1" /usr/bin export export ${HOME} x=1 echo $(pwd) readonly "$1" "$@" x=1 readonly
+/usr/bin awk "$1" 'quoted text' awk
+		--verbose "$@" awk cd echo /usr/bin test "$@" $(pwd) test then cd
+		test local 'quoted text' cd ${HOME} echo awk -eu export -eu done
+		-eu export grep sed | --verbose $(pwd) readonly printf done ${HOME} -eu awk
+then 'quoted text' "$1" $(pwd) /usr/bin then sed /usr/bin "$1" export
+$(pwd) -eu sed echo readonly
+echo --verbose 'quoted text' | --verbose ${HOME} readonly 2>/dev/null
+	--verbose sed --verbose local test local | echo echo echo
+	'quoted text' done printf then 2>/dev/null
+done done echo | export 2>/dev/null --verbose
+		--verbose && 2>/dev/null $(pwd) ${HOME} /usr/bin printf then $(pwd) local
+	--verbose readonly then then -eu printf /usr/bin 2>/dev/null
+		${HOME} ${HOME} && printf test -eu awk $(pwd) 'quoted text'
+		done test awk done printf
+| 'quoted text' /usr/bin $(pwd)
+	/usr/bin grep "$1" | awk done echo 2>/dev/null
+	awk echo x=1 export sed echo grep printf
+$(pwd) x=1 'quoted text' local
+"$@" sed --verbose echo ${HOME} printf 'quoted text'
+${HOME} printf cd printf
+		printf then done local x=1 && local cd cd cd && ${HOME} x=1 export "$1" ${HOME}
+		grep 'quoted text' grep cd local readonly readonly "$1" printf cd -eu $(pwd)
+		x=1 export "$1" grep readonly export grep grep printf test
+printf 'quoted text' grep test
+| readonly $(pwd) export /usr/bin "$1"
+		| export $(pwd) test x=1 echo $(pwd) -eu "$1" ${HOME} $(pwd) grep &&
+"$1" --verbose sed grep /usr/bin 'quoted text' export && awk done "$1" ${HOME}
+done "$@" grep grep done test printf
+	grep 'quoted text' "$@" "$@" sed printf export $(pwd) local
+		'quoted text' $(pwd) -eu | sed --verbose
+	test readonly done $(pwd) done sed then x=1
+		$(pwd) then 2>/dev/null "$1" done printf $(pwd) | $(pwd) then echo
+local --verbose done printf "$@" --verbose
+	test readonly awk && x=1 echo sed "$@" /usr/bin
+		cd 'quoted text' $(pwd) && | -eu then
+		export awk "$@" local cd echo
+		test -eu export done awk sed sed $(pwd) &&
+		done printf --verbose export "$1" --verbose test export | grep local grep
+	-eu printf printf x=1 local /usr/bin
+		| test && "$1" --verbose 2>/dev/null
+	&& x=1 cd -eu then echo grep && printf "$@" | -eu then
+		"$1" sed --verbose sed && /usr/bin sed --verbose done grep cd echo x=1
+		echo | "$1" x=1 done $(pwd) 'quoted text' 2>/dev/null x=1 | | -eu
+	echo "$1" grep | $(pwd) x=1 "$1" "$1" grep export /usr/bin
+	--verbose echo && 2>/dev/null 2>/dev/null printf export "$@" "$1" sed "$1" 'quoted text'
+	local 'quoted text' x=1 then ${HOME} then 'quoted text'
+		readonly local export --verbose
+grep printf "$@" 2>/dev/null --verbose readonly echo grep readonly
+		--verbose x=1 awk -eu | -eu local ${HOME} $(pwd) then printf -eu local "$1"
+		awk -eu 2>/dev/null grep done "$@" printf | awk ${HOME} done x=1
+	local cd /usr/bin done -eu grep x=1 then then "$1" local "$1"
+	awk printf 2>/dev/null "$@" cd | ${HOME} "$1" 'quoted text' | && --verbose
+	&& $(pwd) cd ${HOME} sed --verbose grep ${HOME} "$1" done "$@" 2>/dev/null
+	grep -eu && local done done grep "$1" 'quoted text'
+	cd && sed 'quoted text' ${HOME} local export local | --verbose /usr/bin local
+		then readonly done awk test 2>/dev/null then ${HOME} echo then sed x=1 'quoted text'
+"$1" ${HOME} sed echo ${HOME} sed echo cd then done "$@" sed awk | 'quoted text'
+	2>/dev/null awk /usr/bin ${HOME} printf 2>/dev/null local | export test 'quoted text'
+		2>/dev/null | ${HOME} readonly export awk
+		--verbose x=1 grep x=1 sed -eu
+		/usr/bin grep | | --verbose local local cd test readonly cd grep
+		$(pwd) 'quoted text'
+		| readonly && cd readonly awk "$1" echo test echo test awk awk 2>/dev/null
+grep echo local ${HOME} x=1 'quoted text' printf
+		cd 'quoted text' -eu cd test sed echo
+	grep -eu "$1" printf readonly readonly cd x=1 grep
+	'quoted text' "$1" -eu "$@" awk 2>/dev/null cd done test
+"$@" ${HOME} printf done | | then cd done
+		'quoted text' printf grep done x=1 -eu printf 'quoted text' cd export
+		${HOME} export 'quoted text'
+		2>/dev/null /usr/bin echo grep readonly "$@" ${HOME} --verbose 'quoted text'
+-eu awk -eu export grep sed then test done 'quoted text' done echo grep
+		readonly 2>/dev/null echo test grep x=1 export /usr/bin
+		grep $(pwd) cd "$1" 'quoted text' cd then /usr/bin
+x=1 done export done $(pwd) printf sed test /usr/bin $(pwd)
+awk local printf "$@" 2>/dev/null && | && awk --verbose
+2>/dev/null "$@" x=1 && ${HOME}
+	-eu /usr/bin then 'quoted text' | printf --verbose echo $(pwd) ${HOME} 2>/dev/null
+x=1 x=1 && && x=1 "$1" cd --verbose ${HOME} /usr/bin
+	then ${HOME} "$@" ${HOME} x=1 test printf "$@" && && "$1" $(pwd) export
+		local echo grep ${HOME} then && && --verbose done
+	awk -eu /usr/bin | --verbose
+		$(pwd) x=1 export "$@" /usr/bin 'quoted text' test printf /usr/bin
+	test x=1 grep "$@" && sed x=1 echo $(pwd) test /usr/bin local && awk /usr/bin
+"$1" cd cd && awk cd local -eu grep $(pwd) export | awk
+&& done "$@" $(pwd) echo readonly
+		2>/dev/null sed --verbose | awk 'quoted text'
+printf 2>/dev/null test then
+export test export | printf cd printf then 2>/dev/null --verbose then -eu
+awk export "$1" then "$@" -eu printf cd
+		then /usr/bin x=1 2>/dev/null readonly ${HOME} 2>/dev/null "$@" "$@" -eu awk
+	-eu cd then grep done && cd local
+grep export readonly && echo -eu cd /usr/bin echo ${HOME}
+		readonly export 2>/dev/null grep done readonly sed then readonly
+	readonly then readonly -eu /usr/bin -eu echo
+	awk -eu export "$@" then && 2>/dev/null readonly "$1" $(pwd) export
+		"$1" grep x=1 x=1 2>/dev/null 2>/dev/null done cd x=1 test
+$(pwd) "$1" export awk --verbose ${HOME} cd printf && readonly -eu done cd | "$1"
+	/usr/bin local 2>/dev/null
+local ${HOME} && grep then done done 'quoted text' local /usr/bin | -eu
+		awk -eu 2>/dev/null "$1" grep readonly -eu /usr/bin -eu -eu sed
+	sed | && "$1" test 2>/dev/null 'quoted text' 2>/dev/null printf
+/usr/bin /usr/bin "$1" export grep "$1" x=1 grep | /usr/bin
+	x=1 $(pwd) done --verbose
+		done --verbose export export
+		/usr/bin | export done then done readonly && grep && export -eu && awk
+	$(pwd) --verbose /usr/bin -eu
+	test 'quoted text' /usr/bin export && && grep && local
+printf --verbose && "$@" echo $(pwd) sed awk then $(pwd) awk "$@"
+	grep --verbose sed 'quoted text'
+local "$1" && && 2>/dev/null
+		"$@" awk && test local
+'quoted text' grep | -eu x=1 test --verbose local export then
+		done --verbose 'quoted text'
+test /usr/bin awk 'quoted text' readonly local
+	-eu "$@" && && /usr/bin
+		export $(pwd) readonly cd awk then echo ${HOME}
+		awk readonly test "$@" echo
+echo -eu && --verbose "$1" echo -eu x=1 2>/dev/null -eu -eu printf echo
+	readonly --verbose "$@" | --verbose echo "$1" /usr/bin then && x=1 cd done "$@"
+&& "$1" "$@" "$@" readonly "$1" export then 'quoted text'
+		x=1 sed grep 2>/dev/null x=1 readonly
+		readonly "$1" sed printf local readonly "$1" 2>/dev/null local then printf /usr/bin
+	'quoted text' printf export 'quoted text' readonly x=1 ${HOME} readonly 'quoted text'
+"$1" -eu test sed awk $(pwd) cd x=1 export --verbose 'quoted text' awk x=1 "$1"
+	local ${HOME} test --verbose "$1" grep echo
+		cd /usr/bin export test
+	export printf awk && "$1" sed local done x=1 2>/dev/null | awk "$@" cd export
+		x=1 printf --verbose -eu
+	| then then printf /usr/bin "$@" local "$@" printf
+done printf /usr/bin "$1" | 'quoted text'
+	"$@" readonly then cd awk 2>/dev/null $(pwd) $(pwd) readonly sed printf awk "$@"
+		$(pwd) grep printf printf ${HOME} --verbose then && && echo 2>/dev/null export
+${HOME} | printf awk grep sed | export export cd | x=1 awk 'quoted text' | $(pwd)
+'quoted text' 'quoted text' export test -eu ${HOME} sed "$1" $(pwd) $(pwd)
+		2>/dev/null x=1 readonly done cd -eu export
+		readonly printf x=1 echo grep ${HOME} -eu export printf readonly x=1 cd | export
+		test test export 2>/dev/null "$1" echo ${HOME} sed ${HOME} then "$@" 'quoted text'
+		grep awk /usr/bin && export cd readonly
+		$(pwd) x=1 then then &&
+		-eu readonly test x=1 ${HOME} x=1
+	2>/dev/null done printf test && && | 2>/dev/null && echo echo
+printf echo $(pwd) printf
+	2>/dev/null "$@" "$1" export grep | export awk /usr/bin 2>/dev/null 'quoted text'
+		export x=1 /usr/bin grep /usr/bin --verbose /usr/bin done
+"$@" && --verbose $(pwd) -eu local done 'quoted text' sed
+	"$1" done done printf echo echo "$@" awk export export cd 'quoted text'
+readonly awk ${HOME} then -eu then
+"$@" done local ${HOME} "$@" $(pwd) echo 2>/dev/null
+	done then grep x=1 $(pwd) awk x=1 ${HOME} printf "$@" grep -eu awk 'quoted text'
+'quoted text' | cd 2>/dev/null cd --verbose
+cd ${HOME} awk awk export
+		grep then grep awk local ${HOME} && ${HOME} done test -eu /usr/bin test
+		&& test ${HOME} local $(pwd) "$@" /usr/bin --verbose sed &&
+		"$1" readonly | -eu then -eu local && 'quoted text' | export sed local
+	readonly export local export ${HOME} "$@" "$1" -eu -eu
+		| /usr/bin readonly export 'quoted text'
+	--verbose then grep grep -eu --verbose
+then readonly sed then 2>/dev/null $(pwd) test | grep --verbose 2>/dev/null
+--verbose then 2>/dev/null &&
+	local 2>/dev/null -eu cd "$@" awk "$1" export test --verbose cd printf | echo readonly
+		'quoted text' x=1 cd 2>/dev/null
+--verbose test local sed $(pwd)
+	$(pwd) /usr/bin /usr/bin /usr/bin cd -eu printf echo "$1" cd awk
+		"$1" grep $(pwd) ${HOME} done -eu readonly --verbose readonly readonly
+		echo then cd | printf | then awk /usr/bin | ${HOME} "$1" awk local grep
+"$1" done grep "$@" local "$@"
+		sed -eu /usr/bin ${HOME}
+	done "$1" -eu cd && done awk && done
+	readonly printf test $(pwd) | /usr/bin x=1
+/usr/bin && done | printf awk grep /usr/bin readonly && | "$@" --verbose x=1
+		2>/dev/null export grep ${HOME} --verbose export export test -eu sed x=1
+		| local export done printf
+		test x=1 readonly printf cd ${HOME}
+	echo && done sed --verbose readonly /usr/bin cd /usr/bin then cd | "$1" /usr/bin
+	sed grep readonly -eu printf "$@" /usr/bin
+	readonly then export && $(pwd) "$@" export /usr/bin
+	export /usr/bin cd x=1 $(pwd) awk 2>/dev/null
+	-eu done -eu x=1 cd $(pwd) /usr/bin
+	${HOME} x=1 $(pwd) x=1 test && sed ${HOME} 2>/dev/null then
+-eu cd -eu cd "$1" /usr/bin /usr/bin test &&
+cd 'quoted text' && | export sed 2>/dev/null
+	"$1" echo sed awk done
+		"$@" --verbose "$@" printf -eu echo readonly local local -eu "$@"
+		awk awk then /usr/bin export echo readonly "$1" then
+		grep /usr/bin /usr/bin && ${HOME} cd -eu cd "$@" readonly $(pwd) sed awk
+	-eu x=1 local $(pwd) "$@"
+&& printf | "$@" grep 2>/dev/null
+done /usr/bin | export export ${HOME} printf ${HOME} "$@" /usr/bin 2>/dev/null
+	sed sed test test "$@" $(pwd) && grep local --verbose cd 2>/dev/null x=1 -eu ${HOME}
+	grep 2>/dev/null && /usr/bin then --verbose printf then "$@"
+	"$@" test && then awk cd then x=1 && -eu /usr/bin local test "$1" local | printf
+		local -eu test 2>/dev/null awk local
+readonly 2>/dev/null cd "$@" readonly
+/usr/bin sed then 'quoted text'
+| echo readonly echo -eu
+		local readonly 2>/dev/null ${HOME} sed test
+	2>/dev/null && local && grep export |
+		&& /usr/bin /usr/bin test /usr/bin readonly ${HOME} test
+	&& | echo 'quoted text' sed && sed --verbose
+		local x=1 grep export x=1 | cd "$@" done export ${HOME}
+${HOME} 2>/dev/null x=1 | done test export echo sed
+	export 'quoted text' && done grep awk |
+$(pwd) grep /usr/bin test "$@" then &&
+	then -eu /usr/bin done "$@" | 'quoted text' printf
+$(pwd) /usr/bin && then done
+		'quoted text' --verbose 2>/dev/null
+	&& --verbose sed 'quoted text' $(pwd) readonly
+done then /usr/bin echo test "$1" x=1 printf && 'quoted text'
+		-eu printf cd && /usr/bin cd "$@" test 2>/dev/null "$@" 'quoted text' 'quoted text'
+		then export /usr/bin 'quoted text' -eu cd export "$1" local readonly --verbose
+		test 'quoted text' x=1
+		${HOME} $(pwd) awk cd grep $(pwd) then awk && awk && 'quoted text' -eu local
+	test printf "$@" export -eu "$1" echo 2>/dev/null test
+	"$1" done /usr/bin -eu sed $(pwd) "$1" test readonly x=1 --verbose
+2>/dev/null local echo /usr/bin sed && readonly && readonly "$1"
+		local /usr/bin export x=1 local x=1 ${HOME}
+	sed --verbose grep readonly readonly "$@" "$1"
+		"$1" x=1 cd cd sed cd $(pwd) /usr/bin
+"$1" ${HOME} /usr/bin local export --verbose x=1 x=1 then $(pwd) export
+readonly cd sed -eu $(pwd) printf ${HOME} awk x=1
+		export "$1" 2>/dev/null local echo
+	'quoted text' local local
+		/usr/bin x=1 then grep export readonly
+sed --verbose test --verbose export cd /usr/bin
+/usr/bin printf grep test printf echo && echo local ${HOME} printf echo export
+	then echo done "$@" readonly "$1" && printf export 2>/dev/null && "$@" --verbose
+	grep 2>/dev/null local "$@" local awk export --verbose printf
+		-eu readonly grep ${HOME}
+awk export awk test /usr/bin awk x=1 x=1 'quoted text' 2>/dev/null
+		awk -eu awk $(pwd) && /usr/bin "$1" 2>/dev/null ${HOME} then 'quoted text'
+export echo "$1" export grep && 'quoted text' /usr/bin
+local $(pwd) "$@" grep -eu awk 2>/dev/null "$1" cd 2>/dev/null /usr/bin
+		then x=1 $(pwd) awk | 'quoted text' "$@" /usr/bin
+local ${HOME} done ${HOME} | export --verbose then | done cd
+	--verbose && test readonly printf echo readonly done --verbose
+	sed /usr/bin "$@" "$1" --verbose export export ${HOME}
+		&& export "$1" /usr/bin $(pwd) readonly awk x=1 test && && "$1" $(pwd) ${HOME}
+		grep cd "$1" readonly /usr/bin readonly 2>/dev/null | cd && "$1" -eu
+grep -eu export $(pwd) awk then cd grep echo local 2>/dev/null 'quoted text' test
+	-eu readonly then export awk 2>/dev/null awk | "$@"
+&& $(pwd) readonly printf "$@" x=1 "$1" | --verbose grep
+		${HOME} "$@" $(pwd) 2>/dev/null $(pwd) awk "$@" | sed grep echo awk ${HOME}
+		x=1 then x=1 local awk 2>/dev/null
+		${HOME} 'quoted text' | export grep grep local grep readonly
+		test echo done $(pwd) cd echo "$@" ${HOME}
+'quoted text' "$1" 'quoted text'
+		awk sed printf echo $(pwd) $(pwd) 'quoted text'
+		2>/dev/null readonly | local cd "$@" local grep then "$1" grep 2>/dev/null
+		-eu export "$@" 2>/dev/null then --verbose
+		cd "$1" "$@" test --verbose readonly 2>/dev/null readonly ${HOME} then /usr/bin
+	${HOME} test 'quoted text' test cd done $(pwd) grep
+		sed echo test 2>/dev/null cd /usr/bin 'quoted text'
+		echo $(pwd) 'quoted text' 'quoted text' cd x=1 export $(pwd) 'quoted text'
+		awk "$@" cd 'quoted text' readonly "$1"
+sed printf local | done export | --verbose grep echo "$@"
+		${HOME} -eu -eu echo test awk grep printf 2>/dev/null
+	local cd done -eu then echo --verbose local
+	sed ${HOME} export echo done readonly cd echo cd
+		"$@" 2>/dev/null test local x=1 $(pwd)
+export then then export x=1 && readonly echo export
+		2>/dev/null sed ${HOME} -eu printf $(pwd) done --verbose "$@" cd
+	then $(pwd) 'quoted text' "$1" "$@" x=1 2>/dev/null 'quoted text'
+	cd "$1" -eu awk done printf readonly echo
+| x=1 'quoted text' echo 2>/dev/null x=1
+		$(pwd) local readonly --verbose
+		x=1 readonly test echo awk then
+echo grep x=1 | --verbose ${HOME} export printf export 2>/dev/null 2>/dev/null
+"$1" done test test then
+test | --verbose cd $(pwd)
+	'quoted text' readonly --verbose 'quoted text' | grep -eu local ${HOME} -eu
+test 2>/dev/null test "$@" && x=1 ${HOME} $(pwd) $(pwd)
+${HOME} ${HOME} awk --verbose
+		$(pwd) grep "$1" && then grep echo /usr/bin ${HOME} "$1" x=1
+| echo 'quoted text' cd export 'quoted text' done
+		test "$1" $(pwd) test && "$@" ${HOME} grep done $(pwd) grep awk "$1" readonly local
+		--verbose local test -eu && /usr/bin
+	-eu export cd readonly sed printf test export && readonly
+	local done echo sed && 'quoted text'
+${HOME} $(pwd) 2>/dev/null 2>/dev/null 2>/dev/null $(pwd) grep
+--verbose "$@" echo done grep
+		done "$1" --verbose grep /usr/bin 'quoted text' && readonly ${HOME}
+		x=1 test local grep export 2>/dev/null ${HOME} export ${HOME} --verbose |
+		--verbose --verbose "$1" && readonly x=1 2>/dev/null cd
+	$(pwd) && done readonly ${HOME} ${HOME} local $(pwd) echo -eu
+	2>/dev/null then grep awk -eu --verbose local $(pwd) 2>/dev/null echo -eu awk "$1"
+local grep 'quoted text'
+		test then "$1" "$1" then "$@" sed -eu 2>/dev/null
+		| x=1 awk grep -eu x=1 sed ${HOME}
+		export test "$@" grep export echo grep -eu echo local
+		then done "$1" 'quoted text' ${HOME} | sed -eu 'quoted text'
+export && awk "$1" echo test | && "$@" && && "$@"
+	2>/dev/null 'quoted text' export printf
+	test echo export local --verbose "$@" ${HOME}
+	| echo then $(pwd) && "$1" done $(pwd) done -eu "$1" --verbose printf
+	printf 'quoted text' | /usr/bin && sed grep printf
+		'quoted text' --verbose then done export grep readonly
+		grep awk "$@" readonly local x=1 'quoted text' /usr/bin
+echo && && done -eu readonly readonly
+		"$@" sed export ${HOME} echo | /usr/bin done $(pwd) --verbose "$@" cd done
+test "$1" cd "$@" "$@" test && $(pwd) done cd | cd export
+2>/dev/null --verbose sed grep sed echo /usr/bin readonly grep -eu 'quoted text'
+	echo done then cd 2>/dev/null awk
+	"$1" export cd local export /usr/bin done then "$@" /usr/bin awk $(pwd) 'quoted text'
+export cd printf ${HOME} grep then "$1"
+printf x=1 sed x=1 2>/dev/null
+done /usr/bin -eu ${HOME} $(pwd) grep readonly grep /usr/bin 'quoted text'
+	&& | && test local export ${HOME} /usr/bin
+		cd | 'quoted text' x=1 --verbose
+	x=1 printf export -eu sed /usr/bin
+	&& sed ${HOME} then && cd "$1"
+	awk && export ${HOME} done test
+${HOME} awk | 2>/dev/null then local /usr/bin && awk "$1"
+	printf readonly export then 'quoted text' grep --verbose sed local grep
+		--verbose awk 2>/dev/null test test $(pwd) x=1 2>/dev/null awk readonly then ${HOME}
+		printf 'quoted text' echo /usr/bin
+		2>/dev/null local /usr/bin x=1 /usr/bin 2>/dev/null $(pwd) export --verbose
+		&& -eu local "$1" | x=1 local echo cd awk echo 2>/dev/null 'quoted text'
+		grep export "$1" "$@" echo "$@" 'quoted text' done printf then export sed local
+sed printf $(pwd) sed local done echo $(pwd) grep
+"$1" then printf $(pwd) echo awk && $(pwd) test cd ${HOME}
+"$1" 'quoted text' --verbose && /usr/bin then test awk "$1" local cd local
+$(pwd) ${HOME} "$1" echo
+${HOME} 'quoted text' "$1" readonly sed
+'quoted text' | local -eu cd | "$@"
+cd | $(pwd) sed awk "$@" grep grep echo /usr/bin $(pwd) "$@"
+sed grep local --verbose && 2>/dev/null
+	${HOME} --verbose awk "$@" then 'quoted text'
+	awk "$@" ${HOME} && ${HOME} | export --verbose cd 'quoted text' then
+&& --verbose 'quoted text' printf x=1 then
+	${HOME} printf echo /usr/bin awk ${HOME}
+	--verbose "$1" then | "$1" printf local 'quoted text'
+done echo test --verbose awk
+printf then x=1 then "$1" 2>/dev/null --verbose
+		echo --verbose | ${HOME} then /usr/bin done | ${HOME} cd cd $(pwd) && done
+	grep done grep "$@" && x=1 --verbose ${HOME} /usr/bin
+"$@" "$@" 2>/dev/null | 2>/dev/null echo local then x=1 x=1 "$1" | --verbose echo
+	echo ${HOME} $(pwd) "$@" awk ${HOME} /usr/bin 2>/dev/null
+		export local readonly local
+		&& 2>/dev/null -eu | export export echo $(pwd)
+	awk export "$@" | test --verbose echo local
+		"$@" done "$1" cd readonly $(pwd) readonly 'quoted text' x=1 cd readonly 'quoted text'
+		echo printf awk export echo && --verbose 2>/dev/null
+-eu ${HOME} export then 2>/dev/null /usr/bin | grep readonly grep -eu
+		$(pwd) awk $(pwd) readonly x=1 x=1 "$1" x=1 && echo printf
+echo done | readonly sed -eu local done | local ${HOME} sed
+readonly ${HOME} && echo -eu awk done | && done grep /usr/bin
+export x=1 /usr/bin sed
+awk export -eu readonly test 2>/dev/null -eu test echo ${HOME} ${HOME} ${HOME}
+	then $(pwd) --verbose then
+readonly test readonly && readonly grep cd export printf readonly | grep &&
+		${HOME} -eu cd "$@" | "$1" done sed grep then 'quoted text'
+		readonly printf cd test then test test 'quoted text' -eu test readonly
+		$(pwd) then 'quoted text' "$1" echo 2>/dev/null
+x=1 export cd | -eu $(pwd) ${HOME}
+		| sed /usr/bin grep ${HOME} echo cd
+	2>/dev/null printf x=1 test test 2>/dev/null
+	--verbose export 'quoted text' then "$1" 2>/dev/null printf readonly
+	awk "$@" readonly export echo test "$1" && ${HOME} export done test local 2>/dev/null
+	x=1 | 2>/dev/null x=1 2>/dev/null
+	echo echo then 'quoted text'
+		done $(pwd) sed | 'quoted text' sed "$@" readonly
+		--verbose done grep "$1" "$1" 2>/dev/null x=1 'quoted text'
+		"$@" "$@" then "$@" | local local "$1" printf
+		sed 2>/dev/null grep printf x=1 printf readonly ${HOME} 2>/dev/null --verbose
+		"$1" test echo --verbose awk test 'quoted text' printf readonly $(pwd) ${HOME}
+/usr/bin 'quoted text' && cd awk 'quoted text'
+		$(pwd) sed 2>/dev/null grep && | export $(pwd) readonly cd && awk then --verbose
+		done --verbose -eu && printf && local /usr/bin "$@" 'quoted text' "$@"
+		'quoted text' | grep done "$1" "$1" printf
+		$(pwd) $(pwd) x=1 awk x=1 "$@" awk --verbose echo done awk
+local local x=1 echo sed | then --verbose grep -eu x=1 && cd "$@" done grep
+		--verbose readonly local grep --verbose "$@" 2>/dev/null $(pwd) --verbose
+then sed -eu cd test $(pwd) done --verbose cd $(pwd) 2>/dev/null
+	echo then grep printf "$1" readonly $(pwd)
+| then && | sed && grep "$1" cd x=1 | export readonly
+	${HOME} && grep done printf | readonly echo readonly cd awk ${HOME} "$1" then
+		test then 'quoted text' export cd
+grep readonly "$@" awk local | $(pwd)
+| test test then ${HOME} 'quoted text' x=1 2>/dev/null "$1"
+		${HOME} 2>/dev/null "$1" &&
+x=1 export awk && test readonly printf "$1" then echo 2>/dev/null
+	test grep -eu 2>/dev/null $(pwd) then done cd then ${HOME} cd $(pwd)
+		"$1" && awk export -eu then
+		export cd 'quoted text' test
+	-eu awk -eu 'quoted text' grep cd "$1" grep cd &&
+		$(pwd) export /usr/bin "$1" readonly
+printf printf -eu x=1 local export grep cd ${HOME} cd | sed
+	2>/dev/null readonly 'quoted text'
+	cd grep grep test | echo --verbose | $(pwd)
+2>/dev/null "$@" 2>/dev/null
+		test 'quoted text' cd export && ${HOME} && 2>/dev/null $(pwd) done | 2>/dev/null
+	local "$1" awk x=1 'quoted text' grep cd $(pwd) -eu /usr/bin
+/usr/bin done && echo export export then grep ${HOME}
+	done printf x=1 grep 2>/dev/null readonly local echo 2>/dev/null --verbose grep
+		${HOME} "$1" local done 2>/dev/null local printf 'quoted text' | readonly
+2>/dev/null test | export x=1 test /usr/bin export
+	'quoted text' && "$1"
+cd then awk grep -eu test cd x=1 ${HOME} $(pwd) /usr/bin
+		printf x=1 'quoted text' "$@" "$@" echo local sed test then sed then 2>/dev/null
+	grep echo --verbose sed cd then -eu export echo 2>/dev/null
+	2>/dev/null grep echo done sed 2>/dev/null
+/usr/bin && export then &&
+/usr/bin export -eu echo && test x=1 cd && awk test && 'quoted text' -eu
+	export cd sed grep x=1 "$@"
+	grep echo | export done x=1 test "$1" printf && test | echo printf $(pwd) grep
+		--verbose ${HOME} -eu printf 2>/dev/null awk x=1 export export x=1 cd then
+		| && /usr/bin local $(pwd) | printf awk x=1 'quoted text' "$@" && done $(pwd)
+	then $(pwd) "$1" done awk --verbose
+cd /usr/bin sed local echo grep local | --verbose awk awk /usr/bin
+'quoted text' "$1" --verbose sed sed x=1 $(pwd) grep done
+	readonly readonly 'quoted text' printf
+grep printf export | printf export x=1 -eu cd test x=1 | grep ${HOME}
+$(pwd) echo && -eu export "$1" printf readonly --verbose test && local
+	"$@" && "$@" echo "$@" x=1 'quoted text' x=1
+	&& | sed x=1 then echo done ${HOME}
+--verbose && local | done ${HOME}
+export $(pwd) 'quoted text' echo export
+	done readonly 2>/dev/null
+		"$@" x=1 "$1" 'quoted text' done local grep $(pwd) --verbose export -eu sed
+grep 2>/dev/null --verbose "$@" --verbose printf grep readonly && $(pwd) "$@"
+		export then | -eu 2>/dev/null "$@" printf awk grep test 'quoted text' cd
+'quoted text' /usr/bin sed /usr/bin local --verbose cd grep 'quoted text'
+/usr/bin grep | --verbose then 'quoted text' grep /usr/bin /usr/bin "$@"
+&& awk 'quoted text' awk done sed test awk done ${HOME} cd cd | "$@" sed 'quoted text'
+		&& test awk echo readonly && echo
+	'quoted text' /usr/bin
+cd | awk 'quoted text'
+	awk x=1 "$@" 2>/dev/null done 'quoted text' x=1 2>/dev/null --verbose
+	cd x=1 | "$1" then test printf 'quoted text' "$1" --verbose then "$1" awk
+	grep -eu sed | echo $(pwd) grep test export sed &&
+		/usr/bin /usr/bin printf --verbose cd 'quoted text'
+	local -eu awk --verbose
+-eu | printf && | awk 'quoted text' then ${HOME} && done awk ${HOME}
+/usr/bin awk "$1" done local printf x=1 echo grep /usr/bin
+	test grep 2>/dev/null local local
+	"$1" ${HOME} -eu test --verbose sed echo /usr/bin local -eu then "$@" $(pwd)
+"$1" | cd printf $(pwd) 'quoted text' printf ${HOME}
+	echo echo readonly "$@" test "$@" test 2>/dev/null
+	${HOME} -eu test && printf cd $(pwd) test test $(pwd) --verbose | | && export
+	'quoted text' $(pwd) -eu 2>/dev/null then
+		done 'quoted text' | test readonly then "$@" && echo cd test | | export "$@"
+		local | grep /usr/bin "$1" printf -eu 'quoted text' "$1"
+cd local "$1" sed test $(pwd) done "$@" | done | --verbose
+	"$@" local $(pwd) ${HOME} "$@"
+grep "$1" grep /usr/bin && done then && sed test awk -eu done
+printf test "$@" sed 'quoted text' && awk 2>/dev/null echo cd "$@" grep grep done
+		"$1" ${HOME} "$@" cd x=1 | echo --verbose | done
+then --verbose | ${HOME} local test "$@" printf
+/usr/bin echo printf $(pwd) readonly test export awk x=1 echo echo "$@" test cd
+	| then cd x=1 readonly printf cd local test "$1"
+		/usr/bin then printf
+		x=1 && && 'quoted text' 2>/dev/null
+		2>/dev/null ${HOME} 'quoted text' && echo test | x=1 printf x=1 grep
+	cd cd $(pwd) local "$@" 2>/dev/null ${HOME}
+'quoted text' 2>/dev/null ${HOME} && grep then "$1" 2>/dev/null
+sed echo | grep awk 'quoted text' 2>/dev/null "$1" 'quoted text'
+		export -eu "$@" sed -eu test export awk 2>/dev/null
+&& grep "$@" "$1" && && test 'quoted text' "$@" 'quoted text'
+		local x=1 cd done 'quoted text' cd && done sed then "$1" done
+		awk printf readonly "$1" sed then "$1" x=1 -eu readonly 'quoted text' "$1"
+	${HOME} sed local "$1" --verbose
+	-eu 'quoted text' ${HOME} awk then && && /usr/bin 2>/dev/null echo "$@"
+		printf /usr/bin printf grep
+	"$1" 'quoted text' /usr/bin $(pwd) /usr/bin done printf
+	export ${HOME} ${HOME} cd x=1 readonly "$1" ${HOME} $(pwd)
+	done /usr/bin "$1" sed cd --verbose -eu done grep | 2>/dev/null | grep
+	readonly cd "$@" export -eu | "$@" -eu
+	| $(pwd) | awk ${HOME} then
+	then --verbose export cd test | cd "$@" readonly
+		-eu sed "$1" export test
+	readonly 2>/dev/null export $(pwd) | && export |
+export "$@" done printf done
+$(pwd) printf done grep -eu "$1"
+test /usr/bin && export
+awk local 2>/dev/null "$@" sed | x=1 test grep "$@" echo ${HOME} | test test done
+	'quoted text' export test readonly readonly test
+		then then readonly x=1 /usr/bin sed echo --verbose && readonly -eu 'quoted text'
+	$(pwd) 'quoted text' --verbose awk printf readonly
+		awk grep "$1" ${HOME} then | done awk x=1 local echo ${HOME} | sed
+	printf printf awk | export ${HOME} -eu printf
+	"$@" "$1" readonly then && "$@"
+		"$@" grep x=1 echo export
+	/usr/bin | ${HOME} ${HOME} x=1 /usr/bin && 'quoted text' export
+		readonly 2>/dev/null local 'quoted text' ${HOME} printf -eu
+	test export /usr/bin sed "$1"
+		cd x=1 ${HOME} then x=1 'quoted text' then "$1" 'quoted text' --verbose
+x=1 grep echo 2>/dev/null ${HOME}
+		--verbose && local 'quoted text' local -eu | && "$@" && x=1
+		grep grep $(pwd) awk ${HOME} $(pwd)
+		readonly test --verbose echo | "$@" export /usr/bin grep 'quoted text' $(pwd)
+2>/dev/null --verbose ${HOME} "$1" "$@"
+	then $(pwd) "$@" 'quoted text'
+echo x=1 then --verbose x=1 x=1 done local
+	done sed echo "$@" --verbose -eu 2>/dev/null | /usr/bin --verbose
+readonly readonly grep
+		${HOME} && -eu local $(pwd) "$1" --verbose /usr/bin /usr/bin /usr/bin
+	done --verbose local local
+		2>/dev/null $(pwd) echo && awk echo && 'quoted text' -eu readonly sed
+	awk awk printf --verbose local /usr/bin 2>/dev/null grep $(pwd)
+	echo && --verbose ${HOME} "$1" $(pwd) cd echo export test --verbose |
+		| export sed readonly /usr/bin echo local printf && 'quoted text' x=1 /usr/bin
+	'quoted text' 2>/dev/null && test then echo $(pwd) | "$@" x=1 x=1 2>/dev/null
+#include c113.sh
+	grep 2>/dev/null local 'quoted text' done -eu printf
+--verbose then | 2>/dev/null readonly "$1" /usr/bin 2>/dev/null readonly
+	printf -eu cd /usr/bin 'quoted text' --verbose
+		cd export "$1" && readonly export $(pwd) -eu awk x=1 test
+awk export 2>/dev/null export grep then echo --verbose 'quoted text'
+	test ${HOME} | printf echo cd awk done grep then then
+then 2>/dev/null && -eu $(pwd) cd awk x=1 local readonly
+	"$@" echo test sed -eu export cd | readonly
+		${HOME} -eu awk done test
+		echo x=1 local printf "$@" 'quoted text' /usr/bin
+	x=1 printf | ${HOME} | export
+	cd local local 2>/dev/null export then done ${HOME} readonly echo
+		awk printf /usr/bin export then --verbose "$1" && --verbose cd cd sed cd then sed
+then grep export --verbose | 2>/dev/null
+	| cd "$@" $(pwd) && /usr/bin readonly "$@" local 'quoted text' && cd done
+x=1 2>/dev/null then awk grep ${HOME} 2>/dev/null
+local | then grep "$1" $(pwd) $(pwd)
+	export test cd export echo test cd $(pwd) "$@" grep export "$1"
+	| grep cd x=1 ${HOME} ${HOME}
+	x=1 printf local "$1" local 'quoted text' && --verbose then printf
+sed readonly x=1 done --verbose printf "$1" echo printf local export
+		$(pwd) grep export x=1 && then test $(pwd) ${HOME} && local "$@"
+'quoted text' readonly x=1 2>/dev/null
+		--verbose awk /usr/bin then
+		sed $(pwd) && && | $(pwd) export grep 'quoted text'
+		"$@" -eu done ${HOME} ${HOME} --verbose
+	| then test $(pwd) echo 2>/dev/null
+		"$@" cd x=1 export 2>/dev/null
+	2>/dev/null 2>/dev/null "$1" "$1" -eu "$@" /usr/bin sed local printf
+| $(pwd) test "$@" grep echo 'quoted text' then
+	-eu done && printf then
+-eu export $(pwd) /usr/bin 2>/dev/null ${HOME} 2>/dev/null sed $(pwd) readonly
+	cd 'quoted text' /usr/bin cd && "$1" done echo ${HOME} export 'quoted text'
+		test cd x=1 /usr/bin done export -eu export --verbose "$@" cd echo
+	then ${HOME} readonly test && -eu | /usr/bin --verbose --verbose test cd
+	printf grep | grep 'quoted text' test
+		then $(pwd) 2>/dev/null | export test done readonly 'quoted text'
+	"$@" grep && ${HOME} awk export 'quoted text' printf | sed
+		/usr/bin | test then echo cd awk test printf grep awk && x=1 -eu "$@" printf
+		2>/dev/null export | done awk -eu cd local | cd 'quoted text' readonly
+		&& then local echo x=1 /usr/bin test --verbose export "$1"
+		&& -eu local --verbose "$@"
+	done local grep echo "$1" "$1" 'quoted text'
+then printf "$@" -eu grep local grep $(pwd)
+x=1 then readonly export 2>/dev/null --verbose cd test
+&& | | readonly 'quoted text'
+		echo grep grep "$1" echo "$@"
+grep -eu 'quoted text' echo "$1" 'quoted text' printf
+grep done done $(pwd) export "$@" | 'quoted text' "$@" && $(pwd) "$1" done | sed
+-eu 2>/dev/null 2>/dev/null local -eu printf
+		${HOME} ${HOME} printf echo x=1 'quoted text'
+		${HOME} sed "$1" --verbose export awk sed --verbose sed
+	done x=1 awk sed done test -eu -eu cd test
+-eu x=1 --verbose "$@" awk done echo ${HOME} then sed -eu -eu 'quoted text'
+	'quoted text' | local -eu "$@" export /usr/bin /usr/bin "$@" export
+	/usr/bin && echo cd awk sed test
+		| -eu done "$@" readonly then 'quoted text' /usr/bin && -eu x=1 local echo && 'quoted text'
+readonly local sed "$@"
+	2>/dev/null echo --verbose 2>/dev/null readonly
+		printf printf $(pwd) -eu $(pwd) 'quoted text' ${HOME} -eu grep printf
+		readonly local x=1 test then test test
+awk then awk 2>/dev/null grep -eu test local "$1"
+	grep then "$1" /usr/bin readonly 2>/dev/null 'quoted text' /usr/bin export local
+done "$1" x=1 2>/dev/null
+2>/dev/null --verbose echo x=1 awk local test
+	${HOME} awk x=1 2>/dev/null
+x=1 /usr/bin "$1" $(pwd) /usr/bin
+		&& grep "$1" done --verbose "$@" x=1 -eu 'quoted text'
+	${HOME} /usr/bin ${HOME} -eu test | && test | export --verbose echo grep
+	done then 'quoted text' awk ${HOME} "$@" printf
+	"$1" cd --verbose $(pwd) readonly printf -eu /usr/bin grep printf 2>/dev/null
+	echo "$@" echo 2>/dev/null 2>/dev/null
+	test /usr/bin --verbose readonly
+		echo sed --verbose local cd readonly grep
+		"$1" /usr/bin | -eu 'quoted text' | && ${HOME}
+	&& then | --verbose grep then echo "$1" done cd "$@" ${HOME} sed readonly --verbose
+		-eu $(pwd) -eu local then "$@" --verbose printf test --verbose $(pwd)
+	${HOME} sed /usr/bin test 2>/dev/null awk
+		readonly "$@" --verbose done done readonly x=1 printf echo 'quoted text' /usr/bin
+	local test readonly ${HOME} | printf /usr/bin echo $(pwd) printf printf
+x=1 echo -eu then --verbose 2>/dev/null
+		&& printf echo x=1 | 2>/dev/null -eu done sed -eu printf $(pwd) -eu "$@"
+	2>/dev/null done done /usr/bin $(pwd) 2>/dev/null
+test && done printf test then | x=1 then --verbose
+	"$@" then $(pwd) $(pwd) ${HOME} readonly local && --verbose -eu
+local $(pwd) then local done ${HOME} sed test $(pwd) && then "$@" 'quoted text'
+		done printf printf readonly 'quoted text'
+then /usr/bin $(pwd) cd 'quoted text' grep cd export grep 'quoted text' /usr/bin
+cd echo printf | grep 2>/dev/null
+	grep x=1 printf ${HOME} -eu printf && x=1 printf /usr/bin echo export
+		'quoted text' && --verbose
+	printf "$1" | x=1 export echo readonly cd $(pwd) -eu -eu "$@" -eu -eu
+	--verbose /usr/bin awk local
+		| | "$@" && done "$@" printf --verbose x=1
+"$@" -eu sed /usr/bin ${HOME}
+2>/dev/null local then ${HOME} then ${HOME} x=1 local readonly printf x=1 /usr/bin
+awk export then "$1" ${HOME}
+		${HOME} cd -eu 'quoted text' printf cd "$@" sed cd
+sed then printf -eu local
+$(pwd) $(pwd) grep && grep local 'quoted text' && sed /usr/bin
+	awk echo -eu "$@" "$@" x=1 printf then grep sed /usr/bin
+grep -eu test export awk /usr/bin 2>/dev/null 'quoted text' ${HOME}
+		done local 'quoted text' 2>/dev/null 2>/dev/null sed export 'quoted text'
+		done 2>/dev/null export | -eu export | export
+		$(pwd) --verbose && --verbose sed awk
+	printf test grep /usr/bin | awk sed printf
+		x=1 /usr/bin done 'quoted text' done && grep done /usr/bin | grep $(pwd) --verbose
+		x=1 done /usr/bin export local grep $(pwd) /usr/bin
+	/usr/bin done echo $(pwd) local $(pwd)
+		test -eu "$1" && "$@" ${HOME} readonly -eu x=1 2>/dev/null
+	/usr/bin done "$1" "$1" grep
+	--verbose "$1" --verbose echo -eu -eu $(pwd) cd local local
+cd -eu 'quoted text' -eu x=1 2>/dev/null awk sed
+	sed | && grep export "$1" 'quoted text'
+		local ${HOME} then done grep printf "$1" grep 2>/dev/null sed --verbose 'quoted text'
+	$(pwd) done awk cd awk then x=1 $(pwd) | then ${HOME} 'quoted text'
+local /usr/bin x=1 then x=1 readonly /usr/bin grep awk 2>/dev/null
+"$1" ${HOME} grep ${HOME}
+&& $(pwd) readonly | x=1 "$@" 2>/dev/null then -eu "$@" then --verbose
+	--verbose ${HOME} -eu local sed cd then |
+		--verbose sed done 'quoted text' readonly
+-eu "$@" test readonly | sed | export $(pwd) test /usr/bin 2>/dev/null --verbose
+"$1" echo 'quoted text' echo --verbose | cd /usr/bin && test sed export 2>/dev/null
+		--verbose done test then awk done x=1 then done readonly $(pwd)
+	grep 'quoted text' export ${HOME} awk echo test echo 'quoted text'
+		awk 'quoted text' printf sed | sed -eu 2>/dev/null "$1" $(pwd) $(pwd)
+		| x=1 | done /usr/bin done cd /usr/bin "$1" "$1" grep readonly
+	awk export && -eu -eu
+awk awk local -eu printf x=1 export /usr/bin
+	x=1 done && ${HOME} --verbose echo sed awk && 2>/dev/null
+export cd echo then && $(pwd)
+	printf x=1 printf grep
+test 2>/dev/null "$1" then done 2>/dev/null
+readonly local | then $(pwd) "$@" --verbose readonly $(pwd) 2>/dev/null && $(pwd)
+		cd readonly then && local echo
+	${HOME} $(pwd) echo export $(pwd) export done
+		--verbose && x=1 /usr/bin
+	"$@" printf readonly export 'quoted text' echo grep x=1 sed | "$@" /usr/bin
+		&& ${HOME} sed && "$1" -eu 'quoted text' $(pwd)
+sed x=1 && /usr/bin && && /usr/bin local echo ${HOME} "$1" test awk cd
+		test x=1 local export /usr/bin local echo grep sed | grep "$@" echo grep $(pwd)
+	readonly printf x=1 printf /usr/bin cd local test printf
+		done -eu /usr/bin | x=1 sed
+	-eu sed && && export 2>/dev/null sed printf --verbose cd readonly
+		/usr/bin local 'quoted text' "$@" ${HOME} 'quoted text' 'quoted text'
+	${HOME} "$@" test done /usr/bin
+&& 2>/dev/null ${HOME} export
+sed 2>/dev/null printf grep echo local readonly
+"$1" "$1" test && echo | --verbose awk /usr/bin --verbose
+then 2>/dev/null -eu readonly 'quoted text'
+	"$@" export done "$1" 2>/dev/null echo x=1 && | local "$1" && | local
+"$1" x=1 grep 'quoted text' 'quoted text' $(pwd) local cd "$1"
+cd then && echo sed && awk && 2>/dev/null 2>/dev/null "$@"
+		sed "$1" | done done --verbose && 2>/dev/null | "$@" 'quoted text' done then --verbose
+/usr/bin ${HOME} | "$@" | sed -eu | 2>/dev/null printf --verbose && ${HOME}
+	/usr/bin export "$1" awk test && &&
+	sed && x=1 sed x=1 "$1" sed "$@" cd "$1"
+printf done awk printf 'quoted text'
+	-eu ${HOME} grep export ${HOME} local "$@"
+2>/dev/null $(pwd) awk -eu echo ${HOME}
+&& printf $(pwd) "$@" -eu
+cd $(pwd) 2>/dev/null grep --verbose
+sed printf sed --verbose && export sed done 'quoted text' $(pwd) awk 'quoted text'
+		${HOME} x=1 $(pwd) 'quoted text' sed sed "$1" 2>/dev/null x=1 test
+	x=1 done ${HOME} $(pwd) awk
+	test local export $(pwd) then "$1" test cd | ${HOME} 'quoted text' printf
+| cd export done local sed test grep grep readonly
+	/usr/bin ${HOME} 2>/dev/null /usr/bin
+$(pwd) x=1 $(pwd) ${HOME} 'quoted text' && "$@" local && 2>/dev/null readonly "$1"
+	| grep test /usr/bin test --verbose --verbose
+cd x=1 ${HOME} sed sed export awk readonly --verbose awk test /usr/bin
+		2>/dev/null readonly -eu awk
+	'quoted text' $(pwd) cd
+export /usr/bin local && "$@" && && cd "$1" 'quoted text'
+export x=1 done $(pwd) echo "$@" export /usr/bin then cd awk 2>/dev/null
+echo printf "$@" --verbose
+sed then ${HOME} 'quoted text' | && test cd --verbose
+local grep export ${HOME} && /usr/bin grep /usr/bin
+		| awk cd 2>/dev/null readonly
+	x=1 --verbose $(pwd) readonly 'quoted text' $(pwd) export readonly
+	grep printf printf | local ${HOME} $(pwd) 'quoted text' test grep ${HOME}
+		grep sed -eu | awk "$@" grep readonly "$@" x=1 echo test $(pwd)
+	-eu 'quoted text' cd then then $(pwd)
+$(pwd) -eu grep grep --verbose readonly readonly 'quoted text'
+	--verbose awk local grep | ${HOME} cd cd "$@" export
+	"$1" test | export 'quoted text' /usr/bin awk local sed local x=1 -eu "$@"
+${HOME} local cd --verbose ${HOME} then | readonly then | x=1
+	grep 2>/dev/null sed sed 'quoted text' $(pwd) test
+		"$@" ${HOME} ${HOME} -eu awk then x=1 grep test export
+		'quoted text' then x=1 cd local 2>/dev/null awk readonly $(pwd)
+then && grep 2>/dev/null ${HOME} cd then local printf "$@" awk "$1" echo local
+		test --verbose /usr/bin /usr/bin --verbose | "$1"
+	sed && "$@" test --verbose awk | | 2>/dev/null ${HOME}
+--verbose | readonly sed $(pwd) && grep | "$1" "$@" ${HOME} export 2>/dev/null
+&& && echo -eu then $(pwd) export then local cd 2>/dev/null
+"$1" ${HOME} && "$@" --verbose done ${HOME} export export sed sed | "$1" printf
+x=1 printf local sed then echo && | $(pwd) sed --verbose && | $(pwd)
+		cd cd 'quoted text' then /usr/bin echo | sed cd /usr/bin /usr/bin "$@" printf
+${HOME} "$@" then && "$@" x=1 ${HOME} grep
+		2>/dev/null "$1" | --verbose 'quoted text' echo "$1" done | 'quoted text'
+	$(pwd) sed /usr/bin echo
+grep test -eu sed --verbose then readonly awk ${HOME} 'quoted text' local test
+cd $(pwd) 'quoted text'
+	| done awk local && export 2>/dev/null --verbose awk local --verbose
+		export "$@" awk grep ${HOME} readonly "$1"
+		printf done readonly 2>/dev/null "$1" awk && --verbose
+	readonly x=1 local echo "$1" && test local grep -eu -eu cd ${HOME}
+		export -eu -eu 'quoted text' | awk printf then $(pwd) 2>/dev/null
+	awk /usr/bin 2>/dev/null sed echo ${HOME} && && export readonly
+		&& | echo "$1" "$@" 2>/dev/null
+done && "$@" awk 'quoted text' echo
+	grep -eu x=1 printf awk test
+	2>/dev/null printf /usr/bin 'quoted text' local $(pwd)
+	test 'quoted text' && "$@" readonly test 'quoted text'
+	test awk ${HOME} cd cd printf /usr/bin
+test sed x=1 $(pwd) local && $(pwd) "$@" "$1"
+		export sed export local --verbose then grep local "$@" ${HOME} /usr/bin export $(pwd)
+2>/dev/null local $(pwd) x=1 "$1" "$1" && printf ${HOME} && readonly export
+		done sed export "$1" awk export test printf then --verbose echo then
+	x=1 --verbose echo readonly x=1 ${HOME} 2>/dev/null cd "$@" --verbose
+echo then $(pwd) export | cd /usr/bin sed printf
+	"$@" test --verbose export
+		readonly --verbose -eu /usr/bin --verbose
+		export | 2>/dev/null | test readonly "$@" "$@" ${HOME}
+	export -eu sed | cd printf sed done
+		cd sed then | printf export done cd readonly
+		$(pwd) && && grep then then
+		--verbose sed $(pwd) 'quoted text'
+awk 'quoted text' printf then cd x=1 cd echo 2>/dev/null
+		local echo $(pwd) --verbose
+		local printf export printf echo readonly export
+		2>/dev/null -eu cd | x=1
+		$(pwd) echo $(pwd) $(pwd) 'quoted text' $(pwd) cd export
+echo -eu x=1 awk /usr/bin /usr/bin export local | then then ${HOME}
+		printf "$@" 2>/dev/null test ${HOME} then export 2>/dev/null
+	local $(pwd) "$@" local -eu echo
+		2>/dev/null printf echo && 'quoted text'
+		$(pwd) echo sed | cd /usr/bin readonly export "$1" | "$@" export ${HOME} 'quoted text'
+${HOME} "$@" local "$1" grep
+	local printf local "$1" "$@" ${HOME} && x=1 echo
+		then "$1" 2>/dev/null $(pwd) cd $(pwd)
+"$@" 2>/dev/null local $(pwd) cd printf
+	awk $(pwd) "$@" && | | x=1 local done 2>/dev/null "$@" ${HOME} test "$@" awk
+		--verbose awk --verbose then --verbose done test readonly then && done | "$1" awk
+	| "$@" printf x=1 printf grep 2>/dev/null
+	then local export /usr/bin local
+	printf x=1 printf | x=1 sed readonly echo test
+--verbose "$@" && && sed readonly done done x=1 ${HOME} cd readonly
+/usr/bin && export local $(pwd) printf echo then | done
+	"$1" "$@" echo awk readonly cd grep printf grep awk
+	local readonly done printf
+		${HOME} && "$1" 'quoted text' --verbose test "$@" 2>/dev/null "$@"
+	test readonly printf -eu "$1" printf cd "$1"
+	cd "$1" awk export cd readonly "$1" ${HOME} -eu echo sed "$1" printf awk printf
+		export awk 2>/dev/null cd 'quoted text' 'quoted text'
+--verbose $(pwd) 'quoted text' --verbose cd -eu sed
+2>/dev/null sed | then ${HOME} grep /usr/bin $(pwd) "$1" x=1
+		grep readonly cd cd $(pwd) 2>/dev/null | export x=1
+		2>/dev/null sed printf echo
+	readonly grep --verbose readonly
+		cd $(pwd) $(pwd) grep cd /usr/bin 'quoted text' printf printf
+2>/dev/null | readonly x=1 sed $(pwd) "$@" printf "$1"
+		$(pwd) export awk awk x=1 cd && cd cd echo -eu ${HOME}
+		cd cd $(pwd) then test "$@" cd test grep
+	--verbose local x=1 | /usr/bin && export then test 2>/dev/null
+local printf && echo --verbose $(pwd)
+/usr/bin --verbose --verbose 'quoted text' cd then 2>/dev/null
+		${HOME} test /usr/bin 'quoted text' ${HOME} printf -eu
+	printf ${HOME} test awk test done --verbose
+	then sed readonly cd done echo "$@" && cd readonly ${HOME} | readonly readonly
+	test "$@" | --verbose "$1" | -eu x=1 echo | export "$@"
+	done --verbose | export awk awk /usr/bin grep printf
+		-eu "$@" then x=1 local test
+sed "$@" ${HOME} sed sed echo x=1 then x=1
+&& then awk x=1 ${HOME} sed | echo | --verbose "$1" grep printf
+cd local local grep export sed awk
+		x=1 'quoted text' ${HOME} sed then export sed -eu 2>/dev/null
+		then readonly -eu local ${HOME} done "$1" cd $(pwd) readonly echo 'quoted text'
+	grep 2>/dev/null cd test printf x=1 cd "$@" --verbose
+		readonly sed "$@" ${HOME} readonly then /usr/bin
+awk awk echo echo 2>/dev/null | printf awk && export
+	${HOME} ${HOME} test then 'quoted text' grep | --verbose -eu printf "$@" 2>/dev/null
+	sed printf && && | readonly "$1" -eu $(pwd) $(pwd) test export
+'quoted text' --verbose grep local grep local sed | 'quoted text'
+		done test grep export --verbose
+		&& sed awk done export grep printf --verbose
+cd readonly "$@" x=1 ${HOME} awk | "$@" local readonly
+	local sed sed $(pwd) grep && export && --verbose
+	export grep done "$@" && export
+		x=1 && echo && x=1 ${HOME} sed --verbose local awk readonly printf
+	| ${HOME} --verbose "$@" grep "$@" && --verbose grep x=1 printf sed -eu test ${HOME}
+	cd sed grep readonly "$@" sed done "$@" sed | --verbose done | done
+grep then "$1" "$1" export test then $(pwd) --verbose | ${HOME} grep
+readonly /usr/bin printf x=1 echo --verbose echo x=1 printf | /usr/bin
+		done done grep grep /usr/bin 2>/dev/null sed echo readonly readonly ${HOME}
+		cd echo ${HOME} ${HOME} then done grep awk 2>/dev/null awk
+	x=1 sed awk sed 2>/dev/null --verbose x=1 2>/dev/null readonly sed "$@" grep
+		2>/dev/null x=1 echo grep test --verbose
+		"$1" done cd cd local readonly
+		printf test | test then
+	2>/dev/null 'quoted text' then x=1 export test 'quoted text'
+	2>/dev/null export | x=1 export x=1 2>/dev/null
+echo readonly printf export grep done sed "$@" 2>/dev/null && "$1" readonly ${HOME}
+		2>/dev/null --verbose "$@" echo "$@" 'quoted text' -eu
+		2>/dev/null echo done 'quoted text' && readonly
+		local 'quoted text' grep sed readonly
+		"$1" ${HOME} -eu $(pwd) grep local 2>/dev/null x=1 --verbose grep then "$1" printf
+	done | --verbose cd local export ${HOME} /usr/bin /usr/bin "$@"
+	| then -eu local $(pwd) 2>/dev/null 'quoted text' local "$1" echo x=1
+	&& export --verbose readonly echo done | -eu | export /usr/bin 2>/dev/null
+		$(pwd) 2>/dev/null /usr/bin
+	${HOME} "$@" 2>/dev/null done "$@"
+	sed awk echo 2>/dev/null &&
+	echo -eu | --verbose --verbose local 2>/dev/null
+		--verbose sed then $(pwd) test 'quoted text' /usr/bin
+		| local 'quoted text'
+		'quoted text' printf $(pwd) "$@"
+sed then && -eu 2>/dev/null --verbose
+done local && $(pwd) cd sed export sed "$@" --verbose
+	'quoted text' /usr/bin && /usr/bin ${HOME} /usr/bin done printf
+	then grep | /usr/bin | then
+	grep $(pwd) 'quoted text' grep
+		test -eu 2>/dev/null grep
+	then 2>/dev/null --verbose done local sed $(pwd)
+		&& ${HOME} awk -eu 'quoted text' 'quoted text'
+	echo ${HOME} done test test
+/usr/bin printf $(pwd) printf ${HOME} "$1" $(pwd) done 'quoted text' && echo
+		sed /usr/bin "$1" local test then then --verbose "$1" /usr/bin | 'quoted text'
+	printf awk echo done $(pwd) echo $(pwd) test
+		$(pwd) --verbose $(pwd) cd "$1" awk /usr/bin grep export local -eu /usr/bin
+		test readonly ${HOME} printf sed done local && then sed "$1"
+		done echo -eu 'quoted text' local echo
+	| --verbose echo sed then ${HOME}
+	x=1 export then --verbose | 'quoted text'
+	&& ${HOME} $(pwd) done printf /usr/bin export ${HOME} readonly ${HOME} echo 'quoted text'
+	--verbose export awk export x=1 'quoted text' x=1 readonly
+	grep readonly 'quoted text' 2>/dev/null
+2>/dev/null readonly done $(pwd)
+	grep | test "$@" grep test && test $(pwd) echo --verbose --verbose
+		cd export done then /usr/bin grep "$1" "$1" then --verbose ${HOME} --verbose
+printf $(pwd) ${HOME} "$@" ${HOME}
+		"$@" /usr/bin grep "$1" 'quoted text' sed
+	${HOME} --verbose echo printf awk then -eu done cd /usr/bin readonly
+	readonly x=1 x=1 x=1 awk /usr/bin then --verbose | awk test grep local
+		local grep -eu readonly ${HOME} ${HOME} && --verbose "$1"
+$(pwd) ${HOME} done 'quoted text' x=1 readonly /usr/bin
+		cd export "$1" cd "$@" && grep /usr/bin --verbose
+	local done sed /usr/bin awk awk $(pwd) "$1" ${HOME} 2>/dev/null
+	done test cd readonly sed && grep echo /usr/bin /usr/bin
+done x=1 ${HOME} sed done ${HOME} && grep then "$@"
+	-eu cd && export readonly printf --verbose 2>/dev/null test done
+${HOME} --verbose ${HOME} | awk x=1 --verbose done "$1" && awk | "$1" awk /usr/bin
+		export ${HOME} 2>/dev/null
+	2>/dev/null then "$1" sed printf $(pwd) cd | "$@" grep -eu test ${HOME} | | 2>/dev/null
+	'quoted text' | && $(pwd) $(pwd)
+		done test -eu export 'quoted text' echo x=1 done "$1"
+	x=1 $(pwd) /usr/bin readonly
+		then grep "$1" 2>/dev/null grep -eu echo export echo
+		/usr/bin ${HOME} /usr/bin 2>/dev/null
+		awk $(pwd) echo test "$1" --verbose $(pwd) done then local
+cd $(pwd) -eu then && printf 2>/dev/null | awk printf &&
+	'quoted text' done cd echo
+cd readonly sed export 'quoted text' 'quoted text'
+		awk then "$@" export readonly
+		local ${HOME} 'quoted text' && | local "$1" then grep 'quoted text'
+export $(pwd) echo x=1 ${HOME} printf 2>/dev/null readonly local $(pwd) then cd
+	$(pwd) sed cd "$@" /usr/bin done sed
+--verbose local then | 2>/dev/null sed done awk printf 'quoted text'
+		x=1 readonly /usr/bin /usr/bin
+		readonly 'quoted text' 'quoted text'
+	then 'quoted text' $(pwd) && 'quoted text' ${HOME} local "$1"
+awk && export readonly "$@" then echo sed | test done $(pwd) readonly done
+then test 2>/dev/null echo 2>/dev/null ${HOME} $(pwd) readonly
+grep "$1" local ${HOME} grep cd ${HOME}
+${HOME} then $(pwd) "$1" --verbose local
+	export export cd | "$@" export --verbose /usr/bin --verbose ${HOME}
+	| --verbose "$1" done readonly export ${HOME} -eu "$@" then
+'quoted text' ${HOME} done ${HOME} export sed /usr/bin x=1 then && readonly
+		| local | x=1 ${HOME} done --verbose awk && local /usr/bin echo /usr/bin
+	awk | printf ${HOME} 'quoted text' 'quoted text'
+${HOME} | --verbose echo && awk 2>/dev/null |
+	awk 2>/dev/null grep done
+${HOME} "$@" ${HOME} readonly printf ${HOME} | $(pwd) test
+		"$1" --verbose "$1" -eu readonly test 'quoted text'
+grep export local sed done test readonly
+	$(pwd) cd echo 2>/dev/null "$@" grep -eu echo -eu local readonly sed "$1" done
+		"$@" && done && 2>/dev/null --verbose export
+		local | x=1 sed grep cd $(pwd) done local "$1" /usr/bin x=1 'quoted text'
+done export | printf readonly test export done 'quoted text'
+		&& printf test 2>/dev/null
+cd && ${HOME} readonly x=1 cd grep $(pwd) local x=1 'quoted text' --verbose
+test -eu grep readonly "$@" sed printf "$1" then awk awk local test local 2>/dev/null
+then ${HOME} 'quoted text' "$@" test ${HOME}
+		${HOME} awk export echo -eu /usr/bin $(pwd) test x=1 readonly
+--verbose 2>/dev/null awk echo $(pwd) /usr/bin -eu $(pwd) $(pwd)
+		&& /usr/bin awk local echo export then readonly readonly export 'quoted text'
+	| | export "$1" ${HOME} then test /usr/bin && cd 'quoted text' test ${HOME} test
+${HOME} 2>/dev/null then grep "$1" ${HOME}
+$(pwd) awk then 'quoted text'
+	awk awk "$@" cd 'quoted text' readonly done echo "$@"
+	-eu local readonly ${HOME}
+	x=1 printf printf 'quoted text' done "$1" "$@" 2>/dev/null $(pwd) $(pwd) /usr/bin
+	--verbose --verbose -eu && printf done &&
+	export readonly readonly readonly "$1" --verbose | --verbose done export
+	export test echo sed grep && local awk sed done
+then test grep -eu ${HOME} /usr/bin export x=1 && 2>/dev/null x=1
+	awk printf $(pwd) 'quoted text' "$@"
+		local awk grep echo "$@" "$1" test then "$@" --verbose local 'quoted text'
+		done -eu 'quoted text' sed echo "$1" /usr/bin -eu --verbose local "$1" grep
+awk done 'quoted text' | ${HOME} 2>/dev/null done cd "$@" local export export
+		--verbose cd 'quoted text' done echo readonly cd "$1" printf "$1" -eu "$@" echo
+		echo "$@" "$@" export "$1"
+	'quoted text' --verbose cd test then done test -eu awk x=1 echo
+		/usr/bin echo cd grep then awk /usr/bin -eu 2>/dev/null
+		grep sed local printf --verbose 2>/dev/null | x=1 'quoted text'
+		test cd -eu echo readonly then sed then
+	export "$@" -eu cd done grep then /usr/bin ${HOME} readonly x=1 |
+	--verbose local printf readonly
+		export test export "$1" grep
+	test | "$@" cd grep 'quoted text' export $(pwd) cd cd sed ${HOME}
+grep echo -eu "$@" printf cd $(pwd) sed
+readonly test 'quoted text' readonly cd && "$1" sed ${HOME}
+		readonly done grep readonly sed
+		x=1 export test x=1 sed && awk | 'quoted text' awk then
+	local sed export export x=1 printf
+	local 2>/dev/null local echo done export
+	--verbose x=1 "$@" cd echo awk test -eu
+	&& done test awk "$1"
+local test x=1 --verbose echo done printf awk | --verbose
+	x=1 "$@" done 'quoted text' "$1" /usr/bin -eu "$@" 'quoted text'
+	"$1" done cd local "$1" echo done echo -eu "$@" /usr/bin | export
+	-eu done "$1" 'quoted text' awk done cd "$@"
+		-eu readonly $(pwd) "$@" && 2>/dev/null
+"$1" "$@" then cd echo /usr/bin "$@" "$@" cd /usr/bin 'quoted text' -eu
+	--verbose --verbose awk /usr/bin echo ${HOME}
+	export local /usr/bin 2>/dev/null readonly ${HOME}
+		--verbose awk grep printf && | x=1 $(pwd) "$@"
+		export sed x=1 ${HOME} "$1" awk
+	$(pwd) local "$1" && sed 'quoted text' --verbose done export printf --verbose
+	$(pwd) /usr/bin /usr/bin "$1" export 'quoted text' then | 'quoted text' test
+	--verbose "$1" done "$@" sed awk cd awk printf grep cd echo
+	x=1 | 'quoted text' && local done done 2>/dev/null 'quoted text'
+echo /usr/bin "$@" test sed && printf
+		test && && export sed && | 'quoted text' | done echo | 2>/dev/null /usr/bin
+	&& local awk -eu "$@" then awk
+		x=1 echo "$1" 'quoted text' ${HOME} done ${HOME} test export then
+		export done done -eu cd x=1 printf /usr/bin 2>/dev/null
+$(pwd) test test "$@" | test test
+| && local ${HOME} -eu
+		cd $(pwd) readonly -eu /usr/bin grep "$1"
+		test printf /usr/bin x=1 2>/dev/null awk readonly readonly
+sed 'quoted text' --verbose cd "$1" 2>/dev/null then
+	readonly test /usr/bin grep
+		-eu $(pwd) cd "$1" --verbose test 'quoted text' export --verbose
+'quoted text' cd export "$1" && --verbose readonly
+		-eu /usr/bin /usr/bin "$1" sed --verbose $(pwd) | "$@" x=1 printf awk local
+test | printf done 'quoted text' then 2>/dev/null
+		x=1 done ${HOME} cd readonly awk sed "$1" 'quoted text'
+'quoted text' test 'quoted text' ${HOME}
+"$@" | $(pwd) ${HOME} "$1" sed "$1" "$@" -eu local done "$1" "$1" && -eu
+		grep /usr/bin grep awk --verbose grep done --verbose sed awk echo
+x=1 grep awk awk grep
+	2>/dev/null echo local --verbose
+		grep && --verbose cd -eu | awk -eu | 2>/dev/null grep 2>/dev/null export 'quoted text'
+	| readonly ${HOME} export echo $(pwd) readonly "$@" export
+		test "$1" cd local "$@" ${HOME} grep echo /usr/bin x=1 echo "$@" local
+		then "$1" printf sed 'quoted text'
+		local 'quoted text' ${HOME} grep export
+		readonly export $(pwd) | -eu && x=1 && awk echo export printf sed "$1" awk ${HOME}
+	awk | -eu grep grep done --verbose
+readonly -eu done /usr/bin "$1"
+	&& awk readonly 'quoted text' --verbose "$1" && export ${HOME}
+	cd && --verbose awk "$1" "$@" test echo $(pwd) then --verbose
+/usr/bin -eu echo sed awk printf cd readonly "$1" x=1 then local
+		"$@" "$1" x=1 export | | 2>/dev/null | $(pwd) /usr/bin echo readonly
+		x=1 x=1 && "$1" then readonly echo sed done printf 'quoted text'
+		${HOME} echo "$@" export $(pwd) "$@" && 2>/dev/null
+2>/dev/null /usr/bin grep done /usr/bin --verbose -eu done grep
+export "$1" cd echo 2>/dev/null local "$1" $(pwd)
+		/usr/bin then local printf --verbose cd -eu export
+	sed then ${HOME} readonly export x=1 local echo --verbose $(pwd) | grep 2>/dev/null
+		| | printf export --verbose -eu --verbose awk printf "$1" sed "$1"
+cd ${HOME} $(pwd) "$@" test test ${HOME} local
+then then 2>/dev/null grep readonly echo -eu done /usr/bin 'quoted text' grep /usr/bin
+		sed -eu && then ${HOME} printf awk
+		"$@" --verbose x=1 2>/dev/null printf readonly
+	sed ${HOME} grep && awk printf echo sed --verbose grep x=1 awk 2>/dev/null
+		then awk --verbose x=1 printf done | /usr/bin
+2>/dev/null 'quoted text' local && ${HOME} -eu
+		grep -eu echo && export -eu
+	then local local local "$@" then ${HOME}
+	${HOME} | && 'quoted text' "$1" grep
+	echo --verbose 2>/dev/null printf && ${HOME} x=1 echo awk
+		${HOME} done then $(pwd) test -eu ${HOME} 2>/dev/null /usr/bin readonly test cd
+"$1" --verbose ${HOME} awk cd |
+		$(pwd) then && printf export test x=1 $(pwd) then -eu echo
+		printf done local then $(pwd) export /usr/bin "$1" test test
+	cd awk 2>/dev/null x=1 done && 2>/dev/null
+"$1" x=1 $(pwd) && test then done -eu done "$1"
+	test awk then cd --verbose && echo 'quoted text' printf
+	cd $(pwd) --verbose done $(pwd)
+then ${HOME} export | test && /usr/bin grep /usr/bin export local -eu awk grep
+		sed test printf readonly awk x=1 local $(pwd)
+		--verbose local "$@" /usr/bin then echo printf readonly && printf "$1" test
+"$1" && && --verbose "$1" sed printf 'quoted text' echo $(pwd) ${HOME}
+	echo export /usr/bin echo then --verbose -eu export | /usr/bin
+		printf cd | local --verbose grep "$1" 'quoted text' x=1 readonly readonly then
+x=1 && done x=1 x=1 && x=1 --verbose sed export
+		sed -eu then && ${HOME} done readonly
+	then /usr/bin 2>/dev/null sed 'quoted text' && then export
+	export awk && cd test --verbose echo /usr/bin echo $(pwd)
+		grep readonly readonly test --verbose grep cd && sed && ${HOME} sed -eu cd local
+		then 'quoted text' /usr/bin 2>/dev/null && /usr/bin printf done /usr/bin
+	printf -eu $(pwd) cd x=1 grep
+	${HOME} cd cd 'quoted text' printf
+		| then x=1 | 2>/dev/null
+"$1" then awk $(pwd) readonly readonly then cd --verbose 2>/dev/null
+"$1" grep grep then "$@"
+	&& awk echo x=1 then echo | readonly /usr/bin
+		test 2>/dev/null grep && grep done done grep $(pwd)
+		readonly local "$1" -eu --verbose export --verbose
+		then 'quoted text' awk echo "$1" grep done done export awk && --verbose
+/usr/bin --verbose $(pwd) | 2>/dev/null --verbose | readonly
+		"$1" readonly $(pwd) --verbose sed
+	sed 'quoted text' "$1" printf "$@" && done --verbose 'quoted text'
+		printf done then readonly
+	printf "$@" echo cd && export && -eu ${HOME} "$@" done | cd local
+'quoted text' export 2>/dev/null /usr/bin | | x=1 test x=1
+/usr/bin export echo 2>/dev/null $(pwd) /usr/bin 2>/dev/null grep /usr/bin
+		$(pwd) "$1" awk /usr/bin ${HOME} cd --verbose export
+	readonly && done "$@" local cd "$@" cd --verbose
+	--verbose $(pwd) "$1" 2>/dev/null
+| test ${HOME} cd /usr/bin grep grep && -eu x=1 2>/dev/null "$1" local done --verbose
+	x=1 ${HOME} done awk printf
+		awk cd -eu "$@" && echo then "$@" export | then grep ${HOME} local x=1 'quoted text'
+		"$@" x=1 'quoted text' sed done 2>/dev/null
+		local local test test readonly "$1" /usr/bin "$1" cd export readonly
+		local done ${HOME} grep printf awk local then local grep "$1"
+		local awk awk x=1 'quoted text' "$1" $(pwd) sed echo local
+	test local $(pwd) "$@" readonly echo printf then --verbose printf
+		echo printf echo sed 2>/dev/null cd awk "$@" done &&
+grep $(pwd) awk && grep echo -eu readonly export /usr/bin
+	-eu $(pwd) "$1" && sed export
+		readonly $(pwd) then
+		x=1 "$@" -eu cd then done --verbose | cd --verbose "$@" && then
+	cd | then local then -eu export -eu printf readonly
+		x=1 "$1" local awk cd 'quoted text' --verbose echo awk done
+	sed /usr/bin sed grep export done awk then
+		| sed done | done readonly export "$@" /usr/bin
+		readonly export readonly && 2>/dev/null
+	| --verbose "$1" echo done 2>/dev/null
+	cd $(pwd) cd 2>/dev/null
+2>/dev/null local printf then test "$1" "$@"
+"$1" done echo local readonly readonly $(pwd) sed cd echo printf
+		grep done /usr/bin 2>/dev/null && 2>/dev/null "$@" $(pwd) export x=1 2>/dev/null
+	export printf "$1" echo $(pwd) local &&
+x=1 then awk ${HOME} -eu printf --verbose awk test grep grep
+		readonly /usr/bin test --verbose ${HOME} ${HOME} $(pwd) test
+--verbose /usr/bin "$@" done "$1" export 2>/dev/null x=1 then test test
+readonly sed then "$@" /usr/bin local 2>/dev/null -eu $(pwd)
+awk | -eu then sed awk test cd grep printf | $(pwd) /usr/bin
+	&& printf "$1" sed | cd && echo echo export "$@" && $(pwd)
+		done $(pwd) local /usr/bin awk x=1 2>/dev/null && ${HOME} then 'quoted text'
+		cd awk | ${HOME} /usr/bin -eu 2>/dev/null /usr/bin $(pwd) printf printf
+	-eu done ${HOME} && /usr/bin "$1" local awk 'quoted text'
+		echo printf then awk 'quoted text'
+"$1" 'quoted text' ${HOME} printf cd /usr/bin printf printf grep $(pwd) echo "$@"
+	cd export then /usr/bin $(pwd) --verbose
+-eu export x=1 x=1 echo
+	readonly "$1" && cd 'quoted text'
+readonly cd && && 'quoted text' awk grep sed printf grep then export "$1"
+"$1" && --verbose "$1" sed test done readonly
+printf --verbose ${HOME} sed
+		--verbose "$@" "$1" echo x=1 grep export /usr/bin
+readonly readonly local 'quoted text' ${HOME} 2>/dev/null local
+readonly echo 2>/dev/null --verbose ${HOME} |
+	'quoted text' 2>/dev/null printf test "$@" grep local ${HOME}
+	grep -eu 'quoted text' printf
+		echo local test | grep export echo awk $(pwd) local "$1" | "$1"
+	test grep grep then 2>/dev/null cd echo readonly
+then $(pwd) | echo grep /usr/bin
+	done done | test local sed then local x=1 printf 2>/dev/null /usr/bin sed | grep
+"$@" echo local "$@" echo then
+		| then -eu printf ${HOME} then grep ${HOME} /usr/bin
+grep ${HOME} export "$1" $(pwd) && awk sed --verbose
+grep --verbose awk /usr/bin readonly ${HOME} --verbose printf $(pwd) ${HOME}
+		x=1 "$1" done cd 'quoted text' grep x=1
+	${HOME} "$1" --verbose x=1 "$@"
+	export done echo sed readonly done
+	printf grep readonly
+		&& awk $(pwd) x=1 sed sed local echo printf cd test
+x=1 "$1" local x=1 grep sed awk x=1
+	${HOME} && grep local --verbose /usr/bin 2>/dev/null grep export
+x=1 sed | -eu "$1" 'quoted text' echo
+		/usr/bin | | -eu && grep test
+	export x=1 'quoted text' | awk
+export sed | /usr/bin cd readonly done ${HOME} sed
+		then ${HOME} 2>/dev/null x=1 -eu grep "$@" 2>/dev/null echo 2>/dev/null
+	${HOME} then echo cd /usr/bin $(pwd) cd done && export sed /usr/bin
+	awk awk cd 'quoted text'
+		readonly 2>/dev/null "$@"
+	test --verbose printf printf 'quoted text' | printf
+		printf awk done "$1" $(pwd) 'quoted text' $(pwd) cd 2>/dev/null "$@" local -eu
+		grep ${HOME} $(pwd) /usr/bin x=1 test test && "$@"
+	"$@" /usr/bin | | printf cd $(pwd) /usr/bin
+local export then ${HOME} -eu cd --verbose 'quoted text'
+	| grep cd "$@" | sed | | awk 2>/dev/null 2>/dev/null
+${HOME} ${HOME} sed echo 'quoted text' "$1" export
+		done sed awk printf "$1"
+	local 2>/dev/null $(pwd) test "$@" 'quoted text' echo test /usr/bin echo awk readonly
+	sed 'quoted text' export 'quoted text' awk 'quoted text'
+	x=1 awk | x=1 "$1" x=1 x=1 sed grep cd && printf export $(pwd) && 2>/dev/null
+x=1 /usr/bin done ${HOME} 'quoted text'
+&& awk -eu 2>/dev/null test readonly $(pwd) echo 'quoted text'
+	done done readonly 'quoted text' --verbose && $(pwd) 2>/dev/null grep readonly
+	${HOME} "$1" /usr/bin "$@" ${HOME} awk && then local
+	sed test echo && "$1" test export && $(pwd) echo ${HOME} export && done then "$@"
+	local ${HOME} grep $(pwd) cd awk 'quoted text' cd local awk ${HOME} done "$1"
+		readonly | --verbose "$@" --verbose local
+test grep 'quoted text' grep readonly local 2>/dev/null -eu
+done x=1 awk | export readonly 2>/dev/null readonly printf done "$@"
+		done x=1 && cd readonly cd echo | test "$@"
+	'quoted text' $(pwd) then && 2>/dev/null printf awk awk
+2>/dev/null x=1 done echo done then done echo $(pwd) 'quoted text'
+		awk local --verbose && x=1 done echo test echo -eu test then "$@" /usr/bin 2>/dev/null
+		export done done 2>/dev/null
+	--verbose cd test /usr/bin x=1 done 2>/dev/null /usr/bin test test readonly
+	echo | done /usr/bin printf then -eu --verbose $(pwd) -eu export && test
+-eu awk "$1" 2>/dev/null | && readonly "$@" local $(pwd) readonly
+	&& echo sed then awk echo $(pwd) 2>/dev/null 'quoted text' x=1 export
+	export x=1 2>/dev/null cd readonly
+then --verbose export sed local /usr/bin export test then "$1" cd sed
+	sed -eu | x=1 /usr/bin export "$@" then cd cd && readonly
+	$(pwd) export done 'quoted text'
+		export awk && /usr/bin ${HOME} x=1 "$1"
+		'quoted text' && | /usr/bin 2>/dev/null | && sed then then echo local awk
+	sed echo grep test test echo
+	| local awk --verbose /usr/bin ${HOME} --verbose ${HOME} done --verbose | ${HOME}
+		2>/dev/null $(pwd) test then
+	done local "$1" "$1" | readonly "$1" awk | ${HOME} printf
+		| grep --verbose --verbose ${HOME} then printf x=1 --verbose printf --verbose sed
+	2>/dev/null 2>/dev/null export
+	export "$1" readonly 'quoted text' local local --verbose
+	then -eu export && test local export local --verbose
+		export --verbose /usr/bin sed 'quoted text' readonly
+/usr/bin done | test export readonly printf grep echo done x=1 done
+	echo --verbose local test "$@" done ${HOME}
+	"$@" x=1 | && done 2>/dev/null echo | echo sed /usr/bin readonly x=1
+	test -eu export /usr/bin printf done test "$1"
+		awk awk export printf local ${HOME} /usr/bin x=1 && "$1" x=1 && export
+"$1" sed sed readonly echo readonly 2>/dev/null
+		"$1" then readonly | test 2>/dev/null ${HOME}
+	test --verbose | ${HOME} --verbose cd then /usr/bin 2>/dev/null done /usr/bin
+cd 'quoted text' | "$1" && ${HOME} awk $(pwd) cd --verbose x=1 "$@"
+		| | cd done 2>/dev/null local echo export export sed /usr/bin readonly x=1 echo
+		grep --verbose done --verbose | then done local readonly sed ${HOME}
+	sed awk && 2>/dev/null printf test printf && grep "$@" cd "$@"
+'quoted text' 2>/dev/null local x=1 "$1" export test grep export
+printf --verbose $(pwd)
+	--verbose readonly printf --verbose done cd echo local awk echo local "$@"
+	grep local echo test done sed --verbose export
+	printf awk grep 2>/dev/null | "$@" | "$1" ${HOME} local export x=1
+	cd printf echo /usr/bin "$1" 'quoted text' ${HOME} cd awk sed
+	done sed "$1" $(pwd) x=1 printf 'quoted text' "$@" printf cd -eu cd sed
+$(pwd) export "$1" awk test echo printf echo then cd
+	&& grep test export /usr/bin awk sed
+	-eu awk awk -eu 2>/dev/null | 'quoted text' cd then test "$1" export
+		/usr/bin 2>/dev/null grep && x=1
+	cd awk test grep "$1" "$@" test export -eu 2>/dev/null
+		cd $(pwd) awk local && sed
+	x=1 sed export --verbose local && $(pwd) "$1" sed "$@" "$1" export done "$1"
+		'quoted text' done sed readonly && echo test ${HOME} "$@" cd then export sed
+		| grep /usr/bin $(pwd) sed
+then export awk --verbose "$@" | x=1 $(pwd) test $(pwd) -eu
+		export ${HOME} --verbose |
+	sed x=1 2>/dev/null awk -eu awk grep grep done /usr/bin "$1" then /usr/bin done
+--verbose x=1 export --verbose ${HOME} cd | "$@" "$1" grep printf
+x=1 /usr/bin awk $(pwd) sed /usr/bin
+		&& "$1" 'quoted text' --verbose
+awk then -eu echo cd printf printf echo cd
+	then echo x=1 'quoted text' then "$@" -eu echo
+readonly 'quoted text' export -eu "$@" cd echo 'quoted text' "$1"
+		test /usr/bin && "$@" ${HOME} && awk /usr/bin export echo "$@" done
+		--verbose x=1 echo local readonly grep x=1 'quoted text'
+	readonly "$1" awk then done sed -eu echo done awk
+	-eu grep 'quoted text' sed |
+echo x=1 readonly | printf export grep cd then $(pwd) 'quoted text'
+		done readonly x=1 && done
+readonly export | -eu export readonly --verbose $(pwd) done export &&
+		export 'quoted text' printf 'quoted text'
+"$1" && $(pwd) sed readonly grep awk local 2>/dev/null grep
+	readonly x=1 ${HOME} awk printf sed local /usr/bin && /usr/bin
+	&& done grep awk 2>/dev/null test "$1" && | awk
+		"$@" 2>/dev/null --verbose sed cd echo
+'quoted text' "$1" && "$@"
+	2>/dev/null ${HOME} 2>/dev/null echo cd && local done x=1 local
+&& x=1 test && export ${HOME} export
+&& done /usr/bin local grep printf
+		echo test | echo "$@" awk then awk
+		&& then "$1" test 'quoted text' "$@" readonly $(pwd) /usr/bin "$@" grep -eu local
+	/usr/bin printf printf x=1 --verbose $(pwd)
+sed --verbose 2>/dev/null local -eu x=1 | $(pwd) done
+	grep && local export && "$1" /usr/bin
+		printf -eu && grep sed cd echo && local "$@" "$1"
+		/usr/bin --verbose --verbose sed test ${HOME} 2>/dev/null /usr/bin
+	test 2>/dev/null test && readonly
+		grep ${HOME} echo && && echo grep cd then done x=1 local export -eu "$1"
+grep 2>/dev/null sed printf done export -eu
+		"$@" | sed echo --verbose -eu ${HOME} /usr/bin ${HOME} printf
+	awk -eu grep export x=1 local sed cd "$@" export printf awk -eu then
+		test grep 2>/dev/null && x=1 &&
+		x=1 && x=1 then 'quoted text' echo 2>/dev/null printf local | /usr/bin ${HOME}
+		done $(pwd) awk local test ${HOME}
+	cd done -eu -eu 'quoted text' sed x=1
+		test "$1" /usr/bin awk readonly
+		echo echo 'quoted text' ${HOME} echo "$1"
+	$(pwd) $(pwd) export grep test && echo sed local $(pwd) sed 2>/dev/null awk
+		awk x=1 grep && done $(pwd) test local export
+	"$@" /usr/bin "$@" grep ${HOME} readonly ${HOME} export ${HOME}
+		'quoted text' x=1 "$@" sed echo
+-eu then readonly $(pwd) | sed export sed
+	"$@" local done "$@" grep 2>/dev/null done then 'quoted text'
+		'quoted text' local printf sed "$1"
+	${HOME} grep test "$1" sed readonly 'quoted text' cd "$1" local && /usr/bin done
+cd readonly export && then
+	x=1 $(pwd) $(pwd) /usr/bin done cd local printf | printf done --verbose cd | --verbose
+		readonly 'quoted text' readonly done | done awk sed done awk awk grep printf
+$(pwd) $(pwd) awk 2>/dev/null cd -eu "$@" grep && done 'quoted text'
+	"$1" $(pwd) --verbose /usr/bin local "$1"
+/usr/bin test -eu 2>/dev/null readonly done export 2>/dev/null readonly
+		'quoted text' "$1" local echo 'quoted text' sed printf --verbose |
+		cd && echo -eu "$@" && grep printf 'quoted text' && test && awk cd -eu
+	readonly cd && ${HOME} -eu test --verbose
+/usr/bin /usr/bin "$1" "$@" 'quoted text' x=1 "$@"
+	$(pwd) cd then awk awk echo
+	then ${HOME} "$@" awk "$@" printf
+then readonly "$@" 'quoted text' -eu ${HOME} grep x=1 2>/dev/null "$@" cd printf
+grep 2>/dev/null /usr/bin -eu test $(pwd) readonly ${HOME} then grep $(pwd)
+	local done sed 'quoted text' local 2>/dev/null
+	test "$1" ${HOME} $(pwd) grep && readonly test cd done
+		--verbose && | awk test | echo ${HOME} readonly echo readonly echo
+		-eu "$1" local cd awk then
+	| $(pwd) "$1" then ${HOME} local | echo "$@" "$@" local sed 'quoted text'
+	x=1 printf cd cd --verbose printf readonly | --verbose then
+		/usr/bin /usr/bin $(pwd) "$1" 2>/dev/null x=1
+	/usr/bin "$1" awk sed 'quoted text' -eu && -eu /usr/bin && |
+$(pwd) /usr/bin sed cd | x=1 -eu | x=1 "$1" x=1 awk printf
+'quoted text' local $(pwd) /usr/bin
+	then cd cd 2>/dev/null && done echo local "$1" &&
+${HOME} cd echo $(pwd) x=1 /usr/bin -eu "$@" | readonly export readonly cd
+		cd awk 'quoted text' printf sed readonly export | ${HOME} export "$@" /usr/bin
+grep echo && local cd then $(pwd) echo done "$@" -eu readonly
+		x=1 sed grep readonly cd echo ${HOME} ${HOME} && cd awk 2>/dev/null x=1 'quoted text'
+cd --verbose | 2>/dev/null awk readonly | "$@" | "$1" x=1 sed
+| ${HOME} echo printf grep printf
+awk 2>/dev/null ${HOME} | x=1 x=1 /usr/bin ${HOME} 2>/dev/null
+"$@" test /usr/bin ${HOME} "$1" printf
+awk test sed -eu cd echo test "$@" local "$1" local --verbose
+export | "$1" -eu echo | grep --verbose
+	/usr/bin done cd && "$1" /usr/bin export awk test 2>/dev/null
+	readonly done x=1 "$@" $(pwd) 2>/dev/null echo echo ${HOME}
+$(pwd) 2>/dev/null awk 2>/dev/null -eu "$@" 'quoted text' x=1 printf readonly
+		export x=1 cd ${HOME} test $(pwd) cd readonly $(pwd)
+'quoted text' 2>/dev/null "$@" /usr/bin awk local
+export echo x=1 readonly "$1" "$1" done --verbose ${HOME} cd 'quoted text'
+	| cd done && "$1" && 'quoted text' 2>/dev/null echo echo "$1" then
+	then done $(pwd) then grep done readonly printf
+-eu /usr/bin $(pwd) --verbose x=1 2>/dev/null --verbose -eu printf
+		echo x=1 $(pwd) /usr/bin 2>/dev/null | 'quoted text' | && "$@"
+	cd x=1 "$1" /usr/bin echo then /usr/bin x=1 grep 2>/dev/null local test |
+then local "$1" /usr/bin cd export -eu readonly /usr/bin done echo cd 2>/dev/null
+	x=1 /usr/bin && && test cd -eu readonly --verbose
+local done | echo "$@" 'quoted text' $(pwd) export | "$@" sed then -eu -eu "$1"
+done done "$@" done printf local "$1" /usr/bin
+	x=1 --verbose x=1 awk "$1" cd
+	/usr/bin local --verbose -eu 2>/dev/null printf cd ${HOME}
+		"$1" -eu done $(pwd) | sed --verbose
+	-eu sed $(pwd) /usr/bin $(pwd) cd readonly readonly echo $(pwd)
+local local cd printf "$@" awk | "$@" awk grep
+		readonly sed awk test "$@"
+		sed /usr/bin echo readonly done x=1 -eu 'quoted text'
+		-eu grep $(pwd) printf grep done export
+printf "$1" x=1 x=1 then 2>/dev/null test echo grep 'quoted text' grep "$@" then
+		&& $(pwd) "$@" printf grep export done then $(pwd)
+awk --verbose x=1 readonly --verbose
+export 2>/dev/null cd local ${HOME} --verbose $(pwd) local $(pwd)
+$(pwd) export done -eu printf | "$@"
+echo done then printf test grep /usr/bin sed local grep 2>/dev/null
+		&& done local cd cd test readonly
+$(pwd) 'quoted text' test grep && readonly done grep && /usr/bin
+	"$@" readonly -eu echo
+$(pwd) awk printf x=1 readonly "$@" 2>/dev/null /usr/bin
+"$1" done printf && 'quoted text' $(pwd)
+		x=1 ${HOME} /usr/bin grep cd
+	echo done 2>/dev/null grep 'quoted text'
+printf x=1 -eu grep "$@" printf then export && 'quoted text'
+sed ${HOME} local --verbose --verbose /usr/bin 'quoted text' | | "$@"
+	then cd --verbose readonly export echo /usr/bin awk cd -eu then /usr/bin
+test -eu sed echo /usr/bin x=1 $(pwd) grep ${HOME} readonly cd x=1
+	done | then readonly ${HOME} "$1" readonly && --verbose
+		x=1 -eu readonly test && local /usr/bin
+		"$@" -eu /usr/bin /usr/bin
+	then "$@" "$@" $(pwd) then 2>/dev/null $(pwd) && /usr/bin | --verbose
+	then "$1" ${HOME} "$@" done $(pwd) | $(pwd) export 'quoted text'
+	$(pwd) $(pwd) awk then | sed "$1" test sed 'quoted text'
+		echo -eu x=1 /usr/bin --verbose readonly
+-eu sed printf "$@" "$1" local sed $(pwd) -eu export
+	'quoted text' "$1" local | x=1 grep --verbose cd 'quoted text' readonly local
+	--verbose | printf printf -eu x=1 cd 2>/dev/null awk grep grep echo sed | sed
+		test && test 2>/dev/null "$1" sed $(pwd) printf local /usr/bin | x=1 | then
+echo test test | local
+		awk test | grep echo test ${HOME} export echo printf awk then x=1 cd awk
+printf export 2>/dev/null
+		echo echo readonly awk 2>/dev/null export grep cd test "$@"
+-eu "$@" /usr/bin awk export cd | | cd local "$@" then then echo
+readonly /usr/bin /usr/bin
+		"$@" sed echo 2>/dev/null grep awk sed "$1" export grep sed 2>/dev/null
+		&& | /usr/bin 2>/dev/null awk "$1"
+		/usr/bin -eu $(pwd) /usr/bin sed && 2>/dev/null && sed local
+"$@" $(pwd) 2>/dev/null export test | then ${HOME} export && printf grep &&
+	&& grep printf && sed ${HOME} echo ${HOME} --verbose
+		"$@" ${HOME} then printf /usr/bin ${HOME} && -eu printf
+	awk && then 2>/dev/null -eu "$1" local printf sed test /usr/bin
+awk ${HOME} cd x=1 x=1 local $(pwd) 2>/dev/null then printf
+		printf 'quoted text' sed grep $(pwd) ${HOME} grep $(pwd) -eu sed cd x=1
+readonly /usr/bin test
+	printf sed printf sed sed done $(pwd)
+"$@" x=1 /usr/bin /usr/bin cd | test "$@" readonly
+'quoted text' /usr/bin "$1" export 'quoted text' local /usr/bin printf
+		x=1 readonly export /usr/bin 2>/dev/null printf
+		x=1 ${HOME} readonly "$@" test "$@" -eu local 2>/dev/null sed /usr/bin
+		${HOME} -eu 'quoted text' cd local | sed /usr/bin test "$@"
+	-eu 2>/dev/null --verbose ${HOME} export
+$(pwd) ${HOME} ${HOME} -eu $(pwd) cd --verbose --verbose "$1"
+		'quoted text' done test echo ${HOME} x=1 awk "$1" -eu "$1" done -eu | 2>/dev/null
+	awk then cd -eu test "$1" 2>/dev/null cd
+		&& echo done readonly -eu && $(pwd) test "$@" && export ${HOME} echo local local
+"$@" cd x=1 test test sed -eu ${HOME} grep x=1 sed -eu &&
+		--verbose ${HOME} 'quoted text' --verbose awk -eu readonly /usr/bin
+&& done 2>/dev/null printf echo local grep ${HOME} ${HOME}
+	printf "$@" grep "$@" grep -eu test /usr/bin
+export export then /usr/bin "$1" --verbose sed awk ${HOME} "$1"
+		awk | then cd "$@" grep "$@" cd sed done /usr/bin
+| && then && x=1 local ${HOME} test readonly local readonly
+"$@" echo -eu /usr/bin local
+done readonly sed echo "$1"
+"$1" x=1 --verbose "$1" awk test printf done $(pwd)
+		test && --verbose 'quoted text' /usr/bin "$@" cd sed awk
+		local readonly readonly x=1 export
+		| cd printf "$1" test $(pwd) sed 2>/dev/null
+'quoted text' "$@" 'quoted text'
+	grep printf cd 'quoted text' cd local export
+&& local ${HOME} "$1" --verbose $(pwd) $(pwd) grep local
+		export 2>/dev/null sed 'quoted text' "$@" done "$1" x=1 sed $(pwd)
+	&& $(pwd) local then /usr/bin printf | export ${HOME} echo done $(pwd)
+		-eu awk then sed cd "$@" | grep
+test export test 'quoted text' "$@" ${HOME} cd sed "$@"
+		&& --verbose 2>/dev/null | local $(pwd) 2>/dev/null
+	then $(pwd) x=1 echo ${HOME} readonly test /usr/bin "$@" /usr/bin
+$(pwd) && ${HOME} && ${HOME} $(pwd) --verbose test then ${HOME} &&
+		then ${HOME} -eu "$1" printf echo sed 2>/dev/null
+export printf /usr/bin test ${HOME} awk awk $(pwd)
+cd local local "$1" echo local export | sed export "$1" test && awk
+/usr/bin | then -eu -eu awk awk "$@" ${HOME}
+		done local "$1" echo "$@" --verbose
+2>/dev/null "$@" local printf 'quoted text' export -eu done | 2>/dev/null
+export sed test echo | grep local /usr/bin test printf $(pwd) cd 2>/dev/null
+export done local awk 'quoted text'
+"$1" echo readonly $(pwd) readonly --verbose 2>/dev/null export printf
+	x=1 then test ${HOME} "$@" grep && export --verbose | test grep && && awk
+"$@" export | x=1 && ${HOME} && printf
+	test 2>/dev/null -eu cd local local
+	/usr/bin then | /usr/bin "$@" x=1 --verbose 'quoted text'
+then test local "$@" $(pwd) x=1 ${HOME} $(pwd) ${HOME} cd && then
+--verbose $(pwd) local "$@" "$1" cd cd && sed 'quoted text' "$1" "$@" 2>/dev/null
+	done awk | done "$1" local --verbose
+		sed -eu then 2>/dev/null ${HOME} echo $(pwd) ${HOME}
+		echo "$1" 'quoted text' local $(pwd) sed /usr/bin
+	2>/dev/null -eu test readonly | x=1 $(pwd) sed -eu | echo sed "$@" "$1" $(pwd)
+	readonly then "$1" echo readonly
+sed sed export | echo 'quoted text' then local -eu && export "$@" 2>/dev/null
+	"$1" 2>/dev/null test --verbose echo "$1" readonly $(pwd) local
+	sed 'quoted text' | cd
+-eu export -eu awk grep awk export x=1 readonly cd readonly test x=1 ${HOME} test
+--verbose --verbose -eu | -eu test
+printf x=1 cd $(pwd) awk /usr/bin -eu
+	test $(pwd) export local grep grep /usr/bin readonly --verbose echo awk export
+	&& then local readonly readonly
+	echo ${HOME} && $(pwd) | -eu 2>/dev/null echo ${HOME} $(pwd) awk then "$1" |
+	&& "$1" /usr/bin sed --verbose done
+	-eu 'quoted text' /usr/bin test export | -eu awk echo
+	"$@" "$@" 'quoted text' awk printf 'quoted text' printf
+--verbose 'quoted text' && test sed done x=1 -eu 'quoted text' "$@" local "$@" $(pwd)
+	-eu "$1" $(pwd) then local
+local printf test && $(pwd) test $(pwd) ${HOME} $(pwd)
+	cd $(pwd) /usr/bin /usr/bin readonly done printf test
+		"$@" "$1" local && 'quoted text' echo $(pwd)
+	${HOME} "$1" && export awk "$@" readonly
+/usr/bin printf $(pwd) ${HOME} test $(pwd) awk x=1 awk | readonly 'quoted text'
+	awk | "$@" "$@" export "$1" export "$@" 2>/dev/null then awk local ${HOME} "$1"
+	x=1 awk /usr/bin && x=1 done sed x=1 echo cd then readonly
+printf echo /usr/bin 2>/dev/null
+-eu $(pwd) /usr/bin "$1"
+	${HOME} --verbose ${HOME} && readonly sed | local "$1" local
+	awk $(pwd) "$@" -eu grep sed readonly local ${HOME} $(pwd) -eu 2>/dev/null test
+	'quoted text' "$1" printf $(pwd) $(pwd) awk | readonly
+		--verbose test $(pwd) x=1 x=1 "$@"
+		x=1 export readonly readonly 2>/dev/null | "$1" "$1" readonly "$@"
+	${HOME} && export ${HOME}
+		"$@" export | --verbose 2>/dev/null x=1 x=1 "$@"
+		sed ${HOME} "$1" --verbose && -eu /usr/bin 2>/dev/null ${HOME} /usr/bin
+${HOME} sed | "$@" 'quoted text'
+printf awk /usr/bin awk -eu $(pwd) grep 2>/dev/null grep 'quoted text' cd awk
+		'quoted text' --verbose test test then -eu cd /usr/bin readonly 'quoted text'
+grep x=1 && | -eu -eu sed "$1" printf
+		echo "$@" sed && sed 2>/dev/null export
+/usr/bin local done export then test awk $(pwd) --verbose grep awk grep
+		/usr/bin && awk sed ${HOME} -eu x=1 export && grep awk awk | then ${HOME} |
+		awk printf then test printf then x=1 echo sed printf sed /usr/bin
+	/usr/bin export ${HOME} then "$@" 2>/dev/null --verbose readonly readonly
+	printf "$@" echo then 2>/dev/null 2>/dev/null
+		local && awk local --verbose export "$1" sed export readonly readonly
+	printf /usr/bin 2>/dev/null test local ${HOME} | readonly cd echo $(pwd) local done
+		then 2>/dev/null grep 2>/dev/null -eu 'quoted text' then echo printf
+"$@" && 2>/dev/null "$1" && ${HOME} | grep grep 2>/dev/null then
+	cd x=1 && cd --verbose ${HOME}
+	test cd "$@" local then printf
+		"$1" then 2>/dev/null 2>/dev/null "$1" | 2>/dev/null
+'quoted text' printf $(pwd) echo awk echo then x=1 local "$@" ${HOME} -eu -eu
+echo ${HOME} printf "$@" test readonly grep awk
+-eu local 2>/dev/null -eu --verbose then local printf | echo export awk
+	grep printf "$@" echo $(pwd) export $(pwd) $(pwd)
+/usr/bin 'quoted text' 2>/dev/null readonly && readonly "$@" sed "$@" "$1"
+cd ${HOME} x=1 readonly export local --verbose
+		done | x=1 "$@" grep local /usr/bin -eu ${HOME} readonly sed cd export "$@" export
+2>/dev/null cd then readonly
+then "$@" -eu "$@" then "$1"
+		sed echo awk ${HOME} -eu echo readonly test "$1" "$@" done
+	--verbose 2>/dev/null -eu local export local readonly x=1 ${HOME} "$1"
+	echo "$@" then printf grep 2>/dev/null done done 'quoted text' then
+	export then printf --verbose readonly
+	--verbose awk local printf test /usr/bin ${HOME} then then grep 'quoted text' "$@"
+		x=1 -eu -eu | echo 2>/dev/null
+--verbose test echo --verbose "$1" 2>/dev/null x=1 -eu readonly
+done echo local then then ${HOME} ${HOME}
+cd grep grep awk x=1 -eu awk test cd local then 2>/dev/null awk
+		printf local done awk -eu export printf && | |
+$(pwd) echo local "$@" then "$@" then "$1" 'quoted text' x=1 ${HOME}
+	"$1" local export then test awk sed export awk printf readonly
+	awk test -eu sed test done readonly awk grep | done echo echo
+		readonly x=1 test cd test export readonly ${HOME} done done sed
+	/usr/bin export readonly
+	$(pwd) $(pwd) | ${HOME} && done | | -eu export
+	cd -eu "$@" x=1 | sed --verbose sed
+	"$@" -eu 'quoted text' && test then then --verbose test done grep sed x=1 test
+local local /usr/bin done "$@" $(pwd) ${HOME} awk | readonly
+		readonly export $(pwd)
+awk local ${HOME} local echo $(pwd) -eu test ${HOME} sed $(pwd)
+	2>/dev/null 'quoted text' ${HOME} cd grep ${HOME} "$1"
+	&& printf ${HOME} 2>/dev/null echo readonly local local 'quoted text'
+	&& cd -eu echo $(pwd) "$1"
+readonly grep && readonly sed $(pwd) ${HOME} "$@"
+test done readonly grep sed 2>/dev/null then /usr/bin ${HOME}
+printf /usr/bin $(pwd) sed && /usr/bin &&
+printf --verbose then -eu echo local | awk echo echo
+	printf ${HOME} awk /usr/bin "$1" /usr/bin 'quoted text'
+	grep sed --verbose && export awk awk $(pwd) x=1
+		test echo && --verbose readonly "$1" --verbose grep -eu 2>/dev/null local
+		cd x=1 ${HOME} then -eu $(pwd) x=1 "$@" local 'quoted text' /usr/bin
+	-eu | "$@" printf awk 'quoted text' "$@" ${HOME} "$1" ${HOME} cd echo 'quoted text'
+		echo 'quoted text' local 'quoted text' readonly
+'quoted text' 'quoted text' "$1"
+	printf && then sed $(pwd) printf
+"$1" 'quoted text' "$1" done
+	x=1 echo sed x=1 && 'quoted text'
+cd cd -eu test "$@" -eu done
+	local local 2>/dev/null done
+		local /usr/bin && grep "$@" printf cd
+2>/dev/null 'quoted text' cd --verbose test then $(pwd) 'quoted text'
+-eu 2>/dev/null 'quoted text' 2>/dev/null
+export 2>/dev/null printf "$@" then 'quoted text'
+		"$@" cd --verbose && $(pwd) x=1 --verbose && -eu export -eu sed
+&& cd awk sed $(pwd) 'quoted text' --verbose $(pwd) &&
+	| awk --verbose local readonly 'quoted text'
+	2>/dev/null 'quoted text' echo --verbose
+$(pwd) awk -eu ${HOME} /usr/bin
+		${HOME} | grep grep printf
+then /usr/bin x=1 cd readonly
+	cd cd 2>/dev/null $(pwd) -eu "$@" 'quoted text' printf
+local $(pwd) grep done 'quoted text' && | export test awk then
+	"$@" | then 'quoted text' echo export sed "$@"
+readonly --verbose printf ${HOME} sed "$@" readonly 2>/dev/null
+	"$@" "$@" 2>/dev/null echo done $(pwd) x=1 awk awk readonly
+/usr/bin 'quoted text' ${HOME} test done |
+		local local local "$@" grep then sed ${HOME} "$@" ${HOME} cd printf export
+		echo 'quoted text' -eu /usr/bin awk printf | test ${HOME} cd "$1" -eu --verbose
+		local test printf 'quoted text' test awk local
+grep grep sed sed done 2>/dev/null && export "$1" | grep printf --verbose sed
+	done ${HOME} 'quoted text'
+		echo grep readonly then ${HOME} $(pwd) sed readonly cd 'quoted text' test
@@ -0,0 +1,2001 @@
+sed echo local "$1" grep cd -eu ${HOME} x=1 /usr/bin printf readonly
+local $(pwd) /usr/bin ${HOME} echo sed && readonly -eu /usr/bin local
+"$@" export export -eu $(pwd) "$1" local
+		echo done 2>/dev/null done export printf cd -eu printf printf 'quoted text'
+	x=1 && local grep "$@" /usr/bin local
+		local | readonly $(pwd) cd printf "$1" then local then 'quoted text' ${HOME}
+		"$1" awk sed $(pwd) $(pwd) 2>/dev/null /usr/bin echo awk printf 'quoted text'
+		done && 2>/dev/null cd 'quoted text'
+	"$@" ${HOME} $(pwd) x=1 readonly $(pwd) && cd done then "$1" "$@"
+	awk test 2>/dev/null sed test $(pwd) done -eu
+	| && cd 2>/dev/null test
+	then 'quoted text' -eu then awk local cd x=1 done readonly then
+		/usr/bin cd "$1" echo then "$1" then test | 2>/dev/null && printf export
+		&& then | "$@" echo "$1" "$1" "$@" then export
+awk x=1 test readonly | 2>/dev/null test export
+'quoted text' ${HOME} done test
+local then x=1 done 'quoted text' $(pwd) $(pwd) awk --verbose
+$(pwd) sed $(pwd) x=1 "$1" cd /usr/bin 'quoted text'
+		${HOME} "$1" | "$1" && $(pwd)
+	--verbose $(pwd) ${HOME} $(pwd) printf && grep echo | 'quoted text' cd && readonly
+		readonly ${HOME} "$1" ${HOME} awk x=1
+	done done "$@" ${HOME} echo 2>/dev/null test --verbose
+echo local $(pwd) then printf echo
+	printf local printf /usr/bin
+	'quoted text' awk "$@" | sed ${HOME} x=1 echo done cd done
+		then printf /usr/bin "$1" ${HOME}
+	awk then "$@" /usr/bin cd | "$@" export x=1 x=1 "$@"
+		cd && && then cd awk then done
+local awk cd /usr/bin echo echo "$1" echo sed "$@" grep $(pwd) sed sed done awk
+	then "$@" export $(pwd) --verbose
+		then --verbose | | "$@" ${HOME}
+	-eu 2>/dev/null test grep "$1" sed $(pwd) -eu grep echo printf
+		2>/dev/null readonly local grep "$@" cd ${HOME} local -eu sed grep local 2>/dev/null
+		export --verbose "$1" sed "$1" export test then && --verbose sed test done
+	| $(pwd) --verbose printf then && sed echo echo sed "$@" ${HOME}
+		readonly awk done sed ${HOME} "$1" sed printf -eu 'quoted text'
+	echo sed awk 'quoted text' x=1 printf 'quoted text'
+awk $(pwd) 2>/dev/null done 2>/dev/null "$1" && export "$@" local /usr/bin readonly
+		"$1" echo local done awk ${HOME} done echo test "$1" "$1" awk $(pwd) | local
+cd echo -eu echo sed x=1 local
+local 2>/dev/null printf cd sed awk | grep done
+		"$1" 'quoted text' readonly readonly awk echo echo "$1" --verbose echo /usr/bin
+		cd then 'quoted text' x=1 export -eu grep awk readonly echo
+		done awk local done then | --verbose test cd 'quoted text' -eu x=1 | sed
+&& export awk $(pwd) sed --verbose printf $(pwd) -eu
+		then "$@" echo $(pwd) export ${HOME} --verbose x=1 awk test test ${HOME} cd &&
+		cd 'quoted text' cd -eu ${HOME} /usr/bin local
+	x=1 2>/dev/null grep /usr/bin "$1" cd sed done readonly awk
+		-eu echo local readonly then printf
+		sed 2>/dev/null | | | && local printf "$1" echo "$@" -eu local sed "$@" readonly
+-eu 'quoted text' "$1" local "$@" export awk && --verbose
+		export 2>/dev/null then $(pwd) echo test
+		echo | -eu --verbose $(pwd) -eu echo cd readonly grep
+	export printf 2>/dev/null grep grep then done echo test | ${HOME} done awk 'quoted text'
+-eu local readonly -eu "$1" --verbose test $(pwd) local readonly /usr/bin printf
+		-eu x=1 echo -eu 2>/dev/null
+	echo grep test /usr/bin awk x=1
+		grep 'quoted text' then local
+		local 'quoted text' | -eu test --verbose test 'quoted text' 'quoted text'
+		"$@" "$@" cd echo export | /usr/bin readonly export
+	then -eu 'quoted text' ${HOME} "$@" -eu
+	&& -eu done 2>/dev/null local ${HOME} ${HOME} sed printf
+readonly export export local "$1" 2>/dev/null awk
+2>/dev/null $(pwd) grep -eu echo /usr/bin ${HOME} "$@"
+export x=1 printf $(pwd) x=1 && printf sed printf
+	echo x=1 grep $(pwd) -eu "$@" local "$@" x=1 awk 'quoted text' "$@" &&
+then $(pwd) done sed x=1 test sed printf
+	done 'quoted text' ${HOME} export grep printf sed
+	"$@" local then local grep -eu /usr/bin
+x=1 export then 'quoted text' ${HOME} 2>/dev/null export awk printf "$@" done "$@"
+		export done local awk then "$@" x=1 "$1" ${HOME} && "$@" "$@" cd |
+readonly /usr/bin "$1" readonly
+		cd --verbose -eu test export sed "$1" readonly then /usr/bin
+		x=1 ${HOME} -eu echo --verbose
+		"$1" && echo readonly sed printf 'quoted text' export readonly grep local grep
+		"$1" | | && grep $(pwd) sed readonly awk cd then printf && 'quoted text' sed
+		cd test $(pwd) "$1" 2>/dev/null
+then test grep && 2>/dev/null printf
+${HOME} echo readonly local then awk 'quoted text'
+		--verbose $(pwd) "$@" "$1" /usr/bin -eu awk echo --verbose --verbose
+		$(pwd) export printf ${HOME} test && x=1 cd -eu printf | echo
+		echo "$1" readonly --verbose awk 2>/dev/null
+-eu grep x=1 readonly 2>/dev/null
+		echo "$@" echo done x=1 $(pwd) "$1" --verbose "$@" $(pwd)
+	grep --verbose | "$1" ${HOME} "$1" awk -eu -eu ${HOME} cd
+		'quoted text' /usr/bin local awk cd test printf | local && printf echo cd
+		&& grep 'quoted text' printf local x=1 local ${HOME} /usr/bin then "$1" test
+		&& cd local $(pwd) --verbose
+	$(pwd) 'quoted text' cd -eu sed then export x=1
+	2>/dev/null then readonly "$1" echo
+x=1 x=1 /usr/bin -eu done "$1" export
+	grep --verbose done | sed readonly && test $(pwd) readonly awk && --verbose
+		| $(pwd) "$1" --verbose ${HOME}
+		grep then 'quoted text' readonly then readonly
+	'quoted text' --verbose then 'quoted text'
+grep ${HOME} export done awk
+		-eu "$@" echo 'quoted text' --verbose
+		test 2>/dev/null "$1" 2>/dev/null
+"$1" test /usr/bin 2>/dev/null
+		grep --verbose x=1 test readonly cd grep sed 2>/dev/null grep x=1
+test then awk readonly sed 'quoted text' printf
+	awk sed grep local grep $(pwd) cd x=1 'quoted text' done readonly readonly
+		| ${HOME} cd done local 'quoted text'
+"$1" ${HOME} $(pwd) $(pwd) --verbose -eu x=1 then "$1" awk && sed readonly
+		"$1" local $(pwd) "$1" | export
+		'quoted text' echo cd 2>/dev/null
+		readonly cd test --verbose -eu -eu export && then
+	/usr/bin x=1 test grep cd $(pwd) | export echo x=1 sed 2>/dev/null
+	&& /usr/bin local ${HOME} x=1
+	grep $(pwd) readonly awk "$1" awk
+		sed | 'quoted text' local sed "$@" done "$@" cd ${HOME} local grep
+| echo sed 'quoted text' local then -eu
+local x=1 readonly export -eu -eu printf 'quoted text'
+${HOME} cd awk local /usr/bin /usr/bin "$1" 2>/dev/null test "$1" export "$1" printf
+		"$1" cd "$1" sed grep && test done done readonly local x=1 2>/dev/null
+test x=1 "$@" sed --verbose export "$1" echo $(pwd) printf
+	local && readonly "$1" x=1 ${HOME} readonly /usr/bin 'quoted text' --verbose
+${HOME} /usr/bin $(pwd) test ${HOME}
+awk && && grep && ${HOME} sed "$1" "$1" grep $(pwd)
+	| 'quoted text' "$@" "$1" then 2>/dev/null export "$@" done "$@" |
+"$1" 2>/dev/null $(pwd) cd awk grep then
+	cd 2>/dev/null | && -eu then -eu test x=1 sed ${HOME} printf
+local "$@" "$1" x=1 | -eu --verbose $(pwd) awk export "$1" /usr/bin
+		"$1" readonly && /usr/bin
+cd export test "$1" grep | export | x=1 export 2>/dev/null export readonly
+then then then /usr/bin then x=1 printf grep | local
+	printf --verbose "$@" sed test done "$@" then done x=1
+	grep printf echo && 'quoted text'
+then "$1" /usr/bin | cd 2>/dev/null readonly x=1 -eu done sed
+		export export grep 'quoted text' && ${HOME}
+		echo /usr/bin "$@" x=1 /usr/bin $(pwd) $(pwd) "$1" 'quoted text' sed --verbose then
+/usr/bin "$1" local "$1" test --verbose /usr/bin
+	'quoted text' export ${HOME} sed ${HOME} | $(pwd) sed /usr/bin sed printf --verbose
+		&& 'quoted text' echo /usr/bin export -eu awk --verbose | $(pwd) $(pwd)
+grep && grep && cd then $(pwd) x=1 /usr/bin --verbose local export ${HOME}
+	/usr/bin cd "$@" "$@" local "$1" awk export /usr/bin x=1 awk test sed "$@"
+	$(pwd) $(pwd) "$1" | $(pwd) cd local local 2>/dev/null then ${HOME}
+		x=1 sed readonly test 2>/dev/null ${HOME} sed export readonly
+grep 2>/dev/null export local readonly awk x=1 echo "$@" awk x=1
+	awk 'quoted text' $(pwd) "$1" test -eu $(pwd) | "$@" 2>/dev/null
+		readonly x=1 -eu | -eu x=1
+		/usr/bin $(pwd) ${HOME} /usr/bin /usr/bin sed /usr/bin
+	2>/dev/null printf | -eu 2>/dev/null awk
+test 2>/dev/null awk 'quoted text' 2>/dev/null cd
+		-eu && readonly /usr/bin 2>/dev/null
+		sed | ${HOME} /usr/bin x=1 ${HOME} then
+		/usr/bin awk 'quoted text' /usr/bin
+	export grep x=1 printf then printf printf awk /usr/bin "$@" -eu | printf
+	done local 2>/dev/null "$@" readonly
+$(pwd) echo done /usr/bin
+grep awk && -eu && local "$@" awk export "$@" "$1" done ${HOME}
+		$(pwd) $(pwd) local 2>/dev/null | $(pwd) -eu 2>/dev/null
+local grep readonly export awk export "$@" done then grep cd
+		$(pwd) ${HOME} sed sed x=1 "$@" -eu awk && grep 2>/dev/null -eu --verbose
+	x=1 local sed local $(pwd) test export printf
+x=1 grep && ${HOME} cd test -eu then | 'quoted text' $(pwd) /usr/bin
+	--verbose cd "$1" /usr/bin "$1" grep done "$1" export "$1" then sed /usr/bin
+	awk "$1" local export export /usr/bin
+	/usr/bin ${HOME} printf
+		local sed export grep printf /usr/bin 'quoted text'
+		done readonly readonly sed echo 2>/dev/null
+	| 2>/dev/null --verbose export && readonly echo echo
+	'quoted text' /usr/bin --verbose export
+	echo "$1" ${HOME} then local 'quoted text' 'quoted text' $(pwd)
+"$1" -eu | done then 'quoted text' grep "$1" && grep
+	awk local export sed && printf test export done 'quoted text' readonly /usr/bin
+		/usr/bin 'quoted text' printf
+		export "$@" awk 2>/dev/null x=1 grep 2>/dev/null -eu then sed | test
+		"$@" -eu | readonly echo -eu local local done then readonly readonly --verbose
+awk then export echo cd $(pwd)
+		awk "$@" -eu awk /usr/bin 2>/dev/null
+awk -eu && then sed "$@" printf ${HOME}
+	printf 2>/dev/null $(pwd) printf --verbose "$1" -eu
+	-eu "$1" -eu echo && printf
+${HOME} printf --verbose export cd sed "$@" local -eu -eu $(pwd) 'quoted text'
+	sed awk awk sed export readonly grep ${HOME} sed |
+	done && done --verbose export awk export echo --verbose done cd cd /usr/bin
+		2>/dev/null -eu printf local then readonly
+	| export "$@" awk 'quoted text'
+	grep sed done awk $(pwd) 2>/dev/null | readonly grep grep x=1 then
+		readonly && /usr/bin --verbose local awk then && sed grep grep ${HOME}
+&& readonly /usr/bin awk $(pwd) export ${HOME} local test ${HOME} /usr/bin awk readonly
+		echo /usr/bin --verbose "$1" readonly
+grep printf $(pwd) sed 'quoted text'
+	then sed /usr/bin && sed test /usr/bin printf
+	done x=1 "$@" | awk x=1 readonly x=1 awk x=1 --verbose
+		${HOME} -eu done readonly x=1 $(pwd) export test 2>/dev/null
+	cd awk | | $(pwd) echo --verbose sed local "$@" $(pwd) | printf export
+		cd grep grep /usr/bin | /usr/bin export --verbose
+	then grep "$1" x=1 2>/dev/null
+awk | 'quoted text' | grep | readonly then grep test printf cd export done
+echo then echo "$1" awk /usr/bin 2>/dev/null test "$1" -eu readonly x=1 ${HOME}
+	-eu printf x=1 cd | cd /usr/bin
+local then ${HOME} 'quoted text' x=1 export ${HOME} -eu "$1" --verbose
+		"$1" printf | "$@" sed ${HOME} grep then local 'quoted text' "$1" 2>/dev/null
+		'quoted text' printf export test test cd readonly
+	echo local | sed -eu "$1" /usr/bin
+		"$@" printf echo && sed export ${HOME} "$@" ${HOME}
+		&& printf -eu then "$1" export
+		local printf awk ${HOME} x=1 | awk
+	local awk --verbose done $(pwd) printf 2>/dev/null x=1 done grep sed cd sed "$1"
+	local readonly --verbose /usr/bin sed && ${HOME}
+	x=1 --verbose x=1 then printf "$@" -eu local
+test sed local done 2>/dev/null
+		sed local x=1 awk then sed echo -eu test then x=1 | export 2>/dev/null
+2>/dev/null -eu -eu echo grep grep | -eu "$1" 2>/dev/null
+		$(pwd) | grep && --verbose 2>/dev/null awk --verbose -eu 2>/dev/null
+test then $(pwd) -eu sed printf cd echo grep
+		${HOME} echo 2>/dev/null local | printf export /usr/bin ${HOME} grep --verbose
+	-eu ${HOME} 'quoted text' "$@" printf test done echo "$@" -eu /usr/bin
+		test ${HOME} local $(pwd) &&
+	test printf -eu x=1 sed x=1 && &&
+		sed echo | readonly test done awk export done 2>/dev/null
+	2>/dev/null cd sed test -eu awk ${HOME} --verbose readonly --verbose "$1" test
+	readonly ${HOME} test 'quoted text' | $(pwd) "$1" 'quoted text'
+--verbose $(pwd) $(pwd) "$@" "$@" grep
+	awk --verbose sed cd --verbose $(pwd) cd && test cd
+-eu done $(pwd) awk readonly
+		"$@" printf "$@" grep && done && 'quoted text' && && readonly
+		2>/dev/null then export $(pwd) local sed
+	awk $(pwd) /usr/bin --verbose ${HOME} -eu
+x=1 grep --verbose awk /usr/bin then --verbose 'quoted text'
+"$@" test test 'quoted text' local x=1
+printf $(pwd) | ${HOME}
+	$(pwd) awk --verbose sed echo echo awk awk
+sed echo 2>/dev/null -eu export sed 'quoted text' echo
+	"$1" done local echo 2>/dev/null 2>/dev/null
+2>/dev/null x=1 cd 2>/dev/null 2>/dev/null ${HOME} |
+then && sed test echo 2>/dev/null 'quoted text' --verbose $(pwd)
+		then "$@" x=1 done cd ${HOME} -eu | --verbose
+		readonly cd export 2>/dev/null
+		-eu 'quoted text' --verbose grep && /usr/bin awk 2>/dev/null export
+	echo grep echo $(pwd) | && x=1 echo x=1 then readonly
+awk awk && awk 'quoted text' "$1" test 'quoted text' &&
+		2>/dev/null x=1 $(pwd) sed echo ${HOME} "$@" sed awk awk
+		sed done echo awk $(pwd) $(pwd) x=1 --verbose | local --verbose
+	cd "$1" sed readonly export done done /usr/bin then local
+--verbose local export /usr/bin && local 2>/dev/null
+	x=1 "$1" done export -eu awk readonly export test echo 2>/dev/null
+		done $(pwd) "$1" && echo --verbose grep local 2>/dev/null echo
+		echo then then && printf "$1" grep /usr/bin test grep "$1" | "$1" -eu awk ${HOME}
+	x=1 then local 2>/dev/null readonly "$1" grep 'quoted text' printf 'quoted text'
+		test export --verbose cd test awk sed -eu ${HOME}
+x=1 cd then | cd export readonly ${HOME} --verbose "$1" sed
+	echo echo $(pwd) x=1 readonly "$1" grep awk test done readonly cd cd done "$@"
+$(pwd) done /usr/bin ${HOME} && grep awk cd -eu grep readonly
+		sed echo local sed printf then done readonly
+grep grep ${HOME} sed
+		$(pwd) /usr/bin -eu then "$1" ${HOME} test grep 2>/dev/null 2>/dev/null "$1" done
+/usr/bin "$1" x=1 2>/dev/null export printf $(pwd) local $(pwd) | awk
+	printf ${HOME} done sed test --verbose /usr/bin
+		echo "$@" export echo && cd done
+-eu -eu $(pwd) readonly ${HOME} echo awk export readonly
+&& awk local x=1 awk test test
+		"$@" $(pwd) | echo $(pwd) done echo sed grep ${HOME} printf awk printf
+$(pwd) local grep /usr/bin /usr/bin "$@" local "$@" cd $(pwd) then | grep $(pwd)
+| printf done printf /usr/bin done printf done cd $(pwd) x=1 && 'quoted text'
+		awk "$1" local -eu echo awk export cd echo x=1 --verbose 2>/dev/null
+		cd local cd echo && "$1" readonly $(pwd) -eu done "$1"
+		--verbose then grep then 'quoted text' ${HOME} local -eu "$@" ${HOME}
+	test x=1 'quoted text' cd $(pwd) test cd
+	2>/dev/null ${HOME} 2>/dev/null
+	&& echo /usr/bin 2>/dev/null x=1 sed --verbose awk done local x=1 done
+	echo sed -eu $(pwd) -eu 2>/dev/null test $(pwd)
+		test grep "$1" x=1 done then then $(pwd) 'quoted text' /usr/bin readonly
+	readonly -eu readonly sed ${HOME} ${HOME} done awk 2>/dev/null
+	sed "$1" 'quoted text' $(pwd) cd && 2>/dev/null done export -eu $(pwd)
+		local $(pwd) grep cd printf cd
+		local cd printf printf cd $(pwd) x=1 then grep "$@" grep /usr/bin
+	$(pwd) test local echo -eu printf grep sed ${HOME} -eu
+test done -eu done grep 2>/dev/null export 2>/dev/null -eu
+/usr/bin --verbose && grep
+done printf echo && sed "$1"
+	/usr/bin "$@" export awk done 'quoted text' --verbose /usr/bin x=1 printf --verbose
+		export grep grep test awk local local then done "$1" echo $(pwd) $(pwd) grep
+		'quoted text' x=1 "$1" grep $(pwd) 2>/dev/null "$@"
+-eu printf echo --verbose local -eu 'quoted text' $(pwd) local then
+		then | sed /usr/bin cd done -eu --verbose
+"$@" /usr/bin cd local sed cd --verbose
+	cd done ${HOME} echo done printf echo | -eu cd awk
+		$(pwd) -eu "$@" readonly ${HOME} "$@"
+$(pwd) echo x=1 local printf
+	${HOME} "$@" awk grep
+	done export ${HOME} awk
+	readonly awk 'quoted text' x=1 echo && cd test readonly | "$@" then
+	echo done "$1" export | ${HOME} echo "$@" local printf $(pwd)
+		&& 'quoted text' "$1" | done echo echo && 2>/dev/null && then awk x=1 then "$@"
+		sed then readonly export 'quoted text'
+	x=1 echo /usr/bin readonly -eu && test local ${HOME} | -eu ${HOME}
+printf echo | then 'quoted text'
+		local awk grep printf
+	printf "$1" | grep | cd awk local grep x=1 export done sed "$@"
+local done /usr/bin /usr/bin | $(pwd)
+	printf "$1" done printf
+	sed then 2>/dev/null grep echo echo 2>/dev/null echo | ${HOME}
+	awk "$1" "$1" local grep /usr/bin x=1 grep
+		x=1 sed -eu cd x=1 awk "$1" x=1 local -eu awk ${HOME} | /usr/bin x=1 readonly
+"$@" /usr/bin awk cd /usr/bin x=1 printf 'quoted text'
+	done sed readonly sed local ${HOME} | "$1"
+printf 2>/dev/null cd | | grep printf then done then ${HOME} export
+	export x=1 2>/dev/null test export | x=1 then awk /usr/bin
+$(pwd) "$1" 2>/dev/null grep --verbose x=1 sed x=1 -eu local "$@" ${HOME}
+	| done "$1" cd /usr/bin readonly 'quoted text' export
+		2>/dev/null cd grep ${HOME}
+x=1 ${HOME} cd $(pwd) printf local
+	"$1" ${HOME} -eu --verbose export
+		${HOME} $(pwd) export 2>/dev/null
+	$(pwd) && ${HOME} && echo printf done done -eu export x=1 ${HOME}
+printf printf export -eu sed printf echo 'quoted text' ${HOME}
+sed sed -eu x=1 | $(pwd)
+		"$@" 'quoted text' test export "$1" local | then
+	awk cd x=1 export /usr/bin /usr/bin /usr/bin
+		local | | cd awk 2>/dev/null 'quoted text' awk export x=1 printf --verbose
+		cd ${HOME} echo cd done && printf ${HOME} then export
+	&& "$1" /usr/bin printf ${HOME}
+	"$1" grep then done sed ${HOME} printf x=1 x=1
+		readonly cd done readonly then echo
+test /usr/bin /usr/bin ${HOME} cd 2>/dev/null
+	&& readonly -eu x=1 test grep /usr/bin local /usr/bin
+	--verbose && awk "$@" $(pwd) $(pwd)
+printf -eu readonly $(pwd) &&
+		printf done grep local local test | printf "$1" then "$1" | export
+		done sed awk x=1 then /usr/bin test sed printf
+	2>/dev/null test 2>/dev/null
+	then test sed awk ${HOME} ${HOME} 'quoted text'
+	"$@" 'quoted text' sed $(pwd) 2>/dev/null | printf
+"$@" "$@" | echo -eu grep -eu
+	/usr/bin "$@" 2>/dev/null && awk $(pwd) ${HOME} "$1"
+sed | /usr/bin 'quoted text' sed --verbose export ${HOME} --verbose
+	'quoted text' && "$1" then | awk $(pwd) echo sed grep test
+	readonly /usr/bin sed cd
+then $(pwd) --verbose | awk then printf grep --verbose
+		| /usr/bin 2>/dev/null export readonly | && cd "$@" | --verbose export
+		"$1" printf x=1 2>/dev/null && /usr/bin grep /usr/bin printf local echo /usr/bin
+| "$1" /usr/bin awk export "$1" test readonly echo awk cd && printf
+'quoted text' $(pwd) awk grep echo
+	'quoted text' "$@" cd readonly 2>/dev/null local ${HOME} -eu sed readonly "$1" |
+x=1 echo $(pwd) local && local --verbose 2>/dev/null
+		then test -eu readonly 'quoted text' cd readonly export 'quoted text'
+grep then test test && awk
+	local local 2>/dev/null readonly local 2>/dev/null
+	cd done done --verbose $(pwd) awk done done
+-eu | "$1" readonly 'quoted text' 2>/dev/null awk | x=1 ${HOME} 'quoted text'
+		local export local ${HOME} printf $(pwd) && test 'quoted text' -eu sed 'quoted text'
+cd readonly awk && grep local test /usr/bin x=1 test printf $(pwd)
+		"$1" grep done 'quoted text' printf $(pwd)
+		&& "$1" awk readonly echo "$@" "$@" --verbose echo | /usr/bin readonly
+/usr/bin && "$1" sed | "$@" x=1 ${HOME} 'quoted text' export $(pwd) grep
+	local echo done export
+	/usr/bin then 2>/dev/null | test printf
+	'quoted text' printf grep printf | -eu && && readonly then awk ${HOME} sed && |
+	grep done done done 'quoted text' grep x=1
+	local | -eu echo readonly
+		x=1 sed "$@" --verbose sed 2>/dev/null 'quoted text'
+cd && local export /usr/bin printf export awk && /usr/bin readonly
+		2>/dev/null 2>/dev/null "$1" export export readonly
+		grep --verbose "$@" x=1 test
+	cd test test done | test 2>/dev/null echo echo --verbose awk -eu done test
+&& "$@" grep $(pwd) readonly cd cd 'quoted text' readonly ${HOME} awk x=1 2>/dev/null
+		test /usr/bin --verbose grep done sed 2>/dev/null test printf
+$(pwd) | cd -eu export test $(pwd)
+		awk "$@" cd done printf /usr/bin
+then ${HOME} && --verbose 'quoted text' test /usr/bin sed then $(pwd) ${HOME}
+local then echo printf "$@" test 2>/dev/null grep grep ${HOME}
+&& done echo then && 2>/dev/null --verbose cd done 'quoted text' sed
+	/usr/bin cd -eu test readonly -eu -eu 'quoted text' "$@" cd export
+	grep printf "$1" 2>/dev/null awk
+	grep then cd $(pwd) "$1" | /usr/bin 'quoted text'
+x=1 && "$@" 2>/dev/null grep 2>/dev/null echo test
+	$(pwd) $(pwd) x=1 awk awk sed done printf --verbose sed grep
+awk test sed ${HOME} 'quoted text' done $(pwd) --verbose 2>/dev/null
+| -eu printf cd --verbose echo cd done readonly
+test ${HOME} -eu | grep x=1 "$1" /usr/bin
+	cd local cd then --verbose 'quoted text' && 'quoted text'
+	grep | readonly --verbose cd --verbose /usr/bin x=1 cd test cd /usr/bin
+	echo --verbose printf ${HOME} done "$@" echo "$@" readonly ${HOME} -eu done
+test cd then "$@" cd $(pwd) awk export && cd cd "$@" sed "$1" && | readonly --verbose
+		echo $(pwd) echo done then readonly sed grep && test "$1" cd then echo local readonly
+		cd sed grep test 'quoted text' echo printf printf cd local ${HOME} 'quoted text'
+	export ${HOME} | sed readonly echo $(pwd) echo -eu "$1"
+		done local then local sed | 2>/dev/null readonly echo cd awk
+sed then ${HOME} echo then /usr/bin /usr/bin
+		x=1 "$1" --verbose && awk test sed export grep --verbose then done
+		export printf readonly printf
+export ${HOME} readonly grep 2>/dev/null && printf export "$@" $(pwd)
+		'quoted text' awk && then local test readonly export
+		x=1 readonly 2>/dev/null local export export awk
+'quoted text' grep done x=1 cd then
+	| cd --verbose then export grep && 'quoted text'
+		'quoted text' grep echo grep printf printf
+		/usr/bin test local $(pwd) local local $(pwd)
+"$@" cd $(pwd) | /usr/bin test then readonly
+		"$@" done | echo -eu x=1 echo x=1 $(pwd) done "$@" cd ${HOME}
+	echo echo cd "$@" awk /usr/bin 'quoted text' local readonly
+		/usr/bin local sed ${HOME}
+awk test && printf test readonly then $(pwd) export | local && sed echo && "$@"
+	"$1" | then /usr/bin
+		-eu /usr/bin && ${HOME} echo export done local local $(pwd) ${HOME} grep
+	local 2>/dev/null /usr/bin local | -eu "$@"
+export grep printf /usr/bin readonly echo "$@" readonly test -eu echo ${HOME}
+/usr/bin grep "$@" awk done export 2>/dev/null awk done
+'quoted text' printf "$1" ${HOME} readonly "$@" cd -eu && local /usr/bin 'quoted text'
+awk -eu /usr/bin ${HOME} grep /usr/bin /usr/bin && --verbose --verbose test then
+'quoted text' awk $(pwd) echo then sed 2>/dev/null "$@" && 'quoted text' 'quoted text'
+awk "$1" then x=1 local printf
+	test awk 'quoted text' cd -eu /usr/bin -eu ${HOME}
+		echo echo done --verbose printf --verbose sed grep --verbose 2>/dev/null | 2>/dev/null
+	sed printf x=1 grep "$1" && "$1" printf
+export -eu echo -eu $(pwd) printf
+		-eu && echo --verbose cd /usr/bin done
+		readonly 'quoted text' test export test "$1" local test
+"$1" readonly readonly --verbose $(pwd) 2>/dev/null
+		echo "$@" "$@" grep grep "$1" echo x=1 test
+done test grep local "$@" echo grep 'quoted text' awk
+		2>/dev/null "$1" then "$@" ${HOME}
+	${HOME} "$1" local 'quoted text' "$@" x=1 ${HOME} "$@" --verbose "$1"
+cd | && "$@" printf test x=1 export
+	test done -eu && | && $(pwd) export readonly awk 'quoted text' test -eu -eu cd
+/usr/bin "$1" -eu then "$1" export
+local ${HOME} printf x=1 && $(pwd) done done "$1" then printf
+		$(pwd) export cd echo x=1 'quoted text' "$1" then x=1
+	awk test $(pwd) | awk then "$@" 'quoted text'
+	echo /usr/bin -eu readonly printf done test export "$@" ${HOME} printf
+	echo cd x=1 -eu test 2>/dev/null && readonly grep $(pwd) "$1" sed "$@"
+"$@" test "$@" done echo -eu export
+		'quoted text' "$@" sed && echo | echo sed done --verbose readonly
+		local awk done export echo readonly test
+	/usr/bin ${HOME} export printf --verbose --verbose echo sed
+"$@" printf awk "$1" local /usr/bin x=1 done cd ${HOME} $(pwd) | 2>/dev/null
+	readonly 'quoted text' echo awk test done
+	'quoted text' 'quoted text' echo echo --verbose -eu ${HOME}
+		then 'quoted text' sed --verbose
+	&& -eu && sed && $(pwd)
+-eu --verbose /usr/bin export export
+then then test done done "$@"
+--verbose then "$1" sed export && "$1" 2>/dev/null 'quoted text' /usr/bin -eu
+	then echo printf -eu done readonly echo printf
+readonly test local test
+		then ${HOME} printf done -eu local grep $(pwd) sed -eu "$@" -eu then
+echo $(pwd) $(pwd) /usr/bin then && "$1"
+	readonly sed then /usr/bin 2>/dev/null -eu readonly
+		&& done cd done x=1 'quoted text' awk export export
+		--verbose grep --verbose $(pwd) "$@" readonly --verbose
+	&& export 'quoted text' printf "$1" --verbose cd "$@" | local $(pwd) && ${HOME}
+	then -eu then --verbose ${HOME} test then done local 2>/dev/null printf /usr/bin
+-eu local grep local sed export --verbose ${HOME} 'quoted text' export awk | 2>/dev/null
+		'quoted text' echo sed then printf 2>/dev/null
+		2>/dev/null && export -eu -eu sed 'quoted text' echo | ${HOME} ${HOME} readonly
+		echo /usr/bin ${HOME} ${HOME} awk printf export --verbose done
+	printf ${HOME} readonly then readonly
+		test 2>/dev/null export sed cd 'quoted text' && "$@" | -eu
+test grep /usr/bin echo cd printf
+sed sed x=1 readonly local | --verbose --verbose -eu x=1 echo grep && 'quoted text'
+		"$@" x=1 | /usr/bin done "$1"
+		export export then 2>/dev/null test &&
+	done local awk cd x=1 && 'quoted text' | export
+	readonly | && local 2>/dev/null 2>/dev/null -eu sed readonly done /usr/bin
+	printf local awk awk 2>/dev/null printf /usr/bin
+| done ${HOME} printf 'quoted text' --verbose "$@" done echo 2>/dev/null sed
+/usr/bin --verbose x=1
+$(pwd) --verbose --verbose /usr/bin ${HOME} readonly
+then 'quoted text' test
+$(pwd) --verbose echo ${HOME} sed --verbose
+		sed "$@" 2>/dev/null done $(pwd) "$1" | 'quoted text'
+readonly && printf echo | echo awk
+		--verbose test -eu 'quoted text' ${HOME} $(pwd) awk local ${HOME} --verbose
+	test test cd export test echo ${HOME} grep
+		/usr/bin test -eu cd local
+/usr/bin -eu sed done 2>/dev/null awk awk x=1 $(pwd) $(pwd)
+	readonly -eu "$1" /usr/bin $(pwd) 'quoted text'
+grep $(pwd) done then /usr/bin
+		echo done && -eu readonly
+/usr/bin 2>/dev/null local export cd /usr/bin "$@" "$@"
+		-eu "$@" echo cd /usr/bin
+		awk sed -eu x=1 export grep test test ${HOME} then cd "$@" grep awk
+		x=1 sed | /usr/bin done cd then ${HOME} cd sed /usr/bin local -eu $(pwd) echo
+then && printf test --verbose
+	| sed "$@" "$@" readonly export | awk printf /usr/bin
+		'quoted text' export --verbose awk test sed then local --verbose && then 2>/dev/null
+2>/dev/null sed -eu --verbose
+2>/dev/null local /usr/bin $(pwd) /usr/bin then ${HOME} printf printf
+-eu printf /usr/bin then $(pwd)
+		/usr/bin "$1" -eu "$1" awk $(pwd) grep
+		/usr/bin awk readonly "$@" echo /usr/bin /usr/bin "$@" then "$1"
+	grep 'quoted text' x=1 'quoted text' awk -eu --verbose "$1" local echo
+		'quoted text' --verbose then
+	"$@" | "$@" ${HOME} sed /usr/bin done cd echo sed sed echo
+		printf /usr/bin "$@" awk 'quoted text'
+	| test awk ${HOME} -eu
+"$1" 'quoted text' echo test echo --verbose
+then "$@" -eu | cd test printf cd $(pwd) | test $(pwd)
+		2>/dev/null /usr/bin printf printf | /usr/bin
+	"$@" grep then ${HOME} done --verbose grep done
+		/usr/bin then done grep ${HOME} "$1" readonly 2>/dev/null x=1 x=1 "$@"
+'quoted text' | | then sed /usr/bin cd local
+		--verbose then x=1 echo export
+		| done && "$@" readonly "$1" export "$1"
+		done -eu awk 2>/dev/null sed export printf 'quoted text' "$1" /usr/bin
+	then grep --verbose /usr/bin | grep && sed grep grep --verbose "$1" --verbose echo
+	2>/dev/null --verbose "$@" 2>/dev/null
+	local --verbose sed cd awk echo | "$@" $(pwd)
+		cd "$@" x=1 --verbose "$@" echo readonly
+	&& then printf | awk
+		echo "$@" test readonly
+	"$1" && awk test export test sed grep
+		grep x=1 grep 2>/dev/null | x=1 $(pwd) 'quoted text'
+		$(pwd) --verbose /usr/bin test awk "$@"
+export sed echo then -eu "$@" echo grep readonly | "$@" test
+		done && awk readonly 2>/dev/null awk echo
+		echo test ${HOME} printf "$1"
+		"$@" echo 'quoted text' then readonly x=1 export readonly x=1
+export 'quoted text' export 2>/dev/null 2>/dev/null echo
+'quoted text' x=1 done x=1 grep awk echo readonly local x=1 'quoted text' x=1 /usr/bin
+--verbose $(pwd) /usr/bin readonly test grep sed ${HOME} done
+	--verbose ${HOME} cd export 'quoted text'
+	--verbose $(pwd) sed | ${HOME} x=1 export
+	cd | then done then $(pwd) echo /usr/bin
+		then --verbose ${HOME} ${HOME} 2>/dev/null
+sed "$@" -eu 'quoted text' "$@" /usr/bin
+	test grep printf && "$@" readonly -eu --verbose
+		| awk readonly export | test --verbose "$1" "$@"
+		2>/dev/null 2>/dev/null printf -eu awk done x=1 test local
+	x=1 then --verbose printf
+'quoted text' done "$@" | $(pwd) cd && then 'quoted text'
+local --verbose done "$@" readonly /usr/bin
+		readonly test $(pwd) local export 'quoted text' | | -eu export
+test 2>/dev/null export -eu ${HOME}
+		$(pwd) -eu export local done echo done
+--verbose $(pwd) && $(pwd) local echo
+		test --verbose done "$@" sed "$1"
+grep "$1" printf grep x=1 /usr/bin grep "$1" awk ${HOME} x=1 /usr/bin /usr/bin
+	$(pwd) readonly --verbose local readonly cd readonly done awk 2>/dev/null
+	grep local done export local cd printf cd | grep 2>/dev/null
+	then "$1" local sed 'quoted text'
+	$(pwd) -eu sed cd 2>/dev/null grep export local
+	-eu done local 2>/dev/null
+'quoted text' sed --verbose local 2>/dev/null $(pwd) echo export 'quoted text'
+		local then "$1" --verbose 2>/dev/null awk then echo
+${HOME} local done cd /usr/bin x=1 | --verbose sed ${HOME} grep sed $(pwd)
+		cd ${HOME} echo printf /usr/bin /usr/bin $(pwd) echo && cd awk echo then then --verbose
+	--verbose local ${HOME}
+	sed done --verbose printf
+	x=1 --verbose test awk "$1" 2>/dev/null ${HOME} cd then sed
+		${HOME} "$@" 'quoted text'
+	--verbose grep | | 2>/dev/null 'quoted text'
+grep /usr/bin -eu echo done export
+		then -eu ${HOME} $(pwd) local |
+${HOME} -eu $(pwd) test then "$1" done echo $(pwd) test $(pwd)
+		sed x=1 test -eu printf awk done cd printf
+	2>/dev/null local printf echo --verbose 'quoted text' done --verbose 2>/dev/null
+		'quoted text' "$1" cd export | -eu then "$1"
+		grep done $(pwd) "$1" ${HOME}
+grep export grep --verbose 'quoted text' readonly
+		$(pwd) export echo 'quoted text' "$1" printf awk 2>/dev/null printf -eu grep | local
+-eu ${HOME} $(pwd) && 'quoted text' -eu done local /usr/bin 'quoted text' done
+		&& awk /usr/bin | local 'quoted text' test
+echo --verbose "$1" then cd test
+	sed $(pwd) test export done -eu test
+echo ${HOME} x=1 awk ${HOME} then x=1 cd x=1 --verbose grep "$1" $(pwd)
+		"$1" 'quoted text' readonly x=1 2>/dev/null 'quoted text'
+		local --verbose readonly
+	local -eu "$@" echo | --verbose echo then cd /usr/bin
+		test echo 2>/dev/null && readonly
+	export -eu cd -eu echo echo ${HOME} test readonly
+	/usr/bin $(pwd) then && 2>/dev/null export 2>/dev/null export test
+--verbose echo echo then done && then awk export sed --verbose
+	then ${HOME} -eu "$@" $(pwd) sed x=1 cd /usr/bin 2>/dev/null then done
+	2>/dev/null 2>/dev/null
+		x=1 'quoted text' local cd -eu |
+		sed /usr/bin then then sed ${HOME}
+&& awk cd cd "$@" done readonly "$@" then awk $(pwd) "$1"
+		'quoted text' export "$1" -eu
+		test readonly | "$@" sed grep done | then done
+		'quoted text' echo "$@" local test ${HOME} --verbose then echo test /usr/bin echo
+echo ${HOME} awk printf --verbose grep
+		$(pwd) "$@" awk echo 'quoted text' ${HOME} test test /usr/bin $(pwd) grep
+		done awk echo echo echo local -eu awk "$1" local grep --verbose
+	local ${HOME} awk -eu grep sed sed "$@" echo
+	$(pwd) && /usr/bin local | done echo local $(pwd) sed $(pwd) x=1 awk
+	/usr/bin test echo done 2>/dev/null printf $(pwd) readonly
+		cd /usr/bin awk local | --verbose --verbose 'quoted text'
+then --verbose /usr/bin test --verbose
+		x=1 test && export -eu grep printf grep 2>/dev/null ${HOME} grep
+		${HOME} "$1" export && echo done sed $(pwd) cd $(pwd) 'quoted text'
+		awk readonly export 'quoted text'
+	echo awk sed done "$@" --verbose 2>/dev/null x=1 "$@" local 'quoted text'
+	awk /usr/bin x=1 grep 2>/dev/null && local && ${HOME} ${HOME} done $(pwd) | "$1"
+	| 2>/dev/null /usr/bin echo readonly x=1 -eu $(pwd)
+printf "$@" | test -eu --verbose local readonly
+		cd ${HOME} then echo printf export /usr/bin | done /usr/bin readonly
+		export $(pwd) done done export printf
+	echo --verbose /usr/bin printf export "$1"
+	test local test printf printf echo local x=1 then test sed "$@" x=1
+	echo grep && echo ${HOME} sed "$1" --verbose
+		printf echo local grep grep x=1 sed --verbose
+x=1 readonly cd awk printf done local | -eu "$@" | -eu $(pwd) export $(pwd)
+	2>/dev/null grep "$1" /usr/bin then sed printf "$@" && $(pwd)
+	local sed 2>/dev/null export
+x=1 test local ${HOME} ${HOME}
+/usr/bin echo /usr/bin printf "$1" /usr/bin test /usr/bin
+	awk 2>/dev/null export $(pwd) cd echo awk ${HOME} printf
+		awk done | $(pwd) done then | "$1" | sed $(pwd)
+export -eu ${HOME} printf then 'quoted text' ${HOME} x=1 printf && test
+		-eu x=1 readonly "$1" local cd "$1" readonly awk export grep readonly
+		awk /usr/bin then | "$@" done --verbose 2>/dev/null
+	&& "$@" -eu "$1" cd printf awk ${HOME} $(pwd) --verbose done 'quoted text' test
+	export --verbose x=1 echo /usr/bin $(pwd) sed "$1" awk /usr/bin sed local readonly
+&& -eu readonly "$1" x=1 2>/dev/null /usr/bin export
+	done test then local
+printf sed cd test && cd 2>/dev/null -eu && 2>/dev/null
+export | "$@" x=1 printf --verbose echo cd done awk "$@" && "$@"
+		done export then cd export | "$1" 'quoted text'
+local 'quoted text' /usr/bin export 2>/dev/null "$1" && export --verbose
+		2>/dev/null "$1" local ${HOME} cd
+		&& cd 'quoted text' readonly
+		local 2>/dev/null 'quoted text'
+		${HOME} cd cd /usr/bin | x=1 /usr/bin
+		local /usr/bin 'quoted text' "$@" && test
+		done awk test ${HOME} 2>/dev/null
+		$(pwd) && echo x=1 -eu done -eu then x=1
+awk done readonly printf 2>/dev/null export 'quoted text'
+test printf $(pwd) awk $(pwd) /usr/bin x=1 awk cd && local awk readonly
+	awk | test "$@" x=1 done local /usr/bin grep && "$@" sed "$1" export
+	cd test "$1" test && awk export ${HOME} sed done && export
+		--verbose "$1" local done "$@"
+| sed -eu sed done 2>/dev/null
+then done "$@" "$@" /usr/bin
+grep ${HOME} cd x=1 x=1 readonly then export readonly grep
+		test 'quoted text' 'quoted text' "$1" export done ${HOME} 'quoted text'
+		$(pwd) then /usr/bin 2>/dev/null ${HOME} /usr/bin local | 2>/dev/null /usr/bin
+		-eu ${HOME} then grep --verbose cd readonly ${HOME} printf local --verbose then
+/usr/bin awk "$@" 2>/dev/null sed sed
+		test $(pwd) grep 'quoted text' done | && done -eu "$1" x=1 --verbose "$@"
+	cd echo $(pwd) "$1" 'quoted text' sed --verbose && readonly
+	| --verbose sed then cd awk x=1 local 2>/dev/null /usr/bin $(pwd) /usr/bin
+printf && 2>/dev/null readonly x=1 2>/dev/null grep ${HOME} 'quoted text' 2>/dev/null
+	/usr/bin printf awk $(pwd) readonly ${HOME} grep "$@"
+sed then /usr/bin /usr/bin x=1 grep -eu 2>/dev/null awk 'quoted text' | && local
+printf grep then done readonly sed 2>/dev/null 'quoted text' $(pwd) -eu then
+grep sed /usr/bin awk "$1"
+--verbose && --verbose ${HOME} then then echo "$1" && export then |
+then 'quoted text' local x=1 | /usr/bin -eu export
+local printf export export printf sed cd done sed readonly
+	'quoted text' "$@" "$1"
+		'quoted text' && cd cd local printf test
+readonly x=1 && then local done $(pwd) export
+--verbose awk "$@" cd echo /usr/bin
+then | --verbose test grep && readonly export "$@" cd
+	test local /usr/bin "$@" && printf then then grep echo -eu
+		cd | && cd grep "$1" sed local printf then && export awk --verbose
+		2>/dev/null readonly "$1" $(pwd) readonly
+		"$1" then -eu --verbose cd 'quoted text'
+		readonly printf $(pwd) local printf
+		"$1" 'quoted text' && && done --verbose
+	'quoted text' "$@" grep | --verbose
+		test && "$1" x=1 local --verbose "$@" printf awk --verbose
+/usr/bin printf readonly echo readonly cd then export 'quoted text' echo sed
+	export /usr/bin awk x=1 awk grep | sed
+		--verbose done 'quoted text' done cd test $(pwd) /usr/bin export "$@"
+	awk && local --verbose ${HOME}
+		/usr/bin -eu awk done cd readonly cd grep echo | /usr/bin
+		local ${HOME} -eu echo then ${HOME} $(pwd) x=1 -eu 2>/dev/null 2>/dev/null ${HOME}
+		x=1 'quoted text' "$1"
+$(pwd) $(pwd) readonly /usr/bin --verbose 2>/dev/null sed local echo -eu $(pwd)
+"$1" test "$1" done echo $(pwd) then
+2>/dev/null && /usr/bin awk x=1 sed
+&& done cd sed test $(pwd) "$1" && then
+then readonly x=1 readonly
+printf x=1 sed echo export "$@" $(pwd) /usr/bin $(pwd)
+done echo "$1" $(pwd) awk $(pwd) 2>/dev/null ${HOME} "$@" local grep readonly
+		readonly "$1" echo readonly awk awk --verbose /usr/bin
+		cd grep && local ${HOME} x=1 grep sed "$@" echo && $(pwd) test /usr/bin
+	&& ${HOME} -eu sed | x=1 /usr/bin awk | $(pwd) "$1" echo && "$@"
+echo echo grep echo && test -eu sed
+/usr/bin printf done then cd ${HOME} x=1 cd then echo
+		printf readonly cd export cd local --verbose awk sed awk then
+	cd 'quoted text' x=1 | echo --verbose echo /usr/bin --verbose
+		-eu --verbose --verbose readonly sed --verbose then 'quoted text' printf 2>/dev/null
+-eu $(pwd) done && 2>/dev/null -eu 'quoted text' && done local
+	"$1" echo test ${HOME} local grep x=1 cd cd echo awk
+		"$@" test 2>/dev/null x=1 then 'quoted text' -eu local
+&& 2>/dev/null local "$1" test awk readonly
+	export sed 'quoted text' awk printf cd awk awk | "$1" done
+		readonly --verbose then echo cd && --verbose
+	printf then awk 2>/dev/null
+	--verbose --verbose echo "$@" awk "$@" sed printf ${HOME} /usr/bin
+"$@" 2>/dev/null export ${HOME} x=1 printf
+--verbose /usr/bin echo "$1"
+cd -eu export awk local
+	grep readonly -eu echo "$1" grep
+	cd "$@" awk x=1 | -eu local sed $(pwd) export grep
+	test 'quoted text' export sed printf cd export x=1 printf x=1 | 'quoted text'
+		${HOME} "$@" printf export local "$@" $(pwd) readonly local ${HOME} grep 2>/dev/null
+	| 2>/dev/null then test
+test readonly /usr/bin /usr/bin ${HOME} grep
+cd x=1 test readonly cd "$1" && done awk $(pwd)
+-eu readonly then local -eu "$@" local ${HOME} sed x=1
+		readonly 2>/dev/null -eu "$@"
+"$1" --verbose sed cd /usr/bin local local echo then
+done ${HOME} readonly $(pwd) $(pwd) sed export echo
+echo awk awk test sed 2>/dev/null
+	-eu x=1 ${HOME} $(pwd) grep then
+		--verbose x=1 local 2>/dev/null awk export
+sed done cd $(pwd) sed x=1 local --verbose -eu awk test 'quoted text' readonly
+2>/dev/null readonly printf readonly
+	'quoted text' "$1" /usr/bin ${HOME} test ${HOME} echo printf cd --verbose readonly
+	grep echo printf | done readonly $(pwd) "$@"
+	awk 2>/dev/null "$1" --verbose sed cd $(pwd) done -eu test 'quoted text'
+	x=1 "$1" "$1" "$1" --verbose | ${HOME} cd /usr/bin $(pwd) done printf grep
+then "$1" sed export sed
+		grep x=1 ${HOME} x=1 done && x=1 then x=1 local "$1" 2>/dev/null | then "$@" local
+2>/dev/null cd cd $(pwd)
+		"$1" /usr/bin readonly "$@" -eu awk export done printf
+echo echo --verbose $(pwd) | grep 2>/dev/null
+${HOME} grep --verbose printf 'quoted text' x=1 readonly export
+x=1 readonly sed readonly | sed $(pwd) done then | done printf 2>/dev/null
+		'quoted text' cd sed sed "$@" "$@" /usr/bin echo
+		printf sed then "$@" x=1 && readonly awk 2>/dev/null
+	"$1" then readonly printf done 'quoted text' $(pwd) "$@" x=1 "$@" --verbose
+	"$@" 'quoted text' "$1" cd
+	awk -eu done "$1" local test grep "$1"
+	readonly 'quoted text' local --verbose echo "$@" -eu x=1 x=1 "$1" -eu 'quoted text'
+printf awk test "$1" then | sed "$1" && ${HOME} | $(pwd)
+		export awk export "$@" sed then -eu sed -eu awk ${HOME} grep then cd
+cd --verbose --verbose then sed done
+echo --verbose test local local 2>/dev/null local
+&& | x=1 "$1" echo echo sed local cd printf test --verbose -eu done cd "$@"
+		awk "$1" local "$@" "$1" && readonly
+		"$@" export done readonly
+export ${HOME} 2>/dev/null export x=1 "$1" "$1" cd ${HOME} then export
+		test && grep awk "$@" $(pwd)
+grep --verbose "$@" printf x=1 &&
+	x=1 ${HOME} echo /usr/bin -eu sed done ${HOME}
+	2>/dev/null printf done readonly
+		2>/dev/null grep done then -eu awk sed && sed sed --verbose ${HOME} x=1 done
+	printf | cd readonly x=1 'quoted text' sed test $(pwd) test readonly
+		| && local test 2>/dev/null "$@" sed "$1" -eu sed --verbose grep --verbose
+		then printf readonly readonly
+echo "$@" export -eu ${HOME}
+	--verbose export echo "$@" readonly -eu awk -eu 2>/dev/null x=1
+	${HOME} test test $(pwd) 2>/dev/null readonly ${HOME} sed
+-eu && then | readonly sed cd 'quoted text' local ${HOME} --verbose sed readonly
+/usr/bin 2>/dev/null then x=1 | sed /usr/bin
+	'quoted text' "$@" | test
+	${HOME} cd awk printf && "$@"
+awk ${HOME} ${HOME} sed local $(pwd)
+	$(pwd) x=1 then done && "$@" -eu local done awk echo grep ${HOME}
+echo 'quoted text' then
+		readonly x=1 done readonly x=1 echo
+$(pwd) -eu then | ${HOME} --verbose awk test
+	'quoted text' -eu local -eu printf && echo x=1 'quoted text' $(pwd) /usr/bin
+export done awk grep | $(pwd) 2>/dev/null export /usr/bin
+	/usr/bin | -eu echo $(pwd) "$1" --verbose --verbose
+		then local 'quoted text' -eu
+awk ${HOME} ${HOME} local printf x=1 done grep
+	cd "$@" done echo cd /usr/bin $(pwd)
+		${HOME} "$1" "$1" cd 2>/dev/null "$1" | | done 'quoted text' awk 'quoted text'
+	done 2>/dev/null && 2>/dev/null readonly 2>/dev/null ${HOME} local && "$@"
+		cd grep local done x=1 "$@" then readonly grep 'quoted text'
+		x=1 awk test done export then
+/usr/bin "$@" "$1" then $(pwd) then local "$1" echo
+	export printf readonly x=1 awk ${HOME} -eu
+	printf $(pwd) "$1" 2>/dev/null $(pwd) | cd sed grep $(pwd) && -eu | cd
+		| grep --verbose && echo printf "$1" done 2>/dev/null
+	readonly cd | --verbose then | 'quoted text' printf
+	sed 2>/dev/null sed 2>/dev/null | ${HOME} sed
+	| && test 'quoted text' test x=1 grep then grep cd
+-eu x=1 echo then sed x=1 grep "$@" awk | --verbose ${HOME} 2>/dev/null
+		test export awk then $(pwd) "$1" awk awk 'quoted text'
+"$@" printf x=1 cd echo && x=1
+-eu ${HOME} 'quoted text' "$@" ${HOME}
+		-eu awk cd $(pwd) -eu cd test printf cd echo export "$@" && done echo | |
+-eu "$1" 'quoted text' readonly /usr/bin
+	/usr/bin && readonly -eu x=1 --verbose && "$1"
+		2>/dev/null grep $(pwd) readonly export $(pwd) "$@" printf grep then
+sed local | sed echo "$1"
+		then sed echo local echo /usr/bin echo $(pwd) echo local
+	/usr/bin | 2>/dev/null test && 2>/dev/null test x=1
+"$@" --verbose cd "$1" | 2>/dev/null echo test && 2>/dev/null awk 'quoted text'
+	test "$1" local grep sed
+		| test awk readonly | awk ${HOME} x=1 ${HOME} x=1 then | grep -eu done -eu
+$(pwd) then test && echo export x=1 --verbose local
+	2>/dev/null "$1" echo "$1" then --verbose && -eu echo cd /usr/bin
+		awk readonly test /usr/bin -eu sed grep
+	awk cd printf $(pwd) && $(pwd) awk grep x=1 done local printf grep
+		"$1" sed "$@" "$1" /usr/bin 2>/dev/null
+	done 'quoted text' export echo
+		$(pwd) export ${HOME} local echo printf local export | && 2>/dev/null cd x=1
+	grep 'quoted text' awk -eu export | printf echo 2>/dev/null
+		&& "$1" export cd 'quoted text' done local test test 2>/dev/null
+&& export awk | 'quoted text' ${HOME} /usr/bin done --verbose
+		readonly test 2>/dev/null | cd -eu grep && export cd done
+sed 'quoted text' && then readonly 'quoted text' cd "$@" $(pwd) "$@"
+	readonly echo then 2>/dev/null | echo printf
+		awk | done local --verbose done export cd x=1 grep awk | 2>/dev/null export
+		$(pwd) export x=1 x=1 "$@" "$@" printf
+		export | "$1" $(pwd) printf "$@" "$@" "$1" readonly
+		export -eu then x=1 | grep 'quoted text' cd sed local sed sed test
+		then test && /usr/bin test && --verbose export printf $(pwd) echo sed -eu local
+	test 2>/dev/null cd -eu 2>/dev/null export
+	x=1 grep "$@" test x=1 then 2>/dev/null -eu && 2>/dev/null /usr/bin local printf
+	--verbose | echo cd done x=1 awk sed --verbose grep -eu
+		local x=1 -eu cd sed -eu grep awk done x=1 'quoted text'
+2>/dev/null sed 'quoted text' x=1 echo x=1 "$@" x=1 "$1" then grep grep readonly
+printf test cd "$@" "$@" echo
+		local awk cd grep 'quoted text' cd $(pwd)
+	/usr/bin grep --verbose -eu x=1 cd ${HOME} --verbose --verbose
+	| cd ${HOME} readonly export 'quoted text' awk
+	export x=1 | done readonly awk awk sed "$@" export export done | &&
+		awk test awk $(pwd) then "$1" export /usr/bin printf sed awk -eu x=1 /usr/bin
+		done done sed "$1" x=1 sed done
+		awk ${HOME} $(pwd) --verbose --verbose
+		local $(pwd) printf test /usr/bin && printf && x=1 x=1 "$@" |
+	&& grep 2>/dev/null 2>/dev/null
+${HOME} "$@" test x=1 export x=1 ${HOME} | -eu
+"$1" 2>/dev/null echo 2>/dev/null $(pwd) done done test 2>/dev/null
+		echo test printf $(pwd) "$1" -eu &&
+	-eu readonly ${HOME} local test printf
+		x=1 2>/dev/null then "$1" local && cd done ${HOME} 2>/dev/null 2>/dev/null
+	echo cd echo test $(pwd) test x=1
+	printf /usr/bin then 2>/dev/null "$@" cd
+export "$@" x=1 cd && awk "$@" then "$@"
+x=1 test --verbose -eu local then && grep | -eu export grep readonly
+	${HOME} ${HOME} "$@" x=1 grep echo --verbose ${HOME} $(pwd)
+		then echo done x=1 x=1 awk "$1" printf
+&& ${HOME} --verbose awk
+	cd done grep test awk printf done awk then sed
+	echo done local 2>/dev/null --verbose export x=1 "$@" then grep "$@" sed $(pwd)
+| x=1 ${HOME} $(pwd) --verbose x=1 local
+	echo "$@" ${HOME} -eu awk
+		| echo cd x=1 grep x=1 -eu printf /usr/bin
+"$@" test --verbose x=1 "$1" then awk 'quoted text' /usr/bin
+'quoted text' /usr/bin 'quoted text'
+		awk export && readonly grep | test "$1" "$1" echo cd
+	grep cd && local -eu --verbose printf $(pwd) --verbose
+printf awk sed "$1" /usr/bin
+&& then printf x=1 export awk awk grep local "$@" done done
+		${HOME} ${HOME} grep readonly --verbose
+	x=1 "$@" sed readonly 2>/dev/null
+	-eu "$@" echo echo test test printf sed then
+cd && && && x=1 echo test printf awk ${HOME} local export
+'quoted text' "$1" 'quoted text' sed export
+		$(pwd) ${HOME} $(pwd) $(pwd) grep --verbose $(pwd) "$@"
+	grep sed /usr/bin cd readonly local && x=1 cd $(pwd) "$@" grep awk 2>/dev/null
+		grep 2>/dev/null readonly /usr/bin cd echo -eu test
+	${HOME} local && && x=1 done readonly export x=1 cd x=1 --verbose 'quoted text'
+export 2>/dev/null local test $(pwd) x=1 "$1" 'quoted text' /usr/bin
+	&& -eu x=1 x=1 ${HOME} printf
+		/usr/bin --verbose && cd done "$1"
+		| x=1 ${HOME} "$@" echo 2>/dev/null "$@" then "$@" ${HOME} cd local local
+		| 'quoted text' 2>/dev/null local 2>/dev/null
+	--verbose awk "$1" ${HOME} 2>/dev/null sed export "$1" local
+	then 'quoted text' awk x=1 grep "$1" echo 2>/dev/null awk /usr/bin -eu ${HOME}
+"$1" -eu done awk "$@" 2>/dev/null export
+	${HOME} "$@" then echo ${HOME} --verbose test readonly
+		| 'quoted text' then readonly
+	local grep grep then 2>/dev/null echo | printf awk /usr/bin 'quoted text'
+	sed export sed 2>/dev/null export
+	-eu export && then cd then test --verbose printf --verbose awk done grep && sed
+		then | sed ${HOME} "$1" then local /usr/bin echo "$@" && 'quoted text' test
+-eu /usr/bin echo -eu 'quoted text' cd "$1"
+	"$1" echo test cd cd "$1" local ${HOME} /usr/bin
+	--verbose readonly -eu "$@"
+		local done done -eu "$@"
+test export printf awk x=1 printf grep "$@" then --verbose
+	"$1" echo | echo sed --verbose "$1" ${HOME} "$@"
+		readonly -eu then readonly grep x=1
+	cd "$@" $(pwd) "$1" 'quoted text' sed local awk && grep
+then grep printf then test export | /usr/bin 2>/dev/null -eu $(pwd) cd
+		'quoted text' echo /usr/bin --verbose cd printf
+x=1 -eu $(pwd) local "$1" grep sed --verbose sed /usr/bin ${HOME} awk cd awk
+		"$@" echo test done export $(pwd) test && "$@" grep
+		echo test local ${HOME} $(pwd) cd && "$1" 2>/dev/null ${HOME}
+printf "$1" 2>/dev/null sed --verbose ${HOME} "$1" ${HOME} grep 'quoted text'
+		&& 2>/dev/null readonly | && awk test $(pwd) --verbose
+		x=1 | grep ${HOME} --verbose -eu /usr/bin export sed
+test export 2>/dev/null x=1 $(pwd) $(pwd) then cd test ${HOME} --verbose
+'quoted text' local 2>/dev/null cd test && grep
+	done "$1" $(pwd) "$@" export then --verbose $(pwd)
+"$@" done grep /usr/bin then --verbose then /usr/bin
+export | then echo readonly test 'quoted text' && "$@"
+	sed | -eu /usr/bin && cd echo 'quoted text' 2>/dev/null
+cd awk cd done $(pwd) $(pwd) x=1
+		| then printf cd echo /usr/bin done "$@" cd x=1 sed done local "$1" cd "$1"
+echo -eu export 2>/dev/null "$1" | ${HOME} "$@" --verbose test
+	--verbose --verbose local
+-eu "$@" --verbose readonly "$@" --verbose awk
+x=1 printf $(pwd) ${HOME} sed "$@" awk -eu 'quoted text'
+	local sed readonly --verbose
+echo printf grep echo $(pwd) done ${HOME} x=1 $(pwd)
+		awk /usr/bin echo printf grep 'quoted text' "$1"
+		cd done sed | -eu "$@" | test grep sed printf printf
+grep test awk && printf sed "$@" x=1 x=1 then && --verbose test $(pwd) 'quoted text'
+awk --verbose 2>/dev/null -eu "$1" 2>/dev/null -eu local
+	"$1" "$1" | then "$1" "$@" && $(pwd) echo /usr/bin echo 'quoted text'
+	"$@" then grep "$1" && x=1 done "$1" printf test 'quoted text'
+'quoted text' 'quoted text' grep
+		/usr/bin export $(pwd)
+	export readonly /usr/bin | -eu 'quoted text' x=1 local cd export
+2>/dev/null ${HOME} && local "$1"
+	export ${HOME} grep "$1" ${HOME} -eu
+		x=1 grep && printf sed /usr/bin ${HOME} -eu sed 2>/dev/null
+&& | echo $(pwd) /usr/bin test cd export echo -eu -eu 2>/dev/null
+'quoted text' -eu --verbose /usr/bin "$@" | /usr/bin grep awk
+	"$1" grep sed export cd test && printf | test $(pwd) done /usr/bin | -eu -eu
+		export echo done then readonly test | export | test printf then "$@" awk
+		"$1" test /usr/bin test x=1 export
+grep then awk /usr/bin /usr/bin /usr/bin done then test "$@" done ${HOME}
+	grep --verbose "$@" test awk cd cd x=1 && | cd x=1 grep
+		-eu readonly readonly done cd then
+	$(pwd) grep then test | awk && sed $(pwd) grep grep local sed | test /usr/bin awk
+	| $(pwd) cd -eu ${HOME} sed readonly awk -eu
+	x=1 x=1 | grep readonly | grep x=1 cd echo
+		awk cd printf readonly $(pwd) printf && "$@" /usr/bin echo
+	cd sed && sed /usr/bin local | test cd --verbose 'quoted text' awk
+awk grep sed /usr/bin /usr/bin | sed && 'quoted text' then && grep
+	-eu 2>/dev/null cd then "$@" x=1 x=1 local $(pwd)
+		done /usr/bin echo cd cd x=1 readonly
+	printf "$@" /usr/bin 'quoted text' --verbose -eu printf
+cd "$@" done /usr/bin printf 2>/dev/null x=1
+--verbose | ${HOME} "$1" printf /usr/bin | test echo --verbose echo then test
+	$(pwd) cd 2>/dev/null "$1" ${HOME} awk /usr/bin ${HOME} "$1" |
+	&& local -eu printf "$1" awk 'quoted text'
+2>/dev/null x=1 $(pwd) "$@" grep local then grep "$1"
+echo awk awk then awk local done local --verbose 'quoted text' -eu 2>/dev/null
+	| /usr/bin 'quoted text' ${HOME} x=1 && /usr/bin awk cd && &&
+		x=1 'quoted text' "$@" 2>/dev/null "$1" | printf
+	$(pwd) --verbose printf --verbose 2>/dev/null && then then echo printf
+		grep export awk grep export ${HOME} sed done /usr/bin
+&& $(pwd) -eu 'quoted text' /usr/bin
+		sed readonly ${HOME}
+	export ${HOME} "$1" "$1"
+	done then echo "$@" cd -eu cd && done && readonly sed done local x=1 then
+test ${HOME} --verbose
+		--verbose 2>/dev/null -eu x=1 ${HOME} 'quoted text' awk 2>/dev/null
+		readonly readonly test echo --verbose test sed && "$@" cd export $(pwd) sed | --verbose
+grep -eu cd x=1 done test -eu && $(pwd)
+		x=1 $(pwd) local /usr/bin -eu readonly "$1"
+	grep grep readonly readonly sed $(pwd) 'quoted text' --verbose --verbose sed
+	x=1 $(pwd) --verbose -eu "$1" "$1"
+printf printf then x=1 then --verbose "$@" 2>/dev/null awk printf export
+echo ${HOME} grep echo && ${HOME} --verbose
+	"$@" awk readonly readonly
+		"$1" echo "$@" cd cd "$@" awk $(pwd) export | printf 'quoted text' /usr/bin printf
+	${HOME} x=1 "$@" x=1 /usr/bin
+/usr/bin awk local echo --verbose 2>/dev/null && ${HOME} -eu ${HOME}
+	then printf x=1 readonly cd grep test | readonly x=1 readonly /usr/bin -eu "$@"
+	echo "$1" 'quoted text' 'quoted text' grep
+sed local "$1" test x=1
+	then 'quoted text' local /usr/bin "$1" x=1 printf "$1" readonly sed
+		sed awk done export /usr/bin "$@" ${HOME} readonly | sed
+cd "$1" --verbose grep sed ${HOME} echo test echo export
+		"$@" done export echo ${HOME} readonly
+		test printf local awk sed ${HOME} test $(pwd) done | ${HOME}
+		--verbose /usr/bin sed awk sed sed -eu x=1 /usr/bin
+		2>/dev/null /usr/bin cd x=1 --verbose
+$(pwd) export export -eu 'quoted text' /usr/bin grep 'quoted text'
+		-eu --verbose cd 2>/dev/null 'quoted text'
+readonly --verbose /usr/bin 'quoted text' printf
+"$@" "$@" echo "$@" test test done 2>/dev/null cd 2>/dev/null
+	"$@" | && local ${HOME} $(pwd) "$@" readonly
+echo -eu -eu ${HOME} then "$@" test "$1" -eu ${HOME} test test "$@"
+		local "$@" && local -eu done && cd x=1 ${HOME} echo /usr/bin
+&& echo printf printf echo then -eu grep "$1" readonly then local -eu grep &&
+		$(pwd) x=1 local x=1 test echo printf test x=1 echo -eu sed && --verbose sed --verbose
+		grep cd && "$1" 'quoted text'
+	x=1 local echo cd cd --verbose -eu printf awk printf echo x=1 sed $(pwd)
+sed then 2>/dev/null 2>/dev/null "$@" 'quoted text'
+		local cd done 'quoted text' done echo
+	| local cd -eu 'quoted text' done echo /usr/bin test
+/usr/bin readonly && && readonly readonly 'quoted text' "$@" printf 2>/dev/null
+		/usr/bin && then && grep "$1" /usr/bin local --verbose
+/usr/bin then local $(pwd) local
+$(pwd) grep "$@" "$@" awk echo readonly awk local x=1 'quoted text' x=1 --verbose
+'quoted text' cd ${HOME} echo --verbose grep local test 'quoted text' --verbose
+	${HOME} | | 'quoted text'
+	export then 'quoted text'
+		awk printf "$1" printf $(pwd) sed awk | sed 2>/dev/null awk --verbose
+		test "$1" then awk && grep x=1 "$1" echo done 2>/dev/null
+&& 2>/dev/null && "$@" echo 'quoted text'
+		-eu && printf ${HOME}
+		readonly --verbose --verbose -eu ${HOME} awk $(pwd) readonly cd /usr/bin | | "$1"
+-eu done x=1 "$@" echo then local local
+		| -eu test 2>/dev/null cd grep "$1" printf x=1 printf
+	$(pwd) grep export && sed ${HOME} printf -eu ${HOME} export
+| --verbose then "$1" "$1" 'quoted text' export -eu echo local awk |
+	local "$1" export x=1 $(pwd) "$1" "$@" "$@" --verbose test "$1" echo printf "$1"
+		-eu awk echo 2>/dev/null ${HOME} -eu 2>/dev/null
+		'quoted text' done --verbose ${HOME} | x=1 2>/dev/null done
+| local $(pwd) 'quoted text' readonly export $(pwd) grep "$@" --verbose then
+		sed | echo 'quoted text' done --verbose local
+	local ${HOME} $(pwd) x=1 "$@" then echo 2>/dev/null | then
+		x=1 2>/dev/null printf x=1 test local
+		'quoted text' /usr/bin x=1 $(pwd) printf cd test awk -eu done
+	cd local | x=1 done /usr/bin readonly echo /usr/bin --verbose "$@" test --verbose
+&& "$@" $(pwd) then done done printf -eu --verbose awk awk
+export cd grep --verbose ${HOME} local
+	printf awk cd then printf export readonly x=1 --verbose awk "$1" "$@"
+		"$@" echo grep 2>/dev/null && grep /usr/bin readonly ${HOME} $(pwd) cd
+	echo echo 2>/dev/null -eu readonly readonly "$@" export ${HOME}
+#include c114.sh
+'quoted text' printf | test
+		cd "$@" readonly x=1 test awk test sed cd /usr/bin local
+		sed export awk awk export done "$1" 'quoted text' &&
+		grep && grep sed readonly echo awk -eu | readonly printf -eu 2>/dev/null
+		"$@" "$@" | grep ${HOME} sed echo export readonly
+		local x=1 "$@" local echo printf -eu |
+		local "$1" grep x=1 ${HOME} echo ${HOME} echo printf sed then --verbose
+		--verbose && && printf 2>/dev/null
+		x=1 cd export printf echo sed done grep readonly
+		"$@" then export awk && --verbose | 2>/dev/null -eu -eu
+then 2>/dev/null "$@" readonly then && /usr/bin
+		'quoted text' x=1 /usr/bin readonly printf test
+then && x=1 ${HOME} awk | export awk "$1" $(pwd) readonly
+		x=1 ${HOME} printf && cd | "$1" done -eu cd 'quoted text' local x=1
+		printf export then --verbose
+	echo then test "$@" awk "$@" --verbose 'quoted text'
+	readonly local sed echo then -eu printf
+cd $(pwd) local | /usr/bin echo sed then | "$1" 2>/dev/null
+/usr/bin sed 'quoted text' printf
+	done "$@" 'quoted text' && ${HOME} echo /usr/bin
+awk echo /usr/bin ${HOME} ${HOME}
+	test awk then "$@" x=1 2>/dev/null x=1 'quoted text' ${HOME} then sed "$1" export
+local awk x=1 export 2>/dev/null | then sed /usr/bin
+		local 'quoted text' printf 'quoted text'
+	$(pwd) 'quoted text' 2>/dev/null done done
+	readonly ${HOME} echo 2>/dev/null $(pwd) then printf
+		'quoted text' cd 2>/dev/null x=1 /usr/bin cd grep && -eu
+	"$@" echo 2>/dev/null then &&
+sed grep export ${HOME} 2>/dev/null $(pwd) export echo
+		awk 'quoted text' ${HOME} test
+		--verbose x=1 local $(pwd) export $(pwd) -eu | ${HOME}
+cd x=1 && readonly --verbose
+		--verbose export test echo cd awk | 'quoted text'
+		then awk x=1 | cd cd "$1" printf 'quoted text'
+		'quoted text' test echo "$1" | local ${HOME} printf -eu /usr/bin 2>/dev/null ${HOME}
+	2>/dev/null printf test --verbose
+	x=1 2>/dev/null "$1" local "$@" cd -eu cd 2>/dev/null
+		sed awk --verbose then 2>/dev/null | echo test cd test grep "$@" grep -eu awk -eu
+	local ${HOME} echo then | awk | ${HOME} "$@" | $(pwd) | local -eu "$@"
+		local local grep 'quoted text' echo local awk printf
+$(pwd) then "$1" -eu $(pwd) "$1" /usr/bin -eu
+&& then sed /usr/bin --verbose echo
+/usr/bin done readonly 2>/dev/null readonly
+${HOME} && echo /usr/bin /usr/bin && x=1
+	$(pwd) --verbose then awk $(pwd) readonly && "$1" export test
+	'quoted text' $(pwd) && $(pwd) echo -eu && export --verbose --verbose | $(pwd)
+	then done --verbose ${HOME} done
+		sed 'quoted text' x=1 sed
+	awk echo done 'quoted text' "$1" /usr/bin grep awk
+		"$1" local awk then 'quoted text' local cd then | 'quoted text' local test
+sed export $(pwd) $(pwd) export then "$1" | x=1 test "$1" export readonly x=1
+		echo printf export done "$1" awk /usr/bin
+		${HOME} --verbose cd 'quoted text'
+		&& echo ${HOME} 2>/dev/null -eu printf test awk sed 'quoted text' --verbose
+readonly export --verbose /usr/bin awk ${HOME} -eu && sed printf local
+		then test then cd && readonly /usr/bin && export --verbose done --verbose -eu
+/usr/bin test "$@" export $(pwd) "$1" local readonly export $(pwd)
+x=1 --verbose sed ${HOME} 'quoted text'
+	/usr/bin local 'quoted text' x=1 | /usr/bin
+"$1" 2>/dev/null /usr/bin grep cd awk grep sed
+	-eu 'quoted text' awk local sed -eu local
+	echo awk -eu "$@" "$1" /usr/bin
+awk /usr/bin export "$@" readonly
+	"$1" printf cd test x=1 sed then -eu cd x=1 printf
+	$(pwd) /usr/bin awk /usr/bin
+		/usr/bin /usr/bin 'quoted text' cd "$1"
+	export done sed local && grep
+| --verbose printf 2>/dev/null echo
+	export 2>/dev/null then 'quoted text' | $(pwd)
+/usr/bin 2>/dev/null ${HOME}
+		done sed -eu cd /usr/bin local "$@" -eu local readonly "$1" sed then /usr/bin
+"$@" /usr/bin "$1" -eu done printf | done && printf 2>/dev/null "$@" done
+	cd sed local export -eu grep awk export | cd echo /usr/bin 2>/dev/null
+		sed cd -eu cd 2>/dev/null 'quoted text'
+		echo -eu awk ${HOME} local ${HOME} printf /usr/bin "$@"
+		readonly sed ${HOME} then x=1 -eu -eu printf --verbose then echo then "$@"
+	then ${HOME} sed ${HOME}
+	local echo --verbose sed echo $(pwd) cd $(pwd) --verbose echo
+	--verbose -eu ${HOME} | grep
+		readonly /usr/bin grep done
+	| test $(pwd) cd /usr/bin x=1 then grep ${HOME} $(pwd) echo
+	"$1" done --verbose x=1 ${HOME} "$1" local readonly
+	x=1 --verbose "$1" $(pwd) readonly
+	2>/dev/null export export
+	then cd $(pwd) -eu local grep ${HOME} echo readonly
+	$(pwd) "$@" x=1 printf
+		readonly ${HOME} readonly then sed local $(pwd) --verbose test | 2>/dev/null then
+${HOME} local then ${HOME} 2>/dev/null export -eu
+	echo | sed done x=1 "$@" ${HOME} awk /usr/bin -eu readonly awk
+		export grep sed ${HOME} sed $(pwd)
+local "$1" | export && test sed -eu &&
+	"$1" 'quoted text' ${HOME} cd test awk -eu x=1 --verbose -eu readonly -eu
+		export export readonly sed --verbose
+		'quoted text' $(pwd) done $(pwd) 2>/dev/null echo
+		"$1" done export && export x=1 &&
+printf local -eu 'quoted text' export "$@" -eu "$1"
+	&& /usr/bin then -eu /usr/bin printf ${HOME} local --verbose | export
+	grep sed printf echo grep | --verbose echo
+	test x=1 test grep $(pwd) "$1" export -eu
+/usr/bin ${HOME} local sed awk then
+${HOME} local cd readonly |
+		"$1" && done x=1 && 'quoted text' test x=1 export sed ${HOME} done
+&& | x=1 then 2>/dev/null cd -eu x=1 printf $(pwd) ${HOME} x=1 then
+	readonly -eu -eu -eu awk printf "$1" x=1 printf -eu | printf /usr/bin awk
+-eu export awk && echo readonly sed && awk 2>/dev/null
+	readonly 'quoted text' | "$@" -eu "$@" "$@" export test ${HOME}
+	/usr/bin sed export | --verbose --verbose "$@" then
+	${HOME} awk local ${HOME} export printf then done | test cd done 'quoted text'
+	then echo then -eu echo ${HOME}
+x=1 -eu x=1 test cd --verbose "$@" done cd export test ${HOME} "$@"
+"$1" grep awk then sed | printf echo --verbose
+/usr/bin -eu readonly cd done x=1 x=1 grep
+		then grep | 'quoted text'
+	readonly sed then local "$1" /usr/bin test /usr/bin printf cd -eu local x=1
+		$(pwd) x=1 -eu 2>/dev/null ${HOME}
+	-eu export echo readonly 2>/dev/null 2>/dev/null
+	test then --verbose 2>/dev/null local --verbose
+		| sed 'quoted text' "$1" "$1" test export
+		'quoted text' 'quoted text' --verbose local -eu /usr/bin $(pwd) cd then 'quoted text'
+		readonly $(pwd) -eu x=1 sed export echo ${HOME} 2>/dev/null
+printf then --verbose "$@" sed && cd grep
+2>/dev/null $(pwd) && x=1 x=1 /usr/bin -eu then
+"$1" printf printf $(pwd) awk "$1" --verbose -eu
+	'quoted text' --verbose | echo $(pwd)
+	--verbose done -eu grep printf test && | cd cd cd $(pwd) | then awk /usr/bin then
+x=1 sed export $(pwd) done /usr/bin "$@"
+	done echo test sed done sed "$1" $(pwd)
+	test export $(pwd) /usr/bin sed
+&& 2>/dev/null --verbose sed local awk && 2>/dev/null 'quoted text'
+-eu "$@" x=1 && /usr/bin
+"$1" 2>/dev/null test sed
+	"$@" 'quoted text' printf
+x=1 sed x=1 x=1 sed 2>/dev/null --verbose $(pwd) test $(pwd) printf
+		then local grep /usr/bin /usr/bin "$@" -eu --verbose export then
+		test local $(pwd) && test done --verbose ${HOME} "$1" printf "$1" echo --verbose
+	2>/dev/null echo sed printf ${HOME} echo then grep &&
+	sed done local export grep sed -eu
+"$@" readonly awk "$@" "$1" && sed $(pwd) 'quoted text'
+		cd readonly awk cd echo local $(pwd) x=1
+awk sed printf test 'quoted text' "$1" -eu
+$(pwd) 2>/dev/null x=1 readonly $(pwd) 2>/dev/null then | readonly test -eu $(pwd)
+		then $(pwd) -eu grep then $(pwd)
+	"$1" | 'quoted text' local readonly
+grep readonly readonly cd awk /usr/bin "$1" "$1" then --verbose /usr/bin awk
+	local 'quoted text' local export --verbose cd -eu
+| printf echo awk grep grep local
+	| x=1 local /usr/bin local | awk local && "$@" $(pwd)
+	'quoted text' "$1" readonly done test awk
+		grep $(pwd) then | cd done local done readonly $(pwd)
+	sed export -eu | grep ${HOME} && 'quoted text'
+export 'quoted text' grep test readonly
+	echo ${HOME} export readonly grep 2>/dev/null && awk 'quoted text'
+grep /usr/bin test cd x=1 ${HOME} sed then $(pwd) done cd sed awk printf grep
+		then "$1" "$1" cd done sed grep "$@" grep /usr/bin echo
+x=1 && -eu && export sed
+	readonly && readonly sed /usr/bin 'quoted text' --verbose /usr/bin sed
+	readonly /usr/bin x=1 && /usr/bin done printf test local echo "$1" readonly printf
+readonly cd "$1" --verbose test cd local
+done local x=1 local | echo "$@" $(pwd)
+awk grep --verbose $(pwd) test -eu "$@" readonly "$1" readonly
+		grep ${HOME} grep --verbose sed local local "$1"
+--verbose printf readonly awk sed ${HOME} awk echo awk test cd --verbose
+		cd printf printf done grep grep "$1" --verbose ${HOME} test cd -eu /usr/bin
+		local --verbose printf readonly $(pwd) x=1 --verbose | printf 'quoted text'
+		done /usr/bin then ${HOME} export $(pwd) && 'quoted text' readonly test | x=1 x=1
+'quoted text' -eu -eu 2>/dev/null local cd echo 'quoted text' --verbose
+-eu | cd cd 2>/dev/null "$@" printf test 2>/dev/null
+	local "$@" test local ${HOME}
+		grep $(pwd) local /usr/bin
+		"$1" -eu then /usr/bin echo local && "$@" then | x=1 $(pwd) --verbose 2>/dev/null
+	$(pwd) echo $(pwd) && && export
+	${HOME} "$1" | | /usr/bin grep cd grep
+--verbose local cd printf --verbose "$@" --verbose
+		sed /usr/bin printf "$1" && echo --verbose export readonly
+	printf -eu test then then
+$(pwd) readonly printf && local
+		printf x=1 printf && export "$1"
+--verbose && done 'quoted text' 2>/dev/null | then $(pwd) then /usr/bin
+		sed --verbose test --verbose printf -eu printf grep awk test sed "$1" local
+local local printf done
+	then done local echo done x=1
+	/usr/bin x=1 /usr/bin grep cd /usr/bin --verbose ${HOME} 'quoted text'
+		local sed $(pwd) export export done ${HOME} "$@" grep echo test
+		printf awk awk /usr/bin echo -eu awk | 'quoted text' test done
+$(pwd) then && 'quoted text' export echo | grep /usr/bin
+	"$@" printf local awk && /usr/bin
+	2>/dev/null --verbose | && 2>/dev/null done x=1 sed ${HOME} "$@" cd | "$@"
+	&& sed /usr/bin then sed && awk "$@" |
+	"$@" printf grep "$1" 2>/dev/null 'quoted text' test && export |
+		done readonly done local export | x=1 'quoted text' ${HOME} |
+		grep sed x=1 2>/dev/null printf sed | "$1" "$@"
+printf "$@" local sed "$1" "$1" grep cd /usr/bin awk ${HOME}
+		/usr/bin done | cd ${HOME} export sed
+	printf readonly echo awk test grep done sed sed x=1 x=1 sed cd /usr/bin
+	/usr/bin then export 'quoted text' then then done awk x=1 x=1
+	local local && && "$1" /usr/bin 'quoted text' $(pwd) ${HOME}
+	x=1 local "$1" test readonly --verbose 2>/dev/null
+		2>/dev/null && ${HOME} export awk --verbose local | "$@" "$@" awk "$1" readonly
+		test ${HOME} "$@" --verbose
+		cd export && sed -eu /usr/bin ${HOME} $(pwd) -eu awk local printf && done cd
+2>/dev/null /usr/bin grep 'quoted text' --verbose printf printf printf 2>/dev/null
+		$(pwd) awk --verbose echo && --verbose echo && $(pwd)
+		${HOME} echo "$1" && /usr/bin --verbose x=1 'quoted text'
+-eu -eu $(pwd) 2>/dev/null /usr/bin printf cd "$@" test ${HOME} sed then
+	grep --verbose grep then test export 'quoted text' --verbose
+/usr/bin done grep then $(pwd) /usr/bin ${HOME} done 'quoted text'
+		awk readonly grep done local ${HOME} ${HOME} 'quoted text'
+| ${HOME} 'quoted text' echo "$@" $(pwd) then -eu export && "$1"
+		$(pwd) | local -eu ${HOME} 'quoted text' /usr/bin
+		"$@" local done sed && then | "$@" printf --verbose
+		then x=1 | -eu grep /usr/bin && local 2>/dev/null
+		sed --verbose x=1 test
+cd printf cd then sed cd $(pwd) sed /usr/bin then /usr/bin /usr/bin
+grep readonly cd x=1 echo "$1"
+	'quoted text' local then test test echo
+		awk && /usr/bin then 2>/dev/null ${HOME} x=1 export
+	x=1 --verbose local | ${HOME} export export
+x=1 'quoted text' | /usr/bin -eu $(pwd) awk 'quoted text'
+test 'quoted text' readonly 'quoted text' cd -eu ${HOME} test | "$1"
+		$(pwd) sed x=1 printf grep readonly
+		$(pwd) && awk | x=1 --verbose printf /usr/bin 'quoted text' ${HOME}
+		awk x=1 "$@" && printf sed sed grep -eu 2>/dev/null
+	echo sed 'quoted text' x=1 awk cd
+"$1" awk /usr/bin done 'quoted text' "$1" readonly | ${HOME} --verbose
+	| /usr/bin 'quoted text' $(pwd) "$@" done awk "$1" cd --verbose
+	"$@" echo | 2>/dev/null ${HOME} /usr/bin
+	'quoted text' test export sed -eu awk then echo 'quoted text'
+	test echo test -eu echo 'quoted text' 'quoted text' --verbose 2>/dev/null
+		&& test ${HOME} "$@" cd export test
+readonly -eu export grep grep echo && 'quoted text' "$@" cd --verbose
+		"$1" ${HOME} done 'quoted text' ${HOME}
+local grep done printf readonly
+	done done --verbose $(pwd) /usr/bin
+| -eu --verbose --verbose test export
+	2>/dev/null "$1" -eu $(pwd) x=1 then test awk ${HOME}
+	-eu cd 2>/dev/null test 2>/dev/null --verbose --verbose cd echo
+-eu 2>/dev/null && readonly test grep $(pwd) | local printf x=1 cd /usr/bin
+echo -eu 2>/dev/null /usr/bin --verbose grep sed && /usr/bin printf $(pwd)
+grep cd cd printf local then echo 2>/dev/null sed
+sed readonly done 2>/dev/null
+	grep done readonly awk $(pwd) | done "$@" local echo && export
+readonly "$1" cd sed ${HOME} "$1" /usr/bin test done grep readonly
+${HOME} awk printf grep "$@" test sed then "$1" x=1 then
+		$(pwd) cd "$1" then echo /usr/bin grep done
+		-eu $(pwd) 'quoted text' printf
+local test local x=1 2>/dev/null
+"$1" local grep | cd 'quoted text' then | awk
+-eu local | /usr/bin $(pwd) -eu
+	echo readonly /usr/bin x=1 cd "$1" done printf grep --verbose --verbose done -eu
+		grep printf -eu echo echo && -eu --verbose echo $(pwd) && local /usr/bin "$@"
+	"$@" test sed 'quoted text' awk echo && && test
+	grep local done 2>/dev/null grep
+	sed x=1 grep ${HOME} /usr/bin "$1"
+${HOME} --verbose /usr/bin readonly readonly 'quoted text' printf
+		printf "$@" 2>/dev/null && ${HOME} echo $(pwd) echo 'quoted text'
+		'quoted text' export ${HOME} "$1" cd local then "$@"
+	x=1 done export $(pwd) x=1 readonly done test test $(pwd)
+then grep echo x=1 ${HOME}
+&& x=1 /usr/bin && done "$1" &&
+"$1" 'quoted text' test 'quoted text'
+sed 'quoted text' $(pwd) printf done grep then done ${HOME}
+x=1 "$@" --verbose then 2>/dev/null ${HOME}
+awk && "$1" "$1" /usr/bin
+	test test --verbose "$@" readonly cd done export "$1" test
+		then && $(pwd) x=1 awk
+	awk 'quoted text' echo "$1" sed /usr/bin
+readonly x=1 awk $(pwd) grep test local -eu
+	cd x=1 export x=1 readonly grep awk local x=1 test
+		echo ${HOME} local 'quoted text'
+	&& "$1" sed local x=1 2>/dev/null $(pwd) test "$1" $(pwd) $(pwd) 2>/dev/null export
+	-eu sed echo done sed printf readonly 2>/dev/null
+		sed | $(pwd) | test ${HOME} done printf
+	echo $(pwd) test 'quoted text'
+		printf -eu ${HOME} cd export
+		awk $(pwd) readonly echo done test ${HOME} done x=1 ${HOME} readonly
+/usr/bin && done "$@" test awk readonly
+cd echo "$1" ${HOME} sed
+	sed $(pwd) "$@" --verbose "$1" then "$1" "$@" readonly
+	2>/dev/null $(pwd) -eu 2>/dev/null echo /usr/bin grep then echo
+		echo sed 2>/dev/null "$@" local awk echo grep "$1" "$1" grep sed readonly
+	echo "$@" then export -eu /usr/bin printf | && awk
+cd 'quoted text' 2>/dev/null 'quoted text'
+		'quoted text' --verbose -eu echo
+	local "$1" printf 2>/dev/null printf
+	cd test /usr/bin cd printf && $(pwd) awk "$@" then "$1" -eu printf
+done echo cd printf 2>/dev/null 'quoted text'
+local x=1 test export export done grep "$1" done echo sed then | ${HOME} 'quoted text'
+	2>/dev/null -eu -eu 2>/dev/null readonly local 2>/dev/null "$1"
+		printf test cd then grep cd ${HOME} x=1 $(pwd) awk
+	-eu ${HOME} $(pwd) x=1 --verbose -eu $(pwd) echo ${HOME} --verbose printf
+	"$1" /usr/bin cd then --verbose "$1" ${HOME} -eu
+-eu printf export local local $(pwd) echo && grep printf /usr/bin
+		cd sed ${HOME} local readonly 2>/dev/null | 'quoted text'
+	test && awk awk $(pwd) --verbose $(pwd) 'quoted text' && "$1" sed grep
+readonly 2>/dev/null 'quoted text' /usr/bin cd cd sed ${HOME} grep awk --verbose
+	grep x=1 cd -eu /usr/bin 'quoted text' awk 'quoted text' awk | && && ${HOME}
+then $(pwd) "$1" awk --verbose readonly | -eu done /usr/bin sed local $(pwd)
+readonly export echo && ${HOME}
+/usr/bin /usr/bin "$1" 2>/dev/null | 2>/dev/null export done "$1" readonly
+		grep $(pwd) then readonly | "$@" $(pwd) test $(pwd) local |
+	${HOME} printf ${HOME} sed awk $(pwd) 'quoted text' "$@" 'quoted text' --verbose
+'quoted text' $(pwd) export sed "$1" 'quoted text' local 2>/dev/null
+grep "$1" x=1 awk 2>/dev/null export
+		$(pwd) 'quoted text' | done local x=1 && sed $(pwd) "$1" done export
+	local grep awk x=1 2>/dev/null test
+		/usr/bin awk echo grep cd 2>/dev/null then 'quoted text'
+&& ${HOME} grep /usr/bin then -eu sed cd -eu 2>/dev/null
+| readonly ${HOME} 2>/dev/null readonly -eu | && /usr/bin /usr/bin cd
+	"$1" /usr/bin cd local && printf 'quoted text' && -eu
+		x=1 cd awk 'quoted text' then local then x=1 2>/dev/null local --verbose
+	then --verbose echo local export -eu 'quoted text' | local ${HOME}
+$(pwd) && awk 'quoted text'
+$(pwd) awk x=1 test "$@" then
+	sed -eu x=1 2>/dev/null x=1 x=1 readonly cd x=1 cd ${HOME}
+		sed echo x=1 readonly grep |
+	--verbose grep local /usr/bin "$1" grep --verbose grep x=1 "$@" 2>/dev/null
+	-eu then sed x=1 --verbose grep 'quoted text'
+2>/dev/null echo export -eu 2>/dev/null grep
+		done test export readonly --verbose -eu test | | "$1" ${HOME} local 'quoted text'
+		${HOME} awk && readonly readonly x=1 sed x=1
+local local echo cd /usr/bin cd 'quoted text' export sed ${HOME}
+	"$1" local echo --verbose && $(pwd) local printf && readonly then sed
+		readonly printf test "$1" -eu $(pwd)
+		&& printf 'quoted text' grep export ${HOME} /usr/bin awk readonly $(pwd)
+	-eu grep | "$1" "$@" printf cd /usr/bin 2>/dev/null
+sed "$@" | ${HOME} x=1 echo
+		-eu cd $(pwd) | awk ${HOME} --verbose test
+	sed export then readonly -eu sed 'quoted text' test
+	cd 'quoted text' x=1 printf ${HOME} echo "$@" done 2>/dev/null "$@" --verbose
+		${HOME} awk | 2>/dev/null awk && && 'quoted text' x=1 cd $(pwd) then echo 'quoted text'
+	sed done x=1 cd awk x=1
+		$(pwd) then 2>/dev/null done
+local test done cd /usr/bin -eu $(pwd) awk done printf awk sed export readonly
+| test sed grep 'quoted text' cd echo printf export | done readonly
+	"$1" test echo ${HOME} grep test "$1" readonly
+		$(pwd) | then then done
+		$(pwd) ${HOME} "$@" "$@" printf 'quoted text' done -eu done awk 'quoted text'
+		'quoted text' ${HOME} && local |
+	/usr/bin | "$@" awk then $(pwd) export export then ${HOME} grep -eu export
+		x=1 then "$1" --verbose then readonly --verbose x=1 $(pwd)
+export printf echo echo 2>/dev/null export awk then "$1" && sed x=1 2>/dev/null
+grep done cd --verbose "$@" grep x=1 local
+	| readonly | --verbose awk readonly --verbose then readonly $(pwd) done 2>/dev/null
+grep grep export x=1 $(pwd) -eu sed ${HOME}
+		'quoted text' | "$1" "$@" "$1"
+		grep -eu 2>/dev/null -eu then -eu then done x=1 then test
+export then -eu done readonly ${HOME} ${HOME} --verbose x=1
+	${HOME} ${HOME} $(pwd) $(pwd) grep "$@" | $(pwd) export /usr/bin
+printf echo printf awk && /usr/bin -eu then "$1" then echo local sed
+done grep 'quoted text' done echo 'quoted text'
+		grep echo readonly && && printf readonly sed awk
+local test "$@" awk -eu awk then | awk export readonly /usr/bin ${HOME}
+'quoted text' "$@" --verbose printf "$@" echo /usr/bin 'quoted text' test
+	"$1" x=1 'quoted text' ${HOME} cd -eu readonly x=1 'quoted text'
+${HOME} grep "$@" -eu 'quoted text' readonly readonly grep grep
+	-eu printf x=1 awk test done 'quoted text'
+		test x=1 cd sed --verbose $(pwd) && echo /usr/bin
+	2>/dev/null grep printf "$@" printf readonly x=1 awk echo then awk $(pwd)
+	"$1" 'quoted text' && done 2>/dev/null
+		&& --verbose printf | readonly cd $(pwd) x=1 /usr/bin x=1 --verbose
+	$(pwd) x=1 $(pwd) awk x=1 cd grep local | done ${HOME} && 2>/dev/null sed
+		cd ${HOME} 'quoted text' cd sed $(pwd) 2>/dev/null | export
+2>/dev/null --verbose awk export local grep readonly
+		| grep "$@" cd | "$1" cd 'quoted text' cd | x=1 /usr/bin --verbose local
+	export then test | --verbose
+then then export /usr/bin "$@" && 'quoted text'
+	-eu 2>/dev/null "$@" /usr/bin then
+	'quoted text' ${HOME} 'quoted text'
+		test /usr/bin /usr/bin | 2>/dev/null printf /usr/bin --verbose
+2>/dev/null echo 'quoted text' export
+cd "$@" 'quoted text' readonly grep -eu done grep --verbose readonly
+		2>/dev/null test awk sed done "$@" awk grep cd --verbose $(pwd) readonly cd --verbose
+		export --verbose ${HOME} ${HOME} x=1 sed export | echo echo printf
+		awk sed && cd then --verbose
+grep $(pwd) -eu "$@" -eu grep printf echo test readonly 2>/dev/null
+	export x=1 test readonly "$1"
+		done --verbose awk then grep sed && --verbose "$1" && test --verbose
+	sed --verbose x=1 export --verbose done cd
+printf $(pwd) awk 2>/dev/null && -eu /usr/bin ${HOME}
+grep -eu && "$1" && then x=1 $(pwd) sed /usr/bin --verbose -eu then
+	done 'quoted text' "$@" export cd "$@" local | ${HOME} cd |
+		$(pwd) done $(pwd) sed 2>/dev/null done cd x=1 sed && 2>/dev/null
+printf "$@" test readonly 2>/dev/null grep 2>/dev/null x=1 sed 2>/dev/null
+	$(pwd) cd | x=1 /usr/bin "$@"
+		"$1" then /usr/bin --verbose $(pwd) grep
+"$@" export /usr/bin ${HOME} sed --verbose awk 'quoted text' -eu test
+		'quoted text' $(pwd) "$1" local 'quoted text' cd printf readonly && cd
+--verbose 'quoted text' /usr/bin grep ${HOME} export
+2>/dev/null cd sed sed then grep test cd x=1 | x=1 'quoted text' 'quoted text'
+		printf echo 'quoted text' done
+		test ${HOME} "$@" "$1" --verbose x=1 grep local awk "$1"
+done | && awk export printf && test /usr/bin "$@" ${HOME} done cd test --verbose
+	"$@" 'quoted text' && done "$@" | export 'quoted text' /usr/bin
+		grep 2>/dev/null && "$@" test "$@" -eu grep
+		export export -eu then "$1" printf --verbose
+echo done done | then | grep export done printf 2>/dev/null echo | $(pwd) 2>/dev/null
+--verbose local cd cd awk grep grep done "$@" done
+	echo $(pwd) 2>/dev/null &&
+	local grep --verbose test x=1 printf export sed ${HOME} done "$1" awk | grep
+	local done ${HOME} && readonly 'quoted text' local x=1 "$1" "$1" export done
+		x=1 x=1 'quoted text' "$1" local export echo cd echo done cd "$1"
+		done && $(pwd) "$1" grep local && | ${HOME} "$@" local export export && local
+grep "$1" sed ${HOME} cd 2>/dev/null sed awk echo
+	cd test && 2>/dev/null done
+		readonly | -eu 'quoted text' | /usr/bin
+	awk sed 2>/dev/null | grep readonly 'quoted text' /usr/bin done
+	awk awk readonly --verbose test echo echo then then "$1" /usr/bin
+/usr/bin readonly /usr/bin sed echo && grep echo then 2>/dev/null $(pwd)
+"$@" "$@" export /usr/bin test 2>/dev/null /usr/bin cd echo local
+	awk -eu awk x=1 x=1 $(pwd) ${HOME} awk
+		then x=1 grep cd done cd echo
+	${HOME} echo -eu && && export $(pwd) grep "$@" readonly && /usr/bin
+	"$1" -eu x=1 sed grep then
+awk test sed test test ${HOME} && | sed printf printf && echo local $(pwd)
+		-eu cd sed x=1 && then x=1 done echo done grep 2>/dev/null && x=1
+	'quoted text' readonly --verbose
+x=1 printf /usr/bin $(pwd) readonly -eu then grep && ${HOME} echo 2>/dev/null
+		x=1 "$1" | /usr/bin | 'quoted text'
+	-eu "$@" echo echo echo $(pwd) /usr/bin 2>/dev/null test then then
+--verbose 2>/dev/null | local -eu cd cd echo 'quoted text' "$1" -eu printf done
+	then ${HOME} x=1 ${HOME} x=1 ${HOME} --verbose printf sed done
+'quoted text' 'quoted text' /usr/bin && /usr/bin sed
+	then --verbose grep done printf printf then $(pwd) done grep printf -eu then printf
+	/usr/bin -eu sed then local 'quoted text' "$1" 2>/dev/null && awk awk
+cd readonly "$@" local -eu && "$@" done done -eu ${HOME} done done "$1" readonly
+	awk done x=1 grep /usr/bin "$1" ${HOME}
+	cd cd test --verbose x=1 awk | echo $(pwd) echo sed
+-eu echo echo x=1 x=1 "$@"
+		sed --verbose $(pwd) 2>/dev/null readonly ${HOME} x=1 $(pwd) 'quoted text' local
+		printf --verbose -eu "$1" local ${HOME} awk local /usr/bin cd printf echo then
+	then 2>/dev/null sed /usr/bin --verbose readonly ${HOME}
+		cd test printf cd grep /usr/bin
+export | | cd "$1" $(pwd) $(pwd) sed /usr/bin 'quoted text' cd $(pwd)
+	then then awk awk x=1 "$@"
+x=1 cd x=1 "$@" sed 'quoted text' ${HOME} -eu "$@" test --verbose
+/usr/bin test ${HOME} "$1" awk echo
+	grep 2>/dev/null $(pwd) "$@"
+local test readonly export then -eu
+2>/dev/null 2>/dev/null "$@" grep test ${HOME} grep "$@" export
+local -eu x=1 "$1" printf ${HOME} | export grep --verbose $(pwd) echo
+		2>/dev/null export export "$1" "$@" sed then readonly
+	local 'quoted text' /usr/bin awk | awk
+	"$1" echo sed /usr/bin /usr/bin local test $(pwd) "$1"
+		printf then grep test /usr/bin /usr/bin
+2>/dev/null "$1" grep readonly done $(pwd)
+	cd printf grep done sed echo echo
+	"$@" local | "$1" test "$@" readonly | then grep sed && cd 2>/dev/null
+		"$@" done "$1" printf "$1"
+		printf -eu printf local 2>/dev/null awk export | "$1" readonly grep
+done "$1" test printf --verbose grep printf
+		--verbose printf readonly printf echo 'quoted text' then then export printf grep
+	export x=1 -eu echo 'quoted text' $(pwd) && x=1
+readonly local printf $(pwd) grep grep x=1 done sed "$@" "$@" echo
+2>/dev/null "$@" "$1" awk | x=1 sed x=1 && /usr/bin --verbose export printf export
+		grep sed $(pwd) "$1" done done "$@" ${HOME} then echo test readonly && $(pwd) readonly
+		local sed -eu ${HOME} 2>/dev/null then sed $(pwd) sed local printf cd && export
+printf $(pwd) "$1" ${HOME} done x=1 | $(pwd) ${HOME} "$1" readonly 'quoted text'
+${HOME} readonly cd 2>/dev/null "$1" sed echo x=1 /usr/bin export local "$@" then
+&& local sed "$1" then grep printf 'quoted text'
+2>/dev/null local $(pwd) x=1 then
+x=1 $(pwd) done readonly 2>/dev/null
+		local sed printf -eu local sed local 2>/dev/null
+	local done cd test | $(pwd) --verbose sed
+		--verbose -eu printf done --verbose export readonly &&
+then sed "$1" --verbose echo | --verbose sed $(pwd)
+	local cd $(pwd) 2>/dev/null sed local local "$1" printf "$@" 2>/dev/null "$1" --verbose
+	awk x=1 sed awk test grep sed 'quoted text' local
+		echo ${HOME} | "$1" printf done x=1 awk grep local x=1 ${HOME} x=1 local
+then grep grep grep /usr/bin test
+		readonly | $(pwd) "$@" grep printf sed "$@"
+	test export printf echo && /usr/bin sed cd sed x=1 readonly
+	$(pwd) x=1 "$1" /usr/bin then readonly readonly /usr/bin
+		"$1" 2>/dev/null done then "$1" awk 'quoted text' grep then 'quoted text' --verbose
+	"$1" sed "$@" | 2>/dev/null "$1" then --verbose printf x=1 readonly
+	2>/dev/null echo test local echo | then "$1" then "$1" then
+	printf && sed sed -eu awk echo local /usr/bin printf readonly --verbose
+	then ${HOME} "$1" grep "$@" readonly "$1" done awk test then done cd 2>/dev/null
+${HOME} ${HOME} "$1" sed local printf "$@" -eu "$1" -eu
+	done export --verbose x=1 then cd | | sed ${HOME} cd --verbose
+	then && printf then awk && cd -eu 2>/dev/null grep done | test sed
+		"$1" echo then grep | | $(pwd) printf | local 'quoted text' "$@"
+		export then then cd grep done done export /usr/bin then && && $(pwd) cd
+| --verbose awk grep echo x=1
+		sed x=1 -eu grep $(pwd) readonly
+/usr/bin export $(pwd) readonly /usr/bin awk then --verbose | && ${HOME}
+"$@" grep "$@" && --verbose | --verbose ${HOME} "$@" $(pwd) --verbose | test
+cd sed done test 'quoted text' then done /usr/bin "$@" export cd "$@" --verbose
+		grep --verbose ${HOME} local $(pwd) /usr/bin then grep grep then
+	done ${HOME} && "$1" "$1" echo export ${HOME} awk ${HOME} ${HOME} ${HOME} 2>/dev/null
+	${HOME} x=1 printf export awk grep -eu "$1" done
+		${HOME} local "$@" grep "$@"
+		$(pwd) ${HOME} "$1" --verbose -eu ${HOME}
+		'quoted text' "$1" then done sed 2>/dev/null
+"$1" && test | /usr/bin 'quoted text'
+		-eu grep | readonly awk $(pwd) then echo export grep -eu
+	'quoted text' 'quoted text' printf cd done $(pwd) printf "$@" --verbose sed readonly
+	cd x=1 $(pwd) sed "$1" done printf --verbose readonly cd test 2>/dev/null --verbose
+	$(pwd) ${HOME} ${HOME} export export "$1" && readonly echo awk sed printf &&
+echo export printf "$@" x=1 echo
+		&& ${HOME} $(pwd) grep -eu grep /usr/bin /usr/bin
+${HOME} "$1" $(pwd) 'quoted text' export printf "$1" | grep awk printf /usr/bin
+2>/dev/null "$1" awk local printf $(pwd) "$@" x=1 then --verbose ${HOME}
+-eu export readonly readonly
+&& ${HOME} && x=1 grep | "$1" 2>/dev/null /usr/bin 'quoted text' 'quoted text'
+		then "$@" /usr/bin test
+	grep && done && awk "$@"
+	done /usr/bin | && "$@" local grep cd readonly cd && 'quoted text'
+		done --verbose printf cd awk sed $(pwd) | local --verbose x=1 | ${HOME}
+then cd test $(pwd) then
+		local awk --verbose readonly then done grep awk x=1 cd /usr/bin awk
+	local /usr/bin awk x=1 printf "$1" "$@" echo "$1"
+2>/dev/null grep | $(pwd) /usr/bin sed &&
+		'quoted text' $(pwd) cd x=1 printf 2>/dev/null readonly export cd && grep
+cd then -eu cd done done export done cd 'quoted text' /usr/bin
+-eu readonly awk -eu then export export "$1" test echo printf readonly
+	cd $(pwd) 'quoted text' -eu 'quoted text'
+printf readonly export sed ${HOME} sed
+		-eu done done 2>/dev/null test sed local | "$1" "$1" then
+		2>/dev/null ${HOME} &&
+		printf done --verbose echo 2>/dev/null
+		x=1 test then --verbose test 2>/dev/null
+		awk then --verbose -eu && /usr/bin printf
+	cd printf x=1 -eu /usr/bin 'quoted text' "$1" cd sed | /usr/bin then ${HOME} grep
+"$@" export awk $(pwd) export 2>/dev/null
+	'quoted text' readonly "$@" cd printf printf 'quoted text' ${HOME} grep echo -eu
+&& readonly echo echo readonly | local test done "$@" sed x=1 x=1 printf
+	sed test export "$@" 2>/dev/null "$1" grep ${HOME} then
+		"$@" awk export test x=1 then local test
+printf done echo printf
+		sed /usr/bin $(pwd) awk "$1" "$1" "$1" readonly 'quoted text' "$@" test
+	$(pwd) export "$1" awk sed cd
+		| sed printf /usr/bin awk printf x=1 done
+	cd $(pwd) test echo /usr/bin | awk done ${HOME} && --verbose 'quoted text' sed
+done "$1" then readonly && -eu awk sed readonly -eu x=1 grep | --verbose
+	'quoted text' test cd grep $(pwd) printf |
+$(pwd) readonly | readonly | echo --verbose x=1 grep
+	$(pwd) export grep x=1 'quoted text'
+echo export done grep /usr/bin cd test $(pwd)
+	2>/dev/null printf /usr/bin done $(pwd) export "$@" /usr/bin then $(pwd) &&
+	printf --verbose "$@" "$1" printf 'quoted text' grep
+export readonly 2>/dev/null 2>/dev/null
+	2>/dev/null $(pwd) /usr/bin "$1" | readonly
+&& --verbose $(pwd) echo echo x=1 cd done -eu -eu $(pwd) && test "$@" test done
+&& awk -eu -eu echo $(pwd) sed | 2>/dev/null then sed sed grep "$@" awk ${HOME}
+		$(pwd) done ${HOME} "$1" printf "$@"
+		&& cd --verbose done 'quoted text' 2>/dev/null sed grep
+	2>/dev/null awk printf /usr/bin ${HOME} done -eu
+		then cd awk printf "$@" -eu then readonly test done
+	test then -eu test sed readonly
+awk local 2>/dev/null then && echo | export awk printf done
+		printf "$1" /usr/bin ${HOME} ${HOME}
+/usr/bin then cd then /usr/bin export awk "$1" -eu then local
+		-eu printf echo 2>/dev/null $(pwd) export readonly
+${HOME} export ${HOME} readonly /usr/bin 2>/dev/null 2>/dev/null
+	x=1 awk && echo grep
+		2>/dev/null --verbose grep sed /usr/bin
+		cd | echo echo ${HOME} local cd echo | "$1" $(pwd)
+		"$@" /usr/bin printf sed ${HOME} readonly cd
+		cd && done 2>/dev/null awk local
+	/usr/bin test x=1 && -eu grep cd 'quoted text'
+		printf x=1 local awk local local --verbose
+2>/dev/null readonly --verbose
+done awk printf grep $(pwd) && x=1 awk
+local grep cd "$1" local $(pwd) readonly done ${HOME} | sed then
+		2>/dev/null echo && "$@" "$1" /usr/bin /usr/bin then grep local "$@" export local
+export /usr/bin export grep "$@" printf ${HOME} "$1" done
+	test ${HOME} readonly grep /usr/bin echo $(pwd) -eu then ${HOME}
+	export printf sed grep test awk 2>/dev/null
+"$1" then x=1 export | ${HOME} 'quoted text'
+		awk export ${HOME} grep -eu x=1 test echo ${HOME} awk sed | ${HOME}
+		grep 'quoted text' $(pwd) export then | "$1" grep -eu ${HOME} "$1" -eu
+		'quoted text' readonly -eu ${HOME} && && | cd echo 'quoted text' done readonly
+		grep "$1" "$@" printf 2>/dev/null 'quoted text' &&
+x=1 x=1 "$@" export grep "$1" -eu echo
+/usr/bin -eu echo x=1 then --verbose cd grep /usr/bin
+2>/dev/null test /usr/bin | awk export 'quoted text'
+done local grep cd done
+		awk printf sed test -eu ${HOME} export x=1 echo /usr/bin "$@"
+export x=1 sed 2>/dev/null | $(pwd) awk then "$1" awk -eu readonly ${HOME}
+export x=1 2>/dev/null cd sed 2>/dev/null awk readonly
+	"$@" then readonly local grep "$@"
+	-eu x=1 local | 'quoted text' && "$@" export ${HOME}
+		&& awk && -eu "$1" echo cd test "$@"
+	| --verbose 2>/dev/null 'quoted text'
+		&& "$@" printf 'quoted text' "$1" /usr/bin 'quoted text' x=1 'quoted text'
+		awk then && printf "$@" readonly x=1 grep export &&
+		then -eu -eu ${HOME} local grep "$@" | 2>/dev/null done && 2>/dev/null
+		&& "$1" && 2>/dev/null done --verbose -eu export export ${HOME} done then done
+printf --verbose --verbose && printf --verbose 2>/dev/null -eu
+		awk echo x=1 && x=1 awk "$1" awk /usr/bin readonly
+	readonly | "$1" 2>/dev/null grep $(pwd) echo "$@" echo test && /usr/bin
+&& test /usr/bin test printf x=1 cd then 'quoted text'
+--verbose /usr/bin sed | "$@" printf test
+	"$1" local && "$1" echo "$1" "$1" cd ${HOME} "$1" --verbose
+printf local 'quoted text' && "$@" export -eu test sed export cd test
+	&& then ${HOME} echo ${HOME} x=1 cd printf grep grep then local
+'quoted text' export done grep "$@" grep /usr/bin
+echo && printf test -eu grep grep $(pwd) /usr/bin ${HOME} ${HOME} sed readonly
+		"$1" x=1 $(pwd) printf && /usr/bin
+	done export export done 2>/dev/null "$@" "$1" readonly |
+		-eu && echo ${HOME} "$1" awk x=1 | -eu 'quoted text'
+	local 'quoted text' --verbose x=1 test grep 'quoted text' && ${HOME}
+printf awk then export test then echo export printf cd local $(pwd) "$@" "$1" readonly
+awk "$@" ${HOME} --verbose test export then done done
+done -eu ${HOME} echo 'quoted text' | x=1 $(pwd) sed echo cd 2>/dev/null
+		--verbose 2>/dev/null | ${HOME} done x=1 grep readonly x=1 then | "$@" x=1
+"$1" -eu test export $(pwd) printf awk then export done x=1 2>/dev/null
+"$@" 'quoted text' readonly local | done | cd cd export --verbose echo echo
+	${HOME} printf grep done 'quoted text' local awk test readonly
+		export done cd x=1 /usr/bin test /usr/bin --verbose echo x=1 "$1" export
+		| "$1" grep | export grep then --verbose
+		grep 2>/dev/null sed local --verbose | /usr/bin
+		export "$1" "$1" echo sed done 'quoted text' "$@" test /usr/bin
+	local then $(pwd) && 2>/dev/null awk then 'quoted text' test local "$@"
+printf grep then sed $(pwd) printf grep x=1 ${HOME}
+		export echo -eu then "$1" | "$@" "$@" cd then 2>/dev/null printf printf
+		/usr/bin done local 2>/dev/null | then printf local
+	echo --verbose local echo $(pwd) printf grep awk -eu -eu x=1 /usr/bin done ${HOME}
+	/usr/bin done | export sed
+	readonly $(pwd) export grep -eu --verbose --verbose | "$1" test then
+		test test "$@" x=1 echo x=1
+| 'quoted text' grep
+	test && echo "$1" done x=1
+		&& readonly $(pwd) -eu "$@" grep local echo "$@"
+	test /usr/bin "$1" local "$1" then
+/usr/bin done "$1" done export 'quoted text' test --verbose
+		"$@" grep "$1" --verbose | readonly sed --verbose
+readonly 'quoted text' test awk readonly 2>/dev/null
+		printf && x=1 x=1 "$@" "$@" /usr/bin
+		grep done grep /usr/bin readonly
+	then readonly $(pwd) -eu 'quoted text'
+--verbose --verbose echo "$@" 2>/dev/null local sed $(pwd) sed cd x=1
+		done /usr/bin sed "$1" test then ${HOME} cd 2>/dev/null
+		&& 'quoted text' 2>/dev/null $(pwd)
+	awk 2>/dev/null --verbose --verbose "$1" grep 'quoted text'
+		awk grep ${HOME} && | --verbose export ${HOME} awk --verbose ${HOME} printf echo
+done local | "$@" then 2>/dev/null "$@" && then printf $(pwd) sed x=1 awk "$1"
+export "$1" --verbose
+	x=1 "$@" test "$1" x=1 $(pwd) done $(pwd) echo sed local -eu readonly
+	export /usr/bin test then sed export ${HOME} && x=1 printf | test
+$(pwd) /usr/bin grep export 'quoted text' x=1 "$@" test 2>/dev/null
+sed cd /usr/bin "$@" cd done && sed | && x=1 /usr/bin printf
+		done printf grep 2>/dev/null
+	$(pwd) ${HOME} /usr/bin local echo && /usr/bin
+	grep 'quoted text' 2>/dev/null /usr/bin 2>/dev/null "$@" then -eu then test echo
+x=1 "$@" --verbose && --verbose ${HOME} cd | /usr/bin
+'quoted text' 2>/dev/null --verbose cd awk -eu 'quoted text' readonly --verbose
+		sed awk grep && done export | --verbose /usr/bin /usr/bin
+sed "$1" "$@" local done ${HOME} $(pwd) "$@" /usr/bin "$@"
+	awk then done printf | /usr/bin 2>/dev/null cd
+	awk done test $(pwd) grep
+		export cd echo done "$1" x=1 grep | export /usr/bin printf "$@" sed
+		export awk -eu 'quoted text' $(pwd) awk /usr/bin && cd export done
+		-eu local "$1" printf 'quoted text'
+	printf echo cd 'quoted text' && then printf then "$1" readonly && $(pwd) test
+printf local "$1" /usr/bin local 2>/dev/null "$1" x=1 printf | 2>/dev/null sed
+test -eu x=1 readonly printf export x=1
+	| "$@" done | done -eu done 'quoted text' $(pwd) $(pwd)
+x=1 | "$1" 2>/dev/null -eu $(pwd) "$@" awk "$@" /usr/bin export
+	local sed done 2>/dev/null 2>/dev/null
+		2>/dev/null sed sed && && $(pwd)
+readonly --verbose then 2>/dev/null echo "$1" done 2>/dev/null done --verbose
+	$(pwd) --verbose cd cd -eu $(pwd) /usr/bin &&
+printf 2>/dev/null echo ${HOME} ${HOME} then
+-eu ${HOME} export 2>/dev/null
+		/usr/bin done $(pwd) sed --verbose
+		/usr/bin cd awk readonly sed |
+		2>/dev/null x=1 grep test --verbose -eu | | && "$@" cd
+${HOME} printf export then test awk printf x=1 $(pwd) 'quoted text'
+		test "$@" export "$@" ${HOME} cd grep "$1" grep | readonly 'quoted text'
+&& && then readonly cd grep grep 'quoted text' readonly awk local
+		export x=1 test awk ${HOME}
+	export done export "$1" readonly "$@" then printf readonly test x=1 2>/dev/null
+		printf 'quoted text' /usr/bin /usr/bin echo
+	-eu 2>/dev/null sed ${HOME} ${HOME}
+	local echo "$1" sed && | && readonly printf
+	-eu | echo /usr/bin "$1" local cd awk done "$1"
+grep echo -eu 'quoted text' sed echo 'quoted text' | 'quoted text' "$@"
+&& "$1" grep printf sed --verbose ${HOME} && "$1" readonly grep
+	&& --verbose | x=1 $(pwd)
+		printf cd awk "$@" grep awk "$1" printf cd && && test grep | test readonly
+	local test "$1" echo test ${HOME} ${HOME} && then
+		echo ${HOME} ${HOME} grep | sed $(pwd) /usr/bin
+		cd && /usr/bin done ${HOME} $(pwd) local
+local $(pwd) x=1 grep /usr/bin x=1 echo then -eu grep
+	test "$1" $(pwd) "$1" test 2>/dev/null
+		2>/dev/null x=1 -eu x=1 -eu sed done | then
+		test 2>/dev/null && ${HOME} | grep done 'quoted text'
+	| readonly 2>/dev/null readonly grep /usr/bin
+grep printf 'quoted text' "$@" cd printf
+	&& 'quoted text' $(pwd) ${HOME} 'quoted text' && export
+printf --verbose then grep 2>/dev/null readonly && local
+	export done 2>/dev/null -eu done -eu test echo local && test sed done "$@"
+&& printf "$@" $(pwd) 'quoted text' "$1" local ${HOME} ${HOME} export "$@" x=1
+	"$1" echo "$@" local | 2>/dev/null sed 'quoted text'
+awk "$1" "$1" readonly
+	2>/dev/null x=1 local
+		cd "$1" $(pwd) ${HOME} sed printf
+printf 2>/dev/null awk -eu export then x=1 done
+$(pwd) $(pwd) export --verbose x=1 export readonly "$@"
+	$(pwd) ${HOME} $(pwd) awk 'quoted text'
+		--verbose "$@" cd done 'quoted text'
+$(pwd) echo && /usr/bin test
+| && ${HOME} "$1" -eu --verbose 2>/dev/null printf awk 2>/dev/null cd local test
+local x=1 --verbose readonly && echo /usr/bin
+		"$1" "$1" && sed test 'quoted text' done /usr/bin local && local
+		awk && "$@" $(pwd) echo cd printf then export echo echo -eu readonly ${HOME}
+	x=1 echo && readonly grep grep cd sed /usr/bin grep cd 'quoted text'
+2>/dev/null test /usr/bin echo readonly x=1 | "$@" readonly
+--verbose --verbose 'quoted text' $(pwd) sed
+		-eu sed 'quoted text' cd && test /usr/bin | test
+		printf then sed ${HOME} ${HOME} export | "$@" && cd ${HOME}
+	sed --verbose /usr/bin -eu "$@" "$1" && && grep readonly /usr/bin
+		done export -eu x=1 "$@" local awk echo grep export printf | echo printf
+		grep echo echo export && done $(pwd) | done echo done 2>/dev/null
+'quoted text' then 2>/dev/null | "$@" -eu then "$1"
+awk ${HOME} $(pwd) echo
+	'quoted text' readonly done then
+-eu test test sed export
+		sed done awk ${HOME} && grep printf test | "$1" printf
+		x=1 export local export then export
+		then 2>/dev/null done -eu echo echo
+		'quoted text' grep sed local --verbose -eu --verbose && readonly readonly -eu
+		2>/dev/null | test readonly sed echo
+${HOME} --verbose $(pwd) sed readonly local done | sed "$@" "$@" "$1" /usr/bin
+'quoted text' local --verbose local "$@" $(pwd) 2>/dev/null
+sed export "$1" "$@" --verbose local cd --verbose echo
+| x=1 && export "$1"
+		2>/dev/null cd | done 2>/dev/null cd printf sed cd | x=1 -eu printf "$1" export
+readonly test 'quoted text' $(pwd)
+then ${HOME} | /usr/bin awk | 2>/dev/null
+	/usr/bin --verbose test && "$@"
+		test --verbose done awk grep -eu -eu "$1" 'quoted text' awk ${HOME} readonly
+		printf && 'quoted text' cd printf
+	readonly ${HOME} export $(pwd) readonly && x=1 "$@" 'quoted text'
+	"$@" && && readonly awk sed 2>/dev/null
+x=1 -eu done /usr/bin
+printf $(pwd) "$1" "$1" 2>/dev/null "$1" echo /usr/bin x=1 | 'quoted text'
+		$(pwd) ${HOME} "$1" export printf export
+		| && | 'quoted text' | | "$@" grep local readonly x=1 test /usr/bin
+	local cd done /usr/bin local "$@"
+	export --verbose printf printf "$1" readonly printf done -eu readonly
+	printf 2>/dev/null 2>/dev/null cd -eu done --verbose readonly
+	test 'quoted text' ${HOME} export local awk sed awk grep done
+	printf then ${HOME} $(pwd) $(pwd) | -eu echo then "$1" && $(pwd)
+		cd test export --verbose done ${HOME} "$1" 'quoted text'
+	readonly $(pwd) 'quoted text' /usr/bin 'quoted text' | echo "$@"
+	'quoted text' printf grep grep awk test grep local echo export /usr/bin /usr/bin
+		local done printf echo 2>/dev/null
+awk export awk | "$1" readonly then done "$@" $(pwd)
+printf ${HOME} local done 'quoted text' cd printf 2>/dev/null -eu --verbose
+/usr/bin echo "$1" x=1 && $(pwd) x=1
+sed "$1" readonly then then local "$@" grep
+sed | $(pwd) ${HOME} cd
+	export done "$1" && $(pwd) then 2>/dev/null printf cd "$@" export
+		sed then then awk test "$@" && done echo
+	$(pwd) /usr/bin echo printf --verbose --verbose $(pwd) ${HOME} "$@" echo
+awk cd cd test readonly awk sed /usr/bin 2>/dev/null echo "$1" --verbose
+echo cd done 'quoted text'
+		"$1" export sed export echo cd ${HOME} 2>/dev/null test
+	cd local $(pwd) 2>/dev/null /usr/bin echo grep $(pwd) --verbose
+		-eu 'quoted text' printf x=1 test && x=1 $(pwd) echo
+	export "$1" then "$1" $(pwd)
+		printf then x=1 readonly 'quoted text' done x=1 test ${HOME} "$1"
+		then -eu 'quoted text'
+	sed ${HOME} export ${HOME} 2>/dev/null awk sed -eu && 'quoted text'
+sed /usr/bin printf "$@" "$@" "$1" /usr/bin "$@" 2>/dev/null
+$(pwd) awk readonly && x=1 local --verbose ${HOME}
+		&& 2>/dev/null --verbose test /usr/bin test x=1 grep readonly
+	echo readonly "$@" printf printf awk "$1" cd "$1"
+	export --verbose cd 2>/dev/null awk "$@" test export ${HOME} -eu |
+		"$1" grep cd done grep sed && x=1 readonly awk done printf
+		grep done echo 'quoted text' grep
+${HOME} "$1" cd --verbose printf ${HOME} ${HOME} ${HOME}
+	readonly test sed 2>/dev/null 2>/dev/null then 2>/dev/null export -eu awk
+		"$@" 'quoted text' | sed
+	printf x=1 2>/dev/null test 'quoted text'
+	readonly local $(pwd) 'quoted text' cd ${HOME} awk $(pwd)
+&& -eu $(pwd) x=1 cd sed 2>/dev/null 2>/dev/null --verbose "$1" echo x=1 'quoted text'
+		echo | export local grep x=1 printf && cd done -eu
+	local readonly | "$1" && awk
+	'quoted text' done && printf | local
+		readonly /usr/bin done printf 2>/dev/null cd echo $(pwd)
+| 2>/dev/null "$1" --verbose ${HOME} awk grep "$1" -eu test | sed
+awk export --verbose --verbose 2>/dev/null "$@" test | /usr/bin local "$1" then
+-eu cd $(pwd) then test 2>/dev/null done &&
+	/usr/bin cd done --verbose 'quoted text' cd "$1" done /usr/bin /usr/bin
+then export then sed sed 'quoted text' 2>/dev/null awk echo && 2>/dev/null $(pwd)
+--verbose "$1" ${HOME} awk ${HOME} local
+local "$1" then /usr/bin printf "$1" printf && 2>/dev/null local echo test
+--verbose cd --verbose
+	$(pwd) done awk --verbose && done ${HOME} echo /usr/bin | | test 'quoted text'
+		--verbose then --verbose echo | test readonly
+		| 2>/dev/null done export ${HOME} -eu x=1 echo
+'quoted text' echo cd then "$1" $(pwd) ${HOME} sed grep cd printf x=1 --verbose
+sed -eu done "$@" /usr/bin 2>/dev/null then
+/usr/bin readonly test $(pwd) 2>/dev/null
+		| ${HOME} | "$1" then /usr/bin --verbose
+		cd printf local "$1" -eu && ${HOME} test
+done echo ${HOME} && ${HOME} /usr/bin cd "$1" $(pwd) ${HOME} sed echo
+local echo export --verbose | awk $(pwd) local /usr/bin
+grep /usr/bin echo -eu cd cd printf "$@" &&
+	done ${HOME} 2>/dev/null readonly ${HOME} then cd x=1
+--verbose awk sed grep readonly /usr/bin && ${HOME} echo done local
+"$@" --verbose local 2>/dev/null 2>/dev/null && printf awk then done export
+		grep echo x=1 awk done awk 2>/dev/null
+printf -eu done grep /usr/bin --verbose 2>/dev/null local
+	export local export 2>/dev/null sed /usr/bin x=1 local export $(pwd)
+		2>/dev/null readonly done $(pwd) && then local 'quoted text'
+	'quoted text' /usr/bin "$1" done then $(pwd) printf "$@"
+x=1 awk local grep "$1" $(pwd) x=1
+readonly $(pwd) printf printf grep sed --verbose readonly /usr/bin 'quoted text'
+x=1 awk "$1" done "$@" export && "$@" awk echo awk "$1" echo
+	sed x=1 'quoted text' | /usr/bin "$@" then
+local echo sed sed ${HOME}
+	-eu "$@" 'quoted text' 2>/dev/null
+	${HOME} sed -eu x=1 done --verbose $(pwd) then "$1" ${HOME} "$1" --verbose
+local /usr/bin ${HOME} /usr/bin 2>/dev/null |
+		2>/dev/null then ${HOME} | cd sed | ${HOME} && test local awk | "$1"
+	then -eu cd test x=1 sed export 'quoted text' ${HOME} $(pwd)
+	&& export "$1" cd x=1 2>/dev/null && then printf "$1"
+	grep 'quoted text' test x=1 $(pwd) printf sed && cd | readonly && | /usr/bin 2>/dev/null
+local x=1 | sed /usr/bin "$1"
+		grep test cd x=1 done 'quoted text'
+export then "$1" 2>/dev/null export "$1"
+	test x=1 printf cd grep $(pwd)
+		sed ${HOME} "$1" x=1 local sed ${HOME} "$@" done printf
+		test /usr/bin grep sed sed cd cd 'quoted text' /usr/bin ${HOME} grep "$@"
+	"$@" echo $(pwd) export -eu && ${HOME} && sed -eu export &&
+readonly 2>/dev/null then -eu done -eu
+'quoted text' readonly /usr/bin
+test done --verbose 'quoted text' /usr/bin 2>/dev/null ${HOME} done
+awk printf -eu "$1" cd sed /usr/bin awk | -eu | $(pwd) awk /usr/bin
+local readonly export test --verbose cd $(pwd) local test -eu sed local x=1 "$1"
+	awk /usr/bin awk sed x=1 $(pwd) $(pwd) readonly 'quoted text'
+		x=1 echo ${HOME} 2>/dev/null 2>/dev/null done | readonly 2>/dev/null ${HOME}
+'quoted text' done test local local printf printf export cd 'quoted text'
+	2>/dev/null 'quoted text' done then "$@"
+	printf echo -eu 'quoted text' | 2>/dev/null $(pwd) -eu "$1" ${HOME}
+		then awk echo ${HOME} ${HOME} printf sed && grep ${HOME} x=1
+		2>/dev/null "$@" | 2>/dev/null done --verbose
+		then readonly 2>/dev/null && then export local && test echo then "$1" x=1 /usr/bin
+		--verbose sed export
+--verbose readonly then | "$1"
+		$(pwd) /usr/bin local ${HOME} then --verbose test ${HOME} --verbose test
+		$(pwd) x=1 /usr/bin readonly 'quoted text' then /usr/bin
+cd $(pwd) ${HOME} $(pwd) "$1" --verbose local "$@" && x=1 local $(pwd)
+		export cd | test /usr/bin then | local | grep 2>/dev/null "$1" --verbose
+		done && -eu "$1" x=1 cd
+	-eu /usr/bin "$@" local done $(pwd)
+done "$@" "$@" local ${HOME} then ${HOME} echo "$1" -eu test
+then && export awk 2>/dev/null test && 'quoted text' awk $(pwd) test && done
+export 2>/dev/null sed done -eu
+	awk /usr/bin "$@" 'quoted text'
+		x=1 printf x=1 cd "$@" "$1" export 2>/dev/null "$1" "$@"
+	--verbose readonly && then test test printf --verbose sed
+		awk cd /usr/bin "$1" | test $(pwd) -eu sed printf $(pwd) && readonly $(pwd)
+grep /usr/bin $(pwd) sed printf | "$1" sed done done 2>/dev/null echo then "$1"
+		/usr/bin $(pwd) echo export echo "$@" ${HOME}
+readonly && local sed
+echo cd sed -eu sed readonly awk test done x=1 printf 'quoted text' "$1" -eu then
+	"$@" /usr/bin test then printf ${HOME} /usr/bin "$1" echo
+export -eu x=1 awk export done --verbose && export -eu cd grep cd then
+${HOME} x=1 done | 2>/dev/null /usr/bin /usr/bin
+	done sed 'quoted text' 2>/dev/null | sed && /usr/bin grep 2>/dev/null && grep
+| x=1 test | cd grep ${HOME}
+		/usr/bin --verbose --verbose test | printf grep 2>/dev/null 'quoted text'
+then 'quoted text' awk readonly --verbose /usr/bin && -eu test awk | $(pwd) local
+	"$1" "$1" export -eu "$@" /usr/bin 'quoted text' 'quoted text' "$@" /usr/bin
+		-eu grep | done --verbose awk | "$@" ${HOME} sed then export local awk readonly
+	2>/dev/null && then echo 2>/dev/null /usr/bin
+		2>/dev/null x=1 "$1" grep then -eu && ${HOME} readonly 2>/dev/null
+$(pwd) -eu awk /usr/bin cd printf |
+		2>/dev/null $(pwd) local 'quoted text' echo
+		| --verbose local 'quoted text' cd sed "$@" awk cd done --verbose
+		$(pwd) /usr/bin && sed &&
+		echo echo test awk --verbose awk
+		cd $(pwd) ${HOME} export grep test "$1" "$@" readonly "$@" "$1"
+"$1" -eu $(pwd) 2>/dev/null cd local cd 2>/dev/null
+	grep printf export awk done "$1"
+		"$@" x=1 --verbose done /usr/bin "$@" grep /usr/bin ${HOME} && && 'quoted text'
+		test 2>/dev/null "$@" readonly echo -eu "$1" then /usr/bin --verbose --verbose
+2>/dev/null "$1" export ${HOME} then printf then printf 'quoted text'
+"$1" test echo printf $(pwd) ${HOME} done | test awk | readonly "$1"
+${HOME} $(pwd) sed awk -eu
+	printf --verbose 'quoted text' done 2>/dev/null
+'quoted text' printf done /usr/bin --verbose $(pwd) test x=1 $(pwd) ${HOME}
+		readonly printf | local "$1" | -eu printf printf | done then printf
+local x=1 test "$@" && x=1 cd echo /usr/bin && done test done readonly
+-eu echo local -eu x=1 local
+grep then 2>/dev/null ${HOME} /usr/bin
+| ${HOME} 2>/dev/null awk "$1" readonly grep 2>/dev/null
+2>/dev/null export | grep readonly "$1" sed grep ${HOME} done printf ${HOME}
+local local --verbose export /usr/bin "$1" 2>/dev/null ${HOME} export
+		/usr/bin "$@" $(pwd) done 'quoted text'
+echo cd x=1 awk sed export "$1" awk sed export x=1 -eu
+		local 2>/dev/null export sed "$@" export "$@" ${HOME} x=1 awk "$@"
+echo done | 2>/dev/null ${HOME} 2>/dev/null
+		export "$1" && /usr/bin
+	"$1" test -eu then cd -eu awk printf
+printf x=1 done readonly
+"$@" "$@" export --verbose x=1 ${HOME} /usr/bin
+awk x=1 "$@" then && && 2>/dev/null
+${HOME} echo sed sed export
+		printf 2>/dev/null echo export then
+	sed printf x=1 then readonly done then /usr/bin cd ${HOME} readonly
+		readonly --verbose done test "$@"
+	/usr/bin local --verbose done 2>/dev/null test "$1" x=1 awk echo
+		done x=1 -eu done /usr/bin awk local x=1 | 2>/dev/null
+	'quoted text' /usr/bin sed 2>/dev/null "$@" printf
+	readonly 2>/dev/null x=1 grep cd ${HOME} | sed local | /usr/bin then /usr/bin
+x=1 -eu "$1" grep 'quoted text' ${HOME}
+	local | "$@" 2>/dev/null 'quoted text' awk
+	cd done x=1 --verbose && x=1 ${HOME} printf done 2>/dev/null sed grep $(pwd)
+	echo then awk $(pwd) local 'quoted text' x=1
+	sed local ${HOME} ${HOME} sed echo
+		readonly | && && grep /usr/bin sed | | | export
+	then 'quoted text' done test /usr/bin grep test 2>/dev/null awk
+		echo 2>/dev/null && then
+		"$1" 2>/dev/null 2>/dev/null local printf cd test && | "$@"
+		"$1" 2>/dev/null echo printf x=1 cd | then cd
+'quoted text' x=1 readonly
+		${HOME} && grep local cd --verbose awk printf sed x=1 && /usr/bin then
+		echo "$@" local x=1 cd cd ${HOME} awk export "$1"
+		${HOME} printf 'quoted text' printf done $(pwd)
+	then --verbose then export awk echo "$@" | done 2>/dev/null
+2>/dev/null echo 'quoted text' export echo 'quoted text'
+	done printf "$@" $(pwd) then && awk $(pwd) | ${HOME} && readonly sed test
+	"$1" readonly sed && ${HOME} grep --verbose printf export cd "$@" --verbose
+| sed echo local 'quoted text' grep done sed $(pwd) "$@"
+		awk ${HOME} 'quoted text' x=1 readonly echo printf x=1 'quoted text'
+	grep done /usr/bin | grep $(pwd) then export 2>/dev/null
+		sed 2>/dev/null $(pwd) -eu cd "$1" x=1 export
+	test ${HOME} -eu awk "$@" printf local
+echo ${HOME} | test cd echo x=1 sed grep -eu sed -eu && then awk | grep | &&
+| export cd ${HOME} x=1 test && then awk readonly local | "$@" x=1
+		grep sed local readonly cd 'quoted text' | "$@" ${HOME} "$@"
+		readonly local /usr/bin cd --verbose --verbose then test export "$1" /usr/bin
+	printf grep /usr/bin
+	2>/dev/null x=1 ${HOME} -eu "$@" "$1" done x=1 "$1" --verbose -eu then --verbose
+grep readonly grep $(pwd) grep ${HOME} x=1 x=1 2>/dev/null test then
+	sed done grep "$@" 'quoted text' "$@" ${HOME} cd
+	$(pwd) grep printf then
+done sed test ${HOME} sed
+		sed printf x=1 /usr/bin
+	printf /usr/bin | printf && 2>/dev/null readonly 'quoted text'
+		export $(pwd) $(pwd) cd printf x=1 'quoted text' -eu cd
+cd "$1" x=1 export "$1" 'quoted text' $(pwd) $(pwd) ${HOME}
+		/usr/bin "$1" local grep && ${HOME} "$@" x=1
+&& grep done printf echo readonly $(pwd) ${HOME} --verbose test awk
+done local test && /usr/bin readonly
+		$(pwd) -eu /usr/bin x=1 ${HOME} /usr/bin
+		--verbose 'quoted text' cd
+		cd | -eu 'quoted text' $(pwd) sed test export "$@" "$@" "$@"
+	--verbose grep "$@" "$@" test sed | -eu $(pwd) awk grep test
+	cd readonly 2>/dev/null /usr/bin | grep ${HOME} 'quoted text' then
+awk done test test then then sed printf echo && ${HOME}
+	&& x=1 "$@" sed readonly export
+${HOME} -eu done 'quoted text' /usr/bin printf test local
+&& done sed sed -eu test ${HOME} grep && /usr/bin sed /usr/bin "$1" "$1" cd 2>/dev/null
+echo sed --verbose "$@" 2>/dev/null
+grep /usr/bin --verbose done test 'quoted text' /usr/bin grep awk then printf
+	done echo then 'quoted text'
+		${HOME} cd sed $(pwd) -eu then done sed grep -eu grep grep x=1 printf
+echo "$@" awk cd "$1" cd readonly /usr/bin -eu --verbose
+	'quoted text' x=1 grep --verbose done 2>/dev/null 2>/dev/null
+readonly ${HOME} "$1" export done | test awk 'quoted text'
+	echo printf "$@" 2>/dev/null
+$(pwd) "$1" --verbose 'quoted text' grep printf --verbose printf grep test
+		"$@" /usr/bin echo test
+		--verbose test 'quoted text' readonly
+--verbose 2>/dev/null x=1 cd test
+grep done x=1 | && export
+		| test ${HOME} "$@" echo
+awk readonly awk /usr/bin && ${HOME} printf 2>/dev/null 2>/dev/null
+cd then 'quoted text' | done 2>/dev/null printf readonly cd
+printf printf /usr/bin
+awk "$@" 'quoted text' 2>/dev/null
+		"$@" awk awk --verbose echo readonly ${HOME} printf
+		export printf sed x=1 echo && --verbose
+		x=1 echo x=1 test done 'quoted text' "$1" --verbose ${HOME} local
+		'quoted text' x=1 2>/dev/null
+		sed "$1" "$1" local 2>/dev/null readonly x=1 x=1 cd readonly
+	done -eu "$@" then 'quoted text' &&
+"$1" x=1 grep grep test
+		sed echo then "$@" /usr/bin $(pwd)
+	&& $(pwd) cd 'quoted text' "$@"
+	${HOME} x=1 local awk readonly done $(pwd)
+	test && && | $(pwd) x=1 printf
+		&& test printf x=1 'quoted text' x=1 export && readonly && cd /usr/bin
+"$@" printf ${HOME} then test | sed done | "$@"
+	$(pwd) && readonly grep sed printf echo 'quoted text'
+	local x=1 "$@" --verbose -eu grep --verbose "$@"
+	/usr/bin ${HOME} "$@" | awk $(pwd) --verbose
+	| test --verbose cd echo test done test sed x=1 test $(pwd) /usr/bin
+		sed | grep ${HOME} awk 2>/dev/null && x=1 awk ${HOME} 2>/dev/null
+	'quoted text' test printf cd cd $(pwd) --verbose
+	readonly "$@" $(pwd) $(pwd) sed awk 'quoted text'
+		grep printf 'quoted text'
+		done x=1 ${HOME} done sed readonly
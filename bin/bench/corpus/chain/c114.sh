@@ -0,0 +1,2001 @@
+		2>/dev/null "$@" $(pwd) grep readonly awk cd
+		2>/dev/null /usr/bin --verbose then printf 2>/dev/null done
+-eu echo local local x=1 export | $(pwd) /usr/bin | x=1 readonly
+	cd done && grep --verbose 'quoted text' awk | cd 'quoted text'
+		"$@" ${HOME} ${HOME} readonly
+	echo sed readonly grep grep
+		test then grep done && "$1" 2>/dev/null readonly done x=1 cd $(pwd) done 2>/dev/null
+	cd then x=1 /usr/bin && -eu --verbose
+	&& /usr/bin echo 'quoted text' -eu |
+	export 2>/dev/null awk local
+	printf grep awk awk "$1" x=1 grep export
+		--verbose $(pwd) /usr/bin
+	-eu cd awk done printf readonly grep awk
+		| readonly awk sed done local awk echo x=1 "$@" && && -eu done
+x=1 "$@" "$1" -eu awk test "$@" echo | local "$1" && $(pwd) && test
+	| echo echo x=1 readonly && | ${HOME}
+		printf ${HOME} /usr/bin then && && test
+	cd echo 2>/dev/null | x=1 awk readonly
+	printf then grep sed awk
+		--verbose cd printf sed local 'quoted text' export printf local x=1 -eu readonly
+echo /usr/bin grep readonly x=1 --verbose 2>/dev/null
+	-eu | cd export ${HOME} grep grep ${HOME}
+		then 'quoted text' $(pwd) -eu done -eu echo
+	2>/dev/null printf test then 'quoted text' sed echo then x=1 "$@"
+		x=1 export done echo $(pwd) awk awk grep readonly 2>/dev/null
+		export local grep done test export /usr/bin
+		export ${HOME} | /usr/bin
+	awk sed printf x=1 'quoted text' -eu local | awk printf 2>/dev/null -eu echo
+		$(pwd) && x=1 x=1 local && ${HOME} /usr/bin local ${HOME} 2>/dev/null
+		"$@" "$@" /usr/bin $(pwd) x=1 /usr/bin readonly 2>/dev/null test /usr/bin sed
+	awk printf readonly echo "$1"
+		${HOME} sed local test 2>/dev/null
+"$1" | $(pwd) | awk /usr/bin local readonly
+"$1" export done done |
+	sed "$1" | /usr/bin then sed echo "$@"
+		test readonly -eu awk echo sed 2>/dev/null local
+echo && && 'quoted text' cd /usr/bin ${HOME} $(pwd) test $(pwd) local done printf
+	awk 'quoted text' test done -eu /usr/bin $(pwd)
+	local x=1 "$1" x=1 --verbose
+echo 'quoted text' "$@" "$@" then grep && $(pwd) && && printf local --verbose $(pwd)
+		cd cd readonly sed done local $(pwd) grep "$@" printf
+	test echo then x=1 "$1" export awk "$1"
+${HOME} 'quoted text' --verbose -eu sed 2>/dev/null awk readonly
+		cd "$1" x=1 -eu ${HOME} awk 'quoted text' &&
+		/usr/bin echo $(pwd) sed && /usr/bin readonly ${HOME} $(pwd) "$@" &&
+${HOME} && 'quoted text' |
+		then then && awk sed | && readonly awk local awk | done local $(pwd) readonly
+--verbose export 'quoted text'
+sed readonly grep x=1 echo --verbose
+$(pwd) done ${HOME} x=1 printf -eu test test /usr/bin export
+		'quoted text' && done "$1" readonly done
+"$@" --verbose | "$1" && readonly | cd then done "$1" grep ${HOME}
+	cd | echo | test "$1" $(pwd) awk
+$(pwd) /usr/bin /usr/bin local ${HOME} --verbose local /usr/bin done
+		export test local && export local ${HOME} 2>/dev/null
+	then | $(pwd) | && readonly 'quoted text'
+		export x=1 sed ${HOME} local "$1" --verbose -eu then $(pwd) -eu grep sed export
+	local sed test then awk awk 'quoted text' readonly
+x=1 readonly 2>/dev/null echo $(pwd) grep | echo "$@" sed export
+	$(pwd) printf -eu && -eu readonly -eu
+--verbose local sed export "$@" x=1 2>/dev/null ${HOME} $(pwd) done echo
+		2>/dev/null 2>/dev/null grep 2>/dev/null $(pwd) grep "$1" -eu x=1 done echo |
+	"$1" 'quoted text' awk "$1" "$@" "$@" done printf x=1 readonly cd export
+--verbose --verbose grep && test sed cd "$@" | awk echo
+		local awk local && && -eu done cd readonly --verbose echo cd local
+--verbose $(pwd) readonly 2>/dev/null --verbose --verbose ${HOME}
+		"$1" sed sed /usr/bin readonly export local printf
+cd && "$1" && --verbose --verbose -eu done | "$@" readonly 2>/dev/null
+	--verbose test printf printf awk test then done "$@" done
+		${HOME} && local test "$1" && cd grep grep --verbose then ${HOME} test
+cd "$@" cd sed echo then awk -eu grep cd local ${HOME} ${HOME}
+		done ${HOME} sed sed /usr/bin
+then printf readonly 2>/dev/null
+		sed sed "$1" "$@" $(pwd) done $(pwd)
+		$(pwd) export done then awk | test /usr/bin x=1 grep --verbose sed
+	grep x=1 x=1 /usr/bin | sed printf | ${HOME} grep ${HOME} local /usr/bin
+		readonly test cd cd ${HOME} printf -eu
+	local x=1 "$1" local | readonly && x=1
+	grep grep | awk cd cd "$1" 2>/dev/null "$@" printf cd readonly local sed test
+	local grep local then $(pwd) printf echo x=1
+test /usr/bin && local sed && 2>/dev/null then ${HOME} "$@"
+	export "$@" "$1" | echo --verbose /usr/bin --verbose local ${HOME} awk grep
+		--verbose printf --verbose test readonly x=1 readonly
+	grep $(pwd) $(pwd) x=1
+readonly export /usr/bin export "$1" ${HOME} test
+	test export cd readonly $(pwd) /usr/bin local x=1 ${HOME}
+	test && echo && awk | && | echo
+	echo awk "$1" readonly /usr/bin "$1" "$1" "$1" 2>/dev/null readonly sed then local
+		${HOME} local "$@" && -eu cd export |
+	local sed $(pwd) -eu "$@"
+		'quoted text' $(pwd) local test "$1" ${HOME} "$1"
+${HOME} "$1" 2>/dev/null echo grep ${HOME}
+		-eu 'quoted text' cd done export /usr/bin
+"$1" && printf cd "$1" test
+		grep "$@" ${HOME} 2>/dev/null then
+	printf test echo export "$@" local printf readonly
+	| test echo test "$1" printf
+export done echo "$@" | 2>/dev/null 'quoted text'
+	printf && "$@" export 2>/dev/null cd "$@" -eu $(pwd) grep cd 2>/dev/null
+	"$1" export local awk sed test $(pwd) export ${HOME} grep ${HOME} | 2>/dev/null
+	--verbose test --verbose then ${HOME} readonly |
+	2>/dev/null readonly readonly readonly "$@" --verbose
+test -eu done 2>/dev/null && ${HOME} x=1 /usr/bin | $(pwd) x=1
+	| echo 2>/dev/null /usr/bin $(pwd) && sed grep /usr/bin 2>/dev/null
+	$(pwd) done done $(pwd) cd /usr/bin awk awk cd /usr/bin $(pwd) | /usr/bin
+then export $(pwd) readonly --verbose ${HOME} test /usr/bin
+	2>/dev/null ${HOME} test sed x=1 echo awk local "$@" cd
+		sed --verbose local --verbose /usr/bin grep test readonly then then
+printf $(pwd) "$1" | && /usr/bin echo awk 'quoted text' readonly local
+		--verbose "$@" cd 'quoted text' --verbose printf grep export ${HOME} $(pwd)
+sed local x=1 awk | then awk local --verbose -eu
+&& cd --verbose then && --verbose ${HOME} "$1"
+		$(pwd) test /usr/bin 2>/dev/null sed printf local test && "$1" sed ${HOME}
+		&& 2>/dev/null local echo 'quoted text' x=1 printf echo cd sed | /usr/bin
+	'quoted text' test export 2>/dev/null -eu --verbose sed "$@"
+		&& done local $(pwd) readonly
+		export sed | 'quoted text'
+sed sed && export "$1" | ${HOME} "$1" cd
+grep "$@" x=1 'quoted text' ${HOME} export then test sed $(pwd) grep 'quoted text'
+	readonly printf && printf local
+		"$@" 2>/dev/null && "$@" done awk awk "$1" export then test $(pwd) /usr/bin grep
+$(pwd) $(pwd) local awk test done
+	"$@" 'quoted text' ${HOME} /usr/bin grep -eu -eu ${HOME} 2>/dev/null readonly
+		grep $(pwd) export $(pwd) ${HOME} done | done
+		--verbose grep printf printf export readonly local sed cd sed
+	2>/dev/null readonly done
+"$@" 'quoted text' then export done | cd test printf "$1" sed x=1 -eu echo 2>/dev/null
+		&& $(pwd) awk cd "$@" awk 2>/dev/null
+	x=1 2>/dev/null /usr/bin -eu --verbose done awk readonly echo --verbose
+/usr/bin echo && && /usr/bin
+&& --verbose x=1 --verbose printf export then done && then
+sed 2>/dev/null grep /usr/bin local ${HOME} | $(pwd) 'quoted text' cd local export
+		then ${HOME} ${HOME} readonly export | --verbose echo /usr/bin
+| $(pwd) printf local then ${HOME} then /usr/bin
+		echo awk 'quoted text' 2>/dev/null
+	grep test ${HOME} "$1" && | x=1 -eu 'quoted text' "$@" test test x=1
+	-eu grep readonly $(pwd) sed | done grep 2>/dev/null sed "$1"
+"$@" "$@" grep sed printf sed sed "$1" /usr/bin
+		printf && export $(pwd) then sed
+		/usr/bin export && cd local cd
+		then done "$1" ${HOME} readonly 'quoted text' printf sed printf /usr/bin
+readonly "$@" local | local 'quoted text' done then x=1 readonly echo
+		local done printf --verbose ${HOME} && readonly
+		local x=1 x=1 --verbose ${HOME} echo &&
+	grep 2>/dev/null && "$@" local then sed done
+then sed x=1 printf test export
+	done sed sed ${HOME} readonly echo &&
+	export 2>/dev/null | | sed "$1" --verbose echo echo "$@" "$1"
+	test ${HOME} printf "$@"
+	x=1 ${HOME} export then then echo -eu
+		done /usr/bin echo /usr/bin | x=1 local readonly grep export local printf
+	cd echo then test 'quoted text' ${HOME}
+		-eu "$@" done done "$1" sed "$1" | 2>/dev/null | "$1" 'quoted text' 'quoted text'
+		then printf /usr/bin "$@" && 'quoted text' ${HOME} -eu
+	export x=1 sed grep x=1
+	readonly test x=1 test "$1" --verbose grep -eu echo cd echo "$@" x=1 'quoted text'
+		readonly x=1 then -eu /usr/bin ${HOME}
+	| 2>/dev/null ${HOME} -eu | | printf $(pwd) 'quoted text' "$1"
+		-eu grep --verbose sed && cd 2>/dev/null printf 'quoted text'
+test echo done local | sed --verbose
+done grep "$1" -eu done echo "$1" cd "$1" && cd done
+export done echo export export x=1 readonly test -eu && done sed
+	2>/dev/null -eu /usr/bin cd test && 'quoted text' echo 'quoted text' cd "$1"
+	2>/dev/null 2>/dev/null x=1 'quoted text' $(pwd) ${HOME}
+echo sed printf x=1 && &&
+	cd echo readonly 2>/dev/null
+	cd ${HOME} $(pwd) x=1 sed --verbose 'quoted text' then && "$@" cd
+	export printf $(pwd) cd echo then "$@" "$@"
+cd sed "$@" /usr/bin test "$@" --verbose local awk then readonly 2>/dev/null
+cd "$@" | cd ${HOME} sed $(pwd)
+	-eu done && --verbose printf local x=1 $(pwd) 2>/dev/null --verbose done done
+${HOME} export readonly grep 'quoted text' "$@" test test awk ${HOME}
+		${HOME} export cd printf | ${HOME} readonly
+		echo then test --verbose "$@" "$1" done "$1" then ${HOME} 2>/dev/null 2>/dev/null
+printf -eu 'quoted text' 'quoted text' echo grep /usr/bin
+	local then local ${HOME} echo -eu sed
+	-eu | sed 'quoted text'
+	x=1 readonly 'quoted text' then test x=1 -eu grep 'quoted text' 'quoted text'
+	'quoted text' awk echo --verbose $(pwd) test x=1 local
+		${HOME} 'quoted text' && grep printf
+done /usr/bin | --verbose | -eu cd --verbose | cd
+		--verbose test done -eu awk | printf readonly
+local "$1" 'quoted text' awk && 'quoted text' readonly awk
+	/usr/bin 'quoted text' | $(pwd) local done done export done echo | test
+		'quoted text' | /usr/bin -eu printf then done
+x=1 $(pwd) readonly echo sed 'quoted text'
+$(pwd) grep x=1 | "$1" &&
+		local echo test --verbose export then readonly $(pwd) export readonly
+		grep local && && --verbose awk --verbose && export sed readonly local
+	"$@" ${HOME} sed && grep /usr/bin local ${HOME} echo
+		&& cd export "$@" then then /usr/bin test cd "$@" $(pwd) | "$@" /usr/bin
+cd test echo | | sed done awk
+cd awk --verbose sed awk $(pwd) readonly "$@" | -eu
+	readonly x=1 "$1" echo 2>/dev/null sed cd
+	${HOME} cd -eu --verbose local 'quoted text' 2>/dev/null grep export 'quoted text'
+local ${HOME} --verbose /usr/bin sed echo /usr/bin done
+	x=1 --verbose /usr/bin test ${HOME} "$1" $(pwd)
+		"$1" echo "$1" local done cd grep test 'quoted text' 2>/dev/null
+	"$1" "$1" readonly readonly awk | done 2>/dev/null echo
+		grep local local then grep printf 'quoted text' then x=1 test && local
+	-eu -eu /usr/bin | sed test readonly 'quoted text' "$1" done then readonly --verbose
+awk readonly "$@" echo printf test awk
+$(pwd) done printf | done test
+		cd then $(pwd) ${HOME} printf export "$1" ${HOME}
+		&& x=1 done ${HOME} readonly "$1" x=1
+&& readonly ${HOME} -eu ${HOME} "$1" x=1 readonly "$1" cd done "$1"
+		/usr/bin 'quoted text' "$@" printf echo $(pwd) echo -eu
+	done export then x=1 | echo -eu local 'quoted text'
+	/usr/bin | "$@" cd /usr/bin x=1 echo 2>/dev/null
+local && --verbose && awk
+	export "$1" done grep export
+awk grep local export $(pwd) | 'quoted text' 2>/dev/null then 'quoted text' -eu
+		$(pwd) test echo "$1" --verbose awk export readonly
+		then sed 2>/dev/null printf 2>/dev/null ${HOME}
+	&& local sed echo && && 'quoted text' -eu ${HOME} cd export
+$(pwd) printf test awk -eu readonly ${HOME}
+local "$1" 'quoted text' | export local "$1" echo printf done
+	sed test ${HOME} sed test 'quoted text'
+	test readonly /usr/bin 'quoted text' "$1" $(pwd) export -eu | then local
+	local cd -eu 'quoted text' done
+		/usr/bin sed /usr/bin ${HOME} "$1" -eu
+	2>/dev/null "$1" test --verbose 'quoted text' echo local local grep 'quoted text'
+		done && /usr/bin test printf --verbose "$1" export
+		awk | test "$1" sed 2>/dev/null x=1 grep | --verbose && cd local /usr/bin ${HOME}
+	cd awk test cd 2>/dev/null x=1 "$1" "$@" test cd "$1" awk "$1" && 2>/dev/null
+	printf sed 'quoted text' awk x=1 2>/dev/null
+		sed ${HOME} echo export ${HOME} echo
+	${HOME} ${HOME} 'quoted text' awk /usr/bin printf | 'quoted text'
+		${HOME} done 2>/dev/null then 'quoted text' -eu
+	grep done ${HOME} $(pwd) then
+	done printf x=1 && printf -eu 2>/dev/null cd /usr/bin "$@" then
+-eu readonly local cd 'quoted text' $(pwd) x=1
+local 2>/dev/null grep 2>/dev/null 2>/dev/null test printf echo x=1 -eu echo then
+x=1 2>/dev/null local -eu /usr/bin grep cd done
+	${HOME} -eu cd ${HOME}
+	grep x=1 then test awk -eu -eu sed 2>/dev/null export --verbose 'quoted text'
+		cd "$@" 2>/dev/null -eu then echo 2>/dev/null local cd 2>/dev/null $(pwd)
+"$@" done 2>/dev/null $(pwd) $(pwd) local "$@" -eu $(pwd) printf "$@" done | export
+'quoted text' | --verbose --verbose readonly "$@"
+	$(pwd) "$@" | then --verbose awk x=1 echo -eu --verbose /usr/bin grep cd 'quoted text'
+		echo printf sed sed x=1 echo local grep -eu awk cd printf
+		printf readonly 2>/dev/null grep cd readonly | awk -eu "$1" grep test &&
+	test grep cd export echo /usr/bin "$@" | done then /usr/bin --verbose
+		"$1" "$@" test ${HOME} cd 2>/dev/null ${HOME} "$@" echo 'quoted text'
+	| export grep --verbose && sed | x=1 cd && $(pwd) sed awk &&
+		export readonly local 'quoted text' export &&
+then && awk && grep "$1" 2>/dev/null
+		${HOME} grep grep 2>/dev/null $(pwd) 2>/dev/null printf
+		$(pwd) awk --verbose then readonly cd /usr/bin readonly printf test --verbose
+		printf printf readonly
+	$(pwd) done "$1" test grep echo /usr/bin
+	2>/dev/null sed cd -eu readonly x=1 2>/dev/null | x=1 sed local done x=1 /usr/bin
+	/usr/bin readonly /usr/bin /usr/bin x=1 'quoted text'
+/usr/bin x=1 --verbose echo export "$1" then
+		done 2>/dev/null "$@" --verbose $(pwd) ${HOME} test && x=1
+		&& | "$1" local | export /usr/bin printf "$1" 'quoted text'
+	readonly x=1 $(pwd) grep && test sed && export
+echo export -eu printf | grep -eu -eu done /usr/bin "$1" "$@" --verbose
+	&& cd grep -eu --verbose
+--verbose awk done --verbose "$1" /usr/bin
+		printf $(pwd) 2>/dev/null
+		/usr/bin then grep "$@" "$@" $(pwd) test "$1" sed | 'quoted text' /usr/bin
+		export done --verbose local && && ${HOME} && test
+done then done $(pwd)
+		grep grep 2>/dev/null done
+-eu local export "$@" printf x=1 cd -eu /usr/bin --verbose sed -eu && sed
+cd /usr/bin x=1 'quoted text' echo 'quoted text'
+	echo printf ${HOME} --verbose test "$@" done -eu local x=1
+	done sed echo && "$1" 2>/dev/null awk
+then --verbose "$@" sed echo grep 'quoted text' local export grep
+	'quoted text' done readonly $(pwd) export "$@" "$1" export -eu &&
+test echo cd awk "$1" readonly local && awk x=1 test export cd
+sed echo test "$1" awk ${HOME} readonly echo "$1"
+echo && | 'quoted text' echo --verbose readonly cd && --verbose sed awk && $(pwd)
+		sed awk /usr/bin sed "$@" sed | printf && ${HOME}
+		x=1 -eu echo -eu awk local
+	$(pwd) | export local && $(pwd) sed
+	then | printf -eu 'quoted text'
+		awk $(pwd) readonly $(pwd) test 'quoted text' test awk readonly printf
+printf 'quoted text' printf test && && "$@"
+x=1 sed grep --verbose test local
+	"$1" && --verbose done $(pwd) --verbose --verbose x=1
+	then then then done cd ${HOME} 'quoted text'
+		cd done export grep readonly done export cd grep "$@" awk | "$1" export
+	$(pwd) --verbose $(pwd) export -eu ${HOME} "$1" cd $(pwd) 'quoted text' cd
+grep cd -eu "$1" x=1 grep local ${HOME} export
+x=1 -eu "$1" $(pwd) 2>/dev/null then && $(pwd)
+	&& $(pwd) test sed -eu "$1" $(pwd) 'quoted text'
+		2>/dev/null 'quoted text' --verbose $(pwd) printf 2>/dev/null
+	"$1" $(pwd) then then | "$1" x=1 export test --verbose && x=1 $(pwd) then &&
+		-eu --verbose test -eu --verbose 'quoted text'
+x=1 printf x=1 readonly sed test | cd local 'quoted text' readonly export --verbose
+	--verbose readonly readonly sed ${HOME} x=1 'quoted text'
+"$@" --verbose "$1" awk test "$@" echo -eu /usr/bin readonly ${HOME} x=1 'quoted text'
+x=1 --verbose grep export "$@" "$1" ${HOME} echo
+&& ${HOME} grep grep sed x=1 --verbose
+		&& /usr/bin done local 'quoted text' printf cd local sed 'quoted text' ${HOME}
+"$1" /usr/bin --verbose x=1 sed local /usr/bin sed test then readonly
+		done "$1" --verbose /usr/bin && ${HOME} && /usr/bin /usr/bin
+		x=1 sed ${HOME} x=1 && cd printf
+	then sed done local "$1" 'quoted text' export
+	test local ${HOME} "$1" /usr/bin then 2>/dev/null
+		done then $(pwd) "$@" --verbose /usr/bin "$@" "$@"
+export readonly /usr/bin && && /usr/bin
+	/usr/bin echo then then then -eu | /usr/bin
+/usr/bin 'quoted text' "$@" grep awk 'quoted text' local grep /usr/bin
+	&& printf /usr/bin --verbose
+	export grep "$1" awk ${HOME} ${HOME} $(pwd) done sed echo | && 'quoted text'
+		2>/dev/null /usr/bin readonly "$@" /usr/bin --verbose readonly x=1
+sed /usr/bin sed ${HOME} local sed readonly "$1" export x=1 readonly
+then done done printf "$@"
+"$@" then "$1" | x=1
+printf $(pwd) grep printf
+		"$1" "$1" | "$1" | -eu done ${HOME}
+	readonly 2>/dev/null local 'quoted text' $(pwd) x=1
+		--verbose grep && awk grep | awk | "$@" | test "$@" echo readonly "$1" | &&
+		cd "$1" x=1 2>/dev/null awk x=1 'quoted text' printf local 2>/dev/null /usr/bin
+		awk grep readonly local awk awk export 2>/dev/null x=1 $(pwd) local
+x=1 then $(pwd) 2>/dev/null x=1 cd "$1" 'quoted text' test cd /usr/bin
+		grep printf -eu test ${HOME} $(pwd) awk x=1 x=1 "$1" awk
+	"$@" cd "$@" done "$1" echo "$@" 2>/dev/null readonly
+done "$1" done && /usr/bin "$@" test cd | "$1" grep ${HOME} --verbose
+awk -eu grep x=1 cd done local sed test -eu ${HOME}
+	export "$1" 'quoted text' && local
+		printf 'quoted text' local
+| local $(pwd) printf then awk 'quoted text' readonly export -eu --verbose
+		awk grep export sed then then x=1 test "$@" -eu awk x=1 | | "$@"
+	grep -eu 'quoted text' 'quoted text' 2>/dev/null ${HOME} --verbose -eu cd "$@"
+	echo --verbose 'quoted text' | /usr/bin
+	echo local echo awk "$1"
+		test | grep 'quoted text'
+		| 'quoted text' done 2>/dev/null | awk sed done
+	done $(pwd) done printf readonly "$1"
+'quoted text' -eu done 2>/dev/null readonly 2>/dev/null
+2>/dev/null | ${HOME} ${HOME} awk export done && x=1
+		&& -eu 2>/dev/null then "$@" x=1 printf --verbose ${HOME} grep then local readonly
+	awk -eu 2>/dev/null 2>/dev/null "$@" sed cd && x=1 x=1
+"$1" grep "$1" readonly $(pwd) grep test "$1"
+grep grep | "$1" ${HOME} &&
+awk awk 2>/dev/null sed test done /usr/bin grep sed local test grep && export
+local && $(pwd) then done sed
+	grep test awk then cd printf then /usr/bin
+		sed --verbose grep && export /usr/bin local "$@"
+readonly 'quoted text' sed echo &&
+/usr/bin readonly printf cd -eu /usr/bin
+"$@" echo 'quoted text' -eu grep export
+		sed sed export done | -eu $(pwd) then "$@" "$@" readonly ${HOME}
+		readonly 'quoted text' "$@" readonly
+	${HOME} 2>/dev/null test "$@" awk done awk test printf
+2>/dev/null && grep echo done echo 2>/dev/null echo cd cd -eu export 2>/dev/null
+	test readonly ${HOME} export
+	x=1 -eu /usr/bin && export cd "$@" | sed 2>/dev/null 2>/dev/null done
+		export "$1" | x=1 readonly local sed "$1" readonly
+export /usr/bin -eu readonly
+	done then sed sed | readonly awk
+		$(pwd) echo readonly 'quoted text' readonly echo awk printf sed x=1
+		awk printf local sed printf
+		&& && 'quoted text' readonly export 'quoted text'
+	awk grep -eu done | sed cd | ${HOME} local /usr/bin awk grep
+	echo sed | sed test /usr/bin -eu grep
+		done ${HOME} readonly done cd $(pwd) $(pwd) "$@" -eu
+	echo then done printf printf --verbose "$1" ${HOME} x=1
+		/usr/bin && echo -eu x=1 "$@" -eu printf $(pwd) then
+		grep sed && && readonly $(pwd) test 'quoted text' test
+	test local ${HOME} awk echo && local ${HOME} export | "$1" awk --verbose
+2>/dev/null export ${HOME} "$1" 2>/dev/null
+		2>/dev/null $(pwd) test /usr/bin readonly grep x=1 awk then
+		${HOME} grep test grep printf grep ${HOME}
+$(pwd) grep echo local -eu --verbose "$1"
+	"$1" 'quoted text' printf "$@" "$1" then -eu test -eu x=1 cd "$@" done
+cd x=1 x=1 $(pwd) | 2>/dev/null x=1 -eu -eu $(pwd) then 'quoted text' | then
+	2>/dev/null && | ${HOME} echo -eu "$1" && grep | local printf
+		then then export "$@" "$1"
+grep 2>/dev/null "$@" $(pwd)
+		sed printf awk 2>/dev/null readonly && printf done then
+local /usr/bin then 2>/dev/null | 2>/dev/null sed sed x=1 sed grep | "$@"
+		echo sed cd printf 'quoted text' 2>/dev/null
+		awk local export export | grep --verbose awk 'quoted text'
+	then 'quoted text' then 'quoted text' test then --verbose readonly
+		--verbose test "$1" awk "$1" sed printf done --verbose 'quoted text' "$@" --verbose
+	--verbose cd then local && ${HOME}
+sed x=1 then test done
+"$@" -eu done | cd "$1" cd /usr/bin $(pwd) cd printf readonly grep sed
+	x=1 test awk | readonly cd --verbose cd local 'quoted text' cd then 'quoted text'
+	x=1 export grep then printf
+		'quoted text' 2>/dev/null | then 2>/dev/null sed "$@" cd readonly readonly
+		2>/dev/null && 'quoted text' sed | "$1" echo ${HOME} ${HOME}
+		readonly && cd awk ${HOME} 'quoted text' awk then cd
+		${HOME} x=1 --verbose "$1" ${HOME} local echo awk "$@"
+		done local then then "$1" then awk x=1 && --verbose awk export /usr/bin
+	awk -eu x=1 awk grep "$@" grep
+sed grep readonly sed sed then
+		$(pwd) cd echo printf cd then export local /usr/bin --verbose echo $(pwd)
+		/usr/bin | test 'quoted text' -eu grep -eu x=1
+	2>/dev/null "$1" awk cd readonly 'quoted text'
+	local local then done grep 'quoted text'
+--verbose /usr/bin "$1" export $(pwd) export echo 2>/dev/null
+		--verbose && /usr/bin /usr/bin 2>/dev/null sed --verbose
+		grep echo | | echo "$@" then readonly 2>/dev/null
+		sed grep -eu printf readonly then $(pwd)
+	done -eu awk $(pwd) test cd readonly 'quoted text'
+		$(pwd) x=1 export local "$1" export x=1 then ${HOME} printf grep
+"$@" grep echo | "$1" awk export export 'quoted text'
+/usr/bin then export then &&
+		grep test then sed -eu readonly printf | printf 'quoted text' -eu --verbose
+	2>/dev/null then 'quoted text' $(pwd) local ${HOME}
+		&& /usr/bin | -eu grep "$@" ${HOME} "$@"
+	/usr/bin && echo test -eu local echo x=1 -eu export grep $(pwd)
+		x=1 x=1 done | readonly x=1 -eu grep
+	'quoted text' --verbose 2>/dev/null 'quoted text' &&
+		then --verbose x=1 | --verbose cd cd x=1 2>/dev/null echo printf
+	-eu cd awk cd -eu "$1" x=1
+	/usr/bin && -eu local export x=1
+	readonly readonly then /usr/bin
+-eu readonly readonly local grep grep && ${HOME}
+		awk done then cd grep sed done sed && echo printf cd printf ${HOME}
+	&& grep export export ${HOME} 2>/dev/null x=1 'quoted text' x=1
+		&& $(pwd) printf readonly sed "$1" -eu -eu readonly
+	-eu "$@" "$@" grep readonly cd cd "$@" && grep readonly ${HOME} export
+	sed x=1 "$1" awk done awk
+awk "$@" && done "$1" done grep
+then done "$1" then 2>/dev/null test x=1 done readonly "$1" export cd
+"$@" "$1" printf x=1 --verbose test ${HOME} echo
+	| $(pwd) "$@" printf echo export done
+-eu echo "$1" test export --verbose "$1" 'quoted text'
+	grep ${HOME} grep printf cd test echo awk awk awk | awk
+| test sed /usr/bin x=1 awk && cd echo then then 'quoted text' export
+"$@" /usr/bin $(pwd) then "$@" $(pwd) test | ${HOME} | cd /usr/bin echo test
+cd "$@" | -eu 'quoted text' 'quoted text' -eu echo
+export sed x=1 done echo
+$(pwd) readonly 2>/dev/null sed readonly readonly 2>/dev/null
+		printf printf /usr/bin x=1 cd ${HOME} -eu 2>/dev/null --verbose grep
+	"$1" ${HOME} $(pwd) local | awk done printf test cd && readonly
+		local "$@" then grep "$1" | echo x=1 --verbose grep $(pwd) --verbose awk /usr/bin
+	readonly -eu done --verbose printf "$1" readonly && readonly then local
+	| x=1 && -eu awk 2>/dev/null $(pwd) ${HOME} "$@" echo x=1 /usr/bin -eu grep
+	export grep cd echo export sed printf
+		echo $(pwd) export cd printf -eu
+	/usr/bin echo echo x=1 then readonly then "$@" local awk
+	sed "$1" grep grep readonly sed && test $(pwd) export /usr/bin echo awk
+		x=1 printf "$1" 'quoted text' awk local export $(pwd) sed echo awk sed cd
+	readonly cd -eu then 'quoted text' && "$@" export then echo 'quoted text'
+	"$1" --verbose 2>/dev/null "$@" /usr/bin -eu
+	2>/dev/null && && x=1 ${HOME} --verbose && awk echo then echo ${HOME}
+	test sed cd && | local | --verbose && 'quoted text' 2>/dev/null
+	export local awk --verbose awk cd x=1 then echo 2>/dev/null
+grep && awk local done 'quoted text'
+then local then test readonly --verbose export /usr/bin "$@" -eu | $(pwd) $(pwd)
+export test && awk && /usr/bin ${HOME} local && --verbose
+	x=1 then 'quoted text' cd done cd "$@" grep done echo $(pwd)
+	cd readonly $(pwd) sed $(pwd) sed && sed test export readonly readonly | then
+'quoted text' | grep printf
+&& grep local awk then done | sed $(pwd) grep
+"$1" ${HOME} sed test local $(pwd) awk awk "$@" readonly then local ${HOME} "$1"
+		-eu 2>/dev/null -eu | && readonly "$@" test 2>/dev/null "$@" then
+		done $(pwd) awk "$1" done
+"$@" x=1 && cd && then readonly done ${HOME} cd grep local --verbose $(pwd)
+export -eu cd -eu $(pwd) 2>/dev/null --verbose $(pwd) done
+		readonly cd | "$@" awk | |
+	grep 2>/dev/null && x=1 2>/dev/null x=1 -eu printf export awk test
+		readonly 2>/dev/null --verbose local readonly sed "$1" $(pwd)
+	test local sed && export $(pwd) echo "$1" then "$1" 'quoted text'
+	'quoted text' grep ${HOME} $(pwd) test echo "$@" 'quoted text' export 2>/dev/null
+	| echo /usr/bin awk | sed ${HOME} export ${HOME}
+	'quoted text' awk 2>/dev/null $(pwd)
+grep "$1" ${HOME} test x=1 local "$1" /usr/bin ${HOME} echo grep grep
+		| -eu local 'quoted text' test -eu 2>/dev/null "$@" && test sed $(pwd)
+	--verbose printf readonly then
+		--verbose cd awk | | done cd export sed --verbose awk && local x=1
+	'quoted text' -eu /usr/bin grep 'quoted text'
+$(pwd) echo cd printf
+		"$1" local | "$1" done "$1" 'quoted text' sed x=1 && x=1 /usr/bin "$@"
+/usr/bin test --verbose awk echo test x=1 awk 'quoted text'
+		/usr/bin $(pwd) test echo grep cd grep printf --verbose "$@"
+	"$@" 2>/dev/null done | echo sed
+printf 'quoted text' --verbose x=1 grep awk | then
+	local sed cd awk $(pwd) grep "$@" -eu "$@" x=1 ${HOME} ${HOME} "$1" readonly
+	sed awk | awk ${HOME}
+		-eu export "$1" -eu ${HOME} --verbose
+	"$@" cd sed local grep then --verbose sed done test &&
+	echo awk && test printf grep 2>/dev/null "$@" printf -eu 'quoted text'
+		printf | cd 2>/dev/null "$@" && --verbose $(pwd) local
+	-eu readonly --verbose $(pwd) --verbose awk export
+&& && sed $(pwd) "$@" "$@" sed "$@" -eu
+	local printf done readonly -eu sed done $(pwd) 2>/dev/null printf &&
+${HOME} test done awk x=1 "$@"
+		local awk sed && then -eu
+printf printf then "$@" | local grep | cd && done
+"$1" "$@" local local "$@"
+		"$1" $(pwd) echo then sed grep awk export done cd "$1" awk test
+	then local done readonly test --verbose -eu ${HOME} test test
+	cd /usr/bin echo --verbose readonly export done 'quoted text' cd done | echo readonly
+-eu /usr/bin grep 2>/dev/null x=1 test export "$1" 'quoted text' local
+	awk cd --verbose x=1 test 'quoted text' -eu then $(pwd) -eu &&
+		sed x=1 x=1 local /usr/bin
+		cd grep x=1 done $(pwd) then printf export local done ${HOME} "$1"
+	local -eu && && $(pwd) x=1 test cd 'quoted text' "$@" sed
+&& x=1 test local printf local cd && local
+printf "$1" awk done | sed 'quoted text' &&
+'quoted text' && then printf
+	x=1 printf done export 'quoted text' x=1
+		'quoted text' 'quoted text' grep "$@" export && export
+	'quoted text' x=1 $(pwd)
+2>/dev/null then cd ${HOME} export then sed && local && "$1" done cd 2>/dev/null
+		-eu export grep ${HOME} sed test sed 'quoted text' grep grep --verbose printf
+		awk --verbose && --verbose test -eu
+	"$1" readonly sed awk export then sed | done | test echo | $(pwd) done
+	--verbose 2>/dev/null $(pwd) test -eu
+		x=1 echo echo "$@" printf printf readonly "$@" echo readonly -eu cd grep /usr/bin
+--verbose x=1 cd readonly $(pwd) done export readonly -eu "$@"
+		awk sed "$@" readonly sed sed printf $(pwd) 2>/dev/null
+		&& x=1 /usr/bin then x=1 2>/dev/null
+&& readonly test "$@" 2>/dev/null export ${HOME}
+&& grep sed done ${HOME} 2>/dev/null ${HOME} done then
+x=1 --verbose --verbose sed cd grep 'quoted text' then local test
+"$@" then && ${HOME} 2>/dev/null /usr/bin 2>/dev/null
+		--verbose /usr/bin local x=1 --verbose
+		local x=1 printf echo grep "$@"
+		${HOME} awk echo awk test readonly readonly grep
+		echo echo $(pwd) "$1" printf echo $(pwd) "$1" 'quoted text'
+	'quoted text' printf "$@" done
+	"$@" ${HOME} ${HOME} readonly 'quoted text' "$1" grep "$@"
+/usr/bin ${HOME} printf "$@" 'quoted text'
+	export readonly | grep export $(pwd) -eu printf grep local cd /usr/bin export
+done cd test 'quoted text' "$1" &&
+		printf "$@" echo local /usr/bin test --verbose readonly
+		awk local /usr/bin echo -eu then export 'quoted text'
+		awk x=1 then "$@" $(pwd) cd /usr/bin
+&& 2>/dev/null /usr/bin --verbose "$1" 'quoted text'
+		| /usr/bin /usr/bin "$@" echo printf cd printf 'quoted text' 2>/dev/null echo export
+	&& done done then /usr/bin x=1 test local awk awk local "$1" -eu test then
+	"$@" grep ${HOME} done echo "$1" -eu $(pwd) | $(pwd) test test awk ${HOME}
+"$@" ${HOME} test 'quoted text' readonly -eu /usr/bin
+		${HOME} sed 'quoted text' ${HOME} grep | awk readonly then awk test ${HOME}
+	export grep && $(pwd) ${HOME} test "$@" readonly
+		${HOME} test printf echo test grep export ${HOME} "$1" printf
+	2>/dev/null --verbose $(pwd) test x=1 grep test | "$@" /usr/bin local
+	&& --verbose 2>/dev/null then awk -eu sed |
+x=1 printf "$@" 'quoted text' printf --verbose
+grep $(pwd) "$1" readonly $(pwd) awk awk | printf done 'quoted text' export
+	"$1" "$@" -eu 2>/dev/null
+		${HOME} --verbose | sed test awk readonly readonly ${HOME} x=1 readonly -eu
+	"$@" awk printf 2>/dev/null sed 2>/dev/null sed then
+		done then -eu readonly "$@"
+	export test echo readonly awk grep readonly readonly "$@" test "$@" readonly local
+/usr/bin grep $(pwd) 'quoted text'
+	done -eu local -eu && "$@" echo /usr/bin
+		echo x=1 readonly sed /usr/bin export "$1" done awk 'quoted text'
+		grep && then done x=1 2>/dev/null sed --verbose x=1
+	${HOME} done printf x=1 2>/dev/null test ${HOME}
+		done grep | readonly test grep awk awk | export sed $(pwd) 'quoted text'
+		readonly printf ${HOME} sed
+		grep $(pwd) local ${HOME} | export grep readonly -eu echo then
+		cd grep --verbose readonly -eu 'quoted text' /usr/bin
+	"$1" cd grep x=1 | | local --verbose
+	export echo test "$1" export /usr/bin readonly x=1 grep grep --verbose ${HOME} cd
+test done awk "$@" sed readonly /usr/bin ${HOME}
+		--verbose --verbose && ${HOME} local readonly "$1" echo test cd "$1" grep
+'quoted text' && export "$@" readonly
+	test x=1 x=1 x=1 --verbose test then
+	${HOME} | ${HOME} --verbose "$1" grep
+	$(pwd) 'quoted text' x=1 readonly
+		local --verbose -eu grep ${HOME} "$@"
+		--verbose done sed export test printf awk | 'quoted text' echo -eu
+		2>/dev/null done -eu local done 'quoted text' |
+		$(pwd) export grep test printf
+	sed ${HOME} --verbose test cd local
+test -eu $(pwd) "$@" printf "$1" $(pwd) awk 'quoted text' echo done
+	x=1 x=1 x=1 2>/dev/null | 'quoted text' export echo then "$1" readonly echo grep
+	awk cd --verbose -eu readonly readonly local readonly
+| --verbose cd local cd
+		then done readonly | awk test && grep 'quoted text' then printf printf 'quoted text'
+&& 'quoted text' local | -eu
+readonly 2>/dev/null /usr/bin x=1
+	done 'quoted text' grep --verbose grep "$1" | "$@" printf 2>/dev/null -eu
+	printf test echo /usr/bin "$1" /usr/bin done --verbose awk
+	awk export grep awk 'quoted text' awk echo --verbose -eu printf /usr/bin
+		readonly awk test cd /usr/bin "$@" export local echo readonly
+	--verbose awk | -eu "$@" test x=1
+--verbose /usr/bin ${HOME} export export 2>/dev/null
+	2>/dev/null && sed local sed
+		readonly cd sed export then /usr/bin /usr/bin sed "$1" x=1 /usr/bin
+'quoted text' --verbose export readonly -eu ${HOME} 'quoted text'
+		then | awk then grep x=1 $(pwd) readonly echo export 'quoted text'
+local $(pwd) "$1" echo $(pwd) printf grep 'quoted text'
+echo grep -eu 'quoted text' echo
+grep local export "$@" grep readonly done "$@" export test $(pwd)
+		readonly -eu x=1 "$1" --verbose "$@" 'quoted text' --verbose 'quoted text'
+echo && -eu -eu grep grep local
+	readonly test then then test "$1" -eu x=1 sed $(pwd) "$@" && local export cd /usr/bin
+printf readonly grep export --verbose
+	export ${HOME} 'quoted text' cd $(pwd) echo | echo done
+	readonly done test echo x=1 printf --verbose "$@" local awk
+	echo printf | printf 'quoted text' test done
+		grep echo /usr/bin && -eu export test $(pwd) sed then export local
+'quoted text' "$1" /usr/bin done export grep --verbose x=1 -eu -eu -eu ${HOME} cd
+	--verbose "$1" sed then --verbose printf export local readonly && && | "$@"
+	then | then done echo done ${HOME}
+		readonly && echo x=1 echo then "$1" echo grep echo --verbose readonly
+"$1" -eu -eu ${HOME} ${HOME} x=1 test then done 'quoted text' sed test local |
+	-eu awk local readonly --verbose cd 2>/dev/null "$1"
+echo "$1" $(pwd) readonly test export /usr/bin -eu 2>/dev/null
+	printf grep sed | done grep
+		readonly | echo export echo then awk -eu readonly $(pwd)
+		x=1 then ${HOME} 'quoted text' ${HOME} echo awk awk "$1" 2>/dev/null
+echo echo then /usr/bin | sed $(pwd)
+	-eu done 2>/dev/null x=1 done 2>/dev/null ${HOME} local sed | grep 2>/dev/null
+test /usr/bin sed && "$1" echo echo "$@"
+		sed 2>/dev/null | local printf /usr/bin done local
+--verbose x=1 2>/dev/null
+		test local test printf $(pwd) "$@" -eu 'quoted text' done printf
+	${HOME} echo "$1" /usr/bin cd x=1 local echo
+done --verbose local && local then test 2>/dev/null x=1 awk then "$@" "$@"
+		${HOME} "$1" --verbose /usr/bin readonly export then done | done | 'quoted text'
+	done then test cd test "$@" export $(pwd) 2>/dev/null "$@"
+		"$1" x=1 "$1" printf then && test -eu | ${HOME} && ${HOME} grep
+		export x=1 | -eu --verbose
+done cd --verbose | sed echo 2>/dev/null "$1" sed "$1" done --verbose
+		local local | && /usr/bin 'quoted text' grep 2>/dev/null /usr/bin
+2>/dev/null --verbose sed done
+	${HOME} local export done --verbose grep "$1" --verbose echo echo echo
+/usr/bin export echo x=1 && ${HOME} ${HOME}
+		readonly && && /usr/bin export printf then echo printf grep
+		then x=1 2>/dev/null sed sed | 'quoted text'
+"$1" && && awk readonly "$1"
+2>/dev/null 'quoted text' x=1 -eu x=1 export
+		$(pwd) local 2>/dev/null $(pwd)
+		--verbose | echo export | then /usr/bin cd x=1 readonly /usr/bin /usr/bin
+	test -eu "$1" readonly 2>/dev/null --verbose
+${HOME} 2>/dev/null test
+"$1" && "$1" test cd /usr/bin awk export echo ${HOME}
+--verbose -eu grep test cd 2>/dev/null
+	2>/dev/null x=1 /usr/bin local then
+	readonly printf 2>/dev/null
+	| printf x=1 echo sed 'quoted text'
+		| 2>/dev/null grep then --verbose --verbose x=1 $(pwd)
+		| grep printf then readonly local $(pwd) printf "$@" -eu ${HOME}
+test then awk "$1" | x=1 "$@"
+done awk x=1 -eu readonly
+		2>/dev/null test 'quoted text' echo echo &&
+	"$1" cd 'quoted text' printf x=1 cd echo && cd "$@" /usr/bin
+		test "$@" && printf test printf "$@" printf local 2>/dev/null 'quoted text'
+		done export printf "$1" printf sed x=1
+	$(pwd) sed ${HOME} done local -eu x=1 2>/dev/null $(pwd)
+	$(pwd) local /usr/bin
+		echo ${HOME} && && x=1 | test test sed readonly printf
+		"$@" test && test printf done then then 'quoted text' $(pwd)
+		"$@" --verbose done ${HOME} awk ${HOME} awk 2>/dev/null
+	then local test "$1" 2>/dev/null
+		x=1 awk awk test /usr/bin $(pwd) printf echo sed 2>/dev/null "$1"
+/usr/bin --verbose | test
+		--verbose cd then sed "$@" export grep grep cd | --verbose cd
+--verbose --verbose "$@" sed x=1 "$@" printf
+--verbose sed cd -eu echo sed echo 'quoted text' /usr/bin done echo
+export export /usr/bin "$@" | | done sed then readonly && | $(pwd)
+	x=1 readonly 2>/dev/null sed ${HOME} 2>/dev/null
+local $(pwd) -eu $(pwd) 'quoted text' done echo x=1 readonly
+	"$@" | "$@" echo local && done 2>/dev/null echo echo -eu
+grep done grep | sed /usr/bin cd local sed echo printf
+done test then echo 'quoted text' sed "$1" printf
+done then x=1 cd 2>/dev/null --verbose 2>/dev/null --verbose local
+${HOME} $(pwd) printf -eu cd then
+		&& sed "$@" local x=1 export 'quoted text'
+		'quoted text' "$1" ${HOME} done cd test 'quoted text' x=1 sed
+done 2>/dev/null printf done awk sed echo local
+		/usr/bin done 2>/dev/null
+	done cd printf cd test grep /usr/bin
+		${HOME} done $(pwd) sed sed awk /usr/bin cd -eu
+	sed $(pwd) local awk readonly
+	/usr/bin grep x=1 2>/dev/null then echo readonly | 2>/dev/null
+		--verbose export done x=1 ${HOME}
+	2>/dev/null cd test /usr/bin
+done readonly x=1 awk test local cd awk ${HOME} 2>/dev/null readonly /usr/bin
+	grep && done 2>/dev/null "$@" /usr/bin echo local cd --verbose | awk readonly
+printf 2>/dev/null "$1" grep "$1" then -eu
+		&& cd 2>/dev/null ${HOME} cd && cd
+${HOME} sed printf then && readonly 'quoted text' readonly "$@" then cd local
+		done local done awk export cd -eu
+${HOME} awk && awk then done echo | | awk
+		/usr/bin then local printf 'quoted text' readonly ${HOME} -eu "$1" ${HOME}
+	sed 2>/dev/null -eu sed echo
+		local | "$@" 2>/dev/null readonly --verbose ${HOME} 'quoted text'
+		printf done sed 2>/dev/null export echo && export
+		awk "$@" && sed grep readonly "$1" test x=1
+--verbose /usr/bin awk done 2>/dev/null
+	sed -eu echo done test then printf awk -eu cd x=1
+grep 'quoted text' echo
+	echo readonly x=1 done readonly printf awk --verbose then
+		test -eu 2>/dev/null 2>/dev/null --verbose
+${HOME} readonly "$1" cd grep "$1" $(pwd) test done ${HOME}
+	test "$@" 2>/dev/null done
+		2>/dev/null echo x=1 | 2>/dev/null awk 'quoted text' ${HOME}
+	awk grep 'quoted text'
+"$@" export x=1 | && "$@" local export then --verbose
+	printf x=1 "$@" -eu $(pwd)
+&& cd 2>/dev/null "$1" cd grep readonly && && 2>/dev/null 'quoted text' grep
+		local --verbose $(pwd) grep echo sed "$@" "$@" then
+		$(pwd) echo 'quoted text' sed cd "$1" "$@" && 2>/dev/null
+		readonly local then $(pwd) done "$@" awk 2>/dev/null grep /usr/bin grep
+echo 'quoted text' $(pwd) grep echo echo done -eu --verbose
+		'quoted text' echo /usr/bin
+printf readonly 'quoted text' local | readonly | echo 2>/dev/null
+	"$1" x=1 awk /usr/bin /usr/bin
+	$(pwd) --verbose echo && | export $(pwd) test cd local | export
+	test printf cd awk /usr/bin "$@" done local then grep test sed echo
+test test test x=1 readonly grep /usr/bin /usr/bin
+	then echo x=1 readonly readonly
+		&& -eu && "$@" | test readonly
+		readonly ${HOME} /usr/bin "$1" ${HOME} $(pwd)
+	2>/dev/null cd && local x=1 && grep printf awk $(pwd) sed echo done
+	--verbose 2>/dev/null | | grep x=1 readonly --verbose
+readonly local $(pwd) x=1 export x=1
+		local 'quoted text' && local
+		then grep 2>/dev/null $(pwd) done /usr/bin
+	2>/dev/null --verbose done done
+awk 'quoted text' then | "$@" awk -eu cd printf local done readonly && readonly
+		2>/dev/null | 2>/dev/null && awk local "$@" test local
+	done grep readonly sed /usr/bin ${HOME} echo 2>/dev/null 2>/dev/null awk
+	printf done 2>/dev/null done then awk export grep done $(pwd)
+		/usr/bin test && local "$@" x=1 && x=1
+	'quoted text' test 'quoted text' export local /usr/bin
+"$@" | ${HOME} "$@" "$1" export
+		done "$@" export grep then local
+		sed export ${HOME} readonly $(pwd) ${HOME} --verbose
+grep local $(pwd) "$1" then cd | 2>/dev/null
+${HOME} "$@" && done then -eu && -eu
+		"$1" export sed export $(pwd) /usr/bin then x=1 'quoted text' cd
+&& then && local test /usr/bin "$1" readonly -eu --verbose test test
+	echo echo then local export ${HOME} echo 2>/dev/null
+'quoted text' 2>/dev/null echo sed export 'quoted text'
+	${HOME} x=1 && /usr/bin test 'quoted text'
+then echo ${HOME} && 2>/dev/null grep cd export "$1" --verbose
+printf $(pwd) && done cd echo then export
+		readonly && grep test awk "$1" local export
+		cd sed then local ${HOME} $(pwd) cd grep readonly
+		test printf ${HOME} ${HOME} ${HOME} grep
+	done done 'quoted text' x=1 echo
+		readonly ${HOME} $(pwd) --verbose 'quoted text' echo local 'quoted text'
+		/usr/bin awk test /usr/bin done awk test "$1" ${HOME} cd --verbose
+	awk printf && /usr/bin x=1 readonly awk --verbose printf
+	/usr/bin x=1 $(pwd) "$1" && test "$1" cd -eu -eu done --verbose $(pwd) 'quoted text'
+${HOME} sed /usr/bin "$1" echo test "$1" grep | done
+	printf printf grep 'quoted text' grep ${HOME} "$1" cd cd export | 'quoted text'
+	/usr/bin /usr/bin "$1" $(pwd) printf done | 'quoted text' cd
+		&& cd grep "$@" then -eu 'quoted text'
+"$@" grep ${HOME} "$1" | x=1 done export awk 'quoted text' sed | grep
+		awk 2>/dev/null cd | printf sed then
+echo "$1" --verbose test
+| -eu ${HOME} 2>/dev/null x=1 printf done awk grep && printf done
+	${HOME} --verbose local test "$@"
+done local x=1 readonly local -eu
+printf cd && export awk cd
+		sed grep cd 'quoted text' cd awk local "$@" export
+		-eu && export echo export then printf printf echo then | readonly test x=1
+$(pwd) "$@" done cd --verbose $(pwd) echo --verbose
+		cd sed sed then ${HOME} ${HOME} printf "$@" 2>/dev/null /usr/bin x=1
+		2>/dev/null done then grep 'quoted text'
+"$1" readonly grep done readonly
+$(pwd) "$@" ${HOME} printf export $(pwd)
+		echo done --verbose "$@" echo $(pwd) then
+		then local x=1 echo cd export $(pwd) cd then 2>/dev/null awk then local
+$(pwd) readonly 'quoted text' export && x=1 done local
+	/usr/bin ${HOME} then printf 'quoted text'
+	printf readonly sed && x=1 "$@" --verbose
+export --verbose test 2>/dev/null 'quoted text' then then "$@"
+&& printf local /usr/bin -eu -eu readonly local
+		awk sed local ${HOME} && x=1 done done --verbose
+	export export grep grep
+	&& local 'quoted text' x=1
+	-eu export /usr/bin test
+		--verbose --verbose $(pwd) echo done $(pwd)
+	-eu /usr/bin -eu 'quoted text' done awk 2>/dev/null done
+		printf 2>/dev/null $(pwd) "$1" && printf
+		2>/dev/null done && then /usr/bin export
+	local && readonly echo cd export ${HOME} echo export awk "$1" | printf printf
+done export cd then /usr/bin export && cd "$1" cd "$1"
+sed "$@" -eu --verbose 'quoted text' 2>/dev/null
+	then /usr/bin sed local then -eu -eu echo
+"$@" test echo --verbose | cd awk && -eu printf sed export 2>/dev/null grep
+		grep grep export export then local "$@" local awk x=1
+sed -eu export -eu then done echo 'quoted text' 'quoted text'
+	sed local printf && ${HOME} awk "$1" export
+		printf test cd grep && then done printf
+2>/dev/null 2>/dev/null "$@"
+	then && ${HOME} readonly -eu "$@" && --verbose export
+"$@" $(pwd) cd cd test x=1 'quoted text' awk grep cd readonly
+		readonly /usr/bin | readonly done export 'quoted text' echo sed "$1"
+2>/dev/null && test ${HOME} readonly "$1" cd grep | grep 2>/dev/null
+	grep cd readonly "$1" printf 'quoted text' 'quoted text'
+/usr/bin printf "$@" awk printf | grep 2>/dev/null
+		local /usr/bin /usr/bin $(pwd) x=1 test export $(pwd)
+	printf "$@" done readonly $(pwd) test --verbose $(pwd)
+${HOME} /usr/bin done
+--verbose x=1 ${HOME} sed --verbose cd /usr/bin && "$@" readonly printf "$@"
+&& $(pwd) 'quoted text' readonly -eu printf test 2>/dev/null done x=1 'quoted text'
+export test x=1 export /usr/bin cd 2>/dev/null x=1 grep --verbose local
+	x=1 local awk "$@" "$1" export local --verbose 'quoted text'
+		readonly $(pwd) x=1 then then sed
+	/usr/bin x=1 | -eu | awk cd --verbose -eu $(pwd) test local awk "$1" export sed
+$(pwd) awk grep readonly -eu 2>/dev/null
+		export then done done 'quoted text' export
+"$1" test cd | $(pwd) "$@" done -eu 'quoted text' | --verbose
+	local /usr/bin echo local test done export local done && grep export -eu awk
+		&& | /usr/bin readonly 'quoted text' done sed --verbose readonly
+		x=1 echo grep echo then readonly cd -eu
+	test printf export done export grep ${HOME} done "$1"
+'quoted text' x=1 done && --verbose ${HOME}
+		sed cd "$@" 'quoted text' 'quoted text' test $(pwd)
+/usr/bin echo grep -eu readonly done awk --verbose then $(pwd) printf
+sed /usr/bin done local grep 'quoted text' $(pwd)
+		done | ${HOME} local 2>/dev/null test ${HOME} test
+cd then "$1" x=1 'quoted text'
+$(pwd) 2>/dev/null ${HOME} "$1" local then
+	echo -eu grep --verbose local sed local grep x=1 local printf ${HOME}
+		readonly $(pwd) -eu export awk export $(pwd) grep echo awk then --verbose
+		"$1" ${HOME} "$@" -eu readonly sed "$@" ${HOME} done "$1" x=1 echo "$1" readonly
+	test x=1 export export x=1 x=1 ${HOME} local awk --verbose cd sed
+		cd done && readonly | --verbose awk && printf 2>/dev/null cd "$1" "$1"
+	$(pwd) awk --verbose | done awk then "$@" --verbose
+	2>/dev/null sed readonly printf 'quoted text' /usr/bin
+	then cd /usr/bin ${HOME} "$@"
+	&& 'quoted text' -eu then ${HOME} readonly local ${HOME} $(pwd) x=1
+		${HOME} local x=1 "$1" test readonly grep "$1"
+		then readonly x=1 printf $(pwd) x=1 sed x=1
+local echo $(pwd) cd export ${HOME}
+	readonly local 'quoted text' && ${HOME} x=1 awk awk && export
+"$1" local awk grep export grep
+	local && then 'quoted text'
+"$@" test printf echo then "$1" printf -eu $(pwd) |
+		&& x=1 local -eu --verbose cd $(pwd) readonly &&
+-eu "$@" | --verbose --verbose
+	grep ${HOME} cd sed printf "$1" sed /usr/bin 2>/dev/null 'quoted text' | then
+		--verbose cd readonly awk readonly ${HOME} /usr/bin "$@" grep readonly test
+x=1 echo test grep | awk
+	printf ${HOME} sed awk done awk /usr/bin
+	-eu | export printf test
+		$(pwd) x=1 readonly test then echo && /usr/bin
+		$(pwd) echo --verbose --verbose export printf ${HOME}
+--verbose "$@" export ${HOME} printf | sed $(pwd)
+	sed /usr/bin awk done /usr/bin 2>/dev/null "$@" then export | ${HOME} local local
+readonly readonly readonly $(pwd) grep $(pwd) test then cd then done test
+	test echo /usr/bin then -eu $(pwd)
+		grep -eu export && 'quoted text' /usr/bin done grep cd awk echo export
+sed then "$@" printf awk readonly /usr/bin then 'quoted text'
+		| echo ${HOME} 'quoted text' && | readonly
+grep echo done grep $(pwd) then -eu | readonly 2>/dev/null 'quoted text'
+sed awk then ${HOME} 2>/dev/null "$1" && readonly ${HOME}
+test ${HOME} && printf readonly sed sed export sed
+test grep -eu readonly test grep readonly --verbose done export
+| printf | awk test grep cd | 'quoted text' export && $(pwd) printf ${HOME}
+	| ${HOME} "$1" cd "$1" "$1" done x=1 sed test 'quoted text' 'quoted text'
+		sed "$1" && export 2>/dev/null printf "$@" | "$1"
+	2>/dev/null ${HOME} test sed "$1" && then cd local ${HOME} printf
+	"$@" readonly test 2>/dev/null grep
+	&& sed x=1 -eu then echo 2>/dev/null
+&& && awk awk $(pwd) local then
+		sed test ${HOME} then awk grep x=1 then test && cd "$@"
+		awk cd readonly done cd done x=1 "$1" && "$@" ${HOME}
+		'quoted text' printf -eu export /usr/bin --verbose done sed | awk export
+		x=1 sed cd sed done awk test --verbose
+	grep x=1 x=1 test done cd
+		local /usr/bin 2>/dev/null grep 2>/dev/null printf cd "$@" 2>/dev/null && /usr/bin
+export $(pwd) printf && /usr/bin then cd 2>/dev/null then sed done
+&& awk local then 2>/dev/null printf
+cd $(pwd) /usr/bin -eu "$1"
+		$(pwd) "$@" test | "$1" awk -eu export local "$1"
+2>/dev/null "$1" local cd $(pwd) echo echo sed && then
+	--verbose done cd grep readonly 2>/dev/null 'quoted text'
+cd "$1" x=1 test printf
+	| printf grep "$1" local 'quoted text' "$@" /usr/bin 2>/dev/null
+2>/dev/null "$@" "$@" sed grep 'quoted text' --verbose -eu
+		&& printf x=1 sed "$@" -eu ${HOME} "$@" ${HOME} local 'quoted text' 2>/dev/null
+	'quoted text' | 2>/dev/null awk $(pwd) then test local $(pwd) then /usr/bin
+		awk test && 'quoted text' -eu echo
+		${HOME} readonly printf readonly awk x=1 ${HOME} $(pwd) readonly "$@" done
+	grep /usr/bin awk "$@" x=1 x=1 awk $(pwd) $(pwd)
+2>/dev/null cd 'quoted text' local ${HOME} 2>/dev/null grep test
+	local local done 'quoted text' $(pwd) then x=1 x=1 cd done "$1"
+		| -eu awk grep test echo /usr/bin test "$1" local local
+sed sed && /usr/bin /usr/bin then "$1" /usr/bin
+${HOME} ${HOME} echo readonly echo "$@" "$@" sed echo then printf /usr/bin
+	grep printf test $(pwd) 'quoted text' echo | local ${HOME} -eu 2>/dev/null printf
+	${HOME} echo test 2>/dev/null && -eu x=1 echo ${HOME} "$@" &&
+$(pwd) 2>/dev/null grep | x=1 then ${HOME} ${HOME} printf /usr/bin 2>/dev/null
+		"$1" "$1" grep grep echo x=1 'quoted text' sed -eu sed cd x=1 test 'quoted text'
+readonly export test 'quoted text' ${HOME}
+		-eu then sed then -eu
+		| export sed echo -eu 'quoted text' done --verbose test -eu "$@" echo | x=1
+--verbose "$@" ${HOME} "$1" sed echo 'quoted text'
+	x=1 grep "$@" done | && printf x=1 | local 2>/dev/null
+		2>/dev/null grep cd echo ${HOME} grep test export "$1" "$@" /usr/bin $(pwd)
+"$1" cd 'quoted text' cd $(pwd)
+		test printf -eu test echo echo
+printf | echo 'quoted text' then --verbose "$1" /usr/bin
+"$@" printf "$1" && $(pwd) export echo grep "$@" done local -eu 'quoted text'
+		test | ${HOME} $(pwd) sed $(pwd) export
+	${HOME} local && export -eu local awk readonly printf /usr/bin "$1" --verbose x=1
+done $(pwd) printf grep ${HOME}
+x=1 "$1" ${HOME} grep "$@" export 2>/dev/null
+	local awk awk awk local local done test printf "$1" readonly export printf
+		then ${HOME} 2>/dev/null local "$@" local cd 'quoted text' done awk printf
+		awk cd test sed cd && "$1" 'quoted text' test
+		done test grep x=1 'quoted text' local x=1 echo && cd grep test
+		'quoted text' readonly then /usr/bin
+		$(pwd) /usr/bin cd done test
+x=1 ${HOME} "$@" -eu /usr/bin then "$@"
+		2>/dev/null cd grep /usr/bin done 2>/dev/null
+		"$1" then sed 'quoted text' local cd echo
+		local /usr/bin /usr/bin done "$1" "$1" grep awk 2>/dev/null printf
+		local printf ${HOME} 'quoted text' cd /usr/bin
+	2>/dev/null x=1 done $(pwd) "$@" sed then $(pwd) printf
+		x=1 2>/dev/null echo then "$@" && local local "$@" -eu done cd && --verbose
+	'quoted text' ${HOME} --verbose echo /usr/bin "$1" done "$@" x=1 'quoted text'
+		echo 2>/dev/null readonly 2>/dev/null done 2>/dev/null
+		--verbose "$@" sed x=1 grep readonly | -eu | printf grep |
+&& "$1" /usr/bin 2>/dev/null && sed -eu then then sed echo -eu |
+export 2>/dev/null done 2>/dev/null | cd ${HOME}
+		printf --verbose 'quoted text'
+		local "$@" && done | grep
+readonly echo 'quoted text' /usr/bin awk "$@" awk then test sed $(pwd) printf
+		echo printf "$1" "$@" 2>/dev/null grep export | "$1" 'quoted text' "$@" && cd $(pwd)
+		test grep "$1" ${HOME} awk $(pwd) 'quoted text' "$@" $(pwd) export sed
+		cd --verbose export local 'quoted text'
+		&& grep | echo printf $(pwd) sed "$@" grep done
+	done ${HOME} /usr/bin 'quoted text' /usr/bin sed then printf then
+	${HOME} sed ${HOME} sed | readonly sed grep && then x=1 local echo cd $(pwd)
+		test local 'quoted text' echo grep 'quoted text' printf cd x=1 'quoted text'
+		| sed /usr/bin done && done grep readonly local awk test readonly
+		x=1 2>/dev/null export grep x=1 --verbose echo done | awk
+		readonly | export $(pwd) --verbose
+		echo "$1" grep -eu cd 2>/dev/null sed -eu done "$@"
+	2>/dev/null then readonly 2>/dev/null
+	printf done then echo echo $(pwd)
+	/usr/bin local printf $(pwd) x=1 "$1" --verbose -eu sed "$1" grep --verbose
+		local local grep echo export /usr/bin "$1" readonly $(pwd) "$@"
+		then x=1 cd echo 2>/dev/null "$@"
+	/usr/bin x=1 test 'quoted text' | x=1 grep test
+		"$@" -eu done --verbose
+	/usr/bin "$1" && "$@" $(pwd) x=1 grep 2>/dev/null && 2>/dev/null 'quoted text'
+		"$@" done printf echo
+/usr/bin awk 'quoted text' echo
+		| sed 'quoted text' --verbose -eu --verbose printf
+		grep local x=1 -eu local 'quoted text' --verbose 'quoted text'
+test done sed && "$1" echo --verbose export 2>/dev/null sed local echo ${HOME}
+export -eu ${HOME} --verbose /usr/bin then
+"$1" "$1" 2>/dev/null --verbose done -eu /usr/bin $(pwd) sed ${HOME} done sed
+'quoted text' "$1" printf && sed ${HOME}
+sed -eu sed /usr/bin echo ${HOME} x=1 readonly printf echo 'quoted text'
+done --verbose test echo echo
+	${HOME} "$@" /usr/bin /usr/bin
+		local /usr/bin && readonly -eu grep then -eu local sed /usr/bin
+	then /usr/bin test awk awk grep export
+2>/dev/null --verbose echo /usr/bin grep local local export
+	&& grep --verbose echo ${HOME} echo echo test awk awk grep --verbose 2>/dev/null
+		'quoted text' | | /usr/bin /usr/bin
+2>/dev/null && $(pwd) sed 2>/dev/null done x=1 ${HOME} 'quoted text' /usr/bin
+		cd 'quoted text' 'quoted text' ${HOME} 'quoted text'
+	test $(pwd) printf | 'quoted text' echo --verbose 2>/dev/null 2>/dev/null
+		test ${HOME} sed done && | && 'quoted text' -eu readonly readonly
+		/usr/bin local then grep -eu test $(pwd) /usr/bin awk 'quoted text'
+"$@" /usr/bin ${HOME} then
+	"$@" cd --verbose echo then && echo
+done done sed awk export echo -eu && -eu "$@"
+/usr/bin ${HOME} awk local echo grep cd done cd "$1" 2>/dev/null
+		'quoted text' export | $(pwd) printf
+		'quoted text' x=1 awk sed export /usr/bin then sed && awk then done grep ${HOME}
+export sed "$@" sed printf local readonly
+		awk "$@" then cd -eu export /usr/bin "$@" then readonly
+		cd then "$1" "$@" | -eu /usr/bin printf -eu readonly echo -eu printf
+readonly ${HOME} 'quoted text' -eu x=1
+	test | test x=1 -eu --verbose echo && "$1" "$@" ${HOME} x=1 export "$@" cd done
+	awk | readonly ${HOME} 'quoted text' | 2>/dev/null "$@" "$1" sed
+	readonly --verbose local ${HOME} x=1 --verbose -eu && -eu test echo 2>/dev/null
+'quoted text' test sed echo export
+		'quoted text' -eu test "$@" echo test ${HOME} && | | $(pwd) export awk $(pwd) ${HOME}
+export 2>/dev/null && local sed && 2>/dev/null "$1" 2>/dev/null | "$@" cd x=1
+&& test then x=1 grep $(pwd) 2>/dev/null test && --verbose then -eu then
+		awk $(pwd) cd "$@" awk -eu echo "$@" sed $(pwd) | awk 'quoted text'
+local local -eu sed grep
+	${HOME} ${HOME} 'quoted text' printf --verbose | "$@"
+		x=1 ${HOME} ${HOME} -eu local 2>/dev/null echo
+	sed ${HOME} readonly "$1" printf sed "$@" "$1" 2>/dev/null
+	sed readonly /usr/bin sed done test 2>/dev/null awk cd then
+	local awk printf 'quoted text' cd
+	done "$1" export ${HOME} "$1" cd export /usr/bin x=1 printf -eu && readonly
+		"$1" && done awk ${HOME} x=1 readonly
+| grep awk 'quoted text'
+	printf 'quoted text' 'quoted text' "$@" readonly then
+cd --verbose grep 2>/dev/null sed x=1 $(pwd) echo sed done 2>/dev/null echo
+		then sed export then then readonly /usr/bin echo sed 2>/dev/null done then
+then x=1 'quoted text' && export --verbose
+	printf "$1" 'quoted text' /usr/bin readonly
+		then $(pwd) x=1 'quoted text' export
+		test $(pwd) -eu sed 'quoted text' 2>/dev/null --verbose
+	echo 'quoted text' 2>/dev/null 2>/dev/null awk "$1" awk done "$1" -eu local export
+	export | && ${HOME} awk then -eu "$1" 2>/dev/null local "$@"
+		sed export then awk echo
+		then $(pwd) $(pwd) awk test && 2>/dev/null
+echo awk 2>/dev/null ${HOME} $(pwd)
+sed "$@" 'quoted text'
+#include c115.sh
+	readonly x=1 echo | | sed grep test | 2>/dev/null |
+		test printf | test "$@" 'quoted text'
+then then local ${HOME} cd printf readonly sed x=1 | done /usr/bin printf 'quoted text'
+		"$@" done --verbose done
+"$1" $(pwd) cd local export test &&
+	printf 'quoted text' /usr/bin readonly test export
+	then export grep readonly && --verbose test awk -eu $(pwd) readonly grep
+"$@" --verbose done 'quoted text' readonly
+/usr/bin -eu awk -eu then printf x=1 echo $(pwd) echo -eu && /usr/bin
+		/usr/bin -eu cd "$@" --verbose then done -eu $(pwd) && --verbose then /usr/bin
+		"$1" printf test "$@" test then sed x=1 "$@" cd then | done done |
+	awk -eu --verbose && then ${HOME} && readonly done printf export $(pwd)
+	test /usr/bin export then echo
+	"$@" cd local ${HOME}
+awk readonly sed | readonly cd ${HOME} x=1 export $(pwd) | echo printf
+done 'quoted text' | printf then test readonly x=1 done readonly echo
+		| local $(pwd) export ${HOME} done echo | grep test -eu grep readonly
+2>/dev/null cd then 'quoted text'
+	local echo $(pwd) "$@" done test export
+	cd /usr/bin && --verbose "$@" local export -eu done grep grep 2>/dev/null --verbose
+	readonly -eu /usr/bin printf echo readonly then echo echo
+	-eu "$1" readonly sed awk
+readonly local 2>/dev/null
+&& test ${HOME} done $(pwd) && local echo export echo printf 'quoted text'
+		${HOME} -eu | && "$@" ${HOME} printf $(pwd) printf then grep
+		&& done done export /usr/bin "$1" sed 'quoted text'
+${HOME} printf "$@" test x=1 awk ${HOME} cd echo then -eu
+		--verbose /usr/bin done
+${HOME} x=1 --verbose | cd && grep | cd "$@" $(pwd)
+	"$1" x=1 x=1 done x=1 'quoted text' x=1 printf 'quoted text' grep
+	${HOME} "$@" 2>/dev/null $(pwd)
+		-eu cd /usr/bin -eu local ${HOME} cd -eu
+	x=1 "$1" printf echo grep --verbose x=1 2>/dev/null -eu awk cd
+	cd readonly 'quoted text' sed test 2>/dev/null done 'quoted text' x=1
+	export "$@" x=1 sed "$@" awk grep
+x=1 readonly awk 2>/dev/null x=1 grep -eu ${HOME} && 'quoted text'
+-eu echo awk "$1" | 'quoted text'
+awk "$@" | test local sed --verbose "$1" echo x=1 -eu awk
+	${HOME} awk readonly awk test --verbose echo sed grep grep then awk --verbose
+		export sed printf x=1 --verbose cd --verbose && cd readonly
+		readonly sed | done echo $(pwd) "$1" local /usr/bin /usr/bin test printf --verbose
+	done && cd echo done printf local "$1" "$@" sed then awk echo /usr/bin 'quoted text'
+echo "$@" done echo readonly export awk then ${HOME} -eu cd x=1 "$@"
+grep x=1 $(pwd) ${HOME} 2>/dev/null
+	"$1" grep 2>/dev/null --verbose awk
+		cd /usr/bin --verbose 2>/dev/null awk printf
+${HOME} test --verbose echo cd | 2>/dev/null awk
+| | readonly cd echo $(pwd) echo then done cd awk done test echo echo readonly
+/usr/bin ${HOME} x=1 2>/dev/null done printf &&
+test awk 2>/dev/null /usr/bin done echo export
+	grep 2>/dev/null -eu "$@" done grep /usr/bin done ${HOME} 2>/dev/null
+		2>/dev/null then readonly x=1 cd $(pwd) ${HOME}
+		2>/dev/null 'quoted text' awk local "$1" --verbose
+		$(pwd) x=1 x=1 'quoted text' awk done done
+		'quoted text' awk | | $(pwd) then local done export -eu grep
+	echo sed $(pwd) | sed --verbose printf
+'quoted text' 'quoted text' local grep "$1" printf echo
+		test grep 'quoted text' awk cd readonly "$1" | then "$1" -eu ${HOME} $(pwd)
+		'quoted text' x=1 /usr/bin 'quoted text' local local $(pwd)
+	awk && sed test | /usr/bin readonly "$1" 'quoted text' /usr/bin
+	export then printf export | local readonly "$1" $(pwd) && test ${HOME} --verbose
+		"$@" ${HOME} "$@" && printf | done --verbose 'quoted text'
+		$(pwd) /usr/bin sed "$@" 'quoted text'
+	test | test /usr/bin 'quoted text' -eu readonly 'quoted text'
+		x=1 'quoted text' grep local local then ${HOME} "$@" cd echo "$@" ${HOME} export
+then echo x=1 cd printf awk --verbose cd -eu
+		| --verbose | sed "$@" | grep | "$@"
+		$(pwd) printf "$@" x=1 2>/dev/null
+local 'quoted text' -eu local sed then printf grep 'quoted text'
+cd readonly -eu /usr/bin readonly sed x=1 local grep then -eu && grep cd
+/usr/bin 2>/dev/null sed cd export x=1
+		echo sed | cd -eu local cd /usr/bin x=1 $(pwd)
+	local test && test | --verbose sed "$@" cd cd readonly test ${HOME} test
+echo awk local $(pwd) local awk $(pwd) printf /usr/bin readonly export "$@" test
+		$(pwd) --verbose grep cd "$1" readonly
+	cd $(pwd) | local grep --verbose local -eu 2>/dev/null 2>/dev/null
+		x=1 grep printf | "$1"
+	grep && export ${HOME} $(pwd) sed sed then readonly grep
+	export echo printf ${HOME} then $(pwd)
+	echo -eu echo then /usr/bin sed $(pwd) "$1" awk x=1 export
+	/usr/bin test then -eu readonly readonly 2>/dev/null local then
+		echo awk --verbose 2>/dev/null readonly x=1 then
+		--verbose then done awk then | --verbose export /usr/bin && awk sed && "$@" --verbose
+		echo awk test readonly echo sed
+cd readonly printf cd 'quoted text' grep
+		"$@" 'quoted text' test -eu test "$@" grep
+	2>/dev/null grep | -eu then 2>/dev/null
+echo cd local local /usr/bin x=1 printf 'quoted text' awk done "$@"
+	&& "$@" sed export export done /usr/bin 2>/dev/null 'quoted text' local
+		x=1 test --verbose done awk --verbose readonly
+	then "$1" --verbose x=1 cd "$@" ${HOME}
+	-eu readonly "$@" /usr/bin awk test 2>/dev/null $(pwd)
+		/usr/bin --verbose --verbose 2>/dev/null export 'quoted text'
+	${HOME} ${HOME} ${HOME} sed export ${HOME} cd 'quoted text' "$@" ${HOME}
+	x=1 test then printf printf
+	test $(pwd) grep | /usr/bin | /usr/bin awk echo ${HOME} local grep done /usr/bin
+	${HOME} export local ${HOME} 'quoted text' echo --verbose sed $(pwd)
+2>/dev/null awk -eu echo "$@" printf done 2>/dev/null grep export
+		--verbose /usr/bin x=1 local 'quoted text' "$@" then | printf
+		${HOME} --verbose awk 'quoted text' "$1" "$1" export echo cd
+	&& 2>/dev/null 2>/dev/null grep grep ${HOME}
+	'quoted text' printf test 'quoted text' -eu done printf
+-eu test | echo done | readonly awk $(pwd) -eu /usr/bin
+		'quoted text' export --verbose awk readonly awk ${HOME}
+	x=1 sed 2>/dev/null "$@" && "$@" /usr/bin | then "$@" local sed then readonly
+		sed /usr/bin "$1" 'quoted text'
+&& then echo $(pwd) sed --verbose
+	$(pwd) then cd $(pwd) echo
+		--verbose printf /usr/bin export cd -eu
+		grep done -eu | | printf && then cd awk grep then done --verbose && $(pwd) then
+test 2>/dev/null then
+	/usr/bin 'quoted text' "$1" grep ${HOME} "$@"
+		test then local $(pwd) then ${HOME} x=1 sed 'quoted text' -eu
+x=1 done echo awk $(pwd) -eu awk awk x=1 ${HOME} done
+sed "$@" x=1 local ${HOME} "$@" "$1" $(pwd) then "$@" | && local export
+	grep ${HOME} local && "$@" && /usr/bin done $(pwd)
+		test grep --verbose export | awk /usr/bin echo -eu echo
+printf grep ${HOME} test 'quoted text' $(pwd) "$1" awk export printf && /usr/bin
+		cd $(pwd) export grep /usr/bin
+	2>/dev/null -eu 2>/dev/null --verbose done grep 'quoted text' ${HOME}
+$(pwd) ${HOME} awk grep 'quoted text'
+x=1 "$@" local | ${HOME} $(pwd) 'quoted text' $(pwd) sed && export
+x=1 grep x=1 2>/dev/null printf 'quoted text' done $(pwd) --verbose
+	printf -eu local cd "$@" local "$@" "$@" && | /usr/bin && test
+		2>/dev/null | | echo done && -eu --verbose x=1
+	-eu 'quoted text' 'quoted text' sed echo done cd 'quoted text' /usr/bin &&
+		export printf test ${HOME} echo sed 'quoted text' && ${HOME} && readonly
+	/usr/bin printf awk && "$1" local
+	"$@" then | grep 'quoted text' local echo --verbose /usr/bin "$1"
+export local ${HOME} readonly grep | readonly "$1"
+	readonly $(pwd) printf "$@" "$@" 'quoted text' then
+--verbose sed 2>/dev/null && ${HOME} readonly printf -eu $(pwd) 2>/dev/null
+'quoted text' /usr/bin $(pwd) /usr/bin "$@"
+	sed x=1 ${HOME} grep sed awk
+export awk printf printf 'quoted text' then ${HOME} x=1 2>/dev/null then
+	${HOME} sed done /usr/bin
+	$(pwd) test cd -eu readonly ${HOME} /usr/bin awk local grep sed 'quoted text'
+	"$1" 2>/dev/null --verbose test -eu cd "$1" cd --verbose echo
+		/usr/bin ${HOME} cd 2>/dev/null test grep | printf --verbose
+		2>/dev/null | 'quoted text' 'quoted text' x=1 grep
+		echo --verbose printf "$1" local -eu $(pwd) ${HOME} "$@"
+		2>/dev/null printf "$1" readonly x=1 "$@" -eu readonly test
+&& sed $(pwd) "$1" "$1" cd --verbose test /usr/bin -eu sed x=1 export &&
+	cd --verbose ${HOME} awk cd "$@" awk 2>/dev/null test cd local | done
+	echo 2>/dev/null grep | --verbose -eu 'quoted text'
+		echo /usr/bin awk sed | sed /usr/bin printf "$@"
+then --verbose /usr/bin printf test | /usr/bin local | x=1 test "$1"
+local cd printf "$@" $(pwd) cd --verbose "$1" ${HOME} cd export echo sed test then
+		grep 2>/dev/null x=1 "$1"
+	"$1" grep export done ${HOME} /usr/bin /usr/bin -eu awk
+	then awk readonly grep && awk
+	test x=1 done $(pwd) | cd ${HOME} | cd local awk echo "$@" awk test $(pwd)
+	'quoted text' x=1 sed x=1 $(pwd) "$1" local export x=1 printf sed | sed
+	readonly "$@" then test awk cd test x=1 $(pwd) | 'quoted text' test printf |
+	echo && && cd 'quoted text' $(pwd) awk cd "$1" echo grep 2>/dev/null /usr/bin
+		${HOME} --verbose local $(pwd) sed /usr/bin
+		printf --verbose "$1" done | | $(pwd) 2>/dev/null && "$1" done echo x=1
+		| | local cd 2>/dev/null then printf done && printf readonly printf "$1"
+		--verbose then echo --verbose
+		x=1 cd cd "$1" local "$@" && local done x=1 grep test
+		export | local export readonly export
+printf x=1 echo ${HOME} grep then | test "$@" done readonly $(pwd)
+		| ${HOME} 2>/dev/null test --verbose test local echo
+		${HOME} cd sed done local 2>/dev/null /usr/bin -eu --verbose
+	done x=1 local printf -eu --verbose
+		&& x=1 readonly | /usr/bin local
+	2>/dev/null readonly then grep printf grep export
+	2>/dev/null 2>/dev/null echo --verbose /usr/bin /usr/bin $(pwd) grep readonly $(pwd)
+	export "$@" done local
+		$(pwd) -eu /usr/bin && echo 'quoted text' printf readonly | printf done then
+sed --verbose grep echo echo printf test grep local then cd awk grep
+sed x=1 x=1 local --verbose done export | local test ${HOME} "$1" done /usr/bin
+done x=1 then readonly && 2>/dev/null 2>/dev/null "$@" echo -eu printf
+test awk $(pwd) cd test &&
+/usr/bin sed $(pwd) |
+		cd readonly --verbose echo done -eu cd test readonly --verbose readonly
+	sed && echo local done
+	x=1 && done -eu done export -eu
+	echo -eu sed ${HOME} "$@" "$@" grep x=1 /usr/bin 2>/dev/null && echo "$1" /usr/bin
+	$(pwd) cd "$@" "$1" grep ${HOME} echo export && && x=1 x=1 $(pwd)
+"$1" x=1 -eu 'quoted text' grep done | -eu done "$@" grep done grep cd done sed
+&& --verbose 'quoted text'
+grep 2>/dev/null grep test 2>/dev/null grep
+		${HOME} $(pwd) awk 2>/dev/null $(pwd)
+	"$@" sed grep sed cd "$@" "$1" /usr/bin awk /usr/bin ${HOME} "$1" readonly "$@"
+		--verbose readonly x=1 "$1" && 2>/dev/null awk "$@" grep
+done 2>/dev/null "$@"
+		readonly echo cd 'quoted text' printf $(pwd)
+'quoted text' x=1 $(pwd) sed -eu /usr/bin then cd
+local sed /usr/bin test export awk grep x=1 "$1"
+		"$@" $(pwd) export local echo $(pwd) $(pwd) test sed sed x=1 ${HOME} -eu echo
+		awk x=1 $(pwd) | grep grep then | then && --verbose ${HOME} printf cd
+readonly $(pwd) grep ${HOME} ${HOME} awk $(pwd)
+	readonly --verbose echo printf 2>/dev/null
+		grep done ${HOME} "$1" ${HOME}
+--verbose $(pwd) x=1 awk 2>/dev/null $(pwd) $(pwd)
+		local readonly $(pwd) --verbose 'quoted text'
+	| | x=1 $(pwd) -eu && $(pwd)
+"$@" --verbose cd "$1" local sed 2>/dev/null -eu && grep -eu echo awk test sed
+		| done x=1 -eu x=1 2>/dev/null then ${HOME} ${HOME}
+	cd grep --verbose "$@" cd local awk echo
+	awk readonly | ${HOME} x=1 "$1" cd $(pwd) done $(pwd)
+-eu awk done | /usr/bin ${HOME} test
+	printf test "$1" done "$@" cd awk --verbose "$@" x=1 && $(pwd) /usr/bin
+	x=1 "$@" local "$@" test local 2>/dev/null awk then -eu /usr/bin
+		&& 2>/dev/null local sed done local grep -eu export -eu awk cd grep
+		grep "$@" awk cd local 2>/dev/null then done 'quoted text' echo then 'quoted text'
+		x=1 readonly --verbose
+	${HOME} export test "$1" 'quoted text' grep test && echo test "$@" readonly
+		$(pwd) done /usr/bin awk echo 'quoted text' test
+		sed /usr/bin "$@" printf "$@"
+&& sed $(pwd) 2>/dev/null then local sed grep grep
+2>/dev/null cd grep 'quoted text' local -eu "$1" "$1" then /usr/bin
+		printf --verbose -eu printf x=1 | $(pwd)
+	$(pwd) && && "$1" x=1 done ${HOME}
+x=1 | --verbose readonly export done local
+	-eu $(pwd) test sed "$1" grep /usr/bin export then 'quoted text' "$@"
+x=1 x=1 x=1 2>/dev/null printf
+cd 'quoted text' awk awk ${HOME} x=1 "$@" -eu x=1 --verbose -eu
+-eu export 2>/dev/null printf cd $(pwd) $(pwd) sed printf
+| $(pwd) local 2>/dev/null
+	grep printf -eu done echo export echo x=1 done printf &&
+readonly test x=1 test && local && cd /usr/bin cd echo -eu "$1" 2>/dev/null
+	--verbose | $(pwd) test | 'quoted text' then x=1 cd | ${HOME}
+	sed printf 2>/dev/null readonly
+	2>/dev/null cd then readonly cd awk --verbose readonly readonly printf local "$@"
+	export then sed grep then local export --verbose ${HOME} x=1 local x=1
+"$1" "$1" --verbose && test "$1" $(pwd) x=1 cd grep cd echo $(pwd) x=1 | local
+	/usr/bin echo done "$1" local local --verbose "$@"
+		local then grep readonly cd $(pwd) local
+		echo test grep | $(pwd) $(pwd) local $(pwd)
+	2>/dev/null ${HOME} then
+		then $(pwd) -eu $(pwd) && grep "$@" export "$@" done echo x=1 grep export
+	echo echo 2>/dev/null && -eu 'quoted text' grep /usr/bin $(pwd)
+	local $(pwd) "$@" --verbose sed 'quoted text' sed /usr/bin done x=1 awk done /usr/bin
+		test "$1" cd grep then | sed | $(pwd) readonly
+echo x=1 x=1 grep sed test awk | x=1 test -eu then test ${HOME}
+2>/dev/null -eu printf | grep awk echo
+	/usr/bin readonly local readonly && test printf && /usr/bin cd 'quoted text'
+cd sed /usr/bin | && /usr/bin --verbose printf | echo
+$(pwd) test "$@" awk | grep cd readonly
+	readonly $(pwd) --verbose done --verbose grep --verbose
+then && sed 2>/dev/null cd test export grep 'quoted text' grep $(pwd) -eu sed
+		${HOME} --verbose --verbose done ${HOME} &&
+		cd && && $(pwd) awk "$1" "$@" export printf done sed
+	printf --verbose 'quoted text'
+	'quoted text' then local | | 2>/dev/null
+sed grep export -eu "$1" "$@" $(pwd) ${HOME}
+2>/dev/null "$1" 'quoted text' echo 2>/dev/null
+		readonly "$1" 'quoted text' test
+local && cd /usr/bin echo 'quoted text' $(pwd)
+	readonly printf export sed "$@" -eu 'quoted text' test readonly /usr/bin "$@"
+	test done printf export | export $(pwd) echo x=1 /usr/bin "$@" readonly
+		grep printf 'quoted text' "$@" export "$1" && done x=1 local x=1 | "$@" "$@"
+		cd x=1 | sed -eu 'quoted text'
+sed $(pwd) echo "$@" done echo ${HOME} awk export
+		'quoted text' /usr/bin /usr/bin
+		test export x=1 done then
+		/usr/bin $(pwd) 'quoted text'
+	readonly /usr/bin "$@" "$1" readonly
+	then echo grep export /usr/bin export
+	'quoted text' && "$1" -eu export ${HOME}
+		export 'quoted text' "$1" --verbose cd
+-eu x=1 x=1 grep readonly readonly -eu echo done "$@" then "$@" cd "$@" grep -eu
+	echo --verbose 'quoted text' | --verbose && printf | --verbose readonly && test
+awk sed 'quoted text' 2>/dev/null "$1" x=1 && test cd "$1" awk test
+	echo awk awk local -eu -eu then -eu awk -eu export local export
+then && $(pwd) export test
+		export readonly && echo | printf | "$1" cd grep readonly -eu awk echo &&
+echo x=1 test export grep export 2>/dev/null sed --verbose
+	test grep | | ${HOME} ${HOME} local echo export 'quoted text' local "$@" 'quoted text'
+'quoted text' local "$@" | local awk then local "$@" done grep && /usr/bin
+	export then && && 'quoted text'
+		local export local sed x=1 test "$@" --verbose export /usr/bin test 'quoted text'
+		-eu readonly then --verbose "$@" awk -eu
+	echo grep 'quoted text' then printf printf test local
+local | local "$1" 2>/dev/null "$1" x=1 $(pwd) 2>/dev/null grep /usr/bin readonly
+	done && ${HOME} ${HOME} --verbose test x=1 done -eu readonly
+		-eu 2>/dev/null $(pwd)
+	test printf grep -eu ${HOME} sed -eu local "$1" test
+	test sed ${HOME} local x=1 awk cd
+		readonly sed test ${HOME} sed ${HOME} &&
+		x=1 "$1" echo 'quoted text' $(pwd) 'quoted text'
+cd local readonly test ${HOME} local done then local /usr/bin
+	test test -eu "$1" "$@" cd 'quoted text' "$1" echo $(pwd)
+	test echo 'quoted text' awk local cd echo 2>/dev/null 'quoted text'
+		"$@" $(pwd) && /usr/bin 2>/dev/null
+export ${HOME} /usr/bin && $(pwd) echo --verbose
+	sed local ${HOME} grep readonly /usr/bin "$1" awk | sed -eu 2>/dev/null
+	awk "$1" local test echo cd readonly ${HOME} local awk "$1"
+printf grep "$1" && local done 2>/dev/null test cd "$1" grep 2>/dev/null
+	x=1 /usr/bin grep "$@" test echo export -eu sed && export && $(pwd)
+	test test done echo done "$1" readonly /usr/bin
+	| -eu | done "$1" printf awk -eu readonly "$@" ${HOME} | printf sed 2>/dev/null
+	"$1" test --verbose "$@" awk "$@" --verbose | export
+	grep ${HOME} 2>/dev/null 2>/dev/null
+		"$1" sed export test /usr/bin local ${HOME} then
+/usr/bin readonly ${HOME} 2>/dev/null
+export "$@" "$1" -eu awk "$1" local && done printf cd sed grep x=1 done
+done echo cd then test awk | && "$1" done "$@"
+	grep test readonly /usr/bin "$@" readonly awk &&
+	$(pwd) 'quoted text' -eu local cd
+	export $(pwd) --verbose /usr/bin test
+		test done ${HOME} /usr/bin | 'quoted text' grep echo test readonly && 'quoted text'
+		cd 2>/dev/null local cd | test 'quoted text' export then 2>/dev/null /usr/bin
+-eu echo then sed /usr/bin cd 2>/dev/null | echo test "$1" 2>/dev/null 2>/dev/null
+	${HOME} "$@" -eu echo then then then $(pwd) awk "$@" /usr/bin "$@"
+	export grep export 2>/dev/null grep x=1 | grep --verbose printf then
+--verbose 2>/dev/null --verbose /usr/bin ${HOME} && local /usr/bin done
+		| --verbose then printf $(pwd) /usr/bin cd /usr/bin x=1 && /usr/bin
+		sed grep export -eu /usr/bin
+	sed "$@" sed 2>/dev/null echo test grep /usr/bin | x=1 echo
+	export test 'quoted text' printf sed
+	--verbose ${HOME} /usr/bin
+printf awk awk local ${HOME} "$@" awk | | ${HOME}
+		echo x=1 $(pwd) 'quoted text' 'quoted text' awk echo awk
+/usr/bin awk test 2>/dev/null awk
+	${HOME} test && "$1" cd | /usr/bin && && awk 2>/dev/null
+	then export $(pwd) cd export
+	test 2>/dev/null echo export 2>/dev/null 'quoted text' done -eu ${HOME} x=1
+		grep --verbose cd export
+awk awk -eu /usr/bin | "$@" -eu done awk | | "$1" done
+readonly 'quoted text' $(pwd) echo x=1 grep grep then done "$@" sed grep ${HOME}
+	cd $(pwd) local x=1 test
+		test echo --verbose cd x=1 2>/dev/null && 'quoted text' -eu test
+	&& awk x=1 readonly done --verbose 2>/dev/null 2>/dev/null 2>/dev/null
+	grep sed | test grep done /usr/bin ${HOME} printf printf local cd
+'quoted text' then "$1" echo && 'quoted text' export cd echo then
+-eu x=1 awk $(pwd) printf then printf export | ${HOME}
+	printf echo grep ${HOME} readonly "$1" 2>/dev/null grep cd 'quoted text'
+cd done test 'quoted text' -eu
+	echo cd test local echo printf "$@" "$@" local export -eu x=1 x=1 echo sed
+	readonly echo /usr/bin test /usr/bin $(pwd) test export
+/usr/bin cd then 2>/dev/null then done ${HOME} done export
+printf -eu sed /usr/bin test "$1" 'quoted text' "$1" done
+		--verbose && awk --verbose
+		'quoted text' done cd local --verbose
+	2>/dev/null 'quoted text' test --verbose printf
+		'quoted text' 'quoted text' echo 'quoted text' ${HOME} printf then echo
+	/usr/bin local echo -eu "$@" echo sed /usr/bin awk
+"$1" echo --verbose 2>/dev/null
+	then cd "$1" cd /usr/bin /usr/bin
+		done cd && grep 2>/dev/null local local | export test then "$1" test echo
+&& export x=1 "$1" 2>/dev/null test
+	export $(pwd) ${HOME} $(pwd) 'quoted text' "$1" test then local awk /usr/bin
+echo "$1" "$@" -eu printf && cd cd then "$1" awk --verbose cd && test /usr/bin
+local | echo local export && 'quoted text' awk -eu export | --verbose
+		| | | | /usr/bin /usr/bin sed test -eu
+		test "$1" /usr/bin local printf $(pwd) | &&
+	cd -eu sed then 'quoted text' readonly "$@" readonly "$@" done test cd
+		| -eu 2>/dev/null done readonly test readonly grep 2>/dev/null then
+${HOME} echo done done && grep "$@" local grep cd --verbose local $(pwd)
+	readonly "$1" /usr/bin 2>/dev/null --verbose
+		-eu test "$1" "$1" 2>/dev/null "$@" && /usr/bin then /usr/bin
+${HOME} then | cd "$1" cd export | sed cd 'quoted text'
+	"$1" /usr/bin export 2>/dev/null 'quoted text' /usr/bin
+		readonly done readonly 'quoted text'
+	${HOME} awk then local 2>/dev/null readonly ${HOME} local -eu --verbose /usr/bin
+done ${HOME} cd && /usr/bin ${HOME}
+export echo export local /usr/bin -eu printf -eu
+	${HOME} local export ${HOME} done done then echo local 'quoted text' $(pwd)
+		/usr/bin then -eu grep awk readonly
+		'quoted text' && "$@" 2>/dev/null done awk
+local /usr/bin "$@" done then echo awk /usr/bin 2>/dev/null then awk
+	then "$@" printf 'quoted text' --verbose echo grep 2>/dev/null
+test done x=1 cd ${HOME} grep | 2>/dev/null test x=1 | -eu x=1 'quoted text' /usr/bin
+	'quoted text' x=1 readonly then cd then grep 2>/dev/null
+		readonly 'quoted text' cd
+		export 2>/dev/null export
+	echo /usr/bin /usr/bin echo ${HOME} -eu readonly awk then "$@" "$1" grep export
+		${HOME} readonly "$1" --verbose then x=1 'quoted text' done | | local
+grep | -eu awk && | local local awk x=1 && -eu $(pwd) sed | echo grep echo 'quoted text'
+--verbose "$@" -eu awk local "$1" ${HOME} done 'quoted text'
+test echo then $(pwd) --verbose "$@" local x=1 2>/dev/null
+	"$1" export -eu "$1" awk "$1" "$@" then -eu
+	then | echo 'quoted text'
+	readonly ${HOME} test export
+${HOME} | | export awk local ${HOME} $(pwd) then sed 2>/dev/null
+		| local x=1 -eu x=1 then test cd printf "$@" 2>/dev/null && sed
+	export test 2>/dev/null echo --verbose
+'quoted text' readonly printf "$1" && local echo printf export && x=1 -eu
+	-eu /usr/bin $(pwd) local local ${HOME} ${HOME}
+	cd local 'quoted text' awk awk ${HOME} 2>/dev/null x=1 ${HOME} readonly
+export export readonly
+	done printf test "$@" 2>/dev/null grep 2>/dev/null
+--verbose 'quoted text' grep ${HOME} ${HOME} "$1" 2>/dev/null x=1 "$@"
+/usr/bin echo "$@" awk echo done test
+	$(pwd) awk export 2>/dev/null
+done "$@" printf "$@" readonly
+"$@" $(pwd) awk test -eu sed | cd echo 2>/dev/null
+		"$1" -eu | export "$@" /usr/bin test grep ${HOME}
+	sed 'quoted text' --verbose
+echo readonly /usr/bin test --verbose x=1
+	done --verbose x=1 grep awk
+awk x=1 | $(pwd) local /usr/bin ${HOME} | cd ${HOME} echo awk awk --verbose
+	"$1" --verbose "$1" readonly done then /usr/bin
+sed 2>/dev/null awk | 'quoted text' ${HOME} 2>/dev/null cd 'quoted text'
+	echo cd done 2>/dev/null $(pwd) sed | 'quoted text' echo 2>/dev/null
+printf x=1 "$1" "$1" grep | 2>/dev/null readonly done export
+readonly && x=1 local grep ${HOME} | /usr/bin export "$1" local done 'quoted text'
+	printf 'quoted text' test
+	"$@" awk then grep ${HOME} 'quoted text' sed cd
+		readonly 2>/dev/null /usr/bin sed grep --verbose awk printf test 2>/dev/null
+done local /usr/bin 'quoted text' ${HOME} 'quoted text' && cd
+	sed ${HOME} "$1" local "$@" printf | ${HOME} ${HOME} done --verbose
+"$1" x=1 x=1 test && x=1 2>/dev/null "$1" done 'quoted text'
+${HOME} -eu "$1" export /usr/bin
+	cd readonly /usr/bin x=1 printf
+&& /usr/bin export echo sed $(pwd) && local local "$1"
+"$1" $(pwd) x=1 -eu x=1 test $(pwd) then printf ${HOME} awk -eu local
+	echo /usr/bin 'quoted text' -eu /usr/bin sed cd test
+		cd | "$@" readonly --verbose local readonly echo "$1" done test
+	-eu ${HOME} "$1" cd grep done 'quoted text'
+local && readonly test ${HOME} printf export --verbose awk 'quoted text' x=1 local
+sed -eu x=1 awk 2>/dev/null readonly test then then awk 2>/dev/null export |
+		export readonly "$1" 'quoted text'
+done -eu readonly 'quoted text' awk export --verbose 'quoted text' x=1 'quoted text'
+test test grep ${HOME}
+"$@" -eu done --verbose /usr/bin
+test 'quoted text' ${HOME} then local then sed x=1 2>/dev/null $(pwd)
+cd export grep "$@" 'quoted text' sed $(pwd) sed --verbose
+		export ${HOME} printf sed "$@" then 2>/dev/null
+		done then done 2>/dev/null /usr/bin
+		grep local readonly -eu readonly test echo -eu test "$@"
+${HOME} 'quoted text' cd readonly "$@" local grep ${HOME}
+	x=1 -eu grep /usr/bin $(pwd) "$1" -eu local && "$@"
+		&& 'quoted text' -eu "$1" local done awk cd
+		2>/dev/null awk $(pwd) export | ${HOME}
+printf export $(pwd) readonly -eu | $(pwd) -eu --verbose
+export 'quoted text' --verbose --verbose "$1"
+		then grep grep readonly sed cd 2>/dev/null && ${HOME}
+	done local --verbose ${HOME} echo
+	"$1" local -eu echo sed echo readonly echo test "$1" readonly echo
+	&& $(pwd) 'quoted text' done | printf grep test -eu ${HOME} test local
+2>/dev/null cd echo local -eu ${HOME}
+grep "$1" ${HOME} readonly x=1 -eu local
+	| --verbose $(pwd) then
+		then cd done 'quoted text' "$@" done readonly sed echo 'quoted text'
+	printf --verbose "$1" x=1
+		"$@" "$@" then readonly sed $(pwd) export test done
+sed "$@" cd then --verbose $(pwd) cd sed | /usr/bin
+	2>/dev/null "$@" "$@" x=1 done x=1 --verbose sed && echo
+	echo test awk export && test awk local 'quoted text' $(pwd) "$1" printf cd $(pwd)
+	'quoted text' awk then $(pwd) 2>/dev/null ${HOME} echo $(pwd) then
+		readonly local 2>/dev/null printf 2>/dev/null ${HOME} done && grep
+	2>/dev/null done | done done "$@" grep x=1 done
+grep /usr/bin grep awk grep sed cd local 2>/dev/null $(pwd) ${HOME} local
+export -eu x=1 | grep printf x=1 'quoted text' "$1"
+		export x=1 echo "$@" then cd 'quoted text' printf export "$1" | "$@" -eu
+	then $(pwd) --verbose ${HOME} 'quoted text' && then then grep | "$1"
+	readonly x=1 ${HOME} grep x=1
+-eu then awk done 2>/dev/null --verbose -eu ${HOME}
+test grep x=1 done then sed cd
+cd $(pwd) then export then "$@" done readonly local &&
+	2>/dev/null ${HOME} --verbose then $(pwd) && -eu cd && printf 'quoted text'
+		/usr/bin /usr/bin cd cd printf -eu && test 2>/dev/null readonly /usr/bin export
+--verbose x=1 sed 2>/dev/null awk "$@" test | -eu printf 2>/dev/null
+x=1 export done local done grep cd "$1" sed x=1 readonly test -eu && "$@"
+	cd --verbose test export | ${HOME}
+&& local printf cd local then 'quoted text'
+| readonly 'quoted text' x=1 --verbose
+	done test ${HOME} 2>/dev/null test x=1 "$1" ${HOME} $(pwd) done
+test --verbose printf echo $(pwd) $(pwd) && done $(pwd)
+"$1" done then "$@" -eu "$1" then --verbose done grep grep
+		x=1 && 2>/dev/null echo grep | "$1" 2>/dev/null | test -eu $(pwd) x=1 then
+"$@" local grep test 'quoted text' cd grep "$@" done ${HOME} $(pwd) local
+	done && cd cd cd "$@" grep export $(pwd)
+"$@" export export "$@" $(pwd)
+	echo cd x=1 2>/dev/null test
+/usr/bin grep /usr/bin $(pwd) 2>/dev/null awk
+${HOME} then local test ${HOME} 2>/dev/null
+		"$1" 2>/dev/null cd | sed then then grep printf sed readonly $(pwd) readonly 'quoted text'
+&& /usr/bin $(pwd) then ${HOME} cd 'quoted text' then awk "$1" x=1 && --verbose
+	then "$1" | sed awk printf -eu
+test readonly ${HOME} done done $(pwd) done done awk export echo then test --verbose
+	done "$1" ${HOME} --verbose "$@" | /usr/bin -eu readonly awk ${HOME} x=1 $(pwd)
+	readonly ${HOME} $(pwd) "$1" 2>/dev/null grep 2>/dev/null
+	"$@" printf export "$@" $(pwd)
+		then local /usr/bin --verbose /usr/bin 2>/dev/null
+		local readonly "$@" /usr/bin sed
+		awk test export printf grep -eu readonly "$1" sed "$@" awk && $(pwd)
+		${HOME} "$1" grep grep
+		test ${HOME} then cd then x=1 local export 'quoted text'
+	sed export readonly x=1 x=1 cd | sed --verbose
+		2>/dev/null test export printf cd x=1 "$@" "$@" x=1 export
+awk | ${HOME} test done "$@" | then echo sed | grep x=1 echo | 'quoted text'
+	done export then test awk $(pwd) 2>/dev/null 'quoted text' printf
+		done awk readonly "$@" awk
+	local x=1 local ${HOME} ${HOME} export -eu x=1 grep
+		2>/dev/null grep printf done 2>/dev/null sed --verbose && && test 2>/dev/null readonly
+awk --verbose cd sed export readonly 'quoted text' printf "$1" echo cd grep
+"$1" 'quoted text' x=1 "$1" done grep printf /usr/bin --verbose done cd | 2>/dev/null
+		cd test ${HOME} ${HOME} "$1" printf ${HOME} grep test printf
+		/usr/bin $(pwd) /usr/bin x=1 printf
+/usr/bin -eu printf grep then test $(pwd)
+local test ${HOME} -eu echo sed printf 2>/dev/null local | export done readonly
+x=1 awk export && local x=1
+sed --verbose "$1" export "$@"
+	2>/dev/null printf | $(pwd) 'quoted text'
+	export x=1 "$@" x=1 then
+	-eu readonly | "$1" $(pwd) "$1" sed /usr/bin
+	-eu done 2>/dev/null cd then export readonly
+		echo done done done /usr/bin awk
+		/usr/bin local 2>/dev/null && test sed export local awk
+grep sed /usr/bin && 'quoted text'
+	"$1" /usr/bin echo -eu done
+	echo awk grep -eu x=1 $(pwd) x=1 | ${HOME} $(pwd) "$1" | local /usr/bin
+	echo awk printf && then sed sed
+2>/dev/null done "$1" export printf done
+test printf "$1" 2>/dev/null "$@" printf local -eu "$@" 2>/dev/null --verbose
+	local sed printf x=1 2>/dev/null ${HOME} then awk export "$@" sed --verbose
+		x=1 "$1" done cd --verbose
+grep cd ${HOME} readonly -eu test /usr/bin
+$(pwd) "$@" local readonly $(pwd) grep test 'quoted text' 2>/dev/null
+		printf then printf echo echo awk sed -eu -eu echo
+	echo grep ${HOME} local ${HOME} cd sed /usr/bin /usr/bin && grep grep awk --verbose
+		printf grep && export awk -eu
+readonly "$@" "$@" cd "$1" && 2>/dev/null echo --verbose
+	-eu cd "$1" "$1" 2>/dev/null $(pwd) cd "$1"
+	test --verbose cd printf
+		sed done printf awk grep
+		'quoted text' x=1 echo readonly | export "$@" export | grep sed -eu "$1"
+		${HOME} && x=1 cd echo readonly "$1" $(pwd) /usr/bin sed 'quoted text' x=1
+		done export readonly grep printf awk | done -eu test then
+	'quoted text' echo readonly echo local ${HOME} $(pwd)
+	then local --verbose echo done printf grep x=1 --verbose awk
+		sed readonly test then echo local | test 2>/dev/null test
+cd export export cd then done -eu awk 'quoted text' 2>/dev/null
+	readonly done -eu -eu --verbose awk test grep then sed
+	${HOME} ${HOME} test local $(pwd) export echo "$@" x=1 cd | "$@"
+		cd export export cd 'quoted text' test
+	echo export test readonly $(pwd) cd local x=1
+then $(pwd) then cd local --verbose
+	awk echo ${HOME} | "$@" -eu printf test printf 'quoted text' /usr/bin 'quoted text'
+echo x=1 2>/dev/null "$1" /usr/bin
+		done echo then awk "$1" readonly -eu --verbose
+local echo /usr/bin && done test then grep "$1" test sed ${HOME} grep
+x=1 'quoted text' 'quoted text' /usr/bin cd export x=1 awk echo --verbose 'quoted text'
+	${HOME} ${HOME} cd "$1" done && ${HOME} 2>/dev/null
+		--verbose sed done test ${HOME}
+		then test --verbose | done x=1 | printf test x=1 cd grep --verbose test ${HOME}
+		sed export "$@" test -eu && $(pwd) "$@" sed x=1 printf grep | "$@" awk
+		2>/dev/null ${HOME} cd
+		then ${HOME} grep "$1" then | cd test "$1" local sed | sed then export ${HOME}
+	x=1 export --verbose "$1" /usr/bin /usr/bin
+export sed --verbose awk cd done $(pwd) grep echo then 'quoted text'
+${HOME} awk "$@" sed done
+		'quoted text' cd test echo printf /usr/bin 'quoted text' test ${HOME} test echo
+/usr/bin echo -eu sed x=1 --verbose && export test
+sed awk 'quoted text' 'quoted text'
+	then then /usr/bin -eu local | -eu sed export
+	readonly ${HOME} awk /usr/bin done export ${HOME} /usr/bin grep cd test
+cd $(pwd) readonly local readonly cd awk
+"$1" | --verbose grep local $(pwd) grep --verbose then readonly x=1 local
+	${HOME} test export then printf && test "$@"
+local awk "$@" $(pwd) then local "$@" sed then cd sed awk -eu | -eu x=1 /usr/bin
+sed "$@" test ${HOME} 2>/dev/null then
+		sed /usr/bin local then awk ${HOME} export /usr/bin
+		"$1" local printf cd cd test
+		printf 2>/dev/null grep done
+		| /usr/bin done /usr/bin | 'quoted text' sed 2>/dev/null "$@" x=1
+		local awk export -eu /usr/bin -eu && echo
+	test awk | "$@" sed "$@" done 2>/dev/null
+		&& && x=1 x=1 export grep 'quoted text'
+done "$1" export --verbose | done /usr/bin local
+		grep cd cd "$@" -eu readonly awk export
+	readonly done | --verbose local $(pwd) then
+	'quoted text' export export test test ${HOME} grep done local echo
+2>/dev/null done -eu 'quoted text'
+	echo && "$@" /usr/bin /usr/bin 2>/dev/null 2>/dev/null
+$(pwd) x=1 readonly && printf awk echo export local done printf ${HOME} --verbose
+	$(pwd) "$@" /usr/bin then grep 'quoted text' awk "$@" done sed ${HOME}
+&& readonly "$@" sed 2>/dev/null
+		2>/dev/null done 'quoted text' /usr/bin
+		"$1" grep echo && local "$@" /usr/bin && -eu | --verbose x=1 /usr/bin
+cd local /usr/bin "$1" &&
+	2>/dev/null && 'quoted text' readonly grep export 'quoted text'
+	awk echo x=1 "$@" grep && local ${HOME} --verbose
+-eu export local "$@" ${HOME} echo local | readonly
+-eu test && && export | "$1" export "$1"
+	"$1" /usr/bin /usr/bin -eu then done done -eu | awk grep grep -eu grep
+		local local 2>/dev/null sed 2>/dev/null /usr/bin --verbose
+	then | awk && && -eu sed sed then test local
+	awk then echo readonly ${HOME} /usr/bin
+sed awk done grep printf printf printf "$@" sed
+	sed | done 'quoted text' export test then awk then sed ${HOME}
+	readonly | --verbose
+		x=1 then then echo "$@"
+echo grep "$@" -eu | grep awk | sed readonly /usr/bin ${HOME} cd echo
+		awk --verbose /usr/bin 2>/dev/null
+		'quoted text' /usr/bin sed awk | echo then -eu ${HOME} sed local
+	done $(pwd) 2>/dev/null | "$@" "$@" export readonly local printf
+		"$@" printf "$@" $(pwd) export done then /usr/bin
+export sed "$1" /usr/bin && $(pwd) --verbose awk printf
+	&& x=1 $(pwd) $(pwd) local printf then -eu local ${HOME}
+"$1" printf awk cd "$@" local "$@" x=1 -eu printf local $(pwd) 'quoted text'
+/usr/bin x=1 awk sed local awk -eu printf export done --verbose local ${HOME}
+	$(pwd) ${HOME} test grep local then -eu -eu printf -eu grep
+readonly done local test x=1
+	local --verbose awk 2>/dev/null ${HOME} grep ${HOME}
+		"$@" echo sed readonly "$1" echo ${HOME} export echo printf x=1 2>/dev/null -eu
+	then printf "$@" awk ${HOME} export | | test sed "$@" awk x=1 | $(pwd)
+	$(pwd) 'quoted text' echo grep 'quoted text'
+	readonly test cd cd export
+	/usr/bin echo 2>/dev/null awk /usr/bin /usr/bin
+	test cd sed -eu "$@" x=1 && grep cd ${HOME}
+	'quoted text' --verbose export
+		export local 'quoted text' --verbose x=1 local grep
+		done -eu sed cd done cd test --verbose "$@" grep $(pwd) x=1 awk then --verbose
+	grep sed /usr/bin 'quoted text' cd $(pwd)
+	&& | grep readonly cd "$1" /usr/bin --verbose done done "$1" x=1
+&& test then awk cd "$@" echo export
+	x=1 grep ${HOME} $(pwd) | test cd awk test x=1 "$1"
+	--verbose "$1" echo 'quoted text' export then
+		"$@" printf local printf -eu $(pwd) sed $(pwd) "$1"
+2>/dev/null test /usr/bin x=1 sed done && grep "$@" sed /usr/bin -eu
+	local "$1" sed then 2>/dev/null "$@" && x=1 done --verbose
+sed local --verbose then echo /usr/bin ${HOME} && ${HOME} 2>/dev/null export export
+&& ${HOME} --verbose | | printf
+	sed echo test ${HOME} readonly readonly done export test "$1" && export
+	$(pwd) done awk "$1" | printf grep 'quoted text' printf done | test
+	${HOME} test sed export 2>/dev/null "$1" $(pwd) awk "$1" $(pwd) --verbose 2>/dev/null
+		local done && /usr/bin echo grep printf x=1 ${HOME} /usr/bin
+		local printf x=1 $(pwd) readonly then done then then grep
+	&& sed readonly cd /usr/bin x=1 "$@" x=1 'quoted text'
+printf $(pwd) echo printf cd 'quoted text' | -eu 'quoted text' echo
+	export printf readonly awk $(pwd)
+sed | local | awk 2>/dev/null printf
+		--verbose $(pwd) printf
+	-eu awk ${HOME} test readonly
+		"$1" then readonly | local local test
+		2>/dev/null | 'quoted text' "$1"
+/usr/bin sed echo | $(pwd) --verbose done && "$1"
+	"$1" | -eu --verbose readonly
+-eu sed test x=1 readonly readonly ${HOME}
+	2>/dev/null then test awk 'quoted text'
+	local done cd && /usr/bin sed -eu sed "$@" "$@" 2>/dev/null | then printf done
+		${HOME} then sed printf grep 'quoted text' ${HOME} then echo then
+		export cd printf 'quoted text'
+	2>/dev/null grep --verbose -eu ${HOME} then
+		'quoted text' echo readonly "$@" then then cd $(pwd) cd test awk
+x=1 ${HOME} $(pwd) done awk grep done export
+	&& /usr/bin --verbose local -eu sed cd then
+	then -eu then cd ${HOME} local
+$(pwd) local awk grep "$@" grep then printf $(pwd) "$1" echo
+		grep 2>/dev/null ${HOME} grep
+/usr/bin then 'quoted text' | | test echo -eu -eu cd | then "$@" "$1" cd readonly
+		$(pwd) && x=1 2>/dev/null echo "$@" x=1 grep && cd /usr/bin local
+		then local awk done -eu $(pwd) | | ${HOME} --verbose readonly local
+	x=1 sed cd grep && && $(pwd) test then 2>/dev/null then awk && local then && grep
+${HOME} then then && local
+${HOME} done "$1" -eu test ${HOME} -eu export local -eu echo "$1"
+/usr/bin readonly sed local --verbose awk then readonly done local -eu
+printf $(pwd) -eu -eu cd $(pwd) export printf test test -eu $(pwd) | /usr/bin
+	echo awk done printf --verbose
+$(pwd) && awk 'quoted text' && ${HOME} test echo export
+	$(pwd) printf --verbose done
+	then && awk "$1" cd done "$@" awk local sed local readonly
+cd then ${HOME} 'quoted text' $(pwd) "$1" readonly --verbose awk
+'quoted text' /usr/bin echo export 'quoted text'
+		"$@" 2>/dev/null ${HOME} printf ${HOME}
+		echo ${HOME} 'quoted text' --verbose grep x=1 printf 'quoted text' sed --verbose
+		sed then --verbose 'quoted text' x=1 echo $(pwd) /usr/bin local
+		done 2>/dev/null done export -eu x=1 export "$1" echo then ${HOME}
+"$1" 'quoted text' echo readonly /usr/bin /usr/bin grep awk export
+	'quoted text' $(pwd) "$1" 'quoted text' /usr/bin x=1 x=1
+		| export && done cd "$@" x=1 "$@" printf then test -eu done printf
+		'quoted text' readonly -eu "$1" "$1" 2>/dev/null
+grep readonly done "$@" $(pwd) cd 2>/dev/null 2>/dev/null export /usr/bin then awk
+		grep grep x=1 echo grep readonly 'quoted text' then cd echo --verbose $(pwd) "$1"
+		-eu echo readonly "$@" then awk x=1 cd export x=1 x=1 readonly
+	export /usr/bin then echo x=1 printf -eu cd --verbose
+		-eu grep then 'quoted text' /usr/bin --verbose "$@"
+		/usr/bin readonly test 'quoted text' readonly 'quoted text'
+	${HOME} 2>/dev/null printf 'quoted text'
+done readonly --verbose 2>/dev/null
+	printf readonly && local && 2>/dev/null sed printf
+$(pwd) echo grep && local local | echo 'quoted text' ${HOME} test
+	$(pwd) test --verbose awk $(pwd) awk 2>/dev/null printf ${HOME}
+		then awk /usr/bin ${HOME} grep awk 2>/dev/null -eu export
+$(pwd) readonly echo done export echo then echo then awk readonly 'quoted text'
+		echo -eu | export cd 2>/dev/null /usr/bin -eu test 2>/dev/null grep && "$1" echo
+'quoted text' /usr/bin "$1" done printf --verbose
+sed sed printf echo printf cd x=1 test && -eu test test
+		x=1 && printf readonly local done
+		2>/dev/null "$@" 2>/dev/null 2>/dev/null
+		printf grep cd ${HOME} | then done local
+		"$@" done printf echo sed sed printf test $(pwd) 2>/dev/null cd sed
+		done ${HOME} --verbose --verbose awk readonly "$1" export
+		cd done test /usr/bin ${HOME} awk --verbose
+/usr/bin | export awk grep readonly
+x=1 | --verbose x=1 readonly printf
+	then "$1" /usr/bin --verbose echo -eu sed x=1 export cd | "$@" local && ${HOME}
+	readonly echo | -eu export
+		| $(pwd) /usr/bin readonly awk $(pwd) done awk
+'quoted text' cd test ${HOME} x=1 $(pwd)
+	export | local readonly -eu readonly printf x=1 cd 2>/dev/null "$1" grep && test
+		cd printf grep readonly sed
+		printf readonly "$@" done -eu then "$1"
+		/usr/bin local "$1" readonly 'quoted text' export | printf awk awk "$1" && -eu
+/usr/bin readonly --verbose "$1" && grep cd x=1 then 'quoted text' --verbose
+	"$1" export awk | cd cd -eu ${HOME} --verbose /usr/bin export printf
+	--verbose "$1" echo readonly
+	'quoted text' cd x=1 local ${HOME} ${HOME} printf ${HOME} 'quoted text'
+		printf $(pwd) | printf && cd
+-eu x=1 | $(pwd) | grep grep ${HOME} export echo readonly
+--verbose then awk then then echo x=1 x=1 "$@" 2>/dev/null /usr/bin
+	&& cd x=1 "$1" | | 'quoted text' then echo x=1 cd awk done
+	export && 'quoted text' export --verbose | echo
+/usr/bin sed 'quoted text' && /usr/bin cd printf $(pwd) readonly 'quoted text'
+export echo grep printf | "$1" echo 'quoted text'
+	-eu 'quoted text' 2>/dev/null x=1 awk grep
+	| test export printf awk grep local test cd && test then ${HOME} local
+	echo "$@" && $(pwd) then printf "$1" cd && 'quoted text'
+	2>/dev/null x=1 "$@" x=1 -eu 2>/dev/null printf printf echo then
+	awk grep "$@" local | local sed local /usr/bin $(pwd) |
+		printf /usr/bin /usr/bin --verbose
+"$@" done ${HOME} | test --verbose ${HOME} echo done
+		awk $(pwd) readonly then /usr/bin $(pwd)
+	echo cd sed $(pwd) echo
+		/usr/bin $(pwd) export x=1 sed 2>/dev/null cd $(pwd) | | sed 'quoted text'
+		&& sed -eu sed --verbose "$@" /usr/bin "$@" x=1 cd export echo ${HOME}
+		local -eu "$1" "$1" x=1 -eu "$1" awk /usr/bin
+/usr/bin -eu x=1 ${HOME} echo 2>/dev/null 2>/dev/null done test export 'quoted text'
+--verbose cd /usr/bin cd 'quoted text' readonly
+		grep ${HOME} $(pwd) && | cd ${HOME} local && local x=1 readonly then $(pwd)
+		export export grep -eu local cd "$1" --verbose awk
+	$(pwd) done then && && cd "$@" test /usr/bin
+		&& -eu && 2>/dev/null readonly test then
+'quoted text' --verbose readonly 2>/dev/null -eu test awk --verbose test done grep
+-eu then local "$1" sed then x=1 test $(pwd) grep
+	| printf readonly sed echo "$1" then test
+export export | x=1 $(pwd) --verbose cd "$@" then local 'quoted text' cd done cd
+		/usr/bin --verbose /usr/bin --verbose
+		cd awk x=1 test test printf /usr/bin 2>/dev/null ${HOME} && --verbose
+x=1 --verbose awk readonly grep grep /usr/bin printf printf printf -eu sed
+	printf "$@" | cd sed 'quoted text' local 'quoted text'
+		echo | echo $(pwd) --verbose /usr/bin
+x=1 $(pwd) test cd printf $(pwd) done --verbose
+	$(pwd) 'quoted text' grep done awk export -eu -eu -eu
+	done "$@" $(pwd) echo test done --verbose $(pwd) sed grep 'quoted text'
+	cd done echo | export "$@" readonly readonly 'quoted text' echo -eu "$@"
+		test local export awk | ${HOME} ${HOME}
+	echo ${HOME} "$1" -eu export cd printf then
+	cd local 2>/dev/null cd readonly export local ${HOME} done local && sed local x=1
+	echo awk readonly /usr/bin then x=1 readonly local /usr/bin
+		grep local readonly readonly cd awk $(pwd)
+	-eu -eu awk awk export
+		$(pwd) --verbose 'quoted text' $(pwd) cd printf | "$@" -eu echo x=1 2>/dev/null
+		printf echo 2>/dev/null && echo echo printf -eu
+printf test export printf echo test test grep printf then 'quoted text'
+	"$@" ${HOME} -eu echo done --verbose export x=1 readonly && then
+&& sed x=1 "$@" then && sed export x=1 grep $(pwd)
+${HOME} test x=1 echo --verbose readonly 2>/dev/null /usr/bin
+| "$@" sed /usr/bin grep export $(pwd) /usr/bin "$1"
+		x=1 readonly test 'quoted text' export 'quoted text' -eu then then 2>/dev/null
+done export | ${HOME} awk
+x=1 --verbose | --verbose echo
+awk && then sed "$1" "$@" --verbose grep sed x=1 readonly -eu sed ${HOME} sed echo
+		"$@" $(pwd) 'quoted text' echo | -eu readonly
+		printf && readonly /usr/bin then local test awk
+&& "$@" local /usr/bin --verbose done sed "$1" then then /usr/bin
+		then /usr/bin awk 'quoted text'
+		sed && readonly cd sed awk grep | readonly /usr/bin "$1" && awk
+readonly printf "$1" 2>/dev/null $(pwd) echo "$1"
+	| export awk /usr/bin 'quoted text' && "$1" | local
+		'quoted text' | 'quoted text'
+	"$1" then then -eu done -eu sed then cd then cd readonly test $(pwd)
+	"$@" "$@" "$1" sed test x=1 grep
+		awk then echo ${HOME} && $(pwd) sed
+$(pwd) /usr/bin export 2>/dev/null "$1" -eu cd printf
+		| local local printf
+	'quoted text' "$@" | x=1 --verbose cd export local
+	export | "$1" 2>/dev/null /usr/bin "$1" $(pwd)
+--verbose cd /usr/bin cd --verbose printf done readonly local -eu $(pwd) test
+cd grep echo "$1" ${HOME} x=1 sed "$1" export sed local "$@" readonly | |
+	'quoted text' 2>/dev/null test 2>/dev/null 2>/dev/null test
+		sed grep | sed export sed 2>/dev/null
+2>/dev/null --verbose /usr/bin -eu -eu 'quoted text' "$@" "$@"
+		&& sed --verbose $(pwd)
+	then | "$@" "$@" -eu export
+	${HOME} x=1 "$@" $(pwd) echo $(pwd) x=1 "$@" export printf /usr/bin 'quoted text'
+		cd local "$@" /usr/bin printf test grep x=1
+		2>/dev/null awk -eu export cd 'quoted text' awk $(pwd) cd ${HOME} echo readonly
+/usr/bin printf 2>/dev/null
+		export grep "$1" local grep readonly --verbose cd test "$@" -eu | --verbose -eu
+sed ${HOME} export "$1"
+	--verbose readonly /usr/bin 2>/dev/null 2>/dev/null
+	x=1 'quoted text' x=1 --verbose -eu sed ${HOME} cd $(pwd) echo local x=1
+"$1" printf done 'quoted text' x=1 'quoted text' |
+	$(pwd) --verbose $(pwd)
+--verbose test echo /usr/bin
+sed printf local "$@" echo awk && readonly
+	echo done echo 2>/dev/null --verbose
+'quoted text' test sed 'quoted text' 'quoted text'
+		grep sed printf readonly test "$@" then sed grep $(pwd)
+		"$@" && awk readonly echo printf -eu
+		/usr/bin 'quoted text' export
+	local test grep printf x=1 done
+--verbose cd cd echo cd 2>/dev/null "$@" 'quoted text'
+	--verbose $(pwd) local "$1" printf readonly
+"$@" done test then ${HOME} then /usr/bin grep --verbose
+		local grep readonly cd printf -eu then
+		awk then ${HOME} --verbose 2>/dev/null "$1" done then |
+	echo | grep 2>/dev/null
+	done --verbose echo readonly printf awk 2>/dev/null readonly printf test 'quoted text'
+		--verbose done test sed export awk grep done --verbose x=1 local --verbose
+	| && "$1" then awk printf --verbose --verbose "$@" 'quoted text'
+	&& 'quoted text' --verbose 'quoted text' && readonly "$1" && grep done grep
+		/usr/bin test 'quoted text' 'quoted text' 'quoted text'
+		export "$@" && done /usr/bin awk echo sed 2>/dev/null 2>/dev/null
+2>/dev/null test && export
+		x=1 "$1" | export "$@" cd readonly readonly local awk export "$1" && awk cd echo
+	x=1 $(pwd) && "$@" ${HOME} local local $(pwd) grep sed && x=1 --verbose
+	"$@" cd awk cd grep | export "$@" "$@" x=1 2>/dev/null && cd --verbose awk done
+	grep sed -eu --verbose && "$@" ${HOME} printf done
+		echo echo -eu test readonly "$1" test
+&& -eu /usr/bin -eu 2>/dev/null --verbose 2>/dev/null x=1 /usr/bin "$1"
+		/usr/bin $(pwd) -eu "$@" grep
+| cd cd grep -eu cd readonly 'quoted text'
+	awk ${HOME} printf grep x=1 2>/dev/null cd export
+		then test sed export echo local export awk
+"$@" sed 2>/dev/null $(pwd) 'quoted text'
+	printf 2>/dev/null done local | local | then && local /usr/bin
+		echo cd grep "$1" local then 'quoted text'
+	x=1 done done done export cd sed | $(pwd) /usr/bin
+/usr/bin && export printf | | local
+	"$@" "$@" ${HOME} then cd
+		${HOME} /usr/bin && sed awk awk done echo $(pwd) echo | readonly
+grep done ${HOME} sed $(pwd) -eu /usr/bin /usr/bin
+	'quoted text' grep test cd ${HOME}
+	$(pwd) "$1" | printf "$1" -eu $(pwd) test --verbose | | readonly && "$@"
+'quoted text' "$1" 2>/dev/null
+	done -eu 2>/dev/null "$1" printf then -eu then
+		x=1 echo local "$1" | | x=1 $(pwd)
+/usr/bin "$@" sed grep 2>/dev/null then && | awk
+		${HOME} cd x=1 printf "$1" readonly | printf then sed done sed /usr/bin
+		done && awk "$@" 'quoted text' x=1
+	$(pwd) ${HOME} cd $(pwd) then then cd awk grep printf
+	cd cd test sed "$1" local local export
+"$@" ${HOME} then awk x=1 "$1" | echo printf grep done awk 'quoted text'
+${HOME} && cd printf export "$1" --verbose --verbose x=1 then
+		grep | then echo 'quoted text' export sed
+	&& "$@" done then x=1 | $(pwd) awk local cd test sed
+	test then 'quoted text' -eu echo $(pwd) -eu "$@" grep && "$1" "$@"
+		export export done | export x=1 'quoted text' export test grep done awk cd |
+		printf export -eu 'quoted text' 2>/dev/null test ${HOME} x=1
+	awk awk done x=1 local 'quoted text' | local export
+		done echo ${HOME} cd -eu "$1" | grep $(pwd) printf export
+		echo 2>/dev/null 'quoted text' $(pwd) "$@" "$@" export sed printf --verbose
+		cd export export "$@" readonly
+		grep grep -eu "$1" $(pwd) export && && printf done then --verbose
+--verbose printf 'quoted text' ${HOME} test 'quoted text'
+--verbose && printf | awk && "$@" && "$1" /usr/bin && local printf && && awk
+		-eu | && printf $(pwd) cd $(pwd) && echo "$@" done "$1" $(pwd) grep then
+		-eu done --verbose awk
+	"$1" | cd readonly "$@" /usr/bin awk readonly "$@" -eu --verbose
+printf 2>/dev/null sed $(pwd) echo ${HOME} sed && ${HOME} && && done -eu
+		'quoted text' "$1" test | "$@" sed "$1" printf 2>/dev/null 'quoted text'
+		'quoted text' -eu | readonly
+echo readonly cd x=1 then
+	/usr/bin then printf test
+/usr/bin awk local $(pwd) printf && export 2>/dev/null 'quoted text' echo
+	printf && done readonly 2>/dev/null awk -eu test printf awk 'quoted text' /usr/bin
+sed --verbose sed sed "$@" ${HOME}
+export $(pwd) echo then $(pwd)
+echo sed 2>/dev/null /usr/bin grep --verbose awk --verbose
+	x=1 --verbose done cd sed ${HOME} printf test
+		'quoted text' sed awk
+"$@" done 2>/dev/null | echo cd readonly echo grep readonly "$@"
+	--verbose readonly $(pwd) export awk "$@" --verbose
+	test "$1" cd sed ${HOME}
+	test sed then test x=1
+done sed done done cd 'quoted text'
+		x=1 "$@" "$@" done grep --verbose awk --verbose -eu readonly
+	&& $(pwd) 'quoted text' | sed printf cd $(pwd)
+	--verbose local ${HOME} echo $(pwd) "$1" x=1 grep /usr/bin
+		export awk "$1" 2>/dev/null -eu ${HOME} echo printf awk -eu --verbose
+${HOME} echo ${HOME} local | echo
+		echo cd x=1 awk -eu done x=1 "$1" sed readonly local export 'quoted text'
+	&& "$@" local then test "$1"
+		&& awk 2>/dev/null then grep awk $(pwd) grep /usr/bin "$@" awk
+export grep 2>/dev/null echo grep test /usr/bin
+	local local done ${HOME}
+readonly export readonly echo done
+local "$1" -eu && export grep echo &&
+	grep x=1 x=1 awk -eu --verbose printf then printf
+test $(pwd) grep /usr/bin readonly $(pwd) | "$1"
+		$(pwd) local -eu | 2>/dev/null printf /usr/bin --verbose
+	"$@" 'quoted text' && /usr/bin
+		${HOME} /usr/bin 2>/dev/null
+	&& export then "$@" local 2>/dev/null -eu "$1"
+cd x=1 local $(pwd) 2>/dev/null
+-eu readonly sed -eu test echo cd /usr/bin readonly
+		2>/dev/null -eu local sed export "$1" | sed x=1 ${HOME} cd
+cd sed && 2>/dev/null $(pwd) "$@" test 2>/dev/null "$@" x=1 $(pwd) readonly
+		| grep readonly $(pwd) echo local test && cd "$1" test -eu readonly local
+	${HOME} grep echo $(pwd) readonly printf grep local test "$1" cd "$@" && && x=1
+done cd done --verbose ${HOME} awk "$1" 2>/dev/null grep
+	'quoted text' grep /usr/bin 'quoted text'
+	then x=1 export /usr/bin
+readonly test cd $(pwd) export
+		$(pwd) printf --verbose awk cd | local 'quoted text' export echo $(pwd)
+		$(pwd) cd ${HOME} "$@" test -eu echo readonly readonly /usr/bin "$1"
+then export "$1" /usr/bin cd echo && sed grep
+		-eu awk /usr/bin -eu ${HOME} then /usr/bin
+	--verbose && echo x=1 then readonly local /usr/bin
+		$(pwd) 'quoted text' $(pwd) then local 2>/dev/null awk grep done echo
+	"$1" --verbose echo ${HOME} export test ${HOME} -eu x=1 -eu cd done -eu /usr/bin
+		echo /usr/bin | sed done readonly | test done awk cd echo -eu && x=1 cd cd
+printf local "$1" export grep ${HOME} sed echo sed local
+	--verbose "$@" awk $(pwd) 'quoted text'
+		${HOME} && $(pwd) -eu cd &&
+		/usr/bin export && | local awk ${HOME} echo
+	--verbose "$@" -eu && awk test readonly -eu && | x=1 && readonly 'quoted text'
+		$(pwd) sed sed -eu 'quoted text' then readonly -eu export readonly /usr/bin
+$(pwd) cd 2>/dev/null "$@"
+		echo grep ${HOME} "$1" done | printf done export sed sed $(pwd) -eu then
+${HOME} --verbose 2>/dev/null
+printf export x=1 'quoted text'
+	$(pwd) ${HOME} local test then test
+	x=1 2>/dev/null grep echo 2>/dev/null awk "$1" export $(pwd)
+-eu "$@" echo test sed test x=1 $(pwd) done
+${HOME} x=1 export printf $(pwd) awk $(pwd) ${HOME} cd
+		cd sed x=1 && grep sed cd
+	awk && sed 'quoted text'
+printf --verbose x=1 ${HOME} /usr/bin printf then
+	$(pwd) "$@" grep readonly local sed awk grep awk --verbose
+		/usr/bin -eu $(pwd) ${HOME} export 2>/dev/null
+cd echo /usr/bin export --verbose printf 'quoted text'
+	echo awk cd | "$@" "$@" grep
+	x=1 printf $(pwd) /usr/bin "$@" ${HOME} readonly
+	${HOME} done printf sed export x=1 $(pwd) export
+$(pwd) cd "$1" $(pwd) done
+	done ${HOME} done cd -eu | "$@" grep then && done "$1" sed | awk cd awk "$1"
+		test grep $(pwd) ${HOME} cd && printf local export cd done | echo x=1
+awk ${HOME} awk readonly readonly test |
+		&& done local "$1" | -eu 'quoted text'
+	&& "$1" && export | "$1" export echo
+	x=1 -eu awk local grep cd cd done echo then "$1" sed
+printf export awk "$@" printf ${HOME} 2>/dev/null export
+x=1 printf -eu "$@" local awk 2>/dev/null "$@" /usr/bin printf grep x=1
+	grep "$@" 2>/dev/null |
+		test /usr/bin -eu 2>/dev/null ${HOME} echo awk sed cd done then grep "$1"
+	--verbose x=1 cd cd /usr/bin x=1 readonly
+echo ${HOME} export x=1 echo && "$@" ${HOME}
+${HOME} x=1 | --verbose ${HOME} /usr/bin --verbose then
+		/usr/bin echo local echo echo /usr/bin printf
+	${HOME} sed done cd echo
+--verbose done | cd done echo echo echo sed test printf x=1 sed sed grep "$@"
+	echo x=1 printf printf "$@" echo local -eu "$1" grep grep printf
+grep test ${HOME} grep readonly x=1 2>/dev/null readonly ${HOME} "$@" -eu
+		"$@" "$@" readonly -eu cd echo /usr/bin --verbose test
+		${HOME} export grep echo
+test echo then done done 2>/dev/null cd
+		local x=1 readonly x=1 ${HOME} local
+printf grep && 'quoted text' --verbose done &&
+	${HOME} "$1" --verbose "$1" cd export done
+		readonly readonly 'quoted text' grep echo $(pwd) 2>/dev/null "$@" "$@" test
+		printf -eu readonly printf
+		export $(pwd) $(pwd) sed echo printf /usr/bin done x=1
+		/usr/bin sed $(pwd) local
+		grep grep readonly done sed export 'quoted text' cd sed --verbose
+	done ${HOME} | 2>/dev/null readonly | 'quoted text' "$@" then grep local
+2>/dev/null printf readonly ${HOME} echo x=1 | done -eu sed x=1
+	x=1 test sed grep ${HOME} | 'quoted text'
+	$(pwd) done done --verbose 'quoted text' export then test -eu echo --verbose
+		2>/dev/null -eu "$@"
+	-eu && "$1" /usr/bin local export --verbose test
+		awk cd export echo local
+-eu -eu --verbose echo printf
+		x=1 'quoted text' export sed --verbose
+		then then | 'quoted text' echo | echo printf sed /usr/bin 'quoted text'
+	"$1" | readonly /usr/bin awk readonly export ${HOME} $(pwd)
+local "$1" readonly -eu /usr/bin 2>/dev/null
+		echo done ${HOME} ${HOME} "$1" --verbose "$@" | 'quoted text' "$1" ${HOME}
+		/usr/bin local $(pwd) echo ${HOME} --verbose export 'quoted text'
+	$(pwd) 'quoted text' readonly
+		test readonly 2>/dev/null --verbose
+"$1" $(pwd) test && 2>/dev/null 'quoted text'
+		done readonly 'quoted text' "$1" && cd then
+		$(pwd) "$@" done /usr/bin test x=1 /usr/bin printf done x=1
+	/usr/bin sed 'quoted text' && done grep $(pwd)
+| done cd test x=1 local "$@" 2>/dev/null export done awk then | "$1" --verbose
+	2>/dev/null $(pwd) grep -eu | export 'quoted text' x=1 && printf printf
+	printf test ${HOME} export 2>/dev/null | export sed 2>/dev/null -eu --verbose
+/usr/bin local | "$@" echo
+		export | grep test --verbose x=1 /usr/bin local "$1"
+	${HOME} readonly x=1 "$1" sed
+test x=1 echo x=1 printf 2>/dev/null
+		--verbose 'quoted text' x=1 /usr/bin x=1 sed && | x=1 "$@" $(pwd) echo
+	done awk cd --verbose --verbose && /usr/bin test 'quoted text'
+		sed sed && "$1" grep 2>/dev/null
+	then cd test /usr/bin grep sed done cd $(pwd) "$@" awk && cd echo "$1" --verbose
+	&& cd cd readonly 2>/dev/null && "$@" 2>/dev/null x=1 test -eu done cd grep --verbose
+		export grep awk then done done cd cd cd grep $(pwd) test done
+grep 2>/dev/null $(pwd) then
+	2>/dev/null "$@" readonly 'quoted text'
+	printf && readonly | grep sed
+	readonly /usr/bin && x=1
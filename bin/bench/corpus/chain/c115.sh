@@ -0,0 +1,2001 @@
+		test echo /usr/bin ${HOME} x=1 "$1"
+		/usr/bin 'quoted text' 'quoted text'
+		-eu /usr/bin && cd "$1" --verbose echo /usr/bin echo "$1"
+		-eu --verbose grep && export export cd 2>/dev/null readonly -eu awk done
+	sed cd then done 2>/dev/null grep | x=1 test $(pwd) export echo
+		'quoted text' test /usr/bin 'quoted text' test ${HOME} -eu local /usr/bin cd /usr/bin
+export 2>/dev/null $(pwd) /usr/bin
+--verbose done test "$@" /usr/bin /usr/bin
+--verbose $(pwd) "$@" 2>/dev/null
+	sed /usr/bin | 2>/dev/null "$1" && grep 2>/dev/null "$1" x=1
+${HOME} then echo test && | then awk awk
+	done $(pwd) 2>/dev/null ${HOME} "$@" /usr/bin -eu x=1 then awk "$1" local
+grep awk grep awk cd --verbose awk awk /usr/bin
+	readonly done printf "$@" && ${HOME}
+	printf awk grep $(pwd) "$1" 'quoted text' "$@" readonly then done awk
+$(pwd) "$@" cd $(pwd) /usr/bin "$@" -eu echo echo $(pwd) 2>/dev/null "$1" && test
+		printf export 2>/dev/null then $(pwd) done --verbose
+		| && awk $(pwd) grep $(pwd) cd local "$@"
+		local /usr/bin local /usr/bin
+then /usr/bin "$1" export /usr/bin test echo done | | export && 'quoted text'
+echo $(pwd) "$1" test x=1 "$1" echo grep $(pwd) 'quoted text' $(pwd) "$1"
+	test 'quoted text' --verbose 'quoted text'
+		/usr/bin export ${HOME} ${HOME} 'quoted text'
+echo cd awk 2>/dev/null cd test 2>/dev/null
+		$(pwd) sed grep x=1 /usr/bin cd printf printf test then && ${HOME} x=1
+		${HOME} awk then echo ${HOME}
+	&& -eu sed /usr/bin sed 'quoted text' && x=1 readonly
+	local ${HOME} sed sed grep grep cd then then awk --verbose export printf
+	| $(pwd) cd x=1 export readonly done test readonly sed done readonly
+/usr/bin x=1 'quoted text' cd grep --verbose cd ${HOME} "$@" sed
+cd printf test 'quoted text' sed done echo x=1 $(pwd) x=1 --verbose
+	cd sed cd /usr/bin awk test -eu | awk sed $(pwd) | grep echo
+	then ${HOME} --verbose test printf echo grep
+done --verbose --verbose -eu then 2>/dev/null
+	/usr/bin "$@" printf grep && |
+		"$1" grep cd "$@" 'quoted text' /usr/bin awk cd cd grep "$1" -eu | 'quoted text'
+		--verbose -eu "$1" | ${HOME} printf $(pwd) local 2>/dev/null 2>/dev/null
+"$1" local cd local 2>/dev/null
+sed readonly grep ${HOME}
+	printf echo then sed 2>/dev/null --verbose $(pwd) test local echo local --verbose
+		export done /usr/bin cd
+echo ${HOME} printf done /usr/bin grep
+awk readonly "$1" -eu x=1 test sed readonly then grep --verbose /usr/bin
+	-eu ${HOME} 2>/dev/null 2>/dev/null -eu | grep 2>/dev/null
+local | cd | sed $(pwd) grep awk readonly
+printf echo 'quoted text' ${HOME} echo $(pwd) 'quoted text' ${HOME}
+		'quoted text' then --verbose | -eu
+		"$1" x=1 /usr/bin test -eu /usr/bin 'quoted text' | awk grep $(pwd) 'quoted text'
+/usr/bin export "$@" 'quoted text' then local then
+		| then then "$@" grep && readonly echo
+2>/dev/null export cd printf | && grep test readonly "$1" echo grep
+		'quoted text' 'quoted text' awk echo /usr/bin test grep 'quoted text' test
+	"$1" | cd && printf export
+	export cd awk readonly printf | then $(pwd) cd 'quoted text' echo 'quoted text'
+	x=1 --verbose grep export local --verbose 'quoted text'
+	-eu test sed echo ${HOME} sed awk "$@" test test
+		-eu done --verbose sed local done x=1 readonly export test done awk "$1" awk
+		then /usr/bin 2>/dev/null 2>/dev/null
+		| ${HOME} printf local done && printf $(pwd) $(pwd) --verbose printf export
+then awk $(pwd) 'quoted text' done done | $(pwd) local "$@" --verbose grep readonly
+	&& then x=1 2>/dev/null awk done
+	printf && awk -eu && --verbose 'quoted text'
+		/usr/bin x=1 /usr/bin /usr/bin 'quoted text' "$1" | 2>/dev/null
+	-eu | "$1" awk test -eu "$1" 2>/dev/null
+		readonly --verbose && then
+awk 2>/dev/null sed sed cd ${HOME} "$1" test awk awk 2>/dev/null echo "$1"
+	sed "$1" ${HOME} cd 'quoted text' && 2>/dev/null
+		printf && echo && "$@" x=1 sed printf awk cd printf sed grep done 'quoted text'
+		&& && "$1" "$@" x=1 | then then ${HOME} cd -eu && && x=1 done x=1 2>/dev/null
+then echo grep | $(pwd) 'quoted text' -eu awk readonly
+| /usr/bin printf 2>/dev/null 2>/dev/null readonly printf /usr/bin printf 2>/dev/null
+	sed "$@" /usr/bin 'quoted text' awk awk -eu sed "$1" && done
+	x=1 "$1" printf awk test
+		export $(pwd) "$1" export
+		sed -eu printf awk echo $(pwd) local test test 'quoted text'
+	&& x=1 -eu | "$1" x=1 && $(pwd)
+	awk $(pwd) 'quoted text' export grep printf && 'quoted text' then cd /usr/bin
+sed x=1 sed /usr/bin 2>/dev/null -eu cd && awk "$1" grep
+echo test grep grep sed printf readonly echo | sed local 'quoted text'
+"$1" /usr/bin export echo ${HOME} ${HOME}
+		$(pwd) echo --verbose then $(pwd)
+		"$@" then | | test test awk --verbose
+export x=1 'quoted text' test local export test test
+| printf ${HOME} ${HOME}
+echo | export ${HOME} -eu ${HOME} 'quoted text'
+'quoted text' grep "$1" "$@" ${HOME} test readonly x=1 "$@" echo export
+	x=1 2>/dev/null -eu --verbose --verbose local
+printf awk then cd && "$@" -eu test then then "$@" &&
+		printf "$1" 'quoted text'
+	export local ${HOME} "$1" /usr/bin test then $(pwd) test
+sed ${HOME} 'quoted text' done sed 2>/dev/null
+	-eu done readonly 2>/dev/null readonly
+	2>/dev/null sed 2>/dev/null && grep 'quoted text' "$@" printf sed /usr/bin
+local /usr/bin /usr/bin 2>/dev/null done x=1 done test export x=1
+		/usr/bin x=1 test grep then | export then local 2>/dev/null
+printf x=1 "$@" then && --verbose "$1" cd cd done
+	"$@" then 2>/dev/null 2>/dev/null then done -eu $(pwd) cd && echo
+		awk --verbose echo -eu done test x=1 "$@" 'quoted text' then
+		sed 'quoted text' export grep x=1 "$@"
+		$(pwd) sed sed readonly -eu cd $(pwd)
+		sed then grep 2>/dev/null "$@" then cd "$@" local
+		/usr/bin "$@" "$@" local sed cd readonly cd "$@" awk -eu
+		"$1" x=1 'quoted text' export grep grep /usr/bin $(pwd) /usr/bin
+| --verbose ${HOME} printf | done "$@"
+		"$1" | "$1" then | /usr/bin -eu echo 2>/dev/null $(pwd) cd readonly
+awk cd done done awk export test local "$1" ${HOME} done then /usr/bin
+	grep 'quoted text' export grep sed
+	2>/dev/null sed && 'quoted text'
+		x=1 awk grep $(pwd) local
+	cd 'quoted text' echo echo echo --verbose -eu
+	readonly x=1 test echo
+	sed readonly -eu "$1" done grep printf 'quoted text'
+	2>/dev/null /usr/bin awk | -eu echo test x=1 then "$@" test
+/usr/bin cd -eu cd --verbose
+"$1" | done /usr/bin "$@" --verbose
+		"$@" $(pwd) test done cd done /usr/bin
+	'quoted text' "$@" readonly export
+2>/dev/null "$1" readonly export ${HOME}
+		export local $(pwd) cd 'quoted text' awk
+awk printf x=1 $(pwd) done $(pwd) --verbose readonly readonly test cd readonly
+-eu 'quoted text' | awk ${HOME} cd
+	2>/dev/null awk -eu "$@"
+	awk && grep then export export readonly
+		'quoted text' && x=1 test 2>/dev/null && 'quoted text'
+	${HOME} && /usr/bin x=1 echo --verbose then /usr/bin cd x=1 x=1
+export 'quoted text' && /usr/bin test ${HOME} export && | /usr/bin readonly
+then 'quoted text' /usr/bin done $(pwd) ${HOME} readonly "$1"
+printf awk cd ${HOME} grep 'quoted text' export awk ${HOME}
+${HOME} "$1" ${HOME} local "$1" readonly
+	readonly sed -eu --verbose grep readonly
+		readonly $(pwd) && --verbose $(pwd) grep "$@"
+echo export --verbose readonly then 'quoted text' awk sed | local x=1
+		grep echo awk readonly awk
+local cd test x=1 && export test printf cd --verbose
+		--verbose echo local export /usr/bin awk "$@" --verbose 'quoted text'
+local "$1" awk x=1 "$@" readonly local -eu
+test awk then && /usr/bin --verbose "$@" x=1 readonly
+export done cd test "$1" echo --verbose
+	--verbose then sed done ${HOME} test
+		${HOME} grep cd grep x=1 --verbose then 2>/dev/null
+awk grep local echo export --verbose /usr/bin
+		$(pwd) readonly --verbose awk awk -eu printf export readonly --verbose
+		'quoted text' done grep local export
+		"$@" -eu "$@" then --verbose $(pwd) | 'quoted text'
+local sed then echo local 'quoted text'
+test export ${HOME} -eu ${HOME} echo $(pwd) export "$1" cd | readonly done
+grep --verbose 2>/dev/null ${HOME} | ${HOME} "$1"
+	local readonly | then grep --verbose
+awk -eu then x=1 echo then 'quoted text' printf cd "$1" 2>/dev/null
+then | $(pwd) cd $(pwd) export awk export printf "$1" printf 'quoted text'
+&& cd then sed sed sed 2>/dev/null grep readonly sed -eu readonly
+	grep "$@" 'quoted text'
+		done /usr/bin grep "$1" x=1 2>/dev/null
+		'quoted text' "$1" readonly awk $(pwd) $(pwd) local awk
+	printf "$1" echo cd "$1" --verbose grep -eu --verbose
+		printf echo sed echo printf cd -eu echo cd "$@" export printf ${HOME} echo
+test --verbose ${HOME} 'quoted text' sed ${HOME} local awk && |
+echo grep readonly local local && 'quoted text' test grep sed
+	local sed sed 2>/dev/null /usr/bin 2>/dev/null "$@"
+sed && $(pwd) done 2>/dev/null && 2>/dev/null local readonly ${HOME}
+--verbose | export local test 2>/dev/null then && then "$1" then test readonly test
+cd cd readonly && 2>/dev/null "$1" cd "$1" echo test awk printf test 'quoted text'
+		local local && "$@" 2>/dev/null $(pwd) printf /usr/bin sed | && awk
+	2>/dev/null then sed readonly printf && -eu done
+		"$1" test && test test | printf
+	$(pwd) "$1" "$1" | && 'quoted text' awk $(pwd) export | done
+| done grep ${HOME} --verbose test echo echo ${HOME}
+$(pwd) && "$1" -eu test ${HOME} $(pwd) $(pwd) -eu /usr/bin &&
+		readonly x=1 test --verbose $(pwd) test 'quoted text' | -eu --verbose printf
+then printf && --verbose --verbose /usr/bin ${HOME}
+		sed local "$1" printf 'quoted text' grep test /usr/bin
+		done test echo test ${HOME} done test export "$1" /usr/bin test echo local
+		test /usr/bin "$1" done done --verbose printf cd sed grep $(pwd) | readonly
+	awk ${HOME} ${HOME} && echo | && sed && test
+'quoted text' awk /usr/bin "$1" --verbose readonly
+		echo -eu sed done "$@" awk done x=1 sed
+--verbose 'quoted text' cd printf awk grep 'quoted text' 2>/dev/null
+		local 'quoted text' ${HOME}
+		-eu echo -eu | export
+done then "$@" awk x=1 readonly -eu 'quoted text'
+test "$@" readonly sed cd export
+		awk echo then grep "$1" readonly "$1" "$@" x=1 ${HOME} done 2>/dev/null
+x=1 export awk grep $(pwd) /usr/bin ${HOME} -eu sed
+		sed x=1 export grep readonly "$1" ${HOME} ${HOME} 'quoted text'
+| export 2>/dev/null "$@" "$@" 2>/dev/null && | "$1" cd $(pwd) &&
+local "$@" cd printf 2>/dev/null then 2>/dev/null | 2>/dev/null echo x=1
+	| && awk --verbose x=1 awk "$@" awk
+		2>/dev/null "$@" sed grep ${HOME} ${HOME} printf local "$@"
+	export $(pwd) readonly grep | && then "$@" done "$1" 2>/dev/null
+		'quoted text' test ${HOME} export 'quoted text'
+	--verbose 2>/dev/null printf cd x=1 printf /usr/bin
+"$1" test readonly ${HOME} awk "$@" sed 'quoted text' -eu | readonly
+		done awk x=1 cd && | sed $(pwd) grep readonly
+		"$@" done test export cd 'quoted text' x=1 x=1
+-eu readonly readonly /usr/bin readonly
+	${HOME} | local 'quoted text' -eu 'quoted text' grep export 2>/dev/null
+	"$@" && "$@" test $(pwd) echo
+		| grep "$1" x=1 grep done readonly $(pwd) --verbose awk ${HOME} grep
+	/usr/bin readonly -eu /usr/bin local sed cd && ${HOME}
+	local readonly then then 'quoted text'
+&& /usr/bin readonly 'quoted text'
+	$(pwd) echo export -eu $(pwd) "$1" 2>/dev/null export cd -eu cd
+		export readonly echo echo $(pwd) done 'quoted text' -eu --verbose | local
+cd test sed 'quoted text' -eu test $(pwd) export
+		${HOME} ${HOME} test done then done $(pwd) test done --verbose echo printf
+	printf 'quoted text' /usr/bin $(pwd) done
+	"$@" cd "$1" x=1 export grep && "$1" grep | export local x=1 awk done
+		echo "$1" printf awk
+	readonly && && test && then cd ${HOME} -eu -eu awk "$@" readonly
+readonly $(pwd) $(pwd) local sed printf
+'quoted text' then 'quoted text' --verbose sed readonly
+		printf done ${HOME} 2>/dev/null && 'quoted text'
+&& local export 'quoted text' awk $(pwd) echo
+	readonly ${HOME} && 2>/dev/null
+		local -eu "$1" readonly export /usr/bin readonly test sed echo export done
+		readonly "$@" then "$@" 'quoted text'
+printf | awk echo test then
+export 2>/dev/null cd 'quoted text'
+		/usr/bin 'quoted text' readonly --verbose /usr/bin then grep
+	echo "$@" "$@" /usr/bin readonly
+		echo export test test sed local readonly
+	-eu "$1" export then awk /usr/bin | then export "$1" done | && -eu "$1"
+cd grep x=1 then test grep | local grep && echo "$1" grep local "$1" "$1" echo
+test done readonly local /usr/bin $(pwd)
+2>/dev/null printf 'quoted text' echo local | then -eu sed --verbose
+		printf awk then 'quoted text' /usr/bin
+	x=1 | -eu "$1" "$1" 'quoted text'
+	/usr/bin then /usr/bin $(pwd)
+export 2>/dev/null ${HOME} then awk cd test export export | "$@" $(pwd) x=1 printf
+	grep sed test "$@" /usr/bin done sed export ${HOME}
+		printf local cd /usr/bin /usr/bin 2>/dev/null $(pwd) then
+		then x=1 sed readonly export 2>/dev/null export
+| then local -eu local printf export done ${HOME} x=1
+	${HOME} $(pwd) "$1" 'quoted text'
+$(pwd) awk export && cd x=1 done test echo | export /usr/bin local -eu /usr/bin
+	&& | $(pwd) | x=1 printf
+		&& --verbose x=1 && --verbose
+	x=1 local && grep test printf
+	local grep done awk readonly done "$@" 'quoted text' local 'quoted text'
+		$(pwd) $(pwd) local local $(pwd) sed
+	${HOME} "$@" $(pwd) local -eu then x=1 grep -eu sed then readonly test |
+done 'quoted text' /usr/bin awk
+	$(pwd) -eu 'quoted text' 'quoted text' cd ${HOME} 2>/dev/null then $(pwd) --verbose
+		| readonly ${HOME} done
+	'quoted text' 'quoted text' /usr/bin
+		grep -eu /usr/bin --verbose "$1" "$@" | 2>/dev/null |
+'quoted text' ${HOME} grep $(pwd)
+		test awk then test 2>/dev/null local done ${HOME}
+	cd sed -eu | $(pwd) "$1"
+		sed 'quoted text' awk export export awk && test
+2>/dev/null -eu export then 'quoted text' $(pwd) printf grep
+	'quoted text' "$1" x=1 2>/dev/null export grep printf |
+	&& /usr/bin /usr/bin && test test awk "$1" "$@" x=1 printf
+		export --verbose export echo local $(pwd) "$@" | echo x=1 ${HOME} && local $(pwd)
+		local 'quoted text' cd $(pwd) 2>/dev/null $(pwd) export
+printf "$1" ${HOME} "$1" test local 'quoted text' then "$1" sed &&
+	/usr/bin done x=1 awk echo ${HOME} awk then export 'quoted text' "$@" then sed
+cd && | 'quoted text' && printf sed x=1 'quoted text'
+	"$1" sed grep awk "$@" printf grep echo awk local -eu readonly then
+local x=1 "$1" cd "$@" export readonly 'quoted text' --verbose
+local test "$@" "$1" grep awk ${HOME} 2>/dev/null
+local grep cd readonly cd export ${HOME}
+/usr/bin | $(pwd) ${HOME} ${HOME} "$@" ${HOME} && /usr/bin 2>/dev/null export
+grep readonly export -eu /usr/bin test | 2>/dev/null
+	readonly cd $(pwd) "$1" 2>/dev/null local "$1" local
+		done ${HOME} "$1" test cd "$1" export 2>/dev/null cd cd && echo ${HOME}
+		echo | --verbose local $(pwd) $(pwd) local /usr/bin grep "$@" /usr/bin local
+		printf /usr/bin then done | sed $(pwd)
+--verbose local export then then | /usr/bin readonly
+then test -eu 2>/dev/null
+	${HOME} local grep 2>/dev/null grep -eu local
+	echo echo "$@" readonly
+done readonly sed test --verbose
+		awk $(pwd) local | sed sed echo grep
+-eu done && x=1 sed /usr/bin 'quoted text' local 'quoted text'
+| "$@" echo --verbose ${HOME} cd awk readonly test --verbose 2>/dev/null
+	printf cd sed && "$@" test $(pwd) --verbose done "$@" then "$@" | sed /usr/bin
+	printf --verbose x=1 /usr/bin x=1 && 'quoted text'
+	done && then sed --verbose -eu printf "$@" ${HOME}
+	test done 2>/dev/null "$@" /usr/bin awk "$1" echo readonly awk done x=1
+$(pwd) "$@" $(pwd) && "$1" grep printf
+		test ${HOME} x=1 && export export echo | 'quoted text' sed
+cd test then 2>/dev/null $(pwd) awk test | -eu echo --verbose then export /usr/bin
+	done -eu --verbose test /usr/bin sed local echo printf done readonly done
+sed --verbose awk echo | 'quoted text' "$1" "$@" $(pwd) | && readonly 'quoted text'
+printf test x=1 | 'quoted text' --verbose cd 2>/dev/null export grep local ${HOME}
+-eu $(pwd) 2>/dev/null echo | sed 2>/dev/null -eu --verbose awk x=1 printf
+		awk sed echo --verbose "$1" 'quoted text' ${HOME} then --verbose grep local $(pwd)
+	$(pwd) done awk $(pwd) echo && done then local "$@" grep grep
+printf $(pwd) cd local -eu echo awk 'quoted text' cd && 2>/dev/null
+local readonly awk printf readonly grep sed -eu x=1
+		done then printf -eu "$1" readonly ${HOME} "$1" -eu test ${HOME} test 2>/dev/null
+echo local "$@" then x=1 awk printf printf "$1" then readonly "$1" "$1"
+then ${HOME} ${HOME} /usr/bin -eu done grep "$1" $(pwd) grep done
+	done $(pwd) printf | ${HOME}
+then awk printf "$@" sed 'quoted text' "$1" sed /usr/bin
+		test test -eu awk done done done awk --verbose echo && && "$@" "$1" "$1"
+--verbose local done x=1
+	"$1" -eu "$1" 'quoted text' echo
+		--verbose x=1 export 2>/dev/null
+"$@" awk export 'quoted text' /usr/bin 'quoted text' -eu x=1 export x=1 && x=1
+		'quoted text' 2>/dev/null 2>/dev/null
+	grep && test local "$1"
+		"$@" awk 2>/dev/null grep awk awk grep --verbose 'quoted text' sed "$@" local
+		grep cd --verbose then --verbose printf readonly 2>/dev/null echo
+	&& 'quoted text' sed x=1 then then --verbose |
+		local $(pwd) "$1" ${HOME} test 2>/dev/null
+		export "$@" && done /usr/bin -eu echo awk ${HOME} 2>/dev/null sed readonly
+		-eu | readonly 'quoted text'
+		| 'quoted text' ${HOME} && -eu ${HOME} | echo grep x=1
+		cd printf $(pwd) test sed "$1" $(pwd) grep done then
+		test && grep sed local -eu sed readonly export 'quoted text' test readonly
+-eu "$1" && "$@" export && -eu
+		echo x=1 readonly readonly
+-eu local $(pwd) x=1 "$1" sed local ${HOME}
+		$(pwd) /usr/bin sed 2>/dev/null readonly sed echo x=1 2>/dev/null | echo /usr/bin
+2>/dev/null -eu readonly --verbose $(pwd) cd cd ${HOME} $(pwd) done echo "$1"
+		cd -eu x=1 local --verbose grep awk --verbose /usr/bin ${HOME} 2>/dev/null
+${HOME} awk local --verbose
+echo "$@" done echo test
+local export echo 'quoted text' "$1" x=1 ${HOME} "$1"
+	export "$1" $(pwd) "$1" /usr/bin
+	/usr/bin awk grep cd printf
+	&& "$@" echo echo --verbose x=1 /usr/bin
+		-eu grep grep awk sed &&
+local $(pwd) "$@" --verbose printf echo x=1 sed /usr/bin
+		echo done test x=1 ${HOME}
+		sed cd echo 2>/dev/null $(pwd) -eu done && export --verbose
+printf -eu 2>/dev/null grep "$1" then test printf grep then 2>/dev/null
+		readonly && $(pwd) readonly -eu echo 2>/dev/null echo export sed $(pwd)
+	-eu awk sed test $(pwd) "$@" local /usr/bin readonly awk sed
+	"$1" printf echo | local then
+echo -eu test -eu 2>/dev/null x=1 done sed local done
+done export test echo test sed | test echo cd /usr/bin export export local
+	then cd readonly test -eu done awk "$1" ${HOME} --verbose echo awk echo
+	| done readonly export && local done /usr/bin | "$1" --verbose && echo printf
+	--verbose done | readonly sed sed sed "$1" echo local ${HOME} "$1" 'quoted text'
+	grep && test local echo printf 2>/dev/null
+		"$@" 'quoted text' awk done x=1
+		&& "$1" then $(pwd) 2>/dev/null test && sed awk --verbose $(pwd)
+readonly /usr/bin && cd printf echo $(pwd) export $(pwd) printf
+local printf | "$1" sed 2>/dev/null ${HOME} then sed /usr/bin /usr/bin $(pwd)
+export sed local echo echo export && export -eu
+printf | ${HOME} awk cd readonly cd ${HOME}
+	"$@" "$@" "$@" -eu ${HOME}
+		$(pwd) "$1" then printf x=1 test | echo readonly test grep local ${HOME}
+		awk 'quoted text' printf cd then done
+/usr/bin done local ${HOME} test $(pwd)
+	-eu "$@" /usr/bin local echo | 'quoted text'
+	echo done "$1" $(pwd) sed cd echo readonly -eu awk | cd $(pwd)
+	export local test 2>/dev/null test readonly 'quoted text'
+printf awk cd "$1" "$@" $(pwd) x=1 2>/dev/null 'quoted text' --verbose
+x=1 /usr/bin readonly && sed ${HOME} grep awk awk x=1 sed x=1 awk grep
+readonly $(pwd) 2>/dev/null local test done
+		--verbose local sed --verbose export $(pwd) -eu -eu export sed | local $(pwd)
+then 2>/dev/null done && --verbose x=1 x=1 sed
+		${HOME} -eu local 2>/dev/null |
+	'quoted text' --verbose 'quoted text' && --verbose grep -eu then x=1 /usr/bin
+printf local -eu -eu
+		${HOME} local x=1 echo awk x=1 2>/dev/null export sed -eu 'quoted text' $(pwd)
+		grep x=1 then 'quoted text' grep printf cd $(pwd) --verbose then "$@" 'quoted text'
+then readonly local cd -eu "$1" done "$@"
+2>/dev/null readonly && 2>/dev/null grep done then /usr/bin "$@"
+		sed readonly test grep local then test done 2>/dev/null
+	readonly 2>/dev/null -eu readonly 2>/dev/null x=1 printf | printf awk sed printf
+		grep && /usr/bin test export "$1" | "$1" sed test
+	'quoted text' ${HOME} export cd 2>/dev/null echo awk export 2>/dev/null
+		awk sed printf -eu | echo $(pwd) -eu x=1 $(pwd) echo test 2>/dev/null
+	printf cd -eu /usr/bin && 2>/dev/null /usr/bin awk
+	--verbose --verbose "$1" readonly 'quoted text' 2>/dev/null && grep export ${HOME}
+	printf then echo x=1 test /usr/bin | "$@" export
+2>/dev/null grep 'quoted text' echo done readonly
+		export echo cd sed x=1 done readonly
+	"$@" 'quoted text' ${HOME} cd test --verbose cd --verbose
+		sed awk | "$@" readonly echo "$@" export then readonly
+$(pwd) "$@" awk awk cd | awk /usr/bin test readonly x=1 "$1" | $(pwd)
+		"$@" awk done readonly
+	--verbose $(pwd) "$@"
+		awk /usr/bin 'quoted text' /usr/bin test ${HOME} $(pwd)
+		export then awk printf 2>/dev/null | x=1 "$@" 'quoted text' --verbose
+	"$@" | && "$@" "$1" 'quoted text' grep "$@" 'quoted text' ${HOME} && then export
+	local ${HOME} sed "$@" cd cd cd | local --verbose | && | 2>/dev/null
+	export ${HOME} "$@" 'quoted text' echo then $(pwd) local awk
+		grep && /usr/bin done awk 'quoted text'
+	x=1 test test && ${HOME} sed printf 'quoted text' --verbose
+		$(pwd) then export /usr/bin | then 'quoted text' x=1 export
+		$(pwd) -eu -eu awk echo 'quoted text' sed then printf | | /usr/bin test
+	"$@" export "$@" x=1 done "$1" $(pwd) export
+	readonly ${HOME} done printf 'quoted text' test echo done
+		echo "$@" "$1" /usr/bin -eu printf "$1" "$@" done "$@" "$@" x=1 printf cd 'quoted text'
+grep printf ${HOME} | --verbose /usr/bin export cd 'quoted text' /usr/bin x=1 "$1"
+then cd "$1" 'quoted text'
+	done 2>/dev/null -eu --verbose ${HOME} "$@" sed $(pwd)
+	readonly export 'quoted text' | sed awk -eu
+	printf | && && echo echo --verbose && sed printf readonly export && ${HOME} "$@"
+done readonly then sed
+local /usr/bin echo "$@" && /usr/bin printf $(pwd) /usr/bin cd
+		x=1 "$1" | done --verbose awk then printf grep 'quoted text' done
+	-eu local $(pwd) 'quoted text' ${HOME} x=1 "$@" 2>/dev/null --verbose -eu 'quoted text'
+		"$1" grep "$1" printf 'quoted text'
+		'quoted text' local "$1" 2>/dev/null grep readonly done 2>/dev/null awk cd grep
+test local --verbose "$@" --verbose x=1 then "$@"
+		&& readonly 2>/dev/null readonly -eu /usr/bin && test
+"$@" && cd awk --verbose 2>/dev/null "$@" --verbose -eu ${HOME}
+		readonly printf awk "$1" readonly test local -eu "$1" $(pwd)
+sed test "$1" 2>/dev/null ${HOME} awk echo /usr/bin readonly $(pwd) 'quoted text'
+readonly 'quoted text' awk done "$1" "$1" test -eu readonly
+		$(pwd) 'quoted text' test echo echo && printf export local
+		printf /usr/bin x=1 grep -eu --verbose
+readonly done awk grep grep | /usr/bin "$1" sed && local
+cd 'quoted text' | -eu | printf
+	| readonly local $(pwd) printf awk $(pwd) readonly 2>/dev/null done
+		sed readonly 'quoted text' 'quoted text' test done local awk "$@" cd done
+		/usr/bin "$@" "$@" ${HOME} 'quoted text' echo 2>/dev/null
+		${HOME} local export readonly grep ${HOME} -eu 2>/dev/null printf "$@" readonly
+--verbose "$@" sed done awk readonly awk then ${HOME} $(pwd)
+		/usr/bin readonly printf grep 2>/dev/null $(pwd) | printf readonly local 'quoted text'
+x=1 /usr/bin test sed awk test ${HOME} printf printf test ${HOME} test
+$(pwd) export sed grep
+	"$@" x=1 test "$1" echo x=1 -eu readonly 'quoted text'
+$(pwd) /usr/bin /usr/bin then 2>/dev/null
+		awk grep --verbose readonly
+awk "$1" "$1" "$1" "$@" $(pwd) "$@" --verbose -eu | x=1 sed grep $(pwd) cd 2>/dev/null
+		"$1" "$1" export then cd | | | readonly echo /usr/bin "$1" awk
+	"$1" grep echo $(pwd) awk sed printf export $(pwd) $(pwd)
+	printf --verbose export -eu "$1" sed "$1" /usr/bin && sed grep local --verbose
+		"$@" local then "$@" --verbose test "$@"
+		echo printf awk echo ${HOME} "$1" -eu cd 2>/dev/null -eu echo done
+		test | test 'quoted text' -eu "$@" | 2>/dev/null ${HOME} /usr/bin
+		echo echo 'quoted text' local -eu local --verbose /usr/bin export | export
+	"$1" sed grep local readonly awk | echo printf printf /usr/bin | cd local
+| local --verbose printf ${HOME} printf printf
+	echo cd x=1 printf --verbose $(pwd) local
+	"$1" x=1 test sed "$@" export readonly done sed export --verbose readonly
+	export awk echo then $(pwd) |
+		--verbose x=1 -eu readonly sed --verbose
+printf grep test grep local awk $(pwd) cd readonly awk done "$@" readonly --verbose
+'quoted text' awk done && readonly cd test readonly "$1"
+${HOME} readonly export done local --verbose sed "$@" echo sed readonly -eu
+awk sed test ${HOME} then
+		"$1" --verbose && export then then test local
+		--verbose -eu cd x=1 ${HOME} awk
+	$(pwd) | test then | -eu 2>/dev/null 'quoted text' echo
+	awk -eu export done readonly $(pwd) "$1" 'quoted text'
+| -eu test 2>/dev/null then && -eu "$@" "$@" local printf then
+		awk "$1" && ${HOME} test | "$@" printf cd echo $(pwd) cd "$1"
+	readonly && 'quoted text' /usr/bin local readonly done "$1" x=1 ${HOME} then
+	printf /usr/bin awk "$1" x=1 | 'quoted text'
+readonly "$@" then export && 2>/dev/null ${HOME} 2>/dev/null
+	2>/dev/null test readonly printf readonly
+	readonly cd "$@" sed "$@" ${HOME} 2>/dev/null printf then "$1" -eu
+	printf awk export -eu | cd /usr/bin x=1 ${HOME}
+| /usr/bin --verbose "$1" then cd --verbose sed "$@" -eu /usr/bin $(pwd) "$@"
+${HOME} cd "$1" test $(pwd) &&
+	grep awk 2>/dev/null -eu cd test $(pwd) done /usr/bin | | ${HOME} -eu
+		$(pwd) printf x=1 --verbose 2>/dev/null
+		local local /usr/bin -eu | local grep
+		done x=1 awk cd $(pwd) local ${HOME} ${HOME} done then
+export test x=1 awk cd 2>/dev/null echo "$1" 'quoted text' echo awk
+-eu echo echo /usr/bin $(pwd)
+		'quoted text' local then $(pwd) -eu done printf x=1 cd then grep /usr/bin
+readonly --verbose grep local x=1 grep 2>/dev/null
+	2>/dev/null then 2>/dev/null done $(pwd)
+$(pwd) ${HOME} && -eu $(pwd) printf
+	readonly then 'quoted text'
+		--verbose readonly --verbose -eu sed "$1" x=1 $(pwd) 'quoted text'
+		/usr/bin then awk 2>/dev/null 'quoted text' -eu sed
+grep printf then 2>/dev/null -eu test | export "$1" awk awk $(pwd) done
+		local $(pwd) -eu grep x=1 then grep printf
+		local ${HOME} awk done --verbose cd --verbose | /usr/bin
+	awk 'quoted text' "$1" "$@" && echo /usr/bin 2>/dev/null 2>/dev/null $(pwd) $(pwd)
+	then grep && 'quoted text' cd printf local readonly
+	${HOME} ${HOME} readonly /usr/bin done "$@"
+'quoted text' done readonly cd cd --verbose | --verbose "$@" && ${HOME} &&
+grep "$1" && echo printf /usr/bin then && 2>/dev/null
+	2>/dev/null | done --verbose awk awk x=1 test echo "$@" then echo
+| printf printf export echo sed
+	/usr/bin ${HOME} readonly | && | cd local /usr/bin readonly grep
+&& cd x=1 "$@" x=1 echo echo echo --verbose |
+echo 'quoted text' echo x=1 -eu readonly awk "$@" done | export ${HOME}
+		grep test | then $(pwd) sed awk
+		${HOME} local /usr/bin sed echo readonly local && -eu local 'quoted text' -eu
+	export export ${HOME} && --verbose sed x=1 readonly
+		x=1 2>/dev/null -eu readonly
+	${HOME} 'quoted text' grep
+grep readonly cd /usr/bin $(pwd) done x=1 local | $(pwd) readonly
+	then && | 'quoted text' printf test 2>/dev/null awk x=1 "$1" echo | x=1 readonly
+	${HOME} awk test awk | "$@" /usr/bin && printf
+	${HOME} "$1" && $(pwd) then awk local awk local done printf "$@" 2>/dev/null
+	"$@" 2>/dev/null readonly x=1 awk | cd then done echo
+		printf | readonly echo --verbose ${HOME} grep
+"$1" awk sed "$1" /usr/bin cd
+cd $(pwd) readonly cd awk /usr/bin
+	2>/dev/null --verbose then 2>/dev/null && && x=1 echo done cd -eu echo
+		export test ${HOME} export $(pwd) then x=1 | then test -eu echo
+		'quoted text' readonly | && then done local x=1 done x=1 ${HOME}
+sed ${HOME} 'quoted text' export export | done cd local readonly local grep
+		"$@" test local test echo local | sed awk cd && then 'quoted text' printf "$1"
+done grep local "$@" "$1" grep sed local | test "$@"
+x=1 sed printf awk "$@" 'quoted text' 'quoted text'
+	sed | done 'quoted text' | done local "$1" /usr/bin export
+grep | /usr/bin printf cd | done 2>/dev/null 'quoted text' ${HOME} awk ${HOME}
+	-eu test test printf grep | ${HOME} 'quoted text'
+sed "$1" "$@" awk awk 2>/dev/null |
+2>/dev/null && cd grep local export x=1 grep
+	x=1 $(pwd) "$@" "$1" 2>/dev/null "$1" 2>/dev/null
+	cd | --verbose | sed echo test awk x=1 ${HOME} $(pwd) export "$1"
+	sed printf --verbose $(pwd)
+local $(pwd) printf $(pwd) --verbose local
+	test 2>/dev/null then /usr/bin grep x=1 'quoted text' "$@" local sed printf
+"$1" grep "$@" ${HOME} "$1" 2>/dev/null --verbose 'quoted text' awk --verbose
+then then done -eu --verbose
+sed awk "$@" && export $(pwd) cd test x=1 --verbose
+		awk && local sed 'quoted text' ${HOME}
+	readonly $(pwd) 'quoted text' awk $(pwd) then
+	awk done 2>/dev/null -eu ${HOME} | done done ${HOME} | && local
+then ${HOME} grep test -eu readonly
+	&& "$1" && test awk -eu export $(pwd) readonly then cd
+		x=1 | awk ${HOME} sed test -eu printf 'quoted text' readonly
+	test /usr/bin "$@" "$1" "$1"
+done x=1 printf --verbose
+		| cd then $(pwd) -eu sed done /usr/bin $(pwd) -eu grep "$1"
+		-eu cd sed "$1" $(pwd) /usr/bin --verbose ${HOME}
+local printf done local "$1" 2>/dev/null ${HOME} $(pwd)
+		/usr/bin test ${HOME} test "$1" | 2>/dev/null
+"$1" echo ${HOME} local then
+	echo sed --verbose --verbose 'quoted text' echo x=1 --verbose
+	$(pwd) x=1 --verbose test "$@"
+	'quoted text' grep x=1 | printf | echo "$@" 'quoted text'
+		/usr/bin x=1 grep local sed sed cd /usr/bin awk /usr/bin "$1" echo cd | grep
+| $(pwd) cd x=1 && |
+sed -eu awk local awk sed | x=1 cd 2>/dev/null -eu awk done
+	local ${HOME} awk printf --verbose | 'quoted text' "$1" printf 'quoted text'
+		| then then && /usr/bin -eu 2>/dev/null
+		/usr/bin "$1" local x=1 'quoted text' local test awk export export
+		cd $(pwd) export -eu && export awk | sed /usr/bin
+		done test x=1 printf cd local -eu
+--verbose -eu cd awk "$@" --verbose printf cd echo --verbose && /usr/bin
+done 2>/dev/null readonly
+printf echo test then printf "$1" | x=1 test $(pwd) 2>/dev/null
+		echo "$@" "$1" cd 2>/dev/null --verbose && local && cd test
+-eu sed printf $(pwd) printf ${HOME} $(pwd) $(pwd) local
+&& export "$1" test && | awk local 2>/dev/null readonly local done test
+${HOME} && printf printf 'quoted text' 'quoted text'
+		awk --verbose x=1 | echo cd 2>/dev/null | 'quoted text'
+	$(pwd) sed done 'quoted text' readonly printf
+	'quoted text' x=1 sed x=1 && then local
+/usr/bin grep done test done | && 'quoted text'
+		${HOME} local 2>/dev/null done
+local test test grep | --verbose readonly readonly grep
+		export grep --verbose readonly readonly 2>/dev/null
+sed printf then x=1 printf ${HOME} printf | sed done $(pwd)
+$(pwd) local && grep printf
+&& "$1" "$1" --verbose cd --verbose x=1 sed sed | cd --verbose
+done echo echo x=1 awk readonly 'quoted text' cd printf readonly
+	export "$1" done -eu export sed --verbose done printf && printf
+	'quoted text' ${HOME} -eu export
+	"$1" -eu done cd | then done 2>/dev/null 'quoted text'
+2>/dev/null done -eu local 2>/dev/null --verbose
+		'quoted text' local ${HOME} | awk $(pwd) then
+	"$@" done printf printf test x=1 ${HOME} 'quoted text'
+		readonly sed ${HOME} /usr/bin
+		'quoted text' sed sed /usr/bin cd test ${HOME}
+	then sed export ${HOME} | && --verbose "$1" done && /usr/bin 'quoted text'
+	x=1 echo && cd cd | then "$1" awk
+	2>/dev/null test | test done 2>/dev/null $(pwd) export export
+		test awk export ${HOME} "$@" printf $(pwd) cd test readonly
+		local local local sed local then printf && /usr/bin readonly export 'quoted text'
+	--verbose grep && test ${HOME} local 2>/dev/null awk local /usr/bin 2>/dev/null
+		cd echo -eu ${HOME} x=1 sed test awk
+	cd readonly ${HOME} x=1 --verbose --verbose 2>/dev/null local 'quoted text'
+	| sed test "$@" export
+		-eu 'quoted text' /usr/bin $(pwd) $(pwd) && "$@" -eu 'quoted text'
+		grep test sed --verbose x=1
+done test readonly echo && && 2>/dev/null
+	--verbose --verbose --verbose cd | /usr/bin cd /usr/bin
+	-eu | readonly export awk "$1" "$@" ${HOME} && echo "$@" -eu -eu then
+	$(pwd) sed --verbose $(pwd) printf done 2>/dev/null /usr/bin
+		"$@" local done local ${HOME} "$@" echo /usr/bin
+	sed sed $(pwd) "$@" then export "$@" export ${HOME} export
+		local "$1" x=1 && readonly $(pwd) then grep done ${HOME} 2>/dev/null
+	readonly done ${HOME} | grep
+	"$@" local && "$1" 'quoted text' then test && -eu ${HOME} 'quoted text'
+		readonly | /usr/bin ${HOME} echo x=1 && cd awk sed
+		awk $(pwd) $(pwd) --verbose test 'quoted text' | "$@" "$1" test
+export "$@" | /usr/bin && /usr/bin | | --verbose
+local grep printf readonly echo --verbose grep --verbose && | -eu "$1" &&
+grep cd $(pwd) awk export cd test 2>/dev/null then | "$@"
+sed -eu "$1" export 'quoted text' $(pwd) x=1 "$1" printf && ${HOME}
+sed awk && local cd "$1" "$1"
+-eu | awk && then sed ${HOME} readonly "$1" x=1 echo x=1 "$@"
+--verbose x=1 /usr/bin done /usr/bin -eu printf $(pwd) $(pwd)
+	test $(pwd) grep $(pwd) "$1" then $(pwd) test awk /usr/bin
+	cd && echo awk -eu ${HOME} export grep printf $(pwd)
+then sed then "$1" cd "$@" done local $(pwd)
+		&& export ${HOME} | -eu readonly | |
+'quoted text' test -eu readonly grep && /usr/bin readonly then --verbose
+	printf then export | local
+	echo sed grep awk $(pwd)
+${HOME} test $(pwd) x=1 --verbose ${HOME} cd -eu | local ${HOME}
+	$(pwd) printf 2>/dev/null printf echo local sed "$1" sed awk ${HOME}
+	'quoted text' --verbose && --verbose
+		--verbose readonly "$1" "$1" | test sed grep 'quoted text' | sed 'quoted text'
+	&& ${HOME} printf /usr/bin ${HOME} -eu 'quoted text' | awk readonly
+	2>/dev/null echo -eu echo export export "$@" done x=1 done --verbose
+	export $(pwd) readonly $(pwd) sed $(pwd) "$@" x=1 echo
+grep 'quoted text' done x=1 "$@" 2>/dev/null
+		export grep then local -eu /usr/bin $(pwd) local $(pwd)
+	/usr/bin echo 'quoted text' printf test /usr/bin | then awk --verbose
+	then -eu printf echo done | test grep awk printf sed $(pwd)
+	export "$@" done cd export && cd -eu printf done local --verbose --verbose -eu
+		'quoted text' | awk /usr/bin | then && cd 2>/dev/null test 'quoted text'
+		'quoted text' test awk "$1" sed 2>/dev/null "$1"
+	"$1" && ${HOME} /usr/bin local $(pwd)
+		--verbose sed awk grep printf ${HOME} then printf then
+	printf -eu cd echo "$1" grep $(pwd) test local 2>/dev/null awk && echo awk |
+	echo grep /usr/bin $(pwd)
+	export x=1 export $(pwd) cd 'quoted text' printf then echo
+	&& x=1 cd 2>/dev/null $(pwd) sed ${HOME} awk cd "$@" -eu echo export
+readonly 2>/dev/null sed
+		echo --verbose -eu /usr/bin -eu grep 'quoted text' sed -eu x=1 then sed awk
+	printf sed printf local then /usr/bin x=1 --verbose 'quoted text'
+		printf printf export grep grep local -eu export readonly cd
+	'quoted text' sed then "$1" echo -eu "$@" readonly local
+		&& x=1 -eu grep --verbose &&
+&& -eu test ${HOME} 'quoted text'
+sed export local ${HOME} | then awk /usr/bin awk awk grep $(pwd) "$1" 'quoted text'
+	x=1 && grep $(pwd) export printf awk awk echo done $(pwd) $(pwd)
+		"$1" test $(pwd) "$@" cd $(pwd) local --verbose printf ${HOME} export
+	--verbose local echo "$@" grep 2>/dev/null x=1 && awk grep /usr/bin then readonly
+then "$@" export cd &&
+		${HOME} cd awk test "$@" x=1 2>/dev/null | local /usr/bin $(pwd) "$1" "$@" && sed
+		| then readonly done $(pwd) then 'quoted text'
+		done | test && sed "$@" grep "$@" $(pwd) cd sed "$@" 'quoted text' /usr/bin
+		export local | /usr/bin printf cd 2>/dev/null --verbose && grep grep awk awk
+		&& readonly -eu $(pwd) test --verbose sed x=1 readonly "$@"
+	&& | sed grep ${HOME} done cd $(pwd) echo done readonly /usr/bin $(pwd) &&
+		"$@" echo --verbose | $(pwd) awk x=1 ${HOME} ${HOME} then awk $(pwd) 'quoted text'
+--verbose done x=1 2>/dev/null ${HOME} x=1 test grep | echo then sed --verbose
+		awk readonly grep grep -eu 'quoted text' $(pwd) "$@" printf x=1 local 2>/dev/null
+		test $(pwd) | test $(pwd) awk && done -eu done x=1 test test
+"$1" cd --verbose "$1" -eu | echo done then "$@" 'quoted text' then export
+	${HOME} --verbose "$1" ${HOME} --verbose echo cd readonly
+printf local 'quoted text' then "$1" grep local test
+	export 'quoted text' x=1 /usr/bin
+	| done /usr/bin | echo 'quoted text' cd /usr/bin 2>/dev/null -eu
+"$1" "$@" then echo export test
+		| echo -eu $(pwd) printf 2>/dev/null
+		/usr/bin grep awk test $(pwd) echo $(pwd) done done
+	x=1 grep ${HOME} | readonly printf && 2>/dev/null 2>/dev/null
+grep && ${HOME} local test
+echo sed printf "$1" echo 2>/dev/null then local done --verbose
+	/usr/bin -eu readonly 2>/dev/null $(pwd) cd "$1" printf
+		readonly then done --verbose sed 'quoted text' then x=1 sed sed | && awk
+printf && "$@" awk grep 'quoted text' "$@" $(pwd) x=1 --verbose --verbose --verbose
+		local then && && echo x=1 'quoted text' ${HOME} grep -eu && "$1"
+		${HOME} done 2>/dev/null echo x=1 "$@" sed 'quoted text'
+	cd $(pwd) done cd echo ${HOME}
+${HOME} ${HOME} 'quoted text'
+		-eu local grep then readonly grep --verbose "$1" grep echo printf
+	sed x=1 'quoted text' /usr/bin echo test
+		2>/dev/null 2>/dev/null ${HOME}
+		-eu x=1 "$@" sed cd 'quoted text' $(pwd) x=1 /usr/bin "$1" x=1 2>/dev/null
+echo -eu done grep test -eu $(pwd) sed awk -eu ${HOME} cd 'quoted text' ${HOME}
+-eu && ${HOME} done awk
+/usr/bin --verbose ${HOME} sed 2>/dev/null 'quoted text' readonly "$@" sed
+	sed && awk export | sed | 'quoted text' ${HOME} test && "$@" x=1 $(pwd)
+		x=1 ${HOME} x=1 done && grep && local done
+${HOME} cd | then export test | 'quoted text' echo
+	'quoted text' 2>/dev/null && grep --verbose 'quoted text' export
+		export ${HOME} then --verbose && $(pwd) "$@" "$1" -eu
+${HOME} "$@" printf readonly then "$@" grep grep --verbose grep awk ${HOME}
+		done awk local export | cd && "$1" --verbose
+printf 2>/dev/null awk local
+		'quoted text' echo done x=1 x=1 readonly 2>/dev/null $(pwd) x=1 $(pwd) | && grep
+		sed 'quoted text' x=1 sed cd printf | then $(pwd) "$1" /usr/bin 2>/dev/null
+		${HOME} 'quoted text' && /usr/bin x=1 cd printf &&
+	then awk "$@" && cd local printf 'quoted text' printf local /usr/bin
+	${HOME} export | x=1 test -eu $(pwd) readonly grep
+		cd printf | local then --verbose awk
+		local export grep cd /usr/bin sed echo /usr/bin
+		$(pwd) $(pwd) done then done grep cd 'quoted text' "$1" | 'quoted text' awk
+	| local 'quoted text' && grep "$1"
+	test ${HOME} test "$1" "$@" echo test 'quoted text' "$@" grep
+		/usr/bin sed sed $(pwd) | awk printf
+	"$@" awk $(pwd) && /usr/bin | grep cd 'quoted text' export test done 2>/dev/null
+	test | printf -eu x=1 grep readonly && 2>/dev/null done printf &&
+		'quoted text' local "$1" done test export local
+done local "$1" $(pwd) "$1" echo awk 'quoted text' 2>/dev/null /usr/bin 2>/dev/null
+/usr/bin echo "$1" /usr/bin readonly | /usr/bin --verbose
+		grep grep then 2>/dev/null awk sed /usr/bin "$@"
+	/usr/bin echo /usr/bin test 'quoted text'
+	cd test test then && "$1" 'quoted text'
+$(pwd) -eu x=1 grep x=1 "$@" local
+	export printf export x=1 && --verbose echo printf sed --verbose && then
+		readonly done readonly | "$@" export 2>/dev/null 'quoted text'
+		readonly 2>/dev/null echo -eu export sed grep && done echo 'quoted text' done
+--verbose local echo /usr/bin /usr/bin test --verbose ${HOME} /usr/bin
+	sed sed x=1 -eu 'quoted text' --verbose export sed -eu
+	&& sed && test readonly
+	sed then grep sed local echo printf export && $(pwd)
+	-eu test echo echo local sed -eu echo "$@"
+echo sed sed sed "$1" sed --verbose
+		$(pwd) 'quoted text' "$1" export test "$1"
+	cd 2>/dev/null test && | readonly x=1
+	| | cd 'quoted text' | /usr/bin then local
+local cd --verbose grep grep x=1 x=1
+	echo "$@" sed && echo | awk cd && done
+		sed sed then /usr/bin local export
+printf done readonly done awk -eu /usr/bin
+--verbose && | 'quoted text' 2>/dev/null test -eu $(pwd) grep then 'quoted text'
+	grep | then x=1 'quoted text' x=1 cd then $(pwd) | ${HOME} /usr/bin
+| done ${HOME} | awk printf cd | 'quoted text'
+		export echo 'quoted text' /usr/bin -eu
+		&& --verbose awk "$@" --verbose
+awk cd echo grep printf local -eu local
+		&& /usr/bin "$@" 2>/dev/null x=1 then awk /usr/bin
+		then | x=1 sed then /usr/bin cd -eu ${HOME} awk 2>/dev/null $(pwd)
+readonly -eu x=1 $(pwd) test | 2>/dev/null 'quoted text' /usr/bin
+	awk awk test | echo test ${HOME} 2>/dev/null done && "$@" readonly echo
+		x=1 x=1 && | grep x=1 --verbose export x=1 echo then
+x=1 done && sed readonly echo 2>/dev/null printf
+		export && x=1 cd awk cd echo --verbose 2>/dev/null "$1"
+		-eu -eu cd then "$1" x=1 printf echo "$1" printf done
+"$@" 2>/dev/null $(pwd) local grep local --verbose
+	--verbose && readonly "$1" $(pwd) -eu --verbose x=1 x=1
+	| local grep "$@" echo 'quoted text'
+	done echo export x=1 grep 2>/dev/null
+		&& x=1 then 'quoted text' x=1 awk | grep local
+		export test x=1 "$@" test && cd grep
+"$@" awk $(pwd) done --verbose ${HOME} test printf test
+		local cd "$@" "$@" then test $(pwd)
+2>/dev/null grep done
+	--verbose "$@" 2>/dev/null
+	awk "$1" echo 2>/dev/null grep test -eu readonly grep local
+	test test echo "$1" | done
+		printf 'quoted text' export sed "$@" done 'quoted text' cd
+	'quoted text' x=1 ${HOME} then -eu then "$1" sed ${HOME}
+"$1" | -eu 'quoted text' /usr/bin "$1" export test --verbose x=1 test export
+	${HOME} $(pwd) 2>/dev/null ${HOME} local readonly "$@" then &&
+cd sed export "$@" && |
+local awk && -eu sed && readonly "$@" done echo
+	-eu ${HOME} local sed cd && "$1" test x=1 export
+grep -eu awk | 2>/dev/null export sed -eu grep /usr/bin -eu /usr/bin "$1" -eu
+grep x=1 "$1" | done test ${HOME} grep "$1"
+	x=1 printf && -eu 2>/dev/null
+		$(pwd) export "$@" grep 2>/dev/null -eu printf
+	awk 2>/dev/null $(pwd) ${HOME} 2>/dev/null "$@" "$1" printf --verbose
+	&& | | -eu | test && $(pwd) readonly && -eu 'quoted text' 2>/dev/null
+	$(pwd) /usr/bin ${HOME} $(pwd) | grep
+	grep x=1 x=1 'quoted text' "$1" --verbose readonly | sed -eu done $(pwd) done
+		${HOME} | printf grep -eu done "$1" local /usr/bin 'quoted text'
+	"$@" | echo --verbose grep
+local awk ${HOME} 'quoted text' printf 2>/dev/null cd -eu grep test $(pwd) "$1"
+	echo 2>/dev/null "$1" x=1 readonly
+		sed "$@" "$@" export 2>/dev/null test then echo -eu 2>/dev/null export export
+		test 'quoted text' $(pwd) --verbose "$@" 'quoted text' grep "$@"
+		x=1 | awk done sed local 'quoted text' -eu done then
+	$(pwd) readonly "$@" $(pwd) done $(pwd) done done 'quoted text' echo done --verbose
+		$(pwd) echo 'quoted text' 2>/dev/null 'quoted text' /usr/bin
+then 'quoted text' ${HOME} awk ${HOME} local export printf
+x=1 sed then --verbose /usr/bin
+		-eu test readonly --verbose grep "$1" cd printf test /usr/bin export done
+cd ${HOME} && 2>/dev/null && done $(pwd) x=1
+		"$@" cd test cd local "$1"
+		echo local test awk grep 'quoted text' "$1"
+	/usr/bin local export export echo echo -eu ${HOME}
+"$1" test grep --verbose
+		| printf awk test export x=1 'quoted text' local
+"$1" then -eu -eu local && x=1 && $(pwd) export "$@" "$@"
+		-eu && 2>/dev/null awk -eu x=1 && 'quoted text'
+		x=1 grep readonly | x=1 -eu "$1" &&
+--verbose local ${HOME} ${HOME} && -eu local | && sed ${HOME} test
+		echo 2>/dev/null then awk grep sed done readonly
+"$@" && export 2>/dev/null grep $(pwd) grep /usr/bin
+		2>/dev/null sed | && 2>/dev/null
+		sed "$@" --verbose 'quoted text'
+2>/dev/null 2>/dev/null $(pwd) x=1 grep grep 'quoted text'
+--verbose test done x=1 test awk cd cd && x=1 cd export && "$1" "$1" -eu sed
+"$1" awk done export sed "$@" local awk sed printf then
+	${HOME} --verbose export readonly && local awk local local test
+	printf "$@" | then $(pwd) && printf test cd 2>/dev/null | "$1" done
+		x=1 -eu then x=1 "$@" local then 2>/dev/null
+		/usr/bin "$@" "$1" echo done "$1"
+		--verbose local "$@" && -eu "$1" cd test | "$1" then "$1" ${HOME}
+'quoted text' | /usr/bin export cd then --verbose printf -eu "$@"
+x=1 echo "$1" $(pwd) echo
+export export echo ${HOME} awk
+	&& "$@" x=1 done x=1 "$1" 2>/dev/null -eu "$@"
+	cd 2>/dev/null awk $(pwd) sed "$@" | echo awk readonly 'quoted text'
+	--verbose readonly then ${HOME} test |
+	| | awk awk test local local awk --verbose
+${HOME} -eu printf 'quoted text' -eu --verbose awk grep sed $(pwd) then local sed
+2>/dev/null done 'quoted text' sed "$1" export cd 'quoted text' export ${HOME}
+readonly export ${HOME} echo export printf
+test sed echo && done then
+	awk done readonly awk x=1 test sed grep /usr/bin
+		/usr/bin printf /usr/bin | 'quoted text' awk ${HOME} "$1" 'quoted text'
+	"$@" "$@" -eu "$1" readonly --verbose
+	local && readonly /usr/bin 'quoted text' grep 2>/dev/null
+		grep "$1" sed ${HOME} && $(pwd) 2>/dev/null -eu /usr/bin
+		$(pwd) /usr/bin x=1 echo echo test ${HOME} ${HOME}
+test 'quoted text' $(pwd) --verbose cd then printf 'quoted text' sed -eu
+		printf $(pwd) | printf test --verbose "$1" awk cd /usr/bin
+	test printf -eu -eu $(pwd) readonly && awk test then then export export echo
+	'quoted text' export ${HOME}
+	--verbose local then done && done 2>/dev/null 2>/dev/null
+		"$1" ${HOME} $(pwd) | && -eu -eu 'quoted text' && 2>/dev/null | printf printf
+-eu "$@" local $(pwd) local -eu
+		| $(pwd) $(pwd) awk local
+		printf -eu local x=1 $(pwd) sed $(pwd) cd -eu && | printf
+done ${HOME} x=1 "$1" awk "$1" "$@" -eu then then test 2>/dev/null local
+	$(pwd) 2>/dev/null "$1" $(pwd) 2>/dev/null
+	grep ${HOME} "$@" $(pwd)
+	"$1" export 'quoted text' $(pwd) --verbose x=1 --verbose sed local then
+"$1" 'quoted text' 'quoted text' then
+	sed cd x=1 awk /usr/bin grep cd readonly
+"$1" --verbose done readonly 2>/dev/null -eu x=1 x=1 | awk cd sed
+	printf printf -eu local export 2>/dev/null
+	${HOME} test echo --verbose "$1" /usr/bin 2>/dev/null
+'quoted text' x=1 -eu 2>/dev/null 2>/dev/null /usr/bin export awk 'quoted text'
+local export -eu test /usr/bin cd x=1 "$@" "$1" sed -eu done x=1 /usr/bin
+	"$1" -eu sed readonly sed cd awk printf $(pwd) local local
+cd $(pwd) "$1" test test echo readonly --verbose
+	test sed awk /usr/bin x=1 | local
+		sed grep printf export "$@" readonly | sed printf $(pwd) echo "$1" test
+		$(pwd) done ${HOME} awk echo grep cd readonly
+'quoted text' grep ${HOME} ${HOME} 'quoted text' cd "$@" test
+	readonly /usr/bin "$@" /usr/bin | -eu done x=1
+		'quoted text' then /usr/bin $(pwd) ${HOME} x=1
+		"$1" $(pwd) printf ${HOME} x=1 echo x=1 sed cd && x=1 test done && "$@"
+${HOME} local export printf awk sed readonly $(pwd) cd readonly "$@" sed ${HOME}
+	awk --verbose grep readonly && -eu /usr/bin cd cd echo export export ${HOME} printf
+	2>/dev/null then test x=1 && printf cd export readonly ${HOME} "$@" readonly
+	test sed then sed | $(pwd)
+	printf "$@" --verbose 2>/dev/null sed sed ${HOME} && then /usr/bin "$1" /usr/bin
+echo 'quoted text' sed "$1" cd grep "$1" done printf
+		-eu "$1" export done then echo 2>/dev/null printf && test awk
+	local readonly $(pwd) test readonly ${HOME} -eu sed | && /usr/bin | grep
+echo test readonly --verbose
+readonly && sed echo export 'quoted text' /usr/bin done ${HOME} ${HOME}
+$(pwd) then x=1 then done awk && --verbose
+	then cd local /usr/bin export cd --verbose printf export
+		readonly 'quoted text' "$1"
+	export then cd sed /usr/bin awk export sed "$1" echo ${HOME}
+	sed then sed printf x=1 then
+	"$1" 2>/dev/null awk ${HOME} 'quoted text' export grep /usr/bin
+	"$1" --verbose then $(pwd) cd
+		export awk then -eu /usr/bin -eu 'quoted text'
+		$(pwd) && "$@" --verbose "$@" $(pwd) 2>/dev/null
+		export test done | && "$@" cd "$1" 2>/dev/null -eu
+		/usr/bin printf | cd printf --verbose cd "$1" 2>/dev/null 'quoted text' $(pwd)
+		&& test printf then cd && -eu
+	echo --verbose | grep --verbose echo local 2>/dev/null sed echo
+	'quoted text' -eu --verbose cd 'quoted text'
+		export /usr/bin --verbose "$@" echo awk 2>/dev/null
+		"$@" | -eu printf --verbose local cd awk printf && $(pwd)
+	x=1 'quoted text' then $(pwd) test
+--verbose readonly grep /usr/bin --verbose then --verbose | | 'quoted text'
+		/usr/bin done "$@" awk then cd grep local "$1" "$@" "$1" local done
+		| test sed grep 2>/dev/null -eu grep grep "$@" "$1" $(pwd)
+		"$@" x=1 "$@" /usr/bin 2>/dev/null 'quoted text' x=1
+	$(pwd) ${HOME} grep /usr/bin readonly then "$1" 'quoted text'
+		export ${HOME} -eu ${HOME} export awk /usr/bin $(pwd) "$1"
+local echo ${HOME} 2>/dev/null local done local done x=1 x=1 readonly x=1 printf
+printf --verbose echo then echo $(pwd) export "$1" ${HOME}
+		"$@" "$1" awk /usr/bin done "$1" done $(pwd) local readonly export
+		"$1" $(pwd) "$1" test then cd -eu x=1
+		$(pwd) 2>/dev/null local | echo readonly local
+		cd 2>/dev/null $(pwd) grep /usr/bin -eu "$1" local
+--verbose grep "$@" then "$@" cd -eu sed $(pwd) "$1" -eu 2>/dev/null "$1"
+	local grep readonly 'quoted text' readonly x=1 cd ${HOME} $(pwd)
+		"$1" local "$1" test export 'quoted text' readonly
+	cd printf awk awk local $(pwd) echo ${HOME}
+x=1 | test done then local && sed
+		awk sed "$1" export readonly
+	readonly test "$1" 'quoted text'
+		local | done 'quoted text' ${HOME} printf
+	"$@" "$@" | /usr/bin echo
+'quoted text' sed $(pwd) -eu local readonly
+${HOME} done 2>/dev/null grep ${HOME} sed cd done sed ${HOME}
+	-eu echo echo then test "$1" done readonly && "$1" | |
+printf x=1 sed "$@" grep ${HOME} done done ${HOME}
+	readonly && test && test test
+		printf x=1 cd ${HOME} sed printf
+local export test x=1 $(pwd) "$1" -eu awk local done --verbose
+| "$@" then export test awk --verbose 'quoted text' export readonly
+	"$1" ${HOME} 'quoted text' awk sed $(pwd) $(pwd)
+	sed x=1 export $(pwd)
+	export grep | -eu | /usr/bin export awk cd ${HOME} -eu test printf local
+readonly echo | 'quoted text' test echo echo 2>/dev/null test awk awk then /usr/bin
+	sed 'quoted text' ${HOME} sed sed 'quoted text' awk -eu 'quoted text'
+		/usr/bin "$@" sed /usr/bin 2>/dev/null $(pwd)
+		echo test x=1 test "$@" ${HOME} grep "$@" "$1" echo readonly grep 2>/dev/null
+printf /usr/bin sed | echo test
+export -eu readonly --verbose
+		/usr/bin export done grep x=1 export 2>/dev/null test | awk printf
+		cd awk /usr/bin $(pwd) sed "$1" printf /usr/bin sed local && /usr/bin grep
+		printf grep cd printf -eu cd echo |
+		awk | awk cd 2>/dev/null export echo awk local export "$@" awk
+2>/dev/null -eu --verbose /usr/bin "$@" test printf done $(pwd) -eu awk 'quoted text'
+	-eu --verbose grep awk --verbose
+		| sed /usr/bin "$@" cd readonly "$1" /usr/bin then /usr/bin --verbose
+done 2>/dev/null -eu echo && "$@" printf && --verbose cd sed | && -eu sed 'quoted text'
+then readonly sed && && | |
+		'quoted text' readonly export | 'quoted text' export local "$@"
+		printf readonly test then done sed export x=1 local ${HOME} -eu cd awk
+test --verbose local local "$1"
+		awk export echo done done "$@" /usr/bin awk "$1" ${HOME} ${HOME} export
+		then -eu printf done | sed export grep sed export $(pwd) local
+2>/dev/null printf local
+${HOME} x=1 grep && ${HOME} local x=1 $(pwd)
+	then -eu 'quoted text' ${HOME} grep then 2>/dev/null 'quoted text' $(pwd)
+		then test done /usr/bin grep readonly -eu readonly | $(pwd)
+test "$1" "$1" 2>/dev/null ${HOME} export sed test 'quoted text' $(pwd)
+	x=1 then printf cd done x=1 printf sed && -eu grep /usr/bin local /usr/bin
+	awk grep ${HOME} then ${HOME} awk "$@" printf
+	| $(pwd) "$1" readonly then printf readonly -eu then local /usr/bin
+	"$1" cd readonly 2>/dev/null awk awk "$@" grep test
+	local ${HOME} | echo -eu printf grep cd printf --verbose
+	"$@" -eu "$@" && echo 'quoted text' ${HOME}
+	echo ${HOME} export then awk -eu done "$@" 'quoted text' "$@" local grep printf
+		printf test $(pwd) local readonly
+	| test "$1" sed test ${HOME} grep printf "$1" grep
+$(pwd) "$@" local readonly && /usr/bin "$1" test sed local readonly export
+	done "$1" test -eu && readonly export "$@" sed x=1 export "$@" 'quoted text'
+2>/dev/null ${HOME} printf awk cd local cd local 2>/dev/null
+		&& local export -eu readonly sed done echo -eu ${HOME} awk ${HOME} 'quoted text'
+	&& -eu "$@" awk cd x=1 done
+	--verbose awk ${HOME} "$1" "$1" cd "$1" then "$1" awk grep | | sed
+		cd | export grep test 2>/dev/null "$1"
+	/usr/bin then "$@" then ${HOME} && sed echo sed "$1" 'quoted text' ${HOME} export
+		test sed --verbose done
+	echo done "$@" readonly -eu sed local "$@" then printf 'quoted text'
+		--verbose x=1 sed "$1" --verbose "$1" x=1 awk local x=1 "$1"
+	-eu printf done cd -eu cd test "$@"
+		awk done cd sed printf echo && grep /usr/bin "$1" x=1 -eu export awk "$@"
+then $(pwd) "$@" -eu local 'quoted text'
+$(pwd) export /usr/bin x=1 /usr/bin echo cd echo 2>/dev/null done
+		printf 2>/dev/null /usr/bin then test awk echo
+		awk | x=1 cd ${HOME} /usr/bin sed test ${HOME} test "$@" echo "$1" ${HOME} printf
+		"$1" | | then ${HOME} sed export /usr/bin /usr/bin --verbose echo
+		sed export sed 'quoted text'
+	printf && "$@" /usr/bin 2>/dev/null $(pwd) sed x=1 -eu "$@" echo
+	awk | then done /usr/bin 2>/dev/null sed -eu --verbose local local
+test grep local local sed awk "$1" $(pwd)
+test awk export | printf cd cd && cd printf local awk
+		/usr/bin cd readonly sed 2>/dev/null local x=1 cd then
+	awk 2>/dev/null 2>/dev/null local readonly x=1 /usr/bin
+awk printf "$1" export cd readonly && "$1" $(pwd)
+-eu | "$1" export "$1" cd 'quoted text' x=1 readonly
+sed then readonly 2>/dev/null 'quoted text' x=1 test /usr/bin 2>/dev/null && sed
+		| then && && echo done --verbose x=1 --verbose local sed
+sed done /usr/bin sed "$1" x=1 readonly 'quoted text' sed then -eu grep
+	grep test x=1 export printf printf ${HOME} | grep && x=1 local awk awk done
+cd readonly printf readonly -eu then && awk test && sed
+	2>/dev/null test "$@" test 2>/dev/null "$1" grep --verbose "$@"
+		cd | "$@" sed done printf awk sed "$1" && awk
+readonly then x=1 --verbose x=1 && awk cd ${HOME} 2>/dev/null
+test x=1 cd sed "$@" /usr/bin echo -eu
+--verbose done test /usr/bin printf | then done sed 2>/dev/null
+done sed "$1" local local /usr/bin grep x=1 local readonly
+/usr/bin && /usr/bin ${HOME} x=1 local
+		echo ${HOME} --verbose /usr/bin
+	then $(pwd) /usr/bin grep sed sed
+		grep x=1 ${HOME} echo local | -eu test --verbose ${HOME} local then echo
+		"$@" local "$@" test export
+		-eu export 'quoted text' /usr/bin
+		test cd $(pwd) "$1" -eu $(pwd) | 'quoted text' local printf test -eu then | local
+		echo echo x=1 printf $(pwd)
+x=1 --verbose --verbose test printf printf
+	readonly ${HOME} -eu $(pwd) test ${HOME} export ${HOME} 'quoted text' "$@" $(pwd)
+	$(pwd) ${HOME} -eu 'quoted text' sed printf grep
+		sed --verbose printf 'quoted text' printf printf /usr/bin done test printf
+	awk ${HOME} 'quoted text'
+	-eu printf awk export cd x=1 && cd readonly
+		2>/dev/null echo sed "$1" done -eu 2>/dev/null printf /usr/bin $(pwd)
+		sed 2>/dev/null --verbose "$@" ${HOME} "$1" grep test then
+printf echo printf $(pwd) sed readonly
+	'quoted text' 2>/dev/null "$@" --verbose $(pwd) "$1" echo
+		done /usr/bin grep --verbose
+	readonly sed echo $(pwd) test readonly readonly local
+	'quoted text' -eu && local cd
+	$(pwd) local 2>/dev/null 'quoted text' test | /usr/bin --verbose
+	"$@" $(pwd) awk "$@" x=1 grep printf readonly
+	cd && -eu export ${HOME} cd echo x=1 readonly printf --verbose
+	readonly echo 'quoted text' test "$1" local --verbose sed && local
+		printf test readonly && local 2>/dev/null echo /usr/bin 'quoted text' done
+/usr/bin x=1 test ${HOME}
+done "$1" /usr/bin /usr/bin "$@" printf 'quoted text'
+cd "$1" | echo export "$@" done grep test /usr/bin export | x=1
+		&& test -eu ${HOME} then local done printf
+	sed x=1 -eu | then "$@" && local --verbose test 2>/dev/null printf export
+done $(pwd) $(pwd) grep 2>/dev/null echo 2>/dev/null
+	x=1 then test sed "$1" 2>/dev/null $(pwd)
+		printf "$1" readonly echo 'quoted text' $(pwd) readonly cd | -eu -eu
+/usr/bin grep 2>/dev/null cd grep done grep readonly
+cd --verbose "$@" cd | awk 'quoted text' 'quoted text' 'quoted text' | "$1"
+echo "$1" -eu echo readonly
+		-eu local && done printf grep then export test awk done
+#include c116.sh
+		local | then | | readonly local "$@" "$1" echo ${HOME}
+${HOME} export ${HOME} x=1 /usr/bin printf grep "$@" x=1 awk --verbose
+"$@" 'quoted text' local cd -eu -eu x=1 2>/dev/null
+		awk local && test && "$@" sed --verbose export /usr/bin sed echo -eu | 'quoted text'
+		--verbose local && test x=1 "$@" && 2>/dev/null
+'quoted text' --verbose export echo local
+	/usr/bin test -eu local test export -eu echo test -eu printf local
+	/usr/bin 'quoted text' && && ${HOME} -eu then ${HOME}
+	echo then x=1 done x=1 test
+		-eu local /usr/bin ${HOME} /usr/bin sed awk test grep test local 'quoted text' &&
+--verbose 'quoted text' "$1" grep "$1" $(pwd) printf then cd
+		printf cd cd 'quoted text' then grep && echo
+		then 2>/dev/null x=1 --verbose
+	export "$1" local test export ${HOME} | -eu x=1 -eu "$@" cd then "$@" 2>/dev/null
+		cd | "$@" echo /usr/bin awk "$@" readonly export grep ${HOME}
+cd awk 'quoted text' echo $(pwd) printf ${HOME} -eu "$@" test test ${HOME} readonly
+done ${HOME} | -eu echo "$@" export | /usr/bin echo
+	/usr/bin test && export x=1 ${HOME}
+readonly --verbose printf sed printf | |
+printf 2>/dev/null "$1" export && export readonly /usr/bin "$@" ${HOME}
+	grep /usr/bin "$1" x=1 x=1 echo echo &&
+export echo export cd export cd grep local $(pwd) "$@" grep "$1"
+sed -eu awk readonly $(pwd) $(pwd) "$1" test then --verbose export --verbose
+	2>/dev/null export 2>/dev/null awk "$1" "$1" awk done cd then
+cd --verbose ${HOME} | x=1
+	sed export 'quoted text'
+	"$1" 2>/dev/null cd ${HOME} done grep readonly
+	2>/dev/null then && 'quoted text' /usr/bin "$@" sed then done grep 2>/dev/null /usr/bin
+cd export "$@" x=1 cd "$1" 'quoted text'
+	| --verbose local "$1" 'quoted text' x=1 $(pwd) grep then readonly then 'quoted text'
+	/usr/bin export "$1" &&
+		/usr/bin x=1 cd readonly ${HOME}
+sed /usr/bin readonly awk --verbose
+	sed test "$1" echo local echo local printf
+	local | | readonly ${HOME} && done then sed -eu printf ${HOME} printf 'quoted text'
+		'quoted text' test x=1 x=1 /usr/bin
+		&& --verbose | | --verbose ${HOME} "$@" readonly
+		${HOME} --verbose ${HOME} && readonly 2>/dev/null x=1 "$1" then sed test x=1
+		${HOME} --verbose && $(pwd) sed $(pwd) | | /usr/bin 2>/dev/null $(pwd) sed
+grep printf printf && -eu &&
+2>/dev/null printf done 'quoted text' 2>/dev/null | export 'quoted text' --verbose
+"$@" readonly test && local cd --verbose
+	x=1 | /usr/bin done | /usr/bin awk
+	"$@" x=1 export done "$1" -eu | done $(pwd) test x=1 test |
+awk grep sed "$@" then && --verbose 2>/dev/null "$1" /usr/bin cd 'quoted text'
+	readonly && "$@" grep then 2>/dev/null grep echo local test local test
+done -eu cd 2>/dev/null
+		-eu then 2>/dev/null | cd -eu 'quoted text' $(pwd) grep "$@"
+		${HOME} $(pwd) then 'quoted text'
+	printf -eu sed && awk /usr/bin then
+		| --verbose -eu 2>/dev/null readonly
+		x=1 -eu "$1" ${HOME} && awk && grep then "$1" printf --verbose
+--verbose "$1" --verbose done readonly
+	'quoted text' cd awk "$@" sed "$1" echo 2>/dev/null
+sed 'quoted text' export
+		| done | ${HOME} 'quoted text' "$1" "$1" --verbose
+		--verbose "$@" test $(pwd) readonly && done x=1 | 'quoted text'
+		'quoted text' "$@" 2>/dev/null cd $(pwd) export -eu
+export printf test echo x=1 'quoted text'
+		| --verbose done ${HOME} 2>/dev/null
+		grep done export "$@" export ${HOME} cd cd 'quoted text'
+--verbose grep done sed 'quoted text' /usr/bin echo ${HOME} local printf
+	grep "$1" -eu "$1" x=1 "$@"
+-eu test && awk 'quoted text' test |
+		then export && grep $(pwd) echo cd test done sed &&
+done "$1" /usr/bin /usr/bin then readonly done 2>/dev/null
+then "$1" awk cd done 2>/dev/null "$@" cd printf grep test -eu -eu local
+"$1" done 'quoted text' local
+	done done awk x=1 --verbose
+&& && done then test echo x=1 'quoted text' cd export 2>/dev/null 2>/dev/null
+		-eu cd readonly grep ${HOME} -eu test
+		awk ${HOME} && then sed ${HOME} then ${HOME} "$1" && -eu /usr/bin printf sed
+		export 'quoted text' export echo /usr/bin sed | && local $(pwd) awk awk
+	test then test 'quoted text' cd test $(pwd) then sed printf && readonly awk
+	&& local -eu then echo awk -eu then | cd -eu | "$@" -eu then export local
+		"$1" done && && /usr/bin sed | awk cd
+"$@" "$1" -eu ${HOME} readonly printf awk cd export local
+	readonly local 2>/dev/null test -eu local then readonly awk && && /usr/bin "$1"
+		--verbose $(pwd) sed then test awk cd printf "$1" awk --verbose 'quoted text'
+		&& done x=1 "$1" && export "$1" export local echo test awk
+'quoted text' printf /usr/bin sed done local && export grep "$1" test | "$@" "$@"
+	printf 'quoted text' then x=1 -eu then done -eu readonly $(pwd) test printf -eu
+${HOME} $(pwd) printf
+		"$@" then | done awk test
+		x=1 printf "$1" awk export
+x=1 printf x=1 x=1 -eu export readonly
+		awk "$@" | export $(pwd) echo $(pwd) 2>/dev/null --verbose then done $(pwd)
+export then 'quoted text' done readonly
+	x=1 && sed echo readonly --verbose 'quoted text' --verbose local /usr/bin
+	export ${HOME} ${HOME} -eu --verbose printf local -eu echo 'quoted text'
+grep then /usr/bin | --verbose readonly x=1 ${HOME} export
+		done cd local sed done --verbose local
+echo echo "$@" grep && ${HOME}
+echo && | readonly x=1 x=1
+-eu "$@" $(pwd) ${HOME} done test sed test local -eu x=1 /usr/bin
+--verbose && ${HOME} --verbose awk "$@" | then -eu $(pwd) readonly
+	grep awk 2>/dev/null cd "$@" then x=1 "$1" x=1 ${HOME} sed awk
+$(pwd) awk $(pwd) then
+		x=1 echo echo "$1" awk export done cd grep readonly && ${HOME}
+	then then export ${HOME} awk then "$@" then 2>/dev/null printf readonly
+	2>/dev/null && | ${HOME} "$@" readonly
+local grep | local then /usr/bin
+$(pwd) --verbose export sed sed awk sed /usr/bin
+2>/dev/null && "$@" done cd "$1" printf local done sed ${HOME}
+echo 'quoted text' export | grep
+		$(pwd) /usr/bin | test export ${HOME}
+	2>/dev/null --verbose 'quoted text' then test readonly x=1
+	sed $(pwd) local cd readonly then printf
+/usr/bin done "$@" local "$@"
+cd -eu $(pwd) $(pwd) /usr/bin grep 2>/dev/null -eu
+	echo readonly sed /usr/bin awk x=1 "$@" export 'quoted text' | cd done /usr/bin
+		-eu "$@" --verbose $(pwd) && readonly echo 'quoted text' sed local
+		2>/dev/null test echo $(pwd) $(pwd)
+		sed printf then /usr/bin 'quoted text'
+	$(pwd) --verbose 'quoted text' &&
+		${HOME} export "$1" awk ${HOME}
+		2>/dev/null x=1 cd awk 'quoted text'
+2>/dev/null "$@" cd local "$@" ${HOME} sed echo cd ${HOME} sed cd $(pwd) echo
+	test local printf cd test awk awk done
+| x=1 local x=1 $(pwd) echo "$@" export "$@"
+		printf echo printf sed test "$@" && $(pwd) -eu "$@" --verbose "$1" -eu
+	--verbose grep | && ${HOME} grep "$@" "$1"
+${HOME} x=1 -eu -eu sed grep ${HOME} done && test test echo echo
+	/usr/bin local awk local then x=1 $(pwd)
+	-eu "$1" local local ${HOME} awk -eu export "$1"
+&& && 2>/dev/null 'quoted text' /usr/bin | printf "$@" &&
+	--verbose ${HOME} sed sed "$1" /usr/bin "$@" "$@" awk echo then 2>/dev/null
+		grep done 'quoted text' /usr/bin grep
+		printf --verbose 'quoted text' test | "$@" grep export
+		"$1" local "$@" "$1" && printf cd readonly
+		| readonly /usr/bin done |
+	${HOME} x=1 readonly 'quoted text' -eu readonly 2>/dev/null
+	-eu echo -eu --verbose x=1 echo --verbose 2>/dev/null /usr/bin |
+	test sed cd 'quoted text' done sed x=1 /usr/bin test --verbose
+	done then test sed 'quoted text' --verbose "$1"
+		local readonly "$1" sed done $(pwd) /usr/bin "$@"
+	done sed local printf sed export grep
+then $(pwd) readonly export
+		x=1 grep --verbose 2>/dev/null "$1" sed echo
+${HOME} -eu printf grep
+		"$1" $(pwd) 'quoted text'
+	echo x=1 export then echo $(pwd) then local readonly "$1" /usr/bin readonly
+echo cd done --verbose cd test x=1 awk && test local -eu readonly
+		$(pwd) ${HOME} readonly printf then --verbose
+		"$@" local /usr/bin ${HOME} awk cd cd sed --verbose cd echo echo
+export printf cd $(pwd) awk grep awk
+	"$1" | 2>/dev/null $(pwd) awk grep printf -eu -eu cd then printf "$1" 'quoted text'
+		local && -eu 'quoted text' "$1" grep -eu --verbose /usr/bin
+echo export export 2>/dev/null 'quoted text'
+	echo | && grep echo grep "$1" 2>/dev/null grep then "$1" readonly echo $(pwd)
+"$1" 'quoted text' ${HOME} grep readonly sed && -eu
+		/usr/bin echo /usr/bin "$1" 2>/dev/null $(pwd) awk then
+		echo | "$1" awk done $(pwd) readonly
+then "$1" -eu $(pwd) test done printf done x=1
+		| test done x=1 --verbose then x=1 | $(pwd) --verbose 2>/dev/null local grep ${HOME}
+		&& cd --verbose "$@" then grep -eu "$1" "$@" ${HOME} 2>/dev/null ${HOME} printf
+	awk $(pwd) "$@" export grep grep -eu done "$@" 'quoted text'
+		sed printf "$@" x=1 ${HOME} ${HOME} local
+		$(pwd) -eu 'quoted text' | echo /usr/bin local readonly
+	${HOME} cd test "$1" then "$@" -eu ${HOME} test --verbose readonly
+		export $(pwd) sed /usr/bin | then echo local sed | test then --verbose
+$(pwd) printf done local /usr/bin
+		/usr/bin local -eu $(pwd)
+		/usr/bin cd 'quoted text' x=1 $(pwd) export awk $(pwd) then readonly 'quoted text'
+	printf local 2>/dev/null "$1" cd 2>/dev/null cd sed | ${HOME} "$1"
+	then awk --verbose | ${HOME} echo --verbose readonly test
+		$(pwd) sed readonly $(pwd) done ${HOME} /usr/bin test /usr/bin local
+	cd local local echo | printf $(pwd) --verbose cd --verbose x=1 cd grep
+	readonly -eu && "$@" x=1 done
+local 'quoted text' awk "$@" 'quoted text' --verbose
+		2>/dev/null x=1 grep export done echo ${HOME}
+printf awk then local x=1 awk printf
+		echo && $(pwd) grep ${HOME} | awk 2>/dev/null export "$1" "$1" | "$1"
+		'quoted text' 2>/dev/null | | then awk 'quoted text'
+	local "$@" ${HOME} local $(pwd)
+	${HOME} awk -eu --verbose 'quoted text' done cd x=1 &&
+--verbose -eu 2>/dev/null done 2>/dev/null /usr/bin
+		/usr/bin x=1 export awk
+		echo 2>/dev/null | awk "$1" done 2>/dev/null printf -eu then
+"$@" done local 2>/dev/null cd readonly x=1 "$@" 'quoted text' cd readonly 2>/dev/null
+		x=1 done local awk -eu x=1 sed readonly
+	"$@" -eu printf cd x=1 x=1 sed done $(pwd) then
+		$(pwd) "$@" 'quoted text' ${HOME}
+	-eu awk -eu 2>/dev/null done
+	sed sed readonly readonly done echo printf --verbose
+	2>/dev/null sed 'quoted text' readonly local
+	"$@" && awk awk grep x=1 -eu sed && awk && x=1 ${HOME} cd grep test | /usr/bin
+		${HOME} x=1 echo x=1 'quoted text'
+		2>/dev/null | sed test then x=1 done --verbose "$@" 'quoted text' cd $(pwd)
+		awk cd cd test printf awk --verbose ${HOME} && grep echo local
+sed /usr/bin && cd 'quoted text'
+${HOME} x=1 then 2>/dev/null -eu readonly test
+		"$@" export "$@" done $(pwd)
+| "$@" 'quoted text' | cd done 'quoted text' done export sed ${HOME} local
+awk awk | done printf local awk local done done cd test awk
+x=1 /usr/bin grep grep grep /usr/bin
+		readonly | then -eu done && "$1" done then cd readonly test grep
+&& cd sed grep ${HOME} then sed && ${HOME}
+printf "$@" && printf cd sed && /usr/bin "$@" "$1" 'quoted text' /usr/bin
+	x=1 sed sed grep $(pwd) export && then | test x=1 'quoted text'
+	local awk | ${HOME} -eu then cd 'quoted text' export export ${HOME}
+	export awk then readonly test export cd
+${HOME} 2>/dev/null done test sed --verbose && done --verbose
+		--verbose cd echo export
+"$1" local && /usr/bin test --verbose x=1 /usr/bin | awk -eu grep
+readonly x=1 done "$1" && | "$@" -eu x=1
+	then $(pwd) printf then
+export && $(pwd) && printf
+	'quoted text' test 2>/dev/null $(pwd) "$1" then 'quoted text' export
+echo && cd | $(pwd) $(pwd) export x=1 awk awk $(pwd) "$@"
+	echo done sed -eu -eu local ${HOME} echo echo done
+2>/dev/null "$1" printf echo export | 2>/dev/null -eu | echo
+	done sed 'quoted text' sed $(pwd)
+grep test export ${HOME} awk cd | --verbose done /usr/bin -eu then x=1
+	local && readonly readonly "$1" printf 'quoted text' --verbose
+'quoted text' && ${HOME} local done done awk readonly grep
+	--verbose test 2>/dev/null echo $(pwd) && $(pwd) cd done $(pwd)
+		--verbose --verbose printf -eu test 'quoted text' $(pwd) ${HOME} x=1 && ${HOME}
+grep ${HOME} awk "$1" --verbose local -eu
+	echo --verbose -eu echo printf printf $(pwd) --verbose sed done
+| done --verbose --verbose "$1" export awk && cd | | 'quoted text'
+readonly /usr/bin export readonly "$1" | $(pwd) printf x=1 -eu
+		2>/dev/null done done -eu "$1" sed test $(pwd)
+		readonly awk sed printf grep "$1" awk 2>/dev/null
+| test test printf 2>/dev/null x=1
+-eu -eu ${HOME} && local
+2>/dev/null x=1 cd && 'quoted text'
+grep awk awk then printf awk cd -eu 'quoted text'
+		test echo done readonly x=1 && ${HOME} "$1"
+		local --verbose --verbose /usr/bin grep printf done local export -eu then echo
+cd then "$1" "$1" $(pwd) "$1" "$1" printf "$@" 2>/dev/null awk
+	readonly 'quoted text' printf sed -eu test local -eu $(pwd) /usr/bin
+		2>/dev/null x=1 2>/dev/null && --verbose printf
+test x=1 x=1 "$@" $(pwd)
+		export && x=1 test "$@" && readonly
+	done 'quoted text' echo | ${HOME} awk --verbose grep printf --verbose grep $(pwd)
+		grep "$1" -eu done cd local $(pwd) $(pwd) awk
+	2>/dev/null test "$1" sed -eu 'quoted text' --verbose 'quoted text' x=1 /usr/bin
+'quoted text' $(pwd) grep done done | --verbose export 'quoted text'
+echo readonly echo test /usr/bin
+	"$@" /usr/bin "$@" "$@" --verbose ${HOME} ${HOME}
+sed sed test /usr/bin "$1" | --verbose --verbose printf test export local /usr/bin
+		x=1 test ${HOME} /usr/bin x=1 done 2>/dev/null readonly && ${HOME}
+		printf --verbose && local echo cd "$1" "$1"
+	2>/dev/null $(pwd) readonly "$@" && export sed 2>/dev/null then readonly
+	test export cd -eu awk printf awk -eu local local local
+		local ${HOME} ${HOME} ${HOME} "$1" | --verbose
+	--verbose grep "$@" /usr/bin then "$1" "$1" sed export --verbose $(pwd)
+	2>/dev/null --verbose printf grep --verbose "$@" test
+test echo | export ${HOME} x=1 --verbose | then grep x=1 "$1" -eu
+then local readonly 2>/dev/null $(pwd)
+&& 2>/dev/null 2>/dev/null readonly done cd x=1 -eu done && readonly /usr/bin
+cd /usr/bin --verbose readonly --verbose
+		${HOME} export printf /usr/bin ${HOME} "$@"
+		done awk printf export grep | grep test export readonly && then 'quoted text'
+--verbose done local | 2>/dev/null 2>/dev/null echo 'quoted text'
+	test $(pwd) 'quoted text'
+	'quoted text' done | | local then && printf --verbose 2>/dev/null
+x=1 printf readonly cd "$1"
+	echo 2>/dev/null readonly | local printf | sed done --verbose export |
+		| x=1 'quoted text' -eu $(pwd) -eu --verbose export local --verbose
+	test test 'quoted text' local local
+"$1" readonly printf grep $(pwd)
+	x=1 grep then export x=1 --verbose | then 'quoted text'
+	cd export $(pwd) /usr/bin x=1 --verbose "$@" x=1 sed echo x=1 printf local
+	done local grep export 2>/dev/null -eu printf printf awk ${HOME} --verbose
+test $(pwd) done /usr/bin done "$@"
+		-eu && printf echo --verbose grep "$1" -eu then x=1 && awk ${HOME} | $(pwd)
+		"$@" ${HOME} cd /usr/bin "$@" awk
+printf "$@" /usr/bin "$@" "$1" $(pwd)
+	x=1 cd "$@" done $(pwd) --verbose export 2>/dev/null
+x=1 grep printf | 'quoted text' --verbose ${HOME} && awk ${HOME} 2>/dev/null
+	readonly local cd "$@" cd sed cd && readonly cd awk && 'quoted text' -eu test
+export echo "$@" printf grep then readonly readonly x=1 grep x=1 /usr/bin export
+"$1" readonly | /usr/bin /usr/bin echo printf
+		-eu cd printf sed done "$1"
+"$1" echo cd test && sed $(pwd) /usr/bin printf awk
+	cd --verbose 'quoted text' local grep | done "$@" export printf | "$@" 2>/dev/null
+		--verbose ${HOME} printf $(pwd) awk awk cd ${HOME}
+then local local "$@" test export -eu x=1
+	/usr/bin awk $(pwd) ${HOME} 'quoted text' local
+	done "$@" test | cd | -eu /usr/bin done awk x=1
+		x=1 "$@" --verbose x=1 "$@" done echo x=1 echo ${HOME}
+	done printf "$1" readonly 'quoted text'
+		sed --verbose && export 'quoted text'
+	/usr/bin "$1" sed 'quoted text' | -eu printf /usr/bin | done printf
+		x=1 | awk | done awk $(pwd) "$1" grep cd readonly --verbose
+		x=1 test x=1 printf printf $(pwd) export local | echo
+		export $(pwd) then echo readonly
+	2>/dev/null /usr/bin then x=1 cd printf "$1" -eu export readonly
+	/usr/bin -eu && sed awk sed echo then echo
+awk 2>/dev/null readonly 'quoted text' "$@" sed printf sed readonly $(pwd) test
+test sed cd $(pwd) export /usr/bin
+		-eu 2>/dev/null --verbose
+		"$@" printf export local cd printf readonly
+	$(pwd) -eu && awk 2>/dev/null
+	/usr/bin cd "$1" && | 2>/dev/null
+		x=1 printf test 2>/dev/null | "$1"
+awk printf echo -eu test cd awk
+-eu ${HOME} "$1" echo awk grep export x=1 x=1
+	printf local local x=1 awk "$1" export 'quoted text'
+	--verbose done ${HOME} printf "$1" $(pwd) --verbose 2>/dev/null awk
+		local readonly $(pwd) export | test echo export test &&
+	awk local x=1 export awk -eu | --verbose
+printf sed x=1 --verbose cd readonly "$@" ${HOME} awk readonly test
+2>/dev/null 2>/dev/null echo $(pwd) cd local $(pwd) awk -eu done x=1
+--verbose local 'quoted text' 'quoted text' awk --verbose &&
+	test then cd x=1 awk sed "$1" 2>/dev/null "$1" echo --verbose test
+		x=1 export sed --verbose /usr/bin cd $(pwd) "$@" then test
+		awk printf ${HOME} "$@" printf printf then
+		local cd readonly -eu "$1" 'quoted text' --verbose | | 'quoted text'
+	echo | 2>/dev/null cd "$1" readonly --verbose cd readonly
+2>/dev/null readonly && sed x=1 "$1"
+echo echo "$1" 'quoted text' sed $(pwd) $(pwd) ${HOME}
+	${HOME} x=1 done ${HOME} cd echo --verbose 'quoted text' cd -eu -eu "$@" --verbose
+	'quoted text' && /usr/bin "$@" "$@" 'quoted text'
+awk grep 2>/dev/null export "$1" --verbose "$1" | -eu done | sed /usr/bin done
+/usr/bin echo ${HOME} /usr/bin "$1" readonly sed readonly awk echo grep then
+	"$1" 'quoted text' ${HOME} x=1 $(pwd) $(pwd) ${HOME} | then
+		&& sed 'quoted text' grep | cd printf printf ${HOME} --verbose cd
+test done --verbose $(pwd) grep
+		test --verbose sed cd grep "$@" export cd 2>/dev/null
+	local echo && $(pwd) "$@" x=1 2>/dev/null echo export 2>/dev/null ${HOME}
+		--verbose && --verbose then -eu /usr/bin sed | sed readonly cd /usr/bin
+		readonly /usr/bin $(pwd) export test 'quoted text' | test x=1 'quoted text'
+		/usr/bin then awk 'quoted text'
+		-eu echo 2>/dev/null && "$@"
+		x=1 grep export grep local ${HOME} 'quoted text'
+/usr/bin x=1 printf readonly
+grep && readonly | export -eu x=1 "$@" 2>/dev/null export 2>/dev/null "$@" printf
+		readonly export && then /usr/bin -eu
+done x=1 ${HOME} awk sed -eu "$1" awk && "$1" $(pwd) echo sed done
+		done cd cd ${HOME} -eu && test readonly printf | --verbose
+		2>/dev/null 2>/dev/null --verbose
+	x=1 sed echo ${HOME} ${HOME} done /usr/bin ${HOME} done 2>/dev/null
+		${HOME} x=1 echo /usr/bin then printf grep export "$1" local | test | export 2>/dev/null
+--verbose readonly done printf && echo "$@" | $(pwd) && 'quoted text'
+	local 'quoted text' readonly "$1" $(pwd) /usr/bin | x=1 awk cd $(pwd)
+	-eu awk test printf sed local export
+awk -eu echo done echo done | x=1 echo x=1 /usr/bin | "$1" done done "$@" cd
+	| export cd x=1 grep && "$@" 'quoted text'
+		cd test test | awk | | /usr/bin 'quoted text'
+	done ${HOME} grep "$1" done && 2>/dev/null grep
+		&& --verbose export --verbose /usr/bin printf
+		awk test cd "$1" $(pwd) 2>/dev/null
+		x=1 && | && readonly echo x=1 grep /usr/bin $(pwd) --verbose grep
+	cd export $(pwd) --verbose grep local
+	&& cd $(pwd) done printf | echo "$1" grep then "$1"
+	-eu $(pwd) "$@" done echo && -eu grep 2>/dev/null
+&& ${HOME} && grep "$@"
+	x=1 ${HOME} cd grep && && local awk done
+	'quoted text' 'quoted text'
+		&& ${HOME} $(pwd) awk awk readonly
+	x=1 /usr/bin 2>/dev/null awk local done readonly /usr/bin x=1 -eu "$1" local "$1"
+	printf export && --verbose readonly echo "$1" then export
+		/usr/bin export then grep /usr/bin |
+		"$@" && 'quoted text' | printf /usr/bin && x=1 sed done
+grep test printf grep echo -eu local $(pwd) done
+	| export "$1" readonly ${HOME}
+awk then then grep "$1" cd awk test /usr/bin echo /usr/bin
+	then sed "$1" --verbose printf 'quoted text'
+		sed cd | | --verbose cd /usr/bin $(pwd) ${HOME} echo $(pwd) "$@"
+	local 'quoted text' "$1" | done --verbose "$1" x=1
+echo --verbose local then ${HOME} grep -eu -eu then -eu 'quoted text' cd --verbose
+	then sed 'quoted text' then then cd printf --verbose sed printf ${HOME}
+		printf x=1 -eu "$@" awk 'quoted text' local
+cd --verbose 2>/dev/null cd sed 2>/dev/null -eu awk awk cd -eu 2>/dev/null echo
+sed readonly export printf done ${HOME} 2>/dev/null grep printf sed local
+	awk --verbose test -eu | -eu then -eu --verbose 2>/dev/null
+	then cd 'quoted text' "$1" $(pwd) done -eu test done 'quoted text' "$@" -eu $(pwd)
+	-eu awk -eu sed sed done local done
+2>/dev/null printf cd "$@" 2>/dev/null sed sed local test awk readonly
+x=1 cd echo x=1 --verbose "$1" 2>/dev/null sed
+	cd echo sed -eu sed $(pwd) x=1 &&
+		"$1" printf test 2>/dev/null x=1 test x=1 && 2>/dev/null
+	export -eu echo local 'quoted text' x=1 --verbose
+test 'quoted text' sed awk
+"$1" printf /usr/bin -eu 2>/dev/null -eu $(pwd) ${HOME} export sed
+		2>/dev/null done awk then x=1 cd export export --verbose grep then export
+	sed x=1 grep "$@" 2>/dev/null "$1" done && "$@" x=1 | grep /usr/bin
+	sed ${HOME} "$1" readonly sed --verbose x=1 printf | $(pwd) export
+--verbose cd "$@" readonly export /usr/bin awk && --verbose
+	$(pwd) readonly --verbose cd done "$1" ${HOME} x=1 readonly
+	then x=1 $(pwd) "$@" | x=1 echo export printf
+local export 'quoted text' 2>/dev/null sed cd "$@" x=1 ${HOME} readonly
+echo "$1" printf sed $(pwd) test $(pwd) cd grep grep test x=1
+		done $(pwd) cd "$@" printf "$@" printf && echo "$1" --verbose
+		test then awk && sed /usr/bin | "$1" /usr/bin sed "$@"
+		awk && x=1 | "$@" "$1" $(pwd)
+		readonly --verbose --verbose /usr/bin "$@" export export 'quoted text'
+	'quoted text' echo readonly sed awk cd done grep cd -eu
+cd ${HOME} x=1 done test done -eu local cd readonly then /usr/bin &&
+awk && "$@" $(pwd) export x=1 && && && readonly /usr/bin 2>/dev/null
+	$(pwd) ${HOME} $(pwd) x=1 --verbose
+sed done awk sed --verbose readonly -eu
+	/usr/bin 'quoted text' -eu sed then grep
+		grep --verbose cd 'quoted text' && | awk test local readonly printf test /usr/bin
+	readonly "$@" cd test local -eu echo printf ${HOME}
+&& /usr/bin echo awk "$1" test
+test 2>/dev/null --verbose cd test then 2>/dev/null "$1" "$@" awk grep
+	cd sed --verbose /usr/bin 2>/dev/null
+	"$1" -eu --verbose awk then && "$1" printf awk test 'quoted text' &&
+		2>/dev/null 'quoted text' sed "$1" grep x=1 | x=1 -eu -eu echo | done echo ${HOME}
+		cd "$1" grep /usr/bin readonly
+export ${HOME} test sed printf x=1 2>/dev/null export 2>/dev/null
+	test | local test "$@" readonly --verbose x=1 cd -eu /usr/bin --verbose ${HOME}
+	&& then test sed grep done export
+		then sed then 'quoted text' 'quoted text' grep /usr/bin
+		test awk /usr/bin sed 'quoted text' cd /usr/bin ${HOME} $(pwd) test 2>/dev/null
+		'quoted text' echo echo sed
+		awk test "$@" test | local 'quoted text' cd
+		-eu readonly awk $(pwd) local grep printf local $(pwd)
+		local cd && test readonly x=1 export $(pwd) $(pwd)
+		then awk cd ${HOME} "$@" ${HOME} export local
+		sed done 'quoted text' x=1 | 'quoted text' export then
+		| | 2>/dev/null cd readonly && x=1 /usr/bin awk echo ${HOME} ${HOME} --verbose
+sed -eu | /usr/bin 2>/dev/null
+		grep 'quoted text' then 2>/dev/null readonly --verbose cd grep && "$@"
+--verbose "$1" "$1" awk readonly
+/usr/bin "$@" 'quoted text' local | 2>/dev/null sed then cd readonly "$@" --verbose
+/usr/bin echo printf "$@"
+2>/dev/null then echo echo "$1"
+test echo $(pwd) echo export 'quoted text' test echo test done printf printf
+		| test 2>/dev/null sed readonly ${HOME} "$@" /usr/bin then cd done $(pwd)
+	&& ${HOME} test awk "$1" grep grep cd && 2>/dev/null $(pwd) -eu x=1 echo
+	${HOME} ${HOME} --verbose
+"$@" /usr/bin test | "$@" "$1" sed x=1 local | done printf
+	x=1 readonly done 2>/dev/null sed sed 2>/dev/null
+		export readonly --verbose cd /usr/bin -eu sed
+	test | echo ${HOME} /usr/bin grep then done 'quoted text'
+		2>/dev/null printf x=1 "$@" readonly
+		"$@" printf export "$1" /usr/bin export readonly -eu
+	-eu readonly printf $(pwd) grep cd && /usr/bin -eu grep
+local -eu test export $(pwd) local -eu x=1 local echo awk local --verbose
+	export /usr/bin x=1 x=1 /usr/bin printf echo cd local && -eu "$1"
+grep $(pwd) grep -eu local test printf echo | && $(pwd)
+	then 'quoted text' | export local 2>/dev/null $(pwd)
+		-eu $(pwd) printf printf x=1 readonly
+readonly export readonly $(pwd)
+then printf -eu | readonly -eu readonly test done "$1" "$1" | local
+		2>/dev/null x=1 export | printf && "$@" local "$@" cd "$@" readonly
+test ${HOME} 2>/dev/null --verbose done --verbose | grep
+local readonly then export sed local readonly cd | grep
+		"$@" echo -eu ${HOME} export awk && cd /usr/bin cd sed grep $(pwd)
+	echo printf readonly 2>/dev/null 2>/dev/null awk then -eu && "$1"
+		'quoted text' then local export echo "$1"
+	printf "$@" export x=1 | grep readonly
+	printf x=1 /usr/bin 'quoted text'
+	| then && sed && | --verbose test local readonly x=1 && | test awk
+		"$@" && --verbose then && $(pwd) cd 'quoted text' "$1" --verbose then
+2>/dev/null x=1 'quoted text' echo then x=1
+then "$1" awk x=1 done "$1" /usr/bin $(pwd) test ${HOME} -eu grep 'quoted text'
+"$@" $(pwd) local export ${HOME} -eu x=1 $(pwd) "$1" echo --verbose sed x=1 "$@"
+export "$1" grep readonly -eu readonly
+echo && /usr/bin 'quoted text' --verbose ${HOME} x=1 echo 2>/dev/null
+	echo 2>/dev/null "$@" then cd printf /usr/bin
+		done $(pwd) printf echo
+x=1 echo printf /usr/bin | test 2>/dev/null
+"$1" ${HOME} x=1 echo local
+		awk 2>/dev/null --verbose then printf grep export 'quoted text' /usr/bin
+cd "$1" /usr/bin printf /usr/bin sed done grep test test awk "$@"
+		'quoted text' printf export sed echo grep grep local x=1 'quoted text'
+	readonly local grep echo
+	sed "$@" 'quoted text' cd echo && local grep /usr/bin
+2>/dev/null cd | local "$1"
+		"$1" "$@" --verbose printf printf test echo 'quoted text' ${HOME}
+		${HOME} export -eu $(pwd) 'quoted text' 'quoted text' --verbose
+sed ${HOME} printf printf | grep --verbose local test
+	done test test awk --verbose && then --verbose sed
+		export readonly readonly awk done --verbose
+	"$@" x=1 $(pwd) /usr/bin export awk "$1" --verbose x=1 2>/dev/null
+		test grep 2>/dev/null done x=1 "$@" "$@" local --verbose
+	sed "$@" && awk | done done x=1 x=1 echo --verbose local test awk $(pwd)
+done grep $(pwd) x=1 printf --verbose x=1 cd grep "$1" grep printf
+		local "$@" 2>/dev/null $(pwd) 2>/dev/null &&
+		printf x=1 readonly echo 2>/dev/null done
+		done local && ${HOME} 2>/dev/null
+		$(pwd) test done "$1" $(pwd) ${HOME} readonly export 2>/dev/null
+		printf printf cd printf 'quoted text' /usr/bin
+		2>/dev/null && --verbose sed "$@" --verbose $(pwd)
+	x=1 test awk --verbose --verbose
+cd local 'quoted text' local /usr/bin | sed ${HOME}
+		2>/dev/null sed "$@" export x=1 readonly -eu && awk
+	| cd && test awk cd x=1 local | cd printf then 2>/dev/null
+&& grep /usr/bin 'quoted text' x=1 --verbose done --verbose "$1" | grep && x=1
+2>/dev/null then "$1" export then
+x=1 "$1" local 'quoted text' /usr/bin
+awk | "$@" -eu 2>/dev/null grep awk --verbose cd $(pwd) cd sed | ${HOME} grep
+export done echo cd 2>/dev/null then
+		2>/dev/null 2>/dev/null 2>/dev/null test /usr/bin && x=1
+	export -eu cd local /usr/bin "$@" --verbose grep
+		--verbose ${HOME} x=1 cd then |
+awk cd cd | "$@" test echo export && ${HOME} sed export
+then then printf x=1 -eu printf
+export && -eu awk done then "$1"
+	"$@" ${HOME} awk echo --verbose "$@" awk ${HOME}
+done grep printf test x=1 done export local $(pwd) -eu readonly
+	'quoted text' | awk -eu "$1" 'quoted text'
+	--verbose 'quoted text' readonly 2>/dev/null && x=1 done
+x=1 echo echo $(pwd) awk x=1 grep readonly
+		cd export 'quoted text'
+${HOME} echo x=1 -eu export |
+	"$@" "$@" /usr/bin local 2>/dev/null -eu "$1" sed export done
+| local grep --verbose --verbose
+	2>/dev/null export echo printf readonly test
+	/usr/bin ${HOME} ${HOME} --verbose readonly "$@" test printf local done
+		"$@" && -eu cd && "$@" $(pwd) /usr/bin done readonly cd then
+		"$@" "$1" "$@" done cd echo -eu then /usr/bin && test /usr/bin /usr/bin && echo
+	--verbose -eu $(pwd) ${HOME} local awk export
+	grep -eu $(pwd) $(pwd)
+		sed sed $(pwd) printf /usr/bin
+cd echo done ${HOME} cd | "$1" 'quoted text' cd local readonly
+	${HOME} ${HOME} "$1" ${HOME} then test local printf "$@" -eu done local
+		$(pwd) "$1" local $(pwd) 2>/dev/null
+$(pwd) then "$@" 2>/dev/null sed $(pwd) x=1 grep echo
+2>/dev/null grep | test "$@" local test "$1" "$@"
+done echo | test 2>/dev/null /usr/bin
+/usr/bin test grep --verbose && | test --verbose
+	printf -eu local | sed echo sed /usr/bin
+	--verbose x=1 x=1 test 'quoted text' -eu "$1" | grep -eu cd grep
+	&& local 'quoted text' $(pwd) 2>/dev/null
+		"$1" echo ${HOME} -eu grep "$@" 2>/dev/null
+$(pwd) 2>/dev/null && "$1" printf 'quoted text'
+echo awk && test x=1 export "$1"
+| grep /usr/bin | then export -eu "$1" test readonly && awk "$@" 'quoted text'
+		printf grep cd readonly "$@" grep
+grep test done cd 2>/dev/null
+		echo echo then --verbose $(pwd) $(pwd) awk test ${HOME}
+		cd test "$@" -eu done $(pwd) export
+&& 2>/dev/null cd export done | test cd ${HOME} /usr/bin $(pwd)
+		test local sed 2>/dev/null /usr/bin
+$(pwd) /usr/bin "$@" echo local
+local $(pwd) then && $(pwd) 'quoted text'
+done export then ${HOME} ${HOME} test export
+		'quoted text' done "$1" 2>/dev/null cd done echo $(pwd) && -eu
+	export done | echo local echo x=1 awk && cd 2>/dev/null "$@" /usr/bin
+cd --verbose ${HOME} printf test test export awk local awk 'quoted text'
+	grep $(pwd) 2>/dev/null |
+	| printf printf 2>/dev/null
+		grep $(pwd) && -eu done sed export
+		"$@" -eu awk $(pwd) $(pwd) awk ${HOME} echo ${HOME} "$1" ${HOME}
+		test --verbose then ${HOME} /usr/bin grep export sed sed readonly -eu &&
+awk x=1 done "$1" readonly readonly export sed awk -eu local test test done
+	grep /usr/bin -eu printf grep
+		&& sed /usr/bin export printf
+| sed printf 2>/dev/null $(pwd) done $(pwd) --verbose done 'quoted text'
+	echo awk done printf "$1" grep /usr/bin printf export awk awk 'quoted text'
+		test then test -eu 2>/dev/null --verbose awk "$1" awk then test echo
+		export local 'quoted text' export local -eu "$1" cd 'quoted text' 2>/dev/null
+x=1 /usr/bin ${HOME} |
+	cd local x=1 | awk /usr/bin printf
+		export /usr/bin sed export "$@" x=1 done awk "$1" 'quoted text' $(pwd)
+		&& | echo 2>/dev/null sed cd -eu --verbose export awk "$1" "$@" "$1"
+		${HOME} -eu $(pwd) printf
+	| ${HOME} awk | sed /usr/bin "$1" $(pwd) /usr/bin echo echo "$@" --verbose
+	x=1 readonly local echo local done sed cd -eu
+	then -eu grep 2>/dev/null readonly && "$@" x=1 export /usr/bin -eu sed sed cd
+		$(pwd) then echo 'quoted text' /usr/bin export "$1" done
+		| /usr/bin -eu cd test --verbose --verbose $(pwd) | /usr/bin printf && cd grep
+		export "$@" then 2>/dev/null 'quoted text' 2>/dev/null cd readonly 2>/dev/null
+	readonly grep 2>/dev/null grep $(pwd) test
+readonly x=1 sed done grep cd local
+		export "$1" 2>/dev/null --verbose
+		$(pwd) $(pwd) x=1 awk "$1" readonly printf then
+sed | awk printf && test then x=1 awk grep sed "$@" "$@" "$@" /usr/bin --verbose
+	| 'quoted text' export cd -eu x=1 export && 'quoted text'
+2>/dev/null done ${HOME} printf grep test sed sed $(pwd) then
+x=1 test done 2>/dev/null export "$1" done x=1 export sed export
+$(pwd) local then local x=1 readonly x=1
+then ${HOME} 'quoted text' --verbose | grep
+		${HOME} 2>/dev/null sed local done 2>/dev/null
+	readonly "$@" 'quoted text' -eu grep done
+local 'quoted text' -eu then | cd "$@"
+	local readonly then -eu
+	$(pwd) then readonly sed readonly grep
+test "$@" then awk readonly then
+--verbose x=1 -eu | cd
+| readonly $(pwd) $(pwd) /usr/bin /usr/bin
+		x=1 x=1 printf -eu "$@" grep $(pwd) done grep readonly "$@" awk
+export "$1" printf export && ${HOME} local 'quoted text' export then -eu echo "$@"
+		--verbose 2>/dev/null /usr/bin then "$1" grep --verbose
+--verbose cd done done ${HOME} "$@" echo
+test | ${HOME} sed 2>/dev/null 2>/dev/null -eu ${HOME} && $(pwd)
+	done readonly $(pwd) sed --verbose /usr/bin
+		echo done x=1 && "$1" local 2>/dev/null then test grep local
+	'quoted text' | 'quoted text'
+	readonly --verbose $(pwd) awk 'quoted text' x=1 done printf printf 2>/dev/null
+	-eu && test grep --verbose grep --verbose ${HOME} 2>/dev/null
+	test -eu local "$@" then && ${HOME} grep readonly test grep $(pwd) then
+		x=1 sed 2>/dev/null | /usr/bin --verbose x=1
+		x=1 "$@" sed 'quoted text'
+		echo "$1" x=1 ${HOME} test
+--verbose -eu | export done test export --verbose &&
+	$(pwd) ${HOME} test ${HOME} cd 'quoted text' && --verbose
+cd 'quoted text' $(pwd) ${HOME} 2>/dev/null &&
+test printf echo | $(pwd) "$@" | | echo then | then cd echo /usr/bin then test
+	sed "$@" --verbose cd "$1" "$1" "$@" readonly echo "$@" cd local done export
+		done cd --verbose readonly then $(pwd) then readonly $(pwd) done echo -eu
+	sed $(pwd) grep readonly readonly readonly export test
+printf awk readonly 2>/dev/null test 'quoted text'
+		$(pwd) ${HOME} printf then readonly readonly test then --verbose ${HOME}
+		grep 2>/dev/null printf done
+/usr/bin cd "$1" printf
+	done printf $(pwd) readonly x=1 test grep "$1" -eu "$1" export echo
+		done $(pwd) echo "$1" && "$@" echo printf grep | -eu "$1" && $(pwd)
+grep ${HOME} local | | sed -eu echo awk x=1 done -eu "$1" local
+awk cd done 'quoted text'
+		${HOME} 'quoted text' readonly ${HOME} ${HOME} local "$1" then sed && 'quoted text'
+	readonly x=1 echo -eu printf grep test $(pwd)
+		export 2>/dev/null local 2>/dev/null awk local ${HOME}
+	-eu -eu readonly 2>/dev/null --verbose
+		export | awk then 'quoted text'
+		grep x=1 grep /usr/bin ${HOME} awk x=1 2>/dev/null
+x=1 | ${HOME} local printf readonly then -eu printf ${HOME}
+	local --verbose printf
+grep echo awk export ${HOME} done ${HOME} echo cd | test && then test
+		${HOME} local cd 'quoted text' | printf "$1" then readonly
+"$@" then local echo x=1 && "$1" x=1 /usr/bin echo 'quoted text' cd
+	export | -eu grep --verbose
+	${HOME} -eu export "$1" awk echo --verbose cd && -eu export
+$(pwd) -eu readonly | readonly sed readonly grep | "$@" then export test test
+	"$1" x=1 cd 2>/dev/null $(pwd) $(pwd)
+$(pwd) awk echo awk ${HOME}
+		2>/dev/null /usr/bin local
+local awk $(pwd) echo && done -eu -eu then test ${HOME} awk local &&
+printf grep /usr/bin x=1 done echo echo export sed test -eu -eu -eu done && $(pwd)
+-eu readonly cd /usr/bin then printf
+		"$@" /usr/bin then "$@" cd -eu 'quoted text' awk x=1 "$@" "$@" 2>/dev/null
+	done $(pwd) 'quoted text' x=1
+		printf readonly echo 2>/dev/null done && printf "$@" "$1" cd | ${HOME} -eu -eu
+/usr/bin readonly export test --verbose
+		sed local export sed echo
+		cd done 'quoted text' sed --verbose
+		cd readonly 'quoted text' -eu && 'quoted text' /usr/bin
+		sed cd $(pwd) grep echo "$1" x=1 'quoted text' grep $(pwd) 'quoted text'
+		'quoted text' readonly sed 'quoted text' | done x=1
+	echo && | /usr/bin x=1 cd test -eu ${HOME} test $(pwd) ${HOME}
+		export --verbose --verbose x=1 awk -eu done grep /usr/bin sed test sed x=1 readonly
+/usr/bin export done 2>/dev/null
+		local 'quoted text' | awk grep
+		then x=1 "$1" --verbose cd awk
+	printf /usr/bin "$1" echo cd
+-eu export && 2>/dev/null
+		test ${HOME} "$@" then export export | ${HOME} awk -eu cd "$1"
+	&& "$@" ${HOME} then local | && ${HOME} 2>/dev/null sed awk local $(pwd) export
+		'quoted text' local $(pwd) -eu $(pwd) -eu $(pwd) awk x=1 /usr/bin
+		"$1" test test ${HOME} export ${HOME} &&
+--verbose "$1" -eu "$@" "$1" done x=1 "$@" test | x=1 readonly
+local /usr/bin readonly awk export grep -eu $(pwd)
+-eu printf local sed local awk
+		$(pwd) grep done && | grep | ${HOME}
+		then printf ${HOME} "$1" | sed && local readonly -eu -eu readonly $(pwd) 'quoted text'
+cd $(pwd) sed cd --verbose 2>/dev/null 'quoted text' echo -eu cd grep 2>/dev/null
+${HOME} cd ${HOME} /usr/bin export
+		2>/dev/null $(pwd) grep readonly /usr/bin local done awk cd 'quoted text' /usr/bin
+		2>/dev/null $(pwd) test test | && /usr/bin "$@" test "$1"
+$(pwd) local -eu then local -eu && "$@" awk local
+		sed printf "$1" readonly
+	2>/dev/null then test grep local cd x=1 -eu
+then /usr/bin /usr/bin echo grep sed grep | "$@" "$@" 'quoted text'
+	cd 'quoted text' $(pwd) "$@" x=1 "$@" 'quoted text'
+		"$1" -eu "$1" then "$@" x=1 $(pwd) $(pwd) test 'quoted text'
+	done printf local -eu readonly
+awk readonly ${HOME} 2>/dev/null
+		&& -eu echo 'quoted text' done sed sed $(pwd) --verbose
+		$(pwd) test | awk readonly 'quoted text' $(pwd) then test 'quoted text' test
+test sed printf printf echo 'quoted text'
+--verbose echo readonly readonly 'quoted text'
+"$@" readonly awk awk -eu | 'quoted text'
+	cd sed 2>/dev/null ${HOME} test /usr/bin printf && 2>/dev/null
+		x=1 $(pwd) && local export 2>/dev/null
+-eu printf 'quoted text' ${HOME} awk printf --verbose 2>/dev/null
+x=1 "$@" printf export 2>/dev/null
+	cd | done 'quoted text'
+	| && readonly readonly cd then then $(pwd) printf 'quoted text' ${HOME} then
+		"$1" --verbose -eu test "$1" then $(pwd) && && "$1" 2>/dev/null
+	done $(pwd) --verbose /usr/bin
+"$@" x=1 readonly 2>/dev/null test echo sed sed
+	x=1 sed -eu "$1" /usr/bin
+	readonly then local | printf $(pwd)
+	"$@" grep readonly x=1 2>/dev/null cd sed printf 2>/dev/null
+	${HOME} grep done then 2>/dev/null readonly "$@" -eu && sed ${HOME}
+	/usr/bin cd local 2>/dev/null cd ${HOME} --verbose --verbose
+	-eu then grep then then grep 'quoted text'
+		-eu -eu done $(pwd) test sed $(pwd) then awk /usr/bin local /usr/bin | && sed 2>/dev/null
+		cd local echo | local grep local cd $(pwd) local
+	grep -eu 'quoted text' grep -eu "$1" $(pwd) |
+2>/dev/null -eu local /usr/bin awk
+		"$@" x=1 ${HOME} | cd awk sed local printf readonly done done 2>/dev/null "$@"
+		-eu $(pwd) ${HOME} --verbose printf -eu 2>/dev/null
+		'quoted text' done export && printf grep then 2>/dev/null
+		grep then local -eu -eu grep grep --verbose
+	"$@" "$1" grep 'quoted text' readonly then cd cd awk x=1 grep /usr/bin "$@"
+test "$@" test 'quoted text' | ${HOME} 2>/dev/null export
+	-eu echo then export | "$1" then
+		"$@" /usr/bin echo test cd done export readonly
+	/usr/bin export awk ${HOME} awk "$@" local "$1" sed readonly
+then -eu "$@" /usr/bin 'quoted text'
+sed local | 2>/dev/null sed echo printf then local $(pwd)
+"$1" printf export grep test "$@" echo echo
+	export -eu done "$1" grep export done "$@"
+	$(pwd) 2>/dev/null grep local "$@" done --verbose awk --verbose readonly --verbose
+	cd awk printf -eu readonly | awk
+${HOME} && && readonly
+	${HOME} then test echo $(pwd) local | ${HOME}
+	2>/dev/null cd -eu export $(pwd) readonly "$1" readonly | then cd
+&& printf $(pwd) "$1" -eu done ${HOME} ${HOME}
+x=1 test printf awk -eu export ${HOME} $(pwd) $(pwd) 2>/dev/null printf grep export
+awk /usr/bin test done "$@" test 2>/dev/null | awk sed export local
+$(pwd) local cd grep export -eu && | && --verbose local test x=1 /usr/bin
+	awk echo then 'quoted text' --verbose readonly
+		-eu echo 'quoted text' cd awk --verbose then grep
+	export echo readonly | echo "$@" --verbose x=1
+	${HOME} then | cd grep cd 2>/dev/null
+| 'quoted text' x=1 echo cd | grep -eu grep && test
+awk printf done ${HOME} 'quoted text' readonly
+	'quoted text' done "$1" test 'quoted text' then
+		${HOME} "$1" $(pwd) ${HOME} --verbose test -eu 2>/dev/null
+	sed "$1" "$1" 'quoted text' --verbose
+cd grep test 2>/dev/null "$1"
+--verbose /usr/bin -eu echo ${HOME} | /usr/bin awk local cd 'quoted text'
+	cd done -eu 2>/dev/null --verbose printf 2>/dev/null done "$1" && test | readonly
+		readonly cd $(pwd) cd sed "$@" grep "$1" awk awk
+printf done sed test && $(pwd) echo $(pwd) "$1" "$1" printf readonly x=1 &&
+done cd sed done done done
+		--verbose grep local readonly --verbose "$@" 2>/dev/null done sed /usr/bin ${HOME}
+	$(pwd) export ${HOME} 'quoted text' $(pwd) then cd done sed
+		echo --verbose $(pwd) $(pwd) echo x=1 'quoted text' printf && done sed 'quoted text'
+cd done --verbose export test cd test echo | local grep then "$@"
+| export -eu echo "$@" -eu $(pwd) "$1" "$@"
+awk then echo | cd test -eu "$@" export && && 'quoted text' printf printf
+		export awk readonly $(pwd) | local done | --verbose export /usr/bin
+&& --verbose x=1 export printf cd done local awk then printf "$@"
+&& printf -eu printf awk cd 2>/dev/null --verbose && "$@" readonly local
+cd ${HOME} printf /usr/bin $(pwd) done sed awk && local grep readonly -eu /usr/bin
+--verbose 'quoted text' local 2>/dev/null then test sed x=1
+		-eu echo grep test 'quoted text'
+/usr/bin test "$@" grep
+	&& 2>/dev/null -eu echo "$@" grep readonly
+grep /usr/bin && export $(pwd) cd grep | sed cd | "$@"
+		echo local awk -eu done 2>/dev/null 2>/dev/null grep -eu done
+	printf $(pwd) | readonly then 'quoted text'
+	then done 'quoted text' sed x=1 cd local /usr/bin 2>/dev/null $(pwd) readonly
+	export && test test echo cd readonly local sed readonly
+	echo ${HOME} then echo test test grep ${HOME}
+		"$1" ${HOME} readonly $(pwd) -eu /usr/bin printf x=1 'quoted text'
+	-eu 2>/dev/null "$@" awk local -eu
+		test export export readonly
+	sed sed done printf --verbose $(pwd) $(pwd) printf awk 2>/dev/null
+| done x=1 awk sed local
+--verbose grep "$1" ${HOME} export printf 2>/dev/null
+	| 2>/dev/null then 2>/dev/null test test echo cd | ${HOME} x=1 echo ${HOME} &&
+		export local printf /usr/bin && readonly export
+		sed local 2>/dev/null | x=1 test 2>/dev/null "$@" 'quoted text'
+		2>/dev/null "$1" export /usr/bin -eu x=1 cd | /usr/bin x=1 cd $(pwd) readonly
+echo && /usr/bin 'quoted text' awk "$1" | readonly $(pwd)
+export | printf local 2>/dev/null
+		grep export 2>/dev/null then printf /usr/bin grep | sed awk 2>/dev/null ${HOME}
+		test && ${HOME} then -eu cd local
+		export done --verbose done && "$1" readonly grep /usr/bin grep
+readonly test && awk 'quoted text' ${HOME} -eu readonly printf
+		sed && --verbose test "$1" --verbose && && ${HOME}
+		2>/dev/null --verbose printf "$@" "$1" cd $(pwd) readonly sed echo
+export 2>/dev/null ${HOME} ${HOME}
+printf readonly -eu done readonly -eu readonly awk
+test done sed --verbose done grep "$@" 'quoted text' | 'quoted text'
+	2>/dev/null ${HOME} 2>/dev/null done |
+grep sed readonly test local --verbose echo 'quoted text'
+| test cd local | echo done
+		$(pwd) -eu | sed awk awk printf then done $(pwd) readonly grep
+		${HOME} sed x=1 done readonly && $(pwd) 2>/dev/null 2>/dev/null local
+		'quoted text' export then grep cd export
+then 2>/dev/null export ${HOME} cd
+	sed ${HOME} echo test "$1" "$1" 2>/dev/null && x=1 /usr/bin then readonly
+		2>/dev/null test awk 'quoted text' 'quoted text'
+	--verbose x=1 sed printf readonly local 'quoted text' "$@" echo readonly | 'quoted text'
+${HOME} export /usr/bin cd
+	local local x=1 "$1" -eu $(pwd)
+		"$1" local $(pwd) grep --verbose
+$(pwd) -eu printf sed | && echo 'quoted text' export -eu printf printf
+| && export "$@" export readonly $(pwd) && | printf then
+	x=1 "$@" x=1 2>/dev/null --verbose | "$@" 2>/dev/null
+export local 'quoted text' 'quoted text' 'quoted text' grep
+	sed then awk readonly "$1" -eu echo $(pwd) "$1" "$@" 2>/dev/null --verbose
+then ${HOME} grep /usr/bin cd echo sed /usr/bin awk awk printf
+	$(pwd) grep 2>/dev/null
+done ${HOME} local $(pwd) sed printf then --verbose
+		-eu cd export 'quoted text'
+		2>/dev/null ${HOME} done printf $(pwd)
+local cd 'quoted text' | "$@" /usr/bin then
+$(pwd) ${HOME} awk x=1 /usr/bin cd 2>/dev/null echo | sed local 'quoted text'
+		echo cd | "$1" done --verbose echo readonly readonly
+'quoted text' then printf done local sed --verbose x=1 sed -eu
+	--verbose --verbose | "$@" 2>/dev/null grep
+		-eu then "$1" readonly
+done then local echo /usr/bin x=1 export 'quoted text' local cd printf | "$@"
+		cd test sed echo grep x=1 done echo --verbose -eu ${HOME} 'quoted text'
+/usr/bin then $(pwd) 'quoted text'
+		--verbose readonly echo
+		awk ${HOME} -eu -eu "$@" 'quoted text' "$1" && 'quoted text' --verbose --verbose
+	cd && -eu -eu ${HOME} local export export /usr/bin
+		/usr/bin sed /usr/bin 'quoted text' "$@" -eu --verbose awk test 'quoted text'
+		/usr/bin "$@" -eu then 2>/dev/null echo done
+		&& export sed 2>/dev/null "$1" 'quoted text'
+	&& echo test export sed local | test test echo
+	export && done export readonly
+		readonly grep 'quoted text' then | && x=1 awk ${HOME} | test /usr/bin
+printf sed echo echo && x=1 awk local && then "$@" |
+awk 2>/dev/null local 'quoted text' "$1" && then
+		x=1 && 'quoted text' export sed | export printf local 2>/dev/null local then
+	$(pwd) 'quoted text' test printf awk local -eu echo
+echo awk /usr/bin ${HOME} then cd
+		${HOME} printf sed | echo grep "$1" cd export
+$(pwd) /usr/bin 2>/dev/null then export $(pwd)
+		then grep && echo "$1" readonly local export 2>/dev/null readonly sed x=1 sed "$1"
+	'quoted text' | done printf done /usr/bin test 'quoted text' ${HOME}
+${HOME} --verbose 2>/dev/null --verbose
+	x=1 | $(pwd) then /usr/bin 'quoted text'
+	awk export | --verbose ${HOME} sed grep local
+	/usr/bin echo local | | "$@" /usr/bin --verbose
+$(pwd) cd /usr/bin sed readonly
+-eu grep sed && echo 'quoted text'
+/usr/bin && 2>/dev/null test local awk readonly
+		test 'quoted text' readonly
+		2>/dev/null "$1" echo then --verbose printf sed awk /usr/bin /usr/bin
+--verbose awk cd $(pwd) x=1 cd printf 'quoted text' $(pwd) x=1 ${HOME} && grep 2>/dev/null
+$(pwd) | echo test done ${HOME} echo export sed local "$1" then export
+		grep $(pwd) $(pwd) cd -eu /usr/bin
+	then | sed test local sed printf cd "$@" 'quoted text' grep ${HOME} export
+		then echo ${HOME} sed "$1" 2>/dev/null
+	cd export done readonly cd done && x=1 export cd echo 'quoted text'
+	'quoted text' -eu test --verbose "$@" -eu ${HOME} -eu "$@" sed export readonly
+		| done $(pwd) awk 2>/dev/null 2>/dev/null
+$(pwd) 'quoted text' "$@" printf done && -eu x=1 ${HOME} readonly
+	| 'quoted text' printf grep echo
+sed -eu printf cd /usr/bin ${HOME} 2>/dev/null readonly readonly x=1 -eu ${HOME}
+--verbose /usr/bin cd /usr/bin echo | test "$1" 2>/dev/null echo done grep
+export && export test sed local
+		"$@" done && readonly 2>/dev/null x=1 /usr/bin printf cd readonly sed 2>/dev/null
+	grep $(pwd) test "$1" x=1 /usr/bin printf | && cd echo 2>/dev/null
+	cd cd export echo /usr/bin x=1 && 'quoted text' export | "$@" -eu /usr/bin --verbose
+test awk local awk cd readonly && /usr/bin
+	'quoted text' cd cd "$1" test awk x=1 $(pwd) --verbose "$1" test
+		printf ${HOME} | x=1 /usr/bin $(pwd) printf grep done
+	$(pwd) awk grep $(pwd)
+		$(pwd) sed test 'quoted text' export "$1" awk then -eu printf awk grep $(pwd)
+		cd x=1 then "$1" | --verbose 2>/dev/null
+	local test | 2>/dev/null
+		cd cd sed x=1 $(pwd) grep sed done "$1" ${HOME} "$1" 'quoted text'
+		export /usr/bin /usr/bin then local x=1 done
+then ${HOME} x=1 awk test /usr/bin -eu echo echo echo
+	grep local $(pwd) cd export
+		x=1 | --verbose -eu "$@" awk awk grep 'quoted text' sed -eu
+-eu awk x=1 && /usr/bin | --verbose --verbose --verbose echo grep -eu
+	/usr/bin awk /usr/bin done "$1" "$@" sed printf done ${HOME} readonly then 2>/dev/null
+| readonly -eu -eu "$1" "$@" x=1 "$@" | printf 2>/dev/null sed grep
+		readonly done 2>/dev/null --verbose
+		awk --verbose cd done "$@" echo printf printf done /usr/bin
+/usr/bin $(pwd) ${HOME} test then 'quoted text' --verbose
+grep local local export --verbose local 'quoted text' done
+		then export ${HOME} 2>/dev/null 'quoted text' test export 2>/dev/null test then
+local | local echo export
+	export local cd echo cd -eu then "$1" cd sed local test printf
+		-eu 'quoted text' then grep $(pwd)
+x=1 && echo 2>/dev/null x=1 "$1" -eu -eu grep test
+	'quoted text' -eu printf sed 'quoted text' "$@" $(pwd) printf "$1" | "$@"
+	"$@" cd /usr/bin then x=1 "$@" printf
+		local sed x=1 | readonly x=1 local awk done done echo x=1 "$@" awk "$@"
+cd $(pwd) $(pwd) printf grep /usr/bin "$1" /usr/bin local x=1 2>/dev/null
+	&& cd export done readonly ${HOME}
+/usr/bin then echo ${HOME} -eu $(pwd) "$1" printf
+		/usr/bin awk export && "$1" echo "$@" awk "$@"
+"$@" cd /usr/bin "$1" -eu /usr/bin echo test
+		| sed && ${HOME} awk awk ${HOME} $(pwd) -eu test "$@"
+		| | "$1" --verbose printf --verbose sed | 2>/dev/null
+${HOME} | awk x=1 'quoted text' "$1" 2>/dev/null grep awk readonly then
+	printf then done $(pwd) echo local test then done
+		--verbose sed x=1 -eu 'quoted text'
+	${HOME} local done 'quoted text' | /usr/bin
+awk awk then sed then printf cd grep test --verbose "$@" | printf readonly
+	done | 2>/dev/null printf -eu sed grep ${HOME} ${HOME} x=1
+	'quoted text' readonly grep cd sed grep export export readonly done local test
+		$(pwd) then | "$1" "$@" readonly
+	$(pwd) --verbose echo $(pwd) sed 'quoted text' done sed "$@" done
+	$(pwd) ${HOME} echo done then /usr/bin 2>/dev/null export ${HOME}
+		awk x=1 readonly readonly
+	printf 'quoted text' sed && done /usr/bin
+done local test done done
+	&& printf ${HOME} local echo ${HOME}
+	export cd | awk printf x=1
+-eu export done awk cd "$1" --verbose grep
+		printf printf test printf
+		/usr/bin x=1 echo echo awk 'quoted text' grep
+${HOME} "$@" sed /usr/bin --verbose 'quoted text' -eu $(pwd) $(pwd) && readonly
+	| cd echo x=1 --verbose cd done --verbose ${HOME}
+		| && cd "$@" then local readonly echo "$1" $(pwd) ${HOME}
+		${HOME} printf done cd test "$@" awk then then export $(pwd) cd
+"$1" | --verbose local grep echo
+	"$@" cd echo readonly awk ${HOME} done local local local test
+		| readonly readonly ${HOME} printf
+	/usr/bin /usr/bin awk cd printf 2>/dev/null --verbose $(pwd) printf /usr/bin
+	done grep then readonly 2>/dev/null $(pwd) grep "$1" echo
+${HOME} x=1 grep x=1 grep printf --verbose
+		awk ${HOME} 'quoted text' x=1 && test "$1" awk "$@"
+	printf && echo then x=1
+		"$@" /usr/bin done x=1 local "$@" | test export /usr/bin $(pwd)
+		grep ${HOME} echo test readonly cd -eu 'quoted text'
+--verbose && echo then $(pwd) 'quoted text' readonly
+	grep then | local done | "$@" done echo x=1 cd 2>/dev/null
+readonly sed "$1" done local --verbose awk
+		printf then 2>/dev/null sed -eu echo readonly
+	2>/dev/null "$1" then && local "$1" grep "$1" awk test then done echo then
+		"$@" 2>/dev/null ${HOME} | | "$@" then
+		local /usr/bin echo && && grep && -eu echo | printf
+then test awk 'quoted text' done local
+grep x=1 printf /usr/bin then 'quoted text' ${HOME} echo test
+	grep "$@" export 2>/dev/null test readonly
+		printf done then && ${HOME} readonly "$@" then then grep grep 2>/dev/null
+local cd $(pwd) | --verbose local $(pwd) readonly "$1" local && echo
+		-eu 'quoted text' readonly export "$1" ${HOME} then x=1 printf readonly
+	${HOME} "$@" 2>/dev/null
+		'quoted text' test | ${HOME}
+	then readonly printf --verbose "$1" test ${HOME}
+	"$1" printf /usr/bin "$@" printf awk "$@" -eu
+		test && grep && then "$1" test 'quoted text' "$@" x=1 local local
+		-eu then readonly | export ${HOME} then --verbose --verbose printf -eu export
+	&& sed && grep export x=1 | $(pwd) 'quoted text' --verbose sed done
+	"$1" local test done $(pwd) then 2>/dev/null 'quoted text' -eu local sed test grep
+		awk export then x=1 "$@" ${HOME} $(pwd) "$1" test sed /usr/bin
+		printf echo printf grep --verbose | awk | then 2>/dev/null cd done sed 2>/dev/null
+		export echo export x=1 --verbose local then readonly && export
+sed grep -eu "$1" done local "$1" ${HOME} --verbose
+done | "$1" grep --verbose $(pwd) grep test 2>/dev/null $(pwd)
+	local echo readonly echo 2>/dev/null test
+	readonly test grep | echo readonly $(pwd) |
+/usr/bin "$@" /usr/bin 'quoted text' x=1 | echo export | --verbose /usr/bin
+		grep $(pwd) "$1" "$1" 'quoted text' echo done --verbose printf
+	printf grep printf "$@" ${HOME} --verbose -eu && printf
+x=1 cd then x=1 "$1" cd grep ${HOME} && sed sed x=1 export printf
+"$@" 'quoted text' then grep && printf echo "$@" printf echo readonly
+2>/dev/null /usr/bin printf awk done readonly printf
+		$(pwd) then 2>/dev/null export "$1" --verbose
+		readonly -eu awk | then test --verbose
+	grep && $(pwd) -eu local printf printf local ${HOME} |
+		then 'quoted text' ${HOME} 2>/dev/null --verbose /usr/bin sed 'quoted text' -eu
+	${HOME} grep /usr/bin readonly "$@" local
+		x=1 readonly local done && && cd echo
+	export 'quoted text' $(pwd) grep sed cd cd -eu local -eu readonly grep
+$(pwd) /usr/bin printf "$@" export x=1 $(pwd)
+cd | -eu --verbose "$@" then printf
+grep "$1" export ${HOME} printf sed /usr/bin | awk then 'quoted text' -eu
+&& --verbose local $(pwd) local && echo sed /usr/bin /usr/bin echo
+		&& /usr/bin x=1 --verbose ${HOME} $(pwd) ${HOME} printf readonly
+		awk 2>/dev/null && 2>/dev/null grep
+	--verbose awk then grep "$1" $(pwd) cd ${HOME} grep 'quoted text'
+	| echo "$1" readonly -eu done -eu | | cd x=1 "$1" cd x=1 awk
+	x=1 | /usr/bin grep && | test "$1" ${HOME} --verbose "$1"
+local test -eu grep /usr/bin echo
+		cd 2>/dev/null 'quoted text' x=1 sed export export local then
+done && done printf $(pwd) && awk grep ${HOME} export awk local ${HOME}
+		then /usr/bin 'quoted text' x=1 $(pwd) awk --verbose 'quoted text' /usr/bin
+&& 'quoted text' "$1" export
+		/usr/bin test echo ${HOME} ${HOME} echo x=1 awk "$@" grep $(pwd) done | export grep
+		export 2>/dev/null x=1 export ${HOME} --verbose --verbose 'quoted text'
+		sed readonly printf "$@"
+sed done export readonly cd export sed "$@" 'quoted text'
+		'quoted text' "$1" 'quoted text' /usr/bin "$1" awk
+x=1 cd ${HOME} -eu "$@"
+cd readonly /usr/bin readonly && --verbose export && export
+	&& x=1 sed done test /usr/bin --verbose
+done then x=1 "$1" && x=1 test printf 'quoted text'
+${HOME} printf test x=1 ${HOME} then export awk "$@" readonly test /usr/bin $(pwd)
+	/usr/bin export 2>/dev/null
+		2>/dev/null x=1 'quoted text' 2>/dev/null && test
+	"$@" echo ${HOME} "$@" && done grep
+	-eu && awk test awk 2>/dev/null
+	printf test -eu -eu "$@" && "$1" readonly
+		echo export grep "$1" ${HOME}
+	"$@" $(pwd) awk echo done ${HOME} readonly $(pwd) 2>/dev/null sed test
+then 'quoted text' | local awk local
+	x=1 printf local export $(pwd) test "$1" export echo "$@" $(pwd) --verbose | readonly
+sed $(pwd) 'quoted text'
+cd -eu export -eu readonly awk done | grep "$@" cd --verbose 2>/dev/null /usr/bin
+		then local 'quoted text' cd done && 2>/dev/null done echo done
+		sed echo local echo 2>/dev/null
+		local then -eu 'quoted text' readonly readonly && then
+	export grep | local done awk x=1 sed done
+		cd && grep sed /usr/bin grep readonly grep cd 2>/dev/null
+		/usr/bin /usr/bin x=1 /usr/bin 2>/dev/null -eu "$@" x=1 | /usr/bin 2>/dev/null
+test ${HOME} 2>/dev/null awk echo "$@" then /usr/bin "$1" --verbose
+		-eu cd "$1" 'quoted text' ${HOME} x=1 --verbose
+		done ${HOME} readonly
+		"$@" awk "$1" --verbose then | local echo grep
+	"$@" /usr/bin printf sed sed awk
+		| readonly local x=1 x=1 export readonly readonly 'quoted text' ${HOME}
+		readonly 'quoted text' echo $(pwd) readonly "$1" test test -eu | printf x=1 grep
+	$(pwd) readonly then $(pwd) --verbose printf awk --verbose
+printf grep 'quoted text' -eu x=1 test echo --verbose -eu --verbose /usr/bin
+| && ${HOME} x=1 grep test test awk 2>/dev/null | awk grep export
+awk "$@" "$@" "$@" awk done $(pwd) $(pwd) x=1
@@ -0,0 +1,2001 @@
+grep -eu done local x=1 && readonly | echo local
+		| done --verbose -eu export sed grep test "$1" | --verbose ${HOME}
+	"$1" "$@" printf readonly readonly sed "$1" awk echo "$@" echo
+		x=1 /usr/bin done export printf $(pwd) done cd | sed
+		export /usr/bin grep grep local "$1" 2>/dev/null readonly "$@" 2>/dev/null
+	&& export | awk readonly readonly /usr/bin done readonly
+	export then && grep export
+	echo x=1 "$1" -eu $(pwd) 'quoted text' done "$1"
+	/usr/bin readonly 'quoted text' && /usr/bin x=1 $(pwd) test | 2>/dev/null sed printf
+		readonly then export test
+	grep | 2>/dev/null done
+	then readonly then done --verbose --verbose $(pwd) sed --verbose
+"$@" --verbose local | "$1" $(pwd) | x=1 2>/dev/null "$@" ${HOME} |
+"$@" done done awk | sed ${HOME}
+test 'quoted text' /usr/bin x=1 'quoted text'
+	&& local && /usr/bin printf && "$1"
+		'quoted text' printf $(pwd) 2>/dev/null 2>/dev/null $(pwd) done | sed done
+		sed -eu export done 2>/dev/null
+		$(pwd) /usr/bin sed echo && echo $(pwd) /usr/bin 2>/dev/null
+	"$1" && && then -eu "$1" echo $(pwd) printf 2>/dev/null
+	| grep "$@" ${HOME} | grep test awk /usr/bin "$1" --verbose printf
+		then ${HOME} export 2>/dev/null $(pwd) grep export readonly ${HOME} awk done
+echo echo grep printf readonly /usr/bin
+		sed awk sed | "$@" done local --verbose grep
+	x=1 --verbose done done
+	done /usr/bin done then test /usr/bin echo printf /usr/bin
+'quoted text' x=1 "$@" --verbose 2>/dev/null
+	export | | awk then cd $(pwd) | "$@" $(pwd) x=1
+	"$@" sed "$@" test | ${HOME} local done "$1" $(pwd) awk done ${HOME}
+	done 'quoted text' x=1 export
+cd then $(pwd) $(pwd) x=1 'quoted text' awk ${HOME}
+grep 2>/dev/null local 2>/dev/null echo | printf readonly /usr/bin
+		awk 2>/dev/null /usr/bin done test sed $(pwd) x=1 readonly
+	local echo test done 'quoted text' "$@" x=1 printf | $(pwd) then --verbose
+	/usr/bin ${HOME} export test
+		/usr/bin x=1 "$@" awk 'quoted text' local echo --verbose --verbose
+/usr/bin "$1" $(pwd) export -eu export && "$@" "$1" sed export printf 2>/dev/null
+${HOME} 'quoted text' sed sed "$1" grep "$@" then x=1 $(pwd) "$1" && "$1"
+	done -eu /usr/bin 'quoted text' echo /usr/bin 'quoted text'
+--verbose "$1" | readonly 2>/dev/null
+-eu then readonly -eu /usr/bin local
+		readonly export "$@" x=1 echo test -eu export printf then then sed
+	/usr/bin sed | 'quoted text' 'quoted text' $(pwd) then $(pwd) -eu
+	local 2>/dev/null -eu test
+	'quoted text' ${HOME} then $(pwd)
+/usr/bin printf local awk local -eu && cd
+-eu $(pwd) | export grep sed cd awk 'quoted text' -eu cd /usr/bin
+	export $(pwd) awk awk awk x=1 | echo -eu "$@" sed done --verbose "$1" test
+local ${HOME} --verbose /usr/bin 'quoted text' grep
+	/usr/bin "$@" printf --verbose -eu then
+	"$1" x=1 then 'quoted text' test test -eu done sed "$1" then 'quoted text' test
+	then awk sed echo && local sed $(pwd) | awk x=1 $(pwd)
+	"$@" grep x=1 && -eu "$1" then | sed then $(pwd) | ${HOME}
+	"$@" --verbose 2>/dev/null local echo cd x=1 | grep 2>/dev/null && -eu
+	sed --verbose && x=1 echo printf test sed 'quoted text'
+local echo export | /usr/bin printf grep --verbose
+		$(pwd) done /usr/bin -eu grep awk export export $(pwd) $(pwd) /usr/bin awk
+	then readonly "$@" /usr/bin 2>/dev/null
+sed $(pwd) test cd test x=1 ${HOME} grep awk echo grep --verbose && done sed
+		| done ${HOME} /usr/bin "$1" readonly && readonly ${HOME} local awk local
+	"$@" then done readonly local local
+echo -eu | 'quoted text' "$@" $(pwd) echo x=1
+	grep export | grep done "$1" && 2>/dev/null local ${HOME} "$1" sed
+$(pwd) "$1" done export test /usr/bin readonly ${HOME} done grep cd
+		/usr/bin test 'quoted text'
+grep test sed && && /usr/bin -eu "$@" "$1" local export
+then $(pwd) 'quoted text' 'quoted text' "$@" cd sed --verbose echo sed export
+	then 'quoted text' cd "$1" -eu "$@" echo "$1" $(pwd) cd test --verbose
+	echo test then local /usr/bin | x=1 sed test done /usr/bin
+	then cd -eu ${HOME} grep --verbose ${HOME} x=1 x=1 | $(pwd) readonly done
+	/usr/bin $(pwd) ${HOME} ${HOME} /usr/bin then --verbose
+	readonly "$@" ${HOME} local
+		"$1" "$1" sed grep readonly echo done export 2>/dev/null
+	done 2>/dev/null cd printf --verbose sed && sed export
+'quoted text' grep "$@" -eu printf 'quoted text' 'quoted text'
+	cd ${HOME} && echo 2>/dev/null -eu printf ${HOME}
+--verbose cd printf --verbose cd 2>/dev/null sed "$@" $(pwd) ${HOME} awk
+2>/dev/null | --verbose cd awk readonly grep &&
+		then export /usr/bin awk -eu
+	-eu sed --verbose then ${HOME} "$@" echo && 2>/dev/null x=1 grep
+	printf echo cd awk $(pwd) local --verbose awk grep "$@" ${HOME} awk --verbose
+	grep && x=1 cd test 'quoted text' $(pwd) export --verbose | export done
+		printf 2>/dev/null printf && grep then "$1" sed "$@" grep cd
+	2>/dev/null echo "$1" awk ${HOME} cd sed -eu | done grep awk "$1" done 2>/dev/null
+	test cd | && 2>/dev/null test sed test then cd grep 2>/dev/null
+		printf --verbose readonly export "$@" /usr/bin echo | local
+	${HOME} export cd awk grep 2>/dev/null
+readonly done && grep cd | test x=1 $(pwd) "$1" echo /usr/bin export
+		${HOME} "$@" "$1" "$@" then | test then printf local $(pwd) test done --verbose
+		echo x=1 "$1" ${HOME} local | -eu local -eu && "$1" grep
+		local 2>/dev/null echo awk "$1" then printf sed done "$@" readonly
+	sed export "$1" readonly "$@" --verbose printf $(pwd)
+		then test | "$1" 'quoted text'
+test grep test echo then test cd x=1 printf test 2>/dev/null cd 2>/dev/null done
+		--verbose --verbose 'quoted text' export echo
+x=1 test cd done grep x=1 done sed "$@"
+	"$@" echo test x=1 "$1" cd sed 2>/dev/null echo echo grep
+		$(pwd) sed readonly cd
+"$@" export local grep $(pwd)
+--verbose export export && sed
+"$@" 2>/dev/null echo echo test readonly export 2>/dev/null grep awk
+		'quoted text' $(pwd) | --verbose printf done
+2>/dev/null ${HOME} x=1 printf
+local ${HOME} 2>/dev/null export printf export ${HOME} local readonly --verbose
+$(pwd) local sed | --verbose then then &&
+	&& x=1 'quoted text' -eu echo test echo
+then sed export cd /usr/bin /usr/bin 'quoted text' grep -eu "$1"
+		"$@" cd test grep && --verbose
+	local readonly cd 'quoted text' done done x=1 "$@" $(pwd) readonly
+		"$@" local readonly 'quoted text' awk grep
+--verbose test printf && grep | cd sed grep
+	&& local printf awk --verbose grep done | 2>/dev/null sed
+		$(pwd) && | x=1 --verbose 2>/dev/null
+	printf echo x=1 /usr/bin --verbose test local printf test
+test local $(pwd) cd then | printf readonly --verbose --verbose
+		"$1" export 2>/dev/null --verbose readonly /usr/bin done test ${HOME} grep
+	awk 2>/dev/null then 'quoted text'
+	| then --verbose x=1 then done readonly 'quoted text' | done sed | "$@" test
+	test printf sed echo test 2>/dev/null
+		--verbose local then -eu $(pwd)
+	$(pwd) done x=1 readonly local /usr/bin x=1 ${HOME} "$@" sed "$@"
+	x=1 then | ${HOME} then 2>/dev/null sed -eu
+		--verbose -eu "$@" done "$@" ${HOME} then
+	grep "$1" awk printf grep export -eu 2>/dev/null
+		export x=1 readonly local 2>/dev/null sed /usr/bin
+${HOME} printf grep grep then && done && readonly cd 2>/dev/null &&
+x=1 x=1 'quoted text' cd then then ${HOME} printf echo 2>/dev/null
+${HOME} && 'quoted text' then --verbose $(pwd) local --verbose readonly done
+		"$@" ${HOME} export local | -eu $(pwd) printf
+		x=1 "$@" -eu 'quoted text' grep 'quoted text' $(pwd) readonly then
+	'quoted text' grep then 2>/dev/null 'quoted text' done
+	export "$@" grep ${HOME} local $(pwd) -eu readonly
+/usr/bin --verbose export cd cd 2>/dev/null
+		-eu echo done grep /usr/bin export "$@" && 2>/dev/null "$@" echo
+		${HOME} cd export readonly -eu 'quoted text' "$@" "$@" | sed
+	"$1" --verbose cd -eu export printf
+done readonly sed /usr/bin | export && /usr/bin printf done $(pwd) $(pwd) 'quoted text'
+&& "$@" awk | /usr/bin "$1" --verbose awk cd -eu 'quoted text' ${HOME}
+	awk -eu cd then ${HOME} /usr/bin sed -eu awk -eu $(pwd) && sed /usr/bin x=1 grep
+	| "$@" readonly -eu then echo test 2>/dev/null
+then test ${HOME} x=1 readonly local
+		grep awk export ${HOME} /usr/bin x=1 && then -eu test local printf
+cd $(pwd) printf $(pwd) ${HOME} local /usr/bin -eu 'quoted text' && echo "$@"
+		export local then then local 2>/dev/null
+--verbose "$@" awk done cd "$@" grep -eu ${HOME} ${HOME} | |
+/usr/bin echo 2>/dev/null 'quoted text' 2>/dev/null | "$1" 'quoted text'
+		x=1 done | "$@" /usr/bin cd && then
+	"$@" grep printf 2>/dev/null 'quoted text'
+printf | test x=1 && then then grep | cd
+&& --verbose | test sed "$@" done 2>/dev/null
+	local sed x=1 'quoted text' /usr/bin $(pwd) -eu local
+	cd 2>/dev/null export /usr/bin x=1 cd
+		2>/dev/null grep awk printf readonly /usr/bin
+	x=1 -eu $(pwd) readonly test export
+"$1" ${HOME} readonly x=1 test
+	2>/dev/null export then awk --verbose done sed 2>/dev/null
+done | --verbose ${HOME} test
+		x=1 -eu $(pwd) local test $(pwd) 'quoted text' grep | ${HOME} --verbose then
+	then readonly awk x=1
+"$1" echo ${HOME} -eu 2>/dev/null 2>/dev/null /usr/bin readonly test -eu sed "$@"
+	--verbose test done --verbose /usr/bin cd 'quoted text' $(pwd) done readonly ${HOME}
+2>/dev/null /usr/bin readonly --verbose ${HOME} --verbose local $(pwd) 'quoted text'
+	2>/dev/null | $(pwd) && export printf
+	$(pwd) readonly x=1 /usr/bin awk && && --verbose
+	'quoted text' -eu readonly export "$1" done -eu awk &&
+	2>/dev/null "$@" "$1" ${HOME} && --verbose grep grep "$1" sed x=1 awk printf
+	--verbose 'quoted text' | ${HOME} sed test "$@" && export | &&
+	${HOME} grep echo grep 'quoted text' test
+cd -eu x=1 echo --verbose x=1
+	echo /usr/bin | grep echo x=1 "$@" sed
+/usr/bin sed local "$@" | readonly && $(pwd) grep sed
+		&& -eu echo -eu echo ${HOME}
+		sed && grep 'quoted text' grep
+	"$1" printf then done
+		test export local "$1" /usr/bin grep local 2>/dev/null
+		x=1 grep "$@" 2>/dev/null test printf --verbose
+		grep | 2>/dev/null test export export grep $(pwd) cd ${HOME} done -eu ${HOME}
+	done local readonly --verbose cd 2>/dev/null
+		"$1" readonly $(pwd) "$@" x=1 ${HOME}
+		local /usr/bin local local grep "$@" then awk printf
+		"$@" awk x=1 | | cd | grep 'quoted text'
+		| grep && local printf cd local 'quoted text' local
+		"$1" done ${HOME} test local -eu done 'quoted text'
+	"$@" x=1 x=1 "$@" "$@" 'quoted text' && $(pwd) sed sed
+then done cd grep echo ${HOME} 'quoted text'
+	cd local readonly export readonly cd 'quoted text' 2>/dev/null
+sed 'quoted text' /usr/bin "$@" cd /usr/bin -eu readonly -eu
+&& sed $(pwd) echo export 'quoted text'
+		-eu done then $(pwd) "$1" && ${HOME} ${HOME} done local
+	x=1 local ${HOME} /usr/bin "$1" ${HOME} local
+	export done 'quoted text' "$@" awk export then -eu
+		--verbose --verbose 'quoted text' 'quoted text'
+printf /usr/bin | printf
+	| --verbose 2>/dev/null 'quoted text' export
+'quoted text' x=1 && && awk printf
+	'quoted text' test x=1 "$1"
+| then 'quoted text' ${HOME} x=1 awk -eu && cd printf
+		printf "$@" sed "$1" test local x=1 "$1" | readonly awk $(pwd) then
+awk export echo && -eu echo readonly then
+2>/dev/null test grep grep
+"$@" sed "$1" export x=1 sed then ${HOME} "$1" done $(pwd)
+grep 'quoted text' test cd export x=1 "$@" export test test
+	test "$@" 'quoted text' /usr/bin
+--verbose cd sed ${HOME} | readonly then 'quoted text' printf
+		local 'quoted text' $(pwd) then local "$@" test awk --verbose awk awk ${HOME}
+	printf && x=1 sed grep "$@" -eu && done -eu -eu local echo /usr/bin
+		${HOME} grep export 'quoted text'
+export && "$1" done export && awk -eu cd --verbose
+		--verbose 'quoted text' 2>/dev/null -eu | | /usr/bin "$1" export echo
+	then && grep done done test /usr/bin
+readonly done export -eu printf local -eu && cd readonly $(pwd) ${HOME} done
+"$@" ${HOME} printf cd sed -eu grep grep
+'quoted text' grep local local && "$@" --verbose | "$1"
+done ${HOME} echo /usr/bin 'quoted text' grep local $(pwd)
+		$(pwd) "$1" && 2>/dev/null $(pwd) test sed
+	done test sed grep 'quoted text' /usr/bin then cd done local
+done /usr/bin ${HOME} awk -eu printf | | 2>/dev/null
+	"$1" /usr/bin --verbose done x=1 $(pwd) local echo "$@" ${HOME} "$@"
+'quoted text' | x=1 then local printf /usr/bin printf done printf 'quoted text'
+test "$@" "$1" --verbose x=1 "$@" readonly local $(pwd) awk "$@" 2>/dev/null --verbose
+${HOME} sed local done sed "$1" readonly
+	grep && $(pwd) printf test cd -eu "$@" echo ${HOME} "$@" "$@" sed | test export
+		| local "$@" export echo readonly echo echo grep 'quoted text'
+	&& | --verbose echo test "$1"
+then -eu x=1 && x=1 $(pwd)
+	"$@" 2>/dev/null export ${HOME} test printf local readonly awk x=1 2>/dev/null
+cd printf | /usr/bin /usr/bin echo done $(pwd) ${HOME}
+		grep local --verbose sed test ${HOME}
+echo $(pwd) awk echo readonly --verbose done echo export "$@" readonly then
+"$@" test | ${HOME} cd $(pwd) cd sed test done x=1
+readonly awk x=1 --verbose 'quoted text' export awk
+		awk && --verbose sed 'quoted text' then "$@" "$@" sed 2>/dev/null export 'quoted text'
+/usr/bin local /usr/bin local
+		grep echo grep 'quoted text' local "$1" grep "$@" local export
+"$@" -eu 'quoted text' local
+	x=1 /usr/bin /usr/bin | | x=1 grep -eu && "$1" /usr/bin "$@" cd | "$1" test
+		&& x=1 'quoted text' awk 2>/dev/null grep export then export
+'quoted text' printf 'quoted text' sed then /usr/bin readonly
+		local export export cd 2>/dev/null x=1 $(pwd) /usr/bin x=1 then
+		done "$@" /usr/bin export then 'quoted text' sed readonly ${HOME}
+local sed printf awk grep then cd ${HOME} cd /usr/bin sed /usr/bin sed $(pwd)
+"$1" "$@" 'quoted text' 'quoted text' echo done "$@" -eu --verbose ${HOME}
+	-eu awk test 2>/dev/null && grep grep ${HOME} $(pwd) readonly sed done
+local echo ${HOME} echo "$1" 2>/dev/null "$@" 'quoted text'
+	$(pwd) /usr/bin && x=1 'quoted text' "$1" awk $(pwd) /usr/bin
+'quoted text' | awk printf export awk cd then 2>/dev/null
+	printf 'quoted text' x=1 cd echo
+	sed $(pwd) ${HOME} "$1"
+		printf "$@" echo awk /usr/bin --verbose
+cd | -eu grep echo 2>/dev/null then | && && printf sed "$@" echo cd awk
+	export echo local -eu
+		then local grep done test done 2>/dev/null grep && grep local
+		'quoted text' ${HOME} | 'quoted text' 'quoted text' ${HOME}
+	local "$@" $(pwd) readonly sed test -eu 2>/dev/null
+| -eu x=1 sed 2>/dev/null x=1 test --verbose &&
+readonly 2>/dev/null /usr/bin grep x=1 "$1" && "$1" local
+		$(pwd) | 'quoted text' && 2>/dev/null echo $(pwd) echo
+| ${HOME} x=1 readonly ${HOME} x=1 "$1" cd cd printf readonly test export "$@"
+printf awk && "$@" printf $(pwd) | grep echo | readonly awk printf
+"$@" && "$@" | awk | export "$1" && awk 2>/dev/null awk -eu printf ${HOME}
+	--verbose done readonly export "$1" 'quoted text'
+	test done "$1" "$1" --verbose ${HOME} 'quoted text'
+		&& /usr/bin | | test done
+		-eu done x=1 "$@" && ${HOME} 'quoted text' 'quoted text'
+	echo then done 2>/dev/null "$@" /usr/bin
+	readonly done printf --verbose /usr/bin done awk "$@" --verbose
+		export -eu | --verbose 'quoted text' x=1 cd "$1" "$1" export cd
+	-eu | 'quoted text' grep grep readonly
+		local && awk cd local grep sed "$1" awk printf
+	cd local /usr/bin awk export
+test --verbose sed && grep /usr/bin $(pwd) /usr/bin test done cd export && cd
+		then readonly $(pwd) /usr/bin x=1 ${HOME} 'quoted text' 2>/dev/null
+then "$@" then ${HOME} grep 'quoted text' --verbose
+	cd x=1 x=1 --verbose printf local "$1"
+		${HOME} test test echo 2>/dev/null
+	'quoted text' /usr/bin 2>/dev/null -eu local "$@" $(pwd) printf
+		local "$@" cd "$@" && ${HOME} 'quoted text' "$@" awk ${HOME} grep grep "$@"
+	echo local cd && $(pwd) done $(pwd) awk awk printf /usr/bin
+	local --verbose export $(pwd) sed "$1" "$@" grep x=1 2>/dev/null grep &&
+		test done awk printf then then grep export test echo echo $(pwd) 2>/dev/null
+		cd 'quoted text' /usr/bin done echo x=1 sed test
+		$(pwd) x=1 -eu --verbose | readonly awk $(pwd) awk done
+		x=1 cd x=1 --verbose --verbose test
+	"$1" "$1" "$@" cd printf printf sed cd --verbose printf $(pwd) export local
+	"$1" --verbose then cd && cd "$1" awk /usr/bin local "$@"
+		'quoted text' /usr/bin --verbose
+export export done cd sed
+	then sed /usr/bin "$@"
+$(pwd) test sed --verbose sed 'quoted text'
+	export 'quoted text' /usr/bin sed | then echo awk readonly
+"$@" local then /usr/bin export --verbose -eu -eu $(pwd) 2>/dev/null
+	${HOME} "$1" export awk /usr/bin && grep export 2>/dev/null echo /usr/bin grep "$@"
+	--verbose then awk /usr/bin
+/usr/bin ${HOME} -eu | $(pwd) local local cd -eu
+local 2>/dev/null echo cd 2>/dev/null awk test sed -eu 'quoted text' local then
+export cd sed sed x=1 cd then && x=1 | "$1" --verbose local then then
+		printf test sed 2>/dev/null done ${HOME}
+then 'quoted text' grep -eu cd ${HOME} && && sed sed && sed printf $(pwd) done
+${HOME} | x=1 export "$1" local done 2>/dev/null then --verbose printf export
+	grep export awk grep cd "$@" "$@" --verbose grep sed /usr/bin
+		echo "$@" ${HOME} sed 2>/dev/null
+		cd export ${HOME} echo "$1" --verbose
+	&& /usr/bin export 'quoted text' ${HOME} --verbose echo $(pwd) "$1"
+		$(pwd) sed then x=1 "$@" awk local echo ${HOME} done && sed export && echo
+'quoted text' 2>/dev/null cd "$1" "$@" grep 'quoted text' /usr/bin
+	readonly echo readonly grep
+		cd 2>/dev/null --verbose grep echo readonly ${HOME} /usr/bin
+		readonly then --verbose | test local -eu cd grep sed $(pwd) $(pwd)
+	x=1 $(pwd) x=1 'quoted text' x=1 'quoted text' sed
+"$@" grep sed 2>/dev/null "$1" --verbose local awk | $(pwd) | -eu
+	x=1 sed -eu && && export | test 'quoted text' 2>/dev/null
+		echo "$1" then readonly "$1" "$1" then done
+	grep && export local
+	| | readonly then then echo printf "$@" echo --verbose
+	&& then export awk ${HOME} done echo && grep sed && sed grep readonly
+	"$@" done ${HOME} then test | ${HOME} readonly "$@" ${HOME} 2>/dev/null
+		'quoted text' 'quoted text' --verbose 2>/dev/null then 2>/dev/null | "$@" 2>/dev/null
+	"$@" --verbose "$@" "$1"
+	local sed awk x=1 awk cd $(pwd) echo
+	"$1" readonly awk test "$@"
+printf done sed awk sed 'quoted text' test sed then printf 'quoted text' 'quoted text'
+		done sed $(pwd) x=1 then grep cd "$1" -eu grep
+		local --verbose sed export done cd | local | done echo awk
+	done $(pwd) | printf echo /usr/bin export 2>/dev/null printf done sed done
+-eu ${HOME} --verbose /usr/bin --verbose local /usr/bin "$@" --verbose -eu
+	2>/dev/null readonly -eu readonly
+grep done readonly echo awk 'quoted text' "$1" cd /usr/bin cd --verbose 2>/dev/null
+	test done grep $(pwd) cd -eu "$@" cd ${HOME} x=1 grep printf "$1" /usr/bin
+--verbose $(pwd) sed export echo test done printf cd /usr/bin $(pwd) "$@"
+	-eu grep grep && ${HOME} local grep printf 2>/dev/null then export local
+		done /usr/bin export
+		--verbose ${HOME} then /usr/bin echo cd export
+	'quoted text' grep awk && "$1" then then --verbose
+	${HOME} readonly export --verbose readonly grep "$1" grep && $(pwd) 2>/dev/null
+		x=1 then test echo printf sed cd "$1" done ${HOME} cd "$@" printf then sed
+grep 2>/dev/null 2>/dev/null ${HOME} | 2>/dev/null 'quoted text'
+	readonly local done "$1" grep && 'quoted text' 'quoted text'
+		&& ${HOME} -eu sed --verbose export then
+x=1 'quoted text' $(pwd) local done sed then grep
+		2>/dev/null "$1" then | "$1" --verbose $(pwd) done "$@" test "$1" "$@" cd
+done awk "$1" grep echo 2>/dev/null x=1 ${HOME} then done test
+readonly && done echo x=1 ${HOME} "$1" "$1" readonly
+		sed test && x=1 'quoted text' export | /usr/bin
+		$(pwd) awk && grep cd sed export
+	printf x=1 x=1 readonly 'quoted text'
+		-eu | -eu "$@" readonly
+printf $(pwd) sed echo readonly cd && | echo printf | local awk
+sed echo -eu 'quoted text' echo /usr/bin local then
+	x=1 'quoted text' test $(pwd) sed echo $(pwd) "$@" ${HOME}
+	$(pwd) then test done "$@" && test sed | "$@" awk sed --verbose
+sed sed printf readonly 2>/dev/null readonly done |
+	export sed && readonly 2>/dev/null 'quoted text' export cd -eu readonly
+| | "$1" readonly test printf export ${HOME}
+	cd printf sed cd /usr/bin && done grep test |
+		then export test /usr/bin cd -eu readonly && cd printf export local printf
+	done test $(pwd) | 2>/dev/null test export sed printf printf x=1 x=1 then /usr/bin
+		$(pwd) done -eu "$1" --verbose && 2>/dev/null ${HOME}
+		${HOME} awk done then
+		${HOME} "$@" && export x=1 x=1 grep 2>/dev/null 2>/dev/null awk "$1" && --verbose
+		awk readonly | echo "$@" test 'quoted text' "$@" "$1" echo | awk 'quoted text'
+then $(pwd) "$1" readonly "$1" $(pwd)
+	-eu --verbose test done local | grep done test awk then
+		grep 2>/dev/null $(pwd) $(pwd) --verbose cd ${HOME}
+		then then done grep 'quoted text' readonly 2>/dev/null "$@" sed
+		"$1" then x=1 cd done test test
+		'quoted text' done readonly
+		${HOME} | "$@" then ${HOME} export | x=1 "$@"
+		"$1" readonly echo ${HOME} readonly -eu cd |
+grep "$1" then sed | awk readonly /usr/bin local 'quoted text' 'quoted text' echo
+		cd then awk 'quoted text' then sed cd
+		/usr/bin sed echo done && test 2>/dev/null "$1" $(pwd) readonly | ${HOME}
+/usr/bin export --verbose done readonly
+$(pwd) then x=1 grep 'quoted text'
+		cd echo awk "$1" printf -eu $(pwd) echo sed "$@" -eu | --verbose
+	awk readonly printf awk printf echo /usr/bin printf sed export "$1"
+		printf local && $(pwd) && awk done | echo "$1" done sed echo grep
+printf awk && export echo done ${HOME} -eu /usr/bin
+/usr/bin "$1" grep done "$1" | test && echo -eu done printf $(pwd) awk | readonly
+	2>/dev/null grep export && grep -eu x=1 -eu
+readonly | --verbose $(pwd) grep grep printf then $(pwd) 'quoted text'
+	&& $(pwd) export grep $(pwd) "$@"
+-eu && readonly | -eu "$@" 2>/dev/null local awk ${HOME} | /usr/bin done
+	--verbose 'quoted text' && printf grep local $(pwd) test "$@" /usr/bin -eu sed
+	sed awk -eu done awk readonly && --verbose | echo grep /usr/bin readonly
+$(pwd) then test && awk printf /usr/bin grep printf && 2>/dev/null -eu ${HOME}
+$(pwd) cd awk ${HOME} --verbose export $(pwd) /usr/bin
+	-eu awk $(pwd) then echo
+		'quoted text' printf grep local $(pwd) x=1 /usr/bin
+	readonly grep test --verbose readonly "$@" local cd readonly ${HOME} test $(pwd)
+	then grep then sed cd --verbose 2>/dev/null
+		'quoted text' 2>/dev/null cd "$1" sed grep then grep cd x=1
+2>/dev/null "$1" $(pwd) awk awk sed 2>/dev/null sed /usr/bin test x=1 'quoted text'
+-eu x=1 test 2>/dev/null && "$@" ${HOME} "$@" "$@" 2>/dev/null
+test && readonly "$1" && test
+--verbose 'quoted text' test done cd cd readonly -eu grep 2>/dev/null
+done readonly /usr/bin | cd
+		export -eu awk echo echo | grep echo local /usr/bin | 'quoted text' grep
+--verbose && sed "$1" sed readonly && done -eu test
+	&& cd then "$1" ${HOME} printf $(pwd) test /usr/bin ${HOME} grep x=1
+		readonly --verbose printf cd test "$1" export
+	echo readonly 'quoted text' echo 2>/dev/null
+		done done export readonly 2>/dev/null 'quoted text'
+"$@" readonly test awk "$1" cd test export done echo 'quoted text' x=1 local
+		/usr/bin "$@" echo /usr/bin
+	readonly echo 'quoted text' local 2>/dev/null --verbose grep "$@" then
+		awk export --verbose x=1 done echo -eu local 'quoted text' $(pwd) sed &&
+		export x=1 printf grep | -eu grep && awk then
+	'quoted text' "$@" -eu --verbose readonly ${HOME} sed grep ${HOME} x=1 local cd
+-eu then "$@" cd done 2>/dev/null grep $(pwd)
+		&& 2>/dev/null readonly cd
+sed $(pwd) done --verbose 2>/dev/null echo awk -eu 2>/dev/null export && grep
+"$@" 'quoted text' | && test done sed $(pwd) export done sed
+'quoted text' "$1" export --verbose
+	$(pwd) awk then 2>/dev/null && cd readonly done then --verbose printf ${HOME}
+		local printf -eu | "$@" "$1" "$1" 2>/dev/null --verbose
+	then $(pwd) -eu readonly export "$@"
+sed cd done sed cd awk ${HOME} done
+		"$1" done "$1" sed grep -eu && local awk readonly awk export local --verbose
+	| sed printf export --verbose "$@" readonly && /usr/bin
+	'quoted text' --verbose awk cd sed x=1 "$@" echo
+	awk $(pwd) $(pwd) echo sed awk "$1" x=1 /usr/bin 'quoted text'
+then cd export -eu /usr/bin
+		local 2>/dev/null echo ${HOME} ${HOME} export $(pwd) sed sed grep export
+sed echo x=1 "$1" local export "$@" done sed readonly printf 'quoted text' local
+-eu x=1 "$@" /usr/bin echo -eu 'quoted text' | "$@" | awk export sed cd
+		"$@" export 2>/dev/null readonly
+		"$@" /usr/bin 'quoted text' 2>/dev/null then "$@" awk printf local "$1" --verbose
+	cd $(pwd) /usr/bin then 2>/dev/null cd --verbose
+| x=1 readonly ${HOME} /usr/bin -eu /usr/bin "$1" test && 'quoted text' printf
+	2>/dev/null 2>/dev/null sed --verbose /usr/bin
+local | 2>/dev/null readonly x=1
+		| export readonly --verbose
+	&& sed $(pwd) cd echo x=1 sed x=1 cd local 'quoted text'
+x=1 && awk "$@" --verbose printf
+		export cd -eu cd then local x=1 ${HOME} sed echo "$1" awk sed "$@" sed /usr/bin
+		/usr/bin x=1 export x=1 cd readonly
+2>/dev/null echo printf "$@" x=1 ${HOME} awk
+	"$1" "$@" cd "$1" done /usr/bin printf 2>/dev/null | -eu x=1 local
+	cd -eu && then export --verbose grep printf export local | grep 2>/dev/null readonly
+	done /usr/bin /usr/bin "$@" printf export sed 'quoted text' -eu
+		then $(pwd) test local -eu local ${HOME} echo readonly test test export | "$1"
+		${HOME} local && grep export
+		done && "$@" $(pwd) readonly "$@" | ${HOME} 2>/dev/null x=1 ${HOME}
+	2>/dev/null sed echo x=1 awk then | test echo
+	${HOME} 'quoted text' awk sed -eu -eu sed 2>/dev/null 'quoted text'
+	local | 2>/dev/null --verbose x=1 sed cd ${HOME}
+	done && echo sed echo local && ${HOME} export local
+	2>/dev/null done /usr/bin |
+| test export "$@" test then 'quoted text'
+	done | then $(pwd) 'quoted text' -eu "$@" cd local then --verbose
+		/usr/bin 'quoted text' then test local readonly
+		awk local 'quoted text' | x=1 2>/dev/null
+	/usr/bin && x=1 "$1" cd cd --verbose printf
+		export x=1 --verbose --verbose awk ${HOME} printf ${HOME}
+	test sed "$@" | "$@" cd && $(pwd)
+2>/dev/null "$@" $(pwd) $(pwd)
+		export test sed ${HOME} local grep printf "$1" x=1 "$1" test 2>/dev/null "$@"
+test x=1 test awk done sed ${HOME} echo 'quoted text' -eu local
+	2>/dev/null /usr/bin x=1 $(pwd) -eu local printf "$1"
+	--verbose x=1 grep "$1" --verbose printf
+x=1 sed test /usr/bin done done "$@" test && then
+x=1 -eu cd local 2>/dev/null --verbose awk export /usr/bin
+		/usr/bin 'quoted text' 'quoted text' test awk x=1 /usr/bin grep echo $(pwd)
+		x=1 --verbose export 2>/dev/null "$@" test 'quoted text' && grep local readonly
+		$(pwd) | export grep -eu && readonly
+	"$@" echo ${HOME} 2>/dev/null
+'quoted text' local test
+		/usr/bin /usr/bin cd 'quoted text' -eu test printf x=1 cd readonly
+	--verbose "$@" printf then echo "$1" "$1" | then
+	$(pwd) sed 2>/dev/null cd grep done "$@" awk done cd x=1 x=1 echo local readonly
+		grep test sed $(pwd) -eu test x=1 echo done printf
+awk grep ${HOME} cd /usr/bin | | --verbose local sed
+	sed ${HOME} printf printf
+awk $(pwd) -eu sed readonly then
+	--verbose export test then $(pwd) 2>/dev/null x=1
+		printf 2>/dev/null sed "$@" /usr/bin && $(pwd) 'quoted text' export done x=1
+-eu ${HOME} echo echo printf "$1" 2>/dev/null grep echo 'quoted text' echo
+	grep | 2>/dev/null "$1"
+sed export printf $(pwd) | "$@" then sed test grep echo "$@" sed -eu x=1 echo
+	"$@" awk sed then --verbose
+		cd done -eu /usr/bin "$1" x=1 local | cd echo -eu "$1"
+grep echo printf readonly
+		x=1 $(pwd) grep -eu ${HOME} echo
+	-eu export cd /usr/bin /usr/bin grep -eu then cd awk
+x=1 && sed -eu awk $(pwd) -eu
+	"$1" export --verbose "$@" then /usr/bin &&
+	echo grep $(pwd) echo ${HOME} done -eu ${HOME}
+	"$1" 'quoted text' && --verbose export then 2>/dev/null printf && --verbose
+		-eu && $(pwd) --verbose --verbose then | "$@" awk | grep ${HOME} $(pwd)
+export && ${HOME} $(pwd) local test
+| -eu echo "$1" then -eu printf readonly x=1 then cd test
+&& | 2>/dev/null $(pwd) -eu awk 'quoted text' readonly 2>/dev/null
+	-eu ${HOME} && local test && printf "$1" ${HOME} readonly ${HOME}
+		/usr/bin 'quoted text' -eu cd -eu 'quoted text' test printf grep
+sed /usr/bin grep echo "$1" cd --verbose sed ${HOME}
+	/usr/bin 'quoted text' -eu local --verbose local --verbose printf --verbose
+	readonly printf $(pwd) --verbose awk readonly
+	"$1" -eu "$1" "$1" --verbose then -eu /usr/bin ${HOME} sed
+	2>/dev/null /usr/bin --verbose grep $(pwd) --verbose --verbose /usr/bin --verbose
+	${HOME} | /usr/bin awk awk then x=1 awk grep $(pwd) grep done && awk "$@"
+	export readonly test cd sed done local x=1 test printf cd 'quoted text'
+2>/dev/null 2>/dev/null 'quoted text' sed $(pwd) printf printf
+		test ${HOME} "$@" "$1" printf done && --verbose | | export
+--verbose local ${HOME} then echo then grep printf "$1"
+	--verbose then test | && grep
+sed -eu $(pwd) 'quoted text' printf
+		export --verbose x=1 "$1" -eu cd -eu sed "$1" x=1 ${HOME} readonly local echo
+$(pwd) 'quoted text' x=1 2>/dev/null | echo cd &&
+		export export $(pwd) --verbose export sed 2>/dev/null
+sed test --verbose /usr/bin 2>/dev/null "$1" done sed /usr/bin local sed export
+	readonly echo "$1" --verbose echo |
+		$(pwd) done /usr/bin --verbose 2>/dev/null 2>/dev/null cd local -eu ${HOME} "$@"
+		test | "$@" x=1 export x=1 "$@"
+		echo readonly | "$1" awk grep test
+local sed grep 2>/dev/null
+		readonly cd done | done export cd local
+	&& echo | $(pwd) && "$@"
+		"$@" /usr/bin awk /usr/bin export
+		-eu | 2>/dev/null 2>/dev/null
+		"$1" test local then &&
+	test grep "$@" cd sed -eu test
+	printf awk done 'quoted text' then printf 'quoted text' test printf
+		${HOME} "$1" export awk cd $(pwd) 'quoted text' test --verbose
+--verbose --verbose $(pwd) test readonly x=1
+printf awk x=1 "$@" -eu awk 2>/dev/null x=1 awk
+	awk test done echo printf local sed printf -eu
+		local 'quoted text' echo 2>/dev/null && echo 'quoted text' x=1
+	'quoted text' x=1 'quoted text' --verbose ${HOME} echo ${HOME} test
+2>/dev/null echo "$1" $(pwd) then /usr/bin | echo grep "$@" then
+	echo grep awk | 'quoted text' then then local test grep -eu export /usr/bin
+	$(pwd) grep ${HOME} export --verbose "$1" awk sed ${HOME} x=1 /usr/bin
+		awk "$@" && grep echo /usr/bin 2>/dev/null then "$1" test sed --verbose awk
+		x=1 $(pwd) grep --verbose test 2>/dev/null
+	"$1" /usr/bin -eu export test 2>/dev/null | cd -eu cd /usr/bin sed ${HOME} ${HOME}
+		"$1" grep "$@" printf readonly cd awk awk $(pwd) sed 'quoted text' then export
+local done export then 2>/dev/null done /usr/bin --verbose echo readonly
+grep then done | test grep export
+		done /usr/bin && printf | /usr/bin sed test ${HOME} "$1" then $(pwd) --verbose
+/usr/bin grep 'quoted text' -eu echo grep then
+	'quoted text' sed --verbose | cd sed --verbose
+then then done 2>/dev/null sed 'quoted text' test local sed 2>/dev/null
+"$1" "$1" readonly 'quoted text'
+		"$1" 'quoted text' $(pwd) 'quoted text' readonly
+		local "$1" cd local readonly
+	test /usr/bin /usr/bin printf $(pwd)
+	done && /usr/bin local
+		"$@" | | grep --verbose echo -eu
+	"$@" && cd /usr/bin local
+sed test then 'quoted text' export
+	"$1" awk | export test $(pwd) cd 2>/dev/null 2>/dev/null
+cd $(pwd) echo "$@" ${HOME} | test "$1" 2>/dev/null echo
+		&& test sed 2>/dev/null && then | "$@" && 'quoted text'
+	printf done /usr/bin --verbose
+printf 'quoted text' /usr/bin "$1" then local cd && "$@" 'quoted text' sed 2>/dev/null
+"$@" done printf local cd echo grep cd ${HOME} echo | readonly
+	grep 'quoted text' sed grep -eu
+	then $(pwd) echo /usr/bin local "$1" -eu done grep && sed then export echo then
+		2>/dev/null ${HOME} sed sed printf ${HOME} cd -eu done -eu 'quoted text'
+	echo local --verbose "$@" x=1 --verbose sed -eu sed && test ${HOME} grep
+${HOME} $(pwd) test --verbose printf /usr/bin readonly x=1 readonly "$1" $(pwd)
+		export printf -eu "$@" echo "$1" --verbose
+readonly 'quoted text' ${HOME} then local sed | export readonly
+	${HOME} --verbose echo x=1 -eu local
+--verbose ${HOME} grep test then local readonly then ${HOME} x=1 --verbose
+2>/dev/null sed | | --verbose readonly | test x=1 echo &&
+	"$@" ${HOME} 'quoted text' x=1 $(pwd) -eu
+	--verbose && test awk 2>/dev/null x=1 $(pwd) sed export local readonly
+	printf | echo ${HOME} "$@" "$1" $(pwd) && && $(pwd) | then readonly
+	grep then awk ${HOME} sed x=1 export
+	--verbose -eu "$@" done x=1 grep readonly test awk grep 'quoted text'
+	x=1 echo /usr/bin local x=1 sed "$@" $(pwd) x=1 2>/dev/null -eu awk x=1 $(pwd)
+		awk x=1 && readonly -eu export grep export /usr/bin then printf x=1 printf
+		export printf /usr/bin
+	grep | 2>/dev/null | /usr/bin test local $(pwd) 'quoted text' x=1 cd printf
+${HOME} $(pwd) x=1 test --verbose ${HOME} $(pwd) ${HOME} done x=1
+		local x=1 -eu -eu then echo "$@" | $(pwd) "$1" printf
+	--verbose ${HOME} --verbose export | echo grep echo awk
+		"$@" 'quoted text' done /usr/bin printf echo
+	then test sed local test x=1 "$@" ${HOME} cd --verbose "$@" ${HOME} cd &&
+		/usr/bin local && 'quoted text' printf /usr/bin done x=1
+&& 2>/dev/null 'quoted text' 2>/dev/null $(pwd) "$1" sed awk
+	${HOME} done 'quoted text' done
+readonly | x=1 /usr/bin --verbose ${HOME}
+		/usr/bin test -eu $(pwd) x=1 readonly --verbose
+export "$1" test -eu then "$1" awk printf
+	--verbose "$1" test then && x=1
+		$(pwd) 2>/dev/null /usr/bin /usr/bin export 2>/dev/null sed export
+${HOME} echo sed cd 'quoted text' grep sed -eu --verbose
+	local awk -eu readonly /usr/bin sed sed ${HOME}
+/usr/bin local echo test echo then awk then
+local readonly local done awk -eu ${HOME} x=1 test 2>/dev/null
+		grep sed export $(pwd) local then awk --verbose
+local /usr/bin grep -eu
+		&& printf -eu readonly grep then grep --verbose x=1 ${HOME} readonly
+		then grep | grep grep cd 2>/dev/null
+printf export local echo
+	grep "$@" awk x=1 local /usr/bin &&
+	printf /usr/bin x=1 'quoted text'
+	printf awk x=1 /usr/bin
+	"$@" 'quoted text' ${HOME} readonly x=1
+		${HOME} $(pwd) then && sed sed "$@" export readonly -eu readonly
+	"$@" "$@" x=1 readonly ${HOME}
+readonly local $(pwd) "$@" "$1" test 2>/dev/null grep then
+	"$@" && export && cd "$@" then done cd grep x=1
+		readonly then test 'quoted text'
+		sed awk readonly -eu then --verbose local
+"$@" cd cd local cd && 2>/dev/null "$1" /usr/bin grep $(pwd) 'quoted text' then
+		$(pwd) | test && sed echo "$1" 'quoted text' export /usr/bin export
+	${HOME} ${HOME} test ${HOME} test $(pwd) 2>/dev/null
+	"$@" "$@" export printf test 'quoted text' --verbose
+	cd "$@" readonly export && then export "$1" echo | "$@" ${HOME} /usr/bin
+		test 2>/dev/null --verbose awk "$1"
+'quoted text' echo echo awk 2>/dev/null local readonly then local printf /usr/bin
+	/usr/bin awk then export sed
+| test "$1" grep echo ${HOME} then test
+	| sed ${HOME} cd 2>/dev/null
+		"$@" --verbose done ${HOME}
+| --verbose 2>/dev/null -eu readonly export -eu --verbose 2>/dev/null
+	grep $(pwd) && grep && done x=1 local "$@"
+	test then grep /usr/bin test awk sed test export cd sed x=1
+	done printf test ${HOME} done $(pwd) /usr/bin printf ${HOME} done x=1 export
+		/usr/bin $(pwd) sed "$@" done
+"$@" grep ${HOME} done --verbose 2>/dev/null "$1"
+	-eu $(pwd) "$@" readonly local 'quoted text' echo printf 2>/dev/null done then
+		'quoted text' test ${HOME}
+	'quoted text' cd test 2>/dev/null $(pwd)
+		-eu x=1 local | done $(pwd) then $(pwd) export --verbose /usr/bin readonly
+		-eu ${HOME} "$@" 2>/dev/null local cd | test grep test --verbose "$@" sed /usr/bin
+echo local grep 'quoted text' 'quoted text' awk /usr/bin printf x=1 then && test
+		echo --verbose awk 'quoted text'
+		$(pwd) readonly "$@" | grep awk x=1 awk readonly test /usr/bin
+	local /usr/bin x=1 --verbose
+	cd 2>/dev/null "$@" --verbose test 'quoted text' grep 2>/dev/null
+	printf cd ${HOME} cd awk done printf readonly
+		done | export --verbose
+	2>/dev/null /usr/bin -eu awk 'quoted text' "$@" 2>/dev/null && --verbose done
+		&& printf readonly cd 'quoted text'
+	x=1 x=1 cd then ${HOME} -eu awk && readonly /usr/bin x=1 sed x=1 x=1 2>/dev/null
+test 'quoted text' 2>/dev/null awk "$@" test 'quoted text'
+		cd 'quoted text' echo $(pwd) ${HOME} grep done ${HOME} -eu 'quoted text'
+cd awk export --verbose --verbose echo
+		printf -eu awk awk 2>/dev/null export test -eu 2>/dev/null
+		-eu x=1 /usr/bin "$@" | && "$1" grep
+--verbose "$@" grep 2>/dev/null -eu sed test $(pwd)
+	'quoted text' 'quoted text' local 2>/dev/null "$1" cd readonly $(pwd)
+2>/dev/null /usr/bin x=1 'quoted text' | grep --verbose
+	--verbose export done "$1" then readonly 2>/dev/null test printf test echo
+	"$1" $(pwd) echo cd "$1" "$@" | export
+		test 'quoted text' && echo export -eu
+		grep | "$1" export done cd "$@" -eu readonly
+		2>/dev/null grep test /usr/bin echo && awk awk test x=1 done $(pwd) cd
+	awk "$1" sed $(pwd) sed ${HOME} printf ${HOME} x=1
+	done x=1 -eu export x=1 && awk 'quoted text' done --verbose $(pwd) readonly -eu
+test 'quoted text' --verbose
+$(pwd) readonly ${HOME} 2>/dev/null $(pwd) sed x=1 printf
+		${HOME} "$@" 2>/dev/null $(pwd) readonly --verbose done "$@"
+	-eu --verbose --verbose 2>/dev/null x=1 --verbose x=1 local then test "$1" test
+"$1" -eu ${HOME} readonly x=1 export local cd test echo printf then
+	awk local ${HOME} grep $(pwd) "$1" -eu /usr/bin
+${HOME} "$1" && export -eu grep local echo export done --verbose export
+		export local echo awk awk printf echo 'quoted text'
+	sed done && --verbose done
+		done cd ${HOME} echo local cd ${HOME} &&
+'quoted text' 'quoted text' x=1 cd $(pwd) 'quoted text' echo local sed
+		done printf awk cd echo 2>/dev/null local "$1" --verbose then 2>/dev/null
+	readonly 'quoted text' "$1" | -eu echo
+local | export | && cd done "$@"
+grep "$1" -eu awk $(pwd) $(pwd) echo
+	awk $(pwd) done done then sed ${HOME}
+		grep --verbose sed && --verbose /usr/bin done sed x=1 && grep
+sed then 2>/dev/null "$@" export -eu /usr/bin
+then && $(pwd) x=1 readonly $(pwd) -eu 'quoted text' --verbose test readonly then
+		-eu echo 'quoted text' test then -eu local readonly cd grep -eu x=1 x=1
+-eu ${HOME} test cd --verbose done done -eu
+		grep 2>/dev/null echo 'quoted text' $(pwd) done
+cd "$@" 2>/dev/null && test x=1 "$1"
+printf 'quoted text' done test
+	local --verbose /usr/bin
+export echo 'quoted text'
+	done local cd grep test 'quoted text' printf --verbose test
+		grep -eu $(pwd) then 2>/dev/null sed /usr/bin 'quoted text'
+		&& /usr/bin --verbose /usr/bin
+	then 2>/dev/null echo "$1" done /usr/bin export --verbose /usr/bin done x=1 sed
+local && grep local awk ${HOME} | 'quoted text' && && local readonly grep cd grep
+	"$1" -eu done echo && /usr/bin && then test local
+readonly "$@" done --verbose sed $(pwd)
+	${HOME} grep printf echo | /usr/bin
+	test cd export then done --verbose ${HOME} local /usr/bin
+	local sed cd 'quoted text'
+echo | 2>/dev/null --verbose export echo sed "$@" /usr/bin echo
+${HOME} $(pwd) -eu done | -eu echo printf sed
+	| local cd "$@" $(pwd) readonly done export && 2>/dev/null
+	/usr/bin | test done && local test 'quoted text' ${HOME} awk
+	&& then 'quoted text'
+		"$@" $(pwd) /usr/bin x=1
+	"$1" 2>/dev/null && x=1 x=1 sed x=1
+		export x=1 printf && $(pwd) local --verbose
+		readonly 'quoted text' sed then done "$1" grep grep --verbose
+		local then echo awk | grep done ${HOME} printf grep && awk local
+		${HOME} $(pwd) sed grep "$1" awk x=1 printf test
+echo | ${HOME} "$@" then | local grep -eu --verbose echo printf export
+	| then $(pwd) then grep sed $(pwd)
+		| readonly done 2>/dev/null | 'quoted text'
+		--verbose x=1 printf grep && sed export && printf ${HOME} test -eu 'quoted text'
+| echo -eu grep "$@"
+	-eu "$1" x=1 $(pwd) /usr/bin test cd "$1" ${HOME} "$1" done x=1
+		| ${HOME} grep | && export | | "$1" cd /usr/bin
+	readonly awk printf test /usr/bin done "$1" sed test cd /usr/bin local /usr/bin
+		local grep grep "$@" awk
+		export | 'quoted text' awk cd /usr/bin printf
+		"$1" | test "$@" export 'quoted text' && echo echo /usr/bin
+		export printf 'quoted text' "$@" -eu "$1" awk 'quoted text'
+	/usr/bin done x=1 sed echo "$@" /usr/bin
+	x=1 --verbose readonly printf "$1" echo cd --verbose echo /usr/bin local
+/usr/bin /usr/bin x=1 -eu echo then "$1"
+${HOME} $(pwd) done "$@" local done grep local
+echo export x=1 x=1 done sed grep
+		export then "$@" -eu "$@" sed grep "$1" && awk echo
+readonly -eu $(pwd) cd ${HOME} x=1 grep grep readonly then export test
+	x=1 $(pwd) -eu "$@" -eu x=1 grep awk ${HOME} | 2>/dev/null then 2>/dev/null
+cd | done /usr/bin 2>/dev/null
+		grep | readonly readonly -eu 'quoted text' readonly --verbose awk 2>/dev/null
+| 'quoted text' then "$@" --verbose "$@" /usr/bin export --verbose
+		test -eu ${HOME} "$@" sed export -eu export then grep then echo then done done
+		-eu echo x=1 --verbose grep
+		${HOME} $(pwd) then 2>/dev/null
+		then ${HOME} readonly --verbose 2>/dev/null
+		"$1" && && 'quoted text' | then x=1 awk local /usr/bin export export 'quoted text'
+$(pwd) export $(pwd) grep
+	x=1 cd 2>/dev/null sed awk 'quoted text' ${HOME} then grep
+awk local printf then done local export ${HOME} x=1 'quoted text' then sed
+readonly grep readonly
+	-eu grep local && "$1" cd --verbose "$1" 'quoted text' --verbose 'quoted text'
+	&& done test ${HOME} export ${HOME} done test "$1" test "$1" $(pwd) /usr/bin
+2>/dev/null x=1 ${HOME} export local | 'quoted text' grep grep awk done
+	echo cd grep done test $(pwd) 2>/dev/null then test "$1" -eu
+test && "$1" ${HOME} readonly readonly test "$@" local
+	| "$@" local ${HOME} -eu /usr/bin
+		2>/dev/null export ${HOME} -eu cd 2>/dev/null /usr/bin done then ${HOME} $(pwd)
+	"$1" "$@" export "$@" done x=1 cd export 2>/dev/null
+		printf x=1 /usr/bin && x=1 ${HOME} --verbose local
+${HOME} printf --verbose local /usr/bin "$1" | readonly
+		awk grep grep -eu && -eu 'quoted text' done -eu local
+/usr/bin local | /usr/bin sed awk 'quoted text' "$1" sed && awk echo
+		${HOME} && 'quoted text'
+	test echo 2>/dev/null echo awk && -eu done done /usr/bin $(pwd) "$@"
+	| | "$@" 2>/dev/null $(pwd) "$@" 2>/dev/null
+2>/dev/null awk awk 'quoted text' $(pwd) done -eu echo
+		2>/dev/null -eu awk printf
+	test done 'quoted text' done echo --verbose | ${HOME} "$@" "$@" cd cd
+	$(pwd) echo ${HOME} $(pwd) 'quoted text' local 'quoted text' then local
+	then echo -eu then "$@" then cd grep 2>/dev/null
+test printf test done echo then echo
+readonly grep && ${HOME} then local readonly then
+	test 2>/dev/null --verbose | printf sed export local sed -eu
+		${HOME} echo 'quoted text' cd echo 'quoted text' 'quoted text'
+		--verbose export export
+local /usr/bin done | test echo x=1 2>/dev/null /usr/bin cd --verbose /usr/bin cd
+done readonly awk ${HOME} --verbose
+	$(pwd) | echo sed $(pwd) then readonly && /usr/bin x=1 echo x=1 -eu printf --verbose
+	then export export test export | local
+/usr/bin cd --verbose | awk readonly readonly | then
+		export $(pwd) cd then export /usr/bin
+	then x=1 && /usr/bin done $(pwd) -eu done
+	cd export awk test ${HOME} done "$1" "$@" "$1"
+		x=1 'quoted text' x=1 test grep 'quoted text'
+test awk $(pwd) grep 'quoted text' /usr/bin | | grep export local
+	done /usr/bin x=1 local ${HOME} then
+		--verbose 2>/dev/null 'quoted text' /usr/bin sed test --verbose
+	"$1" ${HOME} | | && test -eu local echo "$1" "$@" sed /usr/bin -eu grep sed "$1"
+sed local "$1" | | ${HOME} 'quoted text' grep sed grep
+		/usr/bin -eu $(pwd) local x=1 "$@" $(pwd) awk then
+		x=1 2>/dev/null echo grep test
+		readonly x=1 local ${HOME} then -eu 2>/dev/null
+x=1 echo then sed &&
+		'quoted text' export 2>/dev/null ${HOME} ${HOME} -eu echo local -eu test
+$(pwd) 'quoted text' awk test local export ${HOME} ${HOME}
+test $(pwd) done "$1" | printf
+grep /usr/bin printf awk then awk "$1" then local awk
+	cd local echo --verbose done "$1" ${HOME} grep -eu readonly
+-eu echo | 2>/dev/null export && cd export then $(pwd) done grep
+printf $(pwd) done 'quoted text' 2>/dev/null "$@" export
+		done $(pwd) export then | $(pwd)
+awk test $(pwd) -eu cd
+	readonly 'quoted text' /usr/bin
+		&& awk test && export local -eu cd test "$1" 2>/dev/null
+		export "$@" printf "$1" grep x=1 awk test readonly
+		$(pwd) grep echo -eu "$@" test test x=1 | grep
+	$(pwd) awk /usr/bin sed test ${HOME} --verbose printf awk x=1 readonly
+readonly $(pwd) "$@" export local "$@" sed local
+		echo -eu x=1 local readonly x=1 export 'quoted text'
+	&& "$@" && x=1 --verbose -eu cd | grep readonly
+	$(pwd) && x=1 printf printf
+		echo 'quoted text' "$1" awk done echo $(pwd) | 'quoted text' 'quoted text' &&
+		awk test x=1 $(pwd) "$@" -eu export grep --verbose readonly awk printf
+		${HOME} echo -eu printf "$@" sed echo | ${HOME} local done
+	sed done done 2>/dev/null 'quoted text' -eu export
+		&& grep export -eu awk done 'quoted text'
+x=1 /usr/bin --verbose local x=1 "$@" /usr/bin | 2>/dev/null
+	&& && | done cd "$1" 2>/dev/null "$1" local "$1" test printf ${HOME} awk export
+"$@" && --verbose grep 'quoted text' "$@" $(pwd) grep | test
+sed "$@" sed ${HOME} done done | sed readonly "$1"
+		${HOME} "$@" printf sed ${HOME} sed "$@" export | -eu echo "$@" sed cd
+		readonly 2>/dev/null x=1 cd echo ${HOME}
+export echo local printf ${HOME} cd
+		$(pwd) grep $(pwd) -eu
+		'quoted text' done cd printf $(pwd) then
+done ${HOME} then 'quoted text' cd ${HOME} "$@" ${HOME} export x=1 /usr/bin
+/usr/bin local && x=1 export --verbose done readonly --verbose ${HOME} && sed
+/usr/bin /usr/bin 2>/dev/null echo "$@" "$1" then
+done grep 'quoted text' $(pwd) local x=1 sed sed test "$1" "$1" ${HOME}
+		awk cd | sed 2>/dev/null awk grep cd 'quoted text' $(pwd) printf /usr/bin
+-eu echo ${HOME} done 'quoted text' cd "$1" $(pwd)
+x=1 local sed done grep -eu grep local
+	then test printf && --verbose sed $(pwd) x=1
+	awk cd test local --verbose
+		export 2>/dev/null $(pwd) x=1
+&& local export cd local "$1" local done test
+export && then && local export $(pwd) awk ${HOME} "$@" -eu
+"$@" /usr/bin done ${HOME} local ${HOME} grep awk printf
+	awk test && $(pwd) $(pwd) -eu test readonly awk
+	$(pwd) readonly /usr/bin 2>/dev/null ${HOME} readonly awk echo ${HOME} echo
+	'quoted text' sed -eu /usr/bin local "$@" readonly "$1"
+grep grep export ${HOME}
+		--verbose sed --verbose cd sed awk $(pwd)
+	grep echo "$@" | ${HOME} 'quoted text' --verbose /usr/bin done "$@" awk test
+		cd echo 2>/dev/null 'quoted text' printf "$1" "$@" cd
+	| x=1 export "$1" test 2>/dev/null test then "$1" done
+	"$1" export && x=1 --verbose cd done ${HOME} sed echo test awk /usr/bin printf
+x=1 x=1 local test x=1 cd sed echo && 2>/dev/null | 'quoted text' export
+		"$1" --verbose export -eu "$1" /usr/bin echo local readonly readonly ${HOME}
+		${HOME} && cd then $(pwd) 'quoted text' done /usr/bin "$@" 'quoted text'
+local --verbose awk 'quoted text' | export readonly export
+	"$@" /usr/bin $(pwd) $(pwd) readonly 'quoted text'
+	then awk then export x=1 test
+	local echo --verbose sed 'quoted text' done done cd $(pwd)
+	2>/dev/null test "$@" $(pwd)
+		2>/dev/null local --verbose
+cd $(pwd) then readonly then | && "$1" cd && | sed --verbose
+'quoted text' awk echo
+	test sed "$1" echo local /usr/bin /usr/bin grep "$1" sed printf $(pwd) local
+	done "$1" 2>/dev/null 'quoted text'
+grep --verbose export /usr/bin printf printf local
+		2>/dev/null | /usr/bin -eu ${HOME} then 2>/dev/null 2>/dev/null /usr/bin && ${HOME}
+	"$1" export local then "$@" export /usr/bin sed echo
+		x=1 export 'quoted text' printf cd --verbose 2>/dev/null
+local --verbose awk printf /usr/bin
+	/usr/bin then 'quoted text' awk echo echo then | "$@" grep sed printf cd | "$@"
+		awk readonly ${HOME} then readonly done done export x=1 $(pwd) x=1 echo $(pwd)
+		"$@" x=1 "$@" 2>/dev/null local x=1 sed --verbose | readonly
+	cd && --verbose 'quoted text' $(pwd)
+	done 'quoted text' sed local done echo "$@" 'quoted text'
+	$(pwd) printf grep awk readonly printf sed --verbose $(pwd)
+	readonly -eu printf 2>/dev/null
+	echo ${HOME} echo then x=1 ${HOME} "$@" then local
+printf "$1" done printf then cd readonly local
+		2>/dev/null --verbose ${HOME}
+		x=1 2>/dev/null then /usr/bin
+		"$1" ${HOME} "$1" done awk | echo echo cd "$1" 2>/dev/null x=1 sed "$@"
+		done test echo 'quoted text' --verbose
+-eu | --verbose "$@" export echo readonly /usr/bin 'quoted text' 2>/dev/null
+		then echo && awk then /usr/bin 2>/dev/null
+	--verbose 2>/dev/null "$@" | 2>/dev/null awk 2>/dev/null
+	| "$@" 2>/dev/null | "$1" /usr/bin
+	-eu ${HOME} grep && readonly 'quoted text' export
+	2>/dev/null local done ${HOME} | awk --verbose test grep x=1 local
+readonly readonly 'quoted text'
+		export ${HOME} 'quoted text' export $(pwd)
+${HOME} x=1 | done ${HOME}
+"$1" "$@" $(pwd) --verbose && /usr/bin sed test ${HOME} $(pwd) done local
+"$@" "$1" readonly grep --verbose "$@" local "$1"
+	cd 'quoted text' echo "$@" done echo --verbose
+echo /usr/bin "$1" sed --verbose
+	cd --verbose 'quoted text' && done 'quoted text' then done done /usr/bin
+	then && "$@" && grep test export printf local then 'quoted text' "$1" then x=1
+grep echo x=1 test sed 2>/dev/null test --verbose
+	x=1 test done done $(pwd) grep test sed x=1 sed x=1 "$@" awk -eu then -eu 'quoted text'
+		$(pwd) done x=1 cd -eu echo test --verbose
+		| local awk test --verbose $(pwd) done grep 2>/dev/null ${HOME} "$@" done
+	echo grep | test readonly | cd echo -eu
+grep cd -eu sed 'quoted text' | local | "$1" $(pwd) 'quoted text'
+-eu --verbose test echo readonly grep local x=1 grep x=1 cd echo
+	'quoted text' "$1" --verbose local /usr/bin | x=1 && -eu test
+echo "$@" 'quoted text' printf cd awk test echo x=1 grep -eu printf "$@"
+		export | cd 'quoted text' --verbose cd | 2>/dev/null
+		test sed /usr/bin sed printf "$@" --verbose
+	cd -eu /usr/bin 2>/dev/null "$1" printf x=1
+	/usr/bin awk 2>/dev/null 2>/dev/null awk
+		$(pwd) --verbose echo x=1
+	/usr/bin x=1 --verbose sed | 2>/dev/null grep sed 'quoted text'
+--verbose ${HOME} local awk printf
+	cd /usr/bin done printf --verbose "$1" printf "$@" /usr/bin
+2>/dev/null sed 2>/dev/null export done printf export readonly
+		$(pwd) grep "$1" -eu 2>/dev/null 2>/dev/null
+2>/dev/null ${HOME} ${HOME}
+		test grep x=1 -eu -eu printf
+$(pwd) export /usr/bin grep readonly printf "$1" then /usr/bin $(pwd) awk && "$@"
+	2>/dev/null printf grep local readonly
+readonly "$1" && test local $(pwd) local then -eu local local then done /usr/bin
+sed ${HOME} "$@" 'quoted text' "$1" sed local sed && /usr/bin
+printf "$1" && cd readonly "$@" printf local 'quoted text' /usr/bin
+		done --verbose | sed local done 2>/dev/null awk
+		$(pwd) readonly "$1" "$@" sed grep | cd test /usr/bin
+	${HOME} /usr/bin "$@" && -eu | cd "$@" && cd && sed $(pwd) sed $(pwd) --verbose
+done -eu local cd | $(pwd) && 'quoted text' export
+		'quoted text' "$1" cd 2>/dev/null 'quoted text'
+	"$1" then awk -eu x=1 | | -eu grep /usr/bin
+awk test "$1" -eu printf export x=1 sed && readonly --verbose && -eu printf /usr/bin
+	cd x=1 awk test 'quoted text'
+		awk ${HOME} cd $(pwd) then local $(pwd) && done local 2>/dev/null
+	| printf echo export test done --verbose
+		local "$1" "$@" printf sed export done "$1" test grep 'quoted text' x=1 'quoted text'
+		'quoted text' $(pwd) export done --verbose | 'quoted text' &&
+		printf awk --verbose x=1 'quoted text'
+	2>/dev/null --verbose "$1" local echo $(pwd) x=1 readonly
+'quoted text' grep "$@" local | 'quoted text' -eu |
+		readonly then x=1 'quoted text' readonly "$1" awk grep export
+x=1 -eu "$@" ${HOME} $(pwd) $(pwd) -eu ${HOME} "$1" --verbose 2>/dev/null awk
+grep done test test $(pwd) x=1 --verbose "$1"
+	echo printf "$1" --verbose printf "$1" sed /usr/bin awk $(pwd) grep
+		"$@" ${HOME} grep --verbose printf $(pwd) then 'quoted text'
+2>/dev/null test --verbose --verbose awk -eu 2>/dev/null
+		--verbose cd 'quoted text' then ${HOME} then ${HOME} test ${HOME}
+	grep printf test /usr/bin export local --verbose
+-eu "$@" /usr/bin grep cd 'quoted text' sed $(pwd) x=1
+	--verbose test awk cd sed 2>/dev/null export
+		&& && done | --verbose "$1" && test x=1 echo then "$1"
+		2>/dev/null printf | test ${HOME} -eu "$@" cd awk ${HOME} -eu $(pwd) "$1" /usr/bin
+	printf ${HOME} awk grep x=1 test --verbose
+		grep -eu ${HOME} grep printf readonly "$@" awk 'quoted text' printf 'quoted text'
+${HOME} && "$@" x=1 2>/dev/null then
+		${HOME} ${HOME} /usr/bin "$1" awk $(pwd) done sed
+		printf local --verbose "$1" "$1" "$@" cd 2>/dev/null && 2>/dev/null 2>/dev/null
+	x=1 /usr/bin done 'quoted text' && echo | $(pwd)
+grep done awk 2>/dev/null $(pwd) done 2>/dev/null printf grep
+	local "$1" sed "$1" echo echo printf readonly "$1" 2>/dev/null
+test grep /usr/bin && --verbose
+	export | awk readonly | 'quoted text' printf grep "$1" ${HOME}
+		"$1" $(pwd) test -eu echo then then cd ${HOME} cd local sed then
+		2>/dev/null done "$1" /usr/bin grep printf 'quoted text' "$1" ${HOME}
+2>/dev/null --verbose echo 'quoted text' -eu ${HOME} | -eu x=1 "$@"
+	echo export -eu 'quoted text' test readonly export --verbose
+		test 'quoted text' cd "$1" then x=1 test export cd && printf | readonly sed local
+	${HOME} ${HOME} test export x=1 cd export awk ${HOME} export x=1 $(pwd) "$@"
+		${HOME} | echo /usr/bin then
+	${HOME} ${HOME} $(pwd) printf local
+&& readonly /usr/bin 2>/dev/null readonly then readonly | printf readonly
+	done sed 2>/dev/null /usr/bin
+	done ${HOME} readonly done printf cd printf "$@" awk 'quoted text' export
+	sed ${HOME} "$@" echo grep then 2>/dev/null
+	readonly cd ${HOME} printf test
+		"$1" 'quoted text' done "$1" awk -eu test grep "$1" local | cd local export
+local "$@" "$@" $(pwd)
+	| /usr/bin then 'quoted text' printf /usr/bin grep x=1 export 2>/dev/null
+		/usr/bin --verbose && | done grep
+test local $(pwd) $(pwd) cd /usr/bin /usr/bin && awk 'quoted text'
+	&& local x=1 printf && then awk sed sed | ${HOME}
+export sed export printf cd export local
+		x=1 'quoted text' /usr/bin
+	readonly && | "$@" 'quoted text' $(pwd) sed
+		x=1 done $(pwd) && echo echo readonly sed /usr/bin cd --verbose
+$(pwd) test sed then grep export x=1 -eu
+then x=1 'quoted text' x=1 ${HOME} 2>/dev/null 2>/dev/null --verbose
+&& sed printf $(pwd) -eu && 2>/dev/null 2>/dev/null x=1
+grep --verbose "$@" done
+	awk awk done | echo x=1 sed "$@" --verbose -eu
+	-eu printf --verbose 2>/dev/null awk --verbose sed echo test printf
+echo && sed ${HOME} local then export test test /usr/bin grep local &&
+done echo ${HOME} && cd test && 2>/dev/null | local
+	'quoted text' $(pwd) --verbose /usr/bin done export "$@" "$1" export echo -eu
+		| /usr/bin test ${HOME} test "$@" $(pwd) x=1 x=1 "$@"
+		printf "$1" local done test printf 2>/dev/null "$@" readonly cd local
+	&& local -eu grep test 'quoted text'
+	&& /usr/bin "$1" sed "$@" && then /usr/bin export "$@" echo
+export && export export "$@" --verbose readonly /usr/bin --verbose
+	then $(pwd) "$1" /usr/bin done --verbose grep sed then
+cd grep ${HOME} | readonly 'quoted text' local
+	readonly /usr/bin --verbose
+	--verbose test ${HOME} sed awk
+	| test "$1" 2>/dev/null "$1" /usr/bin 2>/dev/null 2>/dev/null /usr/bin 'quoted text'
+		$(pwd) $(pwd) --verbose
+	--verbose $(pwd) local export "$1" --verbose
+		sed then done -eu cd ${HOME} then | then 2>/dev/null x=1
+	2>/dev/null /usr/bin export
+x=1 done "$1" cd 2>/dev/null echo export && 'quoted text' 'quoted text'
+		then echo 'quoted text' 'quoted text'
+		/usr/bin export local grep readonly done local echo local
+	cd export x=1 cd && test 2>/dev/null -eu "$@" test 2>/dev/null "$@" -eu
+		/usr/bin -eu 'quoted text' sed awk printf
+		"$@" done && cd awk export
+	then -eu "$@" export done $(pwd) x=1
+'quoted text' sed awk "$1" 2>/dev/null echo cd sed echo 'quoted text' 'quoted text'
+2>/dev/null export printf local then --verbose | grep /usr/bin
+2>/dev/null then grep 'quoted text' x=1 then "$@" $(pwd)
+	echo --verbose readonly awk "$1" sed then cd cd 2>/dev/null
+		/usr/bin $(pwd) x=1 "$1" then -eu echo cd $(pwd) cd "$@" 2>/dev/null test awk
+	"$1" cd && x=1 then then awk readonly "$@" test echo x=1 export "$@"
+		2>/dev/null local export then sed 2>/dev/null x=1 sed 'quoted text'
+"$@" printf 'quoted text' grep done ${HOME} "$1" test && "$1" done
+		"$1" && then then then "$@" "$@" /usr/bin awk --verbose "$@" 'quoted text'
+#include c117.sh
+		'quoted text' | test printf cd grep $(pwd)
+		export done then export test then 2>/dev/null 'quoted text'
+	echo then $(pwd) sed 2>/dev/null | x=1 export
+	sed local 'quoted text' then x=1 -eu | 'quoted text'
+	test echo export readonly && cd 'quoted text' grep
+		test local done sed grep local readonly --verbose
+printf readonly readonly | --verbose done
+	2>/dev/null export /usr/bin grep x=1 2>/dev/null | --verbose local
+	"$1" done sed export cd local "$1" printf local -eu
+awk awk 'quoted text' done --verbose 2>/dev/null 2>/dev/null --verbose "$1"
+	-eu | 'quoted text' 2>/dev/null local export
+	then test cd grep --verbose 'quoted text'
+cd export export "$@" "$@" 2>/dev/null done
+$(pwd) printf test export && 'quoted text' ${HOME} local local
+	--verbose awk test echo test x=1 grep test grep
+local sed test ${HOME} readonly | --verbose export echo grep
+		"$1" "$@" | /usr/bin readonly awk test
+	--verbose ${HOME} -eu done test ${HOME} --verbose then cd readonly printf
+		echo && --verbose local local printf then 2>/dev/null sed grep printf
+awk awk --verbose awk
+	/usr/bin /usr/bin /usr/bin
+grep --verbose && /usr/bin grep
+	done && "$@" x=1 export export test printf
+	| ${HOME} test echo awk
+	then sed done /usr/bin export ${HOME} ${HOME} && ${HOME} test
+readonly done | 2>/dev/null $(pwd) done grep
+		&& "$@" local awk --verbose awk then done | test /usr/bin awk
+		sed ${HOME} ${HOME} ${HOME} --verbose --verbose cd && $(pwd) local
+		test export printf done /usr/bin ${HOME} | readonly
+	'quoted text' local readonly done $(pwd) && "$@" "$@" export done
+readonly 'quoted text' readonly cd $(pwd) sed export
+/usr/bin 'quoted text' "$1" "$@" cd -eu 2>/dev/null "$1"
+	"$@" then echo x=1 x=1 --verbose
+	"$1" --verbose ${HOME} 2>/dev/null x=1 ${HOME}
+	test readonly printf grep && done ${HOME} "$@" local readonly done 2>/dev/null
+printf sed 'quoted text' echo cd export "$@" | sed
+	local "$1" grep done --verbose "$1" cd then then
+	grep local readonly && echo printf 2>/dev/null ${HOME} echo readonly /usr/bin
+	cd cd x=1 test grep /usr/bin readonly readonly 'quoted text'
+		-eu $(pwd) | ${HOME} then | done awk local x=1 echo
+	2>/dev/null printf cd --verbose local
+	local local | 2>/dev/null local --verbose grep
+	2>/dev/null test -eu then "$@" printf then
+	x=1 ${HOME} sed sed 'quoted text'
+		echo grep local awk && test 2>/dev/null
+sed | 'quoted text' sed 'quoted text'
+--verbose cd awk sed -eu x=1 readonly test sed grep | "$1" export local echo /usr/bin
+	2>/dev/null export "$1" echo export 2>/dev/null && sed ${HOME} 'quoted text'
+		awk -eu readonly -eu done
+done readonly ${HOME} "$1" "$1" ${HOME} cd --verbose
+		awk x=1 /usr/bin export --verbose sed readonly awk test echo local |
+	then 2>/dev/null $(pwd) cd then export sed awk /usr/bin
+awk done "$@" --verbose grep test --verbose --verbose
+	"$@" x=1 $(pwd) 'quoted text' awk then $(pwd) then /usr/bin $(pwd)
+grep x=1 | cd 'quoted text' export
+		"$1" ${HOME} ${HOME} printf done x=1 x=1 -eu --verbose 'quoted text'
+	grep | $(pwd) /usr/bin -eu awk
+	&& grep done readonly
+printf --verbose test ${HOME} awk "$@" then test test readonly "$1" done $(pwd)
+	test /usr/bin 2>/dev/null 2>/dev/null
+	printf -eu awk | test
+	${HOME} ${HOME} -eu "$@" sed -eu echo ${HOME} -eu $(pwd)
+		2>/dev/null x=1 readonly echo && readonly
+echo -eu done export done then x=1 export cd awk readonly /usr/bin
+done sed sed ${HOME} && | 2>/dev/null
+2>/dev/null && export ${HOME} /usr/bin && /usr/bin
+	test printf awk readonly x=1 'quoted text' sed sed | export /usr/bin $(pwd) export
+		done printf 'quoted text' /usr/bin awk local ${HOME} export
+	-eu "$1" local echo 'quoted text' readonly done x=1 2>/dev/null grep
+	then | 2>/dev/null printf $(pwd) 2>/dev/null && local 'quoted text'
+"$1" echo readonly awk echo /usr/bin x=1 'quoted text' echo /usr/bin
+		${HOME} /usr/bin printf readonly /usr/bin | export "$@" then 2>/dev/null
+		&& /usr/bin printf 2>/dev/null $(pwd) 'quoted text'
+sed | | $(pwd) -eu -eu test then | | awk && -eu cd
+		sed $(pwd) local --verbose
+		local "$@" echo /usr/bin "$1" --verbose cd done ${HOME} export done x=1 printf
+		sed 'quoted text' 2>/dev/null --verbose x=1 then && test | 2>/dev/null "$@"
+/usr/bin done test 'quoted text' && $(pwd) local --verbose 2>/dev/null "$1"
+		done test readonly x=1 x=1 printf
+	then "$1" then x=1 -eu local "$1" done readonly --verbose 2>/dev/null then done
+done $(pwd) "$@" awk done export ${HOME} printf then test
+		grep test awk /usr/bin cd readonly x=1 -eu /usr/bin printf sed 'quoted text'
+		then local grep -eu done "$1" --verbose awk /usr/bin
+test $(pwd) then cd sed 2>/dev/null --verbose awk $(pwd) && x=1 grep 'quoted text'
+done 'quoted text' /usr/bin "$@" | export -eu $(pwd) x=1 sed printf
+		-eu grep then printf "$@" x=1 /usr/bin
+x=1 test | awk awk cd ${HOME} awk ${HOME} 2>/dev/null test
+"$1" 'quoted text' $(pwd) "$1" --verbose -eu x=1 cd export
+	test echo /usr/bin | 'quoted text' "$1" local local readonly 2>/dev/null
+readonly --verbose cd local && sed && --verbose export echo grep && --verbose
+--verbose --verbose awk readonly awk
+		${HOME} printf && echo /usr/bin && grep 'quoted text' test /usr/bin
+		"$1" export | then export echo && x=1 "$@" export 'quoted text'
+		'quoted text' awk /usr/bin readonly $(pwd) "$1"
+local "$1" grep "$@"
+	${HOME} sed grep | --verbose
+export 'quoted text' x=1 "$1"
+		echo cd -eu sed 'quoted text' then sed | x=1 ${HOME} sed 'quoted text' test printf
+| x=1 then awk test /usr/bin
+	echo test "$1" printf ${HOME} "$@" 'quoted text'
+		sed ${HOME} | echo -eu export 'quoted text' x=1 $(pwd) echo then /usr/bin $(pwd)
+	"$1" && x=1 "$@" export export && readonly sed --verbose local local
+		--verbose && readonly grep -eu -eu 'quoted text' grep printf printf
+		done echo echo cd $(pwd) export grep --verbose done export "$@" awk --verbose
+-eu echo grep "$@" done
+		done /usr/bin done awk test echo 2>/dev/null $(pwd) $(pwd) $(pwd) test "$1" test
+awk then /usr/bin cd export then ${HOME} cd 2>/dev/null awk "$1" cd cd 'quoted text'
+		'quoted text' echo | /usr/bin test awk 'quoted text'
+	test test local --verbose readonly ${HOME} /usr/bin 'quoted text' export
+		test 2>/dev/null cd ${HOME} --verbose | local
+		&& 2>/dev/null $(pwd) "$1" --verbose local --verbose
+"$@" $(pwd) 2>/dev/null
+&& x=1 | "$@" && awk "$1" cd 2>/dev/null grep "$1" --verbose
+		printf local grep readonly readonly
+	grep local "$1" done --verbose 'quoted text'
+		cd /usr/bin export ${HOME} awk awk -eu cd awk 'quoted text'
+/usr/bin awk --verbose cd done readonly then x=1 awk
+sed x=1 | test --verbose then $(pwd) --verbose cd "$1" printf sed then local 2>/dev/null
+		sed export $(pwd) "$1"
+	x=1 done ${HOME} ${HOME} echo printf
+	x=1 then 'quoted text' --verbose export awk -eu local "$@" --verbose
+	$(pwd) test awk test "$1"
+2>/dev/null -eu echo | echo local export echo printf
+awk "$1" /usr/bin export -eu
+		done test --verbose "$@" ${HOME}
+		/usr/bin -eu "$1" | export done cd sed
+	then sed -eu echo local
+		/usr/bin ${HOME} cd -eu $(pwd)
+&& export 2>/dev/null $(pwd) $(pwd)
+2>/dev/null test "$@" x=1 -eu printf then "$@"
+	awk printf cd "$1" $(pwd) $(pwd) echo ${HOME} awk "$1" "$1" 2>/dev/null
+${HOME} --verbose /usr/bin /usr/bin $(pwd) -eu
+printf sed && local 2>/dev/null done export echo 2>/dev/null --verbose "$1"
+		done /usr/bin && && | 2>/dev/null
+	x=1 "$1" grep grep && 'quoted text'
+		local printf readonly $(pwd) cd && sed /usr/bin then done "$@" /usr/bin readonly
+	done echo echo grep grep printf local
+	x=1 export --verbose "$@" && then --verbose --verbose
+	export 'quoted text' --verbose
+grep "$@" echo $(pwd) -eu test sed grep | then 'quoted text'
+		test "$@" "$@" then && $(pwd) local done
+	-eu then "$@" cd grep ${HOME} readonly -eu 'quoted text' echo awk 'quoted text'
+then echo echo cd cd 'quoted text' | cd
+		2>/dev/null then sed sed test done | "$1" cd "$@" readonly printf done
+	test printf printf printf local
+	&& "$1" cd awk 2>/dev/null export readonly awk sed export printf printf -eu
+printf done readonly && then
+then /usr/bin grep && echo $(pwd) /usr/bin grep echo 'quoted text' then
+${HOME} sed "$@" readonly &&
+x=1 $(pwd) x=1 readonly $(pwd) && x=1 cd printf && -eu $(pwd) 2>/dev/null
+grep x=1 awk echo -eu | && awk test --verbose done export -eu x=1 test
+"$1" cd echo then "$@" 'quoted text' /usr/bin 2>/dev/null printf echo
+done awk sed awk | grep export -eu test --verbose /usr/bin
+	sed test /usr/bin then "$@"
+		then then && test ${HOME} readonly ${HOME} test cd $(pwd) local then test
+&& "$1" | $(pwd) 2>/dev/null 2>/dev/null echo then 'quoted text' echo /usr/bin
+	done /usr/bin grep printf | local test "$1" export then test 2>/dev/null
+readonly readonly test
+		readonly "$@" export test /usr/bin done 'quoted text' then "$@" /usr/bin
+		test sed local local ${HOME} done --verbose printf then readonly cd --verbose
+"$1" ${HOME} printf printf "$1" -eu /usr/bin -eu cd readonly
+		&& awk then done 'quoted text'
+		grep && awk "$@" awk 'quoted text' 2>/dev/null 2>/dev/null
+-eu --verbose grep "$@" done 2>/dev/null local readonly
+		test done test awk done -eu /usr/bin
+	echo ${HOME} 2>/dev/null test grep 'quoted text' /usr/bin | then readonly -eu
+	local cd $(pwd) readonly 2>/dev/null --verbose -eu awk $(pwd) readonly done ${HOME}
+	"$@" echo echo /usr/bin | /usr/bin sed "$@" cd test cd /usr/bin cd
+	$(pwd) grep $(pwd) awk local ${HOME} "$1" "$@" awk
+		then x=1 echo test ${HOME} /usr/bin 'quoted text' /usr/bin local "$1"
+		x=1 sed local echo done export done printf test grep readonly export
+		| $(pwd) then | echo sed && readonly
+	${HOME} export then echo
+		"$@" --verbose export echo | && --verbose awk
+printf export && --verbose
+		$(pwd) printf sed && "$@" export done awk then ${HOME} --verbose readonly
+		--verbose x=1 done $(pwd) printf cd ${HOME} 2>/dev/null awk
+grep readonly export printf "$1" $(pwd) echo cd then x=1
+test 2>/dev/null | echo local cd "$1" local
+echo 'quoted text' test echo -eu grep --verbose /usr/bin 2>/dev/null
+	/usr/bin $(pwd) printf "$1"
+printf cd x=1 'quoted text' ${HOME} export then export export
+		readonly echo done awk x=1 cd ${HOME} echo | test && readonly
+| cd done ${HOME} "$1" /usr/bin $(pwd) && echo echo
+		echo printf then 2>/dev/null
+sed 'quoted text' printf printf cd grep | awk x=1 readonly 2>/dev/null awk
+	$(pwd) | sed "$1" local --verbose --verbose export ${HOME} local /usr/bin sed
+		x=1 test echo | then /usr/bin 'quoted text' cd cd cd -eu test && --verbose
+	readonly done readonly then export $(pwd) /usr/bin --verbose
+		'quoted text' -eu && 'quoted text' 2>/dev/null "$1" export then
+done 'quoted text' 'quoted text' $(pwd) --verbose export done | grep done /usr/bin
+local "$1" local 'quoted text' "$1" 2>/dev/null printf --verbose printf done
+	echo "$1" export 'quoted text' /usr/bin && "$@"
+	2>/dev/null 2>/dev/null "$1" ${HOME}
+		"$1" 'quoted text' grep done echo --verbose && grep && sed /usr/bin export
+${HOME} sed /usr/bin "$1" ${HOME} ${HOME}
+		awk readonly ${HOME} x=1 local local printf ${HOME} "$@" echo "$1"
+	echo ${HOME} local printf cd sed local then $(pwd) "$1" readonly
+sed 2>/dev/null printf "$1" $(pwd) x=1 --verbose 'quoted text'
+done -eu /usr/bin cd 'quoted text'
+	-eu awk "$@" 2>/dev/null readonly export awk $(pwd) sed
+	awk "$@" awk echo test awk $(pwd) done ${HOME} printf /usr/bin awk done grep
+2>/dev/null ${HOME} sed
+&& test | x=1 awk x=1 awk $(pwd) readonly $(pwd)
+		| && awk local sed /usr/bin export
+printf done --verbose /usr/bin sed awk test
+then $(pwd) printf "$1" $(pwd) | && awk $(pwd) --verbose local /usr/bin
+| ${HOME} --verbose awk x=1 | 'quoted text' "$1" grep &&
+	"$1" sed x=1 | readonly test x=1 sed grep
+		cd 'quoted text' 2>/dev/null ${HOME} 'quoted text'
+	test awk -eu readonly 2>/dev/null 'quoted text'
+		"$@" done cd then ${HOME} awk 'quoted text'
+		grep "$@" then done /usr/bin 2>/dev/null /usr/bin | ${HOME} 'quoted text'
+	2>/dev/null "$@" awk "$@" local
+		readonly $(pwd) sed | printf local && "$@" $(pwd) printf awk printf awk 2>/dev/null
+echo echo done 'quoted text' printf 2>/dev/null "$@" ${HOME} then --verbose
+cd then sed export --verbose
+	grep echo ${HOME} "$@" readonly awk cd 2>/dev/null
+--verbose 'quoted text' /usr/bin done 'quoted text'
+export local "$1" ${HOME} | 'quoted text'
+		sed -eu $(pwd) ${HOME} "$1" | $(pwd) ${HOME} grep printf "$1" printf cd
+	then echo x=1 ${HOME} x=1 readonly
+		test then | /usr/bin $(pwd) x=1 export cd sed "$@" --verbose | done
+		"$1" "$@" | cd printf done "$1" "$1"
+	&& 2>/dev/null ${HOME} export "$@" $(pwd) /usr/bin ${HOME} test
+--verbose awk ${HOME} echo x=1 test /usr/bin done
+cd && x=1 && awk awk 'quoted text' awk x=1 'quoted text'
+		sed echo | $(pwd) echo 'quoted text' printf && 2>/dev/null test --verbose
+		&& $(pwd) -eu grep --verbose "$1" readonly then local &&
+		-eu && then 'quoted text' $(pwd) export sed done 2>/dev/null
+x=1 cd cd 'quoted text' export && readonly --verbose
+cd -eu ${HOME} "$@" "$@" echo "$@" 2>/dev/null test
+		--verbose cd grep readonly echo export echo done
+		-eu /usr/bin && readonly export 2>/dev/null
+-eu readonly /usr/bin done awk
+--verbose sed printf done "$@" --verbose sed /usr/bin 2>/dev/null
+	-eu $(pwd) 2>/dev/null cd $(pwd) 2>/dev/null "$@" /usr/bin
+		printf ${HOME} local x=1 printf
+echo cd awk export -eu /usr/bin "$1" && local /usr/bin ${HOME}
+&& printf echo awk --verbose awk /usr/bin echo grep | done -eu
+		grep -eu x=1 x=1 ${HOME} $(pwd) cd cd awk -eu 2>/dev/null
+		&& 2>/dev/null export --verbose done $(pwd) awk | x=1 done export /usr/bin
+--verbose awk grep x=1 test then 'quoted text'
+	then grep $(pwd) /usr/bin 'quoted text' $(pwd)
+echo "$@" && ${HOME} "$1" grep sed ${HOME} then then
+test done 2>/dev/null awk printf
+		cd --verbose awk | 'quoted text'
+	export cd grep x=1 local export "$1"
+	&& echo done x=1 x=1 2>/dev/null 2>/dev/null 'quoted text' local
+printf 'quoted text' ${HOME} 'quoted text' 'quoted text' readonly -eu grep
+export sed done $(pwd) ${HOME} x=1
+readonly x=1 "$@" test printf
+	-eu echo 2>/dev/null /usr/bin test grep x=1 readonly sed awk printf &&
+		sed test -eu export test awk test -eu echo cd "$1" test --verbose done readonly
+		/usr/bin $(pwd) ${HOME} echo sed "$1" grep "$@" /usr/bin "$@" -eu
+		&& cd x=1 /usr/bin --verbose
+	sed echo $(pwd) echo --verbose ${HOME}
+	awk then printf 2>/dev/null done
+	cd -eu done local /usr/bin cd && done ${HOME} | then echo cd awk "$@" local
+	'quoted text' echo /usr/bin && /usr/bin awk readonly
+	awk readonly cd x=1 sed | "$@" && export "$1" echo /usr/bin export export "$1"
+		/usr/bin "$@" 2>/dev/null -eu /usr/bin awk
+		printf done && 2>/dev/null /usr/bin sed 2>/dev/null export grep --verbose
+--verbose $(pwd) 2>/dev/null $(pwd) ${HOME} | 2>/dev/null "$1" test awk "$@"
+'quoted text' 2>/dev/null test ${HOME} cd then then test
+		test test cd && done 2>/dev/null local
+		grep local $(pwd) "$@" local
+grep -eu ${HOME} local grep sed 'quoted text' && ${HOME} test
+$(pwd) cd export ${HOME} cd local $(pwd) && -eu $(pwd)
+	| x=1 && export --verbose echo --verbose readonly printf cd 2>/dev/null readonly
+&& /usr/bin $(pwd) cd readonly $(pwd) then ${HOME} readonly readonly printf
+	'quoted text' -eu /usr/bin /usr/bin export cd awk 2>/dev/null readonly
+		printf local echo --verbose cd -eu then $(pwd) grep printf -eu readonly
+		sed echo echo | echo "$1" ${HOME} --verbose -eu local "$1" then readonly
+	test readonly test test -eu grep printf "$1" awk grep printf
+"$1" 2>/dev/null && done "$1" "$@" | awk $(pwd)
+		${HOME} printf $(pwd) | test done "$@" && test then $(pwd) printf done 2>/dev/null
+local printf done --verbose --verbose local done readonly
+		grep ${HOME} sed done awk 'quoted text' 2>/dev/null
+then sed 'quoted text' $(pwd) awk /usr/bin printf | awk local awk echo &&
+	-eu then -eu --verbose
+"$1" /usr/bin grep --verbose /usr/bin cd echo echo 2>/dev/null
+		test done local printf local | awk
+		"$@" done "$@" printf -eu x=1 | cd printf $(pwd) grep awk "$@" |
+local then export "$1" && grep test -eu
+	'quoted text' printf export x=1 x=1
+		then cd | awk 'quoted text' sed x=1 | | $(pwd) awk local awk "$1" export printf
+$(pwd) /usr/bin test local x=1 'quoted text' "$@" && x=1 export then 2>/dev/null
+/usr/bin /usr/bin &&
+		readonly sed awk $(pwd) awk "$@" cd export export --verbose x=1 sed 'quoted text'
+	test 2>/dev/null 'quoted text'
+		echo 'quoted text' test | then local sed x=1 awk 2>/dev/null
+		sed "$@" 2>/dev/null --verbose echo grep printf
+	local | && $(pwd) "$@" | done awk export printf
+printf /usr/bin awk test
+x=1 done && -eu | grep x=1 export --verbose /usr/bin export readonly awk 2>/dev/null
+		cd | sed awk /usr/bin export $(pwd) --verbose echo
+	"$1" awk then 'quoted text' readonly cd readonly done local -eu $(pwd)
+	export cd cd "$1" $(pwd) awk done 'quoted text' 'quoted text' x=1 -eu
+	"$1" --verbose readonly
+	grep x=1 ${HOME} 2>/dev/null grep test | ${HOME} x=1 awk
+	local 'quoted text' -eu /usr/bin 'quoted text' sed
+	x=1 && $(pwd) "$1" ${HOME} "$1" | $(pwd) && cd
+	local cd sed grep /usr/bin awk export && "$1" export ${HOME}
+	x=1 cd export awk awk sed
+sed 2>/dev/null x=1 done -eu /usr/bin sed "$@" | sed then "$@" sed "$1"
+		printf done grep $(pwd) x=1 sed $(pwd)
+$(pwd) /usr/bin x=1 grep -eu test 'quoted text' ${HOME}
+		grep /usr/bin done export printf then x=1 export ${HOME} && $(pwd) x=1 x=1
+	/usr/bin | printf readonly cd awk && sed echo export
+grep echo && && -eu 'quoted text' 2>/dev/null
+		cd 2>/dev/null done ${HOME} /usr/bin
+		"$1" then cd "$@" readonly 2>/dev/null 'quoted text' ${HOME}
+	awk | | "$1" /usr/bin done printf "$1" then "$@" echo --verbose local -eu readonly
+	readonly grep grep awk $(pwd) --verbose test readonly ${HOME}
+		'quoted text' awk | printf --verbose x=1 grep | grep
+--verbose 2>/dev/null test && "$1" -eu --verbose awk then
+echo awk ${HOME} "$1" grep then test "$@" local 'quoted text'
+x=1 2>/dev/null export test | sed test 'quoted text'
+		cd echo ${HOME} "$@" &&
+		x=1 'quoted text' grep x=1 2>/dev/null
+	"$@" awk cd "$@" printf "$1" 2>/dev/null echo x=1 export awk -eu
+	'quoted text' echo test done cd --verbose | echo 2>/dev/null printf
+	&& "$@" awk grep grep ${HOME} export $(pwd) awk export printf --verbose test -eu
+/usr/bin done -eu test ${HOME} &&
+		"$@" printf cd test test 'quoted text'
+awk grep --verbose sed "$1"
+export --verbose --verbose /usr/bin awk "$@" /usr/bin | then
+"$1" 2>/dev/null cd | $(pwd) ${HOME} grep readonly
+/usr/bin "$1" then readonly 'quoted text' awk
+	readonly "$1" export test ${HOME}
+	&& printf readonly grep -eu x=1 "$@" "$1"
+	$(pwd) -eu local sed /usr/bin
+2>/dev/null "$@" x=1 cd echo test 'quoted text' cd | "$@"
+		-eu /usr/bin then "$@" "$@" export 2>/dev/null
+$(pwd) readonly cd test readonly ${HOME} "$1" printf "$@" $(pwd) -eu
+"$@" echo test cd $(pwd) x=1 cd test echo /usr/bin x=1 "$@" --verbose
+		readonly local /usr/bin grep
+"$@" printf echo export
+x=1 | -eu cd test 'quoted text'
+"$@" readonly --verbose 'quoted text'
+echo "$@" done 'quoted text' echo "$1" --verbose done local printf sed
+		/usr/bin $(pwd) --verbose -eu test 2>/dev/null done "$1" test "$1" "$1" | then
+"$1" 'quoted text' | export export printf test ${HOME} -eu -eu && | "$@" "$@"
+${HOME} /usr/bin | cd /usr/bin echo printf awk
+	2>/dev/null ${HOME} | then /usr/bin x=1 -eu 'quoted text' 'quoted text'
+	grep printf | /usr/bin grep 2>/dev/null done grep grep printf 'quoted text'
+		test 'quoted text' /usr/bin echo printf export cd |
+test then | printf printf "$1" ${HOME} readonly 'quoted text'
+	sed then "$@" printf x=1 ${HOME} | export done
+		x=1 readonly | done && "$@" grep echo sed 'quoted text' ${HOME}
+printf --verbose -eu -eu && 'quoted text' export
+	&& && "$@" done then then local cd then 'quoted text' && test cd grep
+x=1 /usr/bin && --verbose "$@" printf done "$@" x=1 x=1 "$@"
+		echo -eu | && ${HOME} -eu awk export $(pwd) $(pwd)
+		&& 2>/dev/null "$1" grep --verbose
+		-eu 'quoted text' printf ${HOME} --verbose "$1" test &&
+"$@" -eu x=1 "$@" test echo cd $(pwd) cd 'quoted text' done
+		| | 2>/dev/null 'quoted text' echo awk 2>/dev/null export printf cd --verbose
+		'quoted text' 2>/dev/null printf export grep echo then awk &&
+		awk sed $(pwd) grep 'quoted text' done echo
+"$@" test x=1 cd --verbose grep local ${HOME} sed
+		done done "$@" x=1 sed && done "$1" cd then sed sed grep export $(pwd)
+readonly ${HOME} "$1" local
+		2>/dev/null $(pwd) export cd ${HOME} --verbose grep then test 'quoted text'
+	'quoted text' "$@" printf export echo 'quoted text' export
+	&& cd "$@" && readonly && | cd echo && echo && --verbose then test readonly
+		| x=1 "$@" done ${HOME} ${HOME} -eu awk "$@"
+	"$1" printf export sed done
+	/usr/bin grep 'quoted text'
+	grep test ${HOME} 2>/dev/null "$1" printf cd ${HOME} done printf done local
+		'quoted text' export 'quoted text' ${HOME} test /usr/bin
+		${HOME} --verbose | ${HOME} cd $(pwd) /usr/bin ${HOME} grep cd /usr/bin && echo
+		x=1 x=1 --verbose awk sed "$@" 2>/dev/null 2>/dev/null then /usr/bin readonly x=1
+	"$1" local "$1" echo "$1" && cd -eu grep then && "$1" echo | awk printf
+	done cd 2>/dev/null printf export grep export 'quoted text' | "$@" "$@" 'quoted text'
+sed --verbose "$1" printf ${HOME} $(pwd) awk export then -eu
+		export /usr/bin /usr/bin then local ${HOME} --verbose
+		local --verbose --verbose readonly cd 'quoted text' then /usr/bin sed
+		'quoted text' "$@" sed local
+		2>/dev/null x=1 "$@" test -eu echo export "$@" readonly | local 'quoted text'
+		--verbose grep 'quoted text'
+		-eu 'quoted text' cd then && 'quoted text' ${HOME}
+		test printf sed sed -eu && printf export "$@" grep done local
+		${HOME} test sed "$@" awk test /usr/bin grep x=1 $(pwd) ${HOME}
+		echo "$1" test 2>/dev/null sed /usr/bin grep -eu cd ${HOME}
+		-eu "$@" test readonly "$@"
+	-eu sed /usr/bin "$@" local sed "$1" done 2>/dev/null | awk --verbose && "$1"
+-eu "$@" -eu --verbose done export echo "$@" $(pwd) echo --verbose sed && done &&
+local readonly awk 2>/dev/null
+	$(pwd) export then test awk readonly $(pwd) sed 'quoted text' x=1
+	"$1" done test done 2>/dev/null 2>/dev/null
+"$@" x=1 grep grep printf grep then test 2>/dev/null -eu export
+	grep readonly x=1 test |
+		&& local ${HOME} && --verbose
+grep -eu sed -eu test export --verbose
+x=1 && done grep /usr/bin grep /usr/bin
+export local printf sed "$1"
+--verbose awk done export awk echo echo
+	printf "$@" 'quoted text' x=1 done cd 'quoted text' sed done
+&& 'quoted text' ${HOME}
+		/usr/bin ${HOME} awk $(pwd) printf
+printf "$@" grep local awk 2>/dev/null ${HOME} echo cd
+&& $(pwd) "$1" cd readonly ${HOME} && /usr/bin then
+"$@" /usr/bin grep awk cd 'quoted text' && "$@" 2>/dev/null done ${HOME} echo
+		/usr/bin 2>/dev/null 2>/dev/null -eu local --verbose
+		printf "$1" export | cd
+	&& done sed && 2>/dev/null 2>/dev/null "$@"
+2>/dev/null test test sed done x=1 $(pwd)
+		'quoted text' echo sed --verbose test
+	export 2>/dev/null readonly
+		readonly printf | ${HOME} readonly readonly "$1" | cd /usr/bin
+"$1" then | | $(pwd) sed /usr/bin | && grep "$@" done awk $(pwd)
+		--verbose x=1 && x=1 test && /usr/bin then 2>/dev/null echo grep
+readonly test && "$1" echo then echo
+| readonly "$@" export
+	"$@" 'quoted text' echo done -eu test ${HOME} sed
+'quoted text' 2>/dev/null done
+export then 2>/dev/null 2>/dev/null ${HOME} cd 'quoted text' &&
+		&& readonly grep "$1" $(pwd) ${HOME} 2>/dev/null printf
+		echo sed then -eu ${HOME}
+	done "$@" 2>/dev/null $(pwd) printf --verbose cd test local echo sed
+	printf | 2>/dev/null sed then --verbose
+		awk done local test | done local
+cd done printf "$1" printf /usr/bin done
+&& local test 2>/dev/null
+${HOME} "$@" export then -eu -eu x=1 $(pwd) sed echo readonly x=1 done 'quoted text'
+awk -eu local export "$1" printf sed printf && sed
+	/usr/bin "$1" 2>/dev/null "$@" ${HOME} --verbose | printf
+echo local && /usr/bin readonly
+'quoted text' done printf done "$@" x=1 echo
+	test local local grep "$1" ${HOME} readonly echo x=1
+	2>/dev/null then local $(pwd) /usr/bin
+	"$1" x=1 then then "$1" echo "$1"
+	"$@" x=1 sed then ${HOME}
+cd | grep x=1 awk echo | export | | sed "$1" readonly 'quoted text' -eu test ${HOME}
+${HOME} | awk --verbose test x=1 export done | "$1" 2>/dev/null
+	$(pwd) /usr/bin local $(pwd) test then --verbose $(pwd) test sed grep done awk
+	'quoted text' /usr/bin export
+		'quoted text' 'quoted text' 'quoted text' | x=1 test then /usr/bin awk $(pwd) ${HOME}
+		x=1 then ${HOME} readonly | $(pwd) 2>/dev/null grep cd | grep cd "$1"
+/usr/bin | cd printf echo export
+	-eu && -eu 'quoted text' readonly echo grep /usr/bin
+	grep /usr/bin test /usr/bin
+		then then printf grep grep x=1 readonly 'quoted text'
+		awk "$1" | cd echo && then test /usr/bin
+	printf ${HOME} cd 'quoted text' printf && export --verbose sed $(pwd) 'quoted text'
+		awk local --verbose readonly
+	2>/dev/null test cd cd --verbose awk export ${HOME}
+		'quoted text' printf readonly x=1
+	printf cd grep ${HOME} then && then 'quoted text' 'quoted text' $(pwd) sed echo
+		/usr/bin awk $(pwd) grep echo /usr/bin
+"$@" done x=1 echo cd -eu && printf x=1 export ${HOME} && ${HOME} "$1" done test
+	done echo "$1" 'quoted text'
+	echo grep /usr/bin done printf ${HOME} done awk -eu done grep
+	x=1 local readonly ${HOME} export "$@" cd test local && --verbose /usr/bin
+		sed awk grep done echo printf awk grep done $(pwd) ${HOME} &&
+'quoted text' $(pwd) grep "$1" test | then printf export
+		grep local $(pwd) --verbose x=1 awk /usr/bin "$@" then sed "$1" --verbose $(pwd)
+'quoted text' sed ${HOME} done $(pwd) "$1" 'quoted text' awk sed 'quoted text'
+&& | local $(pwd) printf sed -eu sed sed "$@"
+	grep grep && grep 2>/dev/null "$1" export awk printf sed local 2>/dev/null
+local echo "$1" 2>/dev/null
+		${HOME} awk test "$@" /usr/bin /usr/bin 2>/dev/null
+	readonly done x=1 local && 'quoted text'
+printf awk awk x=1 test test 'quoted text' 'quoted text' | 'quoted text'
+done "$1" grep --verbose
+/usr/bin -eu printf && 'quoted text' "$@" local x=1 echo /usr/bin
+	-eu $(pwd) awk awk done | echo
+	export printf "$1" done printf awk /usr/bin -eu x=1 readonly printf $(pwd) done
+	local -eu printf | awk --verbose -eu local -eu "$@" $(pwd) --verbose /usr/bin
+		export "$1" ${HOME} grep $(pwd) local done readonly --verbose 'quoted text' readonly
+		export "$@" echo local && 2>/dev/null printf "$1" printf
+		grep local -eu $(pwd) /usr/bin test $(pwd) "$@"
+		readonly awk export | test $(pwd)
+cd local echo --verbose cd awk readonly
+		${HOME} --verbose /usr/bin "$1" | x=1 ${HOME} echo ${HOME} 'quoted text' test
+grep && awk grep printf -eu 2>/dev/null
+	x=1 /usr/bin 2>/dev/null
+		echo $(pwd) x=1 "$@" | then sed done 2>/dev/null /usr/bin -eu -eu 'quoted text'
+2>/dev/null --verbose readonly printf ${HOME} grep "$1" $(pwd) 'quoted text'
+	-eu local then cd printf ${HOME} awk
+		$(pwd) test then x=1 'quoted text' test
+sed awk x=1 cd /usr/bin 'quoted text' x=1
+&& test readonly | export x=1 grep grep
+readonly done local local grep ${HOME}
+cd "$1" $(pwd) printf then local grep | -eu ${HOME} "$@" done test
+		then 'quoted text' export grep x=1 "$@" | awk "$@" ${HOME} readonly
+		-eu 'quoted text' printf "$@" readonly |
+cd readonly | 'quoted text' local
+		done local printf "$@" && /usr/bin awk printf echo 2>/dev/null -eu x=1 sed readonly
+sed x=1 | cd grep then && cd
+	"$@" sed export x=1 | echo grep awk "$1" $(pwd) "$@" $(pwd) awk
+		export $(pwd) --verbose printf sed printf
+--verbose printf 'quoted text' readonly local cd
+${HOME} then "$@" /usr/bin printf "$1" "$1" x=1 2>/dev/null printf
+&& readonly printf local 2>/dev/null export "$1" && x=1 ${HOME}
+	$(pwd) ${HOME} -eu test then
+		"$@" local /usr/bin export
+		sed $(pwd) local printf then
+	-eu $(pwd) && cd -eu echo 2>/dev/null --verbose --verbose /usr/bin 'quoted text'
+&& echo done ${HOME} local | 'quoted text' ${HOME} done
+	--verbose x=1 --verbose "$1" awk printf 2>/dev/null done "$1" &&
+	test cd done sed --verbose cd && readonly sed ${HOME} done
+awk grep "$@" then done /usr/bin $(pwd) "$@" cd /usr/bin
+		&& "$@" local 'quoted text' && grep awk awk && cd x=1 test printf 'quoted text'
+&& readonly echo | export export
+	readonly "$@" 2>/dev/null | done x=1 cd
+local /usr/bin printf cd export x=1 done done x=1 sed echo then && $(pwd) echo
+		| export readonly awk && grep /usr/bin /usr/bin grep /usr/bin -eu
+		"$1" x=1 "$@" "$1" sed && 'quoted text' x=1 x=1 sed --verbose
+readonly 2>/dev/null
+cd readonly echo awk $(pwd) sed $(pwd) 2>/dev/null -eu && -eu --verbose
+readonly && awk /usr/bin printf
+		$(pwd) awk --verbose grep
+	--verbose ${HOME} readonly
+		| ${HOME} done printf ${HOME} test &&
+local awk "$@" 2>/dev/null 'quoted text'
+		${HOME} "$@" --verbose && grep echo && "$@"
+done sed done echo cd readonly x=1
+&& | awk 2>/dev/null "$1" test
+	then $(pwd) | /usr/bin 'quoted text' grep --verbose then local awk awk $(pwd)
+	then x=1 && then /usr/bin "$@" "$1" awk 2>/dev/null && done | local
+		/usr/bin x=1 done sed | done "$@" test && $(pwd) 2>/dev/null && /usr/bin readonly
+		/usr/bin && done 2>/dev/null sed sed ${HOME} "$1" sed 'quoted text' "$1" && awk
+		readonly x=1 /usr/bin cd -eu cd /usr/bin grep done cd test
+	printf local awk grep test awk local printf grep
+	2>/dev/null x=1 echo 2>/dev/null ${HOME} cd local "$1"
+		then readonly sed done printf
+	done grep && export cd done awk export && sed "$1" echo 'quoted text' 'quoted text'
+	test $(pwd) "$@" then awk /usr/bin x=1 sed ${HOME} && test x=1 sed -eu "$@" &&
+	sed "$@" cd ${HOME} grep | -eu ${HOME}
+	cd "$1" then "$@" cd /usr/bin "$1" local echo sed echo x=1 done "$@" sed export
+	export echo awk ${HOME} grep $(pwd) /usr/bin printf && 'quoted text'
+cd sed test && | 2>/dev/null
+	export cd echo echo ${HOME} ${HOME} --verbose ${HOME} done then sed 2>/dev/null
+		sed -eu cd printf "$@" | sed then "$1" readonly sed cd 2>/dev/null 2>/dev/null
+	then /usr/bin printf
+	awk 'quoted text' && printf x=1 cd $(pwd) echo "$@" readonly
+awk export 2>/dev/null ${HOME} ${HOME}
+	then /usr/bin 2>/dev/null && ${HOME} awk
+echo $(pwd) "$@" done done grep readonly export 2>/dev/null
+done export grep --verbose "$1" && 'quoted text' cd local -eu awk ${HOME} export
+${HOME} "$@" printf printf 2>/dev/null "$1" awk ${HOME}
+	"$1" readonly x=1 export grep
+	test /usr/bin "$@" printf "$@" --verbose sed
+		&& sed ${HOME} "$1" "$@" readonly | export "$@" test cd -eu cd cd done
+		${HOME} "$1" /usr/bin x=1 && | | echo $(pwd) cd test readonly --verbose sed
+'quoted text' echo done test local cd "$@" x=1 sed ${HOME}
+export "$@" 2>/dev/null /usr/bin -eu $(pwd) -eu
+2>/dev/null $(pwd) grep "$@"
+awk --verbose echo test
+	-eu 'quoted text' | --verbose
+		/usr/bin /usr/bin readonly ${HOME} local done "$1" test x=1 "$1" &&
+'quoted text' ${HOME} cd then cd "$@" && 2>/dev/null done done ${HOME} --verbose
+local && export done x=1 test 2>/dev/null $(pwd) export cd 2>/dev/null
+then echo echo grep $(pwd) test /usr/bin -eu cd done 2>/dev/null test 2>/dev/null
+	test 'quoted text' readonly x=1 local export export readonly
+	then done 2>/dev/null
+| "$@" export local "$1" readonly awk then done "$1" test -eu 2>/dev/null
+	grep sed ${HOME} grep then then test export && "$@" done printf 'quoted text'
+grep /usr/bin | 2>/dev/null echo test then readonly
+		"$1" test local --verbose | sed && sed && sed $(pwd) sed
+	then ${HOME} ${HOME} grep "$@" x=1 "$1" "$1" local test -eu "$1"
+x=1 cd --verbose "$@" &&
+		echo export 'quoted text' --verbose /usr/bin echo grep 2>/dev/null
+	printf done | x=1 local | sed "$1" local 2>/dev/null
+		done 'quoted text' test local
+		awk test readonly 'quoted text' --verbose
+	x=1 echo -eu sed then $(pwd) printf | -eu | sed "$@" x=1 | readonly local then
+		| test test x=1 printf test x=1 then
+		-eu done -eu printf export test grep --verbose then done
+local readonly done export cd -eu local $(pwd)
+		$(pwd) "$@" awk --verbose | 'quoted text' sed local export ${HOME} readonly awk
+		readonly readonly test | "$1" echo export "$@" local
+		printf local awk sed echo "$@" ${HOME} x=1 then 'quoted text' export
+		done export -eu "$1" "$@" export sed awk ${HOME} readonly readonly
+awk $(pwd) x=1 'quoted text' -eu $(pwd) ${HOME} && done test done
+		$(pwd) export $(pwd) 'quoted text' 2>/dev/null "$1" export done /usr/bin && export
+2>/dev/null ${HOME} "$1" echo /usr/bin test sed awk readonly
+	test && printf export awk 2>/dev/null --verbose && printf readonly "$1"
+		"$@" "$@" ${HOME} done | --verbose local printf local "$1" -eu x=1 readonly grep
+	test && --verbose && awk readonly readonly $(pwd) x=1 x=1 grep
+		x=1 && readonly -eu && -eu $(pwd) --verbose /usr/bin sed ${HOME}
+	grep x=1 /usr/bin && && $(pwd) && local && --verbose done test cd
+	-eu cd done | /usr/bin printf 2>/dev/null
+test cd echo readonly then test -eu -eu awk $(pwd) local ${HOME}
+-eu ${HOME} done 2>/dev/null 2>/dev/null "$@" printf
+	2>/dev/null --verbose echo | local printf "$1" test test &&
+		echo cd local x=1 then echo
+		${HOME} "$1" grep -eu awk && ${HOME} readonly then 'quoted text' readonly
+		then /usr/bin | export local "$1" test | x=1 2>/dev/null local && && echo
+-eu $(pwd) "$@" then && /usr/bin readonly echo cd echo --verbose local
+2>/dev/null local echo readonly
+-eu test | -eu --verbose
+	awk printf sed "$1" | cd "$1" done 2>/dev/null
+		"$1" readonly && "$1" export export $(pwd) &&
+	awk "$1" printf | local --verbose grep awk "$@"
+	done ${HOME} && $(pwd) awk sed test test grep
+	${HOME} --verbose /usr/bin
+	sed "$@" x=1 readonly done 2>/dev/null 'quoted text' local readonly
+		local $(pwd) -eu then test
+	$(pwd) grep "$@" local "$1" printf x=1 readonly
+sed $(pwd) $(pwd) export -eu printf "$@"
+awk /usr/bin then 'quoted text'
+		"$1" printf | printf "$1" grep && 'quoted text' sed local local done grep awk
+		/usr/bin sed | /usr/bin 'quoted text' local
+$(pwd) then 2>/dev/null | local readonly
+		$(pwd) "$@" test grep $(pwd)
+	then test cd "$1" ${HOME} printf 'quoted text' done export test && grep sed test
+		sed readonly | "$@" printf sed && /usr/bin sed then sed
+		/usr/bin --verbose 2>/dev/null | sed "$1" ${HOME} test
+		grep 2>/dev/null awk done sed cd cd export && then
+		2>/dev/null && test --verbose export echo
+readonly awk $(pwd) cd test test /usr/bin /usr/bin readonly
+	test 2>/dev/null cd x=1 echo "$1" export awk 'quoted text'
+		awk $(pwd) "$@" printf 2>/dev/null test && "$@" x=1 | awk grep
+--verbose local test sed done local echo
+		'quoted text' "$@" -eu local done ${HOME} 'quoted text' "$@" sed done | "$1"
+-eu cd "$1" test ${HOME} cd "$@" "$@" x=1 readonly done local done x=1
+x=1 awk 2>/dev/null --verbose readonly
+$(pwd) then done -eu
+export "$@" printf 'quoted text' "$@" readonly
+sed --verbose echo x=1 --verbose export test x=1 done readonly test printf x=1 awk
+then echo $(pwd) export local then 2>/dev/null x=1 then echo done done
+		test test sed ${HOME} then test awk grep readonly cd && done export "$1"
+local x=1 'quoted text' /usr/bin export "$@" echo
+sed | "$@" printf grep ${HOME}
+		| "$1" local | grep grep /usr/bin grep done awk $(pwd) 'quoted text'
+	done awk printf 2>/dev/null "$@" done 'quoted text' sed --verbose $(pwd)
+		awk x=1 cd 'quoted text' cd $(pwd)
+${HOME} --verbose ${HOME} then -eu
+		awk echo readonly /usr/bin sed local ${HOME} | sed echo
+2>/dev/null -eu export grep "$@" printf echo | "$@" 'quoted text' done -eu -eu
+	printf --verbose sed
+	2>/dev/null $(pwd) x=1 --verbose $(pwd)
+		| awk ${HOME} then "$1" "$1" 'quoted text' local grep readonly 'quoted text'
+awk local export && 'quoted text'
+	--verbose echo printf printf ${HOME} export done test cd "$1"
+&& && sed grep cd "$@" 2>/dev/null echo done x=1 local
+		"$@" sed readonly ${HOME} ${HOME} "$@" --verbose awk local readonly &&
+		/usr/bin "$@" then ${HOME} readonly -eu &&
+	x=1 | -eu "$1" sed /usr/bin done "$1"
+		cd | 2>/dev/null -eu test | "$1"
+		-eu | local awk -eu export test --verbose echo sed done done "$@" awk test
+2>/dev/null awk then "$@" echo --verbose -eu test awk
+"$1" --verbose /usr/bin 2>/dev/null $(pwd) export "$1" x=1 2>/dev/null
+sed x=1 --verbose $(pwd) "$@" "$@" 2>/dev/null then /usr/bin
+		| local "$1" printf | /usr/bin | -eu --verbose 'quoted text' test
+	sed awk /usr/bin printf grep && awk
+		test $(pwd) sed test grep -eu awk readonly && echo done then
+		--verbose cd awk /usr/bin then local
+${HOME} readonly "$1" local cd | x=1 readonly 2>/dev/null
+test --verbose printf $(pwd) awk /usr/bin
+		${HOME} cd --verbose 'quoted text' /usr/bin 2>/dev/null --verbose test awk
+	${HOME} /usr/bin echo printf && local local
+readonly | -eu "$@" grep local test then
+	echo | x=1 awk "$1" awk -eu awk $(pwd) export 2>/dev/null | local $(pwd)
+printf echo awk /usr/bin local readonly
+	| -eu grep | "$1" -eu 2>/dev/null printf sed 2>/dev/null echo echo "$1"
+		2>/dev/null 'quoted text' 2>/dev/null "$@"
+${HOME} | printf printf 'quoted text' --verbose then 'quoted text' --verbose local
+	then printf "$@" export export
+export /usr/bin ${HOME} 'quoted text'
+		printf readonly | grep /usr/bin
+test x=1 "$1" | done -eu done done test awk
+-eu local $(pwd) && 2>/dev/null "$@" echo
+	export printf cd "$@" awk | then grep ${HOME}
+		echo readonly 2>/dev/null
+readonly readonly cd "$1" 'quoted text'
+"$1" "$@" /usr/bin readonly done printf && "$1" grep test
+		/usr/bin printf 'quoted text' local echo echo /usr/bin
+/usr/bin awk ${HOME} sed printf "$@" then
+		$(pwd) echo 2>/dev/null 2>/dev/null
+		then | local ${HOME} then echo 2>/dev/null 2>/dev/null echo $(pwd) grep "$1" grep
+		test test readonly ${HOME} 'quoted text' "$1" -eu readonly /usr/bin
+grep awk done 2>/dev/null done test /usr/bin export test
+&& /usr/bin echo "$1" --verbose "$1" done
+		&& sed && && then x=1 local local /usr/bin x=1 "$@" grep echo 2>/dev/null
+cd "$1" 'quoted text' /usr/bin
+	$(pwd) cd local awk done "$@" "$1" echo test
+	"$1" ${HOME} ${HOME} grep $(pwd)
+&& local grep readonly done
+sed printf "$@" grep && cd "$@" && 'quoted text' ${HOME} local local then
+		x=1 then "$@" x=1 2>/dev/null export -eu 'quoted text'
+		2>/dev/null grep ${HOME} $(pwd)
+| printf printf then
+	grep printf echo sed readonly "$@" test | then --verbose /usr/bin then done
+then local echo echo readonly test test
+/usr/bin test 'quoted text' done "$@" --verbose 'quoted text' -eu &&
+sed "$1" awk | then -eu done ${HOME} ${HOME} awk 2>/dev/null
+	then sed && readonly awk 'quoted text'
+		"$@" test "$1" echo 'quoted text'
+	readonly "$1" cd grep local --verbose | 'quoted text' &&
+		--verbose /usr/bin printf 'quoted text' test /usr/bin
+	local "$1" -eu test sed x=1 ${HOME} "$1" | 2>/dev/null
+		test local echo grep then then /usr/bin printf printf echo 'quoted text'
+readonly cd export && -eu /usr/bin && | then | ${HOME} printf test -eu awk
+	done awk | sed x=1 export x=1
+		grep 'quoted text' grep x=1 --verbose
+local "$1" "$1" && /usr/bin -eu cd -eu "$@" printf test local 'quoted text'
+'quoted text' | && "$1" "$1" "$1" && && done --verbose
+		$(pwd) "$1" 'quoted text' grep $(pwd) 2>/dev/null
+		/usr/bin done echo -eu sed ${HOME} printf readonly
+	&& x=1 $(pwd) printf printf awk then test ${HOME} echo -eu
+	"$1" ${HOME} grep printf
+		export test 2>/dev/null grep printf | x=1 export x=1
+'quoted text' 'quoted text' local test "$@" echo readonly
+readonly /usr/bin printf $(pwd) export sed awk -eu ${HOME} /usr/bin $(pwd)
+	test then x=1 local /usr/bin
+	sed "$@" grep echo awk
+		&& done sed local grep --verbose
+	"$@" "$@" export && "$1" "$1" cd --verbose "$@" --verbose printf then
+-eu awk grep && local 2>/dev/null
+		local done /usr/bin export export | grep -eu 'quoted text' 2>/dev/null
+		&& ${HOME} ${HOME} $(pwd) 'quoted text'
+x=1 done local 'quoted text' readonly
+$(pwd) --verbose grep 'quoted text' awk "$@" done sed -eu --verbose
+| ${HOME} echo ${HOME} /usr/bin readonly "$@" grep
+x=1 && | done grep local sed readonly x=1 awk test readonly
+$(pwd) grep /usr/bin x=1
+	"$@" cd sed -eu 'quoted text' --verbose /usr/bin local --verbose
+		/usr/bin -eu grep /usr/bin awk && --verbose readonly ${HOME} ${HOME} readonly then
+	'quoted text' cd "$1" "$@" "$@" printf $(pwd) local --verbose
+	$(pwd) cd /usr/bin printf test sed x=1 /usr/bin export
+cd done test awk --verbose cd local local --verbose sed
+cd done $(pwd) x=1 done sed sed ${HOME}
+	${HOME} 2>/dev/null 'quoted text'
+grep 'quoted text' $(pwd) -eu export cd -eu readonly $(pwd) grep sed "$@" "$@"
+&& --verbose | $(pwd) cd export
+$(pwd) x=1 "$1" /usr/bin
+	echo 'quoted text' | $(pwd) /usr/bin /usr/bin then done $(pwd) cd 2>/dev/null
+$(pwd) "$@" then $(pwd) cd awk x=1 'quoted text' 'quoted text' readonly /usr/bin
+	sed -eu local readonly /usr/bin 2>/dev/null
+${HOME} && 'quoted text' ${HOME} -eu local grep | test | cd "$1" |
+		${HOME} local test /usr/bin && echo sed echo | x=1 'quoted text' local
+-eu echo ${HOME} "$@" --verbose --verbose | -eu echo $(pwd) 'quoted text'
+		readonly local "$@" | x=1 printf
+	&& echo "$@" "$@" && && cd cd 2>/dev/null "$@" x=1 then cd
+		done grep $(pwd) printf | | then then grep
+		| --verbose echo | ${HOME} export
+		done ${HOME} then awk | x=1 export cd readonly
+		readonly /usr/bin awk /usr/bin 2>/dev/null 2>/dev/null --verbose awk
+-eu "$1" readonly cd 2>/dev/null 'quoted text' x=1 local -eu &&
+	then "$@" 2>/dev/null cd "$1" readonly | grep test test awk printf
+local echo && test echo then sed
+		$(pwd) --verbose 2>/dev/null "$@" -eu | export cd "$1" awk 'quoted text' grep
+		test && $(pwd) local ${HOME} awk -eu
+	"$@" test ${HOME} echo $(pwd) done then 2>/dev/null "$@" awk sed
+		'quoted text' cd echo readonly
+awk test done /usr/bin then "$@" ${HOME} x=1
+	&& sed local "$1" done "$@" --verbose -eu 2>/dev/null
+		2>/dev/null 'quoted text' /usr/bin then local | test export 2>/dev/null
+	"$@" --verbose "$@" grep $(pwd) 'quoted text' 'quoted text' && 2>/dev/null
+		readonly "$@" ${HOME} /usr/bin
+"$1" "$1" sed ${HOME} 'quoted text' local | then $(pwd) then cd test /usr/bin test
+| done awk printf readonly
+/usr/bin | && cd grep 'quoted text'
+	-eu -eu done sed grep $(pwd) awk printf grep
+&& -eu export $(pwd)
+printf grep export then test then 2>/dev/null
+		grep grep 2>/dev/null
+2>/dev/null && 2>/dev/null
+	"$1" sed awk 2>/dev/null 'quoted text' "$1" $(pwd) export
+	${HOME} "$1" awk $(pwd) cd
+${HOME} "$1" -eu ${HOME} 2>/dev/null
+	then "$@" | echo then | 'quoted text' test local
+		-eu local --verbose && --verbose then |
+		printf grep x=1 awk 2>/dev/null /usr/bin "$1" ${HOME} then /usr/bin
+${HOME} /usr/bin && done $(pwd) export export then export test |
+	$(pwd) cd printf test ${HOME}
+x=1 $(pwd) x=1 grep 2>/dev/null x=1 "$@" --verbose
+	-eu -eu -eu --verbose 'quoted text' export
+2>/dev/null readonly | done echo local
+-eu 2>/dev/null 2>/dev/null
+		export export --verbose test --verbose echo export local cd $(pwd)
+		echo export "$1" ${HOME}
+	${HOME} awk "$1" /usr/bin 2>/dev/null x=1 'quoted text'
+		printf /usr/bin 'quoted text'
+done done local awk test "$@" test x=1 "$1" done awk && ${HOME}
+cd printf grep "$@" test | sed export
+	${HOME} --verbose grep x=1 cd | sed /usr/bin -eu 2>/dev/null test 'quoted text'
+sed --verbose sed printf ${HOME} cd --verbose done | local export --verbose
+		-eu printf grep "$1" x=1 export -eu | awk $(pwd) 2>/dev/null
+| "$1" local grep grep x=1 x=1 'quoted text' -eu | cd sed local
+		done | | cd 2>/dev/null cd ${HOME} awk awk $(pwd) then
+	printf /usr/bin "$1" "$@" | cd ${HOME} ${HOME}
+	&& $(pwd) $(pwd) echo local cd $(pwd)
+		"$1" test readonly ${HOME} done 2>/dev/null readonly 2>/dev/null
+"$1" then x=1 -eu done ${HOME} done then export x=1 echo
+"$@" then $(pwd) --verbose test readonly
+done 2>/dev/null readonly done
+	done --verbose "$@" echo ${HOME} --verbose
+test "$1" echo awk 2>/dev/null
+| x=1 x=1 $(pwd) then | 'quoted text' echo local awk test "$@"
+-eu awk | ${HOME} sed "$@" done done 2>/dev/null
+echo sed -eu test done x=1 export && --verbose | 'quoted text' printf export
+	readonly /usr/bin awk 2>/dev/null
+		export export printf "$1" -eu grep test grep grep $(pwd) readonly x=1 -eu
+local local echo /usr/bin cd ${HOME} sed cd awk done export && /usr/bin -eu &&
+	&& -eu && cd -eu 2>/dev/null 'quoted text' | grep
+x=1 x=1 /usr/bin "$@" echo x=1 --verbose -eu
+		readonly "$1" 2>/dev/null 2>/dev/null
+--verbose local awk -eu
+		sed "$@" done 2>/dev/null 'quoted text' cd $(pwd) /usr/bin readonly
+		--verbose && export /usr/bin | "$@" done ${HOME} --verbose
+		local /usr/bin test ${HOME} 2>/dev/null 'quoted text'
+	x=1 -eu then export echo printf && then cd readonly local "$1" ${HOME}
+	grep test export cd local 'quoted text' x=1 "$@" awk printf 2>/dev/null
+	local "$1" done local "$1" readonly sed local | echo awk --verbose /usr/bin
+		readonly && test && && export "$1" echo &&
+	-eu grep /usr/bin 'quoted text' --verbose grep readonly ${HOME} /usr/bin 'quoted text'
+-eu 2>/dev/null readonly ${HOME} sed local done sed then | done
+	-eu local cd local echo 2>/dev/null cd
+		printf /usr/bin grep ${HOME}
+&& /usr/bin /usr/bin "$1" x=1 done
+cd readonly 2>/dev/null /usr/bin awk &&
+printf | /usr/bin ${HOME} "$@"
+		$(pwd) cd printf 2>/dev/null -eu echo test done grep $(pwd) printf
+	printf readonly ${HOME} "$@" readonly x=1 sed x=1 "$1"
+		cd awk x=1 then "$@" "$@" echo "$1" ${HOME}
+'quoted text' printf grep
+readonly printf --verbose export readonly local ${HOME} readonly |
+		2>/dev/null sed && then x=1 -eu export readonly test local $(pwd) &&
+		$(pwd) awk && /usr/bin 2>/dev/null sed ${HOME} "$1" echo && --verbose done
+		echo then && readonly printf $(pwd) then -eu 'quoted text' test readonly
+-eu && "$@" cd local "$@" sed "$@"
+		then && -eu /usr/bin echo grep x=1 cd /usr/bin grep x=1 ${HOME}
+test local /usr/bin printf 2>/dev/null
+		grep export "$1" | 2>/dev/null && test 'quoted text'
+		export sed cd cd export export
+	printf --verbose sed $(pwd) -eu local "$1" &&
+		readonly && local local cd cd ${HOME} then | ${HOME} echo -eu export
+-eu printf echo sed test 'quoted text'
+echo sed test | $(pwd) done
+	2>/dev/null done done /usr/bin
+	test echo awk sed $(pwd) 2>/dev/null
+test ${HOME} echo 2>/dev/null
+		-eu export 'quoted text' then awk | -eu test 'quoted text' readonly ${HOME}
+		echo 2>/dev/null 'quoted text' sed echo done readonly $(pwd) local echo $(pwd)
+		readonly ${HOME} printf
+cd awk -eu printf echo "$@" --verbose
+		x=1 --verbose echo --verbose done printf done echo
+		export test 2>/dev/null /usr/bin grep &&
+	&& done -eu "$@" test grep sed "$1" printf $(pwd) awk awk "$1" &&
+cd printf $(pwd) printf printf 'quoted text' printf local "$1" awk
+		"$@" ${HOME} export 'quoted text' local awk | echo
+| "$1" cd x=1 echo x=1 x=1 local done cd --verbose done
+"$@" && echo -eu readonly echo awk | 'quoted text'
+		grep done --verbose "$@" echo awk x=1 /usr/bin ${HOME} test then done
+	-eu sed then echo && done --verbose && test "$1" done test -eu then x=1
+	printf "$1" printf $(pwd) sed $(pwd) && echo printf ${HOME}
+		test echo export sed local test then -eu grep
+export local export -eu test awk
+--verbose cd sed x=1 local sed 2>/dev/null awk cd
+	x=1 2>/dev/null awk /usr/bin
+$(pwd) printf cd | then readonly /usr/bin
+	2>/dev/null ${HOME} "$1" cd /usr/bin awk grep --verbose && | readonly 2>/dev/null
+	"$@" sed printf done &&
+		2>/dev/null echo ${HOME} done x=1 grep "$@" readonly
+done | echo readonly && x=1
+	cd done done readonly test 'quoted text' "$@" echo /usr/bin
+${HOME} then local awk echo --verbose x=1 echo then x=1 sed ${HOME}
+	then readonly then "$1" done awk printf test printf
+	awk test printf -eu "$@"
+		| x=1 then grep x=1 then && grep 2>/dev/null export
+grep -eu -eu readonly 2>/dev/null
+	grep then then grep | cd
+	${HOME} x=1 -eu printf "$1" test "$1" test 2>/dev/null
+		local ${HOME} export 2>/dev/null test then sed grep then awk /usr/bin
+sed awk echo done grep export done done 'quoted text'
+	'quoted text' ${HOME} local "$@" readonly "$@" export done ${HOME} local |
+	| "$@" $(pwd) export "$@" done echo "$@" local awk local /usr/bin cd sed "$1" ${HOME}
+2>/dev/null then done --verbose $(pwd) local export
+	local "$@" printf $(pwd) /usr/bin
+	${HOME} cd "$1" ${HOME} test echo 'quoted text' ${HOME} local readonly test
+		${HOME} x=1 "$@" printf 'quoted text' grep
+	cd --verbose 2>/dev/null
+	"$1" 'quoted text' readonly sed test -eu readonly
+2>/dev/null "$1" then awk x=1 then
+		echo test then ${HOME} done grep done cd $(pwd) done 2>/dev/null cd "$@"
+$(pwd) "$@" && sed --verbose -eu ${HOME} /usr/bin --verbose
+	export local grep echo
+	-eu /usr/bin $(pwd) sed | printf local readonly /usr/bin done &&
+	&& -eu then cd test export && 2>/dev/null $(pwd) "$@" grep grep --verbose
+awk x=1 'quoted text' export -eu awk sed printf
+	| ${HOME} export local 2>/dev/null
+		/usr/bin done awk "$@" --verbose
+awk -eu then grep 2>/dev/null /usr/bin test export | done x=1 done
+	export printf awk | test
+		cd | ${HOME} | --verbose --verbose --verbose
+	${HOME} sed then && x=1 $(pwd) printf
+	${HOME} local /usr/bin "$1"
+	--verbose && /usr/bin awk awk cd local done echo
+		"$1" awk done grep sed
+		${HOME} local cd cd | awk
+		export x=1 printf "$@" cd $(pwd) x=1 cd cd then ${HOME} test |
+printf sed --verbose /usr/bin then 'quoted text' local
+awk "$@" --verbose done -eu 'quoted text'
+	/usr/bin "$1" export && ${HOME} export ${HOME} readonly $(pwd) printf 2>/dev/null
+		local printf sed awk echo then sed then
+2>/dev/null then ${HOME} sed echo $(pwd)
+	printf local cd -eu done local 'quoted text' 2>/dev/null
+		x=1 grep 'quoted text' 'quoted text' ${HOME}
+		&& grep local sed "$@" -eu then cd /usr/bin done done done
+2>/dev/null export printf $(pwd) ${HOME} | then grep done test x=1 sed export
+| printf done 'quoted text' printf /usr/bin test | /usr/bin readonly
+sed -eu -eu awk done cd readonly
+		| | printf && x=1 local test grep
+	readonly x=1 awk --verbose ${HOME} readonly "$@" test
+| export x=1 done local export then test | "$1" echo readonly export printf printf
+	--verbose readonly --verbose -eu /usr/bin
+grep && readonly && export -eu /usr/bin grep "$@" "$@" export test
+		${HOME} "$@" awk readonly && "$1" cd && | 'quoted text' local 'quoted text'
+	"$@" | /usr/bin && export
+		"$@" test && "$1" 'quoted text' sed -eu echo grep --verbose 2>/dev/null
+2>/dev/null /usr/bin test test 'quoted text' "$1" sed "$@" cd grep 'quoted text'
+		-eu printf --verbose then local "$@" then $(pwd) done /usr/bin
+	printf | | "$1" $(pwd) local then $(pwd) awk local "$1" grep done export "$@" &&
+'quoted text' ${HOME} cd --verbose grep echo 'quoted text'
+		readonly sed "$@" && echo cd done | x=1 echo sed 'quoted text'
+--verbose grep grep done /usr/bin 2>/dev/null cd then
+	done && readonly | printf ${HOME} "$@" x=1 then sed ${HOME}
+	awk $(pwd) sed then -eu then && 'quoted text'
+	readonly printf then --verbose 'quoted text'
+local test local 2>/dev/null
+local local test grep
+	sed grep cd done --verbose
+	'quoted text' readonly echo readonly grep ${HOME} local grep "$@" /usr/bin
+	2>/dev/null 'quoted text'
+x=1 $(pwd) export cd | local awk --verbose cd /usr/bin printf -eu $(pwd)
+	2>/dev/null local "$@" ${HOME} $(pwd) ${HOME} -eu test awk
+test then done -eu 2>/dev/null printf /usr/bin readonly
+	$(pwd) sed $(pwd) sed $(pwd)
+	${HOME} --verbose sed sed /usr/bin ${HOME} 'quoted text' "$@" then awk
+test 'quoted text' /usr/bin export readonly /usr/bin
+test x=1 x=1 | "$1" echo x=1 $(pwd) "$1" export -eu sed 'quoted text' 'quoted text'
+	readonly test export x=1 then test local grep 'quoted text' done "$@"
+	sed /usr/bin cd grep $(pwd) readonly x=1 $(pwd) "$@" && x=1 $(pwd)
+${HOME} printf /usr/bin --verbose done done readonly
+		then x=1 awk cd x=1 "$@" cd "$1" && cd echo readonly $(pwd) test
+		| cd sed test $(pwd) "$@" | "$1" then readonly
+test cd $(pwd) cd cd
+	$(pwd) sed -eu export --verbose local "$1" awk awk done | awk printf
+&& 2>/dev/null awk 'quoted text' awk readonly x=1 grep "$1" echo
+sed $(pwd) sed x=1 awk -eu --verbose done done
+&& "$@" printf && cd "$1"
+	${HOME} export && export local x=1 2>/dev/null "$1" /usr/bin 'quoted text' 2>/dev/null
+	done readonly 'quoted text' readonly cd awk local
+		/usr/bin echo ${HOME} "$@" --verbose "$1"
+&& then awk x=1 ${HOME} -eu && sed grep --verbose && | sed awk
+	x=1 --verbose -eu "$1" readonly sed
+/usr/bin 'quoted text' ${HOME} $(pwd) printf x=1 done "$1" 2>/dev/null
+'quoted text' test "$@" 'quoted text' cd local $(pwd) awk x=1 export echo
+	local readonly /usr/bin export then readonly
+		local --verbose "$1" local 2>/dev/null $(pwd) "$@" grep
+		local && export grep sed "$1"
+	-eu readonly && export "$@" x=1 echo -eu ${HOME} grep test && ${HOME} && &&
+sed --verbose export cd then then /usr/bin --verbose readonly
+	readonly local local done | printf printf "$1" sed
+2>/dev/null then export awk test x=1
+awk sed 2>/dev/null /usr/bin echo 'quoted text' printf echo export local
+		awk "$@" | sed 'quoted text' test printf done done export $(pwd) 2>/dev/null
+test 'quoted text' $(pwd) -eu "$@" then then /usr/bin done 2>/dev/null
+		printf $(pwd) local /usr/bin ${HOME} sed printf
+cd -eu cd local | && -eu /usr/bin "$1" readonly grep x=1 export
+	"$@" "$@" "$1" x=1 readonly printf
+		cd x=1 "$1" ${HOME} echo "$1" --verbose &&
+		awk export readonly $(pwd) test printf "$@" ${HOME} | echo printf
+x=1 grep $(pwd) then "$@" cd
+test 'quoted text' sed cd grep export
+		readonly echo local --verbose
+	awk ${HOME} sed --verbose && awk done
+	done echo /usr/bin cd export
+	done 2>/dev/null | export 2>/dev/null sed
+'quoted text' x=1 grep "$1" ${HOME} && printf echo 2>/dev/null
+cd --verbose grep test cd 2>/dev/null
+		local sed && done 'quoted text' 'quoted text'
+	cd sed test "$@" x=1 test "$1" awk 'quoted text'
+	--verbose done readonly echo
+	test readonly ${HOME} -eu done sed /usr/bin && echo printf
+	$(pwd) cd cd $(pwd) ${HOME} readonly -eu | | awk export export x=1 "$@" printf
+then "$@" test | --verbose export ${HOME} test /usr/bin test "$1" 2>/dev/null
+	printf "$@" readonly "$1" 'quoted text'
+	'quoted text' export $(pwd) done $(pwd) readonly
+printf cd | grep done export -eu
+done printf then grep x=1 echo /usr/bin
+printf x=1 "$@" "$@" export -eu grep x=1 done export sed -eu
+| cd 'quoted text' sed 'quoted text'
+		"$1" 2>/dev/null readonly --verbose sed 'quoted text'
+	&& --verbose && "$@" x=1 ${HOME} cd echo | --verbose local | sed -eu readonly
+x=1 done local sed echo "$@" "$1" /usr/bin x=1 2>/dev/null
+"$@" "$@" 2>/dev/null readonly /usr/bin export echo cd | cd
+		readonly "$1" ${HOME} grep printf grep
+		awk x=1 then local "$@" 'quoted text'
+| then printf /usr/bin local sed | awk then && then $(pwd)
+		"$@" readonly printf /usr/bin && 2>/dev/null
+	'quoted text' readonly echo then readonly done done sed readonly export
+		sed grep test /usr/bin export grep -eu "$@" $(pwd) -eu 'quoted text' grep
+		$(pwd) ${HOME} awk | test --verbose x=1 |
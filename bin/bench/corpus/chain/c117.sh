@@ -0,0 +1,2001 @@
+	export sed then grep && x=1 ${HOME}
+sed done -eu ${HOME} sed ${HOME} export "$@" awk /usr/bin cd cd local sed printf
+		2>/dev/null printf | echo cd 2>/dev/null printf
+	| ${HOME} --verbose "$@" export 2>/dev/null cd test ${HOME} --verbose
+	$(pwd) $(pwd) readonly | $(pwd) then
+local $(pwd) 'quoted text' done ${HOME} "$@" $(pwd) "$1" echo
+2>/dev/null --verbose test x=1 local
+	readonly 2>/dev/null cd && cd readonly local export test export test 2>/dev/null
+		local -eu && test test $(pwd) then echo sed /usr/bin printf awk $(pwd)
+--verbose echo --verbose x=1 /usr/bin test -eu ${HOME} local /usr/bin cd export
+		printf readonly local 2>/dev/null then export 'quoted text' --verbose
+	awk grep printf $(pwd) done /usr/bin /usr/bin printf
+	printf 2>/dev/null | | "$1" 'quoted text' -eu ${HOME} awk $(pwd)
+x=1 -eu --verbose "$@" | done awk
+		${HOME} grep x=1 /usr/bin local /usr/bin && done readonly x=1 grep
+&& then then then 'quoted text' "$1" printf $(pwd) $(pwd)
+	/usr/bin 2>/dev/null local | awk "$1" x=1 printf readonly | ${HOME}
+	sed && echo --verbose grep sed | test done echo /usr/bin printf
+		cd ${HOME} $(pwd) 'quoted text'
+		'quoted text' x=1 cd awk local awk local readonly local "$@" readonly
+printf export printf test readonly local && printf printf
+		x=1 | /usr/bin && x=1 "$@" then
+	echo echo | /usr/bin ${HOME}
+		-eu grep awk sed "$1" cd test export readonly
+| && -eu 2>/dev/null "$@" && x=1 grep ${HOME}
+		export 2>/dev/null grep test ${HOME} readonly $(pwd) sed 'quoted text'
+		local local done ${HOME} ${HOME} done test "$1" -eu
+-eu cd echo "$1" echo | then 'quoted text' x=1 $(pwd)
+		cd cd "$1" 2>/dev/null readonly then printf then awk test --verbose awk printf
+sed ${HOME} done $(pwd) $(pwd) echo --verbose
+	/usr/bin local local test 2>/dev/null sed x=1 --verbose
+	${HOME} 'quoted text' | 2>/dev/null test 'quoted text' "$1"
+	readonly 2>/dev/null local "$1"
+	x=1 "$1" 2>/dev/null local then local ${HOME}
+printf $(pwd) local awk done -eu done "$@"
+		readonly then cd readonly 2>/dev/null "$@" readonly sed local
+		| echo /usr/bin then export | export sed readonly
+		/usr/bin cd && done then 'quoted text' 'quoted text' test
+	sed printf cd done cd $(pwd) export
+printf && "$1" awk sed
+		2>/dev/null ${HOME} | cd && -eu
+		local then "$@" "$@" export echo "$@" "$1" /usr/bin -eu /usr/bin
+		then test -eu cd ${HOME} $(pwd) ${HOME} && sed --verbose -eu && "$1" $(pwd) 2>/dev/null
+	then sed ${HOME} test
+awk then grep printf && test --verbose done local x=1 printf awk --verbose "$@"
+	x=1 sed printf | export && awk test -eu
+sed echo printf /usr/bin /usr/bin x=1 done grep "$1" export
+test --verbose export "$@" awk ${HOME}
+		test done "$@" && awk -eu grep echo "$1" printf | "$@"
+	done awk printf | 'quoted text' test ${HOME} cd ${HOME} | $(pwd) done && 2>/dev/null
+	sed local printf test export /usr/bin grep --verbose | cd $(pwd) grep grep test
+		2>/dev/null echo done echo sed cd then "$1" readonly -eu && readonly export
+/usr/bin done --verbose ${HOME} /usr/bin cd sed | local awk x=1 'quoted text'
+		readonly --verbose $(pwd)
+		echo /usr/bin echo cd x=1
+/usr/bin echo local local then $(pwd) 2>/dev/null then /usr/bin test "$@"
+export echo | local 2>/dev/null x=1 export
+${HOME} "$1" -eu printf printf "$@" $(pwd)
+&& export printf x=1 ${HOME} 2>/dev/null 2>/dev/null 'quoted text' 2>/dev/null
+done awk done x=1 awk -eu 'quoted text' x=1 export cd $(pwd) awk
+		export 2>/dev/null echo test test
+		-eu local "$@" 'quoted text' grep printf cd
+	2>/dev/null "$1" done awk 'quoted text' sed grep
+		-eu ${HOME} then | | -eu
+"$@" sed printf local test "$1" -eu sed local 'quoted text'
+grep sed echo test --verbose awk "$1" awk -eu echo awk cd then
+	test -eu printf $(pwd) sed cd
+		grep grep x=1 /usr/bin echo --verbose --verbose
+	"$1" awk local test grep then grep /usr/bin done
+		${HOME} 'quoted text' "$1" then awk grep
+	awk $(pwd) /usr/bin done x=1 printf 2>/dev/null then awk --verbose $(pwd)
+		awk "$@" $(pwd) readonly ${HOME} readonly
+	export | 'quoted text' 2>/dev/null
+	"$@" test cd export local ${HOME} 2>/dev/null readonly ${HOME} x=1
+	printf export -eu then /usr/bin
+		'quoted text' then "$1" done echo | then /usr/bin
+	--verbose "$1" printf /usr/bin export export 2>/dev/null
+		done /usr/bin "$1" done then
+	cd export 2>/dev/null --verbose "$@" "$1" | export ${HOME} x=1
+		test --verbose grep ${HOME} awk echo /usr/bin export printf awk echo
+	"$1" "$1" | "$1" awk $(pwd) ${HOME} x=1 grep
+		readonly then local test -eu | test $(pwd) ${HOME} export done &&
+	/usr/bin && x=1 $(pwd) cd
+	&& --verbose echo --verbose x=1 sed $(pwd) && readonly readonly
+		readonly "$@" test /usr/bin
+	"$@" local sed /usr/bin |
+"$1" x=1 echo $(pwd) $(pwd) -eu readonly ${HOME}
+		"$1" --verbose awk | /usr/bin
+cd awk && /usr/bin 'quoted text' "$@" ${HOME}
+-eu | test cd "$@" awk $(pwd) $(pwd)
+local "$1" sed readonly && x=1 cd 'quoted text' done test
+	"$@" sed x=1 local echo --verbose
+	&& awk $(pwd) cd done ${HOME} /usr/bin -eu awk readonly cd awk then -eu
+export cd sed ${HOME} -eu cd && -eu -eu -eu
+		"$@" echo readonly grep 2>/dev/null x=1 "$@"
+	readonly readonly local cd export grep /usr/bin test done
+done grep printf export export local
+done -eu | then /usr/bin "$@" && x=1 | x=1 export x=1 | printf && awk
+awk test ${HOME} && grep $(pwd) grep cd /usr/bin $(pwd)
+	sed export printf printf && "$1" test --verbose
+	sed && -eu printf $(pwd) cd --verbose && | awk 2>/dev/null
+cd $(pwd) ${HOME} sed ${HOME}
+--verbose echo test sed cd x=1 export
+export "$1" printf 'quoted text' x=1 -eu export $(pwd)
+--verbose $(pwd) echo
+	| | 'quoted text' 2>/dev/null grep "$1" printf
+awk 2>/dev/null x=1 "$@" "$1" 2>/dev/null done printf then
+	awk sed "$@" then echo local cd
+--verbose && printf sed then --verbose
+	test 'quoted text' $(pwd) readonly && x=1 /usr/bin && -eu
+grep test 2>/dev/null done
+		readonly sed 'quoted text' export readonly
+		2>/dev/null export grep export "$@" awk x=1 ${HOME} 'quoted text'
+	then /usr/bin export echo awk && awk "$1"
+		test && ${HOME} x=1 && then 'quoted text'
+	2>/dev/null test --verbose done x=1 -eu readonly 2>/dev/null cd done | ${HOME}
+	$(pwd) echo "$@" 'quoted text' then readonly
+	"$1" /usr/bin then local cd 'quoted text' readonly "$@" /usr/bin
+	test --verbose /usr/bin echo export cd ${HOME} "$1" && $(pwd)
+		/usr/bin | /usr/bin then /usr/bin ${HOME} awk grep | && | cd export
+$(pwd) readonly grep local --verbose awk 'quoted text'
+	echo printf local readonly 'quoted text' done "$1" "$1" printf
+		printf | x=1 readonly "$@" -eu /usr/bin cd echo && export export
+	2>/dev/null test | "$@" /usr/bin /usr/bin 'quoted text'
+printf cd local export grep && readonly | local printf test grep cd
+	2>/dev/null /usr/bin x=1 -eu grep | /usr/bin $(pwd) local "$@" 2>/dev/null
+		echo /usr/bin export
+awk readonly awk && export -eu && -eu readonly
+	${HOME} printf grep export x=1 sed test
+2>/dev/null && ${HOME} ${HOME} echo 'quoted text' printf readonly --verbose
+test ${HOME} export readonly
+local awk printf 2>/dev/null echo
+		echo ${HOME} readonly test cd awk export local && x=1
+readonly done echo then echo export
+-eu sed awk cd then echo /usr/bin done echo ${HOME} -eu
+-eu ${HOME} ${HOME} x=1 -eu -eu awk --verbose echo 'quoted text'
+	cd test then cd "$1" | printf then echo grep test
+	local -eu && echo sed | 'quoted text' x=1 'quoted text'
+${HOME} echo echo printf awk then cd "$@" --verbose x=1
+		test 2>/dev/null 'quoted text' export "$@" cd grep "$1" grep export ${HOME} grep
+		-eu cd /usr/bin test 'quoted text' "$1" grep /usr/bin awk grep echo awk export
+-eu test 2>/dev/null test /usr/bin awk | cd "$@" && cd | 2>/dev/null -eu export
+		'quoted text' -eu grep 'quoted text'
+		-eu awk sed done test then --verbose
+--verbose /usr/bin | awk then --verbose sed $(pwd) export grep printf
+	cd "$@" $(pwd) awk test readonly /usr/bin test then --verbose
+		printf 'quoted text' ${HOME} 'quoted text' $(pwd) export 2>/dev/null awk
+x=1 test export export grep readonly sed
+		printf --verbose echo echo 2>/dev/null x=1 sed grep
+${HOME} /usr/bin 2>/dev/null /usr/bin
+		/usr/bin /usr/bin x=1 "$1" printf "$1" -eu echo
+	local echo /usr/bin export local -eu 'quoted text'
+	"$@" | readonly "$@" "$@"
+		"$@" "$1" readonly && echo ${HOME} echo $(pwd) -eu local && ${HOME}
+x=1 -eu printf local cd $(pwd) test 'quoted text'
+"$@" grep test cd awk "$1" printf && $(pwd) "$@" ${HOME} 2>/dev/null --verbose
+&& awk printf && then readonly 'quoted text' "$@" done x=1 test printf
+	printf printf "$@" local
+$(pwd) readonly /usr/bin printf readonly 'quoted text'
+		"$@" --verbose ${HOME} && sed /usr/bin
+	awk then $(pwd) --verbose printf | | local local "$@" printf "$1" echo local "$1"
+	sed "$@" x=1 printf export printf | $(pwd) test echo readonly && -eu | test
+	&& printf local "$1" cd sed 'quoted text' export local && $(pwd) printf
+		'quoted text' then x=1 "$1" readonly
+	/usr/bin local x=1 grep && "$@" 'quoted text' $(pwd) "$1" sed && local done
+test -eu sed sed x=1 --verbose test readonly export --verbose
+		test | && "$1" -eu ${HOME} "$@" grep --verbose grep x=1 export --verbose $(pwd)
+	then ${HOME} x=1 'quoted text'
+| x=1 awk 'quoted text' cd --verbose $(pwd) x=1 -eu && &&
+		then x=1 echo "$@" -eu then sed local local then then x=1 && x=1 x=1 ${HOME}
+| x=1 ${HOME} "$@" $(pwd)
+	&& 2>/dev/null 2>/dev/null printf "$@" echo "$@" && "$1" 2>/dev/null
+		printf local 'quoted text'
+		x=1 "$1" ${HOME} then echo printf test local
+		done done /usr/bin sed /usr/bin --verbose printf
+		export ${HOME} ${HOME} export && then $(pwd) "$@"
+		"$@" cd x=1 export grep readonly export /usr/bin -eu 2>/dev/null awk | && 'quoted text'
+"$1" then readonly -eu 2>/dev/null
+$(pwd) 'quoted text' local -eu sed export
+		echo awk test x=1 done awk printf /usr/bin printf /usr/bin done cd grep &&
+'quoted text' /usr/bin 'quoted text' ${HOME} sed 2>/dev/null grep
+	awk export "$1" x=1 then | -eu done $(pwd) then | 'quoted text' 2>/dev/null
+done 'quoted text' awk awk test --verbose && 'quoted text'
+		then --verbose --verbose $(pwd) "$1" printf | x=1 -eu printf readonly
+"$1" grep readonly | readonly awk export export x=1 && "$@" sed "$1" sed test
+		cd /usr/bin -eu /usr/bin | ${HOME} then && /usr/bin "$1" awk cd
+	local local grep then echo --verbose cd awk 2>/dev/null
+		sed echo $(pwd) /usr/bin && grep 'quoted text' "$1" awk
+cd && --verbose sed --verbose
+sed "$1" echo | done awk ${HOME} sed x=1 then grep echo grep test && printf grep
+	then grep export export -eu && x=1 local
+		echo test "$@" local /usr/bin
+		then -eu && /usr/bin then 'quoted text' printf export sed "$1" | printf cd cd
+		export --verbose readonly done "$@" 2>/dev/null "$1" done $(pwd) x=1 done done
+	${HOME} && x=1 "$@" echo done awk awk --verbose "$@" export awk
+		-eu --verbose sed ${HOME} sed test
+		$(pwd) 2>/dev/null x=1 -eu printf echo
+grep 'quoted text' cd "$@" awk sed | awk local $(pwd) readonly
+		&& 'quoted text' /usr/bin printf x=1 --verbose
+done printf done ${HOME} printf "$@" 'quoted text' && /usr/bin
+	"$1" done && export then | /usr/bin cd export then 'quoted text'
+	--verbose 2>/dev/null echo
+	2>/dev/null && --verbose x=1 -eu done printf --verbose cd 2>/dev/null cd 'quoted text'
+&& echo sed grep awk done 2>/dev/null grep $(pwd) grep grep
+	cd cd printf done done local $(pwd) echo
+		cd done export readonly echo local ${HOME} /usr/bin
+	'quoted text' sed | grep
+		done local grep cd ${HOME} export then then awk printf
+	--verbose printf -eu --verbose 'quoted text' export then x=1 "$1" echo awk awk
+		sed "$1" "$1" -eu "$@" cd $(pwd) /usr/bin ${HOME} "$@" then readonly 'quoted text'
+grep --verbose /usr/bin $(pwd) ${HOME}
+"$1" "$1" readonly "$@"
+	grep $(pwd) -eu "$1" sed done 'quoted text' && --verbose
+		echo 2>/dev/null ${HOME} --verbose done printf local echo printf x=1 && ${HOME}
+		${HOME} grep grep export /usr/bin $(pwd)
+	x=1 --verbose "$1" cd export echo
+		"$@" $(pwd) x=1 readonly local readonly readonly
+then $(pwd) "$1" test /usr/bin
+x=1 | && 'quoted text' local /usr/bin x=1
+test "$@" export then grep ${HOME}
+	export test local ${HOME} test && "$1" $(pwd)
+x=1 awk readonly ${HOME} --verbose printf -eu then grep 'quoted text' sed
+"$1" cd && sed readonly $(pwd) 2>/dev/null done local
+		&& local done done done 2>/dev/null sed ${HOME} $(pwd)
+	/usr/bin "$1" readonly
+	${HOME} "$1" local | done grep 2>/dev/null awk done echo echo | x=1 $(pwd) 'quoted text'
+	2>/dev/null 'quoted text' $(pwd) echo
+		readonly --verbose local printf
+		x=1 "$1" grep sed awk && export
+done export then $(pwd) | "$1" 'quoted text' x=1 && ${HOME} export sed grep
+		test ${HOME} x=1 readonly x=1 ${HOME} readonly local then 2>/dev/null "$@" &&
+		then | 2>/dev/null "$@" echo cd 'quoted text' done cd printf 2>/dev/null
+		export then /usr/bin local then "$1" export test "$@" cd "$1" echo grep "$1"
+		-eu sed then export | grep ${HOME} export printf cd readonly
+${HOME} && echo x=1 && 'quoted text' 'quoted text' export 2>/dev/null -eu awk
+		cd $(pwd) then export ${HOME} $(pwd) readonly
+	--verbose then sed 'quoted text'
+-eu && done "$@" && /usr/bin grep
+		&& | "$@" 'quoted text' | x=1 local sed cd 'quoted text'
+	echo 'quoted text' sed "$1" && "$1" done
+-eu grep export export export "$@" /usr/bin
+	grep printf then awk done --verbose echo local then awk test
+test "$@" /usr/bin local
+x=1 cd done "$@" then 'quoted text' printf printf
+	${HOME} /usr/bin local $(pwd) cd "$1" test x=1
+then -eu --verbose $(pwd) ${HOME} $(pwd)
+	sed readonly ${HOME} /usr/bin printf export --verbose $(pwd) | printf x=1
+	export export cd test done
+	sed 2>/dev/null export cd /usr/bin $(pwd) "$@" test
+	"$@" "$1" awk then "$@" "$1" 'quoted text' test cd awk then && "$1" echo --verbose
+		'quoted text' $(pwd) x=1 && $(pwd) local
+	-eu cd awk && 2>/dev/null --verbose -eu x=1 printf -eu sed then $(pwd) cd | local
+-eu && echo /usr/bin echo "$@" ${HOME} then --verbose x=1 readonly test
+test 2>/dev/null grep | then 'quoted text' 'quoted text' local sed --verbose ${HOME}
+	2>/dev/null /usr/bin awk x=1
+${HOME} awk -eu awk test grep 'quoted text' /usr/bin "$@" test local
+		test "$1" then readonly local readonly 2>/dev/null printf test sed
+		then --verbose then | -eu
+then "$1" "$1" /usr/bin | grep cd grep local "$@" -eu
+	${HOME} "$@" printf && "$@"
+export readonly awk /usr/bin 2>/dev/null
+		"$1" sed 2>/dev/null | local 'quoted text'
+local x=1 export sed 2>/dev/null
+	sed grep echo x=1 done grep /usr/bin /usr/bin printf && $(pwd)
+		cd ${HOME} "$1" "$1" echo
+sed --verbose done readonly x=1 grep done "$1" $(pwd) | | "$1" ${HOME}
+		echo "$1" 2>/dev/null "$@"
+		/usr/bin "$1" $(pwd) printf /usr/bin local "$@" grep echo
+	| --verbose local grep local then sed printf ${HOME} readonly printf 'quoted text'
+	test cd test echo "$1" --verbose done "$@" "$@" echo 2>/dev/null
+"$1" then 'quoted text' 2>/dev/null
+	awk readonly echo test "$1" "$1" export 2>/dev/null grep 'quoted text' x=1 &&
+	then grep awk grep test
+$(pwd) 'quoted text' sed | && x=1 "$@" /usr/bin sed "$@"
+local 2>/dev/null ${HOME} test awk 2>/dev/null x=1 sed readonly | awk
+&& cd $(pwd) x=1 local x=1 readonly $(pwd) | awk -eu sed $(pwd)
+2>/dev/null --verbose local then readonly 'quoted text' /usr/bin
+		| cd -eu printf grep $(pwd) cd awk x=1
+"$@" done x=1 grep done --verbose echo 2>/dev/null readonly
+	cd test awk ${HOME} then sed local && 'quoted text' --verbose
+		| ${HOME} echo readonly ${HOME}
+		$(pwd) $(pwd) awk printf -eu ${HOME} && readonly && "$1" grep "$1" $(pwd) /usr/bin
+		awk | export -eu /usr/bin x=1
+x=1 grep test ${HOME} | -eu 2>/dev/null | local printf
+	$(pwd) done "$1" printf awk test && /usr/bin
+then -eu /usr/bin /usr/bin "$1" awk then grep --verbose && 'quoted text'
+	then 'quoted text' awk --verbose awk 'quoted text' awk | cd awk /usr/bin /usr/bin
+		done cd && | "$@" --verbose
+		-eu x=1 echo local 'quoted text'
+	echo $(pwd) /usr/bin -eu && cd cd local done 'quoted text' printf
+		cd local grep test echo echo 'quoted text'
+	sed echo ${HOME} && readonly readonly
+/usr/bin awk cd --verbose then test grep printf sed && && local then grep
+$(pwd) -eu "$@" "$@" export | local /usr/bin && --verbose 'quoted text' grep
+'quoted text' ${HOME} local && awk test awk | "$1" grep
+	test ${HOME} 'quoted text' done
+2>/dev/null sed printf awk export | local ${HOME} 'quoted text' x=1 "$1"
+	sed printf -eu ${HOME}
+local 'quoted text' cd -eu export printf 'quoted text' done grep printf done done
+		$(pwd) | --verbose grep test readonly export
+		2>/dev/null ${HOME} ${HOME} sed readonly printf grep awk 2>/dev/null $(pwd)
+		readonly $(pwd) "$1" printf test 'quoted text'
+then "$@" export && x=1 grep
+		x=1 export readonly awk awk printf --verbose $(pwd) -eu
+sed x=1 --verbose ${HOME} $(pwd) $(pwd) ${HOME} cd "$1" $(pwd) awk sed /usr/bin
+	echo printf echo grep printf 2>/dev/null echo "$@" /usr/bin
+printf test echo echo cd export x=1
+	$(pwd) x=1 && echo 'quoted text' local
+		cd done echo grep readonly cd then --verbose --verbose printf
+		sed sed awk export "$@" x=1 cd -eu test test
+2>/dev/null cd --verbose printf && sed && cd then
+	x=1 readonly -eu "$@" | 2>/dev/null /usr/bin 2>/dev/null $(pwd)
+readonly echo test x=1 export --verbose $(pwd) readonly x=1
+-eu && 2>/dev/null export "$1" sed then
+	grep done 2>/dev/null
+	sed test sed $(pwd) sed && done -eu 2>/dev/null
+	${HOME} cd cd done done printf
+		&& $(pwd) test "$1" done "$1" $(pwd) cd sed test -eu awk then
+		readonly awk $(pwd) local awk /usr/bin /usr/bin
+cd sed awk 'quoted text'
+		$(pwd) sed --verbose x=1 then then | 2>/dev/null echo awk x=1 /usr/bin export
+local "$1" -eu test ${HOME} | x=1 printf
+	awk x=1 awk -eu 2>/dev/null sed
+		local 'quoted text' readonly "$1" sed export export local
+		"$1" -eu $(pwd) 2>/dev/null ${HOME} local then grep done echo /usr/bin
+		local --verbose local done "$1" x=1 awk echo /usr/bin && awk ${HOME} sed $(pwd)
+	echo ${HOME} "$1" -eu local readonly echo $(pwd) awk echo
+	sed printf x=1 /usr/bin "$@"
+	awk readonly test ${HOME} echo test cd --verbose local echo echo done readonly "$1"
+		2>/dev/null export 2>/dev/null && readonly
+--verbose echo --verbose 2>/dev/null "$1" printf &&
+	'quoted text' test local "$1" export | -eu 'quoted text' --verbose
+		| "$1" sed /usr/bin 'quoted text' local -eu local export
+local cd && 'quoted text' sed echo "$@" "$1" &&
+${HOME} local readonly test test 'quoted text' printf then
+readonly test echo /usr/bin 2>/dev/null printf done
+		grep /usr/bin grep awk printf
+		awk then $(pwd) awk awk "$@" -eu test x=1 'quoted text' | test sed awk printf
+		awk --verbose $(pwd) "$@" export x=1
+-eu export export -eu $(pwd) printf awk printf readonly
+	"$@" echo grep local "$1" 2>/dev/null 2>/dev/null printf
+	grep grep 'quoted text' export "$1" awk /usr/bin 'quoted text' "$1"
+		x=1 then local "$1" $(pwd) grep "$@" x=1 grep grep ${HOME}
+	--verbose "$@" $(pwd) grep
+	${HOME} printf cd --verbose echo printf | | && --verbose $(pwd)
+		-eu local test | /usr/bin
+		then --verbose export "$@" && && "$@" cd --verbose /usr/bin
+test -eu readonly echo ${HOME}
+		local then awk -eu done awk export | -eu "$1"
+		readonly local 2>/dev/null sed echo --verbose $(pwd) |
+-eu local echo x=1 /usr/bin
+	2>/dev/null --verbose readonly local readonly $(pwd)
+| local ${HOME} cd ${HOME} grep ${HOME} local printf 'quoted text'
+2>/dev/null cd "$1" 'quoted text' 2>/dev/null "$1" printf 2>/dev/null 2>/dev/null
+	&& -eu && awk local cd echo
+done && $(pwd) test /usr/bin $(pwd) 2>/dev/null test
+	test 'quoted text' echo ${HOME} /usr/bin
+	| echo 'quoted text' "$1" | export 'quoted text' 'quoted text'
+$(pwd) awk done done then test readonly "$1" ${HOME} local sed x=1
+-eu -eu done printf local sed export
+done test | && cd awk
+		awk /usr/bin ${HOME} 2>/dev/null export | done awk "$1"
+		'quoted text' readonly then then
+x=1 cd readonly && cd test local awk -eu local grep
+	"$@" grep --verbose cd /usr/bin x=1 done then --verbose readonly
+		local echo $(pwd) local
+		${HOME} x=1 echo then
+		-eu then cd then -eu /usr/bin --verbose | sed "$1"
+	local readonly $(pwd) sed export "$1" done $(pwd) grep cd && 'quoted text'
+	export awk grep ${HOME} 'quoted text' "$1" sed grep --verbose $(pwd)
+	${HOME} export grep echo local printf
+awk printf then local local ${HOME}
+"$@" printf 'quoted text' 2>/dev/null --verbose printf awk x=1 "$@" 'quoted text'
+grep "$1" /usr/bin x=1 2>/dev/null "$@" awk printf ${HOME} awk | test printf
+--verbose 'quoted text' readonly x=1 printf 'quoted text' awk readonly /usr/bin
+	awk grep "$@" && export && awk x=1 sed && /usr/bin -eu 2>/dev/null
+	awk --verbose ${HOME}
+		${HOME} --verbose $(pwd) "$1" export && "$1" cd test echo done
+local test x=1 /usr/bin grep --verbose export export sed echo
+	"$@" sed cd $(pwd) readonly 'quoted text' "$@"
+	export export awk grep ${HOME} readonly
+--verbose --verbose awk readonly then test sed test cd | | then export export
+		2>/dev/null sed x=1 grep 'quoted text' && done 2>/dev/null "$@"
+	x=1 sed /usr/bin --verbose then
+--verbose && ${HOME} local cd test export && "$1" awk | test ${HOME} "$1"
+then 'quoted text' | readonly 2>/dev/null --verbose
+"$@" printf export -eu local x=1 "$1" /usr/bin local ${HOME} cd test x=1 $(pwd)
+		printf ${HOME} 'quoted text' cd done readonly sed cd x=1 readonly /usr/bin
+		readonly "$@" test x=1 /usr/bin -eu 'quoted text'
+	"$@" cd x=1 'quoted text' | awk readonly
+	echo readonly printf ${HOME} | test then
+		sed /usr/bin grep readonly done then done x=1 awk
+| -eu readonly x=1 echo then | printf "$1"
+	"$1" /usr/bin | then export awk local
+		test --verbose ${HOME} test cd awk --verbose then ${HOME}
+		x=1 "$1" echo done cd sed ${HOME} echo | 2>/dev/null printf local $(pwd) x=1
+echo awk grep printf | --verbose
+test x=1 "$@" done x=1 "$@" local
+-eu echo ${HOME} export grep test -eu done
+$(pwd) x=1 readonly -eu awk -eu | sed sed done 'quoted text' "$1"
+	export local "$1" cd --verbose --verbose "$1" awk awk done x=1 test echo
+local --verbose x=1 test readonly "$@" then local 2>/dev/null 'quoted text'
+		printf sed "$@" local && printf | "$1" done echo export "$@" test x=1 $(pwd) export
+		'quoted text' /usr/bin grep done cd x=1 then /usr/bin
+	-eu local done 2>/dev/null /usr/bin
+test && $(pwd) | "$@" --verbose x=1
+	&& local --verbose && awk cd --verbose 2>/dev/null /usr/bin ${HOME}
+		${HOME} then 2>/dev/null sed x=1 -eu test export 2>/dev/null 'quoted text' done
+awk export awk x=1 "$@" export 2>/dev/null
+		2>/dev/null x=1 cd cd export "$1" /usr/bin
+echo | export /usr/bin -eu
+	| -eu cd grep 2>/dev/null /usr/bin printf local -eu done
+		-eu 2>/dev/null grep printf export $(pwd) $(pwd) 'quoted text'
+	local --verbose 'quoted text' grep printf awk awk local "$1" export --verbose
+		${HOME} then then -eu | sed ${HOME} awk && echo 'quoted text'
+export local done cd grep
+"$1" "$1" -eu 'quoted text' x=1 "$@" 2>/dev/null echo "$@" "$1" local then
+	test echo test cd cd "$1" "$1" local awk -eu /usr/bin $(pwd)
+readonly --verbose 'quoted text'
+	&& "$@" -eu $(pwd) local cd /usr/bin echo "$@" echo printf readonly
+	| local "$@" | 'quoted text' test grep
+		x=1 | --verbose "$1" && | "$1" ${HOME} $(pwd) --verbose export local
+		sed printf test && 'quoted text' awk printf x=1
+	readonly readonly export 2>/dev/null
+	'quoted text' $(pwd) ${HOME} grep cd
+		2>/dev/null awk x=1 -eu echo /usr/bin grep --verbose x=1 done echo /usr/bin then
+test | "$1" ${HOME} 'quoted text' 2>/dev/null sed 2>/dev/null
+	| $(pwd) | then -eu "$1" "$@" && test
+		${HOME} "$1" test ${HOME} 2>/dev/null
+		$(pwd) "$1" --verbose grep test readonly --verbose 2>/dev/null &&
+$(pwd) test 2>/dev/null && | | export awk export
+grep -eu printf --verbose printf done printf
+done sed ${HOME} -eu $(pwd) printf echo | 2>/dev/null then
+cd test grep -eu local "$1" && | local ${HOME} /usr/bin -eu
+		--verbose "$1" printf "$@" $(pwd) x=1 readonly
+	grep 2>/dev/null 'quoted text' "$@" x=1 ${HOME} ${HOME} awk grep
+x=1 printf x=1 --verbose sed then test printf "$@" sed x=1
+	cd awk done grep 2>/dev/null
+	2>/dev/null 'quoted text'
+	$(pwd) then x=1 then $(pwd) x=1 x=1 | printf && /usr/bin | ${HOME} --verbose
+	local 2>/dev/null export x=1 2>/dev/null
+		x=1 -eu $(pwd) local /usr/bin readonly printf grep printf cd --verbose
+		| test && readonly -eu && --verbose --verbose local
+		"$@" sed done done sed test "$@" && x=1 -eu cd $(pwd) awk echo
+${HOME} $(pwd) | x=1 awk $(pwd)
+printf readonly done | done --verbose ${HOME} test awk -eu grep 2>/dev/null
+printf readonly sed cd
+	| cd then x=1 cd && 2>/dev/null
+	${HOME} printf "$@" sed && "$1" done 'quoted text' export 2>/dev/null then --verbose
+--verbose /usr/bin "$@" 'quoted text' export -eu ${HOME} awk
+		awk printf test | echo local echo sed 2>/dev/null /usr/bin done | 'quoted text'
+		test awk grep echo && export && printf /usr/bin
+	done "$@" 'quoted text' /usr/bin printf x=1 | 'quoted text' 'quoted text'
+test awk cd /usr/bin then 'quoted text' echo
+${HOME} x=1 2>/dev/null
+		echo cd sed 'quoted text'
+done && then x=1 done /usr/bin export /usr/bin ${HOME} "$@"
+		-eu ${HOME} grep printf /usr/bin grep x=1 2>/dev/null x=1
+		-eu -eu awk export local x=1 test echo sed export "$@" done
+	-eu awk 'quoted text' readonly && --verbose
+	| "$1" grep export 2>/dev/null
+readonly "$@" local grep local then x=1 grep
+		/usr/bin cd then awk "$1" 'quoted text'
+-eu then then printf readonly 2>/dev/null awk /usr/bin x=1 --verbose $(pwd) |
+		"$1" 2>/dev/null --verbose && $(pwd) then | then done then $(pwd) ${HOME}
+		| | && awk readonly $(pwd) done x=1 echo local sed ${HOME} test
+	readonly sed echo awk | $(pwd) ${HOME} export -eu
+"$1" then && grep ${HOME} x=1 -eu --verbose x=1 'quoted text'
+sed -eu "$1" $(pwd) readonly awk echo x=1 'quoted text' &&
+$(pwd) && readonly 2>/dev/null --verbose -eu "$1"
+		"$1" ${HOME} $(pwd) "$1"
+	sed printf "$1" export -eu 'quoted text' | then awk test "$@" --verbose grep
+	--verbose x=1 cd done ${HOME} x=1 /usr/bin /usr/bin sed | && &&
+"$@" local x=1 "$@" 2>/dev/null echo "$1" then | ${HOME} printf 2>/dev/null printf
+		2>/dev/null $(pwd) --verbose $(pwd)
+		/usr/bin printf awk readonly 'quoted text' done -eu | awk /usr/bin grep /usr/bin
+		"$1" echo readonly --verbose awk sed
+		${HOME} 2>/dev/null local /usr/bin export x=1 readonly 'quoted text' &&
+		| /usr/bin 'quoted text' ${HOME} sed readonly readonly -eu "$@" export
+		export ${HOME} && then $(pwd)
+	printf x=1 -eu /usr/bin && 2>/dev/null
+printf printf "$@" -eu
+$(pwd) "$@" printf echo echo done ${HOME} -eu "$@" --verbose
+		then then cd /usr/bin echo x=1 readonly then then ${HOME} printf readonly
+		echo printf sed echo ${HOME} then printf
+	sed awk | -eu $(pwd) export awk
+| "$1" cd -eu $(pwd) 'quoted text' readonly
+		2>/dev/null $(pwd) export
+		&& done echo readonly 2>/dev/null echo
+		local 2>/dev/null sed local -eu awk /usr/bin
+		done sed cd "$1" local printf | printf awk
+	grep "$@" --verbose /usr/bin printf /usr/bin done | "$1" awk done done
+export $(pwd) ${HOME}
+$(pwd) $(pwd) $(pwd) /usr/bin grep cd done "$1" done
+grep 2>/dev/null && done local | sed grep sed 'quoted text'
+		printf readonly test 'quoted text' grep sed readonly 2>/dev/null grep then awk ${HOME}
+		test $(pwd) local printf test export sed
+| 2>/dev/null -eu local then sed x=1 && done
+$(pwd) test then readonly echo && x=1 local /usr/bin readonly --verbose
+	grep "$1" awk && readonly
+local x=1 printf echo cd /usr/bin export "$@" export /usr/bin
+	awk ${HOME} then -eu readonly sed 2>/dev/null $(pwd) printf | done
+test "$1" awk local | x=1 export test "$1" "$1" && $(pwd) sed /usr/bin
+awk -eu $(pwd) ${HOME} awk "$@" cd ${HOME} ${HOME} grep done /usr/bin ${HOME}
+"$1" 'quoted text' done --verbose sed test | ${HOME} x=1 "$1" /usr/bin
+	printf --verbose && export $(pwd) $(pwd) 2>/dev/null awk cd
+	2>/dev/null | printf "$1" "$@"
+	done | test cd 2>/dev/null readonly grep 'quoted text'
+		sed export x=1 --verbose 'quoted text'
+&& -eu "$1" 'quoted text' &&
+		printf 'quoted text' export "$@" test x=1 $(pwd) then echo cd 2>/dev/null
+| awk 2>/dev/null "$@" /usr/bin local grep
+		local | printf awk x=1 ${HOME} then awk cd local
+	readonly -eu $(pwd) cd 2>/dev/null test 2>/dev/null "$@" sed then printf sed
+	${HOME} then "$1" -eu local grep ${HOME} cd --verbose --verbose
+		x=1 x=1 echo test 2>/dev/null
+printf x=1 --verbose 'quoted text' ${HOME} | "$@" 2>/dev/null /usr/bin
+sed sed "$1" local test test /usr/bin && --verbose "$@" test -eu done
+${HOME} ${HOME} awk readonly then readonly
+		/usr/bin local export 'quoted text' export echo test | && x=1
+		printf "$1" 'quoted text' readonly --verbose
+	-eu sed && test sed printf 2>/dev/null
+$(pwd) "$1" --verbose sed -eu test readonly then /usr/bin cd test 'quoted text'
+sed printf cd cd --verbose
+		done $(pwd) echo done --verbose --verbose
+		/usr/bin sed readonly "$@" -eu -eu test sed sed done grep then /usr/bin
+	2>/dev/null echo awk cd $(pwd) readonly | "$@" -eu "$@" awk cd x=1
+test $(pwd) 'quoted text'
+	export -eu ${HOME} ${HOME} printf then 'quoted text'
+	done 'quoted text' sed echo 'quoted text' --verbose awk export "$1"
+		then x=1 grep | "$@" && x=1 --verbose local 'quoted text' local
+sed grep --verbose export readonly -eu ${HOME} then && x=1 /usr/bin export 2>/dev/null
+		"$1" $(pwd) 'quoted text' "$1" "$@" -eu "$@" 2>/dev/null sed | awk sed
+		/usr/bin sed readonly
+		2>/dev/null grep -eu printf ${HOME} 2>/dev/null
+		"$1" export done cd echo
+		--verbose local printf 'quoted text' /usr/bin
+sed awk | sed /usr/bin grep readonly then ${HOME} export --verbose
+	done "$@" test sed awk ${HOME} sed "$@" echo grep
+${HOME} printf $(pwd) awk 'quoted text'
+		$(pwd) local ${HOME} "$@" "$@" "$@" then ${HOME} && then sed
+		export echo --verbose $(pwd)
+		-eu 'quoted text' && && grep "$@" && && then then done | awk printf
+		$(pwd) --verbose 'quoted text' grep printf | --verbose
+awk $(pwd) done readonly
+		'quoted text' printf awk printf "$1" readonly $(pwd) "$@" cd readonly
+		-eu done | | sed --verbose -eu --verbose
+	2>/dev/null cd done --verbose done /usr/bin |
+		-eu && --verbose "$@" "$@" printf test grep readonly ${HOME} grep
+awk 2>/dev/null -eu | sed "$1" 'quoted text'
+readonly grep --verbose done ${HOME} readonly $(pwd)
+		2>/dev/null test grep done
+	"$@" awk cd local | sed &&
+		export ${HOME} awk grep "$@" then printf sed test then && grep local
+		test test "$@" grep /usr/bin
+	&& $(pwd) cd then readonly &&
+	&& grep cd sed awk awk local x=1 "$@" test --verbose awk
+/usr/bin $(pwd) local export /usr/bin --verbose $(pwd) && then "$@" && done ${HOME}
+&& && -eu && ${HOME} 'quoted text' --verbose
+echo cd && grep $(pwd) then "$1" --verbose
+	grep x=1 ${HOME} sed && 2>/dev/null ${HOME} echo sed
+	grep "$1" awk local && | readonly export "$@" ${HOME} "$1" grep done && ${HOME}
+	--verbose printf "$1" test sed --verbose sed awk --verbose readonly printf
+		x=1 | $(pwd) "$@" --verbose x=1 export | --verbose echo echo then local | readonly
+	export printf "$1" sed readonly --verbose local then grep 2>/dev/null local cd
+	sed then x=1 "$1" printf
+	readonly 'quoted text' 2>/dev/null 'quoted text'
+	x=1 | 2>/dev/null sed -eu x=1 'quoted text' && test export
+	| export /usr/bin readonly 2>/dev/null --verbose local readonly cd x=1 readonly
+	local cd awk ${HOME} x=1 $(pwd)
+${HOME} printf export x=1 --verbose local local -eu 2>/dev/null
+	done "$1" awk cd /usr/bin printf "$1" test echo
+	cd /usr/bin | local grep then printf "$@" readonly
+echo "$@" --verbose export -eu $(pwd) printf ${HOME} x=1
+		| 2>/dev/null test awk --verbose x=1 "$@" then sed done "$1" cd grep | done 2>/dev/null
+	echo 'quoted text' cd 2>/dev/null sed "$@" "$1" 'quoted text' local readonly
+	printf ${HOME} done 'quoted text'
+readonly readonly grep cd printf $(pwd) "$1" cd
+	&& awk readonly /usr/bin echo -eu /usr/bin /usr/bin 2>/dev/null --verbose "$@"
+		x=1 && done && --verbose local done grep sed done test sed awk -eu
+		${HOME} export "$@" readonly | sed sed sed ${HOME} echo cd | && done $(pwd)
+		| grep export ${HOME} sed awk -eu "$1" printf done && grep readonly
+${HOME} && x=1 "$1" -eu printf --verbose /usr/bin local echo
+	2>/dev/null "$@" "$@" && grep test awk
+	sed 'quoted text' then cd && -eu then then | echo --verbose && -eu
+		| then export "$@" then sed &&
+		cd -eu ${HOME} done readonly $(pwd) echo "$1" 2>/dev/null
+		echo printf grep local 2>/dev/null
+		grep export sed x=1 "$@" $(pwd)
+	-eu | then $(pwd) --verbose ${HOME} x=1 x=1
+		/usr/bin test 2>/dev/null | --verbose --verbose -eu "$1"
+	local printf printf printf -eu 'quoted text'
+		2>/dev/null --verbose 2>/dev/null -eu "$1" $(pwd) --verbose
+${HOME} readonly awk | --verbose sed grep test test awk echo test --verbose 2>/dev/null
+/usr/bin ${HOME} $(pwd) 'quoted text' 'quoted text' --verbose /usr/bin
+readonly sed echo printf | "$1" awk "$1" 'quoted text' $(pwd) cd export | printf
+		| grep x=1 2>/dev/null awk export grep 2>/dev/null echo
+	test test printf x=1 awk -eu ${HOME} -eu 'quoted text'
+		awk test readonly 2>/dev/null local /usr/bin readonly test then -eu ${HOME}
+	local printf then sed "$1" then "$1"
+	done ${HOME} local cd | /usr/bin "$@" ${HOME} local
+		'quoted text' ${HOME} local grep local "$@" 2>/dev/null done
+	readonly ${HOME} printf awk grep
+		local done done x=1 --verbose 'quoted text'
+		/usr/bin cd test x=1 2>/dev/null 'quoted text'
+	${HOME} printf grep test /usr/bin test "$1" x=1 ${HOME} awk
+		grep -eu awk sed && printf test done done test $(pwd) ${HOME} --verbose export
+		sed x=1 readonly printf ${HOME} ${HOME} ${HOME} --verbose
+	grep && "$@" awk awk && -eu grep $(pwd) grep readonly test --verbose -eu
+	-eu awk export 'quoted text' echo readonly export echo
+	awk /usr/bin cd 'quoted text' "$@" cd grep local printf cd then
+	"$1" "$@" "$1" ${HOME} export local readonly
+'quoted text' ${HOME} | 'quoted text'
+| && -eu "$@" $(pwd) ${HOME} && $(pwd) $(pwd) -eu then export printf --verbose
+		--verbose $(pwd) test --verbose done "$@"
+		readonly "$1" --verbose --verbose x=1
+then 'quoted text' test ${HOME}
+'quoted text' "$1" printf $(pwd) export grep local
+		| local test then | readonly
+test then test && 'quoted text' 'quoted text' echo test sed printf
+	sed then export local /usr/bin printf "$@" then done printf
+cd export grep sed then test echo echo echo grep --verbose awk then 'quoted text'
+		sed 'quoted text' echo printf test /usr/bin &&
+		local | 'quoted text' test cd sed "$1" | cd "$@" printf sed /usr/bin sed 2>/dev/null
+		${HOME} printf echo --verbose local -eu grep --verbose
+		echo readonly "$@" "$1" -eu --verbose "$1" | ${HOME} x=1 readonly /usr/bin
+	'quoted text' 2>/dev/null /usr/bin 2>/dev/null grep 2>/dev/null
+	${HOME} done test printf readonly
+		${HOME} printf awk "$@" x=1 --verbose
+		test 'quoted text' -eu cd &&
+		done /usr/bin awk 2>/dev/null | 'quoted text' local cd done sed grep && "$1" cd
+printf printf "$1" test cd "$1" --verbose done && /usr/bin local
+		local /usr/bin grep readonly
+		done sed sed sed then sed "$1" /usr/bin done 2>/dev/null grep "$@" && ${HOME} awk
+local | x=1 cd "$1" local cd --verbose test grep | grep
+		readonly x=1 x=1 ${HOME} export done --verbose && echo cd && printf
+'quoted text' -eu ${HOME} grep x=1 readonly
+printf grep cd --verbose
+		sed then grep /usr/bin then 'quoted text'
+		test -eu readonly "$@" x=1 2>/dev/null test "$@" /usr/bin && echo ${HOME} sed
+		--verbose | /usr/bin grep local x=1 then export
+		"$1" sed "$1" ${HOME} $(pwd) "$@" -eu grep $(pwd) local test x=1 | sed
+		${HOME} echo local local sed 'quoted text'
+		/usr/bin && 'quoted text' x=1 sed "$1" readonly readonly 'quoted text'
+	-eu readonly grep /usr/bin | "$@" x=1 | test
+x=1 /usr/bin x=1 test
+grep "$1" --verbose && x=1 2>/dev/null test readonly
+		${HOME} "$@" /usr/bin
+		'quoted text' -eu && done x=1 sed | | export --verbose local "$@" $(pwd)
+		sed "$1" && /usr/bin grep x=1 ${HOME} "$@" x=1 grep export -eu then then x=1
+"$1" export "$1" echo export echo "$@" cd local --verbose /usr/bin
+export ${HOME} local readonly echo test | "$@" && | x=1 $(pwd) $(pwd)
+		| "$1" test $(pwd) "$1" $(pwd)
+done local --verbose $(pwd) grep 2>/dev/null
+&& done 'quoted text' 2>/dev/null cd -eu
+	-eu printf readonly ${HOME} done "$@" /usr/bin 2>/dev/null printf then
+	cd "$@" ${HOME} then test cd --verbose
+	'quoted text' 'quoted text' "$@" $(pwd) $(pwd) echo
+		printf -eu export x=1 printf
+		then && && 2>/dev/null cd x=1 /usr/bin
+	$(pwd) test echo 2>/dev/null cd export && | --verbose echo printf readonly 'quoted text'
+done x=1 -eu $(pwd) "$@" $(pwd) echo then "$@" --verbose
+		--verbose grep 'quoted text' awk
+		then 'quoted text' test x=1 then echo /usr/bin local echo
+	awk "$1" printf cd && /usr/bin && done done sed -eu
+	'quoted text' grep --verbose cd then ${HOME} 'quoted text'
+	'quoted text' grep readonly $(pwd) cd /usr/bin 'quoted text' 'quoted text'
+		x=1 done --verbose export readonly local printf 'quoted text'
+		echo done echo echo awk 2>/dev/null local "$1" ${HOME} done ${HOME} &&
+	sed && 2>/dev/null --verbose awk --verbose x=1 "$@" 2>/dev/null
+	/usr/bin x=1 --verbose
+readonly export "$1" then | then "$1" --verbose x=1 grep --verbose
+	awk 2>/dev/null export && sed
+test done then then sed local export /usr/bin
+	local 'quoted text' -eu printf $(pwd) "$1" --verbose
+	export export test ${HOME} ${HOME}
+local "$1" x=1 awk "$1" then -eu then && 2>/dev/null
+	echo && awk 2>/dev/null && $(pwd) 2>/dev/null | sed sed local printf
+export readonly readonly 2>/dev/null
+	"$@" readonly 'quoted text' sed --verbose cd local /usr/bin -eu readonly sed
+	sed export "$1" /usr/bin export "$1" 2>/dev/null readonly local 2>/dev/null
+"$@" "$1" printf --verbose done readonly then awk sed local
+awk awk 2>/dev/null printf export /usr/bin test grep
+		&& awk done test && echo x=1 done local echo then
+		done printf readonly printf grep ${HOME} awk 'quoted text'
+done /usr/bin test ${HOME} x=1 | test ${HOME} readonly then done $(pwd) | then
+		&& -eu grep --verbose local $(pwd)
+test export /usr/bin "$1" | sed x=1 | local
+	local 'quoted text' | "$1" | local echo cd && -eu test -eu
+	-eu test cd echo && echo cd done 2>/dev/null test readonly
+	/usr/bin cd $(pwd) "$1" x=1 readonly export printf
+	"$1" /usr/bin cd x=1 export awk --verbose -eu x=1 sed ${HOME}
+		&& "$1" $(pwd) sed --verbose -eu "$1" export "$1" x=1 /usr/bin
+&& && echo /usr/bin |
+		echo /usr/bin printf -eu x=1 --verbose awk
+	test 2>/dev/null "$1" readonly 2>/dev/null test sed sed $(pwd) awk 2>/dev/null
+		readonly readonly echo /usr/bin local -eu "$@" local | "$@" export local 'quoted text'
+		| readonly "$@" readonly && && /usr/bin "$1" ${HOME} x=1 | sed then done
+	done grep 2>/dev/null cd then ${HOME} awk readonly echo awk | 'quoted text'
+	awk 2>/dev/null echo test sed "$@" && 'quoted text' "$@" done
+	$(pwd) "$@" && sed && 'quoted text' sed grep --verbose sed sed | local
+cd export local done echo $(pwd) $(pwd) then
+2>/dev/null -eu x=1 then x=1 | 'quoted text'
+		sed done export sed readonly /usr/bin cd
+		2>/dev/null export readonly "$1" then grep 'quoted text' grep grep readonly
+/usr/bin printf readonly -eu printf | x=1 sed
+readonly printf done 'quoted text' $(pwd) echo -eu
+	local 'quoted text' then
+&& cd grep "$@" /usr/bin "$@" done awk
+x=1 grep echo x=1 'quoted text'
+-eu echo local printf local sed x=1 && then ${HOME}
+		"$1" $(pwd) --verbose -eu
+	local $(pwd) x=1 local printf export local ${HOME} x=1 x=1 local
+	export "$@" readonly "$1" | printf
+		--verbose | local sed test readonly --verbose test
+	"$@" printf awk cd done
+cd readonly grep grep done awk readonly $(pwd) | readonly 2>/dev/null
+		2>/dev/null test && echo
+then $(pwd) then test sed $(pwd) grep "$1" 'quoted text' echo --verbose
+"$@" readonly cd | /usr/bin done test local
+		| | then cd then | 2>/dev/null /usr/bin readonly 2>/dev/null /usr/bin
+		test sed | echo --verbose -eu ${HOME} export local --verbose /usr/bin
+		readonly export 'quoted text' export $(pwd) ${HOME}
+local $(pwd) test | cd --verbose awk then ${HOME} $(pwd) then printf
+		'quoted text' 2>/dev/null done export printf --verbose printf "$1" $(pwd)
+		export ${HOME} -eu cd $(pwd) sed $(pwd) "$1"
+		--verbose 2>/dev/null test grep x=1 then export $(pwd) 'quoted text'
+-eu "$1" --verbose --verbose | ${HOME}
+done | 'quoted text' grep $(pwd) done awk cd $(pwd) 'quoted text'
+2>/dev/null | printf && local ${HOME}
+		/usr/bin then -eu then printf test 2>/dev/null done readonly -eu sed echo
+"$@" -eu x=1 "$1" echo sed
+		sed local echo cd awk -eu /usr/bin sed export export ${HOME}
+		grep x=1 done x=1 | 2>/dev/null
+		'quoted text' 2>/dev/null grep $(pwd) | local test sed local --verbose awk
+	-eu x=1 $(pwd) $(pwd) -eu -eu cd awk "$@" grep -eu --verbose
+		| /usr/bin then 'quoted text' then done printf
+	done export --verbose grep export "$1" $(pwd) test awk && export printf
+	-eu readonly awk sed | local "$@" --verbose 2>/dev/null local
+	/usr/bin "$@" x=1 "$1" --verbose
+		readonly done /usr/bin local && ${HOME} grep "$@" done --verbose
+	"$@" local "$@" local "$@" printf export
+readonly echo && readonly ${HOME} 2>/dev/null echo
+	2>/dev/null -eu x=1 then "$@" then done printf /usr/bin
+		awk /usr/bin local $(pwd) ${HOME} ${HOME} export readonly test --verbose x=1 ${HOME}
+	echo --verbose ${HOME} 'quoted text' $(pwd) ${HOME} 2>/dev/null -eu test -eu /usr/bin
+-eu test done "$@" test printf "$1" echo sed readonly --verbose ${HOME}
+	"$1" && export test 2>/dev/null
+readonly export $(pwd) cd sed /usr/bin 2>/dev/null sed
+	"$@" export sed printf "$1" | then sed --verbose | 'quoted text'
+	2>/dev/null ${HOME} 'quoted text'
+		-eu export $(pwd) /usr/bin ${HOME} && /usr/bin grep test cd sed then test
+		"$1" $(pwd) && printf -eu /usr/bin
+	'quoted text' local test 'quoted text'
+export --verbose /usr/bin
+then then sed $(pwd) then printf awk 2>/dev/null
+	-eu 'quoted text' ${HOME} /usr/bin
+	test 'quoted text' local grep ${HOME} grep
+		"$1" /usr/bin local $(pwd)
+		readonly "$@" awk test 2>/dev/null awk export --verbose test
+printf cd ${HOME} $(pwd) "$@" $(pwd) then local readonly awk "$1"
+		'quoted text' local sed $(pwd)
+		awk && $(pwd) -eu printf "$1" echo export x=1 done readonly
+--verbose $(pwd) --verbose test "$@" local /usr/bin && -eu then printf x=1 echo
+	awk echo /usr/bin echo awk sed $(pwd) && cd ${HOME} then cd done && local
+		local printf | printf $(pwd) echo && && then export readonly 'quoted text'
+local echo export ${HOME} 2>/dev/null
+		$(pwd) sed /usr/bin local 'quoted text' then x=1 && test done
+readonly echo then printf export -eu local x=1 --verbose |
+	local "$1" cd done readonly | "$1" --verbose
+$(pwd) "$@" export --verbose done test done awk sed test awk "$1" $(pwd) cd $(pwd)
+	export 2>/dev/null local echo grep awk ${HOME}
+		x=1 awk --verbose echo readonly
+	local -eu sed then local awk && test readonly $(pwd) sed 'quoted text'
+sed then grep local -eu
+echo grep "$@" then export grep x=1
+x=1 then done done "$1" /usr/bin $(pwd) sed && then 2>/dev/null ${HOME} readonly
+	grep 2>/dev/null readonly local then
+	cd test && $(pwd) -eu
+-eu test -eu awk test then $(pwd) export --verbose x=1 "$1" awk $(pwd) grep cd
+	sed cd --verbose test /usr/bin
+		local $(pwd) x=1 | cd grep ${HOME} local export test | $(pwd) --verbose
+	"$@" local && then grep
+-eu echo x=1 | sed done "$@" 2>/dev/null 'quoted text'
+x=1 done done readonly readonly x=1 -eu awk 'quoted text'
+	local "$@" test grep readonly
+&& cd sed then done 'quoted text'
+	$(pwd) 'quoted text' readonly 'quoted text'
+		"$1" 2>/dev/null "$1" /usr/bin test 2>/dev/null
+		printf $(pwd) "$@" sed grep 'quoted text'
+export /usr/bin 2>/dev/null 2>/dev/null /usr/bin sed --verbose awk
+		x=1 x=1 grep sed cd ${HOME} /usr/bin test
+test local x=1 cd x=1 | --verbose done --verbose -eu local "$@" echo | done $(pwd)
+		sed "$1" then sed then
+	-eu 2>/dev/null 2>/dev/null sed local $(pwd) 'quoted text'
+	awk awk ${HOME} --verbose local printf 2>/dev/null echo test
+		grep $(pwd) | test --verbose /usr/bin
+	2>/dev/null awk cd /usr/bin | test | x=1 then && x=1 ${HOME} --verbose x=1
+		cd grep | sed $(pwd) local && sed ${HOME} 'quoted text' ${HOME} -eu
+'quoted text' printf done then test
+	"$@" 'quoted text' | test
+		readonly then export &&
+	'quoted text' sed x=1 readonly "$1" 'quoted text'
+		done 2>/dev/null "$1" test test "$@" && grep echo x=1 sed ${HOME} 2>/dev/null
+		$(pwd) export 'quoted text' export local cd /usr/bin |
+	-eu "$@" "$@" x=1 echo 'quoted text' "$1" "$@" test readonly 'quoted text'
+		grep sed "$1" /usr/bin test printf then sed test grep sed
+		&& sed | done "$@" "$1" $(pwd) /usr/bin readonly ${HOME} cd then grep
+	local test "$1" 2>/dev/null export $(pwd) "$@"
+		readonly cd | readonly sed ${HOME} echo ${HOME} -eu 2>/dev/null
+	cd sed cd done && x=1 then sed export sed sed --verbose
+		awk grep /usr/bin "$1" 2>/dev/null done
+	x=1 local 2>/dev/null "$@" ${HOME} | 'quoted text' "$@"
+| | x=1 local printf --verbose test awk ${HOME} awk cd echo
+echo 'quoted text' readonly grep echo sed "$@" printf echo done echo
+	2>/dev/null printf --verbose done -eu test x=1 grep && $(pwd)
+done printf 2>/dev/null echo printf "$1"
+		"$1" echo test /usr/bin cd x=1
+		--verbose -eu sed sed && --verbose -eu sed 'quoted text' --verbose readonly
+${HOME} && printf cd export cd |
+	&& grep then -eu $(pwd) echo 2>/dev/null echo "$@" "$@" echo "$1" $(pwd) $(pwd)
+		| cd ${HOME} /usr/bin readonly echo export export local "$@"
+"$1" local "$1" readonly sed $(pwd) grep done --verbose
+	-eu | ${HOME} grep grep sed 'quoted text'
+test $(pwd) echo test readonly /usr/bin
+	local readonly x=1 cd printf local readonly sed done $(pwd) ${HOME}
+	2>/dev/null $(pwd) grep awk 'quoted text'
+		done echo x=1 x=1 grep -eu "$@" printf 'quoted text' grep
+	awk cd cd cd done 'quoted text' readonly "$1" 'quoted text' "$1" ${HOME}
+	printf sed -eu --verbose
+cd 'quoted text' 'quoted text' awk sed /usr/bin test -eu 2>/dev/null
+	"$@" printf cd -eu done readonly local "$@" readonly cd "$1" awk 2>/dev/null
+printf "$@" -eu awk "$1" && printf $(pwd) "$@" readonly printf done -eu done
+test test /usr/bin echo 2>/dev/null
+	&& sed cd local readonly export cd grep
+		$(pwd) x=1 sed then && done export 'quoted text' $(pwd)
+'quoted text' export done grep export && | done "$1" readonly test && echo
+		local cd awk readonly | test grep x=1 grep |
+	${HOME} export $(pwd) done awk test "$1" 'quoted text'
+	$(pwd) x=1 then readonly -eu then echo 'quoted text' sed $(pwd) -eu test
+local "$1" "$@" grep |
+-eu grep awk grep && readonly --verbose
+--verbose /usr/bin /usr/bin "$1" | local $(pwd)
+awk export -eu 2>/dev/null 2>/dev/null ${HOME}
+	sed --verbose echo echo "$@" -eu test awk ${HOME} readonly printf
+		echo 'quoted text' x=1 cd /usr/bin grep
+	"$@" "$1" grep 'quoted text'
+		done readonly --verbose --verbose echo
+	readonly "$@" && x=1 "$@" "$1" 'quoted text' local
+	2>/dev/null grep | local printf
+		&& awk readonly 'quoted text' "$1" done printf
+		printf sed /usr/bin | cd "$@" awk grep && awk
+		test then grep && -eu grep local test local echo ${HOME}
+	-eu readonly "$@" grep grep | "$1" && local
+	done grep 2>/dev/null /usr/bin
+	"$1" 2>/dev/null --verbose 2>/dev/null local && && readonly -eu ${HOME}
+		| $(pwd) test 2>/dev/null done x=1 | "$@" echo /usr/bin -eu x=1 echo "$@"
+		-eu export awk test echo "$@"
+	2>/dev/null "$@" then local sed -eu awk sed && local echo --verbose
+'quoted text' test done /usr/bin then
+		-eu export "$1" printf readonly ${HOME} 'quoted text'
+'quoted text' printf 2>/dev/null /usr/bin test grep -eu /usr/bin -eu local
+		${HOME} "$@" && && 'quoted text' "$1" readonly 'quoted text' "$@" printf
+		test grep "$@" && $(pwd) export echo printf then
+printf ${HOME} && printf $(pwd) printf awk
+x=1 sed test awk export "$@" --verbose echo export --verbose
+		grep cd "$1" local sed -eu readonly $(pwd) 'quoted text'
+		export cd local /usr/bin "$1" --verbose
+	readonly 'quoted text' sed -eu awk &&
+	local /usr/bin | grep "$1" readonly readonly /usr/bin echo export echo echo local
+	then "$@" grep grep echo local test "$1" cd | | --verbose
+		then --verbose && x=1 /usr/bin x=1 $(pwd) printf echo /usr/bin local
+		&& $(pwd) /usr/bin grep | echo grep done then cd cd --verbose grep then
+		readonly awk 2>/dev/null -eu -eu x=1 then "$@" | /usr/bin grep then awk -eu
+readonly /usr/bin "$1" sed $(pwd)
+	--verbose ${HOME} 'quoted text' ${HOME} awk "$1" "$1" $(pwd) "$@" sed -eu x=1 $(pwd)
+		2>/dev/null done cd x=1 --verbose done $(pwd)
+	sed then 'quoted text' done $(pwd) ${HOME}
+	2>/dev/null cd -eu echo cd $(pwd) /usr/bin x=1 printf
+--verbose local test "$@" --verbose readonly "$1" | | ${HOME} test export
+test x=1 awk "$1" x=1 x=1 done 2>/dev/null done awk echo "$@" then "$@"
+	$(pwd) done | 'quoted text' export awk test cd -eu test
+-eu cd readonly 2>/dev/null "$@" /usr/bin
+	grep -eu -eu cd /usr/bin -eu done 2>/dev/null awk test $(pwd) "$@"
+	printf then 2>/dev/null grep local --verbose printf |
+	printf --verbose --verbose -eu readonly $(pwd) test
+test "$@" test cd readonly sed 'quoted text' grep ${HOME} && awk "$@" then
+printf test done 'quoted text' $(pwd) grep
+	x=1 "$1" printf export done ${HOME} x=1 printf cd sed done -eu --verbose
+		"$@" echo /usr/bin "$@" readonly
+		--verbose 'quoted text' grep 'quoted text' && sed /usr/bin "$1" then && "$1" export
+	'quoted text' "$1" 'quoted text'
+		x=1 /usr/bin "$@" | "$@" then done printf 'quoted text' done | cd export
+		printf 'quoted text' echo --verbose /usr/bin sed cd "$@" printf $(pwd) local
+x=1 export 2>/dev/null $(pwd)
+test -eu awk sed "$@" sed grep test awk cd cd /usr/bin | 2>/dev/null
+	--verbose readonly | ${HOME} echo awk grep
+		x=1 ${HOME} ${HOME} "$@"
+	local ${HOME} /usr/bin x=1 local 2>/dev/null local "$@" && | 'quoted text'
+	-eu cd sed done export x=1 grep 'quoted text' /usr/bin ${HOME}
+local done sed 2>/dev/null && awk 2>/dev/null
+then $(pwd) sed 2>/dev/null printf export echo x=1 local
+x=1 x=1 sed done | /usr/bin
+	/usr/bin ${HOME} 2>/dev/null awk printf "$1" test | cd ${HOME} x=1 x=1
+	/usr/bin grep x=1 -eu export done printf local 2>/dev/null
+		local ${HOME} awk ${HOME}
+	test then export export x=1 cd test grep | $(pwd) export
+		-eu readonly done 2>/dev/null echo grep
+	| x=1 2>/dev/null echo test sed "$@" awk 2>/dev/null test
+		readonly sed "$1" "$1" then awk --verbose "$1"
+test /usr/bin "$1" readonly grep "$1" 2>/dev/null
+		/usr/bin 'quoted text' "$@" $(pwd) local local -eu
+		${HOME} cd -eu then echo export readonly 'quoted text'
+	grep export printf cd "$1" 2>/dev/null echo local 2>/dev/null grep
+		printf ${HOME} && -eu x=1 /usr/bin
+	--verbose --verbose -eu | && && && echo cd export
+sed readonly grep && printf printf grep awk -eu --verbose | local ${HOME} grep
+		cd sed export "$@" readonly grep "$1" printf test ${HOME}
+&& readonly $(pwd) then "$@" test export test readonly
+		sed x=1 | done grep local grep -eu && 'quoted text' grep $(pwd) cd grep -eu
+	readonly /usr/bin -eu grep done
+	done printf -eu ${HOME} echo | test "$1" done $(pwd)
+cd then $(pwd) awk export /usr/bin readonly /usr/bin sed grep --verbose echo
+		awk --verbose 2>/dev/null /usr/bin
+	local -eu sed | /usr/bin
+'quoted text' /usr/bin done "$1" ${HOME} -eu echo
+		| readonly 'quoted text' ${HOME} awk | && done done
+		done x=1 /usr/bin 'quoted text'
+awk then $(pwd) export && "$1" cd cd awk sed sed done
+		cd done sed grep $(pwd) awk done echo
+	$(pwd) /usr/bin "$1" && "$1" -eu done -eu sed done sed echo export
+		readonly ${HOME} "$1"
+grep x=1 | grep 2>/dev/null then
+		cd printf export /usr/bin export cd "$1" sed
+		&& export -eu /usr/bin 2>/dev/null "$@" 2>/dev/null
+		readonly done grep ${HOME} echo && x=1 readonly done then awk cd
+awk | ${HOME} ${HOME} -eu grep "$@" "$@"
+echo /usr/bin sed "$@"
+done done ${HOME} local && export local x=1 $(pwd) $(pwd) sed
+		--verbose && $(pwd) grep $(pwd) awk printf cd 2>/dev/null
+$(pwd) -eu printf x=1 x=1 export done "$@" 2>/dev/null &&
+		export 2>/dev/null 2>/dev/null cd test awk cd grep
+		echo -eu "$1" export awk test readonly awk 'quoted text'
+		grep "$@" printf && sed 'quoted text' && && export /usr/bin
+		--verbose ${HOME} 2>/dev/null
+		&& 'quoted text' then cd 'quoted text' awk 2>/dev/null done
+grep local x=1 $(pwd) --verbose /usr/bin awk awk ${HOME}
+	test export 'quoted text' $(pwd) done grep --verbose && 2>/dev/null
+		test cd awk $(pwd) -eu sed 2>/dev/null then then local
+"$1" $(pwd) -eu readonly
+		| readonly ${HOME} done -eu awk sed done
+		sed /usr/bin $(pwd) x=1 echo sed awk "$@" awk printf
+	export -eu $(pwd) 'quoted text' local ${HOME}
+		-eu sed /usr/bin ${HOME} -eu $(pwd) then sed test grep 'quoted text' && local test
+		--verbose awk && ${HOME} sed | printf x=1 "$1" x=1 local "$1" --verbose -eu
+local done "$1" /usr/bin "$1" then
+		2>/dev/null then export $(pwd) ${HOME} /usr/bin /usr/bin "$1" --verbose echo
+	2>/dev/null done done && /usr/bin local -eu x=1 readonly
+--verbose -eu grep printf
+		then && export cd "$@" /usr/bin
+done awk "$@" then then grep -eu x=1 "$1" awk /usr/bin local
+readonly 2>/dev/null done awk cd && printf && sed x=1
+	| $(pwd) awk -eu 'quoted text' | --verbose "$1" "$1" cd "$@"
+		/usr/bin echo 'quoted text' 2>/dev/null
+x=1 2>/dev/null "$1" ${HOME} $(pwd) readonly -eu
+	--verbose 2>/dev/null $(pwd) | --verbose
+		${HOME} | 'quoted text'
+	$(pwd) echo | $(pwd) | | readonly export "$@" sed /usr/bin "$1"
+		$(pwd) $(pwd) grep | printf --verbose 'quoted text' cd $(pwd) echo echo
+$(pwd) sed local "$@" grep | test --verbose test $(pwd) grep export && -eu $(pwd)
+		x=1 then && "$@" export && echo export readonly /usr/bin
+--verbose cd echo grep grep -eu readonly
+"$@" 'quoted text' cd /usr/bin test printf
+	'quoted text' "$@" "$1" x=1 test test printf && cd 2>/dev/null sed test readonly
+--verbose cd "$@" --verbose printf export sed x=1
+$(pwd) -eu grep echo test -eu
+&& test /usr/bin x=1 "$@" local $(pwd)
+		printf export "$1" $(pwd) "$1" echo
+		$(pwd) echo local --verbose 2>/dev/null echo 'quoted text' ${HOME} echo cd done
+	&& "$@" ${HOME} x=1 -eu ${HOME} 2>/dev/null "$1" grep 'quoted text' awk
+		done && sed printf test "$1" /usr/bin && grep "$1" 2>/dev/null local 'quoted text'
+	-eu ${HOME} && x=1 && grep awk -eu readonly readonly local --verbose 'quoted text'
+	cd $(pwd) printf "$@" --verbose -eu ${HOME} 'quoted text'
+done cd export 2>/dev/null done echo x=1
+		then && ${HOME} export then grep done local done printf cd ${HOME}
+then 2>/dev/null sed awk x=1 ${HOME} printf echo local local then export
+$(pwd) $(pwd) "$@" $(pwd) 2>/dev/null x=1 'quoted text'
+	cd readonly ${HOME} 2>/dev/null 2>/dev/null done done
+	then then test cd 'quoted text' sed "$1" -eu | grep printf test "$@"
+echo printf readonly 2>/dev/null && local "$1"
+		-eu local --verbose then "$1" export x=1 export x=1 awk 2>/dev/null grep sed
+		done 'quoted text' grep export --verbose /usr/bin echo -eu
+		done then | /usr/bin export export --verbose
+x=1 && /usr/bin /usr/bin --verbose "$@" cd | then echo
+	done export done printf awk then awk && grep sed sed 'quoted text'
+test printf echo 2>/dev/null /usr/bin x=1 then ${HOME} -eu 2>/dev/null
+readonly then grep 'quoted text' $(pwd) | echo
+		/usr/bin $(pwd) local local x=1 x=1 x=1 && --verbose
+sed x=1 export x=1 cd printf echo -eu -eu $(pwd) 2>/dev/null && $(pwd) sed
+${HOME} awk cd && 2>/dev/null sed -eu "$@" && local
+#include c118.sh
+--verbose printf awk done 2>/dev/null
+	sed "$@" printf "$1" grep echo cd 'quoted text' cd readonly readonly $(pwd)
+		"$@" ${HOME} echo "$1" | echo then 'quoted text' readonly done
+readonly awk 2>/dev/null export x=1 ${HOME} local
+		export --verbose sed 2>/dev/null 'quoted text' "$1" "$1" $(pwd)
+'quoted text' x=1 echo | local printf test readonly cd sed then x=1 echo
+		printf cd 'quoted text' && -eu "$@" test "$1" "$1" $(pwd)
+		'quoted text' ${HOME} cd done "$1" $(pwd) /usr/bin --verbose readonly
+	'quoted text' -eu && cd -eu "$@"
+	then printf -eu --verbose grep | echo $(pwd) echo x=1 -eu && --verbose readonly
+--verbose $(pwd) grep "$@" "$1" x=1 echo --verbose local 2>/dev/null
+	x=1 -eu local local then && ${HOME} -eu grep
+		awk sed readonly --verbose | && 2>/dev/null
+&& -eu $(pwd) test -eu done 'quoted text' printf -eu 2>/dev/null $(pwd) export
+		printf then printf $(pwd) ${HOME} -eu /usr/bin grep 'quoted text'
+	done sed local $(pwd) sed /usr/bin export
+		-eu && done sed awk then -eu $(pwd) awk
+	cd /usr/bin export then echo export
+		test then ${HOME} grep cd --verbose /usr/bin | cd local
+	/usr/bin export echo "$@" echo awk 'quoted text'
+		2>/dev/null test && --verbose
+export 'quoted text' done /usr/bin grep | local echo done done
+$(pwd) "$@" --verbose test 2>/dev/null --verbose export readonly
+	export "$@" awk ${HOME} then done awk /usr/bin awk $(pwd) export
+		$(pwd) $(pwd) echo /usr/bin
+		/usr/bin sed awk cd test readonly --verbose ${HOME} --verbose awk sed
+		${HOME} "$@" "$1" | readonly test "$@" local export export printf
+echo awk "$1" "$1" | local /usr/bin cd "$@"
+	| printf 2>/dev/null -eu export
+then readonly x=1 echo "$@" x=1 2>/dev/null awk readonly | printf -eu sed grep done
+printf ${HOME} --verbose then --verbose
+		sed | 'quoted text' "$1" printf then printf | "$@" test x=1 "$1" test
+		'quoted text' done printf local readonly echo 2>/dev/null
+		-eu /usr/bin local readonly
+		grep | then 'quoted text'
+		readonly $(pwd) grep |
+		then awk printf readonly --verbose echo then then --verbose
+test export local x=1 "$1" sed export 2>/dev/null x=1 cd $(pwd) $(pwd) test
+	/usr/bin echo printf $(pwd) sed -eu grep then
+"$1" "$@" local 2>/dev/null readonly export readonly cd grep
+local "$@" | 'quoted text' test x=1 sed
+cd $(pwd) --verbose grep x=1 test 'quoted text' then readonly 2>/dev/null
+		--verbose test grep x=1 2>/dev/null test ${HOME} $(pwd)
+		printf test local done local then export 'quoted text'
+	test -eu | 2>/dev/null
+		sed x=1 x=1 ${HOME} then echo awk
+readonly awk grep $(pwd) "$1" | "$@" /usr/bin x=1 /usr/bin "$@" export export
+x=1 done test && && -eu "$@" 2>/dev/null test awk "$1" /usr/bin | 'quoted text'
+readonly $(pwd) done echo awk echo "$@" --verbose sed 2>/dev/null
+then 'quoted text' x=1 then "$@"
+	echo sed export "$1" then
+		/usr/bin sed x=1 "$@" | "$@" -eu 'quoted text' "$1" 2>/dev/null cd
+		export | printf && "$@" test
+		cd readonly readonly test && -eu x=1 grep local /usr/bin -eu readonly
+--verbose /usr/bin local printf done "$@" export "$1" sed | $(pwd) readonly
+done $(pwd) local 2>/dev/null 2>/dev/null test ${HOME} && ${HOME} done
+		-eu echo 2>/dev/null /usr/bin awk printf && export x=1 "$1"
+	readonly export 'quoted text' cd "$1" done x=1 echo awk echo cd test
+	"$1" sed done $(pwd) readonly export local
+	printf printf | export && printf x=1 $(pwd) -eu echo local
+		readonly cd ${HOME} && "$1" -eu cd --verbose
+		export export readonly printf done x=1
+$(pwd) export 2>/dev/null readonly
+		readonly echo -eu echo cd "$@" 'quoted text'
+then -eu readonly sed done && -eu | 2>/dev/null awk
+	-eu $(pwd) awk $(pwd) export "$@" grep
+done awk --verbose x=1 "$@" grep 'quoted text'
+		printf "$1" /usr/bin printf $(pwd) then readonly local sed && --verbose
+	/usr/bin /usr/bin ${HOME} | "$@" && test echo /usr/bin
+readonly | echo awk printf cd readonly $(pwd) -eu local then cd grep
+		2>/dev/null "$1" 'quoted text' x=1 grep
+	-eu echo --verbose sed 2>/dev/null sed -eu
+	"$1" export 'quoted text' | 'quoted text' 2>/dev/null /usr/bin | export 'quoted text'
+		done test "$@" && printf "$@" 'quoted text' x=1 "$@" 2>/dev/null
+printf local cd && then $(pwd) echo "$@" printf 'quoted text'
+| /usr/bin ${HOME} done local cd -eu
+		done local done export
+		/usr/bin 'quoted text' local
+	printf -eu | 'quoted text' "$1" awk | ${HOME} then done 2>/dev/null sed
+cd -eu grep "$1" grep cd
+${HOME} 'quoted text' printf
+/usr/bin readonly done -eu --verbose
+$(pwd) sed printf done local local cd then
+	${HOME} awk && "$@" 'quoted text'
+	"$1" grep 2>/dev/null test 'quoted text' export grep x=1 echo
+	export "$1" /usr/bin 2>/dev/null 'quoted text' readonly
+		'quoted text' then awk awk
+2>/dev/null test $(pwd) local --verbose grep x=1 echo | grep /usr/bin sed echo
+	2>/dev/null && ${HOME} echo cd readonly
+	done "$@" grep --verbose done
+test local then && && local 'quoted text'
+	"$1" && --verbose "$1" 'quoted text' && local 'quoted text'
+	printf x=1 readonly -eu x=1 "$1" awk /usr/bin | /usr/bin ${HOME} x=1
+		grep done 2>/dev/null done 'quoted text' cd then "$1" --verbose -eu "$@" local
+grep "$@" test ${HOME} 2>/dev/null awk sed && x=1 done && "$1" 'quoted text'
+		test 'quoted text' ${HOME} $(pwd) printf
+local cd --verbose /usr/bin x=1 readonly "$@" | && grep cd | done cd then ${HOME}
+		"$@" awk readonly &&
+local $(pwd) "$1" 'quoted text'
+readonly $(pwd) 'quoted text' local
+export ${HOME} "$1" done --verbose 2>/dev/null 'quoted text' sed -eu
+&& $(pwd) "$1" readonly readonly echo
+	local && 'quoted text' local
+		echo --verbose -eu && test | ${HOME} $(pwd) awk $(pwd) /usr/bin export then
+		-eu awk readonly ${HOME} 2>/dev/null -eu 2>/dev/null local local awk 'quoted text'
+cd done readonly then export test 2>/dev/null $(pwd)
+2>/dev/null ${HOME} -eu | | local local "$@" /usr/bin "$@"
+cd local ${HOME} awk ${HOME} 'quoted text' then 2>/dev/null
+		printf sed /usr/bin 2>/dev/null "$1" awk -eu 2>/dev/null | 'quoted text'
+	--verbose x=1 /usr/bin ${HOME} local
+		$(pwd) test then done printf local
+	"$1" "$1" grep | echo $(pwd) grep
+		cd ${HOME} awk echo done /usr/bin done done cd ${HOME} "$1"
+test --verbose 2>/dev/null sed readonly "$1" $(pwd) $(pwd)
+	2>/dev/null test export grep "$1" cd | printf /usr/bin then readonly
+	awk local -eu 2>/dev/null && --verbose then cd "$1" 2>/dev/null
+then 2>/dev/null | ${HOME} $(pwd) local | printf && "$@"
+"$1" --verbose $(pwd) grep grep 2>/dev/null "$@" && cd -eu export x=1 2>/dev/null
+	2>/dev/null sed /usr/bin awk /usr/bin echo x=1 local --verbose
+	local "$@" "$1" "$1" done
+"$@" echo "$1" test export --verbose /usr/bin $(pwd) -eu --verbose
+	$(pwd) /usr/bin && /usr/bin
+		'quoted text' "$1" 2>/dev/null
+	test | echo --verbose test ${HOME} x=1 cd 2>/dev/null "$1"
+		-eu test --verbose 'quoted text'
+awk -eu readonly 'quoted text' x=1 2>/dev/null
+2>/dev/null echo --verbose sed x=1 done local 'quoted text' $(pwd) $(pwd)
+test 'quoted text' /usr/bin printf sed then && done && local echo then export done
+		cd "$1" "$@" -eu test sed 2>/dev/null sed then then x=1 test local
+	x=1 echo done awk readonly printf local "$@" | "$1" export echo 2>/dev/null
+"$1" "$@" "$1" 2>/dev/null -eu 'quoted text' local then "$1" /usr/bin test x=1
+	test "$1" 2>/dev/null "$@" awk sed echo | readonly export | then
+	done local export test $(pwd) then
+	awk | ${HOME} echo done && "$1" -eu 2>/dev/null
+	$(pwd) --verbose | local
+		x=1 && readonly readonly $(pwd) ${HOME} $(pwd) done echo awk /usr/bin
+	-eu "$1" done local printf "$1"
+	"$1" awk awk local | awk test awk 'quoted text'
+	grep sed sed grep then --verbose 2>/dev/null
+		-eu awk 'quoted text' echo done local echo done grep -eu && cd local
+grep sed printf x=1 then grep 'quoted text'
+		&& --verbose --verbose
+		done $(pwd) | cd "$1" test $(pwd) grep | then
+	sed echo local -eu x=1 && readonly echo readonly
+	test x=1 && --verbose | ${HOME} readonly "$1" ${HOME} printf -eu export test
+	export echo x=1 local | grep x=1 -eu readonly sed /usr/bin "$1" -eu --verbose
+		then sed echo grep | 'quoted text' | "$1" -eu && | | grep x=1 "$@"
+	/usr/bin readonly cd sed cd then printf done
+	2>/dev/null x=1 $(pwd) test test cd 'quoted text'
+		test echo x=1 awk awk "$@" grep $(pwd) | export
+		"$@" printf export awk | grep 2>/dev/null
+		readonly awk "$1" then "$1" export then echo local ${HOME} echo then 'quoted text'
+/usr/bin && -eu --verbose $(pwd) | grep readonly then x=1 cd printf /usr/bin
+x=1 cd readonly "$@" awk x=1 readonly x=1 -eu 2>/dev/null
+sed 2>/dev/null done cd $(pwd) cd && $(pwd) 'quoted text'
+&& && /usr/bin ${HOME} | --verbose local export /usr/bin
+		'quoted text' test awk sed
+test cd then "$1" awk x=1 readonly /usr/bin
+		| | "$1" awk export -eu sed printf grep
+	printf then grep readonly awk awk "$@" done x=1 -eu x=1
+		&& 2>/dev/null ${HOME} awk x=1 grep "$1" ${HOME} sed ${HOME} 'quoted text'
+		"$1" test "$1" $(pwd) $(pwd) printf && awk $(pwd) &&
+		-eu export ${HOME} "$@" sed test awk "$@" then -eu 2>/dev/null
+/usr/bin readonly && local cd then cd awk test $(pwd) 'quoted text' export
+	local test echo sed local x=1 export && echo x=1 test
+		done readonly /usr/bin then cd 'quoted text'
+	2>/dev/null sed 2>/dev/null printf grep then local 'quoted text'
+| 'quoted text' then sed readonly "$@" | 'quoted text'
+"$@" "$@" ${HOME} "$1" 'quoted text' ${HOME} x=1 2>/dev/null /usr/bin
+		export test local --verbose
+	x=1 echo cd sed "$@" -eu ${HOME} awk printf
+local $(pwd) /usr/bin $(pwd) export cd test grep ${HOME}
+"$1" awk /usr/bin --verbose awk printf
+		export "$@" 'quoted text'
+		&& grep echo done --verbose sed | 2>/dev/null test $(pwd)
+${HOME} local grep local export /usr/bin
+'quoted text' -eu "$@" 'quoted text' -eu $(pwd)
+		/usr/bin | local export then awk sed ${HOME} awk /usr/bin
+readonly test $(pwd) ${HOME} --verbose
+	'quoted text' grep local done sed --verbose $(pwd) sed local 'quoted text'
+	echo echo export test /usr/bin
+		printf awk done test done x=1 --verbose sed printf cd readonly test $(pwd)
+--verbose 2>/dev/null readonly
+		local cd sed | done test export test echo cd "$@" 2>/dev/null done
+		echo 2>/dev/null --verbose 'quoted text' 2>/dev/null echo && local "$1" then test
+'quoted text' printf 'quoted text' test ${HOME} done "$@"
+	readonly readonly sed export && && "$@" "$@" -eu 2>/dev/null cd local local grep
+		${HOME} local cd sed "$1"
+"$@" local -eu sed printf 'quoted text' | --verbose cd
+	'quoted text' -eu ${HOME} 'quoted text' local /usr/bin test x=1 cd
+		test && | printf 'quoted text' echo "$@"
+	test local awk export --verbose done $(pwd) /usr/bin sed
+		echo $(pwd) "$@" x=1 test 2>/dev/null test
+	/usr/bin | done cd "$1" awk 'quoted text' 2>/dev/null
+readonly -eu $(pwd) "$@" --verbose -eu
+	awk done /usr/bin then --verbose
+		--verbose && then echo echo awk local ${HOME}
+/usr/bin "$@" done local local cd /usr/bin readonly 'quoted text' &&
+		'quoted text' "$@" 'quoted text'
+		done 2>/dev/null export export 'quoted text'
+	printf test ${HOME} awk test readonly test then 'quoted text' test x=1 awk
+		awk sed ${HOME} | 2>/dev/null 'quoted text'
+	grep | local x=1 -eu /usr/bin
+		printf --verbose | --verbose
+'quoted text' 'quoted text' grep /usr/bin test grep test
+$(pwd) --verbose 'quoted text' -eu ${HOME} x=1 && test "$1" "$@" $(pwd)
+		/usr/bin "$1" then then "$1"
+readonly grep test 2>/dev/null
+	grep "$1" done -eu -eu ${HOME}
+| sed "$1" local echo | | 2>/dev/null awk echo "$1" test $(pwd) printf "$@" test
+	done then "$@" cd $(pwd) done printf --verbose
+test x=1 --verbose sed cd ${HOME} /usr/bin done ${HOME} /usr/bin echo
+awk echo test --verbose "$1" 2>/dev/null
+	local echo ${HOME} sed done export "$@"
+$(pwd) 'quoted text' 2>/dev/null done cd echo export readonly "$1" readonly echo
+	test --verbose export readonly
+		readonly grep sed test printf awk readonly
+		/usr/bin "$1" && /usr/bin awk awk 'quoted text' "$1" test grep
+		awk "$1" $(pwd) /usr/bin 2>/dev/null
+	test test cd --verbose ${HOME} cd "$1" "$1" x=1 then grep export awk
+	x=1 test then "$@" ${HOME} awk "$1"
+	awk cd "$@" -eu test $(pwd) "$1" printf --verbose /usr/bin
+		/usr/bin x=1 x=1 'quoted text' "$@" printf export local x=1 'quoted text'
+then grep export printf "$@" "$1" export 'quoted text'
+"$1" 'quoted text' /usr/bin grep --verbose /usr/bin 2>/dev/null /usr/bin 2>/dev/null
+2>/dev/null sed grep | sed -eu then
+		then && ${HOME} --verbose 'quoted text' export -eu x=1 readonly
+		sed local && export printf then test grep
+| grep && /usr/bin ${HOME} awk export $(pwd) then readonly grep awk cd "$@"
+local sed && x=1 x=1 x=1 -eu done export && done export
+"$@" -eu --verbose readonly local 'quoted text'
+		awk /usr/bin done --verbose readonly 2>/dev/null
+	grep ${HOME} 'quoted text'
+	grep cd done --verbose --verbose /usr/bin
+	${HOME} then --verbose then test 'quoted text' --verbose awk printf && && ${HOME}
+	"$@" -eu $(pwd) done "$1" "$@" && |
+	grep --verbose "$@" $(pwd) printf readonly 'quoted text' --verbose test
+		sed $(pwd) awk done --verbose sed
+		| grep -eu /usr/bin then awk "$1" && ${HOME}
+		'quoted text' export export done
+	readonly awk cd | awk | /usr/bin 2>/dev/null | grep readonly | 2>/dev/null
+	--verbose && && $(pwd) 'quoted text'
+	cd then --verbose local x=1 && -eu
+echo /usr/bin --verbose "$@" "$@" 'quoted text' && /usr/bin readonly |
+	cd echo sed 2>/dev/null x=1 ${HOME} x=1 sed awk
+-eu x=1 "$@" $(pwd) echo awk "$1" --verbose --verbose "$1" export export "$1"
+		test local && | -eu sed test /usr/bin 2>/dev/null local ${HOME} x=1
+	$(pwd) "$@" local x=1 2>/dev/null
+echo printf printf readonly x=1 "$1" | readonly readonly printf ${HOME} echo "$1"
+		--verbose test printf $(pwd) -eu $(pwd) "$1" printf export grep readonly
+${HOME} 2>/dev/null cd -eu done && 2>/dev/null grep
+	'quoted text' 'quoted text' test x=1 --verbose
+"$1" awk echo && $(pwd)
+printf test echo -eu printf printf
+sed x=1 readonly $(pwd) 'quoted text' sed && then
+		--verbose awk /usr/bin --verbose x=1 awk export /usr/bin --verbose
+	awk $(pwd) echo sed $(pwd) sed --verbose
+		--verbose readonly 'quoted text' sed echo cd $(pwd) "$@"
+	local readonly 2>/dev/null x=1 /usr/bin sed then $(pwd) local done echo
+	local 'quoted text' export awk $(pwd) $(pwd) | echo ${HOME} done
+		$(pwd) local "$1" "$@" test /usr/bin echo export 'quoted text'
+	'quoted text' "$@" -eu "$1" cd cd && --verbose "$1" sed "$1"
+test cd export "$@" echo 2>/dev/null sed then done readonly | printf
+&& export --verbose printf export test sed ${HOME} grep local
+	sed ${HOME} 2>/dev/null --verbose $(pwd) test
+		local 'quoted text' local "$1"
+	--verbose readonly printf 'quoted text' x=1 /usr/bin
+		test "$@" local test /usr/bin --verbose "$@" cd echo
+		cd grep 2>/dev/null grep "$@" export echo
+		&& readonly --verbose grep "$@" -eu x=1
+		printf sed cd sed && "$@" echo && | cd ${HOME} printf local ${HOME} echo
+	"$1" awk readonly local $(pwd) printf grep printf
+		local readonly 'quoted text'
+	/usr/bin awk 2>/dev/null cd && 'quoted text' sed awk "$@" export
+	then sed ${HOME} local awk cd
+grep $(pwd) --verbose /usr/bin
+&& 'quoted text' grep --verbose --verbose 2>/dev/null
+		${HOME} local local $(pwd) /usr/bin && export $(pwd) cd readonly $(pwd)
+2>/dev/null cd cd && then local cd then
+		export awk --verbose awk awk test -eu "$1" cd test done test 'quoted text' then
+		'quoted text' $(pwd) /usr/bin "$@" echo then | grep then awk local local "$@"
+	local 'quoted text' "$1" x=1 "$1" "$1" | 2>/dev/null
+	grep local | printf ${HOME} $(pwd) readonly
+	"$@" ${HOME} -eu readonly -eu && /usr/bin readonly
+		x=1 2>/dev/null | 'quoted text' && |
+	grep done ${HOME} export x=1 ${HOME} "$@" "$@" /usr/bin test --verbose ${HOME}
+		export cd cd readonly ${HOME} x=1 2>/dev/null 2>/dev/null printf
+		test test --verbose test awk x=1 awk
+export | /usr/bin --verbose $(pwd) $(pwd) grep x=1 local && cd 'quoted text'
+	| "$@" export readonly printf
+2>/dev/null 'quoted text' | /usr/bin then echo
+		printf then 2>/dev/null readonly "$@" echo echo done -eu "$1" | ${HOME} grep
+	printf test | x=1 grep export ${HOME} echo readonly --verbose
+"$@" "$@" /usr/bin "$1" cd printf x=1 "$1" "$@" grep
+printf ${HOME} 'quoted text'
+then "$@" 'quoted text' readonly local then -eu grep awk grep x=1 --verbose
+		"$@" 'quoted text' x=1 /usr/bin export done && 'quoted text' done done /usr/bin
+export 2>/dev/null readonly export --verbose echo && "$1" /usr/bin
+		awk printf done sed && 'quoted text' "$@" 2>/dev/null -eu ${HOME} 'quoted text'
+		'quoted text' echo sed ${HOME} | done sed sed
+export sed x=1 export /usr/bin then | 'quoted text'
+	then then then done "$1" 2>/dev/null cd $(pwd) -eu export awk grep x=1
+	echo --verbose x=1 -eu && local $(pwd) export printf
+		-eu awk done cd test x=1
+	echo "$1" /usr/bin ${HOME} 'quoted text' readonly
+	test --verbose awk -eu ${HOME} awk --verbose then | /usr/bin "$1" printf test
+		done && "$1" /usr/bin -eu $(pwd) cd && "$@"
+	local local awk 2>/dev/null $(pwd) 'quoted text' local ${HOME} --verbose
+	local "$@" && echo x=1 |
+done ${HOME} sed then ${HOME} sed then echo $(pwd) && echo "$1" $(pwd) awk --verbose
+	done export echo grep then printf -eu local then
+		/usr/bin done 'quoted text' --verbose
+		--verbose export printf x=1 'quoted text' local test grep 'quoted text'
+$(pwd) then "$@" | /usr/bin 2>/dev/null echo x=1 /usr/bin readonly
+	'quoted text' sed x=1 test && 2>/dev/null /usr/bin
+	-eu && 'quoted text' test x=1 done -eu awk "$1" ${HOME} sed awk echo 2>/dev/null
+		/usr/bin printf 2>/dev/null done test sed grep ${HOME}
+		printf --verbose awk $(pwd) x=1 /usr/bin
+x=1 printf echo && export --verbose && printf /usr/bin
+		cd 2>/dev/null printf sed x=1 /usr/bin grep done test 'quoted text' export ${HOME}
+	"$1" cd local export export --verbose cd cd awk && printf
+		echo /usr/bin /usr/bin && /usr/bin 'quoted text' sed
+	readonly readonly ${HOME} -eu /usr/bin done then grep awk
+	done test grep ${HOME} x=1 readonly "$@" --verbose
+"$@" export | $(pwd) ${HOME} --verbose &&
+2>/dev/null sed local $(pwd) readonly sed cd sed
+local cd "$@" | "$@" $(pwd) grep echo
+	| 2>/dev/null cd "$1" ${HOME} "$@" /usr/bin x=1 local grep $(pwd) export
+	/usr/bin "$1" "$1" grep awk 2>/dev/null 'quoted text'
+| sed x=1 | grep cd "$1" | printf /usr/bin export "$1" "$1"
+| then -eu x=1 "$1" "$1" "$@" echo 'quoted text' && echo 'quoted text'
+--verbose cd 2>/dev/null readonly
+		grep /usr/bin 'quoted text' 'quoted text' awk grep done export
+		${HOME} ${HOME} --verbose test 2>/dev/null sed --verbose
+		then "$1" sed $(pwd) then | echo readonly sed ${HOME} awk -eu 2>/dev/null
+		grep then /usr/bin cd local /usr/bin "$@" "$1" "$1" "$1" /usr/bin echo
+	&& x=1 2>/dev/null printf /usr/bin
+then -eu echo awk --verbose awk /usr/bin cd done awk then | $(pwd)
+	test done x=1 "$1" then echo "$@" readonly echo
+/usr/bin sed x=1 && && x=1 printf local x=1 readonly awk 'quoted text'
+then cd test readonly grep
+	| echo ${HOME} test &&
+	test test echo --verbose 'quoted text' cd printf cd /usr/bin test && x=1 done
+	${HOME} done "$@" 'quoted text' x=1 cd | cd 'quoted text' done cd
+		cd | --verbose awk "$@" cd -eu /usr/bin
+readonly done x=1 local x=1 printf echo printf && grep local readonly printf
+	"$1" awk /usr/bin awk 2>/dev/null
+	| export | $(pwd) 'quoted text' printf x=1 2>/dev/null readonly "$@" export
+printf x=1 ${HOME} awk $(pwd) /usr/bin
+		x=1 $(pwd) local echo 'quoted text' $(pwd)
+&& ${HOME} printf local "$1" done $(pwd) 2>/dev/null ${HOME}
+printf then local test export
+	done "$1" "$1" 2>/dev/null 2>/dev/null grep --verbose sed |
+		-eu x=1 printf readonly $(pwd) "$@" printf readonly --verbose /usr/bin
+		-eu export | ${HOME} local readonly
+	--verbose export ${HOME} $(pwd) grep export /usr/bin
+"$1" /usr/bin export x=1 export 'quoted text' printf 2>/dev/null
+echo test grep "$@" /usr/bin done "$1" echo --verbose
+		"$@" sed --verbose sed 'quoted text'
+		printf sed 2>/dev/null x=1 cd | local -eu printf x=1 grep printf
+	--verbose done -eu $(pwd)
+		printf awk 2>/dev/null echo awk 'quoted text' export test awk then done sed x=1
+	| test readonly /usr/bin local ${HOME} local test then ${HOME} /usr/bin
+		&& done grep $(pwd) sed readonly
+		then readonly grep awk && -eu "$1" done readonly "$1" readonly
+		done awk then test -eu grep grep x=1 cd
+&& /usr/bin -eu ${HOME} cd &&
+export -eu && grep /usr/bin printf x=1 sed 'quoted text' export x=1 cd x=1
+		${HOME} "$@" done readonly cd x=1 --verbose done
+readonly | done 'quoted text' export awk x=1 ${HOME} 2>/dev/null --verbose
+	--verbose && readonly test "$1" export printf -eu local sed -eu && | test
+readonly then sed -eu awk -eu echo sed --verbose ${HOME} "$1" && | export
+grep awk /usr/bin /usr/bin awk awk printf cd "$@"
+		'quoted text' "$@" $(pwd)
+		export /usr/bin && cd -eu awk 2>/dev/null /usr/bin done 'quoted text' awk
+		sed local ${HOME} && ${HOME} sed export grep x=1 'quoted text'
+then grep "$1" "$@" awk $(pwd) -eu | awk -eu 2>/dev/null awk sed
+| sed ${HOME} /usr/bin then awk local 'quoted text' 'quoted text' 'quoted text'
+		&& export x=1 awk --verbose "$@" "$1"
+	grep done "$1" readonly
+		then && /usr/bin && /usr/bin /usr/bin readonly 2>/dev/null test local
+test awk grep grep ${HOME}
+	then ${HOME} echo done awk echo | sed then test grep cd
+then -eu awk echo echo 'quoted text' awk -eu done done cd printf --verbose x=1
+	"$@" 'quoted text' test export "$@" -eu local export test then echo awk done then
+	sed "$@" done awk --verbose 2>/dev/null -eu cd x=1 "$1" grep
+		grep 2>/dev/null "$1" 2>/dev/null x=1 done grep done echo sed echo --verbose
+		printf grep 2>/dev/null echo echo -eu sed | readonly "$@" -eu -eu sed --verbose
+	--verbose ${HOME} x=1 /usr/bin grep 'quoted text' /usr/bin
+	/usr/bin echo 2>/dev/null | echo /usr/bin
+		echo export printf --verbose
+	echo sed test test export /usr/bin awk && cd printf
+		"$@" done "$@" grep printf sed cd ${HOME} awk printf
+readonly /usr/bin cd test "$1" test done local 2>/dev/null printf && test then $(pwd)
+"$1" awk x=1 "$@" "$1" "$1" $(pwd) /usr/bin local local cd
+readonly "$1" 'quoted text' 'quoted text' export printf --verbose
+cd export "$1" readonly readonly
+	readonly grep $(pwd) local "$@" $(pwd)
+	done /usr/bin local 'quoted text' echo
+'quoted text' /usr/bin awk awk --verbose --verbose 'quoted text'
+	awk then ${HOME} /usr/bin 2>/dev/null x=1
+awk export local printf then done /usr/bin --verbose local 2>/dev/null 'quoted text'
+	"$@" && cd $(pwd) --verbose --verbose printf --verbose printf export printf
+	grep then $(pwd) | $(pwd) 2>/dev/null "$1" "$@" /usr/bin printf $(pwd) ${HOME}
+	x=1 && done readonly done cd done && "$1" cd echo
+grep readonly then printf printf done test &&
+readonly awk grep test
+	local -eu sed 'quoted text' sed 2>/dev/null "$1" $(pwd) echo awk export then export
+		done "$1" "$1" 'quoted text' "$1" "$1" then /usr/bin $(pwd)
+echo 'quoted text' readonly grep awk 'quoted text' "$@" readonly
+	'quoted text' "$1" sed export
+awk && 'quoted text' "$@" grep
+'quoted text' 2>/dev/null
+--verbose echo printf done $(pwd) done cd "$@" export
+readonly $(pwd) -eu --verbose
+		-eu awk 'quoted text' printf
+	2>/dev/null grep -eu -eu awk printf 'quoted text' && /usr/bin 2>/dev/null cd /usr/bin
+		echo --verbose /usr/bin then awk ${HOME} |
+	&& 2>/dev/null cd export 'quoted text' --verbose
+		/usr/bin /usr/bin done printf local "$1" local x=1 echo then
+-eu "$@" "$@" ${HOME} echo "$1" done x=1 then x=1
+		then then local grep $(pwd) test 2>/dev/null x=1 test
+| printf cd 'quoted text' x=1 | "$1" awk
+		$(pwd) test --verbose done test && "$1" |
+		grep done 2>/dev/null -eu $(pwd) ${HOME}
+done x=1 'quoted text' "$@" && x=1
+		"$@" grep done x=1 test test
+		-eu printf $(pwd) "$@" -eu test $(pwd) done $(pwd) cd ${HOME}
+		/usr/bin "$1" "$1" "$@" -eu cd
+	grep 2>/dev/null test $(pwd) export --verbose printf grep 2>/dev/null &&
+	sed echo | 'quoted text' readonly --verbose 'quoted text'
+		| | /usr/bin sed 'quoted text' awk
+		grep && echo -eu grep printf awk printf 'quoted text' ${HOME} | then -eu export
+	readonly /usr/bin /usr/bin export x=1 done && 2>/dev/null /usr/bin then echo
+-eu 'quoted text' "$1" 'quoted text' x=1 echo "$@" awk "$@" done
+	/usr/bin sed readonly then grep echo && 'quoted text' sed local echo test | -eu
+		/usr/bin grep x=1 | 'quoted text' ${HOME} done done --verbose
+		readonly x=1 export ${HOME} done ${HOME} grep sed grep then /usr/bin
+"$1" -eu done awk 2>/dev/null test local ${HOME} then ${HOME} $(pwd) 2>/dev/null
+$(pwd) $(pwd) then /usr/bin
+-eu 'quoted text' sed 'quoted text' readonly sed printf
+	| -eu sed "$1" ${HOME} done done
+x=1 | sed readonly | echo "$1"
+cd $(pwd) -eu "$1" /usr/bin cd local awk /usr/bin | sed x=1 then
+		awk done local grep && echo readonly awk readonly sed && /usr/bin
+	| 'quoted text' sed local cd | $(pwd) "$1" grep awk echo $(pwd) echo
+echo 'quoted text' done local x=1 $(pwd)
+		cd --verbose cd printf 'quoted text' /usr/bin && --verbose
+2>/dev/null test export -eu /usr/bin done ${HOME}
+local $(pwd) cd echo grep "$@" -eu 2>/dev/null
+grep readonly cd 'quoted text' "$1" printf awk | echo "$1" /usr/bin --verbose
+	${HOME} test export 'quoted text' echo
+then && local then "$@" done "$1" grep --verbose echo done done cd echo
+--verbose echo export local done test && 'quoted text' sed
+		test /usr/bin "$@" 'quoted text' x=1 local $(pwd)
+sed 'quoted text' ${HOME} local /usr/bin && test
+		"$1" "$1" then 2>/dev/null then | awk then 2>/dev/null export readonly
+x=1 | grep 2>/dev/null $(pwd) "$1" echo -eu done 'quoted text' readonly --verbose
+	$(pwd) $(pwd) export done readonly local -eu readonly grep sed 'quoted text'
+		$(pwd) readonly local test "$1" 2>/dev/null -eu awk -eu sed | readonly grep
+	| cd "$1" x=1 printf /usr/bin cd 'quoted text' 2>/dev/null awk then
+2>/dev/null printf x=1 echo grep $(pwd) && 'quoted text' 'quoted text'
+echo && printf grep | printf "$1" -eu 'quoted text' sed then 'quoted text'
+	$(pwd) "$1" export --verbose
+	$(pwd) "$1" 2>/dev/null x=1 2>/dev/null cd 'quoted text' x=1 then
+	$(pwd) local | grep readonly -eu && cd export printf awk 'quoted text' -eu
+then --verbose && awk local --verbose printf "$1" 'quoted text' x=1 sed |
+		"$1" x=1 "$1" $(pwd) printf then --verbose -eu then done x=1 done
+		export $(pwd) test test /usr/bin done done grep cd x=1 sed /usr/bin
+awk grep then x=1 grep local --verbose 2>/dev/null --verbose
+		x=1 ${HOME} 2>/dev/null test awk awk cd ${HOME}
+		"$1" /usr/bin --verbose echo --verbose test test -eu x=1 "$@" test sed
+echo "$1" cd printf ${HOME} | ${HOME} | "$@" -eu
+	printf readonly /usr/bin x=1 --verbose 2>/dev/null -eu x=1 --verbose
+		'quoted text' printf $(pwd) "$1" -eu "$1" readonly
+| then sed | awk "$1" 'quoted text' cd readonly "$1" 2>/dev/null cd "$1" test x=1
+&& && grep x=1 2>/dev/null -eu && export
+cd 'quoted text' --verbose readonly | echo readonly | /usr/bin
+		local awk 2>/dev/null done /usr/bin /usr/bin "$@"
+readonly grep && awk 2>/dev/null printf "$1" 'quoted text'
+	&& export grep printf readonly then ${HOME} export then &&
+2>/dev/null then $(pwd) x=1
+	&& -eu "$1" x=1 | | local then -eu
+grep grep sed test echo ${HOME} awk sed 'quoted text' 2>/dev/null
+&& --verbose $(pwd) --verbose
+		test $(pwd) cd grep "$@" export && $(pwd) then grep $(pwd)
+x=1 grep "$1" echo "$1" awk | done test
+&& readonly printf 2>/dev/null && 'quoted text' | /usr/bin
+		x=1 $(pwd) ${HOME} $(pwd) done done --verbose readonly done
+printf test sed cd test ${HOME} cd 2>/dev/null printf
+		export 'quoted text' | then | test "$1" readonly
+	printf /usr/bin then --verbose $(pwd) local
+	"$1" grep "$1" "$@" x=1 readonly 2>/dev/null $(pwd)
+	then 2>/dev/null x=1 $(pwd) grep ${HOME}
+		-eu test /usr/bin /usr/bin local echo awk readonly
+echo grep && readonly done export --verbose printf 'quoted text' --verbose
+done local $(pwd) 2>/dev/null
+	&& done x=1 2>/dev/null $(pwd)
+	sed --verbose echo 'quoted text' test readonly readonly /usr/bin local -eu
+printf echo sed sed x=1 readonly
+		"$@" printf cd /usr/bin test then 2>/dev/null && echo
+	local /usr/bin "$1" grep export
+	'quoted text' grep done then /usr/bin
+	awk /usr/bin && -eu | 2>/dev/null
+	grep sed export done grep local done grep then /usr/bin awk
+	echo $(pwd) && echo 2>/dev/null "$@" export
+	echo ${HOME} sed -eu -eu --verbose -eu export
+local | printf x=1 local /usr/bin awk /usr/bin $(pwd) 2>/dev/null
+		-eu done --verbose export 2>/dev/null 'quoted text'
+-eu && sed done "$@" readonly
+${HOME} cd readonly "$1" printf then done && then "$1" then awk done
+export export -eu 'quoted text' 2>/dev/null x=1 sed readonly local "$@"
+sed readonly "$1" 'quoted text' sed | grep 2>/dev/null sed && x=1 'quoted text'
+$(pwd) $(pwd) sed "$1" local
+	--verbose export "$@" grep printf && ${HOME} export --verbose
+	$(pwd) ${HOME} echo $(pwd) 'quoted text' then sed "$1" && done
+		--verbose --verbose awk x=1 "$1" | "$1"
+	-eu --verbose cd awk local grep done | done
+	$(pwd) 'quoted text' 'quoted text' sed 2>/dev/null local /usr/bin awk
+		2>/dev/null $(pwd) test printf then $(pwd)
+echo --verbose export -eu --verbose local export
+		printf "$1" 2>/dev/null readonly 2>/dev/null ${HOME} ${HOME} 'quoted text'
+printf test ${HOME} then -eu
+&& 'quoted text' cd test --verbose $(pwd) | --verbose test
+		echo x=1 ${HOME} local -eu $(pwd)
+	grep done /usr/bin then x=1 "$1" --verbose readonly 'quoted text'
+		| printf sed echo /usr/bin printf
+then sed then 2>/dev/null $(pwd) && ${HOME} cd $(pwd) done echo
+	$(pwd) && -eu sed cd done
+test 'quoted text' test 2>/dev/null
+"$1" | local /usr/bin printf -eu | cd "$@" cd printf "$@" then then echo local
+	&& $(pwd) /usr/bin cd awk 2>/dev/null
+	'quoted text' && -eu 'quoted text' export grep printf /usr/bin cd x=1
+then 2>/dev/null grep grep
+		x=1 x=1 && sed done done sed cd then grep grep test then
+done --verbose 'quoted text' echo ${HOME} sed "$1"
+	"$1" readonly && local done done | printf cd /usr/bin $(pwd) done 'quoted text'
+printf cd cd $(pwd) && readonly awk --verbose grep 2>/dev/null test | export
+	| echo "$@" local 'quoted text' echo readonly done "$@" awk && "$1" 2>/dev/null
+	${HOME} $(pwd) printf "$@" echo ${HOME} /usr/bin then "$1"
+	/usr/bin ${HOME} ${HOME} printf printf
+		"$1" done grep sed sed done
+		"$1" | grep "$@" cd /usr/bin
+	local local 2>/dev/null awk sed ${HOME} | readonly export readonly
+		$(pwd) --verbose "$1" "$1" then cd "$@" 2>/dev/null --verbose
+	-eu "$@" awk readonly then echo done --verbose 2>/dev/null sed "$1"
+		/usr/bin cd --verbose echo cd /usr/bin
+	grep ${HOME} | ${HOME}
+2>/dev/null && $(pwd) -eu 2>/dev/null printf test $(pwd) |
+	'quoted text' x=1 "$@" x=1 cd cd "$@" grep ${HOME} readonly | printf
+${HOME} /usr/bin echo --verbose && && local readonly "$@" echo echo cd done 2>/dev/null
+		| "$@" --verbose test --verbose
+	${HOME} x=1 awk "$@" then cd "$@" printf readonly -eu "$1" then local | readonly
+		${HOME} x=1 --verbose
+	grep then $(pwd) | readonly then
+${HOME} grep echo cd awk grep ${HOME}
+	'quoted text' ${HOME} done -eu |
+		cd sed echo "$@" /usr/bin ${HOME} 2>/dev/null 2>/dev/null sed sed printf x=1 ${HOME}
+	'quoted text' sed grep printf | --verbose export test /usr/bin
+	-eu "$@" readonly "$1" /usr/bin test x=1 done grep
+/usr/bin $(pwd) && test $(pwd) cd sed test cd printf cd grep --verbose then test
+		test printf readonly ${HOME}
+	-eu printf 2>/dev/null -eu 'quoted text' cd cd 'quoted text'
+		readonly printf ${HOME} sed "$1" x=1 export ${HOME}
+	done 2>/dev/null awk done local $(pwd)
+${HOME} awk --verbose echo
+	grep echo && done --verbose 2>/dev/null 2>/dev/null
+	local 2>/dev/null awk export readonly $(pwd) /usr/bin "$1" sed export $(pwd)
+echo | 2>/dev/null awk 2>/dev/null | grep grep --verbose export
+	then 'quoted text' done 'quoted text' 'quoted text'
+		awk "$1" "$1" sed done export ${HOME} grep export echo 2>/dev/null $(pwd)
+	-eu x=1 "$1" done -eu 'quoted text' -eu printf echo test /usr/bin /usr/bin
+	-eu sed -eu --verbose
+	grep done 2>/dev/null "$@" ${HOME} && cd ${HOME} x=1 $(pwd) cd
+		awk printf x=1 ${HOME} $(pwd) -eu then
+		x=1 ${HOME} "$1" | cd 'quoted text' /usr/bin | export
+2>/dev/null readonly done readonly grep
+		printf cd x=1 export echo x=1 ${HOME} cd echo
+		2>/dev/null readonly done
+		"$@" then grep "$1" --verbose ${HOME} local
+done local /usr/bin then 'quoted text' printf $(pwd) ${HOME} printf x=1 sed
+	echo 'quoted text' then 2>/dev/null printf export sed
+then /usr/bin cd done done echo
+	$(pwd) sed "$@" 'quoted text' readonly | x=1 "$1" /usr/bin printf awk 'quoted text'
+		--verbose x=1 sed done && test
+		local x=1 then && then grep 2>/dev/null
+		2>/dev/null && | "$@" done "$1" echo sed -eu awk ${HOME} then echo ${HOME} readonly
+		| 2>/dev/null echo "$@" && grep done
+local /usr/bin printf "$@" | done 'quoted text' && x=1 /usr/bin -eu "$1" export
+	--verbose echo awk && "$1" grep --verbose printf
+awk then --verbose 2>/dev/null 'quoted text' then
+${HOME} awk "$@" "$1" printf &&
+		sed awk ${HOME} printf cd echo export "$1" done local done test
+		2>/dev/null echo sed "$1"
+		echo then local local 'quoted text' cd -eu $(pwd) printf test test cd -eu cd --verbose
+		2>/dev/null --verbose
+	awk ${HOME} awk awk "$@" 'quoted text' -eu --verbose 'quoted text' "$1" sed then
+sed /usr/bin | awk then
+		awk cd test -eu ${HOME} --verbose readonly
+printf -eu x=1 sed awk 'quoted text'
+	$(pwd) $(pwd) local done $(pwd) 'quoted text'
+		echo $(pwd) printf 'quoted text' 'quoted text'
+echo echo echo "$1" cd sed x=1 --verbose sed 2>/dev/null
+	/usr/bin "$@" | cd ${HOME} grep awk | 'quoted text' ${HOME} "$@" readonly -eu
+		sed | | export local ${HOME} sed local "$@" echo awk 'quoted text' -eu
+export && x=1 x=1 | 'quoted text' done done export local "$1" x=1
+	2>/dev/null done -eu "$1" | "$@" echo
+--verbose /usr/bin grep printf done
+	readonly 2>/dev/null echo && && 'quoted text' 'quoted text' --verbose
+	--verbose $(pwd) then /usr/bin "$1" -eu x=1 2>/dev/null "$1" echo
+	readonly test grep echo awk -eu 2>/dev/null "$@" done echo ${HOME}
+	awk && cd then ${HOME} awk readonly | cd printf echo
+	printf readonly "$@" sed --verbose grep
+	-eu printf grep printf x=1 "$1" grep export /usr/bin test
+		readonly 2>/dev/null sed readonly | "$@"
+		"$1" --verbose test $(pwd) sed --verbose
+		printf readonly -eu cd grep printf awk 2>/dev/null
+		printf "$@" cd x=1 ${HOME} grep cd 2>/dev/null awk
+	-eu "$1" test export 2>/dev/null 'quoted text'
+	$(pwd) "$1" | && test x=1 local && done
+		readonly "$@" sed printf /usr/bin cd /usr/bin then "$1" export
+	printf test $(pwd) printf done done
+	readonly awk $(pwd) --verbose && awk local $(pwd) awk then "$1" sed 'quoted text'
+	x=1 cd 'quoted text' readonly echo "$@" ${HOME} --verbose readonly grep then
+		x=1 readonly x=1 | | readonly done
+		&& export test readonly local $(pwd) "$1" 2>/dev/null local export 'quoted text'
+| ${HOME} -eu grep readonly $(pwd) readonly "$@" local
+	'quoted text' cd ${HOME} -eu $(pwd) cd cd test
+		/usr/bin | readonly $(pwd) echo && && "$1" 2>/dev/null awk awk 2>/dev/null
+	test export "$1" local 'quoted text' ${HOME}
+	/usr/bin 'quoted text' sed export sed && 'quoted text' cd /usr/bin printf /usr/bin
+		| grep | --verbose "$1" echo && then test -eu && printf "$@" 'quoted text'
+		local $(pwd) | local 'quoted text' x=1 -eu printf x=1 local
+		/usr/bin 'quoted text' 2>/dev/null test "$@" grep done 'quoted text'
+	2>/dev/null then export 'quoted text' 'quoted text' sed
+		"$@" awk | test x=1 2>/dev/null && awk export test ${HOME} 'quoted text'
+then "$@" awk | cd "$1" /usr/bin | -eu test test grep local
+	x=1 && readonly 'quoted text' ${HOME} ${HOME} local ${HOME}
+$(pwd) -eu awk grep sed awk export | && ${HOME}
+	-eu $(pwd) ${HOME} --verbose export export cd /usr/bin echo cd
+done test sed --verbose 'quoted text' awk then local
+		grep printf /usr/bin echo test cd export | local "$@" --verbose "$1" done
+		then $(pwd) then 'quoted text' 2>/dev/null test then /usr/bin 2>/dev/null cd
+	&& $(pwd) 2>/dev/null printf printf
+		"$@" -eu readonly --verbose 'quoted text' grep export
+		x=1 "$@" && $(pwd) 2>/dev/null cd --verbose && 2>/dev/null printf "$1" test 2>/dev/null
+| local -eu export /usr/bin then
+	"$@" "$1" grep "$1" 2>/dev/null echo --verbose
+	x=1 && && echo -eu $(pwd) $(pwd) && test 2>/dev/null "$1" 2>/dev/null sed
+	done grep test done export sed
+	'quoted text' readonly sed --verbose 'quoted text'
+		/usr/bin && sed export export sed test -eu awk "$@" 'quoted text' -eu
+	${HOME} && local test 2>/dev/null readonly -eu "$1" local cd sed 2>/dev/null
+	"$@" done sed | -eu -eu x=1 test cd ${HOME}
+echo x=1 -eu "$@" && -eu
+	"$@" 'quoted text' echo $(pwd) done readonly "$1"
+	readonly 2>/dev/null test && local printf && "$@" /usr/bin readonly
+then --verbose | test | echo cd
+		/usr/bin "$1" readonly ${HOME} export 'quoted text' awk printf --verbose readonly
+echo "$1" done /usr/bin ${HOME}
+		awk printf grep 2>/dev/null "$@"
+	awk local sed done grep "$1" 2>/dev/null
+	printf 2>/dev/null sed readonly /usr/bin ${HOME}
+		printf x=1 $(pwd) | "$1" done --verbose | -eu 'quoted text' 'quoted text'
+		cd cd readonly --verbose test export "$1"
+		grep | | readonly "$1" && /usr/bin
+		x=1 /usr/bin | local sed grep x=1 echo ${HOME} then cd sed "$1" -eu awk | | 'quoted text'
+&& --verbose "$@" -eu ${HOME} test 'quoted text'
+		echo "$1" ${HOME} && readonly readonly $(pwd) $(pwd) 2>/dev/null sed cd sed grep
+		awk test ${HOME} 2>/dev/null 'quoted text' | local grep && grep /usr/bin
+	-eu export /usr/bin /usr/bin "$1" | printf 2>/dev/null
+"$@" --verbose done "$@" -eu $(pwd) readonly $(pwd) local
+		${HOME} grep cd sed export done export 2>/dev/null 'quoted text'
+		$(pwd) "$1" 'quoted text' ${HOME} 2>/dev/null "$@" /usr/bin sed
+		sed echo 'quoted text' awk printf $(pwd) x=1 awk printf awk ${HOME} 'quoted text'
+		/usr/bin 2>/dev/null readonly local test export
+done cd awk 2>/dev/null
+		printf export echo echo
+done cd "$1" readonly $(pwd) 2>/dev/null
+		"$@" awk grep | 2>/dev/null "$1" ${HOME} printf cd sed "$@" local cd "$@" |
+echo && "$1" /usr/bin 2>/dev/null "$1"
+		'quoted text' 'quoted text' export 2>/dev/null
+"$@" 'quoted text' export /usr/bin
+done --verbose done local
+	test | printf ${HOME} local ${HOME} 2>/dev/null echo sed done 2>/dev/null
+test $(pwd) then 'quoted text' --verbose "$@" done test local done
+		&& printf "$@" | echo /usr/bin
+cd printf readonly x=1 cd && -eu readonly /usr/bin
+$(pwd) readonly then readonly -eu sed -eu local cd --verbose cd /usr/bin
+	&& sed -eu | "$1" "$1" 'quoted text' readonly readonly awk echo "$@" test -eu
+	x=1 awk local && cd cd local "$@" | then test "$1" | 'quoted text' 2>/dev/null
+$(pwd) done "$@" --verbose "$@" $(pwd) readonly -eu
+local 2>/dev/null readonly | && then awk grep done export printf awk "$1" ${HOME}
+echo readonly && export awk grep "$@" local done | cd readonly
+	"$@" -eu local && 2>/dev/null "$@" export -eu && test $(pwd) -eu
+		echo export 'quoted text' grep cd "$1" sed sed 'quoted text'
+		${HOME} echo test grep && 'quoted text' sed printf $(pwd) test "$@" x=1
+		$(pwd) -eu "$@" done x=1 echo
+		printf awk /usr/bin ${HOME} local then sed local test awk export grep
+		"$1" printf printf ${HOME} 'quoted text' 'quoted text' local export cd | echo -eu
+grep local sed printf &&
+cd sed | awk export then $(pwd) cd printf "$@" local && sed
+		test test "$1" local ${HOME} --verbose /usr/bin
+	local echo readonly grep local then 2>/dev/null "$@" awk sed then
+test 'quoted text' printf && awk export
+	x=1 grep printf export echo cd test
+	x=1 ${HOME} done -eu $(pwd) ${HOME} readonly 2>/dev/null
+		cd 'quoted text' /usr/bin awk ${HOME} 2>/dev/null 2>/dev/null
+grep cd cd x=1 | echo printf local 2>/dev/null cd grep && "$@" echo printf
+		-eu --verbose grep && grep done "$1" echo --verbose 'quoted text'
+		| $(pwd) done done "$1" echo echo export $(pwd)
+$(pwd) ${HOME} test local | 'quoted text' cd && local $(pwd) x=1 readonly done
+	-eu cd readonly printf "$@" && readonly cd "$1" | readonly 'quoted text'
+/usr/bin -eu "$@" "$@" /usr/bin && export "$1" echo printf ${HOME}
+readonly $(pwd) local "$1" | readonly "$@" -eu export /usr/bin export | "$1"
+	$(pwd) grep grep "$@" local local
+	cd | | local "$1" printf then -eu | done $(pwd) -eu |
+	test printf echo sed printf /usr/bin done --verbose echo echo
+	grep export 2>/dev/null printf readonly export done -eu readonly $(pwd) "$@"
+	export test sed $(pwd) 2>/dev/null $(pwd) sed local
+done cd sed 2>/dev/null done
+	--verbose /usr/bin readonly 'quoted text' 2>/dev/null sed readonly sed cd
+local sed -eu sed printf then done "$1"
+		test then /usr/bin ${HOME} --verbose | readonly x=1
+		-eu sed done sed local --verbose x=1 export 2>/dev/null
+		--verbose grep "$@" local "$@" | done test
+	readonly printf sed "$@" x=1 local $(pwd) local -eu /usr/bin local
+		test $(pwd) sed printf "$1"
+grep ${HOME} 2>/dev/null readonly printf "$@" grep export
+	"$1" "$1" "$@" --verbose then printf ${HOME} readonly
+local sed "$@" awk export && 'quoted text' -eu
+		"$1" $(pwd) local readonly done && readonly 'quoted text' cd && "$1" echo
+		$(pwd) test printf readonly
+awk done echo done cd x=1 --verbose then -eu
+		"$@" -eu sed "$1" x=1 done echo export x=1 export
+	'quoted text' readonly $(pwd) ${HOME} test "$1" -eu
+printf sed local local x=1 "$@" local readonly sed --verbose
+		| readonly local export $(pwd) /usr/bin export | $(pwd)
+local echo $(pwd) 2>/dev/null then && printf
+		printf test && awk printf cd echo sed $(pwd) -eu 2>/dev/null $(pwd) sed "$1"
+then "$@" ${HOME} cd ${HOME}
+&& export --verbose export
+test test && ${HOME} done x=1 export awk awk "$@" echo && /usr/bin echo export
+	local printf /usr/bin cd x=1 -eu done local grep | export
+	x=1 $(pwd) export && | grep 2>/dev/null ${HOME} x=1 grep
+done test /usr/bin ${HOME} ${HOME} export then 2>/dev/null
+local x=1 $(pwd) $(pwd) awk /usr/bin && | export && test "$1" "$@" "$@"
+		printf test echo -eu printf $(pwd)
+$(pwd) done cd && $(pwd) readonly awk "$@" test export grep
+done 'quoted text' printf test && sed ${HOME} 'quoted text'
+		$(pwd) ${HOME} echo | 'quoted text' --verbose printf "$@"
+		$(pwd) /usr/bin ${HOME} cd awk then cd -eu -eu done $(pwd)
+		local awk --verbose awk done
+		x=1 'quoted text' test 2>/dev/null
+cd ${HOME} "$1" 2>/dev/null 'quoted text' $(pwd)
+		test /usr/bin test ${HOME} done | ${HOME} && 'quoted text' --verbose
+| 2>/dev/null local "$1" cd ${HOME}
+	done "$@" $(pwd) x=1 local grep awk test test
+echo $(pwd) 'quoted text' /usr/bin export &&
+	'quoted text' done --verbose printf && grep done --verbose
+		then /usr/bin 'quoted text' sed printf echo grep 'quoted text' 2>/dev/null done
+		done test then sed "$1" then done
+		awk test echo x=1 "$@" ${HOME}
+"$@" printf test awk cd "$@" "$@" sed export
+	&& echo ${HOME} echo grep export --verbose /usr/bin
+local ${HOME} awk sed "$1" sed x=1 'quoted text' -eu local readonly sed
+	-eu "$@" test ${HOME} grep echo local
+		--verbose -eu /usr/bin sed sed /usr/bin
+		--verbose --verbose test -eu --verbose -eu cd
+		| awk awk -eu export /usr/bin sed -eu x=1
+	$(pwd) | readonly "$@" "$1" ${HOME}
+	-eu x=1 sed "$1" grep 2>/dev/null | -eu ${HOME}
+		${HOME} then ${HOME} $(pwd) /usr/bin
+	'quoted text' local grep local done echo cd then readonly /usr/bin "$1"
+2>/dev/null x=1 -eu test x=1 cd "$1" local "$1" | grep
+'quoted text' grep $(pwd) /usr/bin
+2>/dev/null --verbose "$@" x=1 'quoted text' /usr/bin echo x=1 --verbose
+		local readonly --verbose done cd /usr/bin test test /usr/bin -eu ${HOME}
+x=1 then done -eu awk done echo /usr/bin && printf --verbose
+		sed sed printf sed cd awk readonly
+		then "$1" done local local sed readonly --verbose 2>/dev/null "$1" "$1"
+&& -eu "$@" sed sed cd "$@" export x=1 sed "$@" "$@"
+		readonly "$1" --verbose export -eu x=1 awk export x=1 | 'quoted text'
+	then sed 'quoted text' grep sed export 'quoted text'
+		-eu export 'quoted text' export then -eu grep local 2>/dev/null
+"$@" && cd 'quoted text' local export "$@" grep 'quoted text' "$@" cd
+	--verbose echo local echo "$1" --verbose -eu ${HOME}
+		-eu --verbose && echo export x=1 then | cd then ${HOME}
+	-eu grep cd awk printf | sed ${HOME} readonly
+	"$@" test export $(pwd) 2>/dev/null "$1" 2>/dev/null
+done done -eu test | "$1" grep grep echo printf local --verbose && then
+	grep done awk "$@" cd 'quoted text' test local $(pwd) ${HOME} then
+		/usr/bin awk printf ${HOME} done
+	printf test sed | && && grep 'quoted text' echo test export 'quoted text'
+&& -eu 'quoted text' -eu "$@" x=1
+	$(pwd) --verbose readonly echo 2>/dev/null | --verbose
+/usr/bin 'quoted text'
+local readonly sed printf ${HOME} && | printf then /usr/bin 'quoted text'
+	local export echo awk printf export test local
+	done printf awk 2>/dev/null local x=1 printf $(pwd) sed | && test sed
+-eu awk "$@" x=1 awk readonly x=1 local "$1" grep -eu local x=1 --verbose
+	--verbose cd -eu readonly --verbose grep "$@" awk x=1
+		then local grep readonly /usr/bin echo --verbose cd echo export
+		'quoted text' --verbose 'quoted text'
+done cd --verbose && ${HOME} && done sed local --verbose
+		--verbose awk -eu then --verbose 2>/dev/null sed x=1 -eu awk readonly --verbose
+cd ${HOME} 'quoted text' cd awk $(pwd) grep then --verbose 2>/dev/null
+then "$@" printf grep echo
+&& printf "$1" --verbose export
+	"$@" export 'quoted text' readonly cd grep
+-eu then sed readonly /usr/bin
+--verbose test test -eu 'quoted text'
+	/usr/bin /usr/bin done --verbose export --verbose
+	awk 'quoted text' sed "$1" && grep readonly cd echo x=1 sed export grep
+'quoted text' ${HOME} $(pwd) && local 2>/dev/null then
+		-eu "$@" printf ${HOME}
+		"$1" cd 2>/dev/null 'quoted text' 'quoted text' | -eu
+${HOME} sed then -eu "$@" --verbose done printf 2>/dev/null 2>/dev/null
+"$@" /usr/bin 2>/dev/null cd done readonly cd | ${HOME} -eu export
+		2>/dev/null printf 2>/dev/null x=1 grep local then /usr/bin --verbose
+	readonly 'quoted text' && ${HOME} "$@" --verbose
+	| echo -eu readonly readonly sed echo readonly test 'quoted text'
+		/usr/bin sed 2>/dev/null 2>/dev/null done "$@" export printf readonly x=1
+		--verbose -eu local | printf cd $(pwd)
+&& awk export echo local echo awk awk 'quoted text' x=1 2>/dev/null
+	awk $(pwd) ${HOME} grep -eu --verbose echo ${HOME}
+	/usr/bin grep | awk echo export then "$1" awk printf
+test export x=1 done done && "$1" readonly sed printf 'quoted text'
+	echo cd 'quoted text' ${HOME} "$@" local export
+&& grep local -eu sed printf --verbose 2>/dev/null ${HOME} test /usr/bin
+	awk sed echo done awk 2>/dev/null 'quoted text'
+		then sed printf printf sed "$@" /usr/bin 'quoted text' test 'quoted text'
+	'quoted text' && 'quoted text' then local
+	$(pwd) local printf local done printf done echo "$@" 'quoted text'
+		&& /usr/bin readonly local sed cd 2>/dev/null
+sed | $(pwd) done | done "$1" done
+	$(pwd) --verbose "$1" 2>/dev/null "$@" sed echo -eu readonly 2>/dev/null
+2>/dev/null printf "$@" then ${HOME} sed printf 2>/dev/null x=1 sed $(pwd) done
+		sed cd sed export printf x=1 "$1" grep sed echo
+	test --verbose sed echo sed $(pwd)
+| local $(pwd) ${HOME} sed 'quoted text' sed ${HOME} 'quoted text' && | 2>/dev/null
+local $(pwd) awk /usr/bin sed test
+		$(pwd) && then -eu ${HOME} grep
+| echo done $(pwd) "$1" /usr/bin printf local readonly
+		cd sed readonly then ${HOME}
+		-eu then ${HOME} $(pwd) echo local $(pwd) sed
+export grep echo readonly done "$1" local 2>/dev/null
+	"$1" sed local 2>/dev/null "$@" ${HOME} | ${HOME} ${HOME} /usr/bin
+echo $(pwd) cd x=1 "$1" && --verbose
+		--verbose "$@" readonly cd then --verbose then
+/usr/bin x=1 test "$@" -eu printf "$1" "$1" test "$1" x=1 export
+then x=1 test "$1" test sed
+echo done export local -eu printf sed printf local export test && --verbose
+	--verbose local "$1" --verbose grep 'quoted text' echo 'quoted text' ${HOME}
+		grep $(pwd) printf grep /usr/bin printf cd 'quoted text' then printf
+export echo -eu -eu done awk then 'quoted text' done test -eu
+		/usr/bin awk export done ${HOME} && readonly 2>/dev/null awk 'quoted text'
+		grep local cd export echo test
+"$1" printf awk export /usr/bin local
+$(pwd) x=1 x=1 local export "$1" test awk test --verbose
+echo && /usr/bin "$@" awk
+awk sed -eu "$@" && readonly /usr/bin | 2>/dev/null x=1 'quoted text'
+	awk awk "$@" -eu 'quoted text'
+	| readonly awk cd awk test
+	local --verbose cd /usr/bin printf x=1 echo "$@" ${HOME} test awk local
+		${HOME} sed "$@" then 'quoted text' awk
+test "$@" local printf | /usr/bin
+		'quoted text' awk grep -eu ${HOME} /usr/bin readonly -eu "$@" printf
+		"$1" sed awk export local
+	test test $(pwd) "$1"
+sed readonly "$1" then export
+	grep -eu cd x=1 ${HOME} printf
+--verbose x=1 && 2>/dev/null | awk local 2>/dev/null awk then -eu ${HOME} "$1"
+		-eu -eu 2>/dev/null cd "$@" then "$@" x=1 | export ${HOME}
+export ${HOME} ${HOME} awk sed readonly echo then test $(pwd) ${HOME}
+| | test done grep sed --verbose then -eu test | done "$@" 'quoted text' awk test
+	test local | --verbose local cd /usr/bin then "$@" 'quoted text' ${HOME}
+x=1 awk ${HOME} printf x=1 $(pwd) awk done
+/usr/bin then then readonly test
+		${HOME} local -eu grep 2>/dev/null test test ${HOME} /usr/bin
+	2>/dev/null --verbose printf
+sed | printf "$1" && | awk grep echo
+	2>/dev/null | then awk then echo x=1
+--verbose /usr/bin done
+		--verbose -eu 'quoted text' ${HOME} printf /usr/bin ${HOME}
+local -eu | sed && echo local then | "$1"
+	echo sed grep 2>/dev/null done grep
+cd /usr/bin -eu x=1 then readonly local && "$@"
+readonly 2>/dev/null /usr/bin 2>/dev/null "$1" | done done x=1 2>/dev/null printf
+	then export export --verbose local /usr/bin && test |
+		x=1 echo 2>/dev/null x=1 echo -eu then local printf --verbose ${HOME} | x=1
+	sed cd "$1" awk 'quoted text' awk 'quoted text' && --verbose sed awk export
+		&& export --verbose | "$1" 2>/dev/null
+		--verbose test /usr/bin $(pwd) "$@" x=1 $(pwd) done x=1 "$@" readonly 'quoted text'
+	2>/dev/null cd cd printf printf grep && export test
+		2>/dev/null && "$1" /usr/bin awk && test local then -eu awk -eu --verbose "$1"
+cd 'quoted text' done sed 'quoted text'
+		readonly done local -eu local echo /usr/bin 'quoted text'
+sed local --verbose x=1
+	test -eu cd then -eu -eu awk 2>/dev/null
+		| export done sed sed cd x=1 echo ${HOME} --verbose x=1 && awk "$@"
+	&& done export ${HOME} "$@" "$1" local /usr/bin
+	sed cd grep -eu "$1" cd 'quoted text' export test
+		--verbose -eu | grep "$1" cd ${HOME} ${HOME} test
+	echo test then "$1" awk ${HOME} echo sed
+awk "$@" "$@" 'quoted text'
+	x=1 -eu done | --verbose $(pwd) 'quoted text' echo grep && sed -eu printf
+-eu | x=1 2>/dev/null "$1" test done | readonly then
+| --verbose readonly awk "$1" "$@" cd -eu cd test 2>/dev/null
+		$(pwd) sed done printf 2>/dev/null
+'quoted text' "$@" grep
+	--verbose x=1 /usr/bin --verbose | 'quoted text'
+then 'quoted text' cd "$1" | awk echo test grep 2>/dev/null
+	export cd "$1" --verbose 2>/dev/null
+		then echo && done echo sed test local
+export "$@" "$1" --verbose
+		done $(pwd) done 2>/dev/null ${HOME} 'quoted text' 'quoted text'
+local /usr/bin 2>/dev/null "$1" 2>/dev/null
+"$1" && -eu echo grep export
+		/usr/bin printf --verbose then ${HOME} &&
+		export local "$1" "$@" "$@" awk "$@" x=1
+	"$@" /usr/bin | echo grep "$1" "$1" then "$1" ${HOME}
+	2>/dev/null echo sed awk printf /usr/bin export --verbose
+awk "$1" sed done $(pwd) sed | /usr/bin && done test $(pwd) grep --verbose
+&& local "$@" ${HOME} $(pwd) 'quoted text'
+"$@" ${HOME} -eu "$1" export && 'quoted text' cd $(pwd) grep
+done then local && echo export --verbose printf ${HOME}
+printf grep awk x=1 test && then -eu x=1 2>/dev/null
+test /usr/bin awk ${HOME} local sed
+		printf && echo 'quoted text' grep
+&& export done -eu $(pwd) /usr/bin 'quoted text' 'quoted text'
+		awk then export "$1" local echo 2>/dev/null -eu ${HOME} ${HOME} ${HOME} printf
+	awk 'quoted text' ${HOME} readonly -eu "$@" /usr/bin readonly done x=1 awk awk
+	"$@" local grep x=1 printf | -eu -eu printf /usr/bin
+		/usr/bin $(pwd) local echo printf local export "$@" x=1 test test -eu x=1 readonly
+then 'quoted text' x=1 "$1" "$@" "$@"
+		awk echo awk cd --verbose awk cd sed done readonly --verbose
+	printf -eu "$@" 'quoted text' | && 2>/dev/null local test --verbose local
+		cd --verbose done 'quoted text' | 'quoted text' "$1" test "$@" cd x=1 'quoted text'
+	printf printf --verbose grep | cd -eu echo echo grep readonly then
+		printf "$@" printf x=1 done
+		then 'quoted text' | -eu test x=1 /usr/bin grep -eu export grep $(pwd)
+	/usr/bin -eu "$1" 2>/dev/null sed x=1 /usr/bin
+		done export -eu 2>/dev/null 'quoted text' test x=1 printf "$@" "$1" echo --verbose
+		readonly ${HOME} && awk "$1" "$@" done grep
+	&& local | && "$1" | then ${HOME}
+then x=1 done x=1 x=1 sed "$@"
+	readonly awk export test awk readonly x=1
+		--verbose awk "$@" --verbose
+	"$1" | "$@" "$@" echo $(pwd)
+&& /usr/bin awk ${HOME} "$1" cd awk cd export 2>/dev/null local /usr/bin x=1
+grep export --verbose /usr/bin /usr/bin
+	then x=1 done ${HOME} readonly
+		&& --verbose printf printf x=1 local awk "$1"
+	done | -eu done awk x=1
+	$(pwd) 'quoted text' --verbose printf then echo export && grep
+	| && $(pwd) && "$@" echo -eu && done sed readonly cd readonly /usr/bin
+cd grep 'quoted text' echo
+/usr/bin test "$1" 2>/dev/null --verbose readonly sed
+'quoted text' 'quoted text' sed done printf && printf test && printf awk
+export $(pwd) -eu /usr/bin echo echo readonly
+done "$1" cd cd | --verbose awk 2>/dev/null "$1"
+		readonly grep local cd done $(pwd) x=1 then | | cd done printf /usr/bin /usr/bin
+--verbose "$1" export grep && test then
+local readonly -eu "$@" awk 'quoted text' done
+export grep ${HOME} -eu
+x=1 --verbose "$1" 'quoted text' -eu readonly awk
+	done --verbose cd && "$@" 'quoted text' echo
+		grep 'quoted text' then 2>/dev/null cd cd export 2>/dev/null -eu
+grep cd grep awk export 2>/dev/null 'quoted text' $(pwd) "$@" -eu -eu 2>/dev/null
+		done --verbose $(pwd) && $(pwd) export cd --verbose test | then
+		&& test /usr/bin echo export awk -eu "$1" awk done export /usr/bin 'quoted text'
+"$1" cd $(pwd) readonly -eu "$1" x=1 sed then readonly --verbose ${HOME} echo
+		sed printf $(pwd) export
+	export sed "$@" export ${HOME} printf "$@" sed export export
+test 'quoted text' local "$1" && && test test | "$1" | sed
+echo then sed "$@" 'quoted text' 'quoted text' grep readonly "$@" $(pwd)
+"$1" && x=1 printf --verbose --verbose
+readonly "$@" x=1 --verbose export sed x=1 local "$@" sed "$@" then &&
+done awk printf | 'quoted text' x=1 /usr/bin printf export cd
+		awk awk | done -eu local readonly ${HOME} -eu readonly
+		done test ${HOME} local -eu readonly local sed echo export readonly printf
+local "$@" 'quoted text' && | | printf $(pwd) sed cd --verbose -eu
+	&& "$@" $(pwd) done export
+		local sed local $(pwd) /usr/bin && x=1 awk export awk done
+	&& 'quoted text' done export "$1"
+&& | readonly /usr/bin sed 'quoted text'
+		then "$@" awk "$1" && awk test /usr/bin "$1"
+		'quoted text' /usr/bin -eu ${HOME} grep && test /usr/bin export local -eu
+	"$@" done printf sed 'quoted text' echo printf printf && local --verbose then &&
+	test | 2>/dev/null printf printf awk && grep then
+	$(pwd) $(pwd) -eu -eu then local done /usr/bin 2>/dev/null readonly grep -eu
+2>/dev/null 2>/dev/null 2>/dev/null && done printf
+	$(pwd) 'quoted text' "$1" sed readonly
+| x=1 "$1" --verbose && | then
+	&& readonly cd "$@" echo 2>/dev/null test local &&
+		grep grep test echo export test export cd awk && echo
+		x=1 sed done -eu awk | $(pwd) awk readonly
+		--verbose "$1" done test --verbose
+	test "$@" "$@" awk -eu export grep printf
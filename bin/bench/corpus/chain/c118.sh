@@ -0,0 +1,2001 @@
+echo export ${HOME} export x=1 && cd readonly "$1" local $(pwd) export
+	&& printf test sed --verbose | printf
+	$(pwd) readonly then local -eu sed -eu | "$@"
+2>/dev/null x=1 --verbose
+	"$@" "$1" x=1 export 2>/dev/null
+		export "$@" cd && "$1"
+/usr/bin x=1 -eu awk $(pwd) /usr/bin $(pwd) then done
+		test $(pwd) sed then && then ${HOME}
+		x=1 then /usr/bin "$1" sed done 'quoted text'
+	"$1" test done ${HOME} "$@" readonly grep | awk awk && ${HOME} /usr/bin printf
+		cd echo export -eu /usr/bin x=1 -eu printf 'quoted text' /usr/bin | then
+	"$1" -eu && done sed && | echo && 'quoted text' readonly $(pwd) then ${HOME}
+	'quoted text' -eu && grep test export echo x=1 echo done
+		2>/dev/null awk "$1" -eu awk
+		/usr/bin local $(pwd) sed $(pwd)
+	readonly done cd then done local sed awk then ${HOME} "$1" --verbose
+		cd "$@" | then readonly test cd sed -eu 2>/dev/null
+		test local echo 'quoted text' $(pwd)
+		readonly export awk done $(pwd) --verbose then "$1" cd "$@" printf
+	awk "$1" --verbose 'quoted text' cd awk done 'quoted text' done
+		printf 2>/dev/null $(pwd) export sed ${HOME} 2>/dev/null readonly readonly printf
+		test done "$1" done readonly && echo printf 'quoted text' /usr/bin x=1 export
+		&& $(pwd) test && "$1" && | && x=1 --verbose /usr/bin x=1 2>/dev/null 2>/dev/null
+		sed sed x=1 sed "$@" test
+printf echo readonly
+		&& | printf --verbose readonly $(pwd) $(pwd) grep export then
+| --verbose sed 'quoted text' 'quoted text'
+		"$1" --verbose cd -eu --verbose 2>/dev/null x=1
+		$(pwd) cd $(pwd) grep grep
+		&& | "$1" | done x=1 export export $(pwd) | ${HOME} | /usr/bin /usr/bin
+then test && $(pwd) 2>/dev/null
+	local printf local sed $(pwd) $(pwd) readonly x=1
+		$(pwd) printf local done "$@"
+cd 2>/dev/null $(pwd) -eu test
+	awk 2>/dev/null done 'quoted text' && then echo -eu local then x=1 echo done
+then echo echo local "$@" done x=1 | then -eu | && | "$1" sed
+		$(pwd) printf x=1 /usr/bin -eu export $(pwd) echo local
+		awk grep printf test && local echo && echo
+	done "$@" $(pwd) 2>/dev/null
+'quoted text' cd awk && ${HOME} echo
+	printf x=1 $(pwd) x=1 "$@" then x=1 x=1 | readonly "$1" x=1
+		&& x=1 readonly -eu -eu awk then awk ${HOME} ${HOME} -eu local --verbose -eu
+$(pwd) && done "$1" awk printf readonly 'quoted text'
+then done grep && 'quoted text'
+		/usr/bin "$@" test x=1 export
+	sed awk awk 'quoted text' ${HOME} then readonly
+	'quoted text' awk printf /usr/bin 'quoted text' done ${HOME} ${HOME} test
+	-eu $(pwd) "$1" "$1" printf awk
+		done | sed awk done export readonly
+export -eu x=1 local local ${HOME} grep
+x=1 cd x=1 && ${HOME}
+		/usr/bin printf "$@" then 2>/dev/null
+		x=1 export && sed export printf /usr/bin
+		then export then done $(pwd) export sed sed
+	| --verbose /usr/bin | local x=1 $(pwd) | export ${HOME}
+		awk grep 'quoted text' sed 2>/dev/null $(pwd) "$@" |
+	2>/dev/null printf | local ${HOME} echo grep --verbose grep -eu
+		printf && "$1" readonly sed then $(pwd) cd && done done | echo
+printf 'quoted text' /usr/bin x=1 2>/dev/null "$1" test awk sed ${HOME} --verbose
+done "$1" echo "$1" 'quoted text'
+-eu --verbose x=1 readonly export --verbose then awk echo | 2>/dev/null -eu 2>/dev/null
+export $(pwd) then $(pwd) 2>/dev/null printf ${HOME}
+	| done --verbose "$@" 2>/dev/null -eu local awk 2>/dev/null
+		then ${HOME} awk "$@" x=1 -eu && sed grep printf echo echo export "$1" sed --verbose
+		awk && done -eu /usr/bin 'quoted text' local --verbose readonly /usr/bin
+		-eu -eu done printf cd grep && --verbose 'quoted text'
+export -eu | 2>/dev/null ${HOME}
+		done 'quoted text' echo local done 'quoted text'
+		test awk awk ${HOME} cd sed "$@" $(pwd) local ${HOME}
+		/usr/bin 'quoted text' ${HOME} sed echo "$1" echo done 'quoted text' x=1
+grep local 2>/dev/null $(pwd) printf
+		| echo then local grep readonly
+		awk 2>/dev/null ${HOME} test | 'quoted text' "$@"
+	-eu | $(pwd) printf test then 2>/dev/null printf done
+	echo && ${HOME} cd test readonly ${HOME} awk -eu printf echo "$1" echo then
+		then readonly local $(pwd) 2>/dev/null echo readonly && grep sed echo ${HOME}
+	echo cd ${HOME} $(pwd) "$1" --verbose sed test cd && $(pwd) "$1" ${HOME}
+	printf "$@" /usr/bin /usr/bin "$@" "$1" echo
+		--verbose readonly echo $(pwd) test grep grep && export then
+		then 'quoted text' | && grep | --verbose
+	| 2>/dev/null ${HOME} | then -eu "$1" $(pwd) "$@" "$1" /usr/bin sed
+		2>/dev/null "$@" ${HOME} "$@" 2>/dev/null awk --verbose && then "$1"
+printf echo readonly | "$1" echo "$1" && sed
+		readonly local $(pwd) export --verbose
+readonly "$@" readonly x=1 && local echo sed printf "$@"
+		$(pwd) $(pwd) $(pwd) sed test cd cd readonly -eu --verbose
+		done local "$1" local 'quoted text' && done $(pwd) then --verbose x=1
+grep echo then -eu ${HOME} grep --verbose test printf
+	-eu then export local && cd | then then test 'quoted text' printf
+		cd then && awk readonly local --verbose
+	grep printf done done readonly
+		test sed /usr/bin && awk $(pwd) then local 2>/dev/null
+echo local 'quoted text' sed "$@"
+/usr/bin x=1 $(pwd) local printf
+${HOME} $(pwd) local grep cd 2>/dev/null
+	"$1" export $(pwd) printf
+x=1 ${HOME} then sed local "$1" cd -eu && "$@" then --verbose "$@" 'quoted text'
+printf && then x=1 export -eu awk cd local
+		awk -eu test 2>/dev/null $(pwd) local $(pwd) 2>/dev/null
+		$(pwd) && -eu 'quoted text' printf
+		cd /usr/bin "$@" done --verbose 2>/dev/null awk export local readonly grep ${HOME}
+	echo | readonly "$1" sed -eu -eu then /usr/bin
+		"$1" -eu printf export cd
+	&& sed 'quoted text' export
+	grep "$1" | printf x=1 | export grep then x=1
+	done echo cd sed /usr/bin --verbose test readonly
+	echo 2>/dev/null cd grep cd export "$1" 2>/dev/null
+		done /usr/bin 'quoted text' "$1" -eu done sed then --verbose cd readonly
+printf /usr/bin awk --verbose awk export x=1
+	/usr/bin ${HOME} readonly -eu "$1" done
+'quoted text' echo /usr/bin
+	$(pwd) sed readonly && done grep &&
+	cd then "$@" --verbose local readonly ${HOME} &&
+		--verbose awk "$1" done test --verbose then test
+		"$1" echo sed x=1 "$@" --verbose
+		sed --verbose $(pwd) done readonly | readonly /usr/bin echo test grep printf
+	${HOME} grep export then && then test grep then
+	&& /usr/bin -eu awk 2>/dev/null $(pwd) readonly
+2>/dev/null x=1 ${HOME} done -eu x=1 --verbose done $(pwd)
+		test printf then && "$@" 2>/dev/null "$@" grep x=1 then "$@" readonly && then
+	test "$@" awk done && export -eu "$@" 'quoted text' | sed
+	echo awk then --verbose
+	sed test x=1 --verbose 2>/dev/null awk | grep /usr/bin "$1" done /usr/bin
+		done /usr/bin done && | sed /usr/bin printf "$@" x=1 /usr/bin
+${HOME} 'quoted text' 'quoted text'
+	${HOME} --verbose $(pwd) "$@" done then ${HOME} &&
+echo readonly ${HOME} 'quoted text' export
+	readonly grep awk sed readonly local
+printf --verbose readonly /usr/bin /usr/bin
+'quoted text' grep grep "$@" echo done local "$@" && "$@" grep /usr/bin local &&
+	test echo /usr/bin -eu echo $(pwd) 2>/dev/null
+		local 2>/dev/null | $(pwd) | grep sed printf cd readonly echo | --verbose cd done
+	"$@" cd "$1" /usr/bin -eu then ${HOME} $(pwd) x=1 'quoted text'
+		sed export export --verbose test ${HOME} "$@" 'quoted text'
+		$(pwd) local && export then "$1"
+	sed sed then -eu --verbose /usr/bin --verbose export done $(pwd) | /usr/bin
+	/usr/bin 'quoted text' $(pwd) printf readonly --verbose
+		cd sed | -eu "$@" "$1" local 'quoted text' grep | readonly && --verbose
+		printf awk $(pwd) grep printf 'quoted text' x=1 --verbose test "$@" then
+test && printf cd /usr/bin printf sed awk test | 'quoted text' printf
+x=1 local then awk $(pwd) "$1" then "$@"
+		--verbose export grep grep
+	"$@" "$@" ${HOME} ${HOME} done
+sed done printf --verbose && -eu
+export export --verbose awk grep export awk done ${HOME} test --verbose
+"$1" "$@" "$@" "$1" readonly cd | x=1 "$1" sed "$1" awk printf
+		${HOME} && "$1" echo 2>/dev/null sed | "$1" 2>/dev/null
+		local /usr/bin then 2>/dev/null grep "$@" -eu local
+	echo awk /usr/bin awk --verbose done && readonly
+	${HOME} /usr/bin local local
+${HOME} echo echo x=1 local | -eu awk "$1" 2>/dev/null --verbose local
+readonly local "$@" 2>/dev/null 'quoted text' "$1" "$@" 'quoted text'
+		$(pwd) --verbose readonly | 'quoted text' $(pwd) | "$1" echo readonly
+	done ${HOME} | test /usr/bin export awk sed done ${HOME} x=1 done
+&& echo -eu -eu awk | awk local | /usr/bin
+		test grep local /usr/bin
+grep sed done | sed x=1 sed /usr/bin && test export sed
+	export sed sed grep awk grep echo && export -eu "$1" | then "$1" cd then "$@"
+		${HOME} && "$@" -eu 'quoted text'
+		printf printf "$@" cd $(pwd) /usr/bin && done awk readonly awk
+		2>/dev/null sed cd "$@" grep && 2>/dev/null
+printf /usr/bin then printf "$@" test local local grep
+| -eu awk awk done echo 2>/dev/null
+readonly && cd test "$1" done readonly 2>/dev/null "$1" sed awk | && 2>/dev/null
+	cd cd | cd -eu echo "$1" --verbose "$1"
+		printf sed echo /usr/bin sed x=1 'quoted text' local
+	test 'quoted text' x=1 2>/dev/null
+		printf "$@" x=1 cd done /usr/bin "$1" awk "$@" grep grep 2>/dev/null export then
+local "$@" -eu export ${HOME} -eu local $(pwd) "$1" ${HOME} cd
+	"$1" readonly 2>/dev/null done "$@"
+	awk printf $(pwd) "$@" &&
+cd local echo ${HOME} --verbose done x=1 grep
+		${HOME} grep readonly grep && then grep --verbose
+	| /usr/bin --verbose export
+	local echo local ${HOME} test done 'quoted text'
+		then | grep grep $(pwd) cd 'quoted text' local "$1" 2>/dev/null -eu test
+		echo 'quoted text' cd local | awk
+cd test test "$@" sed $(pwd) awk done
+	/usr/bin -eu -eu test ${HOME} test x=1 then test awk | then cd readonly
+"$1" printf $(pwd) then test /usr/bin cd grep export
+		readonly sed printf echo done $(pwd) /usr/bin sed then sed "$@"
+	&& test ${HOME} $(pwd) 2>/dev/null readonly grep -eu 'quoted text'
+--verbose x=1 printf --verbose /usr/bin then awk local grep done /usr/bin 'quoted text'
+"$@" cd test "$@" x=1
+		"$@" ${HOME} printf 'quoted text' "$1" test --verbose ${HOME} local $(pwd)
+	&& x=1 grep cd && sed && -eu local done done "$1" echo sed /usr/bin
+	$(pwd) "$1" "$@" grep $(pwd) echo awk | $(pwd) cd /usr/bin 'quoted text'
+		cd 2>/dev/null test "$@"
+test && printf grep /usr/bin
+	&& | 'quoted text' ${HOME} then cd echo --verbose && x=1 "$1" -eu export &&
+$(pwd) echo local -eu 'quoted text' && printf
+		&& sed x=1 --verbose grep --verbose "$@" sed "$@" then test cd readonly local
+/usr/bin done test && "$@" cd $(pwd)
+	local readonly && | grep $(pwd) --verbose done test --verbose
+local cd -eu | && && --verbose "$@" | -eu ${HOME} -eu ${HOME} && done export
+readonly --verbose | 2>/dev/null && export sed -eu cd "$1" local sed echo
+		done sed export $(pwd) | readonly /usr/bin "$1" printf
+		sed awk --verbose /usr/bin readonly &&
+	printf 2>/dev/null | grep readonly $(pwd) "$1"
+		2>/dev/null done $(pwd)
+	--verbose 2>/dev/null readonly local "$1" $(pwd)
+"$@" -eu --verbose printf 'quoted text' --verbose
+'quoted text' then x=1 export done sed grep | sed grep awk /usr/bin sed printf
+&& x=1 "$@" 'quoted text' &&
+2>/dev/null "$1" cd done x=1 "$1" -eu 'quoted text'
+	-eu export "$@" cd grep "$1" printf "$@" /usr/bin && --verbose test /usr/bin
+	sed printf then printf test test
+	export | 'quoted text'
+	grep --verbose ${HOME} echo /usr/bin export then 'quoted text'
+--verbose awk done sed done printf
+x=1 sed sed && x=1 test && 'quoted text' grep "$1" 2>/dev/null export
+	/usr/bin --verbose test test
+-eu export local readonly
+	2>/dev/null done readonly && then readonly awk sed readonly ${HOME} --verbose
+		$(pwd) /usr/bin ${HOME} /usr/bin
+/usr/bin local readonly test readonly /usr/bin 2>/dev/null
+		readonly "$@" 2>/dev/null && --verbose | 'quoted text'
+		$(pwd) export 'quoted text' readonly "$@" printf x=1 "$1" "$@" -eu ${HOME}
+grep done 'quoted text' sed $(pwd)
+		| readonly grep && && $(pwd) printf "$@" cd | 2>/dev/null echo echo | 'quoted text'
+	2>/dev/null --verbose 'quoted text' $(pwd) printf 2>/dev/null done && $(pwd)
+done 'quoted text' printf local "$1" 2>/dev/null then echo test
+		local -eu | | done 'quoted text' 2>/dev/null -eu --verbose readonly | grep
+done $(pwd) echo && cd test readonly
+		x=1 --verbose "$1" awk printf 2>/dev/null
+	local sed export printf cd printf 'quoted text'
+	local $(pwd) 2>/dev/null | ${HOME} /usr/bin sed "$1" --verbose -eu done cd
+$(pwd) sed echo x=1 /usr/bin $(pwd) test && cd 2>/dev/null 2>/dev/null
+	--verbose /usr/bin --verbose
+"$1" /usr/bin export sed sed echo | 'quoted text' test
+	x=1 "$@" grep -eu 'quoted text' 2>/dev/null
+test "$1" awk sed 2>/dev/null export echo sed grep
+'quoted text' /usr/bin
+/usr/bin && grep then -eu awk test /usr/bin sed "$@" export awk --verbose "$@" "$1"
+sed 2>/dev/null "$@" local then | cd $(pwd) ${HOME} | readonly
+		cd sed && "$1" cd grep readonly sed ${HOME}
+		--verbose /usr/bin --verbose "$1" && 'quoted text' /usr/bin
+		then export && cd sed test $(pwd)
+		printf test | /usr/bin readonly readonly
+$(pwd) done export grep export 'quoted text' readonly
+	&& 'quoted text' ${HOME} test x=1 local -eu sed x=1
+cd 2>/dev/null "$@" done "$@" ${HOME}
+		local local awk x=1 $(pwd) $(pwd) | | ${HOME} readonly x=1 "$1" sed readonly
+	$(pwd) cd export --verbose done done "$@"
+	done sed grep sed "$1" sed readonly readonly printf /usr/bin
+		| grep "$1" | local 'quoted text'
+		printf 2>/dev/null done then && ${HOME}
+		readonly -eu "$1" --verbose 2>/dev/null export then "$1" 2>/dev/null
+| ${HOME} "$@" readonly local sed && grep
+	$(pwd) "$1" then | /usr/bin grep /usr/bin local
+		then --verbose grep test echo && ${HOME} "$1" local "$1"
+		done $(pwd) cd then && sed
+		x=1 test --verbose $(pwd) ${HOME} test awk then /usr/bin echo | test $(pwd)
+/usr/bin && "$@" sed "$@" readonly done $(pwd) grep
+	x=1 && grep done 2>/dev/null x=1 then x=1 grep x=1 "$@"
+	&& "$1" && && | grep -eu awk $(pwd) test
+'quoted text' then printf --verbose x=1 sed --verbose -eu 2>/dev/null &&
+/usr/bin -eu "$@" test 2>/dev/null readonly sed | printf done $(pwd) "$1"
+	${HOME} awk --verbose
+$(pwd) && test grep $(pwd) test /usr/bin local sed awk /usr/bin 'quoted text'
+"$1" /usr/bin grep $(pwd) -eu "$1" done
+sed ${HOME} awk 2>/dev/null 2>/dev/null
+	local | sed done echo printf x=1 'quoted text' export printf -eu export
+export $(pwd) awk sed x=1 readonly done /usr/bin "$@" sed /usr/bin
+"$@" readonly grep cd local "$1" cd "$1" 'quoted text'
+		cd && local test local /usr/bin
+--verbose local "$1" /usr/bin cd then && | 2>/dev/null "$@" echo
+	--verbose "$1" 2>/dev/null readonly 2>/dev/null then x=1 export
+	/usr/bin $(pwd) local "$@" local
+awk 'quoted text' done && awk ${HOME}
+--verbose | x=1 x=1 echo "$@" readonly
+'quoted text' && 'quoted text'
+	export printf --verbose 2>/dev/null | then && then echo |
+		test ${HOME} readonly grep cd then 'quoted text' ${HOME} /usr/bin echo
+readonly test $(pwd) cd && test -eu
+export "$@" /usr/bin 2>/dev/null -eu --verbose -eu grep -eu readonly
+	sed test printf x=1 && x=1 grep local cd sed export then sed awk test $(pwd)
+	-eu $(pwd) -eu then echo readonly
+$(pwd) --verbose then $(pwd) "$@" sed printf "$@" awk done $(pwd)
+	${HOME} test grep "$1" sed
+echo | "$1" export readonly awk && "$1" 2>/dev/null 'quoted text'
+	done sed echo cd local awk local 'quoted text'
+sed sed x=1 && readonly local
+	$(pwd) /usr/bin && readonly && "$1" x=1
+x=1 $(pwd) sed cd export done x=1 "$@" sed test /usr/bin x=1 sed grep x=1 then --verbose
+	export grep && && cd 2>/dev/null printf
+export && x=1 ${HOME} 2>/dev/null -eu echo &&
+		test | grep then x=1 --verbose 'quoted text' sed | $(pwd)
+		export 'quoted text' --verbose 'quoted text'
+	| -eu --verbose --verbose "$1" then done | ${HOME} | grep local readonly
+-eu then -eu /usr/bin "$1" $(pwd) 2>/dev/null echo 2>/dev/null && -eu
+	${HOME} done x=1 export -eu 'quoted text' grep | printf echo export "$1" printf
+		printf --verbose grep cd printf /usr/bin then done readonly 'quoted text' then
+${HOME} -eu cd /usr/bin echo | export "$@"
+		sed local then "$1" 2>/dev/null &&
+		--verbose 'quoted text'
+printf -eu $(pwd) && 'quoted text' done -eu
+	'quoted text' cd 'quoted text' ${HOME} then ${HOME} readonly readonly "$1" | done
+	export --verbose 2>/dev/null test $(pwd) printf
+local | test cd $(pwd) readonly local
+	export /usr/bin 'quoted text'
+	test /usr/bin readonly grep
+	"$@" && readonly x=1 echo cd readonly printf && && ${HOME}
+	awk --verbose sed grep grep done -eu local && "$1" printf
+	$(pwd) | grep $(pwd) /usr/bin | && x=1 printf awk --verbose local
+	printf local ${HOME} "$@" printf --verbose cd /usr/bin "$@" local /usr/bin
+	$(pwd) --verbose 2>/dev/null awk echo 2>/dev/null
+	/usr/bin grep cd "$1" 'quoted text' grep readonly && local done
+cd awk && grep then echo cd grep awk grep -eu sed 'quoted text'
+		awk readonly $(pwd) sed readonly --verbose sed printf "$1" 'quoted text' -eu &&
+	"$1" $(pwd) && x=1 && awk test
+2>/dev/null && printf | "$@" echo local $(pwd) "$@"
+	local printf 'quoted text' 2>/dev/null $(pwd) test
+		&& ${HOME} ${HOME} done
+	x=1 printf "$1" 'quoted text' 'quoted text' 'quoted text'
+grep awk export "$1"
+		local printf readonly done ${HOME} --verbose export /usr/bin --verbose 'quoted text'
+grep 2>/dev/null sed ${HOME} 'quoted text'
+		sed grep 2>/dev/null cd 'quoted text' local grep --verbose ${HOME} awk awk "$1"
+grep done readonly local "$1" local | then done awk local | grep &&
+sed ${HOME} 2>/dev/null | grep printf cd awk export "$1"
+		echo done 2>/dev/null readonly | /usr/bin && x=1 cd
+		readonly -eu grep echo $(pwd) local ${HOME}
+| done "$@" -eu awk echo then "$@"
+$(pwd) export 'quoted text' awk "$1"
+printf 2>/dev/null test done
+		awk "$@" 'quoted text' 2>/dev/null |
+		done then /usr/bin ${HOME} grep test "$1"
+		sed done 'quoted text' cd done --verbose && cd | x=1 readonly
+		grep echo cd awk sed local sed 2>/dev/null
+	x=1 awk $(pwd) | "$1" sed echo cd test 'quoted text'
+		| awk "$1" && /usr/bin cd sed
+then local sed "$@" sed 'quoted text' "$1" sed awk readonly sed
+		"$1" awk test x=1 done echo readonly awk 2>/dev/null done /usr/bin
+	echo | awk 2>/dev/null 'quoted text'
+done then export "$@" && printf done
+		export cd awk test && && export
+export -eu "$@" export "$@" $(pwd) sed local ${HOME} && readonly 2>/dev/null test
+	done done test ${HOME} 2>/dev/null && test printf sed $(pwd) readonly "$@"
+--verbose "$1" local test 2>/dev/null && | cd && && export cd ${HOME}
+then then "$@" -eu && sed --verbose readonly local | then
+		-eu "$@" echo /usr/bin local ${HOME} "$1"
+		$(pwd) "$1" | printf x=1 awk cd 'quoted text' local --verbose
+${HOME} then ${HOME} ${HOME} | "$@" && | sed "$1" export 2>/dev/null grep
+		export done local awk local then x=1 sed done -eu awk cd
+		'quoted text' ${HOME} | cd -eu echo && --verbose
+		x=1 2>/dev/null && --verbose x=1 ${HOME} echo printf --verbose && then then --verbose
+	--verbose && test cd printf echo /usr/bin 'quoted text'
+-eu --verbose /usr/bin printf then
+		&& | "$@" export readonly "$1"
+	printf printf $(pwd) 'quoted text' x=1 "$1" 2>/dev/null
+	sed -eu $(pwd) /usr/bin 'quoted text' 2>/dev/null
+		readonly | ${HOME} --verbose ${HOME} && 'quoted text'
+then readonly cd export && $(pwd) then ${HOME} "$1" readonly then sed x=1
+sed $(pwd) ${HOME} cd $(pwd)
+	sed -eu printf "$@" --verbose local "$@" ${HOME} then
+		$(pwd) export | "$1" x=1 x=1 awk readonly grep $(pwd) && $(pwd) then
+		$(pwd) -eu ${HOME} | sed grep "$@" awk x=1 sed cd "$1" "$@" done -eu
+	&& && ${HOME} test /usr/bin echo "$@" && grep
+	x=1 test "$@" && $(pwd)
+echo test && 2>/dev/null ${HOME} -eu printf "$@" && sed /usr/bin
+		&& test awk readonly $(pwd) then -eu cd && $(pwd) /usr/bin
+		-eu ${HOME} 'quoted text' local awk ${HOME} /usr/bin
+	done test readonly grep /usr/bin "$@" /usr/bin grep --verbose
+	/usr/bin /usr/bin "$@" | x=1 readonly sed 'quoted text'
+${HOME} -eu ${HOME} x=1 grep 2>/dev/null "$@" | then grep
+		&& | then "$1" && --verbose cd test "$1" cd "$1" 2>/dev/null $(pwd) done && --verbose
+		readonly printf echo /usr/bin then done export -eu awk sed
+		export readonly $(pwd) 'quoted text'
+	sed export then | then $(pwd) done export --verbose grep printf --verbose
+	cd 'quoted text' x=1 grep grep "$@" test 2>/dev/null
+		readonly "$@" then sed local x=1 'quoted text' readonly /usr/bin && export sed
+	cd -eu readonly --verbose readonly then -eu /usr/bin grep $(pwd) then
+| | echo echo readonly sed local export local then /usr/bin local
+	export "$1" x=1 2>/dev/null -eu cd awk awk --verbose grep && x=1 then 2>/dev/null
+done printf x=1 x=1 'quoted text' --verbose grep
+	"$@" /usr/bin | done -eu x=1 printf cd
+		$(pwd) /usr/bin ${HOME}
+&& awk --verbose && printf | --verbose && cd sed test | done 2>/dev/null
+	readonly cd "$@" test echo 2>/dev/null test local export
+	"$@" test grep export printf 'quoted text' 'quoted text'
+printf x=1 /usr/bin printf sed then then "$@" awk test "$1" local --verbose
+	printf cd x=1 sed readonly echo then /usr/bin ${HOME} readonly
+"$1" -eu | 'quoted text' awk | 'quoted text' "$@" then --verbose
+	printf export x=1 echo --verbose echo | awk echo grep local grep ${HOME}
+		then 'quoted text' test -eu x=1 && cd $(pwd) ${HOME} test local -eu awk sed
+"$1" /usr/bin $(pwd) cd --verbose export
+		"$@" test | | sed export then export then grep grep local test readonly awk "$1"
+		"$@" sed -eu --verbose grep cd grep local export -eu --verbose
+then --verbose "$1" -eu --verbose 'quoted text' -eu 'quoted text' 2>/dev/null
+		printf $(pwd) | then local "$1" echo export
+2>/dev/null | ${HOME} printf ${HOME} export grep "$1" cd /usr/bin
+&& | then 'quoted text' echo
+--verbose export -eu echo printf awk cd ${HOME} local readonly && "$1" 'quoted text'
+x=1 local then -eu | test ${HOME} test "$@" test done "$@" then -eu sed then
+	'quoted text' "$@" 'quoted text' /usr/bin
+--verbose then sed "$1" then -eu
+	awk $(pwd) awk --verbose 'quoted text' echo
+export 'quoted text' readonly then "$@" /usr/bin export
+${HOME} /usr/bin $(pwd) ${HOME} then readonly && /usr/bin cd awk ${HOME}
+		'quoted text' x=1 test 'quoted text' | |
+| && --verbose ${HOME}
+		export /usr/bin 'quoted text' x=1 readonly test ${HOME}
+	/usr/bin ${HOME} awk | "$@" /usr/bin
+2>/dev/null ${HOME} local ${HOME} grep && printf
+		then && cd --verbose && "$@" | "$@"
+	readonly readonly then grep
+		cd 2>/dev/null readonly cd x=1 done local sed $(pwd) ${HOME} echo "$@"
+	2>/dev/null "$@" "$1" && export
+		export test && -eu $(pwd)
+		&& && /usr/bin grep x=1 'quoted text'
+		/usr/bin local local then
+-eu 2>/dev/null then
+x=1 export 2>/dev/null "$@" awk /usr/bin sed
+		then && cd 2>/dev/null $(pwd) 'quoted text'
+local $(pwd) | export -eu then sed echo
+-eu test echo awk -eu $(pwd) | printf echo "$1" "$1" 2>/dev/null awk
+${HOME} --verbose readonly
+	--verbose "$@" "$1" local /usr/bin
+	${HOME} $(pwd) /usr/bin
+grep 'quoted text' printf | x=1
+		echo ${HOME} -eu "$@" 2>/dev/null 2>/dev/null && echo /usr/bin "$@"
+	cd ${HOME} 'quoted text' $(pwd) /usr/bin "$1" x=1 awk
+	"$1" grep echo $(pwd) "$1" $(pwd) printf grep grep
+	2>/dev/null local cd --verbose sed --verbose /usr/bin "$@" ${HOME} then
+		x=1 readonly $(pwd) readonly
+"$1" echo $(pwd) grep && ${HOME} cd /usr/bin awk ${HOME}
+2>/dev/null && x=1 sed x=1 ${HOME} echo |
+&& printf readonly sed -eu then test
+	--verbose done printf echo local done && "$1" ${HOME} then --verbose
+	| --verbose grep | grep sed /usr/bin && printf && grep 2>/dev/null
+		&& "$1" done /usr/bin done
+cd grep && "$@" "$@" x=1 then awk -eu grep && awk
+		printf && export -eu x=1 done -eu local readonly grep done /usr/bin ${HOME}
+&& $(pwd) -eu ${HOME} echo ${HOME}
+export test /usr/bin cd printf 2>/dev/null cd
+	test 'quoted text' grep -eu /usr/bin x=1
+	then $(pwd) $(pwd) then awk "$1" readonly grep then 2>/dev/null then
+test ${HOME} grep /usr/bin test --verbose | local
+		&& ${HOME} test sed "$1" export cd "$1" export --verbose /usr/bin && "$@"
+local local | --verbose ${HOME} grep printf
+"$1" grep "$1" | echo /usr/bin awk done
+	x=1 --verbose readonly "$@" | /usr/bin awk test then sed
+'quoted text' -eu test awk 2>/dev/null | echo $(pwd) x=1 awk ${HOME}
+	x=1 cd sed "$1" && 'quoted text' cd then "$@" printf /usr/bin
+		then printf cd "$@" 2>/dev/null
+	then readonly --verbose done then
+	awk --verbose ${HOME} x=1 local done && done readonly &&
+	x=1 then then -eu $(pwd)
+		done awk awk "$@" --verbose local x=1 --verbose
+	awk cd then done awk readonly
+	echo awk sed && awk "$1" done echo 'quoted text' done
+	$(pwd) awk ${HOME} echo readonly then
+		readonly | x=1 awk export "$1" 2>/dev/null test echo then "$1"
+$(pwd) printf x=1 export "$1" test 'quoted text' then awk 'quoted text'
+| sed -eu export x=1 "$1" local --verbose | printf cd
+2>/dev/null sed /usr/bin 2>/dev/null -eu "$@" | printf |
+	awk && sed grep --verbose "$@" && sed awk echo local
+	'quoted text' ${HOME} --verbose test 'quoted text' done "$1" /usr/bin /usr/bin
+	export then printf --verbose | export $(pwd) grep printf "$1" "$1" ${HOME}
+	/usr/bin x=1 export done sed echo /usr/bin awk /usr/bin test sed readonly /usr/bin
+		cd x=1 x=1 'quoted text' --verbose /usr/bin local /usr/bin
+	cd | /usr/bin 'quoted text' sed $(pwd) local "$@" --verbose
+	'quoted text' echo sed awk -eu
+		cd echo grep 2>/dev/null then --verbose done
+	&& "$@" echo sed echo 2>/dev/null sed export local
+	local 2>/dev/null readonly "$@" --verbose test readonly
+		"$1" && echo 'quoted text' $(pwd) awk done | | /usr/bin
+		export | echo echo x=1 export test x=1 sed x=1 sed readonly
+		x=1 printf cd sed done x=1 export
+readonly readonly awk 2>/dev/null 'quoted text'
+echo readonly then | /usr/bin echo grep x=1 done /usr/bin -eu
+	2>/dev/null x=1 $(pwd) then $(pwd) then -eu
+		local -eu grep cd "$@" $(pwd) "$1" --verbose x=1 'quoted text'
+	/usr/bin cd export export
+2>/dev/null grep then -eu echo awk printf sed done awk 'quoted text'
+	grep $(pwd) -eu x=1 -eu "$1" then awk --verbose
+		local 'quoted text' export -eu echo sed $(pwd) "$@" $(pwd) awk then
+		readonly test $(pwd) | 'quoted text' 'quoted text'
+		2>/dev/null 'quoted text' $(pwd) printf 'quoted text' -eu
+		test 2>/dev/null ${HOME} /usr/bin 2>/dev/null
+&& -eu $(pwd) export | local "$@" $(pwd) done ${HOME} sed export
+		cd 'quoted text' test done
+		done ${HOME} "$1" | done 2>/dev/null done && --verbose
+		export --verbose echo $(pwd) done test 2>/dev/null printf
+		-eu grep $(pwd) | "$1" sed sed readonly local $(pwd) ${HOME}
+cd --verbose grep readonly ${HOME} then $(pwd)
+		done readonly 'quoted text'
+	cd sed | x=1 cd echo readonly $(pwd) cd && --verbose
+	local "$@" sed readonly --verbose "$1" export
+echo x=1 sed x=1 'quoted text' 'quoted text'
+	'quoted text' -eu printf
+		'quoted text' test ${HOME} sed "$1" $(pwd) cd done $(pwd) readonly printf 'quoted text'
+		'quoted text' $(pwd) "$@" cd readonly
+-eu cd 2>/dev/null 'quoted text' "$@" 'quoted text'
+-eu 2>/dev/null 'quoted text' /usr/bin then local 2>/dev/null readonly
+"$@" 'quoted text' 2>/dev/null
+	export $(pwd) printf ${HOME} done grep awk
+"$1" sed awk readonly done ${HOME} awk sed
+	grep then sed test "$1" export awk readonly cd printf printf $(pwd)
+	-eu echo "$1" export then cd export "$@" "$@" && 2>/dev/null ${HOME}
+2>/dev/null export "$1" $(pwd) 'quoted text' 'quoted text'
+		/usr/bin "$@" sed 2>/dev/null sed /usr/bin 'quoted text' ${HOME}
+	-eu cd "$@" done local
+	readonly "$@" ${HOME} x=1 | -eu "$@" x=1 printf "$@"
+	&& $(pwd) --verbose sed 'quoted text'
+	local grep printf export readonly
+	-eu local "$1" /usr/bin done echo -eu x=1 &&
+echo test --verbose local
+		${HOME} printf "$@" grep readonly sed "$@" ${HOME} echo 'quoted text' -eu
+test ${HOME} && $(pwd) $(pwd) ${HOME} awk | /usr/bin "$1" then | | | | --verbose
+	local grep "$1" x=1 local printf x=1 grep printf
+	export then done export test /usr/bin "$@"
+		sed echo $(pwd) echo sed local -eu cd "$1" x=1 $(pwd) --verbose then
+	done readonly echo local readonly local
+	--verbose ${HOME} /usr/bin test 2>/dev/null then --verbose readonly "$1" readonly
+then export 'quoted text' local --verbose export | echo echo awk
+echo 2>/dev/null grep x=1 then
+2>/dev/null export sed | echo
+		grep cd then ${HOME} /usr/bin test x=1 $(pwd) "$1" 2>/dev/null done
+	${HOME} export $(pwd) 'quoted text' test test /usr/bin printf $(pwd) ${HOME}
+readonly echo --verbose 2>/dev/null test export grep readonly
+		${HOME} grep printf echo then readonly -eu
+sed $(pwd) sed "$@" ${HOME} x=1 "$@" 'quoted text' sed grep then x=1
+	export | "$1" printf done awk /usr/bin
+local "$@" && printf && "$@" readonly
+grep export done x=1 $(pwd) printf done $(pwd) grep grep readonly
+awk local cd test "$1" && "$@" $(pwd) && 'quoted text' done awk |
+	| export grep | done "$@" test | readonly then &&
+awk awk export | && printf && then "$@" --verbose -eu
+	| && --verbose grep printf 'quoted text' sed sed test local
+grep --verbose ${HOME} x=1 "$@" local
+grep /usr/bin ${HOME} grep $(pwd) test done
+	printf && --verbose | "$1" readonly
+	export grep printf /usr/bin "$@" | "$1" x=1 printf
+		/usr/bin grep "$1" | sed -eu printf cd -eu | export cd 'quoted text'
+"$1" sed cd then export 2>/dev/null -eu 'quoted text' test $(pwd)
+	-eu test 'quoted text' "$1" $(pwd) "$1" then ${HOME} ${HOME} /usr/bin
+		'quoted text' --verbose "$1" ${HOME} 'quoted text'
+	"$1" export awk -eu -eu && -eu
+&& readonly && 'quoted text' $(pwd) awk 'quoted text' export -eu |
+cd done --verbose -eu && grep readonly
+		${HOME} 'quoted text' x=1 $(pwd) cd export test printf echo
+		readonly | /usr/bin "$1" -eu readonly
+"$@" --verbose $(pwd) grep 'quoted text' /usr/bin readonly export
+		awk export && echo ${HOME} grep sed done readonly done local
+	'quoted text' x=1 | 2>/dev/null awk test
+	then $(pwd) --verbose 2>/dev/null && "$1" grep awk
+| awk test echo "$1" readonly
+		'quoted text' test cd awk "$@" ${HOME}
+	| --verbose | printf ${HOME} awk cd printf local sed && /usr/bin local --verbose
+		export local local 2>/dev/null
+grep local $(pwd) 2>/dev/null -eu x=1
+| -eu $(pwd) $(pwd) echo sed sed awk && local cd test "$1" local readonly test
+test awk cd then export --verbose x=1 test "$1"
+		-eu test printf done "$@" echo export |
+	--verbose --verbose then printf
+	| cd "$@" grep -eu x=1 "$@"
+	"$@" sed cd && done 2>/dev/null "$@" 'quoted text'
+	printf printf 2>/dev/null 2>/dev/null sed 'quoted text' "$1" grep ${HOME} printf
+		2>/dev/null && && export printf test test then && | echo test
+	2>/dev/null local ${HOME} echo printf x=1 2>/dev/null grep $(pwd) x=1 2>/dev/null
+then ${HOME} && "$1"
+		printf local "$1" ${HOME} /usr/bin 2>/dev/null awk | readonly
+	awk awk echo echo sed then -eu 'quoted text' "$@" && /usr/bin
+2>/dev/null readonly grep
+	sed --verbose x=1 printf printf /usr/bin awk 2>/dev/null
+	${HOME} "$1" -eu 2>/dev/null
+cd local $(pwd) export /usr/bin local --verbose grep 2>/dev/null
+		$(pwd) grep | --verbose sed awk $(pwd) printf 2>/dev/null grep && 'quoted text'
+${HOME} "$@" 'quoted text' ${HOME} x=1 -eu readonly awk -eu awk grep echo 'quoted text'
+	--verbose ${HOME} sed x=1 -eu then x=1 -eu $(pwd) then readonly then then
+	printf | export ${HOME} grep --verbose /usr/bin done 'quoted text' $(pwd) readonly
+	sed && sed echo printf sed
+	export "$1" 'quoted text' $(pwd) done ${HOME} readonly | && "$1" $(pwd)
+	readonly 'quoted text' then local awk
+		export then | awk echo done local $(pwd) readonly grep
+		-eu test /usr/bin 2>/dev/null done grep printf --verbose
+	local export $(pwd) cd | --verbose awk
+printf test $(pwd) && local printf grep done readonly 2>/dev/null printf then
+| --verbose local then echo "$@" ${HOME} -eu
+done 2>/dev/null echo grep echo 'quoted text'
+		--verbose readonly echo ${HOME} export "$1" local then awk "$1"
+"$1" cd export done printf
+grep sed printf /usr/bin readonly $(pwd)
+test 'quoted text' test x=1 "$1" done readonly
+		--verbose -eu "$@" echo printf 2>/dev/null
+	printf export echo test echo && 2>/dev/null
+	grep ${HOME} echo export --verbose $(pwd)
+done 'quoted text' x=1 /usr/bin -eu
+export --verbose && test 2>/dev/null 'quoted text' export ${HOME} |
+	readonly sed grep $(pwd) then echo export -eu
+		then cd "$@" export | awk local --verbose echo
+	cd sed 2>/dev/null "$@" && x=1
+	/usr/bin "$@" x=1 "$@" ${HOME} grep sed
+	"$@" done $(pwd) test 'quoted text' done -eu --verbose sed -eu x=1
+	&& local printf "$@" awk grep "$@" sed awk then x=1 | "$@" printf $(pwd) x=1 'quoted text'
+		readonly sed printf sed sed test | done | "$1" && then
+		x=1 x=1 echo 2>/dev/null
+	/usr/bin readonly readonly printf cd cd && done echo x=1 readonly echo
+export export cd /usr/bin done
+		cd cd && && test test /usr/bin then && 'quoted text' --verbose
+test grep x=1 x=1 ${HOME}
+	"$@" 2>/dev/null 'quoted text' awk export
+&& --verbose echo then ${HOME} -eu cd sed "$1" test export
+		/usr/bin 2>/dev/null done && echo /usr/bin
+		-eu cd then 2>/dev/null cd $(pwd) | done echo test echo $(pwd)
+		2>/dev/null /usr/bin --verbose cd export grep -eu readonly $(pwd) awk "$1"
+		readonly | awk && grep export 'quoted text'
+		cd ${HOME} grep printf echo /usr/bin /usr/bin "$@" local
+		'quoted text' && then | test printf readonly
+--verbose sed 2>/dev/null "$@" readonly test x=1 export grep && x=1
+	then export ${HOME} $(pwd) test "$1"
+	"$1" 'quoted text' $(pwd)
+		test && 'quoted text' "$@" done done
+2>/dev/null test grep done
+		awk | 'quoted text' 2>/dev/null
+		$(pwd) sed done export --verbose -eu awk echo
+		done echo && ${HOME} readonly $(pwd) cd && 'quoted text' | grep /usr/bin
+cd "$1" "$@" 'quoted text' cd $(pwd) echo local local readonly test |
+	cd -eu x=1 test echo | export readonly awk
+	$(pwd) cd test /usr/bin then
+	awk --verbose -eu "$1" "$1"
+	&& grep local -eu 'quoted text' "$@"
+		cd --verbose done 2>/dev/null --verbose -eu 'quoted text' printf then "$1"
+	"$@" then awk test sed cd export -eu "$1" /usr/bin | export
+	cd then test "$@" sed local readonly 'quoted text' "$@"
+		export sed grep sed awk sed local awk
+echo 'quoted text' cd then "$1" x=1
+cd export "$@" 'quoted text' then -eu sed --verbose export export export
+local | then sed local --verbose
+cd echo done awk -eu cd "$@" echo x=1 printf ${HOME} | printf readonly
+2>/dev/null --verbose "$1" readonly grep test | --verbose --verbose echo awk
+	readonly done echo export -eu grep "$1" "$1"
+	x=1 ${HOME} readonly cd -eu echo /usr/bin awk printf ${HOME}
+		cd && then | awk awk awk cd printf cd local then done 'quoted text' x=1 printf "$1"
+		"$@" awk done "$1" $(pwd) /usr/bin sed /usr/bin | $(pwd)
+	then then x=1 | /usr/bin && sed --verbose /usr/bin grep printf printf
+readonly -eu 2>/dev/null awk export readonly ${HOME} "$@" export x=1
+		export 'quoted text' test 2>/dev/null grep "$@" echo $(pwd) "$1"
+	| test local grep "$@" /usr/bin then ${HOME} && /usr/bin && cd --verbose 'quoted text'
+/usr/bin && printf awk done "$@" printf |
+		$(pwd) export "$1" --verbose done grep /usr/bin
+		$(pwd) done "$@" then 2>/dev/null readonly
+export -eu done sed -eu done x=1
+| local "$@" printf $(pwd) cd 2>/dev/null 2>/dev/null
+	-eu cd local 2>/dev/null export grep --verbose printf awk --verbose
+	| x=1 2>/dev/null echo /usr/bin -eu 'quoted text' then test sed && readonly
+printf x=1 && ${HOME} local $(pwd) sed 2>/dev/null /usr/bin
+	x=1 && "$1" local ${HOME} ${HOME}
+		sed cd grep x=1 $(pwd) $(pwd) echo | cd "$@" readonly sed ${HOME}
+${HOME} && "$1" "$@" readonly "$1" cd test 'quoted text'
+		'quoted text' && grep --verbose | done cd 'quoted text' -eu awk sed ${HOME} export
+		/usr/bin cd local readonly /usr/bin ${HOME} then test done test | | 'quoted text'
+	done echo printf awk echo /usr/bin
+	"$@" grep "$1" printf done /usr/bin
+		--verbose -eu x=1 done then --verbose printf local sed | done export 2>/dev/null
+-eu $(pwd) cd then export --verbose
+x=1 --verbose --verbose x=1 -eu 2>/dev/null
+done printf cd "$@" "$@" grep 'quoted text' | 'quoted text' readonly printf test
+/usr/bin cd local --verbose grep export awk cd
+		sed printf readonly test /usr/bin -eu export | test
+	local $(pwd) 2>/dev/null test readonly sed grep grep $(pwd) local then
+	local then done then x=1 | echo x=1 $(pwd) echo awk $(pwd) && done
+	local awk -eu | grep grep echo printf 2>/dev/null
+	${HOME} awk cd x=1 grep done
+		$(pwd) sed 'quoted text'
+--verbose grep | 2>/dev/null
+		test 2>/dev/null && x=1 sed
+		then test $(pwd) 2>/dev/null 'quoted text'
+		awk sed 'quoted text' awk echo $(pwd) cd grep ${HOME} awk ${HOME} then "$@" /usr/bin
+		/usr/bin readonly "$@" /usr/bin export awk ${HOME} test 2>/dev/null
+	'quoted text' test $(pwd) $(pwd) x=1 ${HOME} test readonly --verbose
+grep --verbose x=1 ${HOME} grep printf grep ${HOME} && local printf /usr/bin
+cd awk --verbose local cd then readonly --verbose sed "$1" "$1" 'quoted text'
+	echo -eu sed printf echo $(pwd)
+		then local | ${HOME} x=1
+	&& echo done done --verbose "$@" cd | x=1 --verbose 2>/dev/null
+		'quoted text' "$@" printf 2>/dev/null && printf ${HOME} $(pwd) $(pwd)
+		-eu -eu -eu done test printf local
+	sed "$1" awk grep test done awk "$@" && /usr/bin "$@" readonly x=1
+echo then echo echo local sed "$@" /usr/bin | echo 2>/dev/null x=1
+printf cd awk -eu -eu test echo echo | awk | done export
+x=1 && echo --verbose /usr/bin test "$@" done "$1" -eu "$1" -eu
+		&& | awk "$@" --verbose $(pwd) /usr/bin test ${HOME} x=1 'quoted text'
+test export "$1" -eu 'quoted text' --verbose && awk -eu $(pwd) --verbose
+'quoted text' "$@" sed x=1 -eu 'quoted text' grep
+		done test cd readonly
+/usr/bin grep test x=1 cd ${HOME} /usr/bin printf 2>/dev/null cd grep cd
+		| "$1" "$@" sed -eu && 'quoted text' cd "$@"
+/usr/bin grep "$@" then local local export $(pwd) 2>/dev/null 'quoted text'
+2>/dev/null readonly then | x=1 printf
+	export 'quoted text' && 'quoted text' /usr/bin sed grep printf
+cd cd export "$1" x=1 "$@" awk export -eu /usr/bin | && local 2>/dev/null $(pwd)
+		export printf 'quoted text' 2>/dev/null
+/usr/bin test cd echo x=1 export $(pwd) grep "$@" test --verbose /usr/bin
+	"$1" printf echo echo readonly $(pwd) -eu local /usr/bin
+sed done 2>/dev/null "$1" --verbose
+	grep -eu cd test 2>/dev/null /usr/bin "$@" export
+		"$@" cd awk $(pwd) | printf echo 'quoted text' $(pwd) printf 2>/dev/null echo
+	2>/dev/null done echo test
+&& 2>/dev/null cd 'quoted text' "$1" -eu x=1 done /usr/bin
+		sed 2>/dev/null export 2>/dev/null
+	"$@" printf 2>/dev/null test | x=1 test readonly &&
+readonly readonly grep readonly then grep done export local awk
+sed then done awk | local export cd grep local awk 'quoted text'
+		$(pwd) --verbose cd $(pwd) ${HOME}
+&& -eu readonly export cd x=1 awk "$1" echo sed done printf local | 2>/dev/null
+		$(pwd) 2>/dev/null grep -eu local test 'quoted text' /usr/bin awk
+--verbose $(pwd) awk 2>/dev/null
+	sed $(pwd) 'quoted text' ${HOME} -eu
+	local export ${HOME} -eu /usr/bin
+x=1 /usr/bin "$@" /usr/bin x=1 test 2>/dev/null awk local cd
+	"$1" "$1" then -eu export local 2>/dev/null sed readonly
+${HOME} sed done && then && /usr/bin test awk awk "$@" awk echo test "$@"
+	&& ${HOME} 'quoted text' done done
+	x=1 awk | done /usr/bin printf -eu then | local
+	-eu ${HOME} | -eu 2>/dev/null ${HOME} && printf sed "$@" | ${HOME} &&
+'quoted text' sed /usr/bin awk test "$1" ${HOME} readonly
+local ${HOME} local grep 'quoted text' done $(pwd)
+		$(pwd) grep "$1" --verbose "$@" readonly printf local test awk
+	/usr/bin | $(pwd) then awk x=1 printf
+	/usr/bin then "$@" export && awk grep then readonly 'quoted text' --verbose
+		/usr/bin grep printf cd then cd grep done sed
+'quoted text' printf /usr/bin printf | | echo
+then --verbose cd local x=1 'quoted text' x=1 --verbose done "$1" awk -eu test
+		then cd cd ${HOME} /usr/bin | cd x=1 /usr/bin
+		test 2>/dev/null x=1 local sed local
+		export awk ${HOME} "$1" printf test local local cd sed done local test
+${HOME} done awk readonly export
+		"$@" --verbose x=1 printf ${HOME} /usr/bin "$@" "$@" printf --verbose
+		export cd 'quoted text' x=1 | local echo && 'quoted text'
+		done --verbose --verbose -eu ${HOME} export --verbose done && ${HOME} ${HOME}
+	awk x=1 sed local $(pwd) test ${HOME}
+	2>/dev/null printf cd export "$@" 'quoted text' echo 'quoted text'
+	export 'quoted text'
+		test local cd grep $(pwd) "$1" done /usr/bin --verbose
+	cd 2>/dev/null cd "$@" cd 'quoted text' done test /usr/bin "$1" "$1" printf cd
+	"$1" echo local x=1 "$@" readonly $(pwd) 'quoted text' "$1" 'quoted text'
+		'quoted text' x=1 then "$1" cd cd export $(pwd) |
+		awk grep "$@" ${HOME} local printf test
+		x=1 then done x=1 x=1 | 2>/dev/null 'quoted text'
+		local echo test cd $(pwd) "$@" -eu test then printf | "$1" $(pwd) ${HOME}
+	cd -eu sed sed "$1" -eu awk "$1" echo 2>/dev/null echo echo readonly $(pwd)
+	&& sed ${HOME} $(pwd) done test export then sed cd test echo echo | | $(pwd)
+		echo done sed x=1 $(pwd) $(pwd) 2>/dev/null then printf printf "$@"
+-eu test test readonly && sed /usr/bin
+	x=1 printf /usr/bin 'quoted text' sed readonly awk test 2>/dev/null -eu
+test 'quoted text' printf awk $(pwd) cd readonly export readonly readonly
+	grep x=1 "$1" echo 'quoted text' /usr/bin | | printf done test echo x=1 'quoted text'
+		cd --verbose -eu /usr/bin local | "$@" export -eu grep "$1" --verbose done
+		test sed sed cd done "$@" && ${HOME} /usr/bin done echo x=1 | readonly
+test "$1" ${HOME} then --verbose readonly sed
+	${HOME} | echo && x=1 "$@" then then -eu && export sed | "$1"
+then grep grep printf local then awk | cd 2>/dev/null done
+		grep /usr/bin done awk 2>/dev/null local -eu /usr/bin "$1" ${HOME}
+-eu | -eu echo "$@" x=1 test awk x=1 then test --verbose
+x=1 $(pwd) $(pwd) $(pwd) -eu cd test "$@" && grep sed --verbose sed "$@"
+	awk grep 2>/dev/null export -eu $(pwd) -eu local export --verbose readonly -eu &&
+export $(pwd) -eu 'quoted text' x=1 awk "$1" -eu -eu "$@" grep then
+	echo 2>/dev/null echo done /usr/bin export "$1" "$@" /usr/bin
+	test -eu 2>/dev/null && | grep x=1 $(pwd) | cd grep awk grep 2>/dev/null
+| local grep export readonly printf && sed
+&& sed local ${HOME} grep local printf -eu
+export test then export 'quoted text' x=1 test
+	grep echo --verbose "$1" ${HOME} ${HOME} x=1 local ${HOME}
+readonly readonly cd "$1" printf && 'quoted text'
+	${HOME} x=1 readonly | ${HOME} test
+echo 'quoted text' readonly awk ${HOME} readonly
+	&& grep /usr/bin ${HOME} readonly grep awk cd cd then && -eu grep
+| /usr/bin /usr/bin test "$@" $(pwd) 'quoted text' awk
+test | then "$@" test readonly
+	${HOME} test ${HOME} grep /usr/bin printf done ${HOME} 2>/dev/null done
+		x=1 ${HOME} 2>/dev/null test -eu 'quoted text' "$@"
+	$(pwd) ${HOME} --verbose $(pwd) 2>/dev/null
+done local then $(pwd) "$@" 'quoted text' $(pwd)
+		done echo grep 2>/dev/null && grep awk local local grep -eu readonly
+		2>/dev/null grep | "$@" --verbose $(pwd)
+-eu 'quoted text' && cd readonly
+		awk /usr/bin test /usr/bin cd && 2>/dev/null echo | | x=1
+echo -eu then then -eu then 'quoted text' readonly
+		'quoted text' export && x=1 /usr/bin /usr/bin &&
+	| "$@" local done --verbose test printf awk | --verbose done /usr/bin ${HOME} echo
+x=1 ${HOME} printf 'quoted text' test export grep done export ${HOME}
+		--verbose --verbose test "$@" readonly cd ${HOME} sed printf 2>/dev/null
+	2>/dev/null ${HOME} --verbose cd grep | sed grep && readonly
+	2>/dev/null && /usr/bin readonly test "$1" 2>/dev/null x=1 x=1 printf ${HOME}
+		-eu readonly /usr/bin awk done sed sed 'quoted text' local
+	"$1" export echo awk 'quoted text' /usr/bin done "$1" && readonly "$1"
+then | /usr/bin echo local "$1" x=1 sed awk -eu | $(pwd) -eu
+	--verbose $(pwd) awk sed ${HOME}
+		--verbose $(pwd) grep test 2>/dev/null
+		local done ${HOME} /usr/bin
+	then local x=1 "$1" x=1 then | readonly export echo grep "$1" | sed awk "$1"
+		'quoted text' /usr/bin -eu -eu "$1" /usr/bin grep
+	test sed "$1" -eu "$1" x=1 then test /usr/bin sed | export local
+grep /usr/bin test "$@" readonly --verbose ${HOME}
+		echo && printf printf cd sed echo done | --verbose awk sed $(pwd) &&
+	export export "$@" awk done export readonly export
+	2>/dev/null echo /usr/bin x=1 printf /usr/bin readonly /usr/bin
+		"$@" awk /usr/bin sed sed "$1" 2>/dev/null readonly "$@" cd 2>/dev/null export
+		--verbose done 2>/dev/null 2>/dev/null ${HOME} | cd /usr/bin $(pwd)
+2>/dev/null sed && sed x=1 2>/dev/null done 'quoted text'
+	"$@" 2>/dev/null -eu --verbose printf
+	printf ${HOME} $(pwd) echo test local $(pwd) printf
+		x=1 awk awk done done && x=1 x=1 -eu
+		--verbose "$@" grep "$1" $(pwd) sed --verbose local x=1
+		grep ${HOME} export 'quoted text' | 'quoted text' awk
+	"$@" $(pwd) -eu "$@" cd echo sed printf test /usr/bin --verbose "$1"
+		-eu ${HOME} "$1" /usr/bin echo printf "$1" readonly test test "$@" 'quoted text'
+		export cd local local sed 2>/dev/null -eu ${HOME} ${HOME} x=1 then
+printf --verbose "$@" printf sed echo local echo awk awk sed readonly
+		local && --verbose && printf export sed done awk 2>/dev/null && | &&
+	-eu 'quoted text' export export ${HOME} x=1
+		echo echo ${HOME} readonly readonly test printf done done "$@" x=1 awk
+	cd | grep done local done x=1 awk cd /usr/bin && export
+'quoted text' x=1 echo $(pwd) echo
+printf /usr/bin then awk 2>/dev/null test test done awk --verbose
+	x=1 test then x=1 done x=1 echo 2>/dev/null 'quoted text'
+		/usr/bin export "$@" sed readonly
+	2>/dev/null 2>/dev/null grep &&
+		--verbose readonly done cd then echo ${HOME} export
+cd "$1" export && sed 2>/dev/null x=1
+		awk printf grep -eu 'quoted text'
+	done | --verbose awk local local ${HOME} then echo test $(pwd) "$@" grep
+$(pwd) --verbose 2>/dev/null --verbose
+		export --verbose echo --verbose test readonly printf --verbose
+"$1" | "$@" cd then cd grep test 'quoted text'
+		export printf 'quoted text' -eu readonly ${HOME} "$1" "$1" readonly "$1"
+		readonly 'quoted text' echo && /usr/bin done grep readonly "$@" test ${HOME}
+$(pwd) sed --verbose done x=1 cd 2>/dev/null -eu "$1"
+		-eu local local test 2>/dev/null --verbose ${HOME} "$1"
+	sed /usr/bin grep export done echo then echo export 2>/dev/null
+		done sed awk echo done export test "$1" 'quoted text'
+		'quoted text' "$1" | readonly x=1 2>/dev/null "$@" echo -eu
+		| then printf grep ${HOME} grep printf test then
+	readonly local -eu printf x=1 --verbose --verbose grep awk grep then
+	readonly -eu test $(pwd) sed local 2>/dev/null 'quoted text' 'quoted text' $(pwd)
+export cd echo sed $(pwd) $(pwd) echo awk local echo
+		/usr/bin local /usr/bin | sed local 2>/dev/null echo | 2>/dev/null done x=1
+echo echo cd x=1 'quoted text' && $(pwd) 'quoted text' grep
+	export readonly local "$@"
+	'quoted text' sed 'quoted text' $(pwd) $(pwd) $(pwd) ${HOME} "$@" && --verbose
+		| readonly readonly 2>/dev/null test -eu export 'quoted text' export && "$1"
+--verbose grep 'quoted text' 2>/dev/null
+	cd 2>/dev/null "$1" | | readonly ${HOME} "$1" then "$@" "$1" done grep x=1
+		-eu /usr/bin awk | done printf "$1"
+		export cd sed export | test | $(pwd) local
+		/usr/bin "$@" $(pwd) sed then "$1" ${HOME} printf "$1" cd "$@" x=1 x=1 readonly
+	x=1 ${HOME} $(pwd) -eu 2>/dev/null cd
+	test 'quoted text' "$@" -eu printf readonly /usr/bin
+		done && sed "$1" && /usr/bin 2>/dev/null printf ${HOME} local
+then && --verbose grep | 'quoted text' 2>/dev/null | $(pwd) | cd grep
+awk grep cd done && && | |
+test "$1" grep grep sed x=1 grep done x=1 export
+		"$1" awk test cd awk export x=1 "$@" 'quoted text'
+cd ${HOME} local 'quoted text' printf grep printf grep "$1" | test then sed
+	grep awk 'quoted text' 2>/dev/null local 'quoted text' done "$@" local &&
+		then sed --verbose awk readonly --verbose "$1" echo printf
+		cd 2>/dev/null local local export
+		then $(pwd) local sed sed --verbose
+		echo ${HOME} local 'quoted text' 'quoted text'
+	printf sed x=1 --verbose awk ${HOME} $(pwd) x=1
+"$@" -eu printf test --verbose -eu && local ${HOME} -eu "$1" cd ${HOME}
+	test --verbose "$1" x=1 --verbose -eu export printf
+		--verbose 2>/dev/null echo export grep
+| then cd export export cd 2>/dev/null "$@"
+done local $(pwd) done && done
+		| local /usr/bin /usr/bin awk "$@" local sed && cd then 2>/dev/null sed ${HOME}
+		| export "$@" export cd "$@" readonly && local echo | /usr/bin /usr/bin
+		${HOME} then "$1" --verbose
+		printf "$@" sed "$@" grep sed $(pwd) echo x=1 x=1 --verbose x=1 test
+		cd && grep readonly "$1" --verbose done -eu done readonly $(pwd) | /usr/bin
+	x=1 test cd 'quoted text' -eu "$1" done && local echo echo
+	readonly sed "$@" grep /usr/bin x=1 "$@" 'quoted text'
+	grep -eu echo export printf x=1 then readonly
+$(pwd) "$1" x=1 | then printf "$@"
+	sed grep 'quoted text' test /usr/bin &&
+	&& && cd done "$@" grep sed --verbose x=1 2>/dev/null && 2>/dev/null
+--verbose /usr/bin export 'quoted text' ${HOME} done
+		| ${HOME} "$@" -eu | printf
+		echo $(pwd) -eu then x=1 "$@" 2>/dev/null
+${HOME} readonly readonly ${HOME} /usr/bin cd && sed printf
+		'quoted text' | $(pwd) sed readonly export then 2>/dev/null
+${HOME} test "$1" 2>/dev/null --verbose
+$(pwd) printf readonly echo -eu "$@" done --verbose ${HOME} grep && /usr/bin
+grep 2>/dev/null cd export $(pwd) 'quoted text' $(pwd) /usr/bin cd printf 2>/dev/null
+--verbose "$@" readonly "$@" printf readonly 2>/dev/null
+/usr/bin readonly -eu test awk test x=1 then 'quoted text'
+readonly grep "$1" "$@" && $(pwd) sed awk $(pwd)
+		local ${HOME} done 2>/dev/null && ${HOME}
+		2>/dev/null readonly | 2>/dev/null echo
+		${HOME} -eu 'quoted text' 'quoted text' "$@" 'quoted text' /usr/bin
+		test -eu grep "$@" 2>/dev/null $(pwd) export awk awk printf
+	/usr/bin printf && then grep
+	--verbose cd 'quoted text' printf
+	x=1 export export cd -eu "$@" then sed then local grep
+--verbose grep 2>/dev/null
+		grep awk 'quoted text' sed --verbose ${HOME}
+	-eu "$@" done printf 'quoted text' x=1 awk readonly 2>/dev/null -eu done readonly
+	'quoted text' && | -eu
+	grep 'quoted text' done export test export export
+export /usr/bin test awk test done local x=1
+cd && test "$@" ${HOME} 2>/dev/null grep then
+	'quoted text' /usr/bin x=1 echo ${HOME} readonly printf "$1" awk --verbose --verbose
+		sed awk echo /usr/bin printf readonly "$@" $(pwd)
+		"$1" 2>/dev/null local done awk grep cd printf 2>/dev/null awk readonly | echo
+--verbose ${HOME} $(pwd) then echo ${HOME} $(pwd) --verbose --verbose 2>/dev/null
+test | && done grep readonly && local export sed echo awk
+	grep local local 2>/dev/null
+		done done 'quoted text'
+		${HOME} test cd test ${HOME} "$1" echo
+		awk awk | printf echo && &&
+		"$@" export then ${HOME} --verbose 'quoted text' ${HOME} -eu echo "$@" --verbose
+done 'quoted text' printf --verbose 2>/dev/null 'quoted text' /usr/bin -eu
+awk cd "$1" echo done ${HOME} "$1" &&
+		echo ${HOME} x=1 sed x=1 2>/dev/null
+"$@" /usr/bin --verbose /usr/bin "$@" grep echo --verbose
+	-eu $(pwd) ${HOME} echo awk readonly -eu test
+		test test $(pwd) 2>/dev/null | "$1"
+		-eu export $(pwd) "$@" -eu ${HOME} export echo | --verbose readonly grep --verbose
+	${HOME} awk export awk /usr/bin -eu 2>/dev/null
+done $(pwd) -eu && "$1"
+		local x=1 /usr/bin --verbose -eu $(pwd) grep 2>/dev/null
+&& cd 'quoted text' "$@" ${HOME}
+then done awk "$1" 2>/dev/null readonly
+2>/dev/null test readonly cd x=1 test awk export
+	awk export awk cd echo sed "$1" -eu /usr/bin readonly
+$(pwd) local echo $(pwd) sed test echo grep awk done
+		$(pwd) local 'quoted text' $(pwd) -eu 'quoted text'
+-eu then sed cd ${HOME}
+		cd test 'quoted text' x=1 then readonly
+	sed "$1" cd && then 'quoted text' export echo | 'quoted text' test && /usr/bin
+awk cd then 2>/dev/null cd 'quoted text' done
+"$@" -eu 2>/dev/null done | echo
+		/usr/bin "$1" echo awk local 2>/dev/null local x=1
+	done cd sed -eu sed /usr/bin awk --verbose
+		echo cd done done x=1 2>/dev/null sed printf ${HOME} --verbose
+	${HOME} "$@" -eu then echo $(pwd) cd then
+	awk --verbose awk awk readonly then && export
+	awk local ${HOME} local test ${HOME} sed ${HOME} echo 'quoted text'
+		sed "$@" ${HOME} && "$1" && echo readonly test ${HOME} export &&
+/usr/bin x=1 --verbose
+		$(pwd) ${HOME} test && then echo
+echo sed readonly printf printf "$1"
+		| test | 2>/dev/null test then $(pwd) done then export done awk "$@"
+		${HOME} ${HOME} -eu ${HOME}
+${HOME} sed sed ${HOME} ${HOME} x=1 local sed export x=1 readonly echo
+2>/dev/null ${HOME} test ${HOME} 2>/dev/null /usr/bin
+		x=1 $(pwd) readonly && sed then "$@" local then done
+		awk 2>/dev/null "$@" export echo | -eu | export
+	"$1" 'quoted text' ${HOME} 'quoted text'
+cd then then x=1 --verbose readonly
+		printf $(pwd) printf readonly then printf 'quoted text' && | cd -eu grep
+sed --verbose sed cd --verbose local --verbose
+		awk --verbose local | done cd then local "$@" "$1" /usr/bin x=1 "$@"
+		x=1 x=1 | "$@" | readonly /usr/bin
+	local sed cd local grep ${HOME} "$@" then echo "$1" 2>/dev/null local
+		awk | printf $(pwd) --verbose grep | local 'quoted text' 'quoted text' $(pwd)
+		awk -eu /usr/bin printf | ${HOME} /usr/bin cd --verbose
+&& local export 'quoted text' awk echo done -eu awk && -eu local grep printf --verbose
+readonly /usr/bin 2>/dev/null -eu awk /usr/bin 2>/dev/null
+done test --verbose printf export
+${HOME} awk -eu local sed export
+	'quoted text' /usr/bin /usr/bin then -eu export -eu echo
+-eu | "$1" grep "$@" test | /usr/bin
+awk done done 'quoted text' x=1
+echo 2>/dev/null grep done /usr/bin
+	grep 'quoted text' --verbose cd "$1"
+	-eu sed $(pwd) awk awk local $(pwd) --verbose
+/usr/bin echo done done
+		test cd done done ${HOME} local
+local $(pwd) then printf x=1
+		awk grep 2>/dev/null then
+		sed test 'quoted text' done
+	then readonly grep awk ${HOME} "$@" echo && &&
+done test local then --verbose grep 2>/dev/null grep "$1"
+	echo local --verbose done grep 2>/dev/null && cd ${HOME} $(pwd)
+"$@" then done awk sed export x=1 sed ${HOME} printf 'quoted text'
+		local -eu --verbose -eu test | $(pwd) grep sed local /usr/bin --verbose
+2>/dev/null "$1" readonly | printf
+	| "$1" cd && readonly test local readonly ${HOME} "$@" 'quoted text' "$@" local
+	| -eu 2>/dev/null "$@" 'quoted text' "$1" "$1" "$@" awk cd | test local 'quoted text'
+		2>/dev/null 2>/dev/null 'quoted text' ${HOME} /usr/bin x=1 test
+		printf $(pwd) ${HOME} echo -eu &&
+		readonly local /usr/bin sed sed
+| then /usr/bin -eu -eu done awk cd 2>/dev/null
+cd sed 2>/dev/null /usr/bin "$@" export
+cd grep echo $(pwd) test readonly && && | test sed printf /usr/bin x=1
+		'quoted text' x=1 readonly $(pwd) &&
+	&& x=1 cd sed x=1 awk ${HOME}
+	then --verbose "$1" grep ${HOME} x=1 printf | 2>/dev/null --verbose export
+	"$@" local then --verbose /usr/bin test done 'quoted text'
+	test grep grep test printf echo awk awk
+	export "$1" awk "$@" $(pwd)
+printf local -eu readonly printf
+		'quoted text' cd | done cd
+readonly $(pwd) export "$@" echo printf "$1" | && echo -eu x=1 done --verbose cd
+	then readonly readonly $(pwd) | then sed readonly
+sed --verbose 2>/dev/null readonly --verbose "$@" printf done printf
+#include c119.sh
+x=1 "$1" && 2>/dev/null sed x=1 cd ${HOME} echo "$@" local test
+		done /usr/bin test test /usr/bin $(pwd) --verbose | "$@" done --verbose
+readonly printf 2>/dev/null -eu echo echo printf
+	&& && awk && "$@" $(pwd) $(pwd) export 2>/dev/null
+2>/dev/null "$1" x=1 $(pwd) /usr/bin | printf "$@" grep | awk 'quoted text'
+${HOME} then x=1 awk ${HOME} $(pwd) local export local then ${HOME} test
+awk "$@" "$1" 'quoted text' -eu test readonly test
+export -eu "$1" test grep "$1"
+		grep cd printf test test
+--verbose /usr/bin | awk $(pwd)
+		then -eu then then $(pwd) export grep done --verbose -eu
+		x=1 test readonly -eu local sed export && printf cd ${HOME} readonly then $(pwd)
+		cd export local $(pwd) && ${HOME} 2>/dev/null done then
+	test done $(pwd) "$@" ${HOME}
+	--verbose then readonly printf grep -eu | then -eu echo
+done "$1" ${HOME} | | x=1 readonly awk 'quoted text' ${HOME} $(pwd) x=1 done
+	| | 2>/dev/null cd cd sed 'quoted text' sed local
+sed "$1" "$1" echo grep x=1 --verbose x=1 -eu $(pwd) export grep && test
+x=1 x=1 printf --verbose test grep
+	--verbose local && awk then echo test export "$1" ${HOME}
+	done export export awk local
+awk export "$@" ${HOME} ${HOME} printf
+done $(pwd) --verbose echo awk cd export
+	'quoted text' cd grep echo echo printf -eu done echo
+		x=1 | export cd then sed $(pwd) readonly /usr/bin "$@" /usr/bin
+local export echo cd local awk then local
+then --verbose 'quoted text' ${HOME} printf
+	--verbose "$1" "$1" /usr/bin
+awk readonly awk test "$1" $(pwd) "$@"
+	"$1" | echo /usr/bin test readonly ${HOME} $(pwd) 'quoted text'
+	${HOME} --verbose && sed | sed x=1 grep printf cd ${HOME} 2>/dev/null --verbose
+	cd awk $(pwd) test done cd | test printf sed && | 'quoted text' local
+done grep test done printf sed local -eu sed export local --verbose
+		echo test done --verbose grep "$@" readonly x=1 export test 'quoted text' then
+		printf then -eu export
+	/usr/bin export ${HOME} $(pwd) grep grep 'quoted text'
+local cd "$@" ${HOME} awk printf && awk export test $(pwd)
+		"$1" cd then done done local 'quoted text' printf done then /usr/bin
+		test 2>/dev/null test | $(pwd) local printf cd 'quoted text' "$1" | echo test
+${HOME} $(pwd) 2>/dev/null printf sed then echo test sed readonly /usr/bin
+		| "$@" "$1" awk /usr/bin then && then --verbose "$@" local --verbose
+$(pwd) $(pwd) "$@" printf printf "$1" 'quoted text'
+export && readonly -eu 2>/dev/null ${HOME} readonly
+echo then x=1 2>/dev/null ${HOME} $(pwd)
+sed test "$@" awk x=1 printf -eu
+	$(pwd) "$1" local test 2>/dev/null $(pwd) "$@" test cd local sed --verbose
+	printf && x=1 | export done sed
+echo 2>/dev/null -eu ${HOME} then x=1 /usr/bin ${HOME} | echo x=1
+		'quoted text' "$1" awk sed "$1" && export export
+	--verbose cd 2>/dev/null
+		x=1 printf local cd grep grep awk sed "$@" $(pwd) grep && test then cd ${HOME} "$1"
+export test x=1 then --verbose $(pwd) ${HOME} 2>/dev/null awk x=1 $(pwd) export
+done export "$@" local
+	--verbose cd readonly grep 'quoted text' local
+sed printf local printf cd export readonly grep && readonly
+grep local sed printf "$1" 2>/dev/null done && then 'quoted text'
+	${HOME} 'quoted text' readonly done ${HOME} && /usr/bin echo export
+"$1" export && x=1 printf -eu 'quoted text' awk ${HOME} 'quoted text' grep
+	then export export test test readonly echo grep sed /usr/bin 2>/dev/null
+-eu readonly local /usr/bin
+local readonly awk cd echo ${HOME} then awk && test | awk export
+		x=1 'quoted text' "$@" done grep "$@" cd | readonly --verbose
+		&& -eu 'quoted text' sed cd && cd awk readonly && x=1 readonly x=1 awk
+	readonly --verbose cd printf sed done x=1 grep echo grep readonly then $(pwd)
+	2>/dev/null "$@" ${HOME} local then x=1 awk 'quoted text' -eu done grep
+printf export --verbose test then
+		$(pwd) done && sed done $(pwd) "$@" readonly ${HOME} && done
+test readonly done --verbose "$1" ${HOME}
+		readonly x=1 grep grep x=1 |
+	-eu local $(pwd) $(pwd) | test test echo
+		test local 2>/dev/null 'quoted text' test export printf "$@"
+$(pwd) "$@" local | 2>/dev/null cd "$@" 'quoted text' -eu
+export "$@" test test sed
+		&& local local awk -eu local printf cd test "$@" cd echo then done 2>/dev/null
+		readonly done readonly then awk x=1
+	sed readonly "$1" --verbose
+		local 'quoted text' /usr/bin export "$1" printf "$1" "$@" printf test
+	2>/dev/null readonly cd
+	--verbose -eu export &&
+--verbose test echo cd then cd x=1 done printf
+		then echo x=1 | "$@" "$1" cd awk printf awk grep cd "$@" "$1" local 'quoted text'
+		echo && test /usr/bin echo awk 2>/dev/null "$@" readonly
+		${HOME} cd "$1" echo "$@" ${HOME} "$1" $(pwd)
+awk grep "$1" /usr/bin local "$@" |
+	done ${HOME} --verbose
+	awk | sed sed export export
+| printf /usr/bin | then grep -eu --verbose test sed grep
+	then done sed then echo | then
+	'quoted text' "$@" ${HOME} readonly
+	2>/dev/null grep "$@" local cd awk echo x=1
+		| /usr/bin export readonly echo
+awk printf --verbose | "$@" 2>/dev/null
+		2>/dev/null cd cd printf $(pwd) local "$1"
+		-eu echo grep --verbose /usr/bin 2>/dev/null awk --verbose test
+local /usr/bin echo test test then then "$1" "$1" "$1" done printf readonly
+| x=1 done 'quoted text' sed done then | $(pwd) $(pwd)
+	$(pwd) 'quoted text' x=1 "$1" "$@" printf 2>/dev/null readonly
+--verbose ${HOME} then 2>/dev/null export --verbose local cd $(pwd)
+	sed /usr/bin -eu test echo then /usr/bin "$@" $(pwd) echo && readonly
+	| sed test cd export "$1" "$1" --verbose -eu cd
+	export "$@" printf 2>/dev/null && local then --verbose
+	&& -eu done sed $(pwd) export /usr/bin $(pwd)
+2>/dev/null ${HOME} /usr/bin test readonly --verbose 'quoted text'
+	$(pwd) $(pwd) readonly /usr/bin -eu | test export readonly -eu echo grep
+test 2>/dev/null local /usr/bin then export && sed local 2>/dev/null sed
+		x=1 grep x=1 sed 'quoted text'
+		sed readonly test echo 'quoted text'
+	readonly $(pwd) 'quoted text'
+	"$@" && -eu done printf /usr/bin
+then 'quoted text' --verbose
+		--verbose /usr/bin readonly "$@" local 'quoted text' $(pwd)
+	--verbose grep export ${HOME} --verbose printf --verbose ${HOME}
+		-eu local export printf echo
+	$(pwd) echo sed "$@" && readonly awk "$@" 2>/dev/null local ${HOME}
+		export grep | ${HOME} 'quoted text'
+"$1" "$@" sed done 2>/dev/null "$1" ${HOME}
+&& local readonly 2>/dev/null cd echo ${HOME} local | && $(pwd) grep readonly
+		printf /usr/bin "$1" $(pwd) 'quoted text' cd $(pwd)
+	/usr/bin -eu x=1 $(pwd) sed
+		export printf sed printf $(pwd) --verbose /usr/bin |
+sed done test $(pwd) printf
+${HOME} echo local cd -eu
+awk local sed sed echo cd $(pwd) readonly local done cd cd export cd "$1" --verbose
+	2>/dev/null --verbose 2>/dev/null | "$@" ${HOME}
+		2>/dev/null sed 2>/dev/null local echo printf then 2>/dev/null done
+		local 'quoted text' | /usr/bin local 2>/dev/null test awk then "$@" "$@" $(pwd)
+	sed local test test $(pwd)
+&& 2>/dev/null local grep done readonly && | && readonly && grep
+	done ${HOME} local -eu -eu | x=1 && ${HOME} test $(pwd) x=1 then awk printf
+	local cd 'quoted text' export echo sed -eu 2>/dev/null
+	local done cd "$1" export | /usr/bin echo grep export
+	$(pwd) --verbose "$1" awk grep sed done test local export -eu
+	done awk "$@" && export done export /usr/bin local x=1
+		2>/dev/null $(pwd) test
+cd /usr/bin $(pwd) local test echo
+	echo cd "$1" test x=1 done done 'quoted text' | grep 2>/dev/null
+		-eu 'quoted text' -eu /usr/bin grep sed x=1 sed ${HOME} ${HOME}
+	then 2>/dev/null done "$1" test "$@" local export readonly done x=1 2>/dev/null
+		-eu -eu printf $(pwd) done "$@" --verbose x=1 export cd ${HOME} --verbose export
+	"$1" echo 'quoted text' sed grep && printf 2>/dev/null "$1" | /usr/bin
+	"$1" $(pwd) /usr/bin "$@" printf local && readonly ${HOME} && cd x=1 readonly
+	| $(pwd) then readonly printf "$@" && local x=1
+	2>/dev/null readonly grep && then
+	then awk && export readonly && awk | 2>/dev/null 'quoted text' cd -eu sed grep
+	-eu cd local then | "$1" $(pwd) done echo $(pwd)
+export 'quoted text' --verbose
+	&& --verbose readonly readonly local /usr/bin
+		readonly "$1" awk && 2>/dev/null export && /usr/bin
+	x=1 | local | local echo sed local local
+$(pwd) sed && readonly sed export --verbose readonly /usr/bin
+	| x=1 readonly test --verbose 'quoted text'
+/usr/bin 'quoted text' local test ${HOME} cd
+	awk export echo | x=1 sed awk awk sed 2>/dev/null "$@"
+x=1 done ${HOME} readonly
+		cd done "$1" printf x=1 && test export /usr/bin x=1 local
+		sed done "$1" --verbose ${HOME} --verbose "$1" sed "$1"
+		test local ${HOME} printf $(pwd) x=1 grep "$1" --verbose --verbose awk "$@"
+	then x=1 2>/dev/null --verbose x=1 && 'quoted text' cd 'quoted text' --verbose &&
+echo export 'quoted text'
+	| "$1" --verbose "$@" 'quoted text'
+"$@" && --verbose test cd "$1" "$@" "$1" -eu then $(pwd) "$@" ${HOME} echo printf
+export local "$@" "$@" grep | ${HOME} done sed 2>/dev/null
+&& --verbose sed $(pwd)
+	local readonly done 2>/dev/null |
+	printf echo 'quoted text' cd x=1 2>/dev/null
+		${HOME} printf awk | grep | 2>/dev/null
+	done test --verbose cd readonly local awk | 2>/dev/null readonly
+--verbose --verbose test && then readonly then
+'quoted text' $(pwd) sed echo 'quoted text'
+		&& | "$1" | awk 'quoted text' export awk --verbose printf --verbose
+| export ${HOME} test then 'quoted text' printf done 2>/dev/null sed x=1 sed
+	export x=1 $(pwd) then "$1" -eu cd echo readonly "$@" && "$1" && $(pwd) grep
+		awk export --verbose "$1" awk done ${HOME} "$@" 2>/dev/null export &&
+x=1 awk sed grep | x=1 --verbose
+local "$1" done test cd x=1 awk -eu ${HOME}
+	--verbose test readonly readonly test grep 'quoted text' 2>/dev/null /usr/bin
+		${HOME} --verbose awk "$1" test && x=1 then local /usr/bin
+test awk done local readonly
+		2>/dev/null $(pwd) then grep grep "$@" awk done x=1 "$1" x=1 printf echo 'quoted text'
+	"$@" readonly grep grep printf test
+		then 'quoted text' $(pwd) $(pwd)
+		"$@" then grep $(pwd) local
+	awk ${HOME} --verbose export "$1" 'quoted text' test | test test
+grep 'quoted text' && ${HOME} cd && 'quoted text' readonly
+	sed local cd test -eu done sed --verbose readonly printf "$@"
+	"$1" $(pwd) awk done ${HOME} then -eu sed grep "$1" local
+2>/dev/null sed readonly
+cd $(pwd) 2>/dev/null sed echo $(pwd) printf x=1 /usr/bin awk echo --verbose
+		'quoted text' grep awk grep grep "$1" --verbose "$1" 2>/dev/null
+	echo then cd awk sed x=1 && test | -eu echo ${HOME} -eu ${HOME} awk ${HOME} 2>/dev/null
+		echo | grep "$@" 'quoted text' --verbose done "$@" cd echo sed printf cd "$@"
+		printf echo --verbose then printf
+	sed --verbose -eu && && local | local readonly --verbose
+		sed sed ${HOME} --verbose grep -eu printf 'quoted text'
+		--verbose "$1" local then && -eu
+local --verbose -eu done done "$1" export --verbose printf 'quoted text'
+	'quoted text' -eu $(pwd) awk local $(pwd) readonly local 2>/dev/null awk --verbose
+		/usr/bin sed sed done awk grep done 2>/dev/null local grep awk sed | -eu grep
+	/usr/bin grep sed --verbose local "$@" "$@" done
+	-eu echo grep local echo sed then && $(pwd) | awk
+	&& x=1 2>/dev/null x=1 /usr/bin echo x=1 awk test grep test printf
+sed /usr/bin printf test ${HOME} grep echo printf | export readonly ${HOME}
+--verbose test export $(pwd) sed echo done test /usr/bin
+readonly 'quoted text' "$@" -eu done local local test readonly 'quoted text'
+	| cd "$@" "$@" local local grep
+'quoted text' grep awk cd readonly echo $(pwd)
+		awk grep ${HOME} "$1" cd readonly --verbose 2>/dev/null
+then x=1 local test -eu export sed readonly printf && "$1" /usr/bin "$@" "$1"
+		then local | export 'quoted text' --verbose
+export local -eu && | && 2>/dev/null /usr/bin /usr/bin printf
+		"$1" grep test test x=1 x=1 done -eu printf ${HOME} then
+&& "$@" x=1 then x=1 --verbose awk /usr/bin x=1 test && 'quoted text' -eu sed
+		sed | "$1" export && export test "$1" $(pwd) readonly export ${HOME}
+	local export test grep printf --verbose --verbose 2>/dev/null x=1
+	test cd 'quoted text' ${HOME} "$1" awk
+		-eu then $(pwd) cd export "$1" echo 'quoted text'
+		| printf ${HOME} -eu sed "$@" ${HOME}
+echo $(pwd) sed grep cd done awk test
+x=1 "$1" && cd 2>/dev/null cd "$@" then printf $(pwd) sed echo -eu --verbose
+	local ${HOME} sed cd $(pwd) echo grep | ${HOME} readonly $(pwd) ${HOME}
+		-eu ${HOME} cd ${HOME} then then cd then printf 'quoted text'
+--verbose echo /usr/bin x=1 awk test 2>/dev/null | "$1" export
+sed cd ${HOME} then | then export 'quoted text' ${HOME} sed awk awk 'quoted text'
+		cd local --verbose /usr/bin awk test
+	done && "$@" "$1" export then cd echo 'quoted text'
+		grep && grep printf export sed --verbose
+		&& printf readonly /usr/bin | /usr/bin awk "$1" "$@" readonly export
+		done local | && cd grep local --verbose ${HOME} /usr/bin -eu -eu awk x=1
+'quoted text' | printf test --verbose "$@" /usr/bin sed
+| export then test && done | printf sed ${HOME} "$@" 2>/dev/null
+done ${HOME} ${HOME} readonly
+	done test echo x=1 ${HOME} printf | test done $(pwd) $(pwd) "$@"
+test /usr/bin grep sed "$1" x=1 ${HOME} awk |
+"$@" | x=1 echo $(pwd) awk 2>/dev/null readonly cd test
+	sed 2>/dev/null grep "$@" | 'quoted text'
+		"$@" test && $(pwd) "$1" test /usr/bin grep readonly
+	${HOME} local cd awk test then done done
+$(pwd) printf -eu awk done test sed
+	export && done done awk 2>/dev/null $(pwd) "$@" done local local grep -eu "$@"
+	| "$1" 'quoted text' && test then --verbose grep | printf test then 2>/dev/null
+		local sed "$@" grep echo ${HOME} 2>/dev/null x=1 sed export sed && "$1" printf
+	'quoted text' grep x=1 printf | --verbose echo
+	"$@" $(pwd) "$@" printf --verbose then done /usr/bin sed cd /usr/bin
+"$@" printf awk /usr/bin $(pwd) grep
+		-eu --verbose export "$@" 'quoted text' | /usr/bin
+	$(pwd) sed echo $(pwd)
+local "$1" "$1" export sed grep
+${HOME} 'quoted text' 'quoted text'
+	&& /usr/bin printf -eu then printf /usr/bin && | printf echo ${HOME}
+'quoted text' && cd then "$@" export cd &&
+		/usr/bin 2>/dev/null "$1" grep "$1" done export 'quoted text' export
+$(pwd) awk /usr/bin test sed local grep 'quoted text' local then
+awk export -eu && echo 2>/dev/null
+		$(pwd) sed x=1 local -eu grep $(pwd) local "$1" -eu test
+	then $(pwd) export sed readonly awk
+test $(pwd) x=1 'quoted text' test "$1" 'quoted text' done grep cd /usr/bin
+		local && then sed cd "$@" echo test
+--verbose $(pwd) $(pwd) echo --verbose done printf 2>/dev/null |
+	test $(pwd) && cd echo echo -eu then | awk
+		done printf | | ${HOME} 'quoted text' done
+	awk cd readonly export awk readonly
+		printf 'quoted text' ${HOME} /usr/bin then x=1 export grep then done
+		$(pwd) 2>/dev/null -eu "$1"
+	2>/dev/null x=1 /usr/bin echo -eu then --verbose 'quoted text' echo cd
+		'quoted text' awk 'quoted text' "$@" -eu export && -eu test "$@" then
+		grep | && test --verbose grep export -eu
+echo $(pwd) echo $(pwd) cd -eu
+	x=1 grep awk readonly --verbose
+		x=1 cd && | grep sed /usr/bin && cd grep /usr/bin -eu export
+		done $(pwd) done local cd done x=1 export then export --verbose /usr/bin
+	export sed 2>/dev/null sed awk 2>/dev/null | ${HOME} | $(pwd)
+	/usr/bin /usr/bin ${HOME} --verbose echo "$1" echo "$@" -eu "$1"
+local local done readonly 'quoted text' sed -eu
+done 'quoted text' printf $(pwd) grep
+x=1 | then --verbose readonly done awk "$@" /usr/bin | printf awk -eu local
+	printf && x=1 awk echo -eu --verbose --verbose done readonly 'quoted text'
+test then printf ${HOME} x=1 x=1 cd 'quoted text' echo $(pwd)
+		then "$1" cd "$1" local done test "$1" grep
+		-eu "$@" readonly 'quoted text' -eu --verbose done awk export 2>/dev/null
+export cd done $(pwd) "$1"
+		awk 2>/dev/null -eu printf
+"$@" test x=1 local "$@" "$1" $(pwd) readonly ${HOME} grep && sed
+&& local local && 'quoted text'
+grep -eu export | --verbose && "$@" readonly printf
+	test --verbose sed /usr/bin
+sed local cd 2>/dev/null 2>/dev/null
+		cd sed "$1" export test sed | | grep local x=1 "$1" ${HOME} "$1" export
+	awk 'quoted text' test | /usr/bin
+		x=1 "$@" printf sed cd --verbose cd 2>/dev/null cd x=1 -eu printf
+		2>/dev/null printf awk /usr/bin ${HOME} x=1 | | export
+echo printf printf cd 'quoted text' awk /usr/bin $(pwd) grep then "$1" "$@" "$1"
+test "$@" 'quoted text' readonly printf echo echo
+		then export done grep echo "$@" export $(pwd)
+		then x=1 readonly printf "$@" printf
+	export readonly | /usr/bin
+test "$@" 2>/dev/null -eu
+	printf test awk x=1 $(pwd) $(pwd)
+		export "$1" cd ${HOME} && x=1 --verbose test 'quoted text' x=1 printf
+readonly -eu echo $(pwd) export $(pwd)
+export --verbose readonly "$@" then
+echo /usr/bin sed && sed | awk readonly echo "$1" x=1 x=1 awk 'quoted text'
+	done then | -eu ${HOME} awk ${HOME} --verbose awk "$1" 'quoted text'
+export $(pwd) | 'quoted text' local printf
+		printf awk && readonly 2>/dev/null /usr/bin
+		printf /usr/bin export sed test then "$@" 'quoted text'
+	printf $(pwd) x=1 grep $(pwd) test echo awk x=1 grep -eu && | --verbose
+		sed --verbose -eu ${HOME}
+		| -eu -eu export "$@" printf printf echo
+| && sed "$@" grep ${HOME} ${HOME} --verbose export && grep local x=1
+cd grep /usr/bin export awk
+	2>/dev/null /usr/bin awk -eu 'quoted text' export | 2>/dev/null
+		"$@" echo 2>/dev/null
+test | "$1" awk then done
+'quoted text' cd ${HOME} readonly $(pwd) readonly echo test ${HOME} done printf
+		"$@" $(pwd) export --verbose
+	test ${HOME} $(pwd) 2>/dev/null awk awk echo
+		"$@" sed "$1" then readonly awk echo "$@" x=1 echo test | readonly sed x=1
+		test $(pwd) test cd ${HOME} echo --verbose cd 2>/dev/null
+	printf /usr/bin x=1 -eu 'quoted text'
+		--verbose sed cd && -eu -eu 2>/dev/null
+		2>/dev/null 'quoted text' | --verbose
+		local --verbose readonly export test sed "$@"
+'quoted text' && readonly --verbose test test readonly $(pwd) test sed readonly
+		echo echo 2>/dev/null $(pwd) x=1 $(pwd)
+awk --verbose grep echo --verbose sed test 'quoted text' x=1
+	local 2>/dev/null cd grep printf
+awk -eu 2>/dev/null then
+		grep -eu 'quoted text'
+$(pwd) /usr/bin awk $(pwd) && then --verbose 'quoted text'
+		-eu | readonly readonly "$@" 2>/dev/null "$@" printf -eu
+		then /usr/bin -eu -eu test then "$1" 'quoted text' &&
+	then x=1 /usr/bin "$@" --verbose 'quoted text' --verbose
+	x=1 test local /usr/bin | && | /usr/bin echo grep 'quoted text'
+cd local 'quoted text' --verbose "$@" readonly then test sed
+$(pwd) sed export "$@" ${HOME}
+		export sed done -eu then /usr/bin then 2>/dev/null
+		&& ${HOME} test /usr/bin --verbose
+	done /usr/bin test ${HOME} /usr/bin then test /usr/bin x=1 /usr/bin 2>/dev/null
+		printf && "$@" then printf grep ${HOME} -eu then sed -eu x=1 2>/dev/null local
+		echo "$1" 'quoted text' done done test sed "$@" ${HOME} grep
+	export /usr/bin test echo local 'quoted text' then
+		done --verbose /usr/bin "$1" 'quoted text'
+	echo -eu "$@" --verbose -eu printf cd then
+		then /usr/bin | ${HOME} $(pwd) test export 2>/dev/null then
+	sed 'quoted text' printf -eu 2>/dev/null echo /usr/bin "$@" x=1 'quoted text'
+	${HOME} ${HOME} done test "$@" "$@" 'quoted text' readonly sed done x=1
+		$(pwd) done export echo printf
+	grep test && "$1" 'quoted text' local
+awk local $(pwd) export
+		grep -eu | local 'quoted text' cd grep | echo cd cd ${HOME}
+	printf 2>/dev/null --verbose grep /usr/bin
+	-eu grep "$1" /usr/bin test
+	sed /usr/bin ${HOME} --verbose "$1" | grep printf readonly grep /usr/bin $(pwd)
+'quoted text' sed grep awk /usr/bin
+	test x=1 /usr/bin "$1" $(pwd) echo --verbose 'quoted text'
+	"$@" grep printf | 'quoted text' cd test printf grep cd | 2>/dev/null done
+		local x=1 then printf /usr/bin | then cd
+		local 'quoted text' --verbose done
+	&& readonly 2>/dev/null x=1 echo echo ${HOME}
+	export done awk readonly printf
+		$(pwd) 'quoted text' | grep local cd printf 'quoted text' /usr/bin && --verbose
+	${HOME} ${HOME} --verbose | ${HOME} sed $(pwd) printf --verbose
+awk $(pwd) "$1" echo grep 'quoted text' test 2>/dev/null "$@" &&
+x=1 $(pwd) && echo 2>/dev/null readonly -eu sed awk 2>/dev/null awk
+local ${HOME} test local "$@" "$1" grep $(pwd) export test done echo readonly
+		local $(pwd) 'quoted text' | sed printf cd test echo
+		readonly "$@" awk cd "$@" sed
+echo /usr/bin grep echo cd printf
+	'quoted text' printf | -eu "$1" echo cd $(pwd) "$1" "$1" readonly
+		cd --verbose $(pwd) | local done $(pwd) --verbose export
+"$1" -eu -eu --verbose printf local
+		'quoted text' sed 2>/dev/null ${HOME} cd grep 'quoted text' readonly
+test test "$1" "$1" done awk /usr/bin sed --verbose "$1" -eu | "$1" "$@" readonly
+	sed readonly done sed echo test echo done then x=1 echo printf 2>/dev/null "$1"
+		echo /usr/bin local test 2>/dev/null 2>/dev/null test local
+cd test then grep grep grep "$@"
+	cd /usr/bin then sed test done export /usr/bin export local echo ${HOME} $(pwd)
+		grep x=1 "$@" && $(pwd) cd echo $(pwd) x=1 --verbose test
+	cd | $(pwd) && 'quoted text' readonly sed $(pwd) 'quoted text'
+grep grep printf done printf export sed "$@" 'quoted text' --verbose "$1"
+		sed awk 2>/dev/null grep
+		awk readonly then awk done "$1"
+		x=1 "$@" grep "$@" done printf
+"$@" test /usr/bin /usr/bin then x=1 ${HOME} $(pwd)
+		"$1" grep then sed readonly awk
+	'quoted text' && ${HOME} printf 2>/dev/null "$1" printf ${HOME}
+	done 'quoted text' then then ${HOME}
+x=1 ${HOME} awk x=1 'quoted text' | "$@" "$1"
+	grep local sed then --verbose ${HOME} ${HOME} printf
+	&& echo "$@" grep "$@" --verbose /usr/bin local
+sed readonly export cd awk done /usr/bin grep then
+		--verbose 2>/dev/null | && export
+	-eu $(pwd) export 2>/dev/null | test ${HOME} x=1 then local
+	-eu 2>/dev/null "$@" test cd awk echo test "$@" 'quoted text'
+		$(pwd) --verbose then --verbose "$@" "$@" && readonly grep x=1 echo echo "$1"
+		2>/dev/null && grep | grep grep echo /usr/bin "$@"
+echo cd grep echo 'quoted text' | -eu 'quoted text' | local test
+2>/dev/null sed local /usr/bin && done && export awk
+		'quoted text' done /usr/bin
+	echo ${HOME} sed -eu "$1" /usr/bin --verbose "$@" /usr/bin
+		done "$1" | x=1 awk | $(pwd) readonly ${HOME}
+		"$1" done 2>/dev/null done awk readonly test "$@" | echo grep then
+		printf local --verbose grep grep /usr/bin --verbose
+	&& sed done cd 'quoted text' 'quoted text' 'quoted text'
+	readonly | printf 2>/dev/null echo -eu
+readonly then awk printf
+awk sed && local "$1" export echo "$1" $(pwd) -eu --verbose
+		readonly done -eu "$@" 2>/dev/null
+	done ${HOME} $(pwd) | sed test readonly sed "$@" done echo 'quoted text'
+	then 2>/dev/null && echo ${HOME} | test done awk awk /usr/bin /usr/bin echo
+	| then local x=1 sed --verbose | "$1" grep export done test sed sed -eu "$@"
+&& echo "$1" awk readonly printf readonly && /usr/bin
+| $(pwd) ${HOME} export -eu --verbose "$@" local sed test
+	export $(pwd) sed awk ${HOME}
+		-eu ${HOME} "$1" /usr/bin sed
+done && | -eu readonly readonly | --verbose ${HOME} "$1"
+		2>/dev/null test echo cd $(pwd) | echo then /usr/bin readonly
+then readonly printf cd && | "$1" echo cd "$@" printf -eu /usr/bin /usr/bin
+		local && $(pwd) grep echo 2>/dev/null export then grep ${HOME} cd
+	${HOME} cd /usr/bin done grep readonly 2>/dev/null
+		| $(pwd) readonly --verbose
+cd local | --verbose cd --verbose --verbose x=1
+	sed awk done && then $(pwd) awk grep cd | 2>/dev/null &&
+'quoted text' echo --verbose "$1" awk done then --verbose awk 2>/dev/null "$1"
+printf 'quoted text' 2>/dev/null
+	local then grep "$@" 2>/dev/null ${HOME}
+	-eu then $(pwd) "$1" --verbose then --verbose
+		done awk 2>/dev/null 'quoted text' $(pwd) echo readonly sed printf "$@" | awk "$1"
+		grep "$@" done echo "$1" --verbose
+		&& $(pwd) $(pwd) then x=1 test local
+export done readonly 'quoted text' readonly 2>/dev/null
+	-eu --verbose done awk "$@" local | test "$1" -eu readonly
+	${HOME} /usr/bin | done readonly echo printf
+	-eu "$1" 2>/dev/null cd x=1 | awk then test cd then
+-eu | /usr/bin awk readonly | local
+test readonly printf "$@" 2>/dev/null
+		/usr/bin | --verbose
+test x=1 sed && -eu export x=1 export --verbose 2>/dev/null sed
+	cd --verbose x=1 then $(pwd) | "$@" ${HOME} grep x=1
+${HOME} /usr/bin 'quoted text' 2>/dev/null cd --verbose
+		"$@" local done x=1 x=1 --verbose
+		grep --verbose 2>/dev/null
+		export | -eu $(pwd) local x=1
+		export grep cd -eu x=1 export readonly x=1 x=1 2>/dev/null grep
+	printf -eu ${HOME} done
+		'quoted text' readonly | | cd "$1" test
+	printf done export /usr/bin test sed cd local
+2>/dev/null test $(pwd) echo
+printf -eu done $(pwd) done then $(pwd)
+readonly | sed 2>/dev/null cd "$@" /usr/bin done 'quoted text' -eu "$@" 2>/dev/null
+	'quoted text' echo /usr/bin awk grep
+		done 2>/dev/null | x=1 export test $(pwd)
+		local $(pwd) local export $(pwd)
+	sed 2>/dev/null /usr/bin sed cd --verbose
+awk awk ${HOME} sed ${HOME} ${HOME} test test sed -eu
+		awk 'quoted text' 'quoted text' done 2>/dev/null $(pwd) echo
+		local readonly -eu $(pwd) sed cd test
+		readonly 'quoted text' /usr/bin
+		x=1 /usr/bin grep grep then
+	-eu then 'quoted text' "$1" --verbose "$1"
+	test ${HOME} | --verbose 'quoted text' printf 2>/dev/null -eu $(pwd)
+		| then echo readonly done echo
+'quoted text' readonly /usr/bin -eu ${HOME} && test -eu
+readonly x=1 then -eu then cd ${HOME} ${HOME} export --verbose export sed
+		local 2>/dev/null ${HOME} export local && printf
+		awk cd cd --verbose ${HOME} export "$@" printf
+	| printf x=1 -eu --verbose && --verbose --verbose test --verbose
+	| then echo cd -eu export cd $(pwd) readonly $(pwd) /usr/bin then "$@"
+readonly then then then echo echo printf -eu cd readonly
+awk test readonly then done done && export "$@" /usr/bin "$@" test
+		x=1 sed sed printf cd then done /usr/bin $(pwd) readonly
+		/usr/bin --verbose ${HOME} echo sed 2>/dev/null
+cd $(pwd) x=1 printf -eu
+-eu /usr/bin cd -eu 'quoted text' x=1 2>/dev/null $(pwd) test | && --verbose sed
+		test awk done /usr/bin grep "$@" --verbose 'quoted text' -eu local
+		${HOME} /usr/bin cd printf 2>/dev/null local awk "$@" 'quoted text' printf
+		printf echo readonly test echo 'quoted text' cd printf | x=1 "$@" 'quoted text'
+then printf 2>/dev/null test awk --verbose then | local ${HOME} x=1 export /usr/bin
+		then cd export local 2>/dev/null cd ${HOME} then $(pwd) 'quoted text'
+		done grep sed export local grep ${HOME} grep $(pwd) sed | /usr/bin
+		| awk "$1" grep echo local 2>/dev/null | export ${HOME} /usr/bin awk grep cd ${HOME}
+sed x=1 export $(pwd) $(pwd) 'quoted text' export ${HOME} /usr/bin
+	local x=1 /usr/bin done
+	readonly awk $(pwd) echo printf ${HOME} $(pwd) awk -eu test then export
+		| 2>/dev/null grep x=1 2>/dev/null 2>/dev/null 2>/dev/null
+		2>/dev/null --verbose 2>/dev/null readonly export local $(pwd)
+	x=1 awk cd echo 2>/dev/null 2>/dev/null 'quoted text'
+	2>/dev/null ${HOME} --verbose cd printf test echo export -eu &&
+printf | awk 'quoted text' echo done
+		-eu test then && cd grep sed --verbose /usr/bin
+		echo 2>/dev/null local ${HOME}
+	/usr/bin test done 2>/dev/null printf sed
+	$(pwd) $(pwd) printf "$@" printf
+| sed echo sed echo "$1" readonly ${HOME} sed -eu x=1 ${HOME} ${HOME}
+		--verbose x=1 grep readonly | test test then 2>/dev/null
+/usr/bin "$@" | test $(pwd) export
+${HOME} export -eu && awk -eu "$@" done "$@" done printf /usr/bin awk "$@"
+		"$@" --verbose printf && sed ${HOME} cd echo && then x=1 "$@"
+readonly $(pwd) grep export /usr/bin
+done $(pwd) ${HOME} grep &&
+	readonly export --verbose x=1 awk 2>/dev/null done -eu 'quoted text'
+		echo export test awk /usr/bin x=1 2>/dev/null -eu 2>/dev/null -eu
+	echo | 'quoted text' --verbose
+local -eu x=1 echo readonly
+	${HOME} $(pwd) cd /usr/bin grep x=1 then && export x=1 ${HOME} /usr/bin && && cd
+then $(pwd) 2>/dev/null && done grep printf
+		&& awk 'quoted text' "$@" -eu
+		grep ${HOME} sed done x=1 "$1" export $(pwd) "$1" 'quoted text'
+		$(pwd) --verbose "$@" done "$1" grep done done
+		awk --verbose echo 2>/dev/null test
+	&& | grep 'quoted text' cd /usr/bin 'quoted text'
+	export 'quoted text' done echo then awk then $(pwd)
+	local printf | $(pwd) 'quoted text'
+	grep -eu $(pwd) sed awk "$1" &&
+	sed awk $(pwd) ${HOME} "$@" readonly $(pwd) test $(pwd)
+export local done "$@" ${HOME} done then grep x=1
+	test sed grep && && "$1" echo 2>/dev/null 'quoted text'
+	-eu /usr/bin x=1 awk done printf local sed --verbose printf awk --verbose
+		${HOME} echo ${HOME} sed $(pwd) grep
+		then -eu printf --verbose grep
+		test "$1" awk $(pwd) awk awk --verbose ${HOME} test 'quoted text' cd x=1 | readonly
+	"$@" done --verbose x=1 --verbose
+		awk --verbose --verbose sed /usr/bin done x=1 printf test "$@" --verbose
+		export awk 2>/dev/null 'quoted text'
+done export grep | 2>/dev/null --verbose
+		readonly awk ${HOME} "$1" -eu awk grep readonly ${HOME} "$1" done 'quoted text'
+		--verbose | -eu done /usr/bin cd then -eu ${HOME} 'quoted text'
+	grep --verbose $(pwd) echo cd sed 'quoted text' "$@" --verbose printf done /usr/bin
+		/usr/bin sed printf | export 2>/dev/null cd test test && awk | x=1 readonly |
+		awk ${HOME} | local | "$1" /usr/bin | --verbose | -eu then grep |
+"$@" x=1 cd printf awk /usr/bin awk
+	2>/dev/null | cd grep -eu 2>/dev/null $(pwd)
+	awk && && export "$1" readonly 'quoted text' local
+	sed local 'quoted text' echo --verbose
+export grep | x=1 echo test "$1" readonly
+		awk readonly "$@" awk local ${HOME} "$@" export
+	/usr/bin x=1 --verbose then sed
+	"$1" 'quoted text' awk /usr/bin done local sed
+grep test x=1 2>/dev/null sed -eu 'quoted text' echo local | "$@" echo
+		&& --verbose -eu grep x=1 2>/dev/null local ${HOME} | /usr/bin
+	awk && $(pwd) export grep 2>/dev/null
+		echo awk export done done 2>/dev/null /usr/bin | 'quoted text'
+done sed | echo sed "$1" "$@" --verbose export cd
+test $(pwd) cd test $(pwd) grep cd export
+		test "$1" printf sed ${HOME} sed grep awk cd readonly grep && done grep echo
+2>/dev/null -eu "$@" sed 2>/dev/null then echo then ${HOME} grep readonly
+		-eu awk sed 'quoted text' "$@" -eu cd done
+--verbose | x=1 && awk x=1 $(pwd) local grep -eu grep -eu ${HOME}
+$(pwd) sed cd done printf cd "$@" "$1" -eu $(pwd)
+		--verbose sed awk awk awk $(pwd) x=1 echo test sed "$@" | /usr/bin printf -eu
+	${HOME} grep $(pwd) done local awk 'quoted text' echo 'quoted text'
+		--verbose ${HOME} x=1
+	$(pwd) done local readonly x=1 awk sed -eu $(pwd)
+	export grep done readonly then awk export test
+${HOME} export export export readonly
+	${HOME} /usr/bin x=1 'quoted text' sed then grep then readonly /usr/bin test
+	printf | 2>/dev/null then printf x=1
+		--verbose echo then readonly sed x=1 awk local awk local "$@" readonly
+cd test ${HOME} grep | sed local 2>/dev/null awk $(pwd)
+	then done test --verbose $(pwd) export echo $(pwd) /usr/bin then done test done
+		readonly sed test local | test export x=1 ${HOME} x=1
+	-eu && 2>/dev/null done grep --verbose 2>/dev/null "$@" 'quoted text'
+	-eu /usr/bin export printf local -eu ${HOME} && /usr/bin sed cd done cd grep
+sed ${HOME} x=1 done | ${HOME} "$1" local done
+	"$1" --verbose --verbose 2>/dev/null $(pwd)
+2>/dev/null "$1" cd 'quoted text'
+	-eu ${HOME} printf && && /usr/bin "$1" cd echo awk done done then
+		/usr/bin --verbose awk $(pwd) sed "$@" && $(pwd)
+	printf ${HOME} 'quoted text' /usr/bin sed awk
+	&& export x=1 ${HOME} --verbose "$@" "$1" local "$@" then test "$1" "$1" $(pwd)
+	echo /usr/bin "$@" grep 2>/dev/null printf | 'quoted text' ${HOME}
+	local 2>/dev/null sed 2>/dev/null && awk readonly /usr/bin local --verbose
+-eu readonly test /usr/bin x=1 'quoted text'
+	--verbose done "$1" grep export $(pwd) done "$@" --verbose 2>/dev/null
+${HOME} sed $(pwd) grep 2>/dev/null "$@" "$@" done sed sed local
+"$@" readonly /usr/bin sed /usr/bin 2>/dev/null 'quoted text'
+	awk -eu && cd --verbose --verbose test ${HOME} printf
+2>/dev/null -eu sed sed -eu readonly awk
+		local 2>/dev/null echo printf x=1
+export "$1" && local "$@" 'quoted text' 2>/dev/null done printf 'quoted text'
+grep "$@" /usr/bin ${HOME}
+	sed then -eu /usr/bin echo $(pwd) 2>/dev/null "$@" local
+cd readonly "$@" && "$1" "$@" x=1 "$@" -eu
+	sed readonly "$1" -eu then -eu echo -eu local -eu /usr/bin 2>/dev/null 2>/dev/null
+readonly awk echo cd readonly echo cd
+		$(pwd) "$1" && sed printf 2>/dev/null 'quoted text'
+	| done /usr/bin cd test done awk "$1" local ${HOME}
+		local grep printf "$1" cd "$@" awk
+		printf $(pwd) sed | -eu 'quoted text' test cd | "$1" export test
+printf x=1 done "$@" && ${HOME} ${HOME} 2>/dev/null
+		then ${HOME} $(pwd) sed 2>/dev/null done printf x=1 x=1 'quoted text'
+done x=1 $(pwd) done test ${HOME} -eu "$@" | -eu export 2>/dev/null
+	then $(pwd) /usr/bin echo "$@" echo |
+x=1 done "$@" echo printf "$@" then -eu export local
+		readonly && awk "$@" ${HOME} printf printf local printf printf sed "$@" --verbose
+cd cd echo test x=1 then cd awk
+"$1" echo ${HOME} cd done x=1 then "$@" then x=1 sed
+		sed ${HOME} test /usr/bin 2>/dev/null awk local ${HOME} "$1" /usr/bin echo
+		"$1" /usr/bin grep ${HOME} readonly && $(pwd)
+'quoted text' awk "$1" echo test ${HOME} readonly test export --verbose
+"$@" echo && cd "$1" echo x=1 ${HOME}
+		cd test echo --verbose sed echo /usr/bin 'quoted text' 'quoted text'
+"$@" cd export ${HOME}
+echo -eu --verbose grep && $(pwd) | awk x=1 && printf local "$1" echo
+		$(pwd) grep local readonly
+"$@" grep printf awk awk
+		awk -eu export $(pwd) grep grep
+	"$1" -eu printf && $(pwd)
+-eu export then 2>/dev/null --verbose $(pwd) done printf | awk && x=1
+then "$@" test x=1 /usr/bin /usr/bin /usr/bin /usr/bin 'quoted text'
+	--verbose --verbose --verbose && cd && /usr/bin "$@" 2>/dev/null
+$(pwd) export test printf
+		--verbose -eu 2>/dev/null "$1" --verbose
+2>/dev/null | 2>/dev/null "$@" printf x=1 local printf "$1" "$@" awk
+"$@" 2>/dev/null awk sed then echo "$1" done local
+readonly ${HOME} sed --verbose
+$(pwd) export then sed then $(pwd) ${HOME} test "$@" | awk ${HOME} 'quoted text'
+printf 2>/dev/null then ${HOME} -eu "$@" -eu $(pwd)
+		"$@" 'quoted text' "$@" done $(pwd) echo ${HOME} "$@" x=1 $(pwd) $(pwd) && 'quoted text'
+	test readonly | echo export done grep 2>/dev/null cd sed
+		&& --verbose "$@" echo 2>/dev/null x=1 done --verbose 'quoted text' --verbose
+then then export then /usr/bin
+	'quoted text' cd | --verbose -eu 'quoted text' grep ${HOME} cd --verbose
+		2>/dev/null "$1" awk "$1" export
+	-eu x=1 x=1 cd then $(pwd) cd 2>/dev/null
+	test /usr/bin 'quoted text' printf "$1" then ${HOME} | | printf
+		${HOME} -eu "$@" /usr/bin
+	${HOME} $(pwd) local $(pwd) "$1" test x=1
+"$1" awk -eu test -eu "$1" $(pwd) --verbose
+		readonly --verbose | "$@" "$@" echo /usr/bin
+	--verbose echo "$@" printf readonly printf then echo && cd ${HOME} | then "$1" echo
+		readonly /usr/bin test cd echo test then done local
+&& -eu readonly readonly /usr/bin local cd 2>/dev/null grep
+		2>/dev/null $(pwd) awk echo /usr/bin then then | grep "$@" cd
+	/usr/bin done cd export export ${HOME} done test done $(pwd)
+	grep cd readonly && export awk && printf "$1" grep --verbose
+		echo printf done grep --verbose readonly
+	test test awk "$1" $(pwd) -eu 2>/dev/null "$@" printf -eu printf echo local printf
+		${HOME} "$@" -eu "$1"
+export awk $(pwd) sed $(pwd)
+x=1 --verbose && done printf "$1"
+		${HOME} ${HOME} readonly
+	export grep cd ${HOME} 2>/dev/null /usr/bin local
+	awk "$@" awk readonly 'quoted text'
+/usr/bin test "$@" readonly
+	awk /usr/bin "$@" $(pwd) local awk ${HOME} echo echo local echo printf $(pwd) then
+	then printf 'quoted text' | grep echo -eu "$@" "$1" sed x=1
+grep 'quoted text' awk /usr/bin 'quoted text' then readonly --verbose
+		readonly echo local done then ${HOME}
+done cd done sed grep --verbose echo sed | -eu "$1"
+		sed x=1 | cd done then --verbose cd --verbose "$1" 'quoted text'
+"$@" && 2>/dev/null local then
+		${HOME} 2>/dev/null echo | printf cd "$@" 2>/dev/null export && awk -eu
+		cd | test test | --verbose awk ${HOME} "$@" x=1 done local
+$(pwd) 2>/dev/null readonly then && --verbose $(pwd) /usr/bin
+cd readonly echo x=1 done grep readonly cd done
+		"$@" printf then test 'quoted text'
+	sed x=1 --verbose | 2>/dev/null sed 2>/dev/null && 'quoted text'
+		x=1 $(pwd) $(pwd) "$1" | 'quoted text'
+$(pwd) x=1 $(pwd) export --verbose
+sed readonly grep 2>/dev/null
+		then sed awk --verbose grep && "$@" 2>/dev/null
+	then --verbose sed "$1" done awk | grep local "$@" "$1" echo test sed printf
+		grep "$1" x=1 $(pwd)
+	x=1 export done grep
+$(pwd) done cd /usr/bin
+2>/dev/null readonly awk -eu cd /usr/bin cd sed readonly
+		awk "$1" readonly local test | $(pwd) 'quoted text' echo done 2>/dev/null x=1
+		"$@" 'quoted text' /usr/bin printf ${HOME}
+		2>/dev/null then x=1 sed /usr/bin
+	sed | awk grep awk cd grep
+		| local test readonly 2>/dev/null
+	/usr/bin awk $(pwd) local done
+echo $(pwd) printf printf echo "$1" | then
+	| && export then echo 2>/dev/null | grep
+export ${HOME} --verbose "$1" | local then "$@" -eu | awk "$@"
+	export test --verbose
+		x=1 export export cd /usr/bin 2>/dev/null $(pwd) -eu local then
+		export "$@" echo ${HOME} 2>/dev/null sed sed
+'quoted text' && export readonly --verbose export export
+--verbose ${HOME} ${HOME} x=1 x=1 printf printf ${HOME}
+	"$1" awk printf then --verbose
+	"$1" awk x=1 export done
+| echo readonly local echo | export $(pwd) ${HOME} | export done -eu -eu /usr/bin
+		test then && grep cd && --verbose --verbose /usr/bin 2>/dev/null grep test
+2>/dev/null 'quoted text' local grep | ${HOME} readonly printf echo grep
+		$(pwd) then && x=1 done printf x=1 export readonly x=1 then x=1 then x=1 awk cd
+		x=1 done 2>/dev/null echo "$1" | readonly x=1 echo export
+	$(pwd) $(pwd) --verbose
+	2>/dev/null /usr/bin export --verbose ${HOME}
+	--verbose "$@" echo $(pwd) "$@"
+		printf echo 2>/dev/null
+sed 2>/dev/null "$@" echo
+	--verbose 'quoted text' | -eu 2>/dev/null
+		then printf done printf
+	'quoted text' $(pwd) 'quoted text' 'quoted text' export 'quoted text' && awk x=1
+	2>/dev/null awk /usr/bin done "$1" awk done $(pwd)
+		cd awk test printf grep /usr/bin awk test
+		then "$1" 'quoted text' 'quoted text' && x=1
+${HOME} awk 2>/dev/null --verbose export $(pwd) $(pwd)
+		grep readonly test --verbose $(pwd) ${HOME} --verbose
+	2>/dev/null 2>/dev/null done echo 2>/dev/null grep "$@" cd && sed awk
+		local grep awk 'quoted text' -eu sed local /usr/bin | "$1" grep grep
+export "$1" /usr/bin && x=1 && "$@" "$@" export /usr/bin x=1 &&
+	$(pwd) | export test readonly echo echo echo --verbose $(pwd)
+	$(pwd) sed "$@" ${HOME} "$@" |
+		grep -eu && 2>/dev/null readonly
+'quoted text' export -eu && /usr/bin
+		${HOME} x=1 printf 2>/dev/null echo $(pwd) --verbose && 2>/dev/null readonly
+		local readonly -eu 'quoted text' test grep 2>/dev/null done
+		cd --verbose && then $(pwd) 2>/dev/null | cd "$1" readonly --verbose
+		done x=1 | awk local --verbose cd $(pwd) ${HOME} "$@"
+'quoted text' 2>/dev/null done awk x=1 /usr/bin ${HOME} && ${HOME}
+'quoted text' 2>/dev/null 'quoted text' --verbose 2>/dev/null
+	awk awk 'quoted text' $(pwd) "$@" awk &&
+${HOME} awk /usr/bin x=1 readonly "$1" then
+&& 'quoted text' grep | test 'quoted text' local printf 2>/dev/null
+echo /usr/bin 'quoted text' 'quoted text' /usr/bin done
+		done echo export | ${HOME} readonly
+	&& | sed /usr/bin 'quoted text'
+cd && export x=1 $(pwd) |
+$(pwd) /usr/bin export -eu local test echo
+$(pwd) -eu test cd sed readonly
+	sed printf "$1" grep awk && -eu 'quoted text'
+| -eu test echo printf cd grep $(pwd) && then |
+		cd then x=1 echo done readonly |
+		sed x=1 grep cd awk /usr/bin -eu grep -eu | 'quoted text' --verbose
+| 'quoted text' cd printf x=1 awk && then | sed
+test "$1" /usr/bin ${HOME}
+	"$1" then test then 2>/dev/null
+		awk local local ${HOME} export grep 'quoted text' 'quoted text'
+| then echo && printf awk readonly
+		printf "$@" && local export cd "$1" && awk readonly test x=1 --verbose
+		awk printf | awk awk --verbose readonly x=1
+		cd then | -eu then printf echo then printf
+cd test readonly | echo printf ${HOME} /usr/bin then
+		grep export $(pwd) then
+then test sed sed grep grep
+	awk local -eu 2>/dev/null $(pwd)
+x=1 x=1 then 'quoted text' "$@" | test local $(pwd) 'quoted text'
+	x=1 local done awk 'quoted text' local done done readonly then then printf
+	$(pwd) awk local ${HOME} sed echo "$1" sed --verbose then --verbose awk
+		$(pwd) grep export 2>/dev/null
+awk printf && awk 'quoted text' -eu echo -eu printf
+	&& then then 2>/dev/null local done grep grep grep then readonly && grep
+&& --verbose sed 2>/dev/null 'quoted text' ${HOME} done readonly then ${HOME}
+		printf readonly "$@" awk /usr/bin echo $(pwd) readonly $(pwd) | test "$@"
+	${HOME} export 'quoted text' | export 'quoted text' 'quoted text' 'quoted text'
+	--verbose && printf && then local local
+'quoted text' ${HOME} done | readonly echo export x=1 sed awk
+		${HOME} then --verbose --verbose sed "$@" awk local 2>/dev/null 2>/dev/null
+/usr/bin sed $(pwd) export
+-eu export echo -eu echo
+sed && "$@" ${HOME} done x=1 readonly done awk awk 2>/dev/null awk "$1" export
+		then ${HOME} printf | "$1" cd
+awk --verbose done "$@" -eu "$1" 'quoted text'
+printf local then readonly | "$@" /usr/bin
+	test cd readonly "$1" -eu grep cd sed sed
+		readonly $(pwd) "$@" --verbose "$1" test 2>/dev/null
+	local printf && local ${HOME} x=1 -eu test test 2>/dev/null
+		'quoted text' printf printf x=1 cd /usr/bin test cd test ${HOME} "$@" | readonly
+	cd "$@" && && cd "$@" awk 2>/dev/null
+&& 2>/dev/null "$1" export && grep done
+		sed 2>/dev/null --verbose && done |
+$(pwd) "$1" | $(pwd) awk
+"$@" then 2>/dev/null local cd -eu
+		local printf "$1" $(pwd) ${HOME} echo sed done sed --verbose ${HOME} export
+test $(pwd) | export export "$@" echo local readonly awk "$1"
+	export readonly --verbose echo | && then --verbose
+	-eu local --verbose "$1" $(pwd) /usr/bin
+	printf /usr/bin local x=1 done printf
+		cd echo -eu -eu --verbose sed ${HOME} echo /usr/bin
+readonly printf -eu then
+		echo local echo awk x=1 local ${HOME} ${HOME} 2>/dev/null grep 'quoted text'
+	grep "$@" cd grep "$1" then cd then x=1 ${HOME} cd
+		readonly ${HOME} done /usr/bin readonly x=1 export /usr/bin
+	-eu --verbose then readonly test
+	printf "$@" export /usr/bin printf ${HOME} echo test
+		then awk && /usr/bin | printf test $(pwd) awk
+		sed /usr/bin readonly then test "$@" $(pwd) x=1 local 'quoted text'
+	sed sed -eu x=1 /usr/bin 2>/dev/null 'quoted text' "$@" $(pwd)
+		--verbose grep --verbose export x=1 printf -eu --verbose readonly -eu --verbose
+	printf "$1" printf sed /usr/bin then done echo $(pwd)
+		$(pwd) | /usr/bin echo $(pwd) x=1 sed --verbose
+		| | echo 2>/dev/null then done printf
+then --verbose test awk sed local
+awk /usr/bin $(pwd) "$1" echo 'quoted text' export sed "$1" echo test then /usr/bin
+	echo "$1" test && readonly printf sed then cd cd $(pwd) printf printf $(pwd) done
+printf local -eu "$1" x=1 export
+	then ${HOME} printf x=1 -eu --verbose echo
+	done awk | export awk $(pwd) awk grep export printf
+		grep printf local then 2>/dev/null && cd /usr/bin $(pwd) 2>/dev/null
+	2>/dev/null readonly "$1" | "$1" then
+		/usr/bin sed x=1 /usr/bin 'quoted text' cd | $(pwd) printf
+x=1 test then -eu cd | 'quoted text' echo
+		$(pwd) grep local done printf done printf printf cd echo $(pwd) grep printf sed
+		test sed then grep 'quoted text' | -eu /usr/bin && "$1" 'quoted text'
+x=1 awk | --verbose && done 2>/dev/null echo export $(pwd) sed x=1 readonly
+sed grep readonly printf 'quoted text' then -eu done
+		--verbose then readonly /usr/bin cd done then | /usr/bin | local
+	| "$1" --verbose 2>/dev/null readonly && echo
+	${HOME} $(pwd) x=1 echo done awk 'quoted text' -eu
+	then -eu | ${HOME} /usr/bin | grep /usr/bin local -eu 2>/dev/null
+	awk local echo "$1" && $(pwd) | $(pwd) awk then
+-eu awk -eu "$@" export done --verbose 2>/dev/null
+-eu awk echo /usr/bin export "$1" "$1" awk cd cd ${HOME} readonly done 'quoted text'
+/usr/bin ${HOME} awk export && sed "$@" 2>/dev/null readonly sed 'quoted text'
+		grep test -eu done printf
+	/usr/bin export done ${HOME} sed 2>/dev/null "$1" export 'quoted text'
+	2>/dev/null echo export "$1" | echo echo awk awk ${HOME} 2>/dev/null
+then && "$1" /usr/bin
+"$1" -eu grep "$@" && readonly then 'quoted text' && readonly local
+	sed done sed 'quoted text' grep awk done cd test 2>/dev/null awk $(pwd)
+x=1 ${HOME} done grep awk -eu export
+	/usr/bin ${HOME} "$1" grep local test "$@" grep sed /usr/bin /usr/bin done then
+	readonly "$@" ${HOME} done export "$@" "$1" test
+awk "$1" export --verbose $(pwd) grep 'quoted text' cd | export --verbose grep
+		sed echo echo -eu ${HOME} then "$1" local
+	done --verbose x=1 export sed then && "$1" $(pwd)
+local -eu echo $(pwd) echo && awk grep sed cd -eu done && readonly
+cd $(pwd) readonly "$@" | --verbose then -eu printf sed cd --verbose
+		"$@" sed done then awk && readonly x=1 sed | readonly printf 'quoted text'
+		${HOME} echo x=1 -eu readonly "$@" | cd --verbose && awk -eu /usr/bin done "$1"
+-eu 2>/dev/null test --verbose /usr/bin | done "$@" $(pwd)
+		test $(pwd) export "$1" --verbose grep grep 2>/dev/null cd /usr/bin
+grep x=1 readonly test sed x=1 printf done local local "$@" | awk done echo
+awk "$@" echo printf test /usr/bin 2>/dev/null done grep x=1 $(pwd)
+		--verbose cd then echo printf ${HOME} export && test readonly test 2>/dev/null
+echo && /usr/bin printf grep printf
+		x=1 && | awk awk "$@" && "$1" done x=1
+awk -eu $(pwd) "$1" grep
+	then test readonly export done -eu $(pwd) local -eu |
+		'quoted text' 'quoted text'
+"$@" done then | x=1 local --verbose | -eu printf readonly
+	local 'quoted text' 2>/dev/null
+		x=1 "$1" done 'quoted text' -eu x=1 printf
+done 'quoted text' 'quoted text' x=1 -eu | -eu export
+$(pwd) | ${HOME} --verbose printf readonly ${HOME} 2>/dev/null $(pwd)
+		$(pwd) test | grep ${HOME} local echo readonly "$1" awk printf export local
+		done x=1 done done $(pwd)
+		${HOME} awk local "$@" sed x=1 test readonly --verbose
+/usr/bin 2>/dev/null /usr/bin x=1 test printf
+echo grep "$1" cd 'quoted text' $(pwd) $(pwd) awk /usr/bin test
+test 2>/dev/null 2>/dev/null grep "$1" then export && /usr/bin
+		| x=1 export 2>/dev/null "$1" --verbose sed $(pwd) awk cd done -eu sed grep
+		local echo then readonly x=1 x=1 2>/dev/null cd printf echo --verbose /usr/bin
+		printf echo cd 2>/dev/null then && done awk -eu && ${HOME} cd x=1
+${HOME} test 2>/dev/null "$@" x=1 | /usr/bin echo -eu readonly $(pwd) "$@"
+	export sed | export grep | local readonly test grep sed grep &&
+	sed grep "$1" done "$@"
+	--verbose $(pwd) 'quoted text' x=1
+"$@" grep --verbose awk | ${HOME} -eu readonly x=1 "$1" then readonly then done
+readonly readonly && 'quoted text' && sed readonly
+	printf && grep printf export | grep readonly "$@" x=1 "$1" $(pwd) readonly grep
+		done x=1 "$@" sed ${HOME} local x=1 $(pwd) awk cd
+		&& readonly "$1" cd --verbose "$@" $(pwd) ${HOME} test -eu -eu x=1 awk
+${HOME} "$1" /usr/bin test awk readonly export 'quoted text' sed readonly
+		${HOME} then --verbose && "$@" echo "$1" && then export ${HOME} done local
+readonly cd /usr/bin local x=1
+		awk then 'quoted text' sed "$@"
+	awk "$1" done echo echo 'quoted text'
+	test "$1" | done -eu -eu then 2>/dev/null ${HOME} grep 2>/dev/null awk /usr/bin
+	printf | /usr/bin 'quoted text' local done then ${HOME} test
+		test 'quoted text' printf --verbose readonly
+		export readonly awk $(pwd)
+		test printf readonly x=1 --verbose "$1" then echo local --verbose
+	awk -eu /usr/bin test local sed /usr/bin test 2>/dev/null
+"$@" -eu echo echo export then --verbose cd
+	${HOME} cd sed && done test export --verbose /usr/bin printf
+	"$1" --verbose "$1" sed $(pwd) done sed printf "$1" echo cd 2>/dev/null sed
+/usr/bin x=1 /usr/bin && export grep ${HOME} -eu done
+$(pwd) readonly cd -eu export $(pwd) then | $(pwd) -eu
+		readonly done | x=1 echo --verbose printf sed awk /usr/bin
+	export grep test local then export 2>/dev/null -eu test && 'quoted text'
+	'quoted text' -eu x=1 export local
+${HOME} "$1" -eu 2>/dev/null 2>/dev/null /usr/bin
+"$1" "$@" readonly && --verbose
+		readonly x=1 -eu "$1" grep printf cd
+&& /usr/bin cd export /usr/bin 2>/dev/null x=1 then
+awk && -eu ${HOME} test x=1 "$1" && ${HOME} cd ${HOME}
+		x=1 --verbose local export cd echo --verbose 2>/dev/null "$1"
+		${HOME} 'quoted text' --verbose | /usr/bin
+	awk export sed ${HOME} grep | export cd sed && && printf && awk then
+echo grep readonly export 'quoted text' $(pwd) local export test cd 'quoted text'
+local 'quoted text' --verbose -eu $(pwd)
+	${HOME} grep -eu printf 'quoted text'
+		'quoted text' done readonly "$@"
+		echo && "$1" cd --verbose echo local 'quoted text' && && | echo && ${HOME}
+cd export readonly -eu grep awk
+		then echo grep then export --verbose
+		readonly 2>/dev/null cd printf
+2>/dev/null x=1 "$1" x=1 ${HOME} readonly printf ${HOME} then readonly && readonly
+$(pwd) cd cd test x=1 "$@"
+		sed 'quoted text' /usr/bin local test awk -eu 2>/dev/null
+	$(pwd) && $(pwd) local | then
+		"$1" && printf | printf then test
+	x=1 printf cd awk $(pwd) echo 2>/dev/null awk awk 'quoted text' awk cd | --verbose
+cd awk /usr/bin "$1" test test done ${HOME}
+	export local sed test done sed export 2>/dev/null "$@" "$1" ${HOME} -eu local
+		${HOME} $(pwd) && echo && done then sed done done && test
+	"$1" --verbose $(pwd) x=1 local 'quoted text' grep test x=1
+	--verbose x=1 cd "$1" $(pwd) echo grep "$@" && grep echo
+		awk -eu 2>/dev/null /usr/bin awk $(pwd)
+	readonly sed | grep local && then ${HOME}
+	2>/dev/null local x=1 2>/dev/null
+	test awk sed awk done printf
+		&& | done sed 2>/dev/null sed cd x=1 ${HOME} | x=1 cd $(pwd)
+		-eu echo -eu "$@" "$@" -eu && awk sed printf echo export awk cd 2>/dev/null
+cd export ${HOME} 2>/dev/null 'quoted text' x=1 echo /usr/bin awk -eu test
+test sed sed -eu -eu -eu readonly
+	then "$@" printf echo readonly
+		-eu test && ${HOME} echo echo x=1 'quoted text' /usr/bin $(pwd) awk
+then | /usr/bin export grep sed 2>/dev/null
+	x=1 'quoted text' echo
+2>/dev/null && --verbose "$@" 'quoted text' 'quoted text' 'quoted text' "$@" grep
+		&& readonly /usr/bin && -eu --verbose echo --verbose
+	test /usr/bin then awk "$@" --verbose done grep --verbose
+-eu x=1 'quoted text' printf printf "$1" sed test ${HOME} sed x=1 readonly done
+test -eu | test 2>/dev/null sed
+&& cd then readonly readonly 2>/dev/null awk
+	-eu then 'quoted text' x=1 $(pwd) test | sed ${HOME} --verbose
+		local done && grep echo export
+	done x=1 | ${HOME} /usr/bin echo 'quoted text'
+	export | 'quoted text' echo $(pwd) then readonly ${HOME} --verbose
+		export then -eu awk readonly --verbose 'quoted text' sed printf local echo
+done | done 2>/dev/null test ${HOME} ${HOME}
+	"$1" then --verbose export /usr/bin && && ${HOME}
+		then --verbose then done "$@" then --verbose printf printf $(pwd)
+	| ${HOME} printf readonly && grep local /usr/bin awk then
+	2>/dev/null | | $(pwd) cd
+	"$@" "$1" sed then 'quoted text'
+		then export sed | local 2>/dev/null grep sed && --verbose sed cd export ${HOME}
+	local readonly x=1 "$@" printf sed /usr/bin
+export --verbose /usr/bin cd | /usr/bin --verbose
+		2>/dev/null | -eu "$1" 2>/dev/null export
+		2>/dev/null local $(pwd) test printf /usr/bin
+		'quoted text' grep then printf sed "$@"
+test -eu awk readonly && "$@" -eu | --verbose then export x=1 "$1"
+grep "$1" x=1 cd echo | test 2>/dev/null
+local "$1" 'quoted text'
+		$(pwd) -eu "$1" "$@" printf done readonly --verbose
+x=1 && export grep readonly "$1" grep "$1" awk $(pwd) export --verbose readonly
+		cd echo echo done /usr/bin export
+&& cd printf export ${HOME}
+	| 2>/dev/null "$1" echo "$1" | readonly -eu readonly sed
+		| echo 2>/dev/null "$@" then grep ${HOME} $(pwd) then "$1" | cd done echo
+	done /usr/bin "$@" "$@" readonly
+"$@" --verbose "$1" awk cd /usr/bin test done "$@" done -eu x=1 export
+then | readonly "$1" grep test export readonly "$@"
+		then 2>/dev/null "$@" local grep sed
+| grep 2>/dev/null export printf -eu readonly 2>/dev/null grep | 'quoted text'
+cd awk | 'quoted text' cd export && awk --verbose then sed $(pwd) done
+		'quoted text' "$@" $(pwd) x=1 awk "$1" --verbose printf --verbose 'quoted text'
+	&& test readonly 'quoted text' grep awk grep readonly | && x=1 readonly
+	sed 'quoted text' test x=1 x=1 awk | local cd "$@" test x=1 done
+x=1 /usr/bin "$@" x=1 'quoted text'
+	cd 2>/dev/null grep 'quoted text' grep
+		readonly x=1 grep export awk x=1 echo readonly grep
+	"$@" 'quoted text' then sed
+'quoted text' "$1" /usr/bin $(pwd)
+		sed readonly grep $(pwd) then grep cd echo
+		| "$@" then 'quoted text' $(pwd)
+	sed 'quoted text' done "$1" cd export
+	test test test done /usr/bin
+	x=1 then local sed --verbose 2>/dev/null
+		test grep && && ${HOME} 2>/dev/null /usr/bin x=1 cd 2>/dev/null
+x=1 "$@" /usr/bin | $(pwd) printf 2>/dev/null "$1"
+echo export 'quoted text' export 2>/dev/null
+	-eu readonly "$1" -eu grep done x=1 "$@" "$@" "$1" printf test
+		x=1 2>/dev/null "$1" "$@"
+"$@" sed cd -eu "$@" --verbose test awk ${HOME}
+"$1" -eu -eu echo | "$@" && x=1 awk awk echo export
+	/usr/bin $(pwd) grep printf /usr/bin awk | 'quoted text' "$1" export
+		x=1 --verbose grep ${HOME} /usr/bin echo sed export printf printf
+	test grep && grep readonly sed grep $(pwd) "$1" export
+&& readonly echo 2>/dev/null echo
+local done readonly $(pwd) awk grep
+		sed grep export $(pwd) then $(pwd) done
+	then 'quoted text' done done readonly 'quoted text'
+--verbose /usr/bin $(pwd) x=1 --verbose sed readonly printf 2>/dev/null
+then echo ${HOME} cd 2>/dev/null export --verbose $(pwd) test printf done
+	readonly sed && grep cd echo local
+		x=1 export $(pwd) awk done
+x=1 2>/dev/null 'quoted text'
+| printf --verbose -eu 'quoted text' && awk echo then && cd && --verbose
+		'quoted text' cd "$@" --verbose -eu 'quoted text' ${HOME} $(pwd) sed --verbose
+		| ${HOME} --verbose 'quoted text' $(pwd) local -eu awk && ${HOME} "$1"
+awk /usr/bin printf "$1" readonly grep cd echo
+		"$1" printf "$1" awk echo -eu
+	cd local cd && done cd $(pwd)
+	printf /usr/bin grep export export && 2>/dev/null x=1 /usr/bin
+	${HOME} sed "$1" -eu "$1"
+--verbose -eu $(pwd) $(pwd) done --verbose test local
+	'quoted text' awk awk echo && export -eu test test ${HOME} echo ${HOME}
+	-eu local readonly cd echo "$1" 2>/dev/null cd
+		readonly "$1" && --verbose export sed
+	2>/dev/null then -eu grep "$@" awk test
+		x=1 test awk done -eu sed sed 'quoted text' cd | 'quoted text' printf --verbose
+	export x=1 sed local done --verbose done
+	printf --verbose 'quoted text'
@@ -0,0 +1,2001 @@
+	-eu 'quoted text' "$@" && local export "$@" grep sed
+printf 'quoted text' printf "$@" readonly awk local && awk then
+	then test done sed $(pwd) local && done test export
+	&& export x=1 cd 'quoted text' --verbose x=1
+	sed done test cd | grep local ${HOME}
+| sed | 'quoted text' done then 'quoted text' then 'quoted text' "$@"
+		/usr/bin $(pwd) grep echo | local --verbose local -eu 'quoted text'
+		| x=1 | "$1" -eu cd local readonly | && "$1"
+		--verbose ${HOME} sed readonly
+done $(pwd) ${HOME} done 2>/dev/null ${HOME}
+		--verbose local done test /usr/bin
+${HOME} $(pwd) then 'quoted text' printf sed "$1"
+		export then echo $(pwd) 2>/dev/null && printf --verbose printf
+	| test cd x=1 local readonly test /usr/bin cd printf local
+sed test awk readonly && /usr/bin readonly "$1"
+local --verbose sed x=1 printf /usr/bin sed 2>/dev/null
+	local cd "$@" "$1" grep -eu local x=1 test done "$1"
+		grep 2>/dev/null /usr/bin | sed done /usr/bin local $(pwd) &&
+then printf | test "$1" $(pwd)
+	&& ${HOME} grep ${HOME} echo x=1 'quoted text' done -eu "$1"
+$(pwd) awk x=1 'quoted text' && then
+-eu ${HOME} done local awk | "$@"
+	-eu then awk 'quoted text'
+	${HOME} ${HOME} -eu --verbose "$1" 2>/dev/null awk $(pwd) && sed cd /usr/bin
+	--verbose test export printf --verbose then printf export then
+then /usr/bin export --verbose
+		&& local awk local local
+	"$1" grep /usr/bin 2>/dev/null awk "$1" local
+	test printf then sed export grep cd x=1 printf
+		grep export "$1" x=1 "$@" cd test x=1 local -eu | then awk "$1" "$@"
+		"$1" done export 'quoted text' cd grep sed awk /usr/bin
+	"$@" local done sed 'quoted text' | 2>/dev/null readonly
+		2>/dev/null && then grep && grep awk grep $(pwd) x=1 'quoted text' x=1 -eu
+	local printf cd 'quoted text' grep awk $(pwd) && local 2>/dev/null local "$1" --verbose
+done done then export 'quoted text' -eu 2>/dev/null
+	"$1" sed test test | /usr/bin then $(pwd) 'quoted text'
+sed grep local && awk
+	printf test cd x=1 cd then ${HOME} local && sed done printf "$1" test
+	$(pwd) awk 2>/dev/null
+		then sed 2>/dev/null cd done "$1" "$@" 'quoted text' /usr/bin
+$(pwd) 'quoted text' done export | then cd /usr/bin awk 2>/dev/null ${HOME} |
+		local ${HOME} && cd readonly -eu 'quoted text' test 2>/dev/null sed
+	| readonly && 'quoted text' then export cd export cd done sed -eu test 'quoted text'
+		'quoted text' test printf 'quoted text'
+	x=1 grep done | ${HOME} echo awk export sed
+then echo "$1" local test readonly
+		then | sed grep "$1" --verbose x=1 export | readonly echo done
+		echo $(pwd) --verbose local && ${HOME} /usr/bin echo export "$1" "$1"
+	readonly $(pwd) "$@" export "$1" awk 2>/dev/null "$1"
+		readonly grep grep sed test local readonly x=1 awk | $(pwd) 'quoted text' x=1
+	| && test local 2>/dev/null grep export local "$1" readonly
+	awk readonly -eu awk "$1" &&
+then test ${HOME} test export test 'quoted text' x=1 | --verbose done
+	2>/dev/null test x=1 awk "$@" awk
+		$(pwd) export | ${HOME} | 'quoted text' && --verbose $(pwd) 'quoted text'
+"$@" --verbose 2>/dev/null ${HOME} readonly sed grep x=1 test printf
+	export done --verbose 'quoted text' "$1" done grep x=1 echo "$1" "$1" $(pwd) /usr/bin
+		test 2>/dev/null readonly done /usr/bin && export -eu grep printf "$@" --verbose
+		then export -eu awk grep
+grep | readonly echo printf sed readonly
+echo printf 'quoted text' awk && ${HOME}
+"$@" then /usr/bin test $(pwd) -eu ${HOME} "$1"
+/usr/bin ${HOME} "$@" 2>/dev/null
+	"$1" readonly grep x=1
+	&& 2>/dev/null sed "$@" 'quoted text' $(pwd) export local
+	${HOME} "$@" grep /usr/bin local $(pwd)
+"$@" | local printf readonly then
+readonly -eu done then awk
+'quoted text' grep export
+		-eu echo 2>/dev/null export && /usr/bin then -eu printf
+		x=1 $(pwd) --verbose ${HOME} && /usr/bin 'quoted text' sed
+	-eu -eu /usr/bin $(pwd) done export export sed --verbose then ${HOME} local test
+	${HOME} grep export cd readonly
+		export "$1" done /usr/bin then
+&& 2>/dev/null then echo | && done echo | /usr/bin
+		readonly done export /usr/bin cd x=1 export --verbose
+	--verbose readonly /usr/bin grep readonly && echo
+	"$@" ${HOME} readonly echo $(pwd) then 2>/dev/null done -eu "$@" -eu echo x=1
+	"$@" --verbose | test --verbose $(pwd) -eu echo
+awk cd --verbose "$1" "$@" local awk x=1 test -eu | | && awk readonly
+$(pwd) | then && /usr/bin ${HOME} | /usr/bin export
+sed cd awk -eu grep test && printf
+	2>/dev/null | "$1" -eu test grep x=1 printf sed awk echo done echo awk export
+$(pwd) readonly $(pwd) -eu $(pwd) 'quoted text' 'quoted text'
+test 2>/dev/null x=1 readonly "$@" 'quoted text' ${HOME} export readonly
+	export x=1 x=1 ${HOME} awk awk $(pwd) --verbose local grep
+	grep test "$1" x=1 x=1 grep readonly awk $(pwd)
+	export x=1 2>/dev/null sed x=1 then /usr/bin ${HOME}
+"$@" test 'quoted text' cd x=1 --verbose "$1" printf export
+		2>/dev/null 2>/dev/null awk 2>/dev/null x=1 printf test $(pwd)
+done "$1" awk 2>/dev/null
+	sed readonly ${HOME} "$1" 2>/dev/null then 2>/dev/null grep ${HOME}
+		"$1" | | test awk printf
+		done sed sed "$@" --verbose done -eu cd awk x=1 "$@" grep sed
+	awk test /usr/bin sed echo local readonly printf
+	x=1 test cd grep then $(pwd) local done --verbose
+done -eu && x=1 x=1 sed "$1" -eu done $(pwd) readonly
+	x=1 awk export echo -eu
+	local then 2>/dev/null "$@" then 'quoted text' test -eu
+		&& printf awk done /usr/bin grep then
+&& -eu 'quoted text' 2>/dev/null awk then /usr/bin ${HOME} readonly
+	&& local /usr/bin export cd
+		cd "$@" export sed 2>/dev/null
+"$1" "$@" local | awk then | echo grep grep cd -eu export
+	&& test awk x=1 $(pwd) done export
+		x=1 --verbose | "$@"
+		'quoted text' x=1 --verbose
+done local --verbose && 'quoted text' cd done $(pwd) local "$1"
+		${HOME} local sed export local $(pwd) /usr/bin awk -eu
+	'quoted text' export -eu export grep awk readonly && x=1 $(pwd)
+sed then echo x=1 done readonly x=1 x=1 /usr/bin
+		done local x=1 $(pwd) local echo done then | $(pwd) export readonly
+		| $(pwd) ${HOME} | --verbose sed 'quoted text' "$1" "$@" done test $(pwd)
+export cd local "$@" done echo x=1
+&& 'quoted text' readonly --verbose $(pwd) grep cd 2>/dev/null awk | &&
+		grep export ${HOME} readonly 2>/dev/null
+		--verbose 2>/dev/null awk cd && | local then done
+		awk 'quoted text' && 'quoted text' then cd
+	cd && "$1" x=1 "$1" 'quoted text' --verbose
+done --verbose done then | cd -eu printf sed 2>/dev/null
+local grep sed 2>/dev/null ${HOME} sed $(pwd) --verbose "$1" echo done
+	"$1" 2>/dev/null 'quoted text' x=1 printf
+	grep x=1 "$@" test echo grep | x=1 && 2>/dev/null ${HOME} done
+		cd $(pwd) ${HOME} grep printf local /usr/bin
+		test export x=1 local test 2>/dev/null && 2>/dev/null then ${HOME}
+		grep printf && done printf awk "$1"
+		${HOME} 2>/dev/null | readonly printf readonly awk x=1 --verbose sed && 2>/dev/null
+		awk "$@" "$1" export awk "$@" "$1" && printf
+	| readonly grep export grep export $(pwd) $(pwd) $(pwd)
+		2>/dev/null then local export test -eu "$@"
+		"$1" sed export printf echo "$@" echo echo export "$1" 'quoted text' echo
+grep done done ${HOME} done -eu printf
+		"$@" printf export cd echo readonly | ${HOME} cd grep
+	done readonly readonly 2>/dev/null "$1" | "$1" local export
+	test echo "$@" | 'quoted text' --verbose | ${HOME}
+then export /usr/bin "$@" cd | --verbose ${HOME}
+printf --verbose /usr/bin 2>/dev/null grep && readonly x=1 export test 2>/dev/null
+sed "$1" 2>/dev/null --verbose sed grep 'quoted text' awk -eu
+		x=1 cd local && grep echo grep cd
+readonly readonly sed /usr/bin ${HOME}
+	echo /usr/bin cd "$1" local "$1" x=1 readonly
+	awk printf grep test done "$1" --verbose
+readonly export x=1 ${HOME}
+		&& grep readonly "$@" done "$1" awk awk cd awk "$1"
+export "$@" printf then done local "$@" -eu readonly && done sed test x=1
+	"$@" sed sed "$@" "$1" cd "$@" readonly /usr/bin | printf 2>/dev/null -eu | cd grep
+	readonly ${HOME} x=1 2>/dev/null printf "$1" "$@" && test
+		done /usr/bin 2>/dev/null | test | local done "$1" sed done
+	x=1 'quoted text' $(pwd) done done | 2>/dev/null
+	"$1" $(pwd) awk --verbose readonly done test ${HOME} awk --verbose | export sed
+		awk $(pwd) "$@" "$1" then ${HOME} local awk /usr/bin | && test --verbose
+	"$@" then -eu sed printf awk /usr/bin
+	--verbose export test && "$@" then awk "$1" && cd echo --verbose
+		-eu test sed x=1 then 'quoted text' $(pwd) && test | x=1 sed done | test
+		2>/dev/null test test $(pwd) "$@" cd --verbose sed grep 'quoted text'
+		'quoted text' 'quoted text' done
+cd "$1" test readonly echo sed -eu | "$@" grep
+	readonly ${HOME} then then export ${HOME} local $(pwd)
+	--verbose --verbose | && /usr/bin sed grep then done | test printf sed && test awk
+"$1" then 'quoted text' 'quoted text'
+	done grep export && /usr/bin --verbose
+$(pwd) grep local done && echo x=1 $(pwd) awk then 2>/dev/null $(pwd)
+		--verbose /usr/bin --verbose
+		2>/dev/null -eu "$1" /usr/bin grep
+		&& then grep 2>/dev/null awk
+		$(pwd) export cd "$1" "$@"
+	2>/dev/null done "$1" local done sed then
+		x=1 readonly 2>/dev/null
+/usr/bin readonly /usr/bin export -eu awk
+		done readonly 2>/dev/null ${HOME} && "$1"
+	test printf local x=1 2>/dev/null
+grep && ${HOME} grep readonly grep
+		cd | cd 'quoted text' local cd "$@" done cd && readonly echo grep readonly test
+		export cd grep then test echo
+		then echo | $(pwd) "$1" x=1 then awk grep grep readonly --verbose ${HOME} export
+2>/dev/null awk /usr/bin 2>/dev/null local "$1" sed export --verbose
+	local 'quoted text' test grep
+		printf x=1 echo | "$1" readonly echo local
+printf "$@" grep done cd $(pwd) --verbose
+test printf "$@" then awk --verbose readonly x=1 then then done ${HOME}
+		local readonly grep -eu -eu export printf then grep readonly
+	"$@" 'quoted text' printf
+		local sed readonly awk echo awk grep
+		"$@" cd | ${HOME} ${HOME}
+done echo "$1" export grep $(pwd)
+	echo readonly && grep "$@" test ${HOME} "$1" --verbose $(pwd)
+		export 'quoted text' local "$1" echo cd cd grep -eu printf
+local x=1 $(pwd) cd | 'quoted text' 'quoted text' 'quoted text' sed done done
+		then -eu echo --verbose printf local -eu
+	--verbose export $(pwd) then printf | $(pwd)
+	$(pwd) done "$@" 2>/dev/null | x=1 $(pwd) printf "$@" test
+		export echo -eu export && --verbose /usr/bin printf | | local | test -eu echo
+${HOME} --verbose echo 2>/dev/null local 2>/dev/null local $(pwd) "$@" cd
+		local local echo then readonly /usr/bin "$1" /usr/bin export $(pwd) awk echo "$@"
+		2>/dev/null --verbose
+	$(pwd) x=1 --verbose /usr/bin --verbose "$1"
+	printf ${HOME} && printf 'quoted text' awk cd --verbose $(pwd)
+	then awk export test grep cd $(pwd) $(pwd) "$@" |
+		test 2>/dev/null | done test "$1"
+sed /usr/bin x=1 -eu 2>/dev/null local && export ${HOME} export
+		-eu done test test readonly echo
+		sed "$@" cd --verbose printf export then "$@" readonly readonly
+"$@" echo cd /usr/bin test
+--verbose 2>/dev/null test $(pwd) echo
+	${HOME} cd grep cd readonly cd /usr/bin local ${HOME} printf /usr/bin grep "$@"
+		"$1" 2>/dev/null cd "$@" test &&
+		2>/dev/null awk -eu "$@" x=1 cd 'quoted text' done sed
+		-eu x=1 export 'quoted text' local readonly && local
+		x=1 -eu x=1 /usr/bin x=1 printf ${HOME} test grep echo done echo -eu $(pwd)
+		$(pwd) x=1 --verbose --verbose done --verbose
+"$@" local awk "$1" then ${HOME} -eu
+	/usr/bin 2>/dev/null echo sed x=1 -eu local readonly
+	"$1" sed $(pwd) -eu readonly sed x=1 then done 2>/dev/null
+	then sed $(pwd) -eu --verbose then test $(pwd) -eu -eu -eu -eu sed done done
+x=1 --verbose test test
+/usr/bin 'quoted text' export /usr/bin local
+		| ${HOME} echo local | --verbose test | printf
+		"$1" done -eu awk sed
+	'quoted text' export echo -eu done && | "$@" test cd 2>/dev/null cd 'quoted text'
+	echo ${HOME} --verbose | local printf /usr/bin && -eu sed ${HOME} -eu echo test
+echo export test export echo && | cd awk then local readonly grep && readonly
+	grep ${HOME} then $(pwd) --verbose done awk readonly export --verbose --verbose
+local "$1" printf x=1 sed ${HOME} "$1" done --verbose
+		'quoted text' x=1 --verbose export echo x=1 local /usr/bin --verbose
+then export then export "$1" /usr/bin readonly
+printf printf readonly | ${HOME} printf
+		2>/dev/null $(pwd) -eu cd x=1 "$1" | "$1" "$@" sed 'quoted text'
+printf printf ${HOME} "$1" --verbose --verbose
+sed ${HOME} && /usr/bin test -eu 2>/dev/null "$1" $(pwd) awk -eu "$@"
+/usr/bin test printf cd cd -eu done 2>/dev/null then 2>/dev/null
+	sed $(pwd) $(pwd) "$@" x=1 export x=1 "$@" then 'quoted text' echo export
+		-eu "$@" test x=1 awk /usr/bin && cd then x=1 'quoted text'
+		local "$1" && sed done local -eu -eu grep test
+	"$@" done sed x=1 2>/dev/null ${HOME} readonly
+	"$@" then 'quoted text' printf 2>/dev/null 'quoted text' "$@" 2>/dev/null $(pwd)
+done 'quoted text' sed readonly printf $(pwd) 'quoted text' -eu
+	--verbose && "$@" 2>/dev/null awk done grep x=1 done
+x=1 cd "$@" 2>/dev/null readonly export --verbose
+	'quoted text' 2>/dev/null 2>/dev/null $(pwd) cd 'quoted text'
+	$(pwd) then 2>/dev/null $(pwd) cd
+	awk awk test 'quoted text' test
+		printf cd then ${HOME} /usr/bin "$1" && export grep grep
+	sed 'quoted text' /usr/bin | | sed |
+		echo readonly "$1" "$1" ${HOME}
+2>/dev/null then "$@" export awk $(pwd) --verbose
+cd x=1 done then 'quoted text' done echo echo sed "$@" export /usr/bin readonly
+readonly sed 2>/dev/null | "$@"
+	/usr/bin then sed | ${HOME} "$1" printf 'quoted text' "$1" $(pwd) test
+	-eu && cd test 'quoted text' $(pwd) readonly
+		export && cd sed readonly awk local echo export echo
+		then sed /usr/bin then "$@" 'quoted text'
+	printf cd -eu x=1 then
+	-eu x=1 'quoted text' done sed $(pwd)
+		then test test then awk local 2>/dev/null
+	/usr/bin "$1" cd | ${HOME} test -eu --verbose 'quoted text'
+		test awk --verbose --verbose 'quoted text' && test echo -eu "$1" /usr/bin export
+	echo 'quoted text' "$1" /usr/bin "$1" ${HOME} then --verbose echo grep echo
+		awk x=1 grep grep cd -eu ${HOME} echo awk "$1" grep --verbose
+"$@" grep "$@" export readonly printf export $(pwd) ${HOME} --verbose sed
+/usr/bin && local 2>/dev/null printf readonly "$1" /usr/bin /usr/bin ${HOME} local
+		test printf local test 'quoted text'
+echo 2>/dev/null awk sed "$1" done | then awk x=1 export
+	export 'quoted text' export /usr/bin printf && done cd local ${HOME}
+		&& "$@" 'quoted text' local export
+		2>/dev/null "$1" | && grep x=1 -eu 2>/dev/null $(pwd) test test -eu done
+| | $(pwd) done printf awk done local done done --verbose "$1" --verbose
+grep cd sed "$@" "$@" sed test awk awk ${HOME} test /usr/bin then grep
+	/usr/bin local "$@" "$1" /usr/bin
+	-eu "$@" ${HOME} awk grep sed /usr/bin local sed --verbose
+	x=1 2>/dev/null sed x=1 then cd local export cd 'quoted text'
+test x=1 'quoted text' grep test --verbose 'quoted text' 'quoted text'
+		"$@" awk done -eu && echo | /usr/bin export export export
+	&& readonly echo -eu then
+		-eu awk printf && readonly echo awk $(pwd) "$1" cd && cd printf
+	export 'quoted text' grep $(pwd) then echo "$1" printf grep 2>/dev/null local
+	${HOME} && $(pwd) grep "$@" export readonly
+		$(pwd) done 2>/dev/null x=1
+		echo 'quoted text' --verbose x=1 ${HOME} printf -eu export | 'quoted text'
+	cd x=1 test | && local /usr/bin && ${HOME}
+	grep cd && export "$@" && export -eu | ${HOME} -eu
+		done "$@" x=1 grep test then then sed then 2>/dev/null | cd printf grep -eu x=1
+	readonly test --verbose then --verbose | echo x=1 cd 2>/dev/null test
+sed local done "$@" printf "$1" 'quoted text' x=1 test sed
+		readonly | "$@" 'quoted text' "$@" $(pwd) done -eu test grep --verbose
+		local echo 2>/dev/null
+		&& x=1 2>/dev/null readonly export sed cd grep ${HOME} done
+		export cd /usr/bin && "$@" cd test cd export export cd -eu awk $(pwd)
+sed /usr/bin test printf awk echo then ${HOME} $(pwd) | "$1" "$@" export | printf
+	cd && test $(pwd) export "$@" && cd -eu export -eu $(pwd) cd "$1" 2>/dev/null
+grep "$1" && 2>/dev/null -eu x=1 --verbose "$1" /usr/bin
+		test then grep then test && "$1" /usr/bin | local then grep
+		-eu | sed then /usr/bin readonly && /usr/bin sed export 2>/dev/null
+"$@" sed readonly local
+export && $(pwd) 'quoted text' ${HOME}
+	-eu cd /usr/bin test "$@" awk export -eu && /usr/bin x=1 awk "$1" "$@" sed test
+export echo && && awk awk "$1" --verbose then 2>/dev/null "$@"
+		readonly $(pwd) printf export "$1"
+export /usr/bin export ${HOME} -eu printf local
+	/usr/bin printf then 2>/dev/null && x=1 sed
+		x=1 "$@" export 2>/dev/null printf cd 'quoted text' then sed -eu
+'quoted text' local done | --verbose -eu export printf "$@" ${HOME}
+"$1" test $(pwd) $(pwd) $(pwd) local local | ${HOME}
+		echo ${HOME} test readonly
+	2>/dev/null --verbose done 'quoted text'
+test done $(pwd) done | done "$1" cd
+		| awk readonly 2>/dev/null test grep 2>/dev/null readonly awk -eu 'quoted text'
+&& "$@" | --verbose cd grep 'quoted text' export readonly local sed readonly
+-eu readonly --verbose test && export
+	printf done readonly cd done "$1" readonly export
+echo --verbose done && local
+"$@" && done echo test /usr/bin $(pwd) "$@" ${HOME} --verbose
+sed readonly 'quoted text' test then | $(pwd) awk done
+		sed test /usr/bin printf -eu --verbose
+	awk -eu local test awk && then printf echo awk /usr/bin
+		export echo -eu local x=1 awk
+		then sed x=1 test grep --verbose
+		grep "$@" | readonly awk export echo "$@" /usr/bin then
+		"$1" then --verbose sed
+		/usr/bin grep --verbose x=1 awk "$1"
+		${HOME} /usr/bin printf grep | readonly echo "$1" /usr/bin $(pwd) done then test
+		readonly $(pwd) $(pwd) $(pwd) grep sed
+	x=1 grep $(pwd) | sed test --verbose --verbose ${HOME} 2>/dev/null done
+		${HOME} test printf readonly x=1
+	'quoted text' readonly &&
+	${HOME} then "$1" 2>/dev/null 2>/dev/null x=1 $(pwd) then 'quoted text'
+then grep && 'quoted text' then sed awk /usr/bin && then export
+test "$1" local sed | x=1
+readonly $(pwd) awk local local x=1 "$1" export awk grep printf
+then -eu && sed sed echo ${HOME} | grep
+		x=1 'quoted text' local sed done --verbose x=1 awk done | cd export echo "$1"
+		cd "$@" test local printf awk x=1 ${HOME} echo -eu export done then
+'quoted text' "$1" grep x=1 | --verbose -eu "$1" --verbose
+"$@" x=1 --verbose grep printf done printf x=1 --verbose local
+	2>/dev/null cd 2>/dev/null awk
+		$(pwd) 'quoted text' export /usr/bin -eu | sed 2>/dev/null
+		"$@" local 'quoted text' && -eu echo 'quoted text' x=1 awk grep
+		2>/dev/null sed $(pwd)
+export test 'quoted text' -eu cd x=1 --verbose test printf then /usr/bin
+/usr/bin 'quoted text' x=1
+		x=1 --verbose test test ${HOME} then "$1" -eu export readonly
+	&& sed $(pwd) awk x=1 2>/dev/null 2>/dev/null sed x=1 | "$@" 2>/dev/null
+		$(pwd) local sed 'quoted text' sed local ${HOME} -eu "$@"
+"$@" x=1 sed local x=1 | local then 2>/dev/null export printf export sed
+	${HOME} echo echo 'quoted text' -eu cd -eu done then test awk readonly awk
+		grep grep test && local ${HOME} export && test /usr/bin
+		"$1" && "$@" test --verbose -eu 2>/dev/null echo && cd cd ${HOME}
+2>/dev/null printf printf 2>/dev/null awk 2>/dev/null
+		&& sed export /usr/bin "$1" 2>/dev/null then x=1 "$@" cd done 2>/dev/null
+	-eu ${HOME} printf $(pwd) sed awk then export x=1 | -eu -eu readonly echo
+	/usr/bin cd | test --verbose
+"$@" $(pwd) 'quoted text' $(pwd) 'quoted text'
+	/usr/bin printf echo 'quoted text' /usr/bin echo grep x=1 $(pwd) --verbose
+		'quoted text' -eu /usr/bin export printf printf "$@" test
+	test x=1 then cd local -eu
+then 2>/dev/null awk | x=1
+export printf done "$1" | printf ${HOME}
+		$(pwd) printf -eu -eu echo "$1" && ${HOME}
+${HOME} grep test grep readonly /usr/bin /usr/bin echo | grep
+awk /usr/bin | grep "$1" sed 2>/dev/null -eu && x=1 x=1 $(pwd) printf ${HOME}
+-eu && echo /usr/bin
+		$(pwd) sed readonly 'quoted text' && printf done
+--verbose "$@" "$@" /usr/bin cd test awk x=1 printf 'quoted text' x=1
+		then 'quoted text' -eu then grep ${HOME}
+	'quoted text' ${HOME} then done
+	x=1 done -eu ${HOME} echo sed 'quoted text' -eu 2>/dev/null --verbose done
+		-eu "$1" $(pwd) $(pwd) grep x=1 "$@" 2>/dev/null sed "$1" local
+${HOME} && done local test done local ${HOME}
+		/usr/bin echo export -eu -eu 2>/dev/null local
+		&& && "$@" grep grep
+	| "$@" grep /usr/bin 2>/dev/null awk | --verbose -eu /usr/bin 'quoted text' | done
+&& done && "$1" --verbose test printf
+		-eu readonly && 'quoted text' test 'quoted text'
+		${HOME} $(pwd) --verbose | test
+/usr/bin -eu "$@" printf $(pwd) sed 'quoted text' "$1" --verbose
+$(pwd) sed ${HOME} export
+grep printf test readonly 'quoted text' "$1" && cd grep test
+"$1" "$@" grep sed sed --verbose
+"$@" printf local 'quoted text' done ${HOME} export
+	sed 2>/dev/null export 'quoted text'
+-eu && grep --verbose local awk then --verbose echo "$@" readonly
+cd --verbose local $(pwd) x=1 echo echo $(pwd) "$1"
+2>/dev/null 2>/dev/null "$@" done 'quoted text'
+		awk "$@" sed --verbose sed local --verbose /usr/bin then then readonly
+	local 2>/dev/null then && --verbose
+$(pwd) -eu 'quoted text' 2>/dev/null awk && grep "$1" "$@" printf
+	--verbose -eu /usr/bin echo x=1 && cd printf
+		done && local ${HOME} sed
+	x=1 /usr/bin cd local export "$@"
+	&& "$1" done grep test printf done sed 'quoted text' local local -eu "$1"
+	then 'quoted text' awk awk sed sed cd then 2>/dev/null x=1
+		"$@" --verbose cd | local | cd 'quoted text'
+		-eu $(pwd) done $(pwd) cd done cd grep
+	'quoted text' --verbose sed awk --verbose -eu 'quoted text' done awk echo cd
+	-eu && && local /usr/bin local 2>/dev/null grep |
+	-eu test awk local test
+	${HOME} readonly cd -eu then readonly | test export done export -eu done /usr/bin
+	x=1 export export grep ${HOME}
+	readonly test 'quoted text' --verbose "$@" then
+		test "$@" /usr/bin x=1 "$1" 'quoted text' test -eu && 'quoted text' done
+		"$@" "$1" local 'quoted text' |
+		"$@" printf cd test cd x=1 'quoted text'
+"$1" sed 2>/dev/null printf 'quoted text' --verbose
+sed export ${HOME} ${HOME} export test export --verbose /usr/bin && $(pwd) done
+	| x=1 'quoted text' done local $(pwd) then local sed echo | x=1 test cd
+done cd local export echo --verbose then -eu cd
+$(pwd) printf $(pwd) -eu && x=1 echo
+	printf printf export "$@" then ${HOME} printf echo export grep local
+	sed /usr/bin --verbose done && awk $(pwd) 2>/dev/null /usr/bin 2>/dev/null
+	"$@" x=1 test $(pwd) "$@" -eu sed "$@" 'quoted text' |
+| export printf readonly grep awk | cd printf --verbose awk test printf
+2>/dev/null x=1 && export readonly sed grep ${HOME} x=1 done cd
+		--verbose "$1" | --verbose
+	x=1 grep test 2>/dev/null ${HOME} | 'quoted text' /usr/bin local | readonly
+		then "$1" export 'quoted text' "$@" done --verbose cd readonly /usr/bin awk
+		x=1 x=1 local | echo && done done done then awk local
+	local sed "$@" echo test $(pwd) grep readonly done readonly -eu export && readonly
+	local echo "$@" "$@" $(pwd)
+sed done 2>/dev/null -eu && ${HOME} then -eu && printf
+test export grep grep && local "$1" readonly /usr/bin grep echo --verbose
+"$@" export export awk "$@" $(pwd) export readonly --verbose printf then 2>/dev/null
+	/usr/bin $(pwd) --verbose then test $(pwd) ${HOME} "$1" awk done awk readonly
+	&& printf "$@" /usr/bin && local && awk then awk cd then printf
+sed sed -eu 'quoted text' --verbose 'quoted text'
+	cd done 2>/dev/null $(pwd) test cd done awk --verbose 2>/dev/null 2>/dev/null $(pwd)
+	'quoted text' x=1 done cd "$1" --verbose test
+	2>/dev/null then cd awk export
+sed | then x=1 sed /usr/bin echo readonly
+then cd && awk cd export $(pwd) 'quoted text'
+		done test done ${HOME} ${HOME} ${HOME} "$1" $(pwd) "$1" $(pwd) /usr/bin
+		echo sed then --verbose test
+	grep printf sed | 2>/dev/null 2>/dev/null && test | echo
+"$@" 2>/dev/null done -eu printf 'quoted text' echo cd "$@" -eu done && 'quoted text'
+	/usr/bin readonly grep -eu grep "$1" x=1 export test test
+		local /usr/bin export printf -eu test readonly "$@" x=1 x=1
+		local --verbose --verbose && | "$@" printf
+		"$1" sed cd printf export
+		'quoted text' sed "$@" done
+${HOME} printf echo 2>/dev/null
+	cd $(pwd) cd local grep done awk then sed /usr/bin $(pwd)
+	2>/dev/null export | x=1 done --verbose $(pwd)
+sed awk then test $(pwd) -eu "$@" readonly local sed ${HOME} 'quoted text'
+	then then 2>/dev/null awk /usr/bin "$1" | awk sed 2>/dev/null test
+then test printf "$1" export readonly awk x=1 export "$@" /usr/bin
+	| awk local --verbose x=1 awk export
+	cd -eu echo local 2>/dev/null -eu --verbose && grep done |
+grep ${HOME} done grep "$@"
+	-eu readonly grep 2>/dev/null
+	$(pwd) x=1 grep test "$@" | /usr/bin done /usr/bin $(pwd) $(pwd) readonly
+		&& echo x=1 x=1 sed "$@" printf
+/usr/bin printf done x=1 /usr/bin "$1" "$@" -eu ${HOME} x=1 test $(pwd) 2>/dev/null
+then then then awk test | && grep /usr/bin awk readonly sed then
+		readonly 2>/dev/null
+${HOME} 'quoted text' then
+		'quoted text' && printf ${HOME} -eu test test &&
+		export | done /usr/bin "$@" grep
+		local 'quoted text' 2>/dev/null cd --verbose
+		then 2>/dev/null readonly
+awk then 'quoted text' done --verbose done export -eu test sed
+		${HOME} && grep echo x=1 'quoted text'
+		export --verbose test ${HOME} local readonly x=1 "$@" readonly
+		/usr/bin 'quoted text' echo test echo test readonly
+	"$@" cd local && echo grep export 2>/dev/null
+	"$1" x=1 --verbose local --verbose --verbose grep
+-eu $(pwd) "$1" printf "$@" --verbose
+		"$@" printf "$1" 2>/dev/null grep x=1 --verbose
+${HOME} export sed grep x=1 && test readonly then $(pwd) -eu awk | -eu sed cd export
+	cd 2>/dev/null && "$@" x=1
+	readonly -eu done done then "$@"
+	2>/dev/null -eu export 'quoted text' 'quoted text' 2>/dev/null | 'quoted text'
+		sed --verbose printf /usr/bin --verbose x=1
+		grep && $(pwd) --verbose awk local echo readonly printf
+	cd printf awk export 'quoted text' then cd sed readonly | test -eu
+printf awk && local export $(pwd) && /usr/bin $(pwd)
+	/usr/bin local echo | $(pwd) done echo
+export "$@" readonly "$1" 2>/dev/null 2>/dev/null done
+	&& && "$@" $(pwd) "$@" awk echo /usr/bin
+x=1 --verbose 'quoted text' awk export done readonly
+2>/dev/null && printf export x=1 x=1 --verbose ${HOME} ${HOME}
+	done local 'quoted text' "$@"
+local export $(pwd) "$1"
+2>/dev/null x=1 export 'quoted text' sed printf
+	cd ${HOME} export | 'quoted text' export readonly "$@" "$@" awk test ${HOME} 2>/dev/null
+	'quoted text' sed printf "$@" export x=1 local
+sed then echo cd && done cd readonly ${HOME} test awk local done "$1" sed "$@"
+		sed /usr/bin 2>/dev/null x=1 grep
+	printf then "$@" readonly x=1 ${HOME}
+		x=1 readonly ${HOME} then "$1" && x=1 export ${HOME} "$1" grep
+x=1 readonly then "$@" --verbose cd --verbose
+awk echo grep | echo awk
+then "$1" echo awk 2>/dev/null then -eu sed readonly
+	done grep awk test && readonly readonly $(pwd) /usr/bin readonly
+	"$1" -eu "$1" 'quoted text' x=1 readonly readonly && ${HOME}
+local 'quoted text' readonly /usr/bin x=1 -eu "$@" export export $(pwd)
+	done awk /usr/bin local grep echo -eu "$1" /usr/bin ${HOME} "$1" test &&
+		-eu sed | --verbose 2>/dev/null && echo
+sed 'quoted text' readonly sed "$1" then awk --verbose /usr/bin awk
+		"$@" local printf 'quoted text' "$@" local export x=1 export test grep x=1 &&
+	-eu echo /usr/bin x=1 sed $(pwd) echo grep --verbose grep && -eu sed "$1" cd
+		&& readonly then sed x=1 x=1 local readonly x=1 then
+&& 2>/dev/null | --verbose 2>/dev/null done then sed "$1" ${HOME} /usr/bin export
+| readonly awk cd sed | done
+${HOME} | echo --verbose grep readonly printf "$@" grep --verbose
+-eu && export -eu $(pwd) x=1 | "$@" sed local local then |
+	2>/dev/null "$@" $(pwd) && test readonly export $(pwd) "$@" "$1"
+	test ${HOME} export && x=1 printf 'quoted text' export ${HOME} awk --verbose
+2>/dev/null echo echo test test printf 2>/dev/null | --verbose then
+	| grep -eu printf local 2>/dev/null
+		echo "$1" awk local test x=1 /usr/bin 'quoted text' echo printf
+then --verbose ${HOME} then | echo printf sed "$1"
+$(pwd) ${HOME} "$@" then local "$1" awk
+	${HOME} printf 'quoted text'
+	export sed ${HOME} echo awk local grep x=1 && "$1" cd | -eu
+		&& sed && printf then && "$1" | | 'quoted text'
+		"$@" test cd done grep echo readonly ${HOME} then cd /usr/bin
+--verbose test local $(pwd) | | export --verbose --verbose
+/usr/bin then 2>/dev/null "$@" test local -eu "$@"
+	local x=1 grep 2>/dev/null printf -eu /usr/bin && done sed x=1 |
+test export then export
+	'quoted text' echo sed && printf | printf --verbose export
+	"$@" "$@" local 2>/dev/null 'quoted text' "$1" readonly
+	export cd echo /usr/bin awk 'quoted text' | cd export && printf ${HOME}
+sed then local "$1" x=1 "$1" 'quoted text' sed grep awk cd echo printf cd local
+sed && "$@" && x=1 -eu export awk /usr/bin
+printf "$@" awk grep test | then awk && awk 2>/dev/null cd -eu "$1" printf
+${HOME} x=1 && 2>/dev/null && local ${HOME} --verbose
+sed done readonly done export ${HOME} then "$1" printf 2>/dev/null
+then 2>/dev/null | local export
+	x=1 -eu done --verbose -eu sed readonly "$@" export test $(pwd) ${HOME}
+echo /usr/bin sed grep ${HOME} /usr/bin
+		| /usr/bin awk $(pwd) sed && x=1 -eu
+-eu --verbose export -eu then local done printf && done x=1 readonly
+		| done 'quoted text' -eu done cd sed export $(pwd) --verbose 2>/dev/null
+		"$1" /usr/bin cd cd x=1 echo sed "$@" grep $(pwd)
+test sed then "$1" ${HOME} 2>/dev/null printf --verbose 'quoted text'
+		export awk "$@" -eu $(pwd) cd export local 'quoted text' "$1" readonly
+		done awk done x=1 then --verbose 'quoted text' local --verbose
+		/usr/bin then | x=1 printf echo
+		| printf "$1" done local grep ${HOME} && grep 2>/dev/null then export "$@" sed
+	readonly readonly echo awk --verbose echo /usr/bin 'quoted text' then /usr/bin
+'quoted text' --verbose test awk "$1" 2>/dev/null
+		2>/dev/null awk | awk test
+	2>/dev/null sed | 2>/dev/null printf && then -eu cd | sed
+	x=1 ${HOME} test ${HOME} "$1" sed x=1 cd
+		local echo -eu x=1 -eu
+		test awk echo then done then readonly && "$1" 2>/dev/null 2>/dev/null cd
+--verbose local then export done local
+grep ${HOME} 2>/dev/null "$1" 2>/dev/null echo
+	'quoted text' readonly cd --verbose "$@" printf --verbose sed "$1"
+	--verbose readonly test readonly printf $(pwd)
+		grep sed awk 2>/dev/null | printf
+	&& "$1" --verbose ${HOME} test --verbose 'quoted text' 2>/dev/null ${HOME}
+$(pwd) 2>/dev/null 'quoted text'
+| x=1 readonly -eu then export done export 'quoted text' then
+		-eu --verbose x=1 "$@" /usr/bin awk /usr/bin
+		2>/dev/null grep local awk
+local "$1" /usr/bin /usr/bin done --verbose 'quoted text'
+awk done 'quoted text' cd "$@" cd cd test grep "$@"
+${HOME} 'quoted text' "$@" awk cd
+| local --verbose then $(pwd) $(pwd) | --verbose "$@"
+		--verbose grep done x=1 --verbose "$1" awk echo
+"$@" "$@" x=1 2>/dev/null test --verbose awk then then
+		-eu sed awk && 'quoted text' readonly $(pwd) cd ${HOME} -eu grep "$1" $(pwd)
+"$@" "$1" /usr/bin test readonly
+export printf readonly "$1" /usr/bin ${HOME} test
+printf "$1" /usr/bin grep test grep sed sed export
+awk "$1" readonly printf grep | printf grep
+	| 'quoted text' /usr/bin printf sed
+	x=1 printf && 2>/dev/null grep export --verbose sed
+awk cd local && ${HOME} && /usr/bin done awk ${HOME} printf
+"$@" 2>/dev/null local
+sed x=1 /usr/bin printf grep
+${HOME} awk cd "$1" x=1 echo grep
+		printf $(pwd) test local -eu printf sed done test
+		done /usr/bin echo 2>/dev/null
+		readonly x=1 echo sed
+	x=1 'quoted text' ${HOME} printf --verbose echo
+| x=1 | -eu "$1" grep -eu -eu /usr/bin /usr/bin export -eu "$@" readonly
+	sed -eu "$1" ${HOME} done grep local echo readonly cd -eu then ${HOME}
+	--verbose --verbose x=1 cd test
+sed /usr/bin && x=1 "$1" then "$@" --verbose printf "$@" 2>/dev/null test then /usr/bin
+-eu awk ${HOME} x=1 test readonly printf $(pwd) && -eu x=1 'quoted text'
+x=1 2>/dev/null x=1 /usr/bin
+		sed $(pwd) 'quoted text' grep $(pwd)
+	printf readonly readonly | --verbose
+		$(pwd) x=1 sed sed | x=1 grep /usr/bin awk x=1 local printf x=1 test | sed test
+		then local awk printf echo 'quoted text' "$1" && export then then then
+--verbose "$@" sed grep export x=1 | "$@" echo ${HOME} $(pwd) "$@" done /usr/bin
+	echo --verbose /usr/bin readonly cd ${HOME} /usr/bin then 'quoted text'
+		then ${HOME} "$1" export awk
+	export /usr/bin sed awk ${HOME} echo ${HOME} echo awk $(pwd) $(pwd) x=1 grep
+		grep x=1 export sed then cd sed 'quoted text' /usr/bin test "$@" "$@" sed local
+	awk --verbose echo grep local test "$1" $(pwd) -eu done
+	2>/dev/null ${HOME} awk printf then test export
+		printf local printf printf /usr/bin sed | local cd 'quoted text' printf && readonly
+| 2>/dev/null grep awk echo then sed $(pwd) test
+--verbose 'quoted text' cd echo | test export "$@" awk grep
+-eu printf /usr/bin export $(pwd)
+		${HOME} sed echo x=1 && ${HOME} x=1 printf "$1" && grep readonly grep
+	${HOME} done then readonly then done test awk cd then
+awk echo awk then awk $(pwd) "$@" /usr/bin then 'quoted text'
+	&& "$1" x=1 x=1 cd printf echo /usr/bin grep $(pwd) awk readonly
+	then x=1 ${HOME} grep sed && done x=1 test grep then echo x=1 $(pwd) local printf
+		2>/dev/null then printf $(pwd) awk then ${HOME} grep grep $(pwd) grep readonly
+${HOME} readonly /usr/bin
+		/usr/bin x=1 echo local done 'quoted text' $(pwd) 2>/dev/null
+		-eu 'quoted text' --verbose then "$1" done test ${HOME} test test awk ${HOME}
+	local "$1" -eu awk test --verbose ${HOME} $(pwd) -eu
+$(pwd) "$1" 2>/dev/null x=1 echo awk ${HOME} "$@" cd --verbose &&
+	done grep "$@" "$1" grep
+test "$@" --verbose -eu printf
+		grep sed 2>/dev/null 2>/dev/null readonly
+"$1" -eu ${HOME} awk /usr/bin cd
+		then sed local echo "$@" local sed test $(pwd)
+		then export echo "$1" --verbose grep done "$@" test /usr/bin grep test
+	done && printf && ${HOME} test -eu done "$1" then cd 2>/dev/null x=1 $(pwd)
+	local test grep done "$1" x=1 "$@" ${HOME}
+-eu printf export && then grep | sed | cd printf "$1" echo "$1" grep "$1" /usr/bin
+awk 2>/dev/null awk "$@" then printf
+done awk 2>/dev/null test ${HOME} /usr/bin test 2>/dev/null /usr/bin
+	"$1" "$1" --verbose --verbose 2>/dev/null
+"$@" export ${HOME} grep grep local
+readonly sed echo done echo
+	/usr/bin "$@" printf && ${HOME} echo x=1 && 'quoted text' 'quoted text'
+	"$1" sed grep 2>/dev/null --verbose 2>/dev/null
+		cd then ${HOME} awk | sed echo awk
+"$@" test 'quoted text' done ${HOME} test echo then test | -eu x=1 2>/dev/null
+readonly $(pwd) local readonly
+readonly "$@" cd 2>/dev/null awk readonly then
+local sed 2>/dev/null ${HOME} /usr/bin -eu x=1 then cd
+	export /usr/bin /usr/bin "$1" | 'quoted text' printf export
+	export ${HOME} ${HOME} 'quoted text' ${HOME} readonly then $(pwd) 'quoted text'
+		/usr/bin export awk && then | sed ${HOME} awk "$1" && x=1 readonly
+		"$1" printf /usr/bin awk -eu grep $(pwd)
+	sed 'quoted text' "$@" $(pwd)
+	"$1" -eu test test 2>/dev/null
+	--verbose cd ${HOME} 'quoted text' export | done echo
+		awk /usr/bin "$@" 'quoted text' 'quoted text' $(pwd) echo then
+"$1" $(pwd) cd cd done test sed ${HOME}
+	then --verbose $(pwd) "$1" export sed printf
+readonly ${HOME} grep
+	cd && && readonly "$1" --verbose
+awk sed -eu /usr/bin && 'quoted text' sed done local
+&& test /usr/bin echo ${HOME} sed | done
+	-eu sed test "$@" $(pwd) done printf /usr/bin grep sed
+		awk done echo x=1 awk echo sed
+"$@" awk $(pwd) && grep sed local --verbose
+2>/dev/null local $(pwd) ${HOME} sed test export awk readonly
+	-eu cd ${HOME} --verbose printf grep readonly
+	/usr/bin then -eu && echo readonly /usr/bin ${HOME}
+local x=1 'quoted text' 'quoted text'
+	| readonly test ${HOME} then local $(pwd) --verbose readonly
+		/usr/bin sed 'quoted text' done
+	done 'quoted text' test printf && | x=1 "$@" x=1
+cd echo readonly then --verbose
+		/usr/bin test export "$1" then export 'quoted text'
+		sed ${HOME} -eu grep readonly printf
+	/usr/bin local cd printf test --verbose "$1" readonly then
+echo "$@" readonly x=1
+readonly x=1 $(pwd) cd ${HOME} 'quoted text' printf
+		grep then cd test export &&
+	echo | printf $(pwd) -eu readonly readonly "$@" | "$1" ${HOME} && local echo echo
+'quoted text' readonly printf -eu cd "$@" sed 2>/dev/null "$1" 'quoted text'
+sed -eu ${HOME} test && readonly cd --verbose
+	local x=1 cd && /usr/bin -eu "$@" "$@" echo sed test
+	awk then 2>/dev/null printf | x=1 | -eu "$@" echo "$1"
+printf 2>/dev/null readonly
+	&& grep "$1" cd awk --verbose "$@"
+&& awk sed -eu readonly export "$1" done done "$@" -eu
+		awk sed | ${HOME} /usr/bin
+		echo ${HOME} /usr/bin x=1 export sed -eu $(pwd)
+		awk && ${HOME} export readonly --verbose sed && readonly
+cd then then done echo | grep "$@" test readonly done
+sed test -eu grep done 'quoted text' 'quoted text'
+/usr/bin echo readonly export 'quoted text' ${HOME} echo test
+sed test --verbose && local "$1" local | 2>/dev/null
+local | printf | --verbose "$@" then 2>/dev/null &&
+		-eu awk done sed printf ${HOME} then | export awk awk awk sed export ${HOME} "$1"
+	"$@" --verbose 'quoted text' $(pwd) -eu -eu
+		sed /usr/bin sed awk /usr/bin awk
+	cd echo test local --verbose ${HOME} "$@" "$@" done "$1" awk sed done
+		${HOME} printf printf --verbose
+		echo export done && done grep 'quoted text'
+'quoted text' echo /usr/bin $(pwd)
+readonly readonly readonly done /usr/bin cd sed
+local -eu "$@" sed "$@" local x=1 export test grep
+		/usr/bin "$1" sed && then grep x=1 test --verbose export
+		&& 'quoted text' --verbose sed $(pwd)
+		awk awk -eu "$@" --verbose 2>/dev/null then readonly cd | "$@" grep
+		awk echo $(pwd) /usr/bin test $(pwd)
+	grep test /usr/bin /usr/bin
+	export cd -eu sed --verbose local --verbose printf
+cd export 'quoted text' "$@" $(pwd) "$1" -eu awk echo awk done --verbose
+local $(pwd) grep 2>/dev/null export
+local && | readonly ${HOME} then local && echo -eu ${HOME} "$@" printf && $(pwd)
+	printf test 'quoted text' done && "$1" /usr/bin
+	local local /usr/bin "$@" x=1 cd echo "$1" test done x=1 sed x=1
+	-eu 'quoted text' $(pwd) export $(pwd) awk then "$@"
+		sed /usr/bin --verbose awk $(pwd) local
+		done awk -eu /usr/bin 2>/dev/null done 'quoted text' awk 2>/dev/null
+		$(pwd) "$1" awk /usr/bin sed --verbose grep local test awk | cd
+2>/dev/null done grep /usr/bin
+x=1 grep ${HOME} x=1 2>/dev/null
+	done printf | ${HOME} --verbose
+		done test "$@" ${HOME} /usr/bin ${HOME} test "$@" 'quoted text' awk
+test --verbose x=1 readonly ${HOME} 2>/dev/null
+		-eu "$1" done /usr/bin echo sed
+	/usr/bin printf cd 'quoted text' then $(pwd)
+		then 2>/dev/null printf
+done cd $(pwd) "$1" export
+		awk echo done printf && $(pwd) "$@" cd sed sed echo
+		x=1 readonly echo test x=1 2>/dev/null
+readonly awk cd printf
+	--verbose && export /usr/bin then | sed local test /usr/bin echo
+	done | then 2>/dev/null $(pwd) then "$1" && --verbose x=1 x=1
+	awk $(pwd) export 2>/dev/null local cd
+	$(pwd) readonly ${HOME} awk awk export -eu -eu done printf
+	$(pwd) awk test then printf test printf grep grep 2>/dev/null 'quoted text'
+${HOME} 'quoted text' 'quoted text' /usr/bin export cd
+		"$1" readonly then x=1
+grep $(pwd) x=1 readonly -eu $(pwd)
+	then test awk sed done -eu awk /usr/bin "$1" -eu "$1" grep export "$1" done 2>/dev/null
+	printf -eu readonly cd x=1 x=1 "$1"
+	'quoted text' 2>/dev/null "$@" done /usr/bin cd cd cd done cd awk -eu cd
+	test 2>/dev/null test "$@" export "$@" then $(pwd) awk awk ${HOME} echo
+	--verbose "$@" 2>/dev/null cd echo test awk 'quoted text' export then
+	export 'quoted text' cd test $(pwd) "$@" &&
+		readonly /usr/bin "$1" cd sed x=1 /usr/bin then 2>/dev/null
+	"$@" echo --verbose "$@" ${HOME} awk done sed "$1"
+sed "$@" cd ${HOME} -eu /usr/bin sed 2>/dev/null
+		sed test -eu then 'quoted text' | -eu "$1" done local 2>/dev/null $(pwd) awk test
+		then | local printf --verbose
+		$(pwd) -eu --verbose x=1 done 'quoted text' done printf | printf
+		$(pwd) ${HOME} "$@" printf local ${HOME}
+	done cd 'quoted text' "$@" echo 2>/dev/null
+		x=1 ${HOME} | echo sed 'quoted text' /usr/bin
+then /usr/bin done cd grep "$1" --verbose done x=1 sed
+		"$@" "$@" then awk /usr/bin | readonly
+		awk readonly done printf test awk 2>/dev/null $(pwd) local
+		"$1" x=1 export x=1 "$@"
+		export readonly ${HOME} -eu 'quoted text'
+		"$1" local export local | -eu /usr/bin test then 'quoted text' done awk cd awk
+	then done grep local awk cd $(pwd) cd sed "$@" awk x=1 x=1 grep x=1 done
+local --verbose x=1 'quoted text'
+done grep done echo ${HOME} local then x=1 sed
+		${HOME} cd test printf export $(pwd)
+		local "$@" echo $(pwd) && "$1" done test "$1" readonly --verbose printf
+	then --verbose && -eu --verbose $(pwd) printf export
+		-eu --verbose local | awk | -eu cd test x=1 local "$@" 'quoted text'
+&& 'quoted text' | printf echo | 2>/dev/null export printf
+-eu $(pwd) sed "$1" 2>/dev/null test cd cd ${HOME}
+sed export then | --verbose x=1 echo awk -eu /usr/bin "$@" -eu $(pwd)
+	$(pwd) 'quoted text' --verbose "$1" sed | 'quoted text' |
+sed "$@" grep printf x=1 | grep 2>/dev/null
+sed local done "$@" then $(pwd)
+		export export readonly grep grep x=1 export readonly -eu awk awk $(pwd)
+	"$1" -eu x=1 done && cd done x=1 'quoted text' readonly printf done "$1" "$@"
+		grep cd -eu "$@" | 2>/dev/null 'quoted text'
+		cd sed x=1 2>/dev/null readonly export && 2>/dev/null echo echo "$1" test readonly
+		/usr/bin /usr/bin local ${HOME}
+then then && 2>/dev/null ${HOME} test
+		$(pwd) /usr/bin && test 'quoted text' -eu 2>/dev/null "$1" export $(pwd) -eu 2>/dev/null
+	cd echo done sed readonly x=1 printf x=1 grep
+		$(pwd) awk export $(pwd) grep grep sed && 'quoted text' --verbose export echo
+		awk "$@" /usr/bin "$@" awk --verbose x=1 done then readonly export "$1"
+		"$1" test awk then $(pwd)
+	echo | readonly local local --verbose
+"$@" $(pwd) --verbose done readonly "$1" $(pwd)
+"$@" --verbose ${HOME} test --verbose then | -eu
+	'quoted text' "$1" $(pwd) "$@" export --verbose
+	$(pwd) then sed readonly local -eu $(pwd) local "$@" "$1" && done
+	$(pwd) "$@" && readonly printf awk "$@" ${HOME} echo local readonly then $(pwd)
+	printf /usr/bin 'quoted text' ${HOME} readonly test awk echo 2>/dev/null
+		| test $(pwd) local ${HOME} done printf readonly ${HOME}
+	done 2>/dev/null then local 2>/dev/null -eu echo x=1 |
+		local "$@" cd /usr/bin -eu cd "$1" | | --verbose x=1 printf x=1 --verbose printf
+readonly printf x=1 awk readonly
+	local export export 2>/dev/null
+	'quoted text' 'quoted text'
+	then "$1" x=1 --verbose echo export "$@" then /usr/bin 2>/dev/null sed
+sed cd test readonly local test export then --verbose x=1 cd printf 2>/dev/null
+		local readonly "$@" awk done && sed "$1" 'quoted text' then done readonly
+		local local sed ${HOME} printf
+	x=1 cd | awk | test echo awk local
+then "$1" $(pwd) | echo test grep 2>/dev/null 'quoted text'
+		-eu printf printf echo sed x=1 --verbose then printf grep export sed "$@" then
+done local export /usr/bin
+printf cd done /usr/bin then printf then
+$(pwd) then --verbose done readonly
+-eu /usr/bin local cd sed &&
+	test echo 'quoted text' && sed echo
+		&& grep $(pwd) $(pwd)
+		readonly --verbose sed export echo grep test "$@" "$1" && /usr/bin
+done grep "$@" /usr/bin 2>/dev/null x=1 "$@" ${HOME} x=1 /usr/bin
+		/usr/bin then | "$@" --verbose "$1" x=1
+	| ${HOME} echo /usr/bin $(pwd)
+		| then "$1" awk local printf --verbose export x=1 ${HOME} cd local x=1 awk ${HOME}
+		local export awk readonly awk done "$@" && readonly then then sed "$1" done test
+	done -eu done sed /usr/bin "$@" done --verbose printf printf
+	readonly ${HOME} readonly && grep $(pwd) $(pwd)
+		local then readonly export sed "$@" done echo --verbose readonly
+local grep then "$1" && "$1" export "$@"
+	grep $(pwd) $(pwd) export test "$1" done --verbose
+	| | $(pwd) "$@" | "$1" done | && | && ${HOME} $(pwd)
+		x=1 cd sed readonly 2>/dev/null ${HOME} sed
+--verbose printf cd /usr/bin
+		${HOME} 'quoted text' $(pwd) 2>/dev/null
+	awk readonly x=1 local grep
+/usr/bin x=1 -eu local then --verbose sed 2>/dev/null
+	"$1" printf printf "$@" local local grep test
+		export printf readonly export 2>/dev/null
+		'quoted text' ${HOME} test 'quoted text'
+	export then awk | grep echo then $(pwd) printf ${HOME}
+		"$@" x=1 --verbose 2>/dev/null x=1 local | local
+		sed ${HOME} 'quoted text' test ${HOME} then 'quoted text'
+	/usr/bin printf x=1 x=1 "$1" && awk "$@" 2>/dev/null readonly
+	sed --verbose /usr/bin awk "$1" awk -eu test then 2>/dev/null export && done
+		${HOME} local readonly echo --verbose awk local $(pwd) printf x=1 sed awk
+printf printf done $(pwd) export x=1 /usr/bin test
+	'quoted text' -eu -eu -eu sed done | /usr/bin
+		done then cd "$1" grep x=1 export "$@" grep x=1 "$1" "$@" export sed
+${HOME} awk export echo cd readonly export 2>/dev/null 2>/dev/null "$@" 'quoted text'
+-eu printf test echo /usr/bin sed done printf
+	'quoted text' echo 2>/dev/null
+x=1 cd | 2>/dev/null 2>/dev/null 'quoted text' test echo
+/usr/bin "$@" "$1" cd export done grep awk x=1 then
+		x=1 grep echo sed x=1 export then test 2>/dev/null
+	cd $(pwd) sed ${HOME} sed export ${HOME} local awk x=1 sed
+	printf echo "$@" && export grep ${HOME} 'quoted text'
+		$(pwd) "$1" local local -eu
+grep | printf echo grep
+local readonly then "$@" export --verbose "$1" done awk 'quoted text' 2>/dev/null
+	awk printf done test local local grep "$1" test x=1 && sed printf then ${HOME}
+	'quoted text' 'quoted text' grep --verbose local sed
+	&& export printf $(pwd) test cd
+		test x=1 test sed test "$@"
+		then && done export | grep grep test "$@" -eu
+| then printf cd local sed done 2>/dev/null done export
+$(pwd) --verbose sed | local && echo
+		test && ${HOME} "$1" 2>/dev/null /usr/bin sed 'quoted text'
+	/usr/bin export --verbose sed x=1 printf
+grep echo printf 2>/dev/null
+$(pwd) 2>/dev/null 'quoted text' $(pwd) x=1 test readonly
+	&& ${HOME} done readonly done 2>/dev/null 'quoted text'
+	"$@" readonly printf -eu x=1 awk done awk cd
+	grep echo 2>/dev/null printf
+		${HOME} ${HOME} ${HOME} "$1" readonly | | sed $(pwd) 'quoted text' export readonly
+done x=1 awk readonly test && test then grep 2>/dev/null 2>/dev/null
+x=1 x=1 | -eu x=1 -eu readonly ${HOME} cd cd cd readonly ${HOME} readonly
+&& "$@" ${HOME} readonly local cd awk && printf sed 'quoted text'
+		2>/dev/null | 'quoted text' ${HOME} echo cd readonly test -eu printf cd printf
+&& --verbose -eu export test 'quoted text'
+	awk done x=1 test awk then x=1 && | test | 'quoted text' echo printf ${HOME}
+| echo awk printf /usr/bin
+	/usr/bin test 2>/dev/null awk -eu /usr/bin printf test 2>/dev/null printf x=1
+		local $(pwd) echo | -eu
+	x=1 ${HOME} sed /usr/bin echo 'quoted text' printf "$@" -eu sed
+'quoted text' test test --verbose
+		2>/dev/null /usr/bin --verbose | | printf cd echo "$@" cd grep
+		&& test readonly sed && done
+		sed awk 'quoted text' 2>/dev/null then done -eu /usr/bin "$@"
+	grep $(pwd) test --verbose -eu readonly
+		"$1" cd $(pwd) "$1" sed printf cd "$@" "$@" cd test echo awk x=1 grep printf
+| echo test | test "$1" awk x=1 "$1" $(pwd)
+	$(pwd) readonly --verbose then awk done printf ${HOME} 'quoted text' printf
+		"$1" --verbose -eu 2>/dev/null "$1" cd export echo cd echo local 'quoted text'
+		2>/dev/null cd cd readonly readonly grep grep && awk awk x=1 ${HOME} printf
+		echo export export $(pwd) | cd test "$@" "$1"
+	cd awk echo cd sed x=1 local awk done
+		x=1 "$1" then test 'quoted text'
+export "$@" $(pwd) --verbose sed done cd local
+	sed echo awk ${HOME} | test sed echo printf readonly | grep
+awk printf "$@" local 'quoted text' | echo && done "$1"
+sed printf ${HOME} 2>/dev/null echo "$@" done ${HOME} /usr/bin
+		test then 'quoted text' sed -eu "$1" --verbose "$@" cd --verbose
+'quoted text' readonly "$@" cd "$@" export
+	grep $(pwd) ${HOME} 2>/dev/null done ${HOME} local printf local awk readonly &&
+x=1 --verbose sed -eu grep /usr/bin done echo test
+	sed echo export awk "$1" export 'quoted text' test x=1 echo
+cd done grep printf x=1 printf then sed
+		-eu -eu -eu grep x=1 local x=1 echo && -eu readonly | -eu printf
+	2>/dev/null test x=1 then 'quoted text' printf test done test
+/usr/bin cd $(pwd) awk export test
+		echo 2>/dev/null x=1 "$@" -eu done test "$1" local
+"$1" awk 2>/dev/null 'quoted text'
+| awk -eu export "$1" export awk "$@" export printf echo
+		$(pwd) test "$1" "$1" "$@" 'quoted text' 'quoted text'
+2>/dev/null sed x=1 ${HOME} "$@" -eu -eu
+local then --verbose local 2>/dev/null cd -eu "$1" -eu $(pwd) test |
+awk | awk x=1 && readonly 'quoted text' 'quoted text'
+		&& printf test export "$@" 'quoted text'
+	/usr/bin --verbose export --verbose "$1" local
+		--verbose 2>/dev/null --verbose x=1 awk /usr/bin && ${HOME}
+		${HOME} && local sed export
+		&& && 'quoted text' then x=1 echo awk | local --verbose "$@" --verbose export
+export done -eu awk then local awk $(pwd) local --verbose export
+	cd readonly 2>/dev/null printf
+echo echo echo x=1 | ${HOME} export 2>/dev/null 'quoted text' && done
+		echo cd done x=1 grep "$1" echo ${HOME} awk 'quoted text' done
+		grep /usr/bin | export local | x=1 export
+sed grep 'quoted text'
+	"$@" x=1 | ${HOME} then awk test 2>/dev/null awk printf 2>/dev/null then done -eu
+awk printf | && | grep x=1 done -eu | x=1 done /usr/bin awk then -eu awk
+x=1 /usr/bin --verbose /usr/bin
+	| x=1 "$@" $(pwd) sed --verbose readonly grep --verbose
+	export test -eu grep ${HOME} then 2>/dev/null
+		"$@" cd /usr/bin && test x=1 ${HOME}
+-eu "$1" echo 'quoted text' readonly
+		printf done 'quoted text' 2>/dev/null cd done grep x=1 | local local /usr/bin
+	awk awk --verbose readonly | 2>/dev/null && done 2>/dev/null sed -eu
+grep 2>/dev/null ${HOME} export $(pwd) export
+printf | then local printf readonly echo | awk /usr/bin 2>/dev/null
+	2>/dev/null 'quoted text' local done cd
+	"$@" then cd && printf ${HOME} --verbose | test test
+		&& readonly then local 'quoted text' ${HOME} 2>/dev/null 'quoted text'
+		cd echo "$1" "$@" printf "$@" sed | | done && echo
+		readonly export test -eu | sed "$1" grep 'quoted text'
+		then /usr/bin echo grep test "$@" cd "$1" --verbose
+	echo done export printf local ${HOME} /usr/bin sed echo export 'quoted text' ${HOME}
+| sed "$@" /usr/bin grep $(pwd) -eu /usr/bin ${HOME} grep
+	sed then 'quoted text' "$@" | | $(pwd) local grep | readonly readonly sed test
+	test then "$@" awk -eu
+grep 2>/dev/null export awk readonly | echo
+awk readonly 2>/dev/null
+| done -eu "$@" && cd printf awk "$@"
+done grep awk -eu && printf
+	done $(pwd) grep $(pwd) $(pwd) 'quoted text' grep | 'quoted text'
+	x=1 awk readonly 'quoted text' printf -eu x=1 awk
+export "$@" 'quoted text' | "$@" --verbose awk $(pwd)
+		echo --verbose grep /usr/bin printf
+		| && echo done --verbose
+		echo 2>/dev/null then "$@" cd -eu readonly "$@" --verbose awk
+	"$@" done export awk "$1" /usr/bin x=1 $(pwd) "$@" sed -eu
+	| "$@" readonly sed local
+	sed /usr/bin $(pwd) awk
+		'quoted text' cd echo x=1 -eu --verbose sed sed 2>/dev/null
+		local printf export | local 'quoted text'
+	test | ${HOME} x=1 --verbose && cd printf | export cd ${HOME} $(pwd)
+	"$@" local /usr/bin && then x=1 printf awk -eu x=1
+	$(pwd) x=1 /usr/bin -eu export 'quoted text' echo done
+awk printf local $(pwd) x=1 cd printf "$1" "$1"
+		readonly $(pwd) echo sed done /usr/bin
+		&& cd ${HOME} sed "$1" grep test ${HOME}
+	--verbose "$@" printf && | 2>/dev/null echo
+test then done x=1 readonly local
+	--verbose readonly then "$1" done echo x=1 sed echo $(pwd) --verbose
+"$1" x=1 2>/dev/null echo | cd echo grep | done then 2>/dev/null done
+x=1 done "$@" $(pwd) ${HOME} then printf echo && done then
+		done printf $(pwd) echo "$1" test
+	/usr/bin $(pwd) test x=1 sed -eu done
+	--verbose "$@" done echo $(pwd) then printf 'quoted text' --verbose
+	done local then echo $(pwd) sed 2>/dev/null ${HOME} cd
+	--verbose awk readonly && x=1 done test "$@" awk sed test local
+	readonly && $(pwd) "$@" export "$1" "$@" export
+		done test 2>/dev/null printf grep done -eu 'quoted text' export grep cd readonly
+local test test | --verbose $(pwd) grep 2>/dev/null printf x=1 echo sed sed
+		"$1" && /usr/bin 'quoted text'
+		export readonly 'quoted text' $(pwd)
+	x=1 awk echo export local sed --verbose x=1 cd done
+		sed $(pwd) done /usr/bin local
+	-eu echo awk test sed x=1 -eu 'quoted text' "$1"
+		&& | --verbose 2>/dev/null readonly && cd $(pwd) "$1" "$1"
+		--verbose done x=1 | then echo awk "$1" 'quoted text' done |
+"$@" then x=1 | 2>/dev/null ${HOME}
+done /usr/bin test 2>/dev/null cd && -eu -eu 2>/dev/null --verbose
+	"$1" | test $(pwd) export
+readonly x=1 x=1 "$1" ${HOME} done ${HOME} test "$1" export -eu | echo --verbose
+awk grep ${HOME} sed x=1 $(pwd)
+printf readonly 2>/dev/null | export
+x=1 sed --verbose && /usr/bin sed echo then
+		cd x=1 readonly /usr/bin echo local grep -eu x=1 test
+${HOME} 'quoted text' "$1" done awk done /usr/bin
+	printf 'quoted text' export | /usr/bin
+--verbose export -eu && 'quoted text'
+		-eu -eu 'quoted text' echo readonly /usr/bin | 2>/dev/null -eu export grep
+	sed test 2>/dev/null printf 2>/dev/null $(pwd) grep
+${HOME} $(pwd) && "$1" -eu sed echo awk x=1 grep && -eu | ${HOME}
+		2>/dev/null cd && cd printf awk $(pwd) then "$@" export printf echo -eu
+awk awk | echo readonly grep
+	x=1 printf | sed test done printf cd local ${HOME} "$@" cd then grep -eu x=1 x=1
+"$@" -eu awk && --verbose 'quoted text' local test readonly
+"$@" 'quoted text' grep /usr/bin --verbose sed export --verbose
+		-eu grep x=1 done test
+	"$@" printf cd awk printf local done export done 2>/dev/null "$@" done grep local
+	export && /usr/bin $(pwd) 'quoted text' grep ${HOME} $(pwd) grep sed | then
+/usr/bin grep && awk | then export local "$1" awk export | /usr/bin printf
+$(pwd) sed -eu /usr/bin |
+	test sed printf "$1" local $(pwd) |
+$(pwd) --verbose | grep 'quoted text' 2>/dev/null
+		done done local awk ${HOME} export x=1 sed
+	'quoted text' && 2>/dev/null 'quoted text'
+	printf "$@" 'quoted text' --verbose cd local cd sed "$@" sed printf sed "$@" --verbose
+		printf local x=1 2>/dev/null
+'quoted text' ${HOME} sed
+		grep local "$1" done readonly test test echo && "$1"
+	printf sed --verbose --verbose sed
+grep && "$@" sed 2>/dev/null
+echo /usr/bin "$1" "$@" awk --verbose test
+grep cd "$1" 'quoted text' then
+2>/dev/null test "$@" | /usr/bin local /usr/bin test local && test test done -eu
+	-eu then "$@" "$@" export printf /usr/bin
+#include c120.sh
+	x=1 -eu "$@" /usr/bin x=1 export /usr/bin done done grep
+printf local then /usr/bin echo x=1
+		2>/dev/null 'quoted text' then grep then echo --verbose
+awk printf cd done $(pwd)
+		export -eu /usr/bin && 2>/dev/null test | echo printf $(pwd) && "$@"
+		done | readonly "$1" echo readonly
+grep && 2>/dev/null 'quoted text' $(pwd) echo 'quoted text'
+		$(pwd) /usr/bin cd --verbose readonly | local export -eu done local ${HOME} then
+	grep done sed cd then then "$@" sed export then sed test
+		&& --verbose cd done readonly "$1" x=1 | test ${HOME} grep
+awk ${HOME} done 'quoted text' | done ${HOME} --verbose --verbose ${HOME} local
+local local "$@" printf test sed awk echo local test cd 'quoted text' printf export
+export | $(pwd) test 2>/dev/null ${HOME} readonly done sed "$1"
+x=1 local -eu 2>/dev/null -eu | printf local | then && then sed then
+		then "$1" --verbose ${HOME} 'quoted text' -eu printf export sed printf
+		cd awk then --verbose "$@" | then readonly then && echo
+		local -eu sed export /usr/bin sed
+	'quoted text' grep $(pwd) x=1 then -eu
+	x=1 'quoted text' export /usr/bin
+$(pwd) "$1" grep done /usr/bin 2>/dev/null "$1" $(pwd) printf printf | -eu printf
+	done --verbose x=1 ${HOME} "$1" 'quoted text' test $(pwd) /usr/bin ${HOME}
+		2>/dev/null $(pwd) 'quoted text'
+/usr/bin | export | awk ${HOME} -eu printf
+		local sed echo && ${HOME} cd sed local then cd $(pwd) x=1 done $(pwd) | awk
+&& local export local readonly x=1 -eu "$@" test 'quoted text' $(pwd) export
+	printf test printf x=1 sed "$@"
+		printf /usr/bin local local readonly
+--verbose grep done sed local "$1" done printf test awk --verbose 'quoted text'
+	done echo /usr/bin ${HOME} -eu && export $(pwd) awk export cd --verbose
+	/usr/bin done awk local sed
+"$@" "$1" export x=1 'quoted text' "$1" x=1 ${HOME}
+		"$1" printf export | "$@" test awk test ${HOME} cd awk -eu then test
+done /usr/bin echo local -eu
+		/usr/bin awk -eu readonly then --verbose "$1"
+	| awk export cd export --verbose export cd grep && local
+&& export done $(pwd) then && echo
+cd /usr/bin "$1" export "$1" /usr/bin --verbose
+	$(pwd) printf ${HOME} grep echo sed test grep --verbose
+		'quoted text' cd sed grep readonly sed
+"$@" | local -eu readonly ${HOME} && awk
+		grep then then x=1 'quoted text' readonly printf readonly awk
+		test local && $(pwd) awk test then "$1" awk readonly /usr/bin readonly /usr/bin
+		echo "$1" | 'quoted text' printf done --verbose "$@"
+		cd 'quoted text' -eu awk sed sed printf done echo --verbose && && $(pwd) grep --verbose
+	echo awk local 2>/dev/null ${HOME} | readonly echo readonly
+		export -eu done -eu $(pwd) echo
+&& "$1" 'quoted text' x=1 'quoted text'
+		local readonly --verbose /usr/bin then && grep then
+cd /usr/bin printf "$@" ${HOME} cd $(pwd) readonly done printf /usr/bin ${HOME}
+grep 2>/dev/null grep export sed awk test ${HOME} export ${HOME} "$1"
+		"$@" then x=1 cd then awk --verbose grep /usr/bin 'quoted text'
+	export | awk $(pwd) grep -eu $(pwd) && grep
+	test x=1 grep 'quoted text' $(pwd) sed "$1" readonly echo test cd done export
+/usr/bin --verbose "$1" test cd then local 'quoted text'
+	2>/dev/null 'quoted text' readonly --verbose then && grep | ${HOME} "$@"
+		"$1" cd echo sed local then awk export awk | grep
+		"$@" | echo then $(pwd) grep | 'quoted text' test "$@" x=1 sed /usr/bin --verbose
+grep | then --verbose x=1 --verbose readonly echo --verbose "$1" x=1
+		test $(pwd) sed ${HOME} cd 2>/dev/null sed x=1
+local "$@" sed --verbose readonly
+printf sed 2>/dev/null 2>/dev/null /usr/bin
+		cd && "$1" cd -eu then --verbose local readonly -eu && awk && local $(pwd)
+		'quoted text' 2>/dev/null test && readonly export x=1 sed grep | local
+test x=1 then echo then then sed printf x=1 then $(pwd) ${HOME} "$@"
+	awk ${HOME} "$@" x=1 --verbose grep printf
+	${HOME} 2>/dev/null cd 'quoted text' grep && then sed $(pwd)
+	sed 'quoted text' | awk x=1 awk sed awk grep echo x=1 awk
+		| && echo ${HOME} /usr/bin cd echo then then then echo
+		&& then -eu -eu "$@" $(pwd) local "$@" "$@" && | done -eu echo awk echo -eu 2>/dev/null
+		'quoted text' ${HOME} done 2>/dev/null local --verbose && 2>/dev/null /usr/bin
+local grep --verbose |
+"$@" && done 'quoted text'
+"$@" done cd /usr/bin sed $(pwd) then ${HOME} done --verbose awk then 2>/dev/null
+	local grep -eu grep x=1 "$@" sed sed
+	'quoted text' done export "$@" done test
+	| | x=1 x=1 --verbose --verbose x=1 2>/dev/null --verbose
+'quoted text' 'quoted text' x=1 cd --verbose export "$1" -eu
+echo readonly done sed readonly sed && 'quoted text'
+	--verbose readonly then --verbose
+	export test then x=1 echo local export $(pwd) | "$@" grep sed --verbose
+		--verbose local export
+		grep "$@" sed echo /usr/bin "$1"
+		awk local readonly done echo
+	printf local test sed grep local
+	--verbose test | export test "$1"
+	"$@" echo sed echo local x=1 --verbose $(pwd)
+		done cd export then printf
+then printf /usr/bin $(pwd) export ${HOME}
+		echo 'quoted text' "$1" done | local printf readonly
+cd $(pwd) | --verbose /usr/bin awk --verbose printf sed cd --verbose && && then
+$(pwd) grep sed "$@" --verbose grep $(pwd) && sed x=1 export | export --verbose
+"$1" export $(pwd) printf "$1" export echo "$1"
+		"$1" export awk "$@" readonly export ${HOME} 2>/dev/null
+	-eu ${HOME} /usr/bin readonly grep "$1" /usr/bin sed printf export
+	"$@" readonly x=1 --verbose && 'quoted text' -eu grep && grep test echo export
+cd cd printf sed cd echo awk echo 'quoted text' test | then
+		$(pwd) 2>/dev/null && cd | $(pwd) "$@" 'quoted text'
+test readonly then -eu cd "$1"
+then | x=1 readonly x=1 x=1 ${HOME} awk
+		'quoted text' echo x=1 sed done "$@" "$1" sed cd /usr/bin
+echo -eu awk "$1" 2>/dev/null $(pwd) $(pwd) grep readonly
+grep echo readonly then $(pwd) then ${HOME} --verbose && echo ${HOME} 2>/dev/null
+grep printf test -eu $(pwd) ${HOME} sed export x=1 $(pwd) readonly
+		echo --verbose test x=1 awk printf 'quoted text'
+	$(pwd) export then then grep && grep $(pwd) export
+-eu ${HOME} "$1" printf readonly printf test $(pwd) | then | 2>/dev/null $(pwd)
+		printf x=1 readonly printf && ${HOME} 'quoted text' | printf done readonly
+		&& done done -eu --verbose ${HOME} "$1" local then echo | 2>/dev/null "$1"
+export 'quoted text' 'quoted text'
+		printf export export -eu done echo printf | "$@" $(pwd) $(pwd) --verbose /usr/bin
+	then 'quoted text' done /usr/bin
+		2>/dev/null --verbose 2>/dev/null && echo ${HOME}
+	x=1 ${HOME} test -eu grep then -eu "$1" awk 2>/dev/null awk "$1"
+	test --verbose | --verbose 2>/dev/null | then local "$@" done /usr/bin echo local
+		echo export && "$@" test echo echo ${HOME} grep sed cd printf
+	${HOME} x=1 cd export /usr/bin export sed test 'quoted text'
+	--verbose grep export ${HOME} 2>/dev/null cd | $(pwd) test
+		local awk "$@" | printf 'quoted text' -eu
+	-eu --verbose echo awk local
+"$1" grep ${HOME} readonly "$1" printf ${HOME} export sed echo
+		done ${HOME} $(pwd) readonly ${HOME} 'quoted text' test "$@" /usr/bin
+grep cd "$@" x=1 grep -eu sed
+	${HOME} && done export sed -eu
+| $(pwd) 'quoted text' -eu ${HOME} local | done readonly
+	x=1 grep printf then 'quoted text' /usr/bin printf
+	printf printf x=1 done "$@" 2>/dev/null then /usr/bin
+	cd "$1" $(pwd) export x=1 | $(pwd) /usr/bin x=1 awk
+	'quoted text' grep cd
+	local readonly && --verbose | -eu $(pwd) grep export -eu sed export
+	test "$@" test export ${HOME} test cd readonly "$@" 2>/dev/null sed -eu $(pwd)
+		export sed 'quoted text' awk x=1 then && sed
+		then done -eu --verbose test x=1 -eu echo done cd
+		sed readonly "$1" awk readonly grep "$1" "$1" x=1 echo
+'quoted text' "$1" local ${HOME} sed grep grep && echo --verbose test then x=1
+		/usr/bin awk $(pwd) $(pwd) -eu done grep | 2>/dev/null
+		&& printf && test cd x=1 echo /usr/bin /usr/bin printf "$@" then
+		test && $(pwd) 'quoted text' --verbose 'quoted text' 'quoted text' && -eu grep
+-eu cd $(pwd) readonly /usr/bin
+	done 2>/dev/null x=1 test 'quoted text' test ${HOME} test x=1 awk
+-eu sed awk cd /usr/bin echo export -eu
+$(pwd) $(pwd) $(pwd) export ${HOME} readonly 2>/dev/null echo cd && x=1
+	'quoted text' then 'quoted text' | | "$@" grep printf -eu "$1" readonly
+printf "$@" cd -eu /usr/bin -eu -eu /usr/bin grep "$@" 'quoted text' awk "$1"
+	"$@" 2>/dev/null then x=1 sed x=1 -eu ${HOME} local "$@"
+readonly "$@" $(pwd) sed |
+	awk awk -eu 'quoted text' grep awk local local
+-eu ${HOME} "$@" 'quoted text' x=1
+		&& 2>/dev/null "$1" sed readonly && done test test export
+	"$@" --verbose -eu test && && ${HOME}
+		test x=1 $(pwd) -eu readonly export printf --verbose awk cd x=1 readonly
+		$(pwd) && /usr/bin sed x=1 "$1" --verbose grep
+		local printf 2>/dev/null $(pwd) && local then printf "$1" then export
+	grep awk sed done readonly echo grep done
+	--verbose cd awk $(pwd) then echo sed grep /usr/bin
+cd | printf readonly export "$1" grep
+awk then "$1" "$@" 2>/dev/null ${HOME} done --verbose 2>/dev/null
+	x=1 printf x=1 x=1 done export 'quoted text' "$1" readonly
+export export /usr/bin sed $(pwd) "$1" export local then done "$1" "$@"
+		readonly --verbose $(pwd) && test grep "$@" "$1" grep
+		cd -eu "$@" && printf ${HOME} 2>/dev/null "$@" echo export
+readonly "$@" "$1" x=1 export
+	export -eu done cd && grep done cd 'quoted text' printf then x=1 test printf $(pwd)
+		export cd readonly "$1" printf 2>/dev/null export 'quoted text'
+		&& $(pwd) ${HOME} ${HOME} ${HOME} test $(pwd) | printf
+		-eu /usr/bin 'quoted text' done export /usr/bin
+	--verbose printf $(pwd) awk test
+$(pwd) export ${HOME} cd --verbose -eu
+		&& done local "$@" x=1 --verbose
+	then export --verbose /usr/bin test -eu export ${HOME} cd echo | export export
+	$(pwd) sed "$@" sed 'quoted text' "$1" then done grep then "$@" printf
+	"$@" -eu --verbose "$1" done $(pwd) local | |
+		$(pwd) export -eu --verbose cd | && then "$1" printf readonly "$@" then 2>/dev/null
+		"$@" 'quoted text' readonly 'quoted text' $(pwd) echo cd "$1" -eu ${HOME}
+cd -eu 'quoted text' -eu "$@" "$1" printf printf 'quoted text'
+"$@" ${HOME} export local printf 2>/dev/null x=1 --verbose sed readonly ${HOME}
+		2>/dev/null local 2>/dev/null x=1 grep "$1" done printf 'quoted text'
+	local cd printf then printf $(pwd) printf then done
+'quoted text' "$1" "$@" 'quoted text' printf
+--verbose -eu 'quoted text' "$@" local $(pwd) printf &&
+sed "$@" export awk done -eu test printf then
+		--verbose ${HOME} /usr/bin /usr/bin
+x=1 local | local then x=1 "$@"
+	export ${HOME} 'quoted text' grep $(pwd) printf /usr/bin grep
+	done readonly export x=1 sed sed local 2>/dev/null
+readonly grep "$@" awk awk x=1 awk echo echo ${HOME} 2>/dev/null echo /usr/bin
+'quoted text' | export local "$@" sed && 2>/dev/null
+echo "$@" | grep -eu x=1 /usr/bin printf export
+		awk $(pwd) readonly 'quoted text' /usr/bin printf 'quoted text'
+	--verbose test awk done export && cd
+	then sed --verbose x=1 export 2>/dev/null local --verbose
+	awk sed x=1 $(pwd) done sed export test /usr/bin echo $(pwd) "$1" $(pwd) "$1" $(pwd)
+		$(pwd) "$@" cd awk "$@" local sed $(pwd)
+	$(pwd) 2>/dev/null cd test $(pwd) $(pwd) grep
+	-eu then sed then local 'quoted text'
+		export echo local then export "$1"
+	--verbose printf | "$@" && 'quoted text'
+	${HOME} 2>/dev/null printf /usr/bin && then export test then
+	local x=1 then local 'quoted text' 'quoted text' 'quoted text' echo echo echo /usr/bin
+&& && 2>/dev/null "$@" $(pwd) grep 'quoted text'
+	"$@" then /usr/bin cd awk && test 2>/dev/null
+$(pwd) $(pwd) readonly test
+&& then --verbose $(pwd) ${HOME}
+		$(pwd) && readonly done export
+cd ${HOME} grep "$1" 'quoted text' done printf x=1
+/usr/bin awk 2>/dev/null echo awk x=1
+-eu readonly echo "$@"
+		echo -eu 2>/dev/null
+export && | "$@" 2>/dev/null cd echo x=1 "$1"
+'quoted text' "$1" $(pwd) "$@" done echo -eu export 2>/dev/null
+		$(pwd) done local then test ${HOME}
+		grep 'quoted text' ${HOME} |
+"$1" "$@" 'quoted text' local printf grep 2>/dev/null
+	local | -eu 'quoted text' then awk done done echo /usr/bin sed awk done -eu
+		-eu /usr/bin readonly ${HOME} $(pwd) "$1" 2>/dev/null "$1"
+		--verbose sed awk cd ${HOME} $(pwd) done done echo sed -eu "$1" then -eu "$@" &&
+test grep grep /usr/bin test
+		test awk local test awk sed printf 2>/dev/null then && cd readonly local
+sed -eu --verbose | cd local --verbose | awk
+	'quoted text' "$1" done local
+		local awk 2>/dev/null "$@" echo sed export local test x=1
+		$(pwd) $(pwd) ${HOME} readonly readonly 2>/dev/null "$1" then
+	printf 'quoted text' awk printf local --verbose
+	$(pwd) printf sed grep sed "$@" awk grep awk $(pwd) test -eu grep readonly
+"$1" local printf --verbose local 2>/dev/null cd "$@" "$@" /usr/bin
+		"$@" /usr/bin readonly 2>/dev/null echo | test $(pwd) echo && && awk then 'quoted text'
+	readonly printf then | ${HOME} -eu "$@" ${HOME}
+		$(pwd) local local readonly awk printf
+	then 'quoted text' "$1" 2>/dev/null "$@" cd readonly
+	cd | readonly 'quoted text' 'quoted text' "$@" --verbose
+		printf /usr/bin /usr/bin local x=1 $(pwd) test done |
+	2>/dev/null 'quoted text' grep
+	$(pwd) local awk local
+		awk ${HOME} /usr/bin sed $(pwd) "$1"
+2>/dev/null x=1 -eu && "$1" test --verbose
+		awk /usr/bin x=1 cd sed 2>/dev/null "$@" printf printf test /usr/bin "$1" x=1
+echo "$@" "$1" awk sed && ${HOME}
+		"$@" | export 2>/dev/null | ${HOME} grep && $(pwd) export export $(pwd)
+"$@" $(pwd) local "$1" cd echo readonly -eu 2>/dev/null
+		"$@" grep x=1 local export --verbose /usr/bin
+	local done printf readonly ${HOME}
+local -eu --verbose && grep /usr/bin
+		/usr/bin && echo readonly test && printf /usr/bin readonly | sed then 2>/dev/null
+cd then $(pwd) echo echo
+	readonly printf done printf printf printf "$1" grep | done x=1
+"$1" 'quoted text' 'quoted text' awk export printf $(pwd)
+		x=1 --verbose | awk local readonly
+		"$@" x=1 2>/dev/null $(pwd) then "$1" sed then && "$1" echo
+export printf x=1 $(pwd) x=1 /usr/bin readonly cd sed
+		| printf 'quoted text' 2>/dev/null printf "$1" done "$@"
+	echo ${HOME} readonly export -eu && grep --verbose x=1 --verbose $(pwd)
+readonly "$1" "$@" readonly $(pwd) test
+		export then awk local grep x=1 x=1 awk --verbose printf test "$1" test test --verbose
+		readonly cd | sed 'quoted text' 'quoted text' && ${HOME} $(pwd) 'quoted text'
+	cd $(pwd) "$1" ${HOME} grep export
+| local echo readonly then "$1" --verbose
+	&& then "$@" echo | then "$@" | "$@" cd sed
+		2>/dev/null $(pwd) done 'quoted text'
+	| sed grep ${HOME} | test readonly sed
+		-eu | "$@" x=1 printf local cd x=1 awk -eu
+		printf && -eu test "$1" sed awk "$@"
+export x=1 && "$1" awk "$@" export test 'quoted text' | -eu test sed grep readonly
+	x=1 | /usr/bin sed echo | "$@" then then "$@" "$1"
+done printf "$1" awk --verbose test x=1 |
+		grep export $(pwd) --verbose x=1 test export cd "$1"
+	"$@" local /usr/bin export ${HOME} printf printf sed ${HOME}
+		export && readonly $(pwd) $(pwd) $(pwd) 2>/dev/null x=1 awk done
+		sed $(pwd) test | cd x=1 x=1
+		-eu ${HOME} done done then ${HOME} readonly awk 2>/dev/null
+		&& "$@" --verbose x=1 -eu
+local | | done 2>/dev/null cd "$@" $(pwd) export done $(pwd)
+		awk sed ${HOME} "$@" "$1" awk /usr/bin --verbose $(pwd) local ${HOME}
+		local grep /usr/bin /usr/bin ${HOME}
+2>/dev/null grep $(pwd) | $(pwd) done readonly x=1 x=1 export "$@" "$1" -eu
+awk awk echo done sed -eu export 2>/dev/null "$@" x=1 2>/dev/null readonly "$@"
+"$@" local "$1" $(pwd) --verbose
+	grep awk "$1" && local readonly
+	${HOME} -eu sed cd | 'quoted text' /usr/bin
+		--verbose local test then export done echo x=1
+local export grep done /usr/bin && sed local sed printf -eu && sed "$1" |
+x=1 local then --verbose grep
+done $(pwd) awk then grep done 'quoted text'
+		grep --verbose 'quoted text' then 'quoted text'
+		-eu cd test 2>/dev/null ${HOME} 2>/dev/null grep readonly 'quoted text'
+export --verbose then readonly test
+$(pwd) "$1" && printf echo $(pwd) done --verbose
+		grep awk "$@" -eu echo "$1" --verbose readonly 'quoted text' | export echo done
+2>/dev/null -eu printf local grep cd --verbose
+echo x=1 sed "$1" readonly | /usr/bin test ${HOME} awk $(pwd) 2>/dev/null
+	&& sed /usr/bin cd export export readonly 'quoted text' 'quoted text'
+	${HOME} grep && awk -eu x=1 x=1 /usr/bin
+		/usr/bin $(pwd) ${HOME} local awk sed --verbose x=1 --verbose
+done 'quoted text' x=1 'quoted text' export -eu
+		$(pwd) 'quoted text' cd ${HOME} x=1 test cd && "$@" 'quoted text'
+export done then readonly ${HOME} --verbose && local then
+| && sed && && && && done sed test test ${HOME} "$1" 2>/dev/null
+	'quoted text' | x=1 && 2>/dev/null "$@" grep awk
+| test printf 'quoted text' | test echo x=1 ${HOME}
+	readonly | ${HOME} ${HOME} 2>/dev/null grep echo printf 'quoted text'
+	printf "$@" ${HOME} printf | then && echo then && done -eu readonly
+x=1 "$1" -eu "$@" 'quoted text' x=1 x=1 "$@"
+		${HOME} | grep local then local "$@" /usr/bin grep readonly
+		&& then 'quoted text' awk $(pwd) && grep | test awk "$@" printf "$@" "$@"
+	local sed "$@" "$1" | 2>/dev/null | cd x=1 awk echo
+	'quoted text' test 2>/dev/null grep cd -eu
+	cd echo cd done awk test cd grep export export grep "$1"
+	local /usr/bin printf 'quoted text' local done $(pwd) echo done done
+	${HOME} grep 'quoted text' sed done "$@"
+		x=1 echo test readonly $(pwd) && 2>/dev/null "$1" "$@" cd
+sed local x=1 then echo | sed "$@" export awk /usr/bin cd local done ${HOME}
+		export sed 2>/dev/null local local | $(pwd)
+	${HOME} 2>/dev/null awk "$@" "$1" sed /usr/bin --verbose
+"$1" /usr/bin readonly 'quoted text'
+	| test $(pwd) echo test test export done 'quoted text' test x=1
+	x=1 sed grep cd "$1" ${HOME}
+	export -eu awk test grep sed && x=1 'quoted text' local 'quoted text' export
+	echo "$@" done export echo echo printf
+		x=1 sed 2>/dev/null done --verbose
+2>/dev/null | export "$1" sed local 2>/dev/null
+	done awk ${HOME} | done 2>/dev/null test
+export --verbose test x=1 2>/dev/null
+x=1 echo $(pwd) grep printf
+	'quoted text' readonly awk sed sed export /usr/bin 'quoted text'
+		printf cd cd && cd "$@" printf 2>/dev/null 'quoted text'
+		echo then echo "$1" x=1 printf 2>/dev/null
+		awk echo local 'quoted text' ${HOME} /usr/bin test awk awk
+-eu x=1 then local echo export 'quoted text' && awk grep /usr/bin export -eu --verbose
+		$(pwd) --verbose done cd
+&& echo /usr/bin ${HOME} ${HOME} sed echo --verbose -eu
+	'quoted text' done printf local | test local then 'quoted text' && local grep /usr/bin
+echo 2>/dev/null sed done sed | /usr/bin | done readonly 2>/dev/null
+	--verbose then x=1 echo
+x=1 export "$1" echo sed export echo test ${HOME} echo /usr/bin test &&
+		x=1 && grep cd "$@" readonly sed cd test awk sed local echo readonly cd printf
+	sed awk local -eu --verbose grep echo "$@"
+	sed grep grep grep 'quoted text' done test "$1" then
+		/usr/bin awk /usr/bin test cd -eu | -eu --verbose
+	'quoted text' readonly | && 'quoted text' readonly -eu export /usr/bin echo
+		2>/dev/null cd ${HOME} "$@" 'quoted text' sed readonly ${HOME} done local awk
+	grep /usr/bin readonly printf export local 2>/dev/null sed awk $(pwd) export "$1"
+		| x=1 local && sed grep "$@" printf 'quoted text' done 'quoted text'
+		awk cd "$1" export grep local --verbose 2>/dev/null echo -eu done
+	done -eu then printf test 'quoted text'
+		/usr/bin readonly echo "$1" | then $(pwd) && local && cd local grep then test
+readonly then x=1 sed x=1 printf /usr/bin /usr/bin export 2>/dev/null
+	echo -eu readonly then -eu echo test "$1" x=1 local ${HOME} awk export 'quoted text'
+		/usr/bin awk grep echo 2>/dev/null cd "$1" echo export "$1" test | test --verbose
+test ${HOME} | grep readonly printf 'quoted text' ${HOME} 'quoted text'
+	-eu then printf then sed /usr/bin | -eu readonly awk awk x=1 local grep
+		grep | ${HOME} ${HOME} readonly then
+		sed grep "$1" && sed grep 'quoted text' cd && -eu readonly awk grep awk x=1 then
+&& 2>/dev/null /usr/bin test "$1" echo then && /usr/bin "$1" /usr/bin
+	'quoted text' $(pwd) --verbose then
+	/usr/bin /usr/bin done printf printf /usr/bin 'quoted text' cd "$@" --verbose
+		test cd grep awk && grep /usr/bin local readonly awk cd awk export "$@"
+--verbose then x=1 export export cd --verbose | local "$1" |
+	'quoted text' $(pwd) cd test done $(pwd)
+		"$1" then -eu awk sed ${HOME} cd 2>/dev/null | export 'quoted text' sed /usr/bin
+export readonly x=1 'quoted text' 'quoted text'
+export "$1" /usr/bin && local done export
+	"$1" then 2>/dev/null local && --verbose 'quoted text' "$1" &&
+	readonly 'quoted text' ${HOME} --verbose
+	$(pwd) readonly grep awk awk then local -eu "$@" sed ${HOME}
+echo x=1 -eu done cd then grep grep then /usr/bin $(pwd) grep 2>/dev/null
+		readonly echo grep awk printf | "$1" grep awk --verbose ${HOME} $(pwd)
+	${HOME} test "$@" 2>/dev/null done done cd echo -eu done done grep
+	readonly 'quoted text' --verbose "$1" awk then $(pwd) x=1 readonly
+		2>/dev/null local cd export export 'quoted text' x=1
+	cd $(pwd) "$@" printf "$@"
+export printf 'quoted text' awk awk printf grep cd x=1 $(pwd) && 2>/dev/null
+	--verbose $(pwd) /usr/bin "$1" 'quoted text' sed && echo | && cd
+		| --verbose export | awk "$1" "$1" | cd x=1 -eu test sed
+		&& export cd then $(pwd) awk export && -eu $(pwd) grep $(pwd) printf ${HOME}
+		-eu -eu | | local printf 'quoted text' "$@" ${HOME} "$@"
+		readonly test printf $(pwd) readonly
+	"$1" ${HOME} printf "$1" printf | --verbose local | printf local "$@" test
+	grep sed 2>/dev/null x=1 x=1 sed echo awk sed done test
+		sed cd echo printf /usr/bin -eu && local awk sed /usr/bin cd sed
+		&& -eu -eu sed --verbose printf echo cd readonly /usr/bin printf /usr/bin && test
+		"$@" cd "$@" && printf local test export | sed readonly |
+		readonly sed /usr/bin -eu readonly | then local
+	readonly sed then | | local /usr/bin $(pwd) 'quoted text' --verbose
+	| done x=1 "$1" && printf then grep -eu sed echo "$1" 2>/dev/null
+	readonly printf $(pwd)
+		--verbose sed --verbose done 2>/dev/null test echo
+		&& export export 2>/dev/null local -eu test grep "$1"
+echo then grep $(pwd) 'quoted text' /usr/bin
+		/usr/bin printf ${HOME} 'quoted text' 'quoted text' --verbose
+${HOME} printf grep done done $(pwd) printf
+		echo awk x=1 test $(pwd) done echo cd x=1 | $(pwd)
+		--verbose then x=1 'quoted text' /usr/bin echo
+		"$1" /usr/bin echo done sed 'quoted text' x=1 /usr/bin && "$@"
+	"$@" export 'quoted text' x=1 ${HOME} echo
+	2>/dev/null sed $(pwd) grep done x=1
+	echo ${HOME} then --verbose local ${HOME} test echo ${HOME} /usr/bin
+		${HOME} readonly 2>/dev/null cd | test $(pwd) "$1" grep $(pwd)
+		--verbose 2>/dev/null -eu cd grep 'quoted text' readonly && printf x=1 sed
+"$1" echo ${HOME} $(pwd) printf grep 'quoted text' x=1
+	2>/dev/null 2>/dev/null | done local grep sed "$@" local cd
+'quoted text' && export 'quoted text' local done awk readonly "$1" sed readonly
+		echo sed done "$1" $(pwd) echo export export --verbose
+"$1" cd && export echo 2>/dev/null 'quoted text'
+	test done -eu "$@" echo local 'quoted text' x=1 done "$1"
+cd /usr/bin $(pwd) then $(pwd) 'quoted text'
+	done done /usr/bin readonly | test readonly 2>/dev/null
+local /usr/bin 2>/dev/null cd /usr/bin | && test then test test
+		-eu done export local "$1" sed ${HOME} cd done awk local && -eu |
+test cd done 'quoted text' readonly done awk printf
+		cd ${HOME} local -eu awk readonly grep && printf 2>/dev/null
+local x=1 -eu done 'quoted text' /usr/bin export awk "$@" $(pwd) awk --verbose
+		/usr/bin sed printf "$@" echo /usr/bin "$1" --verbose grep 'quoted text'
+"$@" "$1" test readonly cd done local x=1
+		cd grep && then local local then
+		| "$@" export $(pwd) then
+readonly --verbose && "$@" test --verbose
+	| -eu "$1" ${HOME} cd grep /usr/bin ${HOME} /usr/bin local
+$(pwd) "$@" /usr/bin ${HOME} x=1 && cd "$@" &&
+export test | $(pwd) /usr/bin -eu $(pwd) readonly "$@" awk
+x=1 export grep && --verbose x=1
+		/usr/bin | 2>/dev/null ${HOME} cd && grep sed 'quoted text'
+2>/dev/null test && 'quoted text' --verbose $(pwd) 'quoted text'
+	"$@" 2>/dev/null -eu ${HOME} /usr/bin -eu printf done "$@" $(pwd) cd "$@"
+-eu 2>/dev/null | test grep ${HOME} && "$1" "$1" -eu --verbose
+		done /usr/bin -eu | done readonly $(pwd) /usr/bin cd -eu -eu "$1" && awk
+		x=1 /usr/bin "$1" readonly then
+local printf test grep ${HOME} 'quoted text'
+sed sed awk readonly printf then $(pwd) 'quoted text'
+x=1 "$1" "$@" -eu export "$@"
+	done grep printf x=1 then 'quoted text' sed readonly $(pwd) && "$1"
+	&& -eu local readonly export readonly awk grep /usr/bin && awk x=1 'quoted text'
+	printf sed "$@" /usr/bin test x=1 printf --verbose x=1 && "$1" readonly cd | "$@"
+-eu echo then readonly ${HOME} /usr/bin echo
+--verbose "$@" grep 'quoted text' awk then export
+	local sed 2>/dev/null && printf /usr/bin -eu ${HOME}
+	/usr/bin cd sed 2>/dev/null then grep sed ${HOME} local ${HOME} 'quoted text'
+		${HOME} cd sed ${HOME} 2>/dev/null grep then echo done ${HOME} grep $(pwd) awk
+	awk $(pwd) 'quoted text' cd test 2>/dev/null
+	/usr/bin /usr/bin ${HOME} "$1" export -eu cd
+		"$@" && sed done "$@" export local printf && sed grep | awk 'quoted text'
+/usr/bin -eu echo done
+sed awk then export awk | -eu $(pwd) | readonly && && test -eu --verbose
+	2>/dev/null | /usr/bin 2>/dev/null $(pwd) | test sed | x=1 /usr/bin ${HOME} cd
+export done test test local test
+readonly then | sed local "$@" test
+		echo && done /usr/bin | sed "$1" /usr/bin --verbose printf $(pwd) readonly
+		then "$1" ${HOME} export --verbose
+"$1" --verbose then readonly --verbose then
+${HOME} awk 2>/dev/null --verbose /usr/bin local ${HOME} printf ${HOME} grep "$@"
+	$(pwd) /usr/bin done 2>/dev/null readonly && readonly 2>/dev/null
+| && readonly grep /usr/bin test done --verbose done 2>/dev/null test
+-eu echo $(pwd) ${HOME}
+	'quoted text' "$@" 2>/dev/null
+		${HOME} printf $(pwd) x=1 ${HOME}
+then "$1" sed test printf | -eu x=1 x=1 $(pwd) | $(pwd)
+	/usr/bin "$1" /usr/bin "$@" grep && done printf grep echo printf export sed
+	x=1 "$1" $(pwd) cd --verbose local
+		--verbose && x=1 test done 2>/dev/null
+"$1" sed cd done 'quoted text' | awk cd test $(pwd) x=1 --verbose x=1 printf
+	"$1" "$1" /usr/bin "$1" export | echo done $(pwd) 2>/dev/null cd test
+$(pwd) 2>/dev/null grep echo
+2>/dev/null ${HOME} ${HOME} grep 2>/dev/null echo "$1"
+		-eu awk done 2>/dev/null test local && export
+	2>/dev/null "$1" then test &&
+	'quoted text' x=1 local then local | readonly then 'quoted text'
+cd grep "$1" 'quoted text' && printf sed local
+$(pwd) /usr/bin done x=1 export grep export && 'quoted text'
+	printf 2>/dev/null --verbose cd x=1 test $(pwd) /usr/bin "$1" "$@"
+	x=1 local --verbose printf 2>/dev/null test grep 'quoted text'
+	--verbose "$1" "$@" 2>/dev/null awk -eu grep cd ${HOME} x=1 2>/dev/null
+		--verbose 'quoted text' -eu $(pwd) x=1 export export
+	test awk "$@" && | 'quoted text' "$@"
+2>/dev/null test "$1" cd "$@" x=1 cd grep -eu then 'quoted text' readonly
+x=1 awk 'quoted text' echo local | /usr/bin
+		&& ${HOME} done grep printf /usr/bin test cd cd | local "$@" grep test $(pwd)
+export "$@" cd sed printf
+		| done $(pwd) sed echo then -eu grep |
+	/usr/bin ${HOME} test --verbose x=1 export sed -eu export then
+		$(pwd) then echo $(pwd) "$1" echo ${HOME} sed $(pwd)
+		&& /usr/bin local sed then "$1" readonly 2>/dev/null "$1" grep $(pwd) readonly
+	--verbose local "$@" ${HOME} printf sed -eu $(pwd) cd awk
+	x=1 awk /usr/bin grep sed cd local printf grep cd done
+	2>/dev/null test done /usr/bin awk done
+	'quoted text' test "$1" test done sed x=1 -eu "$1" awk "$1" then local
+&& echo sed "$@" printf 2>/dev/null "$1" readonly echo local ${HOME} ${HOME} cd
+--verbose done printf done
+		sed -eu | | && printf /usr/bin export sed /usr/bin then
+	test awk grep export then awk sed ${HOME} grep printf $(pwd) "$@" printf
+	local 'quoted text' test x=1 --verbose
+		&& sed then | echo printf cd sed then echo
+'quoted text' local done test -eu done "$@" 'quoted text'
+"$1" grep test | "$1" sed -eu $(pwd) /usr/bin test ${HOME} printf done x=1
+		echo x=1 export cd 2>/dev/null sed "$1" "$@" echo done echo awk -eu 2>/dev/null
+		cd ${HOME} echo --verbose "$1" x=1 "$1" 'quoted text' && "$@" cd awk local sed
+	/usr/bin | sed /usr/bin then
+		local test | export $(pwd) cd ${HOME} 2>/dev/null
+	export $(pwd) x=1 ${HOME} done sed then "$@" printf 2>/dev/null local
+export --verbose readonly awk sed && && 'quoted text' printf | && sed
+		cd "$1" -eu sed x=1 cd --verbose
+	then "$1" then cd done --verbose grep cd $(pwd) grep /usr/bin
+		'quoted text' readonly echo | done 2>/dev/null echo cd /usr/bin /usr/bin "$@" "$1"
+		local awk 'quoted text'
+	sed x=1 && grep readonly
+	&& local /usr/bin sed | cd echo 'quoted text' sed awk -eu $(pwd) $(pwd)
+		x=1 printf ${HOME} done
+		${HOME} then -eu -eu 'quoted text' 'quoted text'
+		test && readonly $(pwd) --verbose sed $(pwd)
+	echo | ${HOME} sed 'quoted text' ${HOME} echo | test ${HOME} then test /usr/bin
+	x=1 grep local && && | 2>/dev/null && local sed /usr/bin x=1 ${HOME} $(pwd)
+/usr/bin cd then done echo | ${HOME} test readonly echo awk local
+	${HOME} done && readonly cd x=1 --verbose readonly -eu "$1" -eu && "$1"
+${HOME} cd local 2>/dev/null x=1 "$1" grep export -eu -eu "$1" --verbose
+cd $(pwd) grep export "$@" && -eu export "$@"
+		--verbose echo grep $(pwd) awk ${HOME} ${HOME} x=1 cd 'quoted text'
+| "$@" test cd test cd export && test sed then && x=1 && grep printf done local
+		test awk readonly then x=1 "$@" sed test cd sed then 2>/dev/null |
+${HOME} $(pwd) x=1 readonly && ${HOME} 2>/dev/null && grep x=1 echo export
+'quoted text' -eu -eu -eu readonly 'quoted text' "$1" /usr/bin "$1" then printf
+	${HOME} echo readonly "$1" --verbose cd 'quoted text'
+	$(pwd) printf --verbose export -eu x=1 grep awk test $(pwd) &&
+		done sed grep --verbose ${HOME} sed && 2>/dev/null
+	| export export sed export readonly "$1" then export ${HOME}
+/usr/bin awk readonly && echo 'quoted text' "$1"
+"$@" -eu test | test "$@" 'quoted text' $(pwd)
+	| then x=1 x=1 cd cd done local && done readonly
+'quoted text' readonly done grep -eu test then local test 'quoted text' export
+grep cd local "$1" 'quoted text' /usr/bin x=1 "$@" readonly $(pwd) cd grep cd
+	$(pwd) $(pwd) cd $(pwd) "$1" 2>/dev/null -eu ${HOME} then $(pwd)
+sed then cd /usr/bin 2>/dev/null readonly
+	--verbose | "$@" readonly readonly sed x=1 awk "$@" 2>/dev/null && --verbose
+	grep --verbose -eu 2>/dev/null
+	sed | export grep export --verbose then readonly /usr/bin grep &&
+	$(pwd) 2>/dev/null export 'quoted text'
+echo "$@" --verbose --verbose local then | && $(pwd) local
+/usr/bin test then readonly readonly /usr/bin "$@"
+		--verbose readonly grep then "$@" 2>/dev/null 2>/dev/null cd done grep export
+	cd "$1" --verbose 2>/dev/null done --verbose && readonly
+		| $(pwd) cd echo $(pwd) -eu ${HOME} cd && then && cd 2>/dev/null grep
+		grep -eu | printf /usr/bin test x=1 echo | cd readonly /usr/bin export
+		sed --verbose "$1" | sed /usr/bin test "$1" test x=1 /usr/bin readonly done
+		/usr/bin done "$1" echo readonly | 'quoted text'
+		done 2>/dev/null grep && export readonly x=1 printf
+cd -eu ${HOME} $(pwd) /usr/bin
+	'quoted text' export test --verbose echo awk cd |
+		readonly local -eu | local local 'quoted text' then
+		then -eu --verbose "$1" grep export done awk && ${HOME} | readonly 'quoted text'
+		-eu done 'quoted text' readonly sed echo export local | | printf ${HOME}
+${HOME} readonly | cd printf "$1" $(pwd)
+&& grep x=1 local -eu 2>/dev/null readonly -eu local
+	--verbose echo -eu "$1" grep echo echo test local
+		${HOME} x=1 test && readonly --verbose
+		test printf "$@" echo grep 'quoted text' awk
+		x=1 readonly export 'quoted text'
+		export readonly --verbose grep
+	export local "$1" 'quoted text'
+		sed test ${HOME} echo -eu readonly local ${HOME} printf readonly $(pwd) echo printf
+export export -eu &&
+test grep 'quoted text'
+/usr/bin /usr/bin $(pwd) 2>/dev/null "$1" then test echo ${HOME} local
+readonly cd grep -eu 2>/dev/null local
+-eu x=1 /usr/bin && grep
+	/usr/bin then echo then awk 'quoted text' 2>/dev/null ${HOME} then awk readonly
+		then -eu "$1" 2>/dev/null $(pwd) awk export
+		sed ${HOME} ${HOME} readonly "$@" export 2>/dev/null && x=1 'quoted text'
+sed --verbose ${HOME} cd echo readonly cd cd test
+	-eu readonly && echo 2>/dev/null /usr/bin
+		cd done readonly awk --verbose "$@" x=1 "$@" local 2>/dev/null ${HOME}
+		"$1" test cd then $(pwd) export "$@" "$@" done cd 2>/dev/null printf 'quoted text'
+	readonly $(pwd) -eu sed "$1"
+test 'quoted text' -eu | printf x=1
+	test "$1" echo then 'quoted text' ${HOME}
+	awk sed local "$1" $(pwd) export awk "$1" sed
+	'quoted text' readonly $(pwd)
+		then awk -eu awk export -eu cd echo 2>/dev/null
+		then grep cd && | | export
+	-eu cd $(pwd) 'quoted text' && /usr/bin "$@" x=1 | then -eu ${HOME} "$1" 'quoted text'
+	'quoted text' cd "$1" --verbose x=1 sed && --verbose
+then cd awk $(pwd) $(pwd)
+	x=1 -eu local 2>/dev/null | ${HOME}
+		done ${HOME} echo 2>/dev/null 'quoted text' "$@" awk then "$1" "$@" then
+done local 2>/dev/null -eu -eu sed ${HOME} printf 'quoted text'
+printf /usr/bin grep grep /usr/bin -eu $(pwd) done printf
+	/usr/bin awk awk $(pwd) then "$@" local && test 2>/dev/null
+	$(pwd) | | test && readonly $(pwd) local | && |
+/usr/bin /usr/bin "$@" && cd ${HOME} | local && x=1
+		sed ${HOME} "$@" /usr/bin | 2>/dev/null 2>/dev/null grep
+awk "$@" 2>/dev/null printf readonly x=1 'quoted text' --verbose export
+export echo -eu "$1" |
+	2>/dev/null done | printf && /usr/bin export sed ${HOME}
+	readonly printf 'quoted text' /usr/bin awk grep echo "$@"
+	awk done test x=1 --verbose grep --verbose | then readonly -eu sed x=1
+	/usr/bin done cd then | test --verbose | sed readonly && local printf awk ${HOME}
+'quoted text' done test && test && echo
+done -eu test "$1" "$1" done cd 2>/dev/null --verbose cd awk echo done
+| 2>/dev/null local -eu grep test export
+	x=1 'quoted text' test /usr/bin | grep 'quoted text' /usr/bin -eu grep grep
+${HOME} && /usr/bin && $(pwd) done 2>/dev/null 2>/dev/null "$@" awk grep
+		&& 2>/dev/null export
+	-eu --verbose 2>/dev/null test 2>/dev/null /usr/bin
+		| cd local local printf 2>/dev/null printf -eu cd test printf
+		x=1 -eu "$@" 2>/dev/null test | "$1" grep 2>/dev/null export /usr/bin done
+	${HOME} "$@" && then sed ${HOME} local $(pwd) test x=1
+$(pwd) local done export grep /usr/bin
+"$1" done ${HOME} 'quoted text' x=1 && ${HOME} | grep echo then | 'quoted text'
+		&& x=1 'quoted text' grep then export
+		grep ${HOME} 'quoted text'
+	cd ${HOME} readonly cd done local export && ${HOME}
+		readonly export $(pwd) --verbose done
+		printf -eu printf | && --verbose readonly
+	echo "$1" awk local ${HOME}
+export awk "$@" grep --verbose "$1" echo --verbose --verbose
+	done test x=1 echo | export && cd && local $(pwd) printf readonly && printf
+readonly "$1" --verbose awk x=1 awk /usr/bin | 'quoted text'
+		${HOME} grep printf export readonly
+| $(pwd) "$@" printf -eu ${HOME} $(pwd) grep |
+		"$1" --verbose cd 2>/dev/null x=1 'quoted text' readonly sed printf
+	then local /usr/bin printf -eu | x=1 echo
+	grep "$@" | readonly ${HOME} grep test printf echo printf $(pwd)
+done awk grep awk readonly export printf -eu x=1 "$@" done done
+		done "$@" "$1" && | $(pwd) sed sed done "$@" then ${HOME} 2>/dev/null --verbose
+done printf /usr/bin ${HOME} echo sed test awk -eu printf local /usr/bin local
+'quoted text' export then -eu $(pwd) 2>/dev/null "$1" local
+	x=1 && 'quoted text' awk 2>/dev/null "$@" test readonly printf done test x=1
+then printf cd awk grep 'quoted text' x=1 echo
+		"$@" sed local "$@" done --verbose export ${HOME}
+$(pwd) done | echo then echo $(pwd) 2>/dev/null "$@" then cd
+		done grep $(pwd) | 2>/dev/null awk ${HOME} 2>/dev/null
+2>/dev/null then then test ${HOME} cd echo test x=1 export sed 2>/dev/null
+awk && local "$@" grep readonly "$@" | -eu "$@" "$1" awk echo test
+		/usr/bin done && && -eu $(pwd) && "$1" $(pwd) "$@" 'quoted text' cd grep $(pwd)
+awk 2>/dev/null | 'quoted text' awk /usr/bin export done &&
+	local test 'quoted text' printf cd -eu --verbose | "$1" done sed $(pwd)
+		grep /usr/bin && ${HOME} 'quoted text'
+	printf --verbose test /usr/bin "$1" printf done sed --verbose test $(pwd) x=1
+		-eu /usr/bin echo printf test x=1 /usr/bin export test sed $(pwd)
+echo sed local local
+--verbose done sed 'quoted text' test | grep && test x=1 done sed && grep
+$(pwd) awk 'quoted text' "$@" printf cd "$@" /usr/bin ${HOME} -eu sed printf cd
+		'quoted text' $(pwd) grep -eu -eu x=1 $(pwd)
+		x=1 printf "$1" done cd done done test awk readonly
+sed 2>/dev/null awk -eu export "$1" 2>/dev/null
+"$1" $(pwd) then echo printf --verbose
+/usr/bin export 2>/dev/null grep 2>/dev/null $(pwd) readonly
+printf cd 2>/dev/null 'quoted text' then -eu -eu readonly done &&
+		$(pwd) sed "$@" printf $(pwd) 2>/dev/null cd 'quoted text' printf
+	| --verbose done awk x=1 awk --verbose test --verbose ${HOME} awk "$@"
+		echo printf then 'quoted text' local 2>/dev/null printf
+	x=1 done "$1" sed cd "$1" ${HOME} --verbose && done grep
+x=1 echo && then && readonly 'quoted text' 2>/dev/null
+	printf export cd cd 'quoted text' readonly awk awk && &&
+		grep --verbose test test readonly test
+then cd "$@" cd --verbose /usr/bin
+		-eu sed then cd "$1" -eu $(pwd) $(pwd) -eu done sed
+"$1" echo ${HOME} "$@" echo local 2>/dev/null printf x=1
+		-eu "$@" 'quoted text' -eu printf && export | then grep readonly
+/usr/bin readonly export done --verbose 'quoted text'
+printf $(pwd) cd echo cd grep x=1
+awk done --verbose cd grep 2>/dev/null 'quoted text'
+		'quoted text' 'quoted text' /usr/bin
+	$(pwd) $(pwd) printf readonly
+readonly then export | x=1 cd "$@" x=1 test
+grep "$1" then 'quoted text' test 2>/dev/null
+	echo local 2>/dev/null "$1" "$1" -eu local $(pwd) -eu awk local then test done
+		cd readonly "$1" sed grep ${HOME} $(pwd) ${HOME} echo echo /usr/bin | grep sed
+	| 2>/dev/null done awk sed export sed
+		| sed echo echo 'quoted text' $(pwd) --verbose x=1
+		$(pwd) -eu $(pwd) sed done ${HOME} sed
+	readonly awk /usr/bin awk echo x=1 --verbose
+	sed then awk ${HOME} ${HOME} done export 'quoted text'
+--verbose cd ${HOME} then
+readonly && | done grep -eu "$@" -eu grep sed export
+	local awk "$@" | then "$1"
+	${HOME} ${HOME} 2>/dev/null --verbose ${HOME} -eu cd --verbose && done
+	done ${HOME} x=1 then local sed
+		-eu -eu x=1 local -eu | x=1 -eu test done awk echo "$1" x=1 sed test
+then && "$@" && local then
+| cd then local sed 'quoted text' 2>/dev/null x=1 "$1" && && export ${HOME}
+	then 'quoted text' /usr/bin /usr/bin -eu cd test "$1" then test | done
+		printf sed done local echo done export --verbose
+	${HOME} 'quoted text' 2>/dev/null cd "$1" echo | printf x=1 "$1" "$@" test
+		done --verbose sed 2>/dev/null "$1" export
+local done test awk --verbose && 2>/dev/null
+/usr/bin "$@" /usr/bin then --verbose && done then 2>/dev/null
+		test --verbose cd export
+		--verbose test local -eu local | $(pwd) readonly export awk
+$(pwd) -eu 2>/dev/null printf 'quoted text' echo "$1" printf x=1 readonly test echo
+		export $(pwd) export readonly printf
+sed 'quoted text' && grep /usr/bin grep export "$1" --verbose printf
+		2>/dev/null readonly "$@" echo 2>/dev/null printf cd test 'quoted text'
+	echo cd 2>/dev/null readonly export
+	readonly local x=1 test readonly test sed
+		done ${HOME} then ${HOME} readonly x=1
+$(pwd) $(pwd) -eu /usr/bin "$@" | then grep printf done
+		-eu local /usr/bin echo --verbose
+echo /usr/bin 2>/dev/null -eu export
+done "$@" -eu readonly export readonly
+	"$@" $(pwd) | /usr/bin /usr/bin -eu sed local test done
+"$@" -eu test $(pwd) "$@" cd local grep echo
+2>/dev/null /usr/bin export 'quoted text'
+	readonly done $(pwd) "$@" | export -eu --verbose 'quoted text'
+		'quoted text' test printf 2>/dev/null x=1 2>/dev/null 2>/dev/null
+		"$@" grep --verbose 2>/dev/null "$1" awk echo
+		"$@" 'quoted text' grep grep 2>/dev/null awk export -eu printf
+awk export local sed "$@"
+	done --verbose | x=1 done test 'quoted text' echo
+		sed x=1 2>/dev/null grep echo && "$1" | |
+-eu export "$1" echo export then
+'quoted text' then cd /usr/bin --verbose --verbose sed | readonly printf
+		readonly readonly "$@" && sed "$1" ${HOME} done then ${HOME} ${HOME} export
+		$(pwd) done 2>/dev/null 'quoted text'
+/usr/bin local $(pwd) "$@" then done then 'quoted text' --verbose
+	2>/dev/null -eu && done --verbose && cd "$1" local test then local export
+		$(pwd) && done && 'quoted text'
+readonly "$@" then local /usr/bin --verbose then /usr/bin then "$@" x=1
+'quoted text' 'quoted text' "$@" done
+${HOME} sed grep x=1 readonly /usr/bin ${HOME} sed then test test && $(pwd)
+		x=1 ${HOME} ${HOME} && &&
+		&& && echo grep 2>/dev/null local && readonly awk x=1 "$@" "$@" && readonly
+--verbose | local readonly ${HOME} test 2>/dev/null done export readonly done readonly
+	echo cd 'quoted text' --verbose --verbose
+	"$@" sed done ${HOME} && local -eu $(pwd)
+echo "$@" awk && sed "$@" grep 'quoted text'
+	sed test -eu local awk cd "$@" echo /usr/bin --verbose
+	&& test printf x=1 2>/dev/null ${HOME} local local
+	"$@" "$@" "$1" local echo echo ${HOME} cd --verbose local "$@" $(pwd)
+"$1" echo export | then x=1 x=1 --verbose $(pwd)
+	awk "$@" grep /usr/bin "$1"
+	then "$@" test /usr/bin cd ${HOME} ${HOME} x=1 cd local $(pwd) test
+awk printf readonly sed $(pwd) export done test
+	then --verbose grep && "$1" x=1 ${HOME} 2>/dev/null
+		"$1" awk echo 'quoted text' --verbose readonly /usr/bin sed $(pwd) | awk
+-eu local export $(pwd) cd grep x=1 cd $(pwd) then x=1 awk
+--verbose /usr/bin awk --verbose echo 2>/dev/null
+x=1 -eu "$@" x=1 done && "$@"
+test x=1 --verbose 2>/dev/null /usr/bin "$1"
+	/usr/bin test ${HOME} then 2>/dev/null
+printf 2>/dev/null then awk export grep local printf printf && echo
+		&& x=1 awk printf grep local
+grep $(pwd) grep local x=1 done done
+	then 2>/dev/null printf sed printf "$1" local && ${HOME} local &&
+		echo $(pwd) echo printf then awk readonly sed -eu --verbose ${HOME} sed grep
+	--verbose /usr/bin $(pwd) 2>/dev/null | printf
+		done x=1 echo done --verbose /usr/bin
+		grep 2>/dev/null cd test
+	--verbose then local test $(pwd)
+	/usr/bin "$1" sed grep awk
+		export done local $(pwd) grep then x=1 -eu local x=1 2>/dev/null
+		done $(pwd) done | local printf $(pwd) | && awk -eu done $(pwd)
+	$(pwd) then && -eu then readonly echo x=1 done $(pwd) readonly
+		echo echo test test "$1" 2>/dev/null then --verbose "$@"
+	grep | x=1 ${HOME} awk echo
+	&& "$@" 2>/dev/null x=1 --verbose
+export | grep ${HOME} sed "$1" done grep local test
+		local "$1" "$1" test --verbose export sed "$@" echo
+		sed grep $(pwd) local && then cd "$@" sed done 2>/dev/null awk local
+	&& grep sed export done "$@" local "$1" local 'quoted text'
+echo then && then x=1 printf /usr/bin x=1 2>/dev/null grep test test done then
+		cd cd "$@" --verbose 'quoted text' export
+		x=1 done done "$@" | local | printf /usr/bin --verbose
+		echo -eu cd export grep test cd
+		then ${HOME} /usr/bin $(pwd) --verbose --verbose export local
+--verbose -eu x=1 cd then done ${HOME} x=1
+	2>/dev/null "$@" grep then && 'quoted text' echo
+"$@" | local sed done test
+		readonly 'quoted text' local $(pwd) x=1 test export "$1" 'quoted text'
+	local sed /usr/bin echo 2>/dev/null
+	$(pwd) export awk export echo "$@" test $(pwd) local sed
+local 'quoted text' "$@" sed awk grep export
+		2>/dev/null /usr/bin then ${HOME}
+	echo x=1 && cd -eu $(pwd) "$@" then sed ${HOME} sed
+	--verbose x=1 --verbose $(pwd) printf
+	awk x=1 | then && awk /usr/bin
+		awk printf local --verbose echo
+		$(pwd) sed printf awk --verbose then printf "$@" | cd cd ${HOME} "$1"
+		/usr/bin -eu local "$@" "$@" -eu done 'quoted text' "$@" ${HOME}
+		/usr/bin -eu $(pwd) -eu && cd grep 2>/dev/null echo sed local printf
+| $(pwd) done local sed
+	done "$@" export | 2>/dev/null export echo then -eu /usr/bin
+local x=1 | test "$@" && "$1" then 2>/dev/null $(pwd) x=1 "$@" grep 2>/dev/null
+		awk $(pwd) awk sed "$1" "$1" readonly done x=1 "$1" /usr/bin
+	awk x=1 "$@" local local -eu $(pwd) sed test --verbose x=1 'quoted text'
+	printf -eu /usr/bin awk
+	/usr/bin export local 2>/dev/null
+	cd -eu && x=1 awk export done sed then readonly /usr/bin
+	$(pwd) -eu sed /usr/bin "$@" --verbose sed "$1" test readonly --verbose export
+	readonly printf $(pwd) printf -eu local x=1 test export echo -eu
+'quoted text' cd done $(pwd)
+export local 2>/dev/null export echo printf echo --verbose
+		--verbose readonly test |
+		echo cd ${HOME} awk local ${HOME} | x=1 echo x=1 test local $(pwd)
+		grep "$@" grep export local cd then printf $(pwd) | ${HOME} grep printf
+	x=1 printf x=1 $(pwd) --verbose
+		sed | then 2>/dev/null "$@" echo --verbose local "$@" printf 2>/dev/null
+${HOME} then grep ${HOME} done /usr/bin grep "$1" local && grep echo
+	-eu awk --verbose then $(pwd) then readonly ${HOME} sed echo grep
+		sed | readonly | done
+	test sed echo 2>/dev/null x=1 cd export grep awk $(pwd) "$@" 2>/dev/null
+'quoted text' --verbose test
+x=1 2>/dev/null x=1 "$1" awk then cd 2>/dev/null
+readonly readonly --verbose 'quoted text' echo
+2>/dev/null readonly 2>/dev/null done 'quoted text' grep export export readonly
+		export $(pwd) readonly grep x=1 $(pwd) 2>/dev/null ${HOME}
+	echo then awk test -eu ${HOME} done cd test "$@" /usr/bin done readonly
+"$1" "$1" ${HOME} "$1" /usr/bin "$@" done sed 2>/dev/null test /usr/bin
+	readonly --verbose "$1" printf export done readonly sed export -eu then
+	sed done 2>/dev/null -eu awk x=1 export
+local echo x=1 local "$1" echo test echo cd "$@" --verbose printf $(pwd)
+	2>/dev/null echo 2>/dev/null readonly grep readonly
+	test printf export -eu sed awk | "$1" readonly --verbose
+		sed sed echo -eu ${HOME} then 'quoted text'
+	local cd x=1 then "$@" test --verbose x=1 $(pwd) x=1 printf
+	"$1" -eu printf 2>/dev/null | /usr/bin --verbose readonly
+export cd | echo /usr/bin test grep $(pwd) echo cd test
+done -eu 2>/dev/null x=1
+	$(pwd) --verbose ${HOME} x=1
+sed awk cd echo local 2>/dev/null x=1 $(pwd) $(pwd)
+		$(pwd) grep 'quoted text' | 2>/dev/null readonly "$1" awk /usr/bin
+		$(pwd) "$@" "$@" --verbose then grep export ${HOME}
+	${HOME} cd x=1 | then readonly x=1 x=1 $(pwd) 'quoted text' export printf
+	&& 'quoted text' printf printf export
+| printf then grep 2>/dev/null awk cd /usr/bin
+		then $(pwd) sed -eu done ${HOME} --verbose
+	echo "$1" sed sed cd /usr/bin "$@" && /usr/bin --verbose --verbose
+		x=1 awk then test && sed 'quoted text' printf
+	awk 'quoted text' sed cd export | ${HOME} /usr/bin
+"$@" printf printf "$1" awk awk | echo
+/usr/bin local then echo readonly x=1 local "$@"
+	printf x=1 /usr/bin 2>/dev/null test sed
+		/usr/bin $(pwd) ${HOME} $(pwd) printf -eu done done test awk --verbose
+	awk | readonly printf export
+grep ${HOME} awk x=1 then cd awk sed 'quoted text' printf "$@" grep /usr/bin awk
+		$(pwd) && --verbose sed x=1 2>/dev/null
+		export && "$1" sed sed readonly /usr/bin
+	x=1 ${HOME} 'quoted text'
+	done sed --verbose && x=1 done test echo && | sed x=1 2>/dev/null /usr/bin printf
+	x=1 "$1" printf awk local /usr/bin then /usr/bin
+readonly printf ${HOME} 2>/dev/null
+${HOME} then grep /usr/bin ${HOME} x=1 --verbose
+	printf ${HOME} | printf $(pwd) export awk printf then then echo
+		--verbose grep done "$1" local | /usr/bin sed local -eu "$@"
+	echo --verbose ${HOME} "$1" "$1" export 'quoted text'
+	2>/dev/null awk local /usr/bin
+	export then test -eu | echo readonly --verbose $(pwd)
+	test readonly sed done grep cd 'quoted text' && printf
+	${HOME} test cd readonly grep test done
+	"$1" "$@" $(pwd) grep ${HOME} --verbose test printf /usr/bin $(pwd) readonly
+echo readonly 'quoted text'
+		2>/dev/null | $(pwd) && -eu | 'quoted text' ${HOME}
+	2>/dev/null --verbose grep -eu local done
+		| ${HOME} 'quoted text' echo x=1 $(pwd) then ${HOME} export /usr/bin
+		"$@" x=1 readonly sed echo "$@" --verbose readonly export && /usr/bin
+		${HOME} 'quoted text' export printf
+		then cd awk -eu then -eu $(pwd) test /usr/bin grep ${HOME} done --verbose
+		sed test "$1" -eu done export
+		test x=1 then local "$@" | $(pwd) then "$@" grep local export then x=1
+	-eu --verbose done x=1 local test awk readonly
+then readonly /usr/bin printf
+2>/dev/null x=1 test "$@" export x=1 --verbose done echo
+	x=1 -eu local && "$1" printf /usr/bin grep --verbose && readonly
+		${HOME} done done /usr/bin readonly sed ${HOME} -eu x=1 /usr/bin readonly
+${HOME} local "$@" -eu echo --verbose 'quoted text'
+		then echo echo && x=1 then $(pwd) --verbose -eu awk
+	--verbose "$1" export --verbose
+grep readonly ${HOME} then ${HOME}
+${HOME} cd then $(pwd) cd x=1 | | done
+		x=1 readonly "$@" --verbose
+		sed $(pwd) 2>/dev/null 'quoted text' cd sed | $(pwd)
+x=1 printf $(pwd) awk grep sed awk "$@" sed printf echo | readonly /usr/bin
+		done ${HOME} x=1 /usr/bin --verbose
+		awk done 2>/dev/null export
+	printf done done sed 2>/dev/null awk awk $(pwd) "$1" cd then
+echo x=1 readonly printf -eu 'quoted text' readonly
+	then cd /usr/bin grep && cd --verbose echo -eu then 'quoted text' sed $(pwd)
+	awk "$@" 2>/dev/null x=1 | -eu $(pwd) $(pwd) awk x=1 sed
+		--verbose 2>/dev/null then test x=1
+-eu $(pwd) test local cd printf echo sed
+printf /usr/bin 'quoted text' cd then ${HOME} printf
+-eu /usr/bin export sed /usr/bin printf cd grep ${HOME} echo
+	--verbose -eu "$@" printf sed printf --verbose | /usr/bin cd "$1" export
+"$1" 'quoted text' then "$@" ${HOME}
+grep export export -eu $(pwd)
+	2>/dev/null "$1" test /usr/bin
+cd local | /usr/bin local export export
+		echo awk 'quoted text'
+	grep ${HOME} export grep "$@" sed readonly
+	$(pwd) sed then awk 'quoted text' printf && && 2>/dev/null -eu | done "$@"
+	2>/dev/null awk | cd 'quoted text' $(pwd)
+		2>/dev/null | "$1" 2>/dev/null local | echo 2>/dev/null cd "$@"
+awk sed /usr/bin then --verbose export "$1"
+sed grep "$@" 2>/dev/null sed then $(pwd) then | awk
+	-eu readonly "$@" then --verbose 'quoted text' then /usr/bin grep
+${HOME} && "$1" 2>/dev/null x=1 then sed echo awk readonly $(pwd)
+		cd --verbose printf then "$1" echo cd sed test --verbose 'quoted text' x=1 "$1"
+	-eu grep "$1" "$1" ${HOME} -eu x=1 $(pwd)
+		printf echo echo "$1" -eu echo --verbose --verbose
+	/usr/bin /usr/bin export && then -eu export done
+	sed test x=1 x=1 readonly ${HOME} && --verbose | | 2>/dev/null test
+	&& | ${HOME} export local 'quoted text'
+cd x=1 | | /usr/bin local
+		/usr/bin "$@" done && local -eu local printf x=1 awk x=1 "$@" then
+		-eu local test && test test awk echo then --verbose "$@" &&
+		$(pwd) ${HOME} local x=1 "$@" 2>/dev/null
+x=1 done cd -eu printf 2>/dev/null /usr/bin printf printf
+	2>/dev/null && | cd sed && "$1" test /usr/bin
+		export local "$1" readonly printf /usr/bin "$1" echo
+--verbose then readonly /usr/bin /usr/bin /usr/bin
+	$(pwd) "$@" 'quoted text'
+export --verbose ${HOME} test then && printf readonly
+	x=1 then printf done "$@" -eu grep then | local grep readonly -eu
+"$1" /usr/bin awk awk 2>/dev/null grep /usr/bin
+		'quoted text' 'quoted text' sed x=1 awk 'quoted text' "$@" local awk readonly
+	| "$@" $(pwd) -eu cd 'quoted text' echo done grep x=1 grep readonly
+cd 2>/dev/null x=1 test printf $(pwd) done sed && ${HOME} -eu test
+		$(pwd) /usr/bin 'quoted text' test
+&& done readonly "$@" readonly export ${HOME} grep cd --verbose printf --verbose
+-eu "$1" cd printf -eu 'quoted text'
+		awk cd cd $(pwd) then awk sed /usr/bin --verbose "$1" ${HOME} readonly
+	done --verbose echo local 'quoted text' -eu ${HOME} | 2>/dev/null
+		readonly ${HOME} then printf cd awk
+		readonly && grep awk 2>/dev/null "$1" done --verbose 2>/dev/null
+"$1" done grep local && echo /usr/bin "$@" grep
+	--verbose && sed local ${HOME} 2>/dev/null
+		${HOME} done readonly 'quoted text'
+	"$1" "$@" awk readonly "$1" readonly "$@" "$@"
+	2>/dev/null "$1" sed /usr/bin ${HOME} awk then $(pwd)
+"$@" "$@" | "$1" 'quoted text' --verbose
+sed --verbose "$1" x=1 then -eu readonly
+2>/dev/null done x=1 /usr/bin $(pwd)
+	cd echo /usr/bin local grep awk
+		test 2>/dev/null export grep then export
+	echo cd printf grep | x=1 2>/dev/null
+	done cd x=1 "$1" readonly 2>/dev/null grep
+		/usr/bin test then readonly "$@" printf local
+		cd 'quoted text' /usr/bin export /usr/bin ${HOME} 2>/dev/null
+	grep "$1" readonly echo local done readonly
+"$@" "$@" grep "$1" done export x=1 awk
+x=1 printf export printf 'quoted text' $(pwd)
+		export cd -eu printf export && /usr/bin -eu echo grep readonly
+		grep echo ${HOME} then --verbose grep --verbose | 2>/dev/null export "$@" awk
+	--verbose x=1 readonly ${HOME} && readonly $(pwd)
+	x=1 | | --verbose --verbose
+		/usr/bin $(pwd) 'quoted text' $(pwd) $(pwd) test --verbose 2>/dev/null
+		$(pwd) 2>/dev/null -eu
+readonly awk "$@" export readonly printf test readonly
+		${HOME} --verbose "$@" ${HOME} && "$@" ${HOME} export export done 'quoted text'
+		readonly done local cd --verbose
+	local --verbose grep | x=1 then /usr/bin 2>/dev/null
+		awk then cd echo --verbose readonly ${HOME} x=1
+"$1" && sed printf done printf -eu 'quoted text' "$@"
+		awk grep $(pwd) grep && 'quoted text' echo then ${HOME} cd ${HOME}
+printf readonly cd "$@" local echo cd 'quoted text' /usr/bin
+	awk then grep done $(pwd) export echo -eu export then 2>/dev/null then
+	'quoted text' test grep 'quoted text'
+		sed | $(pwd) export -eu && --verbose sed $(pwd) echo $(pwd)
+done && grep local echo -eu done && 'quoted text' local
+awk awk ${HOME} echo local $(pwd) awk
+	echo 2>/dev/null --verbose -eu $(pwd) "$1" awk sed | then test $(pwd)
+		${HOME} 'quoted text' 2>/dev/null local
+		x=1 && grep then -eu 2>/dev/null grep readonly
+/usr/bin done printf test then then then 2>/dev/null -eu printf done
+		grep sed printf && 2>/dev/null && export cd $(pwd)
+&& test grep | "$1" cd echo
+sed test cd -eu local 2>/dev/null export
+		"$1" -eu test local "$@"
+	local 2>/dev/null test local
+		--verbose x=1 && grep
+"$@" -eu then "$@" grep awk awk "$@" cd "$1" "$@" printf
+		&& -eu test --verbose grep -eu grep sed --verbose &&
+		grep then echo "$1" "$@" ${HOME} printf local ${HOME} -eu awk local x=1 sed
+	'quoted text' done 'quoted text' && readonly
+	echo --verbose done | echo done
+	grep test test grep awk then
+	local 2>/dev/null | "$@" ${HOME} "$@" && -eu cd echo 2>/dev/null awk export
+'quoted text' export awk /usr/bin
+	sed ${HOME} export echo export local && export "$@" "$@"
+		test then then awk then ${HOME} printf x=1 /usr/bin
+	x=1 "$1" --verbose $(pwd) $(pwd) sed
+		done echo cd && && printf $(pwd)
+	then export "$@" echo test
+		"$@" "$@" ${HOME} echo local grep /usr/bin done export "$@"
+		--verbose 'quoted text' awk -eu
+		&& printf 'quoted text' /usr/bin $(pwd) "$@" ${HOME}
+echo sed test test "$@" grep done --verbose test "$1"
+	sed then printf echo printf "$1" sed && x=1
+		-eu local --verbose readonly "$1" "$1" -eu 'quoted text' $(pwd) ${HOME}
+		2>/dev/null printf sed | x=1 && sed readonly 2>/dev/null
+/usr/bin | "$1" sed sed && ${HOME}
+echo && x=1 2>/dev/null sed echo | echo printf export local test "$@" --verbose
+		"$@" test awk --verbose "$@" --verbose --verbose
+	&& "$@" printf x=1 && -eu x=1 local local "$1" sed printf readonly -eu
+then "$1" 'quoted text' awk readonly $(pwd) sed done readonly echo test
+		| "$1" -eu -eu && /usr/bin
+2>/dev/null readonly ${HOME} 2>/dev/null 'quoted text' cd | readonly printf
+		sed --verbose test then x=1 'quoted text' 'quoted text' test && && done grep cd
+--verbose then ${HOME} echo echo sed "$@" --verbose "$@" $(pwd) grep
+		test -eu /usr/bin local export export --verbose
+&& then echo $(pwd) 2>/dev/null
+	/usr/bin sed -eu test /usr/bin
+	&& test test "$1" | 2>/dev/null done $(pwd) 2>/dev/null /usr/bin export then
+	'quoted text' "$1" --verbose 'quoted text' local
+'quoted text' local then "$@" /usr/bin "$1" grep
+&& local | readonly ${HOME} --verbose --verbose sed | x=1 then 'quoted text'
@@ -0,0 +1,2001 @@
+	test $(pwd) local local test "$1" "$1"
+"$1" echo readonly && -eu awk local 2>/dev/null printf
+	cd echo awk | | awk done "$1" 2>/dev/null $(pwd) --verbose
+	'quoted text' printf export awk /usr/bin --verbose /usr/bin
+		printf -eu /usr/bin sed sed local echo grep
+	| $(pwd) | grep printf 'quoted text' done sed --verbose x=1 sed
+	printf | | 'quoted text' "$1"
+		x=1 | -eu done cd sed ${HOME} awk echo ${HOME} $(pwd) echo
+--verbose test sed echo $(pwd) && readonly
+	readonly 'quoted text' 2>/dev/null /usr/bin local "$1" | cd local
+		cd ${HOME} cd x=1 ${HOME} awk echo "$@" && "$1" --verbose --verbose
+	then "$@" grep 'quoted text' x=1 done $(pwd) then && ${HOME} grep 2>/dev/null then
+		| | printf /usr/bin then && && --verbose
+	x=1 grep $(pwd) printf /usr/bin cd grep then printf 2>/dev/null x=1 local
+done --verbose $(pwd) | sed 'quoted text'
+		"$1" "$@" printf cd printf then readonly
+	readonly echo done local grep readonly
+	"$@" $(pwd) "$1" 'quoted text' awk
+		| ${HOME} ${HOME} --verbose x=1 /usr/bin && awk "$@" echo "$1" grep done grep
+x=1 export sed "$@" grep && | cd readonly --verbose
+		| done 'quoted text' printf
+	/usr/bin "$@" 'quoted text' sed sed 'quoted text'
+		done test $(pwd) done readonly /usr/bin then ${HOME}
+| readonly | cd 2>/dev/null 'quoted text'
+		"$@" | x=1 printf cd
+2>/dev/null readonly --verbose cd 'quoted text'
+	| test | awk readonly sed then echo sed 'quoted text'
+		awk awk cd cd /usr/bin then printf
+	grep done grep then export | x=1 local export x=1
+	"$@" x=1 --verbose test local export "$@" "$1"
+	test --verbose ${HOME} 2>/dev/null && cd 'quoted text'
+	$(pwd) then sed ${HOME} /usr/bin | "$@" 'quoted text' "$@" "$@"
+		'quoted text' --verbose -eu x=1 "$@" readonly cd "$1" cd readonly 'quoted text'
+		2>/dev/null local export --verbose local readonly "$@" "$1"
+	local export awk ${HOME} cd readonly /usr/bin 2>/dev/null sed cd done x=1 'quoted text'
+		awk local echo local ${HOME}
+done && export sed x=1 && x=1
+"$1" grep ${HOME} cd "$1" && --verbose
+		/usr/bin cd awk -eu "$@" test grep && "$1"
+grep x=1 --verbose echo printf printf test printf
+		done test echo then then -eu && $(pwd) "$1" sed "$1"
+		then -eu sed x=1 readonly printf
+	x=1 ${HOME} "$1" export echo cd then
+	readonly printf readonly then | --verbose
+'quoted text' --verbose then grep | --verbose printf export x=1 local export
+	echo ${HOME} ${HOME} then 'quoted text' readonly printf export
+test && grep | x=1 printf && cd readonly printf
+		local -eu "$1" && export ${HOME}
+	grep x=1 "$@" done grep done 'quoted text'
+echo cd x=1 && 2>/dev/null
+		then /usr/bin done "$1" ${HOME} echo ${HOME} "$@" echo /usr/bin -eu export
+2>/dev/null printf "$@" "$@"
+	awk printf x=1 sed "$@" 'quoted text' echo local printf sed $(pwd) /usr/bin
+	&& test | cd -eu awk printf | "$1" "$@"
+export "$@" echo "$1" then --verbose | "$@" done cd $(pwd) awk 2>/dev/null
+		then readonly sed x=1 then
+	"$1" readonly "$1" $(pwd) /usr/bin local sed cd --verbose | grep test 'quoted text'
+export grep then then printf
+	&& && printf ${HOME} x=1
+		| ${HOME} grep local echo cd export
+	x=1 | && -eu && test && $(pwd) ${HOME} -eu $(pwd) -eu /usr/bin ${HOME}
+	--verbose sed -eu x=1 grep 2>/dev/null done
+		cd test x=1 ${HOME} "$@" $(pwd) export "$@" 2>/dev/null local then --verbose "$@"
+	&& echo then export 'quoted text' done && then --verbose then | sed awk echo $(pwd)
+	--verbose sed "$@" "$1" local
+		$(pwd) local -eu sed &&
+	| awk "$1" /usr/bin cd ${HOME} "$1" 2>/dev/null printf "$1" printf
+		--verbose 'quoted text' $(pwd) ${HOME} 'quoted text' 2>/dev/null
+readonly then && printf printf echo grep test x=1 x=1 x=1 2>/dev/null
+		test "$@" -eu ${HOME} x=1 readonly -eu ${HOME} grep "$@"
+/usr/bin awk 'quoted text' export
+/usr/bin then -eu -eu echo export grep /usr/bin "$@" x=1 'quoted text' "$@" --verbose
+		'quoted text' --verbose export sed local
+cd | awk grep --verbose
+		&& "$@" | test cd grep 2>/dev/null "$1" "$@" local done test export test /usr/bin
+		--verbose -eu -eu echo | 'quoted text' x=1 2>/dev/null cd then printf sed ${HOME}
+-eu readonly done readonly export
+	printf sed | $(pwd) /usr/bin
+		readonly done "$@" $(pwd)
+		x=1 $(pwd) then echo | awk awk
+&& sed echo then "$@" test sed && | printf /usr/bin local $(pwd)
+	2>/dev/null 'quoted text' echo x=1 | 2>/dev/null
+export && /usr/bin | awk && -eu then readonly "$1" awk && "$@" cd awk printf
+test 'quoted text' ${HOME} ${HOME} test printf ${HOME} 'quoted text'
+${HOME} x=1 && awk done test awk export
+grep readonly printf && local | x=1
+readonly grep --verbose | awk printf "$@" local
+	sed awk grep -eu && then sed ${HOME} cd then 2>/dev/null
+	test "$1" readonly -eu readonly local x=1 /usr/bin 'quoted text'
+	x=1 "$1" && sed && export printf grep grep
+then echo grep "$@" --verbose $(pwd) -eu | &&
+awk "$1" -eu -eu -eu "$1" ${HOME} x=1 --verbose echo done export cd /usr/bin
+		then $(pwd) $(pwd) printf
+	then 2>/dev/null awk ${HOME} && /usr/bin cd readonly
+	sed --verbose local sed export && 'quoted text' $(pwd) -eu $(pwd) printf
+grep echo done -eu sed echo /usr/bin
+	echo echo --verbose echo cd sed $(pwd) 2>/dev/null then done done sed cd -eu
+sed readonly cd then then | 2>/dev/null sed "$@" local test awk printf
+	$(pwd) | grep 'quoted text' then $(pwd) /usr/bin && grep local --verbose local
+readonly ${HOME} --verbose $(pwd) printf
+		&& 2>/dev/null 'quoted text' test export
+test && echo then export ${HOME} x=1 /usr/bin printf
+		--verbose /usr/bin local cd "$1" printf then ${HOME} done --verbose | | "$1"
+	'quoted text' 'quoted text' test --verbose ${HOME} ${HOME}
+		then ${HOME} ${HOME} x=1 then sed | awk done 'quoted text' awk then then grep
+	sed | then ${HOME} sed -eu /usr/bin "$@"
+printf 'quoted text' | then awk --verbose awk readonly then $(pwd)
+local 2>/dev/null "$1" $(pwd) | 2>/dev/null
+		${HOME} local readonly done "$1" | awk then
+export printf -eu && | echo local local --verbose export /usr/bin readonly
+$(pwd) ${HOME} awk done -eu cd sed 'quoted text' export | "$@" 2>/dev/null
+&& export printf sed
+	awk sed test echo --verbose ${HOME} 'quoted text' ${HOME} /usr/bin
+		&& sed "$1" grep echo x=1 export
+'quoted text' then done
+then "$1" export "$1" --verbose printf export
+		-eu -eu --verbose sed cd --verbose
+		| sed then echo ${HOME} "$1" grep sed sed done readonly test
+		cd ${HOME} -eu printf awk local readonly printf 2>/dev/null readonly printf
+	| /usr/bin --verbose "$@" | 2>/dev/null export -eu cd "$1" done echo printf 2>/dev/null
+'quoted text' | cd --verbose readonly
+${HOME} | -eu "$@" awk local sed readonly grep
+	"$1" local ${HOME} awk $(pwd)
+		x=1 then ${HOME} x=1 'quoted text' "$1" -eu readonly then awk "$@"
+echo printf cd x=1 2>/dev/null "$@" export 'quoted text' grep 2>/dev/null readonly
+		echo awk done $(pwd) local then awk "$1" 'quoted text' echo && &&
+	&& then 'quoted text' --verbose "$1" 'quoted text' printf "$@"
+	-eu readonly /usr/bin ${HOME} "$@" 2>/dev/null 'quoted text'
+	"$1" "$1" echo x=1 x=1 x=1 x=1 -eu sed --verbose $(pwd) cd && awk then -eu
+		x=1 then sed test awk x=1 local printf local
+		done readonly printf local then | then
+		then 'quoted text' /usr/bin 2>/dev/null 'quoted text' |
+awk --verbose export 'quoted text' "$1" awk && $(pwd) ${HOME} then --verbose
+"$@" awk cd export && && sed cd 'quoted text' ${HOME} ${HOME} echo
+		/usr/bin awk ${HOME} sed
+${HOME} local "$1" "$@" export /usr/bin
+	test readonly 'quoted text' "$1" 2>/dev/null "$@" 2>/dev/null "$@" $(pwd)
+	done then sed then | awk done $(pwd) cd && cd
+test done test cd /usr/bin then /usr/bin
+	"$1" $(pwd) printf cd then export then $(pwd) export local
+echo ${HOME} awk /usr/bin
+"$1" echo -eu -eu cd x=1 -eu ${HOME} "$@" -eu readonly
+	then "$@" local "$@" cd | $(pwd) && 2>/dev/null readonly x=1 test local 'quoted text'
+		local sed awk readonly ${HOME} $(pwd) ${HOME}
+		grep 2>/dev/null cd export sed "$@" 2>/dev/null done awk cd echo x=1
+	2>/dev/null done ${HOME}
+readonly 'quoted text'
+printf 'quoted text' && && echo /usr/bin ${HOME} -eu "$1"
+	awk --verbose cd x=1 test grep "$1"
+	awk grep ${HOME} awk awk echo then x=1 cd cd | readonly
+	printf 'quoted text' ${HOME} 'quoted text' awk | export
+	readonly x=1 2>/dev/null $(pwd) 2>/dev/null sed then 'quoted text'
+	"$1" && 2>/dev/null $(pwd) test
+		echo 2>/dev/null x=1 local
+printf "$@" 'quoted text' /usr/bin "$1" readonly local "$1" | export readonly
+"$@" cd awk ${HOME} --verbose
+		printf echo then && /usr/bin |
+		x=1 "$1" "$@" sed readonly $(pwd) && -eu export done awk then done
+		then done then local cd grep /usr/bin export
+		then awk --verbose 2>/dev/null 'quoted text' ${HOME}
+		--verbose printf "$@" "$@" 2>/dev/null
+/usr/bin cd done cd "$@" test readonly readonly ${HOME} done local test echo
+		"$1" && then printf local && --verbose cd sed readonly export
+/usr/bin /usr/bin ${HOME} ${HOME}
+		test && --verbose 2>/dev/null printf cd --verbose --verbose "$@" local
+then done grep readonly local /usr/bin
+		local $(pwd) printf export awk
+cd readonly "$@" && ${HOME} 'quoted text' 2>/dev/null 2>/dev/null
+		${HOME} ${HOME} "$@" && $(pwd)
+	done 2>/dev/null x=1 done test 2>/dev/null then local "$1" done
+then then -eu test "$1" done export $(pwd) printf
+	x=1 2>/dev/null /usr/bin local
+export cd export | "$@" cd grep sed ${HOME} grep printf -eu -eu
+		| printf grep "$@" -eu
+	sed sed echo | 'quoted text'
+	then --verbose printf cd /usr/bin
+		--verbose export && -eu test readonly local $(pwd) readonly ${HOME}
+awk x=1 $(pwd) --verbose | done
+	printf echo "$1" | 'quoted text'
+	echo 'quoted text' -eu echo 'quoted text' $(pwd) echo sed -eu
+&& 'quoted text' $(pwd) export "$1" "$@" local
+test awk local grep sed $(pwd) export
+	2>/dev/null $(pwd) awk awk echo x=1 $(pwd) x=1 echo readonly
+		echo awk "$@" local sed
+2>/dev/null readonly && x=1 test --verbose && ${HOME} "$1" | --verbose $(pwd)
+		$(pwd) grep 'quoted text' | readonly test /usr/bin x=1 local cd export $(pwd)
+	awk test cd --verbose awk --verbose done $(pwd) | printf /usr/bin grep cd 'quoted text'
+		then echo echo local --verbose export cd echo
+cd local 'quoted text' printf
+${HOME} && x=1 then "$1" 2>/dev/null
+		-eu sed then && --verbose
+		export then cd test awk ${HOME} export local awk sed && local then
+	/usr/bin echo readonly
+	then printf awk done 'quoted text'
+"$1" --verbose $(pwd) ${HOME} 'quoted text'
+		readonly then | printf ${HOME} local local $(pwd) echo echo ${HOME} cd
+	sed readonly grep export done then ${HOME} local cd grep 2>/dev/null
+		echo then awk "$1" $(pwd) "$1" --verbose -eu cd
+"$1" $(pwd) echo /usr/bin $(pwd)
+	| cd then echo "$@" then -eu $(pwd) ${HOME} done ${HOME}
+x=1 x=1 2>/dev/null "$1" /usr/bin "$@" test local echo && $(pwd) done
+	grep done /usr/bin echo done printf 2>/dev/null 'quoted text'
+	local done done printf test | ${HOME} --verbose ${HOME} -eu export done
+cd awk grep 'quoted text' cd readonly 2>/dev/null 2>/dev/null
+	&& export ${HOME} -eu && echo awk
+then local $(pwd) | cd 2>/dev/null
+		--verbose then local | grep cd sed 'quoted text'
+echo -eu then && grep -eu local x=1 ${HOME} test export
+	printf | ${HOME} done 2>/dev/null
+	-eu "$1" 2>/dev/null -eu test 2>/dev/null done export echo readonly grep
+		"$@" done && ${HOME} "$1" && echo && --verbose
+	'quoted text' printf "$1"
+	&& && test awk then 2>/dev/null $(pwd) 'quoted text' export local "$@" done
+	export readonly cd export test done awk && export then --verbose echo "$1" cd echo
+	'quoted text' echo local "$1" readonly sed grep test then cd
+		${HOME} "$1" "$1" then
+	printf x=1 $(pwd) export grep $(pwd) echo -eu test 'quoted text' export --verbose
+	echo "$@" ${HOME} $(pwd) 'quoted text' local cd
+/usr/bin /usr/bin ${HOME}
+	sed | sed 'quoted text' then -eu echo
+		done export "$@" "$1" 2>/dev/null ${HOME}
+	sed ${HOME} done export awk test
+/usr/bin grep export /usr/bin done local then then
+		echo echo local /usr/bin $(pwd) then sed /usr/bin
+-eu local -eu awk 'quoted text' printf echo sed done x=1 cd echo | "$@"
+test test readonly test echo local x=1 "$1" sed ${HOME}
+sed test "$@" "$1" -eu --verbose echo
+	echo /usr/bin --verbose "$1" then $(pwd) echo then "$1"
+	&& done test then test readonly | export awk sed printf export 'quoted text'
+	grep local $(pwd) grep $(pwd) && && export -eu "$1" /usr/bin
+done x=1 cd && readonly
+"$@" "$1" x=1 test done -eu readonly -eu 'quoted text'
+done readonly -eu "$1" 2>/dev/null "$1" cd echo | done
+		| awk awk printf awk done x=1
+${HOME} 2>/dev/null --verbose sed then
+${HOME} $(pwd) -eu 'quoted text'
+x=1 $(pwd) export done 2>/dev/null echo grep test
+/usr/bin cd 'quoted text' 2>/dev/null
+		&& sed "$1" --verbose "$@" && test /usr/bin readonly | echo awk readonly
+		"$1" local echo "$1" readonly
+| x=1 /usr/bin test ${HOME} "$1" awk export -eu /usr/bin readonly test export
+		awk -eu -eu $(pwd) grep done done
+		| | | 2>/dev/null then ${HOME} /usr/bin then 'quoted text' 'quoted text'
+	printf /usr/bin 'quoted text' && test 2>/dev/null
+		x=1 local cd export export grep ${HOME} /usr/bin
+		printf awk test x=1 ${HOME} x=1
+		test $(pwd) grep export then awk awk -eu local grep echo cd test --verbose
+	$(pwd) grep 'quoted text' "$@" grep readonly $(pwd)
+		"$1" cd -eu test "$@" "$1" test sed grep -eu --verbose && then --verbose
+x=1 echo x=1 sed done echo grep $(pwd) then echo x=1 $(pwd) readonly
+		echo 'quoted text' grep "$1" cd export
+	$(pwd) -eu readonly cd "$@" cd 2>/dev/null "$1" /usr/bin
+$(pwd) ${HOME} awk -eu "$1" $(pwd) export local 'quoted text'
+then "$1" 2>/dev/null "$@" grep -eu printf sed readonly echo "$1" awk $(pwd)
+test -eu 2>/dev/null local cd x=1 && done /usr/bin
+	&& then cd awk x=1 2>/dev/null "$@" | x=1 done 2>/dev/null
+		export && grep cd cd awk
+printf x=1 awk 'quoted text' awk done readonly readonly
+2>/dev/null && readonly | --verbose local /usr/bin
+	export && $(pwd) $(pwd) readonly 'quoted text' --verbose
+test ${HOME} cd cd then local -eu x=1 /usr/bin x=1 | 2>/dev/null
+		'quoted text' /usr/bin test cd -eu printf grep "$@"
+		/usr/bin done && done export readonly /usr/bin
+awk ${HOME} sed then "$1" test | sed /usr/bin
+		cd then readonly echo readonly test test test
+2>/dev/null "$1" 2>/dev/null printf
+		--verbose sed "$1" 2>/dev/null 'quoted text' export "$@" 'quoted text'
+		--verbose readonly then 'quoted text' "$1" export done
+echo printf cd export done cd 'quoted text' "$1" ${HOME}
+--verbose cd echo test export
+-eu | ${HOME} 'quoted text' "$1" done -eu /usr/bin "$1" ${HOME} -eu then done echo
+2>/dev/null readonly grep cd /usr/bin
+local -eu then test test --verbose $(pwd) /usr/bin $(pwd) local
+then "$1" export && export
+		local --verbose ${HOME} $(pwd) awk
+	"$@" printf readonly -eu "$1" awk export done
+		cd "$@" x=1 'quoted text' test sed
+	cd 2>/dev/null ${HOME} /usr/bin ${HOME} sed $(pwd) 'quoted text' && readonly
+	test test cd test ${HOME} local awk "$1" /usr/bin && echo export x=1 /usr/bin
+		&& && echo --verbose x=1 grep 'quoted text' readonly $(pwd) x=1
+	2>/dev/null cd test cd awk "$@" x=1
+	awk grep echo && x=1 readonly echo && readonly $(pwd) cd printf sed
+echo "$@" $(pwd) /usr/bin "$@" "$@" | export "$@" $(pwd) $(pwd)
+grep readonly test --verbose local $(pwd)
+$(pwd) awk && "$1" x=1 sed
+awk printf readonly export cd awk $(pwd)
+	readonly "$1" -eu sed x=1 done "$1" x=1 readonly done && test "$1" awk
+	/usr/bin printf -eu sed /usr/bin printf x=1 done local export echo printf
+	&& grep 2>/dev/null then --verbose awk test sed
+	sed | sed export test sed /usr/bin
+	readonly export /usr/bin "$@" "$@" -eu "$1" "$1" 2>/dev/null
+"$@" 'quoted text' "$@" 'quoted text'
+		| x=1 sed --verbose cd "$@" then cd readonly 'quoted text' -eu ${HOME} x=1 echo
+	"$@" && ${HOME} awk /usr/bin 'quoted text' readonly
+	local /usr/bin cd && sed sed sed "$1" sed readonly
+--verbose 2>/dev/null sed ${HOME} test ${HOME}
+		done 'quoted text' then awk -eu sed | readonly ${HOME} cd -eu
+	printf awk then | -eu $(pwd) /usr/bin readonly test
+		local "$@" | 2>/dev/null
+	"$@" cd printf grep && echo export
+	export && export $(pwd) "$1" export awk "$1" sed
+then local sed | printf readonly printf | test
+'quoted text' "$@" then grep local test 2>/dev/null
+printf export "$1" 2>/dev/null export "$1"
+		${HOME} x=1 awk grep sed ${HOME} 2>/dev/null done readonly /usr/bin | cd
+	| then echo echo local sed "$1" "$1" echo echo --verbose readonly
+	test 2>/dev/null echo ${HOME} export && export sed then -eu
+	then 2>/dev/null 2>/dev/null "$1"
+	local "$@" ${HOME} -eu readonly cd "$1"
+		done $(pwd) /usr/bin local readonly "$1" /usr/bin
+		--verbose "$@" /usr/bin | sed --verbose sed cd
+	--verbose readonly "$@" 2>/dev/null
+"$1" export | then --verbose /usr/bin
+then "$1" "$1" x=1 readonly x=1
+		/usr/bin && then done --verbose test "$1" ${HOME}
+		'quoted text' 'quoted text' "$@" "$1" | x=1 printf /usr/bin x=1
+		grep | x=1 x=1 2>/dev/null export readonly awk 'quoted text'
+		then | then cd --verbose export ${HOME} 'quoted text' done $(pwd) x=1 ${HOME} readonly
+	'quoted text' "$1" -eu $(pwd)
+		-eu $(pwd) -eu printf awk
+&& awk ${HOME} local "$1" then sed sed && $(pwd) 'quoted text' done /usr/bin
+	echo cd cd $(pwd) -eu
+readonly -eu local "$@" awk printf -eu 'quoted text' done awk x=1 "$1"
+	x=1 $(pwd) | $(pwd) awk readonly
+		"$@" export 'quoted text' /usr/bin local local
+		awk awk test local local | then grep "$@" cd printf /usr/bin
+	export cd cd printf --verbose 2>/dev/null cd grep export 2>/dev/null
+done export && printf cd "$@" $(pwd) 'quoted text' local && "$@" | local
+	test --verbose sed "$@" sed 2>/dev/null "$@" export | grep | cd
+	$(pwd) cd 'quoted text' grep
+readonly $(pwd) test local sed then 2>/dev/null cd readonly grep
+"$1" $(pwd) "$1" "$@" ${HOME} sed --verbose
+printf "$@" ${HOME} --verbose
+--verbose test readonly printf "$@" cd awk 'quoted text' "$@" | && x=1 export "$1"
+"$1" -eu local 'quoted text' "$@" "$@" /usr/bin
+	then cd | ${HOME} 'quoted text' export sed done export
+	test test 2>/dev/null cd && 2>/dev/null | echo done &&
+done -eu $(pwd) printf export local $(pwd) local
+'quoted text' done export sed "$@" then
+	"$1" "$@" ${HOME} cd grep test $(pwd) done cd "$@" cd 2>/dev/null
+	grep x=1 2>/dev/null | -eu 2>/dev/null
+--verbose x=1 sed printf
+	-eu awk x=1 local then $(pwd) x=1 readonly printf awk
+test grep sed test && --verbose --verbose --verbose grep $(pwd) awk printf --verbose
+		then echo grep export && export 2>/dev/null readonly done 2>/dev/null "$1"
+	grep $(pwd) "$@" export echo --verbose export then cd "$1" x=1 | awk local 2>/dev/null
+then test "$@" test then | local | printf local $(pwd) echo "$1"
+awk export && | done -eu grep "$1" ${HOME} $(pwd)
+		'quoted text' && cd export export cd | -eu 2>/dev/null
+		sed --verbose awk done done $(pwd) --verbose
+awk test done awk cd -eu | /usr/bin local readonly local
+		grep 2>/dev/null /usr/bin printf echo done test | local
+	-eu "$1" -eu test printf echo
+		awk echo && local /usr/bin test |
+sed | printf /usr/bin then cd awk "$@" $(pwd) 'quoted text' 2>/dev/null
+"$1" then | sed done -eu | 2>/dev/null readonly done 'quoted text' ${HOME}
+local test 'quoted text' /usr/bin test done awk | printf export | "$@" |
+		printf -eu readonly readonly cd sed grep "$1" echo 2>/dev/null then awk awk -eu
+&& x=1 x=1 printf done ${HOME} | printf -eu cd sed --verbose grep export
+		$(pwd) done grep grep | "$@" x=1 "$@" && "$@"
+${HOME} local "$@" printf | -eu 'quoted text'
+	x=1 | 'quoted text' done "$1" | ${HOME} /usr/bin
+printf cd 2>/dev/null -eu | "$1" 2>/dev/null "$1" readonly readonly then printf
+	2>/dev/null export x=1 -eu done then "$1" 'quoted text' | local export
+	-eu cd export 2>/dev/null -eu
+		"$1" sed ${HOME} | ${HOME} 2>/dev/null
+/usr/bin && printf --verbose echo /usr/bin ${HOME} printf /usr/bin -eu
+printf readonly cd "$@" $(pwd) "$@" | cd export grep $(pwd) test x=1 /usr/bin export
+	cd export --verbose $(pwd) x=1 awk 'quoted text'
+sed local then -eu readonly printf -eu && && awk "$@" "$1"
+export 'quoted text' $(pwd) | readonly 'quoted text' "$@"
+readonly export printf then local 2>/dev/null | grep sed 2>/dev/null
+	2>/dev/null ${HOME} readonly && local test awk --verbose sed x=1 local
+		$(pwd) "$@" export && then sed 2>/dev/null
+	then "$1" sed /usr/bin
+	2>/dev/null done export
+		| $(pwd) && then && awk readonly local cd done x=1 grep export | "$1" test
+	awk && sed "$1" readonly "$1" export then "$1" awk test /usr/bin x=1 export -eu
+	done readonly -eu printf 2>/dev/null -eu printf | x=1 --verbose 'quoted text'
+		sed echo local test 2>/dev/null -eu grep echo awk ${HOME} awk sed
+	"$@" 2>/dev/null 2>/dev/null then | echo 2>/dev/null test grep ${HOME} awk test
+	"$1" "$@" echo echo cd x=1 printf
+		done echo x=1 2>/dev/null sed x=1 2>/dev/null
+/usr/bin echo then cd | 2>/dev/null
+local local then "$1" then -eu test awk cd $(pwd) --verbose
+		local $(pwd) $(pwd) "$@" export
+done readonly awk ${HOME}
+	$(pwd) grep /usr/bin 2>/dev/null
+		readonly -eu awk cd $(pwd) awk local
+		readonly --verbose && x=1 readonly
+		2>/dev/null test readonly /usr/bin
+		echo 2>/dev/null readonly --verbose grep printf
+		/usr/bin 'quoted text' grep done
+		export "$@" | printf 2>/dev/null | -eu awk test 'quoted text' $(pwd) "$1" x=1
+		awk export sed test awk done x=1 done && -eu $(pwd) echo
+awk sed local -eu $(pwd) "$1" printf cd -eu "$1" 2>/dev/null
+	${HOME} test "$@" /usr/bin /usr/bin printf
+		then test && awk done local "$@" sed x=1
+	export echo cd $(pwd) -eu && ${HOME}
+		grep ${HOME} | export | 'quoted text' /usr/bin "$1" && echo
+printf then sed && -eu
+		echo done awk awk && 'quoted text'
+	echo export && then --verbose then -eu grep
+		&& 'quoted text' $(pwd) cd awk echo 'quoted text' sed | "$@" /usr/bin $(pwd)
+		${HOME} printf x=1 awk readonly /usr/bin "$@" $(pwd) export echo
+	then sed readonly cd then cd then /usr/bin test awk "$@" --verbose "$1" $(pwd)
+		echo x=1 'quoted text' 2>/dev/null readonly local local export
+grep then "$@" ${HOME} --verbose
+		x=1 --verbose echo local then x=1 local
+--verbose --verbose /usr/bin "$1" printf cd "$@" local 'quoted text'
+		'quoted text' done sed echo "$@" done echo $(pwd) grep "$@" ${HOME}
+		${HOME} 2>/dev/null echo local then local printf 2>/dev/null
+	grep cd sed "$1" then 'quoted text' x=1
+	then cd -eu /usr/bin | grep 2>/dev/null
+		x=1 -eu 'quoted text' "$1" | awk test /usr/bin ${HOME} echo
+		local -eu "$@" then awk && done then then x=1 grep 2>/dev/null
+	readonly done local && "$@" "$1"
+echo | && x=1 local export readonly local
+	export readonly test ${HOME}
+	$(pwd) then --verbose -eu "$@" then && readonly -eu -eu grep readonly
+	sed x=1 "$@" "$1" then then export cd printf ${HOME} ${HOME} --verbose
+	local | echo | grep awk sed then printf test printf local echo | && grep then
+export && local readonly x=1 | -eu $(pwd) ${HOME} grep test "$1" ${HOME}
+/usr/bin then then $(pwd) --verbose /usr/bin --verbose -eu | grep cd export 'quoted text'
+test "$1" x=1 -eu | done done | 'quoted text' && sed readonly x=1
+		'quoted text' 'quoted text' 'quoted text'
+		done grep x=1 export done readonly --verbose /usr/bin done local --verbose "$@"
+	x=1 ${HOME} then "$@" awk "$@" printf --verbose local then cd echo export
+	awk printf readonly cd test sed done grep echo printf x=1 -eu local "$@" local
+	echo readonly x=1 then grep local readonly 'quoted text' &&
+	printf "$@" -eu 2>/dev/null export $(pwd)
+	/usr/bin && /usr/bin |
+		| done readonly 2>/dev/null
+		&& "$1" -eu $(pwd) | ${HOME} --verbose
+		2>/dev/null printf 'quoted text'
+cd cd ${HOME} done test grep 2>/dev/null printf /usr/bin 'quoted text'
+		printf ${HOME} test echo --verbose
+		printf x=1 local --verbose $(pwd) local cd "$@" test local | x=1 export export &&
+		local "$@" $(pwd) readonly -eu | && x=1 -eu printf echo "$@" ${HOME} "$@"
+	awk x=1 echo && awk awk --verbose export /usr/bin ${HOME} readonly ${HOME} --verbose
+	/usr/bin done then done 'quoted text' awk awk done cd
+	done -eu "$@" 2>/dev/null && "$@" then 2>/dev/null awk 'quoted text'
+	--verbose 'quoted text' --verbose "$@" ${HOME} readonly 2>/dev/null export
+	cd x=1 && x=1 sed --verbose local 'quoted text' done then | printf
+		"$1" && done --verbose | echo test /usr/bin && grep export | x=1 local
+	&& "$1" x=1 $(pwd) x=1 readonly export --verbose local --verbose x=1 2>/dev/null
+'quoted text' "$1" printf -eu /usr/bin local | awk readonly awk -eu -eu x=1
+/usr/bin export "$@" awk then printf printf x=1 ${HOME} --verbose
+	-eu awk printf sed -eu cd $(pwd) sed awk && | x=1 "$1" local local x=1
+		readonly echo "$1" local then readonly ${HOME}
+	| $(pwd) | 'quoted text' sed echo grep $(pwd) readonly "$1" && x=1 readonly then
+${HOME} test ${HOME} test grep "$@" sed $(pwd) echo local local
+--verbose awk local awk then awk export sed echo "$1" /usr/bin
+	then then awk sed /usr/bin printf echo
+export "$@" && /usr/bin "$1" "$1" ${HOME} | sed
+	/usr/bin awk local /usr/bin /usr/bin awk -eu | $(pwd) cd local 2>/dev/null sed "$1"
+	--verbose && --verbose ${HOME} test cd
+		printf ${HOME} printf
+"$@" --verbose awk readonly export awk done cd cd /usr/bin && 2>/dev/null
+cd then $(pwd) 'quoted text' /usr/bin printf $(pwd) done | sed --verbose done
+awk x=1 "$@" readonly export && x=1 then -eu "$1" $(pwd) /usr/bin -eu echo
+		echo /usr/bin done test x=1 test sed 'quoted text'
+		$(pwd) test printf export export -eu test then x=1 readonly /usr/bin /usr/bin $(pwd)
+then | sed "$@" export test awk awk x=1 test done
+	then sed cd ${HOME} "$1" printf "$1" "$@" then x=1 grep readonly 'quoted text'
+cd | && x=1 export -eu 'quoted text' x=1 done | done local sed /usr/bin
+done cd echo ${HOME} export awk awk local readonly /usr/bin cd 'quoted text'
+		/usr/bin sed 'quoted text' readonly local
+-eu && ${HOME} -eu --verbose readonly echo test ${HOME} awk x=1
+	readonly "$@" --verbose /usr/bin readonly
+test printf x=1 $(pwd) echo awk 'quoted text' test --verbose /usr/bin 2>/dev/null
+local "$1" then 'quoted text' awk
+		local local cd x=1 "$1" echo readonly
+| grep cd | "$1" | export |
+	local printf "$@" "$1" done printf test
+		cd $(pwd) /usr/bin "$1" sed grep --verbose test test -eu "$@" awk then echo readonly
+	cd sed printf readonly
+| then done export local sed "$1"
+		'quoted text' export then sed export
+	&& $(pwd) sed 2>/dev/null done "$1" $(pwd) local 2>/dev/null cd $(pwd)
+$(pwd) echo test readonly done done export $(pwd) echo done x=1 ${HOME}
+	awk test 2>/dev/null 'quoted text' ${HOME} export sed awk readonly
+echo "$1" echo | /usr/bin 'quoted text'
+	/usr/bin ${HOME} printf grep "$@" /usr/bin $(pwd) then readonly cd cd grep
+x=1 "$1" "$1" grep sed export echo export printf local | sed
+		"$@" 2>/dev/null ${HOME} grep printf done /usr/bin 'quoted text' && --verbose
+		echo readonly && then test awk x=1 cd grep printf $(pwd)
+		&& test printf "$@" grep -eu | echo
+		local local echo | "$@" x=1 then done test && | ${HOME}
+	export test | export cd then awk printf done local
+		-eu -eu printf "$1" && "$1" | test 'quoted text'
+echo awk | -eu x=1 local 'quoted text' sed echo export "$@" $(pwd) --verbose
+done sed "$1" $(pwd) cd readonly cd | grep
+		"$1" 'quoted text' export "$@" printf
+	"$@" | /usr/bin -eu | awk sed ${HOME} /usr/bin
+		sed --verbose && awk done grep $(pwd)
+		then ${HOME} /usr/bin ${HOME}
+		"$1" "$@" x=1 sed test done --verbose ${HOME} echo --verbose awk 2>/dev/null
+cd test export "$@" test cd 'quoted text' x=1 local awk done "$1" "$@" &&
+&& /usr/bin readonly cd x=1 then readonly --verbose awk 2>/dev/null sed
+		"$@" ${HOME} | test echo -eu local "$1"
+		/usr/bin awk local --verbose "$1" "$@" 2>/dev/null
+		2>/dev/null test test printf "$@" local --verbose 'quoted text' /usr/bin
+		"$1" readonly x=1 then then && echo local
+&& && sed | ${HOME} x=1 sed | 2>/dev/null && 2>/dev/null
+	&& test readonly test
+		--verbose $(pwd) done sed readonly 2>/dev/null grep sed && done then
+test ${HOME} "$1" $(pwd) printf
+		/usr/bin local then local
+	"$1" test test "$1" --verbose then &&
+$(pwd) awk test 2>/dev/null "$1" test ${HOME} readonly 'quoted text' "$@" done
+	2>/dev/null awk printf x=1
+	echo grep --verbose "$@" 'quoted text' sed then
+	&& && grep "$1" grep "$1" "$@" ${HOME}
+${HOME} printf && awk awk && done printf grep "$@" /usr/bin sed export
+	x=1 ${HOME} "$@" test sed "$1"
+	-eu readonly 'quoted text' grep sed /usr/bin ${HOME} printf -eu readonly cd
+	local -eu -eu | cd echo "$1" local echo cd "$1" --verbose
+		readonly ${HOME} $(pwd) 2>/dev/null then --verbose grep ${HOME} "$@" | --verbose
+	cd "$1" $(pwd) readonly test
+echo local ${HOME} readonly | 'quoted text' --verbose 2>/dev/null export
+	export 'quoted text' echo local awk 2>/dev/null
+		local 'quoted text' sed x=1 then /usr/bin sed /usr/bin
+	echo | --verbose /usr/bin /usr/bin cd "$1" export
+readonly then 'quoted text'
+	'quoted text' export done --verbose local readonly export then then $(pwd) "$1"
+awk /usr/bin grep x=1 'quoted text'
+		2>/dev/null 'quoted text' export
+		| readonly printf x=1 awk printf
+	cd 2>/dev/null 'quoted text' 'quoted text' /usr/bin
+sed echo printf && test export local printf readonly
+"$1" | cd ${HOME} done --verbose echo
+	$(pwd) readonly sed echo echo done "$@" --verbose 2>/dev/null 2>/dev/null "$1"
+		x=1 printf --verbose grep -eu $(pwd) | && /usr/bin
+	'quoted text' cd export then local x=1
+	awk cd local sed grep echo
+	done echo grep then printf 2>/dev/null test
+		x=1 done echo cd cd then done echo awk x=1 grep local "$@" 2>/dev/null ${HOME}
+${HOME} 2>/dev/null 2>/dev/null test "$@" readonly sed | grep export
+	sed /usr/bin done readonly grep "$1" 'quoted text' done x=1
+2>/dev/null grep && /usr/bin "$1" -eu then 2>/dev/null
+"$@" printf echo --verbose done && readonly --verbose -eu printf &&
+		done echo export ${HOME} done echo
+'quoted text' /usr/bin then
+	done | -eu readonly $(pwd) grep grep -eu | ${HOME}
+	local x=1 readonly --verbose && x=1 x=1 ${HOME}
+		/usr/bin then export sed "$1" | export
+		${HOME} echo export sed 'quoted text' ${HOME}
+	printf grep local 'quoted text' $(pwd)
+	${HOME} --verbose 2>/dev/null
+	x=1 then ${HOME} "$@" local local readonly x=1 export 2>/dev/null
+	x=1 test "$@" -eu $(pwd) done --verbose 'quoted text' readonly
+--verbose 'quoted text' && echo
+$(pwd) done readonly x=1 --verbose
+	echo awk then --verbose 2>/dev/null /usr/bin
+		echo export "$@" test sed "$1" && readonly sed sed -eu 2>/dev/null
+		/usr/bin printf cd export readonly then awk sed
+sed "$1" test readonly awk /usr/bin "$1" done awk
+	sed sed ${HOME} 2>/dev/null
+	sed awk then echo then "$@" grep 'quoted text' then -eu /usr/bin 'quoted text'
+export then test local grep sed awk /usr/bin then export
+printf $(pwd) sed then export local export
+		test 'quoted text' -eu x=1
+	'quoted text' --verbose && done done /usr/bin readonly sed
+awk done "$1" awk 'quoted text' "$@" /usr/bin printf awk
+		-eu | awk /usr/bin printf awk 2>/dev/null && test cd
+		$(pwd) 'quoted text' sed export sed done sed
+$(pwd) | --verbose local "$1" "$@" 2>/dev/null 2>/dev/null
+$(pwd) echo export printf test /usr/bin ${HOME} $(pwd) cd | done
+	"$1" test cd echo && printf "$@" -eu -eu 'quoted text' --verbose
+	done "$@" ${HOME} printf echo && | --verbose echo test && && awk "$1" printf
+	--verbose 2>/dev/null sed local $(pwd) awk --verbose "$@" x=1 'quoted text'
+	grep | "$@" done test cd grep $(pwd) /usr/bin export && 'quoted text' /usr/bin
+	then 2>/dev/null | echo cd printf "$1" /usr/bin awk "$1" sed printf
+		"$@" done then then readonly cd export readonly --verbose
+		&& 2>/dev/null && $(pwd) awk printf -eu awk x=1 local 2>/dev/null
+	$(pwd) local local /usr/bin
+	sed && readonly then test
+		$(pwd) test $(pwd) done export
+		grep --verbose ${HOME} then printf --verbose --verbose "$@"
+test done /usr/bin -eu "$@" 2>/dev/null && "$1" printf -eu readonly | then
+		cd 2>/dev/null local 'quoted text' grep sed "$@" cd --verbose then && $(pwd)
+		x=1 echo 'quoted text' 2>/dev/null "$1" x=1 $(pwd) $(pwd) cd --verbose
+	sed export printf -eu | "$@" local test --verbose --verbose "$@" cd done
+	sed -eu "$1" | awk 2>/dev/null
+	--verbose /usr/bin /usr/bin readonly sed "$1" then printf
+	printf printf test done cd printf sed echo
+	-eu ${HOME} readonly printf -eu 2>/dev/null
+x=1 test test then cd 'quoted text' echo
+| grep done echo "$@" | 2>/dev/null readonly
+	printf echo ${HOME} x=1 | x=1 && --verbose
+		/usr/bin | sed then x=1 done awk grep
+		2>/dev/null --verbose echo --verbose export -eu grep "$@" 2>/dev/null
+	sed echo then 2>/dev/null echo 'quoted text' echo "$1" sed test echo done
+		local | 2>/dev/null && done /usr/bin $(pwd) grep grep
+	export test x=1 readonly x=1 x=1 "$1" cd sed "$1" 'quoted text' | && export
+	test local "$1" 2>/dev/null test grep cd then
+	"$1" -eu done readonly -eu readonly $(pwd)
+	cd echo && echo /usr/bin echo && 'quoted text'
+		cd /usr/bin export /usr/bin test cd 'quoted text'
+	grep grep 'quoted text' readonly printf $(pwd) local
+		export local export done printf "$@" /usr/bin printf
+	| readonly sed cd echo "$@" readonly --verbose local awk
+	echo /usr/bin grep done grep printf "$1" 2>/dev/null echo sed
+		| awk echo printf /usr/bin $(pwd) cd 2>/dev/null readonly printf test $(pwd) echo
+sed ${HOME} x=1 cd grep export | echo awk | echo |
+'quoted text' echo done local ${HOME} export sed -eu 2>/dev/null
+	${HOME} 'quoted text' | cd export /usr/bin
+printf && 2>/dev/null done
+2>/dev/null 'quoted text' --verbose
+"$1" $(pwd) cd local printf awk x=1 "$@" awk 'quoted text' "$1" -eu
+		${HOME} test "$1" /usr/bin ${HOME}
+	cd test then "$@" sed local
+		awk ${HOME} $(pwd) -eu | "$1" test /usr/bin
+		2>/dev/null | && --verbose test local --verbose sed sed "$1" ${HOME} 2>/dev/null
+		-eu 'quoted text' -eu $(pwd) $(pwd) local printf
+		awk "$@" 2>/dev/null echo x=1 awk && echo done
+	printf export /usr/bin sed ${HOME}
+		export --verbose done done then ${HOME} export test --verbose
+		&& ${HOME} printf echo printf printf local sed cd awk awk
+		${HOME} 2>/dev/null /usr/bin
+	sed grep awk | printf readonly sed grep sed 'quoted text'
+		${HOME} then test awk echo
+printf "$1" 'quoted text' $(pwd) --verbose readonly | 'quoted text'
+	readonly test then /usr/bin then grep readonly local
+export "$@" awk readonly echo grep
+		2>/dev/null cd readonly | ${HOME}
+		| x=1 done "$@" grep awk -eu then 'quoted text'
+${HOME} printf echo "$@" | then -eu 2>/dev/null 2>/dev/null
+		sed "$@" cd cd local --verbose | x=1 -eu /usr/bin cd export ${HOME} readonly
+then --verbose ${HOME} then cd 2>/dev/null sed readonly awk --verbose "$1" x=1
+		'quoted text' /usr/bin /usr/bin test "$@" sed "$@" 2>/dev/null x=1
+	local awk "$@" --verbose echo echo
+--verbose "$1" export -eu then test | readonly test then done local awk
+		awk 2>/dev/null local cd && 'quoted text' && cd echo 'quoted text' "$1" 2>/dev/null
+		&& $(pwd) test x=1 then x=1 2>/dev/null
+	-eu && "$1" "$@" $(pwd) x=1 x=1 then -eu --verbose awk --verbose "$@"
+x=1 "$@" local local 2>/dev/null
+		"$1" done local "$1" | ${HOME} --verbose
+	| 'quoted text' echo local x=1 /usr/bin readonly local local
+	'quoted text' printf && done
+sed done done 'quoted text' sed 'quoted text' printf
+		then export "$1" grep "$1" local --verbose export readonly 'quoted text'
+"$1" readonly -eu export
+	cd local /usr/bin ${HOME} done 'quoted text' "$@" grep
+		&& 2>/dev/null && export cd grep printf awk grep x=1
+	${HOME} -eu ${HOME} then done printf /usr/bin cd ${HOME} awk "$1" echo
+	x=1 awk export awk grep local local echo
+	/usr/bin -eu then x=1 2>/dev/null echo cd $(pwd) done awk done readonly /usr/bin
+		awk "$@" 2>/dev/null cd && --verbose test grep "$1" awk "$1" cd grep printf
+x=1 grep readonly local 'quoted text' sed -eu readonly 2>/dev/null test 2>/dev/null
+		readonly ${HOME} grep
+		local sed cd grep "$1"
+		-eu 'quoted text' 'quoted text' | readonly printf 2>/dev/null
+	grep then x=1 local printf | then $(pwd) awk readonly then
+&& /usr/bin x=1 cd 'quoted text'
+		| echo 2>/dev/null | x=1 "$@"
+	printf cd export x=1 local "$@" then ${HOME}
+echo printf readonly awk then -eu -eu sed 2>/dev/null then done ${HOME} &&
+/usr/bin $(pwd) echo 2>/dev/null done /usr/bin && 2>/dev/null echo 'quoted text'
+	readonly echo then printf x=1 'quoted text' printf && $(pwd)
+	${HOME} 2>/dev/null then /usr/bin
+		printf | grep -eu then awk x=1 cd echo $(pwd)
+printf ${HOME} cd $(pwd) sed "$1"
+	/usr/bin "$1" /usr/bin | export ${HOME} | awk test | /usr/bin x=1 echo printf local
+	2>/dev/null x=1 | sed echo && echo readonly readonly 'quoted text' done
+		local done printf | then export grep test grep printf sed readonly then
+-eu grep | then awk | then awk 'quoted text' 2>/dev/null
+printf --verbose done echo --verbose
+	-eu export $(pwd) done cd | export
+--verbose readonly test /usr/bin printf ${HOME} awk echo grep
+		| sed && printf then --verbose "$@" then x=1 awk --verbose echo && &&
+		&& -eu -eu /usr/bin | x=1 "$@" "$@" grep /usr/bin export done then ${HOME}
+		sed sed --verbose test
+&& "$@" grep --verbose 'quoted text' "$1" cd x=1 x=1 "$@"
+	awk local /usr/bin sed
+	2>/dev/null echo printf "$@" $(pwd) sed 'quoted text'
+echo cd awk test "$@" /usr/bin echo 'quoted text' sed "$@" local
+readonly && sed done cd "$1" -eu awk 'quoted text'
+		"$1" done echo awk "$@" "$1" printf cd grep test then "$@" then x=1
+		export "$1" then --verbose 'quoted text' readonly | readonly
+		readonly | then x=1 sed --verbose | sed && /usr/bin && local local
+		test test "$@" ${HOME} | ${HOME} "$@" -eu x=1 ${HOME}
+done /usr/bin && 2>/dev/null /usr/bin && test ${HOME} test readonly && x=1
+	then local $(pwd) /usr/bin then done
+		-eu && 2>/dev/null x=1 grep
+--verbose grep $(pwd) 2>/dev/null $(pwd) echo printf /usr/bin done "$@" ${HOME}
+grep cd echo readonly printf
+cd readonly 'quoted text' && | echo && 'quoted text' export local local
+	then sed local test awk | "$@" --verbose readonly | then x=1 export readonly
+test awk then local 2>/dev/null printf $(pwd) "$1" grep local
+"$@" | x=1 cd echo /usr/bin | awk --verbose
+		--verbose local readonly awk then then
+| x=1 then sed | 2>/dev/null $(pwd) "$@" "$1" done $(pwd) $(pwd) /usr/bin &&
+		printf 'quoted text' printf
+2>/dev/null echo --verbose 'quoted text' local "$@" | ${HOME}
+	sed awk 2>/dev/null grep -eu /usr/bin 2>/dev/null --verbose readonly -eu done
+awk 2>/dev/null --verbose
+	"$@" awk export -eu x=1 sed $(pwd) | local x=1 cd 2>/dev/null
+	export done x=1 --verbose
+2>/dev/null && $(pwd) 'quoted text'
+	done "$@" -eu then cd -eu --verbose echo | readonly done
+		--verbose grep test -eu $(pwd)
+cd local done awk | done 'quoted text'
+x=1 --verbose then echo
+"$@" | test then 'quoted text' $(pwd) /usr/bin
+| awk done local cd cd | export export /usr/bin
+awk "$@" then x=1 export echo
+		echo echo cd x=1 grep | | 'quoted text' local test
+		-eu cd test "$1" --verbose
+	--verbose ${HOME} /usr/bin awk
+sed /usr/bin sed | x=1 readonly
+'quoted text' cd x=1 | awk awk --verbose awk
+	'quoted text' grep cd echo "$@" && done $(pwd) "$@" 'quoted text'
+	2>/dev/null grep x=1 test -eu 2>/dev/null /usr/bin
+	printf export cd x=1 -eu | $(pwd) done echo cd echo sed | readonly | $(pwd) test
+		--verbose export readonly test
+| printf done awk export export sed $(pwd) 2>/dev/null
+		"$1" /usr/bin export readonly
+		cd printf echo -eu local --verbose "$1" 2>/dev/null readonly done export /usr/bin
+then done -eu test 'quoted text' export sed printf -eu
+	"$1" --verbose -eu echo done grep -eu test --verbose printf
+	test 'quoted text' sed printf "$@" x=1 x=1 awk then 'quoted text'
+	local /usr/bin x=1 -eu 'quoted text' "$@" echo x=1 2>/dev/null
+	readonly local 'quoted text'
+sed | && x=1 -eu && grep 'quoted text' -eu readonly "$@" printf echo
+	x=1 "$@" done cd ${HOME} 'quoted text' --verbose
+then local && "$1" -eu echo printf -eu x=1 sed grep 'quoted text' echo
+export "$1" test echo printf "$1" done awk sed /usr/bin 'quoted text'
+	-eu "$@" | -eu echo grep test export
+	"$@" 'quoted text' sed cd | printf && -eu --verbose then readonly x=1
+	readonly --verbose test local done ${HOME} /usr/bin
+		export export then $(pwd) then ${HOME} cd $(pwd) "$1" done
+echo export done readonly grep grep 2>/dev/null readonly local
+		"$@" done | echo && then && 2>/dev/null test grep ${HOME} awk test test
+	| local "$@" 2>/dev/null /usr/bin
+printf awk && local ${HOME} "$1" printf && awk ${HOME} | done ${HOME} $(pwd)
+	x=1 | /usr/bin done 2>/dev/null then | && "$@" test "$1" 'quoted text' 'quoted text'
+		&& ${HOME} sed printf sed "$@"
+export | 2>/dev/null cd local sed
+	then then sed done cd cd
+'quoted text' local echo --verbose
+	awk local cd then awk "$@" done
+done awk 2>/dev/null "$1" test readonly local "$1"
+		${HOME} ${HOME} printf local 2>/dev/null test done
+&& printf | awk $(pwd) x=1 printf
+		${HOME} echo ${HOME} 2>/dev/null awk sed printf /usr/bin cd
+	${HOME} test /usr/bin --verbose ${HOME} awk awk | test /usr/bin
+'quoted text' printf 2>/dev/null -eu readonly printf
+	$(pwd) then done readonly $(pwd) "$@" grep sed | grep && cd printf -eu
+		"$@" then && readonly export local awk grep then 'quoted text'
+	then "$@" test $(pwd) 'quoted text'
+	export "$@" export printf readonly
+cd x=1 printf && then then && export ${HOME} -eu $(pwd) 'quoted text'
+		&& 2>/dev/null 2>/dev/null -eu --verbose printf ${HOME} export ${HOME} echo
+local local "$@" $(pwd) /usr/bin /usr/bin done "$@" awk | 2>/dev/null "$@"
+export "$1" then export 'quoted text' then then test done
+		-eu printf | echo /usr/bin "$@" sed /usr/bin --verbose && &&
+		2>/dev/null "$@" "$@" $(pwd)
+	test echo export echo echo echo | sed local local
+		"$@" grep then 'quoted text' "$@" 'quoted text' $(pwd)
+		then | printf then cd && awk --verbose
+	"$@" echo --verbose local "$@" readonly x=1 -eu done
+export 'quoted text' awk $(pwd) done && --verbose printf then then
+		2>/dev/null 2>/dev/null test sed printf grep local && --verbose && test
+	readonly | then grep x=1 awk local cd "$1" 'quoted text' then printf | --verbose
+	export sed cd cd echo sed $(pwd) awk then ${HOME} awk $(pwd) -eu
+		${HOME} 'quoted text' echo cd $(pwd) cd
+		"$1" grep "$1" local echo test printf grep
+	printf printf done | --verbose $(pwd) echo &&
+		sed done "$1" sed grep test awk cd local
+	awk test done --verbose cd printf 2>/dev/null test
+	"$1" -eu readonly --verbose grep -eu cd "$@" "$1" cd readonly
+awk local x=1 --verbose echo --verbose local
+sed readonly printf printf --verbose ${HOME}
+		/usr/bin 'quoted text' /usr/bin /usr/bin 'quoted text' $(pwd) sed
+	local then export && && export | test 2>/dev/null
+		awk $(pwd) cd /usr/bin --verbose
+	--verbose done local grep "$@"
+	'quoted text' sed /usr/bin
+readonly x=1 local echo sed
+cd cd && | "$1" printf $(pwd) echo echo 'quoted text'
+		echo cd ${HOME} /usr/bin grep printf 2>/dev/null ${HOME} "$@"
+then test ${HOME} && x=1 grep 'quoted text' 'quoted text' x=1 cd export sed
+	$(pwd) grep "$1" export awk export
+		-eu /usr/bin then ${HOME} grep export
+	done $(pwd) printf /usr/bin ${HOME} then local echo
+	"$@" local sed "$1" test printf printf
+/usr/bin export test export $(pwd) printf test sed 'quoted text'
+	2>/dev/null -eu local 2>/dev/null && 2>/dev/null grep echo
+		export "$@" export /usr/bin 2>/dev/null test $(pwd) 2>/dev/null
+"$@" "$@" 2>/dev/null sed local cd printf "$@"
+export "$1" then ${HOME} | sed && sed --verbose printf | sed cd sed | && -eu
+export printf done | readonly awk | then --verbose
+	'quoted text' /usr/bin printf | grep x=1 grep printf cd -eu
+test /usr/bin test printf -eu export 2>/dev/null cd --verbose
+	cd ${HOME} sed local "$@" awk awk --verbose x=1 ${HOME}
+	x=1 --verbose /usr/bin awk sed echo cd readonly done ${HOME} done /usr/bin
+	done local export awk readonly
+		2>/dev/null echo ${HOME} grep -eu
+${HOME} && export local --verbose done
+	readonly -eu then local then "$@" && cd awk awk local then /usr/bin 2>/dev/null
+		"$@" local -eu done --verbose
+	$(pwd) grep awk cd cd readonly
+	'quoted text' then printf ${HOME} $(pwd) export sed then --verbose
+awk $(pwd) done ${HOME} x=1
+	then ${HOME} -eu test 2>/dev/null -eu 2>/dev/null "$@" test /usr/bin cd 2>/dev/null
+&& printf 2>/dev/null printf x=1 -eu 'quoted text' test awk "$1" done
+--verbose && local x=1 echo echo
+	test grep x=1 echo -eu local && then | $(pwd)
+	--verbose "$@" printf readonly $(pwd) sed
+2>/dev/null grep x=1 --verbose
+		done echo x=1 export local test 'quoted text'
+		--verbose readonly test local
+		| $(pwd) x=1 --verbose --verbose done printf
+	grep awk --verbose grep then ${HOME} -eu done awk $(pwd) export /usr/bin
+	readonly "$1" ${HOME} done test -eu -eu ${HOME} echo cd
+printf 2>/dev/null readonly --verbose
+-eu cd export awk done --verbose local
+echo local 'quoted text' test awk 'quoted text' /usr/bin
+		| $(pwd) cd && 2>/dev/null export readonly x=1 /usr/bin $(pwd) -eu ${HOME}
+	${HOME} cd then $(pwd) test readonly ${HOME} done && $(pwd) readonly
+		'quoted text' readonly sed x=1 awk $(pwd) 2>/dev/null ${HOME} export sed
+'quoted text' done 'quoted text' /usr/bin then export readonly
+	${HOME} cd test /usr/bin
+-eu awk awk local export awk cd awk cd sed local
+	/usr/bin sed done awk local sed local grep $(pwd) then -eu
+/usr/bin done awk printf then
+		awk cd && -eu then awk readonly local done
+	-eu /usr/bin printf grep then then grep grep echo local readonly -eu echo
+cd readonly printf readonly --verbose 2>/dev/null "$@" local echo 'quoted text'
+	2>/dev/null sed $(pwd) done /usr/bin grep x=1 ${HOME} cd | "$@" awk
+		${HOME} grep awk -eu $(pwd) local | printf sed | then $(pwd) 'quoted text' grep
+		${HOME} ${HOME} 'quoted text' | export "$@" /usr/bin awk grep grep /usr/bin 'quoted text'
+then export "$1" printf sed ${HOME} awk printf
+	--verbose "$1" "$1" sed "$@"
+		"$1" 'quoted text' "$@" cd "$@" 2>/dev/null
+		readonly 2>/dev/null | done done "$1" x=1 x=1 /usr/bin grep
+		echo test test $(pwd) --verbose export done x=1 ${HOME} 'quoted text' $(pwd) then
+		${HOME} awk awk 2>/dev/null && && "$1" test export -eu x=1 "$1"
+		grep printf test "$1" sed echo 'quoted text' $(pwd) cd local | /usr/bin
+	grep cd grep "$1" 2>/dev/null $(pwd) | echo export /usr/bin /usr/bin
+&& printf cd grep readonly -eu grep "$1" $(pwd) grep /usr/bin test 2>/dev/null
+		echo printf awk ${HOME} 'quoted text' 2>/dev/null x=1 done sed && export
+'quoted text' && /usr/bin && "$1" "$1" cd local "$1"
+grep && && $(pwd) cd cd export $(pwd) grep done ${HOME} cd sed
+	then echo /usr/bin $(pwd) "$1" export 'quoted text'
+		grep readonly grep readonly --verbose
+2>/dev/null ${HOME} done printf awk readonly 2>/dev/null
+		&& grep x=1 /usr/bin printf done $(pwd) --verbose cd && 'quoted text'
+"$1" grep $(pwd) test $(pwd) then 2>/dev/null done grep readonly export local
+"$1" $(pwd) x=1 && awk -eu
+		export test "$1" sed cd --verbose
+	$(pwd) done printf export && -eu x=1 "$1" | $(pwd) test
+		&& cd awk test then sed grep grep 'quoted text'
+	"$@" test /usr/bin ${HOME} x=1 $(pwd)
+		done && 2>/dev/null | local 2>/dev/null
+'quoted text' test local "$@" "$@" grep cd awk
+		cd sed x=1 test awk x=1 done grep cd test readonly
+printf -eu test ${HOME} && x=1 export /usr/bin --verbose grep ${HOME} /usr/bin
+	printf printf done $(pwd) readonly readonly
+readonly $(pwd) x=1 cd 'quoted text' then cd && cd -eu cd 'quoted text' --verbose
+	echo done done done test 'quoted text' sed
+	&& | "$1" $(pwd) readonly local sed --verbose echo cd echo -eu | echo export
+then cd --verbose then ${HOME} ${HOME} $(pwd) "$1" --verbose x=1 local 'quoted text'
+/usr/bin -eu $(pwd) test | echo | "$@"
+		/usr/bin then test local x=1 export sed --verbose && x=1 "$1"
+		/usr/bin --verbose grep awk -eu readonly cd && "$@" local $(pwd) grep grep
+	${HOME} -eu x=1 readonly local cd export 2>/dev/null export cd 'quoted text'
+grep -eu 2>/dev/null done /usr/bin sed cd local
+then 2>/dev/null echo echo awk local cd 2>/dev/null
+	awk | test --verbose done "$1" sed done $(pwd)
+		echo -eu local awk cd "$1"
+${HOME} done export then x=1 cd -eu cd echo 2>/dev/null sed
+'quoted text' done x=1 cd awk export ${HOME} x=1 "$@" then "$1" ${HOME}
+		&& local ${HOME} local && test
+		| 2>/dev/null --verbose && 'quoted text' "$@" ${HOME} /usr/bin awk --verbose
+${HOME} && export x=1 grep export 2>/dev/null readonly done 'quoted text'
+		test 'quoted text' grep
+		${HOME} -eu then grep test 2>/dev/null echo readonly 2>/dev/null test sed
+	"$@" local | grep cd
+		2>/dev/null /usr/bin echo test -eu then x=1 "$@" && printf -eu then readonly
+		-eu && "$@" 2>/dev/null sed export "$1" | /usr/bin -eu 'quoted text'
+local "$@" export grep local
+	&& printf echo printf | echo x=1 printf --verbose done
+	"$1" local | "$@" /usr/bin awk 2>/dev/null
+'quoted text' /usr/bin local /usr/bin "$1" ${HOME} local test done
+	${HOME} 'quoted text' ${HOME} awk
+	-eu then then --verbose
+	2>/dev/null cd export && && awk export "$1" printf 'quoted text'
+		sed 2>/dev/null grep | x=1 done cd "$@" --verbose
+		"$1" done /usr/bin awk | && 'quoted text'
+	&& test done "$@" "$@" done --verbose "$1" readonly ${HOME} "$1"
+		export test --verbose /usr/bin local printf
+		${HOME} cd /usr/bin test x=1 awk cd test --verbose cd /usr/bin then readonly
+-eu sed $(pwd) /usr/bin awk -eu 'quoted text' then readonly
+-eu ${HOME} done awk test sed | sed
+		"$1" ${HOME} "$@" ${HOME} test /usr/bin
+	"$@" then --verbose ${HOME} test
+echo /usr/bin --verbose export echo grep test "$@" grep 2>/dev/null
+		test x=1 readonly grep "$@" readonly readonly done done
+	x=1 x=1 readonly awk local echo $(pwd) ${HOME} cd then cd awk && test
+test cd -eu ${HOME} | "$1" local test echo
+	2>/dev/null test ${HOME} cd sed echo cd echo done sed sed cd then local
+		"$@" done "$1" 2>/dev/null "$1" readonly done | "$@" echo cd grep "$@" --verbose
+		"$1" && ${HOME} | export 2>/dev/null ${HOME} export "$@" export awk local
+	export awk local && 'quoted text' echo 2>/dev/null
+	local awk | "$1" | sed $(pwd) local cd grep test export readonly 'quoted text' &&
+sed sed echo --verbose done
+	/usr/bin 2>/dev/null readonly export
+		/usr/bin local 2>/dev/null export readonly echo grep cd --verbose "$@" done cd
+		then 2>/dev/null 'quoted text'
+echo -eu $(pwd) echo test then printf
+		"$@" | local done echo x=1 x=1 test export grep
+	| -eu ${HOME} -eu -eu "$1" "$1" test 'quoted text' x=1 --verbose grep ${HOME}
+	export then test "$@" && --verbose export --verbose
+echo echo -eu -eu -eu readonly --verbose grep readonly
+	| export readonly then awk
+		2>/dev/null cd ${HOME} x=1 $(pwd) readonly test readonly x=1 awk cd x=1 "$1"
+awk /usr/bin echo test cd "$@" printf test then | --verbose | export
+	echo export export cd 'quoted text' grep sed
+readonly awk x=1 ${HOME} 'quoted text' ${HOME} 2>/dev/null done -eu "$1"
+	| --verbose && 'quoted text' awk && cd local
+		--verbose /usr/bin 'quoted text' "$@" ${HOME} grep readonly
+	awk --verbose test 'quoted text' sed cd then printf --verbose awk done echo sed
+		$(pwd) printf "$1" echo readonly --verbose test | | -eu --verbose $(pwd)
+	done done export grep "$1"
+		'quoted text' printf -eu done cd sed 'quoted text' sed 2>/dev/null cd
+		/usr/bin echo x=1 x=1 awk then printf
+	2>/dev/null "$1" done done 'quoted text'
+		'quoted text' test then --verbose then then $(pwd) 'quoted text' "$1" x=1 cd
+		| local && --verbose -eu local 'quoted text' grep then readonly 2>/dev/null
+--verbose 2>/dev/null cd done readonly ${HOME}
+	test then echo export && && "$1" -eu && local | grep
+		cd then 'quoted text' && "$@" --verbose awk local /usr/bin
+		grep echo cd "$@" printf
+$(pwd) export ${HOME}
+	awk 'quoted text' | "$@" test
+	test awk "$@" grep awk then -eu 2>/dev/null "$1" printf readonly x=1 echo "$@"
+		/usr/bin cd "$@" cd done local && && ${HOME}
+	cd echo export grep sed printf done x=1 echo
+		/usr/bin then export "$@" "$@" local
+	"$1" export $(pwd) local awk printf cd $(pwd)
+/usr/bin ${HOME} sed 'quoted text' cd x=1 ${HOME} -eu 2>/dev/null /usr/bin
+	readonly | readonly then --verbose "$@" -eu
+	readonly done local ${HOME} grep
+	cd readonly test then "$@" local
+		local test --verbose ${HOME} sed
+		echo $(pwd) "$1" && | 2>/dev/null
+		printf x=1 local ${HOME}
+		printf "$1" 'quoted text' done printf
+done export export sed 'quoted text' test
+${HOME} $(pwd) | then echo | && "$1" "$@"
+"$1" printf "$1" test
+	printf 'quoted text' "$1" -eu
+		test test printf $(pwd) done then test printf x=1 local export /usr/bin
+	local "$1" /usr/bin cd sed export
+		/usr/bin /usr/bin && 2>/dev/null /usr/bin then test 'quoted text'
+| local local ${HOME} | /usr/bin 'quoted text' /usr/bin -eu local 2>/dev/null
+		sed x=1 grep -eu --verbose x=1
+	&& 2>/dev/null then export /usr/bin readonly test done printf 'quoted text'
+		cd then grep "$@" && x=1 |
+	x=1 x=1 printf cd test ${HOME}
+	echo "$1" done sed printf awk &&
+local x=1 "$@" sed --verbose
+export | then $(pwd) cd | awk --verbose grep -eu ${HOME} 2>/dev/null awk
+cd -eu echo test echo | "$1" ${HOME} sed 'quoted text' "$1" &&
+	done test -eu ${HOME} then local && echo cd "$@" test
+	$(pwd) local cd "$@" | test 'quoted text'
+		2>/dev/null then then local export 'quoted text' $(pwd) export echo printf | | --verbose
+		readonly grep echo printf export $(pwd) ${HOME} /usr/bin
+	readonly $(pwd) test x=1 | 'quoted text' done 2>/dev/null | echo grep export test
+	"$1" grep --verbose | $(pwd) 2>/dev/null
+		&& "$@" /usr/bin | "$@" export test then /usr/bin 2>/dev/null | then "$@"
+		| | readonly export x=1 /usr/bin export $(pwd) then printf done
+sed "$1" export "$@" /usr/bin ${HOME} $(pwd) 'quoted text' $(pwd)
+	then "$1" readonly readonly cd grep grep local "$1" printf
+readonly -eu 2>/dev/null "$1" --verbose local
+readonly grep echo local && 2>/dev/null printf x=1 "$@" 2>/dev/null then
+		${HOME} grep $(pwd) export /usr/bin 'quoted text' /usr/bin -eu
+	done "$1" readonly grep 'quoted text'
+"$1" printf readonly ${HOME} echo echo echo | then done | $(pwd) done echo export
+		done --verbose | | --verbose "$@" "$@" /usr/bin export
+readonly readonly then then -eu 2>/dev/null sed /usr/bin done
+		readonly cd printf && x=1 grep x=1 test 'quoted text' done echo /usr/bin | x=1
+	awk readonly cd cd -eu "$@" sed && printf cd 'quoted text'
+then | /usr/bin "$1" && /usr/bin /usr/bin
+cd /usr/bin 2>/dev/null /usr/bin then test cd ${HOME} export $(pwd) test export
+2>/dev/null test test export "$1" export echo /usr/bin sed local sed test
+		$(pwd) test ${HOME} $(pwd) cd 2>/dev/null
+		"$1" local cd | $(pwd) sed echo then readonly && "$1" awk ${HOME} local export
+	local --verbose 2>/dev/null && awk grep sed done then done printf then local
+		grep done "$@" 'quoted text' echo echo -eu && export "$@"
+		2>/dev/null printf 'quoted text' export test local echo && then awk awk
+	printf local done done printf done test readonly sed "$@" cd echo test cd 2>/dev/null
+	grep && && sed "$@" 2>/dev/null && echo 2>/dev/null /usr/bin
+	export local /usr/bin -eu readonly
+'quoted text' done then /usr/bin /usr/bin 'quoted text'
+		--verbose -eu | "$1" $(pwd) -eu && cd grep then /usr/bin "$@" "$@" test -eu readonly
+${HOME} "$1" sed ${HOME} grep sed -eu test readonly test
+#include c13.sh
+		test done done local && -eu ${HOME} 'quoted text' local 2>/dev/null then x=1 cd
+		cd "$@" readonly "$@" && /usr/bin ${HOME}
+		local local grep done echo printf cd $(pwd) -eu "$@" -eu readonly | printf
+		x=1 echo -eu ${HOME} done sed done cd /usr/bin
+	&& done $(pwd) 'quoted text' readonly
+test -eu 2>/dev/null 2>/dev/null
+done echo readonly echo done | $(pwd) 'quoted text' local echo
+test then 'quoted text' then && printf ${HOME} 2>/dev/null
+		$(pwd) | && local cd awk printf
+		printf && done printf test && x=1 export /usr/bin $(pwd)
+		${HOME} | "$@" "$@" readonly readonly $(pwd) local then x=1
+		test 2>/dev/null ${HOME} $(pwd) then ${HOME} -eu export | awk cd readonly cd
+readonly grep "$1" local local then cd | done
+	readonly x=1 cd sed /usr/bin 2>/dev/null sed cd then 2>/dev/null test test
+	local 'quoted text' "$1" local export
+	/usr/bin x=1 "$@" sed /usr/bin
+		export cd done echo && $(pwd) export local grep
+sed printf && "$@" 2>/dev/null test test
+	readonly /usr/bin && 'quoted text' 2>/dev/null "$@" ${HOME} test test
+	| readonly $(pwd) cd | 'quoted text' "$1" test
+		cd readonly printf x=1 "$@" $(pwd) awk
+	/usr/bin -eu x=1 x=1 $(pwd) --verbose
+		readonly export local local $(pwd) done done 'quoted text' local | 2>/dev/null readonly
+		readonly 'quoted text' cd && "$@" 'quoted text' "$1" "$@" readonly -eu
+awk x=1 readonly local echo /usr/bin done echo "$1"
+		&& sed 'quoted text' done
+then echo sed echo x=1
+		$(pwd) /usr/bin /usr/bin | local readonly | && x=1 'quoted text' readonly
+		echo "$@" "$@" ${HOME} | awk 2>/dev/null
+	sed echo 2>/dev/null echo echo $(pwd) then done readonly export
+	2>/dev/null done "$1" 'quoted text' ${HOME} --verbose x=1 'quoted text'
+	&& && "$1" export export awk local /usr/bin done echo cd /usr/bin then export
+	local /usr/bin 'quoted text' --verbose
+		awk test export readonly
+		x=1 test "$1" -eu echo readonly ${HOME} 'quoted text'
+| grep printf x=1 --verbose
+	--verbose $(pwd) 'quoted text' then export "$@" grep
+		readonly "$1" readonly --verbose | 'quoted text' "$1" grep
+		| cd sed test 'quoted text' echo ${HOME} ${HOME} readonly
+		printf $(pwd) $(pwd) && sed "$1" export "$@" awk --verbose cd --verbose
+local ${HOME} grep awk $(pwd)
+		export local local done then readonly
+test /usr/bin 'quoted text'
+"$@" then ${HOME} printf x=1 2>/dev/null
+		'quoted text' && 'quoted text' --verbose
+	"$@" x=1 -eu /usr/bin --verbose then awk then cd | awk ${HOME} sed sed done
+sed grep 2>/dev/null export readonly /usr/bin
+then "$1" -eu | $(pwd) done done /usr/bin grep
+	x=1 --verbose "$@" -eu && echo
+	--verbose local "$1" then x=1 /usr/bin
+		cd readonly awk cd | --verbose done
+	"$1" && 'quoted text' then
+/usr/bin cd sed then x=1 echo "$1" awk --verbose readonly cd printf local
+echo local "$1" 2>/dev/null && export test $(pwd) && readonly
+	--verbose | $(pwd) | awk x=1 | && 2>/dev/null
+	2>/dev/null ${HOME} /usr/bin sed $(pwd)
+	| readonly /usr/bin --verbose && 'quoted text' |
+/usr/bin printf 2>/dev/null && $(pwd)
+	test $(pwd) --verbose $(pwd) echo export ${HOME} 'quoted text'
+		grep local 'quoted text' &&
+	sed grep then sed then | awk ${HOME} 'quoted text' -eu &&
+| "$@" echo -eu && && --verbose
+	sed export echo done
+		&& $(pwd) 2>/dev/null "$@" awk "$1" awk --verbose awk readonly then "$1"
+'quoted text' -eu sed echo printf test sed sed then done sed 'quoted text'
+export -eu --verbose test
+"$@" echo test "$1" awk grep "$@" "$@" sed ${HOME} sed awk "$@" local 2>/dev/null
+${HOME} export && x=1 /usr/bin echo
+| test 'quoted text' grep then then test then readonly then echo cd printf
+		"$@" x=1 done then "$@" && sed -eu | $(pwd) local --verbose
+echo echo -eu "$1" "$@" ${HOME} /usr/bin | echo sed
+export -eu && | -eu grep
+		| echo -eu printf export
+		2>/dev/null test | echo
+done --verbose echo then | 'quoted text' --verbose echo then ${HOME} --verbose
+printf /usr/bin /usr/bin 'quoted text'
+		--verbose printf echo "$@" awk done | grep && --verbose ${HOME} cd cd
+	"$@" awk "$@" readonly awk cd then | done
+grep done ${HOME} | $(pwd) export sed cd printf cd local
+	$(pwd) "$1" $(pwd) x=1 then cd cd export
+	done export 2>/dev/null | && ${HOME} $(pwd) grep "$1" /usr/bin && echo &&
+cd readonly test -eu cd awk export sed "$1" cd -eu -eu "$1" x=1
+&& echo | test done awk awk "$@" 2>/dev/null
+		export /usr/bin done x=1
+	export ${HOME} "$@" export 'quoted text' | awk printf
+		readonly ${HOME} export "$@" awk $(pwd) awk cd printf grep
+--verbose then printf local | | test awk "$@" test ${HOME} printf cd grep
+then cd && -eu cd local grep "$@" 'quoted text'
+"$1" /usr/bin ${HOME} local $(pwd)
+"$1" "$1" "$@" 'quoted text' grep 2>/dev/null echo done
+	sed x=1 | echo "$1" "$@" test readonly done
+		${HOME} -eu "$1" -eu cd $(pwd) ${HOME} "$@" grep grep ${HOME} then
+		echo awk local grep /usr/bin cd 'quoted text' local printf
+		local echo export 2>/dev/null "$@" cd echo cd awk /usr/bin
+	done $(pwd) grep cd cd done "$@" echo printf x=1 sed cd && "$@" test local export
+		"$@" awk 'quoted text' readonly done grep "$1" "$@" | 'quoted text' cd readonly
+'quoted text' done test awk echo "$1" $(pwd) export
+done sed echo then 2>/dev/null
+		printf x=1 grep --verbose cd && done export printf
+local "$1" sed "$1" test export 'quoted text' x=1 $(pwd) /usr/bin
+	grep "$1" cd sed grep | 2>/dev/null
+	cd sed $(pwd) --verbose then ${HOME} cd $(pwd) x=1 local
+	test sed then /usr/bin done export
+		awk local && x=1 | awk 2>/dev/null 'quoted text' done --verbose ${HOME}
+		$(pwd) readonly export 'quoted text' $(pwd) $(pwd)
+		${HOME} -eu | grep $(pwd) && grep /usr/bin ${HOME} sed printf |
+'quoted text' x=1 cd export
+"$@" cd ${HOME} "$@" printf ${HOME} /usr/bin cd readonly
+		/usr/bin "$@" sed export 2>/dev/null "$1" 2>/dev/null readonly
+$(pwd) test /usr/bin readonly ${HOME} $(pwd) /usr/bin ${HOME} test
+		"$1" 'quoted text' "$1" ${HOME} -eu done export -eu then local -eu 2>/dev/null
+	echo /usr/bin && echo export grep readonly ${HOME}
+	printf grep "$@" local cd test "$@" local then
+		readonly -eu "$1" cd $(pwd) "$1" grep readonly
+		readonly 'quoted text' done done export "$1" ${HOME} sed $(pwd) sed
+		&& -eu cd 2>/dev/null test sed printf
+		"$@" cd /usr/bin ${HOME} | 2>/dev/null 'quoted text' then test
+then local 2>/dev/null x=1 "$1" grep local grep
+awk "$@" "$@" done /usr/bin -eu sed $(pwd) "$1" local /usr/bin
+	grep "$1" "$@" x=1 sed /usr/bin readonly
+		printf "$1" --verbose "$@" awk $(pwd) ${HOME} | then awk $(pwd)
+"$1" export readonly x=1 readonly export --verbose $(pwd)
+	| -eu cd | cd x=1 "$@" then ${HOME} awk printf -eu local printf echo cd $(pwd)
+		readonly done export grep test local local export
+		awk --verbose echo awk -eu
+/usr/bin local "$1" /usr/bin then export test cd done export printf -eu
+	printf /usr/bin grep local 'quoted text'
+		grep && | 'quoted text' printf && x=1 grep && cd && && ${HOME}
+${HOME} $(pwd) | 2>/dev/null
+		--verbose "$@" "$1" --verbose /usr/bin "$@" x=1 local | awk export
+	printf echo "$@" ${HOME} --verbose then
+		--verbose $(pwd) awk export && x=1
+		2>/dev/null "$1" /usr/bin
+local 'quoted text' /usr/bin local -eu && "$1" printf --verbose echo $(pwd) 2>/dev/null
+		grep -eu sed sed x=1 ${HOME}
+$(pwd) "$1" /usr/bin awk
+'quoted text' 2>/dev/null ${HOME} local 2>/dev/null
+then sed ${HOME} -eu "$1" sed grep
+	local done "$1" --verbose
+		sed test sed export export
+"$@" -eu export --verbose 2>/dev/null printf
+	readonly echo x=1 --verbose grep 'quoted text'
+		readonly -eu local echo $(pwd) x=1 -eu printf awk --verbose export --verbose
+		echo "$@" /usr/bin 2>/dev/null
+"$@" grep "$@" 2>/dev/null && test --verbose x=1 awk 2>/dev/null x=1 readonly
+"$@" export sed grep echo 2>/dev/null ${HOME} readonly
+		printf echo ${HOME} then printf ${HOME} 2>/dev/null printf cd
+		export "$1" && /usr/bin then sed ${HOME} "$1" readonly x=1 sed /usr/bin
+		$(pwd) 2>/dev/null $(pwd) | readonly printf local 'quoted text'
+	&& printf grep awk && ${HOME} grep ${HOME} x=1 awk export 2>/dev/null
+| echo | "$1" readonly test
+local | test then $(pwd) $(pwd) done $(pwd)
+	| local && -eu export --verbose echo test cd test then --verbose
+test "$@" --verbose done
+	x=1 -eu printf done grep -eu 'quoted text' /usr/bin "$1" $(pwd) $(pwd) x=1
+		x=1 echo sed 2>/dev/null local -eu readonly ${HOME} printf awk readonly
+		&& done $(pwd) readonly then
+		$(pwd) done local readonly sed | then printf export && then --verbose "$@" awk
+	'quoted text' /usr/bin grep 'quoted text' done printf "$1" printf | then "$@" &&
+-eu then then printf grep /usr/bin then sed ${HOME} $(pwd) | x=1 awk 'quoted text'
+	printf done -eu ${HOME} readonly /usr/bin 2>/dev/null $(pwd) /usr/bin
+		test then 'quoted text' | $(pwd) done "$1" echo 'quoted text' | --verbose
+		"$1" ${HOME} sed sed grep done "$1" export printf
+		&& "$@" awk $(pwd) "$@" test && awk 2>/dev/null sed 2>/dev/null --verbose local
+		local awk 2>/dev/null export
+		"$1" "$@" echo done local then "$@"
+	echo export awk -eu sed "$@"
+export done readonly /usr/bin 2>/dev/null |
+"$@" grep "$@" echo ${HOME} ${HOME} ${HOME} 'quoted text'
+		"$1" test 'quoted text' $(pwd) readonly export echo --verbose
+&& 'quoted text' /usr/bin 'quoted text'
+/usr/bin awk x=1 done 'quoted text' x=1 test sed printf ${HOME} $(pwd) && /usr/bin
+	awk echo grep /usr/bin then
+2>/dev/null export --verbose sed printf cd x=1 && cd -eu cd && readonly -eu | "$1"
+	x=1 awk | && printf awk echo && sed && done -eu /usr/bin awk export 2>/dev/null
+	then 'quoted text' export 'quoted text' $(pwd) ${HOME} -eu echo "$@"
+	/usr/bin cd echo 'quoted text' ${HOME} readonly printf x=1 awk grep
+	${HOME} cd | --verbose "$@" 2>/dev/null ${HOME} x=1 readonly | done
+		/usr/bin | 'quoted text' local x=1 2>/dev/null 2>/dev/null test 2>/dev/null
+		cd 'quoted text' printf then sed /usr/bin x=1 readonly cd done done echo --verbose
+awk echo grep printf 'quoted text' /usr/bin | | sed echo export x=1
+local printf --verbose 'quoted text' && "$@" 'quoted text'
+		printf "$1" local awk echo done local $(pwd) printf
+	${HOME} cd $(pwd) 'quoted text' export awk --verbose
+'quoted text' sed --verbose local cd done export printf
+export "$1" export cd
+	sed x=1 echo x=1 ${HOME} ${HOME} awk test "$1" then x=1 -eu
+		'quoted text' readonly local local printf test && /usr/bin $(pwd)
+echo | $(pwd) x=1 local readonly
+		--verbose x=1 then | sed -eu
+	done local local local "$1" printf readonly /usr/bin -eu --verbose local
+		echo 'quoted text' ${HOME} printf readonly | "$@" export $(pwd) echo test | "$1"
+		"$@" local -eu then ${HOME} sed awk printf export grep --verbose $(pwd) ${HOME}
+	then "$1" x=1 export && local export local --verbose
+	"$@" "$1" printf grep echo local test done
+"$1" then echo sed echo done then
+x=1 done $(pwd) echo awk --verbose
+	local ${HOME} 2>/dev/null | done && cd
+		then cd test /usr/bin grep --verbose then x=1 echo /usr/bin 'quoted text'
+&& "$1" awk printf test x=1 | -eu readonly x=1 ${HOME} x=1 x=1 $(pwd) --verbose
+	&& --verbose && test "$1" export echo 2>/dev/null --verbose local
+	| 2>/dev/null | local readonly
+${HOME} then export "$@" 2>/dev/null export
+		echo local readonly -eu printf 'quoted text' x=1
+		local sed ${HOME} && "$1" sed 'quoted text' /usr/bin "$@" local test $(pwd) "$1"
+test | cd export 'quoted text' test awk export "$1" awk echo test
+		${HOME} /usr/bin local --verbose 'quoted text' $(pwd) 'quoted text' /usr/bin
+		$(pwd) grep test 2>/dev/null printf grep local echo --verbose
+printf /usr/bin ${HOME} $(pwd) sed cd done x=1 "$@" 2>/dev/null cd 'quoted text'
+	cd done printf done awk 2>/dev/null 'quoted text' x=1 grep "$@"
+	${HOME} "$@" cd ${HOME} echo
+&& readonly "$1" printf readonly grep
+sed $(pwd) done then | --verbose /usr/bin
+	${HOME} --verbose readonly sed $(pwd) 2>/dev/null local local --verbose
+	| "$1" sed ${HOME} echo 2>/dev/null -eu --verbose 2>/dev/null
+printf x=1 --verbose export ${HOME}
+		test --verbose /usr/bin -eu "$1" && && --verbose export sed grep local
+	then awk readonly export 'quoted text' printf && readonly
+"$1" done $(pwd) | && test $(pwd) then export done
+		$(pwd) x=1 readonly 2>/dev/null ${HOME}
+	then 2>/dev/null grep sed "$1" printf 'quoted text' x=1 $(pwd)
+	2>/dev/null "$1" 'quoted text'
+		'quoted text' then $(pwd) export
+$(pwd) export grep 'quoted text' | done "$@"
+		$(pwd) awk cd | $(pwd)
+echo --verbose printf printf
+	local /usr/bin ${HOME} local 'quoted text' cd $(pwd) echo
+	sed "$@" printf then 'quoted text' grep then -eu && x=1 readonly
+| cd readonly "$@" $(pwd) ${HOME} 2>/dev/null
+grep | | then grep done done done /usr/bin
+local "$@" readonly grep export awk test readonly "$@" local
+export grep --verbose "$1" --verbose
+		-eu ${HOME} then printf echo
+		2>/dev/null $(pwd) "$1" 2>/dev/null
+		readonly cd cd local export ${HOME} /usr/bin done | 2>/dev/null cd echo --verbose
+test | /usr/bin "$@" echo
+	"$1" grep done done "$@"
+"$1" ${HOME} | /usr/bin -eu $(pwd) test test echo && 2>/dev/null cd "$@" export
+	--verbose x=1 local then "$1" awk 2>/dev/null
+		local cd 2>/dev/null "$1" local x=1 && -eu $(pwd) x=1 done local
+/usr/bin 'quoted text' export 2>/dev/null done -eu $(pwd) x=1 'quoted text'
+	x=1 'quoted text' && ${HOME}
+		$(pwd) 'quoted text' readonly export export export --verbose -eu $(pwd)
+	echo sed readonly "$@" ${HOME}
+	&& "$1" local local --verbose --verbose done /usr/bin -eu --verbose 2>/dev/null
+printf /usr/bin test x=1 && echo ${HOME} --verbose sed
+	awk 2>/dev/null readonly then echo local
+$(pwd) -eu -eu local && ${HOME} && x=1
+	/usr/bin grep export --verbose
+		x=1 -eu | echo | awk ${HOME} $(pwd) 2>/dev/null "$1" ${HOME} printf done awk $(pwd)
+		"$@" awk ${HOME} echo sed then readonly 2>/dev/null readonly
+echo "$@" --verbose $(pwd) awk "$@" "$@" done grep then
+	-eu readonly done $(pwd) /usr/bin 2>/dev/null 'quoted text' --verbose
+'quoted text' grep done awk ${HOME}
+	echo 2>/dev/null awk | printf 2>/dev/null cd && x=1 'quoted text'
+export then /usr/bin sed 'quoted text'
+		done local 'quoted text' printf --verbose $(pwd)
+		test | sed "$1" printf printf test
+		sed --verbose | 2>/dev/null 'quoted text' /usr/bin "$@" done /usr/bin
+$(pwd) cd export x=1 then /usr/bin local "$@" x=1 | "$@" sed $(pwd)
+	echo test export cd $(pwd) awk "$@" cd x=1 ${HOME} 'quoted text' $(pwd)
+		cd export | test /usr/bin sed echo /usr/bin | done
+| awk done --verbose "$1" test -eu
+printf 'quoted text' grep | x=1 local export awk export done local export
+	&& test -eu x=1 | "$1" echo "$@" local "$@" sed "$@"
+	${HOME} cd then then awk --verbose grep --verbose /usr/bin
+	grep --verbose -eu then "$@" ${HOME} && local -eu | /usr/bin awk
+	awk "$@" echo local echo local 'quoted text'
+grep -eu printf sed printf x=1 test -eu awk awk "$1" x=1 "$1" $(pwd) x=1
+	then test export 2>/dev/null echo 'quoted text' cd
+		echo cd | awk awk $(pwd) then "$1" | local local export "$1" "$1" printf
+	then --verbose sed | awk grep local
+	${HOME} "$1" test "$1" && grep printf readonly printf readonly | test local grep
+	-eu 2>/dev/null "$@" echo
+		local "$@" ${HOME} "$1" /usr/bin echo then x=1 x=1 local "$@" $(pwd) | "$1"
+	done readonly "$@" awk echo readonly
+&& "$@" | local sed x=1 -eu 2>/dev/null readonly 2>/dev/null
+	"$@" "$@" echo test local local ${HOME}
+		sed printf grep --verbose && done -eu cd done ${HOME} /usr/bin
+		grep sed grep echo && /usr/bin test
+		printf sed readonly cd printf printf 'quoted text' /usr/bin 'quoted text'
+		echo then -eu "$1" printf $(pwd) export local local readonly
+		readonly 'quoted text' -eu | 2>/dev/null
+		--verbose x=1 grep done 2>/dev/null readonly "$@" echo awk "$@" cd /usr/bin ${HOME}
+	local && readonly && ${HOME} local /usr/bin sed && ${HOME} -eu
+	done echo readonly --verbose then && && sed test echo
+cd x=1 'quoted text' $(pwd) | "$1" "$@" then 2>/dev/null readonly
+		sed local "$@" echo printf -eu sed -eu local 2>/dev/null x=1 ${HOME} echo local
+		2>/dev/null test 'quoted text' ${HOME} awk -eu grep $(pwd) then 2>/dev/null
+	--verbose x=1 'quoted text' sed
+done ${HOME} ${HOME} sed readonly "$1" grep "$@" $(pwd) readonly done $(pwd)
+	awk awk "$@" | "$1" | | "$@" cd done echo
+		&& sed && | then grep "$1" printf done sed | 2>/dev/null ${HOME} | then
+awk && export then echo cd grep 'quoted text' && then $(pwd) $(pwd)
+then export x=1 sed awk ${HOME}
+sed ${HOME} $(pwd) test echo && "$1" readonly 'quoted text' "$1" --verbose
+	cd -eu sed && /usr/bin --verbose 2>/dev/null then echo echo /usr/bin 'quoted text'
+		grep test 2>/dev/null echo "$@" cd test echo x=1 cd awk ${HOME}
+&& cd export "$@" printf readonly readonly 'quoted text' $(pwd) local 'quoted text'
+	'quoted text' -eu /usr/bin --verbose "$1" 'quoted text' sed
+	/usr/bin -eu done x=1 "$@" local && 'quoted text' /usr/bin cd local 2>/dev/null
+	"$@" export --verbose -eu $(pwd) grep readonly | "$1" ${HOME}
+		cd done grep then grep "$@" awk
+echo 2>/dev/null && readonly grep "$@" sed printf -eu export
+		"$1" local "$@" printf awk -eu -eu ${HOME}
+		sed $(pwd) && 'quoted text' readonly "$@" "$@" done
+		2>/dev/null 2>/dev/null local grep && /usr/bin grep | -eu
+		--verbose --verbose printf
+	export readonly readonly readonly test
+		--verbose "$@" && echo printf "$@" export grep --verbose ${HOME} "$1"
+		cd --verbose cd then "$@" printf
+	awk sed -eu readonly x=1 -eu awk cd then ${HOME} ${HOME} awk x=1 cd test
+		printf 'quoted text' test local test x=1 -eu local cd export then x=1 grep
+	"$1" test -eu printf x=1 /usr/bin
+	grep 'quoted text' readonly
+awk cd done grep awk "$@" 2>/dev/null --verbose 'quoted text'
+"$1" sed --verbose && /usr/bin $(pwd) ${HOME} /usr/bin
+	--verbose then "$1" done /usr/bin awk
+	| printf awk "$1" awk then test /usr/bin readonly
+readonly local | local export "$1"
+	"$@" && awk grep -eu cd | export grep "$@" grep echo
+		--verbose grep "$1" /usr/bin echo sed test
+		${HOME} 'quoted text' echo done printf awk export -eu
+	2>/dev/null grep grep "$@" echo local -eu echo x=1 /usr/bin
+		'quoted text' awk --verbose local x=1 then
+	done then local sed x=1 local
+		x=1 "$@" 'quoted text' echo cd sed export sed 'quoted text' $(pwd)
+cd 'quoted text' cd readonly printf cd test readonly
+printf 'quoted text' /usr/bin ${HOME} "$1" -eu grep "$1" printf local 'quoted text'
+	2>/dev/null echo readonly then
+	--verbose then then | 2>/dev/null cd "$@" 2>/dev/null && grep x=1 done
+&& cd $(pwd) -eu "$1" test /usr/bin cd export then export 2>/dev/null
+local grep $(pwd) local local printf 'quoted text' printf x=1 x=1 2>/dev/null "$1"
+		-eu -eu grep printf x=1 -eu local local --verbose
+awk && grep grep grep $(pwd) then export
+export awk done printf --verbose -eu then ${HOME}
+echo done cd $(pwd) export $(pwd) ${HOME} "$1" x=1 local 'quoted text' -eu grep
+awk 2>/dev/null --verbose then sed export
+		x=1 "$1" && x=1 | --verbose ${HOME} 'quoted text' 2>/dev/null
+"$@" --verbose done then 2>/dev/null | printf export test local cd | cd --verbose
+cd --verbose echo | 2>/dev/null 'quoted text' awk && | && --verbose --verbose
+	| 'quoted text' done 'quoted text' $(pwd)
+"$1" awk "$@" "$1" --verbose
+	x=1 done "$@" x=1 ${HOME} 'quoted text' grep echo 'quoted text'
+		'quoted text' echo &&
+		$(pwd) grep test $(pwd) $(pwd) readonly awk sed
+sed 2>/dev/null x=1 done x=1 export && 'quoted text' | sed && readonly done
+		$(pwd) --verbose local /usr/bin echo echo cd 2>/dev/null
+	done readonly x=1 cd done /usr/bin "$@" readonly then then $(pwd) 2>/dev/null
+		&& x=1 && echo grep export x=1 echo test readonly
+&& "$1" /usr/bin readonly ${HOME} then
+	-eu x=1 then | x=1 "$1" -eu ${HOME} echo 'quoted text' --verbose
+"$1" && ${HOME} local | cd $(pwd) && -eu echo x=1 printf cd ${HOME}
+		test 'quoted text' "$@" sed && readonly && readonly /usr/bin then
+		test cd /usr/bin grep 'quoted text' grep export "$@" | &&
+	sed grep sed test | "$@" $(pwd) "$@" done readonly
+		'quoted text' && sed readonly
+		local echo 2>/dev/null ${HOME} done 'quoted text' /usr/bin
+	export "$@" ${HOME} awk "$1" && -eu 2>/dev/null
+		printf $(pwd) 'quoted text'
+readonly | ${HOME} echo then echo done awk x=1 "$1" "$1"
+		sed printf awk cd done | 'quoted text' grep -eu -eu x=1 sed then x=1 -eu
+	$(pwd) readonly awk x=1 local
+	-eu $(pwd) sed | --verbose sed cd awk /usr/bin then 'quoted text'
+		"$@" -eu local export && printf printf
+		${HOME} test done readonly export echo /usr/bin --verbose sed done printf
+		awk ${HOME} sed -eu 2>/dev/null cd && "$1"
+"$@" sed sed export then -eu readonly awk /usr/bin "$@" 2>/dev/null
+	then export --verbose 'quoted text'
+&& echo -eu awk x=1 | --verbose
+		"$1" export x=1 printf
+	local export echo "$@" "$@" && local && echo "$@" $(pwd)
+		'quoted text' printf grep awk test $(pwd) | /usr/bin awk -eu then test
+	grep local local "$@" export -eu awk $(pwd)
+		readonly --verbose "$@" grep grep $(pwd) grep awk --verbose x=1 'quoted text'
+		2>/dev/null | test then 2>/dev/null
+$(pwd) --verbose && --verbose ${HOME} 2>/dev/null &&
+		x=1 export export then /usr/bin "$1" -eu
+echo sed then test printf -eu awk sed local | --verbose ${HOME} "$@" echo readonly
+		2>/dev/null -eu | /usr/bin printf -eu sed cd echo grep local 'quoted text'
+grep --verbose "$@" done echo 2>/dev/null --verbose /usr/bin $(pwd) "$@" -eu sed
+	--verbose readonly test sed x=1 echo -eu 'quoted text' sed /usr/bin
+		echo x=1 export $(pwd) $(pwd) cd then echo "$@" 2>/dev/null
+		/usr/bin "$@" printf local done test --verbose 2>/dev/null awk awk 2>/dev/null
+	"$1" 'quoted text' test test 2>/dev/null x=1 export local /usr/bin | "$@"
+	echo | sed cd local ${HOME} && echo printf grep done echo 'quoted text' cd printf
+"$1" /usr/bin | x=1 -eu | 2>/dev/null
+grep $(pwd) "$@" --verbose grep grep cd "$@" $(pwd)
+grep | | done $(pwd) "$1" x=1 awk ${HOME}
+	local export grep grep /usr/bin
+	x=1 echo x=1 --verbose readonly
+	cd sed $(pwd) readonly && $(pwd) | | sed grep printf "$@" |
+export done 'quoted text' ${HOME}
+		"$@" 'quoted text' test x=1 $(pwd) echo
+	2>/dev/null 2>/dev/null done "$@" sed then done 2>/dev/null printf awk
+export awk printf test readonly $(pwd) && 2>/dev/null
+$(pwd) "$1" "$@" export done "$@" grep 'quoted text' $(pwd) export
+"$@" grep export "$1" export export --verbose "$@"
+	$(pwd) ${HOME} printf export && printf export --verbose
+	x=1 export -eu test $(pwd) 2>/dev/null sed $(pwd) --verbose "$1"
+"$@" echo local local $(pwd) done awk export sed then "$1" then printf cd
+cd local --verbose grep x=1 test "$@" echo
+	| | 2>/dev/null && /usr/bin -eu ${HOME} echo |
+-eu "$@" echo cd --verbose -eu test done --verbose export
+	--verbose test $(pwd) ${HOME} 'quoted text' /usr/bin
+	--verbose $(pwd) | ${HOME} test /usr/bin
+	/usr/bin cd local then && x=1 test | sed ${HOME} 'quoted text' local "$@"
+		x=1 x=1 then printf readonly x=1 $(pwd) readonly local
+then 2>/dev/null readonly $(pwd) ${HOME}
+		test /usr/bin $(pwd) $(pwd) && -eu && "$@" x=1 printf done cd 'quoted text'
+		'quoted text' "$@" done x=1 && sed cd echo -eu --verbose 'quoted text' then then
+done "$@" sed printf 'quoted text' export --verbose
+"$@" done readonly export x=1 done done cd readonly then -eu
+	cd printf grep echo then "$@" 'quoted text' -eu --verbose | -eu sed ${HOME} awk
+	export && 2>/dev/null echo done sed local
+x=1 x=1 "$@" cd "$@" local 'quoted text'
+cd then /usr/bin -eu printf awk local export
+"$@" test "$@" -eu -eu $(pwd) awk local x=1
+		grep "$1" then done -eu
+		test awk grep x=1 x=1 2>/dev/null 'quoted text' ${HOME} echo
+x=1 test "$1" "$@" test
+		-eu done -eu "$1" /usr/bin cd test export local
+x=1 --verbose sed cd echo awk readonly "$1" export x=1 | echo 2>/dev/null
+sed | && 2>/dev/null --verbose
+	awk sed 2>/dev/null --verbose | test export "$1" echo echo
+		"$@" test grep 2>/dev/null then local test export
+		--verbose cd x=1 readonly cd $(pwd)
+awk done $(pwd) then then x=1
+		/usr/bin 2>/dev/null export /usr/bin $(pwd) 2>/dev/null test readonly ${HOME}
+${HOME} | && grep done grep done awk | "$1" && -eu readonly "$@" -eu
+		'quoted text' -eu | 'quoted text' cd done -eu local | "$1" && then
+		--verbose 2>/dev/null "$1" "$@" readonly x=1 -eu --verbose readonly
+		export "$@" grep then --verbose printf /usr/bin -eu echo | done 'quoted text'
+		then grep && "$@" x=1 ${HOME} 'quoted text' sed readonly ${HOME} then
+		then awk sed sed --verbose
+${HOME} done done then export echo --verbose -eu local cd printf 'quoted text'
+	sed local awk readonly x=1 done x=1 | sed $(pwd) done readonly local echo
+		readonly "$@" awk ${HOME} then x=1
+		-eu ${HOME} 2>/dev/null readonly awk 'quoted text' -eu done 'quoted text' local
+then echo readonly then "$@" then | && sed awk | readonly readonly
+	grep "$1" 'quoted text' test awk 'quoted text'
+	"$1" printf cd "$1" -eu local cd $(pwd) grep export echo echo sed
+	sed | cd done grep test cd "$1" test local && sed && x=1 ${HOME} grep
+		grep grep cd done printf ${HOME} $(pwd) cd done /usr/bin printf --verbose
+readonly $(pwd) printf $(pwd) 2>/dev/null "$1" echo && $(pwd)
+	-eu -eu echo awk $(pwd) /usr/bin && local then readonly $(pwd) $(pwd) printf --verbose
+	sed x=1 ${HOME} done -eu local export grep $(pwd) local grep
+	cd done sed 2>/dev/null sed $(pwd)
+cd printf "$@" cd && grep | ${HOME} 'quoted text' echo 2>/dev/null /usr/bin
+/usr/bin && "$1" cd printf 2>/dev/null readonly
+		echo | export readonly $(pwd) x=1 cd done export
+	printf "$1" then test x=1 -eu awk
+		${HOME} sed ${HOME} then && x=1 /usr/bin | test 2>/dev/null 'quoted text'
+		x=1 $(pwd) "$@" readonly && cd x=1 | /usr/bin sed ${HOME}
+	"$@" printf then done readonly ${HOME} -eu && printf printf export
+	/usr/bin sed then --verbose readonly ${HOME} awk export
+2>/dev/null /usr/bin
+	"$@" | local ${HOME} done "$1" "$1" sed done cd grep | echo
+echo 2>/dev/null $(pwd) /usr/bin
+	awk | 'quoted text' printf local awk done /usr/bin export "$@" echo /usr/bin 'quoted text'
+local test 'quoted text' 2>/dev/null export $(pwd) 'quoted text'
+--verbose cd --verbose
+	local && grep sed && "$@" readonly then ${HOME} grep 2>/dev/null /usr/bin
+		/usr/bin awk cd cd -eu 'quoted text' "$1" export
+	cd "$@" readonly /usr/bin
+then | test then "$1" &&
+		x=1 local grep "$@" --verbose | 2>/dev/null && export ${HOME} readonly
+	readonly printf ${HOME} test then x=1 grep grep 'quoted text'
+	| readonly then 2>/dev/null printf cd awk 2>/dev/null
+readonly $(pwd) 'quoted text' "$1" test "$@" sed
+	test ${HOME} printf --verbose "$1" 2>/dev/null printf
+	test 'quoted text' printf -eu then
+		'quoted text' 'quoted text' "$@"
+		'quoted text' grep readonly local --verbose && readonly && test
+	| $(pwd) 2>/dev/null awk test then export echo
+	-eu /usr/bin awk readonly /usr/bin && "$1"
+	'quoted text' sed grep local && ${HOME} test
+	"$1" cd /usr/bin echo grep /usr/bin test $(pwd) then /usr/bin grep ${HOME}
+		'quoted text' local --verbose awk echo grep test ${HOME} awk $(pwd) grep
+		${HOME} "$@" ${HOME} && cd "$@" printf cd /usr/bin
+done then done readonly echo -eu --verbose cd /usr/bin --verbose cd $(pwd) |
+		2>/dev/null -eu --verbose "$1" test /usr/bin
+done cd readonly cd "$@" "$@" /usr/bin $(pwd) then ${HOME} awk $(pwd) sed && 'quoted text'
+		test && local 'quoted text' 'quoted text' local 2>/dev/null local
+	readonly awk export done 'quoted text'
+grep /usr/bin readonly x=1 awk printf
+	"$1" echo grep grep local |
+		${HOME} cd local -eu then | $(pwd) then && | printf ${HOME} test "$@" test awk
+	/usr/bin export ${HOME} printf cd -eu ${HOME}
+	--verbose grep -eu export
+		grep "$@" && test cd cd | 'quoted text' test "$1" cd /usr/bin then | readonly
+	done /usr/bin test echo export cd
+then grep sed --verbose -eu 'quoted text' "$@" grep 'quoted text'
+		-eu "$1" /usr/bin readonly
+grep echo export "$@" "$@" 'quoted text' sed echo grep 'quoted text'
+		awk /usr/bin --verbose x=1 --verbose x=1 local cd test x=1 test test then
+		"$@" x=1 printf cd --verbose "$@" "$@" -eu | 2>/dev/null ${HOME}
+	-eu ${HOME} | -eu | echo -eu printf /usr/bin printf
+	echo ${HOME} 'quoted text' sed printf ${HOME} $(pwd)
+	${HOME} export grep /usr/bin printf printf export printf | -eu /usr/bin x=1
+	'quoted text' sed awk -eu --verbose 'quoted text' awk $(pwd) printf then
+	printf cd local 2>/dev/null && --verbose x=1 grep --verbose printf
+	done then then printf readonly /usr/bin
+'quoted text' grep then x=1 /usr/bin
+		--verbose cd sed /usr/bin sed "$1"
+export sed "$1" ${HOME} grep export --verbose
+		cd echo x=1 --verbose then done && x=1 sed done "$1" printf $(pwd)
+'quoted text' "$1" x=1 --verbose $(pwd) ${HOME} $(pwd) "$1"
+	"$1" ${HOME} awk awk sed echo echo test awk
+		awk --verbose "$@" awk 'quoted text'
+		printf then printf "$@" grep test echo "$1" then 'quoted text' local ${HOME} awk
+	-eu x=1 printf 'quoted text' 2>/dev/null 2>/dev/null "$1" sed done
+		-eu -eu sed echo 'quoted text' $(pwd)
+x=1 printf readonly ${HOME} x=1 awk -eu $(pwd) export printf --verbose
+grep cd done readonly then x=1 -eu export awk "$@" cd readonly && &&
+export export ${HOME} done && test then then x=1
+		&& --verbose 'quoted text' done "$@" /usr/bin -eu ${HOME} ${HOME} export "$1"
+	x=1 local | "$@" x=1 test awk sed $(pwd) x=1 readonly 'quoted text'
+	"$1" echo then "$@" -eu done | readonly
+		--verbose "$1" cd $(pwd) done awk
+		/usr/bin && sed test && awk local cd export readonly $(pwd)
+		$(pwd) x=1 2>/dev/null done x=1 "$1" cd 2>/dev/null
+2>/dev/null $(pwd) done test done /usr/bin "$1" export "$@" printf x=1 export &&
+sed readonly && test /usr/bin 2>/dev/null
+| | printf --verbose $(pwd) export ${HOME} readonly
+		--verbose 'quoted text' x=1 && --verbose sed -eu sed sed then done "$@"
+	printf "$1" 'quoted text' 2>/dev/null grep then test --verbose 'quoted text'
+	done sed | ${HOME} grep grep
+export local cd && export
+	grep awk sed test cd "$1"
+		awk done --verbose --verbose $(pwd) test readonly $(pwd) x=1
+		printf | readonly awk echo
+grep 2>/dev/null printf &&
+		'quoted text' readonly readonly "$1" | 'quoted text'
+	'quoted text' /usr/bin done cd "$@" echo "$@"
+		'quoted text' ${HOME} cd cd test "$1" echo export cd "$1" test test grep
+	then test "$@" printf ${HOME} echo
+printf $(pwd) && x=1 -eu |
+	"$@" $(pwd) then cd && ${HOME} && grep
+local sed sed awk /usr/bin printf export 'quoted text'
+		&& echo /usr/bin 2>/dev/null cd ${HOME} test then -eu -eu
+	cd export /usr/bin "$@" readonly test /usr/bin
+'quoted text' $(pwd) done --verbose done
+	cd ${HOME} readonly cd awk
+		sed /usr/bin readonly local then done export local /usr/bin local export
+		echo export grep readonly 'quoted text' test -eu readonly
+	local "$1" echo grep export printf awk
+awk x=1 --verbose ${HOME} -eu
+	| 'quoted text' awk 2>/dev/null "$@" -eu ${HOME}
+		sed "$1" sed sed done readonly /usr/bin ${HOME}
+	sed then awk -eu then | readonly echo 2>/dev/null && $(pwd)
+		awk "$@" | cd sed printf 'quoted text' printf x=1 grep /usr/bin local 2>/dev/null
+| done readonly | "$@" export x=1 test
+awk "$1" awk ${HOME} grep then 'quoted text'
+	export sed -eu ${HOME} /usr/bin
+	${HOME} sed "$1" then sed grep then readonly grep grep echo 2>/dev/null
+cd printf sed echo cd awk sed awk 2>/dev/null then then grep printf x=1 | readonly
+sed done 'quoted text' x=1 "$1" test test readonly printf x=1 readonly
+--verbose export printf --verbose --verbose grep x=1 sed --verbose
+	'quoted text' readonly x=1 $(pwd) --verbose ${HOME} -eu export "$@" -eu grep
+/usr/bin echo printf && "$@" 2>/dev/null sed 'quoted text' $(pwd)
+		readonly && 'quoted text' echo
+		printf "$1" done 2>/dev/null awk -eu then
+echo readonly cd | x=1 &&
+		printf local && local
+readonly ${HOME} printf echo sed printf x=1 then 2>/dev/null export $(pwd)
+	2>/dev/null readonly cd x=1
+		| done | local 'quoted text' export ${HOME} ${HOME} 2>/dev/null test
+readonly export sed export grep -eu awk echo printf test
+--verbose /usr/bin grep then local --verbose /usr/bin
+		printf echo 'quoted text' ${HOME} 2>/dev/null $(pwd) awk "$1"
+	awk -eu | && awk test sed "$1" 2>/dev/null sed awk local echo done sed /usr/bin
+done grep local test then local readonly readonly
+	export local export -eu --verbose /usr/bin local /usr/bin | -eu -eu readonly
+		'quoted text' -eu $(pwd) readonly
+"$@" x=1 grep && ${HOME} -eu done x=1 grep ${HOME} "$@" 'quoted text' --verbose
+		local "$1" "$@" sed sed 'quoted text' | export grep "$1"
+done ${HOME} done echo awk x=1 2>/dev/null
+		&& echo | -eu | awk 2>/dev/null --verbose ${HOME}
+	readonly grep echo ${HOME} awk 'quoted text'
+		--verbose | x=1 x=1 2>/dev/null
+printf ${HOME} then x=1 sed | then 2>/dev/null 2>/dev/null export sed |
+	sed echo "$1" ${HOME} test && local
+		${HOME} sed --verbose awk cd done x=1 sed test "$@" "$1" /usr/bin done sed then
+	x=1 export "$1" then test readonly | --verbose | /usr/bin
+		then /usr/bin awk ${HOME} && 2>/dev/null grep 'quoted text' grep 2>/dev/null
+	echo then 'quoted text' ${HOME} readonly then readonly
+	export grep done /usr/bin /usr/bin awk $(pwd) echo | $(pwd) && 2>/dev/null
+		printf && 2>/dev/null echo cd --verbose
+		echo export readonly 'quoted text'
+	grep export && echo echo $(pwd) grep 2>/dev/null x=1 'quoted text' 'quoted text'
+		done export -eu awk cd
+		&& awk | -eu awk local x=1 done x=1 ${HOME}
+--verbose grep x=1 "$@" printf then 'quoted text'
+	2>/dev/null printf test x=1 local && /usr/bin then local test $(pwd)
+"$1" done --verbose export ${HOME} printf local && test && && local readonly
+		grep 'quoted text' cd ${HOME}
+		printf --verbose local cd sed x=1 "$@" -eu printf "$@" local
+&& export awk $(pwd) cd "$1" test x=1 'quoted text' --verbose then -eu "$@" printf
+-eu awk -eu --verbose --verbose 2>/dev/null then ${HOME}
+/usr/bin readonly echo | grep 2>/dev/null readonly test 2>/dev/null
+printf cd sed /usr/bin x=1 $(pwd) grep printf "$1" printf done 2>/dev/null -eu
+		$(pwd) readonly $(pwd) printf "$1" local printf "$@" 2>/dev/null done
+		done awk printf export $(pwd) sed export
+		$(pwd) "$1" cd test test readonly
+		sed && cd export "$@" ${HOME} grep export && local sed "$1" then then x=1
+		2>/dev/null | x=1 done "$@"
+	test -eu && then cd sed printf echo then "$@" sed |
+"$1" 2>/dev/null test 'quoted text'
+	${HOME} awk test cd test -eu done done export 2>/dev/null
+	x=1 | -eu | $(pwd) echo readonly &&
+grep test -eu 'quoted text'
+		done readonly -eu --verbose
+'quoted text' -eu local echo cd awk $(pwd)
+		echo $(pwd) 2>/dev/null readonly readonly awk test cd local sed /usr/bin cd
+		export export 2>/dev/null 'quoted text' grep ${HOME} 'quoted text' readonly echo
+	done sed $(pwd) && -eu grep
+	2>/dev/null /usr/bin sed x=1 test "$@" grep "$@" printf echo
+	awk -eu readonly && sed "$@" printf awk | echo cd echo
+	done sed "$1" | 'quoted text'
+		test printf then cd then export local ${HOME} -eu echo awk 'quoted text'
+	readonly sed printf local
+		sed ${HOME} cd done "$@" printf export -eu printf -eu then --verbose echo 'quoted text'
+		export --verbose grep awk "$1" done export -eu 'quoted text'
+	&& cd cd /usr/bin -eu --verbose | grep | -eu echo -eu "$@" cd sed
+	"$@" local sed grep printf -eu test 2>/dev/null 2>/dev/null /usr/bin sed $(pwd)
+	/usr/bin ${HOME} printf sed 2>/dev/null && && done printf printf
+		local then /usr/bin export grep 'quoted text' then /usr/bin /usr/bin --verbose
+then export --verbose "$1" echo --verbose cd echo | 2>/dev/null
+${HOME} -eu cd x=1 $(pwd) awk -eu &&
+	| test awk export "$@" test grep | "$@" local "$@" test done -eu
+	echo --verbose | test ${HOME} done
+	test echo "$@" /usr/bin --verbose "$@"
+	local done awk --verbose local /usr/bin cd x=1 && "$1" done awk
+	--verbose sed -eu grep local /usr/bin echo cd then
+		| | export grep done $(pwd) ${HOME} x=1 ${HOME} | --verbose
+	&& && awk x=1 ${HOME} && echo 2>/dev/null 2>/dev/null "$@" export
+done "$1" -eu printf $(pwd) $(pwd) "$1" grep && /usr/bin
+		x=1 $(pwd) x=1 printf "$1" "$1" then readonly local cd 2>/dev/null x=1 "$1"
+	grep local x=1 test 2>/dev/null done cd x=1 then then echo "$@" /usr/bin
+export | export export | readonly sed -eu -eu $(pwd) /usr/bin &&
+	'quoted text' 2>/dev/null echo /usr/bin 'quoted text' 2>/dev/null ${HOME}
+		"$@" export export $(pwd) ${HOME} "$@"
+cd echo cd $(pwd) export --verbose 2>/dev/null echo ${HOME}
+		--verbose then then then --verbose printf
+	${HOME} echo | | sed local awk printf /usr/bin
+x=1 2>/dev/null local awk "$1" printf then --verbose /usr/bin
+		"$1" readonly awk /usr/bin $(pwd) ${HOME} 'quoted text' --verbose
+		"$1" test && then then
+		test 2>/dev/null ${HOME} x=1 "$1"
+--verbose ${HOME} awk x=1 printf grep && printf local local then readonly
+x=1 x=1 'quoted text' grep cd export export echo /usr/bin
+	cd 'quoted text' 2>/dev/null local && /usr/bin && x=1 && test $(pwd) /usr/bin
+		/usr/bin sed cd --verbose echo
+		2>/dev/null then then && --verbose "$1" "$1" | && echo then ${HOME}
+		readonly && done readonly --verbose "$@" local x=1 2>/dev/null cd
+	local && sed "$@" "$@" "$1" 'quoted text' -eu then local &&
+	&& sed 'quoted text' -eu --verbose readonly
+	--verbose 2>/dev/null export printf
+		--verbose done | export --verbose ${HOME}
+	&& 'quoted text' export sed grep echo ${HOME} 'quoted text' sed
+2>/dev/null /usr/bin "$@" && && 'quoted text' ${HOME} awk && "$1" readonly readonly
+		| -eu local /usr/bin $(pwd) && sed test 2>/dev/null | $(pwd)
+	printf done cd sed $(pwd) |
+		grep awk done test cd /usr/bin | -eu export "$1" -eu export then 2>/dev/null cd
+then test /usr/bin export "$@" | 2>/dev/null awk ${HOME}
+local 'quoted text' && ${HOME} $(pwd) "$@" grep sed 'quoted text'
+		sed --verbose /usr/bin &&
+'quoted text' --verbose echo && | sed export echo
+grep readonly | then $(pwd) printf "$@" echo "$1" export --verbose
+	| -eu 'quoted text' sed 'quoted text' awk grep ${HOME} done local printf
+	then local test /usr/bin awk done
+	done /usr/bin 'quoted text' test then x=1 && readonly
+"$1" readonly sed && export x=1 ${HOME}
+	'quoted text' 'quoted text' printf ${HOME} done export done && "$@" local /usr/bin
+"$1" --verbose | 2>/dev/null sed "$1" 2>/dev/null | done "$@" ${HOME} 2>/dev/null
+-eu 2>/dev/null ${HOME} echo | 'quoted text'
+	readonly $(pwd) "$1" |
+		grep "$1" && printf "$@" awk $(pwd) grep then 2>/dev/null
+		printf sed export printf echo readonly --verbose
+2>/dev/null echo | done awk printf 2>/dev/null
+| $(pwd) $(pwd) ${HOME} readonly -eu x=1 "$1" printf grep
+2>/dev/null sed readonly done
+		local readonly x=1 cd awk
+	2>/dev/null 'quoted text'
+&& cd echo $(pwd) printf sed |
+"$@" "$1" awk "$1" then printf echo
+cd printf --verbose done 2>/dev/null
+	local awk test cd 2>/dev/null ${HOME}
+x=1 -eu then done ${HOME} printf done 'quoted text'
+printf done cd export readonly printf "$@"
+'quoted text' local then echo | local /usr/bin export --verbose ${HOME}
+--verbose cd cd echo $(pwd) "$1" readonly
+		echo test $(pwd) awk test grep $(pwd) test done
+then -eu printf x=1 2>/dev/null "$1" echo 2>/dev/null 2>/dev/null && awk
+x=1 --verbose cd "$@" echo then
+	cd local && echo awk "$1" ${HOME}
+${HOME} test then ${HOME} done local done "$@" $(pwd) then /usr/bin
+		grep "$1" x=1 -eu && "$@" 'quoted text' sed
+| printf sed /usr/bin awk "$@" grep -eu --verbose export "$@" readonly sed -eu
+cd echo awk readonly echo awk 'quoted text'
+		--verbose readonly 'quoted text' /usr/bin sed x=1 --verbose x=1
+test export x=1 | cd x=1 grep | sed 2>/dev/null | export then cd
+		$(pwd) done local echo printf x=1 "$@" ${HOME}
+	then awk export /usr/bin "$@" cd printf 'quoted text'
+printf | /usr/bin --verbose 2>/dev/null
+	"$@" x=1 'quoted text' x=1 local -eu
+	test ${HOME} ${HOME} printf sed sed awk echo &&
+	test $(pwd) "$1" local
+	"$@" "$@" | 2>/dev/null -eu export test "$@" 'quoted text'
+| test sed echo export sed 'quoted text' $(pwd) grep grep x=1
+		/usr/bin sed printf awk ${HOME} test echo "$1" | &&
+		$(pwd) done done printf
+	--verbose -eu $(pwd) | then -eu done -eu grep "$1" local sed
+awk /usr/bin test done "$1" && -eu echo
+		awk awk export cd /usr/bin "$1" awk $(pwd) /usr/bin sed then x=1 $(pwd)
+		/usr/bin echo local ${HOME} readonly x=1 grep cd cd awk
+		x=1 grep sed $(pwd) cd && "$1" -eu sed 'quoted text' local | cd 2>/dev/null sed
+	"$@" $(pwd) 'quoted text' awk echo cd local
+done 2>/dev/null -eu echo -eu ${HOME} export
+$(pwd) 2>/dev/null | && $(pwd) "$@" readonly
+$(pwd) readonly $(pwd) then "$@" local export x=1 printf
+readonly x=1 readonly readonly x=1 $(pwd)
+		printf sed then grep cd "$1" 2>/dev/null then grep && printf
+x=1 'quoted text' awk --verbose --verbose cd done && "$1" then
+done local /usr/bin export ${HOME}
+| then "$1" x=1 printf echo grep printf
+		$(pwd) readonly "$1" && awk grep export done | done ${HOME}
+	local awk readonly local local
+	cd readonly "$1" && "$@" -eu ${HOME} echo -eu done && sed
+		echo /usr/bin cd 'quoted text' readonly test printf then done ${HOME}
+		/usr/bin echo 2>/dev/null test cd 2>/dev/null test test /usr/bin
+		export test echo x=1
+	$(pwd) sed cd grep local --verbose | awk | then /usr/bin "$1"
+	&& -eu --verbose x=1 grep | export then /usr/bin ${HOME} grep sed done sed "$1"
+		echo x=1 x=1 "$@" --verbose 'quoted text' x=1 printf 'quoted text' "$1" awk
+	test | --verbose grep /usr/bin sed && grep local 'quoted text'
+then printf $(pwd) echo
+		"$@" test "$@" | | 'quoted text' -eu sed done -eu
+x=1 test 'quoted text' then && "$1" 'quoted text'
+printf local | done -eu done | 'quoted text' local && x=1 then ${HOME} cd
+	'quoted text' x=1 x=1 awk | $(pwd) "$@" -eu awk
+	export -eu "$@" local grep -eu
+		$(pwd) test printf awk echo "$1" sed x=1 readonly echo x=1 local
+printf 'quoted text' printf "$1" sed /usr/bin && ${HOME} "$@"
+		sed sed -eu --verbose 2>/dev/null -eu 2>/dev/null
+	2>/dev/null 'quoted text' x=1 'quoted text' done 2>/dev/null
+		'quoted text' /usr/bin readonly test grep readonly --verbose
+--verbose 2>/dev/null sed --verbose printf then readonly sed x=1 awk grep
+		grep printf printf /usr/bin
+	/usr/bin test -eu then local --verbose "$1"
+grep test -eu | "$@" $(pwd)
+		| "$@" sed && 2>/dev/null grep | /usr/bin awk && awk
+echo export echo awk | readonly
+		export then "$@" "$@" test ${HOME} test && printf | readonly awk "$@" 2>/dev/null
+	"$@" ${HOME} echo printf $(pwd) x=1 -eu x=1 test readonly
+	then test export --verbose -eu done 2>/dev/null /usr/bin
+/usr/bin readonly 'quoted text' readonly
+2>/dev/null cd export
+	awk 2>/dev/null 'quoted text' "$1" 'quoted text'
+	cd done | cd "$1" awk sed readonly grep -eu awk
+grep sed 'quoted text' -eu printf done done sed sed test "$1" local
+		printf 2>/dev/null --verbose "$1" /usr/bin awk 2>/dev/null
+&& grep cd grep --verbose export ${HOME}
+		"$1" awk printf printf ${HOME}
+--verbose echo readonly --verbose
+grep | cd sed $(pwd) cd
+	$(pwd) | export ${HOME} /usr/bin x=1 ${HOME}
+	sed awk "$1" test echo && ${HOME} done && echo then sed cd "$@" readonly
+echo printf ${HOME} |
+	awk && /usr/bin ${HOME} test done done sed x=1 sed
+		grep printf | "$@" done x=1 && 2>/dev/null then local grep done x=1 /usr/bin
+	then "$1" test ${HOME} echo 2>/dev/null
+	test 2>/dev/null 2>/dev/null echo then && --verbose && "$@" test /usr/bin --verbose
+| sed printf $(pwd) done x=1 "$1" test readonly
+	export test ${HOME} printf awk sed 'quoted text'
+${HOME} then printf readonly --verbose readonly local awk 'quoted text' cd export
+	echo printf done local 2>/dev/null cd test | /usr/bin
+	awk readonly export cd then echo local
+	echo && 'quoted text' grep "$@" test 2>/dev/null -eu export $(pwd) 'quoted text'
+		$(pwd) $(pwd) readonly readonly done
+		sed grep $(pwd) x=1 done
+		sed sed echo done && ${HOME} "$@" ${HOME} cd grep then readonly
+echo /usr/bin export local 'quoted text' test cd export
+		&& -eu "$@" sed x=1 "$@" test cd printf | "$1" && then | awk
+	then export ${HOME} done readonly grep /usr/bin && "$1"
+		'quoted text' local "$@" $(pwd) then $(pwd) awk test cd
+printf echo echo then -eu "$@" ${HOME}
+x=1 readonly 2>/dev/null && | -eu && grep -eu echo --verbose
+	2>/dev/null "$1" awk x=1 -eu grep
+		-eu sed --verbose /usr/bin "$@" cd "$1" grep sed
+	local awk grep done --verbose /usr/bin /usr/bin x=1 x=1 'quoted text' test grep
+		x=1 echo printf ${HOME} awk "$@" x=1 printf 2>/dev/null 2>/dev/null
+	printf grep then local echo --verbose "$@" && x=1 2>/dev/null export done
+done awk 'quoted text' -eu readonly "$1" "$@" x=1 cd 'quoted text' readonly
+		'quoted text' grep local ${HOME} "$1" "$@" "$1"
+		2>/dev/null 2>/dev/null $(pwd) ${HOME} cd ${HOME} | --verbose cd readonly
+	"$1" x=1 ${HOME} test "$@" x=1 test awk local -eu
+	cd sed export && "$1" awk --verbose "$@" done local then done
+	local awk "$@" test sed "$1" --verbose ${HOME} x=1 /usr/bin "$@" then
+	"$1" | grep local done /usr/bin | && sed then ${HOME} ${HOME} awk | sed local
+	cd -eu grep "$1" then then 'quoted text' export
+	-eu --verbose local $(pwd) sed 2>/dev/null done
+		'quoted text' readonly echo && cd printf
+		"$@" && x=1 -eu ${HOME} | | $(pwd) "$1" awk echo ${HOME} cd printf x=1 && 'quoted text'
+	"$@" 'quoted text' "$1" x=1 "$@" then 2>/dev/null --verbose
+		awk /usr/bin printf 'quoted text' "$1" /usr/bin
+		echo && && 2>/dev/null "$1" -eu 2>/dev/null "$1"
+then && test sed ${HOME} echo export
+	printf sed "$1" "$@" then cd awk 'quoted text' echo test
+		-eu --verbose 2>/dev/null /usr/bin -eu done local "$@" sed
+		export 'quoted text' ${HOME} $(pwd)
+		"$1" -eu x=1 -eu ${HOME} done 'quoted text'
+	grep local printf test echo 2>/dev/null export 'quoted text' then
+		then echo readonly ${HOME} echo sed "$1" | $(pwd) 2>/dev/null
+	export awk 2>/dev/null | /usr/bin test
+	-eu /usr/bin $(pwd) -eu done sed /usr/bin -eu 'quoted text' awk grep
+	"$@" then /usr/bin cd "$1" echo echo "$1" -eu
+	export | export done ${HOME} $(pwd) "$@" /usr/bin && --verbose &&
+		| export x=1 done done --verbose x=1 $(pwd) ${HOME}
+local ${HOME} local -eu | then readonly 2>/dev/null cd /usr/bin done 2>/dev/null
+"$@" x=1 export done --verbose
+printf test x=1 --verbose "$1" "$1" &&
+		test cd cd ${HOME} "$@" 'quoted text'
+	printf printf -eu /usr/bin
+		sed then awk "$1" 2>/dev/null printf local local
+	| x=1 -eu done "$1" "$1" x=1 ${HOME} export sed echo
+		cd x=1 then test "$@" echo readonly export sed test
+	&& local "$@" sed --verbose x=1 done ${HOME} export cd
+		echo x=1 --verbose "$@"
+	-eu "$1" printf echo "$@" printf | -eu ${HOME} then awk export
+-eu | "$1" local "$@" $(pwd)
+| awk ${HOME} /usr/bin echo grep 2>/dev/null /usr/bin | readonly --verbose
+${HOME} then --verbose awk | export then test
+	printf 'quoted text' cd done "$@" /usr/bin awk 'quoted text'
+sed export /usr/bin test cd $(pwd) | $(pwd) -eu && "$1"
+	${HOME} -eu then /usr/bin sed readonly | && 'quoted text' x=1 x=1 test
+	local local --verbose done "$@" $(pwd) echo 'quoted text'
+	--verbose then $(pwd) x=1 --verbose $(pwd) $(pwd) awk
+sed 'quoted text' 2>/dev/null printf
+sed sed printf "$1" "$@"
+		x=1 grep --verbose "$1" x=1 "$@" cd 'quoted text' readonly &&
+	2>/dev/null printf -eu
+-eu 2>/dev/null test printf done then local 'quoted text' --verbose
+	x=1 test && echo printf $(pwd) --verbose && export --verbose then -eu export
+		grep 'quoted text' awk && "$1" export $(pwd) test && -eu "$1" echo then 2>/dev/null
+	readonly cd /usr/bin ${HOME} then
+	grep printf readonly ${HOME} test && 2>/dev/null
+		$(pwd) --verbose | --verbose ${HOME} awk done local echo done /usr/bin
+	local "$@" grep readonly local echo echo done
+	awk grep done cd "$@" export -eu --verbose "$1" x=1 cd grep test "$1" /usr/bin
+		readonly | "$1" 2>/dev/null -eu --verbose
+	/usr/bin awk readonly /usr/bin | x=1 printf x=1
+done then local echo test local sed awk x=1 | x=1 test --verbose -eu sed local
+	"$1" --verbose sed local --verbose "$@" --verbose "$1" done echo ${HOME}
+		echo "$@" printf "$1" printf awk
+		'quoted text' "$1" local cd readonly /usr/bin local $(pwd) grep "$@" x=1
+		local --verbose ${HOME} --verbose test /usr/bin test | "$@"
+export $(pwd) test --verbose printf then
+test /usr/bin x=1 --verbose awk grep then test --verbose
+	then "$1" awk "$1" --verbose then printf cd done | awk
+	-eu then readonly x=1 | --verbose echo /usr/bin "$1" -eu readonly | --verbose
+local cd awk printf --verbose x=1 then "$1"
+$(pwd) test -eu local sed
+	$(pwd) grep 'quoted text' /usr/bin "$@" test x=1 grep sed
+local readonly -eu readonly export 'quoted text' 'quoted text' sed
+	awk test && "$1" "$1" done -eu x=1 | "$1" awk grep "$@" printf then
+'quoted text' /usr/bin -eu $(pwd) && readonly
+then export --verbose ${HOME} awk grep 'quoted text' printf awk ${HOME} local
+		printf "$@" /usr/bin 2>/dev/null 'quoted text'
+'quoted text' cd then && && cd ${HOME} $(pwd) && echo
+	"$@" cd --verbose export cd "$1" 'quoted text' && done
+	x=1 then $(pwd) /usr/bin "$@" awk
+		$(pwd) -eu echo export 2>/dev/null "$@" "$1" x=1 /usr/bin
+2>/dev/null $(pwd) /usr/bin --verbose ${HOME} $(pwd) 2>/dev/null echo readonly
+		grep 'quoted text' awk local
+	'quoted text' $(pwd) 2>/dev/null /usr/bin 2>/dev/null 2>/dev/null
+cd grep ${HOME} printf "$@" $(pwd) 'quoted text' local test then sed awk
+${HOME} done "$@" 'quoted text'
+then printf x=1 printf export --verbose
+echo grep done "$1" | "$@" done "$1" grep 2>/dev/null sed
+printf 'quoted text' done 'quoted text' 2>/dev/null
+echo local "$1" --verbose 2>/dev/null
+		awk then test test 'quoted text' "$1" cd readonly
+done echo done "$@" sed then test $(pwd) "$@" "$1" cd x=1 test ${HOME} then then
+"$@" cd "$1" local readonly --verbose x=1 $(pwd) test then /usr/bin
+	| $(pwd) 2>/dev/null | awk test readonly
+printf ${HOME} printf && x=1 readonly "$1" cd --verbose "$1" readonly cd readonly
+${HOME} && grep awk --verbose test ${HOME} "$1" grep then printf -eu echo
+	done echo grep --verbose readonly $(pwd) printf readonly echo "$1"
+		printf --verbose x=1 sed ${HOME} x=1 printf echo export then
+${HOME} local "$1" readonly then $(pwd) "$1" printf awk && readonly "$@" --verbose
+	local | awk ${HOME} "$1" ${HOME} export cd local awk export $(pwd) "$1" then
+then test cd $(pwd) -eu "$@" sed export
+	/usr/bin ${HOME} | printf "$@" then "$@" awk printf awk "$@" cd && printf
+	--verbose x=1 x=1 x=1 x=1 ${HOME} ${HOME} local sed grep awk cd sed /usr/bin
+-eu export readonly export test local --verbose sed awk then && --verbose 'quoted text'
+cd ${HOME} x=1 "$1" readonly then grep sed then ${HOME}
+	local awk cd "$@" "$1" then | | export printf "$1"
+	cd echo sed /usr/bin test printf
+		export grep | | test && sed grep test
+	test "$1" "$@" -eu && done "$@" --verbose cd $(pwd) &&
+	$(pwd) "$@" /usr/bin --verbose echo echo "$@" x=1 grep grep
+	| $(pwd) "$1" | awk sed grep && awk --verbose echo 2>/dev/null readonly
+	echo awk echo grep awk awk done local sed cd done cd | $(pwd) "$@" done
+readonly grep --verbose done readonly "$1" export sed "$1" -eu "$@" awk
+		printf local test then /usr/bin "$1" echo $(pwd) readonly
+&& /usr/bin 'quoted text' local ${HOME} export
+	"$@" printf awk grep grep done readonly then printf 'quoted text'
+		local printf && "$1" | /usr/bin "$1" sed local awk "$1" local x=1 done
+	sed /usr/bin awk done export then /usr/bin
+"$1" 'quoted text' --verbose echo | awk /usr/bin
+echo && -eu then /usr/bin 'quoted text' sed
+		printf done && awk 2>/dev/null $(pwd) cd test x=1 -eu 'quoted text'
+		&& test grep awk printf test ${HOME} export "$1"
+	--verbose | readonly && awk "$1" --verbose done && /usr/bin 'quoted text'
+		local ${HOME} local printf
+		2>/dev/null --verbose x=1 awk echo --verbose
+	readonly export x=1 grep 'quoted text' $(pwd) "$1" -eu
+	--verbose 2>/dev/null sed --verbose then ${HOME} ${HOME} 'quoted text' --verbose
+		printf done echo "$@" | printf "$1" && local
+	local cd x=1 2>/dev/null "$1" printf grep echo --verbose readonly --verbose
+	&& 2>/dev/null cd cd "$@" printf cd
+"$1" readonly "$@" ${HOME} readonly echo 2>/dev/null $(pwd) test sed
+		2>/dev/null grep -eu -eu grep cd sed echo readonly printf then
+awk export printf ${HOME} then && echo done /usr/bin -eu done done
+	"$1" 'quoted text' && then
+	/usr/bin then cd --verbose awk "$@" sed /usr/bin then | then 'quoted text'
+then 'quoted text' /usr/bin --verbose 2>/dev/null
+sed done && cd done --verbose "$1" done done && && cd cd
+readonly local 2>/dev/null "$1" sed awk awk 'quoted text' export then
+then awk /usr/bin then sed 'quoted text' x=1
+	| x=1 awk export 2>/dev/null echo export awk 2>/dev/null cd
+	readonly ${HOME} ${HOME} echo export "$1"
+	sed test grep && readonly done ${HOME} | x=1 readonly done echo export 2>/dev/null
+grep 'quoted text' | | grep --verbose grep export awk local cd && $(pwd) $(pwd)
+		printf sed 2>/dev/null sed test readonly -eu
+	echo 'quoted text' "$@" $(pwd) local && 2>/dev/null readonly && cd export $(pwd)
+		echo then 2>/dev/null /usr/bin "$1" "$@" sed $(pwd) | |
+	--verbose local -eu /usr/bin $(pwd) | /usr/bin 'quoted text'
+	${HOME} 'quoted text' done ${HOME} echo awk local 2>/dev/null "$1" --verbose
+		"$@" "$@" test printf 'quoted text' 2>/dev/null done local | grep cd /usr/bin
+		grep local cd -eu | --verbose -eu readonly readonly 'quoted text'
+	| sed then /usr/bin grep --verbose 'quoted text' awk $(pwd) printf awk
+	cd /usr/bin done export awk sed awk done
+	test grep | local 'quoted text' then
+		"$@" && export "$@" done x=1 /usr/bin
+		echo "$@" --verbose sed done --verbose
+		2>/dev/null awk readonly awk sed done 'quoted text' awk x=1 x=1 "$1" | -eu
+sed --verbose awk 'quoted text' cd then $(pwd) export 'quoted text' grep "$@" export
+	awk 'quoted text' x=1 export | local /usr/bin cd test export x=1 'quoted text'
+	test "$@" grep 2>/dev/null cd /usr/bin --verbose
+sed readonly then then -eu echo
+		"$@" cd $(pwd) "$@" sed
+		${HOME} readonly sed 2>/dev/null echo cd ${HOME} then printf "$1" local
+	$(pwd) sed local --verbose "$1" printf | grep echo 'quoted text'
+2>/dev/null x=1 "$1" awk | ${HOME} ${HOME} cd readonly "$@" "$1"
+--verbose -eu echo sed | "$@"
+	then done test grep "$@" export local then done printf sed sed then &&
+	2>/dev/null cd test "$@" | 2>/dev/null
+	| local "$@" readonly cd awk -eu /usr/bin
+then --verbose local 'quoted text' awk
+		echo "$1" -eu awk -eu readonly $(pwd) 'quoted text' printf
+	then 2>/dev/null 'quoted text' /usr/bin
+'quoted text' "$1" $(pwd) "$@" test
+		"$@" export "$@" 2>/dev/null grep then | awk awk readonly && /usr/bin
+		echo -eu cd export echo
+&& then printf sed ${HOME} printf 'quoted text' x=1 --verbose readonly 2>/dev/null
+-eu x=1 readonly 'quoted text' local
+printf ${HOME} x=1 local awk /usr/bin /usr/bin
+	cd "$1" echo printf |
+${HOME} && | local sed | then local x=1 awk
+	export | 2>/dev/null $(pwd)
+	cd readonly -eu 'quoted text' grep 2>/dev/null sed "$@" && grep
+		export done | 'quoted text' --verbose "$1" 'quoted text'
+		${HOME} then --verbose grep 'quoted text' then echo 2>/dev/null |
+	-eu done "$@" local export
+	readonly test test --verbose 2>/dev/null
+		sed cd /usr/bin /usr/bin "$1"
+2>/dev/null local grep local | echo
+x=1 sed then export -eu 2>/dev/null
+		local cd then sed done readonly x=1 x=1
+		printf $(pwd) /usr/bin export readonly grep
+/usr/bin then echo done && | 'quoted text' ${HOME} ${HOME} ${HOME} && "$1" |
+"$1" sed cd export then "$1" "$@" "$1" x=1 2>/dev/null readonly local echo sed
+	| done | --verbose 'quoted text' done
+		grep local --verbose | sed "$@" test --verbose test local awk "$@" echo
+printf test | printf printf "$1" ${HOME}
+		test then test local local $(pwd) x=1 then cd 'quoted text' sed 2>/dev/null
+		test -eu grep 2>/dev/null export sed then then "$1" test ${HOME} export test
+'quoted text' printf printf then $(pwd) x=1 ${HOME} cd 'quoted text' local "$@"
+		| printf sed -eu "$@" -eu "$1" 2>/dev/null 'quoted text' readonly export
+test test 2>/dev/null export printf grep x=1
+		awk ${HOME} readonly awk | ${HOME} done printf && export
+echo local x=1 awk then then
+local "$1" "$1" /usr/bin "$1" then cd local 'quoted text' readonly printf "$1"
+	grep "$@" grep $(pwd) | /usr/bin grep "$1" export "$@" readonly
+awk -eu "$1" | ${HOME} 'quoted text'
+		&& /usr/bin local awk ${HOME} 2>/dev/null export "$@" "$@" /usr/bin
+	done test x=1 x=1 'quoted text' sed x=1 cd
@@ -0,0 +1,2001 @@
+	"$@" cd readonly cd grep
+	x=1 "$@" | sed $(pwd) 2>/dev/null 'quoted text'
+done --verbose /usr/bin sed x=1
+		cd cd 2>/dev/null 'quoted text'
+2>/dev/null local echo then
+export grep done --verbose
+	awk && --verbose 'quoted text' grep /usr/bin sed grep "$@" --verbose "$1" export
+		local "$1" x=1 cd done "$@" $(pwd)
+| printf export awk done
+	export awk "$1" local x=1 ${HOME} done test 2>/dev/null "$@" export test
+/usr/bin x=1 echo export test $(pwd) then x=1 /usr/bin 2>/dev/null
+	"$@" --verbose cd echo test 'quoted text' done "$@" local x=1
+/usr/bin printf echo && readonly x=1 2>/dev/null
+		export test printf 'quoted text' export local cd 'quoted text'
+--verbose export ${HOME} $(pwd) /usr/bin
+/usr/bin test -eu ${HOME}
+		cd echo | | echo /usr/bin done grep /usr/bin sed 'quoted text'
+		export "$1" done "$@" cd $(pwd) 2>/dev/null
+	then x=1 export "$@" ${HOME} ${HOME} cd sed readonly -eu local
+export export 2>/dev/null awk then done
+test && && echo awk printf 'quoted text' cd then
+	"$1" --verbose "$@" sed then "$@" sed "$@" "$1"
+		'quoted text' echo test export &&
+		done export cd "$1" cd grep printf printf
+echo --verbose 2>/dev/null "$@" done cd printf
+-eu then sed 2>/dev/null awk &&
+then "$1" export $(pwd) && cd
+		then /usr/bin cd && x=1 local && printf
+	awk && cd then grep | printf test then then | | ${HOME} "$@" local --verbose
+		"$@" | printf --verbose done awk echo local "$@" test echo done
+cd "$@" x=1 "$@" local echo grep 'quoted text'
+		"$1" "$1" /usr/bin then 'quoted text' done --verbose $(pwd) readonly
+'quoted text' readonly test --verbose then export $(pwd) ${HOME} readonly
+cd "$1" printf $(pwd) sed ${HOME} x=1 "$@" 2>/dev/null grep test
+"$1" then $(pwd) "$1" done ${HOME} x=1 done grep $(pwd) printf
+		&& ${HOME} --verbose ${HOME} | "$@" grep
+"$@" done awk export x=1 done
+export test ${HOME} cd sed 'quoted text' $(pwd) cd "$@" $(pwd) printf local
+	sed 'quoted text' then /usr/bin then readonly /usr/bin printf
+local -eu "$1" --verbose --verbose "$1" done grep printf && export sed && readonly
+	readonly /usr/bin ${HOME} cd readonly x=1 'quoted text' then export
+		grep && awk "$1" readonly then sed local x=1 | "$@" export "$@" x=1 --verbose
+$(pwd) grep grep 'quoted text' /usr/bin grep && $(pwd)
+		awk sed echo local | /usr/bin $(pwd) --verbose grep cd test ${HOME}
+	test /usr/bin -eu x=1 printf /usr/bin /usr/bin done then && --verbose
+	sed "$@" printf echo grep 2>/dev/null x=1 /usr/bin test then cd 'quoted text'
+done sed grep x=1 cd | local "$@" awk "$1" printf "$@" /usr/bin x=1 $(pwd) done
+then "$1" cd test 'quoted text' awk "$@" "$@" 'quoted text'
+	done -eu -eu -eu "$@" 2>/dev/null
+		x=1 /usr/bin printf "$@" cd grep awk sed && cd $(pwd) 'quoted text' grep export
+		--verbose "$1" $(pwd) $(pwd) export cd 'quoted text' "$1" /usr/bin
+		local then printf export readonly printf sed &&
+${HOME} -eu ${HOME} readonly
+--verbose test | local --verbose -eu -eu printf
+/usr/bin local test test local local
+sed 2>/dev/null then local
+		echo "$@" x=1 test awk printf | then "$1" --verbose
+		then ${HOME} /usr/bin
+		grep grep local local then printf ${HOME} | x=1 printf local /usr/bin
+	awk sed cd readonly "$1" readonly readonly | done | awk printf done cd then &&
+		2>/dev/null 'quoted text' local | /usr/bin "$@" -eu test done /usr/bin
+grep 2>/dev/null --verbose
+local local echo sed /usr/bin cd /usr/bin -eu local
+readonly export sed ${HOME} then export done
+export done done printf | then 'quoted text' awk -eu
+	readonly sed "$@" $(pwd) ${HOME}
+	test test local local cd printf "$@" "$1" grep awk 'quoted text' /usr/bin --verbose
+--verbose "$1" sed | local 'quoted text' && -eu sed -eu 2>/dev/null
+		"$1" then /usr/bin grep done printf | cd readonly ${HOME}
+	export readonly printf $(pwd) grep local
+	/usr/bin "$1" "$@" grep echo export
+"$1" "$@" x=1 then --verbose export
+		test "$@" "$@" "$@" echo
+		"$1" $(pwd) awk && "$@"
+$(pwd) "$@" local echo
+		printf -eu sed grep export $(pwd) /usr/bin
+		| -eu /usr/bin done export readonly done x=1 2>/dev/null 'quoted text'
+readonly $(pwd) "$1" ${HOME} | && | && grep sed && "$@" sed -eu ${HOME}
+		"$1" sed | /usr/bin grep /usr/bin 'quoted text' 'quoted text'
+"$@" -eu export readonly "$1" -eu then cd --verbose --verbose
+		echo --verbose 2>/dev/null && grep
+&& | grep sed 'quoted text' x=1 && && x=1 export |
+$(pwd) "$1" 'quoted text' done
+		local && done echo 2>/dev/null 2>/dev/null
+		readonly printf && test "$1" "$1" local
+printf export /usr/bin awk done --verbose "$@"
+	$(pwd) 2>/dev/null 2>/dev/null /usr/bin -eu /usr/bin printf "$@" "$@" test $(pwd)
+	| 2>/dev/null grep $(pwd) --verbose /usr/bin export "$@" echo local -eu
+2>/dev/null readonly "$@" $(pwd)
+		/usr/bin $(pwd) readonly "$1" "$1" local then "$1" then "$@" --verbose grep |
+	local awk cd -eu awk readonly
+export cd cd readonly && local
+		export && export 2>/dev/null x=1 awk --verbose
+		x=1 | grep $(pwd) x=1 2>/dev/null done $(pwd) readonly 2>/dev/null "$@"
+		echo echo echo done test -eu test $(pwd) $(pwd) local
+| "$@" --verbose grep ${HOME} 2>/dev/null printf /usr/bin --verbose &&
+		2>/dev/null echo && 'quoted text'
+/usr/bin echo export $(pwd) "$@" readonly /usr/bin
+		sed cd $(pwd) readonly readonly done -eu ${HOME} echo sed ${HOME} 2>/dev/null
+		test sed 'quoted text' | local ${HOME} 2>/dev/null
+		x=1 sed | | 'quoted text' ${HOME} readonly done -eu export && grep
+${HOME} $(pwd) /usr/bin
+	| /usr/bin "$@" test 2>/dev/null
+		sed "$@" sed "$1" "$@" done | sed && cd && | awk -eu | | sed 'quoted text'
+printf "$1" /usr/bin done awk --verbose --verbose echo --verbose
+		--verbose test /usr/bin local
+	--verbose "$1" --verbose readonly done && /usr/bin sed "$1"
+	${HOME} --verbose readonly && -eu "$@" /usr/bin sed 2>/dev/null && 2>/dev/null
+"$@" $(pwd) x=1 2>/dev/null done "$@" awk 'quoted text'
+		done && x=1 x=1 x=1 export readonly &&
+echo | ${HOME} /usr/bin grep ${HOME} 'quoted text'
+	then --verbose $(pwd) "$@" cd export then 'quoted text' /usr/bin cd
+"$1" 'quoted text' awk cd grep ${HOME} printf | cd "$@" 2>/dev/null --verbose
+		-eu cd readonly 'quoted text'
+		export grep "$@" cd readonly && export ${HOME} then
+then awk x=1 then done export then test && && ${HOME}
+		x=1 grep --verbose echo test --verbose
+		/usr/bin --verbose "$1" echo "$1" $(pwd)
+	cd --verbose done done ${HOME} 2>/dev/null sed x=1 echo
+	/usr/bin "$1" local printf printf echo |
+	-eu 2>/dev/null awk x=1 | x=1 test done export awk test $(pwd) echo x=1 2>/dev/null
+	x=1 then | ${HOME} "$1" then -eu && test sed test local
+	"$@" readonly 2>/dev/null
+	'quoted text' && /usr/bin /usr/bin --verbose 2>/dev/null "$@" cd $(pwd)
+		${HOME} printf printf -eu | -eu -eu "$1" && test awk test local
+	$(pwd) readonly $(pwd) test local
+printf -eu "$1" x=1 sed /usr/bin grep export && /usr/bin
+	test | | done export $(pwd) readonly
+		${HOME} then readonly sed -eu then -eu grep | echo done x=1 -eu 2>/dev/null
+	"$@" sed 2>/dev/null awk readonly "$@" x=1 | "$@"
+	x=1 then printf cd cd "$1" "$@" awk awk -eu grep --verbose "$1" test
+/usr/bin local cd test | 2>/dev/null "$1" grep ${HOME} 2>/dev/null
+		export sed -eu printf printf --verbose sed /usr/bin done
+	test sed printf local then sed x=1 | cd then done awk export | &&
+	&& -eu $(pwd) echo sed 'quoted text'
+	sed 'quoted text' 'quoted text' ${HOME} echo
+test echo test grep ${HOME} grep grep 'quoted text' | echo local
+		'quoted text' "$@" /usr/bin grep grep | printf x=1 printf echo
+		&& local local 2>/dev/null then then grep
+then "$1" local ${HOME}
+	awk local printf -eu x=1 "$@" /usr/bin grep test local cd done
+		'quoted text' ${HOME} done -eu
+		&& 2>/dev/null 2>/dev/null readonly
+	sed done export done awk --verbose cd $(pwd)
+	'quoted text' /usr/bin /usr/bin -eu sed sed echo x=1 export
+awk -eu sed export then local
+		"$1" test local echo /usr/bin -eu x=1
+	"$1" test readonly -eu readonly printf then
+	test x=1 'quoted text' /usr/bin --verbose done $(pwd) printf | readonly /usr/bin
+	echo -eu /usr/bin 2>/dev/null
+		printf | -eu readonly -eu export $(pwd) printf x=1 test local test local ${HOME}
+awk readonly 'quoted text' 'quoted text'
+x=1 2>/dev/null echo done | --verbose | x=1 x=1
+	local | "$1" readonly "$1" "$@" sed local awk x=1 | /usr/bin
+	cd "$@" 'quoted text' "$@" 2>/dev/null test $(pwd) --verbose local cd x=1 export
+	| 2>/dev/null 'quoted text'
+	-eu sed "$1" $(pwd) /usr/bin x=1 printf
+x=1 readonly $(pwd) $(pwd) readonly printf
+		printf awk cd local -eu awk 2>/dev/null export -eu 'quoted text'
+		-eu cd 2>/dev/null /usr/bin "$@" && done echo
+--verbose awk "$@" "$1" awk $(pwd) local grep -eu 2>/dev/null x=1 | then test
+	&& test 2>/dev/null test local local printf
+test && printf printf grep
+		awk x=1 readonly grep cd test grep /usr/bin
+		awk then export | /usr/bin "$@" 2>/dev/null $(pwd)
+	done export x=1 'quoted text' readonly
+		"$1" "$@" && | grep local printf sed test "$@" cd x=1
+	x=1 readonly test cd x=1 echo "$1" echo done ${HOME}
+echo x=1 2>/dev/null "$@" 2>/dev/null
+&& readonly --verbose printf /usr/bin
+		x=1 awk export 'quoted text' 2>/dev/null && cd
+	'quoted text' local "$@" --verbose test | $(pwd) printf $(pwd)
+	x=1 grep awk cd ${HOME} test done | printf cd cd ${HOME} cd --verbose -eu awk --verbose
+		"$@" --verbose "$@" /usr/bin done
+		"$1" sed grep echo --verbose sed /usr/bin --verbose echo | x=1
+		| then 'quoted text' -eu | local /usr/bin && "$1" 'quoted text' cd
+	export test 'quoted text' readonly 2>/dev/null awk then $(pwd)
+echo grep --verbose --verbose
+		-eu export test && | readonly test --verbose grep "$1" grep 'quoted text'
+	| awk grep 2>/dev/null $(pwd) ${HOME}
+	export 'quoted text' | ${HOME} done 2>/dev/null awk 'quoted text' -eu /usr/bin
+	$(pwd) /usr/bin then export ${HOME} 2>/dev/null
+	| $(pwd) "$@" printf --verbose "$1" x=1 awk -eu ${HOME} && export ${HOME}
+		2>/dev/null sed then "$1" && grep "$1" /usr/bin /usr/bin export
+		"$1" readonly local readonly done readonly test printf done
+sed export readonly x=1 /usr/bin "$@" --verbose | readonly test /usr/bin
+readonly "$1" done export echo "$1"
+	grep awk readonly "$1" && sed awk done
+	echo | export cd x=1 export printf local then
+		${HOME} echo cd "$@" grep 2>/dev/null && "$1" /usr/bin readonly sed readonly
+		echo local export -eu cd /usr/bin export then "$@" "$1" && $(pwd)
+echo awk /usr/bin test "$1" 'quoted text' -eu 2>/dev/null echo echo
+$(pwd) sed x=1 grep sed echo | echo grep echo printf $(pwd) 2>/dev/null
+printf cd export $(pwd) done $(pwd) --verbose | x=1 /usr/bin grep
+		cd echo echo "$1" | done test
+	awk 'quoted text' grep -eu echo "$@" echo "$1" local grep printf /usr/bin done
+	"$1" --verbose cd "$1" "$@" && ${HOME} 2>/dev/null
+cd --verbose local && "$@" /usr/bin then 2>/dev/null readonly
+	--verbose | ${HOME} -eu echo awk
+		awk then local cd ${HOME} sed && | 2>/dev/null /usr/bin /usr/bin printf
+		&& grep done $(pwd) sed -eu test --verbose awk readonly test 'quoted text'
+	readonly 'quoted text' cd echo /usr/bin cd grep ${HOME} printf $(pwd) /usr/bin
+		x=1 --verbose grep done echo --verbose "$@" | && sed local /usr/bin
+	"$@" 'quoted text' export ${HOME}
+readonly cd "$1" test local then -eu && test grep printf sed -eu x=1 then
+		| sed "$1" --verbose 2>/dev/null test test sed then awk readonly
+	x=1 then 2>/dev/null --verbose | 2>/dev/null "$1" x=1 ${HOME} export $(pwd)
+/usr/bin done sed test readonly "$@" local then readonly cd "$1" |
+export -eu done | "$1" x=1 2>/dev/null 'quoted text'
+		'quoted text' done x=1 awk $(pwd) awk sed /usr/bin $(pwd)
+cd | export cd awk "$@" readonly cd && done then
+"$1" 'quoted text' --verbose $(pwd) grep test printf sed
+		-eu readonly 2>/dev/null test sed printf printf
+		awk then test "$1" && grep readonly
+sed awk 'quoted text' readonly
+	local -eu echo grep ${HOME}
+cd done $(pwd) -eu grep $(pwd) x=1
+		"$@" local -eu 2>/dev/null -eu $(pwd) export grep printf local $(pwd)
+readonly grep local /usr/bin "$@"
+	awk awk cd -eu && echo readonly 2>/dev/null
+"$1" awk && grep 2>/dev/null done "$@" echo
+"$1" $(pwd) && ${HOME} readonly
+	"$@" grep x=1 local awk
+	cd | readonly then x=1 done "$1" 'quoted text' printf readonly ${HOME}
+"$1" then && "$@" "$@" && ${HOME}
+	test --verbose -eu cd done
+	awk 'quoted text' --verbose x=1 2>/dev/null test | /usr/bin
+		printf "$1" x=1 "$1" | x=1 export "$@" |
+	&& test && printf "$@" local export /usr/bin awk then cd 2>/dev/null
+		then x=1 2>/dev/null 'quoted text' -eu "$1" 'quoted text' |
+	&& test "$@" then $(pwd) $(pwd) local cd | x=1 cd "$1" && $(pwd) "$1" grep printf
+	| local "$1" export printf export echo printf printf grep test /usr/bin awk local
+	grep && "$@" 'quoted text' export && export echo printf | && then 2>/dev/null
+x=1 --verbose done 2>/dev/null 2>/dev/null && "$@" x=1
+	readonly grep "$@" 2>/dev/null "$1" -eu -eu then cd echo cd test "$1"
+		'quoted text' --verbose 'quoted text' ${HOME} ${HOME} -eu && export grep export
+${HOME} awk printf ${HOME} -eu "$1" then grep readonly sed awk $(pwd) -eu /usr/bin
+	${HOME} /usr/bin awk done sed
+--verbose awk $(pwd) done readonly
+		${HOME} /usr/bin $(pwd) "$@" $(pwd) $(pwd) $(pwd)
+--verbose && $(pwd) x=1 /usr/bin awk x=1 printf cd && export
+export grep ${HOME} test then && readonly 2>/dev/null test
+export export 2>/dev/null && "$1"
+		| printf /usr/bin done ${HOME} 'quoted text' /usr/bin local sed
+${HOME} && | readonly x=1 --verbose --verbose 'quoted text' | && "$@" sed
+	echo test --verbose echo 'quoted text' "$@" grep | 2>/dev/null
+done readonly --verbose readonly
+		/usr/bin then /usr/bin test echo readonly
+		awk --verbose readonly then done test awk -eu /usr/bin | readonly "$@" x=1
+then local test 'quoted text'
+	cd cd printf printf local | then --verbose
+		cd | sed echo grep grep
+awk 2>/dev/null ${HOME} then grep && readonly "$@" cd cd sed local printf awk printf
+"$@" awk x=1 done echo && printf ${HOME}
+	sed sed export /usr/bin done x=1
+&& awk echo ${HOME} sed done then "$@" "$@" -eu printf | 'quoted text'
+	export grep x=1 cd awk | local --verbose readonly
+&& 'quoted text' sed awk "$@" $(pwd) sed | export printf
+done /usr/bin $(pwd) /usr/bin 2>/dev/null ${HOME} local
+		export then $(pwd) x=1 grep awk
+	--verbose "$@" | 'quoted text' then export then 2>/dev/null
+local sed "$@" 2>/dev/null ${HOME} "$@"
+	readonly local $(pwd) then printf test && --verbose /usr/bin local
+	"$1" "$1" && test export sed "$@" grep then export printf | test awk test /usr/bin
+		'quoted text' ${HOME} $(pwd) | && -eu
+/usr/bin local readonly | sed printf awk "$@" echo test grep 'quoted text'
+		local then $(pwd) "$@" 2>/dev/null done && "$@"
+"$@" awk export test $(pwd) --verbose --verbose $(pwd) awk -eu echo
+	export && printf "$@" echo
+"$1" cd "$1" && sed "$1" readonly ${HOME} "$1"
+		"$@" test 2>/dev/null export | $(pwd) done test && readonly then 'quoted text'
+		-eu /usr/bin 'quoted text' $(pwd) "$@"
+	"$@" local && echo && && $(pwd) "$1" cd "$1" echo && printf cd grep
+&& done 2>/dev/null test "$@" readonly --verbose sed cd "$1" test && /usr/bin
+		done awk sed export then then ${HOME}
+"$1" /usr/bin "$1" $(pwd) awk "$1" local "$1" cd && && x=1 sed readonly ${HOME}
+$(pwd) awk "$1" printf "$1" $(pwd) -eu "$1" $(pwd) /usr/bin
+test printf readonly cd test --verbose then ${HOME}
+		-eu "$1" -eu -eu echo "$1" ${HOME} && local "$1" x=1 /usr/bin
+| test | echo readonly | done "$@" printf test readonly
+readonly grep grep | then
+grep printf sed local cd export "$@" sed
+	then "$1" "$1" test test local ${HOME} -eu sed /usr/bin export "$@" 2>/dev/null
+		sed 2>/dev/null "$@" sed awk
+		-eu -eu readonly sed ${HOME} local 2>/dev/null --verbose "$1" echo test
+	then cd | --verbose then | then test cd awk
+	echo test 'quoted text' export sed --verbose
+	&& echo | | grep awk test readonly readonly
+	${HOME} test done && test export awk ${HOME} printf
+		--verbose test 2>/dev/null echo $(pwd) "$@" /usr/bin -eu x=1 $(pwd)
+		test && local local done "$@" cd export cd $(pwd) x=1
+	${HOME} 'quoted text' "$1" cd x=1 local local --verbose
+grep awk export "$1" --verbose -eu sed sed export grep
+	${HOME} ${HOME} 2>/dev/null cd "$1" done printf export sed
+"$1" -eu sed then grep readonly sed grep "$@" readonly "$@" x=1 readonly /usr/bin
+sed "$@" then 2>/dev/null test test then readonly then sed
+${HOME} readonly grep 'quoted text' export sed cd /usr/bin x=1 "$1" -eu /usr/bin
+sed -eu awk 'quoted text'
+"$@" 2>/dev/null cd /usr/bin 'quoted text' /usr/bin --verbose "$1" awk && done
+export local x=1 done && x=1 then |
+	printf awk ${HOME} grep --verbose awk sed
+	-eu local test cd then grep x=1 echo x=1
+	&& && --verbose "$@" printf echo --verbose
+test local && readonly grep test printf
+		$(pwd) cd cd cd | && "$@" | --verbose grep -eu --verbose sed test then
+-eu readonly "$1" cd 2>/dev/null | printf
+		'quoted text' echo export sed /usr/bin cd
+	done then | local done 'quoted text' x=1 ${HOME} grep ${HOME} x=1 &&
+	test echo then local done -eu 2>/dev/null awk readonly 2>/dev/null ${HOME}
+sed ${HOME} | test test sed 'quoted text'
+	grep "$@" export --verbose done /usr/bin -eu local
+awk sed 'quoted text' awk export
+		'quoted text' /usr/bin cd test readonly | awk
+	grep sed "$1" x=1 && 'quoted text' sed
+	test /usr/bin 'quoted text' "$1" x=1 /usr/bin then --verbose
+	"$1" echo | done echo $(pwd) awk "$@" "$@" done ${HOME}
+cd 2>/dev/null "$@" 'quoted text'
+	done --verbose readonly --verbose cd local readonly grep readonly
+	awk echo sed -eu test ${HOME} cd "$@" echo "$@" $(pwd) 2>/dev/null | local cd -eu
+readonly local 'quoted text' local sed 'quoted text' ${HOME} readonly local
+		export "$1" -eu -eu && sed 'quoted text' test --verbose awk 'quoted text'
+	2>/dev/null 'quoted text' then ${HOME} && printf readonly printf
+	echo awk printf done readonly -eu sed "$1" x=1 echo
+test grep awk $(pwd) 'quoted text' ${HOME} readonly readonly
+	"$1" 'quoted text' --verbose awk cd x=1 ${HOME}
+		/usr/bin readonly | ${HOME}
+	echo -eu -eu export printf printf export x=1 && "$@" local local
+		2>/dev/null --verbose -eu export
+	$(pwd) done x=1 'quoted text' export -eu
+'quoted text' "$1" test "$@" export printf "$@" $(pwd)
+| done awk -eu /usr/bin /usr/bin ${HOME} grep readonly grep awk && cd
+&& cd 'quoted text' test $(pwd) echo
+	&& then -eu "$1" awk ${HOME} readonly ${HOME} /usr/bin ${HOME} 2>/dev/null
+		| "$@" "$@" ${HOME} echo export
+sed -eu "$@" sed --verbose
+		${HOME} "$@" printf export
+	local -eu export local x=1 test sed ${HOME} local grep | x=1 ${HOME} local
+		x=1 awk cd cd grep && 2>/dev/null | "$@" local export readonly cd && ${HOME}
+'quoted text' x=1 done grep 2>/dev/null ${HOME} x=1
+		${HOME} -eu export x=1 local $(pwd) awk export cd awk | readonly echo export
+| sed done sed echo /usr/bin readonly "$1" -eu ${HOME} readonly $(pwd) export
+	"$@" -eu sed $(pwd) readonly -eu | 'quoted text' echo "$1" $(pwd)
+	"$1" cd test grep then
+'quoted text' 2>/dev/null /usr/bin --verbose "$@" echo cd -eu 2>/dev/null done
+--verbose grep | | printf printf && test then cd
+&& echo "$@" "$1" awk $(pwd) test echo printf cd printf --verbose ${HOME}
+cd local cd && export $(pwd) --verbose | -eu $(pwd)
+done ${HOME} x=1 then "$@"
+	2>/dev/null readonly "$1" sed "$1" cd "$1"
+echo readonly printf export "$1" echo grep cd "$@" awk sed /usr/bin
+		sed 2>/dev/null "$1" x=1 -eu done
+	x=1 --verbose then && "$@" ${HOME} done x=1 done && cd "$1" readonly local
+	x=1 'quoted text' local done 'quoted text' export cd ${HOME} grep "$1"
+	&& echo -eu export then -eu awk cd local $(pwd) "$1"
+printf "$@" && export /usr/bin /usr/bin "$1" --verbose 2>/dev/null --verbose
+	-eu grep export echo -eu && x=1 && | readonly test
+	export --verbose && echo -eu -eu | test
+	printf cd export local | echo && $(pwd) x=1 awk printf grep
+then "$@" $(pwd) readonly local
+	"$1" 2>/dev/null local cd 2>/dev/null awk | | 2>/dev/null "$@" local
+	x=1 grep done x=1 x=1 then printf printf -eu export printf x=1 cd
+		sed grep test --verbose done test --verbose | /usr/bin x=1 | export | export
+		'quoted text' then -eu -eu x=1 export $(pwd) x=1 ${HOME} printf
+	"$1" 'quoted text' readonly -eu ${HOME} export awk local done -eu -eu 2>/dev/null
+		readonly export "$1" test x=1 echo sed $(pwd) done done readonly 2>/dev/null $(pwd)
+		&& "$@" readonly 'quoted text'
+		grep test -eu ${HOME} awk ${HOME}
+		-eu 'quoted text' grep grep -eu
+	printf awk 2>/dev/null 'quoted text' cd test -eu
+	echo /usr/bin awk --verbose
+	echo "$1" "$1" export awk echo export $(pwd)
+		$(pwd) grep x=1 ${HOME} awk ${HOME} done
+-eu /usr/bin "$@" /usr/bin done export | ${HOME} awk done ${HOME} ${HOME}
+awk "$1" export "$1" grep readonly printf
+		&& readonly $(pwd) readonly printf sed | | 2>/dev/null 2>/dev/null
+printf awk ${HOME} ${HOME} echo ${HOME} x=1 export readonly
+'quoted text' done -eu --verbose /usr/bin readonly echo
+/usr/bin "$@" "$@" printf --verbose -eu local then
+		awk printf grep "$@" 'quoted text'
+		-eu then 2>/dev/null printf then test 'quoted text' /usr/bin grep $(pwd) && $(pwd)
+	cd | test local sed ${HOME} "$1" readonly
+echo printf echo awk test
+&& readonly awk readonly 'quoted text' && 2>/dev/null then awk 2>/dev/null export
+--verbose "$@" "$1" | -eu grep
+	"$@" echo export x=1 test then
+x=1 --verbose local x=1 test awk echo grep ${HOME} sed sed sed done
+		readonly ${HOME} cd local printf x=1 grep $(pwd)
+	x=1 done 'quoted text' "$1" x=1 sed
+	"$1" | then 'quoted text' sed -eu awk echo "$@"
+		x=1 echo then local --verbose /usr/bin $(pwd) x=1 then grep
+	x=1 done local ${HOME} echo -eu sed readonly printf
+awk 2>/dev/null --verbose then x=1 export
+2>/dev/null echo sed 2>/dev/null -eu /usr/bin
+done awk -eu awk | printf
+	&& test -eu -eu echo sed done && local -eu -eu test && /usr/bin
+local local -eu /usr/bin ${HOME} done
+cd grep ${HOME} then cd "$1"
+printf ${HOME} local | && grep
+	--verbose && && /usr/bin x=1 grep echo "$@" "$1" --verbose
+		-eu grep --verbose -eu 2>/dev/null local cd $(pwd)
+readonly 2>/dev/null 'quoted text' done 'quoted text' --verbose readonly "$1"
+	"$1" local "$1" x=1 | && && -eu
+&& --verbose && $(pwd) awk readonly cd export cd --verbose &&
+--verbose test ${HOME} | | test x=1 $(pwd) $(pwd)
+	readonly echo export /usr/bin
+	readonly printf ${HOME} local test
+echo && export then /usr/bin $(pwd) $(pwd) $(pwd) -eu then $(pwd) export
+| echo $(pwd) ${HOME} printf printf cd $(pwd) x=1 && cd grep sed
+then cd awk readonly readonly x=1 "$1" cd echo sed "$1"
+	grep cd 'quoted text' 'quoted text' awk /usr/bin done -eu readonly grep
+	cd export --verbose && --verbose -eu /usr/bin echo printf "$1"
+	"$@" "$1" test && 'quoted text'
+-eu x=1 | 'quoted text'
+		| /usr/bin echo x=1 "$@" awk "$@" "$1" /usr/bin readonly $(pwd) 'quoted text'
+2>/dev/null awk local "$@" ${HOME} echo 2>/dev/null
+		$(pwd) /usr/bin export test /usr/bin $(pwd) | test
+readonly ${HOME} "$1" 'quoted text' | 2>/dev/null $(pwd) printf echo
+$(pwd) then ${HOME} -eu | 'quoted text'
+printf | $(pwd) done --verbose | then 2>/dev/null awk grep
+	echo local --verbose local /usr/bin
+	"$1" awk 2>/dev/null x=1 && "$@" 'quoted text' "$1"
+cd echo 2>/dev/null cd | 'quoted text' sed printf local
+		awk x=1 readonly 2>/dev/null && 'quoted text' "$@"
+		| -eu --verbose printf 'quoted text'
+test awk export 2>/dev/null then | export sed "$1" ${HOME} -eu "$@" /usr/bin
+		readonly readonly grep done then | "$@" --verbose printf $(pwd) cd
+	${HOME} done "$1" && grep 2>/dev/null ${HOME} -eu readonly local echo |
+	x=1 test sed local 2>/dev/null ${HOME}
+		printf "$1" 2>/dev/null cd
+2>/dev/null local done && "$@"
+	2>/dev/null cd test echo
+	"$@" 2>/dev/null awk printf -eu /usr/bin local grep --verbose then
+	printf local $(pwd) 2>/dev/null test test export --verbose 'quoted text'
+	sed && "$1" done 2>/dev/null grep
+		| done "$1" printf readonly "$@" "$1" done grep printf --verbose 2>/dev/null
+		/usr/bin readonly test then 'quoted text'
+		"$1" awk test then /usr/bin 2>/dev/null $(pwd)
+printf cd "$@" "$1" | export 'quoted text' 2>/dev/null cd
+		grep awk --verbose "$1" x=1 2>/dev/null grep sed | echo printf printf
+	'quoted text' ${HOME} readonly /usr/bin | echo x=1 sed readonly && done "$@"
+readonly echo export readonly printf "$@" export
+cd echo echo $(pwd) done done awk && printf printf "$@" grep /usr/bin then
+	&& --verbose 'quoted text'
+local | $(pwd) echo --verbose -eu readonly
+		2>/dev/null sed "$@" sed && $(pwd)
+$(pwd) echo test ${HOME} printf 'quoted text'
+		2>/dev/null cd 'quoted text' ${HOME} local "$1" 2>/dev/null "$@" test sed readonly
+"$@" local 2>/dev/null echo then "$@" /usr/bin ${HOME} && local
+	&& "$1" | echo -eu export "$1" printf export --verbose
+export cd test then then 'quoted text'
+test then echo 2>/dev/null sed --verbose
+x=1 'quoted text' grep export printf "$@"
+test "$@" printf $(pwd) 'quoted text'
+		grep awk 'quoted text' grep -eu echo
+	"$@" then /usr/bin -eu ${HOME}
+		export --verbose printf printf $(pwd) "$1" ${HOME} ${HOME} sed grep
+local 'quoted text' | done local echo 'quoted text' cd "$@"
+		'quoted text' cd 'quoted text' | echo $(pwd) "$1" readonly
+local test "$1" 'quoted text' cd --verbose done done && -eu 'quoted text'
+		"$1" grep echo grep grep /usr/bin cd
+${HOME} && readonly x=1 'quoted text' "$1"
+	"$@" -eu 'quoted text' | $(pwd) /usr/bin readonly cd -eu
+	export printf echo then ${HOME}
+	done && /usr/bin test --verbose
+		local "$1" readonly readonly "$1" ${HOME} echo 'quoted text' sed 2>/dev/null
+		x=1 readonly && done printf sed ${HOME} printf then "$@" --verbose
+		then then "$@" $(pwd) readonly -eu readonly /usr/bin "$@" 2>/dev/null
+	"$@" cd grep readonly awk echo
+	awk /usr/bin awk echo
+test sed local awk local local -eu && -eu "$1" -eu 2>/dev/null -eu readonly /usr/bin
+cd cd cd printf 2>/dev/null
+	printf "$1" 2>/dev/null -eu ${HOME} then echo
+done $(pwd) /usr/bin test
+	'quoted text' printf x=1 done cd "$@" cd && grep then ${HOME} sed echo
+awk then echo $(pwd) 2>/dev/null 'quoted text'
+&& local /usr/bin ${HOME} x=1 -eu 'quoted text' done --verbose grep "$1" | --verbose
+test printf done cd --verbose x=1 awk cd -eu echo
+local x=1 local cd "$@" cd sed export local test ${HOME} -eu sed
+cd awk echo cd then "$@" "$1" "$@" | test awk done x=1 test export $(pwd) x=1 --verbose
+	test -eu "$@" sed printf readonly sed x=1 | local 2>/dev/null "$@" --verbose
+	grep done | echo | $(pwd) 2>/dev/null ${HOME}
+then ${HOME} export -eu printf --verbose
+test | grep | "$1" test
+	grep grep 2>/dev/null x=1 grep x=1 awk local --verbose done --verbose
+then local 'quoted text' /usr/bin cd "$1" -eu 2>/dev/null | /usr/bin grep ${HOME}
+		grep x=1 local cd test x=1 awk done done grep && echo | | ${HOME} local
+readonly 2>/dev/null sed 'quoted text'
+printf then -eu done 'quoted text' --verbose
+cd done export 2>/dev/null awk readonly export 'quoted text' --verbose 2>/dev/null
+		2>/dev/null | readonly echo printf done readonly awk then -eu --verbose printf
+	-eu local | done printf grep sed $(pwd) /usr/bin ${HOME} && ${HOME}
+		'quoted text' sed 'quoted text' echo "$@" printf
+cd /usr/bin cd "$1" echo "$1" done echo sed 2>/dev/null
+awk /usr/bin --verbose | then echo 'quoted text' "$1" x=1
+	'quoted text' awk printf "$@" -eu then --verbose "$1" | "$1" local
+		local sed 'quoted text' done test
+sed 2>/dev/null sed local /usr/bin
+		awk | printf "$1" "$@" | "$@" sed ${HOME} x=1 | done readonly
+x=1 local && && ${HOME} && printf readonly done 2>/dev/null
+	&& printf grep --verbose cd grep x=1 then cd then ${HOME} echo
+	readonly | awk $(pwd) awk "$1" echo test test | -eu done awk --verbose 2>/dev/null
+sed local echo | 2>/dev/null then /usr/bin "$1" echo awk 'quoted text'
+x=1 sed awk x=1 "$1" export cd test ${HOME} ${HOME} 'quoted text' awk local "$1"
+		| --verbose "$@" awk 'quoted text' echo /usr/bin
+printf cd export grep grep "$1" test && echo 2>/dev/null test done local ${HOME}
+	${HOME} "$1" ${HOME} echo grep && /usr/bin awk $(pwd) $(pwd) local sed test
+-eu --verbose echo printf && export local 2>/dev/null then ${HOME}
+export sed --verbose x=1 'quoted text' ${HOME} test "$1" && awk awk 'quoted text'
+		readonly awk 'quoted text' export export export echo --verbose readonly
+sed local && x=1 ${HOME} 'quoted text'
+		then printf sed printf awk 2>/dev/null cd awk 2>/dev/null readonly
+	${HOME} | "$@" cd readonly readonly --verbose
+	awk 'quoted text' printf | local
+		done printf x=1 local then then 2>/dev/null "$@" readonly export export export -eu
+done -eu 2>/dev/null 'quoted text'
+'quoted text' && "$1" "$@" printf export --verbose
+"$1" $(pwd) local /usr/bin local && sed awk local cd done sed x=1 sed
+	cd "$@" local sed readonly "$@" sed $(pwd) readonly "$@" grep then
+		"$1" awk grep export "$@"
+		test sed local local "$@" done cd
+		printf export cd ${HOME} local ${HOME}
+		$(pwd) cd export echo awk && done $(pwd) | done local -eu echo cd test export
+export $(pwd) done /usr/bin sed
+$(pwd) ${HOME} then local done /usr/bin done 2>/dev/null x=1 readonly
+		sed local printf --verbose readonly $(pwd) 'quoted text' | && done
+sed then readonly grep awk then export local local
+| grep | sed awk awk
+test /usr/bin awk awk &&
+	2>/dev/null test export $(pwd) done sed test
+	local $(pwd) sed --verbose then && && test local test then printf 2>/dev/null
+	2>/dev/null then x=1 "$1" -eu ${HOME}
+done --verbose cd awk
+	test awk awk "$1" export x=1 'quoted text'
+test sed then --verbose then
+"$1" --verbose echo test grep test grep awk
+		echo | ${HOME} cd readonly readonly ${HOME}
+		printf cd "$@" cd echo && "$@" then echo awk local export
+	readonly awk "$@" "$1" awk cd --verbose &&
+	"$1" "$1" cd 'quoted text' -eu done 2>/dev/null /usr/bin "$1" done ${HOME}
+done sed grep --verbose "$@" local | -eu ${HOME} grep ${HOME} "$1" done cd sed
+sed readonly printf --verbose
+	awk /usr/bin local /usr/bin local | sed printf grep $(pwd)
+$(pwd) | local --verbose readonly -eu cd local
+sed 2>/dev/null awk sed local
+		-eu then test -eu ${HOME} x=1
+	| awk grep && done "$1" cd --verbose export export "$1" | --verbose
+		done done && ${HOME} --verbose printf && echo
+		&& x=1 grep "$@" done "$@" then --verbose ${HOME} | awk
+"$@" cd 2>/dev/null then -eu
+grep "$@" x=1 && 2>/dev/null awk printf
+		awk echo 2>/dev/null test test local ${HOME} $(pwd) "$@"
+2>/dev/null echo 2>/dev/null "$1" 2>/dev/null $(pwd) -eu ${HOME}
+		awk x=1 -eu -eu cd --verbose
+		${HOME} /usr/bin cd done x=1 grep x=1 test printf -eu done grep done cd
+		--verbose ${HOME} echo done awk -eu
+	cd /usr/bin printf &&
+	"$@" local "$1" && ${HOME} printf export sed done
+		done local echo test cd "$@" cd printf x=1 local grep
+		then x=1 /usr/bin local sed awk --verbose && 2>/dev/null /usr/bin readonly | readonly
+		printf readonly grep local
+	'quoted text' readonly && -eu 'quoted text' 'quoted text' sed grep
+		sed -eu && printf test | grep && cd $(pwd) 'quoted text' test grep "$1"
+	cd --verbose --verbose 2>/dev/null test grep echo
+	$(pwd) done "$1" "$@" 'quoted text' then echo 'quoted text'
+	"$1" ${HOME} grep $(pwd) export x=1 -eu export
+		test && 2>/dev/null $(pwd) $(pwd) grep sed readonly $(pwd) then 'quoted text'
+${HOME} then x=1 readonly echo
+		cd readonly cd "$@" /usr/bin
+		"$1" local local cd | $(pwd) "$1" -eu -eu $(pwd) "$1" "$@" export
+		| grep "$1" -eu sed awk local test sed && grep "$1" "$1" "$@" done cd sed
+	printf sed then local | $(pwd)
+	x=1 readonly printf "$@" sed done grep cd printf cd
+		2>/dev/null printf && -eu -eu export "$@" --verbose -eu
+	then "$@" cd x=1 grep sed 'quoted text' | grep cd done 'quoted text'
+		${HOME} then $(pwd) x=1 test printf 2>/dev/null
+	readonly && x=1 "$@" "$@" 'quoted text' awk awk test awk cd ${HOME}
+	/usr/bin then 'quoted text' cd "$1"
+/usr/bin x=1 2>/dev/null | | awk -eu $(pwd) echo
+then then local && && test --verbose
+--verbose echo 'quoted text' test $(pwd)
+	export printf printf echo sed readonly -eu $(pwd) sed 2>/dev/null
+	then local 'quoted text' sed then printf ${HOME} "$@" --verbose awk "$@"
+		x=1 2>/dev/null 2>/dev/null then local local 'quoted text' /usr/bin awk ${HOME}
+		| 'quoted text' export grep && && sed then
+	then printf done ${HOME} test local --verbose 2>/dev/null cd | test
+	--verbose export test echo local sed awk /usr/bin export cd readonly
+| printf export echo local "$1" 'quoted text'
+	--verbose cd echo /usr/bin sed sed "$@" then cd ${HOME} "$1" grep
+		&& -eu 2>/dev/null --verbose && grep echo done
+"$@" local "$1" awk 'quoted text' 'quoted text'
+	printf awk -eu $(pwd) done
+'quoted text' readonly | x=1 "$1"
+	'quoted text' x=1 then sed awk done /usr/bin cd "$1" $(pwd) export -eu &&
+2>/dev/null -eu "$@" "$@" echo
+		local echo x=1 && sed x=1 test grep awk 2>/dev/null $(pwd)
+	sed -eu echo "$@" grep echo awk && sed 2>/dev/null done awk
+awk --verbose cd ${HOME} test sed printf
+readonly cd printf cd 2>/dev/null x=1 echo 2>/dev/null -eu && "$1" ${HOME}
+local "$@" /usr/bin local test grep awk 'quoted text' 2>/dev/null sed /usr/bin
+	-eu local | 2>/dev/null --verbose
+	grep export grep 'quoted text' 'quoted text'
+local then && 'quoted text' then
+| | export test ${HOME} printf x=1 done export /usr/bin
+	'quoted text' "$1" -eu
+	x=1 "$@" done ${HOME} cd $(pwd) | readonly
+sed echo 'quoted text' -eu
+cd /usr/bin awk -eu 2>/dev/null local "$1"
+	test grep --verbose then cd | "$1" 'quoted text' grep ${HOME}
+'quoted text' sed test then sed | test --verbose x=1 "$@" "$@" echo
+		local done awk done echo 2>/dev/null -eu "$@" -eu local -eu "$@" test export
+	&& export $(pwd) local ${HOME} --verbose cd test 'quoted text' sed "$@" $(pwd)
+		readonly 2>/dev/null readonly ${HOME} ${HOME} grep
+	'quoted text' done export
+${HOME} sed printf --verbose grep 2>/dev/null && && sed $(pwd) /usr/bin
+'quoted text' && awk /usr/bin awk then local "$@" | done && --verbose then
+${HOME} 2>/dev/null cd export done awk /usr/bin && cd /usr/bin printf "$@" grep
+printf "$@" readonly done -eu test then 2>/dev/null --verbose "$1" "$@"
+grep grep /usr/bin /usr/bin
+	grep readonly && -eu -eu grep "$1"
+	test | grep done local awk local --verbose local ${HOME} printf --verbose sed then
+	${HOME} $(pwd) "$1" done sed 2>/dev/null x=1 sed $(pwd) /usr/bin
+		printf printf --verbose printf -eu 2>/dev/null
+	printf cd -eu "$1" | x=1 --verbose
+	test test /usr/bin printf cd "$1" echo export
+		cd sed local | cd -eu grep "$@" && then test $(pwd) readonly | sed ${HOME}
+		2>/dev/null "$1" awk 'quoted text' x=1 cd $(pwd) x=1
+		-eu cd then export readonly cd printf local && /usr/bin readonly
+	-eu done export done awk grep 2>/dev/null x=1 echo "$@" printf export &&
+		$(pwd) test ${HOME} | local /usr/bin export "$1" -eu "$@" printf -eu sed export
+sed "$1" | grep awk awk
+		export awk x=1 test $(pwd) "$@" export then then
+	${HOME} -eu test /usr/bin test printf "$@" awk test --verbose sed
+		"$1" /usr/bin grep then
+	$(pwd) $(pwd) grep readonly awk && done sed readonly
+$(pwd) -eu grep -eu grep
+| "$1" printf -eu done export && test sed -eu grep && test sed grep sed
+	-eu readonly $(pwd) 2>/dev/null awk 2>/dev/null done
+test -eu sed "$@" sed sed
+		sed -eu x=1 /usr/bin local readonly echo -eu x=1 | $(pwd) sed
+	done x=1 "$@" ${HOME}
+$(pwd) 'quoted text' readonly 'quoted text'
+	/usr/bin --verbose 2>/dev/null done then && echo && ${HOME} --verbose printf
+	"$1" sed && done readonly test cd done -eu echo -eu printf printf
+	echo then && cd /usr/bin "$@" $(pwd) awk
+	grep printf -eu | --verbose --verbose --verbose && "$1" && sed export cd --verbose
+export /usr/bin done --verbose readonly /usr/bin cd cd local export awk export
+		2>/dev/null cd cd -eu 2>/dev/null export $(pwd) readonly "$@" $(pwd) sed local
+	/usr/bin -eu "$@" 'quoted text' "$@" --verbose sed
+		echo $(pwd) local --verbose local export
+		sed cd ${HOME} grep test cd readonly
+grep | 2>/dev/null && done 'quoted text' "$@" "$1"
+readonly printf cd /usr/bin
+echo echo done | ${HOME} --verbose -eu ${HOME} ${HOME} test --verbose sed |
+		echo local sed 2>/dev/null then --verbose echo then local printf
+-eu printf --verbose -eu done done echo printf "$1" -eu "$@" local then done x=1
+	${HOME} ${HOME} -eu awk sed sed --verbose test sed cd grep "$@" grep sed
+	${HOME} grep 'quoted text' printf sed "$1" then grep x=1 | grep echo local
+	printf sed "$1" printf | readonly "$@" --verbose
+	cd ${HOME} grep "$@" test
+		local grep cd "$@" 'quoted text' /usr/bin && awk export --verbose "$1" printf
+		--verbose cd local ${HOME} then sed && printf readonly sed $(pwd)
+"$1" cd echo && sed done /usr/bin cd x=1 test -eu -eu readonly
+		echo "$@" then 2>/dev/null -eu --verbose /usr/bin then --verbose x=1 $(pwd)
+	printf -eu --verbose && -eu 'quoted text'
+test --verbose test "$@" "$@" cd x=1 $(pwd) --verbose
+	${HOME} awk echo x=1 'quoted text' readonly
+	/usr/bin x=1 --verbose --verbose then
+awk --verbose 'quoted text' /usr/bin cd cd readonly --verbose
+		--verbose grep $(pwd) sed echo sed
+		done "$1" --verbose test local sed "$@" test && test -eu
+		readonly x=1 -eu then printf 'quoted text'
+grep cd | 'quoted text' 'quoted text' local done -eu awk --verbose
+	--verbose 2>/dev/null x=1 test echo
+		2>/dev/null 2>/dev/null /usr/bin readonly done local sed grep done grep 'quoted text'
+		cd -eu "$@" "$1" -eu grep grep echo
+2>/dev/null grep -eu "$1" sed 2>/dev/null && && sed
+2>/dev/null $(pwd) "$@" sed 'quoted text' test
+	cd local sed && --verbose echo && test done 'quoted text'
+	cd "$@" grep awk local awk then readonly
+	$(pwd) 2>/dev/null -eu $(pwd) "$@" "$@" ${HOME} 2>/dev/null --verbose
+	printf done "$@" x=1 x=1 $(pwd) echo -eu echo
+	readonly grep local 'quoted text' x=1 printf x=1 awk grep -eu awk
+		| sed printf awk done "$1" | --verbose printf readonly echo done then
+		export && sed 2>/dev/null "$1"
+	grep printf sed && then test readonly done | 2>/dev/null grep
+		local "$1" readonly | --verbose printf readonly |
+${HOME} sed local -eu then | done "$1" --verbose sed 'quoted text' /usr/bin $(pwd)
+		awk "$@" -eu sed readonly -eu ${HOME} export x=1 then cd && printf
+	awk printf | test done "$@"
+		x=1 $(pwd) 2>/dev/null done echo x=1 printf readonly cd | x=1 x=1 local
+	readonly | "$@" test export /usr/bin readonly test done sed readonly cd
+2>/dev/null x=1 test $(pwd) test /usr/bin 'quoted text' "$@"
+		2>/dev/null 'quoted text' export then awk test done
+	'quoted text' "$@" export done /usr/bin "$1" /usr/bin echo awk readonly
+		local "$@" echo done test awk sed local && x=1 printf then -eu /usr/bin ${HOME}
+	$(pwd) --verbose local | 'quoted text' printf awk local && --verbose x=1 awk
+	--verbose grep x=1 echo printf readonly cd
+| cd $(pwd) awk done ${HOME} echo echo test awk -eu $(pwd) 2>/dev/null
+		"$1" export x=1 test 2>/dev/null cd echo --verbose && $(pwd) export
+	${HOME} "$@" grep readonly 2>/dev/null -eu $(pwd) 'quoted text'
+		x=1 "$1" | 'quoted text' cd /usr/bin cd "$1" --verbose
+done 'quoted text' printf
+	grep /usr/bin readonly "$1" 2>/dev/null
+"$@" && readonly sed ${HOME} ${HOME} sed readonly
+		--verbose export then | 'quoted text' $(pwd) echo printf 'quoted text'
+done --verbose export sed then sed -eu "$@" echo export && ${HOME}
+local x=1 | 'quoted text' 2>/dev/null sed 2>/dev/null ${HOME} ${HOME} local -eu
+grep --verbose "$1" /usr/bin printf awk
+awk test x=1 ${HOME} 'quoted text'
+x=1 ${HOME} "$1" -eu sed local /usr/bin -eu awk echo readonly
+cd sed sed 2>/dev/null done local x=1 'quoted text' awk awk /usr/bin "$@" "$@"
+local cd | local $(pwd) && export --verbose then --verbose export
+		cd sed 2>/dev/null printf --verbose awk ${HOME} ${HOME} "$@" readonly x=1
+-eu export $(pwd) echo export x=1 sed "$1" export
+	awk awk then test --verbose awk "$1"
+--verbose awk && test "$@" echo printf && -eu test awk readonly 2>/dev/null
+then 'quoted text' /usr/bin printf local $(pwd) 2>/dev/null done && -eu "$@" export
+	then --verbose -eu 'quoted text' x=1 export awk grep 'quoted text'
+	x=1 "$@" printf --verbose
+sed local export awk 2>/dev/null 'quoted text' | export
+x=1 local test echo -eu local
+		/usr/bin local done $(pwd)
+		--verbose ${HOME} echo test /usr/bin -eu export -eu x=1 2>/dev/null printf
+x=1 sed test export -eu && -eu ${HOME} | printf
+		${HOME} "$1" echo 'quoted text' printf | x=1
+		export local && then 2>/dev/null grep "$1" $(pwd) 'quoted text'
+	&& grep printf 2>/dev/null "$@" echo "$@" --verbose local printf local
+	${HOME} --verbose awk grep && 'quoted text' "$@" ${HOME} test "$@" 'quoted text'
+grep "$@" "$@" | /usr/bin sed ${HOME} printf 2>/dev/null
+/usr/bin && && local sed "$@" x=1 2>/dev/null then ${HOME} 'quoted text'
+		-eu export done | x=1 -eu done
+then printf cd $(pwd) local readonly printf
+	local test "$@" echo && then 'quoted text' printf echo 2>/dev/null
+	x=1 readonly then 2>/dev/null | "$@" echo sed --verbose
+	${HOME} && && --verbose /usr/bin done 'quoted text' cd local echo |
+&& x=1 then "$@" 'quoted text' cd ${HOME} x=1 --verbose export readonly
+| "$1" 2>/dev/null 2>/dev/null sed echo -eu /usr/bin grep
+	| grep cd $(pwd) x=1 cd then $(pwd) readonly done &&
+	--verbose "$@" echo "$1"
+		"$@" 2>/dev/null local | awk && grep && /usr/bin "$@"
+		done done $(pwd) ${HOME} then echo && --verbose "$1" awk --verbose echo
+		2>/dev/null $(pwd) x=1 awk grep awk && x=1 printf export
+		${HOME} "$1" --verbose sed "$1" x=1 then
+	-eu cd awk sed awk --verbose
+		echo && "$1" printf local sed 2>/dev/null
+		readonly local "$1" 2>/dev/null | printf local && readonly printf -eu x=1 'quoted text'
+	cd test 'quoted text' printf "$@" local 'quoted text' awk 'quoted text'
+		/usr/bin readonly "$@" x=1 export ${HOME} x=1 -eu echo awk echo
+	local printf $(pwd) readonly 2>/dev/null local echo -eu sed local x=1 $(pwd)
+		echo | printf | --verbose
+		printf && "$1" $(pwd) readonly echo -eu grep --verbose awk sed
+done ${HOME} test readonly 2>/dev/null
+&& | "$1" done x=1 sed --verbose local | then 2>/dev/null -eu printf
+		cd /usr/bin awk cd $(pwd) done sed 2>/dev/null cd x=1 $(pwd) done then export
+export -eu | -eu cd -eu x=1 done sed awk "$@" printf
+printf then --verbose -eu
+	local ${HOME} grep echo 'quoted text'
+	readonly printf "$1" 'quoted text' echo then 2>/dev/null awk |
+done "$@" $(pwd) test /usr/bin "$1" "$@" 2>/dev/null awk local $(pwd)
+export sed test x=1 done && x=1 echo "$1" export sed
+		export then printf grep /usr/bin test x=1 cd then /usr/bin grep && cd
+	2>/dev/null done | test 'quoted text' done awk readonly | readonly --verbose export
+	readonly "$@" test | readonly /usr/bin
+	export echo /usr/bin 2>/dev/null awk &&
+		sed sed ${HOME} local grep echo then "$1" -eu 'quoted text' "$1" local
+"$1" -eu 2>/dev/null 'quoted text' then ${HOME}
+	local --verbose grep then done | grep readonly --verbose
+grep -eu "$@" cd echo ${HOME} && "$@" &&
+grep export x=1 echo $(pwd) | local awk "$@" local /usr/bin x=1 cd
+		"$1" echo x=1 && ${HOME} readonly sed then grep ${HOME} ${HOME} export echo
+		grep 'quoted text' 'quoted text'
+	test "$1" local 'quoted text' "$@" $(pwd)
+		printf test ${HOME} test 'quoted text' cd done local printf readonly
+sed "$@" 'quoted text' 2>/dev/null
+2>/dev/null --verbose awk export x=1 "$@" printf then grep x=1
+	-eu awk test ${HOME} && grep
+		export | ${HOME} done local printf 'quoted text'
+		printf -eu "$@" local /usr/bin "$@" export readonly
+export cd -eu export | |
+	readonly test $(pwd) x=1 printf -eu
+		2>/dev/null echo local cd awk /usr/bin -eu | 'quoted text' cd -eu done 'quoted text'
+		| x=1 readonly x=1 && grep export echo /usr/bin 'quoted text'
+cd then -eu echo "$1" local export && echo sed $(pwd) cd echo "$1"
+		export $(pwd) cd readonly x=1 | readonly $(pwd) cd 2>/dev/null
+		"$@" ${HOME} /usr/bin x=1 awk
+"$1" | export ${HOME} cd readonly
+		| readonly | 'quoted text'
+	&& local test -eu grep "$1"
+		2>/dev/null grep local x=1 printf awk cd && | -eu grep done
+	'quoted text' && 2>/dev/null echo echo 2>/dev/null awk
+${HOME} x=1 'quoted text' awk --verbose
+	done $(pwd) grep sed ${HOME}
+		echo | --verbose 2>/dev/null 'quoted text'
+		awk test grep 2>/dev/null cd then $(pwd) export ${HOME}
+$(pwd) export readonly local readonly awk cd local sed | | cd export
+		$(pwd) then test local -eu 'quoted text' x=1 'quoted text' printf --verbose
+	export echo ${HOME} then done && -eu printf |
+readonly sed "$1" x=1 printf export $(pwd)
+'quoted text' /usr/bin cd done readonly --verbose ${HOME} "$@" awk awk echo "$@"
+export $(pwd) cd "$@" awk cd x=1 local awk
+	grep local local sed awk "$1" local
+	"$@" grep test 2>/dev/null sed export echo printf readonly awk $(pwd)
+	x=1 sed "$1" /usr/bin -eu printf sed export && local "$@" x=1 cd
+'quoted text' 'quoted text' $(pwd) --verbose --verbose
+		echo --verbose && 2>/dev/null -eu local
+	&& cd | echo -eu readonly grep -eu "$1" "$1" /usr/bin cd readonly
+--verbose | | grep ${HOME} $(pwd) printf grep grep x=1 readonly --verbose
+	local sed export "$@" local test local | readonly x=1 readonly test x=1 done
+/usr/bin --verbose awk done "$@" 'quoted text' "$@" grep /usr/bin cd awk
+		&& && readonly test x=1 awk | local -eu sed test echo /usr/bin
+		$(pwd) /usr/bin --verbose x=1 -eu --verbose
+readonly /usr/bin printf 2>/dev/null
+		${HOME} grep cd $(pwd) local 'quoted text' then "$@"
+cd sed export 'quoted text' sed 2>/dev/null $(pwd) $(pwd)
+	--verbose test x=1 sed $(pwd) local printf then printf done test then
+		grep readonly awk "$@" $(pwd) /usr/bin awk sed echo
+		${HOME} cd cd -eu /usr/bin x=1 x=1 printf export echo
+cd local test cd sed cd echo readonly /usr/bin
+/usr/bin -eu /usr/bin |
+		awk done awk | /usr/bin /usr/bin 2>/dev/null done
+	${HOME} test export $(pwd) printf --verbose && cd printf printf "$@" ${HOME}
+		"$1" -eu -eu /usr/bin local /usr/bin "$1" test test 'quoted text'
+		local /usr/bin $(pwd) -eu printf awk echo cd ${HOME} echo cd ${HOME}
+		done | awk /usr/bin awk test then 2>/dev/null
+	sed then 'quoted text' x=1 | --verbose
+	cd --verbose test cd 2>/dev/null $(pwd) | sed --verbose 'quoted text'
+readonly /usr/bin --verbose
+	"$@" sed done ${HOME} done echo awk "$1" sed --verbose
+/usr/bin "$@" sed export ${HOME} export done $(pwd) test | sed
+test --verbose echo done
+		| --verbose export -eu ${HOME} printf printf --verbose -eu
+	test done | echo done done x=1 /usr/bin ${HOME} cd "$@" && "$@" test awk
+| && printf "$@" export grep done then "$1" x=1 "$@" done done awk "$1"
+test then --verbose export /usr/bin
+$(pwd) && | awk awk | && sed echo 'quoted text' && sed echo echo 2>/dev/null
+	then 2>/dev/null | echo grep then awk cd 'quoted text' sed 2>/dev/null 2>/dev/null
+	-eu /usr/bin "$@" x=1 awk echo printf | | then echo test
+	"$@" 2>/dev/null 'quoted text' readonly then readonly
+	"$@" 'quoted text' test ${HOME} test
+printf ${HOME} local export | cd
+printf cd x=1 export 'quoted text' && grep && awk "$@" echo grep $(pwd) sed
+--verbose done | printf test 'quoted text' grep ${HOME}
+	${HOME} test sed "$1" grep "$@" --verbose
+readonly grep "$1" cd /usr/bin test 'quoted text' |
+		printf local export then export done sed
+	cd echo readonly 'quoted text' && echo echo "$@" x=1 "$1" then printf then
+$(pwd) /usr/bin cd sed grep cd
+		printf 'quoted text' "$@" local test "$1" -eu 2>/dev/null ${HOME} "$1"
+	test x=1 sed readonly awk "$@" echo export readonly "$1"
+awk cd export --verbose --verbose -eu -eu
+		sed $(pwd) grep -eu then && -eu && local
+		2>/dev/null --verbose sed ${HOME} local --verbose export awk /usr/bin
+--verbose readonly cd 'quoted text' x=1 && | test local 2>/dev/null
+	2>/dev/null done 'quoted text' echo sed 'quoted text'
+		done --verbose local export cd ${HOME} local cd x=1 /usr/bin -eu cd export
+	done test 'quoted text' echo grep /usr/bin export
+	awk awk && 2>/dev/null export ${HOME} done "$1" printf "$1" readonly printf x=1
+	$(pwd) readonly sed done readonly ${HOME} done grep printf awk readonly test
+		${HOME} "$1" cd export "$1" 'quoted text' | 'quoted text' x=1
+&& -eu printf printf grep echo readonly cd 2>/dev/null
+		readonly sed readonly then awk test -eu echo
+	-eu test 'quoted text' echo awk x=1 cd export printf sed --verbose cd
+	x=1 then readonly done echo $(pwd) 2>/dev/null cd echo | export printf && "$@"
+	local echo x=1 cd local "$@"
+local --verbose /usr/bin x=1 $(pwd) printf echo test
+x=1 cd printf then then /usr/bin done
+	"$1" 2>/dev/null 2>/dev/null test | | | ${HOME}
+	grep 'quoted text' done test -eu "$@" ${HOME} | | --verbose ${HOME} &&
+		printf readonly done $(pwd) --verbose grep sed x=1 printf
+		/usr/bin awk echo ${HOME} /usr/bin then cd
+	printf 'quoted text' echo /usr/bin echo
+	cd test awk $(pwd) "$1" done done 'quoted text'
+	"$@" x=1 x=1 --verbose
+sed "$@" sed awk /usr/bin
+		echo 'quoted text' x=1 then $(pwd) "$1" -eu "$1" awk "$@" "$@" | grep -eu
+		readonly && export -eu cd export grep awk | local ${HOME}
+x=1 awk $(pwd) echo cd export "$@" /usr/bin && local "$1" x=1 x=1 'quoted text'
+		-eu "$@" /usr/bin export readonly x=1 --verbose export done
+		x=1 awk grep test 'quoted text' x=1 echo cd ${HOME} sed 2>/dev/null cd cd test -eu
+		echo sed "$1" cd ${HOME} local --verbose done grep x=1 echo done x=1
+/usr/bin local "$@" "$@" awk printf
+		export --verbose 'quoted text' -eu "$@" test printf "$@" "$1" && printf
+		readonly -eu cd "$@" done 2>/dev/null "$1" -eu cd printf && -eu done -eu sed
+	awk /usr/bin x=1 | /usr/bin
+		-eu grep | then grep /usr/bin test local $(pwd) grep && readonly printf
+	local done grep "$@" export export
+	'quoted text' test sed grep x=1 grep -eu
+2>/dev/null sed then local then $(pwd) "$1" export export test --verbose
+	x=1 readonly /usr/bin test 'quoted text' awk --verbose ${HOME} done
+		$(pwd) done --verbose x=1 && /usr/bin printf $(pwd) echo "$1" x=1
+		done done 'quoted text'
+		| cd printf /usr/bin cd test export $(pwd)
+		${HOME} export grep done 'quoted text'
+	readonly ${HOME} && grep && readonly "$@" printf | cd /usr/bin
+x=1 readonly done export sed awk
+echo ${HOME} $(pwd) grep local
+	then then "$@" x=1 cd --verbose
+	/usr/bin --verbose cd | && local awk
+	echo --verbose export awk
+	grep x=1 --verbose 2>/dev/null 2>/dev/null awk cd cd
+		echo export --verbose printf cd awk sed cd ${HOME} readonly x=1 export &&
+${HOME} then done && export export echo $(pwd) sed "$1"
+	then "$1" -eu export --verbose
+	local x=1 ${HOME} export
+		"$1" cd "$1" test "$1" readonly export --verbose grep
+		local export test export printf grep 'quoted text' /usr/bin cd done "$1" 'quoted text'
+		${HOME} "$1" sed "$1" "$@" test then -eu
+&& -eu 'quoted text' printf
+	done ${HOME} cd test "$1"
+		${HOME} readonly then 'quoted text' grep $(pwd)
+	grep awk printf 2>/dev/null done $(pwd) ${HOME}
+test cd x=1 -eu local awk local grep sed export $(pwd)
+	readonly 'quoted text' x=1
+		printf cd "$1" then && awk done export 2>/dev/null
+local then export sed test printf x=1 && 2>/dev/null grep local
+-eu printf --verbose $(pwd)
+"$@" x=1 --verbose 'quoted text' local local | cd ${HOME} readonly
+	printf awk $(pwd) readonly export
+		local local sed x=1 'quoted text'
+		2>/dev/null --verbose -eu /usr/bin 2>/dev/null
+2>/dev/null export then then 'quoted text' readonly /usr/bin x=1 x=1
+| local "$@" echo local | "$@" 'quoted text'
+	then echo /usr/bin export done x=1 done | /usr/bin --verbose x=1
+	"$1" /usr/bin $(pwd) sed x=1 'quoted text' $(pwd) 2>/dev/null
+grep then "$1" done | grep echo x=1 local
+--verbose awk local echo sed export && done -eu "$1" ${HOME} readonly /usr/bin
+		local local 'quoted text' sed readonly awk && cd 2>/dev/null
+		readonly export echo x=1 -eu /usr/bin echo x=1 local
+	printf && grep | awk ${HOME} ${HOME} done x=1 cd grep "$1" -eu ${HOME}
+${HOME} ${HOME} sed grep export test awk /usr/bin && echo $(pwd) export readonly
+		done --verbose && local /usr/bin
+awk | $(pwd) 'quoted text' printf -eu $(pwd)
+local export readonly 2>/dev/null
+$(pwd) awk export 2>/dev/null $(pwd) printf printf sed $(pwd) 'quoted text' cd
+	-eu then "$1" | --verbose
+		${HOME} x=1 echo local awk
+	local 'quoted text' echo echo then printf readonly && --verbose grep then sed
+		printf grep then x=1
+readonly export x=1 echo "$@" 2>/dev/null local /usr/bin
+$(pwd) local "$1" grep then --verbose grep then
+	done awk export x=1 2>/dev/null export $(pwd) then local done sed then sed local
+sed echo local $(pwd) "$1" /usr/bin -eu /usr/bin awk $(pwd)
+	/usr/bin grep ${HOME} echo sed test "$1" then done export export
+test "$1" --verbose -eu readonly ${HOME} readonly ${HOME} cd "$1"
+	-eu "$@" 'quoted text' readonly --verbose
+grep /usr/bin awk "$@" 'quoted text'
+		&& then printf printf grep && then cd then export 'quoted text'
+		--verbose then "$@" then | 'quoted text'
+	local grep 2>/dev/null export printf ${HOME} test --verbose
+	grep printf /usr/bin echo printf "$1" x=1 sed "$@" local export
+		test sed test then /usr/bin $(pwd) "$1" "$1" cd -eu $(pwd)
+test "$@" printf echo awk awk local printf local --verbose printf | sed readonly
+$(pwd) local echo sed test cd
+		$(pwd) --verbose 'quoted text' sed done done readonly 'quoted text'
+	2>/dev/null "$@" cd --verbose /usr/bin then printf done --verbose readonly
+${HOME} x=1 /usr/bin "$1" grep then -eu awk /usr/bin "$@"
+readonly x=1 /usr/bin --verbose readonly 2>/dev/null
+cd 'quoted text' 'quoted text' x=1 echo readonly
+readonly 2>/dev/null x=1 test | "$1" "$@" local done readonly awk
+		--verbose then | 'quoted text' done
+		${HOME} ${HOME} export cd "$@" sed 'quoted text' echo 2>/dev/null
+-eu awk ${HOME} awk "$1" /usr/bin echo "$1" awk ${HOME} $(pwd) grep cd awk sed
+		"$1" $(pwd) export export /usr/bin done
+2>/dev/null -eu test sed | /usr/bin readonly test | test &&
+	$(pwd) 'quoted text' "$@" && then --verbose printf export awk echo grep
+awk local readonly -eu 2>/dev/null
+	&& export --verbose test
+readonly -eu 2>/dev/null -eu | test cd 'quoted text'
+x=1 'quoted text' grep printf done sed "$1" sed done done done --verbose x=1
+	"$@" local /usr/bin local -eu then "$@" cd 2>/dev/null x=1 test export
+	--verbose && $(pwd) grep export
+	-eu $(pwd) awk 'quoted text'
+	cd readonly readonly && --verbose "$@" test 2>/dev/null
+		then -eu $(pwd) then then cd $(pwd) printf 2>/dev/null readonly
+	sed then "$@" cd | $(pwd) $(pwd)
+		&& --verbose echo cd | grep 'quoted text' export $(pwd) /usr/bin
+	"$1" | readonly readonly then echo cd
+	printf export $(pwd) -eu
+	echo grep /usr/bin && ${HOME} test done /usr/bin done x=1
+		"$@" printf then test printf export
+		local sed 'quoted text' then
+		then /usr/bin echo export && done local
+	printf 2>/dev/null "$1" $(pwd) grep -eu cd "$@" export readonly
+	'quoted text' x=1 test printf
+	export "$@" --verbose then
+	export | "$@" cd "$@" export sed && export awk --verbose
+${HOME} 'quoted text' cd grep 'quoted text' cd | sed $(pwd) echo then
+readonly echo sed -eu $(pwd) grep echo readonly "$@" test -eu --verbose test $(pwd)
+	readonly x=1 cd then cd export
+	readonly export 2>/dev/null x=1 -eu awk awk cd /usr/bin ${HOME} && test 'quoted text'
+		grep /usr/bin 2>/dev/null export local then --verbose test awk printf awk local
+	--verbose done export cd 'quoted text' ${HOME} "$@"
+printf then then echo /usr/bin -eu local then echo
+${HOME} -eu sed local sed readonly $(pwd) awk 2>/dev/null sed done -eu "$@" awk
+	printf "$1" cd done echo sed local ${HOME} sed -eu then
+done ${HOME} 'quoted text' && cd "$@"
+echo "$1" local "$@" ${HOME} x=1 "$@" "$@"
+done -eu awk && sed done printf -eu test printf
+		"$@" "$1" 2>/dev/null "$1" awk /usr/bin "$1" echo "$@" && 2>/dev/null
+-eu --verbose 'quoted text' test cd | then -eu test && "$1" "$@"
+#include c121.sh
+&& 2>/dev/null && readonly "$1"
+	-eu awk then x=1 x=1 2>/dev/null | -eu export $(pwd) 2>/dev/null
+printf cd "$@" "$1" cd "$1" test echo ${HOME} done done $(pwd) then
+local sed local grep | x=1 then && /usr/bin
+--verbose x=1 /usr/bin | then cd -eu awk -eu
+echo --verbose export printf readonly local --verbose
+sed awk --verbose echo local 'quoted text'
+		--verbose done 'quoted text' sed "$1" local /usr/bin export -eu /usr/bin
+"$@" x=1 --verbose -eu x=1 done readonly cd $(pwd) grep local $(pwd) grep grep
+-eu $(pwd) grep local readonly --verbose -eu 2>/dev/null grep
+		&& 2>/dev/null && sed export | /usr/bin done /usr/bin
+	printf -eu --verbose printf x=1
+		printf 2>/dev/null printf export echo echo grep "$1"
+'quoted text' -eu $(pwd) "$@" readonly 2>/dev/null echo && printf | printf
+		grep "$1" | local export "$1" | done && sed printf && echo 'quoted text'
+--verbose grep then echo && 2>/dev/null export $(pwd) awk cd done echo
+		test | -eu $(pwd) 'quoted text'
+awk done then printf then sed cd --verbose done export 'quoted text'
+local "$1" done && "$@"
+		cd /usr/bin sed x=1 x=1 -eu && 'quoted text' -eu && --verbose --verbose
+		grep 2>/dev/null printf 2>/dev/null && 2>/dev/null $(pwd) && sed then
+$(pwd) $(pwd) --verbose 2>/dev/null 2>/dev/null /usr/bin "$@" $(pwd) awk /usr/bin
+		export "$@" $(pwd) echo ${HOME} --verbose then awk 'quoted text' "$@" | done
+"$1" done 'quoted text'
+		awk then x=1 x=1 x=1 --verbose sed $(pwd) "$@" --verbose done grep export
+	awk --verbose /usr/bin /usr/bin
+	'quoted text' ${HOME}
+		$(pwd) 2>/dev/null ${HOME} |
+/usr/bin export $(pwd) -eu | echo local /usr/bin "$@" grep sed $(pwd) -eu export
+-eu test awk test printf /usr/bin printf sed readonly
+		local ${HOME} $(pwd) sed --verbose ${HOME}
+'quoted text' test then ${HOME} -eu export -eu --verbose | export awk export
+	"$1" readonly echo grep echo | "$@" /usr/bin -eu cd echo "$1" --verbose
+awk -eu local readonly echo cd awk 2>/dev/null printf
+		printf then -eu then then printf then then test export awk
+-eu export && sed test && ${HOME} printf
+		/usr/bin --verbose echo grep "$@" 'quoted text'
+	&& --verbose printf done -eu /usr/bin sed && "$1"
+	${HOME} | echo echo "$1" export $(pwd) printf "$@" awk local "$@" then
+2>/dev/null --verbose awk -eu then |
+	--verbose local printf "$1" /usr/bin then then sed x=1 echo readonly
+cd done $(pwd) "$@" | then x=1 local readonly grep export awk
+		$(pwd) local "$1" then echo then | sed local "$@" "$1" grep $(pwd) grep echo
+cd /usr/bin 2>/dev/null /usr/bin
+	printf 'quoted text' 'quoted text' "$@" then 2>/dev/null
+then grep && cd export cd readonly test --verbose cd sed
+	x=1 grep echo "$@" local done "$1" && export ${HOME} done export readonly
+		x=1 --verbose /usr/bin "$@" sed "$1" echo "$1" "$1" readonly
+done "$@" "$1" ${HOME} 2>/dev/null
+	&& readonly 'quoted text' --verbose
+	'quoted text' local && /usr/bin "$@" local printf $(pwd) export
+	--verbose -eu cd x=1 && -eu /usr/bin | local 2>/dev/null readonly test
+		sed --verbose "$@" 2>/dev/null 'quoted text' cd done awk 'quoted text' awk -eu
+		x=1 done grep grep then 2>/dev/null awk --verbose -eu 2>/dev/null export ${HOME}
+	x=1 $(pwd) 2>/dev/null /usr/bin --verbose
+		"$@" readonly -eu printf echo --verbose local "$1" "$@" 'quoted text' done local
+		$(pwd) ${HOME} 2>/dev/null readonly "$1" local readonly
+		/usr/bin readonly printf sed printf done
+| local $(pwd) printf done 'quoted text' ${HOME}
+	"$@" | echo 'quoted text' local ${HOME} $(pwd) readonly export
+	&& cd printf $(pwd) $(pwd) printf sed && -eu /usr/bin
+	test 2>/dev/null -eu awk && 'quoted text' cd /usr/bin cd ${HOME} test
+cd awk "$@" grep test | $(pwd) && printf
+$(pwd) awk $(pwd) test /usr/bin
+		'quoted text' x=1 -eu printf
+	then /usr/bin $(pwd) printf 'quoted text'
+awk /usr/bin "$@" awk export $(pwd) -eu sed x=1 x=1 | then /usr/bin test --verbose
+		sed 2>/dev/null "$1" 2>/dev/null local
+printf && ${HOME} done ${HOME} $(pwd) 'quoted text' "$1" echo x=1 local 2>/dev/null
+then cd && | -eu && sed 2>/dev/null test printf && test printf
+/usr/bin cd /usr/bin grep | then then $(pwd)
+		'quoted text' $(pwd) -eu cd awk awk cd && | /usr/bin "$@"
+	awk && 'quoted text' grep "$@" echo $(pwd) --verbose "$@" ${HOME}
+	done -eu printf ${HOME} then export 'quoted text'
+		/usr/bin sed echo --verbose test readonly then sed
+grep && sed /usr/bin --verbose local test ${HOME} then test
+	/usr/bin awk readonly $(pwd) local cd "$1" local local "$1" done sed printf x=1
+		grep -eu then printf done $(pwd) "$1" readonly awk local
+	awk readonly | && | cd test cd $(pwd)
+| --verbose printf $(pwd) test "$1" | | awk -eu sed
+		"$1" 'quoted text' export
+	echo sed 2>/dev/null cd ${HOME} x=1
+test && | --verbose export cd sed printf $(pwd)
+export --verbose readonly awk printf grep
+	x=1 /usr/bin --verbose printf $(pwd) test "$@" test grep && x=1 sed $(pwd) /usr/bin
+printf x=1 "$@" "$@" echo readonly
+		/usr/bin "$1" && export
+echo x=1 test --verbose then cd --verbose 2>/dev/null -eu "$@" printf test
+		readonly local ${HOME} -eu /usr/bin 'quoted text'
+	${HOME} ${HOME} grep export echo "$@" -eu 2>/dev/null printf
+		cd test 2>/dev/null test && $(pwd) readonly local readonly
+test $(pwd) /usr/bin "$1" sed export local x=1 --verbose -eu $(pwd) test
+${HOME} done export && awk 'quoted text'
+x=1 -eu printf test export awk "$1" test local /usr/bin --verbose
+		--verbose 2>/dev/null /usr/bin export "$@" awk 2>/dev/null
+		readonly sed --verbose cd sed x=1 --verbose
+		export sed | printf then "$@" $(pwd) -eu done | test awk 'quoted text'
+	sed readonly export printf x=1 echo cd printf $(pwd) grep echo ${HOME}
+grep --verbose readonly "$1" done 2>/dev/null done done sed readonly local
+then 'quoted text' "$@" --verbose awk echo test local
+/usr/bin sed 'quoted text' then awk sed
+printf -eu 'quoted text' export printf
+	'quoted text' "$1" && grep "$@" local && readonly
+echo "$@" then done echo echo x=1 done
+	--verbose && x=1 ${HOME} done awk $(pwd) $(pwd) sed grep export
+then "$@" sed -eu export export
+	echo $(pwd) /usr/bin then 'quoted text' then 2>/dev/null
+		echo echo readonly printf readonly
+	--verbose readonly "$@" local -eu "$@" export
+	-eu 'quoted text' 'quoted text' && local export then 'quoted text'
+		sed --verbose printf readonly cd 'quoted text'
+/usr/bin export cd | /usr/bin echo ${HOME} "$1" sed echo $(pwd)
+	done cd test ${HOME} && |
+&& printf grep readonly 'quoted text' readonly readonly
+	"$1" /usr/bin "$@" done test | 2>/dev/null -eu then test readonly
+		grep 2>/dev/null /usr/bin export $(pwd) 'quoted text' /usr/bin done cd && awk &&
+		cd "$1" readonly echo test done export $(pwd) printf test
+	-eu echo grep "$1" $(pwd) sed && awk /usr/bin /usr/bin local cd /usr/bin
+	| $(pwd) then then ${HOME} done -eu cd export | awk printf
+		| readonly x=1 | x=1 /usr/bin readonly export then then echo /usr/bin done
+	/usr/bin printf "$1" readonly ${HOME}
+	sed done then 2>/dev/null | /usr/bin export
+		/usr/bin readonly ${HOME}
+	-eu /usr/bin sed "$1" && x=1 "$1" awk awk && 'quoted text'
+	readonly "$@" test x=1 --verbose --verbose
+		cd x=1 'quoted text' awk echo readonly
+sed | echo $(pwd) export local echo $(pwd)
+${HOME} cd done done "$@" 2>/dev/null echo 2>/dev/null export then --verbose -eu
+	&& | sed "$1" 'quoted text' 'quoted text'
+echo x=1 export /usr/bin
+"$@" echo test sed 2>/dev/null
+sed local x=1 'quoted text'
+readonly export grep local then ${HOME} printf grep then awk grep
+	grep then ${HOME} readonly
+	test "$1" done ${HOME} test | && /usr/bin $(pwd) readonly -eu | printf
+	then $(pwd) export then sed sed | && 'quoted text'
+		"$@" "$@" done ${HOME}
+export x=1 $(pwd) x=1 grep test echo sed x=1 'quoted text' "$@" &&
+		readonly sed /usr/bin readonly && -eu test echo "$@" | $(pwd) grep --verbose
+	then local | ${HOME} && x=1 sed sed 'quoted text' cd "$1"
+	'quoted text' cd | ${HOME} --verbose ${HOME} 'quoted text' sed echo --verbose
+x=1 $(pwd) && test readonly sed && $(pwd) | grep && x=1 -eu $(pwd) ${HOME}
+'quoted text' 'quoted text' cd | 'quoted text'
+awk 'quoted text' /usr/bin echo "$@" x=1
+"$@" && then x=1 echo awk readonly export && done /usr/bin "$1" /usr/bin
+		export local 2>/dev/null echo | cd echo printf &&
+x=1 printf "$1" /usr/bin 'quoted text'
+x=1 echo test echo ${HOME} done done
+--verbose --verbose done --verbose grep x=1 | x=1
+		'quoted text' readonly awk "$1" -eu --verbose
+		sed cd --verbose export x=1 -eu /usr/bin "$@" ${HOME} sed
+		2>/dev/null readonly /usr/bin $(pwd) ${HOME}
+2>/dev/null printf "$1" $(pwd) export readonly
+		--verbose -eu done export echo cd printf 'quoted text' "$1" echo "$1"
+	--verbose $(pwd) grep 2>/dev/null test x=1 done readonly
+2>/dev/null echo printf "$1" done grep readonly 'quoted text' 'quoted text'
+$(pwd) "$@" export export printf && "$1" -eu done 2>/dev/null --verbose
+grep ${HOME} --verbose test then
+	cd readonly -eu echo /usr/bin --verbose 2>/dev/null
+	| cd test ${HOME} then 2>/dev/null x=1 printf ${HOME} local done then |
+	&& then local then awk cd "$@" -eu
+	'quoted text' 'quoted text' 'quoted text' printf $(pwd) -eu echo
+'quoted text' "$@" sed $(pwd) "$@" local x=1 $(pwd) export grep "$1" && readonly
+${HOME} | && test grep ${HOME} && && then "$@" then x=1 /usr/bin
+		done then echo --verbose x=1 --verbose local && local grep | awk
+		| ${HOME} 'quoted text' 2>/dev/null
+${HOME} ${HOME} -eu /usr/bin export cd /usr/bin "$@" cd then --verbose
+	cd echo 2>/dev/null readonly grep && | /usr/bin grep grep x=1 "$1"
+cd x=1 echo --verbose then && then local | -eu "$@" echo $(pwd) "$@"
+/usr/bin sed grep local /usr/bin then 'quoted text' /usr/bin x=1 $(pwd) /usr/bin
+		test x=1 $(pwd) local $(pwd) then
+	/usr/bin printf awk "$1" readonly --verbose
+export done "$1" awk /usr/bin -eu /usr/bin $(pwd) /usr/bin export
+	then 2>/dev/null awk /usr/bin "$@" echo grep 2>/dev/null x=1 readonly
+	then then "$1" 2>/dev/null test grep /usr/bin awk "$@" -eu awk readonly
+${HOME} readonly then "$@"
+	&& export -eu local cd grep local ${HOME} --verbose grep readonly /usr/bin readonly
+	| printf test "$@" done
+		| --verbose $(pwd) grep export $(pwd)
+$(pwd) | echo export done
+cd test $(pwd) ${HOME} echo "$1" awk cd echo
+echo test && --verbose
+	local local test printf --verbose grep
+echo x=1 ${HOME} x=1 | /usr/bin done x=1
+-eu | --verbose ${HOME} "$1"
+	-eu $(pwd) sed printf
+	/usr/bin "$1" awk done -eu sed
+		| /usr/bin export && x=1 "$@" /usr/bin
+	--verbose grep test /usr/bin
+&& awk awk export awk ${HOME}
+test --verbose && sed grep sed echo echo printf && "$@" "$@" "$1" x=1
+	&& && "$1" 2>/dev/null -eu "$1" -eu $(pwd) ${HOME} && /usr/bin
+		"$@" echo && && -eu echo "$@" cd /usr/bin ${HOME} $(pwd) ${HOME} local
+	export grep 2>/dev/null printf grep export "$1" -eu "$1" "$1" /usr/bin echo grep
+test printf awk "$@" grep x=1 sed export "$1" echo 2>/dev/null
+done --verbose test 'quoted text' cd x=1 export
+		'quoted text' "$@" cd sed && && /usr/bin test
+	2>/dev/null | sed echo local done grep cd ${HOME} --verbose
+		done | | "$@" && then $(pwd) local
+printf readonly ${HOME} x=1 grep /usr/bin && && "$@" local cd test -eu ${HOME}
+test export sed 'quoted text' local
+"$@" done -eu $(pwd) | 2>/dev/null && "$1" grep sed awk sed --verbose sed
+		test printf --verbose | done cd printf export awk readonly
+	cd $(pwd) x=1 grep $(pwd) | export --verbose
+-eu 2>/dev/null x=1 "$@" echo
+	awk awk ${HOME} /usr/bin printf "$1" sed export && $(pwd) &&
+$(pwd) /usr/bin ${HOME} $(pwd) x=1 export local test sed
+awk /usr/bin export ${HOME} cd && $(pwd) local
+	awk grep done export && cd export sed --verbose
+	'quoted text' "$1" && 2>/dev/null 'quoted text' echo /usr/bin 2>/dev/null
+	cd cd test $(pwd) x=1 printf sed test && printf 2>/dev/null
+	done readonly "$@" /usr/bin "$1" /usr/bin local export "$1" test done
+		sed then readonly grep done | printf
+sed printf ${HOME} echo printf cd local && x=1 && echo then
+sed cd export local local done then test then then readonly
+	local --verbose export
+done printf "$1" --verbose local
+$(pwd) --verbose | 2>/dev/null ${HOME} awk 'quoted text'
+	'quoted text' /usr/bin /usr/bin done "$@" $(pwd) cd --verbose x=1 sed 'quoted text'
+		cd echo --verbose echo "$@" sed "$@" "$1" $(pwd) echo sed grep
+local ${HOME} local -eu
+		x=1 -eu printf ${HOME} local echo then awk 2>/dev/null awk export
+		cd && /usr/bin "$1" readonly
+/usr/bin ${HOME} then sed
+		--verbose -eu -eu -eu "$1" 2>/dev/null
+		awk export then "$@" local "$1" ${HOME} "$@" printf readonly
+	grep "$1" ${HOME} cd -eu
+		2>/dev/null done $(pwd) export done
+	-eu test /usr/bin test readonly && export awk
+	echo cd printf ${HOME} cd export
+		echo test echo done sed "$1" --verbose
+	"$1" 2>/dev/null test echo echo -eu | printf sed
+		sed echo 'quoted text' 2>/dev/null 'quoted text' done awk -eu printf "$1"
+		local export 'quoted text' ${HOME} printf readonly local
+cd && export echo ${HOME} cd test awk 'quoted text' sed echo then sed /usr/bin
+local --verbose done -eu readonly 2>/dev/null
+		awk grep printf cd 2>/dev/null test cd readonly export ${HOME} printf
+	/usr/bin readonly /usr/bin readonly "$@" | $(pwd) | grep export "$@" 'quoted text'
+		"$@" && --verbose test sed sed && export cd grep
+	readonly | local x=1 cd | "$1" test done readonly /usr/bin /usr/bin "$@"
+		then local test readonly test readonly --verbose awk printf readonly -eu test
+		$(pwd) cd $(pwd) sed grep export
+sed 2>/dev/null awk | readonly local awk x=1 then printf export echo readonly
+	then && 2>/dev/null export sed
+		'quoted text' && && export sed && readonly
+done printf $(pwd) x=1 awk
+	"$@" -eu then x=1 -eu x=1 'quoted text' /usr/bin 'quoted text'
+printf readonly echo readonly | | done sed test "$1" test grep
+x=1 test sed awk x=1 && && 2>/dev/null
+	"$1" "$1" && then printf cd local $(pwd) ${HOME} -eu "$@" -eu
+"$1" $(pwd) 2>/dev/null local --verbose echo printf ${HOME} -eu 2>/dev/null test
+	printf | awk x=1 printf "$@"
+		local ${HOME} ${HOME} cd readonly
+local "$1" echo export export readonly test printf x=1 export
+local 'quoted text' local export local 2>/dev/null
+	then awk printf readonly 'quoted text'
+		/usr/bin local /usr/bin 'quoted text' "$1" local awk --verbose echo x=1 awk
+2>/dev/null "$@" grep readonly && test readonly && x=1 printf local "$@" readonly
+test echo sed && local grep sed && x=1 local echo
+	printf echo 'quoted text' export | sed --verbose x=1
+cd readonly sed printf x=1 | readonly && && ${HOME} 2>/dev/null sed
+		"$1" ${HOME} x=1 printf 'quoted text' && /usr/bin 'quoted text' 'quoted text'
+		export export test export
+printf ${HOME} test 2>/dev/null --verbose printf awk "$1" && 'quoted text'
+test grep x=1 then readonly ${HOME} test -eu $(pwd) ${HOME}
+	echo export --verbose sed echo 2>/dev/null
+cd ${HOME} test grep 'quoted text' 'quoted text' $(pwd) 'quoted text'
+		local "$@" done && --verbose local "$1" test readonly -eu
+	-eu echo readonly --verbose grep cd test /usr/bin awk readonly
+		/usr/bin $(pwd) --verbose "$1" test echo "$1" $(pwd)
+		export ${HOME} /usr/bin && export cd sed then
+	readonly export --verbose ${HOME} cd "$@" cd
+export readonly --verbose ${HOME} sed done sed echo test export done $(pwd)
+		grep "$@" cd echo x=1 echo 'quoted text'
+		echo echo $(pwd) "$1" cd 'quoted text' "$1" | done "$1"
+readonly x=1 /usr/bin --verbose cd -eu 2>/dev/null sed readonly
+	&& -eu sed ${HOME} --verbose -eu export grep
+	--verbose -eu export echo "$@" ${HOME} readonly 'quoted text' --verbose readonly
+done "$1" 2>/dev/null /usr/bin then grep readonly -eu x=1 local grep x=1 done -eu
+"$@" test /usr/bin && local
+	2>/dev/null | | grep done $(pwd) $(pwd) done awk x=1
+-eu done x=1 printf test readonly printf "$@" 'quoted text'
+printf x=1 grep echo -eu /usr/bin -eu echo echo x=1
+		2>/dev/null 'quoted text' -eu done -eu export x=1 x=1
+		done "$@" | cd cd ${HOME} local $(pwd) $(pwd) | 2>/dev/null && 2>/dev/null
+	echo test done readonly "$@"
+-eu export $(pwd) && && --verbose $(pwd)
+x=1 && && 'quoted text' grep x=1 local -eu cd --verbose sed 'quoted text' cd grep
+	| && "$1" cd then && done echo /usr/bin
+		done sed echo "$@" sed | sed sed sed readonly
+		'quoted text' | ${HOME} cd done /usr/bin $(pwd) x=1 done
+'quoted text' done local "$@" cd /usr/bin -eu cd awk --verbose -eu 'quoted text'
+${HOME} ${HOME} grep grep
+	2>/dev/null echo "$@" export "$@" done --verbose ${HOME}
+	${HOME} test local -eu echo readonly grep -eu --verbose
+"$1" x=1 2>/dev/null "$1" 2>/dev/null printf && done /usr/bin x=1
+		x=1 awk awk && printf local done $(pwd) -eu printf export 'quoted text' $(pwd)
+		'quoted text' 'quoted text' /usr/bin
+	readonly cd done ${HOME} export "$1"
+	"$1" readonly /usr/bin grep
+		sed -eu readonly echo 2>/dev/null export export grep awk -eu
+		then grep export && --verbose
+		'quoted text' sed 'quoted text'
+	"$@" 2>/dev/null readonly cd test cd /usr/bin
+		| test readonly 2>/dev/null awk 'quoted text'
+		then --verbose 'quoted text' sed then awk "$@" done done | printf then
+	test 2>/dev/null $(pwd) /usr/bin -eu
+		printf then "$@" test export test export test
+		2>/dev/null test ${HOME} x=1 --verbose
+	--verbose 'quoted text' 2>/dev/null -eu then "$@" -eu
+sed | cd echo export x=1 sed --verbose cd 'quoted text' ${HOME}
+	done $(pwd) --verbose /usr/bin awk ${HOME} "$@" test grep && -eu readonly
+	done ${HOME} x=1 ${HOME} done echo test then
+		$(pwd) local ${HOME} local
+	2>/dev/null $(pwd) x=1 printf done $(pwd) "$1" ${HOME} 'quoted text'
+echo /usr/bin export cd cd "$@" awk -eu export 2>/dev/null
+	"$1" --verbose $(pwd) 2>/dev/null --verbose ${HOME} grep
+		&& cd 'quoted text' --verbose done && | x=1 /usr/bin export
+echo x=1 test | then local export 'quoted text' -eu done
+${HOME} x=1 | then echo 'quoted text'
+		echo awk "$1" "$@" export x=1 /usr/bin "$1" 'quoted text'
+awk 'quoted text' && local /usr/bin --verbose
+		readonly done export awk x=1 "$1" "$1" x=1 readonly
+		sed && "$@" readonly cd | export
+	cd $(pwd) test awk cd sed x=1 grep done &&
+	x=1 ${HOME} done readonly --verbose local 'quoted text' "$1" sed /usr/bin printf
+		$(pwd) && $(pwd) cd done "$1"
+grep --verbose readonly echo test test awk --verbose cd awk /usr/bin
+	test | done then "$1" cd $(pwd) | printf sed "$1" /usr/bin local 'quoted text'
+	$(pwd) "$1" "$@" && echo /usr/bin export
+	"$@" export && x=1 $(pwd) export && readonly
+export sed done grep test
+grep $(pwd) then test
+export local "$@" then export
+then $(pwd) && -eu sed
+		"$1" 'quoted text' echo
+		| 2>/dev/null /usr/bin awk printf
+		--verbose echo $(pwd) x=1
+		"$1" then sed cd readonly grep "$1" awk done -eu && test ${HOME}
+		${HOME} 'quoted text' /usr/bin
+	done "$1" -eu x=1 'quoted text' "$1" "$1" echo
+readonly "$@" x=1 x=1 $(pwd) "$@" -eu 'quoted text' then echo x=1 awk echo local
+"$@" local && awk then then 'quoted text' printf /usr/bin -eu
+x=1 ${HOME} sed done /usr/bin done --verbose | then test -eu echo export
+	--verbose $(pwd) --verbose "$@" sed $(pwd) test then readonly
+	readonly x=1 "$@" export x=1 --verbose printf x=1
+		awk ${HOME} test $(pwd) cd 2>/dev/null &&
+		"$@" readonly x=1 'quoted text' sed x=1 2>/dev/null cd
+	2>/dev/null 'quoted text' && "$@" echo /usr/bin && && $(pwd)
+		then | export done test
+	echo && 'quoted text'
+grep ${HOME} ${HOME} printf --verbose ${HOME} awk 2>/dev/null
+echo | export then test -eu test cd -eu printf
+	grep readonly | && -eu readonly "$1" then local
+	/usr/bin 'quoted text' readonly then sed echo then done awk "$1" grep
+	grep && -eu "$@" printf test
+"$1" printf local -eu awk readonly ${HOME} ${HOME}
+${HOME} test local -eu $(pwd) -eu
+		cd --verbose awk printf
+		--verbose done test awk "$@" then "$1"
+2>/dev/null echo /usr/bin | test -eu && test cd 2>/dev/null x=1 sed ${HOME}
+	local readonly "$1" --verbose --verbose then x=1
+		sed echo export && --verbose cd awk 2>/dev/null
+| x=1 -eu then "$1" test --verbose then cd $(pwd)
+local local "$1" /usr/bin --verbose local readonly --verbose
+		local | $(pwd) local then export
+	$(pwd) "$@" /usr/bin grep local | | test --verbose
+		${HOME} x=1 -eu sed readonly sed 'quoted text' sed "$@" sed
+done ${HOME} grep $(pwd) printf printf
+2>/dev/null "$@" grep $(pwd) then grep then 2>/dev/null export readonly echo ${HOME}
+/usr/bin cd readonly 2>/dev/null test 'quoted text' printf local test then printf
+'quoted text' | x=1 readonly
+/usr/bin x=1 ${HOME} "$1" readonly
+		${HOME} done test done --verbose 'quoted text' $(pwd) && -eu ${HOME} printf
+	echo | export readonly 'quoted text' && ${HOME}
+		/usr/bin x=1 ${HOME} done printf grep -eu cd export ${HOME} -eu
+	-eu 2>/dev/null local grep sed --verbose /usr/bin $(pwd) readonly
+	awk "$1" ${HOME} echo readonly grep local 2>/dev/null grep done
+	readonly /usr/bin awk /usr/bin x=1 -eu printf 'quoted text' $(pwd) "$1"
+		"$@" /usr/bin $(pwd) --verbose "$@" export "$@" -eu $(pwd)
+		"$@" echo cd test -eu readonly sed "$@" then
+		-eu x=1 export && then cd "$1" | -eu "$1"
+	done ${HOME} local test done export sed "$1" grep /usr/bin
+x=1 grep done then "$1" 'quoted text' -eu grep
+		| -eu awk printf 'quoted text' echo -eu done readonly sed readonly x=1 readonly
+		local then | echo ${HOME} $(pwd) echo grep printf 'quoted text'
+"$@" readonly echo local --verbose local printf local
+		then --verbose 'quoted text' readonly
+--verbose local printf local
+	-eu 2>/dev/null awk local && grep readonly -eu /usr/bin readonly export test
+	2>/dev/null local done readonly "$1" ${HOME} test export then
+	echo sed 'quoted text'
+		--verbose echo printf sed -eu "$@" $(pwd)
+		readonly "$@" then sed 2>/dev/null
+then printf $(pwd) | then /usr/bin 'quoted text' "$1" 2>/dev/null /usr/bin
+	then $(pwd) "$1" "$@" ${HOME}
+'quoted text' local --verbose "$@" "$1" "$@" then 'quoted text' --verbose
+"$@" local readonly grep readonly sed "$@" printf printf echo grep done test
+test x=1 | awk grep cd "$@" 2>/dev/null test | --verbose ${HOME} "$@" cd
+export printf $(pwd) /usr/bin 2>/dev/null readonly cd -eu 2>/dev/null
+		${HOME} 'quoted text' ${HOME} $(pwd) "$@" done 'quoted text' 2>/dev/null
+"$1" 2>/dev/null -eu | printf
+-eu && then && ${HOME} ${HOME}
+	2>/dev/null ${HOME} printf export
+		echo echo echo -eu /usr/bin "$@" ${HOME}
+		/usr/bin test done ${HOME} -eu 'quoted text'
+| | 'quoted text' | local 'quoted text' /usr/bin ${HOME}
+		awk /usr/bin then cd export
+		"$1" printf export echo $(pwd) 'quoted text'
+		${HOME} printf | "$1" /usr/bin grep readonly -eu ${HOME} awk awk --verbose printf
+		grep -eu 'quoted text' "$@" awk -eu 'quoted text'
+	local sed sed test && then awk
+cd "$@" --verbose export done export grep $(pwd) 2>/dev/null -eu sed "$@"
+	export "$1" done readonly | $(pwd)
+grep --verbose | | $(pwd) x=1
+awk done then test done $(pwd) --verbose
+	'quoted text' printf && printf x=1 grep printf x=1 local awk --verbose 2>/dev/null
+		-eu --verbose export /usr/bin cd export && test --verbose awk then x=1
+	'quoted text' && printf grep awk local "$1" x=1 then readonly
+	"$1" | local ${HOME} "$1" local test
+	then ${HOME} export 2>/dev/null
+-eu done then echo export ${HOME}
+		export && | grep --verbose --verbose 2>/dev/null x=1 local -eu readonly
+	grep 2>/dev/null done then $(pwd) export
+grep cd --verbose test readonly -eu $(pwd) -eu 2>/dev/null
+done grep done readonly -eu cd then /usr/bin
+	echo grep 'quoted text' sed cd echo sed --verbose
+	| readonly done test done x=1 export printf local $(pwd) awk 'quoted text'
+		"$1" ${HOME} echo local echo --verbose test cd sed awk sed
+sed --verbose "$1" -eu "$1" export cd
+	${HOME} test $(pwd) --verbose
+${HOME} cd awk done "$@" "$@" ${HOME} $(pwd) -eu --verbose grep cd --verbose
+	| && --verbose --verbose "$@" --verbose 'quoted text' printf ${HOME} -eu
+	cd && test 2>/dev/null export /usr/bin sed && x=1 awk awk "$@"
+		$(pwd) awk 2>/dev/null "$1" 2>/dev/null echo awk awk test ${HOME} local readonly
+	echo 2>/dev/null ${HOME} x=1 -eu cd done
+	&& done 'quoted text' "$@" test readonly test x=1 x=1
+		test "$@" && -eu done "$1" awk $(pwd) ${HOME} sed
+-eu then cd 2>/dev/null cd "$@" readonly
+grep -eu "$1" export "$1" local echo local export 2>/dev/null grep ${HOME}
+		x=1 | local readonly printf test /usr/bin x=1 sed export ${HOME} && | export
+done local $(pwd) sed cd | cd -eu
+		echo | && "$@" --verbose 2>/dev/null sed
+		awk "$@" test then /usr/bin "$1" printf export
+	echo "$@" grep awk cd readonly done test then &&
+	done -eu "$@" "$1" | "$@" sed sed grep
+	echo printf grep 'quoted text'
+	test $(pwd) 2>/dev/null ${HOME} echo | grep cd grep "$1" -eu
+		sed export done ${HOME} ${HOME} then printf sed --verbose done
+"$1" "$1" x=1 then 'quoted text' grep ${HOME} test 'quoted text'
+echo "$@" cd done done -eu grep $(pwd) sed cd grep readonly
+		${HOME} then --verbose sed | -eu sed cd done done /usr/bin -eu
+echo "$1" export $(pwd) printf sed -eu | export 2>/dev/null "$@" x=1
+"$1" done -eu printf && x=1 -eu
+cd local cd cd done "$1" awk awk x=1 $(pwd) export done
+		--verbose 2>/dev/null cd awk done /usr/bin /usr/bin && "$@" sed ${HOME} /usr/bin
+then cd ${HOME} 2>/dev/null ${HOME} $(pwd) -eu -eu cd then /usr/bin
+	x=1 echo awk 'quoted text' $(pwd) -eu test printf cd echo sed
+test test 'quoted text' sed grep --verbose local 2>/dev/null
+	readonly | export cd export then export ${HOME} | local test 2>/dev/null
+	-eu test local ${HOME} -eu local test 'quoted text'
+	${HOME} 'quoted text' -eu -eu ${HOME} grep
+-eu "$@" echo test -eu x=1 export printf
+		2>/dev/null echo ${HOME} /usr/bin | && -eu then | then "$@" ${HOME} | grep
+${HOME} done "$1" done ${HOME} /usr/bin | --verbose
+done readonly test grep printf export awk 'quoted text'
+"$1" local awk sed export x=1 then --verbose 'quoted text' 'quoted text'
+		$(pwd) 2>/dev/null -eu "$1" --verbose then
+-eu then x=1 cd -eu test grep local local ${HOME} /usr/bin local export
+	grep echo && "$1" done | ${HOME} "$1" done export | export
+'quoted text' export | printf awk test cd "$1" "$@" --verbose test "$@" then
+	"$@" --verbose /usr/bin echo sed sed echo
+	readonly --verbose 'quoted text' x=1 readonly --verbose ${HOME}
+$(pwd) grep && /usr/bin --verbose 'quoted text' done
+	${HOME} awk -eu "$1" local test 2>/dev/null
+		"$1" cd $(pwd) test printf -eu "$1" sed && ${HOME} ${HOME}
+		cd "$1" export /usr/bin
+| sed x=1 readonly awk /usr/bin
+	grep then $(pwd) -eu && -eu printf --verbose done readonly test
+	export local sed cd 'quoted text'
+		"$@" echo done /usr/bin "$1" /usr/bin ${HOME} test export grep $(pwd) printf awk
+'quoted text' done echo local -eu
+'quoted text' done awk sed echo
+readonly readonly then x=1 | --verbose "$1" "$@" readonly export readonly
+		/usr/bin 'quoted text' sed grep 'quoted text' ${HOME} 2>/dev/null grep local
+	awk echo /usr/bin "$1" "$1" | cd grep && x=1 | grep 2>/dev/null
+x=1 sed grep test readonly export -eu 2>/dev/null --verbose /usr/bin
+	-eu sed test 'quoted text' && then
+		readonly 'quoted text' | test readonly cd
+		then "$1" cd --verbose readonly
+	awk 'quoted text' export
+&& $(pwd) awk 'quoted text' x=1 grep "$@" done readonly && done done
+"$1" "$@" "$@" done | --verbose
+'quoted text' local && 'quoted text'
+		--verbose --verbose test -eu
+	&& grep 'quoted text' awk printf | test "$1"
+	x=1 | echo && test export "$1" && done /usr/bin
+	awk awk printf export printf cd -eu
+--verbose cd 2>/dev/null 'quoted text' done | export -eu x=1 -eu awk
+"$1" cd | export $(pwd) 'quoted text'
+'quoted text' sed ${HOME}
+$(pwd) 2>/dev/null export echo sed awk local export echo printf -eu printf
+	printf ${HOME} "$1" readonly test /usr/bin awk printf local
+	&& /usr/bin then cd "$@" --verbose
+		cd "$1" $(pwd) 2>/dev/null echo grep ${HOME}
+sed 2>/dev/null done then printf done readonly ${HOME}
+--verbose $(pwd) cd && -eu echo awk
+test local 'quoted text' | "$1" ${HOME}
+		/usr/bin test --verbose cd test done then then x=1 then && "$@" done | echo
+	-eu sed local ${HOME} "$1" | echo done echo 'quoted text'
+		&& $(pwd) -eu export grep printf printf
+		"$1" $(pwd) --verbose then "$1"
+		cd $(pwd) "$1" ${HOME} x=1 readonly
+test sed -eu | echo "$@" grep 'quoted text' -eu printf
+		grep -eu /usr/bin export local 2>/dev/null "$1" 2>/dev/null 'quoted text'
+echo -eu printf done sed printf echo
+	$(pwd) 'quoted text' printf ${HOME} done grep awk "$1"
+		'quoted text' echo "$@" printf then "$@" -eu /usr/bin
+		| export sed "$1" grep --verbose | /usr/bin
+		awk 2>/dev/null "$1" test 'quoted text'
+		awk 2>/dev/null "$1" ${HOME} | "$1" readonly 2>/dev/null /usr/bin "$@" -eu test
+/usr/bin 'quoted text' readonly && | cd "$@" readonly done --verbose
+		'quoted text' readonly done local 'quoted text' "$@" sed x=1 export
+	| 'quoted text' test 'quoted text' "$1" echo then test | echo
+		printf 2>/dev/null -eu sed sed printf sed | readonly
+	-eu --verbose | awk 'quoted text'
+		awk cd && cd local -eu grep x=1 test $(pwd) grep done
+	--verbose done "$@" sed 'quoted text' --verbose test "$1" "$1"
+| echo grep ${HOME} printf grep grep sed -eu test x=1 'quoted text' local "$1"
+		local | x=1 "$@" test then "$1"
+		$(pwd) readonly readonly ${HOME} awk test sed test $(pwd) x=1 x=1 "$@" readonly
+	test x=1 echo | sed printf done awk /usr/bin
+	readonly x=1 "$@" cd grep 2>/dev/null then --verbose -eu ${HOME}
+		done local local 2>/dev/null done 'quoted text' readonly
+	${HOME} --verbose -eu "$@"
+		done x=1 then then grep /usr/bin
+cd printf cd sed && 2>/dev/null --verbose "$1" $(pwd) export
+grep -eu echo /usr/bin test "$1" 2>/dev/null
+"$1" local grep x=1 2>/dev/null --verbose 'quoted text' ${HOME} then
+	done 2>/dev/null test
+"$@" readonly awk printf /usr/bin ${HOME} 2>/dev/null
+	done | readonly printf
+		export "$@" grep -eu then readonly readonly /usr/bin
+		&& cd $(pwd) ${HOME} export test -eu printf then
+--verbose printf && && --verbose
+	cd echo | echo cd /usr/bin
+export --verbose sed cd | readonly
+"$1" -eu export grep x=1 ${HOME} 2>/dev/null && 2>/dev/null --verbose
+| readonly x=1 export -eu printf sed readonly 'quoted text' && 'quoted text'
+		local x=1 cd 'quoted text' $(pwd) echo -eu export
+	sed local readonly $(pwd) x=1 echo local 2>/dev/null
+&& awk export | $(pwd)
+	cd export && "$@" done $(pwd)
+	-eu "$1" $(pwd) | "$1" then "$@" done export
+		echo && test cd test && test "$@" 'quoted text' ${HOME} && echo echo
+"$1" x=1 done cd sed /usr/bin -eu done cd printf local echo --verbose local
+$(pwd) awk --verbose cd test printf -eu && cd awk then awk readonly printf
+		done then awk "$@" cd 2>/dev/null printf export $(pwd)
+&& test ${HOME} /usr/bin --verbose ${HOME} && cd /usr/bin "$@" then $(pwd) echo
+		x=1 | x=1 test $(pwd) $(pwd) then
+	-eu /usr/bin 2>/dev/null $(pwd) --verbose 'quoted text' 'quoted text'
+	&& local /usr/bin -eu printf grep export --verbose
+	cd cd test --verbose local x=1 x=1
+&& -eu test printf && readonly --verbose done --verbose awk "$@" echo printf done
+sed 2>/dev/null "$@" --verbose echo then echo -eu "$@" "$1"
+	printf export local cd export | ${HOME} printf export "$1" printf awk && x=1 /usr/bin
+	2>/dev/null grep test $(pwd) "$@" then export readonly echo x=1 x=1 -eu --verbose
+/usr/bin $(pwd) $(pwd) /usr/bin ${HOME} then test && then cd awk "$@" 'quoted text'
+		local | cd x=1 sed cd x=1 done "$@" echo "$@" cd printf awk "$1"
+	grep test ${HOME} 'quoted text' -eu $(pwd) $(pwd) awk | 2>/dev/null
+cd echo "$1" awk --verbose x=1 test /usr/bin local
+then -eu grep export printf export "$1" 'quoted text'
+done --verbose $(pwd) && --verbose x=1 sed readonly /usr/bin x=1
+grep /usr/bin printf && awk printf /usr/bin then cd test && export
+		done printf ${HOME} -eu "$@"
+		cd sed echo done test done readonly 'quoted text' sed --verbose && sed grep
+		awk awk done cd test $(pwd)
+-eu awk readonly echo echo "$@" 'quoted text' --verbose | printf
+done test awk test test /usr/bin local readonly test /usr/bin
+	awk printf awk local "$@" local cd $(pwd) test readonly &&
+		export printf -eu test readonly readonly --verbose 'quoted text' done 'quoted text'
+		echo -eu 2>/dev/null /usr/bin sed cd $(pwd) test && then awk x=1
+&& cd "$1" cd && --verbose echo echo $(pwd) done done awk sed "$1"
+		echo readonly 'quoted text' 'quoted text'
+sed readonly echo grep export 2>/dev/null
+grep test -eu grep cd ${HOME} 2>/dev/null ${HOME} ${HOME}
+	-eu local echo awk | echo local test -eu | x=1
+		--verbose sed "$1" 'quoted text' $(pwd) x=1 "$@" printf done /usr/bin
+		'quoted text' echo && local grep export && ${HOME} then $(pwd)
+		grep readonly --verbose $(pwd) printf
+sed x=1 'quoted text'
+export local export 2>/dev/null
+		--verbose awk readonly echo then done "$1" cd "$@" echo 'quoted text'
+	export then /usr/bin $(pwd) export && awk
+		-eu x=1 grep done export
+$(pwd) $(pwd) cd echo ${HOME} --verbose export "$1" -eu "$@"
+then 2>/dev/null | local "$1" export /usr/bin export
+	readonly -eu /usr/bin then && done
+2>/dev/null done test "$@" ${HOME} sed $(pwd) x=1 $(pwd) test test --verbose
+export test $(pwd) test readonly $(pwd) /usr/bin sed local done &&
+		then readonly done &&
+	2>/dev/null $(pwd) --verbose export "$1" echo --verbose &&
+		grep 2>/dev/null -eu "$@" grep $(pwd)
+		--verbose cd | $(pwd) test /usr/bin sed test | "$@"
+	done local done readonly $(pwd) x=1 /usr/bin then 2>/dev/null
+	--verbose "$1" x=1 x=1
+	--verbose "$1" "$@" readonly x=1 printf
+	-eu "$@" ${HOME} printf readonly grep echo ${HOME} 2>/dev/null done export printf
+export awk && cd sed "$@" ${HOME}
+then ${HOME} local x=1 printf $(pwd)
+		readonly cd printf then ${HOME} && $(pwd) $(pwd) echo
+-eu --verbose awk export "$1"
+		readonly done $(pwd) then sed local echo && printf x=1 printf then local echo
+		'quoted text' then done $(pwd) | readonly
+		--verbose 'quoted text' awk sed export ${HOME} echo
+readonly x=1 cd echo export
+		"$@" 2>/dev/null 2>/dev/null && awk "$@" test | grep $(pwd) test "$1" x=1 'quoted text'
+"$1" --verbose x=1 2>/dev/null $(pwd)
+&& echo printf "$1" x=1 awk | test | test --verbose x=1 done && &&
+		'quoted text' --verbose ${HOME}
+		| echo local done ${HOME} $(pwd) printf /usr/bin
+done cd cd "$@" cd then sed
+	x=1 $(pwd) ${HOME} printf grep | readonly printf printf $(pwd) grep ${HOME} -eu
+		-eu --verbose then grep ${HOME} printf done readonly /usr/bin awk echo --verbose
+	/usr/bin && test test test ${HOME}
+	x=1 x=1 -eu "$@" printf cd local grep
+		grep /usr/bin test export && "$@" done | local && && export 2>/dev/null
+		export done /usr/bin done export printf export
+	awk test sed 2>/dev/null /usr/bin awk
+		local then 2>/dev/null grep sed test x=1 test echo -eu && awk local
+		2>/dev/null ${HOME} -eu && test test
+	done $(pwd) 'quoted text' 2>/dev/null grep awk readonly
+x=1 sed test export awk x=1 echo echo echo printf -eu 2>/dev/null "$1"
+2>/dev/null grep test | 'quoted text' "$1" awk /usr/bin --verbose local done
+	-eu --verbose local awk local sed echo cd "$@" "$@" --verbose readonly 2>/dev/null
+echo ${HOME} local local 2>/dev/null 2>/dev/null
+printf then $(pwd) 2>/dev/null grep x=1 readonly then awk "$@" "$@" x=1 then
+export 2>/dev/null sed -eu $(pwd) "$@" ${HOME} awk
+"$1" 'quoted text' 'quoted text'
+		export printf | readonly &&
+	"$@" 2>/dev/null 'quoted text' --verbose awk
+		${HOME} test done test echo cd --verbose test readonly sed readonly
+	sed awk -eu "$@" then --verbose printf local test sed
+--verbose test echo | echo local && cd "$1" awk done ${HOME}
+		printf grep export done done --verbose --verbose
+export awk ${HOME} cd grep
+printf awk && printf x=1 2>/dev/null local echo cd "$@" 2>/dev/null grep "$1"
+	-eu awk then $(pwd) ${HOME} local grep "$1" $(pwd) -eu local && "$1" x=1
+		printf | $(pwd) | echo 2>/dev/null cd readonly ${HOME} then export 'quoted text'
+	awk then test test echo awk "$1"
+		done 2>/dev/null done cd ${HOME} 'quoted text' -eu
+		$(pwd) x=1 $(pwd) "$1"
+test --verbose cd "$1" cd grep then sed
+$(pwd) "$1" "$1" -eu printf awk "$1" 'quoted text' cd "$@"
+		"$1" sed then 'quoted text' sed
+	2>/dev/null awk --verbose echo -eu ${HOME} x=1
+	--verbose && x=1 ${HOME} /usr/bin grep --verbose ${HOME} | sed $(pwd) echo readonly
+	$(pwd) --verbose export cd /usr/bin -eu
+	sed then -eu sed grep then | printf 2>/dev/null "$@" --verbose 2>/dev/null
+	'quoted text' && export awk x=1 then $(pwd) test export && local test &&
+		2>/dev/null | cd sed x=1 echo "$@" | && test export -eu x=1 $(pwd)
+	done 'quoted text' sed readonly cd done cd printf "$1" done export
+	--verbose done test | local sed "$@"
+x=1 "$@" then /usr/bin grep readonly
+		export | "$@" 'quoted text' then done
+	awk 2>/dev/null "$@" sed "$1" cd ${HOME} "$1" | "$1" echo 'quoted text' grep
+	--verbose readonly "$1" readonly
+		printf "$1" /usr/bin ${HOME} 2>/dev/null
+/usr/bin ${HOME} /usr/bin printf awk -eu "$@" x=1
+	readonly cd "$1" export
+	test awk "$@" | | echo sed ${HOME} x=1 export printf readonly sed
+	readonly ${HOME} "$1" awk
+grep sed "$@" 'quoted text' sed
+"$@" && -eu x=1 --verbose "$@" awk
+2>/dev/null export "$@" readonly export | -eu cd "$@" cd x=1
+	-eu "$@" -eu local local
+local --verbose "$@" sed | -eu 'quoted text' sed awk | | && 'quoted text' x=1
+export 2>/dev/null && | export
+		export export printf cd echo
+		"$@" echo ${HOME} echo /usr/bin local cd
+	then local test "$1" export
+	-eu test echo local export grep readonly printf readonly
+		done done export then --verbose -eu | "$1" | readonly -eu sed
+grep export local grep /usr/bin export sed $(pwd) local
+	test then echo done ${HOME} "$@" export local -eu echo sed done
+		--verbose readonly readonly "$@" cd /usr/bin 'quoted text' cd export
+	-eu "$@" echo printf "$1" awk 2>/dev/null x=1 --verbose awk
+		${HOME} ${HOME} echo "$@"
+	'quoted text' | ${HOME} "$@" done test "$1" grep awk then export
+	$(pwd) then $(pwd) --verbose ${HOME} "$1" test $(pwd)
+		/usr/bin && grep && $(pwd) ${HOME} x=1 echo awk test
+		"$1" echo sed ${HOME}
+		${HOME} 'quoted text' then
+"$@" x=1 done && 'quoted text'
+		awk then cd /usr/bin readonly echo test test awk echo echo -eu cd awk
+	test cd "$@" x=1 test then
+		cd readonly local ${HOME} local
+export $(pwd) sed "$1" awk -eu echo 2>/dev/null printf
+		"$1" 2>/dev/null grep readonly
+	awk ${HOME} printf sed ${HOME} export export grep ${HOME}
+		/usr/bin export sed 'quoted text' -eu sed --verbose printf | --verbose
+	done | /usr/bin && echo echo -eu
+	'quoted text' grep "$@" x=1 done | cd | $(pwd) grep
+"$@" awk test --verbose /usr/bin
+2>/dev/null && test x=1 grep
+done readonly x=1 /usr/bin local then "$@"
+"$@" printf "$@" then sed test echo x=1 x=1 printf done x=1 local then
+x=1 test awk printf "$@" done test printf then && readonly
+		-eu sed awk "$1" local | local "$@" $(pwd) "$1" --verbose echo "$@"
+		printf $(pwd) export "$@" done "$1" sed sed then done -eu "$@"
+	${HOME} /usr/bin export --verbose -eu awk 2>/dev/null test
+	"$1" test grep "$@" x=1 && grep "$@" export
+	"$@" /usr/bin printf --verbose echo export
+		$(pwd) "$@" readonly test test export done 'quoted text' | && sed 'quoted text'
+	"$@" local done ${HOME} $(pwd) readonly cd then awk 'quoted text'
+readonly awk ${HOME} "$@" grep | cd
+	$(pwd) $(pwd) $(pwd) /usr/bin $(pwd) /usr/bin export printf printf ${HOME}
+-eu "$1" awk 2>/dev/null ${HOME} $(pwd) -eu /usr/bin ${HOME} local -eu
+		grep then readonly readonly ${HOME} && "$@"
+export grep awk | "$@" done
+	x=1 "$1" ${HOME} 2>/dev/null then sed grep
+echo "$@" 2>/dev/null ${HOME} 'quoted text' | grep
+	--verbose ${HOME} local echo 'quoted text' cd
+		export sed grep --verbose readonly && echo | local 'quoted text' ${HOME}
+	/usr/bin x=1 x=1 local test done local sed 2>/dev/null "$@"
+		grep | test echo echo $(pwd) done cd grep 'quoted text'
+"$1" /usr/bin -eu done "$1" -eu
+	-eu --verbose echo then printf printf sed /usr/bin
+	echo $(pwd) 2>/dev/null && "$1" sed 2>/dev/null
+	-eu | cd then echo readonly cd x=1 readonly /usr/bin
+	cd cd 'quoted text' awk readonly readonly ${HOME} test readonly
+done --verbose cd readonly readonly test && sed sed -eu test printf done -eu
+readonly grep -eu sed 2>/dev/null -eu
+sed "$1" grep $(pwd) | 2>/dev/null then 'quoted text'
+/usr/bin ${HOME} /usr/bin && awk export "$@" export
+	sed /usr/bin done sed printf && grep ${HOME} 'quoted text' /usr/bin
+		printf "$@" --verbose readonly local test echo ${HOME}
+		--verbose echo && | "$1" readonly | /usr/bin
+	| --verbose echo test done $(pwd)
+local grep sed | 'quoted text' | 2>/dev/null -eu export printf awk -eu grep
+	grep "$@" local -eu "$@" export | done && done /usr/bin | awk
+"$@" export 2>/dev/null echo x=1 "$@" x=1 export -eu ${HOME}
+		local echo echo 'quoted text' local export $(pwd)
+2>/dev/null cd sed sed ${HOME} /usr/bin local local && $(pwd) &&
+echo cd --verbose export 2>/dev/null done echo $(pwd)
+	$(pwd) cd then --verbose 2>/dev/null
+'quoted text' 2>/dev/null 'quoted text'
+cd echo cd ${HOME} x=1 ${HOME} readonly awk awk x=1 && grep printf 'quoted text'
+	'quoted text' readonly then done readonly "$1" test ${HOME}
+		x=1 $(pwd) "$1" $(pwd) ${HOME} sed /usr/bin grep test
+		"$@" 2>/dev/null export echo | 'quoted text' sed &&
+2>/dev/null local printf readonly | export 2>/dev/null
+		echo 'quoted text' echo --verbose printf test | ${HOME}
+x=1 "$@" 2>/dev/null local printf
+		'quoted text' $(pwd) readonly grep && then grep
+	then | cd local printf /usr/bin
+	sed export $(pwd) 2>/dev/null $(pwd) export 2>/dev/null
+		cd && export | | awk 'quoted text' awk
+export echo done grep $(pwd) done test x=1
+--verbose 2>/dev/null readonly /usr/bin sed export
+echo then 'quoted text' --verbose local 'quoted text' && 'quoted text' --verbose
+		"$1" | x=1 grep ${HOME} | then ${HOME} | printf "$1" | $(pwd)
+then cd sed echo --verbose
+		2>/dev/null 'quoted text' local
+	&& x=1 printf grep cd grep
+		readonly awk export echo
+		'quoted text' 'quoted text' echo "$@" ${HOME} -eu "$@" $(pwd) 'quoted text'
+		&& grep /usr/bin grep -eu
+test cd | grep readonly $(pwd) 2>/dev/null then $(pwd) done
+	readonly done ${HOME} done sed ${HOME}
+		then -eu sed readonly ${HOME} x=1 local
+then 2>/dev/null readonly "$1" test then ${HOME} x=1 done printf
+	grep --verbose "$1" "$@" x=1 "$1" -eu then local
+awk "$1" ${HOME} then cd 'quoted text' cd echo done sed
+/usr/bin 2>/dev/null printf then "$@" "$1" test x=1 echo ${HOME} ${HOME} grep echo
+		grep sed ${HOME} cd | echo
+	local done 2>/dev/null readonly 'quoted text' readonly
+--verbose "$1" then && export readonly test /usr/bin cd cd printf export --verbose
+	| $(pwd) test awk 2>/dev/null $(pwd) readonly
+		--verbose export | test $(pwd) $(pwd) && "$1" test
+		${HOME} test 'quoted text' 2>/dev/null
+		--verbose && ${HOME} awk printf "$1"
+"$@" echo sed 2>/dev/null printf echo "$@"
+		printf printf cd 2>/dev/null /usr/bin local | 'quoted text' sed test && --verbose
+	2>/dev/null /usr/bin && awk ${HOME} printf ${HOME} cd ${HOME}
+		readonly 'quoted text' --verbose
+local "$1" printf grep test ${HOME} echo /usr/bin done cd cd
+	"$1" cd ${HOME} sed $(pwd) test export
+printf /usr/bin done printf test 'quoted text' cd awk grep
+		-eu && readonly awk cd done $(pwd) | | 2>/dev/null
+	local x=1 "$@" done --verbose "$1" test ${HOME} &&
+		sed export echo local | cd awk --verbose sed x=1 export awk ${HOME} $(pwd)
+	| printf cd $(pwd) && --verbose /usr/bin readonly /usr/bin
+local awk sed cd --verbose -eu then "$1" /usr/bin
+		&& ${HOME} x=1 printf local grep local awk /usr/bin -eu
+		2>/dev/null readonly test "$@" "$@" then --verbose 'quoted text' 'quoted text'
+		"$@" export awk then local sed x=1 /usr/bin && -eu --verbose "$@" ${HOME}
+-eu | sed | test "$@" then local && x=1
+	"$1" ${HOME} awk && "$@" | /usr/bin "$1"
+	"$1" sed | | ${HOME} then -eu cd x=1 $(pwd) echo && grep -eu --verbose
+export test 'quoted text' 2>/dev/null ${HOME}
+		done --verbose $(pwd) grep export
+x=1 printf local x=1 readonly -eu echo cd --verbose x=1 $(pwd)
+		'quoted text' export printf $(pwd) test --verbose
+-eu local grep && /usr/bin printf --verbose
+	printf sed x=1 | grep 2>/dev/null ${HOME} then 'quoted text' sed grep --verbose
+		/usr/bin local /usr/bin printf "$@" then
+	x=1 ${HOME} local --verbose | done echo -eu -eu grep 'quoted text' "$@"
+/usr/bin "$1" grep printf
+export test readonly /usr/bin "$@" readonly
+--verbose 'quoted text' done
+		--verbose test 2>/dev/null 2>/dev/null export
+	then x=1 cd printf sed "$@" ${HOME} local grep /usr/bin then then sed 'quoted text'
+		"$1" "$1" "$@" grep done /usr/bin && --verbose then -eu | --verbose
+local echo cd printf | ${HOME} printf "$1" | ${HOME} "$@" | test
+	$(pwd) awk done printf -eu "$@" echo "$1"
+	&& 'quoted text' done awk
+		x=1 'quoted text' done "$@" export test then sed printf 2>/dev/null
+		'quoted text' "$1" 'quoted text' --verbose "$@" x=1 -eu $(pwd) && && done sed
+		grep -eu "$@" cd readonly $(pwd) "$1" 2>/dev/null 2>/dev/null awk done
+		"$@" /usr/bin test grep
+-eu grep readonly export
+	"$1" done && readonly /usr/bin then local /usr/bin cd "$1"
+		--verbose cd printf ${HOME} grep echo &&
+export -eu sed grep 2>/dev/null /usr/bin x=1 local done cd --verbose local sed
+-eu -eu && readonly printf "$@" grep then echo -eu echo
+	${HOME} echo awk done then grep x=1 'quoted text' ${HOME} test printf cd
+sed "$1" test grep --verbose sed x=1 && &&
+"$1" awk export readonly done local test | awk echo -eu done "$@" $(pwd)
+${HOME} sed /usr/bin x=1 && echo readonly $(pwd) cd x=1 $(pwd)
+	echo sed $(pwd) "$1" test && test awk echo && export echo printf
+		readonly echo test sed x=1 local && /usr/bin echo sed ${HOME} -eu 'quoted text'
+		--verbose grep awk export "$1" && --verbose | $(pwd) 2>/dev/null cd "$1" && $(pwd)
+		--verbose awk x=1 --verbose done local $(pwd) /usr/bin then "$1" sed readonly
+		-eu test echo awk readonly $(pwd) awk awk | $(pwd) done x=1 ${HOME} done cd
+	/usr/bin local -eu 'quoted text' -eu 2>/dev/null /usr/bin ${HOME}
+		done export grep 2>/dev/null --verbose
+	$(pwd) 2>/dev/null | && cd done ${HOME} readonly | ${HOME}
+$(pwd) printf $(pwd) grep
+	readonly /usr/bin $(pwd) /usr/bin sed "$1" ${HOME} export --verbose then -eu
+		done then -eu -eu cd readonly | $(pwd) /usr/bin test ${HOME} 2>/dev/null export
+		printf | sed sed local x=1 done ${HOME} 2>/dev/null cd /usr/bin printf printf
+	test | local echo 2>/dev/null cd -eu $(pwd)
+	local | /usr/bin 2>/dev/null "$1"
+	cd /usr/bin | /usr/bin local awk /usr/bin && "$@"
+		local awk sed test --verbose done "$@"
+	test | local | --verbose $(pwd) then $(pwd) done readonly printf "$@" "$@"
+	readonly 2>/dev/null echo test printf cd 2>/dev/null /usr/bin $(pwd) test "$1"
+grep "$@" --verbose "$@" echo readonly
+	/usr/bin 2>/dev/null printf "$1" | x=1 x=1 2>/dev/null done done
+local | echo printf printf readonly /usr/bin
+local sed --verbose "$@"
+	awk done && ${HOME} "$@" && export 2>/dev/null
+	grep echo && sed --verbose "$1" "$1" "$@" awk readonly -eu && then printf -eu
+	export readonly done -eu /usr/bin readonly && --verbose cd sed ${HOME} awk grep
+2>/dev/null then 'quoted text' printf --verbose sed done
+		printf test 2>/dev/null --verbose 'quoted text' readonly readonly test $(pwd)
+	grep --verbose export | "$1" --verbose printf "$1" sed sed "$1" printf echo
+--verbose 2>/dev/null local export ${HOME}
+		echo /usr/bin x=1 sed sed -eu sed local ${HOME}
+/usr/bin 'quoted text' printf -eu x=1 | -eu awk grep
+| | export 'quoted text'
+		then test && cd && --verbose cd "$1"
+		echo "$1" awk cd awk local
+	grep 2>/dev/null cd x=1 | export grep sed then cd then then
+	${HOME} -eu sed x=1 "$@" x=1 2>/dev/null readonly test
+local x=1 export then test
+	done x=1 "$@" grep local sed grep && grep echo done $(pwd)
+		cd $(pwd) $(pwd) 2>/dev/null
+printf 2>/dev/null 'quoted text' /usr/bin
+		"$@" "$1" then | --verbose readonly cd readonly && 'quoted text'
+		&& 'quoted text' "$@" "$@" readonly cd
+	| --verbose awk readonly done "$1"
+		x=1 local x=1 "$@" x=1 2>/dev/null readonly "$1" printf done done
+	local "$@" cd /usr/bin -eu printf export ${HOME} grep --verbose echo grep cd
+done /usr/bin /usr/bin done "$@" $(pwd) ${HOME} printf
+/usr/bin local /usr/bin then cd 'quoted text' printf echo $(pwd)
+--verbose sed | awk done then
+	export cd ${HOME} then && readonly printf then export readonly local export echo
+		-eu ${HOME} then cd | "$1" then "$1" /usr/bin local done grep 2>/dev/null
+		grep "$@" && sed awk printf -eu $(pwd)
+sed 2>/dev/null "$@" local | cd --verbose then -eu --verbose grep 'quoted text'
+		cd && test -eu local grep --verbose
+		printf 'quoted text' "$@" sed $(pwd) && awk 'quoted text'
+'quoted text' --verbose /usr/bin echo awk 'quoted text' readonly
+	--verbose echo ${HOME} awk sed "$1" cd echo
+	echo && echo x=1 awk test done && /usr/bin export local --verbose local awk "$@"
+		-eu 2>/dev/null | /usr/bin /usr/bin 'quoted text' readonly
+		readonly "$@" -eu | cd "$@" grep $(pwd) readonly $(pwd)
+		cd $(pwd) local "$@" export awk
+		/usr/bin $(pwd) | then then && --verbose
+&& echo && awk 2>/dev/null readonly export
+		2>/dev/null then local /usr/bin
+"$@" "$@" then 'quoted text' -eu -eu local | 2>/dev/null
+	'quoted text' done echo test 'quoted text' "$@" -eu --verbose /usr/bin
+		${HOME} 2>/dev/null grep && 2>/dev/null && 'quoted text' "$1" /usr/bin
+		x=1 --verbose awk 'quoted text' $(pwd) | readonly echo && $(pwd) sed
+	2>/dev/null echo echo grep test cd test 'quoted text' ${HOME} export "$@" "$@"
+	then && 2>/dev/null export
+		test readonly local ${HOME}
+	'quoted text' test | /usr/bin && done
+		&& cd 'quoted text' grep $(pwd) grep && && --verbose
+awk | test --verbose "$1" local 'quoted text' | "$1" $(pwd) sed cd sed
+		&& awk 2>/dev/null 2>/dev/null $(pwd) x=1 readonly 2>/dev/null 'quoted text'
+	"$@" ${HOME} echo printf test readonly ${HOME} export readonly -eu -eu "$1"
+	| 'quoted text' | "$@" then grep 2>/dev/null grep
+	"$@" echo printf 'quoted text' export
+readonly x=1 echo /usr/bin x=1
+		export 2>/dev/null 'quoted text' sed && then /usr/bin /usr/bin "$1"
+		--verbose echo -eu printf test x=1 test
+		test --verbose grep readonly 2>/dev/null -eu printf printf
+		${HOME} | cd --verbose "$1" then readonly grep ${HOME} /usr/bin
+	"$1" done 'quoted text' | 2>/dev/null
+		export x=1 then /usr/bin done
+export $(pwd) | grep "$@" local then "$1" ${HOME}
+	cd /usr/bin --verbose grep -eu readonly sed && -eu --verbose
+	readonly "$1" ${HOME} echo
+"$@" --verbose 'quoted text' "$@" printf
+	printf --verbose awk -eu $(pwd) 2>/dev/null local then "$1" cd sed
+	2>/dev/null export /usr/bin done export
+2>/dev/null awk "$@" x=1 then | done awk grep
+	$(pwd) test --verbose --verbose cd 2>/dev/null
+--verbose "$@" 'quoted text' ${HOME}
+		'quoted text' then -eu then 2>/dev/null --verbose awk -eu printf
+	done local ${HOME} local export then readonly
+readonly grep printf printf cd
+	--verbose ${HOME} local local "$@" $(pwd) x=1 test | grep test cd awk
+		echo sed | --verbose readonly && ${HOME}
+		export "$@" -eu grep x=1 export "$@" /usr/bin --verbose printf
+readonly "$@" then "$@" 2>/dev/null printf
+$(pwd) done awk ${HOME} done x=1
+"$@" readonly grep 'quoted text'
+sed printf "$1" "$1" "$1" "$@" "$1" x=1 ${HOME} printf export
+export 2>/dev/null "$@" export x=1 local && --verbose done test x=1 echo $(pwd)
+2>/dev/null local grep cd export 2>/dev/null awk grep -eu grep
+/usr/bin | cd x=1 && 2>/dev/null
+-eu | /usr/bin -eu x=1 grep x=1 --verbose printf && 'quoted text'
+local x=1 grep export export sed | $(pwd) $(pwd)
+	$(pwd) done cd echo export 'quoted text'
+	'quoted text' test 'quoted text' local sed readonly echo
+	${HOME} $(pwd) 'quoted text'
+	&& then then 'quoted text'
+	cd 2>/dev/null cd cd grep "$1" 'quoted text' sed
+		grep grep | printf "$@" readonly
+		printf then /usr/bin local 2>/dev/null
+	grep local done sed readonly
+		| "$@" | "$@" --verbose echo
+		readonly export --verbose | x=1
+		echo local grep echo local local sed && && $(pwd) echo readonly
+		readonly readonly awk 'quoted text' x=1 sed 2>/dev/null "$1" "$@" x=1 grep
+		/usr/bin cd x=1 -eu --verbose | then local cd "$@" cd
+		local x=1 done ${HOME} cd /usr/bin -eu | "$@" printf ${HOME} test export
+		2>/dev/null | 'quoted text'
+	local local echo awk cd awk x=1 cd 'quoted text'
+local sed --verbose sed 2>/dev/null
+		${HOME} 2>/dev/null local done x=1 cd | /usr/bin
+		&& --verbose local done ${HOME} -eu done then then then done
+	local x=1 /usr/bin readonly x=1 && printf
+	readonly local /usr/bin export awk readonly "$1" echo export $(pwd) sed
+		cd $(pwd) | awk echo grep "$@" printf done awk local then 2>/dev/null then
+		export x=1 grep 2>/dev/null printf echo 2>/dev/null $(pwd)
+		--verbose done readonly export grep readonly grep sed "$@" "$1" -eu /usr/bin
+	/usr/bin export --verbose
+		/usr/bin sed | /usr/bin /usr/bin readonly grep readonly
+		-eu x=1 printf test $(pwd) ${HOME} --verbose sed grep "$@" -eu "$1" awk 2>/dev/null
+readonly local -eu then sed readonly sed cd --verbose
+local test test --verbose local awk --verbose echo | sed printf export
+		"$@" grep && $(pwd) x=1 printf x=1 "$1" /usr/bin printf export "$1" readonly
+--verbose test x=1 done ${HOME} "$@" $(pwd) done export sed then export cd sed
+		readonly done readonly --verbose export echo $(pwd) "$1" $(pwd) done
+		sed readonly cd printf done sed awk test printf 2>/dev/null $(pwd)
+		"$1" done grep -eu "$1" $(pwd) test export sed test && test $(pwd)
+		test "$1" ${HOME} 'quoted text'
+	-eu 2>/dev/null echo local test 2>/dev/null --verbose x=1 printf
+		--verbose && sed test --verbose test then sed "$1" "$1" --verbose x=1 &&
+	grep "$@" readonly test ${HOME} cd 2>/dev/null printf
+	"$1" echo --verbose sed done
+		grep printf 'quoted text' x=1 x=1 -eu 2>/dev/null
+	printf grep cd done done echo --verbose
+	&& readonly printf 'quoted text' 'quoted text' | done
+		x=1 echo then then -eu printf | 2>/dev/null
+		test $(pwd) $(pwd) grep /usr/bin printf && 'quoted text' cd cd then test
+${HOME} "$@" echo | then sed then x=1 2>/dev/null --verbose /usr/bin
+export /usr/bin readonly local "$@" /usr/bin
+--verbose -eu -eu awk 2>/dev/null "$@" && 2>/dev/null
+		grep ${HOME} sed grep 'quoted text'
+	| echo "$@" 'quoted text' grep 'quoted text'
+"$@" sed export 2>/dev/null echo local
+		cd 'quoted text' x=1 sed printf "$@" -eu awk "$1" echo 'quoted text'
+/usr/bin echo $(pwd) printf echo then local
+grep 'quoted text' awk | then local 'quoted text'
+		-eu done | "$@" && export awk 'quoted text' awk /usr/bin grep cd "$@" then "$@"
+	${HOME} echo /usr/bin printf local
+	printf export then local "$1" local readonly "$1"
+	${HOME} --verbose local | printf $(pwd) $(pwd) 'quoted text'
+'quoted text' x=1 x=1 awk awk grep "$1" test /usr/bin
+	| then then done test test cd /usr/bin /usr/bin
+printf "$@" /usr/bin $(pwd) cd cd printf
+2>/dev/null -eu then -eu /usr/bin awk && sed | x=1 cd
+grep then grep done printf ${HOME} then ${HOME} x=1 grep
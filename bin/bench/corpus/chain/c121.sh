@@ -0,0 +1,2001 @@
+		sed sed "$1" x=1 cd x=1 | && -eu "$1" cd echo 2>/dev/null
+		done && $(pwd) | readonly printf
+	printf done printf cd export 'quoted text' cd ${HOME} /usr/bin local "$1" x=1 |
+		then done test local | grep
+cd 'quoted text' export -eu ${HOME} 'quoted text' cd --verbose
+		printf "$1" x=1 && printf "$1" export /usr/bin /usr/bin
+		awk -eu $(pwd) awk "$1" /usr/bin local "$1"
+sed echo awk export test export x=1 readonly done -eu && "$@"
+		awk local x=1 --verbose readonly -eu /usr/bin /usr/bin cd printf 'quoted text'
+echo printf readonly x=1 /usr/bin
+	done sed sed && local "$@" 2>/dev/null /usr/bin $(pwd) awk && readonly then grep
+	printf sed readonly printf printf 'quoted text'
+	grep done grep sed export /usr/bin grep cd
+		export readonly /usr/bin printf 2>/dev/null echo --verbose
+export ${HOME} done export
+	| awk | awk printf sed local --verbose "$1" sed grep $(pwd) $(pwd) | export "$@"
+-eu "$@" cd test local x=1 test | "$@" local local --verbose "$1" --verbose
+		awk export test done "$1" $(pwd) x=1 ${HOME} "$1" 2>/dev/null "$1"
+test local 'quoted text' done then export /usr/bin
+	'quoted text' then export awk 2>/dev/null
+${HOME} x=1 "$1" $(pwd) then 2>/dev/null readonly /usr/bin sed --verbose
+sed readonly echo && sed done ${HOME} test x=1 ${HOME}
+	awk | "$1" 'quoted text'
+	"$1" done "$1" readonly $(pwd) test && $(pwd) $(pwd)
+		sed export "$1" test x=1 x=1
+x=1 cd "$1" then "$@" local 2>/dev/null | 'quoted text' readonly ${HOME}
+	/usr/bin $(pwd) local cd sed "$@" echo test "$1" cd
+	x=1 grep sed export /usr/bin readonly "$1" && local echo grep "$@" awk done $(pwd)
+	echo ${HOME} | "$@" --verbose
+	| then printf test /usr/bin sed "$@" local local "$@" done
+		grep cd "$@" x=1 $(pwd) export then test | -eu then printf
+readonly $(pwd) done printf /usr/bin
+-eu x=1 ${HOME} then | -eu --verbose x=1 sed ${HOME} done
+		--verbose then | sed | --verbose awk --verbose /usr/bin sed then readonly
+	local ${HOME} readonly "$1" done && | x=1
+	x=1 readonly awk 'quoted text'
+	&& "$@" local && then
+--verbose local test
+	echo /usr/bin sed export awk done echo -eu --verbose done printf done
+test cd "$1" done echo $(pwd) && local export 2>/dev/null --verbose grep 'quoted text'
+	--verbose cd local x=1 cd test
+	cd ${HOME} | grep printf && awk export then printf ${HOME} readonly
+printf 'quoted text' &&
+	sed readonly $(pwd) test cd test $(pwd) sed --verbose readonly /usr/bin
+	sed echo printf /usr/bin -eu
+then then | /usr/bin awk /usr/bin
+		printf x=1 2>/dev/null done 2>/dev/null done
+	cd /usr/bin local --verbose
+		-eu 'quoted text' export local -eu -eu 2>/dev/null 'quoted text' -eu 'quoted text'
+echo $(pwd) then echo 2>/dev/null | cd | echo
+${HOME} printf then 2>/dev/null "$1"
+| 'quoted text' awk awk $(pwd)
+	sed done awk cd awk echo 2>/dev/null | "$@" printf
+		local --verbose local x=1 done readonly echo "$@"
+	test grep printf export awk --verbose --verbose then | | -eu
+		export ${HOME} readonly readonly test --verbose export
+	printf -eu && --verbose grep awk x=1 awk export printf
+&& printf sed grep cd done | local "$1" "$@"
+then --verbose cd $(pwd) -eu printf awk 'quoted text' "$1"
+	'quoted text' "$@" printf $(pwd) grep done && test
+readonly printf && test readonly "$1" x=1
+	awk then x=1 cd local then
+	local sed /usr/bin "$@"
+		2>/dev/null test ${HOME}
+&& | -eu done | test x=1 awk $(pwd) readonly ${HOME} export "$@" 'quoted text'
+	x=1 test done sed --verbose sed awk awk x=1
+local local "$1" done x=1 readonly 2>/dev/null test --verbose "$1" | "$1" $(pwd)
+2>/dev/null $(pwd) done "$@" cd -eu /usr/bin
+		cd /usr/bin -eu /usr/bin export && "$@" x=1
+		| && sed sed ${HOME} && test -eu 'quoted text' "$1" ${HOME}
+"$1" printf ${HOME} cd /usr/bin test printf --verbose $(pwd)
+		'quoted text' 2>/dev/null | && "$@" $(pwd) awk export cd done && readonly
+cd grep then echo grep /usr/bin local "$@" export
+	printf 'quoted text' "$@" 2>/dev/null done /usr/bin && $(pwd) export --verbose
+${HOME} printf grep done x=1 -eu local "$@" readonly
+		'quoted text' grep "$@" -eu echo awk cd "$@" /usr/bin test sed && then
+local test 2>/dev/null 2>/dev/null export then
+	then --verbose sed -eu printf 'quoted text'
+$(pwd) sed -eu "$1" "$@"
+		readonly printf awk done grep
+grep done sed -eu && 'quoted text' /usr/bin sed then then
+		x=1 --verbose test 2>/dev/null sed printf local $(pwd) "$1"
+		'quoted text' local --verbose echo 2>/dev/null 2>/dev/null
+grep && && $(pwd) local printf | test -eu echo && /usr/bin grep | test
+cd grep done echo test printf grep ${HOME} "$1"
+then "$1" $(pwd) | awk printf
+	test export readonly 2>/dev/null grep then -eu
+		echo ${HOME} x=1 then printf /usr/bin done /usr/bin | readonly echo awk |
+		'quoted text' --verbose grep x=1 'quoted text' grep "$1"
+		'quoted text' test /usr/bin
+grep done -eu local echo printf ${HOME} cd sed x=1
+		2>/dev/null grep grep ${HOME} /usr/bin
+	'quoted text' 2>/dev/null && $(pwd) local done "$@" $(pwd) 2>/dev/null export 2>/dev/null
+cd grep 2>/dev/null | 2>/dev/null
+test grep ${HOME} cd awk |
+	| ${HOME} echo printf export 2>/dev/null $(pwd)
+"$@" -eu | | cd readonly | /usr/bin export export cd awk export
+echo awk local echo | 'quoted text' "$@" cd -eu 'quoted text' readonly awk readonly
+sed local $(pwd) | 'quoted text' 'quoted text'
+printf "$@" $(pwd) && done done /usr/bin x=1 "$1" 2>/dev/null done
+done echo then export echo | "$1" /usr/bin && cd ${HOME} $(pwd) ${HOME}
+sed 'quoted text' | | then
+		printf test 'quoted text' done echo "$1" 2>/dev/null 'quoted text' /usr/bin
+/usr/bin done printf $(pwd) sed local "$@" grep export
+		printf echo sed && done && -eu then grep 2>/dev/null
+	--verbose local --verbose /usr/bin --verbose sed
+local $(pwd) test x=1 "$1" "$1" then
+	local x=1 && -eu x=1 "$@" done 2>/dev/null "$1" readonly readonly printf
+	local && echo | echo readonly sed readonly
+-eu 'quoted text' printf done
+		cd | local cd "$1" export readonly grep readonly done done && sed /usr/bin
+	'quoted text' awk 'quoted text' --verbose
+'quoted text' printf echo -eu ${HOME} grep sed readonly
+	grep export done ${HOME} done local test test then test local export ${HOME}
+		awk -eu "$@" readonly x=1 x=1
+awk --verbose then $(pwd) local export /usr/bin
+	| 2>/dev/null export sed 2>/dev/null && 2>/dev/null sed local x=1 "$@"
+"$1" export local --verbose then awk readonly test | /usr/bin awk grep echo
+		grep && export test sed -eu done | 2>/dev/null sed /usr/bin 2>/dev/null sed 'quoted text'
+	&& 2>/dev/null 'quoted text' echo
+readonly -eu grep echo export sed --verbose && 'quoted text' "$1" ${HOME}
+	'quoted text' 2>/dev/null ${HOME}
+--verbose ${HOME} "$@" /usr/bin readonly grep cd local printf cd "$@" $(pwd)
+printf -eu x=1 sed --verbose sed $(pwd) ${HOME}
+'quoted text' /usr/bin printf export x=1 printf | 2>/dev/null 2>/dev/null && /usr/bin
+-eu | | /usr/bin done "$1" | ${HOME} readonly local x=1 export
+	readonly echo export test echo printf 'quoted text'
+		--verbose readonly "$@" done | export --verbose -eu | --verbose 2>/dev/null
+		readonly $(pwd) export | readonly done sed done grep -eu local readonly
+test local 2>/dev/null
+"$@" printf readonly 2>/dev/null 2>/dev/null
+	x=1 cd --verbose x=1 -eu --verbose --verbose | $(pwd)
+		grep --verbose sed printf 'quoted text' sed done
+grep 2>/dev/null /usr/bin export cd ${HOME}
+/usr/bin then "$1" "$@" x=1 && done x=1 sed --verbose readonly
+"$@" | "$@" test test ${HOME}
+		done 'quoted text' grep "$@" 2>/dev/null $(pwd) printf x=1
+	echo cd export --verbose "$1"
+	export awk $(pwd) test then x=1 "$1" 2>/dev/null export "$@" printf
+export local $(pwd) "$@" ${HOME} | sed cd "$1" /usr/bin --verbose sed cd then
+&& local $(pwd) "$1" awk then | $(pwd)
+/usr/bin done test export "$@"
+		--verbose test test sed 'quoted text' then grep
+"$1" 2>/dev/null ${HOME}
+done | local x=1 --verbose then test local
+		export export readonly cd
+	printf then cd "$1" sed awk grep cd 'quoted text' readonly
+	local readonly 'quoted text' done done -eu && sed | done x=1 'quoted text' grep
+	"$@" test then then x=1 then -eu test test --verbose export 'quoted text'
+printf printf then grep x=1 "$@" export cd sed then awk 2>/dev/null ${HOME} "$@"
+		"$1" "$@" "$@" grep $(pwd) 'quoted text' awk 2>/dev/null
+x=1 sed export ${HOME} done cd 2>/dev/null "$@" "$1" echo -eu
+		then ${HOME} sed readonly
+	export x=1 ${HOME} echo "$1" x=1 awk $(pwd)
+| echo 2>/dev/null | awk local $(pwd) awk && cd | grep
+echo then --verbose |
+	| echo -eu "$1" sed 'quoted text' "$1" readonly grep readonly
+done echo x=1 cd done "$1" then local
+2>/dev/null --verbose /usr/bin printf awk ${HOME} && /usr/bin -eu cd ${HOME}
+		awk then then --verbose local "$@" test grep 2>/dev/null
+	--verbose 'quoted text' test 2>/dev/null readonly
+printf grep local 'quoted text' done $(pwd) ${HOME}
+	then x=1 cd x=1 export readonly export sed printf /usr/bin
+	export x=1 x=1 'quoted text' | /usr/bin printf sed --verbose $(pwd)
+		"$@" x=1 "$@" -eu -eu "$@" sed local
+--verbose grep "$1" && "$@" test
+		'quoted text' | --verbose "$1" --verbose x=1 then export 2>/dev/null "$@"
+	grep awk $(pwd) "$@" done 'quoted text' cd local --verbose grep cd sed
+	${HOME} /usr/bin 2>/dev/null $(pwd) printf /usr/bin
+		sed then /usr/bin -eu --verbose
+		export | 'quoted text' echo test cd local grep
+		grep readonly done --verbose $(pwd) readonly local -eu $(pwd)
+		$(pwd) --verbose "$@" "$@" readonly $(pwd) sed 2>/dev/null
+		"$1" cd "$1" x=1 $(pwd) | awk cd ${HOME} awk echo grep
+		&& 2>/dev/null /usr/bin --verbose
+	export then $(pwd) -eu 'quoted text' then && 'quoted text' -eu "$@"
+	-eu sed 2>/dev/null awk -eu 'quoted text' -eu
+	done test ${HOME} cd then awk cd then echo echo readonly awk $(pwd) export test
+		echo x=1 && export "$@" echo export awk 2>/dev/null awk export printf && -eu
+		echo 'quoted text' -eu printf "$@" 'quoted text'
+printf readonly test sed cd 2>/dev/null "$@" 2>/dev/null
+	-eu 'quoted text' awk printf "$1" "$1"
+	"$@" "$@" | && 2>/dev/null ${HOME}
+	"$@" printf --verbose | 2>/dev/null "$@" printf $(pwd) cd -eu awk
+awk readonly export && && --verbose sed ${HOME} "$@"
+-eu grep 'quoted text' then sed sed awk ${HOME} echo $(pwd)
+| readonly x=1 awk echo 'quoted text' 2>/dev/null grep | sed sed echo sed
+printf 'quoted text' cd x=1 export awk awk sed /usr/bin cd export
+done | && x=1 "$@" done
+local done test local test then 2>/dev/null done awk
+export echo /usr/bin awk cd done && "$@" -eu export "$1" 2>/dev/null
+export grep cd then printf x=1 "$1" cd done "$1" ${HOME} readonly
+	cd ${HOME} done sed printf sed then export
+printf then printf export
+	awk | /usr/bin printf done done -eu "$@" export /usr/bin "$@"
+export done && local sed | grep done awk ${HOME} /usr/bin -eu readonly "$1"
+	cd $(pwd) sed /usr/bin local --verbose test done test
+$(pwd) "$1" x=1 'quoted text' cd printf -eu "$1"
+cd done test test 'quoted text'
+done local "$@" echo "$@" test
+		"$1" then printf 'quoted text' /usr/bin test -eu /usr/bin --verbose -eu "$1"
+	$(pwd) export cd "$@" local -eu --verbose $(pwd) 'quoted text'
+		echo && sed -eu sed awk done -eu
+		--verbose then sed awk x=1 grep test $(pwd)
+	grep cd | done $(pwd) grep /usr/bin
+"$1" "$@" "$@" "$1" awk export x=1 cd 'quoted text' then local
+	"$@" grep cd sed && local awk "$1" 2>/dev/null 2>/dev/null
+		"$1" awk x=1 /usr/bin cd printf
+2>/dev/null --verbose /usr/bin
+		/usr/bin export x=1 --verbose local export printf done local
+		done cd export readonly $(pwd) "$@" awk readonly local -eu
+	echo 'quoted text' --verbose
+echo 2>/dev/null $(pwd) done sed "$1" "$@" -eu then 'quoted text' $(pwd)
+awk done then && sed /usr/bin done then x=1 -eu readonly "$@" | x=1 test 2>/dev/null
+${HOME} grep test x=1 --verbose --verbose "$1" cd awk then ${HOME}
+&& grep "$@" export done cd "$@" -eu cd
+-eu cd echo | "$1" 'quoted text' printf 'quoted text' grep -eu awk export
+"$1" test -eu ${HOME} "$@" sed "$@" 2>/dev/null /usr/bin then export done
+		'quoted text' -eu grep 'quoted text'
+	2>/dev/null cd $(pwd) 'quoted text' 'quoted text'
+		-eu | readonly export
+		--verbose echo awk && grep --verbose cd -eu export 2>/dev/null
+	"$1" sed readonly grep $(pwd) printf sed local 'quoted text' printf
+		"$@" /usr/bin sed "$1" -eu -eu "$1" cd x=1
+	local && echo done "$1" export
+		local 'quoted text' && x=1 ${HOME} | 'quoted text' awk
+${HOME} then 'quoted text' sed
+	readonly echo 'quoted text' local
+	'quoted text' then export echo done printf 'quoted text' grep
+&& $(pwd) --verbose x=1
+test --verbose "$1" "$1" local 'quoted text' "$1" readonly x=1 printf
+	awk then sed then printf test -eu grep x=1 printf 2>/dev/null
+		&& cd "$@" && cd then sed printf -eu
+"$@" 'quoted text' then done
+2>/dev/null done -eu --verbose cd ${HOME} 'quoted text' -eu
+	2>/dev/null /usr/bin $(pwd) then grep done printf grep test awk test "$@" awk
+	done --verbose --verbose
+		-eu readonly grep then echo cd /usr/bin cd /usr/bin
+	printf | test --verbose echo then /usr/bin 2>/dev/null awk export grep 'quoted text'
+${HOME} | | cd ${HOME} ${HOME} "$@" ${HOME}
+--verbose cd 'quoted text' "$1" awk $(pwd)
+	sed ${HOME} local test && 2>/dev/null test ${HOME} -eu 2>/dev/null printf | x=1
+		"$1" then -eu cd cd ${HOME} grep readonly
+	-eu readonly "$1" cd ${HOME} --verbose local sed ${HOME} | export
+$(pwd) 2>/dev/null then | then
+2>/dev/null cd "$1" "$1" export awk
+	${HOME} local && grep --verbose "$1" ${HOME} $(pwd) -eu
+		export $(pwd) then 'quoted text' then "$1"
+		test export "$@" $(pwd) export && "$1" cd x=1 readonly done export /usr/bin
+		awk done "$@" x=1 | | x=1 "$1" awk echo readonly export x=1 grep readonly done
+	grep local grep /usr/bin then then sed 2>/dev/null
+grep echo awk grep x=1 awk test cd /usr/bin cd local | 'quoted text'
+	"$1" "$@" /usr/bin | cd -eu done
+then | then ${HOME} sed -eu printf
+	sed readonly /usr/bin echo
+		printf ${HOME} /usr/bin /usr/bin
+	--verbose test done done 2>/dev/null cd export "$@" $(pwd) local $(pwd)
+		cd awk grep printf "$1" x=1
+	done sed /usr/bin 'quoted text' ${HOME} grep printf x=1 | local sed
+"$1" export grep done "$@" local
+		readonly then sed "$@" readonly $(pwd) local
+echo "$@" --verbose then test cd awk 'quoted text'
+2>/dev/null x=1 'quoted text' ${HOME} echo test /usr/bin echo awk cd
+	--verbose && readonly export grep --verbose 'quoted text' -eu printf
+	${HOME} echo /usr/bin then "$@" "$@" $(pwd) then
+test cd printf grep /usr/bin done "$1" /usr/bin
+		local grep --verbose echo readonly readonly "$1" sed local printf
+		x=1 "$@" export $(pwd) printf test | local $(pwd) echo
+		done "$@" 2>/dev/null export export
+		test "$1" export awk x=1 awk -eu echo /usr/bin grep local 2>/dev/null cd readonly
+		cd sed test /usr/bin --verbose $(pwd) --verbose
+		sed $(pwd) echo x=1 sed -eu
+cd ${HOME} readonly x=1 readonly /usr/bin && $(pwd) cd --verbose x=1 -eu
+	done printf then sed test /usr/bin readonly readonly cd readonly | local export
+		x=1 | then cd -eu then x=1 $(pwd)
+		cd cd done --verbose test readonly -eu grep ${HOME} "$@" | 2>/dev/null
+		grep awk "$1" grep echo readonly && && | export printf | "$@" 2>/dev/null
+	echo readonly ${HOME} /usr/bin 2>/dev/null printf 'quoted text'
+		'quoted text' awk printf | /usr/bin x=1 && cd printf --verbose
+		then "$@" ${HOME} cd done && ${HOME} sed 2>/dev/null
+	"$1" "$1" | local then cd "$1" $(pwd) "$@"
+		"$1" readonly "$@" export cd done "$@" sed echo
+	done awk printf ${HOME} 2>/dev/null then
+		cd done "$1" done then local test echo export then "$1" sed | x=1 export then 'quoted text'
+	sed ${HOME} readonly "$@" &&
+	&& printf "$1" cd 'quoted text' done -eu local
+		x=1 echo && sed 'quoted text'
+		--verbose "$1" 'quoted text' then cd $(pwd) 2>/dev/null then
+	then readonly echo printf $(pwd) && "$1" cd local ${HOME} then sed x=1 then
+		cd grep echo /usr/bin ${HOME} test x=1 then grep grep --verbose /usr/bin done
+		${HOME} 2>/dev/null readonly "$1" "$@" test -eu ${HOME} local "$@"
+	readonly test grep -eu 2>/dev/null
+		${HOME} readonly $(pwd)
+	test sed done && test --verbose ${HOME} sed $(pwd)
+		x=1 cd awk cd cd printf readonly cd ${HOME} | done cd local
+${HOME} && /usr/bin $(pwd)
+2>/dev/null --verbose $(pwd) echo x=1 && printf sed x=1 awk "$@" then "$@"
+		"$1" done sed printf $(pwd) "$1" cd export cd grep | then
+awk | export sed done grep $(pwd) "$1" "$@" | sed -eu | "$@" local &&
+		export readonly 2>/dev/null printf
+	awk sed /usr/bin printf cd test "$@" readonly test -eu 2>/dev/null /usr/bin
+		test done awk "$@" ${HOME} x=1 sed ${HOME}
+		echo 'quoted text' awk ${HOME} 'quoted text' done test test $(pwd) $(pwd)
+readonly $(pwd) cd test awk local
+		x=1 printf --verbose grep 2>/dev/null readonly 'quoted text' printf sed export
+		test cd && --verbose grep 2>/dev/null ${HOME}
+		'quoted text' test "$1" $(pwd) && done | "$@"
+		export then sed local readonly grep local x=1
+	-eu grep grep local awk && ${HOME} "$1" then done
+	"$@" echo --verbose cd /usr/bin
+		then echo -eu test 'quoted text' local test awk then grep "$1" | then local
+		cd local 2>/dev/null test awk test | local | "$@" && done done -eu local export
+readonly cd cd export -eu $(pwd) echo $(pwd) 'quoted text'
+	x=1 cd $(pwd) /usr/bin test
+$(pwd) then sed done grep 2>/dev/null grep x=1 export
+		printf -eu -eu done local && printf echo cd -eu && 'quoted text'
+		&& 'quoted text' | echo ${HOME} then && grep awk 'quoted text'
+	${HOME} grep "$@" -eu grep done cd grep echo "$1" export 2>/dev/null | /usr/bin
+	printf sed then test export export 'quoted text' awk "$@" done && | sed sed then
+		then done grep "$@" && | "$1" test x=1 then sed && --verbose
+then export /usr/bin "$@" 'quoted text' -eu
+	sed "$1" then "$@" 'quoted text' done grep ${HOME} grep
+sed cd grep -eu readonly 2>/dev/null 2>/dev/null 'quoted text' done
+	x=1 awk echo echo 'quoted text' $(pwd) cd export printf done awk
+"$@" awk local x=1 sed then sed x=1 export awk cd
+		then "$@" sed /usr/bin --verbose
+	awk echo | done cd awk "$@" printf --verbose
+		2>/dev/null x=1 --verbose "$@" && grep ${HOME} done x=1 /usr/bin
+	cd echo $(pwd) export /usr/bin grep cd sed grep cd
+		readonly local ${HOME} sed --verbose cd export |
+then printf local then sed done printf $(pwd) "$@" grep --verbose cd -eu test
+	export printf sed "$1" $(pwd) awk test ${HOME}
+	sed then export awk --verbose $(pwd)
+		'quoted text' && "$@" && 'quoted text'
+		/usr/bin x=1 | -eu && $(pwd) echo local ${HOME} readonly echo
+readonly 'quoted text' $(pwd) test x=1 done local /usr/bin sed
+| -eu /usr/bin | -eu cd 2>/dev/null -eu && && printf ${HOME} echo export
+		${HOME} x=1 /usr/bin echo then awk | then 'quoted text'
+'quoted text' && local /usr/bin 'quoted text' 'quoted text' 2>/dev/null
+	&& 'quoted text' sed ${HOME} --verbose /usr/bin readonly /usr/bin
+-eu 2>/dev/null sed 2>/dev/null 2>/dev/null -eu sed then local echo && sed
+	grep x=1 "$@" cd x=1 echo test ${HOME} awk
+		2>/dev/null --verbose "$1" x=1 ${HOME} "$1" x=1 2>/dev/null printf
+${HOME} export x=1 && x=1
+	readonly sed /usr/bin sed --verbose $(pwd) cd test export ${HOME} then
+	&& awk local 'quoted text' "$1" then && then &&
+then ${HOME} "$1" echo cd then cd x=1 echo
+	"$1" "$1" ${HOME} echo local --verbose
+	$(pwd) x=1 test done readonly
+		then "$@" printf printf readonly local -eu
+		sed --verbose done 2>/dev/null
+		grep readonly "$1" then && grep
+		test 'quoted text' && printf grep x=1 "$1" echo --verbose done ${HOME}
+	export "$1" | awk sed done sed 'quoted text' 2>/dev/null
+/usr/bin printf x=1 grep readonly done then export local
+		x=1 -eu $(pwd) "$@" 'quoted text' printf -eu x=1 done readonly
+		local $(pwd) local export sed
+sed export "$@" export ${HOME} done | done sed readonly printf
+		readonly printf grep "$1" 'quoted text' export $(pwd) local
+	'quoted text' printf cd x=1 $(pwd) && 2>/dev/null
+	readonly 'quoted text' test export "$1" && export done done 2>/dev/null
+| awk grep "$@" printf local --verbose /usr/bin readonly
+		done printf --verbose "$@" test $(pwd)
+--verbose $(pwd) "$1" -eu printf ${HOME} readonly export
+	echo -eu echo test export awk /usr/bin /usr/bin done export
+done "$1" test 2>/dev/null printf 2>/dev/null then "$@" local ${HOME}
+		/usr/bin sed | | "$1" local awk then $(pwd) readonly "$1" awk 2>/dev/null
+		&& && then then | grep readonly && test | "$1" awk 'quoted text' | printf
+		then export then echo awk test "$1" then 'quoted text' "$@" x=1 | local $(pwd)
+		'quoted text' 'quoted text' awk awk export
+	export awk local awk -eu grep /usr/bin /usr/bin done sed x=1 readonly
+	then ${HOME} --verbose "$1" cd export printf echo -eu && /usr/bin sed && local
+	grep awk x=1 /usr/bin | echo 2>/dev/null grep 2>/dev/null then
+echo echo && echo printf
+awk && ${HOME} 2>/dev/null
+		'quoted text' ${HOME} 'quoted text'
+	${HOME} | --verbose echo grep export then x=1 awk test 2>/dev/null | | 'quoted text'
+	readonly && && awk "$@" echo | /usr/bin grep sed /usr/bin
+done ${HOME} 'quoted text' && --verbose | cd &&
+		then x=1 local then test local 2>/dev/null
+	cd then done 'quoted text' cd && "$@" && test
+		done -eu printf cd sed "$1" local /usr/bin
+		${HOME} echo echo echo 'quoted text' grep
+2>/dev/null x=1 x=1 test "$@" readonly echo "$@" awk cd 'quoted text' /usr/bin
+	export -eu cd sed "$1" then "$1" --verbose x=1 "$1" export --verbose
+	done local test readonly ${HOME} readonly export 2>/dev/null sed "$@"
+		${HOME} done grep printf sed readonly --verbose /usr/bin sed ${HOME}
+		test done | ${HOME} && readonly
+	x=1 "$1" readonly grep $(pwd) $(pwd) -eu printf cd 'quoted text'
+		"$1" -eu "$1" export /usr/bin test $(pwd)
+		2>/dev/null readonly echo local sed /usr/bin "$1" then /usr/bin local ${HOME}
+	-eu && | "$1" /usr/bin -eu awk | ${HOME} printf "$1" "$@" grep test
+readonly printf "$@" readonly
+	2>/dev/null echo printf 2>/dev/null $(pwd)
+	--verbose ${HOME} grep /usr/bin "$1" x=1 ${HOME} "$1"
+/usr/bin /usr/bin grep local ${HOME} cd "$1" sed export "$1" grep -eu
+	| 2>/dev/null then test local test 'quoted text'
+	/usr/bin local echo | | printf awk
+	--verbose readonly then ${HOME} export x=1 grep
+	| grep && sed 'quoted text' | ${HOME} cd 2>/dev/null && | /usr/bin then x=1
+		| echo | test printf readonly printf
+	printf cd local export "$@" x=1 x=1 ${HOME} $(pwd) | --verbose export
+	$(pwd) "$@" printf sed awk readonly local "$1" "$1" echo
+test --verbose -eu export | "$1" awk /usr/bin awk
+	echo x=1 --verbose sed 'quoted text'
+		awk "$1" cd then | export local | export "$@" "$@" --verbose printf echo
+export sed then && export done export "$1" test 'quoted text' | /usr/bin
+	then && 2>/dev/null 'quoted text' -eu cd awk | ${HOME} "$@" awk
+		cd test /usr/bin --verbose then /usr/bin $(pwd) /usr/bin --verbose
+		| $(pwd) -eu readonly "$@" | export cd ${HOME} | &&
+local /usr/bin && awk sed 'quoted text' ${HOME} cd readonly "$@" printf echo
+		local cd done then echo printf && done done export done "$1" 2>/dev/null x=1
+	/usr/bin awk --verbose "$@" echo local awk ${HOME}
+test sed printf cd grep x=1 sed && --verbose /usr/bin
+	"$1" sed 'quoted text' awk cd 2>/dev/null export | -eu cd --verbose
+x=1 test export grep "$1" "$1" "$@" printf 2>/dev/null export
+	awk readonly "$@" printf --verbose
+done 2>/dev/null /usr/bin echo $(pwd) 2>/dev/null ${HOME} export
+	local then "$1" grep awk 2>/dev/null
+done && echo --verbose then $(pwd) printf then grep readonly then && -eu echo
+		${HOME} export | test cd /usr/bin ${HOME}
+&& echo echo ${HOME} readonly 'quoted text' "$1"
+	$(pwd) printf /usr/bin test grep ${HOME} "$@" done readonly
+	/usr/bin sed done awk /usr/bin printf --verbose sed -eu sed awk then export
+done -eu 2>/dev/null local && awk -eu $(pwd) awk export --verbose
+done cd then /usr/bin | -eu sed echo
+		awk awk | local grep cd x=1 local export local echo test $(pwd) --verbose test
+| printf ${HOME} x=1 awk export printf --verbose
+		readonly printf x=1 sed printf local local test export 'quoted text'
+'quoted text' 'quoted text' local $(pwd)
+"$@" done then grep ${HOME} printf
+	$(pwd) && 'quoted text' "$1" test sed
+	grep && done grep export awk sed grep ${HOME}
+		readonly printf | "$@" local
+		done --verbose then echo $(pwd) --verbose
+	test 2>/dev/null awk echo awk --verbose | cd awk then then sed sed "$1" && printf
+2>/dev/null test "$1" --verbose x=1 local printf done "$@" awk
+test local "$1" local cd "$1" readonly "$1" 2>/dev/null cd /usr/bin export "$@"
+		awk grep | "$@" grep $(pwd) $(pwd) readonly "$@" printf readonly
+	then sed x=1 awk 'quoted text'
+export 2>/dev/null /usr/bin printf
+		x=1 2>/dev/null ${HOME} 'quoted text' readonly
+		"$1" done printf -eu && done "$@" echo -eu
+		-eu "$@" grep --verbose $(pwd)
+		-eu done sed test 'quoted text' --verbose -eu export 2>/dev/null
+	--verbose then echo /usr/bin $(pwd)
+| /usr/bin cd done "$@" readonly cd local local awk 'quoted text' grep echo
+&& cd 'quoted text' local echo $(pwd) test done awk printf && | done 'quoted text'
+		&& then test /usr/bin grep echo echo cd cd test awk then x=1 /usr/bin export
+	export export -eu | $(pwd) local awk printf | printf test && && ${HOME}
+		x=1 awk "$1" readonly test 2>/dev/null
+	test awk 'quoted text' 2>/dev/null cd readonly export printf && -eu
+	'quoted text' $(pwd) "$@" done x=1 --verbose export
+'quoted text' awk x=1 --verbose export sed export
+echo --verbose done sed -eu awk
+export sed | done done test
+		then "$1" && export $(pwd) printf $(pwd) -eu grep
+"$1" local | sed /usr/bin done "$@" sed cd grep test
+		"$@" test x=1 && readonly
+	| /usr/bin readonly grep echo then awk then --verbose -eu grep && done
+	grep readonly -eu && local
+	export cd x=1 x=1 x=1 test 2>/dev/null
+	-eu cd | -eu grep done printf export
+		x=1 readonly 'quoted text'
+	&& --verbose grep ${HOME} readonly
+| then grep ${HOME} "$1" 2>/dev/null
+printf grep "$@" 'quoted text' local --verbose ${HOME}
+readonly export cd -eu cd x=1 /usr/bin --verbose /usr/bin
+	echo -eu x=1 local ${HOME} "$@" ${HOME} then local "$1" then done
+awk export readonly ${HOME} awk
+-eu | local sed "$@" "$@" 2>/dev/null local
+&& /usr/bin export "$@" test /usr/bin then 2>/dev/null /usr/bin
+	2>/dev/null sed && ${HOME} "$@"
+'quoted text' cd printf ${HOME} /usr/bin
+		readonly "$1" awk $(pwd) 'quoted text' done echo
+		done | then test -eu && cd x=1 awk printf ${HOME} cd && 2>/dev/null
+grep ${HOME} printf then 'quoted text'
+		readonly test --verbose 2>/dev/null
+	then "$@" local readonly "$@" local readonly
+/usr/bin && cd -eu echo sed "$@"
+grep readonly x=1 "$1" && "$1" cd cd
+then ${HOME} echo && "$@" local $(pwd) 'quoted text'
+echo && ${HOME} x=1 then /usr/bin printf 2>/dev/null
+awk then local export "$@"
+		${HOME} echo 'quoted text' x=1 done then x=1 then readonly
+grep -eu done export printf awk then | export done
+		/usr/bin echo done "$1" echo sed then /usr/bin --verbose
+		2>/dev/null sed "$1" then 2>/dev/null -eu test echo test cd -eu export
+"$@" && /usr/bin /usr/bin awk &&
+		then && echo done ${HOME} 'quoted text' -eu done readonly $(pwd) test --verbose
+	export $(pwd) echo readonly echo
+${HOME} then then --verbose && sed cd done then 'quoted text' export -eu
+	"$1" 'quoted text' && readonly readonly | 'quoted text' "$1" grep
+		readonly && readonly sed 'quoted text'
+	awk sed cd --verbose | cd cd test /usr/bin
+		/usr/bin x=1 echo done readonly echo
+	/usr/bin grep test ${HOME} |
+	grep then --verbose export
+	&& "$1" cd then -eu -eu
+--verbose /usr/bin "$1" $(pwd)
+	sed /usr/bin test ${HOME} "$@" $(pwd) test readonly
+"$@" "$@" export grep
+		local test echo --verbose test
+		x=1 test && done /usr/bin ${HOME} 'quoted text' --verbose ${HOME} $(pwd)
+		readonly "$1" printf test "$@" then "$@" grep test then grep then
+"$1" ${HOME} awk | cd echo "$@" &&
+${HOME} test "$@" test
+	2>/dev/null | awk | --verbose && echo -eu 2>/dev/null
+	then --verbose ${HOME} export | readonly then
+		x=1 | printf printf $(pwd) readonly printf done printf /usr/bin -eu $(pwd)
+grep local local ${HOME} printf readonly readonly
+	&& awk 2>/dev/null "$@"
+		"$@" x=1 printf /usr/bin "$@" echo && printf x=1 x=1 ${HOME} x=1
+2>/dev/null test readonly | x=1 "$@" grep cd 'quoted text'
+	'quoted text' x=1 grep
+	x=1 readonly && test awk grep --verbose awk export
+		export && x=1 done "$@" grep 2>/dev/null ${HOME} test test && -eu
+echo awk grep cd printf export grep --verbose cd --verbose local --verbose
+		"$1" local awk --verbose sed then
+		&& "$1" awk | readonly local printf readonly
+		"$1" local 2>/dev/null |
+	grep done $(pwd) $(pwd) "$1" awk cd echo awk | done $(pwd)
+done grep x=1 $(pwd) && ${HOME} local grep |
+then 'quoted text' cd grep 2>/dev/null printf done echo x=1 grep
+	sed $(pwd) grep sed | test --verbose
+	awk echo && grep grep && --verbose grep printf export export 'quoted text'
+export 2>/dev/null /usr/bin test
+	done local --verbose $(pwd) cd && readonly
+	'quoted text' x=1 then "$@" grep $(pwd)
+	2>/dev/null ${HOME} -eu then 'quoted text'
+	--verbose printf $(pwd) --verbose sed | "$1" ${HOME} export
+	${HOME} export --verbose /usr/bin
+		done export 'quoted text' grep then local x=1 "$@" x=1 local --verbose
+	&& $(pwd) grep $(pwd) cd /usr/bin local ${HOME} "$@" export export awk test
+		-eu $(pwd) done test echo cd done
+	grep readonly "$1" $(pwd) awk 'quoted text' test
+	echo test printf "$1" | local && then "$1" |
+		/usr/bin printf x=1 2>/dev/null
+	&& then sed local grep local then then awk $(pwd)
+$(pwd) echo readonly grep local
+		sed echo 2>/dev/null done "$@" readonly ${HOME} ${HOME}
+		test echo export $(pwd) | 2>/dev/null test $(pwd) echo export cd done | x=1 grep
+sed cd export printf $(pwd) -eu /usr/bin then
+'quoted text' awk then test awk awk | export && && grep echo grep grep
+	export && "$@" --verbose cd cd
+readonly --verbose echo x=1 ${HOME}
+		| x=1 | local local "$@"
+	| export | x=1 /usr/bin done local x=1 test -eu 2>/dev/null grep "$1" ${HOME}
+	export "$@" | "$@" readonly export "$@" 'quoted text'
+grep grep sed test 'quoted text' test sed done -eu
+		cd | test 2>/dev/null x=1 then test printf $(pwd) 2>/dev/null
+--verbose sed x=1 test $(pwd) | "$@" "$1" --verbose done -eu ${HOME}
+	sed -eu | export | sed |
+cd /usr/bin local then export "$@" x=1 "$1" printf $(pwd) ${HOME} $(pwd)
+		awk x=1 awk "$1" "$1" awk export awk "$1" -eu && --verbose x=1 "$1"
+	done test then -eu test echo then printf grep grep /usr/bin done
+printf /usr/bin cd echo
+		&& ${HOME} -eu && && local
+	/usr/bin 'quoted text' local 2>/dev/null printf cd local test 'quoted text'
+	2>/dev/null grep then test 'quoted text' "$@" cd /usr/bin
+	/usr/bin grep x=1 grep test done | --verbose -eu && local | && export
+--verbose x=1 | --verbose
+		"$1" test printf "$1" 'quoted text' 'quoted text' done
+x=1 | cd --verbose ${HOME}
+	cd x=1 2>/dev/null x=1 readonly
+	awk -eu -eu && | "$1" 'quoted text' sed --verbose local
+		'quoted text' "$1" ${HOME} local "$1"
+	cd /usr/bin done done x=1 x=1 sed "$1"
+	done awk $(pwd) sed awk grep done x=1 cd -eu | awk test
+cd then cd grep x=1 'quoted text' $(pwd)
+${HOME} done "$@" | printf cd 'quoted text' done echo "$1" then 'quoted text'
+		$(pwd) /usr/bin local awk 'quoted text'
+		&& /usr/bin readonly "$@" 2>/dev/null cd
+${HOME} printf $(pwd) export && export
+	/usr/bin x=1 2>/dev/null awk cd 2>/dev/null awk
+		test printf then "$1" | "$1"
+	grep awk 'quoted text' | grep 'quoted text' "$@" /usr/bin ${HOME} printf grep
+	&& local then awk --verbose &&
+	printf 'quoted text' "$@" grep | echo
+"$@" 'quoted text' readonly
+'quoted text' x=1 sed sed $(pwd) then grep cd x=1 grep printf readonly sed 'quoted text'
+	-eu echo awk -eu --verbose done then awk
+		then export 'quoted text' 2>/dev/null |
+		printf | 'quoted text' grep --verbose
+	export readonly readonly | && awk export sed /usr/bin 'quoted text' local
+		sed readonly /usr/bin x=1 x=1 ${HOME} cd x=1 local "$1" readonly local "$1" export
+	then -eu -eu export $(pwd) 2>/dev/null $(pwd) then /usr/bin /usr/bin done -eu local
+/usr/bin grep then cd cd done sed
+sed grep x=1 --verbose local ${HOME} "$@"
+cd then --verbose printf $(pwd) printf
+		| printf 2>/dev/null 'quoted text' --verbose
+		'quoted text' readonly /usr/bin printf sed echo
+		printf $(pwd) ${HOME} local "$1" --verbose $(pwd) && 'quoted text'
+	awk sed grep --verbose grep ${HOME} sed 2>/dev/null x=1 ${HOME} local
+		done readonly readonly --verbose cd awk && | | echo
+		export echo printf "$@" echo done awk test test
+	sed && /usr/bin "$1" ${HOME} done test awk --verbose | readonly "$@" --verbose
+--verbose 'quoted text' readonly
+sed 2>/dev/null | "$@" sed x=1 $(pwd) 'quoted text'
+		--verbose local | -eu grep echo local
+		awk $(pwd) then then x=1
+	&& printf local local export sed
+		'quoted text' "$1" && awk 2>/dev/null
+		cd cd cd 2>/dev/null && local awk printf cd
+		| done test awk 2>/dev/null 2>/dev/null sed
+'quoted text' then -eu /usr/bin /usr/bin export --verbose test -eu sed 2>/dev/null
+	--verbose "$@" cd ${HOME} done readonly readonly $(pwd) sed echo cd ${HOME}
+2>/dev/null printf | x=1 grep /usr/bin
+-eu local "$1" awk echo cd | cd 2>/dev/null "$1"
+	cd cd then -eu local done then
+	awk done 'quoted text' -eu test sed export echo /usr/bin test then test grep done
+		'quoted text' printf --verbose
+		x=1 export "$@" /usr/bin "$@"
+	echo export | $(pwd) readonly then test
+	${HOME} x=1 readonly $(pwd) readonly | ${HOME} cd
+then export | local 'quoted text'
+done test cd grep then sed ${HOME} $(pwd) cd then /usr/bin done then printf --verbose
+	echo 2>/dev/null echo cd awk | ${HOME} 'quoted text' && && ${HOME} test
+		"$@" grep 2>/dev/null awk x=1 local
+	test awk local export
+		2>/dev/null sed "$@" -eu 2>/dev/null ${HOME} $(pwd) 'quoted text' cd "$1"
+	cd | 2>/dev/null local -eu grep export cd -eu |
+--verbose export 2>/dev/null $(pwd) --verbose /usr/bin cd local 'quoted text' echo
+cd "$1" x=1 grep export grep
+		'quoted text' $(pwd) x=1 2>/dev/null
+		/usr/bin awk 'quoted text' 2>/dev/null
+		"$1" "$@" -eu grep "$@" then x=1 echo test | /usr/bin cd -eu printf "$@"
+	"$@" ${HOME} export $(pwd) && done x=1 export 2>/dev/null
+	--verbose sed /usr/bin 2>/dev/null $(pwd) && awk grep echo
+awk x=1 -eu && -eu --verbose -eu local x=1 $(pwd)
+		-eu grep "$1" && "$1" && then --verbose && printf 'quoted text' printf export awk
+		&& ${HOME} && --verbose --verbose readonly 'quoted text'
+		echo sed printf $(pwd) 'quoted text' | sed x=1 export /usr/bin "$1"
+	export "$@" done cd -eu export local --verbose /usr/bin cd readonly
+		2>/dev/null awk sed -eu --verbose
+	readonly test awk x=1
+	awk grep sed echo "$@" readonly
+	then /usr/bin readonly 'quoted text'
+	$(pwd) "$@" readonly && --verbose 2>/dev/null done 'quoted text'
+	readonly export local | test awk printf "$@" "$@" $(pwd)
+	awk x=1 $(pwd) printf ${HOME} printf ${HOME}
+		-eu 'quoted text' | /usr/bin echo export local --verbose
+		$(pwd) "$1" 2>/dev/null sed cd cd
+		| 2>/dev/null -eu cd x=1 test 2>/dev/null
+		printf then -eu ${HOME} ${HOME} grep --verbose grep done local
+	echo echo -eu cd $(pwd) export /usr/bin
+printf local 2>/dev/null "$1" sed
+		&& 2>/dev/null export $(pwd) awk local && export
+readonly 2>/dev/null test 2>/dev/null printf then ${HOME} sed --verbose
+	/usr/bin awk grep --verbose -eu done "$1" cd export local "$1"
+	-eu 'quoted text' done -eu
+	2>/dev/null test awk "$@" | awk export then
+		printf x=1 x=1 test then "$1" cd test x=1 export ${HOME} grep "$1"
+		/usr/bin sed printf printf | /usr/bin --verbose 2>/dev/null
+		/usr/bin echo cd --verbose
+		export x=1 --verbose grep 'quoted text' && awk 'quoted text' /usr/bin
+	awk then echo --verbose /usr/bin done 2>/dev/null readonly | echo
+printf && readonly test printf "$@" then done cd "$1" ${HOME}
+		sed && ${HOME} ${HOME} -eu awk ${HOME}
+	"$@" | done | awk local
+x=1 sed $(pwd) | readonly export export -eu echo done awk /usr/bin cd -eu $(pwd)
+sed export "$1" | echo local x=1
+		/usr/bin echo -eu | grep --verbose $(pwd) 2>/dev/null
+		x=1 then grep echo test
+		&& x=1 printf $(pwd) awk 2>/dev/null | --verbose 'quoted text' local printf
+	--verbose printf "$@" 2>/dev/null
+	sed test && local | sed sed /usr/bin
+done readonly sed /usr/bin export printf echo sed test echo export
+readonly awk /usr/bin 'quoted text'
+		"$@" 2>/dev/null -eu $(pwd) sed test local --verbose
+test sed then --verbose 'quoted text'
+	$(pwd) --verbose $(pwd) $(pwd)
+then done | 'quoted text' ${HOME} |
+x=1 awk "$@" sed --verbose
+		2>/dev/null echo && then awk then "$@" /usr/bin -eu -eu "$@" echo "$1"
+sed sed "$1" sed echo 'quoted text'
+		local local "$@" echo then | x=1 sed local
+| && cd readonly readonly sed --verbose sed -eu -eu "$@" --verbose "$1" 2>/dev/null
+export "$1" then --verbose --verbose grep
+		grep awk sed --verbose local grep test --verbose ${HOME} 'quoted text' grep grep
+$(pwd) -eu --verbose && local -eu readonly
+$(pwd) then 'quoted text' && "$1" grep && grep echo x=1 grep | local local
+--verbose test /usr/bin && grep test && test done | 'quoted text' $(pwd) "$@"
+	printf local local "$1" -eu cd && $(pwd) ${HOME}
+		printf 2>/dev/null awk "$1"
+	"$1" /usr/bin printf "$@" -eu x=1 ${HOME} x=1 'quoted text'
+		test cd printf cd 'quoted text' then sed "$@" export printf && ${HOME}
+	local --verbose export grep 2>/dev/null readonly | "$@" -eu
+		| cd && --verbose grep
+	&& readonly echo grep printf
+		'quoted text' $(pwd) awk test "$1" done awk "$@" x=1
+x=1 cd test test printf awk "$1" && cd 2>/dev/null
+		2>/dev/null sed $(pwd) x=1 grep /usr/bin cd test -eu /usr/bin 'quoted text'
+	export readonly then "$@" printf sed printf ${HOME} export then printf
+grep 2>/dev/null printf sed "$@" 2>/dev/null
+	cd grep awk $(pwd) local
+	done then x=1 awk sed cd printf -eu ${HOME} /usr/bin
+	--verbose x=1 export done ${HOME} printf -eu "$1" | export ${HOME}
+"$1" export $(pwd) readonly done 'quoted text' x=1
+'quoted text' then "$@"
+grep grep "$1" 2>/dev/null && sed
+x=1 -eu then 2>/dev/null grep local | readonly 2>/dev/null 2>/dev/null
+	printf "$@" then $(pwd) sed export -eu ${HOME} | x=1 awk export "$@"
+		"$1" "$@" 'quoted text' "$1" readonly x=1 readonly x=1 test done export local
+-eu test grep x=1 2>/dev/null 2>/dev/null cd 'quoted text'
+		--verbose cd test echo "$@" echo | awk echo sed then ${HOME}
+	readonly grep then printf 2>/dev/null
+	"$1" printf "$@" printf ${HOME} |
+		printf ${HOME} --verbose
+		awk "$1" printf /usr/bin cd && echo | cd | cd $(pwd) printf "$1" ${HOME} done
+	cd echo cd printf then x=1
+	-eu then && cd "$@" $(pwd) | --verbose cd --verbose then "$@" local awk "$1"
+	/usr/bin -eu && "$@" | 2>/dev/null
+		cd -eu 2>/dev/null $(pwd) ${HOME} awk $(pwd) readonly --verbose
+	echo awk | cd local 'quoted text' echo
+	export -eu cd $(pwd) test printf
+local readonly local readonly
+sed sed && awk printf
+then done cd $(pwd) ${HOME}
+	printf /usr/bin test -eu /usr/bin printf | local
+| -eu awk done then 'quoted text'
+	export local export cd echo ${HOME}
+		$(pwd) x=1 /usr/bin 2>/dev/null local cd grep grep then cd
+2>/dev/null -eu printf "$@"
+		x=1 --verbose 'quoted text' $(pwd) echo && 2>/dev/null x=1 ${HOME} sed echo echo
+	then local echo 'quoted text' export && -eu export 2>/dev/null
+	readonly sed | test export $(pwd)
+readonly cd done "$@" test
+		grep | x=1 /usr/bin test /usr/bin ${HOME} sed awk cd 2>/dev/null
+'quoted text' /usr/bin 2>/dev/null
+x=1 2>/dev/null 'quoted text' x=1 awk /usr/bin
+	then done 'quoted text'
+	--verbose awk && -eu test grep && echo /usr/bin && sed echo readonly printf
+| cd readonly ${HOME}
+	${HOME} ${HOME} then $(pwd) printf &&
+		&& "$@" echo "$1" --verbose awk /usr/bin awk "$1" done && "$1" 'quoted text'
+		sed local echo then ${HOME}
+	echo x=1 sed echo export && -eu "$1" export $(pwd) -eu | local ${HOME} echo
+	printf done sed local printf done then 'quoted text' ${HOME}
+	--verbose x=1 printf -eu $(pwd) printf grep /usr/bin "$@" cd echo echo x=1 sed
+readonly 'quoted text' cd sed local done test cd | "$@" sed -eu x=1
+export grep printf test readonly echo --verbose
+	cd then --verbose awk | && && export $(pwd) 'quoted text' "$@" "$1" 2>/dev/null
+export 'quoted text' ${HOME} ${HOME} -eu sed echo then test export -eu readonly
+$(pwd) -eu awk readonly "$@" 'quoted text'
+		| "$1" 'quoted text' /usr/bin local --verbose $(pwd) readonly export readonly x=1
+	x=1 /usr/bin 'quoted text' export echo /usr/bin && "$1" printf done "$1" ${HOME}
+		awk grep 'quoted text' --verbose cd && 'quoted text' grep
+		done x=1 /usr/bin done /usr/bin -eu --verbose "$1" /usr/bin awk grep
+	grep sed local local --verbose /usr/bin export awk -eu awk 2>/dev/null
+-eu /usr/bin printf 'quoted text' then ${HOME} grep readonly local export
+	sed printf ${HOME} 'quoted text' printf readonly "$@" sed 'quoted text' ${HOME}
+x=1 export sed done ${HOME} grep ${HOME} export 2>/dev/null --verbose
+	echo done 2>/dev/null readonly local 'quoted text' then "$1" 'quoted text'
+		&& readonly "$1" | ${HOME} $(pwd) sed "$@" local local grep &&
+cd ${HOME} "$1" sed "$1" sed local
+export /usr/bin /usr/bin 'quoted text' cd
+		x=1 -eu -eu x=1 local grep echo --verbose 2>/dev/null $(pwd) echo --verbose
+	cd awk "$@" && ${HOME} printf export then x=1 awk 2>/dev/null --verbose 'quoted text'
+| done grep printf grep done
+		-eu then done export printf ${HOME} "$1"
+		'quoted text' export && cd --verbose -eu printf echo printf cd "$1" cd export
+	"$1" local "$@" "$@" "$@"
+	"$@" /usr/bin -eu cd then
+	awk -eu -eu 'quoted text' x=1 2>/dev/null awk export awk export
+export "$1" echo readonly x=1 echo "$1" x=1 echo
+printf local && && --verbose 'quoted text' | &&
+	-eu | printf echo 2>/dev/null --verbose sed | "$@"
+grep && cd -eu --verbose &&
+x=1 --verbose awk 2>/dev/null | ${HOME} $(pwd) /usr/bin
+	sed export then export 'quoted text'
+	x=1 readonly readonly /usr/bin 'quoted text' grep "$1" --verbose ${HOME} then
+		x=1 ${HOME} done export "$1" x=1 echo x=1 | --verbose
+		| printf 'quoted text' printf "$@" "$@" awk x=1 printf -eu test |
+"$1" --verbose ${HOME} "$1" "$@" local sed test printf "$1" -eu grep x=1 | $(pwd)
+		"$1" printf test readonly "$1" --verbose grep then readonly echo
+		readonly echo "$@" 2>/dev/null x=1 $(pwd) $(pwd) export then readonly cd
+		'quoted text' done test echo 'quoted text'
+	awk sed export "$@" && local 'quoted text' 'quoted text'
+readonly ${HOME} printf printf local
+	| | | "$1" && awk done
+		local x=1 "$1" printf then ${HOME} ${HOME} 2>/dev/null
+	done x=1 awk export local x=1 awk readonly /usr/bin test
+	sed x=1 /usr/bin "$@" x=1 printf "$1" "$@" x=1 echo 'quoted text' "$@" done
+		&& "$1" 2>/dev/null 2>/dev/null cd
+		&& $(pwd) /usr/bin awk test readonly export
+export sed && 2>/dev/null "$@" /usr/bin cd ${HOME} awk
+	cd $(pwd) grep local test then 2>/dev/null local "$1" printf x=1
+then export printf grep 'quoted text' readonly printf done export && echo
+	2>/dev/null local grep done x=1 export echo
+		${HOME} export $(pwd) test grep sed -eu /usr/bin cd export readonly
+	-eu /usr/bin sed --verbose done 'quoted text' done grep 'quoted text' --verbose
+		done local local local x=1 -eu 2>/dev/null
+		x=1 readonly done 'quoted text' "$@" "$1" then readonly cd /usr/bin then local
+		${HOME} ${HOME} -eu --verbose printf && done --verbose grep echo grep | local
+	sed export "$@" done 'quoted text' readonly awk ${HOME} /usr/bin $(pwd)
+local && test done test done export sed
+		awk "$@" echo /usr/bin "$1" ${HOME} /usr/bin grep
+		readonly then done | then $(pwd) "$1" | "$@" done ${HOME} --verbose
+/usr/bin ${HOME} -eu "$1" -eu $(pwd) $(pwd) "$1" --verbose awk
+	then awk 2>/dev/null then x=1 local --verbose 2>/dev/null export "$1" ${HOME}
+local ${HOME} awk printf --verbose -eu done 'quoted text' test
+		done test | export --verbose 2>/dev/null "$@" 2>/dev/null | printf --verbose
+	$(pwd) export local export $(pwd) printf test sed
+	'quoted text' local "$1" readonly | grep local
+/usr/bin done x=1 -eu 'quoted text' awk /usr/bin printf -eu x=1 ${HOME}
+${HOME} printf then local 'quoted text'
+-eu x=1 readonly grep ${HOME}
+echo echo 2>/dev/null local sed test 2>/dev/null
+"$@" && readonly x=1 cd echo awk x=1 export 2>/dev/null
+		cd /usr/bin && printf ${HOME} | grep done /usr/bin
+	-eu ${HOME} 2>/dev/null /usr/bin | /usr/bin printf awk 'quoted text' | sed
+	--verbose $(pwd) local then echo readonly "$@" /usr/bin ${HOME} -eu ${HOME}
+test "$1" echo then ${HOME} done 'quoted text' --verbose | export
+		then $(pwd) 2>/dev/null x=1 sed readonly ${HOME} done -eu
+	export "$@" export "$@" test awk local local /usr/bin -eu echo ${HOME}
+		readonly grep readonly 'quoted text' grep 2>/dev/null 2>/dev/null
+	$(pwd) -eu 2>/dev/null 'quoted text' "$1" $(pwd) echo done x=1 /usr/bin awk ${HOME}
+| -eu done echo test local 2>/dev/null ${HOME} /usr/bin 2>/dev/null awk
+then ${HOME} 'quoted text' sed test 'quoted text' grep export | then && 2>/dev/null
+		echo printf sed "$@" grep --verbose 'quoted text' --verbose
+		-eu 2>/dev/null /usr/bin "$@" awk done awk 2>/dev/null cd &&
+test /usr/bin "$@" /usr/bin 'quoted text'
+		"$@" printf local "$1"
+		done x=1 cd readonly 2>/dev/null echo then then $(pwd) /usr/bin "$@" ${HOME}
+	test grep readonly x=1 "$@" echo "$@" awk "$1" export done 2>/dev/null $(pwd)
+		cd 'quoted text' 2>/dev/null grep && $(pwd) /usr/bin echo done local /usr/bin |
+	${HOME} && awk && test | "$@" "$1" ${HOME} printf test && test -eu | printf
+| then 2>/dev/null printf echo
+sed then x=1 2>/dev/null "$@" echo | x=1 "$@"
+		grep echo grep then export --verbose
+		then sed local 2>/dev/null "$1" done $(pwd) local echo printf -eu
+		x=1 && grep then $(pwd) 2>/dev/null done "$@" -eu /usr/bin --verbose awk sed &&
+--verbose then sed x=1 | then -eu done grep 2>/dev/null /usr/bin grep test
+	then test echo | --verbose 2>/dev/null readonly $(pwd) done
+then then ${HOME} --verbose ${HOME} /usr/bin
+${HOME} $(pwd) && local echo
+	'quoted text' awk 2>/dev/null
+		echo && "$1" x=1 -eu ${HOME} sed awk x=1
+	$(pwd) done sed test local $(pwd) /usr/bin test awk
+$(pwd) ${HOME} then grep | awk export export ${HOME} test awk
+	test | 2>/dev/null -eu 2>/dev/null | | &&
+	local sed printf test test echo readonly readonly
+	done /usr/bin cd grep x=1 echo $(pwd) "$@" export x=1 && grep
+		&& grep local grep sed done readonly export then
+		export local $(pwd) "$@" 2>/dev/null ${HOME} local /usr/bin
+	done sed | && "$1" sed | then "$@" | ${HOME} sed readonly "$@" x=1 /usr/bin
+		sed 2>/dev/null cd && export test
+	"$@" $(pwd) then | /usr/bin | printf "$1" sed ${HOME} | $(pwd)
+		x=1 awk sed 2>/dev/null readonly -eu
+		test done 2>/dev/null local local 2>/dev/null 2>/dev/null done -eu
+readonly local local awk grep x=1 2>/dev/null --verbose x=1 done test printf
+	"$1" awk sed sed awk test cd "$@" -eu "$@"
+--verbose 2>/dev/null grep readonly sed "$@" 2>/dev/null printf /usr/bin export
+		"$@" 'quoted text' | --verbose && readonly cd ${HOME} printf
+		export printf grep local cd export test $(pwd) && done cd && && then then echo
+		-eu "$@" 2>/dev/null cd ${HOME} grep -eu |
+	/usr/bin 'quoted text' | then awk local test | "$@" | 2>/dev/null export
+&& /usr/bin export "$@" "$@" test 2>/dev/null "$1" ${HOME} | && cd 'quoted text'
+		${HOME} grep test export -eu ${HOME} x=1 ${HOME} | 'quoted text'
+		2>/dev/null --verbose 2>/dev/null local grep
+	/usr/bin test grep 2>/dev/null printf "$@" awk done /usr/bin
+	/usr/bin printf /usr/bin done "$1" printf --verbose sed |
+"$1" echo | test readonly | export "$@" sed awk done
+		sed printf ${HOME} "$1"
+	test printf export export local -eu awk $(pwd) printf 'quoted text'
+		local done && 2>/dev/null --verbose
+&& test "$@" --verbose
+	"$1" 2>/dev/null ${HOME} export awk $(pwd) sed awk 2>/dev/null "$1" printf 2>/dev/null
+	echo export readonly && export
+2>/dev/null $(pwd) test "$@" then test ${HOME} "$1"
+	done then $(pwd) echo printf cd x=1 awk x=1 test | done
+export cd readonly then x=1 -eu grep 'quoted text'
+	/usr/bin -eu printf done -eu 'quoted text'
+		$(pwd) -eu test echo then /usr/bin done 2>/dev/null echo
+		/usr/bin $(pwd) ${HOME} x=1 then sed $(pwd) grep --verbose test | 2>/dev/null local
+printf local sed cd local done local "$1" grep $(pwd)
+printf grep 'quoted text' && sed readonly
+/usr/bin "$@" readonly test -eu test "$1" then
+done 'quoted text' grep -eu | readonly
+		echo test done local --verbose /usr/bin "$@" 2>/dev/null 2>/dev/null done "$1"
+grep readonly export 2>/dev/null
+	readonly $(pwd) local --verbose sed && | readonly
+&& $(pwd) x=1 grep "$1"
+	test 2>/dev/null $(pwd) sed --verbose readonly
+	export test | then 'quoted text' sed printf "$@" test printf ${HOME} /usr/bin
+x=1 $(pwd) $(pwd) /usr/bin awk grep 2>/dev/null awk && printf $(pwd) sed
+		awk 'quoted text' echo readonly sed ${HOME} x=1 x=1 readonly done echo done
+	-eu test printf readonly /usr/bin -eu 2>/dev/null done grep "$@" 2>/dev/null --verbose
+	'quoted text' echo --verbose sed done echo ${HOME}
+		&& 2>/dev/null | x=1 'quoted text' "$@" awk test readonly cd echo
+	echo export "$1" sed test 'quoted text' echo "$1" x=1 export done && printf
+-eu -eu x=1 readonly sed echo | $(pwd) printf "$@" /usr/bin then
+'quoted text' x=1 2>/dev/null ${HOME} echo
+-eu x=1 echo 'quoted text' local -eu echo x=1 sed -eu awk done local done
+	sed awk 2>/dev/null then 'quoted text'
+		printf cd /usr/bin test --verbose && | readonly ${HOME} export
+printf "$1" ${HOME} && grep --verbose printf test sed
+done --verbose export ${HOME} "$1" $(pwd) then | readonly --verbose readonly
+"$@" readonly x=1 awk --verbose cd echo 'quoted text'
+		cd then "$@" && then 2>/dev/null --verbose $(pwd)
+	"$@" local done echo readonly done then $(pwd) /usr/bin sed
+		${HOME} awk $(pwd) $(pwd) done "$1" sed ${HOME} then done readonly
+--verbose echo /usr/bin /usr/bin readonly "$@" readonly printf sed |
+		2>/dev/null && "$1" export
+		--verbose readonly --verbose local test 'quoted text' test
+export echo --verbose done printf then grep readonly sed 'quoted text'
+	then $(pwd) cd test printf readonly "$@" echo ${HOME}
+		done ${HOME} awk ${HOME} cd grep readonly sed x=1 test local test printf
+		-eu awk --verbose grep grep 'quoted text' -eu test ${HOME}
+	sed | 'quoted text' --verbose /usr/bin && export local -eu test "$@" export
+		awk then sed && | && grep $(pwd) 'quoted text'
+awk done x=1 awk -eu printf awk
+	echo done "$@" cd --verbose
+readonly readonly $(pwd)
+	"$1" -eu test sed local 'quoted text' 2>/dev/null
+	awk ${HOME} ${HOME} x=1 export "$1" && x=1 && 2>/dev/null ${HOME} grep done -eu
+printf sed cd echo awk && cd then grep done printf && -eu test -eu x=1 local
+		cd test && 'quoted text' ${HOME} "$@" --verbose $(pwd) echo local
+$(pwd) grep export echo 2>/dev/null "$@" x=1 --verbose
+	cd "$1" 'quoted text' printf then test grep $(pwd) ${HOME}
+		| grep 'quoted text' ${HOME} | sed $(pwd) && --verbose awk local sed |
+	echo "$1" "$1" test grep awk /usr/bin --verbose ${HOME}
+	&& --verbose && 2>/dev/null $(pwd) sed
+cd local ${HOME} printf -eu && | x=1 "$@" /usr/bin
+	readonly --verbose 2>/dev/null
+		$(pwd) export $(pwd) && &&
+		then --verbose printf readonly 'quoted text'
+		grep cd "$1" 'quoted text' /usr/bin local 2>/dev/null printf --verbose sed awk
+		-eu 2>/dev/null readonly export
+"$1" | 'quoted text' "$@" --verbose
+awk sed test ${HOME} grep grep "$@" local
+	awk echo $(pwd) test "$@" $(pwd) then 2>/dev/null then cd
+		-eu local /usr/bin | cd --verbose | -eu $(pwd) --verbose /usr/bin grep
+	2>/dev/null echo grep sed export --verbose "$1" local -eu test 2>/dev/null
+readonly test 'quoted text' "$1" sed /usr/bin local cd
+		'quoted text' $(pwd) --verbose /usr/bin
+	awk readonly ${HOME} /usr/bin -eu 'quoted text'
+	"$@" && -eu export /usr/bin x=1 x=1 printf
+test then printf test 'quoted text'
+grep x=1 printf "$1" "$1" test test grep ${HOME}
+		printf $(pwd) readonly "$1" then 'quoted text'
+	2>/dev/null $(pwd) &&
+		grep then local 2>/dev/null 2>/dev/null $(pwd)
+--verbose sed -eu --verbose readonly
+"$@" export test ${HOME} --verbose
+	"$1" -eu awk readonly
+readonly | 'quoted text' test awk cd done 2>/dev/null -eu done echo echo
+export && /usr/bin test /usr/bin /usr/bin
+	echo echo done export printf
+&& "$@" local done -eu printf /usr/bin readonly && local && echo then
+test grep 2>/dev/null "$@" 2>/dev/null
+-eu | cd -eu cd echo --verbose export --verbose
+	/usr/bin test sed ${HOME} x=1 cd $(pwd) sed
+	| 'quoted text' printf /usr/bin -eu grep cd 'quoted text' "$@" readonly
+	x=1 sed "$1" --verbose export
+		echo grep grep sed --verbose 'quoted text'
+	&& printf awk then ${HOME} cd "$@" readonly printf local
+cd then $(pwd) test echo && "$1" sed "$1" awk echo
+		"$@" readonly x=1 ${HOME} "$1" test export ${HOME} export "$1"
+cd then --verbose sed awk grep --verbose readonly -eu
+	x=1 export printf --verbose 'quoted text' export 2>/dev/null
+		--verbose sed printf && /usr/bin test "$@" "$@" "$@" "$@" readonly test
+		export 'quoted text' x=1 printf grep
+	done printf awk echo done grep 2>/dev/null
+/usr/bin /usr/bin then | awk 'quoted text'
+		printf | export /usr/bin echo 'quoted text' "$1" &&
+echo awk readonly done "$@" done echo echo test /usr/bin
+sed sed local "$1" done -eu --verbose | printf printf "$@" "$@" 2>/dev/null
+		${HOME} printf done done x=1 export sed export then
+	export printf x=1 local then "$@" awk cd $(pwd) 2>/dev/null
+	readonly 'quoted text' x=1 printf grep grep
+		--verbose "$@" export /usr/bin ${HOME} /usr/bin grep x=1
+		&& local done -eu "$@" "$1" awk 2>/dev/null readonly then local export
+	then readonly then sed "$@" printf done -eu | "$@" export
+cd "$@" 2>/dev/null x=1 done x=1 test --verbose x=1 $(pwd) -eu sed 'quoted text'
+done x=1 | --verbose 'quoted text' 'quoted text' then echo x=1 ${HOME}
+x=1 2>/dev/null "$@" ${HOME}
+local done done "$1" $(pwd) "$1" cd printf 'quoted text' test && echo export /usr/bin
+sed && && local "$@" echo then readonly readonly
+	$(pwd) awk --verbose 2>/dev/null
+"$1" --verbose 2>/dev/null local printf x=1 'quoted text' sed echo
+	${HOME} export awk readonly
+	'quoted text' 'quoted text' --verbose /usr/bin test then
+awk export export test local grep cd export $(pwd) $(pwd) sed "$1"
+		"$1" ${HOME} -eu x=1 test printf
+		$(pwd) && --verbose | /usr/bin done "$@" -eu done grep then export readonly
+		test printf -eu && x=1 done local echo "$@"
+grep echo printf printf grep done grep /usr/bin
+		'quoted text' --verbose cd test x=1 awk export ${HOME} readonly
+sed printf ${HOME} /usr/bin awk ${HOME}
+		x=1 test /usr/bin then sed
+	--verbose echo local 'quoted text' /usr/bin
+readonly awk --verbose export readonly | test
+	${HOME} cd /usr/bin $(pwd) grep local
+	x=1 done sed /usr/bin test -eu
+-eu local printf grep echo ${HOME} $(pwd) "$1"
+| | ${HOME} -eu grep --verbose printf sed "$1" x=1 $(pwd) /usr/bin
+sed then $(pwd) export 2>/dev/null done sed -eu
+		export local "$@" x=1 echo then "$@" sed
+#include c122.sh
+		${HOME} sed local /usr/bin --verbose
+/usr/bin local cd -eu /usr/bin /usr/bin
+		export test ${HOME} | && echo $(pwd) grep -eu cd test
+		echo readonly 2>/dev/null --verbose then $(pwd)
+	-eu then echo echo sed ${HOME} cd && --verbose
+export done -eu echo $(pwd) 2>/dev/null done printf 2>/dev/null test done grep
+	${HOME} readonly readonly
+		then grep $(pwd) test printf then echo then
+"$1" 'quoted text' --verbose test sed && then sed --verbose export "$@" test
+	${HOME} printf x=1 --verbose
+export sed 2>/dev/null ${HOME} 'quoted text' "$1" 'quoted text'
+		"$@" awk printf done $(pwd) && "$@" $(pwd) ${HOME} printf
+		echo local cd done then -eu awk -eu
+grep printf readonly 2>/dev/null x=1 sed ${HOME}
+	readonly $(pwd) -eu x=1 && "$1" printf printf done "$@"
+	x=1 | cd echo export readonly
+	cd ${HOME} 2>/dev/null 2>/dev/null -eu done -eu --verbose -eu then
+cd echo /usr/bin echo
+		local -eu done /usr/bin "$@" sed | echo /usr/bin | | $(pwd) "$@" echo then grep
+	&& 'quoted text' then 2>/dev/null -eu 'quoted text' sed --verbose cd | --verbose
+	$(pwd) cd test ${HOME} awk x=1 /usr/bin
+	-eu --verbose -eu test 2>/dev/null sed 2>/dev/null x=1 printf 2>/dev/null
+"$@" test 2>/dev/null 'quoted text'
+	test then readonly done /usr/bin $(pwd)
+		--verbose readonly local
+		echo ${HOME} done /usr/bin awk x=1 "$1"
+readonly "$@" awk echo export | echo
+then "$@" printf 2>/dev/null
+echo test printf "$1" sed x=1 "$1" echo && /usr/bin
+	| $(pwd) "$@" sed 'quoted text'
+"$1" then local then x=1 $(pwd) then /usr/bin --verbose 2>/dev/null done echo
+	export cd 2>/dev/null x=1 test test sed export 2>/dev/null ${HOME} && cd
+		2>/dev/null awk x=1 $(pwd) && test echo done && x=1 --verbose "$@" "$@" done
+	2>/dev/null readonly printf 2>/dev/null && "$@" --verbose
+"$@" printf -eu 2>/dev/null readonly | awk grep
+printf test /usr/bin test local
+	cd ${HOME} 'quoted text' --verbose
+&& "$1" printf x=1 awk awk "$@" sed
+		done then "$@" --verbose done | echo $(pwd) done sed sed test echo 'quoted text'
+		cd test $(pwd) cd readonly cd done awk echo test sed
+		x=1 readonly /usr/bin grep "$1" cd 2>/dev/null then
+	export echo local "$1"
+grep -eu | 'quoted text' "$1" x=1 echo done printf "$@" "$1" sed export readonly
+	&& | && sed x=1 export cd grep /usr/bin printf /usr/bin printf
+${HOME} 2>/dev/null readonly
+		| printf test 2>/dev/null sed --verbose grep ${HOME} -eu
+	then | 2>/dev/null && x=1 printf
+grep 'quoted text' /usr/bin 'quoted text' $(pwd) sed export awk /usr/bin
+export test printf | -eu x=1 --verbose
+	test ${HOME} printf 2>/dev/null sed "$@" echo /usr/bin local awk 2>/dev/null
+then $(pwd) then cd local "$@" --verbose "$1" && --verbose
+		echo readonly --verbose printf x=1 done cd local echo grep "$1"
+	sed local && done --verbose sed |
+sed test 2>/dev/null "$@" 2>/dev/null /usr/bin
+readonly test -eu echo /usr/bin sed /usr/bin 'quoted text' ${HOME} sed "$@"
+		"$1" 'quoted text' export readonly cd sed grep /usr/bin
+	cd "$1" /usr/bin && 'quoted text' --verbose
+		then local "$1" grep 2>/dev/null grep 'quoted text'
+		${HOME} ${HOME} 2>/dev/null
+		test -eu x=1 /usr/bin cd $(pwd) echo -eu --verbose
+		"$1" cd ${HOME} x=1 awk /usr/bin cd done /usr/bin
+--verbose echo done -eu --verbose done --verbose awk printf 'quoted text'
+	grep 'quoted text' | grep export sed --verbose
+	&& then sed readonly
+	$(pwd) && readonly then then awk --verbose grep "$1" /usr/bin "$1" export
+	${HOME} done ${HOME} --verbose
+	local 'quoted text' ${HOME} cd 2>/dev/null local --verbose local readonly
+'quoted text' | ${HOME} ${HOME} $(pwd) 'quoted text' cd awk
+	"$1" test cd awk local printf local export
+		export $(pwd) echo /usr/bin x=1
+	sed sed echo | local cd cd 2>/dev/null cd
+"$@" $(pwd) cd -eu test printf printf readonly sed export "$1" $(pwd) /usr/bin local
+| && && ${HOME} ${HOME} readonly "$1" $(pwd) local x=1 2>/dev/null echo
+	grep /usr/bin | sed --verbose --verbose 2>/dev/null done sed export
+x=1 readonly "$@" x=1 /usr/bin local grep | ${HOME} cd $(pwd)
+	&& $(pwd) ${HOME} readonly --verbose export readonly export
+		2>/dev/null && cd awk && cd local --verbose
+$(pwd) | 2>/dev/null test then readonly grep
+		/usr/bin export readonly
+done sed $(pwd) x=1 --verbose awk --verbose
+	grep local && | local cd ${HOME} /usr/bin | local
+	then "$1" -eu && sed $(pwd) done x=1 /usr/bin "$1" export -eu "$1" then
+${HOME} test echo test -eu then
+sed && export x=1 /usr/bin
+		$(pwd) sed grep grep x=1 x=1 local
+	local awk done --verbose
+-eu -eu test sed done "$1" local export printf
+		done grep readonly export printf cd then then 'quoted text'
+		/usr/bin && cd x=1 && export sed 2>/dev/null sed
+/usr/bin /usr/bin 2>/dev/null test 'quoted text' grep echo grep "$@" done
+	| export x=1 x=1 awk awk && cd ${HOME} local local "$@" 2>/dev/null
+'quoted text' && x=1 grep $(pwd)
+-eu $(pwd) /usr/bin x=1 --verbose "$@" "$1" | done x=1 | /usr/bin awk "$1"
+printf -eu x=1 'quoted text'
+x=1 x=1 ${HOME} test x=1 x=1 "$1" "$1" sed 'quoted text' export | 'quoted text'
+	awk grep ${HOME} 2>/dev/null
+	x=1 --verbose cd --verbose 2>/dev/null -eu "$1" $(pwd) done $(pwd)
+x=1 'quoted text' readonly ${HOME} 2>/dev/null --verbose
+'quoted text' then -eu
+		"$1" 2>/dev/null done echo
+done test ${HOME} grep awk "$1" echo x=1 readonly local -eu test sed
+	cd 'quoted text' | $(pwd) awk 'quoted text' "$@" ${HOME} "$@" test
+	x=1 && grep echo 2>/dev/null 2>/dev/null 'quoted text'
+	-eu 2>/dev/null cd grep sed export
+		-eu --verbose $(pwd) 'quoted text' x=1 /usr/bin grep local "$@" done grep
+	then done echo awk test 'quoted text' "$1" $(pwd) ${HOME} --verbose
+&& then cd sed x=1 /usr/bin /usr/bin
+		export grep ${HOME} | 2>/dev/null | && grep ${HOME}
+	awk ${HOME} /usr/bin | printf ${HOME} /usr/bin echo test export cd 'quoted text'
+	-eu --verbose -eu && ${HOME} 'quoted text' readonly && 2>/dev/null "$1"
+"$1" x=1 awk then "$@" local printf grep && | -eu -eu "$@"
+sed -eu | cd 'quoted text' | readonly
+&& /usr/bin test export "$@"
+		sed x=1 x=1 readonly && test awk
+	sed x=1 test readonly grep
+readonly && awk "$@" && then $(pwd) $(pwd) cd "$1" x=1 sed
+	$(pwd) then done test sed cd export x=1 $(pwd) readonly --verbose
+	"$1" echo ${HOME} printf | export sed /usr/bin
+		'quoted text' x=1 "$@" && $(pwd) "$1" "$1"
+	export awk cd test | /usr/bin printf /usr/bin
+		test export test printf cd ${HOME} --verbose then 'quoted text'
+/usr/bin "$@" local echo readonly x=1 sed && -eu echo
+	&& "$1" --verbose readonly ${HOME} 'quoted text' $(pwd) 'quoted text'
+	${HOME} then echo cd export | ${HOME} $(pwd) 'quoted text' grep /usr/bin printf
+	"$@" sed -eu printf "$1" cd printf 'quoted text' test then 'quoted text' 2>/dev/null
+x=1 export grep 2>/dev/null grep 'quoted text' |
+		x=1 done echo 'quoted text' readonly --verbose cd grep /usr/bin
+	done export then done local awk "$1"
+	sed | readonly grep && then then
+2>/dev/null local done "$@" --verbose
+	cd && done local $(pwd) awk 'quoted text'
+		local local "$@" readonly
+	then --verbose done done x=1 /usr/bin grep local local
+awk export echo then test 'quoted text' && printf
+	--verbose -eu ${HOME} then sed && --verbose test x=1 ${HOME} x=1
+	done cd -eu && then local awk
+"$1" awk x=1 "$@" 2>/dev/null /usr/bin done test then ${HOME} 'quoted text'
+$(pwd) then grep local cd done awk | "$1" 'quoted text' awk $(pwd) | printf then
+		| /usr/bin $(pwd) $(pwd) then --verbose /usr/bin export "$1" | $(pwd)
+		/usr/bin echo grep /usr/bin echo echo then test 2>/dev/null
+-eu ${HOME} done --verbose x=1 x=1 echo
+	"$1" 'quoted text' 'quoted text' cd /usr/bin x=1 done export printf
+	${HOME} printf then | 2>/dev/null
+	test -eu x=1 cd readonly local $(pwd) readonly local ${HOME} "$1" sed
+	grep -eu readonly 'quoted text' awk 'quoted text' | done printf
+		cd --verbose "$1" && printf then ${HOME} --verbose
+		'quoted text' test echo $(pwd) then
+	sed cd sed "$@" then $(pwd) then -eu local awk | ${HOME} awk done
+		cd -eu sed --verbose "$@" done local /usr/bin
+	cd then done export ${HOME} cd "$1" cd sed printf
+		x=1 x=1 awk readonly "$1" | ${HOME} readonly done echo $(pwd) -eu export
+echo readonly then -eu /usr/bin grep done grep local grep test
+then test export done 2>/dev/null sed x=1 'quoted text'
+	sed readonly test export x=1 export ${HOME} then then done x=1 "$@" $(pwd)
+	cd grep done printf 'quoted text' awk | "$1" "$@" --verbose
+	sed 'quoted text' then | grep /usr/bin then grep sed 'quoted text' done
+sed test echo sed readonly 'quoted text'
+test printf test then x=1 export done local local --verbose export done
+"$@" "$1" 2>/dev/null printf then ${HOME} 'quoted text' 2>/dev/null 2>/dev/null
+		printf 'quoted text' && echo done sed local readonly $(pwd) grep readonly
+	awk "$1" sed && done then sed sed x=1 $(pwd) --verbose
+	$(pwd) 'quoted text' printf "$1" $(pwd) x=1 ${HOME} cd && cd
+	-eu 2>/dev/null awk ${HOME} cd --verbose then awk printf | awk done
+		printf awk export grep | | && x=1 --verbose sed cd "$@" "$1" "$1" awk ${HOME} "$@"
+-eu done sed local --verbose then
+		2>/dev/null cd "$@" printf | echo export && x=1 2>/dev/null printf
+| -eu $(pwd) | cd awk grep sed readonly test "$@" ${HOME} readonly local
+		'quoted text' local /usr/bin ${HOME} local export x=1 test awk cd echo
+	test awk export | $(pwd) sed
+		"$@" sed "$1" grep test -eu 'quoted text'
+		-eu --verbose done ${HOME} sed test readonly "$@" ${HOME} readonly $(pwd)
+	grep $(pwd) $(pwd) printf 2>/dev/null awk printf ${HOME} printf
+		| --verbose sed done readonly echo echo export -eu grep grep
+${HOME} 'quoted text' && cd echo "$@"
+	cd && $(pwd) export test "$@" /usr/bin "$1" 'quoted text' test grep "$1" readonly
+	local ${HOME} echo $(pwd) 'quoted text' printf && grep 2>/dev/null then export readonly
+		"$@" --verbose export readonly local readonly
+echo grep cd | && x=1 readonly
+		done export /usr/bin /usr/bin -eu
+	grep readonly 2>/dev/null done then
+		done $(pwd) cd printf test x=1 'quoted text'
+local echo test "$1" 'quoted text' export $(pwd)
+		test ${HOME} ${HOME} local printf awk then done
+		2>/dev/null 'quoted text' 2>/dev/null && then $(pwd) | printf /usr/bin
+done | 'quoted text' sed local --verbose 2>/dev/null 2>/dev/null grep "$@"
+"$@" export echo /usr/bin x=1 local
+-eu printf export x=1 awk echo readonly
+	'quoted text' $(pwd) sed 2>/dev/null "$@" | local test done -eu "$@" done
+	sed --verbose test $(pwd) | sed readonly echo
+$(pwd) /usr/bin printf --verbose x=1 /usr/bin local && /usr/bin echo 2>/dev/null
+	/usr/bin --verbose "$1" x=1 -eu echo
+&& | $(pwd) local $(pwd) readonly echo
+		${HOME} then -eu x=1 $(pwd) --verbose echo | readonly --verbose
+		local "$@" export /usr/bin "$1" sed test "$1" printf echo
+	grep grep && test 'quoted text'
+		printf "$1" 2>/dev/null grep
+	'quoted text' ${HOME} $(pwd) echo "$@" export 2>/dev/null
+	$(pwd) readonly sed echo 2>/dev/null --verbose export /usr/bin
+cd sed grep -eu $(pwd) printf test x=1 x=1 readonly /usr/bin --verbose
+		"$1" sed then /usr/bin 'quoted text'
+"$1" readonly --verbose readonly --verbose cd "$@" "$@" then 'quoted text'
+		export $(pwd) readonly grep sed --verbose | local
+		echo awk --verbose && test | "$@" x=1
+&& done done export | && 'quoted text'
+export 'quoted text' grep "$@" test
+		then 2>/dev/null "$@" local
+2>/dev/null && /usr/bin echo "$1" "$@" | printf && sed printf "$@"
+	2>/dev/null test "$1" ${HOME} /usr/bin -eu "$1"
+readonly "$@" then /usr/bin then sed
+	$(pwd) cd "$@" $(pwd) 'quoted text' "$@" |
+	export "$@" "$1" "$@" "$@" done local local $(pwd) 2>/dev/null
+		export echo --verbose 'quoted text' grep -eu ${HOME} awk --verbose grep readonly
+	local 'quoted text' done awk echo readonly echo
+-eu awk readonly 2>/dev/null local printf ${HOME}
+		sed test 2>/dev/null readonly
+	cd 'quoted text' sed local done
+	--verbose then -eu done -eu 2>/dev/null
+		echo test 'quoted text' grep grep -eu -eu --verbose readonly
+	--verbose printf -eu then
+printf 'quoted text' echo 'quoted text'
+		"$1" export $(pwd) 2>/dev/null -eu grep cd test "$1" readonly
+'quoted text' export $(pwd) /usr/bin "$@" cd local export local $(pwd) readonly
+	done cd readonly local
+x=1 readonly x=1 x=1 test cd | --verbose | export sed x=1 sed grep grep done
+		test then done local cd "$1" ${HOME} grep 'quoted text' export printf
+		&& $(pwd) | sed export echo awk | 2>/dev/null ${HOME} test "$@" readonly "$1" &&
+test $(pwd) $(pwd) export done then echo echo 2>/dev/null local then test
+"$1" -eu cd readonly "$@" "$@" 'quoted text'
+-eu readonly grep readonly test done cd then printf local echo --verbose --verbose
+	/usr/bin 2>/dev/null echo "$@" echo && echo test x=1 sed sed 2>/dev/null
+	2>/dev/null local awk echo cd grep done printf |
+printf sed test echo export && /usr/bin $(pwd)
+	awk "$@" cd 'quoted text' printf awk | -eu
+	$(pwd) echo -eu -eu --verbose
+cd "$@" local done readonly awk
+	-eu printf export | /usr/bin export -eu cd --verbose &&
+awk export "$1" -eu --verbose cd /usr/bin sed && -eu && export $(pwd) cd then
+		2>/dev/null | ${HOME} x=1 printf $(pwd)
+		grep done | /usr/bin /usr/bin readonly printf &&
+		"$@" && test -eu -eu echo
+echo export | cd && local
+2>/dev/null && 2>/dev/null
+		-eu test export -eu /usr/bin export echo done
+then | cd | export local grep
+readonly echo "$1" ${HOME} readonly cd grep awk | awk done ${HOME} -eu
+		"$@" 2>/dev/null readonly
+	$(pwd) --verbose grep "$@" "$@" | 2>/dev/null sed export printf
+		| awk /usr/bin echo "$@" --verbose sed x=1 'quoted text' readonly awk "$@"
+		echo then grep -eu "$1" cd x=1 $(pwd) local export && cd 2>/dev/null
+		cd printf | --verbose $(pwd) x=1 x=1 | then
+		/usr/bin --verbose --verbose grep
+		done grep readonly --verbose sed awk readonly
+		"$@" && 2>/dev/null 2>/dev/null sed
+	/usr/bin echo echo ${HOME} "$@" export
+		2>/dev/null "$@" cd sed export echo &&
+		| done ${HOME} then "$1" /usr/bin local -eu "$@" cd
+	export --verbose --verbose -eu x=1 ${HOME} export test echo local sed 2>/dev/null
+x=1 export export && -eu cd readonly x=1 grep --verbose
+		"$1" echo printf local && echo export readonly 2>/dev/null
+	printf $(pwd) "$1" x=1 test cd "$1" 'quoted text' 'quoted text'
+		echo awk readonly readonly cd then && | "$1" sed printf "$@" grep echo
+test x=1 --verbose | --verbose test $(pwd) 'quoted text' echo then printf
+grep grep --verbose 'quoted text' grep done $(pwd) echo sed --verbose grep
+		grep export x=1 cd local | cd local
+	x=1 done --verbose then /usr/bin
+readonly "$@" awk 'quoted text'
+		2>/dev/null test 'quoted text'
+		2>/dev/null printf awk awk "$1" --verbose
+	--verbose grep | && -eu | test test /usr/bin export
+x=1 sed | "$1" x=1 | echo grep
+awk x=1 done "$1" -eu "$@" awk /usr/bin echo && then /usr/bin sed grep /usr/bin
+x=1 $(pwd) ${HOME} $(pwd)
+	awk "$@" export -eu -eu "$1" done
+| "$1" then then readonly --verbose
+	export --verbose /usr/bin && export $(pwd) && "$1" done cd 2>/dev/null
+		sed done && local done x=1 cd test && 2>/dev/null && /usr/bin test $(pwd) awk
+"$1" 2>/dev/null 'quoted text' | then test awk | done x=1 "$1"
+		test ${HOME} --verbose | $(pwd)
+		x=1 echo cd local -eu sed printf | --verbose then grep awk "$1" ${HOME}
+		then echo awk -eu echo --verbose done
+	printf done x=1 done ${HOME} $(pwd) cd --verbose echo ${HOME} export --verbose
+	readonly $(pwd) "$1" test 'quoted text'
+	| --verbose test -eu "$1" then /usr/bin sed ${HOME} && cd echo "$1"
+sed "$1" local | x=1 test
+	"$@" "$@" x=1 /usr/bin $(pwd) readonly grep /usr/bin cd ${HOME} export cd && cd
+	2>/dev/null 2>/dev/null 2>/dev/null
+--verbose "$1" | grep awk ${HOME} && cd readonly test awk awk && local
+		then 2>/dev/null export $(pwd)
+	$(pwd) done sed "$@" export echo $(pwd) sed -eu readonly
+	echo then then sed echo done ${HOME} "$@" awk cd &&
+		| "$1" then "$@" done readonly cd export | --verbose x=1 x=1 grep local /usr/bin
+		&& printf -eu sed /usr/bin /usr/bin done /usr/bin
+		done sed awk echo sed printf && cd ${HOME} sed | then "$@" export
+		-eu -eu test then ${HOME} sed sed echo x=1 2>/dev/null /usr/bin "$@" readonly
+	"$@" -eu readonly | -eu awk ${HOME} 2>/dev/null grep cd local -eu echo "$@" /usr/bin
+x=1 export 'quoted text' export
+--verbose echo 'quoted text' | test local "$1" $(pwd) 'quoted text' && --verbose
+"$@" 2>/dev/null grep test 2>/dev/null awk local cd sed done && 2>/dev/null
+	grep printf local awk 2>/dev/null export x=1 grep 'quoted text'
+--verbose $(pwd) cd cd test test
+	export awk && echo -eu sed 'quoted text' test "$1" done 'quoted text'
+readonly readonly local grep | $(pwd) /usr/bin
+done cd awk cd printf x=1 awk local awk readonly readonly cd local
+		/usr/bin grep cd done "$@" 2>/dev/null ${HOME}
+| cd "$@" 2>/dev/null cd
+x=1 test x=1 echo then local ${HOME} grep 2>/dev/null readonly
+		| --verbose readonly done --verbose && grep awk 2>/dev/null | 2>/dev/null "$@"
+	/usr/bin 'quoted text' --verbose done then | -eu x=1 cd awk "$1" grep "$1" "$1"
+		x=1 "$@" grep local 2>/dev/null | echo && | 2>/dev/null
+'quoted text' "$@" printf
+test cd sed readonly export
+	readonly local ${HOME} local grep
+		grep x=1 "$@" "$1" cd "$1" "$1" echo /usr/bin sed
+	grep then x=1 "$@" then x=1 /usr/bin -eu -eu cd --verbose
+	"$1" test -eu "$@" $(pwd) $(pwd) local 'quoted text'
+	readonly --verbose x=1 ${HOME} "$@" $(pwd) $(pwd)
+		$(pwd) cd printf ${HOME} "$1" $(pwd) printf $(pwd)
+		awk readonly 2>/dev/null readonly
+-eu sed sed 2>/dev/null readonly then grep export grep test readonly
+x=1 $(pwd) echo local grep 2>/dev/null 2>/dev/null &&
+"$1" 2>/dev/null export -eu echo sed sed $(pwd) done export local 2>/dev/null
+	readonly awk done /usr/bin --verbose $(pwd) grep 2>/dev/null $(pwd) cd export
+then ${HOME} ${HOME} --verbose
+	--verbose local x=1 'quoted text' done done 2>/dev/null echo /usr/bin $(pwd)
+	grep sed --verbose /usr/bin cd ${HOME} "$1" then --verbose awk && x=1 2>/dev/null
+done export && x=1 --verbose -eu test ${HOME} $(pwd)
+	readonly export "$1" test printf 2>/dev/null -eu then sed $(pwd) &&
+cd awk "$1" /usr/bin done /usr/bin 'quoted text'
+'quoted text' grep "$1" done | | printf 2>/dev/null "$@" /usr/bin
+	"$1" $(pwd) x=1 awk sed done readonly export
+	$(pwd) cd readonly cd --verbose
+		cd "$@" /usr/bin $(pwd) x=1 awk export printf $(pwd) 'quoted text'
+	awk export -eu | "$1" printf done "$1" printf
+		test /usr/bin x=1 done readonly cd awk local x=1 awk "$1" readonly --verbose
+		done printf -eu && | grep 2>/dev/null
+		export printf sed local export readonly local "$1"
+		printf "$@" x=1 && && readonly -eu then --verbose $(pwd)
+	/usr/bin then "$@" $(pwd) awk 2>/dev/null
+		"$1" echo ${HOME} readonly --verbose sed
+		"$@" /usr/bin --verbose export test 2>/dev/null sed test cd
+printf done -eu done -eu x=1
+		-eu "$1" --verbose x=1 && x=1 test cd /usr/bin 'quoted text'
+		then "$@" "$@" /usr/bin 'quoted text'
+		printf then -eu printf grep readonly grep x=1 readonly done echo
+		sed -eu local echo x=1 then done $(pwd) 'quoted text' grep awk --verbose
+		x=1 'quoted text' sed x=1 grep test sed readonly
+	sed -eu test cd "$@" && cd
+		| && awk test -eu done 2>/dev/null && /usr/bin ${HOME} then x=1 readonly grep $(pwd)
+	cd "$1" -eu readonly done -eu printf grep then local && cd local
+	"$@" 'quoted text' readonly local done --verbose 'quoted text' x=1
+	echo 'quoted text' /usr/bin 2>/dev/null readonly && -eu readonly
+export "$1" sed readonly awk | && "$@" && 2>/dev/null grep
+readonly cd x=1 --verbose | awk cd printf test readonly awk | cd sed export cd
+	awk ${HOME} | then local $(pwd) $(pwd) ${HOME} "$@"
+		'quoted text' 2>/dev/null
+	"$@" local --verbose "$1" && "$@"
+test readonly --verbose "$@" 'quoted text' done 'quoted text' "$1" sed printf
+	echo sed $(pwd) "$@" awk | done done
+readonly done --verbose local local awk grep --verbose
+--verbose -eu readonly grep then then --verbose && "$1" 2>/dev/null grep /usr/bin
+${HOME} -eu readonly --verbose echo readonly echo export local 2>/dev/null |
+		local sed then done | cd $(pwd)
+$(pwd) then test 'quoted text' x=1 cd export echo readonly
+	echo then --verbose then 2>/dev/null
+then x=1 done echo ${HOME} readonly local
+	cd | ${HOME} ${HOME}
+	| local 'quoted text' cd x=1 sed local
+${HOME} 'quoted text' | ${HOME} done then x=1 | "$1" test 2>/dev/null && x=1
+2>/dev/null done test
+/usr/bin "$1" /usr/bin --verbose grep
+printf done | "$@" /usr/bin done 2>/dev/null 'quoted text' "$1" /usr/bin
+${HOME} echo printf "$@" --verbose x=1 awk $(pwd)
+&& -eu ${HOME} echo | 'quoted text'
+		cd cd local grep | cd 'quoted text' 2>/dev/null | 'quoted text' $(pwd)
+		printf readonly && $(pwd) done x=1 sed awk test cd local 'quoted text' "$1"
+	&& echo x=1 "$1" local "$1" sed $(pwd) awk awk |
+		2>/dev/null /usr/bin local && ${HOME} local /usr/bin grep -eu "$@" readonly then
+	done "$1" ${HOME} local readonly cd test x=1 export
+	readonly printf "$@" /usr/bin "$1" "$1" sed | cd
+		2>/dev/null | local sed printf then local x=1 $(pwd)
+awk "$1" ${HOME} 'quoted text' echo 2>/dev/null
+		readonly && done grep test "$1" /usr/bin "$1" "$1" readonly done awk --verbose
+	${HOME} "$@" 2>/dev/null printf awk printf && 'quoted text' export x=1 $(pwd)
+	echo printf --verbose cd done printf cd && sed cd cd local done 'quoted text'
+		sed /usr/bin test sed ${HOME} cd | 'quoted text' && $(pwd)
+sed "$1" grep 'quoted text' 2>/dev/null
+"$@" x=1 x=1 sed done && export /usr/bin 'quoted text' export readonly
+	/usr/bin $(pwd) ${HOME} "$1" | echo |
+	local printf then printf test then printf grep printf local -eu echo test 2>/dev/null
+		sed printf 'quoted text'
+sed -eu "$@" && | done --verbose
+		'quoted text' "$@" $(pwd) done ${HOME}
+		printf local export awk then export | && done "$1" "$1"
+	sed --verbose cd $(pwd) awk 2>/dev/null readonly --verbose printf
+	${HOME} && && /usr/bin grep echo test 2>/dev/null grep export
+"$1" --verbose 2>/dev/null ${HOME} sed readonly
+		"$@" | sed grep 'quoted text' readonly readonly awk done grep "$@"
+| | "$1" 'quoted text' then then then then local "$@"
+	local /usr/bin then "$@" awk test
+$(pwd) awk "$@" printf sed $(pwd)
+		"$@" && | "$1" readonly then
+		x=1 done sed "$@" 2>/dev/null printf ${HOME} --verbose test 2>/dev/null awk
+awk sed export grep done "$1" test 'quoted text' && local "$@"
+export --verbose && "$@" /usr/bin x=1 | && awk test && printf 'quoted text' && 'quoted text'
+		awk && awk echo readonly readonly echo done echo ${HOME} "$1" x=1
+	"$@" grep readonly printf then $(pwd) 'quoted text'
+		then done echo /usr/bin /usr/bin echo sed done x=1
+	${HOME} grep then ${HOME} "$@"
+${HOME} --verbose 'quoted text' 2>/dev/null awk
+		export sed sed cd test sed printf $(pwd) "$@"
+	readonly readonly "$@" | 2>/dev/null
+		echo "$1" x=1 $(pwd) grep 2>/dev/null export test 2>/dev/null --verbose
+--verbose $(pwd) printf x=1 export local x=1 grep /usr/bin --verbose -eu sed awk
+then "$1" echo printf && test 2>/dev/null && 2>/dev/null
+		cd x=1 grep echo echo | ${HOME} printf
+x=1 /usr/bin cd ${HOME} awk "$@" awk awk sed sed ${HOME} x=1 printf && sed
+		sed $(pwd) 'quoted text' local awk 'quoted text' sed awk
+	sed readonly --verbose && "$1" export printf
+	2>/dev/null "$1" then sed ${HOME} sed echo awk local $(pwd)
+$(pwd) export 'quoted text' 'quoted text' 2>/dev/null && echo awk sed local echo
+		printf readonly then "$1" then | $(pwd) readonly local
+	then $(pwd) $(pwd) done "$1" grep then
+/usr/bin test test && $(pwd) readonly "$@" 'quoted text' /usr/bin $(pwd)
+-eu awk grep "$@" export "$1" | printf $(pwd)
+export echo $(pwd) test 2>/dev/null echo
+	/usr/bin export printf echo x=1 x=1 "$@" printf cd &&
+	grep x=1 $(pwd) | /usr/bin awk
+		cd export -eu "$@" done echo
+	export 2>/dev/null sed 'quoted text'
+${HOME} && && /usr/bin x=1 ${HOME} /usr/bin | x=1 local export -eu &&
+		sed "$@" grep cd printf
+		/usr/bin "$1" x=1 /usr/bin "$1" local test 'quoted text' | 'quoted text'
+	x=1 "$@" /usr/bin 'quoted text' $(pwd) readonly "$1" export local done /usr/bin
+	test export cd /usr/bin then | /usr/bin
+/usr/bin test ${HOME} readonly export
+grep done 2>/dev/null $(pwd) && "$1" grep $(pwd) local local sed
+then printf 'quoted text' | export grep
+	grep | -eu x=1 && $(pwd) echo -eu | printf awk local /usr/bin "$1" readonly
+	readonly readonly x=1 "$@" export
+		echo 'quoted text' test local 'quoted text' "$@"
+--verbose --verbose cd "$@"
+		-eu "$1" "$1" $(pwd) done awk "$@" then sed grep -eu && 'quoted text'
+	then printf sed ${HOME} 2>/dev/null --verbose "$@" cd then /usr/bin awk grep
+		"$1" grep test then 2>/dev/null |
+local cd ${HOME} test cd "$1" sed
+		"$1" sed 2>/dev/null cd "$@" cd sed -eu grep /usr/bin
+"$@" cd 'quoted text' cd echo $(pwd) "$1" -eu export
+${HOME} done $(pwd) then test readonly echo
+	&& /usr/bin readonly test then export
+		-eu -eu /usr/bin x=1 "$1" done | export --verbose ${HOME} $(pwd)
+	/usr/bin readonly export 2>/dev/null $(pwd) cd local
+		${HOME} | ${HOME} then done /usr/bin sed readonly --verbose "$1" cd sed --verbose
+		"$@" 'quoted text' grep local $(pwd) readonly ${HOME}
+	readonly then ${HOME} done awk readonly $(pwd) export then "$@" -eu echo x=1 --verbose
+-eu "$@" "$1" ${HOME} cd then && -eu done && $(pwd) awk | test
+		--verbose awk | done cd export then cd --verbose sed
+--verbose -eu | && 2>/dev/null | printf | printf
+		test 2>/dev/null x=1 done |
+		"$@" "$@" $(pwd) | local "$@" sed x=1 $(pwd) grep /usr/bin echo 'quoted text' readonly
+	sed 'quoted text' "$@" grep printf 2>/dev/null "$@"
+sed then "$@" export local --verbose x=1 && x=1 /usr/bin
+		local test ${HOME} && then --verbose
+done awk -eu x=1 echo ${HOME} -eu "$@" ${HOME}
+	local && --verbose ${HOME} "$@"
+	printf | "$@" && done | x=1 | ${HOME} export ${HOME} 'quoted text'
+then then then 'quoted text'
+	/usr/bin 2>/dev/null 'quoted text'
+		echo ${HOME} cd 2>/dev/null echo && test then grep cd then
+local $(pwd) -eu x=1 "$1" | "$1" cd --verbose | ${HOME} awk
+		test awk "$1" echo -eu 'quoted text' ${HOME} awk
+	echo echo local sed "$1" x=1
+&& test && /usr/bin ${HOME}
+| && "$1" 'quoted text' then 'quoted text'
+	-eu local echo done x=1 && -eu grep "$1" cd grep --verbose &&
+		sed printf then local test echo test "$@" done local
+		| test "$@" cd export && printf 2>/dev/null
+		${HOME} test -eu done /usr/bin then ${HOME}
+	test x=1 | sed "$1" "$@" --verbose --verbose | sed x=1 x=1
+	'quoted text' $(pwd) $(pwd)
+		'quoted text' export $(pwd) --verbose --verbose export x=1 /usr/bin "$@" sed ${HOME}
+		"$@" && then then "$1" test then
+		| printf --verbose /usr/bin grep 2>/dev/null /usr/bin done && && $(pwd)
+		test && 2>/dev/null sed -eu test /usr/bin
+	echo "$@" "$1" done /usr/bin echo cd sed printf x=1 cd echo done
+	test export cd test 2>/dev/null -eu x=1
+	done cd "$@" x=1 | then | test sed
+-eu local cd then "$1" 2>/dev/null 2>/dev/null then sed test $(pwd)
+grep done test sed "$@" x=1 /usr/bin && /usr/bin then local && local done done
+		awk && | "$1" cd x=1 ${HOME} local $(pwd) cd x=1 && 2>/dev/null sed -eu test sed
+awk echo awk 2>/dev/null test done
+	"$@" cd printf then echo x=1 -eu $(pwd) printf readonly | readonly --verbose
+&& export cd printf printf ${HOME} readonly then
+	done awk then echo test x=1 -eu test readonly test cd --verbose
+	printf "$1" export ${HOME} sed sed export echo "$@" ${HOME}
+		&& -eu $(pwd) awk grep printf awk /usr/bin && "$@" done grep ${HOME}
+		local grep grep | readonly
+&& ${HOME} 2>/dev/null | "$@" cd echo ${HOME} && 'quoted text' /usr/bin
+echo | test 2>/dev/null $(pwd)
+	x=1 awk --verbose $(pwd)
+printf echo 2>/dev/null -eu x=1 "$1" "$@" awk cd 'quoted text'
+		export grep cd "$@" | "$1" /usr/bin
+		cd readonly done x=1 $(pwd) $(pwd) "$1" sed "$@" cd test | /usr/bin
+2>/dev/null readonly done echo
+	x=1 && 2>/dev/null --verbose 'quoted text' /usr/bin test && --verbose
+		'quoted text' x=1 x=1 | && -eu "$1" x=1
+	printf 2>/dev/null awk then 2>/dev/null /usr/bin printf | grep
+		x=1 grep test readonly --verbose && sed && echo 2>/dev/null | test
+		sed then awk | done printf awk -eu ${HOME} "$1"
+	$(pwd) test echo && "$@" "$@" cd grep --verbose -eu sed awk
+'quoted text' 2>/dev/null "$@" "$1" test done sed readonly 2>/dev/null
+		local cd then /usr/bin then $(pwd)
+readonly echo 'quoted text' "$@" | readonly local x=1 export then
+${HOME} "$1" 2>/dev/null readonly | local "$1" cd | | grep echo export
+		readonly /usr/bin | awk sed export
+		"$1" echo cd done sed ${HOME} sed readonly x=1 printf
+	$(pwd) export awk && ${HOME} --verbose printf readonly $(pwd) done | "$@" 2>/dev/null
+"$1" 2>/dev/null && then "$1" 'quoted text' cd "$1" printf --verbose awk | 'quoted text'
+echo ${HOME} 'quoted text' sed | "$1"
+		readonly 'quoted text' "$@" --verbose $(pwd) local test
+test | "$@" | && -eu readonly
+&& export 'quoted text' | x=1 sed awk grep export 2>/dev/null test "$@"
+-eu && echo x=1 | "$1" 'quoted text'
+	done x=1 grep sed awk /usr/bin
+$(pwd) 2>/dev/null then "$1"
+		echo awk done export then awk test "$@" readonly --verbose done printf
+test "$@" readonly /usr/bin awk readonly printf then
+		"$@" && awk && local grep 'quoted text' | done
+printf | awk cd 2>/dev/null done && $(pwd) printf export --verbose
+test printf grep "$@" test
+	sed x=1 "$1" "$1" $(pwd) 'quoted text' grep then x=1
+	&& 2>/dev/null export sed ${HOME}
+	printf echo /usr/bin && | grep awk | 2>/dev/null then $(pwd) printf
+		grep ${HOME} printf "$@"
+then --verbose export "$@" 2>/dev/null $(pwd) export sed export
+	x=1 x=1 ${HOME} | x=1 ${HOME} | /usr/bin | "$1" grep grep "$1" test printf "$@"
+&& | && cd awk "$1" awk -eu 'quoted text' echo export
+		${HOME} x=1 local /usr/bin printf awk then cd grep printf local awk "$1" cd
+	"$1" cd ${HOME} --verbose test grep x=1 local "$@" -eu 2>/dev/null
+	then sed 2>/dev/null &&
+	/usr/bin ${HOME} "$@" test --verbose /usr/bin cd grep awk
+		test -eu sed export "$@" done readonly awk ${HOME} x=1 sed /usr/bin cd
+		$(pwd) | 2>/dev/null $(pwd) local awk 'quoted text' cd grep sed
+		${HOME} done "$1" echo done --verbose export test then
+		sed $(pwd) /usr/bin /usr/bin | readonly | echo x=1 echo done export done local
+	printf readonly then readonly x=1 sed then
+	$(pwd) local export local /usr/bin
+"$1" readonly "$1" sed && &&
+	export echo readonly awk test local /usr/bin
+	done "$1" | cd | echo echo && cd sed ${HOME} && done "$1" ${HOME} x=1 x=1
+	&& -eu "$1" sed "$@" --verbose sed --verbose
+printf then test export export test
+	done "$@" "$1" && then
+	readonly 2>/dev/null $(pwd) grep sed | /usr/bin && && && && grep sed
+done 2>/dev/null cd export echo export then
+| --verbose sed sed local readonly sed 'quoted text' cd
+	test readonly test ${HOME} export
+	| "$1" ${HOME} then then 2>/dev/null
+		-eu readonly awk readonly $(pwd) 'quoted text' test readonly
+test cd 'quoted text' export "$1" $(pwd) echo | readonly $(pwd) echo "$@" $(pwd)
+	$(pwd) grep then | readonly -eu "$1" $(pwd) --verbose test test
+x=1 /usr/bin export then $(pwd) | printf 'quoted text'
+	local readonly $(pwd) export /usr/bin ${HOME} 2>/dev/null readonly local
+	x=1 x=1 test && 2>/dev/null
+	then then 'quoted text' done done cd export /usr/bin sed 'quoted text'
+		x=1 "$@" then | grep "$@" "$@" "$@" -eu cd "$1"
+		"$@" x=1 "$@" /usr/bin | local $(pwd) test test then ${HOME}
+awk printf | cd done && $(pwd) --verbose 'quoted text' | echo readonly 2>/dev/null
+	export sed sed | test readonly awk | then done grep
+	${HOME} 2>/dev/null $(pwd) 2>/dev/null grep export "$@" printf
+		${HOME} 'quoted text' /usr/bin awk -eu -eu &&
+echo sed 'quoted text' x=1 grep printf done -eu --verbose awk | | ${HOME} cd
+echo && x=1 local printf sed "$1" export local 'quoted text' done then "$1" sed
+		sed export export sed awk ${HOME} awk && sed
+		/usr/bin $(pwd) -eu echo then local sed
+	x=1 printf | "$1" test 2>/dev/null then 2>/dev/null ${HOME} printf done x=1 then
+/usr/bin printf done -eu /usr/bin then sed "$1" -eu awk ${HOME}
+		x=1 then grep then printf awk echo printf && 'quoted text'
+	| echo grep ${HOME} $(pwd) && local printf test $(pwd) test test -eu /usr/bin
+	"$1" printf ${HOME} cd "$@" | export 2>/dev/null && "$1" cd --verbose
+		x=1 $(pwd) grep sed then "$@" --verbose done grep "$1"
+		cd --verbose ${HOME} x=1 printf /usr/bin ${HOME}
+		'quoted text' ${HOME} -eu readonly
+	local $(pwd) export echo echo sed && printf done sed
+local readonly 'quoted text' && cd --verbose test done
+		readonly test grep done awk then export test 2>/dev/null | "$@" grep local /usr/bin
+printf done grep done
+grep 'quoted text' printf echo done 2>/dev/null /usr/bin
+	echo --verbose 'quoted text' sed "$@" -eu "$1" echo printf x=1
+cd sed local 'quoted text' awk then && --verbose then x=1 test
+	$(pwd) | done $(pwd) 2>/dev/null 'quoted text' cd local
+		awk | && done ${HOME} --verbose x=1 local 'quoted text'
+		"$1" "$1" $(pwd) && test -eu done export local grep test cd grep 2>/dev/null 'quoted text'
+'quoted text' export grep printf test done printf test "$1"
+		echo -eu test 2>/dev/null
+"$1" "$1" readonly echo export done
+	"$@" "$@" ${HOME} ${HOME} "$1" | awk
+		printf awk awk sed echo cd awk "$1" /usr/bin printf cd 2>/dev/null "$1"
+	printf x=1 awk readonly ${HOME} local --verbose "$1" echo
+2>/dev/null test "$1" export printf 2>/dev/null awk "$@" grep cd
+	$(pwd) -eu /usr/bin readonly done grep $(pwd) readonly
+		/usr/bin x=1 grep 2>/dev/null
+-eu cd cd echo then $(pwd) -eu $(pwd) --verbose | 2>/dev/null cd 2>/dev/null
+	| ${HOME} /usr/bin /usr/bin
+		printf $(pwd) | && sed readonly test $(pwd) ${HOME}
+	/usr/bin test && ${HOME} | ${HOME} && "$1" && -eu test awk 'quoted text' grep
+		echo | --verbose test cd --verbose test readonly sed then sed
+		'quoted text' && awk local cd $(pwd)
+		x=1 $(pwd) grep awk | cd && export echo && cd "$@" test test grep
+		cd | x=1 cd printf then
+then "$@" local test 'quoted text' printf $(pwd) --verbose /usr/bin printf
+	| export grep -eu done "$@" cd && x=1 echo "$@" grep test /usr/bin awk ${HOME}
+	"$@" cd ${HOME} echo "$1" awk && grep $(pwd) done x=1
+"$@" grep "$1" "$1" local --verbose
+		--verbose x=1 "$1" && sed x=1
+		2>/dev/null /usr/bin && export -eu "$@" $(pwd)
+		'quoted text' "$1" local 'quoted text' 'quoted text' -eu $(pwd) awk readonly &&
+readonly local x=1 echo 'quoted text' cd "$1" 2>/dev/null
+x=1 test ${HOME} "$1" $(pwd) cd && cd echo sed
+	-eu then awk sed ${HOME} echo test "$@" ${HOME} then done | sed | 2>/dev/null
+		$(pwd) printf echo grep grep ${HOME} $(pwd)
+	x=1 local readonly ${HOME} -eu then $(pwd)
+		awk | "$@" x=1 export -eu
+local readonly 2>/dev/null
+	| --verbose printf --verbose
+'quoted text' awk "$@" local ${HOME} x=1 && local
+	sed -eu -eu cd local "$1" && /usr/bin then cd readonly --verbose x=1 local "$@"
+sed 2>/dev/null cd local
+		x=1 | local ${HOME} export done export "$@" readonly grep done
+		printf local done "$@" "$@" $(pwd) 2>/dev/null -eu ${HOME} printf cd readonly
+echo 2>/dev/null done /usr/bin echo
+	sed $(pwd) && sed "$1" local export done
+echo "$1" $(pwd) x=1 printf grep 2>/dev/null 2>/dev/null
+test --verbose -eu "$@" echo awk -eu awk cd
+| export x=1 'quoted text' echo "$@" printf "$1" grep "$1" 'quoted text' echo "$@"
+	-eu printf "$1" readonly --verbose echo ${HOME} /usr/bin $(pwd)
+x=1 echo export test /usr/bin "$1" $(pwd)
+	echo echo echo "$1" --verbose
+	--verbose readonly then -eu x=1 /usr/bin --verbose "$@" test --verbose printf
+		| readonly x=1 2>/dev/null test | awk /usr/bin
+grep && then awk --verbose && test $(pwd) local
+	$(pwd) test ${HOME} test test
+	'quoted text' readonly echo readonly x=1 && "$@" sed test 'quoted text'
+done cd --verbose ${HOME} 2>/dev/null export --verbose
+		/usr/bin 'quoted text' 2>/dev/null test /usr/bin
+		grep printf 2>/dev/null $(pwd) sed readonly
+test 'quoted text' sed
+		done "$@" && 2>/dev/null /usr/bin | --verbose
+	x=1 cd /usr/bin awk && cd --verbose
+	printf ${HOME} /usr/bin echo "$@"
+		--verbose x=1 | $(pwd) -eu grep 2>/dev/null /usr/bin | echo readonly local
+		-eu awk -eu ${HOME} cd sed 2>/dev/null echo 'quoted text' cd | 'quoted text'
+	-eu -eu /usr/bin grep readonly cd -eu sed export --verbose
+	${HOME} printf then 2>/dev/null cd ${HOME} -eu $(pwd)
+		-eu awk x=1 local "$@" awk $(pwd) awk local printf | "$1" then readonly
+		&& echo 2>/dev/null |
+	"$@" 2>/dev/null x=1 awk local
+	$(pwd) "$1" $(pwd) grep --verbose
+awk "$1" x=1 sed | /usr/bin export -eu test cd 'quoted text' 2>/dev/null x=1
+cd test && readonly ${HOME} /usr/bin x=1 2>/dev/null
+echo $(pwd) $(pwd) printf
+		"$@" --verbose 2>/dev/null --verbose 2>/dev/null test
+		echo awk "$@" 'quoted text' printf done cd grep cd "$1" export sed awk test printf
+	--verbose done ${HOME} -eu done awk | | export cd then
+		${HOME} | && 2>/dev/null awk cd awk readonly "$1" | 'quoted text'
+		'quoted text' ${HOME} export 2>/dev/null local then printf
+		echo export x=1 done then printf done
+local readonly --verbose export "$@" "$1" then | x=1 -eu x=1 "$1" $(pwd)
+		${HOME} done 'quoted text' "$@" echo
+	awk echo export grep done local cd awk $(pwd)
+then echo printf test /usr/bin local | cd export sed
+		test sed export export "$@" test test readonly awk ${HOME}
+	sed cd awk /usr/bin /usr/bin sed /usr/bin x=1 ${HOME}
+export grep "$@" "$1" ${HOME} echo then local echo test local /usr/bin
+	export test 2>/dev/null 'quoted text'
+${HOME} $(pwd) readonly local ${HOME} ${HOME} export then --verbose
+cd "$@" test $(pwd) readonly awk printf "$1" then printf then
+/usr/bin --verbose done ${HOME}
+	x=1 x=1 export $(pwd) local printf /usr/bin grep test | sed /usr/bin
+/usr/bin && cd awk -eu printf --verbose 'quoted text'
+		'quoted text' "$1" "$@" done local "$@" /usr/bin then "$1" 2>/dev/null
+${HOME} -eu "$@" && $(pwd) && export
+readonly && then | "$1" | ${HOME} 2>/dev/null | echo && test && 2>/dev/null
+printf 'quoted text' done awk sed awk export test --verbose awk
+local --verbose $(pwd) x=1 printf $(pwd) cd done "$1"
+readonly export awk --verbose then printf
+		then $(pwd) "$@" && test readonly sed readonly
+		"$1" done /usr/bin export export
+awk done $(pwd) cd export "$1" export "$@" done 'quoted text'
+		local grep test && -eu sed x=1 awk "$1"
+grep | $(pwd) 2>/dev/null done 'quoted text' 2>/dev/null grep
+	$(pwd) "$1" local && test readonly done readonly
+-eu test -eu 'quoted text' -eu sed --verbose "$1" test printf cd ${HOME} -eu
+	--verbose grep done readonly ${HOME} x=1 -eu --verbose
+"$1" cd x=1 x=1 | readonly printf export
+	echo local test "$@" done ${HOME}
+"$@" ${HOME} "$@" 'quoted text' then then && printf printf grep "$1" -eu cd
+local printf --verbose
+	then sed readonly sed then readonly cd local ${HOME} | awk echo && test then
+"$@" awk /usr/bin test cd grep
+		$(pwd) grep cd && | $(pwd) local then $(pwd) export ${HOME} export 2>/dev/null
+	'quoted text' && x=1 /usr/bin 'quoted text' done grep then
+	/usr/bin "$1" ${HOME} "$@" --verbose cd
+readonly /usr/bin "$1" export test readonly
+		x=1 && printf printf x=1 $(pwd) sed /usr/bin sed /usr/bin echo x=1 sed "$@"
+		printf echo /usr/bin 2>/dev/null && printf
+	$(pwd) local test echo
+		${HOME} sed && awk cd --verbose 2>/dev/null
+	grep "$@" --verbose $(pwd) export done printf
+		done grep "$@" x=1 sed 'quoted text' readonly cd ${HOME} "$1" "$@"
+		2>/dev/null grep grep grep cd printf echo done $(pwd) echo x=1 'quoted text'
+	"$1" -eu /usr/bin "$@" "$1" done export $(pwd) test && && grep && test x=1 done
+		2>/dev/null $(pwd) sed sed $(pwd) && 2>/dev/null 'quoted text' /usr/bin
+sed $(pwd) local awk ${HOME}
+		test | echo sed && -eu |
+test sed awk ${HOME} test done readonly /usr/bin echo 'quoted text'
+		/usr/bin printf ${HOME} local "$@" grep --verbose 'quoted text'
+| printf readonly "$@" then | echo
+		x=1 grep $(pwd) --verbose $(pwd) "$1" printf export -eu "$@" readonly then test
+test /usr/bin "$1" readonly awk x=1 grep awk test "$1" echo
+		readonly local sed local
+		'quoted text' "$1" awk "$1" export
+	export | echo readonly ${HOME}
+	&& x=1 cd local then local "$@" ${HOME} 2>/dev/null
+		'quoted text' awk ${HOME} --verbose --verbose test --verbose cd local export
+		echo x=1 ${HOME} 2>/dev/null
+		done x=1 'quoted text' test export
+		&& 'quoted text' done sed done ${HOME} | -eu && then then local 2>/dev/null
+test awk printf sed awk -eu grep readonly x=1 local "$@" export then 2>/dev/null
+	${HOME} readonly then echo x=1 | /usr/bin test
+		then "$@" x=1 /usr/bin printf "$@" 'quoted text' -eu
+	x=1 readonly awk sed sed x=1 awk
+"$@" awk -eu 'quoted text' /usr/bin printf awk "$1" test /usr/bin
+| awk x=1 2>/dev/null ${HOME} "$@" $(pwd) 'quoted text' --verbose done | x=1
+		x=1 echo -eu export -eu $(pwd) | printf awk export done "$1" test
+		'quoted text' readonly then done awk done
+		echo x=1 'quoted text' then /usr/bin
+	| sed $(pwd) export then
+	test sed cd done && 2>/dev/null
+		&& /usr/bin echo "$1" export
+	x=1 "$1" -eu test local -eu /usr/bin $(pwd)
+	printf "$@" 'quoted text' sed && | then -eu done export printf /usr/bin cd
+	grep "$@" awk printf --verbose sed
+local | && -eu 2>/dev/null printf 'quoted text' ${HOME} grep "$1"
+| test ${HOME} ${HOME} --verbose echo "$@" ${HOME} local && ${HOME} cd test ${HOME}
+/usr/bin local x=1 then local ${HOME} cd 'quoted text' printf "$1"
+export printf awk grep then "$@" local 2>/dev/null "$1" test --verbose
+	awk 2>/dev/null "$@" printf test done
+	printf -eu echo | printf x=1
+sed test x=1 awk export printf sed echo ${HOME} "$@" printf "$@" local
+	awk --verbose /usr/bin test local $(pwd) awk then echo ${HOME}
+	sed ${HOME} grep awk test cd &&
+		&& "$1" && x=1 cd x=1 export $(pwd) $(pwd) done | printf /usr/bin x=1 local local
+		'quoted text' 2>/dev/null | sed sed then ${HOME} 'quoted text' $(pwd) /usr/bin
+		done test "$@" --verbose export x=1 | test -eu -eu "$@" ${HOME} | --verbose
+$(pwd) "$1" grep x=1 | awk sed --verbose done awk
+readonly done 'quoted text' $(pwd) "$@" cd "$1"
+x=1 "$@" ${HOME} $(pwd) x=1
+printf $(pwd) "$1" awk
+	sed export test /usr/bin -eu ${HOME} echo grep echo echo "$1" ${HOME} cd sed
+		awk -eu /usr/bin awk awk
+		grep test export && "$1" cd local -eu | /usr/bin done -eu && readonly
+then readonly --verbose printf && sed 2>/dev/null
+x=1 sed && && ${HOME} echo local printf grep export done "$@"
+		$(pwd) "$1" sed local export awk test export -eu test
+	-eu $(pwd) sed -eu $(pwd) local && && $(pwd) ${HOME} "$1" awk "$1"
+		cd && $(pwd) "$@" x=1 "$1" grep printf readonly cd "$1" "$1" awk --verbose
+/usr/bin awk awk grep sed x=1 2>/dev/null x=1 done
+		-eu 2>/dev/null sed cd 'quoted text' printf x=1 x=1 export
+		x=1 readonly printf readonly 'quoted text' done ${HOME} printf printf echo export
+		export printf /usr/bin then test awk echo
+awk --verbose then --verbose sed $(pwd) local grep && sed export
+printf ${HOME} local readonly awk export done x=1 &&
+		'quoted text' test | "$@" x=1 sed readonly grep | --verbose awk echo 'quoted text'
+export printf $(pwd) grep local 'quoted text'
+	--verbose && test grep awk -eu then readonly
+	| export export test "$@" /usr/bin export "$1" grep echo
+/usr/bin readonly $(pwd) -eu
+	/usr/bin /usr/bin /usr/bin "$@" 2>/dev/null echo 'quoted text'
+'quoted text' -eu export | x=1 done "$@" $(pwd) | then ${HOME} -eu -eu
+		test -eu sed && test awk $(pwd) printf 2>/dev/null awk | 'quoted text'
+		echo --verbose 2>/dev/null | cd echo
+		readonly test && | sed 2>/dev/null
+cd 'quoted text' -eu test export -eu sed
+-eu then awk test readonly then then printf test test && 2>/dev/null
+	-eu --verbose awk test export /usr/bin grep "$1" /usr/bin local echo sed
+		/usr/bin ${HOME} printf /usr/bin --verbose echo cd export sed grep awk
+	'quoted text' sed /usr/bin x=1 | local
+printf done sed "$@" && readonly && -eu echo printf sed done --verbose
+		then local then 'quoted text' sed
+		${HOME} 'quoted text' "$1" "$1" export done x=1 local local "$@"
+		test then export && && readonly | cd && --verbose
+		printf printf "$1" then awk 'quoted text' /usr/bin | grep cd then 2>/dev/null
+	$(pwd) && 2>/dev/null 2>/dev/null done "$1" | $(pwd) awk sed
+	"$1" --verbose | awk local test then && test
+"$@" printf done done -eu && grep test "$1" 'quoted text'
+	test readonly test $(pwd) printf /usr/bin sed "$1" export
+'quoted text' "$1" export
+	"$1" printf && $(pwd) awk
+	local then grep sed /usr/bin test readonly export awk
+local "$1" readonly --verbose local
+	printf 2>/dev/null done
+"$@" -eu && sed "$@" 'quoted text' && ${HOME} x=1 then
+	2>/dev/null readonly echo cd | readonly --verbose
+readonly grep | | test 'quoted text' -eu printf 'quoted text'
+	awk && | -eu "$@" grep grep | done awk sed test x=1
+	sed awk -eu "$1" echo export
+readonly done test export ${HOME} then "$1"
+	sed echo 2>/dev/null echo "$1" "$1" then
+	2>/dev/null sed "$1" grep --verbose sed /usr/bin "$1" -eu local sed grep
+		"$1" grep $(pwd) 2>/dev/null
+		readonly sed cd test grep cd cd | then 'quoted text' cd /usr/bin
+		'quoted text' 'quoted text' 2>/dev/null done && -eu
+		then sed sed local && "$@"
+		test "$1" && 'quoted text' awk 2>/dev/null --verbose "$@" 2>/dev/null
+		grep /usr/bin export readonly then --verbose then readonly ${HOME} awk
+x=1 awk && done done $(pwd) /usr/bin printf
+	2>/dev/null readonly ${HOME} then -eu -eu --verbose | "$1" /usr/bin sed
+"$1" x=1 && cd --verbose
+		x=1 | printf 'quoted text' awk done grep &&
+		test test printf && done 'quoted text'
+$(pwd) readonly echo local done
+	&& | "$@" awk printf local awk grep readonly 'quoted text'
+	grep -eu cd 'quoted text' local --verbose test 'quoted text' "$1" /usr/bin
+		then x=1 ${HOME} sed test then echo grep printf 2>/dev/null -eu local "$@" x=1
+/usr/bin "$@" x=1 done sed export -eu cd "$@" /usr/bin -eu $(pwd) -eu readonly
+	local -eu grep test grep && ${HOME} | done | $(pwd) $(pwd)
+printf -eu sed x=1 ${HOME} "$@" --verbose
+		${HOME} cd && done /usr/bin cd "$@" then ${HOME} then
+		${HOME} 'quoted text' x=1 /usr/bin ${HOME}
+printf printf x=1 x=1 then echo /usr/bin -eu local $(pwd) cd done test
+--verbose printf --verbose
+		local then cd --verbose x=1 test "$1" test $(pwd)
+grep awk "$@" /usr/bin | printf
+echo test x=1 then readonly readonly grep | local readonly echo cd then
+	then export "$1" then 2>/dev/null "$@" $(pwd) 2>/dev/null 2>/dev/null
+test done printf printf grep readonly echo 2>/dev/null /usr/bin
+	&& --verbose ${HOME} printf -eu 'quoted text'
+'quoted text' -eu "$1" "$@" readonly readonly "$@" readonly "$1" printf x=1 echo
+awk awk printf 2>/dev/null then "$@" done ${HOME}
+	then done echo "$@" export ${HOME} && done "$1" ${HOME} cd then 2>/dev/null
+		then ${HOME} sed done then --verbose
+		"$@" local test printf /usr/bin | done ${HOME} ${HOME} readonly
+&& then done awk "$@" "$@" ${HOME} local done done awk 'quoted text' sed awk export
+/usr/bin sed then printf local cd printf
+"$1" $(pwd) | x=1 "$@" x=1 then then -eu x=1 sed /usr/bin done &&
+export x=1 'quoted text' done "$@"
+		sed sed | && 2>/dev/null | $(pwd) test cd grep x=1 readonly then awk
+x=1 | ${HOME} test x=1 sed done
+done readonly cd "$1" $(pwd)
+'quoted text' 'quoted text'
+	/usr/bin $(pwd) x=1 --verbose /usr/bin printf then "$@" && ${HOME} then
+		echo sed grep ${HOME} | done readonly -eu test | "$@" done grep $(pwd) && "$1"
+	sed local | 2>/dev/null
+		then export "$1" | test printf echo
+	done then echo 'quoted text' /usr/bin done $(pwd) then cd then x=1 readonly
+--verbose "$@" grep grep ${HOME} -eu 2>/dev/null awk grep && printf sed local
+	awk /usr/bin /usr/bin readonly then done grep -eu local readonly
+2>/dev/null "$1" ${HOME} x=1
+		then echo x=1 awk then echo cd then
+	2>/dev/null awk | "$@" 'quoted text'
+		${HOME} -eu x=1 readonly "$@" local 2>/dev/null
+		"$1" readonly /usr/bin export sed cd cd awk
+	test grep then | export
+	cd export readonly ${HOME} "$1"
+	x=1 ${HOME} -eu echo done test x=1 2>/dev/null test done
+${HOME} /usr/bin then export
+		$(pwd) then ${HOME} --verbose test grep grep 2>/dev/null grep printf
+	${HOME} done then && cd local sed grep done echo
+	cd cd 2>/dev/null awk cd
+		x=1 then x=1 /usr/bin ${HOME} awk grep --verbose
+	"$1" ${HOME} ${HOME} printf 2>/dev/null && $(pwd)
+echo echo then done test awk /usr/bin
+"$@" "$@" "$@" -eu 'quoted text' export test printf grep awk
+	-eu && printf ${HOME} done 2>/dev/null printf done test echo "$1"
+	'quoted text' cd grep $(pwd) -eu grep --verbose
+	awk "$@" readonly grep cd then printf -eu ${HOME} printf awk printf
+		awk ${HOME} 'quoted text' export "$@" grep
+	/usr/bin $(pwd) --verbose test && printf -eu -eu "$@" x=1 -eu
+-eu echo $(pwd) readonly then readonly readonly
+	2>/dev/null local x=1 awk test grep
+		echo grep -eu "$@" local awk && printf && cd 'quoted text'
+then readonly printf ${HOME} grep
+&& cd readonly sed | --verbose readonly done test
+	"$@" /usr/bin x=1 sed x=1
+x=1 then sed awk "$@" echo awk && "$1" && printf
+done && grep x=1 sed x=1 /usr/bin readonly | "$1" done then $(pwd)
+2>/dev/null test done local printf
+	/usr/bin sed export | readonly readonly &&
+	done test cd | awk then then
+	-eu done awk local "$@" /usr/bin 2>/dev/null grep export
+done "$1" 'quoted text'
+		echo grep printf -eu test
+/usr/bin export sed 2>/dev/null done "$@" readonly $(pwd) -eu -eu | |
+		x=1 printf grep cd --verbose test "$@" $(pwd)
+	'quoted text' echo sed 'quoted text' 2>/dev/null
+export --verbose | awk | "$1" $(pwd) ${HOME} && /usr/bin awk 2>/dev/null ${HOME}
+export -eu 'quoted text' ${HOME} -eu 2>/dev/null ${HOME}
+${HOME} ${HOME} /usr/bin 2>/dev/null
+		grep /usr/bin printf printf --verbose "$@" 2>/dev/null local && /usr/bin -eu
+		-eu grep grep && done readonly printf
+readonly 'quoted text' grep awk local x=1 && local ${HOME} &&
+		"$@" cd local export
+		'quoted text' -eu ${HOME} then echo
+"$1" ${HOME} 'quoted text' 2>/dev/null && done "$@" x=1 cd cd --verbose
+		local then sed cd export 2>/dev/null done readonly export sed cd cd local local
+		'quoted text' x=1 x=1 done awk awk local "$1" echo export /usr/bin awk test
+	"$@" $(pwd) sed printf 'quoted text'
+echo --verbose printf local local awk --verbose /usr/bin /usr/bin test
+	printf awk 2>/dev/null
+	export $(pwd) sed ${HOME}
+	"$@" cd readonly export $(pwd) printf /usr/bin cd "$1" done printf readonly "$1"
+		cd grep ${HOME} x=1 echo grep && done printf
+test /usr/bin sed sed test 2>/dev/null done "$1" | | export printf --verbose
+	/usr/bin && /usr/bin x=1 awk | cd && export /usr/bin
+		local $(pwd) $(pwd) 'quoted text' local --verbose ${HOME} && $(pwd) test
+	done $(pwd) export ${HOME} ${HOME} readonly "$@" awk echo -eu sed x=1 cd awk cd
+	awk local cd --verbose /usr/bin done x=1 cd printf /usr/bin cd $(pwd) awk x=1
+		export 2>/dev/null ${HOME} echo -eu export --verbose done && && local
+	"$1" local done 'quoted text'
+	sed test done export readonly 2>/dev/null
+	sed cd /usr/bin | readonly sed "$1" then then awk -eu done done $(pwd) /usr/bin
+x=1 then cd awk "$1" awk /usr/bin ${HOME}
+&& cd test test done 'quoted text' | test 'quoted text' /usr/bin printf
+		--verbose --verbose awk done "$@" ${HOME}
+		&& sed echo "$@" ${HOME}
+		printf then -eu 'quoted text' 2>/dev/null export
+		$(pwd) export sed 'quoted text'
+	awk | 'quoted text' $(pwd) x=1
+$(pwd) awk "$1" && "$1" test x=1 2>/dev/null sed echo awk -eu then 2>/dev/null
+--verbose cd ${HOME} then local
+local | then sed 'quoted text' test awk sed 2>/dev/null
+		/usr/bin test --verbose 2>/dev/null
+-eu local | test test "$@" ${HOME}
+cd local $(pwd) "$@"
+	printf "$@" "$1" readonly
+		| $(pwd) -eu echo echo "$@" echo && --verbose readonly grep printf
+	sed 'quoted text' printf echo grep $(pwd)
+	then then "$@" test done test "$1"
+		'quoted text' done export echo "$@" 'quoted text'
+then x=1 /usr/bin $(pwd) test --verbose sed
+	sed local done done 'quoted text' | then
+		echo done --verbose cd "$1" && test readonly | printf awk ${HOME}
+done /usr/bin 'quoted text' $(pwd) "$@" 'quoted text'
+-eu done printf "$1" awk -eu && "$1" x=1 cd test /usr/bin
+	'quoted text' cd cd 'quoted text' "$@" --verbose --verbose && done export
+	then && "$1" "$1" | sed 'quoted text' 'quoted text' && &&
+	"$1" --verbose --verbose 'quoted text' printf sed awk
+test then test test -eu && local sed -eu sed 2>/dev/null
+		readonly ${HOME} cd then -eu
+	echo /usr/bin readonly then sed && --verbose local ${HOME} --verbose
+readonly grep printf printf --verbose
+	local 'quoted text' x=1 grep awk --verbose /usr/bin cd $(pwd) readonly
+echo "$1" export | && printf ${HOME} awk && then ${HOME} -eu "$1"
+		${HOME} | printf 'quoted text' /usr/bin printf
+-eu | x=1 sed export cd -eu ${HOME} grep echo
+	x=1 'quoted text' echo printf then echo grep
+local then cd x=1 printf test $(pwd) done x=1 ${HOME} awk export export
+	x=1 && "$1" ${HOME} "$1" done test --verbose test test /usr/bin
+readonly "$@" local then | 'quoted text' export grep -eu local && grep
+export sed 2>/dev/null
+readonly "$1" local export "$1" "$@"
+	/usr/bin cd "$1" export x=1 "$1" | export
+	readonly export && export sed 'quoted text' -eu export local
+		/usr/bin export readonly cd $(pwd) grep
+&& -eu && sed echo --verbose local export local sed x=1 grep 'quoted text'
+2>/dev/null then then test local 2>/dev/null local 'quoted text'
+		"$@" "$@" test export 'quoted text' awk test export readonly
+		2>/dev/null grep done grep "$@" cd readonly | x=1
+readonly && printf "$@" $(pwd) -eu test grep local ${HOME} awk -eu
+	${HOME} local awk -eu
+		sed sed done "$@" "$1" 'quoted text' local /usr/bin
+		then local /usr/bin "$1" $(pwd) local test /usr/bin
+		echo grep export cd echo grep $(pwd) printf grep | | export --verbose printf 'quoted text'
+		readonly 'quoted text' -eu test local /usr/bin
+		${HOME} && 'quoted text' echo $(pwd) --verbose
+| | test ${HOME} grep export grep local printf && && done ${HOME}
+	then 'quoted text' "$@" | echo --verbose
+		&& -eu ${HOME} -eu export grep 2>/dev/null
+	${HOME} grep sed /usr/bin then echo grep 2>/dev/null
+		| sed grep 'quoted text'
+&& then printf x=1 then done cd echo printf 'quoted text'
+		echo --verbose awk /usr/bin x=1 /usr/bin done local cd ${HOME} 'quoted text'
+	$(pwd) export x=1 export $(pwd) --verbose
+test $(pwd) sed then local x=1 cd "$@" /usr/bin 2>/dev/null cd awk 'quoted text'
+test | test test echo test "$1" ${HOME} echo test "$@" echo then printf
+cd awk --verbose 'quoted text' "$@"
+	test then cd echo x=1 test 'quoted text'
+	--verbose x=1 then -eu local
+echo test test grep readonly 2>/dev/null awk test sed $(pwd)
+		local echo | cd export | $(pwd) cd | done cd export -eu grep test test awk done
+	2>/dev/null echo done awk done printf
+	echo -eu done grep x=1 local readonly export
+	readonly --verbose printf && "$@" --verbose sed done x=1 ${HOME} readonly
+		--verbose printf then $(pwd) x=1 "$1" -eu then local cd ${HOME}
+	${HOME} | grep readonly x=1
+		-eu grep && awk && 2>/dev/null
+		&& done "$@" "$1" /usr/bin 2>/dev/null | "$1" echo --verbose x=1 2>/dev/null
+	$(pwd) -eu printf x=1 printf then "$1" 2>/dev/null /usr/bin
+	grep readonly test "$1" test
+	"$1" printf && 'quoted text' readonly grep "$1"
@@ -0,0 +1,2001 @@
+	&& && -eu printf local
+x=1 readonly "$1" 'quoted text' "$@" /usr/bin readonly x=1 sed $(pwd) | grep cd
+	export 2>/dev/null ${HOME}
+"$@" cd | test && ${HOME} -eu sed sed grep echo ${HOME}
+		sed /usr/bin export x=1 -eu
+local 2>/dev/null test sed
+&& then 2>/dev/null export "$1"
+cd test grep "$1" | awk
+	'quoted text' test then local -eu | "$1" $(pwd) 2>/dev/null export sed "$1" --verbose
+export 2>/dev/null local 2>/dev/null && && 'quoted text' done echo 2>/dev/null
+	-eu -eu sed $(pwd) x=1 | local grep echo readonly $(pwd) $(pwd) export
+'quoted text' local /usr/bin grep cd
+	export sed cd && done $(pwd) done awk "$1" then readonly then cd cd 'quoted text'
+		sed awk grep 'quoted text' x=1 cd /usr/bin done 2>/dev/null
+		sed echo 2>/dev/null "$@" 'quoted text'
+$(pwd) cd cd --verbose -eu readonly "$1" printf cd sed test
+		"$@" -eu | grep grep "$1" test readonly ${HOME} awk x=1 x=1
+grep printf | 'quoted text' "$1" /usr/bin | printf readonly --verbose export
+		"$@" 2>/dev/null --verbose readonly awk printf 2>/dev/null -eu
+		test && --verbose test x=1 sed | --verbose "$@"
+	"$@" sed then test "$@" echo readonly printf && 'quoted text' --verbose
+	sed export sed test "$1" grep --verbose $(pwd) readonly done | && /usr/bin
+"$1" readonly sed $(pwd) local -eu test 'quoted text'
+	&& 'quoted text' --verbose test export && "$1" -eu "$@"
+	${HOME} $(pwd) printf cd --verbose "$1" -eu 2>/dev/null
+$(pwd) /usr/bin -eu "$@" cd --verbose
+$(pwd) grep local -eu ${HOME} ${HOME} $(pwd) 'quoted text'
+sed sed --verbose -eu printf then
+		local local printf "$@" done grep ${HOME} $(pwd) local local -eu 'quoted text'
+	-eu grep readonly && printf sed then
+	&& export ${HOME} -eu $(pwd) /usr/bin
+"$1" printf grep ${HOME} 'quoted text' /usr/bin 'quoted text' -eu "$@" local &&
+		test done local test 'quoted text'
+	export local readonly ${HOME}
+		"$1" && | local sed -eu sed && grep grep 2>/dev/null
+		test "$1" sed done echo --verbose ${HOME} done 2>/dev/null $(pwd) export --verbose
+awk export grep --verbose readonly awk 2>/dev/null export
+		done test sed sed x=1 /usr/bin 'quoted text' /usr/bin "$1" $(pwd) ${HOME}
+		2>/dev/null | && "$@" sed echo test ${HOME} sed $(pwd) export | grep
+		"$@" test grep -eu sed -eu done printf grep cd -eu --verbose
+	"$1" /usr/bin printf $(pwd) --verbose export grep | 'quoted text' x=1 export readonly
+		done echo cd "$@" x=1 ${HOME}
+	then echo 'quoted text' echo then -eu sed 'quoted text' && 'quoted text' readonly
+local "$@" $(pwd) 2>/dev/null --verbose grep ${HOME} 2>/dev/null test
+readonly awk done "$1"
+	"$1" "$1" printf local
+	export sed cd readonly then readonly export
+	sed local cd grep 2>/dev/null |
+&& x=1 grep local "$1"
+	export printf awk -eu export
+	$(pwd) 2>/dev/null cd echo "$@" | --verbose
+		cd done 2>/dev/null then ${HOME}
+	cd then /usr/bin $(pwd) printf export
+	| sed echo awk then test local
+		| local then done x=1 $(pwd) export done sed "$1" export
+	x=1 sed grep then /usr/bin
+	then $(pwd) echo --verbose x=1 "$@" ${HOME} "$1" grep export -eu printf test printf
+${HOME} sed "$1" printf | done && /usr/bin export
+	--verbose | then --verbose
+	export /usr/bin export export sed --verbose printf export "$1" "$1" printf
+--verbose printf "$1" awk $(pwd) readonly
+		grep && readonly echo /usr/bin then test echo cd x=1 echo x=1 x=1 awk x=1
+grep /usr/bin awk test then /usr/bin readonly
+	printf x=1 then readonly printf $(pwd) x=1 "$1" sed readonly --verbose
+		x=1 'quoted text' readonly
+	"$1" && "$@" cd "$@" echo readonly readonly | "$1" done $(pwd) $(pwd)
+	'quoted text' awk --verbose grep /usr/bin "$@" awk
+2>/dev/null readonly 'quoted text' printf test readonly ${HOME}
+	-eu -eu sed "$1" 2>/dev/null test ${HOME} --verbose "$1" -eu
+		readonly | -eu /usr/bin then export awk printf | x=1 then readonly done
+echo && 'quoted text' "$@" local test ${HOME} test
+awk | && "$@" cd printf export echo sed export ${HOME}
+	--verbose "$1" ${HOME} grep | local --verbose 2>/dev/null
+then 2>/dev/null "$@" done readonly 'quoted text' export printf --verbose
+awk cd --verbose ${HOME} "$1" /usr/bin printf | /usr/bin 2>/dev/null /usr/bin
+	awk && then awk && /usr/bin echo sed printf
+		sed && $(pwd) && | ${HOME} echo "$@"
+awk -eu awk && $(pwd) ${HOME} x=1
+local x=1 x=1 readonly awk grep 2>/dev/null x=1 cd "$@" then --verbose
+awk $(pwd) $(pwd) then readonly cd $(pwd) echo local awk --verbose
+| "$@" readonly echo | "$1" readonly done "$@" x=1
+		/usr/bin 'quoted text' then then x=1
+	'quoted text' --verbose "$1" && readonly awk --verbose
+readonly x=1 ${HOME} /usr/bin sed x=1 grep test export
+		cd "$@" x=1 test | "$1" cd && 2>/dev/null --verbose
+$(pwd) test awk local export $(pwd) $(pwd) printf awk x=1 $(pwd) echo
+"$@" | printf readonly --verbose sed awk --verbose --verbose sed
+		-eu 2>/dev/null printf echo test sed 'quoted text' export export -eu
+		x=1 x=1 export then "$1" 2>/dev/null --verbose
+	/usr/bin local readonly $(pwd)
+		| --verbose 'quoted text'
+	cd --verbose done $(pwd) then cd -eu local $(pwd) --verbose
+		"$@" | export export test && "$1" test sed --verbose
+export then readonly /usr/bin readonly /usr/bin cd && sed | cd "$@" export --verbose
+		/usr/bin /usr/bin "$1" done local | then "$1" export ${HOME}
+	"$@" | "$1" test readonly printf then $(pwd) $(pwd) then -eu -eu
+	2>/dev/null local x=1 done "$1" cd readonly
+grep -eu 'quoted text' x=1 sed
+	x=1 --verbose awk /usr/bin awk 'quoted text'
+export sed --verbose 2>/dev/null 'quoted text' "$@"
+--verbose echo sed 2>/dev/null
+awk && "$1" /usr/bin cd done echo 'quoted text' local --verbose $(pwd) export --verbose
+${HOME} "$@" /usr/bin x=1
+		done x=1 readonly then export "$1" done 'quoted text'
+--verbose local echo cd awk "$1" grep 'quoted text' x=1
+		then x=1 awk --verbose /usr/bin done x=1 --verbose
+	sed -eu /usr/bin "$@" awk sed && 2>/dev/null
+	-eu printf && ${HOME}
+'quoted text' x=1 cd && then "$@" && printf --verbose grep
+readonly echo $(pwd) then /usr/bin x=1 /usr/bin
+		printf 2>/dev/null echo then local "$1"
+test 2>/dev/null 'quoted text' && $(pwd) awk
+		$(pwd) cd x=1 2>/dev/null
+"$@" sed $(pwd) export "$@" x=1 printf awk
+'quoted text' done --verbose cd -eu echo done -eu /usr/bin cd grep readonly
+printf cd "$1" readonly awk "$@" "$@" 2>/dev/null
+		cd grep && local ${HOME} | test echo --verbose x=1 | then awk | then -eu
+		test printf local ${HOME} local awk export /usr/bin cd "$@"
+		readonly then /usr/bin test "$1" cd 2>/dev/null awk done ${HOME} && printf x=1
+		echo echo x=1 "$1" --verbose
+$(pwd) sed grep then then printf readonly printf 2>/dev/null echo cd
+		-eu --verbose 2>/dev/null
+	export test && "$1" && then cd sed cd then
+/usr/bin && && "$@" $(pwd) "$@" /usr/bin "$1"
+-eu then ${HOME} 'quoted text' sed test sed /usr/bin /usr/bin
+test /usr/bin sed x=1 2>/dev/null
+		export && cd ${HOME} sed -eu $(pwd) 2>/dev/null
+	echo $(pwd) 'quoted text' export | 'quoted text' -eu
+local 'quoted text' awk printf --verbose
+--verbose x=1 done readonly 2>/dev/null
+--verbose ${HOME} readonly local then /usr/bin
+readonly -eu $(pwd) --verbose cd done 'quoted text'
+		cd echo export --verbose "$@" awk readonly
+export export printf ${HOME} | readonly printf
+readonly ${HOME} echo local printf "$1" sed printf $(pwd) export 2>/dev/null
+readonly ${HOME} && --verbose echo | awk awk awk awk "$1" /usr/bin x=1 -eu sed
+echo 'quoted text' && "$1" echo
+		x=1 echo "$1" $(pwd) "$@" -eu 'quoted text' awk 'quoted text' local 2>/dev/null
+		x=1 /usr/bin echo cd /usr/bin done ${HOME}
+		"$1" "$@" && "$@" ${HOME} printf $(pwd)
+		test x=1 export readonly x=1 printf awk "$1" local
+${HOME} "$@" cd && printf printf awk awk -eu && done -eu export
+x=1 readonly "$1" 2>/dev/null --verbose -eu export 'quoted text' readonly local
+		done echo "$@" sed x=1 "$1" ${HOME} | sed echo local $(pwd) 2>/dev/null
+	"$@" ${HOME} 2>/dev/null test "$1" "$@" "$@"
+	&& readonly 'quoted text' && printf -eu done
+/usr/bin then --verbose grep echo local grep "$@" /usr/bin cd test local done "$1"
+readonly cd local | --verbose
+		"$1" printf then 'quoted text' "$1" then "$1" 2>/dev/null grep "$@"
+$(pwd) && --verbose awk x=1 "$@" echo printf 2>/dev/null
+	$(pwd) | export grep test test export x=1
+	local && local printf export echo
+2>/dev/null local -eu ${HOME} "$@" &&
+	readonly /usr/bin echo readonly /usr/bin --verbose && readonly
+	--verbose then "$@" --verbose printf
+	2>/dev/null awk done -eu 'quoted text' "$1" done
+printf done && 'quoted text' local && awk grep 2>/dev/null test && printf
+	&& x=1 local 2>/dev/null
+printf ${HOME} readonly
+		&& | --verbose sed 'quoted text' "$1" test test "$1" local x=1 echo
+		done readonly cd x=1 cd sed
+cd export grep | readonly $(pwd) 'quoted text' --verbose local cd "$@"
+	"$1" ${HOME} local grep done -eu cd | grep local printf export --verbose "$1" sed
+	cd done "$@" /usr/bin 2>/dev/null cd echo
+		&& "$1" -eu && "$@" echo cd ${HOME} printf 2>/dev/null export && -eu readonly
+		${HOME} readonly x=1 local export test | -eu -eu | grep
+--verbose awk test done local | | 2>/dev/null 'quoted text' local "$@"
+	'quoted text' ${HOME} sed $(pwd) ${HOME} echo $(pwd)
+		| test then printf "$1" export sed "$@" | -eu
+	then test grep 2>/dev/null "$@" /usr/bin "$1" awk echo awk then local 2>/dev/null
+'quoted text' done "$@" 'quoted text' --verbose
+		cd ${HOME} local && grep printf
+		-eu cd 'quoted text' sed 'quoted text' readonly
+		echo | test local --verbose $(pwd)
+export "$1" test readonly /usr/bin
+		${HOME} sed echo -eu local readonly grep awk 2>/dev/null printf awk -eu --verbose
+	then awk test --verbose
+		cd test local "$@" export local && "$1" grep
+	cd then --verbose export echo printf readonly cd x=1 awk sed "$@" grep readonly
+		readonly echo readonly "$1" sed printf "$@" printf test "$@" -eu | then --verbose
+'quoted text' then /usr/bin -eu done x=1 awk done "$1" "$@" test "$1"
+grep | ${HOME} printf ${HOME} cd test "$@" --verbose
+"$@" /usr/bin grep test awk grep grep --verbose /usr/bin done $(pwd) readonly
+	grep done test 2>/dev/null cd cd awk readonly
+export echo ${HOME} then $(pwd) readonly
+		awk -eu printf local "$@" sed ${HOME} readonly | awk
+$(pwd) awk /usr/bin export cd sed "$1" && cd test
+x=1 export then $(pwd) then -eu awk -eu sed test |
+	$(pwd) /usr/bin | local cd
+sed test cd done cd then echo x=1 done test 2>/dev/null x=1 echo then echo sed
+		sed awk "$@" done then /usr/bin test grep && export then cd --verbose grep
+"$1" printf export "$@"
+--verbose "$@" export awk printf cd awk export local
+		echo printf --verbose 2>/dev/null then 'quoted text' x=1 && export
+		"$@" awk x=1 echo readonly done export
+	$(pwd) x=1 test && export echo | readonly export local test
+$(pwd) cd test "$1" test export export ${HOME}
+readonly | readonly "$@" echo -eu -eu grep export local
+	test grep done 'quoted text' 2>/dev/null "$1" export $(pwd) x=1 "$1" "$1" /usr/bin
+awk local "$1" then | sed --verbose ${HOME} | echo then awk $(pwd)
+2>/dev/null ${HOME} 'quoted text' -eu readonly printf readonly
+	sed 'quoted text' "$@" then 2>/dev/null done
+local --verbose grep 2>/dev/null awk
+		&& 'quoted text' && -eu x=1 readonly readonly 'quoted text'
+		sed printf "$1" | -eu && awk grep then cd /usr/bin x=1 ${HOME} "$1" "$@" "$@"
+		${HOME} echo test --verbose | sed && local "$@"
+		export "$1" test ${HOME} then $(pwd) -eu -eu "$1" -eu x=1 "$1" && export
+		grep test 'quoted text' cd 'quoted text' x=1 grep done x=1 $(pwd) 'quoted text'
+	${HOME} 'quoted text' cd /usr/bin done /usr/bin grep ${HOME}
+		/usr/bin "$@" sed | ${HOME} 2>/dev/null grep | sed $(pwd) echo 'quoted text'
+${HOME} --verbose "$@" awk printf sed x=1 readonly
+"$@" cd printf local --verbose | export local echo 'quoted text'
+	local echo printf grep ${HOME} x=1 -eu awk grep done awk --verbose
+		'quoted text' "$@" awk |
+cd "$@" && export done /usr/bin readonly x=1 "$@" done done
+readonly "$@" done $(pwd) --verbose awk local -eu local
+$(pwd) grep done "$@" 2>/dev/null
+done ${HOME} sed export | test
+readonly then 'quoted text' x=1 -eu
+		awk awk -eu echo sed sed 2>/dev/null then local readonly printf awk $(pwd) -eu
+		'quoted text' -eu done 'quoted text' /usr/bin 2>/dev/null
+	"$1" test "$@" x=1 ${HOME} awk --verbose && cd export | ${HOME} && awk "$1"
+--verbose "$@" export grep "$1" $(pwd) | | && grep 'quoted text' test
+		cd awk | printf cd && --verbose
+"$1" | x=1 awk && -eu sed | ${HOME} grep /usr/bin cd printf local printf 'quoted text'
+$(pwd) test export done -eu | "$@" "$1" ${HOME} readonly
+	$(pwd) test sed sed readonly export "$@" done "$@" printf x=1 | then then
+		${HOME} "$@" then /usr/bin -eu 'quoted text' test | 'quoted text' x=1
+-eu local sed "$1" printf
+		"$1" x=1 2>/dev/null grep export
+echo | $(pwd) $(pwd) "$@"
+		"$@" cd 2>/dev/null test x=1 -eu export local "$@" "$@" grep "$@" "$@" done /usr/bin
+		export awk readonly x=1 export 2>/dev/null
+		done grep export $(pwd) done test
+test export && | sed "$1" && echo sed $(pwd)
+"$@" export "$@" then grep 2>/dev/null then 'quoted text' "$1" 2>/dev/null
+cd readonly -eu $(pwd) test export x=1 sed awk cd 2>/dev/null
+	| awk sed | then /usr/bin x=1
+	local x=1 local cd $(pwd) x=1 done then export
+		awk then then grep $(pwd) | x=1 /usr/bin 2>/dev/null
+	${HOME} "$1" done && done readonly -eu export 2>/dev/null --verbose /usr/bin
+awk test readonly export -eu $(pwd) cd --verbose 'quoted text' awk /usr/bin
+	then $(pwd) awk sed test awk sed grep then local 'quoted text' -eu cd &&
+	-eu test ${HOME} awk x=1 "$@" && 2>/dev/null && grep --verbose "$1" "$1" done $(pwd)
+		"$@" -eu "$@" /usr/bin ${HOME} --verbose && sed --verbose export ${HOME}
+	| then awk 2>/dev/null local awk && 2>/dev/null
+	--verbose local grep && && && then /usr/bin cd local
+		sed 2>/dev/null 2>/dev/null echo test
+"$1" readonly printf echo ${HOME} $(pwd) local local ${HOME} && done sed "$@"
+	&& then -eu 2>/dev/null |
+	2>/dev/null /usr/bin
+	export grep -eu test export done local cd 2>/dev/null sed local grep
+		local done /usr/bin x=1 x=1 "$@" ${HOME} readonly
+	-eu cd x=1 --verbose done export --verbose test && awk
+		/usr/bin export done grep test export $(pwd) readonly
+readonly then awk done ${HOME} echo && 'quoted text' ${HOME}
+${HOME} "$@" /usr/bin "$1" sed echo --verbose
+		'quoted text' local --verbose grep $(pwd) "$@" -eu then readonly
+	sed then | local 'quoted text' grep printf 'quoted text' 2>/dev/null echo
+done then test /usr/bin sed test 'quoted text' awk x=1 grep
+	export printf readonly
+		-eu printf --verbose echo cd 'quoted text' awk
+		${HOME} echo 'quoted text' "$@" 2>/dev/null "$1" --verbose local
+	export printf --verbose 'quoted text' test local cd && local readonly
+"$@" then done x=1 | -eu --verbose
+		readonly "$@" /usr/bin ${HOME}
+		2>/dev/null sed then 2>/dev/null export $(pwd) export export -eu then printf
+grep grep grep test /usr/bin echo cd then
+	$(pwd) awk sed 2>/dev/null -eu /usr/bin
+	test awk awk cd cd | done sed "$1"
+		$(pwd) then cd then cd | grep printf 2>/dev/null /usr/bin echo "$@" ${HOME} -eu
+sed -eu && cd printf cd readonly
+sed grep && printf export ${HOME} awk local -eu
+		/usr/bin local printf
+		export /usr/bin ${HOME} -eu grep local cd cd | -eu local && | 'quoted text'
+		then --verbose x=1 -eu -eu -eu "$1" local "$1" sed | local x=1 "$@" sed -eu
+${HOME} 2>/dev/null readonly && then "$1" /usr/bin
+sed export local then --verbose echo cd && -eu -eu cd ${HOME}
+${HOME} /usr/bin $(pwd) 'quoted text' cd export printf 2>/dev/null
+		-eu | ${HOME} done x=1 echo printf printf echo x=1 done $(pwd) --verbose
+		printf ${HOME} "$1" /usr/bin 'quoted text' $(pwd) printf x=1 /usr/bin 'quoted text'
+echo sed then sed "$@" readonly awk | cd printf 'quoted text'
+		cd "$1" readonly "$1" then echo sed /usr/bin printf local grep sed awk
+	echo 'quoted text' --verbose printf | ${HOME} "$1" awk
+	awk sed /usr/bin "$1" local grep awk
+test /usr/bin cd export 2>/dev/null
+"$1" sed | && $(pwd) echo test test --verbose
+	2>/dev/null "$1" $(pwd) -eu awk --verbose printf && done printf "$@" &&
+	${HOME} && echo 'quoted text' "$@" local test 'quoted text' && /usr/bin
+done /usr/bin /usr/bin "$@" x=1 printf
+		printf grep "$@" && awk printf ${HOME}
+		printf -eu 2>/dev/null ${HOME} $(pwd) grep printf /usr/bin 2>/dev/null $(pwd) cd
+	then printf x=1 x=1 "$@" /usr/bin
+		/usr/bin 2>/dev/null | awk test 2>/dev/null && "$@"
+	"$@" && "$@" /usr/bin $(pwd) ${HOME}
+		awk $(pwd) 'quoted text'
+-eu then -eu -eu local | 'quoted text' readonly
+	then x=1 2>/dev/null local export
+		&& "$1" $(pwd) test 'quoted text'
+		local grep && then 'quoted text' | grep && --verbose printf $(pwd)
+	$(pwd) | -eu export $(pwd) printf awk then -eu x=1
+test 2>/dev/null export $(pwd) readonly 2>/dev/null "$@" cd "$1" local $(pwd)
+		'quoted text' echo test echo test x=1 "$1" printf test awk --verbose
+awk sed export readonly echo sed done -eu
+	export done grep done then awk | -eu ${HOME} && | done
+"$1" readonly $(pwd) cd --verbose -eu export cd awk grep "$@" 'quoted text'
+		cd && awk cd export export
+	| "$@" readonly test 'quoted text' | x=1 cd "$@" readonly test echo
+	/usr/bin export "$@" "$@" ${HOME} 'quoted text' then x=1 $(pwd) then cd -eu local
+grep test && awk /usr/bin -eu "$1" && ${HOME} then | | local then
+	$(pwd) awk printf x=1 2>/dev/null
+grep x=1 awk --verbose $(pwd) readonly readonly export --verbose
+	--verbose && "$@" --verbose printf
+	$(pwd) x=1 awk printf done
+	cd 'quoted text' export x=1 printf then done "$@" then
+	echo export | export then 2>/dev/null --verbose then
+2>/dev/null 'quoted text'
+		awk | x=1 'quoted text' readonly grep then done -eu echo --verbose | -eu
+	awk -eu -eu $(pwd) readonly grep awk awk test done export awk
+/usr/bin ${HOME} x=1 'quoted text' grep | sed grep
+then then | echo awk cd --verbose ${HOME} export printf ${HOME} -eu
+	grep cd awk echo "$1" "$@"
+		${HOME} -eu sed grep printf echo $(pwd) export printf ${HOME} 2>/dev/null
+	grep test test grep test
+"$@" done -eu local 2>/dev/null sed | --verbose 'quoted text' /usr/bin
+awk x=1 /usr/bin "$1" sed -eu done then x=1 grep && 2>/dev/null
+	test grep -eu awk grep "$@" 2>/dev/null readonly cd /usr/bin
+$(pwd) export x=1 printf printf sed
+	2>/dev/null x=1 ${HOME} then | $(pwd) ${HOME} awk local "$@" --verbose export
+	-eu x=1 | test sed awk done done "$@" /usr/bin echo then "$1" then then
+grep /usr/bin 2>/dev/null "$@" x=1 readonly awk &&
+		-eu then readonly 'quoted text' cd $(pwd) readonly printf ${HOME} 'quoted text'
+		--verbose echo local done 'quoted text' /usr/bin --verbose test "$@"
+${HOME} echo $(pwd) export sed readonly
+done --verbose | grep "$@" awk export /usr/bin readonly --verbose
+	export printf sed readonly local -eu --verbose /usr/bin test -eu grep cd
+		--verbose "$1" printf grep local readonly
+&& ${HOME} ${HOME} then sed 'quoted text' -eu export local done 'quoted text' |
+		echo && readonly /usr/bin $(pwd) $(pwd) ${HOME} echo --verbose "$1" done
+/usr/bin local sed 'quoted text' readonly readonly /usr/bin done readonly | printf
+		cd | grep cd sed ${HOME} x=1 2>/dev/null grep grep cd readonly sed -eu
+		echo readonly | 2>/dev/null | 2>/dev/null 2>/dev/null
+	--verbose 2>/dev/null $(pwd) "$1" -eu awk cd 'quoted text' x=1
+		cd cd export "$@" "$@" echo done grep cd sed printf echo "$@"
+		&& grep awk | x=1 done test ${HOME} -eu $(pwd)
+		2>/dev/null && done $(pwd)
+2>/dev/null awk x=1 printf /usr/bin --verbose sed $(pwd)
+local printf echo echo
+'quoted text' export then then "$@" 2>/dev/null -eu -eu readonly
+	printf "$1" ${HOME} grep | 'quoted text' awk ${HOME} echo export
+		x=1 --verbose then readonly
+		/usr/bin sed x=1 export /usr/bin --verbose
+awk echo $(pwd) sed test 'quoted text' && -eu cd -eu grep local | done echo
+&& --verbose test "$@" ${HOME} export echo /usr/bin grep /usr/bin awk awk
+		-eu test then printf then 2>/dev/null "$@" done "$@" done 'quoted text'
+		'quoted text' awk test grep 'quoted text' 'quoted text' grep
+	then echo done done readonly | readonly then
+		x=1 done then cd -eu && echo
+	x=1 then --verbose ${HOME} cd echo 2>/dev/null grep
+		sed 'quoted text' test /usr/bin /usr/bin --verbose --verbose sed /usr/bin ${HOME}
+export test local printf awk cd grep /usr/bin && x=1 echo
+		awk | grep --verbose awk export test local awk then $(pwd) readonly x=1 $(pwd)
+test 'quoted text' then sed then grep local printf 2>/dev/null
+	"$@" 2>/dev/null "$@" test 2>/dev/null awk printf test ${HOME}
+		local | /usr/bin export x=1 then printf echo ${HOME} ${HOME} readonly
+/usr/bin export $(pwd) $(pwd) 2>/dev/null "$@" "$@"
+| then ${HOME} grep printf
+	x=1 local sed export export test
+grep 2>/dev/null test then 'quoted text'
+	x=1 $(pwd) /usr/bin done ${HOME} "$1" x=1 cd local local export "$@"
+done ${HOME} ${HOME} --verbose "$1" x=1 grep "$1" ${HOME} --verbose && cd
+	export --verbose "$@" sed 2>/dev/null
+grep done test 'quoted text' 'quoted text' echo echo |
+${HOME} test x=1 | /usr/bin ${HOME} then "$1" grep $(pwd)
+	readonly -eu test local -eu sed "$@" x=1 x=1 | then "$1"
+		${HOME} -eu local sed && -eu grep readonly then 2>/dev/null
+		x=1 'quoted text' printf $(pwd) printf
+	"$1" --verbose awk && sed echo local local 2>/dev/null
+		export then "$@" then
+$(pwd) then awk done printf printf
+		printf sed $(pwd) x=1 -eu "$1" grep -eu sed "$1" 2>/dev/null
+		--verbose && awk printf 'quoted text' printf cd -eu
+	$(pwd) sed "$@" /usr/bin export echo cd "$@" -eu 2>/dev/null "$1" $(pwd) test |
+"$@" x=1 'quoted text' 'quoted text' "$1" $(pwd) x=1 cd 2>/dev/null
+	awk awk 'quoted text' -eu ${HOME} echo
+test awk awk grep sed && cd
+	done cd $(pwd) sed ${HOME} cd sed then ${HOME} test 'quoted text'
+	cd && --verbose /usr/bin
+| awk then test "$@" echo test $(pwd) printf printf
+	awk then "$1" done test done 'quoted text'
+	"$1" /usr/bin printf test x=1 then | "$1" grep /usr/bin
+	$(pwd) "$1" echo 'quoted text' awk cd test && readonly "$@" ${HOME} then echo
+&& readonly "$@" test local local then done
+	done local readonly done /usr/bin awk -eu awk readonly 'quoted text'
+		x=1 "$@" --verbose | -eu readonly --verbose
+		2>/dev/null /usr/bin --verbose 'quoted text'
+	sed | export $(pwd) "$1" "$@" test 2>/dev/null local test "$1" export
+	--verbose 'quoted text' 2>/dev/null -eu readonly x=1 ${HOME}
+	/usr/bin printf done $(pwd) awk
+		printf "$@" sed done ${HOME} "$1" -eu && $(pwd) done cd local readonly
+		readonly test grep --verbose
+		"$1" | 'quoted text' "$@" 2>/dev/null echo sed 'quoted text'
+-eu grep printf "$1" echo -eu 'quoted text' echo "$1" printf ${HOME} local
+'quoted text' grep "$@" 2>/dev/null readonly echo "$@" awk &&
+		readonly echo export local test "$@" readonly
+		-eu echo done test echo export test then && 'quoted text' cd sed printf
+--verbose export then awk && | sed --verbose
+		sed 'quoted text' done readonly "$1" | $(pwd) sed sed
+		${HOME} awk export then export awk cd --verbose 'quoted text' printf x=1 |
+--verbose "$1" -eu /usr/bin && export x=1 -eu printf x=1 awk "$1" test
+	then x=1 x=1 cd --verbose done then x=1 && -eu
+echo test /usr/bin $(pwd) /usr/bin "$@" ${HOME} $(pwd) $(pwd) grep test grep then
+readonly "$1" -eu echo $(pwd)
+export test export -eu "$1" cd echo then cd | $(pwd)
+then cd test awk "$1" then "$1" "$@" awk cd local
+	cd --verbose -eu then cd --verbose "$@" readonly 'quoted text'
+	grep /usr/bin then 2>/dev/null readonly sed | export printf cd done
+		grep export 'quoted text' "$1" --verbose sed --verbose -eu "$@" readonly -eu 2>/dev/null
+local 'quoted text' test cd -eu then
+		&& | x=1 'quoted text' --verbose then export "$@" "$1" 'quoted text'
+		export x=1 | test grep -eu
+		| awk --verbose printf
+		$(pwd) /usr/bin sed test sed echo 2>/dev/null
+readonly 'quoted text' export "$1" ${HOME} grep | | x=1 cd printf
+	readonly readonly "$1" echo test /usr/bin "$@" done
+		done -eu -eu awk "$1" && test
+	sed local 'quoted text' "$1"
+		echo $(pwd) $(pwd) | readonly -eu test export
+		"$@" $(pwd) sed -eu done
+	sed | then then --verbose
+cd sed test && x=1 readonly "$@" -eu /usr/bin
+		/usr/bin local printf awk 2>/dev/null "$1" done sed $(pwd) cd | readonly && $(pwd)
+"$@" x=1 then /usr/bin done && local
+	local done awk test "$@" cd test /usr/bin printf echo
+		"$@" export test done 'quoted text'
+--verbose export test cd readonly
+$(pwd) readonly /usr/bin awk 'quoted text'
+	--verbose export then ${HOME} $(pwd) grep
+	cd 2>/dev/null | then cd printf 'quoted text'
+	echo test then ${HOME} x=1 'quoted text'
+		echo echo echo $(pwd) --verbose local done export | readonly cd 'quoted text' sed
+	x=1 --verbose awk 'quoted text' && | /usr/bin
+		printf grep 2>/dev/null done ${HOME} cd printf
+		x=1 printf $(pwd) "$@" && readonly "$@" local export cd
+sed 'quoted text' "$1" local 2>/dev/null 'quoted text' local /usr/bin ${HOME}
+echo $(pwd) x=1 echo && cd local grep test local -eu 'quoted text' /usr/bin
+echo "$@" 'quoted text' && grep "$@" "$1" done ${HOME} then
+		local printf grep | sed
+test "$1" ${HOME} local /usr/bin "$@" 2>/dev/null
+sed -eu $(pwd) "$1" then awk 'quoted text' 2>/dev/null ${HOME}
+readonly -eu readonly -eu 'quoted text' 'quoted text' grep cd grep
+		then grep $(pwd) then 'quoted text' "$@" --verbose | 2>/dev/null
+/usr/bin grep printf printf --verbose /usr/bin x=1 cd "$1" printf cd 2>/dev/null
+		"$@" local done "$1" "$@" /usr/bin
+| -eu export awk export | | 2>/dev/null
+	cd awk $(pwd) echo "$@" echo done echo ${HOME} x=1 done -eu "$1"
+		grep "$@" $(pwd) sed 2>/dev/null | test
+	cd sed export -eu -eu done printf cd grep ${HOME} x=1 2>/dev/null
+${HOME} && && awk then readonly awk && sed ${HOME} sed $(pwd) sed grep
+	sed export done "$1" export grep then
+&& x=1 -eu sed && $(pwd)
+	"$1" export ${HOME} printf | then awk /usr/bin --verbose awk | done sed x=1
+	2>/dev/null sed "$@" -eu export ${HOME} | | grep 2>/dev/null
+	grep && then sed 'quoted text'
+x=1 awk $(pwd) done test ${HOME} printf printf cd "$@" sed test
+	2>/dev/null grep && $(pwd) grep -eu ${HOME} local &&
+		done ${HOME} test --verbose printf ${HOME} /usr/bin
+--verbose /usr/bin 2>/dev/null sed test ${HOME} readonly "$1" && 'quoted text'
+	sed -eu grep export "$1" 'quoted text' $(pwd) "$@" 2>/dev/null test
+readonly echo then ${HOME} then -eu x=1 then grep -eu echo
+awk "$1" readonly grep echo
+cd local then export test
+		--verbose awk awk grep | echo &&
+cd printf then | "$1" --verbose readonly "$@" "$@" ${HOME} then /usr/bin
+		/usr/bin cd $(pwd) $(pwd)
+test export grep /usr/bin x=1 "$@" cd $(pwd) printf awk sed cd done grep done
+	sed awk test "$1" readonly echo test && && "$1" awk "$@" 'quoted text' awk test
+		then --verbose -eu then echo 'quoted text' && /usr/bin
+		'quoted text' grep export | echo printf grep local && printf readonly grep awk
+		&& && test "$@" grep then sed printf --verbose local && readonly x=1
+		printf $(pwd) export printf test | grep
+"$@" echo grep echo ${HOME} awk export $(pwd) ${HOME} $(pwd) | $(pwd) grep
+	test grep done /usr/bin -eu $(pwd) &&
+'quoted text' echo -eu awk printf readonly echo echo local test "$1" "$1" local
+"$@" && echo export echo
+echo "$1" cd grep 2>/dev/null readonly 2>/dev/null
+		&& grep then "$1" then echo export --verbose | done "$1" local
+		| 2>/dev/null test ${HOME} -eu readonly -eu "$1" cd local readonly cd $(pwd) then
+printf readonly local x=1 | $(pwd) && -eu printf
+"$1" then test "$1" done 2>/dev/null
+grep done test | /usr/bin | &&
+$(pwd) | then readonly test sed
+		"$@" 2>/dev/null readonly 'quoted text' $(pwd) local done /usr/bin
+		cd 2>/dev/null readonly export | printf x=1 'quoted text' | /usr/bin --verbose
+		'quoted text' export done cd
+		"$1" readonly echo awk "$@" printf
+	"$@" x=1 local cd --verbose echo readonly
+	x=1 test test local test then printf $(pwd) local
+		awk local 'quoted text' $(pwd) echo local done grep /usr/bin awk printf
+	test "$@" readonly 'quoted text' --verbose | --verbose | grep grep export
+		/usr/bin x=1 cd 2>/dev/null awk sed --verbose --verbose --verbose test
+'quoted text' && test x=1 'quoted text' "$@" |
+x=1 done test | test "$1" done 2>/dev/null
+"$1" echo grep $(pwd) awk grep | 'quoted text' "$1" cd done sed ${HOME} "$@"
+		echo ${HOME} local 'quoted text' echo -eu /usr/bin x=1 'quoted text' "$@"
+	then -eu then --verbose "$@" printf x=1 "$1" 2>/dev/null
+		--verbose awk test "$@" grep $(pwd) sed ${HOME}
+		awk /usr/bin ${HOME} grep "$1" -eu grep done 2>/dev/null awk then then --verbose
+	sed && 'quoted text' "$@" && then local x=1 local
+		"$1" grep grep 2>/dev/null export | readonly -eu local cd 'quoted text' grep $(pwd)
+		${HOME} awk x=1 grep local "$@"
+done | | cd export export then echo echo x=1 printf "$@" sed | /usr/bin
+	/usr/bin then printf "$@" local cd readonly then | local local printf "$@"
+-eu readonly echo /usr/bin
+		cd readonly local "$1" done export export -eu printf
+readonly 'quoted text' 'quoted text' echo 'quoted text' "$1" | awk $(pwd)
+sed then | printf done sed printf cd cd 2>/dev/null awk
+test | sed then echo grep 'quoted text'
+		2>/dev/null /usr/bin done test export
+		"$@" | test sed --verbose ${HOME}
+	cd echo test grep "$@" "$1" x=1 $(pwd) grep cd
+2>/dev/null echo printf grep $(pwd) export echo "$1" "$1" sed
+export echo echo 2>/dev/null -eu | export 'quoted text' test x=1
+		sed && x=1 ${HOME} then "$@" /usr/bin sed export local | cd awk cd echo readonly
+		awk && test "$@" 'quoted text' done --verbose done local done /usr/bin cd /usr/bin
+		readonly test -eu 'quoted text' "$1" x=1 awk $(pwd)
+printf grep "$1" test local ${HOME} export $(pwd) | &&
+	| $(pwd) then cd --verbose 2>/dev/null
+"$@" export grep "$@" readonly /usr/bin ${HOME} readonly && -eu ${HOME}
+		"$1" grep test && test awk then --verbose awk "$1" 2>/dev/null
+awk 2>/dev/null && test "$1" /usr/bin sed 'quoted text' echo &&
+	&& cd --verbose local done "$1" done local /usr/bin
+		${HOME} $(pwd) "$1" $(pwd) sed grep 'quoted text' "$@" && x=1 x=1
+		$(pwd) grep "$@" done $(pwd) /usr/bin
+/usr/bin $(pwd) $(pwd) 2>/dev/null then && "$1"
+then readonly done "$@" grep /usr/bin 2>/dev/null grep readonly $(pwd)
+		"$@" -eu cd x=1 "$@" -eu local grep --verbose "$@" | ${HOME} readonly $(pwd)
+	readonly awk sed readonly done 2>/dev/null
+	cd export ${HOME} readonly ${HOME} echo ${HOME} --verbose printf local -eu
+	--verbose 2>/dev/null local test ${HOME} printf
+	local echo test cd then &&
+echo export cd | --verbose sed cd ${HOME}
+export ${HOME} | echo then export
+		local sed | ${HOME} printf 'quoted text' ${HOME} readonly "$@" echo $(pwd) test
+		&& ${HOME} readonly export printf /usr/bin ${HOME} done then -eu
+		/usr/bin test /usr/bin -eu -eu | x=1 x=1 "$@" 2>/dev/null
+test && "$@" done /usr/bin "$1" test readonly "$@" local x=1 echo export --verbose
+	echo grep | $(pwd) echo -eu sed test 'quoted text' test echo export awk test --verbose
+export -eu | /usr/bin echo test "$@" 'quoted text' export awk
+-eu local sed export done
+		/usr/bin 2>/dev/null local export $(pwd) "$@" printf cd local "$1" ${HOME}
+sed "$@" then test then awk
+		x=1 readonly 'quoted text' echo x=1
+${HOME} 'quoted text' --verbose
+	"$1" cd grep -eu awk export printf --verbose export test
+	export /usr/bin 'quoted text' grep then /usr/bin
+	cd done export printf "$@" && grep "$1" -eu then
+2>/dev/null cd sed 2>/dev/null test /usr/bin
+		awk echo done | sed ${HOME} local done | && ${HOME}
+printf && x=1 "$1" test && readonly | /usr/bin awk sed "$1" x=1
+	awk 'quoted text' echo /usr/bin cd /usr/bin --verbose
+echo x=1 "$1" "$1" /usr/bin ${HOME} done printf ${HOME} awk x=1 /usr/bin
+		-eu 'quoted text' | && 'quoted text' cd -eu |
+then local && local "$1" export grep -eu --verbose 'quoted text' ${HOME} 2>/dev/null
+export && && && "$1" cd
+	"$@" && export done awk x=1 grep x=1
+		/usr/bin "$@" --verbose -eu sed cd x=1 echo "$1" done test /usr/bin | printf 'quoted text'
+| cd "$@" ${HOME} printf done "$1" echo
+	sed x=1 ${HOME} 2>/dev/null export 'quoted text' "$@" && printf $(pwd)
+		export | x=1 local -eu "$@" cd ${HOME} test then -eu 'quoted text'
+		local done done test grep sed cd "$@" | | done awk awk
+done export 'quoted text' test --verbose
+cd | ${HOME} test readonly "$1" $(pwd)
+		then done echo grep "$@" printf grep
+		export sed sed done grep -eu readonly
+local | "$1" then /usr/bin then 2>/dev/null
+	-eu ${HOME} readonly awk readonly "$@" --verbose -eu test 2>/dev/null
+		x=1 $(pwd) /usr/bin test "$1" local $(pwd) grep "$@" -eu $(pwd) printf sed
+	export /usr/bin printf -eu "$@" x=1 'quoted text' "$1" $(pwd) 'quoted text'
+	test grep then export && | --verbose "$@" sed
+	/usr/bin awk export ${HOME} ${HOME} done /usr/bin
+	done printf ${HOME} echo x=1 'quoted text'
+	done $(pwd) $(pwd) local then printf x=1 && done
+-eu "$@" cd $(pwd) | 2>/dev/null
+x=1 --verbose x=1 2>/dev/null
+	'quoted text' sed cd 2>/dev/null test ${HOME} -eu x=1 done test local sed ${HOME}
+"$1" "$1" printf "$@" export export --verbose echo --verbose
+	2>/dev/null 2>/dev/null test "$1" 2>/dev/null sed done
+	${HOME} | done done $(pwd)
+		2>/dev/null test awk 'quoted text'
+	printf 'quoted text' && awk then readonly -eu "$@" test printf done
+		done 2>/dev/null ${HOME} then -eu -eu grep $(pwd) "$@" && done | && grep sed
+	echo ${HOME} && printf x=1
+	&& "$@" cd echo export | --verbose echo local && echo
+-eu ${HOME} readonly echo local "$1" --verbose x=1 test printf
+		${HOME} then echo echo local "$1" grep /usr/bin
+/usr/bin done readonly export echo | done | test sed $(pwd)
+sed then && -eu && local grep readonly
+${HOME} local "$@" | x=1 $(pwd) "$@" awk test awk done test &&
+	readonly export 2>/dev/null $(pwd)
+		readonly 2>/dev/null | && cd /usr/bin printf local
+	local 'quoted text' test | sed 2>/dev/null x=1 readonly
+		x=1 "$1" local 2>/dev/null awk x=1 readonly "$1" printf cd test x=1 local --verbose
+		then "$@" export then printf 2>/dev/null
+		then --verbose echo x=1 grep printf $(pwd) 2>/dev/null local ${HOME} /usr/bin
+grep x=1 then ${HOME} 'quoted text' echo $(pwd) -eu grep then local done 'quoted text'
+done 'quoted text' grep 2>/dev/null
+		grep grep && awk && readonly | x=1 &&
+	/usr/bin test "$@" x=1
+"$@" awk cd | local "$1" then --verbose $(pwd) done 'quoted text' echo /usr/bin
+done export /usr/bin cd grep readonly 'quoted text' x=1
+	&& /usr/bin 2>/dev/null | readonly
+	'quoted text' echo x=1 export | -eu test -eu --verbose
+		export grep x=1 && --verbose readonly
+x=1 then -eu echo then local && sed x=1 "$1"
+		| /usr/bin test 2>/dev/null ${HOME}
+		&& 2>/dev/null "$@" grep && export cd 'quoted text'
+		&& readonly --verbose -eu ${HOME} ${HOME} awk awk printf readonly grep
+2>/dev/null && then awk readonly grep sed sed readonly
+${HOME} sed /usr/bin ${HOME} grep
+		--verbose sed /usr/bin | "$1" echo printf $(pwd) "$1" grep test awk
+	x=1 test export "$1" | x=1 awk then awk sed /usr/bin 2>/dev/null "$@"
+	'quoted text' awk printf readonly echo "$1" && 2>/dev/null
+&& test local "$1" test grep export readonly sed
+		x=1 "$@" 'quoted text' awk | -eu "$@" "$@" sed 2>/dev/null grep
+		done test echo -eu sed 'quoted text' then awk "$@" "$1" sed "$1" done
+		export && "$@" test awk test --verbose printf
+	2>/dev/null test $(pwd) "$1" awk | grep readonly local
+		--verbose /usr/bin then awk done readonly local 'quoted text' local
+		"$@" grep -eu "$@" export then
+	/usr/bin ${HOME} local echo "$@" ${HOME} ${HOME} $(pwd)
+	export 'quoted text' | printf local "$1" echo x=1 ${HOME} local echo done local
+	grep && 'quoted text' echo $(pwd) export then test ${HOME}
+	/usr/bin && ${HOME} -eu export then --verbose
+	printf 'quoted text' export --verbose cd sed local "$@" ${HOME} test
+		echo grep grep readonly "$@" awk local echo grep export
+local ${HOME} local printf --verbose -eu ${HOME} test local x=1 --verbose
+		local done --verbose cd readonly grep --verbose cd "$1" x=1 echo cd
+	${HOME} $(pwd) 'quoted text' printf
+grep then "$1" x=1 test awk | --verbose
+/usr/bin then -eu awk
+x=1 sed | && test echo x=1 2>/dev/null -eu printf --verbose then done
+		awk grep -eu && test 2>/dev/null grep cd | readonly
+	'quoted text' local ${HOME} cd "$@" echo cd sed cd
+	"$@" readonly readonly ${HOME}
+	${HOME} then cd test done awk test printf $(pwd)
+	awk | awk 2>/dev/null "$1" -eu && done 2>/dev/null sed /usr/bin grep
+awk export done test | echo export -eu ${HOME} printf done
+		"$1" --verbose cd awk printf
+	"$@" ${HOME} done readonly done "$1" --verbose ${HOME}
+${HOME} --verbose $(pwd)
+| && test test readonly x=1 cd 2>/dev/null && && sed grep done && local awk
+-eu grep --verbose 'quoted text' && --verbose readonly
+then echo "$1" "$@" ${HOME} x=1 local -eu
+	printf grep x=1 local local "$1" done done -eu then done printf done /usr/bin
+		echo /usr/bin -eu 'quoted text' $(pwd) | | then local
+echo cd done "$1" then $(pwd) export sed && $(pwd) cd "$@" done
+		export && cd local local "$@" | done sed then awk awk 2>/dev/null -eu $(pwd)
+'quoted text' printf
+	sed x=1 "$1" then -eu test /usr/bin 2>/dev/null
+	local test | test echo then && grep x=1 2>/dev/null done grep grep awk test
+	test cd then "$@" -eu local local "$1" done 'quoted text'
+cd awk x=1 readonly $(pwd) x=1 "$1" /usr/bin -eu grep awk local
+	awk sed readonly 'quoted text' && local cd done | done awk
+		done then echo $(pwd) grep 'quoted text' local $(pwd)
+	$(pwd) then x=1 echo 'quoted text' --verbose 2>/dev/null
+	"$@" test -eu printf cd --verbose -eu "$1" $(pwd) /usr/bin
+	done grep ${HOME} sed readonly /usr/bin /usr/bin printf x=1 -eu "$@"
+	$(pwd) test readonly printf awk 'quoted text' sed -eu x=1
+		test -eu readonly test x=1
+/usr/bin done export $(pwd) printf
+readonly && | | local /usr/bin -eu ${HOME} $(pwd) --verbose
+	awk "$@" export printf /usr/bin 2>/dev/null --verbose local
+	"$@" && x=1 local "$1" done "$@" x=1 cd then --verbose then
+		${HOME} --verbose readonly test echo --verbose 'quoted text' -eu
+		awk test && /usr/bin /usr/bin cd readonly ${HOME}
+		2>/dev/null | cd /usr/bin cd /usr/bin ${HOME}
+		'quoted text' awk 2>/dev/null then x=1 $(pwd) printf -eu
+then local -eu && sed $(pwd) done awk sed $(pwd) | readonly 'quoted text'
+	2>/dev/null -eu local printf export /usr/bin | "$@" export && x=1 done test
+	then 2>/dev/null printf x=1 2>/dev/null
+echo local 2>/dev/null --verbose 2>/dev/null cd sed
+		--verbose test "$1" awk /usr/bin
+x=1 ${HOME} sed x=1 "$@" /usr/bin
+	then 'quoted text' "$1" test /usr/bin
+	export grep then grep done readonly test
+printf && readonly sed x=1 'quoted text' -eu cd
+	x=1 | then grep && | test grep export
+	| awk && "$@" printf test echo | /usr/bin echo 'quoted text' local
+	"$@" && x=1 2>/dev/null --verbose export sed sed awk x=1 'quoted text'
+| then ${HOME} readonly sed --verbose test then "$1" echo | sed $(pwd)
+then export grep export grep --verbose /usr/bin grep --verbose
+	grep sed && 2>/dev/null readonly 'quoted text' awk 'quoted text' /usr/bin
+	cd 2>/dev/null | x=1 grep done | awk local sed
+	grep --verbose export $(pwd) /usr/bin "$@" $(pwd)
+"$@" echo /usr/bin ${HOME} "$1" then sed ${HOME}
+	echo printf "$1" echo --verbose $(pwd) readonly
+&& "$1" 'quoted text' -eu | 2>/dev/null sed "$1" && printf
+echo -eu cd export grep --verbose x=1 then | cd $(pwd) cd grep
+		x=1 echo && echo done echo | && /usr/bin done cd --verbose $(pwd)
+		/usr/bin 2>/dev/null $(pwd) "$@" grep then
+		x=1 echo done local local ${HOME} --verbose /usr/bin -eu
+		$(pwd) test "$@" && "$@" local ${HOME}
+	'quoted text' readonly -eu 2>/dev/null -eu sed then /usr/bin
+		test cd -eu cd $(pwd) --verbose -eu /usr/bin
+	x=1 grep sed ${HOME} done x=1 local "$1" && "$1" x=1
+		export grep | printf test -eu then cd ${HOME} /usr/bin | readonly
+	x=1 test -eu then then --verbose local readonly cd "$1" 2>/dev/null then
+		test done && then readonly cd --verbose cd "$1" "$@"
+--verbose grep local 'quoted text' then awk x=1 $(pwd) grep 2>/dev/null ${HOME}
+	readonly echo --verbose $(pwd) then $(pwd) sed --verbose grep --verbose
+	&& local cd printf done /usr/bin grep -eu cd cd /usr/bin
+	readonly "$@" cd $(pwd) printf "$1" test printf 'quoted text'
+test -eu export "$@" --verbose done printf printf /usr/bin sed awk
+-eu --verbose then sed -eu "$1" local
+	sed /usr/bin /usr/bin
+	printf echo --verbose -eu sed "$@"
+	| /usr/bin sed /usr/bin echo
+"$@" --verbose 2>/dev/null "$@" -eu then && "$@" "$1"
+	--verbose "$@" -eu | x=1 | | export echo printf "$1" ${HOME} local "$1" printf
+-eu | then 2>/dev/null done cd grep printf --verbose export "$1" 'quoted text'
+/usr/bin ${HOME} /usr/bin test echo echo awk local printf test
+then | awk $(pwd) cd then "$1" echo readonly -eu echo cd 2>/dev/null grep --verbose
+	--verbose local grep x=1 /usr/bin /usr/bin then "$1" sed ${HOME} "$1" grep
+-eu sed -eu ${HOME} 'quoted text' cd "$1" done awk -eu ${HOME} local 2>/dev/null
+		&& cd && -eu awk x=1 printf sed 2>/dev/null awk ${HOME} "$1" --verbose
+	"$@" 2>/dev/null echo /usr/bin then
+awk 2>/dev/null then local cd grep sed && sed "$1" echo 'quoted text'
+	then readonly awk /usr/bin sed done ${HOME} "$1" 2>/dev/null ${HOME} ${HOME}
+	&& grep | "$1" awk echo awk && local grep x=1 test then "$@" then ${HOME}
+'quoted text' export ${HOME} /usr/bin &&
+'quoted text' printf echo export local printf export | && -eu "$@" done --verbose
+| "$1" awk awk /usr/bin "$1"
+		awk 2>/dev/null -eu then "$@" done then /usr/bin $(pwd) export sed local
+	done "$@" sed 2>/dev/null cd done local -eu && $(pwd) | local $(pwd)
+		2>/dev/null test echo awk done echo 'quoted text' sed
+'quoted text' "$@" grep $(pwd)
+	"$@" --verbose local awk | done done cd readonly 2>/dev/null "$@" done
+printf sed "$@" && echo ${HOME} export
+		x=1 cd awk awk ${HOME} ${HOME} grep then /usr/bin 2>/dev/null printf
+		cd printf echo cd readonly echo export awk x=1 $(pwd) "$@" 'quoted text'
+	/usr/bin awk echo && awk
+	&& echo then printf && && "$@" cd sed test cd 2>/dev/null awk $(pwd) | ${HOME}
+		then 'quoted text' $(pwd) ${HOME} "$1" "$1" then "$@" printf $(pwd)
+	export printf awk local export sed "$1" awk readonly grep grep 2>/dev/null
+"$1" | "$1" test test $(pwd)
+awk -eu x=1 printf local -eu echo "$1" echo "$1" echo "$@" sed "$1"
+		printf 2>/dev/null printf "$@"
+-eu done "$1" x=1 "$1" "$@" --verbose grep "$@" --verbose
+	echo readonly printf cd -eu sed | local echo printf cd then done
+	readonly done printf grep
+	${HOME} then 2>/dev/null
+	"$1" sed | sed -eu cd export
+then $(pwd) 'quoted text' echo
+	/usr/bin ${HOME} $(pwd) --verbose "$1" cd test && | "$@" echo cd
+readonly | "$@" -eu then done "$1" --verbose
+	echo -eu $(pwd) 'quoted text' then echo
+sed ${HOME} grep sed cd 'quoted text' /usr/bin -eu echo local printf export
+sed 'quoted text' then
+		$(pwd) local sed export | --verbose
+readonly /usr/bin export /usr/bin -eu | 2>/dev/null && x=1 printf ${HOME}
+test && readonly --verbose --verbose --verbose
+		| "$1" 'quoted text' cd --verbose local awk $(pwd) | cd ${HOME} grep
+		done && echo 2>/dev/null ${HOME}
+		cd printf | ${HOME} local local
+sed local | readonly local
+2>/dev/null && x=1 x=1 $(pwd) | readonly x=1
+		2>/dev/null test export 'quoted text' | ${HOME} then
+	--verbose test "$@" | readonly -eu done cd grep local -eu export
+$(pwd) cd echo printf cd /usr/bin 2>/dev/null
+"$@" && x=1 ${HOME} printf | ${HOME} cd x=1 -eu
+		printf "$@" export /usr/bin 'quoted text' grep test sed
+	cd then grep readonly test then /usr/bin && | local
+	sed $(pwd) awk && | awk "$@" then awk export "$@" -eu -eu grep |
+		test --verbose "$1" "$1" echo ${HOME} && export done test
+	echo 2>/dev/null grep --verbose && /usr/bin awk readonly
+	local grep | sed then printf then test awk test printf ${HOME}
+	awk "$@" | sed "$1" export x=1 printf | ${HOME} export
+		awk cd 'quoted text' readonly test grep readonly awk
+	grep grep grep sed x=1 grep grep test
+&& 'quoted text' 2>/dev/null export readonly "$1" 2>/dev/null
+$(pwd) ${HOME} && &&
+x=1 && --verbose readonly awk readonly "$@" grep grep done done
+"$@" cd then /usr/bin 'quoted text' 2>/dev/null
+printf then sed ${HOME} /usr/bin | test "$1" ${HOME} local -eu 'quoted text'
+local then 2>/dev/null readonly
+| cd "$@" cd x=1 x=1 --verbose awk then echo --verbose export readonly
+		"$1" test 2>/dev/null "$@"
+sed done --verbose ${HOME} 2>/dev/null
+echo x=1 readonly sed x=1 readonly "$1" x=1
+/usr/bin then export | 'quoted text' ${HOME} cd done export export sed &&
+	--verbose | export "$@" test
+	test | readonly --verbose -eu 2>/dev/null &&
+'quoted text' done 2>/dev/null echo local 'quoted text' --verbose "$@"
+	grep | $(pwd) $(pwd) done then 'quoted text'
+		printf grep local export
+		done "$1" $(pwd) echo --verbose then readonly printf export printf cd --verbose
+		&& then then --verbose "$1" $(pwd)
+/usr/bin grep --verbose ${HOME} -eu $(pwd)
+	readonly sed test /usr/bin echo 2>/dev/null -eu "$@" $(pwd)
+	then | --verbose then --verbose awk --verbose
+	'quoted text' printf /usr/bin then "$1" sed $(pwd) ${HOME} test awk
+		cd sed "$@" --verbose
+		x=1 then "$@" export x=1 | printf then
+		done "$1" printf $(pwd) /usr/bin "$@" export 2>/dev/null -eu $(pwd) /usr/bin ${HOME}
+| 'quoted text' ${HOME} "$@" x=1 /usr/bin -eu
+		"$@" test test local ${HOME} --verbose x=1 done test cd echo local done |
+--verbose grep -eu x=1 local "$1" "$@" readonly
+		printf $(pwd) printf -eu local && "$1" /usr/bin cd -eu /usr/bin && 'quoted text'
+done printf readonly
+	-eu then $(pwd) ${HOME}
+2>/dev/null echo then /usr/bin $(pwd) echo done
+--verbose -eu then readonly
+local | --verbose ${HOME} ${HOME} then | grep done "$@"
+	/usr/bin --verbose printf "$@"
+	| --verbose readonly "$@"
+		"$@" test | && done awk 'quoted text' then x=1
+	cd cd sed && test export $(pwd) then export cd "$@" /usr/bin
+		echo grep cd test test export readonly --verbose ${HOME} ${HOME} readonly "$1"
+		readonly sed awk readonly printf 2>/dev/null awk | grep local $(pwd) /usr/bin
+		$(pwd) "$1" && grep $(pwd)
+		grep 2>/dev/null x=1 "$1" awk -eu ${HOME} grep | echo cd 2>/dev/null readonly
+"$@" then /usr/bin -eu export cd then 2>/dev/null "$1" -eu "$@" then ${HOME} printf
+	local local cd then export
+	${HOME} $(pwd) /usr/bin test sed local then x=1 | && readonly awk "$@"
+		cd "$@" cd x=1 readonly awk cd 'quoted text' 2>/dev/null /usr/bin
+		"$1" $(pwd) grep sed awk "$1" readonly 'quoted text'
+		done 2>/dev/null sed /usr/bin export test 2>/dev/null
+	sed test echo /usr/bin $(pwd) awk local echo 2>/dev/null
+		'quoted text' awk --verbose
+	| 'quoted text' /usr/bin local local echo grep "$@" echo $(pwd)
+	echo local awk "$1" printf --verbose local && done done done echo readonly grep
+export local export sed &&
+2>/dev/null local printf "$1" printf $(pwd) readonly
+		then readonly then "$1" readonly --verbose
+	cd printf | then grep then $(pwd) 'quoted text' --verbose /usr/bin test done
+		test local && /usr/bin export cd 2>/dev/null --verbose readonly
+		"$1" "$@" cd export test x=1 echo grep local then -eu awk 'quoted text' awk
+		"$@" 'quoted text' 'quoted text' then /usr/bin "$1" printf "$@" && local then
+		--verbose "$1" x=1 2>/dev/null --verbose 'quoted text' --verbose
+readonly sed readonly 2>/dev/null --verbose "$1" done "$@"
+		/usr/bin | test $(pwd) cd $(pwd) done awk | grep 2>/dev/null done done x=1
+	local "$1" | local --verbose awk echo grep cd local /usr/bin awk | "$@" readonly
+		cd awk then "$1" --verbose 'quoted text' x=1 local readonly
+		x=1 "$1" sed ${HOME} export
+		test $(pwd) | ${HOME} export cd test then awk "$@" x=1 $(pwd)
+test --verbose | 2>/dev/null x=1 "$@" -eu readonly
+then | cd 'quoted text' then then done export then awk && --verbose cd done grep
+	-eu sed ${HOME} grep cd ${HOME} | readonly $(pwd) ${HOME} export $(pwd) | awk
+	-eu | done /usr/bin awk 'quoted text'
+		printf cd $(pwd) | readonly --verbose 'quoted text'
+		then --verbose done --verbose
+	2>/dev/null | echo test | 2>/dev/null |
+	export echo grep -eu --verbose /usr/bin
+		then then grep export cd echo x=1 grep readonly
+	echo "$1" awk --verbose 'quoted text' test readonly
+	export x=1 $(pwd) echo "$1" /usr/bin
+	echo local && $(pwd) ${HOME} 2>/dev/null x=1 /usr/bin | 2>/dev/null 'quoted text'
+	x=1 $(pwd) /usr/bin "$1" && printf echo echo then then -eu
+'quoted text' export --verbose --verbose
+	"$@" -eu test ${HOME} 'quoted text' printf
+| "$@" 2>/dev/null echo | | grep export
+		x=1 done awk /usr/bin --verbose test readonly export $(pwd) echo -eu readonly
+		--verbose && /usr/bin "$1" && grep then x=1 export done readonly &&
+	printf grep cd readonly
+	echo test -eu cd cd $(pwd) done 2>/dev/null --verbose
+		echo /usr/bin /usr/bin printf cd export
+		2>/dev/null test "$1" | x=1 printf "$1" cd export
+	/usr/bin printf $(pwd) cd
+"$1" done cd ${HOME} readonly
+	$(pwd) "$1" grep "$1" printf printf test cd printf && grep
+sed sed | awk printf echo sed "$@" x=1 then awk | -eu
+		sed cd 'quoted text' cd printf printf test echo export ${HOME} test 'quoted text'
+	'quoted text' readonly echo readonly /usr/bin readonly readonly $(pwd) grep
+| sed $(pwd) echo local 2>/dev/null -eu awk "$1" done test --verbose then
+	$(pwd) /usr/bin awk sed /usr/bin done test
+		x=1 echo grep printf x=1 done 'quoted text'
+		done sed awk printf echo ${HOME} 'quoted text'
+/usr/bin -eu sed $(pwd) export
+test sed local 'quoted text' then awk echo echo local
+	export x=1 2>/dev/null readonly printf awk $(pwd) ${HOME} echo 'quoted text'
+printf 2>/dev/null | grep
+	echo "$@" done then "$1" $(pwd) ${HOME} /usr/bin sed
+		grep cd && | test ${HOME} 'quoted text'
+		2>/dev/null readonly 2>/dev/null done grep printf | && test cd &&
+done 2>/dev/null local $(pwd) -eu
+	sed then cd done "$@" then -eu then local /usr/bin 'quoted text' readonly
+		$(pwd) "$@" local "$1"
+	test | $(pwd) then sed && $(pwd) local --verbose 2>/dev/null -eu readonly
+test -eu | then x=1 grep "$@" /usr/bin
+	--verbose "$1" --verbose 2>/dev/null local $(pwd) x=1
+	$(pwd) done cd echo done ${HOME}
+		| "$@" grep -eu test /usr/bin -eu $(pwd)
+	$(pwd) local sed && 2>/dev/null /usr/bin test awk then cd | awk 'quoted text'
+printf 'quoted text' x=1 "$@" ${HOME} -eu done test /usr/bin awk cd "$1"
+	| readonly then | --verbose --verbose echo cd 'quoted text' printf
+	readonly awk --verbose test then printf
+	printf x=1 x=1 export "$@" ${HOME} "$1" && echo x=1 /usr/bin
+${HOME} -eu test --verbose 'quoted text' echo ${HOME} --verbose sed echo
+		x=1 grep "$1" $(pwd) sed then $(pwd) awk sed | 2>/dev/null && 2>/dev/null
+		--verbose readonly then
+		'quoted text' x=1 cd echo 'quoted text' | ${HOME} local
+	echo done printf cd sed echo printf ${HOME} 'quoted text' "$@" awk test -eu /usr/bin
+	"$1" -eu /usr/bin test grep $(pwd) "$1" cd
+		readonly readonly done printf -eu grep
+test awk x=1 export && printf local printf $(pwd)
+		$(pwd) export then x=1 --verbose
+"$@" export awk grep then printf --verbose sed test done test
+		--verbose echo 2>/dev/null printf 2>/dev/null
+sed --verbose $(pwd) "$@" -eu grep && 'quoted text' cd --verbose x=1 | /usr/bin
+		awk x=1 grep /usr/bin 2>/dev/null "$@" | cd $(pwd)
+	"$1" --verbose 'quoted text' "$@" cd | | sed cd 'quoted text'
+		cd && cd test done -eu ${HOME} && 2>/dev/null local cd printf echo
+x=1 test then 2>/dev/null echo /usr/bin x=1 grep echo -eu echo 2>/dev/null ${HOME}
+	printf -eu grep sed x=1 cd "$@" sed test /usr/bin awk test | cd export
+export "$@" -eu cd echo done "$@" sed echo x=1 test
+'quoted text' "$@" done 2>/dev/null
+| 2>/dev/null && -eu $(pwd) 2>/dev/null printf echo
+	test grep cd ${HOME} printf "$1" printf "$@" $(pwd)
+		"$@" printf /usr/bin "$@" awk --verbose printf x=1 ${HOME} local "$@" readonly
+	done grep 2>/dev/null local
+		| readonly ${HOME} done local done
+	| x=1 'quoted text' echo cd 'quoted text'
+export printf cd -eu --verbose then 2>/dev/null ${HOME} $(pwd) -eu local then &&
+awk /usr/bin x=1 cd -eu /usr/bin cd sed x=1 "$@" cd
+		-eu cd awk "$1" -eu /usr/bin 'quoted text' readonly "$@" printf x=1 | 'quoted text'
+	export 'quoted text' x=1 printf x=1 'quoted text' 'quoted text'
+		--verbose | done -eu "$@" && /usr/bin
+	"$@" grep local awk cd && $(pwd) && x=1 $(pwd) local
+/usr/bin && cd sed export
+${HOME} "$@" "$@" readonly sed awk 'quoted text' ${HOME} 'quoted text'
+	$(pwd) printf /usr/bin -eu echo cd printf test x=1 readonly
+		"$@" 'quoted text' then grep 'quoted text' sed
+		local done 'quoted text' printf x=1 ${HOME} "$@"
+2>/dev/null awk 'quoted text' grep
+	&& 2>/dev/null /usr/bin "$@"
+	"$@" 'quoted text' done --verbose && cd grep printf
+awk ${HOME} export local -eu $(pwd) echo printf -eu 'quoted text' echo sed
+		--verbose /usr/bin cd $(pwd)
+	then export then $(pwd) awk echo && echo
+		x=1 sed sed export | grep local test $(pwd) 2>/dev/null
+	${HOME} export | done test export readonly done /usr/bin
+		| cd | done cd 'quoted text' /usr/bin done /usr/bin done ${HOME}
+	"$1" awk "$1" echo "$@" $(pwd)
+	printf test awk test awk
+${HOME} x=1 sed test $(pwd) x=1 'quoted text'
+'quoted text' cd 'quoted text' $(pwd) then ${HOME}
+		&& awk local test | export grep done x=1 test done test awk | export
+	local awk printf cd && grep "$@" x=1 then awk done sed awk grep
+awk $(pwd) done echo grep then grep readonly echo
+local | then /usr/bin "$1" -eu local test --verbose 'quoted text' &&
+	'quoted text' x=1 | echo
+	cd echo test cd test export echo readonly ${HOME} "$1"
+		$(pwd) /usr/bin awk printf -eu -eu export "$@" x=1 "$@" -eu
+sed && export then /usr/bin echo done "$@" $(pwd) export echo readonly
+	-eu then $(pwd) readonly "$@" $(pwd) ${HOME} "$@" && 'quoted text' && /usr/bin
+	then 2>/dev/null then x=1 done done
+	done local then echo done grep readonly "$@" --verbose -eu
+${HOME} grep export test echo printf | /usr/bin
+		test local x=1 awk sed test awk then x=1 --verbose printf
+		readonly 'quoted text' /usr/bin | done
+	-eu done echo then test -eu cd readonly then then then grep
+	'quoted text' cd local "$1" sed awk "$@" /usr/bin echo readonly done -eu export
+	'quoted text' awk x=1 "$@"
+	sed printf then x=1 then $(pwd)
+	echo printf echo done | test ${HOME} printf
+	sed 'quoted text' sed test x=1 --verbose /usr/bin 2>/dev/null $(pwd)
+		printf $(pwd) awk -eu ${HOME} test "$1" 'quoted text' ${HOME} sed done
+	then ${HOME} grep export echo test -eu readonly "$@"
+echo $(pwd) "$1" sed grep ${HOME} done done
+		'quoted text' local readonly done then cd && -eu "$1" readonly ${HOME}
+	"$@" /usr/bin cd && awk printf && /usr/bin --verbose
+readonly 'quoted text' local cd
+	test readonly "$@" echo cd "$1" && test sed
+	echo done /usr/bin x=1 2>/dev/null "$1" readonly done grep local ${HOME} ${HOME}
+	-eu -eu printf 'quoted text' done then then export awk printf sed
+	readonly cd x=1 /usr/bin -eu "$@" && 2>/dev/null
+/usr/bin grep --verbose | && done then local | | --verbose && test echo
+	sed $(pwd) then x=1 /usr/bin
+		grep cd grep && 2>/dev/null cd export test $(pwd) /usr/bin && grep local
+&& printf -eu $(pwd) readonly |
+		-eu "$@" "$1" "$@" --verbose echo /usr/bin printf $(pwd) then $(pwd)
+done "$1" $(pwd) /usr/bin | --verbose grep printf &&
+	x=1 ${HOME} then $(pwd) cd done
+	'quoted text' test export
+	&& ${HOME} 2>/dev/null -eu x=1 cd /usr/bin export
+	"$1" export | done -eu awk cd echo | cd && readonly test awk readonly
+&& && 'quoted text' -eu export then
+	"$@" local then --verbose printf printf grep 'quoted text' local
+	cd --verbose /usr/bin echo export printf 'quoted text' -eu sed printf x=1 | cd
+		/usr/bin test $(pwd) echo | 'quoted text' readonly cd test
+	| && readonly readonly local awk "$1" then
+		cd "$1" sed --verbose && && /usr/bin printf --verbose readonly cd &&
+	local awk local -eu | -eu /usr/bin
+		readonly "$1" export grep "$@" -eu
+		readonly -eu echo ${HOME} echo "$@" ${HOME} "$@" readonly
+		test cd awk "$@" done -eu echo done | "$@" done x=1 "$1" "$@" -eu ${HOME}
+	/usr/bin 2>/dev/null x=1 export
+grep grep && x=1 test awk sed /usr/bin
+${HOME} --verbose done readonly cd grep && && test printf "$1" then sed awk
+#include c123.sh
+	/usr/bin local --verbose export 2>/dev/null x=1 grep /usr/bin cd "$1" && x=1 2>/dev/null
+	2>/dev/null 'quoted text' local "$1" | ${HOME} $(pwd)
+		&& cd cd readonly "$@" sed sed echo sed then ${HOME} --verbose cd && "$@"
+	test --verbose $(pwd) awk readonly cd grep | export then -eu x=1 cd local
+		test printf 'quoted text' sed && "$@" "$1" ${HOME} "$@" ${HOME} printf |
+"$@" then echo | done echo cd x=1 "$@" local grep awk 'quoted text'
+"$1" -eu cd | sed done /usr/bin echo
+	-eu then awk local grep $(pwd) sed export then readonly && then
+printf readonly echo test --verbose
+	2>/dev/null $(pwd) $(pwd) echo grep "$1" /usr/bin readonly "$1" local $(pwd) --verbose
+		awk echo "$1" --verbose /usr/bin 'quoted text' awk export cd cd "$@" -eu
+	test -eu printf /usr/bin x=1 sed grep sed "$1" -eu "$@" 'quoted text'
+grep ${HOME} local echo test cd x=1 'quoted text' x=1 sed local ${HOME}
+2>/dev/null /usr/bin sed -eu awk readonly test printf && awk export -eu
+	${HOME} echo ${HOME} --verbose 2>/dev/null cd /usr/bin cd --verbose
+		local | sed done echo -eu -eu local grep "$1"
+		sed local "$1" readonly && 2>/dev/null
+	/usr/bin $(pwd) /usr/bin 2>/dev/null | done local "$1" 2>/dev/null printf
+	$(pwd) -eu "$@" echo x=1 ${HOME} test
+		| done "$1" && | echo 'quoted text'
+		echo export readonly sed
+		-eu echo test done echo local 'quoted text' echo then --verbose "$1"
+	test readonly -eu 2>/dev/null local 'quoted text'
+		done grep && $(pwd) then grep x=1
+done readonly echo readonly printf echo awk 2>/dev/null
+test /usr/bin done grep
+cd | "$@" echo x=1 echo 'quoted text' readonly "$1" awk awk done
+echo "$1" test printf && sed local
+	test 'quoted text' awk -eu awk &&
+		-eu $(pwd) | then then "$1" $(pwd) export readonly sed 'quoted text'
+		--verbose ${HOME} test printf awk sed && x=1
+	x=1 "$1" && 'quoted text'
+	export then awk --verbose "$1" -eu echo -eu "$@" then $(pwd)
+2>/dev/null 'quoted text' &&
+export && echo test done then | "$1" test && cd
+sed "$@" 2>/dev/null /usr/bin grep /usr/bin local local local
+	'quoted text' x=1 printf 2>/dev/null && local
+		${HOME} "$@" readonly cd then -eu
+2>/dev/null local -eu 2>/dev/null
+	then grep /usr/bin local sed --verbose
+$(pwd) | then 'quoted text' 'quoted text'
+		--verbose ${HOME} $(pwd) sed cd -eu | 2>/dev/null awk grep 'quoted text'
+	awk 'quoted text' then --verbose ${HOME} awk && /usr/bin export -eu 2>/dev/null
+	readonly 2>/dev/null export sed $(pwd) printf echo awk printf export
+		&& "$1" $(pwd) cd | grep
+		done 2>/dev/null sed /usr/bin cd then --verbose 2>/dev/null
+/usr/bin export --verbose cd export printf local
+	"$1" echo local | export then grep grep 2>/dev/null ${HOME} then
+		/usr/bin test local export $(pwd) ${HOME}
+	&& && 'quoted text' echo echo grep echo cd echo "$1" "$1" /usr/bin
+	done printf /usr/bin echo grep grep
+	"$1" && 2>/dev/null -eu printf x=1
+	"$@" then grep --verbose done local export awk x=1
+"$1" -eu test sed 2>/dev/null cd then "$1" export export sed 2>/dev/null export
+--verbose grep && --verbose -eu printf -eu echo
+	readonly x=1 "$1" | | && 2>/dev/null
+readonly && awk printf -eu done x=1 cd readonly
+	done printf ${HOME} cd then "$1" sed readonly done cd $(pwd) --verbose
+		-eu 2>/dev/null && local 'quoted text' sed awk /usr/bin readonly
+		awk && export readonly -eu /usr/bin echo $(pwd) then
+		-eu | printf echo "$1"
+	local && done x=1 echo readonly
+	"$1" echo cd | awk local "$@" -eu awk then export sed x=1 2>/dev/null local
+		grep readonly readonly printf export x=1
+"$1" sed ${HOME} "$@" /usr/bin $(pwd)
+	local export test local readonly sed printf 'quoted text' export "$1"
+awk then x=1 echo ${HOME} then export
+		readonly ${HOME} sed awk /usr/bin 'quoted text'
+x=1 local ${HOME} 'quoted text' x=1
+	export grep | -eu printf awk "$1" $(pwd) done echo 2>/dev/null
+grep done done x=1 local done "$1" done x=1 --verbose x=1 echo awk awk
+	grep "$@" ${HOME} 2>/dev/null printf -eu "$@"
+local grep | -eu local "$@" -eu cd export 2>/dev/null | "$1" "$1" && /usr/bin
+	&& | -eu local done local cd awk
+	2>/dev/null readonly printf ${HOME} 2>/dev/null "$1" --verbose
+	sed done then test sed "$1" $(pwd) awk export && printf "$1" cd awk && "$@"
+		"$@" export echo then x=1 awk "$1" then ${HOME} && echo && 'quoted text'
+'quoted text' then /usr/bin 'quoted text' /usr/bin $(pwd) grep test "$1" grep
+		| local export $(pwd) /usr/bin printf awk ${HOME}
+done ${HOME} "$1" 'quoted text' grep export cd
+x=1 echo 2>/dev/null ${HOME} ${HOME} cd | readonly --verbose readonly
+	| -eu grep export --verbose ${HOME} -eu --verbose export /usr/bin 2>/dev/null
+${HOME} -eu then | -eu ${HOME} awk test cd local x=1 done "$@" "$@" echo -eu
+	-eu "$@" grep local echo --verbose
+		-eu sed printf export export "$1" -eu printf ${HOME} --verbose local ${HOME}
+	-eu -eu ${HOME} printf && export export echo sed "$1" then && readonly "$1"
+sed grep /usr/bin printf 'quoted text' awk "$@"
+| test 2>/dev/null && /usr/bin done ${HOME}
+2>/dev/null export sed $(pwd) readonly readonly grep sed export 2>/dev/null
+		sed test test $(pwd) echo test done "$@" 'quoted text' "$1" | cd printf |
+	grep done echo sed -eu printf ${HOME} sed
+/usr/bin local 'quoted text' export cd cd export x=1 /usr/bin
+	| "$@" test --verbose
+	&& ${HOME} done done && export /usr/bin $(pwd)
+local sed ${HOME} ${HOME} sed printf /usr/bin && export
+-eu then | readonly done printf printf "$1" awk
+	sed && && "$@" ${HOME}
+"$@" --verbose ${HOME} 2>/dev/null readonly grep readonly sed local $(pwd)
+	test export /usr/bin local x=1 awk
+		| done 'quoted text' "$1" && "$1" then ${HOME}
+		&& then 2>/dev/null 2>/dev/null export
+sed grep 'quoted text' done done readonly 'quoted text' printf done test -eu
+	test 'quoted text' cd 2>/dev/null
+	2>/dev/null printf /usr/bin cd done grep 2>/dev/null 2>/dev/null
+"$@" export awk printf && sed grep
+		&& ${HOME} ${HOME} 2>/dev/null
+'quoted text' export sed "$1" && -eu done 'quoted text' awk cd $(pwd) "$1" awk
+	sed sed && && printf --verbose ${HOME} 'quoted text'
+-eu x=1 2>/dev/null | printf x=1 awk | printf cd -eu readonly done done "$@"
+	${HOME} then "$1" export done done x=1 /usr/bin | cd 'quoted text'
+		'quoted text' | echo ${HOME} x=1 'quoted text' readonly awk echo
+2>/dev/null 'quoted text' ${HOME}
+	${HOME} && sed sed echo --verbose
+	local done echo --verbose done -eu grep --verbose
+	echo "$@" grep printf readonly grep awk | -eu local
+		'quoted text' -eu local $(pwd) printf
+		2>/dev/null sed && grep grep $(pwd)
+	"$1" --verbose | ${HOME} then 'quoted text' /usr/bin awk --verbose && | "$@" x=1
+echo then local -eu "$@" grep
+	export awk -eu grep export --verbose "$1" echo done
+		&& printf echo $(pwd) grep | sed && x=1 export then -eu x=1 "$@" readonly
+		2>/dev/null readonly readonly x=1 then
+	2>/dev/null | cd grep $(pwd) -eu echo
+		readonly cd $(pwd) -eu cd --verbose readonly -eu
+		local readonly grep grep
+done export printf sed local sed grep -eu echo "$@"
+| ${HOME} printf --verbose
+	echo awk && export ${HOME} grep && test "$1" | $(pwd) $(pwd)
+export grep done $(pwd) /usr/bin awk printf x=1 /usr/bin
+test "$1" grep 2>/dev/null ${HOME} test sed | test export x=1 -eu x=1
+		&& cd 'quoted text' test "$1" done test local then test x=1 test && export "$@"
+		export local echo export &&
+		echo awk printf "$@" ${HOME} cd "$@"
+grep echo 'quoted text' x=1 | grep sed | x=1 ${HOME}
+		--verbose then "$@" export 'quoted text' ${HOME} x=1 awk awk grep 'quoted text'
+readonly printf "$@" x=1 printf test
+	cd awk awk test "$1" local $(pwd)
+		cd x=1 echo cd && readonly done
+grep echo then readonly "$@"
+done -eu export echo /usr/bin /usr/bin ${HOME} export grep done
+		2>/dev/null $(pwd) -eu test local "$@" 2>/dev/null ${HOME} --verbose --verbose
+		sed local export | -eu local then ${HOME} readonly x=1 "$@" /usr/bin -eu
+		awk local $(pwd) 2>/dev/null
+		done then "$1" x=1 then
+	2>/dev/null sed "$1" /usr/bin cd echo "$1" $(pwd)
+readonly done -eu then 'quoted text' x=1 test 'quoted text' x=1 /usr/bin
+		local "$1" export then && echo 'quoted text'
+		| test | readonly cd x=1 local && "$@" grep export 'quoted text' then
+	-eu done test readonly | x=1 'quoted text' grep awk && echo then 2>/dev/null
+&& 2>/dev/null grep grep cd x=1 --verbose grep printf then export | "$@" readonly
+		x=1 test "$1" sed x=1 --verbose grep ${HOME} readonly 2>/dev/null "$1" readonly
+	--verbose then /usr/bin export 'quoted text' awk ${HOME} sed readonly
+/usr/bin then sed local awk then --verbose sed $(pwd) $(pwd) then /usr/bin
+	export export $(pwd) x=1 /usr/bin local echo &&
+2>/dev/null x=1 readonly done x=1 ${HOME} -eu done -eu done
+		"$@" echo echo local "$1" "$1" "$@" awk local /usr/bin done printf $(pwd) | grep
+	awk -eu "$1" | | printf
+		--verbose echo | ${HOME} 'quoted text'
+		"$@" done $(pwd) export ${HOME} "$@" 2>/dev/null
+/usr/bin --verbose -eu -eu "$1" 'quoted text' export ${HOME} x=1 'quoted text'
+	2>/dev/null done local local sed -eu export $(pwd) then --verbose readonly
+"$1" -eu done cd x=1 test /usr/bin $(pwd) | ${HOME} sed
+		/usr/bin | "$@" 'quoted text' awk | printf cd done grep
+	test awk grep then sed readonly echo && | echo ${HOME} --verbose
+	cd grep awk "$@" --verbose test local done /usr/bin
+awk $(pwd) local | /usr/bin ${HOME}
+		| /usr/bin readonly echo grep local "$1" "$1" ${HOME} done local &&
+'quoted text' "$@" $(pwd) -eu awk local echo | sed done readonly echo $(pwd)
+test export readonly test $(pwd) $(pwd) -eu export awk && test test
+	'quoted text' done 'quoted text' $(pwd) | grep echo then 'quoted text'
+	sed grep awk sed test cd && 2>/dev/null sed --verbose
+		export export done "$1" 2>/dev/null local echo "$1" 2>/dev/null
+	"$@" 'quoted text' done
+	-eu -eu $(pwd) readonly sed /usr/bin done
+grep export awk ${HOME} export then sed export x=1 echo ${HOME} && then test
+	grep ${HOME} readonly export sed -eu -eu test
+		local | awk done awk && echo echo | echo "$1" 2>/dev/null
+	-eu test ${HOME} readonly x=1 done sed "$1" printf | && then grep sed local
+| x=1 test $(pwd) done awk readonly sed /usr/bin | -eu && then export
+		&& "$1" | awk "$1" -eu echo echo -eu
+	--verbose 2>/dev/null 'quoted text' x=1 cd echo done x=1 "$@" x=1 echo printf
+	export awk x=1 readonly --verbose ${HOME} ${HOME}
+	done $(pwd) -eu 2>/dev/null 2>/dev/null 'quoted text'
+&& export ${HOME} readonly --verbose echo awk local $(pwd) $(pwd) ${HOME} sed
+$(pwd) 'quoted text' x=1 local "$1" grep --verbose
+	printf x=1 --verbose echo then done grep $(pwd) cd
+		2>/dev/null x=1 cd local 'quoted text' echo "$1" local ${HOME}
+${HOME} $(pwd) && /usr/bin 2>/dev/null printf grep /usr/bin -eu done -eu 'quoted text'
+	-eu && then /usr/bin && 2>/dev/null "$@" printf local $(pwd) ${HOME} "$@" 'quoted text'
+${HOME} && done awk -eu echo ${HOME} &&
+		printf ${HOME} then x=1 echo echo local readonly readonly ${HOME} then export
+		done x=1 ${HOME} grep awk && printf export --verbose
+	-eu printf 2>/dev/null && ${HOME} -eu
+		export && export -eu done | sed "$1" awk && then
+${HOME} /usr/bin "$@" local then 'quoted text' /usr/bin "$@" test
+cd ${HOME} readonly local cd readonly
+	grep cd --verbose ${HOME}
+		| local echo "$@" readonly sed echo
+		${HOME} -eu ${HOME} x=1 grep | then export $(pwd) grep echo -eu printf
+--verbose $(pwd) 2>/dev/null awk "$1" --verbose -eu /usr/bin "$1"
+	2>/dev/null x=1 -eu grep "$1" then /usr/bin -eu sed
+		done echo x=1 "$1" x=1 "$@" x=1 /usr/bin
+	| export echo "$1" test x=1 2>/dev/null $(pwd) && x=1 sed cd cd |
+		sed cd awk sed sed done sed awk && --verbose awk /usr/bin cd done echo 2>/dev/null
+	sed cd then "$@" grep grep test --verbose test ${HOME}
+	"$@" export "$@" $(pwd) /usr/bin
+	${HOME} export then test x=1 "$@" $(pwd) --verbose
+	-eu --verbose && local awk /usr/bin -eu
+		&& x=1 grep $(pwd) "$1" then ${HOME} && x=1 done
+		/usr/bin -eu 'quoted text' awk
+		"$@" echo /usr/bin "$@" x=1 then
+	printf && done "$@" grep | cd && then "$1" cd x=1 && sed
+&& --verbose | $(pwd) echo readonly
+'quoted text' echo grep /usr/bin $(pwd) awk echo /usr/bin test 2>/dev/null
+	x=1 done $(pwd) then readonly cd --verbose
+then printf "$@" 'quoted text'
+	&& grep echo cd awk 2>/dev/null cd /usr/bin awk local $(pwd) $(pwd) cd 2>/dev/null
+	${HOME} local sed && ${HOME} "$1" "$1" then done | && 'quoted text'
+	done $(pwd) grep echo 2>/dev/null then $(pwd) 2>/dev/null
+		sed --verbose "$1" $(pwd)
+"$@" 2>/dev/null done export
+	$(pwd) grep "$@" echo echo readonly && printf && $(pwd) cd sed 'quoted text' then
+		local 'quoted text' cd
+	-eu "$@" /usr/bin done -eu /usr/bin x=1 echo echo test cd sed
+		"$1" then /usr/bin 2>/dev/null | 2>/dev/null $(pwd) test done x=1 then x=1 x=1 cd
+awk "$@" 'quoted text' cd ${HOME} && ${HOME} sed | -eu $(pwd)
+2>/dev/null /usr/bin 2>/dev/null && readonly
+	/usr/bin readonly "$@" "$1" $(pwd) export ${HOME}
+		2>/dev/null 2>/dev/null "$1" x=1 printf readonly /usr/bin
+	readonly 'quoted text' grep export then | readonly $(pwd) -eu -eu printf
+echo cd awk | --verbose
+'quoted text' grep awk export ${HOME} -eu --verbose --verbose -eu
+printf awk done echo then readonly ${HOME} export
+	sed /usr/bin $(pwd) export done sed cd $(pwd) test
+		-eu done test -eu cd -eu x=1 "$1" export awk 2>/dev/null
+sed 2>/dev/null printf done 'quoted text'
+	"$1" awk then $(pwd) sed grep x=1 && x=1 awk x=1 | $(pwd)
+readonly readonly /usr/bin
+		-eu && --verbose $(pwd)
+		then && local $(pwd) --verbose $(pwd) cd -eu echo $(pwd) then grep local $(pwd)
+		"$1" --verbose 'quoted text' cd grep done then test && grep grep "$@"
+cd printf local -eu export done --verbose sed then then
+	--verbose 2>/dev/null
+		'quoted text' $(pwd) local echo x=1 "$1" --verbose ${HOME} 2>/dev/null
+	/usr/bin then -eu grep -eu 'quoted text' x=1 2>/dev/null ${HOME} local "$1" export
+		&& awk done sed "$@" sed test $(pwd) local
+	readonly then echo echo echo local test | test 'quoted text' "$1" 'quoted text'
+		done $(pwd) awk readonly readonly -eu awk -eu && echo
+| cd ${HOME} 'quoted text' $(pwd) export $(pwd) /usr/bin grep local
+		cd "$1" --verbose "$@" export then -eu cd done cd /usr/bin printf
+		"$1" local printf -eu awk "$1" test "$@" readonly x=1 "$1" && export
+sed x=1 "$1" done 2>/dev/null
+	done 'quoted text' sed | 'quoted text'
+		${HOME} -eu $(pwd) /usr/bin /usr/bin -eu | && local test local x=1
+		-eu | awk cd "$1" "$1" | sed 2>/dev/null
+"$@" /usr/bin --verbose &&
+-eu x=1 then "$@" ${HOME} "$@" $(pwd) readonly 'quoted text' 2>/dev/null
+sed --verbose done awk 2>/dev/null readonly 2>/dev/null
+	/usr/bin -eu echo -eu sed ${HOME} cd sed $(pwd) done | cd done
+	$(pwd) 2>/dev/null printf
+	$(pwd) 2>/dev/null 2>/dev/null "$@" $(pwd)
+	'quoted text' ${HOME} then printf readonly "$@"
+cd "$1" cd export echo --verbose
+	'quoted text' readonly sed local | 2>/dev/null grep awk 'quoted text' cd done
+		sed /usr/bin cd && printf sed sed 2>/dev/null then "$1" export done
+	/usr/bin local done export cd | readonly
+| | sed grep local readonly 'quoted text' 'quoted text' $(pwd)
+local test --verbose x=1 test export test echo readonly
+cd cd | /usr/bin "$1" && local then "$@" x=1 cd test 'quoted text' echo printf
+	$(pwd) x=1 printf -eu cd export ${HOME} printf | -eu -eu 'quoted text'
+	test x=1 then echo x=1 grep export awk | ${HOME}
+		awk "$@" done -eu x=1 sed printf "$1" awk $(pwd) -eu 'quoted text'
+	cd 'quoted text' awk readonly
+		done sed /usr/bin sed | test -eu -eu $(pwd) then export /usr/bin "$@"
+	${HOME} x=1 export 'quoted text' export local x=1 cd
+	'quoted text' grep /usr/bin done 'quoted text' test printf cd printf printf readonly
+	readonly && "$@" echo then ${HOME} ${HOME}
+	cd "$@" 2>/dev/null | x=1 'quoted text'
+		"$1" | -eu 2>/dev/null 'quoted text' readonly printf sed | -eu
+		printf grep cd $(pwd) readonly --verbose
+		--verbose --verbose && test 'quoted text'
+-eu awk readonly 2>/dev/null
+	printf 2>/dev/null ${HOME} --verbose echo "$@" cd readonly then
+-eu then readonly done | --verbose 2>/dev/null
+		awk local readonly echo local printf then $(pwd) x=1 export
+	x=1 printf 'quoted text' sed cd export awk
+	cd awk "$@" local printf
+	printf x=1 "$@" local test export 2>/dev/null awk /usr/bin
+awk done sed test cd local --verbose $(pwd) /usr/bin cd
+x=1 -eu /usr/bin x=1 2>/dev/null
+	&& cd 2>/dev/null --verbose x=1 --verbose | export echo x=1 /usr/bin
+		sed x=1 2>/dev/null /usr/bin "$@"
+		&& then | $(pwd) x=1 grep
+| x=1 | grep "$1" ${HOME}
+grep "$1" awk "$@" | then readonly
+then export then $(pwd) 2>/dev/null done grep local ${HOME} sed
+		&& 'quoted text' --verbose $(pwd) then done /usr/bin /usr/bin echo | done
+		-eu 'quoted text' done /usr/bin local -eu grep 2>/dev/null
+		printf readonly echo cd "$@" then $(pwd) 'quoted text' done "$1" $(pwd)
+awk awk "$1" printf local local -eu printf
+	printf echo $(pwd) then 2>/dev/null grep local sed ${HOME} echo
+	export test $(pwd) done 2>/dev/null test readonly |
+		--verbose ${HOME} | | done && &&
+	$(pwd) awk $(pwd) test then ${HOME}
+test -eu $(pwd) awk -eu test readonly test awk x=1 $(pwd)
+		done /usr/bin 'quoted text' readonly "$1" printf grep
+	sed ${HOME} export printf cd $(pwd)
+		'quoted text' ${HOME} 'quoted text' cd "$@" x=1 | awk /usr/bin $(pwd) cd readonly
+export export readonly grep sed --verbose local test x=1 /usr/bin x=1 echo
+		local cd readonly x=1 "$1" && test 'quoted text' x=1 local
+	readonly export "$1" then && ${HOME} -eu /usr/bin
+		export -eu 2>/dev/null test && test printf x=1 sed export
+		&& "$1" 2>/dev/null cd | x=1 readonly printf "$@" --verbose
+then export --verbose "$@" $(pwd) -eu
+		x=1 2>/dev/null test printf "$@" && ${HOME} then test done cd done then
+		2>/dev/null x=1 && export cd readonly done test echo && ${HOME}
+		export awk -eu sed ${HOME} awk export
+	awk 'quoted text' then export
+		$(pwd) "$@" then -eu && local awk ${HOME} -eu "$1"
+--verbose -eu then | echo awk sed "$@" then awk "$1" sed && readonly sed
+local then awk then "$@" sed cd printf x=1 local 2>/dev/null echo "$@"
+"$@" && done $(pwd) /usr/bin && x=1 readonly sed sed 2>/dev/null "$1" && local
+		done "$@" "$1" local "$1" ${HOME} "$1" ${HOME} export
+		$(pwd) local $(pwd) 2>/dev/null 2>/dev/null x=1
+	$(pwd) printf && export
+export test readonly "$@" 2>/dev/null test readonly readonly
+done grep ${HOME} readonly test done
+		"$@" echo | then echo "$@" done sed readonly x=1
+	readonly "$1" printf 'quoted text'
+done "$1" -eu x=1 local readonly local awk sed 'quoted text'
+		&& cd awk 2>/dev/null && -eu x=1 ${HOME}
+		x=1 cd "$1" echo then ${HOME}
+	echo readonly local then "$@" 'quoted text' 2>/dev/null cd -eu
+'quoted text' 2>/dev/null --verbose x=1 | "$1" sed 'quoted text'
+	export test grep sed 'quoted text' | x=1 2>/dev/null ${HOME} && echo echo printf
+readonly --verbose ${HOME} $(pwd) then awk --verbose cd
+		2>/dev/null grep echo sed /usr/bin
+	export -eu local printf --verbose
+done printf test 'quoted text' printf export $(pwd) export export && printf
+	printf "$1" $(pwd) | export "$@" test "$@"
+2>/dev/null 'quoted text' done x=1 readonly export --verbose
+/usr/bin $(pwd) grep local --verbose 'quoted text' export "$@" export x=1
+	local $(pwd) test readonly
+readonly local done ${HOME} "$@" && done /usr/bin 'quoted text'
+	awk /usr/bin local printf local 'quoted text' && "$1"
+	local "$1" && local test cd echo "$1" printf
+	'quoted text' awk | /usr/bin -eu local
+"$@" -eu readonly done -eu awk "$@" export "$1" grep echo 2>/dev/null x=1 $(pwd)
+	echo --verbose 'quoted text' 2>/dev/null cd local done then "$@" $(pwd) done done
+	sed "$1" $(pwd) sed x=1 /usr/bin sed ${HOME} "$1" readonly
+$(pwd) x=1 x=1 done then echo done export awk then 2>/dev/null -eu cd cd
+	local 'quoted text' 'quoted text' -eu 'quoted text'
+echo 'quoted text' /usr/bin sed "$@"
+		--verbose && 'quoted text' readonly "$@" "$1" export x=1 "$1" local 2>/dev/null
+x=1 then sed readonly cd readonly 2>/dev/null
+printf "$@" done -eu sed --verbose echo | "$1" cd sed
+		local local test --verbose
+		readonly ${HOME} printf grep --verbose 'quoted text' readonly
+local readonly --verbose readonly printf && -eu && awk then /usr/bin grep
+${HOME} awk "$@" echo readonly then x=1 ${HOME} "$@" then --verbose
+grep 'quoted text' test | --verbose "$1" echo | --verbose $(pwd) done
+${HOME} done printf export | x=1 local && $(pwd) 2>/dev/null export then /usr/bin
+awk grep 'quoted text' printf x=1 -eu x=1 done readonly && 2>/dev/null
+'quoted text' -eu printf echo grep 'quoted text'
+/usr/bin printf printf /usr/bin grep /usr/bin ${HOME} ${HOME} done && cd
+	"$1" grep /usr/bin -eu test awk
+	test echo ${HOME} printf -eu "$1" x=1 --verbose 2>/dev/null export
+"$@" 'quoted text' grep
+		/usr/bin && "$1" readonly -eu done "$@" 'quoted text' grep
+x=1 cd -eu local test cd test readonly -eu grep | x=1
+		x=1 "$@" 2>/dev/null then printf "$@" 'quoted text'
+		${HOME} done export sed
+cd 'quoted text' sed && then /usr/bin echo 'quoted text' echo ${HOME}
+		x=1 cd "$@" 2>/dev/null 'quoted text'
+"$@" "$@" test "$@" && 2>/dev/null 2>/dev/null cd printf
+readonly x=1 test && -eu x=1
+	"$1" sed x=1 printf | grep x=1 echo grep && "$1" echo
+printf x=1 local /usr/bin "$1"
+cd 'quoted text' readonly "$@" test /usr/bin ${HOME} --verbose
+x=1 -eu ${HOME} ${HOME} grep cd
+local local test test "$@" printf readonly
+	local local ${HOME} x=1 'quoted text' 2>/dev/null
+--verbose && sed sed | test printf -eu done cd test | && echo
+		printf 2>/dev/null export
+		"$@" $(pwd) /usr/bin --verbose done "$@" test printf /usr/bin
+2>/dev/null $(pwd) && 'quoted text'
+	cd $(pwd) /usr/bin printf "$1" cd
+	"$1" x=1 'quoted text' 'quoted text'
+	export $(pwd) sed "$@" && | "$@" printf "$1" printf 'quoted text' export
+	${HOME} && && cd readonly --verbose --verbose
+	${HOME} ${HOME} sed ${HOME} local awk local export /usr/bin export readonly
+"$1" -eu printf ${HOME} "$1" awk 'quoted text'
+	"$1" -eu then 'quoted text' awk x=1 awk done
+awk local /usr/bin then x=1 $(pwd) then
+	x=1 $(pwd) $(pwd) && cd sed
+	printf "$1" printf x=1 -eu then grep 2>/dev/null
+grep printf echo /usr/bin printf export "$1" | sed
+	grep /usr/bin done /usr/bin
+'quoted text' && ${HOME} x=1 --verbose
+		"$@" local local test x=1 readonly echo sed
+${HOME} x=1 2>/dev/null /usr/bin
+${HOME} then printf 2>/dev/null 'quoted text' awk 2>/dev/null $(pwd) --verbose
+awk then -eu echo awk 2>/dev/null
+test -eu --verbose sed sed -eu
+-eu --verbose awk cd -eu done && && sed -eu done x=1 ${HOME} | "$@"
+awk $(pwd) test sed printf echo x=1 'quoted text' echo "$1" "$@" sed export
+		/usr/bin awk echo sed test awk done test printf ${HOME} $(pwd) --verbose -eu
+-eu x=1 readonly x=1 export | then "$@" $(pwd) 2>/dev/null local local x=1
+		${HOME} ${HOME} readonly
+	-eu /usr/bin echo done --verbose then 2>/dev/null | readonly x=1 local "$1"
+sed 2>/dev/null local --verbose test sed | readonly then
+		'quoted text' $(pwd)
+		&& printf $(pwd) echo cd then export export x=1 sed $(pwd) |
+/usr/bin echo done test ${HOME} echo x=1 --verbose sed $(pwd) && local $(pwd)
+		then && $(pwd) && | "$@" then ${HOME} awk grep
+test -eu "$1" local x=1 "$1" test sed | "$1" ${HOME} --verbose
+local sed local sed "$@" test "$@" done sed done
+local local | -eu -eu cd test readonly then test $(pwd) cd "$@" done export
+		"$1" /usr/bin /usr/bin /usr/bin | 2>/dev/null
+&& sed --verbose $(pwd) | -eu
+'quoted text' $(pwd) $(pwd) 'quoted text' readonly 2>/dev/null local x=1 "$1"
+	done export 'quoted text' 2>/dev/null test export
+		x=1 2>/dev/null /usr/bin -eu /usr/bin awk "$1" awk
+		"$@" sed 'quoted text' awk "$1"
+		local cd $(pwd) grep awk
+2>/dev/null && sed "$@" grep 'quoted text'
+		"$@" | && local cd && && ${HOME}
+		| /usr/bin ${HOME} "$@" x=1 cd --verbose
+--verbose export awk && /usr/bin 'quoted text' ${HOME} local
+		${HOME} done cd 'quoted text' ${HOME} export
+		sed "$@" awk "$@" readonly && /usr/bin 'quoted text' printf test
+$(pwd) 'quoted text' readonly test done /usr/bin
+cd export /usr/bin /usr/bin
+	${HOME} test export "$1" && printf --verbose "$1" x=1 grep ${HOME} /usr/bin "$@"
+	x=1 $(pwd) done local awk test readonly local local sed && /usr/bin
+	grep local $(pwd) done export -eu 'quoted text' echo && $(pwd) sed
+		"$@" sed -eu 'quoted text' $(pwd) then 2>/dev/null x=1 'quoted text'
+		'quoted text' $(pwd) $(pwd)
+		x=1 grep x=1 readonly echo sed --verbose cd | test -eu $(pwd) test then
+		test /usr/bin 2>/dev/null 'quoted text'
+	2>/dev/null grep /usr/bin grep && ${HOME} 'quoted text' /usr/bin sed export echo
+		then 2>/dev/null sed $(pwd) && /usr/bin /usr/bin printf
+	| x=1 | --verbose 2>/dev/null "$1"
+	--verbose 'quoted text'
+		/usr/bin /usr/bin done export $(pwd) /usr/bin ${HOME} echo done | sed -eu
+| 'quoted text' 'quoted text' $(pwd) grep readonly awk then
+		--verbose export echo readonly ${HOME} echo test x=1
+"$@" sed awk | test --verbose
+		"$1" && printf cd -eu awk printf "$1"
+export ${HOME} export && awk $(pwd) $(pwd) "$@" test
+		| export $(pwd) --verbose cd 2>/dev/null | && --verbose -eu
+test cd 2>/dev/null local done && test 'quoted text' readonly | x=1
+x=1 then /usr/bin echo | $(pwd) done $(pwd) $(pwd)
+sed x=1 | readonly local local
+${HOME} 2>/dev/null --verbose -eu /usr/bin
+		'quoted text' export cd cd grep echo readonly 2>/dev/null
+		echo export "$@" grep "$1" "$1" /usr/bin && local awk cd export -eu test x=1
+		readonly sed cd test local then -eu awk done "$@" sed export local $(pwd)
+$(pwd) echo "$@" grep printf "$1" echo && $(pwd) | readonly
+		awk printf cd readonly grep && --verbose
+2>/dev/null 'quoted text'
+x=1 "$1" readonly ${HOME}
+	sed "$@" awk -eu grep -eu x=1 --verbose
+		x=1 grep printf /usr/bin "$1" /usr/bin | grep ${HOME} "$1" local
+grep x=1 then awk "$@" "$@" printf "$1" "$@" "$@" then ${HOME} $(pwd) ${HOME}
+grep readonly ${HOME}
+		x=1 test sed /usr/bin then sed 2>/dev/null "$1" local ${HOME}
+	sed echo 2>/dev/null /usr/bin x=1 local
+	awk | ${HOME} echo sed export | -eu --verbose -eu cd done done
+		&& sed readonly test 'quoted text' echo && sed ${HOME} printf
+printf "$@" printf then echo 'quoted text' x=1 -eu $(pwd) "$@" --verbose
+		echo x=1 && "$@" "$1" /usr/bin | readonly cd "$@" && awk done -eu
+	'quoted text' printf done "$@" 2>/dev/null
+	${HOME} -eu 2>/dev/null readonly test 2>/dev/null sed export x=1 /usr/bin cd test
+	readonly 2>/dev/null awk | grep 'quoted text' "$1" local sed readonly
+		awk 2>/dev/null sed export cd ${HOME} $(pwd) local printf | done echo local export
+	2>/dev/null --verbose printf 'quoted text' export ${HOME} -eu grep
+		$(pwd) x=1 -eu echo ${HOME} ${HOME} readonly echo
+	grep /usr/bin sed cd -eu echo 2>/dev/null && readonly | sed ${HOME} | sed
+		-eu 2>/dev/null $(pwd) grep -eu "$@" export 2>/dev/null ${HOME} printf test
+	2>/dev/null /usr/bin printf
+local readonly sed x=1 'quoted text' 2>/dev/null then
+$(pwd) done x=1 'quoted text' sed awk &&
+		| awk -eu && printf test && cd
+		--verbose awk 'quoted text' | 2>/dev/null $(pwd) && "$@" "$@"
+		printf readonly /usr/bin -eu cd then done x=1 done sed awk 'quoted text' -eu $(pwd)
+echo test done 'quoted text' grep 2>/dev/null cd $(pwd)
+	cd sed /usr/bin ${HOME} readonly cd then grep awk readonly
+	test --verbose local awk done
+		sed 'quoted text' x=1 test "$@" readonly
+		sed sed ${HOME} "$1" && "$@" echo 'quoted text' 2>/dev/null readonly 2>/dev/null
+	done 2>/dev/null awk 'quoted text' -eu -eu
+		echo 2>/dev/null && local "$1" export 2>/dev/null grep
+		&& test awk "$@" sed --verbose
+	echo x=1 done "$1" $(pwd) echo x=1 awk 'quoted text' done awk ${HOME} done | grep
+	printf printf /usr/bin done
+		-eu then grep sed "$@" "$@" sed ${HOME} -eu printf --verbose
+		sed -eu done awk ${HOME} 'quoted text' $(pwd) /usr/bin grep echo ${HOME}
+	grep then done "$1" x=1 "$1" then /usr/bin awk /usr/bin echo cd -eu ${HOME} &&
+then local sed "$@" --verbose -eu
+	printf x=1 "$@" "$1" ${HOME} export
+echo grep echo "$@" readonly grep /usr/bin $(pwd)
+	| 2>/dev/null export x=1 awk x=1 then ${HOME} test -eu sed grep local
+		grep $(pwd) $(pwd) -eu ${HOME} readonly export export export
+${HOME} printf awk /usr/bin $(pwd) awk 'quoted text' sed 2>/dev/null
+		done local grep ${HOME} test &&
+	sed --verbose local $(pwd) $(pwd) $(pwd) readonly then -eu "$@" /usr/bin
+readonly awk done -eu 2>/dev/null echo && /usr/bin
+		| echo "$1" export x=1 awk printf sed "$@" "$@" "$1"
+		"$1" grep "$@" "$@" export -eu echo readonly export readonly grep local /usr/bin
+	"$@" test done echo echo | 2>/dev/null
+cd ${HOME} 'quoted text' x=1 printf export printf readonly $(pwd)
+		2>/dev/null 2>/dev/null printf
+	readonly x=1 awk sed test printf local awk --verbose
+grep | 2>/dev/null local x=1 export test x=1 grep local ${HOME} && export
+		cd export printf cd readonly
+		&& awk "$1" /usr/bin -eu "$1" /usr/bin test -eu /usr/bin --verbose then "$1" done
+		local $(pwd) ${HOME} /usr/bin
+	test --verbose $(pwd) "$1" /usr/bin -eu
+		$(pwd) && && -eu export 2>/dev/null 'quoted text' 2>/dev/null /usr/bin
+	/usr/bin && --verbose "$@" 2>/dev/null local "$1" --verbose readonly --verbose |
+	readonly export readonly /usr/bin grep 'quoted text'
+"$@" && 2>/dev/null test cd 2>/dev/null echo --verbose /usr/bin
+		"$@" "$1" awk grep | awk x=1 test done test then "$1" local "$1" then local
+	"$@" $(pwd) printf ${HOME} echo printf
+		echo echo then then sed echo grep awk sed ${HOME} export local
+	local 'quoted text' 'quoted text' ${HOME} "$@" ${HOME} test cd $(pwd)
+		-eu x=1 test printf /usr/bin 'quoted text'
+	"$@" printf local cd local
+"$1" test grep cd $(pwd) 2>/dev/null 2>/dev/null
+&& && grep local sed /usr/bin |
+	cd printf done --verbose "$1" then echo 'quoted text' then printf
+export echo sed "$@" ${HOME} $(pwd) then awk echo -eu /usr/bin readonly
+		| && ${HOME} grep | test 'quoted text'
+		2>/dev/null test local export |
+		awk 'quoted text' sed then test 'quoted text'
+	export 'quoted text' readonly
+	${HOME} x=1 sed done done 'quoted text' sed x=1 cd
+		readonly 'quoted text' sed ${HOME} "$@" printf 'quoted text'
+	"$@" -eu && /usr/bin cd then | "$1" sed awk x=1 -eu readonly export
+	export && /usr/bin export cd 'quoted text' "$@" $(pwd) export -eu grep
+	"$1" x=1 test printf export done
+	done local local $(pwd) 2>/dev/null local echo printf && echo $(pwd)
+	readonly ${HOME} x=1 "$@"
+2>/dev/null "$@" | $(pwd) echo /usr/bin local done "$1" | -eu echo then
+cd awk cd --verbose local test |
+		"$1" 'quoted text' then
+export 2>/dev/null then local /usr/bin | test /usr/bin
+		"$1" 'quoted text' x=1 awk --verbose $(pwd) echo readonly
+		echo awk readonly --verbose local printf && local export sed printf
+export local 2>/dev/null ${HOME} "$1" printf
+x=1 2>/dev/null local readonly then $(pwd)
+cd local --verbose done && readonly
+		readonly grep ${HOME} cd
+| | echo then -eu 'quoted text' printf readonly -eu
+		cd grep readonly cd && printf | local && then
+		printf readonly -eu -eu
+		2>/dev/null grep printf
+		test $(pwd) then -eu "$1" /usr/bin awk x=1 "$1" 'quoted text' export "$@"
+done x=1 x=1 | 2>/dev/null then printf && $(pwd) 2>/dev/null sed
+		-eu x=1 grep "$1" $(pwd) awk "$@" echo echo "$@" grep local
+	then 'quoted text' x=1 && grep cd -eu 'quoted text' && ${HOME}
+then test echo grep printf cd $(pwd) 2>/dev/null
+"$1" $(pwd) ${HOME} test /usr/bin ${HOME} grep then readonly
+	readonly sed /usr/bin --verbose readonly local grep done | "$@" 'quoted text'
+		done printf -eu awk readonly && then awk printf $(pwd) local cd 2>/dev/null
+	/usr/bin --verbose 2>/dev/null export local
+	| sed readonly echo echo readonly
+	local awk "$1" local then "$@"
+	$(pwd) test awk sed 'quoted text' printf
+awk 2>/dev/null local /usr/bin sed "$@" cd readonly /usr/bin awk | echo
+		'quoted text' printf echo
+	'quoted text' echo | readonly echo $(pwd) x=1
+		/usr/bin done --verbose export then done export
+done cd -eu ${HOME} grep "$1" && cd ${HOME} sed
+		&& "$@" | awk test && test cd "$@" x=1 /usr/bin --verbose
+	$(pwd) 'quoted text' x=1 printf --verbose && 2>/dev/null
+		$(pwd) readonly local /usr/bin ${HOME} done --verbose printf
+	done | readonly | 2>/dev/null -eu 'quoted text' --verbose sed
+	printf export --verbose echo --verbose awk done then
+		/usr/bin "$1" local test $(pwd) grep test && awk "$1"
+		echo "$1" "$1" 'quoted text' export done
+then $(pwd) && "$@" awk test test echo echo done then "$@"
+	/usr/bin sed local cd "$@" test readonly export cd sed 2>/dev/null
+-eu "$@" ${HOME} /usr/bin --verbose 'quoted text'
+	test --verbose then x=1 then cd x=1
+		"$@" --verbose export 'quoted text' awk && grep ${HOME} 2>/dev/null
+	awk echo /usr/bin export sed awk -eu echo "$1" | -eu printf done
+	${HOME} grep | $(pwd) --verbose then awk /usr/bin cd
+		cd | printf x=1 "$@" $(pwd) printf 'quoted text' --verbose --verbose $(pwd) $(pwd)
+&& x=1 && 'quoted text' $(pwd) /usr/bin && then -eu -eu $(pwd)
+	| printf sed x=1 2>/dev/null
+2>/dev/null then awk sed "$1"
+printf 2>/dev/null done /usr/bin -eu printf export
+export "$1" test sed sed && --verbose | x=1 && "$@" grep readonly
+	grep local awk then cd awk -eu -eu $(pwd) export
+	${HOME} test 2>/dev/null local echo printf local sed export $(pwd) done readonly
+	printf "$@" grep ${HOME} | 'quoted text'
+	awk then export $(pwd) -eu test cd x=1 then export "$@" then awk done 2>/dev/null
+	$(pwd) test "$@" cd sed $(pwd) sed done $(pwd) test cd awk grep sed cd
+		| export --verbose local /usr/bin echo 'quoted text' 'quoted text'
+--verbose sed 'quoted text'
+		export --verbose && ${HOME} grep ${HOME} sed | --verbose
+	done cd 2>/dev/null -eu 'quoted text' $(pwd) export x=1
+'quoted text' $(pwd) -eu && grep 2>/dev/null export | sed 2>/dev/null --verbose
+		--verbose grep test then && x=1 readonly then -eu grep
+	awk export 'quoted text' &&
+		| grep done ${HOME} cd ${HOME} /usr/bin awk -eu -eu cd readonly
+		then x=1 | sed done grep local x=1 readonly done done readonly done
+${HOME} ${HOME} x=1 done x=1 sed export
+readonly 'quoted text' --verbose export
+	"$@" "$@" | "$1" local --verbose test "$1"
+		| local 'quoted text' && printf
+--verbose | awk -eu echo sed ${HOME}
+	x=1 && x=1 sed /usr/bin readonly sed $(pwd) 'quoted text' then awk sed
+	"$1" 'quoted text' $(pwd) | $(pwd)
+		x=1 awk | export grep --verbose grep test cd 2>/dev/null export
+${HOME} 'quoted text' "$@" "$@" /usr/bin printf
+then /usr/bin 'quoted text' 'quoted text' printf "$1" 2>/dev/null
+		awk 2>/dev/null $(pwd) sed printf /usr/bin done awk /usr/bin local $(pwd) sed echo
+		then done /usr/bin --verbose sed cd 2>/dev/null test echo awk /usr/bin
+"$@" grep -eu then $(pwd) 2>/dev/null | x=1
+	local "$@" test 2>/dev/null done "$@"
+	readonly 'quoted text' x=1 cd grep readonly awk 2>/dev/null readonly echo /usr/bin
+	grep cd -eu 2>/dev/null local cd printf echo | test "$1"
+	'quoted text' -eu && 'quoted text' --verbose $(pwd) printf awk "$@" grep
+	${HOME} awk x=1 ${HOME} local "$1" readonly
+	export printf export x=1 x=1 ${HOME} /usr/bin
+		export "$1" export done
+	--verbose test export "$@" export local "$1" test done $(pwd)
+export "$@" $(pwd) echo "$1"
+		2>/dev/null then 2>/dev/null export 2>/dev/null
+x=1 export echo && export then readonly export /usr/bin --verbose -eu cd
+export then echo "$1" readonly "$1" | then "$@" 'quoted text' 'quoted text'
+grep readonly then --verbose --verbose x=1
+	x=1 "$1" echo printf $(pwd) /usr/bin | readonly then echo x=1 echo printf test
+	${HOME} x=1 awk 2>/dev/null "$@" 'quoted text'
+	done --verbose "$1" /usr/bin done awk done
+		-eu "$@" test -eu echo readonly local awk "$@"
+awk sed readonly /usr/bin "$@" done | 'quoted text' done test && then readonly
+	$(pwd) local then printf test "$1"
+	--verbose done ${HOME} $(pwd) export sed | && test | done echo --verbose
+	local ${HOME} x=1 printf | --verbose /usr/bin export --verbose
+2>/dev/null done export echo grep export
+echo 'quoted text' then readonly x=1 "$@" |
+2>/dev/null test echo awk | done "$@" cd cd done test done export && "$1" /usr/bin
+	done sed --verbose grep printf cd
+		"$@" grep echo awk $(pwd) printf local readonly && -eu x=1 --verbose echo
+grep printf -eu | grep cd ${HOME} then readonly local -eu
+		-eu done 2>/dev/null export --verbose $(pwd) export
+		/usr/bin echo /usr/bin "$1" done awk -eu done local printf "$@" | /usr/bin
+		/usr/bin cd /usr/bin local /usr/bin -eu | test readonly -eu done
+	-eu | -eu test "$@" "$1" awk -eu $(pwd) $(pwd) "$1" local then readonly
+		--verbose then ${HOME} x=1 | readonly /usr/bin 'quoted text' echo
+	cd --verbose test export
+		printf done --verbose 2>/dev/null local "$@"
+	&& readonly echo /usr/bin x=1
+		&& readonly ${HOME} ${HOME}
+done && ${HOME} "$1" /usr/bin done | export /usr/bin readonly
+		sed awk printf "$1" export 'quoted text' grep "$@" /usr/bin | -eu "$@"
+sed then "$@" done readonly 2>/dev/null local ${HOME} 'quoted text'
+/usr/bin "$@" echo 'quoted text' export x=1 x=1 x=1 sed sed "$1" && done
+		sed grep printf cd test --verbose 'quoted text'
+	done grep "$@" 2>/dev/null --verbose | /usr/bin
+export export export printf "$@" -eu readonly export ${HOME} done echo "$@" 'quoted text'
+		"$1" && awk export /usr/bin done export
+		$(pwd) printf /usr/bin export grep test --verbose grep local /usr/bin export -eu
+		| $(pwd) awk --verbose /usr/bin echo | grep
+		"$@" readonly readonly export awk readonly then readonly
+	done 2>/dev/null awk echo local done printf test ${HOME} 'quoted text'
+	echo local awk printf "$1" export local /usr/bin awk cd ${HOME}
+	cd $(pwd) test echo $(pwd) awk echo | then 2>/dev/null
+		printf printf awk "$@" --verbose test export printf readonly
+cd ${HOME} grep $(pwd) | 'quoted text' then export /usr/bin "$@" ${HOME} &&
+	2>/dev/null --verbose "$@" cd 2>/dev/null awk echo cd x=1 2>/dev/null
+--verbose awk awk ${HOME} awk cd local 2>/dev/null ${HOME} x=1 echo $(pwd)
+printf "$@" grep sed /usr/bin done | 2>/dev/null
+		| && ${HOME} 'quoted text' $(pwd) export grep printf readonly export
+| export | && readonly /usr/bin readonly
+	"$1" done cd grep "$@"
+		echo sed test "$1" export awk
+		x=1 export local test 2>/dev/null printf "$@" readonly -eu then
+		readonly --verbose $(pwd) then /usr/bin then | --verbose
+	echo && cd && echo --verbose export printf local
+cd cd && cd done awk readonly "$1" awk x=1 readonly printf
+	/usr/bin cd done echo done test /usr/bin x=1 ${HOME} --verbose export local done
+	&& readonly test ${HOME} awk printf cd sed sed done x=1
+-eu sed && done awk $(pwd) printf done done x=1 grep | grep
+	readonly ${HOME} test -eu
+		${HOME} readonly sed "$1" sed readonly sed readonly
+		grep 'quoted text' local test -eu grep
+		2>/dev/null printf awk -eu sed local export "$1" 'quoted text'
+		done printf "$1" 2>/dev/null grep "$1" x=1 x=1 cd -eu awk $(pwd) 'quoted text'
+test awk echo test 'quoted text' test $(pwd) local
+-eu 2>/dev/null echo ${HOME} export --verbose
+	sed grep "$1" readonly awk awk
+	-eu ${HOME} then then 2>/dev/null grep then x=1 && cd readonly printf
+x=1 "$1" 2>/dev/null && then "$@" x=1 readonly "$1" awk
+		then sed printf test cd ${HOME} readonly cd sed 2>/dev/null
+--verbose 2>/dev/null $(pwd) x=1 $(pwd) then "$1" -eu awk -eu awk cd export x=1
+	printf /usr/bin /usr/bin -eu awk grep
+/usr/bin readonly ${HOME}
+		sed cd "$1" awk local then test --verbose
+	-eu grep printf export "$@" then && -eu readonly grep "$1" -eu awk | -eu
+	cd echo x=1 local awk 'quoted text' | $(pwd) "$@" -eu grep -eu grep -eu test
+		grep then local 'quoted text' $(pwd)
+readonly x=1 2>/dev/null printf test x=1 "$1" "$@" done --verbose
+-eu awk readonly ${HOME} ${HOME} -eu awk test ${HOME} -eu local
+		awk $(pwd) local /usr/bin done cd /usr/bin readonly
+	test "$@" x=1 printf readonly cd grep -eu
+grep "$1" "$@" test echo echo "$@" 2>/dev/null 2>/dev/null /usr/bin "$@" 2>/dev/null
+	export printf export local
+	printf test test 'quoted text' | "$@" echo grep "$@" local 2>/dev/null then awk
+grep done grep awk 'quoted text' ${HOME} local done test test grep grep cd done
+		test "$@" 'quoted text'
+		echo then "$@" cd export
+local done test $(pwd) then done -eu $(pwd) $(pwd) local 2>/dev/null ${HOME}
+then cd "$1" export export $(pwd) test 'quoted text'
+		printf 'quoted text' sed grep "$1" --verbose
+		cd done ${HOME} sed printf
+	done 'quoted text' done echo export local
+/usr/bin export cd && 2>/dev/null awk -eu grep ${HOME} grep --verbose x=1 2>/dev/null
+&& grep -eu 2>/dev/null && cd awk /usr/bin && test
+		/usr/bin printf "$1" --verbose echo x=1 $(pwd) ${HOME}
+	${HOME} awk 2>/dev/null echo test "$1" awk | printf awk
+	readonly && then 'quoted text' test 'quoted text'
+sed && awk $(pwd) -eu /usr/bin && export awk echo sed test printf export cd awk
+done /usr/bin done local printf local sed /usr/bin 2>/dev/null && 'quoted text'
+		&& printf awk 2>/dev/null cd awk /usr/bin && local test
+		&& 'quoted text' "$@" | && sed && local
+export done "$@" readonly awk
+		test "$1" $(pwd) 'quoted text' echo -eu then printf "$1" printf printf export
+x=1 "$@" awk awk sed && test awk printf test printf 2>/dev/null x=1 ${HOME} x=1
+		--verbose ${HOME} test 2>/dev/null
+		| 2>/dev/null grep done sed $(pwd) readonly ${HOME} /usr/bin
+		/usr/bin test grep 2>/dev/null -eu && 2>/dev/null then export | $(pwd) | $(pwd)
+| "$1" x=1 echo echo /usr/bin
+		/usr/bin "$@" echo ${HOME} cd $(pwd) export -eu "$@"
+-eu echo "$@" printf cd && then /usr/bin $(pwd)
+cd 2>/dev/null && readonly $(pwd) 2>/dev/null
+'quoted text' cd && && done awk echo grep export echo printf x=1
+grep readonly "$@" "$@" awk done "$@" --verbose | sed printf awk x=1 echo
+	/usr/bin ${HOME} local
+		sed printf printf 2>/dev/null printf sed "$@" done sed -eu 2>/dev/null "$1" local
+'quoted text' cd sed
+-eu -eu | 2>/dev/null "$@" then readonly readonly sed -eu
+		| export --verbose done awk /usr/bin /usr/bin | ${HOME} --verbose
+then sed $(pwd) | "$1" printf --verbose --verbose
+		--verbose ${HOME} export x=1 printf --verbose export ${HOME} awk "$@" export 'quoted text'
+export 2>/dev/null "$@" echo 2>/dev/null cd echo x=1 ${HOME}
+		'quoted text' sed grep 'quoted text' grep echo readonly export 2>/dev/null printf
+		local local export cd
+awk -eu printf $(pwd) --verbose grep printf printf export "$1" then -eu && /usr/bin
+cd "$@" awk then $(pwd) /usr/bin cd done readonly
+	local | "$@" done --verbose "$@" $(pwd) awk echo --verbose
+		export | printf | $(pwd) 'quoted text'
+	printf done readonly x=1 echo "$@" 2>/dev/null sed local
+	echo x=1 local sed export "$@" awk ${HOME}
+export 2>/dev/null echo readonly done "$@"
+	local sed 'quoted text' awk printf $(pwd) done 2>/dev/null --verbose done | grep
+$(pwd) /usr/bin | "$1" awk "$1" $(pwd) "$1" printf
+-eu "$1" "$@" test --verbose x=1 then done "$1" awk | local local printf 'quoted text'
+	readonly -eu cd x=1 grep | | -eu "$1"
+		readonly sed echo && | 'quoted text' local
+	"$@" "$@" cd 2>/dev/null
+${HOME} 'quoted text' 'quoted text' $(pwd)
+	&& && then export test test "$@" readonly x=1 && then
+	$(pwd) readonly /usr/bin echo readonly then echo
+		then local "$@" local echo local ${HOME} /usr/bin local echo
+	-eu 'quoted text' x=1 -eu test then $(pwd) test x=1
+	/usr/bin export then done readonly $(pwd) "$1" cd
+	/usr/bin | --verbose export done readonly | -eu sed
+		${HOME} cd then --verbose sed 'quoted text'
+"$@" cd done then grep readonly /usr/bin
+		"$1" && then done awk grep "$@" --verbose 2>/dev/null
+		echo 'quoted text' "$1" grep "$@" 'quoted text' /usr/bin sed awk echo /usr/bin
+	sed echo && "$1" cd local x=1
+| -eu awk | test && "$1" printf
+awk "$@" ${HOME} local --verbose "$@" export done test 'quoted text' test
+	printf 2>/dev/null 2>/dev/null local x=1 done --verbose cd readonly grep
+-eu then "$@" awk | echo done 2>/dev/null cd export
+	-eu cd | && printf done export
+		test local grep && sed "$1" --verbose /usr/bin | local printf printf
+		printf done 2>/dev/null cd then done
+echo /usr/bin x=1 then ${HOME} grep && && --verbose awk
+	sed awk echo echo --verbose done done cd echo printf 'quoted text' 2>/dev/null
+	/usr/bin done awk echo && --verbose grep "$1" awk /usr/bin
+		awk done | done echo cd sed "$1" echo test --verbose &&
+	/usr/bin then printf "$1" ${HOME} | $(pwd) cd -eu sed -eu $(pwd) x=1 export
+then -eu export then $(pwd) grep 2>/dev/null
+grep /usr/bin test readonly sed
+"$@" echo && 'quoted text'
+	local && export readonly done local ${HOME} then 'quoted text' local x=1
+		2>/dev/null /usr/bin echo then /usr/bin
+	echo done grep echo local --verbose x=1 grep "$@" test ${HOME} grep echo
+		"$1" && "$1" echo /usr/bin test local grep cd sed /usr/bin readonly --verbose
+		--verbose ${HOME} "$1" printf 2>/dev/null 'quoted text' | "$1"
+cd cd $(pwd) then cd cd awk echo grep x=1 echo done 2>/dev/null
+	${HOME} export | export
+"$1" readonly "$1" then "$1" && /usr/bin export "$1" && x=1 $(pwd)
+		cd && $(pwd) test printf readonly local ${HOME}
+		$(pwd) awk echo echo awk --verbose
+		readonly $(pwd) then readonly export grep local export printf grep
+		readonly -eu awk /usr/bin cd done
+/usr/bin readonly && "$1" done | export grep /usr/bin cd | sed
+	echo --verbose awk "$@" --verbose 2>/dev/null "$1" printf then echo
+		local awk 'quoted text' done readonly "$@" "$1" cd "$@" 2>/dev/null
+	"$1" cd then sed readonly ${HOME}
+-eu test x=1 $(pwd) done echo
+grep ${HOME} "$@" grep then done -eu awk $(pwd) && sed 'quoted text' awk 'quoted text'
+	local && ${HOME} 2>/dev/null done --verbose 'quoted text'
+		&& grep echo ${HOME} $(pwd) 2>/dev/null && readonly --verbose printf
+cd local done grep sed ${HOME} "$1" done sed
+2>/dev/null readonly then | | cd done | 2>/dev/null ${HOME} printf local "$@" ${HOME}
+	${HOME} | then "$@" --verbose
+	&& sed --verbose printf
+		test grep 2>/dev/null awk export then
+	then awk 'quoted text' -eu export then "$1"
+		-eu --verbose sed sed cd export "$@" 2>/dev/null "$@" local grep
+		x=1 -eu grep local | "$@" /usr/bin
+grep grep cd /usr/bin $(pwd) ${HOME} && printf
+	$(pwd) /usr/bin echo cd echo && test done "$1" printf grep
+	readonly 2>/dev/null export cd $(pwd) | cd local && $(pwd) sed cd $(pwd)
+--verbose cd /usr/bin 'quoted text' $(pwd) cd test grep done
+		'quoted text' done "$@" echo 'quoted text' x=1 /usr/bin
+		--verbose $(pwd) -eu local 2>/dev/null 2>/dev/null
+	awk local ${HOME} x=1 2>/dev/null sed 2>/dev/null x=1
+&& "$1" printf done --verbose /usr/bin && local awk
+$(pwd) ${HOME} $(pwd) /usr/bin echo --verbose test && cd 'quoted text' /usr/bin
+		local $(pwd) -eu printf | sed "$1"
+		grep /usr/bin x=1 | sed /usr/bin -eu 2>/dev/null $(pwd) ${HOME} readonly | "$1"
+/usr/bin x=1 'quoted text'
+		then -eu && cd "$1" echo test grep "$@" && x=1 $(pwd) 'quoted text'
+		export sed test 'quoted text' --verbose
+test readonly -eu --verbose awk "$@"
+	"$@" -eu x=1 ${HOME} "$1" ${HOME} sed printf "$1" "$@"
+done local readonly awk $(pwd) --verbose | sed test &&
+	| /usr/bin then grep ${HOME} 2>/dev/null export ${HOME} 'quoted text'
+	then awk $(pwd) sed -eu cd local readonly awk --verbose
+		--verbose $(pwd) x=1 sed /usr/bin 2>/dev/null sed local then export cd "$1" local
+	readonly 2>/dev/null "$1" $(pwd) then test /usr/bin 'quoted text'
+		--verbose echo ${HOME} $(pwd) 'quoted text' "$1" done
+		"$@" awk printf export "$1" awk printf "$1"
+		done && && local awk --verbose && ${HOME} $(pwd)
+	test test sed printf $(pwd) export readonly
+		local awk done "$1" /usr/bin | -eu
+	export | cd sed x=1 local then then -eu grep
+	'quoted text' then /usr/bin then ${HOME} --verbose
+	echo grep 2>/dev/null x=1
+local then awk 2>/dev/null
+	done awk readonly awk "$1" test "$@" -eu echo readonly printf awk ${HOME}
+	&& readonly export 'quoted text' | -eu "$1" | "$@" -eu x=1 echo cd export $(pwd)
+	printf $(pwd) test -eu 2>/dev/null
+		then | 2>/dev/null local | ${HOME} test printf
+		cd -eu && echo grep then && 2>/dev/null
+sed ${HOME} awk local cd 'quoted text'
+		cd ${HOME} | awk 2>/dev/null ${HOME} printf 'quoted text' 'quoted text'
+--verbose export "$1" echo 'quoted text'
+		/usr/bin 2>/dev/null 2>/dev/null /usr/bin
+		export -eu then 'quoted text' local &&
+	echo readonly 'quoted text' x=1
+cd then && grep printf awk then /usr/bin --verbose
+	then local echo grep readonly "$@" sed
+	"$@" sed done $(pwd) done $(pwd)
+echo ${HOME} printf cd echo local test printf then test awk 2>/dev/null
+		$(pwd) --verbose && printf local | readonly
+		x=1 ${HOME} test printf
+	export export local /usr/bin "$@" cd echo done
+		cd "$1" /usr/bin cd --verbose readonly
+"$1" echo done cd && export cd printf echo "$@"
+readonly x=1 readonly then -eu "$@" then /usr/bin readonly
+x=1 ${HOME} $(pwd) sed echo
+		/usr/bin printf echo echo cd export x=1 sed done sed "$1" "$@" $(pwd)
+	sed export done "$1" then "$@" 'quoted text' sed
+sed x=1 ${HOME} grep echo --verbose $(pwd) test "$1" awk 'quoted text'
+		| && ${HOME} 'quoted text' printf 'quoted text' "$@" grep sed
+	$(pwd) grep 'quoted text' sed local done /usr/bin readonly cd "$@" export
+	cd printf -eu local 2>/dev/null
+	cd local readonly readonly export x=1 echo --verbose
+		done printf ${HOME} test grep x=1
+		-eu test printf "$1" local echo $(pwd) ${HOME}
+	x=1 awk "$@" "$@" x=1 'quoted text' test x=1 /usr/bin
+	'quoted text' export export cd local local grep export export x=1 test $(pwd)
+sed readonly 2>/dev/null --verbose then readonly local && then "$1"
+		cd ${HOME} printf 'quoted text' -eu awk readonly /usr/bin --verbose local
+		/usr/bin done -eu "$@"
+	"$@" --verbose readonly export then -eu export export "$1" && done sed
+grep 'quoted text' then echo grep "$1"
+$(pwd) 'quoted text' cd "$@" echo export "$@" then 'quoted text'
+		2>/dev/null "$@" printf ${HOME} ${HOME} echo awk "$1"
+	sed printf echo && awk cd ${HOME} export echo then $(pwd) local
+	readonly export "$@" x=1 /usr/bin then then awk grep /usr/bin ${HOME} done
+grep ${HOME} readonly grep grep 2>/dev/null 'quoted text' readonly
+x=1 echo export export && then sed | /usr/bin test | readonly
+		sed sed printf | x=1 printf | readonly x=1 grep
+	cd x=1 x=1 readonly local then
+	grep then --verbose sed printf "$1" export x=1 printf sed then echo 'quoted text'
+readonly | --verbose sed export printf $(pwd) -eu readonly cd cd --verbose
+		2>/dev/null sed done printf then
+	local -eu 'quoted text' "$@" printf sed
+'quoted text' 'quoted text' && local readonly $(pwd)
+done done printf echo "$1" 'quoted text' -eu | 2>/dev/null
+	local 2>/dev/null then export x=1 && --verbose test local local 2>/dev/null
+		grep awk && echo "$@" --verbose readonly
+echo done ${HOME} "$1" x=1 "$@" grep local --verbose
+		$(pwd) 2>/dev/null --verbose then && export test "$@" $(pwd) $(pwd) local then
+--verbose awk awk -eu awk test then grep 2>/dev/null 2>/dev/null
+		'quoted text' test export done | then ${HOME} ${HOME} cd | 'quoted text'
+		$(pwd) cd ${HOME} 'quoted text' $(pwd) ${HOME} /usr/bin
+sed x=1 then "$@" export
+	awk sed && local awk 2>/dev/null && test | x=1 readonly printf grep x=1
+"$1" | export awk done printf test -eu echo "$@" then | done 'quoted text'
+		awk /usr/bin then x=1 'quoted text'
+		readonly "$1" echo "$1" -eu x=1 --verbose printf done printf "$1" x=1 -eu x=1
+		awk | test $(pwd) x=1 $(pwd) done && then done | --verbose 2>/dev/null readonly
+	"$1" --verbose echo readonly local local 2>/dev/null --verbose
+sed test /usr/bin echo
+	echo export | x=1 test "$@" ${HOME} "$@" -eu $(pwd)
+	&& -eu cd $(pwd) /usr/bin readonly cd 'quoted text' done "$1" ${HOME}
+		'quoted text' ${HOME} x=1 x=1 then /usr/bin local echo "$1" x=1 && test
+"$@" awk test awk then cd export
+	readonly /usr/bin 2>/dev/null /usr/bin "$1" echo echo
+${HOME} x=1 local echo then 2>/dev/null sed x=1 cd readonly |
+| /usr/bin x=1 -eu 'quoted text'
+done ${HOME} "$1" awk | echo | 2>/dev/null ${HOME} local readonly export $(pwd)
+		-eu readonly ${HOME} | "$1" test printf echo export 2>/dev/null $(pwd) local &&
+$(pwd) 'quoted text' && 2>/dev/null awk $(pwd) then readonly local 'quoted text'
+	| readonly 'quoted text' $(pwd) 2>/dev/null 2>/dev/null
+'quoted text' ${HOME} local -eu export && cd ${HOME} $(pwd) echo /usr/bin
+	2>/dev/null --verbose export
+	x=1 2>/dev/null $(pwd) export 2>/dev/null
+		"$1" sed "$1" "$@" ${HOME} export readonly
+	cd /usr/bin "$@" x=1 --verbose 'quoted text' x=1 local && readonly -eu cd 'quoted text'
+&& -eu local 2>/dev/null 2>/dev/null /usr/bin "$@" 'quoted text'
+	'quoted text' && then "$1" cd export
+awk echo && | && x=1 grep
+cd readonly x=1 -eu done x=1 --verbose
+		sed sed 2>/dev/null awk cd export --verbose echo awk "$@" -eu printf echo then
+	| printf local grep grep sed && ${HOME} x=1
+	/usr/bin "$@" grep && then $(pwd)
+&& cd x=1 done awk echo -eu readonly -eu && grep done local 'quoted text' readonly
+"$@" --verbose readonly -eu sed && then awk test readonly 2>/dev/null
+	echo test cd $(pwd) $(pwd) echo /usr/bin "$1" awk "$1" && --verbose readonly
+	local awk $(pwd) printf awk -eu done --verbose done && readonly local done
+		&& ${HOME} grep ${HOME}
+	echo then local "$1" -eu | local "$@" grep echo readonly
+		2>/dev/null -eu export 2>/dev/null
+	awk printf export then 2>/dev/null
+	echo test awk test "$1" && $(pwd) cd | x=1 printf local 2>/dev/null
+	-eu $(pwd) sed 2>/dev/null -eu readonly x=1 $(pwd) "$1" readonly 'quoted text'
+test awk local echo cd /usr/bin x=1 readonly 'quoted text' "$1" echo
+	'quoted text' echo "$@" ${HOME}
+	x=1 grep test sed && test && test /usr/bin /usr/bin readonly
+		test grep x=1 && export printf | $(pwd) $(pwd) export printf --verbose echo
+	then -eu then "$@" done x=1 awk awk "$1" -eu echo --verbose 2>/dev/null echo done
+		-eu && printf "$@" then grep x=1 "$1" echo export grep export
+	test -eu grep then then $(pwd) ${HOME} --verbose
+		x=1 test export 2>/dev/null ${HOME} awk 'quoted text'
+readonly x=1 local test 'quoted text'
+	then export cd "$1" $(pwd) test export
+		readonly local 'quoted text'
+		echo printf && 2>/dev/null local 2>/dev/null done awk echo done "$1" "$1" echo printf
+cd 'quoted text' "$@" then 'quoted text' $(pwd) export 'quoted text' ${HOME}
+		printf readonly $(pwd) 2>/dev/null readonly cd $(pwd) --verbose
+		/usr/bin done then then "$1" done readonly readonly --verbose
+	/usr/bin export 'quoted text' printf 2>/dev/null
+	local 2>/dev/null then | ${HOME} 2>/dev/null
+awk 'quoted text' x=1 --verbose done
+		/usr/bin cd "$@" x=1 cd x=1 ${HOME} export && echo sed done -eu
+		readonly "$@" --verbose readonly "$1" awk
+	"$@" 2>/dev/null | "$1" -eu 2>/dev/null local | 2>/dev/null && && /usr/bin
+export "$@" "$1" | "$1" x=1 printf awk done then --verbose awk
+	2>/dev/null -eu x=1 readonly /usr/bin test "$@" local then ${HOME}
+	'quoted text' --verbose /usr/bin echo
+grep done x=1 then "$1" x=1 /usr/bin echo /usr/bin && readonly export
+2>/dev/null "$1" /usr/bin $(pwd) -eu echo awk cd done export "$1" awk x=1
+		-eu local --verbose grep 2>/dev/null export
+	$(pwd) sed local sed then cd ${HOME} x=1 export cd 2>/dev/null echo done "$1"
+		$(pwd) && grep -eu local | && readonly local local /usr/bin
+	then -eu "$@" --verbose --verbose
+		echo awk sed sed cd "$1" readonly sed ${HOME} x=1 /usr/bin ${HOME}
+	$(pwd) readonly then printf readonly 'quoted text'
+echo 2>/dev/null x=1 "$1" export
+	/usr/bin then awk ${HOME} 2>/dev/null cd x=1 "$@" /usr/bin done
+		sed export test x=1 2>/dev/null "$@" export printf x=1 ${HOME} grep
+		| 2>/dev/null $(pwd) local printf local done then 2>/dev/null 'quoted text'
+		"$1" done x=1 cd local x=1 $(pwd) local
+		--verbose x=1 'quoted text' local 'quoted text'
+		then $(pwd) printf /usr/bin export cd readonly 'quoted text' test sed
+	test $(pwd) local 2>/dev/null
+done ${HOME} /usr/bin test test export printf then ${HOME} cd
+	&& export "$1" echo echo 'quoted text'
+	| x=1 2>/dev/null 'quoted text' awk && printf
+		cd | grep grep $(pwd) "$1" -eu awk sed done done then | sed
+		'quoted text' echo export export $(pwd) local | awk x=1 readonly 'quoted text'
+	grep echo $(pwd) sed | "$1" done local awk 2>/dev/null test cd
+	/usr/bin cd $(pwd) "$1" then grep 2>/dev/null 'quoted text' readonly export
+	-eu test echo cd --verbose
+		-eu export "$@" readonly 2>/dev/null
+		2>/dev/null ${HOME} echo && then cd 'quoted text'
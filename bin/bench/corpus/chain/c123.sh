@@ -0,0 +1,2001 @@
+awk "$1" "$1" cd $(pwd) grep done done 2>/dev/null
+	-eu awk sed then cd test local export -eu $(pwd)
+cd 'quoted text' "$@" -eu --verbose /usr/bin
+${HOME} 'quoted text' -eu awk
+	printf printf ${HOME} grep
+	| -eu done then local test --verbose done && $(pwd) x=1 cd
+	${HOME} awk then -eu /usr/bin
+		'quoted text' echo 'quoted text' | awk ${HOME} echo ${HOME} awk
+	/usr/bin test echo readonly
+		done "$1" $(pwd) ${HOME} then --verbose
+x=1 && x=1 && awk | 'quoted text'
+	then done grep export | "$1" echo --verbose done
+		| 2>/dev/null "$1" cd done "$@" /usr/bin
+sed --verbose 'quoted text' awk /usr/bin sed x=1 readonly
+		test ${HOME} "$1" grep sed $(pwd) local | --verbose
+	local local 'quoted text' grep grep then export grep 'quoted text'
+	sed local printf ${HOME} "$@" && && /usr/bin 'quoted text'
+cd "$1" done ${HOME} awk |
+	echo ${HOME} --verbose "$1" export 'quoted text'
+		grep readonly /usr/bin test grep "$@" cd test cd /usr/bin local printf readonly
+	--verbose /usr/bin printf 2>/dev/null echo awk
+		/usr/bin grep printf -eu echo local --verbose then
+		grep grep --verbose export awk $(pwd) awk printf -eu ${HOME} | echo "$@"
+	--verbose awk readonly test 2>/dev/null export awk
+		--verbose grep "$@" /usr/bin printf x=1 done test export
+	printf /usr/bin printf awk && ${HOME} grep test $(pwd)
+		x=1 local ${HOME} export awk 'quoted text' sed 'quoted text' cd | 2>/dev/null
+		test readonly 2>/dev/null "$1" /usr/bin cd awk --verbose "$1"
+	cd && -eu 'quoted text' "$1" x=1 awk printf 'quoted text'
+grep export "$1" /usr/bin
+2>/dev/null awk readonly --verbose 'quoted text' echo cd printf
+"$1" $(pwd) export && 2>/dev/null cd 'quoted text'
+		sed "$@" export sed $(pwd) /usr/bin 'quoted text' "$@" && grep readonly "$@"
+$(pwd) done /usr/bin | readonly && && test awk 2>/dev/null --verbose
+done sed export && grep ${HOME} awk
+"$1" /usr/bin --verbose "$1" then readonly cd
+	$(pwd) /usr/bin && "$1" printf local sed cd printf done x=1
+	awk && printf "$@" "$1" local
+done 2>/dev/null $(pwd) readonly --verbose 2>/dev/null printf
+		"$@" sed "$@" export sed export | grep
+		$(pwd) 2>/dev/null export
+	"$@" sed x=1 ${HOME} test 2>/dev/null /usr/bin /usr/bin test cd 'quoted text'
+	--verbose && export echo
+-eu ${HOME} "$1" x=1 'quoted text' echo test then then cd 2>/dev/null "$1" local
+then done 'quoted text' 'quoted text' then awk /usr/bin -eu
+		printf | awk done | then x=1 printf
+		cd export echo --verbose "$@" export x=1 'quoted text'
+	test test 'quoted text' 'quoted text'
+		'quoted text' ${HOME} -eu 'quoted text'
+		readonly done ${HOME} readonly 'quoted text' && test $(pwd)
+'quoted text' echo | $(pwd) 'quoted text'
+		${HOME} sed "$1" 'quoted text' grep
+readonly sed readonly --verbose cd echo awk readonly && local ${HOME} test
+		echo then $(pwd) awk -eu | -eu "$1" ${HOME} readonly ${HOME} 2>/dev/null then 'quoted text'
+	-eu readonly test export "$@" ${HOME} echo -eu grep -eu "$1" awk
+sed | echo cd sed 'quoted text' echo export
+	"$@" 2>/dev/null x=1 local local local 2>/dev/null | sed awk cd done 'quoted text'
+	test ${HOME} then readonly done -eu then 2>/dev/null $(pwd) -eu "$1" export then
+		readonly && export /usr/bin awk cd --verbose -eu grep ${HOME}
+	"$1" echo cd sed | 'quoted text' local x=1 | sed "$@" --verbose /usr/bin "$@"
+	--verbose $(pwd) ${HOME} grep | --verbose
+"$@" grep 2>/dev/null --verbose /usr/bin ${HOME} done test "$@" echo x=1
+	| -eu "$@" awk && printf test export 'quoted text' $(pwd)
+		2>/dev/null && "$1" printf cd | 2>/dev/null
+	--verbose && && echo
+		$(pwd) -eu awk | -eu "$1" 2>/dev/null echo then grep $(pwd) echo --verbose echo
+"$1" printf | sed local cd awk
+		${HOME} export cd readonly cd 'quoted text' "$1" --verbose echo $(pwd)
+	cd grep && 2>/dev/null printf readonly "$1" /usr/bin local local
+		"$1" local /usr/bin &&
+	"$@" "$1" "$1" && test 2>/dev/null x=1
+	sed done --verbose then sed --verbose x=1 ${HOME} export awk
+local sed printf echo echo "$1" done ${HOME}
+	--verbose $(pwd) cd --verbose /usr/bin | 2>/dev/null
+-eu "$@" && "$1" -eu
+-eu local sed && "$1" $(pwd)
+	${HOME} awk x=1 echo sed grep $(pwd) local "$1" printf sed "$1" --verbose
+		awk 'quoted text' done 'quoted text' x=1 -eu 'quoted text'
+--verbose printf 2>/dev/null cd
+x=1 && | "$@" echo done "$1" readonly
+	$(pwd) then test test "$@" awk
+export --verbose echo echo --verbose -eu | ${HOME} grep cd printf local awk
+	--verbose "$1" sed export sed awk done done readonly
+"$1" echo x=1 "$1" /usr/bin /usr/bin "$@" /usr/bin readonly "$1" -eu "$@"
+		x=1 $(pwd) awk awk /usr/bin --verbose
+		cd sed $(pwd) export x=1 2>/dev/null then "$@" | then cd "$1" test | local $(pwd)
+	"$@" awk sed x=1 local readonly local grep grep printf sed
+		/usr/bin printf echo 'quoted text'
+	awk then $(pwd) sed "$@" "$@" readonly
+	'quoted text' ${HOME} "$1" local echo printf -eu ${HOME} local done local
+		&& 'quoted text' awk done sed readonly
+		printf echo test 2>/dev/null
+	test "$1" grep local echo grep readonly /usr/bin
+awk "$1" 2>/dev/null export sed | printf x=1 awk then --verbose then export test
+		x=1 export ${HOME} --verbose cd cd 'quoted text' sed ${HOME}
+	'quoted text' --verbose awk cd "$1" readonly 2>/dev/null echo cd && $(pwd) export
+-eu printf 2>/dev/null x=1 done 2>/dev/null x=1 "$@" export
+		-eu readonly readonly export --verbose | done --verbose
+	readonly export | "$@" --verbose $(pwd) 'quoted text'
+${HOME} 2>/dev/null 'quoted text'
+	$(pwd) && sed 2>/dev/null $(pwd) 'quoted text' "$1"
+$(pwd) /usr/bin 2>/dev/null export $(pwd)
+2>/dev/null -eu x=1 "$@" "$1" readonly 'quoted text'
+sed /usr/bin --verbose local x=1 test printf x=1 /usr/bin
+test -eu awk export cd "$@" --verbose "$@" 2>/dev/null done done done -eu -eu
+export -eu awk /usr/bin local done /usr/bin x=1 done
+grep 2>/dev/null readonly grep printf
+done then test local "$1"
+printf cd x=1 /usr/bin printf $(pwd) "$@"
+	--verbose echo ${HOME} done echo
+local echo 2>/dev/null
+	$(pwd) 2>/dev/null grep sed local x=1 && then cd
+"$1" ${HOME} local x=1 'quoted text'
+	"$1" sed printf --verbose | cd done x=1 readonly printf export sed 'quoted text'
+cd | echo "$@" local 2>/dev/null
+	x=1 'quoted text' sed printf test test 'quoted text' x=1
+		test 'quoted text' grep readonly readonly $(pwd) 2>/dev/null
+| readonly -eu /usr/bin readonly printf grep printf "$@" sed x=1 "$@" "$1"
+done done ${HOME} /usr/bin -eu "$1" local grep printf
+sed 2>/dev/null test "$@" --verbose sed /usr/bin printf local
+		sed local cd x=1 cd --verbose echo
+sed --verbose "$1" test $(pwd) local --verbose
+grep -eu 'quoted text' export test |
+cd 2>/dev/null echo x=1 2>/dev/null local cd local
+	--verbose x=1 x=1 local "$1" cd local grep readonly test
+	&& "$1" local /usr/bin printf
+		then --verbose | export done --verbose && test
+		&& cd 2>/dev/null then /usr/bin x=1 $(pwd)
+		readonly "$1" ${HOME} local --verbose -eu export
+export 'quoted text' then readonly then 2>/dev/null echo ${HOME} printf /usr/bin
+	'quoted text' "$@" 2>/dev/null ${HOME} /usr/bin local grep x=1 | echo
+| $(pwd) 2>/dev/null /usr/bin test export x=1 -eu echo "$@" /usr/bin ${HOME} "$@"
+done ${HOME} 'quoted text'
+grep $(pwd) awk "$1" grep --verbose
+		done then "$1" test test
+/usr/bin export awk 2>/dev/null
+local done $(pwd) echo sed done awk | $(pwd) readonly
+	2>/dev/null -eu sed "$1" | grep 2>/dev/null then test readonly echo
+export sed ${HOME} local then --verbose /usr/bin grep
+	grep ${HOME} export sed x=1 2>/dev/null -eu awk awk 'quoted text' ${HOME}
+		"$1" ${HOME} then "$1" awk done --verbose 2>/dev/null 'quoted text' 'quoted text'
+local $(pwd) readonly --verbose ${HOME} -eu | -eu 'quoted text' grep $(pwd) --verbose
+	grep printf done sed "$@" awk local grep sed
+	awk done --verbose /usr/bin
+	cd done cd 2>/dev/null "$1" --verbose
+		2>/dev/null sed local -eu 2>/dev/null x=1 /usr/bin "$1" export $(pwd)
+		local /usr/bin awk done
+	x=1 $(pwd) local x=1 local done
+	test readonly ${HOME} awk
+	/usr/bin && "$1" local test && $(pwd) sed local --verbose
+	sed grep local x=1 "$1" printf /usr/bin readonly awk grep &&
+		"$1" | then $(pwd) "$1" | && test 2>/dev/null cd readonly test then
+		then sed local | test 2>/dev/null
+		x=1 x=1 test /usr/bin
+	cd awk "$@" --verbose "$1" test done sed done echo
+sed export x=1 awk "$1" &&
+readonly printf 'quoted text' && | "$@"
+	-eu echo local awk cd 2>/dev/null 2>/dev/null 2>/dev/null
+local ${HOME} readonly sed x=1
+	local export export then x=1
+&& -eu done -eu | grep local 2>/dev/null ${HOME}
+		${HOME} cd grep x=1 echo 2>/dev/null
+--verbose local export readonly && test printf --verbose cd echo test done "$@"
+test echo readonly cd cd --verbose ${HOME} then "$1"
+2>/dev/null && grep x=1 local 'quoted text' done
+	$(pwd) then x=1 -eu grep "$@" -eu /usr/bin x=1 && 'quoted text' --verbose
+		printf export 2>/dev/null cd ${HOME} sed -eu /usr/bin $(pwd)
+	done echo grep sed 'quoted text'
+| /usr/bin x=1 x=1 then sed 'quoted text'
+	cd printf local export cd && test
+	then awk -eu -eu --verbose printf "$1" 'quoted text' grep
+		sed local grep done 2>/dev/null awk
+	export done x=1 readonly "$@" readonly cd 2>/dev/null | -eu -eu test
+		--verbose && cd local ${HOME} test /usr/bin done --verbose
+	"$1" cd ${HOME} export awk ${HOME} --verbose $(pwd) cd awk local "$@" sed ${HOME}
+grep done local echo --verbose -eu /usr/bin grep /usr/bin "$1"
+"$1" then cd sed grep local
+	"$@" | printf grep 2>/dev/null export awk readonly
+$(pwd) local grep $(pwd) echo
+	2>/dev/null grep grep cd 2>/dev/null
+awk $(pwd) done && | "$1" printf test readonly grep "$@" awk readonly awk
+printf "$@" printf awk done export grep 2>/dev/null
+	local x=1 awk "$@" awk
+	&& | readonly cd && 2>/dev/null grep readonly $(pwd)
+cd "$1" "$@" then && -eu export
+		then "$@" x=1 awk "$1" $(pwd) sed export local 2>/dev/null
+		x=1 --verbose then sed sed ${HOME} then "$1" | "$@" awk grep grep done then
+	export local echo "$1" export echo cd awk
+sed && export readonly sed echo test then --verbose
+		sed then "$@" 2>/dev/null readonly cd done grep 2>/dev/null
+then then readonly done test | grep done grep printf grep x=1
+		grep grep printf grep $(pwd) printf done readonly printf grep readonly
+	2>/dev/null /usr/bin "$@" printf "$1" local sed 2>/dev/null done grep test local
+| awk "$@" export $(pwd) printf printf echo x=1 /usr/bin
+	| 2>/dev/null "$1" 'quoted text' -eu -eu 'quoted text' echo 'quoted text'
+local sed echo export && ${HOME} ${HOME} then grep local $(pwd) "$1" printf
+		'quoted text' && local readonly test cd done --verbose echo --verbose
+x=1 grep 'quoted text' -eu test 'quoted text' local
+		local local test /usr/bin export readonly done x=1 --verbose done "$@" /usr/bin
+	grep && $(pwd) grep printf readonly then
+	-eu -eu then sed then cd $(pwd) -eu echo then "$@" "$1"
+grep export printf | then && readonly echo sed
+	export 'quoted text' grep /usr/bin | && $(pwd) awk
+	done test "$@" awk -eu export done done test x=1 && then x=1
+	local local x=1 sed cd
+		awk /usr/bin printf && printf ${HOME} sed "$@" "$1" $(pwd) awk -eu -eu
+		-eu "$1" done awk "$1" echo 'quoted text' test -eu 'quoted text' done --verbose
+	then local done awk readonly done then done
+	/usr/bin printf 2>/dev/null cd test grep awk cd export
+		2>/dev/null -eu awk cd printf
+	cd readonly 2>/dev/null then && $(pwd) /usr/bin "$@" --verbose --verbose
+export /usr/bin cd echo "$@" 2>/dev/null x=1 cd done $(pwd) $(pwd)
+--verbose 'quoted text' "$@" cd grep && | then awk ${HOME}
+	| cd "$@" --verbose done sed echo printf then --verbose local
+"$1" done | grep "$1"
+sed | sed test "$1" "$1" --verbose done
+	cd "$1" cd ${HOME} "$1" grep export echo readonly | x=1 local
+$(pwd) echo printf -eu $(pwd)
+	readonly /usr/bin -eu --verbose
+export /usr/bin readonly --verbose readonly printf
+	-eu $(pwd) "$@" --verbose awk x=1 test local test $(pwd) && awk export
+	awk ${HOME} readonly printf
+		"$@" sed cd -eu /usr/bin --verbose $(pwd)
+export sed -eu $(pwd) $(pwd) 2>/dev/null
+&& $(pwd) "$1" "$1" ${HOME} export test x=1 "$1" sed cd
+	2>/dev/null readonly && printf | echo
+		"$@" echo printf $(pwd) "$1" x=1 --verbose -eu grep sed x=1 grep printf printf
+		"$@" $(pwd) --verbose /usr/bin x=1 then x=1 'quoted text'
+"$1" | /usr/bin then local 2>/dev/null
+		&& "$@" echo awk local readonly ${HOME} /usr/bin $(pwd) awk "$@" ${HOME}
+export 2>/dev/null grep 2>/dev/null test readonly export /usr/bin readonly
+		$(pwd) readonly printf $(pwd) export
+/usr/bin /usr/bin x=1 --verbose "$1" done 2>/dev/null /usr/bin 2>/dev/null
+export $(pwd) && test sed -eu sed -eu -eu printf export
+	2>/dev/null sed && local 2>/dev/null "$1" "$@" 'quoted text' awk
+	test sed $(pwd) grep | export "$1" cd 2>/dev/null test ${HOME}
+local done export 'quoted text'
+		-eu | then cd /usr/bin --verbose test ${HOME} && 2>/dev/null then
+-eu /usr/bin "$1" 2>/dev/null $(pwd) /usr/bin
+	x=1 done 2>/dev/null ${HOME} readonly "$@" readonly test awk printf 'quoted text'
+		readonly cd "$1" then --verbose
+export local x=1 x=1 awk -eu "$1" x=1 echo echo
+local 2>/dev/null test 2>/dev/null echo
+	awk echo x=1 echo 'quoted text' x=1 --verbose
+		echo x=1 printf 'quoted text' export | then export readonly readonly local "$1"
+		"$@" -eu --verbose awk
+export export done -eu --verbose "$1" readonly | sed "$@" local "$1"
+	readonly "$1" cd cd then sed readonly /usr/bin then x=1 "$@" ${HOME} export
+		'quoted text' "$1" && readonly cd && sed
+		grep ${HOME} 2>/dev/null printf sed then /usr/bin
+	echo test --verbose echo $(pwd) local local && --verbose $(pwd)
+		grep test readonly x=1 done "$@" sed readonly then done export -eu grep echo
+x=1 ${HOME} "$1" then export --verbose awk readonly 2>/dev/null local echo
+readonly && done test -eu "$1"
+		printf | done export "$1" "$@" printf -eu readonly
+		| then done 'quoted text' "$@" x=1 echo grep 'quoted text'
+	grep 2>/dev/null then printf "$@" grep
+		cd awk && awk && export 'quoted text'
+		awk then "$1" echo -eu 'quoted text'
+		export && -eu sed x=1 readonly 2>/dev/null 'quoted text'
+cd grep export test $(pwd) "$1" /usr/bin -eu readonly sed 'quoted text'
+		2>/dev/null | --verbose ${HOME} grep
+		echo local "$1" test printf -eu printf done
+	"$@" printf printf ${HOME}
+'quoted text' --verbose "$1" export then awk ${HOME} | local 2>/dev/null
+	awk export grep printf 'quoted text' "$1" awk 2>/dev/null local
+		cd readonly readonly ${HOME} "$@" --verbose cd -eu export printf export
+		${HOME} then $(pwd) echo /usr/bin $(pwd) awk done cd --verbose
+printf $(pwd) grep ${HOME} readonly
+		local export -eu then 'quoted text' local then test $(pwd)
+		echo | | then $(pwd) "$1" done printf then echo local
+2>/dev/null then grep then echo echo echo "$1" "$1" sed ${HOME}
+		export | grep echo grep
+	printf -eu $(pwd) -eu
+${HOME} local 'quoted text' cd readonly awk printf sed then /usr/bin
+local cd ${HOME} echo x=1 && readonly printf cd sed -eu cd sed
+		local $(pwd) "$@" --verbose grep /usr/bin echo --verbose
+	cd "$1" --verbose --verbose x=1 readonly "$1" printf
+	cd then then test grep
+	then grep then "$1" readonly
+	"$@" "$@" test awk sed
+done "$@" ${HOME} readonly x=1
+		echo local $(pwd) "$1" cd test
+	| /usr/bin && "$1" ${HOME} $(pwd) sed "$1" export | x=1 cd 2>/dev/null cd
+	$(pwd) done "$1" cd local "$@" --verbose "$@"
+		export sed sed grep echo
+readonly "$@" /usr/bin
+	grep grep --verbose -eu --verbose x=1 readonly sed 2>/dev/null
+		&& --verbose /usr/bin $(pwd) ${HOME} | awk ${HOME} awk x=1 && /usr/bin
+&& $(pwd) x=1 /usr/bin echo cd /usr/bin readonly sed
+--verbose grep done export 2>/dev/null --verbose
+		sed export 'quoted text'
+		2>/dev/null done sed 'quoted text' test 2>/dev/null -eu 2>/dev/null grep "$1" 2>/dev/null
+		&& echo local /usr/bin readonly echo "$@" cd
+	2>/dev/null "$1" printf 'quoted text' echo
+		done grep printf --verbose readonly echo awk "$@" test export grep && x=1
+	/usr/bin --verbose $(pwd) awk
+	export export 2>/dev/null $(pwd) 'quoted text' 2>/dev/null cd /usr/bin test
+printf -eu $(pwd) test test cd done export ${HOME}
+	then test grep --verbose 2>/dev/null local --verbose
+		export | /usr/bin grep sed | $(pwd) x=1 --verbose then cd grep "$@" 2>/dev/null
+		awk test done echo ${HOME} 2>/dev/null --verbose then
+cd local | cd $(pwd) echo | done
+		"$@" done cd sed done awk awk awk ${HOME} local && ${HOME} &&
+	x=1 | awk done local --verbose sed
+	printf echo echo $(pwd) export printf
+	/usr/bin /usr/bin test ${HOME} x=1 "$1" --verbose then sed "$1" 2>/dev/null
+local echo sed ${HOME} grep local test --verbose && cd done
+		readonly echo export /usr/bin x=1 -eu
+		$(pwd) "$@" && | /usr/bin printf done grep awk --verbose local --verbose local
+/usr/bin cd cd "$@" printf
+	-eu && echo "$@" -eu readonly -eu test cd readonly 'quoted text'
+'quoted text' $(pwd) echo done cd awk cd sed
+export 2>/dev/null x=1 | echo echo && cd 2>/dev/null -eu
+		"$1" then "$1" "$@" then
+-eu | x=1 x=1 readonly
+	2>/dev/null && 'quoted text' x=1 /usr/bin then $(pwd) echo --verbose readonly
+awk local ${HOME} cd sed test export "$1"
+'quoted text' && echo "$1" | 'quoted text' 'quoted text' test $(pwd) "$@" export
+	"$1" | printf && "$1" "$@" sed $(pwd) export then --verbose "$@" awk $(pwd)
+printf -eu sed "$@" awk test echo cd readonly
+		2>/dev/null readonly --verbose x=1
+	| x=1 sed /usr/bin ${HOME} $(pwd) printf 'quoted text'
+		local 'quoted text' sed grep | awk awk test $(pwd)
+		grep local readonly 2>/dev/null test awk then readonly awk local /usr/bin
+		printf awk ${HOME} && echo printf 2>/dev/null
+		--verbose awk "$@" "$@" --verbose done 'quoted text'
+		awk awk awk done /usr/bin
+		"$1" "$@" /usr/bin $(pwd) && && then 'quoted text' --verbose
+x=1 local awk | done x=1 x=1 /usr/bin "$1" grep 2>/dev/null $(pwd)
+"$@" x=1 x=1 'quoted text' export 'quoted text' 2>/dev/null
+	local "$1" export echo done cd sed -eu then awk awk 2>/dev/null
+	$(pwd) $(pwd) ${HOME} cd $(pwd) ${HOME} 'quoted text' /usr/bin test cd /usr/bin
+	readonly local x=1 && x=1 $(pwd) sed --verbose done $(pwd)
+		$(pwd) then && 'quoted text' echo grep awk echo grep --verbose local "$1"
+		$(pwd) awk echo local local ${HOME}
+--verbose awk -eu --verbose readonly printf local "$1"
+		x=1 awk export -eu $(pwd) 'quoted text' && && "$1" && grep && grep sed
+grep done /usr/bin ${HOME} readonly "$@" "$@" x=1 2>/dev/null test --verbose
+		${HOME} /usr/bin && grep /usr/bin local readonly "$1" done echo "$1" "$1" readonly
+		&& export "$@" /usr/bin done done 'quoted text' then printf done /usr/bin 'quoted text'
+	echo "$1" ${HOME} 2>/dev/null 'quoted text' sed
+		&& test | --verbose sed grep readonly /usr/bin
+sed echo 'quoted text' x=1 sed /usr/bin $(pwd) | readonly
+		echo $(pwd) "$@" $(pwd) done --verbose test
+		$(pwd) --verbose echo grep readonly
+done cd then | 'quoted text'
+export echo printf test echo local export
+	readonly /usr/bin grep 'quoted text' $(pwd)
+| 2>/dev/null | --verbose done then && && export awk ${HOME} && done 'quoted text'
+cd then printf | "$1" ${HOME} export
+		readonly printf test 2>/dev/null test echo "$@" printf then
+	$(pwd) --verbose | echo --verbose | 'quoted text' "$@" -eu 'quoted text'
+cd x=1 --verbose awk test awk
+	"$1" done 'quoted text' local
+readonly grep sed 2>/dev/null cd $(pwd) grep awk --verbose
+	test | | $(pwd) awk readonly
+echo /usr/bin readonly "$@" test grep sed readonly done done readonly local
+		$(pwd) && x=1 "$@" 'quoted text' echo ${HOME} /usr/bin &&
+		${HOME} x=1 sed done export local done 2>/dev/null "$@" x=1 "$1" then -eu --verbose
+x=1 grep sed 2>/dev/null readonly printf readonly sed --verbose
+then -eu printf awk printf x=1 -eu awk "$1" "$1"
+		--verbose x=1 "$@" export readonly $(pwd) --verbose awk -eu cd x=1 test x=1
+		--verbose "$1" | $(pwd) local sed cd "$@" | "$1" grep && x=1
+| export local awk ${HOME} echo "$1" | 'quoted text' export echo
+		grep 'quoted text' --verbose awk 'quoted text' ${HOME} then
+	${HOME} && readonly grep done grep
+	grep 'quoted text' /usr/bin local --verbose then
+${HOME} echo --verbose x=1
+		2>/dev/null "$1" $(pwd) &&
+		x=1 test 'quoted text'
+2>/dev/null printf --verbose test /usr/bin sed --verbose cd echo grep
+		echo ${HOME} 2>/dev/null /usr/bin --verbose "$@" && then --verbose /usr/bin test
+'quoted text' $(pwd) x=1 cd && done printf $(pwd) -eu
+awk then test 'quoted text'
+		echo then awk printf "$@" done then "$1" | cd export 2>/dev/null done
+		test | printf sed awk then x=1 sed echo 'quoted text' sed test $(pwd) $(pwd)
+		2>/dev/null cd test echo cd ${HOME} local then
+		2>/dev/null -eu --verbose export x=1 done $(pwd) local
+export done printf && printf && --verbose
+		--verbose -eu readonly printf -eu grep x=1
+cd | then awk "$1" export sed printf --verbose
+readonly /usr/bin printf done /usr/bin
+	| /usr/bin -eu $(pwd) "$1" readonly --verbose && $(pwd) export then ${HOME}
+echo --verbose export
+	$(pwd) readonly "$@" /usr/bin echo then --verbose then cd awk
+	grep grep 2>/dev/null "$1" cd && then | sed readonly echo ${HOME} local readonly
+		'quoted text' x=1 echo printf "$1" 'quoted text' "$@" x=1 export $(pwd) $(pwd)
+x=1 "$1" $(pwd) | 'quoted text' --verbose x=1 | awk && "$1"
+		awk /usr/bin | x=1 grep test
+	sed done | echo "$@" local 2>/dev/null awk ${HOME} echo cd readonly
+		grep local cd test awk printf
+		cd x=1 $(pwd) sed grep
+then -eu x=1 ${HOME} sed 2>/dev/null export "$@" --verbose
+sed export -eu "$@" | printf "$@" | "$1" test then grep ${HOME} "$1"
+	done ${HOME} | export cd "$@" $(pwd) local echo $(pwd) | && "$1"
+${HOME} "$1" cd printf 2>/dev/null awk then
+	-eu 'quoted text' awk ${HOME} $(pwd) then done "$@" "$1" /usr/bin "$@" export
+awk sed ${HOME} | awk -eu
+		&& --verbose export --verbose
+		readonly | printf x=1 test 'quoted text' x=1 $(pwd) done /usr/bin 'quoted text'
+		| -eu then 2>/dev/null echo printf
+sed $(pwd) | awk | sed readonly awk /usr/bin | "$1" x=1 "$1" /usr/bin
+awk echo ${HOME} cd | -eu grep && | /usr/bin
+		/usr/bin awk $(pwd) 2>/dev/null | 2>/dev/null
+printf local then readonly "$@" 2>/dev/null
+	--verbose "$@" /usr/bin then
+	&& done test awk ${HOME} ${HOME} "$@" "$1"
+--verbose "$@" x=1 echo --verbose $(pwd) awk printf "$@" x=1
+| done echo awk x=1 /usr/bin grep done awk $(pwd)
+		&& readonly && x=1 cd export grep -eu then --verbose | echo $(pwd) -eu 'quoted text'
+$(pwd) grep done grep sed
+		sed | printf cd printf 2>/dev/null echo done grep
+	--verbose done -eu local ${HOME} readonly "$@" done then export
+		"$@" ${HOME} && /usr/bin printf x=1 awk then | "$@" 2>/dev/null
+grep awk "$@" sed cd "$1" then -eu 'quoted text' --verbose
+	| awk --verbose local -eu | -eu
+		x=1 "$1" sed -eu echo sed local test ${HOME} $(pwd) awk /usr/bin
+		-eu cd ${HOME} "$@" awk 2>/dev/null grep readonly
+	/usr/bin test x=1 /usr/bin
+		printf --verbose cd "$@" printf | grep readonly
+	printf "$@" /usr/bin $(pwd) --verbose
+&& "$@" local awk local export x=1 awk awk printf grep export printf grep
+	| "$1" /usr/bin x=1 export $(pwd) readonly local done $(pwd) -eu sed
+	readonly readonly echo test $(pwd)
+		'quoted text' 'quoted text' $(pwd) "$1" printf awk "$1" 'quoted text'
+	echo echo "$@" readonly grep echo "$1" x=1 cd grep
+		printf echo x=1 then
+sed 2>/dev/null cd local awk && --verbose "$@" 'quoted text'
+		| $(pwd) readonly -eu local
+		then "$1" -eu done && test $(pwd) grep grep export then $(pwd) grep
+	awk done export x=1 "$1" --verbose export
+	done printf sed $(pwd) -eu | -eu 'quoted text' && then | -eu echo
+${HOME} test done readonly test
+		"$@" 'quoted text' done done done then
+	/usr/bin "$1" grep then "$1" test "$@" local awk done export
+sed | local | ${HOME} sed | 2>/dev/null
+cd 'quoted text' | awk -eu then then awk cd done -eu "$@" grep
+local 2>/dev/null export "$1" 'quoted text' grep | readonly
+	awk && /usr/bin grep then 2>/dev/null "$@"
+printf 2>/dev/null -eu 'quoted text'
+		${HOME} $(pwd) ${HOME} 2>/dev/null
+grep $(pwd) then echo sed local -eu
+done && --verbose test echo $(pwd) sed 'quoted text' test --verbose
+	"$@" printf 'quoted text' then -eu cd /usr/bin && ${HOME}
+	readonly /usr/bin local grep awk "$1" /usr/bin test cd x=1 echo test -eu sed
+printf ${HOME} sed awk then ${HOME} awk
+	sed sed export && done "$1" grep -eu
+		/usr/bin grep cd awk echo 2>/dev/null
+-eu --verbose 2>/dev/null grep && local && echo sed ${HOME} local
+	export ${HOME} printf awk done
+		2>/dev/null -eu test "$@" "$1" | readonly readonly then readonly
+--verbose then 2>/dev/null
+		/usr/bin "$@" then printf ${HOME} done local x=1
+		readonly sed grep local $(pwd) --verbose "$1" local grep done 'quoted text' printf
+		then readonly test ${HOME} test x=1 --verbose x=1 $(pwd)
+	$(pwd) awk local /usr/bin
+	x=1 "$1" --verbose readonly
+| 'quoted text' 'quoted text' -eu "$1" printf test && echo -eu
+local test grep 'quoted text' ${HOME} echo sed ${HOME} 2>/dev/null
+then done | "$1" grep test test cd cd
+		2>/dev/null echo local local grep test grep 2>/dev/null
+		sed "$1" then x=1 then done test then awk done readonly
+	&& x=1 $(pwd) && | printf readonly x=1 --verbose
+	&& --verbose awk /usr/bin 'quoted text' /usr/bin "$1" && $(pwd) && "$@" 'quoted text'
+--verbose grep readonly "$1" test x=1 export
+	2>/dev/null x=1 cd done --verbose 'quoted text' $(pwd) /usr/bin --verbose
+$(pwd) "$@" sed --verbose ${HOME} && | 2>/dev/null echo 'quoted text'
+| then -eu x=1 grep grep $(pwd) test grep then grep done export export readonly
+	sed && $(pwd) --verbose awk sed
+	--verbose $(pwd) 2>/dev/null awk 'quoted text' sed "$1" then x=1 grep
+		x=1 test export awk test export "$1" 2>/dev/null
+x=1 local local 'quoted text' grep awk echo x=1 -eu then echo readonly
+	test --verbose "$1" sed cd /usr/bin echo local
+		x=1 cd "$1" /usr/bin x=1 /usr/bin | done x=1
+		local done sed awk done /usr/bin sed
+	| 'quoted text' ${HOME} $(pwd) echo /usr/bin cd
+	/usr/bin x=1 --verbose 2>/dev/null -eu /usr/bin
+		x=1 $(pwd) done readonly && $(pwd) cd
+	readonly 'quoted text' | 2>/dev/null
+'quoted text' local printf echo readonly readonly sed test
+--verbose test 2>/dev/null "$@" sed test "$1" export local
+		/usr/bin --verbose printf printf
+cd local | test $(pwd) then && sed
+	2>/dev/null cd then awk echo done 2>/dev/null
+		| done sed | -eu x=1 done grep "$@" ${HOME} -eu awk
+		echo awk $(pwd) x=1 ${HOME} cd -eu ${HOME} 'quoted text'
+		2>/dev/null "$1" readonly export | | then test --verbose printf --verbose
+		printf -eu /usr/bin export | -eu --verbose export cd export | --verbose
+sed done cd && /usr/bin ${HOME} grep done "$@" -eu 'quoted text' 'quoted text'
+then grep grep x=1 && $(pwd) done && -eu "$@" sed | $(pwd) 'quoted text'
+sed 'quoted text' printf cd $(pwd) grep local && awk $(pwd)
+		"$@" echo "$1" test /usr/bin
+		${HOME} 2>/dev/null && --verbose export export
+		awk $(pwd) 'quoted text' export -eu ${HOME} 2>/dev/null $(pwd) awk
+	echo done /usr/bin export --verbose readonly -eu $(pwd)
+		--verbose /usr/bin echo done -eu --verbose --verbose grep readonly
+		2>/dev/null local awk $(pwd) readonly sed
+		x=1 x=1 "$1" ${HOME} test x=1 grep "$1"
+local /usr/bin cd cd --verbose
+sed awk -eu -eu ${HOME} export
+		test x=1 --verbose && --verbose /usr/bin && readonly readonly
+cd 'quoted text' done echo echo awk printf sed 'quoted text' 2>/dev/null
+		echo "$@" ${HOME} export export $(pwd) $(pwd) "$@" awk then echo printf
+		cd --verbose 'quoted text'
+x=1 -eu x=1 2>/dev/null cd then x=1 "$@" --verbose echo awk ${HOME} && | $(pwd)
+		&& cd sed cd test && awk grep /usr/bin
+		2>/dev/null /usr/bin && x=1 --verbose then printf readonly
+	| --verbose "$@" sed /usr/bin awk 'quoted text' export cd --verbose done export
+local echo printf then ${HOME} export ${HOME} | -eu x=1 --verbose
+then awk --verbose test test printf printf --verbose test
+		"$@" readonly /usr/bin done
+	grep local done "$@" readonly
+		readonly x=1 -eu -eu | grep printf test | done readonly
+&& awk $(pwd) && 2>/dev/null export | echo
+printf -eu printf x=1 $(pwd)
+		'quoted text' x=1 test $(pwd) test 2>/dev/null
+"$@" then ${HOME} 'quoted text' done "$@" --verbose cd then readonly
+-eu grep local $(pwd) 'quoted text' test
+	--verbose && test ${HOME} -eu local cd 'quoted text'
+	export grep && done ${HOME} && "$@" sed sed ${HOME} -eu
+${HOME} --verbose $(pwd) | then grep "$@" 2>/dev/null "$1" done x=1 then /usr/bin
+		/usr/bin $(pwd) 2>/dev/null then local /usr/bin awk cd | then done --verbose
+	"$1" local test local && --verbose
+		readonly "$1" sed $(pwd) $(pwd)
+/usr/bin cd ${HOME} echo cd sed && -eu grep
+		$(pwd) "$1" -eu test local -eu "$1" printf -eu grep printf "$@"
+sed "$@" then sed printf cd /usr/bin readonly
+	test /usr/bin printf $(pwd) 'quoted text'
+	| 'quoted text' 'quoted text' ${HOME} export
+2>/dev/null | sed "$1" 2>/dev/null --verbose echo $(pwd)
+sed -eu ${HOME} "$@" --verbose awk local --verbose x=1 -eu
+		--verbose $(pwd) sed 'quoted text'
+	test cd $(pwd) | sed done sed ${HOME} 'quoted text'
+awk "$1" cd done done 'quoted text' awk export 'quoted text' echo
+		-eu x=1 awk "$1" printf 2>/dev/null sed local "$@" && awk "$@"
+"$1" x=1 sed /usr/bin printf 'quoted text' cd awk
+		"$@" awk && then 2>/dev/null export done cd cd printf echo
+printf export readonly "$@" /usr/bin ${HOME} "$@"
+"$1" /usr/bin $(pwd) ${HOME} $(pwd) cd export 2>/dev/null
+| echo local 'quoted text'
+cd 2>/dev/null echo 2>/dev/null printf
+sed then test | -eu 2>/dev/null "$1" /usr/bin echo && -eu "$@" /usr/bin
+	sed ${HOME} cd printf sed --verbose $(pwd) local grep ${HOME}
+		'quoted text' cd && x=1 | $(pwd) echo ${HOME} readonly
+	done cd readonly ${HOME} test && 2>/dev/null 'quoted text' test test $(pwd) --verbose
+	export 2>/dev/null export 2>/dev/null --verbose grep 'quoted text' x=1 test ${HOME}
+	sed /usr/bin export 'quoted text' 'quoted text' grep grep
+	&& --verbose local --verbose
+awk done "$@" --verbose printf | "$@" -eu done "$@"
+$(pwd) ${HOME} 'quoted text' grep echo
+done --verbose $(pwd) -eu && ${HOME}
+		export 2>/dev/null cd $(pwd) | /usr/bin $(pwd) "$1" printf awk | test then
+		done sed 2>/dev/null grep ${HOME} echo $(pwd) x=1 export x=1 readonly && ${HOME}
+		'quoted text' done awk printf cd --verbose
+	${HOME} | test cd 'quoted text' ${HOME} 2>/dev/null echo | local test
+awk echo | -eu grep done --verbose printf
+		x=1 | "$1" /usr/bin -eu cd "$1" sed export grep readonly $(pwd) sed awk $(pwd)
+	| x=1 --verbose "$@" 'quoted text'
+	test "$1" --verbose export then local echo cd "$@" /usr/bin test 2>/dev/null ${HOME}
+	"$@" grep awk sed 2>/dev/null && "$1" export
+sed echo test awk printf export sed x=1 grep 'quoted text' --verbose x=1
+x=1 "$@" 2>/dev/null x=1 /usr/bin readonly x=1 && -eu | ${HOME} 'quoted text'
+	grep --verbose --verbose && printf
+		&& echo 2>/dev/null /usr/bin export done echo echo
+	$(pwd) printf local readonly test && done | 'quoted text' /usr/bin
+	local --verbose readonly --verbose && printf readonly cd export sed $(pwd) "$1"
+	awk && -eu readonly grep echo -eu
+x=1 "$1" grep /usr/bin 'quoted text' 'quoted text' "$1"
+	$(pwd) export done $(pwd) /usr/bin
+		| awk printf awk sed "$@" 'quoted text' | ${HOME} /usr/bin done "$@" then
+	'quoted text' then test done done local "$@" 2>/dev/null
+"$@" x=1 test ${HOME} export --verbose
+awk "$@" 'quoted text' grep test export "$@" then && x=1 'quoted text'
+readonly "$@" && grep sed awk 'quoted text' 2>/dev/null echo 'quoted text'
+test export -eu "$@" -eu sed x=1
+local printf local local | "$@" readonly $(pwd) 2>/dev/null done
+	-eu ${HOME} "$@" x=1 local | sed 2>/dev/null $(pwd) awk --verbose "$1" $(pwd)
+/usr/bin awk printf "$1" readonly printf
+		local test "$@" 'quoted text' 2>/dev/null then $(pwd) awk
+		"$1" awk -eu -eu printf --verbose echo printf | && && echo $(pwd) local awk
+		local done && x=1 awk 2>/dev/null "$1" ${HOME} 2>/dev/null
+	--verbose $(pwd) ${HOME} ${HOME} "$@" /usr/bin export readonly local --verbose
+	sed awk cd 'quoted text' awk "$1"
+local --verbose done 2>/dev/null
+grep x=1 /usr/bin && then 2>/dev/null --verbose local
+		-eu sed 'quoted text' 2>/dev/null readonly "$1" "$@"
+		then 2>/dev/null $(pwd) sed && sed local /usr/bin export
+		-eu "$@" "$1" awk echo "$1" grep ${HOME} -eu x=1 --verbose
+		printf sed export awk "$@" cd "$@" ${HOME} sed $(pwd) awk export -eu
+	${HOME} 2>/dev/null 2>/dev/null "$@"
+		"$1" readonly $(pwd) awk echo "$@" 'quoted text' x=1 "$1" grep x=1 printf
+echo readonly $(pwd) x=1 && grep printf | readonly x=1 $(pwd) echo | then
+	export ${HOME} $(pwd) 2>/dev/null printf --verbose
+		printf awk grep local --verbose | -eu awk 'quoted text' echo "$1" awk done printf
+	"$1" "$@" test cd cd | sed "$1"
+	cd 'quoted text' test echo local then "$@" done readonly
+"$@" --verbose printf then "$@" test "$1" awk -eu awk
+	awk 2>/dev/null awk echo $(pwd) done && -eu --verbose printf export printf
+${HOME} "$1" done cd echo sed export -eu sed && ${HOME}
+		cd grep x=1 awk awk then && export printf sed $(pwd) "$@"
+	test --verbose cd sed x=1 cd 'quoted text'
+-eu test readonly 2>/dev/null export grep 2>/dev/null
+	cd sed cd 2>/dev/null && awk $(pwd) echo export export readonly
+	readonly "$1" "$1" export printf
+		test ${HOME} ${HOME} 'quoted text' | | printf awk grep cd | done awk echo local
+cd "$@" awk x=1 grep 2>/dev/null then && ${HOME} --verbose grep
+test ${HOME} --verbose test 'quoted text' sed
+		awk x=1 | | export --verbose ${HOME} echo -eu | "$@" "$@" test 'quoted text'
+--verbose | x=1 'quoted text'
+	local sed echo grep then test x=1 -eu "$1" test "$1" grep x=1 local x=1 local sed
+		${HOME} test /usr/bin awk then 2>/dev/null --verbose grep cd sed --verbose cd
+	sed cd --verbose 'quoted text' 2>/dev/null "$1" then -eu
+	"$@" | export "$1" --verbose $(pwd)
+		$(pwd) done sed sed "$@" then sed test --verbose readonly /usr/bin
+		'quoted text' readonly -eu "$1" x=1 "$1"
+grep export $(pwd) test --verbose
+'quoted text' grep $(pwd) ${HOME} sed ${HOME} done /usr/bin
+"$1" then echo $(pwd) "$@" printf
+	cd "$@" done ${HOME} echo readonly "$@"
+&& ${HOME} echo cd readonly $(pwd)
+		export $(pwd) awk test --verbose x=1 local $(pwd)
+	awk $(pwd) --verbose test 'quoted text'
+${HOME} -eu && --verbose /usr/bin then grep sed
+	printf $(pwd) | printf echo sed ${HOME} -eu readonly cd /usr/bin
+	$(pwd) | 2>/dev/null cd -eu /usr/bin && then sed 'quoted text'
+x=1 ${HOME} ${HOME} sed printf cd sed awk readonly
+$(pwd) echo --verbose then readonly && x=1 "$1" 2>/dev/null
+	local grep sed "$@" /usr/bin 'quoted text' printf /usr/bin sed local
+	cd awk 2>/dev/null 2>/dev/null echo /usr/bin $(pwd) done awk
+	echo done 2>/dev/null sed "$1" grep cd /usr/bin then ${HOME} /usr/bin 'quoted text'
+		grep test done -eu -eu cd local done /usr/bin test -eu printf "$@"
+	printf 2>/dev/null local "$1" printf export "$1" && | | printf
+local "$@" x=1 "$1" readonly test test --verbose "$@" && done grep
+	done then --verbose && local cd 2>/dev/null sed ${HOME} ${HOME}
+-eu "$@" /usr/bin readonly done export 2>/dev/null sed "$1"
+		$(pwd) | grep echo export | done --verbose printf --verbose
+	&& && grep test export echo ${HOME} done readonly
+		${HOME} printf echo cd --verbose --verbose /usr/bin ${HOME} | $(pwd) cd
+	$(pwd) echo local ${HOME} x=1 export $(pwd) | cd |
+		&& echo "$@" "$1" cd awk -eu --verbose
+		printf sed | && 'quoted text'
+	${HOME} awk readonly printf echo 'quoted text'
+		export readonly "$@" "$@" ${HOME} echo 'quoted text' readonly printf
+		printf --verbose "$1" "$1" sed ${HOME} ${HOME} awk local --verbose
+	export local printf then local awk echo grep -eu
+	done readonly sed $(pwd) -eu "$1" && --verbose cd -eu -eu -eu awk cd awk sed 'quoted text'
+echo echo ${HOME} then $(pwd) 2>/dev/null test x=1 done
+then cd then cd -eu /usr/bin | 2>/dev/null readonly x=1 && then --verbose
+readonly "$1" --verbose x=1 /usr/bin
+	$(pwd) echo | 'quoted text' echo local awk printf
+		"$1" 2>/dev/null readonly printf
+	'quoted text' "$1" 2>/dev/null done then readonly awk
+/usr/bin x=1 printf && cd && /usr/bin | printf -eu /usr/bin --verbose
+	x=1 --verbose ${HOME} 'quoted text' echo "$@" /usr/bin &&
+	export grep echo "$1" 'quoted text' test readonly cd sed
+"$1" "$1" local && cd local
+		${HOME} "$@" then && --verbose cd readonly | ${HOME}
+	awk awk "$1" printf /usr/bin
+"$@" awk 'quoted text' local echo grep done export "$@" printf ${HOME}
+	printf -eu | "$1" "$1" /usr/bin done /usr/bin
+printf test echo local done ${HOME} 'quoted text'
+| "$@" awk echo && awk
+		'quoted text' /usr/bin $(pwd) ${HOME} --verbose | awk test then 'quoted text'
+	2>/dev/null 2>/dev/null sed printf echo "$1" cd export grep export echo -eu
+		local --verbose then cd then $(pwd) echo test "$@" echo sed 2>/dev/null
+		${HOME} 'quoted text' awk x=1 local test 'quoted text' echo then /usr/bin printf
+	-eu local sed awk cd echo test echo "$1"
+x=1 /usr/bin && grep --verbose test test local 2>/dev/null
+-eu x=1 local cd echo
+grep $(pwd) $(pwd) /usr/bin test grep grep -eu --verbose test &&
+	readonly --verbose "$@" ${HOME} test && then echo -eu test export | done
+	"$@" local grep cd done grep awk readonly &&
+	grep cd sed grep "$1"
+		| --verbose export test | readonly sed --verbose readonly then x=1 cd awk
+"$@" then 'quoted text'
+		/usr/bin export ${HOME} x=1 "$@" echo printf export test echo | printf awk "$1"
+	"$1" printf cd sed -eu done -eu export grep
+		"$@" local cd then printf export && -eu test x=1 export done "$1" echo
+export sed "$@" | 2>/dev/null 'quoted text' readonly x=1
+awk grep x=1 && sed ${HOME} && local awk $(pwd) awk x=1 ${HOME} /usr/bin export
+	test x=1 readonly cd done ${HOME} && | "$1"
+awk --verbose export readonly /usr/bin export cd then
+	export cd then echo then | export "$@" | && --verbose printf
+		&& sed echo local && local printf
+	echo cd echo done x=1 | "$1" /usr/bin echo sed -eu readonly ${HOME} --verbose |
+		awk local $(pwd) $(pwd) cd then then printf
+		local grep 'quoted text' export grep | -eu "$1" test -eu then cd
+	x=1 -eu export "$@" printf --verbose
+| then cd && 'quoted text' x=1 echo -eu cd && printf
+		"$@" 2>/dev/null /usr/bin readonly "$1" ${HOME} cd cd printf
+		printf | | ${HOME} done grep -eu export cd ${HOME} printf && done
+		printf echo export awk -eu export /usr/bin printf --verbose done grep
+&& grep readonly awk printf 2>/dev/null | echo readonly 'quoted text'
+	"$1" | cd grep grep "$1" && cd export x=1 ${HOME} then echo export
+	sed -eu 'quoted text' x=1 echo
+		/usr/bin then cd then local echo sed $(pwd) awk echo "$@" awk "$1" printf
+		| local ${HOME} export "$@" echo echo 'quoted text' ${HOME} then local ${HOME}
+		sed --verbose "$1" -eu -eu "$1" 2>/dev/null cd "$1" | -eu echo done local && ${HOME}
+		--verbose local --verbose test
+		'quoted text' export x=1 readonly grep x=1 readonly "$1" "$@" local
+x=1 -eu cd | export cd export $(pwd) local && 2>/dev/null $(pwd)
+		| $(pwd) done "$@" --verbose
+		cd 2>/dev/null readonly 2>/dev/null then test then done --verbose export | cd
+	done test sed readonly
+		echo ${HOME} 'quoted text'
+${HOME} test "$@" /usr/bin then sed sed x=1 grep echo done -eu --verbose
+	"$1" local awk echo sed 'quoted text' 2>/dev/null
+		then awk readonly /usr/bin export 'quoted text' cd cd grep "$1" 'quoted text'
+readonly -eu sed -eu -eu 2>/dev/null readonly && $(pwd) readonly grep then
+x=1 $(pwd) readonly echo | -eu /usr/bin /usr/bin "$1" then test
+awk test "$1" 'quoted text' "$@" 2>/dev/null "$@" 'quoted text'
+	${HOME} printf && x=1 printf x=1 --verbose printf
+	2>/dev/null then x=1 ${HOME}
+		2>/dev/null then sed 2>/dev/null
+	/usr/bin 2>/dev/null done
+		printf "$@" --verbose && && x=1 && printf printf 2>/dev/null
+printf $(pwd) 2>/dev/null readonly 'quoted text' $(pwd)
+	${HOME} x=1 'quoted text' readonly
+grep $(pwd) | local printf awk echo local ${HOME} $(pwd) -eu
+	'quoted text' 2>/dev/null printf echo export | printf -eu printf ${HOME} "$1"
+		-eu "$@" grep grep x=1
+		awk done 'quoted text' local local
+		'quoted text' done x=1 ${HOME} readonly --verbose done cd "$@" grep "$@" "$1"
+	sed ${HOME} $(pwd) done local done printf
+	x=1 $(pwd) export printf readonly 'quoted text' grep sed
+'quoted text' | sed grep sed local test -eu 2>/dev/null -eu then then
+		then export cd local
+done && cd done sed -eu test | 'quoted text' test $(pwd) -eu test
+	echo export 'quoted text' ${HOME} &&
+	export -eu done && grep /usr/bin --verbose
+test /usr/bin x=1 --verbose | 'quoted text' 2>/dev/null test && printf cd
+printf 'quoted text' printf 2>/dev/null --verbose -eu
+	${HOME} -eu "$1" grep awk --verbose grep test echo | ${HOME} printf done
+| cd export printf local
+		| then test grep /usr/bin export printf "$1" ${HOME} 'quoted text'
+		printf echo "$@" done
+		x=1 x=1 'quoted text' $(pwd)
+	sed cd 2>/dev/null grep export "$@" "$1" awk | printf /usr/bin | local
+		x=1 echo echo printf
+		| export && $(pwd) grep $(pwd) $(pwd) echo x=1 "$1" 'quoted text' awk
+		done grep echo cd $(pwd) readonly x=1 sed x=1 cd --verbose cd 'quoted text'
+cd "$@" $(pwd) cd export echo echo sed "$1" done sed 2>/dev/null
+		export done --verbose 2>/dev/null done ${HOME}
+	2>/dev/null then && then test done local awk x=1 sed -eu "$1"
+		readonly sed ${HOME} "$@" x=1 --verbose 'quoted text' "$@" test 2>/dev/null
+sed 'quoted text' sed local x=1 /usr/bin echo x=1 /usr/bin local "$@" x=1
+		awk ${HOME} done then done test test done echo
+readonly "$@" "$1" && x=1
+done ${HOME} then 'quoted text' sed test done x=1 2>/dev/null $(pwd) "$@" x=1
+test done && /usr/bin echo done /usr/bin 2>/dev/null
+grep 2>/dev/null $(pwd)
+		echo "$1" printf printf "$1" echo done grep --verbose echo -eu | --verbose
+		&& done $(pwd) readonly
+		printf cd | sed test readonly ${HOME} awk export test readonly
+		"$1" printf awk test "$@" local done then --verbose
+		printf --verbose | test printf "$1"
+		'quoted text' -eu --verbose echo echo readonly
+		2>/dev/null then done cd then
+		x=1 ${HOME} /usr/bin local "$1" --verbose
+| done cd $(pwd) local cd then echo 'quoted text'
+	"$1" grep done local export /usr/bin local done sed "$@" | test | --verbose
+readonly 2>/dev/null ${HOME}
+		2>/dev/null printf sed $(pwd) 2>/dev/null export 2>/dev/null
+done test awk grep x=1 export ${HOME} -eu sed --verbose 2>/dev/null
+	sed local echo ${HOME} 'quoted text' 2>/dev/null echo
+"$1" && readonly $(pwd) "$1" cd awk cd /usr/bin export 2>/dev/null
+x=1 echo 2>/dev/null /usr/bin export 'quoted text'
+| local sed grep x=1 readonly $(pwd) grep "$1" printf readonly readonly cd readonly
+sed --verbose awk $(pwd)
+		awk cd "$1" readonly readonly printf 2>/dev/null 2>/dev/null "$@" 2>/dev/null
+		awk $(pwd) && ${HOME} --verbose -eu export local printf "$1" cd "$@" printf
+		/usr/bin -eu local awk && $(pwd) | -eu printf 2>/dev/null done cd
+		echo $(pwd) 'quoted text' "$@" cd --verbose | | then | printf
+	/usr/bin cd test "$1" "$1" | $(pwd)
+	then test echo then sed -eu test cd
+		export && | done "$1" 'quoted text' "$1" ${HOME} test 2>/dev/null
+&& && --verbose x=1 export readonly sed test cd /usr/bin
+	x=1 then then printf printf done "$1" readonly 'quoted text' 2>/dev/null cd "$@"
+	readonly echo | export echo && "$@" awk --verbose
+	'quoted text' $(pwd) readonly
+	${HOME} export export awk awk awk $(pwd) --verbose cd /usr/bin done done --verbose
+	readonly export "$1" test && --verbose sed cd $(pwd)
+	cd /usr/bin readonly done grep ${HOME} awk --verbose
+printf "$@" sed readonly 2>/dev/null
+	then export /usr/bin /usr/bin test export then --verbose && && && readonly done
+	| local sed x=1 "$1" /usr/bin x=1 then test cd 'quoted text' export export done
+| done && 2>/dev/null
+	echo grep done 'quoted text' "$@" "$1" | cd readonly test readonly sed
+sed ${HOME} done x=1 ${HOME} printf && "$@" test ${HOME} done
+		"$1" /usr/bin --verbose $(pwd) sed /usr/bin "$1" readonly
+"$1" x=1 "$1" -eu done test --verbose printf
+	awk sed printf sed printf "$1" /usr/bin grep 'quoted text'
+		x=1 2>/dev/null -eu sed local 'quoted text' 2>/dev/null | $(pwd) $(pwd) sed cd
+	done | x=1 echo $(pwd) then cd /usr/bin 'quoted text' "$1" sed
+echo "$1" then awk then "$1" 2>/dev/null echo
+	| done x=1 export done export export export sed 2>/dev/null
+		'quoted text' awk local | "$@" test x=1 sed
+	local grep 2>/dev/null && /usr/bin local 2>/dev/null done export /usr/bin
+		| -eu awk -eu done test export ${HOME} x=1
+	${HOME} printf 'quoted text' cd 'quoted text' readonly $(pwd) ${HOME} then
+&& ${HOME} then $(pwd) x=1 done cd -eu then local "$1" "$1" cd readonly
+${HOME} readonly then $(pwd) grep | $(pwd) x=1 cd
+		then ${HOME} ${HOME} then x=1 cd 2>/dev/null readonly -eu export
+		awk | && ${HOME} then grep --verbose
+	echo cd export cd then $(pwd) cd then && /usr/bin readonly printf awk local
+	"$1" x=1 test test sed grep "$1"
+	test --verbose echo 'quoted text' awk x=1 && ${HOME} --verbose
+${HOME} "$1" ${HOME} --verbose readonly | && echo ${HOME}
+	printf $(pwd) -eu -eu | printf echo done done cd
+awk readonly sed 2>/dev/null local 2>/dev/null
+test printf "$@" done | echo echo readonly cd
+		readonly sed cd readonly "$@" echo /usr/bin
+"$@" then $(pwd) /usr/bin sed "$1" awk 2>/dev/null done sed
+		sed test local -eu && readonly "$@" /usr/bin export then then $(pwd) "$@" && &&
+/usr/bin 'quoted text' "$1" sed then test | 2>/dev/null echo
+		${HOME} test echo echo --verbose
+printf | test 'quoted text' "$@" export readonly 'quoted text'
+&& then | /usr/bin "$1" done && 'quoted text' 2>/dev/null
+export "$1" $(pwd) "$@" local $(pwd) sed "$1" echo printf test ${HOME} &&
+		"$@" $(pwd) | export sed 'quoted text' cd ${HOME} grep export
+	$(pwd) cd sed local printf sed echo | 2>/dev/null printf "$1"
+	sed ${HOME} 'quoted text' local readonly sed echo done grep sed then $(pwd)
+		sed x=1 "$@" printf ${HOME} sed && && readonly cd
+&& cd echo "$@" | x=1 && export export -eu x=1
+		/usr/bin 2>/dev/null --verbose done grep done grep
+readonly $(pwd) local export printf echo "$1" sed cd /usr/bin "$1" grep then
+	sed "$@" readonly grep --verbose
+	local sed done done echo export sed export 2>/dev/null $(pwd)
+		x=1 -eu grep done grep local awk x=1 "$@" ${HOME}
+		2>/dev/null --verbose test readonly sed grep export "$@"
+-eu 2>/dev/null printf sed 'quoted text' test
+		sed 2>/dev/null awk x=1 sed grep done echo test "$@" | done done then "$@"
+"$@" export x=1 then readonly local "$1" then test
+	printf "$1" --verbose "$@" $(pwd) -eu readonly x=1 'quoted text'
+		readonly awk then awk cd done /usr/bin
+done $(pwd) export grep
+sed done /usr/bin grep | && | "$@" -eu export --verbose
+	test "$1" && $(pwd) grep /usr/bin grep test local test && done 2>/dev/null
+		$(pwd) 'quoted text' cd "$1" cd --verbose echo && $(pwd) cd
+		2>/dev/null done | 'quoted text' x=1 awk /usr/bin printf
+export x=1 ${HOME} ${HOME} sed -eu grep
+2>/dev/null && /usr/bin local echo "$1" 2>/dev/null grep export
+'quoted text' | printf readonly cd printf test ${HOME} x=1 && $(pwd)
+	readonly -eu && $(pwd) local export
+		cd done | grep export $(pwd) x=1 cd then export -eu "$1" printf 2>/dev/null $(pwd)
+readonly local 'quoted text'
+	test ${HOME} cd cd 'quoted text' "$@" 2>/dev/null -eu
+	export --verbose -eu 2>/dev/null x=1
+	"$1" echo printf /usr/bin -eu cd readonly && | "$1" local cd export sed
+		2>/dev/null ${HOME} "$1" && "$1" done echo
+		then test 2>/dev/null --verbose cd 'quoted text'
+"$1" export -eu 2>/dev/null 'quoted text' -eu x=1 printf -eu -eu awk
+		/usr/bin /usr/bin printf echo awk x=1 && done /usr/bin
+	grep printf x=1 /usr/bin
+	--verbose test x=1 && /usr/bin printf done grep
+	2>/dev/null printf echo then 'quoted text' done && cd x=1 &&
+then -eu "$1" 2>/dev/null cd readonly done awk 2>/dev/null echo
+		cd 2>/dev/null "$@" then cd 2>/dev/null x=1 sed |
+readonly /usr/bin 'quoted text'
+		printf then --verbose /usr/bin x=1 /usr/bin local export printf
+		--verbose $(pwd) 'quoted text'
+	readonly sed grep cd 2>/dev/null sed /usr/bin export grep 'quoted text'
+"$@" local | export $(pwd)
+printf printf echo | $(pwd) awk echo
+	readonly x=1 2>/dev/null ${HOME} | local x=1 $(pwd)
+		'quoted text' "$1" /usr/bin echo --verbose
+	test then "$1" cd echo /usr/bin grep
+		/usr/bin --verbose printf export export /usr/bin
+cd -eu /usr/bin test cd -eu
+	export "$@" 2>/dev/null /usr/bin cd awk readonly printf 2>/dev/null
+2>/dev/null "$@" 2>/dev/null /usr/bin "$@" grep printf && --verbose "$@"
+sed done sed readonly done sed cd && echo --verbose export then cd ${HOME} $(pwd)
+--verbose ${HOME} readonly readonly --verbose "$@"
+2>/dev/null grep grep 'quoted text' x=1
+		2>/dev/null -eu $(pwd) then readonly ${HOME} echo 'quoted text'
+		/usr/bin && sed awk && && test -eu export export $(pwd)
+echo $(pwd) export done x=1 2>/dev/null local readonly awk -eu printf
+	-eu sed $(pwd) $(pwd) && grep --verbose x=1 -eu 2>/dev/null echo | test ${HOME}
+/usr/bin awk local local grep -eu -eu cd readonly | 2>/dev/null printf grep
+	x=1 ${HOME} grep 2>/dev/null "$1" --verbose echo local grep "$1"
+readonly ${HOME} ${HOME}
+	cd then /usr/bin grep test cd sed /usr/bin && "$1"
+$(pwd) 2>/dev/null | test printf grep x=1 awk --verbose
+		--verbose && sed -eu && x=1 "$1"
+	&& "$@" local done --verbose echo cd | && "$1" "$@" then readonly
+		&& sed --verbose -eu printf
+	readonly echo | --verbose "$@" sed 2>/dev/null x=1 'quoted text' x=1
+		printf echo && "$1" printf
+		2>/dev/null x=1 local -eu -eu cd done ${HOME}
+	'quoted text' "$@" local awk
+	&& done $(pwd) awk awk done
+		"$@" echo --verbose /usr/bin /usr/bin readonly --verbose
+	2>/dev/null "$@" x=1 x=1 local then x=1 ${HOME}
+done awk ${HOME} export && test
+	&& local local export sed then "$1" 2>/dev/null then done | && /usr/bin sed
+then sed $(pwd) local "$@" then export then x=1 grep /usr/bin x=1 readonly
+export readonly echo done | -eu /usr/bin cd local
+	2>/dev/null awk | then "$@" then && awk then $(pwd) "$@"
+	2>/dev/null "$@" "$1" sed then then "$1" cd grep sed 2>/dev/null 'quoted text'
+		local then && "$1" local 2>/dev/null 2>/dev/null
+	$(pwd) cd /usr/bin awk done then $(pwd) printf && printf
+		2>/dev/null "$@" local --verbose
+		-eu "$1" "$@" printf then local
+		--verbose test -eu export echo then | 2>/dev/null -eu "$@" printf
+		/usr/bin 2>/dev/null test --verbose printf && cd | --verbose -eu export 2>/dev/null
+&& /usr/bin --verbose 'quoted text' | | --verbose ${HOME} printf "$1" readonly
+		cd "$1" then /usr/bin "$@" 2>/dev/null test done awk ${HOME}
+-eu grep local done | /usr/bin done cd x=1 ${HOME} test && "$1" "$1" local
+	2>/dev/null sed $(pwd) test grep -eu echo
+		local | $(pwd) echo sed x=1 ${HOME} --verbose 2>/dev/null printf $(pwd)
+	| export && printf done echo "$1" && then cd sed 2>/dev/null x=1 "$@" $(pwd) 'quoted text'
+		'quoted text' --verbose
+	2>/dev/null --verbose sed awk then done awk && sed test printf local "$1"
+		'quoted text' export
+	done cd --verbose grep 2>/dev/null done export then sed then ${HOME} --verbose
+	${HOME} 2>/dev/null 2>/dev/null --verbose printf 2>/dev/null export done done
+sed "$@" && local cd "$1" x=1 awk
+| grep --verbose && $(pwd) | awk grep | "$@" export local cd /usr/bin cd test
+		export --verbose then && "$@" -eu test && grep test 'quoted text'
+		sed | /usr/bin 'quoted text' $(pwd) x=1 export 'quoted text' echo /usr/bin
+		printf 'quoted text' local grep sed sed "$@" cd -eu
+		'quoted text' 2>/dev/null local -eu 2>/dev/null readonly 'quoted text'
+"$@" printf | done | sed "$1"
+		2>/dev/null then grep awk printf awk
+	sed then export sed export x=1 -eu /usr/bin awk x=1 export
+	$(pwd) readonly 'quoted text' readonly done "$@"
+cd $(pwd) /usr/bin test then 2>/dev/null
+		2>/dev/null done $(pwd) "$@" && printf grep cd 2>/dev/null
+		&& local then awk done then ${HOME} then "$@" readonly
+	2>/dev/null ${HOME} "$1" "$1" done -eu "$1" /usr/bin -eu local
+		grep -eu cd printf --verbose x=1 echo ${HOME} readonly "$1" then echo 'quoted text'
+		-eu /usr/bin test 'quoted text'
+		&& awk && local "$@" $(pwd) && 2>/dev/null echo test
+		x=1 ${HOME} echo awk 2>/dev/null --verbose sed test then then 'quoted text'
+${HOME} ${HOME} --verbose /usr/bin
+		grep 'quoted text' "$@" then
+	sed export sed "$@" echo echo
+		grep cd cd "$@" done readonly cd grep 'quoted text' then sed ${HOME} readonly
+		local local 'quoted text' test 2>/dev/null awk cd export $(pwd) export
+	| 2>/dev/null done && sed
+	x=1 then echo printf /usr/bin && then
+		"$@" $(pwd) /usr/bin /usr/bin 2>/dev/null cd "$1" awk
+sed export --verbose -eu printf x=1
+cd ${HOME} awk local printf grep $(pwd) local "$1" export grep
+local printf cd printf local cd | "$@" then 'quoted text'
+| then done local -eu sed printf test cd test readonly -eu
+&& grep sed printf cd | cd echo export $(pwd) 'quoted text'
+	"$@" export grep local done x=1 cd awk test
+	awk ${HOME} | local -eu grep test printf echo printf cd done then x=1
+-eu "$1" /usr/bin export x=1 readonly 2>/dev/null printf
+-eu x=1 $(pwd) sed -eu ${HOME}
+		local awk local printf cd /usr/bin
+grep then then sed echo then
+		cd then grep cd local "$1" then
+then readonly "$1" -eu "$1" printf
+	--verbose then readonly | 2>/dev/null 'quoted text' printf grep test --verbose
+	done local cd -eu "$@" /usr/bin test
+${HOME} cd | local --verbose -eu "$1" awk "$@" 'quoted text' awk
+	$(pwd) cd 'quoted text' "$1" $(pwd) export then && echo export --verbose
+	'quoted text' "$@" "$1" export -eu echo "$@" readonly grep ${HOME}
+	echo -eu 'quoted text' /usr/bin echo x=1 done local
+&& printf /usr/bin echo "$1" awk test 'quoted text' echo && /usr/bin
+"$1" awk && readonly then
+	export ${HOME} then --verbose
+&& local x=1 export && -eu 'quoted text' done local ${HOME}
+sed --verbose echo sed grep /usr/bin export
+	--verbose 2>/dev/null sed && -eu $(pwd) $(pwd) grep 2>/dev/null
+${HOME} local awk printf echo then
+		printf export /usr/bin x=1 cd test test
+	"$@" done ${HOME} --verbose awk sed
+	"$@" | -eu "$1" --verbose
+	test ${HOME} "$1" x=1 readonly --verbose awk grep --verbose "$@" && done ${HOME}
+export && test test && ${HOME} $(pwd) "$1" grep x=1 grep done then -eu
+	grep /usr/bin -eu then grep readonly export local
+x=1 done --verbose 2>/dev/null readonly
+		/usr/bin export 2>/dev/null ${HOME} cd test echo "$1" && then export
+	$(pwd) grep cd && -eu /usr/bin | 'quoted text'
+export printf test grep 2>/dev/null x=1
+	cd -eu 2>/dev/null cd sed cd 'quoted text' ${HOME} awk 2>/dev/null
+	export echo done ${HOME} x=1 x=1 -eu --verbose --verbose
+		echo ${HOME} 'quoted text' export done ${HOME} echo ${HOME}
+${HOME} readonly --verbose "$1" --verbose 'quoted text' | local then printf cd
+&& $(pwd) local awk export | -eu awk "$1" && 2>/dev/null
+	test "$@" --verbose cd 'quoted text' 2>/dev/null
+	test 'quoted text' echo export sed echo test done && 2>/dev/null then
+		x=1 --verbose readonly echo x=1 |
+	/usr/bin 'quoted text' then -eu 2>/dev/null export --verbose
+		local done sed /usr/bin x=1 export && 2>/dev/null --verbose
+		grep | 2>/dev/null test then readonly 'quoted text' 2>/dev/null then
+	| cd cd cd /usr/bin --verbose | readonly export ${HOME}
+	done awk ${HOME} --verbose grep
+$(pwd) ${HOME} ${HOME} x=1 then echo echo $(pwd) test printf $(pwd) ${HOME} awk
+x=1 echo && printf "$1"
+	awk export export 'quoted text' awk done local then then
+		echo done grep local $(pwd) 'quoted text' /usr/bin
+		$(pwd) printf -eu "$@" | -eu && cd export
+	grep "$1" -eu local readonly &&
+"$@" --verbose export awk 2>/dev/null
+		echo done then --verbose 'quoted text' --verbose "$1" test
+#include c124.sh
+then /usr/bin export 'quoted text' export /usr/bin
+printf /usr/bin local ${HOME} -eu then then
+sed echo -eu readonly export "$@" 'quoted text' "$@"
+	${HOME} grep export export readonly
+		x=1 then /usr/bin --verbose sed x=1 -eu
+		cd --verbose | | readonly export -eu sed readonly /usr/bin readonly 2>/dev/null
+export x=1 --verbose 2>/dev/null grep $(pwd) 2>/dev/null --verbose
+${HOME} readonly test ${HOME} -eu && readonly ${HOME} 2>/dev/null
+		test printf /usr/bin grep cd awk test
+printf ${HOME} readonly then printf
+'quoted text' export test export readonly cd then done printf && -eu grep
+local ${HOME} then && readonly x=1 then cd -eu -eu 2>/dev/null "$@"
+cd 'quoted text' 2>/dev/null
+	-eu awk && cd "$1" cd printf done && "$1"
+		awk -eu sed test ${HOME} awk printf done
+${HOME} --verbose /usr/bin --verbose done /usr/bin ${HOME}
+	&& cd x=1 "$@" $(pwd) printf ${HOME} cd "$@" && x=1 cd ${HOME}
+test awk grep $(pwd) echo then ${HOME} --verbose then
+		test cd readonly done echo x=1 readonly $(pwd)
+then grep echo printf "$@" | 'quoted text' -eu
+		grep printf export && -eu test sed $(pwd) readonly
+"$1" --verbose export printf $(pwd) echo ${HOME} cd local
+"$1" done readonly printf local x=1 ${HOME}
+	$(pwd) ${HOME} local "$@" cd test done
+	| printf $(pwd) test "$@" local x=1 echo done test echo test readonly | /usr/bin
+| -eu -eu test export x=1
+2>/dev/null && ${HOME} cd ${HOME} grep
+		| cd "$1" x=1 export readonly test grep ${HOME}
+readonly echo then | test $(pwd) 2>/dev/null ${HOME} "$@" ${HOME} sed export
+		--verbose done ${HOME} export "$@" awk cd sed printf x=1 $(pwd) done ${HOME}
+	2>/dev/null done local "$@" $(pwd) /usr/bin
+sed "$@" awk echo printf
+	then && && then local 'quoted text' then printf cd 2>/dev/null done
+	printf cd then /usr/bin
+'quoted text' sed -eu cd sed ${HOME} 'quoted text' grep
+	x=1 export 'quoted text' && ${HOME} grep $(pwd) $(pwd) |
+--verbose -eu && printf cd
+	echo | printf export ${HOME} export 'quoted text' printf $(pwd) grep
+	$(pwd) /usr/bin --verbose
+		&& done x=1 test readonly readonly x=1 echo test awk cd && done
+printf "$@" | readonly 'quoted text' && $(pwd) --verbose --verbose
+	then 2>/dev/null $(pwd) --verbose
+	/usr/bin | 'quoted text' then 2>/dev/null 'quoted text'
+	cd --verbose done done "$@" x=1 done readonly printf printf && -eu ${HOME}
+		printf x=1 ${HOME} export $(pwd) awk "$@"
+		'quoted text' export sed 'quoted text' --verbose
+		$(pwd) test export 2>/dev/null --verbose test
+	echo printf local awk && readonly 'quoted text' 'quoted text'
+		done printf test cd export awk "$1" export 2>/dev/null "$1" "$@" grep "$1" readonly
+--verbose 2>/dev/null $(pwd) cd ${HOME} x=1 -eu awk local sed then /usr/bin
+"$@" ${HOME} "$1" x=1 cd -eu 'quoted text' sed
+then readonly cd local "$1" /usr/bin
+	${HOME} test local then grep
+	cd awk cd test 2>/dev/null readonly done readonly /usr/bin sed printf
+	grep /usr/bin echo cd test x=1 readonly
+sed /usr/bin $(pwd) then
+		sed export grep 'quoted text' awk local "$1" | sed /usr/bin readonly "$1"
+	"$1" sed export | --verbose $(pwd) | then ${HOME} awk /usr/bin
+		test awk /usr/bin done
+	readonly --verbose cd done
+	--verbose readonly ${HOME} --verbose cd printf "$1" ${HOME} test
+	printf --verbose -eu test cd printf 2>/dev/null x=1
+-eu grep 'quoted text' x=1 cd "$@"
+		local -eu done | export ${HOME} sed $(pwd) ${HOME} done local && echo ${HOME} local
+	'quoted text' readonly readonly $(pwd) x=1 --verbose local test test 'quoted text'
+$(pwd) cd x=1 /usr/bin 2>/dev/null | "$1"
+	grep export -eu 2>/dev/null then printf sed readonly
+readonly /usr/bin && then test /usr/bin /usr/bin
+	grep readonly 2>/dev/null grep then
+readonly sed x=1 local ${HOME}
+		&& grep /usr/bin readonly --verbose "$1" cd |
+readonly "$1" "$1" --verbose
+	grep printf echo 'quoted text' export printf awk awk sed test | $(pwd)
+echo done && $(pwd) "$@" sed test
+		done ${HOME} echo test printf readonly "$@"
+	"$@" done test "$1" printf export awk then awk 2>/dev/null readonly
+	sed export --verbose "$1" -eu && 'quoted text' echo echo
+sed cd /usr/bin cd ${HOME} 'quoted text' readonly echo grep grep ${HOME}
+"$1" grep local && && cd -eu grep x=1 echo /usr/bin grep -eu 2>/dev/null
+	then readonly export local ${HOME} x=1 x=1 export "$1" 2>/dev/null "$1" local 2>/dev/null
+		done then grep x=1 | /usr/bin /usr/bin
+	x=1 grep then test 2>/dev/null
+sed "$@" x=1 cd then test ${HOME} readonly 'quoted text'
+		then done awk printf local | x=1 awk test
+	awk --verbose awk readonly
+		--verbose ${HOME} printf
+		then "$@" -eu test | 'quoted text'
+&& "$1" | printf echo 'quoted text' | | "$@" 'quoted text'
+		"$1" $(pwd) readonly local sed printf
+	${HOME} printf done cd test done local readonly done ${HOME} done --verbose echo
+	/usr/bin "$@" $(pwd) awk then
+then && local x=1 sed done
+		then printf done "$1" grep && cd
+	/usr/bin "$1" x=1 export printf test 'quoted text' awk grep printf
+	then --verbose then /usr/bin | local cd
+	sed cd grep ${HOME} then | readonly then
+		--verbose && | then grep export cd --verbose
+sed -eu /usr/bin /usr/bin
+		sed done awk $(pwd) --verbose sed echo 'quoted text'
+		grep 'quoted text' cd printf printf --verbose ${HOME} | $(pwd) awk printf /usr/bin
+		--verbose grep local test "$1" sed ${HOME} sed sed sed sed local sed ${HOME}
+	test -eu echo echo 2>/dev/null 2>/dev/null local sed -eu done done $(pwd) -eu
+		export readonly x=1 x=1 $(pwd) local
+echo export /usr/bin --verbose | $(pwd) cd done export && ${HOME} $(pwd)
+'quoted text' 'quoted text' readonly "$1" sed $(pwd) local --verbose "$@" export
+	then grep printf && x=1 printf -eu export done 2>/dev/null "$1"
+	"$@" test export "$@" local grep then -eu "$1" local /usr/bin x=1 readonly grep
+--verbose 'quoted text' readonly then local then 'quoted text' readonly sed
+		${HOME} echo readonly "$1" readonly "$1" grep local sed x=1 "$1" printf
+		'quoted text' echo grep then done awk ${HOME} "$1" cd local && awk test echo
+done grep test 2>/dev/null then x=1 test echo cd grep $(pwd)
+	awk ${HOME} "$@" ${HOME} local then grep then --verbose
+		'quoted text' "$1" "$1" 'quoted text' | 'quoted text'
+		grep /usr/bin export "$@" export | "$@" grep echo export "$1" 'quoted text'
+	| "$1" readonly /usr/bin && /usr/bin
+	then test test ${HOME} 2>/dev/null "$@" done echo
+	grep "$1" /usr/bin --verbose 2>/dev/null done x=1
+	then echo ${HOME} export ${HOME}
+	awk --verbose 'quoted text' local $(pwd) printf
+export --verbose sed /usr/bin
+test 'quoted text' "$@" awk test x=1 echo test then -eu x=1 "$1" export
+		x=1 export awk -eu printf then readonly ${HOME} "$@" done "$@" --verbose
+		"$1" "$1" --verbose 'quoted text' --verbose sed sed cd echo then ${HOME}
+grep export -eu grep sed --verbose && cd then then cd 2>/dev/null
+	'quoted text' done then "$@" test 'quoted text'
+	local then x=1 done && 2>/dev/null printf ${HOME}
+--verbose -eu x=1 --verbose echo awk
+		x=1 readonly 2>/dev/null $(pwd) echo --verbose readonly
+2>/dev/null "$1" awk
+${HOME} cd cd "$@" cd local | awk 2>/dev/null
+-eu awk cd --verbose && sed grep test export
+		| done /usr/bin echo export $(pwd) && && awk sed readonly "$@" 'quoted text'
+	done then --verbose | && ${HOME} /usr/bin 2>/dev/null 'quoted text'
+printf "$1" cd x=1 grep 2>/dev/null local 'quoted text'
+		x=1 cd --verbose done export local x=1 /usr/bin -eu ${HOME}
+test 2>/dev/null test readonly sed
+/usr/bin $(pwd) && "$1" export && echo grep sed x=1 grep -eu local
+		$(pwd) done | "$@" && sed "$1" export
+		then | && | | grep then 'quoted text'
+	/usr/bin "$1" echo printf export local echo -eu printf sed --verbose grep grep
+		$(pwd) echo $(pwd) awk echo echo | done local | "$@" -eu x=1 ${HOME} readonly
+	grep x=1 "$1" sed /usr/bin readonly -eu readonly awk cd cd grep awk
+		&& local export awk 2>/dev/null grep
+	'quoted text' awk 'quoted text' 2>/dev/null cd printf 'quoted text' $(pwd)
+		'quoted text' "$@" test "$1" 2>/dev/null | --verbose --verbose
+'quoted text' local 'quoted text' ${HOME} done cd sed
+	--verbose && 2>/dev/null --verbose then
+		printf && sed done sed test --verbose echo 'quoted text'
+		cd | "$1" echo export cd $(pwd) cd "$1" export x=1
+		local 'quoted text' --verbose readonly
+		/usr/bin sed readonly "$1" export 2>/dev/null awk
+	$(pwd) local test grep /usr/bin ${HOME} /usr/bin "$@" "$1" done -eu | x=1 -eu
+	printf readonly $(pwd)
+	${HOME} "$1" /usr/bin 'quoted text' 2>/dev/null --verbose "$1"
+-eu test test cd -eu awk
+${HOME} export /usr/bin $(pwd) cd $(pwd) ${HOME} | echo /usr/bin ${HOME} /usr/bin
+		'quoted text' "$@" readonly local awk --verbose done sed 2>/dev/null
+cd awk cd grep cd 2>/dev/null
+readonly --verbose "$1" "$1"
+readonly x=1 /usr/bin -eu test 'quoted text' --verbose test 'quoted text'
+		--verbose printf | $(pwd) $(pwd) && /usr/bin && | "$@" --verbose 'quoted text'
+	echo "$@" "$1" done ${HOME}
+echo done then 'quoted text' "$@" --verbose ${HOME}
+	echo readonly 'quoted text' echo | echo echo then
+	test -eu local "$1" ${HOME} "$1" cd "$@" x=1
+		grep 2>/dev/null /usr/bin printf grep --verbose
+export --verbose readonly && && -eu readonly then local --verbose
+		export | local "$@" "$@" test done && awk
+		'quoted text' echo export "$1" -eu
+		${HOME} test grep cd 2>/dev/null ${HOME} $(pwd) | cd -eu echo
+${HOME} then grep awk ${HOME} grep
+| test awk 'quoted text' 2>/dev/null
+&& $(pwd) done 'quoted text' $(pwd) printf "$@" awk awk 'quoted text' -eu sed
+x=1 && echo x=1 test | done readonly ${HOME} local
+	grep done /usr/bin --verbose test "$@" "$@" /usr/bin echo test /usr/bin
+		printf done echo 'quoted text' 'quoted text' readonly local
+	"$@" sed awk echo $(pwd) export sed local echo test export printf sed
+		"$@" printf sed printf export 2>/dev/null
+		${HOME} echo "$@" done | awk --verbose
+	awk done $(pwd) /usr/bin
+	x=1 readonly printf /usr/bin printf
+		then sed then readonly grep export echo && --verbose "$@" x=1 -eu --verbose awk
+	"$@" 'quoted text' "$1" sed ${HOME} 2>/dev/null grep test -eu cd "$@"
+sed printf cd "$@" ${HOME} awk awk grep then test | "$1" readonly | -eu
+		/usr/bin then awk 'quoted text' && grep "$1" sed printf && "$1"
+		-eu x=1 cd printf "$1" $(pwd) 'quoted text' | 'quoted text'
+--verbose awk /usr/bin "$1" | ${HOME} -eu && ${HOME} test readonly
+		'quoted text' 2>/dev/null export cd 2>/dev/null readonly sed && ${HOME} then
+export local printf -eu "$1" done export awk | printf grep done x=1 | $(pwd)
+		awk local 2>/dev/null readonly
+		then "$1" -eu printf $(pwd) | 'quoted text' then /usr/bin
+	2>/dev/null awk -eu "$1" test "$@"
+	"$1" echo grep grep then $(pwd) awk echo export -eu awk sed "$1" sed
+		'quoted text' local | grep "$1" -eu --verbose grep sed /usr/bin
+-eu awk 'quoted text' "$@"
+		cd | $(pwd) echo 'quoted text' then
+	--verbose 'quoted text' echo 2>/dev/null
+	printf cd /usr/bin /usr/bin awk --verbose cd grep printf
+readonly ${HOME} readonly $(pwd) cd echo cd then "$1" "$1" $(pwd) local done |
+printf x=1 2>/dev/null done | echo
+done 2>/dev/null printf printf
+-eu grep awk ${HOME} -eu printf awk local "$1" 'quoted text' grep local test
+	"$@" echo "$1" "$1" grep printf cd then
+		sed awk 2>/dev/null /usr/bin 2>/dev/null 2>/dev/null awk test sed readonly 'quoted text'
+		local --verbose then
+| /usr/bin local grep 2>/dev/null sed "$1" 'quoted text' awk awk cd $(pwd)
+awk sed local && then 'quoted text' x=1 test done /usr/bin then then
+awk "$@" 2>/dev/null /usr/bin | /usr/bin --verbose awk echo test
+x=1 "$1" local printf readonly x=1 -eu 2>/dev/null 2>/dev/null && /usr/bin readonly
+awk readonly then "$1" test cd ${HOME} sed echo
+echo | ${HOME} ${HOME} "$@" awk cd done --verbose /usr/bin echo 2>/dev/null
+grep local $(pwd) | cd "$@" then done local | grep readonly "$1"
+/usr/bin printf sed test $(pwd) && test readonly && /usr/bin
+| awk -eu test sed 2>/dev/null /usr/bin $(pwd) 'quoted text' $(pwd) x=1 echo local
+${HOME} printf test echo export grep && test
+	echo x=1 x=1 done $(pwd) awk 'quoted text' grep | export sed $(pwd) 'quoted text'
+		cd 2>/dev/null echo 'quoted text' /usr/bin 2>/dev/null local 'quoted text' cd
+		readonly local 'quoted text' | "$1" cd local
+echo echo printf "$1" cd echo test cd 2>/dev/null ${HOME}
+'quoted text' done awk ${HOME} then sed x=1 cd export 2>/dev/null x=1 cd
+		--verbose test /usr/bin cd --verbose | ${HOME} test readonly | test
+"$1" x=1 sed readonly cd echo export readonly
+	/usr/bin $(pwd) awk "$1" cd --verbose | $(pwd) grep export
+		-eu printf done --verbose test grep printf cd | grep ${HOME} local
+"$1" /usr/bin x=1 2>/dev/null 'quoted text' awk -eu sed |
+		then cd $(pwd) 'quoted text' sed -eu sed 'quoted text' sed 'quoted text' 'quoted text'
+	readonly readonly 2>/dev/null local | test --verbose echo test then $(pwd) "$1"
+		"$1" sed done readonly "$1" grep --verbose sed --verbose printf sed --verbose
+export x=1 local --verbose printf
+	| /usr/bin test 2>/dev/null --verbose
+2>/dev/null readonly printf sed readonly x=1 awk --verbose then "$@" sed
+cd --verbose printf -eu ${HOME} /usr/bin
+		sed 'quoted text' cd printf test cd export sed --verbose
+/usr/bin 'quoted text' readonly
+	readonly export export test "$@" "$@" -eu cd grep --verbose 2>/dev/null
+then /usr/bin /usr/bin echo
+		$(pwd) /usr/bin /usr/bin echo local grep then /usr/bin echo
+		${HOME} -eu done done /usr/bin $(pwd) ${HOME} echo --verbose "$@" printf
+&& --verbose && then local x=1 cd readonly 'quoted text'
+"$@" | 2>/dev/null local "$@" done then ${HOME} "$1" 'quoted text' cd |
+/usr/bin printf printf grep $(pwd) printf ${HOME} done readonly
+	done -eu local grep --verbose cd x=1 -eu 2>/dev/null && 2>/dev/null printf ${HOME}
+	local /usr/bin 'quoted text' /usr/bin local
+		2>/dev/null && awk then export readonly local "$1"
+	cd test cd sed test echo -eu echo then ${HOME}
+		/usr/bin /usr/bin | && printf printf awk grep -eu test 'quoted text'
+		grep x=1 -eu test "$@" /usr/bin
+	grep grep --verbose readonly 2>/dev/null
+"$1" -eu awk done | 2>/dev/null
+then $(pwd) export --verbose /usr/bin printf $(pwd) -eu | echo 2>/dev/null
+awk x=1 $(pwd) && ${HOME} then
+		sed cd export --verbose export local x=1 && $(pwd) test echo ${HOME}
+		test then "$1" "$1" done done
+		grep 2>/dev/null test sed printf then && echo 'quoted text'
+test /usr/bin test then test
+	-eu local done test $(pwd) test "$1" awk readonly /usr/bin done "$1" grep
+		${HOME} echo "$@" test 2>/dev/null test test -eu && 2>/dev/null
+&& "$1" readonly $(pwd) 2>/dev/null
+	$(pwd) readonly cd cd -eu echo test then 'quoted text'
+	2>/dev/null 2>/dev/null
+	'quoted text' export sed 'quoted text' $(pwd) && local 'quoted text' /usr/bin $(pwd)
+'quoted text' export $(pwd) -eu $(pwd) --verbose 2>/dev/null cd
+local "$1" done grep "$1" && done local --verbose -eu awk --verbose grep x=1 /usr/bin
+	grep grep /usr/bin test cd --verbose awk printf
+export readonly "$1" printf "$@" export grep sed readonly --verbose export done
+	2>/dev/null 2>/dev/null done "$@"
+	| readonly --verbose cd export done ${HOME} | readonly
+		$(pwd) $(pwd) $(pwd) | export local -eu && grep
+grep local sed "$@" local test && 'quoted text' local echo
+${HOME} -eu "$1" awk local | then x=1 readonly echo "$@" | grep --verbose
+		local sed readonly sed "$1" /usr/bin --verbose done && export
+		local export x=1 echo grep ${HOME}
+cd test "$@" sed ${HOME} x=1
+	cd then readonly readonly grep "$1"
+printf echo $(pwd) x=1 local test printf --verbose
+		--verbose $(pwd) sed readonly 'quoted text' printf
+		x=1 && | --verbose printf then cd done printf --verbose 'quoted text'
+	--verbose export printf then local printf echo cd done 2>/dev/null
+		&& export 'quoted text' echo cd &&
+sed /usr/bin 2>/dev/null then readonly awk 'quoted text'
+	grep local --verbose printf sed echo | readonly ${HOME} | --verbose
+export then local x=1 echo echo awk then x=1 then done sed x=1 export
+/usr/bin $(pwd) export printf 'quoted text' x=1 -eu done
+		x=1 awk "$@" "$1" "$1" x=1 awk sed awk "$1"
+"$@" sed ${HOME} sed ${HOME} readonly
+		test 2>/dev/null printf local then sed && && awk local export
+		grep awk export x=1 -eu 'quoted text' then grep $(pwd) x=1 2>/dev/null
+	cd awk local export sed ${HOME} 2>/dev/null $(pwd) readonly 'quoted text'
+awk --verbose "$1" test grep test "$@" && awk 2>/dev/null "$1" echo echo
+		grep readonly $(pwd) 2>/dev/null $(pwd) awk test x=1 done | -eu 2>/dev/null
+--verbose 2>/dev/null local 2>/dev/null readonly
+readonly awk printf sed local | ${HOME}
+test readonly x=1 done test x=1 local --verbose printf done printf
+		"$1" then done grep /usr/bin 2>/dev/null
+	-eu export echo sed done $(pwd) readonly then test readonly
+/usr/bin echo then sed -eu $(pwd) echo done done x=1 sed awk /usr/bin
+		/usr/bin ${HOME} printf
+	test then ${HOME} 'quoted text' done cd && --verbose
+	x=1 printf then grep awk then 'quoted text' cd export test "$@" | echo $(pwd)
+		sed readonly grep sed cd ${HOME} "$1" /usr/bin export printf ${HOME}
+'quoted text' sed x=1 2>/dev/null
+| awk printf done 2>/dev/null ${HOME} && local "$1" cd 2>/dev/null
+	"$1" x=1 -eu export done -eu | done x=1 ${HOME} then test $(pwd) | -eu printf
+		grep readonly readonly awk "$1" ${HOME} export readonly ${HOME}
+${HOME} cd readonly local ${HOME} export $(pwd)
+		/usr/bin local /usr/bin
+		x=1 "$1" "$1" cd printf -eu -eu x=1 echo cd /usr/bin
+	2>/dev/null "$1" printf | $(pwd) "$@" && echo grep readonly /usr/bin echo
+		"$1" test sed cd && done readonly "$1" grep readonly readonly
+	&& | done printf && $(pwd) done local test done done local ${HOME} /usr/bin
+readonly export /usr/bin readonly export echo cd export echo 2>/dev/null
+	&& "$1" local --verbose | 'quoted text' && test -eu /usr/bin
+	grep awk --verbose /usr/bin sed $(pwd) sed 'quoted text' awk && local
+export printf grep "$1" | grep --verbose echo
+&& test "$@" grep "$1" | 'quoted text' "$@" 2>/dev/null awk 'quoted text' done
+		"$@" 2>/dev/null 'quoted text'
+	${HOME} done grep $(pwd) 2>/dev/null echo done ${HOME} 'quoted text' printf
+	cd && readonly export 'quoted text' 2>/dev/null
+sed $(pwd) test printf $(pwd) --verbose "$1" awk x=1 | 'quoted text'
+		echo printf 'quoted text' done readonly --verbose -eu awk printf grep done | "$@"
+		echo local 2>/dev/null test | &&
+	then --verbose printf printf test
+		echo && && "$@" ${HOME} test /usr/bin -eu /usr/bin
+test ${HOME} done -eu sed ${HOME} "$1"
+		/usr/bin test && x=1 local cd test x=1 test then x=1 test
+grep sed grep sed /usr/bin done then
+	then x=1 export then "$1" /usr/bin "$@" test $(pwd)
+	/usr/bin x=1 -eu && ${HOME} echo printf grep readonly 'quoted text'
+		local cd --verbose && printf awk then local "$@"
+--verbose x=1 sed | grep 2>/dev/null then awk ${HOME}
+/usr/bin export awk then $(pwd) -eu
+		grep cd then grep done "$@" grep test 'quoted text' sed x=1 --verbose
+		-eu "$1" ${HOME} done "$1" readonly "$1" sed
+		test | -eu done $(pwd) awk sed readonly "$@" --verbose echo $(pwd) -eu sed echo
+		x=1 printf -eu && && cd ${HOME} && $(pwd) | printf "$@"
+&& /usr/bin 2>/dev/null x=1 | grep sed echo local then awk
+		'quoted text' local printf grep
+	export ${HOME} echo awk /usr/bin
+test done | | && && local $(pwd) awk ${HOME} | sed printf 2>/dev/null
+	then $(pwd) "$1" echo sed cd sed ${HOME} sed "$1" export && export
+readonly printf --verbose echo cd test
+local sed export ${HOME} x=1 grep test done local sed && test grep /usr/bin
+/usr/bin done printf ${HOME} $(pwd) export "$1" "$@" -eu
+		&& cd --verbose x=1 ${HOME} && -eu x=1
+	grep then --verbose /usr/bin -eu --verbose /usr/bin awk local ${HOME}
+		export x=1 local grep x=1 $(pwd) $(pwd) done x=1 /usr/bin grep $(pwd) sed x=1
+x=1 test cd x=1 readonly grep echo
+		test x=1 2>/dev/null test local "$@" /usr/bin
+	"$@" test readonly done printf $(pwd) x=1 awk ${HOME}
+		/usr/bin /usr/bin grep && cd done 2>/dev/null
+	"$@" | echo printf grep x=1 echo sed $(pwd) "$1" local export sed
+		| 2>/dev/null "$1" printf
+		awk local test echo "$@" --verbose then 2>/dev/null
+then awk local then printf
+	/usr/bin awk x=1 "$1" readonly --verbose readonly
+x=1 grep sed echo "$1" cd test echo cd
+		--verbose 2>/dev/null x=1 --verbose then cd && "$1" awk $(pwd) /usr/bin
+	then | | 'quoted text' done grep -eu /usr/bin
+${HOME} readonly then awk
+	2>/dev/null grep "$1" 'quoted text' export awk local ${HOME} readonly
+-eu "$@" ${HOME} $(pwd) sed $(pwd) --verbose ${HOME} x=1 cd 'quoted text' export
+local 2>/dev/null "$@" $(pwd) -eu 2>/dev/null
+		sed $(pwd) 'quoted text' --verbose x=1 cd readonly local awk awk printf /usr/bin
+		readonly cd /usr/bin x=1 echo readonly cd echo echo x=1 x=1 cd | export
+	printf | printf readonly printf && done 'quoted text'
+	'quoted text' $(pwd) 2>/dev/null sed echo | export
+		echo readonly awk printf -eu ${HOME}
+	sed 'quoted text' 'quoted text'
+sed && then awk printf
+	${HOME} "$1" -eu local done | echo
+	cd 'quoted text' ${HOME} sed "$@"
+		test awk "$@" $(pwd) $(pwd) ${HOME} 2>/dev/null "$1" done readonly grep
+		grep x=1 | export $(pwd) "$1" test echo awk test -eu
+/usr/bin sed readonly done export "$@" "$1" echo "$1" | "$1" 2>/dev/null
+	sed -eu test | printf && grep "$1" cd test printf x=1 --verbose
+'quoted text' "$@" local export awk printf "$@" /usr/bin test -eu readonly
+	printf sed ${HOME} test grep 'quoted text'
+	${HOME} 2>/dev/null printf -eu grep grep $(pwd)
+	done test awk test sed sed echo -eu grep export | awk -eu export $(pwd) export
+"$1" export -eu "$@" printf 'quoted text' cd ${HOME} echo export done
+	echo --verbose export readonly local 2>/dev/null export | readonly
+		"$1" --verbose sed /usr/bin
+printf -eu --verbose grep && "$1" echo ${HOME} printf
+		then test echo grep /usr/bin /usr/bin printf sed -eu awk "$1" 2>/dev/null
+	"$@" $(pwd) grep awk | grep readonly --verbose sed
+| $(pwd) 2>/dev/null 'quoted text' printf test && --verbose $(pwd) $(pwd) test
+export echo echo x=1 export test cd done "$1" | | cd export
+		-eu "$1" "$@" -eu 'quoted text' export 'quoted text' cd sed sed awk done
+readonly "$1" --verbose sed x=1 x=1 -eu && ${HOME}
+		grep printf x=1 x=1 --verbose 'quoted text' export $(pwd) x=1 'quoted text'
+sed done echo done local 2>/dev/null
+/usr/bin && --verbose readonly local
+sed cd ${HOME} test readonly
+	"$@" grep "$@" test "$@" readonly $(pwd) |
+		| -eu "$1" readonly 2>/dev/null done -eu cd
+--verbose printf && awk ${HOME} done awk --verbose sed sed local
+--verbose test grep $(pwd) -eu done awk local --verbose
+		x=1 /usr/bin done ${HOME}
+test test "$1" cd -eu cd /usr/bin
+	done "$1" local | /usr/bin "$@" --verbose local export printf
+	echo printf test sed sed then
+	--verbose "$1" done $(pwd) sed "$1" done export echo /usr/bin 2>/dev/null $(pwd)
+	readonly cd "$@" --verbose && local -eu cd readonly
+		grep ${HOME} cd export "$@" $(pwd) "$@" 2>/dev/null printf
+	$(pwd) sed cd echo "$@" /usr/bin --verbose
+	printf grep export local awk printf then -eu then then export && "$@" -eu x=1
+awk && awk x=1 x=1 && x=1 $(pwd) cd printf local grep "$1"
+printf "$@" export && | 'quoted text'
+	awk "$1" "$@" --verbose x=1 /usr/bin done ${HOME} --verbose
+	"$@" sed test "$1" then
+export ${HOME} local sed local --verbose awk $(pwd) x=1 cd 'quoted text'
+		sed sed echo --verbose local export ${HOME} local cd local
+awk -eu && 2>/dev/null grep done sed x=1 grep "$1" local
+		done --verbose && export done awk awk "$1" 'quoted text'
+"$1" -eu echo done test x=1 x=1 then then test local $(pwd) && --verbose
+${HOME} done export export /usr/bin done grep awk cd |
+		/usr/bin "$@" echo cd export readonly sed "$1" local local 2>/dev/null
+'quoted text' --verbose "$1" -eu local -eu cd printf "$1" /usr/bin 'quoted text'
+${HOME} "$1" then -eu "$1" readonly then printf ${HOME} ${HOME} sed 2>/dev/null
+		awk echo done done x=1 test x=1 export sed grep "$1" $(pwd) export
+	readonly then echo cd test -eu awk "$@"
+local local local awk printf x=1 then
+		done $(pwd) --verbose awk | -eu readonly /usr/bin --verbose
+		readonly "$1" 2>/dev/null -eu test /usr/bin $(pwd) echo && "$@" sed local readonly
+		/usr/bin export test done 'quoted text' awk echo "$1" "$@" "$1"
+	${HOME} then echo then $(pwd) then test
+		2>/dev/null x=1 readonly x=1 --verbose /usr/bin grep then 'quoted text' -eu |
+		export export --verbose /usr/bin printf | export then
+done done -eu sed --verbose printf "$1" "$@" "$@" 2>/dev/null
+sed && awk $(pwd) readonly && sed "$@" then ${HOME} "$@" grep --verbose
+	| && 2>/dev/null readonly sed "$@" printf then printf | readonly
+		${HOME} /usr/bin then printf
+	local printf | /usr/bin /usr/bin awk done cd grep sed
+local cd | "$1" 'quoted text' readonly done && local $(pwd) -eu readonly
+	cd export awk /usr/bin $(pwd) | then /usr/bin
+		printf 'quoted text' -eu
+		awk cd | ${HOME} echo test 2>/dev/null --verbose printf done
+export echo 'quoted text' readonly
+	${HOME} 'quoted text' ${HOME} local local awk awk 'quoted text' local awk --verbose
+sed $(pwd) done then grep local -eu
+		$(pwd) ${HOME} -eu | cd export
+&& ${HOME} "$1" "$@" -eu -eu && &&
+		export echo echo export awk
+export echo "$1" $(pwd) echo printf ${HOME}
+| printf local "$@" echo /usr/bin ${HOME} awk "$1" export && echo
+-eu test cd ${HOME} test echo awk $(pwd)
+x=1 /usr/bin 'quoted text' local
+/usr/bin awk 2>/dev/null local grep done readonly --verbose -eu x=1 --verbose
+		done test local done x=1 then printf export 2>/dev/null x=1 x=1
+	x=1 $(pwd) export echo test sed test local then printf x=1 awk grep readonly awk
+	${HOME} sed "$1" done "$1" --verbose export awk
+		"$1" "$@" "$@" "$1" test printf x=1 | 'quoted text' printf
+/usr/bin $(pwd) grep done awk local
+		local export | awk readonly awk --verbose cd echo grep "$1" printf cd 2>/dev/null
+	awk grep x=1 local then awk then done cd && export
+	sed -eu && ${HOME} grep ${HOME} 'quoted text' && ${HOME} 2>/dev/null
+		| printf 2>/dev/null
+	$(pwd) --verbose printf && /usr/bin awk
+2>/dev/null grep /usr/bin test cd grep x=1
+		done echo /usr/bin -eu export /usr/bin cd local ${HOME} /usr/bin
+		x=1 printf | | export then 2>/dev/null
+	test done echo 2>/dev/null --verbose then local --verbose
+	/usr/bin $(pwd) "$@" "$@" 'quoted text' sed 2>/dev/null
+then readonly "$@" | "$1" $(pwd) --verbose $(pwd) -eu
+		| readonly "$@" grep && done done /usr/bin
+echo /usr/bin 2>/dev/null sed sed -eu readonly x=1 --verbose $(pwd) && readonly
+	grep test "$1" ${HOME} ${HOME} | awk ${HOME} readonly
+		export grep ${HOME} /usr/bin then printf done grep x=1 readonly x=1 "$1"
+| "$@" then grep | echo
+	printf "$@" ${HOME} | | "$1" 'quoted text' -eu done awk
+		readonly printf test cd x=1 --verbose then --verbose -eu 2>/dev/null export
+&& /usr/bin -eu "$@" -eu done sed readonly "$@" cd readonly "$@" && cd
+export export /usr/bin x=1 done /usr/bin
+	&& -eu export then local && done ${HOME} 2>/dev/null $(pwd) 2>/dev/null echo
+	then export ${HOME} $(pwd) $(pwd) $(pwd) -eu awk -eu
+$(pwd) cd $(pwd) && /usr/bin echo ${HOME}
+		readonly local 2>/dev/null readonly printf --verbose 'quoted text'
+	${HOME} grep 'quoted text' /usr/bin "$1" -eu --verbose
+		"$@" echo export awk printf awk 2>/dev/null $(pwd) "$1" x=1 | local
+	/usr/bin then awk test
+		echo 2>/dev/null sed readonly | cd &&
+local /usr/bin readonly cd
+		/usr/bin 2>/dev/null test | "$1" x=1 sed 'quoted text' awk 2>/dev/null "$@" | &&
+${HOME} && "$@" && -eu
+export $(pwd) $(pwd) test done cd ${HOME} 'quoted text' && local "$@" x=1 2>/dev/null
+		sed local | | "$@" sed ${HOME} && 2>/dev/null readonly x=1 $(pwd)
+	"$1" printf x=1 grep test && readonly | -eu 'quoted text'
+		"$@" awk && 2>/dev/null x=1 /usr/bin grep then sed && readonly
+-eu readonly awk x=1 cd test 2>/dev/null
+	&& 'quoted text' | $(pwd) $(pwd) x=1 readonly $(pwd) --verbose test x=1 | then
+	&& 'quoted text' awk ${HOME} printf test done -eu 'quoted text' printf /usr/bin
+"$1" test test -eu grep --verbose /usr/bin
+		echo sed printf 'quoted text' cd -eu readonly awk x=1 &&
+	&& $(pwd) grep cd printf awk echo 'quoted text' 'quoted text' && readonly | then
+$(pwd) 'quoted text' && x=1 ${HOME}
+/usr/bin --verbose "$@" test awk | then done echo sed then cd
+	'quoted text' local 2>/dev/null /usr/bin printf printf x=1 grep x=1 --verbose
+/usr/bin "$@" x=1 then grep printf $(pwd)
+		sed 'quoted text' "$@" "$@" echo $(pwd) grep printf done x=1 $(pwd) | --verbose
+'quoted text' cd && x=1 2>/dev/null echo local readonly
+	sed test export /usr/bin -eu 'quoted text' "$1" then echo
+export echo local cd then grep -eu local local export $(pwd) |
+awk readonly then awk readonly printf | grep $(pwd) awk
+2>/dev/null printf --verbose
+	-eu -eu ${HOME} 2>/dev/null ${HOME} "$@" readonly 'quoted text'
+then "$@" x=1 echo $(pwd) /usr/bin
+	sed 'quoted text' | x=1 ${HOME} test echo cd grep /usr/bin grep grep 'quoted text'
+x=1 local sed "$@" sed readonly "$1" awk local sed ${HOME} local --verbose x=1
+	${HOME} test 'quoted text' "$1" then done awk && "$1" && "$@" export 'quoted text'
+sed printf local x=1 x=1 cd
+		test --verbose grep $(pwd) ${HOME} export sed "$@" ${HOME} "$1" sed awk "$@" |
+&& 2>/dev/null $(pwd) | && sed | test
+	'quoted text' --verbose readonly awk test -eu --verbose done readonly echo
+		x=1 $(pwd) export --verbose cd done 2>/dev/null export ${HOME}
+2>/dev/null -eu export export export cd 'quoted text'
+"$@" | echo -eu echo /usr/bin "$1" -eu && echo 'quoted text'
+		2>/dev/null sed x=1 x=1 readonly done -eu
+	awk echo cd && | /usr/bin $(pwd) printf 'quoted text' grep | printf |
+		x=1 grep export done readonly echo sed "$@" export echo /usr/bin -eu -eu "$1"
+done /usr/bin readonly && readonly test | grep export /usr/bin
+readonly | cd x=1 local grep readonly done
+		grep printf then then "$@" "$@" cd x=1 'quoted text'
+	then --verbose ${HOME} grep -eu --verbose done x=1 $(pwd) -eu test 2>/dev/null
+		"$1" grep && local awk /usr/bin && "$@" --verbose x=1 /usr/bin cd then done then
+		x=1 "$1" then readonly $(pwd) "$1" export awk echo
+sed 'quoted text' 'quoted text' done then local && readonly test /usr/bin
+		export readonly 'quoted text' then "$1" done sed -eu x=1 done -eu /usr/bin 'quoted text'
+		${HOME} /usr/bin printf ${HOME}
+		/usr/bin done "$1" ${HOME} test $(pwd) /usr/bin cd cd "$@" x=1 &&
+	grep awk done echo sed /usr/bin
+&& echo /usr/bin readonly export -eu 'quoted text'
+sed test awk x=1 $(pwd)
+	2>/dev/null --verbose && -eu "$@" 'quoted text' | grep export /usr/bin "$1"
+		test ${HOME} sed "$@" done export "$1" awk "$1"
+		local grep awk 2>/dev/null -eu sed /usr/bin 'quoted text'
+		"$@" awk --verbose "$1" grep
+		printf 'quoted text' "$@"
+	local /usr/bin local printf sed export readonly | && then readonly
+		-eu 2>/dev/null --verbose -eu local -eu 'quoted text'
+	"$@" 'quoted text' x=1 grep 2>/dev/null && awk readonly done echo local
+	export "$@" "$@" readonly "$@"
+awk cd $(pwd) --verbose sed -eu | /usr/bin 'quoted text' echo /usr/bin awk 'quoted text'
+		$(pwd) 'quoted text' done done sed
+		-eu 2>/dev/null echo "$1" ${HOME} readonly
+	--verbose grep x=1 --verbose
+--verbose done 'quoted text' then /usr/bin
+/usr/bin 2>/dev/null "$1" grep echo sed test sed ${HOME} --verbose cd 'quoted text'
+	| done /usr/bin /usr/bin 2>/dev/null echo grep
+	"$@" 'quoted text' then "$@" -eu then export "$@" && 'quoted text' awk
+	local awk echo local 2>/dev/null ${HOME} "$1" printf export readonly
+	printf "$1" 2>/dev/null /usr/bin local sed
+	done --verbose x=1 test | printf x=1 readonly "$@"
+		"$1" echo | --verbose cd then done 2>/dev/null "$1" | $(pwd)
+printf $(pwd) 'quoted text' awk $(pwd)
+		/usr/bin echo /usr/bin $(pwd) --verbose export /usr/bin echo
+cd 'quoted text' 2>/dev/null awk export local
+		sed grep && | 'quoted text' export --verbose grep done done grep readonly local
+	x=1 printf cd $(pwd) export --verbose
+sed 'quoted text' printf done test awk
+echo | printf then grep $(pwd)
+	2>/dev/null ${HOME} cd "$@" --verbose "$1" "$1" grep
+		test awk readonly "$@" printf x=1 -eu
+		&& readonly local && /usr/bin | 2>/dev/null && $(pwd)
+	"$1" done printf "$1" "$1" export echo ${HOME} x=1 grep $(pwd)
+done "$1" x=1 done | awk awk 2>/dev/null
+		$(pwd) export test sed grep &&
+	${HOME} export | --verbose local
+	then && && 'quoted text' 2>/dev/null "$1"
+		&& grep then | grep done done
+	export ${HOME} local x=1 ${HOME} done export done ${HOME} grep 2>/dev/null
+	2>/dev/null cd "$@" x=1
+	'quoted text' --verbose 'quoted text' test x=1 "$@" -eu cd "$@" &&
+		'quoted text' "$1" printf then readonly /usr/bin done x=1 test test x=1
+		awk x=1 readonly done /usr/bin | && printf echo printf && cd awk -eu 2>/dev/null
+		sed --verbose local "$@" ${HOME}
+	sed $(pwd) --verbose "$1" export
+-eu printf 2>/dev/null sed | -eu grep grep awk grep /usr/bin done export sed
+test "$@" --verbose then ${HOME} printf test
+	2>/dev/null 2>/dev/null $(pwd) local echo local echo cd
+		${HOME} "$1" test --verbose ${HOME} x=1 export "$1" -eu
+grep | $(pwd) test | ${HOME}
+	test $(pwd) grep "$1" grep ${HOME} local local echo cd local 'quoted text'
+local "$1" | | | readonly 2>/dev/null done -eu export --verbose
+export done grep 2>/dev/null awk sed --verbose awk export
+		local printf local cd --verbose -eu test printf cd echo --verbose readonly test
+&& done awk then export readonly "$@" sed then test local cd "$1"
+grep then sed -eu test && echo echo sed "$@" ${HOME} test then "$1"
+		"$1" sed ${HOME} 'quoted text' 2>/dev/null grep sed awk /usr/bin printf x=1
+export "$1" sed /usr/bin | done ${HOME} 2>/dev/null
+	grep grep -eu -eu /usr/bin
+${HOME} awk "$1" ${HOME} local local | | ${HOME} 'quoted text' ${HOME}
+2>/dev/null ${HOME} -eu
+'quoted text' readonly printf export && readonly cd -eu 2>/dev/null export
+/usr/bin x=1 cd -eu done test test awk export grep "$1" export awk test ${HOME}
+	cd export awk $(pwd) grep && 'quoted text' ${HOME} done /usr/bin export then done
+		cd local "$@" then local "$1" grep $(pwd) "$1" echo x=1 && | 2>/dev/null
+		&& echo $(pwd) "$@" $(pwd)
+	sed awk /usr/bin cd awk printf test cd "$@" done then export awk export
+sed export "$1" local local printf local
+	then grep && 2>/dev/null
+	| --verbose "$@" "$@" && /usr/bin printf 'quoted text' "$1"
+		-eu 2>/dev/null then "$@" 2>/dev/null "$1" ${HOME}
+	&& --verbose grep readonly -eu "$@" readonly export | grep 'quoted text'
+	readonly readonly 2>/dev/null "$1" done ${HOME} local "$1" && local "$@"
+"$1" | 'quoted text' local --verbose local awk && printf | sed
+		export /usr/bin sed -eu local sed then export --verbose --verbose
+	"$@" test /usr/bin cd "$1" | 'quoted text' local export
+--verbose test "$1" echo -eu | && x=1 grep /usr/bin x=1 grep 'quoted text'
+	grep "$1" printf x=1 cd
+	2>/dev/null ${HOME} /usr/bin export
+		2>/dev/null grep $(pwd) then /usr/bin awk 'quoted text'
+		test then | local | done && $(pwd) sed $(pwd)
+readonly $(pwd) && done cd export
+		'quoted text' printf grep /usr/bin ${HOME} ${HOME}
+	then 'quoted text' "$1" printf && echo "$1" export
+		${HOME} "$1" then local cd cd then 'quoted text' 'quoted text'
+-eu readonly $(pwd) cd test grep printf 2>/dev/null /usr/bin
+		${HOME} /usr/bin done sed 2>/dev/null | awk readonly 'quoted text' x=1 --verbose
+	test | sed --verbose /usr/bin && awk awk 'quoted text'
+done sed echo /usr/bin sed export test && echo local
+		&& printf | --verbose printf sed then /usr/bin cd && -eu --verbose --verbose
+		sed ${HOME} local | then 'quoted text' grep
+	-eu x=1 --verbose awk grep sed "$1" printf
+test | cd readonly -eu grep printf 'quoted text'
+	-eu | cd | then $(pwd) printf | /usr/bin awk 'quoted text'
+		readonly local | sed done /usr/bin 'quoted text' 2>/dev/null then cd
+		'quoted text' /usr/bin
+		2>/dev/null awk ${HOME} --verbose /usr/bin then "$1" ${HOME} export
+		${HOME} cd "$@" -eu "$@" "$1" readonly
+	"$1" "$@" 'quoted text' sed echo sed x=1 --verbose awk printf printf
+grep /usr/bin then && local readonly "$@" -eu /usr/bin sed export sed echo
+	readonly x=1 then && "$1" export ${HOME} grep $(pwd)
+$(pwd) | grep /usr/bin 2>/dev/null printf && export
+		&& ${HOME} printf -eu 'quoted text' $(pwd) awk "$1" x=1
+	-eu readonly 2>/dev/null 'quoted text' /usr/bin
+awk done grep /usr/bin sed sed --verbose cd "$1" | $(pwd)
+		cd sed test 2>/dev/null grep grep "$@" grep && test $(pwd)
+	$(pwd) then then -eu --verbose cd printf | then then
+awk sed awk x=1 --verbose 'quoted text' -eu local $(pwd) grep
+		"$@" export grep && awk --verbose
+awk echo | readonly -eu printf
+"$1" ${HOME} /usr/bin | export sed
+		cd then 'quoted text' $(pwd) export 'quoted text' /usr/bin
+		local local $(pwd) printf readonly $(pwd) printf "$1" -eu
+grep export done --verbose -eu done
+	local echo x=1 /usr/bin $(pwd) readonly $(pwd) export then test
+	test printf local printf "$1" ${HOME} "$@" export awk then
+	"$@" 2>/dev/null test echo
+$(pwd) "$1" "$@" /usr/bin x=1 --verbose
+		$(pwd) sed -eu printf 'quoted text'
+"$@" cd then ${HOME} /usr/bin local $(pwd) printf ${HOME} | x=1 2>/dev/null
+	$(pwd) cd cd ${HOME} x=1 printf /usr/bin awk | -eu local sed
+cd sed --verbose "$1" ${HOME} export --verbose sed echo $(pwd) |
+		"$1" -eu cd done 'quoted text' cd
+		awk /usr/bin "$@" cd grep then --verbose $(pwd) test grep test
+		printf test echo done grep 2>/dev/null --verbose --verbose readonly readonly
+export ${HOME} done grep grep && sed 'quoted text' 2>/dev/null
+		$(pwd) /usr/bin 'quoted text' x=1 sed $(pwd) 2>/dev/null "$1"
+		'quoted text' awk echo then grep done cd done
+	awk -eu test done sed sed 'quoted text' 'quoted text'
+	"$1" local | export x=1 awk "$1"
+then local local done test --verbose 'quoted text' local
+	'quoted text' 'quoted text' echo
+	done local local 2>/dev/null x=1 /usr/bin cd "$1" then echo
+cd | grep printf 'quoted text' then && | sed grep ${HOME}
+/usr/bin local "$1" done -eu "$@" && && echo "$1" "$@" awk
+x=1 done 'quoted text' then local
+	'quoted text' --verbose echo "$1" printf "$1" test $(pwd) $(pwd) --verbose
+sed readonly | grep --verbose /usr/bin
+	readonly sed ${HOME} /usr/bin test then
+	/usr/bin sed "$@" local && export local
+	local --verbose echo awk "$1" sed then "$1" echo then test printf awk printf
+	then printf grep | echo echo "$1" ${HOME} 'quoted text' ${HOME}
+	local ${HOME} ${HOME} 2>/dev/null echo local printf done "$@" done --verbose "$1"
+	"$1" && local $(pwd) --verbose | 2>/dev/null awk
+	'quoted text' 2>/dev/null 2>/dev/null --verbose test
+${HOME} -eu /usr/bin "$1" $(pwd) && x=1 grep "$@" cd
+awk grep then | x=1 cd 2>/dev/null --verbose awk done $(pwd)
+		echo 2>/dev/null test /usr/bin printf $(pwd)
+	local 'quoted text' awk --verbose
+test "$1" printf -eu readonly -eu echo readonly
+	"$1" ${HOME} ${HOME} x=1 grep export printf -eu "$1" $(pwd)
+/usr/bin done test | ${HOME} readonly $(pwd) sed ${HOME}
+	readonly done test | export done && $(pwd) "$1" test /usr/bin
+	-eu $(pwd) cd local then done awk local 'quoted text' --verbose 2>/dev/null -eu
+awk && cd "$1" done | readonly -eu && /usr/bin local && $(pwd)
+'quoted text' /usr/bin test | --verbose 2>/dev/null
+		-eu x=1 $(pwd) "$1" 2>/dev/null "$@" echo --verbose then "$@" -eu ${HOME}
+		${HOME} cd 'quoted text' $(pwd) "$1" /usr/bin "$@" "$@" test 'quoted text'
+		done echo awk ${HOME} local && ${HOME} | x=1 awk ${HOME} "$1" x=1 test
+readonly test export "$1" "$1" awk export && 2>/dev/null 'quoted text' grep ${HOME}
+		$(pwd) grep "$@" done printf then test cd sed && $(pwd) done awk -eu ${HOME} &&
+'quoted text' awk ${HOME} echo "$@" done 2>/dev/null && ${HOME} 'quoted text'
+		cd cd awk $(pwd) test test "$@" ${HOME}
+export readonly /usr/bin /usr/bin ${HOME} sed
+	readonly sed readonly awk export grep 2>/dev/null export ${HOME} 'quoted text'
+awk -eu local && | 2>/dev/null
+		&& /usr/bin --verbose printf -eu local awk && then echo sed
+		"$@" sed echo && echo cd
+	--verbose "$1" 'quoted text'
+"$@" export sed sed "$1" cd
+	local -eu printf && "$@" /usr/bin readonly && local
+		readonly then export echo sed awk sed 2>/dev/null "$@" readonly 'quoted text'
+		done export "$1" grep awk echo awk then printf
+		test 'quoted text' grep cd test x=1 x=1 2>/dev/null x=1 echo 'quoted text'
+	$(pwd) $(pwd) x=1 --verbose && done then --verbose local
+		then readonly export x=1 x=1 sed | sed 'quoted text'
+		$(pwd) echo "$@" && | --verbose
+		'quoted text' 2>/dev/null "$@" ${HOME} && "$@" echo x=1 | then && cd
+		$(pwd) x=1 echo x=1 "$1" test 2>/dev/null echo $(pwd) export
+sed test awk sed | | "$1" 'quoted text'
+	&& printf "$@" "$1" && x=1 /usr/bin readonly
+		-eu 'quoted text' ${HOME} readonly
+cd sed test printf done then test echo cd | ${HOME} then echo && && awk "$@" $(pwd)
+	local local grep --verbose then 2>/dev/null
+		$(pwd) test awk /usr/bin x=1 --verbose -eu local export
+	echo grep grep then local cd "$@" 'quoted text' done done "$@" 2>/dev/null
+	readonly -eu printf $(pwd) $(pwd)
+	test export export echo readonly "$@" /usr/bin
+awk /usr/bin /usr/bin ${HOME} ${HOME} then printf "$1" x=1
+	awk --verbose done --verbose /usr/bin grep /usr/bin /usr/bin readonly done
+		$(pwd) test sed x=1 ${HOME} local && && grep "$@" readonly
+	then cd local --verbose then 'quoted text' "$1" | sed && readonly
+-eu "$@" echo && --verbose readonly 'quoted text' | "$1" && ${HOME} test printf
+		--verbose ${HOME} -eu done && /usr/bin --verbose done x=1 --verbose $(pwd)
+	x=1 x=1 -eu ${HOME} cd export then then printf readonly
+	sed /usr/bin local ${HOME} awk 2>/dev/null x=1 grep | 2>/dev/null
+	$(pwd) then export sed ${HOME} cd grep /usr/bin
+		-eu "$1" -eu /usr/bin "$@" 'quoted text'
+echo then x=1 test local readonly
+$(pwd) && "$1" 'quoted text' "$1" && done -eu echo
+	cd local cd export sed
+	/usr/bin done printf "$@" $(pwd) "$@" $(pwd) 2>/dev/null readonly -eu printf
+		$(pwd) cd awk && then printf | echo sed -eu
+		done -eu done readonly local test grep "$1" test
+		readonly grep $(pwd) ${HOME} -eu "$1" x=1 -eu local "$1" printf "$@" $(pwd)
+	printf 'quoted text' --verbose readonly export echo | echo cd test $(pwd)
+"$1" x=1 echo ${HOME} $(pwd) "$1" test --verbose
+--verbose printf local "$1" export printf test $(pwd) /usr/bin
+	"$@" 2>/dev/null done readonly
+	sed | --verbose "$@" /usr/bin echo
+		/usr/bin printf /usr/bin local
+grep | --verbose printf 2>/dev/null
+	$(pwd) sed && done readonly /usr/bin 'quoted text' ${HOME} x=1 'quoted text'
+then sed echo "$@" x=1 test "$@" 2>/dev/null
+		echo done --verbose ${HOME} export "$1" "$@" | | local 2>/dev/null local local
+"$1" printf x=1 readonly cd local printf x=1 /usr/bin then awk
+		grep && 2>/dev/null "$1" $(pwd) "$@" done export export printf grep printf
+&& 2>/dev/null echo cd cd export
+		&& x=1 -eu | awk x=1 then test /usr/bin
+		2>/dev/null printf -eu awk 2>/dev/null $(pwd) echo awk echo readonly 'quoted text'
+grep ${HOME} ${HOME} "$1" printf export sed --verbose && sed
+echo export $(pwd) done $(pwd)
+$(pwd) done cd 'quoted text'
+local sed awk 'quoted text' readonly $(pwd) "$@" local
+-eu "$@" grep grep $(pwd) && 'quoted text' cd then
+	"$@" grep readonly done printf -eu 'quoted text'
+		export echo then export local /usr/bin
+	| ${HOME} grep 2>/dev/null then readonly x=1 sed readonly
+	"$1" then && "$@" printf /usr/bin --verbose 2>/dev/null
+		/usr/bin 'quoted text' && | 2>/dev/null local && grep 2>/dev/null -eu then ${HOME}
+	sed "$@" -eu awk "$@" export
+	test $(pwd) sed /usr/bin then -eu readonly
+sed cd grep --verbose "$@" cd --verbose sed then 'quoted text'
+	| cd then local grep done test then test
+	then echo "$@" sed ${HOME} &&
+		awk 'quoted text' grep export "$@" test "$1" printf ${HOME} test $(pwd) ${HOME}
+awk 'quoted text' x=1 'quoted text' sed $(pwd) grep local cd --verbose
+sed --verbose export awk grep
+		grep "$1" readonly printf | printf && -eu 2>/dev/null x=1 printf test
+done sed readonly 2>/dev/null printf grep cd ${HOME}
+	export printf "$@" x=1 -eu ${HOME} /usr/bin
+		-eu && done printf "$1" ${HOME} grep readonly awk "$1" test $(pwd)
+		--verbose ${HOME} 'quoted text' grep | export then export "$1"
+		printf "$@" readonly awk printf local ${HOME} /usr/bin 'quoted text' awk test
+x=1 2>/dev/null x=1 --verbose --verbose "$1" 'quoted text' done echo local test
+grep /usr/bin cd export sed -eu ${HOME} awk awk --verbose test cd done
+		2>/dev/null echo ${HOME} x=1 && 2>/dev/null
+	2>/dev/null export printf "$1"
+cd cd 'quoted text' echo cd readonly && x=1 /usr/bin
+	readonly $(pwd) "$@" local "$@" 2>/dev/null
+	--verbose sed /usr/bin export ${HOME} ${HOME} | "$@" export local printf
+		test x=1 && grep /usr/bin $(pwd) "$1" printf | "$1" grep
+	then sed export --verbose readonly ${HOME}
+	local 'quoted text' awk --verbose /usr/bin grep readonly 2>/dev/null
+"$@" | grep readonly echo echo readonly local
+	sed sed printf test --verbose test
+		awk printf cd test sed 'quoted text'
+		2>/dev/null local done | ${HOME} done readonly printf export then
+	sed local awk "$1" && && printf readonly /usr/bin --verbose
+-eu done then 'quoted text' test $(pwd) 2>/dev/null local echo /usr/bin
+		2>/dev/null --verbose printf && grep echo 2>/dev/null echo 2>/dev/null -eu x=1
+done $(pwd) "$@" test x=1 grep echo test printf
+	test "$1" "$1" local echo grep && cd then --verbose test --verbose export
+	"$1" ${HOME} "$1" echo export
+		local -eu test cd sed export
+	echo "$1" echo --verbose done --verbose x=1
+	/usr/bin -eu done then 'quoted text'
+| export test $(pwd) local /usr/bin "$@" "$1" "$@"
+		&& --verbose readonly "$1" && && local sed awk /usr/bin "$@" printf grep
+		done 'quoted text' | x=1 | cd
+	printf -eu then cd /usr/bin then then sed then echo $(pwd)
+		grep 2>/dev/null local -eu && cd && && --verbose grep "$@" 'quoted text'
+	then "$@" grep printf --verbose
+-eu sed cd sed then echo /usr/bin
+'quoted text' awk "$@"
+		awk sed echo echo readonly
+	--verbose done --verbose readonly --verbose "$@" local /usr/bin
+		local --verbose --verbose "$1" export x=1
+x=1 echo cd grep -eu x=1 -eu $(pwd) grep $(pwd) /usr/bin /usr/bin $(pwd) cd
+	awk $(pwd) 2>/dev/null -eu -eu sed "$1" "$@" then test echo | readonly
+		"$@" grep /usr/bin local echo $(pwd) x=1 "$@" local -eu /usr/bin
+		export local awk 2>/dev/null sed "$@" awk $(pwd)
+	local awk | $(pwd) -eu && x=1 done then sed local $(pwd) /usr/bin
+sed 2>/dev/null -eu $(pwd) "$1" printf ${HOME}
+		-eu awk done 'quoted text' x=1 --verbose local
+		done awk -eu done | "$@" sed local export test && 2>/dev/null
+	"$@" $(pwd) sed export sed sed && export
+2>/dev/null echo 2>/dev/null local
+then "$@" && 2>/dev/null local "$@" 'quoted text' export export ${HOME} ${HOME}
+	then 2>/dev/null then done
+		$(pwd) ${HOME} awk | x=1 x=1 /usr/bin sed awk "$@" cd /usr/bin echo echo 2>/dev/null
+		done export | ${HOME} echo $(pwd) printf
+sed | | local done $(pwd) echo readonly
+2>/dev/null local x=1 cd "$@" 2>/dev/null readonly
+	x=1 2>/dev/null "$@" cd | x=1 export done done 'quoted text'
+		readonly 2>/dev/null "$1" done readonly
+		/usr/bin cd grep sed "$1"
+	export 'quoted text' && "$1" grep sed cd 'quoted text' && && export | export
+	printf "$@" /usr/bin then ${HOME} 'quoted text' test printf printf $(pwd)
+"$1" test 'quoted text' 2>/dev/null export readonly ${HOME} awk
+	test -eu $(pwd) --verbose "$1" 'quoted text' export -eu grep /usr/bin
+		awk grep test local 2>/dev/null
+	test readonly local export 'quoted text' /usr/bin
+done test cd sed ${HOME} local --verbose /usr/bin x=1 export awk local echo "$1"
+	local /usr/bin && $(pwd) readonly local
+		x=1 ${HOME} grep cd echo cd export export
+		x=1 x=1 awk ${HOME} -eu
+		local test printf echo 2>/dev/null 'quoted text' 2>/dev/null
+		$(pwd) | printf then x=1 cd 2>/dev/null $(pwd) echo export
+/usr/bin && grep done test sed done sed --verbose $(pwd) cd test "$@"
+	$(pwd) sed --verbose && "$1" test | x=1 $(pwd) readonly local local "$@" | done
+	test sed 2>/dev/null printf done && export 'quoted text'
+awk echo --verbose "$@" done && sed then echo 'quoted text'
+		awk readonly done && done grep ${HOME} done && 'quoted text' && $(pwd) done
+	export 2>/dev/null grep done | ${HOME} "$1" sed && -eu grep | test sed
+	2>/dev/null 2>/dev/null "$@" /usr/bin 2>/dev/null
+	"$@" "$@" | x=1 /usr/bin "$@" "$1" ${HOME} x=1 --verbose | sed 2>/dev/null grep
+		echo readonly "$1" grep "$@" echo $(pwd)
+	echo printf ${HOME} "$1" readonly then grep awk 2>/dev/null
+grep x=1 --verbose sed 2>/dev/null
+	"$@" grep | ${HOME} ${HOME} | | --verbose done export 2>/dev/null ${HOME} done
+	test 'quoted text' "$1" then sed && then test && "$@" printf test cd test
+${HOME} done 'quoted text'
+		test | --verbose $(pwd) 2>/dev/null printf
+		"$1" test done x=1 grep echo
+done done grep cd && awk | grep | ${HOME}
+then printf "$1" cd --verbose cd printf /usr/bin cd /usr/bin
+| --verbose ${HOME} "$1" echo --verbose
+export /usr/bin "$1" --verbose | x=1 /usr/bin
+	2>/dev/null 2>/dev/null "$@" grep
+2>/dev/null local grep
+	grep $(pwd) then cd local done "$1"
+	"$1" printf readonly local && echo readonly test ${HOME}
+local awk -eu test grep "$1" /usr/bin "$1" sed x=1 grep
+	&& done awk sed 2>/dev/null | ${HOME} x=1 2>/dev/null then awk 'quoted text' --verbose
+		| local /usr/bin 'quoted text' printf ${HOME}
+grep $(pwd) done grep cd /usr/bin "$1" x=1 -eu local && export
+		readonly local 2>/dev/null echo export awk x=1
+	| cd 'quoted text' -eu x=1 awk -eu -eu export
+	--verbose echo --verbose
+		then -eu echo "$@" --verbose export && && ${HOME} 'quoted text' then export -eu
+	then ${HOME} && --verbose grep "$1" 'quoted text'
+	grep readonly "$1" local x=1 "$@" echo readonly | $(pwd) $(pwd) &&
+		done 'quoted text' && awk export printf "$1" echo 'quoted text' 2>/dev/null awk
+	"$@" 'quoted text' 2>/dev/null 'quoted text' -eu done echo
+export -eu grep x=1 "$@" --verbose
+		$(pwd) -eu export 'quoted text' printf ${HOME}
+		sed awk cd cd x=1 --verbose && readonly awk done test -eu then
+	$(pwd) echo ${HOME} x=1 test "$1" export grep ${HOME} &&
+		-eu -eu printf test ${HOME} && 2>/dev/null
+		"$1" grep x=1 "$@" -eu test printf export printf ${HOME} awk ${HOME} "$1"
+	then done test $(pwd) done -eu
+	printf x=1 printf "$1" local | cd local -eu /usr/bin x=1 then "$1" 'quoted text'
+	readonly x=1 export cd export 2>/dev/null grep
+	local "$1" grep echo echo done printf x=1
+printf readonly awk local then grep cd echo echo /usr/bin
+	test "$@" | $(pwd) -eu cd awk
+	readonly /usr/bin && export done 'quoted text' awk echo
+cd $(pwd) x=1 'quoted text' grep printf && -eu
+${HOME} printf | -eu ${HOME} then 2>/dev/null --verbose "$@"
+echo then 'quoted text' echo sed grep readonly echo 'quoted text' printf "$1"
+x=1 grep && | 'quoted text' "$@" done test 2>/dev/null && $(pwd) 'quoted text'
+$(pwd) grep then -eu echo ${HOME} cd $(pwd) -eu done -eu 2>/dev/null
+then sed printf $(pwd) 'quoted text' printf /usr/bin "$@" && --verbose -eu
+printf cd grep echo "$@" && -eu --verbose && x=1
+	"$1" local ${HOME} /usr/bin test x=1 'quoted text'
+		x=1 grep "$@" awk done cd ${HOME} cd local grep grep awk echo sed readonly
+	${HOME} "$@" grep x=1 sed | local
+/usr/bin test -eu "$@" grep printf grep "$1" "$@"
+	--verbose cd x=1 echo done grep grep && awk test awk ${HOME} | --verbose
+	sed test readonly grep --verbose $(pwd) cd then grep && -eu local
+	readonly -eu cd && | done readonly grep readonly && echo
+${HOME} | printf ${HOME} -eu 'quoted text' then awk x=1 2>/dev/null "$@" "$@" |
+grep $(pwd) $(pwd) local
+	'quoted text' | printf && ${HOME}
+		export echo /usr/bin $(pwd)
+then /usr/bin test --verbose cd grep grep
+/usr/bin done printf test $(pwd) 'quoted text' ${HOME} awk -eu "$1" local
+	| cd sed $(pwd) && "$@" echo 'quoted text' done -eu /usr/bin grep grep grep done
+'quoted text' grep | export grep awk done
+printf local local | done export sed
+		echo /usr/bin printf test local grep awk done x=1 | cd readonly
+--verbose ${HOME} ${HOME} export
+		"$1" --verbose "$@" printf cd done grep | sed
+x=1 'quoted text' $(pwd) "$1" grep export echo 2>/dev/null
+		| && grep -eu test "$@" | ${HOME} && sed x=1
+"$@" 'quoted text' printf "$@" then sed sed cd done grep grep "$1" | echo sed echo
+	"$@" --verbose test readonly test local x=1 export --verbose export then local
+'quoted text' readonly x=1 printf export export $(pwd) readonly 2>/dev/null
+		printf && "$@" export export 2>/dev/null cd printf sed && awk printf -eu cd test
+		export && grep readonly x=1 --verbose echo --verbose
+'quoted text' cd "$@" grep local | then x=1 --verbose "$1"
+		then && done awk readonly --verbose "$1"
+	awk readonly echo "$@" | cd
+	test -eu | export && -eu
+	2>/dev/null done done awk "$@" --verbose sed x=1 done printf readonly
+x=1 cd test && test && --verbose sed | readonly
+grep --verbose 2>/dev/null grep sed | ${HOME}
+		awk | x=1 /usr/bin 'quoted text' test x=1 x=1 local
+		| -eu sed /usr/bin export
+test test && then | then | done --verbose printf cd readonly local
+		"$@" local $(pwd) export sed -eu
+$(pwd) cd readonly ${HOME} "$@" -eu grep 2>/dev/null
+		cd done | echo test sed
+	test done $(pwd) | printf x=1 done awk cd
+	printf --verbose x=1 x=1 "$1" echo $(pwd) | grep test /usr/bin done readonly
+		| 'quoted text' --verbose "$1" /usr/bin 'quoted text' test export readonly /usr/bin
+		&& local x=1 then grep printf ${HOME} "$1" sed test 2>/dev/null
+	echo cd x=1 | 2>/dev/null cd local echo cd awk
+		echo --verbose "$1" | 'quoted text' "$1" --verbose && grep
+		printf echo $(pwd) 'quoted text'
+	--verbose && local local done ${HOME} awk awk && export awk sed
+x=1 --verbose export | "$@" cd | test -eu
+		local -eu grep /usr/bin
+		'quoted text' --verbose --verbose test x=1 ${HOME} "$1"
+		'quoted text' readonly done echo | readonly
+		&& sed test export "$@" echo then /usr/bin --verbose
+"$1" export --verbose test
+		"$@" local cd cd awk sed cd -eu ${HOME} awk 2>/dev/null
+	x=1 "$1" test cd awk --verbose readonly sed ${HOME}
+/usr/bin readonly "$1" | grep grep
+	--verbose then done printf awk test printf
+cd | $(pwd) x=1 local sed grep && ${HOME} | 'quoted text' --verbose awk echo
+		echo readonly --verbose awk "$@" --verbose
+	'quoted text' | | sed 'quoted text' echo export "$@" $(pwd)
+	"$1" "$@" local cd printf "$@"
+	$(pwd) cd grep cd | printf -eu ${HOME} cd grep "$1"
+	export done readonly then cd sed export readonly echo echo
+${HOME} echo readonly | 2>/dev/null ${HOME} "$@" $(pwd) 2>/dev/null done
+readonly printf local 'quoted text' then sed echo test export
+		local local echo cd local test
+	"$1" echo 2>/dev/null --verbose
+	'quoted text' && cd cd
+test && 2>/dev/null /usr/bin
+	grep "$@" --verbose export
+	printf awk local test local cd /usr/bin readonly
+printf printf | 'quoted text'
+	$(pwd) $(pwd) x=1 ${HOME} x=1 cd test "$@"
+	readonly readonly 'quoted text' printf "$@" 'quoted text' cd grep
+cd grep /usr/bin | -eu /usr/bin readonly printf readonly sed cd printf | "$@" &&
+2>/dev/null local cd export "$1" $(pwd) then /usr/bin 'quoted text'
+		awk -eu done --verbose sed
+	-eu local 2>/dev/null 2>/dev/null ${HOME} test done ${HOME} --verbose 2>/dev/null
+readonly -eu done local cd /usr/bin && ${HOME} cd readonly "$@" x=1 sed --verbose
+	echo x=1 $(pwd) | "$1" x=1 2>/dev/null
+test "$1" printf readonly sed -eu grep -eu
+		then printf 2>/dev/null grep
+		/usr/bin readonly readonly && | printf grep $(pwd) test 'quoted text'
+local $(pwd) /usr/bin sed | 'quoted text' cd printf 'quoted text' grep done $(pwd)
+local echo cd /usr/bin 2>/dev/null
+"$1" 'quoted text' -eu x=1 "$@" --verbose then grep /usr/bin "$@"
+		x=1 export x=1 /usr/bin done done awk cd | "$@" && 2>/dev/null
+		echo 'quoted text' printf "$1" "$1" 2>/dev/null printf
+		awk then --verbose 'quoted text' then --verbose cd grep echo then awk grep then
+		echo cd ${HOME} --verbose -eu cd then x=1 grep grep then "$@"
+	printf "$1" | $(pwd) test readonly ${HOME}
+		| cd x=1 /usr/bin $(pwd)
+	sed /usr/bin export 2>/dev/null readonly 2>/dev/null $(pwd) awk "$@" | $(pwd)
+${HOME} && test -eu x=1 "$1" readonly then -eu test "$1" $(pwd) | sed "$@" then
+		cd local echo | | 2>/dev/null export
+	-eu && test 2>/dev/null $(pwd) 'quoted text'
+	cd "$@" /usr/bin readonly grep readonly "$@" echo --verbose "$1" done &&
+"$1" "$@" x=1 awk sed test x=1 --verbose then | 2>/dev/null
+	local export local 'quoted text'
+		local $(pwd) ${HOME} awk awk --verbose "$1" x=1 && -eu && /usr/bin
+		"$@" --verbose "$@" done readonly echo "$1" export done 'quoted text'
+	| readonly $(pwd) printf local && -eu "$1" "$1" cd x=1 $(pwd) ${HOME} ${HOME}
+	--verbose readonly x=1 local done grep local awk --verbose $(pwd) 2>/dev/null
+	echo awk "$@" done "$@"
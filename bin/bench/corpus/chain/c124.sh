@@ -0,0 +1,2001 @@
+	test then --verbose 2>/dev/null --verbose "$@" local done export echo
+		-eu $(pwd) done | && readonly x=1
+--verbose && done echo echo test --verbose "$@"
+local export sed "$1" /usr/bin grep done ${HOME}
+"$1" --verbose /usr/bin | sed echo "$@" -eu awk readonly awk then && "$1"
+	awk /usr/bin "$1" printf printf && grep export printf "$1" 2>/dev/null
+		done test cd x=1 done | 2>/dev/null | --verbose -eu x=1 --verbose echo ${HOME}
+	test printf cd awk x=1 then --verbose "$@" readonly -eu "$@" readonly x=1 then
+grep readonly 2>/dev/null $(pwd) done --verbose
+x=1 sed readonly --verbose readonly ${HOME} test 'quoted text' 2>/dev/null
+		${HOME} --verbose readonly export readonly
+		${HOME} $(pwd) ${HOME}
+	then grep test then && sed test export awk /usr/bin && 'quoted text'
+	--verbose /usr/bin then -eu local
+awk grep then "$1" printf echo export
+| test x=1 awk then $(pwd) export && grep "$@"
+awk awk $(pwd) cd "$1" export | echo echo ${HOME} done
+	export cd test readonly cd export echo readonly readonly
+	done test export && && /usr/bin
+		${HOME} ${HOME} then
+		done cd /usr/bin && x=1 $(pwd) then && $(pwd) && done awk local awk
+	| $(pwd) cd 2>/dev/null $(pwd) cd -eu $(pwd) --verbose printf cd grep grep awk
+/usr/bin x=1 then then "$1" awk readonly readonly
+test local grep && awk grep sed then && && "$1" --verbose && /usr/bin
+-eu sed echo local readonly "$@" --verbose printf
+		export /usr/bin --verbose x=1 sed
+		"$1" printf grep then awk "$@" grep ${HOME} local export
+		local /usr/bin then sed then printf -eu cd ${HOME} then done 'quoted text'
+	"$@" export -eu readonly -eu /usr/bin readonly $(pwd) export
+	sed /usr/bin $(pwd) x=1 readonly then sed
+	test sed sed $(pwd) done --verbose "$1" grep x=1 2>/dev/null awk 'quoted text'
+	'quoted text' sed "$@" export printf
+	x=1 done sed && -eu local ${HOME}
+		"$@" grep then -eu "$1" ${HOME} -eu | "$@"
+	2>/dev/null | 2>/dev/null
+printf -eu grep export local
+${HOME} 2>/dev/null x=1 $(pwd) && 2>/dev/null printf readonly x=1 | -eu
+--verbose "$1" export export sed grep done sed 2>/dev/null grep x=1 test
+'quoted text' --verbose sed then && printf done done && "$@" then test ${HOME}
+		export "$1" sed local -eu awk "$@" --verbose echo "$1" -eu "$@" | -eu
+$(pwd) $(pwd) local sed $(pwd) readonly done echo grep 2>/dev/null
+	local awk local --verbose && printf readonly /usr/bin | echo | | grep
+readonly x=1 "$1" -eu 'quoted text'
+2>/dev/null done 'quoted text' &&
+export printf --verbose awk
+	sed awk echo ${HOME} -eu "$1" -eu awk /usr/bin readonly sed export $(pwd)
+		readonly then "$1" | && | printf /usr/bin cd printf export test readonly $(pwd)
+		done && x=1 "$1" test | 2>/dev/null readonly $(pwd) done export test && -eu readonly
+	"$1" "$1" printf echo -eu readonly
+	grep printf "$@" grep awk test | -eu
+		| readonly echo echo test x=1 printf cd /usr/bin done then
+		-eu "$1" ${HOME} printf then awk "$1" printf -eu -eu -eu sed --verbose $(pwd) |
+/usr/bin printf sed export readonly "$@" x=1 /usr/bin
+		2>/dev/null 'quoted text'
+'quoted text' export echo
+		readonly cd $(pwd) awk test /usr/bin -eu sed echo done local sed
+	printf | local /usr/bin ${HOME} printf "$@" printf /usr/bin local echo x=1 cd
+done printf -eu ${HOME} 2>/dev/null "$@" 'quoted text'
+2>/dev/null readonly "$@" echo export 2>/dev/null
+		cd test -eu grep "$@" local grep 'quoted text' /usr/bin ${HOME}
+		"$1" cd x=1 'quoted text' "$1" --verbose && test
+	'quoted text' && x=1 ${HOME} -eu ${HOME} 2>/dev/null && --verbose printf then
+then done -eu 'quoted text' export /usr/bin $(pwd)
+printf then $(pwd) 2>/dev/null
+	export ${HOME} readonly --verbose cd /usr/bin done grep export then --verbose
+	/usr/bin | done "$@" test awk 'quoted text' awk && 2>/dev/null
+		$(pwd) && printf | 2>/dev/null printf cd 'quoted text' "$@"
+		'quoted text' "$@" /usr/bin x=1 then printf
+		2>/dev/null sed done then export x=1 test "$1" x=1 grep local test x=1
+--verbose echo echo $(pwd) sed grep awk /usr/bin grep "$1" ${HOME}
+echo sed && $(pwd) grep x=1 --verbose awk test x=1
+	x=1 && | printf local $(pwd) done x=1 | grep 2>/dev/null "$1"
+	cd x=1 && -eu $(pwd) sed awk | echo 2>/dev/null | | /usr/bin | grep echo done
+		grep x=1 cd then echo then x=1 grep /usr/bin $(pwd)
+awk printf cd readonly -eu $(pwd)
+'quoted text' test && --verbose export /usr/bin
+| then done -eu echo $(pwd) then echo /usr/bin awk done echo awk echo then
+	export test printf test readonly then "$1" /usr/bin $(pwd)
+		'quoted text' x=1 $(pwd) done x=1 readonly
+	cd readonly && then /usr/bin && awk printf
+		readonly then /usr/bin $(pwd) $(pwd)
+--verbose ${HOME} --verbose -eu | local done printf --verbose awk $(pwd)
+		echo -eu printf "$@" local "$1" && grep done export --verbose cd
+		'quoted text' "$1" --verbose
+	then | grep grep | export echo -eu done "$@" 'quoted text' local
+		x=1 2>/dev/null test grep
+		| printf /usr/bin export awk test printf x=1
+${HOME} --verbose $(pwd) sed echo
+"$@" 'quoted text' | -eu local echo test
+'quoted text' local "$@" 2>/dev/null
+echo grep x=1 -eu awk $(pwd) 'quoted text'
+		$(pwd) 'quoted text'
+sed | $(pwd) x=1 sed done export
+sed then echo ${HOME} sed /usr/bin test sed echo local /usr/bin echo
+'quoted text' awk then -eu readonly 2>/dev/null /usr/bin
+		sed echo done 2>/dev/null
+		then "$1" sed && done echo export readonly grep echo && grep local 2>/dev/null
+		"$1" readonly "$@" sed awk | -eu
+local 2>/dev/null then grep local | --verbose | && 2>/dev/null
+then echo done | awk then grep local 2>/dev/null
+		readonly 2>/dev/null | && --verbose
+	"$@" then test sed "$1" ${HOME} sed --verbose x=1 sed "$@" "$@" 2>/dev/null
+	2>/dev/null then 2>/dev/null -eu sed cd done done x=1 readonly
+	/usr/bin readonly cd local | sed grep cd ${HOME}
+		printf "$1" 'quoted text' ${HOME} export
+		test x=1 done awk | | x=1 |
+local 2>/dev/null ${HOME}
+	"$1" export /usr/bin awk echo done export readonly
+	readonly echo readonly 2>/dev/null /usr/bin printf printf sed readonly
+echo && export printf | cd awk
+		x=1 done x=1 -eu echo export && $(pwd) export readonly done "$1"
+	grep -eu "$1" local "$@" cd "$@" cd
+cd 'quoted text' test 'quoted text' echo grep readonly done -eu /usr/bin
+		sed ${HOME} grep && awk then readonly awk "$@" 2>/dev/null awk then
+	/usr/bin cd | cd cd && printf sed 'quoted text' | cd && then local
+		readonly done test sed
+		x=1 printf sed export --verbose readonly 'quoted text' x=1 | awk --verbose
+		&& printf test printf $(pwd) /usr/bin -eu export $(pwd) 2>/dev/null 'quoted text'
+2>/dev/null ${HOME} | /usr/bin "$1" 'quoted text' "$1" awk readonly
+		sed 'quoted text' /usr/bin local && cd export $(pwd) "$1" --verbose then | awk
+	test echo grep then && 'quoted text' test test then
+echo "$@" echo readonly 2>/dev/null export 'quoted text' -eu
+		'quoted text' x=1 /usr/bin -eu "$@" x=1 local grep ${HOME} &&
+		-eu "$1" grep && grep echo
+	'quoted text' test -eu done cd "$@" -eu printf 'quoted text' | printf $(pwd)
+		echo | /usr/bin /usr/bin readonly "$@" readonly /usr/bin local sed && ${HOME}
+printf "$1" export x=1 printf awk 'quoted text' --verbose printf cd x=1 --verbose
+		echo "$1" echo 'quoted text'
+	| 2>/dev/null "$1" $(pwd)
+	cd --verbose done then | local cd x=1 --verbose printf $(pwd) test /usr/bin "$@"
+&& && cd test --verbose echo echo cd test -eu
+	${HOME} $(pwd) test 'quoted text'
+	/usr/bin && && printf grep 'quoted text' export sed echo readonly
+		local awk 2>/dev/null 2>/dev/null then awk export "$1" && "$1" /usr/bin
+		printf $(pwd) ${HOME}
+		local test readonly x=1 local done readonly done
+	${HOME} then export then local
+		export --verbose sed awk readonly
+	readonly awk local printf awk | sed printf x=1 $(pwd) local "$1"
+	grep readonly export local "$1" done && test
+		readonly awk ${HOME} 2>/dev/null done cd export cd test test $(pwd) "$@"
+		'quoted text' local ${HOME} x=1 test readonly --verbose 2>/dev/null
+	&& then -eu 'quoted text' awk "$@" ${HOME} --verbose "$1" cd local echo "$@" $(pwd)
+	/usr/bin --verbose 'quoted text' ${HOME} cd "$@" export
+		export grep sed printf test 'quoted text' readonly
+	"$@" ${HOME} done printf cd printf 'quoted text' $(pwd) &&
+	awk printf awk x=1 cd "$@" ${HOME}
+-eu printf test $(pwd) echo cd test export export echo local awk --verbose /usr/bin
+	x=1 'quoted text' printf cd printf "$1" 'quoted text' | then cd "$1"
+	test $(pwd) /usr/bin echo "$1" 'quoted text' | x=1 | -eu export
+	readonly | /usr/bin $(pwd) local awk grep done "$1" printf done 2>/dev/null
+		cd | "$1" then | && -eu --verbose && "$@" $(pwd)
+	export x=1 test test -eu /usr/bin cd then
+"$1" printf ${HOME} sed then cd 2>/dev/null
+	awk sed --verbose --verbose 'quoted text' printf test 'quoted text' | && test
+	'quoted text' export /usr/bin --verbose "$1" 'quoted text' 2>/dev/null
+done export sed then /usr/bin
+	sed | test --verbose test --verbose "$1" && -eu "$@" ${HOME} local
+		sed /usr/bin 2>/dev/null
+sed ${HOME} printf && x=1
+local cd 'quoted text' cd "$1" -eu
+		x=1 -eu test sed done /usr/bin x=1 echo
+x=1 "$1" | done echo "$@" printf test | echo 'quoted text' readonly done cd
+printf then export readonly cd "$@" printf local -eu -eu 'quoted text'
+"$@" && export -eu local export $(pwd)
+		${HOME} cd "$1" ${HOME} echo local && 'quoted text' export readonly export
+		cd cd sed done grep done awk 2>/dev/null /usr/bin cd sed "$1" $(pwd) | --verbose
+	sed then /usr/bin grep "$1" "$@" readonly awk grep readonly done test && test
+		$(pwd) sed test x=1 awk cd | readonly /usr/bin grep "$@" ${HOME}
+		awk export 2>/dev/null "$1" 2>/dev/null then cd printf cd
+	awk x=1 sed printf 'quoted text' --verbose cd export
+		-eu 'quoted text' $(pwd) ${HOME} | printf 'quoted text' "$1" $(pwd) x=1 then
+	| && awk | "$@" | grep /usr/bin grep
+		x=1 test --verbose $(pwd) test readonly test test | grep echo x=1 | x=1 cd
+	printf grep printf && 'quoted text'
+done cd echo echo | "$1" then awk
+/usr/bin cd done awk awk
+	echo --verbose echo done readonly ${HOME} readonly grep -eu ${HOME} -eu
+readonly awk test ${HOME} 'quoted text' echo /usr/bin echo "$1" | x=1 x=1
+		then sed sed ${HOME} cd 'quoted text' echo local -eu "$1" cd -eu
+--verbose x=1 /usr/bin grep "$@" readonly $(pwd) printf $(pwd)
+echo --verbose ${HOME} "$@" 2>/dev/null x=1
+		printf then cd local "$1" -eu "$1" $(pwd) && | x=1 && --verbose cd --verbose
+		export grep done $(pwd) 2>/dev/null --verbose $(pwd) 2>/dev/null
+		| $(pwd) cd test x=1 export cd done done -eu ${HOME} | ${HOME} && /usr/bin then
+		printf 'quoted text' ${HOME} done
+x=1 ${HOME} readonly "$@" export /usr/bin awk test echo grep "$1" cd sed
+	sed 'quoted text' -eu echo 'quoted text' 2>/dev/null awk "$1" export ${HOME}
+		export local done /usr/bin local readonly
+		echo cd export awk done readonly ${HOME} printf $(pwd) export "$@"
+	| /usr/bin --verbose readonly
+		'quoted text' "$1" grep /usr/bin -eu cd --verbose export printf
+		| test grep export sed -eu -eu x=1 -eu then --verbose
+	| | --verbose grep echo "$@" | $(pwd) cd test
+		-eu --verbose sed grep x=1 printf export readonly ${HOME} grep then /usr/bin
+	echo done awk | | export readonly then local
+	2>/dev/null "$@" /usr/bin x=1 cd "$1" local export readonly grep
+printf test local export "$1"
+		echo $(pwd) "$1" 'quoted text' awk sed done "$@" grep ${HOME} done && 2>/dev/null
+-eu 'quoted text' awk then done done test
+		echo test "$@" --verbose $(pwd) sed && /usr/bin
+	-eu export | -eu ${HOME} -eu done -eu test awk grep done sed done sed --verbose
+test export awk && awk x=1
+		${HOME} && done $(pwd) export sed /usr/bin
+		&& then ${HOME} x=1 | x=1 readonly | 2>/dev/null done $(pwd) && "$@" cd
+	'quoted text' local then sed test && "$@" sed "$@" 'quoted text' echo
+	--verbose cd cd /usr/bin x=1 awk $(pwd) echo cd test readonly x=1 $(pwd) awk
+	export done $(pwd) && awk printf done ${HOME} done
+"$1" --verbose sed then x=1 export then sed 2>/dev/null
+		x=1 -eu "$1" local local echo
+		sed /usr/bin then local /usr/bin --verbose
+sed && grep --verbose sed test
+$(pwd) then 'quoted text'
+		awk $(pwd) local printf readonly done 'quoted text' printf "$@" -eu done export
+	local then && echo local | 2>/dev/null sed grep done /usr/bin awk grep -eu
+		"$@" printf sed awk && then
+local "$1" 'quoted text' "$1" cd done done export "$1" test then --verbose
+$(pwd) "$1" echo readonly awk readonly export x=1 export ${HOME} printf awk &&
+--verbose 2>/dev/null printf ${HOME} grep && ${HOME} sed grep
+	'quoted text' 'quoted text'
+	readonly printf echo done | then test $(pwd) then
+	then "$@" ${HOME} -eu test
+	echo "$@" "$@" echo "$@" local "$1" -eu done 'quoted text' "$@" 'quoted text'
+		2>/dev/null $(pwd) ${HOME} readonly /usr/bin readonly done done
+x=1 grep | $(pwd) echo readonly --verbose grep
+echo done printf done x=1 test ${HOME} 2>/dev/null x=1 then
+"$1" $(pwd) readonly readonly
+"$@" 2>/dev/null cd | then -eu printf 'quoted text' "$1" export | cd
+		test $(pwd) /usr/bin $(pwd) export test printf export test --verbose
+	grep 2>/dev/null "$1" echo "$@" awk awk export
+export "$1" $(pwd) && && "$1" ${HOME} 2>/dev/null printf
+	export local then export local ${HOME} cd
+	awk "$1" 'quoted text' | then readonly $(pwd)
+		awk cd local done sed x=1
+	x=1 printf 'quoted text'
+2>/dev/null awk 2>/dev/null
+		cd "$@" sed then 2>/dev/null
+		-eu local export local printf --verbose grep local /usr/bin $(pwd) "$@" "$1"
+		echo sed -eu printf --verbose grep ${HOME} --verbose done
+		done ${HOME} printf then local "$1" x=1 /usr/bin ${HOME}
+/usr/bin | done -eu 2>/dev/null
+		readonly --verbose && 'quoted text' -eu x=1 local echo awk sed awk cd printf echo
+		/usr/bin awk && echo echo then ${HOME} ${HOME} "$@" grep grep
+	x=1 $(pwd) $(pwd) 'quoted text' "$1" done done
+printf printf done | sed
+		printf "$1" ${HOME} printf "$1" 'quoted text'
+	cd test /usr/bin -eu readonly | "$@" echo then $(pwd) awk
+grep --verbose printf local $(pwd) "$1" grep /usr/bin "$@" echo "$1" export
+2>/dev/null grep readonly ${HOME} ${HOME}
+		local $(pwd) local x=1 awk "$1" x=1 echo && printf cd /usr/bin
+	cd export x=1 local | done printf readonly cd export
+&& 'quoted text' grep then "$1" grep --verbose printf then
+"$1" /usr/bin 'quoted text'
+	2>/dev/null && awk --verbose sed export && $(pwd) "$1" local
+		'quoted text' done $(pwd) sed test $(pwd) ${HOME} printf echo /usr/bin
+	-eu test | -eu "$1" 2>/dev/null --verbose --verbose grep | "$@"
+	$(pwd) && x=1 && test -eu echo cd && --verbose
+${HOME} $(pwd) "$@" --verbose echo
+		then then awk 'quoted text' $(pwd) && printf cd then -eu | 'quoted text'
+then sed x=1 awk 2>/dev/null 2>/dev/null
+then export readonly 'quoted text'
+		2>/dev/null "$@" -eu 2>/dev/null ${HOME} export readonly
+		| printf /usr/bin | readonly done
+"$@" $(pwd) /usr/bin local local "$1" 2>/dev/null "$@" && |
+		local cd readonly then awk 2>/dev/null done export /usr/bin
+${HOME} --verbose -eu then /usr/bin cd "$1" 2>/dev/null done -eu local -eu done
+	sed then | grep ${HOME} export "$@" awk x=1 "$1" | awk cd
+cd ${HOME} test export printf local sed echo
+		--verbose $(pwd) | export done $(pwd) "$@" "$1" |
+done | | cd export /usr/bin "$1" x=1 then --verbose
+	grep readonly test ${HOME} $(pwd) test local echo
+	&& "$@" && export $(pwd) /usr/bin then
+		2>/dev/null awk awk echo -eu /usr/bin sed test cd -eu done
+		grep local 2>/dev/null --verbose
+-eu readonly echo export export $(pwd) test 2>/dev/null "$1" 'quoted text'
+	| ${HOME} /usr/bin then test 'quoted text'
+"$@" /usr/bin && cd awk &&
+	| sed sed printf x=1 grep /usr/bin
+readonly printf readonly "$@" "$1"
+	&& 'quoted text' 2>/dev/null
+	local && --verbose --verbose awk export grep then
+	export awk -eu awk test cd printf -eu grep sed 2>/dev/null
+	'quoted text' awk cd then sed --verbose
+	2>/dev/null -eu 'quoted text' export
+printf cd 2>/dev/null 'quoted text' x=1 awk sed echo
+	x=1 export awk "$1" ${HOME}
+export grep -eu done echo grep | local grep 2>/dev/null | done
+		export x=1 readonly echo
+then export test 2>/dev/null x=1
+	export awk readonly done
+	${HOME} "$1" grep export $(pwd) ${HOME} printf then
+		test grep --verbose $(pwd) export | --verbose test "$@" local "$1" ${HOME}
+		-eu awk awk cd readonly 2>/dev/null readonly export
+		done sed export x=1 done "$1" && 2>/dev/null done x=1 local
+${HOME} done then printf
+	"$@" $(pwd) readonly /usr/bin local
+readonly export -eu local grep then
+		grep && "$1" $(pwd) readonly --verbose readonly done awk awk local && "$1" x=1
+	cd export 2>/dev/null
+		grep cd echo printf export $(pwd) grep
+		&& awk --verbose then readonly readonly echo | /usr/bin
+	--verbose x=1 done | 2>/dev/null awk $(pwd) ${HOME} then awk
+		x=1 local $(pwd) | 'quoted text' local 'quoted text' grep then
+2>/dev/null 2>/dev/null sed 2>/dev/null 'quoted text'
+		-eu then echo -eu done --verbose --verbose 'quoted text' done echo
+	cd /usr/bin then 2>/dev/null $(pwd) "$1" "$1"
+		cd printf /usr/bin test /usr/bin
+test --verbose export awk sed && | then
+	$(pwd) -eu 'quoted text' "$1" export "$@" local /usr/bin
+		-eu readonly "$@" "$1" "$@" 'quoted text' done readonly
+"$@" awk 'quoted text' export local local test ${HOME}
+	'quoted text' $(pwd) | readonly test
+	printf && readonly then | export "$1" -eu x=1 cd local -eu then 2>/dev/null
+	done --verbose echo grep -eu export 'quoted text' | sed echo grep 'quoted text'
+	sed printf done "$@" 'quoted text'
+		"$1" x=1 readonly --verbose export
+	/usr/bin grep 2>/dev/null -eu /usr/bin local awk export done test
+	"$1" readonly /usr/bin && $(pwd) readonly cd "$@" x=1
+		&& cd grep && test 2>/dev/null awk
+		readonly awk $(pwd) ${HOME} echo
+		sed /usr/bin echo export | sed | $(pwd) awk 'quoted text' 2>/dev/null
+$(pwd) && printf && then 2>/dev/null && echo done done sed export
+x=1 x=1 printf printf 'quoted text'
+		local | export "$@" sed export $(pwd)
+		echo grep grep cd x=1 test && && grep done grep && test cd awk test
+	sed export ${HOME} -eu readonly
+		test | sed printf export export && 2>/dev/null local
+		awk && | test $(pwd) --verbose then
+-eu then | | && local grep readonly test 2>/dev/null
+export ${HOME} sed x=1 cd sed ${HOME} then ${HOME} | /usr/bin sed 'quoted text'
+	then echo export cd echo readonly && "$@" then "$1" x=1 export
+		awk done /usr/bin sed cd printf done export echo
+--verbose export $(pwd) printf $(pwd) printf echo local |
+--verbose $(pwd) test sed
+	then | cd -eu done sed test -eu 'quoted text' 'quoted text' done |
+--verbose /usr/bin 'quoted text' 'quoted text' export && 2>/dev/null
+		&& test sed 'quoted text' cd local -eu /usr/bin done 2>/dev/null 2>/dev/null
+"$@" grep "$1" then x=1 | -eu
+| readonly $(pwd) /usr/bin export awk -eu "$1" sed "$@" ${HOME} "$1" 'quoted text'
+test echo printf -eu "$1" 2>/dev/null cd "$1" export "$1" local && grep local
+| awk -eu echo | export then cd $(pwd) "$@"
+		&& && readonly grep && awk x=1 --verbose
+		test x=1 ${HOME} grep printf printf -eu export --verbose done --verbose
+		awk ${HOME} "$@" local -eu "$@" $(pwd) /usr/bin echo 2>/dev/null --verbose
+	done "$1" then echo $(pwd) sed | grep x=1 sed "$1" test printf
+		| --verbose awk -eu readonly 'quoted text' -eu cd $(pwd)
+		printf /usr/bin x=1 && --verbose --verbose "$@" -eu
+		readonly cd then "$@" test printf x=1 then --verbose then 'quoted text' /usr/bin
+	-eu sed printf --verbose | done sed sed x=1 export 2>/dev/null && "$1"
+	$(pwd) --verbose | export
+"$1" 2>/dev/null --verbose done --verbose
+		readonly -eu ${HOME} awk echo test export &&
+		sed then x=1 export /usr/bin cd then awk test --verbose
+		awk x=1 ${HOME} then printf | export
+		printf && echo ${HOME} /usr/bin echo /usr/bin "$@" done grep /usr/bin --verbose
+	sed $(pwd) readonly readonly && test /usr/bin 'quoted text' export readonly readonly
+		grep test "$1" printf "$@" test readonly then /usr/bin $(pwd) local
+	done "$@" grep --verbose --verbose cd readonly readonly printf -eu
+'quoted text' printf test grep /usr/bin
+	printf x=1 | then printf ${HOME} | "$@" && test "$@" "$1" /usr/bin readonly ${HOME}
+		"$1" cd 'quoted text' done readonly grep grep 'quoted text' test 'quoted text'
+echo $(pwd) -eu --verbose cd sed /usr/bin && export done readonly readonly 'quoted text'
+		test grep readonly test grep awk sed -eu ${HOME} ${HOME}
+	| && --verbose /usr/bin x=1 && local
+		x=1 awk export ${HOME} then 'quoted text' echo -eu test grep test --verbose
+		sed grep local 2>/dev/null printf awk && echo local 'quoted text'
+	sed grep cd x=1 sed awk echo $(pwd) awk /usr/bin
+		-eu test readonly -eu ${HOME} sed x=1 /usr/bin
+--verbose -eu "$1" | cd export /usr/bin "$1" x=1 done readonly /usr/bin
+		sed printf --verbose cd $(pwd) | cd sed then $(pwd) cd ${HOME}
+$(pwd) printf export sed && grep cd -eu then "$@" 2>/dev/null | &&
+		2>/dev/null printf -eu ${HOME} 2>/dev/null | test echo printf | /usr/bin echo
+		x=1 awk test --verbose "$@" /usr/bin local $(pwd) ${HOME}
+	awk "$1" awk echo local -eu echo done readonly --verbose x=1
+	2>/dev/null 2>/dev/null "$@" --verbose printf test ${HOME} echo echo
+local /usr/bin done cd "$@" ${HOME} -eu readonly local cd ${HOME}
+	'quoted text' "$1" "$1" "$@" $(pwd) test 2>/dev/null test awk | x=1
+	local awk done ${HOME} ${HOME}
+	then readonly "$1" -eu --verbose $(pwd) then done then grep "$1" $(pwd) cd
+		echo cd then 'quoted text' then | /usr/bin printf 2>/dev/null local
+	readonly 2>/dev/null then 2>/dev/null x=1 then done cd printf
+	x=1 /usr/bin export x=1 local grep -eu /usr/bin done 2>/dev/null then /usr/bin
+2>/dev/null done 2>/dev/null /usr/bin readonly test printf "$1" readonly
+-eu printf --verbose cd done cd x=1 "$1" "$1" "$@" then --verbose
+		"$1" local cd "$1" awk 'quoted text'
+		readonly echo /usr/bin 2>/dev/null 'quoted text' local --verbose
+		"$1" sed /usr/bin echo sed "$1"
+	awk cd test -eu done local export echo test --verbose readonly printf readonly
+	echo && local then printf sed local
+	/usr/bin ${HOME} 'quoted text' local "$1" grep x=1 'quoted text' cd "$1"
+test "$@" readonly awk sed | export test local export grep ${HOME} printf -eu |
+		grep ${HOME} -eu && test local done && ${HOME}
+		readonly echo done then 'quoted text'
+	awk && 2>/dev/null export
+&& ${HOME} cd /usr/bin 'quoted text' --verbose sed local cd
+		grep grep export "$@" 'quoted text'
+test printf | test x=1 export -eu --verbose printf
+readonly | -eu readonly --verbose x=1 then
+	local then --verbose 2>/dev/null export
+"$@" then x=1 printf printf
+		-eu awk grep cd 2>/dev/null 2>/dev/null x=1 $(pwd) -eu awk done
+		&& x=1 x=1 readonly test | ${HOME} grep 'quoted text'
+	${HOME} 'quoted text' echo
+		then /usr/bin 2>/dev/null 2>/dev/null
+-eu awk $(pwd) then $(pwd) ${HOME} done && x=1 cd && cd
+done sed cd export --verbose x=1 /usr/bin 'quoted text' ${HOME} awk
+	echo printf ${HOME} readonly --verbose $(pwd) sed
+	done grep $(pwd) $(pwd) awk x=1 -eu x=1 'quoted text'
+		sed awk readonly sed cd -eu "$1" 'quoted text'
+$(pwd) test export grep then 2>/dev/null readonly
+		'quoted text' /usr/bin printf "$1" cd "$1" $(pwd)
+	awk printf ${HOME} done 'quoted text' export local export "$@" ${HOME}
+		test sed | export "$1" ${HOME} awk /usr/bin $(pwd) 2>/dev/null
+	done done then export "$1" sed test
+'quoted text' --verbose x=1 cd done | -eu done grep $(pwd) --verbose 'quoted text'
+export cd cd echo cd sed sed $(pwd) printf
+done "$1" grep grep cd | ${HOME} export echo x=1 "$1" | readonly x=1 $(pwd) /usr/bin
+		&& 2>/dev/null && x=1 readonly export cd -eu grep 2>/dev/null $(pwd) /usr/bin
+export echo readonly awk test then printf 'quoted text' ${HOME}
+cd readonly | | readonly done $(pwd) export readonly -eu x=1 | export test
+$(pwd) test local printf echo export ${HOME}
+2>/dev/null ${HOME} cd ${HOME} readonly 2>/dev/null ${HOME} && grep
+	| grep readonly grep printf awk
+		cd echo /usr/bin sed
+	-eu ${HOME} echo echo printf | local echo export test echo $(pwd) then
+	cd printf "$1" | local local local printf x=1
+		'quoted text' /usr/bin | && /usr/bin | /usr/bin grep awk 2>/dev/null
+		sed -eu --verbose awk awk 2>/dev/null x=1 && 'quoted text' printf |
+	--verbose sed $(pwd) printf test
+	${HOME} x=1 echo 2>/dev/null cd x=1 local -eu 2>/dev/null echo 'quoted text'
+		awk --verbose "$@" readonly test -eu /usr/bin local local then --verbose
+		grep done local $(pwd) x=1 echo
+		echo printf export awk printf printf -eu -eu local "$@" $(pwd) ${HOME}
+'quoted text' export then grep then grep
+	2>/dev/null grep then | &&
+x=1 test export printf cd test 2>/dev/null
+		echo /usr/bin cd 2>/dev/null ${HOME} /usr/bin
+/usr/bin 'quoted text' ${HOME} awk local /usr/bin -eu then ${HOME} ${HOME}
+then echo --verbose /usr/bin 'quoted text' /usr/bin
+readonly $(pwd) "$@" then test
+"$1" /usr/bin /usr/bin export --verbose local &&
+	x=1 then echo && $(pwd) | sed grep
+	$(pwd) awk "$1" cd 'quoted text' sed awk export
+		printf $(pwd) echo grep then --verbose -eu x=1 | cd | $(pwd) 'quoted text'
+		grep 2>/dev/null 'quoted text' readonly sed done $(pwd) test printf --verbose
+readonly done printf x=1 done
+done done readonly local sed grep printf "$1"
+export readonly then then 2>/dev/null test sed echo 2>/dev/null $(pwd)
+	-eu cd x=1 readonly /usr/bin
+	-eu done then grep sed
+	readonly "$@" x=1 readonly "$@" test /usr/bin
+sed "$1" export --verbose $(pwd) $(pwd) && ${HOME} printf
+		test --verbose "$@" $(pwd) export readonly $(pwd) --verbose
+		-eu ${HOME} cd "$@" ${HOME}
+		cd then 'quoted text' -eu x=1 printf sed
+		&& done "$@" cd "$1" ${HOME} "$1" && done grep | grep then
+echo 2>/dev/null cd awk "$1" ${HOME}
+	then | "$1" | 'quoted text' x=1 sed sed cd x=1 then
+export --verbose --verbose --verbose local /usr/bin then
+	then --verbose done export
+		"$@" $(pwd) ${HOME} export
+	export cd | x=1 export
+	test awk | export cd test echo cd test --verbose echo ${HOME}
+		sed grep x=1 printf 'quoted text'
+		echo echo readonly | grep 'quoted text' "$1" cd --verbose done "$@" grep ${HOME}
+grep "$1" export cd readonly 2>/dev/null 2>/dev/null | -eu -eu
+	2>/dev/null | export "$@" echo local --verbose --verbose
+'quoted text' "$@" local /usr/bin
+		2>/dev/null test $(pwd) done awk
+	2>/dev/null grep x=1 'quoted text' readonly | local done --verbose awk
+		$(pwd) grep local | readonly readonly -eu cd --verbose -eu local grep | $(pwd)
+--verbose | sed grep ${HOME} ${HOME} ${HOME} 'quoted text' -eu test
+	2>/dev/null ${HOME} sed 'quoted text'
+	sed x=1 ${HOME} printf done
+| local ${HOME} test grep
+		done done echo local grep -eu ${HOME} then x=1 then "$@" test sed export 2>/dev/null
+	test "$1" 2>/dev/null sed --verbose $(pwd) "$@" -eu readonly
+	sed -eu cd cd ${HOME} export
+then "$1" $(pwd) --verbose -eu 2>/dev/null
+/usr/bin && grep awk grep echo cd | x=1 echo cd | x=1 readonly sed awk "$1"
+readonly && /usr/bin | -eu | 'quoted text' printf "$1"
+		echo local "$@" /usr/bin grep ${HOME} then | 2>/dev/null awk -eu --verbose
+sed --verbose -eu -eu -eu echo echo sed grep cd && && test grep cd /usr/bin cd
+2>/dev/null readonly $(pwd) ${HOME} 'quoted text' && "$@" done
+	"$1" readonly 'quoted text' printf 2>/dev/null printf done "$@" "$1" /usr/bin "$1"
+		awk then | ${HOME} 'quoted text' 2>/dev/null export /usr/bin && test
+grep grep local "$@" && sed --verbose
+		then cd test readonly /usr/bin 2>/dev/null 'quoted text'
+	grep awk export done && "$1" readonly
+		x=1 | local grep 'quoted text' 'quoted text' printf --verbose
+2>/dev/null grep grep printf --verbose sed /usr/bin
+		x=1 ${HOME} 'quoted text' local grep "$1" 'quoted text'
+	${HOME} test local "$1" 2>/dev/null printf test grep
+		cd --verbose local ${HOME} printf | export grep /usr/bin | "$1" /usr/bin cd
+test 2>/dev/null readonly grep grep -eu 2>/dev/null
+		grep x=1 done sed cd /usr/bin readonly $(pwd) grep then -eu /usr/bin awk
+	2>/dev/null echo --verbose x=1 test cd ${HOME} then done
+grep "$@" "$@" 2>/dev/null grep 2>/dev/null 2>/dev/null
+	2>/dev/null x=1 'quoted text' echo $(pwd) local && grep grep "$@" local export "$1"
+	then then echo x=1 x=1 -eu 'quoted text' export
+		&& cd readonly export awk ${HOME} done
+		${HOME} "$@" 'quoted text' export sed x=1 grep "$1" then printf 2>/dev/null &&
+		then && /usr/bin printf "$@" printf 2>/dev/null awk export printf
+local cd readonly && local echo x=1 && "$@" 'quoted text'
+	-eu "$@" echo $(pwd) cd grep sed echo sed echo -eu cd -eu | $(pwd)
+		${HOME} done 2>/dev/null echo grep cd && 2>/dev/null
+	done printf echo done -eu done
+local export export $(pwd) readonly x=1 $(pwd) --verbose grep --verbose
+	"$1" done "$1" 'quoted text' -eu --verbose
+'quoted text' export awk local then /usr/bin
+		'quoted text' -eu 'quoted text' x=1
+	printf awk x=1 sed echo export /usr/bin x=1
+	'quoted text' awk ${HOME} 'quoted text' /usr/bin then 2>/dev/null -eu "$1" readonly
+	2>/dev/null cd done test echo 'quoted text'
+2>/dev/null --verbose test ${HOME} 2>/dev/null $(pwd)
+export printf "$1" export | "$1" cd "$1" 'quoted text' x=1 sed test && $(pwd)
+	readonly /usr/bin ${HOME} && 2>/dev/null
+		'quoted text' 'quoted text' grep echo 2>/dev/null
+x=1 cd export $(pwd) export 2>/dev/null && awk export
+then local readonly "$@" printf 2>/dev/null then export $(pwd)
+$(pwd) -eu 2>/dev/null 2>/dev/null 2>/dev/null export /usr/bin local
+		'quoted text' /usr/bin done "$@" cd local done | /usr/bin
+		grep -eu 2>/dev/null -eu done cd then
+"$1" awk && local 2>/dev/null
+	sed x=1 printf 'quoted text' done then echo done cd export
+done | "$1" -eu sed grep grep
+x=1 ${HOME} $(pwd) awk then readonly
+readonly export "$@" "$1" test 2>/dev/null && "$@" printf readonly
+	$(pwd) "$@" awk 'quoted text' awk cd readonly done "$1" test && awk export local
+	test -eu local done "$@" cd 2>/dev/null /usr/bin
+		done printf | --verbose grep sed | x=1 sed then local --verbose
+		/usr/bin "$@" ${HOME} cd | $(pwd) --verbose /usr/bin
+		"$@" done --verbose cd 'quoted text' "$@" echo local "$@" export
+sed test printf --verbose grep --verbose printf "$@" ${HOME} echo awk | export
+		readonly then $(pwd) $(pwd) /usr/bin "$1" x=1 && cd awk | -eu sed /usr/bin sed
+		test "$1" 2>/dev/null printf printf && test
+| test then 'quoted text'
+		-eu && cd /usr/bin 2>/dev/null
+	| export awk --verbose $(pwd) printf sed export sed done
+test echo --verbose 'quoted text'
+cd --verbose x=1 sed "$@"
+		local --verbose grep grep "$1" sed done awk
+	cd | 2>/dev/null printf sed --verbose $(pwd) | export --verbose
+x=1 --verbose x=1 grep
+		grep export local export echo /usr/bin export
+'quoted text' "$@" test test 'quoted text' printf export | done
+		| cd && x=1 ${HOME} cd done "$1"
+2>/dev/null grep && printf ${HOME} 2>/dev/null grep -eu printf "$1" echo
+2>/dev/null sed then sed echo local "$@" "$1" --verbose
+readonly printf ${HOME} | awk "$@" awk export 2>/dev/null
+	x=1 sed local printf cd 'quoted text'
+${HOME} test | local sed /usr/bin export
+--verbose --verbose printf
+	echo cd "$1" sed 2>/dev/null
+		2>/dev/null sed printf grep cd
+	/usr/bin "$@" /usr/bin "$1" $(pwd) -eu "$1" local awk | done sed grep done
+		grep done "$@" -eu /usr/bin awk cd grep --verbose | grep x=1 export
+$(pwd) echo local | cd done 2>/dev/null
+"$@" export export -eu export grep sed | cd 'quoted text' readonly && /usr/bin
+"$@" "$1" 2>/dev/null $(pwd) awk
+	grep readonly -eu -eu --verbose && x=1 cd export echo grep /usr/bin
+		grep "$@" --verbose grep --verbose
+		export readonly readonly grep export --verbose | printf
+	-eu readonly "$1" 2>/dev/null readonly echo
+	export echo export awk
+grep done sed grep printf printf
+		| done x=1 export "$1" printf local /usr/bin -eu "$1" sed
+$(pwd) cd awk then echo /usr/bin /usr/bin echo
+		"$@" -eu -eu && x=1 sed
+		/usr/bin test printf test "$@" grep | /usr/bin /usr/bin
+		grep && $(pwd) printf sed printf --verbose x=1 && x=1 grep
+then printf -eu /usr/bin 2>/dev/null
+	awk cd | 'quoted text' "$1" printf
+	/usr/bin x=1 --verbose
+		test 2>/dev/null export
+		cd 'quoted text' done "$1" "$1" "$1" export
+	awk echo 'quoted text' 'quoted text' --verbose
+		sed then "$@" && echo -eu 'quoted text' readonly then sed ${HOME}
+	local done 'quoted text' cd | && &&
+$(pwd) 'quoted text' echo then
+		cd && done -eu sed export grep done printf "$1" -eu readonly
+| awk --verbose echo test export echo $(pwd) | $(pwd)
+	-eu -eu "$1" grep 'quoted text' "$1" ${HOME} test local sed x=1 | cd
+		"$@" readonly printf echo && 2>/dev/null done "$1" "$1" done
+		grep "$@" $(pwd) -eu awk test -eu -eu /usr/bin /usr/bin ${HOME}
+	grep 'quoted text' -eu ${HOME} $(pwd) cd cd grep readonly "$1" cd grep "$@"
+		| local awk sed echo readonly x=1 awk then && x=1 export && x=1 -eu 'quoted text'
+--verbose sed readonly ${HOME}
+then ${HOME} grep "$@" grep $(pwd) local x=1 printf export 'quoted text'
+	echo x=1 ${HOME} 2>/dev/null $(pwd) sed sed local export && && test then 'quoted text'
+	local then export /usr/bin
+${HOME} $(pwd) then printf sed --verbose
+		test local export readonly x=1 grep 2>/dev/null | test local
+	"$1" --verbose local readonly grep 'quoted text'
+		grep ${HOME} 2>/dev/null readonly export grep printf
+readonly -eu 2>/dev/null awk echo then test
+	awk "$1" then -eu "$1" | x=1 ${HOME} "$@" "$@" export x=1 "$1" 'quoted text'
+	| /usr/bin export readonly /usr/bin | x=1 && echo 2>/dev/null
+awk readonly /usr/bin "$1" --verbose -eu /usr/bin &&
+	"$@" && /usr/bin $(pwd)
+	cd then "$1" "$@" then ${HOME} cd 2>/dev/null awk
+$(pwd) test awk "$@" /usr/bin | x=1 grep "$1" --verbose
+		grep grep done | x=1 x=1 | && grep readonly "$1" export
+"$1" && && 2>/dev/null local export printf && "$@" /usr/bin x=1 readonly
+		'quoted text' "$@" 2>/dev/null grep ${HOME} cd "$1" /usr/bin
+		2>/dev/null && awk test done local
+		| cd | echo readonly local | x=1 "$1" ${HOME} 'quoted text' "$1" test x=1 ${HOME}
+--verbose echo local 2>/dev/null "$1" test
+-eu then export 'quoted text' 'quoted text' | $(pwd) --verbose
+grep "$1" awk export echo printf && 2>/dev/null -eu --verbose
+awk "$@" "$@" /usr/bin x=1 | 2>/dev/null
+	grep awk 'quoted text' done 2>/dev/null then grep
+		grep /usr/bin 'quoted text' printf local echo export sed 2>/dev/null /usr/bin
+	2>/dev/null x=1 /usr/bin 2>/dev/null &&
+	readonly ${HOME} awk done 2>/dev/null done
+"$@" sed done grep sed && then x=1 ${HOME} --verbose
+		awk ${HOME} echo cd "$1" && "$1" 'quoted text' echo
+	x=1 | $(pwd) printf readonly | done -eu "$@" --verbose sed awk /usr/bin --verbose
+		-eu "$@" | printf grep printf $(pwd) test 2>/dev/null "$1" export
+		cd "$@" ${HOME} 2>/dev/null "$@" test test local readonly
+sed $(pwd) "$@" 2>/dev/null 2>/dev/null
+	-eu then 'quoted text' printf
+	done ${HOME} | | echo
+	echo done && $(pwd) /usr/bin echo printf x=1 grep
+		local x=1 && ${HOME} "$@" printf $(pwd) -eu --verbose awk cd --verbose $(pwd)
+		x=1 | grep then cd awk 2>/dev/null sed done
+	${HOME} -eu $(pwd) "$@" $(pwd)
+	$(pwd) -eu grep echo test && /usr/bin ${HOME} && local grep echo
+		x=1 test x=1 test export printf printf $(pwd) --verbose --verbose
+cd && 2>/dev/null x=1 then
+then grep local "$1" then ${HOME}
+	echo 'quoted text' awk 2>/dev/null grep cd sed cd $(pwd) done grep /usr/bin
+		printf readonly test test ${HOME} $(pwd) /usr/bin
+	${HOME} --verbose && && readonly echo
+	2>/dev/null /usr/bin && x=1 "$1" readonly sed echo export done "$1" -eu
+then 'quoted text' export done readonly 2>/dev/null sed test x=1 printf local
+x=1 $(pwd) 2>/dev/null ${HOME}
+	/usr/bin -eu sed 'quoted text' | /usr/bin local "$@" -eu /usr/bin done printf
+		/usr/bin /usr/bin | local export 'quoted text' ${HOME} local done
+		printf -eu cd test 'quoted text'
+done sed done 'quoted text' test grep local then export printf awk
+	&& && cd | local -eu cd -eu local readonly
+		printf "$@" printf "$1" awk done cd --verbose ${HOME} printf
+	local x=1 'quoted text' local sed awk 2>/dev/null cd printf
+readonly done export then $(pwd) | cd x=1 done export $(pwd) local
+		/usr/bin done printf -eu local done
+awk printf done export ${HOME}
+export then done ${HOME} printf test -eu ${HOME} grep echo echo
+	sed done sed ${HOME} then $(pwd) awk done
+		${HOME} export 2>/dev/null test sed printf "$1" export --verbose
+	${HOME} readonly cd 2>/dev/null
+		x=1 x=1 /usr/bin printf sed cd "$@" /usr/bin 'quoted text'
+		cd 2>/dev/null "$@" "$@" ${HOME} ${HOME} cd awk "$1" awk sed grep 2>/dev/null
+		-eu && local --verbose $(pwd) cd local x=1 ${HOME} awk
+	"$1" readonly done ${HOME} $(pwd) && printf echo -eu ${HOME}
+	&& "$1" && grep export then local ${HOME} test cd &&
+		printf x=1 | "$1" 'quoted text' then $(pwd)
+		echo 2>/dev/null awk --verbose 'quoted text' readonly --verbose then
+		${HOME} export sed $(pwd) x=1 && /usr/bin x=1 local x=1 "$@" --verbose echo
+		$(pwd) -eu local test "$1" grep && $(pwd) test
+	/usr/bin | local $(pwd) --verbose
+sed cd --verbose /usr/bin $(pwd) echo ${HOME} /usr/bin && $(pwd)
+	"$@" grep -eu --verbose
+	printf cd --verbose cd 2>/dev/null
+		/usr/bin export | /usr/bin awk "$@" done sed --verbose
+		echo cd echo test ${HOME} "$1" cd sed x=1 "$@"
+	/usr/bin ${HOME} -eu | sed test 2>/dev/null
+		done local test awk && "$@" then then 2>/dev/null
+	sed readonly --verbose local then
+	done test printf then "$@" echo export grep readonly test done /usr/bin
+	"$1" echo 'quoted text' cd
+then local readonly local local printf done then export
+	${HOME} sed 2>/dev/null done 2>/dev/null test $(pwd) -eu --verbose
+		sed done awk 'quoted text' -eu x=1 test export 'quoted text' | export test
+done && 2>/dev/null ${HOME} "$1" echo /usr/bin
+	'quoted text' export x=1 && export done echo echo -eu printf "$1" export
+--verbose echo && $(pwd) "$1" --verbose cd test x=1 ${HOME}
+${HOME} sed 2>/dev/null local x=1 2>/dev/null && done local export
+test 'quoted text' printf $(pwd) 'quoted text' && -eu export
+		done "$@" done /usr/bin local test local x=1 sed awk done printf local
+		export sed cd --verbose then --verbose local done $(pwd)
+grep readonly readonly grep ${HOME} && $(pwd) test readonly -eu then awk "$@"
+| && grep ${HOME} readonly
+/usr/bin 2>/dev/null x=1 readonly
+		export export 'quoted text' grep awk then done
+		/usr/bin printf done "$1" sed "$@" "$@" ${HOME} test "$@" --verbose
+printf echo /usr/bin -eu | awk grep --verbose /usr/bin
+-eu && printf "$1" cd export echo readonly sed echo 2>/dev/null $(pwd)
+		then then $(pwd) 2>/dev/null /usr/bin local 'quoted text' ${HOME} x=1 printf
+		-eu && local | ${HOME} x=1 done grep && $(pwd) ${HOME}
+	local "$1" /usr/bin | sed "$1" "$@" && 2>/dev/null
+	$(pwd) readonly then -eu readonly /usr/bin printf | -eu 2>/dev/null
+	sed /usr/bin grep "$1" -eu export -eu && printf -eu | cd $(pwd) cd x=1 2>/dev/null
+		grep 'quoted text' echo "$@" test test readonly | x=1 export | readonly
+export ${HOME} --verbose grep "$@" ${HOME} --verbose awk
+-eu -eu $(pwd) /usr/bin awk 'quoted text' ${HOME} sed awk
+		cd -eu then export cd ${HOME}
+| local export | sed --verbose readonly grep 'quoted text' echo printf
+readonly 2>/dev/null 'quoted text'
+		2>/dev/null awk sed then | | test /usr/bin
+		local /usr/bin sed "$1" test "$1" echo done printf echo
+	2>/dev/null export grep /usr/bin ${HOME} 2>/dev/null 2>/dev/null $(pwd) grep
+	&& | "$@" printf readonly export
+		| ${HOME} test | export
+2>/dev/null /usr/bin 'quoted text' done /usr/bin readonly
+&& echo "$@" -eu -eu local grep -eu readonly export awk ${HOME} ${HOME} | sed
+local echo 'quoted text'
+		$(pwd) test awk readonly $(pwd) awk
+		"$1" awk "$1" /usr/bin
+	'quoted text' x=1 "$@" test local 'quoted text'
+		then 'quoted text' local done x=1 cd cd ${HOME} 'quoted text' then && awk
+	done done awk done printf export x=1 $(pwd) -eu grep --verbose test grep 2>/dev/null
+"$@" "$@" printf local done local local --verbose
+		--verbose export cd cd
+		$(pwd) awk done test export echo /usr/bin printf
+$(pwd) readonly cd awk | && -eu && 'quoted text' -eu cd
+	cd then then readonly "$@" grep 2>/dev/null 'quoted text'
+		| printf --verbose /usr/bin done --verbose
+	printf "$@" --verbose | "$1" local 2>/dev/null test /usr/bin echo grep test 2>/dev/null
+	done awk echo -eu /usr/bin x=1 'quoted text' 'quoted text'
+		then $(pwd) 2>/dev/null echo |
+test 'quoted text' && ${HOME} cd "$@"
+	done cd cd export echo 'quoted text' "$1" "$@" "$1"
+	$(pwd) local "$@" printf && then then 2>/dev/null export readonly
+local --verbose --verbose sed then export grep x=1
+		then "$@" cd x=1 then 'quoted text'
+	x=1 ${HOME} x=1 local echo
+		2>/dev/null /usr/bin 2>/dev/null test cd 'quoted text' | printf printf
+	/usr/bin echo | then &&
+readonly test /usr/bin --verbose grep echo done
+-eu ${HOME} sed then sed printf 2>/dev/null
+	cd $(pwd) done ${HOME} grep echo "$@" x=1 'quoted text' export
+	sed "$1" "$1" echo "$1" local "$1" 'quoted text'
+		sed -eu --verbose then "$@" cd test 'quoted text' --verbose "$1"
+/usr/bin cd && printf test 'quoted text'
+		echo "$@" done cd test grep awk
+		'quoted text' then --verbose
+	echo 'quoted text' --verbose -eu then printf x=1 sed $(pwd)
+then "$@" 2>/dev/null -eu echo done printf 2>/dev/null "$@" x=1 export x=1
+$(pwd) ${HOME} then grep local echo done sed then then
+		x=1 $(pwd) grep cd "$@" --verbose then echo
+	"$@" $(pwd) export export echo 2>/dev/null 'quoted text'
+local && sed done local ${HOME} 'quoted text' done
+x=1 then 2>/dev/null 'quoted text' done
+		readonly echo && 2>/dev/null $(pwd) cd x=1 "$@" "$1" -eu
+export /usr/bin | $(pwd) "$1" test printf test cd 2>/dev/null
+		--verbose readonly -eu cd done
+	x=1 sed 'quoted text' && awk awk $(pwd)
+	export then /usr/bin printf 2>/dev/null
+		local 'quoted text' sed awk printf printf -eu printf test then then $(pwd)
+	$(pwd) | printf export -eu $(pwd) $(pwd) x=1
+	done export export done -eu local cd && $(pwd) -eu --verbose
+	${HOME} && sed printf 'quoted text' --verbose && awk | && export | 2>/dev/null $(pwd)
+	-eu 'quoted text' done echo export
+		cd printf "$@" && "$1" sed -eu sed sed --verbose ${HOME} x=1 readonly
+	done && ${HOME} ${HOME} sed grep "$@" export printf local grep /usr/bin
+	'quoted text' x=1 then then printf test sed | | awk
+--verbose ${HOME} awk ${HOME} cd grep /usr/bin -eu sed printf "$@" $(pwd) grep ${HOME}
+		"$1" local x=1 then test && cd readonly
+-eu && sed local && export "$1" ${HOME} 'quoted text' echo x=1 "$@" &&
+	${HOME} export $(pwd) && | printf cd readonly readonly test && cd 2>/dev/null
+		local readonly "$@" && x=1 'quoted text'
+done awk $(pwd) sed 2>/dev/null awk
+	/usr/bin "$1" ${HOME} awk cd --verbose |
+	cd export -eu | printf echo ${HOME} --verbose "$1" -eu
+		&& && 2>/dev/null cd /usr/bin
+		'quoted text' /usr/bin sed local export --verbose && sed ${HOME}
+	2>/dev/null ${HOME} 'quoted text' sed cd test then x=1 sed
+	x=1 -eu -eu x=1 "$1" 2>/dev/null
+	grep local && 2>/dev/null then
+test printf ${HOME} | awk /usr/bin "$@" sed awk --verbose "$@" x=1 -eu --verbose
+		awk $(pwd) readonly grep cd local
+	cd grep "$1" test ${HOME} /usr/bin ${HOME} printf --verbose -eu 'quoted text'
+2>/dev/null && awk 'quoted text' echo
+"$@" awk sed $(pwd) "$1" awk 'quoted text' && done then /usr/bin awk
+		cd "$1" ${HOME} test -eu -eu /usr/bin | echo grep then grep export "$1" cd
+	export $(pwd) $(pwd) cd test | cd sed && ${HOME} printf /usr/bin
+		export local "$1" 'quoted text' -eu printf
+	grep 'quoted text' readonly grep "$1" readonly $(pwd) readonly local
+	test echo "$1" test printf && echo export sed sed local
+echo printf /usr/bin ${HOME} /usr/bin export 2>/dev/null
+	"$1" --verbose sed local echo done cd && sed
+sed 2>/dev/null && x=1 "$1"
+	done done 2>/dev/null | grep
+echo local | | grep $(pwd) export cd 'quoted text' "$@" 2>/dev/null | test
+	2>/dev/null then && --verbose
+${HOME} export awk 2>/dev/null echo "$1" then | echo | ${HOME} -eu export
+		printf && "$1" grep sed printf $(pwd) printf sed printf
+printf local --verbose $(pwd) then | then &&
+		test x=1 'quoted text' local awk done
+		&& sed awk cd echo 2>/dev/null printf "$@" sed then /usr/bin | -eu awk
+		"$1" --verbose then echo /usr/bin "$1" printf awk
+--verbose -eu $(pwd) cd sed ${HOME} -eu printf cd done echo grep | cd
+sed $(pwd) --verbose echo 2>/dev/null readonly
+readonly "$1" $(pwd) sed grep 2>/dev/null sed cd readonly
+		local --verbose /usr/bin printf export "$@" -eu
+	| -eu "$@" export grep && 'quoted text' cd local awk ${HOME} export sed sed sed
+	awk export ${HOME} done cd 2>/dev/null
+	done x=1 ${HOME} export sed cd export cd
+		'quoted text' "$@" test export awk /usr/bin test $(pwd)
+	done cd then awk --verbose -eu export export 'quoted text' -eu readonly
+		| printf local && grep 'quoted text' 'quoted text' 2>/dev/null --verbose
+$(pwd) 2>/dev/null "$@" "$@" export cd cd export x=1 export grep
+	2>/dev/null echo 'quoted text' "$@" ${HOME} x=1
+		-eu grep done ${HOME} -eu x=1 printf awk x=1 export done ${HOME} echo /usr/bin
+	export awk 2>/dev/null /usr/bin --verbose
+$(pwd) "$1" export local x=1 local | 2>/dev/null $(pwd)
+	'quoted text' export x=1 awk cd "$1" | 'quoted text' && 'quoted text'
+then awk done cd sed | grep local printf 'quoted text' 'quoted text' && cd
+	export then readonly "$1" local 2>/dev/null x=1 --verbose | test "$@" | then 'quoted text'
+$(pwd) printf grep -eu awk -eu local done ${HOME} && $(pwd) --verbose | $(pwd)
+2>/dev/null then sed && "$1" 2>/dev/null test
+		2>/dev/null then awk done -eu awk echo --verbose cd sed echo 2>/dev/null 2>/dev/null
+"$1" grep /usr/bin awk sed awk && cd done
+		$(pwd) 2>/dev/null x=1 ${HOME} export cd "$@" --verbose --verbose
+	local test test ${HOME} readonly $(pwd) done cd "$1" local && local ${HOME}
+export grep sed done "$@" 2>/dev/null readonly test
+done then echo /usr/bin export export test grep "$@" export "$1" "$@"
+	&& 2>/dev/null local && printf done 'quoted text'
+	'quoted text' printf printf "$@" awk then 'quoted text' awk test 2>/dev/null
+		sed && $(pwd) done local export x=1 awk awk test test
+test -eu 2>/dev/null readonly "$1" ${HOME} --verbose awk readonly grep | awk
+	awk | grep done test grep | -eu ${HOME} && /usr/bin
+	awk echo /usr/bin "$@" printf && done x=1 -eu export
+		printf awk echo readonly "$@"
+test | && then -eu printf "$@" echo
+local export sed awk ${HOME} "$1" printf 'quoted text'
+grep done done grep grep | awk "$@" "$1" printf && grep "$@" echo cd
+readonly then "$@" 2>/dev/null cd 2>/dev/null --verbose
+		done 'quoted text' /usr/bin test cd printf "$1" export
+		sed awk awk then && x=1 $(pwd) -eu /usr/bin
+	--verbose /usr/bin 'quoted text' export -eu
+local echo --verbose local readonly -eu then "$1"
+		| /usr/bin grep --verbose $(pwd) echo done && /usr/bin 'quoted text'
+	done echo cd echo | printf
+		cd readonly done ${HOME} then local ${HOME} x=1
+'quoted text' $(pwd) $(pwd) then --verbose then ${HOME} printf 2>/dev/null
+		printf cd readonly readonly done done --verbose echo grep
+	local export && ${HOME} readonly ${HOME} sed printf printf "$1" 'quoted text'
+awk $(pwd) test test | | then $(pwd) awk readonly readonly
+| -eu ${HOME} export 2>/dev/null
+		/usr/bin cd "$1" -eu sed export readonly 2>/dev/null
+sed readonly && grep $(pwd) grep -eu -eu cd test 2>/dev/null
+	then x=1 grep --verbose -eu test "$1" 'quoted text' ${HOME} readonly
+		"$1" local | "$@" grep "$1" | grep x=1 ${HOME} awk ${HOME} -eu | /usr/bin
+		-eu | then --verbose test "$@" -eu local x=1 "$@" cd 2>/dev/null awk 2>/dev/null
+		grep | done /usr/bin ${HOME}
+2>/dev/null $(pwd) cd done sed --verbose | --verbose |
+		readonly sed 2>/dev/null "$1" $(pwd) export awk cd sed x=1 echo
+'quoted text' | && printf then local /usr/bin x=1 $(pwd) --verbose
+		"$@" grep "$@" cd local
+		"$@" export $(pwd) "$@" cd $(pwd) printf local sed "$1" && echo | grep
+--verbose 2>/dev/null -eu | cd "$1" /usr/bin export awk
+/usr/bin "$1" $(pwd) "$1" local echo then | grep test printf --verbose
+	2>/dev/null --verbose local | sed 2>/dev/null -eu test -eu
+	sed "$@" grep -eu printf 2>/dev/null
+x=1 printf printf export readonly x=1 cd /usr/bin /usr/bin
+${HOME} && 'quoted text'
+awk grep readonly --verbose | "$1" --verbose 2>/dev/null done local
+&& /usr/bin 2>/dev/null sed echo
+then awk readonly then --verbose && "$@" -eu
+2>/dev/null then cd x=1 $(pwd) ${HOME} readonly
+		readonly grep 'quoted text' $(pwd) /usr/bin grep && export
+	grep test grep --verbose && $(pwd) awk /usr/bin grep x=1
+		/usr/bin x=1 sed echo awk $(pwd) test ${HOME} echo 2>/dev/null "$@" export
+		/usr/bin cd && grep test --verbose
+	cd 'quoted text' && cd "$1" --verbose awk then printf ${HOME} cd --verbose
+	readonly $(pwd) readonly 'quoted text'
+	done --verbose $(pwd) export cd then sed sed
+	-eu done printf cd --verbose
+	echo awk local && then ${HOME} awk 2>/dev/null
+&& then | test export sed $(pwd)
+${HOME} then awk ${HOME} -eu /usr/bin | -eu 2>/dev/null done
+2>/dev/null awk local ${HOME} test "$@" awk done
+	x=1 test local --verbose /usr/bin grep sed
+	--verbose cd $(pwd) local
+	readonly cd printf local export local sed readonly ${HOME} done sed done | awk
+	then done x=1 local 2>/dev/null
+sed printf printf local test test printf "$@" cd "$@" done cd --verbose /usr/bin
+	| | && grep awk /usr/bin then ${HOME} echo test $(pwd) printf ${HOME} /usr/bin grep
+${HOME} test x=1 sed $(pwd) 2>/dev/null
+		then "$1" then 'quoted text' awk
+	test $(pwd) then test "$1" $(pwd) printf test && grep printf 'quoted text'
+		test readonly then readonly done cd readonly "$@" cd 'quoted text'
+grep printf done local awk --verbose && grep "$@" sed
+	2>/dev/null then --verbose "$1" export "$1" $(pwd) sed
+	'quoted text' export grep -eu grep
+&& cd test | x=1 | awk printf 'quoted text' 'quoted text'
+--verbose $(pwd) $(pwd) test awk test ${HOME} local
+	readonly --verbose $(pwd) 'quoted text'
+	--verbose && echo readonly $(pwd) sed "$@" && && test cd sed export sed --verbose
+2>/dev/null 2>/dev/null "$1" ${HOME} "$1" -eu | /usr/bin &&
+printf 'quoted text' -eu cd printf
+		"$@" "$1" 'quoted text' ${HOME} echo sed $(pwd) /usr/bin "$@"
+		local grep --verbose x=1 ${HOME} ${HOME} export awk echo "$@" cd grep
+	awk && local export x=1 then sed export cd "$@" sed 'quoted text'
+local grep -eu awk 2>/dev/null "$@" local x=1
+		then && -eu $(pwd) x=1 awk done awk $(pwd) awk local x=1
+&& done 'quoted text' && then cd
+grep x=1 /usr/bin local sed local 2>/dev/null
+printf echo grep done "$@" export grep $(pwd) 2>/dev/null -eu export
+then test export | printf printf && "$1" test done local echo
+test "$@" done && 'quoted text' 'quoted text' sed --verbose
+		-eu grep --verbose echo /usr/bin
+	then grep | echo /usr/bin then local --verbose cd 2>/dev/null
+${HOME} && "$@" 2>/dev/null --verbose then -eu $(pwd) 'quoted text'
+		"$@" printf $(pwd) printf test printf "$1" | export then x=1 done
+	/usr/bin "$@" "$@" local $(pwd) --verbose local done x=1 readonly
+	"$1" cd grep sed "$@" -eu awk 2>/dev/null then "$1" "$1" grep then
+	printf -eu "$1" echo 2>/dev/null test test --verbose x=1 printf /usr/bin
+then x=1 test "$1" readonly export x=1
+		${HOME} x=1 sed -eu export readonly 2>/dev/null --verbose test && grep -eu
+export | && 'quoted text' --verbose printf export "$@" cd 2>/dev/null
+--verbose cd ${HOME} ${HOME} ${HOME} 2>/dev/null 2>/dev/null "$1" printf
+		done echo | readonly grep test then -eu | test
+	local 'quoted text' echo readonly test
+| /usr/bin local && 'quoted text'
+	/usr/bin local ${HOME} then
+		$(pwd) && printf echo $(pwd) && --verbose $(pwd)
+-eu && done printf /usr/bin /usr/bin /usr/bin export /usr/bin x=1 'quoted text'
+		echo echo awk ${HOME} printf /usr/bin
+then 2>/dev/null 2>/dev/null local cd
+--verbose test /usr/bin test readonly grep awk grep --verbose 'quoted text' -eu
+	--verbose done /usr/bin ${HOME} ${HOME} && readonly cd export
+		${HOME} export awk then then && -eu grep && $(pwd) /usr/bin grep "$@" test
+	grep export x=1 sed /usr/bin awk local 2>/dev/null | test
+		done printf local cd sed
+done -eu local ${HOME} echo $(pwd) ${HOME} x=1 cd echo
+		readonly | grep cd grep test local then && export printf
+test && sed "$@" echo sed /usr/bin grep sed export
+awk then done $(pwd) test echo ${HOME} --verbose
+	grep --verbose local "$1" $(pwd) then
+"$1" test ${HOME} test export grep sed done 2>/dev/null printf 'quoted text'
+/usr/bin export x=1 ${HOME} awk
+	readonly && test 'quoted text' "$@" ${HOME} awk readonly
+"$1" grep cd awk "$@" && --verbose awk
+	awk cd x=1 2>/dev/null -eu --verbose /usr/bin -eu
+		| "$1" grep --verbose 'quoted text' awk x=1 | then done readonly
+		test 2>/dev/null printf "$1"
+${HOME} readonly export done echo readonly | cd test readonly done $(pwd)
+	"$1" printf printf cd x=1 then done 2>/dev/null sed x=1 export --verbose
+		then ${HOME} -eu export test echo ${HOME}
+awk test -eu "$@" 'quoted text' "$1" | /usr/bin awk done local grep "$@"
+		2>/dev/null echo echo grep done 2>/dev/null readonly -eu | echo $(pwd) 'quoted text'
+	sed echo done x=1 x=1 grep ${HOME} export ${HOME} done sed
+	"$@" grep test done "$@" "$@" && sed test
+	awk 'quoted text' $(pwd) then --verbose -eu test export readonly /usr/bin
+	| then awk sed then "$@" "$1" -eu --verbose
+&& -eu sed /usr/bin 'quoted text'
+	-eu export echo local && 'quoted text' 'quoted text'
+sed 2>/dev/null $(pwd) 2>/dev/null "$1" echo ${HOME} export echo
+		test ${HOME} local printf local awk printf readonly && grep $(pwd)
+done 2>/dev/null readonly local ${HOME}
+	--verbose printf --verbose printf "$@" cd then done x=1 readonly
+		local --verbose readonly --verbose ${HOME} test --verbose
+test readonly local echo "$1" x=1 then && cd readonly
+	/usr/bin cd printf sed sed "$1" -eu $(pwd) ${HOME} x=1 "$@"
+2>/dev/null cd ${HOME} awk
+	"$@" done $(pwd) -eu readonly export done
+		cd test --verbose | printf
+		grep test 'quoted text' sed -eu printf printf
+${HOME} /usr/bin | $(pwd) /usr/bin
+	"$1" $(pwd) export && ${HOME} awk cd && echo /usr/bin "$1" /usr/bin
+		-eu local "$@" then --verbose "$1" cd readonly export $(pwd) readonly grep
+		${HOME} cd printf && grep
+	"$@" ${HOME} "$1" then local sed local cd sed test
+| x=1 awk -eu echo /usr/bin awk x=1 local $(pwd)
+then sed /usr/bin cd 2>/dev/null 'quoted text'
+	local -eu export x=1 done done --verbose sed then printf $(pwd)
+printf 'quoted text' /usr/bin
+		2>/dev/null 'quoted text' export sed -eu && printf
+	$(pwd) "$@" -eu export "$@" cd printf then test && done export awk
+		/usr/bin echo test /usr/bin -eu | --verbose done x=1 "$1" echo then grep x=1 printf
+export awk then echo | ${HOME} sed --verbose then 2>/dev/null 'quoted text'
+	grep printf /usr/bin "$1" test
+	| && readonly then ${HOME} $(pwd) 'quoted text' printf readonly ${HOME} printf
+		$(pwd) -eu x=1 $(pwd) $(pwd) $(pwd) awk | /usr/bin 'quoted text'
+	sed sed --verbose "$@" echo printf 'quoted text' local local 'quoted text'
+		&& && 'quoted text' /usr/bin $(pwd) "$@"
+	x=1 | | "$1" echo /usr/bin 'quoted text'
+		awk export x=1 local sed
+-eu "$@" grep readonly
+x=1 'quoted text' /usr/bin x=1 test export test &&
+		&& sed printf && --verbose -eu sed -eu
+$(pwd) -eu printf export grep 'quoted text' x=1 done grep "$@"
+then echo $(pwd) "$@" grep
+		--verbose printf local | export grep 'quoted text'
+local echo | 'quoted text' "$@" | cd printf echo echo
+		readonly cd done grep sed --verbose | ${HOME}
+-eu 'quoted text' echo local /usr/bin then ${HOME} -eu 2>/dev/null
+		$(pwd) sed -eu readonly grep
+	"$@" cd -eu readonly readonly
+	test local x=1 ${HOME} 'quoted text' -eu | then test echo readonly echo && | "$@"
+echo then grep echo "$1" ${HOME} 'quoted text' local readonly
+	--verbose x=1 readonly --verbose | && --verbose
+'quoted text' sed | readonly && 2>/dev/null sed echo local x=1 ${HOME} grep echo
+		grep 'quoted text' x=1 /usr/bin local
+cd && export awk "$@" ${HOME} x=1
+	'quoted text' test then ${HOME} 2>/dev/null
+readonly local && 2>/dev/null "$1" echo /usr/bin
+#include c125.sh
+cd -eu cd echo -eu local local x=1 && | "$@" awk --verbose 2>/dev/null
+		$(pwd) test awk export
+	/usr/bin ${HOME} grep ${HOME} && readonly
+| awk then sed "$1" cd 'quoted text'
+		-eu done -eu && readonly /usr/bin done cd printf cd printf x=1 "$1" then 2>/dev/null
+local 2>/dev/null --verbose sed --verbose local cd 2>/dev/null
+		x=1 'quoted text' /usr/bin
+	printf && sed --verbose local 2>/dev/null grep "$1" export "$1"
+	local then readonly sed awk "$1" --verbose
+	| 'quoted text' readonly awk awk then
+echo local $(pwd) test grep $(pwd) $(pwd) "$@" 'quoted text'
+	$(pwd) awk | test "$@" cd test && ${HOME} printf /usr/bin
+	/usr/bin then && test -eu test | test awk export "$@" "$@" local
+	grep export cd local /usr/bin 2>/dev/null
+		--verbose echo done grep readonly then echo
+		${HOME} readonly local readonly -eu export --verbose ${HOME} "$1" 2>/dev/null
+		${HOME} grep 2>/dev/null
+done cd ${HOME} awk -eu x=1 local done echo x=1 awk
+--verbose x=1 sed 2>/dev/null readonly local readonly -eu then "$1" local
+--verbose cd grep -eu /usr/bin echo test x=1 printf readonly grep local awk
+		&& ${HOME} x=1 && local sed then && cd export
+		sed "$@" ${HOME} local -eu awk
+--verbose "$1" then grep grep --verbose ${HOME}
+	x=1 printf echo local readonly readonly /usr/bin --verbose
+	grep done export echo awk done export 'quoted text' 2>/dev/null && export local
+	x=1 "$1" export grep echo export 'quoted text'
+	local 2>/dev/null /usr/bin "$@" awk &&
+	$(pwd) "$@" 'quoted text' done grep readonly test then
+	cd -eu test "$1" ${HOME} /usr/bin local $(pwd)
+		$(pwd) local echo done awk
+then test done readonly x=1 /usr/bin grep grep "$1" export | "$@"
+	--verbose printf "$@" printf export $(pwd) readonly
+	"$@" readonly sed $(pwd) awk readonly readonly x=1 local
+sed 'quoted text' awk "$1" --verbose ${HOME} "$@" then "$@"
+	printf "$1" printf echo sed
+export done 2>/dev/null
+-eu 'quoted text' local x=1 /usr/bin printf
+		awk done export test cd then /usr/bin printf
+sed && cd --verbose "$1" export $(pwd)
+awk "$1" test then done "$1" ${HOME} test && "$1" --verbose sed "$1" sed
+	$(pwd) $(pwd) 2>/dev/null test printf $(pwd)
+		-eu x=1 /usr/bin echo done ${HOME} test done
+		| /usr/bin | export 'quoted text' done export export && ${HOME}
+"$1" local ${HOME} awk "$@" 'quoted text' ${HOME} $(pwd) 'quoted text'
+		| 'quoted text' echo export && local export grep sed echo cd grep
+	awk --verbose echo awk && "$1" -eu local "$1" then --verbose local
+-eu export grep grep awk readonly test readonly sed awk "$@"
+local | $(pwd) echo x=1 $(pwd) sed printf
+'quoted text' done done $(pwd) "$@" 2>/dev/null 'quoted text'
+		test echo $(pwd) 'quoted text' -eu "$@"
+		| /usr/bin sed local x=1 2>/dev/null then readonly
+	'quoted text' echo && --verbose test sed printf printf export
+local sed "$@" $(pwd) /usr/bin readonly /usr/bin x=1 && grep 'quoted text' -eu
+${HOME} /usr/bin readonly $(pwd) $(pwd) test 2>/dev/null sed /usr/bin ${HOME}
+| 2>/dev/null -eu cd -eu cd x=1 local awk
+	2>/dev/null x=1 --verbose ${HOME} cd echo x=1 then readonly
+	echo printf $(pwd) readonly $(pwd) x=1 awk -eu ${HOME} test --verbose done -eu
+echo ${HOME} && ${HOME}
+readonly export | readonly
+	x=1 "$1" && readonly echo "$@"
+sed x=1 awk --verbose x=1 printf sed x=1 awk sed
+		then test 'quoted text' /usr/bin "$1" && "$1" "$1" cd
+$(pwd) printf ${HOME} -eu 2>/dev/null 'quoted text' then $(pwd) /usr/bin then cd
+		${HOME} grep x=1 echo ${HOME} "$@" 2>/dev/null
+		x=1 export 2>/dev/null |
+	sed -eu 'quoted text' test
+	export readonly -eu test ${HOME}
+		readonly --verbose --verbose grep test done
+		test echo $(pwd) sed ${HOME} readonly "$1" $(pwd) grep | done grep printf
+	2>/dev/null /usr/bin
+	grep then awk printf 'quoted text' 'quoted text'
+		cd /usr/bin /usr/bin /usr/bin x=1 then export grep readonly
+		cd -eu /usr/bin "$1" readonly 2>/dev/null
+		x=1 test readonly export | awk 2>/dev/null awk 2>/dev/null readonly $(pwd) 'quoted text'
+	"$1" $(pwd) done 2>/dev/null
+$(pwd) awk local 2>/dev/null ${HOME} --verbose done "$1" x=1 sed
+local sed readonly printf then "$@" printf "$1" cd && grep
+	--verbose x=1 /usr/bin awk readonly "$@"
+		readonly readonly | 'quoted text' sed local readonly ${HOME} readonly
+--verbose "$@" ${HOME} test echo printf export
+		$(pwd) $(pwd) sed sed && --verbose readonly printf x=1
+		2>/dev/null test sed local "$@" done 'quoted text' 2>/dev/null echo x=1 awk
+$(pwd) grep 2>/dev/null test -eu x=1
+	done then -eu $(pwd) $(pwd) 2>/dev/null && --verbose awk $(pwd) printf | grep &&
+		&& echo -eu x=1 "$1" $(pwd) "$1"
+		"$1" && "$1" grep done test /usr/bin printf /usr/bin 'quoted text'
+		echo && 2>/dev/null x=1 done done | grep done | --verbose 2>/dev/null grep grep
+${HOME} -eu 2>/dev/null $(pwd) "$@" readonly "$@" && echo | /usr/bin 2>/dev/null
+	"$1" $(pwd) ${HOME} cd export echo | "$@" x=1 local ${HOME}
+		test printf export test echo then then -eu
+	export 'quoted text' 'quoted text' x=1 export then "$1"
+	-eu -eu sed 'quoted text' 2>/dev/null export printf done printf 2>/dev/null
+		"$@" then export x=1 && 2>/dev/null then test $(pwd) ${HOME} $(pwd)
+		then /usr/bin sed local grep "$1" then cd grep /usr/bin 2>/dev/null
+&& 'quoted text' $(pwd) readonly export "$1" done 2>/dev/null grep | /usr/bin
+		${HOME} && -eu | /usr/bin | local && printf 'quoted text' $(pwd)
+	"$1" printf readonly printf
+		'quoted text' ${HOME} export 'quoted text' "$1" /usr/bin 2>/dev/null
+		/usr/bin printf "$1" "$1" export "$@" --verbose awk "$@" export $(pwd)
+		"$@" grep "$@" done 'quoted text' cd export export
+	printf "$1" test readonly cd export --verbose "$@"
+| done local grep && grep -eu test && cd "$1" x=1 ${HOME} "$1" test readonly
+export local cd $(pwd) sed grep "$@" test then | --verbose $(pwd)
+	-eu printf "$@" grep && /usr/bin ${HOME} cd ${HOME} done export readonly /usr/bin
+		--verbose printf done x=1 "$1"
+		x=1 ${HOME} -eu "$1" cd | local printf export ${HOME} sed $(pwd) echo 'quoted text'
+		printf then cd done grep /usr/bin
+	printf printf grep --verbose /usr/bin -eu readonly then
+		done export cd then done 2>/dev/null
+		| 'quoted text' x=1 then | ${HOME}
+sed then sed --verbose awk "$@" && test --verbose /usr/bin
+	| /usr/bin 2>/dev/null "$@" done && printf readonly sed
+$(pwd) && awk done cd "$@" readonly awk test readonly
+		sed echo printf $(pwd) local cd "$@" test grep --verbose
+	$(pwd) export grep echo done export printf local awk /usr/bin export ${HOME}
+echo then $(pwd) echo 2>/dev/null |
+		grep 'quoted text' ${HOME}
+	-eu -eu grep echo "$@" x=1 /usr/bin grep x=1 | export done -eu ${HOME} export
+printf $(pwd) "$1" done sed awk -eu $(pwd) grep then
+-eu -eu -eu 2>/dev/null awk 2>/dev/null readonly readonly
+		then /usr/bin then /usr/bin $(pwd) "$1" export x=1
+		2>/dev/null "$1" then then -eu "$@" printf
+/usr/bin /usr/bin test && && sed "$@" test printf echo grep sed
+		| --verbose | readonly --verbose sed echo -eu 'quoted text'
+	"$1" printf /usr/bin then -eu awk --verbose readonly echo 2>/dev/null
+/usr/bin | "$1" test cd cd readonly awk "$@" | "$1" awk --verbose
+	-eu printf | $(pwd) "$@" then
+		readonly readonly 2>/dev/null --verbose awk awk awk x=1 printf cd export -eu
+	test then && printf --verbose
+	test done ${HOME} "$1" local ${HOME} echo printf
+"$1" "$@" awk printf
+	grep export x=1 /usr/bin then awk | "$@" printf done --verbose grep /usr/bin &&
+printf 2>/dev/null readonly printf && | then export test awk grep |
+		test ${HOME} local && local -eu | x=1 cd
+printf test 2>/dev/null --verbose echo done --verbose done $(pwd) | export
+test | x=1 2>/dev/null $(pwd) readonly --verbose -eu cd
+| local grep then && then test grep sed $(pwd) printf
+	2>/dev/null test && 2>/dev/null
+	/usr/bin 2>/dev/null printf && /usr/bin /usr/bin grep cd sed then 2>/dev/null
+done "$@" readonly echo done echo test awk $(pwd)
+export "$@" export cd readonly export awk 'quoted text'
+	$(pwd) "$1" /usr/bin readonly /usr/bin grep done x=1 local 'quoted text' done
+		$(pwd) 2>/dev/null 'quoted text' readonly grep --verbose awk "$@"
+echo export local -eu readonly
+echo done $(pwd) 'quoted text'
+		sed then grep 'quoted text' 'quoted text'
+		then cd $(pwd) readonly --verbose --verbose test 'quoted text' x=1 /usr/bin /usr/bin
+	test local readonly && "$@" 2>/dev/null | sed then
+cd $(pwd) -eu x=1 "$1" readonly $(pwd) 2>/dev/null
+		2>/dev/null sed 'quoted text' printf awk readonly local test
+	| echo test test /usr/bin cd then awk -eu 2>/dev/null
+		| 'quoted text' readonly --verbose
+	| printf ${HOME} printf $(pwd) then && x=1 "$@" 2>/dev/null cd grep
+		cd sed --verbose readonly awk | $(pwd) --verbose 2>/dev/null ${HOME} x=1
+echo x=1 2>/dev/null /usr/bin test cd x=1 x=1 printf "$@" 'quoted text'
+		${HOME} ${HOME} 2>/dev/null
+printf -eu test grep $(pwd) grep grep && $(pwd) done printf
+	echo && -eu local 'quoted text'
+		cd local then 'quoted text'
+"$@" local readonly printf cd --verbose 2>/dev/null local echo --verbose local
+	grep $(pwd) test "$1" cd "$1" awk
+	'quoted text' x=1 export
+$(pwd) done 2>/dev/null cd x=1 x=1 awk sed sed 'quoted text'
+		test "$1" readonly echo && && | "$1" --verbose $(pwd)
+readonly sed then "$1" -eu $(pwd)
+	grep echo && $(pwd) && echo ${HOME} && 'quoted text' sed "$@" ${HOME}
+-eu $(pwd) grep x=1 grep readonly sed local awk echo $(pwd) | echo "$1" 2>/dev/null
+	"$1" /usr/bin awk && readonly readonly grep test x=1 cd cd "$1" --verbose | ${HOME}
+echo && x=1 ${HOME} readonly
+	-eu grep sed echo done --verbose | && -eu done test && done && "$1" local sed test
+		&& | awk sed $(pwd) readonly x=1 "$1"
+--verbose done export readonly awk printf ${HOME} awk "$1" /usr/bin echo
+awk --verbose 'quoted text' awk /usr/bin
+| | then x=1 test && test sed export export --verbose then 2>/dev/null 'quoted text'
+		cd grep done awk ${HOME} grep | cd readonly $(pwd) ${HOME} readonly echo --verbose
+export "$@" 2>/dev/null sed cd sed "$@" awk awk cd then ${HOME} local cd cd
+		then sed echo export "$1"
+		test -eu /usr/bin export /usr/bin "$1" cd $(pwd) then printf /usr/bin
+test printf /usr/bin "$1" then /usr/bin local grep grep
+--verbose | && sed then x=1 printf
+--verbose "$@" 'quoted text' awk
+	printf sed | printf $(pwd) then then -eu 2>/dev/null 'quoted text'
+		"$1" readonly ${HOME} 'quoted text'
+		--verbose echo then export printf grep echo sed && then sed then 2>/dev/null test
+	--verbose 2>/dev/null && && /usr/bin
+		-eu && local printf /usr/bin
+		| "$@" printf 'quoted text' /usr/bin done --verbose
+2>/dev/null awk local local /usr/bin local sed
+	sed /usr/bin sed awk && 'quoted text' grep then export 2>/dev/null $(pwd)
+	export test awk awk ${HOME} sed 'quoted text' && $(pwd) ${HOME}
+		then grep printf -eu export x=1 printf /usr/bin 'quoted text'
+		cd 'quoted text' && ${HOME} --verbose printf readonly /usr/bin done 'quoted text'
+	"$@" awk -eu grep ${HOME}
+		then local cd test 'quoted text' /usr/bin "$1" ${HOME}
+		--verbose test 2>/dev/null "$@" 2>/dev/null test done readonly 'quoted text'
+	--verbose x=1 -eu grep 2>/dev/null local 'quoted text'
+		--verbose $(pwd) readonly $(pwd) printf
+done readonly $(pwd) $(pwd)
+	grep test /usr/bin local
+		awk | echo readonly 'quoted text' "$@" echo | 'quoted text'
+$(pwd) "$1" "$@" "$@" "$@" cd awk -eu export ${HOME} x=1
+	done readonly then local grep then /usr/bin 'quoted text'
+then 2>/dev/null test printf 2>/dev/null
+done /usr/bin "$1" x=1 sed awk ${HOME} && printf local grep
+done /usr/bin local $(pwd) x=1 && local | | then ${HOME}
+	/usr/bin --verbose then ${HOME} 2>/dev/null 'quoted text'
+	$(pwd) "$1" done local readonly "$1" $(pwd) then "$@" printf then done | readonly
+		echo && x=1 'quoted text' ${HOME} sed cd /usr/bin -eu cd $(pwd) sed -eu ${HOME}
+		local && "$@" x=1 test --verbose --verbose
+		-eu $(pwd) done export --verbose printf sed awk sed then export "$1" 'quoted text'
+	x=1 2>/dev/null then local --verbose
+		$(pwd) local sed --verbose local -eu cd | awk "$@" readonly "$@" export
+		done /usr/bin "$@" 'quoted text'
+		'quoted text' sed printf done ${HOME} $(pwd) "$1" printf
+--verbose 2>/dev/null echo local export 2>/dev/null export ${HOME}
+awk awk sed awk 2>/dev/null local printf done done ${HOME} "$@" readonly /usr/bin
+		local awk grep "$@" && local
+echo cd "$1" "$@" export ${HOME} 2>/dev/null awk
+	echo printf ${HOME} /usr/bin echo ${HOME} "$1" "$1" done x=1 'quoted text'
+export ${HOME} then --verbose "$1" "$1" --verbose
+	$(pwd) printf grep $(pwd) cd readonly
+test | /usr/bin local --verbose echo grep 'quoted text'
+		"$@" x=1 then && 2>/dev/null then
+	cd grep x=1 export test readonly ${HOME} export awk then $(pwd) export
+		readonly sed done grep sed /usr/bin --verbose 'quoted text' done
+		"$@" --verbose local local
+grep --verbose x=1 readonly "$@" awk grep ${HOME} awk 'quoted text'
+"$1" done -eu && x=1 local grep -eu | $(pwd)
+	'quoted text' export && -eu
+then 'quoted text' /usr/bin awk awk done
+readonly grep --verbose sed --verbose | 2>/dev/null $(pwd)
+		'quoted text' | sed awk $(pwd) 2>/dev/null -eu 'quoted text'
+	then printf ${HOME} $(pwd) ${HOME} local awk done ${HOME} readonly
+		cd readonly done | "$@" ${HOME} "$@"
+		| | "$@" done "$1" /usr/bin cd then test echo cd done
+--verbose test sed then test $(pwd) --verbose --verbose
+	&& awk local "$@" printf -eu /usr/bin export printf sed 'quoted text' x=1 awk 2>/dev/null
+		"$1" ${HOME} done "$1" cd then then export 2>/dev/null $(pwd) cd test | grep then
+		awk && test grep -eu awk readonly | | ${HOME} test readonly then awk -eu
+-eu ${HOME} sed then sed 2>/dev/null /usr/bin "$@" done
+		"$@" sed 'quoted text' --verbose cd done cd cd awk 2>/dev/null --verbose
+awk | | test && ${HOME} test 'quoted text' export export | 'quoted text'
+grep 'quoted text' && --verbose 2>/dev/null 2>/dev/null sed export echo
+readonly "$@" 2>/dev/null done readonly /usr/bin && printf
+done 2>/dev/null x=1 awk 'quoted text' test -eu done --verbose
+		awk 2>/dev/null --verbose done 2>/dev/null grep local -eu cd done --verbose printf
+| printf 'quoted text' ${HOME} 'quoted text'
+2>/dev/null 'quoted text'
+printf 2>/dev/null echo sed
+		test | cd --verbose printf export x=1 echo then $(pwd) grep grep "$1" local
+		'quoted text' export "$@" awk && echo readonly test test echo
+grep /usr/bin ${HOME} && sed done 2>/dev/null export
+sed done 'quoted text' x=1 done then cd "$@" grep readonly test | sed echo ${HOME}
+		echo x=1 printf -eu | $(pwd) local /usr/bin -eu /usr/bin && && ${HOME} $(pwd)
+		"$1" "$1" done grep echo
+	'quoted text' grep $(pwd) echo $(pwd) 'quoted text' test export && cd ${HOME}
+	$(pwd) cd /usr/bin readonly /usr/bin
+"$@" awk 2>/dev/null --verbose
+	test && $(pwd) -eu cd test done done 2>/dev/null echo "$@" && 2>/dev/null
+		then sed ${HOME} sed
+		--verbose ${HOME} 'quoted text' "$1" readonly
+	${HOME} "$@" x=1 test &&
+	| readonly -eu 2>/dev/null local echo /usr/bin x=1
+cd echo "$@" && grep local awk done sed "$@"
+		${HOME} awk -eu done then /usr/bin done
+	echo /usr/bin export test echo x=1 grep "$@" sed
+	then grep readonly "$1" --verbose $(pwd) readonly echo 2>/dev/null "$1" ${HOME}
+| x=1 | test && | 2>/dev/null
+--verbose cd ${HOME} test ${HOME} ${HOME} export awk x=1 grep cd
+sed grep awk $(pwd) $(pwd) ${HOME} local /usr/bin printf local readonly
+	sed awk printf 'quoted text' "$1" && /usr/bin /usr/bin done echo -eu 'quoted text'
+		printf then --verbose readonly cd x=1 echo --verbose
+	x=1 test test "$@" printf
+	then | then /usr/bin -eu test grep test sed sed cd
+	export "$@" echo sed export grep then "$@" sed awk
+echo 2>/dev/null grep printf grep done /usr/bin
+	cd export $(pwd) grep sed | "$1" --verbose test "$@" /usr/bin --verbose
+		"$@" $(pwd) ${HOME} "$1" echo "$@"
+&& grep | test x=1 echo $(pwd) | "$1" done grep && grep "$1" x=1
+grep x=1 | local | readonly -eu "$@" test /usr/bin
+	done -eu $(pwd) x=1 2>/dev/null ${HOME} grep 2>/dev/null
+		grep ${HOME} | "$@" export 2>/dev/null echo 2>/dev/null | 2>/dev/null 2>/dev/null
+printf local ${HOME} test && --verbose readonly ${HOME} --verbose $(pwd) cd --verbose
+test ${HOME} | 2>/dev/null readonly ${HOME} -eu && test 2>/dev/null 'quoted text'
+		'quoted text' local local | local x=1 awk | 2>/dev/null awk
+	echo /usr/bin ${HOME} cd sed sed test grep 'quoted text'
+		x=1 $(pwd) awk x=1 cd "$@" 2>/dev/null test
+		${HOME} x=1 awk done test | | sed cd local | x=1 then
+sed 2>/dev/null export printf printf local local --verbose ${HOME}
+		--verbose | sed echo $(pwd) 2>/dev/null readonly
+	then grep printf awk x=1 /usr/bin 2>/dev/null
+		"$1" printf /usr/bin export sed $(pwd) --verbose done ${HOME} -eu grep
+		printf grep then then "$1"
+		/usr/bin readonly local 2>/dev/null $(pwd) grep cd "$1" ${HOME} $(pwd) ${HOME}
+	awk | $(pwd) then export printf --verbose "$@"
+	echo && export --verbose | echo ${HOME} $(pwd) "$1" "$@" "$@"
+2>/dev/null && test local x=1 | grep | echo echo -eu export "$1" then | export
+grep awk && sed test then /usr/bin echo awk && --verbose test local | "$@"
+		2>/dev/null && done | awk "$1" local grep 2>/dev/null
+		printf 2>/dev/null echo | --verbose -eu done printf
+		'quoted text' done then | 'quoted text' cd done --verbose cd 'quoted text' echo
+		| x=1 then "$1" | done done /usr/bin
+		-eu export awk -eu sed cd
+	"$@" grep grep ${HOME} -eu export then echo 'quoted text' local
+grep sed 2>/dev/null done -eu awk "$@" cd /usr/bin test cd $(pwd)
+		| | cd "$1" 2>/dev/null
+	done /usr/bin printf 2>/dev/null done readonly ${HOME}
+$(pwd) export done x=1 -eu "$@" then "$1"
+		done readonly && test local
+sed 2>/dev/null awk test 'quoted text' readonly /usr/bin ${HOME} /usr/bin
+export test --verbose x=1 test --verbose local then local
+		then --verbose ${HOME} done && 2>/dev/null ${HOME}
+	then /usr/bin /usr/bin echo cd cd echo
+		local export ${HOME} "$1" 'quoted text' 2>/dev/null x=1 test ${HOME}
+cd 2>/dev/null $(pwd) 'quoted text'
+		local 2>/dev/null --verbose done "$1" cd
+	done readonly printf awk x=1 awk printf
+	readonly local awk && sed 'quoted text' then
+done -eu --verbose /usr/bin test done export local sed "$1" ${HOME} x=1 readonly
+	cd && sed 2>/dev/null "$1" then readonly
+		'quoted text' echo cd export echo echo test 2>/dev/null
+	-eu $(pwd) 2>/dev/null x=1 ${HOME} &&
+		--verbose then --verbose --verbose $(pwd) 2>/dev/null "$@"
+		test echo test 2>/dev/null done | && grep printf ${HOME}
+	"$1" -eu "$@" export awk "$1" local x=1 2>/dev/null
+	printf printf 2>/dev/null "$1" then
+		'quoted text' awk 'quoted text' | then grep | printf && 2>/dev/null
+		printf -eu export test "$@" test "$@"
+"$1" export ${HOME} sed ${HOME}
+	printf test cd test grep grep then /usr/bin readonly sed
+		x=1 && /usr/bin "$1" then ${HOME} printf awk awk | local 'quoted text' cd
+	echo sed readonly echo -eu then $(pwd)
+		'quoted text' && --verbose sed echo then
+		awk readonly cd && awk $(pwd) then
+/usr/bin -eu echo "$1" --verbose done x=1 'quoted text' then /usr/bin
+	-eu -eu /usr/bin && export grep readonly printf | cd 'quoted text' | ${HOME}
+	test done 'quoted text' -eu $(pwd) ${HOME} echo x=1 readonly /usr/bin done 2>/dev/null
+		/usr/bin 'quoted text' grep sed
+		"$1" | cd "$@" | test readonly
+	local "$@" 2>/dev/null export -eu 2>/dev/null
+		printf 'quoted text' ${HOME} /usr/bin
+grep test done grep $(pwd) x=1 then readonly readonly awk 'quoted text'
+/usr/bin -eu grep printf
+	printf echo printf then 'quoted text'
+	test /usr/bin echo && awk
+	--verbose cd $(pwd) printf export
+		'quoted text' /usr/bin then cd
+${HOME} echo 'quoted text' local && test
+	readonly 'quoted text' $(pwd) printf /usr/bin -eu 'quoted text' ${HOME}
+		echo --verbose /usr/bin awk cd --verbose "$1" "$@" cd done
+sed printf local test 'quoted text' readonly /usr/bin x=1 -eu
+	echo x=1 done done readonly "$@" $(pwd) sed echo 'quoted text' x=1 echo awk sed
+		$(pwd) 2>/dev/null ${HOME} sed export printf
+| ${HOME} sed && readonly awk local then ${HOME}
+	grep "$@" $(pwd) grep
+local readonly ${HOME} "$@"
+		awk ${HOME} awk echo export 'quoted text' test $(pwd) | $(pwd) | &&
+${HOME} awk --verbose test
+"$1" | ${HOME} --verbose then sed
+		echo --verbose test x=1 echo --verbose printf cd && readonly
+"$@" grep readonly /usr/bin /usr/bin x=1 $(pwd) && then export echo "$@" echo
+sed x=1 local 'quoted text'
+	&& done local export grep --verbose then readonly cd ${HOME} && test
+export cd | echo done --verbose grep | $(pwd) local 'quoted text' && printf grep
+	done printf --verbose sed && ${HOME} | 'quoted text' readonly
+-eu export $(pwd) 2>/dev/null sed sed printf readonly
+		'quoted text' /usr/bin test done sed grep --verbose done ${HOME} test
+	then /usr/bin /usr/bin "$1"
+	awk export | echo | $(pwd) sed awk 'quoted text' awk cd export
+		awk 'quoted text' done echo -eu awk
+x=1 ${HOME} /usr/bin --verbose
+echo x=1 done test | | 2>/dev/null
+&& echo test && x=1 grep --verbose echo && cd test readonly ${HOME}
+sed sed 2>/dev/null awk awk /usr/bin --verbose 2>/dev/null $(pwd)
+		2>/dev/null awk && readonly done && done && export -eu -eu 2>/dev/null test /usr/bin
+cd $(pwd) 'quoted text' grep "$@" ${HOME} "$1" "$1" then then
+		cd then ${HOME} sed | $(pwd) cd x=1 'quoted text' |
+-eu $(pwd) readonly --verbose x=1 x=1 -eu echo export x=1
+'quoted text' x=1 then test "$1" sed
+	cd 2>/dev/null local then cd x=1 echo /usr/bin grep --verbose 'quoted text'
+		cd x=1 test export grep sed cd grep test $(pwd) printf &&
+	"$1" cd $(pwd) -eu awk | -eu then --verbose
+readonly then export local
+awk echo grep --verbose x=1 $(pwd) 'quoted text'
+then then grep done && done readonly 2>/dev/null -eu "$1"
+-eu test ${HOME} readonly grep "$1" grep echo awk "$1" | -eu grep
+export $(pwd) local test | 'quoted text' "$@"
+	readonly /usr/bin test local
+	/usr/bin $(pwd) done -eu 2>/dev/null 2>/dev/null x=1
+		export test echo sed 2>/dev/null
+		then done --verbose export sed grep x=1 grep
+cd 2>/dev/null "$1" --verbose 'quoted text' 2>/dev/null /usr/bin
+	"$1" export sed "$@" x=1 $(pwd) grep awk $(pwd) local local
+		awk local grep grep && printf
+		${HOME} "$1" cd | awk --verbose
+-eu grep && readonly sed "$1" awk 2>/dev/null readonly awk export export then -eu
+	cd x=1 /usr/bin cd printf
+	done sed -eu "$1" local then /usr/bin local readonly | $(pwd) sed readonly
+test awk ${HOME} $(pwd) cd awk
+printf ${HOME} sed 'quoted text' 2>/dev/null 2>/dev/null
+		echo echo done x=1 $(pwd) printf readonly
+		'quoted text' 'quoted text' 'quoted text' 'quoted text' && grep cd --verbose
+'quoted text' local sed cd "$@" | x=1 $(pwd) --verbose grep export
+		/usr/bin then --verbose echo test
+	"$1" grep printf test sed | 2>/dev/null cd then local echo "$1" echo
+	| awk done test -eu cd sed
+		echo done /usr/bin /usr/bin sed test awk 'quoted text' sed grep
+	--verbose sed "$@" test local awk test local "$@" sed x=1 test
+		readonly 'quoted text' awk "$@" "$1"
+		readonly "$1" 2>/dev/null "$1" --verbose grep /usr/bin
+	test 'quoted text' -eu awk && $(pwd) 2>/dev/null
+	printf export 2>/dev/null done grep sed | x=1 | awk "$@" /usr/bin "$@" printf
+		grep $(pwd) local $(pwd) $(pwd) $(pwd) $(pwd) "$1" --verbose
+	done $(pwd) done then -eu x=1 cd
+sed done echo export done export 2>/dev/null 2>/dev/null echo /usr/bin printf awk
+	local export echo then local grep grep awk done -eu /usr/bin done cd printf sed
+		$(pwd) && "$1" printf "$1" done 'quoted text'
+	done "$1" sed awk "$@" test done sed printf done | $(pwd) printf && then
+export export 'quoted text' && | then -eu "$@" -eu awk printf sed readonly
+		test printf --verbose /usr/bin /usr/bin then --verbose local cd
+		&& cd 'quoted text' cd grep
+local local ${HOME} --verbose
+		-eu then $(pwd) "$@" echo $(pwd) 'quoted text' ${HOME}
+	echo printf test "$1" && "$1" test && "$@" x=1 awk awk
+	--verbose 2>/dev/null 'quoted text' /usr/bin 'quoted text' awk echo $(pwd) local
+	"$@" x=1 2>/dev/null ${HOME} local | -eu printf export
+	&& /usr/bin export cd printf "$1" --verbose then "$1"
+&& $(pwd) sed 'quoted text' /usr/bin ${HOME} printf awk | ${HOME} local local
+sed -eu printf x=1 --verbose
+	sed readonly test 'quoted text'
+	--verbose "$@" --verbose echo x=1 test echo "$@" $(pwd)
+readonly printf 'quoted text' 'quoted text' printf $(pwd) &&
+	export local grep export -eu local grep cd "$1" | && local "$@" export
+	then sed cd export grep then $(pwd) export
+		${HOME} echo cd && readonly printf --verbose 2>/dev/null ${HOME}
+		'quoted text' -eu ${HOME}
+cd cd test 2>/dev/null "$1" test ${HOME}
+then printf awk test grep then printf cd ${HOME} sed grep /usr/bin
+		sed export "$@" printf |
+		awk "$@" test --verbose awk printf "$1" local ${HOME} cd $(pwd) /usr/bin then
+		export --verbose readonly test 'quoted text' 2>/dev/null
+		grep grep --verbose x=1 readonly ${HOME}
+	$(pwd) && && x=1 sed ${HOME}
+	grep export "$1" x=1 /usr/bin
+| readonly grep "$@" | ${HOME}
+done && readonly then grep
+		x=1 grep ${HOME} ${HOME} export
+readonly && readonly done "$@" ${HOME} 'quoted text' 2>/dev/null -eu x=1
+		cd local local sed printf then "$@" ${HOME} "$@" && printf readonly local
+		2>/dev/null x=1 "$@" echo sed && export 'quoted text' -eu -eu -eu |
+then sed $(pwd) "$@" "$1" ${HOME}
+&& done 'quoted text' awk "$@" printf
+	sed cd sed x=1 "$1" sed echo /usr/bin awk | awk 2>/dev/null ${HOME} | export "$1"
+		x=1 --verbose done ${HOME}
+		| done ${HOME} readonly 'quoted text' 2>/dev/null readonly $(pwd) &&
+	then printf done local cd done /usr/bin echo export printf
+	"$1" then | ${HOME} test test test local x=1 | local grep test then then x=1 'quoted text'
+x=1 grep ${HOME} done cd sed grep sed $(pwd) sed echo awk
+--verbose ${HOME} awk && local --verbose x=1 |
+/usr/bin cd export sed 'quoted text' "$1" --verbose $(pwd) &&
+grep && && $(pwd) cd "$@" | "$1" grep grep ${HOME} printf sed 2>/dev/null
+	${HOME} 2>/dev/null test printf sed printf x=1 done done -eu ${HOME}
+		"$1" /usr/bin printf ${HOME} test
+	readonly then sed sed sed test test /usr/bin && ${HOME}
+"$1" cd 'quoted text' printf
+grep --verbose ${HOME} then test x=1 &&
+	cd cd awk $(pwd) test
+--verbose x=1 /usr/bin done "$@" grep echo echo test grep && ${HOME}
+		/usr/bin ${HOME} then /usr/bin then
+| echo -eu awk then | export 2>/dev/null --verbose export echo cd -eu -eu -eu
+	$(pwd) awk "$@" --verbose awk done cd done cd grep printf x=1 'quoted text' awk
+	"$@" then | local $(pwd) $(pwd) then "$1" sed echo echo 'quoted text' 'quoted text'
+${HOME} cd echo cd cd $(pwd) then 'quoted text' x=1 test sed -eu
+		local -eu 2>/dev/null --verbose | cd then "$@" ${HOME} cd
+		&& && cd cd /usr/bin then cd 'quoted text'
+		$(pwd) x=1 $(pwd) printf --verbose export printf
+	2>/dev/null done test cd 'quoted text'
+| readonly then "$1" printf $(pwd) 2>/dev/null x=1
+	"$1" ${HOME} ${HOME} test "$@" | 2>/dev/null then awk sed | $(pwd)
+	'quoted text' grep 2>/dev/null
+		grep grep --verbose then printf then test readonly "$1" /usr/bin "$1"
+${HOME} done "$1" /usr/bin grep awk 'quoted text'
+	printf | | cd -eu 2>/dev/null test then $(pwd) done done then 'quoted text'
+		2>/dev/null /usr/bin $(pwd)
+local local export && /usr/bin
+| && test done cd 'quoted text' ${HOME} "$1" test echo "$@" then
+	then "$@" "$@" --verbose printf --verbose local
+		&& --verbose cd echo echo sed export /usr/bin echo cd 'quoted text' done
+		x=1 x=1 sed -eu export x=1 grep sed done
+		readonly 'quoted text' "$@" then x=1 $(pwd) done then --verbose
+printf test ${HOME} "$1" "$@" sed /usr/bin awk 'quoted text'
+-eu printf && 2>/dev/null echo done sed "$1"
+awk $(pwd) | ${HOME} then /usr/bin --verbose then /usr/bin
+	cd awk "$@" ${HOME} "$@" ${HOME} cd /usr/bin
+	$(pwd) "$1" export done "$@" echo sed echo 'quoted text' export then 'quoted text'
+"$@" sed test done ${HOME} done
+"$@" ${HOME} /usr/bin local 'quoted text' done export sed local x=1 awk -eu awk
+test "$@" $(pwd) echo "$@" --verbose "$1"
+		test ${HOME} sed --verbose export -eu "$@" test x=1 -eu then
+awk done grep 2>/dev/null | ${HOME} then then cd 'quoted text'
+		echo export test /usr/bin
+	'quoted text' 2>/dev/null /usr/bin grep awk sed $(pwd) then && | local "$1"
+	done $(pwd) awk local cd printf cd
+grep --verbose 'quoted text' | ${HOME}
+	test echo $(pwd) -eu x=1 && $(pwd) cd test cd ${HOME} --verbose grep grep
+x=1 export 2>/dev/null --verbose
+		done $(pwd) --verbose | --verbose x=1 sed grep done x=1 && sed -eu then readonly
+		--verbose | $(pwd) "$1" && echo x=1 /usr/bin -eu printf printf
+	local done /usr/bin $(pwd) "$@" /usr/bin sed sed readonly
+		awk "$@" 'quoted text'
+	2>/dev/null printf awk local $(pwd) sed $(pwd) 2>/dev/null echo cd "$@" test
+printf 'quoted text' 2>/dev/null /usr/bin export readonly cd grep
+		$(pwd) 'quoted text' 'quoted text' "$@" "$1" export cd done export ${HOME}
+&& sed 'quoted text' --verbose
+	awk export -eu 2>/dev/null $(pwd)
+--verbose | "$1" cd readonly "$1" local $(pwd) /usr/bin done cd
+--verbose echo grep 'quoted text'
+then --verbose && cd echo export ${HOME} && local && ${HOME}
+"$@" ${HOME} then x=1 then | local echo &&
+		--verbose ${HOME} -eu x=1 x=1
+		2>/dev/null -eu 'quoted text' /usr/bin
+	done && ${HOME} && x=1 2>/dev/null
+	export then ${HOME} /usr/bin -eu x=1 && then sed "$1" awk local export readonly
+	export $(pwd) export -eu awk --verbose echo 'quoted text'
+echo /usr/bin cd "$1" test then awk "$@" local test | && done x=1 --verbose then
+		$(pwd) 2>/dev/null test "$1" $(pwd) export "$@" x=1
+'quoted text' done | export awk printf local test /usr/bin "$1" /usr/bin x=1 "$1"
+		local -eu 2>/dev/null -eu -eu test ${HOME} sed "$@" grep x=1 done --verbose
+		x=1 echo echo $(pwd) "$1"
+	cd readonly | printf then readonly test && 2>/dev/null cd x=1 | done
+then local readonly "$1" sed awk $(pwd) && /usr/bin $(pwd)
+&& $(pwd) "$1" /usr/bin && x=1 2>/dev/null "$1"
+	$(pwd) /usr/bin -eu then "$@" grep ${HOME} readonly "$1"
+		grep readonly then local 'quoted text' awk /usr/bin "$@" printf local then
+done 2>/dev/null cd -eu 'quoted text'
+	2>/dev/null 'quoted text'
+	x=1 cd ${HOME} cd then --verbose echo then $(pwd) -eu | then "$1" test x=1
+		then sed printf then ${HOME} x=1 2>/dev/null "$@" ${HOME} sed done | ${HOME}
+		sed 2>/dev/null -eu grep --verbose echo ${HOME}
+		export && /usr/bin readonly ${HOME} ${HOME} x=1
+		test grep 2>/dev/null | 2>/dev/null
+	done "$1" ${HOME} /usr/bin "$1"
+		sed | echo 2>/dev/null awk grep ${HOME} -eu readonly "$1" grep | readonly
+	&& $(pwd) printf awk /usr/bin --verbose 2>/dev/null 2>/dev/null
+	printf /usr/bin -eu sed cd "$@" -eu "$1" printf
+	then x=1 grep local test
+| then "$@" ${HOME} --verbose 'quoted text' sed export /usr/bin export test
+		$(pwd) "$@" ${HOME} readonly "$1" --verbose printf done && done "$1" | "$1"
+		"$@" sed local --verbose && done 'quoted text' x=1 "$@" |
+export ${HOME} test readonly local done then "$1" done
+		/usr/bin awk /usr/bin "$@" $(pwd) printf 'quoted text'
+x=1 then export grep 2>/dev/null "$1" /usr/bin sed export | 2>/dev/null export
+	"$@" cd sed 2>/dev/null
+		2>/dev/null cd "$1" test test $(pwd) awk
+	$(pwd) printf ${HOME} export | --verbose printf "$@" /usr/bin awk --verbose then
+	| then 'quoted text' /usr/bin echo
+		2>/dev/null then 'quoted text' 2>/dev/null printf test
+		2>/dev/null export done 'quoted text'
+		| && test $(pwd) $(pwd) -eu done awk x=1 local /usr/bin printf
+cd sed then 'quoted text' sed local
+	cd grep --verbose echo awk | "$@" awk "$1" export
+		$(pwd) 2>/dev/null "$1" /usr/bin -eu test done then "$@" test "$1" 'quoted text'
+	printf 2>/dev/null | x=1 echo | done
+	--verbose $(pwd) printf $(pwd) echo "$@" grep 2>/dev/null | printf
+		then "$1" cd awk 'quoted text' done
+		readonly && printf export ${HOME} local printf "$1" done | grep export
+	&& && $(pwd) awk sed export "$@" ${HOME} && && export $(pwd) -eu
+printf "$@" --verbose export --verbose done then 'quoted text' /usr/bin
+		awk /usr/bin export done | test -eu readonly "$1"
+	export sed readonly test test 'quoted text' 2>/dev/null
+	printf local export export ${HOME} "$1" /usr/bin
+		$(pwd) | done export /usr/bin export 'quoted text' | "$@" export cd
+test ${HOME} --verbose then 2>/dev/null /usr/bin
+readonly done readonly cd | | local awk | echo
+	echo grep export awk "$@" | sed local cd
+'quoted text' "$1" /usr/bin awk readonly
+		local 2>/dev/null $(pwd) $(pwd) | ${HOME} test 2>/dev/null readonly /usr/bin --verbose
+then --verbose grep export local test "$1" "$@" 2>/dev/null
+		readonly export ${HOME} done local sed | ${HOME} ${HOME} /usr/bin
+		awk local export done test done local sed then done export done $(pwd) grep
+'quoted text' export 2>/dev/null $(pwd)
+		grep -eu -eu $(pwd) awk echo sed ${HOME}
+	cd /usr/bin echo $(pwd) export 'quoted text' awk /usr/bin grep
+		grep -eu "$1" | x=1 readonly --verbose
+	then sed /usr/bin echo done printf &&
+	local ${HOME} readonly x=1 $(pwd)
+		-eu export sed x=1 | printf x=1 awk
+		echo ${HOME} sed printf /usr/bin
+		readonly && --verbose -eu printf grep $(pwd) 'quoted text' export x=1
+		&& ${HOME} x=1 cd local echo /usr/bin awk && local x=1 cd --verbose
+	done awk sed echo cd $(pwd)
+2>/dev/null cd $(pwd) 'quoted text' then ${HOME}
+&& ${HOME} sed cd 'quoted text' ${HOME} /usr/bin readonly && then local
+grep readonly local --verbose
+	cd -eu test ${HOME} -eu
+		| ${HOME} export done readonly readonly done
+	"$@" echo $(pwd) sed done && export
+		grep /usr/bin $(pwd) 2>/dev/null awk "$1" 'quoted text' grep "$@" x=1 done
+$(pwd) && awk /usr/bin x=1 $(pwd) local grep 'quoted text' echo
+	2>/dev/null -eu done cd then -eu x=1
+	grep /usr/bin && 'quoted text' /usr/bin export "$@" awk 2>/dev/null export
+printf readonly local /usr/bin readonly 2>/dev/null local
+"$@" local | then "$1" ${HOME} export sed printf --verbose grep
+	"$1" sed 2>/dev/null ${HOME}
+	"$@" ${HOME} && done readonly 'quoted text' local printf
+&& export && grep /usr/bin --verbose 'quoted text'
+		${HOME} cd ${HOME} test -eu 'quoted text'
+	echo "$1" sed ${HOME} 'quoted text' echo "$1"
+local 'quoted text' sed x=1 cd readonly | | /usr/bin awk --verbose printf sed
+--verbose -eu sed awk done grep echo export "$1" 'quoted text' export && -eu --verbose
+"$@" then grep grep && local export
+	readonly "$1" echo done readonly readonly test
+		'quoted text' printf grep
+		sed "$1" "$1" export then
+-eu test grep -eu done 'quoted text' echo x=1 | "$1" cd printf local echo
+	awk readonly cd then /usr/bin 2>/dev/null
+	awk export readonly export grep
+echo local test --verbose -eu then
+$(pwd) done ${HOME} grep "$1" echo cd cd --verbose
+		echo then local echo export && 2>/dev/null
+		"$1" readonly /usr/bin local local ${HOME} ${HOME} /usr/bin ${HOME}
+export "$1" ${HOME} printf --verbose cd test export && $(pwd) then 'quoted text'
+	x=1 $(pwd) --verbose x=1 "$@" && cd
+	done echo | "$1" /usr/bin
+awk local | && local cd printf awk x=1 ${HOME} cd $(pwd) printf readonly
+		${HOME} "$@" ${HOME} && sed --verbose grep
+	${HOME} sed 2>/dev/null -eu grep export "$@" export
+		then readonly --verbose && "$@" then echo /usr/bin $(pwd) "$1"
+	$(pwd) "$1" grep 2>/dev/null $(pwd) export /usr/bin
+--verbose --verbose 'quoted text' test done readonly
+		grep /usr/bin 'quoted text' x=1 'quoted text' 'quoted text' echo
+		--verbose 2>/dev/null "$@"
+	test grep /usr/bin done done done printf awk export ${HOME} test
+	&& local done sed awk && local ${HOME} export then 'quoted text' "$1" ${HOME}
+2>/dev/null done local 2>/dev/null ${HOME} "$@" /usr/bin awk local local
+		local -eu then | -eu -eu "$@" ${HOME} /usr/bin "$@" cd x=1
+$(pwd) 'quoted text' /usr/bin $(pwd) cd --verbose readonly "$1" then -eu "$@"
+		local x=1 && x=1 --verbose grep
+awk export readonly $(pwd) "$@" "$@" sed test --verbose
+		readonly grep ${HOME} --verbose
+&& x=1 -eu done export grep grep "$@" -eu cd $(pwd) printf local test $(pwd)
+test echo -eu readonly sed awk | printf test then sed cd then done
+export ${HOME} 'quoted text' --verbose
+done echo "$@" ${HOME} /usr/bin readonly ${HOME} 'quoted text' done
+/usr/bin awk "$@" "$@" 2>/dev/null test test "$@" done
+		"$@" "$1" local -eu "$1" "$1" test -eu x=1 'quoted text' 2>/dev/null
+		| echo "$1" grep | --verbose grep 2>/dev/null /usr/bin --verbose grep
+	"$1" 'quoted text' /usr/bin && awk --verbose $(pwd)
+export readonly test 'quoted text' | $(pwd)
+sed grep "$@" then printf "$@" --verbose && printf /usr/bin /usr/bin printf
+		then awk --verbose export "$@" x=1 echo "$1"
+	readonly printf | test grep 2>/dev/null echo ${HOME} --verbose 2>/dev/null | test
+sed echo sed --verbose local && awk readonly done then "$@"
+	grep export printf "$1" printf
+	$(pwd) grep awk "$@" echo 2>/dev/null cd x=1 cd test ${HOME}
+'quoted text' local local sed
+	done printf 2>/dev/null local x=1 | 2>/dev/null awk sed
+2>/dev/null $(pwd) test -eu 2>/dev/null
+	readonly echo | grep "$1" sed ${HOME} readonly x=1 "$1" export sed 2>/dev/null
+	/usr/bin cd local $(pwd) readonly sed export x=1 2>/dev/null local "$@"
+	"$1" -eu awk /usr/bin "$1" awk then then | local "$@" export x=1 local printf
+export grep then 'quoted text' 'quoted text' $(pwd) ${HOME}
+	sed export -eu cd echo 'quoted text' && cd cd $(pwd) cd then
+awk local /usr/bin $(pwd) --verbose "$@"
+2>/dev/null "$@" -eu $(pwd) sed local x=1 sed 'quoted text' ${HOME}
+x=1 --verbose 'quoted text' test local 2>/dev/null
+-eu printf "$@" ${HOME} $(pwd) ${HOME}
+		x=1 -eu done | then 'quoted text' 2>/dev/null
+		awk ${HOME} && echo printf $(pwd) grep echo then /usr/bin $(pwd) -eu /usr/bin
+	awk grep | printf | /usr/bin readonly sed then 'quoted text' export
+readonly 2>/dev/null awk "$1" "$1" --verbose 2>/dev/null
+	then printf echo grep "$1" | export awk "$1" cd readonly ${HOME} 'quoted text'
+	/usr/bin export 'quoted text' /usr/bin
+&& echo 2>/dev/null x=1 readonly $(pwd) sed x=1 "$1" ${HOME} cd
+		&& local x=1 2>/dev/null x=1 "$1" export "$@"
+		/usr/bin --verbose awk 2>/dev/null
+		$(pwd) printf awk export "$1" "$@"
+	local export test --verbose "$1" $(pwd) "$1" | export && awk export local
+	echo /usr/bin awk awk export then awk "$@" done
+grep $(pwd) cd done grep printf local
+	done test local export done printf
+printf test done $(pwd) grep /usr/bin local -eu awk "$1" echo grep --verbose
+		&& grep sed export $(pwd) /usr/bin done readonly cd $(pwd)
+	test && ${HOME} /usr/bin local test "$1"
+		done "$1" 'quoted text' test 2>/dev/null
+grep awk printf | echo readonly 2>/dev/null done &&
+		local | cd /usr/bin echo ${HOME}
+		${HOME} grep --verbose local "$@" | awk 2>/dev/null
+		"$@" echo echo done readonly then test cd test awk export 2>/dev/null --verbose
+	x=1 readonly "$@" awk echo /usr/bin /usr/bin 2>/dev/null
+cd "$@" "$1" local | sed printf 'quoted text'
+2>/dev/null x=1 --verbose test "$1" local
+&& export $(pwd) test readonly sed done --verbose 'quoted text'
+--verbose x=1 test cd done
+		readonly readonly 'quoted text' then 2>/dev/null grep test | sed "$@"
+test grep then echo local grep local export local -eu 'quoted text' --verbose done
+		'quoted text' --verbose awk 'quoted text' local grep sed
+sed --verbose | 'quoted text' "$1" -eu x=1 -eu readonly
+		grep export printf --verbose "$1" && && $(pwd) ${HOME} /usr/bin
+	2>/dev/null awk export sed | readonly
+		test export && echo "$1" test readonly echo "$1" local "$@" cd |
+	--verbose test done | export
+done done cd "$1" 'quoted text' cd /usr/bin
+${HOME} $(pwd) readonly cd && "$1" grep 2>/dev/null
+		2>/dev/null then test && awk test sed readonly sed $(pwd) && local done &&
+		then $(pwd) && test grep test grep test local "$1" sed $(pwd) 'quoted text' ${HOME}
+		$(pwd) done grep then export "$1" -eu ${HOME} | grep local -eu && x=1 | grep &&
+	-eu sed "$1" export $(pwd) readonly 'quoted text' x=1 --verbose
+	test done export "$1" done $(pwd) grep ${HOME} export then
+		x=1 --verbose /usr/bin x=1 --verbose --verbose test 2>/dev/null readonly -eu x=1
+	then cd ${HOME} readonly 2>/dev/null "$@" ${HOME}
+	awk grep && local then --verbose export && 2>/dev/null /usr/bin readonly test
+'quoted text' 'quoted text' $(pwd) /usr/bin
+	grep | readonly x=1 ${HOME}
+		sed x=1 "$@" -eu sed sed $(pwd) -eu awk $(pwd)
+		test --verbose /usr/bin local
+"$1" sed && $(pwd) ${HOME} 2>/dev/null echo --verbose done echo readonly awk
+	export cd printf echo test --verbose 'quoted text' --verbose grep x=1 export /usr/bin
+/usr/bin awk readonly readonly "$@" "$@" sed readonly test
+then $(pwd) export done | then "$@" echo /usr/bin 2>/dev/null
+		&& then echo $(pwd) local
+	then -eu /usr/bin echo then ${HOME}
+"$@" export "$@" readonly --verbose
+	test then -eu export --verbose | readonly | "$1" /usr/bin
+		$(pwd) awk && ${HOME} test 2>/dev/null "$@" export then cd "$@" && done
+		2>/dev/null export && sed x=1 "$1" $(pwd) then $(pwd) && "$1" local
+		printf printf done "$@" | | readonly
+	sed && grep local | 'quoted text' -eu sed cd sed 'quoted text'
+'quoted text' local && 2>/dev/null
+	$(pwd) readonly then -eu "$@" sed ${HOME}
+		sed sed 'quoted text' && grep export done | "$@"
+	2>/dev/null -eu cd 'quoted text' export then
+export export 2>/dev/null x=1 printf "$@" --verbose printf 2>/dev/null
+		local awk "$@" awk -eu /usr/bin "$1" 'quoted text'
+	printf export test grep --verbose printf sed local then |
+	"$@" done $(pwd) "$@" then ${HOME} sed local cd 'quoted text'
+$(pwd) "$@" test local readonly 2>/dev/null "$@" test done /usr/bin export
+	--verbose then "$1" printf "$@" $(pwd) && 2>/dev/null
+/usr/bin --verbose echo sed | readonly --verbose "$1" sed "$@"
+	local local 'quoted text' printf ${HOME} "$1" "$1" -eu && printf
+	'quoted text' cd printf cd -eu -eu
+	test --verbose local -eu 2>/dev/null $(pwd) done | then --verbose local echo echo
+		echo local test $(pwd) "$@" x=1 readonly
+		cd 'quoted text' printf 'quoted text' $(pwd) && readonly
+	export "$@" readonly done awk then cd grep then
+	'quoted text' "$1" 2>/dev/null ${HOME}
+| awk | printf x=1 "$1" sed | cd awk sed 2>/dev/null 2>/dev/null
+${HOME} && awk -eu test grep grep readonly echo echo test
+${HOME} grep 2>/dev/null local && | "$1" 2>/dev/null cd /usr/bin
+		2>/dev/null readonly test ${HOME} test | x=1 cd printf --verbose ${HOME}
+	--verbose -eu && echo awk cd printf
+| ${HOME} 2>/dev/null cd then x=1 -eu x=1 echo printf 2>/dev/null
+		readonly grep 'quoted text'
+		"$1" --verbose /usr/bin | sed "$1" done /usr/bin printf
+-eu x=1 && x=1 "$@" grep ${HOME}
+		readonly grep local -eu done done 'quoted text' local local
+		done printf | awk test $(pwd) test
+export then printf export awk ${HOME} "$1"
+	readonly export done ${HOME} cd 2>/dev/null && /usr/bin test then /usr/bin
+/usr/bin local readonly done | ${HOME}
+'quoted text' awk x=1 awk ${HOME} ${HOME} awk local
+then then -eu -eu echo sed | | | local echo $(pwd) | "$@" $(pwd) 'quoted text'
+		grep /usr/bin done 2>/dev/null ${HOME} ${HOME} /usr/bin
+		echo awk cd 2>/dev/null cd -eu 2>/dev/null
+		then | readonly 'quoted text' cd export x=1 export export grep ${HOME}
+-eu | sed 2>/dev/null && readonly then printf
+test $(pwd) --verbose 'quoted text'
+		&& printf -eu cd -eu awk 'quoted text' local done export 'quoted text'
+cd printf awk "$@" echo grep
+	| -eu done echo printf "$@" $(pwd) printf
+| printf test export "$1" sed grep "$@" -eu
+		--verbose then sed x=1 local local cd
+cd readonly "$1" ${HOME} printf --verbose -eu
+		"$1" /usr/bin && export export local x=1 --verbose "$1" x=1 then 'quoted text'
+local -eu 2>/dev/null readonly then /usr/bin echo done "$1"
+	&& export /usr/bin 2>/dev/null sed awk && 2>/dev/null /usr/bin cd sed | readonly
+	${HOME} "$@" 'quoted text' cd local ${HOME} "$1" 'quoted text'
+	"$1" && 2>/dev/null local | -eu "$@" done sed test 2>/dev/null printf echo printf
+	| "$1" export ${HOME} cd awk awk && | sed then -eu cd "$1" sed
+	/usr/bin done awk 'quoted text' sed local grep grep printf
+	"$@" then echo grep --verbose local $(pwd) x=1 $(pwd)
+local x=1 sed printf 'quoted text'
+"$1" echo printf "$1" grep readonly test readonly done awk -eu
+	echo grep /usr/bin test | done done 2>/dev/null awk "$1" --verbose
+		| grep "$1" "$@" && cd readonly export 2>/dev/null
+	test 2>/dev/null "$1" /usr/bin -eu x=1 2>/dev/null "$@" readonly
+		--verbose x=1 test "$@" 'quoted text' --verbose &&
+	then x=1 'quoted text' x=1 printf $(pwd) export | /usr/bin printf then
+awk sed echo echo $(pwd) $(pwd)
+-eu echo --verbose sed grep && grep --verbose ${HOME} --verbose &&
+| -eu 2>/dev/null printf readonly awk
+	readonly test && awk x=1 -eu "$@" readonly local -eu awk && /usr/bin
+		$(pwd) printf readonly --verbose 'quoted text'
+test grep $(pwd) grep grep && sed | export $(pwd) test 2>/dev/null local
+		printf test done then ${HOME} | | done "$1" x=1 awk awk readonly test test --verbose
+done | cd then $(pwd) readonly
+		x=1 then 2>/dev/null then
+	2>/dev/null sed readonly && "$1" then "$1" 2>/dev/null then cd grep printf
+echo export printf grep grep then
+		$(pwd) test then "$1" test readonly $(pwd) cd ${HOME} /usr/bin test
+		export echo awk | then printf 'quoted text'
+	"$1" "$1" then /usr/bin local 'quoted text' x=1 export /usr/bin cd sed
+x=1 | grep awk done /usr/bin export sed echo
+"$1" && 'quoted text' readonly $(pwd) cd
+export grep 'quoted text' --verbose readonly x=1 "$1" grep
+		cd | | printf readonly cd "$@" local 2>/dev/null --verbose
+	test x=1 grep export /usr/bin $(pwd) grep /usr/bin
+	"$1" --verbose printf | readonly awk x=1 sed | && export
+		"$@" echo $(pwd) ${HOME} echo -eu ${HOME}
+	then | -eu cd echo export
+		${HOME} --verbose && x=1 $(pwd)
+then "$1" "$1" 'quoted text' | readonly
+		"$@" "$@" local then grep
+	sed readonly -eu --verbose
+awk x=1 sed awk grep ${HOME} "$1" printf export x=1 /usr/bin
+	$(pwd) test 2>/dev/null echo
+	cd then cd awk ${HOME} sed then local grep --verbose test | | "$1" 'quoted text'
+	'quoted text' "$1" "$1" test echo x=1 && /usr/bin ${HOME}
+&& done readonly done -eu then x=1 local x=1 sed ${HOME}
+-eu 'quoted text' awk 2>/dev/null | | cd local 2>/dev/null
+		"$@" 2>/dev/null /usr/bin x=1 x=1 | |
+		echo $(pwd) done | $(pwd) --verbose --verbose awk
+cd done done --verbose 'quoted text'
+		"$@" && printf awk done
+readonly -eu echo | sed --verbose echo /usr/bin
+${HOME} local 2>/dev/null
+		cd export export x=1 'quoted text' 2>/dev/null
+		sed printf readonly ${HOME} printf test awk
+		'quoted text' $(pwd) echo x=1 export 2>/dev/null then $(pwd) "$@"
+x=1 x=1 sed sed "$@" x=1 'quoted text' awk | /usr/bin
+	cd -eu x=1 -eu done -eu awk printf done then | | then done &&
+		grep done -eu -eu done /usr/bin --verbose test x=1 cd $(pwd)
+		x=1 2>/dev/null grep awk && --verbose echo sed 2>/dev/null /usr/bin
+local x=1 && then --verbose export echo x=1 readonly test echo done "$@"
+		then "$@" grep then $(pwd) ${HOME} -eu | --verbose awk
+	printf grep readonly /usr/bin && echo
+	printf 'quoted text' cd done printf
+		'quoted text' -eu done readonly
+sed "$1" $(pwd) $(pwd) export sed then then "$1" local then test sed --verbose
+		$(pwd) && $(pwd) echo awk 2>/dev/null export echo then
+	--verbose local export
+	--verbose -eu 'quoted text' export -eu --verbose --verbose /usr/bin "$@"
+	echo echo then cd -eu /usr/bin
+awk sed /usr/bin then --verbose then "$1" -eu $(pwd) echo printf cd "$1" $(pwd)
+grep | cd 'quoted text' x=1 -eu 2>/dev/null
+	awk echo 2>/dev/null grep && 'quoted text' --verbose
+2>/dev/null local local $(pwd) && local printf export
+	${HOME} test local && readonly -eu && awk 2>/dev/null
+&& "$@" readonly ${HOME} x=1 2>/dev/null
+		local /usr/bin $(pwd) "$@" cd 2>/dev/null export cd
+'quoted text' awk ${HOME} local
+	cd $(pwd) test grep -eu cd | -eu export | x=1 sed grep awk
+		cd -eu readonly local sed 'quoted text' /usr/bin printf && awk
+echo 2>/dev/null "$1" --verbose cd 2>/dev/null local && awk && ${HOME} grep sed
+--verbose --verbose local grep readonly && x=1 -eu test
+	echo awk -eu --verbose printf sed $(pwd)
+	$(pwd) export ${HOME} && "$@" echo cd test "$1" done ${HOME} test test
+	-eu x=1 then ${HOME} export ${HOME} sed done
+	2>/dev/null cd test && cd then
+		then done local /usr/bin then "$1" readonly 2>/dev/null
+	$(pwd) grep grep sed -eu readonly
+awk done printf $(pwd) awk ${HOME} "$1" "$@" local /usr/bin sed sed -eu
+		awk printf | --verbose cd ${HOME} 2>/dev/null
+&& "$@" local && "$1" then then | "$@" cd 2>/dev/null export sed sed local
+printf 'quoted text' sed awk /usr/bin export done cd sed grep ${HOME} readonly
+	2>/dev/null "$1" cd -eu
+echo 'quoted text' then grep ${HOME}
+		grep && --verbose cd local test cd "$1" local done
+	readonly -eu sed then grep cd && then printf
+		grep --verbose local local -eu /usr/bin done local ${HOME} export
+		printf cd /usr/bin | |
+	| test printf --verbose export | ${HOME} then
+| done readonly then then local x=1 sed export awk && sed export &&
+	| echo export grep then then 'quoted text'
+2>/dev/null done ${HOME} "$@" | then readonly "$1"
+		/usr/bin && done && && 'quoted text' | grep -eu export cd readonly
+-eu -eu /usr/bin test test --verbose then local x=1 "$@" sed ${HOME} cd --verbose
+	"$@" --verbose test $(pwd) export printf local done echo test printf | --verbose
+	then printf cd done then "$1" export cd printf --verbose "$1" awk
+/usr/bin printf $(pwd) "$@" export && grep done "$@" $(pwd) local --verbose
+	x=1 && awk /usr/bin 'quoted text' --verbose
+		echo local 2>/dev/null x=1 readonly 'quoted text'
+$(pwd) awk sed --verbose "$@" export done readonly awk ${HOME} local 2>/dev/null
+x=1 "$1" grep 2>/dev/null export done echo | echo "$@"
+	"$@" readonly test cd readonly printf awk ${HOME} echo 'quoted text'
+		2>/dev/null ${HOME} 'quoted text'
+	printf grep -eu /usr/bin cd ${HOME} &&
+"$1" $(pwd) readonly --verbose local grep readonly "$1" $(pwd) 'quoted text'
+| --verbose printf done -eu printf awk
+	| $(pwd) local awk then "$1" --verbose
+	export 'quoted text' --verbose /usr/bin "$@" grep && export echo $(pwd) local awk
+	x=1 2>/dev/null printf 'quoted text'
+	&& "$1" echo printf x=1 printf sed printf done local
+/usr/bin 'quoted text' | readonly
+-eu | test "$@" -eu export --verbose --verbose sed --verbose then -eu 'quoted text'
+printf 2>/dev/null then --verbose echo --verbose cd local -eu
+	2>/dev/null printf /usr/bin cd cd printf awk $(pwd) "$@" "$@" "$@" awk
+	$(pwd) $(pwd) 'quoted text' --verbose
+		sed x=1 'quoted text' local 'quoted text' sed cd -eu $(pwd) sed x=1 done
+	| 'quoted text' | 'quoted text' cd 2>/dev/null
+	--verbose local local local echo grep -eu grep --verbose /usr/bin echo grep /usr/bin
+x=1 readonly | readonly sed 2>/dev/null cd echo
+		| 'quoted text' && done test $(pwd) | local export | x=1
+		sed x=1 "$1" --verbose awk sed --verbose grep cd sed $(pwd) $(pwd) awk then
+	-eu sed then sed then x=1 cd $(pwd) echo readonly /usr/bin
+	done /usr/bin $(pwd) x=1 printf $(pwd) "$1" | sed sed 2>/dev/null -eu /usr/bin
+	${HOME} printf -eu echo
+	--verbose echo | awk /usr/bin $(pwd) export
+	awk /usr/bin --verbose export
+then cd then "$1" "$@" echo 'quoted text'
+		export 'quoted text' printf /usr/bin cd "$1" "$1" --verbose -eu sed --verbose
+		cd 2>/dev/null cd done "$@" | $(pwd) sed sed awk ${HOME} printf
+		| readonly && $(pwd) | 'quoted text' grep cd export echo awk
+	x=1 "$1" local 2>/dev/null sed -eu x=1 | -eu 'quoted text' ${HOME} && $(pwd) done
+	echo local echo -eu cd export "$@" readonly local "$@" grep
+		printf echo done "$@"
+	readonly "$@" -eu awk 2>/dev/null awk x=1 2>/dev/null
+	--verbose sed $(pwd) ${HOME} export "$@" cd test test
+		${HOME} cd -eu cd 2>/dev/null echo
+--verbose $(pwd) awk
+		echo 2>/dev/null done awk | --verbose $(pwd) "$1"
+		/usr/bin export && ${HOME}
+		$(pwd) cd echo && 2>/dev/null --verbose ${HOME} --verbose test "$1" readonly
+		local | sed grep 2>/dev/null -eu done 2>/dev/null &&
+x=1 grep local && $(pwd) 2>/dev/null test | 2>/dev/null x=1
+	grep --verbose done export /usr/bin export then /usr/bin export test grep -eu
+	&& --verbose awk then cd test then 2>/dev/null
+		'quoted text' export done ${HOME} && done 2>/dev/null
+	| done -eu "$@" "$1" ${HOME} 'quoted text' sed done done && --verbose awk local
+awk "$1" test $(pwd) "$1" awk done done && "$1" /usr/bin sed sed "$@"
+--verbose | "$@" export local "$@" --verbose 'quoted text' ${HOME} then cd readonly
+"$1" x=1 readonly local test "$1" local printf
+	grep readonly 2>/dev/null echo readonly x=1 export && /usr/bin readonly
+&& "$@" $(pwd) done 'quoted text' export "$1" x=1
+		echo $(pwd) $(pwd) local grep printf "$1" | test -eu grep readonly --verbose
+${HOME} 2>/dev/null echo $(pwd) x=1 "$1" $(pwd) x=1 -eu /usr/bin
+done test | export test then "$1" export
+echo then grep echo sed done printf then | cd -eu -eu --verbose
+		printf $(pwd) 2>/dev/null export awk then done readonly readonly x=1 printf
+local awk cd && sed done x=1 $(pwd) export | | export echo x=1 'quoted text'
+test readonly "$@" export test cd done sed --verbose export $(pwd) then test
+then done awk 2>/dev/null export sed && then readonly
+	awk "$@" test 'quoted text' grep "$@" 2>/dev/null printf "$@" echo
+	local readonly cd grep awk 2>/dev/null "$1" | awk
+		sed done sed "$@" readonly "$@" sed -eu grep 2>/dev/null | $(pwd) grep 2>/dev/null
+	done cd "$1" grep test -eu && ${HOME} && export "$1"
+	&& x=1 "$1" x=1 'quoted text' ${HOME}
+${HOME} "$1" grep test local --verbose
+-eu grep "$@" | readonly sed && -eu done done ${HOME}
+		$(pwd) local --verbose grep 2>/dev/null printf | local
+	then test "$1" sed --verbose 2>/dev/null x=1 export then
+&& && --verbose -eu --verbose
+		"$@" -eu $(pwd) -eu local 2>/dev/null 'quoted text'
+		/usr/bin ${HOME} $(pwd) test local local done done --verbose grep awk test
+echo then 'quoted text' "$1" 2>/dev/null test
+		echo readonly awk x=1 grep test 2>/dev/null 'quoted text' "$1" $(pwd) readonly
+then 2>/dev/null "$@" grep "$@" /usr/bin printf
+readonly ${HOME} then "$@" grep then sed done readonly grep 'quoted text'
+		then /usr/bin printf cd sed
+		test grep test sed | /usr/bin echo ${HOME} /usr/bin cd x=1 then
+	"$1" && readonly awk awk 'quoted text' 2>/dev/null export
+	x=1 done | done && awk
+		&& then done && test done printf grep grep 'quoted text'
+done sed $(pwd) -eu printf awk "$@" 'quoted text' readonly
+	$(pwd) export printf local done -eu grep test echo /usr/bin
+		grep printf /usr/bin export --verbose && cd /usr/bin sed /usr/bin
+	cd awk readonly 2>/dev/null | export readonly | --verbose
+		${HOME} x=1 x=1 "$1" && printf done
+	2>/dev/null "$@" | ${HOME}
+	echo grep local -eu && "$@" && x=1 --verbose && 'quoted text'
+then 2>/dev/null grep cd | "$@" then cd awk "$@" done done && sed
+cd ${HOME} ${HOME} ${HOME} local "$1"
+	'quoted text' export then | $(pwd)
+cd grep --verbose | --verbose | "$@" done sed 2>/dev/null --verbose
+		"$@" printf x=1 && sed -eu echo --verbose | printf cd ${HOME} local awk cd
+test --verbose 2>/dev/null awk printf x=1 then 2>/dev/null 2>/dev/null ${HOME}
+$(pwd) x=1 -eu cd -eu | local "$1" export | then $(pwd) | awk "$@"
+		cd 2>/dev/null "$1" 'quoted text' && /usr/bin 2>/dev/null
+local x=1 test awk printf cd export ${HOME} | $(pwd) | "$1" awk $(pwd) -eu
+${HOME} ${HOME} readonly -eu sed 'quoted text'
+"$1" ${HOME} readonly local ${HOME} printf x=1 then ${HOME} printf
+	export $(pwd) export /usr/bin local grep x=1
+	$(pwd) awk echo printf && 2>/dev/null $(pwd) "$1" readonly 2>/dev/null
+	x=1 grep 'quoted text'
+	&& "$1" then echo /usr/bin | cd 'quoted text'
+$(pwd) local readonly ${HOME} grep &&
+		"$@" then cd local ${HOME} test -eu done grep grep | $(pwd) x=1 local
+	"$1" readonly then printf "$@" echo test test echo test cd && x=1 'quoted text'
+	printf /usr/bin echo test test
+x=1 cd grep export -eu export --verbose 2>/dev/null
+x=1 cd 2>/dev/null $(pwd) export local -eu sed then 2>/dev/null
+x=1 printf then local grep printf --verbose done test grep readonly ${HOME} printf
+		grep x=1 awk x=1 then export | sed local awk 2>/dev/null readonly
+		sed x=1 readonly -eu readonly
+	local "$1" awk --verbose
+		printf "$1" readonly done grep
+"$@" x=1 'quoted text' | sed $(pwd) "$@" /usr/bin "$@" x=1 $(pwd) printf
+${HOME} awk "$1" then test ${HOME} echo
+	export readonly $(pwd) "$1"
+	2>/dev/null local readonly | grep local echo ${HOME}
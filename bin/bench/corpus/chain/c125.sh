@@ -0,0 +1,2001 @@
+	printf /usr/bin grep 2>/dev/null --verbose
+$(pwd) x=1 done 2>/dev/null export 2>/dev/null printf "$1" test && awk ${HOME}
+		2>/dev/null "$@" readonly export
+done local | 'quoted text' done grep 2>/dev/null printf &&
+		/usr/bin then done /usr/bin echo echo --verbose
+		x=1 x=1 x=1 | readonly x=1 export cd "$1" 'quoted text'
+	export printf local -eu sed ${HOME} 'quoted text' /usr/bin then "$@"
+		-eu x=1 cd test done cd "$@" cd "$1" 2>/dev/null readonly 2>/dev/null x=1 local
+		| awk ${HOME} then --verbose export --verbose 'quoted text'
+		sed then echo | cd local sed printf sed -eu
+		done | -eu ${HOME} 2>/dev/null grep x=1 grep "$@" ${HOME} grep "$1" "$1" &&
+readonly --verbose printf
+	echo ${HOME} ${HOME} 2>/dev/null
+	awk then /usr/bin awk printf x=1 ${HOME} && --verbose echo --verbose cd
+"$1" -eu "$@" $(pwd) grep printf && then "$1" cd $(pwd)
+		grep grep echo "$@" $(pwd) | printf grep /usr/bin done
+		&& printf cd x=1 cd | -eu awk readonly | 'quoted text' /usr/bin cd
+		awk --verbose readonly x=1 $(pwd) sed done printf awk grep /usr/bin /usr/bin |
+		export $(pwd) $(pwd) printf x=1
+	"$@" 'quoted text' echo 'quoted text' "$1" $(pwd) ${HOME} x=1
+test ${HOME} | export export "$1" sed -eu 2>/dev/null sed "$1" done "$@" then
+| test /usr/bin "$@" then
+test && x=1 test ${HOME} /usr/bin "$@" -eu |
+	grep $(pwd) 2>/dev/null x=1
+"$@" export readonly export | test then test then
+&& local /usr/bin 2>/dev/null awk
+	2>/dev/null | printf cd /usr/bin
+		echo export 'quoted text' printf
+x=1 then | /usr/bin awk sed ${HOME} test cd sed $(pwd) done 'quoted text'
+--verbose sed ${HOME} ${HOME} readonly echo then grep --verbose export readonly
+		sed test 'quoted text' -eu ${HOME} 2>/dev/null done done printf "$1" "$@"
+		-eu test printf awk cd then export cd ${HOME} "$1" /usr/bin ${HOME}
+		local grep && "$@" "$@" 2>/dev/null
+		local printf grep then "$@" "$@"
+| readonly echo x=1 printf done -eu local /usr/bin then printf "$1" ${HOME} test
+		awk x=1 export x=1 | echo --verbose ${HOME} "$1" 2>/dev/null
+	cd then "$1" "$@" $(pwd) -eu then grep sed | echo local echo -eu ${HOME}
+then export --verbose test "$1" cd $(pwd) | echo then
+awk x=1 readonly $(pwd) printf &&
+		"$@" grep test 2>/dev/null /usr/bin readonly
+	cd done cd ${HOME} /usr/bin done /usr/bin --verbose
+		then "$@" && 2>/dev/null echo done $(pwd) readonly echo
+	2>/dev/null "$@" grep sed -eu local
+	awk echo /usr/bin && test export | awk awk
+'quoted text' readonly readonly 'quoted text' sed "$1" -eu test then x=1 'quoted text'
+		"$@" /usr/bin test ${HOME} ${HOME} done awk sed $(pwd)
+	sed --verbose sed sed 2>/dev/null local local local --verbose --verbose "$1" "$1"
+		echo test | then printf awk
+	2>/dev/null awk readonly awk printf sed grep
+	-eu x=1 'quoted text' "$@" test
+2>/dev/null | x=1 done
+local ${HOME} -eu then 2>/dev/null /usr/bin
+	$(pwd) "$1" "$@" done ${HOME} sed sed sed echo && ${HOME}
+"$1" x=1 local "$@" | | --verbose then
+		$(pwd) | 2>/dev/null -eu | "$@" 'quoted text' x=1 awk 'quoted text'
+sed --verbose test && sed local 2>/dev/null --verbose echo && 'quoted text'
+	cd | local $(pwd) -eu 'quoted text' readonly "$@" &&
+awk && export $(pwd) | && 'quoted text' cd $(pwd) --verbose test $(pwd) cd printf
+		grep x=1 test sed grep export cd local
+2>/dev/null && "$1" cd printf 2>/dev/null
+		"$@" grep then sed sed local x=1 /usr/bin export 2>/dev/null
+printf printf local cd --verbose done awk test "$@" grep | ${HOME}
+		/usr/bin 'quoted text' 2>/dev/null cd awk 2>/dev/null 'quoted text' cd done
+	printf -eu 2>/dev/null readonly "$1" awk | "$1" x=1 | then echo export
+awk && test 2>/dev/null -eu "$1" x=1 test "$1" printf
+local -eu done readonly then done | --verbose
+	test 'quoted text' export ${HOME} local local then echo "$@"
+		sed awk readonly "$1" $(pwd) $(pwd)
+		echo $(pwd) done ${HOME} x=1 sed printf x=1 x=1 printf printf --verbose
+	then ${HOME} printf awk
+	grep "$1" x=1 printf awk "$1" cd "$1" "$1" done "$1" sed done cd ${HOME}
+		local "$1" done x=1 sed
+		"$@" 2>/dev/null | | x=1 $(pwd) -eu -eu
+--verbose done local ${HOME} readonly /usr/bin | -eu -eu $(pwd)
+cd 2>/dev/null | "$1" grep /usr/bin x=1 'quoted text'
+&& 'quoted text' --verbose -eu ${HOME} export
+		"$@" then awk export x=1 grep grep awk cd | test sed && cd grep x=1 done "$@"
+	'quoted text' awk | printf
+${HOME} awk && /usr/bin 'quoted text' test $(pwd)
+		done $(pwd) echo && then "$@" -eu grep
+		'quoted text' sed done $(pwd) printf local echo
+	cd grep printf x=1 $(pwd) printf 'quoted text'
+		| test sed local && done | 2>/dev/null local | local sed done grep awk local
+--verbose | && x=1 "$1" export
+	/usr/bin echo readonly awk grep 2>/dev/null
+&& sed ${HOME} 2>/dev/null done 'quoted text' x=1 "$1"
+-eu local printf readonly readonly cd done 'quoted text' local $(pwd) local
+/usr/bin local --verbose readonly && grep ${HOME} echo "$@" cd && && readonly cd
+		| export export test local export grep -eu x=1 test test 'quoted text' cd cd done
+	cd ${HOME} echo awk --verbose echo && && printf $(pwd) test
+	'quoted text' ${HOME} echo awk --verbose then && "$1" x=1
+		&& awk | "$1" $(pwd) 'quoted text' x=1 local "$@" printf
+/usr/bin "$1" readonly awk && then
+then | && sed sed x=1 "$1" 2>/dev/null 2>/dev/null cd "$@" ${HOME} "$1" grep
+"$@" | then then -eu 2>/dev/null awk awk -eu cd --verbose /usr/bin then cd |
+	"$1" "$1" done x=1 awk ${HOME} $(pwd)
+printf x=1 -eu $(pwd) cd -eu "$@" 'quoted text'
+		'quoted text' local then printf 2>/dev/null
+sed test /usr/bin "$@" "$@" cd --verbose x=1 export echo echo | echo --verbose
+	/usr/bin test echo ${HOME} --verbose done sed x=1 awk 2>/dev/null
+		"$1" local cd --verbose
+	-eu printf && awk x=1 "$@" cd ${HOME} readonly
+		then x=1 --verbose printf -eu "$1" | ${HOME}
+	readonly "$1" $(pwd) &&
+		cd "$@" /usr/bin test --verbose
+	${HOME} export awk echo "$1" awk echo cd then sed "$1" test x=1 echo cd
+	"$1" printf --verbose 'quoted text' x=1 then && x=1 local /usr/bin
+		readonly then done echo done 'quoted text'
+	$(pwd) && readonly && export then readonly then x=1
+	&& local readonly then 'quoted text'
+		"$1" readonly echo readonly done | then &&
+test done export done "$1" x=1 test printf ${HOME} /usr/bin -eu
+		$(pwd) awk /usr/bin -eu done 'quoted text'
+	echo --verbose | sed grep local printf readonly export printf
+	"$1" /usr/bin awk awk "$1" test -eu sed ${HOME} x=1
+	/usr/bin 2>/dev/null grep echo 'quoted text' -eu printf local test
+		local test export awk awk grep then $(pwd) 'quoted text'
+then x=1 ${HOME} ${HOME} /usr/bin
+test /usr/bin local test done x=1 x=1 /usr/bin
+	grep readonly done "$1" export then grep cd then --verbose 2>/dev/null | 2>/dev/null
+-eu && $(pwd) 'quoted text' grep && echo /usr/bin -eu
+	test | printf test "$1" /usr/bin
+		'quoted text' local /usr/bin | $(pwd) done test
+	done && 'quoted text' local
+	"$@" ${HOME} echo "$1" ${HOME} done sed cd echo then then 2>/dev/null
+"$1" "$@" "$@" $(pwd) grep export
+awk cd sed && awk printf export readonly /usr/bin /usr/bin 2>/dev/null --verbose
+cd test local then -eu "$1" x=1 'quoted text'
+2>/dev/null | done echo /usr/bin then done local local && grep export export
+--verbose local sed $(pwd) x=1 then grep && "$1" --verbose
+	| printf && printf x=1 awk "$1" ${HOME} $(pwd) readonly grep --verbose
+		grep sed local x=1 sed 'quoted text'
+&& $(pwd) sed "$1" done "$@" awk done 2>/dev/null printf
+		then --verbose -eu sed | /usr/bin
+		export local /usr/bin ${HOME}
+	"$@" awk /usr/bin ${HOME} done -eu local x=1 "$@" done $(pwd) && 'quoted text'
+/usr/bin /usr/bin $(pwd) readonly "$1" &&
+sed --verbose /usr/bin grep readonly ${HOME} done echo then
+	"$1" && cd 'quoted text' readonly x=1 grep | --verbose 'quoted text'
+	echo 'quoted text' test awk -eu ${HOME} done
+	awk $(pwd) then sed done && "$1" export "$@" 'quoted text'
+x=1 cd test echo then x=1 "$@" local done $(pwd) done awk
+		$(pwd) ${HOME} -eu echo done cd echo 'quoted text' "$@" awk -eu && done
+		${HOME} -eu cd $(pwd) printf cd -eu printf sed "$1"
+		readonly sed echo $(pwd) 2>/dev/null && | $(pwd) ${HOME}
+	| 2>/dev/null then | sed printf ${HOME}
+		/usr/bin x=1 printf sed ${HOME} echo "$1" export 'quoted text'
+	2>/dev/null x=1 /usr/bin --verbose 2>/dev/null
+	x=1 readonly 'quoted text' echo local local x=1 printf cd local
+--verbose readonly -eu x=1 && printf
+		x=1 then && export grep cd local
+	&& then done sed then done done 2>/dev/null 2>/dev/null ${HOME}
+	-eu ${HOME} 2>/dev/null grep then $(pwd) "$@" /usr/bin
+'quoted text' echo && $(pwd) --verbose
+		export grep export grep then echo printf printf grep |
+		local done && $(pwd) && export | "$1"
+	echo test "$1" then export x=1 "$1"
+	awk /usr/bin x=1 readonly "$1" x=1 local | grep $(pwd) -eu printf
+	test "$1" | /usr/bin ${HOME} readonly printf | "$1" 'quoted text' grep
+	&& grep done export | "$1" done export "$1" echo readonly cd
+		| --verbose awk /usr/bin echo $(pwd) sed printf ${HOME} $(pwd) /usr/bin
+printf awk cd 'quoted text' cd "$1" /usr/bin cd | then $(pwd)
+	&& /usr/bin x=1 2>/dev/null
+2>/dev/null 'quoted text' $(pwd) ${HOME}
+		-eu && /usr/bin readonly echo /usr/bin grep $(pwd) && ${HOME} 2>/dev/null
+	"$@" /usr/bin && readonly then then
+--verbose "$1" x=1 --verbose --verbose then "$1" cd "$1"
+done $(pwd) "$@" test readonly grep echo
+	--verbose local $(pwd) then readonly done
+		then cd then printf -eu awk echo && printf awk "$@" then then export
+	then "$1" ${HOME} readonly /usr/bin
+-eu $(pwd) sed x=1 then grep done export
+		/usr/bin /usr/bin | awk local x=1 cd ${HOME} readonly
+		done export 'quoted text'
+| printf "$@" then test |
+grep readonly test 'quoted text' 2>/dev/null
+echo then readonly echo done /usr/bin
+		| printf export --verbose done sed test | 'quoted text' readonly grep ${HOME}
+	${HOME} local "$1" x=1 readonly grep $(pwd) readonly "$@" && && echo echo
+/usr/bin "$1" --verbose ${HOME} "$@" then local $(pwd) | printf "$@" grep
+	x=1 "$1" "$@" 'quoted text'
+readonly printf grep cd --verbose /usr/bin && && sed test cd export echo local
+		done && then test "$@" done /usr/bin 2>/dev/null
+		then cd sed printf && "$1" readonly cd && readonly /usr/bin echo export grep
+	"$@" then cd cd test export
+awk --verbose export cd echo 'quoted text'
+	done x=1 sed x=1 2>/dev/null 'quoted text' "$1" export 'quoted text' | $(pwd) "$@"
+		"$1" $(pwd) && cd 2>/dev/null ${HOME} cd export | 'quoted text' "$1" done $(pwd)
+| then $(pwd) && "$@" export 'quoted text' --verbose
+| export | readonly done ${HOME} then /usr/bin --verbose printf /usr/bin
+	grep done sed "$@" | $(pwd) local awk test done 'quoted text'
+	export --verbose echo ${HOME} /usr/bin awk $(pwd)
+	awk then readonly echo grep ${HOME}
+then grep | $(pwd) export cd readonly
+	"$1" echo $(pwd) cd /usr/bin --verbose $(pwd) echo
+x=1 x=1 x=1 awk echo $(pwd) "$@"
+"$@" grep grep then sed printf
+	'quoted text' "$1" cd awk cd ${HOME} grep "$@" cd 2>/dev/null test
+	export sed awk x=1 printf -eu | /usr/bin 2>/dev/null && 'quoted text' && "$@"
+	test export done | local | && 'quoted text'
+		grep then readonly $(pwd) | "$@" ${HOME} sed
+	then awk printf 2>/dev/null $(pwd) "$1" export sed sed
+	cd awk "$1" /usr/bin
+		printf done 2>/dev/null then local test ${HOME} | grep --verbose /usr/bin
+	cd -eu awk sed "$@" ${HOME} "$@"
+	2>/dev/null readonly "$@" $(pwd)
+grep awk grep then sed readonly export -eu
+	echo --verbose -eu test then export local
+grep -eu "$1" /usr/bin -eu 'quoted text' && local done cd readonly echo $(pwd)
+	${HOME} done 2>/dev/null ${HOME} printf /usr/bin
+local printf ${HOME} --verbose
+	echo 2>/dev/null 2>/dev/null cd -eu x=1 2>/dev/null
+	/usr/bin grep "$@" ${HOME} ${HOME} awk 'quoted text' awk sed /usr/bin
+	readonly x=1 cd "$1" export -eu $(pwd) cd && x=1 "$1"
+&& && printf printf 2>/dev/null grep
+"$@" /usr/bin $(pwd) echo /usr/bin ${HOME} x=1 cd sed
+	-eu echo export $(pwd) cd $(pwd) printf
+		$(pwd) 'quoted text' 'quoted text' readonly
+		export export 2>/dev/null awk export
+	| sed cd ${HOME} test ${HOME} x=1 'quoted text' printf echo -eu
+sed printf awk grep readonly "$1"
+"$@" /usr/bin "$@" ${HOME} "$@"
+		echo local done done $(pwd)
+		test x=1 'quoted text' printf echo 'quoted text' ${HOME} -eu local sed x=1 readonly
+		cd then cd done awk "$@" printf --verbose --verbose -eu && awk local then
+2>/dev/null printf then local && echo x=1 "$1" awk | | | awk cd
+		test cd | cd x=1 /usr/bin
+	-eu cd export --verbose echo && /usr/bin -eu 'quoted text'
+	$(pwd) /usr/bin grep x=1 grep readonly "$@" /usr/bin | awk sed
+	-eu export done echo -eu "$1" then done | -eu 2>/dev/null
+| echo "$@" then | echo grep printf echo 'quoted text'
+		--verbose $(pwd) -eu 'quoted text' done then readonly 2>/dev/null export awk
+	echo x=1 echo && grep $(pwd) test x=1 readonly --verbose then export
+	readonly 2>/dev/null export "$@" grep --verbose x=1 /usr/bin
+	printf sed sed local | --verbose -eu "$@" --verbose /usr/bin printf printf awk --verbose
+| test echo 2>/dev/null test $(pwd)
+	-eu "$@" "$@" then grep /usr/bin "$@" 2>/dev/null
+	x=1 $(pwd) "$@" | x=1 export ${HOME}
+		$(pwd) x=1 then -eu sed sed && test readonly /usr/bin echo
+	readonly | -eu --verbose grep echo readonly && local sed awk
+		local done sed --verbose printf printf done && x=1
+cd local local cd grep grep
+	done ${HOME} x=1 --verbose /usr/bin && printf
+sed | | awk cd awk grep 'quoted text' awk export | 'quoted text' 2>/dev/null
+	export && "$1" ${HOME} done "$@" grep local
+/usr/bin grep "$1" then printf -eu printf grep
+--verbose 'quoted text'
+/usr/bin -eu ${HOME} && printf done grep echo export done /usr/bin
+	-eu echo "$1" && cd export x=1
+		2>/dev/null grep "$1" /usr/bin && export
+	"$@" cd readonly done test "$1" --verbose readonly grep
+readonly "$1" grep $(pwd)
+| x=1 $(pwd) && then done -eu
+		-eu "$1" export export then ${HOME} -eu readonly x=1 export 'quoted text'
+		x=1 export done 2>/dev/null awk x=1 local printf local |
+readonly /usr/bin sed "$@" printf 2>/dev/null cd then /usr/bin x=1 "$1"
+		${HOME} && readonly 'quoted text'
+		done then 'quoted text' local --verbose
+sed 'quoted text' grep test 'quoted text' | sed -eu --verbose --verbose test /usr/bin
+	"$@" then "$@" done awk printf 'quoted text' local
+		test awk then echo "$1" x=1 sed grep --verbose -eu
+cd cd | 2>/dev/null echo printf -eu 'quoted text' readonly -eu then
+		2>/dev/null grep printf x=1
+	local done 2>/dev/null "$@" 2>/dev/null $(pwd) 'quoted text' grep --verbose
+	cd test ${HOME} grep "$@" 'quoted text' done awk /usr/bin
+	grep done then awk $(pwd) done export
+/usr/bin "$@" printf readonly then 'quoted text' sed sed
+	--verbose | grep x=1 local /usr/bin ${HOME} 2>/dev/null "$@"
+		then | test && readonly
+	--verbose ${HOME} export && 'quoted text' 2>/dev/null
+		export local ${HOME}
+		"$1" grep test 'quoted text' x=1
+grep $(pwd) sed sed $(pwd) awk export --verbose "$@" then x=1
+done "$@" --verbose readonly printf 2>/dev/null
+printf && echo awk echo export -eu
+	x=1 sed then printf /usr/bin printf 'quoted text'
+sed grep $(pwd) printf "$1" && export export ${HOME} /usr/bin echo
+-eu 'quoted text' test ${HOME} | $(pwd) sed
+		test then | export cd then
+		then local ${HOME} 'quoted text'
+x=1 --verbose | --verbose --verbose x=1 local "$1" && echo readonly
+| echo -eu done 'quoted text' grep echo local
+	&& readonly local --verbose
+-eu ${HOME} x=1 'quoted text' $(pwd)
+	-eu local awk 2>/dev/null local
+	2>/dev/null --verbose "$1" awk local -eu 2>/dev/null "$1" ${HOME}
+	readonly x=1 test "$@" 2>/dev/null then 'quoted text' | awk grep "$1" && x=1
+	sed done then 2>/dev/null 'quoted text' "$@"
+/usr/bin x=1 local | awk then
+echo test x=1 printf done --verbose printf ${HOME}
+| --verbose | local test grep printf ${HOME}
+-eu -eu && readonly local "$@" 2>/dev/null
+	done test then /usr/bin "$@" sed grep x=1 echo /usr/bin /usr/bin 'quoted text'
+cd awk && /usr/bin 'quoted text' sed ${HOME}
+	grep done done $(pwd) export done
+	readonly cd | 2>/dev/null
+		test done done /usr/bin done x=1 /usr/bin x=1 -eu x=1 awk "$1" ${HOME}
+		| -eu then readonly | 2>/dev/null -eu
+	"$1" "$1" local "$1" && done
+		-eu $(pwd) awk cd printf local -eu $(pwd) echo /usr/bin then export -eu local awk
+	export done grep local local | | test printf 2>/dev/null export test
+	awk echo then -eu && $(pwd) readonly grep awk local cd 2>/dev/null test
+		/usr/bin echo export x=1 local
+	echo done && readonly -eu 2>/dev/null printf 2>/dev/null $(pwd) readonly
+		x=1 $(pwd) readonly then x=1 done
+	| /usr/bin then 2>/dev/null ${HOME} /usr/bin --verbose
+		x=1 done export readonly 2>/dev/null readonly 'quoted text'
+	grep --verbose export export ${HOME} printf readonly 'quoted text' &&
+| cd ${HOME} grep echo 'quoted text' "$@" local cd
+		test 'quoted text' --verbose /usr/bin
+	2>/dev/null echo done local "$1" 2>/dev/null 2>/dev/null
+	export echo | ${HOME} $(pwd)
+printf then done test echo then "$1"
+"$1" | /usr/bin done x=1 x=1 sed $(pwd) grep --verbose
+		"$@" done $(pwd) -eu export && | export cd cd | $(pwd) "$@" /usr/bin printf
+sed then /usr/bin printf printf test sed | sed ${HOME} x=1 "$@" && awk cd echo &&
+	local done "$1" /usr/bin test x=1 x=1 "$1" echo
+		local --verbose | printf export --verbose -eu
+"$@" grep /usr/bin printf && printf "$@" && echo | $(pwd) -eu 'quoted text'
+		then /usr/bin cd "$1" | $(pwd) cd cd "$1" printf 2>/dev/null cd && "$1"
+	"$1" /usr/bin "$@" /usr/bin local cd 'quoted text' x=1
+	cd test /usr/bin 'quoted text' "$@" done test sed printf printf --verbose cd
+'quoted text' printf readonly sed -eu --verbose 2>/dev/null awk done
+		test 'quoted text' readonly grep --verbose export $(pwd) printf && $(pwd)
+cd ${HOME} grep done sed awk x=1 readonly /usr/bin echo sed grep readonly | done
+	${HOME} cd sed "$@" --verbose -eu echo "$1" x=1 "$1" $(pwd) test
+		${HOME} | ${HOME} grep
+'quoted text' then $(pwd) | cd sed export -eu /usr/bin grep ${HOME} awk
+		local "$1" /usr/bin x=1 grep done readonly && 2>/dev/null 'quoted text'
+-eu done "$@" ${HOME} local then 'quoted text' /usr/bin $(pwd) export --verbose
+	awk sed sed awk "$1" echo sed done 'quoted text' "$1"
+printf done then $(pwd) grep cd export
+		/usr/bin 2>/dev/null --verbose then $(pwd) && ${HOME} printf grep
+2>/dev/null export export export export
+		| $(pwd) --verbose --verbose export export printf "$1" test
+		sed "$1" "$@" printf grep | printf $(pwd) printf x=1 awk && export | ${HOME}
+	--verbose done echo done ${HOME} "$@" --verbose cd test echo
+readonly printf cd 2>/dev/null "$@" | -eu $(pwd) -eu | ${HOME}
+/usr/bin $(pwd) 'quoted text' -eu echo ${HOME}
+		"$1" cd /usr/bin then echo $(pwd)
+awk printf ${HOME} then | echo done 2>/dev/null test cd 2>/dev/null
+$(pwd) x=1 | readonly x=1 --verbose
+	'quoted text' /usr/bin sed export -eu test awk "$1" | /usr/bin
+	$(pwd) done $(pwd) "$@" 'quoted text' cd
+readonly --verbose && cd 'quoted text' 'quoted text'
+/usr/bin local && /usr/bin 'quoted text' printf | readonly
+	done $(pwd) 2>/dev/null echo x=1 export export "$@" "$1" echo done 2>/dev/null
+	--verbose grep printf sed echo printf /usr/bin "$1"
+-eu 2>/dev/null "$1" test "$@" sed
+		grep readonly echo echo
+	--verbose awk ${HOME} x=1 $(pwd) "$1" -eu "$1" sed -eu cd grep | export
+		cd /usr/bin "$1" /usr/bin export test x=1 awk echo
+		"$@" --verbose export grep then echo printf then "$@" /usr/bin export && -eu
+awk -eu local x=1 cd 2>/dev/null x=1 x=1 "$@" | export "$1"
+test --verbose 2>/dev/null sed echo x=1 --verbose
+		local then readonly $(pwd)
+	"$1" then then 2>/dev/null echo 'quoted text' && test done printf readonly
+readonly sed --verbose readonly sed test local sed "$@" -eu
+&& "$1" local | then x=1
+	echo test echo --verbose
+	x=1 2>/dev/null "$1" && --verbose ${HOME} "$1" 'quoted text' done
+	echo && sed | readonly $(pwd) awk -eu /usr/bin cd $(pwd)
+$(pwd) | $(pwd) local grep cd local printf x=1 done echo
+'quoted text' done 2>/dev/null -eu "$@" x=1 grep | ${HOME}
+		${HOME} --verbose /usr/bin
+	$(pwd) echo 'quoted text' cd cd grep
+	then --verbose export sed readonly
+	grep printf cd x=1 $(pwd) && $(pwd) -eu "$1"
+		then 2>/dev/null --verbose then ${HOME} "$@" awk awk cd 'quoted text'
+		then "$1" readonly && "$@"
+grep printf grep "$@" echo /usr/bin echo x=1 grep sed ${HOME} printf
+		"$1" done done printf 'quoted text'
+	x=1 --verbose /usr/bin sed
+sed local && awk then then then 2>/dev/null echo $(pwd) awk
+		2>/dev/null -eu echo ${HOME}
+	/usr/bin ${HOME} done grep local ${HOME} grep printf export $(pwd) then
+		test /usr/bin ${HOME} 2>/dev/null printf cd echo "$@" sed local
+	| sed && sed 'quoted text'
+cd sed cd grep && echo --verbose /usr/bin
+	&& sed sed 'quoted text' test then --verbose then cd | test local
+		cd | x=1 ${HOME} "$@" 'quoted text' "$@" test printf grep printf 'quoted text'
+		$(pwd) ${HOME} then "$1" test test grep cd done done /usr/bin
+--verbose sed | && echo x=1 printf grep grep
+	/usr/bin echo 2>/dev/null then
+	test echo /usr/bin then $(pwd) 'quoted text' 'quoted text'
+		cd --verbose | "$@" 'quoted text'
+	2>/dev/null --verbose | "$1"
+'quoted text' local cd /usr/bin "$1" 'quoted text' local
+		-eu 2>/dev/null done ${HOME}
+		2>/dev/null "$1" 2>/dev/null awk
+	cd x=1 cd $(pwd) echo printf ${HOME}
+	${HOME} printf cd done --verbose cd x=1 awk x=1 /usr/bin /usr/bin
+export 2>/dev/null export "$1" && readonly
+		| && readonly ${HOME} /usr/bin readonly x=1 /usr/bin
+		x=1 'quoted text' 'quoted text'
+		sed printf local test test | "$@" printf x=1 cd "$@" -eu 2>/dev/null 2>/dev/null
+| $(pwd) test ${HOME} $(pwd) echo
+	"$@" sed readonly -eu ${HOME} "$1" | 'quoted text' ${HOME} $(pwd)
+--verbose && --verbose echo cd /usr/bin printf cd "$@" "$@" /usr/bin
+	-eu sed 'quoted text' local --verbose &&
+		echo && test | echo /usr/bin echo test
+	done --verbose /usr/bin --verbose cd awk 'quoted text' sed then 2>/dev/null
+$(pwd) awk 'quoted text' readonly "$1"
+-eu export "$@" -eu /usr/bin
+		'quoted text' 'quoted text' /usr/bin cd done then export /usr/bin then
+-eu && awk "$1" --verbose echo 'quoted text' done then cd local "$@" awk
+	printf echo $(pwd) 'quoted text' | &&
+	then /usr/bin x=1 $(pwd) ${HOME} test local "$@" $(pwd)
+		2>/dev/null 2>/dev/null --verbose
+&& -eu then readonly && -eu echo
+"$1" grep 'quoted text' grep /usr/bin /usr/bin export "$1" -eu | printf
+	"$@" x=1 "$1" done | /usr/bin cd 2>/dev/null
+		--verbose then readonly sed x=1 ${HOME}
+readonly | export sed | sed 'quoted text' $(pwd) sed awk test
+local 'quoted text' local /usr/bin /usr/bin $(pwd) /usr/bin
+	&& awk cd readonly export 2>/dev/null
+		readonly 'quoted text' &&
+	echo printf export cd $(pwd) 2>/dev/null
+		| test /usr/bin --verbose -eu
+		/usr/bin "$@" readonly --verbose grep readonly echo echo
+	/usr/bin --verbose -eu done --verbose printf ${HOME} $(pwd) -eu
+cd | && "$@" export then printf export printf x=1
+	readonly -eu --verbose "$@" /usr/bin awk local test && echo cd -eu
+grep grep $(pwd) cd && 2>/dev/null /usr/bin
+	local "$@" x=1 && readonly printf x=1 && readonly done x=1 ${HOME}
+2>/dev/null printf awk | && sed then
+		grep -eu x=1 local then 2>/dev/null && cd "$@" && cd
+	printf then test printf ${HOME} | | /usr/bin --verbose then cd cd cd "$1" local
+		/usr/bin sed done /usr/bin "$1" ${HOME} awk | printf 'quoted text' && /usr/bin
+	--verbose $(pwd) readonly 2>/dev/null echo cd | grep x=1 done test | awk
+| sed local /usr/bin -eu
+$(pwd) printf ${HOME} | --verbose done awk 'quoted text' --verbose $(pwd)
+	x=1 -eu export then "$1" printf 'quoted text'
+sed "$@" $(pwd) echo && | done export
+		echo printf sed done sed $(pwd) done export cd done local -eu x=1 x=1 grep local
+readonly 2>/dev/null test -eu -eu sed then grep "$1" then 2>/dev/null
+	done cd test ${HOME} -eu readonly | 2>/dev/null printf
+sed cd local x=1 local --verbose && printf echo grep test -eu 2>/dev/null
+		sed then "$@" "$@" grep awk grep | sed grep &&
+--verbose /usr/bin ${HOME} grep done sed done 2>/dev/null /usr/bin ${HOME}
+	done grep /usr/bin local
+then sed printf echo --verbose grep sed "$1" then | "$1" awk local
+		local awk grep "$@" test local
+test ${HOME} 2>/dev/null 'quoted text' local --verbose
+grep test 2>/dev/null /usr/bin awk 2>/dev/null
+		test -eu export sed ${HOME} sed && awk 2>/dev/null echo test test cd
+export grep readonly ${HOME}
+		/usr/bin "$@" $(pwd) 2>/dev/null done sed "$1" -eu | -eu test /usr/bin -eu grep
+printf -eu /usr/bin /usr/bin
+$(pwd) x=1 2>/dev/null -eu /usr/bin $(pwd)
+	${HOME} | "$1" local "$1"
+echo export ${HOME} -eu --verbose local export local echo -eu grep -eu printf
+	awk echo sed -eu cd x=1 'quoted text' "$@"
+	/usr/bin awk | awk local --verbose cd 'quoted text' /usr/bin test
+		cd /usr/bin $(pwd) local export 2>/dev/null --verbose "$1"
+	local ${HOME} "$1" local | readonly readonly "$@" x=1 then "$1"
+	--verbose local --verbose -eu local "$1" 2>/dev/null export
+	awk /usr/bin && 2>/dev/null export $(pwd)
+		export printf /usr/bin test export 2>/dev/null | "$@" -eu local --verbose
+	${HOME} readonly local cd /usr/bin printf ${HOME} x=1
+		done 2>/dev/null /usr/bin cd && /usr/bin awk "$1" grep 'quoted text' export -eu
+"$1" x=1 done "$@" "$@" && ${HOME} echo /usr/bin
+		&& grep sed "$@" readonly sed grep export x=1
+	"$1" | grep -eu sed local export
+	then -eu 2>/dev/null | echo 2>/dev/null && echo echo "$1"
+	export && cd ${HOME} awk local done printf awk printf then 'quoted text'
+| test $(pwd) test --verbose
+| -eu ${HOME} test --verbose
+${HOME} test x=1 grep 'quoted text' /usr/bin grep ${HOME} then printf $(pwd)
+readonly printf grep && /usr/bin $(pwd)
+		${HOME} then readonly echo
+		sed then "$@" done readonly echo test grep export then 2>/dev/null $(pwd)
+cd printf --verbose then readonly
+		local ${HOME} export readonly
+	echo && /usr/bin sed export sed local "$@" $(pwd) cd ${HOME} export cd
+test readonly 2>/dev/null awk /usr/bin test
+		${HOME} awk readonly --verbose local test awk echo awk /usr/bin --verbose /usr/bin
+	printf then && local done x=1 test test then /usr/bin ${HOME} printf sed
+		awk printf "$@" --verbose | done "$@" -eu "$1" local "$@" /usr/bin --verbose
+| "$1" && "$@" && "$@" /usr/bin export $(pwd)
+	done awk --verbose x=1 test awk -eu grep -eu && 'quoted text'
+test | local grep ${HOME} 'quoted text'
+		"$@" x=1 $(pwd) 'quoted text' cd printf cd x=1 grep -eu "$1" then && local
+sed test awk x=1 -eu local && | 2>/dev/null 'quoted text' "$1" | sed cd readonly
+${HOME} then --verbose 'quoted text' test readonly
+		cd done readonly ${HOME} local -eu $(pwd) ${HOME} -eu
+	export printf sed readonly $(pwd) "$@" "$@" done ${HOME} readonly
+		echo export | then sed local export export sed $(pwd) --verbose
+--verbose "$1" readonly readonly printf local ${HOME}
+2>/dev/null export "$1" | printf printf 2>/dev/null -eu "$1" grep export
+	--verbose --verbose /usr/bin "$1" grep awk printf
+	export test "$@" readonly test grep 2>/dev/null 'quoted text' -eu export ${HOME}
+${HOME} "$1" echo then done cd | -eu 2>/dev/null
+	readonly export awk then cd done "$@" -eu local printf local
+--verbose then 2>/dev/null awk then printf test --verbose done echo --verbose
+--verbose then /usr/bin /usr/bin echo ${HOME}
+echo "$1" test done export && -eu sed cd 'quoted text'
+	x=1 sed grep test x=1 2>/dev/null /usr/bin $(pwd) $(pwd) printf "$@" grep
+	then 'quoted text' test grep test local awk && && "$@" ${HOME} sed sed 2>/dev/null
+echo grep | then && --verbose test ${HOME} 'quoted text' --verbose
+${HOME} --verbose printf && ${HOME} "$@" && echo
+		readonly ${HOME} echo cd awk then printf printf done
+-eu ${HOME} local -eu export && ${HOME} readonly done then export "$1" "$@"
+		readonly | awk "$1" --verbose ${HOME} export "$@" 2>/dev/null
+${HOME} sed && readonly echo | 'quoted text'
+'quoted text' && local test readonly 'quoted text' | printf
+		export printf echo x=1 | -eu awk awk sed $(pwd) test done "$1"
+		cd --verbose export --verbose /usr/bin readonly sed done "$1" grep readonly
+	"$@" $(pwd) $(pwd) echo $(pwd) then awk
+		${HOME} ${HOME} test export
+awk grep awk sed --verbose x=1 cd "$@" 'quoted text' grep 2>/dev/null printf
+		$(pwd) x=1 /usr/bin x=1 -eu printf 2>/dev/null
+$(pwd) done test then local export readonly --verbose
+then && grep then readonly
+	x=1 readonly export then 2>/dev/null test ${HOME} 2>/dev/null local -eu | 'quoted text'
+| --verbose printf cd --verbose printf && awk $(pwd) test echo readonly done
+	$(pwd) && "$@" awk awk --verbose 'quoted text'
+		"$@" sed -eu ${HOME} "$1"
+		echo grep "$1" grep "$1" sed /usr/bin grep 2>/dev/null /usr/bin
+local grep && printf "$1" "$1" x=1 export awk -eu
+	"$1" sed "$1" grep 2>/dev/null then ${HOME} 'quoted text'
+		2>/dev/null sed && 'quoted text' ${HOME} 2>/dev/null
+		x=1 test 'quoted text' grep "$@" export printf ${HOME} readonly
+	&& -eu test then --verbose 'quoted text' grep x=1 x=1
+	cd "$1" then echo 2>/dev/null
+	-eu grep test 'quoted text'
+	done echo x=1 | /usr/bin "$1" printf sed sed sed ${HOME} export ${HOME} done
+	-eu ${HOME} readonly x=1 -eu ${HOME} then echo readonly
+--verbose x=1 sed awk test done --verbose | /usr/bin
+		done awk "$@" && then 'quoted text' "$@" sed "$1" --verbose test
+done x=1 "$1" echo 'quoted text'
+		test --verbose ${HOME} test x=1 -eu 'quoted text' 2>/dev/null
+		| /usr/bin printf ${HOME} sed | export test "$1" sed
+		2>/dev/null "$1" readonly "$1" awk local test echo done readonly -eu
+${HOME} test -eu x=1 'quoted text' grep --verbose then export $(pwd)
+"$1" x=1 x=1 | --verbose
+'quoted text' "$1" test readonly x=1 $(pwd) 2>/dev/null
+	then echo cd "$1" readonly
+	${HOME} 2>/dev/null /usr/bin --verbose
+		x=1 /usr/bin then awk readonly local && awk readonly /usr/bin 2>/dev/null
+'quoted text' readonly x=1 grep
+	x=1 awk sed grep done sed
+'quoted text' "$1" "$@" test --verbose echo
+	test echo export local done awk
+/usr/bin echo ${HOME} | 'quoted text' ${HOME} test
+export x=1 x=1 'quoted text'
+	awk test 'quoted text' && grep readonly 2>/dev/null "$@"
+'quoted text' grep test "$1" echo then 2>/dev/null grep local sed && cd "$1" cd
+		grep -eu "$1" | local awk printf readonly test x=1 ${HOME}
+		test && test "$@" -eu | --verbose echo cd local test && cd -eu $(pwd)
+	awk awk export local awk done "$@" 'quoted text' && printf done awk
+	${HOME} export /usr/bin printf 2>/dev/null ${HOME} "$@"
+		cd grep -eu && && "$1" test done 2>/dev/null 'quoted text' --verbose --verbose
+&& /usr/bin test -eu readonly awk "$1" local ${HOME}
+"$@" ${HOME} then printf sed cd
+done ${HOME} x=1 readonly -eu export "$@" echo 2>/dev/null | /usr/bin
+		grep grep sed $(pwd) echo printf sed local --verbose local export
+	"$@" test cd /usr/bin "$1" local /usr/bin
+		echo -eu export --verbose --verbose | local "$1" readonly then
+		--verbose && readonly -eu
+		x=1 test export | export
+readonly grep local sed ${HOME}
+	${HOME} "$@" "$1" local grep test | printf $(pwd) sed /usr/bin ${HOME} | "$@" ${HOME}
+		grep /usr/bin awk cd 2>/dev/null
+awk readonly export 'quoted text' ${HOME} awk readonly test -eu
+		2>/dev/null && "$1" then "$@" echo | ${HOME}
+	export done && /usr/bin cd sed cd | awk --verbose test echo x=1 done /usr/bin
+	local printf && grep grep export 'quoted text' echo then $(pwd)
+"$1" /usr/bin echo x=1 sed readonly echo then
+		printf 2>/dev/null --verbose cd printf /usr/bin cd /usr/bin
+/usr/bin done $(pwd) --verbose test readonly echo printf printf local
+	cd && x=1 then awk "$1" readonly readonly
+	-eu 2>/dev/null local awk 'quoted text' cd echo local
+| export done "$1" | export test sed && $(pwd) "$@" && 2>/dev/null
+		then cd then local readonly | export done export 'quoted text' local
+echo local /usr/bin --verbose 2>/dev/null 'quoted text'
+| cd cd -eu test local test /usr/bin
+cd done grep echo 'quoted text' "$1" /usr/bin
+sed && "$@" echo sed printf 2>/dev/null &&
+	then test done -eu && grep --verbose
+then /usr/bin --verbose test local ${HOME} --verbose local cd /usr/bin
+"$@" | grep echo local ${HOME} echo test /usr/bin readonly && "$1" $(pwd)
+		test "$@" | x=1 then "$1" cd 2>/dev/null 2>/dev/null
+		echo then echo ${HOME} done | "$1"
+		local | && printf -eu | ${HOME} ${HOME}
+then awk -eu echo --verbose $(pwd) "$@" test
+"$@" 2>/dev/null awk "$1" ${HOME} export local "$1" echo
+printf ${HOME} cd "$1" test --verbose x=1 && -eu | echo 2>/dev/null
+printf printf sed local done grep local then 2>/dev/null 'quoted text' |
+		sed --verbose -eu ${HOME} echo -eu cd --verbose $(pwd) && test &&
+		export awk -eu local awk readonly $(pwd) 2>/dev/null x=1 then cd
+x=1 'quoted text' readonly "$@" sed printf test -eu echo $(pwd) grep then export
+	2>/dev/null "$1" ${HOME}
+grep export "$1" local local x=1 'quoted text' $(pwd) /usr/bin
+		local && test printf printf sed export local /usr/bin x=1 -eu x=1 done
+	then ${HOME} done -eu test x=1 -eu cd ${HOME}
+		2>/dev/null local test $(pwd) "$1" printf local
+&& test printf /usr/bin $(pwd)
+	cd ${HOME} export test |
+	test local 2>/dev/null printf x=1 grep
+		done -eu --verbose readonly done printf --verbose sed 2>/dev/null then
+	2>/dev/null test x=1 export grep local /usr/bin x=1 2>/dev/null test
+		test sed export x=1 sed $(pwd) ${HOME} then --verbose 2>/dev/null printf
+-eu -eu $(pwd) | x=1 done $(pwd) awk local /usr/bin &&
+		then cd "$@" --verbose
+"$1" cd /usr/bin cd | then ${HOME} sed -eu $(pwd) printf export "$@" export
+/usr/bin readonly local export 'quoted text' /usr/bin 'quoted text'
+done "$1" printf then echo
+	sed test cd 2>/dev/null -eu sed
+	-eu $(pwd) awk 2>/dev/null
+| local "$@" ${HOME} && readonly
+--verbose test done test | then
+	awk | --verbose /usr/bin 2>/dev/null "$1" sed "$1" echo "$@" |
+	local local x=1 cd cd "$@" readonly then
+	grep export 2>/dev/null "$@" echo x=1 echo
+	-eu test "$1" readonly "$1" 'quoted text' sed export ${HOME} echo awk $(pwd)
+	| awk "$@" cd awk awk x=1 x=1 cd 2>/dev/null
+	/usr/bin done x=1 /usr/bin grep 2>/dev/null ${HOME} awk -eu printf
+		2>/dev/null 'quoted text' -eu /usr/bin test printf test | /usr/bin
+local "$@" && sed ${HOME} cd readonly cd && readonly
+		x=1 test export | "$@" /usr/bin 2>/dev/null local --verbose $(pwd) awk
+		cd /usr/bin echo grep printf then local then awk ${HOME} grep
+test printf readonly local ${HOME} $(pwd) ${HOME} -eu cd sed $(pwd)
+	export $(pwd) $(pwd)
+	readonly && --verbose readonly sed "$@" --verbose
+awk grep /usr/bin echo 'quoted text' | -eu 2>/dev/null
+test $(pwd) readonly cd && /usr/bin /usr/bin echo && --verbose echo
+	awk --verbose echo | export
+		'quoted text' printf x=1 printf then && $(pwd)
+		printf printf 2>/dev/null "$1" readonly -eu printf then grep "$@"
+		2>/dev/null 'quoted text' done $(pwd)
+cd done done echo printf sed $(pwd) done
+2>/dev/null then "$1" done -eu
+		| x=1 readonly && --verbose
+done --verbose ${HOME} test
+| printf "$1" awk /usr/bin 2>/dev/null $(pwd)
+		'quoted text' /usr/bin $(pwd) grep printf 2>/dev/null ${HOME} "$1" echo test done
+printf 2>/dev/null --verbose "$@" ${HOME} $(pwd)
+	echo done | printf cd ${HOME} then 2>/dev/null "$@" test done test cd echo | cd
+&& grep && sed awk export /usr/bin 'quoted text'
+then then sed export cd
+"$@" readonly then readonly
+		readonly cd export 2>/dev/null 2>/dev/null cd then --verbose
+printf 'quoted text' readonly
+test | cd echo --verbose
+	echo grep "$1" readonly readonly local && "$1" readonly 2>/dev/null done grep
+local -eu grep then grep local cd
+	"$1" cd && cd sed readonly test local 2>/dev/null 2>/dev/null && local "$1" --verbose
+	then readonly then --verbose 'quoted text' local readonly
+	${HOME} ${HOME} x=1 && "$@" export "$@" && readonly $(pwd) && readonly
+x=1 done export local then 'quoted text' printf 'quoted text'
+&& cd grep readonly done x=1 "$1"
+		x=1 test printf printf
+"$@" ${HOME} 2>/dev/null readonly 2>/dev/null "$@" echo 'quoted text' local sed
+	echo "$1" local && readonly
+	test ${HOME} grep readonly -eu echo 'quoted text'
+sed test 2>/dev/null then | done --verbose && ${HOME} test x=1 local "$1" done
+	$(pwd) done 'quoted text' echo then done /usr/bin /usr/bin
+	printf export "$1" && /usr/bin echo 'quoted text' 'quoted text' "$@"
+		2>/dev/null readonly 'quoted text' done done -eu --verbose -eu 2>/dev/null
+		&& printf $(pwd) then x=1 sed | awk -eu | sed
+"$@" sed readonly | printf printf awk sed export 2>/dev/null
+/usr/bin grep echo "$1" awk x=1 $(pwd) x=1 x=1 &&
+	"$1" printf 'quoted text' readonly -eu 'quoted text' grep cd -eu
+		export | $(pwd) cd local ${HOME} awk --verbose then 2>/dev/null export
+	cd | $(pwd) /usr/bin awk then printf grep $(pwd) x=1 "$1" sed then x=1 2>/dev/null
+	printf "$1" done 'quoted text' echo then
+	&& awk $(pwd) && readonly readonly --verbose | test test $(pwd)
+printf awk x=1 $(pwd) grep echo cd
+	done "$@" grep /usr/bin test /usr/bin
+		'quoted text' grep then printf "$1"
+	sed "$1" "$@" ${HOME} "$@" x=1
+	| then x=1 /usr/bin x=1 2>/dev/null done ${HOME} 'quoted text' 2>/dev/null
+2>/dev/null ${HOME} test readonly local
+"$1" --verbose echo "$1" echo $(pwd) cd cd && 'quoted text'
+	echo | then sed "$1" 2>/dev/null
+test "$@" cd "$1" "$@" --verbose cd echo local /usr/bin
+echo -eu && then "$1" $(pwd) test ${HOME} x=1 $(pwd) &&
+	readonly /usr/bin awk ${HOME}
+	${HOME} sed echo && echo x=1 /usr/bin done
+	sed then /usr/bin echo | | local /usr/bin
+&& 'quoted text' echo echo sed "$1"
+		test && grep ${HOME} awk export export test 'quoted text' cd "$1"
+readonly sed done then /usr/bin
+	export printf echo printf grep then done "$@" 2>/dev/null
+	${HOME} 'quoted text' printf export readonly cd cd
+	2>/dev/null printf --verbose "$@" "$@" -eu local cd test && grep awk printf
+"$@" cd -eu done grep x=1 x=1 ${HOME} grep export /usr/bin
+		export x=1 $(pwd) export awk printf
+	grep "$1" && --verbose cd
+	echo -eu "$@" grep ${HOME} awk grep 'quoted text'
+		-eu ${HOME} export /usr/bin sed /usr/bin "$1" | && | "$@" test 2>/dev/null
+readonly && -eu awk sed && && $(pwd) --verbose sed done
+	printf x=1 echo ${HOME} --verbose cd export $(pwd)
+	export printf && && echo "$1" /usr/bin done cd 2>/dev/null
+	awk cd "$@" readonly | ${HOME} "$@"
+"$1" cd | 'quoted text' 'quoted text' awk
+x=1 awk | export sed ${HOME} local $(pwd) | "$@" export echo
+	then x=1 done 'quoted text' $(pwd) test && printf awk cd sed then
+then done printf printf $(pwd)
+local x=1 /usr/bin ${HOME} sed awk -eu sed "$@" ${HOME} $(pwd) ${HOME}
+	done test $(pwd) readonly then sed 2>/dev/null
+		$(pwd) export | sed 'quoted text' && cd 'quoted text'
+		then && grep then --verbose ${HOME}
+	--verbose -eu $(pwd) -eu awk printf awk
+awk grep cd then readonly 'quoted text' grep "$1" done
+	$(pwd) /usr/bin | x=1 sed 2>/dev/null
+readonly /usr/bin export awk && && ${HOME} local cd awk 'quoted text'
+	echo export | "$@" awk printf ${HOME} -eu ${HOME} then 'quoted text' printf
+	cd awk | printf printf
+		awk x=1 test printf | export cd 2>/dev/null grep ${HOME}
+-eu then x=1 /usr/bin local | grep
+	local "$@" x=1 'quoted text' --verbose printf | $(pwd) --verbose -eu
+		echo awk "$@" 'quoted text' x=1
+		$(pwd) local then cd local done done cd cd /usr/bin done
+		--verbose printf grep 'quoted text'
+"$@" | 'quoted text' sed grep readonly cd -eu 2>/dev/null "$@" x=1 -eu printf
+	-eu local sed x=1 "$@" test x=1 2>/dev/null test sed
+awk readonly "$@" | "$@" 'quoted text' cd
+		$(pwd) 'quoted text' done --verbose
+-eu "$1" then awk /usr/bin $(pwd) &&
+$(pwd) && export && && /usr/bin x=1 2>/dev/null "$@" 2>/dev/null $(pwd)
+	x=1 2>/dev/null "$@" export test 2>/dev/null test
+| 'quoted text' "$1"
+		-eu awk "$1" cd --verbose && local test sed x=1 cd echo sed printf
+		printf $(pwd) "$@" awk test
+		export --verbose grep | 'quoted text'
+	x=1 local cd 2>/dev/null grep printf
+	$(pwd) --verbose done 2>/dev/null 2>/dev/null
+"$1" sed sed 'quoted text' grep then --verbose
+	readonly readonly "$@" -eu 2>/dev/null
+	awk local grep test 2>/dev/null --verbose cd cd grep readonly
+		${HOME} /usr/bin done && --verbose test sed $(pwd) readonly echo
+	cd -eu export readonly "$@"
+		cd /usr/bin x=1 export done readonly test printf && $(pwd) $(pwd) --verbose
+	test --verbose export && --verbose
+		awk 2>/dev/null --verbose awk readonly test -eu x=1
+	readonly done -eu && | | | done 2>/dev/null 2>/dev/null
+readonly echo -eu readonly echo --verbose test
+| local sed /usr/bin | && 'quoted text'
+	"$1" x=1 sed $(pwd) printf --verbose /usr/bin
+	-eu export grep $(pwd)
+	then -eu x=1 done cd --verbose /usr/bin "$@" readonly 2>/dev/null
+		printf grep cd $(pwd) local | "$@" $(pwd) x=1 grep printf test printf --verbose
+	x=1 cd sed test -eu awk then x=1 readonly 2>/dev/null done local
+		$(pwd) "$@" export echo sed done test done
+	done /usr/bin -eu "$@" printf grep | printf printf -eu local export x=1
+	cd | test /usr/bin export sed --verbose 'quoted text' 'quoted text' echo done
+--verbose export ${HOME} readonly "$@" then 'quoted text' "$1" awk 'quoted text'
+	x=1 2>/dev/null $(pwd) test local | printf "$@" printf
+		${HOME} sed ${HOME} grep sed && readonly
+		/usr/bin && /usr/bin "$1" done /usr/bin sed readonly
+		awk awk --verbose sed x=1 test grep /usr/bin cd export
+		export sed /usr/bin grep && sed grep
+		export done printf x=1 local -eu 2>/dev/null
+	printf echo grep ${HOME} ${HOME} test sed sed local $(pwd) done --verbose ${HOME}
+	&& readonly cd then grep x=1 local x=1 /usr/bin
+	export echo cd export x=1 local "$1" -eu export echo x=1 then awk sed cd readonly
+		--verbose then && printf export
+"$@" ${HOME} 2>/dev/null readonly local local 'quoted text' awk "$1" --verbose
+		grep x=1 test local printf 'quoted text'
+	'quoted text' | $(pwd) printf echo "$@" 'quoted text' local 'quoted text'
+2>/dev/null "$@" ${HOME} "$@" | awk
+readonly test grep $(pwd) awk 'quoted text' awk ${HOME} --verbose sed
+		awk cd /usr/bin local sed echo | 2>/dev/null readonly done -eu sed grep && $(pwd)
+printf 2>/dev/null sed awk "$1" "$@" printf ${HOME} ${HOME}
+then 2>/dev/null printf then awk x=1 -eu awk done echo echo "$@" export
+${HOME} done readonly export done export "$1"
+	cd "$1" export 2>/dev/null then $(pwd) "$1" x=1 2>/dev/null 2>/dev/null
+		2>/dev/null export $(pwd) ${HOME} local echo printf
+printf && local sed 'quoted text' --verbose "$@" cd |
+		awk done local --verbose $(pwd) readonly export awk local
+local | cd x=1 | | /usr/bin 'quoted text' done cd && x=1 export 'quoted text'
+	grep cd x=1 -eu cd x=1
+	readonly readonly "$1" done
+	done "$1" --verbose done x=1 /usr/bin export "$@" test x=1 x=1 $(pwd)
+"$1" 2>/dev/null local "$1" "$1" /usr/bin -eu printf | readonly "$1" test
+	-eu then echo 2>/dev/null local &&
+&& then printf /usr/bin test done echo -eu /usr/bin
+'quoted text' "$1" x=1 printf -eu export printf sed ${HOME} x=1 local
+		--verbose export grep local awk test then done done test -eu $(pwd) cd
+		grep $(pwd) readonly | sed $(pwd) && | echo 'quoted text' -eu "$@" readonly
+		&& export /usr/bin echo then | -eu printf -eu && "$@" cd cd | -eu sed cd --verbose
+		done 'quoted text' cd awk -eu && 2>/dev/null readonly grep export done then test
+	printf | printf cd export &&
+	'quoted text' grep | --verbose grep printf export
+2>/dev/null "$1" cd -eu 2>/dev/null local
+	"$@" local 'quoted text' 2>/dev/null done
+		--verbose awk grep printf x=1
+test then cd "$@" test cd x=1 "$@" readonly awk ${HOME} sed done "$@"
+	'quoted text' echo $(pwd) && && /usr/bin && 2>/dev/null
+done /usr/bin awk -eu && ${HOME} echo "$1"
+	test -eu --verbose $(pwd) x=1 2>/dev/null "$1" local grep done "$@" 2>/dev/null
+		${HOME} "$1" local test "$1" | export /usr/bin cd ${HOME} --verbose
+	| grep test then && --verbose | x=1 "$@" ${HOME} $(pwd) test --verbose
+		| echo echo 2>/dev/null && printf awk printf "$1" grep ${HOME} readonly 'quoted text'
+2>/dev/null export test "$1" | done && test echo "$1" grep printf
+		&& printf local 'quoted text' done
+--verbose && $(pwd) then "$@" export
+test | then 'quoted text' printf
+| echo done --verbose export "$1" sed -eu done sed
+${HOME} "$@" done 'quoted text' 'quoted text'
+		then $(pwd) /usr/bin grep echo ${HOME} done
+sed 2>/dev/null /usr/bin
+		done /usr/bin /usr/bin 'quoted text' awk then then local 'quoted text'
+		"$1" echo "$@" grep done done /usr/bin "$@" grep
+	| "$@" sed export export
+	&& test cd printf x=1 local $(pwd) local local echo && cd
+		"$1" 'quoted text' sed 2>/dev/null
+	echo $(pwd) test | "$1" x=1 then export
+	2>/dev/null "$@" done echo cd awk
+	'quoted text' readonly "$1" done "$1"
+	/usr/bin done sed && "$1" test && printf export then test /usr/bin --verbose
+--verbose export | awk ${HOME}
+		"$@" /usr/bin then --verbose x=1 done export grep test sed sed -eu
+sed -eu then sed awk then readonly local 'quoted text' cd cd $(pwd) -eu
+	done test -eu done printf -eu /usr/bin test | local
+		test then sed done -eu printf $(pwd) 'quoted text' local | grep ${HOME} /usr/bin
+	2>/dev/null printf sed | sed -eu sed -eu | test cd export ${HOME} | printf
+		readonly cd done awk "$1" | sed "$1" 2>/dev/null 2>/dev/null
+echo echo -eu export 'quoted text' | grep local then export
+printf x=1 export awk |
+		"$1" 'quoted text' --verbose export
+		grep done 2>/dev/null cd /usr/bin ${HOME} "$1" sed echo | x=1 awk /usr/bin
+readonly local cd printf awk grep cd sed "$@"
+		grep $(pwd) then | /usr/bin "$1" cd x=1 cd grep test local export
+		x=1 | sed "$1" --verbose 2>/dev/null grep -eu $(pwd) "$@" then ${HOME} -eu
+		"$1" grep then grep 'quoted text' /usr/bin grep export done readonly |
+		"$@" awk | $(pwd) printf && 'quoted text'
+	$(pwd) 2>/dev/null 'quoted text' test 2>/dev/null printf $(pwd)
+"$@" done export 'quoted text' "$@" then readonly readonly grep printf cd --verbose
+local -eu "$@" -eu test then -eu awk echo
+"$@" local then x=1 test x=1 && local ${HOME} 2>/dev/null
+		-eu x=1 readonly --verbose --verbose -eu "$1" readonly "$@"
+		${HOME} cd done local awk printf cd grep test done && x=1
+then | cd 'quoted text' printf x=1 printf
+	${HOME} && sed awk then ${HOME}
+		-eu readonly echo then readonly cd | x=1 'quoted text' printf
+		x=1 cd "$@" -eu x=1 2>/dev/null 2>/dev/null
+		then x=1 2>/dev/null then done x=1 export
+export /usr/bin --verbose test then
+		grep $(pwd) && ${HOME} "$@" /usr/bin printf echo "$@" cd ${HOME} readonly
+		x=1 $(pwd) local printf awk
+		test local "$1" 'quoted text' sed --verbose
+	printf -eu sed x=1 echo --verbose awk x=1 printf | "$1" ${HOME}
+	export ${HOME} "$1" $(pwd) echo cd
+readonly local $(pwd) printf /usr/bin
+&& local && && printf test "$@"
+sed printf grep done sed done $(pwd) awk --verbose readonly -eu /usr/bin
+test done done "$1" awk --verbose "$1" test
+	echo grep "$@" 2>/dev/null "$1" /usr/bin /usr/bin readonly
+		printf ${HOME} readonly done
+	test local export /usr/bin --verbose test local echo
+${HOME} -eu grep printf /usr/bin
+		x=1 done done "$@" local "$@" local --verbose cd "$@"
+	printf && grep --verbose grep 'quoted text' ${HOME} && "$1" awk 'quoted text'
+	awk | --verbose sed "$@" then
+		'quoted text' awk local ${HOME} echo done done grep done export $(pwd) echo |
+$(pwd) | done cd awk x=1 x=1 $(pwd) export then test grep then 2>/dev/null
+| export $(pwd) -eu 'quoted text'
+		readonly local "$@" readonly $(pwd) cd printf readonly /usr/bin -eu
+	"$@" local echo /usr/bin readonly export grep x=1 -eu 'quoted text' then --verbose
+grep ${HOME} readonly cd --verbose -eu echo then test done test then test sed local
+	"$1" && ${HOME} "$@" x=1 grep $(pwd) export /usr/bin done --verbose
+		-eu cd "$@" then export grep && readonly x=1 'quoted text' -eu && readonly "$1"
+		then printf x=1 readonly
+sed readonly grep && ${HOME} printf printf ${HOME} 'quoted text' sed ${HOME}
+		x=1 awk ${HOME} | 'quoted text'
+		--verbose then printf 2>/dev/null
+cd printf | "$@" readonly /usr/bin /usr/bin readonly -eu | "$@" -eu /usr/bin
+		"$@" echo export printf done
+x=1 ${HOME} done cd export ${HOME} /usr/bin /usr/bin sed && | 'quoted text'
+| $(pwd) 'quoted text' grep "$@" test ${HOME} --verbose then
+		sed 2>/dev/null local x=1
+		sed --verbose readonly $(pwd) "$1" ${HOME}
+	local -eu export && then $(pwd) readonly then readonly 2>/dev/null 'quoted text'
+	readonly $(pwd) done export export ${HOME} | printf -eu
+		'quoted text' ${HOME} $(pwd) grep && "$@" | awk x=1 cd done
+done "$@" readonly && printf awk test
+-eu | x=1 cd cd then done readonly local local -eu x=1 x=1 "$1" awk grep
+	"$@" echo export 'quoted text'
+/usr/bin --verbose ${HOME} printf local "$1" "$@" sed 2>/dev/null 2>/dev/null
+		then export --verbose awk test done 2>/dev/null
+	| sed "$@" sed ${HOME} local 2>/dev/null 'quoted text' x=1
+		x=1 readonly local grep printf x=1 --verbose test x=1 awk
+		2>/dev/null printf 2>/dev/null
+	2>/dev/null done printf export
+		printf 2>/dev/null echo ${HOME} x=1 | test --verbose 2>/dev/null
+		&& echo ${HOME} local sed local printf 'quoted text' ${HOME} printf /usr/bin
+then 2>/dev/null awk $(pwd) sed done "$1" && awk export printf
+grep "$1" echo $(pwd) | done readonly -eu x=1 local local awk cd export --verbose
+&& cd x=1 local sed sed x=1 done | then readonly "$@" 2>/dev/null && 'quoted text'
+	readonly 'quoted text' 2>/dev/null grep export cd | echo /usr/bin
+| then echo ${HOME} $(pwd) done ${HOME}
+		local ${HOME} echo x=1 2>/dev/null local && then grep export
+	readonly grep x=1 test sed | /usr/bin ${HOME} x=1 test /usr/bin x=1
+2>/dev/null sed sed done sed readonly "$1" export awk &&
+		"$1" | -eu "$@" grep then export $(pwd) test sed -eu && | printf ${HOME}
+		cd sed sed 2>/dev/null "$@" x=1 -eu 'quoted text' x=1 x=1 | done x=1
+		sed "$@" "$1" /usr/bin printf /usr/bin ${HOME}
+test test "$@" sed then export -eu --verbose test
+	&& x=1 awk -eu 'quoted text' --verbose
+		cd "$1" && printf then export cd ${HOME} $(pwd) | test printf grep &&
+		-eu ${HOME} readonly && ${HOME} x=1
+	test cd cd printf cd /usr/bin && 2>/dev/null then && 'quoted text'
+		$(pwd) local "$@" cd export $(pwd) sed test ${HOME}
+		sed cd awk /usr/bin -eu x=1 --verbose export done awk /usr/bin
+		"$@" "$1" echo ${HOME} grep 2>/dev/null 2>/dev/null
+	&& "$@" 2>/dev/null "$@" "$@" awk grep then local echo cd "$1" awk -eu $(pwd)
+		readonly readonly 'quoted text'
+		local 2>/dev/null local "$@" echo cd test sed -eu readonly "$@" printf
+		/usr/bin printf /usr/bin $(pwd) printf $(pwd) cd done test
+	awk "$1" $(pwd) --verbose echo done export 2>/dev/null
+		2>/dev/null -eu echo | $(pwd) -eu 'quoted text' --verbose
+	echo 'quoted text' sed export sed echo "$1" then -eu --verbose --verbose
+		cd -eu "$@" 'quoted text' test -eu
+printf export | 'quoted text' local printf readonly awk $(pwd) ${HOME}
+	export test readonly x=1 ${HOME} "$@" export x=1 ${HOME}
+		printf x=1 export -eu $(pwd) test
+	local "$1" done grep -eu ${HOME} export ${HOME} then
+		done && grep && grep
+	test sed | done 'quoted text' --verbose /usr/bin readonly echo sed
+		--verbose printf awk test --verbose $(pwd)
+		sed then ${HOME} readonly done 2>/dev/null printf echo
+		printf grep ${HOME} done -eu ${HOME}
+		export cd | -eu readonly echo ${HOME}
+		echo done export test "$1" test $(pwd) awk /usr/bin "$1" "$@" x=1 -eu --verbose
+		--verbose readonly sed grep cd grep awk
+	local awk -eu "$1" "$@" /usr/bin sed 2>/dev/null
+	"$1" | done grep --verbose
+local then local "$@" $(pwd) 'quoted text'
+	done /usr/bin cd && 'quoted text' "$@" grep "$1" $(pwd) awk 'quoted text' $(pwd)
+	'quoted text' "$1" echo 2>/dev/null export "$@" x=1 printf readonly
+		-eu cd printf awk export printf readonly
+awk 'quoted text' $(pwd) /usr/bin local export x=1 $(pwd) -eu
+	| cd cd readonly && echo readonly printf
+readonly test "$1" | printf cd -eu then 2>/dev/null test $(pwd) then
+2>/dev/null sed && x=1 cd awk
+	cd $(pwd) printf x=1 printf local /usr/bin echo grep export "$1"
+	done "$1" awk "$@" -eu export sed --verbose grep done awk grep export
+2>/dev/null $(pwd) && readonly awk printf awk "$@" "$@" 2>/dev/null cd /usr/bin
+	2>/dev/null x=1 x=1 printf && --verbose sed x=1 printf awk awk "$@" /usr/bin
+sed awk then | $(pwd) grep then test
+		awk x=1 'quoted text' done --verbose sed export /usr/bin cd
+x=1 readonly -eu grep export /usr/bin printf grep -eu printf "$@" -eu awk --verbose
+	grep && | | 2>/dev/null x=1 then sed test "$1"
+		then ${HOME} local echo export echo | done
+done local local done -eu "$1" "$1"
+-eu printf 2>/dev/null 'quoted text' "$@"
+		'quoted text' readonly export local -eu
+	--verbose sed "$@" awk -eu
+2>/dev/null sed local && $(pwd) printf 'quoted text' ${HOME}
+x=1 | done awk "$@" 'quoted text' local $(pwd) | grep
+	then ${HOME} test "$@" "$@" sed 'quoted text' --verbose local 2>/dev/null "$1" sed
+	| "$@" then ${HOME} && then x=1 -eu local done x=1
+	cd 'quoted text' then test done "$@" readonly echo export local
+	2>/dev/null echo readonly cd "$@" ${HOME} cd $(pwd) ${HOME} | local
+/usr/bin | readonly printf grep 2>/dev/null 2>/dev/null | grep x=1 "$@" test
+		printf x=1 x=1 cd && local printf ${HOME} x=1 readonly --verbose readonly x=1 sed
+		printf --verbose /usr/bin -eu /usr/bin | 'quoted text'
+	readonly done local done $(pwd) x=1
+		awk export export "$@" echo 2>/dev/null echo then then test
+	readonly sed | echo "$1" printf sed ${HOME} grep 2>/dev/null 'quoted text' &&
+cd cd awk "$@" | ${HOME} printf
+		&& readonly local ${HOME} "$1" 2>/dev/null 2>/dev/null
+sed && -eu x=1 $(pwd) --verbose "$@" x=1 export /usr/bin awk
+cd && printf cd done ${HOME} 'quoted text' && x=1
+	--verbose "$1" readonly "$1" --verbose
+		$(pwd) && 2>/dev/null printf "$1" ${HOME} -eu echo /usr/bin "$@" "$1" cd local
+	echo printf /usr/bin readonly -eu /usr/bin --verbose awk 2>/dev/null
+x=1 | local | echo printf
+	grep printf "$@" x=1 | export "$1" then export grep x=1 /usr/bin "$@"
+	local "$1" grep echo && cd cd
+		printf --verbose test ${HOME} "$1" grep | test grep 'quoted text' 2>/dev/null $(pwd)
+		${HOME} sed ${HOME} --verbose --verbose awk $(pwd) "$1" echo
+	export $(pwd) 2>/dev/null 'quoted text' local ${HOME} test 2>/dev/null
+awk awk 'quoted text' local
+2>/dev/null /usr/bin done done local done grep then
+		&& printf | /usr/bin ${HOME}
+"$1" $(pwd) "$@" readonly 2>/dev/null awk test
+	${HOME} -eu readonly $(pwd) 2>/dev/null readonly && --verbose
+		"$@" 'quoted text' cd awk | $(pwd) test echo readonly | sed echo
+		sed sed local "$1" 'quoted text' /usr/bin "$1" "$1" ${HOME}
+		"$@" | grep readonly test && && printf echo done export | readonly
+	cd 2>/dev/null /usr/bin export "$@"
+'quoted text' $(pwd) --verbose awk test echo printf sed 'quoted text'
+		-eu test /usr/bin "$@" grep ${HOME}
+		awk then --verbose export -eu sed /usr/bin echo
+awk export echo -eu 2>/dev/null
+&& echo echo $(pwd) test echo && x=1
+printf 2>/dev/null awk local ${HOME} echo test local /usr/bin /usr/bin done
+&& local /usr/bin | echo --verbose echo | ${HOME} ${HOME}
+		"$1" cd && -eu done cd && 2>/dev/null
+| /usr/bin 'quoted text' "$1" "$@" | | printf "$1" "$1" echo /usr/bin echo printf
+	awk 2>/dev/null export --verbose --verbose cd ${HOME} export awk
+	x=1 grep cd x=1 grep export ${HOME} 'quoted text'
+	| done test $(pwd) --verbose readonly
+	| /usr/bin grep readonly
+-eu awk done sed --verbose printf printf awk 'quoted text' -eu
+test done grep export sed done local grep /usr/bin "$1"
+#include c126.sh
+	$(pwd) then ${HOME} awk readonly grep --verbose grep 2>/dev/null then x=1
+		2>/dev/null --verbose "$@" | local ${HOME} 'quoted text' /usr/bin
+	$(pwd) export printf printf x=1 export /usr/bin "$@" |
+| "$@" readonly ${HOME} done readonly /usr/bin /usr/bin cd done local grep done
+printf done echo grep | echo done "$@" awk $(pwd) sed | test test
+		readonly 2>/dev/null "$1" grep then --verbose -eu printf x=1
+-eu -eu ${HOME} -eu /usr/bin
+	-eu test 'quoted text' cd 'quoted text' -eu "$@" 'quoted text'
+	"$1" --verbose then readonly test awk local 2>/dev/null printf | printf 'quoted text'
+/usr/bin printf "$@" --verbose --verbose /usr/bin
+	grep printf --verbose sed done --verbose awk sed /usr/bin
+		/usr/bin cd $(pwd) cd printf export
+$(pwd) local readonly
+	cd $(pwd) "$@" awk awk "$@" done export x=1 --verbose
+grep 'quoted text' 'quoted text' test echo local sed sed /usr/bin printf x=1 then
+	| "$@" done /usr/bin "$@"
+x=1 $(pwd) done | awk | awk $(pwd) ${HOME} ${HOME} cd && /usr/bin $(pwd)
+test then && && && ${HOME} /usr/bin x=1 --verbose
+	printf "$@" local printf export && echo export /usr/bin -eu
+	local export -eu export --verbose $(pwd) 2>/dev/null "$@" 2>/dev/null
+	| then test done cd local "$@" done done x=1 local $(pwd)
+		x=1 printf 2>/dev/null && printf echo echo sed readonly "$1" printf "$@" awk
+	"$@" 2>/dev/null "$1" $(pwd) | /usr/bin 2>/dev/null readonly 'quoted text'
+		done then 'quoted text' done "$@" && then cd printf echo sed printf "$1" "$1" "$@"
+sed | "$1" then 'quoted text' 2>/dev/null done done
+test && export 2>/dev/null $(pwd)
+	then sed grep "$1" 'quoted text' sed 'quoted text' /usr/bin printf cd test ${HOME}
+		printf test sed ${HOME} | /usr/bin && --verbose awk export test grep cd
+		2>/dev/null && readonly "$@" local /usr/bin --verbose --verbose awk
+		cd test echo grep -eu cd awk &&
+		--verbose readonly printf 2>/dev/null
+	cd "$@" -eu local x=1 grep cd --verbose
+		echo test export cd && cd cd && x=1 export
+grep local test "$1" awk $(pwd)
+		$(pwd) $(pwd) "$@" 2>/dev/null x=1 test printf "$@"
+'quoted text' "$1" x=1 /usr/bin ${HOME} 2>/dev/null export export
+	/usr/bin echo "$@" x=1 2>/dev/null && 'quoted text' 'quoted text'
+	then sed 2>/dev/null then local
+		then cd -eu && awk sed 'quoted text' && awk done --verbose awk
+		readonly export 'quoted text' && test test | /usr/bin
+	2>/dev/null cd 'quoted text' x=1 -eu "$@" export
+		test "$@" x=1 x=1 grep /usr/bin "$@" /usr/bin && --verbose
+		sed "$@" export done && cd awk sed readonly
+	done -eu --verbose | | echo $(pwd) "$1" sed done 'quoted text' printf cd $(pwd)
+grep -eu -eu --verbose test $(pwd) /usr/bin
+		2>/dev/null /usr/bin --verbose grep $(pwd)
+		echo ${HOME} -eu "$1" ${HOME} "$@" readonly cd ${HOME} "$@" cd "$@" local readonly
+		sed -eu awk 'quoted text' printf
+		| export && then then printf /usr/bin x=1 printf
+${HOME} then --verbose sed 'quoted text'
+"$@" local grep done cd "$1" "$1" export
+local && 'quoted text' 2>/dev/null && printf cd echo echo cd 'quoted text' "$1"
+		done test $(pwd) awk $(pwd)
+awk local --verbose -eu printf done printf done -eu awk test &&
+		/usr/bin ${HOME} awk local "$@" test 2>/dev/null 2>/dev/null /usr/bin /usr/bin
+	awk -eu done 'quoted text' awk x=1 test then
+		${HOME} local ${HOME} x=1 -eu --verbose "$1" 'quoted text' && then
+printf sed sed x=1 -eu then readonly cd grep cd
+		readonly "$@" export | 2>/dev/null
+	printf /usr/bin export done &&
+		awk export awk ${HOME} awk $(pwd) "$1" readonly
+${HOME} | -eu 'quoted text' test printf export then printf ${HOME} grep echo
+	awk test "$1" "$1" done awk grep $(pwd) readonly echo done
+	/usr/bin local -eu -eu && ${HOME} export done awk "$1" "$@" /usr/bin | done
+	printf sed done | sed printf && 2>/dev/null ${HOME}
+	$(pwd) ${HOME} && then 2>/dev/null -eu
+&& "$@" -eu cd $(pwd) "$@"
+	grep echo /usr/bin 'quoted text' --verbose | cd readonly done ${HOME} /usr/bin
+		awk -eu readonly "$1" printf readonly echo -eu sed --verbose && $(pwd) ${HOME}
+		local "$1" && ${HOME} echo then
+	2>/dev/null local local local /usr/bin sed awk echo && -eu local cd printf
+		&& -eu -eu $(pwd) x=1 $(pwd) "$1" |
+test "$@" "$1" /usr/bin printf $(pwd) 'quoted text' ${HOME}
+		echo awk then --verbose 2>/dev/null readonly /usr/bin
+	$(pwd) --verbose cd awk "$1" | "$1" local /usr/bin $(pwd) printf 'quoted text' /usr/bin
+		"$@" --verbose echo local then then readonly x=1 cd "$@" then then
+cd x=1 then echo "$@" echo $(pwd)
+		x=1 readonly grep test export x=1 sed readonly echo --verbose
+		echo --verbose readonly | x=1 --verbose 'quoted text' printf -eu 'quoted text'
+		&& "$@" awk local "$1" $(pwd) "$@" x=1
+	| awk grep local | -eu ${HOME} 'quoted text' grep echo 'quoted text' test $(pwd)
+	-eu --verbose test printf test grep grep test echo printf printf --verbose &&
+		| "$@" then /usr/bin awk
+		'quoted text' cd x=1 ${HOME}
+then | echo ${HOME} ${HOME} local
+/usr/bin | 2>/dev/null export
+grep 2>/dev/null printf sed x=1 -eu "$1" /usr/bin
+		local export awk printf /usr/bin --verbose 2>/dev/null grep --verbose ${HOME}
+echo "$@" -eu printf && /usr/bin ${HOME}
+	test test /usr/bin export export ${HOME} export -eu cd ${HOME} |
+	local printf awk awk $(pwd) done "$@" export
+		echo awk x=1 'quoted text' then $(pwd) local 'quoted text'
+done x=1 awk grep "$1" done "$@" sed then x=1 'quoted text' sed sed x=1 test 2>/dev/null
+/usr/bin "$@" awk x=1 local "$1" readonly ${HOME} $(pwd) "$@" sed
+		"$@" --verbose cd "$1" cd readonly local --verbose /usr/bin
+		done local readonly local $(pwd) --verbose -eu
+	x=1 $(pwd) awk ${HOME} sed "$@" 'quoted text'
+		| "$@" test 2>/dev/null echo sed then ${HOME} --verbose
+cd printf cd 'quoted text' 2>/dev/null --verbose awk
+printf 2>/dev/null && && done local 2>/dev/null "$1" cd ${HOME} grep
+--verbose "$1" test echo printf
+cd 'quoted text' export ${HOME} /usr/bin test --verbose /usr/bin
+		"$1" local 2>/dev/null printf echo export
+		"$1" then test "$@" $(pwd) printf cd sed $(pwd) ${HOME} awk && then echo
+$(pwd) readonly ${HOME}
+		"$@" cd "$@" --verbose ${HOME} /usr/bin sed sed
+	awk sed | readonly --verbose -eu printf 2>/dev/null printf 2>/dev/null awk
+-eu "$1" $(pwd) -eu then /usr/bin
+		&& export -eu export 2>/dev/null cd $(pwd) -eu ${HOME} readonly
+"$@" /usr/bin test cd export
+		2>/dev/null test x=1 printf -eu "$1" echo done then printf /usr/bin
+		'quoted text' 2>/dev/null echo sed local "$1" 'quoted text' "$@" printf
+x=1 "$@" "$1" && x=1 "$1" test then x=1 x=1 | printf x=1 "$@"
+--verbose 'quoted text' --verbose --verbose done test
+		cd -eu /usr/bin -eu --verbose done 2>/dev/null cd "$1" printf
+		then printf printf && --verbose done -eu test
+	| awk -eu awk /usr/bin x=1 cd
+	local ${HOME} /usr/bin printf
+${HOME} x=1 cd echo test
+readonly x=1 /usr/bin $(pwd)
+${HOME} ${HOME} export 2>/dev/null x=1 | then grep export "$@" x=1 sed done
+		awk readonly then "$1" local echo $(pwd) cd x=1 $(pwd) awk local local export awk
+echo export done "$@" ${HOME} local local local awk ${HOME} | export cd
+		test | "$@" grep grep cd -eu "$1"
+	| $(pwd) -eu printf test && export local
+	&& -eu export /usr/bin -eu local $(pwd) ${HOME} readonly local
+cd 'quoted text' then grep readonly
+	--verbose 2>/dev/null export
+$(pwd) readonly done readonly done
+	cd grep readonly readonly x=1 sed cd 2>/dev/null 2>/dev/null export
+	readonly && && readonly "$1" /usr/bin then grep test local done
+echo "$@" x=1 && export -eu
+	cd "$1" awk 2>/dev/null echo
+	${HOME} readonly && awk then $(pwd) x=1 cd 'quoted text' --verbose
+		x=1 | "$1" 'quoted text' awk test $(pwd)
+	echo $(pwd) | x=1 /usr/bin -eu done "$1" "$1"
+	then awk 'quoted text' ${HOME} local "$@" cd export printf
+		done x=1 2>/dev/null && printf /usr/bin
+	&& "$@" done /usr/bin 2>/dev/null | then
+		local $(pwd) then export 2>/dev/null
+then done 'quoted text' ${HOME} $(pwd) 'quoted text'
+	'quoted text' --verbose x=1 printf readonly printf -eu 2>/dev/null ${HOME}
+		local 2>/dev/null test 'quoted text' grep --verbose ${HOME}
+		| sed printf local "$1" && "$@"
+	2>/dev/null 2>/dev/null /usr/bin
+--verbose sed /usr/bin "$@" /usr/bin printf "$1"
+x=1 2>/dev/null cd 'quoted text'
+awk sed local local export awk --verbose done test
+	printf done cd then echo done then grep
+then | cd 'quoted text' then readonly
+	readonly 2>/dev/null "$@" grep --verbose sed "$@" ${HOME} then 2>/dev/null
+	done printf /usr/bin export then | $(pwd) cd local "$1" done
+	awk export readonly x=1 | 'quoted text'
+		$(pwd) "$@" then done 'quoted text' awk export 2>/dev/null
+		--verbose then 2>/dev/null
+	local done local 'quoted text'
+	printf cd --verbose readonly done ${HOME} readonly | -eu local local
+		local done cd then then ${HOME} local sed cd awk awk "$1" /usr/bin
+readonly awk printf grep -eu
+		local done --verbose x=1 readonly -eu $(pwd) printf |
+done | awk export x=1 test done test ${HOME}
+	export $(pwd) "$@" ${HOME}
+		cd test export printf 2>/dev/null "$1" done readonly
+	test sed readonly --verbose export "$1" echo export test grep x=1 'quoted text'
+'quoted text' 2>/dev/null test grep cd then sed -eu echo $(pwd)
+	cd sed then awk 'quoted text' then /usr/bin "$@" printf && cd ${HOME} --verbose
+x=1 cd --verbose printf readonly export ${HOME} -eu local local readonly then done
+	awk awk 'quoted text' then cd printf
+		export test /usr/bin then $(pwd) 'quoted text'
+grep sed /usr/bin awk "$1" sed -eu grep readonly export echo -eu export
+2>/dev/null 2>/dev/null "$@"
+	-eu "$1" /usr/bin echo "$@" cd "$@"
+	&& | then 2>/dev/null ${HOME} | 'quoted text' ${HOME} ${HOME} readonly export
+		grep then && sed done ${HOME} grep x=1 awk | -eu then x=1 && cd awk ${HOME}
+		'quoted text' awk && $(pwd) /usr/bin --verbose 2>/dev/null
+	--verbose /usr/bin | test awk test 2>/dev/null 'quoted text' ${HOME}
+readonly /usr/bin done echo 'quoted text'
+then x=1 "$@" && --verbose
+	${HOME} grep x=1 "$1" x=1 sed --verbose awk "$@" readonly
+		echo test ${HOME} awk --verbose 2>/dev/null -eu test 'quoted text'
+		${HOME} -eu -eu done && export readonly
+		then 'quoted text' x=1 printf awk 'quoted text'
+		awk $(pwd) "$1" sed local &&
+	test then printf ${HOME} export printf "$@" | && cd grep readonly ${HOME} $(pwd)
+x=1 2>/dev/null | "$1" $(pwd) x=1 x=1 -eu && cd --verbose "$1" "$@" x=1 printf
+		/usr/bin local "$1" echo $(pwd)
+	echo awk && $(pwd) "$@"
+		'quoted text' 'quoted text' "$1" && "$1"
+local && | "$1" sed printf done -eu 2>/dev/null 2>/dev/null sed then
+"$1" x=1 /usr/bin $(pwd) test x=1 'quoted text'
+	'quoted text' awk done printf $(pwd) "$1" ${HOME}
+	-eu "$1" grep grep $(pwd) 'quoted text' $(pwd) $(pwd) x=1 | done
+sed cd -eu grep && --verbose sed
+'quoted text' done ${HOME} export 'quoted text'
+readonly $(pwd) --verbose awk local then /usr/bin
+&& | x=1 /usr/bin sed "$1" && x=1 awk $(pwd) 'quoted text'
+		-eu --verbose cd $(pwd) "$@" grep | x=1
+done && $(pwd) cd 'quoted text'
+	awk export 'quoted text' 'quoted text' | readonly /usr/bin x=1 echo local awk /usr/bin
+	/usr/bin test echo cd export sed /usr/bin test local awk
+	"$1" awk readonly ${HOME} x=1 awk readonly
+		x=1 export -eu /usr/bin $(pwd)
+$(pwd) --verbose awk export $(pwd)
+		readonly awk -eu cd /usr/bin readonly /usr/bin grep $(pwd) 'quoted text'
+		/usr/bin awk /usr/bin $(pwd) test | -eu grep grep grep --verbose export
+		| awk then export local "$1" awk
+		export --verbose -eu "$@" x=1 echo --verbose 2>/dev/null "$@" echo /usr/bin
+	'quoted text' --verbose "$@"
+		--verbose grep x=1 local
+		"$@" then local --verbose x=1 /usr/bin export | local grep --verbose
+		echo "$@" echo 'quoted text' 'quoted text' "$1" x=1 export 2>/dev/null
+		readonly -eu "$1" test "$1" "$@" | --verbose cd &&
+	done sed x=1 test "$@" grep /usr/bin awk x=1 sed done "$1" /usr/bin 'quoted text'
+		$(pwd) $(pwd) | /usr/bin 2>/dev/null
+		grep sed awk ${HOME} echo readonly done | export cd printf
+		2>/dev/null grep test echo echo done /usr/bin x=1 printf ${HOME} grep
+	2>/dev/null x=1 done echo -eu "$1" printf export echo local sed
+	${HOME} readonly "$1" local export 2>/dev/null awk x=1 'quoted text' ${HOME} awk
+		awk export echo && $(pwd) --verbose x=1 x=1 awk "$1" "$@"
+cd export ${HOME} done echo echo
+	grep x=1 /usr/bin 'quoted text' then
+${HOME} readonly test ${HOME}
+	readonly cd echo $(pwd) --verbose /usr/bin
+		printf awk 2>/dev/null "$1" "$@" -eu cd && awk local --verbose
+export -eu export test sed -eu | 2>/dev/null cd grep /usr/bin && printf /usr/bin
+awk awk then printf 2>/dev/null
+	-eu && done /usr/bin x=1 cd awk x=1 cd /usr/bin
+	"$1" readonly 2>/dev/null 'quoted text'
+	then then && "$1" 'quoted text' local x=1 test | -eu "$1" 2>/dev/null
+"$@" readonly cd test /usr/bin
+		cd local | sed "$1" echo then | test
+	2>/dev/null echo ${HOME} && cd done | | export | 'quoted text' done $(pwd)
+	test export && cd ${HOME} readonly readonly "$1" $(pwd) cd $(pwd) $(pwd)
+		/usr/bin x=1 then done then done | ${HOME} test "$1" --verbose echo grep done done
+	/usr/bin $(pwd) 'quoted text' cd --verbose done test --verbose
+	grep readonly $(pwd) ${HOME}
+awk echo --verbose -eu then local printf 2>/dev/null done then /usr/bin
+&& grep export $(pwd) 2>/dev/null local 'quoted text' local
+		"$1" x=1 then export echo readonly | readonly "$1" ${HOME}
+x=1 | awk "$1" printf "$1" printf /usr/bin
+-eu grep grep 2>/dev/null /usr/bin local test done "$1" printf echo
+done export test | readonly local then | x=1 /usr/bin export "$1" && printf
+	printf echo echo test printf | cd grep -eu cd printf
+"$@" test export 2>/dev/null then 'quoted text'
+		cd ${HOME} sed then 2>/dev/null export local
+		local printf 2>/dev/null -eu
+	x=1 2>/dev/null -eu -eu export $(pwd) -eu ${HOME} done test
+	${HOME} ${HOME} printf sed -eu --verbose
+		awk export "$1" awk ${HOME} done awk echo 2>/dev/null
+	&& $(pwd) test -eu --verbose cd then $(pwd) export grep export test --verbose
+		-eu echo test sed /usr/bin "$1" "$@" cd export sed 'quoted text' readonly
+	"$1" ${HOME} --verbose grep ${HOME} echo grep $(pwd)
+	--verbose $(pwd) test printf
+2>/dev/null local export export "$@" cd 2>/dev/null
+		test printf test $(pwd) --verbose local ${HOME} --verbose
+		-eu grep done awk /usr/bin "$@" ${HOME} local printf
+		&& 2>/dev/null --verbose 'quoted text'
+		--verbose test printf --verbose then --verbose awk ${HOME} test grep ${HOME}
+	test then "$@" | 'quoted text' $(pwd) x=1 then 'quoted text' cd grep ${HOME}
+&& $(pwd) ${HOME} /usr/bin
+	awk sed "$@" printf printf "$1" 'quoted text'
+		readonly 'quoted text' sed /usr/bin then echo --verbose
+		--verbose ${HOME} -eu && done ${HOME} /usr/bin awk "$1" /usr/bin "$1" export
+	readonly awk local sed 'quoted text' && "$@"
+$(pwd) ${HOME} -eu && grep export readonly "$1" ${HOME} then 2>/dev/null
+done x=1 -eu echo export local
+'quoted text' | ${HOME} 'quoted text' -eu echo /usr/bin
+	test 2>/dev/null -eu grep | "$@" cd export -eu "$@" test 'quoted text' x=1
+	awk && grep local "$@"
+	readonly awk --verbose sed ${HOME} $(pwd)
+then awk then | "$@" $(pwd) cd --verbose printf
+		sed && readonly export "$1"
+x=1 sed export | done /usr/bin test readonly 2>/dev/null grep "$1" then
+grep --verbose "$1" then then 2>/dev/null
+readonly sed /usr/bin local --verbose then readonly local test readonly
+	"$1" grep awk sed done ${HOME} "$1"
+	-eu printf printf "$@" | -eu "$1" "$@" test && awk done
+	"$@" local readonly printf /usr/bin grep --verbose ${HOME} | readonly /usr/bin /usr/bin
+		export "$1" x=1 printf readonly test ${HOME} 2>/dev/null
+export then readonly grep /usr/bin then readonly local test | local
+/usr/bin ${HOME} | --verbose
+	grep && local --verbose printf "$1" readonly export
+		then ${HOME} | done | done sed x=1 x=1 && 'quoted text'
+		local /usr/bin "$@" 'quoted text' $(pwd) --verbose
+echo 'quoted text' local cd
+--verbose "$1" --verbose
+| then /usr/bin 2>/dev/null echo grep | awk ${HOME}
+		done echo awk test "$@" awk --verbose sed printf /usr/bin x=1 $(pwd) 'quoted text'
+		--verbose done echo printf test awk grep then test ${HOME} test grep
+		| "$1" $(pwd) x=1 test && echo
+		/usr/bin export printf -eu --verbose x=1
+	"$1" && x=1 readonly ${HOME} ${HOME} printf && $(pwd) 2>/dev/null ${HOME} cd
+	echo --verbose local export
+		sed echo test printf awk export export readonly -eu | --verbose then test
+		local "$1" grep "$@" 'quoted text'
+	readonly -eu test $(pwd) echo | "$1" local
+		readonly x=1 echo printf $(pwd) "$1" echo
+	printf grep readonly sed grep /usr/bin readonly readonly
+readonly readonly grep 2>/dev/null
+		-eu printf | "$1" then ${HOME} export awk /usr/bin test then && $(pwd) then
+	printf done sed "$1" awk -eu x=1 -eu x=1 $(pwd) then "$1"
+		"$@" awk export readonly --verbose test then &&
+		&& ${HOME} --verbose echo cd --verbose grep && x=1 grep local
+	-eu 2>/dev/null cd -eu "$1" export export 'quoted text'
+	-eu readonly 'quoted text' export
+echo export $(pwd) $(pwd) sed $(pwd)
+		grep "$@" | cd 'quoted text' -eu cd --verbose 2>/dev/null done 'quoted text'
+		"$@" local then "$1" x=1 "$@" cd
+awk grep export /usr/bin printf sed "$1" done export &&
+	| $(pwd) printf && && readonly ${HOME} printf
+		readonly ${HOME} echo --verbose
+	local --verbose grep "$1" cd cd "$@" done cd /usr/bin
+then echo grep done printf -eu cd 2>/dev/null "$@" readonly export
+	then x=1 -eu grep test "$@" $(pwd) cd echo done && --verbose
+		cd ${HOME} && test echo /usr/bin printf $(pwd) grep awk done && $(pwd)
+		"$@" local 'quoted text' cd | cd 2>/dev/null
+${HOME} "$@" sed done x=1
+		'quoted text' export sed ${HOME} readonly --verbose "$@" --verbose "$1" /usr/bin
+	awk x=1 x=1 --verbose "$1" -eu then
+		&& test echo printf then 'quoted text' cd | 'quoted text' /usr/bin ${HOME} then
+sed done /usr/bin awk | --verbose readonly | -eu readonly "$@" |
+| | printf ${HOME} x=1 /usr/bin /usr/bin test test sed sed "$@" -eu
+	${HOME} && grep | readonly 'quoted text' readonly && -eu --verbose $(pwd)
+	done grep --verbose printf 2>/dev/null local awk cd /usr/bin export "$@" cd 2>/dev/null
+	then export cd 2>/dev/null | 'quoted text'
+	${HOME} && sed 'quoted text'
+sed export "$@" local && && 'quoted text' -eu awk ${HOME} export "$1"
+		done /usr/bin ${HOME} | cd 'quoted text'
+		| x=1 ${HOME} --verbose sed ${HOME} /usr/bin -eu done
+cd /usr/bin "$@" -eu -eu local 2>/dev/null then /usr/bin cd x=1 cd 2>/dev/null
+		/usr/bin "$@" local printf awk awk 2>/dev/null /usr/bin export cd -eu echo --verbose
+"$@" 'quoted text' x=1 test cd local
+		| | && then printf done test ${HOME} --verbose --verbose -eu
+echo cd printf | sed grep $(pwd) printf "$1" /usr/bin
+	echo echo "$@" local -eu 2>/dev/null
+		--verbose 'quoted text' $(pwd) x=1 2>/dev/null --verbose export grep
+"$1" | "$@" /usr/bin echo --verbose
+awk test && --verbose --verbose grep ${HOME} 'quoted text' && test && done
+		sed /usr/bin grep awk local 'quoted text'
+		local x=1 test local "$1" | grep $(pwd) /usr/bin "$1" -eu $(pwd) && | &&
+		x=1 --verbose cd $(pwd) printf then then --verbose 'quoted text' x=1
+2>/dev/null && then done --verbose
+done grep test && 'quoted text' readonly then 'quoted text'
+	$(pwd) "$1" -eu test -eu
+	cd export "$1" | /usr/bin local echo then $(pwd)
+echo x=1 grep awk awk then printf awk $(pwd) ${HOME}
+echo export | $(pwd) "$@" done && export export x=1 printf done
+	$(pwd) local ${HOME} readonly "$@" /usr/bin grep
+		2>/dev/null awk export 2>/dev/null "$@"
+		'quoted text' cd 2>/dev/null grep && ${HOME}
+	| done $(pwd) export awk done awk "$1" | x=1 cd done
+		then --verbose readonly done export
+		/usr/bin export done x=1 then "$1"
+--verbose cd 'quoted text' sed /usr/bin
+test $(pwd) grep grep 2>/dev/null 2>/dev/null -eu export "$@" local
+		'quoted text' | printf ${HOME} | grep
+| "$@" | done 2>/dev/null $(pwd) grep export ${HOME} "$1"
+		printf "$@" echo done awk cd sed | /usr/bin --verbose cd
+x=1 grep printf && awk 'quoted text' sed cd local "$@" test local
+"$1" awk local -eu 'quoted text'
+	/usr/bin echo then done test local "$1" "$1" grep && /usr/bin
+		export | export echo /usr/bin "$@" sed sed printf
+	readonly "$@" local --verbose awk && echo
+		export awk echo echo export -eu local printf x=1 printf
+awk readonly 2>/dev/null then test then cd sed $(pwd) "$@"
+	/usr/bin then /usr/bin sed sed
+--verbose sed /usr/bin 2>/dev/null 'quoted text' 2>/dev/null
+sed ${HOME} grep then && ${HOME} ${HOME} "$@" ${HOME} $(pwd) -eu ${HOME}
+	sed "$1" done | && "$@" ${HOME} 2>/dev/null then test echo ${HOME} "$@"
+		awk --verbose 'quoted text' | | test then readonly
+export --verbose then "$1" /usr/bin 'quoted text' 2>/dev/null -eu cd --verbose
+		x=1 && export done sed sed -eu sed ${HOME} echo cd ${HOME} done 2>/dev/null
+$(pwd) grep /usr/bin awk cd printf export grep done echo /usr/bin
+	--verbose printf local -eu 'quoted text'
+then test cd ${HOME} done local x=1
+	--verbose /usr/bin sed "$@" ${HOME} "$@" readonly 2>/dev/null echo ${HOME} x=1
+export /usr/bin awk printf printf printf | printf
+done test export export echo ${HOME} --verbose done awk "$@" 'quoted text'
+2>/dev/null grep "$@" -eu printf
+"$1" x=1 readonly awk "$@" cd "$@" && ${HOME} sed echo 2>/dev/null
+		$(pwd) export "$1" ${HOME} x=1 then 2>/dev/null then local sed 2>/dev/null
+printf ${HOME} test && &&
+		--verbose printf cd -eu local /usr/bin 2>/dev/null $(pwd) /usr/bin 'quoted text'
+/usr/bin $(pwd) echo "$1"
+		| -eu grep then $(pwd) printf then local readonly grep then --verbose $(pwd) --verbose
+	x=1 "$@" sed done local | 2>/dev/null ${HOME} done $(pwd) | cd
+	printf test echo done readonly readonly
+	grep /usr/bin grep awk x=1 /usr/bin -eu
+	"$@" --verbose /usr/bin cd
+"$@" echo && test "$@" local sed export x=1 printf -eu $(pwd)
+		x=1 "$@" -eu awk "$1" export test 'quoted text'
+-eu x=1 && /usr/bin then
+readonly test grep | printf export 'quoted text'
+		export test "$@" && $(pwd) x=1 'quoted text' readonly
+	$(pwd) 'quoted text' test
+		-eu export ${HOME} readonly 2>/dev/null printf cd
+	| echo local -eu done /usr/bin "$1" grep x=1 | ${HOME} $(pwd) test
+	printf ${HOME} echo local --verbose
+	echo 2>/dev/null -eu 2>/dev/null ${HOME} test echo test
+		"$@" ${HOME} "$@" readonly printf $(pwd) $(pwd) printf
+printf 2>/dev/null cd "$1" test
+--verbose sed "$1" sed readonly echo
+	2>/dev/null "$1" $(pwd) x=1 /usr/bin cd then 2>/dev/null "$1" printf -eu /usr/bin
+	readonly readonly printf 'quoted text' |
+readonly "$1" awk | "$@" 'quoted text' local sed awk -eu $(pwd) && 'quoted text'
+readonly "$@" -eu export -eu 2>/dev/null
+		test readonly readonly done /usr/bin readonly && /usr/bin "$1" awk test
+x=1 local cd "$@" awk 'quoted text' 'quoted text' 'quoted text' 'quoted text'
+	"$1" $(pwd) x=1 "$@" 'quoted text'
+2>/dev/null local done | 2>/dev/null test sed awk x=1 export
+	"$@" x=1 -eu done ${HOME} --verbose
+'quoted text' done ${HOME} done export -eu 'quoted text'
+sed $(pwd) readonly | && "$1" $(pwd) local | export local
+printf /usr/bin ${HOME} sed --verbose awk --verbose x=1
+	"$1" grep local then 'quoted text' awk echo awk $(pwd) export
+	/usr/bin -eu done x=1 ${HOME} --verbose then
+&& ${HOME} cd printf /usr/bin 'quoted text' && | printf
+local done awk -eu ${HOME} readonly local 2>/dev/null test && printf
+	local awk ${HOME} 'quoted text' then
+	grep "$@" export x=1 awk 'quoted text' cd ${HOME}
+	| x=1 2>/dev/null "$1" | done |
+	-eu done && $(pwd) x=1 && && sed 2>/dev/null
+	readonly sed grep $(pwd) --verbose 2>/dev/null --verbose | awk test
+		then -eu export "$1" test readonly ${HOME} 'quoted text' export
+		grep then export 'quoted text'
+grep done printf export "$@"
+printf "$1" echo export readonly /usr/bin --verbose local echo 2>/dev/null
+done "$@" ${HOME} ${HOME} ${HOME} -eu "$@" "$@" 'quoted text' | printf
+		2>/dev/null x=1 | test then "$@" readonly x=1 "$1" x=1 "$1"
+	printf readonly then && -eu export 'quoted text' x=1 cd $(pwd) local sed
+		--verbose test done test then ${HOME} test ${HOME} export readonly readonly
+	| -eu then -eu local echo
+-eu local test 2>/dev/null then x=1 && printf x=1
+		-eu /usr/bin ${HOME} echo 2>/dev/null /usr/bin
+		test done awk "$1" "$@" "$@" cd | "$1" cd && done ${HOME} 2>/dev/null
+$(pwd) cd done grep local x=1 local test && x=1 && --verbose then done
+	export ${HOME} | local sed awk && printf "$1" printf
+		${HOME} | export ${HOME}
+		"$1" local ${HOME} grep echo done done x=1 cd export 2>/dev/null sed 'quoted text'
+		sed awk export local x=1 test
+		&& /usr/bin $(pwd) 2>/dev/null test grep readonly $(pwd) | test done awk
+		test $(pwd) cd | sed ${HOME} && export grep -eu readonly readonly /usr/bin
+&& /usr/bin local test sed then grep x=1 echo | awk 2>/dev/null then
+	done export printf | x=1 2>/dev/null "$1" awk sed local && grep printf /usr/bin
+	"$1" "$1" 2>/dev/null sed printf export echo then 2>/dev/null
+grep export --verbose --verbose sed ${HOME}
+		${HOME} local readonly test /usr/bin
+	| done awk printf local $(pwd) -eu
+	2>/dev/null sed sed -eu cd "$@"
+awk | grep export /usr/bin echo "$1" cd -eu 2>/dev/null
+		$(pwd) "$@" done x=1 -eu grep grep | && echo local 'quoted text'
+	"$1" done readonly "$@" echo printf awk sed "$@" done --verbose --verbose 2>/dev/null
+	-eu sed 2>/dev/null "$@" "$@" grep test printf readonly
+	echo $(pwd) done /usr/bin grep printf && /usr/bin then sed
+-eu then export readonly export
+		&& cd x=1 ${HOME} -eu printf then x=1 'quoted text'
+test awk awk 2>/dev/null && local $(pwd) echo echo local test
+	"$@" done ${HOME} readonly awk export
+	local 'quoted text' "$@" "$@" printf printf ${HOME} readonly echo test $(pwd)
+		--verbose readonly 'quoted text' then /usr/bin test local export sed then
+		-eu grep export $(pwd) | && export --verbose test done
+then 'quoted text' $(pwd) done | export readonly $(pwd)
+		test x=1 --verbose /usr/bin && awk grep
+	export done export done export
+	export export export local $(pwd) printf
+	/usr/bin cd $(pwd) /usr/bin echo /usr/bin "$@" grep sed readonly
+	x=1 --verbose cd x=1 2>/dev/null 2>/dev/null cd --verbose echo printf then
+"$@" && echo /usr/bin readonly readonly
+test "$@" echo $(pwd) && "$@" --verbose export
+		export test /usr/bin ${HOME} --verbose export printf
+		echo done readonly local /usr/bin
+	--verbose sed $(pwd) /usr/bin --verbose --verbose 'quoted text'
+done "$@" test $(pwd) --verbose 2>/dev/null
+	"$@" readonly $(pwd) ${HOME} | readonly 'quoted text'
+	local /usr/bin 2>/dev/null export && 'quoted text'
+		sed echo export grep readonly done export --verbose
+done export 'quoted text'
+	then export then --verbose "$@" done
+	sed && readonly && readonly 'quoted text'
+	"$1" local "$1" grep --verbose grep 'quoted text' ${HOME}
+	then x=1 2>/dev/null local then export awk x=1 'quoted text'
+	local sed done grep && /usr/bin
+		| x=1 done "$1" x=1 $(pwd) && echo && readonly && then --verbose x=1 cd
+		-eu done cd $(pwd) /usr/bin
+-eu $(pwd) && $(pwd) done --verbose sed 'quoted text' ${HOME} export
+	/usr/bin /usr/bin awk sed echo
+"$1" "$@" then "$@" ${HOME} /usr/bin sed | ${HOME} --verbose
+$(pwd) test --verbose then x=1 grep then -eu | ${HOME} then $(pwd) 2>/dev/null
+x=1 grep 'quoted text' awk "$@" grep "$1"
+2>/dev/null x=1 printf printf awk $(pwd) /usr/bin readonly $(pwd) --verbose
+		readonly cd test -eu local echo --verbose
+${HOME} --verbose sed $(pwd) /usr/bin test sed 2>/dev/null
+printf then printf /usr/bin | "$1" -eu grep /usr/bin 'quoted text' -eu export |
+/usr/bin echo --verbose x=1 --verbose && ${HOME} awk 'quoted text' "$@"
+		| "$@" | && echo /usr/bin awk then && test done export $(pwd)
+		2>/dev/null -eu readonly then cd ${HOME}
+readonly readonly local sed sed printf 2>/dev/null test "$1" grep "$@"
+readonly export cd printf test
+		export export ${HOME} then | test 2>/dev/null /usr/bin --verbose grep /usr/bin
+	"$@" ${HOME} then then 'quoted text' grep done | "$1" readonly 2>/dev/null
+		cd local grep | -eu export then echo --verbose
+		x=1 'quoted text' done awk --verbose $(pwd) test "$@" echo printf 'quoted text'
+		printf done local local "$@" test export local 'quoted text'
+2>/dev/null 'quoted text' --verbose done -eu && --verbose readonly ${HOME} export
+		"$1" awk done test done local "$1" "$1" awk "$@" local test /usr/bin echo local
+	| "$@" test "$@" export readonly then sed
+	"$@" cd -eu $(pwd) export "$1" ${HOME} local printf /usr/bin done -eu $(pwd) echo
+	awk done -eu export "$1" readonly local ${HOME} | cd --verbose $(pwd)
+		test "$1" printf echo | 2>/dev/null x=1 grep done grep
+	readonly x=1 | export 2>/dev/null | sed "$@" -eu echo then awk $(pwd)
+	"$@" test test && grep "$1" &&
+-eu $(pwd) 'quoted text' /usr/bin $(pwd) grep sed | grep local
+cd awk -eu --verbose x=1 export $(pwd) export test | --verbose grep cd test
+done "$@" done echo 'quoted text' sed awk
+	cd x=1 cd x=1 printf readonly
+	then grep "$1" awk "$@" done echo && "$1" "$@" "$@" 'quoted text'
+	grep && done done -eu echo done "$1" "$@" printf local "$@" printf --verbose
+	awk done awk 'quoted text' 2>/dev/null test $(pwd)
+		local /usr/bin && "$@" grep test
+		"$1" x=1 export readonly /usr/bin readonly local done "$1" -eu
+		'quoted text' 2>/dev/null -eu
+--verbose && cd then then --verbose 2>/dev/null "$1"
+	cd ${HOME} $(pwd) echo "$1" /usr/bin cd awk /usr/bin
+printf test sed $(pwd) x=1 x=1 readonly test $(pwd) 2>/dev/null
+		&& $(pwd) then -eu 2>/dev/null --verbose local "$@" grep ${HOME} awk ${HOME}
+	test export done echo done printf ${HOME} then "$@"
+	readonly 2>/dev/null | 'quoted text'
+&& awk && --verbose done test printf && grep $(pwd) x=1 ${HOME}
+/usr/bin 2>/dev/null then | printf local | && "$@" "$1" ${HOME} -eu 2>/dev/null
+test ${HOME} 'quoted text' "$1" printf ${HOME} /usr/bin
+printf then readonly -eu && $(pwd)
+$(pwd) $(pwd) readonly export sed then 'quoted text' then
+		&& then readonly readonly done test echo $(pwd)
+		"$1" echo then local --verbose ${HOME}
+	readonly cd 2>/dev/null 'quoted text'
+&& local && test 'quoted text' /usr/bin done 2>/dev/null awk echo
+	export --verbose && echo
+	&& grep printf local "$@" -eu --verbose local x=1 x=1 ${HOME}
+	awk then --verbose | local $(pwd) grep export $(pwd) /usr/bin 'quoted text'
+2>/dev/null 'quoted text' 2>/dev/null
+		cd done | echo 'quoted text'
+		done cd $(pwd) echo 2>/dev/null 2>/dev/null readonly 'quoted text'
+	readonly /usr/bin test echo x=1 sed
+		--verbose local "$@" x=1 | | echo printf 2>/dev/null
+		test cd $(pwd) -eu printf x=1 sed done local 2>/dev/null /usr/bin awk
+	done ${HOME} grep then "$1" local sed
+export local 2>/dev/null "$1"
+	sed printf awk readonly echo done
+		"$1" done done sed printf ${HOME} --verbose done printf 'quoted text' 'quoted text'
+		then 'quoted text' awk | done
+printf awk "$@" awk done readonly | then local ${HOME}
+"$@" local done export export local awk && "$@" export
+x=1 export | 'quoted text' echo test "$@" awk x=1 | x=1 /usr/bin --verbose printf
+		$(pwd) /usr/bin echo echo
+test 2>/dev/null test readonly
+	export sed && then then grep -eu
+	--verbose echo done export local
+		local export sed then 'quoted text' printf echo
+	cd $(pwd) --verbose -eu echo $(pwd) test export
+	grep awk $(pwd) awk grep cd --verbose | "$@" readonly cd | export
+	-eu && export cd printf done grep readonly readonly
+	| done | awk sed echo sed cd -eu x=1 awk then $(pwd) local
+sed | then then 'quoted text'
+	grep done | 'quoted text' awk x=1 then test 2>/dev/null
+export echo $(pwd) --verbose awk $(pwd) "$1" echo
+${HOME} ${HOME} sed --verbose --verbose done echo --verbose
+		$(pwd) ${HOME} readonly $(pwd) | && -eu 2>/dev/null printf cd | ${HOME} && | /usr/bin
+		echo sed echo export $(pwd) x=1 cd then 'quoted text' echo
+then export --verbose --verbose
+	/usr/bin | grep done sed export export 2>/dev/null /usr/bin test /usr/bin
+		$(pwd) "$1" readonly then
+		${HOME} test | printf
+		-eu 'quoted text' 'quoted text' | test -eu local x=1 awk
+/usr/bin && printf -eu echo "$@" then export --verbose 2>/dev/null 'quoted text'
+		-eu export | sed $(pwd) -eu "$@"
+done ${HOME} export x=1 grep test /usr/bin done 2>/dev/null
+		export "$1" readonly x=1 $(pwd) && then export 'quoted text' grep 2>/dev/null 'quoted text'
+test ${HOME} && cd -eu x=1 then && grep 'quoted text'
+	/usr/bin -eu grep sed -eu --verbose
+awk cd "$1" echo -eu echo --verbose $(pwd) printf "$@" 2>/dev/null x=1 grep
+		done --verbose local done
+	"$1" test x=1 "$@" && export grep 2>/dev/null export then && 2>/dev/null awk
+		local cd cd grep echo "$1"
+printf /usr/bin | grep $(pwd) export ${HOME} printf test
+export "$1" export 'quoted text' then done 'quoted text' x=1 sed ${HOME}
+	local awk /usr/bin export echo then 2>/dev/null local test awk ${HOME} printf
+/usr/bin | 'quoted text' then echo "$@" 2>/dev/null "$@" echo
+${HOME} 'quoted text' export && printf local | 'quoted text'
+/usr/bin local export awk printf cd export printf awk grep sed
+		| $(pwd) ${HOME} awk "$1" awk "$1" 2>/dev/null
+	'quoted text' x=1 echo && | cd | "$@" grep export --verbose /usr/bin then grep
+	sed sed export x=1 "$@" x=1 ${HOME} done 'quoted text' printf cd sed 'quoted text'
+	then --verbose then $(pwd) test test cd local "$@"
+	readonly -eu /usr/bin cd -eu "$1" test 'quoted text' done && echo
+grep done local ${HOME} ${HOME} -eu "$1" echo done 'quoted text'
+-eu local export cd ${HOME} printf grep printf sed /usr/bin
+		"$@" -eu --verbose -eu x=1 local
+readonly 'quoted text' then "$1" /usr/bin && &&
+		printf x=1 2>/dev/null && test -eu awk awk printf echo && readonly done
+x=1 cd -eu /usr/bin /usr/bin --verbose
+"$1" | done --verbose $(pwd) -eu 2>/dev/null
+echo && printf $(pwd) cd sed readonly "$@" cd test then "$@" test ${HOME}
+	$(pwd) test awk -eu "$1" && export grep 2>/dev/null local grep
+		2>/dev/null cd | -eu ${HOME} awk cd -eu
+	--verbose -eu awk -eu && cd readonly --verbose | "$@" echo "$@" echo -eu
+	done export --verbose cd /usr/bin /usr/bin /usr/bin "$1" "$1"
+		awk -eu $(pwd) readonly local --verbose test grep cd x=1 | 'quoted text' -eu
+		export cd --verbose 'quoted text' --verbose --verbose echo 2>/dev/null "$1" /usr/bin
+	local | "$1" | "$1" then echo awk ${HOME}
+	&& /usr/bin done readonly grep export local readonly cd --verbose
+"$1" awk 'quoted text' test /usr/bin sed then x=1 "$1" | --verbose readonly ${HOME}
+then ${HOME} sed "$1" "$@" then x=1 | "$1" printf --verbose
+		&& test printf 'quoted text' echo 2>/dev/null sed | 2>/dev/null export
+2>/dev/null "$@" $(pwd) 'quoted text' cd test grep 2>/dev/null
+done 'quoted text' sed printf
+done ${HOME} ${HOME} x=1 -eu && cd | | x=1 2>/dev/null then done
+	x=1 -eu local $(pwd) awk awk printf ${HOME} -eu printf done
+		$(pwd) grep | "$1" readonly export /usr/bin x=1
+grep then readonly && readonly cd x=1 -eu "$1" cd -eu
+		awk awk $(pwd) export test "$1" /usr/bin ${HOME} 2>/dev/null
+		echo sed export grep done /usr/bin echo local
+printf ${HOME} grep -eu 2>/dev/null 2>/dev/null | test "$1" | 2>/dev/null
+	local /usr/bin 2>/dev/null ${HOME} local test awk done then
+	"$@" $(pwd) 'quoted text' test export x=1 grep && /usr/bin $(pwd) "$@" then && /usr/bin
+		-eu /usr/bin awk x=1 | echo --verbose sed
+"$1" printf export printf x=1 | echo
+		2>/dev/null awk "$@" awk sed awk grep | /usr/bin 'quoted text' $(pwd) cd export
+		echo "$@" --verbose awk /usr/bin printf printf /usr/bin then 2>/dev/null
+		readonly printf grep local local "$@" ${HOME} /usr/bin $(pwd)
+		grep sed ${HOME} awk printf
+&& awk cd 'quoted text' 'quoted text' sed "$1" readonly export echo done
+	| 'quoted text' grep ${HOME} then "$1"
+		$(pwd) "$1" local test then grep then | -eu -eu /usr/bin local --verbose
+	--verbose cd local sed
+awk ${HOME} readonly done "$1" -eu grep printf done printf
+		2>/dev/null 'quoted text' readonly local "$1" $(pwd) --verbose
+	--verbose readonly x=1 &&
+	printf $(pwd) "$1" "$@" done -eu "$1"
+&& 2>/dev/null printf ${HOME}
+echo && 2>/dev/null x=1 grep test /usr/bin x=1 sed "$1" -eu --verbose
+		/usr/bin /usr/bin awk cd --verbose done readonly --verbose
+then x=1 -eu "$@" | test readonly 2>/dev/null cd done grep ${HOME} x=1 x=1
+	/usr/bin test grep cd $(pwd)
+local readonly export /usr/bin local 2>/dev/null
+	done sed ${HOME} "$@" sed $(pwd) -eu grep "$1" done awk echo
+	then | -eu && $(pwd) done printf --verbose
+		"$1" export sed --verbose
+		/usr/bin export sed local printf grep "$@" awk x=1 $(pwd) then "$1"
+		printf $(pwd) 'quoted text' sed grep
+		-eu "$@" done /usr/bin echo cd | awk && | local 'quoted text'
+		'quoted text' done done export grep then grep
+	&& --verbose && 'quoted text' x=1 "$1" -eu then awk 2>/dev/null && | |
+"$@" 2>/dev/null -eu 2>/dev/null
+		--verbose "$@" readonly "$1" done readonly x=1 cd $(pwd) | -eu
+		sed -eu -eu test readonly /usr/bin sed readonly $(pwd) | done /usr/bin
+		sed --verbose ${HOME} awk awk printf "$1" echo readonly test done "$@" "$1" export
+	awk x=1 2>/dev/null printf printf printf printf $(pwd) /usr/bin "$1"
+grep done local sed done grep done grep cd readonly
+	export grep echo /usr/bin -eu printf then x=1 awk | done 'quoted text'
+		$(pwd) && 2>/dev/null $(pwd) then 2>/dev/null ${HOME}
+		done "$@" grep -eu | readonly "$@" 2>/dev/null x=1 printf
+${HOME} "$@" test sed $(pwd) ${HOME} "$1" -eu $(pwd) -eu "$@" $(pwd) echo done
+	$(pwd) ${HOME} && -eu /usr/bin | && sed done echo sed "$1" echo sed grep export
+&& awk --verbose printf 2>/dev/null | local -eu
+test -eu "$@" $(pwd) x=1 | ${HOME} done $(pwd) x=1 2>/dev/null
+${HOME} "$@" awk then test cd
+	local printf "$1" 2>/dev/null
+local | && readonly -eu 'quoted text' export
+		| ${HOME} grep done export export local printf sed grep "$@" export
+		echo awk $(pwd) --verbose done $(pwd) && then grep | /usr/bin printf
+awk x=1 grep && local cd
+		-eu readonly local ${HOME} sed $(pwd) local local
+	'quoted text' cd local x=1 | | ${HOME} | local done cd --verbose done $(pwd) done
+-eu --verbose awk ${HOME} cd "$1" local -eu grep
+	x=1 readonly "$@" | local test cd export export
+		echo echo sed export readonly done -eu /usr/bin export echo readonly
+		2>/dev/null "$@" /usr/bin ${HOME} -eu $(pwd) echo | awk --verbose awk test
+sed grep x=1 | export grep local
+	printf then grep grep cd then /usr/bin done
+$(pwd) "$1" export | awk done 2>/dev/null "$1" | x=1 then --verbose
+	cd echo -eu "$1" "$1" test sed sed /usr/bin --verbose cd -eu
+echo then -eu export printf export local /usr/bin x=1 readonly | printf 'quoted text'
+test awk ${HOME} readonly grep test "$1" "$@" $(pwd) -eu "$1" -eu
+		2>/dev/null "$1" grep -eu printf then echo
+		x=1 export local x=1 -eu cd awk printf awk $(pwd) local
+"$1" | && 2>/dev/null /usr/bin then "$1" --verbose sed 'quoted text' x=1 'quoted text'
+	cd sed "$@" then && then "$1" --verbose "$1" ${HOME} "$1" awk -eu echo "$@"
+		export sed | x=1 "$@" awk readonly done
+x=1 $(pwd) ${HOME} sed 2>/dev/null $(pwd) -eu ${HOME} echo
+2>/dev/null && local $(pwd) &&
+x=1 grep then | "$1" 2>/dev/null | x=1 then x=1 ${HOME}
+	test 'quoted text' -eu sed 2>/dev/null sed /usr/bin then export "$@" grep |
+-eu export "$@" ${HOME} grep ${HOME} awk $(pwd) ${HOME} && "$@" readonly
+		--verbose awk printf /usr/bin done awk export
+awk test sed 2>/dev/null export ${HOME} | /usr/bin echo ${HOME}
+then printf grep local "$1"
+"$1" "$1" x=1 'quoted text' $(pwd) ${HOME} done
+	echo local x=1 $(pwd) | local awk --verbose "$1"
+	| 2>/dev/null readonly test "$1" done "$@" printf export then
+		test export then export -eu x=1 --verbose "$@" echo local awk export &&
+	/usr/bin | 'quoted text' /usr/bin 2>/dev/null
+	sed awk -eu | local 'quoted text' then
+		/usr/bin 2>/dev/null done test $(pwd)
+	then -eu then readonly local printf echo done "$1" printf
+test awk printf 2>/dev/null 'quoted text' 2>/dev/null --verbose
+	$(pwd) grep echo && | grep awk local -eu grep /usr/bin
+'quoted text' echo export printf "$@" echo -eu /usr/bin "$@" then x=1 cd x=1
+	echo $(pwd) "$@" local x=1 "$@" x=1 cd local && cd awk "$1" -eu -eu
+		--verbose echo "$1" export ${HOME} awk readonly printf sed local awk export "$1"
+	readonly $(pwd) /usr/bin done 'quoted text' readonly local export export
+		x=1 2>/dev/null sed sed 2>/dev/null ${HOME} -eu readonly local
+grep 2>/dev/null sed printf
+echo -eu 'quoted text' --verbose
+		| cd "$1" --verbose printf done -eu echo
+	| /usr/bin ${HOME} cd test "$1" readonly "$@" /usr/bin
+		"$1" test local "$@" ${HOME} then test /usr/bin --verbose printf sed 'quoted text'
+	x=1 cd grep 'quoted text' readonly readonly echo cd
+		-eu && grep | --verbose "$1" awk
+		| "$1" grep printf done && | /usr/bin "$1" done readonly && && 'quoted text'
+		-eu 'quoted text' done $(pwd)
+	printf done -eu "$@" awk local local done && $(pwd) $(pwd) -eu x=1 done local
+		grep --verbose sed grep grep 2>/dev/null grep 'quoted text' grep "$@" grep
+	cd /usr/bin 2>/dev/null --verbose sed
+		then --verbose cd 2>/dev/null sed 2>/dev/null 'quoted text' ${HOME} $(pwd)
+	grep --verbose | | local && readonly
+	x=1 sed grep ${HOME} grep x=1 -eu awk -eu ${HOME} readonly
+	echo readonly local 2>/dev/null test
+	"$1" /usr/bin local export awk $(pwd) --verbose
+		readonly "$1" done 'quoted text'
+		export echo && /usr/bin
+	local printf grep x=1 ${HOME}
+then x=1 2>/dev/null $(pwd) | done
+	"$@" x=1 echo | test "$@"
+	cd printf x=1 $(pwd) && 2>/dev/null /usr/bin
+		sed printf -eu 'quoted text'
+	grep sed "$@" export readonly awk readonly sed 2>/dev/null 2>/dev/null
+$(pwd) x=1 x=1 'quoted text' x=1 test 'quoted text'
+${HOME} test printf local sed cd --verbose 'quoted text' --verbose 'quoted text'
+		readonly export $(pwd) $(pwd) -eu grep 'quoted text' grep /usr/bin
+		then export readonly cd x=1 "$1" awk readonly cd && 'quoted text' -eu local
+	local grep printf readonly $(pwd)
+grep local "$@" "$1" readonly -eu export grep printf --verbose
+test export $(pwd) 2>/dev/null export && ${HOME} "$@" x=1 x=1 awk cd
+"$@" && 2>/dev/null awk local | x=1 echo
+"$1" local $(pwd) local then ${HOME} awk 'quoted text'
+then --verbose printf -eu printf test $(pwd) x=1 && grep test 'quoted text' awk
+	echo grep "$1" ${HOME} printf 2>/dev/null then -eu && grep x=1
+	awk echo /usr/bin printf export -eu 'quoted text' sed printf
+$(pwd) readonly cd grep "$@" then readonly "$@" printf
+$(pwd) "$1" done then &&
+	/usr/bin local --verbose /usr/bin 'quoted text' then "$@" test | 'quoted text'
+		test -eu x=1 "$1" ${HOME} done | readonly $(pwd) 2>/dev/null
+		done 2>/dev/null awk ${HOME} ${HOME} echo export grep 2>/dev/null cd /usr/bin
+		'quoted text' cd local 'quoted text' echo sed
+	"$1" x=1 sed $(pwd) /usr/bin sed /usr/bin grep --verbose export printf cd $(pwd)
+	2>/dev/null --verbose printf done awk 'quoted text' test cd
+sed printf | "$1" local readonly
+	awk ${HOME} local local cd 'quoted text' ${HOME} ${HOME}
+readonly echo then --verbose cd x=1 printf local && echo --verbose
+readonly && | --verbose && printf
+		-eu "$1" 2>/dev/null readonly | echo test "$@" echo readonly
+grep test test ${HOME} 2>/dev/null then | awk | grep echo 2>/dev/null export
+	"$@" "$@" grep "$1" readonly printf test awk /usr/bin cd echo awk
+	x=1 then ${HOME} printf local echo && export 2>/dev/null
+readonly 2>/dev/null "$@" cd "$@" 'quoted text' awk --verbose | /usr/bin --verbose
+	grep echo sed 'quoted text'
+grep printf $(pwd) cd printf echo cd export then cd sed
+	grep local done test then | awk x=1 echo x=1 cd --verbose local
+&& $(pwd) 2>/dev/null x=1 grep readonly export readonly echo 2>/dev/null
+	&& "$@" cd awk grep | --verbose echo done 2>/dev/null grep test grep awk readonly
+		x=1 then test printf awk && grep sed grep 'quoted text' grep $(pwd) $(pwd) --verbose
+awk -eu 'quoted text' echo test awk | then awk ${HOME} "$1"
+	--verbose | awk x=1 --verbose cd awk x=1 awk
+		&& then test sed "$@" done && | --verbose
+		readonly --verbose test echo 2>/dev/null sed then "$@" done "$1" done
+--verbose local echo readonly local x=1 x=1 then readonly ${HOME}
+	done $(pwd) cd -eu readonly
+	done printf then 2>/dev/null printf && test /usr/bin done cd "$@" then
+		printf printf | local -eu then
+		cd printf "$1" done 2>/dev/null cd
+	${HOME} 2>/dev/null local
+		sed cd local readonly --verbose echo --verbose --verbose
+	grep /usr/bin echo awk echo cd "$1"
+		"$@" test cd "$@" && --verbose --verbose
+		--verbose 'quoted text' grep grep test
+	x=1 --verbose then echo 2>/dev/null | then then /usr/bin x=1 sed
+		printf sed readonly $(pwd) -eu cd local printf export awk
+		awk export test export export awk echo done test "$1" "$@" "$@" --verbose
+--verbose ${HOME} /usr/bin
+${HOME} printf "$@" "$1" test awk | awk echo
+| readonly local "$1" awk test && printf
+/usr/bin cd readonly 'quoted text' -eu local
+		"$@" awk x=1 grep x=1 ${HOME} local 2>/dev/null
+		${HOME} ${HOME} echo ${HOME}
+		${HOME} "$1" grep test $(pwd) ${HOME} done 'quoted text' echo awk readonly 2>/dev/null
+		$(pwd) --verbose "$@" grep | ${HOME} local
+		echo $(pwd) printf | "$1" | ${HOME} awk test
+	'quoted text' ${HOME} --verbose echo --verbose echo ${HOME} done
+	sed x=1 printf x=1 'quoted text' /usr/bin --verbose echo && readonly grep
+		export 'quoted text' && cd -eu local 'quoted text' readonly sed
+$(pwd) export done done echo /usr/bin 2>/dev/null 'quoted text' ${HOME}
+'quoted text' && $(pwd) 2>/dev/null && "$@" "$1"
+		x=1 done awk | ${HOME} test -eu then 'quoted text' grep ${HOME} local
+		awk | then then "$1" printf then printf then $(pwd)
+sed grep "$@" && echo 'quoted text' | test cd sed --verbose echo --verbose
+		echo done x=1 readonly printf cd 'quoted text' readonly "$@" awk printf printf
+x=1 grep 2>/dev/null -eu "$1" cd 2>/dev/null sed awk /usr/bin local echo
+	${HOME} ${HOME} "$@" then cd readonly readonly test
+	"$@" echo 'quoted text' readonly
+echo readonly export then | cd then then then
+	echo then readonly --verbose test readonly
+		"$1" $(pwd) readonly 'quoted text' && sed readonly cd done readonly
+	--verbose /usr/bin "$1" grep
+	readonly export awk done ${HOME} then awk echo "$1"
+2>/dev/null 2>/dev/null $(pwd) echo then export awk readonly /usr/bin echo done
+		&& local test cd "$1" test printf 'quoted text' grep 'quoted text'
+	local "$1" | export 'quoted text' ${HOME}
+	--verbose ${HOME} && "$1" printf
+	| /usr/bin sed local local cd 2>/dev/null cd done echo readonly
+--verbose /usr/bin local &&
+2>/dev/null then $(pwd) $(pwd) printf awk && local $(pwd) 'quoted text'
+		readonly done --verbose awk 'quoted text'
+| "$@" ${HOME} sed x=1 cd readonly ${HOME} printf ${HOME}
+		x=1 grep 'quoted text' --verbose
+		grep done test ${HOME} x=1 export local | "$@" | printf
+${HOME} readonly x=1 awk ${HOME} export ${HOME} "$1" "$@" then local |
+'quoted text' sed ${HOME} readonly local awk -eu 'quoted text'
+"$@" local printf test grep then && grep cd grep sed -eu && cd $(pwd)
+	readonly test -eu && local echo echo printf 2>/dev/null "$@" export
+	'quoted text' "$@" printf x=1 grep && test echo local grep 2>/dev/null
+then 2>/dev/null printf local
+		export echo 2>/dev/null export printf ${HOME} test readonly sed local cd "$1" readonly
+	then "$@" 2>/dev/null grep 'quoted text' printf ${HOME} ${HOME} echo "$1" 'quoted text'
+	done "$@" grep ${HOME} then /usr/bin grep sed test local grep "$@" readonly
+	/usr/bin local 'quoted text'
+grep 2>/dev/null sed "$@" local grep "$@" "$1" echo | -eu local test echo
+		readonly readonly | "$@" local /usr/bin "$1" "$@" grep
+readonly x=1 then 2>/dev/null x=1 "$1" echo | 'quoted text' 2>/dev/null 2>/dev/null
+sed x=1 sed "$@" awk ${HOME} 'quoted text' test done "$@" local
+	printf && test grep echo cd 'quoted text' echo | done
+grep awk "$1" readonly "$@" x=1 then local awk "$1" "$1" "$@" x=1 ${HOME} /usr/bin
+local x=1 local 2>/dev/null printf done
+readonly /usr/bin export local
+${HOME} done echo then awk export
+	2>/dev/null test grep 'quoted text' printf sed x=1 echo awk
+	"$1" readonly printf printf readonly x=1 cd | then sed 'quoted text' -eu
+awk 2>/dev/null local readonly
+export x=1 /usr/bin echo cd cd printf x=1 'quoted text' x=1 ${HOME} done awk
+		readonly printf ${HOME} x=1 ${HOME} ${HOME} sed "$@" "$@" | "$@" 'quoted text'
+then grep then "$1" done test $(pwd) done -eu echo
+-eu --verbose x=1 /usr/bin test --verbose then | $(pwd) && -eu --verbose
+		sed /usr/bin "$@" && sed then | then
+	sed then /usr/bin echo local 'quoted text' export "$1" | awk "$1"
+	awk export $(pwd) --verbose awk 2>/dev/null
+		x=1 /usr/bin -eu /usr/bin && readonly
+then awk /usr/bin echo cd x=1 x=1 && --verbose grep awk ${HOME}
+'quoted text' 2>/dev/null
+test local test readonly x=1 readonly 'quoted text' "$1" | | sed 'quoted text'
+"$1" done | x=1 awk cd -eu | "$1" grep
+		-eu local awk readonly then ${HOME} cd && local grep
+	local 'quoted text' /usr/bin test 'quoted text' | -eu local -eu echo grep /usr/bin
+	"$@" printf --verbose grep sed 'quoted text'
+	test x=1 $(pwd) 2>/dev/null "$@" ${HOME}
+	2>/dev/null 'quoted text' $(pwd) local grep cd echo "$1" export sed grep
+	printf x=1 test x=1 grep $(pwd) awk 'quoted text'
+	sed | x=1 $(pwd) grep
+	export | "$@" awk /usr/bin "$@" 2>/dev/null /usr/bin
+		$(pwd) export local export ${HOME} local
+	readonly export -eu then
+grep -eu sed then local && sed 'quoted text'
+readonly local && ${HOME} && export sed --verbose test test /usr/bin 'quoted text'
+	x=1 | | printf echo ${HOME}
+	printf x=1 | printf readonly grep --verbose
+		x=1 grep $(pwd) echo local -eu 'quoted text' grep $(pwd)
+	${HOME} awk 2>/dev/null 'quoted text'
+printf printf grep "$1"
+${HOME} echo readonly ${HOME} cd cd $(pwd)
+	printf --verbose sed "$@" && $(pwd) then local printf export readonly awk
+cd then 'quoted text' readonly |
+local x=1 local awk done x=1 echo "$1"
+	2>/dev/null "$@" then /usr/bin "$1" 'quoted text' awk /usr/bin x=1 then then grep
+"$1" 2>/dev/null grep && && echo 'quoted text'
+		x=1 'quoted text' done 2>/dev/null
+	| && readonly | | export 2>/dev/null
+		&& 'quoted text' sed
+echo awk "$1" --verbose x=1
+"$@" echo -eu 2>/dev/null --verbose "$@" -eu local &&
+echo awk cd 2>/dev/null $(pwd) local $(pwd) grep done local
+		echo done "$1" printf /usr/bin | -eu $(pwd)
+	--verbose cd | && sed && | cd && x=1 && printf -eu awk
+	test export 2>/dev/null "$1" 'quoted text'
+/usr/bin "$1" /usr/bin test test 'quoted text' local
+echo | export awk -eu /usr/bin
+		then test /usr/bin 2>/dev/null local readonly $(pwd)
+	test 2>/dev/null local echo -eu cd "$1"
+	$(pwd) | -eu echo done readonly -eu
+	"$1" test x=1 x=1 /usr/bin local && readonly echo --verbose
+		x=1 "$@" local x=1 $(pwd) "$1"
+	"$1" then x=1 grep "$@" readonly then ${HOME} grep --verbose
+		local -eu --verbose then /usr/bin && echo "$1" --verbose
+	export /usr/bin 2>/dev/null grep grep local done && local echo x=1 --verbose
+	grep ${HOME} awk cd && then 2>/dev/null ${HOME} export $(pwd) "$@" | export "$@"
+2>/dev/null printf echo &&
+	-eu | echo local then done then ${HOME} "$1" && 2>/dev/null grep sed printf |
+		-eu printf "$1" $(pwd) x=1 -eu /usr/bin | "$@" local export local x=1 /usr/bin
+		printf "$@" test echo readonly | then "$1" test
+	export awk cd readonly | /usr/bin "$@" --verbose
+	cd test && -eu 2>/dev/null echo then "$1" then ${HOME} | | 'quoted text' x=1
+$(pwd) "$1" -eu $(pwd) test done done x=1 x=1 "$@" -eu cd echo
+cd printf awk x=1 echo cd --verbose /usr/bin echo local "$1" export
+	--verbose 2>/dev/null cd "$@" && sed readonly
+	"$@" ${HOME} grep --verbose export local "$1" --verbose
+	grep then printf && 2>/dev/null echo test awk && echo x=1 sed awk $(pwd) "$1"
+		awk done sed "$1" --verbose /usr/bin ${HOME} --verbose
+	${HOME} sed test "$@" then
+	cd printf awk done echo local echo test sed printf printf x=1 export sed --verbose
+cd echo ${HOME} readonly readonly readonly grep
+		"$1" test -eu "$1" 'quoted text' --verbose x=1
+	'quoted text' --verbose $(pwd) cd && && done test
+		done then awk "$1" ${HOME} x=1 | grep
+		"$@" printf readonly /usr/bin export local printf test done test
+	sed 2>/dev/null echo sed grep --verbose sed | --verbose grep
+then "$1" 'quoted text' --verbose local 2>/dev/null ${HOME} ${HOME}
+		"$@" ${HOME} --verbose local -eu local export done awk "$1" sed
+	then && then grep && x=1 printf 'quoted text'
+export export sed local readonly "$@"
+		awk "$@" export /usr/bin export then then echo
+	-eu awk 2>/dev/null --verbose
+	| export awk 2>/dev/null cd -eu local
+x=1 echo sed -eu /usr/bin "$1" done grep cd --verbose
+	then then 'quoted text' export
+--verbose x=1 echo readonly
+done readonly test export readonly $(pwd) /usr/bin -eu
+		x=1 && x=1 | then done -eu && 'quoted text' --verbose
+		&& echo | cd readonly | echo $(pwd) "$1"
+		x=1 cd local echo /usr/bin local ${HOME} "$@"
+	awk $(pwd) x=1 grep test echo then 2>/dev/null | echo done |
+export sed sed done "$@" $(pwd)
+sed done done cd awk test done "$@" "$1" /usr/bin 2>/dev/null
+done sed -eu 2>/dev/null cd export $(pwd) grep "$@"
+	awk readonly | cd -eu ${HOME} 'quoted text' export grep echo export
+sed cd && x=1 done then then 'quoted text' | ${HOME}
+		export 2>/dev/null awk sed done done done && echo test grep
+		sed --verbose $(pwd) echo x=1 "$1" --verbose
+grep "$1" -eu awk $(pwd)
+	then "$@" x=1 cd "$@" ${HOME} grep /usr/bin
+	then awk ${HOME} readonly "$1" test grep grep then
+	2>/dev/null | grep grep /usr/bin --verbose
+		cd $(pwd) awk cd then awk done export awk printf $(pwd) sed 'quoted text' echo
+		then $(pwd) x=1 /usr/bin 2>/dev/null cd readonly sed then
+	'quoted text' 2>/dev/null $(pwd)
+test local done readonly "$@" "$1" done printf sed 2>/dev/null
+x=1 /usr/bin /usr/bin && 2>/dev/null 'quoted text' "$@" local then
+grep ${HOME} 'quoted text' then cd | cd test
+		$(pwd) done $(pwd) cd done x=1 "$@" x=1 awk -eu /usr/bin --verbose export
+	sed awk grep | test | "$1" /usr/bin /usr/bin cd /usr/bin 'quoted text' local
+/usr/bin then x=1 sed done
+		awk "$1" echo local export done x=1 /usr/bin 2>/dev/null -eu
+		printf printf done done ${HOME} printf printf grep cd awk printf | $(pwd)
+		cd done then 'quoted text'
+/usr/bin then test ${HOME} export | local /usr/bin then local | $(pwd) local 'quoted text'
+2>/dev/null done sed done done sed test ${HOME}
+	export export /usr/bin x=1 grep -eu && -eu
+		grep printf done export --verbose echo 'quoted text'
+$(pwd) && 2>/dev/null $(pwd) readonly "$1" readonly
+test sed -eu then --verbose readonly then --verbose export --verbose /usr/bin
+		| export && -eu /usr/bin grep | done cd
+		$(pwd) && printf cd done 'quoted text' "$@"
+-eu printf -eu grep ${HOME} export && 'quoted text' export
+	awk test done readonly local
+		test cd done "$@" && test
+/usr/bin done printf "$@" /usr/bin /usr/bin sed sed awk | sed 'quoted text'
+grep sed $(pwd) then grep | awk && sed sed readonly
+	local local readonly echo done grep sed --verbose grep /usr/bin "$@" $(pwd) |
+		2>/dev/null 2>/dev/null $(pwd)
+		local export export cd ${HOME} && "$1"
+	2>/dev/null -eu local grep | done 2>/dev/null
+		${HOME} "$@" cd export
+--verbose printf --verbose grep x=1 grep "$1" cd x=1 "$@" sed local
+		&& then awk x=1 sed awk ${HOME} $(pwd) then x=1
+"$1" 'quoted text' local awk x=1 awk --verbose --verbose printf $(pwd) -eu printf
+	grep "$1" awk "$1" export printf
+${HOME} echo grep ${HOME}
+		test done 'quoted text' done cd $(pwd) awk readonly --verbose grep then then
+	grep 2>/dev/null && test
+		grep && $(pwd) x=1 test export done local | x=1 | printf
+	export $(pwd) --verbose grep cd -eu readonly x=1 grep
+'quoted text' 'quoted text' "$1" test printf /usr/bin
+		export "$1" sed echo then 2>/dev/null
+| sed "$@" local "$1" echo 2>/dev/null
+grep "$@" "$@" 'quoted text' && then 2>/dev/null awk 'quoted text'
+		"$@" readonly test cd && 2>/dev/null
+		grep 'quoted text' export grep printf
+		"$@" cd grep x=1 then /usr/bin local awk /usr/bin $(pwd) -eu ${HOME} export
+		x=1 grep export --verbose | --verbose | $(pwd) -eu --verbose x=1 | then local
+	/usr/bin x=1 done awk "$1" readonly $(pwd) x=1 sed echo export local
+grep $(pwd) x=1 ${HOME} echo "$1" test && x=1 local done
+	| grep test test readonly done
+	local sed "$1" | ${HOME} grep test then | echo done "$1" && $(pwd)
+	printf export /usr/bin readonly
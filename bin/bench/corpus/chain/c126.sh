@@ -0,0 +1,2001 @@
+		-eu test "$@" export done 'quoted text' done x=1 awk "$1" "$@" --verbose awk 'quoted text'
+		then -eu x=1 | | && echo echo grep grep
+	cd echo local printf sed | x=1 "$@" cd
+		2>/dev/null then "$@" | 2>/dev/null
+		"$1" ${HOME} $(pwd) "$1" grep local $(pwd) cd --verbose ${HOME} printf ${HOME} then
+	test local printf ${HOME} && $(pwd) "$1" grep printf
+test | "$1" done && grep done 2>/dev/null export && 'quoted text'
+printf awk --verbose --verbose then
+"$1" export x=1 sed done "$@" then then cd 'quoted text' /usr/bin readonly
+		grep "$@" $(pwd) readonly cd echo -eu 2>/dev/null
+		awk then local readonly echo printf local 2>/dev/null
+awk printf -eu export x=1 awk 2>/dev/null local printf && /usr/bin && test
+	cd readonly 2>/dev/null "$1" -eu done
+&& /usr/bin printf echo /usr/bin && then "$1" && export
+	local then readonly /usr/bin then done 2>/dev/null printf test readonly
+awk 'quoted text' && sed local --verbose && then
+	/usr/bin | readonly awk && cd echo test
+	done -eu cd readonly | ${HOME}
+printf | "$1" cd 2>/dev/null printf export /usr/bin echo x=1 cd -eu --verbose
+		x=1 grep && 'quoted text' 2>/dev/null readonly done /usr/bin local
+done ${HOME} "$1" | 'quoted text' "$@"
+	--verbose "$@" "$1" --verbose grep
+-eu printf -eu awk "$@" export test echo printf
+	$(pwd) printf -eu test /usr/bin $(pwd) sed readonly
+export readonly | -eu readonly 2>/dev/null
+	sed --verbose printf --verbose 'quoted text' /usr/bin done -eu readonly
+		export x=1 ${HOME} --verbose && readonly "$@"
+"$@" printf local 'quoted text' x=1 printf &&
+printf | sed -eu readonly local readonly && /usr/bin grep sed
+		$(pwd) local ${HOME} cd grep readonly test 2>/dev/null "$1" awk
+	test ${HOME} | then "$@" "$1" done "$@"
+	--verbose done local done sed local local 2>/dev/null
+echo readonly echo "$1" grep 'quoted text' 2>/dev/null
+		'quoted text' echo done cd ${HOME} --verbose --verbose readonly "$@" -eu
+	2>/dev/null -eu "$@" /usr/bin
+		test sed done cd 'quoted text' grep | test grep && then done grep export
+	export awk --verbose then printf "$1" export
+	sed /usr/bin cd ${HOME} x=1 readonly done
+		2>/dev/null x=1 grep 2>/dev/null sed grep ${HOME} export grep
+		cd test cd local ${HOME} "$1" then sed done done --verbose
+"$@" | | local && local x=1 readonly awk readonly test
+printf echo | -eu 'quoted text' cd --verbose cd && export "$1" cd
+		--verbose ${HOME} done export $(pwd) then sed --verbose sed /usr/bin then done -eu
+	| --verbose then "$@" done /usr/bin export done x=1 "$@" 2>/dev/null | $(pwd)
+grep done printf sed printf $(pwd) | export local /usr/bin grep | --verbose
+awk then ${HOME} grep
+2>/dev/null $(pwd) cd export |
+		/usr/bin export | echo 2>/dev/null grep 2>/dev/null local /usr/bin
+	then echo $(pwd) echo /usr/bin 2>/dev/null 2>/dev/null
+	sed then done cd $(pwd) x=1 readonly $(pwd) readonly $(pwd) x=1 | cd x=1 echo
+		local readonly readonly done test --verbose
+then export 'quoted text' local echo x=1 local
+done 'quoted text' printf sed awk "$@" done $(pwd)
+	then && grep grep echo awk "$@" echo grep sed readonly x=1
+	'quoted text' export sed readonly printf "$@" echo -eu "$1"
+local && test readonly grep printf readonly then
+		local && | 2>/dev/null
+	cd "$@" ${HOME} grep done awk "$@" /usr/bin test
+local cd "$1" $(pwd) 2>/dev/null sed x=1 local "$1" test echo export
+	$(pwd) $(pwd) /usr/bin x=1 'quoted text' $(pwd)
+-eu $(pwd) /usr/bin "$1" grep "$@" -eu --verbose export grep sed 'quoted text'
+		| echo export echo cd 2>/dev/null "$1"
+cd 2>/dev/null readonly
+		$(pwd) && --verbose "$@" then sed then 'quoted text' sed | 'quoted text'
+-eu "$@" sed local grep "$1" 'quoted text'
+"$@" grep then then echo printf done awk -eu test 2>/dev/null awk 2>/dev/null cd
+		/usr/bin x=1 readonly $(pwd) "$1" local
+		&& printf readonly readonly grep $(pwd) echo && local ${HOME} --verbose
+$(pwd) cd "$@" 'quoted text'
+	awk test readonly -eu printf && export x=1
+		${HOME} cd $(pwd) cd echo then
+	"$@" export && | awk x=1 ${HOME} awk grep | -eu | printf printf readonly 'quoted text'
+	readonly test --verbose cd test x=1 echo | awk "$1"
+"$@" ${HOME} "$@" --verbose -eu $(pwd) readonly
+${HOME} $(pwd) awk ${HOME}
+		${HOME} $(pwd) grep grep && "$@" "$1"
+	local 2>/dev/null cd 'quoted text' --verbose
+export cd "$@" grep awk then ${HOME} -eu | 2>/dev/null /usr/bin test
+	${HOME} export test 2>/dev/null --verbose $(pwd) cd printf export "$1"
+/usr/bin awk awk grep printf ${HOME} ${HOME} echo -eu $(pwd) "$1" "$@" x=1 --verbose
+readonly then 'quoted text' local awk export sed ${HOME} grep sed test done
+		grep sed export done test
+		sed echo then cd local done done cd readonly cd cd printf
+	export sed 2>/dev/null $(pwd) cd local -eu x=1 printf
+grep x=1 sed awk "$1" cd printf x=1 | test -eu printf export then test
+		test echo printf printf sed readonly awk "$1" grep done local local "$@"
+		x=1 export --verbose /usr/bin -eu awk | export done grep echo -eu done /usr/bin
+	${HOME} | printf grep done x=1
+&& awk x=1 local printf echo /usr/bin "$@" 2>/dev/null "$@" --verbose printf
+		x=1 2>/dev/null -eu grep
+cd cd $(pwd) 'quoted text' readonly ${HOME} then cd --verbose
+/usr/bin "$@" | x=1 sed | export $(pwd) local "$@" awk grep printf --verbose export
+		sed --verbose sed "$1" | grep "$@"
+	printf cd --verbose 2>/dev/null $(pwd) grep
+	--verbose grep $(pwd) cd "$@" then done then
+	"$1" test test done /usr/bin
+		2>/dev/null then export local 'quoted text'
+export sed x=1 grep x=1 printf done ${HOME} export 'quoted text'
+		"$@" local /usr/bin grep test 2>/dev/null local | -eu -eu
+		export "$@" -eu sed then then echo ${HOME}
+local "$1" x=1 "$@" | printf done export && "$1" "$1" cd echo local grep $(pwd)
+$(pwd) export awk && && --verbose x=1 $(pwd)
+		$(pwd) -eu then -eu "$1" test readonly sed
+		2>/dev/null ${HOME} done x=1 test local 2>/dev/null
+		test /usr/bin cd "$@" 2>/dev/null "$@" && | readonly /usr/bin
+then -eu 'quoted text' && echo
+		"$@" /usr/bin cd printf grep printf test 'quoted text' 2>/dev/null
+	local printf "$@" && echo | done "$1" -eu export
+local export 2>/dev/null | printf --verbose
+		local test "$1" "$@" readonly awk 2>/dev/null -eu done /usr/bin printf
+"$@" "$@" echo test x=1 x=1 cd local test grep
+then -eu ${HOME} x=1 $(pwd) readonly | cd $(pwd) done
+		awk test local && then
+		printf && echo echo x=1 done
+		--verbose "$@" local export && ${HOME} x=1 -eu then cd "$@"
+x=1 ${HOME} done 'quoted text' && --verbose && done cd ${HOME} printf echo
+awk "$1" done 'quoted text' cd "$@" echo
+	| "$@" 'quoted text' -eu local --verbose then "$@" echo echo ${HOME}
+		$(pwd) && && -eu ${HOME} 'quoted text'
+echo awk awk grep 'quoted text'
+		/usr/bin cd $(pwd) $(pwd) "$1" "$@" x=1 then local readonly -eu awk && cd then
+readonly local /usr/bin 2>/dev/null "$@" ${HOME} sed -eu x=1 "$1" && readonly
+		x=1 done x=1 -eu "$@" export /usr/bin then
+/usr/bin grep cd --verbose cd /usr/bin grep then cd "$1" /usr/bin && echo printf
+	readonly printf x=1 done grep "$1" printf x=1 ${HOME}
+	export then export sed "$1" | && test $(pwd) /usr/bin
+		printf /usr/bin x=1 test printf && done local "$@" /usr/bin | local
+		--verbose grep | readonly echo readonly "$@" cd awk ${HOME} "$@"
+	--verbose echo "$1" --verbose
+local grep then then 'quoted text' "$1" | test done 'quoted text'
+	sed 2>/dev/null x=1 readonly --verbose export | readonly
+&& | ${HOME} 'quoted text'
+	grep sed $(pwd) | export &&
+	done awk sed test export grep echo "$1" test --verbose 'quoted text'
+	then 'quoted text' 2>/dev/null 2>/dev/null
+	awk 'quoted text' cd local then
+x=1 2>/dev/null $(pwd) x=1 $(pwd) test test cd "$1" test readonly cd
+export sed | export x=1 local 2>/dev/null sed && sed grep export
+local export "$@" /usr/bin $(pwd)
+	2>/dev/null 2>/dev/null $(pwd) 2>/dev/null $(pwd) then /usr/bin done
+		printf -eu && 2>/dev/null && cd grep 'quoted text'
+		then awk $(pwd) echo x=1 printf
+		then then done | 2>/dev/null export ${HOME}
+		| 2>/dev/null x=1 /usr/bin --verbose sed x=1 /usr/bin $(pwd) --verbose
+		echo 2>/dev/null /usr/bin export x=1 && -eu sed local $(pwd) sed cd export
+	-eu readonly | printf $(pwd) awk 2>/dev/null
+	"$@" sed "$1" test test x=1 awk
+	sed echo grep export local -eu $(pwd) echo -eu -eu "$1" test export sed $(pwd)
+		readonly done ${HOME} ${HOME} --verbose
+	--verbose --verbose $(pwd) test 'quoted text'
+	test 2>/dev/null -eu "$1" /usr/bin echo "$@" cd
+		${HOME} test x=1 readonly printf printf sed echo --verbose &&
+		then grep x=1 "$@" awk /usr/bin cd export cd local
+$(pwd) "$1" test /usr/bin -eu "$1" done
+done x=1 done cd && export
+"$1" done local ${HOME} grep export echo x=1 test 'quoted text' x=1 -eu export
+	-eu 2>/dev/null cd local
+	| 'quoted text' $(pwd) readonly --verbose test && cd ${HOME}
+		printf && --verbose "$1" then --verbose test test test printf export $(pwd) /usr/bin
+		${HOME} | 2>/dev/null cd test -eu ${HOME}
+"$1" local then test 'quoted text'
+/usr/bin readonly -eu $(pwd) done test 2>/dev/null sed grep sed echo 2>/dev/null
+grep awk export test "$@" | /usr/bin /usr/bin --verbose readonly
+		test /usr/bin && local && /usr/bin $(pwd) -eu sed sed grep /usr/bin
+	&& grep done "$@" ${HOME} then grep readonly $(pwd)
+	&& && "$@" x=1 2>/dev/null then echo --verbose
+	awk readonly printf cd grep readonly $(pwd) -eu awk done
+export --verbose --verbose $(pwd) printf 2>/dev/null && export printf 2>/dev/null
+		readonly export --verbose sed sed x=1 test && sed local
+		cd local cd test && -eu ${HOME} cd readonly -eu x=1 awk | awk readonly && ${HOME}
+then export then local $(pwd) $(pwd) awk sed then $(pwd) 2>/dev/null
+		--verbose sed 2>/dev/null test /usr/bin readonly ${HOME} | grep printf
+		'quoted text' echo 'quoted text' 2>/dev/null 'quoted text' x=1 x=1 2>/dev/null
+	local echo /usr/bin sed $(pwd) readonly then cd "$@"
+	readonly done "$@" awk awk 2>/dev/null 2>/dev/null "$@" awk
+		grep grep printf -eu "$1" cd
+	--verbose then --verbose echo /usr/bin then
+	'quoted text' local x=1 'quoted text' "$1" sed cd
+		$(pwd) readonly test 2>/dev/null 2>/dev/null "$1"
+	x=1 awk test printf cd -eu test echo && awk grep grep grep cd
+/usr/bin "$1" echo export -eu "$@" "$@"
+		| then /usr/bin 'quoted text' local 2>/dev/null | x=1 then 2>/dev/null 2>/dev/null
+	test sed echo readonly
+| 'quoted text' test "$1" local --verbose /usr/bin
+	test ${HOME} grep local awk
+	2>/dev/null readonly grep "$@" sed printf 2>/dev/null 'quoted text' -eu grep "$1"
+		x=1 then x=1 | export done x=1 --verbose sed /usr/bin "$@" echo awk 2>/dev/null
+		then && && done /usr/bin readonly sed
+	'quoted text' -eu 'quoted text' ${HOME} test
+		-eu x=1 then done 'quoted text' 2>/dev/null grep $(pwd)
+	${HOME} test printf --verbose local
+	done 'quoted text' done done
+	then export 2>/dev/null 2>/dev/null awk 2>/dev/null 'quoted text' local
+then awk done "$1" export readonly
+		-eu readonly then /usr/bin /usr/bin echo awk
+		'quoted text' 'quoted text' sed &&
+awk local printf --verbose printf printf test export export && 'quoted text'
+		export && $(pwd) 2>/dev/null then grep echo $(pwd) readonly ${HOME}
+done --verbose 2>/dev/null readonly local | grep printf sed &&
+		"$@" awk 'quoted text' grep
+	$(pwd) "$@" 2>/dev/null printf 'quoted text' then export
+		printf printf ${HOME} -eu export
+	-eu local then ${HOME} | $(pwd) sed "$@" readonly grep cd done
+	export done awk test ${HOME}
+	grep ${HOME} readonly $(pwd) grep x=1 /usr/bin test
+echo -eu done test && -eu grep done cd "$1" then done /usr/bin
+	readonly grep grep echo --verbose /usr/bin
+		cd -eu export /usr/bin 'quoted text' then "$@" 2>/dev/null
+"$1" printf echo local then awk readonly $(pwd) | x=1 export "$@" echo
+		$(pwd) test cd test x=1 ${HOME}
+printf grep done 2>/dev/null -eu sed sed export sed
+-eu sed printf ${HOME} printf "$@"
+	--verbose sed grep test then "$@" | | | grep sed cd sed 2>/dev/null grep ${HOME}
+	| -eu | -eu | cd test -eu 'quoted text' $(pwd) sed /usr/bin 2>/dev/null
+echo -eu grep ${HOME} &&
+	-eu ${HOME} && -eu cd ${HOME} sed done sed "$@" test done sed done "$@" echo
+done --verbose then "$@" && then readonly "$@" sed 2>/dev/null
+test then && printf local "$1" 'quoted text'
+		cd "$1" export x=1 test grep
+echo $(pwd) -eu && "$1" --verbose
+	echo $(pwd) | --verbose 2>/dev/null ${HOME} /usr/bin
+test 2>/dev/null export | echo
+		readonly /usr/bin sed printf -eu test ${HOME} printf readonly cd
+$(pwd) ${HOME} -eu readonly grep sed cd | local awk test 'quoted text'
+	awk sed -eu && $(pwd) echo /usr/bin /usr/bin "$@" "$@" && cd -eu printf
+	awk grep -eu /usr/bin echo "$@" local && 'quoted text' | ${HOME} export
+		echo "$@" 2>/dev/null
+	done sed x=1 -eu readonly then then /usr/bin sed && ${HOME} "$@" $(pwd) local 'quoted text'
+$(pwd) cd cd then | export | echo test awk then awk --verbose
+		echo --verbose "$@" done 2>/dev/null printf
+sed test --verbose ${HOME} readonly x=1 ${HOME} -eu done
+		done awk | 'quoted text' export sed echo
+	$(pwd) echo && local export export -eu x=1 then grep awk readonly
+readonly x=1 | | awk "$@" awk cd export export -eu -eu "$@" -eu --verbose
+	export sed then x=1 "$@" $(pwd) | --verbose local /usr/bin readonly awk
+		local 2>/dev/null local $(pwd)
+	&& /usr/bin /usr/bin test -eu && grep readonly
+		${HOME} && x=1 local readonly printf ${HOME} | | 'quoted text'
+	export printf export test x=1 'quoted text'
+		&& 2>/dev/null sed sed && sed | /usr/bin "$@" && done 'quoted text' | awk
+		&& "$1" local 'quoted text' "$1" echo test cd 2>/dev/null -eu sed test "$1"
+		&& echo --verbose --verbose "$@" grep sed $(pwd) "$1" test
+awk x=1 test $(pwd) readonly $(pwd) test 'quoted text' cd
+		${HOME} $(pwd) done printf 'quoted text' -eu && awk 'quoted text'
+	"$@" "$@" cd printf cd x=1 cd awk printf cd | test 'quoted text' test
+	printf ${HOME} done done echo | && export awk then "$@"
+printf x=1 grep done -eu readonly readonly grep | --verbose
+then 'quoted text' $(pwd) done /usr/bin
+	-eu --verbose -eu printf $(pwd) 'quoted text' -eu readonly
+		sed awk cd "$@" -eu export then export && grep
+		2>/dev/null | grep done echo grep awk -eu --verbose $(pwd) &&
+		${HOME} grep test local export then x=1
+		cd grep x=1 export "$@" && then awk "$1"
+		echo local 'quoted text' export
+		sed test x=1 x=1 export cd readonly /usr/bin 'quoted text' local readonly
+'quoted text' awk cd awk sed printf "$@"
+/usr/bin local | local "$1" && | then export echo export sed export grep
+printf test "$1" x=1 --verbose then "$1"
+${HOME} sed printf cd "$@" awk printf echo "$1" -eu $(pwd) $(pwd) /usr/bin
+| 'quoted text' local --verbose awk x=1 2>/dev/null
+		x=1 then then | /usr/bin then grep && test printf $(pwd) cd done test
+	"$1" 'quoted text' local done local local test readonly cd sed
+	-eu export grep "$1" awk
+readonly /usr/bin local "$@"
+	2>/dev/null grep sed -eu local echo export done awk --verbose sed
+then "$@" cd 2>/dev/null export echo echo && 2>/dev/null grep x=1 cd grep 'quoted text'
+	-eu readonly awk --verbose
+	export sed "$1" x=1 sed done sed echo
+'quoted text' ${HOME} test then "$@" 2>/dev/null
+	then && then sed -eu awk echo && grep 'quoted text' x=1 test readonly printf "$@"
+	readonly grep test ${HOME} 'quoted text' -eu sed 'quoted text'
+| grep printf export ${HOME}
+export done grep --verbose 'quoted text' sed done
+		local && | then $(pwd) $(pwd) | | done grep echo
+		export ${HOME} -eu export "$@"
+	readonly /usr/bin && --verbose "$1" readonly -eu 2>/dev/null sed done
+	test ${HOME} echo 'quoted text' export ${HOME} awk 2>/dev/null
+		sed ${HOME} done -eu $(pwd) $(pwd) local awk /usr/bin readonly -eu && x=1 -eu 2>/dev/null
+/usr/bin then --verbose "$@" export grep "$1" done test $(pwd)
+	"$@" export local && "$@" printf
+cd x=1 export | cd | done ${HOME} local
+	done then "$@" 'quoted text' && local awk echo "$@" 'quoted text'
+	'quoted text' 2>/dev/null ${HOME} awk | sed test "$@"
+	x=1 sed && echo ${HOME} 'quoted text' sed local local ${HOME}
+		-eu $(pwd) grep local && then test ${HOME} $(pwd) cd done test $(pwd) 2>/dev/null
+		export && then 2>/dev/null done x=1 test sed "$@" ${HOME} "$@" x=1 cd "$1" --verbose
+	| /usr/bin export export echo 2>/dev/null "$1" --verbose done --verbose
+		awk export sed /usr/bin -eu local export | /usr/bin local cd $(pwd) $(pwd) done
+		&& echo export 'quoted text' readonly
+${HOME} x=1 'quoted text' test --verbose "$@" cd | && awk ${HOME}
+local sed test sed test cd /usr/bin printf --verbose "$1"
+	done export awk then grep sed x=1 /usr/bin
+	"$@" 2>/dev/null 2>/dev/null ${HOME}
+test cd 2>/dev/null test && export x=1 x=1 printf -eu /usr/bin
+		'quoted text' -eu --verbose && -eu cd | $(pwd) cd && "$1" test cd &&
+-eu /usr/bin awk local | -eu done --verbose ${HOME} 2>/dev/null then 2>/dev/null
+	--verbose awk local export -eu readonly x=1
+done "$1" && grep local /usr/bin
+| --verbose 2>/dev/null local "$1" done
+		/usr/bin 2>/dev/null "$1" /usr/bin | test 2>/dev/null 2>/dev/null done "$@" ${HOME}
+	x=1 done export local done x=1 ${HOME} 2>/dev/null awk local awk && --verbose
+-eu ${HOME} && /usr/bin "$1"
+	done x=1 | sed x=1 local "$@" | x=1 awk
+	x=1 --verbose "$@" readonly -eu "$@" done echo sed $(pwd) /usr/bin
+2>/dev/null then -eu sed done test echo | readonly test x=1 sed 2>/dev/null
+	-eu readonly --verbose 'quoted text'
+grep printf echo | local grep &&
+		export --verbose x=1 /usr/bin awk && && $(pwd) then
+	2>/dev/null cd test -eu -eu printf "$@" && echo
+		"$@" ${HOME} -eu sed then /usr/bin x=1 test
+		readonly awk printf sed export x=1 2>/dev/null cd
+	--verbose sed then readonly sed echo "$1"
+	grep | -eu --verbose --verbose 2>/dev/null
+		awk $(pwd) /usr/bin printf readonly -eu readonly echo "$@"
+	| local test cd awk awk ${HOME} "$1"
+	--verbose && cd -eu $(pwd)
+sed local 'quoted text' | done "$1" cd readonly $(pwd) $(pwd)
+		| test test | then 2>/dev/null ${HOME} 2>/dev/null
+		done /usr/bin | $(pwd) && ${HOME} && $(pwd) -eu 2>/dev/null readonly
+	sed | echo ${HOME} "$1" "$@" 'quoted text'
+		cd grep grep | "$@" "$@" 'quoted text' -eu readonly then printf then /usr/bin
+		x=1 /usr/bin sed $(pwd) "$1" cd awk printf -eu $(pwd)
+export ${HOME} cd echo readonly
+		&& x=1 $(pwd) awk x=1 /usr/bin then echo 'quoted text' test test ${HOME} grep "$1"
+export ${HOME} --verbose --verbose $(pwd) cd && --verbose && sed then
+$(pwd) done sed grep echo -eu cd grep
+readonly test "$1" /usr/bin | readonly readonly && echo cd test
+2>/dev/null ${HOME} echo grep 'quoted text' $(pwd)
+	x=1 /usr/bin && --verbose echo
+2>/dev/null -eu "$1" -eu && export x=1 done sed sed && --verbose
+		done awk grep | && grep test --verbose
+	cd /usr/bin $(pwd) 'quoted text'
+		cd awk /usr/bin awk readonly "$@" readonly /usr/bin export $(pwd) test --verbose
+	echo export $(pwd) | | export echo 'quoted text' readonly
+printf && ${HOME} echo awk done | "$1" done $(pwd) local x=1 awk "$@" $(pwd)
+--verbose then sed printf $(pwd)
+		--verbose 'quoted text' --verbose -eu cd sed
+		done readonly -eu readonly awk export awk awk
+printf /usr/bin grep -eu done sed cd grep | export awk "$1" done cd then cd
+	$(pwd) --verbose $(pwd)
+		${HOME} x=1 "$1" && cd x=1 printf printf $(pwd) then awk cd 2>/dev/null --verbose
+local sed local -eu --verbose readonly readonly
+	${HOME} -eu ${HOME} test ${HOME} awk readonly awk x=1 echo
+local /usr/bin | "$@" export echo sed printf /usr/bin
+x=1 ${HOME} sed awk "$@" -eu test -eu printf export -eu grep done 2>/dev/null
+		$(pwd) | "$@" $(pwd)
+		cd test done $(pwd) "$@" grep grep sed then && then awk --verbose awk
+'quoted text' done cd | -eu && 2>/dev/null $(pwd)
+	x=1 sed test readonly | "$1" ${HOME} 'quoted text'
+	$(pwd) -eu local sed --verbose --verbose | 'quoted text'
+	'quoted text' printf | "$@" sed && "$@" done | awk 'quoted text' sed
+${HOME} 'quoted text' then grep "$@" ${HOME} -eu echo x=1 export 2>/dev/null ${HOME}
+		$(pwd) cd /usr/bin test sed printf grep --verbose
+&& --verbose 2>/dev/null && --verbose cd done awk readonly "$@"
+	grep $(pwd) $(pwd) grep readonly $(pwd)
+	"$@" local x=1 export local | test grep "$1" test
+$(pwd) echo --verbose test test printf readonly /usr/bin awk echo
+		grep "$1" 2>/dev/null echo -eu local printf then printf
+		'quoted text' $(pwd) 2>/dev/null
+		--verbose && /usr/bin test printf readonly | 'quoted text' cd awk /usr/bin /usr/bin
+		-eu | printf grep && 2>/dev/null
+		grep readonly 'quoted text' -eu printf printf 2>/dev/null
+readonly awk then test done echo | 'quoted text' 2>/dev/null test "$1"
+${HOME} /usr/bin printf test sed export cd awk | $(pwd)
+		--verbose local done sed export "$1" -eu "$1" sed test | readonly
+--verbose -eu ${HOME} | printf ${HOME} -eu 2>/dev/null x=1 --verbose
+		readonly printf cd -eu awk printf export "$@" "$1" printf echo "$@" 'quoted text'
+	"$@" readonly local export $(pwd) local readonly readonly then awk cd
+		local readonly readonly 'quoted text'
+$(pwd) grep 2>/dev/null awk test printf test "$1" cd $(pwd) awk readonly then "$1"
+		&& echo sed "$1" | awk test cd printf ${HOME}
+	&& $(pwd) 2>/dev/null echo 2>/dev/null
+${HOME} x=1 $(pwd) "$1" ${HOME} "$1" $(pwd)
+echo printf 2>/dev/null $(pwd) | | echo readonly | "$1"
+cd 2>/dev/null export $(pwd) ${HOME} /usr/bin then echo | done printf
+'quoted text' "$1" 'quoted text' readonly
+	--verbose grep && cd printf -eu "$1" x=1 -eu cd
+	export done grep echo /usr/bin done test --verbose echo echo
+	echo $(pwd) 'quoted text' test
+		export $(pwd) cd local x=1 then
+local test printf && local --verbose test && --verbose 2>/dev/null $(pwd)
+export export test echo readonly cd local
+/usr/bin readonly grep readonly export | sed sed 2>/dev/null
+	printf sed echo 2>/dev/null
+printf export x=1 test
+done printf local cd awk /usr/bin echo readonly
+		export awk 2>/dev/null done &&
+	grep sed printf grep grep printf test /usr/bin $(pwd) 'quoted text' 'quoted text'
+		grep then 2>/dev/null -eu --verbose printf && && sed printf done -eu | awk
+		| | 2>/dev/null | test printf printf ${HOME} then sed --verbose printf 2>/dev/null
+	export 2>/dev/null awk test && --verbose 'quoted text' readonly grep
+	cd "$@" cd 2>/dev/null printf 2>/dev/null readonly export local export --verbose
+${HOME} echo echo 'quoted text'
+	${HOME} ${HOME} && ${HOME} | done "$1" x=1 export "$@" echo "$@"
+	${HOME} test $(pwd) done grep --verbose grep /usr/bin readonly grep
+test | 'quoted text' 2>/dev/null awk grep "$@" then -eu then /usr/bin
+echo test && grep done grep
+	grep done readonly done
+	echo -eu export local x=1 export && --verbose
+		sed $(pwd) "$@" export "$1" awk echo "$@" -eu export
+	-eu | grep grep awk x=1 && done test
+	--verbose -eu 'quoted text' export /usr/bin printf $(pwd) "$@" done test "$1"
+	&& grep done && ${HOME} "$1"
+		${HOME} done printf grep
+/usr/bin --verbose then export then "$1"
+	echo "$1" awk sed done sed
+	"$1" cd "$@" x=1 then awk && /usr/bin
+printf then export export awk 2>/dev/null x=1 ${HOME} 'quoted text' "$1" echo printf
+--verbose | -eu x=1 grep "$@" "$1" awk test then test && 'quoted text' ${HOME}
+		/usr/bin printf done local printf awk printf 2>/dev/null
+grep sed 'quoted text' cd
+	export printf printf local "$@" &&
+readonly export 'quoted text'
+grep -eu | "$1" grep $(pwd) cd readonly /usr/bin grep | done then local grep &&
+		/usr/bin x=1 done && done printf
+test x=1 awk $(pwd) awk cd x=1 -eu && 2>/dev/null "$1" 'quoted text'
+2>/dev/null "$1" test 2>/dev/null && "$1" | 'quoted text'
+		local 2>/dev/null then ${HOME} "$1" grep export test
+	echo "$1" "$1" -eu export printf "$1" | cd local sed ${HOME}
+		x=1 "$1" echo /usr/bin 2>/dev/null --verbose ${HOME}
+x=1 export then --verbose export readonly
+	"$1" local && grep cd &&
+readonly local "$1" /usr/bin && 2>/dev/null "$1" sed "$1" --verbose
+printf ${HOME} --verbose then 2>/dev/null
+		printf /usr/bin /usr/bin "$1" then awk sed
+		export done grep printf
+test awk /usr/bin --verbose done -eu readonly --verbose /usr/bin awk echo $(pwd)
+2>/dev/null 2>/dev/null cd done export && 'quoted text' grep 'quoted text' done
+/usr/bin && $(pwd) 'quoted text' printf x=1 2>/dev/null
+		cd done 2>/dev/null --verbose awk | done 'quoted text' sed
+2>/dev/null echo local -eu readonly | x=1
+	/usr/bin "$@" ${HOME} readonly && echo ${HOME}
+		local readonly $(pwd) then printf | -eu
+		${HOME} export printf export grep -eu --verbose
+		'quoted text' awk awk printf $(pwd) 'quoted text'
+	x=1 echo echo local local ${HOME} echo
+readonly echo -eu -eu export awk -eu local then x=1 'quoted text' readonly
+		2>/dev/null local -eu && $(pwd) echo -eu readonly 'quoted text' sed
+		awk 2>/dev/null sed readonly |
+		--verbose /usr/bin printf && cd ${HOME}
+	| && | printf export local ${HOME} "$@" ${HOME} 'quoted text'
+	local 'quoted text' export local --verbose sed /usr/bin 'quoted text'
+		then -eu ${HOME} sed
+		"$@" grep "$1" | 2>/dev/null done export $(pwd)
+		${HOME} echo && grep --verbose "$@" 'quoted text' printf local /usr/bin done "$@"
+	$(pwd) 2>/dev/null $(pwd) $(pwd) "$@" done cd $(pwd) && cd readonly
+		${HOME} cd printf export export readonly test
+		local test "$1" done local $(pwd) awk "$@" -eu sed 'quoted text' cd 'quoted text'
+"$@" local 'quoted text' $(pwd) local "$1" done "$1" then printf -eu
+x=1 | --verbose | cd 'quoted text' then cd
+		done 'quoted text' x=1 x=1 ${HOME} awk sed cd grep x=1 echo 'quoted text'
+	cd readonly echo -eu /usr/bin "$@" $(pwd) printf grep readonly
+		local 'quoted text' test "$1" sed grep -eu printf grep echo awk --verbose
+echo ${HOME} export 'quoted text'
+		awk 'quoted text' && echo export | awk
+	awk -eu echo ${HOME} --verbose
+readonly "$1" /usr/bin readonly | 'quoted text' $(pwd) | export -eu
+	awk 2>/dev/null readonly ${HOME} 'quoted text' --verbose readonly /usr/bin
+		${HOME} && echo ${HOME} 2>/dev/null ${HOME} sed then cd x=1 -eu && ${HOME}
+		2>/dev/null --verbose
+	test local /usr/bin $(pwd)
+	echo && local cd | local $(pwd) ${HOME} /usr/bin then done 'quoted text'
+		awk local 'quoted text' done x=1
+		cd && done --verbose | 'quoted text' local printf
+x=1 2>/dev/null --verbose done printf | done
+		/usr/bin $(pwd) printf printf local export 2>/dev/null readonly -eu echo
+	| --verbose | test $(pwd) cd printf echo then readonly
+	'quoted text' 'quoted text'
+		'quoted text' done sed -eu x=1 2>/dev/null 2>/dev/null 'quoted text' 2>/dev/null
+		printf then export 2>/dev/null
+grep $(pwd) "$@" 'quoted text' $(pwd) readonly then $(pwd) -eu 2>/dev/null
+	${HOME} 2>/dev/null cd --verbose echo
+	cd "$@" sed echo printf sed "$1" export awk ${HOME} x=1 then 2>/dev/null --verbose
+echo echo grep readonly 2>/dev/null awk sed
+--verbose export -eu /usr/bin done 2>/dev/null done sed test
+/usr/bin sed 'quoted text' 'quoted text' 'quoted text'
+x=1 test --verbose && cd ${HOME} local readonly ${HOME} sed 'quoted text' export
+		done then then | --verbose 'quoted text'
+grep --verbose ${HOME} sed ${HOME} printf local grep then export cd && -eu
+	${HOME} | $(pwd) --verbose
+		then printf local "$@" 2>/dev/null
+	| then -eu x=1 export && test && test "$@" /usr/bin -eu --verbose
+$(pwd) $(pwd) test export local | printf echo "$@" $(pwd)
+${HOME} grep done ${HOME} /usr/bin local -eu then awk cd
+	| 2>/dev/null /usr/bin printf -eu ${HOME} -eu echo "$1"
+'quoted text' x=1 grep then 2>/dev/null 2>/dev/null grep
+	'quoted text' -eu "$@" done awk local "$@" 'quoted text' export x=1 $(pwd)
+		--verbose test /usr/bin test cd && --verbose
+		export x=1 x=1 /usr/bin "$@" readonly "$1" | "$@" x=1 | x=1 "$@" echo
+	local sed "$@" 2>/dev/null ${HOME} echo grep printf awk x=1 "$1" test sed "$1"
+-eu ${HOME} grep awk -eu then 2>/dev/null done "$1" | | --verbose
+		done "$@" readonly grep done then echo "$@" readonly | ${HOME}
+	readonly local test x=1 printf grep -eu echo /usr/bin export test /usr/bin
+		--verbose done && test x=1 readonly x=1 ${HOME} cd local x=1
+	2>/dev/null /usr/bin && 2>/dev/null test grep x=1 then 'quoted text'
+		done | /usr/bin grep readonly local grep "$1" export 'quoted text' cd echo 'quoted text'
+		| $(pwd) echo | "$@" export grep /usr/bin
+		grep "$1" "$1" --verbose 2>/dev/null then "$1" readonly test
+| && -eu echo -eu export && sed
+	"$@" /usr/bin 2>/dev/null "$@" x=1 'quoted text' x=1 export "$@"
+cd $(pwd) grep -eu -eu x=1 export x=1 && x=1 readonly
+grep grep | test grep test export local
+'quoted text' --verbose
+done 'quoted text' awk then then && sed 'quoted text' echo grep sed sed
+	test && then local x=1 | /usr/bin 'quoted text'
+awk --verbose "$1" readonly printf --verbose /usr/bin grep ${HOME}
+-eu --verbose && -eu "$@" ${HOME} && --verbose
+-eu echo "$1" /usr/bin local sed
+done ${HOME} $(pwd) sed && awk -eu then -eu then done done x=1 printf
+		$(pwd) x=1 awk cd sed && "$1" 'quoted text' echo readonly --verbose -eu test
+grep | local 'quoted text'
+grep test -eu echo cd grep $(pwd) x=1 x=1 echo local 'quoted text'
+		&& /usr/bin then -eu done grep echo grep export &&
+		printf readonly "$1" 2>/dev/null then local "$1" awk 'quoted text' ${HOME} 2>/dev/null
+	awk 2>/dev/null local echo
+	--verbose test "$1" readonly 'quoted text' grep then
+		2>/dev/null echo test && "$1" $(pwd) | awk "$@" -eu -eu "$@" $(pwd)
+	then awk export echo 'quoted text' x=1 then $(pwd) sed awk then sed $(pwd)
+$(pwd) local 2>/dev/null sed grep readonly $(pwd) 2>/dev/null
+printf "$@" | && -eu -eu export "$1" 2>/dev/null /usr/bin /usr/bin -eu ${HOME}
+export sed 2>/dev/null /usr/bin export 2>/dev/null -eu
+-eu x=1 -eu echo --verbose done "$@" /usr/bin local sed
+	readonly 2>/dev/null test grep done local /usr/bin export export x=1 'quoted text'
+		awk then grep 'quoted text' "$@" --verbose $(pwd) echo test
+		awk -eu done $(pwd) 2>/dev/null export readonly "$1" done ${HOME}
+	sed ${HOME} cd test --verbose readonly test export readonly echo
+		test $(pwd) 'quoted text' test 2>/dev/null
+	-eu cd export -eu /usr/bin | -eu 'quoted text' test $(pwd) "$@"
+	${HOME} 2>/dev/null 'quoted text' | | sed "$1" --verbose 2>/dev/null
+grep ${HOME} done --verbose cd grep
+	cd done sed local x=1 x=1 ${HOME} then ${HOME} 'quoted text'
+		-eu 2>/dev/null export test && 2>/dev/null
+	/usr/bin cd readonly cd $(pwd) 'quoted text'
+		-eu -eu printf && | grep printf export "$1" readonly then
+		export echo local 2>/dev/null local
+	echo echo /usr/bin sed local /usr/bin x=1
+	| 'quoted text' && 2>/dev/null readonly --verbose echo local 'quoted text' "$@"
+	done sed readonly then echo done sed
+		${HOME} 'quoted text' ${HOME}
+	${HOME} | sed 2>/dev/null
+${HOME} cd -eu readonly -eu "$1"
+local 'quoted text' -eu sed x=1 export test grep export --verbose
+	readonly x=1 grep then | export export
+	awk then "$1" /usr/bin | grep $(pwd) --verbose done "$1" "$@" x=1 export
+	awk then 'quoted text' -eu then --verbose then export
+done awk grep -eu ${HOME} test 'quoted text'
+		export grep grep ${HOME} 2>/dev/null --verbose /usr/bin | sed sed export
+		sed ${HOME} grep 'quoted text'
+/usr/bin grep 2>/dev/null grep $(pwd) && "$1" -eu 'quoted text'
+local readonly printf readonly "$@" export awk readonly "$@" x=1 && 'quoted text'
+		'quoted text' ${HOME} "$@" 2>/dev/null done
+		printf $(pwd) readonly then $(pwd) --verbose
+	local local 2>/dev/null /usr/bin "$1" -eu
+		--verbose 'quoted text' 'quoted text' /usr/bin awk && sed cd test
+	sed x=1 done -eu echo -eu then 'quoted text' then then "$@" cd local echo |
+	${HOME} awk sed $(pwd) readonly x=1 -eu x=1 awk printf --verbose $(pwd)
+		${HOME} readonly readonly printf
+| echo awk printf 'quoted text' "$1" grep
+	| /usr/bin test --verbose echo && readonly readonly local && |
+	printf && $(pwd) cd x=1 printf local readonly "$@" done
+		${HOME} local echo "$1" export
+-eu x=1 x=1 "$@" export && export &&
+		/usr/bin -eu cd sed echo
+2>/dev/null | printf sed x=1 && 'quoted text' 'quoted text' ${HOME} | cd $(pwd)
+		echo ${HOME} 'quoted text' --verbose && "$@" 'quoted text' $(pwd) export cd "$1"
+sed --verbose "$1" awk | x=1 -eu && export
+	"$1" 2>/dev/null cd cd export
+	local $(pwd) && cd readonly
+'quoted text' echo 2>/dev/null 'quoted text' cd cd
+		${HOME} test 2>/dev/null x=1 $(pwd) $(pwd) echo 'quoted text' | done
+		cd $(pwd) 'quoted text' --verbose export 'quoted text' x=1
+export -eu export 'quoted text' | $(pwd) "$@"
+	test cd | test export printf export then done ${HOME} echo "$@" done
+	awk echo 2>/dev/null 2>/dev/null
+		| "$1" ${HOME} grep grep -eu --verbose
+	export | /usr/bin sed x=1 test -eu printf
+	2>/dev/null | x=1 local local export
+	"$@" "$1" "$@" x=1 --verbose echo readonly "$1" echo --verbose "$1" && readonly
+		done cd then readonly done --verbose && local --verbose "$1" 2>/dev/null
+done "$@" printf $(pwd)
+cd printf | grep printf echo | local sed grep 'quoted text'
+		-eu sed "$1" "$@" 2>/dev/null cd "$1" | done
+		grep $(pwd) cd grep grep then /usr/bin /usr/bin &&
+echo --verbose ${HOME} echo "$1" -eu printf x=1 done
+awk "$1" $(pwd) local "$1" printf done grep test local |
+local && readonly cd then
+		x=1 $(pwd) $(pwd) --verbose sed "$1" 'quoted text' sed test done
+x=1 echo "$1" $(pwd) awk x=1 readonly
+	-eu --verbose /usr/bin test --verbose && export printf sed sed
+		"$@" && readonly "$@" | ${HOME} -eu /usr/bin local $(pwd) x=1 grep echo
+x=1 readonly awk local 2>/dev/null -eu -eu echo 'quoted text' && x=1
+		${HOME} 2>/dev/null export "$1" "$1" "$@" && | && 'quoted text' && ${HOME}
+		--verbose export export $(pwd) awk readonly
+		${HOME} ${HOME} && $(pwd) printf echo 'quoted text' cd printf test awk
+readonly grep readonly /usr/bin $(pwd) "$1" printf "$1"
+	&& local done cd /usr/bin grep && done cd local $(pwd)
+grep 'quoted text' -eu && test then ${HOME} 2>/dev/null ${HOME} cd 2>/dev/null
+	&& /usr/bin local awk 'quoted text' $(pwd) awk grep --verbose "$@" export
+		x=1 $(pwd) && sed then then
+	awk printf sed test 'quoted text'
+	printf export $(pwd) 'quoted text' | && "$@" && && 2>/dev/null readonly -eu "$1"
+	${HOME} 'quoted text' printf ${HOME} $(pwd) printf test sed 'quoted text'
+		then test --verbose x=1 -eu grep | readonly export /usr/bin done "$@" ${HOME}
+	x=1 cd | test readonly export then test
+2>/dev/null local export awk grep test export -eu "$@" ${HOME}
+	/usr/bin --verbose export printf done "$@" 2>/dev/null "$1" grep --verbose
+	&& 2>/dev/null cd "$@" 'quoted text' test
+	&& sed then done sed awk local local
+		'quoted text' sed cd && sed -eu echo x=1 done cd local
+	-eu -eu "$1" "$1" 'quoted text' "$@"
+		printf "$1" $(pwd) 2>/dev/null
+	export ${HOME} && /usr/bin readonly then export "$1"
+printf 'quoted text' ${HOME} | awk $(pwd)
+local $(pwd) "$@" sed "$@" 2>/dev/null local 2>/dev/null
+	test -eu local $(pwd) x=1 export --verbose /usr/bin /usr/bin
+	/usr/bin echo 'quoted text' printf x=1 /usr/bin test -eu local --verbose
+	'quoted text' /usr/bin -eu $(pwd) awk awk ${HOME}
+	"$@" | done --verbose -eu awk test
+${HOME} export 2>/dev/null /usr/bin sed awk test then
+then sed && grep awk | then x=1 "$@" && printf
+		$(pwd) readonly && --verbose | test /usr/bin -eu ${HOME} 2>/dev/null printf
+sed awk then x=1 "$@" ${HOME} --verbose 2>/dev/null
+		printf && cd export local
+		/usr/bin 2>/dev/null done 'quoted text'
+/usr/bin x=1 && printf ${HOME} done $(pwd) test "$@" "$1" then printf
+		test 'quoted text' "$@" -eu grep printf
+		-eu ${HOME} echo export | grep "$@" --verbose -eu 2>/dev/null
+		echo awk 'quoted text' local "$1" then printf
+	done --verbose echo test 'quoted text' --verbose
+		then export /usr/bin
+"$1" 'quoted text' "$@" 'quoted text' cd x=1 'quoted text' "$@" | test test
+--verbose --verbose cd | $(pwd)
+		| ${HOME} 2>/dev/null $(pwd) then done then cd |
+	"$1" done "$1" test && printf grep echo
+	export 2>/dev/null test printf done "$@" /usr/bin grep then
+/usr/bin -eu "$@" grep 2>/dev/null --verbose grep --verbose
+	cd local readonly echo grep ${HOME} then
+		--verbose test 'quoted text' test -eu done $(pwd) "$1" then readonly x=1 /usr/bin
+	-eu readonly printf test "$@" 2>/dev/null -eu local --verbose then printf
+awk cd sed local $(pwd) | | printf $(pwd) grep
+		printf x=1 printf done readonly printf done export $(pwd) "$1" export readonly 'quoted text'
+	/usr/bin export printf test --verbose "$@" /usr/bin
+	test $(pwd) grep --verbose 'quoted text' then echo "$1" export cd $(pwd)
+cd awk awk cd x=1 "$1"
+		done "$@" readonly x=1 x=1 --verbose printf && -eu x=1 then awk 2>/dev/null
+		"$@" 'quoted text' 'quoted text' export x=1 awk sed "$@"
+	"$@" 2>/dev/null then 2>/dev/null sed awk sed export 'quoted text' test
+		| $(pwd) ${HOME} "$1" printf ${HOME} &&
+	awk local --verbose readonly done x=1 $(pwd) done
+	grep grep 2>/dev/null --verbose $(pwd) test ${HOME}
+		grep --verbose --verbose "$@" | export export readonly grep ${HOME} x=1
+		"$@" && 2>/dev/null x=1 grep readonly
+	cd && sed export "$1" 2>/dev/null sed
+/usr/bin $(pwd) --verbose 2>/dev/null grep --verbose
+		readonly "$@" awk local ${HOME} "$@"
+	&& x=1 x=1 "$1" grep -eu then printf "$1" then awk "$@"
+'quoted text' -eu sed /usr/bin awk "$@" x=1 then
+		readonly then then $(pwd) && /usr/bin /usr/bin cd local "$@" && "$@" &&
+		done --verbose awk readonly --verbose test
+		$(pwd) ${HOME} "$@" x=1 echo readonly readonly "$1"
+	awk x=1 /usr/bin test x=1 -eu && --verbose "$@" && awk "$@" cd printf printf
+sed export -eu && awk 2>/dev/null
+		cd -eu readonly test 2>/dev/null done awk then
+	local sed readonly grep readonly
+		${HOME} 'quoted text' done | | test ${HOME} readonly
+	--verbose grep --verbose | $(pwd) done readonly x=1 x=1 awk
+"$@" cd $(pwd) -eu ${HOME} /usr/bin
+--verbose export cd echo sed readonly "$@" then then | awk "$@" /usr/bin cd local
+	'quoted text' "$1" "$1" -eu echo readonly echo /usr/bin
+		--verbose grep 'quoted text' "$@" ${HOME} $(pwd) grep 'quoted text' --verbose
+cd 2>/dev/null then -eu test | $(pwd) grep printf export
+	cd sed readonly && readonly readonly then export local "$1" "$1" && then local
+awk sed 2>/dev/null awk "$1" grep $(pwd) export -eu
+		then readonly 2>/dev/null local echo x=1 $(pwd) sed
+		local done "$1" | awk export test sed $(pwd) echo
+"$1" test && && "$@" cd 2>/dev/null 'quoted text'
+	printf readonly done cd sed -eu /usr/bin | 2>/dev/null "$@" readonly -eu $(pwd)
+	sed "$1" export --verbose
+	"$@" /usr/bin test $(pwd) sed then local local 2>/dev/null cd | cd awk done grep
+x=1 export sed local -eu ${HOME} local test test "$1" | grep | && done cd readonly
+done 2>/dev/null x=1 ${HOME} ${HOME} awk cd -eu 2>/dev/null && cd then
+2>/dev/null export | readonly done "$1" 2>/dev/null
+	${HOME} test cd done | ${HOME} awk ${HOME} printf then readonly then -eu
+	printf && "$@" /usr/bin ${HOME} export ${HOME} test grep cd then "$1"
+		$(pwd) ${HOME} grep | then cd ${HOME} then cd 2>/dev/null local printf
+		&& | | --verbose x=1 echo /usr/bin
+		-eu "$1" done 'quoted text' test 'quoted text' && local /usr/bin "$@" echo "$1"
+	2>/dev/null local 'quoted text'
+	done $(pwd) x=1 readonly echo echo echo x=1 ${HOME} awk
+		awk awk then $(pwd) echo /usr/bin /usr/bin test awk x=1 | awk awk
+readonly | done export test "$@" 'quoted text' echo
+		"$1" -eu local then "$1" | 2>/dev/null
+local 2>/dev/null grep echo awk -eu local 2>/dev/null ${HOME} test local
+		sed test awk awk readonly "$1" grep && export awk
+| done --verbose "$1" test /usr/bin export
+local echo | test done then -eu grep | done
+		/usr/bin sed printf readonly done cd export
+	test export ${HOME} x=1 -eu
+	| cd cd && x=1 grep export 2>/dev/null -eu 'quoted text' printf ${HOME} $(pwd)
+local grep cd ${HOME} readonly | "$@"
+sed && grep "$@" awk then then local -eu cd local 2>/dev/null readonly x=1 printf
+		printf /usr/bin | "$@" && export local awk awk && printf | x=1 x=1
+		printf 2>/dev/null export 2>/dev/null
+	| echo --verbose $(pwd) -eu
+		awk x=1 $(pwd) $(pwd) awk
+	readonly "$1" local $(pwd) test then test | x=1 export done export /usr/bin
+"$1" "$1" awk printf echo
+	$(pwd) done export 'quoted text' sed | -eu | $(pwd) ${HOME} 2>/dev/null "$@"
+	sed && $(pwd) | cd then 'quoted text'
+done /usr/bin | -eu printf && | && readonly readonly ${HOME} done -eu
+		echo echo ${HOME} "$@" cd /usr/bin done "$@" export awk readonly | ${HOME} test
+"$@" ${HOME} export export sed 2>/dev/null
+		${HOME} -eu /usr/bin test awk x=1 /usr/bin awk --verbose done
+echo grep echo then echo --verbose -eu then $(pwd) | printf -eu
+	grep printf printf "$1" "$1" -eu "$1" 'quoted text'
+		done printf -eu printf cd grep sed
+awk --verbose -eu | /usr/bin echo x=1 then printf grep done readonly
+		| -eu "$@" | grep awk "$@"
+	| then sed ${HOME} done grep export -eu sed awk readonly --verbose readonly
+		export && --verbose awk /usr/bin readonly done x=1 test done
+--verbose x=1 local --verbose
+	export -eu export 2>/dev/null /usr/bin then then | 2>/dev/null local
+	-eu echo awk "$@" | readonly local
+	| done export grep ${HOME} echo /usr/bin printf echo x=1
+		cd | echo x=1 "$1" && ${HOME} | cd 'quoted text'
+	readonly /usr/bin x=1 "$@" && && | -eu && then local --verbose -eu "$@"
+	done test "$1" sed "$@" cd test | x=1 -eu grep && cd awk cd cd printf
+		--verbose -eu sed x=1 cd then -eu local $(pwd) 'quoted text' -eu readonly
+cd printf then echo grep $(pwd)
+x=1 x=1 "$1" --verbose $(pwd) -eu -eu awk done "$1"
+	/usr/bin /usr/bin echo && export -eu $(pwd) test printf
+		cd printf $(pwd) -eu ${HOME} test echo 'quoted text' -eu local printf
+		&& -eu test echo 2>/dev/null --verbose sed grep printf 'quoted text'
+		sed sed readonly local ${HOME} $(pwd) awk local grep $(pwd) then "$1" $(pwd) --verbose
+	&& test x=1 echo test done sed export
+	2>/dev/null sed | grep awk readonly 2>/dev/null then readonly 2>/dev/null
+	--verbose /usr/bin sed
+		readonly -eu local "$1" /usr/bin
+		"$@" --verbose --verbose $(pwd) sed cd -eu sed
+		'quoted text' "$1" test 'quoted text' $(pwd) 'quoted text'
+	test ${HOME} "$@" local
+		echo && && 'quoted text' "$1" --verbose awk printf ${HOME} $(pwd) printf export
+		&& echo export --verbose echo readonly "$1"
+	x=1 local awk 2>/dev/null done --verbose ${HOME}
+		sed --verbose -eu cd -eu printf | | test && "$@" "$1" cd test
+	awk /usr/bin && done 'quoted text' -eu -eu grep cd awk "$1" 2>/dev/null
+done done export readonly then | $(pwd) -eu x=1 printf
+done -eu awk awk 'quoted text' x=1 'quoted text'
+	2>/dev/null "$@" echo "$@" && awk "$@" && awk printf -eu test grep x=1
+&& readonly && ${HOME} x=1 ${HOME} "$1" "$@" cd
+cd 2>/dev/null awk done cd done $(pwd) local done 'quoted text' cd $(pwd)
+		'quoted text' awk -eu && test echo $(pwd) ${HOME} "$@" then cd 2>/dev/null
+	test grep local && cd ${HOME}
+	then grep "$1" "$@" awk then -eu /usr/bin -eu test export then /usr/bin
+	test --verbose test 2>/dev/null export cd printf --verbose test
+awk "$1" --verbose test then cd export cd | /usr/bin echo
+	grep test $(pwd) "$1" sed then
+		grep done echo export local printf
+--verbose 2>/dev/null printf 'quoted text' $(pwd) "$1" readonly /usr/bin
+${HOME} && 2>/dev/null /usr/bin -eu cd awk
+		| awk "$@" && ${HOME} "$1" /usr/bin grep grep /usr/bin ${HOME}
+		then grep x=1 /usr/bin
+	then x=1 done grep then --verbose grep -eu ${HOME} /usr/bin | ${HOME}
+	awk echo export awk $(pwd) cd export ${HOME} /usr/bin printf grep
+	-eu echo then 2>/dev/null x=1 awk
+		| ${HOME} readonly "$1" $(pwd) test
+"$@" awk 2>/dev/null /usr/bin | /usr/bin done
+		| echo -eu readonly export /usr/bin -eu x=1 ${HOME} cd cd local "$1" awk x=1
+	'quoted text' printf x=1 --verbose
+		echo x=1 sed local then 2>/dev/null awk
+		cd export $(pwd) readonly
+	| ${HOME} $(pwd) ${HOME} grep sed awk echo -eu "$@" awk local echo cd cd local
+	--verbose "$@" 'quoted text' -eu cd then grep awk | cd
+		&& cd /usr/bin then | /usr/bin sed 'quoted text'
+		'quoted text' done x=1 then
+	${HOME} awk sed 'quoted text' 'quoted text'
+${HOME} test "$1" x=1 readonly --verbose
+local 'quoted text' printf printf cd 2>/dev/null local local "$1"
+	&& x=1 printf $(pwd) then x=1 printf && 'quoted text' "$1" printf grep
+		done -eu 'quoted text' -eu done export printf local |
+"$@" x=1 printf cd echo | echo "$@" && test "$1" ${HOME} readonly
+	"$@" -eu -eu 2>/dev/null "$1" export -eu x=1
+		cd sed echo 'quoted text' awk | $(pwd)
+	sed readonly /usr/bin -eu readonly cd 2>/dev/null grep 'quoted text'
+		$(pwd) awk test cd |
+	sed 'quoted text' cd local
+		awk done sed && export
+	awk 'quoted text' test readonly "$@" export /usr/bin readonly export grep grep
+grep "$@" awk $(pwd) sed export -eu 2>/dev/null export printf 2>/dev/null local
+		'quoted text' $(pwd) $(pwd) /usr/bin -eu --verbose
+readonly --verbose && sed
+		export && 'quoted text' && x=1 cd x=1 && sed $(pwd) "$1" "$1" 'quoted text'
+		done sed grep then awk 2>/dev/null awk "$1" readonly
+		/usr/bin && 2>/dev/null test printf then | echo |
+	$(pwd) printf "$1" -eu awk $(pwd)
+	cd then "$@" 2>/dev/null x=1 readonly test export sed done | local
+| | sed sed $(pwd) ${HOME} then 'quoted text' cd
+	local sed | && ${HOME} printf done | test sed local
+	-eu readonly "$1" $(pwd) | --verbose -eu "$1"
+		local x=1 ${HOME} 'quoted text' printf 2>/dev/null "$1" test local done x=1 'quoted text'
+		sed awk "$@" x=1 awk sed readonly readonly local $(pwd) -eu 'quoted text'
+done $(pwd) | sed export 'quoted text' $(pwd) $(pwd) /usr/bin export grep printf
+	x=1 local echo | sed readonly printf test "$@"
+		grep test grep /usr/bin readonly test x=1 cd -eu --verbose test
+		-eu "$1" $(pwd) "$@" && export x=1 grep local 'quoted text'
+	cd /usr/bin --verbose /usr/bin
+		/usr/bin | test "$1" &&
+	${HOME} ${HOME} /usr/bin sed then export export "$1" done "$@" cd cd x=1 grep
+&& echo 'quoted text' awk printf 2>/dev/null "$@"
+		$(pwd) readonly test | then awk readonly 'quoted text' ${HOME}
+	done awk grep && local && "$@"
+	$(pwd) $(pwd) grep grep "$@" | $(pwd)
+	${HOME} local cd 2>/dev/null "$@" 2>/dev/null grep sed sed
+		$(pwd) "$1" x=1 sed $(pwd) --verbose sed readonly then
+		local 'quoted text' then
+	sed && grep x=1 readonly readonly --verbose
+	local "$@" && awk 2>/dev/null
+		sed cd x=1 awk awk cd test printf then ${HOME} readonly cd x=1 awk
+	/usr/bin readonly 'quoted text' --verbose /usr/bin -eu 2>/dev/null
+	/usr/bin cd printf $(pwd)
+		2>/dev/null ${HOME} | test printf 'quoted text' 'quoted text' && echo test
+local local 'quoted text' printf test
+test x=1 then awk grep && -eu grep /usr/bin "$@" test
+	-eu "$@" test export /usr/bin local done
+		then | | echo --verbose export export
+sed echo 2>/dev/null /usr/bin && /usr/bin readonly --verbose
+		local then sed "$@" awk | $(pwd) | "$@" ${HOME} done ${HOME} cd | cd ${HOME} then
+		export local awk echo then grep then done "$1" local
+-eu printf export "$1" &&
+	echo awk sed cd --verbose grep ${HOME} awk /usr/bin "$@" 'quoted text'
+		readonly "$@" export $(pwd) -eu /usr/bin grep echo done then /usr/bin sed grep grep
+local ${HOME} | /usr/bin cd printf
+${HOME} then x=1 done printf 2>/dev/null
+-eu 2>/dev/null printf x=1 awk awk -eu done -eu | grep then awk
+		$(pwd) | ${HOME} 2>/dev/null --verbose export sed x=1 test 'quoted text' 2>/dev/null
+		--verbose readonly then
+		awk $(pwd) -eu printf 'quoted text' export grep
+x=1 "$1" grep done x=1 ${HOME} sed 2>/dev/null
+2>/dev/null && "$1" && 2>/dev/null "$1" $(pwd) $(pwd) echo
+		$(pwd) printf then 2>/dev/null awk echo grep && sed | -eu then printf /usr/bin
+		x=1 echo | $(pwd) sed $(pwd) done ${HOME}
+cd then ${HOME} local 2>/dev/null grep
+	echo "$@" local -eu -eu test --verbose readonly -eu readonly 2>/dev/null
+		2>/dev/null printf x=1 done
+"$@" "$@" grep done echo readonly x=1 grep /usr/bin /usr/bin printf
+		export | "$@" printf /usr/bin | test awk &&
+&& grep /usr/bin cd cd sed 'quoted text' readonly cd -eu echo ${HOME} done done
+		readonly && local then 'quoted text' | | export | printf --verbose then
+	export test local local readonly local 2>/dev/null
+readonly 2>/dev/null && 2>/dev/null
+		x=1 $(pwd) done && cd && echo
+		sed printf then "$@" 'quoted text'
+		printf && 2>/dev/null readonly then "$1" 'quoted text'
+		"$1" $(pwd) x=1 local | "$1" --verbose &&
+	2>/dev/null sed --verbose echo then export sed printf
+/usr/bin sed /usr/bin ${HOME}
+"$@" | $(pwd) test 2>/dev/null $(pwd) then
+		$(pwd) cd x=1 --verbose -eu && --verbose
+		export | 'quoted text' /usr/bin 'quoted text'
+awk ${HOME} grep local && /usr/bin "$@"
+		| awk "$1" cd 'quoted text' export
+echo x=1 "$@" local | --verbose "$@" -eu then readonly "$@" --verbose
+		$(pwd) printf x=1 test readonly
+	local && x=1 export $(pwd) && echo echo -eu -eu ${HOME}
+	&& then done 2>/dev/null awk "$1" test 'quoted text' ${HOME} test sed
+		$(pwd) echo local -eu x=1
+		local --verbose done 2>/dev/null done $(pwd) done export x=1 | test --verbose
+		cd readonly $(pwd) sed "$1" awk /usr/bin test printf $(pwd) test done
+awk "$1" done 2>/dev/null
+		'quoted text' | && 'quoted text'
+		cd sed sed cd 'quoted text' /usr/bin ${HOME} grep done done echo $(pwd) -eu awk
+local | cd export /usr/bin x=1 --verbose --verbose then /usr/bin test
+	${HOME} then --verbose x=1 done | "$@" readonly && echo ${HOME}
+$(pwd) | local sed test awk "$@" -eu $(pwd)
+	test 2>/dev/null /usr/bin
+		grep | done test 2>/dev/null
+		test "$@" test $(pwd) test /usr/bin
+done test printf x=1 -eu -eu awk
+	&& test "$1" --verbose awk -eu -eu "$@" --verbose
+	| 'quoted text' done 'quoted text'
+export "$1" grep "$@" test done $(pwd)
+		then sed sed printf awk "$1"
+done "$@" && "$@" done && /usr/bin ${HOME} printf 2>/dev/null x=1 then local export
+		2>/dev/null | readonly -eu export local -eu "$1"
+-eu -eu local "$1" local export local then cd 'quoted text'
+	export -eu sed $(pwd) test awk cd | 2>/dev/null x=1 -eu
+	done awk --verbose --verbose
+		echo echo sed ${HOME} grep echo | && && /usr/bin
+		&& "$1" test local && --verbose "$1" test grep done x=1 x=1 "$@" 'quoted text'
+		sed | && awk && --verbose printf echo grep awk grep export /usr/bin awk awk
+	-eu echo "$@" readonly 'quoted text' grep -eu export x=1 test done
+	"$@" cd readonly done awk awk "$@" grep echo x=1 awk && sed done awk local "$@"
+	sed echo then readonly x=1 $(pwd)
+readonly local then "$@" 'quoted text' 2>/dev/null printf "$@" "$1" sed |
+	--verbose readonly printf --verbose done -eu then awk echo awk 2>/dev/null
+		"$1" /usr/bin echo export then --verbose
+2>/dev/null -eu awk && awk "$1" grep && cd sed 'quoted text' readonly cd then
+		'quoted text' x=1 && sed echo export
+	/usr/bin /usr/bin ${HOME} then 2>/dev/null "$@" echo echo -eu test
+	grep echo 2>/dev/null 'quoted text' printf "$1" "$1" x=1 $(pwd) echo
+'quoted text' export "$@" 'quoted text' echo 'quoted text' echo test
+		readonly echo local done && local done
+		grep | | "$@" grep echo test 'quoted text'
+	--verbose echo cd awk sed $(pwd) echo awk 2>/dev/null
+	x=1 --verbose local then echo then
+	sed cd "$1" printf grep
+cd printf echo 'quoted text'
+grep && $(pwd) cd --verbose grep echo grep readonly
+sed done local "$@" awk grep then /usr/bin
+	awk 'quoted text' test | awk --verbose printf echo "$@" "$@" export done
+	${HOME} awk -eu grep cd
+x=1 then cd "$1" cd printf ${HOME} then then x=1
+	local awk && -eu && && && done
+	${HOME} sed "$1" export -eu --verbose cd then --verbose | -eu test
+		local 2>/dev/null "$1" "$@" grep 'quoted text' grep "$1" test grep "$1"
+	echo local done "$1" cd x=1 "$1" grep local 2>/dev/null
+2>/dev/null cd "$@" $(pwd) sed awk printf test readonly -eu |
+	${HOME} export && awk 2>/dev/null readonly readonly readonly $(pwd) 'quoted text'
+| cd printf sed ${HOME} printf export then "$1" x=1 && | done local test
+	cd -eu 2>/dev/null --verbose grep cd test
+		export awk && x=1 test export $(pwd) x=1 echo -eu
+x=1 printf awk $(pwd) "$@" "$1" x=1 --verbose /usr/bin
+		"$@" awk echo local 2>/dev/null | --verbose readonly ${HOME}
+local 'quoted text' cd then -eu -eu
+	grep echo done readonly ${HOME} "$1" "$1" printf ${HOME} | readonly
+		$(pwd) printf && | -eu "$1" readonly
+$(pwd) done --verbose local export
+--verbose /usr/bin 2>/dev/null then "$1" local -eu printf sed export grep | --verbose
+	test x=1 sed ${HOME} printf $(pwd) ${HOME} $(pwd) test ${HOME} 2>/dev/null
+		--verbose --verbose x=1 echo x=1 echo --verbose x=1
+		'quoted text' echo printf --verbose grep | && printf 2>/dev/null
+	"$@" printf $(pwd) local "$1" && "$1" "$1" then then echo x=1
+readonly sed ${HOME} $(pwd) "$@" /usr/bin
+		printf test cd cd x=1 awk ${HOME} cd printf $(pwd)
+		--verbose grep | echo "$1" sed cd
+printf "$1" test export | 'quoted text' -eu /usr/bin test
+		test sed sed done echo "$1" awk $(pwd) done "$@" && sed printf
+		echo --verbose 'quoted text' $(pwd) cd export
+		${HOME} 'quoted text' readonly ${HOME} done done grep /usr/bin cd | readonly
+--verbose done local grep $(pwd) echo "$1"
+"$@" /usr/bin printf ${HOME} "$@" export then ${HOME} then then grep local
+		grep cd echo $(pwd) ${HOME} 2>/dev/null sed echo printf --verbose
+		"$@" | "$@" && done printf test
+		local && awk /usr/bin /usr/bin sed grep && done sed 'quoted text'
+		&& ${HOME} readonly printf sed test echo local test && readonly readonly ${HOME}
+	--verbose test printf ${HOME} export -eu local test awk 'quoted text'
+		&& ${HOME} cd test | cd 2>/dev/null readonly
+		$(pwd) x=1 echo "$1" "$@" then | grep awk then local awk && && ${HOME} -eu
+		${HOME} ${HOME} 2>/dev/null sed grep test -eu "$@" /usr/bin
+then "$1" /usr/bin printf export printf echo
+awk ${HOME} echo then local /usr/bin then sed 'quoted text' | "$1" export
+	--verbose test readonly &&
+	-eu $(pwd) x=1 2>/dev/null /usr/bin && test /usr/bin then
+local done echo "$@" test "$1" /usr/bin echo local
+		&& /usr/bin -eu cd readonly done then $(pwd) sed $(pwd) export --verbose 2>/dev/null
+		grep then --verbose then "$1" -eu cd awk "$1" 2>/dev/null
+| 2>/dev/null cd test
+	x=1 then printf grep 2>/dev/null
+export ${HOME} 2>/dev/null x=1 /usr/bin
+	export readonly ${HOME} "$@" x=1
+	cd && local sed /usr/bin 'quoted text' done 'quoted text' /usr/bin "$1" 2>/dev/null
+"$1" 2>/dev/null | cd local then echo
+		'quoted text' "$1" 2>/dev/null
+		test 2>/dev/null ${HOME} readonly
+		cd done 2>/dev/null 2>/dev/null | 'quoted text'
+		printf --verbose -eu ${HOME} test cd -eu | done local x=1 cd | ${HOME}
+	cd 2>/dev/null && $(pwd) 'quoted text' "$1" -eu
+		${HOME} "$@" done | export x=1 cd echo 2>/dev/null /usr/bin /usr/bin done
+	sed /usr/bin export test "$@" -eu printf && test echo /usr/bin
+test grep readonly test export && "$1" ${HOME}
+		printf --verbose $(pwd) cd readonly
+/usr/bin export "$@" printf readonly
+		printf then done 2>/dev/null /usr/bin sed /usr/bin sed | export
+--verbose cd 2>/dev/null test 2>/dev/null --verbose
+$(pwd) test 'quoted text'
+	"$@" ${HOME} && readonly -eu sed 2>/dev/null
+	--verbose ${HOME} x=1 printf | done && "$@" ${HOME} | echo done "$1"
+then test /usr/bin grep 'quoted text' "$1" ${HOME}
+"$1" grep cd awk -eu readonly
+		x=1 | local $(pwd) sed then --verbose grep grep awk export cd | $(pwd) && x=1
+		-eu $(pwd) test x=1 echo
+"$1" export export 2>/dev/null then
+	grep then printf test /usr/bin 'quoted text' --verbose readonly --verbose awk test
+	x=1 test $(pwd) export then && test &&
+	test 2>/dev/null test 2>/dev/null local readonly --verbose $(pwd) printf x=1 /usr/bin
+		done 'quoted text' $(pwd) readonly /usr/bin 'quoted text'
+test sed test grep x=1 x=1 | sed printf echo grep "$1" 'quoted text'
+		"$@" -eu | grep $(pwd) && cd 'quoted text' 'quoted text' 'quoted text'
+		${HOME} grep --verbose test && printf --verbose
+		cd grep cd /usr/bin 'quoted text' test "$@" -eu local 2>/dev/null
+		export -eu | echo && -eu sed "$1" echo export awk "$1" grep awk /usr/bin export
+	/usr/bin $(pwd) 'quoted text' --verbose
+		local awk -eu test test export ${HOME} cd /usr/bin ${HOME}
+		&& $(pwd) "$1" cd x=1 $(pwd) --verbose awk
+	cd -eu sed -eu --verbose done | awk && then 'quoted text'
+sed done awk x=1 echo 2>/dev/null
+		${HOME} readonly && local done ${HOME} "$@" 2>/dev/null "$@"
+		test $(pwd) then 'quoted text' | 'quoted text' /usr/bin $(pwd)
+	then "$@" cd test "$@"
+${HOME} /usr/bin x=1 -eu sed && readonly
+#include c127.sh
+	export grep then 2>/dev/null x=1 ${HOME} x=1 grep ${HOME}
+local grep export /usr/bin echo
+"$1" done x=1 export readonly -eu grep done && echo "$1" done && ${HOME}
+readonly readonly grep $(pwd)
+-eu local "$1" awk --verbose test 2>/dev/null | done "$@" test cd echo echo
+	local export local --verbose /usr/bin &&
+--verbose 'quoted text' -eu "$@" /usr/bin
+	'quoted text' then export readonly "$@" awk sed /usr/bin cd 2>/dev/null $(pwd)
+readonly x=1 -eu cd 'quoted text'
+		&& $(pwd) local local test printf grep && local ${HOME} printf 'quoted text'
+	--verbose /usr/bin printf "$1"
+"$1" -eu readonly -eu cd 2>/dev/null
+		&& local 'quoted text' 'quoted text' | sed local | "$@" $(pwd) cd printf
+	test echo ${HOME} 2>/dev/null /usr/bin awk /usr/bin
+	/usr/bin then test cd printf grep "$@" cd | local $(pwd) ${HOME} "$1" then
+		'quoted text' 'quoted text' 2>/dev/null test
+	-eu -eu --verbose ${HOME} | readonly ${HOME} printf
+--verbose -eu /usr/bin awk awk 'quoted text'
+	"$@" 'quoted text' "$1" export && printf
+done grep x=1 cd echo done "$1" export grep
+--verbose 2>/dev/null $(pwd)
+"$@" readonly ${HOME} printf && 2>/dev/null x=1 &&
+	"$@" "$1" then 2>/dev/null -eu grep ${HOME} && export | grep local
+		x=1 local test sed | && "$1" export -eu $(pwd) 2>/dev/null 'quoted text' cd
+	'quoted text' $(pwd) export cd "$1" awk "$@"
+sed --verbose "$1" local done && --verbose cd export "$@" 2>/dev/null
+$(pwd) then test export readonly
+		export readonly printf 2>/dev/null
+&& 'quoted text' test echo printf 'quoted text' 2>/dev/null
+-eu done | "$1" 2>/dev/null sed --verbose && local && --verbose /usr/bin
+		local && done ${HOME} echo --verbose cd grep -eu awk -eu --verbose
+		$(pwd) readonly $(pwd)
+/usr/bin test export -eu then /usr/bin sed ${HOME} printf awk | --verbose export
+$(pwd) sed sed then echo readonly
+		${HOME} && cd then "$@" cd
+	awk 2>/dev/null 'quoted text' ${HOME} | then 2>/dev/null && local $(pwd)
+/usr/bin printf done done "$1" $(pwd) readonly "$@"
+local --verbose 2>/dev/null "$@" echo x=1 "$1" export grep cd awk
+	grep local "$1" printf x=1 sed echo sed x=1 then | -eu test then
+	sed local sed test "$1" then /usr/bin -eu | done 2>/dev/null
+		"$1" awk --verbose then grep ${HOME} printf $(pwd)
+awk && $(pwd) "$1" awk sed x=1 then done -eu 2>/dev/null export grep local x=1
+--verbose cd local "$@" | -eu /usr/bin /usr/bin x=1 /usr/bin
+		/usr/bin awk && && 2>/dev/null | then then ${HOME}
+	local sed -eu printf export --verbose echo && 2>/dev/null grep 'quoted text' then
+		done export "$@" $(pwd) local x=1 awk 2>/dev/null ${HOME} readonly test then test
+awk -eu then | readonly echo then 'quoted text'
+		awk x=1 -eu test sed echo then --verbose echo
+/usr/bin readonly | x=1 awk done
+	local "$1" "$@" readonly grep 'quoted text' echo then $(pwd) /usr/bin 'quoted text'
+${HOME} then cd x=1 2>/dev/null
+	${HOME} readonly local /usr/bin grep ${HOME} test done --verbose test x=1
+/usr/bin then echo && | awk then cd awk then
+/usr/bin awk export grep cd 2>/dev/null "$@" "$1" && -eu --verbose awk "$1" cd
+		then x=1 printf cd "$1" 'quoted text' local --verbose "$1" | sed sed cd
+	2>/dev/null /usr/bin
+${HOME} 2>/dev/null then sed awk && x=1 x=1 'quoted text' ${HOME}
+grep x=1 local "$@" done readonly 2>/dev/null x=1 "$1" test test export
+$(pwd) "$1" && /usr/bin --verbose /usr/bin sed -eu
+		&& readonly then test 2>/dev/null 2>/dev/null -eu ${HOME} $(pwd) done
+		"$@" $(pwd) then grep awk 'quoted text'
+	${HOME} -eu --verbose done sed then
+		"$@" /usr/bin "$@" --verbose printf x=1 x=1 echo
+		done --verbose done --verbose
+	test awk 2>/dev/null "$1" then
+test ${HOME} readonly -eu export
+-eu --verbose "$1" echo done $(pwd) | local x=1 "$1" readonly && --verbose
+		${HOME} | export "$1" "$1" | test export then awk 'quoted text'
+	local --verbose 2>/dev/null grep
+		&& 2>/dev/null printf test ${HOME} test x=1 x=1 && 2>/dev/null --verbose
+	readonly echo echo $(pwd) && printf
+		echo sed "$1" cd echo x=1 readonly 2>/dev/null /usr/bin
+done /usr/bin "$1" cd --verbose "$1" | cd ${HOME}
+		printf $(pwd) then $(pwd) --verbose -eu
+printf sed -eu local "$1" test 'quoted text'
+	awk printf --verbose 'quoted text' -eu x=1 /usr/bin "$1" printf --verbose
+		cd 'quoted text' /usr/bin done ${HOME}
+	local $(pwd) export test 2>/dev/null
+	'quoted text' && -eu | 'quoted text'
+		then sed ${HOME} $(pwd) -eu cd 2>/dev/null awk 2>/dev/null test test &&
+	&& done x=1 test readonly
+		&& readonly done -eu 2>/dev/null
+"$1" /usr/bin then /usr/bin "$1" readonly sed grep $(pwd) echo
+"$@" x=1 export sed printf cd echo then | then echo -eu awk echo
+echo done /usr/bin cd done ${HOME} awk readonly /usr/bin 2>/dev/null
+	"$@" 2>/dev/null x=1 x=1 then | --verbose
+"$@" test && /usr/bin /usr/bin
+	-eu | 'quoted text' /usr/bin -eu
+	--verbose ${HOME} readonly grep 2>/dev/null
+	/usr/bin $(pwd) then test -eu $(pwd) printf ${HOME}
+		sed 'quoted text' printf echo "$1" echo && ${HOME} "$@" done
+		/usr/bin cd cd 'quoted text' --verbose /usr/bin grep awk printf done echo export
+${HOME} export awk --verbose -eu 'quoted text'
+/usr/bin grep ${HOME} 2>/dev/null sed | readonly
+		grep -eu /usr/bin && test then
+		export 2>/dev/null echo | sed /usr/bin /usr/bin local --verbose
+	--verbose x=1 test "$@" awk && $(pwd) -eu && | export test then
+--verbose export cd x=1 2>/dev/null readonly readonly x=1 && 2>/dev/null
+	${HOME} --verbose test local grep 2>/dev/null local /usr/bin $(pwd) local ${HOME}
+	done && ${HOME} ${HOME} test | 2>/dev/null && then /usr/bin done
+		/usr/bin sed sed done awk readonly "$1" export "$1" -eu 'quoted text'
+	'quoted text' grep --verbose 'quoted text' ${HOME} | /usr/bin
+${HOME} "$1" then 2>/dev/null
+--verbose readonly && grep /usr/bin x=1 cd echo echo test grep /usr/bin
+sed "$1" sed cd local $(pwd) test printf then 2>/dev/null
+	'quoted text' ${HOME} sed printf "$1" /usr/bin
+	&& 2>/dev/null cd --verbose /usr/bin export 'quoted text' sed ${HOME} cd ${HOME}
+		/usr/bin printf done local done local sed $(pwd) sed /usr/bin
+&& readonly done printf && cd 'quoted text' cd echo /usr/bin then 'quoted text'
+		--verbose printf | test --verbose 'quoted text' grep readonly "$@" grep
+	sed awk printf /usr/bin readonly sed done /usr/bin x=1 test
+		test grep local 2>/dev/null $(pwd) grep ${HOME} cd readonly grep -eu 'quoted text'
+		x=1 readonly x=1 && export
+| awk awk -eu --verbose done "$@"
+then sed sed && echo -eu done --verbose echo "$1" 'quoted text' -eu $(pwd) x=1
+local --verbose -eu cd then then && grep then done
+		| cd -eu -eu "$@" cd && done ${HOME} grep test --verbose sed 'quoted text' /usr/bin
+--verbose | cd ${HOME} 'quoted text' $(pwd)
+		"$@" /usr/bin echo grep
+	2>/dev/null "$@" -eu sed
+		awk awk then 2>/dev/null printf then /usr/bin x=1 | awk ${HOME} ${HOME}
+	--verbose x=1 "$@" --verbose
+"$@" export && export /usr/bin && -eu 2>/dev/null
+		local "$@" ${HOME} local "$@" x=1 sed echo $(pwd) export
+	test 2>/dev/null echo printf
+		test test test echo then x=1 local readonly printf
+	"$@" then "$@" $(pwd) echo awk /usr/bin then $(pwd)
+	x=1 "$@" "$1" then ${HOME} test sed
+		export sed local export $(pwd) | "$1" test x=1 then
+		done -eu cd sed grep readonly 2>/dev/null
+		--verbose sed -eu 2>/dev/null "$@" "$@" /usr/bin --verbose /usr/bin
+done "$@" 2>/dev/null grep echo sed done
+	"$1" --verbose awk $(pwd) cd "$@" grep "$1" 'quoted text' /usr/bin sed
+	'quoted text' cd readonly
+${HOME} $(pwd) "$1" test cd printf readonly printf $(pwd) ${HOME}
+sed export done -eu printf readonly printf 2>/dev/null readonly awk sed cd /usr/bin
+	| x=1 -eu export awk | && "$1" ${HOME} export /usr/bin $(pwd) | local
+	'quoted text' echo "$@" done ${HOME} ${HOME}
+	$(pwd) done printf -eu readonly "$@" test
+		"$@" 2>/dev/null 2>/dev/null grep awk ${HOME} x=1
+x=1 echo | ${HOME} 'quoted text' /usr/bin "$1" ${HOME} grep && test awk &&
+		printf "$1" printf echo grep "$1" ${HOME}
+	&& $(pwd) local echo && 'quoted text' grep awk sed local
+${HOME} echo -eu /usr/bin -eu && export /usr/bin
+	x=1 -eu local awk 2>/dev/null | | awk 'quoted text' | awk readonly "$1"
+--verbose "$@" ${HOME} --verbose $(pwd) /usr/bin && x=1 /usr/bin -eu
+/usr/bin test /usr/bin local ${HOME}
+	cd /usr/bin done local grep cd sed /usr/bin
+		awk $(pwd) cd export x=1 grep $(pwd) local &&
+x=1 then | x=1 local /usr/bin
+		'quoted text' test sed local && readonly
+		--verbose && | export --verbose cd then | -eu 'quoted text' cd 2>/dev/null
+cd sed "$1" ${HOME} 'quoted text' echo 'quoted text' /usr/bin /usr/bin
+	"$@" 'quoted text' grep local ${HOME}
+	sed echo local | x=1 /usr/bin
+		-eu /usr/bin readonly then local printf printf "$1" ${HOME} awk awk
+		"$@" "$@" -eu printf && 'quoted text' $(pwd) /usr/bin
+		"$1" grep | done | test printf cd --verbose 2>/dev/null printf done export
+	"$1" x=1 local then cd done "$1" /usr/bin echo awk export /usr/bin
+	local --verbose /usr/bin ${HOME} cd then test
+		x=1 /usr/bin test test x=1 test test
+		'quoted text' echo printf awk --verbose
+x=1 readonly | "$1" readonly awk local awk -eu sed 2>/dev/null
+	x=1 printf printf then
+	${HOME} printf export x=1 printf
+	then 'quoted text' $(pwd) ${HOME} $(pwd) cd && && $(pwd) sed awk --verbose
+x=1 /usr/bin x=1 printf echo sed /usr/bin awk export
+export ${HOME} -eu /usr/bin done && export $(pwd) --verbose readonly
+| local printf awk 'quoted text' x=1 printf | x=1
+	x=1 printf --verbose then readonly ${HOME}
+	--verbose 2>/dev/null export
+	local "$@" | echo export sed echo -eu
+--verbose sed cd local x=1 -eu /usr/bin
+		2>/dev/null x=1 cd sed then awk 2>/dev/null
+then echo && --verbose readonly -eu && /usr/bin grep done
+${HOME} /usr/bin then x=1 x=1 grep x=1 then ${HOME}
+	${HOME} echo local done awk local && sed /usr/bin grep 'quoted text' awk echo
+${HOME} --verbose test then
+	x=1 "$@" then --verbose $(pwd) done export echo export ${HOME}
+		${HOME} done test -eu then /usr/bin sed then cd "$@" test printf echo
+		/usr/bin test 2>/dev/null cd 'quoted text' printf readonly
+		echo readonly 'quoted text' 2>/dev/null && export awk x=1 "$@" $(pwd)
+'quoted text' 2>/dev/null
+test awk sed "$1" "$@" sed then grep --verbose test readonly
+awk printf printf | then cd ${HOME}
+		printf cd $(pwd) readonly readonly local "$1" /usr/bin
+		-eu --verbose $(pwd) "$1" 'quoted text' --verbose sed 2>/dev/null
+then done /usr/bin awk 'quoted text' sed /usr/bin sed x=1 $(pwd)
+	awk cd | readonly 'quoted text' grep grep then printf printf
+	local --verbose -eu export
+		'quoted text' echo export ${HOME} local --verbose grep cd readonly x=1 ${HOME} --verbose
+	cd && local local | then then export export readonly echo "$1"
+printf ${HOME} "$1" "$@" $(pwd) ${HOME} awk | done echo
+		printf ${HOME} echo local
+		printf readonly 2>/dev/null -eu 2>/dev/null export
+		-eu sed "$@" | readonly
+/usr/bin sed cd echo -eu test "$@" cd x=1 then cd then echo
+	local readonly export $(pwd) local && "$1"
+	readonly -eu awk local x=1 then --verbose cd $(pwd) 'quoted text' $(pwd) grep
+	'quoted text' && 'quoted text' echo cd ${HOME} x=1 test -eu local sed ${HOME}
+	'quoted text' 'quoted text' done $(pwd) test /usr/bin --verbose export --verbose
+	cd && "$@" done /usr/bin --verbose | && --verbose
+		-eu && --verbose 2>/dev/null then "$@" export
+		| -eu awk $(pwd) | "$1"
+| "$1" "$1" --verbose /usr/bin echo done /usr/bin $(pwd) 'quoted text'
+	echo done cd done awk "$1" done
+&& awk done then printf /usr/bin done
+	done done x=1 test --verbose /usr/bin printf echo "$1" -eu cd export readonly
+		done $(pwd) export awk export "$@" export x=1 test done local done printf
+	2>/dev/null "$1" cd awk && "$1" "$@" sed cd && then
+	| 2>/dev/null export "$1" cd 2>/dev/null
+	| echo cd -eu /usr/bin
+sed "$@" --verbose x=1 /usr/bin grep --verbose readonly "$@" && |
+	echo grep x=1 export done done /usr/bin
+		/usr/bin done | && printf test -eu
+	printf then && && sed -eu --verbose cd awk awk then --verbose export "$1" /usr/bin
+2>/dev/null && test -eu $(pwd) 'quoted text' && echo cd then --verbose then
+/usr/bin --verbose cd 'quoted text' x=1 readonly x=1
+		echo then sed /usr/bin /usr/bin
+"$@" grep $(pwd) then test
+| echo "$1" -eu test readonly grep "$@" "$@"
+then printf "$@" && -eu ${HOME} cd x=1 "$@" cd
+	printf ${HOME} /usr/bin --verbose cd && sed "$1" then cd readonly /usr/bin
+	printf cd 'quoted text' grep
+		'quoted text' grep done $(pwd) --verbose
+		| "$@" "$@" then && /usr/bin then 'quoted text' grep ${HOME} then grep printf
+	echo then "$@" $(pwd) x=1 printf -eu
+	-eu ${HOME} readonly printf "$1" done ${HOME} $(pwd) export
+	test 2>/dev/null then && local local /usr/bin done ${HOME}
+readonly "$@" then /usr/bin then "$@"
+		local done local readonly sed
+sed -eu readonly --verbose -eu --verbose
+	| 'quoted text' readonly -eu $(pwd) readonly -eu then 'quoted text'
+	&& cd -eu awk ${HOME} export grep "$1" x=1 x=1 printf awk $(pwd)
+		done | /usr/bin awk echo "$@" && "$@"
+		readonly x=1 && export
+'quoted text' cd --verbose 'quoted text' test test 'quoted text' export cd x=1
+test printf --verbose | "$@" echo then -eu sed -eu export | $(pwd) ${HOME} | test
+$(pwd) x=1 grep readonly /usr/bin x=1 sed /usr/bin
+		/usr/bin echo done /usr/bin "$1" cd done echo
+		x=1 x=1 ${HOME} sed "$@" sed | 2>/dev/null
+test echo ${HOME} cd grep --verbose test export
+"$@" /usr/bin grep x=1 sed printf export local awk "$@" --verbose -eu export printf
+'quoted text' grep awk
+	cd cd then sed -eu && /usr/bin && /usr/bin --verbose
+sed | | echo awk grep readonly local printf
+		&& 2>/dev/null "$@" sed 'quoted text' $(pwd) echo then
+sed | cd | ${HOME} ${HOME} local then readonly
+		/usr/bin 'quoted text' done readonly $(pwd) ${HOME} cd $(pwd)
+	done 'quoted text' then | --verbose grep ${HOME} printf 'quoted text'
+	$(pwd) grep awk export -eu sed "$1" "$@" ${HOME} && 'quoted text' echo --verbose
+	sed | /usr/bin test echo
+"$@" readonly $(pwd) /usr/bin
+	&& then sed --verbose grep test local grep $(pwd) echo "$@"
+		2>/dev/null grep "$1" awk /usr/bin
+then readonly x=1 2>/dev/null export
+export "$@" done awk "$1" | /usr/bin /usr/bin
+	awk -eu echo sed readonly | readonly awk printf
+${HOME} sed | cd | local | 2>/dev/null export x=1
+$(pwd) 2>/dev/null $(pwd)
+		&& "$@" then done && then ${HOME} echo readonly sed "$@" readonly --verbose
+cd grep echo --verbose --verbose && done --verbose ${HOME} "$1" --verbose -eu
+echo grep -eu && printf readonly /usr/bin
+	sed grep x=1 awk /usr/bin grep ${HOME} /usr/bin
+then awk 2>/dev/null echo "$1" 2>/dev/null
+		printf cd | readonly grep "$@" --verbose printf
+		readonly local cd cd ${HOME} sed "$1"
+	-eu x=1 -eu | /usr/bin then cd x=1 ${HOME}
+export $(pwd) printf then $(pwd) /usr/bin readonly
+		local 'quoted text' -eu "$1" grep printf
+	local cd ${HOME} ${HOME} local | ${HOME} awk readonly test readonly
+	x=1 "$1" ${HOME} sed /usr/bin sed 'quoted text' "$1" grep local
+	grep then "$@" 2>/dev/null
+	export | ${HOME} test grep
+	printf echo readonly "$@" done -eu x=1 printf 'quoted text'
+		awk awk sed /usr/bin echo then --verbose
+	$(pwd) && 'quoted text' test /usr/bin readonly --verbose sed done ${HOME}
+	cd cd $(pwd) | 'quoted text' test printf
+		then grep printf "$1" --verbose /usr/bin x=1 x=1 cd readonly 2>/dev/null
+		"$@" printf 'quoted text' | --verbose 'quoted text' -eu sed awk grep
+		/usr/bin | test "$@" done 2>/dev/null cd -eu
+awk grep x=1 cd sed cd /usr/bin cd -eu && printf
+	x=1 export 2>/dev/null echo && -eu | export --verbose sed
+		--verbose ${HOME} echo export awk then cd printf "$1" echo -eu 2>/dev/null
+		then awk /usr/bin --verbose -eu printf
+"$1" ${HOME} -eu x=1 --verbose then && 2>/dev/null sed awk echo cd awk | --verbose
+	-eu -eu printf | export grep echo echo readonly local --verbose
+cd ${HOME} awk --verbose
+	&& readonly printf x=1 sed && "$@" sed ${HOME} test "$@"
+"$@" "$@" done 2>/dev/null printf -eu sed | && x=1
+		cd local | -eu ${HOME} | grep test -eu local printf local ${HOME} --verbose
+local sed 'quoted text' local && test cd echo 2>/dev/null
+	local cd then export echo test printf cd /usr/bin /usr/bin grep
+		sed --verbose grep test cd "$@" then /usr/bin
+	'quoted text' /usr/bin "$1" cd "$1" local grep && $(pwd) echo ${HOME}
+-eu test | export sed "$@" "$1" &&
+readonly echo --verbose grep echo awk ${HOME}
+&& local | grep "$@" test then 'quoted text' then 2>/dev/null "$1"
+	test printf ${HOME} sed test awk
+		then $(pwd) cd cd then "$1" |
+	"$1" "$@" test done 'quoted text'
+printf "$1" 2>/dev/null readonly test x=1 local --verbose
+	awk /usr/bin 2>/dev/null --verbose local export ${HOME}
+		cd echo grep awk sed 2>/dev/null "$1" readonly ${HOME}
+	export local awk "$@" readonly grep 2>/dev/null
+	readonly test -eu && test awk ${HOME} grep "$@" test ${HOME}
+grep "$1" grep sed local 2>/dev/null && test sed "$@" 2>/dev/null
+	export 'quoted text' ${HOME} then && "$1" "$1" sed grep --verbose then
+cd then awk readonly sed ${HOME} export 2>/dev/null awk grep $(pwd) echo
+	readonly local -eu awk echo test -eu grep -eu then
+		sed test 2>/dev/null --verbose awk 'quoted text' | --verbose awk test
+awk $(pwd) awk $(pwd)
+"$1" test "$1" -eu awk readonly echo -eu /usr/bin "$1"
+	readonly local done "$@" x=1 &&
+export /usr/bin ${HOME} sed done --verbose test awk /usr/bin
+	/usr/bin readonly -eu && echo export awk sed cd "$@" "$@" awk -eu test | printf
+		-eu printf sed /usr/bin "$@" && readonly "$1" -eu "$1" done
+${HOME} local $(pwd) 2>/dev/null
+	--verbose awk cd done sed printf
+then -eu | then 'quoted text' grep local /usr/bin printf readonly printf
+	'quoted text' "$1" then
+	readonly --verbose export printf "$@" --verbose export local "$@"
+| cd 2>/dev/null x=1 | /usr/bin
+	export test export -eu done
+		local "$@" --verbose
+		export ${HOME} && && echo
+	&& cd "$1" local sed then echo then readonly
+test local echo done grep test 'quoted text'
+	export "$@" && $(pwd) $(pwd) done awk $(pwd)
+"$1" then /usr/bin "$1" 2>/dev/null awk | 'quoted text' sed x=1 readonly
+	then && && test done 'quoted text'
+local sed $(pwd) --verbose --verbose 2>/dev/null "$@" -eu | test
+/usr/bin grep "$1" done done 2>/dev/null local
+	local /usr/bin && cd local "$1" sed $(pwd) ${HOME} sed x=1 done $(pwd)
+x=1 grep "$@" $(pwd) -eu printf printf local 2>/dev/null | cd /usr/bin "$1"
+	-eu 2>/dev/null export printf export -eu ${HOME} $(pwd)
+	| echo test done done 'quoted text' printf done sed && -eu 2>/dev/null
+	readonly export x=1 | ${HOME} sed x=1 local x=1 echo cd
+	2>/dev/null printf sed "$@" then x=1 readonly
+/usr/bin grep 'quoted text' awk 2>/dev/null printf sed && sed --verbose
+	| ${HOME} awk local "$1" sed | sed done 'quoted text' sed 'quoted text' local
+		then $(pwd) "$1" readonly
+$(pwd) printf readonly && export
+--verbose echo | sed export echo local | readonly local $(pwd) "$1" grep
+	echo export local x=1 "$@" "$1" echo echo "$@" && 2>/dev/null --verbose
+grep then then 'quoted text'
+		readonly x=1 local local -eu cd "$1" grep cd cd done
+		2>/dev/null ${HOME} -eu export local done "$@"
+echo $(pwd) -eu /usr/bin "$@" x=1 'quoted text' printf then
+		2>/dev/null && x=1 cd "$1" 2>/dev/null x=1 2>/dev/null
+"$@" -eu && && x=1 && /usr/bin local x=1 x=1 -eu sed $(pwd) ${HOME} printf local
+	-eu test sed 'quoted text' "$@"
+	local | then test 2>/dev/null test sed test -eu
+&& | readonly then test readonly --verbose "$1" ${HOME} then grep sed done
+test 2>/dev/null echo "$1" && local
+		"$1" ${HOME} sed export sed readonly -eu test --verbose
+	sed "$@" export -eu printf -eu
+		2>/dev/null ${HOME} "$@" awk x=1 then --verbose echo then echo export
+sed "$@" "$1" echo -eu ${HOME} done sed 2>/dev/null grep cd awk $(pwd) echo
+		cd $(pwd) 'quoted text' awk "$@" readonly cd then export
+x=1 printf awk 'quoted text' printf test local echo
+	export test /usr/bin
+	/usr/bin cd test $(pwd) done /usr/bin 2>/dev/null "$1" $(pwd) echo --verbose
+	echo then awk "$@" x=1 test awk cd done export
+	export "$@" ${HOME} | /usr/bin | "$1" "$1" awk x=1 | readonly 'quoted text'
+		&& awk 2>/dev/null 'quoted text' 'quoted text' sed local then
+	-eu "$1" $(pwd) test "$1"
+		sed -eu ${HOME} readonly printf done -eu && echo | done -eu export $(pwd) printf
+readonly -eu readonly && then grep &&
+then done | printf && grep 2>/dev/null | x=1 readonly printf grep && x=1 2>/dev/null
+	echo "$1" readonly 2>/dev/null then -eu $(pwd) readonly
+"$@" && ${HOME} test "$@" done
+cd local -eu 'quoted text'
+		${HOME} printf 2>/dev/null 2>/dev/null | ${HOME} grep cd | printf
+		test /usr/bin --verbose grep | "$@" test printf "$1" readonly echo | ${HOME} test
+		local /usr/bin -eu 'quoted text'
+x=1 ${HOME} ${HOME} "$1" 'quoted text'
+	"$@" "$1" | awk printf test then
+cd $(pwd) && ${HOME} "$1" grep -eu
+	awk $(pwd) readonly export "$1" cd ${HOME} done --verbose cd awk
+		&& x=1 awk "$@" "$@" /usr/bin "$@" 2>/dev/null /usr/bin test 2>/dev/null
+-eu test test ${HOME} $(pwd) export readonly
+	local printf then export -eu local "$@" 2>/dev/null awk readonly
+	grep && --verbose test done awk 'quoted text'
+		cd grep $(pwd) printf local sed
+	/usr/bin | | readonly /usr/bin then test test && export cd "$1" sed done
+		-eu -eu 'quoted text' "$@" then awk | -eu export --verbose "$1"
+		'quoted text' test $(pwd) then local test $(pwd)
+	then awk export -eu sed printf --verbose --verbose $(pwd) cd readonly x=1 $(pwd)
+	"$@" "$1" "$@" cd cd readonly
+		printf test grep /usr/bin awk test $(pwd)
+done cd test 2>/dev/null /usr/bin awk
+		awk grep && "$1" && export
+${HOME} 'quoted text' then "$1" 2>/dev/null
+	grep ${HOME} then cd "$@" printf ${HOME}
+		then $(pwd) 'quoted text' then
+		-eu --verbose "$@" x=1 "$1"
+		"$@" && /usr/bin /usr/bin then
+/usr/bin x=1 ${HOME} export echo echo
+	echo local readonly printf awk echo readonly
+		$(pwd) printf "$@" cd x=1
+		| 'quoted text' then local cd |
+	grep && 2>/dev/null grep x=1 && awk local then echo -eu 2>/dev/null then
+	"$1" sed then echo && 'quoted text'
+		2>/dev/null /usr/bin grep
+	test 2>/dev/null sed -eu readonly grep sed /usr/bin
+	cd 2>/dev/null /usr/bin readonly echo local
+sed echo $(pwd) "$@" grep 'quoted text' test export /usr/bin && "$1" then 'quoted text'
+${HOME} sed local /usr/bin && done 'quoted text' && 'quoted text' 2>/dev/null |
+awk local then $(pwd) -eu readonly then 'quoted text' test | echo
+		&& grep test --verbose -eu local ${HOME} test readonly "$1"
+2>/dev/null -eu && echo
+done --verbose printf grep grep local "$1" printf local echo /usr/bin "$@" grep
+		grep export x=1 'quoted text'
+		done grep "$1" cd --verbose "$1" "$@" /usr/bin sed | /usr/bin readonly readonly
+	"$@" local -eu done 'quoted text'
+"$@" 2>/dev/null && printf
+		printf $(pwd) echo echo --verbose --verbose printf | |
+		"$1" echo cd "$1" cd sed 2>/dev/null 'quoted text' x=1 awk test cd
+		export x=1 printf /usr/bin --verbose sed | && local ${HOME}
+		--verbose x=1 then echo printf
+	grep 'quoted text' local readonly local "$@" 2>/dev/null cd | local then | x=1 'quoted text'
+		-eu grep grep echo sed $(pwd) local 2>/dev/null export cd x=1 sed x=1 | /usr/bin
+		echo | local "$@" printf ${HOME} "$@"
+done x=1 ${HOME} /usr/bin export ${HOME}
+		${HOME} /usr/bin then sed x=1 grep local export /usr/bin echo
+		done awk grep 2>/dev/null test --verbose ${HOME} done
+done | printf done 'quoted text' 2>/dev/null
+-eu sed export 'quoted text' ${HOME} && local "$1" awk local && 2>/dev/null local
+		export "$@" export ${HOME} cd "$1" grep
+		'quoted text' printf export && test 2>/dev/null
+then -eu $(pwd) grep $(pwd) done && printf echo ${HOME} done ${HOME}
+		cd done sed x=1 printf "$@"
+	sed $(pwd) cd sed "$@" x=1 echo test readonly x=1
+test export readonly export "$1" 2>/dev/null export awk | | && /usr/bin /usr/bin
+	then readonly /usr/bin cd /usr/bin sed $(pwd) sed export 2>/dev/null
+	| $(pwd) $(pwd) test -eu then awk cd echo $(pwd)
+$(pwd) printf /usr/bin 2>/dev/null printf ${HOME}
+export awk echo cd -eu then x=1 'quoted text'
+local export export echo x=1 test /usr/bin "$1" x=1 then readonly 2>/dev/null grep
+$(pwd) then local echo then grep 2>/dev/null --verbose
+		/usr/bin cd cd then sed | x=1 echo sed awk
+		printf printf 2>/dev/null then
+&& "$1" sed /usr/bin sed then
+printf "$@" test ${HOME} readonly $(pwd)
+	&& export grep --verbose "$@" sed printf local
+	then awk test $(pwd) readonly test cd && readonly
+		then "$1" "$1" awk cd $(pwd) test "$1" done echo cd readonly local local ${HOME}
+		readonly /usr/bin done grep grep echo x=1 sed --verbose && local /usr/bin ${HOME}
+"$@" cd && "$1" 'quoted text' grep ${HOME} ${HOME} readonly export sed cd &&
+then $(pwd) /usr/bin cd printf
+		| awk local 'quoted text' local --verbose printf | export readonly export --verbose
+echo sed x=1 x=1 ${HOME} x=1 grep awk | done ${HOME} --verbose | test --verbose
+&& echo /usr/bin && | done done "$1" printf done 2>/dev/null $(pwd)
+		"$1" && "$1" export export $(pwd) printf awk printf
+	/usr/bin local then readonly printf echo --verbose
+		grep cd "$1" export done 'quoted text'
+readonly echo test 2>/dev/null 2>/dev/null local
+		"$@" readonly test grep sed test
+	grep "$1" grep readonly && printf readonly export -eu grep local ${HOME}
+| "$@" local readonly then done readonly done awk
+then 'quoted text' export | test awk then printf awk "$@" $(pwd)
+	awk readonly --verbose then test ${HOME} 'quoted text' test readonly awk -eu
+"$@" awk readonly sed "$1" done "$@" sed done grep 'quoted text'
+'quoted text' grep sed cd awk 2>/dev/null "$@" -eu done 'quoted text' |
+	-eu test 2>/dev/null --verbose readonly -eu cd | done
+		--verbose --verbose cd /usr/bin --verbose "$@" --verbose
+	--verbose | 'quoted text' $(pwd) 2>/dev/null | done "$1" done | grep grep /usr/bin
+	then -eu export then test echo printf
+		cd "$1" /usr/bin awk printf
+		${HOME} then --verbose ${HOME} test "$@" done
+awk local "$1" /usr/bin done readonly awk test
+export ${HOME} x=1 readonly "$@" sed readonly
+"$1" cd "$@" done | local "$1" --verbose
+		-eu awk export then then printf cd printf "$1" printf 2>/dev/null
+export -eu echo "$1" done grep local awk cd -eu test "$@" --verbose
+	test "$1" awk done /usr/bin -eu export then --verbose
+		&& export readonly done then local cd readonly
+	grep export 'quoted text' then printf test done readonly "$1" readonly
+		'quoted text' 2>/dev/null --verbose done sed ${HOME} awk readonly
+	${HOME} | 2>/dev/null | x=1 | "$@" sed $(pwd) && -eu --verbose
+2>/dev/null 'quoted text' --verbose
+$(pwd) ${HOME} then test cd ${HOME} grep
+readonly && cd | awk awk
+		echo "$@" "$1" local readonly -eu "$@" then
+	| readonly test export done sed local 'quoted text' x=1
+	x=1 $(pwd) grep x=1 ${HOME} "$1" local "$1" 'quoted text' cd $(pwd) --verbose
+then grep local 'quoted text' ${HOME} --verbose
+awk readonly done then export -eu 2>/dev/null grep
+		grep done 'quoted text' cd readonly
+sed x=1 | 2>/dev/null cd awk grep cd ${HOME}
+done /usr/bin | $(pwd) echo
+		$(pwd) awk printf export
+"$1" grep grep local /usr/bin --verbose "$1" test
+	local cd $(pwd) printf done x=1 2>/dev/null awk done then
+		${HOME} 2>/dev/null echo 'quoted text' readonly 2>/dev/null ${HOME} done
+	--verbose grep local grep /usr/bin readonly ${HOME}
+	x=1 done echo grep 'quoted text'
+readonly "$1" local awk --verbose done
+	--verbose $(pwd) -eu local test done grep x=1 local
+		"$1" && --verbose then test ${HOME} done "$1" --verbose -eu | awk /usr/bin echo
+2>/dev/null "$1" 'quoted text'
+	printf local echo -eu $(pwd) sed /usr/bin --verbose
+grep x=1 test 'quoted text' test | cd "$1" 'quoted text' 'quoted text'
+printf "$@" && test "$@" ${HOME}
+	--verbose "$1" local done --verbose cd --verbose
+cd --verbose x=1 x=1 ${HOME} test done -eu /usr/bin
+	/usr/bin done cd "$1" grep $(pwd) 'quoted text' ${HOME} ${HOME} --verbose
+	cd "$@" done printf -eu | readonly /usr/bin "$@" 2>/dev/null
+test done printf | 2>/dev/null -eu
+${HOME} export && "$1" /usr/bin cd readonly export
+		done awk x=1 2>/dev/null "$1" awk 2>/dev/null ${HOME} --verbose && "$1" cd cd
+		export $(pwd) grep -eu x=1
+		x=1 "$1" cd grep 2>/dev/null 'quoted text' grep
+local 'quoted text' echo 2>/dev/null $(pwd)
+done -eu test "$1" awk sed done local test awk sed "$@" 2>/dev/null | -eu then
+		cd readonly export then ${HOME} | local --verbose && 2>/dev/null grep sed
+		then export done local echo export "$1" readonly export
+		grep echo export test "$@" readonly $(pwd) 2>/dev/null echo --verbose
+	x=1 --verbose local export
+	test "$@" printf ${HOME} cd
+grep --verbose "$1" echo -eu echo /usr/bin 2>/dev/null 'quoted text' cd $(pwd)
+| done x=1 readonly cd x=1 awk $(pwd) | 2>/dev/null printf
+		test | --verbose --verbose $(pwd) local printf /usr/bin 'quoted text'
+done echo local test 'quoted text'
+	'quoted text' $(pwd) "$1" export 2>/dev/null && test readonly
+grep | 2>/dev/null "$@" sed printf then "$@"
+		-eu echo awk echo 2>/dev/null
+test 'quoted text' /usr/bin -eu then
+	"$@" x=1 | | 'quoted text' x=1 "$1" awk test readonly cd -eu --verbose
+		test printf done readonly cd "$@" -eu
+		--verbose export done && x=1 awk test -eu $(pwd) test sed && export 'quoted text'
+	x=1 done awk grep "$1" then $(pwd)
+'quoted text' | done then export /usr/bin done sed readonly export done awk
+grep readonly -eu 'quoted text' readonly echo
+		"$@" local then && -eu echo export
+		"$1" /usr/bin 'quoted text' local then | $(pwd) then --verbose
+		"$@" ${HOME} local done echo sed | ${HOME} -eu echo -eu
+	awk "$1" awk x=1 echo grep awk readonly grep cd ${HOME}
+		$(pwd) /usr/bin printf "$1"
+local 'quoted text' -eu printf export export sed && x=1 2>/dev/null
+readonly && printf test readonly | export export
+--verbose sed export /usr/bin grep /usr/bin test --verbose readonly
+	readonly --verbose && 2>/dev/null 'quoted text'
+		cd then 'quoted text' -eu --verbose
+${HOME} grep test then printf -eu printf x=1 then $(pwd) awk echo 'quoted text'
+/usr/bin 'quoted text' echo 2>/dev/null 'quoted text'
+		/usr/bin cd echo readonly test 2>/dev/null
+		test then test grep && cd printf | 'quoted text'
+	&& x=1 readonly readonly "$@" "$1" sed
+		echo echo readonly readonly 2>/dev/null $(pwd) x=1 -eu test cd x=1 then done
+		cd 'quoted text' local | done && $(pwd) 'quoted text' "$@" sed /usr/bin
+		then --verbose --verbose "$1" test printf ${HOME}
+	done x=1 sed sed then then echo 2>/dev/null 'quoted text' awk /usr/bin
+x=1 printf --verbose && local "$@" test then export /usr/bin
+local done awk /usr/bin awk printf local
+local 'quoted text' local "$@" local 'quoted text' /usr/bin export grep
+test local test export readonly export done done echo | -eu done
+		x=1 /usr/bin && readonly sed test grep awk
+		local export cd --verbose export x=1 "$@" | local test test
+echo done cd done -eu -eu test /usr/bin /usr/bin then
+		'quoted text' awk local "$1" --verbose awk
+	echo x=1 test test echo ${HOME} local sed export /usr/bin x=1 'quoted text'
+test echo readonly 2>/dev/null
+	| echo --verbose /usr/bin --verbose 'quoted text' && printf
+		"$@" awk -eu --verbose grep sed --verbose "$1" &&
+sed cd cd /usr/bin /usr/bin printf 2>/dev/null readonly
+		"$1" ${HOME} "$@" ${HOME} --verbose echo sed then $(pwd)
+	"$@" cd "$1" && | done "$@" "$@" done 2>/dev/null $(pwd) && -eu /usr/bin
+		printf awk $(pwd) 2>/dev/null
+	"$@" awk grep echo x=1 export local
+	'quoted text' echo && test /usr/bin
+	&& 'quoted text' grep "$1" echo sed export local
+2>/dev/null export echo then /usr/bin then $(pwd) awk "$@" 'quoted text' |
+&& "$@" | 2>/dev/null x=1 $(pwd) | then local
+		done x=1 && -eu done test x=1 && cd 2>/dev/null &&
+--verbose sed sed echo printf ${HOME} && "$1"
+echo sed done local x=1 local $(pwd) test
+	"$1" 'quoted text' printf | ${HOME} sed test awk local "$1" sed export 'quoted text'
+		| export "$@" done /usr/bin readonly
+		cd "$@" 2>/dev/null "$1" cd | export -eu sed ${HOME}
+		'quoted text' local ${HOME} "$@" printf x=1 export test /usr/bin echo ${HOME}
+	'quoted text' cd printf test awk cd | printf then
+--verbose export readonly && sed export && | done ${HOME}
+		echo ${HOME} --verbose done echo
+	printf echo x=1 /usr/bin "$1" && 2>/dev/null
+	local echo | then sed readonly then
+x=1 -eu grep done /usr/bin export grep --verbose 2>/dev/null 'quoted text'
+	done $(pwd) /usr/bin /usr/bin
+		grep -eu awk sed grep "$@" 'quoted text' local then test 2>/dev/null
+		test "$@" /usr/bin cd && sed /usr/bin --verbose local && printf
+${HOME} "$@" readonly --verbose ${HOME} -eu "$@" ${HOME} /usr/bin
+echo sed awk --verbose then echo done --verbose "$@" "$1" && && test 2>/dev/null
+		local awk ${HOME} /usr/bin 'quoted text' local
+		&& cd echo grep awk done echo x=1 /usr/bin | test local then 'quoted text'
+| echo sed done --verbose
+	$(pwd) -eu grep 2>/dev/null printf local cd /usr/bin
+	then -eu ${HOME} export "$@" | sed printf ${HOME} "$1" export ${HOME} /usr/bin
+	&& --verbose then $(pwd) "$@" printf
+	"$@" 2>/dev/null 2>/dev/null "$1" readonly 2>/dev/null done printf 'quoted text'
+		"$1" /usr/bin export "$1" -eu | export /usr/bin done sed --verbose local
+awk export export printf local printf readonly 2>/dev/null
+	readonly /usr/bin x=1 --verbose echo ${HOME} |
+/usr/bin /usr/bin ${HOME}
+		done test export test grep
+&& 2>/dev/null then done test
+	awk $(pwd) ${HOME} awk export $(pwd) "$@" $(pwd) sed awk sed local ${HOME}
+		done 'quoted text' grep printf then --verbose
+&& --verbose echo cd && echo "$@" 2>/dev/null echo grep sed
+		${HOME} cd awk /usr/bin ${HOME} done 2>/dev/null sed grep
+	| sed --verbose "$1" grep 'quoted text' printf cd printf $(pwd) "$@" readonly
+	local sed 'quoted text' export ${HOME} /usr/bin test ${HOME}
+$(pwd) "$@" && sed export test printf |
+	done local grep readonly 2>/dev/null "$@" printf "$@" 2>/dev/null
+awk 'quoted text' && then $(pwd)
+		echo readonly "$1" && && cd x=1 done $(pwd) 'quoted text' readonly
+awk test 'quoted text' 2>/dev/null ${HOME} done readonly then grep -eu
+local "$1" "$@" then sed && echo && done $(pwd) local then echo echo /usr/bin done
+		grep "$@" 'quoted text' readonly 2>/dev/null awk x=1 "$@" -eu readonly $(pwd) test
+test export cd --verbose | awk x=1 readonly 'quoted text' cd
+	"$@" $(pwd) then --verbose --verbose && grep printf && --verbose sed export test
+	-eu sed test printf 'quoted text' export awk printf then
+	sed cd awk test printf cd grep sed "$@" done ${HOME} $(pwd) 'quoted text' then -eu
+-eu ${HOME} $(pwd) "$@" sed --verbose --verbose "$@" | export export
+grep --verbose ${HOME} export $(pwd) "$1" 'quoted text'
+		"$1" ${HOME} readonly --verbose && grep cd -eu "$1"
+awk 'quoted text' 'quoted text' $(pwd) printf
+		printf ${HOME} -eu 'quoted text'
+	grep ${HOME} export printf readonly grep
+$(pwd) --verbose printf /usr/bin cd cd then 2>/dev/null 'quoted text'
+		--verbose /usr/bin x=1 done sed "$@" ${HOME} $(pwd) printf grep sed sed awk sed
+printf done echo -eu ${HOME} done "$@" -eu then $(pwd) awk printf
+	x=1 cd --verbose "$1" && echo /usr/bin ${HOME} x=1 then | && then $(pwd) "$1"
+		"$1" "$@" && "$@" test x=1
+	--verbose awk sed readonly | readonly export grep $(pwd) sed "$@"
+echo then test /usr/bin 2>/dev/null readonly
+then | cd grep readonly sed x=1 test x=1
+"$@" x=1 && --verbose test cd printf readonly 'quoted text'
+		cd 'quoted text' "$1" local done printf 'quoted text' export test
+-eu 'quoted text' && /usr/bin sed x=1
+	awk $(pwd) done cd readonly -eu cd "$1" sed --verbose echo test
+		-eu /usr/bin "$@" 2>/dev/null export x=1
+awk $(pwd) --verbose sed
+printf && "$@" then && echo sed sed --verbose cd
+		sed && then then "$1" then 'quoted text' 'quoted text'
+		done then $(pwd) $(pwd) x=1 x=1 then --verbose --verbose
+echo ${HOME} grep cd -eu export && test test export
+done done | 2>/dev/null $(pwd) test /usr/bin sed /usr/bin export
+	cd readonly 'quoted text' readonly && then "$1" export 'quoted text' ${HOME}
+		cd then "$1" sed printf ${HOME} 2>/dev/null sed readonly ${HOME} x=1 "$1" 2>/dev/null
+done x=1 test $(pwd) --verbose local /usr/bin test && "$@" grep 2>/dev/null export
+done cd echo sed | awk cd readonly /usr/bin 'quoted text' "$@" awk | printf
+	$(pwd) -eu done --verbose
+	$(pwd) awk 2>/dev/null ${HOME}
+		then awk && x=1 'quoted text' local
+done 'quoted text' cd cd --verbose printf local /usr/bin cd /usr/bin
+		$(pwd) done sed echo "$@" -eu echo done printf export export | local
+test "$1" /usr/bin x=1 -eu test then -eu cd
+	local grep 'quoted text' readonly
+	printf printf done echo $(pwd) "$1" $(pwd) done then export readonly test
+'quoted text' x=1 && --verbose "$1" then echo awk -eu /usr/bin | 'quoted text'
+$(pwd) $(pwd) 2>/dev/null echo && grep done echo
+		readonly ${HOME} cd ${HOME} ${HOME} "$@" sed "$@" /usr/bin ${HOME}
+$(pwd) echo awk readonly
+echo printf 'quoted text' sed
+	-eu ${HOME} then "$1" "$1" "$1" done local $(pwd) -eu
+	${HOME} sed printf | cd 'quoted text' done printf /usr/bin
+		printf 2>/dev/null local x=1 done test x=1 local export readonly
+		export then --verbose "$1" 'quoted text' export 'quoted text'
+/usr/bin -eu local 2>/dev/null
+-eu done echo /usr/bin local
+	readonly --verbose && test 'quoted text' "$1" then done -eu cd then
+		readonly echo printf sed $(pwd) 2>/dev/null
+	then local 2>/dev/null && local printf
+		| then "$1" && readonly
+	grep echo done /usr/bin export "$1" --verbose $(pwd) | && $(pwd)
+	readonly done x=1 --verbose
+		${HOME} "$1" | cd | awk cd
+&& /usr/bin export sed $(pwd) echo 2>/dev/null
+-eu 2>/dev/null export
+		cd grep sed export sed
+	x=1 x=1 echo | $(pwd) $(pwd) export local export "$@" sed then export
+		sed cd "$1" "$1" "$@" done | ${HOME} "$1" && test && /usr/bin
+	| local --verbose test cd echo -eu done ${HOME} cd ${HOME} grep && | cd -eu local
+	local then "$1" x=1 echo awk 'quoted text' | done "$@" 2>/dev/null test /usr/bin
+	&& awk local test readonly ${HOME} x=1 cd 'quoted text'
+"$@" 2>/dev/null printf awk /usr/bin x=1 'quoted text' | test
+		local done x=1 sed | cd awk
+	printf /usr/bin x=1 sed 'quoted text' 2>/dev/null "$@" "$@" 2>/dev/null
+readonly printf $(pwd) cd printf test export local | printf
+test done -eu printf 2>/dev/null readonly sed $(pwd) test "$1" local
+done grep $(pwd) | 2>/dev/null then cd printf done cd awk 2>/dev/null printf
+	x=1 sed cd sed | then -eu local sed ${HOME} readonly "$1"
+	then sed | local /usr/bin local /usr/bin /usr/bin
+	then -eu cd | sed cd sed "$@" test test sed cd -eu then test 'quoted text' echo
+/usr/bin /usr/bin "$1" $(pwd) "$@" "$@" "$1" --verbose cd then 'quoted text'
+		done local --verbose /usr/bin x=1 | "$@" test "$1" 'quoted text'
+--verbose x=1 local done
+	then ${HOME} && x=1 cd sed --verbose local -eu echo && 'quoted text'
+		readonly local "$1" cd then cd /usr/bin export awk
+printf -eu printf "$@" "$@" grep --verbose
+printf readonly 'quoted text'
+	${HOME} echo "$@" -eu &&
+		then "$1" then ${HOME} | printf echo local "$@" test sed ${HOME} ${HOME} sed
+	grep ${HOME} export grep "$@" export awk && && sed then local /usr/bin
+--verbose && ${HOME} echo echo /usr/bin readonly printf readonly test awk
+-eu 'quoted text' test /usr/bin && test awk awk grep
+&& awk | printf 2>/dev/null then -eu then test done printf
+cd 'quoted text' then /usr/bin &&
+		then local test test | && -eu printf -eu $(pwd) echo local "$1" && /usr/bin export
+	"$@" ${HOME} "$1" $(pwd) export then test echo && "$@" printf
+		grep test done && x=1 /usr/bin readonly ${HOME} sed readonly
+		readonly grep ${HOME} x=1 sed 'quoted text' cd $(pwd)
+grep 'quoted text' export sed then local export
+export grep then then ${HOME} readonly $(pwd) | echo -eu
+		--verbose done --verbose awk export
+		2>/dev/null x=1 grep /usr/bin cd echo $(pwd) grep awk cd 2>/dev/null "$@" sed |
+		awk then | printf /usr/bin done
+	| | export grep awk readonly echo 2>/dev/null | 'quoted text' cd | x=1 done 2>/dev/null
+		sed awk readonly "$1"
+	$(pwd) /usr/bin $(pwd) -eu -eu grep -eu /usr/bin sed export
+${HOME} /usr/bin && done "$@" test 'quoted text'
+"$1" grep "$@" ${HOME} --verbose 2>/dev/null && printf x=1
+		2>/dev/null cd grep ${HOME} && "$@" -eu --verbose export "$1" readonly export ${HOME}
+		&& "$1" --verbose 2>/dev/null readonly --verbose
+	echo x=1 readonly --verbose done test
+		"$@" done then readonly echo cd -eu local
+		$(pwd) $(pwd) sed cd export local sed $(pwd) && -eu
+local -eu /usr/bin then cd "$@" ${HOME} echo /usr/bin -eu test sed $(pwd)
+echo -eu && --verbose grep grep export done grep printf
+		then local -eu --verbose 'quoted text' ${HOME}
+		2>/dev/null printf sed -eu export 2>/dev/null
+	&& awk then done 2>/dev/null
+2>/dev/null then x=1 --verbose $(pwd) x=1 readonly x=1 cd printf /usr/bin
+sed "$1" then cd /usr/bin printf | awk x=1 && grep readonly done test
+		| ${HOME} /usr/bin "$1" | done x=1 readonly ${HOME}
+readonly test -eu readonly | sed
+		2>/dev/null done ${HOME} test
+	test $(pwd) && x=1 then done
+export local sed ${HOME} done && sed | export | 2>/dev/null
+x=1 "$1" grep local awk cd $(pwd) 'quoted text' "$1" readonly readonly
+	export then x=1 | x=1 done "$1" ${HOME} | 2>/dev/null echo && printf
+"$@" awk 2>/dev/null 'quoted text' test cd grep awk 'quoted text'
+grep test echo "$@" printf -eu then "$@" cd -eu "$1" -eu "$@" done export
+	"$@" "$@" readonly then | 'quoted text' grep test export "$@" readonly
+		printf test && awk --verbose readonly 'quoted text' x=1 printf test && 2>/dev/null
+		"$@" local test $(pwd) readonly --verbose
+printf 'quoted text' "$@" awk cd "$@" ${HOME} echo grep readonly
+	/usr/bin 'quoted text' awk 'quoted text' "$1" done printf
+		"$@" readonly x=1 /usr/bin 'quoted text'
+		-eu ${HOME} && echo 2>/dev/null
+		test $(pwd) echo readonly /usr/bin -eu sed "$1" then grep export done then
+	--verbose grep "$@" awk "$1" test ${HOME} "$@" readonly "$@" $(pwd)
+	-eu printf 2>/dev/null ${HOME} echo sed ${HOME} /usr/bin | sed "$1" echo done
+| export 2>/dev/null 2>/dev/null $(pwd) then $(pwd)
+		--verbose -eu && echo ${HOME} 'quoted text' readonly -eu readonly
+		grep grep --verbose sed "$1" sed 2>/dev/null && cd $(pwd) local "$@" grep
+${HOME} -eu printf 'quoted text'
+		then export printf readonly -eu x=1 done done "$1"
+| | && "$1" 2>/dev/null ${HOME} printf readonly
+cd awk local echo grep 2>/dev/null echo done && printf
+		"$1" done local /usr/bin then
+	-eu echo && cd local /usr/bin x=1 2>/dev/null $(pwd) --verbose
+	-eu | done then test --verbose echo "$1"
+		"$1" ${HOME} /usr/bin echo
+then export then "$1" done then grep -eu $(pwd) cd | /usr/bin | /usr/bin
+/usr/bin $(pwd) 'quoted text' printf sed
+local --verbose $(pwd) test | cd "$@" test cd 2>/dev/null ${HOME} x=1 && readonly
+"$1" /usr/bin 2>/dev/null printf --verbose
+x=1 --verbose cd then echo $(pwd) sed -eu local ${HOME} 2>/dev/null local awk
+		x=1 grep done x=1 && 2>/dev/null readonly export /usr/bin grep
+test 'quoted text' "$1" /usr/bin ${HOME} 'quoted text'
+readonly && 'quoted text' ${HOME} done && local done readonly "$1" && --verbose
+export && readonly /usr/bin ${HOME}
+	'quoted text' awk ${HOME} sed ${HOME} readonly
+	readonly x=1 2>/dev/null ${HOME} cd
+	sed sed x=1 printf --verbose --verbose echo then grep /usr/bin
+sed local x=1 awk local cd
+		-eu cd $(pwd) sed "$1" awk test 'quoted text' readonly
+		readonly test x=1 --verbose cd
+	cd /usr/bin done "$@" /usr/bin 2>/dev/null ${HOME}
+'quoted text' -eu awk 2>/dev/null printf
+		sed -eu ${HOME} done awk sed readonly
+	&& export done ${HOME} $(pwd) --verbose x=1 'quoted text'
+		done && && ${HOME} && | && "$@" -eu
+	'quoted text' "$@" 'quoted text'
+		$(pwd) echo $(pwd) local echo "$1" /usr/bin -eu
+	&& printf done export readonly
+	sed --verbose 'quoted text' awk --verbose grep ${HOME} && then /usr/bin && printf
+		$(pwd) awk test test export printf echo printf "$@" local x=1 x=1 printf
+'quoted text' printf "$1" 'quoted text' | readonly test echo "$1" done
+		sed | ${HOME} x=1 grep $(pwd) ${HOME} then cd ${HOME}
+echo $(pwd) readonly $(pwd) && ${HOME} cd test export test
+		${HOME} "$@" echo x=1 export awk ${HOME} echo grep printf echo -eu
+$(pwd) grep echo printf cd done readonly
+		x=1 /usr/bin x=1 "$@" awk "$@" "$@" done export "$1" "$@" x=1 grep "$1" x=1
+		grep --verbose local "$1" --verbose local -eu "$1" && -eu local
+	export test cd "$1" done --verbose --verbose grep sed
+	local cd -eu grep printf /usr/bin --verbose "$@" cd grep /usr/bin
+	${HOME} done x=1 /usr/bin
+	grep /usr/bin | cd local x=1 grep | sed && readonly
+awk "$@" printf /usr/bin then done printf test 2>/dev/null local echo test 2>/dev/null
+2>/dev/null export local --verbose local "$1" | done then awk printf
+	test -eu printf done -eu 'quoted text' test then /usr/bin
+cd done 'quoted text' x=1 'quoted text' cd -eu sed && && readonly
+		"$@" --verbose export awk
+	x=1 then $(pwd) "$@" test "$1" cd && done export 'quoted text'
+	then done cd x=1 export export "$@" sed done "$@" -eu printf 'quoted text'
+	"$1" export echo | -eu sed
+		2>/dev/null readonly $(pwd)
+${HOME} x=1 x=1 export echo cd echo awk awk readonly echo "$1" 'quoted text'
+		cd 'quoted text' x=1 | local done grep export test echo done ${HOME}
+--verbose done "$@" done 2>/dev/null && grep -eu
+	export grep sed readonly 2>/dev/null -eu 2>/dev/null
+awk 'quoted text' | export local cd /usr/bin echo
+sed echo "$1" printf /usr/bin readonly
+	printf -eu awk test readonly echo export ${HOME} readonly done local -eu && x=1
+"$@" test export test "$@" | echo && test /usr/bin $(pwd) test done | 2>/dev/null
+$(pwd) readonly local --verbose export then
+	echo && && | -eu "$1" &&
+$(pwd) done $(pwd) awk --verbose 'quoted text' done 'quoted text' export -eu
+local awk 'quoted text' ${HOME} export ${HOME} $(pwd) x=1
+	test "$@" local then echo 2>/dev/null readonly printf
+	done export --verbose "$@" readonly sed | sed "$@"
+echo readonly ${HOME} sed
+	'quoted text' ${HOME} printf && export
+		&& "$@" "$1" done test
+		"$@" "$@" 2>/dev/null echo cd
+	'quoted text' "$@" --verbose export done sed awk cd export
+export -eu 'quoted text' --verbose then awk x=1 ${HOME} | x=1 done "$1"
+	x=1 local cd ${HOME} -eu /usr/bin sed cd awk x=1 sed /usr/bin
+	"$@" export readonly x=1 test grep -eu export | 'quoted text' readonly "$1"
+sed /usr/bin 'quoted text' --verbose
+		sed sed "$1" --verbose "$@"
+		-eu $(pwd) --verbose "$@" 'quoted text' then 'quoted text' -eu 'quoted text'
+	local local -eu test -eu | export echo local /usr/bin
+		"$1" -eu "$@" awk printf echo echo
+x=1 done "$1" "$@" cd ${HOME} local -eu awk
+		awk | then echo /usr/bin ${HOME} $(pwd) /usr/bin ${HOME} readonly x=1 /usr/bin
+cd x=1 test awk x=1 echo local cd /usr/bin readonly test done && x=1
+--verbose 2>/dev/null $(pwd) test sed echo readonly && done
+	export --verbose --verbose
+		awk test readonly | export x=1 --verbose
+then sed $(pwd) echo
+		x=1 | /usr/bin --verbose 'quoted text'
+	2>/dev/null 2>/dev/null "$1" ${HOME} sed readonly
+	done /usr/bin x=1 ${HOME} | && printf grep
+	export --verbose 2>/dev/null readonly ${HOME} done export
+	echo "$@" $(pwd) printf test echo local "$1" echo awk awk
+		| "$1" x=1 "$@" printf done then export $(pwd) grep printf test ${HOME}
+	echo x=1 test "$1" readonly test sed "$@" "$1" 2>/dev/null then 'quoted text'
+		2>/dev/null 2>/dev/null "$1" readonly
+		"$@" -eu local then local /usr/bin printf sed then
+	"$@" then 'quoted text' $(pwd) | $(pwd) test test
+	cd $(pwd) printf 'quoted text' echo "$@"
+	/usr/bin local test awk "$1"
+	test grep ${HOME} --verbose && | local then done awk then
+	${HOME} echo 2>/dev/null /usr/bin && awk 'quoted text' test $(pwd) sed test awk
+		/usr/bin 2>/dev/null $(pwd) readonly -eu && /usr/bin
+awk /usr/bin test export 2>/dev/null 'quoted text'
+	export readonly --verbose && sed --verbose /usr/bin "$@"
+	readonly $(pwd) /usr/bin cd local && 'quoted text'
+$(pwd) ${HOME} done --verbose $(pwd) --verbose "$@"
+		grep $(pwd) x=1 echo local awk echo done readonly
+sed /usr/bin grep | /usr/bin |
+		-eu export -eu "$1" awk export echo sed -eu grep export
+	${HOME} cd 'quoted text' cd x=1 readonly /usr/bin
+	| --verbose awk grep echo ${HOME}
+	| done && "$@" echo ${HOME} readonly "$1" ${HOME} | x=1 cd
+	test && --verbose done "$@" && grep 'quoted text' printf /usr/bin 2>/dev/null
+	x=1 2>/dev/null printf /usr/bin 2>/dev/null
+	local ${HOME} cd | && awk
+then "$@" echo grep 2>/dev/null grep $(pwd) 2>/dev/null test 'quoted text'
+done && then readonly /usr/bin done test
+	"$@" -eu awk printf -eu readonly cd -eu --verbose awk readonly x=1 'quoted text'
+then export "$@" && cd grep && then grep awk cd export sed 2>/dev/null
+		local "$@" sed x=1 --verbose "$@" $(pwd) && awk then echo
+	done --verbose export 2>/dev/null readonly local readonly grep
+	"$1" grep echo /usr/bin -eu "$@" cd echo "$@" -eu awk | sed /usr/bin
+	done --verbose x=1 local $(pwd) x=1 | readonly then local grep -eu "$1" --verbose
+		"$1" done | -eu printf export $(pwd) ${HOME} done awk readonly then
+	then ${HOME} ${HOME} | 2>/dev/null awk $(pwd) x=1 /usr/bin /usr/bin && $(pwd)
+		| && grep "$1" | 'quoted text' then -eu export cd export
+		--verbose && -eu sed 2>/dev/null sed test awk echo cd readonly grep
+		readonly --verbose cd local 'quoted text' grep then done | echo cd test
+	2>/dev/null test 'quoted text' x=1 echo | done 2>/dev/null export
+		local cd x=1 | local readonly grep then /usr/bin
+		--verbose ${HOME} test
+		printf 2>/dev/null "$1" echo grep done readonly 2>/dev/null printf x=1
+--verbose "$@" readonly && x=1 'quoted text'
+		grep $(pwd) /usr/bin |
+	readonly -eu test -eu cd "$@"
+x=1 export cd done then "$1" echo ${HOME} test -eu echo $(pwd) /usr/bin
+		&& "$1" | ${HOME} awk printf printf export echo done echo local
+${HOME} readonly --verbose 2>/dev/null local echo
+	&& grep local sed test readonly | echo
+echo awk then then readonly | 2>/dev/null 'quoted text' $(pwd)
+	sed awk -eu export "$1" awk x=1 local | -eu done | "$@" $(pwd) x=1 /usr/bin
+	${HOME} done 'quoted text' | --verbose sed printf && sed
+"$@" $(pwd) readonly
+sed "$1" $(pwd) local local then "$1" local local "$@" echo --verbose
+	readonly $(pwd) $(pwd) /usr/bin printf && && "$@" x=1 test $(pwd) local
+-eu /usr/bin grep x=1 "$1" readonly grep grep readonly
+	"$@" grep x=1 local --verbose x=1 -eu && /usr/bin local
+		test readonly 2>/dev/null local 2>/dev/null
+	| awk "$1" printf "$1" done readonly --verbose /usr/bin /usr/bin
+"$@" "$@" "$1" && $(pwd) grep awk export sed test
+		-eu "$1" printf "$@" echo printf 2>/dev/null x=1 --verbose awk
+		local local cd ${HOME} awk -eu awk
+		test export "$1" cd /usr/bin
+	$(pwd) 2>/dev/null x=1 "$@" local awk && --verbose
+'quoted text' ${HOME} "$@" 2>/dev/null
+	echo readonly sed cd $(pwd) cd cd printf
+		x=1 2>/dev/null echo cd -eu | /usr/bin local then $(pwd) test -eu | local echo
+	sed -eu ${HOME} x=1 export "$@" sed readonly --verbose local -eu ${HOME} echo 2>/dev/null
+		test readonly 'quoted text' echo export
+awk printf grep ${HOME} echo ${HOME} echo grep then
+	awk 'quoted text' "$@" cd grep grep | $(pwd) --verbose awk grep local 2>/dev/null
+"$@" cd local then "$1" local -eu readonly awk
+		grep /usr/bin printf local "$1" 2>/dev/null 2>/dev/null
+"$1" echo local awk | test done -eu "$1"
+	x=1 grep then "$@" readonly && -eu && sed test --verbose grep "$1" readonly
+test -eu x=1 $(pwd) grep export ${HOME} ${HOME} "$@" 'quoted text' echo cd &&
+		--verbose cd "$@" grep -eu /usr/bin "$1" 2>/dev/null printf readonly then printf
+readonly x=1 ${HOME} -eu local -eu printf 'quoted text' | cd then | "$1" x=1
+	echo $(pwd) x=1 $(pwd) export | export ${HOME} "$1"
+	| done /usr/bin grep | --verbose test /usr/bin
+		sed --verbose ${HOME} test printf -eu x=1
+	&& test 'quoted text' "$1" --verbose /usr/bin awk test readonly cd echo test -eu
+2>/dev/null then "$@" ${HOME} printf sed x=1 | && awk 'quoted text'
+&& -eu "$@" cd 2>/dev/null "$1" /usr/bin done grep test test export then
+	awk $(pwd) && "$1" awk test then && grep ${HOME} then cd printf export $(pwd) 'quoted text'
+&& cd awk local $(pwd) && 'quoted text' test printf done then "$@" /usr/bin
+	x=1 && sed ${HOME} test && export cd local ${HOME} -eu --verbose
+	| /usr/bin && x=1 echo ${HOME} "$1" $(pwd) ${HOME} grep
+		&& x=1 awk done 'quoted text' -eu
+-eu && | then local 'quoted text' grep grep cd local grep echo export
+	then && $(pwd) -eu export 'quoted text'
+--verbose && local local x=1 grep cd local
+sed $(pwd) 'quoted text' /usr/bin && "$1" "$@" echo echo printf then "$1" "$1" grep
+		cd -eu export /usr/bin awk -eu /usr/bin "$1" "$1" sed "$1" readonly grep then
+		x=1 --verbose echo ${HOME} -eu local
+		'quoted text' grep --verbose local echo readonly ${HOME} awk echo x=1 "$@"
+		/usr/bin && "$@" "$1" awk | -eu done then --verbose
+		| "$1" test -eu ${HOME}
+	done 'quoted text' then printf /usr/bin export x=1 && sed $(pwd) done echo
+	"$1" echo -eu readonly printf sed 'quoted text' ${HOME} export sed
+&& cd then readonly | sed && done x=1 cd export export awk echo -eu $(pwd)
+		/usr/bin cd done local readonly cd export x=1 'quoted text'
+	${HOME} --verbose cd --verbose then
+		export x=1 cd then | test done then --verbose awk x=1 --verbose
+	$(pwd) echo readonly "$1" readonly printf printf
+		/usr/bin | "$1" | cd grep | echo ${HOME} "$@" sed 2>/dev/null --verbose
+grep done awk -eu local cd 2>/dev/null test "$1"
+	| --verbose $(pwd) --verbose | done && grep 2>/dev/null
+	local grep printf 'quoted text' | export printf then printf ${HOME} 'quoted text'
+cd sed "$1" local $(pwd) 2>/dev/null
+	awk grep awk --verbose cd x=1 echo then then "$@" awk
+		2>/dev/null "$@" ${HOME} | done test done --verbose
+	local then | x=1 'quoted text' 'quoted text'
+	2>/dev/null "$1" done cd --verbose grep /usr/bin ${HOME}
+	2>/dev/null ${HOME} ${HOME} x=1 then
+sed && x=1 $(pwd) cd $(pwd) printf
+		export test export echo awk test export printf $(pwd) echo /usr/bin done cd printf
+		/usr/bin | local cd local
+		$(pwd) && ${HOME} local x=1 local local
+awk -eu 2>/dev/null "$@" readonly && "$@" && cd -eu echo cd echo
+&& -eu && done test awk /usr/bin
+		done export 'quoted text'
+		'quoted text' export export "$@" export awk grep echo && cd local $(pwd) 2>/dev/null
+-eu "$@" ${HOME} echo grep readonly printf ${HOME} echo export x=1
+	printf ${HOME} /usr/bin cd local grep cd sed "$@" -eu x=1 test cd --verbose
+sed | done ${HOME} x=1 test readonly && x=1 done done done -eu readonly
+	local x=1 x=1 grep grep echo | local /usr/bin sed awk
+echo && then local "$1" cd "$1" $(pwd) x=1 x=1 done "$1" x=1
+	2>/dev/null "$@" $(pwd) -eu /usr/bin
+		readonly 2>/dev/null --verbose done sed -eu && 'quoted text'
+test export test $(pwd) "$@" | readonly echo "$@" local printf test
+		/usr/bin x=1 sed grep cd local awk
+"$@" local export export readonly 2>/dev/null readonly
+printf | then | awk x=1 ${HOME} local "$@" 2>/dev/null sed /usr/bin
+		readonly printf export 'quoted text'
+	--verbose test ${HOME} echo
+	sed sed awk local $(pwd) "$@" $(pwd) test /usr/bin readonly ${HOME} done
+	readonly "$1" ${HOME} "$@" -eu awk done "$1" then done x=1 readonly
+	/usr/bin "$@" local sed $(pwd)
+"$@" done then ${HOME}
+2>/dev/null -eu sed local
+		echo grep grep export 2>/dev/null "$@" /usr/bin x=1 $(pwd) grep local
+		done printf export local export "$1" cd export
+		${HOME} && printf test x=1 export $(pwd) readonly
+		echo /usr/bin | test cd done && "$1" $(pwd) test "$1"
+		| export 2>/dev/null readonly
+	local -eu test $(pwd) then "$@" && x=1 && x=1 then --verbose printf ${HOME} cd local
+	readonly then "$@" sed readonly awk | done
+	grep grep ${HOME} "$@" | test sed printf cd grep done awk printf | local then then
+x=1 echo && readonly printf then 2>/dev/null
+cd "$1" done && cd $(pwd) done
+test then "$@" x=1 && awk --verbose
+grep readonly awk readonly -eu printf
@@ -0,0 +1,2001 @@
+	printf --verbose echo --verbose echo 2>/dev/null $(pwd)
+&& cd $(pwd) | --verbose $(pwd) 2>/dev/null
+		readonly readonly x=1 local "$1" 2>/dev/null local
+		sed -eu /usr/bin readonly -eu "$@" $(pwd)
+	printf readonly done ${HOME}
+		2>/dev/null | 'quoted text' then | test
+		"$1" done --verbose export "$@" test cd -eu x=1 && "$1" test local && readonly
+	printf && | x=1 local echo $(pwd) && ${HOME} echo
+		sed then then export 'quoted text' echo -eu x=1 export $(pwd) awk -eu
+		awk cd /usr/bin done 'quoted text' printf printf sed -eu | x=1 then
+		done readonly -eu -eu -eu then printf then "$1" /usr/bin grep cd readonly --verbose
+	2>/dev/null x=1 export awk /usr/bin test -eu
+		export 'quoted text' x=1 sed --verbose --verbose
+		--verbose sed | 2>/dev/null
+	awk readonly done done x=1 -eu export "$@" printf sed $(pwd) "$@" 'quoted text'
+readonly -eu test 2>/dev/null then 2>/dev/null
+"$1" echo test "$1" sed cd sed --verbose 'quoted text' "$@"
+		2>/dev/null local cd
+	done ${HOME} awk cd | && 2>/dev/null && local test test done readonly /usr/bin
+		/usr/bin cd readonly | --verbose
+	&& cd && && --verbose cd "$@" grep ${HOME} printf
+	'quoted text' then 2>/dev/null sed "$1" 2>/dev/null --verbose sed "$@" local done
+		"$@" cd echo grep "$1" grep && cd printf
+		&& echo cd grep -eu then printf cd sed cd 2>/dev/null
+	$(pwd) --verbose test "$@" -eu grep awk cd
+		'quoted text' "$1" local then $(pwd) 2>/dev/null
+		2>/dev/null $(pwd) | cd $(pwd) awk x=1 then done -eu local echo local -eu
+2>/dev/null grep x=1 "$@" done "$@" "$@" x=1 sed
+	grep echo test --verbose printf | "$1" && ${HOME} "$1" x=1
+	x=1 grep ${HOME} local -eu cd | ${HOME} 2>/dev/null grep "$1"
+		sed cd | printf "$1" export local $(pwd) printf then then echo "$@"
+		"$@" | && -eu /usr/bin then 'quoted text' -eu then | sed "$@"
+	"$@" $(pwd) --verbose "$1" x=1
+		| "$@" /usr/bin && then x=1 done | awk "$@" grep awk /usr/bin sed done
+then ${HOME} then printf ${HOME} readonly 'quoted text' x=1 export x=1 export
+export /usr/bin x=1 && --verbose echo | grep "$1" then | ${HOME} 'quoted text'
+	$(pwd) echo echo 2>/dev/null awk export -eu echo readonly cd $(pwd)
+cd local -eu then --verbose test -eu printf ${HOME} printf | /usr/bin readonly
+$(pwd) && printf awk grep /usr/bin
+	-eu done cd test then cd | grep 2>/dev/null 2>/dev/null
+	then done "$1" then | 2>/dev/null $(pwd) && | sed echo ${HOME} "$@" awk
+	"$@" sed x=1 -eu /usr/bin x=1
+sed cd sed sed grep local -eu printf 2>/dev/null
+test ${HOME} local x=1 'quoted text'
+local cd test | "$1" --verbose
+		/usr/bin grep | --verbose awk local "$1" printf
+	local export 2>/dev/null
+		local sed sed 2>/dev/null x=1 && ${HOME}
+/usr/bin cd $(pwd) printf /usr/bin 'quoted text'
+		$(pwd) sed 'quoted text' then ${HOME} ${HOME} $(pwd) 'quoted text'
+		--verbose cd "$@" export export "$@" then readonly ${HOME}
+	x=1 x=1 $(pwd) 'quoted text' -eu export readonly cd "$@" $(pwd)
+$(pwd) test printf sed --verbose 2>/dev/null local "$1" test test test
+		grep awk test "$@" echo printf
+		${HOME} grep then x=1 $(pwd) printf awk x=1 export "$@" cd $(pwd) local grep awk
+--verbose 2>/dev/null awk $(pwd) 2>/dev/null cd done | awk
+	x=1 export test sed /usr/bin readonly echo echo 'quoted text'
+test then ${HOME} then done 'quoted text' local test -eu && printf x=1
+		awk sed then local /usr/bin export cd printf
+	"$@" ${HOME} && export cd "$@" printf ${HOME} test /usr/bin done
+		-eu readonly /usr/bin $(pwd) readonly awk grep | readonly "$1" printf --verbose
+x=1 | export 2>/dev/null done readonly test -eu
+	cd awk $(pwd) "$@" $(pwd) "$1" test "$1" local test then | 2>/dev/null
+	export "$1" awk -eu export echo done $(pwd) echo awk printf then printf
+x=1 printf ${HOME} 'quoted text' test 'quoted text' "$@" ${HOME} 2>/dev/null done
+	/usr/bin 2>/dev/null | cd "$1" "$@" then local | x=1 then sed
+		2>/dev/null 2>/dev/null awk awk 'quoted text' sed | $(pwd) echo printf | done $(pwd)
+grep "$@" echo export 2>/dev/null | x=1 'quoted text'
+	"$@" "$1" | "$1" grep readonly printf 'quoted text' -eu --verbose
+x=1 && test /usr/bin grep x=1
+	| x=1 test cd "$@" grep export then 'quoted text' 2>/dev/null test export
+local 'quoted text' test awk 'quoted text'
+"$@" /usr/bin ${HOME} ${HOME} "$@" 'quoted text'
+		--verbose printf cd | -eu ${HOME} $(pwd) "$1" done done "$@"
+echo /usr/bin grep done echo ${HOME} export local -eu readonly "$@" awk 'quoted text'
+	readonly "$@" cd "$1" done && "$1" --verbose
+		x=1 x=1 /usr/bin -eu
+		'quoted text' cd printf /usr/bin awk --verbose local grep done |
+		x=1 /usr/bin ${HOME} ${HOME} done | && readonly --verbose
+"$1" printf then 2>/dev/null cd "$@" "$@" export
+		printf sed -eu 'quoted text' echo sed
+readonly --verbose awk && | cd "$1" x=1 then
+	"$1" done readonly -eu | cd /usr/bin done ${HOME} cd
+| done printf "$@" "$@" "$@" "$@" awk sed awk done readonly 'quoted text' then
+	test --verbose awk echo
+cd 'quoted text' export echo export && x=1 done
+	readonly sed "$1" readonly "$1" /usr/bin test ${HOME}
+-eu awk "$@" then && test readonly "$1"
+		sed 'quoted text' awk 2>/dev/null x=1 ${HOME} "$1" printf ${HOME} test |
+/usr/bin 2>/dev/null grep
+2>/dev/null 'quoted text' cd then done
+	2>/dev/null test "$@" done ${HOME} -eu --verbose
+	"$@" --verbose "$1" /usr/bin /usr/bin "$@" export sed
+	export "$1" local echo printf /usr/bin
+	/usr/bin readonly readonly grep "$1" echo | echo grep /usr/bin
+&& awk "$1" 2>/dev/null grep "$@"
+done sed sed done $(pwd) readonly x=1 grep grep
+	2>/dev/null then 'quoted text' 'quoted text' ${HOME}
+		export "$1" grep && "$1" "$@" cd grep
+		grep export sed $(pwd) local done readonly "$1" /usr/bin
+		then "$@" done --verbose printf
+		then awk cd "$@" "$1" -eu ${HOME} then
+cd export local 2>/dev/null export x=1 done /usr/bin test
+	cd test export local x=1 done /usr/bin && awk
+		then then done --verbose sed awk ${HOME} sed readonly printf /usr/bin
+done printf readonly done cd /usr/bin
+	grep done -eu awk cd --verbose printf
+		2>/dev/null done readonly local readonly echo export
+	printf $(pwd) "$@" sed sed -eu printf readonly readonly ${HOME}
+	test | echo /usr/bin local
+	then && /usr/bin then grep "$1" cd -eu -eu printf "$@" --verbose
+"$1" /usr/bin awk grep then done local -eu readonly
+	"$1" "$1" printf then | awk --verbose
+	| x=1 ${HOME} readonly | then
+	"$1" | 'quoted text' grep --verbose printf x=1 /usr/bin echo local x=1
+		done readonly test done --verbose "$@" /usr/bin ${HOME}
+readonly awk printf printf then awk --verbose cd local "$1" done $(pwd)
+x=1 --verbose echo test then ${HOME} 2>/dev/null 2>/dev/null
+awk 2>/dev/null $(pwd) | --verbose -eu
+		--verbose printf printf local test --verbose cd -eu then "$1" cd | export ${HOME}
+	printf "$1" $(pwd) readonly done export
+		"$@" echo echo ${HOME} echo local | grep grep local "$1" cd cd
+		readonly sed test done export 2>/dev/null test x=1 echo && ${HOME}
+then 'quoted text' grep readonly ${HOME} echo readonly test 'quoted text' done
+awk --verbose local printf x=1 ${HOME} --verbose grep cd export
+		echo /usr/bin && grep --verbose -eu cd --verbose 2>/dev/null readonly sed awk |
+		2>/dev/null -eu /usr/bin readonly
+${HOME} printf local 2>/dev/null cd --verbose 'quoted text'
+| | grep awk local printf "$1" sed 'quoted text' echo sed &&
+	--verbose awk export ${HOME} 2>/dev/null
+		| printf x=1 'quoted text' -eu printf done 'quoted text' ${HOME} && cd -eu | /usr/bin
+		export $(pwd) cd done awk --verbose | $(pwd) x=1
+	&& | 'quoted text' | | x=1 /usr/bin
+"$1" local printf x=1 grep
+		&& ${HOME} x=1 $(pwd) 'quoted text' awk 2>/dev/null "$@" /usr/bin 'quoted text'
+	test -eu $(pwd) readonly "$@" $(pwd) "$@" --verbose "$@" readonly grep cd
+		export 2>/dev/null $(pwd) 2>/dev/null
+'quoted text' printf ${HOME} $(pwd)
+	&& printf cd 2>/dev/null /usr/bin test --verbose $(pwd) export 'quoted text'
+		$(pwd) --verbose $(pwd) "$1"
+local done local $(pwd) 2>/dev/null test /usr/bin x=1 "$1" --verbose
+'quoted text' 2>/dev/null
+awk printf 2>/dev/null | x=1 local local echo "$@" done local export 'quoted text'
+		grep "$1" export && && | && 2>/dev/null
+		&& echo x=1 "$@" export awk
+	done sed grep --verbose readonly | printf
+"$@" "$@" readonly ${HOME} echo $(pwd)
+	--verbose done 2>/dev/null 'quoted text' printf ${HOME} export
+		"$1" sed ${HOME} then local "$@" done cd
+"$@" cd test readonly echo
+		then done test sed 'quoted text' then x=1 printf "$@" grep
+	local awk awk sed sed 'quoted text' && | | sed awk ${HOME} "$1" 2>/dev/null
+done awk done test then | --verbose grep -eu "$1"
+/usr/bin printf /usr/bin sed printf $(pwd) test test printf
+"$1" test /usr/bin 'quoted text' 2>/dev/null && --verbose /usr/bin
+"$1" "$1" awk 'quoted text' export done --verbose cd "$@" readonly printf -eu
+		local && -eu -eu /usr/bin local local --verbose then ${HOME} test
+x=1 2>/dev/null test --verbose 'quoted text' -eu readonly
+		export "$@" echo awk export awk x=1 then local 2>/dev/null 2>/dev/null
+	export ${HOME} 'quoted text' printf echo
+		&& -eu /usr/bin grep -eu awk readonly ${HOME} -eu 2>/dev/null
+	then readonly export ${HOME}
+		| -eu grep /usr/bin cd sed export then printf $(pwd) grep 2>/dev/null
+	2>/dev/null test /usr/bin printf export export $(pwd)
+	$(pwd) 2>/dev/null local "$@" "$@" printf /usr/bin printf /usr/bin
+	$(pwd) && test done test local then | test /usr/bin 2>/dev/null
+local grep "$@" ${HOME} 2>/dev/null test export "$@" local 'quoted text'
+		test $(pwd) cd && &&
+	2>/dev/null "$@" grep && echo 2>/dev/null sed && && cd | /usr/bin "$@" /usr/bin
+	awk grep 'quoted text' echo "$1" awk done grep sed
+--verbose /usr/bin | test grep -eu printf then done test /usr/bin
+		export && printf awk "$1" readonly
+		&& grep | --verbose grep 2>/dev/null awk ${HOME} 'quoted text' readonly x=1 ${HOME}
+	grep $(pwd) && export "$@" $(pwd)
+		awk test | "$@" 'quoted text' ${HOME}
+| x=1 -eu cd "$@" $(pwd) readonly
+sed echo sed 'quoted text' "$@" grep test sed
+	local ${HOME} cd local "$@" "$1" x=1 "$1" 2>/dev/null && 2>/dev/null
+		"$1" echo grep local "$@" /usr/bin grep
+	echo 2>/dev/null export then grep then test 'quoted text'
+		| export test then && 'quoted text' printf grep 2>/dev/null awk
+		&& export then grep export ${HOME} then /usr/bin
+	grep printf printf && --verbose $(pwd) printf $(pwd) readonly
+	"$@" | cd 'quoted text' then awk local "$1" 2>/dev/null
+test --verbose /usr/bin local
+${HOME} ${HOME} | test --verbose echo ${HOME} then test echo -eu printf
+	$(pwd) 'quoted text' x=1 --verbose cd "$1" /usr/bin
+&& "$1" readonly echo grep cd | &&
+		/usr/bin then awk grep printf awk export readonly "$@" "$@" /usr/bin cd test
+2>/dev/null export 'quoted text' sed readonly
+		cd -eu grep export $(pwd) done grep awk sed
+		'quoted text' export x=1 "$@" test x=1 sed 2>/dev/null
+		'quoted text' cd && --verbose 2>/dev/null grep test
+		echo then --verbose && --verbose x=1 test -eu ${HOME} ${HOME} test
+		grep awk -eu ${HOME} done ${HOME} -eu "$@" echo awk grep ${HOME}
+2>/dev/null "$1" cd done -eu awk $(pwd) ${HOME} awk --verbose ${HOME} readonly
+2>/dev/null /usr/bin 2>/dev/null
+	echo echo awk echo echo
+		| -eu cd | sed echo $(pwd) ${HOME} /usr/bin /usr/bin 2>/dev/null export
+	$(pwd) /usr/bin "$@" -eu ${HOME} awk readonly
+x=1 "$@" | --verbose "$@" done sed 'quoted text' | awk --verbose "$@" $(pwd) &&
+		cd 2>/dev/null grep grep
+| x=1 cd ${HOME} "$@" "$1" -eu
+		test readonly 2>/dev/null sed printf --verbose done local "$1" test awk
+		sed awk grep "$@" x=1 x=1 done x=1 cd test sed printf
+		sed test /usr/bin test | "$1" grep echo sed done echo ${HOME} /usr/bin done
+local -eu sed 'quoted text' then 2>/dev/null
+		&& /usr/bin cd "$@" cd then --verbose
+$(pwd) 2>/dev/null printf cd local $(pwd) printf echo done export
+	'quoted text' 2>/dev/null sed ${HOME} printf cd --verbose grep then readonly cd
+sed sed then echo "$@" sed --verbose 2>/dev/null 'quoted text'
+printf 'quoted text' x=1 -eu readonly x=1 then | 2>/dev/null
+grep done cd printf cd --verbose sed ${HOME} $(pwd) test sed x=1
+	done local -eu sed export readonly -eu /usr/bin ${HOME} "$1"
+		/usr/bin then | -eu export cd then awk readonly /usr/bin /usr/bin
+	"$@" echo local readonly /usr/bin x=1 -eu readonly $(pwd)
+printf export /usr/bin local export then && echo 2>/dev/null
+| local "$@" 2>/dev/null x=1 --verbose /usr/bin --verbose echo x=1
+	/usr/bin /usr/bin "$@" export x=1 export "$@" 'quoted text' grep
+$(pwd) done | export then
+x=1 && done 2>/dev/null 'quoted text' -eu printf cd done
+		${HOME} export x=1 && $(pwd) cd $(pwd) -eu done "$@" "$@" 2>/dev/null
+	| export local -eu | readonly x=1
+	echo done --verbose readonly --verbose local test 'quoted text' | &&
+		echo printf local printf echo awk $(pwd) done 2>/dev/null 'quoted text'
+	echo awk sed | grep --verbose && --verbose readonly
+local "$1" export awk x=1 awk done
+		printf then done cd sed $(pwd) echo 2>/dev/null
+		readonly local $(pwd) test /usr/bin --verbose
+&& 'quoted text' then awk /usr/bin /usr/bin | $(pwd) 'quoted text'
+	awk printf done awk 'quoted text'
+done x=1 printf local /usr/bin && sed -eu local echo
+		cd | /usr/bin && local sed echo readonly
+		sed --verbose grep grep done "$1" export cd -eu 2>/dev/null grep then "$@"
+	2>/dev/null /usr/bin sed awk $(pwd) /usr/bin done &&
+		awk $(pwd) -eu printf echo && $(pwd) 2>/dev/null -eu --verbose echo done
+	"$1" -eu cd "$1" --verbose test
+"$@" sed --verbose "$1" readonly cd sed done cd $(pwd) grep x=1 "$1"
+x=1 test cd $(pwd) then --verbose 'quoted text' then sed then
+local --verbose export ${HOME}
+		-eu then 2>/dev/null "$@" && "$1" | && -eu local awk
+	"$1" ${HOME} done sed sed test "$@" | cd "$1" "$1" ${HOME}
+export grep done readonly test
+		sed awk readonly sed done x=1 sed x=1 'quoted text'
+-eu then local x=1 done ${HOME} printf -eu export echo $(pwd) printf --verbose
+'quoted text' readonly awk 'quoted text'
+		printf test awk echo sed ${HOME} 2>/dev/null $(pwd) /usr/bin printf /usr/bin
+sed local grep -eu | | /usr/bin
+	export cd && then grep /usr/bin ${HOME} local test readonly && | export
+		"$1" export && export printf awk readonly "$1" export sed $(pwd)
+grep "$1" --verbose 2>/dev/null awk "$1" ${HOME} --verbose ${HOME}
+	readonly 2>/dev/null ${HOME}
+'quoted text' "$1" then cd local --verbose && 'quoted text' $(pwd)
+x=1 then && readonly -eu export
+test 'quoted text' "$1" local grep ${HOME} done
+		done ${HOME} -eu printf ${HOME} /usr/bin $(pwd) && grep
+test sed then grep /usr/bin -eu $(pwd) echo printf echo --verbose /usr/bin
+		${HOME} printf --verbose local "$@" -eu ${HOME} "$@"
+cd "$1" readonly sed /usr/bin $(pwd) x=1 | export test /usr/bin
+export --verbose test "$1" cd printf printf
+	printf && then $(pwd) 2>/dev/null "$1" | ${HOME} echo
+		readonly test --verbose then --verbose
+/usr/bin -eu --verbose "$@" readonly x=1 sed x=1 then --verbose sed test
+		then /usr/bin then $(pwd) && then -eu
+		grep test "$1" grep x=1 export sed awk readonly
+then done sed then -eu "$@" echo
+	--verbose /usr/bin -eu "$1" sed 2>/dev/null sed "$@" sed ${HOME} test "$@"
+		-eu $(pwd) grep local grep
+	local export "$@" then
+test local echo echo sed | 'quoted text' awk
+	readonly "$@" x=1 done 'quoted text' awk "$@" $(pwd)
+		test | printf cd 2>/dev/null && --verbose then grep && -eu 'quoted text' sed
+		-eu --verbose /usr/bin "$@" "$@" readonly $(pwd) echo
+	grep readonly printf awk readonly local test "$1" 2>/dev/null
+awk | echo test $(pwd) "$@" sed readonly | done 2>/dev/null
+		x=1 echo export "$1" awk cd && -eu
+echo test 2>/dev/null -eu $(pwd)
+		--verbose "$@" cd $(pwd) x=1 cd ${HOME}
+/usr/bin readonly local
+		printf | then cd | && "$1" local test 2>/dev/null $(pwd)
+		grep export then /usr/bin grep $(pwd) 'quoted text'
+awk -eu ${HOME} && --verbose grep /usr/bin then grep readonly
+	then awk local then 'quoted text' sed /usr/bin
+	/usr/bin 'quoted text' | awk
+-eu && grep --verbose -eu
+		/usr/bin --verbose sed
+	"$1" 2>/dev/null then 'quoted text' -eu -eu then echo "$@" "$1" export sed
+	${HOME} | /usr/bin cd --verbose
+		x=1 && awk ${HOME} cd /usr/bin test
+	cd echo grep local echo grep local test awk -eu -eu "$1" done done && export
+		x=1 $(pwd) "$1" 'quoted text' 2>/dev/null && then local then ${HOME} ${HOME}
+x=1 x=1 echo 2>/dev/null cd echo x=1 | "$@" sed awk x=1 $(pwd) cd test printf
+-eu "$@" $(pwd) 2>/dev/null then test export done then && /usr/bin /usr/bin
+		test sed --verbose 'quoted text'
+grep cd "$@" 2>/dev/null then /usr/bin
+printf 'quoted text' grep awk awk echo done /usr/bin sed |
+		done awk $(pwd) x=1 'quoted text'
+	local echo grep awk done then /usr/bin
+--verbose cd 2>/dev/null echo export
+		| && then readonly sed --verbose
+		'quoted text' readonly test test grep -eu | | local $(pwd) ${HOME} ${HOME}
+		2>/dev/null /usr/bin 'quoted text' local test 'quoted text' && sed 2>/dev/null -eu
+		local sed 'quoted text' -eu ${HOME} then grep ${HOME} /usr/bin $(pwd)
+export echo done grep x=1 &&
+local && echo --verbose cd awk
+	test "$@" 'quoted text' test 'quoted text' "$@" local /usr/bin awk "$1" test grep
+		&& /usr/bin echo then 'quoted text' /usr/bin 2>/dev/null awk "$1"
+		grep 'quoted text' sed -eu awk /usr/bin ${HOME} readonly x=1 done export test
+awk 'quoted text' awk then echo --verbose
+	sed "$@" done -eu grep "$@" /usr/bin $(pwd) 'quoted text' |
+	sed test && -eu "$@" printf test 'quoted text' export x=1 readonly 2>/dev/null
+echo "$1" && printf x=1 $(pwd)
+	then grep printf --verbose sed -eu $(pwd) grep ${HOME} && $(pwd) sed 'quoted text'
+2>/dev/null -eu -eu test /usr/bin
+	/usr/bin cd -eu 'quoted text' awk grep 2>/dev/null grep "$1" test sed
+| --verbose "$1" --verbose grep local 'quoted text' $(pwd)
+		'quoted text' test readonly export --verbose readonly
+		export 'quoted text' 2>/dev/null grep echo
+	2>/dev/null "$1" 2>/dev/null grep sed readonly -eu -eu ${HOME}
+	grep done printf -eu /usr/bin
+x=1 "$1" local sed -eu -eu awk
+$(pwd) && x=1 grep --verbose x=1 grep sed /usr/bin 2>/dev/null | /usr/bin
+&& /usr/bin cd printf "$1" /usr/bin $(pwd) local done done sed test
+printf echo test /usr/bin
+	local $(pwd) /usr/bin export x=1 ${HOME} local
+		${HOME} awk x=1 local x=1 printf sed local x=1 grep
+	awk printf export done $(pwd) "$@" -eu echo -eu "$1" /usr/bin ${HOME}
+		cd && 'quoted text' cd x=1 grep sed
+	&& | | $(pwd) -eu /usr/bin readonly then cd | /usr/bin | $(pwd) done echo
+		&& sed 2>/dev/null grep awk echo sed --verbose $(pwd) -eu printf
+		test readonly /usr/bin "$1" printf printf
+		test "$1" && 'quoted text' x=1 --verbose --verbose
+x=1 then sed | "$@" --verbose awk x=1 /usr/bin --verbose 2>/dev/null 2>/dev/null
+		sed 2>/dev/null echo -eu ${HOME} 'quoted text'
+	$(pwd) && -eu local | 2>/dev/null local ${HOME} echo grep cd done cd test printf
+	echo export awk readonly awk $(pwd) 'quoted text' $(pwd) && done
+--verbose $(pwd) | | then 'quoted text'
+		grep $(pwd) "$@" ${HOME}
+		local done grep && | $(pwd) export ${HOME} && ${HOME}
+	printf | 2>/dev/null then x=1 cd --verbose 2>/dev/null cd
+	test x=1 printf 2>/dev/null --verbose 'quoted text' cd
+	cd "$@" readonly test --verbose "$1" local awk test
+	-eu | cd cd printf /usr/bin awk | export 'quoted text' ${HOME} 2>/dev/null
+'quoted text' | && x=1 done -eu 'quoted text' done
+x=1 cd awk printf 'quoted text' | 'quoted text' readonly printf readonly "$@"
+	/usr/bin done export cd echo
+2>/dev/null done awk awk $(pwd) echo | && readonly
+		"$@" test sed --verbose
+		printf 2>/dev/null grep printf grep local
+sed -eu printf --verbose then && 2>/dev/null grep
+	-eu && export -eu cd $(pwd) cd test awk ${HOME} sed sed x=1 | $(pwd)
+		readonly "$@" readonly 2>/dev/null -eu test echo grep
+-eu /usr/bin test echo "$@" && && printf done && then x=1
+		'quoted text' "$@" local test awk export awk done test 2>/dev/null grep then
+		cd printf grep local export ${HOME} 2>/dev/null
+		test echo 2>/dev/null sed && printf 'quoted text'
+	${HOME} $(pwd) sed 2>/dev/null local
+		$(pwd) --verbose echo
+	--verbose echo test test grep test -eu done export $(pwd) done awk "$@"
+$(pwd) --verbose "$@" "$@" awk done grep local x=1 done x=1 'quoted text'
+		$(pwd) | local readonly x=1 && "$1" && then
+	"$@" "$@" awk /usr/bin printf test then then
+	awk "$@" $(pwd) sed "$@" sed printf "$@"
+printf --verbose 2>/dev/null && ${HOME}
+		echo export /usr/bin "$1" awk grep "$@" then awk readonly
+		-eu export printf grep then "$1" --verbose printf test ${HOME}
+'quoted text' awk then /usr/bin export
+	| --verbose sed export 'quoted text' printf printf x=1 local printf
+		-eu cd test test awk then
+		sed --verbose done -eu cd "$1" awk test /usr/bin --verbose sed "$@"
+		x=1 cd ${HOME} done | "$1" echo
+		"$1" ${HOME} $(pwd) readonly | awk "$1" cd readonly awk done -eu &&
+	printf echo "$@" 'quoted text' "$1" printf $(pwd) | sed
+	sed "$1" "$1" then -eu then sed -eu
+		"$1" --verbose readonly local
+		then test local test "$1" x=1 "$@"
+	'quoted text' cd $(pwd) printf "$1" 'quoted text' x=1 $(pwd) grep $(pwd) "$1"
+		"$@" 'quoted text' x=1 "$1" export test
+	awk 'quoted text' awk readonly then /usr/bin --verbose "$1" "$@" export "$@"
+$(pwd) local cd $(pwd) readonly 2>/dev/null /usr/bin sed echo x=1 $(pwd)
+then local --verbose "$1" && /usr/bin "$@" /usr/bin
+	cd 'quoted text' test awk 2>/dev/null sed | then && awk export "$1" readonly
+	printf cd readonly done readonly ${HOME} readonly 'quoted text' readonly
+	test -eu local printf export printf echo $(pwd) /usr/bin ${HOME} readonly
+	x=1 awk --verbose grep $(pwd) "$@" done grep /usr/bin | then |
+		/usr/bin -eu -eu /usr/bin $(pwd) -eu grep 'quoted text' -eu | awk "$1" && test x=1
+local awk 'quoted text' cd sed | x=1 "$1" then cd "$@" awk readonly | echo
+	| 2>/dev/null grep -eu x=1 && "$1" $(pwd) 'quoted text' ${HOME} "$1"
+	x=1 done echo sed done | echo sed ${HOME}
+--verbose export "$@" test "$1" local $(pwd) && -eu printf echo -eu
+	cd x=1 export -eu 'quoted text' $(pwd) --verbose
+done | readonly "$1" 'quoted text' done
+grep | local --verbose | awk -eu
+	echo then --verbose echo then /usr/bin readonly /usr/bin
+done --verbose $(pwd) && export "$1"
+		-eu printf local then done $(pwd) readonly readonly --verbose /usr/bin -eu
+		grep echo "$1" x=1 x=1 "$1" 2>/dev/null readonly export echo
+	cd 2>/dev/null 2>/dev/null export awk ${HOME}
+local "$1" awk test --verbose printf | cd &&
+&& x=1 then readonly 2>/dev/null readonly
+readonly cd local /usr/bin local readonly
+		$(pwd) done test 'quoted text'
+		$(pwd) grep && test $(pwd) grep sed sed 2>/dev/null 2>/dev/null
+"$1" then awk && local | echo "$1" -eu printf --verbose 2>/dev/null
+	readonly readonly sed test done "$1" | "$1" "$1" readonly then
+		printf local && sed readonly readonly x=1 'quoted text'
+		&& echo awk echo export $(pwd) echo cd "$@" -eu local $(pwd)
+		test local -eu awk 'quoted text' 'quoted text' 2>/dev/null local
+	export x=1 --verbose grep echo "$@" awk sed "$1" grep test local done -eu sed
+		printf 'quoted text' ${HOME} done echo 2>/dev/null echo
+		'quoted text' echo done then /usr/bin
+then x=1 readonly export readonly 2>/dev/null cd --verbose local 'quoted text' ${HOME}
+awk 2>/dev/null awk test
+done export "$1" "$1" --verbose --verbose "$@" then -eu -eu local $(pwd)
+	test | cd && && $(pwd) sed 'quoted text' then printf local cd grep awk readonly
+		/usr/bin $(pwd) -eu x=1 'quoted text' "$@" then printf grep done ${HOME}
+--verbose awk $(pwd) readonly "$1" done
+--verbose sed ${HOME} |
+		echo done 2>/dev/null | 2>/dev/null export && "$@" ${HOME}
+	test cd echo --verbose "$1" && grep awk "$1" export
+		${HOME} 2>/dev/null then cd done -eu | printf | cd export grep && 'quoted text'
+		test ${HOME} grep x=1 test cd -eu cd "$1" awk
+x=1 x=1 -eu then $(pwd) | -eu x=1 && printf printf readonly
+2>/dev/null done x=1 awk 2>/dev/null | sed echo
+	&& sed printf 2>/dev/null "$@" -eu
+		'quoted text' 'quoted text' ${HOME} /usr/bin "$1" 2>/dev/null | test
+		export then --verbose awk test
+	"$1" awk ${HOME} local /usr/bin
+	x=1 "$1" done /usr/bin $(pwd) ${HOME} /usr/bin test
+	export /usr/bin test cd &&
+grep "$@" "$@" x=1 cd then "$1" test 2>/dev/null
+	grep test echo cd printf test /usr/bin "$1" sed $(pwd) /usr/bin "$1" cd printf
+		--verbose test export -eu awk ${HOME} cd then sed 2>/dev/null
+awk awk local readonly sed -eu echo | -eu echo ${HOME} -eu && readonly
+	2>/dev/null cd x=1 grep done grep sed
+readonly "$1" $(pwd) readonly
+	echo /usr/bin x=1 2>/dev/null "$1" cd cd | sed $(pwd) echo -eu $(pwd) &&
+	done then -eu --verbose ${HOME} grep done sed printf done 'quoted text'
+		--verbose 2>/dev/null cd "$@" /usr/bin ${HOME} ${HOME}
+awk && --verbose grep then --verbose done 'quoted text' | export
+	local x=1 awk test && ${HOME} then | sed sed done x=1 "$@" /usr/bin sed then
+		/usr/bin 2>/dev/null 'quoted text' local then
+	printf export && readonly sed readonly printf
+		${HOME} x=1 export 2>/dev/null printf sed
+		cd $(pwd) sed export "$1" then
+"$@" cd awk ${HOME} awk /usr/bin local --verbose local "$@" done awk
+grep cd --verbose grep done "$1" "$1" echo "$1"
+local 2>/dev/null x=1 | local "$1"
+/usr/bin test echo readonly awk sed grep grep grep grep 2>/dev/null
+	readonly readonly cd readonly
+	$(pwd) printf x=1 -eu ${HOME} then 2>/dev/null "$@" /usr/bin
+		cd $(pwd) /usr/bin export $(pwd) "$1"
+		awk --verbose local && 'quoted text'
+	2>/dev/null && $(pwd) export echo then cd 2>/dev/null echo
+	$(pwd) 2>/dev/null echo -eu local --verbose printf
+	/usr/bin 2>/dev/null done done ${HOME} echo readonly --verbose x=1 sed grep
+/usr/bin 'quoted text' then sed cd readonly "$1" x=1
+--verbose readonly export
+then test "$1" "$1" "$@" "$1" export readonly readonly
+	cd 'quoted text' local ${HOME} then $(pwd) -eu awk /usr/bin
+		sed x=1 awk 'quoted text' cd cd cd
+	/usr/bin 'quoted text' export grep -eu x=1 "$1" test
+local "$1" cd sed /usr/bin readonly $(pwd) sed x=1 sed 2>/dev/null echo
+readonly 2>/dev/null $(pwd) readonly cd | export export cd echo "$@"
+		&& export echo then sed 2>/dev/null
+	then sed local -eu && $(pwd) test printf
+printf readonly "$1" then /usr/bin then $(pwd) then && export done -eu export
+sed "$1" /usr/bin printf ${HOME} awk printf echo
+	grep sed "$1" 2>/dev/null
+test readonly 'quoted text'
+	export 'quoted text' /usr/bin readonly --verbose sed ${HOME} then ${HOME} cd /usr/bin
+		$(pwd) sed printf --verbose local
+	then $(pwd) echo export grep | 'quoted text' export "$@" local echo "$1" 'quoted text'
+sed printf | --verbose "$@" readonly
+2>/dev/null ${HOME} ${HOME} local | $(pwd) | grep /usr/bin
+	export done readonly ${HOME} test cd sed /usr/bin then "$1" "$1" $(pwd)
+		cd echo done done && ${HOME} ${HOME} echo -eu ${HOME} "$@" done
+	grep && "$@" awk 2>/dev/null --verbose
+cd "$1" 'quoted text' && | "$1" echo -eu x=1 readonly | awk local | 'quoted text'
+	| && readonly then -eu
+		awk --verbose then | grep export
+	done --verbose test x=1 then then
+		echo --verbose "$@" 2>/dev/null $(pwd) local && | sed /usr/bin export
+cd grep && /usr/bin 2>/dev/null --verbose awk readonly local 'quoted text' x=1
+		"$@" $(pwd) then x=1 export printf
+"$1" /usr/bin then grep local export then then then printf && ${HOME}
+	sed cd | x=1 /usr/bin done 'quoted text'
+		&& $(pwd) awk -eu && | test readonly echo export
+		x=1 done "$@" ${HOME} --verbose
+	-eu /usr/bin && readonly then local cd grep echo -eu grep cd
+readonly -eu cd | 2>/dev/null 'quoted text' x=1 | test && awk "$1" export
+2>/dev/null ${HOME} | awk test test grep "$@" -eu 'quoted text'
+&& printf $(pwd) readonly grep
+-eu grep --verbose | then sed "$@" "$1"
+	$(pwd) local grep awk --verbose
+		&& x=1 "$@" ${HOME} printf && then echo readonly awk readonly
+2>/dev/null && $(pwd) --verbose ${HOME} ${HOME} | sed
+		/usr/bin echo | $(pwd) then
+	&& printf printf $(pwd) && then
+	--verbose 'quoted text' local
+	-eu printf | done done local
+x=1 x=1 sed | "$@" --verbose local --verbose echo ${HOME} 2>/dev/null
+-eu sed sed 2>/dev/null -eu 'quoted text' local
+x=1 "$@" sed local "$1" "$1" cd sed export
+		2>/dev/null readonly "$@" awk /usr/bin then $(pwd)
+2>/dev/null --verbose then /usr/bin local
+	"$1" local sed | done "$@" printf awk readonly cd -eu export x=1 "$1"
+		test "$@" x=1 cd sed 'quoted text'
+| grep local cd 2>/dev/null "$1" then | | ${HOME} cd then readonly && sed
+	x=1 sed test ${HOME} done export $(pwd) ${HOME} ${HOME} --verbose
+	--verbose 'quoted text' done printf local done
+	| ${HOME} --verbose --verbose readonly grep awk grep
+		printf x=1 test cd echo printf echo grep ${HOME} awk sed local awk x=1 readonly
+done ${HOME} /usr/bin printf 2>/dev/null
+		${HOME} "$@" && awk "$1" cd /usr/bin
+	"$1" | echo readonly $(pwd) export
+	grep "$@" "$1" sed test 'quoted text' 2>/dev/null
+2>/dev/null && echo $(pwd) $(pwd) /usr/bin grep awk $(pwd) test "$1" -eu
+		/usr/bin --verbose cd x=1 2>/dev/null
+	x=1 2>/dev/null awk grep grep done $(pwd) sed $(pwd) | --verbose local test cd
+		done then grep awk ${HOME} && | "$@" cd grep grep 2>/dev/null /usr/bin
+	sed awk echo grep ${HOME} /usr/bin "$1" test
+	'quoted text' --verbose printf /usr/bin awk readonly cd x=1 'quoted text'
+		printf ${HOME} $(pwd) sed awk done ${HOME} &&
+	$(pwd) 2>/dev/null -eu "$1" printf local "$1" echo --verbose cd printf
+		"$1" | printf readonly $(pwd)
+		grep && -eu --verbose export sed cd cd /usr/bin x=1 $(pwd) "$@"
+	"$@" printf awk awk done /usr/bin $(pwd) &&
+		-eu grep test done $(pwd) x=1 | 2>/dev/null
+&& sed ${HOME} awk export -eu $(pwd)
+printf sed grep readonly done /usr/bin printf printf "$1" done && /usr/bin &&
+		then x=1 && -eu 'quoted text'
+${HOME} grep sed then x=1 sed /usr/bin | done echo cd /usr/bin local 2>/dev/null
+	readonly sed "$@" $(pwd) 'quoted text' echo then "$1" readonly
+	test && --verbose /usr/bin
+		&& ${HOME} done 'quoted text' readonly then "$1" $(pwd)
+	${HOME} local "$@" test /usr/bin readonly "$@"
+readonly x=1 "$1" grep
+	echo grep /usr/bin "$1" printf export x=1 "$@" ${HOME} 2>/dev/null
+		test /usr/bin 2>/dev/null done done test "$1" then cd awk 'quoted text' cd "$@"
+then x=1 readonly cd /usr/bin awk /usr/bin grep $(pwd) --verbose $(pwd) | &&
+	awk done x=1 readonly 'quoted text'
+		echo then -eu sed printf 'quoted text' /usr/bin
+2>/dev/null echo grep "$1" --verbose then
+	$(pwd) printf 'quoted text' "$1" 'quoted text'
+		-eu $(pwd) cd | | "$1" "$1" awk export /usr/bin export "$1" "$@" local sed
+	"$1" readonly $(pwd) x=1 x=1 local then
+	done readonly local && $(pwd) /usr/bin done 2>/dev/null
+		printf readonly "$1" local done 2>/dev/null "$1" local cd ${HOME} readonly
+local -eu && "$@" /usr/bin readonly readonly export |
+		2>/dev/null then ${HOME} /usr/bin echo 'quoted text' /usr/bin
+		2>/dev/null x=1 local export 'quoted text' readonly
+"$@" x=1 test ${HOME} x=1 --verbose cd $(pwd)
+	test awk export --verbose echo grep readonly 2>/dev/null
+readonly awk sed awk "$1" $(pwd) awk test test
+"$@" 2>/dev/null export then --verbose x=1 "$@" -eu --verbose 'quoted text'
+	done -eu test $(pwd)
+| echo sed && awk then | local awk cd readonly x=1 | awk sed
+		test ${HOME} then "$1" sed echo printf cd then then -eu 'quoted text' x=1 readonly
+		sed /usr/bin 'quoted text' x=1 test "$1" x=1 test test readonly $(pwd)
+	${HOME} local export grep done sed "$1" | then readonly ${HOME}
+export then 2>/dev/null sed echo 2>/dev/null
+	x=1 "$1" x=1 -eu 2>/dev/null export awk awk -eu
+		sed $(pwd) --verbose "$1" sed && 2>/dev/null echo readonly then cd x=1 --verbose
+		/usr/bin test --verbose grep sed "$@" "$1" local sed
+"$1" local -eu done grep 2>/dev/null printf 2>/dev/null "$1" 2>/dev/null
+		&& -eu -eu "$@" "$1" test 2>/dev/null
+grep -eu x=1 && | then echo cd test 'quoted text'
+&& ${HOME} grep sed cd ${HOME} && /usr/bin readonly echo /usr/bin
+		2>/dev/null export $(pwd) awk cd /usr/bin sed 'quoted text' readonly /usr/bin
+		2>/dev/null "$@" $(pwd) "$1" grep sed sed "$@" test export /usr/bin
+	printf ${HOME} echo sed printf "$1" $(pwd) sed then && 'quoted text'
+		$(pwd) sed && && $(pwd) sed | && local echo
+"$1" echo $(pwd) test 'quoted text' export export 2>/dev/null
+	echo sed 'quoted text' --verbose test grep export
+	printf then "$@" test sed local readonly && 2>/dev/null | echo echo echo echo
+		| $(pwd) echo $(pwd) $(pwd) "$1" -eu x=1 local echo cd done readonly
+x=1 cd grep test then x=1 local local echo
+	"$@" echo -eu 'quoted text' | $(pwd) /usr/bin "$1" done
+printf then 2>/dev/null "$1" | x=1 export cd ${HOME}
+	printf "$1" -eu echo awk x=1 | -eu "$1" --verbose done "$@"
+		export export 'quoted text' && done awk cd $(pwd)
+	sed sed awk test -eu | export echo grep "$1"
+	-eu -eu awk --verbose 'quoted text'
+	readonly awk ${HOME} 'quoted text' x=1 $(pwd) /usr/bin
+		cd -eu test awk "$1" awk | | "$@" "$@"
+		--verbose 2>/dev/null ${HOME} awk grep then | readonly local echo -eu printf local
+		cd grep readonly --verbose readonly 'quoted text'
+	'quoted text' test ${HOME} 'quoted text' echo readonly $(pwd) awk /usr/bin awk
+		| awk grep 'quoted text' readonly grep
+'quoted text' echo x=1 then --verbose echo /usr/bin ${HOME} $(pwd) 'quoted text'
+--verbose -eu export "$1" echo sed then x=1 printf sed "$1" "$@" echo | "$1"
+	$(pwd) awk awk readonly 'quoted text' cd "$1" x=1 | 2>/dev/null
+test cd echo readonly "$1" $(pwd)
+	done -eu done | && --verbose awk echo awk cd test && export
+	${HOME} printf sed awk --verbose $(pwd)
+readonly cd export printf test then local printf cd ${HOME} --verbose
+		x=1 2>/dev/null echo grep 'quoted text' test sed
+done local && | readonly "$1"
+	-eu readonly $(pwd) 2>/dev/null readonly 2>/dev/null ${HOME} readonly sed
+	'quoted text' /usr/bin --verbose done
+| done "$1" -eu -eu | | "$1" && printf
+$(pwd) 2>/dev/null local printf echo -eu "$@"
+	then grep export echo local test
+$(pwd) | /usr/bin readonly test export 2>/dev/null local
+		-eu then then --verbose grep --verbose done && sed sed
+	export local grep cd 'quoted text'
+	cd export ${HOME} echo echo "$1"
+		2>/dev/null grep grep 2>/dev/null -eu && sed
+	-eu "$@" echo -eu | local echo test --verbose echo
+		| sed $(pwd) && readonly printf
+	done "$1" -eu ${HOME} cd echo printf -eu x=1 /usr/bin then awk
+		sed echo printf export
+		-eu grep "$@" "$@" readonly
+	/usr/bin test export awk local local then "$@" 'quoted text' && export
+	local && 'quoted text' then
+	then awk 2>/dev/null $(pwd) sed --verbose export
+		&& export 'quoted text' "$@" 2>/dev/null grep ${HOME} | test then then
+	test export "$@" test test sed grep test sed /usr/bin
+	awk sed done local echo && sed | && awk && ${HOME}
+		export awk /usr/bin "$@"
+'quoted text' export ${HOME} $(pwd) 2>/dev/null
+	--verbose readonly then local --verbose grep awk /usr/bin sed "$1" "$1" -eu done
+	'quoted text' $(pwd) $(pwd) cd then /usr/bin export "$1"
+		--verbose /usr/bin export readonly && --verbose 2>/dev/null sed | export |
+		export export printf done export
+		"$1" -eu grep export awk printf test --verbose
+		| readonly sed 'quoted text' 2>/dev/null
+/usr/bin ${HOME} done | $(pwd) awk 2>/dev/null
+	export printf && 2>/dev/null
+	${HOME} sed test | printf | "$1" test export test export
+	&& export printf done awk local 'quoted text' 2>/dev/null test sed
+	test test awk "$@" cd /usr/bin readonly $(pwd)
+		cd grep "$@" ${HOME} 2>/dev/null
+		grep 2>/dev/null 'quoted text' "$1"
+	--verbose -eu "$1" --verbose echo 2>/dev/null local ${HOME} /usr/bin x=1
+2>/dev/null -eu x=1 then
+		printf readonly test ${HOME} | grep grep /usr/bin /usr/bin echo
+	test test $(pwd) readonly sed printf
+		local && local test readonly -eu ${HOME} 2>/dev/null "$@" echo sed "$@" ${HOME}
+	"$@" then "$@" grep 2>/dev/null local awk awk test 'quoted text'
+	"$@" readonly local test awk
+		--verbose export then export done
+	x=1 cd echo sed then local awk then --verbose
+	local local readonly printf | "$@" -eu $(pwd) sed "$1" done
+	printf local "$1" local grep printf sed "$@" awk grep $(pwd) -eu && &&
+		cd done "$@" local export echo /usr/bin printf readonly echo x=1 local 2>/dev/null
+echo cd /usr/bin then "$1" grep ${HOME} | 2>/dev/null 2>/dev/null -eu then
+	cd ${HOME} | sed && test then sed local readonly 'quoted text' cd 2>/dev/null
+'quoted text' local ${HOME} local
+		awk | x=1 "$@" local echo
+	x=1 awk done x=1 "$@" printf local "$@" done "$@" echo local readonly
+printf "$@" && test grep "$1" $(pwd) | 2>/dev/null $(pwd) echo
+	&& then awk then /usr/bin export readonly -eu /usr/bin echo printf
+	awk grep done ${HOME} "$@" done 'quoted text' echo "$1" readonly
+done x=1 2>/dev/null 'quoted text' 2>/dev/null 2>/dev/null ${HOME}
+		readonly then | ${HOME} /usr/bin cd -eu "$1" echo | -eu cd --verbose && $(pwd)
+	x=1 "$@" "$@" /usr/bin export done awk awk grep done "$1" "$1" "$1" printf
+		| test $(pwd) && ${HOME} awk $(pwd) |
+	local echo awk "$@" readonly -eu --verbose cd --verbose 2>/dev/null "$1"
+	awk test "$@" done cd awk $(pwd) | "$1" local echo "$1" done done readonly sed
+		then local && echo cd readonly "$1" local awk local export
+2>/dev/null test ${HOME}
+test then "$1" "$@" "$1" grep printf /usr/bin 2>/dev/null /usr/bin | 2>/dev/null
+	&& x=1 2>/dev/null | /usr/bin "$@" grep awk -eu then local export
+		${HOME} $(pwd) 2>/dev/null && echo test 'quoted text' readonly then test
+		$(pwd) then -eu /usr/bin
+x=1 done done | -eu ${HOME} x=1 --verbose 'quoted text'
+	$(pwd) | local local local "$1" done grep $(pwd) --verbose printf x=1 grep then
+readonly 'quoted text' "$1" 'quoted text' export awk -eu cd && x=1 $(pwd) && "$1"
+done awk $(pwd) 'quoted text' $(pwd) --verbose then 'quoted text' echo /usr/bin
+sed "$1" test awk $(pwd) ${HOME} readonly sed
+"$1" "$1" awk done readonly echo /usr/bin cd awk ${HOME} echo export test sed 'quoted text'
+		cd then --verbose ${HOME} test
+echo ${HOME} | test ${HOME}
+echo | | --verbose then $(pwd) x=1 echo 2>/dev/null then local /usr/bin
+	then "$@" echo done && readonly test done
+		'quoted text' done ${HOME} echo done 'quoted text'
+local "$@" export $(pwd) done x=1 | ${HOME} 2>/dev/null
+then | done x=1 'quoted text' local cd 'quoted text'
+&& readonly 2>/dev/null local
+		export "$@" 'quoted text' -eu -eu 2>/dev/null local readonly awk echo
+	done export $(pwd) local test /usr/bin $(pwd)
+		awk local --verbose && awk 2>/dev/null
+		grep && ${HOME} awk done -eu then "$1" test x=1 -eu awk readonly --verbose 2>/dev/null
+	"$@" cd x=1 "$@" done x=1 grep 'quoted text' $(pwd)
+		"$@" test 2>/dev/null ${HOME} printf cd | "$1" sed | 'quoted text'
+		| | && done "$1" /usr/bin test ${HOME} 'quoted text'
+		${HOME} local 'quoted text' 'quoted text'
+/usr/bin ${HOME} "$@" then --verbose
+		echo | done printf echo x=1 $(pwd) 2>/dev/null cd grep
+readonly cd cd $(pwd) printf 'quoted text' "$1" then grep 2>/dev/null
+cd /usr/bin grep export test 'quoted text' echo cd "$@"
+	'quoted text' sed | --verbose awk /usr/bin echo && | $(pwd)
+grep /usr/bin export 2>/dev/null cd echo
+	test -eu --verbose then x=1 grep 2>/dev/null
+	2>/dev/null test done then printf then export readonly -eu
+	export $(pwd) then readonly
+		sed "$1" "$@" && && -eu awk --verbose readonly local && sed --verbose
+	cd --verbose && /usr/bin 2>/dev/null
+		'quoted text' then -eu ${HOME} --verbose /usr/bin printf
+	x=1 test sed x=1 test grep readonly export 2>/dev/null then ${HOME} sed printf
+"$1" "$1" $(pwd) /usr/bin /usr/bin
+	sed "$1" "$1" then done printf readonly && 'quoted text'
+		"$@" export && 'quoted text' grep | done ${HOME} awk "$1" 'quoted text'
+x=1 readonly /usr/bin && readonly /usr/bin
+"$1" done 'quoted text' printf readonly echo x=1 && "$@" 'quoted text' x=1
+	${HOME} 'quoted text' 'quoted text' $(pwd) x=1 | export local sed sed x=1 export
+		done "$@" && 2>/dev/null -eu 2>/dev/null ${HOME} cd "$1" && x=1 test local local
+done done "$@" ${HOME} 'quoted text' && sed 'quoted text'
+&& 2>/dev/null then 2>/dev/null grep local --verbose local sed local
+'quoted text' printf -eu "$1" "$@"
+then 2>/dev/null x=1 && printf 2>/dev/null /usr/bin $(pwd) test printf x=1
+	awk 2>/dev/null $(pwd) ${HOME}
+x=1 && "$1" grep x=1 export test echo then
+done 2>/dev/null awk ${HOME} then then | $(pwd) "$@" grep printf "$@"
+		done -eu then -eu printf then
+2>/dev/null printf | export awk printf 2>/dev/null "$@"
+	readonly "$1" -eu "$@" | 'quoted text' local
+		grep local "$@" && "$@" printf /usr/bin
+	sed readonly echo readonly && cd test | grep readonly local
+		test 'quoted text' "$1" ${HOME}
+		readonly awk readonly printf sed
+		sed printf grep 'quoted text' grep -eu --verbose "$1" awk cd local
+x=1 sed "$@" "$1" export "$1" /usr/bin test sed "$@" 'quoted text' $(pwd) "$@"
+	readonly $(pwd) echo "$1" $(pwd) echo /usr/bin then
+cd grep echo local ${HOME} | 2>/dev/null && test "$1" "$@"
+	/usr/bin 'quoted text' cd "$1"
+	cd then --verbose grep cd /usr/bin readonly then /usr/bin /usr/bin
+	"$1" then test $(pwd) |
+		export /usr/bin | "$1" printf -eu local printf
+		$(pwd) test 2>/dev/null cd 2>/dev/null -eu export x=1
+		awk export --verbose done && -eu echo "$1" readonly cd readonly 2>/dev/null export
+-eu --verbose grep /usr/bin echo test 2>/dev/null 'quoted text'
+		x=1 done printf grep export sed | grep | 2>/dev/null 'quoted text'
+		export x=1 'quoted text' "$1" export echo "$@" echo awk "$@" grep ${HOME} $(pwd)
+local $(pwd) printf x=1 then then test done cd cd x=1 cd 'quoted text'
+		2>/dev/null printf 2>/dev/null export export
+		"$@" readonly $(pwd) ${HOME} grep
+sed readonly x=1 x=1 2>/dev/null -eu
+	printf readonly /usr/bin sed
+'quoted text' cd export ${HOME} ${HOME} -eu done awk local test readonly
+printf 2>/dev/null done --verbose then export 2>/dev/null
+	"$@" && grep /usr/bin cd echo echo
+readonly printf $(pwd) awk "$1" grep readonly sed 2>/dev/null ${HOME}
+		-eu test echo $(pwd) readonly --verbose
+		local -eu "$1" "$1" sed ${HOME}
+	echo cd export $(pwd) done
+		x=1 --verbose /usr/bin 'quoted text' export | && && awk 'quoted text'
+		2>/dev/null | done awk 'quoted text' -eu export export test
+	$(pwd) awk 'quoted text' /usr/bin && $(pwd) sed export local "$1" export
+	cd test $(pwd) x=1 local cd x=1 export
+&& sed done 'quoted text'
+	test done then --verbose readonly awk "$@" $(pwd) "$@" $(pwd)
+		"$@" && ${HOME} 'quoted text' x=1 2>/dev/null printf echo then then
+sed 2>/dev/null $(pwd) printf then test 2>/dev/null cd awk awk 'quoted text'
+grep done "$@" "$1" && cd done x=1 done awk awk "$1" "$1" "$@" grep /usr/bin
+		echo $(pwd) readonly local local awk | test
+	${HOME} "$1" then readonly test && sed |
+		"$@" --verbose echo sed echo awk then cd printf echo
+printf ${HOME} x=1 | test "$1" readonly printf cd local -eu /usr/bin | awk "$1"
+	test done ${HOME} | sed /usr/bin cd ${HOME}
+/usr/bin && done then grep awk printf grep $(pwd) "$@" test 2>/dev/null
+		readonly test test "$@" export local printf 2>/dev/null
+		grep sed readonly --verbose
+/usr/bin test local | $(pwd) 'quoted text'
+	awk then 'quoted text' | then echo && export export && echo cd ${HOME}
+readonly $(pwd) export export x=1 printf echo local cd ${HOME}
+"$1" "$1" 'quoted text' export 2>/dev/null $(pwd)
+	sed cd 2>/dev/null then test awk cd "$1"
+/usr/bin --verbose printf ${HOME} -eu export done echo then grep --verbose
+	"$1" "$1" then readonly -eu export "$1" "$@" local --verbose printf
+	'quoted text' $(pwd) "$1" printf 2>/dev/null /usr/bin echo --verbose
+	export export | local x=1 sed ${HOME} test $(pwd) && then
+	printf | "$@" done then sed | sed x=1 | | $(pwd) sed
+printf && done grep local printf grep
+	test grep 'quoted text' $(pwd)
+	| done then && "$@" 2>/dev/null /usr/bin awk local -eu
+	${HOME} awk readonly $(pwd) "$1" then
+	"$@" printf /usr/bin "$1" printf readonly
+then echo test awk cd ${HOME} 'quoted text'
+		awk -eu local "$@" sed then 'quoted text' -eu /usr/bin "$@" readonly
+		then x=1 x=1 awk test --verbose ${HOME}
+		"$1" done 'quoted text' 'quoted text' x=1 local "$1" ${HOME}
+echo $(pwd) "$1" x=1 echo awk awk readonly
+	| grep local ${HOME} printf readonly
+then && ${HOME} /usr/bin printf --verbose cd awk printf readonly
+		then test export grep readonly 2>/dev/null --verbose "$1" done awk cd --verbose
+	awk --verbose "$1" grep awk && $(pwd) | local
+| x=1 then printf ${HOME} awk /usr/bin
+	done ${HOME} && printf "$1"
+	-eu x=1 export export "$1"
+	echo readonly done export $(pwd)
+	echo /usr/bin done sed readonly local then then local "$@" "$1" export
+		then --verbose sed | "$@" && && -eu readonly sed
+${HOME} -eu "$@" -eu /usr/bin echo export
+		'quoted text' -eu 'quoted text' x=1 "$@" x=1 "$@" readonly
+		done $(pwd) ${HOME} grep export cd then "$@" 'quoted text' "$1"
+	${HOME} test grep | printf $(pwd) cd && echo && echo
+		| x=1 export "$@" awk x=1 $(pwd) ${HOME} echo "$1" "$1"
+	awk export "$1" --verbose cd
+	printf && | cd -eu -eu awk
+	echo 'quoted text' readonly | $(pwd) "$@" x=1 $(pwd) sed done awk
+	test local "$1" -eu sed
+"$@" readonly export && grep awk -eu test test 'quoted text' /usr/bin ${HOME} "$1"
+		readonly export sed echo printf --verbose
+echo "$1" grep done cd "$@" 'quoted text' sed --verbose export /usr/bin
+		done grep readonly readonly cd cd
+	then x=1 $(pwd) $(pwd) echo "$1" x=1 && printf && 2>/dev/null export -eu
+"$1" "$1" sed then -eu | && done readonly cd awk done -eu --verbose sed --verbose
+	$(pwd) test && -eu /usr/bin
+		sed printf /usr/bin awk --verbose && awk 2>/dev/null cd local "$1" local
+	done "$@" | echo ${HOME}
+	$(pwd) grep 2>/dev/null test grep grep $(pwd) then
+/usr/bin | then --verbose done test cd
+	printf /usr/bin printf -eu export then "$1" then x=1 -eu echo readonly "$@"
+	/usr/bin ${HOME} readonly --verbose export x=1 echo
+		/usr/bin echo echo then | -eu test awk 'quoted text'
+	then $(pwd) readonly
+	then awk | awk "$1" "$@" test ${HOME}
+&& then grep cd x=1 echo x=1 'quoted text' $(pwd) local 2>/dev/null cd test
+		"$1" cd /usr/bin sed x=1 $(pwd) && /usr/bin export | --verbose --verbose
+	'quoted text' test done sed -eu done /usr/bin
+	done awk printf readonly export sed sed x=1 -eu local awk cd grep
+		done printf ${HOME} 'quoted text'
+		&& awk grep readonly 'quoted text' export "$@" 'quoted text' && export /usr/bin
+	x=1 2>/dev/null ${HOME} printf -eu export --verbose readonly --verbose ${HOME}
+	--verbose ${HOME} then readonly done local local cd ${HOME}
+	2>/dev/null /usr/bin done /usr/bin -eu local test --verbose $(pwd) done
+cd $(pwd) x=1 test test | "$1" grep 'quoted text' printf sed
+x=1 2>/dev/null 2>/dev/null cd export | echo ${HOME} "$@" cd awk
+		--verbose 'quoted text' "$@" ${HOME} grep export
+	sed 'quoted text' --verbose x=1 /usr/bin | local local
+		test x=1 then grep test
+awk "$1" sed echo && ${HOME} ${HOME} "$1" test then export x=1 awk
+$(pwd) /usr/bin | 2>/dev/null then
+test test "$@" printf 2>/dev/null printf grep printf /usr/bin export printf
+	cd then x=1 'quoted text' done && cd done local done $(pwd) local "$@" export
+${HOME} x=1 'quoted text' test done sed printf 'quoted text'
+	awk "$@" local --verbose test "$1" | printf then && export
+	'quoted text' test local "$@" echo cd export sed local 'quoted text'
+		&& echo grep test echo
+$(pwd) done --verbose local x=1 readonly local
+		done ${HOME} readonly ${HOME} --verbose
+		done printf | sed then export grep 'quoted text'
+		cd | $(pwd) "$1" awk test export "$@" 'quoted text'
+	local x=1 -eu "$1" /usr/bin "$1" $(pwd) printf printf -eu test $(pwd) sed sed
+--verbose /usr/bin ${HOME} $(pwd) 2>/dev/null export
+	then printf | test readonly
+done readonly then test then $(pwd)
+	2>/dev/null | 2>/dev/null /usr/bin "$@" x=1 && local echo echo && grep export -eu
+	then x=1 -eu then echo "$1" -eu 2>/dev/null | 2>/dev/null
+'quoted text' test printf then x=1 awk $(pwd) x=1
+	x=1 echo done $(pwd) echo x=1 grep --verbose
+	/usr/bin --verbose 2>/dev/null grep --verbose readonly
+		2>/dev/null done cd "$@" $(pwd) | /usr/bin awk done readonly
+		grep $(pwd) /usr/bin cd
+local cd ${HOME} 'quoted text' "$@" export "$1" done grep done $(pwd)
+	$(pwd) 'quoted text' printf x=1 export echo | -eu export
+echo 2>/dev/null printf 'quoted text' "$@" test then sed | test
+printf sed cd 'quoted text' $(pwd) echo 2>/dev/null "$1" printf 2>/dev/null ${HOME}
+	/usr/bin ${HOME} --verbose
+		then echo sed cd printf 'quoted text' 2>/dev/null 'quoted text'
+sed "$1" awk cd "$1" 'quoted text' export
+${HOME} -eu -eu 'quoted text' sed then ${HOME} export
+	--verbose readonly export "$@" local "$1" cd awk 'quoted text'
+"$@" grep $(pwd) cd test "$@" | | test x=1 ${HOME}
+	"$@" "$1" && then grep 2>/dev/null 2>/dev/null | $(pwd) local
+	'quoted text' 2>/dev/null "$@" 'quoted text'
+		"$@" ${HOME} 'quoted text' printf x=1 echo echo echo
+	-eu test | then sed --verbose /usr/bin $(pwd) readonly then
+		'quoted text' readonly /usr/bin
+	then "$@" cd | echo sed export test echo -eu --verbose /usr/bin
+	export 'quoted text' readonly "$1" x=1
+		test done then echo "$@" grep 'quoted text' && printf -eu printf "$1" echo
+	sed "$@" export cd 2>/dev/null grep ${HOME}
+		-eu "$1" export readonly export awk cd done /usr/bin
+		done grep sed x=1 ${HOME} ${HOME}
+echo --verbose grep -eu --verbose sed 2>/dev/null "$1" "$@" -eu
+sed x=1 $(pwd) cd grep x=1 2>/dev/null
+		local --verbose 2>/dev/null
+/usr/bin readonly | echo --verbose
+		| sed -eu then local printf
+		"$1" -eu ${HOME} x=1 &&
+		sed 2>/dev/null /usr/bin readonly
+		done 'quoted text' awk grep grep "$1" done 'quoted text' | "$1" readonly
+	&& readonly x=1 2>/dev/null 'quoted text' readonly
+		readonly && echo local echo done "$@" 2>/dev/null printf
+/usr/bin then test x=1 "$1"
+		--verbose sed x=1 readonly $(pwd) export done printf export
+"$@" export printf && $(pwd) done local $(pwd)
+	--verbose --verbose done "$@" readonly done local sed cd cd x=1 --verbose ${HOME}
+local /usr/bin echo done test sed /usr/bin
+/usr/bin 2>/dev/null readonly cd test
+cd echo $(pwd) readonly ${HOME} --verbose done printf
+	$(pwd) --verbose "$1" 2>/dev/null export printf grep sed
+	"$1" "$@" | x=1 printf x=1 /usr/bin cd awk cd cd -eu --verbose export echo cd
+	'quoted text' --verbose sed echo awk /usr/bin ${HOME}
+	export -eu echo cd 'quoted text'
+x=1 sed && "$1" export echo "$@" "$1"
+		done -eu printf -eu printf readonly done 'quoted text' done
+	then local grep -eu then local cd /usr/bin ${HOME} done x=1 local &&
+		| awk --verbose echo awk && $(pwd) cd /usr/bin grep $(pwd) local ${HOME}
+then 2>/dev/null "$@" cd sed
+		local readonly "$@" awk cd export "$@" "$1" readonly printf "$1" ${HOME}
+		readonly test sed "$1" cd | -eu 2>/dev/null printf cd cd $(pwd) "$1"
+"$@" /usr/bin sed sed grep
+		'quoted text' x=1 "$1" 'quoted text'
+	local local x=1 | -eu test export $(pwd) echo cd local then "$@"
+	2>/dev/null then -eu sed export echo $(pwd)
+echo $(pwd) ${HOME} /usr/bin ${HOME} export
+--verbose --verbose printf ${HOME}
+grep && --verbose awk ${HOME} echo sed "$@" 'quoted text'
+	awk then test echo | test ${HOME} && awk grep
+&& /usr/bin echo && ${HOME} 'quoted text' sed
+		awk readonly x=1 awk echo | echo test grep --verbose
+	printf sed printf sed $(pwd) done grep grep
+		grep $(pwd) readonly "$@" -eu cd cd --verbose export printf
+		awk printf 'quoted text' -eu && awk -eu | | 2>/dev/null |
+done printf then sed printf cd "$@" done echo local echo
+		awk done $(pwd) x=1 x=1 echo echo -eu done "$@" then ${HOME} "$@" readonly
+		&& printf readonly -eu 2>/dev/null awk
+export x=1 $(pwd) "$1" /usr/bin readonly printf cd done "$1" "$1" $(pwd) 'quoted text'
+	"$@" x=1 x=1 test --verbose printf x=1 /usr/bin test 2>/dev/null x=1
+	test local sed cd done done awk cd "$@" "$@" cd done echo | sed "$@" &&
+/usr/bin grep 2>/dev/null echo --verbose x=1 | done cd grep done then ${HOME}
+	2>/dev/null && /usr/bin x=1 2>/dev/null 'quoted text'
+done local then && then grep 'quoted text' ${HOME} echo 'quoted text'
+		then x=1 cd awk "$1" cd &&
+		| | $(pwd) grep then $(pwd) | echo 'quoted text' 'quoted text' "$@" /usr/bin
+		| | printf awk readonly echo $(pwd) grep /usr/bin -eu "$1" sed test printf
+&& 2>/dev/null ${HOME} ${HOME} 2>/dev/null then local export sed &&
+	| readonly local ${HOME} -eu | -eu readonly cd grep 2>/dev/null local local printf
+readonly ${HOME} x=1 "$@" && $(pwd)
+	done grep printf "$1" sed echo | then
+		"$1" echo "$1" export then echo "$1" echo --verbose then | && export
+		2>/dev/null -eu 'quoted text'
+		$(pwd) /usr/bin -eu cd 2>/dev/null "$@" /usr/bin done printf "$1" cd --verbose
+		local "$1" awk ${HOME} then echo cd sed 'quoted text'
+	'quoted text' 2>/dev/null done local | done readonly grep 2>/dev/null
+		--verbose grep | grep ${HOME} -eu then
+2>/dev/null readonly done ${HOME} sed "$@" /usr/bin then && echo "$1" awk
+$(pwd) local "$@" grep -eu done echo
+		--verbose 2>/dev/null "$1" ${HOME} -eu export -eu
+		'quoted text' sed --verbose then printf export printf --verbose "$@" 2>/dev/null
+"$1" done printf cd 2>/dev/null awk ${HOME} then printf "$@" /usr/bin $(pwd)
+		readonly sed /usr/bin then && done awk
+2>/dev/null grep readonly 2>/dev/null && && export && readonly
+		grep cd $(pwd) readonly $(pwd) local echo then then echo cd readonly
+	x=1 echo test then then | local printf x=1 then /usr/bin then x=1 test --verbose
+	done echo 'quoted text' local -eu awk
+echo && "$1" then --verbose awk $(pwd) cd | cd /usr/bin test echo sed -eu
+		/usr/bin 2>/dev/null then local
+		&& x=1 -eu done ${HOME} export test export 2>/dev/null
+		-eu echo --verbose sed cd --verbose -eu test echo export x=1 |
+		-eu sed && then echo $(pwd) echo printf 2>/dev/null --verbose export
+	2>/dev/null -eu awk $(pwd)
+		readonly x=1 "$@" 2>/dev/null 'quoted text' 2>/dev/null "$1"
+printf printf -eu x=1 &&
+		sed test readonly --verbose x=1 printf sed /usr/bin cd 2>/dev/null x=1 -eu
+	done x=1 then "$@" echo local
+x=1 done then sed sed awk awk "$1" printf x=1
+		-eu done --verbose awk grep 'quoted text' test
+local x=1 x=1 -eu done "$@" grep grep sed "$@" 'quoted text'
+		"$@" done awk "$@" 2>/dev/null --verbose | test readonly cd x=1 | 'quoted text'
+		| | printf readonly /usr/bin /usr/bin $(pwd) && "$1" then
+		"$@" sed "$@" echo awk --verbose export test 'quoted text' export
+readonly done printf "$@" then
+2>/dev/null test export test test | $(pwd)
+'quoted text' --verbose
+export && ${HOME} grep readonly export -eu cd -eu /usr/bin then
+		export local $(pwd) printf echo echo echo grep sed then x=1 awk
+	'quoted text' awk -eu $(pwd)
+$(pwd) "$@" printf test 'quoted text' then | --verbose
+		x=1 'quoted text' local "$@"
+	"$@" local | printf $(pwd)
+	2>/dev/null readonly $(pwd) grep | local | /usr/bin x=1
+&& | awk && awk then grep test sed && 'quoted text' awk
+$(pwd) x=1 awk done x=1
+then readonly | 'quoted text' echo
+		-eu $(pwd) 'quoted text' "$@" cd && $(pwd) grep "$@" 2>/dev/null && --verbose
+	readonly x=1 $(pwd) awk x=1 echo sed ${HOME} cd then then cd cd done
+	--verbose grep | printf echo && then echo sed printf
+		$(pwd) x=1 awk --verbose && printf cd readonly --verbose
+	/usr/bin | /usr/bin export echo
+	-eu 'quoted text' awk done ${HOME} local test
+	$(pwd) | awk 'quoted text'
+		$(pwd) grep "$@" | && x=1 --verbose
+/usr/bin grep sed $(pwd) done -eu --verbose local
+	${HOME} --verbose export sed
+		$(pwd) x=1 sed done "$@" printf cd grep "$1" echo && local test then readonly
+done echo grep --verbose test then local --verbose
+		2>/dev/null "$@" echo "$1" $(pwd) sed | --verbose export export
+	'quoted text' export then cd 2>/dev/null
+	echo | | 'quoted text' 2>/dev/null "$1"
+		&& x=1 sed sed 'quoted text' | "$1" 2>/dev/null grep
+	cd then -eu 'quoted text' readonly "$@" export
+		| | | sed /usr/bin /usr/bin "$1" sed && then local readonly $(pwd) readonly
+x=1 sed done | $(pwd) then 2>/dev/null && local done $(pwd) | --verbose done $(pwd)
+	${HOME} awk && /usr/bin x=1 local
+#include c128.sh
+		"$@" $(pwd) awk x=1 done && then |
+export awk sed x=1 x=1 | && export "$@" "$1" --verbose test test 'quoted text'
+		sed /usr/bin then -eu /usr/bin
+	"$@" then ${HOME} sed echo local readonly readonly readonly --verbose
+		awk then local then -eu "$1" local 2>/dev/null
+		&& export test && && $(pwd) sed echo /usr/bin then sed "$@" ${HOME}
+	"$1" /usr/bin ${HOME} "$1" export awk -eu 2>/dev/null echo | x=1 export test echo
+		cd cd test $(pwd) test export
+'quoted text' cd --verbose grep cd 'quoted text' $(pwd)
+readonly done done "$1" $(pwd) local local grep --verbose
+	&& "$1" /usr/bin local awk "$1" done 'quoted text' --verbose readonly -eu grep "$@"
+	&& cd | then cd then sed echo grep -eu awk grep --verbose 'quoted text'
+		'quoted text' local test && "$@" --verbose --verbose
+	export --verbose "$1" 'quoted text' grep export
+		--verbose 2>/dev/null | local |
+	local && /usr/bin 'quoted text' ${HOME} | then | 'quoted text' x=1 export "$1"
+| export export x=1 printf export 'quoted text' 2>/dev/null
+then 'quoted text' grep readonly "$@" | local test cd
+&& done && /usr/bin echo $(pwd)
+-eu export "$1" && test awk readonly local $(pwd) cd "$1" done printf
+grep ${HOME} then echo sed --verbose 'quoted text'
+readonly && -eu echo cd /usr/bin 2>/dev/null export -eu 2>/dev/null grep cd sed
+		grep && x=1 ${HOME} ${HOME}
+		$(pwd) --verbose local test | $(pwd) --verbose cd awk
+	sed printf x=1 grep export "$@" readonly
+	| "$@" grep ${HOME} grep
+cd ${HOME} then echo echo /usr/bin 'quoted text' 'quoted text' readonly
+2>/dev/null "$1" ${HOME} local export "$@" awk "$@" printf grep
+-eu local grep local 'quoted text' x=1 ${HOME} export |
+	sed then done 'quoted text' ${HOME}
+		then "$@" done "$@" -eu 'quoted text' x=1 | awk echo readonly printf
+		"$1" | then cd awk --verbose printf
+-eu then 'quoted text' x=1 'quoted text'
+	awk test awk readonly -eu ${HOME} then
+		-eu | "$1" x=1 echo 2>/dev/null "$1" $(pwd) done done "$@" sed
+		${HOME} 2>/dev/null sed local ${HOME}
+		readonly "$1" -eu test 'quoted text'
+		/usr/bin echo -eu done -eu && local --verbose && cd "$@" done /usr/bin test
+	${HOME} cd cd printf done 'quoted text' /usr/bin x=1 x=1 2>/dev/null
+	'quoted text' export 2>/dev/null x=1 "$1"
+		test export && ${HOME} echo awk "$1" ${HOME} ${HOME} --verbose ${HOME} 'quoted text'
+		test --verbose echo --verbose "$@" sed | cd readonly
+	"$1" | then /usr/bin $(pwd) local
+&& then cd export then awk export 2>/dev/null | echo 'quoted text' /usr/bin readonly
+		local 2>/dev/null --verbose -eu 'quoted text'
+done awk | local echo test x=1 local test local export
+&& x=1 "$1" && sed 'quoted text' sed local printf
+		cd 'quoted text' "$1" printf
+		$(pwd) local "$@" done 'quoted text' "$@" -eu /usr/bin --verbose
+	grep cd readonly ${HOME} "$@" "$1" readonly then sed "$1" && 2>/dev/null
+${HOME} /usr/bin "$@" && local && export test /usr/bin 'quoted text'
+	readonly | x=1 'quoted text' 2>/dev/null local /usr/bin $(pwd)
+grep --verbose | grep done
+		$(pwd) awk awk x=1 sed test
+then then test printf echo grep -eu echo test
+	&& --verbose | /usr/bin awk echo
+grep export $(pwd) then test ${HOME} $(pwd) cd --verbose "$@" printf export
+		x=1 'quoted text' awk | then cd 2>/dev/null
+	-eu $(pwd) 'quoted text'
+		cd | then 2>/dev/null then "$@" 2>/dev/null
+		readonly cd test export ${HOME} "$1" &&
+	sed local ${HOME} 2>/dev/null test grep echo
+awk readonly "$1" --verbose
+-eu printf readonly grep 'quoted text'
+	${HOME} --verbose "$1" && readonly -eu -eu | "$1" export $(pwd) --verbose
+		--verbose export export done awk "$@" readonly /usr/bin awk echo printf
+		| cd x=1 readonly printf awk 'quoted text'
+		echo awk $(pwd) x=1 --verbose test 'quoted text' sed
+		test ${HOME} local --verbose export readonly echo /usr/bin test local $(pwd)
+-eu /usr/bin /usr/bin test "$@"
+sed test done cd done
+&& "$1" x=1 --verbose printf ${HOME} export then && |
+done cd /usr/bin export -eu awk ${HOME} export -eu export printf x=1 grep
+export $(pwd) local 'quoted text' --verbose
+		&& --verbose "$1" readonly ${HOME} then "$1" echo $(pwd)
+		cd "$1" export "$@" | awk export 2>/dev/null
+		awk x=1 test awk x=1 --verbose echo && "$@" local awk grep export cd local
+	echo readonly echo done readonly printf done cd --verbose then awk x=1 "$1" $(pwd)
+		x=1 "$@" /usr/bin "$1" done /usr/bin done
+echo 'quoted text' && then
+		readonly 'quoted text' done readonly test
+echo --verbose export /usr/bin -eu /usr/bin ${HOME} done local 'quoted text' 'quoted text'
+		--verbose test $(pwd) 'quoted text'
+	readonly readonly x=1 "$1" ${HOME} "$@" grep
+		/usr/bin ${HOME} sed local export 2>/dev/null test --verbose
+		export x=1 printf /usr/bin cd cd
+	echo export "$@" sed "$@" echo 'quoted text'
+		readonly 2>/dev/null awk test cd awk echo echo 'quoted text'
+	${HOME} | echo && echo cd export then x=1 "$1" &&
+cd grep export done /usr/bin awk grep 2>/dev/null
+grep done grep 'quoted text' echo done cd /usr/bin readonly awk ${HOME}
+2>/dev/null | local $(pwd) grep --verbose ${HOME} then grep readonly
+		${HOME} $(pwd) 'quoted text' printf x=1 readonly "$1" sed
+		cd 2>/dev/null awk -eu $(pwd) --verbose test done x=1 x=1 done sed printf then export
+cd "$@" "$@" x=1 --verbose awk printf sed $(pwd) "$@" cd "$1" readonly cd awk
+		| export $(pwd) test | ${HOME} done cd sed grep "$@"
+export x=1 ${HOME} done 'quoted text' then -eu -eu cd grep ${HOME} "$@" then
+		| awk awk x=1 readonly readonly sed "$1" readonly readonly "$@" printf /usr/bin
+cd --verbose "$1" "$@"
+		then readonly x=1 test "$1" x=1 awk
+		| | sed sed done | echo echo
+		x=1 done "$@" local readonly done export test cd 2>/dev/null "$@" cd "$@" --verbose
+		done awk awk awk awk readonly x=1 "$1" done
+	--verbose | $(pwd) awk readonly $(pwd) "$@" export 2>/dev/null echo --verbose
+printf "$1" local then | "$1" ${HOME} grep cd && printf cd $(pwd) export
+readonly done && && then
+	"$1" cd x=1 --verbose "$1" && && grep printf x=1 grep 'quoted text'
+	&& cd local then echo export cd "$1" awk sed sed ${HOME} export
+		${HOME} $(pwd) 'quoted text' printf && done export /usr/bin sed done
+	| ${HOME} ${HOME} -eu test 2>/dev/null readonly
+-eu cd x=1 awk cd -eu
+	test "$1" printf -eu x=1 readonly
+		$(pwd) done grep "$@" then printf -eu cd "$1"
+readonly local x=1 x=1 $(pwd) readonly
+'quoted text' export printf "$1" awk | printf cd -eu
+x=1 printf grep /usr/bin /usr/bin
+		test $(pwd) printf local ${HOME} "$@" echo done export --verbose
+echo 2>/dev/null $(pwd) && test 2>/dev/null sed 'quoted text' | ${HOME}
+	--verbose 'quoted text' x=1 grep local test done
+		test grep --verbose ${HOME} "$1" && $(pwd)
+sed $(pwd) 2>/dev/null awk echo readonly export
+&& 2>/dev/null "$@" && -eu x=1 then printf 2>/dev/null
+		--verbose $(pwd) ${HOME} cd -eu test then
+		/usr/bin | "$1" printf sed cd && echo x=1 $(pwd) $(pwd) local $(pwd)
+x=1 x=1 then ${HOME} | | /usr/bin export done -eu "$@" grep local
+	awk test -eu printf sed | done x=1 $(pwd) readonly sed done && export
+	cd 'quoted text' sed sed "$1" test "$1" ${HOME} done $(pwd) |
+	readonly $(pwd) /usr/bin cd 'quoted text' readonly cd echo
+		grep echo local | | grep && && --verbose ${HOME} "$@" sed export printf
+awk echo $(pwd) then sed | | awk ${HOME} cd echo done readonly
+"$1" x=1 $(pwd) done
+		"$@" 2>/dev/null 2>/dev/null ${HOME} printf test test $(pwd)
+	then 'quoted text' | then x=1 grep 'quoted text' awk local
+		$(pwd) done cd -eu grep then --verbose
+	--verbose export 2>/dev/null /usr/bin test printf test done
+		$(pwd) export test awk 'quoted text'
+		2>/dev/null x=1 printf export | echo "$@" grep grep
+	local cd 'quoted text' "$1" sed awk printf
+		printf done | | 2>/dev/null ${HOME} local && printf echo 2>/dev/null printf test
+	&& | cd printf test /usr/bin --verbose
+	${HOME} done readonly readonly printf export -eu "$1" awk --verbose grep
+		'quoted text' | $(pwd) ${HOME} grep readonly export local --verbose
+echo grep --verbose ${HOME} readonly ${HOME}
+| x=1 local 'quoted text' | && export --verbose done 2>/dev/null
+test && | x=1 | 2>/dev/null then local $(pwd) --verbose
+	&& "$1" local done readonly && sed --verbose
+echo --verbose local -eu
+		awk local $(pwd) then $(pwd) test test local awk $(pwd) cd done export ${HOME}
+		"$1" 2>/dev/null $(pwd) x=1
+	x=1 done export 'quoted text' sed 'quoted text' done cd local local
+"$1" x=1 echo "$@" test "$@" grep -eu printf test
+"$@" ${HOME} done | grep 2>/dev/null x=1 2>/dev/null --verbose ${HOME}
+	local 'quoted text' export awk
+grep "$@" grep printf | $(pwd) 'quoted text' local awk export "$@" sed cd ${HOME}
+	| 'quoted text' -eu cd sed sed done ${HOME} 2>/dev/null $(pwd)
+	grep --verbose echo && --verbose readonly done 2>/dev/null
+export echo sed readonly && 2>/dev/null export
+		/usr/bin readonly done local done
+	&& readonly x=1 $(pwd) awk echo then x=1 $(pwd) test readonly test 2>/dev/null
+		-eu "$@" cd $(pwd) sed printf $(pwd) printf
+done | "$@" done awk -eu -eu -eu echo x=1 echo x=1 sed sed "$1"
+-eu test && test local test
+	"$@" awk export -eu sed then awk echo 'quoted text' 'quoted text' export 'quoted text'
+		x=1 ${HOME} "$@" | readonly then
+	/usr/bin ${HOME} --verbose $(pwd) "$@" grep -eu awk awk x=1 | awk ${HOME}
+		x=1 local 'quoted text' 2>/dev/null grep -eu x=1 ${HOME} ${HOME} | sed "$@"
+		done export 2>/dev/null then $(pwd) "$1" "$@" --verbose export /usr/bin "$@"
+		local local | awk 2>/dev/null 'quoted text'
+	test readonly 2>/dev/null grep | --verbose "$@" done cd done awk sed printf 'quoted text'
+	test done local /usr/bin awk $(pwd) readonly 'quoted text' printf 'quoted text'
+	--verbose | ${HOME} ${HOME} awk awk readonly readonly "$1" cd "$1" sed printf -eu
+	then x=1 local 'quoted text' --verbose cd
+	&& -eu awk printf -eu sed test local 'quoted text' "$1" grep ${HOME}
+		export "$1" readonly $(pwd) -eu --verbose --verbose -eu 2>/dev/null
+	then test done $(pwd) local 2>/dev/null /usr/bin
+| 'quoted text' local 2>/dev/null then
+		cd echo awk export $(pwd) 'quoted text'
+"$@" /usr/bin then then 'quoted text' done grep awk 'quoted text'
+	-eu awk $(pwd) then -eu "$@" done echo $(pwd) 2>/dev/null
+	sed local echo export readonly then --verbose &&
+2>/dev/null echo "$1" -eu
+	x=1 ${HOME} "$1" printf /usr/bin done --verbose
+		local cd grep echo readonly ${HOME} /usr/bin | echo
+	-eu "$1" then readonly && "$@" ${HOME} | grep $(pwd) ${HOME} ${HOME}
+printf && export x=1 "$@" echo then && $(pwd) "$@" x=1 printf
+		x=1 'quoted text' export local awk && printf
+| export && "$@" 'quoted text'
+		| awk export $(pwd) "$@"
+export then test done done "$@" export 'quoted text' 'quoted text'
+	--verbose "$@" "$@" ${HOME} test "$@" $(pwd) printf
+		| ${HOME} awk $(pwd) $(pwd) then /usr/bin && grep 'quoted text'
+	"$@" test grep local 2>/dev/null 'quoted text' then --verbose done done
+		$(pwd) export awk local printf then "$1"
+		grep -eu "$@" && done local readonly then 'quoted text' export
+		sed cd done readonly "$@" done | $(pwd) /usr/bin x=1 done | 'quoted text'
+		local 'quoted text' export --verbose grep local /usr/bin -eu "$1" "$@"
+	cd readonly -eu --verbose /usr/bin
+	cd 2>/dev/null | cd grep $(pwd) | "$1" test /usr/bin "$@" ${HOME}
+$(pwd) local && export then $(pwd) export
+cd --verbose && cd --verbose awk "$@" echo readonly cd ${HOME} x=1
+		export -eu grep grep done "$@"
+		'quoted text' then awk then
+		test /usr/bin local | "$@" --verbose
+		"$1" echo sed then echo 2>/dev/null
+	-eu local grep $(pwd) | done 2>/dev/null
+"$1" then && cd readonly -eu --verbose test export local
+		$(pwd) /usr/bin 'quoted text' grep "$1" then 2>/dev/null 'quoted text'
+| done 'quoted text' 'quoted text' ${HOME}
+"$@" grep ${HOME} "$1" printf
+	--verbose grep && done 2>/dev/null "$@" /usr/bin test && -eu
+--verbose /usr/bin | local grep 2>/dev/null
+	"$@" done export x=1 $(pwd) readonly
+/usr/bin done /usr/bin then "$@" echo x=1
+		"$@" printf grep done | -eu --verbose ${HOME} "$@" "$@"
+-eu sed test && then done local printf
+'quoted text' then awk done 'quoted text' grep
+export then x=1 x=1 readonly $(pwd) echo ${HOME}
+		sed printf "$@" then -eu test export --verbose /usr/bin echo /usr/bin printf
+test local "$@" x=1 "$1" then && $(pwd) | then /usr/bin local $(pwd)
+		/usr/bin echo test && ${HOME} -eu |
+	echo local awk printf awk readonly --verbose test printf 'quoted text' /usr/bin
+	grep done then readonly "$@" --verbose 2>/dev/null then printf x=1 printf 2>/dev/null
+'quoted text' ${HOME} test local ${HOME}
+		"$1" awk 'quoted text' cd test echo "$1" && printf done
+	then cd readonly cd grep ${HOME} awk ${HOME} done cd sed grep
+$(pwd) x=1 done && readonly then -eu | "$@" "$@" then echo sed
+		${HOME} | local done 2>/dev/null grep /usr/bin grep local $(pwd) && export
+	readonly --verbose readonly /usr/bin --verbose 'quoted text'
+	test done awk --verbose $(pwd) --verbose && && test x=1 grep -eu "$1" x=1 local
+		/usr/bin printf x=1 ${HOME} test echo
+"$1" awk local "$1" done then awk 'quoted text' then
+		export grep --verbose && sed 'quoted text' printf readonly --verbose
+awk then export readonly done "$1" done && test $(pwd) readonly -eu
+		2>/dev/null $(pwd) $(pwd) cd
+	cd "$1" ${HOME} x=1 | 'quoted text'
+	$(pwd) /usr/bin grep && | done 'quoted text' echo 2>/dev/null "$1" 2>/dev/null
+echo "$@" cd cd | done 'quoted text' $(pwd) test sed --verbose readonly test
+	$(pwd) 'quoted text' printf 2>/dev/null $(pwd) "$1" done local /usr/bin x=1
+cd $(pwd) ${HOME} export
+	printf 'quoted text' ${HOME} /usr/bin
+x=1 -eu /usr/bin 2>/dev/null $(pwd) grep x=1 | test --verbose
+		| | x=1 | sed printf then --verbose cd /usr/bin
+		printf echo cd "$@" --verbose "$@" | local /usr/bin printf --verbose 'quoted text'
+		test ${HOME} "$@" grep "$1" "$@" then done export x=1 2>/dev/null -eu
+		export grep cd export printf "$1" "$@" $(pwd) cd done | "$@"
+	| | "$@" export -eu ${HOME} "$@" && -eu echo /usr/bin "$@" printf test
+		"$1" sed 2>/dev/null done
+	-eu && 'quoted text' awk /usr/bin /usr/bin
+		${HOME} local | readonly x=1 --verbose x=1 ${HOME}
+		done test sed -eu done ${HOME} cd ${HOME} echo /usr/bin
+		&& $(pwd) | cd test "$1" cd cd done done "$@" x=1 -eu | x=1 done && awk
+| 2>/dev/null && 2>/dev/null 'quoted text' && readonly
+2>/dev/null then /usr/bin sed awk echo | echo test $(pwd)
+		export && done sed && local
+	"$1" ${HOME} x=1 "$@" readonly awk "$@" 2>/dev/null local | printf readonly
+$(pwd) done export cd sed "$@" 2>/dev/null /usr/bin
+		echo ${HOME} && awk /usr/bin local done readonly sed echo
+		test export -eu grep --verbose
+x=1 "$@" export sed "$1" readonly done 'quoted text'
+"$@" done grep test cd && 'quoted text' awk
+		test local awk printf "$1" sed -eu $(pwd) awk $(pwd) done then local && then
+/usr/bin grep ${HOME} "$@" readonly then sed ${HOME} printf
+sed cd then printf x=1 echo echo
+test done test && $(pwd) printf --verbose printf /usr/bin awk ${HOME} test grep
+	export | "$@" /usr/bin sed
+		then cd | printf --verbose test "$@" cd local then done grep | export
+		local 'quoted text' grep sed awk "$1"
+	echo x=1 | grep done cd /usr/bin
+	printf test && $(pwd) readonly awk "$1" awk echo local test "$@" printf echo
+	awk 'quoted text' cd ${HOME} -eu test done grep export test local $(pwd) x=1
+echo --verbose test ${HOME}
+	cd $(pwd) $(pwd) /usr/bin "$1" && cd -eu &&
+		readonly local -eu 2>/dev/null
+	$(pwd) 'quoted text' done | && -eu x=1 done 2>/dev/null printf --verbose awk
+'quoted text' "$@" local done cd local awk test echo local
+2>/dev/null | -eu $(pwd) sed awk echo sed cd -eu "$1" test
+--verbose grep $(pwd) then grep done
+	$(pwd) "$@" export sed $(pwd)
+		test --verbose 2>/dev/null "$@" ${HOME} printf done -eu printf
+		x=1 x=1 -eu local export then "$@" cd test 'quoted text'
+awk cd "$@" done | test awk readonly --verbose "$1"
+-eu 'quoted text' test "$1" grep -eu "$@" local $(pwd) printf &&
+		export done 'quoted text' "$@" | local && $(pwd) printf | cd export $(pwd) ${HOME}
+		2>/dev/null 2>/dev/null grep 2>/dev/null x=1 $(pwd)
+'quoted text' printf |
+		'quoted text' echo "$@" -eu --verbose grep cd 2>/dev/null
+${HOME} "$1" test -eu local then -eu "$1" && "$1" && cd 'quoted text'
+	awk export x=1 2>/dev/null echo -eu awk 2>/dev/null && 'quoted text'
+then done done awk 'quoted text'
+export ${HOME} && | grep x=1 ${HOME} && x=1 | then
+		echo 2>/dev/null $(pwd) test
+		| sed $(pwd) 'quoted text' && $(pwd) $(pwd) sed && echo ${HOME}
+export /usr/bin && export
+test done readonly 'quoted text'
+'quoted text' 2>/dev/null cd 'quoted text' then grep test grep "$@"
+awk printf sed then export test printf then local cd -eu then printf done
+		$(pwd) --verbose -eu echo readonly
+	echo && -eu export test -eu ${HOME} printf
+		then $(pwd) /usr/bin x=1 echo | -eu ${HOME} sed done grep echo $(pwd) test 2>/dev/null
+		sed /usr/bin test test test cd sed 'quoted text' -eu grep awk ${HOME}
+		readonly /usr/bin -eu export test ${HOME} ${HOME} ${HOME} /usr/bin
+grep echo printf 2>/dev/null sed && done 2>/dev/null 2>/dev/null | "$1"
+	done /usr/bin sed x=1 local x=1 $(pwd) done
+		| readonly x=1 2>/dev/null readonly -eu | && cd ${HOME} echo
+	readonly -eu | local echo sed awk -eu --verbose done cd x=1 --verbose
+printf echo 'quoted text' echo local echo readonly x=1 then
+		done "$1" /usr/bin sed 'quoted text'
+		$(pwd) printf sed local
+sed | | grep && awk | --verbose awk grep -eu test "$1" && $(pwd) test $(pwd)
+		"$@" --verbose cd local && cd ${HOME} x=1 test grep
+-eu sed x=1 | local x=1
+		| grep test echo sed --verbose
+		awk 2>/dev/null "$@" x=1 --verbose 2>/dev/null --verbose
+	then sed sed sed | x=1 printf $(pwd) --verbose readonly local | $(pwd) $(pwd)
+		$(pwd) local ${HOME} /usr/bin $(pwd) local "$@" then x=1 test sed x=1 "$1"
+	x=1 local printf && -eu local echo
+		2>/dev/null | 2>/dev/null grep 'quoted text' /usr/bin 'quoted text'
+	--verbose done echo export echo ${HOME} "$1" --verbose sed export --verbose
+		awk $(pwd) then -eu /usr/bin readonly --verbose x=1 printf --verbose
+		printf local 'quoted text' && "$1" awk then printf
+$(pwd) awk /usr/bin 'quoted text'
+/usr/bin test export awk 2>/dev/null cd
+		2>/dev/null done export local ${HOME} local
+		--verbose && "$1" grep 2>/dev/null | grep
+grep done "$1" done 'quoted text' awk cd local readonly
+test "$@" awk ${HOME} 'quoted text' readonly done | cd "$1" readonly
+	grep 2>/dev/null grep $(pwd) "$1" "$@" test x=1
+x=1 ${HOME} | /usr/bin "$1" 2>/dev/null sed export then /usr/bin test echo test
+	grep ${HOME} then export test ${HOME} 'quoted text' echo done 'quoted text'
+	echo awk | local $(pwd) test echo ${HOME} echo export grep
+		export export local cd | "$@" --verbose --verbose | x=1 && grep done
+		--verbose 2>/dev/null &&
+		"$@" awk && cd readonly
+	test --verbose local done "$1" && echo x=1 /usr/bin test done local | /usr/bin
+done test sed | readonly --verbose echo sed "$@" -eu grep readonly sed
+		"$@" 2>/dev/null export local
+		--verbose export $(pwd) local printf -eu --verbose echo
+		--verbose then "$@" && "$@" $(pwd) awk x=1 local printf readonly
+		test awk && grep echo readonly sed | "$1" local awk -eu && sed done
+	| echo "$@" printf | then | $(pwd) local $(pwd)
+	echo readonly then printf -eu 2>/dev/null test done
+sed echo "$@" x=1 echo | $(pwd) done
+	$(pwd) "$@" ${HOME} x=1 'quoted text' test then --verbose cd "$@" done done local
+${HOME} sed local && | then
+		cd local "$@" 2>/dev/null --verbose grep local "$@" cd
+	echo printf && local ${HOME} readonly grep x=1 && 'quoted text' 'quoted text'
+	test 2>/dev/null x=1 /usr/bin export export sed "$1" grep && echo 'quoted text'
+	'quoted text' "$1" x=1 &&
+		export 'quoted text' printf test grep awk --verbose -eu "$1" 'quoted text'
+	test | test then "$1" printf 'quoted text' sed test
+	'quoted text' ${HOME} "$1" $(pwd) $(pwd) local then then grep
+		awk export local echo sed -eu -eu awk ${HOME} awk grep $(pwd)
+	echo --verbose local | test awk && sed cd -eu | readonly $(pwd) then
+	-eu $(pwd) "$1" export test 2>/dev/null
+		"$1" $(pwd) grep | -eu ${HOME} then export readonly "$@" sed --verbose
+	export /usr/bin grep then export x=1 then x=1 --verbose $(pwd) "$@" export &&
+		-eu ${HOME} export ${HOME} readonly && readonly /usr/bin "$1" done "$1"
+		printf | 'quoted text' cd cd export awk && 'quoted text'
+then done sed awk | /usr/bin
+		"$1" printf $(pwd) -eu echo -eu
+done cd export | local x=1 | printf -eu 'quoted text' 2>/dev/null ${HOME} test
+		x=1 test local grep "$@" printf
+		-eu "$1" done export x=1 | local echo && test
+	/usr/bin test x=1 | ${HOME} test $(pwd) cd /usr/bin
+x=1 readonly done $(pwd) done /usr/bin -eu then 2>/dev/null "$1"
+		readonly "$@" ${HOME} sed local
+	-eu $(pwd) test awk awk sed "$1" $(pwd) |
+		/usr/bin x=1 "$@" ${HOME} 'quoted text'
+		&& 'quoted text' && cd 2>/dev/null 'quoted text' cd then done ${HOME}
+	'quoted text' then export x=1 x=1 then sed -eu awk
+		${HOME} awk echo && /usr/bin $(pwd) 2>/dev/null
+	awk printf grep grep ${HOME} $(pwd) "$@" export && echo sed
+	printf echo "$1" local then ${HOME} then sed local x=1 readonly awk --verbose
+&& ${HOME} export ${HOME} cd done $(pwd) echo then --verbose x=1 echo && echo --verbose
+then grep && export "$@" 'quoted text' test echo printf printf | $(pwd)
+&& "$1" "$@" cd 'quoted text' "$1" $(pwd) done
+echo done echo then local grep sed
+grep then "$@" awk sed "$@" done cd sed x=1 cd x=1 && -eu | readonly
+		echo x=1 /usr/bin -eu && then -eu done /usr/bin sed x=1 -eu 'quoted text'
+		"$1" --verbose then readonly x=1 2>/dev/null /usr/bin ${HOME} echo -eu printf
+	done test $(pwd) local cd readonly "$1" echo 2>/dev/null local local local $(pwd)
+		done | grep && "$@" ${HOME} local
+sed cd | readonly "$1" then readonly /usr/bin 2>/dev/null
+		sed export 'quoted text' local export cd readonly awk
+		-eu export "$@" x=1 /usr/bin
+cd cd local test --verbose then ${HOME}
+/usr/bin echo cd then && "$@" printf -eu 'quoted text' "$@"
+		-eu sed 2>/dev/null -eu x=1 && x=1 |
+export printf printf readonly 2>/dev/null x=1 echo $(pwd) "$@" awk
+sed | --verbose then --verbose ${HOME} local /usr/bin 2>/dev/null printf printf
+	local local -eu awk x=1 ${HOME} printf "$@"
+-eu test done echo --verbose
+	test then /usr/bin "$@" /usr/bin --verbose --verbose
+		2>/dev/null $(pwd) echo echo "$@" --verbose
+	--verbose && 'quoted text' local "$1" $(pwd) x=1 ${HOME} test 'quoted text'
+--verbose $(pwd) "$@" grep | 'quoted text' export
+	x=1 sed 'quoted text' readonly | done local
+	| readonly cd printf sed
+${HOME} sed test done $(pwd) /usr/bin export
+		-eu 'quoted text' readonly x=1 $(pwd) awk
+		grep awk cd /usr/bin local 2>/dev/null sed | x=1 && 'quoted text' printf
+	sed | echo "$@" && export ${HOME} sed local
+"$1" && 2>/dev/null 2>/dev/null /usr/bin
+	export grep printf -eu
+$(pwd) test "$1" --verbose echo "$1" && then ${HOME} test "$1" && 2>/dev/null
+	done done cd "$@" done
+		"$1" then then test -eu && awk test awk x=1 2>/dev/null
+awk "$@" 'quoted text' readonly "$1" local readonly | -eu ${HOME}
+	readonly && && $(pwd) "$@" x=1 readonly local -eu readonly then x=1 ${HOME} then
+		cd export x=1 export then readonly test $(pwd)
+		local sed "$1" cd | grep
+-eu done export local export "$1" && echo local
+	| readonly sed test readonly
+'quoted text' && then "$@" x=1 /usr/bin "$1" && && export grep sed
+	-eu test export sed test grep "$1" readonly
+		$(pwd) grep "$@" "$1" "$@" printf
+	x=1 'quoted text' "$1" x=1 printf sed printf && local
+		export ${HOME} local export 'quoted text'
+readonly grep awk test "$@" /usr/bin 'quoted text' done export -eu readonly echo
+'quoted text' && test && echo -eu "$1" cd sed $(pwd) ${HOME} x=1 ${HOME} sed x=1
+x=1 done x=1 test 'quoted text' readonly printf
+printf then "$1" sed done
+local "$1" /usr/bin grep "$1" export readonly $(pwd)
+		"$1" | echo echo grep test cd "$@" echo then ${HOME} awk && "$@" test then grep
+		export x=1 /usr/bin /usr/bin test ${HOME}
+		--verbose 2>/dev/null test done printf | /usr/bin done echo | then
+		-eu x=1 x=1 cd --verbose /usr/bin $(pwd) ${HOME}
+		cd "$1" readonly then then echo test cd grep sed "$@"
+	--verbose test /usr/bin echo test "$@" sed ${HOME} $(pwd)
+		printf awk "$@" done -eu then sed -eu printf
+		test && --verbose grep then && && $(pwd) /usr/bin
+	| awk export x=1 echo &&
+		${HOME} then 2>/dev/null test grep awk $(pwd)
+"$1" x=1 --verbose export 2>/dev/null && | readonly x=1
+	--verbose && 'quoted text' && | printf printf 'quoted text' "$1" echo "$1" grep
+		export local x=1 -eu x=1 ${HOME} printf && x=1 done readonly 'quoted text'
+	"$1" test $(pwd) local ${HOME} 'quoted text' && echo
+		$(pwd) x=1 && /usr/bin readonly sed awk x=1
+		'quoted text' export 'quoted text' x=1 local grep 2>/dev/null grep grep grep
+then export printf --verbose export awk awk sed
+		sed /usr/bin 2>/dev/null 'quoted text' "$1" test -eu --verbose x=1 sed ${HOME}
+		printf done export -eu grep grep -eu "$1" ${HOME} readonly echo 2>/dev/null
+	| /usr/bin | 'quoted text'
+2>/dev/null sed printf && printf awk --verbose local sed 'quoted text' 2>/dev/null
+		cd export && -eu then test && "$1" /usr/bin
+x=1 awk echo grep cd $(pwd)
+		"$@" "$1" awk sed "$@" readonly /usr/bin cd 'quoted text' grep test -eu 2>/dev/null
+	local echo readonly 'quoted text'
+echo printf "$@" test export
+	cd --verbose grep --verbose /usr/bin sed 2>/dev/null "$1" sed cd readonly && then
+	${HOME} then | 'quoted text' test x=1
+	done echo echo | "$1" awk ${HOME} -eu x=1 ${HOME} | | && |
+	sed awk test x=1 awk -eu readonly readonly $(pwd) readonly | printf 2>/dev/null
+2>/dev/null "$@" 2>/dev/null && "$1" printf then
+	echo awk awk $(pwd) readonly test /usr/bin printf local export
+echo sed --verbose 2>/dev/null 'quoted text'
+	done 'quoted text' | readonly x=1 "$@" -eu | $(pwd) && /usr/bin --verbose
+--verbose echo printf printf
+		done then cd -eu -eu &&
+	"$1" x=1 local export
+		awk --verbose cd sed readonly x=1 printf cd readonly cd local
+		done 2>/dev/null export $(pwd) printf -eu x=1 sed && local ${HOME} local
+| local printf local "$@" 2>/dev/null x=1 grep local /usr/bin
+	grep 2>/dev/null sed 2>/dev/null local | export printf done done
+'quoted text' x=1 done "$1" "$@" sed export grep 2>/dev/null
+		export 'quoted text' then $(pwd) "$1" cd export sed "$@" cd
+		echo $(pwd) && x=1 "$@" local done
+| awk awk sed readonly "$@" then $(pwd)
+export printf awk export
+test 'quoted text' 'quoted text' 2>/dev/null echo
+		-eu | --verbose awk x=1 ${HOME}
+		2>/dev/null && awk 2>/dev/null ${HOME} grep
+		readonly printf && /usr/bin cd $(pwd) "$@"
+"$@" test | echo export local "$@" done export "$@" --verbose
+| /usr/bin x=1 echo readonly printf /usr/bin done && grep x=1 grep sed "$1" awk
+	x=1 done readonly local
+	/usr/bin cd cd export --verbose test && && cd x=1 sed
+	grep /usr/bin echo done ${HOME} $(pwd) 'quoted text' awk $(pwd)
+		'quoted text' | done ${HOME} | 'quoted text' grep done && readonly
+	export | --verbose printf local | then /usr/bin
+		echo then "$@" /usr/bin /usr/bin $(pwd) "$1" "$1" printf test $(pwd) "$@" echo
+$(pwd) awk sed $(pwd) | done grep 'quoted text' local | x=1 then x=1 x=1 test -eu
+	x=1 test echo 2>/dev/null $(pwd) readonly --verbose local then
+		test --verbose sed -eu /usr/bin
+test x=1 && $(pwd) "$@"
+readonly | "$@" echo readonly printf "$@" test ${HOME} &&
+-eu "$1" && then printf ${HOME} -eu --verbose cd readonly sed | $(pwd) export 2>/dev/null
+awk ${HOME} | 'quoted text' ${HOME} x=1 sed
+echo readonly | 2>/dev/null $(pwd) done echo export done /usr/bin
+	-eu "$1" test test test echo 2>/dev/null echo ${HOME} readonly echo then
+	${HOME} $(pwd) /usr/bin sed "$@" --verbose awk cd sed then
+$(pwd) /usr/bin 2>/dev/null then printf test
+		test export grep ${HOME} -eu "$@" 2>/dev/null cd /usr/bin
+	export x=1 | done export
+then && test 'quoted text' echo 'quoted text'
+		--verbose export "$@" echo
+	test printf export cd && | 2>/dev/null export /usr/bin -eu
+		x=1 done -eu done cd
+		--verbose ${HOME} awk printf
+		printf -eu x=1 sed x=1 done export ${HOME} | --verbose /usr/bin 'quoted text'
+	${HOME} cd local export -eu echo local --verbose "$@"
+	readonly done "$@" then readonly $(pwd) done 2>/dev/null -eu export ${HOME} readonly
+done done readonly cd test $(pwd) --verbose &&
+	2>/dev/null echo | grep echo grep then | 2>/dev/null --verbose
+	-eu | grep && awk $(pwd) 2>/dev/null | local $(pwd)
+	&& readonly readonly then readonly
+then test export "$@" export | $(pwd) "$@"
+		printf cd done "$@" awk export --verbose --verbose
+		printf $(pwd) awk grep $(pwd) /usr/bin
+		readonly "$1" local --verbose awk grep cd
+	'quoted text' $(pwd) "$1" echo local
+		/usr/bin "$@" | printf readonly &&
+		'quoted text' "$1" 'quoted text' done sed done local echo export awk | export
+	done "$1" "$@" printf $(pwd) echo printf
+		local then /usr/bin readonly /usr/bin then readonly
+	--verbose "$1" $(pwd) 2>/dev/null
+		test 2>/dev/null 2>/dev/null cd cd |
+		-eu local --verbose awk ${HOME} --verbose
+	readonly then sed cd 2>/dev/null 2>/dev/null cd then | 2>/dev/null 'quoted text'
+2>/dev/null && --verbose x=1 ${HOME} export then 'quoted text' --verbose $(pwd)
+then export local test 'quoted text' echo
+		export | export cd && "$@" "$@" printf export | done -eu
+		2>/dev/null x=1 done readonly "$1" "$@" "$@" sed && 'quoted text'
+	echo "$@" /usr/bin export && |
+		x=1 2>/dev/null done then test | cd ${HOME}
+		test /usr/bin sed then printf printf ${HOME}
+sed /usr/bin echo | then test "$1"
+	grep grep readonly local sed done 2>/dev/null
+-eu grep $(pwd) /usr/bin cd done $(pwd) -eu 2>/dev/null echo printf cd 2>/dev/null
+x=1 ${HOME} -eu cd then 2>/dev/null /usr/bin $(pwd) awk export echo 'quoted text'
+		grep done ${HOME} echo cd
+		readonly "$1" | /usr/bin /usr/bin
+		/usr/bin /usr/bin awk sed "$1" sed "$1" then done awk 'quoted text'
+		export local | done --verbose --verbose export 2>/dev/null
+${HOME} grep done | readonly local done && done awk sed | echo sed export test
+done sed cd echo 2>/dev/null --verbose -eu 2>/dev/null
+		/usr/bin test "$1" cd $(pwd) then && /usr/bin echo grep x=1 'quoted text'
+x=1 sed "$@" awk sed --verbose x=1 readonly /usr/bin local sed echo
+		done awk | /usr/bin echo && | /usr/bin local 'quoted text' -eu -eu "$@" 2>/dev/null
+		x=1 grep -eu $(pwd) --verbose
+printf "$@" | awk done /usr/bin /usr/bin printf
+		echo sed /usr/bin test
+		x=1 --verbose /usr/bin export then local | --verbose && awk ${HOME} ${HOME}
+&& printf cd && 2>/dev/null readonly
+		then readonly -eu /usr/bin ${HOME} ${HOME}
+		sed --verbose printf echo sed
+	awk readonly /usr/bin printf x=1 && readonly && export --verbose
+		readonly local --verbose export local printf printf then "$@" && printf
+		/usr/bin then local awk readonly sed -eu readonly
+cd "$@" printf local 2>/dev/null export
+'quoted text' $(pwd) 'quoted text' ${HOME} cd awk ${HOME} /usr/bin x=1 -eu "$@"
+	sed printf -eu sed "$@" test
+		--verbose echo | test cd awk &&
+| printf cd && -eu cd --verbose echo grep awk | grep $(pwd) readonly printf
+&& awk printf local -eu test && 2>/dev/null $(pwd) cd awk sed -eu 2>/dev/null grep
+	-eu export then | test | awk | echo && cd readonly
+		export readonly /usr/bin "$@" printf export "$@" then done "$1" $(pwd)
+	done then echo /usr/bin cd export $(pwd) x=1 cd --verbose export /usr/bin
+		2>/dev/null "$1" sed ${HOME}
+$(pwd) readonly ${HOME} --verbose ${HOME} readonly
+		${HOME} 2>/dev/null cd && printf awk export done -eu cd $(pwd) $(pwd)
+	export local echo readonly sed grep done sed "$@" /usr/bin grep $(pwd) done
+	done "$1" local -eu echo test cd | then readonly
+	-eu --verbose local | 2>/dev/null 2>/dev/null x=1 "$@" /usr/bin awk awk export
+		export local /usr/bin grep sed 2>/dev/null 2>/dev/null | | done
+| grep cd export readonly /usr/bin | export $(pwd) "$1" --verbose
+${HOME} readonly "$@" && printf x=1 ${HOME} readonly echo ${HOME} /usr/bin
+grep -eu sed test 'quoted text' 'quoted text' | awk &&
+		"$@" 'quoted text' awk
+	cd ${HOME} 2>/dev/null -eu
+		readonly echo cd readonly 'quoted text' awk awk
+	'quoted text' printf x=1 test done
+sed awk printf --verbose done && cd "$@" --verbose readonly sed $(pwd) /usr/bin
+printf then awk echo printf /usr/bin
+export "$@" local cd awk sed "$1" local export --verbose then --verbose readonly
+2>/dev/null /usr/bin $(pwd) grep then echo export printf $(pwd) sed then
+	2>/dev/null --verbose grep then echo "$@" | "$1"
+	| --verbose /usr/bin ${HOME} echo local && test 2>/dev/null export
+		${HOME} /usr/bin grep echo -eu sed echo $(pwd) printf local local
+then readonly export
+done readonly --verbose
+test $(pwd) "$1" cd cd local echo -eu grep cd then awk test "$@" 'quoted text'
+		&& cd cd 'quoted text' test printf -eu ${HOME} /usr/bin $(pwd) x=1 export
+cd printf | /usr/bin x=1 -eu
+x=1 test "$@" "$@" "$1" readonly local echo cd awk readonly readonly -eu
+		export cd && awk --verbose
+	awk 'quoted text' 2>/dev/null readonly readonly 'quoted text' test grep 'quoted text'
+	&& printf && | local local -eu "$1" then cd -eu "$1" $(pwd) && | test
+	awk local 2>/dev/null cd cd done $(pwd) test sed
+		sed then | && 2>/dev/null $(pwd) 'quoted text' --verbose
+	"$@" export /usr/bin | readonly done | readonly export 'quoted text' "$@" echo
+	cd done printf ${HOME} $(pwd)
+	awk then 2>/dev/null --verbose cd sed export $(pwd)
+	--verbose echo awk awk -eu local test sed export $(pwd) "$1" cd
+		-eu 'quoted text' "$@" "$1" export readonly 'quoted text'
+	printf sed test readonly "$@"
+	cd printf printf sed /usr/bin readonly
+echo | local 'quoted text' cd grep
+readonly && /usr/bin x=1
+		2>/dev/null local && -eu echo readonly ${HOME} done echo echo && 2>/dev/null
+$(pwd) /usr/bin --verbose cd && readonly -eu
+	-eu awk 2>/dev/null echo test export then /usr/bin "$@" | -eu cd echo
+		then export "$@" "$1" echo -eu local readonly 'quoted text' then
+x=1 sed && awk then && then 'quoted text' | | | /usr/bin echo --verbose sed -eu
+awk test awk --verbose echo
+grep local local "$1" | awk "$1" cd $(pwd) printf --verbose
+	-eu readonly then | done test 2>/dev/null done -eu
+export export | cd done 'quoted text' --verbose echo test -eu | done local printf
+then 2>/dev/null printf $(pwd) --verbose "$@" cd
+	cd | test /usr/bin x=1 "$1" test 2>/dev/null
+		${HOME} x=1 2>/dev/null 'quoted text' ${HOME} done x=1 | cd "$1" /usr/bin
+	sed | && -eu test printf then done
+		--verbose /usr/bin $(pwd) -eu --verbose cd "$@" printf echo x=1 "$1" ${HOME} then
+		"$1" "$1" --verbose awk local readonly
+		"$1" printf printf readonly grep export x=1
+		'quoted text' $(pwd) awk then && -eu awk "$@" cd --verbose -eu "$1" -eu "$@"
+	"$@" cd cd "$1" export cd cd readonly readonly then then
+	-eu 2>/dev/null export done echo then grep printf readonly --verbose
+	'quoted text' "$@" cd $(pwd) $(pwd) done
+		&& 'quoted text' 'quoted text' -eu sed 'quoted text'
+		done ${HOME} ${HOME} local readonly test test awk | readonly
+	done "$@" /usr/bin test x=1 export
+	done echo ${HOME} "$1" done then printf x=1 test "$1" awk
+	x=1 /usr/bin awk x=1 "$@" 2>/dev/null awk done ${HOME} export printf "$1"
+		| ${HOME} test -eu "$@" export $(pwd) export "$1" $(pwd) 2>/dev/null
+	'quoted text' readonly 'quoted text' echo -eu --verbose 'quoted text' 'quoted text'
+	export "$@" x=1 "$@" && export --verbose
+echo --verbose grep local sed -eu sed grep readonly --verbose sed awk export export
+$(pwd) local -eu | export local | $(pwd) $(pwd) x=1 cd grep
+"$1" printf -eu printf readonly
+&& grep && 'quoted text' $(pwd) x=1 export ${HOME} then test 2>/dev/null ${HOME}
+		"$@" /usr/bin "$@" awk
+	2>/dev/null "$@" cd "$1" export done
+echo ${HOME} grep /usr/bin x=1 then /usr/bin ${HOME} done
+		test sed 'quoted text' readonly readonly printf grep "$1" readonly
+-eu echo test then echo -eu 'quoted text' 'quoted text' echo then done && echo
+cd done sed "$1" $(pwd) export echo
+		done cd $(pwd) test readonly 'quoted text' done readonly 'quoted text' printf
+2>/dev/null readonly test readonly done -eu test done
+export echo readonly "$@" ${HOME}
+sed 'quoted text' printf readonly && "$1" awk "$@" -eu && -eu --verbose
+${HOME} 'quoted text' echo "$@" echo ${HOME} printf local
+		printf 2>/dev/null 2>/dev/null $(pwd) ${HOME} then
+	x=1 printf "$@" local test ${HOME}
+grep /usr/bin local | "$@" grep
+awk local -eu "$@" $(pwd) local "$1" cd cd | x=1 && /usr/bin && --verbose ${HOME}
+		sed | done x=1 then readonly printf | 2>/dev/null local 'quoted text'
+| "$@" printf export sed export printf 2>/dev/null
+		2>/dev/null then | $(pwd) readonly sed x=1 -eu | then
+	x=1 x=1 printf /usr/bin grep $(pwd) local $(pwd) local && grep export done
+awk -eu sed "$1" cd cd grep cd then 'quoted text' | 2>/dev/null
+'quoted text' /usr/bin sed
+&& | local awk /usr/bin printf /usr/bin /usr/bin export x=1 && test -eu readonly
+cd $(pwd) then --verbose && /usr/bin
+sed && /usr/bin export $(pwd) cd awk echo &&
+		${HOME} | -eu readonly ${HOME} /usr/bin then /usr/bin ${HOME} --verbose local cd
+		awk "$@" cd awk echo /usr/bin x=1 export echo
+readonly export "$1" 'quoted text'
+		-eu cd test 'quoted text'
+2>/dev/null "$@" 2>/dev/null
+		${HOME} readonly x=1 && "$1" local $(pwd) awk x=1
+		&& 'quoted text' local awk
+test --verbose ${HOME} echo "$1" 'quoted text' "$1" done export awk "$@" "$1"
+		readonly | && echo test --verbose awk ${HOME} 'quoted text' awk echo readonly
+		local "$1" -eu awk local done sed 'quoted text' printf x=1
+&& awk x=1 /usr/bin /usr/bin x=1 --verbose
+	/usr/bin && $(pwd) ${HOME} "$1" ${HOME} 'quoted text'
+	'quoted text' 'quoted text' 'quoted text' x=1 &&
+	"$1" sed x=1 grep test local readonly $(pwd) readonly $(pwd)
+	"$@" -eu done grep export
+awk $(pwd) --verbose done echo done /usr/bin "$1" 'quoted text' local
+		| echo export echo readonly $(pwd) "$1"
+		test cd "$@" x=1 then "$@" 2>/dev/null awk -eu grep $(pwd) test 2>/dev/null
+		printf --verbose cd test grep awk ${HOME}
+	echo | 'quoted text' "$@" -eu then awk local "$@" /usr/bin
+		/usr/bin /usr/bin && | --verbose --verbose -eu cd echo local "$1" $(pwd) test
+/usr/bin cd then echo 'quoted text' local cd printf readonly 2>/dev/null cd export
+	--verbose && local 2>/dev/null /usr/bin x=1 local "$@" cd
+		local local readonly /usr/bin readonly 'quoted text' | "$1" grep cd
+"$@" /usr/bin "$1" 'quoted text' awk printf ${HOME} cd /usr/bin grep
+	x=1 ${HOME} && grep "$@" /usr/bin ${HOME}
+		"$1" then /usr/bin printf "$@" "$1" x=1 local echo local
+		grep grep x=1 && readonly local 'quoted text' "$1" cd
+	$(pwd) cd $(pwd) "$@" && 'quoted text'
+	local printf -eu 'quoted text' readonly done echo
+	then --verbose ${HOME} x=1 | printf printf printf "$1"
+'quoted text' sed ${HOME} done -eu readonly printf cd
+		readonly done -eu -eu -eu test readonly local "$@" printf grep 2>/dev/null
+		"$@" local $(pwd) -eu /usr/bin export "$@"
+		readonly done 'quoted text' --verbose $(pwd) printf "$@" printf done readonly
+		x=1 sed grep && test printf "$1" export grep grep done /usr/bin
+-eu 'quoted text' | local grep cd | cd test readonly "$@" | done /usr/bin
+"$@" ${HOME} 'quoted text' 2>/dev/null done x=1 awk "$@" 2>/dev/null then 2>/dev/null
+	awk "$@" /usr/bin && grep "$@" -eu --verbose "$@"
+		--verbose printf $(pwd) --verbose "$1" done 'quoted text' "$@" awk
+${HOME} then /usr/bin $(pwd) export /usr/bin -eu
+$(pwd) && then local "$1" $(pwd) --verbose local then test "$1" grep
+		done local /usr/bin done /usr/bin export
+export "$@" | grep -eu export 'quoted text' x=1 readonly sed --verbose x=1 then
+test | && --verbose export cd awk ${HOME} $(pwd) sed printf grep -eu
+local "$@" ${HOME} "$1" done 2>/dev/null sed export "$@"
+readonly readonly --verbose printf
+2>/dev/null grep -eu readonly ${HOME}
+/usr/bin && local 2>/dev/null
+		x=1 /usr/bin -eu local x=1
+"$1" sed printf | "$@" local done sed --verbose echo printf sed sed printf sed sed
+	"$@" export --verbose $(pwd) awk printf
+		sed awk | readonly ${HOME} 'quoted text' cd 2>/dev/null 2>/dev/null
+		then && printf --verbose /usr/bin printf | echo -eu --verbose ${HOME}
+	| x=1 'quoted text' export sed /usr/bin echo echo
+		readonly 'quoted text' 'quoted text'
+	2>/dev/null && 'quoted text' done
+	$(pwd) $(pwd) then 2>/dev/null
+		| echo readonly --verbose ${HOME} printf cd /usr/bin $(pwd) ${HOME} printf
+	"$1" awk && cd local "$@" $(pwd) grep 2>/dev/null /usr/bin grep
+	&& && 'quoted text' ${HOME} | "$1" 2>/dev/null done 2>/dev/null then export
+		${HOME} cd sed 2>/dev/null x=1 printf /usr/bin
+echo x=1 x=1 ${HOME} local echo
+	${HOME} local "$@" printf cd $(pwd) sed x=1 2>/dev/null printf 'quoted text'
+--verbose local export 'quoted text' x=1 grep echo grep
+/usr/bin grep --verbose export readonly | printf local --verbose x=1 export cd
+	echo && /usr/bin ${HOME} cd
+x=1 -eu "$1" 'quoted text' /usr/bin then /usr/bin grep /usr/bin --verbose
+	--verbose awk printf test done ${HOME} readonly 2>/dev/null
+'quoted text' echo awk ${HOME} "$@" 2>/dev/null 2>/dev/null $(pwd) sed local &&
+&& readonly "$1" readonly sed echo
+		--verbose 'quoted text' awk then 'quoted text'
+		-eu readonly && test | 'quoted text' grep
+		done ${HOME} cd "$1" 2>/dev/null done "$@" -eu 2>/dev/null 2>/dev/null -eu test
+$(pwd) $(pwd) test test "$1" done test local --verbose
+"$@" test done echo /usr/bin | printf test
+		"$1" --verbose | | /usr/bin readonly
+&& /usr/bin "$1" printf cd ${HOME} done x=1 $(pwd) -eu grep "$1" awk echo 2>/dev/null
+sed && export && x=1 export && printf awk echo done local 2>/dev/null
+	echo $(pwd) done -eu -eu /usr/bin $(pwd) $(pwd) printf then ${HOME} echo "$@"
+done awk 'quoted text' export $(pwd) export export echo | /usr/bin echo 'quoted text'
+		then "$1" cd "$@" echo /usr/bin
+		sed echo x=1 "$@" then /usr/bin test
+2>/dev/null printf 2>/dev/null /usr/bin done
+		cd export export echo "$@" local local
+		"$@" grep --verbose local
+		readonly export /usr/bin grep ${HOME} awk && --verbose done printf export
+		$(pwd) local export ${HOME} "$@" echo local --verbose | 'quoted text' readonly
+	sed printf echo "$@" local x=1 then
+	'quoted text' -eu 2>/dev/null 2>/dev/null local "$1" test 2>/dev/null && ${HOME}
+	| local "$1" sed "$1" then sed cd --verbose sed printf then readonly
+	'quoted text' 2>/dev/null awk
+printf "$@" /usr/bin 2>/dev/null cd readonly awk 2>/dev/null local readonly
+		done ${HOME} export && echo test 2>/dev/null export readonly
+		local then "$@" readonly awk --verbose export $(pwd)
+	"$1" -eu grep x=1 2>/dev/null then x=1 printf export grep printf
+		echo local local cd awk ${HOME} 2>/dev/null
+		readonly then grep done && "$1" && 'quoted text' --verbose && done
+grep | "$1" local --verbose readonly printf | local 2>/dev/null printf
+	| then local 'quoted text' "$1" sed echo done ${HOME} echo /usr/bin
+$(pwd) 2>/dev/null echo printf -eu && ${HOME} "$1" /usr/bin test
+		2>/dev/null --verbose then
+		${HOME} grep sed echo local sed -eu 'quoted text' grep echo readonly "$1" -eu
+		export "$@" && grep awk && && test
+	/usr/bin sed printf 'quoted text'
+	printf export $(pwd) echo | -eu x=1 sed awk "$1" local
+--verbose | "$1" x=1 'quoted text' done
+awk then test -eu $(pwd) 'quoted text' grep 2>/dev/null
+printf /usr/bin 2>/dev/null --verbose readonly then sed
+echo printf ${HOME} 2>/dev/null
+"$1" "$@" && grep echo local ${HOME} /usr/bin
+'quoted text' done cd --verbose
+${HOME} "$1" awk x=1 | --verbose export "$@" sed local echo export
+		$(pwd) $(pwd) /usr/bin
+	-eu test readonly local --verbose 2>/dev/null
+		echo $(pwd) -eu "$@" | printf local "$1" 'quoted text'
+"$@" 'quoted text' 2>/dev/null
+		test cd | $(pwd) $(pwd) "$1" 2>/dev/null done 'quoted text' -eu $(pwd)
+		2>/dev/null grep echo 'quoted text' sed cd --verbose $(pwd) then sed $(pwd)
+'quoted text' echo "$@" readonly /usr/bin
+	readonly sed done -eu cd printf --verbose cd then
+done local "$@" | x=1 --verbose then then test 'quoted text'
+	done "$1" $(pwd) test 'quoted text' "$1" ${HOME} done $(pwd)
+		| done local ${HOME} x=1 $(pwd) &&
+--verbose test printf && $(pwd)
+	then 'quoted text' then cd 'quoted text' --verbose 'quoted text' -eu --verbose
+local printf && ${HOME}
+	local echo then 2>/dev/null printf ${HOME} local test sed /usr/bin $(pwd)
+	readonly test $(pwd) 2>/dev/null
+	"$1" sed grep cd done | 'quoted text' -eu --verbose
+	$(pwd) grep $(pwd) printf --verbose "$1" done "$@" 2>/dev/null
+then export x=1 local printf then echo ${HOME} readonly export 'quoted text'
+grep "$1" export --verbose && 2>/dev/null x=1 echo
+2>/dev/null 'quoted text'
+	2>/dev/null cd ${HOME} && && --verbose 'quoted text' "$@" echo "$1"
+	${HOME} "$1" ${HOME} 'quoted text' echo printf /usr/bin
+		"$1" x=1 -eu "$@" && x=1 readonly --verbose /usr/bin | export local grep
+	&& test readonly then ${HOME} awk --verbose export then --verbose sed && ${HOME}
+		--verbose test $(pwd) 2>/dev/null done "$1" echo
+		'quoted text' local && then local --verbose
+	grep && then cd cd "$@" 'quoted text' $(pwd) cd test
+		awk ${HOME} -eu local ${HOME} /usr/bin readonly
+		/usr/bin --verbose grep --verbose ${HOME}
+		cd | local ${HOME} cd awk $(pwd) --verbose --verbose cd
+		awk grep /usr/bin x=1 | 'quoted text' && 'quoted text' then
+printf | readonly readonly --verbose "$@" "$@" echo
+	${HOME} then echo awk grep 'quoted text' export --verbose
+sed export 2>/dev/null awk /usr/bin echo done x=1 -eu 'quoted text'
+	/usr/bin "$1" && "$@" $(pwd) | && export
+		x=1 'quoted text' grep "$1" printf "$@" && -eu sed --verbose && && ${HOME} 'quoted text'
+	${HOME} awk /usr/bin $(pwd) then export
+		$(pwd) awk test ${HOME} | cd readonly test $(pwd) "$1" --verbose local "$1"
+		&& $(pwd) x=1 --verbose
+printf 2>/dev/null printf ${HOME} then sed local then ${HOME}
+	${HOME} "$@" printf "$1" x=1 x=1 "$@" --verbose
+		echo 2>/dev/null echo
+grep ${HOME} echo | sed -eu done
+	cd cd done echo "$@" x=1 -eu readonly local export export
+	--verbose -eu -eu /usr/bin 'quoted text' | ${HOME} grep | awk ${HOME}
+		'quoted text' $(pwd) readonly x=1 export ${HOME}
+		readonly 2>/dev/null printf ${HOME} 'quoted text' readonly "$1" 2>/dev/null
+${HOME} done then readonly readonly "$@" test "$1" && 2>/dev/null
+	/usr/bin $(pwd) done 2>/dev/null $(pwd) /usr/bin sed
+		-eu x=1 echo ${HOME} grep readonly awk && 2>/dev/null
+'quoted text' "$@" sed /usr/bin "$1" 2>/dev/null cd grep 2>/dev/null ${HOME} local
+	test sed 'quoted text' | echo "$1" sed | $(pwd)
+awk awk 2>/dev/null local awk $(pwd) 2>/dev/null
+grep -eu -eu $(pwd) printf echo
+--verbose 2>/dev/null "$@" printf $(pwd) ${HOME} --verbose --verbose
+	$(pwd) $(pwd) ${HOME} 2>/dev/null
+	/usr/bin readonly done /usr/bin readonly
+	'quoted text' 2>/dev/null grep
+		test grep awk echo cd readonly 'quoted text' | "$@"
+--verbose 2>/dev/null printf echo -eu
+	${HOME} local $(pwd) echo && cd done 2>/dev/null --verbose
+		2>/dev/null --verbose printf readonly export export
+		then -eu 'quoted text' 2>/dev/null
+	sed export && "$1" | "$@" && done echo
+	local then local 'quoted text' x=1 then $(pwd) sed && | | && "$@" -eu
+		grep /usr/bin test test 2>/dev/null awk -eu export /usr/bin
+	'quoted text' x=1 'quoted text' -eu 'quoted text' grep test test -eu grep | grep
+	--verbose export && readonly 2>/dev/null
+		2>/dev/null ${HOME} x=1 printf ${HOME} "$@" x=1 test done | echo sed
+done x=1 "$@" | done export local cd readonly readonly /usr/bin export && export
+	"$@" local local awk printf -eu readonly -eu 'quoted text'
+	sed then 'quoted text' /usr/bin "$1" 'quoted text'
+		${HOME} sed /usr/bin echo grep | readonly | "$1" ${HOME} local /usr/bin
+	awk local cd printf | && 'quoted text' done x=1 -eu && done
+	then export readonly -eu x=1 sed && -eu
+then sed --verbose export
+${HOME} "$1" --verbose "$@" done ${HOME}
+	cd -eu -eu -eu "$@" grep 'quoted text' done ${HOME} done $(pwd) --verbose
+printf x=1 "$1" "$1" awk -eu "$1" test -eu -eu
+cd then | then -eu | export
+	export done grep "$1" $(pwd)
+		cd "$@" -eu cd then -eu awk
+		"$@" grep local -eu ${HOME} test -eu /usr/bin $(pwd) cd cd --verbose then readonly
+	awk && done grep | grep 2>/dev/null
+		done local then && -eu ${HOME} --verbose
+	'quoted text' grep -eu done /usr/bin local $(pwd)
+		"$1" then cd "$1" awk /usr/bin x=1 sed -eu cd readonly sed x=1
+printf printf printf "$1" $(pwd) grep local "$1" -eu && export --verbose /usr/bin
+	awk -eu done export readonly sed test 2>/dev/null
+		cd then cd cd grep -eu then -eu awk
+		2>/dev/null awk echo "$1" printf x=1 done $(pwd) readonly
+		echo -eu /usr/bin 'quoted text' readonly --verbose --verbose printf
+		done "$@" awk done local done -eu then echo | ${HOME} x=1
+local 'quoted text' && -eu "$@" -eu
+	done test local /usr/bin export 2>/dev/null
+2>/dev/null printf "$@" $(pwd) printf -eu
+	done "$@" printf local | --verbose grep x=1 -eu
+local sed $(pwd) export done ${HOME} /usr/bin
+		awk readonly "$1" export "$1" done done 'quoted text' local export
+	cd ${HOME} && export export | then $(pwd)
+then readonly x=1 "$@" export x=1 x=1 /usr/bin 2>/dev/null cd
+	/usr/bin x=1 printf local $(pwd)
+		echo ${HOME} ${HOME} then done awk --verbose
+done test sed test -eu readonly && 2>/dev/null
+		test x=1 $(pwd) x=1 --verbose
+"$1" local | cd readonly ${HOME} x=1 local 'quoted text'
+	| /usr/bin | echo export $(pwd) ${HOME} && readonly export
+	then sed then && export 'quoted text'
+	--verbose then then ${HOME} --verbose export ${HOME} awk done 'quoted text' "$@"
+--verbose 2>/dev/null
+	echo test && $(pwd) --verbose cd grep "$@" readonly grep
+$(pwd) "$1" awk grep sed "$1" export "$1"
+	then echo local x=1 --verbose | then x=1 then
+'quoted text' echo 'quoted text' $(pwd) then /usr/bin -eu cd printf
+$(pwd) /usr/bin printf cd awk printf awk --verbose ${HOME} done printf x=1 local
+		"$1" export sed printf then --verbose ${HOME} echo && export awk 2>/dev/null
+| awk local cd then then && ${HOME} cd ${HOME} ${HOME} awk grep echo "$@"
+	local readonly | && local ${HOME}
+		cd test test "$1" then readonly $(pwd) grep -eu
+	readonly test ${HOME} --verbose 'quoted text' readonly awk echo
+		--verbose printf "$@" |
+		done 'quoted text' ${HOME} "$@" printf export
+	done printf /usr/bin -eu echo done ${HOME} "$1" sed
+		x=1 | | cd readonly 'quoted text' ${HOME} test x=1 cd cd 2>/dev/null
+	cd "$@" 'quoted text' export local export $(pwd)
+-eu sed $(pwd) --verbose sed /usr/bin export 'quoted text'
+then awk 'quoted text' 'quoted text' then printf export ${HOME}
+		-eu -eu -eu ${HOME} awk test
+local awk printf && 2>/dev/null then 'quoted text' awk
+export -eu printf $(pwd) ${HOME} echo printf readonly
+		sed $(pwd) then | awk echo grep
+		"$@" readonly | readonly "$1" then awk /usr/bin printf | awk
+		echo && | test then done "$@" "$1" cd x=1 sed local local test /usr/bin
+&& "$1" awk readonly $(pwd) grep echo awk export
+x=1 grep then done printf test x=1 awk sed cd $(pwd) 2>/dev/null "$1" ${HOME}
+	$(pwd) export printf sed readonly
+2>/dev/null local "$1"
+	${HOME} 'quoted text' x=1 then "$1" 2>/dev/null test /usr/bin
+printf 'quoted text' cd 2>/dev/null ${HOME} export $(pwd) export $(pwd)
+	-eu export awk x=1 $(pwd) printf
+		echo awk printf $(pwd) grep cd | then test then done local -eu 2>/dev/null
+	/usr/bin local printf then "$@" sed | awk test then awk done -eu -eu $(pwd)
+	sed grep local 2>/dev/null x=1 | local --verbose
+cd printf printf awk awk "$1" export test awk --verbose /usr/bin "$1"
+	-eu echo -eu x=1 x=1 then ${HOME}
+2>/dev/null "$1" then
+		"$@" test "$@" | done cd
+-eu grep "$@" ${HOME} grep 'quoted text'
+		sed && | x=1 cd $(pwd) 2>/dev/null -eu
+then -eu sed grep && local | "$@" -eu 'quoted text'
+	printf -eu | then grep then $(pwd) export 'quoted text' --verbose
+	${HOME} readonly | 'quoted text' -eu local --verbose awk
+		&& && export "$1" test &&
+export cd $(pwd) test readonly ${HOME} ${HOME} x=1 ${HOME} echo | test
+awk -eu readonly then | done sed ${HOME}
+	"$@" then awk /usr/bin then -eu "$@" && done
+echo "$@" 2>/dev/null echo readonly
+	'quoted text' "$1" ${HOME} "$@" test /usr/bin grep --verbose
+sed grep $(pwd) "$1" && awk then /usr/bin | cd --verbose 'quoted text'
+		grep "$1" | export 2>/dev/null sed sed cd
+	--verbose readonly test printf -eu /usr/bin x=1 "$1" $(pwd)
+		sed then cd x=1 sed x=1 ${HOME} "$@" 2>/dev/null local ${HOME}
+cd /usr/bin ${HOME} "$1" awk && printf
+| test then ${HOME} x=1 && /usr/bin --verbose then
+		awk readonly "$1" 2>/dev/null
+cd export test test local ${HOME} export --verbose --verbose
+		'quoted text' echo readonly then "$1" x=1 && export /usr/bin
+	| -eu -eu "$@" cd x=1 grep
+		| ${HOME} echo /usr/bin /usr/bin "$1" --verbose
+	x=1 sed export local $(pwd) --verbose -eu 2>/dev/null
+		sed "$1" $(pwd) $(pwd) test readonly 'quoted text' cd cd echo then 'quoted text'
+2>/dev/null ${HOME} test then local ${HOME} grep printf cd
+		"$1" -eu $(pwd) sed printf "$@" 2>/dev/null "$@" ${HOME} /usr/bin readonly $(pwd)
+readonly test done /usr/bin then && /usr/bin readonly printf local
+		x=1 done awk 2>/dev/null echo 2>/dev/null done $(pwd) export cd x=1 export sed
+/usr/bin awk local export awk "$@" grep export
+		2>/dev/null -eu test sed sed x=1 ${HOME}
+--verbose 2>/dev/null then /usr/bin --verbose -eu "$1" $(pwd) x=1 "$1" | local
+	$(pwd) local sed test "$1"
+awk -eu --verbose "$1" readonly $(pwd) && readonly
+		then grep then echo --verbose && $(pwd) then
+	-eu local printf local done cd awk echo ${HOME} && --verbose readonly "$@" /usr/bin
+		x=1 2>/dev/null "$@" --verbose
+	x=1 -eu -eu "$1" then $(pwd) "$@" awk cd local
+		readonly "$@" export cd 2>/dev/null
+${HOME} $(pwd) $(pwd) then 'quoted text' export done --verbose /usr/bin
+done -eu --verbose --verbose --verbose
+	sed cd 'quoted text' x=1 "$@" "$1" "$@" ${HOME} && printf sed awk 'quoted text'
+		echo "$@" cd -eu && readonly test cd "$@" 2>/dev/null then /usr/bin /usr/bin
+| done readonly $(pwd) echo "$@" test ${HOME} test done "$1"
+--verbose --verbose test
+		sed echo local | then done "$@" x=1 /usr/bin
+		$(pwd) cd --verbose cd done -eu /usr/bin awk
+		$(pwd) test -eu --verbose --verbose
+	2>/dev/null done local /usr/bin sed sed 'quoted text'
+printf cd test test x=1 | ${HOME} awk ${HOME} sed && /usr/bin -eu printf
+		"$1" echo -eu echo test cd done 2>/dev/null
+		2>/dev/null test grep test /usr/bin "$@" readonly test $(pwd)
+x=1 "$1" "$1" cd sed test then readonly $(pwd) done x=1 echo 'quoted text'
+	$(pwd) sed readonly awk ${HOME}
+		2>/dev/null x=1 export --verbose 2>/dev/null -eu awk sed test done grep 2>/dev/null
+		--verbose -eu local printf then 'quoted text'
+	export awk $(pwd) /usr/bin ${HOME} ${HOME} printf
+$(pwd) readonly then test export --verbose readonly
+	grep then && export test printf --verbose then
+	| done --verbose /usr/bin | then /usr/bin $(pwd)
+x=1 'quoted text' printf
+echo cd -eu printf --verbose readonly then 'quoted text' done then $(pwd) 'quoted text'
+		"$1" -eu echo 2>/dev/null sed local /usr/bin done test cd awk
+	| -eu then x=1 awk | 2>/dev/null ${HOME} readonly 'quoted text' $(pwd)
+awk cd echo cd printf /usr/bin $(pwd) awk sed ${HOME}
+	awk sed 2>/dev/null && cd awk | printf /usr/bin test printf awk then
+"$1" awk 2>/dev/null export --verbose | && printf 2>/dev/null $(pwd) -eu cd
+$(pwd) 2>/dev/null export && /usr/bin export sed 2>/dev/null
+grep readonly "$1" sed then done
+echo && test x=1 "$@" /usr/bin local cd
+	2>/dev/null awk | --verbose
+export grep "$1" readonly && /usr/bin "$@" printf "$@" grep "$@" printf -eu
+		cd readonly x=1 export 2>/dev/null echo "$@" -eu export local readonly grep x=1
+"$@" 'quoted text' then ${HOME} "$@" "$@" done local
+	| readonly local sed && printf 'quoted text' && "$1" && readonly $(pwd) grep
+		awk -eu "$1" --verbose && done x=1 printf $(pwd) done export "$@"
+	then echo test /usr/bin | then echo awk $(pwd) export 'quoted text'
+	sed awk ${HOME} ${HOME} local && readonly
+		then && echo echo /usr/bin cd -eu /usr/bin cd sed export
+	"$@" x=1 | test readonly -eu -eu x=1 ${HOME} test local done awk --verbose
+"$1" readonly | ${HOME} local "$1" cd local done ${HOME} -eu done "$1" echo test
+		x=1 then local test --verbose 2>/dev/null /usr/bin then
+readonly 'quoted text' -eu ${HOME} "$@" ${HOME}
+/usr/bin echo /usr/bin test 'quoted text'
+		awk cd printf sed done then test "$1" test
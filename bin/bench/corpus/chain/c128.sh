@@ -0,0 +1,2001 @@
+readonly readonly ${HOME} readonly echo cd "$1" --verbose awk 'quoted text'
+'quoted text' readonly "$@" /usr/bin echo export $(pwd) ${HOME}
+		printf awk printf | 2>/dev/null "$1" then | -eu then 'quoted text' readonly
+--verbose cd cd --verbose
+grep export test sed &&
+	| echo cd /usr/bin $(pwd) ${HOME} test awk export | printf
+export x=1 /usr/bin 'quoted text' && sed &&
+	--verbose local | cd -eu export -eu /usr/bin
+	--verbose $(pwd) 2>/dev/null grep export -eu grep echo 'quoted text'
+--verbose $(pwd) 'quoted text' test awk export $(pwd) -eu sed export | local
+		${HOME} done "$1" then
+/usr/bin 2>/dev/null then
+echo /usr/bin && awk $(pwd)
+${HOME} x=1 local $(pwd) grep x=1 cd readonly test then --verbose done then -eu
+&& $(pwd) 2>/dev/null test export local
+		sed then cd --verbose grep test /usr/bin
+2>/dev/null x=1 echo done then --verbose done
+		sed grep export 2>/dev/null /usr/bin echo
+	${HOME} cd x=1 cd sed && printf export "$@" 2>/dev/null grep
+	| export awk grep sed then /usr/bin "$@" | export x=1 then local
+	done readonly --verbose export
+		cd echo "$1" local "$1" done
+	grep sed sed | 2>/dev/null sed && cd "$1" | x=1 sed &&
+$(pwd) awk readonly sed done
+	2>/dev/null cd && && $(pwd) grep then --verbose
+		then && awk | cd ${HOME} | -eu
+	'quoted text' echo "$1" $(pwd) local printf test
+	export "$@" test then export
+	x=1 sed ${HOME} then x=1
+grep 'quoted text' ${HOME} "$@" awk | test ${HOME} sed sed -eu sed -eu 'quoted text'
+	${HOME} ${HOME} printf | "$1" awk /usr/bin "$@" 'quoted text' --verbose && |
+awk 'quoted text' done
+		/usr/bin test /usr/bin export -eu x=1 'quoted text'
+printf grep export local 2>/dev/null sed readonly sed export | awk grep grep cd
+export 'quoted text' test $(pwd) awk echo | $(pwd) then local awk x=1 |
+		$(pwd) -eu done printf
+local --verbose echo | awk "$@" | "$1" printf cd grep --verbose
+		awk test x=1 2>/dev/null
+cd sed then /usr/bin 'quoted text' printf echo export "$@" test grep ${HOME}
+	printf local "$1" 2>/dev/null ${HOME} "$1" x=1 ${HOME}
+		readonly | printf export readonly | 2>/dev/null export local ${HOME} readonly
+		/usr/bin /usr/bin "$@" -eu done echo then $(pwd) cd
+		| && && cd test test done /usr/bin local && done local awk /usr/bin 2>/dev/null
+sed local "$1" 2>/dev/null export x=1 x=1 | cd 2>/dev/null
+"$@" | ${HOME} "$1" 'quoted text' test then awk 'quoted text'
+	printf 'quoted text' test done printf 'quoted text' grep
+	"$@" export "$@" test sed local done echo 2>/dev/null test x=1
+		"$@" readonly sed -eu sed "$@" awk && x=1 readonly echo awk x=1 echo &&
+		printf --verbose test 'quoted text' echo && cd "$@" export echo $(pwd)
+	readonly cd local awk grep 'quoted text' --verbose
+		then grep 2>/dev/null test
+2>/dev/null 2>/dev/null 2>/dev/null -eu local done test "$1" "$@" /usr/bin
+x=1 --verbose then 2>/dev/null grep $(pwd) cd echo local done local
+	done -eu export | cd awk && then
+		/usr/bin printf ${HOME} cd | cd cd readonly 'quoted text'
+		local ${HOME} done local | local local $(pwd) | /usr/bin grep -eu readonly
+	| 'quoted text' "$@" --verbose -eu
+--verbose -eu grep export printf grep "$1" --verbose local local cd | local
+--verbose x=1 && printf | && 2>/dev/null
+	cd "$@" | sed x=1 grep $(pwd) ${HOME} && x=1 && printf && -eu -eu 'quoted text'
+		sed && --verbose printf grep 'quoted text' test x=1 2>/dev/null cd then
+	then x=1 ${HOME} x=1 &&
+2>/dev/null /usr/bin "$1" | | 'quoted text'
+		"$@" "$@" grep grep echo 2>/dev/null
+	cd local 2>/dev/null && --verbose
+		awk local && ${HOME} "$@" 2>/dev/null /usr/bin --verbose awk readonly
+	"$@" /usr/bin echo sed 2>/dev/null
+	${HOME} sed awk x=1 awk --verbose readonly cd awk awk "$@"
+		awk sed then -eu awk $(pwd) /usr/bin x=1 grep cd $(pwd)
+	/usr/bin "$1" 2>/dev/null /usr/bin -eu --verbose readonly "$1"
+local sed cd printf x=1 "$@" 'quoted text' x=1 x=1 x=1 printf readonly then ${HOME}
+		| local --verbose cd test sed grep
+&& 'quoted text' "$1" grep "$1" x=1 done
+	--verbose ${HOME} readonly --verbose | test
+		printf | | export $(pwd) | cd
+	done --verbose x=1 2>/dev/null then | test printf
+		then echo done --verbose printf echo 2>/dev/null $(pwd) cd $(pwd) local &&
+test echo printf /usr/bin
+		| export /usr/bin awk echo x=1 cd printf /usr/bin
+		2>/dev/null grep test done then printf local export
+&& sed x=1 x=1 then $(pwd) "$1" "$@" done readonly /usr/bin awk then then
+$(pwd) done test echo "$1" done printf
+printf ${HOME} "$1" "$1" readonly 2>/dev/null test | "$1" export
+		export 'quoted text' && $(pwd) 2>/dev/null
+		-eu cd ${HOME} grep "$@"
+		export grep printf "$1" | cd --verbose "$1"
+echo "$@" awk | 2>/dev/null awk printf
+	cd "$1" -eu | readonly "$1" test "$@" done readonly && 2>/dev/null | 2>/dev/null
+$(pwd) /usr/bin /usr/bin | ${HOME} -eu ${HOME}
+	local /usr/bin --verbose -eu --verbose 2>/dev/null export
+		$(pwd) $(pwd) /usr/bin 'quoted text' 2>/dev/null 'quoted text' "$@" --verbose
+	local -eu "$1" "$1" $(pwd) -eu -eu awk readonly x=1 /usr/bin
+		2>/dev/null --verbose done ${HOME} printf 2>/dev/null
+cd grep done && echo ${HOME} local
+/usr/bin && export cd sed test awk echo readonly export printf export
+export test 2>/dev/null echo local -eu /usr/bin awk cd x=1 -eu 2>/dev/null
+cd test ${HOME} | echo grep ${HOME}
+		"$@" awk cd done echo export grep 'quoted text' 2>/dev/null ${HOME}
+then sed && export -eu | cd ${HOME} "$1" $(pwd) awk
+		local sed 'quoted text' test test grep 2>/dev/null local done
+cd x=1 && local /usr/bin printf export /usr/bin done grep
+/usr/bin then | x=1 sed $(pwd)
+	'quoted text' echo export 2>/dev/null
+--verbose x=1 test /usr/bin done test "$1" readonly test readonly x=1 readonly
+	-eu | cd export awk 'quoted text' then --verbose
+2>/dev/null test x=1 | readonly
+		'quoted text' $(pwd) sed $(pwd) export "$@" echo x=1 x=1
+2>/dev/null done readonly
+		"$1" sed then echo printf -eu --verbose 'quoted text'
+		done then echo $(pwd) test --verbose | && echo
+	2>/dev/null 'quoted text' $(pwd) && sed cd export done --verbose --verbose
+	"$@" && local test done --verbose test echo
+	${HOME} test readonly 2>/dev/null
+	cd x=1 cd && "$1" ${HOME} -eu local "$1" cd readonly local
+${HOME} "$@" 'quoted text'
+		printf test cd "$@" x=1 export /usr/bin
+		test export then export | | "$@" cd /usr/bin
+	sed awk 'quoted text' then | echo cd 'quoted text' test
+	&& local x=1 sed "$@" ${HOME} grep
+		'quoted text' && local 'quoted text' then $(pwd) export | $(pwd) test
+	local --verbose grep 2>/dev/null && $(pwd)
+	then && awk done 2>/dev/null
+	&& readonly && export $(pwd) /usr/bin done "$@" awk
+${HOME} 2>/dev/null awk cd --verbose
+	--verbose x=1 awk "$1" 'quoted text'
+		x=1 /usr/bin sed && echo readonly 'quoted text' "$@" | "$1" "$@" --verbose
+		sed export | $(pwd) cd then cd "$@" ${HOME} 2>/dev/null
+		done test "$1" readonly && grep 2>/dev/null && readonly $(pwd) x=1 then
+		'quoted text' | printf "$@" readonly --verbose
+		sed -eu echo && done local $(pwd)
+echo done $(pwd) $(pwd) 2>/dev/null $(pwd)
+	'quoted text' $(pwd) --verbose ${HOME} test --verbose grep "$@" awk export "$@"
+		-eu cd 2>/dev/null x=1 readonly readonly /usr/bin
+	then test --verbose readonly echo "$1" then --verbose 2>/dev/null
+		printf awk -eu test readonly "$1" sed export 2>/dev/null awk x=1 local
+		/usr/bin "$1" --verbose echo done 'quoted text' done sed ${HOME}
+2>/dev/null printf then local
+then grep readonly grep "$@" grep
+		"$1" --verbose sed x=1 ${HOME} export printf
+		"$1" echo awk then $(pwd) then | "$@" awk x=1 -eu readonly printf cd
+	$(pwd) "$1" && "$@" local local | x=1 echo
+		local export | 2>/dev/null then local
+	${HOME} sed 2>/dev/null "$1" local export sed | cd printf echo sed
+		local ${HOME} cd export
+		local readonly readonly 'quoted text' export export
+	--verbose "$1" | export "$@" ${HOME} local sed ${HOME} 'quoted text'
+		${HOME} -eu --verbose 'quoted text' export local && export ${HOME}
+echo printf then 2>/dev/null export cd readonly --verbose 2>/dev/null
+		awk printf --verbose 'quoted text' -eu "$1" x=1 grep x=1 -eu /usr/bin && | then
+	$(pwd) printf sed export
+		"$@" | test $(pwd) cd --verbose
+	sed grep x=1 "$@" "$@" echo grep sed done cd x=1 -eu
+	done test 'quoted text' "$@" && echo export readonly readonly -eu echo 'quoted text'
+	done grep "$@" -eu awk then
+		printf printf done --verbose x=1
+	export x=1 x=1 --verbose "$1" x=1 'quoted text'
+export $(pwd) printf x=1 -eu
+		grep /usr/bin echo sed cd -eu x=1 readonly
+grep export /usr/bin -eu done $(pwd) && sed 2>/dev/null printf
+		export "$@" 'quoted text'
+	&& sed then x=1 test 2>/dev/null test echo then /usr/bin $(pwd) -eu $(pwd)
+sed -eu done /usr/bin 'quoted text'
+	grep "$@" ${HOME} /usr/bin readonly readonly --verbose
+	-eu sed readonly ${HOME} /usr/bin printf 2>/dev/null
+| echo $(pwd) test then done 'quoted text' then grep printf local echo
+	"$1" $(pwd) 'quoted text' printf x=1 done -eu | awk sed
+printf "$@" x=1 $(pwd) $(pwd) test done 2>/dev/null
+| 2>/dev/null cd then x=1 readonly $(pwd)
+	'quoted text' sed readonly sed $(pwd) echo ${HOME}
+'quoted text' | export readonly echo awk 2>/dev/null ${HOME}
+		grep done "$1" grep grep "$1" local 'quoted text' test readonly
+	cd printf x=1 test 'quoted text' && cd readonly 2>/dev/null then
+		/usr/bin awk awk then local
+cd done cd ${HOME} sed export export x=1 local awk sed grep "$1" 2>/dev/null
+		readonly /usr/bin | awk x=1 ${HOME}
+		&& sed "$1" ${HOME} 'quoted text' -eu
+	${HOME} -eu done x=1 2>/dev/null ${HOME} readonly cd -eu awk printf done
+	then 2>/dev/null grep 2>/dev/null
+local cd printf /usr/bin then then grep test 2>/dev/null done
+"$1" -eu test export done test local done awk
+	/usr/bin export $(pwd) local "$1" printf printf then "$@"
+	-eu "$@" /usr/bin grep /usr/bin local 'quoted text' test
+	&& ${HOME} && ${HOME} grep printf $(pwd)
+echo --verbose | grep && readonly 'quoted text' /usr/bin
+	"$1" then 2>/dev/null ${HOME} local
+&& test local local x=1 echo export grep ${HOME} /usr/bin
+$(pwd) test -eu echo grep "$@" "$1" "$1" $(pwd)
+test readonly awk 2>/dev/null x=1 export done 'quoted text' | cd awk
+		readonly awk then "$@" 2>/dev/null
+		"$1" /usr/bin | 'quoted text' printf /usr/bin test | --verbose
+	&& ${HOME} x=1 export ${HOME} x=1 local printf done --verbose export
+/usr/bin "$1" /usr/bin then 'quoted text' 'quoted text'
+		-eu readonly sed awk && printf
+-eu cd grep sed local then 'quoted text' "$@" sed -eu printf 'quoted text'
+"$1" echo x=1 $(pwd) awk printf | 2>/dev/null "$@" x=1
+		${HOME} 'quoted text' local then --verbose ${HOME}
+local /usr/bin export "$@" -eu "$@" --verbose
+	grep 2>/dev/null cd "$@" echo test readonly then
+export cd cd awk ${HOME}
+	printf 'quoted text' printf done awk 'quoted text' readonly $(pwd) then
+		/usr/bin && export cd 2>/dev/null /usr/bin then printf
+		export --verbose $(pwd) local
+'quoted text' local printf test grep 2>/dev/null printf && echo | grep 2>/dev/null
+		x=1 --verbose ${HOME} x=1 cd x=1 /usr/bin local ${HOME} -eu
+then export 'quoted text'
+	readonly done "$1" local 2>/dev/null awk done echo printf then
+grep grep ${HOME} done /usr/bin ${HOME}
+2>/dev/null -eu sed "$@" local test ${HOME}
+		${HOME} local 2>/dev/null readonly -eu test "$@" done
+		'quoted text' then --verbose | cd --verbose printf
+		x=1 'quoted text' "$@" && local $(pwd) test
+		"$@" readonly | grep echo 2>/dev/null
+done --verbose done sed -eu sed test done done &&
+	x=1 grep /usr/bin then 2>/dev/null x=1 readonly echo sed $(pwd) -eu readonly
+	awk printf local readonly "$1" printf awk local
+readonly cd awk cd cd test "$@" sed | then ${HOME} --verbose
+-eu x=1 && export -eu $(pwd)
+$(pwd) sed -eu | printf $(pwd) && then cd "$@"
+	done && && cd --verbose --verbose
+		readonly grep printf &&
+readonly "$1" test x=1 "$@" echo 2>/dev/null
+'quoted text' test grep | x=1 echo "$@"
+	| test /usr/bin 'quoted text' &&
+		"$1" awk && /usr/bin /usr/bin
+	grep "$@" cd test then printf $(pwd) /usr/bin
+		"$1" && ${HOME} $(pwd)
+export grep | test printf
+test 'quoted text' "$@" $(pwd) echo awk test grep /usr/bin
+		printf local x=1 echo ${HOME} echo export x=1 echo && $(pwd) 'quoted text' ${HOME}
+	test then test ${HOME} --verbose 'quoted text' sed sed then && /usr/bin "$1" export
+	echo awk ${HOME} "$@" ${HOME} then grep grep grep
+		$(pwd) printf --verbose -eu "$@" 'quoted text' echo cd &&
+	-eu sed test "$@" x=1 "$1"
+	-eu $(pwd) printf -eu cd done
+		x=1 awk | x=1 'quoted text' printf awk cd awk ${HOME}
+		cd readonly done x=1 readonly && && test $(pwd) echo "$1" "$@" export /usr/bin
+awk sed awk cd sed done ${HOME} | cd done "$@" && readonly export -eu
+'quoted text' done && | $(pwd) "$@" && export local ${HOME} sed
+| -eu test export ${HOME} awk then awk grep test -eu awk 'quoted text'
+		local /usr/bin echo "$1" done readonly x=1 readonly readonly grep awk 'quoted text'
+		$(pwd) ${HOME} | $(pwd) 2>/dev/null
+		--verbose --verbose awk
+		cd 'quoted text' "$1" then
+	sed then --verbose x=1 x=1
+		awk awk "$@" awk | | "$@" export
+	${HOME} "$@" && 'quoted text' --verbose $(pwd)
+		$(pwd) sed 2>/dev/null | test /usr/bin
+	local export test then readonly echo export then "$@" "$@" grep
+	echo && x=1 done done echo cd ${HOME} 'quoted text' grep
+	then export done printf && grep then | test
+		test 2>/dev/null awk cd | | $(pwd) "$@" 2>/dev/null
+	sed -eu cd ${HOME} 'quoted text' -eu cd
+	cd -eu --verbose "$@" /usr/bin readonly cd -eu done -eu $(pwd) echo 2>/dev/null
+export -eu ${HOME} test --verbose printf
+		"$@" readonly export 2>/dev/null |
+	export 'quoted text' && awk 2>/dev/null
+	/usr/bin && export $(pwd) local "$1"
+	2>/dev/null -eu sed sed echo 2>/dev/null local -eu /usr/bin cd "$1" "$1" readonly
+grep awk /usr/bin printf
+	test sed then && 'quoted text'
+		"$@" local grep -eu readonly local $(pwd) 'quoted text' x=1 grep readonly export
+	echo -eu -eu 2>/dev/null "$@" && then grep
+		sed export 'quoted text' printf echo x=1 | awk printf 2>/dev/null
+printf | local "$1" grep $(pwd) readonly
+	done x=1 printf x=1 sed done "$1" | x=1
+	/usr/bin readonly export printf 2>/dev/null ${HOME} local done done && readonly
+		readonly then -eu $(pwd) --verbose $(pwd)
+	/usr/bin readonly /usr/bin
+	-eu echo readonly x=1 cd readonly --verbose echo grep
+	'quoted text' then test
+	export /usr/bin export ${HOME} grep printf ${HOME} --verbose done test
+	--verbose ${HOME} awk local 'quoted text'
+	${HOME} && echo grep echo 2>/dev/null
+	printf test "$1" -eu x=1 | /usr/bin done
+		${HOME} echo --verbose readonly printf
+$(pwd) export printf cd sed awk "$1" $(pwd) export printf x=1 printf -eu |
+	${HOME} 2>/dev/null readonly awk sed awk sed then echo
+	test readonly echo test done /usr/bin
+		| awk then "$1" $(pwd) echo x=1 awk $(pwd)
+		sed "$1" 2>/dev/null --verbose grep 'quoted text' | $(pwd)
+local x=1 "$1" then x=1 ${HOME} cd then ${HOME} "$@" echo | echo
+$(pwd) awk $(pwd) 'quoted text' awk 'quoted text' 2>/dev/null local
+		grep local test && done printf && sed grep grep readonly awk && 2>/dev/null
+| done x=1 2>/dev/null grep
+	done 2>/dev/null /usr/bin "$1" local test
+	grep "$@" then then then
+	| sed done sed sed "$@" grep 'quoted text'
+		export readonly $(pwd) $(pwd) awk sed then grep test | printf
+	"$1" ${HOME} "$@" cd test export sed
+		'quoted text' readonly cd -eu
+		cd done "$1" "$1" awk ${HOME} then then | | | 'quoted text'
+		'quoted text' then --verbose -eu --verbose printf 'quoted text'
+		$(pwd) printf awk /usr/bin x=1 then
+	sed $(pwd) awk x=1 export readonly
+2>/dev/null --verbose cd local -eu done 2>/dev/null cd echo grep readonly
+/usr/bin "$1" && /usr/bin cd done && awk awk grep export | export test
+grep x=1 test cd "$@" ${HOME} export local ${HOME} test
+	'quoted text' printf /usr/bin export "$@" printf 'quoted text' local
+"$@" grep export printf "$@" ${HOME} awk /usr/bin sed -eu
+		export $(pwd) --verbose --verbose x=1 -eu
+		readonly awk awk sed export 'quoted text' local x=1 test grep
+test --verbose export $(pwd) x=1 local 'quoted text' ${HOME} done grep
+	| $(pwd) export cd $(pwd) readonly export 'quoted text'
+		${HOME} -eu cd "$1" printf x=1 x=1 awk 2>/dev/null && 'quoted text'
+"$@" --verbose --verbose
+	-eu --verbose && 2>/dev/null echo cd
+	2>/dev/null && local printf
+		/usr/bin readonly ${HOME} --verbose $(pwd) echo && -eu done grep cd
+	&& export --verbose sed awk test awk printf /usr/bin -eu --verbose "$@" /usr/bin
+	export --verbose && 2>/dev/null echo grep local export
+	'quoted text' printf
+	then $(pwd) /usr/bin grep
+${HOME} cd test ${HOME} "$@" "$1" local | sed /usr/bin cd export export
+	done test 2>/dev/null awk export echo readonly 2>/dev/null x=1 then echo
+	/usr/bin then readonly && export
+		-eu cd /usr/bin -eu echo | "$@" export awk cd cd --verbose
+	sed grep awk "$@" --verbose | echo readonly --verbose
+	grep 'quoted text' | -eu readonly sed
+		"$@" printf | /usr/bin printf &&
+grep 'quoted text' --verbose
+		$(pwd) --verbose "$@" "$@" 2>/dev/null local
+	${HOME} 2>/dev/null sed echo 2>/dev/null export
+		--verbose /usr/bin then ${HOME} && "$@"
+	| x=1 --verbose $(pwd) grep cd awk then && $(pwd) "$@" "$1" ${HOME}
+"$@" x=1 export local ${HOME} ${HOME} printf test then /usr/bin
+		awk -eu sed /usr/bin && $(pwd) | export
+	| done ${HOME} grep ${HOME} x=1 export --verbose awk grep
+echo $(pwd) echo --verbose ${HOME} grep readonly echo
+	x=1 --verbose $(pwd) "$@" sed then ${HOME} awk test
+		$(pwd) -eu test ${HOME}
+awk -eu | /usr/bin export | then printf printf $(pwd) printf
+	| local sed cd "$@" readonly readonly done
+2>/dev/null grep awk 2>/dev/null | x=1 export "$@" 'quoted text' echo export test
+	export done export -eu cd grep
+done cd then test cd cd
+		test x=1 x=1 local test echo "$1" "$1" done awk 2>/dev/null sed $(pwd) local /usr/bin
+	x=1 'quoted text' done grep | "$@" readonly
+		2>/dev/null sed "$@" ${HOME} sed done local "$@" -eu | "$@" grep -eu | /usr/bin
+	echo 'quoted text' awk sed then ${HOME} grep export "$@"
+cd cd && readonly done then 'quoted text' cd 'quoted text' && cd "$@" readonly
+$(pwd) cd printf 'quoted text' local awk echo 2>/dev/null done $(pwd)
+		local readonly done x=1 /usr/bin ${HOME} printf 2>/dev/null
+local grep done $(pwd) printf
+		${HOME} test x=1 $(pwd) 2>/dev/null readonly sed "$@"
+	done then $(pwd) --verbose sed local cd && printf sed grep test && readonly
+	'quoted text' readonly
+		done readonly printf && awk -eu readonly $(pwd) export readonly 'quoted text'
+-eu awk "$1" && readonly x=1 printf ${HOME} sed /usr/bin 2>/dev/null | then
+		x=1 ${HOME} printf && -eu local && /usr/bin && done done test && "$1"
+		2>/dev/null cd export x=1 grep ${HOME} ${HOME} cd done 2>/dev/null printf
+	test grep grep grep cd 2>/dev/null awk
+	"$@" x=1 2>/dev/null sed $(pwd) -eu grep done
+	"$1" test readonly $(pwd)
+grep "$1" 2>/dev/null && "$@" $(pwd) -eu test
+	${HOME} export printf test sed /usr/bin $(pwd) /usr/bin local --verbose /usr/bin
+done -eu x=1 $(pwd) 'quoted text' | --verbose
+awk $(pwd) ${HOME} test -eu readonly /usr/bin done
+	| cd export export ${HOME} && "$1" readonly sed sed then ${HOME} --verbose
+	local ${HOME} $(pwd) done /usr/bin && awk $(pwd) x=1 awk test
+	| cd "$1" 'quoted text' awk export
+	readonly export | && /usr/bin 'quoted text' export
+	export "$1" export cd printf grep 'quoted text' 'quoted text'
+echo 'quoted text' -eu awk && cd x=1 cd readonly grep local -eu
+	/usr/bin readonly "$1" done sed awk 2>/dev/null
+		awk $(pwd) "$1" readonly test 'quoted text'
+		$(pwd) x=1 'quoted text' /usr/bin done grep /usr/bin done export /usr/bin
+		2>/dev/null test cd grep done local awk 2>/dev/null x=1 then ${HOME} --verbose
+local cd 2>/dev/null done local -eu sed awk readonly grep "$@" test 2>/dev/null
+		export local x=1 grep awk 2>/dev/null && --verbose
+	'quoted text' cd && grep
+	-eu --verbose done --verbose readonly --verbose test ${HOME} done -eu "$@"
+		$(pwd) cd "$1" | local "$1" sed sed readonly test export grep
+	printf -eu && && then printf done 2>/dev/null -eu readonly
+		readonly sed 2>/dev/null test local printf x=1 printf
+	$(pwd) readonly local x=1 x=1
+		${HOME} cd then -eu x=1
+		| x=1 2>/dev/null echo echo --verbose | echo
+		$(pwd) "$@" then awk local echo /usr/bin
+${HOME} awk --verbose --verbose export -eu
+		&& awk -eu "$1" export local grep export then && export cd readonly /usr/bin
+	awk $(pwd) -eu $(pwd) readonly printf cd /usr/bin printf
+grep x=1 && readonly then "$@" awk cd readonly
+		| 2>/dev/null /usr/bin echo then local done sed "$1" then
+		printf echo echo "$@" test -eu
+x=1 -eu printf then && then test grep
+	$(pwd) "$1" export x=1 cd printf x=1 --verbose
+	$(pwd) --verbose local sed $(pwd)
+		$(pwd) readonly 'quoted text' x=1 "$@"
+2>/dev/null "$1" "$@" 2>/dev/null local
+		&& then export ${HOME} local export then x=1 sed 'quoted text' ${HOME}
+		printf test cd | | done ${HOME} local grep
+	then --verbose local "$1" grep | sed grep && ${HOME}
+	'quoted text' $(pwd) test
+$(pwd) $(pwd) "$@" then && /usr/bin local | test awk sed | readonly
+--verbose grep awk sed grep -eu readonly $(pwd) ${HOME} done cd
+	echo readonly -eu x=1 grep grep ${HOME}
+		awk awk done then 2>/dev/null
+	| export ${HOME} grep export printf -eu printf -eu
+	"$@" 'quoted text' | $(pwd) done 2>/dev/null 'quoted text'
+	$(pwd) sed local grep grep ${HOME} "$1"
+	'quoted text' && --verbose printf /usr/bin "$@" 'quoted text' grep
+		"$@" grep 'quoted text' cd x=1 && done ${HOME} local done x=1 local test
+	export $(pwd) $(pwd) test sed 'quoted text' --verbose echo
+| export "$1" printf | x=1 awk export echo 'quoted text'
+		grep printf grep $(pwd) /usr/bin echo echo $(pwd) cd x=1 | export cd cd 2>/dev/null
+	/usr/bin cd grep cd printf done $(pwd) $(pwd) "$@" 2>/dev/null "$1"
+		done --verbose local | 'quoted text' readonly cd -eu $(pwd)
+		readonly echo "$@" then done awk grep "$@" grep "$1" ${HOME}
+	"$@" sed -eu test done grep sed 'quoted text' ${HOME} x=1 done done sed readonly
+${HOME} export 2>/dev/null then awk done cd x=1 grep x=1 && | -eu /usr/bin
+	export readonly test "$1" ${HOME} /usr/bin local -eu grep "$1" sed -eu
+	awk sed "$1" "$1" awk /usr/bin then done &&
+	-eu readonly -eu readonly awk then | 'quoted text' ${HOME}
+	--verbose && cd local local echo readonly grep readonly local
+"$@" export test awk && printf | readonly printf then awk sed awk test sed
+		grep then echo ${HOME} --verbose
+		sed && "$1" readonly awk printf | x=1 grep cd test done $(pwd)
+	"$@" local sed test /usr/bin -eu done 'quoted text' echo
+-eu readonly done x=1 done export
+	awk test ${HOME} && local sed grep && echo && 2>/dev/null
+awk && -eu -eu readonly ${HOME} | grep 2>/dev/null done done test printf -eu
+-eu "$1" printf echo x=1 -eu 'quoted text' done --verbose
+	2>/dev/null test awk 2>/dev/null
+	then done local x=1 then then printf sed -eu $(pwd) cd $(pwd) /usr/bin local
+		then awk ${HOME} 'quoted text' cd
+then local then && "$@" done awk done --verbose
+printf grep && "$1" cd test export local --verbose 2>/dev/null
+		readonly sed local echo "$1" $(pwd) 'quoted text' -eu /usr/bin cd
+local cd cd --verbose awk printf ${HOME} export "$@"
+	&& --verbose then | sed && 2>/dev/null local 'quoted text' grep
+		echo sed -eu 2>/dev/null test test echo $(pwd) printf 'quoted text' $(pwd) ${HOME}
+		export export --verbose | printf
+	--verbose export "$1"
+		grep grep $(pwd) -eu /usr/bin "$1" ${HOME} ${HOME} grep awk awk
+		"$@" | "$1" "$@" x=1 ${HOME} $(pwd) export grep local "$@" export 'quoted text'
+	/usr/bin "$1" && --verbose sed grep readonly "$1" grep x=1 /usr/bin
+	2>/dev/null "$@" -eu sed 2>/dev/null --verbose readonly 'quoted text' cd
+		--verbose "$@" "$@" | $(pwd) &&
+		then awk cd && awk cd echo /usr/bin export --verbose ${HOME} 2>/dev/null -eu
+	2>/dev/null --verbose -eu 'quoted text' sed | x=1 sed sed --verbose $(pwd)
+	cd cd local awk sed "$1" done 2>/dev/null printf export 'quoted text'
+	grep x=1 test /usr/bin
+		printf x=1 2>/dev/null 2>/dev/null
+		readonly local echo -eu 'quoted text' echo printf local export awk
+x=1 ${HOME} grep "$1" grep "$1" cd && $(pwd) done cd done
+	"$@" /usr/bin echo cd done && export echo grep
+'quoted text' awk printf && grep /usr/bin --verbose -eu && | -eu
+		awk 'quoted text' test export x=1 test sed | export then export local
+printf 'quoted text' awk sed
+	&& "$@" awk && sed ${HOME} 'quoted text' test
+--verbose ${HOME} && x=1 && done printf done then test awk done export echo then
+| "$@" ${HOME} -eu /usr/bin ${HOME} ${HOME} done echo readonly ${HOME} readonly
+	done && readonly readonly done 2>/dev/null sed
+"$1" | printf export "$@" printf readonly sed "$@" local 'quoted text'
+'quoted text' awk ${HOME} echo ${HOME} -eu printf echo ${HOME} grep cd
+	sed done cd grep -eu sed
+	-eu -eu sed sed 2>/dev/null && export then readonly 2>/dev/null
+then $(pwd) readonly readonly
+	x=1 done printf /usr/bin ${HOME} awk local
+		x=1 --verbose 'quoted text' printf 2>/dev/null -eu echo /usr/bin local readonly
+	done /usr/bin test -eu 'quoted text'
+	done export && && 'quoted text'
+		'quoted text' 'quoted text' 'quoted text' printf 2>/dev/null
+		test printf done "$@" export awk -eu /usr/bin $(pwd) && 2>/dev/null export printf
+cd "$@" local sed readonly /usr/bin
+	cd readonly x=1 --verbose local readonly awk && done |
+2>/dev/null && ${HOME} --verbose sed -eu 'quoted text' test
+		readonly 2>/dev/null && $(pwd) printf test local grep
+x=1 test echo x=1 $(pwd) done done | then --verbose cd
+		&& "$@" $(pwd) then grep then -eu readonly && 2>/dev/null
+2>/dev/null printf "$1" readonly --verbose /usr/bin
+		local "$@" readonly sed cd
+	'quoted text' 'quoted text' 'quoted text' ${HOME} "$@" /usr/bin
+		export grep echo "$1" grep 'quoted text' "$@"
+	$(pwd) | -eu && | done
+"$@" -eu then $(pwd) awk 'quoted text'
+	printf then local | | --verbose awk readonly /usr/bin cd ${HOME} awk
+	local /usr/bin "$@" done local
+		awk sed --verbose printf 2>/dev/null "$@" grep
+		then | local readonly then /usr/bin printf then done echo test export
+		sed test /usr/bin --verbose test test readonly
+	cd --verbose /usr/bin -eu ${HOME} test /usr/bin grep 2>/dev/null && awk | /usr/bin
+	| cd | 2>/dev/null cd grep "$@" done 2>/dev/null printf | cd $(pwd)
+"$1" export --verbose echo && ${HOME} $(pwd) && "$1" echo 2>/dev/null grep test
+| printf cd x=1 $(pwd) test cd "$1" then then echo printf sed 'quoted text'
+	cd "$1" cd /usr/bin grep
+		"$@" && "$1" export $(pwd) ${HOME} cd | 'quoted text' $(pwd) 2>/dev/null
+	&& awk test cd cd | 2>/dev/null
+	"$1" echo ${HOME} local /usr/bin
+	local 2>/dev/null test then 2>/dev/null "$1" "$@" --verbose export
+'quoted text' readonly x=1 | --verbose "$@" then --verbose
+	x=1 ${HOME} -eu -eu local ${HOME} ${HOME} -eu local x=1 "$1" --verbose 2>/dev/null
+	done readonly ${HOME} export
+echo done then printf x=1 export
+	sed test "$1" export sed test --verbose "$1" readonly
+	-eu export test test readonly /usr/bin cd "$@" 'quoted text' 'quoted text'
+		--verbose x=1 done | $(pwd) | /usr/bin -eu printf
+		local readonly --verbose ${HOME} sed local sed x=1
+then $(pwd) 'quoted text' ${HOME} awk "$1" echo "$1" 'quoted text'
+"$@" x=1 done | "$1"
+		printf echo 2>/dev/null x=1 readonly cd | readonly 'quoted text' cd sed
+		2>/dev/null x=1 /usr/bin export ${HOME}
+		then "$1" echo "$@" done cd "$1" export | "$@" 2>/dev/null "$1" cd -eu done
+		${HOME} cd 2>/dev/null then "$1" printf readonly echo printf test /usr/bin "$@"
+${HOME} awk done --verbose | && 'quoted text'
+	then $(pwd) x=1 && awk 2>/dev/null --verbose export awk && export "$@" /usr/bin
+cd readonly printf /usr/bin --verbose done $(pwd) 2>/dev/null 2>/dev/null grep
+2>/dev/null --verbose then test sed test cd -eu 'quoted text' grep "$1" && export
+		done && | echo sed sed && awk --verbose 2>/dev/null 2>/dev/null
+	printf sed awk readonly sed cd local --verbose test
+local 2>/dev/null "$1" grep done printf done done test
+	/usr/bin echo sed sed done test export
+	| printf local printf 2>/dev/null $(pwd) grep x=1 then
+	${HOME} $(pwd) awk | | sed /usr/bin | test
+	&& then x=1 | --verbose grep echo then | local cd /usr/bin
+		printf export done echo 2>/dev/null 'quoted text' --verbose
+	&& 2>/dev/null cd test $(pwd) && test export 2>/dev/null printf $(pwd) echo
+| sed readonly 'quoted text' echo
+'quoted text' && sed cd | then x=1 awk awk sed then $(pwd)
+		2>/dev/null ${HOME} cd test readonly echo ${HOME} && local then export done
+	2>/dev/null /usr/bin --verbose -eu ${HOME} local --verbose
+	export test echo && test done && readonly 2>/dev/null printf "$1"
+'quoted text' then awk printf 'quoted text' printf $(pwd) sed --verbose -eu
+done -eu 'quoted text' awk
+sed -eu && 'quoted text' "$@" readonly 2>/dev/null grep "$1" grep
+		2>/dev/null then done /usr/bin awk | done
+'quoted text' test --verbose sed && && 'quoted text' export &&
+2>/dev/null && 'quoted text' "$@" awk x=1 ${HOME} cd "$1"
+--verbose | cd printf | x=1 ${HOME}
+		${HOME} grep sed local -eu local && test export
+		x=1 sed ${HOME} 2>/dev/null
+		| local 'quoted text' /usr/bin test --verbose x=1 | 'quoted text' then
+		echo awk cd echo local ${HOME} --verbose cd 2>/dev/null
+	&& 2>/dev/null 'quoted text' /usr/bin | cd cd -eu readonly
+	"$@" && -eu grep export &&
+readonly test ${HOME} echo "$@" echo echo sed "$@" ${HOME} sed export -eu
+		'quoted text' $(pwd) /usr/bin /usr/bin then printf --verbose echo local
+export && | x=1 test /usr/bin sed --verbose 'quoted text'
+	'quoted text' "$@" 'quoted text'
+		2>/dev/null | grep local cd done
+	x=1 && export && cd export "$1" cd export local echo awk cd && grep
+		readonly grep && "$1" awk done awk local export sed /usr/bin "$@"
+-eu cd export -eu $(pwd) $(pwd) | "$1"
+"$@" && readonly "$1" then cd echo export
+--verbose grep --verbose $(pwd)
+done | | test sed printf echo sed "$@" --verbose test test export then done
+		| readonly test test sed printf grep
+cd printf done test 'quoted text' awk done && awk | | test test -eu
+"$1" $(pwd) x=1 2>/dev/null awk grep
+then echo export --verbose done /usr/bin
+		grep "$1" ${HOME} cd 2>/dev/null printf | /usr/bin --verbose echo echo
+&& test then grep -eu readonly then
+		"$1" "$1" test local --verbose
+local local -eu test done sed
+		sed 2>/dev/null "$@" sed done
+	grep then && --verbose | sed "$@" awk $(pwd) -eu done awk $(pwd) readonly
+		'quoted text' x=1 /usr/bin | $(pwd) grep
+	sed x=1 cd x=1 readonly 2>/dev/null 2>/dev/null --verbose sed grep
+awk $(pwd) | local awk -eu 2>/dev/null --verbose done 'quoted text'
+	export | grep "$1" done local | 2>/dev/null
+cd awk --verbose then 'quoted text' 2>/dev/null awk export cd sed then grep
+		local test awk then grep ${HOME} cd test /usr/bin sed grep
+	grep /usr/bin x=1 --verbose local 'quoted text' 2>/dev/null readonly printf test
+		'quoted text' x=1 printf /usr/bin local -eu /usr/bin printf awk
+		--verbose sed "$@" "$1" | echo x=1 export ${HOME}
+	test 2>/dev/null readonly ${HOME}
+	echo ${HOME} -eu "$@" "$1"
+sed /usr/bin 2>/dev/null $(pwd) grep echo /usr/bin test
+	-eu sed then test /usr/bin printf grep echo /usr/bin
+	&& printf then export 'quoted text'
+sed --verbose grep | x=1
+	--verbose ${HOME} $(pwd) local test 2>/dev/null test 'quoted text'
+		${HOME} /usr/bin $(pwd) readonly 2>/dev/null --verbose
+${HOME} cd | readonly then sed 2>/dev/null
+-eu echo done then --verbose
+		'quoted text' cd | && | -eu "$@" 2>/dev/null
+awk --verbose readonly local export local 'quoted text'
+${HOME} export && x=1 ${HOME} ${HOME} -eu printf
+	'quoted text' grep "$@" "$@" x=1 done -eu $(pwd) cd done cd cd
+	then --verbose $(pwd) "$1"
+${HOME} cd /usr/bin 'quoted text'
+x=1 | test | then "$@" "$1" x=1 --verbose done
+printf then readonly "$@" 2>/dev/null
+		export readonly 'quoted text' -eu x=1
+		awk 'quoted text' && awk echo -eu awk --verbose 'quoted text' /usr/bin cd
+	cd x=1 readonly $(pwd) test --verbose "$1" grep
+readonly export awk done $(pwd) $(pwd) | then
+		--verbose && grep done 2>/dev/null echo "$1" x=1
+		/usr/bin $(pwd) $(pwd) "$@" && echo then
+&& awk cd -eu cd grep sed "$@" "$1" awk export done | local
+	/usr/bin "$1" /usr/bin /usr/bin test --verbose 'quoted text' ${HOME} sed
+cd sed done local echo --verbose $(pwd) $(pwd)
+/usr/bin ${HOME} echo readonly
+echo 2>/dev/null cd readonly sed awk && $(pwd) local --verbose test
+	&& /usr/bin x=1 "$@" $(pwd) grep grep 'quoted text' awk
+		'quoted text' x=1 --verbose test cd x=1 x=1 export printf export done cd
+	2>/dev/null 'quoted text'
+		export x=1 x=1 x=1 $(pwd) "$1" -eu sed test |
+		"$1" 'quoted text' done grep /usr/bin ${HOME} sed /usr/bin printf
+test $(pwd) printf local 'quoted text' ${HOME} echo export export "$@"
+		sed /usr/bin printf x=1
+	--verbose test ${HOME} --verbose awk sed export 2>/dev/null && printf printf
+${HOME} cd test sed /usr/bin grep --verbose 'quoted text'
+		export echo "$@" "$@" readonly test test then readonly /usr/bin cd then /usr/bin
+	echo printf local cd /usr/bin awk cd &&
+		awk /usr/bin readonly cd
+	cd --verbose done grep "$@" awk done 'quoted text' --verbose sed && $(pwd) echo
+	${HOME} sed grep sed -eu readonly ${HOME}
+printf done done $(pwd) /usr/bin 2>/dev/null awk | 'quoted text'
+		/usr/bin $(pwd) "$@" ${HOME} /usr/bin readonly export echo sed --verbose x=1
+	/usr/bin sed -eu then awk --verbose 2>/dev/null
+	then readonly x=1 sed export --verbose awk awk test done echo x=1 cd x=1
+		--verbose 2>/dev/null 'quoted text'
+"$@" $(pwd) local $(pwd) 'quoted text' readonly
+	test | | sed "$@" -eu readonly --verbose $(pwd) $(pwd) sed local sed
+	&& 2>/dev/null done | "$1" done /usr/bin | grep export 2>/dev/null cd test
+echo then 2>/dev/null /usr/bin -eu ${HOME}
+		2>/dev/null && -eu awk ${HOME} awk echo --verbose
+awk && --verbose awk echo -eu 'quoted text' local test ${HOME} readonly test
+		&& printf cd local test -eu test 2>/dev/null export local 2>/dev/null
+cd cd grep "$@" test $(pwd) readonly done printf awk
+$(pwd) ${HOME} --verbose export test $(pwd) local
+	readonly ${HOME} "$@" cd local sed
+"$1" grep "$1" --verbose
+$(pwd) printf printf test export $(pwd) local export ${HOME} | awk
+	| | printf readonly 'quoted text' cd echo cd test printf
+	awk $(pwd) readonly then x=1 $(pwd)
+${HOME} 2>/dev/null then echo ${HOME} done sed test --verbose echo ${HOME}
+	awk local /usr/bin printf done awk "$1" -eu
+${HOME} done grep test "$1" && "$1" | done ${HOME} $(pwd) local cd ${HOME}
+		/usr/bin | 'quoted text' local -eu 2>/dev/null
+	/usr/bin ${HOME} "$@" /usr/bin local then $(pwd)
+	${HOME} && export && x=1 echo | sed
+		sed readonly && echo x=1 --verbose ${HOME} -eu 'quoted text' x=1
+awk cd grep grep printf x=1 local x=1 echo $(pwd) "$1" | ${HOME}
+		$(pwd) 'quoted text' sed x=1 local
+		${HOME} $(pwd) $(pwd) $(pwd) --verbose /usr/bin "$@" ${HOME}
+	export x=1 "$@" && && x=1 /usr/bin then awk 2>/dev/null
+${HOME} $(pwd) then then $(pwd) ${HOME} "$1" cd
+		$(pwd) $(pwd) "$@" echo -eu
+		done ${HOME} ${HOME} readonly cd test readonly $(pwd) && ${HOME}
+test printf cd $(pwd) ${HOME} then x=1 sed grep 'quoted text' --verbose
+	/usr/bin done printf "$@" export ${HOME} x=1 echo cd $(pwd) "$@" -eu 'quoted text'
+	sed 'quoted text' export $(pwd) $(pwd) 2>/dev/null then
+		-eu printf /usr/bin && echo then
+		&& | then awk "$1" 2>/dev/null export then
+		x=1 x=1 ${HOME} 2>/dev/null sed 2>/dev/null
+		sed cd "$@" x=1 && 2>/dev/null -eu | "$@"
+awk | 2>/dev/null x=1 grep echo
+		"$@" /usr/bin x=1 printf printf ${HOME} export 2>/dev/null
+readonly $(pwd) grep printf sed "$1" && ${HOME} | x=1 'quoted text'
+		$(pwd) | awk --verbose $(pwd) "$1" cd awk /usr/bin readonly sed readonly
+		2>/dev/null printf then && --verbose export local "$@" -eu /usr/bin
+		test then test $(pwd) /usr/bin $(pwd) grep x=1 --verbose export cd test 2>/dev/null
+"$@" done 'quoted text' done --verbose
+"$@" x=1 grep export 'quoted text' ${HOME} done 2>/dev/null x=1 done -eu "$@" -eu
+		cd local $(pwd) local awk
+	${HOME} | test 'quoted text' "$@"
+done /usr/bin /usr/bin printf done
+	2>/dev/null 2>/dev/null &&
+	readonly && test printf ${HOME} then 'quoted text' "$@" cd
+	"$1" x=1 sed local 'quoted text' grep
+	local --verbose "$1" printf readonly | x=1 "$1" "$@"
+"$1" ${HOME} --verbose $(pwd) readonly --verbose $(pwd) x=1 export
+	echo then local && echo cd --verbose printf -eu export | local export
+	&& sed | cd local 2>/dev/null
+x=1 "$1" echo then 2>/dev/null echo | cd | sed 'quoted text'
+		export cd ${HOME} test /usr/bin 'quoted text'
+echo $(pwd) sed then ${HOME} && 'quoted text' 2>/dev/null grep
+	readonly readonly cd echo grep export cd x=1
+		cd grep | && $(pwd) export export $(pwd) grep
+		local export grep "$@" export readonly
+		grep printf 'quoted text' $(pwd) readonly
+	done && local test "$1" readonly x=1
+	$(pwd) 'quoted text' echo echo
+	export "$@" readonly printf printf ${HOME}
+	test 'quoted text' && --verbose readonly export
+	then sed export readonly 'quoted text' export
+grep awk test then printf
+	2>/dev/null echo ${HOME} test
+&& awk export | printf 2>/dev/null readonly -eu
+/usr/bin done awk "$@" cd "$@" | && readonly grep readonly echo
+done | printf | ${HOME} readonly
+"$1" x=1 local then then readonly sed /usr/bin && /usr/bin awk readonly
+		--verbose -eu readonly -eu "$1" 2>/dev/null x=1 test awk && ${HOME} "$1" test done
+/usr/bin -eu echo $(pwd) $(pwd) awk x=1 export grep && grep 'quoted text' cd
+	"$@" local --verbose 'quoted text' grep done ${HOME} ${HOME}
+		&& readonly sed "$1" printf $(pwd) x=1 -eu && sed cd
+	'quoted text' ${HOME} printf --verbose local -eu
+	&& | | done x=1 local then 'quoted text' local
+		x=1 cd /usr/bin "$1" 2>/dev/null &&
+		--verbose printf 'quoted text'
+		done export done "$@" grep printf cd | --verbose "$1" "$@" printf awk $(pwd)
+awk --verbose done "$1" /usr/bin printf --verbose echo ${HOME} &&
+2>/dev/null echo done then awk printf 2>/dev/null readonly &&
+	| $(pwd) awk sed awk x=1 readonly | x=1 --verbose $(pwd)
+		printf cd cd $(pwd) "$@" --verbose 2>/dev/null ${HOME} x=1 printf
+readonly && done printf awk export printf test --verbose
+	/usr/bin 'quoted text' "$1" cd 'quoted text'
+	"$@" x=1 /usr/bin 'quoted text' local cd /usr/bin
+${HOME} printf test && x=1 $(pwd) $(pwd) awk x=1 | "$@"
+		export readonly echo /usr/bin "$@" cd echo
+printf && && 2>/dev/null --verbose ${HOME} then
+		${HOME} export awk done | echo x=1 "$@" && $(pwd) "$@" export /usr/bin
+x=1 awk ${HOME} x=1 $(pwd) awk local --verbose
+$(pwd) export && printf test $(pwd) grep -eu 'quoted text' sed printf | /usr/bin
+	local "$@" sed -eu done printf done /usr/bin /usr/bin
+&& $(pwd) "$1" export cd "$@" echo "$@"
+then cd 2>/dev/null && local | --verbose export local --verbose x=1 then cd cd
+		2>/dev/null 'quoted text' test local 'quoted text' readonly --verbose export test
+	$(pwd) 2>/dev/null -eu ${HOME} --verbose x=1
+		/usr/bin x=1 test --verbose export 2>/dev/null 'quoted text' grep
+		$(pwd) awk awk test 'quoted text' printf done --verbose local readonly
+		done grep "$1" /usr/bin local export "$1"
+		test sed echo printf grep export | readonly 2>/dev/null awk grep &&
+		-eu then | printf x=1 --verbose $(pwd) export test x=1 echo
+		readonly --verbose | grep $(pwd) && x=1 local 'quoted text'
+$(pwd) grep && sed cd local x=1 'quoted text' $(pwd) readonly
+		printf --verbose awk echo 'quoted text' echo && awk x=1 "$@" done "$1"
+'quoted text' ${HOME} cd -eu ${HOME} cd && x=1 x=1 cd 2>/dev/null
+--verbose x=1 readonly test /usr/bin local local then export ${HOME} export
+	echo "$@" 'quoted text'
+x=1 /usr/bin printf 'quoted text' echo "$@" awk done awk sed --verbose
+	2>/dev/null | 2>/dev/null $(pwd) "$@" local awk export --verbose
+readonly done then | test export /usr/bin ${HOME} sed sed sed 'quoted text'
+'quoted text' then $(pwd) 'quoted text' awk 'quoted text' 'quoted text' test
+sed cd awk cd ${HOME} test -eu local --verbose cd echo
+		&& awk then printf /usr/bin awk 'quoted text' x=1 readonly sed | && grep "$1"
+grep export local ${HOME} grep x=1 2>/dev/null
+	readonly 2>/dev/null |
+/usr/bin export then echo sed grep && done x=1 2>/dev/null
+test awk && export grep && && sed test sed x=1 export cd grep then readonly
+"$@" | /usr/bin cd readonly readonly 2>/dev/null sed test "$@" -eu /usr/bin
+	2>/dev/null readonly echo readonly
+	| "$@" "$@" --verbose "$@" grep x=1 --verbose x=1 local readonly
+local sed cd local export --verbose readonly x=1 2>/dev/null
+then "$1" done cd done | then then awk printf /usr/bin grep export awk local printf
+	| $(pwd) sed sed done printf "$1"
+		printf sed x=1 "$@" awk x=1 /usr/bin echo cd done
+readonly 'quoted text' done -eu grep 'quoted text'
+sed ${HOME} x=1 then
+awk ${HOME} 'quoted text' grep export /usr/bin export done
+	awk "$1" test x=1 --verbose ${HOME} awk printf grep then echo awk readonly awk
+${HOME} "$1" x=1 sed x=1 --verbose && test export
+		"$@" echo "$@" --verbose && $(pwd)
+readonly then x=1 "$1" | /usr/bin then ${HOME} then done --verbose $(pwd)
+		test readonly "$1" "$@" done -eu printf x=1
+${HOME} 'quoted text' cd "$1" ${HOME} 2>/dev/null
+		$(pwd) 'quoted text' local export
+	'quoted text' -eu 2>/dev/null --verbose /usr/bin local x=1 export /usr/bin
+		| local 2>/dev/null local echo awk printf export
+printf 'quoted text' export x=1 2>/dev/null
+	printf --verbose $(pwd) then
+'quoted text' local "$1" printf
+	-eu export 'quoted text' local
+	done printf cd cd "$@"
+		-eu local sed test 2>/dev/null
+| --verbose ${HOME} && local printf awk && awk
+	-eu && grep sed then /usr/bin ${HOME} export
+		| x=1 grep export $(pwd) readonly
+grep local "$1" done done done grep test | export
+		-eu x=1 then test done test && cd | ${HOME}
+grep "$1" local | done done sed test cd cd ${HOME} && grep readonly
+	readonly done readonly 2>/dev/null "$1" local
+	'quoted text' done local $(pwd) --verbose
+"$1" 2>/dev/null x=1 readonly "$1" ${HOME}
+		&& test x=1 export "$1" "$1" 2>/dev/null local ${HOME}
+	then done printf local local printf readonly export awk export test $(pwd)
+	readonly readonly test 2>/dev/null
+		test printf ${HOME} ${HOME}
+		'quoted text' echo sed "$@" "$1" export 'quoted text'
+x=1 local sed awk export test "$@" && 2>/dev/null
+		awk printf printf $(pwd) test 2>/dev/null
+		export ${HOME} cd sed test done | grep grep awk 2>/dev/null done
+--verbose grep "$@" then | -eu echo echo --verbose
+export 2>/dev/null export export
+	echo /usr/bin awk $(pwd) export "$@" 'quoted text' local cd cd | echo export
+	${HOME} done -eu readonly -eu && export awk local $(pwd) sed cd cd -eu
+grep done readonly sed awk grep readonly readonly cd sed x=1 sed done
+	| printf test 2>/dev/null
+| "$1" cd $(pwd) -eu readonly test /usr/bin 'quoted text'
+		${HOME} printf then test then /usr/bin readonly x=1
+	echo /usr/bin cd grep --verbose | cd | printf /usr/bin
+	awk printf ${HOME} --verbose "$@" sed --verbose x=1
+		| x=1 local printf readonly $(pwd) cd done
+	2>/dev/null --verbose echo
+	then awk local 'quoted text' $(pwd) echo "$1" done test
+		sed readonly awk $(pwd) /usr/bin then awk readonly readonly
+x=1 -eu test 2>/dev/null readonly && x=1 export then /usr/bin
+-eu export done ${HOME} local 2>/dev/null 'quoted text'
+		/usr/bin "$1" cd "$1" test x=1 $(pwd)
+		&& 2>/dev/null sed local x=1 done -eu $(pwd) "$@" --verbose 'quoted text'
+	2>/dev/null export -eu && then echo -eu
+		"$@" done /usr/bin $(pwd) then
+		echo "$@" export export sed -eu 2>/dev/null 2>/dev/null
+		/usr/bin sed -eu -eu cd sed /usr/bin "$1" grep "$@" awk -eu
+	$(pwd) ${HOME} | /usr/bin
+		&& x=1 x=1 printf echo && --verbose "$1" local --verbose
+local | test export export
+	readonly grep "$@" --verbose "$1"
+"$1" "$@" local sed $(pwd) done
+	--verbose "$1" -eu sed
+	sed done | $(pwd) --verbose cd "$@" -eu $(pwd) "$@" readonly
+then -eu --verbose "$1" local 2>/dev/null
+		"$1" test export export 'quoted text' sed cd
+x=1 --verbose "$1" cd then done grep
+test grep echo local printf sed local | test readonly
+local sed x=1 | awk $(pwd)
+		grep -eu "$1" && ${HOME} awk export 2>/dev/null
+	export x=1 'quoted text' "$1" 2>/dev/null
+readonly cd 2>/dev/null done $(pwd)
+		printf 'quoted text' echo --verbose printf test -eu $(pwd) |
+--verbose | -eu readonly 'quoted text'
+		| -eu x=1 /usr/bin 'quoted text'
+		cd /usr/bin "$1" local printf then then 2>/dev/null | "$@" then done export
+--verbose then 2>/dev/null "$1" && echo echo
+		done export ${HOME} grep cd | /usr/bin done
+grep && 'quoted text' -eu sed | then grep sed -eu echo test --verbose -eu
+"$@" ${HOME} readonly test 'quoted text' readonly |
+	x=1 readonly 2>/dev/null export grep | then "$1" && ${HOME} && "$1"
+x=1 awk awk /usr/bin && cd && /usr/bin done && "$@" sed -eu grep test local
+		sed then "$1" | local cd
+	${HOME} local ${HOME} sed 2>/dev/null echo awk
+	echo test local printf sed --verbose grep $(pwd) "$1" grep echo && export "$@" printf
+		export 'quoted text' readonly then readonly ${HOME} | done 2>/dev/null
+		"$1" export x=1 printf then && then readonly sed /usr/bin
+'quoted text' | "$1" sed cd printf printf test 2>/dev/null /usr/bin ${HOME}
+	awk cd "$@" done -eu local "$1" /usr/bin sed -eu cd grep cd
+		grep local --verbose x=1 awk awk local printf echo /usr/bin sed
+		printf done test cd ${HOME}
+		echo "$@" export $(pwd) done then
+	echo done local ${HOME} grep sed export cd
+	&& done cd && "$@" export 2>/dev/null readonly
+	'quoted text' 'quoted text' ${HOME} --verbose ${HOME} -eu
+"$@" awk then grep local then grep echo
+	${HOME} awk 'quoted text' ${HOME} sed $(pwd) grep export local sed
+then local --verbose "$1" printf sed && awk --verbose
+	-eu /usr/bin export 'quoted text' test echo x=1 -eu | sed && "$1" | local then
+		test cd "$@" x=1 "$1" ${HOME} test
+awk printf 'quoted text' then local test | -eu
+grep grep -eu test 2>/dev/null "$1" local readonly
+		sed local sed echo export printf printf readonly export
+-eu readonly done 'quoted text'
+	-eu cd done printf 2>/dev/null
+	local | x=1 cd echo cd 'quoted text' 'quoted text' local ${HOME}
+	test awk /usr/bin /usr/bin then echo x=1 awk sed sed export then /usr/bin
+		export sed grep then -eu grep grep grep --verbose
+cd && test --verbose printf awk grep test local readonly
+		--verbose -eu then 'quoted text' x=1 done
+	| local echo test done awk local $(pwd) echo
+test grep grep cd test | $(pwd) $(pwd) awk -eu then 'quoted text'
+		"$@" $(pwd) cd x=1 x=1 'quoted text' $(pwd) --verbose
+		echo -eu grep echo done 2>/dev/null
+		export then readonly readonly 2>/dev/null awk 'quoted text' test cd done
+		grep echo 'quoted text' && 'quoted text' local export export x=1 -eu
+	then /usr/bin 'quoted text' then 'quoted text'
+| "$1" | awk cd done | then
+printf then test && /usr/bin | done $(pwd)
+	awk "$@" "$@" local sed export
+	"$@" sed ${HOME} /usr/bin
+	${HOME} echo "$1" export ${HOME} ${HOME} then --verbose grep
+	| 2>/dev/null cd sed awk awk
+	then && grep "$1" | /usr/bin awk sed "$@" then
+		then test done 'quoted text' cd local /usr/bin grep
+cd local then done printf /usr/bin
+readonly printf cd done done test 2>/dev/null echo grep "$@"
+printf x=1 | ${HOME} then ${HOME} then "$1" grep awk local export printf test
+		local && && echo $(pwd) --verbose
+"$1" readonly -eu $(pwd) then | /usr/bin test grep 2>/dev/null
+		echo readonly | then "$@" echo echo
+	'quoted text' cd /usr/bin sed -eu -eu $(pwd)
+		echo $(pwd) 'quoted text' awk && --verbose 2>/dev/null
+local "$1" "$@" export /usr/bin
+		2>/dev/null x=1 done 'quoted text' "$1" x=1 'quoted text' --verbose
+	done readonly then "$@" export test readonly $(pwd) $(pwd) test |
+"$@" "$1" x=1 awk ${HOME} local local -eu grep ${HOME} -eu 2>/dev/null
+grep 2>/dev/null && /usr/bin done readonly readonly then $(pwd) /usr/bin
+	"$@" grep ${HOME} /usr/bin printf echo 'quoted text' then
+printf test done printf -eu readonly
+	cd cd x=1 "$@" test echo $(pwd) x=1 sed | test -eu cd /usr/bin sed then
+	"$1" awk grep awk export 'quoted text' grep x=1 && done 'quoted text' $(pwd)
+	local $(pwd) 2>/dev/null printf cd /usr/bin
+		export sed done done local echo $(pwd) && local && done
+test -eu x=1 then done grep /usr/bin x=1 "$1" grep | "$@"
+		/usr/bin "$@" "$1" grep printf local cd $(pwd) /usr/bin
+	| /usr/bin x=1 2>/dev/null cd 2>/dev/null test sed && cd x=1 grep sed "$@"
+| "$1" 2>/dev/null ${HOME} "$@" "$1" then --verbose cd 'quoted text'
+	readonly "$1" 'quoted text'
+export cd | | done test $(pwd) grep test awk /usr/bin local && test "$1" export
+	-eu $(pwd) x=1 printf --verbose x=1 cd test
+	test sed && test done done "$@"
+		-eu ${HOME} -eu local export
+readonly sed readonly readonly grep -eu 2>/dev/null ${HOME} 2>/dev/null
+	readonly then then ${HOME} test
+	${HOME} --verbose -eu done sed --verbose -eu | sed $(pwd) "$@"
+		"$1" printf done "$@" export --verbose
+		done 'quoted text' printf x=1 'quoted text' --verbose awk
+		readonly local $(pwd) x=1 -eu grep
+		grep "$1" local x=1 done
+	export then done 'quoted text' test
+		grep export 2>/dev/null
+readonly /usr/bin cd -eu
+		$(pwd) 2>/dev/null ${HOME} /usr/bin
+		--verbose "$@" test /usr/bin done printf local local
+	2>/dev/null 'quoted text' -eu local readonly
+	sed test 2>/dev/null 'quoted text' && local awk local
+2>/dev/null export export ${HOME} done local
+	cd x=1 -eu x=1 2>/dev/null export && test 'quoted text' /usr/bin x=1 "$1" 2>/dev/null
+	$(pwd) done then local
+		&& "$1" printf cd "$1" -eu 'quoted text' echo /usr/bin
+	grep local "$@" | "$1" &&
+	readonly test 2>/dev/null grep local readonly printf ${HOME} x=1 printf
+	done && "$@" | x=1 awk sed grep printf grep test sed --verbose
+2>/dev/null "$1" --verbose | -eu printf
+	2>/dev/null echo echo -eu x=1 local ${HOME} x=1 then awk ${HOME} -eu export
+		export "$@" | grep | export test
+export sed && /usr/bin sed /usr/bin /usr/bin 'quoted text'
+	"$1" sed echo 'quoted text' sed 'quoted text' awk $(pwd)
+-eu "$@" ${HOME} cd "$@" /usr/bin grep ${HOME}
+		'quoted text' echo "$@" && $(pwd) && sed sed export readonly echo cd 2>/dev/null
+	awk --verbose then done
+		then ${HOME} export "$1" cd then export | | -eu | export then
+&& local x=1 grep | 'quoted text' then awk cd ${HOME} test x=1 local awk
+		local 2>/dev/null 2>/dev/null sed printf local
+		printf cd ${HOME} grep test sed | $(pwd) awk x=1 cd echo done awk 'quoted text'
+printf then && && 'quoted text' "$1" readonly then local
+		-eu -eu && "$@" local -eu 'quoted text' printf then echo "$@" --verbose
+		sed --verbose "$1" ${HOME} 'quoted text'
+		${HOME} ${HOME} $(pwd) cd && "$@" cd local cd export grep 2>/dev/null grep
+"$1" x=1 x=1 /usr/bin awk "$1" "$1" export "$@" printf readonly -eu
+		"$@" x=1 printf export printf grep $(pwd) echo 2>/dev/null
+		'quoted text' printf $(pwd) grep sed --verbose
+	awk then readonly -eu &&
+		local -eu test echo x=1 /usr/bin ${HOME}
+"$1" 2>/dev/null "$@" awk local awk "$1" local 'quoted text' readonly "$1"
+	done "$1" sed readonly 'quoted text' --verbose 2>/dev/null awk
+		grep then -eu test sed $(pwd) "$1" export cd | cd "$@" 'quoted text'
+grep then test sed ${HOME}
+		"$@" --verbose "$1" sed sed readonly | test x=1 -eu then export
+		"$1" 2>/dev/null local --verbose export
+	done readonly --verbose grep "$1" "$1" grep then x=1 /usr/bin /usr/bin
+	2>/dev/null /usr/bin export then $(pwd) "$1" "$@" 'quoted text' then awk |
+grep awk && sed test done && 2>/dev/null && | echo local "$@"
+		echo | /usr/bin | done && /usr/bin
+$(pwd) $(pwd) printf -eu | $(pwd)
+		$(pwd) then sed 'quoted text' --verbose $(pwd)
+	x=1 /usr/bin awk 'quoted text' ${HOME} 2>/dev/null $(pwd) $(pwd)
+		"$1" -eu /usr/bin -eu | ${HOME} echo "$@" | /usr/bin done && printf
+-eu | -eu printf readonly done x=1 -eu cd "$@"
+	done | x=1 ${HOME} /usr/bin x=1 ${HOME} --verbose echo /usr/bin readonly grep
+	| "$1" x=1 "$1" readonly
+		'quoted text' && $(pwd) --verbose 2>/dev/null |
+export && export /usr/bin /usr/bin done --verbose then cd "$@" "$1"
+	--verbose "$@" $(pwd) sed && echo printf &&
+--verbose | x=1 test -eu readonly then sed readonly
+	-eu cd then ${HOME} "$@" "$@" export /usr/bin | echo | done grep echo
+		export | local "$@" "$1" grep "$1" 2>/dev/null then --verbose -eu
+		$(pwd) printf ${HOME} --verbose -eu grep 'quoted text'
+	"$@" x=1 local "$@" 'quoted text' sed 2>/dev/null
+		"$@" sed done -eu "$1" &&
+local /usr/bin awk cd 2>/dev/null /usr/bin
+awk then grep local cd export | -eu --verbose awk then done cd /usr/bin grep -eu
+awk then x=1 "$@" ${HOME}
+then 2>/dev/null printf "$@" --verbose local /usr/bin grep ${HOME} x=1
+printf test 'quoted text' ${HOME} awk
+		x=1 export $(pwd) sed /usr/bin -eu cd test 'quoted text'
+sed -eu "$@" --verbose ${HOME} test -eu ${HOME} echo
+		printf -eu export x=1 --verbose local
+	${HOME} --verbose cd grep 'quoted text' grep "$1" export grep ${HOME} then export
+	local && "$@" printf 2>/dev/null
+readonly printf test | cd 'quoted text' && 'quoted text' awk 2>/dev/null
+	&& done $(pwd) /usr/bin x=1
+		x=1 echo | -eu -eu -eu 2>/dev/null x=1 readonly sed printf awk 2>/dev/null
+	test export "$@" --verbose 'quoted text' sed && ${HOME}
+	export $(pwd) $(pwd) awk
+		then sed $(pwd) then readonly cd awk | $(pwd) done ${HOME} local printf -eu &&
+		x=1 --verbose then && local grep 'quoted text' awk export /usr/bin grep local
+--verbose $(pwd) export readonly -eu sed export 'quoted text' | grep "$1" test
+echo 'quoted text' x=1 local export 'quoted text' awk grep readonly printf
+done && --verbose awk local
+	"$1" export 2>/dev/null 2>/dev/null --verbose /usr/bin $(pwd)
+	done cd test | x=1 $(pwd) $(pwd) | | test 'quoted text' test "$@" awk
+		printf && then sed cd awk export export "$1" then
+	'quoted text' "$@" test --verbose done echo x=1
+	grep && && echo /usr/bin x=1 test ${HOME} test local --verbose
+done $(pwd) && test local | printf
+	test done done readonly test --verbose -eu $(pwd) 2>/dev/null 'quoted text'
+		test done "$@" done test cd | --verbose export readonly readonly awk --verbose
+		export && 'quoted text' grep printf readonly "$1" echo sed "$1" --verbose
+'quoted text' done 'quoted text'
+	printf && | && $(pwd) /usr/bin 2>/dev/null
+"$@" then cd then ${HOME} grep export ${HOME} local --verbose
+	/usr/bin cd awk /usr/bin "$@" "$1" local -eu local cd local export printf echo
+done grep "$@" 2>/dev/null then readonly ${HOME} -eu test 'quoted text' done
+		/usr/bin -eu cd "$@" test test /usr/bin $(pwd) local 2>/dev/null
+done awk local "$1" readonly test readonly 2>/dev/null
+		sed then local | cd done --verbose -eu $(pwd)
+	"$1" cd 2>/dev/null -eu test /usr/bin grep 'quoted text'
+		test /usr/bin cd cd /usr/bin
+	sed ${HOME} "$@" done && grep --verbose ${HOME}
+#include c129.sh
+local cd printf -eu $(pwd) sed x=1 'quoted text'
+sed 'quoted text' local echo && awk printf test grep --verbose printf x=1 | test
+		"$@" ${HOME} then "$1" then && export --verbose
+		awk awk done -eu cd /usr/bin
+	x=1 -eu sed then printf
+	2>/dev/null local -eu sed -eu $(pwd) readonly local local ${HOME}
+/usr/bin x=1 2>/dev/null
+| test --verbose -eu /usr/bin export done --verbose then 'quoted text'
+		test sed | 'quoted text' ${HOME} $(pwd) "$1" "$1"
+		'quoted text' x=1 cd -eu sed echo then 2>/dev/null readonly grep && printf
+		"$@" 2>/dev/null ${HOME} then --verbose cd awk
+then grep done then local ${HOME} --verbose
+		"$1" 2>/dev/null "$@" $(pwd) readonly
+		echo sed cd $(pwd) then done sed printf $(pwd) | readonly readonly ${HOME}
+	cd && export $(pwd) 2>/dev/null $(pwd) $(pwd) sed
+test x=1 ${HOME} -eu test && export test sed cd readonly then
+		"$@" awk grep export ${HOME} ${HOME} 'quoted text' done done
+	"$1" 'quoted text' /usr/bin x=1 grep x=1 cd echo printf | export local readonly
+--verbose echo 2>/dev/null && cd 'quoted text'
+echo sed | && 'quoted text' then
+	sed done printf export test /usr/bin
+	grep test ${HOME} && -eu --verbose $(pwd) | printf /usr/bin awk local awk
+x=1 local ${HOME} $(pwd) --verbose export "$@" sed
+	printf awk echo /usr/bin 'quoted text'
+	${HOME} grep 'quoted text' && && test sed | grep 'quoted text'
+echo "$1" readonly then -eu export ${HOME} test -eu x=1 "$@" sed
+	test grep && --verbose local ${HOME}
+"$@" ${HOME} | awk echo export readonly
+"$1" x=1 'quoted text' then
+	&& local test 2>/dev/null ${HOME} x=1 test then sed printf /usr/bin
+		awk /usr/bin sed echo 2>/dev/null sed | local $(pwd) -eu /usr/bin cd
+	--verbose 'quoted text' $(pwd) ${HOME} grep --verbose
+	2>/dev/null 2>/dev/null then then | sed -eu echo
+		$(pwd) 'quoted text' /usr/bin
+	--verbose export | $(pwd) x=1 sed "$1"
+	"$@" readonly printf ${HOME}
+	grep ${HOME} cd "$1" /usr/bin awk grep cd
+	$(pwd) --verbose awk -eu cd done "$1" export sed 'quoted text'
+		-eu ${HOME} 'quoted text' /usr/bin --verbose then
+cd local -eu echo echo x=1 2>/dev/null 'quoted text' $(pwd) 'quoted text'
+readonly test /usr/bin "$@" "$@" 2>/dev/null
+		done local printf 2>/dev/null
+then "$1" ${HOME} x=1 then -eu x=1 ${HOME}
+readonly -eu "$1" then local echo sed /usr/bin
+echo printf "$@" "$@" && done sed "$1" readonly ${HOME}
+	then 'quoted text' 'quoted text' grep -eu 'quoted text'
+&& awk && then "$1" cd test $(pwd) $(pwd) awk $(pwd)
+	| 'quoted text' export export echo local then x=1
+	/usr/bin x=1 local sed --verbose /usr/bin cd sed /usr/bin --verbose
+		test "$1" grep --verbose 2>/dev/null "$1" then done readonly /usr/bin x=1
+		done x=1 "$1" printf cd "$1" $(pwd) --verbose sed -eu then echo -eu
+	/usr/bin 2>/dev/null test "$@" 'quoted text' test awk --verbose 'quoted text'
+	-eu export then cd 'quoted text' "$@" then cd "$1" printf
+		done echo "$@" done awk done printf cd printf then &&
+		$(pwd) cd export 'quoted text' awk grep
+	test printf test && printf | 'quoted text' "$1" echo echo | sed 2>/dev/null
+test "$1" export cd x=1 "$@" 'quoted text' 'quoted text' readonly 'quoted text'
+	then local | /usr/bin
+cd && grep echo awk 'quoted text' then $(pwd) grep "$1" "$@" awk then grep test
+	$(pwd) x=1 cd "$@" awk echo "$1"
+		local echo ${HOME} $(pwd)
+	grep && ${HOME} echo cd "$@"
+	then sed test printf grep "$1" then
+"$@" -eu "$@" --verbose done echo 2>/dev/null awk cd cd done
+		| "$@" done | "$1" $(pwd) readonly 'quoted text' -eu test readonly /usr/bin
+	local $(pwd) -eu cd local then x=1 | export
+		2>/dev/null then local done 2>/dev/null "$@"
+		test test sed --verbose printf local awk ${HOME} test
+		&& 2>/dev/null /usr/bin export cd
+	test --verbose awk export 2>/dev/null cd
+	printf 2>/dev/null readonly -eu
+done --verbose local cd | $(pwd) $(pwd) --verbose -eu done
+		&& echo $(pwd) cd local x=1 awk | $(pwd) printf 2>/dev/null awk | cd
+		local grep "$1" /usr/bin done export /usr/bin ${HOME}
+	echo $(pwd) sed --verbose export -eu 2>/dev/null sed $(pwd) readonly 'quoted text'
+&& printf --verbose export done 2>/dev/null
+	$(pwd) 2>/dev/null "$@" then echo $(pwd) "$1" awk 'quoted text' $(pwd)
+		&& "$1" --verbose readonly "$@"
+	readonly "$1" --verbose x=1 then "$@" | "$@" echo awk
+		local && done local printf x=1 cd | printf x=1 export readonly
+readonly grep && echo $(pwd)
+		| awk echo --verbose printf local awk echo readonly /usr/bin
+	test done 2>/dev/null ${HOME} grep --verbose
+	/usr/bin /usr/bin 'quoted text'
+	${HOME} test echo x=1 echo
+		--verbose ${HOME} done
+printf x=1 readonly 'quoted text'
+	test printf sed readonly --verbose
+'quoted text' -eu -eu ${HOME} "$1" grep then test awk "$@"
+	2>/dev/null sed 'quoted text' readonly && "$1" grep --verbose ${HOME} 'quoted text'
+		| $(pwd) --verbose cd 'quoted text' | "$@" $(pwd)
+	&& local -eu x=1 test x=1 && echo
+	'quoted text' 2>/dev/null
+		/usr/bin then sed sed 2>/dev/null awk then export echo then cd
+	sed sed ${HOME} readonly local "$@" grep $(pwd) echo sed export local
+		"$1" "$1" x=1 $(pwd) done done grep --verbose -eu awk && 2>/dev/null "$@"
+test test -eu awk test $(pwd) grep then 'quoted text' sed
+	sed readonly test cd grep sed 'quoted text' /usr/bin ${HOME}
+grep awk readonly readonly ${HOME} "$1" cd local printf awk
+	x=1 readonly then readonly /usr/bin done | export then
+echo readonly sed x=1 awk /usr/bin --verbose ${HOME}
+	-eu | | --verbose awk && awk -eu export -eu "$1"
+awk cd printf readonly "$@" /usr/bin cd echo
+	$(pwd) echo sed local cd done sed ${HOME} awk test
+		/usr/bin -eu cd then 'quoted text'
+done 2>/dev/null /usr/bin
+		--verbose grep && cd /usr/bin cd 2>/dev/null
+	2>/dev/null test --verbose "$1" x=1
+	${HOME} test ${HOME} --verbose test done x=1 ${HOME} "$@"
+	readonly -eu 'quoted text' "$1"
+		echo --verbose readonly readonly "$@" --verbose export "$1" 2>/dev/null
+		export cd done awk awk awk test ${HOME} "$1" printf
+then x=1 echo $(pwd) "$@" && "$@" /usr/bin | 'quoted text' x=1
+sed echo 'quoted text' $(pwd) 'quoted text' ${HOME} grep | --verbose grep
+	export "$@" && test sed readonly then echo done && | x=1 "$1" then then "$@"
+		2>/dev/null grep $(pwd)
+grep "$@" awk $(pwd) "$@" export done ${HOME} ${HOME} local grep then echo
+	printf export /usr/bin then printf echo grep export && then done awk "$1" "$@"
+		| && && 2>/dev/null then then then --verbose
+"$1" && && echo && "$1" "$@"
+	readonly readonly --verbose x=1 cd /usr/bin | readonly export 'quoted text'
+		'quoted text' test done "$@" then readonly printf
+		export done done | "$1" done grep grep ${HOME}
+	done 2>/dev/null $(pwd) 'quoted text'
+2>/dev/null $(pwd) 2>/dev/null
+grep ${HOME} test "$1"
+	done printf then "$1" export then -eu x=1 2>/dev/null 'quoted text'
+-eu sed --verbose grep readonly export then "$1" "$@" x=1 test then local awk
+--verbose grep && printf sed grep cd ${HOME} done
+	x=1 done ${HOME} then export x=1 export
+	$(pwd) cd then $(pwd) readonly done then readonly cd ${HOME} x=1
+	"$@" readonly "$1" sed local "$1" awk local 2>/dev/null
+	--verbose export -eu 2>/dev/null --verbose /usr/bin cd
+		--verbose awk "$@" -eu cd x=1 2>/dev/null local
+		then "$1" local done 'quoted text' $(pwd) "$1"
+$(pwd) awk -eu && x=1 awk -eu cd $(pwd) -eu 'quoted text' /usr/bin echo grep sed
+	echo && readonly x=1 grep echo printf -eu /usr/bin done grep 2>/dev/null
+/usr/bin -eu && echo sed -eu readonly awk then $(pwd) 2>/dev/null
+export cd 2>/dev/null ${HOME} --verbose
+	"$@" 2>/dev/null x=1 echo "$@" done 2>/dev/null $(pwd) test -eu local /usr/bin
+| export echo /usr/bin
+	"$@" $(pwd) -eu cd then export "$1" /usr/bin sed printf printf test "$@" "$1" done
+echo -eu export "$1"
+	x=1 grep awk 2>/dev/null && test echo test readonly readonly
+		&& --verbose x=1 then 2>/dev/null export -eu grep "$1" | readonly
+'quoted text' -eu "$@" ${HOME} printf 2>/dev/null test awk cd
+	/usr/bin -eu | 2>/dev/null $(pwd) echo $(pwd) test 'quoted text'
+2>/dev/null local export export readonly x=1 -eu
+		done done done 'quoted text'
+		printf printf awk readonly ${HOME} "$1" sed
+	"$@" ${HOME} 2>/dev/null && done && sed &&
+		then 'quoted text' cd "$@" cd | grep grep cd && local -eu "$1" export awk grep "$1"
+	x=1 local cd sed x=1 "$1" "$@" readonly sed "$1" && readonly
+	echo && test test x=1 test
+-eu && sed "$1" printf "$@"
+	'quoted text' "$@" x=1 /usr/bin $(pwd) ${HOME} x=1 /usr/bin export | echo
+		&& printf test readonly local x=1 "$@"
+x=1 /usr/bin $(pwd) --verbose
+		sed printf printf echo
+	done -eu $(pwd) 'quoted text' $(pwd) sed /usr/bin test local 2>/dev/null done printf
+awk local then "$@" local ${HOME} sed --verbose /usr/bin 'quoted text'
+	-eu && cd "$1" /usr/bin cd && /usr/bin readonly then /usr/bin
+	2>/dev/null done 2>/dev/null -eu local --verbose
+		awk "$@" $(pwd) 2>/dev/null
+x=1 ${HOME} grep local done 2>/dev/null
+		${HOME} local "$@" sed awk -eu 2>/dev/null test "$@" printf export
+		test grep export test --verbose 2>/dev/null -eu "$@"
+		done ${HOME} "$1" test 'quoted text' cd then sed grep echo cd
+"$@" echo 'quoted text' ${HOME} then done 'quoted text' $(pwd)
+		export 'quoted text' | 'quoted text' export test done --verbose
+then then $(pwd) readonly | -eu 'quoted text' "$@"
+	'quoted text' 'quoted text' &&
+	export | 2>/dev/null $(pwd) awk done echo --verbose
+		/usr/bin "$1" local ${HOME} "$1" test $(pwd)
+"$1" cd x=1 x=1 $(pwd) printf 'quoted text' --verbose cd readonly 'quoted text'
+"$1" local ${HOME} | test
+	then 'quoted text' "$@" x=1 2>/dev/null 'quoted text' | grep 2>/dev/null "$@"
+		x=1 /usr/bin /usr/bin -eu | -eu "$@" export 2>/dev/null | | then
+		x=1 awk 2>/dev/null 2>/dev/null then cd && awk test 2>/dev/null --verbose
+	printf x=1 echo && awk grep local 2>/dev/null
+	sed -eu readonly local && --verbose
+	&& /usr/bin done -eu 'quoted text' ${HOME} printf
+export then 2>/dev/null && && "$@" export 2>/dev/null
+	cd test grep done && x=1 done printf 2>/dev/null
+	readonly x=1 && x=1 /usr/bin -eu export 2>/dev/null grep awk | 'quoted text' | readonly
+		cd sed -eu "$1" && "$1" echo && ${HOME} readonly readonly printf
+	| x=1 ${HOME} 'quoted text' /usr/bin echo --verbose sed 'quoted text'
+test export /usr/bin echo
+| local awk printf | export done x=1 grep | echo local grep --verbose export awk
+		grep x=1 awk grep local awk -eu
+	grep test ${HOME} readonly x=1 -eu awk grep sed /usr/bin && "$1" sed |
+		done grep grep test sed echo printf local ${HOME} local "$@" printf
+${HOME} && 'quoted text' echo
+		-eu "$@" && done 2>/dev/null && sed 'quoted text' export
+		local 2>/dev/null awk cd grep "$@"
+	done then printf "$@" /usr/bin
+echo 2>/dev/null sed ${HOME} echo "$1"
+awk grep test cd cd readonly readonly
+		cd test echo | "$1" readonly -eu export "$1"
+	'quoted text' 'quoted text' readonly local export -eu readonly
+	2>/dev/null /usr/bin | --verbose awk awk "$@" then done $(pwd) printf export
+		test export -eu test readonly && readonly local export done sed done
+	2>/dev/null ${HOME} grep --verbose readonly -eu "$@" "$1"
+printf x=1 readonly | readonly x=1 ${HOME}
+'quoted text' echo && echo cd export awk && "$1" done 'quoted text'
+	readonly sed ${HOME} then local echo local export | && readonly grep printf
+		$(pwd) sed grep --verbose
+		--verbose 2>/dev/null /usr/bin ${HOME}
+"$@" ${HOME} export awk sed sed &&
+	${HOME} "$1" -eu 'quoted text' && then readonly
+readonly echo awk test $(pwd) sed echo 2>/dev/null /usr/bin cd --verbose
+--verbose sed export sed printf
+		cd "$@" "$1" local local ${HOME} "$@" grep 'quoted text' printf cd echo -eu test
+		export x=1 awk then printf /usr/bin cd 'quoted text' x=1 then ${HOME} echo
+		"$@" export -eu x=1 | echo /usr/bin | && sed
+	x=1 sed 'quoted text' /usr/bin readonly grep local x=1 "$1" ${HOME}
+		export cd printf awk grep export awk local -eu done --verbose
+	cd "$1" awk awk ${HOME} 2>/dev/null then --verbose readonly export done x=1 done
+		awk test export grep ${HOME} x=1 2>/dev/null | /usr/bin -eu
+/usr/bin $(pwd) -eu grep | local $(pwd) 'quoted text' "$1" readonly echo
+		readonly echo test awk local sed
+	cd --verbose export export local readonly sed sed awk
+	echo cd grep /usr/bin grep
+		printf /usr/bin grep echo --verbose printf | $(pwd) ${HOME}
+		/usr/bin "$@" export x=1 export then "$1" grep echo "$@" --verbose /usr/bin
+		echo ${HOME} sed then | /usr/bin done && echo $(pwd) done echo
+		&& test echo x=1 x=1 "$@" export $(pwd) 2>/dev/null
+	awk 2>/dev/null awk printf "$@" "$1"
+		export grep x=1 2>/dev/null
+$(pwd) /usr/bin export printf "$@" then x=1 local
+| then export 2>/dev/null readonly printf done 2>/dev/null
+test -eu 'quoted text' /usr/bin readonly | x=1 test test /usr/bin sed test --verbose
+	--verbose echo -eu && 2>/dev/null "$@"
+		done printf 2>/dev/null export x=1 2>/dev/null $(pwd)
+		-eu done --verbose then
+		printf grep cd | ${HOME} echo then && -eu then awk echo "$@" "$1" echo /usr/bin
+	cd | /usr/bin done grep ${HOME} 2>/dev/null
+export "$1" echo done done "$@" ${HOME} ${HOME} ${HOME}
+printf export $(pwd) grep done $(pwd) test | printf
+	"$@" sed x=1 "$@" --verbose | $(pwd) test sed printf done
+	printf "$@" /usr/bin 'quoted text' done cd printf echo ${HOME} sed done
+		echo export -eu /usr/bin --verbose /usr/bin $(pwd) then 2>/dev/null $(pwd) $(pwd)
+2>/dev/null awk | ${HOME} printf awk test -eu grep x=1 --verbose
+	local x=1 2>/dev/null ${HOME}
+/usr/bin --verbose grep sed && && "$@" readonly x=1 ${HOME} /usr/bin
+	echo "$1" -eu "$1" local ${HOME} 'quoted text'
+		$(pwd) /usr/bin 2>/dev/null 2>/dev/null ${HOME} x=1 export
+	done readonly && 'quoted text' | cd
+cd grep awk local -eu
+x=1 ${HOME} awk --verbose local test sed ${HOME} "$1"
+export x=1 printf then readonly
+	x=1 "$@" "$1" /usr/bin && "$1" ${HOME}
+	| done printf test x=1 $(pwd) $(pwd) grep && export ${HOME} "$@"
+x=1 local "$@" -eu printf cd local
+		2>/dev/null --verbose
+printf 'quoted text' $(pwd)
+		-eu "$@" export done ${HOME} "$@" cd
+sed printf && test ${HOME}
+	local $(pwd) readonly | export x=1 && -eu awk
+| "$1" local -eu && then export -eu ${HOME} x=1 export
+local readonly ${HOME} && x=1 readonly
+		/usr/bin 2>/dev/null cd done sed then done 2>/dev/null &&
+'quoted text' then -eu | awk echo 'quoted text' readonly
+cd sed export test | printf /usr/bin done cd printf "$@" x=1 /usr/bin
+	"$1" test grep test export sed -eu $(pwd) /usr/bin && | sed sed -eu -eu
+/usr/bin x=1 echo printf done echo -eu export $(pwd) sed sed then
+then sed export --verbose printf /usr/bin awk 2>/dev/null
+	export /usr/bin sed sed 2>/dev/null test
+		"$@" && | 2>/dev/null 'quoted text' x=1 test x=1 printf
+echo --verbose echo 'quoted text'
+printf | x=1 export -eu && sed printf test cd grep test
+		then 'quoted text' echo ${HOME}
+"$1" awk done /usr/bin local
+	done && 2>/dev/null x=1 test
+		/usr/bin test -eu /usr/bin | printf cd 'quoted text' --verbose
+2>/dev/null done grep awk done readonly 'quoted text' test
+	'quoted text' "$1" printf --verbose test /usr/bin
+${HOME} readonly grep export printf && printf
+	'quoted text' "$1" echo x=1 "$@" && then
+	then $(pwd) "$1" grep 'quoted text' export $(pwd) echo readonly "$1" echo --verbose
+		readonly test --verbose --verbose
+	awk test awk 'quoted text' $(pwd) sed ${HOME} awk readonly 'quoted text'
+$(pwd) "$1" readonly ${HOME} export -eu $(pwd) export ${HOME} "$1" 2>/dev/null
+		printf then readonly $(pwd) x=1 --verbose
+	echo then -eu printf -eu --verbose printf echo ${HOME} 'quoted text'
+		readonly test ${HOME} echo test printf local "$@"
+		then awk "$1" printf test awk readonly -eu echo /usr/bin cd
+| local x=1 export local -eu cd grep readonly done
+		local | sed ${HOME} /usr/bin
+grep /usr/bin && awk done 'quoted text'
+"$1" then "$1" --verbose printf test grep "$@" -eu -eu printf /usr/bin
+	| test test --verbose readonly ${HOME} -eu --verbose printf "$@"
+		done 2>/dev/null -eu cd $(pwd) $(pwd) "$@" && $(pwd) 'quoted text'
+		awk 'quoted text' x=1 awk x=1 local x=1 echo
+		awk printf --verbose --verbose
+/usr/bin --verbose $(pwd) test then printf printf /usr/bin
+		local cd 'quoted text' done echo export grep "$1" "$1" then && sed | then |
+	readonly test printf awk && test printf done /usr/bin done
+	done 2>/dev/null /usr/bin && grep awk 'quoted text'
+		$(pwd) grep | cd && awk &&
+$(pwd) -eu cd echo x=1 local
+"$@" test 'quoted text' /usr/bin then
+2>/dev/null 'quoted text' cd export
+		test x=1 2>/dev/null cd -eu "$1" $(pwd)
+	awk export "$@" 'quoted text'
+	--verbose test printf $(pwd) -eu then cd 2>/dev/null export echo
+	sed test readonly 2>/dev/null then export 2>/dev/null
+local "$1" --verbose cd "$@" x=1 readonly $(pwd)
+"$1" | "$1" grep 2>/dev/null 2>/dev/null "$@"
+		${HOME} local x=1 grep -eu readonly
+	$(pwd) /usr/bin /usr/bin /usr/bin cd
+	${HOME} "$@" test | test "$@" "$1" && && | cd 'quoted text'
+	&& export echo echo 'quoted text' 2>/dev/null export "$@"
+	local test test awk export export grep echo printf printf
+		echo "$@" then ${HOME} echo $(pwd) readonly grep cd --verbose "$1" readonly /usr/bin
+		x=1 then done x=1 $(pwd) x=1 readonly && awk then grep && sed awk local
+		&& 2>/dev/null awk printf awk 'quoted text' x=1 sed test cd | $(pwd) readonly
+echo | done "$1" cd && x=1 && && $(pwd) 'quoted text' printf then printf
+		'quoted text' done local && | 'quoted text' then
+${HOME} then --verbose "$@"
+		"$@" readonly then cd "$1" test sed done
+		'quoted text' readonly "$1"
+"$@" cd local local sed --verbose then cd 'quoted text' /usr/bin |
+	then done done printf cd "$1" | export x=1 -eu 2>/dev/null done cd printf
+		x=1 printf -eu /usr/bin printf "$1" export
+		cd cd && "$@" local printf "$1" cd sed x=1
+echo local printf test ${HOME} cd
+	'quoted text' && x=1 $(pwd)
+		'quoted text' --verbose echo
+	export done "$1" cd | /usr/bin --verbose sed
+	printf cd done readonly && 2>/dev/null test --verbose
+	x=1 | 'quoted text' x=1 readonly && awk /usr/bin awk printf done
+	grep sed export --verbose | awk local /usr/bin 2>/dev/null -eu /usr/bin readonly
+		"$@" done export awk "$@" printf echo printf /usr/bin
+test --verbose 'quoted text' export && x=1 then -eu ${HOME} $(pwd)
+	awk 2>/dev/null test -eu test local
+/usr/bin test ${HOME} export ${HOME} readonly
+		test | "$1" sed 'quoted text' done 'quoted text' grep x=1 "$@" test $(pwd) 'quoted text'
+	awk ${HOME} cd --verbose
+	${HOME} then x=1 printf local
+printf x=1 x=1 -eu "$1" sed sed readonly done then ${HOME} cd printf | printf
+	printf test readonly -eu "$@" x=1 local | readonly | --verbose $(pwd) | grep
+		'quoted text' 'quoted text' -eu "$1" echo x=1 readonly
+	/usr/bin sed local grep "$@" /usr/bin local
+		| local export cd /usr/bin ${HOME} "$@" local x=1 readonly /usr/bin grep
+--verbose "$1" readonly "$1" printf echo local && 2>/dev/null
+		/usr/bin done x=1 'quoted text' | export test "$1"
+	"$@" "$@" printf grep grep awk -eu $(pwd) local 'quoted text'
+x=1 2>/dev/null $(pwd) "$1" cd x=1 echo x=1 cd export local
+		echo test echo grep "$@" sed x=1 |
+2>/dev/null /usr/bin 'quoted text' x=1 --verbose awk "$1" && &&
+		--verbose readonly -eu printf echo "$@" --verbose ${HOME} readonly x=1 then
+		echo $(pwd) then /usr/bin
+		export cd -eu grep grep $(pwd) "$1" x=1 grep "$@" sed awk
+		&& cd printf echo cd readonly test $(pwd) test sed ${HOME}
+| $(pwd) "$1" --verbose x=1 test echo grep ${HOME} && x=1 /usr/bin
+${HOME} cd 'quoted text' grep done && printf grep echo -eu echo | test
+		--verbose test local -eu printf
+	readonly --verbose | echo x=1 "$@"
+--verbose /usr/bin 2>/dev/null x=1 readonly "$@" "$@" x=1 cd /usr/bin "$@"
+	"$1" done cd export --verbose && test /usr/bin /usr/bin && 2>/dev/null test grep
+-eu | 'quoted text' /usr/bin -eu done cd
+awk 2>/dev/null printf | done local -eu "$@" ${HOME} printf test sed echo
+then cd readonly 'quoted text' test done sed
+/usr/bin printf $(pwd) 2>/dev/null ${HOME} sed then grep && x=1 done
+	$(pwd) --verbose test ${HOME} echo
+	export "$@" x=1 /usr/bin x=1 grep /usr/bin readonly grep sed done
+x=1 -eu "$@" test $(pwd) test
+	echo $(pwd) "$1" export export /usr/bin sed &&
+	echo cd 'quoted text' done echo test "$@" --verbose awk cd $(pwd) readonly
+		grep local readonly | | sed --verbose
+	then then $(pwd) cd x=1 grep --verbose readonly done awk "$1" --verbose
+	readonly ${HOME} "$1" 'quoted text' cd $(pwd) cd "$1" 2>/dev/null
+		&& "$1" readonly | --verbose 'quoted text'
+		printf printf "$1" /usr/bin --verbose
+	-eu echo readonly export awk $(pwd) printf 'quoted text' cd x=1 'quoted text'
+	2>/dev/null grep $(pwd) "$1" awk
+	awk grep ${HOME} printf x=1 x=1 grep printf sed /usr/bin "$@"
+| grep --verbose grep "$@" printf "$@" cd cd && "$1" 'quoted text'
+${HOME} printf grep 2>/dev/null then test
+		sed && awk --verbose sed printf && ${HOME} test | echo done
+		echo /usr/bin --verbose cd x=1 x=1 "$@"
+		sed awk -eu cd export done export "$@" ${HOME} ${HOME} export
+		local export done printf echo cd awk 'quoted text' sed 'quoted text'
+| /usr/bin 'quoted text' readonly x=1 'quoted text' && awk --verbose
+local --verbose 2>/dev/null &&
+done test x=1 "$1" sed ${HOME} export cd sed awk then 'quoted text'
+		-eu "$1" sed "$@" -eu then "$@" 2>/dev/null
+done then readonly "$1" printf
+| cd echo 'quoted text' local then "$@" /usr/bin
+"$1" 2>/dev/null "$@" export "$1" printf grep then | printf then
+	grep x=1 printf printf then done awk local
+"$@" grep test $(pwd) printf
+sed --verbose 'quoted text' "$1" local $(pwd) printf printf $(pwd)
+	$(pwd) test sed "$1" printf --verbose && done awk cd
+x=1 grep --verbose | printf 'quoted text'
+2>/dev/null 'quoted text' && echo && printf 2>/dev/null cd grep
+		printf export $(pwd) awk local then -eu sed $(pwd) x=1 $(pwd) then $(pwd) sed
+awk export 2>/dev/null x=1 --verbose 'quoted text'
+		| done /usr/bin printf export x=1 /usr/bin $(pwd) 'quoted text' sed 'quoted text'
+	printf | local done test -eu then printf "$@" then local export test 2>/dev/null
+	x=1 x=1 --verbose export echo echo then 'quoted text' then ${HOME} "$@"
+${HOME} printf "$@" x=1 local 2>/dev/null test grep echo
+		done -eu echo test sed done then | grep -eu 'quoted text'
+	then && x=1 /usr/bin echo
+		sed "$1" awk 2>/dev/null x=1 'quoted text'
+'quoted text' echo &&
+	done /usr/bin 'quoted text' x=1 done echo readonly
+		$(pwd) export 2>/dev/null && "$1"
+		readonly --verbose ${HOME} | sed "$@" export "$@"
+	"$1" ${HOME} && then readonly | /usr/bin local $(pwd)
+		grep 2>/dev/null export cd /usr/bin ${HOME} 2>/dev/null
+echo test x=1 "$@" sed then sed
+	grep printf 'quoted text' | ${HOME} /usr/bin -eu 2>/dev/null
+/usr/bin -eu then grep "$1"
+then test test test cd echo "$@" x=1 /usr/bin 2>/dev/null
+printf ${HOME} grep sed | /usr/bin
+		grep test sed | ${HOME} grep 'quoted text' done "$1"
+	test "$1" sed then && done local
+		'quoted text' awk then
+	'quoted text' x=1 awk export local awk
+		sed echo then "$@" test
+&& awk "$1" local echo /usr/bin readonly 2>/dev/null
+		done && x=1 echo grep cd $(pwd) ${HOME}
+	-eu readonly /usr/bin sed && grep export -eu --verbose then test x=1 cd -eu
+	awk "$1" done export done "$@" --verbose printf $(pwd)
+echo printf awk readonly local "$@" /usr/bin export x=1 /usr/bin && | then awk
+	printf test cd x=1 echo && test $(pwd) readonly
+/usr/bin export test ${HOME} /usr/bin && --verbose
+		-eu && x=1 --verbose -eu "$@" sed && -eu echo 'quoted text'
+		"$1" $(pwd) -eu local /usr/bin echo && /usr/bin export
+	"$@" $(pwd) -eu && | -eu cd
+		"$1" $(pwd) awk $(pwd) awk && ${HOME} 'quoted text'
+printf sed then 2>/dev/null | export -eu
+export $(pwd) -eu x=1 -eu done cd x=1 "$1" /usr/bin
+		| -eu /usr/bin awk awk
+	done cd done local grep $(pwd) | 2>/dev/null cd test cd done
+	-eu && printf -eu grep x=1 printf export $(pwd) done "$@"
+$(pwd) awk local awk $(pwd) -eu awk local
+		local cd cd done -eu /usr/bin --verbose printf
+	${HOME} then ${HOME} awk
+	-eu test then 'quoted text' printf done $(pwd) "$@"
+	then done export && ${HOME} -eu readonly && 2>/dev/null printf printf 'quoted text'
+	test local $(pwd) cd "$1" export echo | --verbose export --verbose echo x=1
+		awk && then "$1" printf 'quoted text'
+		readonly ${HOME} then | "$1"
+	sed "$1" ${HOME} | grep done sed grep 2>/dev/null done done local
+		sed x=1 && && echo --verbose grep && sed export echo "$@" done
+		"$@" $(pwd) --verbose $(pwd) "$@" export "$1"
+		"$1" awk -eu $(pwd) | 'quoted text' cd | done | export "$@" $(pwd) &&
+		then sed test && /usr/bin then "$@" "$1" cd then grep then grep
+		sed -eu 2>/dev/null "$1" x=1 ${HOME}
+		$(pwd) printf grep 2>/dev/null awk export 'quoted text' ${HOME} x=1 sed
+	"$@" export done "$1" readonly "$1" --verbose "$@"
+${HOME} export ${HOME} 2>/dev/null printf test "$@" done "$1" /usr/bin
+		grep 2>/dev/null $(pwd) export readonly readonly
+		printf ${HOME} --verbose test && awk grep $(pwd) -eu 'quoted text'
+		done 2>/dev/null grep done done -eu then -eu done sed done export local | echo
+export awk local 'quoted text' readonly
+	readonly echo printf | export then then "$@" x=1 ${HOME} export 'quoted text'
+	then x=1 -eu $(pwd) 'quoted text' then /usr/bin
+&& x=1 cd --verbose printf then x=1 export -eu 'quoted text' readonly "$1"
+		done then 2>/dev/null | then awk printf test "$1" test local --verbose
+	| grep test && | awk then x=1 ${HOME} | echo /usr/bin
+done grep grep --verbose local /usr/bin --verbose printf -eu grep "$1" ${HOME}
+	export ${HOME} $(pwd) "$1" 2>/dev/null 'quoted text'
+"$@" echo | "$@" printf then --verbose 'quoted text' readonly sed
+	&& test local --verbose
+	echo | 2>/dev/null "$1" 'quoted text' readonly
+	"$1" readonly -eu grep -eu printf export test export | x=1 sed $(pwd) cd "$1"
+		${HOME} "$@" grep && 2>/dev/null 2>/dev/null ${HOME} --verbose 'quoted text'
+		test then ${HOME} 'quoted text' ${HOME} -eu cd printf echo 2>/dev/null
+		then | then && -eu x=1 'quoted text' /usr/bin /usr/bin "$@" 'quoted text' ${HOME}
+done export $(pwd) printf /usr/bin ${HOME} printf
+	"$@" grep echo 'quoted text' awk local
+	awk printf | printf test $(pwd) --verbose readonly
+echo then then && 'quoted text' && x=1 "$@" &&
+	export 2>/dev/null readonly export x=1 ${HOME} --verbose local
+		printf $(pwd) test test local
+local 2>/dev/null && x=1 "$1" echo done
+	grep then test local done /usr/bin --verbose "$1" "$1" ${HOME}
+		test 2>/dev/null -eu
+		/usr/bin awk "$@" sed /usr/bin /usr/bin 'quoted text' test printf "$1" --verbose
+	echo $(pwd) printf "$@" | --verbose --verbose
+&& sed done printf printf -eu /usr/bin 2>/dev/null /usr/bin
+$(pwd) printf ${HOME} /usr/bin
+	$(pwd) --verbose sed ${HOME} --verbose printf $(pwd) awk "$1" done -eu && ${HOME}
+2>/dev/null then | cd 2>/dev/null -eu | awk
+2>/dev/null readonly local ${HOME}
+"$@" grep 'quoted text' &&
+		&& export printf then then sed "$1" 'quoted text' "$@" $(pwd) 'quoted text'
+	'quoted text' awk test cd 2>/dev/null then readonly grep -eu 'quoted text' local
+-eu ${HOME} -eu /usr/bin 'quoted text' x=1 echo ${HOME} then &&
+awk /usr/bin 2>/dev/null readonly
+		grep grep -eu local x=1 "$1" |
+$(pwd) x=1 local ${HOME} $(pwd) x=1
+sed ${HOME} cd "$1" grep export ${HOME} printf && $(pwd) grep $(pwd) test printf
+cd /usr/bin $(pwd) cd sed sed $(pwd)
+| && "$1" sed echo 'quoted text' local ${HOME}
+then && ${HOME} --verbose ${HOME} && -eu 2>/dev/null "$1" --verbose sed cd --verbose
+	export echo then echo local "$@" && readonly && printf ${HOME}
+	/usr/bin | ${HOME} echo then
+		${HOME} export --verbose awk grep printf 2>/dev/null printf
+cd test --verbose readonly ${HOME}
+local awk cd -eu $(pwd) ${HOME} awk "$1"
+echo "$1" | test --verbose export 'quoted text' echo grep done "$@" cd local
+	| "$@" grep "$1" sed echo
+	x=1 ${HOME} grep grep done done done /usr/bin $(pwd)
+	awk ${HOME} 2>/dev/null -eu x=1 'quoted text'
+		readonly | done test grep echo && 'quoted text' awk 2>/dev/null
+	test | x=1 printf echo
+test --verbose $(pwd) sed ${HOME} grep x=1 grep local echo
+		2>/dev/null done local test "$@" awk grep readonly
+2>/dev/null grep x=1 $(pwd) "$1" echo x=1 $(pwd) 'quoted text'
+	test && readonly 2>/dev/null
+"$@" sed $(pwd) cd "$1" readonly && done export
+		| ${HOME} printf /usr/bin test sed
+	"$@" | | grep printf printf $(pwd) readonly test ${HOME} /usr/bin printf
+		| then ${HOME} | echo $(pwd) --verbose
+cd export test done grep && "$@" --verbose
+	2>/dev/null cd 'quoted text' --verbose test $(pwd) local grep | readonly
+	'quoted text' sed done ${HOME} cd /usr/bin
+grep cd && "$@" 2>/dev/null test $(pwd) --verbose cd ${HOME} 2>/dev/null x=1
+		2>/dev/null 2>/dev/null local done x=1 done cd 'quoted text' local "$1"
+	2>/dev/null then grep cd export awk done echo | && "$1" 'quoted text'
+		$(pwd) printf 2>/dev/null "$1" x=1 x=1 local printf printf
+$(pwd) 'quoted text' ${HOME} /usr/bin && "$1" readonly echo test --verbose
+"$1" test /usr/bin && then 'quoted text'
+then -eu readonly printf cd local /usr/bin echo awk test awk then | -eu then
+		grep $(pwd) then x=1 /usr/bin x=1 then "$1" "$1" "$@"
+	test test 'quoted text' $(pwd) done -eu echo "$@" --verbose ${HOME}
+awk -eu /usr/bin && grep readonly && --verbose
+		sed sed test -eu awk --verbose
+${HOME} | then sed grep
+done && printf 'quoted text' -eu && -eu $(pwd) -eu local $(pwd) sed readonly then
+		2>/dev/null x=1 awk then test
+		'quoted text' 2>/dev/null grep export test
+	| x=1 -eu | then && echo awk 2>/dev/null cd -eu /usr/bin sed | readonly
+2>/dev/null ${HOME} $(pwd) export 'quoted text' "$@" readonly
+	x=1 ${HOME} done sed /usr/bin sed local | 2>/dev/null sed
+export test then readonly cd $(pwd) /usr/bin 'quoted text' done
+-eu test cd && 2>/dev/null local
+then "$1" done test echo then 'quoted text' test test done local test done then
+	test $(pwd) grep --verbose then $(pwd) sed && printf
+		x=1 local awk ${HOME} | x=1 test export x=1 | printf awk done done
+		| && "$@" printf then
+	awk -eu test local printf grep && awk x=1 2>/dev/null export ${HOME}
+	grep test done echo -eu then local
+--verbose export --verbose
+"$@" readonly export local readonly
+/usr/bin "$1" grep $(pwd) x=1 -eu --verbose readonly $(pwd) sed then $(pwd)
+printf export sed x=1 'quoted text'
+		2>/dev/null $(pwd) test x=1 | "$1" -eu --verbose
+readonly "$@" 2>/dev/null && /usr/bin $(pwd) "$@" 'quoted text'
+	grep test -eu $(pwd) sed /usr/bin --verbose /usr/bin awk
+	done readonly ${HOME} /usr/bin
+	grep echo cd then 2>/dev/null cd done /usr/bin readonly
+awk && echo $(pwd) -eu then awk ${HOME} sed /usr/bin done --verbose
+	printf sed --verbose local ${HOME} done |
+		awk sed -eu | 2>/dev/null | sed echo printf sed --verbose
+		| && done -eu ${HOME} local 'quoted text' grep &&
+export awk && printf sed 2>/dev/null
+	awk | cd -eu /usr/bin -eu readonly export done &&
+printf -eu awk echo done "$1" /usr/bin
+		-eu echo "$@" local sed grep -eu -eu
+		&& 2>/dev/null /usr/bin printf grep local $(pwd) --verbose done $(pwd) /usr/bin
+'quoted text' ${HOME} ${HOME} echo
+/usr/bin --verbose -eu "$1" done
+grep | /usr/bin readonly
+	sed ${HOME} 'quoted text' ${HOME} "$1" awk done local
+		then /usr/bin sed x=1 export | cd grep then $(pwd) &&
+awk readonly 'quoted text' awk 2>/dev/null --verbose && echo local ${HOME}
+		-eu "$1" ${HOME} x=1 "$1" x=1 cd "$@" printf done --verbose
+/usr/bin | && sed "$@" sed ${HOME} cd --verbose --verbose
+echo | -eu -eu done -eu readonly "$1" done
+grep local export grep echo 'quoted text' 2>/dev/null 2>/dev/null 2>/dev/null
+	| "$@" grep then printf cd export test 2>/dev/null -eu
+echo -eu 'quoted text' echo -eu cd
+then | export ${HOME} x=1 "$@" printf | &&
+test then | local "$@" printf
+	grep | done && echo cd && && done
+'quoted text' --verbose printf && local done awk test
+		printf awk export sed readonly
+		awk "$1" export cd x=1 | local export done 'quoted text' local
+	--verbose printf ${HOME}
+printf $(pwd) export readonly readonly then grep
+	local export 2>/dev/null export ${HOME} "$@" then sed test && cd
+	awk "$1" test cd test local local $(pwd) sed then
+&& x=1 && cd export 'quoted text' | 2>/dev/null
+		readonly "$1" then 'quoted text' done grep sed 2>/dev/null
+'quoted text' "$1" awk grep printf
+grep readonly /usr/bin sed
+		then && "$@" readonly done awk | export -eu
+		-eu sed $(pwd) -eu | 2>/dev/null
+		/usr/bin done done then grep awk grep | 2>/dev/null test
+	&& $(pwd) done awk "$@"
+	sed done ${HOME} ${HOME} grep /usr/bin done 2>/dev/null x=1
+$(pwd) -eu echo ${HOME} grep $(pwd) printf x=1 $(pwd) cd -eu export
+	"$@" 'quoted text' sed then sed
+		sed 'quoted text' printf --verbose done local
+		awk "$1" cd printf "$1" then "$@" awk grep cd $(pwd)
+		grep local /usr/bin printf
+		&& export "$@" ${HOME} test $(pwd) local readonly x=1
+	printf | 'quoted text' | export
+cd export local printf -eu x=1 ${HOME}
+&& grep echo printf x=1 && "$1" ${HOME} && sed test printf grep
+${HOME} && local local export echo --verbose
+		x=1 grep ${HOME} --verbose sed export
+		&& awk printf ${HOME} -eu "$@"
+	awk /usr/bin grep printf "$1" "$@" x=1 export cd /usr/bin awk grep done /usr/bin
+cd done grep sed sed cd cd awk /usr/bin echo done test "$@" -eu
+echo | $(pwd) -eu "$@" -eu "$@" then | |
+	&& awk $(pwd) echo echo awk done /usr/bin x=1 then done then
+		awk 'quoted text' -eu x=1 x=1 2>/dev/null
+printf local "$1" awk test test grep && ${HOME}
+	${HOME} local local | readonly -eu then
+then -eu local cd echo ${HOME} test "$@"
+		"$@" printf test -eu -eu then readonly 'quoted text' 'quoted text' cd "$@" && then
+		${HOME} --verbose | "$1" "$1" sed
+		readonly awk 2>/dev/null echo grep local then echo grep $(pwd)
+	$(pwd) /usr/bin awk then | readonly
+		printf -eu /usr/bin echo grep /usr/bin cd printf -eu
+		/usr/bin x=1 readonly 2>/dev/null 'quoted text'
+	test done local | echo then then -eu "$1" "$@"
+		cd && $(pwd) readonly then
+	${HOME} ${HOME} export echo "$1" then local cd
+		sed "$1" "$1" printf then echo | | x=1 then grep
+		x=1 'quoted text' | ${HOME} | cd awk --verbose 'quoted text' test export
+-eu "$1" local ${HOME} test sed
+test 'quoted text' "$@" ${HOME} /usr/bin && echo then cd 'quoted text' "$1"
+	"$@" "$@" 2>/dev/null awk export --verbose "$1" $(pwd)
+		"$@" "$1" /usr/bin "$1" 'quoted text' readonly then $(pwd) printf /usr/bin
+	awk done readonly "$1" $(pwd)
+		"$1" export && readonly test --verbose ${HOME} grep
+	'quoted text' then /usr/bin test $(pwd) echo then printf
+		grep x=1 $(pwd) awk --verbose local "$@" 'quoted text'
+	x=1 printf readonly /usr/bin
+	&& local /usr/bin 2>/dev/null readonly echo "$@" sed
+		readonly cd echo test --verbose grep
+| awk printf 'quoted text' local x=1 2>/dev/null cd | | test 2>/dev/null
+"$1" 2>/dev/null cd test 2>/dev/null awk
+	2>/dev/null test x=1 && grep 2>/dev/null | -eu /usr/bin /usr/bin /usr/bin
+	$(pwd) readonly && sed printf && /usr/bin $(pwd) done ${HOME} cd --verbose
+	/usr/bin -eu export echo --verbose awk $(pwd)
+		&& | done awk readonly local /usr/bin printf "$1" test local
+	export printf test && cd $(pwd) grep
+local awk --verbose export $(pwd) /usr/bin cd | 'quoted text' echo cd && grep done
+	awk sed sed readonly $(pwd)
+${HOME} sed awk 2>/dev/null printf echo
+-eu x=1 done done sed test 2>/dev/null cd local test
+	then | sed readonly 2>/dev/null
+		export then && "$1" && printf "$@" -eu -eu then grep echo x=1 "$1" $(pwd) then
+	2>/dev/null ${HOME} ${HOME} 'quoted text' printf -eu
+	'quoted text' $(pwd) readonly echo test awk -eu 2>/dev/null echo ${HOME}
+	printf local | /usr/bin echo local local awk done awk
+	'quoted text' awk --verbose grep x=1 test test | $(pwd) awk && | printf
+test -eu cd && cd "$1" 'quoted text'
+"$@" grep sed cd "$1" 2>/dev/null /usr/bin 2>/dev/null
+	then $(pwd) then awk grep awk printf "$1" 'quoted text' readonly "$1" echo
+	$(pwd) printf export && 'quoted text'
+${HOME} | 'quoted text' sed printf
+'quoted text' "$1" done "$1" 2>/dev/null $(pwd) sed --verbose grep -eu 'quoted text'
+	'quoted text' sed -eu | 2>/dev/null --verbose
+	--verbose done local sed then "$@" then local
+	local awk && export $(pwd) 'quoted text' local
+		/usr/bin cd "$1" "$@" local "$@"
+		then x=1 echo readonly --verbose &&
+sed 2>/dev/null local sed cd 2>/dev/null
+		--verbose then x=1 awk | -eu grep "$1" local -eu awk 2>/dev/null
+	grep -eu x=1 "$1" printf /usr/bin echo
+	| printf -eu echo awk "$@" sed echo -eu && awk cd readonly
+	test awk done "$1" && ${HOME} echo -eu $(pwd) 2>/dev/null done --verbose "$@"
+		| $(pwd) "$@" -eu local 2>/dev/null --verbose
+		-eu /usr/bin cd done 2>/dev/null
+	export 'quoted text' awk | test x=1 sed $(pwd) done done cd 'quoted text'
+	then printf done 'quoted text' readonly 'quoted text'
+		awk -eu ${HOME} awk export awk -eu readonly 2>/dev/null test local then
+awk then test -eu test
+		${HOME} done then printf
+${HOME} local done ${HOME} x=1 /usr/bin /usr/bin
+		&& test && 2>/dev/null export --verbose $(pwd) done ${HOME}
+		cd test local /usr/bin then "$1" | ${HOME} -eu | 2>/dev/null done test
+2>/dev/null readonly cd -eu printf
+	&& sed export export local -eu x=1 --verbose
+then $(pwd) ${HOME} export
+local echo 'quoted text' awk export
+readonly export | awk done cd --verbose -eu awk $(pwd) cd echo
+		'quoted text' test export "$@" sed awk "$1"
+	readonly printf -eu 'quoted text'
+"$@" --verbose 'quoted text'
+		-eu done then grep then readonly printf
+awk grep | 'quoted text' grep /usr/bin
+	-eu x=1 2>/dev/null done then grep && then -eu 'quoted text' ${HOME}
+		${HOME} sed echo test awk local | "$@" sed test readonly cd local x=1 | readonly
+test "$@" readonly awk echo --verbose readonly test done readonly
+		"$1" x=1 readonly readonly 2>/dev/null 2>/dev/null
+		"$@" "$@" && done grep readonly && "$@" --verbose -eu
+${HOME} cd then /usr/bin echo "$1" printf -eu cd $(pwd) | --verbose | grep
+		then test | $(pwd) "$1" done | --verbose
+then --verbose $(pwd) local printf local x=1 readonly | test 2>/dev/null local
+	local done -eu x=1 2>/dev/null "$1" then test ${HOME} echo
+&& "$@" "$1" test -eu $(pwd) test && 2>/dev/null
+-eu local test local local cd sed echo
+		/usr/bin "$@" export awk sed test local
+${HOME} 2>/dev/null ${HOME} ${HOME}
+	sed printf --verbose sed | "$@"
+	awk --verbose $(pwd) 2>/dev/null "$1" x=1 --verbose
+		cd "$@" cd --verbose awk cd && /usr/bin && grep | awk /usr/bin
+		$(pwd) grep awk --verbose 2>/dev/null "$@" /usr/bin
+test test done local printf --verbose "$@" grep
+	test local 2>/dev/null $(pwd) sed local --verbose 2>/dev/null $(pwd) local then
+		echo 'quoted text' ${HOME} sed sed | x=1
+	export then 'quoted text' && && echo /usr/bin
+		$(pwd) echo local readonly -eu awk sed /usr/bin 'quoted text'
+sed grep then test cd export /usr/bin "$1" sed grep | $(pwd) grep 2>/dev/null
+		--verbose "$@" export && "$@"
+		export && x=1 awk ${HOME} &&
+		/usr/bin 'quoted text' done 2>/dev/null
+		| export grep echo --verbose then test /usr/bin
+	readonly --verbose "$@" ${HOME} -eu printf grep sed echo local
+then "$1" test "$1" --verbose | cd /usr/bin then printf x=1 test x=1 && printf
+		test export --verbose done grep 'quoted text'
+	grep 'quoted text' sed x=1 test sed local done readonly x=1 2>/dev/null
+	-eu "$@" $(pwd) 'quoted text'
+	$(pwd) "$@" x=1 && readonly
+	test test echo export ${HOME} | export | "$@" local 2>/dev/null --verbose
+		$(pwd) readonly -eu 'quoted text' 2>/dev/null awk $(pwd) ${HOME}
+	/usr/bin printf readonly x=1 "$@"
+	/usr/bin export -eu cd test --verbose local
+	"$1" then local done then then $(pwd) printf
+2>/dev/null 2>/dev/null && test echo ${HOME} 2>/dev/null
+	cd 'quoted text' | test
+${HOME} 2>/dev/null test
+		2>/dev/null grep cd && printf --verbose
+		readonly -eu awk "$1" 'quoted text' sed && --verbose export echo printf export
+awk 'quoted text' awk printf /usr/bin export local sed readonly local
+		awk 'quoted text' local local echo 'quoted text' sed ${HOME} sed x=1 sed grep
+	&& readonly -eu readonly 'quoted text' "$1" grep &&
+		readonly 2>/dev/null readonly "$@" test &&
+2>/dev/null "$1" "$1" -eu 'quoted text' -eu ${HOME} "$1" readonly
+		grep --verbose grep 'quoted text' /usr/bin then -eu awk readonly local
+	export test then ${HOME} 'quoted text' test sed "$@" sed sed echo test test
+	export 2>/dev/null then sed export "$@" 'quoted text'
+		cd grep "$1" 2>/dev/null cd echo "$1" export local 2>/dev/null
+--verbose cd "$1" | --verbose
+		"$1" test x=1 2>/dev/null ${HOME} grep /usr/bin /usr/bin /usr/bin
+	export -eu awk x=1 local export readonly
+		${HOME} && test printf test
+	local then -eu $(pwd) /usr/bin awk cd -eu ${HOME} | 2>/dev/null "$@"
+awk sed 'quoted text' readonly readonly export --verbose echo 'quoted text'
+	test grep cd "$@" $(pwd) --verbose export "$1" "$@" done export test
+	then echo 'quoted text' export /usr/bin done
+&& -eu x=1 2>/dev/null then "$@" printf
+then test x=1 -eu x=1 cd test $(pwd) ${HOME} test sed $(pwd) echo 'quoted text'
+		"$@" 'quoted text' awk --verbose done 'quoted text' ${HOME} 'quoted text'
+readonly -eu "$@" sed /usr/bin grep sed cd ${HOME} readonly $(pwd) | sed
+	"$1" local x=1 -eu 'quoted text' 2>/dev/null
+	done "$1" && done then export && "$1" ${HOME} x=1 sed 2>/dev/null then
+		local grep && && echo readonly /usr/bin grep local $(pwd) done test
+	readonly x=1 $(pwd) sed x=1 ${HOME} echo 2>/dev/null | 2>/dev/null echo awk
+sed awk /usr/bin printf -eu done "$@" "$1"
+	${HOME} done done "$@" 2>/dev/null
+	cd "$@" /usr/bin -eu export | "$1" "$@" local "$1" --verbose
+readonly ${HOME} readonly | "$@" --verbose 2>/dev/null echo && "$@" echo sed
+sed --verbose done "$@" 'quoted text' --verbose --verbose
+&& /usr/bin | sed --verbose --verbose
+		echo x=1 readonly test --verbose
+	then local ${HOME} local export --verbose awk done ${HOME}
+/usr/bin "$@" then readonly /usr/bin --verbose /usr/bin 'quoted text'
+local "$@" 2>/dev/null && -eu
+	done 'quoted text' done test $(pwd) "$1" $(pwd) then export "$1" then printf
+		x=1 done grep "$@" awk /usr/bin local $(pwd) printf
+		echo test | --verbose done local done x=1 --verbose grep echo /usr/bin /usr/bin
+	'quoted text' test "$@" $(pwd) echo | printf $(pwd) sed "$1"
+		cd printf local local /usr/bin test -eu done --verbose echo cd done ${HOME}
+	awk printf 'quoted text' export cd echo printf export && --verbose 2>/dev/null
+local done "$1" ${HOME} test "$@" awk readonly "$1" test && sed sed 2>/dev/null
+		sed 2>/dev/null 'quoted text' $(pwd) "$@" 2>/dev/null
+then /usr/bin readonly readonly awk sed printf test cd &&
+then /usr/bin 'quoted text'
+	echo readonly grep test local 2>/dev/null && && grep
+${HOME} "$@" local sed readonly echo ${HOME} ${HOME} "$@"
+		"$1" && ${HOME} awk ${HOME} ${HOME}
+printf awk -eu $(pwd) --verbose echo
+		then export export && awk done cd 'quoted text' ${HOME}
+		-eu then export $(pwd) -eu | --verbose grep
+	grep printf echo done $(pwd) $(pwd) -eu test 'quoted text'
+-eu awk grep && then 2>/dev/null
+		printf /usr/bin echo test
+x=1 'quoted text' -eu 2>/dev/null
+-eu && --verbose ${HOME}
+	printf local cd grep /usr/bin | printf 2>/dev/null 2>/dev/null echo test local
+	done test test sed 2>/dev/null test local "$@" "$1" sed -eu
+'quoted text' export 2>/dev/null test && --verbose --verbose then | -eu 'quoted text'
+		printf echo export awk local -eu x=1 --verbose x=1 sed awk && test "$@" awk cd
+done printf "$@" x=1 export
+&& test --verbose 2>/dev/null
+	"$@" 2>/dev/null && /usr/bin
+		printf printf sed -eu echo grep x=1 echo local
+		/usr/bin "$1" x=1 export && | local 2>/dev/null then $(pwd) then ${HOME} x=1
+		then awk echo 2>/dev/null
+		"$@" --verbose local 'quoted text' then cd 'quoted text' export
+	x=1 'quoted text' $(pwd) test echo -eu test sed /usr/bin "$@"
+		sed local done /usr/bin && export 2>/dev/null "$@" export then sed then export printf
+		'quoted text' "$@" echo ${HOME} "$@" sed |
+then done 2>/dev/null done readonly readonly
+echo $(pwd) ${HOME} cd done "$1" /usr/bin grep readonly sed && readonly awk export
+$(pwd) readonly ${HOME} local $(pwd) $(pwd) grep $(pwd) sed
+		"$@" local 'quoted text'
+		$(pwd) echo printf $(pwd) done x=1 "$1" ${HOME} 2>/dev/null echo export echo
+	-eu ${HOME} -eu && 'quoted text' | --verbose
+		printf "$@" done then -eu cd "$1" export "$1" 'quoted text' cd -eu export cd
+/usr/bin local awk "$1" && "$@" grep | echo x=1 $(pwd) x=1 $(pwd) | grep 2>/dev/null
+		/usr/bin sed done "$1" then echo sed $(pwd) &&
+	&& printf "$@" local ${HOME} grep test export
+		then "$1" -eu readonly /usr/bin && readonly cd local $(pwd) --verbose echo readonly
+		"$1" local 'quoted text' local then
+		echo done export echo "$@" then test "$1" "$@" printf "$1" grep done
+		"$@" awk then $(pwd) export awk local done && grep
+export grep test ${HOME} 'quoted text' done "$1" export echo readonly
+	x=1 echo x=1 local echo
+$(pwd) 2>/dev/null --verbose && /usr/bin awk --verbose
+	'quoted text' cd $(pwd) export | printf --verbose
+--verbose cd echo then "$@" x=1 sed | test grep
+'quoted text' echo then local x=1 echo -eu readonly
+	| cd "$1" --verbose ${HOME} printf --verbose
+	awk -eu export done 2>/dev/null done export $(pwd) grep cd x=1 export
+	"$@" x=1 /usr/bin 'quoted text'
+	/usr/bin printf $(pwd) "$@" 'quoted text' printf export x=1 ${HOME} printf
+		export awk done export "$@" "$@"
+	-eu $(pwd) test --verbose && "$@" echo awk grep sed "$@"
+	then sed $(pwd) /usr/bin then awk echo then sed
+	/usr/bin /usr/bin test 'quoted text'
+		echo --verbose test ${HOME} awk "$1" local --verbose /usr/bin local export
+awk readonly ${HOME} sed | $(pwd) -eu sed printf cd &&
+local | 2>/dev/null -eu readonly then && readonly done 2>/dev/null
+		"$@" /usr/bin cd $(pwd) local x=1 x=1 cd $(pwd) x=1 "$1" export 2>/dev/null
+printf local /usr/bin export local /usr/bin
+	2>/dev/null --verbose && /usr/bin x=1 ${HOME}
+	| -eu local test local "$@" cd | export "$@"
+		-eu printf export "$@" printf
+	2>/dev/null test awk then 2>/dev/null echo ${HOME} -eu
+	cd x=1 -eu grep "$@" --verbose
+		"$@" x=1 test awk -eu "$@" readonly --verbose 'quoted text' readonly $(pwd) echo
+sed x=1 grep grep "$1" ${HOME} echo "$@"
+| && 2>/dev/null echo grep grep
+		cd "$@" local "$1" awk | "$@" grep | $(pwd)
+		done done /usr/bin export "$@" then sed "$1" 'quoted text' readonly
+		/usr/bin echo 'quoted text' grep test | printf
+test x=1 2>/dev/null readonly awk echo ${HOME} test -eu cd echo --verbose
+sed readonly awk x=1 && cd && && local 2>/dev/null awk readonly
+	$(pwd) "$@" /usr/bin export local echo grep echo 'quoted text'
+	then x=1 done local 'quoted text' ${HOME} --verbose local --verbose
+	2>/dev/null echo echo $(pwd) echo "$1" export echo echo export then export test
+		then --verbose x=1 readonly local printf "$1"
+--verbose grep cd | awk test 'quoted text'
+	--verbose sed $(pwd) $(pwd) "$@" ${HOME} readonly
+readonly 'quoted text' printf echo readonly 2>/dev/null
+		test ${HOME} done "$@" sed export local
+	done /usr/bin grep 2>/dev/null cd
+	done /usr/bin $(pwd) x=1 awk test local 'quoted text' 'quoted text'
+	test test 2>/dev/null echo -eu
+		echo test local test x=1 'quoted text' ${HOME} printf
+export export --verbose --verbose cd local -eu printf 'quoted text'
+then grep echo local --verbose
+printf done $(pwd) export readonly echo | /usr/bin /usr/bin 'quoted text'
+		export $(pwd) ${HOME} readonly export export $(pwd) done $(pwd) -eu
+	done | local -eu sed test awk local local cd echo ${HOME} -eu echo
+	done ${HOME} then && printf grep readonly grep
+printf export test done $(pwd) test printf awk /usr/bin
+		cd grep local -eu 'quoted text' | cd awk echo | local 'quoted text' echo echo
+printf ${HOME} 'quoted text' "$@" -eu --verbose grep -eu test awk readonly
+"$@" x=1 awk awk 2>/dev/null -eu --verbose 'quoted text'
+	test /usr/bin --verbose echo 2>/dev/null /usr/bin local sed sed && local test
+	awk -eu cd local | --verbose export "$@"
+	awk grep 'quoted text' && grep printf 'quoted text'
+		&& test cd | /usr/bin cd printf echo /usr/bin local sed "$@"
+echo 'quoted text' 'quoted text' test done /usr/bin done
+	grep && test && sed then printf export --verbose "$1" $(pwd) ${HOME} grep
+	done 'quoted text' && echo export /usr/bin export readonly
+	${HOME} x=1 sed x=1 sed x=1 readonly ${HOME} then --verbose 2>/dev/null
+printf awk "$@" done ${HOME} sed grep then 'quoted text' -eu /usr/bin done grep
+	local awk /usr/bin export "$@" -eu sed then 2>/dev/null -eu 2>/dev/null "$@"
+	cd done ${HOME} test echo -eu echo && ${HOME} $(pwd) echo | export
+done $(pwd) x=1 2>/dev/null && cd local /usr/bin -eu done
+-eu local | awk $(pwd) awk local grep test
+	printf --verbose printf test done --verbose -eu 'quoted text' $(pwd) x=1 local
+&& grep awk "$@" echo x=1 $(pwd) "$@" cd
+	then 2>/dev/null $(pwd) x=1 && readonly export
+'quoted text' | done "$@" grep ${HOME} x=1 -eu awk "$@" then cd
+&& "$1" 2>/dev/null readonly /usr/bin sed "$1" | then 'quoted text'
+$(pwd) 'quoted text' /usr/bin awk echo local 'quoted text' -eu "$@" && /usr/bin
+	| "$1" local 2>/dev/null then export "$1" done readonly
+	grep grep cd "$1" | printf -eu x=1 sed test local -eu x=1
+	test awk local cd "$1" grep ${HOME} export | | | echo
+	grep && done printf local local -eu | done
+${HOME} /usr/bin echo export && $(pwd)
+then && -eu 2>/dev/null /usr/bin sed test
+		$(pwd) "$1" "$@" echo 2>/dev/null done
+--verbose --verbose "$@" x=1 | grep echo then readonly export && then 'quoted text'
+	2>/dev/null -eu sed x=1 --verbose
+	sed local export 'quoted text' && echo awk --verbose local printf
+	cd $(pwd) 2>/dev/null -eu -eu export /usr/bin cd $(pwd) ${HOME}
+	${HOME} 2>/dev/null 2>/dev/null local
+	$(pwd) x=1 "$1" awk export test ${HOME} | readonly $(pwd) 2>/dev/null
+	--verbose "$1" "$@" test readonly x=1 x=1
+	/usr/bin awk cd 2>/dev/null printf | "$@" "$@" readonly "$1"
+		local test test | echo "$@" $(pwd)
+		done ${HOME} echo 'quoted text' $(pwd) cd local awk readonly
+	'quoted text' $(pwd) echo printf test cd printf x=1 x=1 grep
+	$(pwd) then "$@" 2>/dev/null printf && then "$1" local readonly echo
+		cd "$1" 'quoted text' test done && grep test awk "$@" cd grep $(pwd)
+/usr/bin ${HOME} cd "$@"
+2>/dev/null export 'quoted text' readonly
+	cd printf done 2>/dev/null echo | 'quoted text' local
+	sed grep test /usr/bin $(pwd) test echo awk then grep ${HOME} x=1 /usr/bin printf
+	echo --verbose -eu then x=1 readonly "$1" printf local 2>/dev/null done 'quoted text'
+	2>/dev/null printf test test 'quoted text' cd "$@" "$1" x=1
+	cd 2>/dev/null --verbose sed
+		x=1 printf /usr/bin grep sed done printf "$1" grep
+		local cd && local test && && grep 2>/dev/null
+		cd grep "$@" test printf readonly 2>/dev/null 2>/dev/null
+	sed export --verbose sed --verbose
+	"$@" local export x=1 then $(pwd)
+	export --verbose done awk "$@" readonly grep done then export
+		$(pwd) grep --verbose then --verbose grep done | 'quoted text' test --verbose
+	| -eu local x=1 && "$1" grep awk /usr/bin export test then export
+--verbose ${HOME} "$1" $(pwd) 2>/dev/null echo sed
+	echo echo then local local ${HOME} && "$1" /usr/bin /usr/bin
+	'quoted text' $(pwd) local 2>/dev/null $(pwd)
+		test "$@" ${HOME} local done readonly
+	readonly printf "$@" printf /usr/bin ${HOME} "$1" printf test -eu | cd printf
+		echo "$@" | 'quoted text' -eu local 'quoted text' printf awk then "$1" x=1 cd
+'quoted text' test -eu awk grep local "$@" --verbose grep | then &&
+	| cd echo -eu $(pwd) export test then ${HOME} x=1 ${HOME} && 'quoted text' -eu
+		test && done done && "$@" 'quoted text'
+		"$1" x=1 $(pwd) /usr/bin "$1" export
+		echo "$1" export | readonly local | "$1" 2>/dev/null local /usr/bin
+2>/dev/null /usr/bin sed ${HOME}
+done grep sed $(pwd) $(pwd) then export done --verbose local ${HOME} /usr/bin
+local --verbose "$@" "$1"
+		printf test then | 2>/dev/null awk "$@"
+		export /usr/bin "$1" done awk printf echo 2>/dev/null && -eu export
+	| --verbose 'quoted text' 2>/dev/null --verbose cd --verbose
+	readonly local export test
+readonly done grep --verbose --verbose test
+	sed 2>/dev/null x=1 'quoted text' $(pwd)
+	&& && echo echo echo done printf local ${HOME} test "$1" | echo sed readonly
+| 2>/dev/null && export printf 2>/dev/null readonly export
+export 2>/dev/null "$1" sed awk done cd done | local done && && "$@" printf --verbose
+'quoted text' && x=1 /usr/bin
+		grep grep $(pwd) ${HOME} awk cd then 2>/dev/null "$1" "$1"
+$(pwd) && echo --verbose local sed |
+	2>/dev/null "$@" "$@" ${HOME} --verbose -eu local
+		done printf --verbose $(pwd) export "$@" $(pwd) local $(pwd)
+	/usr/bin printf 2>/dev/null test /usr/bin awk /usr/bin awk
+echo cd sed cd grep then local x=1 awk /usr/bin | --verbose
+		&& printf local "$@" test | "$@"
+		| -eu ${HOME} && 2>/dev/null
+		2>/dev/null readonly x=1 'quoted text' --verbose readonly 'quoted text'
+	-eu export && echo printf sed 2>/dev/null readonly --verbose
+-eu awk "$@" echo echo local done echo && then
+	echo -eu readonly then ${HOME} "$1" awk done printf
+	test then local grep -eu -eu ${HOME} printf
+		${HOME} local "$1" sed export x=1 awk printf cd awk
+then then "$@" && ${HOME} local
+"$@" grep "$@" test x=1 && 2>/dev/null sed printf export &&
+&& 2>/dev/null grep 2>/dev/null cd x=1 export $(pwd) local "$1"
+		$(pwd) then export export
+	&& readonly local /usr/bin
+${HOME} echo --verbose then echo -eu
+	'quoted text' export 2>/dev/null done done $(pwd) x=1 grep -eu done printf
+	printf awk | ${HOME} readonly cd | grep 'quoted text'
+	--verbose 'quoted text' x=1 readonly "$@" ${HOME} export "$1" /usr/bin sed
+		2>/dev/null then then /usr/bin
+/usr/bin done | "$@" | 2>/dev/null x=1 test grep ${HOME} readonly ${HOME} 'quoted text'
+	local /usr/bin grep local x=1 --verbose local "$@" cd 'quoted text'
+		"$1" 'quoted text' --verbose | && export
+	export -eu && printf --verbose 2>/dev/null awk export "$1" ${HOME}
+grep -eu /usr/bin "$@" ${HOME} sed cd "$@" --verbose echo 2>/dev/null
+	$(pwd) "$1" local cd x=1 /usr/bin
+		then 2>/dev/null test /usr/bin grep then "$@" --verbose
+	| export "$@" awk "$1" printf --verbose
+	export local $(pwd) sed cd awk export -eu /usr/bin awk printf /usr/bin
+		"$1" sed awk local "$1" printf "$@" ${HOME} test "$1" "$1" sed /usr/bin
+	'quoted text' export ${HOME} sed | | echo done readonly
+		sed /usr/bin /usr/bin local ${HOME} local 'quoted text'
+| 2>/dev/null && x=1 2>/dev/null test && sed && then && export test "$@"
+		${HOME} echo | 'quoted text'
+--verbose 'quoted text' awk
+		readonly 'quoted text' export ${HOME} && awk -eu local && sed x=1 | then
+		cd 'quoted text' readonly /usr/bin done /usr/bin $(pwd) then
+	$(pwd) local --verbose && x=1 export then cd "$1" then /usr/bin 'quoted text'
+echo awk | export | awk --verbose | then then done && export
+	--verbose "$1" done 'quoted text' export | 2>/dev/null sed sed awk
+		${HOME} "$1" --verbose | sed --verbose ${HOME} $(pwd)
+	done 2>/dev/null /usr/bin && readonly sed $(pwd) cd -eu test 'quoted text'
+sed | local local export readonly x=1 cd --verbose echo local 'quoted text'
+	done "$@" /usr/bin /usr/bin export
+	"$1" /usr/bin cd printf printf printf export cd
@@ -0,0 +1,2001 @@
+echo awk awk -eu local grep test 2>/dev/null test "$1"
+${HOME} x=1 "$1" "$1" grep then "$1" /usr/bin
+local --verbose /usr/bin x=1 test
+done echo 2>/dev/null "$1"
+		--verbose printf x=1 && $(pwd) export export
+	printf local sed sed local -eu test
+/usr/bin grep then grep export /usr/bin "$@" readonly 2>/dev/null echo awk
+readonly 'quoted text' export 2>/dev/null printf readonly
+		done | export -eu | local done then then then x=1 echo sed
+	/usr/bin x=1 cd sed readonly x=1 --verbose /usr/bin
+	readonly local $(pwd) "$@" | ${HOME} sed printf local
+readonly awk sed test printf done then done local sed $(pwd) ${HOME} export readonly
+		test | | --verbose "$1" grep ${HOME}
+	-eu export ${HOME} awk then "$1" printf x=1 export done test "$1"
+		done $(pwd) done $(pwd) /usr/bin "$@" x=1 /usr/bin --verbose "$@" grep
+		local cd echo ${HOME} sed local cd ${HOME} test grep local &&
+		-eu grep cd -eu printf done "$1" echo cd done cd
+test local 2>/dev/null x=1 done ${HOME} && done $(pwd) cd 'quoted text'
+		echo -eu ${HOME} printf cd "$@" "$1" test then done readonly echo export
+		test local echo awk local -eu printf cd x=1 echo then test
+local "$1" "$1" /usr/bin /usr/bin "$@" grep readonly x=1 -eu then awk
+		${HOME} cd export sed awk echo 2>/dev/null | "$1" export /usr/bin done then ${HOME}
+		then ${HOME} echo /usr/bin local --verbose sed export then export
+	test test | awk test readonly "$@" -eu && -eu --verbose 2>/dev/null echo $(pwd)
+	echo 2>/dev/null export then
+		$(pwd) "$1" done --verbose
+	x=1 ${HOME} export sed --verbose printf 'quoted text' test done "$1" export
+	"$1" sed 'quoted text' done | "$@" "$@" $(pwd) local | export
+	grep local echo local /usr/bin printf printf "$@" -eu sed
+		readonly /usr/bin $(pwd) then local printf sed -eu local -eu
+	"$@" ${HOME} "$@" /usr/bin readonly grep printf cd
+		export 'quoted text' echo ${HOME} grep sed
+		test --verbose then printf grep then export readonly
+		$(pwd) -eu --verbose && then ${HOME}
+	local $(pwd) readonly local grep "$1" /usr/bin
+-eu $(pwd) && x=1 readonly "$1" $(pwd) x=1 awk export local $(pwd) cd ${HOME}
+sed ${HOME} | ${HOME} "$@" $(pwd) echo
+	export printf 'quoted text' done 2>/dev/null 'quoted text'
+local 2>/dev/null | $(pwd) sed
+"$1" export cd sed sed ${HOME} "$1" awk sed cd export then cd test done
+awk export --verbose "$1" local 2>/dev/null -eu cd x=1 printf local 'quoted text'
+	then | echo "$1" grep grep $(pwd) | then -eu readonly
+	--verbose awk -eu test printf "$@" printf /usr/bin then test -eu $(pwd) then
+awk printf test echo test $(pwd)
+| local awk -eu "$1" export local sed echo && --verbose
+		${HOME} | echo -eu sed $(pwd) echo sed test "$@"
+${HOME} printf sed x=1 export
+&& $(pwd) "$1" | local test 2>/dev/null echo awk && awk awk grep
+		printf printf cd test --verbose cd export "$@" -eu test /usr/bin
+$(pwd) -eu cd readonly $(pwd) "$1" --verbose 2>/dev/null 2>/dev/null
+	then test done local "$@" "$@" "$1" "$1" "$@" "$1" printf
+grep -eu local | /usr/bin "$@" -eu --verbose echo $(pwd) grep && 'quoted text'
+"$1" 'quoted text' && /usr/bin done echo $(pwd) | && printf
+awk $(pwd) ${HOME} test then -eu local then 'quoted text'
+		"$@" 2>/dev/null $(pwd) 'quoted text' && printf /usr/bin awk then "$@" test 'quoted text'
+	-eu $(pwd) ${HOME} "$1" --verbose test
+		2>/dev/null printf "$1" test | ${HOME} echo done sed done | echo echo x=1 "$1"
+'quoted text' export 'quoted text' && /usr/bin readonly
+		echo printf "$1" && then done -eu -eu local printf printf local | sed x=1 test
+		${HOME} sed 'quoted text' sed awk | -eu printf x=1 $(pwd) && local && ${HOME}
+		test -eu 2>/dev/null echo /usr/bin echo && -eu "$@" "$@" --verbose printf printf
+	done printf grep export then readonly --verbose then 2>/dev/null -eu ${HOME}
+	readonly export "$@" export grep /usr/bin
+x=1 /usr/bin ${HOME} cd echo then
+	$(pwd) cd export cd x=1 grep 'quoted text' $(pwd)
+	'quoted text' 'quoted text' x=1 'quoted text'
+		"$@" -eu readonly readonly local "$@" "$@" | printf "$@" 'quoted text' x=1
+	grep readonly grep echo readonly
+	export $(pwd) cd 2>/dev/null cd echo
+		$(pwd) cd sed cd cd "$@" | && grep grep export
+	'quoted text' cd "$@" test x=1 "$1" echo cd sed && readonly
+	--verbose local then then echo | &&
+	test awk -eu readonly 2>/dev/null
+	| echo export --verbose --verbose awk then printf then
+${HOME} 2>/dev/null printf test
+readonly /usr/bin ${HOME} then 'quoted text'
+		/usr/bin --verbose export cd done 2>/dev/null
+export done sed cd echo "$1" 'quoted text' $(pwd) sed
+		grep && readonly /usr/bin printf ${HOME} "$@" readonly 2>/dev/null
+'quoted text' /usr/bin printf printf | --verbose done x=1 2>/dev/null local export
+		--verbose "$@" cd 2>/dev/null
+		&& readonly cd && "$@" grep /usr/bin
+--verbose -eu cd ${HOME} ${HOME} $(pwd)
+	export ${HOME} sed readonly awk test --verbose readonly $(pwd)
+grep -eu x=1 && echo ${HOME} ${HOME} then
+	then /usr/bin export export x=1 cd "$1" sed
+awk echo 2>/dev/null grep
+		'quoted text' 'quoted text' then && sed $(pwd) 2>/dev/null
+	&& test test ${HOME} awk sed ${HOME} grep sed then /usr/bin /usr/bin then
+then --verbose sed "$1" printf test ${HOME} done
+		readonly "$1" "$@" echo 2>/dev/null then 'quoted text'
+	awk awk sed -eu grep x=1 readonly readonly test grep --verbose "$@" cd export readonly
+--verbose test --verbose "$@"
+		export readonly cd /usr/bin && test export -eu -eu readonly | 2>/dev/null
+local sed cd export 'quoted text' $(pwd) printf readonly /usr/bin sed /usr/bin
+	done 2>/dev/null "$@" done readonly done printf x=1 x=1 ${HOME} ${HOME} "$@"
+		printf ${HOME} 'quoted text'
+	"$1" test /usr/bin --verbose done local awk | 2>/dev/null
+		grep export done --verbose export 2>/dev/null sed grep cd grep 'quoted text'
+		then && cd echo echo &&
+local done grep "$@" $(pwd) cd
+echo local printf done $(pwd) printf /usr/bin
+	grep printf awk 'quoted text' | then readonly readonly "$@"
+		"$@" readonly awk && 'quoted text' then ${HOME} test
+	test | | printf done local test $(pwd) echo --verbose readonly
+		${HOME} then /usr/bin test printf ${HOME}
+		'quoted text' then x=1 awk cd local local /usr/bin
+		$(pwd) "$1" ${HOME} $(pwd) 'quoted text' "$@" export printf | export |
+local -eu export export done grep -eu "$@" cd 'quoted text'
+		"$@" readonly awk cd && sed --verbose sed printf printf
+		export && && /usr/bin --verbose
+		"$@" --verbose /usr/bin 'quoted text' --verbose test "$@" $(pwd) $(pwd) "$@"
+awk x=1 done --verbose export x=1 --verbose
+		local 2>/dev/null then
+	grep test awk awk -eu awk | awk /usr/bin
+then /usr/bin --verbose ${HOME} cd $(pwd) -eu 2>/dev/null cd echo then printf x=1
+export "$1" sed x=1 cd /usr/bin
+	export -eu x=1 x=1 -eu
+export test && printf --verbose && readonly 2>/dev/null
+		--verbose awk | ${HOME} readonly "$1" printf x=1 -eu &&
+	-eu ${HOME} local && | && export 'quoted text' awk | && /usr/bin
+		2>/dev/null --verbose grep readonly
+echo echo printf -eu grep
+		-eu cd readonly 2>/dev/null then
+	export $(pwd) && 'quoted text'
+		export sed awk echo test grep awk local && then
+		${HOME} awk readonly echo | && -eu echo
+export awk --verbose && export x=1 done
+	/usr/bin && x=1 && --verbose
+done done /usr/bin ${HOME} awk x=1 echo x=1 then
+		printf echo && && awk readonly &&
+		awk ${HOME} ${HOME} sed test x=1 echo -eu echo test
+	test x=1 echo -eu "$@" sed awk "$@" done $(pwd) readonly ${HOME}
+${HOME} readonly done test done cd export local local awk
+-eu | printf test -eu "$1" 2>/dev/null printf
+	echo awk sed sed test "$1" cd export -eu
+"$@" | -eu grep ${HOME} | export
+	awk /usr/bin done done export 2>/dev/null "$@" grep --verbose local
+	then -eu echo --verbose readonly "$@" sed export
+	$(pwd) grep "$@" awk awk readonly
+		-eu then && cd awk echo x=1 "$1" done $(pwd)
+then 2>/dev/null printf 2>/dev/null
+sed then readonly ${HOME} local awk 'quoted text'
+		/usr/bin "$1" -eu --verbose -eu printf then $(pwd) ${HOME} --verbose
+	sed $(pwd) done 2>/dev/null 2>/dev/null readonly
+		done --verbose awk readonly -eu awk /usr/bin /usr/bin
+		&& "$1" then test -eu done | $(pwd) then export echo
+	cd grep /usr/bin 2>/dev/null echo awk cd --verbose
+		${HOME} /usr/bin grep sed sed "$1" local
+		${HOME} x=1 echo awk | "$1" readonly $(pwd) sed local local "$@" "$@" printf $(pwd)
+		'quoted text' local then -eu --verbose
+		'quoted text' ${HOME} printf $(pwd) 'quoted text' done done export
+&& | local cd --verbose "$1" 2>/dev/null export
+	$(pwd) 2>/dev/null export 2>/dev/null --verbose "$@" readonly
+		sed printf ${HOME} "$1" 2>/dev/null
+awk "$@" test readonly sed "$1" done then |
+		grep 'quoted text' grep --verbose test then done ${HOME}
+"$@" $(pwd) --verbose | "$1" printf --verbose "$@" "$@" grep readonly
+2>/dev/null test x=1 awk printf cd local printf | ${HOME} x=1 "$@" -eu $(pwd)
+		echo done done 'quoted text'
+		--verbose ${HOME} "$@" echo x=1 awk export "$@" cd
+		printf cd /usr/bin grep ${HOME} printf
+cd /usr/bin $(pwd) echo done | /usr/bin $(pwd) | -eu /usr/bin
+	--verbose $(pwd) && test $(pwd)
+| echo x=1 then "$@" echo && $(pwd) 'quoted text' 'quoted text'
+	| grep readonly "$1" local -eu sed 2>/dev/null sed $(pwd) then echo local /usr/bin
+	"$@" done x=1 'quoted text' ${HOME} grep printf
+		2>/dev/null --verbose echo && ${HOME} then && "$1" 2>/dev/null ${HOME} --verbose
+echo -eu x=1 awk done readonly /usr/bin then test
+	printf 2>/dev/null "$@" printf done x=1 export && export /usr/bin
+		--verbose "$@" 2>/dev/null -eu --verbose done ${HOME} cd 2>/dev/null | awk
+	grep -eu printf x=1 2>/dev/null done then done then -eu /usr/bin $(pwd) test
+		&& local "$@" | export 'quoted text' cd test /usr/bin /usr/bin
+		'quoted text' export 2>/dev/null
+	x=1 test --verbose echo 'quoted text' "$@" x=1 test export
+		&& cd echo sed /usr/bin then $(pwd) --verbose grep then ${HOME}
+	| done printf awk "$@" --verbose --verbose ${HOME} sed /usr/bin local
+		sed export sed $(pwd) && "$1" then echo
+local cd $(pwd) | "$1" test
+2>/dev/null grep && 'quoted text' done
+		"$@" then --verbose readonly
+	grep test export sed x=1 awk --verbose export
+		local x=1 "$1" awk | grep awk 'quoted text'
+		$(pwd) /usr/bin readonly grep | grep ${HOME}
+		'quoted text' then grep done "$@" ${HOME} then $(pwd) 2>/dev/null /usr/bin
+	local readonly x=1 && sed $(pwd) awk | printf cd awk | echo
+		sed 'quoted text' done 'quoted text' echo --verbose awk printf -eu
+	export -eu cd local /usr/bin "$@"
+	cd sed grep grep 2>/dev/null "$1" "$@" sed "$@" echo readonly
+	/usr/bin --verbose /usr/bin | 'quoted text'
+		"$1" 'quoted text' 'quoted text' printf "$1" 'quoted text'
+		echo /usr/bin 2>/dev/null readonly awk --verbose $(pwd) "$@" awk --verbose
+	sed readonly | local 2>/dev/null test $(pwd) test --verbose
+	echo --verbose local printf sed sed $(pwd) /usr/bin
+		printf 2>/dev/null then test ${HOME} x=1 echo --verbose
+	printf test test ${HOME} 'quoted text' /usr/bin && 'quoted text'
+x=1 done "$1" echo cd test test && echo done awk ${HOME}
+"$1" 2>/dev/null x=1 &&
+		/usr/bin "$@" export "$@" printf 'quoted text'
+	-eu ${HOME} export | ${HOME} awk
+${HOME} /usr/bin /usr/bin
+	'quoted text' "$@" $(pwd) awk 'quoted text'
+		local 'quoted text' cd readonly "$@" x=1 echo && && local | 'quoted text'
+test awk /usr/bin printf $(pwd) readonly && "$@" test
+	2>/dev/null cd echo awk done printf 2>/dev/null readonly cd readonly
+		done -eu -eu printf 2>/dev/null done --verbose
+	echo "$1" "$@" sed readonly readonly sed
+	printf | | readonly /usr/bin echo export grep awk /usr/bin
+	"$1" && test /usr/bin grep -eu -eu test grep x=1 printf "$@" ${HOME} sed
+		test -eu sed local --verbose local then -eu cd export | $(pwd)
+		'quoted text' test /usr/bin readonly printf grep "$@" readonly
+	${HOME} $(pwd) cd 'quoted text' readonly
+local readonly export | | | grep awk printf local --verbose "$1" awk 2>/dev/null
+local 'quoted text' $(pwd) awk local --verbose echo
+		${HOME} echo grep grep export "$1" 2>/dev/null /usr/bin echo then -eu
+	grep /usr/bin "$@" && export grep x=1
+	2>/dev/null && readonly done "$@" then -eu awk ${HOME}
+	/usr/bin | | "$@" export -eu echo ${HOME} export local echo readonly awk $(pwd)
+| && | sed ${HOME} sed ${HOME} "$1" then -eu 'quoted text'
+		sed test "$1" sed awk readonly awk "$1" sed ${HOME} "$1" then
+	done export /usr/bin ${HOME} then test grep local printf | then done
+echo $(pwd) -eu 2>/dev/null awk local then x=1 ${HOME} cd readonly echo "$@"
+cd 2>/dev/null ${HOME} done readonly sed "$1" awk -eu
+	export awk 'quoted text' |
+		| 2>/dev/null && test echo 'quoted text' readonly done readonly then test
+		readonly ${HOME} printf $(pwd) export "$@" readonly then "$@" test then
+test awk -eu echo printf
+	printf | 2>/dev/null printf test then printf "$@" then sed
+	${HOME} grep "$@" test done local 2>/dev/null 2>/dev/null
+'quoted text' /usr/bin printf readonly 2>/dev/null "$1" readonly
+	grep echo -eu test x=1 awk --verbose done awk export export $(pwd) "$1" /usr/bin
+	"$@" "$@" && /usr/bin | --verbose /usr/bin
+	'quoted text' && "$@" sed local &&
+done "$@" export ${HOME} export grep sed grep then sed then awk
+	readonly export 2>/dev/null && local test && "$1" "$@" ${HOME} 2>/dev/null
+	export export export && -eu
+	'quoted text' 'quoted text' 'quoted text' &&
+		'quoted text' then done x=1 export "$1" test && | export
+${HOME} echo local && echo ${HOME} "$@" done printf
+		readonly | /usr/bin printf export 'quoted text' x=1 /usr/bin
+echo sed test 2>/dev/null /usr/bin grep sed -eu readonly sed echo ${HOME} awk
+	then /usr/bin awk | done 'quoted text' awk --verbose && x=1 'quoted text' local
+"$1" ${HOME} cd ${HOME} grep awk sed | done "$@"
+sed local echo x=1 export 2>/dev/null grep done "$1" ${HOME} cd ${HOME} "$1"
+		test -eu sed readonly x=1 export x=1 awk "$1" then echo "$1" --verbose | x=1
+		-eu x=1 -eu printf grep | "$1" then | -eu "$1"
+${HOME} && local local done done -eu x=1 $(pwd) 'quoted text' 2>/dev/null
+	local ${HOME} 'quoted text'
+	awk "$@" --verbose ${HOME} awk
+	| sed done x=1 $(pwd) done sed cd x=1 'quoted text'
+		--verbose echo ${HOME} grep printf
+echo echo local cd local
+		&& printf "$@" ${HOME} 2>/dev/null
+		/usr/bin 'quoted text' x=1 2>/dev/null printf && done |
+		local "$1" $(pwd) x=1 readonly "$1"
+		printf grep cd --verbose 'quoted text' test export sed
+		awk | -eu ${HOME} && /usr/bin printf
+		"$@" readonly x=1 local grep "$1" ${HOME} local 2>/dev/null export $(pwd) $(pwd)
+	x=1 readonly test cd export test test "$1" cd test sed echo --verbose awk done
+		--verbose readonly readonly 'quoted text' test
+	test then "$1" export "$1" sed --verbose /usr/bin | ${HOME} "$1" $(pwd)
+"$1" then sed -eu $(pwd) readonly awk readonly ${HOME} done echo
+		${HOME} x=1 "$@" 2>/dev/null "$@" ${HOME}
+	--verbose | grep awk echo
+		echo done ${HOME} export /usr/bin --verbose 'quoted text' local -eu then
+$(pwd) export done x=1 'quoted text' "$1" -eu export 'quoted text' "$1" test
+awk grep "$@" "$@" /usr/bin x=1 done $(pwd) | cd then
+--verbose x=1 done then /usr/bin cd export local cd local local local /usr/bin
+		x=1 x=1 printf echo "$@" printf echo then ${HOME} then 'quoted text' local x=1
+		grep printf 2>/dev/null awk test /usr/bin local grep -eu ${HOME} then 'quoted text'
+printf local then awk /usr/bin "$1" printf test -eu ${HOME} ${HOME} --verbose
+x=1 --verbose printf $(pwd)
+export $(pwd) && ${HOME} export sed --verbose
+'quoted text' -eu done awk awk readonly printf test grep
+	echo test "$1" local local cd 2>/dev/null 2>/dev/null "$@" /usr/bin echo then
+		local | && | test test ${HOME} && local x=1 | cd then local /usr/bin
+	2>/dev/null ${HOME} "$@" done echo printf cd sed export done then
+		-eu cd cd x=1 awk "$@" local done "$@" cd 'quoted text' ${HOME} $(pwd) test
+		then test $(pwd) ${HOME} readonly grep 2>/dev/null && local
+--verbose test ${HOME} export "$@" printf "$1" /usr/bin 'quoted text' grep export
+printf "$@" echo "$1" ${HOME} test test export printf --verbose ${HOME}
+		-eu 'quoted text' "$@" sed readonly
+		"$@" awk $(pwd) -eu echo | -eu
+		-eu "$@" readonly && echo $(pwd) $(pwd) test
+		done cd local "$@" -eu readonly x=1 echo 2>/dev/null test done /usr/bin
+awk done readonly then -eu printf
+	&& done test "$@" 'quoted text' | grep x=1 then
+	'quoted text' 'quoted text' ${HOME} $(pwd) &&
+		grep then local x=1 done awk grep -eu
+test test cd export awk | 'quoted text' -eu $(pwd) cd "$@" --verbose echo 2>/dev/null
+		${HOME} sed then -eu then printf x=1 x=1 export && 'quoted text'
+grep grep readonly readonly cd awk done 2>/dev/null
+	then local x=1 awk test "$1" 2>/dev/null
+		--verbose local "$@" "$@" then export --verbose
+	grep | awk awk awk done grep echo printf echo 'quoted text' ${HOME} -eu "$1"
+		printf 2>/dev/null x=1 2>/dev/null done test
+		cd cd 'quoted text' | done
+	then sed test 'quoted text' grep x=1 grep
+$(pwd) awk 2>/dev/null done --verbose test $(pwd) awk done cd
+		2>/dev/null /usr/bin 2>/dev/null x=1 cd x=1 $(pwd) && x=1 awk --verbose
+		test done local done sed
+		cd test 'quoted text' awk readonly
+	-eu echo -eu export cd
+		$(pwd) 2>/dev/null then readonly
+	${HOME} echo test "$@" $(pwd) then && sed
+	local 'quoted text' x=1 | "$@" 2>/dev/null ${HOME} "$@" readonly
+readonly | grep | then 'quoted text' $(pwd)
+	test "$@" printf "$1" cd /usr/bin
+	grep 'quoted text' export 'quoted text' done ${HOME}
+		printf 2>/dev/null printf sed
+	'quoted text' local then cd $(pwd) awk /usr/bin grep readonly --verbose local
+	'quoted text' test local echo /usr/bin
+		2>/dev/null x=1 ${HOME} readonly
+		"$@" | ${HOME} "$@" "$1" /usr/bin "$1" local then /usr/bin export echo echo awk
+	${HOME} readonly /usr/bin echo cd cd -eu --verbose cd
+		printf test 'quoted text' ${HOME}
+2>/dev/null awk /usr/bin ${HOME} $(pwd) sed 2>/dev/null
+	done done echo echo 'quoted text' echo ${HOME} $(pwd) && test && then done
+	awk test "$1" ${HOME} ${HOME} grep -eu "$1" /usr/bin export printf
+&& export "$1" "$@" "$1"
+	-eu 'quoted text' "$@"
+${HOME} "$1" cd echo grep printf ${HOME} done /usr/bin done printf --verbose
+		sed echo echo then readonly | ${HOME} export
+-eu awk export x=1 printf
+		--verbose grep "$1" cd grep x=1 grep -eu printf
+	-eu $(pwd) -eu then ${HOME} sed
+-eu 'quoted text' | readonly grep 'quoted text' then readonly
+	export -eu local x=1 local -eu | "$1" && awk -eu ${HOME} /usr/bin
+	-eu export test grep then test 'quoted text'
+		"$1" awk grep grep --verbose --verbose export -eu -eu "$1"
+		echo printf ${HOME} awk ${HOME} export | awk export "$1" readonly -eu | printf
+	local | then done $(pwd) 2>/dev/null grep test x=1 ${HOME} awk x=1 grep "$@" &&
+		"$@" printf $(pwd) && export awk --verbose
+x=1 local 'quoted text' test 2>/dev/null then -eu awk && sed "$1" "$@" ${HOME}
+		awk test sed "$1" -eu local local then ${HOME} local
+awk --verbose --verbose local then 2>/dev/null 2>/dev/null | 'quoted text'
+sed local x=1 -eu && local x=1 sed awk cd --verbose -eu cd /usr/bin "$@" |
+"$@" then cd awk local ${HOME} ${HOME} 'quoted text' awk readonly $(pwd)
+	/usr/bin x=1 "$@" /usr/bin --verbose x=1 export echo $(pwd) x=1 x=1
+	test 'quoted text' cd printf x=1 sed echo readonly echo $(pwd) done grep sed
+	printf /usr/bin done $(pwd) grep
+'quoted text' --verbose done /usr/bin ${HOME}
+		-eu /usr/bin "$1" export awk then
+	x=1 ${HOME} --verbose ${HOME} awk test local
+		$(pwd) readonly printf
+test awk x=1 --verbose readonly $(pwd) then
+		printf && grep local sed ${HOME}
+	$(pwd) cd awk ${HOME} grep 'quoted text' then local readonly local
+cd /usr/bin export $(pwd) printf
+	printf export grep 2>/dev/null $(pwd)
+	awk awk --verbose -eu echo | $(pwd) readonly 2>/dev/null
+	$(pwd) printf /usr/bin "$1" export export /usr/bin x=1 export "$1" export "$1"
+local printf local sed export grep awk && done done echo x=1 cd readonly
+		export test "$@" awk --verbose local awk awk test -eu
+	-eu 2>/dev/null | 'quoted text' --verbose "$@" "$@" export printf local cd &&
+		--verbose awk --verbose "$1" readonly "$1"
+		x=1 done $(pwd) -eu "$@" 2>/dev/null && --verbose "$1" --verbose
+	'quoted text' test cd done test printf 'quoted text' x=1
+		"$1" "$1" 'quoted text' /usr/bin 2>/dev/null x=1 --verbose x=1 local done
+	2>/dev/null sed --verbose x=1
+	x=1 printf readonly export local
+		2>/dev/null x=1 ${HOME} test sed local /usr/bin then && 2>/dev/null export
+		-eu "$1" export 2>/dev/null sed awk $(pwd) /usr/bin
+		| "$@" export done local --verbose 'quoted text'
+		export && then grep 'quoted text' ${HOME} /usr/bin
+awk readonly --verbose -eu 2>/dev/null $(pwd) done test x=1 -eu 2>/dev/null
+		$(pwd) grep | cd 2>/dev/null sed -eu 2>/dev/null
+'quoted text' sed done test "$@" --verbose
+	${HOME} 2>/dev/null then /usr/bin && $(pwd) printf
+		-eu | 2>/dev/null local echo 'quoted text'
+		x=1 2>/dev/null sed -eu export x=1 $(pwd) "$@" echo echo --verbose echo
+	grep /usr/bin printf x=1 "$@" && "$1" | test sed /usr/bin && echo | local --verbose
+sed $(pwd) grep done "$1" "$@" "$@" cd 2>/dev/null /usr/bin
+		--verbose cd x=1 local ${HOME} test x=1
+	x=1 then "$@" export local $(pwd) export test readonly
+		x=1 sed awk grep | --verbose --verbose 2>/dev/null "$1" done
+		sed "$1" done "$1" grep export test
+		export done | echo x=1 done readonly printf awk done done
+&& "$@" "$@" | 'quoted text' cd 2>/dev/null
+--verbose --verbose 'quoted text' test "$@" echo
+-eu /usr/bin x=1 then 2>/dev/null sed awk -eu 2>/dev/null readonly && "$@"
+	printf "$1" 2>/dev/null ${HOME} local local awk readonly -eu
+${HOME} done "$1" /usr/bin printf
+done sed grep | printf export printf grep | "$1" x=1 /usr/bin -eu cd --verbose
+	-eu sed && 2>/dev/null readonly
+		echo readonly echo cd test readonly printf -eu x=1 test
+printf local export local --verbose awk 2>/dev/null
+		$(pwd) x=1 /usr/bin local x=1 test grep local --verbose &&
+		&& "$1" awk 2>/dev/null printf export local | 2>/dev/null
+	2>/dev/null && awk printf
+cd awk | export cd done | echo
+--verbose | -eu 2>/dev/null
+	then then awk awk ${HOME} --verbose
+	sed readonly printf cd awk echo ${HOME} export /usr/bin
+/usr/bin "$1" -eu --verbose $(pwd) "$1"
+		test /usr/bin 2>/dev/null sed /usr/bin -eu --verbose local done --verbose
+		/usr/bin test echo $(pwd) test sed 'quoted text' ${HOME} "$@" then
+		echo printf echo export awk | -eu grep 2>/dev/null test ${HOME} "$@"
+	${HOME} echo test -eu then
+	'quoted text' then cd local $(pwd) done test
+awk 2>/dev/null --verbose sed "$@" done | 2>/dev/null done
+		test printf awk x=1 test 2>/dev/null 'quoted text' $(pwd) sed --verbose
+	sed printf && "$1" $(pwd) cd done echo
+		awk printf 'quoted text' /usr/bin readonly printf ${HOME} then
+/usr/bin echo ${HOME} echo test local
+	export 2>/dev/null then && && x=1 x=1 printf export
+	"$@" grep awk -eu local -eu "$@" then done echo
+	then 2>/dev/null -eu then x=1 && done export readonly then readonly 'quoted text'
+		'quoted text' --verbose printf export
+	printf test "$@" test ${HOME} -eu test readonly "$1" --verbose printf sed
+	2>/dev/null "$@" done 2>/dev/null awk then /usr/bin "$1" && then "$1" sed
+	test export local ${HOME} readonly | "$1" "$1" $(pwd) $(pwd)
+	awk export grep sed /usr/bin sed --verbose 2>/dev/null test
+		then sed $(pwd) "$@" && x=1
+	&& $(pwd) -eu awk readonly | 'quoted text' test readonly
+	local printf | /usr/bin awk x=1 -eu 'quoted text'
+x=1 cd readonly export 2>/dev/null done --verbose grep
+		test $(pwd) --verbose grep /usr/bin | awk ${HOME} -eu echo printf readonly
+	test x=1 readonly awk cd x=1 cd test test done export done && ${HOME} done -eu
+then grep export /usr/bin echo test 2>/dev/null x=1 x=1
+	-eu /usr/bin then printf then --verbose
+		local echo cd done export grep ${HOME} export $(pwd) echo
+test printf --verbose 'quoted text' -eu printf echo cd && x=1 cd printf
+2>/dev/null export echo sed readonly -eu ${HOME} printf echo
+	export echo $(pwd) | /usr/bin
+	test | awk | export --verbose /usr/bin done "$@"
+		done grep "$@" awk awk -eu -eu "$@" test && cd grep
+test export 2>/dev/null printf && 2>/dev/null "$1" done x=1 2>/dev/null
+		&& /usr/bin 2>/dev/null cd $(pwd)
+	sed then --verbose sed export x=1 sed && -eu printf readonly ${HOME} && awk
+	echo awk test "$@" -eu export grep --verbose
+test x=1 x=1 sed readonly x=1
+		echo test $(pwd) $(pwd) --verbose /usr/bin done then grep && done
+	&& "$1" awk | "$1" 'quoted text' export test awk test
+	-eu 2>/dev/null printf export
+	| x=1 grep -eu grep echo
+	grep then && "$@" && sed 2>/dev/null ${HOME} | 'quoted text'
+	export export && 2>/dev/null printf --verbose printf readonly -eu -eu /usr/bin
+"$1" 2>/dev/null --verbose
+printf export test $(pwd) local sed -eu then test test echo
+		test ${HOME} cd test echo awk 'quoted text' && awk 2>/dev/null
+		/usr/bin printf echo 'quoted text'
+		&& 'quoted text' $(pwd) then export local
+		'quoted text' grep grep
+&& cd "$1" "$1" /usr/bin
+		cd echo --verbose export export done sed "$@" awk | 2>/dev/null grep
+		echo && local --verbose "$1" --verbose
+awk --verbose cd x=1 awk
+		test cd x=1 -eu "$1" printf printf x=1 readonly
+	then /usr/bin awk cd /usr/bin 2>/dev/null
+/usr/bin 'quoted text' && then x=1 "$@" then ${HOME} "$@" /usr/bin "$@" "$1" export
+		awk awk -eu awk grep --verbose && cd "$@"
+| -eu --verbose then --verbose "$1"
+	$(pwd) grep done 'quoted text' then local $(pwd) echo --verbose
+		sed readonly --verbose printf x=1 test local test && sed "$@"
+	"$1" 'quoted text' "$1" printf
+-eu ${HOME} echo "$@" done 'quoted text' grep
+	readonly echo test --verbose readonly -eu | && local
+	-eu cd local x=1 then awk --verbose x=1 grep echo -eu local -eu "$@"
+awk && ${HOME} test printf test -eu sed
+		cd ${HOME} "$1" /usr/bin -eu test printf "$@" 'quoted text' $(pwd)
+	local test grep printf cd -eu echo 2>/dev/null local local readonly
+	x=1 "$@" && printf /usr/bin x=1 readonly 2>/dev/null cd local --verbose done
+		cd /usr/bin echo printf -eu readonly ${HOME} 'quoted text' printf ${HOME}
+local test local | -eu printf printf "$@"
+		printf "$1" 'quoted text' readonly
+"$1" -eu "$1" printf && awk -eu /usr/bin readonly then "$@" done && && sed sed
+		readonly printf ${HOME} $(pwd) 2>/dev/null | 'quoted text'
+-eu "$@" ${HOME} then test test grep
+| export echo "$1" readonly ${HOME} "$1" 2>/dev/null -eu cd 2>/dev/null
+	echo ${HOME} "$@" then then awk local $(pwd) | readonly "$1" export awk echo cd
+		echo && export "$1" then $(pwd) grep cd |
+		local export /usr/bin echo cd && echo ${HOME} --verbose
+		$(pwd) | test done "$1" | grep test sed /usr/bin
+2>/dev/null test readonly cd echo -eu "$1" 2>/dev/null "$1" then
+		-eu /usr/bin sed awk --verbose | readonly test readonly "$@" --verbose
+		grep 2>/dev/null $(pwd) local awk $(pwd) && "$1" ${HOME}
+		2>/dev/null printf "$@" --verbose && 'quoted text' 2>/dev/null done
+		"$@" cd | export echo printf export $(pwd) $(pwd) "$@" ${HOME} --verbose
+	sed ${HOME} /usr/bin test readonly "$@" echo 2>/dev/null readonly
+	readonly && $(pwd) -eu ${HOME} $(pwd) awk -eu grep local &&
+sed "$@" /usr/bin ${HOME} echo readonly x=1 done cd x=1 then awk 'quoted text'
+	"$1" x=1 && done export readonly then
+/usr/bin awk local cd /usr/bin printf
+	$(pwd) local "$1" echo --verbose
+--verbose --verbose awk awk test cd $(pwd) grep grep printf 2>/dev/null cd export
+awk 'quoted text' "$1" grep printf "$@" && sed
+		x=1 test 'quoted text' 2>/dev/null test --verbose --verbose
+	sed 2>/dev/null /usr/bin $(pwd) 2>/dev/null
+	"$@" done -eu "$@" $(pwd) 2>/dev/null && | export $(pwd) cd readonly
+	/usr/bin sed test then "$1" ${HOME} 2>/dev/null readonly | -eu 'quoted text' |
+sed 2>/dev/null ${HOME} echo cd sed echo then && ${HOME} -eu && local
+${HOME} 2>/dev/null grep 2>/dev/null /usr/bin && done $(pwd) echo cd 'quoted text'
+		echo grep && "$1" test grep $(pwd) echo local -eu export then
+$(pwd) export local "$1" readonly done
+		cd | x=1 /usr/bin then 'quoted text' cd
+	done --verbose "$1" --verbose test | done local readonly printf "$1" "$1" "$1"
+$(pwd) | readonly test cd x=1 /usr/bin
+		'quoted text' --verbose readonly
+	grep x=1 grep | && && sed "$@" export printf /usr/bin sed printf "$1" | echo
+	"$@" done local test && printf sed grep grep
+		-eu grep x=1 sed printf 'quoted text' cd done 2>/dev/null grep grep -eu echo
+'quoted text' then test grep sed 'quoted text' "$1" -eu /usr/bin
+	-eu $(pwd) sed test --verbose "$1" sed -eu 2>/dev/null $(pwd) done "$1" $(pwd)
+		export then export $(pwd) readonly readonly 2>/dev/null &&
+		--verbose /usr/bin test
+		--verbose 'quoted text' $(pwd) /usr/bin awk 'quoted text' printf
+		'quoted text' cd then test printf && && readonly "$1" --verbose
+	test awk x=1 $(pwd) cd local export then
+| -eu 2>/dev/null then /usr/bin -eu | awk echo readonly
+	test /usr/bin -eu "$@" cd test
+	"$@" && -eu cd grep $(pwd) ${HOME} readonly 'quoted text' grep /usr/bin ${HOME}
+		readonly && done "$@" 2>/dev/null
+	local /usr/bin sed | readonly printf test
+	echo --verbose 2>/dev/null -eu echo echo 2>/dev/null 2>/dev/null
+	test "$1" $(pwd) printf
+printf ${HOME} grep x=1 --verbose echo
+cd --verbose | x=1 -eu
+local echo grep "$@" --verbose x=1 local done --verbose $(pwd) -eu awk
+	${HOME} x=1 then local | sed --verbose grep
+		--verbose done 2>/dev/null -eu local export
+		readonly x=1 | && -eu awk x=1 | ${HOME} $(pwd) | readonly --verbose export
+		-eu && local cd "$1" cd awk ${HOME}
+x=1 echo "$@" then local readonly "$@"
+		&& "$@" then | x=1 --verbose
+		"$1" ${HOME} export $(pwd) printf ${HOME} echo grep "$1" -eu cd --verbose
+$(pwd) ${HOME} "$1" "$@" /usr/bin 2>/dev/null done grep
+	/usr/bin -eu 2>/dev/null local echo grep echo cd $(pwd) sed 2>/dev/null -eu
+	awk then 'quoted text' export export && $(pwd) -eu x=1 export
+	"$@" printf test local echo then printf && --verbose export printf awk
+		sed sed "$@" "$1" readonly
+test done printf x=1 awk | 2>/dev/null echo
+		"$1" grep /usr/bin $(pwd)
+		readonly test -eu /usr/bin
+echo sed $(pwd) -eu "$@" printf grep 'quoted text'
+'quoted text' echo local $(pwd) 2>/dev/null "$1" 2>/dev/null awk readonly local
+cd cd --verbose echo
+	2>/dev/null printf cd 'quoted text'
+	$(pwd) then -eu done then $(pwd) readonly readonly x=1
+		"$@" | /usr/bin | "$1" "$1" done 2>/dev/null && --verbose && cd then
+local local x=1 x=1 'quoted text' readonly
+	'quoted text' --verbose printf test test awk 'quoted text' readonly then
+	readonly 2>/dev/null export grep local
+		${HOME} --verbose printf /usr/bin done then sed local awk export
+		done "$@" awk printf ${HOME} -eu -eu $(pwd) sed sed export 'quoted text'
+		done /usr/bin -eu awk done test export && local local then "$1" 'quoted text' "$@"
+	&& && ${HOME} then --verbose done grep awk | sed grep $(pwd) x=1 |
+		echo echo ${HOME} ${HOME} readonly $(pwd) &&
+${HOME} sed -eu local done ${HOME} cd -eu |
+local grep 2>/dev/null export printf test | then
+	local then then readonly echo
+	'quoted text' grep $(pwd) then && && 'quoted text' awk test
+	then $(pwd) $(pwd) 'quoted text' echo
+	/usr/bin done export 2>/dev/null export "$1" | "$1" sed 2>/dev/null x=1 --verbose
+export 'quoted text' $(pwd) printf
+/usr/bin -eu done /usr/bin done
+		export 2>/dev/null 2>/dev/null 'quoted text' 2>/dev/null
+	done -eu "$1" local test x=1 /usr/bin done && "$@" -eu /usr/bin
+	&& ${HOME} echo readonly | readonly done 'quoted text' x=1 "$1"
+grep sed test printf ${HOME} local test echo
+	grep cd cd export 2>/dev/null | cd x=1 'quoted text' printf
+	local "$@" echo "$@" cd "$1" readonly | x=1 sed awk done printf sed done sed "$1"
+| && local cd then then "$1" $(pwd) test echo && done grep grep
+		echo 'quoted text' grep && /usr/bin 'quoted text' then /usr/bin 'quoted text'
+	done "$1" local test grep && printf 'quoted text' printf readonly
+		export export awk | --verbose cd cd test
+/usr/bin x=1 export /usr/bin printf then 'quoted text'
+	"$@" grep $(pwd) 2>/dev/null echo | | ${HOME} test readonly "$1" test
+	&& local readonly test ${HOME} -eu echo $(pwd) --verbose
+"$1" 2>/dev/null && -eu then 'quoted text' awk then 2>/dev/null grep then
+		/usr/bin echo /usr/bin test -eu | printf readonly export 2>/dev/null && grep 2>/dev/null
+		cd -eu --verbose echo && && x=1 sed "$@"
+	2>/dev/null echo ${HOME} $(pwd) && echo x=1 printf echo 2>/dev/null
+	2>/dev/null && test cd done printf /usr/bin "$1"
+sed export "$@" export $(pwd) "$@" "$@" &&
+		--verbose && echo -eu done
+		awk 2>/dev/null test local test echo
+printf | cd ${HOME} $(pwd) grep "$1" 2>/dev/null readonly awk test
+	echo ${HOME} test local && && ${HOME}
+	cd 2>/dev/null echo 2>/dev/null test 2>/dev/null ${HOME} 'quoted text' grep done
+	cd printf sed -eu "$@" $(pwd) ${HOME} ${HOME} x=1 awk ${HOME} -eu
+	sed cd | | "$@" $(pwd) sed
+	$(pwd) /usr/bin printf 2>/dev/null x=1 ${HOME} export --verbose
+	test /usr/bin | sed 'quoted text' readonly -eu "$1" cd $(pwd) && -eu 'quoted text'
+local awk test test x=1 "$1" then printf /usr/bin $(pwd) --verbose local
+	local | then readonly awk
+2>/dev/null echo echo ${HOME} 'quoted text' $(pwd) "$@"
+$(pwd) "$@" then grep export | sed 'quoted text' cd "$1" echo
+	/usr/bin sed x=1 awk 'quoted text' then ${HOME}
+$(pwd) "$1" /usr/bin echo echo
+x=1 cd cd printf done local 2>/dev/null
+	readonly 2>/dev/null "$1" "$@" awk printf
+	-eu echo /usr/bin -eu | --verbose 2>/dev/null --verbose test && printf
+/usr/bin cd --verbose printf readonly local export
+		"$1" 2>/dev/null 'quoted text' --verbose | echo 'quoted text'
+	then x=1 x=1 echo -eu 'quoted text'
+2>/dev/null && cd 'quoted text' done -eu
+done done "$1" $(pwd) && cd done awk export ${HOME}
+sed test test 'quoted text' done $(pwd) 'quoted text' readonly
+	test local --verbose "$1" x=1 -eu 'quoted text'
+		local printf | && $(pwd) grep then cd then grep | -eu && printf
+		"$1" printf ${HOME} x=1 ${HOME} && 2>/dev/null
+		printf cd awk readonly test test test readonly && x=1 test --verbose
+		| -eu export readonly $(pwd) local cd 'quoted text' printf --verbose x=1 test $(pwd)
+		test 2>/dev/null 2>/dev/null "$1" "$1" then -eu test /usr/bin
+		export grep && readonly then --verbose done grep printf
+		cd readonly x=1 2>/dev/null awk --verbose test readonly "$@"
+		-eu /usr/bin echo grep -eu
+	awk "$@" sed readonly | "$1" -eu && awk | export local "$1" printf local |
+	&& && sed then cd sed && printf
+		grep --verbose -eu "$@" "$1" awk --verbose && export | awk
+	--verbose "$@" cd 2>/dev/null $(pwd) /usr/bin $(pwd)
+		cd printf readonly "$@" printf echo grep 'quoted text' | | 'quoted text' awk
+grep cd && "$@" "$1" sed export -eu /usr/bin x=1
+		printf "$1" done sed ${HOME} 'quoted text'
+		x=1 --verbose awk $(pwd) 2>/dev/null /usr/bin
+	${HOME} printf 2>/dev/null export printf "$1" sed -eu awk | export
+grep --verbose then $(pwd) local export done export
+'quoted text' /usr/bin done
+		readonly $(pwd) "$1" sed
+		then && --verbose cd test x=1 printf export export && sed cd test test "$1" test
+	"$@" grep | cd cd printf -eu -eu --verbose export awk grep export "$1" 'quoted text'
+		awk readonly 'quoted text' test awk sed ${HOME} "$1" 2>/dev/null
+	export /usr/bin readonly printf 'quoted text' readonly sed -eu --verbose /usr/bin
+sed sed local local | 'quoted text' test "$@" "$@" printf
+cd export awk -eu echo cd ${HOME} 'quoted text' "$1" sed
+then awk printf echo awk sed $(pwd) sed | "$1" | echo awk export
+	| 2>/dev/null x=1 /usr/bin ${HOME} "$@" 2>/dev/null -eu
+		echo readonly 'quoted text' && -eu x=1 "$1" /usr/bin ${HOME}
+		cd /usr/bin done ${HOME} grep /usr/bin grep "$@" sed $(pwd)
+local 2>/dev/null $(pwd) export test 'quoted text'
+| && printf "$@" export readonly echo test --verbose export export
+		test readonly done then 2>/dev/null
+	/usr/bin printf "$@" readonly
+printf x=1 && x=1 -eu | export cd x=1 /usr/bin 2>/dev/null
+		sed $(pwd) "$1" "$1" local printf 'quoted text' readonly done
+	local sed && 2>/dev/null 2>/dev/null
+		| done /usr/bin readonly cd grep local x=1 readonly cd "$1" echo
+'quoted text' /usr/bin -eu "$@" done 2>/dev/null grep -eu 2>/dev/null /usr/bin printf
+	sed "$1" && x=1 "$@" sed grep readonly 2>/dev/null
+then && awk readonly ${HOME}
+		then x=1 printf grep -eu x=1 printf
+echo -eu echo | awk then x=1 sed test /usr/bin
+"$@" $(pwd) 2>/dev/null then grep readonly local
+	| -eu done | then sed | --verbose | export
+-eu printf done done | local | sed
+	2>/dev/null readonly |
+| printf /usr/bin cd local ${HOME} sed -eu done sed $(pwd) export ${HOME} -eu
+2>/dev/null export -eu x=1 then x=1 sed grep "$1" --verbose then
+readonly && grep | export sed export
+	| && export then --verbose sed ${HOME} awk grep test "$@"
+x=1 test grep grep local --verbose
+"$@" 2>/dev/null 'quoted text' awk then | done echo echo && awk
+		--verbose x=1 x=1 -eu --verbose 2>/dev/null cd cd 'quoted text'
+| printf 2>/dev/null test
+	x=1 ${HOME} ${HOME} echo "$@" grep ${HOME} sed then echo ${HOME} sed local
+	'quoted text' awk readonly sed cd "$@" awk &&
+	$(pwd) grep cd echo awk grep | grep
+	export then "$@" printf sed local -eu grep
+	2>/dev/null then export | | -eu cd awk export x=1 done echo 2>/dev/null --verbose
+		&& ${HOME} then readonly -eu local echo $(pwd) done local 'quoted text'
+		readonly printf x=1 local
+	$(pwd) ${HOME} && sed "$@"
+	/usr/bin export 2>/dev/null local awk export /usr/bin
+printf -eu printf 2>/dev/null && x=1 grep 2>/dev/null "$@" readonly
+		test ${HOME} readonly "$@" grep
+	--verbose 2>/dev/null "$@" /usr/bin $(pwd) awk
+echo awk echo /usr/bin 'quoted text' | -eu grep done readonly readonly done "$@"
+	grep cd printf readonly test local ${HOME} printf sed awk sed printf
+	${HOME} cd awk then awk &&
+	grep "$1" ${HOME} done /usr/bin export "$@" test | 'quoted text'
+	--verbose echo ${HOME} echo /usr/bin export | --verbose awk sed export echo
+echo 'quoted text' grep $(pwd) local 'quoted text'
+		echo printf readonly export export
+&& local && printf | ${HOME} echo test $(pwd) -eu done 'quoted text'
+echo readonly grep printf 'quoted text' done local printf 'quoted text'
+		"$1" grep then "$@" done
+		-eu grep /usr/bin test done | test
+-eu 2>/dev/null && 'quoted text' readonly ${HOME} grep
+	$(pwd) printf $(pwd) ${HOME} test
+		'quoted text' test test $(pwd) 'quoted text' && cd ${HOME} readonly
+		done test 2>/dev/null "$1" 'quoted text' export /usr/bin echo && done --verbose
+		${HOME} | ${HOME} export awk 2>/dev/null -eu ${HOME} grep | 'quoted text'
+	--verbose ${HOME} "$1" | $(pwd) echo awk test x=1 done then grep
+		sed export | ${HOME} $(pwd) printf grep
+	2>/dev/null ${HOME} echo test printf $(pwd) local
+		-eu x=1 'quoted text' && grep x=1 export awk echo $(pwd) then /usr/bin local
+	export && "$1" && grep printf
+	&& echo local ${HOME} echo
+readonly awk sed then grep --verbose test
+		printf 'quoted text' x=1 cd export cd test cd --verbose $(pwd) /usr/bin then
+	"$@" echo | -eu --verbose done | printf /usr/bin grep
+		echo --verbose "$@" done
+		"$1" "$1" test awk $(pwd) 2>/dev/null local
+echo sed grep && "$@" echo 'quoted text' test grep
+		sed done grep $(pwd) echo /usr/bin local
+	test -eu then awk -eu -eu -eu
+2>/dev/null awk then 2>/dev/null export "$@" | export 'quoted text' --verbose "$1"
+		${HOME} sed /usr/bin cd x=1 "$@" x=1 "$@" local local
+"$1" /usr/bin && ${HOME}
+		$(pwd) readonly 2>/dev/null "$1" local local --verbose
+		sed readonly echo awk /usr/bin local export sed done | ${HOME}
+		x=1 printf grep | "$1" test 'quoted text' $(pwd)
+	done --verbose test done test 'quoted text'
+	$(pwd) then --verbose printf x=1 $(pwd) | 2>/dev/null then
+	| test echo done local -eu cd then $(pwd) x=1 "$1" export
+	done ${HOME} 2>/dev/null ${HOME} sed "$@" 2>/dev/null && readonly
+		&& "$1" awk printf "$@"
+--verbose x=1 2>/dev/null /usr/bin 'quoted text' local cd
+'quoted text' -eu $(pwd) -eu -eu then then 2>/dev/null
+		then | x=1 then done x=1 test 'quoted text' done && local "$@" then $(pwd)
+&& && sed then "$1" 2>/dev/null | printf test
+		x=1 awk grep cd test test x=1 local ${HOME} echo 'quoted text' echo /usr/bin
+	cd -eu ${HOME} awk --verbose
+export | test echo cd printf then 2>/dev/null
+		&& 'quoted text' -eu 2>/dev/null x=1 | sed local echo $(pwd)
+echo -eu echo echo readonly echo "$1" "$1" printf cd printf 2>/dev/null
+local awk /usr/bin then awk "$@" 2>/dev/null /usr/bin | | 2>/dev/null
+	printf export /usr/bin cd "$@" 2>/dev/null
+		${HOME} then "$@" && "$@" 'quoted text'
+echo "$@" readonly sed cd awk grep local | /usr/bin awk "$@" done x=1
+grep export grep echo grep && then -eu /usr/bin $(pwd) printf --verbose printf
+	/usr/bin 2>/dev/null $(pwd)
+	test echo 'quoted text' -eu --verbose sed ${HOME} readonly --verbose
+	| printf "$@" "$@" readonly &&
+		-eu "$1" --verbose x=1 then then test local
+-eu cd test sed "$1" "$@" 2>/dev/null "$@" sed && grep
+	--verbose grep grep grep 'quoted text'
+	&& $(pwd) 2>/dev/null -eu printf $(pwd) x=1 readonly local 'quoted text'
+		-eu | "$@" then grep readonly then $(pwd) readonly then 2>/dev/null
+	awk awk && export | local echo "$@" printf | cd "$@" sed
+	"$@" && grep local 2>/dev/null $(pwd) "$1" local ${HOME} --verbose "$@" test
+"$1" --verbose then cd | x=1 cd $(pwd) printf 2>/dev/null x=1 export | sed
+x=1 /usr/bin x=1 sed export && ${HOME} -eu 'quoted text' echo then 2>/dev/null
+| -eu export printf local -eu echo printf grep readonly -eu /usr/bin
+--verbose "$@" "$@" 2>/dev/null readonly sed | && awk echo readonly
+	then done grep "$@" local then --verbose printf | readonly | /usr/bin --verbose
+	readonly && | cd --verbose | test sed 'quoted text' -eu echo echo 2>/dev/null &&
+/usr/bin then x=1 then && printf /usr/bin
+	sed -eu done $(pwd) echo test export 2>/dev/null local
+		--verbose -eu 2>/dev/null printf
+grep /usr/bin --verbose local echo local
+test 2>/dev/null x=1 "$@"
+		--verbose 2>/dev/null "$@" ${HOME} 2>/dev/null
+		awk -eu $(pwd) /usr/bin printf x=1 "$1" 'quoted text' -eu awk local
+	/usr/bin readonly 'quoted text' done awk test cd then test -eu -eu sed
+test --verbose | test echo $(pwd)
+printf awk x=1 && --verbose "$@" grep "$1" test && "$1" "$@" export grep grep -eu
+x=1 readonly export printf --verbose cd "$@" awk grep local echo echo export
+$(pwd) ${HOME} -eu sed && -eu grep then
+		/usr/bin "$@" export x=1 awk done 'quoted text' "$1"
+x=1 done then x=1 awk then local awk grep 'quoted text'
+	local x=1 /usr/bin | then echo export 2>/dev/null --verbose
+echo x=1 2>/dev/null local cd "$@" -eu cd cd sed 2>/dev/null -eu sed --verbose &&
+		--verbose 'quoted text' | cd then
+		"$@" cd /usr/bin export "$@" sed x=1 cd cd printf then /usr/bin
+$(pwd) sed grep awk /usr/bin
+	readonly export 'quoted text' --verbose --verbose /usr/bin 2>/dev/null
+		export "$1" cd && sed | local awk grep x=1 done test --verbose "$@"
+-eu --verbose /usr/bin
+awk local "$@" readonly done && done x=1 'quoted text' echo
+		&& readonly "$1" then "$1" sed printf "$1" cd $(pwd) then export sed
+		echo "$1" 2>/dev/null 2>/dev/null readonly --verbose echo sed 'quoted text'
+grep 'quoted text' 2>/dev/null export printf x=1
+	cd 2>/dev/null test 'quoted text' | grep local | export x=1
+		echo | done 2>/dev/null /usr/bin
+	export /usr/bin sed && 'quoted text' then echo test "$1" | &&
+	export 2>/dev/null 'quoted text' echo ${HOME} $(pwd) | done "$1" "$1" --verbose
+		| "$1" | local printf ${HOME} awk sed grep
+cd grep -eu 'quoted text' /usr/bin /usr/bin | readonly 2>/dev/null readonly
+		"$1" ${HOME} $(pwd) | 'quoted text'
+	x=1 $(pwd) | ${HOME} 2>/dev/null echo local cd then printf "$1" awk then ${HOME}
+awk 2>/dev/null echo "$1" ${HOME} echo 2>/dev/null export grep && --verbose
+		&& x=1 | done | $(pwd) 2>/dev/null /usr/bin echo 'quoted text'
+	-eu echo && 2>/dev/null done test --verbose 'quoted text' --verbose test printf
+--verbose export local 2>/dev/null export
+	awk /usr/bin x=1 test --verbose x=1 grep 'quoted text' ${HOME} "$1" "$1" -eu
+		awk | local --verbose local 'quoted text'
+		${HOME} done echo done
+		x=1 export && x=1 x=1 x=1 /usr/bin sed then test printf "$1" printf
+${HOME} /usr/bin && readonly /usr/bin ${HOME} 2>/dev/null --verbose
+then local 'quoted text' $(pwd) | cd /usr/bin 2>/dev/null
+		export then done && 'quoted text' "$@" done ${HOME} export -eu && cd cd x=1
+	&& | test x=1 readonly && && grep done 'quoted text' printf
+	| -eu /usr/bin grep export && awk then $(pwd) --verbose
+test printf 2>/dev/null
+		"$1" grep 2>/dev/null -eu $(pwd) "$@" ${HOME} x=1 ${HOME} local
+local 'quoted text' 'quoted text' x=1 "$@" done cd -eu --verbose | $(pwd) readonly
+	'quoted text' done 'quoted text' 'quoted text' x=1 export then test
+$(pwd) export local -eu
+	'quoted text' --verbose "$@" readonly
+sed /usr/bin then $(pwd) 2>/dev/null
+grep export x=1 --verbose echo /usr/bin 2>/dev/null x=1 done $(pwd)
+	/usr/bin 'quoted text' cd "$1" printf grep readonly echo x=1 test local
+| then awk sed -eu | && awk ${HOME} grep "$1" && 2>/dev/null then echo
+	"$@" export test ${HOME} done && | sed local printf echo 2>/dev/null
+		cd 'quoted text' -eu --verbose cd local /usr/bin readonly 'quoted text'
+echo then && ${HOME} /usr/bin then test grep | && | local export
+		'quoted text' --verbose 2>/dev/null 2>/dev/null $(pwd) -eu local
+	-eu then cd export cd done ${HOME} --verbose 2>/dev/null done
+--verbose /usr/bin then sed done x=1 cd --verbose && export
+'quoted text' $(pwd) printf "$1" ${HOME} $(pwd) -eu export sed $(pwd)
+${HOME} awk "$1" x=1 ${HOME}
+	&& "$1" readonly "$1" ${HOME} "$1" | cd
+		${HOME} | "$1" -eu 2>/dev/null --verbose
+awk awk $(pwd) grep awk sed export awk
+--verbose ${HOME} grep | export 2>/dev/null echo 2>/dev/null export local printf
+		"$1" cd 'quoted text' "$@" 'quoted text' test done done 'quoted text'
+echo local printf test then /usr/bin readonly 2>/dev/null awk test &&
+	&& 2>/dev/null && --verbose local done cd echo test && done "$@"
+export x=1 echo ${HOME} export "$1" test "$@" test "$1" "$@"
+		${HOME} -eu local 2>/dev/null -eu test awk cd && sed --verbose awk
+	&& /usr/bin 'quoted text' test x=1 printf echo cd cd readonly | cd
+	then echo test --verbose printf --verbose "$@"
+test -eu && "$@" "$1" awk echo then sed
+test $(pwd) export printf && echo -eu "$1" cd cd "$@" echo
+/usr/bin sed readonly awk readonly cd -eu sed test --verbose x=1
+cd printf then then printf grep sed sed printf 'quoted text' echo |
+		readonly "$1" cd $(pwd) && "$@" "$1" /usr/bin "$@" readonly
+then done sed test | export
+	| export sed local $(pwd) grep local && x=1 2>/dev/null printf $(pwd)
+		${HOME} -eu sed $(pwd) ${HOME} done readonly $(pwd) then -eu printf then test
+	$(pwd) 'quoted text' done "$1" readonly sed awk --verbose done
+awk $(pwd) sed 2>/dev/null -eu /usr/bin /usr/bin echo $(pwd)
+		&& $(pwd) 'quoted text' x=1 export /usr/bin | grep --verbose
+--verbose local $(pwd) -eu /usr/bin --verbose then test printf readonly |
+		--verbose local | test awk awk x=1 test
+		echo "$@" -eu /usr/bin | sed printf x=1 grep test $(pwd) done $(pwd) test
+&& grep done readonly $(pwd) awk $(pwd) readonly --verbose
+&& $(pwd) awk export -eu test readonly 2>/dev/null "$@" -eu -eu cd test
+then /usr/bin local | local "$@" echo -eu awk echo cd
+	--verbose done export printf x=1
+		done cd cd $(pwd) sed 2>/dev/null 'quoted text'
+	-eu /usr/bin done && && done test done cd then cd -eu
+grep /usr/bin 'quoted text' readonly 'quoted text'
+then 2>/dev/null && "$@" "$@" /usr/bin sed
+awk 'quoted text' cd echo 2>/dev/null done awk grep readonly
+-eu | --verbose && /usr/bin
+	export --verbose done sed && then 2>/dev/null && printf && /usr/bin
+		| -eu && ${HOME} local sed | sed echo then
+		sed "$@" awk then -eu /usr/bin && /usr/bin sed then x=1
+		echo --verbose && "$1" 2>/dev/null | cd /usr/bin "$1" echo
+cd awk echo export then 2>/dev/null grep done
+${HOME} printf cd 'quoted text' grep test 'quoted text'
+		echo local then $(pwd) /usr/bin cd cd 'quoted text'
+		-eu grep x=1 grep | /usr/bin grep awk printf test printf test sed x=1 -eu ${HOME}
+	2>/dev/null cd | "$1" echo test $(pwd) grep "$@" local --verbose 'quoted text'
+		then 2>/dev/null -eu 2>/dev/null printf
+local readonly -eu /usr/bin export test local && &&
+printf /usr/bin | x=1 && printf test -eu done
+&& "$@" 2>/dev/null sed "$@" export 'quoted text' $(pwd)
+/usr/bin 2>/dev/null 2>/dev/null echo awk --verbose --verbose grep echo
+test | ${HOME} echo awk /usr/bin local then | export
+&& readonly --verbose "$@" --verbose 2>/dev/null "$@" grep local test -eu
+		sed 'quoted text' done ${HOME} 'quoted text'
+| -eu test -eu --verbose $(pwd) sed printf
+--verbose readonly then grep "$1" sed grep local cd $(pwd) sed sed
+	/usr/bin cd export | done
+		x=1 x=1 "$@" 'quoted text' /usr/bin ${HOME} -eu
+	printf sed awk export x=1 awk 2>/dev/null
+		test 2>/dev/null x=1 --verbose test sed test then cd printf
+	| local && awk cd "$@" sed "$@"
+	2>/dev/null && export sed local "$1" test && grep awk 'quoted text'
+	then then /usr/bin readonly | printf export
+		sed local /usr/bin 'quoted text' then then | ${HOME}
+	printf | "$1" "$1" "$@" && "$1" /usr/bin test export awk && "$1" x=1 /usr/bin
+		'quoted text' sed local awk ${HOME} local done sed 'quoted text' 'quoted text'
+		export readonly "$1" /usr/bin $(pwd) 'quoted text'
+		x=1 $(pwd) local local export
+		${HOME} echo 'quoted text' --verbose "$@" export cd grep 2>/dev/null
+	| 2>/dev/null | local $(pwd)
+		--verbose sed -eu then test sed $(pwd) | && done /usr/bin "$@" "$@"
+	cd "$1" export sed export sed ${HOME} test printf "$@"
+x=1 --verbose readonly awk 2>/dev/null "$1" awk $(pwd) /usr/bin
+	'quoted text' readonly export printf awk | -eu $(pwd) sed
+		$(pwd) awk --verbose done $(pwd) export grep cd /usr/bin -eu $(pwd) x=1 | /usr/bin
+awk grep x=1 grep then "$@" --verbose local
+"$@" echo sed "$@" export readonly $(pwd) 'quoted text' /usr/bin
+$(pwd) "$@" local && sed | awk -eu done awk then x=1 /usr/bin "$@" readonly ${HOME}
+	'quoted text' export local /usr/bin
+		-eu readonly test done "$1" $(pwd) sed $(pwd)
+		then && --verbose --verbose then && x=1
+awk "$@" /usr/bin /usr/bin local then ${HOME} echo && x=1 |
+/usr/bin readonly -eu done export /usr/bin
+	done && export export test cd -eu $(pwd) done && local 2>/dev/null /usr/bin &&
+cd cd printf readonly $(pwd) | then x=1 grep printf /usr/bin then "$1" sed done
+	awk x=1 test 'quoted text' then $(pwd) awk export --verbose
+	'quoted text' readonly -eu local readonly done
+-eu "$@" done then 2>/dev/null awk printf export x=1 echo test readonly --verbose
+	cd then cd "$1" grep cd export x=1 local
+		2>/dev/null $(pwd) "$1" | 2>/dev/null "$@"
+		${HOME} readonly "$@" 2>/dev/null $(pwd) readonly && | 2>/dev/null
+	readonly cd done 'quoted text' /usr/bin test export "$@" "$@" $(pwd)
+-eu --verbose local local grep cd x=1 "$1"
+	x=1 done "$@" -eu test | echo -eu ${HOME} x=1 then --verbose
+	awk then awk local done 'quoted text' | local
+		'quoted text' /usr/bin local "$@" then ${HOME}
+$(pwd) export sed ${HOME} export export ${HOME} x=1
+	local "$1" x=1 sed "$@"
+	-eu sed | /usr/bin x=1 export readonly x=1 grep | readonly |
+		-eu printf awk grep sed export
+sed x=1 readonly printf x=1 &&
+		grep 'quoted text' /usr/bin $(pwd)
+		--verbose 'quoted text' echo echo && sed readonly $(pwd) 2>/dev/null
+printf then 'quoted text' test cd /usr/bin -eu
+		local done test test "$1" --verbose -eu 'quoted text'
+| 2>/dev/null x=1 test grep test awk echo test grep 'quoted text' readonly
+| --verbose local 2>/dev/null awk -eu cd "$1" 'quoted text'
+	&& | ${HOME} | echo --verbose readonly
+--verbose readonly readonly echo printf echo cd awk | done
+	'quoted text' "$1" -eu /usr/bin readonly printf
+		printf -eu /usr/bin --verbose 2>/dev/null
+	&& cd awk then echo | done printf "$@" x=1
+awk grep -eu | cd sed readonly | -eu readonly 'quoted text'
+	&& | x=1 local 2>/dev/null -eu readonly
+2>/dev/null ${HOME} printf "$1" done test x=1 sed done echo readonly test printf
+"$1" awk && "$1" export grep -eu
+		local sed awk export echo printf --verbose $(pwd) sed
+	grep grep --verbose readonly cd then x=1
+		sed done 'quoted text' test grep --verbose export then local export
+		grep done 2>/dev/null cd test then then awk ${HOME} && --verbose
+		'quoted text' awk echo
+done echo --verbose awk readonly
+2>/dev/null 'quoted text' local done "$@" | -eu "$@" sed awk local "$@"
+		export | test awk awk cd -eu x=1 cd readonly awk awk
+		$(pwd) grep | "$1" echo grep
+	export | printf $(pwd) echo ${HOME} printf
+	grep $(pwd) 'quoted text' then export export cd "$1"
+done --verbose x=1 awk && readonly | echo /usr/bin cd /usr/bin
+		/usr/bin 2>/dev/null local then 2>/dev/null
+		${HOME} sed "$@" echo then ${HOME} x=1 readonly
+		-eu "$1" echo test test test x=1 'quoted text' -eu readonly cd printf cd
+		cd $(pwd) && awk cd readonly 2>/dev/null
+	--verbose "$@" readonly awk ${HOME} 2>/dev/null
+		grep then export ${HOME} "$1" echo then -eu | cd local
+	x=1 && then --verbose "$1" then test 'quoted text' x=1 | --verbose -eu done grep
+"$@" local sed cd ${HOME}
+	local /usr/bin x=1 cd local |
+		&& $(pwd) readonly | /usr/bin export then && cd echo echo
+test done echo -eu -eu done local && cd && then x=1 /usr/bin
+awk "$1" x=1 x=1 cd "$1" -eu /usr/bin && printf | ${HOME} done
+	echo sed && awk grep 'quoted text' ${HOME} /usr/bin --verbose
+	"$1" 'quoted text' -eu 'quoted text' echo
+	grep | --verbose printf printf x=1 'quoted text' then /usr/bin readonly export
+	${HOME} "$@" --verbose awk $(pwd) -eu printf printf local
+		done echo | export -eu "$1" "$1" ${HOME}
+		| done grep $(pwd) "$1" grep "$@"
+test grep printf -eu /usr/bin test /usr/bin "$@" /usr/bin
+		'quoted text' ${HOME} 'quoted text' awk readonly then | "$1" $(pwd)
+	"$@" local "$@" done 2>/dev/null /usr/bin awk && "$1" --verbose
+	&& /usr/bin x=1 /usr/bin ${HOME} printf echo
+cd x=1 | --verbose "$@" x=1 done sed "$1" readonly
+		awk --verbose done -eu /usr/bin done grep cd done -eu
+		$(pwd) sed $(pwd) $(pwd) sed | x=1 "$1" then "$@" done done printf done | done
+		${HOME} && 2>/dev/null readonly -eu | ${HOME} | 'quoted text' $(pwd) "$1" printf
+then then grep then printf | $(pwd) x=1 sed sed
+	2>/dev/null sed export echo echo /usr/bin
+		--verbose awk x=1 export done
+	${HOME} then grep local "$1" awk x=1 && cd sed /usr/bin -eu export awk export
+awk readonly local sed x=1 export -eu done ${HOME} printf local
+	then "$@" echo ${HOME} | echo export
+		readonly 2>/dev/null sed 2>/dev/null export ${HOME} "$1" | --verbose sed
+		export cd /usr/bin local local && "$@"
+&& export grep test ${HOME}
+| echo /usr/bin x=1 printf test $(pwd) 2>/dev/null
+'quoted text' awk "$@" printf awk sed done | "$1" grep sed sed ${HOME}
+		| done "$@" then && export cd /usr/bin printf
+		"$1" ${HOME} grep then && --verbose -eu $(pwd) then
+		"$@" && readonly $(pwd) "$@" grep 2>/dev/null cd grep
+		readonly then /usr/bin "$@" awk awk "$1" echo done
+		echo export "$@" readonly cd cd then cd test sed
+grep test readonly awk test "$1" | printf $(pwd) /usr/bin
+		grep 'quoted text' awk cd
+		then 'quoted text' "$@" ${HOME} | readonly ${HOME}
+		sed grep awk /usr/bin "$@" -eu sed 'quoted text' /usr/bin printf
+		grep -eu printf printf $(pwd) then 2>/dev/null -eu "$@" sed printf
+		echo x=1 /usr/bin "$@"
+printf grep "$1" readonly "$1" test awk printf
+		'quoted text' /usr/bin 'quoted text' sed
+test echo "$1" grep && grep && "$@" sed 2>/dev/null
+	${HOME} then "$@" awk then /usr/bin 2>/dev/null test
+${HOME} | 2>/dev/null $(pwd) cd export 'quoted text' sed "$@" | printf
+&& test /usr/bin test printf && awk test sed
+grep x=1 --verbose "$@" --verbose
+	readonly "$1" && export done printf --verbose
+		sed done awk cd "$1" echo then readonly "$1"
+	done local echo readonly cd --verbose test
+${HOME} | "$@" --verbose cd then
+| 2>/dev/null "$@" $(pwd) && then grep -eu && echo local export "$1"
+	grep test 'quoted text' cd --verbose "$@" grep grep printf local
+	/usr/bin $(pwd) 'quoted text' local then awk --verbose test --verbose --verbose
+		| "$@" local "$1" && --verbose 'quoted text' "$1" ${HOME} | test grep printf
+	export -eu -eu then /usr/bin
+		/usr/bin cd 'quoted text' ${HOME} x=1
+		/usr/bin "$1" 2>/dev/null $(pwd) cd
+"$1" | sed printf grep "$@" grep echo
+x=1 /usr/bin local readonly local "$1"
+		/usr/bin export awk awk local then readonly "$1" local
+		/usr/bin grep then echo awk /usr/bin sed printf /usr/bin
+		"$1" printf /usr/bin x=1 ${HOME} awk $(pwd)
+#include c130.sh
+	local | awk x=1 "$@" awk x=1 -eu $(pwd) local
+	x=1 local done "$1" | then /usr/bin "$1" &&
+		sed readonly --verbose | "$1" ${HOME} "$1"
+'quoted text' --verbose
+	awk local x=1 cd "$1" local &&
+	${HOME} -eu | echo printf local then --verbose awk && && && ${HOME} | 2>/dev/null
+	echo awk done | && | sed 2>/dev/null
+		| 2>/dev/null --verbose "$1" printf
+done x=1 readonly readonly "$@" cd done readonly
+'quoted text' grep readonly 2>/dev/null
+	cd ${HOME} | | test $(pwd) export x=1 2>/dev/null
+$(pwd) test printf grep && --verbose export test --verbose local test "$1"
+	"$1" cd local awk then
+		&& grep 'quoted text' local awk | grep "$@" echo
+	/usr/bin cd "$1" -eu export && --verbose && sed -eu 'quoted text' readonly
+	then $(pwd) && 2>/dev/null "$@" test "$1" && $(pwd) echo -eu echo
+		"$1" echo | | echo "$@" --verbose $(pwd) awk 'quoted text' test
+	readonly x=1 then 'quoted text' echo sed $(pwd)
+		awk 'quoted text' 2>/dev/null /usr/bin 'quoted text' && 2>/dev/null x=1 2>/dev/null
+		2>/dev/null cd && readonly
+		cd 2>/dev/null local "$@" $(pwd) ${HOME}
+		sed "$1" printf $(pwd) --verbose echo -eu --verbose -eu echo | 'quoted text'
+	test $(pwd) grep test
+'quoted text' then cd --verbose
+echo test && local "$@" local | && awk echo sed
+export && && $(pwd) /usr/bin sed echo printf done /usr/bin |
+	'quoted text' sed grep ${HOME} ${HOME} 2>/dev/null
+	local sed grep cd grep x=1 cd grep -eu export local done then echo /usr/bin test
+		grep done $(pwd) grep readonly -eu 2>/dev/null readonly
+	done ${HOME} ${HOME} "$1" done -eu echo sed echo test test
+	2>/dev/null ${HOME} /usr/bin | ${HOME} -eu | done 'quoted text' then printf
+done then echo 2>/dev/null echo "$@" | cd x=1 printf 2>/dev/null
+${HOME} cd 2>/dev/null ${HOME}
+'quoted text' echo "$1" sed ${HOME} awk cd 'quoted text'
+		then && "$1" cd test "$1" -eu done
+echo then && | /usr/bin cd 2>/dev/null echo && sed grep 'quoted text' 2>/dev/null
+then test export printf | 'quoted text' "$1" /usr/bin
+		cd 2>/dev/null sed x=1 -eu ${HOME} sed test test 2>/dev/null grep
+		"$@" "$@" x=1 "$@" x=1
+		&& 2>/dev/null local echo
+2>/dev/null "$1" $(pwd) ${HOME} grep --verbose
+		"$1" export 2>/dev/null $(pwd) test done
+| sed /usr/bin "$1" "$@" ${HOME} ${HOME} sed && && ${HOME} x=1 done
+	"$@" export awk ${HOME} x=1 done x=1 "$1" done x=1 /usr/bin
+	'quoted text' printf x=1 -eu /usr/bin /usr/bin
+	$(pwd) then awk $(pwd) done 2>/dev/null printf -eu -eu x=1 &&
+&& x=1 readonly /usr/bin local echo 'quoted text'
+	/usr/bin --verbose awk awk local "$1" awk readonly 2>/dev/null
+$(pwd) local grep then ${HOME} && test x=1
+	/usr/bin cd 'quoted text' $(pwd)
+printf --verbose printf -eu test x=1 -eu "$1" printf
+	sed awk -eu then echo sed echo /usr/bin | 2>/dev/null
+	$(pwd) 2>/dev/null x=1 test printf -eu
+		awk export test ${HOME} 2>/dev/null && cd 2>/dev/null
+	grep -eu 2>/dev/null awk "$@" awk | sed awk test test x=1 cd export export readonly
+	local ${HOME} awk 'quoted text' test
+| export sed then grep /usr/bin printf done sed && cd test
+grep echo readonly export printf
+local 'quoted text' local readonly done test 2>/dev/null
+"$1" local awk /usr/bin readonly local test awk
+	--verbose $(pwd) 'quoted text' awk ${HOME} --verbose local
+"$1" awk sed -eu echo | awk -eu local && x=1 test
+	then --verbose printf done
+		awk ${HOME} awk readonly "$1" --verbose
+sed 'quoted text' -eu | 2>/dev/null done $(pwd) && | "$1" $(pwd) grep
+		printf echo export | 2>/dev/null
+	/usr/bin $(pwd) then then /usr/bin x=1 "$1" --verbose echo
+	readonly --verbose echo echo -eu printf sed test sed x=1 /usr/bin
+/usr/bin 'quoted text' -eu 'quoted text' awk echo printf && readonly
+	then 2>/dev/null --verbose export grep then
+test test 2>/dev/null readonly /usr/bin $(pwd) local local x=1 $(pwd)
+	'quoted text' -eu | 2>/dev/null | readonly cd 2>/dev/null test 2>/dev/null
+--verbose && local test awk
+	'quoted text' 2>/dev/null "$1" then && | "$1" grep /usr/bin /usr/bin
+		2>/dev/null sed done sed cd cd && awk echo | export then sed
+	cd export ${HOME} local 'quoted text' awk -eu -eu then "$1" sed
+--verbose grep test sed sed "$1" x=1 'quoted text' echo
+		--verbose done test 'quoted text'
+		cd local done echo done export -eu done $(pwd)
+		x=1 "$@" "$1" -eu printf export then 2>/dev/null
+		'quoted text' $(pwd) readonly local local
+awk printf grep 2>/dev/null
+	"$1" && x=1 | local then cd export export --verbose grep $(pwd) --verbose
+export /usr/bin -eu echo sed grep 2>/dev/null
+	| 2>/dev/null awk 'quoted text' printf -eu ${HOME}
+done grep local $(pwd) x=1 test done && --verbose grep grep
+x=1 then readonly grep sed /usr/bin done then x=1 ${HOME} printf then
+then cd "$@" test "$@" grep && cd
+sed test --verbose 2>/dev/null "$@" grep
+printf $(pwd) 'quoted text' "$1" local && "$@" -eu cd
+	-eu done awk local echo
+		2>/dev/null 2>/dev/null test echo /usr/bin sed -eu
+grep then readonly $(pwd) export then export --verbose printf
+done then done then grep ${HOME} "$1" then local "$@" x=1 ${HOME}
+	cd $(pwd) echo | /usr/bin printf local
+&& ${HOME} cd echo "$@" -eu then --verbose
+		cd local echo sed /usr/bin done test local export "$@" then $(pwd) export
+--verbose $(pwd) sed then done && "$1" "$@" echo grep
+	sed sed grep "$@" x=1 --verbose printf printf
+		/usr/bin /usr/bin awk then x=1 && "$1" readonly
+		cd ${HOME} | cd --verbose -eu done then 2>/dev/null -eu | test ${HOME}
+then done x=1 printf "$1" then "$@" awk --verbose x=1 test &&
+		/usr/bin readonly echo /usr/bin | | readonly readonly
+	/usr/bin export --verbose local x=1 && "$1" awk grep
+	${HOME} cd "$1" "$@" export sed "$1" -eu then | printf
+		&& $(pwd) test && export ${HOME} 'quoted text' cd --verbose printf x=1 test sed
+printf $(pwd) $(pwd) "$@" "$1" | local test ${HOME} && printf test awk
+	readonly x=1 --verbose printf ${HOME} x=1 test "$@"
+	local sed export sed | && ${HOME} -eu "$1" 'quoted text' then echo --verbose
+	${HOME} "$@" "$1" printf && x=1
+		2>/dev/null cd echo printf grep
+"$1" /usr/bin grep echo then test 2>/dev/null sed awk ${HOME}
+&& readonly --verbose done test $(pwd)
+-eu cd printf | printf
+		sed "$1" awk cd && readonly -eu -eu export
+-eu done done 'quoted text' 'quoted text' /usr/bin $(pwd)
+	'quoted text' "$1" grep
+		| done 'quoted text' test grep /usr/bin | 2>/dev/null "$1" "$1" echo
+	2>/dev/null "$1" x=1 local sed -eu x=1 x=1 | $(pwd) sed grep --verbose |
+	'quoted text' echo awk 2>/dev/null | grep export "$1" | /usr/bin 'quoted text'
+		${HOME} 2>/dev/null awk
+	local 'quoted text' echo -eu $(pwd) $(pwd) test done --verbose --verbose
+		echo && && then readonly "$1" grep 'quoted text'
+	${HOME} readonly /usr/bin sed "$1" echo sed 2>/dev/null --verbose 'quoted text'
+'quoted text' test x=1 awk sed grep "$1" "$@" readonly grep echo awk local
+	'quoted text' 2>/dev/null $(pwd) grep "$1" printf
+export 2>/dev/null readonly echo 2>/dev/null 'quoted text' 'quoted text'
+		readonly export printf --verbose -eu local sed && cd sed &&
+export then cd ${HOME} "$@" sed | grep sed && ${HOME} x=1 2>/dev/null
+${HOME} $(pwd) printf then readonly
+		&& /usr/bin done cd ${HOME} 2>/dev/null "$1" 'quoted text' | done readonly
+		sed $(pwd) && local -eu then done -eu --verbose then --verbose x=1
+	x=1 $(pwd) local && "$@" -eu readonly local
+readonly grep cd "$1" | /usr/bin 'quoted text'
+then readonly -eu --verbose "$@" echo echo test done $(pwd) "$@" then
+	echo 'quoted text' printf then test && --verbose | "$1" export cd echo /usr/bin
+		printf -eu --verbose readonly "$@" 2>/dev/null cd 'quoted text' sed x=1 done
+		"$1" 'quoted text' "$1" grep readonly cd done "$1"
+echo /usr/bin then done 2>/dev/null 'quoted text' /usr/bin --verbose
+local $(pwd) grep grep 'quoted text'
+	-eu 'quoted text' $(pwd) sed -eu $(pwd) sed local 2>/dev/null -eu ${HOME} grep
+	grep local awk -eu x=1 test /usr/bin ${HOME} cd ${HOME} then
+		echo export awk 2>/dev/null "$@" "$@" grep local
+	2>/dev/null then sed "$@" sed | test
+		&& cd export readonly awk $(pwd) export grep && 2>/dev/null
+	then export && test cd "$@" local export done x=1 done "$1" "$@" echo readonly
+	readonly $(pwd) "$@" && /usr/bin echo -eu printf cd 2>/dev/null 'quoted text' readonly
+&& test test readonly then test 'quoted text' readonly echo
+"$@" done done && x=1 x=1
+	-eu && 'quoted text' then
+	/usr/bin && -eu --verbose printf local export | --verbose
+printf /usr/bin /usr/bin $(pwd) && done then grep | export grep
+		awk 'quoted text' | "$1" export x=1 grep ${HOME} done cd test | -eu x=1
+printf -eu $(pwd) | sed $(pwd)
+${HOME} 'quoted text' x=1 done readonly "$@" $(pwd) awk cd grep 'quoted text'
+	$(pwd) "$@" readonly x=1
+	sed 2>/dev/null cd 2>/dev/null test then local ${HOME}
+	then awk done export cd awk sed printf echo | "$1" $(pwd) /usr/bin
+| readonly -eu x=1 $(pwd) $(pwd) /usr/bin echo cd
+	then ${HOME} sed printf sed readonly --verbose export
+	$(pwd) -eu x=1 echo echo $(pwd) x=1 2>/dev/null
+	printf 'quoted text' --verbose 'quoted text' cd |
+awk awk "$1" && -eu cd 'quoted text'
+sed /usr/bin -eu then awk | awk
+		"$@" /usr/bin test echo sed grep readonly
+		/usr/bin done --verbose
+	$(pwd) -eu "$@" awk local "$1" x=1 -eu cd 2>/dev/null $(pwd) |
+		-eu export ${HOME} --verbose
+export 'quoted text' printf awk awk echo printf cd 2>/dev/null grep 'quoted text'
+	then grep then echo | printf echo test
+	readonly 2>/dev/null | | --verbose "$@" /usr/bin | printf then -eu export
+	"$@" $(pwd) --verbose echo local local sed cd $(pwd)
+	export $(pwd) awk done /usr/bin -eu "$@" printf echo /usr/bin && /usr/bin
+/usr/bin "$@" && $(pwd) printf then $(pwd) grep ${HOME} test && && cd export
+		${HOME} /usr/bin done $(pwd) cd awk sed /usr/bin
+		"$@" cd $(pwd) cd /usr/bin 'quoted text'
+		$(pwd) && printf sed --verbose export then echo awk ${HOME} done 2>/dev/null
+	"$1" /usr/bin awk test cd sed --verbose "$1" export then
+printf /usr/bin done "$@" $(pwd)
+echo grep readonly ${HOME} printf cd "$1" /usr/bin
+	$(pwd) then export awk sed -eu
+awk cd test sed $(pwd) ${HOME} test sed --verbose 2>/dev/null
+x=1 awk 'quoted text' local cd printf ${HOME} "$1" && echo cd
+		&& x=1 local cd test readonly echo -eu | | grep grep awk -eu export
+'quoted text' 'quoted text' "$@" "$1" echo export readonly "$1" export local /usr/bin
+	"$@" 2>/dev/null echo awk | 'quoted text' "$1" printf 'quoted text'
+	| ${HOME} -eu echo | && then && printf $(pwd) awk done done grep cd
+local readonly "$@" -eu test 2>/dev/null test --verbose 'quoted text'
+x=1 ${HOME} ${HOME} -eu 'quoted text' && then cd then done
+	awk echo readonly printf 'quoted text' $(pwd) local $(pwd) printf 2>/dev/null
+		done x=1 /usr/bin /usr/bin "$1" --verbose
+	-eu sed local cd test cd local | 2>/dev/null -eu "$1" sed local 2>/dev/null
+	cd | | -eu readonly /usr/bin /usr/bin | /usr/bin
+		| x=1 && done && test /usr/bin readonly test awk
+	sed export --verbose
+	"$1" done awk "$1" && echo readonly sed printf echo 'quoted text'
+"$@" then done | && x=1 'quoted text' $(pwd) ${HOME} "$1" 2>/dev/null export export
+&& cd export -eu /usr/bin ${HOME} cd x=1 sed awk test ${HOME} $(pwd)
+		'quoted text' && cd x=1 then awk "$1" x=1 local
+	-eu -eu cd $(pwd) printf done "$@" export then printf | && --verbose
+	--verbose && cd "$1" && && done sed printf echo
+		x=1 cd readonly awk test then sed --verbose 'quoted text'
+x=1 awk "$@" echo sed /usr/bin printf 'quoted text'
+"$1" "$@" sed ${HOME} sed && export $(pwd) grep $(pwd) cd test --verbose printf
+	sed /usr/bin -eu printf && -eu printf export printf cd $(pwd) echo
+	--verbose 'quoted text' | sed local readonly 'quoted text' "$1" ${HOME}
+		&& && | readonly local -eu test export echo -eu --verbose
+		local grep readonly 2>/dev/null test "$@"
+	2>/dev/null done "$1" /usr/bin -eu sed -eu --verbose /usr/bin readonly
+	awk cd cd $(pwd) "$1" done | test
+	${HOME} && sed echo local 'quoted text' --verbose /usr/bin
+printf printf cd export cd sed /usr/bin -eu "$@"
+		$(pwd) grep -eu printf --verbose "$@" readonly readonly
+${HOME} awk printf "$1" --verbose "$1" && readonly x=1
+x=1 then 2>/dev/null "$1" /usr/bin $(pwd)
+local $(pwd) x=1 "$1" "$1" /usr/bin export
+x=1 "$1" sed test then then sed cd awk grep printf 'quoted text'
+		${HOME} ${HOME} $(pwd) cd printf
+	then test 2>/dev/null sed test $(pwd) local /usr/bin sed x=1 local done x=1
+	then test --verbose local x=1 done grep
+	$(pwd) --verbose $(pwd) test "$1" x=1 -eu readonly --verbose
+		&& "$1" ${HOME} $(pwd) --verbose local
+	local cd export readonly done 2>/dev/null 2>/dev/null &&
+		&& sed x=1 cd test readonly local 'quoted text' /usr/bin
+		readonly local 'quoted text' test awk --verbose "$1" 'quoted text'
+	x=1 local echo local x=1 done cd 2>/dev/null ${HOME} then | awk ${HOME}
+local -eu local grep /usr/bin /usr/bin awk sed --verbose awk /usr/bin then 2>/dev/null
+$(pwd) printf grep sed test "$@" --verbose sed test cd readonly
+		${HOME} cd test cd ${HOME} cd done /usr/bin /usr/bin
+		printf test $(pwd) 2>/dev/null done "$@" done
+printf $(pwd) $(pwd) done export export
+	$(pwd) "$@" local cd echo
+	echo 2>/dev/null --verbose export readonly | ${HOME}
+		$(pwd) --verbose export /usr/bin local
+		printf echo test 2>/dev/null x=1 2>/dev/null
+		/usr/bin export && local x=1 echo
+readonly grep export "$1" 'quoted text'
+	readonly ${HOME} 2>/dev/null "$1" sed "$1" | x=1 "$1" | | awk then readonly
+		grep 'quoted text' --verbose
+	"$1" awk | grep echo test grep 'quoted text' ${HOME}
+echo 'quoted text' awk --verbose "$1" 2>/dev/null ${HOME} sed done -eu "$@" x=1
+| 2>/dev/null awk 2>/dev/null && export awk printf local test --verbose 'quoted text'
+awk printf 2>/dev/null local local
+		echo "$@" readonly "$@" local ${HOME} "$1" x=1 grep printf -eu
+		${HOME} then sed /usr/bin ${HOME} x=1 awk && test printf
+		grep "$@" 2>/dev/null
+	x=1 export printf grep /usr/bin readonly | printf test /usr/bin
+	readonly --verbose readonly awk sed
+		2>/dev/null x=1 -eu printf cd 'quoted text' echo awk ${HOME}
+	--verbose readonly ${HOME} --verbose
+		export export 'quoted text' -eu ${HOME} /usr/bin && cd --verbose -eu readonly
+'quoted text' then echo $(pwd) printf && -eu 'quoted text' 'quoted text'
+	&& x=1 done 'quoted text' echo | 'quoted text' cd local sed local $(pwd) grep
+	| 2>/dev/null "$1" local cd "$@" grep local done $(pwd) awk 2>/dev/null done
+		cd export "$@" cd x=1 -eu sed
+	| && $(pwd) printf "$1" cd printf -eu cd printf
+	local -eu cd ${HOME} sed | printf echo done /usr/bin cd x=1 echo export printf
+		sed sed awk test echo awk | test -eu cd readonly export -eu ${HOME} sed
+cd ${HOME} sed "$1" export
+	&& local done grep printf ${HOME} 'quoted text' readonly 'quoted text'
+readonly $(pwd) cd local readonly "$1" printf awk /usr/bin
+		awk "$1" then ${HOME} echo && grep local && printf -eu ${HOME} "$1" done sed "$@"
+		"$1" /usr/bin 2>/dev/null ${HOME} printf 'quoted text'
+		sed ${HOME} ${HOME} awk cd export /usr/bin /usr/bin -eu export
+		"$1" printf local | --verbose local
+grep 2>/dev/null test
+		sed | x=1 'quoted text' x=1 /usr/bin done && test /usr/bin grep
+		printf /usr/bin -eu done done $(pwd) --verbose sed | export
+	echo local readonly 'quoted text' -eu | awk grep "$@" awk sed grep test
+then 'quoted text' sed --verbose
+| "$1" sed --verbose 'quoted text' sed 2>/dev/null
+		-eu awk echo -eu -eu sed -eu export
+		export then grep echo && "$@" local ${HOME} done | "$@" x=1
+	test test /usr/bin readonly
+		printf --verbose 'quoted text' done 'quoted text' sed grep 'quoted text' readonly
+2>/dev/null then grep --verbose x=1 $(pwd) "$@" $(pwd) x=1 x=1 | 2>/dev/null awk
+local ${HOME} then ${HOME} then printf export 'quoted text' export
+		--verbose echo cd sed /usr/bin "$1"
+	test sed echo printf 'quoted text' x=1 /usr/bin | export
+	-eu | --verbose "$@" test x=1 grep "$1" x=1
+	'quoted text' done 2>/dev/null awk awk readonly echo
+	| | --verbose && sed sed cd -eu test -eu | sed | readonly local
+		readonly awk 'quoted text' /usr/bin
+		cd 2>/dev/null "$1" "$1" | -eu "$@" test 'quoted text'
+		--verbose x=1 then then sed -eu && --verbose
+		awk test -eu then test --verbose awk readonly
+		printf echo grep export local export ${HOME} printf printf "$1" ${HOME}
+		export /usr/bin -eu 'quoted text' x=1 test cd sed "$@"
+grep 'quoted text' 2>/dev/null 'quoted text' sed done export sed "$1"
+	'quoted text' sed && $(pwd) export done echo test 'quoted text' --verbose
+	-eu $(pwd) 'quoted text' "$@" -eu "$@" then then
+awk printf grep cd cd $(pwd) && | $(pwd) --verbose 'quoted text'
+	"$1" awk sed $(pwd) $(pwd) 'quoted text' sed test cd local then 'quoted text'
+done readonly ${HOME} awk | done
+echo x=1 | $(pwd) awk | sed export cd --verbose
+		then --verbose export && echo then "$1" then /usr/bin
+	--verbose grep then awk "$@" grep export readonly
+test 2>/dev/null awk test
+| grep cd sed "$1" 'quoted text'
+		echo 'quoted text' readonly local
+'quoted text' | export printf export local sed readonly $(pwd)
+| -eu && -eu echo 2>/dev/null cd && ${HOME}
+		--verbose echo 'quoted text' grep $(pwd)
+	grep "$1" && x=1 export grep local --verbose 'quoted text'
+done /usr/bin && then "$1" --verbose done local x=1 done ${HOME} ${HOME}
+	$(pwd) "$@" /usr/bin 'quoted text'
+then done /usr/bin grep done awk echo "$1" --verbose
+		'quoted text' 2>/dev/null
+"$@" awk 'quoted text' local grep local --verbose --verbose
+	/usr/bin --verbose "$@" --verbose export -eu
+		local -eu "$@" cd && | local
+	test cd test "$@" x=1 --verbose printf | echo export then
+	local 2>/dev/null then &&
+	"$@" --verbose then printf | sed done local awk ${HOME} "$1" && "$@" printf
+	2>/dev/null cd x=1 printf test printf
+	| --verbose local && grep readonly ${HOME} cd cd then
+	test awk | cd printf -eu
+readonly sed cd grep -eu 2>/dev/null then -eu sed export
+	printf --verbose grep && "$@" "$@" "$@" readonly echo cd "$1" $(pwd)
+-eu && 'quoted text' awk | &&
+		--verbose 'quoted text' printf 'quoted text' -eu printf export ${HOME} readonly
+	printf --verbose then sed readonly "$1" --verbose | $(pwd)
+		awk printf grep printf x=1 export && 'quoted text'
+		cd x=1 /usr/bin 'quoted text'
+		printf 2>/dev/null sed "$@" sed then cd readonly test $(pwd) $(pwd) awk test
+	cd --verbose export 'quoted text' | test 2>/dev/null
+2>/dev/null $(pwd) | 2>/dev/null test | "$@" done local 'quoted text'
+"$@" echo ${HOME} x=1
+	| echo && export readonly cd | local printf ${HOME} | 'quoted text'
+/usr/bin export 'quoted text' done 'quoted text' && && $(pwd)
+	/usr/bin "$@" -eu --verbose printf test export cd -eu "$1" 2>/dev/null
+		/usr/bin /usr/bin "$@" cd sed
+	$(pwd) local readonly cd -eu then $(pwd) sed
+		'quoted text' printf ${HOME} test then test grep cd x=1 "$@" sed done
+grep "$1" /usr/bin x=1 -eu && test /usr/bin cd cd --verbose
+	2>/dev/null -eu printf $(pwd) readonly 2>/dev/null
+	cd x=1 "$@" done --verbose 2>/dev/null && x=1 cd "$1" ${HOME} then 'quoted text'
+		$(pwd) --verbose 2>/dev/null
+$(pwd) readonly $(pwd) $(pwd) | && grep --verbose
+	--verbose done -eu grep cd && done
+	sed x=1 sed local echo awk 2>/dev/null && | x=1 export
+	printf 2>/dev/null sed test sed awk 'quoted text'
+	$(pwd) 2>/dev/null ${HOME} sed echo export local export | printf then export grep
+		"$1" "$1" grep ${HOME} printf 2>/dev/null ${HOME} readonly cd sed --verbose then
+	2>/dev/null sed done awk | x=1 &&
+'quoted text' && printf && -eu "$1" x=1 cd | readonly 'quoted text'
+		then /usr/bin "$1" | cd --verbose grep --verbose
+		echo 2>/dev/null /usr/bin readonly then sed --verbose echo
+echo 2>/dev/null ${HOME} done --verbose
+| "$1" cd done done grep x=1 "$1" echo --verbose "$1" x=1 /usr/bin
+	"$@" sed readonly done local &&
+cd grep $(pwd) "$@" echo
+		| "$@" | /usr/bin 'quoted text' && grep readonly
+		"$@" --verbose "$1" awk
+		readonly -eu local done export
+		export printf x=1 /usr/bin ${HOME} x=1 "$@" echo ${HOME} sed
+	x=1 "$1" 'quoted text' then x=1 test -eu 'quoted text'
+		echo export | ${HOME} /usr/bin cd cd export grep cd &&
+		local then export && cd x=1 cd 'quoted text'
+	sed export local printf && echo sed /usr/bin sed done --verbose grep
+		"$@" printf local 2>/dev/null sed 2>/dev/null $(pwd)
+		echo $(pwd) then export --verbose printf x=1 printf x=1 sed readonly
+		then readonly cd readonly --verbose "$@" x=1 x=1 cd ${HOME} done done awk test
+/usr/bin awk 'quoted text' /usr/bin --verbose export --verbose then
+sed | x=1 printf x=1 x=1 "$1" x=1 -eu awk 2>/dev/null --verbose && --verbose
+	-eu local x=1 && cd && $(pwd) cd $(pwd) "$@" -eu 2>/dev/null done
+cd then "$@" local $(pwd) "$@" 2>/dev/null --verbose cd $(pwd)
+	echo test printf /usr/bin awk sed "$1" 2>/dev/null awk /usr/bin "$@" /usr/bin
+		export 'quoted text' 'quoted text' export grep then readonly x=1 done printf
+		'quoted text' /usr/bin echo ${HOME} /usr/bin awk test 2>/dev/null
+		&& $(pwd) grep readonly cd && then export local export
+echo --verbose 2>/dev/null done $(pwd) then 'quoted text'
+	echo grep $(pwd) | --verbose export $(pwd) readonly --verbose
+	x=1 -eu export "$1" then echo test | | then awk sed &&
+export "$@" cd /usr/bin sed export cd 2>/dev/null
+	"$1" done awk && cd $(pwd) readonly 2>/dev/null
+		done export readonly export
+/usr/bin 'quoted text' then printf printf --verbose
+		grep -eu readonly cd test local ${HOME} cd -eu
+	cd echo cd sed sed 'quoted text'
+		--verbose && 2>/dev/null echo printf export && test /usr/bin
+/usr/bin $(pwd) echo awk -eu "$1" $(pwd) | --verbose
+		then then printf x=1 export printf -eu && --verbose 'quoted text' $(pwd) && --verbose
+&& then then printf readonly sed && awk then grep local
+--verbose printf printf && done && grep export then then "$1"
+		local && cd /usr/bin "$1" local && done "$@" readonly 'quoted text' $(pwd)
+		-eu then export 2>/dev/null
+		test printf "$@" $(pwd) x=1 grep readonly -eu echo done /usr/bin
+cd 2>/dev/null && | -eu "$1" test
+$(pwd) done cd cd 'quoted text' then then local
+	done awk export && cd test printf -eu
+echo "$1" ${HOME} grep grep sed | "$1" 'quoted text'
+	&& ${HOME} then && $(pwd) grep readonly
+| sed 'quoted text' readonly
+2>/dev/null sed printf --verbose
+	then printf "$@" && then 'quoted text'
+echo test 'quoted text' /usr/bin "$@" 2>/dev/null && --verbose readonly
+	local "$1" 'quoted text' readonly echo --verbose &&
+	/usr/bin "$@" test "$@" 2>/dev/null
+		| test cd x=1 echo test -eu awk "$1" 'quoted text'
+cd done done grep 'quoted text' readonly readonly cd 2>/dev/null
+	/usr/bin grep test echo then grep local ${HOME} "$@" "$@" done x=1 | && && echo
+		"$@" grep --verbose then then grep done "$@" && awk && printf awk
+		x=1 readonly local "$@"
+		-eu test ${HOME} /usr/bin "$1" /usr/bin echo awk 2>/dev/null sed awk --verbose
+test echo test sed done ${HOME} $(pwd) grep grep then
+		| 2>/dev/null /usr/bin cd export 2>/dev/null ${HOME} sed readonly 'quoted text'
+	export -eu sed $(pwd) $(pwd) "$1" $(pwd) && $(pwd) local cd --verbose
+		&& then done 2>/dev/null echo printf cd printf echo grep
+	local then readonly --verbose /usr/bin "$1" test local
+		done /usr/bin -eu then "$@" ${HOME} grep test
+	--verbose "$@" --verbose x=1 && ${HOME} printf done /usr/bin 2>/dev/null
+	x=1 local test printf 'quoted text' sed $(pwd)
+		&& "$@" test /usr/bin ${HOME} ${HOME} ${HOME} | sed sed 'quoted text' x=1 sed
+		-eu "$@" --verbose sed | then x=1 export grep echo 2>/dev/null 'quoted text'
+	-eu done done then 2>/dev/null x=1 $(pwd)
+		'quoted text' sed printf /usr/bin -eu sed
+	printf | /usr/bin -eu /usr/bin
+&& export ${HOME} cd ${HOME} export --verbose readonly
+	2>/dev/null 2>/dev/null echo 'quoted text' $(pwd) printf awk local readonly
+	awk awk readonly sed /usr/bin echo
+	$(pwd) echo echo | -eu sed 'quoted text' -eu sed x=1 awk export -eu -eu /usr/bin
+		/usr/bin printf then "$@" readonly 'quoted text'
+		cd done echo echo "$1" "$1" "$1" "$1" done && sed awk -eu done $(pwd) x=1 && 2>/dev/null
+		grep /usr/bin awk --verbose done "$1" --verbose ${HOME} printf
+	'quoted text' | "$@" -eu "$@" test done -eu && export
+	'quoted text' && local
+		${HOME} awk local && test grep "$1" awk ${HOME} done 'quoted text' done $(pwd)
+awk -eu /usr/bin grep done --verbose /usr/bin readonly
+		| -eu 2>/dev/null x=1 /usr/bin grep /usr/bin "$1" | then readonly
+		printf sed grep "$1" export --verbose
+${HOME} readonly then awk --verbose sed $(pwd)
+	2>/dev/null then $(pwd) export 'quoted text' echo readonly
+test $(pwd) "$@" 'quoted text' awk readonly 2>/dev/null
+		-eu then --verbose | test ${HOME}
+	echo 'quoted text' export $(pwd) then echo 2>/dev/null "$@" x=1 2>/dev/null
+	x=1 sed --verbose /usr/bin ${HOME} $(pwd) cd -eu done
+	export echo cd export 'quoted text' && $(pwd) && test $(pwd) cd /usr/bin $(pwd)
+${HOME} 'quoted text' echo readonly
+		export -eu export x=1 /usr/bin -eu "$@" | "$@" | printf test --verbose echo
+local "$@" && "$1" sed sed ${HOME} local
+	sed cd cd echo cd | 2>/dev/null && /usr/bin echo printf then -eu -eu --verbose
+cd /usr/bin && 'quoted text' then "$@" 'quoted text'
+	-eu | grep readonly /usr/bin
+	test done && --verbose export &&
+2>/dev/null local sed grep 'quoted text'
+awk grep test $(pwd) export test readonly export
+	grep "$@" -eu --verbose $(pwd)
+		&& local 2>/dev/null test awk local readonly readonly
+		'quoted text' test awk
+		-eu local /usr/bin && done done "$1" && local "$1" echo "$@" then
+	/usr/bin --verbose then
+	awk then $(pwd) test x=1 readonly "$@" x=1 ${HOME} readonly
+		local "$@" ${HOME} x=1
+local cd --verbose 'quoted text' local "$1" -eu --verbose ${HOME}
+	${HOME} printf /usr/bin 'quoted text' 2>/dev/null "$@" 2>/dev/null $(pwd)
+awk "$1" done done printf
+2>/dev/null test $(pwd) x=1
+		2>/dev/null echo -eu "$1" x=1 /usr/bin printf cd test echo -eu printf
+-eu "$1" x=1 cd -eu --verbose /usr/bin printf $(pwd)
+		then done $(pwd) && printf sed local $(pwd) export readonly
+	-eu printf --verbose grep ${HOME} | "$1" /usr/bin awk x=1 -eu readonly
+	--verbose echo "$@" awk cd sed $(pwd) &&
+readonly --verbose done cd grep export cd
+done test "$1" printf echo test echo /usr/bin
+		"$1" -eu test sed /usr/bin grep
+echo grep --verbose done 2>/dev/null grep then -eu /usr/bin
+'quoted text' /usr/bin
+		/usr/bin x=1 done ${HOME} test 'quoted text' test echo ${HOME} test export
+		$(pwd) cd x=1 printf then ${HOME} 'quoted text' -eu && 2>/dev/null | "$@" "$@"
+		${HOME} local printf then readonly then awk done
+	"$@" echo && sed cd -eu -eu then cd export
+		${HOME} test local awk export grep -eu 2>/dev/null
+	/usr/bin | export export "$1" $(pwd) grep readonly $(pwd) 'quoted text'
+	x=1 "$@" test && awk cd
+	| $(pwd) /usr/bin 'quoted text' awk 'quoted text' done && grep
+local /usr/bin local cd $(pwd) cd grep
+cd done sed -eu --verbose -eu test grep grep grep | printf ${HOME}
+		awk printf 'quoted text' awk | echo
+	cd awk sed done then grep grep $(pwd)
+x=1 && export --verbose $(pwd) $(pwd) --verbose ${HOME} $(pwd)
+	awk grep test grep ${HOME} awk echo cd awk sed grep grep export ${HOME} readonly
+	"$@" sed | $(pwd) done
+		&& printf export 'quoted text' export local
+		cd && sed "$@" /usr/bin export
+		grep "$1" sed ${HOME} "$@" grep ${HOME} export ${HOME}
+	test "$1" grep awk && local "$@" printf ${HOME} then -eu "$@" cd -eu $(pwd)
+	2>/dev/null grep readonly sed grep done done 'quoted text'
+	grep && "$@" sed local echo $(pwd) 2>/dev/null -eu export 2>/dev/null "$@" readonly
+/usr/bin then -eu -eu -eu echo "$@" 2>/dev/null
+	'quoted text' export readonly /usr/bin 'quoted text' x=1 x=1
+		$(pwd) --verbose | done ${HOME} local cd test 2>/dev/null awk 'quoted text'
+		awk awk 2>/dev/null printf cd -eu --verbose
+		local awk printf --verbose x=1 --verbose echo cd -eu ${HOME} /usr/bin printf
+'quoted text' 'quoted text' grep "$1" | /usr/bin cd /usr/bin test "$@" --verbose
+		cd -eu --verbose --verbose awk --verbose printf grep x=1 test |
+$(pwd) readonly grep "$@" printf -eu sed ${HOME} readonly
+grep "$@" sed echo x=1 $(pwd) &&
+"$@" printf && 'quoted text' readonly
+local cd && sed "$@" local test printf "$@" export awk --verbose then
+-eu export echo echo awk grep
+--verbose x=1 readonly --verbose done "$1" export sed test printf done 2>/dev/null
+${HOME} echo 2>/dev/null export export
+	done local grep then readonly
+	-eu /usr/bin /usr/bin -eu && | && $(pwd) "$1"
+		x=1 "$1" -eu && && -eu done
+	"$@" x=1 then then | "$1" && sed local
+		export echo x=1 printf 2>/dev/null 2>/dev/null
+	echo cd sed "$1" grep $(pwd) && test
+	"$1" awk echo test "$@" /usr/bin x=1 done $(pwd) echo then $(pwd) then
+	awk && --verbose --verbose -eu
+		awk 'quoted text' | readonly printf
+	sed sed sed /usr/bin
+		export test -eu done printf $(pwd) 'quoted text' grep local
+	$(pwd) 2>/dev/null | "$1" "$@"
+	"$1" grep 2>/dev/null sed echo x=1 printf
+	sed 'quoted text' printf printf $(pwd) "$@" test then 2>/dev/null -eu local
+	then echo 2>/dev/null ${HOME} sed && x=1 sed grep /usr/bin test then 'quoted text'
+"$1" 'quoted text' && export 2>/dev/null "$@" "$@" readonly -eu printf echo
+	-eu "$@" --verbose --verbose awk -eu 'quoted text' printf | echo readonly
+		export cd export printf 2>/dev/null test then
+${HOME} printf cd ${HOME} printf 2>/dev/null | x=1
+	"$@" "$@" awk export 'quoted text' x=1 echo sed awk "$1" --verbose printf
+	grep 2>/dev/null printf grep test then "$1" readonly then ${HOME} cd ${HOME} readonly
+'quoted text' "$@" test
+		readonly readonly printf test export done x=1
+-eu && done --verbose awk "$@" awk test ${HOME} $(pwd) ${HOME}
+	readonly grep sed "$@" /usr/bin 2>/dev/null && sed done
+		done readonly export | && "$@"
+		&& printf x=1 -eu awk ${HOME} sed done -eu "$1"
+	"$@" export x=1 then $(pwd) x=1
+		/usr/bin awk test -eu "$@" --verbose
+	$(pwd) local grep cd echo && sed && printf cd /usr/bin readonly ${HOME}
+		$(pwd) "$@" done "$@" $(pwd) done ${HOME} x=1
+	done done export done && "$@" --verbose
+		$(pwd) -eu 'quoted text'
+	then printf && 'quoted text' && ${HOME} $(pwd) then ${HOME} echo readonly -eu
+		$(pwd) /usr/bin "$1" export readonly x=1 --verbose /usr/bin cd "$1" echo test
+'quoted text' "$1" grep $(pwd) $(pwd) "$1" cd sed "$@" /usr/bin
+	-eu awk ${HOME} ${HOME} echo
+	${HOME} grep local ${HOME} cd grep 2>/dev/null $(pwd) export "$1" export done /usr/bin
+	&& readonly 'quoted text' | then 2>/dev/null done && test sed ${HOME}
+awk then /usr/bin -eu test "$1" --verbose test echo export
+	printf && --verbose local "$1"
+	readonly && $(pwd) test /usr/bin grep /usr/bin done
+readonly ${HOME} 2>/dev/null
+	grep sed 2>/dev/null printf ${HOME} cd 2>/dev/null
+/usr/bin | ${HOME} local
+	echo export printf | | x=1 'quoted text' done awk
+		x=1 "$1" && | grep /usr/bin printf
+		echo 'quoted text' awk ${HOME} 'quoted text' ${HOME} "$1" done ${HOME} cd --verbose
+	"$@" test grep "$@" sed awk /usr/bin "$1" 2>/dev/null echo
+${HOME} 2>/dev/null done | 2>/dev/null
+--verbose readonly ${HOME} --verbose then local "$@" sed
+	test $(pwd) done x=1 ${HOME} /usr/bin --verbose && /usr/bin "$1"
+	| /usr/bin sed ${HOME} && readonly awk sed x=1 test export -eu
+sed echo sed ${HOME} cd --verbose --verbose
+	done cd test sed | done 'quoted text'
+sed local ${HOME} test ${HOME}
+		echo -eu then $(pwd) ${HOME} grep $(pwd) $(pwd)
+echo -eu echo ${HOME} $(pwd) test local /usr/bin
+	x=1 2>/dev/null sed | | && && | test | printf echo sed 2>/dev/null 'quoted text'
+	'quoted text' then 2>/dev/null x=1 $(pwd)
+&& echo printf sed echo | && $(pwd) cd printf then "$1"
+	'quoted text' then export echo echo sed export x=1 ${HOME}
+		sed readonly test ${HOME} then then readonly
+	grep "$@" -eu printf sed then /usr/bin $(pwd) echo
+&& "$1" --verbose --verbose export export done /usr/bin
+	${HOME} /usr/bin local ${HOME} done | "$@" | cd &&
+		then -eu test /usr/bin test /usr/bin
+--verbose echo done && /usr/bin printf local 'quoted text' export && /usr/bin readonly
+	awk cd --verbose /usr/bin done 2>/dev/null local
+| done -eu ${HOME} /usr/bin /usr/bin "$@" "$1" echo "$1" -eu /usr/bin
+		echo x=1 echo -eu export -eu then export test x=1
+		| && "$@" $(pwd) sed export test test readonly "$@" test
+export x=1 grep awk sed 2>/dev/null --verbose "$1" test
+		"$1" 2>/dev/null ${HOME} 2>/dev/null 2>/dev/null 'quoted text'
+export "$1" echo 'quoted text' readonly test 2>/dev/null export grep local test
+		/usr/bin | ${HOME} done test "$1" grep "$@"
+cd x=1 local 2>/dev/null echo --verbose | x=1
+		&& 'quoted text' test readonly
+		then --verbose $(pwd) && sed awk cd 'quoted text'
+"$1" done /usr/bin echo export then -eu then "$1" | export readonly
+	done export --verbose cd then grep 'quoted text'
+"$1" awk done "$@" /usr/bin "$1" sed grep | ${HOME}
+	&& done 2>/dev/null /usr/bin sed 2>/dev/null 'quoted text' "$@" echo test "$1"
+2>/dev/null --verbose /usr/bin test 'quoted text'
+	export 'quoted text' "$@" x=1 'quoted text'
+printf --verbose readonly /usr/bin 'quoted text' then awk done && x=1 done $(pwd)
+${HOME} export printf 'quoted text' local 2>/dev/null 2>/dev/null 2>/dev/null
+		'quoted text' cd && printf "$1" 2>/dev/null local test
+		&& 2>/dev/null done 'quoted text'
+	printf "$@" local && export ${HOME} test then ${HOME} 'quoted text'
+printf $(pwd) $(pwd) awk readonly grep ${HOME} /usr/bin readonly
+		sed then test && 2>/dev/null 'quoted text' sed printf printf sed x=1 sed
+"$1" ${HOME} cd && sed 'quoted text'
+	then && "$@" printf -eu $(pwd) $(pwd) echo -eu grep -eu done awk 'quoted text'
+		done | $(pwd) | ${HOME} export
+	| "$@" printf "$1" "$1" /usr/bin echo
+	'quoted text' done sed done 'quoted text' awk && readonly sed done -eu -eu "$1"
+awk --verbose 'quoted text' && -eu readonly
+		awk 'quoted text' ${HOME} grep /usr/bin
+	"$1" awk /usr/bin grep local export export $(pwd) && 2>/dev/null && local
+		| sed --verbose x=1 -eu 2>/dev/null x=1 /usr/bin 2>/dev/null
+		&& && grep printf | 'quoted text' echo awk 'quoted text' awk | 2>/dev/null
+		&& 2>/dev/null | export awk $(pwd) /usr/bin awk grep
+	"$1" x=1 x=1 "$1" --verbose ${HOME} awk $(pwd) --verbose $(pwd) && --verbose
+		grep $(pwd) sed grep "$1" $(pwd) local done then sed "$1" 2>/dev/null 'quoted text'
+		2>/dev/null grep local -eu -eu "$1"
+-eu 'quoted text' | sed then export readonly cd "$@" -eu x=1
+	| export local done && x=1 then --verbose -eu -eu | ${HOME}
+"$1" 2>/dev/null export sed export | --verbose
+	grep cd then x=1 /usr/bin | x=1 x=1 cd then
+awk done -eu && /usr/bin readonly /usr/bin test
+export local | "$1" "$1" printf | test printf awk /usr/bin cd echo && -eu &&
+		/usr/bin cd done sed 'quoted text' awk done awk -eu && /usr/bin test -eu -eu
+		awk grep local | /usr/bin local done 2>/dev/null then then grep "$1"
+		2>/dev/null --verbose &&
+		| cd readonly echo local export printf --verbose x=1 test && && then ${HOME} | "$@"
+	--verbose x=1 done "$@" ${HOME} && && export cd x=1 'quoted text'
+		x=1 sed /usr/bin awk -eu local "$1"
+	local x=1 cd "$1" $(pwd) done sed --verbose test done -eu local
+	$(pwd) awk awk printf
+-eu && "$1" cd "$@" awk grep /usr/bin | 'quoted text'
+"$1" x=1 /usr/bin echo
+		--verbose echo --verbose cd "$@" && awk "$@" -eu printf echo
+then echo | --verbose sed -eu "$@" 2>/dev/null
+cd && readonly sed ${HOME} x=1 &&
+		/usr/bin readonly && sed 'quoted text' "$1" && &&
+	echo $(pwd) x=1 echo $(pwd) echo done then | readonly --verbose && echo
+		--verbose then printf ${HOME}
+	export sed -eu test --verbose readonly "$1" /usr/bin x=1 --verbose
+/usr/bin awk && && then awk && printf | 2>/dev/null local done
+	cd then awk --verbose echo export "$1" x=1 readonly
+		then 2>/dev/null echo
+		grep sed grep printf sed "$1"
+	| printf grep test | cd printf -eu -eu
+	local grep export cd done 'quoted text' 2>/dev/null "$1" --verbose
+local grep 'quoted text' "$1" /usr/bin
+		awk awk -eu && cd --verbose
+	echo "$@" -eu | /usr/bin 2>/dev/null
+	local echo $(pwd) --verbose export /usr/bin | sed --verbose awk local
+$(pwd) "$@" "$@" "$@" export ${HOME}
+		test echo awk printf x=1 local && | readonly done x=1 local -eu "$1" local 'quoted text'
+		then "$@" export test "$@" readonly local -eu grep x=1 2>/dev/null
+		x=1 awk grep readonly done /usr/bin && export
+	x=1 "$1" 2>/dev/null echo grep 2>/dev/null
+| done printf 2>/dev/null 2>/dev/null 'quoted text' grep 'quoted text'
+		'quoted text' ${HOME} 'quoted text' echo --verbose
+		printf echo sed readonly grep export awk 2>/dev/null "$@" local
+		printf done awk ${HOME} 'quoted text'
+$(pwd) ${HOME} ${HOME}
+	x=1 2>/dev/null && grep && /usr/bin awk | sed x=1 cd grep | /usr/bin echo cd printf
+	/usr/bin -eu "$1" cd --verbose -eu /usr/bin
+		$(pwd) grep cd | $(pwd) /usr/bin && && x=1 "$@" local "$@"
+	"$@" -eu local then "$@" "$@" printf
+		2>/dev/null && local $(pwd) echo printf && $(pwd) export
+sed then /usr/bin then ${HOME} x=1
+${HOME} test /usr/bin
+		printf then done echo && | ${HOME} printf readonly && test grep awk --verbose
+then readonly | readonly -eu then --verbose cd local printf "$@" readonly
+		"$@" grep test export
+cd sed then -eu "$@" printf test 2>/dev/null ${HOME} done --verbose /usr/bin
+/usr/bin --verbose awk | "$@" export
+	/usr/bin export grep done test cd test ${HOME} test && export sed --verbose then
+	printf cd "$1" sed 'quoted text' --verbose readonly
+2>/dev/null ${HOME} && $(pwd) "$1" ${HOME} grep awk 'quoted text'
+echo cd --verbose test $(pwd) then 'quoted text' test local cd local | ${HOME}
+	sed /usr/bin export cd done
+cd then printf "$@" awk then done --verbose test done -eu then
+$(pwd) | test export --verbose /usr/bin /usr/bin
+	"$1" ${HOME} 2>/dev/null 2>/dev/null 'quoted text' $(pwd)
+		2>/dev/null && 2>/dev/null sed then awk
+"$@" $(pwd) echo ${HOME} cd test ${HOME} then test && |
+export "$1" echo | printf "$@" "$1"
+	"$1" "$@" x=1 echo cd "$@"
+export export --verbose readonly "$1" /usr/bin printf done done
+		grep 'quoted text' "$@"
+"$@" sed /usr/bin && /usr/bin readonly ${HOME} && local -eu echo readonly
+		x=1 printf 'quoted text'
+awk --verbose local echo test export | x=1 --verbose
+		'quoted text' && 'quoted text' 2>/dev/null --verbose 'quoted text'
+	&& "$@" | done x=1 test && 'quoted text' export 'quoted text'
+	awk "$1" then printf 'quoted text' test then ${HOME}
+printf done then readonly "$1" echo "$1" done then
+	2>/dev/null echo $(pwd) export | cd 2>/dev/null
+readonly sed printf echo awk printf local readonly awk echo cd cd $(pwd) then
+local echo done test awk ${HOME}
+		grep awk then "$@" -eu | printf then done readonly done ${HOME} echo | grep
+	awk export test sed $(pwd) awk
+'quoted text' sed awk grep
+done $(pwd) -eu printf 2>/dev/null
+&& printf readonly | -eu "$@" "$1" sed echo && "$1" /usr/bin
+	$(pwd) test local /usr/bin "$1" && grep awk 2>/dev/null "$@" "$@"
+		2>/dev/null $(pwd) readonly grep sed
+		export printf done printf ${HOME} $(pwd) sed export && |
+		2>/dev/null $(pwd) && $(pwd) "$1" local x=1 --verbose ${HOME} readonly test ${HOME}
+		export readonly 2>/dev/null | --verbose test
+-eu grep then readonly 2>/dev/null
+awk local $(pwd) -eu 'quoted text'
+	&& "$@" local awk 'quoted text' | x=1 readonly /usr/bin grep grep 2>/dev/null
+export printf --verbose "$1" | "$1" ${HOME} "$1" then export --verbose awk readonly
+		${HOME} x=1 && | then "$@" then grep sed cd 2>/dev/null | "$@" test sed
+		x=1 sed echo cd echo test local 'quoted text'
+x=1 export --verbose export awk
+grep 'quoted text' echo "$@" && awk ${HOME} | -eu sed readonly
+-eu x=1 cd echo export export test -eu awk && x=1 --verbose
+		printf /usr/bin 'quoted text' awk $(pwd) local
+printf readonly readonly && -eu /usr/bin 'quoted text'
+		"$1" $(pwd) export --verbose /usr/bin done
+		cd 2>/dev/null "$@" $(pwd) 'quoted text' export /usr/bin
+/usr/bin grep "$@" local grep local export test x=1 echo "$@" "$@" 2>/dev/null
+	test "$1" $(pwd) /usr/bin x=1 awk echo awk 'quoted text' | cd "$1" --verbose
+2>/dev/null local 'quoted text' grep "$@" then $(pwd)
+		local sed printf "$1" "$@" printf "$1" "$@" then 'quoted text'
+done ${HOME} x=1 awk then x=1 "$@" ${HOME} cd ${HOME} --verbose local 'quoted text'
+	echo echo echo 'quoted text'
+cd ${HOME} $(pwd) sed "$@" x=1 && /usr/bin readonly && "$@" echo
+	x=1 local done readonly ${HOME} echo printf x=1 --verbose 2>/dev/null sed 'quoted text'
+'quoted text' readonly x=1 echo "$@" sed then --verbose
+		${HOME} then ${HOME} 'quoted text' export "$1" awk
+		-eu "$1" local | "$1" awk readonly grep ${HOME} done sed readonly
+| local done done grep grep 2>/dev/null 2>/dev/null done readonly -eu
+		/usr/bin cd export test awk $(pwd) printf echo "$@"
+		printf cd "$@" && done 2>/dev/null
+$(pwd) ${HOME} test test --verbose --verbose echo sed local echo $(pwd) "$1"
+		sed cd echo | 2>/dev/null then local test -eu
+	$(pwd) cd echo $(pwd) printf "$1" awk 'quoted text' | echo printf grep
+'quoted text' --verbose sed
+	sed local local grep && x=1 x=1 --verbose local x=1 sed 'quoted text' then
+		then --verbose cd -eu export 2>/dev/null 2>/dev/null
+sed 2>/dev/null cd cd && x=1 $(pwd) grep awk &&
+--verbose "$1" /usr/bin -eu grep echo x=1 then cd "$@" echo | "$@" readonly
+	/usr/bin x=1 printf awk echo test awk printf
+		2>/dev/null cd grep awk -eu test test awk export grep 'quoted text' printf
+	"$1" "$1" sed grep "$1" ${HOME}
+cd x=1 | --verbose 'quoted text' 2>/dev/null export && x=1 then &&
+	awk then --verbose /usr/bin --verbose /usr/bin awk awk --verbose
+readonly --verbose readonly then
+	readonly printf ${HOME} | x=1 local done | local | readonly
+echo x=1 local awk x=1 readonly grep 2>/dev/null then
+		x=1 && ${HOME} readonly test 2>/dev/null readonly && awk export printf awk
+readonly "$1" cd "$1" grep
+	-eu sed done local then "$@" printf ${HOME} sed export -eu
+	test test 'quoted text' cd ${HOME} --verbose test && readonly "$@"
+	/usr/bin awk test /usr/bin local cd
+x=1 -eu sed export local 2>/dev/null /usr/bin "$@" "$1" printf "$@" "$@" && && export
+-eu sed readonly /usr/bin "$@" then /usr/bin | grep
+echo grep x=1 local 'quoted text' test ${HOME}
+	test | done printf cd "$@" "$1" readonly cd ${HOME} printf
+local $(pwd) -eu cd /usr/bin "$@" -eu grep | "$1" $(pwd) awk
+echo echo -eu x=1 ${HOME} /usr/bin
+x=1 readonly test test -eu
+		-eu x=1 2>/dev/null test
+		awk then "$1" test ${HOME} readonly -eu x=1 && --verbose
+	test cd echo local ${HOME} x=1 /usr/bin
+echo grep ${HOME} 'quoted text'
+"$1" awk | readonly 'quoted text' test 2>/dev/null 2>/dev/null
+	sed $(pwd) $(pwd) printf cd grep echo done local test grep 'quoted text'
+	printf export /usr/bin
+		'quoted text' $(pwd) $(pwd) export --verbose x=1 "$@" grep
+	--verbose "$@" export export echo && && $(pwd) "$@" 2>/dev/null
+		--verbose --verbose cd sed "$@" awk readonly
+| -eu "$1" test "$@" local && "$@" 2>/dev/null
+&& $(pwd) done export x=1 "$@" sed cd "$@" "$@" | x=1
+		--verbose test $(pwd) awk test test export && "$1" readonly local
+'quoted text' echo | local ${HOME} && 'quoted text' "$@" ${HOME} 2>/dev/null echo
+/usr/bin then cd $(pwd) test grep "$@" $(pwd) ${HOME} 'quoted text' --verbose
+${HOME} local cd 2>/dev/null done
+--verbose cd awk 'quoted text' then --verbose "$1" awk done sed &&
+cd 2>/dev/null "$@" grep $(pwd) 2>/dev/null
+	"$1" --verbose ${HOME} && ${HOME} "$1" local 'quoted text' -eu $(pwd)
+	then done sed done done /usr/bin
+2>/dev/null grep done
+	2>/dev/null readonly test x=1 export
+		awk sed done 2>/dev/null printf 2>/dev/null
+		$(pwd) echo printf "$1" ${HOME} -eu echo 'quoted text' && readonly x=1 grep
+		test done then "$@" then "$@" 2>/dev/null "$1" sed done
+	'quoted text' x=1 /usr/bin cd 2>/dev/null
+${HOME} "$@" | "$@" | local ${HOME} grep "$@" cd 'quoted text'
+	| ${HOME} done printf awk sed then echo local "$@" grep local /usr/bin && test
+printf && grep ${HOME} /usr/bin "$@" local "$1" echo /usr/bin 'quoted text'
+readonly done --verbose /usr/bin then x=1 cd readonly cd -eu --verbose sed 2>/dev/null
+		x=1 grep local echo && done --verbose x=1 | grep ${HOME} cd 'quoted text'
+done 'quoted text' /usr/bin export && ${HOME} awk local -eu sed -eu then ${HOME}
+		sed 2>/dev/null --verbose
+		"$1" echo test -eu awk 'quoted text' --verbose "$@" "$1"
+		grep done "$@" sed x=1 /usr/bin && printf
+		sed x=1 echo readonly /usr/bin export then 'quoted text'
+		cd ${HOME} done 'quoted text' echo printf cd done readonly | then done "$1" then
+"$@" printf grep ${HOME} export && --verbose export readonly && sed echo
+		local local 2>/dev/null then sed awk echo --verbose x=1 "$1" grep --verbose
+| awk export /usr/bin "$1" readonly | readonly
+		/usr/bin -eu ${HOME} && | 2>/dev/null
+'quoted text' sed done grep awk export readonly
+		cd grep | | readonly then awk | |
+-eu /usr/bin -eu x=1 x=1 "$@" ${HOME} && awk | sed sed grep x=1 local then test
+		local readonly $(pwd) echo awk && local 'quoted text'
+		echo $(pwd) x=1 && 2>/dev/null test printf ${HOME} ${HOME} echo | 2>/dev/null
+	printf | x=1 && sed export /usr/bin -eu --verbose
+done done /usr/bin done test export -eu | $(pwd) ${HOME} awk ${HOME} "$1" test
+	readonly && printf | "$1" | then test sed local awk $(pwd) cd
+		test test --verbose test echo local "$1" && export awk | 'quoted text' && done
+		&& x=1 -eu x=1 && | | --verbose test ${HOME} readonly
+	"$1" && done -eu ${HOME} readonly "$@" readonly test -eu
+printf awk awk local cd 2>/dev/null 'quoted text' x=1 2>/dev/null | 'quoted text'
+	"$1" local awk /usr/bin "$1" $(pwd) x=1 done --verbose then test | x=1 readonly
+		echo 2>/dev/null "$@" echo readonly 'quoted text'
+	awk 2>/dev/null cd 'quoted text' ${HOME} grep
+"$1" sed | && awk 2>/dev/null
+	$(pwd) /usr/bin printf &&
+		-eu 2>/dev/null printf && x=1 local then "$@" | cd export && -eu
+	local && 'quoted text' awk $(pwd) readonly /usr/bin done done grep $(pwd) printf
+grep && sed export readonly
+	x=1 'quoted text' -eu 2>/dev/null done --verbose local
+cd ${HOME} done readonly local ${HOME} -eu grep 2>/dev/null export $(pwd)
+		grep $(pwd) local export /usr/bin export cd "$@" grep readonly done 2>/dev/null
+	export /usr/bin $(pwd) then then "$@" export
+awk 'quoted text' | | 'quoted text' local test done && | sed $(pwd) readonly --verbose
+"$1" sed sed readonly echo local 'quoted text' 2>/dev/null
+	printf 'quoted text' ${HOME} grep then 'quoted text' "$1" $(pwd) x=1 printf 2>/dev/null
+		--verbose echo $(pwd) "$1" done then printf
+| 2>/dev/null x=1 && -eu export test 2>/dev/null "$1" readonly
+${HOME} done export awk cd local 'quoted text' ${HOME} && then then &&
+| printf done "$@" "$@" "$@" 'quoted text' grep $(pwd) --verbose grep
+then "$1" readonly printf && && sed done readonly $(pwd)
+awk ${HOME} then export && local awk -eu local grep --verbose
+printf | | cd && ${HOME} -eu local
+	cd export -eu done -eu local
+	then printf "$1" "$1" readonly
+	/usr/bin && -eu --verbose "$1" done awk local local awk
+		printf sed export grep test readonly && awk --verbose
+		'quoted text' 2>/dev/null 'quoted text' && echo
+		${HOME} 2>/dev/null echo test awk
+	${HOME} ${HOME} cd sed readonly
+		"$@" "$1" "$1" "$1" $(pwd)
+		&& readonly echo readonly grep ${HOME} local export done && readonly
+		export local local done local printf test printf grep cd done
+	"$@" test cd ${HOME} "$@" --verbose -eu
+	'quoted text' 'quoted text'
+		${HOME} awk sed readonly export readonly
+		x=1 test "$@" grep "$@" sed "$@" 'quoted text'
+		then export done x=1 awk /usr/bin local sed $(pwd)
+	sed ${HOME} then local /usr/bin
+cd then 2>/dev/null readonly /usr/bin
+cd done "$@" x=1 echo cd && local readonly
+echo --verbose local test local ${HOME} && awk cd && cd /usr/bin
+grep 2>/dev/null export done
+	local "$@" 'quoted text' sed export x=1 cd x=1 /usr/bin "$1" cd 2>/dev/null ${HOME}
+	--verbose then && grep $(pwd) printf x=1 x=1 -eu
+printf ${HOME} /usr/bin readonly x=1
+cd export grep echo /usr/bin -eu "$@"
+export export x=1 done printf -eu && x=1 sed cd -eu
+	${HOME} readonly done local awk && "$1" then | && --verbose 2>/dev/null ${HOME}
+"$@" 2>/dev/null 2>/dev/null "$@" x=1 readonly
+		done sed /usr/bin awk grep export grep 2>/dev/null test then awk $(pwd) "$@" grep
+${HOME} grep local | && readonly "$@" readonly x=1 readonly readonly
+	readonly then sed -eu 2>/dev/null
+"$@" "$1" readonly done printf 'quoted text'
+		&& && awk done x=1 | printf grep printf readonly
+		cd cd x=1 done "$@" x=1 echo then cd -eu test sed
+		x=1 /usr/bin test local sed "$1"
+"$1" | printf 2>/dev/null -eu done $(pwd) "$@"
+echo echo readonly export && awk 'quoted text' test x=1
+$(pwd) local x=1 "$1" x=1 "$1" "$1" echo local -eu && -eu $(pwd) awk test
+local echo local "$1" && awk done && x=1 awk --verbose --verbose
+local "$@" | cd -eu --verbose done 'quoted text'
+	cd x=1 export readonly && sed | $(pwd) $(pwd) then /usr/bin && test && /usr/bin
+"$1" | printf -eu readonly
+"$1" -eu $(pwd) grep 2>/dev/null done 'quoted text' x=1 2>/dev/null
+		-eu && ${HOME} && 'quoted text' local cd "$@" ${HOME} /usr/bin
+	/usr/bin --verbose && 'quoted text'
+printf /usr/bin "$@" | | sed printf done readonly && --verbose
+/usr/bin grep sed --verbose "$1" /usr/bin x=1 then printf done done
+	sed local then | "$1" && echo ${HOME} done
+	cd $(pwd) printf readonly grep && export grep "$@" --verbose
+done local printf readonly cd local -eu 2>/dev/null /usr/bin cd
+		sed readonly printf awk then readonly
+'quoted text' 2>/dev/null 2>/dev/null echo | test && -eu cd echo -eu
+	awk done cd && printf readonly
+	2>/dev/null done -eu cd | "$1" local then && ${HOME} x=1 ${HOME} 2>/dev/null
+| cd "$@" done printf 2>/dev/null
+	--verbose sed echo "$@" ${HOME} --verbose
+		grep ${HOME} cd then 2>/dev/null "$1" 'quoted text' && ${HOME}
+	awk $(pwd) then --verbose cd cd awk ${HOME} grep /usr/bin echo done
+-eu ${HOME} "$@" sed -eu cd "$1" echo echo awk | echo sed | -eu x=1 grep --verbose
+awk export "$1" 2>/dev/null export ${HOME} -eu sed 'quoted text' 2>/dev/null 2>/dev/null
+		$(pwd) done /usr/bin export 2>/dev/null x=1
+sed -eu x=1 grep then cd then grep && grep sed "$@" x=1 grep grep then
+	grep 'quoted text' sed cd echo test done sed ${HOME} grep | --verbose
+	export cd 'quoted text' "$1" --verbose && ${HOME} x=1 "$@" echo sed
+sed sed x=1 local && -eu --verbose --verbose /usr/bin
+		printf echo /usr/bin echo done echo ${HOME}
+2>/dev/null sed x=1 printf "$@" ${HOME} /usr/bin /usr/bin /usr/bin
+	| then local cd grep sed 2>/dev/null | test 'quoted text' export
+	printf x=1 | readonly x=1 --verbose $(pwd) x=1 readonly
+	x=1 /usr/bin "$1" cd 2>/dev/null
+	readonly "$1" then ${HOME} printf $(pwd)
+		| "$@" test && "$@" "$1" local done 'quoted text'
+		2>/dev/null export && awk printf $(pwd) printf echo | printf
+	printf awk readonly readonly 2>/dev/null local --verbose
+x=1 | awk local done then && readonly local echo printf printf
+	"$@" readonly grep 2>/dev/null "$1" echo echo
+		$(pwd) local done sed grep awk
+	printf readonly | x=1 readonly awk x=1 local /usr/bin -eu local
+export awk 'quoted text' /usr/bin --verbose done 'quoted text' "$@" printf
+	&& printf $(pwd) local --verbose readonly
+		export test grep -eu $(pwd) x=1 cd echo readonly done awk x=1 readonly "$@"
+	&& echo "$1" done && readonly ${HOME} | | local echo then
+echo readonly cd && x=1 export then
+-eu local --verbose echo 'quoted text' export
+printf export | 'quoted text' /usr/bin local
+	printf export /usr/bin test --verbose then 2>/dev/null
+readonly test -eu awk echo printf $(pwd)
+		x=1 export then readonly cd --verbose /usr/bin && printf ${HOME}
+	grep "$@" 2>/dev/null "$1" done 2>/dev/null
+	sed | --verbose cd test done cd test 2>/dev/null "$1" --verbose grep
+/usr/bin --verbose $(pwd) "$1" readonly ${HOME} test
+$(pwd) then printf && export -eu sed printf
+export echo cd awk export test awk | 2>/dev/null
+	export x=1 cd awk sed awk "$1" "$1" export cd local sed
+x=1 done local test local local then --verbose ${HOME} "$1"
+		| 'quoted text' 2>/dev/null
+"$1" echo echo test x=1 && sed "$1" readonly x=1 export
+	then "$1" sed test 'quoted text' readonly
+	x=1 printf x=1 ${HOME} "$@" export x=1 printf $(pwd) awk /usr/bin cd "$1" "$1"
+test printf done && cd $(pwd) 2>/dev/null
+		x=1 done then 2>/dev/null $(pwd) then
+"$@" --verbose x=1 echo export
+	test done test /usr/bin "$1" awk
+-eu printf ${HOME} ${HOME} readonly test then test x=1 then grep && cd local $(pwd)
+	readonly $(pwd) | --verbose
+		"$1" 2>/dev/null local "$1" done done --verbose
+local "$1" -eu awk grep test then $(pwd) done "$1" grep
+	awk ${HOME} $(pwd) | $(pwd) "$@"
+		sed cd grep /usr/bin readonly -eu && test sed test $(pwd) "$@"
+		done then grep --verbose local
+	readonly grep readonly test
+	&& printf "$1" export $(pwd) done readonly sed then && echo /usr/bin
+local ${HOME} ${HOME} printf 'quoted text' --verbose local
+		&& printf /usr/bin "$1" ${HOME} export then 'quoted text' sed then
+		/usr/bin printf export --verbose | x=1 $(pwd) done sed
+${HOME} local | ${HOME} printf export ${HOME} sed
+	$(pwd) | cd ${HOME} local export 'quoted text' printf $(pwd) awk $(pwd) printf 'quoted text'
+		grep -eu done 2>/dev/null then ${HOME} echo ${HOME} done export
+		$(pwd) grep test 2>/dev/null then | readonly x=1 && -eu $(pwd) 2>/dev/null export
+&& test echo local export --verbose && sed | test /usr/bin done awk
+	/usr/bin && grep --verbose 2>/dev/null
+echo --verbose test awk sed echo /usr/bin 'quoted text'
+		sed $(pwd) grep printf cd done readonly cd local done echo
+done $(pwd) then && printf
+		$(pwd) done readonly then
+	cd echo /usr/bin 'quoted text' cd test && done
+echo $(pwd) export cd export ${HOME} then done ${HOME} sed -eu
+	grep $(pwd) echo x=1 then 'quoted text'
+	${HOME} sed cd done --verbose x=1
+		then 2>/dev/null printf awk -eu sed local $(pwd)
+		readonly && 2>/dev/null local $(pwd) cd cd $(pwd)
+$(pwd) x=1 "$1" ${HOME} awk grep
+cd x=1 ${HOME} readonly done
+| printf export awk export 'quoted text' then --verbose && readonly readonly
+	then done 'quoted text' "$@"
+sed $(pwd) && readonly printf /usr/bin readonly sed --verbose awk printf
+		2>/dev/null test --verbose
+		grep $(pwd) printf "$@" x=1 grep -eu ${HOME} sed x=1 echo
+		test /usr/bin x=1 | --verbose x=1 local && sed export local $(pwd)
+echo done printf /usr/bin grep export
+	echo $(pwd) grep "$1" x=1 'quoted text' 'quoted text' done test export
+"$1" --verbose awk 'quoted text' test x=1 | "$1" sed "$1"
+		sed echo && /usr/bin export cd /usr/bin local
+export | x=1 cd readonly && $(pwd) done printf --verbose
+	then $(pwd) printf readonly then readonly
+${HOME} grep test "$@" printf "$@" local 'quoted text' local then done
+		sed echo test && --verbose && cd export grep &&
+	"$@" ${HOME} && ${HOME} -eu readonly $(pwd) awk grep /usr/bin
+	"$@" export | ${HOME} cd export "$@" "$1" x=1 && -eu && done $(pwd) -eu
+		| grep export $(pwd) readonly
+		awk then --verbose then export ${HOME} 2>/dev/null cd printf
+readonly 'quoted text' $(pwd) 2>/dev/null awk printf grep --verbose $(pwd)
+	done test | echo local awk awk printf sed ${HOME} "$1" "$1"
+x=1 --verbose -eu 2>/dev/null $(pwd)
+done sed then "$1" --verbose --verbose -eu local test cd local
+	-eu 'quoted text' grep readonly | grep 'quoted text' cd then x=1 readonly
+	then 'quoted text' | $(pwd) sed local -eu 2>/dev/null 'quoted text'
+	$(pwd) -eu $(pwd) --verbose
+		-eu test done echo && printf 2>/dev/null /usr/bin printf then test echo | printf
+	2>/dev/null printf readonly "$@" x=1 then local
+	echo ${HOME} | -eu 'quoted text' then -eu grep "$1" --verbose "$1" readonly
+		test x=1 "$1" sed $(pwd) awk | sed && grep -eu awk done $(pwd)
+		then -eu local local ${HOME} test readonly test 2>/dev/null
+	local x=1 export done cd then
+	test sed ${HOME} "$1" ${HOME} | done grep cd printf 2>/dev/null echo
+		"$@" 2>/dev/null -eu echo printf x=1 then && 2>/dev/null
+	grep && x=1 && test $(pwd) && | echo && printf
+"$1" "$@" awk x=1 echo printf ${HOME} /usr/bin -eu echo
+then "$1" awk 2>/dev/null && "$@"
+printf 2>/dev/null --verbose readonly then then
+	| "$1" export 'quoted text' ${HOME} done export printf "$1" cd sed grep cd local
+		2>/dev/null /usr/bin &&
+/usr/bin echo x=1 "$@" printf then "$@" local 2>/dev/null test printf
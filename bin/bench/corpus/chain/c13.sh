@@ -0,0 +1,2001 @@
+--verbose sed local printf
+local awk --verbose $(pwd) 2>/dev/null && readonly export
+		cd "$1" ${HOME} "$@" printf cd ${HOME} grep awk "$1" "$@"
+		echo "$1" readonly sed echo ${HOME} x=1 /usr/bin && awk 2>/dev/null
+| /usr/bin awk | done sed /usr/bin sed grep "$@" x=1 done 2>/dev/null 'quoted text'
+	2>/dev/null "$1" local cd x=1 &&
+		--verbose x=1 then | export --verbose $(pwd) cd export grep
+		awk grep readonly --verbose "$@" then "$1" local grep echo && grep awk
+		| local x=1 "$1" 2>/dev/null 2>/dev/null
+$(pwd) sed test cd export grep && export --verbose x=1 printf then
+	readonly /usr/bin readonly
+cd then export awk printf "$@" 'quoted text' echo | "$1" | awk sed
+		test 'quoted text' export printf awk && then then done grep /usr/bin printf
+-eu cd awk -eu cd ${HOME} export test ${HOME} printf | ${HOME} grep -eu printf
+		2>/dev/null "$1" echo then done -eu "$@" /usr/bin 2>/dev/null
+sed grep && local echo 'quoted text' ${HOME} --verbose printf 2>/dev/null
+	done $(pwd) x=1 echo ${HOME} local 'quoted text' /usr/bin
+	&& done "$1" x=1 -eu echo ${HOME} | 2>/dev/null
+		'quoted text' "$@" /usr/bin && then --verbose
+	test done $(pwd) export 'quoted text' --verbose
+	/usr/bin | sed awk cd printf
+--verbose sed -eu "$1" | then ${HOME} "$1" grep printf
+printf sed && export --verbose then printf done
+then awk -eu echo local /usr/bin grep | 'quoted text' && then $(pwd)
+	sed cd cd "$1" ${HOME} $(pwd) "$@" readonly |
+	printf then x=1 cd $(pwd) -eu test
+	cd done 2>/dev/null "$1" printf 'quoted text'
+local | local | export printf
+		/usr/bin awk local "$@" grep export ${HOME} /usr/bin grep awk grep && cd
+		'quoted text' local "$1" -eu 'quoted text' 'quoted text' cd ${HOME} done sed
+"$1" ${HOME} readonly readonly then "$@" ${HOME} --verbose
+		"$1" readonly ${HOME} awk | awk readonly export
+done x=1 local then printf
+		readonly /usr/bin test "$@" | readonly
+/usr/bin "$@" grep --verbose grep $(pwd) grep x=1 ${HOME}
+printf then grep echo x=1 grep /usr/bin -eu awk test printf $(pwd) 2>/dev/null
+	&& --verbose awk 'quoted text'
+export printf grep sed -eu --verbose grep echo grep sed then
+		$(pwd) then 'quoted text' echo
+awk awk then && ${HOME} done /usr/bin echo readonly grep "$@" local awk readonly
+test /usr/bin | sed x=1 printf cd done
+		cd local 2>/dev/null 'quoted text'
+	echo && ${HOME} printf $(pwd) grep printf 2>/dev/null export readonly
+		${HOME} cd echo && test "$1" local x=1 cd "$@" $(pwd) 2>/dev/null
+		2>/dev/null 2>/dev/null export echo $(pwd) | $(pwd)
+	'quoted text' done "$1" echo $(pwd) | -eu local $(pwd) cd
+awk local test export done awk test 2>/dev/null /usr/bin
+		$(pwd) echo awk && local cd $(pwd)
+		grep 2>/dev/null export cd "$@" cd -eu /usr/bin 2>/dev/null
+	grep 'quoted text' -eu x=1 readonly --verbose
+		--verbose then done 'quoted text' "$1" "$1" local sed echo 2>/dev/null
+	"$@" | 2>/dev/null sed echo $(pwd) /usr/bin cd local
+	"$1" then $(pwd) then then local ${HOME} readonly done /usr/bin printf
+		sed $(pwd) awk -eu awk local echo grep $(pwd) 2>/dev/null
+		test grep awk --verbose
+		test export ${HOME} cd 'quoted text' x=1 echo echo -eu 2>/dev/null then
+grep grep ${HOME} local done
+	| 2>/dev/null "$@" | done "$@" 2>/dev/null
+	cd cd grep --verbose -eu -eu /usr/bin 2>/dev/null
+/usr/bin | ${HOME} "$1" cd x=1 -eu grep grep &&
+test printf cd grep readonly echo test /usr/bin
+	echo done test cd x=1 grep
+| echo awk sed | ${HOME} test sed 2>/dev/null
+	"$@" $(pwd) then && && sed then | sed echo done
+| cd cd grep grep ${HOME} 'quoted text' export -eu 2>/dev/null
+printf awk x=1 -eu && sed
+cd "$1" echo test readonly x=1 2>/dev/null 'quoted text' readonly && readonly
+	grep grep "$@" then $(pwd) done test printf export
+		echo then | -eu awk 2>/dev/null --verbose
+-eu test -eu "$@" grep awk "$@" awk && 'quoted text' "$@" --verbose
+readonly cd cd && "$1" then local echo cd sed x=1 readonly awk local x=1 x=1 |
+x=1 then 'quoted text' local readonly
+		done && done && awk export done export /usr/bin $(pwd) 'quoted text'
+	&& grep export --verbose 'quoted text'
+	"$1" sed -eu printf cd grep 'quoted text' echo
+sed echo grep echo export then grep local
+export cd /usr/bin -eu x=1 readonly | echo 'quoted text' cd "$@" export
+		"$@" 2>/dev/null test 2>/dev/null
+		2>/dev/null -eu done grep done 2>/dev/null ${HOME}
+		2>/dev/null awk 2>/dev/null
+	readonly echo "$@" local printf grep "$@" $(pwd) ${HOME} local $(pwd) test
+	grep then export "$@" cd local
+		2>/dev/null 'quoted text' 'quoted text' cd --verbose done
+	then sed x=1 done awk export
+		$(pwd) then "$1" echo cd --verbose
+	-eu "$@" grep grep export && cd --verbose export export export ${HOME} --verbose
+	${HOME} printf && ${HOME} done 2>/dev/null then $(pwd) awk echo "$@" 2>/dev/null
+	$(pwd) 'quoted text' done | then sed --verbose /usr/bin 'quoted text'
+-eu export test | local /usr/bin done echo --verbose
+sed local then x=1 awk ${HOME}
+| -eu $(pwd) test test x=1 then sed echo done then readonly awk cd readonly
+		"$1" 'quoted text' sed 'quoted text'
+	-eu sed && --verbose ${HOME} "$@" 'quoted text' cd && local export
+x=1 awk awk /usr/bin "$1" | ${HOME} ${HOME} --verbose "$1" "$1" grep /usr/bin
+		&& done export awk && | grep export then ${HOME} echo readonly readonly then "$1"
+echo test export export test export ${HOME} printf x=1 -eu $(pwd) cd grep
+		${HOME} printf -eu local then "$@" 'quoted text'
+	cd $(pwd) x=1 "$@" ${HOME} 2>/dev/null $(pwd) 'quoted text'
+"$1" "$1" then test awk "$@" then && 'quoted text'
+		echo | 'quoted text' sed $(pwd)
+	awk test grep test awk grep x=1 export local ${HOME} --verbose x=1 'quoted text'
+$(pwd) grep sed grep | export grep printf ${HOME} && /usr/bin && test awk "$1"
+		cd export echo "$@" export
+x=1 echo ${HOME} sed x=1 --verbose
+	--verbose grep "$@" 2>/dev/null local then
+then echo grep echo x=1 'quoted text' done x=1 awk
+	cd export --verbose done x=1
+echo 'quoted text' done grep awk "$1" printf -eu
+readonly | awk ${HOME} 2>/dev/null 'quoted text' echo sed export
+	| $(pwd) readonly test cd "$@" "$1" done "$1" 2>/dev/null then "$1"
+test export printf $(pwd) -eu cd cd x=1
+	grep readonly cd /usr/bin cd then export cd $(pwd)
+		done $(pwd) "$@" "$@"
+		awk export x=1 done sed /usr/bin printf $(pwd) sed -eu
+	'quoted text' x=1 'quoted text' && 'quoted text' test $(pwd) test
+	export sed /usr/bin done echo test 2>/dev/null then 'quoted text' test
+| 'quoted text' /usr/bin export /usr/bin cd grep done then $(pwd)
+2>/dev/null --verbose readonly --verbose done sed
+sed test | -eu -eu "$@" readonly --verbose sed cd cd cd 2>/dev/null
+	/usr/bin sed /usr/bin "$@" "$@" done $(pwd) $(pwd) then cd done
+	awk 2>/dev/null 2>/dev/null then cd 'quoted text' && cd
+		sed sed $(pwd) local 'quoted text' | done --verbose awk
+	-eu $(pwd) -eu awk --verbose /usr/bin done printf x=1 awk $(pwd)
+sed /usr/bin "$1" export sed "$@" export export -eu x=1 --verbose
+done "$@" sed | --verbose grep awk --verbose test test
+	'quoted text' printf cd ${HOME}
+test | awk printf awk 'quoted text' $(pwd) readonly
+		sed /usr/bin | $(pwd) -eu local local cd cd local cd done done grep --verbose
+readonly printf awk export 'quoted text'
+		export $(pwd) readonly sed awk
+		--verbose done test --verbose 2>/dev/null export x=1 export 'quoted text'
+printf cd /usr/bin cd awk "$@" "$@" echo done readonly export printf
+	-eu echo x=1 "$@" --verbose awk sed local
+	printf sed -eu cd export 'quoted text'
+		| "$1" done --verbose x=1 done awk local
+readonly awk sed | x=1 done $(pwd) grep
+	&& -eu ${HOME} 2>/dev/null then local test export --verbose | sed cd x=1
+echo printf /usr/bin 'quoted text' --verbose
+awk local local $(pwd) cd
+done 'quoted text' 2>/dev/null 'quoted text' /usr/bin 2>/dev/null
+		| readonly test grep x=1 --verbose awk 2>/dev/null
+	then $(pwd) 'quoted text' done test
+	$(pwd) --verbose local cd sed awk grep local "$@" $(pwd) --verbose x=1
+test cd readonly /usr/bin "$@" grep cd | export | sed "$1" ${HOME}
+x=1 && echo sed awk readonly
+'quoted text' sed grep -eu $(pwd) sed x=1 x=1 cd 'quoted text' then 'quoted text'
+		readonly /usr/bin -eu done /usr/bin ${HOME} $(pwd) done test
+test printf "$@" | export 2>/dev/null cd then export then "$1" grep
+"$@" echo echo local "$1" echo readonly 'quoted text'
+--verbose printf 2>/dev/null awk
+		echo test cd "$@" then echo $(pwd) readonly
+&& test 'quoted text' export /usr/bin test /usr/bin
+sed echo done x=1 readonly ${HOME} test ${HOME} sed done sed readonly
+		/usr/bin then /usr/bin --verbose
+	awk sed $(pwd) 2>/dev/null "$1" 2>/dev/null
+export grep "$@" test 'quoted text'
+	test test done -eu --verbose "$@"
+	'quoted text' export -eu then x=1 local
+		sed --verbose 'quoted text' echo
+	awk $(pwd) 'quoted text' export local awk local then export ${HOME}
+printf -eu --verbose echo test export
+$(pwd) then | readonly local export && -eu /usr/bin sed
+echo 'quoted text' && x=1 readonly ${HOME} awk x=1 readonly --verbose grep &&
+	"$@" grep cd then && sed
+	local echo export grep "$@" test done
+		done "$1" | awk 2>/dev/null x=1 --verbose awk
+	'quoted text' local | -eu printf cd test -eu "$@"
+		/usr/bin local test awk export
+		| grep local /usr/bin --verbose
+cd test readonly $(pwd) ${HOME}
+	"$@" cd x=1 echo --verbose 2>/dev/null 'quoted text' /usr/bin | sed
+	done "$1" --verbose -eu | cd awk sed -eu && x=1
+		local then test "$1" local printf sed printf
+| done test then 'quoted text' cd grep local awk then
+		2>/dev/null then local $(pwd) -eu --verbose
+		"$@" 2>/dev/null $(pwd) -eu test
+		${HOME} 'quoted text' awk ${HOME} | $(pwd) -eu 2>/dev/null
+	awk awk && x=1 | local ${HOME} export local echo export cd sed cd local grep
+		readonly -eu --verbose 2>/dev/null awk local
+	readonly 2>/dev/null grep
+"$@" export 'quoted text' readonly
+	&& then readonly done | /usr/bin done local ${HOME} export -eu cd -eu "$1" awk
+		x=1 $(pwd) --verbose echo done done --verbose grep 'quoted text' && "$@" sed
+		&& grep x=1 x=1 --verbose awk $(pwd) | done test
+		"$@" ${HOME} "$1" $(pwd) | -eu readonly
+		test $(pwd) /usr/bin ${HOME} ${HOME} sed -eu done $(pwd)
+grep sed && cd printf then printf | -eu sed cd awk
+	&& | printf then export 'quoted text'
+	"$@" readonly cd echo /usr/bin x=1 then $(pwd) printf "$@" && && x=1
+grep | then 'quoted text' ${HOME} echo && printf --verbose
+-eu grep local cd | -eu test
+printf awk echo | then test /usr/bin readonly grep | sed ${HOME} x=1 grep grep
+&& && "$@" done "$1" readonly 'quoted text' --verbose x=1 echo grep ${HOME} test
+'quoted text' 2>/dev/null /usr/bin test export test x=1 "$1" test test | /usr/bin
+	printf awk then local printf export x=1 2>/dev/null 'quoted text'
+	export echo export export local x=1 readonly
+		local printf && | $(pwd) test
+local "$@" awk -eu "$1" -eu echo
+export ${HOME} /usr/bin export | --verbose "$@" cd | -eu 'quoted text'
+then ${HOME} "$1" ${HOME} $(pwd) grep test printf 2>/dev/null grep -eu readonly
+	&& && echo 2>/dev/null local readonly "$@" -eu cd printf
+	${HOME} test readonly ${HOME} readonly done export printf cd --verbose | $(pwd)
+then "$@" printf sed test ${HOME} "$@" awk echo $(pwd)
+readonly readonly sed export cd && --verbose readonly printf "$@" awk --verbose
+		done 'quoted text' echo printf
+${HOME} readonly ${HOME} /usr/bin test -eu readonly grep x=1
+	echo done 'quoted text' echo done /usr/bin readonly done
+	printf test "$1" test 2>/dev/null ${HOME} cd then $(pwd) test export readonly
+	awk -eu "$@" local ${HOME} 'quoted text'
+--verbose "$1" "$@" export printf
+	&& sed x=1 'quoted text' 'quoted text' grep 2>/dev/null --verbose
+2>/dev/null "$@" sed x=1 done then cd
+	then grep done "$1" echo sed ${HOME} &&
+		export test test "$@" ${HOME} test | sed echo | local 'quoted text' "$@"
+echo 2>/dev/null local awk && ${HOME} export done
+	export test echo printf export awk sed "$1" "$1" "$@" "$@" "$1"
+		then then sed -eu awk export done 'quoted text' | 2>/dev/null $(pwd) cd then export
+	export export grep && readonly
+	test then /usr/bin test grep 'quoted text' 'quoted text' sed
+		2>/dev/null && export awk 'quoted text' | cd test
+	"$@" printf $(pwd) x=1 x=1 &&
+cd x=1 x=1 | then | local --verbose awk readonly
+| $(pwd) ${HOME} 2>/dev/null | then && local --verbose $(pwd) -eu echo grep
+echo x=1 'quoted text' | "$@" | awk echo test done cd export "$1" readonly echo
+export grep 2>/dev/null $(pwd) echo echo sed grep 'quoted text' local then &&
+"$1" x=1 "$1" readonly 2>/dev/null export 'quoted text' printf local
+	'quoted text' test local ${HOME} local cd awk printf local ${HOME} --verbose &&
+		readonly readonly grep --verbose export done 'quoted text' 'quoted text'
+		done | 2>/dev/null "$@" awk x=1 export 'quoted text' -eu printf then sed
+	export grep printf export
+		local then test export /usr/bin 'quoted text' 'quoted text' --verbose $(pwd)
+then 'quoted text' "$@" ${HOME} cd 2>/dev/null done
+	sed | | printf test awk readonly x=1
+	"$1" printf "$1" echo test readonly ${HOME}
+test done -eu awk "$@" printf grep $(pwd) "$@" 2>/dev/null
+echo printf "$@" ${HOME} grep local sed 2>/dev/null export done awk x=1 ${HOME}
+		printf 'quoted text' $(pwd)
+	&& export /usr/bin "$1" test ${HOME} sed && 2>/dev/null
+		grep "$1" local --verbose test grep $(pwd) awk -eu
+/usr/bin ${HOME} sed test done cd sed then printf then $(pwd)
+	--verbose awk && cd "$@" 'quoted text' cd
+		awk -eu /usr/bin ${HOME} /usr/bin 'quoted text'
+		awk "$1" ${HOME} "$@" && readonly local then "$1" then -eu export cd sed ${HOME}
+		export cd sed awk export $(pwd)
+	test "$1" local "$@" $(pwd)
+	'quoted text' then "$1" $(pwd) | "$1" x=1
+		readonly echo echo && /usr/bin 2>/dev/null export then $(pwd) echo /usr/bin "$@"
+	cd export "$1" grep done | readonly ${HOME} --verbose sed awk echo
+	"$@" "$@" printf 'quoted text' printf "$1" test printf
+	export sed grep readonly sed ${HOME} then grep
+	cd x=1 --verbose awk awk export "$1" done ${HOME} --verbose "$1" readonly -eu -eu
+grep /usr/bin /usr/bin
+		awk 'quoted text' sed grep --verbose "$@"
+&& grep | -eu readonly cd 2>/dev/null test 'quoted text' 2>/dev/null | 'quoted text'
+	${HOME} $(pwd) | ${HOME} done --verbose && then 2>/dev/null
+'quoted text' readonly 'quoted text' 2>/dev/null grep test 'quoted text' x=1
+readonly /usr/bin echo sed && $(pwd) -eu x=1 2>/dev/null 2>/dev/null
+/usr/bin sed "$1" /usr/bin 'quoted text' local ${HOME}
+	$(pwd) "$@" test -eu && then readonly
+echo grep 'quoted text' local grep --verbose then $(pwd) echo /usr/bin export
+	then local echo | --verbose -eu 2>/dev/null
+grep done -eu grep 'quoted text' local /usr/bin /usr/bin && 'quoted text'
+		readonly -eu then x=1 awk
+	/usr/bin -eu ${HOME} -eu grep 2>/dev/null grep awk 2>/dev/null
+local awk 'quoted text' --verbose awk printf x=1 then
+&& 'quoted text' "$1" "$@" cd cd awk && "$@" && test -eu grep
+		then awk --verbose /usr/bin local -eu readonly local export $(pwd)
+	'quoted text' readonly sed done x=1 then printf
+	$(pwd) done readonly 'quoted text' awk "$@" local sed test
+--verbose "$1" grep "$@" "$1"
+		"$1" x=1 readonly "$1" readonly --verbose readonly sed -eu | grep /usr/bin printf
+	'quoted text' done readonly readonly test 'quoted text'
+	"$@" "$@" 'quoted text' --verbose printf "$1" | /usr/bin sed
+	-eu grep "$1" sed "$@" readonly sed local 2>/dev/null
+	readonly grep x=1 "$1" done sed && | --verbose readonly
+"$@" --verbose 'quoted text' 2>/dev/null local awk -eu
+"$@" then -eu then "$1" sed &&
+	readonly 'quoted text'
+	then "$@" --verbose test cd cd readonly $(pwd)
+	printf --verbose && export | then | x=1 done sed grep
+	done done $(pwd) "$@" "$@" local 2>/dev/null local
+2>/dev/null -eu "$1" /usr/bin -eu readonly --verbose $(pwd) 2>/dev/null /usr/bin
+		test "$@" echo $(pwd) grep sed "$1" then 2>/dev/null done "$1" echo --verbose
+		awk export "$@" --verbose local then done x=1 sed readonly
+| 'quoted text' awk 2>/dev/null "$1" 'quoted text' | x=1 cd echo /usr/bin ${HOME}
+$(pwd) readonly 'quoted text'
+		x=1 echo /usr/bin echo "$1" $(pwd) printf printf export && /usr/bin
+	&& cd && 2>/dev/null printf
+then printf awk sed $(pwd) echo done --verbose echo done cd awk then
+	grep cd "$@" 'quoted text' cd grep 2>/dev/null export sed --verbose
+		done /usr/bin && /usr/bin test 'quoted text' cd done "$1" | 2>/dev/null
+	printf x=1 -eu /usr/bin cd
+2>/dev/null /usr/bin cd test sed test |
+	| awk cd cd done cd && "$@" export local ${HOME} --verbose grep
+		"$@" "$@" local x=1 then x=1 echo
+'quoted text' test local "$@" echo
+'quoted text' cd echo cd -eu 2>/dev/null
+--verbose awk test then cd /usr/bin && /usr/bin | readonly x=1 x=1
+		'quoted text' "$@" export readonly cd 2>/dev/null printf 'quoted text'
+done sed grep "$@" readonly -eu sed readonly
+	"$1" ${HOME} 'quoted text' $(pwd) local sed x=1 | 2>/dev/null local $(pwd)
+	$(pwd) cd readonly local printf echo readonly
+then 'quoted text' echo --verbose printf "$@" export && cd 2>/dev/null && grep 'quoted text'
+		test awk -eu && ${HOME} "$@" "$@" $(pwd)
+local $(pwd) x=1 sed cd
+		local done | export printf 'quoted text'
+	x=1 "$@" 2>/dev/null test local awk 'quoted text' --verbose "$@"
+		printf $(pwd) 2>/dev/null then echo test cd "$@" && local echo
+'quoted text' grep "$1" printf x=1 printf test 2>/dev/null ${HOME} $(pwd)
+	2>/dev/null "$@" /usr/bin /usr/bin local
+	readonly "$@" "$1" ${HOME} done $(pwd)
+		grep $(pwd) -eu --verbose 2>/dev/null -eu echo printf x=1
+		x=1 echo $(pwd) x=1 export echo local cd local export printf
+	grep --verbose | 'quoted text'
+readonly then cd ${HOME} sed export ${HOME} "$@" local
+	--verbose | 2>/dev/null printf "$@" ${HOME} x=1 -eu then -eu ${HOME} 'quoted text'
+		export done then && | readonly ${HOME} sed && sed
+	grep export "$1" awk "$@" "$1" $(pwd) grep
+		-eu local -eu ${HOME} $(pwd) x=1 export local x=1 $(pwd) echo $(pwd) done --verbose
+2>/dev/null 'quoted text' done ${HOME} then printf && grep awk "$1" /usr/bin
+		${HOME} test printf cd 'quoted text' export 2>/dev/null ${HOME} ${HOME} grep
+"$@" test 2>/dev/null awk cd | then test sed export test
+		$(pwd) done printf --verbose sed && echo && x=1 readonly export && export $(pwd)
+then printf 2>/dev/null export
+&& export -eu x=1 local /usr/bin awk then x=1 then 2>/dev/null && --verbose
+		--verbose cd "$1" | && sed "$1" awk --verbose 'quoted text'
+		cd "$@" done export cd 'quoted text' 'quoted text' x=1
+		awk ${HOME} done printf -eu $(pwd)
+		'quoted text' /usr/bin printf
+	then 2>/dev/null --verbose grep 2>/dev/null
+	echo sed $(pwd) $(pwd) cd "$@" && "$@" export
+		then awk /usr/bin readonly sed test x=1 done ${HOME}
+	$(pwd) -eu local sed | cd printf
+	grep awk $(pwd) echo -eu
+echo done ${HOME} /usr/bin /usr/bin
+	${HOME} grep done sed readonly "$1" test cd /usr/bin export 2>/dev/null printf 2>/dev/null
+		${HOME} 'quoted text' cd --verbose
+	/usr/bin "$1" local awk done printf /usr/bin awk 'quoted text' cd echo printf "$@"
+		then awk export echo cd awk test | sed --verbose done sed printf
+$(pwd) cd then "$1" $(pwd) x=1
+	'quoted text' ${HOME} cd /usr/bin echo "$1" printf
+2>/dev/null test $(pwd) export
+	cd "$@" "$1" ${HOME} "$1" 'quoted text' && $(pwd) | awk local | 2>/dev/null
+		x=1 then 2>/dev/null then
+	x=1 awk printf --verbose then && then
+		"$@" then /usr/bin sed export ${HOME} test awk local | -eu x=1 grep
+	-eu sed export | "$1" test export
+		then then x=1 grep echo local && 2>/dev/null awk export /usr/bin --verbose
+done export --verbose
+'quoted text' readonly -eu | x=1 printf test -eu
+		export x=1 local x=1 then sed | done && && | "$1" echo
+	awk ${HOME} && local test
+		x=1 export --verbose && x=1 echo echo && readonly
+"$1" readonly export local readonly | echo /usr/bin
+	| test /usr/bin export "$1" "$@" then $(pwd) | test
+grep awk grep 'quoted text'
+export printf echo -eu && | export ${HOME} && 'quoted text' test
+awk export readonly /usr/bin && x=1 "$1" $(pwd) cd ${HOME} x=1 done done --verbose
+x=1 ${HOME} "$@" && x=1 cd grep cd done echo cd --verbose $(pwd) done local
+	/usr/bin grep && --verbose -eu | ${HOME} && "$1" export awk "$1"
+2>/dev/null "$@" printf grep $(pwd) | "$1" && grep readonly printf | printf
+	"$1" --verbose done local grep $(pwd)
+		echo echo 'quoted text' export x=1 done readonly $(pwd)
+	grep local 2>/dev/null "$@" ${HOME}
+		${HOME} sed x=1 -eu echo
+		| echo awk "$1" "$@" awk grep --verbose done then "$@"
+	"$@" local grep --verbose 2>/dev/null && 'quoted text'
+		/usr/bin done awk "$1" && x=1 echo
+'quoted text' export test grep 'quoted text' 'quoted text' test then awk 'quoted text'
+		${HOME} $(pwd) "$@" cd --verbose 2>/dev/null x=1 test sed echo
+		| done grep && $(pwd)
+		"$1" 2>/dev/null 2>/dev/null export -eu ${HOME} printf $(pwd) -eu x=1 readonly
+2>/dev/null ${HOME} "$@" sed test "$1" awk
+		test readonly "$1" sed && export then $(pwd) x=1 export ${HOME} cd printf
+	--verbose echo test sed
+echo echo --verbose echo && "$@" test | local
+	awk "$1" export && cd && ${HOME} local 2>/dev/null done sed then export
+		export done done $(pwd) local export "$@" "$@" done $(pwd) awk /usr/bin awk $(pwd)
+		--verbose -eu export 'quoted text'
+	'quoted text' | readonly test "$@"
+	printf test -eu awk x=1 && grep printf | test export echo printf --verbose
+		done done "$@" 2>/dev/null x=1 $(pwd) --verbose $(pwd) ${HOME} /usr/bin
+'quoted text' | /usr/bin then && ${HOME} local
+		${HOME} awk echo "$@" echo sed test then echo "$1" awk 2>/dev/null then 2>/dev/null
+		--verbose 'quoted text' local | awk $(pwd) test
+		| readonly /usr/bin /usr/bin grep then done x=1 printf echo 'quoted text'
+	sed /usr/bin | -eu local sed ${HOME}
+2>/dev/null readonly x=1 cd test sed test
+done -eu /usr/bin /usr/bin test printf 'quoted text'
+		"$@" then echo --verbose | done "$@" test | cd ${HOME} sed export
+		"$@" | test grep "$1" sed then echo --verbose /usr/bin
+	| ${HOME} echo sed test /usr/bin readonly done grep local
+	export echo sed test readonly --verbose "$1" grep awk x=1 printf then
+'quoted text' printf grep
+/usr/bin -eu readonly printf 2>/dev/null test printf done -eu local then -eu
+		'quoted text' -eu 'quoted text' local --verbose then readonly
+	done | "$@" grep echo cd 2>/dev/null readonly local done | cd
+	-eu $(pwd) "$@" /usr/bin -eu readonly done /usr/bin then x=1 /usr/bin
+		done $(pwd) 'quoted text' /usr/bin $(pwd) echo done printf -eu local
+done ${HOME} then echo sed $(pwd) grep then "$@" awk export /usr/bin
+readonly "$@" then "$1" && echo && export test cd "$1"
+		'quoted text' local echo then cd ${HOME} /usr/bin 2>/dev/null cd
+'quoted text' $(pwd) && done "$1" echo cd grep --verbose
+	export test readonly readonly && export "$1"
+		grep test && 2>/dev/null readonly done "$@" export export | ${HOME} $(pwd) $(pwd)
+	awk | 'quoted text' then | export -eu then
+	sed "$1" x=1 local "$@" local 'quoted text'
+	"$@" && --verbose | 'quoted text' done export then &&
+$(pwd) && "$1" cd echo 2>/dev/null cd "$1" 'quoted text' 2>/dev/null
+	export grep "$@" test export --verbose
+	readonly ${HOME} export done 2>/dev/null grep local echo 2>/dev/null
+${HOME} sed done && sed readonly && local && local | export cd printf test $(pwd)
+sed printf -eu done 'quoted text' && x=1 -eu ${HOME} "$1" grep $(pwd) && export
+		done done --verbose then "$1"
+--verbose done local $(pwd) 'quoted text' cd x=1 2>/dev/null local printf -eu 2>/dev/null
+	readonly awk printf readonly /usr/bin printf --verbose echo -eu -eu
+-eu && test local 'quoted text'
+	awk echo test --verbose
+		/usr/bin awk 2>/dev/null done sed readonly printf 2>/dev/null
+	&& echo then ${HOME} grep echo cd sed | test /usr/bin
+	2>/dev/null local 2>/dev/null /usr/bin
+awk cd test /usr/bin | x=1
+	-eu -eu done sed x=1 && | && "$@" && 'quoted text'
+		2>/dev/null ${HOME} 'quoted text' 2>/dev/null
+	${HOME} 'quoted text' -eu test
+	/usr/bin export printf local $(pwd)
+${HOME} && /usr/bin cd x=1 --verbose 2>/dev/null local test
+		--verbose "$@" /usr/bin echo echo
+	then test | x=1 cd "$@" done done local "$1" "$@" sed --verbose 2>/dev/null
+	local awk 'quoted text' local test grep readonly readonly
+	printf x=1 then $(pwd)
+		'quoted text' test readonly
+		test cd /usr/bin cd local readonly
+	${HOME} echo export -eu "$@" $(pwd) $(pwd) readonly x=1 echo local "$@" ${HOME}
+		test grep 2>/dev/null done x=1 /usr/bin | test cd grep /usr/bin $(pwd) --verbose
+-eu 'quoted text' grep readonly --verbose x=1 &&
+$(pwd) printf local awk printf test cd cd ${HOME} "$1" export echo /usr/bin
+	$(pwd) 2>/dev/null $(pwd) test local
+	cd /usr/bin "$1" 'quoted text' done readonly | 'quoted text'
+		done sed $(pwd) done 2>/dev/null && awk
+	echo awk grep $(pwd) readonly
+| && grep "$1" && | && /usr/bin /usr/bin
+	awk 'quoted text' test "$1" "$@" then --verbose echo local sed 2>/dev/null
+	/usr/bin 'quoted text' printf | grep | $(pwd) cd -eu
+x=1 printf 'quoted text' "$@" 'quoted text' export | awk 'quoted text'
+	| cd printf "$1" x=1 cd export --verbose && | done 'quoted text'
+echo 'quoted text' sed /usr/bin $(pwd) done grep "$@" --verbose ${HOME}
+		$(pwd) "$@" /usr/bin readonly test cd "$1" $(pwd) printf $(pwd) test |
+done ${HOME} test test echo && cd --verbose done -eu &&
+		| readonly sed readonly sed
+		export readonly /usr/bin 2>/dev/null
+printf echo local then "$@" printf awk cd test "$@" grep /usr/bin local "$@"
+local "$@" 'quoted text' "$@" grep x=1 $(pwd) /usr/bin test cd done 2>/dev/null
+	'quoted text' done test sed printf --verbose ${HOME} cd grep "$@"
+		&& local then "$1" done --verbose grep cd awk cd 2>/dev/null
+local /usr/bin --verbose grep /usr/bin 2>/dev/null test /usr/bin --verbose
+grep $(pwd) && sed --verbose ${HOME} | test
+x=1 'quoted text' ${HOME} "$@" | echo
+		then "$1" --verbose --verbose x=1
+		grep printf | $(pwd) && export printf "$@" test 2>/dev/null
+$(pwd) done readonly "$1" ${HOME} 'quoted text' 'quoted text' readonly --verbose
+	readonly --verbose && sed sed ${HOME} -eu | ${HOME} test
+--verbose "$@" 'quoted text'
+		/usr/bin readonly export 2>/dev/null $(pwd) test cd
+	test ${HOME} ${HOME} ${HOME} ${HOME} && cd "$@" "$@" -eu && 2>/dev/null 2>/dev/null
+'quoted text' local 'quoted text' printf grep /usr/bin
+	| | test then local then | echo cd
+		local readonly x=1 grep /usr/bin echo echo readonly ${HOME}
+grep export grep 'quoted text' $(pwd) sed x=1 then -eu -eu printf awk | ${HOME}
+readonly && 'quoted text' local | "$@" grep
+export echo ${HOME} done test --verbose "$@" awk 2>/dev/null
+		printf | 2>/dev/null sed 2>/dev/null done "$1"
+"$@" done 'quoted text' echo --verbose local -eu
+		grep awk printf x=1 readonly "$@" then local cd cd cd x=1 local
+echo --verbose echo echo 'quoted text' | then then
+	2>/dev/null sed then readonly
+export then cd $(pwd) ${HOME} export "$@" ${HOME}
+	local -eu -eu local $(pwd) local grep echo /usr/bin
+	--verbose ${HOME} -eu test | -eu then
+"$@" && && echo 2>/dev/null "$@" grep --verbose /usr/bin sed cd then /usr/bin
+		${HOME} echo | /usr/bin ${HOME} "$1"
+export -eu echo ${HOME} 2>/dev/null awk
+		$(pwd) 'quoted text' readonly done printf "$@" printf $(pwd) --verbose
+	$(pwd) echo cd awk export sed 'quoted text' "$@" cd "$1" "$@" sed sed
+	echo x=1 done ${HOME} export local ${HOME} grep -eu "$@" test
+	sed readonly sed && awk grep test -eu grep test sed local 2>/dev/null
+		2>/dev/null done | 2>/dev/null echo echo echo x=1
+	grep --verbose echo /usr/bin "$@" local -eu x=1 awk printf
+sed | echo x=1 local cd
+	--verbose cd local grep grep /usr/bin && "$1" --verbose export | local | "$@"
+	cd echo export local 2>/dev/null printf readonly x=1
+		local printf -eu -eu sed done "$1" 2>/dev/null --verbose readonly
+		${HOME} && 2>/dev/null then sed | $(pwd) && $(pwd) echo $(pwd)
+	export local printf --verbose grep ${HOME} readonly 2>/dev/null
+	sed x=1 -eu "$@" "$1" $(pwd) cd -eu then -eu
+'quoted text' local export && export readonly readonly 2>/dev/null "$1" cd "$1"
+	echo export local printf
+		${HOME} done /usr/bin cd "$1" grep test 2>/dev/null awk
+	sed --verbose printf export readonly --verbose
+		"$1" printf echo --verbose
+local 2>/dev/null local grep cd grep -eu grep test | $(pwd) /usr/bin
+	then cd && 2>/dev/null 2>/dev/null
+	--verbose cd x=1 "$@" cd printf cd test export local x=1
+grep "$1" 2>/dev/null cd readonly
+		sed local local sed | awk && "$1" $(pwd) | local && local "$@" local
+	done ${HOME} | local readonly
+	"$@" readonly then "$@" grep readonly then readonly export
+		echo printf awk cd && awk awk $(pwd) "$1" awk done 'quoted text' | ${HOME} readonly
+		printf -eu cd x=1 export local sed printf printf done echo test then
+"$1" /usr/bin sed local done readonly echo $(pwd)
+${HOME} echo 'quoted text' echo export x=1 2>/dev/null 'quoted text' x=1 "$@"
+		echo readonly 'quoted text' --verbose
+awk echo /usr/bin ${HOME}
+-eu "$@" --verbose && done sed 'quoted text' "$1" done && &&
+		echo ${HOME} | && $(pwd) export
+export ${HOME} x=1 done printf "$@" cd 'quoted text' $(pwd)
+	'quoted text' done test cd then local &&
+	"$@" $(pwd) | "$@" x=1
+		${HOME} ${HOME} -eu cd | -eu -eu /usr/bin && | cd printf ${HOME} -eu echo
+"$1" export echo export -eu && awk printf readonly grep cd
+	then && | | 2>/dev/null "$@" "$@" printf $(pwd) --verbose --verbose
+		"$@" "$1" x=1 | grep
+		export | done cd x=1 /usr/bin | && then printf 2>/dev/null
+/usr/bin | 'quoted text' --verbose --verbose | --verbose && 2>/dev/null test
+	x=1 | local export local sed -eu grep x=1 "$1" -eu readonly
+		2>/dev/null $(pwd) 2>/dev/null 2>/dev/null
+$(pwd) 'quoted text' grep awk sed
+	"$@" sed 'quoted text'
+"$1" test -eu /usr/bin awk local /usr/bin | &&
+	local done cd cd --verbose
+		sed x=1 test ${HOME} | -eu
+		cd local cd then printf cd cd -eu 'quoted text' x=1 done test
+	2>/dev/null echo echo printf printf 'quoted text' then 2>/dev/null printf
+		test awk test 2>/dev/null $(pwd) printf && | done -eu awk
+		readonly printf | -eu "$1" "$@" 2>/dev/null "$1" /usr/bin | $(pwd)
+printf sed echo && awk | | && cd readonly test test then done done done 'quoted text'
+x=1 grep readonly | && ${HOME} /usr/bin grep done done | awk printf
+		readonly -eu cd | printf echo x=1 grep cd "$1" ${HOME} "$1" $(pwd)
+cd -eu "$1" | export x=1 "$@" test | --verbose export cd /usr/bin local export
+		grep printf $(pwd) x=1 "$@" /usr/bin
+$(pwd) ${HOME} then | local then | echo
+		2>/dev/null local cd 2>/dev/null
+		printf --verbose | 2>/dev/null "$1" /usr/bin
+	"$1" /usr/bin done export --verbose -eu readonly then 'quoted text'
+then printf test x=1 printf local local --verbose
+		then "$@" test awk export $(pwd) --verbose
+	grep x=1 'quoted text' && echo test grep "$@" done --verbose
+sed 'quoted text' | local export 'quoted text'
+		then "$1" 'quoted text' "$@" grep /usr/bin echo echo
+		${HOME} cd 2>/dev/null /usr/bin
+x=1 -eu ${HOME} then awk "$@" export echo awk awk export readonly
+		| then sed local local export printf
+awk "$@" awk 2>/dev/null --verbose
+		readonly "$@" sed local ${HOME} ${HOME}
+	echo export /usr/bin "$@" "$1" && then 2>/dev/null local | -eu "$@"
+	echo export x=1 && export grep "$@"
+echo && ${HOME} test local && test test test awk /usr/bin /usr/bin
+		grep grep test "$1" readonly export
+		${HOME} local x=1 cd | --verbose sed local "$1" then local 2>/dev/null 2>/dev/null
+echo "$@" readonly ${HOME} && then "$1" "$@"
+	${HOME} then | local $(pwd) local
+		${HOME} "$@" "$@" readonly ${HOME} 2>/dev/null sed awk local -eu readonly
+--verbose local echo cd ${HOME} 'quoted text' printf -eu
+	printf printf ${HOME} readonly 'quoted text' 'quoted text' printf | -eu "$@" | sed
+		"$@" "$1" export && | 2>/dev/null awk grep /usr/bin echo 'quoted text'
+		&& then sed /usr/bin sed $(pwd) 2>/dev/null sed /usr/bin
+	export ${HOME} sed -eu printf echo x=1 printf && test /usr/bin awk echo x=1
+&& 'quoted text' "$1" local | awk ${HOME} test --verbose done && /usr/bin local
+	echo then "$@" /usr/bin printf printf printf -eu 'quoted text' then
+	x=1 done $(pwd) $(pwd) export "$@" x=1 grep x=1 "$1" --verbose $(pwd)
+		done echo $(pwd) ${HOME} | x=1 grep sed | ${HOME} ${HOME} echo done ${HOME}
+	readonly done cd printf sed
+	awk | echo && test $(pwd) test cd -eu /usr/bin export echo export /usr/bin readonly
+export echo sed done local cd done echo grep cd echo grep
+then -eu export sed grep /usr/bin echo
+		echo "$@" "$1" 2>/dev/null readonly $(pwd)
+		/usr/bin then awk echo grep
+cd awk readonly && grep export printf readonly
+	$(pwd) --verbose $(pwd) "$1" printf test grep done local local export "$1" grep
+local export sed 2>/dev/null awk ${HOME} ${HOME}
+	2>/dev/null 2>/dev/null test | sed sed grep cd done
+		local -eu $(pwd) printf sed /usr/bin
+		| printf /usr/bin awk x=1 | 2>/dev/null && 2>/dev/null cd sed
+		sed "$1" 2>/dev/null 2>/dev/null sed
+		printf grep sed awk $(pwd) /usr/bin $(pwd)
+		2>/dev/null test /usr/bin echo $(pwd) awk -eu && cd export | "$1" $(pwd) sed
+done done --verbose ${HOME} done echo local test "$1" "$@" cd
+'quoted text' then /usr/bin /usr/bin readonly x=1 echo export "$@" /usr/bin
+		readonly echo "$1" done && ${HOME}
+then done echo cd echo -eu then sed && | echo /usr/bin export x=1 test local
+	"$1" | "$1" export && echo
+sed sed && local readonly --verbose ${HOME} awk 'quoted text'
+test awk 2>/dev/null 'quoted text' "$@" -eu "$1" local test ${HOME}
+'quoted text' sed && printf /usr/bin
+${HOME} "$@" $(pwd) awk 'quoted text'
+	readonly local "$1" grep local export "$@" 'quoted text' | test 2>/dev/null | --verbose
+test export "$1" x=1 echo --verbose /usr/bin 2>/dev/null echo
+		/usr/bin grep --verbose 2>/dev/null sed
+grep export $(pwd) done --verbose then && sed cd /usr/bin
+${HOME} then cd x=1 -eu x=1
+		| test "$1" $(pwd) awk --verbose | export && | then printf grep export
+		grep grep sed done "$1" local 'quoted text' "$@" /usr/bin
+		| echo echo awk --verbose --verbose ${HOME} --verbose
+	awk local --verbose cd echo ${HOME} echo && x=1 printf && ${HOME} ${HOME}
+	"$@" test | 'quoted text' printf
+		2>/dev/null sed -eu | export export then printf && "$@"
+	grep && "$1" | grep --verbose then "$1" | 'quoted text' x=1 readonly awk grep
+printf awk "$@" ${HOME} 2>/dev/null &&
+	$(pwd) -eu done | cd test -eu "$1" echo cd ${HOME}
+	${HOME} echo grep --verbose "$1" test ${HOME} cd test then
+awk /usr/bin /usr/bin then
+		$(pwd) export test 2>/dev/null
+		| done local readonly /usr/bin readonly local done awk "$@" readonly
+	/usr/bin test grep sed cd export 2>/dev/null then grep sed 'quoted text' echo
+	"$1" 2>/dev/null "$@" x=1 "$@" | cd x=1 grep "$@" readonly
+		done /usr/bin x=1 2>/dev/null readonly readonly printf "$@" grep
+		readonly export 'quoted text' $(pwd) done readonly "$@" awk
+	&& awk -eu -eu grep sed local --verbose
+	printf printf awk cd readonly grep awk sed
+	/usr/bin "$@" export printf "$@" $(pwd) "$@" then
+		readonly cd "$@" echo
+	cd readonly /usr/bin awk 'quoted text' awk cd 2>/dev/null awk echo echo test
+done /usr/bin awk ${HOME} cd ${HOME} "$@" printf
+&& readonly "$@" 'quoted text' export /usr/bin && printf
+		awk awk grep | | sed test | cd sed "$@" cd printf
+"$@" readonly grep cd x=1 readonly ${HOME}
+grep then --verbose done x=1 sed
+		test 'quoted text' then sed export
+	'quoted text' local --verbose && done 2>/dev/null --verbose cd
+	export cd | --verbose readonly awk 2>/dev/null test local test
+-eu "$@" --verbose export readonly
+	| then readonly export test cd cd then then /usr/bin
+grep -eu -eu --verbose "$1" local | local /usr/bin
+		awk && done | cd export "$1" cd grep $(pwd) grep echo readonly
+| --verbose local export done done awk export && --verbose ${HOME}
+		printf --verbose "$@"
+x=1 local x=1 "$1" $(pwd) "$1" /usr/bin
+		x=1 /usr/bin /usr/bin test
+readonly awk ${HOME} && $(pwd) --verbose
+awk done test echo ${HOME} 'quoted text' ${HOME} 'quoted text' grep printf grep
+cd done sed 2>/dev/null grep /usr/bin then printf sed ${HOME} printf
+		/usr/bin cd $(pwd) grep | --verbose "$1"
+		done | $(pwd) | readonly
+	done 2>/dev/null /usr/bin 2>/dev/null 'quoted text' export echo printf --verbose
+	grep 'quoted text' readonly -eu then echo 2>/dev/null
+"$@" test /usr/bin sed
+$(pwd) awk "$1" /usr/bin 'quoted text' test cd /usr/bin
+	"$@" awk /usr/bin x=1
+	then sed 2>/dev/null export grep
+x=1 done sed export sed && 'quoted text' then $(pwd) ${HOME} $(pwd) "$@"
+	test /usr/bin "$1" then export --verbose | -eu
+		cd local && test ${HOME} done test 'quoted text' ${HOME}
+	local test $(pwd) echo ${HOME} 'quoted text' x=1 $(pwd) printf test printf
+	cd then then 'quoted text' test | export
+	done && --verbose grep awk && x=1 2>/dev/null done sed
+		awk x=1 ${HOME} export test 2>/dev/null "$1" test export sed readonly
+	-eu test cd | local ${HOME} "$1" test 2>/dev/null -eu awk local readonly 2>/dev/null
+	readonly local test | grep 'quoted text' -eu printf test /usr/bin /usr/bin
+readonly cd done -eu /usr/bin done cd "$1" done $(pwd) test
+	then awk | "$@" 2>/dev/null readonly sed export /usr/bin /usr/bin local $(pwd)
+		${HOME} echo | readonly awk x=1 ${HOME} sed
+	export /usr/bin readonly awk done grep export "$@" then awk local
+	"$@" && 'quoted text' then ${HOME} "$1" awk -eu "$@" $(pwd) 'quoted text'
+grep grep ${HOME} done done ${HOME} done
+x=1 sed --verbose -eu x=1 done test grep 'quoted text'
+		done "$@" /usr/bin "$1" 'quoted text' readonly && sed 2>/dev/null |
+	grep grep x=1 "$@" awk test then &&
+| 'quoted text' export -eu && cd /usr/bin
+then cd x=1 && cd /usr/bin sed 'quoted text'
+		printf then /usr/bin -eu $(pwd) -eu done cd sed x=1 -eu local
+	--verbose 'quoted text' done export readonly "$@" --verbose | then /usr/bin 2>/dev/null
+	test $(pwd) "$1" /usr/bin
+	2>/dev/null | echo "$@" $(pwd) echo /usr/bin /usr/bin "$@" test -eu ${HOME} grep
+	/usr/bin sed "$1" 'quoted text' x=1 -eu cd $(pwd) local 'quoted text' "$1"
+grep then export then readonly 'quoted text' | cd ${HOME}
+	| -eu "$1" grep 2>/dev/null local "$1" 2>/dev/null
+		-eu then awk echo local "$@"
+	awk "$1" 2>/dev/null |
+"$1" "$1" "$1" 'quoted text' | | $(pwd) export sed /usr/bin
+"$@" echo test --verbose sed awk x=1 x=1 echo 2>/dev/null grep export
+readonly done 'quoted text' 2>/dev/null && 2>/dev/null grep grep cd echo
+	${HOME} test readonly --verbose sed test local 2>/dev/null local x=1 local
+	| $(pwd) echo readonly -eu | x=1 cd x=1 printf cd export 'quoted text' local
+	readonly grep sed --verbose done grep
+	'quoted text' "$1" | printf sed local done local then && && local 2>/dev/null
+	sed | then "$@" "$@" cd printf "$@" awk echo | awk local sed
+| /usr/bin | readonly 'quoted text' local && && "$@" done printf "$1" ${HOME}
+		--verbose test readonly sed 2>/dev/null
+		then && $(pwd) sed "$@" export 'quoted text'
+		x=1 && echo grep 'quoted text' "$1" echo -eu awk 'quoted text' | then /usr/bin local
+then && printf grep test cd -eu 'quoted text'
+/usr/bin $(pwd) && "$@" "$@" grep done "$@" sed && -eu "$@" cd | printf
+sed && 'quoted text' --verbose | sed && 'quoted text' "$1" |
+		&& export then test x=1 -eu -eu "$1" && |
+2>/dev/null x=1 "$1" awk done 2>/dev/null
+	"$1" /usr/bin done printf
+		/usr/bin x=1 x=1 && test |
+${HOME} done "$@" export "$1" then /usr/bin awk -eu /usr/bin local test | done "$1"
+		&& done ${HOME} grep done --verbose readonly ${HOME} echo export grep awk local
+	printf awk "$1" echo test awk echo test -eu --verbose printf "$1" $(pwd)
+x=1 && test ${HOME} cd local && then | test /usr/bin readonly
+	test | printf "$@" local cd export ${HOME} grep "$@" grep 'quoted text' then "$1"
+	x=1 then "$1" readonly /usr/bin
+		${HOME} 'quoted text'
+&& && $(pwd) local $(pwd) && x=1
+		"$@" x=1 x=1 x=1 printf done then echo --verbose
+| | 'quoted text' awk | 2>/dev/null readonly printf sed -eu | echo printf
+grep && readonly "$@" local && done /usr/bin $(pwd) cd printf | && | "$1" awk awk
+export 'quoted text' done -eu grep --verbose sed $(pwd) 'quoted text' done cd
+cd echo /usr/bin 2>/dev/null -eu printf echo then
+	'quoted text' "$1" "$1" && ${HOME} local test test 2>/dev/null
+		readonly awk --verbose --verbose $(pwd)
+done | echo && grep echo $(pwd)
+	then awk && | grep "$1" local --verbose "$1" cd echo test 'quoted text'
+	sed readonly export 2>/dev/null readonly cd grep && /usr/bin then --verbose sed
+printf x=1 sed ${HOME} && "$1" /usr/bin
+	'quoted text' -eu local export awk cd ${HOME} local $(pwd)
+echo local done then 'quoted text'
+export done $(pwd) x=1 done | test -eu "$@" ${HOME} x=1 printf export
+		echo --verbose grep -eu && sed cd x=1 && |
+	then done --verbose -eu ${HOME} local export -eu grep --verbose "$1" --verbose
+	awk printf test echo 2>/dev/null done ${HOME} --verbose sed sed then --verbose
+		grep x=1 echo --verbose readonly export x=1 cd grep
+'quoted text' cd done readonly x=1 ${HOME} && awk done $(pwd) /usr/bin
+		printf --verbose then "$1"
+		grep --verbose awk local printf --verbose echo -eu && printf --verbose "$1"
+	echo ${HOME} awk printf $(pwd)
+$(pwd) grep local printf
+	${HOME} && echo cd grep awk cd "$@" | && -eu 'quoted text' x=1 -eu
+		2>/dev/null ${HOME} cd /usr/bin 'quoted text'
+"$@" local $(pwd) /usr/bin "$1" local then /usr/bin test --verbose test readonly
+		grep /usr/bin ${HOME} --verbose printf test --verbose "$1" awk "$1" done x=1 $(pwd)
+| sed grep $(pwd) then $(pwd) x=1 printf done export sed
+		export "$1" done $(pwd) 2>/dev/null 'quoted text' ${HOME} &&
+		cd /usr/bin test local "$1" test && 2>/dev/null readonly 'quoted text'
+sed awk && ${HOME} test
+	test ${HOME} export 2>/dev/null echo grep "$1" export x=1 echo
+--verbose && local sed
+x=1 cd test echo | "$@" then done sed
+		-eu export export test printf done 'quoted text' -eu && readonly
+local /usr/bin then sed x=1 x=1 local --verbose
+		printf local -eu done test printf && -eu printf 2>/dev/null x=1 -eu
+	grep -eu echo awk test then "$1" local 2>/dev/null ${HOME} 'quoted text'
+	&& $(pwd) --verbose then -eu "$1" ${HOME} --verbose ${HOME} printf local grep
+		'quoted text' /usr/bin echo | grep then 2>/dev/null
+	| echo $(pwd) awk -eu done printf export
+	awk echo test ${HOME} local "$@" echo grep x=1 x=1 --verbose awk sed $(pwd) --verbose
+&& readonly awk cd echo done local then done "$@" done ${HOME} 'quoted text'
+	done export 'quoted text' export $(pwd) echo 2>/dev/null
+$(pwd) x=1 | x=1 sed printf done export 'quoted text' 'quoted text' | done
+	2>/dev/null 'quoted text' echo /usr/bin ${HOME} $(pwd) /usr/bin
+&& "$@" "$1" -eu cd sed ${HOME}
+sed "$1" echo cd grep printf export readonly done sed then "$1" done then x=1 sed
+&& then grep awk 2>/dev/null $(pwd) x=1 done ${HOME} grep 2>/dev/null
+		readonly cd then -eu grep 'quoted text' -eu then "$@" 'quoted text'
+sed 2>/dev/null "$1" echo
+	local test "$@" "$@" && $(pwd) && local 'quoted text' printf sed
+		${HOME} echo /usr/bin grep -eu && 'quoted text' $(pwd) test cd sed "$@"
+| export /usr/bin 2>/dev/null done export --verbose
+	${HOME} && local local echo
+done readonly | 'quoted text'
+		/usr/bin "$@" sed 'quoted text'
+	x=1 | "$@" "$@" && export cd
+		/usr/bin /usr/bin | | "$1" then done "$1" grep /usr/bin local cd then
+awk test && /usr/bin echo "$@" && | export
+	printf "$1" --verbose 2>/dev/null 2>/dev/null ${HOME} cd done "$1" readonly ${HOME}
+$(pwd) grep 2>/dev/null ${HOME} local --verbose "$1" "$@"
+		2>/dev/null test done export local | 'quoted text'
+		--verbose sed x=1 printf printf sed grep | "$@" cd ${HOME} printf printf export
+	sed local $(pwd) --verbose export printf 2>/dev/null grep | readonly
+		/usr/bin awk local done 'quoted text' printf test 'quoted text' grep printf done
+	-eu cd test test ${HOME} export "$@" test -eu echo grep echo 2>/dev/null
+${HOME} "$@" "$@" | cd echo awk test x=1 awk --verbose sed
+	export then | x=1 done cd --verbose
+		x=1 cd done printf 'quoted text'
+		export && echo echo awk echo readonly | && done done 2>/dev/null grep 2>/dev/null
+	/usr/bin ${HOME} | --verbose && | done "$@" "$1" "$@" "$@"
+done echo test -eu printf "$@" cd awk export test echo local ${HOME} $(pwd)
+	| --verbose export x=1 $(pwd) cd x=1 --verbose 'quoted text' cd grep echo readonly
+		'quoted text' test /usr/bin
+/usr/bin | cd --verbose then awk echo echo | echo --verbose grep printf test
+	awk awk awk "$1" printf done sed grep $(pwd) cd $(pwd)
+	export "$1" /usr/bin 2>/dev/null cd
+	sed then echo "$@" sed sed sed && printf test then
+	"$1" export "$1" printf ${HOME}
+	done "$@" -eu readonly $(pwd)
+		--verbose done ${HOME} "$1" x=1
+		2>/dev/null 'quoted text' local 2>/dev/null grep $(pwd) $(pwd) -eu -eu | export
+export local --verbose test grep --verbose --verbose export x=1 printf "$@"
+		test sed grep then |
+	grep sed sed local test local $(pwd) ${HOME} sed && 'quoted text' x=1 "$1" awk
+		sed -eu awk ${HOME} test
+		-eu sed "$@" readonly cd x=1 && export export cd local printf local 2>/dev/null
+cd sed done && echo grep export readonly -eu -eu $(pwd) readonly
+	"$@" x=1 test && x=1 'quoted text' 2>/dev/null
+	"$@" 2>/dev/null test $(pwd) "$@" 'quoted text' --verbose
+		export "$@" printf readonly x=1 | grep "$@" 'quoted text'
+		echo | test "$1" printf grep ${HOME} 2>/dev/null | test local done | echo /usr/bin
+--verbose 'quoted text' grep local | cd "$@"
+	done printf 2>/dev/null
+| /usr/bin sed --verbose then local -eu
+		&& && -eu test echo readonly test x=1
+		local -eu /usr/bin export "$1" ${HOME} sed |
+	sed grep 'quoted text' then sed
+"$@" export local 'quoted text' && export printf
+	${HOME} --verbose $(pwd) awk ${HOME} $(pwd) "$1" echo grep /usr/bin sed
+	awk ${HOME} then | sed local "$@" local
+		x=1 local /usr/bin x=1 done then ${HOME}
+2>/dev/null export --verbose | awk awk local -eu ${HOME} then "$1" sed
+		then local "$@" echo cd readonly grep awk sed
+		/usr/bin -eu export sed
+	export cd awk sed "$1" | readonly done 'quoted text' /usr/bin cd then --verbose
+	cd sed echo printf printf | "$@" | awk test -eu /usr/bin printf $(pwd) 'quoted text'
+	"$1" $(pwd) x=1 cd then test awk sed | && test cd done done |
+sed ${HOME} echo "$1" -eu ${HOME} | cd "$1"
+		local grep readonly echo x=1
+	printf x=1 --verbose "$@" | | export export x=1 test
+local | | export cd "$@" awk 'quoted text' --verbose --verbose "$@"
+${HOME} $(pwd) "$@" -eu printf local sed /usr/bin 'quoted text'
+/usr/bin -eu -eu cd test cd cd $(pwd)
+	export readonly "$1" grep local sed 2>/dev/null "$1" sed ${HOME} echo
+		-eu "$1" export grep readonly local grep -eu
+	&& ${HOME} --verbose -eu printf $(pwd) then printf test ${HOME}
+local cd 2>/dev/null "$1" --verbose
+	sed sed awk test printf "$1" -eu sed then printf export echo "$1" "$1" /usr/bin
+	test "$1" echo awk $(pwd) then cd sed
+		'quoted text' "$@" echo 'quoted text' $(pwd)
+	/usr/bin echo printf readonly readonly
+x=1 ${HOME} $(pwd) then ${HOME} printf /usr/bin
+		printf echo ${HOME} ${HOME} /usr/bin
+done export then sed /usr/bin done 'quoted text'
+local && && $(pwd) | export && export done
+	sed test $(pwd) "$@" /usr/bin readonly awk readonly
+	--verbose $(pwd) x=1 export
+--verbose then awk awk awk then 'quoted text' echo grep echo /usr/bin
+then --verbose test "$@" readonly readonly "$@"
+grep 2>/dev/null sed echo test then grep --verbose
+awk grep awk /usr/bin then /usr/bin && -eu "$1" sed ${HOME} ${HOME} "$@"
+	grep $(pwd) $(pwd) test | test then &&
+| --verbose "$@" local $(pwd) | cd grep | awk awk "$1" "$1" printf
+		export local printf printf then echo export done 'quoted text'
+echo then readonly done $(pwd) cd "$@" x=1 /usr/bin
+sed 'quoted text' x=1 readonly
+		readonly export readonly
+readonly then "$@" readonly "$1" 'quoted text' awk awk
+	| "$1" ${HOME} $(pwd) "$1" cd done cd sed --verbose "$@" --verbose
+	echo | x=1 local then 2>/dev/null printf echo test -eu "$1" "$@" test echo &&
+		sed 2>/dev/null ${HOME}
+	grep then x=1 | local && readonly
+		&& awk /usr/bin -eu readonly sed ${HOME}
+		printf ${HOME} /usr/bin then sed grep
+echo /usr/bin echo printf -eu done && /usr/bin local 2>/dev/null
+	done then ${HOME} | readonly awk $(pwd) readonly x=1 x=1 --verbose
+		$(pwd) ${HOME} $(pwd) printf "$@"
+	readonly echo readonly "$@" then
+	"$@" /usr/bin export sed $(pwd) -eu echo | "$1" export "$1" --verbose done &&
+cd "$@" --verbose printf 2>/dev/null "$1" | sed --verbose
+	printf "$@" done done local | --verbose grep $(pwd) "$@" --verbose
+		export 2>/dev/null done grep grep printf
+	/usr/bin "$@" readonly | printf grep | export
+		test export local | awk "$1" "$1"
+	cd 'quoted text' "$@" "$@" --verbose $(pwd) test --verbose printf
+readonly test && grep printf
+		"$1" x=1 -eu sed local $(pwd) -eu /usr/bin readonly
+"$1" --verbose 'quoted text' 'quoted text' x=1
+	'quoted text' test awk
+		readonly done export test | "$@" done then $(pwd) awk -eu -eu --verbose
+	"$@" grep && "$@" $(pwd) x=1 "$1" -eu done
+local readonly "$@" awk 2>/dev/null --verbose grep 2>/dev/null readonly
+	${HOME} local export --verbose then ${HOME} -eu x=1 printf test
+--verbose "$@" printf 2>/dev/null readonly export $(pwd) && "$1"
+	"$@" "$1" grep | 2>/dev/null $(pwd) $(pwd) echo ${HOME} sed ${HOME} 2>/dev/null
+	'quoted text' grep sed cd "$1" sed && /usr/bin
+		echo echo | test done readonly $(pwd) --verbose --verbose 'quoted text'
+	2>/dev/null /usr/bin cd 2>/dev/null
+grep ${HOME} printf echo readonly x=1 done local local printf grep
+	$(pwd) readonly "$1"
+		&& test readonly --verbose echo echo 2>/dev/null sed grep --verbose
+		$(pwd) | echo echo "$1" cd test
+-eu grep sed test x=1 ${HOME} --verbose $(pwd)
+		"$@" --verbose $(pwd) sed readonly local -eu test
+		--verbose sed "$1" awk readonly && /usr/bin test grep
+		export 'quoted text' 2>/dev/null -eu $(pwd)
+	'quoted text' x=1 | -eu "$@" "$1" "$@" echo
+2>/dev/null 2>/dev/null done $(pwd) local /usr/bin
+"$1" && -eu echo awk "$1" sed readonly "$1" && cd "$@" awk sed readonly test
+		--verbose then then x=1 $(pwd) 2>/dev/null --verbose cd
+${HOME} $(pwd) 'quoted text' export readonly
+"$@" 'quoted text' 'quoted text' -eu "$1" ${HOME} /usr/bin test cd "$@"
+	then awk && | ${HOME} sed
+		-eu ${HOME} ${HOME} "$1" x=1 test x=1 echo "$@" test readonly $(pwd)
+&& awk grep then readonly "$@" readonly ${HOME} export
+		"$@" | sed readonly echo
+	${HOME} -eu -eu then $(pwd) echo --verbose $(pwd) ${HOME} | 'quoted text'
+'quoted text' export --verbose echo
+		2>/dev/null "$@" awk printf --verbose -eu /usr/bin cd readonly "$1"
+		/usr/bin cd sed "$@" 2>/dev/null | test ${HOME} export x=1
+	awk awk "$1" 2>/dev/null -eu awk export readonly grep sed --verbose
+x=1 "$1" 'quoted text' 'quoted text' --verbose
+		"$1" export sed export /usr/bin grep readonly 'quoted text' "$@" sed
+		echo grep 'quoted text' | echo then export /usr/bin
+		grep $(pwd) cd export cd "$1" /usr/bin cd | grep x=1 | 'quoted text'
+	&& printf && sed "$1" cd ${HOME} "$@" /usr/bin | $(pwd) sed 'quoted text'
+	/usr/bin "$1" && -eu x=1 echo cd done "$@" "$@" 2>/dev/null /usr/bin | awk export
+then export | --verbose "$1" $(pwd)
+--verbose cd echo echo x=1
+sed x=1 local "$1" "$@" echo && export 'quoted text'
+readonly grep grep echo awk test test test
+		printf | done awk -eu printf echo "$1" |
+readonly echo -eu x=1 2>/dev/null && x=1 echo local readonly 2>/dev/null
+		sed "$@" 2>/dev/null 2>/dev/null $(pwd) x=1 cd echo
+		-eu sed "$1" test 'quoted text' -eu
+	readonly /usr/bin "$@" /usr/bin && 'quoted text' -eu done x=1 awk export
+sed cd export echo && "$@" test --verbose /usr/bin
+	done test grep $(pwd) awk $(pwd) grep "$@" done printf 2>/dev/null |
+export test $(pwd) /usr/bin && cd "$1" 'quoted text'
+"$@" local awk 2>/dev/null cd && cd local readonly 'quoted text'
+	"$@" && /usr/bin | cd awk ${HOME} awk echo ${HOME} | /usr/bin cd then
+	2>/dev/null 'quoted text' sed awk readonly ${HOME} ${HOME} export -eu test grep
+		"$@" export $(pwd) test 'quoted text' cd then export
+printf done echo printf && then && done "$@" --verbose
+grep awk echo readonly printf "$@" readonly | /usr/bin
+		export /usr/bin echo && then sed --verbose "$1" test printf
+-eu ${HOME} local --verbose ${HOME} test readonly export x=1 ${HOME} printf
+		${HOME} printf $(pwd) printf 2>/dev/null && "$1" 'quoted text'
+readonly cd readonly
+	then sed awk printf printf ${HOME} ${HOME} x=1 local ${HOME}
+/usr/bin awk && printf
+		"$@" | --verbose local ${HOME} | ${HOME} readonly
+echo sed -eu | | ${HOME} 'quoted text'
+'quoted text' awk /usr/bin readonly sed readonly
+	'quoted text' readonly | "$1" echo 2>/dev/null x=1 && --verbose readonly grep
+	${HOME} && -eu "$1" awk x=1
+done export x=1 'quoted text' $(pwd) 2>/dev/null then sed local
+	echo 'quoted text' local ${HOME}
+		x=1 /usr/bin 'quoted text' export && | export export printf $(pwd)
+	| /usr/bin x=1 'quoted text'
+	'quoted text' test | readonly -eu "$1" --verbose local sed /usr/bin local -eu
+		printf 2>/dev/null 2>/dev/null
+2>/dev/null printf echo then done
+grep --verbose -eu echo grep echo "$1" $(pwd) done $(pwd) readonly "$1" local
+	--verbose sed printf export readonly /usr/bin echo awk 'quoted text'
+	--verbose cd "$1" --verbose export
+		--verbose "$1" test export
+	printf test ${HOME} && && grep printf sed x=1 x=1 && x=1 && "$@"
+printf /usr/bin && echo | $(pwd) sed /usr/bin export local $(pwd) sed
+	&& /usr/bin /usr/bin readonly
+'quoted text' echo done -eu x=1 --verbose 2>/dev/null
+cd 'quoted text' sed export done cd export done local awk sed x=1 grep cd
+		'quoted text' then && -eu then "$1" export
+sed 'quoted text' awk cd export 2>/dev/null
+		sed printf cd && awk then ${HOME} awk x=1 export ${HOME} local printf
+	local then --verbose | "$@" export test echo test readonly
+	grep "$@" "$@" export then | 'quoted text' /usr/bin
+		$(pwd) export 2>/dev/null "$1" local "$@"
+	&& 'quoted text' sed cd -eu local --verbose export test echo readonly cd
+	readonly export then then test
+readonly awk then ${HOME} ${HOME} "$@" "$@" sed then && x=1 printf | x=1 x=1
+	export "$1" --verbose ${HOME} readonly
+echo 2>/dev/null x=1 $(pwd) sed readonly cd then done export export 2>/dev/null
+	'quoted text' grep cd "$1" "$@" && sed --verbose "$@" export
+		grep done grep printf then | 'quoted text' printf "$@" grep test --verbose
+	readonly -eu readonly local "$1"
+2>/dev/null readonly /usr/bin
+		-eu && 'quoted text' --verbose awk "$@" | test cd
+	| readonly readonly grep && 2>/dev/null grep ${HOME}
+		2>/dev/null && /usr/bin 'quoted text' --verbose
+-eu done grep -eu /usr/bin ${HOME} cd done grep "$1" echo done test
+export "$@" /usr/bin export export /usr/bin sed /usr/bin && | 'quoted text'
+		$(pwd) printf 2>/dev/null -eu test grep test "$1" "$1" done awk sed --verbose
+echo $(pwd) | x=1 awk sed local printf sed ${HOME}
+		x=1 /usr/bin 'quoted text' local done awk --verbose x=1 ${HOME} --verbose readonly
+		&& cd -eu echo && grep /usr/bin "$@" test && grep readonly
+cd ${HOME} echo grep readonly 2>/dev/null ${HOME} sed "$1" echo printf then
+		echo awk 'quoted text' then sed 'quoted text' x=1 then awk -eu readonly
+grep x=1 done /usr/bin ${HOME} then grep 2>/dev/null
+		export --verbose /usr/bin export 2>/dev/null
+	export sed $(pwd) readonly 2>/dev/null printf export
+	${HOME} then "$@" then -eu done export then
+		'quoted text' 2>/dev/null grep cd export sed echo 2>/dev/null
+/usr/bin done local 'quoted text' "$@" cd ${HOME} sed "$1" then printf ${HOME}
+	then 2>/dev/null export echo awk -eu
+		| readonly sed x=1 -eu readonly printf sed test 2>/dev/null 'quoted text' ${HOME}
+	| awk readonly then 'quoted text' "$1" test x=1 'quoted text' -eu 2>/dev/null
+cd $(pwd) test $(pwd) x=1 export grep sed awk cd x=1 sed export ${HOME}
+then $(pwd) local --verbose awk $(pwd) x=1 ${HOME}
+export | -eu -eu "$1" local ${HOME} readonly sed sed 'quoted text' then awk
+"$@" $(pwd) sed "$@" --verbose export awk local export
+$(pwd) then "$1" 2>/dev/null grep -eu test /usr/bin && cd readonly
+test | export $(pwd) printf printf then
+/usr/bin readonly echo grep done $(pwd)
+	x=1 cd printf | /usr/bin done grep echo local sed grep
+	| echo readonly /usr/bin x=1 2>/dev/null -eu
+	--verbose ${HOME} readonly $(pwd) awk | local
+		local x=1 --verbose sed grep ${HOME} && echo printf local readonly
+		"$@" "$1" test --verbose
+	test then awk $(pwd) --verbose cd then grep $(pwd) local -eu
+	"$1" "$1" awk --verbose test test test | | /usr/bin && grep $(pwd) printf
+	grep "$@" $(pwd) && "$1"
+	sed 2>/dev/null done "$@" "$1" echo 'quoted text' grep local -eu
+#include c14.sh
+then 'quoted text' grep -eu printf printf readonly echo
+/usr/bin cd printf test export echo grep grep
+	"$@" "$@" cd local $(pwd)
+		done /usr/bin --verbose --verbose grep --verbose
+		$(pwd) export /usr/bin grep grep && readonly cd --verbose echo then printf &&
+	sed grep ${HOME} echo readonly sed "$@" --verbose local ${HOME}
+printf $(pwd) "$@" ${HOME} 'quoted text' --verbose cd 'quoted text' grep "$@"
+		&& -eu -eu $(pwd) sed && echo local cd -eu done readonly
+	sed readonly echo && export | && readonly
+x=1 -eu "$@" sed --verbose 2>/dev/null
+		awk ${HOME} ${HOME} sed "$1"
+local 'quoted text' /usr/bin --verbose | 'quoted text'
+	x=1 x=1 export echo sed test | "$1" then "$1" cd
+readonly ${HOME} done done grep done -eu
+	done sed awk "$@" ${HOME} $(pwd) 2>/dev/null "$@" grep && export cd --verbose
+		echo sed printf "$1" sed "$1" "$1" /usr/bin | -eu --verbose export sed 'quoted text'
+	'quoted text' 'quoted text' "$@" x=1 2>/dev/null cd 'quoted text' | "$@" local
+		sed grep -eu test export x=1 readonly --verbose done | echo $(pwd)
+	x=1 -eu && export cd 2>/dev/null
+awk local local export cd printf
+		grep $(pwd) 'quoted text' /usr/bin $(pwd) && cd --verbose cd 2>/dev/null
+	test $(pwd) echo echo $(pwd) readonly
+printf done export /usr/bin readonly /usr/bin
+x=1 then "$@" /usr/bin -eu done test export | readonly then awk
+	readonly 2>/dev/null --verbose echo local 'quoted text' done && "$@" | 'quoted text'
+		&& echo && export -eu -eu sed "$1" cd echo
+export sed awk $(pwd) && -eu ${HOME}
+		&& grep x=1 -eu ${HOME}
+x=1 /usr/bin x=1 done printf
+then readonly done $(pwd) readonly
+cd sed ${HOME} ${HOME} 'quoted text' grep grep ${HOME} x=1 /usr/bin
+	then 2>/dev/null 'quoted text' printf $(pwd) echo cd ${HOME} | cd 'quoted text'
+/usr/bin then --verbose readonly x=1 printf awk | done test done
+awk -eu export test printf ${HOME} $(pwd)
+-eu export cd export grep 'quoted text' /usr/bin local
+	| -eu x=1 ${HOME} /usr/bin cd done sed 'quoted text'
+		printf export grep 2>/dev/null
+'quoted text' local then && | ${HOME} | printf
+done test then /usr/bin "$1" "$1" then
+		$(pwd) "$@" /usr/bin then printf 'quoted text' printf /usr/bin "$@" 'quoted text'
+		done $(pwd) then --verbose sed export && && local
+	local | echo && sed && --verbose readonly export | done "$1" "$1" ${HOME} echo
+		test && grep local --verbose $(pwd) 'quoted text' sed $(pwd) printf ${HOME}
+--verbose grep && sed ${HOME} export local
+	${HOME} --verbose && 'quoted text' grep done export
+	awk grep awk /usr/bin local $(pwd)
+	2>/dev/null then "$1" $(pwd) $(pwd)
+done test --verbose --verbose 'quoted text' readonly grep 'quoted text' echo local
+		cd $(pwd) export 2>/dev/null
+local $(pwd) local test ${HOME} 'quoted text'
+		--verbose test $(pwd) test awk sed --verbose printf export | | sed -eu
+	readonly then | /usr/bin -eu 'quoted text'
+	then readonly 'quoted text' readonly /usr/bin && test
+x=1 ${HOME} 2>/dev/null local "$1" echo then "$@"
+x=1 then local awk grep && x=1 'quoted text' x=1 $(pwd) "$@" ${HOME}
+	'quoted text' && printf test 2>/dev/null grep 'quoted text'
+		sed "$@" "$@" local && echo -eu 'quoted text' x=1 --verbose then "$1"
+		$(pwd) "$1" cd echo sed 'quoted text'
+		2>/dev/null ${HOME} readonly readonly sed
+		| ${HOME} readonly grep x=1 grep 'quoted text' | 2>/dev/null grep | ${HOME}
+		export sed 'quoted text' export 2>/dev/null awk $(pwd) local &&
+	/usr/bin then && test 2>/dev/null | awk grep sed local | echo
+		local /usr/bin --verbose local 'quoted text' readonly $(pwd)
+grep "$1" "$1" export test "$1" cd 2>/dev/null printf printf
+	2>/dev/null echo printf "$@" done | x=1 ${HOME}
+		readonly -eu $(pwd) awk printf /usr/bin local echo export | echo
+readonly $(pwd) x=1 --verbose $(pwd) printf
+	test --verbose 'quoted text' "$1"
+	echo 2>/dev/null grep "$1" awk "$1" /usr/bin && cd x=1
+	readonly $(pwd) test /usr/bin $(pwd) | "$1" 2>/dev/null "$1" ${HOME} ${HOME} "$1"
+		&& 2>/dev/null readonly cd /usr/bin readonly && 2>/dev/null /usr/bin
+then --verbose | "$@" grep cd 2>/dev/null cd then /usr/bin
+	then x=1 $(pwd) cd /usr/bin export 'quoted text' test && 'quoted text'
+${HOME} done | && cd sed grep ${HOME} readonly done local 2>/dev/null
+	then export printf 'quoted text' "$1" done awk | test ${HOME} /usr/bin
+grep grep local "$1" printf grep -eu local awk
+	--verbose 'quoted text' grep printf local grep printf -eu cd 2>/dev/null |
+echo test echo 'quoted text' 'quoted text' done grep "$1" x=1
+		${HOME} readonly 2>/dev/null sed x=1 --verbose "$1"
+		done sed done ${HOME} x=1
+/usr/bin grep "$@" && awk | echo done
+	${HOME} | "$1" sed --verbose export && /usr/bin cd 'quoted text'
+		echo echo x=1 ${HOME} 2>/dev/null && --verbose readonly "$@" "$@" echo
+		"$1" 2>/dev/null $(pwd) done then $(pwd) /usr/bin "$@"
+		cd printf then -eu test "$@" "$@" cd local ${HOME}
+		printf $(pwd) && local /usr/bin
+	grep then 'quoted text' 'quoted text' export --verbose "$1" 2>/dev/null
+	x=1 grep ${HOME} sed --verbose
+2>/dev/null "$@" "$1" --verbose cd printf $(pwd) cd grep sed local
+2>/dev/null echo 'quoted text' && /usr/bin ${HOME} done awk grep "$1" cd && /usr/bin
+	readonly --verbose done printf x=1 x=1 printf echo "$@" ${HOME}
+awk readonly export export -eu done printf awk cd sed x=1 sed
+		awk printf --verbose "$@" ${HOME} readonly 2>/dev/null export printf
+	local /usr/bin done ${HOME} printf done local sed cd $(pwd)
+		echo /usr/bin "$@" "$@" cd then grep awk --verbose sed "$1"
+		| --verbose cd test | done
+		then printf cd x=1 then && 2>/dev/null $(pwd) && cd local && grep
+	cd sed echo $(pwd) $(pwd) export --verbose
+		$(pwd) x=1 then awk local then sed cd grep
+	echo && printf "$@" -eu then export $(pwd)
+/usr/bin sed cd /usr/bin 'quoted text' 'quoted text' echo echo printf
+echo cd x=1 export local x=1 then 2>/dev/null --verbose -eu "$@" export "$@" done
+		x=1 ${HOME} then awk -eu ${HOME} grep
+--verbose awk && "$1" then 2>/dev/null /usr/bin export printf -eu | sed x=1
+		"$1" cd && cd -eu done -eu then
+echo readonly "$1" export test
+		cd 2>/dev/null --verbose 2>/dev/null -eu 2>/dev/null "$1" && test
+	"$1" export 'quoted text' && && awk /usr/bin test
+		local local cd 2>/dev/null "$1" 'quoted text' "$@"
+		/usr/bin printf export && "$1" local local 2>/dev/null
+${HOME} export --verbose printf | echo then then
+	readonly "$@" echo export printf $(pwd)
+		echo -eu export then $(pwd) local 2>/dev/null awk | local
+local -eu local sed | x=1 $(pwd) local "$1" ${HOME}
+export "$1" ${HOME} 'quoted text' sed ${HOME} --verbose done "$1" | 2>/dev/null
+| --verbose -eu cd cd cd export then done && done grep "$1" --verbose x=1 'quoted text'
+sed readonly grep done 2>/dev/null $(pwd) done x=1 2>/dev/null export
+		--verbose /usr/bin | $(pwd) ${HOME} --verbose && ${HOME} 2>/dev/null $(pwd) echo
+	2>/dev/null export 2>/dev/null x=1 printf test
+		then sed echo printf -eu 2>/dev/null
+		&& | && --verbose local 'quoted text' printf /usr/bin 'quoted text'
+-eu grep local local -eu x=1 sed test local 'quoted text'
+		"$@" /usr/bin echo "$1" readonly done test readonly "$1" /usr/bin
+"$@" "$1" done readonly --verbose
+	readonly /usr/bin export cd then done --verbose printf
+2>/dev/null && export local && done grep awk --verbose
+	readonly done echo cd sed | "$@" test ${HOME} $(pwd) ${HOME}
+	export then 'quoted text' 2>/dev/null /usr/bin "$1"
+		export /usr/bin awk x=1 "$@" --verbose printf grep done /usr/bin $(pwd)
+		readonly readonly 2>/dev/null
+	--verbose awk sed awk 2>/dev/null readonly printf awk ${HOME} "$1" $(pwd) | printf
+		"$1" 'quoted text' "$1" readonly
+	readonly test -eu local x=1 grep export done && printf "$1" ${HOME} export
+then -eu 2>/dev/null sed grep echo "$@" then /usr/bin 2>/dev/null grep printf grep
+echo -eu 2>/dev/null sed local | x=1
+/usr/bin "$1" local grep export echo -eu
+	sed $(pwd) 'quoted text' $(pwd) | "$@"
+	export 'quoted text' test
+| --verbose "$@" -eu cd echo export 2>/dev/null $(pwd)
+export ${HOME} x=1 x=1 echo x=1 readonly /usr/bin awk sed
+	then local 'quoted text' awk test readonly 2>/dev/null readonly
+		readonly cd ${HOME} echo | | "$@" grep local export -eu awk
+sed printf x=1 printf sed --verbose /usr/bin sed sed done awk sed | done "$@" cd
+	cd export 2>/dev/null 2>/dev/null --verbose "$1" "$1" test awk
+2>/dev/null cd printf "$1" "$@" sed then grep echo grep | cd grep done done $(pwd)
+		x=1 | readonly done awk 'quoted text'
+	then --verbose cd 'quoted text' "$@" --verbose "$@"
+${HOME} 'quoted text' ${HOME} sed -eu export x=1
+cd -eu "$@" ${HOME} awk -eu && local "$1" 'quoted text' echo grep && ${HOME}
+		local && ${HOME} 2>/dev/null | "$@" export test then "$1"
+		"$@" local "$@" then --verbose
+		2>/dev/null ${HOME} echo 2>/dev/null sed echo test export sed
+cd 'quoted text' "$1" /usr/bin printf ${HOME} then
+	x=1 | --verbose && export -eu && $(pwd) test 'quoted text' then "$@" printf echo
+		grep export local printf $(pwd) grep -eu 'quoted text'
+	--verbose && local readonly printf done -eu then $(pwd) echo sed test
+		awk ${HOME} /usr/bin export --verbose awk
+sed "$@" $(pwd) "$@" done --verbose export local echo cd
+		x=1 /usr/bin 'quoted text' x=1 /usr/bin sed /usr/bin $(pwd)
+	"$@" | echo done | --verbose echo --verbose ${HOME}
+| done "$1" $(pwd) "$1" printf test && cd /usr/bin x=1 --verbose
+		&& cd /usr/bin printf
+2>/dev/null "$@" "$1" printf ${HOME}
+	| done 'quoted text' cd --verbose local export -eu "$1" "$@" export
+		sed echo awk echo sed grep printf
+readonly $(pwd) printf -eu &&
+		$(pwd) "$1" export local awk "$@" export && then && x=1
+	echo grep && 'quoted text' sed test test grep
+/usr/bin | awk printf "$@" ${HOME} export sed readonly export /usr/bin sed
+readonly x=1 --verbose x=1 x=1 local
+	done grep --verbose then 'quoted text' cd
+		${HOME} && test grep printf /usr/bin echo && x=1 && $(pwd)
+		cd echo 2>/dev/null local
+local x=1 "$1" --verbose echo /usr/bin awk then
+	/usr/bin readonly 'quoted text'
+		2>/dev/null && --verbose $(pwd) ${HOME} "$@" grep "$1" export /usr/bin
+2>/dev/null printf grep 2>/dev/null ${HOME} "$1" $(pwd) 'quoted text' then
+	$(pwd) $(pwd) readonly then echo "$@" /usr/bin then sed grep then
+grep readonly local --verbose echo sed cd done && cd x=1 && export -eu /usr/bin
+		export echo local then sed 2>/dev/null test "$@" 'quoted text' ${HOME}
+test local 'quoted text' grep
+	/usr/bin | x=1 sed local --verbose | test then && "$1" --verbose --verbose
+test -eu cd done echo export
+		"$1" readonly test 'quoted text' awk | && echo done "$@" sed
+	local x=1 | -eu ${HOME} -eu sed cd printf echo
+		${HOME} "$@" local test 'quoted text' export awk 'quoted text'
+echo then x=1 'quoted text' done -eu 2>/dev/null 'quoted text'
+		cd done printf $(pwd) ${HOME} 2>/dev/null export
+	-eu readonly "$1" && test printf
+done export readonly /usr/bin "$1" x=1 $(pwd)
+	${HOME} && done cd local | "$1" awk awk 2>/dev/null readonly grep
+'quoted text' /usr/bin "$@" --verbose echo then cd | $(pwd) test sed /usr/bin export
+		then /usr/bin -eu sed 2>/dev/null local $(pwd) | --verbose $(pwd)
+echo done done sed test "$@"
+	cd readonly printf ${HOME} 2>/dev/null x=1 "$@" local local local
+	grep local test /usr/bin $(pwd) x=1 sed grep /usr/bin
+		test sed -eu then "$@" cd export
+	x=1 sed awk -eu then 2>/dev/null cd local sed -eu awk
+	export test awk printf "$@" ${HOME} readonly local
+	x=1 && done test cd "$@" test 2>/dev/null "$1"
+		export && x=1 export grep && grep
+	done | ${HOME} x=1 done "$@" local /usr/bin
+	readonly /usr/bin test && grep
+echo awk && -eu x=1 test x=1 grep 'quoted text'
+awk /usr/bin /usr/bin readonly
+${HOME} && ${HOME} 'quoted text' ${HOME} echo done sed sed x=1 && export 2>/dev/null
+		$(pwd) 'quoted text' "$1" cd -eu test done
+		-eu sed | grep sed x=1 local cd test -eu grep
+'quoted text' && --verbose cd readonly then test | export
+2>/dev/null test echo done | 'quoted text' --verbose awk
+		$(pwd) 'quoted text' readonly "$@" 'quoted text' $(pwd) "$1" -eu sed export
+		&& /usr/bin 2>/dev/null $(pwd) grep 'quoted text' $(pwd) then
+		--verbose export awk /usr/bin /usr/bin -eu then --verbose
+		printf -eu export sed "$1" $(pwd) local sed printf local &&
+export printf 2>/dev/null sed echo -eu readonly printf then "$@" export export
+readonly 'quoted text' $(pwd) ${HOME}
+		printf awk printf local sed sed "$@" "$1" x=1 local echo
+readonly /usr/bin -eu --verbose sed /usr/bin | -eu ${HOME}
+		test /usr/bin awk printf ${HOME} && | test 2>/dev/null
+		local then -eu test sed | local printf
+		${HOME} done grep x=1 readonly "$1" 'quoted text' export ${HOME} | "$@"
+sed awk "$@" 'quoted text' x=1 done x=1 cd "$1" 'quoted text'
+	awk local cd readonly "$@" -eu --verbose test printf x=1 grep 2>/dev/null
+'quoted text' 2>/dev/null &&
+		${HOME} ${HOME} $(pwd) test 2>/dev/null /usr/bin sed sed "$1" /usr/bin $(pwd)
+'quoted text' "$@" 'quoted text'
+	--verbose --verbose printf
+	then test awk "$@" echo ${HOME} then echo && cd echo "$1" /usr/bin
+		printf test "$1" -eu /usr/bin 'quoted text' local ${HOME} | local echo printf
+		"$@" printf readonly cd && echo test "$1" | $(pwd)
+printf grep readonly -eu echo x=1 local "$@" "$@" -eu readonly
+	/usr/bin test test /usr/bin $(pwd) /usr/bin ${HOME} $(pwd) -eu /usr/bin cd
+		cd $(pwd) readonly --verbose
+		export "$@" readonly echo "$@" awk grep
+		| readonly $(pwd) sed -eu /usr/bin
+	awk done ${HOME} sed cd
+		local 2>/dev/null test x=1 printf --verbose grep "$1" && $(pwd)
+		--verbose /usr/bin && printf export $(pwd) $(pwd) export
+		cd printf readonly --verbose export $(pwd) /usr/bin export
+		--verbose export x=1 -eu grep then test | ${HOME} export grep
+grep "$@" echo | 2>/dev/null /usr/bin "$1"
+printf readonly x=1 awk --verbose sed test x=1 sed
+		/usr/bin awk -eu 'quoted text' then 2>/dev/null 2>/dev/null
+		awk then cd sed echo printf $(pwd) "$@" echo "$@" printf echo ${HOME}
+		local readonly && && /usr/bin 'quoted text'
+grep echo export && -eu grep export 'quoted text'
+	grep | done ${HOME} "$1" then x=1 | printf "$@" $(pwd)
+	&& sed -eu x=1 printf -eu 'quoted text' grep 'quoted text'
+		"$1" --verbose grep echo local && then awk grep done 2>/dev/null export
+		sed done printf echo 'quoted text' x=1 "$1" grep
+		awk done export x=1 grep --verbose 2>/dev/null then test
+		readonly printf ${HOME} x=1 | sed awk
+then | readonly /usr/bin test ${HOME} local 'quoted text' $(pwd) && local export
+	$(pwd) test local printf then 2>/dev/null --verbose $(pwd) | done test
+		2>/dev/null "$1" echo 2>/dev/null && $(pwd)
+		2>/dev/null readonly --verbose 2>/dev/null $(pwd) | sed awk grep cd sed done x=1
+		&& $(pwd) ${HOME} "$1" | then grep done "$@" $(pwd) --verbose
+	${HOME} test awk "$@" sed readonly && sed 'quoted text' ${HOME} $(pwd)
+	${HOME} -eu printf grep sed x=1 readonly local readonly -eu -eu $(pwd) x=1
+echo export | echo x=1 printf printf /usr/bin printf | awk local readonly
+	printf printf awk /usr/bin "$@" $(pwd) -eu ${HOME} | cd --verbose x=1
+	$(pwd) awk --verbose sed sed "$@" "$1" --verbose
+		export done $(pwd) then
+sed printf x=1 grep x=1 2>/dev/null test readonly awk ${HOME} sed
+local x=1 --verbose cd echo 2>/dev/null sed "$@" then 2>/dev/null
+	grep | local cd local "$@" $(pwd) 2>/dev/null | ${HOME} sed test printf
+/usr/bin && -eu "$@" export 'quoted text' printf -eu x=1 then readonly sed local
+${HOME} sed | && /usr/bin
+	export cd | 2>/dev/null cd ${HOME} "$1" | readonly
+readonly $(pwd) $(pwd) readonly -eu grep | then readonly printf
+test awk && test && grep cd then readonly
+		| x=1 done 2>/dev/null "$@" local test done $(pwd) readonly && 'quoted text'
+		$(pwd) then ${HOME} "$@" $(pwd)
+	sed ${HOME} x=1 2>/dev/null then "$@" /usr/bin /usr/bin local /usr/bin
+		&& "$1" ${HOME} --verbose echo
+	test test --verbose readonly 'quoted text'
+	&& 'quoted text' done grep $(pwd) /usr/bin
+	readonly local readonly "$1" cd /usr/bin --verbose
+		grep printf --verbose printf 'quoted text' 2>/dev/null
+		grep $(pwd) local --verbose
+&& sed cd ${HOME} done export x=1 ${HOME} && ${HOME} done $(pwd)
+done "$1" --verbose test x=1 readonly
+	done local readonly then x=1 ${HOME} grep awk then /usr/bin
+	| grep export -eu cd grep done 'quoted text' $(pwd) test
+		cd 2>/dev/null && printf "$1" then done cd /usr/bin | /usr/bin
+	printf x=1 x=1 "$@" x=1 | /usr/bin $(pwd) awk readonly
+		export --verbose "$@" awk then
+	/usr/bin done export 2>/dev/null test $(pwd) then | test
+	x=1 | grep grep awk printf sed x=1 'quoted text'
+	echo local | && 'quoted text' cd local sed done grep readonly
+&& done sed --verbose
+	test local 'quoted text' "$@" cd test printf ${HOME}
+readonly sed done grep readonly -eu then -eu
+export sed $(pwd) "$@" echo --verbose readonly
+&& echo /usr/bin grep grep --verbose done
+	cd 'quoted text' readonly cd "$@" "$@" grep readonly awk printf -eu ${HOME} x=1
+then awk "$@" readonly test awk 'quoted text' "$@" 2>/dev/null ${HOME} echo done
+	$(pwd) --verbose test ${HOME} -eu "$1" 'quoted text'
+	sed done sed echo "$@" | export 'quoted text' awk && /usr/bin
+	/usr/bin echo 'quoted text' ${HOME} awk local x=1 "$1" export
+		2>/dev/null | /usr/bin grep then
+'quoted text' cd printf ${HOME} cd export $(pwd)
+"$1" 2>/dev/null then ${HOME} echo test then echo | sed 2>/dev/null
+		local cd local awk test "$1"
+	2>/dev/null echo cd awk /usr/bin then
+	cd -eu --verbose awk local readonly 'quoted text' x=1 sed readonly 'quoted text'
+	${HOME} -eu | export /usr/bin
+awk --verbose cd export $(pwd) grep /usr/bin readonly test /usr/bin --verbose
+	"$@" sed && echo local /usr/bin cd
+readonly -eu 2>/dev/null 'quoted text' -eu local $(pwd) done sed
+		| -eu export ${HOME} 2>/dev/null $(pwd) | --verbose sed grep /usr/bin
+	-eu | cd export --verbose $(pwd)
+printf done done x=1 test cd 2>/dev/null echo && && -eu x=1 && | -eu -eu
+		grep ${HOME} | -eu && test local ${HOME}
+done -eu | "$1" "$@" local readonly 'quoted text' test echo echo
+		${HOME} -eu x=1 $(pwd) /usr/bin local awk --verbose 2>/dev/null 2>/dev/null
+	echo cd echo x=1 local ${HOME} printf test $(pwd) grep
+	-eu ${HOME} "$1" ${HOME} sed ${HOME} /usr/bin sed 2>/dev/null grep echo
+		'quoted text' 'quoted text' cd ${HOME} then printf readonly ${HOME} &&
+		grep $(pwd) $(pwd) /usr/bin sed x=1 $(pwd) -eu -eu local $(pwd) done grep
+--verbose done $(pwd) |
+printf readonly awk export ${HOME} cd --verbose --verbose export export
+		"$@" | echo x=1 awk -eu
+echo awk readonly test readonly then then cd cd 'quoted text'
+		'quoted text' readonly
+		done done grep && test "$1" -eu printf x=1
+--verbose sed 'quoted text' /usr/bin
+		awk "$@" 'quoted text' | 2>/dev/null local 'quoted text' cd | local
+		2>/dev/null | echo 2>/dev/null
+	printf export /usr/bin export readonly then 'quoted text'
+test echo readonly grep printf -eu done printf 2>/dev/null test
+then "$@" -eu ${HOME} 'quoted text' ${HOME} && -eu echo
+x=1 "$@" 'quoted text' local then echo then --verbose
+		${HOME} | sed 2>/dev/null ${HOME} sed --verbose
+		$(pwd) awk x=1 $(pwd) 2>/dev/null x=1 "$@" cd export "$1" --verbose /usr/bin printf
+		done x=1 /usr/bin "$1" done test /usr/bin -eu then | printf --verbose -eu
+		/usr/bin x=1 printf 'quoted text' x=1 awk test test echo ${HOME} && && --verbose
+		grep readonly export --verbose readonly echo then | echo -eu sed
+	/usr/bin printf done cd printf "$@"
+		x=1 grep test test -eu grep sed readonly grep | x=1
+		then --verbose -eu | test /usr/bin | printf readonly
+	$(pwd) && export x=1 cd -eu awk "$@" && echo "$@" test
+$(pwd) 'quoted text' readonly done awk "$@" 2>/dev/null echo done readonly
+		cd sed /usr/bin export $(pwd) local "$1" readonly /usr/bin -eu readonly printf
+x=1 /usr/bin "$1" --verbose
+		"$@" | done cd awk printf --verbose -eu then ${HOME} | readonly --verbose sed
+	${HOME} printf awk "$@" | cd 'quoted text'
+$(pwd) readonly grep --verbose --verbose echo
+		'quoted text' cd test awk test | --verbose awk "$@" "$@" --verbose
+	$(pwd) done test 'quoted text' "$@"
+local "$1" && ${HOME} done $(pwd) local
+		"$1" 'quoted text' done $(pwd) --verbose /usr/bin
+		2>/dev/null test then ${HOME} cd -eu $(pwd)
+		sed x=1 sed /usr/bin local "$1" awk
+		&& 2>/dev/null done readonly
+then export 'quoted text' printf awk echo test 'quoted text'
+	x=1 x=1 then sed test "$@"
+	"$1" | 'quoted text' export readonly ${HOME} && /usr/bin
+awk "$1" sed then sed 2>/dev/null
+	local printf printf /usr/bin printf grep local 2>/dev/null
+	local done awk sed "$@" x=1 test | | $(pwd) echo && awk 'quoted text'
+	--verbose done readonly x=1 /usr/bin echo x=1 2>/dev/null
+${HOME} printf grep printf sed echo
+		export echo awk ${HOME} done
+	2>/dev/null grep "$1" 'quoted text' export local --verbose /usr/bin done echo
+x=1 sed x=1 'quoted text' x=1 test test test $(pwd) readonly
+		done $(pwd) 'quoted text' awk echo local x=1 local
+	readonly sed awk then 'quoted text' echo export -eu
+	export x=1 /usr/bin "$@" printf local printf printf
+| $(pwd) cd echo -eu | 2>/dev/null cd then
+${HOME} x=1 -eu cd --verbose local "$@" "$1" --verbose ${HOME}
+	grep "$@" "$@" && --verbose echo echo then --verbose /usr/bin test 2>/dev/null
+	&& then "$@" /usr/bin echo $(pwd) local sed
+echo /usr/bin export | test ${HOME}
+	"$@" && --verbose echo done done echo "$@" -eu
+test && local "$1" readonly echo $(pwd) cd cd 2>/dev/null
+	| ${HOME} x=1 echo && -eu 2>/dev/null grep -eu grep cd then printf
+		export cd cd test 'quoted text' awk -eu local && sed local ${HOME} | export
+	${HOME} cd | local local ${HOME} grep done /usr/bin && && cd -eu
+		readonly readonly grep printf --verbose 2>/dev/null grep cd | cd "$1"
+-eu 2>/dev/null readonly 2>/dev/null echo export grep done
+		/usr/bin grep awk /usr/bin 'quoted text' awk test grep
+"$1" "$1" export sed readonly
+		$(pwd) --verbose 'quoted text' 2>/dev/null "$@" then awk done | ${HOME}
+export --verbose grep --verbose --verbose test "$@" "$@" && sed printf awk
+	x=1 test cd awk grep local
+		cd ${HOME} echo local 2>/dev/null && $(pwd) done && "$@" 'quoted text' "$@"
+"$1" grep grep echo 'quoted text' readonly --verbose "$1"
+local sed grep --verbose -eu done export | --verbose
+	${HOME} printf export "$1" readonly cd -eu "$1" -eu readonly /usr/bin
+&& 2>/dev/null local awk printf 2>/dev/null | 'quoted text'
+readonly printf printf $(pwd) printf | $(pwd) "$@" echo "$@" readonly export
+	cd /usr/bin $(pwd) done cd --verbose then "$@"
+		cd readonly grep awk export $(pwd) echo export printf
+awk echo ${HOME} x=1 x=1
+local then cd done export echo readonly "$1" sed "$@" --verbose printf done -eu
+export --verbose echo -eu 2>/dev/null cd x=1 -eu 'quoted text' printf $(pwd)
+		2>/dev/null /usr/bin 2>/dev/null then echo && local $(pwd) x=1 local grep
+printf ${HOME} | --verbose printf readonly echo local && export cd done
+	2>/dev/null done local --verbose 2>/dev/null && 2>/dev/null
+	then readonly sed "$@" "$@" && 'quoted text' done
+	$(pwd) --verbose -eu | sed
+		/usr/bin echo /usr/bin |
+--verbose | /usr/bin cd test printf then readonly -eu "$1" "$1" awk 2>/dev/null
+| export readonly "$1"
+"$1" "$1" cd --verbose cd x=1 done /usr/bin "$@"
+		$(pwd) "$@" 'quoted text' && readonly then awk local readonly readonly
+		local $(pwd) done awk cd 'quoted text' "$1" --verbose
+"$1" "$1" -eu -eu printf awk printf awk 2>/dev/null --verbose then "$@" readonly
+	then readonly local sed awk
+	'quoted text' then export 2>/dev/null local awk
+	cd export x=1 done readonly ${HOME} export $(pwd) local test printf export &&
+then "$1" done echo -eu /usr/bin
+	$(pwd) $(pwd) "$@" done ${HOME} grep grep printf 2>/dev/null $(pwd) 'quoted text'
+	grep then ${HOME} /usr/bin | 'quoted text' cd grep sed done awk echo
+echo $(pwd) 'quoted text' cd /usr/bin grep ${HOME} ${HOME} echo
+	awk 2>/dev/null export 'quoted text' local test 2>/dev/null "$1"
+${HOME} --verbose cd -eu --verbose ${HOME} /usr/bin && sed x=1 "$@" "$@" && sed
+echo 2>/dev/null $(pwd) | grep readonly | "$1" x=1 sed cd "$1" sed export
+	readonly "$@" awk 2>/dev/null --verbose 2>/dev/null done printf -eu
+	grep /usr/bin x=1 $(pwd) sed
+		export test $(pwd) sed /usr/bin x=1 x=1 2>/dev/null x=1 $(pwd) --verbose
+	"$@" cd sed readonly $(pwd) awk /usr/bin 'quoted text' | cd --verbose printf awk
+${HOME} 'quoted text' ${HOME} ${HOME} && -eu
+		| readonly 'quoted text' echo printf 'quoted text' echo sed
+		grep then export "$@"
+local grep x=1 then --verbose 'quoted text' export export then
+	cd "$1" /usr/bin --verbose /usr/bin 'quoted text'
+	"$@" --verbose -eu 2>/dev/null /usr/bin "$1"
+"$1" printf "$1" "$1" ${HOME} ${HOME} readonly && /usr/bin
+		| local grep x=1 "$@" sed cd readonly local x=1 readonly
+export --verbose "$@" ${HOME} echo "$@" test echo ${HOME} awk cd | x=1 cd | readonly
+'quoted text' 2>/dev/null readonly && $(pwd) $(pwd) printf
+	2>/dev/null cd echo 2>/dev/null 2>/dev/null done x=1 && echo
+		| test | | -eu && then local x=1 printf -eu 'quoted text' grep "$@" done 2>/dev/null
+readonly readonly && | "$1" "$@" sed export printf 'quoted text'
+	--verbose then readonly readonly
+		$(pwd) local echo grep "$1" 2>/dev/null readonly then readonly test export
+	"$@" 2>/dev/null cd test 2>/dev/null ${HOME} local then test 2>/dev/null
+${HOME} x=1 printf sed
+		"$@" cd echo x=1 'quoted text' 'quoted text' 2>/dev/null sed awk 2>/dev/null
+		echo local && awk -eu cd export x=1 echo ${HOME} $(pwd) export && echo grep /usr/bin
+	--verbose && echo local 2>/dev/null --verbose ${HOME} echo echo done && readonly
+	&& readonly ${HOME} local -eu x=1 /usr/bin --verbose
+	${HOME} export | echo local sed $(pwd) cd export --verbose test | | then /usr/bin
+	test -eu sed && x=1 2>/dev/null x=1 'quoted text' $(pwd) $(pwd) && cd "$1" 2>/dev/null
+${HOME} grep then test test readonly printf grep awk $(pwd) done
+		grep sed /usr/bin local
+"$@" export 'quoted text'
+	readonly "$1" "$1" grep echo "$1" awk sed local
+		${HOME} && then export $(pwd) awk printf
+		grep "$1" sed && awk /usr/bin readonly -eu grep -eu -eu cd test
+"$@" $(pwd) awk grep | -eu | readonly -eu readonly -eu "$1"
+	grep 'quoted text' done echo && then
+		x=1 printf grep cd printf then $(pwd)
+${HOME} local --verbose readonly ${HOME}
+	-eu grep | "$@" export ${HOME}
+	"$1" local x=1 ${HOME} printf x=1 awk grep -eu done sed
+		awk $(pwd) 'quoted text'
+printf --verbose grep sed | then ${HOME} grep cd -eu | export
+'quoted text' --verbose | cd cd 2>/dev/null --verbose
+&& /usr/bin grep && awk 2>/dev/null
+		done --verbose export test printf
+readonly "$@" 2>/dev/null grep ${HOME} ${HOME} printf ${HOME} printf "$1"
+"$@" readonly | export readonly cd export -eu 2>/dev/null ${HOME}
+readonly 'quoted text' --verbose | /usr/bin
+readonly | export grep test cd test grep then 'quoted text'
+	"$1" /usr/bin x=1 cd printf readonly
+	"$@" "$@" && export export cd export cd done test sed $(pwd) | echo test
+		&& test readonly "$1" test test 'quoted text' x=1 echo $(pwd) readonly echo -eu
+	cd 'quoted text' 2>/dev/null
+'quoted text' "$1" | local then local $(pwd) "$@" "$@" && "$1" --verbose /usr/bin
+	local /usr/bin x=1 | --verbose awk test printf /usr/bin 2>/dev/null "$1" && ${HOME}
+	"$1" awk /usr/bin 2>/dev/null sed
+	export && echo sed "$1" then $(pwd) cd awk test done local $(pwd)
+"$1" ${HOME} then printf printf | local export cd --verbose
+done ${HOME} $(pwd) sed readonly printf awk $(pwd)
+	cd readonly awk /usr/bin echo echo | | $(pwd) "$1" $(pwd) "$1"
+printf done grep 2>/dev/null 2>/dev/null grep
+	printf grep test echo /usr/bin test "$1" grep | export grep -eu
+"$@" printf echo echo cd grep "$@" /usr/bin 'quoted text'
+	grep $(pwd) 2>/dev/null "$1" ${HOME} -eu
+test --verbose cd 2>/dev/null awk test
+	-eu export /usr/bin printf 'quoted text' x=1 readonly
+	readonly test echo $(pwd) | && test
+	"$1" "$@" sed grep printf 2>/dev/null
+$(pwd) 2>/dev/null done test awk x=1 export test $(pwd) x=1 /usr/bin echo
+	--verbose && 'quoted text' ${HOME} export grep | 2>/dev/null
+		export x=1 "$@" echo sed sed 'quoted text' x=1 echo then printf grep "$@"
+'quoted text' | echo 2>/dev/null "$@" grep ${HOME}
+--verbose x=1 "$@" x=1 grep test local sed local $(pwd) cd $(pwd) printf
+local x=1 then /usr/bin grep printf 2>/dev/null 2>/dev/null
+local printf sed 2>/dev/null
+		$(pwd) local grep readonly test 'quoted text'
+done --verbose printf readonly
+	-eu -eu grep printf && readonly then "$1" -eu 2>/dev/null
+		done 'quoted text' && 'quoted text'
+		awk local done 'quoted text' then $(pwd) "$1" then done
+awk x=1 'quoted text' printf awk ${HOME}
+	/usr/bin echo --verbose test 'quoted text'
+		export sed printf done | test grep 2>/dev/null "$@" readonly cd
+		test printf $(pwd) sed --verbose done
+/usr/bin awk && awk "$@" "$@" done grep cd then ${HOME} "$@" test | readonly "$1"
+$(pwd) | sed | "$@" -eu ${HOME} ${HOME} /usr/bin
+	grep | echo | -eu "$@" /usr/bin printf "$@" then /usr/bin done ${HOME}
+/usr/bin then echo cd ${HOME} printf export then test
+local /usr/bin && echo grep 'quoted text' local -eu echo printf && then
+	&& ${HOME} && --verbose cd 2>/dev/null "$1" local grep
+| readonly echo ${HOME} "$@" done then readonly export test done
+printf && export "$@" -eu && awk printf /usr/bin readonly
+		readonly 'quoted text' readonly "$1" then sed
+echo ${HOME} --verbose test done cd local echo "$1"
+	"$@" then 'quoted text' "$@" printf printf
+| cd ${HOME} awk ${HOME} grep && cd | export 2>/dev/null
+	then "$1" $(pwd) export then && cd
+	echo "$1" x=1 done readonly x=1 cd "$@" "$@" cd "$1" -eu && /usr/bin $(pwd) 'quoted text'
+then printf readonly cd ${HOME}
+	-eu done echo && "$@" --verbose -eu readonly
+sed | done then ${HOME} echo "$1" 'quoted text' ${HOME} export
+		grep x=1 x=1 test printf
+/usr/bin done ${HOME} echo
+	| "$1" echo 2>/dev/null grep done printf 'quoted text' "$@" local
+then -eu "$@" grep $(pwd) test ${HOME} printf $(pwd)
+	x=1 'quoted text' done echo "$1"
+"$1" echo 'quoted text' echo $(pwd)
+cd && /usr/bin printf ${HOME}
+	--verbose 2>/dev/null grep printf test --verbose $(pwd) cd grep then awk
+		export export 'quoted text' | awk && |
+done x=1 grep done cd --verbose
+		"$1" test grep sed --verbose done 2>/dev/null printf x=1 x=1 "$@"
+	/usr/bin $(pwd) | done 2>/dev/null
+		${HOME} | done test done "$1" && 'quoted text' printf ${HOME} | then x=1
+		echo -eu export done then awk "$@" done export "$@" printf sed
+		$(pwd) readonly test -eu 2>/dev/null
+	echo 2>/dev/null -eu | && sed echo cd -eu test sed 'quoted text'
+	readonly grep /usr/bin ${HOME} done $(pwd) readonly
+local ${HOME} "$1" -eu local printf test --verbose 'quoted text' --verbose grep
+		test $(pwd) echo echo /usr/bin done 2>/dev/null
+2>/dev/null 2>/dev/null printf grep then -eu echo test x=1 /usr/bin
+		2>/dev/null grep && test done sed sed 'quoted text'
+	export 2>/dev/null sed /usr/bin then
+'quoted text' --verbose 2>/dev/null echo
+"$1" x=1 export x=1 local cd "$@" readonly ${HOME}
+		| done 'quoted text' test local && sed
+		"$1" 2>/dev/null echo x=1 echo ${HOME} "$1"
+grep echo printf -eu | printf grep readonly done | -eu 'quoted text'
+	"$1" test | 'quoted text' grep test printf readonly 'quoted text' then readonly
+		echo export $(pwd) $(pwd)
+$(pwd) export 'quoted text' x=1 | --verbose
+		--verbose printf ${HOME} -eu
+		done sed ${HOME} && sed ${HOME}
+	&& 'quoted text' sed sed done "$1" export cd "$1" "$1" /usr/bin
+2>/dev/null test grep 'quoted text' x=1 $(pwd) then 2>/dev/null
+		local test local readonly cd | && "$@" $(pwd) "$1" 'quoted text' && 2>/dev/null
+	$(pwd) --verbose cd "$@" | awk local
+		'quoted text' grep then $(pwd) echo printf printf
+		export printf test ${HOME} 'quoted text' export -eu cd echo then ${HOME} printf
+	-eu ${HOME} readonly /usr/bin x=1 printf | ${HOME} -eu grep printf "$@" /usr/bin
+&& readonly 2>/dev/null readonly ${HOME} 2>/dev/null
+		${HOME} then "$@" echo then
+readonly x=1 $(pwd) then
+	cd cd -eu /usr/bin | awk --verbose "$@" --verbose printf | /usr/bin
+	printf 'quoted text' local cd ${HOME} $(pwd)
+		&& export sed 2>/dev/null ${HOME} test 'quoted text' 'quoted text'
+"$1" 2>/dev/null ${HOME} && readonly && 2>/dev/null "$1" -eu local | export readonly
+	$(pwd) sed printf "$@" printf test printf then
+'quoted text' done export $(pwd) echo sed
+		| "$@" $(pwd) "$1" echo && cd "$1" echo echo echo readonly -eu
+done readonly then /usr/bin -eu local 2>/dev/null && --verbose "$@" sed
+		sed sed readonly /usr/bin $(pwd) "$@"
+/usr/bin readonly grep printf printf local export local -eu cd x=1 then awk $(pwd)
+		&& x=1 x=1 readonly "$1" echo "$1" echo readonly then
+		&& printf export | 2>/dev/null | | "$@" /usr/bin sed printf printf
+grep then ${HOME} 'quoted text' x=1 'quoted text' done && awk 'quoted text'
+'quoted text' local printf x=1 &&
+"$1" | && export grep printf grep /usr/bin 'quoted text'
+	x=1 x=1 printf /usr/bin 'quoted text' grep | && 2>/dev/null awk
+"$1" printf x=1 then /usr/bin printf
+		&& --verbose "$@" local cd grep done --verbose 2>/dev/null "$@" --verbose
+x=1 awk | /usr/bin test /usr/bin test readonly x=1 2>/dev/null
+2>/dev/null && "$1" |
+		then $(pwd) $(pwd) --verbose
+$(pwd) grep test "$1" --verbose && x=1 test echo test -eu x=1 --verbose export
+echo printf readonly awk local awk "$1" | then done --verbose echo cd printf
+		'quoted text' readonly echo ${HOME} && ${HOME} -eu 2>/dev/null awk 'quoted text'
+$(pwd) export done export x=1 "$1" then && 'quoted text' /usr/bin x=1 $(pwd)
+		readonly /usr/bin printf /usr/bin export cd sed
+	x=1 local grep 2>/dev/null sed --verbose readonly "$1" awk
+	&& sed local cd echo cd grep grep --verbose grep 'quoted text'
+		"$1" export export readonly printf awk printf ${HOME} && grep
+	done "$1" test export /usr/bin
+printf 2>/dev/null cd then 'quoted text' done "$@" awk readonly
+	| --verbose "$@" export --verbose /usr/bin test
+		cd "$1" 2>/dev/null export readonly ${HOME} grep x=1 ${HOME} "$1" test x=1 cd
+$(pwd) readonly | sed --verbose readonly
+"$@" $(pwd) ${HOME} done
+	sed readonly -eu x=1 'quoted text' $(pwd) "$1" awk "$@"
+		printf $(pwd) x=1 x=1 grep printf ${HOME} "$1" then cd "$@" done "$1" sed export
+	${HOME} cd awk | export ${HOME} export
+	test printf printf $(pwd) printf && x=1 $(pwd) cd 2>/dev/null x=1 "$1" -eu
+export sed "$1" printf
+2>/dev/null 2>/dev/null 2>/dev/null echo
+2>/dev/null $(pwd) awk -eu cd cd | local && 'quoted text'
+	sed export printf cd echo grep local
+	"$1" echo ${HOME} /usr/bin
+	done echo x=1 'quoted text'
+		test "$1" local $(pwd) | --verbose
+	readonly readonly readonly
+		-eu export 'quoted text' cd sed
+	2>/dev/null "$@" grep grep $(pwd) test x=1 --verbose
+local 2>/dev/null done sed test $(pwd) done -eu x=1 $(pwd) x=1 --verbose
+then 2>/dev/null test local /usr/bin 'quoted text'
+	| /usr/bin awk echo --verbose cd awk sed
+readonly export "$@" ${HOME} readonly
+local $(pwd) then --verbose cd $(pwd) printf $(pwd) echo ${HOME}
+cd && -eu -eu printf cd grep --verbose | awk ${HOME} cd awk "$1" /usr/bin
+"$@" x=1 done "$1" | && | done && echo echo "$@"
+		${HOME} then awk | sed x=1 2>/dev/null
+	x=1 x=1 awk test --verbose then done "$@" x=1 "$@" readonly "$@"
+		x=1 2>/dev/null -eu "$@" $(pwd) sed local done test
+grep done test printf done ${HOME} x=1 local -eu 'quoted text' sed --verbose "$@"
+grep $(pwd) && 2>/dev/null test && printf readonly
+		printf printf | ${HOME} | local export && test printf $(pwd) /usr/bin
+cd grep test grep awk sed cd "$1"
+--verbose && --verbose ${HOME} sed 'quoted text' ${HOME} export
+		${HOME} export local grep --verbose x=1
+printf "$@" $(pwd) echo /usr/bin $(pwd) done awk | &&
+	${HOME} printf 2>/dev/null -eu cd ${HOME}
+	"$@" -eu "$1" echo $(pwd) sed done awk done ${HOME} "$1" sed x=1 "$1" cd
+		sed 2>/dev/null 2>/dev/null /usr/bin 'quoted text' readonly printf
+		local grep "$1" 2>/dev/null 2>/dev/null
+/usr/bin x=1 test grep ${HOME} then readonly 2>/dev/null
+sed 2>/dev/null echo 'quoted text' test | cd printf $(pwd) echo -eu
+	awk -eu cd test /usr/bin awk 'quoted text' 2>/dev/null /usr/bin local awk "$@"
+grep "$1" 2>/dev/null export readonly $(pwd) export
+grep /usr/bin echo awk local sed export
+	| done --verbose && 'quoted text' $(pwd) printf
+then export 2>/dev/null && x=1 'quoted text'
+		grep export printf then $(pwd)
+/usr/bin awk printf printf
+echo 2>/dev/null ${HOME} awk sed readonly echo --verbose
+	--verbose test 'quoted text' 2>/dev/null
+		&& readonly local | echo && 'quoted text' "$1" export then
+		-eu | "$1" done local | then grep -eu echo -eu /usr/bin then local
+		"$@" cd cd "$1" printf ${HOME} sed "$1" sed done then /usr/bin awk -eu
+then /usr/bin -eu ${HOME} --verbose "$1" $(pwd)
+	${HOME} x=1 sed grep sed --verbose readonly /usr/bin
+		awk echo printf local /usr/bin awk cd 'quoted text'
+test && local grep x=1 grep cd echo grep 'quoted text'
+	awk $(pwd) --verbose "$@" awk export | sed x=1 then -eu 2>/dev/null /usr/bin
+-eu cd 2>/dev/null printf then
+		2>/dev/null local done && /usr/bin
+sed ${HOME} --verbose -eu
+grep awk cd sed -eu /usr/bin "$@" 2>/dev/null readonly x=1 cd 2>/dev/null
+	printf "$1" 'quoted text' | then -eu 2>/dev/null
+printf awk local && grep readonly test | then done |
+		local test printf ${HOME} grep /usr/bin && --verbose "$1" "$@" echo 'quoted text'
+	then export local $(pwd) x=1 cd echo done test awk | export x=1 -eu && cd test x=1
+		printf cd export 2>/dev/null | export local -eu "$@" $(pwd)
+"$@" cd done /usr/bin -eu ${HOME}
+		echo "$@" && export export --verbose &&
+		"$1" 'quoted text' local /usr/bin "$1" then "$1" printf
+	echo "$@" printf echo /usr/bin printf
+	printf sed cd && sed echo 2>/dev/null "$@" 2>/dev/null cd then "$@" awk
+	done x=1 done done grep test ${HOME} echo
+		grep echo ${HOME} && ${HOME} printf sed --verbose
+	export 2>/dev/null cd readonly -eu -eu 'quoted text'
+		then cd grep readonly ${HOME} local export done sed 2>/dev/null
+		local sed then $(pwd) export
+	$(pwd) "$@" /usr/bin grep sed
+		printf export $(pwd) ${HOME} && test test local /usr/bin | cd local $(pwd)
+export echo cd /usr/bin "$@" done "$@" x=1 "$@" local 2>/dev/null printf
+${HOME} echo grep readonly && -eu readonly export local
+local $(pwd) "$1" local test $(pwd) 2>/dev/null test sed --verbose grep
+test | $(pwd) printf sed 'quoted text'
+awk && --verbose sed cd awk sed readonly then -eu --verbose
+		2>/dev/null 2>/dev/null $(pwd) -eu test
+test ${HOME} local readonly
+	readonly done ${HOME} printf "$1" | "$1" export cd 2>/dev/null printf test echo
+	$(pwd) test grep printf sed /usr/bin 2>/dev/null
+echo awk sed "$@" then 'quoted text'
+&& export done printf "$1" "$1" &&
+${HOME} "$@" export local echo --verbose
+		sed printf 'quoted text' -eu && readonly 'quoted text' test echo cd
+	awk 'quoted text' | && /usr/bin local -eu awk echo readonly "$1" sed cd readonly
+2>/dev/null printf done done /usr/bin awk done readonly cd && "$1" done
+	echo export -eu local then "$1" export done echo sed -eu "$@" awk "$1" "$1"
+	grep grep printf test done cd echo test cd echo
+	2>/dev/null local $(pwd) --verbose ${HOME} done "$1" done "$1"
+	x=1 done -eu cd "$@" local grep 'quoted text' --verbose "$1" ${HOME}
+		&& readonly --verbose export printf /usr/bin local 2>/dev/null
+		&& | --verbose test 2>/dev/null | | done local export
+	then cd awk /usr/bin echo awk done
+		| /usr/bin then printf local ${HOME} test "$1" cd --verbose
+	${HOME} --verbose awk cd
+'quoted text' printf local
+		/usr/bin /usr/bin x=1 awk
+		grep && x=1 echo 'quoted text' $(pwd) test --verbose then $(pwd) local 2>/dev/null
+--verbose printf test sed printf grep "$@"
+echo $(pwd) cd | done printf
+	'quoted text' then x=1 export
+-eu ${HOME} cd | "$1" | 2>/dev/null /usr/bin then | "$1" cd /usr/bin readonly done
+		"$@" | 2>/dev/null export "$@"
+&& ${HOME} local "$@" local 'quoted text' cd then done --verbose 'quoted text'
+		-eu $(pwd) 'quoted text' 2>/dev/null readonly
+awk "$1" "$1" grep "$1" /usr/bin $(pwd) printf
+		&& done awk echo then && $(pwd) done
+-eu | -eu "$@" 2>/dev/null --verbose ${HOME} && test then 2>/dev/null
+${HOME} && test x=1 &&
+'quoted text' 2>/dev/null
+	x=1 -eu 2>/dev/null --verbose printf && -eu readonly --verbose grep --verbose
+	--verbose printf then printf
+| export ${HOME} -eu cd 2>/dev/null ${HOME} test $(pwd) grep printf
+	-eu local readonly | done grep /usr/bin
+		readonly awk 'quoted text'
+		x=1 echo ${HOME} && -eu export 2>/dev/null && 2>/dev/null | test then
+	'quoted text' 2>/dev/null -eu test
+	'quoted text' readonly | test | cd cd |
+		awk printf export readonly sed /usr/bin "$@" echo && -eu export --verbose
+		"$1" test local done readonly && && ${HOME} ${HOME} "$1" x=1 then $(pwd)
+		${HOME} 'quoted text' 'quoted text' 'quoted text' /usr/bin
+	printf ${HOME} | echo "$1"
+${HOME} printf local 'quoted text' printf local export done ${HOME}
+	readonly then "$@" then ${HOME} done export /usr/bin
+	then ${HOME} /usr/bin sed "$@" && cd /usr/bin
+cd done local done $(pwd) sed -eu && "$@" grep
+		'quoted text' 2>/dev/null readonly $(pwd)
+	cd ${HOME} readonly /usr/bin readonly
+x=1 printf echo done cd $(pwd) "$@" /usr/bin then test 'quoted text'
+		"$@" | 2>/dev/null --verbose 2>/dev/null test 2>/dev/null
+		echo then awk awk then readonly test | ${HOME} readonly $(pwd) x=1 printf "$1"
+		export --verbose && echo export echo cd && "$1" sed 'quoted text' -eu
+2>/dev/null && grep "$@" test cd 'quoted text' awk sed x=1 && 'quoted text' done
+	export "$@" x=1 export cd ${HOME} sed 2>/dev/null export readonly readonly
+		| readonly export ${HOME} awk local ${HOME}
+	sed awk && --verbose /usr/bin ${HOME} && export 2>/dev/null readonly "$1"
+		x=1 printf | $(pwd) then "$1" export --verbose x=1 x=1 awk printf --verbose
+		-eu test "$@" -eu "$@" cd local /usr/bin done "$1" -eu
+	$(pwd) done printf sed
+printf ${HOME} ${HOME} grep local "$1" ${HOME}
+readonly local /usr/bin --verbose readonly -eu sed then 2>/dev/null -eu
+2>/dev/null local done cd "$@"
+		readonly local 'quoted text' export
+	cd --verbose export test 2>/dev/null "$1"
+		| sed cd sed && && -eu 'quoted text' ${HOME} readonly awk $(pwd) "$1"
+		'quoted text' grep readonly x=1
+	"$@" "$1" then --verbose -eu
+		x=1 x=1 | && cd export /usr/bin grep ${HOME} export
+echo ${HOME} 'quoted text' "$@" then done ${HOME}
+		x=1 readonly awk $(pwd) test echo cd local grep
+		printf printf export | && cd && export /usr/bin --verbose grep then awk && grep
+		"$@" then then ${HOME} done export
+| printf then 'quoted text'
+	export done $(pwd) ${HOME} ${HOME} echo grep | "$1" test grep then
+	| x=1 "$@" "$@" readonly sed 'quoted text' $(pwd) "$@" --verbose
+awk -eu $(pwd) cd | local
+sed readonly ${HOME} 'quoted text' sed export /usr/bin
+		x=1 2>/dev/null x=1 2>/dev/null done local | sed sed ${HOME} local awk
+		2>/dev/null $(pwd) grep done awk printf echo test 'quoted text' readonly x=1 printf
+		-eu "$@" /usr/bin local cd cd echo awk export --verbose
+		| sed x=1 && sed echo 2>/dev/null
+2>/dev/null "$@" grep then
+	$(pwd) 'quoted text' echo "$@" done 2>/dev/null "$@" $(pwd) echo sed 2>/dev/null
+	-eu 2>/dev/null readonly $(pwd) $(pwd) ${HOME}
+	--verbose "$1" "$1" test 2>/dev/null -eu export test
+"$@" then test "$1" $(pwd) sed test sed grep
+	cd /usr/bin test && cd local | local "$@" ${HOME} && --verbose grep ${HOME}
+printf awk echo -eu test 2>/dev/null "$1" x=1 printf
+cd test echo /usr/bin $(pwd)
+sed "$1" test export test | readonly then /usr/bin sed grep 'quoted text' --verbose
+	&& done local awk ${HOME}
+		sed --verbose 'quoted text'
+	done x=1 readonly $(pwd) && "$1" printf cd export readonly readonly
+		| && readonly readonly cd cd $(pwd) "$1" 'quoted text'
+/usr/bin export "$1" -eu awk /usr/bin readonly | && export 2>/dev/null
+	--verbose export test printf 'quoted text' cd readonly sed sed
+	"$1" --verbose export export 2>/dev/null |
+	awk done grep then "$1" export
+		"$@" sed awk cd --verbose 2>/dev/null
+--verbose 2>/dev/null readonly then local
+		| test | cd "$1" "$1" sed then printf 'quoted text' && ${HOME}
+--verbose $(pwd) -eu then &&
+		"$1" test ${HOME} test /usr/bin then export awk echo "$1"
+grep readonly x=1 local ${HOME} cd sed test done awk ${HOME}
+	&& --verbose done 'quoted text' export $(pwd) readonly
+		then readonly $(pwd) done readonly local awk --verbose --verbose x=1
+		printf "$1" then sed $(pwd) ${HOME} printf --verbose 2>/dev/null sed echo x=1 then
+	'quoted text' -eu done 2>/dev/null echo export printf then local | then
+	x=1 && local "$@" local export awk "$@" export sed
+	readonly "$1" awk then "$@" echo local /usr/bin | sed --verbose awk --verbose $(pwd)
+	local then -eu ${HOME} then
+	grep --verbose 2>/dev/null done x=1
+"$@" /usr/bin | echo 2>/dev/null cd && /usr/bin echo test readonly
+	/usr/bin 2>/dev/null | then awk x=1 $(pwd) grep "$1" echo echo
+--verbose local --verbose export $(pwd) printf |
+	x=1 -eu ${HOME} /usr/bin awk "$@" test x=1 export 'quoted text'
+	then echo then -eu "$@" readonly | export && sed export sed 'quoted text'
+		"$1" x=1 grep 2>/dev/null readonly $(pwd) cd sed
+		2>/dev/null cd $(pwd) awk
+	&& "$1" $(pwd) done cd done && readonly -eu "$1" grep echo -eu awk cd cd
+done grep done --verbose && grep 'quoted text'
+		cd "$1" 'quoted text' sed echo
+	readonly done $(pwd) "$@" export printf done && $(pwd) --verbose printf
+	/usr/bin 'quoted text' grep x=1 export && local /usr/bin printf | sed
+		then x=1 readonly then local | 2>/dev/null cd cd 'quoted text'
+	2>/dev/null then | then sed /usr/bin -eu $(pwd)
+	| readonly "$@" printf awk grep grep export "$@" && --verbose
+	local printf test test then echo readonly export grep local
+	cd /usr/bin done sed test then cd readonly
+	sed sed awk 'quoted text' done -eu $(pwd) printf x=1 /usr/bin done x=1 grep --verbose
+		| export cd "$@" "$@" -eu /usr/bin awk then echo 2>/dev/null
+		${HOME} awk done local sed $(pwd) $(pwd) printf echo sed "$1" x=1 readonly
+/usr/bin && cd test export | "$@" | "$@" then local sed ${HOME}
+		test 2>/dev/null then $(pwd) cd | readonly 2>/dev/null
+'quoted text' done done | -eu done --verbose awk echo
+		${HOME} grep printf readonly 'quoted text' $(pwd) readonly
+		-eu && 'quoted text' | $(pwd) readonly
+2>/dev/null printf "$1" grep /usr/bin done $(pwd)
+	--verbose done /usr/bin ${HOME}
+		grep then local cd ${HOME} $(pwd) readonly sed awk
+$(pwd) sed then awk 'quoted text'
+	cd x=1 -eu x=1 echo test "$@" echo ${HOME} echo /usr/bin printf $(pwd)
+grep --verbose local test x=1 -eu
+		done ${HOME} 2>/dev/null 'quoted text' | awk -eu ${HOME} awk
+	'quoted text' cd $(pwd) cd -eu ${HOME}
+	/usr/bin --verbose echo export grep done
+		x=1 'quoted text' && | then "$@" printf "$@" printf then export
+	"$@" then $(pwd) --verbose "$1" readonly grep awk $(pwd) done printf && done ${HOME}
+		echo sed grep | then cd printf $(pwd) printf sed ${HOME} x=1 ${HOME} && &&
+cd echo /usr/bin -eu local echo
+${HOME} sed $(pwd) "$@" -eu
+		/usr/bin printf /usr/bin 2>/dev/null
+printf -eu $(pwd) --verbose
+| sed awk x=1 /usr/bin ${HOME} /usr/bin local test | done printf
+		| "$1" && awk grep "$1" "$1"
+	then "$@" "$1" readonly 'quoted text' grep echo printf 'quoted text'
+	-eu export cd test local grep cd printf
+		/usr/bin readonly readonly printf done -eu 2>/dev/null
+	"$@" 2>/dev/null awk echo ${HOME} awk 2>/dev/null
+&& ${HOME} local ${HOME} | "$1" done test ${HOME}
+${HOME} /usr/bin echo --verbose local printf | sed cd sed export 2>/dev/null
+		local "$@" then printf &&
+grep printf "$@" cd printf 2>/dev/null local test
+	${HOME} "$@" sed && ${HOME} export grep /usr/bin && done test printf sed 2>/dev/null
+		$(pwd) /usr/bin --verbose then "$1" grep sed
+		echo then awk local x=1 x=1
+		"$@" $(pwd) x=1 echo | ${HOME}
+		${HOME} sed then echo x=1 export /usr/bin sed && awk "$@" $(pwd) -eu echo done
+	--verbose 'quoted text'
+done done x=1 awk done printf |
+	--verbose grep "$1" readonly $(pwd) test test local
+then 2>/dev/null $(pwd) | | ${HOME}
+	2>/dev/null /usr/bin readonly && x=1
+		cd ${HOME} export /usr/bin echo 2>/dev/null
+		2>/dev/null ${HOME} /usr/bin 'quoted text' ${HOME} test --verbose | local
+export awk then --verbose
+		&& -eu printf x=1 sed ${HOME} && local local "$@"
+		| 2>/dev/null ${HOME} $(pwd) local readonly printf then 2>/dev/null | echo
+		cd grep echo printf then echo && --verbose cd x=1 ${HOME} "$@" awk
+	x=1 'quoted text' test local test echo local "$@" then "$@" export &&
+--verbose ${HOME} cd "$@" && 'quoted text' | sed
+$(pwd) ${HOME} && cd -eu grep -eu echo --verbose
+	&& --verbose --verbose local --verbose local x=1 awk printf local
+&& local printf awk && /usr/bin 'quoted text' test grep done
+done | ${HOME} export done "$1" x=1 echo awk 2>/dev/null --verbose cd test --verbose
+		awk ${HOME} grep export 'quoted text' cd
+	"$@" --verbose export export | $(pwd) && -eu /usr/bin ${HOME}
+		then grep 2>/dev/null printf sed export
+/usr/bin --verbose && "$@" awk 'quoted text' $(pwd) sed
+	readonly test cd -eu done /usr/bin | grep cd && "$1" $(pwd)
+-eu "$@" local ${HOME} "$@" -eu $(pwd) test 2>/dev/null -eu && | cd export
+	printf 'quoted text' --verbose awk | ${HOME} echo awk --verbose local cd local
+	2>/dev/null 2>/dev/null 'quoted text' awk
+readonly echo done | printf 2>/dev/null export /usr/bin --verbose
+sed printf readonly ${HOME} -eu $(pwd) x=1 ${HOME} $(pwd) readonly $(pwd)
+${HOME} printf ${HOME} | 'quoted text'
+2>/dev/null printf export -eu
+	printf ${HOME} printf grep local 'quoted text'
+		done /usr/bin "$1" | 2>/dev/null readonly
+	| test x=1 --verbose ${HOME} awk then printf grep /usr/bin --verbose done sed
+sed sed sed /usr/bin --verbose printf test
+		"$1" awk $(pwd) echo sed 'quoted text' --verbose && /usr/bin
+		then echo readonly 'quoted text' --verbose "$1" "$1" --verbose
+	test 2>/dev/null $(pwd) sed local | ${HOME} ${HOME} local
+awk x=1 --verbose -eu grep --verbose export
+2>/dev/null local then && readonly "$@"
+		echo /usr/bin readonly grep sed x=1 sed -eu printf test /usr/bin
+		'quoted text' | 'quoted text' /usr/bin cd readonly test && printf -eu
+		readonly test | grep -eu grep --verbose
+echo printf done ${HOME} readonly "$1" done
+2>/dev/null readonly 'quoted text' awk readonly
+	grep export "$@" grep && test echo readonly "$@" sed
+		cd printf readonly test
+	$(pwd) /usr/bin | echo ${HOME}
+		--verbose 2>/dev/null printf 'quoted text' $(pwd) then cd
+printf | export sed grep
+	local grep | --verbose 'quoted text'
+2>/dev/null | cd 2>/dev/null 'quoted text' test 2>/dev/null
+		printf sed "$1" then printf test /usr/bin "$@" && | "$@" x=1 sed ${HOME} local
+		local 'quoted text' 'quoted text' -eu 2>/dev/null
+	readonly test | cd export sed readonly
+		2>/dev/null "$@" export x=1 "$@" awk sed "$1" 2>/dev/null
+		&& then readonly sed ${HOME} -eu local echo "$@" &&
+sed 2>/dev/null $(pwd) ${HOME} readonly readonly echo printf done then 2>/dev/null
+		cd 2>/dev/null 'quoted text'
+printf cd printf local echo -eu test -eu --verbose
+/usr/bin export x=1 grep export x=1 "$1" x=1 then then grep x=1
+	&& /usr/bin x=1 test export 2>/dev/null &&
+	"$1" local printf "$@" grep echo echo /usr/bin 'quoted text' echo
+--verbose done test --verbose | grep
+-eu printf local readonly grep grep cd grep
+	printf | --verbose export then "$@" "$1" $(pwd) local done test test
+		"$1" then "$@" cd grep /usr/bin --verbose export
+--verbose $(pwd) ${HOME} -eu test local && | test ${HOME}
+	${HOME} local test | | then test export
+"$@" -eu $(pwd) echo 'quoted text' -eu x=1 export --verbose test then readonly
+/usr/bin "$@" export grep
+&& $(pwd) "$@" echo grep "$1" done then test "$@" local /usr/bin ${HOME} done -eu
+		grep && $(pwd) cd && sed printf -eu && then | &&
+	$(pwd) "$1" && cd -eu && /usr/bin readonly $(pwd) "$@" export
+		test ${HOME} | readonly readonly printf
+		test --verbose test /usr/bin
+| echo && then 'quoted text' | done printf x=1 echo --verbose echo
+		printf printf local $(pwd) readonly
+		awk --verbose ${HOME} readonly "$1" | awk echo
+		/usr/bin sed awk | then readonly -eu 'quoted text' echo grep "$@" cd 2>/dev/null
+		readonly local $(pwd) --verbose test printf export awk
+		export sed && printf cd cd cd 2>/dev/null 2>/dev/null ${HOME} | --verbose then
+		local "$@" /usr/bin "$1" "$1" --verbose local sed "$@"
+		${HOME} readonly | export grep then grep echo --verbose x=1
+awk cd grep /usr/bin local test export printf echo grep awk 'quoted text' sed
+		| done x=1 echo 'quoted text' /usr/bin local "$1" /usr/bin
+local echo "$1" cd | $(pwd) x=1 local && local sed printf grep
+		'quoted text' ${HOME} -eu done "$@" done 2>/dev/null
+	echo -eu $(pwd) test 2>/dev/null "$@" then grep readonly local | export
+	echo x=1 --verbose "$1" $(pwd) /usr/bin "$1" --verbose
+	readonly local x=1 cd awk 'quoted text' | && printf sed cd
+then "$@" then readonly
+echo ${HOME} cd "$@" 'quoted text' 2>/dev/null awk cd awk sed "$@" --verbose
+	echo /usr/bin local x=1 x=1
+readonly x=1 --verbose cd "$@" x=1 sed local ${HOME} x=1 "$1"
+		&& printf 'quoted text' then echo printf done $(pwd) /usr/bin
+| cd local ${HOME} readonly && readonly
+test x=1 /usr/bin "$1" /usr/bin /usr/bin awk local "$1" grep readonly
+	local && test then awk "$@" then "$1"
+	--verbose && $(pwd) test 'quoted text' -eu 2>/dev/null "$1" "$1"
+		awk done x=1 awk readonly --verbose
+x=1 printf -eu grep echo awk x=1 readonly -eu --verbose echo x=1 echo 'quoted text'
+	printf "$@" awk /usr/bin --verbose && test sed local
+cd --verbose export -eu awk ${HOME} done awk "$@" && awk printf
+"$@" done cd cd --verbose -eu --verbose -eu grep done cd grep "$1" cd grep 2>/dev/null
+	sed $(pwd) && done export x=1 x=1 test $(pwd) cd echo 'quoted text' /usr/bin then
+printf done --verbose && --verbose readonly "$@" $(pwd) ${HOME} "$1" then export
+awk | awk && "$@" --verbose
+		/usr/bin cd && local readonly echo done "$1" | readonly readonly
+$(pwd) | /usr/bin /usr/bin export | grep test "$1" $(pwd) /usr/bin
+		local --verbose test cd x=1 'quoted text' $(pwd) 'quoted text' then
+		done x=1 | grep readonly local
+	| x=1 awk awk --verbose $(pwd) ${HOME} x=1 -eu 2>/dev/null x=1
+	"$@" $(pwd) "$1" printf local cd $(pwd) "$1" "$@" | 2>/dev/null then
+	test && ${HOME} ${HOME} awk && done test printf "$@" &&
+	&& awk printf 2>/dev/null
+	grep awk "$1" $(pwd) export --verbose | export "$1" && "$@" test && 2>/dev/null
+		2>/dev/null export echo x=1 "$1" awk --verbose test
+		cd readonly cd $(pwd) | && done echo | "$@" $(pwd)
+readonly 2>/dev/null 2>/dev/null sed 2>/dev/null
+done 2>/dev/null printf grep awk "$1" ${HOME} && printf awk
+		readonly awk && $(pwd) readonly "$1" then "$@"
+local --verbose $(pwd) sed
+$(pwd) cd cd readonly /usr/bin /usr/bin -eu "$1" x=1 | | --verbose
+	cd && x=1 $(pwd) 2>/dev/null readonly
+		done export export sed ${HOME}
+		readonly "$1" readonly 2>/dev/null ${HOME} $(pwd) "$1" readonly
+'quoted text' echo readonly --verbose 2>/dev/null "$@" ${HOME} && done -eu
+	${HOME} grep sed then ${HOME} ${HOME} local $(pwd)
+/usr/bin grep grep sed /usr/bin readonly
+		x=1 ${HOME} done printf printf sed ${HOME} "$1" -eu -eu local
+	x=1 | "$@" readonly test grep sed 2>/dev/null
+	| export awk local then 'quoted text' 'quoted text' grep echo "$1" grep
+x=1 --verbose x=1 test
+		&& ${HOME} "$1" awk ${HOME}
+"$1" readonly x=1 awk sed echo -eu ${HOME} awk sed cd sed 2>/dev/null export then
+	2>/dev/null "$@" sed && done "$1" | local printf grep
+local ${HOME} ${HOME} 'quoted text' ${HOME} ${HOME} printf
+		echo 2>/dev/null export printf
+local awk "$@" readonly readonly
+awk /usr/bin test grep echo test done echo test
+grep local | && /usr/bin | readonly -eu x=1
+done export -eu x=1 x=1 echo "$@" echo -eu grep x=1 cd --verbose
+	| | awk done $(pwd) $(pwd) export
+		'quoted text' readonly test
+	| | awk grep test "$1" "$1"
+"$1" readonly --verbose readonly ${HOME} x=1 awk local /usr/bin x=1 cd $(pwd) test
+readonly ${HOME} && local ${HOME} ${HOME} echo test -eu 2>/dev/null
+		--verbose export | && then 'quoted text' && grep
+		done 2>/dev/null cd -eu 'quoted text' cd
+sed /usr/bin readonly ${HOME} -eu /usr/bin
+	local sed "$1" sed | -eu done -eu "$@" -eu | test x=1 ${HOME} export readonly
+	export local x=1 -eu export | cd | grep --verbose readonly --verbose 2>/dev/null
+	x=1 printf export 'quoted text' readonly x=1 local test local
@@ -0,0 +1,2001 @@
+	then local cd x=1 "$1" "$1"
+	grep | then 2>/dev/null ${HOME} "$1" printf done printf then done && sed readonly
+		2>/dev/null grep ${HOME} test awk /usr/bin && "$@" readonly
+x=1 done grep awk readonly printf && readonly | export --verbose
+	${HOME} awk local sed printf && $(pwd) local awk readonly then
+awk export "$1" cd test 'quoted text' --verbose "$@" test cd 2>/dev/null
+	sed x=1 printf | printf "$@" test $(pwd) readonly then done
+| local /usr/bin then grep x=1 local export 2>/dev/null
+		awk -eu printf readonly /usr/bin export /usr/bin $(pwd) | --verbose
+		--verbose | "$1" test x=1 cd && grep
+done -eu x=1 $(pwd) -eu done ${HOME} 'quoted text'
+&& readonly sed -eu -eu test awk cd ${HOME} local local
+	| --verbose printf -eu test test readonly --verbose done 2>/dev/null
+		grep 2>/dev/null sed done then
+	${HOME} --verbose "$1" -eu
+		--verbose 2>/dev/null
+	| ${HOME} printf $(pwd) then "$@" x=1
+"$@" $(pwd) && awk sed printf grep --verbose readonly /usr/bin -eu
+	${HOME} $(pwd) local -eu "$@" echo 2>/dev/null x=1 export 2>/dev/null done awk
+	/usr/bin cd done ${HOME} grep ${HOME} && cd
+	cd echo && awk /usr/bin export x=1 grep sed "$1" ${HOME} local export local
+then local export test cd echo x=1 local then sed readonly done $(pwd) readonly
+		done && awk awk "$1" grep -eu then
+	grep test --verbose --verbose readonly
+	x=1 -eu export test sed local "$1" x=1 "$@" done 2>/dev/null && --verbose
+		2>/dev/null -eu cd 'quoted text'
+		x=1 ${HOME} printf x=1 --verbose awk printf
+		/usr/bin grep export 'quoted text' /usr/bin local readonly -eu then -eu "$@" awk
+&& -eu local sed readonly --verbose sed
+		$(pwd) "$@" export "$1" echo cd printf | 'quoted text' -eu | ${HOME}
+	then cd test test readonly echo --verbose
+	${HOME} sed && then "$1" sed cd echo
+	-eu awk $(pwd) done -eu
+	| $(pwd) echo --verbose x=1 ${HOME} grep 2>/dev/null awk echo /usr/bin echo
+		&& && --verbose $(pwd) $(pwd) /usr/bin 'quoted text'
+	sed echo | --verbose awk sed 'quoted text' cd echo && | sed x=1 && 'quoted text'
+	'quoted text' printf ${HOME} "$1" ${HOME} done sed grep | /usr/bin 'quoted text'
+	"$@" local readonly done awk && sed readonly printf
+		-eu $(pwd) "$1" readonly 'quoted text'
+export printf test ${HOME} echo x=1 echo x=1 | ${HOME}
+	export /usr/bin && 2>/dev/null
+sed 2>/dev/null 2>/dev/null "$1" /usr/bin
+sed local && 'quoted text' ${HOME} awk sed "$@"
+	'quoted text' done $(pwd)
+then "$@" awk 2>/dev/null /usr/bin then $(pwd)
+"$@" x=1 -eu "$1" x=1 -eu $(pwd)
+	echo export /usr/bin 'quoted text'
+then sed 'quoted text'
+	$(pwd) x=1 sed done 2>/dev/null &&
+	-eu readonly 2>/dev/null done --verbose local sed cd then then grep test
+	sed "$1" 2>/dev/null awk 2>/dev/null
+--verbose && export $(pwd) x=1 "$1" x=1 x=1 grep | && grep "$1" grep awk printf
+		'quoted text' 'quoted text' &&
+		2>/dev/null cd awk 'quoted text' "$@" test 'quoted text' 'quoted text'
+sed echo && ${HOME} readonly then
+	"$1" printf then test grep
+test /usr/bin local -eu "$@" echo export 2>/dev/null $(pwd) test awk
+	/usr/bin readonly 'quoted text' 'quoted text'
+		sed /usr/bin "$1" sed "$@" -eu local 2>/dev/null --verbose ${HOME} readonly
+		2>/dev/null done grep /usr/bin
+	test /usr/bin --verbose | --verbose x=1 readonly /usr/bin |
+	done done 2>/dev/null readonly local --verbose -eu x=1
+		awk local "$1" local grep "$@" awk ${HOME} local echo | readonly
+'quoted text' done echo awk cd local sed cd done && done -eu "$1" 2>/dev/null
+readonly && test "$@" | then 2>/dev/null "$1" && $(pwd)
+&& 'quoted text' "$@" ${HOME} /usr/bin ${HOME}
+	--verbose grep done 'quoted text' --verbose
+-eu printf -eu sed cd 2>/dev/null
+	test x=1 /usr/bin --verbose cd export
+$(pwd) 'quoted text' grep awk /usr/bin $(pwd)
+		-eu sed sed echo export 2>/dev/null test sed
+grep | echo awk 'quoted text' ${HOME}
+readonly local "$@" ${HOME} 2>/dev/null done readonly sed sed
+	$(pwd) grep | "$1" readonly grep then awk ${HOME} local --verbose
+		printf x=1 local sed --verbose sed "$@" 'quoted text' x=1 done then
+--verbose && printf -eu printf local | ${HOME} printf
+&& then --verbose "$1" ${HOME} readonly local && export /usr/bin
+	x=1 --verbose readonly sed | && done
+	&& echo -eu -eu --verbose local printf -eu echo && test -eu "$@" readonly $(pwd)
+	| sed ${HOME} --verbose printf export 2>/dev/null "$1"
+	-eu $(pwd) "$@" /usr/bin "$1" --verbose
+$(pwd) "$1" printf then echo $(pwd) && awk done $(pwd) done -eu --verbose "$@"
+echo /usr/bin $(pwd) awk -eu awk
+x=1 readonly $(pwd) 2>/dev/null
+		sed ${HOME} export --verbose "$@" 2>/dev/null 'quoted text'
+	then done "$@" -eu awk --verbose
+		export "$1" -eu ${HOME} ${HOME} "$@" sed
+		"$@" readonly --verbose echo ${HOME} $(pwd) sed
+x=1 -eu export awk "$@" "$1" cd $(pwd) readonly readonly "$@" awk /usr/bin
+		'quoted text' local && $(pwd) grep | "$1" && /usr/bin
+		&& test $(pwd) ${HOME} --verbose && then
+		$(pwd) "$1" "$1" 2>/dev/null $(pwd) readonly x=1 sed
+2>/dev/null ${HOME} && 'quoted text' readonly 'quoted text' && then readonly x=1
+	| 'quoted text' /usr/bin 'quoted text' /usr/bin readonly
+	&& "$@" readonly awk --verbose 2>/dev/null
+		$(pwd) test ${HOME} done cd grep
+| echo done "$1" awk printf
+--verbose readonly -eu cd -eu grep $(pwd) "$@" export done "$1"
+printf echo 2>/dev/null printf 2>/dev/null "$1"
+	"$@" --verbose | /usr/bin --verbose cd 'quoted text' sed
+/usr/bin | done "$@" local sed readonly --verbose ${HOME} cd readonly awk --verbose
+	printf --verbose "$1" cd && x=1
+	cd $(pwd) ${HOME} --verbose then
+	grep x=1 readonly awk $(pwd) done then printf then --verbose "$@"
+x=1 ${HOME} done echo --verbose --verbose 2>/dev/null --verbose "$@"
+grep 2>/dev/null $(pwd) "$1" "$1" | "$1" done test "$1" && "$@" cd
+x=1 x=1 x=1 'quoted text'
+	printf | export "$1" cd ${HOME} grep x=1 "$1" --verbose
+		local test && $(pwd) printf --verbose
+		cd readonly readonly printf --verbose /usr/bin --verbose
+	"$1" x=1 -eu 'quoted text' printf -eu printf ${HOME} /usr/bin -eu grep
+		| sed 'quoted text' then cd printf $(pwd)
+	--verbose local printf && &&
+	export sed done done /usr/bin "$1" ${HOME}
+		printf echo local x=1 readonly ${HOME} sed -eu /usr/bin x=1 cd
+	test sed export done done 2>/dev/null
+	/usr/bin | awk export --verbose done x=1 $(pwd) export echo
+		echo "$@" readonly --verbose 'quoted text'
+		x=1 "$1" test export echo 2>/dev/null "$1" "$@" 2>/dev/null
+2>/dev/null then cd sed -eu test && "$1" ${HOME} done --verbose
+		2>/dev/null "$@" grep x=1 | x=1 test test cd && cd grep --verbose sed
+		"$@" | 'quoted text' 'quoted text' "$@" 2>/dev/null x=1 printf printf
+${HOME} sed -eu done printf awk ${HOME} cd && $(pwd)
+	x=1 "$1" sed export 'quoted text' --verbose sed done then
+	x=1 done sed $(pwd) grep ${HOME} x=1 "$@" grep awk $(pwd) then "$@"
+printf local readonly sed 2>/dev/null done "$@" then sed export
+	"$1" 'quoted text' /usr/bin
+	&& $(pwd) --verbose test done local /usr/bin sed /usr/bin test
+	$(pwd) 'quoted text' "$1" then echo then | x=1 test
+/usr/bin ${HOME} /usr/bin ${HOME} ${HOME} 2>/dev/null | 'quoted text'
+		${HOME} 'quoted text' local 'quoted text' test cd echo echo printf done local
+	then | "$1" printf && test &&
+	grep grep readonly 'quoted text' done test 'quoted text' -eu awk sed then
+"$@" "$1" then printf --verbose sed && $(pwd) 'quoted text' done 'quoted text'
+		| "$@" "$1" echo $(pwd) "$1" 'quoted text'
+	"$@" then local "$@" && 2>/dev/null echo | export "$@" "$@" 2>/dev/null --verbose
+		echo sed printf "$@" awk sed printf "$1" echo then ${HOME} local
+		local grep /usr/bin awk /usr/bin ${HOME} cd 2>/dev/null
+export "$@" $(pwd) grep local 'quoted text' 'quoted text' sed "$@" | 2>/dev/null
+		grep local cd -eu x=1 x=1 printf 'quoted text' ${HOME} 2>/dev/null "$@" ${HOME}
+		${HOME} local printf printf then x=1 readonly cd | x=1 done then --verbose then
+		x=1 --verbose test -eu | && "$@" | -eu
+		export 2>/dev/null "$@" printf
+		"$@" readonly local echo local done printf test cd "$1"
+/usr/bin readonly && awk echo done 'quoted text' x=1 grep
+	grep grep -eu 2>/dev/null echo
+		local 2>/dev/null -eu readonly grep readonly awk &&
+		readonly done | --verbose printf export /usr/bin x=1 'quoted text'
+		| echo local grep cd $(pwd)
+		x=1 ${HOME} -eu && cd echo
+	'quoted text' 'quoted text' done "$@" "$1" readonly
+echo 'quoted text' printf awk awk /usr/bin /usr/bin
+2>/dev/null "$1" /usr/bin cd then local
+	awk 2>/dev/null --verbose --verbose 'quoted text' awk then 'quoted text'
+	export "$1" test then awk cd done "$@" readonly export awk --verbose
+	sed cd awk echo $(pwd) sed awk echo ${HOME} cd /usr/bin "$@" printf readonly
+-eu awk grep then -eu
+		-eu grep then export cd echo grep sed --verbose
+sed "$@" sed then cd ${HOME} x=1 2>/dev/null done done then "$1"
+awk export -eu "$@" && cd
+	awk --verbose awk local "$1" grep 2>/dev/null grep "$1" | grep ${HOME} /usr/bin
+		"$@" 'quoted text' local local grep ${HOME}
+grep 2>/dev/null 2>/dev/null "$@" test test printf
+&& export ${HOME} local | then awk local | grep 2>/dev/null cd grep test
+		then --verbose echo test local /usr/bin $(pwd)
+--verbose cd echo echo echo ${HOME} "$@" test && printf grep &&
+	&& | 'quoted text' $(pwd) then 'quoted text' sed printf export --verbose
+&& export && grep readonly
+	done --verbose 2>/dev/null && awk 'quoted text' /usr/bin local
+	-eu echo test cd 'quoted text' awk -eu export awk 'quoted text' ${HOME}
+		-eu then 2>/dev/null cd done $(pwd) 2>/dev/null
+"$1" ${HOME} readonly 2>/dev/null
+/usr/bin && | printf sed "$1" --verbose
+		$(pwd) 2>/dev/null "$1" && /usr/bin local export 'quoted text' $(pwd)
+		readonly sed x=1 export ${HOME} printf |
+	local && 2>/dev/null && 'quoted text' sed ${HOME} echo
+test "$1" | 2>/dev/null x=1 x=1 export test 2>/dev/null /usr/bin 2>/dev/null
+'quoted text' done local cd echo x=1 local -eu
+		x=1 -eu $(pwd) --verbose grep 2>/dev/null
+		| readonly && "$1" local -eu 'quoted text' 2>/dev/null
+		echo sed awk -eu export
+		echo "$@" ${HOME} x=1 | 2>/dev/null ${HOME} "$@" | test local | 2>/dev/null
+${HOME} cd 2>/dev/null local -eu grep --verbose x=1 --verbose x=1 --verbose grep
+readonly local sed done sed $(pwd) test export /usr/bin "$@" | local 2>/dev/null
+/usr/bin echo | "$@" grep grep done grep /usr/bin
+awk x=1 /usr/bin test --verbose /usr/bin printf readonly sed "$1" "$@"
+		2>/dev/null "$@" cd export sed -eu -eu sed "$1" then 2>/dev/null ${HOME}
+	"$@" --verbose done -eu $(pwd) printf
+	done sed export -eu done awk cd done -eu local 2>/dev/null 'quoted text'
+		"$1" printf $(pwd) cd export awk local grep awk awk echo "$1" | test ${HOME}
+awk then cd "$@" then awk 'quoted text' sed | $(pwd) local echo
+local export $(pwd) ${HOME} test
+done export sed awk sed x=1 then export grep test 2>/dev/null done 'quoted text'
+	readonly printf | then echo done cd awk "$@" then /usr/bin
+	echo cd cd awk 2>/dev/null test ${HOME} test printf ${HOME} local done 2>/dev/null
+	awk /usr/bin echo -eu && then 2>/dev/null then ${HOME}
+		&& local /usr/bin then /usr/bin x=1 --verbose "$1" echo cd echo
+awk done then local export 'quoted text'
+	local ${HOME} echo /usr/bin -eu --verbose $(pwd) | "$@" && local
+"$@" awk | readonly done done printf export
+'quoted text' | ${HOME} awk test
+'quoted text' $(pwd) x=1 --verbose readonly
+	"$1" test printf printf ${HOME} done "$@" 2>/dev/null test
+done x=1 test 2>/dev/null
+		done 2>/dev/null cd x=1 test
+		grep awk printf test done | echo then &&
+	$(pwd) && grep $(pwd) "$@" sed ${HOME} echo printf x=1 readonly && sed
+		export local done 2>/dev/null
+		export readonly x=1 printf --verbose
+		echo ${HOME} x=1 sed
+		sed done local cd export cd $(pwd) echo echo test local "$1" |
+	2>/dev/null printf /usr/bin
+--verbose x=1 $(pwd) done export export
+		local "$@" export echo readonly x=1 readonly ${HOME} cd
+sed 'quoted text' printf "$1" --verbose
+	$(pwd) cd grep test then 2>/dev/null x=1 then printf
+'quoted text' echo 'quoted text' 2>/dev/null test |
+	export 'quoted text' /usr/bin | cd readonly
+export --verbose cd awk done ${HOME} export test --verbose
+echo local local x=1 -eu grep "$@" echo readonly "$@" sed
+"$1" grep "$@" -eu awk test x=1 done test grep --verbose $(pwd)
+cd done 'quoted text' cd --verbose
+${HOME} printf 2>/dev/null grep echo local x=1 done test -eu done x=1 printf
+		'quoted text' export local awk echo /usr/bin
+		done "$1" export grep | 'quoted text' /usr/bin
+		sed $(pwd) done done x=1 export x=1 --verbose cd echo cd local
+--verbose $(pwd) test awk x=1 | x=1 && | echo /usr/bin done done
+		| -eu -eu sed local -eu
+&& printf export local | 2>/dev/null test && --verbose echo x=1 printf
+	done local && printf ${HOME} sed echo | sed printf
+"$@" sed 'quoted text' printf
+	2>/dev/null printf 2>/dev/null then ${HOME}
+--verbose then "$1" -eu ${HOME}
+-eu && printf "$@" grep 'quoted text' grep && "$1" then $(pwd) && cd
+	-eu sed echo -eu x=1 2>/dev/null 'quoted text'
+'quoted text' x=1 readonly
+		$(pwd) -eu | "$1" then grep
+		export -eu "$@" done
+		grep | $(pwd) --verbose readonly 2>/dev/null $(pwd) readonly cd local | "$1" echo
+	"$1" -eu 2>/dev/null grep
+		&& "$1" test readonly | x=1
+	"$1" /usr/bin 'quoted text'
+/usr/bin 2>/dev/null awk sed | && x=1 /usr/bin sed test -eu done
+	x=1 test "$1" && done -eu "$@" then $(pwd) | ${HOME} /usr/bin sed echo
+		sed test sed "$1" then echo awk printf $(pwd) 'quoted text' awk 2>/dev/null
+	export then --verbose -eu ${HOME}
+		done $(pwd) then "$1" done readonly 2>/dev/null sed echo
+		"$1" "$@" x=1 local | x=1 echo --verbose ${HOME}
+	&& $(pwd) /usr/bin cd /usr/bin "$1"
+local "$@" --verbose 'quoted text' -eu x=1 2>/dev/null
+		awk x=1 done grep printf /usr/bin 'quoted text'
+--verbose "$1" awk 'quoted text' -eu local 2>/dev/null
+done && grep "$1" readonly -eu x=1 x=1 test x=1 cd
+sed export cd --verbose --verbose
+grep --verbose then local -eu /usr/bin 'quoted text' printf /usr/bin
+		test test ${HOME} "$1" printf ${HOME} test export "$1" ${HOME} printf
+		--verbose 'quoted text' "$1" awk grep
+/usr/bin awk 2>/dev/null ${HOME} printf local
+	"$1" readonly grep test && printf 'quoted text' readonly
+	"$1" grep 'quoted text' "$@" x=1 awk printf grep
+	--verbose then cd 'quoted text'
+	${HOME} $(pwd) cd sed "$1" $(pwd) /usr/bin
+2>/dev/null 'quoted text' --verbose
+	"$1" x=1 | sed then "$@" && "$1" 'quoted text' | "$1"
+	2>/dev/null ${HOME} test $(pwd) 2>/dev/null ${HOME} "$@" --verbose printf "$1"
+		export --verbose ${HOME} export /usr/bin && done
+'quoted text' -eu grep echo 2>/dev/null local /usr/bin | && $(pwd) && printf printf
+		2>/dev/null then $(pwd) cd 'quoted text' done ${HOME} "$@" && test sed "$1"
+		sed -eu && --verbose 2>/dev/null "$1" | "$1"
+		printf export readonly | cd printf "$1" awk $(pwd)
+		echo readonly grep /usr/bin printf ${HOME} x=1 test
+	"$@" /usr/bin x=1 done done then 'quoted text' test awk local sed --verbose
+	"$1" && && 'quoted text'
+		x=1 --verbose 2>/dev/null
+local then sed export -eu 2>/dev/null --verbose
+${HOME} echo grep test awk "$1" "$@" grep
+local --verbose x=1 grep readonly cd test /usr/bin
+cd 2>/dev/null $(pwd) done export 2>/dev/null
+then "$@" cd --verbose export | $(pwd)
+		echo sed ${HOME} printf
+	'quoted text' && readonly readonly x=1 -eu
+		${HOME} ${HOME} && 2>/dev/null readonly printf | cd
+2>/dev/null --verbose readonly
+		done sed sed local -eu then 'quoted text' 2>/dev/null /usr/bin echo
+	2>/dev/null && test &&
+		cd "$@" $(pwd) | --verbose export "$@" done
+	x=1 then $(pwd) $(pwd) && test grep "$1" /usr/bin local local
+		'quoted text' "$1" sed $(pwd) sed printf grep then 'quoted text' sed $(pwd)
+	test readonly sed --verbose | --verbose export
+	&& "$1" "$@" test readonly test done
+	test local -eu sed && ${HOME} awk cd 'quoted text'
+2>/dev/null grep -eu cd grep /usr/bin awk local readonly grep export &&
+	| cd -eu -eu /usr/bin test printf 'quoted text' then cd
+	-eu && grep 'quoted text' 2>/dev/null
+	sed 2>/dev/null x=1 'quoted text' --verbose 2>/dev/null
+echo grep ${HOME} then --verbose ${HOME} echo local /usr/bin
+	readonly 2>/dev/null readonly "$@"
+done "$@" awk "$@" ${HOME} ${HOME} awk "$@" echo printf grep | grep
+		sed local test cd 2>/dev/null
+$(pwd) awk test then test "$1" local
+		local 2>/dev/null test /usr/bin ${HOME} then test local | "$@" -eu | grep
+		"$@" "$@" $(pwd) sed done /usr/bin ${HOME} && test local
+		'quoted text' test echo 2>/dev/null test test printf cd echo readonly
+	-eu /usr/bin /usr/bin | awk sed
+		sed printf local && 'quoted text' -eu grep sed echo test 'quoted text' "$@"
+		&& x=1 echo cd done echo "$@" echo ${HOME} "$1"
+readonly /usr/bin -eu x=1 $(pwd) 'quoted text'
+		2>/dev/null printf awk "$@" sed | done 2>/dev/null
+		test readonly --verbose sed local cd x=1 $(pwd) "$1" then ${HOME}
+		sed local test done readonly | awk then cd && 'quoted text' readonly
+cd local /usr/bin | grep echo local $(pwd) "$1" ${HOME} 2>/dev/null "$@"
+	cd grep export "$1" $(pwd) -eu && export cd
+	${HOME} 2>/dev/null cd cd readonly "$@"
+		| -eu ${HOME} 2>/dev/null ${HOME} ${HOME}
+${HOME} readonly "$1" $(pwd) | echo
+	-eu $(pwd) "$1" x=1 $(pwd) local echo | $(pwd)
+		| && "$1" done export readonly sed --verbose export readonly
+2>/dev/null "$1" export test "$@" x=1
+	export local grep /usr/bin --verbose
+		cd then cd printf --verbose -eu readonly sed ${HOME}
+		x=1 awk --verbose readonly printf test cd
+sed export export -eu x=1
+	export ${HOME} sed readonly test ${HOME} export then then && echo export
+	-eu | sed && cd awk readonly test
+		/usr/bin printf readonly
+	test "$@" 'quoted text' /usr/bin ${HOME} export then then --verbose
+	echo x=1 "$@" export export local "$1"
+/usr/bin export 2>/dev/null ${HOME} export sed ${HOME} "$1" ${HOME} grep 'quoted text'
+local done x=1 echo | "$@" "$@" $(pwd) --verbose --verbose
+		2>/dev/null "$1" -eu echo then
+${HOME} | grep sed echo x=1 'quoted text' cd -eu "$1" cd awk
+	| && && "$@" "$1" done
+	$(pwd) then readonly sed done cd printf test | then printf
+	sed "$@" printf local $(pwd) "$1" "$1" sed 'quoted text' then | cd "$1" --verbose
+&& cd ${HOME} && && test -eu && grep readonly 'quoted text'
+&& test ${HOME} -eu $(pwd)
+then x=1 'quoted text' /usr/bin -eu ${HOME} then sed export
+$(pwd) readonly -eu $(pwd) "$@" 2>/dev/null "$@" $(pwd)
+	done printf test ${HOME} "$@" ${HOME} 'quoted text' "$1" $(pwd)
+'quoted text' -eu -eu awk test export cd && 2>/dev/null
+		${HOME} grep /usr/bin ${HOME} x=1 ${HOME} "$1" $(pwd) cd sed $(pwd) "$1" "$1" "$@"
+	/usr/bin 'quoted text' --verbose && cd --verbose | | 'quoted text' awk local test
+printf --verbose "$@" 'quoted text' 2>/dev/null x=1
+	then test grep local grep $(pwd)
+"$@" 2>/dev/null -eu 2>/dev/null readonly
+-eu then "$@" export printf printf done ${HOME} test 'quoted text' /usr/bin export
+	then x=1 local echo echo "$@" && sed done -eu test x=1 && awk sed 2>/dev/null
+		--verbose awk awk $(pwd) && sed echo --verbose
+$(pwd) "$@" ${HOME} cd $(pwd) awk cd $(pwd)
+${HOME} /usr/bin sed awk /usr/bin 2>/dev/null
+		'quoted text' 'quoted text' sed && export awk done "$@" done x=1 ${HOME}
+	awk "$1" sed echo --verbose local echo
+	${HOME} -eu && "$@" export test --verbose test printf printf | /usr/bin
+&& x=1 then export local
+printf awk export && readonly sed 'quoted text' /usr/bin awk &&
+"$@" sed | --verbose grep test test 'quoted text' -eu
+readonly 'quoted text' printf test local /usr/bin ${HOME} ${HOME}
+${HOME} test --verbose echo && --verbose 'quoted text' "$@" "$1" then
+	sed $(pwd) ${HOME} export test | test
+		cd then "$@" export done then
+	sed printf 'quoted text'
+	"$@" /usr/bin printf 'quoted text'
+	2>/dev/null test printf 'quoted text' local sed $(pwd) export printf printf
+export x=1 'quoted text' 'quoted text'
+		-eu cd x=1 cd grep sed then printf 2>/dev/null export grep
+export "$1" export grep sed --verbose -eu x=1 printf cd sed test 2>/dev/null
+		readonly awk "$@" echo
+	x=1 grep export done "$@" awk 'quoted text' test && export
+echo export test echo ${HOME} -eu test sed sed && x=1 readonly
+	--verbose && grep cd --verbose cd awk readonly "$@" 2>/dev/null --verbose
+	-eu /usr/bin --verbose "$1" done
+		/usr/bin done awk export 2>/dev/null 2>/dev/null
+readonly sed export echo && test then
+	'quoted text' "$1" "$@" awk sed test --verbose | grep done x=1 awk
+		sed grep -eu --verbose "$1"
+	--verbose && cd && done readonly $(pwd) /usr/bin --verbose
+		export grep --verbose -eu printf 2>/dev/null then x=1 ${HOME} "$@" 'quoted text'
+		test done 'quoted text' "$1" | done && export
+		&& cd /usr/bin -eu "$@" "$1" "$@" readonly echo export readonly
+	cd printf cd $(pwd) -eu 'quoted text' | --verbose "$1" x=1 "$1" grep
+	"$1" /usr/bin --verbose "$@" /usr/bin export done "$1" test then
+${HOME} test export printf then test
+		-eu local 'quoted text' echo /usr/bin local cd && echo readonly "$1" cd x=1
+"$1" 2>/dev/null && "$1" | 'quoted text' printf then test 'quoted text'
+done printf -eu /usr/bin grep
+		test && -eu awk 2>/dev/null test local "$@" ${HOME}
+		'quoted text' ${HOME} 2>/dev/null grep sed x=1 -eu 'quoted text'
+| then /usr/bin ${HOME}
+		local then grep done local sed | readonly ${HOME} "$@"
+grep sed /usr/bin /usr/bin 2>/dev/null grep export --verbose --verbose x=1
+		grep export readonly readonly && local cd readonly printf done local "$@" cd readonly
+$(pwd) | then "$1" then test sed local /usr/bin export
+"$1" local grep readonly |
+	x=1 then readonly done echo $(pwd) "$@" then printf cd local "$1" done readonly
+	sed awk ${HOME} export then cd then 'quoted text' x=1 $(pwd)
+	${HOME} test export --verbose -eu x=1 $(pwd)
+2>/dev/null | | done readonly x=1 grep "$@" readonly awk
+		done -eu ${HOME} 2>/dev/null
+	cd done && awk $(pwd) $(pwd) test 'quoted text' awk printf -eu
+		grep "$@" then readonly local echo export readonly then readonly awk echo
+done && export grep 'quoted text'
+		awk | echo -eu 'quoted text' readonly
+	export ${HOME} then 'quoted text' printf export readonly export
+| export --verbose 'quoted text' export
+		/usr/bin cd test | | sed
+	echo -eu "$1" --verbose $(pwd) $(pwd) export
+"$@" 2>/dev/null export awk $(pwd) && cd x=1 /usr/bin sed && cd done $(pwd)
+	| "$@" "$@" ${HOME} done done x=1 | test |
+'quoted text' awk $(pwd)
+&& 'quoted text' $(pwd) done -eu echo &&
+		/usr/bin "$1" $(pwd) "$@"
+	export /usr/bin grep 'quoted text' 'quoted text' echo x=1 printf readonly awk
+-eu 'quoted text' /usr/bin then | grep test $(pwd) 2>/dev/null then $(pwd)
+	2>/dev/null awk 'quoted text' ${HOME} grep cd && test /usr/bin
+		awk then && x=1 2>/dev/null local then
+	echo && grep "$1" /usr/bin /usr/bin
+/usr/bin ${HOME} local readonly 'quoted text' --verbose
+		done cd ${HOME} /usr/bin cd grep $(pwd) sed readonly
+grep "$@" "$@" test grep done then
+		cd sed printf x=1 local awk local cd echo echo x=1 cd then then readonly
+'quoted text' printf 2>/dev/null awk printf -eu printf | done "$1"
+		export --verbose x=1 /usr/bin done readonly local local done
+	| done grep "$@" cd cd | test
+		2>/dev/null $(pwd) echo printf
+		then /usr/bin awk local "$@" test sed && printf grep test
+		/usr/bin $(pwd) -eu export "$@" printf /usr/bin --verbose
+		awk "$1" "$@" "$1" 2>/dev/null
+		| grep echo $(pwd) "$1" export then local export local
+x=1 then readonly /usr/bin then "$@" grep x=1 2>/dev/null then -eu -eu $(pwd) --verbose
+test "$1" && 2>/dev/null ${HOME} $(pwd) /usr/bin && -eu x=1 printf
+		${HOME} && cd test /usr/bin ${HOME} awk "$1" sed done sed /usr/bin printf 2>/dev/null
+2>/dev/null 'quoted text'
+	2>/dev/null cd done "$@" grep 'quoted text' $(pwd) -eu export /usr/bin
+	grep grep then $(pwd) test printf
+		${HOME} 2>/dev/null $(pwd) ${HOME} "$1"
+	-eu 2>/dev/null -eu ${HOME} ${HOME} awk grep readonly readonly "$1" "$1" "$@"
+	test 2>/dev/null sed cd /usr/bin "$@" --verbose
+		echo echo test --verbose | "$@" /usr/bin
+		done "$@" 2>/dev/null local test && done grep
+		then local test done done "$1" cd awk cd /usr/bin
+	-eu export --verbose 2>/dev/null
+${HOME} "$@" "$@" grep awk awk $(pwd) local
+		then local cd && cd sed $(pwd) $(pwd)
+| readonly -eu awk "$1" "$1" cd done 'quoted text' printf local
+test grep cd then 2>/dev/null
+local x=1 2>/dev/null && grep $(pwd) done
+		"$@" then test awk "$@" done $(pwd) awk printf
+	export --verbose export export 2>/dev/null
+		test -eu sed cd /usr/bin awk | $(pwd) awk export --verbose ${HOME} awk echo
+done /usr/bin ${HOME} --verbose && /usr/bin export ${HOME} printf | printf
+	"$@" printf echo 'quoted text' ${HOME} 2>/dev/null then
+		cd 'quoted text' done sed grep grep grep echo /usr/bin
+	-eu test "$@" $(pwd) then -eu then export 2>/dev/null 2>/dev/null test printf
+	'quoted text' then printf "$@" then "$1" then echo --verbose
+/usr/bin --verbose x=1 $(pwd) export
+	&& printf $(pwd) local | cd printf --verbose
+sed "$1" 2>/dev/null | local echo then echo 2>/dev/null --verbose
+	local "$1" awk | x=1 x=1 local cd 2>/dev/null cd readonly
+		/usr/bin sed $(pwd) sed -eu local sed printf 2>/dev/null "$@" "$1" echo
+		'quoted text' sed test | && 2>/dev/null echo x=1 "$@" -eu -eu test grep
+		| ${HOME} cd 2>/dev/null cd test echo grep -eu && export
+	echo export 2>/dev/null "$@" &&
+	test cd printf "$1" then
+sed /usr/bin awk && readonly 2>/dev/null then "$1" done --verbose
+	sed export awk then sed ${HOME} sed
+		awk test test && sed "$@" grep local --verbose awk x=1 "$@" awk --verbose
+-eu --verbose local ${HOME} done
+	grep done readonly local | ${HOME} awk sed done test && 2>/dev/null
+	'quoted text' 'quoted text' "$1" done readonly
+		x=1 local local -eu -eu done "$1" cd readonly echo --verbose
+		test ${HOME} readonly readonly -eu readonly "$1" local
+"$1" /usr/bin 'quoted text'
+		'quoted text' done $(pwd) cd 'quoted text' $(pwd) && done
+local readonly "$1" && "$1" cd 2>/dev/null "$1" --verbose | "$@" cd awk
+&& x=1 -eu $(pwd) "$1" -eu | grep -eu then local echo "$1" printf printf
+sed echo && /usr/bin --verbose echo cd export && done sed
+	readonly echo -eu grep test | echo -eu "$@" echo cd cd printf
+"$@" | -eu cd test printf printf ${HOME} -eu
+printf ${HOME} echo local export | printf x=1 'quoted text' -eu $(pwd)
+--verbose then $(pwd) ${HOME} then export | x=1 then ${HOME} --verbose
+	| "$@" then test /usr/bin && then -eu && then readonly
+		echo "$@" then && x=1 'quoted text'
+	-eu $(pwd) sed local then done
+${HOME} local -eu then $(pwd) /usr/bin cd "$1" | $(pwd) readonly 'quoted text'
+		cd printf 'quoted text' then awk 'quoted text'
+		echo export done awk | awk printf "$1" $(pwd) sed --verbose && readonly done
+/usr/bin --verbose "$1" test ${HOME} export --verbose echo
+2>/dev/null "$@" then export export $(pwd) 'quoted text'
+local sed readonly then 'quoted text' export
+		$(pwd) -eu ${HOME} x=1 test export printf awk done x=1
+"$@" awk x=1 printf cd cd 2>/dev/null
+printf then then | x=1 then readonly then 'quoted text' --verbose export echo
+		grep printf awk "$1" test export "$@" local -eu local -eu test ${HOME}
+/usr/bin test readonly done
+	--verbose /usr/bin readonly | printf awk done grep sed ${HOME} sed
+done cd awk readonly sed 'quoted text' --verbose | local
+		local printf 2>/dev/null sed "$@" | sed "$1"
+printf grep local printf && "$1" printf export
+		/usr/bin 'quoted text' && -eu test ${HOME} && /usr/bin then
+		then readonly done 'quoted text' readonly grep export local
+	test -eu cd 'quoted text' x=1 done done cd 'quoted text' awk sed
+		sed && 'quoted text' printf then --verbose test ${HOME} echo readonly export "$@"
+"$1" $(pwd) test cd grep ${HOME} x=1 test local -eu "$@"
+		&& "$@" --verbose -eu done printf $(pwd) --verbose -eu printf "$1" -eu
+		then test done $(pwd) done test printf echo awk awk
+		| then 'quoted text' ${HOME} local ${HOME} --verbose done 2>/dev/null
+/usr/bin $(pwd) sed --verbose "$@" "$@" ${HOME} grep 2>/dev/null ${HOME} x=1 local
+	printf awk grep x=1 x=1 sed readonly x=1 x=1 then | | awk $(pwd) ${HOME} /usr/bin
+		'quoted text' awk /usr/bin test done cd done readonly $(pwd) test "$@" /usr/bin
+awk printf 'quoted text' x=1 test done
+	"$1" $(pwd) 'quoted text' cd sed grep export readonly 2>/dev/null
+sed $(pwd) $(pwd) && x=1 -eu then "$@" then readonly export -eu "$@" "$1" "$@"
+	test ${HOME} grep $(pwd) && 2>/dev/null cd 2>/dev/null
+grep sed cd grep export sed cd | --verbose --verbose 2>/dev/null
+export test --verbose ${HOME}
+		'quoted text' 2>/dev/null -eu | 'quoted text'
+		"$@" awk readonly cd x=1 local done
+	&& sed readonly 2>/dev/null "$@" echo $(pwd) test grep -eu test --verbose
+test grep printf grep export | export
+then grep readonly test && echo $(pwd) test 2>/dev/null sed "$@"
+sed cd done awk "$@" test "$@" $(pwd) x=1 "$1" echo
+sed -eu test cd echo test
+		--verbose | --verbose then then $(pwd)
+&& cd cd "$@" done /usr/bin awk grep ${HOME}
+${HOME} 'quoted text' cd 2>/dev/null ${HOME}
+local export done then cd then awk /usr/bin
+	$(pwd) | grep "$1" && readonly awk echo test ${HOME}
+		/usr/bin then done local sed done x=1 | && done done "$1" && done $(pwd) -eu printf
+grep done --verbose "$1" /usr/bin awk 'quoted text'
+		readonly done awk readonly grep echo printf /usr/bin grep cd --verbose echo
+		then "$@" /usr/bin && sed --verbose grep x=1 local then printf then
+	then grep printf printf "$1" x=1 --verbose
+	$(pwd) test cd test echo ${HOME} 2>/dev/null then
+	${HOME} ${HOME} test echo ${HOME} | grep local test $(pwd) awk done local echo
+cd && -eu 'quoted text' readonly export awk $(pwd) printf
+	'quoted text' $(pwd) "$1" | && sed | test awk
+	test -eu test $(pwd) 2>/dev/null
+&& "$1" sed 'quoted text'
+		local test printf done x=1 "$@" && | cd local 2>/dev/null printf -eu
+		grep -eu /usr/bin -eu /usr/bin 'quoted text' ${HOME} sed $(pwd) test 'quoted text'
+		export awk && ${HOME} sed local export printf $(pwd) export --verbose printf
+	echo grep "$1" /usr/bin | then done $(pwd) sed 'quoted text'
+${HOME} awk readonly local grep 'quoted text' 2>/dev/null "$@" printf
+readonly export | $(pwd) export --verbose readonly |
+	"$1" readonly 2>/dev/null | local "$@"
+	'quoted text' awk echo grep readonly x=1 | $(pwd) "$@" local "$@" $(pwd)
+		${HOME} -eu "$@" --verbose export ${HOME} ${HOME} awk grep echo 'quoted text'
+	test echo 'quoted text' "$@" --verbose
+		&& cd | readonly && export then x=1 sed export
+| printf -eu 2>/dev/null then --verbose awk local awk ${HOME} grep done
+readonly /usr/bin --verbose /usr/bin | "$@" local printf readonly awk --verbose
+	echo awk "$@" sed awk done done $(pwd) --verbose readonly printf then ${HOME}
+		2>/dev/null sed | sed /usr/bin
+		awk "$1" printf 'quoted text' local readonly x=1 /usr/bin $(pwd) --verbose
+		2>/dev/null "$@" /usr/bin test ${HOME}
+		"$@" /usr/bin done export test readonly
+2>/dev/null export "$@" /usr/bin --verbose /usr/bin |
+		&& x=1 'quoted text' then "$1" $(pwd) test 2>/dev/null
+		printf grep 'quoted text' readonly
+	"$1" /usr/bin x=1 2>/dev/null /usr/bin --verbose
+		'quoted text' /usr/bin --verbose grep readonly "$@" | $(pwd) 2>/dev/null && export
+		readonly cd -eu 2>/dev/null test export done 'quoted text' "$@" echo
+		printf /usr/bin -eu then /usr/bin x=1
+	local -eu 2>/dev/null $(pwd) 2>/dev/null && 2>/dev/null readonly
+"$1" echo --verbose 'quoted text' sed ${HOME}
+local local "$@" sed 'quoted text' 2>/dev/null x=1 2>/dev/null && 2>/dev/null
+		&& echo done 2>/dev/null
+	grep 'quoted text' "$@" | printf $(pwd) | local sed echo 'quoted text'
+then printf readonly --verbose ${HOME} printf
+awk then && export done "$@" "$1" printf local grep local
+then export local "$@" && | -eu && then then
+x=1 test 2>/dev/null export |
+export local "$@" awk done
+		cd | export "$1" echo | then 'quoted text' ${HOME}
+	"$1" /usr/bin export then | echo printf
+	local done | 2>/dev/null local then local test $(pwd) -eu sed
+--verbose printf sed x=1 /usr/bin -eu echo --verbose $(pwd) test done
+then grep -eu ${HOME} printf printf sed "$1" x=1 awk | x=1 printf "$@" done
+&& then /usr/bin $(pwd) grep 'quoted text'
+	sed -eu x=1 x=1 x=1 && | "$@" test then "$1" | ${HOME} local &&
+		| done "$@" 'quoted text' "$1" grep x=1 "$@" test "$@" /usr/bin
+		"$@" ${HOME} 2>/dev/null printf awk readonly local
+	${HOME} "$@" printf printf awk "$@" echo printf --verbose ${HOME} "$1"
+		done --verbose && echo cd ${HOME} grep /usr/bin printf test 'quoted text'
+		cd 2>/dev/null then local --verbose --verbose
+		done readonly ${HOME} cd awk readonly grep /usr/bin ${HOME} done x=1
+$(pwd) && /usr/bin ${HOME} awk ${HOME} "$1" -eu readonly x=1
+	'quoted text' test export /usr/bin awk
+	local -eu $(pwd) grep sed then export ${HOME} /usr/bin "$1" printf "$@"
+		-eu -eu awk local 'quoted text'
+	x=1 ${HOME} readonly x=1 x=1 then x=1 export
+sed cd | export readonly /usr/bin --verbose grep x=1 "$@" test
+	echo 'quoted text' ${HOME} readonly /usr/bin test "$1"
+	| 2>/dev/null "$1" | then
+	then 'quoted text' awk -eu
+	grep "$@" then grep "$1" export echo export awk ${HOME} export echo && sed
+	"$1" readonly x=1 "$1" then x=1 x=1 && --verbose -eu export then "$@"
+	test cd export x=1 test echo ${HOME} printf -eu 2>/dev/null "$@" local --verbose
+	readonly $(pwd) "$1" 2>/dev/null -eu && test echo | cd done test cd ${HOME}
+		readonly 'quoted text' | sed 2>/dev/null grep /usr/bin && 'quoted text'
+		export | "$1" then cd sed ${HOME} 2>/dev/null sed /usr/bin grep $(pwd) x=1
+		awk --verbose echo grep /usr/bin 'quoted text'
+		2>/dev/null sed x=1 grep 2>/dev/null grep grep
+		sed sed cd test "$1" done && x=1 echo
+	/usr/bin && | x=1 /usr/bin "$1"
+	&& local local "$1" cd x=1 done sed /usr/bin 'quoted text'
+	test --verbose -eu "$@" --verbose /usr/bin echo echo
+"$1" awk test 2>/dev/null local sed /usr/bin --verbose sed
+'quoted text' then local "$1" ${HOME} "$@" then test
+	echo /usr/bin readonly awk echo
+	test | awk printf x=1 $(pwd) printf
+	-eu awk && "$@" 'quoted text' echo echo cd test && echo
+		'quoted text' echo 'quoted text' local
+		cd grep grep grep cd | cd awk --verbose && --verbose 'quoted text' sed sed
+	printf -eu grep cd then done awk then 2>/dev/null
+	/usr/bin local ${HOME} local | 2>/dev/null test && done x=1
+	printf ${HOME} "$1" --verbose then test export printf "$@" then -eu readonly ${HOME}
+	export x=1 readonly echo awk
+		--verbose export export "$1" 'quoted text' "$1" readonly
+	echo x=1 done --verbose "$@" && --verbose $(pwd) | local 'quoted text'
+	cd grep 'quoted text' 'quoted text' readonly && local echo test | readonly done
+test export cd ${HOME} cd $(pwd) "$1" grep sed done -eu 2>/dev/null
+	x=1 x=1 $(pwd) sed ${HOME} --verbose test export $(pwd)
+		export ${HOME} $(pwd) ${HOME} readonly
+	"$1" --verbose -eu awk printf printf echo "$1" x=1
+		"$@" /usr/bin "$@" readonly 2>/dev/null cd
+	sed && awk local cd echo printf 'quoted text' --verbose sed -eu cd /usr/bin
+"$1" then readonly "$@" -eu 2>/dev/null then printf $(pwd) /usr/bin
+	$(pwd) -eu echo ${HOME} && -eu ${HOME} cd echo ${HOME} readonly
+	${HOME} test $(pwd) 2>/dev/null test printf readonly test 'quoted text' 2>/dev/null
+done $(pwd) local "$1" /usr/bin export sed
+	"$1" x=1 done x=1 test | local grep && cd grep
+		--verbose && cd $(pwd) |
+'quoted text' then readonly grep ${HOME} "$@" done x=1 test "$@" sed 2>/dev/null
+		/usr/bin $(pwd) --verbose "$1" ${HOME}
+	awk then "$1" sed local | cd && $(pwd) --verbose printf
+		'quoted text' readonly sed && local readonly
+		awk awk cd grep test /usr/bin x=1 printf --verbose printf 2>/dev/null export
+echo sed then "$1" 'quoted text' printf && $(pwd) && readonly awk done
+	echo cd local -eu awk test -eu 2>/dev/null "$1"
+	2>/dev/null 'quoted text' $(pwd)
+		then 2>/dev/null echo cd readonly cd ${HOME} | then printf echo
+		done grep echo 2>/dev/null "$1"
+awk cd awk /usr/bin cd
+readonly -eu test then /usr/bin echo && --verbose && local "$1" 'quoted text'
+test sed readonly local $(pwd) "$@" 'quoted text'
+	grep awk && echo cd grep then local grep 'quoted text'
+| done sed test local x=1 /usr/bin
+x=1 awk "$@" printf -eu x=1 printf done local 2>/dev/null cd ${HOME}
+		done -eu x=1 readonly sed awk x=1 'quoted text'
+		printf 'quoted text' -eu ${HOME}
+&& then "$1" 'quoted text' then /usr/bin then echo x=1
+	"$1" test grep echo then sed x=1 printf --verbose test export 'quoted text'
+	done 2>/dev/null && cd -eu "$@" "$1" awk then x=1
+2>/dev/null $(pwd) 2>/dev/null -eu $(pwd) local $(pwd) --verbose printf export cd
+	then echo then cd local $(pwd) "$1" $(pwd) -eu printf | 'quoted text' test 2>/dev/null
+	&& --verbose then "$1" echo x=1 awk printf printf cd local /usr/bin
+printf --verbose | awk readonly /usr/bin test done $(pwd) 'quoted text' done
+		local cd done $(pwd) -eu $(pwd) 'quoted text'
+		local | "$@" /usr/bin && ${HOME} done /usr/bin
+		${HOME} "$@" $(pwd) "$@" x=1 cd
+	sed ${HOME} $(pwd) ${HOME} $(pwd) sed
+		test x=1 'quoted text' awk echo $(pwd) then 'quoted text'
+	sed $(pwd) $(pwd) sed | && then readonly 'quoted text'
+	| echo readonly /usr/bin | 2>/dev/null
+		awk printf && grep | readonly sed readonly "$1" test then $(pwd)
+		readonly --verbose test 'quoted text'
+	${HOME} local export 2>/dev/null
+'quoted text' 'quoted text' ${HOME} --verbose && printf | && export 2>/dev/null
+	"$1" --verbose echo test sed sed ${HOME} test ${HOME} done
+--verbose awk test cd 'quoted text'
+-eu -eu done sed readonly awk | echo printf $(pwd) export
+	${HOME} cd grep sed | | test readonly cd done x=1 /usr/bin && "$@" test 2>/dev/null
+x=1 "$@" echo readonly x=1 export && /usr/bin /usr/bin echo then
+echo echo && -eu 'quoted text' export | awk printf /usr/bin /usr/bin
+	grep readonly local -eu cd "$@" sed done
+	done && awk x=1 echo grep sed
+${HOME} --verbose export "$@" "$@" -eu done export
+	"$1" awk readonly "$@" local && -eu cd awk --verbose $(pwd) $(pwd) --verbose
+-eu done sed test "$1" | $(pwd) printf echo echo "$@"
+		/usr/bin $(pwd) printf 2>/dev/null
+export ${HOME} && awk x=1 readonly 2>/dev/null
+		sed 'quoted text' -eu done test grep $(pwd) export $(pwd) test
+then $(pwd) | "$@" $(pwd) 'quoted text'
+	${HOME} -eu export x=1 sed printf "$@"
+		"$@" sed sed test readonly | echo test cd grep awk 2>/dev/null
+'quoted text' && local --verbose printf
+done cd then grep --verbose then && "$@" test grep done -eu export echo 'quoted text'
+then /usr/bin local "$1" "$@" sed cd readonly | then cd x=1 local then $(pwd)
+	'quoted text' "$@" grep done && local | printf
+/usr/bin x=1 readonly sed awk local printf "$@"
+		done cd $(pwd) done readonly $(pwd) then x=1 && done awk && "$1" readonly x=1
+	cd && ${HOME} x=1 "$@" x=1 x=1 done --verbose grep /usr/bin local | -eu 2>/dev/null
+		readonly printf | "$1" grep echo echo test sed --verbose awk printf
+		x=1 readonly 2>/dev/null grep
+		$(pwd) $(pwd) /usr/bin $(pwd) x=1 "$@" $(pwd) local
+	done | grep x=1 sed --verbose | cd grep "$1" /usr/bin done
+"$1" | done export ${HOME} --verbose
+		cd test | cd -eu local local | echo printf local
+	| done 2>/dev/null ${HOME} sed $(pwd) echo "$1" then
+		test echo $(pwd) readonly test "$1" grep grep printf --verbose "$1" test
+	/usr/bin cd echo export grep --verbose
+	grep -eu grep echo cd readonly grep | then then printf 'quoted text'
+		done | "$@" test export awk 2>/dev/null -eu
+	2>/dev/null local grep export readonly
+local awk ${HOME} && ${HOME} x=1 --verbose test echo local && "$@"
+--verbose test then test local readonly $(pwd) ${HOME}
+sed | test export /usr/bin awk sed local test --verbose
+	echo --verbose readonly -eu -eu printf sed && | local 2>/dev/null
+		2>/dev/null readonly readonly echo sed | printf
+		${HOME} $(pwd) grep 'quoted text'
+export cd test 2>/dev/null 'quoted text' 2>/dev/null grep "$@" awk /usr/bin cd
+		/usr/bin /usr/bin "$@" ${HOME}
+	-eu awk readonly sed local "$1" 'quoted text' ${HOME} 2>/dev/null x=1 test
+		export cd awk test 2>/dev/null readonly "$1" | | x=1 local export export
+		$(pwd) "$1" && && readonly grep test x=1
+		| sed local readonly echo 'quoted text' test export "$1" | readonly
+/usr/bin grep echo -eu "$1" echo x=1
+		--verbose grep then printf grep
+${HOME} ${HOME} "$@" x=1 "$@" "$@" ${HOME} && 2>/dev/null sed sed /usr/bin done
+local --verbose /usr/bin -eu "$@" $(pwd)
+x=1 then test "$@" -eu
+	"$1" | grep echo printf $(pwd) ${HOME} awk 'quoted text' | | echo readonly
+	"$1" 2>/dev/null printf
+	done ${HOME} $(pwd) readonly echo local
+local $(pwd) done 2>/dev/null test grep printf grep awk /usr/bin sed 2>/dev/null
+"$@" ${HOME} -eu x=1 cd sed && local awk /usr/bin "$@" sed local
+grep test local 'quoted text' $(pwd) | 2>/dev/null && then /usr/bin grep -eu ${HOME}
+	"$1" 'quoted text' && cd cd $(pwd) /usr/bin --verbose "$@" 'quoted text'
+	then printf echo 'quoted text' | done x=1 cd --verbose
+grep cd cd grep $(pwd) test done
+--verbose done printf /usr/bin readonly "$@" then local cd "$1" cd readonly
+grep grep cd test readonly x=1 echo
+		$(pwd) awk printf x=1
+	"$1" grep | readonly | echo
+2>/dev/null ${HOME} ${HOME} test local test && echo done | ${HOME} then && "$@"
+local | -eu 2>/dev/null printf && && --verbose /usr/bin x=1 2>/dev/null sed 2>/dev/null
+		test cd test /usr/bin ${HOME}
+	x=1 printf x=1 /usr/bin local $(pwd) /usr/bin && then done $(pwd)
+		grep export && cd test echo test "$@" -eu -eu export sed then local ${HOME}
+	export grep "$@" /usr/bin ${HOME} local $(pwd) grep "$@" 2>/dev/null "$@"
+	/usr/bin "$@" $(pwd) done grep "$1" ${HOME} awk local --verbose && && -eu
+sed 'quoted text' awk 2>/dev/null readonly
+		${HOME} grep && echo done sed awk && sed ${HOME} 'quoted text'
+	$(pwd) printf local | $(pwd) echo
+		cd awk awk $(pwd) 'quoted text' $(pwd)
+	grep awk 2>/dev/null | --verbose readonly ${HOME}
+| 'quoted text' then grep 2>/dev/null then && printf && awk cd "$@" -eu
+		$(pwd) -eu /usr/bin /usr/bin done 2>/dev/null && "$@"
+"$1" then "$@" && export /usr/bin then && "$@" /usr/bin /usr/bin awk
+	readonly cd 2>/dev/null -eu $(pwd) "$1" "$1" && sed sed cd | --verbose
+printf then local ${HOME} x=1
+		grep sed --verbose printf | && local ${HOME} export
+test done then 'quoted text' sed then $(pwd) awk sed test awk grep --verbose
+echo -eu export 'quoted text' 'quoted text' echo 'quoted text' /usr/bin x=1 cd
+		local x=1 | && local | local grep | &&
+		| readonly ${HOME} 2>/dev/null then
+x=1 /usr/bin printf export export readonly cd done x=1 readonly
+${HOME} local echo export export
+		--verbose ${HOME} grep 2>/dev/null
+	local /usr/bin ${HOME} then | $(pwd)
+		"$1" x=1 printf done sed then /usr/bin && test echo ${HOME} "$1" test local local
+		local test $(pwd) -eu test echo ${HOME} "$1" printf "$@" awk "$@" export --verbose
+	/usr/bin $(pwd) awk then then 2>/dev/null
+	--verbose --verbose export then awk 2>/dev/null cd local
+${HOME} x=1 export $(pwd) x=1 printf "$1" test export test -eu 2>/dev/null
+test test --verbose | test "$1" readonly echo "$1" 'quoted text'
+	local $(pwd) grep grep ${HOME}
+	awk done /usr/bin -eu
+x=1 grep done /usr/bin 'quoted text' /usr/bin readonly local cd sed --verbose
+-eu export ${HOME} 2>/dev/null awk echo
+readonly /usr/bin awk $(pwd) sed x=1 x=1
+then done | "$@" export local 2>/dev/null cd "$1" "$@" "$1" test local sed $(pwd)
+grep done sed 'quoted text' local printf echo grep
+test x=1 export readonly ${HOME} $(pwd) local export -eu "$@" 2>/dev/null "$@"
+	done /usr/bin readonly local readonly printf local sed awk
+		${HOME} 2>/dev/null awk 'quoted text' readonly 2>/dev/null
+		echo local ${HOME} printf -eu | "$@" "$@" test sed "$@" test done /usr/bin
+&& done cd 'quoted text' echo printf grep && sed --verbose ${HOME}
+$(pwd) export done /usr/bin | readonly "$1" done /usr/bin && 'quoted text'
+		awk x=1 ${HOME} -eu x=1 cd printf grep "$@" "$@" && grep -eu local /usr/bin
+readonly --verbose then readonly cd "$@" && $(pwd) -eu sed 2>/dev/null
+	&& local 2>/dev/null "$1" 'quoted text' --verbose
+test 'quoted text' && done grep x=1 awk "$@" ${HOME} | "$@" then echo done x=1
+2>/dev/null local sed $(pwd)
+"$@" echo $(pwd) ${HOME} printf 2>/dev/null done readonly
+		$(pwd) 2>/dev/null && "$1" $(pwd) 2>/dev/null
+echo "$@" cd done done then sed sed --verbose ${HOME}
+	2>/dev/null -eu --verbose then -eu printf printf done /usr/bin test ${HOME}
+printf /usr/bin echo -eu x=1 local sed "$1" done "$@" sed
+	/usr/bin cd local --verbose sed "$@" --verbose --verbose 'quoted text' echo
+		grep 'quoted text' 2>/dev/null $(pwd) && "$@" | readonly
+		${HOME} ${HOME} $(pwd) export 2>/dev/null | --verbose 'quoted text' /usr/bin
+	test sed "$1" 2>/dev/null
+test cd local && then 2>/dev/null local 2>/dev/null
+	cd readonly /usr/bin -eu && local echo export ${HOME} -eu then --verbose echo
+	echo export then test --verbose -eu awk -eu "$1" printf && /usr/bin
+awk ${HOME} && --verbose /usr/bin /usr/bin ${HOME} 2>/dev/null grep
+	/usr/bin x=1 then readonly --verbose -eu printf 2>/dev/null
+		${HOME} ${HOME} -eu && awk
+	${HOME} sed grep done x=1
+	echo printf readonly | "$@" | x=1 "$@" ${HOME} "$1" | --verbose
+		-eu "$1" cd "$@" awk cd printf && awk test awk && local cd then
+"$1" && "$1" $(pwd) 'quoted text' /usr/bin cd printf echo sed x=1
+		export cd 'quoted text' awk $(pwd) grep /usr/bin local /usr/bin
+"$1" /usr/bin /usr/bin export && "$@" && echo export
+		--verbose --verbose grep &&
+		local readonly $(pwd)
+"$@" test $(pwd) printf awk cd echo
+grep ${HOME} local cd then done test ${HOME} then 2>/dev/null && test x=1 sed
+	"$1" -eu local local
+		awk --verbose | done x=1 then sed | awk export sed 'quoted text'
+	&& test done grep $(pwd) local printf grep
+		"$1" cd sed $(pwd) sed echo test /usr/bin 2>/dev/null sed local
+	'quoted text' awk | grep echo
+	/usr/bin awk $(pwd) /usr/bin x=1 -eu export done 2>/dev/null
+test then && cd cd "$1" "$@" done
+| 'quoted text' && cd 2>/dev/null
+printf then 2>/dev/null "$@" | printf done 2>/dev/null awk test
+x=1 echo 'quoted text' 'quoted text'
+	2>/dev/null 'quoted text' local /usr/bin ${HOME} | "$1"
+		--verbose ${HOME} echo then echo
+	test "$1" && cd $(pwd) --verbose $(pwd)
+	local /usr/bin | cd local
+/usr/bin "$1" /usr/bin "$1" echo then $(pwd) 'quoted text'
+	x=1 x=1 $(pwd) sed printf readonly "$@" && 'quoted text' sed test
+then && /usr/bin readonly
+	&& done grep 2>/dev/null "$@" then grep "$@" test export
+		x=1 awk | printf readonly "$1" then awk "$1"
+readonly | && -eu cd && then echo -eu
+	/usr/bin printf | cd --verbose then cd && -eu export awk awk readonly &&
+		$(pwd) awk && -eu then awk 'quoted text'
+--verbose $(pwd) $(pwd) sed "$1" then ${HOME} && $(pwd)
+	then x=1 $(pwd) test "$@" printf echo local cd "$@" echo echo
+	'quoted text' grep -eu 'quoted text' ${HOME} x=1 'quoted text' "$@" sed /usr/bin
+	"$@" | $(pwd) $(pwd) export /usr/bin -eu printf 'quoted text' 'quoted text'
+	sed printf && -eu readonly sed 'quoted text' test | -eu
+/usr/bin awk awk --verbose grep done readonly $(pwd) -eu "$@" -eu x=1
+		sed printf /usr/bin ${HOME} -eu
+		printf awk "$@" local -eu cd
+	cd x=1 "$@" local /usr/bin
+	cd -eu then echo 'quoted text' cd /usr/bin then 2>/dev/null 2>/dev/null
+	| readonly grep printf -eu
+	"$1" done readonly ${HOME} local awk local local $(pwd) /usr/bin "$@"
+		"$1" "$@" 'quoted text' sed "$1" then "$1" 'quoted text' test readonly echo
+		cd | $(pwd) export /usr/bin "$1" done $(pwd)
+		readonly $(pwd) 2>/dev/null grep
+		-eu x=1 printf done then | awk cd "$@" "$1" /usr/bin export --verbose grep cd
+		test export local grep 'quoted text' export 2>/dev/null readonly | cd 2>/dev/null
+		sed "$@" && ${HOME} local 2>/dev/null
+	'quoted text' "$@" local printf then $(pwd) grep /usr/bin
+	cd local 'quoted text' sed done x=1 awk printf
+		grep $(pwd) /usr/bin --verbose
+/usr/bin 'quoted text' && 'quoted text' grep test test 'quoted text' readonly
+		"$1" grep 'quoted text' then awk test | && local readonly x=1 local
+	sed "$@" x=1 $(pwd) test /usr/bin test "$1" done 'quoted text'
+x=1 export then $(pwd) 'quoted text' awk grep "$1" $(pwd) cd awk grep echo
+	export | then && x=1 echo x=1 then grep "$@" && $(pwd) $(pwd) /usr/bin
+	grep -eu -eu "$@" x=1 cd test test printf cd "$1" 'quoted text' readonly
+	--verbose cd -eu printf --verbose then readonly echo /usr/bin 2>/dev/null x=1
+	| /usr/bin 2>/dev/null sed grep cd cd $(pwd) echo grep
+	| x=1 export && "$1" "$1" "$@" -eu | "$@" sed | local $(pwd) printf done local 2>/dev/null
+		${HOME} 'quoted text' done 'quoted text'
+	/usr/bin "$@" "$@" | 2>/dev/null 'quoted text' "$@" -eu then readonly
+	readonly readonly | /usr/bin "$@" readonly test "$1" x=1 printf echo
+		--verbose x=1 done then local --verbose printf $(pwd) local 2>/dev/null
+		awk -eu 2>/dev/null $(pwd) x=1 test sed done echo test sed "$1"
+	--verbose /usr/bin echo local awk /usr/bin export 2>/dev/null
+		"$1" | && readonly | test /usr/bin --verbose local then 'quoted text'
+echo sed 'quoted text' && awk readonly
+export --verbose test | -eu test sed awk | local export
+	'quoted text' local "$1"
+	${HOME} done local printf cd printf 2>/dev/null -eu echo 2>/dev/null
+	sed x=1 export local -eu --verbose cd "$@" "$1" then printf echo grep
+${HOME} test readonly done then sed readonly /usr/bin -eu printf readonly
+	--verbose cd printf 2>/dev/null printf 2>/dev/null test | ${HOME} sed "$@"
+	sed $(pwd) awk grep 'quoted text'
+test sed | test "$1" x=1 printf $(pwd) x=1 "$@" ${HOME} --verbose /usr/bin
+		local "$1" echo 'quoted text' && /usr/bin
+		| cd sed done $(pwd) "$@" --verbose "$1" awk 'quoted text'
+	x=1 then 'quoted text' x=1 "$1" "$1" -eu "$1"
+		printf 2>/dev/null x=1 test
+		sed test 'quoted text' then /usr/bin /usr/bin
+	readonly cd test printf sed then test | $(pwd) | --verbose ${HOME} -eu
+		$(pwd) export export "$@" x=1 'quoted text' export
+		readonly "$1" 'quoted text' local local grep then && /usr/bin
+&& $(pwd) done sed ${HOME} readonly local cd /usr/bin x=1 grep
+then awk readonly test --verbose test echo
+--verbose export 'quoted text' cd awk echo printf -eu "$@" && 2>/dev/null /usr/bin
+local grep "$@" /usr/bin ${HOME} echo grep
+"$@" printf 2>/dev/null export local -eu ${HOME} ${HOME} sed --verbose readonly
+export && $(pwd) --verbose "$1" 'quoted text' 'quoted text' grep $(pwd) -eu sed
+readonly ${HOME} x=1 cd awk | echo --verbose "$@" /usr/bin
+	readonly done done ${HOME} local -eu cd printf echo readonly
+--verbose && x=1 /usr/bin
+	/usr/bin sed done --verbose printf
+	then sed then --verbose ${HOME}
+	-eu local awk && 2>/dev/null "$1" grep $(pwd) echo "$@"
+--verbose sed readonly "$@" -eu grep 2>/dev/null "$1" x=1 grep test grep
+$(pwd) --verbose x=1 "$1" awk "$@" && --verbose
+		echo export -eu && | /usr/bin && --verbose local readonly "$1"
+grep then | x=1 done local "$1" export test then
+	test --verbose local | readonly awk
+	"$1" export test sed local printf export
+grep | then x=1 done ${HOME} "$1" --verbose
+	awk done && --verbose && --verbose 2>/dev/null -eu
+		local cd -eu $(pwd) 2>/dev/null grep echo awk cd grep local --verbose export
+		-eu 'quoted text' x=1 $(pwd) done printf export
+		printf export export 2>/dev/null
+		awk export done $(pwd) grep awk 2>/dev/null grep x=1 "$1" --verbose
+	--verbose local echo && --verbose x=1 test sed local
+2>/dev/null then then export export ${HOME} ${HOME} -eu export
+cd "$1" --verbose done grep /usr/bin done $(pwd) 2>/dev/null then ${HOME}
+x=1 && ${HOME} ${HOME} cd done 'quoted text' --verbose echo cd /usr/bin
+		&& local export "$@" done ${HOME} local "$@" done sed awk cd 2>/dev/null
+test "$@" done ${HOME} 2>/dev/null "$1" -eu --verbose then echo
+"$1" local export -eu local sed "$1" x=1 local | x=1 "$1" echo
+	"$@" x=1 "$@" --verbose local && awk printf sed 2>/dev/null "$@" x=1 export
+		"$1" | "$@" test readonly cd readonly cd local --verbose
+	x=1 | ${HOME} | done --verbose | echo local | done cd $(pwd) "$@"
+${HOME} grep 2>/dev/null $(pwd) echo ${HOME} printf $(pwd) $(pwd)
+		-eu readonly --verbose sed echo
+grep printf local 'quoted text' test "$1" x=1 export export --verbose cd readonly
+printf "$1" cd && "$@" "$@" local 2>/dev/null 2>/dev/null test printf
+	local test then test 'quoted text' "$@" --verbose ${HOME} "$1" ${HOME} /usr/bin
+		grep export x=1 local 2>/dev/null | readonly "$1" local grep
+		2>/dev/null test /usr/bin "$1"
+		cd cd sed awk awk && sed -eu --verbose awk /usr/bin --verbose done "$1"
+	grep 2>/dev/null --verbose $(pwd) grep "$@" /usr/bin --verbose
+	${HOME} printf printf echo /usr/bin ${HOME}
+'quoted text' cd /usr/bin -eu readonly
+	$(pwd) "$1" cd 'quoted text'
+	readonly cd done x=1 -eu then cd sed /usr/bin sed | readonly
+test 'quoted text' 2>/dev/null printf
+echo test then echo done
+	local && sed /usr/bin test x=1
+	grep grep $(pwd) x=1 sed local /usr/bin $(pwd) 'quoted text' test
+	&& /usr/bin awk then done cd ${HOME} 'quoted text' --verbose then | -eu
+-eu /usr/bin -eu ${HOME} readonly readonly test done done local --verbose
+	export printf "$@" echo x=1 "$@" grep "$@" 'quoted text' sed local readonly
+		"$1" -eu && --verbose "$1" | x=1 local && /usr/bin awk echo
+	"$1" echo | x=1 && /usr/bin $(pwd) 'quoted text' "$1" grep
+done grep echo $(pwd) cd echo
+	test cd done | && --verbose cd
+/usr/bin | --verbose cd 'quoted text' local $(pwd) then echo $(pwd) test export
+		x=1 ${HOME} 2>/dev/null --verbose echo --verbose sed 'quoted text'
+		export cd 'quoted text' cd then x=1 | -eu --verbose
+		--verbose export done && && echo ${HOME} grep sed
+	"$1" /usr/bin "$@" echo
+	readonly cd export awk -eu done && "$1" --verbose local export x=1 ${HOME}
+		'quoted text' | local export ${HOME}
+		x=1 echo test sed | cd export awk export
+/usr/bin echo cd test done 'quoted text' cd && sed grep
+		done -eu ${HOME} echo readonly
+printf --verbose done "$1"
+	echo 'quoted text' 2>/dev/null export && ${HOME} test
+		export done && "$@" grep echo export ${HOME}
+echo echo 2>/dev/null -eu printf "$1" /usr/bin /usr/bin
+	local local printf && "$@" export && && "$1" sed done
+	echo export 2>/dev/null "$1" readonly "$@" --verbose && sed
+		then $(pwd) | | ${HOME} done
+sed "$@" then cd sed export
+		${HOME} -eu $(pwd) x=1 2>/dev/null then /usr/bin -eu done
+grep grep "$1" $(pwd) export then x=1 -eu then printf printf &&
+echo /usr/bin -eu grep test && readonly echo export ${HOME}
+then 2>/dev/null -eu export ${HOME} | echo test sed "$1" grep "$1" 2>/dev/null
+		grep 'quoted text' printf --verbose cd "$1" then
+	echo grep -eu printf cd --verbose cd -eu sed
+		sed /usr/bin test sed test "$1" readonly $(pwd) "$1" 2>/dev/null && then then
+		export test done | grep && "$@" $(pwd) /usr/bin 'quoted text' x=1 done cd grep
+		-eu && then readonly --verbose && -eu done
+--verbose ${HOME} readonly
+"$@" -eu "$@" cd --verbose test readonly ${HOME} awk | awk | $(pwd) local
+done done | test readonly /usr/bin 'quoted text'
+	--verbose sed readonly 2>/dev/null
+		-eu test grep local awk test ${HOME} $(pwd) readonly readonly && awk awk && "$@"
+local /usr/bin /usr/bin x=1 readonly $(pwd)
+		local local --verbose readonly /usr/bin 2>/dev/null $(pwd) "$1"
+		sed grep printf awk export | x=1 'quoted text' awk done | "$1"
+	local readonly then 'quoted text' | done sed 'quoted text'
+		2>/dev/null | grep printf --verbose $(pwd) done && printf cd
+-eu && $(pwd) test printf cd sed test grep printf
+-eu cd export 2>/dev/null readonly | x=1 printf && && 2>/dev/null "$@" echo
+		grep "$@" printf grep | "$@" 'quoted text'
+cd printf then local readonly awk test printf local export -eu /usr/bin
+	awk awk && export sed -eu readonly
+		'quoted text' x=1 then x=1 -eu
+		-eu cd ${HOME} | sed ${HOME} --verbose awk ${HOME} ${HOME} && then | then
+	grep echo sed echo awk && cd 'quoted text' "$1" export then /usr/bin
+	-eu "$@" 2>/dev/null printf $(pwd) | ${HOME} 2>/dev/null -eu "$@" 2>/dev/null
+&& && done awk test printf printf
+	${HOME} cd /usr/bin | grep test ${HOME} "$@" then
+		--verbose $(pwd) 'quoted text' cd echo test grep 2>/dev/null echo awk
+		/usr/bin "$@" $(pwd) $(pwd) /usr/bin readonly x=1 echo export | awk awk local
+	printf cd test readonly test then cd "$@" $(pwd) awk "$1"
+	local $(pwd) local && echo sed ${HOME} readonly /usr/bin ${HOME} x=1 "$@" printf
+		${HOME} grep local test then x=1 done && export $(pwd) done x=1 done printf 'quoted text'
+cd printf "$1" test echo
+		--verbose awk "$@" printf "$@" done && | sed ${HOME}
+	"$@" then printf 2>/dev/null
+#include c131.sh
+		$(pwd) export then echo grep && readonly /usr/bin
+		/usr/bin then echo 2>/dev/null printf echo sed "$1" sed cd export test test
+'quoted text' test "$@" | awk echo | then $(pwd) $(pwd)
+	printf export local "$@" then $(pwd) && export readonly readonly printf
+"$@" 'quoted text' -eu sed "$1" && 2>/dev/null ${HOME} readonly
+		grep printf /usr/bin readonly echo cd awk grep echo && /usr/bin
+export printf test -eu | local | test export test
+-eu $(pwd) | grep grep "$@" -eu sed local --verbose
+	x=1 && -eu grep | && "$@" readonly
+	/usr/bin test done 'quoted text'
+${HOME} /usr/bin echo $(pwd) done
+		export local $(pwd) |
+	2>/dev/null local readonly
+| 2>/dev/null "$@" awk && -eu
+	-eu x=1 echo -eu && cd --verbose ${HOME} "$1" export x=1 ${HOME} "$1" -eu
+		2>/dev/null x=1 echo x=1 cd ${HOME} --verbose
+'quoted text' && -eu --verbose "$@"
+	| --verbose local 2>/dev/null
+		done echo | done -eu local 2>/dev/null echo | /usr/bin then grep local 2>/dev/null
+	"$1" 'quoted text' test x=1 "$1" export export --verbose "$1" ${HOME} 2>/dev/null
+		grep local printf /usr/bin
+	"$1" awk grep ${HOME} export then local export readonly readonly
+		grep /usr/bin printf cd then awk
+grep 2>/dev/null /usr/bin x=1 readonly cd && 'quoted text'
+	printf grep "$1" | printf "$1" && awk then
+--verbose 'quoted text' test grep done readonly done done readonly ${HOME}
+	local echo /usr/bin "$@" cd -eu
+awk "$@" ${HOME} -eu local echo
+--verbose "$@" sed x=1 then cd x=1 "$@" $(pwd) sed 2>/dev/null --verbose /usr/bin
+	local echo local printf /usr/bin x=1 &&
+		test | "$@" echo then 2>/dev/null echo x=1 export printf --verbose "$1"
+		&& cd awk echo local export
+	-eu readonly $(pwd) awk -eu
+		"$1" ${HOME} export -eu 2>/dev/null x=1 then x=1 --verbose echo 2>/dev/null
+/usr/bin ${HOME} done x=1 cd test x=1 $(pwd) export sed done cd cd ${HOME} $(pwd)
+		--verbose "$1" grep && x=1 /usr/bin then
+		readonly test -eu done done export "$@" ${HOME} then ${HOME} $(pwd)
+	cd | readonly cd local local cd
+echo grep sed sed sed ${HOME} test -eu done test
+	readonly readonly | done awk /usr/bin
+export then printf && /usr/bin ${HOME} $(pwd)
+	echo ${HOME} "$@" "$@" /usr/bin cd export
+	-eu 'quoted text' echo cd --verbose /usr/bin -eu done ${HOME} --verbose
+		printf $(pwd) local 'quoted text'
+/usr/bin --verbose local -eu 2>/dev/null 'quoted text' "$1" export
+	--verbose x=1 local awk test cd -eu
+echo "$@" "$@" echo awk | ${HOME} /usr/bin awk
+	grep awk "$1" $(pwd) test printf
+		| ${HOME} --verbose awk export $(pwd) awk 2>/dev/null then
+		/usr/bin --verbose grep "$@" | grep grep "$@" "$1" --verbose cd export
+		printf test sed 2>/dev/null 'quoted text' x=1 then echo 'quoted text' test local
+	readonly "$1" grep echo | 'quoted text' 2>/dev/null sed local export echo export
+	/usr/bin local && --verbose local test 'quoted text'
+--verbose sed done grep echo "$@" | sed
+printf 'quoted text' cd
+		done --verbose "$@" $(pwd) done ${HOME} echo | echo sed --verbose done /usr/bin
+		readonly local | "$1" $(pwd) "$1" --verbose && readonly && export printf
+x=1 "$1" cd "$@" echo echo --verbose then awk done printf export local
+		grep | awk 2>/dev/null awk echo
+then 'quoted text' echo
+2>/dev/null sed readonly local readonly awk 2>/dev/null grep test
+		readonly | export $(pwd) /usr/bin ${HOME}
+		export -eu printf "$@" grep 'quoted text' "$@" -eu 2>/dev/null $(pwd) awk test
+		x=1 then printf ${HOME} export x=1 $(pwd) && "$1" | cd
+	awk test "$@" local ${HOME} printf /usr/bin 2>/dev/null &&
+	done -eu export test 'quoted text' grep echo "$@"
+readonly awk "$@" grep readonly printf 'quoted text'
+	${HOME} done readonly export awk 2>/dev/null $(pwd) -eu
+		done test x=1 'quoted text'
+		printf "$1" $(pwd) ${HOME} /usr/bin
+	then done && readonly awk "$@" grep done awk | awk 'quoted text'
+"$1" 2>/dev/null local readonly
+2>/dev/null | done test ${HOME} then /usr/bin
+	test 2>/dev/null /usr/bin then "$1" readonly /usr/bin | 'quoted text'
+		sed "$@" $(pwd) local test cd test readonly /usr/bin sed awk echo grep
+"$1" -eu cd | local -eu test done x=1 -eu && $(pwd) local "$@" $(pwd) cd done
+		done then export cd | printf | $(pwd) sed readonly --verbose
+	test cd -eu test --verbose test printf awk x=1 $(pwd) echo cd "$1"
+| "$@" cd test | -eu && test local then "$1" then sed /usr/bin grep grep export
+		&& 2>/dev/null grep "$1" "$@" x=1 /usr/bin then then | local ${HOME}
+then sed sed local | -eu "$1" $(pwd) $(pwd) && done
+done "$@" cd /usr/bin then x=1 2>/dev/null export -eu awk done 2>/dev/null
+/usr/bin test $(pwd) cd test
+	done 'quoted text' done 'quoted text' readonly readonly
+		printf grep -eu printf && && grep ${HOME} awk | echo
+	/usr/bin readonly printf /usr/bin done --verbose then
+		x=1 sed echo printf x=1 x=1 /usr/bin -eu 2>/dev/null export -eu cd readonly 2>/dev/null
+"$@" && printf awk echo x=1 done x=1 $(pwd) -eu printf ${HOME}
+grep x=1 ${HOME} 'quoted text' then ${HOME} /usr/bin
+		$(pwd) --verbose /usr/bin $(pwd) readonly ${HOME} ${HOME} && x=1
+	export test echo export
+		awk -eu && ${HOME} then /usr/bin 2>/dev/null "$@" echo 2>/dev/null
+cd x=1 export test ${HOME}
+		| && sed --verbose printf x=1 awk export /usr/bin then
+grep then && 2>/dev/null awk local test $(pwd) 2>/dev/null sed cd x=1 -eu x=1
+	sed 'quoted text' printf | then | "$@"
+		done awk printf cd "$1" "$1" readonly /usr/bin
+-eu /usr/bin then "$1" sed cd
+	x=1 --verbose | then /usr/bin local readonly
+	readonly /usr/bin ${HOME} cd readonly test x=1 ${HOME} x=1 grep
+		echo export -eu then x=1
+		then echo "$@" 'quoted text' 'quoted text' /usr/bin
+	grep awk --verbose && --verbose echo 'quoted text'
+		test && $(pwd) $(pwd) $(pwd) readonly
+		printf echo test echo printf "$1"
+	sed -eu -eu $(pwd) | cd done awk done echo sed then
+		"$1" ${HOME} cd | ${HOME} local readonly x=1 |
+		&& --verbose readonly test && local $(pwd) 2>/dev/null
+		cd -eu export 'quoted text' "$@" grep test echo "$@" done done 2>/dev/null local
+	"$@" then 'quoted text' 2>/dev/null
+	'quoted text' /usr/bin
+		${HOME} printf export /usr/bin $(pwd) local "$@" local readonly | test
+grep --verbose done readonly
+		grep printf $(pwd) export export 'quoted text'
+	echo readonly then cd | readonly /usr/bin test ${HOME}
+		awk echo grep ${HOME} echo "$@" readonly 'quoted text' --verbose
+x=1 sed 'quoted text' 'quoted text'
+done 2>/dev/null | | done grep grep
+$(pwd) 2>/dev/null export "$1" grep 2>/dev/null then done "$@" awk x=1 done printf
+	"$1" sed then 'quoted text' awk then
+x=1 && readonly "$@" && -eu test 'quoted text' local grep
+		2>/dev/null x=1 "$1" -eu | readonly x=1
+/usr/bin /usr/bin grep $(pwd) then export done echo local -eu 'quoted text' --verbose
+readonly readonly echo readonly | 'quoted text' test awk --verbose
+	/usr/bin && "$@" sed awk cd && grep
+done 2>/dev/null $(pwd) | sed
+	readonly export -eu --verbose then grep local x=1 readonly ${HOME} "$@" ${HOME}
+"$1" sed ${HOME} local | readonly
+	-eu printf local echo export cd ${HOME} x=1 /usr/bin then test
+	x=1 test -eu /usr/bin $(pwd) test local x=1 /usr/bin then
+	cd test && --verbose "$1" 2>/dev/null local export then $(pwd)
+		readonly $(pwd) readonly /usr/bin echo
+		grep sed export cd cd awk --verbose -eu 2>/dev/null grep
+${HOME} grep "$@" done --verbose ${HOME} awk sed "$@" then && $(pwd) $(pwd)
+local awk then cd grep cd printf /usr/bin test local cd awk --verbose
+	&& awk -eu $(pwd) done $(pwd) -eu x=1 && echo x=1 printf 'quoted text' 'quoted text'
+		readonly grep echo $(pwd) sed export cd 'quoted text'
+-eu && x=1 2>/dev/null echo --verbose $(pwd) 2>/dev/null && ${HOME} x=1
+		$(pwd) x=1 x=1 export local grep /usr/bin readonly echo
+-eu | readonly awk readonly
+	test printf done 2>/dev/null test /usr/bin $(pwd) && | $(pwd) && echo ${HOME}
+"$@" readonly "$1" 2>/dev/null $(pwd) cd
+readonly echo echo then then ${HOME} grep | 2>/dev/null cd 2>/dev/null
+		export "$1" 2>/dev/null
+| && /usr/bin printf | grep --verbose /usr/bin grep echo --verbose
+		$(pwd) x=1 grep cd cd && printf printf /usr/bin -eu /usr/bin | --verbose
+cd local | ${HOME} x=1 2>/dev/null cd readonly -eu
+	printf cd "$1" $(pwd)
+awk -eu --verbose ${HOME} --verbose "$1" x=1 && grep export readonly cd readonly
+	readonly "$@" local | done $(pwd) then sed export export
+		cd grep cd sed "$1" then ${HOME} export test ${HOME} then -eu 2>/dev/null
+'quoted text' done echo sed
+cd printf readonly | ${HOME}
+-eu $(pwd) readonly export "$@" && local sed ${HOME} awk awk then
+	/usr/bin readonly cd printf then /usr/bin export 2>/dev/null
+printf cd echo sed cd done test "$@" --verbose
+readonly echo printf "$@" "$@" done grep "$1" && grep 'quoted text' &&
+		test readonly awk x=1 "$1" local --verbose printf &&
+		${HOME} | -eu 2>/dev/null
+		sed "$1" --verbose export done cd /usr/bin /usr/bin grep /usr/bin ${HOME}
+		cd x=1 awk echo $(pwd) -eu "$1" -eu /usr/bin --verbose "$1" readonly
+		'quoted text' --verbose --verbose "$@" 2>/dev/null
+${HOME} readonly $(pwd) $(pwd) ${HOME} echo
+		readonly readonly then x=1 export x=1 x=1 printf | $(pwd) export 'quoted text'
+	&& $(pwd) "$1" readonly && readonly
+done printf awk ${HOME} local ${HOME} export done "$@" cd local /usr/bin done
+		cd /usr/bin && printf test 2>/dev/null $(pwd)
+		awk 'quoted text' echo $(pwd) then awk
+		2>/dev/null "$@" done 2>/dev/null --verbose --verbose x=1 x=1 --verbose
+		echo x=1 --verbose readonly
+		echo x=1 done grep test /usr/bin "$1" x=1
+${HOME} --verbose local test --verbose x=1 $(pwd) grep
+		--verbose grep -eu done echo
+done -eu --verbose printf sed /usr/bin --verbose --verbose
+	2>/dev/null x=1 "$1" then 2>/dev/null
+test 'quoted text' "$1" grep grep $(pwd) --verbose /usr/bin x=1 grep then
+		$(pwd) then echo export test && 2>/dev/null
+	done export /usr/bin then test then
+	awk && sed --verbose local | printf then && ${HOME} echo --verbose export
+/usr/bin export export /usr/bin cd | readonly
+		-eu -eu 'quoted text' sed x=1 sed export -eu export grep local ${HOME}
+		2>/dev/null && done $(pwd) readonly
+		done 'quoted text' "$@" printf test local | done
+grep $(pwd) then test awk cd grep
+	&& "$@" sed sed ${HOME} then | echo | -eu
+		-eu "$1" grep printf test echo -eu done
+/usr/bin then $(pwd) "$1" x=1 sed test --verbose
+--verbose done awk && echo awk -eu x=1 -eu "$@"
+	done awk 2>/dev/null /usr/bin && then echo /usr/bin
+	${HOME} ${HOME} x=1 ${HOME} awk 'quoted text' awk done --verbose
+x=1 sed --verbose 2>/dev/null /usr/bin then 'quoted text'
+		-eu done --verbose then done "$1" echo $(pwd)
+	grep "$@" | grep ${HOME} $(pwd) grep -eu | readonly ${HOME} export $(pwd) x=1
+sed $(pwd) printf $(pwd) "$1" x=1 echo done | awk local then cd --verbose
+	echo readonly 2>/dev/null local test x=1 /usr/bin 2>/dev/null export && grep
+		cd "$1" | x=1 'quoted text'
+	printf /usr/bin "$1" 'quoted text' && && --verbose ${HOME}
+		"$1" "$1" grep awk | -eu
+x=1 grep "$@" readonly sed cd "$@" awk 'quoted text'
+		cd test $(pwd) echo --verbose then export awk
+		2>/dev/null && local sed && 'quoted text' cd 2>/dev/null
+		${HOME} "$@" "$1" | 'quoted text'
+echo "$1" awk 'quoted text'
+		local echo "$1" export echo awk cd readonly sed test done export
+	x=1 ${HOME} export done printf x=1
+		-eu export x=1 cd export x=1 done sed | $(pwd) -eu | awk cd printf /usr/bin done
+"$@" awk cd echo then 'quoted text' printf
+	local $(pwd) 2>/dev/null -eu ${HOME} then then grep export
+	then | test echo 'quoted text' test sed printf test && "$@"
+		${HOME} then --verbose
+cd --verbose | -eu "$1" /usr/bin && |
+		export x=1 cd 'quoted text' "$1" x=1 cd ${HOME} awk 2>/dev/null
+'quoted text' /usr/bin done test then
+2>/dev/null cd && done /usr/bin | && /usr/bin "$@"
+	/usr/bin printf /usr/bin local readonly then /usr/bin "$1" 'quoted text' /usr/bin
+$(pwd) local local cd 'quoted text'
+	awk awk echo -eu test then then
+	${HOME} local test echo readonly 'quoted text' $(pwd) ${HOME} -eu sed &&
+		done printf grep then test readonly local
+	| then $(pwd) sed export ${HOME} sed
+printf printf | done 'quoted text'
+	${HOME} printf 2>/dev/null -eu local then $(pwd) awk | --verbose
+done awk test awk | && then test 2>/dev/null x=1 "$@"
+"$1" -eu /usr/bin --verbose x=1 cd x=1 local && readonly -eu
+&& test sed "$1" && -eu "$@" "$1" "$1" done cd $(pwd) local /usr/bin && $(pwd)
+export "$1" sed --verbose --verbose local echo local
+test -eu "$@" "$@" -eu then
+	&& | -eu echo done ${HOME} 2>/dev/null /usr/bin readonly
+done 'quoted text' printf export ${HOME} "$@" echo test printf
+grep 'quoted text' -eu | local
+	| $(pwd) awk 2>/dev/null then && | echo printf grep done -eu then done printf
+	echo sed readonly readonly
+		/usr/bin done ${HOME} ${HOME} printf grep
+	echo -eu --verbose /usr/bin && printf | x=1 "$@" "$1" | echo
+		/usr/bin done "$@" -eu cd 'quoted text' printf "$@" && | done x=1
+		$(pwd) cd then printf local
+/usr/bin ${HOME} local "$1" --verbose then $(pwd) 2>/dev/null export
+	printf export && x=1 printf then -eu 2>/dev/null
+2>/dev/null 'quoted text'
+	${HOME} /usr/bin ${HOME} --verbose
+2>/dev/null "$@" printf ${HOME} test "$1"
+grep -eu "$1" 2>/dev/null -eu echo grep echo
+done awk then 'quoted text' awk cd ${HOME} awk $(pwd)
+export test done -eu done
+		cd --verbose && done then x=1 $(pwd) "$@" ${HOME} cd 'quoted text'
+readonly test then "$@" export $(pwd) test
+2>/dev/null ${HOME} readonly $(pwd) then ${HOME}
+		&& x=1 cd export awk "$1" --verbose
+	echo -eu -eu 2>/dev/null 'quoted text' /usr/bin echo printf
+		cd grep then done "$@" test | test ${HOME}
+		--verbose awk 'quoted text' --verbose done "$@" local export
+&& 2>/dev/null export done "$1" export done && then then $(pwd) echo --verbose grep
+'quoted text' --verbose
+/usr/bin export local "$@" sed --verbose "$1" 'quoted text' | $(pwd)
+	then echo /usr/bin "$@" 2>/dev/null
+		then | awk x=1 local grep grep $(pwd) echo done
+	--verbose sed | done | done printf $(pwd) | test -eu readonly done
+		echo done | local readonly
+		&& ${HOME} readonly "$1" done | cd cd && done export
+done /usr/bin && "$1" export export sed export local awk | echo
+		x=1 $(pwd) awk then --verbose grep $(pwd) $(pwd) printf printf
+		2>/dev/null && readonly export
+		| -eu then awk awk awk export export ${HOME} then grep grep done local echo
+"$1" echo sed echo | "$@"
+$(pwd) awk cd grep && grep | -eu && "$1" awk grep test
+	done then x=1 'quoted text' cd grep printf -eu cd x=1 readonly
+2>/dev/null /usr/bin "$1" sed
+	printf /usr/bin "$@" printf --verbose x=1 ${HOME}
+	"$1" 'quoted text' x=1 sed export local 2>/dev/null /usr/bin --verbose
+		| "$1" export cd ${HOME} sed echo done sed awk 'quoted text' && test ${HOME} /usr/bin
+grep && "$@" ${HOME} test readonly && $(pwd)
+		2>/dev/null printf --verbose printf sed sed echo -eu 'quoted text' -eu
+/usr/bin 'quoted text' 'quoted text' readonly
+	grep export printf x=1 local -eu 2>/dev/null readonly test cd done && -eu
+	| test cd "$1" awk | 'quoted text' readonly sed $(pwd) "$@" ${HOME} "$1" test readonly
+		'quoted text' /usr/bin export x=1 -eu grep && readonly done done awk echo
+		test "$1" export cd -eu awk
+echo then -eu -eu /usr/bin ${HOME}
+		| done done "$@" local
+| grep done "$1" awk "$1" "$@" grep grep 'quoted text'
+	awk then export then export "$1" /usr/bin
+local "$@" printf x=1 sed "$1" readonly
+then done "$1" export test && ${HOME}
+	done test -eu local -eu $(pwd) then 2>/dev/null &&
+--verbose "$1" export printf grep "$@" awk local x=1 sed /usr/bin | && "$@"
+	${HOME} cd cd grep awk x=1 "$@" awk sed "$1" readonly readonly "$1"
+		readonly done echo -eu "$1"
+	test "$@" "$@" x=1 | 2>/dev/null readonly local
+		$(pwd) echo sed printf grep local printf echo /usr/bin
+grep awk $(pwd) printf $(pwd) awk echo test
+&& echo cd sed $(pwd) "$1" sed "$1" 2>/dev/null -eu done "$1" "$@" 'quoted text'
+&& && cd printf printf awk "$@" local 'quoted text' && -eu local
+	x=1 awk "$@" && sed /usr/bin 2>/dev/null cd export done grep && &&
+		-eu && /usr/bin cd 2>/dev/null 'quoted text' then 2>/dev/null awk cd "$@"
+/usr/bin | x=1 export x=1 2>/dev/null
+		x=1 sed awk $(pwd) --verbose | && | "$1" test export export local ${HOME} 'quoted text'
+$(pwd) local --verbose "$1" 2>/dev/null echo export
+		readonly ${HOME} awk test "$@" done 'quoted text' x=1 ${HOME} local export ${HOME}
+		done then echo 2>/dev/null -eu readonly awk
+		-eu sed 2>/dev/null && done ${HOME}
+		then printf -eu sed printf
+		sed /usr/bin 'quoted text' ${HOME} done done x=1 test x=1 sed grep 'quoted text'
+	test $(pwd) then grep | readonly
+		/usr/bin sed local done --verbose echo /usr/bin sed 'quoted text' readonly
+	grep export readonly "$1" readonly $(pwd) 2>/dev/null
+		printf 2>/dev/null $(pwd) printf -eu
+		-eu done $(pwd) readonly
+		echo local -eu ${HOME} then x=1
+	'quoted text' 'quoted text' $(pwd) echo "$1"
+	--verbose ${HOME} awk local | "$@" echo 'quoted text' cd
+		awk /usr/bin --verbose ${HOME} ${HOME} x=1 sed then echo ${HOME}
+readonly grep echo ${HOME} cd awk local export $(pwd) done awk export then
+		cd "$@" then printf 'quoted text' && /usr/bin local | "$1"
+	local 'quoted text' sed sed $(pwd) -eu
+		awk export 'quoted text' local echo readonly cd sed local
+"$1" done done cd 'quoted text' sed "$1" echo cd
+	sed echo -eu "$1" /usr/bin echo export then
+"$@" done x=1 cd done --verbose "$1"
+"$1" --verbose /usr/bin x=1 readonly x=1 'quoted text' then sed readonly /usr/bin
+-eu done /usr/bin -eu export -eu grep awk --verbose 'quoted text'
+	done done && "$@" ${HOME} "$@" 'quoted text' 2>/dev/null then then export grep
+	/usr/bin /usr/bin $(pwd) export | cd awk && $(pwd) "$@" awk /usr/bin
+		2>/dev/null awk /usr/bin printf $(pwd) $(pwd) $(pwd) "$1" awk awk then then done
+cd readonly --verbose export cd sed export && && x=1
+	${HOME} | "$1" && sed --verbose "$@" grep
+| && -eu readonly printf 'quoted text' ${HOME} "$1" local printf done readonly
+	'quoted text' awk awk 'quoted text' "$@" --verbose
+	grep export && cd export then -eu readonly ${HOME} "$1" /usr/bin grep "$@"
+	sed grep printf "$1" readonly readonly
+cd grep export /usr/bin --verbose "$@" then 2>/dev/null grep printf echo
+then awk | then then -eu $(pwd) readonly then 2>/dev/null grep done then
+	$(pwd) test && cd x=1 done --verbose
+		export grep | ${HOME} done sed 2>/dev/null sed $(pwd) export
+		${HOME} sed then 2>/dev/null
+	sed printf then | && export x=1 then $(pwd) then readonly export grep /usr/bin
+	"$@" /usr/bin done grep "$1" readonly --verbose readonly && test 'quoted text' x=1
+		local && $(pwd) echo awk done | -eu local | "$@"
+	cd --verbose ${HOME} then cd awk -eu 'quoted text'
+2>/dev/null 2>/dev/null x=1 && printf "$@" export x=1 cd export ${HOME} awk test
+		2>/dev/null grep --verbose
+cd then | printf "$1" -eu ${HOME} "$1" ${HOME}
+		2>/dev/null sed local then -eu grep test ${HOME}
+		grep awk --verbose awk "$@" ${HOME} export && 'quoted text'
+	then | printf export -eu $(pwd) printf sed sed "$1" export test
+		cd grep echo done -eu && awk cd ${HOME} then grep -eu awk 2>/dev/null
+local echo local "$@" local x=1 sed x=1 -eu grep 'quoted text' -eu sed cd readonly
+-eu x=1 -eu | awk x=1 ${HOME} done readonly
+		2>/dev/null x=1 2>/dev/null done awk 2>/dev/null
+		-eu /usr/bin echo -eu sed
+	echo ${HOME} ${HOME} 2>/dev/null done readonly "$1" /usr/bin
+	then then done ${HOME} 'quoted text' readonly x=1 export
+		"$@" readonly && echo export done $(pwd) readonly cd ${HOME}
+"$@" 2>/dev/null && -eu --verbose awk 2>/dev/null done "$1" $(pwd) sed
+"$@" sed "$1" local readonly echo local x=1 grep local awk x=1
+		$(pwd) awk echo grep ${HOME} awk then | --verbose "$1" --verbose
+	then done 'quoted text' awk $(pwd) "$1" $(pwd) $(pwd)
+grep done 2>/dev/null local ${HOME} then done ${HOME} cd printf export | "$1"
+		done && ${HOME} "$1" 'quoted text' readonly
+test $(pwd) grep ${HOME} export 2>/dev/null printf ${HOME}
+	test cd $(pwd) "$@" awk then
+		printf $(pwd) | cd cd echo "$1"
+	printf cd --verbose /usr/bin then
+		test && test 2>/dev/null then 2>/dev/null echo | --verbose
+		-eu "$1" && then echo 'quoted text' local ${HOME} then
+		export x=1 local 2>/dev/null awk printf then export 2>/dev/null "$@" local "$@"
+	done /usr/bin test | "$@" readonly --verbose local awk grep
+/usr/bin done done grep | done readonly 2>/dev/null done local printf
+done ${HOME} ${HOME} echo "$@" $(pwd) cd local cd "$@" awk x=1 'quoted text'
+done /usr/bin "$@" grep -eu grep --verbose
+		then grep done x=1 cd
+		echo 2>/dev/null ${HOME} printf | "$@" "$1" 2>/dev/null sed
+		"$1" test sed && /usr/bin
+2>/dev/null export done grep done
+		${HOME} x=1 "$@" x=1 test "$@" test | | --verbose 2>/dev/null
+	local readonly --verbose local |
+	grep "$1" done $(pwd) local then --verbose local echo echo export
+		2>/dev/null 'quoted text' grep /usr/bin
+then | awk && grep $(pwd) sed readonly -eu export sed echo x=1 -eu /usr/bin
+	echo test -eu local 2>/dev/null && 2>/dev/null test
+	/usr/bin export -eu /usr/bin local sed export "$1" 'quoted text' sed cd readonly
+	x=1 /usr/bin printf grep 2>/dev/null "$1" test printf cd x=1 /usr/bin "$@" awk readonly
+	2>/dev/null echo done grep $(pwd) ${HOME} --verbose awk
+		grep done /usr/bin cd 2>/dev/null x=1 grep x=1 printf && | x=1 "$@" local
+/usr/bin readonly -eu export "$1" x=1 export test
+echo 'quoted text' printf readonly ${HOME} -eu
+	echo -eu then "$@" -eu "$1" ${HOME} | /usr/bin "$1" --verbose ${HOME}
+		| && /usr/bin x=1 && then "$1" --verbose && "$@" test
+		'quoted text' then --verbose echo export
+		awk x=1 echo "$@" test ${HOME} | ${HOME} && awk readonly --verbose
+		printf ${HOME} sed ${HOME} printf test echo awk cd grep ${HOME} 2>/dev/null "$1"
+"$@" grep --verbose 'quoted text'
+	sed /usr/bin sed ${HOME} local grep 'quoted text' local test test -eu
+		/usr/bin done /usr/bin echo echo
+"$1" local test export echo echo
+	&& export done export "$1" then 'quoted text' printf local -eu readonly
+		"$1" export x=1 sed 2>/dev/null | local then test 'quoted text' &&
+"$1" cd export 2>/dev/null
+		$(pwd) 2>/dev/null 2>/dev/null export done $(pwd) 'quoted text'
+		grep 2>/dev/null printf ${HOME}
+cd grep then test | 'quoted text' local echo echo
+	/usr/bin sed -eu 2>/dev/null && awk awk "$1" sed /usr/bin grep
+		echo "$@" x=1 && "$@" x=1 "$1" test local x=1 echo
+	$(pwd) ${HOME} "$@" test | done readonly
+	/usr/bin -eu && "$1" test $(pwd)
+		readonly echo cd x=1 cd --verbose
+		| "$1" awk then 'quoted text' -eu grep export done
+	&& readonly local x=1 echo export ${HOME} 'quoted text' && test
+		-eu "$1" test awk 'quoted text' awk | done awk ${HOME} | 'quoted text' readonly
+		then local test ${HOME} echo local done grep export "$1"
+	&& awk "$@" cd done awk 2>/dev/null awk cd then 'quoted text'
+		grep 'quoted text' local readonly
+		export then echo x=1 test done --verbose done
+		sed 'quoted text' awk $(pwd) -eu | "$@" export sed x=1 export /usr/bin --verbose
+	-eu test -eu awk then 'quoted text' sed $(pwd) $(pwd)
+	done $(pwd) && 'quoted text' sed $(pwd) awk then
+2>/dev/null local awk awk "$1" x=1 printf /usr/bin
+	$(pwd) readonly "$@" test "$1" 'quoted text' printf | printf echo | ${HOME} awk
+		readonly local then local ${HOME} export cd $(pwd) export then
+--verbose -eu "$@" /usr/bin grep
+		/usr/bin then grep export 2>/dev/null
+		"$1" test grep cd export ${HOME} | "$@" x=1 $(pwd) 'quoted text' 2>/dev/null
+local "$@" x=1 "$1" printf -eu $(pwd) && 'quoted text' --verbose
+	&& x=1 echo -eu x=1 awk then grep awk then done
+		done local | printf grep 'quoted text'
+		"$1" -eu cd "$1" sed grep "$@" | 'quoted text' "$1"
+2>/dev/null readonly -eu
+local readonly echo $(pwd) export sed /usr/bin printf test "$1" 'quoted text'
+		export cd | readonly -eu echo awk && /usr/bin "$@"
+	test echo -eu printf x=1 ${HOME} export then echo printf 2>/dev/null
+cd awk /usr/bin x=1 echo done --verbose ${HOME}
+"$@" -eu /usr/bin && grep
+		--verbose export awk export | 2>/dev/null
+grep && x=1 ${HOME} sed 2>/dev/null awk test grep cd --verbose ${HOME}
+		readonly printf --verbose done 'quoted text' 2>/dev/null printf -eu x=1 'quoted text'
+	| local x=1 "$@" ${HOME} done printf && test cd done ${HOME}
+		x=1 then awk "$1" | ${HOME} 2>/dev/null echo /usr/bin cd sed readonly
+	| "$1" readonly cd sed "$1" then echo "$1" grep grep && export export printf 'quoted text'
+		printf then -eu cd ${HOME} readonly echo
+	echo export sed "$@" && x=1 x=1 x=1 done "$@" ${HOME} 2>/dev/null done
+printf printf echo awk then x=1 'quoted text' && "$@"
+		'quoted text' test /usr/bin && done done
+grep 2>/dev/null ${HOME} "$@" && "$1" done 2>/dev/null
+	sed local ${HOME} $(pwd) then sed ${HOME} grep
+		export 2>/dev/null | local "$1" done --verbose
+done x=1 awk test "$@" 2>/dev/null 2>/dev/null ${HOME} /usr/bin
+| "$@" 2>/dev/null "$@" -eu
+		2>/dev/null | -eu done &&
+readonly 'quoted text' "$1" echo /usr/bin
+&& "$@" "$1" then | done cd --verbose grep local "$1" sed done sed && x=1
+${HOME} echo 'quoted text'
+		cd export readonly printf --verbose 'quoted text' 'quoted text'
+grep printf ${HOME} -eu
+	&& /usr/bin echo awk x=1
+"$1" "$@" /usr/bin x=1 /usr/bin
+		&& awk --verbose readonly readonly printf 'quoted text' printf ${HOME}
+		cd local then "$@" echo readonly 'quoted text' then
+	echo printf $(pwd) $(pwd) then awk then
+		awk cd ${HOME} x=1 export test "$@" -eu -eu "$1" /usr/bin $(pwd)
+		echo "$1" then && ${HOME} echo cd sed "$1" awk ${HOME} cd export -eu --verbose
+	$(pwd) && readonly then /usr/bin local sed local done done export --verbose
+		printf ${HOME} && -eu test 'quoted text'
+		'quoted text' 2>/dev/null local test $(pwd) ${HOME}
+local "$1" readonly x=1 "$1" "$1" ${HOME}
+	$(pwd) /usr/bin ${HOME} 'quoted text' local $(pwd)
+	&& && printf && "$1" $(pwd) | export
+	grep x=1 --verbose 2>/dev/null /usr/bin
+readonly 'quoted text' local ${HOME} test && printf then
+		2>/dev/null /usr/bin "$1" "$@" 2>/dev/null
+	done "$1" /usr/bin then --verbose readonly ${HOME} cd
+local cd x=1 done ${HOME} x=1 printf "$1" /usr/bin ${HOME} "$@"
+	&& ${HOME} export $(pwd) local ${HOME} --verbose cd -eu
+	"$@" ${HOME} grep done test "$@" local export ${HOME} $(pwd) local &&
+local 'quoted text' x=1 x=1 export readonly $(pwd) test readonly /usr/bin test
+	grep x=1 grep readonly /usr/bin "$@" local 'quoted text' printf -eu
+		readonly echo awk x=1 -eu "$1" then && then sed
+		x=1 printf printf --verbose sed test 'quoted text' --verbose readonly then printf
+		'quoted text' /usr/bin "$1" readonly then | $(pwd) "$@" export --verbose readonly
+	&& 'quoted text' && ${HOME} test x=1
+	${HOME} && "$1" awk test local test then sed --verbose x=1 export sed --verbose
+		grep x=1 grep -eu then | ${HOME} ${HOME}
+echo x=1 2>/dev/null readonly test /usr/bin
+| cd "$1" done "$1" | done export ${HOME} then 'quoted text' export cd "$@"
+		awk awk cd grep x=1 done 2>/dev/null local
+		2>/dev/null export done sed 2>/dev/null
+	| x=1 echo | local local local export sed awk 2>/dev/null done test
+	done -eu awk $(pwd) && 2>/dev/null | ${HOME} local cd local printf
+	$(pwd) local 'quoted text' test x=1 ${HOME} cd done awk 'quoted text' test |
+&& readonly export x=1 2>/dev/null && local awk 2>/dev/null
+	${HOME} | echo echo readonly
+		awk export export done | --verbose -eu printf --verbose
+-eu grep readonly echo "$@" x=1 2>/dev/null echo ${HOME} 'quoted text'
+2>/dev/null echo | cd && /usr/bin grep
+		2>/dev/null | cd then then done | "$@" sed x=1 done 'quoted text'
+x=1 cd && readonly cd "$@" "$1" "$1" -eu |
+		'quoted text' sed local readonly ${HOME} &&
+| | done local test readonly && printf "$1"
+	--verbose sed local then ${HOME} then "$@" &&
+	${HOME} printf $(pwd) then export --verbose test echo export ${HOME}
+		| readonly done && sed
+		&& "$@" readonly "$@" printf
+		export -eu "$1" sed $(pwd)
+	then $(pwd) x=1 then "$@" awk sed readonly | 'quoted text'
+&& -eu && && /usr/bin && grep && sed "$@" then $(pwd)
+'quoted text' test then export export cd && x=1 "$1" echo 'quoted text'
+	x=1 sed 2>/dev/null awk awk echo sed x=1 test x=1 then "$@" 'quoted text'
+	echo "$@" grep "$1" | 'quoted text'
+		done "$@" 2>/dev/null printf $(pwd) cd -eu local -eu awk done readonly
+"$@" --verbose --verbose 'quoted text' "$@" /usr/bin local "$1" | "$@"
+		&& done awk && grep awk echo echo "$@" x=1 local cd /usr/bin -eu -eu
+	echo test echo export local --verbose $(pwd) done "$@" done test -eu && -eu then
+		then printf && then -eu readonly
+		export done 'quoted text' readonly printf /usr/bin && --verbose
+	&& $(pwd) -eu grep printf printf done && 'quoted text' x=1 ${HOME}
+		"$1" "$@" local awk x=1 sed
+	| sed printf -eu then awk -eu --verbose x=1 | /usr/bin local grep readonly
+	| printf "$@" $(pwd) /usr/bin "$1" local "$@" local done awk /usr/bin
+		"$1" "$1" grep export x=1 && awk sed then -eu then grep done -eu export
+		cd 'quoted text' ${HOME} cd done local awk --verbose && -eu && grep "$1" ${HOME}
+&& "$@" x=1 "$1" /usr/bin $(pwd) awk readonly -eu 'quoted text'
+	$(pwd) | "$1" /usr/bin /usr/bin
+${HOME} 'quoted text' test "$@" x=1 'quoted text' test x=1 awk printf echo
+awk awk && printf sed ${HOME} --verbose && echo test then done then
+local done && && && 2>/dev/null
+test 2>/dev/null -eu --verbose "$@" echo printf readonly test "$1" -eu test
+-eu grep grep 'quoted text' test
+		"$@" export printf local "$@" | && "$@" printf "$@" export
+		printf | $(pwd) | readonly --verbose
+	"$@" readonly then "$@" -eu 'quoted text' test "$1" "$1" 2>/dev/null
+--verbose "$@" | | -eu "$@" then x=1 ${HOME} -eu printf
+printf ${HOME} -eu && then /usr/bin x=1 export sed 'quoted text'
+		readonly ${HOME} cd 'quoted text' && ${HOME} | export
+--verbose | $(pwd) "$@" -eu --verbose
+/usr/bin --verbose test readonly test local
+	${HOME} then "$1" -eu "$@" && done ${HOME} "$1" --verbose
+		export && /usr/bin echo
+		readonly "$1" | cd printf "$@" printf export awk && /usr/bin export export x=1
+${HOME} test $(pwd) grep 'quoted text' "$@" export && cd local "$1" sed /usr/bin
+grep cd 2>/dev/null readonly && local ${HOME} && then /usr/bin /usr/bin --verbose
+		&& | ${HOME} 'quoted text' ${HOME} printf "$@" ${HOME} "$1" sed
+		/usr/bin $(pwd) | ${HOME} done ${HOME} /usr/bin printf readonly 2>/dev/null printf
+		2>/dev/null sed $(pwd) printf 'quoted text' printf cd "$1"
+	'quoted text' | | 2>/dev/null sed printf
+	x=1 readonly readonly --verbose 'quoted text' "$1" 'quoted text' /usr/bin $(pwd)
+2>/dev/null readonly 2>/dev/null sed
+	--verbose local --verbose test
+	then grep x=1 cd 2>/dev/null --verbose cd | echo test $(pwd) then "$@" "$1" awk
+grep readonly | grep | $(pwd) && /usr/bin -eu x=1 /usr/bin
+local /usr/bin 2>/dev/null 2>/dev/null test | grep 'quoted text' /usr/bin
+	done --verbose x=1 $(pwd) readonly grep $(pwd)
+| sed "$1" -eu ${HOME} --verbose && --verbose -eu export test awk | "$1" export
+		awk echo local x=1 --verbose local test --verbose
+	"$1" sed readonly done done --verbose 'quoted text' x=1 ${HOME} x=1 printf 2>/dev/null
+		local done cd | | cd "$@" 'quoted text' cd ${HOME}
+		'quoted text' -eu sed grep ${HOME}
+	/usr/bin $(pwd) sed 'quoted text'
+"$@" then /usr/bin local grep readonly cd cd then 'quoted text'
+		local then && cd readonly | --verbose x=1 --verbose
+		local done -eu export 2>/dev/null
+'quoted text' $(pwd) sed grep cd 'quoted text' readonly -eu
+	readonly echo cd awk x=1 && readonly 2>/dev/null
+	readonly "$@" awk then 2>/dev/null /usr/bin grep $(pwd) "$@" export done sed -eu
+	"$1" && printf then "$1" printf | cd 2>/dev/null
+then ${HOME} printf grep
+	awk export export /usr/bin grep 2>/dev/null echo 2>/dev/null | echo x=1
+		grep | 2>/dev/null grep awk local 2>/dev/null grep
+'quoted text' then ${HOME} | then
+		"$@" sed --verbose sed
+awk test export grep 'quoted text' -eu "$1" && cd awk x=1
+&& local test sed awk /usr/bin test x=1 done export done 2>/dev/null
+	'quoted text' /usr/bin done --verbose
+	done done x=1 done --verbose awk -eu x=1 sed export
+		x=1 --verbose cd 'quoted text' then then echo echo 2>/dev/null
+	"$1" ${HOME} -eu readonly sed done | 'quoted text' ${HOME}
+	/usr/bin awk 2>/dev/null echo x=1 && --verbose x=1 -eu local
+		"$@" then | local cd /usr/bin ${HOME}
+		then readonly awk local echo -eu 2>/dev/null readonly "$@" awk echo readonly
+awk x=1 --verbose sed "$@" x=1 ${HOME} echo x=1 done | export
+readonly readonly x=1 | ${HOME}
+echo sed export awk --verbose --verbose
+	done awk && && done echo
+then x=1 local readonly echo
+2>/dev/null readonly awk sed
+	sed /usr/bin "$1" "$@" export local
+	cd done then "$1" grep 2>/dev/null awk 2>/dev/null sed "$1" && done -eu
+cd -eu printf 2>/dev/null done cd
+		"$1" | local "$1" 'quoted text'
+	-eu printf export export | -eu local 'quoted text'
+		x=1 done 2>/dev/null echo echo cd ${HOME}
+	"$@" && cd | x=1 test awk test export "$1" ${HOME}
+"$1" -eu && printf $(pwd) "$1" printf done && sed 2>/dev/null /usr/bin x=1 test
+		"$1" -eu x=1 -eu awk export x=1 cd --verbose 'quoted text' 'quoted text'
+&& "$@" test "$1" | ${HOME} "$1" /usr/bin done &&
+	2>/dev/null /usr/bin "$1"
+		cd --verbose grep && 2>/dev/null 2>/dev/null
+	echo 'quoted text' sed x=1 2>/dev/null x=1 grep printf readonly cd x=1 "$@" printf
+	then readonly $(pwd) "$@" grep 2>/dev/null
+		&& local export ${HOME} done
+	local export test 2>/dev/null awk --verbose local awk cd done then local
+		cd /usr/bin && "$1" local done then test 2>/dev/null ${HOME}
+		sed /usr/bin grep printf awk
+${HOME} 2>/dev/null && "$@" x=1 -eu grep 2>/dev/null
+		local /usr/bin 'quoted text' cd "$1"
+printf -eu echo --verbose test 2>/dev/null export
+	sed echo cd "$1" printf
+		done "$1" "$@" local readonly
+	awk readonly && ${HOME} printf "$1" 'quoted text'
+		local printf && awk export
+	${HOME} --verbose && echo local $(pwd) printf | sed 2>/dev/null readonly
+export 'quoted text' readonly 'quoted text' echo ${HOME} readonly then export printf
+		awk 2>/dev/null readonly export cd | --verbose $(pwd) awk "$@" readonly &&
+then ${HOME} $(pwd) cd printf --verbose echo $(pwd) export then --verbose | "$1"
+export -eu $(pwd) awk local local export && sed
+	readonly done cd test sed readonly
+test export $(pwd) readonly -eu "$@" then grep grep "$@" cd -eu
+	"$@" readonly export then sed test "$1"
+		echo x=1 sed grep sed x=1 awk -eu --verbose $(pwd) local cd grep sed ${HOME} "$@"
+		test local echo 2>/dev/null
+awk ${HOME} readonly 'quoted text' local local then | export
+		| | printf test "$1" &&
+x=1 | cd done 2>/dev/null
+grep grep -eu awk $(pwd) 'quoted text' awk 2>/dev/null then
+	"$1" then "$@" sed awk ${HOME} && | 'quoted text' "$1" local
+'quoted text' echo x=1 --verbose
+awk /usr/bin ${HOME}
+	${HOME} grep cd echo 2>/dev/null local "$1" awk sed ${HOME} cd readonly
+"$1" test then echo | grep ${HOME} --verbose 2>/dev/null
+		echo $(pwd) local readonly
+		x=1 export | -eu done $(pwd) awk /usr/bin -eu cd export
+		"$@" | /usr/bin cd /usr/bin readonly
+--verbose $(pwd) sed "$1" $(pwd) grep cd readonly test --verbose
+	local /usr/bin echo --verbose echo ${HOME} test export
+	"$@" awk sed test "$@" cd printf
+then grep $(pwd) echo ${HOME} 'quoted text' local
+		/usr/bin /usr/bin readonly
+done ${HOME} 'quoted text' "$@"
+printf /usr/bin -eu | 'quoted text' test export printf
+	readonly -eu done && 2>/dev/null ${HOME}
+then -eu then grep readonly | printf done done awk then sed | done echo test
+		"$@" cd /usr/bin awk 'quoted text'
+	local sed && echo 2>/dev/null
+	export readonly $(pwd) done cd && x=1 /usr/bin
+		--verbose sed 'quoted text' x=1 ${HOME} x=1 "$1" test
+	--verbose awk "$1" 2>/dev/null "$@" "$@"
+grep done test "$1" ${HOME} --verbose
+	printf $(pwd) 'quoted text' -eu then "$@" echo export 'quoted text' 'quoted text'
+		2>/dev/null 2>/dev/null 'quoted text' printf | 2>/dev/null
+		"$@" x=1 2>/dev/null cd x=1 /usr/bin
+		test && echo && readonly "$1" | ${HOME}
+	echo sed 'quoted text' "$1" -eu | test sed printf export /usr/bin
+		awk "$@" $(pwd) export sed "$@" /usr/bin 'quoted text' "$1" grep
+		printf printf 'quoted text' cd "$1" done x=1 printf /usr/bin local readonly
+&& ${HOME} test done readonly cd local | && | | grep | --verbose
+	${HOME} --verbose /usr/bin 'quoted text'
+done 'quoted text' sed x=1 readonly x=1 "$1" -eu awk /usr/bin
+		${HOME} export -eu && "$@" $(pwd) "$1" test
+		--verbose /usr/bin | export --verbose /usr/bin
+		test sed | && | sed readonly
+		test printf ${HOME} cd readonly
+done --verbose cd echo export echo cd | readonly -eu test then then
+	export "$1" 2>/dev/null 'quoted text' export sed | 'quoted text'
+'quoted text' echo && cd --verbose | /usr/bin && "$@" grep cd
+	then echo --verbose test /usr/bin export printf readonly 2>/dev/null
+		/usr/bin ${HOME} export then x=1 grep 'quoted text'
+export "$1" export && | local awk --verbose grep readonly $(pwd) $(pwd) local
+--verbose test $(pwd) -eu 'quoted text'
+		export grep printf x=1 readonly cd "$@" ${HOME} x=1 cd sed cd && $(pwd)
+"$@" ${HOME} --verbose "$@" ${HOME} && local sed
+		readonly echo x=1 readonly local echo 'quoted text'
+	printf x=1 awk printf && "$@" --verbose "$1" -eu ${HOME} local awk
+		"$1" grep export test sed && "$@" local
+	printf x=1 grep done local readonly
+	2>/dev/null export 2>/dev/null x=1 sed /usr/bin
+	"$1" ${HOME} awk echo cd 2>/dev/null sed | grep echo done cd &&
+${HOME} local done 'quoted text' -eu
+-eu -eu grep "$1" export --verbose -eu ${HOME} 2>/dev/null sed 'quoted text'
+		"$@" 'quoted text' ${HOME} /usr/bin 2>/dev/null printf
+		test 'quoted text' $(pwd) "$@" readonly $(pwd) && /usr/bin sed grep
+		| export ${HOME} $(pwd) awk /usr/bin export export /usr/bin $(pwd)
+sed then echo awk | "$1" x=1 2>/dev/null | test local ${HOME} then echo
+	$(pwd) "$1" grep awk "$1" then sed && -eu ${HOME} /usr/bin cd printf grep
+	/usr/bin local 2>/dev/null $(pwd) "$@" awk "$@" echo sed printf echo awk
+	export export --verbose --verbose printf ${HOME}
+x=1 2>/dev/null "$@" readonly
+	--verbose grep readonly 2>/dev/null sed export printf 'quoted text'
+		printf done sed /usr/bin | ${HOME} done "$1" --verbose grep
+		"$1" readonly "$@" readonly grep cd cd && -eu cd | "$@" 'quoted text' /usr/bin --verbose
+		local ${HOME} 2>/dev/null grep cd | 2>/dev/null
+		echo printf printf done export | export grep cd printf cd -eu sed $(pwd) cd
+		test readonly printf sed "$1" "$@" x=1
+		--verbose grep 2>/dev/null $(pwd) export export printf
+grep test done $(pwd) export grep export 'quoted text'
+	--verbose && ${HOME} $(pwd) printf "$@" test export grep echo
+		"$1" printf | echo -eu $(pwd) printf printf
+		/usr/bin printf test "$@" x=1 awk x=1 && && 'quoted text' 2>/dev/null "$@" /usr/bin
+	readonly 2>/dev/null 2>/dev/null
+		--verbose grep cd 'quoted text'
+		done echo awk echo local cd cd && echo done then /usr/bin x=1 printf cd
+sed done cd x=1 export ${HOME} sed /usr/bin ${HOME}
+	2>/dev/null 2>/dev/null $(pwd) export
+		"$@" $(pwd) echo then
+	echo export done local -eu --verbose
+echo test | export printf x=1 "$1"
+		done x=1 grep 2>/dev/null printf printf done
+$(pwd) x=1 then | test local x=1 printf -eu export
+	--verbose 'quoted text' printf "$@" && ${HOME} 2>/dev/null -eu /usr/bin local
+		"$@" 'quoted text' grep printf "$@" ${HOME} 'quoted text' readonly then awk
+	echo ${HOME} --verbose ${HOME} local printf grep | then
+		-eu awk then printf done cd
+	x=1 local x=1 -eu then /usr/bin -eu 2>/dev/null
+	/usr/bin | "$1" then printf done
+		"$1" awk 'quoted text' cd awk export awk cd x=1 --verbose
+done ${HOME} --verbose export
+$(pwd) readonly x=1 | "$1" cd test awk grep /usr/bin
+test readonly test "$@" local cd printf cd test 2>/dev/null --verbose
+		"$@" cd "$@" export readonly --verbose
+"$@" "$@" sed export 'quoted text' x=1 printf "$1" test
+done /usr/bin test grep sed cd && sed ${HOME}
+"$1" --verbose "$1" grep "$1" 'quoted text' local export && "$@" 'quoted text'
+		export done cd test "$@"
+"$1" "$@" ${HOME} | && 2>/dev/null
+		local && echo export test $(pwd) echo 2>/dev/null 2>/dev/null ${HOME}
+		cd -eu $(pwd) export -eu --verbose | 2>/dev/null readonly grep test grep /usr/bin
+&& x=1 /usr/bin cd $(pwd) "$1" awk grep cd echo
+	cd "$@" done cd ${HOME} local printf sed | "$@" cd 2>/dev/null
+	${HOME} then test done && 'quoted text' grep 2>/dev/null "$1" awk sed
+$(pwd) export /usr/bin &&
+/usr/bin "$1" local grep 'quoted text'
+cd /usr/bin 'quoted text' $(pwd) local 2>/dev/null
+		local export cd 2>/dev/null --verbose ${HOME} /usr/bin sed x=1 "$1" awk
+/usr/bin then "$1" printf printf done | local
+"$@" x=1 --verbose echo ${HOME} -eu printf 'quoted text' --verbose
+$(pwd) $(pwd) ${HOME} cd sed 'quoted text' | "$1" x=1 --verbose 2>/dev/null
+		cd ${HOME} echo ${HOME} x=1 /usr/bin x=1 -eu cd -eu && cd echo ${HOME} sed cd
+		awk && printf ${HOME} 'quoted text'
+	readonly x=1 test "$1" 'quoted text' x=1 readonly
+	readonly grep export -eu printf grep $(pwd) sed -eu
+grep -eu /usr/bin $(pwd) grep "$1" --verbose done -eu /usr/bin
+done ${HOME} local $(pwd) export done 'quoted text' readonly
+local done | cd 'quoted text' -eu x=1 cd export
+	then 2>/dev/null test
+	done x=1 'quoted text' 2>/dev/null sed ${HOME} done -eu x=1 "$@" |
+		done ${HOME} export export "$@" && echo sed cd | 2>/dev/null
+		readonly readonly ${HOME} /usr/bin 2>/dev/null test
+	awk done ${HOME} x=1 cd 'quoted text' && cd sed | $(pwd) 'quoted text'
+done awk readonly cd $(pwd) cd done "$@" | cd test | 2>/dev/null
+'quoted text' ${HOME} sed grep test 2>/dev/null done -eu
+&& --verbose | printf export "$@" "$@" --verbose /usr/bin ${HOME}
+/usr/bin && cd printf 'quoted text'
+	printf && x=1 /usr/bin echo "$@" /usr/bin
+x=1 'quoted text' test grep ${HOME} export done && --verbose cd
+		sed $(pwd) then x=1 sed test /usr/bin -eu $(pwd) | "$1"
+	'quoted text' echo done /usr/bin && -eu sed then /usr/bin export && readonly awk
+		$(pwd) /usr/bin && grep x=1 2>/dev/null 2>/dev/null
+printf x=1 grep -eu $(pwd) "$@" -eu local "$1" done /usr/bin
+export sed printf "$@" && ${HOME} done
+x=1 readonly sed $(pwd) done echo ${HOME} test export
+		done $(pwd) "$@" printf "$1" "$@" "$1" --verbose
+		"$1" echo 2>/dev/null then && echo && sed done "$@" "$1" /usr/bin 'quoted text'
+readonly done echo "$1"
+	| $(pwd) ${HOME} 2>/dev/null
+readonly export then done && /usr/bin 2>/dev/null sed printf
+		done && 2>/dev/null printf export readonly cd ${HOME} 'quoted text' --verbose
+cd test grep "$@" echo
+	2>/dev/null cd /usr/bin $(pwd) x=1 echo "$1" $(pwd) 2>/dev/null
+	/usr/bin ${HOME} export -eu test cd done ${HOME} done 2>/dev/null -eu
+		awk grep --verbose readonly 2>/dev/null test ${HOME}
+	awk echo 'quoted text' | readonly echo awk grep -eu sed done awk grep
+		$(pwd) then export x=1 echo test sed 2>/dev/null local --verbose
+		done printf test $(pwd) grep "$@" /usr/bin export -eu echo 2>/dev/null
+		2>/dev/null ${HOME} readonly
+	2>/dev/null export /usr/bin "$@" export sed /usr/bin local test 'quoted text'
+		"$@" "$@" "$1" "$@" echo test --verbose "$1" 2>/dev/null | readonly x=1 x=1 local
+	export awk x=1 "$1" cd "$@" && awk ${HOME} ${HOME} cd grep
+	-eu && | x=1 2>/dev/null local test $(pwd) --verbose
+		"$@" printf sed 'quoted text' /usr/bin printf && export
+		/usr/bin then sed then -eu --verbose readonly
+	cd | /usr/bin && | then printf
+export export grep test then grep /usr/bin
+${HOME} -eu export /usr/bin
+	cd -eu readonly /usr/bin 'quoted text' cd export awk 'quoted text'
+		| -eu /usr/bin 2>/dev/null
+${HOME} ${HOME} local sed then export ${HOME}
+	| sed printf test sed echo printf /usr/bin x=1 "$1" awk ${HOME} 'quoted text'
+	--verbose ${HOME} grep && grep readonly test -eu export export --verbose
+grep awk export done sed $(pwd) printf "$@" test sed echo 'quoted text' sed readonly
+&& local echo printf -eu export "$@" then sed && printf --verbose
+	grep "$1" test export echo --verbose readonly --verbose echo
+grep 'quoted text' test local -eu readonly local
+		"$1" $(pwd) ${HOME} sed ${HOME} /usr/bin
+awk $(pwd) then export awk x=1 done /usr/bin x=1 awk --verbose
+then done done ${HOME} readonly local /usr/bin && awk grep
+then x=1 sed -eu -eu sed awk grep
+		"$@" then local printf /usr/bin test && $(pwd)
+	awk | sed echo grep local grep then /usr/bin
+awk export then $(pwd) &&
+echo then x=1 && x=1 grep export local
+	"$@" then echo sed echo test echo ${HOME} 2>/dev/null
+&& ${HOME} test printf cd
+	--verbose test grep 2>/dev/null awk
+		then "$@" printf /usr/bin "$1" then ${HOME} export cd && ${HOME} &&
+		-eu ${HOME} sed grep cd
+'quoted text' /usr/bin -eu $(pwd)
+		"$1" | export --verbose local export readonly echo printf
+		2>/dev/null local x=1 |
+		grep cd printf export 2>/dev/null done awk "$@" export grep 'quoted text'
+awk "$@" -eu ${HOME} 'quoted text' echo sed readonly export done done
+cd sed readonly local
+	export "$1" 'quoted text' done printf printf test /usr/bin
+printf /usr/bin ${HOME} export done /usr/bin done test 'quoted text'
+cd grep done 'quoted text' | && export cd local echo export
+sed | printf sed ${HOME} echo --verbose && test then awk x=1 export test
+		cd local readonly awk local readonly readonly /usr/bin grep then "$1"
+		--verbose then done test /usr/bin export
+		&& --verbose awk $(pwd) local "$@" /usr/bin readonly --verbose |
+	export export export 'quoted text' ${HOME} $(pwd) -eu done 2>/dev/null export
+		&& printf printf /usr/bin /usr/bin printf -eu readonly 2>/dev/null ${HOME} -eu
+		local done -eu 2>/dev/null "$1" echo printf local --verbose ${HOME} x=1 ${HOME}
+	--verbose 2>/dev/null ${HOME} readonly
+	sed && awk $(pwd) awk grep 'quoted text' &&
+	"$1" sed awk "$1" ${HOME} readonly done $(pwd) "$1"
+	grep "$1" test /usr/bin grep && export
+'quoted text' cd --verbose echo export printf echo --verbose
+	sed sed /usr/bin readonly 'quoted text' local "$1" /usr/bin readonly echo echo
+	'quoted text' /usr/bin local printf 2>/dev/null
+		awk sed printf awk readonly
+then x=1 'quoted text' -eu "$@" awk export
+		"$@" cd --verbose cd local
+--verbose 'quoted text' ${HOME} export done test ${HOME} | cd -eu ${HOME}
+printf grep then ${HOME} x=1 --verbose sed readonly
+then 'quoted text' grep echo /usr/bin export "$@" --verbose
+		| $(pwd) echo printf grep printf "$1" 'quoted text' x=1 -eu local done
+	sed test && x=1 /usr/bin && echo local | "$1" | "$1" -eu
+grep then ${HOME} done | then -eu sed printf && x=1 sed -eu
+cd echo sed $(pwd) echo 'quoted text' && cd echo export export "$1" x=1 "$@" echo
+export done -eu "$@" done "$@" --verbose test ${HOME}
+awk "$@" ${HOME} readonly echo | done cd /usr/bin grep && "$@" awk grep
+		&& $(pwd) local readonly echo "$@" test $(pwd) "$@" grep printf
+--verbose local test | ${HOME} --verbose
+	| && then cd then -eu awk | 2>/dev/null
+	'quoted text' sed | export $(pwd) then
+	| "$@" /usr/bin readonly "$1" printf test --verbose
+		awk 2>/dev/null $(pwd) x=1 && export | then --verbose ${HOME} "$@" local /usr/bin
+	--verbose awk sed printf "$@" | 2>/dev/null 'quoted text'
+	/usr/bin 'quoted text' awk x=1 then
+cd local done awk export 2>/dev/null
+	${HOME} --verbose 2>/dev/null ${HOME} done readonly cd test ${HOME}
+		&& export 'quoted text' 'quoted text'
+	-eu $(pwd) $(pwd) echo $(pwd) ${HOME}
+local && export echo ${HOME} --verbose
+	export printf ${HOME} export -eu printf printf test done ${HOME}
+sed -eu "$@" test $(pwd) grep cd
+${HOME} x=1 x=1 "$@" ${HOME} readonly awk
+		grep done readonly /usr/bin "$1" then /usr/bin local local
+x=1 sed -eu then "$@" readonly done readonly --verbose 'quoted text' ${HOME} test
+	grep 'quoted text' test echo local done --verbose test export
+		$(pwd) printf && cd test | 2>/dev/null cd cd awk local 2>/dev/null
+printf printf && "$@" sed $(pwd) 'quoted text' | done && echo
+	--verbose printf x=1 && "$1" grep --verbose sed -eu ${HOME}
+	--verbose 'quoted text' ${HOME} x=1
+	&& grep export -eu test "$@" | done && -eu x=1 export -eu -eu --verbose -eu
+		'quoted text' local 'quoted text' 2>/dev/null done done export && readonly
+	readonly "$@" ${HOME} done | echo | $(pwd) cd /usr/bin
+then cd then -eu echo 2>/dev/null grep awk -eu 2>/dev/null
+	&& sed | printf x=1 export 2>/dev/null test sed done
+export sed test x=1 printf "$@" then local -eu
+--verbose 2>/dev/null && test awk export awk /usr/bin | done then 'quoted text'
+'quoted text' cd "$@" 2>/dev/null ${HOME} echo then
+	2>/dev/null && echo export done export local /usr/bin 2>/dev/null
+	&& then | echo /usr/bin export --verbose | && readonly |
+	'quoted text' && 'quoted text' ${HOME}
+${HOME} readonly export $(pwd) done "$@" &&
+	2>/dev/null test 2>/dev/null $(pwd)
+		local --verbose $(pwd) readonly "$1" grep $(pwd)
+		then printf "$1" grep 2>/dev/null sed 'quoted text'
+local printf grep grep "$1" then grep local x=1 /usr/bin cd 'quoted text' &&
+		then then awk $(pwd) done grep ${HOME} done done $(pwd) && export export -eu
+		/usr/bin x=1 "$@" test local awk readonly sed printf 'quoted text'
+		then test local readonly | /usr/bin export ${HOME} x=1
+sed echo 'quoted text' "$@" test /usr/bin 'quoted text'
+awk local "$@" "$1" ${HOME} x=1 cd ${HOME} sed local echo --verbose -eu -eu
+	then test 'quoted text' --verbose then 2>/dev/null
+awk then test $(pwd) sed -eu printf done ${HOME} 2>/dev/null ${HOME} grep 'quoted text'
+		-eu done && "$1" "$@" then then "$@" test sed 2>/dev/null then $(pwd) readonly
+	-eu --verbose 'quoted text' echo ${HOME} then | readonly local "$@" sed
+	test export export --verbose readonly && export ${HOME}
+	printf /usr/bin && then awk readonly /usr/bin awk
+cd ${HOME} sed grep -eu test "$@" then $(pwd) 2>/dev/null
+readonly done awk then done "$@"
+	done && sed x=1 sed "$1" "$@" done export readonly grep "$@" readonly then
+	'quoted text' then cd 2>/dev/null then 2>/dev/null $(pwd) ${HOME} printf &&
+test --verbose grep cd 2>/dev/null | x=1 "$@" "$@" x=1
+	&& sed "$1" "$@" echo awk local
+		then grep ${HOME} done test awk test $(pwd) test printf echo local done
+	x=1 ${HOME} echo done 2>/dev/null
+sed x=1 "$@" printf x=1 $(pwd) printf
+	x=1 'quoted text' 2>/dev/null local x=1
+	cd awk sed -eu x=1 grep /usr/bin "$1" then 2>/dev/null 'quoted text' ${HOME}
+export | echo echo | x=1 done
+		echo test readonly && sed cd "$@" 2>/dev/null 2>/dev/null
+	/usr/bin --verbose | sed | 2>/dev/null $(pwd) sed cd cd /usr/bin
+		"$@" done --verbose export then 2>/dev/null $(pwd) "$1" --verbose
+	grep grep 'quoted text' sed export | && --verbose grep awk -eu "$1" sed grep
+awk readonly -eu "$@" 'quoted text' 2>/dev/null export | awk "$@"
+-eu readonly grep x=1 test awk printf 'quoted text' "$1" x=1 && cd then 'quoted text'
+		sed echo readonly sed cd
+/usr/bin -eu done printf local printf && $(pwd) 2>/dev/null printf "$1"
+		"$@" cd done 'quoted text' grep ${HOME} local printf printf done echo
+		cd test readonly test grep -eu readonly awk echo $(pwd) $(pwd) cd -eu
+	local then grep test /usr/bin then /usr/bin x=1 printf && printf echo
+readonly printf done export then 'quoted text' /usr/bin /usr/bin
+		/usr/bin awk $(pwd) awk -eu export then 'quoted text' then done awk
+	&& cd 2>/dev/null then readonly printf grep
+local readonly "$@" cd awk -eu 'quoted text' export
+		"$1" then then "$@" export export -eu grep printf | sed 'quoted text' readonly 2>/dev/null
+		local sed | | done sed && export sed echo ${HOME} /usr/bin ${HOME}
+	2>/dev/null | "$1" --verbose printf grep "$1" 'quoted text' awk &&
+$(pwd) x=1 && "$1" echo -eu test grep awk test x=1 sed | awk /usr/bin /usr/bin
+		2>/dev/null "$1" export /usr/bin x=1
+		/usr/bin grep "$1" | x=1 "$@" && 'quoted text' x=1 local printf
+awk local local then 2>/dev/null 'quoted text' --verbose ${HOME} cd &&
+2>/dev/null done /usr/bin | sed x=1 $(pwd) "$@" awk printf done
+	awk "$1" -eu sed $(pwd)
+	"$1" echo grep test local | export then local x=1 export
+"$1" "$1" cd $(pwd) x=1 && local sed -eu readonly printf awk --verbose
+	sed | --verbose "$@" && done sed done test && --verbose && local
+		/usr/bin x=1 -eu sed 2>/dev/null /usr/bin
+	${HOME} export /usr/bin echo
+"$1" then && /usr/bin 'quoted text' export echo sed "$@" --verbose ${HOME} | then
+-eu | 2>/dev/null test awk ${HOME} /usr/bin test sed test then
+	readonly printf --verbose "$1" then test --verbose $(pwd) cd && echo done
+		grep $(pwd) export && then 2>/dev/null echo
+		readonly 'quoted text' awk cd --verbose done
+readonly test then 2>/dev/null 2>/dev/null
+	"$@" sed ${HOME} $(pwd) grep done
+	"$1" local && x=1 test done sed "$@" -eu printf 'quoted text' && "$1"
+		sed then ${HOME} "$@" x=1 test sed ${HOME} "$1" /usr/bin
+x=1 && grep grep /usr/bin echo readonly "$1" local /usr/bin grep local
+	--verbose x=1 then awk ${HOME} "$1" grep readonly awk sed
+export 2>/dev/null sed "$1" |
+		local echo "$1" | readonly --verbose "$1" && "$1" && sed test
+		x=1 "$@" "$1" && grep awk grep ${HOME} export /usr/bin then | readonly
+		test done local sed && "$1" | grep done
+	cd cd x=1 echo "$1" echo $(pwd) "$@" local ${HOME} printf 2>/dev/null ${HOME}
+	local | "$1" $(pwd) test | "$@" $(pwd) -eu 2>/dev/null
+	local awk | export then printf && done
+	${HOME} echo | ${HOME} cd "$1" test awk export x=1 sed $(pwd) --verbose
+${HOME} 'quoted text' 2>/dev/null
+	local done "$1" cd sed echo cd sed "$1" /usr/bin &&
+	awk test | printf /usr/bin test
+	2>/dev/null 'quoted text' "$1"
+x=1 ${HOME} awk ${HOME} printf done | done cd 'quoted text' -eu sed echo
+'quoted text' --verbose && && "$1" then grep
+		readonly printf /usr/bin grep local awk
+awk test ${HOME} /usr/bin export &&
+	readonly export $(pwd) /usr/bin grep echo cd "$@" | 'quoted text' printf x=1
+printf then /usr/bin $(pwd) readonly printf /usr/bin sed "$@"
+		then "$1" --verbose x=1 awk grep done $(pwd) printf readonly grep -eu done ${HOME}
+done ${HOME} echo done ${HOME} $(pwd) export &&
+		&& "$1" "$1" echo "$@" done 'quoted text' $(pwd) readonly
+	2>/dev/null readonly --verbose
+printf cd 'quoted text' 'quoted text' grep awk 2>/dev/null readonly
+awk "$1" $(pwd) sed awk done $(pwd) "$1" awk $(pwd)
+		/usr/bin ${HOME} && cd cd ${HOME}
+		| readonly --verbose && /usr/bin $(pwd) "$1" "$@" echo -eu /usr/bin echo -eu | $(pwd)
+$(pwd) $(pwd) sed ${HOME} ${HOME} 'quoted text'
+done "$1" export then done cd printf
+	${HOME} -eu && ${HOME} | "$1"
+	test printf ${HOME} grep -eu $(pwd) printf 2>/dev/null
+/usr/bin x=1 sed 'quoted text' test
+/usr/bin printf && done 2>/dev/null "$1" then x=1
+		readonly test && /usr/bin
+		${HOME} "$1" -eu awk readonly done "$@" x=1
+then test printf cd |
+		echo "$1" cd 2>/dev/null ${HOME} 'quoted text' readonly &&
+	test 2>/dev/null echo awk cd ${HOME} "$@" echo x=1 "$@" -eu then export --verbose
+echo printf $(pwd) test local --verbose export cd done /usr/bin
+x=1 ${HOME} local && echo test ${HOME}
+then done && cd readonly awk then |
+| ${HOME} done local /usr/bin "$@"
+		${HOME} sed x=1 awk 'quoted text' printf export -eu $(pwd) printf
+		$(pwd) grep printf local readonly "$@"
+		/usr/bin sed printf printf /usr/bin -eu echo
+grep "$@" $(pwd) grep ${HOME} grep cd printf | echo sed test export cd --verbose
+test local cd -eu /usr/bin cd "$@" local && readonly | $(pwd)
+--verbose "$@" sed 'quoted text' | x=1 then echo && done then
+'quoted text' x=1 local done && /usr/bin
+		test local ${HOME} cd ${HOME}
+done sed ${HOME} local 'quoted text'
+	${HOME} grep echo && printf local awk export 2>/dev/null
+	/usr/bin done export 2>/dev/null "$@"
+		&& readonly "$1" done done then sed -eu
+	"$@" ${HOME} 2>/dev/null export cd /usr/bin
+		x=1 done ${HOME} then --verbose local grep printf 2>/dev/null
+	2>/dev/null printf grep ${HOME} x=1 sed awk --verbose awk printf -eu echo readonly
+	$(pwd) -eu --verbose test 2>/dev/null then
+readonly echo cd "$1" 'quoted text' readonly test "$1" | /usr/bin readonly awk
+test echo local then local
+	test sed x=1 then sed printf "$@" printf | then "$1" $(pwd)
+	export "$1" -eu /usr/bin && ${HOME} | echo cd readonly
+		sed /usr/bin $(pwd) 2>/dev/null "$1" "$1" export --verbose && "$@" && --verbose
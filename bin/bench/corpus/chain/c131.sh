@@ -0,0 +1,2001 @@
+&& -eu $(pwd) -eu $(pwd) cd cd done printf readonly --verbose readonly
+readonly /usr/bin ${HOME} done x=1 ${HOME} export
+	| $(pwd) -eu "$@" awk local 'quoted text'
+		printf cd grep "$1" $(pwd) 2>/dev/null "$1" awk 'quoted text'
+awk --verbose done $(pwd) printf grep echo | done x=1 "$@" sed "$@" grep
+	| ${HOME} $(pwd) done done sed grep cd x=1 grep ${HOME} done "$1" && test awk $(pwd)
+		'quoted text' grep --verbose readonly x=1 ${HOME} test export |
+	&& --verbose sed local awk readonly sed then
+	done /usr/bin x=1 $(pwd) 2>/dev/null
+export local x=1 export "$1" x=1 $(pwd) | &&
+	'quoted text' 'quoted text' readonly /usr/bin readonly --verbose ${HOME} ${HOME}
+test 'quoted text' grep awk x=1 done -eu ${HOME} grep export x=1 | "$1"
+		| | ${HOME} local "$1" done && done sed /usr/bin x=1 local local |
+cd then sed | echo export then awk printf
+		x=1 'quoted text' cd export ${HOME} awk export export
+	printf local grep --verbose awk sed "$1" x=1 export cd done local 'quoted text'
+	-eu "$1" cd export "$@" | -eu printf 'quoted text'
+	test -eu ${HOME} 'quoted text' export echo x=1 "$@" $(pwd)
+	readonly && readonly
+	local export && ${HOME} done /usr/bin then
+		/usr/bin "$1" printf ${HOME}
+		"$@" 'quoted text' x=1 awk ${HOME} /usr/bin export "$1" "$1" sed
+cd x=1 local printf export x=1 local
+x=1 export local then local 2>/dev/null
+		$(pwd) 'quoted text' x=1 /usr/bin --verbose
+	local done | echo 2>/dev/null readonly ${HOME}
+		/usr/bin printf && echo echo cd local readonly x=1 -eu sed cd 2>/dev/null
+	echo -eu 2>/dev/null awk "$1" then 'quoted text' -eu readonly
+		"$1" cd -eu ${HOME} 2>/dev/null
+cd && sed ${HOME} awk export /usr/bin
+	local && -eu x=1 echo test x=1 x=1 ${HOME} -eu /usr/bin
+		/usr/bin | test cd -eu ${HOME} $(pwd) ${HOME} cd grep test local &&
+	test $(pwd) export | 'quoted text' "$1" cd | done
+	grep test 'quoted text' awk cd test 'quoted text' $(pwd) "$@"
+	${HOME} -eu cd ${HOME} "$1" then 'quoted text'
+"$1" "$@" echo done "$1" "$1" && echo /usr/bin
+awk x=1 export /usr/bin
+	--verbose echo --verbose -eu "$1" local echo ${HOME}
+		"$@" 2>/dev/null x=1 $(pwd) done
+		2>/dev/null && && --verbose $(pwd) done && printf awk 'quoted text' export x=1
+		x=1 | x=1 grep && echo echo -eu x=1
+-eu --verbose sed printf test done local | local
+readonly $(pwd) awk echo
+2>/dev/null test export
+	done $(pwd) 2>/dev/null test export
+	$(pwd) echo test /usr/bin "$1" "$1"
+"$1" "$1" then readonly && --verbose readonly x=1 then
+		${HOME} /usr/bin -eu $(pwd) then export cd
+	export 'quoted text' 2>/dev/null sed then -eu then sed -eu x=1 awk |
+		"$1" local grep "$@" then local echo "$@" x=1 "$@" cd "$1" "$@"
+2>/dev/null | 2>/dev/null -eu 2>/dev/null
+		test printf -eu echo ${HOME} export "$@" test && printf export && --verbose
+	done 2>/dev/null sed awk
+	cd "$@" 'quoted text' --verbose awk 2>/dev/null
+echo x=1 local sed x=1 &&
+	test ${HOME} 2>/dev/null 'quoted text' -eu cd
+"$@" 'quoted text' readonly $(pwd) cd awk printf --verbose
+		cd then "$1" grep 'quoted text' export $(pwd) $(pwd) export
+'quoted text' done printf && "$@" $(pwd) ${HOME} "$1" --verbose
+		local readonly local 'quoted text'
+		local then $(pwd) "$@" printf | "$@" x=1 'quoted text' 'quoted text'
+grep grep export /usr/bin ${HOME} | grep x=1 | done
+readonly | 2>/dev/null x=1 cd /usr/bin "$1" 2>/dev/null x=1 --verbose
+	readonly echo /usr/bin echo 2>/dev/null cd sed cd | grep sed
+then echo 'quoted text'
+	grep awk local grep local readonly echo cd sed then export local -eu then 2>/dev/null
+	"$@" -eu export | grep 'quoted text' cd then
+sed "$@" cd ${HOME} sed | local
+		2>/dev/null $(pwd) /usr/bin echo grep
+		'quoted text' && export test export printf readonly local
+| 'quoted text' /usr/bin 2>/dev/null ${HOME} x=1 && "$1" test
+	/usr/bin $(pwd) -eu /usr/bin
+	sed -eu "$1" export $(pwd) cd readonly ${HOME} 2>/dev/null echo $(pwd) echo
+		printf export --verbose export "$1"
+grep "$1" "$@" echo ${HOME} --verbose "$@" local /usr/bin export /usr/bin export
+	export 2>/dev/null x=1
+$(pwd) && $(pwd) ${HOME} then
+	x=1 test 'quoted text' 'quoted text'
+		export | echo /usr/bin x=1 local "$1" "$1" 2>/dev/null done
+local export then cd local /usr/bin $(pwd)
+		${HOME} ${HOME} cd "$@" "$1" sed --verbose ${HOME} /usr/bin cd
+	readonly grep done x=1 $(pwd) export echo
+		export $(pwd) awk sed "$@"
+	"$@" readonly grep --verbose
+readonly /usr/bin done ${HOME}
+readonly -eu --verbose 'quoted text' done sed done cd | grep local /usr/bin
+	sed printf then sed 2>/dev/null export
+		awk --verbose sed export "$@"
+	2>/dev/null printf export 2>/dev/null
+	local sed export | awk sed echo printf printf grep
+	-eu -eu cd printf echo cd grep "$1" x=1 $(pwd) grep local --verbose
+	echo /usr/bin printf | local |
+	printf "$1" grep ${HOME} sed awk $(pwd) done ${HOME} ${HOME}
+	test "$1" "$@" -eu ${HOME} -eu 'quoted text' printf
+	"$@" grep export local printf sed cd test /usr/bin readonly
+	readonly local 2>/dev/null echo sed local done /usr/bin x=1 -eu "$1"
+		x=1 2>/dev/null x=1 echo grep -eu awk echo sed ${HOME}
+	local readonly done grep done awk readonly
+	readonly && && echo grep grep cd && grep ${HOME}
+"$1" awk printf -eu printf | export $(pwd) test export local 'quoted text'
+"$1" readonly awk local && grep sed then then readonly test local
+	readonly cd -eu | 'quoted text'
+		done x=1 readonly --verbose | grep
+		printf -eu printf sed echo "$1" "$@" | echo export ${HOME} local grep 'quoted text'
+		'quoted text' 'quoted text' /usr/bin -eu then echo then readonly
+		"$@" then "$@" -eu grep cd grep readonly echo 2>/dev/null sed sed
+	echo done "$@" "$1" export export echo "$1" ${HOME}
+readonly readonly && ${HOME} done cd ${HOME} $(pwd) 'quoted text'
+	readonly | awk "$@" "$1" ${HOME} /usr/bin $(pwd) export
+awk /usr/bin ${HOME} x=1 2>/dev/null
+	"$1" local /usr/bin --verbose readonly echo then local /usr/bin
+--verbose grep then awk echo /usr/bin export "$1" /usr/bin
+	$(pwd) /usr/bin grep /usr/bin --verbose export
+	$(pwd) /usr/bin readonly --verbose cd test
+	"$@" sed cd --verbose ${HOME} $(pwd) "$1" done awk --verbose cd test
+	grep x=1 && sed /usr/bin grep export
+		awk /usr/bin sed then test
+x=1 cd cd /usr/bin test /usr/bin 2>/dev/null "$@" sed done $(pwd)
+test /usr/bin readonly "$@" sed done
+grep echo 2>/dev/null export grep then 'quoted text'
+--verbose export export export 'quoted text'
+	-eu local grep /usr/bin $(pwd)
+	sed cd readonly ${HOME} then
+"$@" sed printf x=1 $(pwd) readonly $(pwd) 'quoted text'
+	"$1" $(pwd) | /usr/bin -eu -eu
+	readonly "$1" then cd readonly echo sed then | /usr/bin "$@"
+		sed readonly awk /usr/bin then ${HOME} then ${HOME} 2>/dev/null
+	grep ${HOME} 2>/dev/null done | && 'quoted text'
+		grep "$1" x=1 echo /usr/bin -eu ${HOME} sed grep --verbose
+	local echo test | done printf local && sed
+		| done $(pwd) then "$@" -eu test "$@" /usr/bin
+export 'quoted text' echo readonly /usr/bin local /usr/bin 2>/dev/null done
+		then | 2>/dev/null && 2>/dev/null $(pwd) local grep 2>/dev/null
+	'quoted text' x=1 'quoted text' echo 2>/dev/null export "$@" x=1 local
+	printf readonly then then | local 'quoted text' ${HOME}
+	x=1 then 2>/dev/null test then done cd readonly local
+	cd local "$@" local test local "$@" export $(pwd) && 'quoted text'
+cd /usr/bin then $(pwd) x=1 && cd done --verbose
+	readonly | "$1" printf /usr/bin $(pwd)
+	readonly 'quoted text' | awk /usr/bin 2>/dev/null
+	awk $(pwd) echo "$1" --verbose test cd export && export "$1"
+"$@" export --verbose awk printf "$1" && "$1" cd printf "$@" 'quoted text'
+		2>/dev/null then /usr/bin ${HOME} awk $(pwd) x=1 export
+		x=1 | printf x=1 test cd local --verbose cd 'quoted text' then "$@" 2>/dev/null
+		&& $(pwd) echo 'quoted text'
+grep 2>/dev/null readonly done x=1 readonly local "$@" ${HOME}
+then readonly x=1 -eu export "$@" 'quoted text' /usr/bin
+	sed export grep ${HOME} sed /usr/bin done printf done awk "$1"
+		/usr/bin cd $(pwd) then readonly
+$(pwd) awk -eu then --verbose "$@" x=1 && then sed test && test $(pwd)
+	printf export printf 2>/dev/null
+		| then local $(pwd) local grep -eu test echo grep awk "$@" "$1" grep ${HOME}
+		2>/dev/null printf 2>/dev/null "$@" then x=1 && | local printf printf then grep
+	'quoted text' printf sed && local
+		printf echo sed export $(pwd) 'quoted text' "$1" 'quoted text' sed "$1" awk
+	x=1 test --verbose "$1" done readonly && echo "$1" 'quoted text'
+	test cd grep /usr/bin export test echo grep awk $(pwd) done
+		-eu $(pwd) awk | echo local then done ${HOME} | local echo | printf ${HOME}
+	| sed -eu done export | echo echo $(pwd) done x=1 "$@"
+${HOME} --verbose 'quoted text' done $(pwd) sed printf
+	echo printf "$1" "$@" "$@" "$@" local && test cd x=1 -eu readonly
+	"$1" echo awk grep grep && test awk test "$@" x=1 x=1
+${HOME} $(pwd) | x=1 ${HOME} ${HOME} awk awk --verbose "$1" grep "$@" sed grep
+		"$@" $(pwd) export printf
+		| 2>/dev/null cd && /usr/bin test ${HOME} -eu sed
+export local x=1 $(pwd) | 'quoted text' sed readonly "$1" test -eu
+	cd done x=1 ${HOME} done 2>/dev/null /usr/bin echo test local
+	x=1 readonly x=1 cd sed grep echo then 'quoted text'
+		/usr/bin $(pwd) "$@" 'quoted text' "$@"
+${HOME} then /usr/bin awk
+	export 2>/dev/null $(pwd) x=1 awk then local
+		then --verbose ${HOME}
+$(pwd) $(pwd) --verbose "$@" export && x=1 $(pwd) awk
+		done then ${HOME} | sed | "$@" /usr/bin $(pwd) echo test echo /usr/bin cd /usr/bin
+	printf grep ${HOME} --verbose readonly export 2>/dev/null
+	'quoted text' local done
+/usr/bin awk cd "$1" ${HOME}
+		readonly "$@" /usr/bin "$@" --verbose
+	"$@" ${HOME} local "$@" export
+	/usr/bin -eu && echo 2>/dev/null -eu $(pwd) --verbose ${HOME} 'quoted text'
+grep x=1 cd local -eu ${HOME} -eu then grep grep --verbose
+	| awk 'quoted text' /usr/bin
+		printf local $(pwd) x=1 "$@" then sed
+'quoted text' 2>/dev/null "$@" 2>/dev/null 'quoted text'
+	${HOME} cd local "$1" && grep test sed --verbose x=1 printf 2>/dev/null -eu
+		/usr/bin readonly "$1" 'quoted text' printf
+2>/dev/null printf && 2>/dev/null sed 'quoted text'
+${HOME} cd --verbose --verbose x=1 'quoted text' done grep x=1 x=1 2>/dev/null
+		--verbose test echo test readonly x=1
+		test $(pwd) test readonly printf
+"$@" ${HOME} echo awk "$1" 2>/dev/null local
+		-eu /usr/bin "$@" then --verbose readonly -eu "$1" test then "$@" "$@" | ${HOME}
+		echo x=1 export readonly x=1 --verbose $(pwd) done test
+		'quoted text' sed /usr/bin
+	"$1" $(pwd) awk 2>/dev/null readonly x=1 awk echo
+| 'quoted text' -eu --verbose
+	| --verbose ${HOME} cd done ${HOME}
+		"$1" && ${HOME} ${HOME} cd printf ${HOME} $(pwd)
+	--verbose /usr/bin export -eu local
+		'quoted text' $(pwd) awk echo 'quoted text' && "$1"
+	'quoted text' printf | export 2>/dev/null 2>/dev/null x=1
+		$(pwd) then then x=1 done awk then x=1 awk cd 'quoted text'
+awk | | then grep export 2>/dev/null | --verbose readonly test export awk $(pwd)
+| echo export echo done test sed ${HOME} printf printf grep "$@" readonly
+	"$@" done && -eu | /usr/bin cd 'quoted text' test export readonly done local 'quoted text'
+	cd -eu test | local -eu echo "$1" cd && local -eu ${HOME}
+readonly sed done test cd
+		/usr/bin echo test grep "$1" done
+readonly && | 'quoted text'
+		then export readonly "$1" cd x=1 export local cd /usr/bin
+		grep -eu && test 2>/dev/null "$1" -eu sed then then && -eu sed && readonly "$1"
+		$(pwd) --verbose $(pwd) done echo -eu "$1" readonly /usr/bin
+done cd awk --verbose --verbose sed && | && 2>/dev/null
+2>/dev/null ${HOME} done x=1 2>/dev/null awk ${HOME} grep
+	grep 'quoted text' ${HOME} done local
+/usr/bin sed $(pwd) local "$@" printf local awk echo ${HOME} /usr/bin test
+echo 'quoted text' printf -eu && --verbose test sed $(pwd) awk "$@"
+	-eu "$1" 2>/dev/null | /usr/bin -eu ${HOME} grep cd local done x=1 --verbose &&
+	then readonly /usr/bin echo printf sed local && awk 'quoted text'
+	${HOME} done done local 'quoted text' sed &&
+-eu done grep cd /usr/bin
+'quoted text' && -eu local 2>/dev/null cd done readonly printf
+	--verbose done echo "$@" /usr/bin printf ${HOME} readonly
+-eu 'quoted text' readonly
+	| echo 2>/dev/null &&
+	done printf awk x=1 /usr/bin "$@" --verbose grep --verbose 2>/dev/null
+		${HOME} grep "$1" | local 2>/dev/null && echo printf |
+	cd "$1" x=1 -eu 2>/dev/null printf awk $(pwd) export test grep
+		awk readonly "$1" local local /usr/bin sed printf sed local --verbose x=1 -eu export
+	cd "$@" x=1 awk echo -eu test ${HOME} printf "$@"
+echo printf export /usr/bin -eu cd
+${HOME} /usr/bin | 'quoted text'
+/usr/bin cd --verbose "$1" echo awk grep --verbose x=1 --verbose 'quoted text'
+--verbose -eu awk done "$@"
+local printf test grep ${HOME} ${HOME} cd x=1 $(pwd) sed "$1" $(pwd) -eu 2>/dev/null
+		test readonly done readonly 'quoted text' sed 'quoted text' cd ${HOME}
+	&& --verbose awk -eu | /usr/bin /usr/bin
+		printf test grep -eu && && export echo "$1" echo sed --verbose
+echo ${HOME} echo awk "$@" echo /usr/bin "$@" "$@"
+	export | 2>/dev/null x=1 "$@" 'quoted text' 'quoted text'
+		${HOME} 2>/dev/null test
+		"$@" sed readonly sed test -eu ${HOME} then && ${HOME} $(pwd) readonly
+local "$1" then ${HOME} ${HOME}
+| done x=1 readonly 'quoted text' ${HOME} 2>/dev/null x=1 && echo
+done grep local readonly 'quoted text' awk
+		x=1 'quoted text' cd test $(pwd) export test echo | echo -eu export
+test then local && 2>/dev/null /usr/bin then awk sed && test x=1 then
+&& x=1 $(pwd) local awk -eu -eu local done
+	cd && sed test sed /usr/bin "$1" | grep "$1"
+	x=1 | export --verbose cd --verbose grep "$1" && local cd --verbose
+	--verbose && test $(pwd) printf 'quoted text'
+'quoted text' echo awk export x=1 'quoted text' export
+test awk && | ${HOME} | done printf -eu cd readonly -eu -eu
+		done | && local $(pwd) x=1 local done readonly 'quoted text'
+		printf done export grep sed awk ${HOME} -eu grep $(pwd) printf "$1" | test 2>/dev/null
+'quoted text' local readonly /usr/bin cd x=1 2>/dev/null test
+	export ${HOME} --verbose -eu
+"$@" $(pwd) --verbose
+export | done printf ${HOME} "$@" awk 2>/dev/null 2>/dev/null test echo printf
+		awk --verbose local grep $(pwd) done grep /usr/bin done --verbose then 2>/dev/null
+then "$1" cd --verbose /usr/bin | local
+	$(pwd) export printf local awk done x=1 readonly "$1" -eu cd -eu 'quoted text'
+	test grep test awk done sed "$1" grep | test /usr/bin sed awk x=1 local ${HOME}
+$(pwd) sed 'quoted text' then ${HOME}
+echo printf readonly | $(pwd) local --verbose x=1 awk printf test
+	sed awk test && awk local sed --verbose | | 'quoted text'
+		"$1" done test local 'quoted text' local "$@" done cd "$1" -eu -eu -eu
+		| /usr/bin && printf echo echo 'quoted text' test done
+done "$1" then x=1 && 'quoted text' "$@" awk test && ${HOME}
+	$(pwd) ${HOME} awk echo -eu -eu "$1" export local --verbose
+done grep && echo 'quoted text' done "$1" $(pwd) -eu
+	then "$@" export printf echo export echo | test grep done cd 'quoted text' 'quoted text'
+--verbose ${HOME} | /usr/bin "$1" 2>/dev/null printf readonly
+	-eu awk 2>/dev/null --verbose
+cd "$1" | 2>/dev/null
+		-eu | readonly then grep --verbose
+	done awk | done printf -eu done && | echo grep grep test local awk && test local
+		grep x=1 export "$@" readonly then sed test grep ${HOME}
+		awk ${HOME} sed then ${HOME} 'quoted text' sed local --verbose
+	export echo cd | ${HOME} 2>/dev/null ${HOME} local
+		--verbose /usr/bin 'quoted text' --verbose export printf -eu sed then cd sed
+	"$1" local "$1" export $(pwd) $(pwd) $(pwd)
+		-eu local | /usr/bin echo x=1 ${HOME} 'quoted text'
+	-eu printf done && echo cd sed local
+	$(pwd) /usr/bin --verbose $(pwd) echo cd 2>/dev/null 'quoted text'
+	2>/dev/null "$1" "$1" test ${HOME} echo /usr/bin printf
+		/usr/bin test x=1 done --verbose 2>/dev/null
+2>/dev/null then $(pwd) $(pwd) --verbose --verbose | $(pwd) printf $(pwd)
+		printf grep local --verbose echo
+${HOME} sed done grep done grep readonly && test 'quoted text'
+		| printf x=1 --verbose /usr/bin
+	x=1 "$1" local -eu done test sed && "$1" ${HOME}
+		--verbose export local readonly local readonly
+awk export done ${HOME} test
+"$@" echo "$@" cd /usr/bin readonly
+		${HOME} echo readonly readonly export test sed ${HOME} x=1 && ${HOME}
+local "$1" awk local --verbose then 2>/dev/null
+		${HOME} awk x=1 'quoted text' --verbose 2>/dev/null $(pwd)
+		"$1" $(pwd) done ${HOME} --verbose readonly ${HOME} "$1" grep test awk && | echo
+'quoted text' then local done
+$(pwd) -eu awk "$@" | echo printf test 2>/dev/null /usr/bin export
+		--verbose "$@" "$1" ${HOME} x=1 echo test local export grep echo
+-eu && "$1" printf $(pwd) cd echo local local then
+		local readonly 2>/dev/null && local "$1" echo awk 'quoted text' local grep printf
+	export "$1" local sed $(pwd) printf ${HOME} $(pwd) /usr/bin
+		"$1" readonly "$1" && sed
+		readonly cd 2>/dev/null "$1" && |
+	'quoted text' /usr/bin && local "$@" 'quoted text' /usr/bin
+		2>/dev/null $(pwd) awk && | export
+	--verbose 'quoted text' printf sed cd && "$1" readonly "$1"
+	test done --verbose -eu 'quoted text' awk --verbose --verbose
+		readonly --verbose 'quoted text' test --verbose
+local local | /usr/bin x=1 test echo then
+	done then then x=1 'quoted text' awk done "$1" && local printf $(pwd) awk "$1"
+echo x=1 test | sed "$@" local "$@" printf readonly "$@" "$@"
+echo 2>/dev/null cd grep /usr/bin
+	${HOME} | printf /usr/bin local sed x=1 echo
+	2>/dev/null echo then | echo x=1
+		${HOME} readonly x=1 awk cd 2>/dev/null -eu
+	-eu --verbose then ${HOME} "$@" readonly done 2>/dev/null "$1" awk sed awk -eu
+local 2>/dev/null then done && done printf -eu then echo then grep grep ${HOME}
+	sed | echo then --verbose echo /usr/bin awk grep --verbose grep printf awk
+		| echo cd local --verbose "$@" local readonly ${HOME} && 'quoted text' "$1" &&
+		then then && done "$@" test done
+${HOME} done grep | "$@" ${HOME} -eu /usr/bin x=1 cd test --verbose
+		'quoted text' 2>/dev/null echo awk readonly then && grep "$@" awk -eu
+| | x=1 then "$1" test && printf x=1 test "$@" --verbose grep 2>/dev/null
+export 2>/dev/null awk grep cd ${HOME} | | awk /usr/bin test /usr/bin export
+	"$@" --verbose local local
+		'quoted text' awk done done test test echo 2>/dev/null readonly "$@" grep "$@"
+	-eu 2>/dev/null local sed
+	--verbose ${HOME} sed echo test sed "$@" 2>/dev/null
+	echo printf /usr/bin -eu -eu 2>/dev/null
+done grep ${HOME} "$@" readonly | test
+	test readonly "$1" readonly then "$@" test done --verbose $(pwd) echo "$1" ${HOME}
+	'quoted text' printf cd export "$1" && sed ${HOME} "$1" "$@" "$@"
+	${HOME} ${HOME} 'quoted text'
+echo | -eu local sed readonly "$1" "$@" test --verbose
+		&& awk -eu sed /usr/bin x=1 x=1 x=1 sed x=1 &&
+	&& done x=1 | "$1" cd
+		/usr/bin export local readonly --verbose sed -eu
+export ${HOME} printf then -eu done readonly x=1 cd "$1" sed local --verbose echo
+	${HOME} x=1 --verbose readonly ${HOME} ${HOME} cd test local echo x=1
+--verbose test cd grep -eu grep test readonly then done echo -eu --verbose
+echo test echo ${HOME} export sed printf x=1 "$1" /usr/bin
+		export ${HOME} readonly test 'quoted text' --verbose printf x=1
+	local "$1" 2>/dev/null 'quoted text'
+"$@" printf printf "$1" cd then grep awk local 'quoted text' && test /usr/bin
+	echo 2>/dev/null local /usr/bin grep test --verbose 2>/dev/null readonly
+	--verbose then grep 2>/dev/null x=1 awk readonly
+$(pwd) printf ${HOME} test --verbose cd awk 2>/dev/null | "$1" "$@" test "$@" export
+	local /usr/bin readonly --verbose sed 2>/dev/null awk $(pwd)
+	${HOME} --verbose 'quoted text' echo printf test awk printf $(pwd) "$1" 2>/dev/null
+"$1" readonly 'quoted text' printf local awk "$1" test "$@" export
+	export sed done grep | awk "$1" awk then $(pwd) echo export echo --verbose
+	$(pwd) grep "$1" --verbose local sed "$1" printf test ${HOME}
+	/usr/bin awk $(pwd) $(pwd) | /usr/bin readonly done awk /usr/bin cd readonly
+	--verbose /usr/bin awk awk x=1 "$1" then -eu "$1" readonly
+done /usr/bin echo printf | printf | "$@" test export printf
+	"$@" local ${HOME} 2>/dev/null && then | local
+		then 2>/dev/null $(pwd) awk "$1" export 2>/dev/null export
+	printf $(pwd) readonly | readonly
+		--verbose readonly cd 'quoted text'
+		export cd && cd | cd $(pwd) then x=1 local
+	x=1 /usr/bin done "$@" ${HOME}
+then ${HOME} cd 'quoted text' /usr/bin readonly
+cd local | test --verbose 2>/dev/null x=1 grep
+		export export ${HOME} cd export 'quoted text' | grep cd
+test -eu 'quoted text' done echo printf readonly | /usr/bin local
+		x=1 -eu echo | -eu && done sed 'quoted text'
+readonly local awk test x=1 sed readonly
+		local --verbose $(pwd) cd then -eu export cd --verbose $(pwd) ${HOME}
+${HOME} grep done 'quoted text'
+	sed then && --verbose cd 'quoted text' /usr/bin "$@" readonly
+		local | export sed test /usr/bin then printf && x=1 grep && ${HOME}
+sed local local -eu then test "$1" sed 2>/dev/null test
+		readonly cd ${HOME} $(pwd) printf awk -eu x=1
+		-eu "$@" --verbose | echo && printf test grep $(pwd) awk then grep $(pwd) && then
+		printf x=1 sed "$@" $(pwd) "$1" 2>/dev/null cd awk done readonly 'quoted text'
+	awk | done $(pwd) --verbose printf
+	test --verbose "$@" x=1 sed done && $(pwd) export awk readonly readonly
+	sed && test 'quoted text' export ${HOME} $(pwd) $(pwd) readonly cd
+	awk echo readonly export && 'quoted text' done /usr/bin
+		"$1" done echo echo /usr/bin sed $(pwd) && then
+	/usr/bin then && done local "$1" test sed export printf
+	'quoted text' --verbose | done 2>/dev/null awk && sed ${HOME}
+		x=1 sed readonly 2>/dev/null awk
+	test awk test "$@" readonly
+	2>/dev/null --verbose grep -eu sed
+		'quoted text' echo local cd --verbose readonly | "$@" local
+		cd | cd 'quoted text' "$@" &&
+cd readonly $(pwd) readonly done echo x=1 2>/dev/null --verbose --verbose
+$(pwd) local export sed $(pwd) awk sed echo
+grep done cd local x=1 cd awk then export ${HOME} x=1 --verbose
+	sed $(pwd) then $(pwd) 'quoted text' echo 'quoted text' sed /usr/bin readonly
+done x=1 then x=1 sed /usr/bin readonly
+echo readonly local cd $(pwd) readonly echo x=1 readonly --verbose
+readonly readonly --verbose "$1" then
+	--verbose && export x=1 /usr/bin readonly -eu 'quoted text' then ${HOME}
+-eu done grep test /usr/bin echo && readonly --verbose $(pwd) | "$@"
+done grep echo --verbose
+		-eu ${HOME} export ${HOME} export then grep -eu cd cd /usr/bin
+	readonly /usr/bin $(pwd) export -eu awk | "$1"
+		--verbose echo local "$1" grep
+local grep "$@" ${HOME} -eu && /usr/bin | && done
+	grep printf 2>/dev/null "$@" /usr/bin x=1 && 2>/dev/null &&
+		local grep "$1" -eu printf | printf local grep 2>/dev/null local readonly awk
+	grep cd | $(pwd) 'quoted text' local
+'quoted text' local echo
+awk ${HOME} then awk ${HOME}
+		"$1" readonly awk 'quoted text' printf
+	export "$@" && sed test x=1 readonly then
+-eu $(pwd) ${HOME} /usr/bin done export "$@" export awk done 'quoted text'
+		then export echo ${HOME}
+export 2>/dev/null x=1 echo printf done
+		local printf $(pwd) && then | -eu
+		then awk /usr/bin local --verbose x=1 sed 2>/dev/null local sed done x=1
+'quoted text' test --verbose /usr/bin -eu --verbose cd local grep 2>/dev/null
+	readonly readonly readonly "$@" local ${HOME} x=1 -eu
+		-eu then done done $(pwd)
+	| ${HOME} printf "$@" /usr/bin cd awk x=1 "$@" "$@" ${HOME} readonly
+printf $(pwd) readonly awk -eu -eu printf grep cd
+		"$1" then sed --verbose 2>/dev/null grep done 2>/dev/null
+echo cd "$1" "$@" x=1 x=1 test "$1" local grep ${HOME}
+	--verbose then 'quoted text' /usr/bin done printf export
+	export test sed ${HOME} readonly done local 'quoted text'
+then /usr/bin x=1 2>/dev/null /usr/bin echo $(pwd) --verbose printf
+	-eu test sed ${HOME} test readonly awk local
+	"$1" --verbose awk readonly $(pwd) ${HOME} 2>/dev/null
+export readonly $(pwd) grep cd readonly test printf printf
+export && then "$1" awk "$@" export readonly cd grep readonly readonly
+	/usr/bin 2>/dev/null then 'quoted text' $(pwd) "$@" export grep /usr/bin
+		| $(pwd) "$@" sed | --verbose done 2>/dev/null --verbose --verbose /usr/bin
+test 2>/dev/null grep "$@" "$1" export echo echo then sed x=1 -eu local
+	export grep 'quoted text' cd "$1" then 'quoted text' "$1" done test awk
+readonly local 2>/dev/null -eu "$@" && sed sed 'quoted text'
+&& test done --verbose grep -eu readonly x=1 test test 'quoted text'
+local "$1" sed sed cd "$1" done 'quoted text'
+then "$1" done awk printf awk done "$1" x=1 printf
+	${HOME} && sed "$@" /usr/bin
+		local awk "$@" | "$@" readonly x=1
+		then && awk | then done printf
+	"$@" x=1 'quoted text' $(pwd) printf 'quoted text'
+	2>/dev/null /usr/bin sed export ${HOME} 'quoted text'
+		"$1" "$@" printf $(pwd) $(pwd) | grep export $(pwd) export awk grep -eu echo export
+	awk grep cd local export ${HOME}
+	2>/dev/null "$1" readonly awk
+	test test done --verbose done 'quoted text' 2>/dev/null
+	done local --verbose ${HOME} x=1 test cd readonly 'quoted text' ${HOME}
+	/usr/bin export cd export local sed then local
+	grep local && x=1 test "$1" cd $(pwd) awk --verbose -eu ${HOME} "$1" "$1"
+	--verbose /usr/bin "$@" printf done ${HOME} |
+	sed 2>/dev/null cd local test "$1" "$@" done x=1 --verbose
+'quoted text' cd then local | sed 'quoted text' grep -eu echo then $(pwd) x=1
+	grep ${HOME} export $(pwd) | done ${HOME} -eu export awk ${HOME} grep | awk
+	echo 'quoted text' readonly ${HOME} -eu awk
+	&& "$1" done "$1" && echo cd 'quoted text' readonly /usr/bin "$1" "$@"
+export ${HOME} $(pwd) && "$@" ${HOME} grep /usr/bin | printf
+echo 'quoted text' -eu -eu grep readonly
+		$(pwd) $(pwd) readonly printf sed sed -eu done
+	export then && done test "$@"
+then $(pwd) local -eu "$1" readonly "$@" done ${HOME} && sed -eu
+		export readonly 2>/dev/null awk 'quoted text' done 2>/dev/null
+		done then x=1 test $(pwd) awk "$1" -eu x=1 awk readonly sed "$1"
+	| export readonly printf echo local -eu printf "$@"
+	"$1" "$1" awk echo cd grep 2>/dev/null "$1" | && && -eu export 'quoted text'
+		done done "$@" printf --verbose $(pwd) "$@" 'quoted text'
+export 'quoted text' | 'quoted text'
+		grep sed x=1 readonly cd "$1" "$1" 'quoted text' export "$1" test
+then then | "$@" | ${HOME} ${HOME} readonly export "$@" echo
+test --verbose ${HOME} | local
+		readonly -eu test export cd sed
+		printf readonly | cd readonly
+	done "$@" export sed cd 2>/dev/null $(pwd) cd awk 2>/dev/null echo "$@" "$1" test
+	/usr/bin "$@" cd $(pwd) -eu 'quoted text' -eu
+${HOME} printf grep local /usr/bin then
+		sed printf "$@" then sed export && $(pwd)
+	export "$1" ${HOME} "$1"
+		printf sed awk $(pwd) "$@" ${HOME} $(pwd)
+	'quoted text' local "$1" /usr/bin "$1" 2>/dev/null sed x=1 readonly
+		$(pwd) cd local 2>/dev/null then $(pwd) sed ${HOME} awk echo
+'quoted text' $(pwd) sed test
+	awk cd $(pwd) cd local --verbose "$1" grep 2>/dev/null ${HOME} $(pwd) awk
+readonly -eu done && awk && readonly
+		-eu | -eu "$1" | "$1" local --verbose export awk sed | -eu && x=1
+	grep "$@" --verbose awk --verbose $(pwd)
+	export -eu printf $(pwd) done --verbose $(pwd) test readonly && cd /usr/bin readonly
+	--verbose x=1 then /usr/bin
+		-eu done /usr/bin "$@" local 'quoted text'
+x=1 "$@" awk test cd 'quoted text'
+		done $(pwd) 'quoted text' -eu -eu then | readonly echo printf 'quoted text'
+		printf grep | /usr/bin && --verbose
+		export readonly grep done --verbose ${HOME} cd then local /usr/bin local 2>/dev/null
+		${HOME} test 2>/dev/null -eu local awk awk grep 2>/dev/null --verbose
+	awk echo "$1" done 2>/dev/null sed --verbose 2>/dev/null
+--verbose $(pwd) echo
+| 'quoted text' | readonly $(pwd) ${HOME} | "$1" cd echo readonly
+	sed "$1" done "$1" "$1" export grep 2>/dev/null | /usr/bin $(pwd)
+	cd printf grep | | grep
+		x=1 done printf export "$@" | grep $(pwd) x=1
+'quoted text' local "$@" "$1" printf $(pwd) cd
+--verbose "$@" ${HOME} -eu | 'quoted text'
+local grep printf --verbose then /usr/bin test local
+	"$@" local echo 'quoted text' then
+	echo $(pwd) && "$1" -eu test readonly done $(pwd) ${HOME}
+test then -eu "$1" "$@" 2>/dev/null readonly x=1 -eu | --verbose
+local awk cd x=1 printf -eu -eu readonly
+$(pwd) x=1 local sed ${HOME} awk | "$1" | $(pwd) --verbose echo printf 'quoted text'
+	awk 2>/dev/null 'quoted text' local ${HOME} done cd
+awk sed test printf sed 2>/dev/null done printf
+| done then echo readonly x=1 cd "$@"
+test cd /usr/bin printf printf
+		cd done done && | | -eu done 2>/dev/null
+		printf "$@" readonly --verbose sed "$@" x=1 cd cd echo $(pwd) grep | | "$@"
+	readonly 2>/dev/null readonly $(pwd)
+export x=1 cd printf echo sed done /usr/bin /usr/bin --verbose --verbose
+		grep 'quoted text' echo local -eu echo
+		/usr/bin then ${HOME} -eu |
+${HOME} export -eu sed
+	test sed "$1" sed then echo local export 'quoted text' readonly /usr/bin
+'quoted text' && ${HOME} awk readonly printf printf | $(pwd)
+/usr/bin local readonly readonly x=1 && 2>/dev/null 2>/dev/null readonly test $(pwd)
+		&& local --verbose | 'quoted text' "$1" "$@" && readonly && x=1 2>/dev/null
+	/usr/bin echo | "$1" printf
+	local export | awk 'quoted text' /usr/bin
+"$1" then grep export done readonly grep cd -eu sed "$@" local
+		-eu | cd 'quoted text' "$@" 'quoted text' ${HOME} awk
+'quoted text' $(pwd) export x=1 test && export -eu printf &&
+		--verbose done local 2>/dev/null "$1" 2>/dev/null grep export ${HOME}
+local local "$@" readonly
+		2>/dev/null "$1" readonly echo sed $(pwd) x=1 $(pwd) ${HOME}
+${HOME} "$1" -eu grep export --verbose cd $(pwd)
+	echo /usr/bin test $(pwd) readonly
+		test "$@" grep 2>/dev/null 'quoted text' then then 'quoted text'
+		done | grep "$@" x=1 done | x=1 "$1" readonly 2>/dev/null 2>/dev/null
+	'quoted text' && /usr/bin | done $(pwd) x=1 | then --verbose
+cd /usr/bin grep "$1" 'quoted text' $(pwd) done cd && "$@" 'quoted text'
+		grep local | cd local -eu then awk 'quoted text'
+		test $(pwd) 'quoted text'
+		| -eu awk printf "$1" local $(pwd)
+		'quoted text' printf $(pwd)
+		--verbose grep export /usr/bin 2>/dev/null x=1
+		&& readonly 2>/dev/null test "$@" -eu -eu | then | sed awk then export then
+	grep "$@" echo export printf local then test -eu 2>/dev/null $(pwd) export cd sed
+		-eu x=1 done test && local
+	"$@" awk echo awk export 'quoted text' -eu
+2>/dev/null local "$@" &&
+	then printf readonly then && 'quoted text' readonly then
+sed echo awk test awk ${HOME} then done then awk
+'quoted text' ${HOME} ${HOME} cd 2>/dev/null
+		grep export --verbose /usr/bin awk ${HOME} sed && "$1" /usr/bin then printf grep
+$(pwd) sed x=1 local ${HOME}
+		2>/dev/null | | test printf $(pwd) echo grep printf test -eu cd x=1 printf
+		echo export cd local local printf readonly then test awk
+	-eu && local done "$1" $(pwd) export
+local done x=1 echo x=1 /usr/bin
+--verbose test 'quoted text' --verbose then | sed test $(pwd)
+		test export x=1 grep x=1 "$1" "$1"
+--verbose | readonly /usr/bin test x=1 "$1"
+	readonly 'quoted text' readonly /usr/bin echo
+		awk cd local --verbose local 'quoted text' "$1" 'quoted text'
+2>/dev/null export grep cd 2>/dev/null done sed "$1" echo
+		echo 'quoted text' printf 2>/dev/null 2>/dev/null $(pwd)
+${HOME} echo test sed && | echo -eu local | 'quoted text'
+	then /usr/bin export && --verbose
+	local local -eu export printf
+		grep readonly cd awk done test ${HOME} --verbose
+		test /usr/bin 'quoted text' done cd awk "$@" cd 'quoted text' sed
+		grep awk $(pwd) export
+		${HOME} cd printf x=1 --verbose printf | done sed "$1" sed local | "$1" 'quoted text'
+		2>/dev/null cd echo printf 'quoted text'
+export echo $(pwd) readonly /usr/bin
+	export awk /usr/bin readonly local 2>/dev/null
+printf "$@" grep $(pwd) printf printf 'quoted text'
+		local done then "$1" grep -eu "$1" readonly
+$(pwd) /usr/bin export "$@" -eu sed | 'quoted text' ${HOME} "$@"
+&& x=1 'quoted text' test readonly
+| done cd cd $(pwd) x=1 -eu -eu --verbose
+cd export readonly "$1" test done test "$@" "$1" "$@" -eu $(pwd)
+	cd awk $(pwd) awk local printf readonly
+	grep then "$1" awk then ${HOME} --verbose "$1" readonly done
+		export printf --verbose /usr/bin && && done && "$@" sed done
+test local 2>/dev/null
+	cd | --verbose sed then export x=1 done awk test
+$(pwd) done done local test | awk
+	local sed sed cd then /usr/bin "$1" "$1" ${HOME} readonly readonly
+	'quoted text' grep 'quoted text' cd 2>/dev/null
+test echo | readonly export /usr/bin grep ${HOME} echo
+		-eu export /usr/bin cd sed && x=1 local -eu echo readonly ${HOME} $(pwd)
+		2>/dev/null "$@" $(pwd) readonly local --verbose "$1" /usr/bin readonly
+--verbose awk --verbose "$1" -eu test "$@" 'quoted text'
+		x=1 echo then 'quoted text' printf 'quoted text' readonly grep -eu | "$@"
+$(pwd) readonly x=1 export && && printf --verbose test printf "$1"
+	done x=1 x=1 /usr/bin
+	${HOME} echo -eu then export local x=1 -eu readonly $(pwd) -eu
+"$1" grep local $(pwd) test cd export echo export then sed
+	${HOME} done then export printf $(pwd) | printf
+test then --verbose ${HOME}
+printf && local x=1 printf /usr/bin readonly grep readonly
+		export readonly | export sed /usr/bin "$1" x=1
+	2>/dev/null printf readonly local
+		$(pwd) test x=1 ${HOME} "$@" | export --verbose test
+		cd && 2>/dev/null awk
+		| then 'quoted text' printf readonly
+| --verbose then test awk "$@" printf 'quoted text'
+readonly | echo --verbose "$1" readonly | 2>/dev/null
+		export then awk | local then "$1" "$@" test cd --verbose /usr/bin x=1 done readonly
+	--verbose local readonly --verbose
+	echo 'quoted text' $(pwd) export /usr/bin grep ${HOME} done 2>/dev/null
+'quoted text' ${HOME} /usr/bin && "$1" export x=1 x=1 "$@" echo 2>/dev/null
+		${HOME} echo readonly /usr/bin 2>/dev/null
+		sed | ${HOME} export readonly export 'quoted text' grep x=1 test
+sed 'quoted text' $(pwd) $(pwd) /usr/bin then "$1" "$@"
+	${HOME} done "$@" ${HOME}
+test 'quoted text' && test grep awk $(pwd) -eu awk "$@"
+		$(pwd) $(pwd) sed readonly 'quoted text' "$1" ${HOME}
+--verbose local 2>/dev/null x=1 /usr/bin 'quoted text' x=1 printf 2>/dev/null
+	test -eu x=1 awk && echo sed
+$(pwd) done cd sed cd "$1" local -eu done readonly
+		export -eu | $(pwd) then $(pwd) readonly "$@"
+	awk sed echo ${HOME} test | awk export && x=1 local
+| "$1" "$1" $(pwd) echo local
+		grep 2>/dev/null readonly sed ${HOME} export 'quoted text'
+cd echo --verbose --verbose x=1 "$1"
+	printf "$@" && local readonly test echo && local && echo -eu grep
+awk export ${HOME} export
+		printf grep test -eu "$1" && "$1" awk "$1" -eu readonly -eu 2>/dev/null |
+-eu 'quoted text' --verbose -eu echo --verbose --verbose
+		export printf --verbose x=1 && -eu test echo $(pwd) "$1" | "$1" grep
+-eu && export sed 2>/dev/null ${HOME} | awk | -eu then grep local grep
+		awk /usr/bin grep "$@" cd readonly --verbose 2>/dev/null
+		"$1" awk test echo done /usr/bin local awk
+		local then | sed 2>/dev/null cd "$1" awk ${HOME} --verbose sed 2>/dev/null awk
+		-eu grep && local awk x=1 && && readonly x=1 awk "$1"
+cd x=1 "$@" cd "$@" "$@" sed local 2>/dev/null && sed readonly done
+printf "$@" grep && 'quoted text' awk
+		"$@" "$@" 2>/dev/null x=1 ${HOME} local sed grep x=1 readonly
+x=1 test /usr/bin $(pwd) printf | awk 2>/dev/null --verbose grep local && 2>/dev/null
+	/usr/bin | x=1 done grep test "$@" --verbose local
+		/usr/bin "$@" | echo -eu "$1" && done ${HOME} | local local "$1"
+local grep grep echo 2>/dev/null
+	sed 'quoted text' "$1" --verbose then
+	grep "$@" local 2>/dev/null echo /usr/bin printf 2>/dev/null ${HOME} ${HOME} &&
+"$1" "$@" /usr/bin 'quoted text'
+	done /usr/bin echo | echo cd
+	2>/dev/null cd grep readonly && test local | cd test grep "$@" && local awk done
+	cd "$1" local export echo test --verbose
+| | then 'quoted text' readonly
+	awk ${HOME} /usr/bin done echo "$1" x=1 test && -eu
+		done $(pwd) 'quoted text' $(pwd) ${HOME}
+	${HOME} "$@" done 'quoted text'
+	--verbose | cd awk local local export echo cd $(pwd) 2>/dev/null
+		awk x=1 cd test "$1" printf ${HOME} --verbose | -eu printf && -eu && local
+	sed sed export then 2>/dev/null 'quoted text'
+		/usr/bin x=1 awk grep 2>/dev/null
+	local export cd "$1" then && then awk |
+		"$1" export "$@" /usr/bin x=1
+	| echo echo x=1 export printf | awk 'quoted text'
+	printf /usr/bin | -eu "$@" then $(pwd) "$@" /usr/bin -eu
+	"$@" ${HOME} cd /usr/bin -eu done local
+		cd | --verbose ${HOME} $(pwd) test -eu local printf --verbose
+	"$@" test done readonly cd then
+2>/dev/null x=1 then ${HOME} 2>/dev/null
+	| then --verbose 2>/dev/null
+readonly echo sed printf /usr/bin 2>/dev/null readonly ${HOME} sed "$@" 2>/dev/null
+	x=1 echo x=1 | done grep "$1" cd ${HOME} grep export done done /usr/bin
+"$1" ${HOME} cd 'quoted text' $(pwd) |
+cd --verbose done readonly echo test -eu awk 'quoted text' cd "$@"
+	$(pwd) | $(pwd) | export "$1" grep "$1" cd -eu 'quoted text' "$@" echo
+	echo "$@" then done 2>/dev/null done printf done --verbose local readonly
+	echo then $(pwd) done "$@" awk && cd done "$@" --verbose then 'quoted text'
+--verbose done x=1 && ${HOME} readonly
+	$(pwd) local awk "$@" then ${HOME} echo then awk grep done done local done
+	&& /usr/bin 2>/dev/null | export | "$1" x=1 && printf
+		x=1 then then "$@" done ${HOME} cd awk then readonly
+	test -eu "$@" sed ${HOME} test local "$1" 'quoted text' readonly cd 2>/dev/null
+	printf awk && 'quoted text'
+		local ${HOME} /usr/bin echo
+		| awk $(pwd) export export
+		printf | && x=1 | && | -eu local test sed | "$1" local -eu | test
+	"$@" "$1" then --verbose --verbose echo --verbose
+		sed --verbose sed "$@" cd echo grep awk awk done x=1 sed echo x=1 'quoted text'
+		2>/dev/null && 2>/dev/null $(pwd) test /usr/bin | awk | "$@" --verbose
+	--verbose awk printf "$1" | cd --verbose done | 'quoted text'
+	$(pwd) awk x=1 --verbose /usr/bin $(pwd) echo awk sed
+	cd done 'quoted text' export then --verbose done readonly ${HOME} export
+${HOME} && done grep x=1
+		cd echo then --verbose && then "$@" --verbose 2>/dev/null test awk && "$1"
+test sed printf "$1" | ${HOME} -eu $(pwd) $(pwd) sed cd "$@" /usr/bin awk
+$(pwd) readonly cd cd --verbose test awk
+		2>/dev/null printf local $(pwd) test local /usr/bin readonly done
+	/usr/bin done printf cd sed grep
+		--verbose x=1 cd test x=1 &&
+then 'quoted text' x=1 --verbose sed done awk
+'quoted text' sed | | printf echo grep /usr/bin then done echo grep
+readonly then test cd
+		2>/dev/null && "$1" grep echo export
+test --verbose done printf then grep then $(pwd) export -eu awk done "$1"
+		"$@" awk export --verbose 2>/dev/null | && test ${HOME} 2>/dev/null sed 'quoted text'
+local "$1" echo export sed --verbose test 'quoted text'
+		readonly readonly local readonly export x=1 --verbose ${HOME} grep
+readonly sed /usr/bin --verbose "$@" then "$1" | done done --verbose 'quoted text'
+	"$1" 'quoted text' ${HOME}
+export grep then "$1" -eu then -eu cd 2>/dev/null
+	&& local -eu local -eu readonly
+		sed x=1 echo local 2>/dev/null
+		--verbose readonly awk readonly cd ${HOME} -eu -eu
+cd awk -eu cd 'quoted text' | -eu then "$@" readonly
+		"$1" -eu grep echo "$@" /usr/bin && export
+export | sed cd then | -eu readonly -eu readonly echo -eu /usr/bin
+x=1 awk 'quoted text' sed 'quoted text' "$@" printf | readonly test cd $(pwd)
+/usr/bin ${HOME} -eu local /usr/bin
+"$1" readonly 2>/dev/null grep cd "$@" /usr/bin sed /usr/bin
+		cd && 'quoted text' && cd sed echo $(pwd) ${HOME} grep printf
+--verbose printf export --verbose done /usr/bin then printf
+	"$1" /usr/bin printf awk awk
+$(pwd) export /usr/bin 2>/dev/null /usr/bin local ${HOME} $(pwd)
+	echo awk -eu printf echo /usr/bin done echo x=1 /usr/bin --verbose
+cd awk 'quoted text' $(pwd) sed awk local echo $(pwd) ${HOME} /usr/bin
+done $(pwd) 2>/dev/null "$1"
+		"$1" done grep printf x=1 | echo test
+	then grep -eu done readonly
+	done grep sed readonly "$@" local export | printf
+		${HOME} $(pwd) export sed "$1" local sed echo --verbose
+		${HOME} /usr/bin $(pwd) /usr/bin test --verbose ${HOME}
+	grep sed readonly -eu 2>/dev/null --verbose 'quoted text'
+"$1" readonly 'quoted text' echo "$@"
+test --verbose printf
+		${HOME} "$1" && "$@" x=1 awk readonly export done
+		--verbose export done x=1 --verbose "$1" /usr/bin cd sed awk | echo
+$(pwd) test done 2>/dev/null awk grep --verbose test
+local "$@" -eu --verbose /usr/bin x=1 "$1" local /usr/bin test then readonly
+sed "$@" grep grep && x=1 readonly ${HOME}
+		/usr/bin test export sed --verbose printf
+echo | grep | 'quoted text' x=1 test awk grep 2>/dev/null then
+	sed 2>/dev/null --verbose /usr/bin "$@" awk 2>/dev/null
+		&& /usr/bin 'quoted text' test &&
+	then readonly 2>/dev/null $(pwd)
+		sed | ${HOME} cd "$@" $(pwd)
+		printf export ${HOME} "$@" ${HOME} && sed | grep "$@"
+		awk local then -eu then export grep
+x=1 sed test awk 2>/dev/null printf printf | /usr/bin
+	awk /usr/bin 2>/dev/null --verbose cd printf
+		done local local export
+		$(pwd) done export awk done local $(pwd) 'quoted text' local x=1
+done readonly test && /usr/bin ${HOME} x=1 && && export then local |
+		"$1" x=1 2>/dev/null --verbose local "$1"
+	| /usr/bin 'quoted text' && export sed done ${HOME} local "$1" -eu export
+	"$1" 'quoted text' /usr/bin
+	'quoted text' cd $(pwd) then 2>/dev/null test echo | local -eu grep 'quoted text'
+		x=1 -eu local printf local $(pwd) --verbose --verbose then printf
+export 2>/dev/null /usr/bin
+	then readonly ${HOME} awk grep echo done --verbose ${HOME} test awk grep then 'quoted text'
+	${HOME} 'quoted text' grep
+		cd $(pwd) echo -eu 2>/dev/null $(pwd) echo -eu readonly readonly && then
+		| 'quoted text' readonly readonly
+	done "$@" && --verbose $(pwd) | "$1" "$1" done
+		then ${HOME} printf && sed | readonly
+	printf local grep "$@" then /usr/bin ${HOME} && printf
+		test echo "$@" export printf $(pwd) echo
+grep "$@" then printf 'quoted text' test readonly 2>/dev/null | x=1 local &&
+grep echo awk /usr/bin -eu done && 2>/dev/null test grep --verbose "$@"
+		local awk readonly ${HOME} ${HOME} | "$1" | -eu
+		&& 'quoted text' cd echo printf ${HOME} cd cd x=1 | | local
+		'quoted text' sed then cd | readonly awk --verbose
+grep 'quoted text' grep sed x=1 ${HOME} 2>/dev/null | echo echo
+		cd $(pwd) 2>/dev/null 'quoted text' /usr/bin --verbose
+		${HOME} x=1 2>/dev/null local done ${HOME} ${HOME}
+		-eu "$1" test | && ${HOME} export then cd
+		x=1 "$@" done export /usr/bin local 2>/dev/null "$1" $(pwd) 'quoted text'
+		readonly local awk 'quoted text' awk ${HOME} 2>/dev/null then local sed
+then && local $(pwd) | 2>/dev/null $(pwd) sed $(pwd) 'quoted text' awk "$1" -eu
+| 'quoted text' x=1 2>/dev/null echo 'quoted text' && | && $(pwd) done | echo
+grep 2>/dev/null /usr/bin 'quoted text' grep awk "$1" x=1 awk cd printf done
+		"$1" --verbose readonly
+printf --verbose cd && export then
+	local export "$1" 'quoted text' "$@" cd awk test done "$@" export
+local ${HOME} awk test sed ${HOME}
+printf echo ${HOME} sed export /usr/bin grep | -eu $(pwd) x=1 ${HOME} -eu awk sed
+		2>/dev/null echo && -eu
+grep readonly cd 2>/dev/null x=1 -eu && cd done /usr/bin local test echo
+		readonly grep "$@" test local | then then && grep echo grep export -eu x=1 local
+		"$1" sed 'quoted text' | readonly /usr/bin printf printf "$@" $(pwd) | | ${HOME}
+&& done /usr/bin then $(pwd) 'quoted text' grep echo grep local printf
+		export 2>/dev/null readonly readonly readonly
+	"$1" sed | | x=1 awk then "$1" | | "$@" sed grep local --verbose echo /usr/bin
+	cd --verbose local && local -eu --verbose -eu test grep
+	$(pwd) then export ${HOME} done /usr/bin | && 2>/dev/null "$@" done
+		echo done 'quoted text' /usr/bin
+test "$@" 2>/dev/null 'quoted text' done && export
+2>/dev/null done test x=1 sed -eu
+		printf --verbose grep x=1 | export export done x=1 ${HOME} grep /usr/bin
+		local then test 2>/dev/null printf awk grep grep test -eu
+	printf /usr/bin x=1 ${HOME} test --verbose export -eu "$@" grep
+echo cd done /usr/bin done done test x=1 $(pwd)
+$(pwd) && sed $(pwd) export then "$@" -eu -eu $(pwd) | --verbose
+	&& sed -eu grep local awk && printf 2>/dev/null echo --verbose 'quoted text'
+awk 2>/dev/null x=1 sed "$@" && /usr/bin
+	'quoted text' | "$@" x=1 cd grep
+		readonly ${HOME} then sed /usr/bin readonly && export
+/usr/bin test 2>/dev/null export then -eu ${HOME} --verbose
+		$(pwd) /usr/bin test awk export done
+	export sed local x=1 awk "$@" 'quoted text' test
+	$(pwd) "$@" cd then cd
+-eu export && grep "$1" "$1" 2>/dev/null
+readonly export then "$1" cd 'quoted text' cd
+	local done ${HOME} 2>/dev/null cd local --verbose grep test 2>/dev/null
+${HOME} /usr/bin 'quoted text' /usr/bin $(pwd) --verbose 2>/dev/null
+$(pwd) grep readonly then | ${HOME} --verbose grep sed awk echo done "$1" printf
+	/usr/bin /usr/bin local test grep export
+echo 'quoted text' awk -eu 2>/dev/null | done sed test then
+'quoted text' -eu echo && awk then $(pwd) test 'quoted text' echo
+		readonly done readonly x=1 sed "$1" | readonly 'quoted text' "$1" && 2>/dev/null
+	local 'quoted text' then then &&
+	--verbose "$1" -eu printf | 'quoted text' && done 'quoted text' x=1 printf awk
+	then /usr/bin x=1 test local local local printf $(pwd) $(pwd)
+	"$@" echo $(pwd) ${HOME} "$1" --verbose
+	x=1 local "$1" awk 'quoted text' "$@" test echo 2>/dev/null echo grep x=1 export
+	grep local readonly 2>/dev/null done 2>/dev/null readonly
+	export "$1" local readonly "$1" "$@" 'quoted text'
+		then done export export && "$1" export
+$(pwd) && 'quoted text' then sed local "$@" readonly then printf && local cd echo
+$(pwd) printf 2>/dev/null echo then 2>/dev/null
+		sed "$@" grep | awk done test test printf echo local sed export
+	2>/dev/null --verbose printf ${HOME} readonly
+		2>/dev/null echo sed export then "$1" local cd done
+		'quoted text' echo -eu done cd printf done
+local --verbose awk sed readonly
+		test sed --verbose $(pwd) sed -eu -eu printf
+		"$@" printf grep ${HOME} | export then $(pwd) "$1" then -eu "$@"
+local printf awk then $(pwd) -eu done readonly local
+	${HOME} printf /usr/bin local sed --verbose /usr/bin
+x=1 sed -eu local 'quoted text' then
+		/usr/bin awk cd "$1" $(pwd) sed local export ${HOME} && $(pwd) export x=1 local
+	"$@" printf 2>/dev/null then printf sed local x=1 ${HOME} readonly
+		readonly x=1 x=1 && then -eu readonly
+	test sed test "$@" echo printf 'quoted text' local grep
+'quoted text' done sed test readonly
+	echo grep then cd done ${HOME} cd /usr/bin
+	"$@" && then $(pwd) x=1 x=1 x=1 readonly $(pwd) -eu sed
+	| "$@" x=1 awk test cd echo sed grep test && grep sed cd "$@" 2>/dev/null
+		-eu readonly done -eu sed /usr/bin test echo "$1" awk grep x=1 done grep
+		done && printf /usr/bin grep /usr/bin sed cd then awk
+2>/dev/null awk "$@" awk readonly /usr/bin
+	"$@" -eu then export printf printf awk --verbose $(pwd) echo --verbose "$1" -eu
+		done "$1" then cd readonly readonly ${HOME} && sed "$1"
+		done -eu 'quoted text' sed ${HOME}
+'quoted text' ${HOME}
+		| 'quoted text' local "$@" | | 'quoted text' "$@" $(pwd) echo echo
+printf echo /usr/bin sed
+		then $(pwd) local done 'quoted text' sed 2>/dev/null export
+	then /usr/bin echo --verbose echo 2>/dev/null done
+&& --verbose "$@" awk echo grep -eu $(pwd) done grep | then printf
+		"$1" export then awk ${HOME} ${HOME} readonly ${HOME} -eu ${HOME} x=1 -eu
+done readonly export 'quoted text' "$1"
+		'quoted text' printf /usr/bin done readonly awk cd --verbose
+		then | $(pwd) --verbose readonly then
+		then /usr/bin echo readonly grep | "$1" sed test ${HOME}
+		test --verbose ${HOME} export ${HOME} -eu "$1" x=1 then 'quoted text' --verbose
+		then ${HOME} local x=1 done local -eu && && | 'quoted text'
+		'quoted text' 'quoted text' echo
+		test && | awk then then $(pwd) /usr/bin echo
+		then "$1" test export readonly && then cd $(pwd) 2>/dev/null 2>/dev/null
+	cd test "$1" | x=1 printf sed && 'quoted text' "$1" awk -eu test local
+		--verbose $(pwd) grep | readonly local done test 2>/dev/null
+	printf readonly $(pwd) 'quoted text' | /usr/bin
+'quoted text' 'quoted text' -eu
+| awk local echo ${HOME} test 2>/dev/null cd echo test local
+		printf 'quoted text' local done $(pwd) export local local export printf local
+	then done then sed $(pwd)
+	"$1" /usr/bin printf export awk export -eu x=1
+		grep cd test grep $(pwd) cd "$1" then $(pwd) cd grep
+	then --verbose && then "$@" && -eu
+		grep sed export --verbose /usr/bin then 'quoted text'
+		test ${HOME} awk "$1" ${HOME} cd cd done then | 'quoted text' cd printf
+	"$1" then "$@" done grep printf sed sed -eu cd /usr/bin | export cd awk local
+		-eu /usr/bin export 2>/dev/null done /usr/bin 'quoted text'
+	"$@" sed 'quoted text' done $(pwd) && "$@" "$1" --verbose ${HOME} "$@" $(pwd)
+local $(pwd) ${HOME} "$1" printf test ${HOME}
+| printf -eu 2>/dev/null $(pwd) && echo test /usr/bin
+		done --verbose local awk test --verbose readonly
+		"$@" local "$@" done /usr/bin local
+		${HOME} "$1" cd -eu 2>/dev/null $(pwd) export test x=1 printf printf &&
+		local 2>/dev/null 'quoted text' -eu $(pwd) export test 'quoted text' grep
+	printf printf x=1 /usr/bin "$1" "$@" ${HOME} echo $(pwd)
+| then "$1" test 2>/dev/null test done $(pwd) done | sed test
+		then local && readonly export readonly
+		$(pwd) export 'quoted text' | -eu printf ${HOME} sed
+	${HOME} printf sed cd /usr/bin
+		test local 'quoted text' /usr/bin then local | grep | 2>/dev/null 2>/dev/null &&
+		done && && ${HOME} "$@" local 'quoted text'
+awk 'quoted text' then &&
+printf then ${HOME} && cd -eu test "$@" done then /usr/bin && | test | ${HOME}
+	grep readonly $(pwd) cd ${HOME} cd sed readonly $(pwd)
+&& | -eu && done -eu grep export sed export
+		'quoted text' -eu grep | 'quoted text' local /usr/bin "$@"
+2>/dev/null grep --verbose readonly test awk -eu awk /usr/bin /usr/bin /usr/bin
+then then then then test | grep
+local /usr/bin printf | x=1 grep -eu ${HOME}
+		'quoted text' echo --verbose x=1 ${HOME} cd test grep -eu && 'quoted text' "$1"
+/usr/bin cd && awk "$1" test then cd "$1" done awk grep done /usr/bin
+export local local /usr/bin -eu 'quoted text'
+${HOME} 2>/dev/null && echo $(pwd)
+		-eu export && "$1" "$@" 'quoted text'
+export then -eu cd export printf 'quoted text'
+		"$1" --verbose test export --verbose /usr/bin
+-eu $(pwd) "$@" export -eu /usr/bin /usr/bin x=1 sed
+	export readonly then "$@" local test -eu cd local
+	readonly "$@" | export | sed "$1" -eu -eu -eu done
+	/usr/bin "$1" && | /usr/bin printf echo awk "$@" /usr/bin done printf
+		2>/dev/null && 2>/dev/null $(pwd) && test test
+"$@" test -eu x=1 --verbose done echo cd test x=1
+	grep 'quoted text' test |
+	$(pwd) x=1 test done $(pwd)
+	awk done printf local --verbose awk readonly then then awk awk
+x=1 grep "$@" 'quoted text' x=1 echo local
+	&& awk && local grep | then 'quoted text' ${HOME} test
+"$1" readonly --verbose echo awk test "$@" sed
+	2>/dev/null x=1 sed "$1" done 2>/dev/null | "$1" local export awk then echo
+	sed printf test x=1 "$1" | then -eu && local
+		"$1" export /usr/bin 2>/dev/null echo && then readonly done
+		| test export | x=1 export done printf readonly &&
+"$@" --verbose test | $(pwd) --verbose | x=1
+	"$@" readonly | echo echo printf 'quoted text' && x=1 sed "$@" readonly 2>/dev/null
+done grep test /usr/bin 2>/dev/null --verbose
+local --verbose && grep sed "$@" 'quoted text'
+	-eu awk cd export cd $(pwd) "$@" | done grep -eu echo printf --verbose
+"$1" local x=1 export ${HOME} export "$1" "$1" | local x=1 cd then sed readonly
+		&& then "$@" -eu readonly export /usr/bin x=1 ${HOME} awk "$@" awk
+"$@" test "$@" 'quoted text' "$@" done sed done echo done echo "$1"
+	local && $(pwd) $(pwd) cd cd awk 'quoted text' cd /usr/bin "$@" export x=1
+sed printf test grep x=1 echo "$@" readonly ${HOME} ${HOME}
+grep "$@" 'quoted text' /usr/bin "$1" readonly "$@" done test && && test
+	$(pwd) echo readonly cd grep -eu
+"$@" grep then | printf done x=1 printf "$1" 2>/dev/null ${HOME} "$@"
+&& 2>/dev/null $(pwd) $(pwd) then -eu export sed done printf $(pwd) done
+	test awk test --verbose done test
+export done $(pwd) $(pwd) readonly test printf echo
+	cd cd echo | test 'quoted text' then awk sed test && 2>/dev/null 2>/dev/null local
+	test 'quoted text' $(pwd) 'quoted text' | test echo "$1" then
+	printf then grep grep | 2>/dev/null test &&
+		cd ${HOME} $(pwd) then sed echo grep then local printf test
+	"$@" --verbose 2>/dev/null cd cd ${HOME} local | cd done echo
+	-eu local "$1" cd echo "$1" "$@" --verbose printf cd sed 'quoted text'
+		local local awk --verbose | done --verbose /usr/bin /usr/bin
+		grep ${HOME} 'quoted text'
+sed $(pwd) "$@" $(pwd) ${HOME}
+		"$1" test printf --verbose /usr/bin
+	echo test readonly x=1 && sed sed
+sed test | done grep then awk cd 'quoted text' 'quoted text' sed "$1" printf
+${HOME} $(pwd) "$@" $(pwd) awk local grep
+	grep -eu echo --verbose awk export
+test echo then $(pwd) "$1" local "$1" cd readonly awk /usr/bin
+${HOME} printf test $(pwd) test "$1" then export echo "$@" ${HOME} /usr/bin
+		--verbose grep -eu awk then export "$@" export printf awk local test
+| then "$1" 'quoted text' 2>/dev/null awk 2>/dev/null local local
+	x=1 test sed | printf /usr/bin awk 2>/dev/null
+		readonly then /usr/bin 2>/dev/null /usr/bin
+		$(pwd) ${HOME} printf --verbose local test x=1 done 'quoted text' printf
+		echo /usr/bin sed "$@" x=1 grep printf grep local
+	printf done sed printf $(pwd) export 'quoted text' $(pwd) sed export
+	local test x=1 readonly 2>/dev/null export 2>/dev/null awk printf test local cd
+		| $(pwd) readonly 'quoted text' 2>/dev/null cd 'quoted text' --verbose grep printf
+		export test cd awk awk export readonly test --verbose
+	export $(pwd) printf | --verbose -eu readonly awk | "$1" --verbose
+${HOME} local cd then -eu x=1 awk ${HOME} sed 'quoted text' cd done -eu export
+${HOME} test 2>/dev/null -eu /usr/bin done readonly $(pwd)
+readonly -eu -eu readonly /usr/bin printf
+		done && -eu && ${HOME} ${HOME}
+cd "$1" 'quoted text' echo && "$@" cd --verbose sed
+	$(pwd) local /usr/bin 'quoted text' "$@" 2>/dev/null then
+printf ${HOME} | /usr/bin $(pwd) -eu "$@" --verbose
+"$1" echo grep x=1 x=1 && grep cd ${HOME} 2>/dev/null 'quoted text'
+	export grep awk echo echo $(pwd) printf awk printf "$1"
+	-eu -eu sed echo --verbose -eu printf x=1 readonly
+		test test export echo echo 2>/dev/null cd 'quoted text' "$@" | echo x=1 /usr/bin
+	| "$@" -eu echo $(pwd) export "$@" | export export echo $(pwd) printf
+	&& 2>/dev/null export && --verbose sed --verbose --verbose "$@" && x=1 echo
+		done awk then readonly --verbose -eu done grep 2>/dev/null cd grep "$@"
+x=1 "$@" /usr/bin | 'quoted text' | test $(pwd) printf
+	2>/dev/null cd "$@" ${HOME} "$@" 'quoted text' awk
+test cd cd x=1 'quoted text' x=1 local cd done printf printf export cd 2>/dev/null
+		| printf echo echo sed export -eu
+	"$1" done "$1" $(pwd) 'quoted text' "$1"
+awk ${HOME} readonly then awk && "$1" -eu x=1 sed readonly cd awk
+		export grep done local -eu
+	x=1 "$1" -eu "$@" x=1 2>/dev/null 'quoted text' $(pwd) "$@"
+	/usr/bin x=1 && && done cd $(pwd) /usr/bin
+&& then cd then ${HOME} local $(pwd) ${HOME} "$1" then
+&& "$@" echo "$@" export 'quoted text' then $(pwd) cd ${HOME} $(pwd)
+		&& export -eu then -eu
+--verbose ${HOME} local then | readonly "$@" -eu 2>/dev/null ${HOME} /usr/bin
+&& echo done | ${HOME} --verbose /usr/bin local "$@" echo sed test $(pwd)
+${HOME} /usr/bin test printf 2>/dev/null
+		grep cd x=1 && -eu then test local /usr/bin printf export ${HOME}
+		--verbose $(pwd) awk echo --verbose sed 'quoted text' "$@" export | grep echo
+		'quoted text' done test awk done printf
+	grep "$1" sed export ${HOME} x=1 done test grep x=1 export done cd "$@"
+	grep readonly printf x=1 local
+		"$1" then && --verbose awk /usr/bin
+#include c132.sh
+		export $(pwd) export x=1 test x=1 grep local --verbose awk local "$@" test x=1
+	test test readonly then grep echo --verbose awk "$1" echo -eu grep awk test -eu
+grep "$1" then sed 2>/dev/null then 2>/dev/null
+	| "$1" "$@" export | --verbose | awk "$1" 'quoted text'
+	cd ${HOME} -eu --verbose
+		x=1 then 2>/dev/null printf && -eu then
+readonly then then 'quoted text' done && done ${HOME} sed "$@" echo readonly
+		-eu && sed echo readonly done &&
+		done /usr/bin | done test awk ${HOME} "$1" "$@" then --verbose -eu grep --verbose
+echo grep awk 'quoted text' ${HOME} /usr/bin done sed "$1" done then grep awk
+then 'quoted text' "$1" 2>/dev/null done echo sed export ${HOME}
+$(pwd) ${HOME} x=1 ${HOME} then local
+export -eu $(pwd) -eu echo local "$1" 2>/dev/null export
+		2>/dev/null printf 'quoted text' readonly "$1" "$@" /usr/bin
+		then local "$@" printf then 2>/dev/null export x=1 awk local printf 2>/dev/null
+	'quoted text' 2>/dev/null 2>/dev/null sed -eu then 2>/dev/null cd /usr/bin
+x=1 ${HOME} done 2>/dev/null test done "$@" ${HOME} && then |
+		"$1" $(pwd) 2>/dev/null "$1" ${HOME} then then 2>/dev/null -eu && -eu readonly
+		printf done export x=1 test
+sed 2>/dev/null local --verbose sed cd -eu
+		-eu then sed readonly sed && echo awk && test && x=1 export 'quoted text'
+"$1" local export export export -eu local "$@" | -eu x=1 &&
+	$(pwd) --verbose echo "$@" readonly cd /usr/bin awk $(pwd) 2>/dev/null test then
+	2>/dev/null 'quoted text' -eu ${HOME}
+"$@" "$@" --verbose --verbose then printf && local && ${HOME}
+		x=1 readonly | then local test /usr/bin export
+	| done && && then 'quoted text' x=1 sed && awk local export done
+		'quoted text' awk readonly 'quoted text' 2>/dev/null
+/usr/bin then -eu --verbose local grep
+$(pwd) && then x=1 readonly --verbose
+		export $(pwd) cd && 2>/dev/null && ${HOME} export | -eu
+	x=1 2>/dev/null && --verbose sed echo $(pwd) local readonly cd
+	grep cd ${HOME} "$@" 'quoted text' 2>/dev/null local export test
+$(pwd) grep readonly awk done $(pwd) done test test local readonly sed x=1
+		awk --verbose test local awk -eu awk echo awk "$1" readonly awk echo $(pwd) -eu
+	then "$1" sed --verbose $(pwd) "$@" -eu | test $(pwd)
+2>/dev/null -eu awk | export
+	| awk 'quoted text' printf echo && 2>/dev/null
+		test awk readonly ${HOME} then printf then grep "$@" echo
+local ${HOME} readonly local
+	done ${HOME} $(pwd) grep && printf
+done done test 2>/dev/null awk x=1 ${HOME}
+		'quoted text' cd ${HOME} cd cd -eu
+		x=1 cd grep $(pwd) -eu
+		| /usr/bin --verbose ${HOME} readonly "$@"
+awk printf 2>/dev/null && x=1 grep cd "$@" -eu && 2>/dev/null
+		export done "$1" readonly --verbose export cd cd export export
+	readonly 'quoted text' x=1
+	"$1" local test --verbose &&
+--verbose export | done
+	--verbose ${HOME} $(pwd) awk ${HOME} ${HOME} 2>/dev/null ${HOME} --verbose /usr/bin
+	cd grep cd && 2>/dev/null && done | 'quoted text'
+	sed -eu echo export -eu x=1 x=1 awk awk "$@" 2>/dev/null export "$@" then "$1"
+	awk | 2>/dev/null 2>/dev/null 'quoted text' $(pwd) | /usr/bin --verbose echo
+		-eu 2>/dev/null /usr/bin "$1" echo $(pwd)
+printf sed export "$1" | local "$@"
+"$1" then "$@" readonly "$1" export x=1 awk /usr/bin
+		| --verbose printf ${HOME} | then | $(pwd) echo
+		"$@" "$1" echo printf cd "$@" local done printf "$@"
+export grep printf -eu -eu readonly export "$@" done local done test echo
+/usr/bin && "$@" test -eu 'quoted text' "$1" local export |
+		then done echo grep cd /usr/bin "$1" -eu /usr/bin then -eu
+	${HOME} --verbose && local && "$@" 2>/dev/null echo cd sed export awk | "$@"
+	2>/dev/null 'quoted text' awk --verbose done x=1 -eu awk "$@" awk grep ${HOME}
+grep sed && then printf grep /usr/bin /usr/bin && x=1 awk
+	"$1" "$@" echo --verbose done then | done then 2>/dev/null
+	readonly readonly then echo local 'quoted text'
+	$(pwd) -eu echo echo $(pwd) | 'quoted text' local 2>/dev/null echo 'quoted text'
+		$(pwd) grep then awk readonly cd local && -eu test printf done "$@" done --verbose
+		--verbose sed echo 'quoted text' "$1" grep -eu 2>/dev/null
+	test cd printf printf /usr/bin x=1 "$1" grep echo && x=1
+/usr/bin 2>/dev/null ${HOME}
+	readonly local /usr/bin local export export readonly && grep "$@" grep printf
+	$(pwd) test --verbose /usr/bin 'quoted text' grep sed then /usr/bin echo local
+		local sed | echo && x=1 -eu | x=1 awk /usr/bin "$1" sed readonly
+	"$1" x=1 "$1" test export --verbose readonly
+cd local ${HOME} export test 2>/dev/null local 2>/dev/null $(pwd)
+	grep then /usr/bin && done cd $(pwd)
+	/usr/bin && x=1 'quoted text'
+	grep "$1" then test $(pwd) x=1 -eu echo -eu then $(pwd) export echo 'quoted text'
+		"$1" grep -eu /usr/bin done export
+2>/dev/null --verbose | | ${HOME} "$1" ${HOME} $(pwd) ${HOME} "$1" 2>/dev/null
+		/usr/bin "$1" $(pwd) test && sed $(pwd) cd 'quoted text'
+	${HOME} x=1 "$@" printf done readonly -eu grep -eu awk | readonly
+| printf export 2>/dev/null -eu /usr/bin
+		cd sed export /usr/bin && export test --verbose 2>/dev/null local readonly
+done export --verbose printf 'quoted text' readonly 2>/dev/null
+	x=1 'quoted text' awk sed | test x=1 sed printf /usr/bin cd --verbose readonly
+printf then ${HOME} "$@" cd | ${HOME} then readonly
+		cd "$1" grep && "$1" x=1 x=1 x=1 2>/dev/null -eu
+test 2>/dev/null /usr/bin readonly then local 'quoted text'
+		"$1" "$@" x=1 local test 'quoted text'
+	grep && $(pwd) | "$1" done 2>/dev/null awk grep grep
+	&& && 2>/dev/null awk ${HOME} "$@" awk
+2>/dev/null -eu x=1 grep x=1 printf local printf
+| | /usr/bin -eu 2>/dev/null
+grep /usr/bin /usr/bin test |
+2>/dev/null test 2>/dev/null sed 'quoted text'
+export test local 2>/dev/null | /usr/bin cd && cd /usr/bin done
+	/usr/bin -eu "$@" 2>/dev/null && /usr/bin $(pwd) $(pwd) 2>/dev/null
+	awk printf sed -eu $(pwd) 2>/dev/null sed
+	grep readonly /usr/bin $(pwd) && 2>/dev/null | awk
+echo sed awk | --verbose ${HOME} --verbose readonly "$@" echo done
+&& awk cd ${HOME} x=1 cd cd 2>/dev/null $(pwd) done test readonly
+sed /usr/bin | "$1" test local awk sed test test
+		x=1 x=1 awk export sed echo -eu printf "$1" --verbose
+		/usr/bin echo done echo grep && "$@" ${HOME}
+		$(pwd) $(pwd) echo echo --verbose ${HOME} done "$1" "$@" test sed && then
+-eu test test echo -eu local awk local
+	'quoted text' cd echo test done local local cd awk /usr/bin
+		"$1" grep export && --verbose --verbose 'quoted text' done readonly -eu 2>/dev/null
+local x=1 sed echo $(pwd) cd done echo && "$1"
+	local --verbose /usr/bin
+export test local done done done $(pwd) awk ${HOME}
+echo printf $(pwd) --verbose 2>/dev/null x=1
+done awk -eu x=1 export then "$@" sed -eu grep
+		awk 2>/dev/null grep /usr/bin "$@" grep test $(pwd) test | 2>/dev/null -eu grep
+	&& readonly awk echo local x=1 printf
+		-eu "$@" grep 'quoted text' && then && test
+"$1" -eu readonly && then | 'quoted text' done local && "$@" test
+	printf | "$@" ${HOME} test -eu awk x=1 sed grep done done x=1 2>/dev/null
+	$(pwd) /usr/bin done $(pwd) readonly "$1" "$@" $(pwd) export 'quoted text' readonly
+	--verbose | | awk sed
+printf sed echo sed $(pwd) test test x=1 then -eu
+	cd ${HOME} 'quoted text' "$@" /usr/bin /usr/bin
+		$(pwd) cd readonly local grep grep awk | 2>/dev/null "$@" "$1" printf then
+	then local -eu | 2>/dev/null grep done echo && done
+	${HOME} --verbose sed then export then test sed
+| 2>/dev/null --verbose "$@" x=1 | 'quoted text' echo &&
+	then -eu sed echo done ${HOME} "$1" readonly awk export | 'quoted text' /usr/bin
+		x=1 --verbose 2>/dev/null $(pwd) export "$@" cd "$@" sed x=1 echo export
+	readonly export done ${HOME} "$@" grep then grep test /usr/bin x=1
+/usr/bin grep | awk "$@" $(pwd) test export
+$(pwd) awk grep grep printf then ${HOME} grep echo --verbose sed local
+	done 2>/dev/null && test
+"$1" export test "$1" -eu /usr/bin
+		then readonly readonly | && -eu ${HOME} -eu /usr/bin printf 'quoted text'
+	local x=1 $(pwd) && printf grep
+		done sed echo cd && "$1" done cd 'quoted text'
+	printf --verbose -eu -eu
+	export readonly /usr/bin ${HOME} printf /usr/bin done local grep
+		2>/dev/null && test | -eu test ${HOME} done /usr/bin -eu cd -eu sed --verbose test
+		done export | ${HOME} awk local $(pwd)
+	--verbose local 2>/dev/null printf --verbose -eu awk export export $(pwd)
+'quoted text' sed grep sed /usr/bin ${HOME} local | "$@" local 2>/dev/null
+		then 'quoted text' printf
+		--verbose --verbose printf test "$1" $(pwd) echo echo echo grep test
+		export | sed then ${HOME} /usr/bin --verbose done then done /usr/bin test "$1"
+"$@" 'quoted text' test x=1 readonly grep done 'quoted text'
+		"$@" grep echo then local readonly ${HOME} sed cd 2>/dev/null
+	echo awk 2>/dev/null cd "$1" -eu done echo -eu -eu
+		${HOME} printf sed -eu grep
+		x=1 cd readonly --verbose printf readonly echo --verbose awk
+		then $(pwd) sed echo --verbose ${HOME} ${HOME} cd cd done "$1" cd
+awk "$1" export /usr/bin --verbose
+local /usr/bin local done test cd
+	"$1" then export && test $(pwd) then && x=1 test /usr/bin "$1"
+	local sed 'quoted text' /usr/bin x=1 export sed cd &&
+/usr/bin "$1" | x=1 | "$@" readonly
+"$@" cd test "$1" 2>/dev/null
+-eu test export --verbose && printf "$@" echo readonly $(pwd) x=1 x=1 export
+"$@" printf --verbose ${HOME} echo local
+		${HOME} --verbose sed printf $(pwd) awk 'quoted text'
+	2>/dev/null | --verbose local test
+&& "$1" "$1" printf readonly "$@" 'quoted text' "$1" "$@" "$1"
+		/usr/bin sed --verbose awk x=1 | -eu printf
+	grep 2>/dev/null && sed
+	x=1 echo 'quoted text' local echo ${HOME}
+	test "$@" test "$1" echo done x=1 && ${HOME} | -eu grep echo test local -eu
+test x=1 "$1" awk | echo 2>/dev/null
+		printf export readonly && $(pwd) done
+	'quoted text' cd echo grep echo then && awk -eu "$@"
+	then awk test x=1 | --verbose "$@" then 'quoted text'
+		| x=1 awk | then 2>/dev/null
+&& done printf export 'quoted text' cd $(pwd) $(pwd) sed then "$1" export
+		test local | awk 2>/dev/null echo 2>/dev/null /usr/bin done readonly 'quoted text'
+${HOME} sed readonly then "$1" printf x=1 "$@" "$@" x=1 ${HOME} ${HOME}
+"$1" then then readonly echo -eu /usr/bin sed /usr/bin x=1 cd /usr/bin export 'quoted text'
+'quoted text' "$1" ${HOME} test x=1 x=1 cd --verbose done
+&& | sed printf --verbose /usr/bin awk
+	/usr/bin then echo "$1" local test awk done test cd
+		test echo $(pwd) printf -eu --verbose cd --verbose done
+"$@" x=1 ${HOME} 'quoted text' -eu awk
+		"$1" done | 2>/dev/null "$1"
+		sed 2>/dev/null readonly x=1 awk "$@" local "$@" done ${HOME} -eu $(pwd) && cd
+		readonly && /usr/bin $(pwd) test readonly sed 2>/dev/null done
+		"$@" $(pwd) | local 2>/dev/null "$@" test "$@" test -eu ${HOME} sed printf echo
+		done awk $(pwd) "$@" readonly "$@"
+	local x=1 2>/dev/null echo
+		printf export done then done sed printf "$1"
+"$1" | | grep --verbose test echo export -eu done printf sed echo ${HOME}
+	-eu readonly "$1" 2>/dev/null /usr/bin printf && -eu ${HOME} local $(pwd)
+		'quoted text' printf sed awk sed awk then
+		--verbose test 'quoted text' -eu $(pwd) local export
+	--verbose readonly x=1 2>/dev/null | $(pwd) -eu && awk echo
+		-eu grep export cd --verbose awk cd 'quoted text'
+		local -eu grep printf --verbose awk export export 'quoted text'
+	local --verbose test $(pwd) "$@" --verbose grep
+	"$1" "$1" 2>/dev/null "$@"
+	awk -eu grep echo done cd echo sed -eu done -eu 'quoted text'
+		&& local x=1 'quoted text'
+		done test echo 'quoted text' test grep local local "$1" export 2>/dev/null test
+local && awk awk /usr/bin "$@" ${HOME} awk grep -eu 'quoted text' grep "$1" done
+"$@" "$@" sed cd test $(pwd) export --verbose -eu readonly test export && ${HOME}
+	-eu test printf grep export then "$@" cd echo | ${HOME} 'quoted text' cd "$1"
+		/usr/bin -eu then then done
+"$1" x=1 cd x=1 /usr/bin export 'quoted text' done /usr/bin done /usr/bin test
+x=1 readonly cd readonly readonly 'quoted text'
+	$(pwd) export 'quoted text'
+	echo --verbose awk test local readonly x=1 cd
+		| test --verbose x=1 x=1 x=1 "$@" 2>/dev/null --verbose done x=1 /usr/bin
+	2>/dev/null grep then --verbose export x=1
+	/usr/bin x=1 "$1" echo then $(pwd) "$@" &&
+		echo done echo local 'quoted text' /usr/bin local ${HOME} | /usr/bin printf ${HOME}
+		test local export local done "$@" "$@" $(pwd) $(pwd) cd 2>/dev/null
+test sed ${HOME} 2>/dev/null
+		/usr/bin echo sed x=1 then cd done printf && "$@" grep printf
+		-eu ${HOME} x=1 printf export /usr/bin export done "$1" ${HOME} ${HOME}
+		printf 'quoted text' cd done echo local export
+	grep grep cd /usr/bin done printf $(pwd) export $(pwd)
+		2>/dev/null sed /usr/bin awk echo echo sed
+	then cd 2>/dev/null printf
+	/usr/bin -eu $(pwd) ${HOME} /usr/bin cd /usr/bin sed --verbose readonly
+done --verbose "$1" x=1 /usr/bin
+	sed 2>/dev/null "$1" && then echo --verbose echo -eu | done 2>/dev/null
+	$(pwd) ${HOME} readonly awk | x=1 export /usr/bin
+		then "$@" grep then local then $(pwd) 'quoted text' $(pwd) cd ${HOME}
+2>/dev/null printf printf 'quoted text'
+"$@" /usr/bin test 2>/dev/null -eu -eu then done "$1" "$1" | readonly local
+&& 'quoted text' grep test &&
+		printf test && "$1" then "$1" local 'quoted text' awk ${HOME} grep --verbose
+local 2>/dev/null -eu then awk readonly export ${HOME} ${HOME} $(pwd) done local
+		&& $(pwd) cd "$@" echo sed /usr/bin ${HOME} local -eu then -eu &&
+		--verbose $(pwd) export echo ${HOME} export && grep
+x=1 x=1 | awk test done | ${HOME} | local
+"$1" local 2>/dev/null then $(pwd) grep printf cd --verbose
+	awk -eu readonly "$1" 'quoted text'
+		cd awk cd "$1" awk "$@" | grep awk --verbose
+		awk done /usr/bin printf /usr/bin
+		--verbose 'quoted text' ${HOME} test export awk readonly local grep | local &&
+/usr/bin 'quoted text' export local x=1 test 'quoted text' /usr/bin /usr/bin printf
+"$@" cd 'quoted text' printf $(pwd) 'quoted text'
+		cd $(pwd) readonly local echo 2>/dev/null sed 2>/dev/null
+sed sed "$1" grep "$1" awk $(pwd) local x=1 -eu
+	done "$1" $(pwd) $(pwd) done sed x=1
+2>/dev/null cd export "$1" /usr/bin "$@" -eu 2>/dev/null local
+"$1" && && $(pwd) -eu test awk readonly export done ${HOME} 'quoted text' done
+		x=1 cd then readonly 'quoted text' readonly --verbose
+2>/dev/null && printf cd
+		readonly printf awk --verbose 'quoted text' readonly export
+2>/dev/null ${HOME} done "$1"
+		echo ${HOME} test 2>/dev/null export -eu export
+	then $(pwd) -eu /usr/bin
+2>/dev/null && /usr/bin 2>/dev/null
+		x=1 ${HOME} printf echo ${HOME} && done 2>/dev/null
+	sed "$1" 'quoted text' done x=1 "$@" then then "$1" "$@" "$@" x=1 | 2>/dev/null
+	readonly -eu export -eu $(pwd) -eu awk sed readonly grep
+-eu && "$@" local $(pwd) | awk | /usr/bin cd | && 'quoted text' test
+$(pwd) grep /usr/bin 'quoted text'
+	grep echo 'quoted text' echo cd sed grep sed "$@" "$@" $(pwd) readonly awk
+	grep /usr/bin /usr/bin test -eu --verbose then
+		'quoted text' "$1" | | test | -eu echo printf printf -eu grep local local | sed
+"$@" && && x=1 then x=1 && echo x=1 printf
+	x=1 ${HOME} "$@" export grep | echo
+	${HOME} export printf "$@" grep 'quoted text' "$@" readonly /usr/bin
+		echo $(pwd) sed "$1" grep "$@" && printf local printf 2>/dev/null awk
+		done "$1" printf local && x=1
+test grep 2>/dev/null /usr/bin -eu | 'quoted text'
+	awk | -eu sed echo 2>/dev/null 2>/dev/null then then done done
+		then printf 'quoted text' --verbose then
+"$1" && "$1" x=1 local
+	echo "$@" done readonly /usr/bin awk ${HOME} grep -eu 'quoted text'
+done "$@" awk awk /usr/bin readonly grep
+	2>/dev/null "$1" && "$1" "$@" "$@" then test then echo 'quoted text' echo | printf
+		cd 'quoted text' "$@" "$@" sed 2>/dev/null
+		sed ${HOME} "$@" grep && $(pwd) $(pwd)
+		test then sed | export -eu x=1 awk | awk local
+sed $(pwd) then local
+		grep 2>/dev/null export -eu test 2>/dev/null
+		| local -eu awk grep "$@" x=1 "$1" $(pwd) readonly --verbose printf "$@"
+		'quoted text' then | && local && printf 2>/dev/null
+		test printf echo 2>/dev/null then 'quoted text' |
+done done awk x=1 sed /usr/bin "$1" local
+	then grep && grep then --verbose printf | test ${HOME} ${HOME}
+		awk "$1" /usr/bin $(pwd) -eu local grep ${HOME} grep
+	sed then test 2>/dev/null done ${HOME}
+/usr/bin export local $(pwd)
+	local printf /usr/bin test done "$1"
+		--verbose x=1 done 'quoted text' $(pwd)
+		${HOME} 'quoted text' --verbose
+	'quoted text' export echo readonly && echo $(pwd) then
+		cd cd export printf sed grep $(pwd) local test && sed ${HOME} 'quoted text' local
+		grep "$1" "$@" 2>/dev/null "$1" cd x=1 awk test grep "$1" "$1" && grep "$@" test
+		printf | 'quoted text' --verbose printf 'quoted text'
+cd "$1" grep x=1 test ${HOME} x=1 then
+readonly cd && awk readonly | export $(pwd) 2>/dev/null /usr/bin awk sed sed
+		test 'quoted text' echo sed export --verbose
+	2>/dev/null "$1" sed then --verbose then
+		then "$@" --verbose local
+		"$1" 'quoted text' awk
+-eu -eu awk 'quoted text' --verbose | /usr/bin printf /usr/bin
+		'quoted text' | 2>/dev/null "$1" echo then "$@" "$@" "$1" then test
+	sed then test 'quoted text' 'quoted text' grep "$1" x=1 echo "$1" -eu
+		done cd export echo "$@" | test ${HOME} test awk sed && && printf && $(pwd) 'quoted text'
+readonly readonly done | then awk 'quoted text'
+export echo echo echo export cd "$@"
+		export local "$1" --verbose local -eu done then | --verbose local
+		readonly local then readonly local
+		$(pwd) sed printf echo sed sed "$1" "$1" 2>/dev/null
+/usr/bin sed 'quoted text' --verbose sed sed cd "$@" printf --verbose
+		/usr/bin sed --verbose export ${HOME} then awk 2>/dev/null
+printf --verbose -eu x=1 done 'quoted text' 'quoted text' --verbose | grep export
+-eu $(pwd) readonly /usr/bin --verbose sed 2>/dev/null printf
+		/usr/bin | /usr/bin awk export "$1" "$@" grep then cd test x=1 cd $(pwd) --verbose
+		grep -eu readonly awk cd awk echo
+	"$@" done | $(pwd) "$1" grep | export grep cd 'quoted text'
+		then --verbose /usr/bin then grep grep sed 'quoted text' $(pwd)
+| 2>/dev/null grep /usr/bin echo && 2>/dev/null
+		then && x=1 /usr/bin export export "$1" && 2>/dev/null
+	grep | awk 'quoted text' | export && local awk
+awk x=1 echo ${HOME} ${HOME} readonly && printf readonly awk
+	-eu | $(pwd) printf printf x=1 readonly x=1 "$1"
+	test ${HOME} $(pwd) --verbose grep | local local grep printf then $(pwd)
+	&& x=1 sed sed local cd x=1 printf printf
+	'quoted text' "$1" "$@" 2>/dev/null readonly 2>/dev/null
+	x=1 --verbose cd export local 'quoted text'
+	printf $(pwd) local export ${HOME} cd done sed "$1" && "$@" echo
+	awk printf cd /usr/bin export /usr/bin ${HOME} $(pwd) test
+echo done readonly && printf --verbose ${HOME} && $(pwd) 'quoted text'
+	echo export "$1" sed readonly "$1" x=1 local --verbose printf done -eu ${HOME}
+		"$@" cd cd awk export readonly local && 2>/dev/null
+cd sed local /usr/bin "$1" "$@" x=1 $(pwd) && /usr/bin grep printf test
+	x=1 local 2>/dev/null "$@" readonly cd cd then readonly /usr/bin -eu
+		| then ${HOME} done 'quoted text' awk |
+cd test 'quoted text' local printf cd
+		echo 2>/dev/null 2>/dev/null cd 2>/dev/null
+--verbose readonly "$@" && done readonly
+-eu grep sed local $(pwd) done 2>/dev/null
+		| 'quoted text' "$1" "$@" "$@"
+		/usr/bin sed sed x=1 echo echo cd export 2>/dev/null
+done test && | export sed /usr/bin $(pwd) cd printf export -eu readonly x=1 'quoted text'
+		done 'quoted text' grep "$1" x=1 echo 2>/dev/null grep 'quoted text'
+		x=1 export x=1 sed "$@" x=1 "$@"
+${HOME} awk local readonly --verbose printf 'quoted text'
+grep | export 2>/dev/null
+	sed readonly grep --verbose
+		"$@" cd echo && grep ${HOME} sed
+	awk "$1" /usr/bin local 'quoted text' readonly 'quoted text' export
+	| readonly "$1" "$1" && --verbose done export
+| echo -eu 2>/dev/null $(pwd) 2>/dev/null
+x=1 /usr/bin | /usr/bin awk readonly export /usr/bin
+		/usr/bin 2>/dev/null done readonly 2>/dev/null && $(pwd) -eu
+		"$1" /usr/bin "$1" $(pwd) sed "$1" ${HOME} awk printf
+'quoted text' sed $(pwd) /usr/bin then -eu
+		2>/dev/null done awk local then awk
+grep | export /usr/bin "$1" echo
+$(pwd) --verbose && cd then && sed && -eu /usr/bin readonly done test
+local printf "$@" done sed grep echo done
+		/usr/bin 2>/dev/null ${HOME}
+		then /usr/bin 'quoted text' grep -eu "$1"
+	awk 2>/dev/null 2>/dev/null 2>/dev/null | $(pwd) 'quoted text' && &&
+	export readonly then awk 'quoted text' -eu readonly 'quoted text' then -eu
+awk --verbose --verbose
+		/usr/bin sed local 'quoted text' 'quoted text'
+		x=1 awk -eu test && grep | 2>/dev/null -eu "$@" -eu export
+	echo echo | awk "$@" -eu "$@" /usr/bin
+cd && -eu /usr/bin readonly
+"$1" then -eu | $(pwd) 'quoted text' echo done && /usr/bin -eu test 'quoted text'
+readonly /usr/bin test readonly
+		-eu done sed /usr/bin sed sed cd awk "$1" /usr/bin sed "$1" 'quoted text' sed
+		export grep cd readonly grep sed export echo test printf sed
+		echo $(pwd) awk grep | export $(pwd) export x=1 then
+&& $(pwd) then -eu | awk export cd -eu readonly grep awk awk test test
+2>/dev/null $(pwd) --verbose -eu export
+export x=1 && grep awk export local 2>/dev/null --verbose test echo then
+		"$1" sed x=1 local awk | test
+sed $(pwd) awk "$@" sed && local test | $(pwd) | sed && | export export $(pwd)
+grep 2>/dev/null grep $(pwd)
+then awk ${HOME} && -eu | "$1" local sed -eu awk sed $(pwd)
+		local $(pwd) local readonly | export awk local "$@" readonly
+		-eu sed local awk test "$1" --verbose done | "$@" done local 'quoted text' awk
+		printf 'quoted text' | echo x=1 echo && "$@" sed printf echo
+grep test echo --verbose x=1 test echo grep "$1"
+| local cd $(pwd) && $(pwd) --verbose 2>/dev/null $(pwd) export "$@" sed
+		readonly x=1 test done | awk readonly | sed local x=1 echo test
+		x=1 "$1" "$@" test && readonly && done /usr/bin test && awk then
+$(pwd) echo | /usr/bin "$1" 2>/dev/null /usr/bin | 'quoted text' grep
+		"$1" x=1 x=1 ${HOME} /usr/bin x=1 /usr/bin then sed test 'quoted text'
+		test --verbose test x=1 $(pwd) && cd
+	2>/dev/null grep $(pwd)
+		'quoted text' /usr/bin sed && --verbose
+		${HOME} printf -eu ${HOME} printf readonly ${HOME}
+		"$1" then | "$1" printf echo /usr/bin /usr/bin /usr/bin
+	cd "$1" echo grep cd && -eu 'quoted text'
+then && "$1" local -eu readonly "$@" local export grep then cd
+then echo $(pwd) grep ${HOME} grep sed -eu
+"$@" echo --verbose test sed
+| --verbose "$@" printf printf && awk -eu test cd done | test grep sed 2>/dev/null
+		readonly local readonly x=1 echo test sed /usr/bin
+${HOME} echo /usr/bin -eu export
+	/usr/bin local awk echo local 'quoted text'
+		cd 'quoted text' export grep cd --verbose awk done
+export -eu grep done ${HOME} | $(pwd) -eu cd x=1 2>/dev/null awk && x=1
+2>/dev/null export export awk 'quoted text' local ${HOME}
+		cd local $(pwd) readonly
+cd sed 2>/dev/null "$1" awk done
+		export 'quoted text' then readonly 'quoted text' $(pwd) export
+	readonly grep cd sed readonly && && $(pwd) test -eu /usr/bin
+	/usr/bin ${HOME} readonly x=1 ${HOME} -eu && then 'quoted text'
+	'quoted text' awk cd local readonly 'quoted text' 2>/dev/null /usr/bin
+		/usr/bin then test -eu cd "$1" 2>/dev/null grep sed awk cd "$1" echo cd echo
+awk sed echo echo ${HOME} /usr/bin x=1 && "$1" x=1 ${HOME}
+	export done readonly awk 'quoted text' x=1 2>/dev/null -eu 2>/dev/null grep grep
+		${HOME} ${HOME} awk export awk "$@" 'quoted text'
+then done && echo /usr/bin readonly
+		"$1" done local --verbose cd echo
+awk ${HOME} "$@" sed /usr/bin ${HOME} "$1" export 'quoted text'
+		then export done "$@" "$1" ${HOME} done done ${HOME} readonly /usr/bin export
+echo $(pwd) then x=1 printf 2>/dev/null
+${HOME} $(pwd) $(pwd) awk "$@" /usr/bin printf
+	sed $(pwd) 2>/dev/null $(pwd) local /usr/bin done awk $(pwd)
+	"$1" echo readonly then local printf 'quoted text' readonly x=1
+done && cd awk local "$1" "$@" grep sed sed /usr/bin
+		test ${HOME} then echo $(pwd) 'quoted text' --verbose
+	local test && "$1" awk --verbose echo sed ${HOME} export awk local
+cd test x=1 ${HOME} x=1 test grep cd test
+	$(pwd) 2>/dev/null export -eu local $(pwd) --verbose |
+	test ${HOME} | done awk --verbose /usr/bin "$1" --verbose
+	$(pwd) 'quoted text' sed x=1 $(pwd) -eu grep done
+	x=1 sed 'quoted text' grep "$@" then cd /usr/bin cd /usr/bin local
+		echo 'quoted text' /usr/bin
+	test "$@" local sed 2>/dev/null -eu readonly
+x=1 local local | local /usr/bin
+	$(pwd) printf echo "$1" echo "$@" /usr/bin -eu local grep grep x=1 x=1 then
+| readonly -eu $(pwd) "$1" "$@" "$@" grep
+	grep --verbose readonly awk "$@" export | local
+/usr/bin /usr/bin grep --verbose awk | awk /usr/bin grep && 2>/dev/null && && --verbose
+	&& grep local then --verbose $(pwd) $(pwd) $(pwd) done grep 2>/dev/null
+	then 2>/dev/null readonly done /usr/bin x=1 awk 'quoted text' printf 'quoted text'
+		&& grep "$1" $(pwd) | awk echo sed ${HOME}
+&& awk awk local | $(pwd) 'quoted text'
+"$@" echo x=1 "$@" then then "$@" | awk "$@" awk done test $(pwd) -eu
+		"$@" && done local local && grep sed done --verbose
+test 2>/dev/null "$1" test --verbose cd readonly
+	test echo echo | $(pwd) local
+grep -eu ${HOME} x=1 | && "$1" echo --verbose --verbose
+		/usr/bin printf then export done echo --verbose
+		/usr/bin && cd | 'quoted text'
+		"$1" ${HOME} && /usr/bin /usr/bin
+grep | cd x=1 | grep "$1" readonly -eu "$1" grep
+	then /usr/bin "$1" -eu 'quoted text'
+		readonly grep then 2>/dev/null
+	${HOME} readonly x=1 printf export 'quoted text' then /usr/bin
+export readonly 'quoted text' 'quoted text' grep awk /usr/bin -eu awk
+	readonly then then $(pwd) -eu ${HOME}
+		sed echo && cd $(pwd) export local printf x=1 'quoted text'
+export -eu -eu && x=1 'quoted text' local readonly local $(pwd)
+		"$@" printf --verbose -eu x=1 2>/dev/null --verbose
+		export cd printf && ${HOME} -eu then 'quoted text'
+		"$@" grep readonly 2>/dev/null 'quoted text' /usr/bin export
+export 2>/dev/null x=1 ${HOME} /usr/bin awk x=1
+	sed done --verbose local /usr/bin 'quoted text' "$@" 2>/dev/null "$1" printf
+	-eu cd grep $(pwd) --verbose 2>/dev/null -eu --verbose $(pwd) &&
+	&& grep echo "$@" --verbose awk 'quoted text'
+		cd 2>/dev/null awk $(pwd) 2>/dev/null $(pwd)
+		export | "$1" echo x=1 test done printf "$@"
+printf local grep export $(pwd) "$@" $(pwd) /usr/bin
+2>/dev/null grep "$@" $(pwd)
+	export 'quoted text' 'quoted text' 2>/dev/null
+		"$1" $(pwd) && $(pwd) readonly cd printf echo | 'quoted text' ${HOME}
+		| printf "$@" 'quoted text' $(pwd) -eu export
+		"$@" sed "$1" readonly echo test ${HOME} 'quoted text' 'quoted text'
+then test cd /usr/bin echo cd local
+		test ${HOME} -eu 'quoted text' cd $(pwd) echo /usr/bin x=1 cd /usr/bin
+	--verbose cd test test && cd sed readonly | readonly
+	"$1" x=1 printf | local "$1" | 'quoted text'
+-eu printf test then then 'quoted text' export
+		printf readonly readonly 2>/dev/null readonly export
+		echo && export local x=1 sed 2>/dev/null "$@" 2>/dev/null grep export
+echo "$@" test | ${HOME} ${HOME} cd | sed echo 'quoted text' /usr/bin then
+	2>/dev/null then && printf export then done
+| --verbose x=1 && 'quoted text' export $(pwd) sed --verbose x=1 $(pwd) then awk
+		then printf $(pwd) printf $(pwd) /usr/bin "$1" && local grep local $(pwd)
+	awk $(pwd) echo grep echo 'quoted text' "$1"
+	2>/dev/null "$@" grep "$1" x=1 x=1 awk "$@" /usr/bin then --verbose local
+		/usr/bin && x=1 $(pwd) grep -eu printf
+		cd "$1" cd cd sed "$1" -eu cd
+		local | 2>/dev/null /usr/bin "$@" cd readonly awk 2>/dev/null awk
+| /usr/bin sed "$@" "$@" | "$@" local "$@" local test
+awk awk sed awk 'quoted text' --verbose ${HOME}
+${HOME} 'quoted text' 2>/dev/null
+		sed echo awk then --verbose $(pwd) --verbose --verbose cd export
+sed local cd $(pwd) grep /usr/bin
+	readonly x=1 done awk sed then ${HOME} sed --verbose done
+&& -eu 'quoted text' done printf -eu sed local done | then | grep printf
+cd local echo ${HOME}
+	done $(pwd) export export export grep && 2>/dev/null then $(pwd)
+		"$@" -eu export "$1" -eu $(pwd) && done test "$1" $(pwd) then && 2>/dev/null
+2>/dev/null then | done x=1 $(pwd) $(pwd)
+| test cd $(pwd) $(pwd) 'quoted text' 2>/dev/null
+	$(pwd) /usr/bin printf /usr/bin
+		grep sed ${HOME} local cd local sed $(pwd) "$@" local readonly test sed --verbose
+		"$1" -eu awk sed --verbose ${HOME} printf $(pwd) "$@" grep -eu printf
+$(pwd) printf ${HOME} echo awk grep 'quoted text'
+		2>/dev/null test 'quoted text' ${HOME} 'quoted text' && export "$1" $(pwd)
+		done awk test "$@" "$1" -eu 2>/dev/null awk --verbose $(pwd) readonly
+x=1 echo done export echo 'quoted text' --verbose
+		echo export awk readonly
+		"$1" $(pwd) --verbose local
+		printf then done readonly
+		"$1" awk --verbose then
+		local readonly test $(pwd) -eu printf done done local
+		"$1" && readonly 'quoted text' 'quoted text' $(pwd) grep x=1 printf && "$1" $(pwd)
+	test ${HOME} grep readonly cd
+echo x=1 --verbose "$@" printf then -eu test grep local local printf -eu
+local | awk && then --verbose grep /usr/bin grep ${HOME} ${HOME} then
+sed then 'quoted text' "$1" done "$@" printf grep sed
+	&& local 2>/dev/null export 'quoted text' done --verbose
+		readonly 2>/dev/null printf x=1 done then ${HOME}
+then 'quoted text' then echo ${HOME} 2>/dev/null echo cd
+		done cd done /usr/bin readonly
+		"$1" grep && sed printf "$@" local echo "$1" 'quoted text'
+	awk awk sed /usr/bin test --verbose $(pwd) 2>/dev/null
+	| cd printf 2>/dev/null done awk "$1" printf && x=1 -eu grep --verbose
+	test "$1" sed readonly x=1
+local sed test && "$@" then
+awk sed awk local done awk
+	&& cd export x=1 then printf "$@" "$1" "$1" then test readonly test test
+2>/dev/null sed readonly awk export sed test local | sed "$1" readonly
+	awk --verbose cd test x=1 /usr/bin local /usr/bin 'quoted text'
+	-eu grep ${HOME} then && echo -eu readonly x=1
+	printf 'quoted text' local 'quoted text'
+	readonly 2>/dev/null readonly printf 2>/dev/null -eu printf --verbose
+		2>/dev/null /usr/bin --verbose | 2>/dev/null then --verbose export echo
+		grep "$@" /usr/bin ${HOME} then /usr/bin sed
+	"$1" then | ${HOME} awk cd awk readonly "$@" echo && ${HOME} export
+sed sed -eu test | sed awk then $(pwd) local $(pwd) && sed done -eu
+		$(pwd) readonly --verbose test
+	awk x=1 echo echo x=1 ${HOME} /usr/bin --verbose -eu ${HOME}
+	export grep awk "$1" echo local grep awk sed "$@" "$1" $(pwd) sed
+cd export awk done 'quoted text'
+x=1 printf "$1" awk echo
+local echo ${HOME} done && then
+echo printf ${HOME} then $(pwd)
+"$@" printf grep readonly
+'quoted text' -eu 2>/dev/null
+	-eu cd $(pwd) x=1 --verbose -eu
+	awk readonly done 'quoted text'
+		grep | done 2>/dev/null export | -eu "$@" "$1" readonly then readonly --verbose
+		2>/dev/null grep /usr/bin grep sed echo --verbose
+		x=1 --verbose /usr/bin export x=1 "$1" then "$1" | | test grep $(pwd) --verbose
+grep "$1" 2>/dev/null readonly echo && done /usr/bin
+done $(pwd) test printf $(pwd)
+	cd printf grep test then x=1 ${HOME} echo sed printf $(pwd)
+| export cd "$1" echo cd grep && readonly sed
+awk | test readonly readonly 'quoted text'
+		/usr/bin awk 2>/dev/null
+'quoted text' readonly && ${HOME} | | -eu $(pwd) 'quoted text' then grep
+test && printf "$@" printf && --verbose && -eu 'quoted text'
+		-eu sed ${HOME} /usr/bin "$1" -eu then "$1" test awk x=1 done export | 2>/dev/null
+		done 'quoted text' -eu grep x=1 test && export test | test then ${HOME} 'quoted text'
+	&& -eu readonly x=1 readonly done then cd 'quoted text' then
+		test $(pwd) awk ${HOME} cd then export x=1 printf echo sed ${HOME} 'quoted text'
+export /usr/bin awk --verbose export test 2>/dev/null test export && 2>/dev/null
+/usr/bin done done readonly export
+grep then awk test ${HOME} | "$@"
+"$@" done $(pwd) done ${HOME} ${HOME} echo local
+echo "$1" x=1 readonly && export
+		awk test --verbose sed printf
+	--verbose ${HOME} ${HOME} readonly -eu readonly && /usr/bin 2>/dev/null
+	printf && export --verbose -eu
+		| --verbose awk then sed local then x=1 sed awk x=1 "$@" --verbose
+cd x=1 | echo && -eu "$1" done cd 2>/dev/null
+	&& 'quoted text' sed "$@" "$@" | done
+	cd readonly local echo ${HOME} cd x=1 -eu x=1 readonly
+-eu echo done $(pwd) --verbose $(pwd)
+	cd done sed /usr/bin "$@" then "$@" | cd 'quoted text' then export
+	"$@" /usr/bin readonly awk $(pwd) && printf | awk printf awk cd
+		awk && test ${HOME} /usr/bin
+		echo | "$1" 2>/dev/null export && x=1 "$1"
+		-eu cd ${HOME} export grep then 2>/dev/null local $(pwd) local
+/usr/bin | 2>/dev/null | /usr/bin local -eu x=1 then local && "$@" echo 2>/dev/null
+"$@" x=1 test printf then test cd x=1 printf /usr/bin /usr/bin
+		2>/dev/null | | ${HOME} && cd "$1" x=1
+	printf && cd /usr/bin readonly -eu sed test "$@" done sed test readonly printf
+	-eu grep && && 2>/dev/null
+| echo "$@" 'quoted text'
+		readonly cd local x=1 x=1 then x=1 /usr/bin cd then
+	--verbose -eu "$@" grep 'quoted text'
+-eu | /usr/bin readonly test
+	2>/dev/null $(pwd) 'quoted text' "$@" ${HOME} 2>/dev/null | "$@" "$1" --verbose
+done "$@" done export then
+echo done sed sed awk 2>/dev/null sed test 'quoted text'
+	/usr/bin "$1" cd "$1" && awk && --verbose
+	sed grep ${HOME} "$@" local /usr/bin sed printf
+	"$@" ${HOME} awk local && local /usr/bin then then printf /usr/bin x=1 --verbose
+	$(pwd) echo "$1" | local export
+local --verbose awk awk && readonly
+--verbose ${HOME} echo && /usr/bin awk readonly readonly
+		"$1" /usr/bin $(pwd) /usr/bin
+		"$@" local x=1 cd 'quoted text' export
+		awk && cd "$1" $(pwd) done sed awk /usr/bin ${HOME} 'quoted text' done sed
+	&& then "$1" 2>/dev/null && local then 2>/dev/null x=1 grep
+--verbose --verbose cd
+	then cd test then done /usr/bin
+		awk "$1" awk ${HOME} local x=1 local $(pwd) grep /usr/bin $(pwd)
+		--verbose awk done readonly cd export "$1" 2>/dev/null
+	printf grep && x=1 export then readonly $(pwd) cd local x=1 export
+/usr/bin | awk $(pwd) | done | awk && local awk test awk then echo &&
+then --verbose then /usr/bin
+	grep ${HOME} readonly 'quoted text' then ${HOME} "$@" done sed
+	local /usr/bin test $(pwd) | local "$1" x=1 export done
+export 'quoted text' done
+		$(pwd) | && -eu done -eu cd grep --verbose "$@" readonly "$@" /usr/bin x=1
+		$(pwd) test sed 'quoted text' /usr/bin
+	then export $(pwd) local --verbose ${HOME} ${HOME} "$@" awk sed ${HOME} -eu $(pwd)
+		printf /usr/bin then readonly then ${HOME} -eu -eu cd sed test
+"$1" grep && "$@" sed awk 'quoted text'
+	local ${HOME} cd done 2>/dev/null awk && done
+		| export echo 2>/dev/null $(pwd) && grep
+	done $(pwd) x=1 2>/dev/null done then printf x=1 'quoted text' grep
+	"$@" "$@" 'quoted text' $(pwd) local | then export | -eu --verbose
+		done grep --verbose x=1
+	-eu | echo /usr/bin sed x=1 then -eu local
+cd x=1 cd test cd cd | x=1 "$1" echo | x=1 && $(pwd) 'quoted text' awk done /usr/bin
+	sed && grep printf awk awk x=1 export printf
+		${HOME} "$1" $(pwd) awk then test sed | local $(pwd) "$@" test readonly --verbose
+		/usr/bin "$@" 2>/dev/null grep
+test "$@" ${HOME} $(pwd) sed grep export awk awk grep $(pwd) "$1" "$@"
+	export | -eu x=1 cd done awk sed /usr/bin export ${HOME}
+sed && test 'quoted text' "$1"
+	$(pwd) test ${HOME} awk
+test readonly printf --verbose
+		/usr/bin awk echo test --verbose cd 'quoted text'
+sed $(pwd) -eu && local
+local -eu -eu awk x=1 readonly
+	then test then sed && local -eu && echo
+	-eu -eu 2>/dev/null local && awk | "$@" 'quoted text' done -eu
+"$@" awk grep 2>/dev/null
+		sed $(pwd) "$@" ${HOME} awk $(pwd)
+		"$@" && sed export cd --verbose "$1" export
+		done 'quoted text' 2>/dev/null done done "$1" readonly grep grep ${HOME}
+	export test readonly "$@" then
+	cd && /usr/bin done /usr/bin 2>/dev/null
+$(pwd) test 'quoted text' ${HOME}
+		printf 2>/dev/null export cd done
+	"$1" readonly awk $(pwd) grep 'quoted text'
+${HOME} -eu 'quoted text' | grep sed -eu
+	&& then printf "$1" then local then export sed echo ${HOME} /usr/bin
+/usr/bin $(pwd) "$@" && "$1" $(pwd) 'quoted text'
+test readonly readonly x=1 && ${HOME}
+local test -eu $(pwd) -eu 2>/dev/null
+	| ${HOME} "$@" echo /usr/bin printf
+		export readonly local 'quoted text' && -eu
+	"$1" 2>/dev/null "$@" export
+local "$@" grep local sed && && 2>/dev/null local cd readonly cd printf | done
+	then | | test -eu | |
+local test "$@" $(pwd) printf --verbose grep && then && readonly x=1
+	"$@" cd && export printf cd then $(pwd) x=1
+	grep $(pwd) export --verbose echo awk awk "$1" local printf
+	test --verbose echo local "$1" | cd cd /usr/bin
+	2>/dev/null readonly printf 'quoted text' $(pwd) printf done
+	then ${HOME} | printf printf readonly
+		awk cd printf /usr/bin
+	'quoted text' done echo ${HOME} printf cd then local -eu && printf done
+	export cd then awk then
+	test x=1 cd sed 2>/dev/null | awk /usr/bin ${HOME} "$@" "$1" "$1"
+		cd /usr/bin -eu done sed local &&
+	grep awk export /usr/bin 'quoted text' readonly
+		sed echo local grep done printf echo 2>/dev/null $(pwd)
+		"$1" -eu readonly readonly
+		grep 'quoted text' x=1
+	${HOME} sed then grep done done awk && | 'quoted text'
+	${HOME} awk awk echo -eu test
+		$(pwd) ${HOME} /usr/bin 'quoted text' /usr/bin ${HOME} echo --verbose cd &&
+	"$@" /usr/bin "$1" | "$1" && echo done x=1 x=1 'quoted text'
+2>/dev/null grep local 2>/dev/null
+		"$@" --verbose ${HOME} echo readonly
+		${HOME} /usr/bin echo echo export $(pwd) --verbose -eu "$@" --verbose local
+		'quoted text' test "$1" then cd test "$@" sed grep && | sed
+		2>/dev/null echo -eu /usr/bin --verbose printf --verbose
+readonly echo $(pwd) 'quoted text' done cd echo
+		echo | then readonly && /usr/bin sed x=1 -eu -eu
+&& local readonly then $(pwd) cd readonly && cd -eu --verbose 'quoted text'
+		'quoted text' --verbose test "$@"
+"$1" sed "$@" ${HOME} --verbose x=1 export grep local x=1 cd readonly printf
+	${HOME} grep && done 2>/dev/null "$1" done -eu 2>/dev/null
+	local $(pwd) "$@" $(pwd) export 'quoted text' awk grep
+		awk 'quoted text' | test /usr/bin
+local awk "$1" x=1 printf sed awk test readonly x=1 echo
+	"$1" --verbose --verbose "$1" "$1" 'quoted text' readonly export ${HOME} --verbose
+	printf 'quoted text' 'quoted text'
+	local $(pwd) test ${HOME} /usr/bin cd /usr/bin cd "$@"
+'quoted text' ${HOME} printf local readonly 2>/dev/null "$@" printf
+"$1" /usr/bin grep /usr/bin
+2>/dev/null echo sed && $(pwd) 'quoted text' | x=1 'quoted text'
+	| test sed test cd done done ${HOME} x=1 -eu -eu sed
+/usr/bin /usr/bin && --verbose
+	"$@" $(pwd) printf export ${HOME} test $(pwd) cd $(pwd) sed then /usr/bin ${HOME}
+sed printf awk printf "$1" && printf x=1 'quoted text' "$1" echo 'quoted text'
+		awk echo awk then done | done /usr/bin
+	printf grep done awk awk $(pwd) sed test -eu test sed &&
+$(pwd) --verbose awk 2>/dev/null $(pwd)
+-eu --verbose grep cd then printf echo test test 'quoted text' then
+grep "$@" | /usr/bin done | test --verbose sed grep
+	&& echo readonly readonly
+then --verbose sed --verbose -eu ${HOME}
+	x=1 echo "$@" 2>/dev/null grep test "$@" "$1" $(pwd)
+		"$@" /usr/bin && sed &&
+sed echo done grep printf readonly awk x=1 sed "$@" --verbose ${HOME}
+test printf cd $(pwd) x=1 readonly awk ${HOME} "$1" test "$1" -eu test grep
+	test test | printf $(pwd) && "$@" -eu readonly done --verbose 2>/dev/null
+	"$1" "$1" "$1" grep && x=1 |
+done then test test test "$@"
+	test local local x=1 ${HOME} "$@" -eu printf | $(pwd) $(pwd) 2>/dev/null
+	--verbose sed 2>/dev/null done $(pwd) --verbose test readonly readonly then
+$(pwd) grep sed 'quoted text' -eu &&
+	export awk | done x=1 echo grep | sed cd ${HOME} |
+then $(pwd) cd printf
+export 'quoted text' x=1 | | $(pwd) echo local /usr/bin -eu echo sed
+	-eu printf awk -eu /usr/bin
+		awk cd "$@" readonly grep "$@" awk then "$1" | test 2>/dev/null sed
+		&& -eu export ${HOME} && /usr/bin "$@" readonly $(pwd)
+		printf done sed printf printf readonly
+export -eu test "$@" "$1" 2>/dev/null && export awk ${HOME} cd
+then 'quoted text' | echo grep --verbose sed
+then -eu local $(pwd) "$@" 'quoted text' export --verbose
+readonly export echo | x=1 test awk x=1 -eu "$@" "$@" readonly 'quoted text'
+		readonly && export 2>/dev/null | echo --verbose export
+echo printf local printf | -eu local -eu 2>/dev/null readonly test x=1 export |
+	&& 'quoted text' 2>/dev/null echo && local then "$@" 'quoted text' grep test
+		| x=1 $(pwd) echo cd printf -eu x=1 "$@" ${HOME} --verbose
+"$@" 'quoted text' "$@" "$@" grep "$@" printf printf
+| then export 2>/dev/null && "$@" grep local
+	$(pwd) -eu local readonly readonly export grep && /usr/bin awk export local -eu
+	x=1 readonly --verbose "$1" /usr/bin
+-eu x=1 "$@" echo grep --verbose grep "$1" ${HOME} | "$@"
+		done $(pwd) export "$@" sed --verbose printf export grep then echo | x=1 -eu 2>/dev/null
+	sed readonly then -eu ${HOME} cd $(pwd) && | test -eu
+	export printf echo local ${HOME} | sed "$1" /usr/bin done echo
+	grep local readonly -eu x=1 --verbose echo sed awk ${HOME} ${HOME}
+	2>/dev/null grep -eu 'quoted text'
+	-eu then test && printf | 'quoted text' cd echo readonly export
+	then 2>/dev/null local 'quoted text'
+	export $(pwd) "$@" --verbose | echo done printf echo "$1"
+		done $(pwd) echo test x=1 export export
+		then test test "$1" local 'quoted text' /usr/bin done x=1
+-eu sed cd done "$@" done
+	$(pwd) sed awk && grep awk --verbose 2>/dev/null /usr/bin then export "$@" echo
+	done $(pwd) printf echo readonly readonly cd && "$@" ${HOME}
+-eu done sed sed ${HOME} x=1 && ${HOME} local
+	$(pwd) $(pwd) awk sed printf 2>/dev/null "$@"
+		export grep export -eu cd test 'quoted text' /usr/bin cd --verbose --verbose "$@"
+	| ${HOME} --verbose -eu -eu sed 2>/dev/null
+	"$1" && grep cd echo && echo then echo -eu test | x=1 "$1" $(pwd) local awk /usr/bin
+done grep printf local -eu 2>/dev/null
+	local readonly /usr/bin grep then --verbose test $(pwd) cd
+/usr/bin -eu printf /usr/bin /usr/bin readonly cd printf ${HOME} export
+	printf "$1" $(pwd) 'quoted text' /usr/bin x=1 /usr/bin
+	x=1 $(pwd) echo cd printf "$1" x=1 "$1" "$1" | && then local
+	2>/dev/null grep x=1 cd awk -eu "$@" &&
+"$@" cd "$@" -eu ${HOME} sed test 'quoted text'
+	--verbose | export "$1" && readonly "$@" "$1" local test "$@" | --verbose awk
+	then cd export printf done grep /usr/bin export then echo x=1
+		"$@" /usr/bin export local 2>/dev/null then then --verbose echo grep | printf "$1"
+export /usr/bin --verbose readonly readonly cd
+		readonly && 'quoted text' 'quoted text'
+		-eu x=1 done test ${HOME}
+		printf export sed cd 'quoted text' && echo
+		test awk "$1" done export export
+	sed then | --verbose test awk then 'quoted text' echo /usr/bin cd --verbose
+		'quoted text' 'quoted text' done && 2>/dev/null 2>/dev/null readonly
+	export readonly ${HOME}
+printf grep x=1 'quoted text' -eu printf $(pwd) "$1"
+	echo /usr/bin printf 2>/dev/null done /usr/bin
+	readonly -eu x=1 ${HOME} "$1" local
+printf local echo export /usr/bin 'quoted text' printf
+&& test --verbose done /usr/bin sed 2>/dev/null
+$(pwd) done export 2>/dev/null
+		${HOME} 2>/dev/null then x=1 done x=1 2>/dev/null | "$1" ${HOME}
+		'quoted text' -eu x=1 -eu cd sed sed done local
+--verbose export readonly | "$1" done x=1 readonly
+		$(pwd) readonly local ${HOME} -eu x=1 echo
+export echo then "$1" && then done 2>/dev/null
+-eu echo local sed sed printf readonly && x=1
+		"$@" && x=1 -eu sed then | $(pwd) grep readonly
+	'quoted text' awk x=1 sed printf cd cd 2>/dev/null cd ${HOME}
+		${HOME} cd /usr/bin --verbose "$1" echo cd && awk test "$@" "$@"
+	"$1" done 'quoted text' && export $(pwd) readonly awk --verbose
+		awk echo done | grep "$@" | "$1" "$@" $(pwd) awk ${HOME}
+readonly readonly x=1 -eu sed x=1
+	local cd --verbose "$1" 2>/dev/null then export $(pwd) -eu then export
+"$1" --verbose printf 2>/dev/null && printf
+test 2>/dev/null "$@" echo -eu && cd /usr/bin readonly "$1" "$1" $(pwd)
+test then then --verbose | 2>/dev/null | grep ${HOME} sed "$1" "$1" x=1
+export printf && printf 'quoted text'
+"$@" "$1" /usr/bin export | 2>/dev/null "$1" awk -eu "$@" 'quoted text' then
+		echo local -eu sed 'quoted text' | local ${HOME} awk grep readonly echo local
+	--verbose ${HOME} export $(pwd) ${HOME} "$@" "$1" printf done "$1" sed $(pwd) printf
+local sed printf "$@" /usr/bin printf /usr/bin echo cd --verbose echo sed
+		--verbose local x=1 x=1 && "$1" | export awk /usr/bin
+	&& awk "$1" sed | cd export
+		$(pwd) cd "$1" x=1 awk printf
+	grep local 2>/dev/null x=1
+sed echo awk 2>/dev/null ${HOME} cd test
+		readonly then export then "$1"
+		done grep 'quoted text' sed test test 'quoted text' echo awk ${HOME} printf
+| --verbose $(pwd) sed readonly printf
+		'quoted text' printf | awk printf 'quoted text'
+awk grep printf | echo export "$1" echo $(pwd) grep test x=1 /usr/bin grep
+"$1" readonly | 'quoted text' $(pwd) "$1"
+	readonly test test export awk
+sed grep readonly export readonly
+$(pwd) sed /usr/bin printf readonly "$1" 'quoted text' echo grep "$1"
+x=1 "$@" echo readonly done printf -eu 'quoted text'
+	$(pwd) "$@" "$@" "$@" grep local grep then printf cd 'quoted text'
+	test sed export "$@" 'quoted text' --verbose sed readonly
+	printf local --verbose local readonly
+		$(pwd) -eu echo "$1" grep x=1 'quoted text' cd --verbose
+		&& | echo awk cd grep $(pwd)
+		"$1" export grep 'quoted text'
+		x=1 sed test test ${HOME} --verbose local local "$1" awk done |
+		then local ${HOME} "$1"
+export --verbose | readonly && awk
+	&& local then ${HOME} export done local && echo then
+	$(pwd) printf sed "$@" cd ${HOME} /usr/bin printf ${HOME}
+		sed sed -eu $(pwd) sed | printf sed $(pwd) 2>/dev/null local
+	printf 2>/dev/null test sed export
+echo sed | && 'quoted text'
+2>/dev/null $(pwd) 2>/dev/null x=1 export then "$1" echo $(pwd)
+	--verbose --verbose sed /usr/bin grep printf
+		"$1" local test test --verbose "$1" printf "$@" readonly 'quoted text'
+sed readonly export x=1 sed done ${HOME} "$1" --verbose then grep sed "$1"
+		'quoted text' 'quoted text' ${HOME} 2>/dev/null grep test ${HOME} "$@" | -eu
+/usr/bin awk "$1" --verbose 2>/dev/null
+	"$1" test "$1" sed then sed then export "$@"
+	-eu 2>/dev/null $(pwd) export then
+		awk 'quoted text' export then done ${HOME} awk "$@" $(pwd) grep
+	-eu | echo ${HOME} printf grep 'quoted text' 2>/dev/null && printf
+	/usr/bin echo then sed printf -eu 2>/dev/null
+		readonly cd "$1" local 'quoted text' "$1" ${HOME} x=1 -eu /usr/bin readonly
+		-eu | ${HOME} --verbose | | then
+		printf "$1" then echo done --verbose x=1
+	$(pwd) grep && -eu && readonly
+		&& x=1 "$1" echo awk awk $(pwd) readonly grep cd sed "$@" "$1" sed "$@" echo done
+	printf "$1" "$@" ${HOME} sed && then printf |
+/usr/bin 2>/dev/null cd 'quoted text'
+	echo local test $(pwd) cd 'quoted text' x=1 $(pwd) echo 2>/dev/null
+	grep done cd test &&
+	then export | "$@" "$@" grep export echo 2>/dev/null
+		"$1" local cd sed sed 'quoted text' echo
+		sed cd /usr/bin -eu test
+x=1 && "$1" export cd "$@" done sed && x=1 ${HOME} sed ${HOME}
+	export -eu grep --verbose export && awk export local "$1" /usr/bin
+		readonly -eu echo done awk awk "$1" "$1" export readonly
+	sed 'quoted text' "$1" x=1 printf printf local local "$1" --verbose local test readonly
+| cd --verbose export sed x=1 ${HOME} sed /usr/bin "$1" -eu sed x=1
+printf test | $(pwd) then printf test then "$1"
+2>/dev/null local ${HOME}
+&& 'quoted text' grep done awk done "$1" | done readonly test 'quoted text'
+/usr/bin awk readonly export
+	done 'quoted text' readonly -eu grep && | --verbose
+	local echo cd | done done -eu --verbose
+		printf 2>/dev/null --verbose ${HOME} sed awk /usr/bin echo echo readonly
+		sed -eu | readonly 2>/dev/null
+	${HOME} 'quoted text' -eu
+	$(pwd) local "$@" done test /usr/bin ${HOME} | x=1 | 'quoted text'
+		| export then readonly -eu $(pwd) "$@" done |
+		/usr/bin 'quoted text' grep export test ${HOME} echo
+		"$1" "$1" printf 2>/dev/null local ${HOME} -eu "$1" awk
+		awk done awk 2>/dev/null -eu done then printf ${HOME} -eu
+	then /usr/bin printf ${HOME} | printf
+cd local done then "$1"
+	local x=1 "$1" echo 2>/dev/null then
+	export | test sed done done $(pwd) awk --verbose cd 2>/dev/null
+/usr/bin test test done
+		cd ${HOME} /usr/bin printf && export awk readonly
+	"$1" && readonly grep cd export /usr/bin -eu && echo -eu grep grep
+${HOME} "$@" 2>/dev/null grep test then done | export sed readonly
+		| readonly /usr/bin "$1" 2>/dev/null export /usr/bin
+		readonly test "$@" 2>/dev/null
+/usr/bin export && | printf printf /usr/bin "$1"
+export grep --verbose awk grep sed "$1" "$@" "$@"
+	awk $(pwd) awk $(pwd) sed sed readonly /usr/bin readonly /usr/bin -eu
+		readonly --verbose done 'quoted text' sed then done && done | "$1" x=1 done
+		"$1" /usr/bin export test local |
+local printf x=1 /usr/bin done "$1"
+		$(pwd) awk "$1" 2>/dev/null "$@" && $(pwd) x=1 done 2>/dev/null /usr/bin awk
+		readonly readonly test -eu echo 'quoted text' awk | "$1"
+	readonly x=1 test "$@" | cd | export
+local && x=1 test --verbose then printf 'quoted text' -eu printf $(pwd) sed
+	${HOME} awk x=1 export --verbose cd echo done readonly "$@" --verbose
+		/usr/bin 'quoted text' done 2>/dev/null cd sed $(pwd) sed "$@" then test
+| && x=1 cd x=1 readonly readonly /usr/bin sed local 2>/dev/null
+done grep && export grep test export export "$1" -eu export cd
+		2>/dev/null $(pwd) 'quoted text'
+		test printf printf $(pwd)
+/usr/bin /usr/bin test test --verbose
+		printf then x=1 printf done readonly done x=1 x=1 "$1" x=1 echo then && && local
+		-eu x=1 then readonly test grep -eu export then 'quoted text' export
+		| "$1" grep sed ${HOME} sed "$1"
+	'quoted text' -eu then /usr/bin 2>/dev/null cd 'quoted text' "$@"
+	${HOME} done $(pwd) printf export
+	&& | cd done -eu x=1 cd -eu 'quoted text'
+	local awk export export readonly cd test
+		'quoted text' readonly | export ${HOME}
+	awk "$1" -eu "$@" sed grep cd 2>/dev/null done -eu "$1" | "$1"
+test 'quoted text' awk x=1 --verbose --verbose /usr/bin done printf export
+"$1" export $(pwd) "$1" && cd cd done x=1 cd 'quoted text' test 2>/dev/null
+	x=1 test "$1" "$1" 2>/dev/null 2>/dev/null
+		echo ${HOME} done x=1 printf -eu echo && 2>/dev/null local
+	&& --verbose local sed then
+		grep done cd cd grep "$1" sed printf | test awk printf
+export grep printf "$@" then cd --verbose 'quoted text'
+	2>/dev/null $(pwd) printf local | 'quoted text'
+	2>/dev/null sed readonly cd local "$@" --verbose cd cd $(pwd)
+	then echo awk sed && -eu echo 'quoted text' grep "$@" "$@" sed ${HOME} readonly
+--verbose --verbose printf printf
+	--verbose awk ${HOME} -eu | -eu
+"$@" readonly readonly sed test --verbose
+	printf sed "$@" grep | 'quoted text' readonly $(pwd) "$@" cd --verbose
+		/usr/bin sed local done $(pwd) x=1 test done "$1"
+		grep done -eu sed local
+	/usr/bin then "$@" 'quoted text' printf cd | echo then | export awk "$1" 'quoted text'
+	${HOME} | /usr/bin "$1" "$@" sed /usr/bin ${HOME} | /usr/bin printf "$@"
+	cd local local && test echo "$1" printf x=1 sed $(pwd) awk
+${HOME} export && "$@" echo
+cd -eu "$@" test ${HOME} export 'quoted text' x=1 awk 'quoted text' "$1"
+		$(pwd) done x=1 done 2>/dev/null test grep readonly $(pwd)
+	local awk "$@" then /usr/bin "$1" echo local -eu local
+"$@" "$1" local local ${HOME}
+	test cd test | sed local printf awk
+		"$1" grep ${HOME} printf "$1" printf echo 2>/dev/null x=1 awk echo export "$@"
+readonly x=1 && awk readonly printf | "$@" awk 'quoted text' done
+		done export cd export ${HOME} 2>/dev/null 'quoted text' done sed export
+	&& 2>/dev/null $(pwd) cd /usr/bin
+		'quoted text' done done 2>/dev/null local && done sed 2>/dev/null printf awk
+		'quoted text' grep "$1" -eu 2>/dev/null printf "$1" printf && | local 2>/dev/null
+| ${HOME} ${HOME} -eu $(pwd) "$@" grep --verbose ${HOME} -eu printf
+done $(pwd) sed echo --verbose | x=1 readonly sed
+	cd export x=1 echo sed grep 2>/dev/null awk
+	done x=1 done $(pwd) --verbose cd done awk cd
+	grep "$@" sed --verbose printf -eu 'quoted text' $(pwd)
+		sed sed awk sed | 'quoted text' -eu awk /usr/bin done echo cd sed 'quoted text'
+export /usr/bin awk 2>/dev/null done x=1 | "$1" 'quoted text'
+$(pwd) | | ${HOME} readonly /usr/bin $(pwd) local "$@" 2>/dev/null
+	$(pwd) awk "$@" | && grep then printf printf "$1" "$1" test && local &&
+'quoted text' --verbose then --verbose /usr/bin readonly printf done awk 2>/dev/null
+--verbose && then 'quoted text'
+test done "$@" 2>/dev/null export | cd export awk done
+		echo -eu test | "$1" sed 2>/dev/null ${HOME} "$@" 2>/dev/null
+-eu 'quoted text' echo done then && echo
+x=1 echo "$1" printf then echo "$1" 2>/dev/null
+	"$1" cd awk 2>/dev/null echo | readonly | "$@" 'quoted text' 'quoted text'
+	2>/dev/null "$1" awk --verbose readonly && export sed echo "$1" local
+		readonly done 2>/dev/null echo 2>/dev/null ${HOME}
+awk then cd 'quoted text' 'quoted text' awk local 'quoted text' grep
+$(pwd) readonly -eu cd echo sed -eu export "$@" done readonly -eu "$@"
+		/usr/bin | cd echo export
+then sed /usr/bin awk 'quoted text'
+		test -eu && && 'quoted text' local awk printf -eu export &&
+		echo done awk test "$1"
+	done awk sed local cd 2>/dev/null
+	| -eu | "$1" && /usr/bin ${HOME} ${HOME}
+		"$1" done cd readonly && awk && "$1"
+		sed echo test | echo $(pwd) awk 'quoted text' 2>/dev/null /usr/bin
+cd 2>/dev/null 'quoted text' readonly test export 'quoted text' local 'quoted text'
+		'quoted text' && /usr/bin test
+"$1" done 2>/dev/null "$1" done export 2>/dev/null
+echo x=1 "$@" $(pwd) readonly done test -eu sed ${HOME} --verbose "$1" local /usr/bin
+		| "$1" printf ${HOME} readonly done export "$1"
+	&& then x=1 printf done /usr/bin "$@" printf
+	2>/dev/null /usr/bin --verbose 2>/dev/null readonly readonly done echo
+local sed sed "$@" sed sed 'quoted text' 'quoted text'
+$(pwd) | readonly ${HOME} 2>/dev/null printf then done ${HOME}
+sed "$@" export 2>/dev/null -eu export readonly echo 2>/dev/null -eu
+		| ${HOME} $(pwd) grep awk echo echo $(pwd) awk grep done /usr/bin 'quoted text'
+x=1 sed awk test $(pwd) x=1 echo then "$1" then sed then 2>/dev/null
+		-eu then | $(pwd) /usr/bin "$1" sed grep readonly /usr/bin --verbose 2>/dev/null
+export grep test test
+		readonly printf && done cd cd echo "$1" done cd echo readonly echo /usr/bin
+readonly | | readonly --verbose sed $(pwd) readonly sed done
+	"$@" | $(pwd) test $(pwd)
+2>/dev/null /usr/bin printf export ${HOME} grep /usr/bin 'quoted text'
+		'quoted text' grep echo echo "$1" --verbose
+	"$@" ${HOME} done 2>/dev/null export export $(pwd) /usr/bin x=1
+&& local cd "$@" -eu cd test --verbose
+		readonly && export ${HOME} grep 'quoted text' && test x=1 awk | awk readonly
+${HOME} awk readonly export x=1 "$1" then then -eu | --verbose cd
+--verbose x=1 grep $(pwd) done ${HOME} | export && 'quoted text'
+		2>/dev/null readonly ${HOME} echo | printf printf "$1" test echo "$1" |
+		grep ${HOME} /usr/bin x=1 printf x=1 ${HOME}
+		&& readonly $(pwd) --verbose awk ${HOME} export awk 'quoted text' then
+	then sed readonly x=1 local 2>/dev/null
+"$@" sed /usr/bin 2>/dev/null readonly -eu | readonly local |
+	$(pwd) $(pwd) local printf
+		-eu 'quoted text' echo && 'quoted text' cd /usr/bin test "$1" "$@" $(pwd) $(pwd)
+	${HOME} x=1 /usr/bin $(pwd) export $(pwd) | done
+		then $(pwd) sed export grep awk export readonly && 2>/dev/null grep
+awk 'quoted text' then cd $(pwd) printf sed echo $(pwd) -eu
@@ -0,0 +1,2001 @@
+	--verbose && echo then awk done test
+done "$1" readonly -eu readonly -eu
+	awk x=1 echo 'quoted text' echo
+		$(pwd) /usr/bin awk sed local "$1"
+	then echo local x=1 test &&
+'quoted text' ${HOME} -eu ${HOME} cd -eu grep 'quoted text' awk x=1 done x=1 readonly
+	awk cd /usr/bin sed printf "$@" /usr/bin | readonly
+		test export readonly awk "$@" x=1 awk readonly done
+	2>/dev/null && -eu export local
+		grep cd readonly echo then $(pwd) sed readonly --verbose awk export
+	'quoted text' $(pwd) $(pwd) awk ${HOME} readonly ${HOME} done /usr/bin
+cd "$@" printf done cd then x=1 sed x=1 && $(pwd) --verbose -eu 2>/dev/null printf
+/usr/bin x=1 readonly then "$@" --verbose | "$1" local
+&& "$@" --verbose cd $(pwd) "$1" readonly | "$@" | awk cd x=1
+export printf done "$@" x=1 echo export printf
+		'quoted text' && grep -eu | "$1" --verbose printf --verbose
+		cd sed $(pwd) awk sed cd /usr/bin grep export /usr/bin "$1" test && &&
+awk export test then then export then "$1" /usr/bin test grep
+		${HOME} 'quoted text' "$@" readonly | 2>/dev/null local readonly export && "$1"
+		2>/dev/null sed /usr/bin
+	sed printf echo -eu test "$@" local $(pwd) /usr/bin | 'quoted text'
+		x=1 local "$@" sed --verbose "$@"
+		then $(pwd) --verbose -eu printf &&
+	${HOME} then "$@" readonly test && export printf cd && export test /usr/bin
+done export test x=1 test && local echo /usr/bin export ${HOME}
+		"$@" 'quoted text' echo sed x=1 echo done cd sed 2>/dev/null -eu printf $(pwd) "$@"
+		cd /usr/bin export awk test sed test then 'quoted text' /usr/bin export
+		test "$1" sed 'quoted text' | local sed "$1" 'quoted text' printf 'quoted text'
+x=1 "$1" test test $(pwd) sed cd
+cd x=1 'quoted text' 'quoted text'
+'quoted text' printf cd && $(pwd) done done cd
+		readonly local sed "$1"
+		'quoted text' 'quoted text' cd 'quoted text' then
+	printf local "$1" --verbose "$@" local
+		"$@" 'quoted text' local local readonly -eu && printf | && $(pwd)
+		"$1" export ${HOME} test printf echo 2>/dev/null
+		-eu $(pwd) -eu grep 'quoted text' grep "$1" readonly local | $(pwd) printf
+${HOME} done export then then echo -eu "$1" cd "$@" done --verbose
+	cd awk -eu cd done $(pwd)
+	'quoted text' ${HOME} then cd 2>/dev/null ${HOME} then ${HOME} export &&
+	readonly then "$@" 2>/dev/null awk "$@" -eu -eu awk done done done /usr/bin sed
+cd && sed /usr/bin "$1" done
+	cd echo 2>/dev/null awk 'quoted text' 2>/dev/null "$@" 'quoted text' cd echo done
+echo /usr/bin done -eu then cd awk $(pwd) 2>/dev/null x=1 /usr/bin cd ${HOME}
+		sed $(pwd) then sed sed $(pwd) && ${HOME} cd sed
+		'quoted text' 'quoted text' "$1" readonly
+"$1" $(pwd) readonly printf grep
+"$1" 'quoted text' test && -eu "$1"
+		echo ${HOME} "$@" done --verbose "$1" cd local echo 2>/dev/null sed | "$@" local
+| 'quoted text' ${HOME} "$1" -eu
+		2>/dev/null echo readonly grep x=1 -eu
+	--verbose --verbose echo
+	'quoted text' | ${HOME} echo "$@" export
+	$(pwd) local -eu 'quoted text' | then cd /usr/bin 'quoted text' printf "$1" 'quoted text'
+| sed printf awk "$@" 'quoted text' export
+		-eu $(pwd) grep grep awk --verbose /usr/bin | grep then awk
+	x=1 -eu awk local export export
+	local test "$@" $(pwd) 'quoted text' then readonly /usr/bin awk --verbose done
+"$@" 'quoted text' done local then && -eu 'quoted text'
+	--verbose "$1" "$@" $(pwd) /usr/bin x=1 export test /usr/bin "$@" x=1 printf
+	awk printf "$1" echo | sed "$1" && grep "$@"
+&& then 2>/dev/null export awk ${HOME} then | 'quoted text'
+		echo awk $(pwd) --verbose printf printf
+	-eu | awk /usr/bin then "$@" | --verbose
+		readonly printf grep "$1" sed cd ${HOME} done cd x=1 done
+export "$@" cd /usr/bin -eu done $(pwd)
+		cd /usr/bin | awk x=1 test sed printf --verbose export
+	grep grep echo sed test /usr/bin "$@" $(pwd) --verbose -eu 2>/dev/null
+	"$@" 'quoted text' cd export test | readonly
+"$1" local awk readonly | 2>/dev/null then readonly 'quoted text'
+	printf "$1" local done awk done 'quoted text' 2>/dev/null echo export sed "$1"
+	&& readonly /usr/bin readonly -eu && /usr/bin
+	&& then grep readonly export ${HOME}
+		test && -eu test "$1" grep echo printf $(pwd)
+	"$@" export | -eu ${HOME} $(pwd) "$1" ${HOME} && awk
+	cd "$@" --verbose "$1" -eu -eu && "$1" "$1" sed export sed
+printf | ${HOME} sed "$1" /usr/bin echo local $(pwd) "$1" && done
+	test echo local -eu ${HOME} ${HOME} printf "$@" printf readonly --verbose
+	/usr/bin 'quoted text' test -eu /usr/bin export cd local awk done &&
+	x=1 local /usr/bin grep local cd
+		local test 2>/dev/null "$1" 2>/dev/null "$1" && cd x=1 && export
+		test -eu && local grep local test grep "$1" sed readonly "$1" echo
+		test /usr/bin "$1" ${HOME} $(pwd) test readonly
+		local 'quoted text' -eu /usr/bin local
+done done | -eu cd local | --verbose cd "$1"
+		awk /usr/bin local done
+		-eu && done done 2>/dev/null "$1" awk ${HOME}
+grep "$1" "$@" cd done then $(pwd) awk 'quoted text' 2>/dev/null 2>/dev/null
+"$1" then $(pwd) ${HOME} 'quoted text'
+		then "$@" /usr/bin export
+test "$1" x=1 x=1 done cd echo
+		| then ${HOME} cd $(pwd) export && "$@" cd "$1" "$@" export
+printf $(pwd) /usr/bin x=1 printf x=1 echo export
+printf ${HOME} /usr/bin
+	x=1 awk export cd cd export
+		echo grep ${HOME} 2>/dev/null printf "$@" -eu test readonly export && /usr/bin
+	$(pwd) sed ${HOME} /usr/bin
+	export -eu local -eu $(pwd)
+"$1" x=1 /usr/bin ${HOME} "$1" 2>/dev/null awk then sed ${HOME}
+		printf grep done then then awk printf test ${HOME} printf x=1 ${HOME}
+	then -eu --verbose then $(pwd) readonly echo
+readonly /usr/bin echo echo 'quoted text' cd x=1 done done ${HOME} then && cd
+awk then --verbose export --verbose "$@" test
+		test sed local /usr/bin ${HOME} readonly
+		"$@" printf | && 2>/dev/null
+echo | printf /usr/bin readonly && export /usr/bin
+awk /usr/bin test test $(pwd) cd "$@"
+		'quoted text' "$1" export | /usr/bin
+awk x=1 ${HOME} /usr/bin && | ${HOME} cd x=1 2>/dev/null export test done "$@"
+		'quoted text' -eu $(pwd) $(pwd) printf
+		--verbose 'quoted text' local printf
+		grep test sed /usr/bin then x=1 --verbose readonly export
+		local 2>/dev/null printf printf $(pwd)
+'quoted text' x=1 sed echo cd sed printf
+		x=1 2>/dev/null local sed local grep grep 'quoted text' ${HOME} printf readonly
+${HOME} 'quoted text' 2>/dev/null
+		-eu printf /usr/bin 2>/dev/null && | | 'quoted text' then "$@"
+		cd local readonly local --verbose
+		2>/dev/null --verbose "$1"
+	then grep ${HOME} grep | export cd "$1" "$@" "$@" sed then $(pwd) echo $(pwd)
+		sed sed ${HOME} test 2>/dev/null "$@" echo 2>/dev/null
+--verbose done export then done x=1 "$1" export
+$(pwd) --verbose export grep -eu 2>/dev/null --verbose awk awk 2>/dev/null
+$(pwd) sed echo readonly /usr/bin readonly export awk sed $(pwd) --verbose
+sed x=1 readonly sed printf sed local grep && export
+&& grep | /usr/bin 2>/dev/null
+${HOME} x=1 then 'quoted text'
+		cd done "$1" | then done --verbose "$@" then then local then
+&& x=1 awk && && ${HOME} echo $(pwd) ${HOME} done then awk 2>/dev/null
+		-eu readonly $(pwd) sed then echo readonly x=1 &&
+		-eu echo then 2>/dev/null grep --verbose awk -eu -eu /usr/bin
+	readonly --verbose sed done awk /usr/bin
+		done 'quoted text' awk done "$@" && printf
+'quoted text' x=1 "$1" 2>/dev/null
+	/usr/bin 'quoted text' | echo "$1" test readonly then done /usr/bin
+--verbose --verbose printf -eu x=1
+$(pwd) $(pwd) printf x=1 export echo done test $(pwd)
+		${HOME} $(pwd) 'quoted text' echo
+printf sed $(pwd) 'quoted text' echo echo printf
+	cd cd "$@" test printf $(pwd) then echo readonly awk
+	then then export | readonly "$1" x=1 /usr/bin | echo x=1 -eu test sed
+	done -eu then done awk 2>/dev/null "$@" awk
+local ${HOME} echo export test
+	$(pwd) "$1" | export "$1" /usr/bin --verbose
+2>/dev/null | printf | readonly
+	then echo $(pwd) ${HOME} -eu "$@" /usr/bin grep printf awk $(pwd)
+echo 'quoted text' | "$1" ${HOME} done "$1"
+2>/dev/null "$1" sed cd awk x=1 && then
+	echo echo $(pwd) awk then
+then --verbose | && x=1 local
+		x=1 2>/dev/null local done echo --verbose
+	cd awk -eu readonly echo | local | echo 2>/dev/null
+sed cd && -eu --verbose readonly ${HOME} local -eu test sed $(pwd)
+	x=1 grep --verbose | 'quoted text' done sed export | export
+	grep -eu echo export -eu $(pwd) ${HOME} cd ${HOME}
+		'quoted text' x=1 $(pwd) x=1 2>/dev/null
+done 'quoted text' printf 2>/dev/null && "$@" "$1"
+2>/dev/null export test echo echo x=1 -eu done | readonly "$1" ${HOME}
+'quoted text' local | -eu export "$@" $(pwd) then local
+'quoted text' sed 'quoted text' done then --verbose "$1" test
+awk test 2>/dev/null test sed -eu "$1" "$@"
+	$(pwd) readonly sed test $(pwd) /usr/bin
+		test "$1" printf ${HOME} 2>/dev/null readonly &&
+	'quoted text' $(pwd) && -eu
+		echo done test readonly /usr/bin done $(pwd) $(pwd) /usr/bin
+	awk x=1 export grep done -eu awk then ${HOME} sed echo "$@" 2>/dev/null
+$(pwd) done --verbose /usr/bin done done -eu |
+	/usr/bin then "$@" sed printf 2>/dev/null echo "$@" /usr/bin $(pwd) then
+awk 2>/dev/null 'quoted text' | grep
+		export "$@" awk cd readonly 'quoted text' ${HOME}
+	then done --verbose -eu grep sed
+then then printf && readonly sed then then && echo readonly 'quoted text'
+	&& awk readonly 2>/dev/null --verbose local | -eu x=1 && && cd test
+"$1" test 2>/dev/null 2>/dev/null | x=1 ${HOME} --verbose sed x=1 test
+local awk "$@" x=1 /usr/bin && $(pwd) ${HOME}
+		test $(pwd) then awk -eu readonly /usr/bin test local
+&& test test grep $(pwd) echo -eu $(pwd) printf /usr/bin grep --verbose
+&& "$@" ${HOME} local test readonly | local then "$1" done readonly echo sed echo
+		'quoted text' 2>/dev/null 2>/dev/null readonly cd echo grep "$@"
+export sed /usr/bin && readonly | then 'quoted text' readonly
+printf "$1" sed then done test done 2>/dev/null | cd "$1" x=1 "$@" local && awk
+		&& grep then | cd local --verbose 'quoted text'
+		2>/dev/null "$@" awk then "$1"
+cd grep 2>/dev/null "$@" awk && x=1 printf
+done then x=1 "$1" x=1 grep "$1"
+	/usr/bin x=1 printf "$@" test printf
+		"$1" test readonly local && 2>/dev/null export cd 2>/dev/null export done
+$(pwd) $(pwd) readonly x=1 "$@" -eu
+	echo awk "$@" -eu --verbose echo && echo done
+		then echo 2>/dev/null "$1" x=1 then | sed x=1 "$1" grep local readonly cd test
+	&& "$@" -eu ${HOME} grep | --verbose export grep awk "$1" ${HOME} grep
+		then export then export $(pwd) -eu 'quoted text' && cd export --verbose 'quoted text'
+2>/dev/null sed awk && then x=1 ${HOME} test 'quoted text'
+	| readonly --verbose printf "$@" export
+		'quoted text' local --verbose cd "$1" -eu --verbose
+		test echo local "$1" && readonly done ${HOME} 2>/dev/null
+		readonly ${HOME} export export ${HOME} --verbose printf /usr/bin cd done then
+export --verbose then $(pwd) | sed | local $(pwd) "$1" | done "$1" ${HOME}
+	'quoted text' --verbose then then x=1 -eu
+	/usr/bin then awk 'quoted text' ${HOME} 'quoted text' grep
+	local 'quoted text' export readonly
+		grep echo --verbose 2>/dev/null then --verbose
+${HOME} 'quoted text' 2>/dev/null "$@" && "$@"
+		cd 'quoted text' x=1 grep && grep $(pwd) x=1 test awk echo 'quoted text'
+	local readonly ${HOME} "$@" 'quoted text' sed 2>/dev/null
+done test local cd awk && cd --verbose x=1 echo readonly --verbose && | && -eu
+$(pwd) awk test grep readonly grep /usr/bin -eu "$@"
+	"$@" -eu local /usr/bin then cd 'quoted text' test && local ${HOME}
+	awk awk printf && echo $(pwd) echo 'quoted text' 'quoted text' test | "$@"
+		'quoted text' | x=1 local $(pwd) test "$1"
+&& awk done "$@" cd $(pwd) readonly cd ${HOME} echo
+		echo "$@" printf awk printf -eu "$1" 2>/dev/null
+	sed sed local "$1" test
+	-eu cd done grep && printf 2>/dev/null && cd test
+| readonly && test echo --verbose test echo
+	&& x=1 /usr/bin printf cd && $(pwd) ${HOME} readonly 2>/dev/null 2>/dev/null
+printf sed grep && grep echo then && sed
+		$(pwd) sed awk echo cd test printf 2>/dev/null
+	x=1 /usr/bin then then test then test 'quoted text' awk x=1 "$@" echo $(pwd)
+		readonly | cd export --verbose test x=1 grep printf 2>/dev/null
+	sed done cd then printf local
+done sed && test printf grep test -eu done done ${HOME} readonly 2>/dev/null readonly
+	&& "$@" test readonly local done
+	echo echo export done -eu then /usr/bin awk sed test cd 2>/dev/null "$1" then
+$(pwd) readonly cd ${HOME} $(pwd) export "$@" && export && $(pwd) /usr/bin awk local
+	x=1 "$1" readonly 2>/dev/null test readonly grep 'quoted text' printf x=1
+		&& 2>/dev/null readonly /usr/bin then
+		cd test 'quoted text' x=1 cd
+		echo test printf done --verbose | 2>/dev/null $(pwd) grep test readonly ${HOME}
+	"$@" readonly | grep cd readonly
+		${HOME} local --verbose printf echo test export $(pwd) test -eu done readonly
+		&& && then --verbose && done | printf cd test /usr/bin
+	local readonly echo printf readonly --verbose
+	readonly "$@" test x=1 "$@" echo export -eu done readonly && test -eu | x=1
+/usr/bin "$@" --verbose 'quoted text'
+/usr/bin printf "$@" export
+	$(pwd) ${HOME} x=1 ${HOME} "$1" echo "$@" printf then ${HOME}
+	local echo ${HOME} /usr/bin x=1 ${HOME}
+echo "$1" /usr/bin -eu "$@" ${HOME} readonly "$1" echo
+	2>/dev/null export /usr/bin $(pwd) "$1" then "$1" grep done -eu x=1 && --verbose
+	2>/dev/null done cd done && 'quoted text' export ${HOME}
+	x=1 /usr/bin test /usr/bin 'quoted text'
+	"$@" "$1" "$@" --verbose 'quoted text'
+		| /usr/bin $(pwd) then /usr/bin echo
+printf -eu readonly | then export awk 'quoted text' test test | sed
+		--verbose then /usr/bin $(pwd) /usr/bin -eu then readonly "$@" "$@" "$1" -eu
+		done grep "$@" $(pwd) "$@" grep export printf awk awk cd $(pwd)
+	done ${HOME} then -eu test
+grep awk sed printf readonly "$1" awk "$1" grep grep "$1" printf "$@" -eu
+	local ${HOME} printf sed readonly && /usr/bin export
+		sed $(pwd) export export
+	cd 'quoted text' export 'quoted text' local && awk | done
+	printf printf awk done test x=1 local && printf -eu cd x=1 cd test "$@"
+"$@" 2>/dev/null printf local done x=1 export
+		printf local | /usr/bin "$@" local "$1" awk /usr/bin test 2>/dev/null
+	export --verbose sed "$1" export "$1" 2>/dev/null
+done test "$@" then then export done 'quoted text' local
+		readonly local local
+done export && readonly 2>/dev/null awk "$@" -eu x=1 "$@" "$1" --verbose
+	"$1" printf cd "$@" "$1" --verbose
+readonly test sed x=1 "$1" export test echo local awk printf cd --verbose grep
+	'quoted text' cd echo "$@" done "$@" "$@" export 'quoted text'
+		&& local && export sed x=1 && | "$@" |
+	2>/dev/null grep ${HOME} && $(pwd) -eu awk done 'quoted text' local test
+		printf x=1 "$@" x=1 "$@" "$1" readonly awk local awk ${HOME} /usr/bin $(pwd) echo
+	local export 'quoted text'
+x=1 then readonly /usr/bin /usr/bin 2>/dev/null echo
+sed then "$1" $(pwd) && 'quoted text' 'quoted text'
+		test test then readonly printf echo readonly
+		'quoted text' printf printf ${HOME} 2>/dev/null
+"$@" ${HOME} printf | test done local 2>/dev/null && "$@" done
+local "$1" | cd 'quoted text' awk done 'quoted text' then export | readonly
+	/usr/bin "$@" cd then printf sed "$@" --verbose x=1 grep
+done done | x=1 ${HOME} x=1 && sed /usr/bin
+		"$@" grep ${HOME} "$1" -eu echo export && -eu 2>/dev/null
+--verbose cd readonly | 2>/dev/null printf "$@" local awk x=1 cd done echo
+local export local awk "$@" $(pwd) --verbose /usr/bin test
+	'quoted text' x=1 done done
+	echo $(pwd) test printf done echo ${HOME} | printf
+'quoted text' /usr/bin local sed && awk awk echo
+		done 'quoted text' echo 'quoted text'
+	"$@" echo export printf | ${HOME} local test -eu grep readonly
+	${HOME} x=1 readonly 2>/dev/null 2>/dev/null awk $(pwd) --verbose printf -eu sed
+		| readonly | $(pwd) | grep awk cd 'quoted text' ${HOME} -eu
+		$(pwd) $(pwd) cd sed "$@" local readonly -eu readonly cd done cd readonly "$@"
+	readonly ${HOME} /usr/bin ${HOME}
+echo printf $(pwd) && && local
+		$(pwd) then 2>/dev/null printf | export readonly "$@"
+${HOME} cd $(pwd) "$1" && export "$1" ${HOME} done
+--verbose "$@" readonly
+		cd && then $(pwd) local local "$@" ${HOME} done /usr/bin
+	"$1" export then -eu 2>/dev/null readonly
+		printf test /usr/bin local
+'quoted text' printf echo "$@" 'quoted text'
+	2>/dev/null && $(pwd) sed readonly local
+'quoted text' cd export | 'quoted text' --verbose
+export "$@" done 'quoted text' grep x=1 "$@" "$1" --verbose $(pwd) local
+		x=1 2>/dev/null export done 2>/dev/null export
+	"$@" then | readonly $(pwd) printf printf readonly
+printf grep ${HOME} done && test
+echo $(pwd) "$1" "$1" && readonly /usr/bin "$1" /usr/bin local --verbose
+	echo "$1" export readonly
+	2>/dev/null $(pwd) /usr/bin cd local ${HOME} -eu "$1" printf
+		| grep awk then && printf | --verbose /usr/bin cd grep x=1 sed
+	--verbose export grep --verbose $(pwd) then test then |
+	printf x=1 local grep grep /usr/bin grep 'quoted text' && cd "$@" ${HOME}
+		awk /usr/bin && sed then /usr/bin | cd grep cd
+test sed && -eu /usr/bin
+export readonly export export cd sed && printf |
+		done cd --verbose 2>/dev/null $(pwd)
+	test && local then echo "$@" grep -eu 2>/dev/null echo /usr/bin sed
+"$1" x=1 local export sed local 2>/dev/null /usr/bin "$@" test cd echo "$1"
+local ${HOME} --verbose 2>/dev/null
+	2>/dev/null export "$@" then x=1 echo sed grep test
+		x=1 sed then -eu awk | sed done readonly | x=1 grep then done
+sed --verbose $(pwd) | cd $(pwd) grep "$1" awk
+	local x=1 $(pwd) local sed export
+readonly x=1 -eu --verbose awk echo printf sed && local done then | -eu "$@"
+		"$1" printf --verbose done done grep "$@" /usr/bin $(pwd)
+	"$@" echo cd echo | -eu readonly printf /usr/bin
+	grep | echo then | local x=1 cd export | test --verbose | | x=1 test sed "$@"
+"$1" test && export export printf grep /usr/bin printf grep
+	x=1 echo 2>/dev/null sed $(pwd) && "$1" --verbose
+	2>/dev/null printf 'quoted text' && 'quoted text'
+'quoted text' then local readonly then cd 'quoted text' sed cd then printf printf
+grep --verbose "$@" grep
+local && 'quoted text' x=1
+	'quoted text' echo then awk $(pwd) 2>/dev/null echo -eu "$1"
+	x=1 done done | "$@" echo "$1" printf export "$1" then && /usr/bin
+awk then x=1 ${HOME} then test /usr/bin "$@" grep
+	&& done -eu readonly | 'quoted text' ${HOME} printf grep done && cd
+	-eu printf 2>/dev/null 2>/dev/null
+		/usr/bin readonly | | && -eu "$1" printf x=1 "$@" $(pwd) --verbose test
+printf && | done $(pwd) local
+		echo printf x=1 printf /usr/bin "$@" "$1" 2>/dev/null
+/usr/bin export $(pwd) -eu awk x=1 cd grep "$1" grep awk $(pwd) | && "$@" -eu
+		echo then 'quoted text' test "$1" $(pwd) done 2>/dev/null
+		-eu readonly -eu export | export printf local -eu sed "$1" 'quoted text'
+	readonly --verbose "$@" echo --verbose test /usr/bin test 2>/dev/null
+"$@" export local --verbose export
+		"$@" test local 2>/dev/null -eu /usr/bin export
+	&& sed "$@" $(pwd) cd echo --verbose "$@" --verbose x=1 awk
+	export awk local readonly /usr/bin export cd "$@" "$1" "$1" $(pwd)
+${HOME} cd cd ${HOME} $(pwd) export ${HOME} awk test echo printf readonly
+	"$1" test test && ${HOME} cd 'quoted text' 'quoted text'
+-eu x=1 -eu | "$1" done echo $(pwd) done export done export local sed
+	'quoted text' cd then -eu x=1 && awk $(pwd)
+local local 'quoted text' "$1" test echo export /usr/bin
+cd awk 'quoted text' sed $(pwd) test echo cd export awk sed cd /usr/bin awk -eu
+		$(pwd) readonly && -eu sed x=1 "$@" grep sed printf "$@" --verbose x=1 then readonly
+		then --verbose 'quoted text' 2>/dev/null then then sed
+awk && "$1" "$@" x=1 cd 2>/dev/null x=1 "$1" awk -eu && 'quoted text'
+	awk /usr/bin 2>/dev/null cd --verbose printf local grep 2>/dev/null grep
+		done printf sed --verbose -eu test test --verbose 'quoted text' "$@" done "$@"
+"$1" awk cd && done awk "$1" 2>/dev/null "$@" "$@" "$1" -eu --verbose
+		done -eu 2>/dev/null test then ${HOME}
+sed | "$1" readonly 2>/dev/null $(pwd)
+"$@" "$1" done awk grep -eu
+x=1 echo "$1" x=1 printf && "$1" echo cd 2>/dev/null awk 'quoted text'
+		sed readonly then "$1" ${HOME} | awk "$@" -eu /usr/bin --verbose ${HOME} sed &&
+${HOME} awk test --verbose $(pwd) then
+	-eu grep 'quoted text' && cd -eu --verbose then ${HOME} readonly awk -eu
+grep echo printf && x=1 /usr/bin test $(pwd) printf -eu grep cd grep grep
+x=1 printf printf echo cd local -eu /usr/bin /usr/bin local done 2>/dev/null
+	2>/dev/null readonly "$@" sed $(pwd) "$1"
+/usr/bin sed printf readonly 'quoted text' "$1" cd x=1 local
+"$@" export export | grep printf && readonly export local 'quoted text'
+	x=1 ${HOME} done echo export export grep -eu | ${HOME} --verbose
+	readonly readonly printf
+	then x=1 then 'quoted text' local grep $(pwd) 'quoted text' printf "$@" -eu /usr/bin
+	&& $(pwd) sed then $(pwd) --verbose test "$1" sed
+	sed 2>/dev/null printf "$1" 'quoted text' printf grep readonly sed done 2>/dev/null
+readonly && printf | test done cd --verbose awk then x=1 done &&
+		then --verbose && "$@" -eu local
+		-eu readonly export 2>/dev/null sed 2>/dev/null $(pwd)
+		"$1" echo "$1" done "$1" --verbose export
+		-eu | x=1 done then /usr/bin done ${HOME} sed local /usr/bin 2>/dev/null &&
+	"$1" "$@" "$1" 2>/dev/null -eu 'quoted text' 'quoted text' echo 'quoted text'
+		readonly echo readonly ${HOME} sed 2>/dev/null x=1 $(pwd) && echo --verbose -eu
+	awk x=1 done local then $(pwd) | | && 2>/dev/null done then
+	x=1 readonly -eu printf "$1" export grep ${HOME} then done x=1 grep local printf
+	printf echo x=1 x=1 then echo 2>/dev/null 2>/dev/null "$@"
+echo local echo -eu sed && "$@" | test /usr/bin && "$1" export awk test --verbose
+	2>/dev/null readonly cd "$@" sed "$@"
+echo cd local test "$1" &&
+		grep sed --verbose 2>/dev/null test -eu && done /usr/bin then --verbose
+	--verbose "$1" echo x=1 && test echo cd $(pwd)
+		/usr/bin then readonly 'quoted text' 2>/dev/null then test && x=1 readonly -eu
+export ${HOME} /usr/bin readonly
+		test 'quoted text' done export cd readonly x=1 -eu export ${HOME}
+		"$@" && $(pwd) then printf $(pwd) "$@" printf local test && printf sed "$@"
+		test local --verbose $(pwd) "$1"
+$(pwd) "$@" then printf 2>/dev/null sed x=1 "$@" x=1 local 2>/dev/null x=1
+		printf --verbose $(pwd) --verbose sed echo readonly
+sed printf echo local awk x=1 $(pwd)
+		${HOME} test awk 'quoted text'
+&& echo test echo export && export --verbose grep echo cd x=1 'quoted text'
+	x=1 echo then ${HOME} grep grep local --verbose
+	grep $(pwd) --verbose export then
+		done then printf awk done printf done awk ${HOME} local sed /usr/bin
+	test cd export sed -eu x=1 ${HOME} sed 2>/dev/null "$@" test x=1 local x=1
+$(pwd) test /usr/bin && sed 'quoted text'
+	local then && awk readonly readonly "$1" /usr/bin "$1" sed
+'quoted text' test local 2>/dev/null /usr/bin
+	'quoted text' echo -eu ${HOME}
+	cd "$@" "$@" 2>/dev/null && -eu 'quoted text'
+		x=1 | --verbose sed ${HOME} 2>/dev/null export --verbose echo
+		done && | then --verbose awk && | 'quoted text'
+	$(pwd) ${HOME} $(pwd) printf
+	grep ${HOME} -eu /usr/bin ${HOME} x=1 "$@" -eu "$@" && echo
+sed "$1" test printf echo 2>/dev/null local done then ${HOME}
+$(pwd) 'quoted text' x=1 test -eu "$@" test test cd 2>/dev/null
+	"$1" then x=1 -eu | readonly x=1 done cd done
+	done echo /usr/bin local grep -eu
+| sed awk echo sed x=1 /usr/bin --verbose -eu /usr/bin 'quoted text'
+	| | 'quoted text' cd sed | export ${HOME}
+| printf cd done --verbose | ${HOME} echo printf -eu -eu sed -eu
+grep cd 'quoted text' $(pwd) grep "$@"
+		${HOME} local done $(pwd) readonly grep $(pwd)
+		--verbose | sed 2>/dev/null | echo grep x=1 /usr/bin
+done test sed ${HOME} echo echo $(pwd) awk ${HOME}
+printf sed cd $(pwd) 'quoted text' -eu cd
+local --verbose && && echo echo grep cd | test awk readonly printf local
+		printf grep printf ${HOME}
+		| 2>/dev/null $(pwd)
+		&& test done cd cd --verbose $(pwd) 'quoted text' sed x=1 echo x=1
+		then printf /usr/bin /usr/bin cd -eu -eu /usr/bin done 'quoted text'
+| $(pwd) test then "$1" 2>/dev/null sed | && && $(pwd) | export "$@" grep local
+	then grep $(pwd) printf $(pwd) sed
+grep --verbose echo done && | local 2>/dev/null x=1 x=1 then && -eu readonly
+	-eu readonly then "$1" -eu echo sed sed sed local
+	${HOME} && echo "$1" readonly "$1" export done 2>/dev/null
+		sed echo grep /usr/bin $(pwd)
+	printf echo grep test then sed
+readonly done echo awk local -eu export
+		export && $(pwd) 2>/dev/null local
+	"$1" 2>/dev/null 'quoted text'
+test done test /usr/bin grep /usr/bin export test
+	printf x=1 printf x=1 ${HOME} grep sed export x=1 ${HOME}
+readonly ${HOME} awk readonly then /usr/bin
+"$1" ${HOME} --verbose $(pwd) | | readonly "$1" local awk /usr/bin x=1 "$1"
+x=1 --verbose printf "$1" 'quoted text'
+		cd awk grep -eu 'quoted text' x=1 && --verbose export
+'quoted text' sed grep test done then ${HOME} 'quoted text' awk awk x=1
+	x=1 awk && $(pwd) x=1 readonly sed 2>/dev/null readonly echo /usr/bin x=1
+	"$1" printf then 'quoted text' | awk printf grep "$1" then
+		"$1" && test x=1 ${HOME} -eu && --verbose grep x=1 ${HOME}
+		| --verbose sed awk done grep 2>/dev/null then readonly "$@" 2>/dev/null local
+echo "$@" $(pwd) -eu awk 'quoted text'
+${HOME} awk 2>/dev/null readonly then readonly -eu ${HOME} then
+grep grep awk grep sed ${HOME} export export 'quoted text'
+		'quoted text' test /usr/bin && ${HOME} grep $(pwd) printf
+		echo x=1 /usr/bin done x=1 -eu test | "$1" then && export export
+	${HOME} "$@" then export -eu --verbose $(pwd) grep
+	2>/dev/null --verbose grep local --verbose | then $(pwd)
+sed then printf "$1" test 'quoted text' && grep sed printf awk grep
+	cd $(pwd) && && done local cd "$1" $(pwd)
+	sed test ${HOME} && awk "$@" x=1 ${HOME} cd local then ${HOME} 2>/dev/null
+		sed x=1 ${HOME} | echo | 'quoted text'
+		cd "$1" "$1" "$@" 'quoted text' printf "$1" | grep
+		echo x=1 cd -eu | awk awk export grep
+cd export export x=1 -eu /usr/bin 2>/dev/null printf echo test | then
+		2>/dev/null then x=1 ${HOME} ${HOME} cd
+	printf -eu awk /usr/bin ${HOME} && && 'quoted text' local | --verbose
+	x=1 x=1 test echo readonly local "$1" 2>/dev/null then -eu 'quoted text'
+		grep "$@" local "$@" ${HOME} 'quoted text' done 2>/dev/null | -eu x=1 'quoted text'
+		/usr/bin grep cd 2>/dev/null 'quoted text' export echo $(pwd) then sed "$1" -eu
+		sed x=1 $(pwd) "$@" echo --verbose cd && grep x=1 local
+'quoted text' -eu --verbose
+echo | 2>/dev/null 2>/dev/null
+	"$@" export -eu grep test && grep ${HOME} --verbose local
+cd "$1" /usr/bin && "$@" awk done 'quoted text' export
+	echo done 2>/dev/null "$1" then test "$1" x=1 "$1" awk
+		&& $(pwd) /usr/bin echo sed export cd -eu $(pwd)
+| done test ${HOME} test "$@"
+		--verbose 'quoted text' then cd
+		"$@" --verbose && grep awk | 'quoted text' done cd readonly
+		&& test echo cd export local "$@" -eu "$1" "$1" local
+		echo "$1" | --verbose --verbose local
+		$(pwd) then grep 'quoted text' && then sed local printf 2>/dev/null done readonly
+		local export /usr/bin | x=1 grep then "$@"
+		local --verbose $(pwd) 'quoted text' -eu ${HOME} local then "$1" 'quoted text'
+	test --verbose $(pwd) "$@" local local echo
+$(pwd) /usr/bin | awk readonly
+x=1 awk 2>/dev/null cd "$1" | grep cd -eu then sed 2>/dev/null grep
+		${HOME} --verbose sed
+2>/dev/null then test ${HOME} readonly --verbose
+		--verbose "$1" "$1" awk
+		cd 2>/dev/null && ${HOME} --verbose ${HOME} test x=1 awk
+		then printf $(pwd) awk sed | done
+done done | done cd 'quoted text'
+		readonly export "$1" cd readonly
+	/usr/bin x=1 | "$@" echo export x=1 cd "$1" 'quoted text' | | printf
+	awk then readonly $(pwd) /usr/bin --verbose
+		/usr/bin --verbose x=1 'quoted text' -eu ${HOME} "$1" &&
+		printf --verbose grep "$@" /usr/bin
+		2>/dev/null awk 'quoted text' sed ${HOME} --verbose export $(pwd) /usr/bin 2>/dev/null
+		echo 'quoted text' && sed -eu done sed $(pwd)
+/usr/bin done "$@" /usr/bin x=1 export
+		2>/dev/null $(pwd) sed "$@" done readonly export /usr/bin
+		done test x=1 printf && readonly cd grep readonly then 2>/dev/null cd
+		echo $(pwd) | "$1" sed readonly /usr/bin "$@" | echo $(pwd) echo 'quoted text'
+		&& && echo then awk printf -eu "$@" -eu export sed |
+		$(pwd) done done 'quoted text' export echo printf "$1" 2>/dev/null export
+	${HOME} awk "$1" readonly &&
+| | test done -eu "$1" x=1 readonly | printf readonly cd $(pwd) then test
+		/usr/bin /usr/bin | awk --verbose "$1" /usr/bin /usr/bin printf
+	then export 'quoted text' cd $(pwd)
+	readonly test /usr/bin export "$1" ${HOME} echo
+		readonly done export export && /usr/bin test x=1 && "$1" /usr/bin 2>/dev/null sed
+	readonly test echo x=1 'quoted text' readonly
+		$(pwd) | --verbose 'quoted text' $(pwd) $(pwd)
+		echo test x=1 --verbose test && test ${HOME} 2>/dev/null 'quoted text'
+"$1" 'quoted text' local 'quoted text' "$@" "$1"
+	"$1" 2>/dev/null 2>/dev/null x=1 2>/dev/null done 'quoted text'
+then "$1" test | sed | export | "$@" 'quoted text' | readonly
+		x=1 $(pwd) --verbose awk -eu printf 2>/dev/null 'quoted text'
+	&& "$1" done readonly done then && local && "$1" /usr/bin -eu &&
+	$(pwd) ${HOME} test local then | sed ${HOME} /usr/bin then "$@" "$@" readonly grep
+done | local readonly readonly x=1 /usr/bin
+		$(pwd) grep grep export ${HOME} /usr/bin
+test grep 2>/dev/null ${HOME} 'quoted text' "$1" $(pwd) local
+'quoted text' printf sed
+	local 'quoted text' "$1" then readonly sed
+		then sed test /usr/bin export readonly grep && export -eu /usr/bin
+2>/dev/null | cd cd && "$1" done -eu echo then "$@" | x=1 printf
+		x=1 "$@" done && 'quoted text' awk readonly awk done x=1 local local export
+x=1 --verbose printf echo export sed sed 2>/dev/null
+	test --verbose x=1 | done "$@" echo grep test cd grep
+	&& cd local -eu cd local /usr/bin echo "$1" awk
+$(pwd) cd $(pwd) sed sed ${HOME} "$1"
+	'quoted text' done done "$1" ${HOME} "$@" readonly "$1" then 'quoted text' &&
+		"$1" printf cd | then x=1 x=1 x=1 local /usr/bin export
+	grep $(pwd) export --verbose then --verbose awk local 'quoted text' test /usr/bin
+/usr/bin x=1 "$@" awk ${HOME} local readonly export $(pwd)
+${HOME} export && done
+		export grep -eu done "$1" /usr/bin
+${HOME} /usr/bin test sed sed printf -eu --verbose
+		&& echo ${HOME} local cd then "$1" local grep sed printf x=1
+		readonly readonly "$@" "$1" awk export awk sed awk 2>/dev/null 'quoted text'
+	cd 2>/dev/null awk -eu printf
+		local /usr/bin --verbose 'quoted text'
+	export $(pwd) cd /usr/bin --verbose grep && x=1 sed sed then echo
+	x=1 "$@" "$@" local | 'quoted text'
+		'quoted text' readonly
+$(pwd) ${HOME} ${HOME} awk "$@" "$@" then /usr/bin 2>/dev/null
+		cd grep | grep export
+	local echo echo "$@" local printf $(pwd) echo echo sed readonly echo 'quoted text'
+| grep test then "$@" awk readonly cd echo printf echo /usr/bin
+	printf grep 2>/dev/null "$1" printf grep && grep && -eu && cd x=1 "$@" export
+-eu done /usr/bin "$1" local "$@" $(pwd) "$@" x=1
+	"$@" --verbose sed awk && $(pwd)
+grep "$1" readonly && test --verbose done sed sed test
+done x=1 sed then grep test then then x=1 test test ${HOME} | local export
+		x=1 printf sed --verbose x=1 "$@" 2>/dev/null "$1" echo "$@"
+		cd -eu export ${HOME} grep && test | awk ${HOME} local
+'quoted text' -eu "$1" cd export | echo
+grep --verbose awk local /usr/bin printf cd local cd export 2>/dev/null "$1"
+	then cd echo echo --verbose local ${HOME} awk
+	2>/dev/null printf echo x=1 && "$@" export "$@" readonly | local sed
+	then | 2>/dev/null grep | /usr/bin x=1 awk test grep "$1"
+		| export "$1" sed -eu echo echo 2>/dev/null cd x=1 && awk done cd local awk cd
+	cd sed sed x=1 test then -eu /usr/bin x=1 --verbose --verbose
+		"$@" $(pwd) test local -eu && ${HOME}
+		/usr/bin grep awk then
+echo done ${HOME} && local grep done then readonly local then sed 'quoted text'
+x=1 "$1" sed cd $(pwd) local export sed 'quoted text' export
+		sed printf --verbose -eu "$1" echo ${HOME} "$1" local "$@" x=1
+		printf grep local | sed then &&
+sed test $(pwd) cd export && grep sed local done 'quoted text' sed grep
+		done "$@" awk export | && ${HOME} x=1 | echo cd 'quoted text' && awk then
+&& $(pwd) x=1 local export
+		&& /usr/bin /usr/bin export done 'quoted text'
+	local | -eu awk sed x=1 cd && 2>/dev/null
+	awk 'quoted text' 2>/dev/null
+awk -eu 2>/dev/null sed then 2>/dev/null -eu &&
+	| /usr/bin | "$@" -eu
+		$(pwd) | readonly | "$@" ${HOME}
+	"$@" readonly $(pwd) awk done
+	done grep awk grep "$@" --verbose
+"$1" then then | "$@" then /usr/bin 'quoted text'
+2>/dev/null "$@" export awk $(pwd) | awk done | then export printf "$1" test
+	&& --verbose grep sed sed printf
+	2>/dev/null sed readonly echo
+cd readonly echo printf && "$@" /usr/bin
+printf "$@" | && | $(pwd) printf
+	echo "$1" "$@" && printf readonly && "$1" readonly 2>/dev/null -eu export
+		--verbose test local --verbose cd cd printf readonly 'quoted text'
+	-eu sed "$1" --verbose /usr/bin ${HOME} 2>/dev/null printf /usr/bin echo "$1" test
+	then --verbose "$1" grep awk grep export sed $(pwd)
+local ${HOME} --verbose 2>/dev/null local -eu then cd 2>/dev/null x=1
+	'quoted text' 'quoted text' export --verbose 'quoted text'
+grep cd && readonly awk readonly
+		then awk grep "$@" /usr/bin
+x=1 grep 'quoted text' $(pwd) grep echo export readonly cd --verbose --verbose then
+		"$@" --verbose printf "$@" 2>/dev/null
+		local x=1 export local export
+		| readonly --verbose -eu
+export -eu grep /usr/bin && then readonly && && | $(pwd) readonly
+	local && x=1 cd then "$@" done --verbose test
+local sed sed grep awk
+	grep sed "$1" && ${HOME} local printf grep local local
+-eu local test done local printf --verbose echo --verbose && grep
+	done echo sed done printf "$@" 'quoted text'
+		cd readonly && sed /usr/bin cd echo $(pwd) && printf export grep local
+| /usr/bin -eu awk /usr/bin "$1" x=1 ${HOME}
+		sed cd then | awk && --verbose awk x=1 printf
+-eu sed "$1" then local local awk grep --verbose && 2>/dev/null 2>/dev/null
+then ${HOME} | printf /usr/bin 2>/dev/null 2>/dev/null
+		| local -eu awk 'quoted text' && -eu /usr/bin | local export export
+	2>/dev/null --verbose "$1" "$1" -eu printf then export "$1" $(pwd)
+		readonly export grep grep /usr/bin readonly echo && test
+then "$@" printf /usr/bin 2>/dev/null local $(pwd) sed $(pwd) "$@" echo
+"$@" grep done grep 'quoted text' readonly then x=1 readonly readonly awk awk &&
+$(pwd) --verbose readonly x=1 x=1 && /usr/bin
+then "$@" done x=1 then x=1 && sed
+		done printf "$1" echo test ${HOME} --verbose test 2>/dev/null echo x=1
+		2>/dev/null sed x=1 awk readonly done grep export then /usr/bin
+done export printf x=1 $(pwd) | $(pwd) 'quoted text'
+2>/dev/null && ${HOME} test printf "$@" printf readonly local
+		&& echo readonly ${HOME} cd readonly then then done then printf echo "$1"
+	echo awk local awk then
+&& && "$@" | 2>/dev/null export
+	&& test "$1" ${HOME} printf -eu
+awk "$@" cd echo && ${HOME} done
+test test export "$1" local then -eu test test && 2>/dev/null
+	/usr/bin -eu grep $(pwd) awk 'quoted text' $(pwd) done readonly
+		local -eu ${HOME} awk then printf export printf 2>/dev/null "$1" readonly
+then && awk done -eu readonly 'quoted text'
+		&& /usr/bin -eu readonly readonly local /usr/bin
+$(pwd) local "$1" x=1 local | 'quoted text'
+| && then printf -eu then echo &&
+	${HOME} local && sed "$1" printf awk sed printf
+	printf && local echo done x=1 export x=1 && 2>/dev/null
+"$1" 2>/dev/null done cd && /usr/bin export
+		-eu ${HOME} awk test && cd /usr/bin sed
+	readonly x=1 ${HOME} sed awk "$1" test x=1
+		'quoted text' && readonly && cd then $(pwd) $(pwd) --verbose
+		cd local x=1 --verbose
+-eu "$1" -eu $(pwd) printf ${HOME} 'quoted text' "$@" | printf
+	done && 2>/dev/null "$@" echo | --verbose -eu $(pwd) && printf && "$@" awk
+		export 'quoted text' ${HOME} sed --verbose awk readonly x=1 && /usr/bin sed | 2>/dev/null
+readonly awk printf "$1" "$@" test readonly /usr/bin cd echo &&
+x=1 /usr/bin done readonly grep -eu ${HOME}
+		$(pwd) export "$1" sed test /usr/bin "$@" --verbose "$1" 'quoted text'
+	--verbose ${HOME} /usr/bin export "$1" then readonly done |
+	test -eu ${HOME} sed && "$@"
+sed | "$1" grep echo -eu $(pwd) "$@" echo then local --verbose ${HOME}
+		'quoted text' -eu -eu cd -eu awk --verbose -eu test readonly readonly
+| printf echo | -eu cd ${HOME} then
+		export export readonly "$1" sed -eu printf -eu cd $(pwd)
+/usr/bin sed 'quoted text' readonly && then echo
+local $(pwd) local echo cd x=1 "$@" 'quoted text' -eu cd /usr/bin echo 'quoted text'
+${HOME} | && /usr/bin printf export $(pwd)
+	readonly local --verbose --verbose "$1" "$@"
+-eu export x=1 -eu readonly sed then printf "$1" readonly then -eu
+		readonly local printf export -eu readonly awk x=1 | readonly sed /usr/bin
+		done export "$@" readonly echo test export && "$@" $(pwd) 'quoted text' --verbose
+	done export /usr/bin "$1" && awk cd then
+cd echo awk && printf "$1" awk
+"$1" cd local export local /usr/bin printf 2>/dev/null
+	${HOME} then 'quoted text'
+	awk done | ${HOME} | export $(pwd) | done &&
+	cd 2>/dev/null 'quoted text' 2>/dev/null cd -eu sed local --verbose
+		/usr/bin test && printf
+	sed sed grep local grep grep --verbose
+/usr/bin ${HOME} grep export test echo echo cd
+		export local then export "$@" test && awk 'quoted text' && echo awk sed then
+then ${HOME} local local | "$1" cd 2>/dev/null $(pwd) "$@" readonly local readonly
+| "$1" -eu awk awk 2>/dev/null -eu "$@" $(pwd) test -eu
+		/usr/bin -eu local | 'quoted text' ${HOME} local
+$(pwd) then 2>/dev/null echo ${HOME} export readonly "$@" readonly
+		| $(pwd) -eu $(pwd) awk awk $(pwd) ${HOME} sed export
+		export test awk test x=1 readonly
+${HOME} $(pwd) awk then && /usr/bin "$1" printf
+		awk | sed echo printf readonly
+		echo readonly export grep $(pwd) test | | -eu && test echo $(pwd)
+	echo cd $(pwd) "$@" /usr/bin --verbose "$1" 'quoted text'
+	${HOME} echo $(pwd) readonly echo $(pwd) /usr/bin readonly | ${HOME} echo /usr/bin
+		"$@" x=1 | 'quoted text' local grep awk cd done
+		--verbose $(pwd) $(pwd) cd printf && grep 'quoted text' 2>/dev/null
+		${HOME} echo done 'quoted text'
+	/usr/bin cd ${HOME} 2>/dev/null test -eu readonly grep $(pwd)
+		--verbose $(pwd) then | | grep then local
+"$@" readonly | cd "$@" readonly -eu $(pwd) 2>/dev/null local $(pwd) sed cd
+		"$@" grep done && readonly readonly --verbose | export 'quoted text' local
+cd then local | --verbose x=1 awk x=1 printf echo --verbose /usr/bin local done
+	/usr/bin readonly $(pwd) 2>/dev/null
+	sed 'quoted text' && "$1" 'quoted text' export $(pwd) readonly 'quoted text'
+	done local 2>/dev/null -eu ${HOME} export awk &&
+	${HOME} x=1 cd $(pwd) && | local
+		'quoted text' "$1" ${HOME} awk "$@" then x=1 done
+		2>/dev/null readonly then "$@" 'quoted text'
+	echo $(pwd) then | done && ${HOME} 'quoted text'
+		${HOME} --verbose echo readonly done done printf test export "$1"
+	test x=1 "$@" readonly -eu && readonly "$1" printf
+${HOME} 'quoted text' "$1" sed | done --verbose "$1" grep echo done test
+done printf x=1 test /usr/bin printf "$1" export 'quoted text'
+	local "$1" cd sed done echo then "$1" /usr/bin --verbose then then
+		printf grep 2>/dev/null /usr/bin export done --verbose | ${HOME} && test 'quoted text'
+	"$1" test echo cd cd ${HOME}
+		/usr/bin "$1" done done sed then echo grep export | sed && test local
+	--verbose && -eu echo echo "$1" grep /usr/bin -eu done | readonly | $(pwd)
+"$@" local ${HOME} sed 2>/dev/null | "$@" sed ${HOME}
+		x=1 $(pwd) -eu cd && 'quoted text' 'quoted text' then local
+x=1 sed echo x=1 sed | $(pwd) "$1" ${HOME} && -eu sed
+	'quoted text' test ${HOME} x=1 sed x=1 cd cd -eu export 2>/dev/null
+	| done test 2>/dev/null "$@"
+	"$@" echo local grep then 2>/dev/null | 2>/dev/null printf test
+		cd --verbose test printf ${HOME} -eu cd then then cd -eu x=1 test printf "$1"
+	local $(pwd) grep echo echo 2>/dev/null grep $(pwd) 2>/dev/null --verbose
+		grep "$1" grep x=1 awk | && $(pwd)
+		then -eu ${HOME} awk $(pwd)
+	printf test -eu x=1 local cd grep readonly awk
+		grep && echo awk | sed awk done test "$1" test printf awk
+		${HOME} && printf && sed
+	${HOME} "$@" | "$@" then grep export
+x=1 readonly local test printf "$@" "$1" printf 'quoted text' grep
+	2>/dev/null | $(pwd) sed 'quoted text'
+	awk test "$1" x=1 awk
+	| "$@" readonly 2>/dev/null awk
+		test --verbose local sed /usr/bin test done printf x=1 sed then "$@"
+	--verbose export $(pwd) && local printf echo done && | $(pwd) done
+		readonly "$@" $(pwd) readonly /usr/bin x=1 echo x=1 /usr/bin sed done done
+readonly then "$1" printf ${HOME} x=1
+echo printf readonly | cd /usr/bin --verbose awk --verbose
+/usr/bin $(pwd) x=1 printf /usr/bin echo 'quoted text'
+printf 'quoted text' "$1" echo ${HOME} "$@" test sed 2>/dev/null
+export ${HOME} local "$@" -eu then $(pwd) &&
+		&& awk 2>/dev/null $(pwd) sed grep
+echo 'quoted text' 'quoted text' --verbose awk awk | /usr/bin /usr/bin printf test
+grep readonly grep $(pwd) $(pwd)
+/usr/bin | 'quoted text' export echo | awk local x=1 test "$1"
+		&& && local x=1 done x=1 --verbose 'quoted text' echo && readonly 'quoted text'
+	sed export ${HOME} -eu && --verbose readonly done awk
+	sed printf sed grep 2>/dev/null echo 'quoted text'
+	test --verbose 2>/dev/null local grep done "$@" $(pwd) readonly awk export --verbose
+	sed "$@" ${HOME} readonly x=1 done done echo sed test
+		then -eu | ${HOME} "$@" $(pwd) sed echo echo then ${HOME} readonly
+test 2>/dev/null --verbose awk 2>/dev/null test printf 2>/dev/null done cd
+done echo grep 'quoted text' sed --verbose sed /usr/bin
+then test grep /usr/bin test "$@" local done "$@" 'quoted text' ${HOME}
+		/usr/bin "$@" readonly local awk && --verbose awk then && -eu ${HOME} cd ${HOME}
+cd | "$1" "$@" 2>/dev/null 'quoted text' 'quoted text'
+		$(pwd) printf readonly readonly ${HOME} export | && x=1
+	| x=1 'quoted text' x=1 2>/dev/null
+		export done awk && | 'quoted text'
+done sed 2>/dev/null /usr/bin "$@" -eu x=1 | -eu && 2>/dev/null printf
+echo local test grep ${HOME} echo --verbose test
+${HOME} then $(pwd) readonly
+		grep "$1" 'quoted text' | local x=1 echo | then "$1" done 2>/dev/null 'quoted text'
+	2>/dev/null readonly /usr/bin --verbose | export /usr/bin ${HOME}
+printf x=1 x=1 | cd /usr/bin test 2>/dev/null
+		2>/dev/null "$@" export done sed /usr/bin ${HOME} local
+	&& -eu local --verbose "$@" /usr/bin cd "$@" "$@" /usr/bin
+		x=1 --verbose done local then echo --verbose
+		sed "$1" $(pwd) --verbose sed && done
+done test -eu -eu echo 2>/dev/null x=1 /usr/bin | ${HOME} --verbose /usr/bin
+	--verbose --verbose then "$@" then grep then --verbose
+		/usr/bin echo /usr/bin x=1 && printf ${HOME} then "$@" 'quoted text' -eu local
+$(pwd) x=1 printf sed && $(pwd) test export "$1" "$@" 'quoted text'
+	sed "$1" grep -eu export local x=1 && | readonly echo ${HOME} $(pwd)
+echo then then echo test -eu 'quoted text' /usr/bin printf
+		-eu awk printf x=1 'quoted text'
+		then | "$@" 2>/dev/null ${HOME}
+		local -eu "$1" ${HOME} done echo -eu "$@" printf test grep | export
+'quoted text' local "$@" test ${HOME} "$@"
+	grep then then "$1" readonly "$@" --verbose "$1" grep --verbose awk echo
+printf sed export | -eu 'quoted text' awk 2>/dev/null
+		x=1 --verbose ${HOME} -eu grep then then then && sed "$@" readonly
+		done x=1 export local 'quoted text'
+		then -eu 2>/dev/null printf && export x=1 local cd $(pwd) readonly sed "$1"
+--verbose --verbose done cd
+&& done grep "$1" --verbose export x=1 -eu export --verbose
+test && test ${HOME} sed sed test echo "$@" sed then awk grep readonly
+local grep --verbose grep -eu ${HOME} readonly -eu
+		$(pwd) done "$1" echo done /usr/bin 'quoted text' 'quoted text'
+		export $(pwd) && then awk ${HOME}
+'quoted text' 2>/dev/null "$@" local --verbose echo local ${HOME}
+		-eu && readonly "$1" /usr/bin echo export 'quoted text' done then local ${HOME}
+		"$1" "$@" printf then readonly echo "$1" 2>/dev/null "$1"
+	${HOME} awk $(pwd) readonly readonly $(pwd) x=1 -eu | "$@" test
+	grep x=1 echo printf printf
+readonly local "$1" /usr/bin readonly && && export --verbose
+	"$@" test sed -eu -eu $(pwd) 2>/dev/null
+-eu test -eu sed readonly 'quoted text' 2>/dev/null cd test
+awk then grep 'quoted text'
+	sed grep $(pwd) export "$1" export 2>/dev/null | 'quoted text' sed then printf
+'quoted text' -eu local printf "$@" $(pwd) local
+'quoted text' $(pwd) done
+	cd 'quoted text' export export x=1
+		${HOME} echo 'quoted text' local local
+	--verbose grep echo grep -eu |
+		awk ${HOME} cd --verbose readonly "$@" export local
+		echo /usr/bin -eu test grep then readonly | echo local local -eu
+		x=1 && cd sed /usr/bin local sed
+		/usr/bin awk --verbose | test $(pwd) -eu 'quoted text' echo ${HOME} printf
+"$1" awk && x=1 "$@" cd local
+		awk sed && /usr/bin /usr/bin sed cd then test cd "$@" done -eu
+		-eu /usr/bin export printf readonly local sed $(pwd) ${HOME} done x=1 then
+		done sed "$@" readonly 'quoted text' grep readonly done grep test done
+	grep cd && "$@" --verbose | | printf "$@" x=1 /usr/bin printf && test export
+		printf 'quoted text' "$@" $(pwd)
+		echo --verbose cd | ${HOME} then
+		sed ${HOME} test "$@" cd 2>/dev/null
+	then 'quoted text' 2>/dev/null && -eu echo x=1 printf |
+	| test x=1 'quoted text' test readonly
+done $(pwd) printf "$1" -eu --verbose awk $(pwd)
+		"$1" grep && /usr/bin && --verbose awk x=1 |
+printf export --verbose cd
+	export && local sed local ${HOME} done 'quoted text' test done cd "$@" cd
+	&& then printf "$@" local
+	--verbose x=1 echo ${HOME}
+done done 'quoted text' $(pwd) /usr/bin
+		--verbose local | done ${HOME} --verbose grep "$1" done then 'quoted text'
+sed x=1 done local -eu "$@" then --verbose ${HOME}
+cd sed --verbose export 'quoted text' x=1 grep
+x=1 | sed local ${HOME}
+	grep printf done "$1" grep readonly then done "$@" ${HOME} 2>/dev/null
+printf $(pwd) 'quoted text'
+	&& grep -eu x=1 x=1 2>/dev/null printf readonly grep | /usr/bin &&
+		echo local done ${HOME} then 'quoted text' 2>/dev/null --verbose then 'quoted text'
+	readonly | sed local /usr/bin done | $(pwd) done "$@" local 'quoted text'
+cd readonly echo printf
+-eu ${HOME} $(pwd) sed 2>/dev/null ${HOME} then export printf 'quoted text'
+		"$1" x=1 "$@" local cd awk done $(pwd) readonly 'quoted text'
+		echo x=1 $(pwd) | readonly 'quoted text' --verbose ${HOME} grep
+		${HOME} readonly readonly $(pwd) 2>/dev/null "$1" sed "$@" $(pwd) awk done x=1
+	awk grep ${HOME} local grep x=1 --verbose then /usr/bin grep
+		$(pwd) ${HOME} x=1 sed awk "$@" cd /usr/bin
+	-eu "$1" then awk export readonly
+${HOME} 2>/dev/null ${HOME} ${HOME} printf readonly test /usr/bin
+	--verbose test readonly "$1" done local export 'quoted text' | readonly
+		then && local -eu local local test $(pwd) | 2>/dev/null x=1 "$1" printf
+		export $(pwd) "$1" local $(pwd) --verbose 'quoted text' cd done "$1"
+&& | export x=1 echo --verbose
+		/usr/bin then sed done --verbose
+export -eu done "$1" printf test echo printf 'quoted text'
+	"$@" printf grep x=1 && "$1" grep echo && sed echo 2>/dev/null "$1"
+		grep --verbose awk printf -eu echo printf cd ${HOME}
+		done sed echo cd /usr/bin export printf && done sed printf local grep
+		readonly && local done local $(pwd) ${HOME}
+'quoted text' 'quoted text' grep local export printf cd readonly x=1 done "$@" grep
+${HOME} | -eu && cd "$@" cd sed printf
+		--verbose grep "$@" 'quoted text' printf local /usr/bin sed x=1 x=1
+		$(pwd) && printf $(pwd) 2>/dev/null && readonly x=1 awk sed "$@" test "$1" /usr/bin
+		echo readonly | && test test "$1" export
+		sed sed printf echo -eu test sed sed test -eu
+	-eu test cd awk printf | test echo test export ${HOME} echo readonly | -eu readonly
+		awk awk "$1" grep cd 2>/dev/null
+grep echo then --verbose
+		then 'quoted text' ${HOME} awk x=1 | awk
+readonly ${HOME} awk "$1" x=1 cd --verbose x=1 awk 'quoted text'
+		readonly && $(pwd) "$@" readonly done done awk 2>/dev/null x=1 local $(pwd) /usr/bin
+		--verbose /usr/bin ${HOME} readonly
+printf export echo test export
+	'quoted text' $(pwd) /usr/bin 'quoted text' then
+	awk --verbose --verbose local -eu echo
+	done sed awk x=1 local grep then echo cd x=1
+		then ${HOME} awk "$1" x=1 sed readonly
+	&& cd then printf | | | echo "$@" 2>/dev/null 'quoted text'
+	$(pwd) && "$1" 2>/dev/null done ${HOME} 'quoted text' grep cd /usr/bin -eu
+	--verbose echo --verbose echo x=1 "$@" test echo $(pwd) $(pwd) -eu cd then
+2>/dev/null x=1 | | --verbose
+| -eu test $(pwd) --verbose $(pwd) then -eu --verbose /usr/bin export
+2>/dev/null | "$1" ${HOME} "$@" then export then && -eu --verbose readonly
+		| cd done | | readonly -eu "$1" local && done && test | | local -eu
+	readonly done export x=1 local --verbose x=1 cd "$1" printf then | ${HOME} ${HOME}
+/usr/bin /usr/bin done test local
+		export x=1 grep "$1" ${HOME} test cd test -eu $(pwd) 'quoted text'
+then awk readonly local && 2>/dev/null done
+-eu 2>/dev/null local $(pwd) cd 'quoted text' local
+grep | test $(pwd) export -eu done ${HOME}
+	readonly export cd echo then 2>/dev/null test export x=1 readonly
+	${HOME} $(pwd) printf ${HOME} -eu ${HOME} printf | ${HOME} -eu sed
+cd "$1" 2>/dev/null | readonly ${HOME} then "$1" ${HOME} grep echo done
+	-eu done done then "$1" x=1 --verbose test awk echo
+	sed $(pwd) ${HOME} readonly /usr/bin cd 2>/dev/null &&
+	local "$@" awk "$1" | x=1 readonly local 2>/dev/null export
+		cd echo local "$@" ${HOME} export test -eu
+		cd "$1" x=1 | then &&
+	awk test sed 'quoted text' && readonly | then printf ${HOME}
+	${HOME} 2>/dev/null readonly test export "$@" ${HOME} "$1" /usr/bin
+| "$1" awk cd && export export --verbose readonly /usr/bin
+	2>/dev/null then then && sed -eu "$1" x=1 then cd
+		test 'quoted text' printf ${HOME} /usr/bin 2>/dev/null
+"$@" done /usr/bin -eu then | test && test done
+	"$@" && readonly readonly readonly "$1" then
+	&& -eu /usr/bin /usr/bin
+	/usr/bin | test local --verbose sed
+		"$1" test | test "$@" "$@" | test test -eu -eu && cd done printf | --verbose
+	readonly ${HOME} | 2>/dev/null
+grep "$1" grep echo && cd x=1 2>/dev/null "$1"
+2>/dev/null $(pwd) local --verbose 'quoted text'
+		"$1" 2>/dev/null --verbose grep && grep awk printf "$1" /usr/bin
+		done 2>/dev/null sed test cd awk | printf
+printf x=1 "$1" ${HOME} --verbose then done -eu 2>/dev/null
+export cd --verbose printf local export
+$(pwd) "$@" | -eu cd grep
+		readonly printf | 'quoted text'
+2>/dev/null readonly local local -eu printf readonly $(pwd) "$1" echo then
+"$1" --verbose 'quoted text' 2>/dev/null cd awk 2>/dev/null ${HOME}
+	cd readonly | --verbose | cd then | test
+cd "$@" 2>/dev/null "$@" 'quoted text' --verbose grep printf x=1 cd | awk
+	2>/dev/null $(pwd) -eu
+	| | then "$@" 'quoted text'
+		${HOME} test "$@" "$1" awk --verbose grep
+		--verbose local awk local "$1" && sed cd test x=1 ${HOME} && grep export ${HOME}
+	done export then 'quoted text' test printf printf x=1 grep $(pwd) grep done $(pwd)
+		done test && 'quoted text' $(pwd) export readonly 2>/dev/null
+--verbose x=1 | export awk --verbose
+-eu then local x=1 | then "$1"
+	local && grep -eu echo | 2>/dev/null -eu test then echo
+		$(pwd) ${HOME} echo "$@" local local | grep 'quoted text' readonly
+/usr/bin /usr/bin cd && $(pwd) cd "$@" local local 2>/dev/null "$@" 'quoted text'
+		${HOME} readonly --verbose | -eu printf local x=1 "$@" | test 'quoted text'
+		grep echo grep sed then grep "$@" |
+echo done test grep "$1" awk "$1" &&
+done awk && awk grep local printf "$1" test x=1 echo ${HOME} $(pwd) x=1
+	export local then /usr/bin grep --verbose 2>/dev/null
+${HOME} x=1 done /usr/bin 2>/dev/null local cd
+		grep cd 'quoted text' ${HOME} --verbose -eu | "$@" x=1 grep grep /usr/bin
+echo local -eu /usr/bin "$@" /usr/bin $(pwd) "$1" then export then "$@"
+cd export 'quoted text' "$@" done
+export && test 'quoted text'
+	local 2>/dev/null 2>/dev/null $(pwd) 'quoted text'
+		$(pwd) local local && ${HOME} |
+	test echo "$@" $(pwd) sed
+		--verbose --verbose | readonly test test readonly cd "$@" export | "$1"
+test echo local --verbose --verbose $(pwd) done awk sed --verbose readonly
+readonly done --verbose readonly | echo $(pwd) then then printf
+export "$@" x=1 sed 2>/dev/null
+	then done 'quoted text' 2>/dev/null local local test "$1" "$1" printf 2>/dev/null
+		/usr/bin 'quoted text' echo cd x=1 local sed /usr/bin printf |
+${HOME} --verbose && sed --verbose done export test | test export printf
+echo local && export | echo && echo local /usr/bin && done grep && 2>/dev/null
+then done then $(pwd) sed --verbose local /usr/bin --verbose -eu readonly awk
+	echo | export 'quoted text' grep grep done export /usr/bin
+local awk && --verbose done -eu /usr/bin
+${HOME} sed x=1 /usr/bin export grep 'quoted text'
+		local done grep then readonly x=1 "$1"
+echo printf printf --verbose
+readonly readonly $(pwd) local printf printf done echo --verbose
+		/usr/bin test sed "$@" sed printf $(pwd) 'quoted text'
+"$1" export -eu "$@" printf cd && ${HOME} sed &&
+	sed --verbose awk && test 'quoted text' export 2>/dev/null ${HOME} then readonly
+		&& then grep $(pwd) $(pwd) "$1" sed cd readonly
+	"$1" export --verbose $(pwd) test done "$@"
+		done 2>/dev/null local -eu
+		${HOME} "$@" sed export awk sed then echo then
+	awk "$@" printf | --verbose
+		| "$1" | x=1 echo $(pwd) --verbose done 2>/dev/null --verbose local
+	--verbose test printf /usr/bin && "$1" done readonly 2>/dev/null
+		local /usr/bin -eu 2>/dev/null | | grep awk
+		&& | --verbose -eu done /usr/bin done sed sed ${HOME} export /usr/bin
+"$@" ${HOME} 'quoted text' ${HOME} -eu ${HOME}
+x=1 export readonly awk "$1" 2>/dev/null echo printf sed ${HOME} && /usr/bin
+test /usr/bin 2>/dev/null && 2>/dev/null sed 'quoted text'
+echo cd echo x=1 ${HOME} export export "$1"
+		$(pwd) 'quoted text' /usr/bin done test ${HOME} readonly printf /usr/bin
+	$(pwd) ${HOME} echo x=1 local
+		export done "$@" /usr/bin "$1" done echo 2>/dev/null export local -eu export
+&& && --verbose $(pwd) readonly 2>/dev/null ${HOME} --verbose
+	| sed sed local grep | 'quoted text' $(pwd)
+		sed 2>/dev/null export grep | && awk && "$1" echo 2>/dev/null then -eu
+		grep echo echo test grep ${HOME}
+	--verbose 2>/dev/null -eu test export echo
+		2>/dev/null /usr/bin 'quoted text' ${HOME} 2>/dev/null test readonly
+test --verbose readonly | "$@" done $(pwd) done then ${HOME}
+		/usr/bin x=1 $(pwd) sed "$@" printf "$1" sed | test awk | && done
+then grep test /usr/bin printf done then sed local test
+${HOME} grep sed $(pwd) "$1" 2>/dev/null done x=1
+	awk /usr/bin local "$@" && cd grep sed test done "$1" "$1" printf 'quoted text'
+	awk export 'quoted text' sed
+	sed -eu done awk export 'quoted text' test | sed export "$1" cd
+		readonly $(pwd) done sed --verbose test readonly --verbose "$@" printf /usr/bin
+		"$1" cd ${HOME} printf | -eu echo ${HOME} awk && &&
+		echo 'quoted text' 2>/dev/null done done | "$@" awk awk echo /usr/bin printf
+		done sed && then sed sed local ${HOME} export /usr/bin echo
+$(pwd) "$@" 'quoted text' cd --verbose | done export
+/usr/bin $(pwd) $(pwd)
+		${HOME} 2>/dev/null done then && echo grep
+readonly /usr/bin x=1 local && 'quoted text' | && test | echo
+		printf && ${HOME} export "$1"
+"$@" && --verbose printf then grep local echo
+		echo -eu "$1" && awk "$@" "$1"
+	'quoted text' then echo 'quoted text' x=1 'quoted text'
+readonly "$1" grep ${HOME} $(pwd) awk "$1" awk "$1" "$1"
+		/usr/bin local 'quoted text' readonly /usr/bin
+x=1 ${HOME} -eu --verbose grep then $(pwd) printf then printf
+	export awk done then -eu 2>/dev/null local grep && export done | export awk local
+	'quoted text' done x=1 --verbose | $(pwd) export
+		2>/dev/null 'quoted text' export -eu grep $(pwd) ${HOME} "$1" then sed
+local done awk && export echo -eu printf "$@" "$1" | sed -eu
+	--verbose && awk test sed ${HOME}
+		$(pwd) "$1" local readonly echo local grep -eu
+	${HOME} awk ${HOME} export then cd x=1
+		&& x=1 then echo echo /usr/bin "$1" /usr/bin && local awk x=1 export local 2>/dev/null
+		printf --verbose /usr/bin
+done then echo sed grep $(pwd) printf "$@" export
+#include c133.sh
+2>/dev/null test ${HOME} | ${HOME} cd $(pwd) local
+	$(pwd) readonly | then 'quoted text' $(pwd) x=1 awk export
+		2>/dev/null && readonly readonly
+		--verbose local 2>/dev/null 'quoted text' awk "$@" x=1 -eu then
+done $(pwd) awk -eu grep then $(pwd) /usr/bin export 'quoted text'
+		local ${HOME} "$1" "$1" ${HOME} --verbose | "$1" local local
+	awk 2>/dev/null "$1" -eu "$1"
+		readonly $(pwd) grep export |
+		local local -eu -eu test x=1 $(pwd)
+cd 2>/dev/null grep "$@" then "$@" awk x=1 | done | cd && printf local "$1"
+x=1 $(pwd) --verbose "$1" sed then grep then && export $(pwd)
+export ${HOME} local ${HOME} sed x=1 2>/dev/null && readonly 'quoted text' awk
+	printf "$1" 'quoted text' /usr/bin $(pwd) && awk "$1" /usr/bin export
+	cd then -eu export 2>/dev/null
+	cd 'quoted text' --verbose 2>/dev/null printf local then done sed
+		--verbose test 2>/dev/null awk
+	"$@" --verbose -eu --verbose sed sed
+	printf then | x=1 printf && "$1" local $(pwd) 'quoted text' grep test "$@"
+		| /usr/bin "$@" awk "$@" test awk grep
+		&& x=1 /usr/bin printf test echo --verbose done local /usr/bin "$@" "$1" grep
+		export "$@" "$1" x=1 2>/dev/null /usr/bin cd "$@" ${HOME} printf
+		--verbose echo test x=1 x=1 x=1 test x=1
+	test echo ${HOME} then --verbose done export awk /usr/bin
+		x=1 sed sed | x=1 printf
+${HOME} -eu x=1 export echo done then --verbose
+done local 'quoted text' cd printf 2>/dev/null --verbose
+x=1 x=1 printf grep && "$1" done $(pwd) 2>/dev/null --verbose 2>/dev/null "$@"
+	"$@" readonly x=1 test $(pwd) "$@" sed 'quoted text' export local
+		$(pwd) readonly && printf printf cd "$1" then readonly sed grep then x=1 readonly
+		"$1" export x=1 $(pwd) test && test awk cd --verbose "$@" "$1" grep --verbose
+echo /usr/bin test 'quoted text'
+		awk "$@" -eu test local cd 2>/dev/null "$1" local export
+		'quoted text' $(pwd) echo awk x=1 test sed sed
+		--verbose -eu x=1 "$@" export cd
+| then $(pwd) local /usr/bin -eu test done export && printf | printf "$@" sed
+		sed 2>/dev/null | | 2>/dev/null
+2>/dev/null 'quoted text' x=1 'quoted text' x=1
+	&& done "$1" | readonly "$1" 'quoted text'
+2>/dev/null cd 'quoted text' -eu "$@"
+		&& 'quoted text' done "$1" /usr/bin "$1" cd grep /usr/bin /usr/bin | echo then
+		2>/dev/null cd cd 2>/dev/null $(pwd) test $(pwd) -eu local 2>/dev/null
+		"$@" export export sed
+		grep done x=1 x=1 'quoted text' -eu awk 2>/dev/null $(pwd)
+echo x=1 test echo "$@" /usr/bin
+		${HOME} sed /usr/bin "$1" 2>/dev/null
+	then "$1" cd /usr/bin
+		--verbose cd | x=1 && -eu && 'quoted text'
+cd --verbose test cd 2>/dev/null
+	"$1" "$@" $(pwd) sed done $(pwd) 'quoted text' export test |
+/usr/bin /usr/bin awk then readonly
+export awk 'quoted text' 2>/dev/null
+2>/dev/null done cd --verbose x=1 ${HOME} --verbose readonly export
+		${HOME} echo "$1" 2>/dev/null printf done
+	test export readonly -eu | 2>/dev/null --verbose
+grep && done $(pwd) $(pwd) x=1 test "$1"
+	&& echo done grep x=1 && readonly "$1" $(pwd) /usr/bin echo
+		sed cd done awk /usr/bin printf echo 2>/dev/null --verbose
+		2>/dev/null 'quoted text' | readonly $(pwd) local ${HOME}
+		awk -eu readonly awk then export && x=1 2>/dev/null
+	cd awk "$1" 'quoted text' sed | /usr/bin test readonly "$1" ${HOME} && -eu cd
+	sed grep x=1 local --verbose printf
+-eu --verbose 2>/dev/null "$@"
+readonly && "$1" /usr/bin 'quoted text' $(pwd) export && printf sed then
+		export grep local /usr/bin done done cd -eu x=1 local 'quoted text'
+	export done printf $(pwd) grep $(pwd) awk x=1 && sed
+&& 2>/dev/null ${HOME} x=1 echo cd test sed ${HOME} && && cd -eu echo | ${HOME}
+		${HOME} readonly && printf
+sed --verbose /usr/bin --verbose then
+"$@" -eu then ${HOME} readonly /usr/bin "$@" | echo echo readonly echo readonly
+readonly awk 'quoted text' && | --verbose
+	"$1" done local readonly 'quoted text'
+		readonly | "$1" -eu printf cd 'quoted text' printf awk
+	"$@" /usr/bin readonly "$1" --verbose | |
+	$(pwd) -eu grep then x=1 "$@" sed --verbose
+	2>/dev/null test done test | grep "$@" test local -eu test /usr/bin test
+readonly "$@" echo --verbose && grep sed
+&& grep export $(pwd) echo 'quoted text' $(pwd) ${HOME} --verbose -eu cd $(pwd)
+| ${HOME} $(pwd) /usr/bin --verbose /usr/bin
+/usr/bin readonly printf 2>/dev/null
+then awk local 2>/dev/null done echo export echo ${HOME} -eu test | then $(pwd)
+	2>/dev/null 2>/dev/null done sed readonly 2>/dev/null
+		then 'quoted text' echo
+		echo readonly "$1" awk grep readonly
+sed printf sed 'quoted text' printf readonly echo grep 2>/dev/null
+	&& 2>/dev/null -eu x=1 "$1" awk -eu x=1 x=1 x=1 x=1 /usr/bin
+export $(pwd) "$1" 'quoted text' sed ${HOME} echo
+/usr/bin 'quoted text' $(pwd) export local done readonly
+	echo "$@" sed $(pwd) --verbose ${HOME} test
+		x=1 --verbose -eu local printf "$@" --verbose
+		printf sed | awk 2>/dev/null /usr/bin sed test test && 2>/dev/null printf
+"$@" readonly grep sed awk done -eu 'quoted text' 'quoted text'
+cd "$1" sed ${HOME} then test --verbose done sed
+		test awk "$1" 2>/dev/null cd "$1" grep grep | x=1 readonly -eu test
+	awk x=1 export ${HOME} printf /usr/bin --verbose
+		printf $(pwd) -eu then test local "$1" export && $(pwd) 2>/dev/null
+$(pwd) ${HOME} | -eu --verbose 2>/dev/null
+		&& -eu cd grep 'quoted text' readonly "$1" 2>/dev/null 2>/dev/null ${HOME} ${HOME}
+x=1 test -eu grep --verbose then sed
+	| readonly printf ${HOME} test awk | 'quoted text' /usr/bin awk $(pwd)
+	-eu x=1 grep printf ${HOME} -eu printf -eu
+		| --verbose | 2>/dev/null ${HOME} awk --verbose awk readonly
+		test echo readonly x=1 readonly echo /usr/bin "$@" ${HOME} | 2>/dev/null
+x=1 echo | | test export grep -eu 'quoted text' $(pwd)
+	'quoted text' | done x=1 "$@" cd readonly export | cd export
+		done export && --verbose -eu awk
+	readonly ${HOME} echo readonly
+		export "$1" --verbose ${HOME} "$@"
+--verbose "$1" test --verbose -eu local "$@" export --verbose
+		done 2>/dev/null printf 'quoted text' 'quoted text'
+		echo --verbose ${HOME}
+printf cd | /usr/bin --verbose printf local 'quoted text'
+2>/dev/null cd readonly cd sed local 2>/dev/null then printf
+done --verbose cd "$@" printf ${HOME} 'quoted text'
+	grep "$1" awk then "$1" ${HOME} $(pwd) 'quoted text' --verbose sed printf local
+		$(pwd) cd grep /usr/bin -eu ${HOME} x=1 2>/dev/null $(pwd) $(pwd)
+		$(pwd) awk ${HOME} -eu test "$@" awk "$@" awk cd awk test | cd | printf 2>/dev/null
+readonly 2>/dev/null $(pwd) local sed printf "$1" test --verbose
+		/usr/bin then ${HOME} cd ${HOME}
+	x=1 -eu 'quoted text' test
+$(pwd) awk 2>/dev/null 'quoted text' 2>/dev/null grep x=1 2>/dev/null -eu export
+| local sed 2>/dev/null -eu
+		done -eu local && 2>/dev/null cd readonly test 'quoted text' done done &&
+test export echo readonly && -eu cd "$@" "$1" --verbose
+		'quoted text' 'quoted text' test ${HOME} $(pwd) -eu x=1 /usr/bin
+	sed echo && readonly done "$@" /usr/bin grep | local
+	2>/dev/null local awk cd | grep cd 2>/dev/null -eu then -eu test --verbose "$1"
+printf --verbose printf "$1" && sed
+	echo $(pwd) 2>/dev/null sed --verbose cd
+printf cd readonly | && local && then "$1" then "$@" /usr/bin "$1" grep $(pwd)
+	"$@" 2>/dev/null x=1 && --verbose then $(pwd) -eu $(pwd) /usr/bin awk local
+		cd 'quoted text' awk local
+printf ${HOME} grep echo 'quoted text' $(pwd) 'quoted text' echo
+| echo echo local done test local
+	"$@" x=1 sed x=1 then echo sed --verbose --verbose grep echo
+sed ${HOME} /usr/bin x=1 x=1 local echo $(pwd)
+	&& 2>/dev/null export echo $(pwd)
+	$(pwd) 'quoted text' echo $(pwd) ${HOME} ${HOME} -eu $(pwd) export "$1" export
+		"$1" "$1" then readonly /usr/bin | grep printf printf local awk done export
+		"$@" echo test grep -eu awk /usr/bin /usr/bin "$@" && 'quoted text' /usr/bin
+	echo && awk done "$@" sed test /usr/bin
+done x=1 | sed then readonly | x=1 then
+&& readonly awk sed printf
+	&& readonly "$1" local sed
+	echo 'quoted text' /usr/bin test
+"$1" awk echo export /usr/bin printf && cd grep
+sed echo -eu local $(pwd) /usr/bin export && readonly ${HOME} "$@" done test
+		readonly local && export sed --verbose && grep x=1 2>/dev/null done printf then
+then && then printf grep sed test --verbose sed printf printf
+$(pwd) 2>/dev/null sed export printf
+	printf 2>/dev/null -eu | ${HOME} /usr/bin echo readonly
+	"$@" x=1 $(pwd) && x=1 test local "$1"
+	sed 2>/dev/null test grep && sed "$@" 'quoted text'
+--verbose "$@" grep grep test readonly done printf
+		$(pwd) done && --verbose then "$1" 'quoted text' 'quoted text' x=1 2>/dev/null
+done then grep cd printf test x=1 echo --verbose | echo --verbose |
+		export awk | cd 2>/dev/null 'quoted text' x=1 echo sed $(pwd) /usr/bin
+		sed sed -eu | --verbose
+	-eu && awk sed 'quoted text' export done done x=1 -eu echo then
+	test grep then 'quoted text' awk $(pwd)
+&& sed 'quoted text' /usr/bin ${HOME}
+		"$@" local echo test $(pwd) printf /usr/bin x=1 | $(pwd) awk x=1 done cd readonly
+		/usr/bin -eu | done grep $(pwd) x=1
+${HOME} --verbose grep sed readonly -eu ${HOME} && | readonly readonly 'quoted text'
+		cd | done && echo then then 2>/dev/null 2>/dev/null
+	| done grep done done 'quoted text' ${HOME}
+		awk cd done cd x=1 && "$@"
+	done readonly cd local $(pwd) sed --verbose
+	--verbose /usr/bin "$1" grep grep echo 'quoted text' printf printf ${HOME} printf
+		readonly --verbose -eu $(pwd) "$@" "$1" x=1
+		"$1" grep then "$1" then | && && && $(pwd) echo 'quoted text'
+	sed 2>/dev/null echo grep -eu /usr/bin
+		&& 2>/dev/null local local done
+		done "$@" $(pwd) && x=1 echo 'quoted text' local then readonly
+${HOME} $(pwd) 2>/dev/null "$@" ${HOME}
+printf local 2>/dev/null export readonly "$@" test $(pwd) | then
+x=1 export -eu cd cd "$1" readonly test sed /usr/bin
+	cd 2>/dev/null cd echo
+		local -eu -eu $(pwd) then
+$(pwd) readonly readonly grep local /usr/bin
+	export $(pwd) -eu export "$1" "$1" 'quoted text'
+	| 2>/dev/null x=1 "$@" echo grep 2>/dev/null test
+then sed ${HOME} ${HOME} local test grep grep printf done &&
+x=1 export echo test && | -eu done ${HOME} grep printf --verbose 2>/dev/null
+		&& grep $(pwd) && 2>/dev/null
+		${HOME} echo grep -eu grep done then printf /usr/bin then done 'quoted text'
+		| 2>/dev/null done local done 2>/dev/null awk cd sed -eu
+	export -eu --verbose ${HOME} -eu /usr/bin --verbose grep 2>/dev/null "$@" readonly
+		export echo test "$@" done
+	'quoted text' 'quoted text' awk cd test
+"$@" /usr/bin "$@" 2>/dev/null awk grep cd && /usr/bin grep
+export then $(pwd) "$@"
+		grep /usr/bin then then sed -eu "$1" /usr/bin 'quoted text'
+--verbose awk x=1 ${HOME} -eu export
+	| "$@" done readonly /usr/bin test cd 'quoted text' local
+test export 2>/dev/null cd awk local export | /usr/bin --verbose test
+&& echo sed 'quoted text' cd && -eu test local x=1 cd grep "$@" | 2>/dev/null
+	-eu && /usr/bin --verbose echo done "$1" "$@" $(pwd) echo "$1"
+	$(pwd) $(pwd) x=1 /usr/bin $(pwd) "$@" "$1" -eu export
+&& awk test x=1 "$1" done --verbose 2>/dev/null export | local
+local "$1" echo 2>/dev/null awk sed --verbose cd readonly
+	'quoted text' /usr/bin then $(pwd) $(pwd) "$1" && -eu 'quoted text'
+	"$1" && -eu readonly test x=1 cd export 'quoted text' done readonly cd x=1 grep
+		export test echo grep --verbose awk echo --verbose
+		x=1 awk --verbose printf &&
+	| | $(pwd) test printf cd | sed
+sed test /usr/bin echo 2>/dev/null test grep
+	readonly echo | cd ${HOME} && local
+	awk | export 'quoted text'
+		done grep --verbose && cd "$1" $(pwd) printf && export --verbose | |
+	&& grep -eu readonly /usr/bin "$1" export 'quoted text'
+	local sed test echo -eu grep x=1 && 'quoted text' "$@" then export
+awk $(pwd) 2>/dev/null 2>/dev/null export done ${HOME} "$@" -eu grep test grep
+$(pwd) export ${HOME} readonly awk -eu echo test grep awk /usr/bin sed x=1
+printf ${HOME} | ${HOME}
+		cd 2>/dev/null /usr/bin ${HOME} "$1" cd sed readonly
+	grep "$1" printf readonly local local -eu export grep readonly test -eu
+		| local done awk sed "$1" x=1 readonly export then printf
+	x=1 readonly awk sed 'quoted text' test echo
+		2>/dev/null printf 2>/dev/null readonly 2>/dev/null
+	| ${HOME} && readonly 2>/dev/null && then ${HOME}
+		cd && 'quoted text' ${HOME} ${HOME} 2>/dev/null | $(pwd) 'quoted text'
+readonly ${HOME} test $(pwd) "$@" | 2>/dev/null printf
+	then && grep echo && local -eu echo /usr/bin
+'quoted text' "$1" && sed then | cd 2>/dev/null readonly sed 2>/dev/null
+		"$1" printf test -eu "$1" && x=1 x=1 awk sed 2>/dev/null 2>/dev/null
+	x=1 echo "$1" | grep | export -eu
+		/usr/bin --verbose /usr/bin | x=1 echo done sed $(pwd) echo
+"$@" echo | done done /usr/bin echo && grep
+sed printf | 2>/dev/null sed awk readonly
+"$@" 2>/dev/null done
+local test echo -eu /usr/bin readonly cd $(pwd) "$1" x=1 ${HOME}
+	test cd grep x=1 x=1 awk "$@" echo done test then cd local sed readonly
+	2>/dev/null sed | cd echo
+'quoted text' $(pwd) echo export
+--verbose /usr/bin test awk echo x=1 2>/dev/null readonly
+		then awk && local /usr/bin "$@" x=1 then 'quoted text' | --verbose && |
+	'quoted text' 'quoted text' local x=1 $(pwd) local awk then test local
+'quoted text' -eu $(pwd) then "$1" done | done /usr/bin readonly test
+	export grep printf /usr/bin
+	printf echo | awk /usr/bin test awk sed printf --verbose
+export local && local | ${HOME} "$@" test /usr/bin "$1" | printf local | then
+then then -eu "$1" printf
+	'quoted text' export local && --verbose /usr/bin test then export
+export test && readonly && "$1" $(pwd) echo
+/usr/bin test "$1" && $(pwd) $(pwd) readonly test
+then x=1 grep sed then test /usr/bin $(pwd) /usr/bin cd 'quoted text' --verbose
+'quoted text' printf 'quoted text'
+		2>/dev/null then readonly /usr/bin x=1 local echo grep 'quoted text'
+	-eu "$1" echo readonly x=1 test && "$@" done test x=1 grep then export
+		echo -eu cd printf local $(pwd) /usr/bin -eu 'quoted text' 2>/dev/null cd sed local
+	cd readonly then done awk $(pwd)
+sed 'quoted text' x=1 local readonly x=1 /usr/bin awk export $(pwd) done
+		&& awk x=1 sed then done cd then local && ${HOME}
+	2>/dev/null -eu $(pwd) readonly ${HOME} cd
+&& echo ${HOME} local done awk -eu
+	test "$@" && -eu sed awk echo readonly sed ${HOME} ${HOME} test export
+$(pwd) awk 2>/dev/null done "$@" "$@" grep readonly
+		done sed /usr/bin "$@" ${HOME} "$@" --verbose 'quoted text' "$@" export
+		test awk 2>/dev/null "$@" x=1 awk local -eu awk x=1 sed local
+	cd local && echo grep 'quoted text' 2>/dev/null $(pwd) && "$1" echo done awk
+	"$1" done ${HOME} --verbose -eu echo ${HOME} -eu ${HOME} export
+readonly echo awk awk grep ${HOME} "$@" ${HOME} sed test cd done "$@" x=1
+	local sed "$@" -eu test /usr/bin
+	$(pwd) 'quoted text' awk local awk done then readonly local -eu test $(pwd)
+		| local export -eu grep sed printf -eu then -eu then grep readonly "$@"
+		echo cd export grep local done && grep done printf |
+	then sed ${HOME} ${HOME} "$1" --verbose -eu printf readonly /usr/bin awk /usr/bin
+	readonly then grep /usr/bin /usr/bin grep 2>/dev/null readonly --verbose
+		$(pwd) sed --verbose export 2>/dev/null awk awk echo --verbose then
+"$@" 'quoted text' 2>/dev/null local /usr/bin
+	&& echo -eu readonly --verbose && 2>/dev/null -eu echo x=1 printf readonly
+export sed echo export
+then echo grep $(pwd) 2>/dev/null export export --verbose && done then done
+${HOME} printf done /usr/bin
+	"$@" -eu 'quoted text' local x=1 2>/dev/null
+		x=1 export && ${HOME} --verbose ${HOME} test
+		&& done 'quoted text' "$@" | 'quoted text' -eu export
+	then /usr/bin done /usr/bin $(pwd) 'quoted text' -eu x=1 && local
+| x=1 printf sed done && echo export done grep | readonly $(pwd)
+		${HOME} echo local && --verbose
+	"$@" then awk "$1" then "$1"
+"$@" ${HOME} grep 'quoted text' "$1" sed
+cd printf x=1 awk "$1" 2>/dev/null && $(pwd) --verbose echo 'quoted text' grep
+&& cd local | grep test done local
+	awk "$1" 'quoted text' test --verbose
+&& && "$@" "$1" "$1" $(pwd) | -eu | 'quoted text' && "$1" "$1"
+	"$1" 2>/dev/null cd grep "$1" readonly awk grep awk sed 'quoted text' awk readonly
+	/usr/bin sed local ${HOME}
+		2>/dev/null sed printf /usr/bin && sed 2>/dev/null "$@" grep
+| grep 2>/dev/null local
+local printf x=1 cd /usr/bin 'quoted text' local export then
+		"$@" done "$1" export readonly readonly export echo $(pwd) ${HOME}
+export done && && awk $(pwd) | echo local "$1" 2>/dev/null echo echo
+		"$1" "$@" test then ${HOME}
+	$(pwd) /usr/bin && awk awk ${HOME}
+&& sed then ${HOME} ${HOME} readonly -eu awk test -eu readonly --verbose
+"$1" -eu then "$1" ${HOME} readonly && && 'quoted text'
+		echo 'quoted text' 2>/dev/null
+done -eu local test | local local
+		-eu -eu grep printf && cd
+	'quoted text' echo x=1 readonly --verbose readonly cd printf "$@" ${HOME} 2>/dev/null
+		local sed "$1" 2>/dev/null 2>/dev/null -eu
+sed grep "$@" local grep 'quoted text' 2>/dev/null
+'quoted text' 2>/dev/null echo "$1" readonly
+		grep 2>/dev/null done then test local && ${HOME} readonly test grep readonly
+	local "$1" then sed $(pwd) -eu readonly export ${HOME} ${HOME}
+"$@" | | && 2>/dev/null done test cd test --verbose readonly readonly printf
+| then grep --verbose echo
+	awk "$@" 2>/dev/null local test awk local printf /usr/bin | cd "$@"
+	'quoted text' readonly readonly "$1" ${HOME} printf printf then cd 2>/dev/null
+2>/dev/null sed x=1 "$@" done 2>/dev/null
+	echo | --verbose | | "$1" local
+	/usr/bin readonly test ${HOME} sed done 2>/dev/null export | sed "$@" --verbose
+		-eu && awk cd grep local | readonly --verbose | -eu x=1 "$@" sed ${HOME} test
+	"$@" export 'quoted text' readonly done x=1 awk -eu && printf x=1 readonly
+		test "$1" sed | /usr/bin -eu then grep 'quoted text'
+	then echo local cd --verbose
+		2>/dev/null awk awk $(pwd) 'quoted text' /usr/bin readonly
+		--verbose cd done then $(pwd) x=1 grep done | export x=1 awk | /usr/bin
+	&& echo then --verbose local -eu
+		&& test then done --verbose local -eu awk grep -eu /usr/bin
+		-eu $(pwd) /usr/bin readonly 2>/dev/null echo grep
+		'quoted text' readonly "$1"
+		echo "$1" $(pwd) then cd 2>/dev/null x=1 cd printf test | sed test /usr/bin
+		'quoted text' done export
+	${HOME} 2>/dev/null then "$1" export 'quoted text'
+	then | then then 'quoted text'
+printf then | && ${HOME} export | grep readonly -eu "$1" grep
+		readonly cd $(pwd) && cd then | "$1" 'quoted text'
+--verbose echo x=1 --verbose | ${HOME} 2>/dev/null | grep done "$1" /usr/bin
+&& readonly --verbose ${HOME} readonly "$1" 2>/dev/null "$1" ${HOME}
+sed sed readonly awk /usr/bin echo local test --verbose ${HOME} local
+		cd grep && grep echo done && | $(pwd) echo | readonly
+	2>/dev/null x=1 -eu done x=1 export echo $(pwd) echo -eu printf
+'quoted text' "$@" x=1 $(pwd)
+		| awk -eu awk then local local | $(pwd) local
+'quoted text' local --verbose "$@" echo 'quoted text' -eu x=1 /usr/bin 'quoted text'
+"$@" --verbose | cd --verbose echo local awk echo "$@" x=1 $(pwd)
+cd "$@" 2>/dev/null grep readonly ${HOME} done x=1 |
+done cd printf test readonly "$@" printf cd export grep x=1 local --verbose "$1"
+		'quoted text' grep printf printf done readonly
+		--verbose grep then readonly
+	cd "$1" --verbose && "$@" "$1" | done /usr/bin cd --verbose
+		/usr/bin /usr/bin local test readonly
+x=1 "$1" ${HOME} x=1 echo awk then then export awk local echo && awk "$@"
+		grep printf --verbose local /usr/bin ${HOME} export cd x=1 && -eu
+		'quoted text' $(pwd) then | 2>/dev/null awk
+		"$@" /usr/bin && && cd local awk $(pwd)
+grep "$@" echo readonly cd ${HOME} && && /usr/bin
+	x=1 && "$1" printf --verbose local
+	2>/dev/null && sed --verbose 2>/dev/null
+		${HOME} echo 2>/dev/null ${HOME}
+	grep echo then "$1" then echo then done && echo /usr/bin 2>/dev/null awk cd -eu
+done -eu sed /usr/bin export done ${HOME} readonly "$1" 'quoted text' printf
+test /usr/bin test sed test
+	| x=1 local x=1 "$1" done then x=1 awk done done grep 2>/dev/null grep
+&& done echo test sed $(pwd) done grep sed | printf 'quoted text' printf echo
+export echo -eu -eu 2>/dev/null sed export printf --verbose | x=1 sed 'quoted text'
+		grep readonly --verbose cd && 2>/dev/null | 'quoted text' sed 'quoted text'
+	done 2>/dev/null x=1 'quoted text' readonly /usr/bin grep echo
+		export "$1" done "$1" echo ${HOME} readonly
+	'quoted text' local printf /usr/bin printf printf
+x=1 done readonly $(pwd) export cd && sed
+		/usr/bin --verbose test "$1"
+	$(pwd) /usr/bin && "$1" --verbose cd cd -eu
+2>/dev/null export 'quoted text' && 'quoted text' export echo local
+	local | echo awk echo ${HOME} && readonly local --verbose done | readonly 'quoted text'
+	'quoted text' 'quoted text'
+"$@" done --verbose test
+	printf && x=1 | --verbose then
+		x=1 echo 2>/dev/null ${HOME} test -eu "$@"
+	| echo 'quoted text' echo sed sed done && awk local
+		x=1 readonly && sed "$@" done 2>/dev/null x=1
+x=1 local x=1 printf local --verbose 2>/dev/null printf
+/usr/bin 'quoted text' ${HOME} "$1" cd 'quoted text' 'quoted text' export
+		export done /usr/bin grep local test 2>/dev/null readonly test export readonly test
+		test "$@" local grep local local local
+done readonly "$1" cd then $(pwd) done ${HOME} test
+printf test --verbose ${HOME} --verbose printf test done && then
+| 2>/dev/null && cd | ${HOME} test export -eu ${HOME} "$1" "$1" cd x=1 "$@"
+	| readonly local test "$@" | --verbose
+-eu -eu "$@" 2>/dev/null /usr/bin ${HOME} 'quoted text'
+	"$@" readonly then && /usr/bin test -eu | readonly x=1 2>/dev/null "$@" grep echo
+	export "$@" $(pwd) printf "$1" 'quoted text' local /usr/bin
+cd $(pwd) /usr/bin ${HOME} echo echo local 'quoted text' echo
+	${HOME} cd awk --verbose printf
+"$1" then ${HOME} cd export | -eu $(pwd) x=1 ${HOME} && readonly 2>/dev/null
+	--verbose --verbose "$@" grep ${HOME}
+printf awk grep 'quoted text' awk done printf 'quoted text'
+		| | grep echo | "$1" export ${HOME}
+echo $(pwd) local 2>/dev/null awk cd ${HOME}
+		echo local 'quoted text'
+		&& grep export export awk readonly
+		x=1 "$@" sed readonly test echo
+		local /usr/bin 'quoted text' && local local export 'quoted text' x=1 x=1
+	test export && -eu && 'quoted text' printf $(pwd) x=1 printf
+	"$@" $(pwd) ${HOME} grep test $(pwd) /usr/bin test printf
+	export done then 2>/dev/null test
+	printf $(pwd) ${HOME} test echo -eu echo 2>/dev/null 'quoted text'
+		/usr/bin --verbose x=1 'quoted text' echo | x=1 then local
+	readonly awk printf && grep "$@" echo echo --verbose
+	/usr/bin $(pwd) export $(pwd) -eu export test
+x=1 --verbose | 2>/dev/null cd "$@" awk done --verbose
+--verbose echo grep ${HOME} /usr/bin done echo
+local then 'quoted text' then "$@" -eu $(pwd) then 'quoted text'
+awk "$@" export /usr/bin
+	sed export /usr/bin then $(pwd) local printf $(pwd) echo done cd 'quoted text'
+$(pwd) sed --verbose cd "$@" local awk | /usr/bin then test --verbose
+	| -eu test cd cd 'quoted text' test test "$1" awk readonly
+	grep /usr/bin test && test x=1 "$1" --verbose sed --verbose sed
+		2>/dev/null && /usr/bin "$@" echo
+	local 2>/dev/null $(pwd) "$1" test "$@" sed |
+grep local x=1 awk cd cd local awk cd awk printf -eu -eu
+	| ${HOME} "$@" 2>/dev/null
+	--verbose echo sed export grep
+readonly echo /usr/bin "$1"
+	cd done sed 2>/dev/null sed test export "$1" "$1"
+	printf | 'quoted text' printf cd cd cd 2>/dev/null then && x=1 /usr/bin test
+	awk local "$1" test 'quoted text' 2>/dev/null test 2>/dev/null test /usr/bin
+&& sed --verbose /usr/bin local $(pwd) echo
+		$(pwd) echo /usr/bin then -eu --verbose --verbose
+done $(pwd) then 2>/dev/null readonly
+	local 'quoted text' --verbose 2>/dev/null cd
+	done --verbose --verbose local then cd && done echo -eu done --verbose 'quoted text'
+		printf export printf test echo test local grep then &&
+		test "$@" readonly test printf echo x=1 sed export
+	local x=1 x=1 grep && "$@" --verbose ${HOME}
+		${HOME} "$@" $(pwd) grep grep -eu printf echo local x=1 cd -eu
+		local ${HOME} 2>/dev/null "$@" "$@" | local
+awk local sed | done && echo export then 2>/dev/null
+		"$@" && /usr/bin export "$@" then | "$@" local export
+	${HOME} --verbose "$@" awk "$1" printf
+		printf export local printf 2>/dev/null --verbose
+	-eu $(pwd) | grep x=1
+		$(pwd) /usr/bin "$@" $(pwd) grep local local test 'quoted text'
+		test readonly cd echo readonly
+	x=1 "$1" echo readonly done ${HOME} grep --verbose printf "$1"
+	'quoted text' readonly echo done "$@" "$@" /usr/bin
+test $(pwd) grep ${HOME} | sed awk "$@" sed printf
+		$(pwd) 2>/dev/null grep done "$@" cd test x=1 ${HOME}
+		awk && 2>/dev/null ${HOME} local echo
+cd && grep x=1 export /usr/bin done test
+		"$@" 2>/dev/null -eu && ${HOME} printf echo
+grep cd x=1 export done printf 'quoted text'
+'quoted text' local echo printf 'quoted text' | grep local
+		${HOME} -eu /usr/bin | ${HOME}
+	echo -eu export $(pwd) 'quoted text' cd then local | local
+export -eu "$1" grep "$1" grep sed awk --verbose test $(pwd)
+	awk echo /usr/bin x=1 $(pwd) test 2>/dev/null readonly | sed $(pwd) --verbose
+		${HOME} readonly ${HOME}
+export x=1 && ${HOME} 2>/dev/null "$1" -eu test grep $(pwd) test
+	&& ${HOME} $(pwd) ${HOME} then $(pwd) && readonly $(pwd)
+local x=1 grep then sed echo grep 2>/dev/null echo test grep x=1
+"$@" --verbose readonly "$1" && x=1 $(pwd) 2>/dev/null then "$1" ${HOME} cd local
+	&& 'quoted text' printf && x=1 then x=1 done -eu | ${HOME} x=1 local --verbose grep
+--verbose then "$@" echo /usr/bin echo then awk ${HOME} local ${HOME} then
+${HOME} grep echo --verbose done -eu echo --verbose "$@" $(pwd) printf then
+&& 2>/dev/null local 'quoted text'
+"$@" $(pwd) then echo "$@" then /usr/bin
+export grep local /usr/bin export
+		$(pwd) then 'quoted text' echo --verbose 'quoted text' "$1" cd then
+		&& done awk /usr/bin x=1
+		/usr/bin awk 2>/dev/null -eu 'quoted text'
+sed && then echo export 2>/dev/null ${HOME} sed $(pwd) x=1
+	&& done $(pwd) 2>/dev/null | readonly grep
+		| local done x=1 'quoted text' cd awk done test && then $(pwd) && "$1" then
+		"$@" grep printf printf "$@" $(pwd) "$@" /usr/bin export 'quoted text'
+		/usr/bin grep readonly 'quoted text' done printf /usr/bin $(pwd) cd "$@"
+	awk "$@" -eu 'quoted text' -eu grep
+	export then local export ${HOME} sed sed
+'quoted text' ${HOME} "$@" -eu | awk $(pwd)
+${HOME} awk test 2>/dev/null 'quoted text'
+	"$@" x=1 /usr/bin && readonly ${HOME} --verbose | printf local sed 'quoted text'
+test printf "$@" then cd sed x=1 awk 2>/dev/null done
+		2>/dev/null $(pwd) 'quoted text' cd 'quoted text' $(pwd) readonly
+		printf "$@" --verbose ${HOME} local
+		echo export printf readonly sed awk -eu ${HOME}
+	2>/dev/null sed && ${HOME} cd then | printf -eu readonly "$@" awk -eu
+	x=1 test echo grep echo then x=1 && /usr/bin | "$1" -eu 'quoted text' grep /usr/bin
+	readonly && awk && /usr/bin readonly 'quoted text' sed -eu
+		export "$@" -eu grep test local sed grep local
+awk --verbose cd "$1" grep 2>/dev/null && grep printf | $(pwd) 'quoted text'
+"$1" export readonly test /usr/bin
+	awk x=1 ${HOME} --verbose --verbose test 2>/dev/null $(pwd)
+		export done then echo test then && done cd grep local
+x=1 export sed test 2>/dev/null -eu | "$1"
+		x=1 local done echo readonly | printf &&
+awk test && | grep --verbose ${HOME} sed
+	${HOME} "$@" sed echo "$@" |
+	| grep && 'quoted text' /usr/bin sed awk readonly test cd echo export
+export export export echo awk x=1 "$1" then $(pwd) sed 'quoted text' grep
+		printf /usr/bin "$1" awk ${HOME} cd printf $(pwd) cd "$@" done local ${HOME} printf
+local && x=1 ${HOME} "$1" 2>/dev/null local test sed export local
+readonly -eu cd $(pwd) grep then -eu export
+&& -eu done 'quoted text' readonly awk && export -eu local /usr/bin
+cd then 'quoted text' | "$@" /usr/bin printf
+		"$@" sed -eu "$@" /usr/bin $(pwd) 2>/dev/null
+		cd x=1 --verbose local /usr/bin test cd printf && sed ${HOME}
+	${HOME} then --verbose -eu printf "$1" 'quoted text' x=1 | grep printf
+	$(pwd) x=1 printf && "$1" sed --verbose --verbose
+		cd local printf cd ${HOME} $(pwd) done 'quoted text' test then
+"$1" --verbose grep /usr/bin grep 'quoted text'
+		| /usr/bin "$1" && then ${HOME} | ${HOME} x=1
+	$(pwd) cd sed then export awk cd done "$@" awk -eu grep cd readonly 'quoted text'
+"$1" && grep awk local cd /usr/bin
+--verbose "$1" test /usr/bin test
+	export cd then | then cd "$@" 'quoted text'
+readonly && "$1" cd $(pwd) grep
+echo export 2>/dev/null 'quoted text' local "$@" /usr/bin
+		2>/dev/null awk && local "$@" grep local echo -eu $(pwd)
+	$(pwd) cd && "$1" x=1 export then echo done test -eu
+		'quoted text' 'quoted text' grep done
+	"$@" ${HOME} x=1 readonly "$1" && readonly export -eu 2>/dev/null 2>/dev/null
+	grep "$1" --verbose x=1 'quoted text' /usr/bin "$1"
+	done printf then done "$1"
+	export 2>/dev/null echo ${HOME} sed grep x=1 2>/dev/null
+		x=1 "$@" echo echo local -eu sed | export
+awk "$1" --verbose -eu local && then x=1 x=1 test grep && readonly
+/usr/bin ${HOME} readonly
+	printf --verbose then x=1 --verbose $(pwd)
+		x=1 /usr/bin sed sed | -eu /usr/bin awk grep | local readonly /usr/bin
+		sed then "$1" sed cd && then echo ${HOME} test sed | awk grep -eu x=1
+		local && --verbose grep done && -eu | $(pwd) export $(pwd) --verbose
+grep local readonly cd $(pwd) ${HOME} sed test
+awk done 2>/dev/null readonly done
+	readonly test 'quoted text' -eu export
+		$(pwd) readonly test --verbose
+	$(pwd) local /usr/bin
+	$(pwd) export export -eu local 2>/dev/null 2>/dev/null /usr/bin
+	| "$1" x=1 $(pwd) "$@" --verbose ${HOME} local test test x=1 |
+	local then awk readonly | cd grep export
+	printf -eu echo grep ${HOME}
+	-eu ${HOME} && cd then | | grep awk -eu x=1 local && echo
+	/usr/bin /usr/bin readonly && local "$@" /usr/bin local 'quoted text' cd
+&& local then x=1 $(pwd)
+		then "$@" sed x=1 export 2>/dev/null export printf
+echo awk echo -eu | $(pwd) awk printf
+awk local "$1" sed cd /usr/bin test printf "$@" printf test grep --verbose ${HOME}
+		--verbose /usr/bin export test 'quoted text' sed --verbose $(pwd) readonly
+printf echo test test awk $(pwd) export | $(pwd)
+		/usr/bin -eu local awk then sed done then x=1 -eu grep /usr/bin grep
+		awk && $(pwd) && ${HOME} "$@" -eu ${HOME} /usr/bin then export /usr/bin
+	printf printf test -eu "$@" 'quoted text' && "$1" test
+awk --verbose /usr/bin "$@" --verbose 'quoted text' x=1 awk readonly test
+printf cd 'quoted text' ${HOME} sed test done awk awk "$1"
+	'quoted text' -eu ${HOME} -eu local "$@" readonly awk cd ${HOME} sed x=1
+		| awk | "$@" -eu && ${HOME}
+readonly 'quoted text' readonly test "$1" 'quoted text' /usr/bin && test
+		2>/dev/null awk local grep 2>/dev/null awk then done 'quoted text'
+2>/dev/null $(pwd) $(pwd) printf x=1 -eu then $(pwd) export
+		x=1 "$1" && /usr/bin |
+	/usr/bin x=1 readonly ${HOME} then &&
+		x=1 -eu local readonly sed echo "$1" ${HOME}
+| grep then "$1" 'quoted text' test grep -eu ${HOME} then "$1" echo echo printf
+	${HOME} --verbose | local $(pwd)
+	cd echo echo -eu --verbose 2>/dev/null grep test 2>/dev/null sed ${HOME}
+	-eu readonly printf awk | $(pwd) -eu -eu grep && | grep
+readonly readonly done x=1 test echo readonly local
+	grep then --verbose then && echo done | then && -eu -eu | && $(pwd) printf echo
+grep $(pwd) -eu test x=1 | done test -eu && -eu done grep 2>/dev/null -eu ${HOME}
+sed "$@" && "$1" 'quoted text'
+		${HOME} test /usr/bin readonly local awk "$1" awk printf awk ${HOME} 'quoted text'
+		printf 'quoted text' echo | | $(pwd) x=1 --verbose printf grep local
+-eu $(pwd) export export "$@" cd && "$1" "$1" readonly awk cd then then then
+		export | $(pwd) sed cd $(pwd) 'quoted text' |
+		echo sed "$@" cd awk 2>/dev/null cd -eu done grep done test | "$@"
+	${HOME} grep cd echo test
+	readonly echo $(pwd) /usr/bin 'quoted text' x=1 export $(pwd)
+	done test echo test "$1" $(pwd) ${HOME} ${HOME}
+	done $(pwd) test $(pwd) x=1 export local printf test then cd --verbose
+local grep printf --verbose echo local
+printf sed "$1" local ${HOME} x=1 "$@" sed done test done
+		sed && "$@" readonly awk export 2>/dev/null 'quoted text' "$1"
+	--verbose test $(pwd) cd ${HOME} && cd export grep then
+		"$@" -eu echo 2>/dev/null 'quoted text'
+	&& 'quoted text' && then /usr/bin && printf /usr/bin "$@" 'quoted text' 2>/dev/null
+	done cd | readonly done local cd --verbose echo $(pwd) "$1" 2>/dev/null grep
+	x=1 'quoted text' readonly x=1 2>/dev/null
+	local -eu test awk "$@" "$1" "$@" 'quoted text' && $(pwd) printf /usr/bin
+'quoted text' cd awk $(pwd) grep then test sed test /usr/bin $(pwd) echo
+		grep printf sed printf "$@" done | grep cd $(pwd) $(pwd) 'quoted text'
+local "$1" --verbose export -eu $(pwd) x=1 ${HOME}
+	echo ${HOME} -eu export echo test
+"$@" "$1" && -eu $(pwd) printf grep 'quoted text' printf export grep done
+readonly local cd export sed /usr/bin
+echo cd 2>/dev/null export echo ${HOME} --verbose
+	"$@" 2>/dev/null --verbose awk readonly sed $(pwd) grep sed printf -eu cd
+	printf export x=1 x=1 "$1" awk printf $(pwd) $(pwd) --verbose then
+	awk then && 'quoted text' echo done awk then printf
+	printf | awk test cd done cd ${HOME}
+/usr/bin 'quoted text' sed local test grep done | && local export
+	$(pwd) -eu $(pwd) then 2>/dev/null --verbose x=1 echo $(pwd) test cd -eu done
+		readonly done /usr/bin /usr/bin test awk then | then | $(pwd) 'quoted text'
+	'quoted text' done readonly "$@" "$@" echo 'quoted text' printf readonly -eu
+echo readonly done done echo
+	2>/dev/null 'quoted text' | printf then 'quoted text'
+	&& awk cd grep export export -eu sed
+	cd printf ${HOME} export sed && test done x=1 export &&
+		echo then && printf sed
+	x=1 -eu -eu 'quoted text' local test readonly local
+	${HOME} echo /usr/bin readonly
+		echo export "$1" /usr/bin cd "$1" export then local export ${HOME} ${HOME}
+		then local test readonly awk &&
+-eu 'quoted text' awk "$1" grep /usr/bin ${HOME} | export then grep echo "$@"
+		&& done "$@" --verbose $(pwd) awk && local -eu "$@"
+		readonly x=1 readonly readonly "$1" test done cd | "$@"
+		${HOME} ${HOME} test && | 2>/dev/null "$@"
+	$(pwd) -eu test sed /usr/bin ${HOME} && | 2>/dev/null 2>/dev/null then test
+| test sed ${HOME} ${HOME} "$1" export done
+		grep export $(pwd) export -eu cd grep readonly | awk --verbose
+awk 2>/dev/null ${HOME} "$@" ${HOME} "$@" /usr/bin
+		echo 2>/dev/null x=1 "$1" /usr/bin --verbose test
+"$1" 'quoted text' export then /usr/bin done 2>/dev/null /usr/bin
+	$(pwd) echo $(pwd) "$@" readonly "$1" -eu sed printf "$@" awk test printf
+		sed echo echo sed then export export
+		sed then --verbose cd export 'quoted text' "$1" done local export
+done readonly 2>/dev/null | "$@"
+"$1" export then 'quoted text' grep -eu
+		printf sed local printf awk printf grep then
+awk 'quoted text' "$1" done printf awk test 2>/dev/null
+	-eu 2>/dev/null test $(pwd) cd printf "$@" --verbose $(pwd)
+		test awk readonly export sed awk 'quoted text'
+	export test "$1" printf 2>/dev/null "$1" --verbose readonly
+	"$1" "$@" done done $(pwd) then -eu /usr/bin | local --verbose echo local /usr/bin
+		cd local 'quoted text' ${HOME} done "$@" then echo awk echo --verbose
+		'quoted text' export readonly local export
+		'quoted text' $(pwd) local "$@" printf echo printf "$1" -eu
+		2>/dev/null sed then 'quoted text' ${HOME} echo printf x=1 -eu
+	then echo $(pwd) "$@" 'quoted text' echo "$1" test awk x=1 'quoted text' x=1
+		echo --verbose echo test -eu -eu done
+${HOME} x=1 -eu cd | test -eu ${HOME} awk $(pwd) grep 2>/dev/null test -eu echo
+	x=1 x=1 local printf x=1 $(pwd) export echo x=1 | "$@"
+then -eu "$@" test local readonly echo grep | awk echo grep $(pwd) x=1 done
+test local | ${HOME} test export $(pwd) $(pwd)
+		x=1 echo && grep test echo "$@" -eu /usr/bin $(pwd) /usr/bin $(pwd) cd -eu awk
+then && --verbose --verbose then then -eu
+		--verbose export $(pwd) && ${HOME} ${HOME} | ${HOME} 2>/dev/null
+grep then && readonly && grep | readonly -eu printf
+	| done 'quoted text' ${HOME} --verbose 2>/dev/null then 2>/dev/null
+	local "$1" && then sed ${HOME} 2>/dev/null grep printf echo
+grep awk echo -eu done grep test then $(pwd)
+printf cd export $(pwd) done
+"$@" --verbose awk export done local test -eu "$@" echo
+		"$@" sed cd | -eu then grep local printf 2>/dev/null $(pwd) echo local
+	"$@" && grep $(pwd) &&
+	echo "$@" sed grep printf | 'quoted text' grep export --verbose
+	"$@" echo "$@" --verbose 2>/dev/null export
+	cd x=1 then done -eu export export local grep sed sed
+&& sed /usr/bin test && 'quoted text' -eu export "$@" x=1 $(pwd)
+2>/dev/null done -eu "$@" && grep readonly export 'quoted text' then
+	echo "$1" cd test echo --verbose
+		awk "$1" | -eu /usr/bin test -eu /usr/bin done printf && 'quoted text'
+	local 'quoted text' awk "$@" "$@" cd 'quoted text' awk
+	x=1 grep /usr/bin grep test "$@" 2>/dev/null sed "$1" then sed 2>/dev/null
+		done 2>/dev/null export /usr/bin 'quoted text'
+sed echo readonly "$@" 2>/dev/null $(pwd) awk local local
+printf sed readonly /usr/bin awk 2>/dev/null local printf x=1 test awk then
+export --verbose echo "$@" -eu done printf then &&
+$(pwd) x=1 ${HOME} x=1 && cd awk -eu test then "$1" done
+readonly x=1 "$1" test sed /usr/bin sed
+		done ${HOME} $(pwd) export -eu cd printf
+grep test then export sed 2>/dev/null --verbose
+		| local $(pwd) sed ${HOME}
+	readonly "$@" cd local 'quoted text' 'quoted text' local cd -eu | "$1"
+		/usr/bin "$1" printf && "$@" | 2>/dev/null
+/usr/bin echo awk printf "$1" export readonly -eu ${HOME}
+local echo /usr/bin sed then --verbose sed ${HOME} grep | echo --verbose "$@"
+	echo printf echo 'quoted text' export echo "$1" "$1" -eu done ${HOME} echo test
+		&& then ${HOME} test test 2>/dev/null "$@" ${HOME} export --verbose
+		'quoted text' sed local cd --verbose --verbose "$1" echo ${HOME} awk grep local
+x=1 2>/dev/null $(pwd) awk "$1" "$@"
+		/usr/bin && 2>/dev/null ${HOME} test --verbose sed
+echo export readonly done -eu 2>/dev/null
+	grep -eu && "$1" -eu grep 2>/dev/null x=1 /usr/bin printf "$1" readonly cd local
+	awk then echo -eu local export printf readonly 2>/dev/null local
+	grep -eu export "$1" ${HOME} | && cd 2>/dev/null
+/usr/bin x=1 echo && 'quoted text' local /usr/bin
+	${HOME} /usr/bin test 2>/dev/null printf /usr/bin /usr/bin
+"$@" done printf | "$@" ${HOME} done --verbose --verbose | -eu export "$@"
+then readonly ${HOME} 2>/dev/null echo ${HOME} 2>/dev/null
+-eu | 'quoted text' done "$@" test --verbose 2>/dev/null awk printf $(pwd) 'quoted text'
+	printf 2>/dev/null 'quoted text' echo local then echo grep sed -eu "$1" cd ${HOME}
+		printf && "$@" && awk 'quoted text'
+2>/dev/null local awk $(pwd) && done $(pwd) x=1 echo
+		2>/dev/null 'quoted text'
+		cd awk "$@" printf $(pwd) --verbose
+echo sed readonly sed "$1" /usr/bin 'quoted text' then "$1" 2>/dev/null awk cd
+	$(pwd) cd test x=1 cd /usr/bin 'quoted text'
+	readonly test echo readonly $(pwd) awk ${HOME} cd test
+		printf "$@" ${HOME} then 'quoted text'
+		test local readonly | test /usr/bin | done awk 2>/dev/null printf sed readonly
+"$@" "$@" ${HOME} export printf echo
+		-eu awk cd sed && --verbose /usr/bin
+		${HOME} local done done export
+		'quoted text' printf echo && export 2>/dev/null |
+		"$1" awk local sed local --verbose export x=1 export done then -eu done /usr/bin
+		$(pwd) && printf "$1" sed 'quoted text' $(pwd)
+		-eu | x=1 export "$1" --verbose ${HOME} 2>/dev/null
+grep x=1 sed /usr/bin test grep 'quoted text'
+	grep $(pwd) "$1" -eu "$@" done awk
+	cd readonly && $(pwd) | test echo then "$@" "$@" x=1 echo -eu x=1 sed x=1 awk
+		--verbose local x=1 cd x=1 sed cd awk && -eu done awk "$@" /usr/bin
+		readonly && 2>/dev/null grep test test test then
+	--verbose | echo local printf export grep && readonly
+readonly then 2>/dev/null -eu
+		then ${HOME} awk ${HOME} awk | ${HOME} then x=1 grep x=1 readonly
+		export awk x=1 readonly ${HOME} "$@" awk
+		2>/dev/null then grep ${HOME} ${HOME}
+2>/dev/null grep 2>/dev/null
+		2>/dev/null | awk grep
+		sed 'quoted text' grep sed cd /usr/bin test awk -eu x=1 echo cd awk done
+	-eu grep 'quoted text' echo | "$@"
+	readonly done $(pwd) 'quoted text' test x=1 x=1 readonly readonly then
+	/usr/bin echo export sed | grep x=1 x=1 && awk | awk && readonly
+	local cd "$@" "$1" readonly local 'quoted text' printf ${HOME}
+	"$1" export x=1 cd printf $(pwd) local then cd done x=1
+local cd && test "$1" test 'quoted text'
+		"$1" "$1" done 2>/dev/null export "$1" sed then cd then readonly
+done printf && && awk && local printf && cd awk
+export done "$1" $(pwd) export
+		"$@" $(pwd) --verbose awk /usr/bin awk done 'quoted text'
+		2>/dev/null done 2>/dev/null sed cd echo export awk /usr/bin -eu
+done awk /usr/bin | $(pwd) done test local x=1 awk readonly
+		sed x=1 then 'quoted text' 2>/dev/null
+		grep printf -eu && -eu export
+	sed done "$1" "$@" $(pwd) x=1 done 'quoted text' printf done awk && 2>/dev/null
+done /usr/bin "$@" then --verbose $(pwd)
+then test "$@" then "$1"
+		grep readonly ${HOME} -eu readonly && ${HOME} grep x=1 local
+-eu cd awk readonly test echo -eu test -eu printf then "$@"
+grep 'quoted text' test -eu
+		-eu -eu done 2>/dev/null x=1 ${HOME}
+	readonly export /usr/bin
+	then && echo export export && test echo ${HOME} test 2>/dev/null
+		${HOME} -eu $(pwd) then export printf /usr/bin --verbose
+		then then test grep then
+	cd 'quoted text' "$1" local then
+	$(pwd) ${HOME} echo awk printf cd
+		printf done --verbose printf cd grep readonly
+	sed echo --verbose readonly
+		printf 'quoted text' "$@" awk done echo echo 'quoted text'
+		| cd | export && local 2>/dev/null readonly "$1" local "$@"
+	grep | x=1 cd x=1 test
+	done && -eu printf $(pwd) | 'quoted text' cd && echo x=1
+test awk $(pwd) $(pwd) echo awk "$@" --verbose -eu
+then ${HOME} sed printf --verbose sed ${HOME}
+	test -eu done export -eu 2>/dev/null grep
+printf 2>/dev/null $(pwd) 'quoted text' $(pwd) $(pwd) sed x=1 local /usr/bin
+&& $(pwd) readonly grep then "$@"
+	local readonly sed awk done export awk "$1" echo "$@" 2>/dev/null /usr/bin
+	done echo $(pwd) grep $(pwd) "$@" 'quoted text' 2>/dev/null
+	readonly grep cd awk 'quoted text' ${HOME} --verbose | then "$1" cd test test
+		${HOME} printf 2>/dev/null echo cd then sed
+		/usr/bin /usr/bin -eu test ${HOME}
+	x=1 done 'quoted text' --verbose $(pwd) export test
+	/usr/bin 'quoted text' ${HOME} 'quoted text' 2>/dev/null /usr/bin local
+| x=1 'quoted text' | --verbose
+	"$1" done local "$@" "$1" | grep $(pwd) awk |
+	echo sed echo printf test "$@" "$1" $(pwd) | cd then export local echo "$@" echo
+		2>/dev/null "$1" 'quoted text' grep /usr/bin
+test echo $(pwd) "$1" "$@" "$1" $(pwd) && awk sed local
+then readonly local cd export x=1 --verbose
+	"$1" printf readonly "$@" "$1" $(pwd) grep 'quoted text' echo readonly | --verbose
+'quoted text' echo /usr/bin
+		printf echo printf awk export done
+awk then x=1 --verbose -eu test then printf export /usr/bin $(pwd) test sed
+	done $(pwd) printf sed && sed grep printf 'quoted text'
+$(pwd) echo "$@" ${HOME} 2>/dev/null sed echo $(pwd) 2>/dev/null
+	local /usr/bin printf x=1 $(pwd) export printf
+	awk done awk --verbose ${HOME} done --verbose done "$1" x=1 'quoted text'
+${HOME} "$1" --verbose | echo test "$@" local then /usr/bin
+echo readonly readonly sed "$@" test --verbose then x=1 awk && awk --verbose
+	test ${HOME} "$@" cd -eu x=1 "$@" x=1 export test
+awk "$1" grep test export && printf grep
+		sed then 'quoted text' grep $(pwd) done x=1 echo "$@" awk "$1"
+	--verbose printf printf 'quoted text' x=1 echo sed $(pwd) 2>/dev/null /usr/bin
+"$@" x=1 "$1" readonly && 2>/dev/null export "$@"
+		printf export 'quoted text' && awk ${HOME} export "$@" | done awk echo x=1 sed
+		--verbose readonly && /usr/bin echo | export local "$@"
+--verbose "$1" readonly test
+		done x=1 "$@" "$@" "$1" grep | ${HOME} --verbose -eu | awk echo printf
+		readonly "$1" "$@" then sed && && 'quoted text' && then sed echo && "$1"
+		cd 2>/dev/null 'quoted text' 2>/dev/null then "$1" test -eu /usr/bin
+	&& export echo --verbose /usr/bin then -eu ${HOME} $(pwd)
+		-eu -eu --verbose x=1 echo cd /usr/bin grep grep local readonly
+	cd | readonly awk /usr/bin readonly echo && 'quoted text' x=1 echo "$@"
+	local --verbose 2>/dev/null -eu /usr/bin grep
+local "$@" test -eu "$1" -eu | | $(pwd) done grep && test $(pwd)
+		$(pwd) export "$1" done export local | sed 'quoted text' "$1" awk ${HOME}
+local printf "$@" x=1 'quoted text' readonly
+	then --verbose then then -eu ${HOME} awk grep printf export done export export
+sed x=1 awk "$@" && -eu cd --verbose
+awk --verbose /usr/bin | grep printf local 'quoted text' "$@" | test 2>/dev/null
+		x=1 "$@" local -eu x=1 cd && sed
+"$@" cd local printf echo | "$1" && readonly readonly cd done awk x=1
+		cd 'quoted text' test --verbose 'quoted text'
+awk ${HOME} x=1 test $(pwd) cd sed done
+	sed echo 2>/dev/null test test ${HOME}
+		done echo /usr/bin awk awk /usr/bin | "$@" x=1 ${HOME} x=1 export "$1"
+${HOME} -eu local | then then x=1 --verbose test cd /usr/bin echo
+	sed "$1" then "$@" local printf "$@" grep local export
+		${HOME} local 'quoted text' /usr/bin && sed ${HOME} cd
+	echo test 2>/dev/null done grep echo
+	cd --verbose awk 'quoted text' 'quoted text' then test ${HOME} ${HOME} awk cd
+	"$@" local "$1" 2>/dev/null printf done cd local -eu local awk
+	sed done cd | echo 'quoted text' 'quoted text'
+		printf awk readonly echo printf /usr/bin &&
+		printf local awk | then | printf "$@" "$1" awk "$1" 2>/dev/null
+		printf test test test awk x=1 then export "$@" && readonly echo printf
+	grep ${HOME} export test -eu && --verbose printf cd
+		readonly echo 2>/dev/null ${HOME} --verbose
+	'quoted text' done cd export 'quoted text' && local
+'quoted text' local -eu | export "$@" | -eu awk readonly
+'quoted text' echo | x=1 echo awk x=1 readonly 2>/dev/null 2>/dev/null
+		echo then ${HOME} then 'quoted text'
+	done $(pwd) local "$1" readonly ${HOME} && grep ${HOME}
+	/usr/bin --verbose cd then "$1" | test | local "$@"
+		sed ${HOME} -eu readonly /usr/bin
+	grep 'quoted text' 2>/dev/null $(pwd) export --verbose
+| /usr/bin grep printf | done grep
+	test cd awk --verbose "$1" grep awk done export | "$@" local
+		grep $(pwd) x=1 then $(pwd)
+	cd cd cd local /usr/bin readonly printf test
+| awk sed printf ${HOME} printf export cd -eu grep readonly
+x=1 $(pwd) printf test --verbose sed sed
+	$(pwd) printf sed $(pwd) export $(pwd) then sed 2>/dev/null 'quoted text'
+		$(pwd) echo echo printf awk done echo | && x=1 readonly sed $(pwd)
+--verbose "$1" $(pwd) sed echo local done 2>/dev/null -eu | -eu done then x=1 grep
+	awk x=1 echo printf ${HOME} readonly echo -eu 2>/dev/null local readonly test |
+		-eu --verbose "$1" $(pwd) awk test "$1"
+2>/dev/null then grep echo readonly --verbose grep ${HOME} local ${HOME} x=1
+	-eu -eu ${HOME} test then local printf
+		"$1" readonly then 'quoted text' echo readonly 2>/dev/null
+--verbose 'quoted text' local "$1" "$@" printf "$@" cd test
+		sed cd x=1 sed awk | -eu x=1 $(pwd) && export "$1" cd readonly
+		&& | && | x=1 "$1" 'quoted text'
+x=1 | done && x=1 "$@" $(pwd)
+		sed 'quoted text' 'quoted text' $(pwd)
+awk -eu "$@" $(pwd) done "$@" ${HOME} export cd
+'quoted text' echo printf && readonly $(pwd) 'quoted text' printf
+		x=1 && $(pwd) then test -eu done readonly then
+export sed && 2>/dev/null then /usr/bin cd test awk x=1 awk test echo "$@"
+	readonly readonly -eu --verbose
+		grep awk "$1" echo echo export
+local | 'quoted text' readonly /usr/bin done "$1" done ${HOME} 'quoted text' cd
+		export awk grep local 'quoted text' 'quoted text'
+awk awk | readonly test --verbose cd && awk /usr/bin
+x=1 test local sed readonly
+${HOME} export readonly | test printf cd x=1
+cd && awk --verbose 2>/dev/null 'quoted text'
+		export done printf awk local
+		"$1" -eu cd readonly x=1 export
+	x=1 export | test -eu -eu echo
+echo "$1" -eu ${HOME} | done && | then
+		"$@" then x=1 export done --verbose echo then awk done x=1 grep cd --verbose
+$(pwd) $(pwd) x=1 echo printf | grep "$1" printf | && printf
+	&& ${HOME} | sed done "$@" "$1" grep printf "$@" --verbose &&
+		x=1 test grep "$@" --verbose printf && sed echo local done $(pwd) x=1
+		local echo sed $(pwd) --verbose grep local && then awk
+		then 2>/dev/null "$1" ${HOME} --verbose
+		$(pwd) ${HOME} awk export
+		export ${HOME} x=1 $(pwd) local /usr/bin export printf -eu awk done sed awk ${HOME}
+	then x=1 "$1" done done x=1
+		--verbose "$@" $(pwd) 2>/dev/null test printf
+grep test | done grep printf /usr/bin printf
+		test "$1" then /usr/bin awk done --verbose | done "$@" test export
+	local ${HOME} && then sed printf
+	${HOME} printf echo printf 2>/dev/null cd sed then done --verbose 2>/dev/null
+-eu local readonly && "$@" test test $(pwd) -eu then && | then "$@" cd &&
+	echo "$@" local local echo printf echo printf export | "$@" test done
+	awk --verbose readonly $(pwd) sed sed local /usr/bin | |
+export && done ${HOME} ${HOME} local 2>/dev/null
+"$@" $(pwd) | local cd sed ${HOME} -eu "$1" /usr/bin cd local
+		"$@" x=1 "$1" | | "$@" --verbose test "$1" then export then && done
+		"$@" && "$@" done | x=1 | /usr/bin --verbose local readonly 'quoted text'
+		2>/dev/null 'quoted text' done -eu --verbose readonly
+	"$@" readonly readonly
+		printf "$@" --verbose local "$1" /usr/bin echo | then test cd sed 'quoted text'
+	$(pwd) awk $(pwd) export "$@"
+		then done 'quoted text' && sed echo
+	readonly -eu then x=1 'quoted text' 2>/dev/null
+cd export && readonly "$1" $(pwd) echo awk done && x=1 sed --verbose ${HOME}
+	readonly $(pwd) sed | readonly echo | | cd 2>/dev/null 'quoted text'
+	| echo test "$@" then awk && | then echo
+'quoted text' x=1 "$@" /usr/bin --verbose
+		"$@" ${HOME} "$1" printf local readonly "$@" "$@" printf awk readonly then printf
+	awk readonly grep sed done x=1 2>/dev/null ${HOME} | 'quoted text'
+		done ${HOME} then printf 'quoted text' cd "$1" local --verbose
+		local sed grep echo && "$@" 'quoted text'
+		local | grep then | test awk grep | -eu readonly | done 2>/dev/null
+then ${HOME} $(pwd) cd ${HOME} printf $(pwd) 'quoted text'
+$(pwd) printf awk && then "$1" -eu readonly /usr/bin 'quoted text'
+		/usr/bin then readonly /usr/bin -eu grep "$@" done printf readonly echo local
+	awk 'quoted text' && /usr/bin then done /usr/bin cd
+done export test sed 2>/dev/null sed export |
+		--verbose "$1" x=1 sed "$@"
+		grep done --verbose readonly
+		&& --verbose cd then then export readonly --verbose -eu then "$@"
+	readonly printf local export
+&& | ${HOME} $(pwd) $(pwd) export ${HOME} 'quoted text'
+$(pwd) -eu readonly -eu done
+$(pwd) export export
+		done "$@" ${HOME} sed readonly "$@" readonly echo
+		-eu $(pwd) x=1 export 'quoted text' /usr/bin cd
+	readonly /usr/bin printf -eu sed done local sed done done grep awk
+cd readonly -eu ${HOME} readonly ${HOME}
+	/usr/bin sed "$1" grep && -eu sed sed $(pwd) x=1 echo && done awk readonly awk
+	-eu -eu done && && x=1 then -eu printf echo test
+	2>/dev/null && awk echo && ${HOME} "$@" $(pwd) ${HOME} /usr/bin printf
+readonly ${HOME} test test cd printf -eu awk sed /usr/bin done /usr/bin
+	| ${HOME} ${HOME} export then done "$@" "$@" grep test
+		local 2>/dev/null printf | readonly 'quoted text' "$@" | 2>/dev/null
+printf x=1 -eu 2>/dev/null then $(pwd) "$1" local
+readonly "$1" done sed grep
+		sed -eu 2>/dev/null && readonly then
+export --verbose test x=1
+&& grep | 'quoted text' /usr/bin && /usr/bin $(pwd) "$1"
+		grep -eu /usr/bin 'quoted text' awk
+	readonly local ${HOME} export
+"$@" ${HOME} 2>/dev/null local "$1" grep /usr/bin --verbose "$1" test ${HOME}
+	done ${HOME} sed printf ${HOME} done
+		${HOME} --verbose done echo -eu "$@" export grep cd local
+	export /usr/bin --verbose
+	then sed "$@" 2>/dev/null then sed -eu done ${HOME}
+		2>/dev/null sed test cd && -eu 'quoted text' printf
+	"$1" /usr/bin echo echo awk readonly
+	echo /usr/bin export x=1 test 2>/dev/null
+	| 'quoted text' local | --verbose x=1 grep --verbose
+	2>/dev/null "$1" awk "$1" then /usr/bin && 2>/dev/null
+test && -eu local ${HOME} cd sed test
+		2>/dev/null 2>/dev/null grep awk grep grep "$1" cd test /usr/bin export
+'quoted text' sed local "$@" ${HOME} -eu readonly printf printf sed --verbose
+	'quoted text' cd "$@" | local -eu local awk x=1 local "$1" /usr/bin
+		readonly sed readonly printf -eu done done && && sed local $(pwd) export
+		grep "$1" 2>/dev/null readonly printf ${HOME} 2>/dev/null
+	$(pwd) grep test | export awk test done readonly
+		printf test | grep 'quoted text' "$@" awk then | /usr/bin then
+2>/dev/null echo sed | "$@" --verbose
+		-eu echo local -eu readonly /usr/bin
+--verbose --verbose $(pwd) local export readonly done readonly sed -eu
+		"$@" awk x=1 grep test grep | cd 'quoted text' ${HOME} "$1" $(pwd) ${HOME}
+then then echo sed readonly echo cd sed 'quoted text'
+	echo readonly then grep | 'quoted text' done then "$@" "$1"
+		local printf x=1 | readonly
+	'quoted text' cd 'quoted text'
+printf printf printf ${HOME} cd sed $(pwd)
+	'quoted text' test | $(pwd) cd cd export $(pwd) "$@" readonly local grep printf
+local test "$1" grep sed then /usr/bin 'quoted text'
+"$@" test 2>/dev/null awk readonly echo done 'quoted text' done --verbose
+awk then local sed /usr/bin local local | local test
+	local echo "$@" then sed readonly 'quoted text'
+	x=1 printf -eu | done readonly
+	done $(pwd) echo cd "$@"
+	local export local then echo then done sed | readonly x=1 awk readonly
+		"$@" then | cd grep 'quoted text' /usr/bin
+export "$1" $(pwd) $(pwd) awk cd && -eu echo -eu export test local $(pwd) export
+x=1 test cd "$1" && 2>/dev/null cd "$@" -eu readonly --verbose
+		/usr/bin /usr/bin 2>/dev/null && | cd export
+		done cd test grep && /usr/bin sed echo ${HOME} 'quoted text' grep x=1 test
+readonly local done readonly -eu 'quoted text'
+"$1" $(pwd) readonly echo $(pwd)
+	-eu test $(pwd) && sed --verbose awk $(pwd) done grep ${HOME} && done
+	awk 'quoted text' local done | test "$1" --verbose done cd printf sed
+$(pwd) local test sed ${HOME} test x=1 test x=1 "$1" 'quoted text' printf
+$(pwd) x=1 echo export cd --verbose x=1 x=1 "$@" local
+done done test ${HOME} printf printf local -eu awk x=1
+done grep sed done readonly &&
+		export "$@" awk done readonly then test
+	export -eu cd /usr/bin x=1 readonly done | $(pwd) && --verbose printf printf
+	grep x=1 "$@" /usr/bin "$1" 'quoted text'
+		-eu && x=1 | | /usr/bin | ${HOME} ${HOME} echo $(pwd)
+2>/dev/null readonly "$1" sed "$@"
+"$1" "$@" readonly x=1 cd | "$1" then readonly awk export
+	echo --verbose done cd $(pwd) done 2>/dev/null
+		'quoted text' test test "$1"
+		awk ${HOME} then export
+		sed | echo grep echo grep x=1 echo x=1 "$1" /usr/bin
+-eu sed export echo grep ${HOME} readonly -eu -eu sed local |
+	2>/dev/null ${HOME} sed local | "$@" /usr/bin cd $(pwd) then $(pwd) grep "$1" $(pwd)
+		$(pwd) | | cd cd && 'quoted text'
+	/usr/bin "$1" 'quoted text' "$1" -eu local readonly --verbose ${HOME}
+	grep test done -eu test "$@"
+export | 'quoted text' $(pwd) test done -eu 'quoted text' ${HOME} x=1
+		-eu "$1" "$1" "$@" awk sed then "$@" /usr/bin
+&& && x=1 grep printf 2>/dev/null
+$(pwd) x=1 sed ${HOME} 2>/dev/null
+	$(pwd) printf "$@" local 'quoted text'
+		2>/dev/null printf done awk $(pwd) done local -eu
+	awk ${HOME} export cd /usr/bin printf
+2>/dev/null -eu test --verbose -eu grep "$1" -eu
+	&& export done && printf && 'quoted text'
+"$1" local 'quoted text' echo 2>/dev/null && test x=1 /usr/bin
+	| readonly $(pwd) 'quoted text'
+		x=1 done $(pwd) readonly echo
+	-eu printf sed $(pwd)
+		"$1" x=1 --verbose $(pwd) awk 'quoted text' x=1 2>/dev/null sed 2>/dev/null
+		2>/dev/null | --verbose --verbose
+		"$1" "$@" | -eu && readonly $(pwd) printf "$@" $(pwd)
+	${HOME} /usr/bin done readonly awk "$@" grep export
+x=1 && -eu sed 'quoted text' cd x=1 -eu sed 'quoted text'
@@ -0,0 +1,2001 @@
+		2>/dev/null cd echo 2>/dev/null
+printf echo /usr/bin local local awk |
+	"$1" "$@" /usr/bin local --verbose "$1" printf printf $(pwd)
+	export echo readonly then 2>/dev/null /usr/bin done
+	"$@" test 'quoted text' && then --verbose
+local 'quoted text' grep done cd 2>/dev/null echo "$1" --verbose cd
+		echo then local /usr/bin sed "$1" 2>/dev/null "$1" "$1" printf "$@" $(pwd) 'quoted text'
+	awk done $(pwd) "$@" "$1" | "$1"
+$(pwd) "$1" 'quoted text' sed then awk done
+	${HOME} test export echo sed printf
+	| awk awk "$@" /usr/bin | /usr/bin /usr/bin /usr/bin sed | readonly
+		"$1" --verbose done then x=1 printf ${HOME} local ${HOME} export then &&
+	then "$@" readonly echo printf grep 'quoted text'
+	echo --verbose "$@" 2>/dev/null $(pwd)
+		| 2>/dev/null | | echo $(pwd) "$@" -eu "$1"
+	2>/dev/null 2>/dev/null && && export cd export $(pwd) printf test then
+	x=1 awk x=1 && x=1 export export grep printf /usr/bin 'quoted text'
+done -eu "$1" --verbose $(pwd) cd grep cd awk sed
+grep /usr/bin $(pwd) x=1 /usr/bin /usr/bin then echo test $(pwd) /usr/bin
+"$@" 2>/dev/null x=1 then | $(pwd) printf done --verbose sed 'quoted text' "$@"
+x=1 x=1 2>/dev/null "$1" cd ${HOME} -eu sed cd readonly x=1 | x=1 sed 2>/dev/null
+	local grep $(pwd) && x=1 $(pwd) export readonly 'quoted text' "$@" | "$1"
+		--verbose test awk test "$1" export 2>/dev/null
+		test /usr/bin "$@" 2>/dev/null 2>/dev/null then test
+	done --verbose /usr/bin --verbose
+	| done --verbose x=1 $(pwd) printf /usr/bin
+		grep && x=1 $(pwd) 2>/dev/null "$1" "$1"
+		&& -eu done | 2>/dev/null then | awk 2>/dev/null | --verbose test cd
+echo export 'quoted text' $(pwd) echo 2>/dev/null
+		"$1" 'quoted text' grep --verbose awk
+		"$1" && awk done grep test 2>/dev/null
+grep test && then "$1" $(pwd) && -eu x=1 local grep readonly 2>/dev/null
+	then sed echo x=1 ${HOME} $(pwd) sed ${HOME} local -eu "$@" printf $(pwd) ${HOME}
+	export ${HOME} cd then && echo done readonly grep | printf ${HOME} local
+		then echo -eu -eu /usr/bin 2>/dev/null sed export echo sed readonly echo grep /usr/bin
+&& "$1" local $(pwd) -eu sed
+| ${HOME} awk --verbose local then test test printf sed awk local local --verbose
+		&& $(pwd) -eu --verbose test awk
+		'quoted text' | 'quoted text' test x=1 readonly cd --verbose -eu
+	printf echo $(pwd) done grep sed readonly awk done awk echo local ${HOME}
+		then done -eu done | $(pwd) test $(pwd) && --verbose /usr/bin cd 2>/dev/null
+awk && /usr/bin sed 'quoted text' test
+	"$@" -eu awk 'quoted text' ${HOME} local | printf "$@" x=1 export
+	awk awk done /usr/bin "$1" $(pwd) done 'quoted text' export echo --verbose
+		export echo export done x=1 "$@" ${HOME} grep awk sed
+	done local | printf local x=1
+		test awk --verbose -eu grep && test local /usr/bin 'quoted text'
+awk grep echo $(pwd) local
+		"$@" readonly sed --verbose echo && ${HOME} echo "$1" $(pwd) cd | grep grep
+	-eu export /usr/bin "$1" sed awk $(pwd) printf export
+	2>/dev/null "$1" 2>/dev/null
+local printf /usr/bin && -eu --verbose sed "$@" awk grep test
+		${HOME} "$@" && ${HOME} awk grep export | test done | awk &&
+sed test x=1 then "$1" "$@" grep "$1" "$1" /usr/bin cd grep printf --verbose 2>/dev/null
+	grep $(pwd) "$1" | echo
+		-eu -eu -eu sed "$1" "$@" "$1" ${HOME}
+	echo readonly x=1 cd 2>/dev/null -eu /usr/bin done ${HOME} && printf echo --verbose
+	sed printf cd grep ${HOME} cd | cd x=1 export "$@"
+	-eu local readonly then --verbose readonly --verbose cd done "$1" | /usr/bin
+	/usr/bin 'quoted text' "$@" echo grep export awk "$@" done grep 'quoted text'
+		'quoted text' ${HOME} test cd awk --verbose | then echo /usr/bin grep $(pwd)
+		awk cd ${HOME} export $(pwd) --verbose cd grep printf
+"$1" grep done readonly readonly /usr/bin
+		grep local sed readonly test 'quoted text' printf cd /usr/bin $(pwd)
+		2>/dev/null 'quoted text' echo
+		grep "$@" -eu /usr/bin awk 2>/dev/null "$@" printf
+		done x=1 ${HOME} awk sed &&
+		${HOME} awk done then && grep done -eu
+		"$@" && x=1 awk readonly done done cd grep
+$(pwd) local && -eu --verbose
+	export --verbose readonly ${HOME} sed awk x=1 readonly "$@" -eu grep
+| $(pwd) printf local readonly --verbose readonly echo
+-eu local local -eu --verbose
+	awk then ${HOME} "$@" && local x=1 test cd $(pwd)
+		"$1" test awk printf then "$1" sed && grep "$@" grep "$@" printf && readonly
+		export && grep "$1" "$@" awk grep 2>/dev/null "$@" cd grep && 2>/dev/null
+		"$1" echo 'quoted text' printf $(pwd) export then | $(pwd) ${HOME}
+"$1" done done grep 2>/dev/null readonly echo
+	| local cd && "$@" export 'quoted text'
+x=1 sed export | test cd test grep | -eu awk && "$1" cd
+	readonly printf export && "$1" | echo
+		test $(pwd) cd readonly 2>/dev/null /usr/bin --verbose echo "$@" | -eu test
+x=1 then $(pwd) readonly cd && ${HOME} 2>/dev/null "$@"
+'quoted text' done echo awk /usr/bin x=1 "$1" export readonly
+	grep then echo grep awk test | x=1 --verbose 2>/dev/null echo printf local
+	&& echo | export /usr/bin sed export cd && /usr/bin && x=1 ${HOME} "$@"
+		grep grep cd "$1" "$1" "$@" local printf /usr/bin --verbose
+		echo 'quoted text' test export | x=1 x=1 -eu export "$1"
+local awk done ${HOME} 2>/dev/null 'quoted text'
+		| readonly export export "$1" readonly printf | awk cd $(pwd)
+	2>/dev/null echo printf sed "$1" "$1" local /usr/bin &&
+sed then local export /usr/bin /usr/bin --verbose "$@"
+	--verbose readonly &&
+		$(pwd) ${HOME} printf export awk grep echo 'quoted text' printf
+	-eu sed sed "$@" awk "$@" echo grep "$@"
+done done -eu cd test 'quoted text' 2>/dev/null
+	"$@" "$@" -eu then echo 2>/dev/null ${HOME} grep | "$1" "$@" -eu grep x=1
+		-eu printf /usr/bin "$@" awk -eu && ${HOME} /usr/bin | test
+		test sed awk "$1" x=1 readonly
+	/usr/bin cd -eu test | test | done
+	2>/dev/null sed grep | sed test grep x=1 'quoted text' test sed then $(pwd) readonly
+		${HOME} "$@" -eu /usr/bin done cd done 'quoted text'
+done readonly x=1 -eu grep grep 2>/dev/null echo 'quoted text' ${HOME} local
+sed -eu && grep echo printf x=1 then readonly awk 2>/dev/null $(pwd) "$1"
+done 'quoted text' local export awk readonly sed ${HOME} /usr/bin "$1" printf "$@"
+cd -eu --verbose test "$1" ${HOME} test | /usr/bin awk --verbose -eu
+local 'quoted text' $(pwd) --verbose $(pwd) && then |
+	readonly --verbose | "$@" $(pwd)
+grep export /usr/bin cd
+awk then ${HOME} "$@" ${HOME} "$@" x=1 echo sed cd
+then 2>/dev/null ${HOME} test done && | $(pwd) cd /usr/bin cd readonly 'quoted text'
+	-eu then echo /usr/bin done ${HOME} then "$@" export
+		printf echo awk sed printf echo cd 'quoted text'
+-eu --verbose && test test done && done
+		$(pwd) && "$@" done readonly x=1 done x=1
+| -eu 2>/dev/null cd && 'quoted text' echo export "$1" then
+readonly /usr/bin local "$1" --verbose export 2>/dev/null && export grep
+--verbose cd 'quoted text' cd cd -eu export sed 'quoted text'
+test echo 'quoted text' && printf --verbose test echo "$@" sed grep
+	| ${HOME} $(pwd) awk done
+local export readonly cd test
+echo -eu local echo --verbose
+		sed 'quoted text' x=1 $(pwd) && local local
+done cd 'quoted text' cd local then test sed 'quoted text'
+/usr/bin 'quoted text' then
+| && $(pwd) export echo test done --verbose "$1" ${HOME} "$1" awk && echo "$@"
+		/usr/bin printf test printf awk readonly
+	test echo sed 'quoted text' "$@" readonly done done $(pwd) grep readonly
+grep /usr/bin "$1" readonly 'quoted text' x=1 $(pwd)
+		"$@" x=1 readonly ${HOME} local "$1" printf done then echo ${HOME} 2>/dev/null
+	readonly $(pwd) $(pwd) ${HOME} grep
+echo 'quoted text' printf
+test ${HOME} "$@" echo "$1" printf test
+-eu grep && /usr/bin 2>/dev/null
+		2>/dev/null "$1" cd awk --verbose "$1" ${HOME}
+sed /usr/bin cd ${HOME} then readonly
+	&& /usr/bin 'quoted text' printf export echo export && sed done export local /usr/bin
+2>/dev/null grep export --verbose awk $(pwd) sed "$1"
+	done x=1 ${HOME} grep "$@" sed done "$1" printf export ${HOME} 'quoted text'
+		local cd echo -eu ${HOME} "$@" sed grep "$@" | ${HOME}
+test awk "$@" --verbose $(pwd) /usr/bin
+	x=1 test then ${HOME} 'quoted text' $(pwd) 2>/dev/null cd sed
+"$@" --verbose -eu echo x=1 | export
+	&& then -eu 2>/dev/null test 'quoted text'
+		/usr/bin echo /usr/bin local printf printf &&
+	then test sed printf local printf $(pwd)
+test local /usr/bin grep sed -eu grep "$1" cd /usr/bin /usr/bin
+	done cd x=1 printf export x=1 && grep "$@" done && "$@" then
+test "$@" grep then printf --verbose --verbose ${HOME}
+grep grep then -eu -eu 'quoted text' then local test && -eu
+'quoted text' $(pwd) awk export awk export -eu
+		readonly && test | && "$1" cd "$@" awk /usr/bin cd 2>/dev/null cd
+awk export | $(pwd) then $(pwd) cd readonly -eu readonly
+		done -eu test 2>/dev/null /usr/bin done sed -eu x=1
+readonly test x=1 | printf export |
+2>/dev/null test readonly && $(pwd) printf then local echo echo "$1" 2>/dev/null
+	| && 2>/dev/null -eu ${HOME} done done done -eu sed done x=1 'quoted text'
+	"$1" -eu "$1" 'quoted text' "$@" cd export --verbose
+	cd $(pwd) done --verbose readonly x=1 readonly
+sed sed | ${HOME} "$@" | "$1" "$1" then 'quoted text' /usr/bin sed 2>/dev/null
+	${HOME} --verbose local "$1" test $(pwd)
+/usr/bin sed --verbose sed done local cd awk | readonly "$@" grep $(pwd)
+		| -eu && printf sed | export export
+		done "$@" | printf ${HOME} --verbose sed test |
+	x=1 printf awk test "$1"
+	"$@" printf awk then echo 2>/dev/null --verbose local /usr/bin
+	&& local awk done sed sed export "$@" 2>/dev/null "$1" "$1" $(pwd)
+	awk awk 2>/dev/null sed 2>/dev/null echo export x=1 x=1 cd test /usr/bin
+		x=1 'quoted text' cd sed then "$@" readonly | ${HOME} "$@" readonly
+	then local /usr/bin 2>/dev/null
+sed export sed /usr/bin $(pwd) echo x=1 readonly
+		test done "$@" x=1 echo ${HOME} /usr/bin
+	readonly export -eu readonly -eu && echo --verbose | -eu -eu
+	grep && sed echo ${HOME} test ${HOME} && "$@" && local
+local -eu grep 2>/dev/null sed done
+	-eu done 'quoted text' readonly done cd local 2>/dev/null
+grep x=1 "$@" -eu 'quoted text' echo -eu x=1 | ${HOME} test --verbose $(pwd)
+$(pwd) --verbose awk x=1 echo echo x=1 then 'quoted text' -eu $(pwd) cd
+then grep readonly then
+		echo $(pwd) export sed awk grep
+sed "$@" /usr/bin readonly /usr/bin sed then 2>/dev/null /usr/bin 2>/dev/null
+2>/dev/null && then ${HOME} "$1" local 'quoted text'
+&& "$1" && grep echo sed 'quoted text' awk $(pwd) 'quoted text' $(pwd) | printf
+	then done then echo readonly
+		/usr/bin test x=1 ${HOME} 'quoted text' grep $(pwd) "$1" "$@" ${HOME} cd
+		x=1 echo then then 2>/dev/null 'quoted text' $(pwd) && --verbose
+		| cd printf test | grep "$1" --verbose -eu export | grep local export | sed export
+	then test grep test printf grep "$1" awk test
+	then $(pwd) grep done cd "$1" then done
+		x=1 readonly 'quoted text' x=1 x=1 awk then
+echo 'quoted text' ${HOME}
+		x=1 echo cd export cd "$@" "$1" export && readonly readonly export awk sed --verbose
+local --verbose echo $(pwd) $(pwd) --verbose 'quoted text' $(pwd) grep /usr/bin
+echo echo echo test cd grep 2>/dev/null /usr/bin test x=1
+		${HOME} done /usr/bin grep "$1" $(pwd) --verbose export done then | cd test
+	grep local "$@" && /usr/bin x=1 && readonly
+	sed x=1 $(pwd) | 2>/dev/null $(pwd) cd | then then $(pwd)
+	'quoted text' | 'quoted text' then grep x=1 test x=1 cd "$1" done x=1 -eu readonly
+	grep echo /usr/bin --verbose done
+		done 2>/dev/null awk test && echo done | done sed --verbose printf
+	export "$@" cd 2>/dev/null "$@" /usr/bin -eu awk local grep |
+		--verbose x=1 2>/dev/null x=1 test done readonly -eu
+	awk sed 'quoted text' readonly grep 2>/dev/null "$1"
+		2>/dev/null awk x=1 2>/dev/null
+	test --verbose --verbose --verbose "$@" cd && && "$1" ${HOME} then local
+		2>/dev/null 'quoted text' test awk "$@" "$1" grep
+		-eu sed printf x=1 | 'quoted text' && export
+		export echo echo sed /usr/bin printf export /usr/bin
+	-eu $(pwd) ${HOME} 2>/dev/null
+	2>/dev/null "$@" local $(pwd) local ${HOME} 2>/dev/null
+export then && export ${HOME}
+	/usr/bin then && awk $(pwd) /usr/bin -eu cd export
+		sed grep grep test awk local test --verbose | done cd 2>/dev/null test awk export
+	2>/dev/null && printf x=1 "$1" grep
+	export "$1" then --verbose "$@" "$1" /usr/bin 2>/dev/null
+awk local test ${HOME} "$@" --verbose local export readonly
+readonly x=1 grep export 'quoted text' local 'quoted text'
+	'quoted text' && x=1 | 'quoted text' 'quoted text' "$1" && "$@" test
+		/usr/bin "$1" local awk $(pwd) "$1"
+		export 2>/dev/null done ${HOME}
+&& awk echo 'quoted text' x=1 awk $(pwd)
+	printf done sed -eu "$1" "$@" "$1" export test 2>/dev/null then && sed
+		-eu x=1 "$1" grep --verbose export printf cd "$1" --verbose
+export -eu awk test printf | sed x=1 ${HOME} /usr/bin grep echo
+	awk cd ${HOME} then -eu test echo
+x=1 cd $(pwd) echo awk
+		-eu test "$@" grep ${HOME} 2>/dev/null | cd
+		grep grep printf then cd "$1" then "$1" awk /usr/bin --verbose
+$(pwd) ${HOME} test 2>/dev/null x=1
+	$(pwd) echo sed x=1 ${HOME} sed awk "$@" cd && /usr/bin echo ${HOME} -eu done
+		local done 'quoted text' $(pwd) /usr/bin x=1 awk "$1" then
+	&& ${HOME} "$@" "$1"
+		$(pwd) cd awk printf awk /usr/bin printf
+$(pwd) --verbose local printf ${HOME} 'quoted text' $(pwd) /usr/bin
+	x=1 printf sed "$@" readonly
+	$(pwd) sed 'quoted text' grep cd x=1 cd --verbose "$1" done awk sed grep then
+readonly "$@" local --verbose local && then echo /usr/bin done then 'quoted text'
+	done sed ${HOME} "$@" awk grep /usr/bin 'quoted text' readonly echo ${HOME} export
+	&& ${HOME} /usr/bin && | $(pwd) "$@" 'quoted text' | test
+	cd export export x=1 2>/dev/null echo
+printf x=1 readonly echo -eu "$@" echo --verbose
+	'quoted text' 'quoted text' cd grep $(pwd) 2>/dev/null cd
+		x=1 test local "$1" 2>/dev/null readonly awk
+--verbose -eu --verbose sed cd readonly sed ${HOME}
+		test sed local | ${HOME} awk export test ${HOME} 2>/dev/null
+cd printf readonly | local && 'quoted text' grep readonly done local awk cd
+"$1" echo readonly echo test echo "$@" -eu test | --verbose
+	test "$@" test echo echo grep test /usr/bin
+		awk echo | local grep echo done "$@" x=1 readonly
+		done ${HOME} 'quoted text' done
+	readonly sed done 'quoted text'
+echo && $(pwd) readonly printf done
+readonly "$@" ${HOME} awk -eu awk ${HOME} && test
+readonly | printf /usr/bin local
+	&& 'quoted text' /usr/bin test | then 2>/dev/null x=1 -eu -eu -eu /usr/bin
+done then | x=1 readonly
+		"$1" readonly then sed sed sed x=1 && export then ${HOME}
+		echo x=1 | --verbose awk echo $(pwd) x=1
+grep $(pwd) local --verbose 'quoted text' readonly export echo export
+		$(pwd) readonly readonly "$@" x=1 test ${HOME} awk readonly x=1 ${HOME}
+	sed then && awk local done echo --verbose | ${HOME}
+	test done x=1 done echo
+export readonly export
+	2>/dev/null 'quoted text' readonly cd echo ${HOME} $(pwd) --verbose /usr/bin
+done 2>/dev/null awk cd 2>/dev/null test "$1" -eu test printf
+	echo test then $(pwd)
+$(pwd) then export printf | "$@" readonly $(pwd) export ${HOME}
+sed readonly --verbose 2>/dev/null
+	"$@" then /usr/bin then
+		--verbose printf 2>/dev/null "$@"
+	2>/dev/null then ${HOME} export
+grep --verbose 2>/dev/null ${HOME}
+"$1" /usr/bin $(pwd) -eu 2>/dev/null then 2>/dev/null
+	/usr/bin grep /usr/bin grep then readonly done printf
+	echo --verbose done 'quoted text'
+	| local grep | && x=1 printf printf
+"$1" /usr/bin 'quoted text' test -eu then then ${HOME} "$1" 2>/dev/null grep
+		/usr/bin 2>/dev/null && grep "$@" ${HOME} awk && && 2>/dev/null
+		export readonly sed 2>/dev/null cd --verbose
+		export test test && && /usr/bin
+	export grep done 2>/dev/null && awk echo x=1 local cd export echo then --verbose
+	'quoted text' | printf "$1" x=1 "$1" ${HOME} --verbose --verbose 'quoted text'
+		2>/dev/null x=1 /usr/bin --verbose | awk cd
+		${HOME} --verbose echo awk sed /usr/bin grep awk sed && awk $(pwd) | &&
+	echo then "$@" awk x=1 ${HOME} $(pwd) $(pwd) --verbose | then grep local x=1 ${HOME}
+		export -eu grep | --verbose
+		local x=1 echo | awk $(pwd) test | 2>/dev/null cd echo -eu then 'quoted text'
+local /usr/bin 2>/dev/null echo "$@" 'quoted text' echo 'quoted text' test
+		-eu ${HOME} echo done /usr/bin grep export grep test
+readonly printf "$1" done 2>/dev/null export | x=1
+echo 'quoted text' echo | /usr/bin | awk
+		"$@" --verbose /usr/bin readonly 2>/dev/null local ${HOME} sed
+		-eu done done /usr/bin "$1" 'quoted text' && awk -eu &&
+	"$1" && /usr/bin && printf test
+	export 2>/dev/null "$1" awk done /usr/bin /usr/bin "$@" "$1" 2>/dev/null 2>/dev/null
+	awk local sed | then /usr/bin -eu done then -eu cd done --verbose 2>/dev/null
+"$1" $(pwd) $(pwd) --verbose
+	/usr/bin sed "$1" sed local -eu | "$@" awk x=1 /usr/bin
+test && readonly 2>/dev/null 2>/dev/null sed "$@" done $(pwd) --verbose sed
+2>/dev/null x=1 cd export "$@" $(pwd) awk -eu --verbose printf && awk grep x=1
+	cd grep ${HOME} -eu done test /usr/bin export
+/usr/bin "$1" done printf printf echo | then cd done export --verbose
+| printf local ${HOME} local --verbose grep grep -eu test
+		printf grep echo x=1 grep "$1" --verbose awk $(pwd) then
+		/usr/bin done local "$1"
+$(pwd) awk && echo cd cd $(pwd) && sed awk "$@" local local
+	local sed readonly export | "$1" ${HOME}
+/usr/bin export echo awk cd 2>/dev/null $(pwd) | local done | local 2>/dev/null
+local 'quoted text' 'quoted text' done test "$@"
+		2>/dev/null "$1" echo local && "$@" sed awk --verbose printf
+		then /usr/bin local | readonly
+	x=1 | 'quoted text' sed then cd then
+"$1" $(pwd) then && readonly "$@" | x=1 2>/dev/null && "$@" -eu "$@" 'quoted text'
+		2>/dev/null echo 'quoted text' ${HOME} grep "$1" "$@" readonly then $(pwd)
+'quoted text' "$@" | test -eu && && printf
+	x=1 awk readonly /usr/bin "$1" echo cd awk done -eu test --verbose
+	'quoted text' readonly done
+	2>/dev/null cd x=1 readonly ${HOME} "$1" ${HOME} cd 2>/dev/null 'quoted text'
+		/usr/bin export done cd 'quoted text' printf -eu echo
+		2>/dev/null ${HOME} --verbose readonly | test sed "$@" $(pwd) grep echo
+	printf then cd 'quoted text' --verbose printf "$@" 2>/dev/null
+grep "$@" && awk $(pwd) export readonly -eu "$@" sed awk
+	local && /usr/bin 'quoted text' /usr/bin "$1" test cd -eu ${HOME} "$1" && readonly
+	export grep awk test | echo done
+	'quoted text' sed | done printf "$1" "$@" && echo
+		test x=1 printf --verbose done | ${HOME} grep && grep 'quoted text'
+| printf test test done x=1 $(pwd)
+		-eu | local 'quoted text' awk echo "$@" "$@" done printf awk /usr/bin $(pwd) grep
+	| x=1 cd --verbose cd local $(pwd) /usr/bin local export cd
+	cd cd x=1 "$1" 'quoted text' sed 'quoted text'
+	then | readonly cd export then
+		local | && printf readonly echo then export done x=1 echo
+		test ${HOME} readonly x=1 test readonly "$@" x=1 $(pwd) echo grep
+	cd grep local grep x=1 | export grep awk && && $(pwd) --verbose -eu export
+	-eu cd done test then done
+		awk test readonly test printf echo "$1" then printf readonly then -eu
+		&& done awk printf readonly "$1" awk done 2>/dev/null done | printf "$1" test awk
+		done cd done /usr/bin "$@" test then /usr/bin
+		test printf readonly "$@" local sed | -eu -eu local
+		done x=1 x=1 then printf export test "$@" cd --verbose cd then awk /usr/bin sed
+	local grep | cd readonly printf printf x=1 $(pwd) ${HOME}
+sed ${HOME} $(pwd) export ${HOME} "$1" local ${HOME}
+		test x=1 printf test x=1 ${HOME} awk printf $(pwd) export sed "$1" | /usr/bin
+	| done "$1" echo --verbose then readonly awk printf readonly then sed /usr/bin
+		awk | done /usr/bin "$1" local 2>/dev/null "$1" x=1 | 2>/dev/null
+		"$1" printf "$1" done 2>/dev/null echo
+		2>/dev/null -eu /usr/bin ${HOME} "$1" 'quoted text' && echo --verbose test $(pwd)
+	| ${HOME} "$@" "$@" done --verbose 'quoted text'
+		test 'quoted text' --verbose --verbose "$1" sed printf /usr/bin cd echo echo
+	| sed sed ${HOME} x=1 "$1" x=1 'quoted text' -eu test 2>/dev/null
+sed echo cd 'quoted text' 2>/dev/null test $(pwd) done local awk "$1"
+		local 'quoted text' done $(pwd) x=1 2>/dev/null "$@" then test 'quoted text'
+	export readonly done x=1 grep readonly 'quoted text'
+		--verbose export test grep 2>/dev/null -eu printf "$1" test x=1 "$@" awk readonly
+	$(pwd) readonly done ${HOME}
+		awk grep done sed printf printf -eu && --verbose awk
+grep awk "$@" printf export "$1" awk
+	/usr/bin 2>/dev/null local --verbose x=1 $(pwd) local test done
+local sed export then grep ${HOME} echo done /usr/bin
+		printf -eu -eu awk | -eu test cd x=1 sed done "$@" 'quoted text' export
+/usr/bin | grep 'quoted text' grep cd printf | test done
+	readonly $(pwd) done local
+	"$1" -eu -eu --verbose grep /usr/bin 'quoted text' sed cd "$1" done echo
+${HOME} local done test
+"$@" && ${HOME} done "$@" 'quoted text'
+	"$1" "$@" sed $(pwd) done cd local ${HOME} grep echo | "$1" "$1"
+	$(pwd) && grep grep --verbose x=1 'quoted text'
+		local "$1" awk done |
+	cd done -eu then ${HOME} 2>/dev/null sed then then then readonly test x=1
+		local sed --verbose /usr/bin export cd ${HOME} 2>/dev/null
+	cd "$@" 2>/dev/null ${HOME} x=1 printf test done local | x=1 awk x=1
+	readonly sed -eu "$@" cd --verbose 'quoted text' test export awk ${HOME} sed
+	grep printf -eu 'quoted text'
+		| 'quoted text' && | "$@" awk then -eu -eu test
+		&& 'quoted text' && /usr/bin done export sed readonly 2>/dev/null awk | && --verbose
+		2>/dev/null -eu "$1" test local 2>/dev/null -eu test -eu && /usr/bin
+		| --verbose ${HOME} readonly export 'quoted text' awk awk
+		${HOME} local x=1 -eu ${HOME} test "$@" ${HOME} $(pwd)
+		grep -eu awk readonly cd readonly /usr/bin $(pwd) --verbose "$1"
+		export x=1 2>/dev/null 'quoted text' "$1"
+'quoted text' 2>/dev/null awk 2>/dev/null awk readonly ${HOME} printf grep
+	${HOME} | $(pwd) echo 'quoted text' /usr/bin printf "$@" awk x=1 -eu done local
+	awk ${HOME} "$@" 'quoted text' grep grep sed /usr/bin $(pwd) $(pwd) test echo
+	-eu "$1" export 'quoted text' &&
+		-eu --verbose -eu local $(pwd) 'quoted text'
+	-eu sed readonly test | x=1 2>/dev/null | local 'quoted text'
+		echo ${HOME} done test export -eu local cd readonly local --verbose
+	&& ${HOME} sed --verbose && --verbose sed grep printf "$1" test
+		cd sed echo sed ${HOME} 'quoted text' done test export ${HOME} /usr/bin
+		$(pwd) -eu 2>/dev/null done local | ${HOME} 2>/dev/null readonly cd grep done then
+		2>/dev/null | ${HOME} echo awk readonly $(pwd)
+		"$1" sed awk | ${HOME} sed x=1
+	&& 'quoted text' -eu $(pwd) "$1"
+	| "$1" ${HOME} /usr/bin x=1 local
+	| done /usr/bin awk done | sed $(pwd) readonly "$@" | /usr/bin
+$(pwd) "$1" | x=1 test --verbose
+		"$1" --verbose /usr/bin ${HOME} /usr/bin
+		readonly x=1 --verbose grep 2>/dev/null echo | && echo local
+x=1 cd --verbose done done sed $(pwd) awk --verbose "$@"
+done printf -eu --verbose | /usr/bin readonly --verbose "$1" x=1 -eu
+then printf && then awk | awk sed awk "$@" ${HOME} ${HOME} then "$1" cd readonly
+"$1" x=1 ${HOME} echo ${HOME} "$1" export /usr/bin ${HOME}
+	"$@" grep local awk echo readonly ${HOME} local done
+	export ${HOME} done 'quoted text' && cd sed export
+echo /usr/bin then cd "$@"
+	test ${HOME} 2>/dev/null "$@" local x=1 && export -eu 'quoted text' awk cd "$@"
+-eu done ${HOME} "$1" "$1" sed test "$@" sed
+	--verbose --verbose x=1 2>/dev/null sed awk 'quoted text' readonly "$@" ${HOME}
+	echo sed && readonly then 2>/dev/null awk
+then readonly x=1 'quoted text' cd "$@" awk "$1" export
+		local "$@" "$@" awk printf 2>/dev/null export
+	done 2>/dev/null --verbose printf
+	$(pwd) then local done local | && $(pwd) -eu export /usr/bin cd echo echo ${HOME}
+		x=1 | then "$1" printf grep grep then && sed test test cd
+export printf export --verbose test cd printf ${HOME} then && local -eu $(pwd)
+		'quoted text' test 'quoted text' "$1"
+		'quoted text' done "$@" ${HOME}
+		grep local then grep readonly printf grep sed 2>/dev/null --verbose | | 2>/dev/null
+	$(pwd) | "$1" ${HOME} -eu --verbose local
+	-eu test then 'quoted text' then &&
+		$(pwd) done "$@" | | 'quoted text'
+	local /usr/bin | ${HOME} done "$1" echo then "$@" printf
+	cd echo "$@" -eu then x=1 readonly test ${HOME} export "$1" echo
+	readonly grep ${HOME} 'quoted text' sed readonly sed
+		x=1 -eu && done awk "$1" x=1 echo local "$@" --verbose then cd
+	printf | x=1 ${HOME} cd awk && grep export /usr/bin | 'quoted text' cd
+		&& then printf --verbose ${HOME} -eu printf --verbose "$@" "$1" /usr/bin
+	done "$@" "$1" && awk sed 'quoted text' 'quoted text' then test
+		&& echo "$1" | then local -eu
+		sed 'quoted text' sed done "$@" echo /usr/bin
+| cd -eu test 'quoted text' test $(pwd) "$@" "$@" $(pwd) $(pwd) x=1
+"$@" && 'quoted text'
+'quoted text' /usr/bin awk "$1"
+	echo | $(pwd) $(pwd) --verbose grep /usr/bin done
+	awk test readonly grep readonly
+then test grep 'quoted text'
+cd ${HOME} test test cd x=1 cd && "$@"
+	2>/dev/null && --verbose
+	${HOME} /usr/bin | ${HOME} && export local readonly
+2>/dev/null echo 'quoted text' grep x=1
+		$(pwd) echo export /usr/bin echo "$1" x=1 'quoted text'
+grep grep ${HOME} $(pwd) && test "$@" && local export export export
+readonly local && cd grep "$@" | done printf "$1"
+	/usr/bin -eu cd test -eu then --verbose printf | printf cd done /usr/bin
+		x=1 | 2>/dev/null ${HOME} "$@" grep | grep printf "$1" "$@" cd printf ${HOME}
+	cd ${HOME} --verbose 2>/dev/null readonly awk 'quoted text'
+	echo /usr/bin printf ${HOME} readonly 'quoted text' echo grep "$1" awk -eu done
+		cd printf && $(pwd) then echo -eu $(pwd) 2>/dev/null "$@" 2>/dev/null
+		/usr/bin "$@" "$@" 2>/dev/null --verbose | 2>/dev/null
+	-eu 2>/dev/null cd export -eu x=1 -eu 2>/dev/null
+		done --verbose --verbose /usr/bin cd ${HOME} printf $(pwd) | sed "$@"
+		awk awk $(pwd) export -eu &&
+test done "$1" grep "$1" && awk awk "$@" -eu awk awk "$@" "$1" printf awk ${HOME}
+local done grep --verbose then ${HOME} x=1 cd printf && | done echo "$1" $(pwd)
+	readonly 2>/dev/null readonly grep sed "$1" then "$@" sed sed --verbose awk
+		2>/dev/null 2>/dev/null
+awk echo printf then | awk ${HOME} then ${HOME} test echo
+	--verbose test "$1" done echo local
+		"$1" awk -eu -eu 'quoted text' grep cd awk export | -eu echo "$1" && $(pwd)
+grep cd ${HOME} 'quoted text' readonly readonly printf
+test $(pwd) x=1 && ${HOME} done /usr/bin -eu grep x=1 cd /usr/bin local local 2>/dev/null
+		sed readonly --verbose local /usr/bin
+"$1" --verbose 2>/dev/null
+	awk 'quoted text' awk test readonly grep x=1 2>/dev/null
+		| && test 'quoted text' | export test cd awk echo local /usr/bin
+	--verbose 2>/dev/null grep x=1 --verbose && ${HOME} export && export done |
+	$(pwd) echo "$1" then 2>/dev/null grep then done then printf
+"$1" done "$@" test sed ${HOME} sed cd 2>/dev/null
+		-eu grep && /usr/bin grep ${HOME} $(pwd) grep x=1 2>/dev/null /usr/bin -eu
+	"$@" printf -eu | | ${HOME} grep
+--verbose readonly readonly export local printf -eu done -eu /usr/bin
+	'quoted text' /usr/bin test "$1" awk --verbose export
+readonly test awk test then
+		/usr/bin --verbose then awk
+		readonly cd "$1" local printf
+export x=1 sed printf
+awk printf 'quoted text' done "$@" local done x=1 test && then x=1 $(pwd)
+		--verbose "$@" awk 'quoted text' | readonly awk printf --verbose
+	x=1 done ${HOME} | "$1" sed readonly export done $(pwd) sed --verbose
+"$@" "$@" cd sed | grep --verbose "$1" x=1 sed x=1
+	export echo local done 'quoted text' local test "$@" $(pwd) sed /usr/bin
+&& export sed test awk awk "$1" -eu ${HOME}
+		"$@" test local awk then test "$@" "$@"
+	echo 2>/dev/null cd done | | test
+	test -eu $(pwd) printf "$1" readonly -eu "$1" && x=1 x=1 "$1" readonly local echo
+sed | --verbose cd sed test done "$@" x=1 test readonly local
+grep x=1 export 'quoted text'
+	cd test $(pwd) --verbose | $(pwd) ${HOME} "$@" awk x=1 "$1" "$@" x=1 ${HOME}
+		readonly x=1 /usr/bin ${HOME}
+'quoted text' grep --verbose readonly
+2>/dev/null $(pwd) readonly
+	-eu --verbose "$@" cd readonly grep done -eu 'quoted text' $(pwd)
+		"$@" "$1" && 'quoted text' /usr/bin | && sed && && done 2>/dev/null test test
+	awk 'quoted text' export done "$1" awk "$1" test printf cd x=1 "$@" export -eu
+	printf grep x=1 $(pwd) && && sed "$1" $(pwd) awk readonly then
+"$@" /usr/bin | "$1" $(pwd) local x=1 then export sed | then | ${HOME}
+sed grep local printf cd /usr/bin | awk
+$(pwd) x=1 echo ${HOME} "$1" sed 2>/dev/null readonly echo readonly echo
+/usr/bin -eu local "$1" && -eu awk $(pwd) local awk done --verbose awk sed printf
+x=1 'quoted text' done test readonly ${HOME} readonly echo
+'quoted text' 2>/dev/null then x=1 2>/dev/null cd
+then --verbose sed ${HOME} && -eu "$@" $(pwd) | then ${HOME} echo $(pwd) "$1"
+	"$1" awk printf 'quoted text' -eu ${HOME} | 2>/dev/null cd ${HOME} sed
+		| grep | --verbose test 2>/dev/null 'quoted text' x=1 ${HOME}
+	then x=1 $(pwd) done 'quoted text'
+	awk test "$1" export grep x=1 awk /usr/bin cd $(pwd) "$1"
+done export then $(pwd) done awk test readonly done sed -eu local 'quoted text'
+${HOME} "$1" $(pwd) export && --verbose $(pwd) "$1" "$1" echo /usr/bin local "$@"
+awk local test "$@" -eu sed /usr/bin && export export done x=1 readonly && "$@"
+	echo export done 2>/dev/null cd local -eu grep
+export -eu sed "$1" printf ${HOME} echo "$@" 2>/dev/null "$1" echo "$@"
+		"$@" -eu "$@" cd "$@" && readonly ${HOME} printf && 'quoted text'
+| --verbose 2>/dev/null awk
+readonly 'quoted text' && -eu sed then
+		"$@" | sed then local ${HOME} sed printf "$1"
+	awk export ${HOME} local --verbose
+		grep printf done | $(pwd) --verbose 'quoted text' $(pwd) printf echo -eu
+	export && $(pwd) local export $(pwd) cd | sed cd | grep
+$(pwd) 'quoted text' grep readonly test done awk grep --verbose cd && 'quoted text'
+		-eu printf $(pwd) 2>/dev/null && export 'quoted text' 2>/dev/null
+		test $(pwd) | && test --verbose x=1 awk /usr/bin grep $(pwd) readonly grep echo
+	test readonly x=1 echo local export /usr/bin -eu 2>/dev/null readonly
+--verbose echo x=1 2>/dev/null test ${HOME} printf "$1" /usr/bin done --verbose
+		export export --verbose then && -eu -eu x=1 && "$@"
+	"$@" --verbose x=1 && cd | grep done "$1"
+	/usr/bin | 'quoted text' 2>/dev/null | awk echo /usr/bin
+		"$1" 2>/dev/null printf && ${HOME} export awk ${HOME}
+		awk cd printf | local printf
+		"$1" test x=1 "$1" printf sed echo printf echo test -eu "$@" ${HOME} 'quoted text'
+	| readonly /usr/bin cd && --verbose export
+	test --verbose ${HOME} grep readonly export local printf "$1" done awk &&
+then readonly -eu done "$@"
+		export then -eu readonly "$@" readonly -eu then awk then ${HOME} && test ${HOME}
+'quoted text' | test /usr/bin && && local local done then done | done
+	done ${HOME} done readonly 2>/dev/null
+	/usr/bin export sed then
+		test ${HOME} test readonly 'quoted text'
+2>/dev/null cd ${HOME} 2>/dev/null --verbose $(pwd)
+		--verbose x=1 sed $(pwd) cd 2>/dev/null "$@" | local printf readonly
+$(pwd) "$1" $(pwd) then -eu export -eu
+	echo then 2>/dev/null awk export done export then | printf test readonly
+		"$1" done x=1 sed test grep -eu ${HOME} -eu
+x=1 --verbose printf local printf printf $(pwd)
+		export --verbose | $(pwd) --verbose
+		awk test -eu && "$1" 'quoted text'
+	&& "$@" awk grep done local then test cd cd | local x=1
+		local then ${HOME} "$@" "$@" "$@" | done $(pwd)
+readonly "$@" grep ${HOME} readonly && cd --verbose grep "$@" printf
+/usr/bin --verbose 'quoted text'
+grep readonly awk done ${HOME} ${HOME} awk done --verbose
+	sed ${HOME} test awk grep "$1" done --verbose | readonly printf
+	| -eu done echo local sed
+		printf --verbose "$1" done echo export export /usr/bin echo --verbose grep
+test && $(pwd) cd ${HOME} export done | local $(pwd) cd | --verbose
+	echo 'quoted text' cd | then grep awk "$@" test export awk --verbose awk awk
+test grep cd "$@" export then export x=1 ${HOME} test echo ${HOME} -eu
+		cd --verbose "$1" echo
+&& sed ${HOME} readonly echo readonly --verbose
+		${HOME} | export test "$1" printf "$@" /usr/bin -eu "$@" grep export -eu -eu --verbose
+	-eu $(pwd) "$@" 'quoted text' $(pwd)
+awk | "$@" x=1 -eu cd 2>/dev/null
+	/usr/bin grep --verbose $(pwd) sed 'quoted text' --verbose --verbose
+	/usr/bin 'quoted text' export grep grep echo x=1 'quoted text'
+	&& export --verbose ${HOME} "$1" $(pwd) test
+	-eu "$@" | test done printf echo
+		grep $(pwd) 2>/dev/null 'quoted text' 'quoted text' 2>/dev/null
+-eu echo then $(pwd) $(pwd) -eu awk then x=1 $(pwd) readonly "$@" test export cd
+echo then "$1" "$@" grep then 2>/dev/null $(pwd) test -eu
+		/usr/bin --verbose x=1 test "$1" 'quoted text' $(pwd) cd 2>/dev/null
+'quoted text' "$1" local grep $(pwd)
+2>/dev/null awk printf /usr/bin printf --verbose test
+		cd x=1 cd awk && readonly awk 'quoted text' test ${HOME} test done
+	awk -eu ${HOME} 2>/dev/null $(pwd) cd cd local test --verbose
+	--verbose --verbose awk | -eu local --verbose "$1"
+	readonly "$1" --verbose sed test
+		--verbose printf "$1" x=1 done then grep x=1 x=1 echo /usr/bin grep local
+	grep 'quoted text' then && sed done grep
+done done export cd $(pwd) test printf awk /usr/bin printf
+--verbose grep | export "$1" sed && readonly "$@" -eu | printf export
+	'quoted text' readonly export $(pwd) done printf local "$1"
+	&& x=1 x=1 sed 'quoted text' test
+	readonly "$@" awk echo export grep $(pwd)
+$(pwd) echo 2>/dev/null $(pwd) test sed $(pwd) cd "$1" --verbose
+	test $(pwd) | -eu $(pwd) test printf
+	awk then 2>/dev/null $(pwd) "$1" x=1 done 'quoted text'
+		${HOME} "$1" --verbose cd x=1 local export ${HOME} 2>/dev/null
+		| grep printf test | awk cd x=1 test /usr/bin
+	test sed x=1 grep | sed x=1 /usr/bin sed x=1 sed then "$1"
+	"$@" 'quoted text' -eu awk | readonly -eu ${HOME} -eu sed export -eu 'quoted text'
+$(pwd) /usr/bin grep local
+		done --verbose x=1 ${HOME} export cd "$@" $(pwd)
+		echo /usr/bin grep 2>/dev/null cd then -eu "$@" test readonly ${HOME} test
+	local && awk test ${HOME} test test && x=1 printf -eu $(pwd)
+	"$@" $(pwd) "$1" /usr/bin "$@" cd test --verbose test "$@" "$1" then export
+	echo done ${HOME} x=1 $(pwd) printf sed export echo readonly printf "$1" 'quoted text'
+	"$1" cd done /usr/bin $(pwd) /usr/bin $(pwd) --verbose
+	local done $(pwd) /usr/bin "$1" export export echo ${HOME} echo readonly awk then
+		'quoted text' 2>/dev/null readonly "$@" -eu then done --verbose 'quoted text'
+	local "$@" 'quoted text' sed sed ${HOME}
+		echo local && ${HOME} cd ${HOME} x=1 "$@" ${HOME} $(pwd) export echo
+	sed export | export awk ${HOME} test cd done then grep then export test
+		cd $(pwd) export sed ${HOME}
+'quoted text' && printf grep | | $(pwd) $(pwd) test then export echo
+${HOME} ${HOME} ${HOME} awk "$@" sed cd "$@" printf
+	then | -eu awk 'quoted text'
+		2>/dev/null cd x=1 /usr/bin /usr/bin $(pwd) && readonly then ${HOME}
+--verbose x=1 sed cd --verbose -eu "$@"
+	test printf test $(pwd) local sed awk done
+	echo done then 2>/dev/null "$1" $(pwd) echo && sed readonly export
+		-eu sed readonly printf awk awk sed local 'quoted text' "$@" --verbose
+		then "$1" && test /usr/bin test readonly
+	echo --verbose cd ${HOME} then
+		awk | "$@" ${HOME} awk readonly $(pwd) local awk $(pwd)
+		printf grep "$@" export awk $(pwd) then done echo x=1 sed
+		grep printf test printf test ${HOME} && "$@" 'quoted text'
+		readonly && && ${HOME} sed test
+		2>/dev/null readonly | --verbose test sed "$1" echo cd readonly x=1 ${HOME}
+/usr/bin | export awk readonly "$1" "$1" export
+"$1" export grep sed x=1 && echo sed | echo
+		x=1 cd local "$1" x=1 awk sed | --verbose
+	cd grep echo done && 'quoted text'
+	$(pwd) export test "$@" readonly
+		local 2>/dev/null readonly
+cd done test 2>/dev/null echo printf readonly test test cd x=1 local
+&& /usr/bin $(pwd) --verbose sed
+	test then export readonly readonly
+	grep 2>/dev/null done export local printf printf done $(pwd)
+	grep $(pwd) awk local 'quoted text' echo then grep local test
+echo --verbose -eu cd echo done local 2>/dev/null sed sed sed printf then
+	readonly x=1 $(pwd) cd cd | export
+export readonly cd printf readonly ${HOME}
+		/usr/bin grep $(pwd) "$1" --verbose "$1" /usr/bin test local grep
+		"$@" sed echo 'quoted text'
+then local sed | --verbose x=1 -eu 'quoted text' | awk x=1 && echo grep
+	then readonly -eu 'quoted text' $(pwd) grep x=1 x=1 readonly $(pwd) awk then
+sed && sed ${HOME} export cd sed --verbose
+	| --verbose --verbose done export x=1 readonly "$@" awk "$1" 2>/dev/null
+		readonly x=1 ${HOME} 2>/dev/null "$@" x=1 sed | awk grep && readonly 'quoted text'
+	sed local && x=1 grep done ${HOME} cd export then | $(pwd) export ${HOME}
+		readonly readonly test && 2>/dev/null echo
+	export local readonly export awk "$1" test && done 'quoted text'
+printf | -eu ${HOME} x=1 cd 'quoted text' local /usr/bin
+	$(pwd) x=1 printf awk && | "$@" printf done
+	awk ${HOME} grep readonly echo awk then then printf "$@" grep ${HOME}
+		then awk && "$@" export && "$1"
+	"$1" x=1 --verbose && /usr/bin "$@" readonly printf test test
+	echo "$1" /usr/bin ${HOME} $(pwd) sed -eu ${HOME} x=1 "$@" echo export -eu test
+	cd sed test 2>/dev/null
+x=1 test $(pwd) | && && awk sed 2>/dev/null
+		--verbose ${HOME} 2>/dev/null then
+	awk cd local /usr/bin | --verbose sed local ${HOME} /usr/bin cd readonly "$@"
+		'quoted text' ${HOME} 2>/dev/null /usr/bin --verbose
+x=1 'quoted text' test ${HOME} test export grep ${HOME} |
+$(pwd) awk && echo cd ${HOME} echo "$1" export $(pwd)
+	readonly then printf 'quoted text' && && x=1 ${HOME} $(pwd) -eu --verbose && cd
+'quoted text' sed /usr/bin printf -eu | then "$@" | test test "$@"
+test printf ${HOME} --verbose then awk x=1 readonly echo 'quoted text' 2>/dev/null
+grep "$@" cd test x=1 then
+'quoted text' --verbose ${HOME} ${HOME} && x=1 printf echo then done
+/usr/bin then -eu sed $(pwd) export then "$@" cd $(pwd) readonly
+printf 2>/dev/null awk ${HOME} grep /usr/bin
+"$@" awk | | 2>/dev/null
+		x=1 cd -eu done printf readonly -eu test
+		'quoted text' "$1" --verbose cd $(pwd) cd "$1" ${HOME} x=1 &&
+	-eu done awk && local -eu cd 2>/dev/null
+		${HOME} "$@" "$1" cd "$@"
+printf "$1" 2>/dev/null readonly echo "$1" then "$@" echo done 'quoted text'
+		done awk test cd then local -eu -eu test ${HOME}
+		done awk ${HOME} -eu "$1"
+	done 2>/dev/null 'quoted text'
+		readonly sed readonly then /usr/bin local x=1 done | -eu "$1"
+readonly 'quoted text' /usr/bin
+		"$1" ${HOME} 'quoted text' echo printf done readonly
+grep --verbose test "$@" grep
+echo "$@" cd --verbose "$1" "$@" awk
+then cd echo ${HOME} sed printf local
+		local local && $(pwd) 2>/dev/null printf
+		${HOME} $(pwd) "$1" then /usr/bin test && sed | --verbose "$1" grep readonly grep
+"$@" "$1" /usr/bin 2>/dev/null
+x=1 x=1 "$@" | /usr/bin done /usr/bin sed then then test export awk | $(pwd) ${HOME}
+sed readonly ${HOME} --verbose grep 2>/dev/null awk printf 'quoted text'
+grep && "$1" awk awk test ${HOME} grep --verbose /usr/bin "$1" "$1" awk ${HOME}
+	$(pwd) awk 2>/dev/null -eu x=1 $(pwd) awk local export
+		printf awk -eu "$1" | ${HOME}
+		done local -eu --verbose
+sed grep cd then x=1 && then x=1
+		'quoted text' grep local "$1" cd | -eu 2>/dev/null echo readonly cd && "$1"
+		2>/dev/null x=1 "$@" "$1" sed
+"$1" cd -eu "$@" echo export readonly export ${HOME} awk 2>/dev/null
+export --verbose "$@" --verbose | then /usr/bin local 'quoted text' 2>/dev/null
+printf -eu sed 'quoted text'
+awk "$@" "$1" grep done | test "$1" -eu done test then x=1
+		| awk $(pwd) | cd "$1" export cd readonly ${HOME} "$@" local awk
+	2>/dev/null test --verbose echo sed echo 2>/dev/null test
+		--verbose done export $(pwd) 'quoted text' -eu readonly ${HOME}
+		awk cd $(pwd) sed 'quoted text' $(pwd) sed "$@" awk cd x=1 /usr/bin ${HOME}
+'quoted text' then echo "$@" $(pwd) | export grep ${HOME} "$1" then export awk -eu
+	x=1 2>/dev/null readonly export readonly cd then
+	export -eu /usr/bin $(pwd) --verbose
+		done && $(pwd) printf export "$@" done awk test
+		then | test ${HOME} echo -eu 2>/dev/null && ${HOME} grep $(pwd) then /usr/bin
+${HOME} echo --verbose ${HOME} export
+		readonly 2>/dev/null 2>/dev/null
+	done local | x=1 export echo readonly cd
+		$(pwd) grep then 2>/dev/null printf
+		--verbose --verbose then echo "$1" then 'quoted text' printf
+	2>/dev/null -eu export --verbose ${HOME} 'quoted text' 2>/dev/null
+readonly "$1" then $(pwd) -eu awk done cd /usr/bin then echo
+awk sed sed printf $(pwd) && "$1" /usr/bin ${HOME} awk then
+local done done printf --verbose local echo
+&& test 2>/dev/null local
+printf test export x=1 $(pwd) "$1"
+	--verbose "$@" --verbose /usr/bin
+		"$1" awk $(pwd) grep cd && printf readonly then "$1" echo 2>/dev/null
+--verbose 'quoted text' -eu echo /usr/bin
+		grep -eu awk "$@" /usr/bin
+		&& x=1 echo -eu local readonly && "$@" -eu done -eu
+		sed "$1" x=1 echo export /usr/bin
+		awk "$1" sed test --verbose readonly --verbose
+echo $(pwd) /usr/bin --verbose export $(pwd)
+	2>/dev/null awk test printf && /usr/bin
+printf awk $(pwd) cd local printf "$@" done "$1" $(pwd) | export
+	x=1 sed local && local /usr/bin x=1 done ${HOME}
+		-eu $(pwd) export echo then $(pwd) "$1" x=1 local && readonly
+		cd --verbose "$1" test test -eu /usr/bin printf
+		--verbose --verbose sed /usr/bin readonly $(pwd) local ${HOME} done |
+		--verbose export readonly awk then && x=1
+export -eu sed ${HOME} x=1 echo test $(pwd) then printf 2>/dev/null local
+	awk && "$1" 'quoted text' grep readonly -eu ${HOME} $(pwd)
+		done done grep "$1" $(pwd) then grep 'quoted text'
+		"$@" 'quoted text' | readonly x=1 echo 'quoted text' export
+| cd test local "$@" readonly
+		local export awk done done "$@"
+2>/dev/null awk "$@" | -eu | x=1 grep readonly
+	--verbose local awk then /usr/bin
+/usr/bin grep printf 'quoted text' x=1
+then awk x=1 awk awk local echo printf /usr/bin |
+	"$1" sed ${HOME} $(pwd) /usr/bin /usr/bin awk grep /usr/bin awk
+	printf test readonly printf 'quoted text' printf
+echo "$@" ${HOME} 2>/dev/null echo 'quoted text' "$@" done ${HOME}
+		$(pwd) "$1" export echo readonly readonly
+sed cd echo | done ${HOME} -eu | cd printf
+		"$@" then grep /usr/bin grep -eu sed echo local -eu "$1" local "$1" "$@" sed |
+2>/dev/null readonly && sed printf sed grep "$1"
+local "$1" ${HOME} local | printf local "$1" ${HOME} sed echo test export
+cd awk test -eu awk -eu printf echo /usr/bin local echo done | ${HOME}
+done sed sed readonly echo cd echo awk sed $(pwd) then 2>/dev/null
+	2>/dev/null "$1" | done x=1 x=1 "$1" export cd readonly --verbose
+	cd 2>/dev/null cd && /usr/bin
+	2>/dev/null 'quoted text' test 'quoted text' && 2>/dev/null local x=1 printf
+	| done ${HOME} --verbose then export -eu -eu
+	test sed -eu grep $(pwd) done -eu then "$@"
+	readonly x=1 test awk x=1 ${HOME} 'quoted text' "$1" ${HOME}
+	export awk 'quoted text' then cd cd $(pwd) "$@" ${HOME} done "$@" local 'quoted text'
+x=1 -eu | then echo export
+	$(pwd) cd 2>/dev/null grep "$@" local then grep local then echo echo "$1" ${HOME}
+		echo grep "$@" awk then x=1 'quoted text'
+		awk printf x=1 --verbose local echo readonly cd 'quoted text'
+		-eu && x=1 sed then readonly $(pwd) 2>/dev/null ${HOME}
+&& readonly printf x=1 sed 'quoted text'
+	export cd $(pwd) echo test && readonly export x=1
+		${HOME} ${HOME} ${HOME} echo
+		--verbose /usr/bin echo x=1 'quoted text' 2>/dev/null
+	local | readonly cd printf 2>/dev/null "$@" -eu --verbose done readonly readonly
+		sed "$@" "$@" awk export && "$@" "$1" sed x=1 grep export echo
+		readonly echo then ${HOME} -eu x=1 test sed awk 2>/dev/null | grep
+readonly awk test 'quoted text' then then then readonly test /usr/bin done local
+done echo "$1" "$1" grep done 2>/dev/null
+		grep awk export test -eu /usr/bin $(pwd) sed test --verbose
+		&& | sed then -eu printf "$@" -eu cd awk echo grep -eu local local
+	readonly ${HOME} awk awk
+		-eu 2>/dev/null && $(pwd)
+		grep readonly /usr/bin sed /usr/bin | && | x=1 'quoted text'
+	done ${HOME} awk readonly --verbose printf && printf -eu local test | printf export
+		cd done local /usr/bin && done "$1" /usr/bin awk ${HOME} sed /usr/bin
+grep export done | echo test ${HOME} export
+local && $(pwd) local
+local --verbose done printf -eu x=1 x=1 cd -eu && export "$@"
+${HOME} ${HOME} cd 'quoted text' && awk x=1
+test "$@" | && x=1 sed $(pwd) then && && grep grep 2>/dev/null export ${HOME} "$1"
+		echo printf 2>/dev/null sed
+		2>/dev/null $(pwd) then cd cd readonly && 2>/dev/null
+local cd /usr/bin --verbose test readonly then "$@" printf ${HOME} cd then
+		${HOME} then awk "$@" then /usr/bin 2>/dev/null
+		| sed -eu local printf sed $(pwd)
+		printf /usr/bin readonly && echo test $(pwd) ${HOME} ${HOME} export
+	readonly ${HOME} then ${HOME} export awk local "$@" $(pwd) /usr/bin "$@"
+	sed readonly | done grep then /usr/bin
+		-eu export export readonly ${HOME} export printf readonly
+	local done --verbose "$1" cd cd
+		/usr/bin 2>/dev/null x=1 2>/dev/null then && "$@" "$1" readonly && 2>/dev/null
+	done && -eu readonly test local -eu 'quoted text' cd
+	/usr/bin local echo local
+-eu "$1" /usr/bin done local then $(pwd)
+	"$@" ${HOME} then sed "$1" --verbose 2>/dev/null
+local 'quoted text' /usr/bin awk x=1 $(pwd) export then local 2>/dev/null
+--verbose --verbose $(pwd)
+		test -eu awk echo -eu printf awk
+-eu export && && local cd $(pwd) done | awk
+	then --verbose ${HOME} /usr/bin "$@" sed local --verbose | "$@" "$1" local 'quoted text'
+		/usr/bin export echo /usr/bin done x=1 echo then readonly --verbose sed
+	--verbose | 'quoted text'
+		then awk "$1" echo sed $(pwd) -eu -eu ${HOME} test && echo export
+	test "$1" && cd export --verbose test
+	--verbose printf --verbose
+		2>/dev/null echo "$1" | local export echo 2>/dev/null
+	then | $(pwd) cd export then "$@" local awk done test "$@" awk -eu --verbose
+	then echo | readonly done echo export --verbose 2>/dev/null
+		readonly | /usr/bin ${HOME} | -eu test then readonly $(pwd)
+"$1" /usr/bin then printf printf local $(pwd) ${HOME} ${HOME} | echo then echo
+		&& --verbose $(pwd) printf
+/usr/bin then test "$@" | local /usr/bin x=1 grep export |
+	2>/dev/null -eu cd "$@" 2>/dev/null test /usr/bin sed export
+	sed local test && "$1" readonly local $(pwd) echo /usr/bin awk echo awk
+	readonly grep test readonly $(pwd)
+"$@" "$@" cd then then export local x=1 cd /usr/bin
+sed done local done test 'quoted text' echo export && local awk local
+done awk $(pwd) printf $(pwd) done | | x=1 cd 'quoted text' 'quoted text'
+		| done grep then x=1
+	cd test "$1" $(pwd) then "$@" ${HOME} export --verbose
+		sed /usr/bin | -eu && /usr/bin export
+		grep done test "$1" | 'quoted text' "$@" grep && printf && then ${HOME} x=1
+		awk printf 'quoted text' awk export 2>/dev/null /usr/bin | 2>/dev/null
+		${HOME} done $(pwd) local printf grep test "$@" cd --verbose
+--verbose "$1" sed then cd printf printf -eu sed done sed export 2>/dev/null
+		grep echo sed --verbose | 2>/dev/null export "$1" ${HOME}
+		printf 'quoted text' $(pwd) grep /usr/bin echo awk sed sed "$1" cd && test
+	awk "$1" $(pwd) cd then | | "$1" "$@" local -eu 'quoted text' ${HOME}
+then then sed done 2>/dev/null
+2>/dev/null cd x=1 $(pwd) /usr/bin cd done export | grep
+	echo printf readonly ${HOME} ${HOME} cd --verbose export printf
+then awk then local "$1" "$@" cd cd then echo &&
+		done ${HOME} ${HOME} ${HOME}
+	$(pwd) 'quoted text' readonly cd "$1" grep | && $(pwd) 'quoted text'
+	--verbose readonly sed local ${HOME} ${HOME} echo $(pwd) export echo
+		test printf test | $(pwd) awk awk test 2>/dev/null then printf awk then
+		local printf grep /usr/bin x=1 x=1 ${HOME} --verbose
+echo cd /usr/bin "$1" done printf x=1 /usr/bin grep
+&& awk | --verbose --verbose "$@" then test cd export readonly grep test
+| --verbose x=1 x=1 grep 'quoted text' "$1"
+echo --verbose export export printf printf export readonly 'quoted text'
+-eu "$@" done 2>/dev/null sed echo printf
+		"$@" echo --verbose printf
+		'quoted text' && export echo local "$1" "$1" test then "$@" echo done
+2>/dev/null cd echo && cd
+	"$@" /usr/bin awk echo /usr/bin done echo
+	x=1 ${HOME} $(pwd) awk sed && ${HOME} /usr/bin then export export printf
+		awk && done $(pwd) done then --verbose cd grep test x=1 sed
+	grep readonly done readonly x=1 then 'quoted text'
+	&& grep cd "$@" -eu "$1" local && -eu cd local && local export | printf | export
+	local --verbose readonly test printf echo /usr/bin "$@" grep &&
+--verbose /usr/bin test
+		cd local export export done 'quoted text' 'quoted text' x=1 /usr/bin 2>/dev/null
+	"$1" readonly then printf local cd grep | echo 2>/dev/null
+	/usr/bin 'quoted text' echo x=1 --verbose ${HOME} x=1 | && /usr/bin
+		"$1" 2>/dev/null test ${HOME} /usr/bin local x=1 --verbose awk
+	readonly printf grep export local sed $(pwd) /usr/bin
+	printf ${HOME} grep && -eu then /usr/bin awk 'quoted text' --verbose grep
+cd awk -eu echo $(pwd)
+then "$@" grep then "$1" then "$1" --verbose grep 2>/dev/null "$1" printf
+'quoted text' local -eu printf && $(pwd) --verbose local awk | ${HOME} "$1"
+	export "$@" export x=1 2>/dev/null x=1 export awk awk export
+local 2>/dev/null "$@" awk --verbose --verbose | sed $(pwd) /usr/bin
+readonly 2>/dev/null "$1" ${HOME} done awk ${HOME}
+		readonly grep echo local cd readonly test
+	readonly | awk && "$@" "$@" test readonly then $(pwd) then && "$1"
+	'quoted text' 2>/dev/null sed x=1 /usr/bin then local
+${HOME} x=1 | sed && 2>/dev/null
+&& "$1" 2>/dev/null then --verbose echo "$@" "$1" "$@" grep local local "$1" export
+	grep /usr/bin awk 'quoted text' readonly cd --verbose
+readonly /usr/bin 2>/dev/null then grep
+		printf done local done grep && done grep ${HOME} test cd "$@" grep ${HOME} test
+		test /usr/bin printf grep
+done 2>/dev/null $(pwd) grep test "$@" sed printf && 'quoted text'
+		then 'quoted text' | /usr/bin $(pwd) "$1" test done 'quoted text'
+&& export x=1 | printf done
+	awk cd x=1 cd 2>/dev/null "$1" | test 2>/dev/null echo done --verbose -eu local
+	local "$@" -eu | export 2>/dev/null "$1" 2>/dev/null "$@" 'quoted text' "$@"
+		cd echo awk readonly grep 2>/dev/null printf -eu awk --verbose echo awk
+	x=1 | then "$@" printf x=1
+		sed echo local $(pwd) local "$@" cd /usr/bin
+&& cd awk --verbose echo done "$@" ${HOME} x=1 x=1 sed cd
+		export 'quoted text' echo -eu echo --verbose &&
+		2>/dev/null "$1" ${HOME} 2>/dev/null
+	grep "$1" --verbose x=1 ${HOME} x=1 then && printf
+grep && /usr/bin echo grep readonly done --verbose test sed x=1 grep 2>/dev/null
+		/usr/bin "$@" sed printf test 'quoted text' | then
+		'quoted text' "$1" cd "$1" ${HOME}
+		/usr/bin | done | export -eu printf && local readonly
+	then then $(pwd) test test
+	done local x=1 test -eu echo && "$1" export
+	grep "$1" $(pwd) 2>/dev/null echo printf done
+	&& echo cd -eu test "$1" 'quoted text' $(pwd)
+		${HOME} test awk readonly "$1"
+		/usr/bin readonly awk && ${HOME} cd then printf "$1" printf
+	"$@" sed grep awk --verbose 2>/dev/null -eu | $(pwd) then test test readonly 'quoted text'
+	grep done readonly test $(pwd) printf local done 2>/dev/null done
+| grep && test sed "$@" /usr/bin $(pwd) --verbose awk "$@" awk --verbose local
+		echo export && printf sed 'quoted text' sed $(pwd) 2>/dev/null
+	&& printf -eu cd x=1 awk done cd "$@" x=1 && test
+		x=1 "$1" readonly awk "$1" sed x=1 grep
+		2>/dev/null "$@" readonly 2>/dev/null readonly && grep "$1" cd "$1"
+readonly readonly /usr/bin export done export
+export /usr/bin local done
+	grep grep awk printf awk /usr/bin export echo x=1 then 'quoted text' ${HOME} ${HOME}
+echo sed ${HOME} done readonly export && readonly export 2>/dev/null
+		done "$1" sed cd /usr/bin x=1 --verbose 2>/dev/null then
+		local cd then grep | export test 2>/dev/null "$@" | sed | && printf readonly "$@"
+		test && 2>/dev/null local --verbose export ${HOME} --verbose | echo sed cd -eu
+	local && x=1 awk x=1 && local printf then printf test 2>/dev/null
+		done echo x=1 test --verbose awk "$1" readonly && x=1 local 'quoted text'
+	echo "$@" /usr/bin export then ${HOME} 2>/dev/null --verbose
+	x=1 sed test echo grep && | -eu awk echo cd grep ${HOME} grep "$1" test cd
+	--verbose && local /usr/bin | awk $(pwd) grep -eu -eu readonly sed
+	$(pwd) "$1" "$1" x=1 2>/dev/null done awk done grep
+done 2>/dev/null && cd && export ${HOME}
+	printf | /usr/bin done printf local /usr/bin x=1
+	"$@" test done $(pwd) cd && | && x=1 2>/dev/null "$@" && | 2>/dev/null
+	printf -eu export "$1" 2>/dev/null /usr/bin 'quoted text'
+	'quoted text' then echo done printf /usr/bin && done --verbose --verbose
+		printf echo 'quoted text' awk printf then done test "$1" 'quoted text' grep
+	cd cd -eu local done export printf readonly /usr/bin echo | "$@" 2>/dev/null
+		printf /usr/bin local cd /usr/bin -eu "$1" --verbose
+done | x=1 | --verbose done | export export 'quoted text'
+		awk "$1" printf /usr/bin $(pwd) 2>/dev/null $(pwd) sed /usr/bin
+export /usr/bin local --verbose
+&& readonly /usr/bin ${HOME} "$1" local printf ${HOME} --verbose
+${HOME} local local test test 2>/dev/null
+	$(pwd) then $(pwd) "$@" 2>/dev/null x=1 ${HOME}
+	sed done /usr/bin ${HOME} export
+	--verbose export grep /usr/bin && done awk &&
+		2>/dev/null 'quoted text' readonly done grep sed $(pwd) && "$@" cd done export "$1"
+/usr/bin awk x=1 then && $(pwd) done 'quoted text' 'quoted text'
+${HOME} awk awk x=1 x=1
+/usr/bin -eu echo grep $(pwd) export | $(pwd)
+		cd sed "$1" $(pwd) grep awk /usr/bin readonly
+local --verbose 2>/dev/null /usr/bin export printf "$@" && x=1 cd then
+/usr/bin grep echo export cd
+		done printf "$1" 2>/dev/null x=1 "$1" export $(pwd) done done | "$1"
+	'quoted text' --verbose local readonly "$@" && cd --verbose
+		"$@" export "$@" /usr/bin x=1 x=1
+cd echo 'quoted text' --verbose 'quoted text' $(pwd) done /usr/bin x=1 | "$@"
+		test && grep /usr/bin echo x=1
+		done x=1 && echo readonly cd awk printf
+	sed | then x=1 awk cd cd awk $(pwd) grep then local awk 2>/dev/null printf
+--verbose -eu | -eu /usr/bin done export test export export
+		${HOME} printf x=1 "$@" -eu 2>/dev/null test export
+	-eu grep /usr/bin cd -eu awk printf && 2>/dev/null x=1 readonly
+	| "$1" then readonly cd 'quoted text' cd
+2>/dev/null /usr/bin $(pwd) then cd grep ${HOME} 2>/dev/null
+	printf then x=1 sed sed
+	"$1" "$1" then test grep ${HOME} done done "$1" printf && grep
+done $(pwd) ${HOME} test $(pwd)
+${HOME} 2>/dev/null echo export 2>/dev/null "$1" /usr/bin
+		readonly readonly readonly
+		/usr/bin --verbose | ${HOME}
+	${HOME} local x=1 readonly
+		--verbose printf sed echo $(pwd) export awk $(pwd) sed test grep echo 'quoted text'
+	&& local --verbose /usr/bin export | "$1" printf export && awk
+	| $(pwd) readonly && awk printf "$@" then printf grep export test done
+		readonly ${HOME} awk "$@" "$@"
+awk cd | 2>/dev/null printf readonly readonly then done $(pwd)
+	'quoted text' readonly -eu --verbose done export && ${HOME} awk -eu
+		/usr/bin x=1 echo readonly printf then x=1 done printf grep
+&& 'quoted text' echo export "$@"
+grep -eu 2>/dev/null done
+	2>/dev/null sed 'quoted text' sed
+		cd --verbose echo done --verbose printf $(pwd) /usr/bin -eu then printf grep awk
+	-eu "$@" local 2>/dev/null /usr/bin ${HOME} then test 2>/dev/null test sed "$@"
+test "$1" ${HOME} "$@" local test
+	-eu cd -eu grep sed done local export x=1 ${HOME} 'quoted text' x=1 local
+		printf local readonly test echo ${HOME} /usr/bin awk test $(pwd) && then
+sed | /usr/bin "$1" 'quoted text' echo local sed
+awk export then printf ${HOME} printf readonly sed cd
+	printf 2>/dev/null echo printf
+	grep printf ${HOME} grep
+		x=1 -eu cd 'quoted text' --verbose local cd
+local printf /usr/bin local --verbose ${HOME} ${HOME}
+sed /usr/bin /usr/bin awk readonly x=1 then then /usr/bin
+	cd readonly /usr/bin done echo test
+printf | printf --verbose 'quoted text' /usr/bin done 'quoted text'
+-eu 'quoted text' "$1" cd 2>/dev/null 'quoted text' /usr/bin grep echo ${HOME}
+${HOME} grep --verbose readonly printf
+	"$1" /usr/bin echo sed && cd ${HOME}
+/usr/bin sed | && /usr/bin grep 'quoted text' grep cd readonly /usr/bin "$1"
+		echo local && x=1 sed readonly test cd echo test "$1" ${HOME} echo 2>/dev/null
+	&& 'quoted text' local -eu readonly 2>/dev/null test
+		then "$@" done --verbose awk echo printf 'quoted text' awk done "$@" readonly then
+	awk done "$1" cd then local
+&& 'quoted text' /usr/bin sed done "$@" --verbose $(pwd) x=1 local export sed
+	&& printf /usr/bin "$1" awk export 2>/dev/null
+${HOME} awk 'quoted text' awk 2>/dev/null echo test 'quoted text'
+	awk /usr/bin "$@" --verbose done local -eu readonly grep && "$@" printf 2>/dev/null
+		sed "$@" then | "$@" local readonly local | awk "$@" export export grep then sed
+readonly cd 2>/dev/null
+		grep 'quoted text' cd printf
+--verbose "$@" done 2>/dev/null "$@" "$@" cd "$@" && printf
+sed readonly "$1" $(pwd) 2>/dev/null $(pwd) cd 2>/dev/null
+		readonly 2>/dev/null local 2>/dev/null /usr/bin cd "$@" printf x=1
+cd then export cd grep printf
+#include c134.sh
+		--verbose x=1 then grep "$1"
+${HOME} local "$@" && && 'quoted text' 'quoted text' done ${HOME}
+	2>/dev/null echo local cd sed $(pwd) 'quoted text' done
+		'quoted text' readonly then -eu 'quoted text' && sed | 'quoted text'
+	&& && grep cd done export "$@" then "$1" ${HOME} ${HOME} then printf local local
+	| printf ${HOME} readonly -eu export export --verbose
+	"$@" sed cd | printf --verbose awk "$1" | sed 2>/dev/null "$@" 'quoted text'
+--verbose export grep "$1" ${HOME}
+test sed -eu && $(pwd) sed /usr/bin $(pwd) awk "$@" && $(pwd) $(pwd)
+		readonly -eu echo grep x=1 --verbose "$1" awk $(pwd) echo /usr/bin
+	done "$1" printf 2>/dev/null test export x=1 -eu cd awk x=1
+		export /usr/bin $(pwd) x=1 done sed readonly | "$1" &&
+		cd echo test x=1 && sed --verbose
+cd printf /usr/bin test
+'quoted text' | test cd x=1 awk grep cd x=1 && sed "$@"
+export echo 'quoted text' test grep cd "$1" ${HOME} 2>/dev/null done readonly
+	grep local "$1" "$1" echo | sed 'quoted text' printf
+cd cd local grep --verbose sed /usr/bin
+		2>/dev/null local cd $(pwd) local ${HOME} x=1 'quoted text'
+		/usr/bin -eu ${HOME} $(pwd) $(pwd)
+		/usr/bin 2>/dev/null awk -eu 2>/dev/null /usr/bin
+| then ${HOME} export grep $(pwd)
+local && echo awk local then "$@" sed sed "$1"
+	grep $(pwd) echo done $(pwd) ${HOME} $(pwd)
+		$(pwd) readonly test --verbose done export local done readonly
+	cd readonly "$@" export local grep echo export readonly -eu
+	export done sed then 2>/dev/null cd | x=1 sed x=1 2>/dev/null
+$(pwd) && "$1" --verbose "$@" -eu --verbose echo x=1 printf
+		awk /usr/bin echo done $(pwd) test readonly
+&& test grep echo | printf 2>/dev/null cd readonly test | test local
+${HOME} --verbose $(pwd) test local --verbose printf
+		--verbose echo 'quoted text'
+$(pwd) "$@" && printf /usr/bin
+		'quoted text' sed 2>/dev/null && /usr/bin cd done && $(pwd)
+	/usr/bin "$1" done "$1"
+"$1" awk -eu "$1" ${HOME} "$@" awk test
+&& done cd sed readonly awk local printf && then "$@" "$@" printf printf grep -eu
+		'quoted text' readonly export -eu /usr/bin && 2>/dev/null
+		test 2>/dev/null 2>/dev/null grep x=1 sed grep ${HOME} 2>/dev/null /usr/bin
+	-eu local sed sed && grep readonly ${HOME} --verbose
+echo $(pwd) local "$@" export printf
+		then x=1 "$1" x=1 then grep then then echo x=1 2>/dev/null
+	export -eu sed done "$@" readonly echo cd then echo "$@" $(pwd)
+	export grep done test && "$1" sed echo cd
+	printf cd echo -eu awk 2>/dev/null cd --verbose sed
+/usr/bin x=1 | -eu 2>/dev/null /usr/bin awk done sed -eu -eu then
+	local && done "$1" $(pwd) sed then "$@" --verbose done
+local 'quoted text' readonly echo then /usr/bin done ${HOME} readonly --verbose
+&& grep && cd local | awk local export grep && "$@" then local
+	2>/dev/null && && test && x=1 "$@" x=1 /usr/bin printf
+	| cd test | readonly export
+	echo printf export awk "$@" $(pwd) done --verbose
+grep echo sed printf echo 'quoted text' done 'quoted text'
+	printf $(pwd) "$1" local -eu
+	done "$1" 'quoted text' sed
+		&& "$@" "$@" && 2>/dev/null sed done grep ${HOME}
+	${HOME} -eu ${HOME} readonly done readonly grep readonly printf
+${HOME} test export /usr/bin
+awk awk cd x=1 $(pwd) ${HOME}
+&& readonly local ${HOME} $(pwd) awk local cd sed -eu ${HOME}
+		export awk "$@" readonly printf grep
+		$(pwd) | "$@" 2>/dev/null $(pwd) done $(pwd) test $(pwd) --verbose "$@"
+	"$@" echo 'quoted text' $(pwd) /usr/bin
+		grep done "$@" done awk then echo "$@" echo "$1" /usr/bin sed local
+	"$@" sed 2>/dev/null printf then
+		cd && awk sed awk ${HOME} | cd export
+	${HOME} sed 2>/dev/null local "$1"
+		--verbose && readonly cd grep printf -eu 2>/dev/null local -eu -eu test $(pwd)
+		$(pwd) grep /usr/bin sed then
+	cd && -eu then test x=1 "$@" sed $(pwd) export && "$1"
+	$(pwd) 2>/dev/null local printf sed -eu grep "$1" export sed awk cd done echo
+	'quoted text' x=1 local ${HOME} done x=1 sed 2>/dev/null -eu
+awk x=1 'quoted text' --verbose done
+/usr/bin then readonly x=1 local 'quoted text' && ${HOME} echo $(pwd) export awk
+	readonly test test && readonly ${HOME} | readonly x=1 && local /usr/bin
+	"$1" /usr/bin x=1 local 'quoted text' cd /usr/bin
+		2>/dev/null $(pwd) test echo /usr/bin x=1 "$@"
+| then && ${HOME} x=1 local done /usr/bin "$1" printf
+		grep grep sed --verbose then printf | cd test && $(pwd) sed 2>/dev/null
+		echo && | "$@" then cd local -eu sed
+	local ${HOME} export --verbose "$1" --verbose
+readonly cd readonly done printf
+"$1" sed && printf local --verbose --verbose printf grep 2>/dev/null
+	--verbose | -eu -eu ${HOME} sed 'quoted text' ${HOME}
+	export $(pwd) && printf && "$1" | $(pwd) "$1" "$1" x=1 ${HOME}
+	printf x=1 | "$@" x=1 awk /usr/bin awk x=1 $(pwd) "$@" test ${HOME} grep "$@"
+		export --verbose --verbose 'quoted text' x=1 grep 2>/dev/null
+		&& && awk done export "$1" && grep printf test --verbose test cd cd /usr/bin
+then --verbose readonly -eu local sed sed | "$@" $(pwd) "$1"
+		test | echo local ${HOME} printf "$@"
+--verbose /usr/bin grep then grep sed cd | sed "$@"
+		'quoted text' | -eu 'quoted text' done export local
+		&& "$1" then $(pwd) local $(pwd) | $(pwd) && /usr/bin test cd $(pwd)
+		/usr/bin /usr/bin /usr/bin "$@" readonly
+then | --verbose "$1" grep sed | x=1 --verbose "$1" export
+	awk test 2>/dev/null
+	export test echo $(pwd) awk && $(pwd) printf cd $(pwd) $(pwd) done test
+export "$1" 2>/dev/null echo awk "$@"
+	${HOME} local ${HOME} "$1"
+		echo | then ${HOME} "$@" then 'quoted text' | x=1
+		test "$@" && then /usr/bin
+printf --verbose grep
+	test "$@" 'quoted text' then | sed
+	grep cd echo test echo echo ${HOME}
+		--verbose 'quoted text' --verbose
+		'quoted text' 'quoted text'
+	$(pwd) 'quoted text' && local readonly readonly export then local 'quoted text'
+${HOME} grep test readonly x=1 done sed then printf --verbose 2>/dev/null $(pwd)
+		2>/dev/null && export && printf printf done
+	$(pwd) | readonly ${HOME} 'quoted text' $(pwd) -eu "$@" -eu sed && "$@" 2>/dev/null
+		done /usr/bin x=1 test | "$1" --verbose then $(pwd)
+		printf "$@" done $(pwd) grep /usr/bin 2>/dev/null "$@" echo | local cd readonly
+echo $(pwd) $(pwd) awk readonly 'quoted text' awk 'quoted text'
+		$(pwd) done local readonly "$@" local x=1 printf 2>/dev/null "$@"
+		2>/dev/null echo awk -eu | done sed test "$@"
+	cd cd sed printf readonly 'quoted text' "$@"
+		done $(pwd) 'quoted text' local --verbose -eu $(pwd) cd ${HOME}
+	done done export test
+"$@" | grep then local
+	printf $(pwd) && ${HOME} echo
+		grep -eu test x=1 ${HOME} done echo | local
+		$(pwd) | echo --verbose "$@" done grep printf 2>/dev/null && echo
+		-eu --verbose $(pwd) "$1" && "$1" && grep --verbose awk x=1 local export grep
+| "$1" 2>/dev/null printf sed --verbose
+		| then | 2>/dev/null awk test grep printf "$@" | local
+		printf -eu ${HOME} "$1" then then grep sed -eu cd ${HOME} grep
+echo printf printf $(pwd) local printf
+		local x=1 export 2>/dev/null readonly && done
+		'quoted text' /usr/bin cd grep done cd "$@" "$1" then echo
+	-eu export ${HOME} awk export printf cd cd sed printf --verbose then local
+	${HOME} | cd "$@" test x=1 'quoted text' --verbose x=1 "$1" echo
+done 'quoted text' x=1 "$@" local -eu "$1" local then x=1 | "$@" "$1"
+	2>/dev/null x=1 readonly ${HOME} test echo export done cd grep then x=1 'quoted text'
+		$(pwd) readonly && export
+		test awk 2>/dev/null 2>/dev/null echo grep
+		/usr/bin 'quoted text' done test readonly x=1 readonly /usr/bin $(pwd)
+$(pwd) --verbose x=1 'quoted text' awk | &&
+	"$1" /usr/bin export grep
+	/usr/bin | sed /usr/bin export awk awk echo local readonly readonly
+	| --verbose /usr/bin &&
+		| -eu "$1" 2>/dev/null $(pwd)
+then readonly x=1 -eu readonly grep 2>/dev/null "$1" ${HOME} x=1
+		test printf $(pwd) ${HOME} -eu
+	x=1 "$1" "$1" export printf "$1" -eu
+		cd $(pwd) local "$1" then grep --verbose
+2>/dev/null --verbose "$@" cd grep export done export "$@" "$@" test echo ${HOME}
+	/usr/bin readonly "$1" $(pwd)
+| --verbose awk x=1 export $(pwd) $(pwd) cd readonly sed echo local export
+		"$@" local 2>/dev/null 2>/dev/null done awk grep -eu "$@" -eu awk && -eu "$@"
+--verbose grep --verbose export /usr/bin cd test ${HOME} 'quoted text' 2>/dev/null
+	-eu sed echo $(pwd) 'quoted text' awk | && export
+	done sed cd grep local sed
+		export /usr/bin then test ${HOME} readonly "$1" | readonly echo
+sed local /usr/bin "$1" cd sed done ${HOME} then sed &&
+		/usr/bin then export done /usr/bin export
+awk 2>/dev/null local grep /usr/bin test /usr/bin export --verbose --verbose
+--verbose done grep grep | done awk /usr/bin 2>/dev/null
+	then "$@" && && -eu "$1" export sed test local && --verbose sed "$1"
+	test test export "$@" local "$@" grep && then 'quoted text' awk
+test /usr/bin then ${HOME} printf awk | ${HOME} done done test
+	awk /usr/bin export $(pwd)
+$(pwd) test x=1 then done grep 2>/dev/null 'quoted text'
+"$1" ${HOME} ${HOME} ${HOME} sed printf
+	then then echo printf export && "$@" "$@" then export "$@"
+	--verbose /usr/bin --verbose $(pwd) 2>/dev/null done
+-eu 'quoted text' 2>/dev/null /usr/bin x=1
+		'quoted text' x=1 awk done export --verbose readonly /usr/bin
+	sed grep 2>/dev/null 'quoted text' "$1"
+cd $(pwd) $(pwd) test export /usr/bin
+		local awk export done /usr/bin awk /usr/bin
+		"$1" ${HOME} | cd sed
+	$(pwd) readonly $(pwd)
+export cd && done "$@" 2>/dev/null ${HOME} readonly ${HOME} echo readonly &&
+	local done x=1 ${HOME} /usr/bin $(pwd) "$@"
+	done cd test "$@" 'quoted text' local x=1 "$@"
+		readonly grep printf sed "$@" echo grep && --verbose awk -eu readonly ${HOME}
+	cd cd grep export awk printf echo cd
+	/usr/bin readonly printf 'quoted text'
+$(pwd) $(pwd) printf local local
+		${HOME} echo readonly echo "$1" local "$1"
+then && | local 'quoted text' | 2>/dev/null
+"$1" | readonly printf printf then $(pwd) cd 2>/dev/null "$@" then 2>/dev/null
+		sed "$1" 'quoted text' x=1 echo /usr/bin test ${HOME} sed
+'quoted text' cd x=1 cd export
+-eu 2>/dev/null export sed then cd && --verbose echo printf
+	-eu x=1 done awk done ${HOME} 'quoted text'
+	local -eu ${HOME} readonly readonly export echo | --verbose && readonly
+		"$@" sed readonly local 2>/dev/null -eu --verbose ${HOME} 2>/dev/null
+/usr/bin "$@" "$@" readonly local --verbose x=1 && cd cd cd done
+readonly x=1 | --verbose done cd cd | /usr/bin export printf | /usr/bin |
+2>/dev/null done && 'quoted text' "$1" awk ${HOME} echo grep -eu awk 2>/dev/null
+	'quoted text' ${HOME} done awk readonly x=1 cd echo done grep
+	awk cd x=1 'quoted text'
+		test printf cd $(pwd) echo "$@" sed readonly x=1 printf readonly /usr/bin ${HOME}
+		${HOME} export then /usr/bin x=1 done readonly local ${HOME} test --verbose
+	--verbose -eu $(pwd) --verbose export printf export sed ${HOME} local "$1"
+	sed readonly grep echo 'quoted text' readonly printf test 2>/dev/null x=1
+		"$@" /usr/bin cd cd awk then "$1" done
+-eu printf readonly x=1 "$1" 2>/dev/null ${HOME} --verbose ${HOME} $(pwd)
+		"$@" export "$1" -eu --verbose grep
+		--verbose 2>/dev/null local done awk -eu then printf "$@" "$1" "$1" test x=1 |
+| -eu done && readonly --verbose readonly $(pwd) $(pwd) /usr/bin
+		cd "$1" echo "$1" readonly printf readonly export -eu readonly local printf
+-eu cd -eu awk sed sed grep "$1" "$1" cd | cd
+	2>/dev/null "$1" printf sed test grep --verbose then awk 'quoted text' then
+"$@" sed export printf done awk printf $(pwd)
+	export echo echo printf done 2>/dev/null $(pwd) -eu done | --verbose echo sed
+		cd done /usr/bin test test x=1 'quoted text' test sed
+	local $(pwd) "$@" /usr/bin x=1 cd printf local "$@" local
+| -eu x=1 2>/dev/null test | $(pwd) 'quoted text' grep
+		local cd $(pwd) readonly sed cd awk "$@" awk
+	$(pwd) echo ${HOME} sed cd 2>/dev/null && test "$@"
+		then x=1 x=1 cd readonly
+	then | && grep 2>/dev/null 'quoted text' awk test ${HOME} x=1 cd x=1
+		${HOME} 'quoted text' readonly $(pwd) | -eu export -eu --verbose x=1 ${HOME}
+echo 'quoted text' test test echo | awk sed --verbose -eu
+	2>/dev/null 'quoted text' 'quoted text' sed done 'quoted text' echo
+grep x=1 cd then && done -eu export sed
+		awk --verbose export sed done export readonly cd awk echo done 2>/dev/null
+export 2>/dev/null $(pwd)
+		sed | sed $(pwd) awk sed "$1" "$1"
+		cd awk x=1 done $(pwd) printf x=1 echo sed "$1" awk then export ${HOME}
+test ${HOME} test "$@" $(pwd)
+		export && cd grep 2>/dev/null 2>/dev/null | awk export ${HOME} "$1"
+grep readonly "$1" cd cd test --verbose
+		readonly && && printf readonly sed export
+	/usr/bin test | then then sed export then sed $(pwd) ${HOME} 2>/dev/null /usr/bin
+	"$@" awk local -eu printf
+		"$1" "$1" awk echo 'quoted text' sed grep 2>/dev/null /usr/bin -eu 'quoted text'
+	awk "$1" | | awk && test readonly -eu
+${HOME} "$1" "$1" /usr/bin | test 'quoted text' awk done grep
+awk local awk | /usr/bin grep /usr/bin test 'quoted text'
+local 2>/dev/null export echo readonly $(pwd) ${HOME}
+printf "$@" done $(pwd) sed $(pwd) x=1 "$@" ${HOME} test x=1 done printf
+		local cd -eu "$1" done && "$@" ${HOME} grep done local 2>/dev/null ${HOME} grep
+	--verbose readonly 2>/dev/null printf ${HOME} -eu 'quoted text' ${HOME} | /usr/bin
+		sed export /usr/bin && && $(pwd)
+	echo export done printf |
+printf sed then readonly grep printf 2>/dev/null -eu sed printf
+	/usr/bin readonly local echo 2>/dev/null "$@" grep test --verbose x=1
+		"$@" "$@" sed | && 'quoted text'
+	x=1 "$1" -eu "$@" local -eu then --verbose "$@"
+		"$1" x=1 awk local readonly test awk local | export cd local grep ${HOME}
+cd && && /usr/bin -eu ${HOME} 'quoted text'
+&& test "$@" echo done "$1" readonly export
+	test --verbose ${HOME} done --verbose $(pwd) && cd /usr/bin | --verbose
+		--verbose echo ${HOME}
+		local readonly readonly $(pwd) | "$1" "$1"
+		test export | --verbose done echo 'quoted text' then && ${HOME} local awk
+	2>/dev/null /usr/bin printf x=1 readonly echo awk
+	awk 'quoted text' | && then readonly
+		export then local readonly 2>/dev/null /usr/bin
+	awk -eu $(pwd) printf echo ${HOME} sed "$@" echo --verbose && printf
+sed then 2>/dev/null "$@" printf "$1" 'quoted text'
+	local export ${HOME} sed export done && ${HOME}
+		&& cd x=1 awk readonly local grep readonly 'quoted text' echo
+		echo local sed awk readonly "$@"
+"$@" export export -eu grep $(pwd) 'quoted text' then printf
+${HOME} 2>/dev/null test grep sed && printf |
+	export cd 2>/dev/null x=1 echo
+	export cd echo $(pwd) export ${HOME} then grep && local readonly done -eu readonly
+	export sed sed $(pwd) awk printf export done $(pwd) x=1 echo
+test awk test 'quoted text' echo x=1 --verbose "$@" $(pwd) awk 2>/dev/null
+'quoted text' export
+		/usr/bin grep test echo 'quoted text' awk printf
+test 2>/dev/null test readonly x=1 readonly
+		2>/dev/null readonly echo awk x=1 local awk
+	export awk sed --verbose | /usr/bin cd local 2>/dev/null $(pwd) export
+then cd --verbose cd 'quoted text' local printf
+		printf test && 'quoted text'
+	then sed && sed /usr/bin
+	then export printf --verbose done sed 2>/dev/null echo echo ${HOME} done
+	cd x=1 ${HOME} grep echo export | echo --verbose && printf
+		2>/dev/null cd awk --verbose then cd export "$1" done printf 2>/dev/null
+		done cd cd done x=1 2>/dev/null echo done "$@" 2>/dev/null 2>/dev/null
+local 'quoted text' && /usr/bin "$1" -eu readonly "$@" export cd | local
+--verbose 'quoted text' /usr/bin 2>/dev/null echo export
+		"$1" $(pwd) done /usr/bin then done && test grep 2>/dev/null && done 'quoted text'
+	local local "$1" grep "$@" "$1" cd local 'quoted text' -eu /usr/bin
+		${HOME} done sed 'quoted text' echo "$1" 'quoted text' cd
+grep 'quoted text' printf && sed "$@" x=1 readonly x=1 echo export -eu
+		grep echo "$1" export grep
+		grep "$@" cd x=1 grep /usr/bin local 'quoted text' ${HOME}
+"$1" awk then --verbose ${HOME} --verbose awk export done
+		printf cd awk export | ${HOME} && sed local echo "$1" echo
+local --verbose then | local "$1" "$@" local -eu
+	'quoted text' x=1 /usr/bin cd --verbose
+		2>/dev/null $(pwd) cd --verbose export cd "$@" export test ${HOME}
+		-eu --verbose echo readonly 2>/dev/null
+		$(pwd) /usr/bin --verbose test then
+	echo grep $(pwd) -eu test /usr/bin cd | local
+export x=1 | local awk
+		-eu test | awk | -eu "$1" export awk local 'quoted text' export "$1" readonly
+		'quoted text' x=1 -eu x=1 -eu done cd then
+$(pwd) ${HOME} 2>/dev/null local /usr/bin
+	&& $(pwd) "$@" awk 2>/dev/null ${HOME} printf x=1 2>/dev/null /usr/bin "$1"
+		then /usr/bin done -eu grep $(pwd) grep | | awk readonly | --verbose
+	--verbose local /usr/bin x=1 -eu /usr/bin
+	'quoted text' test printf readonly 'quoted text' "$@" grep cd x=1
+		readonly export /usr/bin 2>/dev/null printf
+	sed readonly --verbose awk echo 'quoted text' "$1" then test x=1 printf
+readonly x=1 test /usr/bin "$@" local sed "$@" readonly local awk export &&
+x=1 2>/dev/null "$@" local $(pwd) "$@" sed grep $(pwd) sed
+&& cd cd export then && cd printf printf "$1" "$1" 2>/dev/null cd 2>/dev/null
+	done 'quoted text' $(pwd) sed printf "$1" --verbose sed 'quoted text'
+	--verbose local done then then then $(pwd) /usr/bin echo echo -eu x=1 "$@" sed
+$(pwd) "$1" done 2>/dev/null cd local sed sed done -eu export echo printf grep
+	"$@" --verbose then readonly /usr/bin /usr/bin printf
+	--verbose export cd "$1" cd export
+		then test "$@" 'quoted text' local /usr/bin ${HOME} grep sed 'quoted text'
+'quoted text' -eu 'quoted text' echo "$@" grep cd x=1 ${HOME} printf test test
+	/usr/bin then && done readonly readonly $(pwd) echo "$@"
+	done "$1" -eu export /usr/bin
+		x=1 grep test $(pwd) $(pwd) echo local echo --verbose printf $(pwd) --verbose printf
+		'quoted text' cd echo then "$1" && echo readonly sed 2>/dev/null
+"$@" -eu /usr/bin done ${HOME} /usr/bin /usr/bin printf cd sed -eu --verbose
+	then grep printf x=1 --verbose
+printf && test $(pwd) test printf then
+	"$1" printf grep ${HOME} "$@" "$@" sed grep --verbose sed
+then printf -eu /usr/bin
+${HOME} local grep 'quoted text'
+	$(pwd) --verbose && echo readonly /usr/bin "$1" test --verbose
+awk x=1 2>/dev/null readonly local 2>/dev/null local done | x=1 'quoted text'
+"$1" then 'quoted text' cd "$@" "$1" x=1 -eu -eu grep
+	cd then export awk x=1 "$1"
+--verbose | $(pwd) -eu 'quoted text' /usr/bin ${HOME} -eu | /usr/bin
+	'quoted text' awk --verbose export | 'quoted text' --verbose
+--verbose local awk printf
+then 2>/dev/null $(pwd) x=1 2>/dev/null
+	"$1" awk "$@" && printf test ${HOME}
+	--verbose export export echo && "$@" printf --verbose sed test grep done test
+	readonly && echo | grep done test awk x=1 echo
+	awk then test local export echo
+'quoted text' x=1 then ${HOME} 2>/dev/null
+	done then && sed local printf done cd x=1 2>/dev/null
+		&& printf $(pwd) grep -eu x=1 sed sed -eu --verbose printf /usr/bin echo "$@" sed
+then export "$1" printf "$@" && sed
+sed | printf --verbose cd && "$@"
+grep local cd -eu echo readonly -eu 'quoted text' "$1" awk "$1" local
+		&& 'quoted text' awk 'quoted text' readonly /usr/bin
+'quoted text' echo cd echo ${HOME} awk local && grep readonly cd 'quoted text'
+	"$@" "$1" 2>/dev/null test export awk "$@" awk readonly ${HOME} awk "$1"
+readonly then printf "$1" $(pwd)
+	export readonly /usr/bin && local test -eu then sed printf
+		cd sed "$1" test -eu "$1" -eu && && then x=1 &&
+	"$1" | /usr/bin readonly echo
+	2>/dev/null $(pwd) | echo /usr/bin "$@" sed done
+2>/dev/null $(pwd) done "$@" export
+	${HOME} ${HOME} test /usr/bin printf printf --verbose /usr/bin ${HOME} 'quoted text'
+-eu test x=1 2>/dev/null 'quoted text' readonly -eu echo -eu "$1" && ${HOME} ${HOME}
+	cd "$1" 2>/dev/null done --verbose --verbose export grep | test 2>/dev/null
+	done | cd done 'quoted text' cd local
+		then awk 'quoted text' grep done awk export && readonly cd /usr/bin
+echo ${HOME} export awk | && ${HOME} $(pwd) done grep
+		| sed awk --verbose --verbose
+	"$1" && "$@" $(pwd) sed export | --verbose
+'quoted text' 2>/dev/null | 'quoted text' /usr/bin "$@" local
+	'quoted text' grep 2>/dev/null test printf echo "$@" 'quoted text'
+-eu -eu -eu /usr/bin 2>/dev/null sed ${HOME} cd awk 'quoted text' awk test
+--verbose awk | -eu 'quoted text'
+		${HOME} then echo cd && awk printf test printf then -eu echo $(pwd) sed echo
+then | cd "$1" "$1" -eu $(pwd)
+		readonly done done ${HOME} grep | export $(pwd) --verbose
+		export "$1" /usr/bin $(pwd)
+		--verbose echo printf $(pwd) local /usr/bin x=1 x=1 readonly /usr/bin printf
+| 2>/dev/null "$1" then -eu then done export $(pwd) awk export
+	local "$@" --verbose | ${HOME} awk printf $(pwd) x=1
+	2>/dev/null x=1 grep && | "$@" --verbose test readonly
+		done echo done then readonly x=1 then
+	--verbose $(pwd) /usr/bin --verbose --verbose ${HOME}
+		| /usr/bin grep /usr/bin x=1 grep local "$1" local "$@" "$@" readonly
+sed "$@" cd export export
+		export 'quoted text' test $(pwd) export then
+	printf && export awk sed 2>/dev/null ${HOME} $(pwd) "$@" | x=1 "$1" 2>/dev/null
+	export && "$1" awk | done echo awk local "$1" $(pwd) test /usr/bin sed
+		printf test printf local readonly && echo
+then cd local echo then && awk | local test export -eu --verbose
+		$(pwd) grep echo 2>/dev/null readonly test /usr/bin $(pwd) --verbose
+$(pwd) x=1 echo ${HOME} $(pwd) "$@" awk ${HOME} cd test
+		| --verbose local readonly x=1 printf
+		sed 2>/dev/null local 'quoted text' "$@" grep cd x=1 grep cd | echo then grep sed
+		grep /usr/bin cd --verbose | then x=1 local
+		| | grep echo done then ${HOME} x=1 | sed /usr/bin --verbose
+awk x=1 echo && --verbose x=1 2>/dev/null 2>/dev/null -eu
+		| export then "$1" export cd "$@" $(pwd) cd echo 2>/dev/null | ${HOME}
+		echo -eu /usr/bin 'quoted text' local sed -eu
+	'quoted text' sed "$1" 'quoted text' $(pwd) test then echo
+local $(pwd) printf ${HOME} cd local export then echo $(pwd) -eu
+	cd export readonly "$@" -eu /usr/bin 'quoted text'
+	"$1" done cd grep awk printf --verbose echo && 2>/dev/null
+		local test 'quoted text' "$1"
+${HOME} printf -eu $(pwd) | --verbose echo $(pwd) readonly sed
+		x=1 then ${HOME} local "$@"
+	printf printf cd "$@" "$@" grep done /usr/bin
+	local export then 'quoted text' "$1" $(pwd)
+/usr/bin awk "$1" readonly 2>/dev/null -eu test $(pwd) 'quoted text' cd awk
+grep "$@" -eu | readonly export awk awk -eu sed "$1" -eu
+	test && then sed then 'quoted text' -eu $(pwd)
+		"$1" printf /usr/bin "$@" test | grep "$@" echo "$1" local
+		--verbose grep ${HOME} echo -eu /usr/bin export ${HOME}
+	then readonly grep && "$@" 'quoted text' awk
+readonly -eu cd test test
+	done x=1 "$@" | done -eu "$@" 'quoted text'
+grep && /usr/bin sed && export && | "$@"
+	grep ${HOME} grep "$1" && 2>/dev/null test ${HOME} /usr/bin grep local
+	-eu done echo sed && x=1 --verbose "$@" export readonly "$@" $(pwd)
+"$1" "$@" 2>/dev/null done x=1 export "$@" done done /usr/bin $(pwd)
+		&& | "$1" then /usr/bin | export /usr/bin $(pwd) awk export /usr/bin x=1 readonly
+		'quoted text' then cd --verbose then 'quoted text' export
+	"$@" "$@" 2>/dev/null awk cd "$1" "$@" done done echo export echo 'quoted text'
+		export done test printf /usr/bin local -eu local awk $(pwd) echo test "$@" ${HOME}
+		then && --verbose && --verbose x=1 echo $(pwd) done --verbose printf
+'quoted text' "$1" test 2>/dev/null test local 2>/dev/null
+		-eu /usr/bin "$@" "$@" then | sed awk
+	2>/dev/null $(pwd) cd cd | | 2>/dev/null 2>/dev/null -eu "$@" readonly
+		export ${HOME} $(pwd) local
+grep readonly | echo -eu readonly test printf 'quoted text' printf
+	readonly printf && then "$@" printf awk ${HOME}
+	local $(pwd) then ${HOME} echo export x=1 "$1" "$@" then | echo
+		test grep "$1" $(pwd) "$@" && -eu then
+	| "$@" $(pwd) local $(pwd) sed awk readonly x=1 cd test cd x=1 'quoted text'
+'quoted text' && /usr/bin 2>/dev/null
+grep printf awk ${HOME} grep readonly cd $(pwd) export export $(pwd) done
+| done | grep && test 'quoted text' ${HOME} "$1" $(pwd) done $(pwd)
+	'quoted text' awk && 2>/dev/null grep -eu then -eu then local test
+printf && ${HOME} test 'quoted text' cd sed x=1 grep "$@" awk 'quoted text'
+	echo /usr/bin 2>/dev/null "$@" && --verbose --verbose
+	cd test awk | -eu readonly test echo $(pwd) --verbose
+2>/dev/null readonly "$@" readonly export ${HOME} done then sed 2>/dev/null export
+		export /usr/bin readonly | --verbose cd 2>/dev/null then -eu grep "$@"
+test readonly $(pwd) readonly export echo awk ${HOME}
+	"$@" "$1" 2>/dev/null /usr/bin $(pwd) && "$@" 'quoted text'
+	/usr/bin | test | 2>/dev/null echo test -eu x=1 export
+		local x=1 readonly sed grep done
+		cd done sed /usr/bin local then
+		cd echo then readonly
+		printf "$@" | echo readonly done then | 'quoted text'
+		-eu ${HOME} && ${HOME}
+		"$1" --verbose readonly --verbose
+		done grep then x=1 x=1 "$@" sed "$@"
+2>/dev/null && /usr/bin export /usr/bin cd awk ${HOME} echo
+	-eu then && /usr/bin | $(pwd) $(pwd) readonly done
+cd 2>/dev/null 2>/dev/null ${HOME} sed 2>/dev/null
+		| export | "$@" --verbose done 'quoted text'
+		'quoted text' && test 'quoted text' awk sed x=1 "$@" printf
+done grep printf then 'quoted text' printf local then printf $(pwd)
+		"$1" cd x=1 ${HOME} cd "$1" "$@" echo 'quoted text'
+	export echo grep 2>/dev/null cd printf
+	readonly $(pwd) && awk "$1"
+	-eu cd awk grep test done echo printf sed done
+	sed local "$1" 2>/dev/null 2>/dev/null readonly echo awk --verbose $(pwd)
+	| && && | grep /usr/bin -eu x=1 grep | --verbose awk
+2>/dev/null printf $(pwd)
+	&& /usr/bin test && | x=1 done test printf "$@"
+		test export "$1" readonly 'quoted text' x=1 then $(pwd) printf | local 'quoted text'
+printf ${HOME} grep 2>/dev/null
+--verbose ${HOME} grep readonly $(pwd)
+export $(pwd) cd awk export 2>/dev/null
+readonly sed sed sed
+		readonly -eu x=1 then printf | $(pwd) ${HOME} /usr/bin
+		cd "$1" --verbose "$1"
+		2>/dev/null --verbose awk "$1" then grep local && local test
+cd | $(pwd) /usr/bin $(pwd) 'quoted text' cd -eu grep export sed cd export
+		sed export printf -eu readonly 'quoted text' 2>/dev/null
+		sed readonly export readonly then
+readonly x=1 done | echo grep && x=1 printf sed
+	readonly grep x=1 local test sed then x=1 ${HOME}
+	printf awk readonly 2>/dev/null printf $(pwd) -eu readonly -eu
+	cd local cd "$1" done "$@"
+		&& ${HOME} then local | --verbose test cd x=1 readonly cd x=1 grep x=1 | sed awk
+	readonly x=1 test export ${HOME} $(pwd) /usr/bin
+export $(pwd) "$1" echo done grep readonly then export
+	/usr/bin local 2>/dev/null 'quoted text' readonly "$1" ${HOME} then
+		cd "$@" --verbose sed |
+	awk printf readonly --verbose -eu x=1 test
+	sed grep ${HOME} 2>/dev/null test 'quoted text'
+x=1 'quoted text' awk /usr/bin
+	printf -eu test awk $(pwd) && awk 'quoted text' x=1 "$@" echo 2>/dev/null
+echo ${HOME} -eu echo "$1" --verbose test echo
+		| then test sed printf 'quoted text' /usr/bin cd printf done 2>/dev/null sed
+		x=1 x=1 -eu "$@" 2>/dev/null
+		2>/dev/null cd x=1 then x=1 -eu | 'quoted text' awk -eu awk cd $(pwd)
+		&& && ${HOME} printf done
+	/usr/bin test && 'quoted text' 'quoted text' x=1
+		grep printf grep printf export local local && echo
+--verbose "$1" local --verbose test | sed awk x=1 -eu
+		printf grep --verbose && $(pwd) cd export "$@" export done readonly test
+$(pwd) "$@" then local then $(pwd) test | && "$@"
+	grep then $(pwd) cd printf
+		export echo grep test 'quoted text'
+export done awk ${HOME}
+export printf | 'quoted text'
+		readonly echo readonly cd $(pwd) export --verbose echo "$@" ${HOME}
+	"$1" cd && echo ${HOME} local -eu && printf
+	local sed 'quoted text' awk echo cd && awk awk /usr/bin "$1" grep grep ${HOME}
+		-eu /usr/bin && test local -eu $(pwd) $(pwd) ${HOME} /usr/bin ${HOME} then
+	cd done test -eu && x=1 awk | x=1 awk "$@" 'quoted text' printf
+		x=1 local then printf sed done "$1" awk -eu --verbose test "$1" printf sed -eu
+printf 'quoted text' then grep /usr/bin sed test then
+done readonly "$@" done awk done
+local done then --verbose done printf
+		cd grep -eu /usr/bin --verbose echo && | -eu $(pwd) |
+		"$1" then grep -eu ${HOME} x=1 && && sed test grep grep "$1" local done $(pwd)
+cd readonly cd x=1 /usr/bin --verbose test -eu $(pwd) x=1
+	sed grep /usr/bin grep "$1" awk $(pwd) sed "$@" grep
+	echo awk $(pwd) /usr/bin readonly cd x=1 /usr/bin
+		"$@" | sed export && then "$1" /usr/bin done echo echo -eu 2>/dev/null
+	| echo then $(pwd) local
+		printf && "$1" echo export
+		$(pwd) echo export grep x=1 printf 'quoted text' "$1"
+printf "$@" awk test grep
+		readonly && cd test | | 2>/dev/null | awk "$1" -eu local grep grep grep then "$1"
+	-eu | awk awk awk echo echo done awk cd done test then "$@" /usr/bin x=1 export
+		--verbose /usr/bin $(pwd) test 'quoted text' /usr/bin
+		-eu echo -eu local sed readonly --verbose
+		-eu ${HOME} -eu readonly --verbose 'quoted text' readonly
+		--verbose export test "$1" 2>/dev/null test export 'quoted text' 2>/dev/null
+		readonly $(pwd) done echo x=1 sed printf awk ${HOME} --verbose | then cd 'quoted text'
+'quoted text' test $(pwd) readonly && sed "$@"
+		then local printf "$@" readonly && echo grep readonly then readonly 2>/dev/null
+	then -eu 2>/dev/null sed "$1" && test "$@" export printf x=1 sed sed
+		sed /usr/bin printf -eu 'quoted text' "$1" "$1" cd 2>/dev/null
+'quoted text' ${HOME} "$@" ${HOME} "$@" printf printf "$@" "$@"
+	x=1 /usr/bin ${HOME} | &&
+	cd -eu && && grep --verbose awk
+then then /usr/bin 'quoted text'
+		| printf "$@" cd echo export then echo readonly test
+		'quoted text' "$@" 'quoted text' grep | && x=1 then awk done printf 'quoted text'
+		$(pwd) x=1 ${HOME} 'quoted text' -eu --verbose 'quoted text'
+		/usr/bin readonly local sed "$@"
+	'quoted text' test printf && sed $(pwd)
+	${HOME} 2>/dev/null done
+'quoted text' 2>/dev/null $(pwd) 'quoted text' grep
+		x=1 | | "$@" $(pwd) | readonly 2>/dev/null --verbose then test | printf x=1 done
+	sed "$1" --verbose x=1 local echo then
+		'quoted text' grep x=1 -eu
+		cd test "$@" grep ${HOME} test $(pwd) ${HOME}
+		/usr/bin -eu && && export && --verbose | --verbose sed readonly | test sed
+	grep "$1" printf 2>/dev/null "$@" "$1" "$1" "$@"
+	'quoted text' export -eu ${HOME} &&
+grep 2>/dev/null 'quoted text'
+	x=1 "$@" awk echo 'quoted text' --verbose /usr/bin 'quoted text' printf | printf
+		local 'quoted text' "$@" 2>/dev/null echo echo 'quoted text' test "$1" $(pwd)
+	2>/dev/null 'quoted text' cd 'quoted text'
+		local 2>/dev/null then grep $(pwd) ${HOME}
+		cd $(pwd) ${HOME} | cd "$@" sed done 'quoted text' -eu sed then cd export echo
+"$1" readonly export readonly $(pwd) &&
+	export export 'quoted text' | cd sed printf
+	done test done cd && sed "$1"
+cd cd "$1" local printf echo x=1 awk 'quoted text' "$@" | $(pwd) "$@" done
+/usr/bin cd local --verbose ${HOME} "$@" done ${HOME} -eu /usr/bin
+'quoted text' printf 2>/dev/null echo --verbose && | && done cd | grep --verbose
+$(pwd) grep $(pwd) --verbose 'quoted text' $(pwd) grep $(pwd) printf -eu 2>/dev/null
+	/usr/bin ${HOME} 2>/dev/null /usr/bin then x=1 $(pwd)
+		then echo awk "$@" "$1" | cd printf awk readonly grep x=1 && $(pwd) cd
+		&& -eu /usr/bin export 'quoted text' "$1" 'quoted text' | 2>/dev/null
+	local done local sed awk readonly local /usr/bin readonly awk -eu awk awk
+grep printf cd "$@" sed --verbose "$@" export readonly
+&& awk $(pwd) printf | awk awk readonly test readonly
+		grep then "$@" 2>/dev/null
+		$(pwd) sed --verbose "$1" | then readonly 'quoted text' 'quoted text'
+		test | then $(pwd) readonly echo --verbose "$@" done awk -eu sed readonly
+x=1 printf printf "$@" -eu
+	-eu "$1" $(pwd) test && && readonly && /usr/bin sed "$1" "$1" awk &&
+	$(pwd) grep "$1" done readonly local test | && then then 2>/dev/null grep "$@" awk
+	echo then "$1" "$1" "$1" readonly -eu done && && "$@" printf 2>/dev/null
+&& x=1 && test --verbose ${HOME}
+x=1 sed then sed 2>/dev/null awk printf then cd local sed x=1
+	${HOME} 2>/dev/null 'quoted text' /usr/bin grep
+		echo echo "$1" "$1" done readonly done printf -eu "$1" printf $(pwd)
+readonly grep 2>/dev/null $(pwd) echo x=1 echo
+grep "$@" --verbose 2>/dev/null "$1"
+cd 'quoted text' 2>/dev/null test -eu 'quoted text'
+		| -eu printf printf cd "$1" -eu && -eu x=1
+		"$@" printf done printf sed done $(pwd) sed printf
+--verbose x=1 -eu | 'quoted text' "$@"
+		'quoted text' echo sed awk cd export echo x=1 'quoted text'
+cd awk echo /usr/bin readonly
+x=1 'quoted text' readonly x=1 cd | then grep local test && --verbose
+	sed awk test 'quoted text' awk
+		/usr/bin $(pwd) ${HOME} "$@" export sed | grep test local $(pwd)
+	"$1" done awk echo ${HOME} grep cd sed
+	"$@" then x=1 grep grep printf echo "$@" then printf echo ${HOME} sed export
+"$1" sed export local readonly | && $(pwd) | done 'quoted text' ${HOME}
+		awk sed "$@" ${HOME} echo "$1" 2>/dev/null cd ${HOME}
+then test echo echo && "$@" awk
+		printf awk | x=1 2>/dev/null /usr/bin local awk done local $(pwd) test 'quoted text'
+		'quoted text' awk test 2>/dev/null awk printf ${HOME} x=1 -eu
+		"$1" | test readonly test "$1" done done readonly sed ${HOME} grep "$1" ${HOME}
+"$@" cd --verbose -eu printf cd test 'quoted text'
+	&& awk --verbose printf
+		&& x=1 /usr/bin 2>/dev/null done local "$@"
+	readonly | awk x=1 /usr/bin
+		awk 'quoted text' sed -eu 2>/dev/null readonly grep export
+'quoted text' echo $(pwd) done printf readonly done export test then x=1
+printf done export ${HOME} | sed sed
+test awk readonly printf /usr/bin $(pwd) local ${HOME} printf
+	echo grep done test awk printf export 2>/dev/null x=1 then then echo
+printf "$1" "$1" $(pwd) grep
+	x=1 test printf --verbose printf awk echo
+		awk -eu x=1 'quoted text' export --verbose
+test x=1 awk --verbose local 2>/dev/null -eu "$1" --verbose
+	cd awk sed ${HOME} export -eu local then x=1
+		"$@" test local | && done then export
+		readonly echo ${HOME} 'quoted text' "$1" done printf "$1" then
+		sed awk -eu local then "$@" local
+	"$1" readonly printf -eu local
+		cd --verbose printf readonly export cd done 'quoted text'
+		&& -eu printf $(pwd) | local ${HOME} "$@" then export /usr/bin && 'quoted text'
+	&& && export readonly done
+	| /usr/bin && x=1 printf sed grep
+		'quoted text' "$@" grep printf $(pwd) && && && $(pwd) | test $(pwd) x=1
+	| "$1" 'quoted text' cd
+| awk 'quoted text' $(pwd) export
+echo printf done "$1" "$@" done x=1 test export then /usr/bin -eu 'quoted text'
+		cd readonly $(pwd) --verbose readonly ${HOME}
+test "$@" -eu "$1" readonly
+local test echo local grep | $(pwd) printf test then grep | "$@" "$@" -eu printf
+	"$@" grep printf readonly "$1" local test test
+local test done done x=1 x=1 test
+$(pwd) 2>/dev/null "$1" done 'quoted text' "$1" echo echo
+x=1 export 2>/dev/null --verbose
+	$(pwd) sed then -eu test /usr/bin 2>/dev/null /usr/bin
+	"$@" done 2>/dev/null "$@"
+		"$@" done 'quoted text' -eu done sed cd sed "$1" sed sed "$@" awk test 'quoted text'
+readonly printf ${HOME} $(pwd) awk export sed
+echo done awk --verbose /usr/bin x=1 printf done
+${HOME} then printf grep "$1" /usr/bin
+		'quoted text' | 'quoted text' done echo | printf ${HOME} "$1"
+"$@" -eu 2>/dev/null readonly | ${HOME} grep 2>/dev/null done readonly test x=1
+		--verbose printf $(pwd) /usr/bin -eu --verbose
+	grep x=1 cd cd readonly 2>/dev/null echo --verbose then && --verbose
+		grep --verbose /usr/bin printf | echo awk
+	/usr/bin | | export 2>/dev/null
+	done echo printf grep test printf
+		x=1 | done local local sed awk $(pwd) sed
+&& ${HOME} $(pwd) then local grep "$1" x=1 && | export echo --verbose done
+x=1 echo echo 2>/dev/null cd test ${HOME}
+cd 2>/dev/null | readonly x=1 x=1 readonly echo
+	"$1" -eu grep --verbose sed "$@" $(pwd) "$1" grep /usr/bin -eu -eu export
+		local done ${HOME} printf sed "$1" echo
+	awk sed test "$1" awk then export awk export 'quoted text' "$1" "$1" x=1
+		echo 2>/dev/null cd grep echo && readonly && readonly export test test done
+		| "$@" readonly --verbose export grep test cd | export 2>/dev/null "$@" echo
+	&& ${HOME} local grep awk awk printf
+		cd --verbose sed -eu printf
+		${HOME} then && then --verbose cd awk readonly export $(pwd) export sed test
+		local /usr/bin | done awk 'quoted text'
+		readonly 2>/dev/null sed echo readonly
+	local $(pwd) then echo | grep | printf
+"$@" $(pwd) export --verbose $(pwd) && 2>/dev/null
+		then $(pwd) printf cd 'quoted text' local x=1 | readonly
+${HOME} --verbose /usr/bin printf export then
+echo -eu && export awk /usr/bin echo then grep -eu then "$@"
+grep 'quoted text' -eu && cd x=1 local "$1" export printf local
+		awk sed --verbose 2>/dev/null
+		readonly "$@" && then $(pwd) then grep -eu sed export /usr/bin
+	printf printf && $(pwd) /usr/bin "$@" -eu x=1 -eu grep
+	local /usr/bin readonly
+	'quoted text' -eu | 2>/dev/null test sed x=1 $(pwd) test x=1 | cd &&
+		readonly awk | ${HOME} 'quoted text' "$1" && -eu "$@" --verbose && x=1 'quoted text'
+	--verbose /usr/bin && export 2>/dev/null sed
+done ${HOME} "$1" sed echo 2>/dev/null --verbose 'quoted text'
+readonly local test echo "$@" && 2>/dev/null readonly --verbose readonly
+		test cd 2>/dev/null "$1" 'quoted text' $(pwd) cd -eu local -eu printf
+		then echo --verbose ${HOME} x=1 readonly "$@" --verbose local printf done 'quoted text'
+		${HOME} /usr/bin --verbose
+	local --verbose then done && "$@" ${HOME} echo --verbose then 'quoted text'
+${HOME} "$1" printf test printf export
+export $(pwd) /usr/bin
+	echo cd | 'quoted text' "$1" cd "$1" test export x=1 | local 2>/dev/null 2>/dev/null
+	then /usr/bin --verbose readonly
+	printf printf awk cd then ${HOME}
+	export "$@" test then --verbose local sed local test grep
+	| x=1 "$1" export local test "$1"
+awk 2>/dev/null x=1 local sed $(pwd) echo local then "$@"
+		--verbose printf done "$@" x=1 readonly sed | then 'quoted text'
+x=1 && readonly && "$1" done grep "$@" $(pwd) sed "$1"
+local cd cd test "$@" test printf -eu --verbose echo export
+"$@" awk test readonly ${HOME}
+${HOME} 2>/dev/null | /usr/bin
+		printf done && && -eu done $(pwd) readonly readonly readonly "$1" "$@"
+$(pwd) echo | cd sed $(pwd)
+		local ${HOME} -eu readonly printf sed /usr/bin echo /usr/bin 2>/dev/null --verbose
+		/usr/bin done awk 2>/dev/null -eu done "$1" done x=1 "$1" local x=1 2>/dev/null
+	export export /usr/bin done "$1" $(pwd) cd cd awk ${HOME} -eu $(pwd) awk export
+		"$@" && then ${HOME} ${HOME} -eu -eu ${HOME} echo cd readonly x=1 /usr/bin
+x=1 awk "$1" x=1 printf printf then sed 'quoted text'
+export awk done local grep local grep ${HOME} test /usr/bin && "$1" local
+		cd grep "$1" local --verbose done readonly ${HOME} $(pwd) awk 2>/dev/null -eu
+	sed -eu ${HOME} -eu 2>/dev/null | done echo | done ${HOME} /usr/bin then readonly
+'quoted text' done --verbose $(pwd) 'quoted text' /usr/bin
+		--verbose readonly 2>/dev/null 'quoted text' then then
+	readonly 'quoted text' sed $(pwd) test done readonly $(pwd) grep cd /usr/bin
+echo "$@" local | grep 'quoted text'
+		$(pwd) readonly cd then x=1 then
+grep $(pwd) && local /usr/bin 'quoted text' cd "$@" sed readonly test
+2>/dev/null | -eu awk cd && readonly
+	--verbose test x=1 x=1 /usr/bin cd | printf echo x=1 test export ${HOME} then
+	test | sed sed echo | readonly printf readonly local
+		local | cd 2>/dev/null
+grep grep $(pwd) "$@" /usr/bin export /usr/bin then then
+printf 'quoted text' -eu then readonly
+	"$1" sed done readonly --verbose awk 'quoted text' readonly export $(pwd) /usr/bin
+	grep test export awk done echo ${HOME} export ${HOME}
+sed /usr/bin --verbose && $(pwd) cd --verbose grep
+echo cd done "$1" /usr/bin --verbose /usr/bin 'quoted text' cd
+		export local echo awk $(pwd) x=1 | /usr/bin
+	done "$@" test cd awk -eu echo "$@" 2>/dev/null && then -eu echo
+	&& awk grep | --verbose test grep
+	-eu test export /usr/bin export ${HOME} "$1" -eu --verbose grep cd
+awk printf awk --verbose ${HOME} done sed sed cd ${HOME}
+	${HOME} local done 2>/dev/null echo "$1" -eu echo printf -eu && /usr/bin
+-eu readonly --verbose -eu
+	-eu done | printf sed local sed 2>/dev/null
+	local printf && local | $(pwd) x=1 echo done test readonly x=1 --verbose --verbose
+--verbose 2>/dev/null "$1" x=1 readonly
+	readonly /usr/bin $(pwd) export local --verbose export
+		${HOME} local echo -eu cd printf sed echo readonly then awk echo
+	"$1" readonly 2>/dev/null /usr/bin
+local x=1 done | "$1"
+	&& $(pwd) | $(pwd) printf 'quoted text' x=1 grep x=1 /usr/bin /usr/bin export
+	done printf "$1" echo && $(pwd) echo -eu 2>/dev/null "$1"
+	"$1" then grep readonly printf --verbose done awk &&
+	readonly export 'quoted text' && test && then
+	grep printf echo --verbose awk "$1"
+| test "$1" then x=1 --verbose export 'quoted text' 'quoted text' test then
+		| 'quoted text' "$1" cd 2>/dev/null
+	cd cd awk /usr/bin test "$1" test --verbose
+&& x=1 --verbose 2>/dev/null local test export $(pwd) x=1 grep 2>/dev/null
+	&& awk local "$@" && 'quoted text'
+		x=1 /usr/bin then $(pwd) /usr/bin -eu x=1 sed cd grep readonly sed echo "$@"
+		then echo readonly echo done
+	--verbose test $(pwd) /usr/bin /usr/bin --verbose readonly
+sed echo /usr/bin sed sed readonly ${HOME} done "$@" then -eu printf ${HOME}
+	sed "$1" readonly echo -eu export then echo printf
+	--verbose then --verbose 'quoted text' 'quoted text' | ${HOME} 'quoted text'
+		"$@" export ${HOME} echo $(pwd) 'quoted text' local | && && awk
+	grep --verbose echo grep 'quoted text' export test echo $(pwd)
+		sed grep $(pwd) "$@" local | export readonly
+		$(pwd) 'quoted text' x=1 --verbose && "$@" readonly "$@" -eu $(pwd)
+	x=1 "$1" local local grep 2>/dev/null "$1" sed | "$1" sed
+&& awk $(pwd) grep --verbose
+	"$@" -eu --verbose ${HOME}
+printf printf awk then cd 2>/dev/null awk "$1" &&
+		&& cd /usr/bin printf x=1 2>/dev/null local /usr/bin
+	'quoted text' && grep test test sed "$1" 2>/dev/null printf printf && local
+		test | awk | export cd x=1 /usr/bin --verbose then
+		x=1 2>/dev/null 2>/dev/null
+	printf x=1 -eu echo export && x=1 done "$@"
+		&& done cd export $(pwd) "$@" /usr/bin
+		grep && done ${HOME} /usr/bin echo 'quoted text' sed 'quoted text'
+		grep "$@" local 'quoted text' test $(pwd) x=1 'quoted text' local printf
+test sed cd export sed grep $(pwd) export
+		"$1" "$1" /usr/bin ${HOME} local printf printf grep
+"$1" x=1 "$1" printf readonly
+	--verbose | grep export awk
+		awk && $(pwd) test --verbose --verbose --verbose test ${HOME} export echo x=1 printf
+then "$@" ${HOME} 'quoted text' "$@" x=1 "$@" echo -eu -eu 2>/dev/null --verbose
+/usr/bin then | sed printf local readonly 2>/dev/null sed readonly "$1" test
+		then 2>/dev/null test x=1 test awk readonly printf "$@" --verbose &&
+		&& local printf && local grep | then ${HOME} grep 'quoted text' printf $(pwd)
+		--verbose --verbose awk -eu 'quoted text'
+	printf printf $(pwd) cd "$@" && 2>/dev/null --verbose
+done grep && -eu 'quoted text' export && printf | echo
+		then local echo $(pwd) 'quoted text' sed "$1" sed $(pwd) awk
+		printf $(pwd) /usr/bin "$1"
+sed export $(pwd) awk printf /usr/bin x=1 ${HOME}
+		cd | test awk x=1 grep awk x=1 x=1 readonly test printf
+--verbose --verbose echo $(pwd) && /usr/bin x=1 'quoted text' then awk
+&& grep echo $(pwd) export "$@" test 2>/dev/null sed test && then
+	2>/dev/null /usr/bin ${HOME}
+	-eu -eu sed ${HOME} done "$@" -eu grep export x=1 export
+local x=1 done local awk ${HOME} --verbose /usr/bin grep export done -eu sed "$1"
+	then test && | printf
+		$(pwd) 2>/dev/null grep awk
+/usr/bin /usr/bin done then x=1 "$@" local local test then export 'quoted text'
+test printf /usr/bin /usr/bin printf
+	cd echo 2>/dev/null local then "$1" then done printf x=1 readonly echo
+$(pwd) local printf printf ${HOME} grep && $(pwd)
+export then "$@" then printf printf local ${HOME} 2>/dev/null readonly -eu 2>/dev/null
+		$(pwd) echo $(pwd) /usr/bin grep -eu -eu --verbose readonly
+		sed 'quoted text' | sed ${HOME} readonly
+2>/dev/null readonly export then export /usr/bin sed
+cd ${HOME} echo x=1 readonly $(pwd) done local awk 2>/dev/null | 2>/dev/null
+		"$@" && done grep sed grep ${HOME} then ${HOME} 2>/dev/null
+		&& done $(pwd) done "$@" /usr/bin local local "$@"
+readonly 2>/dev/null local readonly
+		2>/dev/null -eu done | && local sed "$1" cd
+		export && "$@" ${HOME} -eu done awk echo /usr/bin done then
+		'quoted text' $(pwd) $(pwd) done
+		-eu | "$@" ${HOME} "$1" grep sed
+		printf readonly then $(pwd) cd test 'quoted text'
+$(pwd) "$@" ${HOME} ${HOME} export -eu readonly grep "$@" export test ${HOME}
+cd export /usr/bin grep "$@" --verbose ${HOME} 'quoted text' | test ${HOME} /usr/bin
+&& local 'quoted text' -eu local
+		"$1" awk --verbose local readonly /usr/bin
+"$1" done sed && ${HOME} "$@" | then echo awk 'quoted text' "$@" done ${HOME}
+		"$@" 'quoted text' then -eu export printf 'quoted text'
+		/usr/bin awk --verbose export export
+	$(pwd) test "$@" then awk
+	"$1" done cd then "$1" x=1 done done local export --verbose readonly $(pwd)
+	x=1 echo && local local local cd printf "$1" "$1" x=1 awk
+grep local ${HOME} /usr/bin ${HOME} ${HOME} "$1" readonly
+		export -eu "$1" then echo then --verbose
+		awk /usr/bin printf 2>/dev/null cd -eu "$@" export
+	x=1 "$@" x=1 awk $(pwd) then
+sed echo "$1" awk grep | 2>/dev/null | echo test readonly --verbose
+&& sed echo && x=1 x=1 ${HOME} export 2>/dev/null
+	x=1 cd "$1" | sed /usr/bin ${HOME} && $(pwd) local then
+export ${HOME} ${HOME} 2>/dev/null then grep "$@" printf ${HOME} readonly
+		x=1 -eu test readonly printf test | export 2>/dev/null printf printf /usr/bin "$@"
+'quoted text' export printf
+	export "$1" grep $(pwd) "$1" "$@" 2>/dev/null grep $(pwd) awk grep --verbose
+		x=1 "$@" | grep $(pwd) /usr/bin echo ${HOME} then /usr/bin
+	"$@" awk 2>/dev/null printf
+/usr/bin -eu echo echo done sed test then -eu $(pwd) grep done
+		export printf --verbose 'quoted text' then
+	local sed "$@" ${HOME} awk test x=1 ${HOME} ${HOME} && done
+		readonly 2>/dev/null then awk &&
+		$(pwd) done then echo export $(pwd) --verbose
+"$1" $(pwd) then then readonly then ${HOME} readonly cd
+	| ${HOME} echo $(pwd) $(pwd) awk "$@" "$1" grep sed sed /usr/bin x=1 -eu export
+	done readonly sed export readonly local "$1" | x=1
+		grep /usr/bin cd echo x=1 'quoted text' $(pwd) done awk -eu readonly x=1 --verbose
+'quoted text' awk "$1" then x=1 grep "$@" ${HOME}
+		&& printf /usr/bin && cd done printf ${HOME} | 2>/dev/null | ${HOME}
+		grep --verbose /usr/bin printf
+grep printf local x=1 --verbose printf then cd awk test -eu echo "$@"
+		'quoted text' x=1 test awk printf /usr/bin
+	awk export "$1" printf test
+	| test "$@" cd export "$@" echo "$@"
+		&& export ${HOME} then cd awk local sed x=1 printf readonly /usr/bin printf
+cd test echo -eu readonly
+then x=1 /usr/bin $(pwd) echo | "$1" local "$@" awk /usr/bin test awk
+	export | --verbose grep ${HOME} readonly export "$1" readonly export grep
+grep readonly ${HOME} grep 2>/dev/null && | export echo sed "$@" --verbose "$@"
+"$1" ${HOME} local | /usr/bin done -eu $(pwd) ${HOME} -eu export cd
+		/usr/bin 2>/dev/null 2>/dev/null test
+		-eu -eu --verbose 'quoted text'
+/usr/bin sed /usr/bin printf printf "$@" local grep 2>/dev/null
+local readonly && sed 2>/dev/null echo ${HOME} grep local "$1" | sed && export
+		then && && echo 2>/dev/null
+	done -eu echo 2>/dev/null cd x=1 echo cd $(pwd)
+${HOME} "$@" "$@" export "$1"
+	${HOME} test grep cd export -eu | /usr/bin cd printf /usr/bin then --verbose --verbose
+2>/dev/null awk echo --verbose | 2>/dev/null echo awk awk ${HOME} && readonly
+		&& done "$@" "$1" | --verbose echo 2>/dev/null "$@" | grep
+		| | $(pwd) done -eu && then done then printf 2>/dev/null /usr/bin done
+	x=1 -eu cd echo $(pwd) test readonly 'quoted text' sed sed $(pwd)
+	/usr/bin ${HOME} then /usr/bin "$1" test ${HOME} $(pwd) local
+"$@" ${HOME} printf local cd
+echo echo "$1" grep done echo 2>/dev/null export 2>/dev/null
+	"$@" --verbose $(pwd) export
+	-eu /usr/bin 'quoted text' "$@" done /usr/bin
+	"$1" readonly 'quoted text'
+	local local "$@" awk | local
+	${HOME} x=1 done "$1" sed | $(pwd) grep x=1 --verbose grep 'quoted text'
+echo export && echo x=1 "$@" done 2>/dev/null ${HOME} done
+	sed readonly "$@" echo local 'quoted text' --verbose
+	$(pwd) 'quoted text' 2>/dev/null
+/usr/bin && "$@" 'quoted text' sed /usr/bin then then printf
+x=1 grep local && $(pwd) printf -eu "$1" readonly done
+	export local /usr/bin local
+2>/dev/null "$@" grep sed export 2>/dev/null
+	"$@" -eu 'quoted text' done test cd export
+	done done cd --verbose sed x=1
+${HOME} && /usr/bin local ${HOME} x=1 --verbose cd test --verbose
+	$(pwd) printf echo --verbose --verbose -eu grep done "$1" printf
+	--verbose && echo 'quoted text'
+		readonly "$1" cd awk -eu cd x=1 ${HOME} echo 'quoted text' -eu awk
+		awk awk "$1" then 2>/dev/null
+		'quoted text' export "$@" grep 2>/dev/null x=1 ${HOME} test 2>/dev/null
+/usr/bin ${HOME} ${HOME} echo sed done /usr/bin grep |
+		readonly ${HOME} && printf $(pwd) local 'quoted text'
+		"$@" 2>/dev/null printf $(pwd) readonly awk cd --verbose
+	"$1" grep $(pwd) then sed printf
+		$(pwd) awk 'quoted text' "$1" "$@" -eu done sed grep -eu 2>/dev/null ${HOME}
+done -eu readonly "$1" && then "$1" | /usr/bin sed readonly printf x=1 -eu /usr/bin
+		"$@" grep test then sed x=1 ${HOME}
+		"$@" "$@" grep then /usr/bin printf "$1" done 2>/dev/null -eu $(pwd) test local
+-eu test cd done local echo then "$@" | ${HOME} echo -eu awk /usr/bin
+cd x=1 local "$@" readonly 'quoted text' readonly
+echo done echo done echo -eu ${HOME} then "$1" then local
+		cd $(pwd) test export cd awk then /usr/bin | x=1 grep readonly done then
+		export -eu | /usr/bin then sed local && 2>/dev/null
+	test /usr/bin -eu "$1" -eu local cd readonly
+	&& echo ${HOME} x=1 printf awk grep $(pwd)
+/usr/bin then $(pwd) --verbose test ${HOME} local grep echo --verbose cd sed grep
+	grep awk done -eu export 'quoted text' && export grep && ${HOME} ${HOME} /usr/bin
+		$(pwd) test -eu test ${HOME}
+2>/dev/null /usr/bin && grep export sed echo export export
+	"$1" done then ${HOME} && 'quoted text' cd awk sed 'quoted text'
+	"$@" local | "$1" then /usr/bin
+export -eu x=1 "$@" readonly then $(pwd) echo readonly export
+	&& cd done printf -eu 2>/dev/null
+	-eu export awk $(pwd) test && echo | x=1 echo -eu "$1" ${HOME} 2>/dev/null
+		done cd $(pwd) readonly sed
+grep grep cd sed && 'quoted text' 2>/dev/null
+	grep $(pwd) test | && | local cd awk
+readonly echo --verbose local $(pwd) test -eu /usr/bin ${HOME} 2>/dev/null
+'quoted text' echo echo /usr/bin "$1" done local echo
+cd /usr/bin awk ${HOME} ${HOME}
+	readonly --verbose grep cd /usr/bin sed sed
+done grep test ${HOME} local
+	then export awk export done && "$@" --verbose 'quoted text' readonly
+--verbose cd 'quoted text' x=1 test 2>/dev/null sed grep -eu sed awk $(pwd)
+		${HOME} 2>/dev/null /usr/bin test "$1"
+	2>/dev/null $(pwd) 2>/dev/null test /usr/bin -eu x=1 local awk
+| done --verbose cd echo | $(pwd)
+	$(pwd) test export ${HOME} "$1" test x=1 2>/dev/null
+&& cd cd | 2>/dev/null && && export "$1" grep export test local
+		${HOME} --verbose awk && $(pwd)
+		echo "$1" "$1" ${HOME} sed echo ${HOME} && sed $(pwd) "$1" cd echo test echo
+	done "$@" x=1 readonly test echo grep && readonly grep echo
+		| local --verbose && $(pwd) local --verbose /usr/bin
+	&& grep "$1" $(pwd) $(pwd) awk grep ${HOME} cd && printf printf cd awk
+2>/dev/null local 'quoted text' -eu cd ${HOME} | 'quoted text'
+		$(pwd) $(pwd) "$1" done | --verbose
+		"$1" | then /usr/bin --verbose grep 2>/dev/null
+${HOME} x=1 "$1" done "$@" test then /usr/bin grep ${HOME} /usr/bin grep && /usr/bin
+		export awk ${HOME} 'quoted text' done done
+		cd export "$1" echo && --verbose && $(pwd) /usr/bin sed "$@" test /usr/bin
+	--verbose 2>/dev/null readonly local echo printf test sed "$@"
+	local ${HOME} export -eu awk then test $(pwd) done cd export --verbose done awk
+		x=1 readonly -eu -eu /usr/bin echo /usr/bin
+	then printf x=1 printf
+local "$@" "$@" "$@" /usr/bin test
+	awk && "$@" 2>/dev/null then echo
+'quoted text' export "$@" printf 2>/dev/null readonly test 'quoted text'
+${HOME} test done awk 'quoted text' awk printf done
+done 'quoted text' 'quoted text' readonly | /usr/bin awk /usr/bin $(pwd)
+$(pwd) done sed cd && --verbose test ${HOME}
+		&& "$1" cd export awk && x=1 && "$1" "$@"
+--verbose 'quoted text' "$@" ${HOME} "$1" --verbose --verbose
+		done export sed grep printf
+&& "$1" export 2>/dev/null readonly 2>/dev/null printf 2>/dev/null x=1 export
+| | --verbose ${HOME} then "$1" -eu sed "$@" grep echo 2>/dev/null
+		readonly && 2>/dev/null then local "$1" && sed local echo echo 2>/dev/null $(pwd)
+		done x=1 "$1" "$@" ${HOME} "$@" cd test awk test
+	local export ${HOME} printf -eu $(pwd) local && cd 'quoted text'
+		'quoted text' test readonly
+$(pwd) cd && echo x=1 ${HOME} then awk awk && "$1"
+"$1" echo "$1" sed $(pwd) echo done "$1" echo local
+	then readonly sed "$@" awk readonly readonly
+	then readonly $(pwd) ${HOME} awk "$@" done printf
+		-eu awk x=1 /usr/bin "$1" /usr/bin ${HOME} awk grep "$@" x=1 readonly
+	-eu cd local ${HOME} echo ${HOME} printf
+		then $(pwd) grep export ${HOME} export ${HOME}
+		--verbose echo "$1" printf
+/usr/bin done "$@" "$1" local echo "$@" grep "$@" readonly
+	&& -eu printf test export "$1"
+		sed sed && then then "$1" "$@" -eu sed sed --verbose printf "$1" 'quoted text'
+	2>/dev/null done /usr/bin grep $(pwd) printf | /usr/bin
+		export && readonly && export grep awk -eu test | local 'quoted text'
+		test export "$1" && "$@" "$1" 'quoted text' x=1 -eu -eu test printf
+		/usr/bin awk && printf then
+'quoted text' done sed then local test /usr/bin
+		-eu $(pwd) x=1 grep awk /usr/bin 'quoted text' ${HOME} printf local $(pwd)
+		readonly x=1 export --verbose "$@" grep echo | &&
+then echo awk printf -eu /usr/bin ${HOME} export ${HOME}
+		echo printf "$@" sed then $(pwd)
+readonly 'quoted text' printf readonly local readonly
+x=1 awk local $(pwd) "$@" ${HOME} /usr/bin && readonly -eu && "$@" local
+cd done && -eu printf export "$1" | readonly /usr/bin | done
+readonly "$@" export /usr/bin export
+cd readonly "$@" "$1" 'quoted text'
+		done "$1" test local grep | sed 'quoted text' x=1 "$1" grep ${HOME}
+		| --verbose echo "$@" local ${HOME} export -eu ${HOME} --verbose
+		${HOME} cd && grep test /usr/bin readonly sed printf -eu
+	${HOME} && -eu grep grep readonly 'quoted text' "$1" grep export
+	$(pwd) test && | local grep $(pwd) && $(pwd) $(pwd)
+	${HOME} then grep test awk cd "$1" | | readonly echo
+awk then local ${HOME}
+grep done grep cd | readonly grep && --verbose
+--verbose 'quoted text' && $(pwd) local local --verbose cd readonly done &&
+		done | "$1" "$@" printf | printf test
+'quoted text' x=1 "$@"
+	'quoted text' 'quoted text' done
+		--verbose export local awk "$@"
+	--verbose local -eu grep $(pwd) then $(pwd) $(pwd) -eu readonly
+x=1 x=1 'quoted text' cd
+&& "$@" $(pwd) awk echo readonly x=1 "$1"
+"$@" done x=1 export awk ${HOME} cd then 2>/dev/null sed done then | 2>/dev/null
+	x=1 grep | 'quoted text' 2>/dev/null $(pwd)
+test printf "$@" && awk cd "$@" 2>/dev/null export grep sed then x=1 /usr/bin
+awk readonly cd printf done local export 2>/dev/null | then "$@"
+	2>/dev/null "$1" export $(pwd) | --verbose
+	"$@" "$@" sed && readonly --verbose done grep | -eu "$1"
+cd && then readonly echo awk printf then done echo grep "$1"
+/usr/bin x=1 "$@" cd awk grep done then test test awk
+export 'quoted text' 2>/dev/null grep "$@" --verbose
+	${HOME} --verbose "$1" export test sed readonly && -eu "$@" local
+readonly test awk --verbose "$1" "$@" --verbose awk "$1" awk && 'quoted text'
+		printf && "$@" export cd then then /usr/bin sed sed grep
+$(pwd) printf x=1 local && -eu then "$1"
+	grep ${HOME} local --verbose 'quoted text' grep then
+	cd readonly --verbose "$@"
+echo 'quoted text' "$1" -eu
+--verbose x=1 | done /usr/bin && "$1" && then awk "$@" && readonly
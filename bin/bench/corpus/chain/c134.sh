@@ -0,0 +1,2001 @@
+readonly $(pwd) $(pwd)
+		grep printf echo local 2>/dev/null "$1" grep | -eu echo printf test
+${HOME} x=1 "$@" echo done "$@" done then grep --verbose grep grep
+		awk "$@" grep grep echo $(pwd) test ${HOME} awk /usr/bin "$@" -eu then && /usr/bin
+	awk local "$1" then /usr/bin --verbose --verbose /usr/bin --verbose
+	x=1 local "$@" readonly x=1 ${HOME} "$1" echo printf
+		-eu done $(pwd) readonly then
+&& then x=1 echo cd $(pwd) grep /usr/bin 'quoted text' 'quoted text'
+		printf 'quoted text' done $(pwd) printf printf cd
+local readonly && then cd "$1" printf then x=1 printf x=1 readonly
+local 2>/dev/null 'quoted text'
+	x=1 sed -eu | "$@" test --verbose grep "$@"
+	/usr/bin | printf local x=1 $(pwd) readonly
+		local "$1" local echo 2>/dev/null export 'quoted text'
+	test then "$1" "$1" && $(pwd) "$@" | 'quoted text' cd echo grep
+printf local "$@" local done /usr/bin
+x=1 readonly printf then && x=1 then
+		&& 'quoted text' "$1" "$@" "$@" echo readonly cd grep awk -eu awk
+		sed test /usr/bin then printf "$1" done done test /usr/bin $(pwd)
+	test readonly test echo
+sed cd local --verbose 'quoted text' | | && ${HOME} $(pwd) "$@"
+	2>/dev/null $(pwd) grep cd
+		cd --verbose -eu export $(pwd) then sed 'quoted text'
+-eu grep "$1" -eu && ${HOME} then awk export then readonly awk
+| 2>/dev/null x=1 | ${HOME}
+		x=1 -eu cd /usr/bin -eu then 'quoted text' readonly "$1"
+export --verbose 2>/dev/null cd local
+	awk readonly done echo grep local echo sed readonly
+	-eu | x=1 "$1" printf sed export 'quoted text'
+local | local export |
+		"$@" --verbose "$@" test readonly | cd then echo export
+		/usr/bin test echo export grep && $(pwd) $(pwd)
+done /usr/bin cd ${HOME} cd cd test $(pwd) ${HOME} echo readonly
+		local cd printf then grep "$1"
+test --verbose cd export -eu $(pwd) ${HOME} "$1" ${HOME} "$@"
+		awk readonly readonly then cd | x=1 2>/dev/null /usr/bin x=1 then x=1 /usr/bin "$@"
+	done export && local readonly ${HOME} export ${HOME}
+	$(pwd) done sed grep x=1 ${HOME} then then grep x=1 -eu --verbose readonly
+	printf x=1 'quoted text' then
+awk done --verbose --verbose local
+		'quoted text' export echo printf export done /usr/bin local 2>/dev/null
+		| test x=1 "$@" "$@" printf sed | --verbose x=1 'quoted text'
+		echo ${HOME} awk printf ${HOME} x=1 && printf $(pwd) echo &&
+		x=1 done 2>/dev/null
+echo done cd echo grep grep printf x=1 --verbose done --verbose x=1 awk
+		local then /usr/bin cd local export cd readonly test "$1" done x=1 && x=1 -eu then
+	$(pwd) done -eu echo $(pwd)
+x=1 && awk --verbose /usr/bin then && 'quoted text' printf
+"$1" -eu awk $(pwd) ${HOME}
+awk done 'quoted text' grep --verbose echo 2>/dev/null
+done /usr/bin cd "$@" "$1" ${HOME} && readonly sed
+		sed 2>/dev/null /usr/bin --verbose -eu grep local awk awk 'quoted text' readonly
+		x=1 && readonly printf | echo
+		${HOME} 2>/dev/null x=1
+	--verbose then test then done 'quoted text' test x=1
+		grep ${HOME} awk test | | local /usr/bin --verbose -eu done "$@"
+		&& awk 2>/dev/null && -eu $(pwd) -eu test "$@" ${HOME} printf
+		grep -eu x=1 awk done sed printf ${HOME} x=1 $(pwd) printf
+	--verbose export local awk
+${HOME} readonly --verbose 2>/dev/null awk export test | printf cd test x=1 printf
+		local x=1 && --verbose grep
+	local -eu printf "$@" done
+		echo readonly ${HOME} sed grep
+readonly ${HOME} 'quoted text' local -eu sed | -eu echo 2>/dev/null $(pwd)
+cd $(pwd) sed readonly "$1" export | x=1 2>/dev/null done x=1 awk echo $(pwd)
+x=1 local "$1" then && 2>/dev/null cd | "$1" $(pwd)
+	--verbose sed --verbose echo test ${HOME} 2>/dev/null
+grep test then | done cd export
+	2>/dev/null grep 'quoted text' echo --verbose then sed
+	| export test && export cd sed readonly sed then $(pwd) && 2>/dev/null
+		x=1 "$1" awk --verbose export echo $(pwd) "$@" then test test echo ${HOME}
+		test "$1" sed --verbose
+x=1 readonly && 2>/dev/null echo printf $(pwd)
+	export cd "$1" /usr/bin | sed cd | -eu | echo ${HOME} printf echo printf
+	"$1" "$1" ${HOME} "$1" printf x=1
+/usr/bin export grep /usr/bin x=1 echo -eu readonly
+		grep -eu 2>/dev/null test printf grep
+/usr/bin readonly $(pwd) echo "$1" "$@" x=1 && 2>/dev/null
+	export cd readonly printf | awk 2>/dev/null grep $(pwd) $(pwd) done done
+	| sed printf && grep && 2>/dev/null x=1
+2>/dev/null awk readonly sed awk "$@" ${HOME} && sed "$1" && awk test
+printf -eu 'quoted text' "$@" /usr/bin readonly
+	-eu "$1" $(pwd) cd ${HOME} --verbose echo
+		sed /usr/bin sed done readonly local awk /usr/bin | echo awk
+awk local 'quoted text' test 'quoted text' sed grep &&
+		done $(pwd) /usr/bin printf then echo export $(pwd) then /usr/bin 'quoted text'
+		'quoted text' awk grep export grep test -eu cd awk printf $(pwd)
+sed readonly local | "$1" local x=1 ${HOME} sed grep 'quoted text'
+x=1 grep && "$@" cd "$1" test -eu && ${HOME} "$@" 'quoted text'
+		--verbose "$@" $(pwd) done
+cd 'quoted text' && $(pwd) | /usr/bin
+		sed -eu "$@" printf "$1" echo && done echo readonly ${HOME} /usr/bin "$@" cd
+	-eu $(pwd) "$@" $(pwd) export -eu printf /usr/bin "$1" done
+--verbose printf printf local 'quoted text' --verbose
+	sed | ${HOME} grep "$@" export echo
+		$(pwd) | 'quoted text' then && awk x=1 | grep printf test "$1" | -eu -eu
+	export awk then test awk $(pwd)
+awk readonly export ${HOME} "$@" test "$@" echo --verbose echo
+		-eu test ${HOME} 'quoted text' cd echo readonly -eu /usr/bin then test | sed
+		cd ${HOME} echo && printf
+		local --verbose x=1 readonly ${HOME}
+2>/dev/null && export test awk cd cd 2>/dev/null then printf x=1 'quoted text'
+		local then -eu grep then sed cd ${HOME} test "$@" readonly --verbose readonly
+done 2>/dev/null printf
+	&& test sed 2>/dev/null then $(pwd) grep && x=1 printf /usr/bin
+	export $(pwd) sed -eu x=1 "$@" | done "$@" local cd x=1 local --verbose
+export export test | "$1" 2>/dev/null local --verbose /usr/bin && /usr/bin
+'quoted text' 2>/dev/null grep /usr/bin
+&& -eu x=1 export test grep "$1" export && readonly 2>/dev/null printf
+awk --verbose $(pwd) sed 'quoted text'
+printf cd cd export readonly test test && readonly local echo
+	then done x=1 sed printf sed grep "$@" 'quoted text'
+	/usr/bin --verbose x=1 && 2>/dev/null
+	export printf awk then 'quoted text' x=1 x=1 export export -eu "$@"
+		$(pwd) "$@" ${HOME} ${HOME} ${HOME} | && /usr/bin local |
+		cd && 'quoted text' export awk
+printf "$1" | sed --verbose done && sed done grep $(pwd) then done $(pwd) cd --verbose
+${HOME} "$@" && $(pwd) printf test && awk --verbose
+x=1 echo then readonly /usr/bin
+	2>/dev/null local -eu export x=1 printf "$@"
+		--verbose test /usr/bin local --verbose local
+--verbose | && --verbose export
+		--verbose test grep /usr/bin | printf --verbose readonly grep
+		test grep $(pwd) awk && && export test -eu $(pwd) printf
+		then 2>/dev/null test "$@" | 2>/dev/null sed "$1" awk && sed
+	export echo local /usr/bin && ${HOME} local
+		echo sed && done cd /usr/bin ${HOME} cd printf export grep "$@" 2>/dev/null
+${HOME} readonly 2>/dev/null -eu && readonly export ${HOME} 2>/dev/null
+"$@" ${HOME} cd printf printf grep x=1 done done "$@" awk then 2>/dev/null
+		then cd grep done export --verbose test "$1" 'quoted text' x=1
+--verbose /usr/bin 'quoted text'
+		sed x=1 $(pwd) "$@" echo -eu -eu 2>/dev/null echo "$1" -eu x=1 local /usr/bin
+x=1 --verbose --verbose printf 'quoted text' echo 'quoted text' local local echo
+done readonly 'quoted text' done then export
+2>/dev/null 'quoted text'
+printf | export readonly
+		--verbose && "$1" $(pwd) awk && $(pwd) && grep -eu -eu
+	-eu $(pwd) && echo readonly "$1" grep grep grep cd grep /usr/bin readonly
+	/usr/bin sed /usr/bin ${HOME} x=1 'quoted text' "$@"
+--verbose 2>/dev/null 'quoted text'
+/usr/bin then printf awk $(pwd) 2>/dev/null echo 2>/dev/null "$@" grep cd
+	local cd cd local awk grep grep /usr/bin /usr/bin "$1" x=1 echo |
+	${HOME} -eu --verbose "$@" "$@"
+	then "$@" test --verbose readonly 2>/dev/null export
+		echo cd ${HOME} local x=1 2>/dev/null
+test readonly done export "$1" $(pwd) done 'quoted text'
+x=1 --verbose local echo export -eu sed | 2>/dev/null test /usr/bin
+	'quoted text' then done --verbose ${HOME} "$1" /usr/bin "$1" echo ${HOME} x=1
+readonly "$1" grep x=1 done cd x=1 grep echo local -eu 'quoted text'
+		sed $(pwd) /usr/bin 'quoted text' "$1" -eu -eu readonly awk ${HOME}
+		test -eu readonly /usr/bin echo
+export cd | awk readonly -eu readonly && export $(pwd) local $(pwd)
+	"$@" && done cd --verbose printf then 'quoted text' sed && then 'quoted text'
+	"$1" -eu cd readonly local x=1
+	local ${HOME} cd 'quoted text' "$@" 2>/dev/null readonly
+	readonly /usr/bin echo ${HOME} readonly sed sed
+	sed | export sed then ${HOME} sed $(pwd) --verbose
+	done done readonly --verbose 'quoted text' sed "$@" 'quoted text'
+		/usr/bin 'quoted text' cd done && "$1" 2>/dev/null | test then then sed |
+	${HOME} /usr/bin $(pwd) local x=1 cd "$1" then 2>/dev/null
+		&& done 2>/dev/null test readonly && "$@" $(pwd) && -eu 2>/dev/null
+		awk grep --verbose local 2>/dev/null cd /usr/bin then echo -eu 2>/dev/null export
+	done "$1" readonly 2>/dev/null "$@" readonly /usr/bin grep /usr/bin
+export test x=1 grep "$1" 2>/dev/null echo
+	$(pwd) && test local x=1 ${HOME} "$@" echo "$1" export
+	"$@" printf then 2>/dev/null readonly && readonly x=1 printf
+	sed /usr/bin sed 2>/dev/null | test $(pwd) 'quoted text'
+	${HOME} then "$@" --verbose printf export
+		$(pwd) --verbose test awk test awk echo
+	2>/dev/null echo && local 'quoted text' sed 2>/dev/null done --verbose &&
+readonly x=1 test awk 2>/dev/null x=1 --verbose
+		printf $(pwd) then /usr/bin $(pwd) -eu done
+test sed "$1" export awk awk cd grep "$@" "$1" test /usr/bin
+--verbose 2>/dev/null cd /usr/bin echo done
+	then --verbose /usr/bin then readonly
+		x=1 cd export "$@" then -eu 2>/dev/null && 'quoted text'
+	echo test done then | /usr/bin "$@" /usr/bin echo done "$@"
+$(pwd) $(pwd) echo awk done 2>/dev/null printf awk done "$@" export
+		test /usr/bin then 2>/dev/null | then $(pwd)
+	cd cd "$1" $(pwd) done 'quoted text' 'quoted text' 'quoted text' 'quoted text'
+	x=1 awk x=1 && "$1" -eu "$1" grep | "$1" --verbose
+		echo && grep echo /usr/bin | then /usr/bin sed
+		cd grep test "$@" && | readonly
+	export sed "$@" grep awk /usr/bin
+	export then cd -eu 2>/dev/null x=1
+	x=1 sed 2>/dev/null test 2>/dev/null
+	--verbose done && test grep /usr/bin export local 'quoted text' -eu 2>/dev/null
+	printf && "$1" "$@" readonly --verbose -eu grep readonly
+--verbose done --verbose "$1" awk
+		sed cd sed && printf done echo
+		--verbose 2>/dev/null cd done readonly then echo
+	/usr/bin 2>/dev/null "$@" test $(pwd)
+		printf local export 2>/dev/null
+'quoted text' printf | 2>/dev/null && | ${HOME} sed echo sed local "$1" -eu then
+		echo local --verbose "$@" cd local && ${HOME} -eu
+		--verbose "$@" printf --verbose 2>/dev/null
+	awk /usr/bin "$1" --verbose
+		readonly && 2>/dev/null done cd test "$@" 2>/dev/null 2>/dev/null cd cd local --verbose
+	'quoted text' 2>/dev/null && "$@" && "$1" local sed | "$1" local echo 'quoted text'
+/usr/bin grep done x=1 | cd awk local
+	--verbose $(pwd) grep cd test
+	| x=1 grep local 2>/dev/null /usr/bin grep awk grep && | /usr/bin | 2>/dev/null
+	$(pwd) "$1" ${HOME} local -eu export then done
+		"$1" "$@" ${HOME} --verbose "$1" 2>/dev/null
+done echo awk ${HOME} && local export sed
+		done $(pwd) test "$1" cd /usr/bin then $(pwd) export
+x=1 readonly $(pwd) then x=1 "$1" test ${HOME} grep cd done export export export
+	--verbose -eu -eu done done sed test 2>/dev/null
+--verbose local "$1" echo awk 2>/dev/null "$1" "$@" done --verbose grep done $(pwd)
+"$@" && done /usr/bin ${HOME} done
+		--verbose /usr/bin $(pwd) cd x=1 printf "$1" --verbose 2>/dev/null
+	2>/dev/null sed --verbose export /usr/bin then cd x=1 test -eu 'quoted text' 2>/dev/null
+		-eu x=1 export 2>/dev/null /usr/bin "$@" && grep ${HOME} then "$@" export
+		awk 'quoted text' sed "$@" echo sed echo 'quoted text' ${HOME} sed
+	export readonly --verbose /usr/bin $(pwd) readonly done cd export
+		${HOME} 'quoted text' 'quoted text' | readonly done echo test 'quoted text' readonly
+"$@" readonly "$1" cd sed local sed export "$1" ${HOME} 2>/dev/null
+	| test export "$@" sed cd | cd "$@" ${HOME}
+		| x=1 "$@" 2>/dev/null cd done sed sed ${HOME} export && "$@" x=1 local ${HOME}
+	test 'quoted text' | ${HOME}
+		$(pwd) "$1" --verbose readonly x=1 $(pwd) | grep "$@"
+	local awk done cd sed 2>/dev/null local $(pwd) readonly grep 2>/dev/null done
+	done export cd "$@" | then local ${HOME} | --verbose /usr/bin
+-eu 'quoted text' done export 2>/dev/null grep ${HOME} export echo
+sed | then readonly done | sed printf "$1" $(pwd) "$1" then echo ${HOME}
+	cd $(pwd) "$@" | 2>/dev/null ${HOME} done 'quoted text'
+"$@" $(pwd) cd 'quoted text' && readonly then then 'quoted text'
+readonly sed 2>/dev/null $(pwd)
+local x=1 ${HOME} -eu printf test x=1 2>/dev/null
+	done 'quoted text' | | then readonly
+		"$1" 'quoted text' awk done -eu awk sed then grep done && sed printf export readonly
+then readonly done $(pwd) grep local then awk "$1" test readonly
+	x=1 local readonly $(pwd) done /usr/bin $(pwd)
+test && x=1 --verbose echo x=1 | grep
+&& then --verbose grep
+	export "$1" cd awk echo -eu ${HOME} && local && --verbose --verbose $(pwd) --verbose
+$(pwd) echo "$1" ${HOME} export 'quoted text' awk
+	readonly --verbose | readonly awk sed echo | x=1 --verbose echo done
+then awk -eu 'quoted text' sed && "$@" test then local $(pwd) echo done
+	$(pwd) grep export cd && "$@" -eu readonly export printf /usr/bin
+	sed readonly local 2>/dev/null grep printf done
+	grep done test $(pwd) printf test
+		"$1" cd "$@" --verbose readonly ${HOME} printf
+		-eu x=1 /usr/bin && --verbose ${HOME}
+	test test awk "$1" sed /usr/bin --verbose
+		$(pwd) echo 'quoted text' x=1 done grep awk done 2>/dev/null $(pwd) ${HOME} export
+test printf ${HOME} then ${HOME} local test ${HOME} && 2>/dev/null
+		sed "$1" cd x=1 -eu local done readonly && then local && 'quoted text'
+	&& printf 'quoted text' echo cd
+2>/dev/null && ${HOME} /usr/bin ${HOME} then test -eu "$1" 'quoted text' "$1" --verbose
+		2>/dev/null echo ${HOME} cd local x=1 grep | x=1 then then export
+	-eu done ${HOME} cd printf readonly done cd $(pwd) -eu done sed test &&
+"$1" "$@" local test printf "$1" echo "$1" grep test awk
+test "$1" 2>/dev/null "$@"
+	cd 'quoted text' -eu then 2>/dev/null --verbose then && -eu --verbose $(pwd)
+-eu --verbose 2>/dev/null awk -eu then printf printf
+		readonly ${HOME} /usr/bin ${HOME} done && && grep /usr/bin
+${HOME} cd export 2>/dev/null grep then cd $(pwd)
+cd grep x=1 echo awk --verbose
+		"$1" -eu echo --verbose | done awk /usr/bin
+readonly "$@" "$@" "$@" then /usr/bin
+	x=1 "$@" && awk | then | printf test --verbose
+	then ${HOME} $(pwd) "$1" | local $(pwd) "$1"
+		-eu "$@" echo local awk ${HOME} 2>/dev/null echo export /usr/bin && local
+		'quoted text' && /usr/bin readonly echo
+readonly ${HOME} done local $(pwd) "$@" 2>/dev/null printf
+2>/dev/null sed -eu local
+| test cd --verbose "$1" sed printf export && awk --verbose echo "$1"
+	cd done echo --verbose ${HOME} grep $(pwd) 'quoted text'
+		done test done $(pwd) grep printf then $(pwd) x=1
+		echo -eu readonly x=1 $(pwd) readonly export --verbose
+		awk echo local then readonly | x=1 $(pwd) /usr/bin done readonly echo -eu echo 2>/dev/null
+| cd && local cd done --verbose grep "$1" then && local ${HOME}
+"$@" -eu "$@" local $(pwd) then local 'quoted text' awk -eu then "$1" readonly
+	printf test sed 'quoted text' grep | --verbose
+$(pwd) $(pwd) 'quoted text' "$1" awk local && 2>/dev/null
+	local done sed 2>/dev/null "$@" grep awk ${HOME}
+	readonly x=1 x=1 done && && test then "$@"
+		then then $(pwd) ${HOME} 'quoted text' sed "$1" then x=1 done awk 'quoted text'
+		"$1" /usr/bin --verbose local then done $(pwd)
+		"$1" $(pwd) /usr/bin ${HOME} ${HOME} | readonly 'quoted text' test --verbose
+		2>/dev/null -eu 'quoted text' 2>/dev/null
+echo ${HOME} then readonly cd then awk && --verbose ${HOME} cd awk
+sed --verbose $(pwd) "$@" printf $(pwd) printf
+		-eu 'quoted text' local --verbose $(pwd) cd readonly $(pwd) x=1 ${HOME}
+		export /usr/bin readonly export printf readonly readonly readonly
+export printf local export -eu printf -eu x=1 echo 2>/dev/null readonly "$1"
+	x=1 "$1" readonly "$@" "$1" 'quoted text'
+"$@" x=1 'quoted text' echo echo $(pwd) /usr/bin 'quoted text' awk "$1"
+	printf printf sed echo awk 2>/dev/null && "$1" cd 'quoted text'
+readonly export /usr/bin "$1" 'quoted text' --verbose local grep
+	printf echo --verbose $(pwd) 'quoted text' ${HOME} readonly -eu ${HOME} cd $(pwd)
+	echo "$1" -eu ${HOME} ${HOME} test --verbose ${HOME}
+2>/dev/null printf /usr/bin "$@" $(pwd) echo local ${HOME}
+printf echo grep awk "$@" x=1 -eu awk done $(pwd) printf grep
+	sed x=1 x=1 -eu x=1 test $(pwd) sed done test ${HOME}
+"$1" readonly 'quoted text' local
+		"$1" grep && then done done && "$@" sed
+		-eu --verbose "$@" export $(pwd) x=1 ${HOME} "$@" done echo $(pwd) 'quoted text'
+		"$1" then x=1 ${HOME} ${HOME} printf
+	--verbose x=1 readonly -eu
+	awk $(pwd) -eu readonly local && local --verbose "$@" cd local done sed ${HOME}
+	readonly "$@" -eu grep --verbose
+printf 2>/dev/null x=1 "$1" grep --verbose "$1" export /usr/bin sed
+	"$@" "$@" && --verbose local sed /usr/bin $(pwd) && /usr/bin 'quoted text' then
+awk test done awk $(pwd) && 2>/dev/null
+	export test test then sed /usr/bin --verbose
+	local grep | then ${HOME} -eu sed "$1" export ${HOME} test
+x=1 "$1" test export -eu echo | ${HOME} && --verbose $(pwd) then 'quoted text'
+"$@" sed export sed done 'quoted text' ${HOME} sed
+	echo sed /usr/bin then ${HOME} "$@" cd
+x=1 sed ${HOME} export "$1" readonly -eu ${HOME} export -eu cd local
+/usr/bin local echo "$1" done grep printf
+	$(pwd) && | sed 'quoted text' done "$1" $(pwd) echo -eu "$1" awk "$1" $(pwd)
+		$(pwd) -eu x=1 readonly /usr/bin ${HOME} x=1 $(pwd) readonly && x=1 $(pwd) 'quoted text'
+		grep echo 'quoted text' $(pwd) test $(pwd) 'quoted text' export
+	'quoted text' "$1" printf
+	x=1 sed ${HOME} --verbose $(pwd) done awk export
+	--verbose cd x=1 then | /usr/bin | $(pwd)
+		sed grep x=1 grep printf test $(pwd) done "$@"
+	| sed export test 'quoted text' $(pwd) local
+		-eu $(pwd) | export x=1 readonly x=1 printf | "$1"
+$(pwd) /usr/bin sed --verbose
+		$(pwd) readonly echo "$@" sed -eu export "$1" sed echo sed grep readonly
+	then --verbose $(pwd) x=1 then 2>/dev/null export 'quoted text'
+		x=1 "$1" done echo done awk done
+	test export echo done && 2>/dev/null -eu
+	cd "$1" local local && 2>/dev/null cd echo x=1 cd -eu $(pwd) 2>/dev/null
+readonly $(pwd) --verbose done "$1" echo cd "$@" then echo awk
+done ${HOME} 'quoted text' "$@" $(pwd) grep
+	export | ${HOME} sed -eu $(pwd)
+-eu done -eu then 2>/dev/null awk "$@" then 2>/dev/null
+	then "$@" echo --verbose 'quoted text' 2>/dev/null
+	printf /usr/bin printf x=1 && done local
+	awk sed grep export "$1" $(pwd) grep
+		"$@" grep -eu /usr/bin $(pwd) | local ${HOME} "$@" awk awk echo
+"$@" ${HOME} grep /usr/bin x=1 local awk cd awk
+	${HOME} -eu printf then /usr/bin echo awk x=1 cd test readonly done /usr/bin printf
+		cd x=1 ${HOME} /usr/bin x=1 export x=1 done echo "$@" 'quoted text'
+	&& readonly -eu 'quoted text' --verbose /usr/bin 'quoted text'
+	done ${HOME} printf cd 'quoted text' printf ${HOME}
+	"$1" -eu then 2>/dev/null | --verbose 2>/dev/null "$1"
+		| x=1 "$@" "$@" test && cd x=1 -eu -eu sed x=1 ${HOME} 2>/dev/null
+		printf local awk --verbose -eu awk 2>/dev/null test printf ${HOME}
+	"$@" -eu 2>/dev/null then "$@" grep printf x=1 2>/dev/null
+		${HOME} awk && grep sed local local /usr/bin 2>/dev/null
+awk export $(pwd) /usr/bin 'quoted text' "$1" $(pwd) ${HOME}
+		"$@" grep printf sed $(pwd) $(pwd) 'quoted text' then local sed readonly sed
+		then sed export ${HOME} local cd test cd done test grep done
+| printf -eu -eu | readonly local grep
+	--verbose test then -eu test "$1" then grep cd then 'quoted text'
+		cd "$@" ${HOME} local -eu test test then -eu readonly grep then echo readonly
+		-eu readonly /usr/bin done
+x=1 $(pwd) printf cd $(pwd) readonly 2>/dev/null x=1 2>/dev/null --verbose
+		"$@" echo readonly echo x=1 readonly
+/usr/bin && cd sed "$1" export echo
+echo grep then awk printf printf echo -eu awk grep x=1 $(pwd)
+readonly "$1" sed awk x=1 test $(pwd)
+	'quoted text' /usr/bin printf
+	"$1" $(pwd) done -eu sed ${HOME} cd sed awk "$1" test cd | "$@" ${HOME}
+printf readonly cd 2>/dev/null cd export
+		echo 2>/dev/null 'quoted text' sed | /usr/bin && 2>/dev/null && export
+then printf $(pwd) grep sed
+		$(pwd) then cd 2>/dev/null echo cd 2>/dev/null sed
+-eu x=1 readonly done x=1 --verbose --verbose 'quoted text' export grep
+'quoted text' grep done "$1" grep /usr/bin
+cd local then 2>/dev/null echo done x=1 test echo ${HOME} test printf
+	${HOME} printf "$1" | /usr/bin --verbose echo /usr/bin x=1 awk sed grep /usr/bin
+		local printf 2>/dev/null x=1 sed readonly readonly
+$(pwd) sed awk --verbose ${HOME}
+2>/dev/null test test echo done ${HOME} readonly sed export --verbose grep then
+	printf 2>/dev/null | && /usr/bin echo && 2>/dev/null cd "$@"
+		2>/dev/null local | cd /usr/bin -eu awk local 'quoted text' ${HOME}
+	local --verbose -eu /usr/bin ${HOME} echo && "$@" -eu
+grep /usr/bin | local | grep 'quoted text' grep 2>/dev/null
+	x=1 done test sed ${HOME} local sed export 'quoted text' awk grep
+--verbose -eu && cd | "$1" echo local "$@" && readonly readonly x=1 /usr/bin
+	/usr/bin 2>/dev/null done
+		readonly | readonly 2>/dev/null cd && | test test 'quoted text' printf
+printf x=1 ${HOME} grep cd --verbose | 2>/dev/null "$1" | local printf
+	echo "$1" 'quoted text' 'quoted text' then awk && cd printf -eu ${HOME}
+${HOME} test cd grep grep -eu "$1" then -eu readonly done -eu test "$@"
+		&& && readonly --verbose ${HOME} test test test awk && /usr/bin then awk x=1
+	$(pwd) /usr/bin 'quoted text' -eu --verbose -eu ${HOME}
+		-eu /usr/bin cd $(pwd) echo
+	printf $(pwd) | grep local sed sed ${HOME} | echo readonly
+		2>/dev/null /usr/bin readonly | | ${HOME}
+$(pwd) | cd cd echo awk readonly then printf local echo
+		grep ${HOME} 'quoted text' 'quoted text' -eu 2>/dev/null readonly &&
+	x=1 2>/dev/null grep export
+		printf cd 2>/dev/null 'quoted text'
+		echo sed export local sed grep echo ${HOME} | $(pwd) -eu export ${HOME} ${HOME}
+		$(pwd) 2>/dev/null 2>/dev/null $(pwd) -eu "$1" printf
+		grep ${HOME} && local x=1
+cd echo grep 2>/dev/null done --verbose grep then sed "$1" readonly done
+--verbose sed grep ${HOME} awk cd test echo 2>/dev/null awk -eu -eu "$@"
+		printf 2>/dev/null 2>/dev/null 'quoted text' grep $(pwd) grep awk 2>/dev/null
+	'quoted text' /usr/bin | test cd test 2>/dev/null
+export 2>/dev/null cd local 'quoted text'
+	done awk --verbose && cd 2>/dev/null awk export x=1 /usr/bin
+		echo 'quoted text' && cd
+		"$@" $(pwd) "$@" && $(pwd) ${HOME} --verbose x=1 cd
+	x=1 done "$@" cd ${HOME} then test local awk
+		-eu 2>/dev/null | test grep
+	--verbose /usr/bin export done | /usr/bin echo echo export "$1" test x=1 'quoted text'
+	grep sed grep awk echo 'quoted text' "$@" cd -eu x=1 test
+x=1 then 2>/dev/null done awk local /usr/bin /usr/bin "$1" sed
+	'quoted text' then export printf x=1 'quoted text' ${HOME} && | printf
+| test printf awk $(pwd) x=1 'quoted text'
+&& awk ${HOME} grep awk done echo 2>/dev/null readonly
+	&& cd printf then "$1" printf done sed /usr/bin
+	local $(pwd) printf then awk ${HOME} && grep
+	done /usr/bin /usr/bin grep test awk "$@" then 2>/dev/null 2>/dev/null test
+	grep "$@" local test 'quoted text'
+		echo -eu local readonly --verbose x=1 export $(pwd) "$1" "$1" sed sed sed sed "$1"
+	x=1 sed grep "$1" $(pwd) export awk $(pwd) | 2>/dev/null
+export readonly "$@" x=1 done 2>/dev/null then printf && sed cd -eu ${HOME} export
+	| awk --verbose "$@" printf test awk x=1 -eu "$@"
+	"$1" done ${HOME} /usr/bin readonly
+		'quoted text' && "$1" export
+"$1" "$1" 'quoted text' cd test test then 'quoted text' 2>/dev/null
+		local $(pwd) echo printf $(pwd) sed test test ${HOME} x=1 |
+'quoted text' then cd && echo test then | done "$@"
+| readonly test && printf local --verbose
+-eu 'quoted text' | grep
+		'quoted text' done "$1" export echo readonly /usr/bin local ${HOME}
+		-eu ${HOME} 'quoted text' x=1 && cd "$@" cd 2>/dev/null -eu 'quoted text' "$@"
+	"$@" x=1 /usr/bin test "$1" x=1 "$@" then x=1 2>/dev/null 2>/dev/null
+awk then --verbose echo -eu sed | &&
+		$(pwd) done test /usr/bin done "$@" echo
+cd -eu then ${HOME} 'quoted text' done
+	then "$1" awk 2>/dev/null test grep echo local sed ${HOME} "$1"
+	cd awk test done -eu readonly awk
+	x=1 done readonly -eu x=1 /usr/bin printf -eu
+	echo ${HOME} export awk sed local 2>/dev/null ${HOME}
+		x=1 "$@" /usr/bin cd export printf | awk done cd awk "$1"
+awk cd 'quoted text' awk $(pwd) x=1 grep --verbose sed
+		/usr/bin cd && 'quoted text' --verbose /usr/bin
+test "$1" | /usr/bin then awk export 'quoted text' then done done 'quoted text'
+	x=1 'quoted text' local sed x=1
+${HOME} ${HOME} cd ${HOME} -eu | local sed
+	x=1 test ${HOME} x=1 && $(pwd) -eu readonly readonly
+${HOME} printf x=1 "$@" done
+grep ${HOME} 2>/dev/null x=1 done /usr/bin --verbose cd ${HOME}
+	sed ${HOME} test test grep grep done echo done /usr/bin 2>/dev/null -eu printf
+readonly awk test "$1" "$@" && cd 'quoted text'
+		then /usr/bin awk sed awk /usr/bin sed "$1" /usr/bin grep export x=1 echo readonly
+		awk "$1" export grep /usr/bin
+	${HOME} 'quoted text' --verbose x=1 && x=1 /usr/bin /usr/bin done "$1" readonly
+		cd 'quoted text' "$@" echo
+		-eu ${HOME} ${HOME} export /usr/bin
+	test echo then 'quoted text' readonly
+echo done "$@" awk $(pwd) x=1
+	readonly grep $(pwd) /usr/bin grep /usr/bin "$1" grep && 'quoted text' && /usr/bin
+	"$@" sed 2>/dev/null echo readonly done export x=1 local -eu "$1" done ${HOME}
+		"$@" done test /usr/bin echo printf printf
+/usr/bin printf | ${HOME} | ${HOME} ${HOME} --verbose x=1 export local local
+/usr/bin printf sed "$@" -eu | "$1" ${HOME} test local local 'quoted text'
+	then done readonly printf awk done done /usr/bin
+	grep "$@" sed printf sed 2>/dev/null --verbose $(pwd) "$1" readonly then
+${HOME} export "$@" $(pwd) "$@" 2>/dev/null -eu echo
+echo awk "$1" readonly
+		awk then | test readonly 2>/dev/null "$1" awk |
+	"$@" "$1" then export grep
+	grep cd "$@" /usr/bin local "$@" then --verbose "$1" printf "$@" sed && 2>/dev/null
+-eu local local 'quoted text' then $(pwd)
+		sed "$1" echo $(pwd) "$1" sed printf "$1" "$@" echo cd 2>/dev/null grep awk
+		$(pwd) awk export printf sed "$1" grep | | x=1 then grep local --verbose
+	grep grep awk "$1" | cd local done echo ${HOME}
+x=1 x=1 cd "$@" x=1 "$1" 'quoted text' cd echo --verbose sed 'quoted text'
+	-eu /usr/bin grep "$1" "$1" export /usr/bin 'quoted text' | --verbose
+grep done grep cd /usr/bin "$@" sed export 'quoted text' | done "$1" echo sed
+		"$@" ${HOME} x=1 awk local readonly
+| awk /usr/bin && --verbose 2>/dev/null
+sed x=1 export readonly local echo /usr/bin
+	printf readonly local readonly grep 'quoted text' sed test done awk $(pwd) "$1"
+	echo 2>/dev/null sed local awk echo
+${HOME} --verbose sed --verbose awk done
+	then | awk 'quoted text' -eu grep | sed
+		'quoted text' 'quoted text' && -eu local --verbose sed | 'quoted text'
+echo x=1 && --verbose grep | printf "$@" grep local done "$1" echo ${HOME}
+		-eu "$@" /usr/bin -eu echo --verbose /usr/bin done export sed
+	grep done $(pwd) sed x=1 "$@" ${HOME} export grep
+		cd readonly --verbose "$@" echo echo "$1"
+	cd grep && printf x=1 'quoted text' ${HOME}
+	2>/dev/null && done test /usr/bin -eu | | | ${HOME} 2>/dev/null
+| test local readonly 2>/dev/null
+	${HOME} ${HOME} printf export grep -eu 'quoted text' $(pwd) local "$@" export
+x=1 done readonly $(pwd) awk echo ${HOME}
+		cd $(pwd) "$1" -eu export 'quoted text' then $(pwd) ${HOME} "$@" awk grep
+		${HOME} x=1 echo /usr/bin
+	echo x=1 awk test local "$1" cd 2>/dev/null echo printf | printf
+	export "$@" ${HOME} ${HOME} "$1"
+done readonly -eu export grep cd $(pwd) local cd /usr/bin test sed cd "$@" $(pwd)
+-eu sed 2>/dev/null local -eu 'quoted text' grep x=1 "$1" printf 2>/dev/null
+"$@" echo --verbose readonly 2>/dev/null sed
+export test awk 'quoted text' "$1" "$@" "$1" then sed
+| local cd done ${HOME} /usr/bin --verbose awk /usr/bin sed | test awk echo
+export grep 2>/dev/null awk done --verbose "$1" printf cd local sed then "$1"
+readonly "$@" x=1 'quoted text' "$@" then grep sed ${HOME} grep
+| "$@" grep awk readonly then awk printf export /usr/bin echo "$@" readonly ${HOME}
+	test /usr/bin 'quoted text' printf
+		--verbose && export ${HOME} grep awk
+		"$1" && $(pwd) sed ${HOME} done readonly | grep "$1"
+	&& export local cd awk ${HOME} /usr/bin "$@" | "$1" && awk ${HOME} | echo
+	$(pwd) grep -eu "$1" local sed
+	readonly cd readonly --verbose x=1
+		sed then printf && && "$1" x=1 grep awk ${HOME} "$1" sed echo awk grep 2>/dev/null
+--verbose export awk awk $(pwd) export /usr/bin 2>/dev/null x=1 then awk test
+	"$1" 'quoted text' awk /usr/bin done "$@" done sed "$@" readonly
+		sed ${HOME} cd ${HOME}
+	-eu local ${HOME} 2>/dev/null done done -eu readonly printf 'quoted text' --verbose
+--verbose grep export 2>/dev/null x=1 echo cd 'quoted text'
+		export "$@" echo -eu local --verbose
+		-eu test "$@" 2>/dev/null sed $(pwd) "$1" /usr/bin local sed sed sed 'quoted text'
+done -eu /usr/bin ${HOME} x=1 awk "$@" "$@" test readonly "$@" sed
+${HOME} echo x=1 grep test && printf && --verbose ${HOME}
+	"$1" grep readonly /usr/bin grep -eu readonly
+	${HOME} x=1 local done test ${HOME} local "$1"
+		printf 'quoted text' export x=1 grep -eu printf printf --verbose export readonly
+	$(pwd) echo echo done /usr/bin
+	--verbose 'quoted text' readonly awk local 2>/dev/null printf then done -eu --verbose
+		test -eu local /usr/bin cd printf export readonly && then export
+	printf ${HOME} x=1 readonly cd 2>/dev/null $(pwd)
+	$(pwd) ${HOME} "$1" "$@" test cd 2>/dev/null && grep grep
+	-eu printf 2>/dev/null --verbose
+printf test 'quoted text' && 2>/dev/null
+--verbose | local /usr/bin grep -eu -eu /usr/bin --verbose | test awk 2>/dev/null
+-eu "$@" awk && cd then cd x=1 | x=1 $(pwd)
+"$1" done local /usr/bin grep | $(pwd) /usr/bin 'quoted text'
+		$(pwd) done && export --verbose done --verbose ${HOME} printf $(pwd) "$@" 2>/dev/null
+local /usr/bin sed test ${HOME}
+	awk 'quoted text' sed --verbose
+	grep ${HOME} $(pwd) ${HOME} cd export
+		done echo local awk 'quoted text' grep x=1 local sed export done
+--verbose then && x=1 /usr/bin && readonly -eu | local test readonly
+		--verbose --verbose echo "$@" && 2>/dev/null echo
+| cd local export "$@" awk --verbose
+		cd then test && | 2>/dev/null /usr/bin ${HOME}
+"$1" x=1 ${HOME} cd awk && --verbose "$@" "$1" done
+		cd export --verbose $(pwd) awk echo sed
+	--verbose awk --verbose "$1" | -eu x=1 cd x=1 grep then
+	${HOME} then x=1 printf -eu
+$(pwd) printf /usr/bin --verbose echo awk | printf
+	printf grep | -eu /usr/bin -eu readonly 2>/dev/null awk -eu 'quoted text' then
+'quoted text' 2>/dev/null awk grep /usr/bin grep sed && readonly
+		x=1 2>/dev/null export
+local then | $(pwd) printf "$1" sed -eu awk grep cd ${HOME} "$1" "$1" done
+	'quoted text' test 2>/dev/null --verbose
+	then "$1" local | cd "$@" export ${HOME} then 2>/dev/null 2>/dev/null
+| grep printf 2>/dev/null
+		x=1 x=1 'quoted text' awk /usr/bin printf $(pwd) 2>/dev/null
+"$@" /usr/bin ${HOME} -eu done
+	readonly export | then sed "$@" ${HOME} then x=1 'quoted text' local ${HOME} $(pwd)
+	2>/dev/null "$@" "$@" | -eu sed export
+		/usr/bin then then -eu readonly 'quoted text' |
+	grep "$@" -eu echo sed echo -eu &&
+		cd /usr/bin "$@" /usr/bin -eu grep -eu grep $(pwd)
+'quoted text' cd echo ${HOME} "$@" readonly | grep export "$1" && /usr/bin awk
+awk export ${HOME} echo 2>/dev/null
+		test "$@" | sed --verbose ${HOME} awk $(pwd) --verbose local sed /usr/bin
+2>/dev/null "$@" then $(pwd) x=1 grep | ${HOME} -eu -eu -eu
+		'quoted text' done test export
+		cd then sed export printf export 'quoted text' grep done local
+cd printf /usr/bin local $(pwd)
+test $(pwd) awk local done then echo 'quoted text'
+grep cd "$1" ${HOME} grep echo
+| sed x=1 | export awk "$@" test
+	grep 'quoted text' then done && 2>/dev/null 2>/dev/null export
+cd readonly x=1 2>/dev/null readonly | -eu 2>/dev/null export cd
+		| cd echo ${HOME} grep test ${HOME} 'quoted text' test test
+		done export printf 'quoted text' printf && printf | echo 2>/dev/null
+	${HOME} test $(pwd) awk echo && ${HOME}
+'quoted text' readonly printf "$1" done -eu "$1" 'quoted text' echo cd awk then
+		/usr/bin readonly 2>/dev/null 2>/dev/null export -eu $(pwd) then awk | awk
+	"$@" done cd sed test && "$@" grep
+		| echo cd sed "$1" x=1 readonly 2>/dev/null
+	-eu --verbose awk grep
+	then && "$1" 2>/dev/null "$@" 2>/dev/null test cd "$1" grep echo test -eu && test
+		sed local test grep then 'quoted text'
+	| readonly /usr/bin $(pwd) export grep
+		"$1" cd done grep "$@"
+		grep readonly && export 2>/dev/null
+		x=1 test sed 'quoted text' echo
+		awk sed x=1 printf --verbose | x=1 2>/dev/null export printf ${HOME} -eu 2>/dev/null
+	sed x=1 grep readonly local &&
+	export echo then "$@" printf x=1 cd export readonly sed x=1 2>/dev/null printf
+then then x=1 x=1 test cd sed export
+${HOME} readonly x=1 test grep
+	| 2>/dev/null "$1" "$@" local /usr/bin grep --verbose grep awk test && export /usr/bin
+		grep done sed 'quoted text' sed | local
+	done "$1" ${HOME} && -eu export grep && done local test export grep test sed
+	echo "$1" awk -eu x=1 export sed done done --verbose $(pwd) cd readonly x=1
+echo printf -eu "$1" x=1
+cd readonly printf x=1 ${HOME} "$@" test
+cd | readonly /usr/bin local readonly export sed grep ${HOME} test /usr/bin
+sed 'quoted text' && --verbose test 'quoted text' /usr/bin
+		${HOME} --verbose sed export readonly x=1 $(pwd)
+	$(pwd) | printf "$@" sed readonly && printf local "$1" && grep "$@" "$1"
+		then cd grep test local $(pwd) local echo then readonly
+	"$1" $(pwd) -eu ${HOME} /usr/bin readonly "$1" test grep local
+	&& awk test sed sed cd
+awk && 'quoted text' awk done x=1 test $(pwd) then local awk ${HOME} ${HOME}
+		test ${HOME} $(pwd) sed then printf
+	${HOME} --verbose "$1" done "$1" x=1 local
+		printf then export readonly local printf --verbose -eu sed -eu printf awk
+	--verbose then readonly done test "$1" echo test grep "$@"
+export && 2>/dev/null readonly "$@" --verbose x=1 cd awk sed cd readonly
+--verbose done 'quoted text'
+		test && ${HOME} /usr/bin "$1" awk sed "$1" readonly then ${HOME} -eu then
+		'quoted text' test then printf | --verbose -eu $(pwd) readonly | printf --verbose
+x=1 ${HOME} readonly | readonly 'quoted text' grep echo /usr/bin
+	"$1" readonly | "$@" 2>/dev/null "$1"
+	export x=1 "$1" test --verbose | awk 'quoted text' && -eu | | echo export --verbose
+$(pwd) readonly "$@" sed -eu printf readonly 'quoted text'
+		/usr/bin readonly 2>/dev/null /usr/bin
+'quoted text' then test -eu
+		awk test export $(pwd) && --verbose cd readonly
+		cd "$1" done grep echo grep echo done grep | /usr/bin export "$@" done |
+echo awk | readonly grep | "$@" "$1" 'quoted text'
+${HOME} x=1 local $(pwd) local printf -eu 2>/dev/null done awk ${HOME} -eu
+		export grep awk | readonly cd cd export ${HOME} -eu
+awk grep local --verbose --verbose 2>/dev/null cd cd
+/usr/bin then awk | done "$@" readonly export local x=1 readonly "$@"
+	'quoted text' 'quoted text' awk done local x=1 printf grep
+		readonly 2>/dev/null grep grep 2>/dev/null test && sed $(pwd) test
+		/usr/bin $(pwd) done 'quoted text' $(pwd) test $(pwd) "$1" cd -eu cd readonly ${HOME}
+	/usr/bin export ${HOME} /usr/bin printf x=1 ${HOME} -eu 'quoted text'
+cd done 2>/dev/null "$@" done && awk -eu test
+	local /usr/bin awk $(pwd)
+	"$@" echo awk printf then then -eu "$1"
+		"$@" export readonly 'quoted text'
+then test "$@" export /usr/bin
+done 'quoted text' then /usr/bin done export "$@" 'quoted text' echo
+readonly && cd sed x=1 "$1" grep
+	"$1" readonly readonly "$@" -eu
+		test printf | -eu ${HOME} grep --verbose test then grep "$@" --verbose ${HOME}
+	then --verbose local ${HOME} cd -eu x=1
+	then cd readonly grep echo ${HOME}
+		| then ${HOME} ${HOME} --verbose local
+	-eu test done && x=1 ${HOME} --verbose awk test $(pwd) done then -eu ${HOME} "$1"
+	local awk 2>/dev/null readonly "$1" 'quoted text'
+	"$@" 'quoted text' 'quoted text'
+		test $(pwd) && then ${HOME} echo echo $(pwd) cd readonly /usr/bin grep then
+		printf export test then
+x=1 echo "$@" printf local export echo then && | | x=1 readonly local
+	then $(pwd) sed then $(pwd) done
+	| ${HOME} --verbose echo | readonly ${HOME} "$1" echo awk echo echo
+		done test sed "$@" export --verbose 2>/dev/null /usr/bin
+2>/dev/null "$1" awk 'quoted text'
+		grep ${HOME} local sed -eu "$1"
+	export grep echo | sed then ${HOME} done --verbose local
+	sed test $(pwd) && 2>/dev/null printf /usr/bin
+| "$1" export printf done local export printf done grep "$@" /usr/bin $(pwd)
+	cd "$1" ${HOME} /usr/bin && "$1" 'quoted text'
+echo echo grep $(pwd) readonly "$@" local awk readonly grep --verbose
+sed readonly local local -eu then cd test done then done local awk -eu
+	then --verbose cd && export /usr/bin then "$@" $(pwd) x=1 local | $(pwd) 2>/dev/null
+	x=1 'quoted text' $(pwd) |
+		--verbose local then | $(pwd) && export cd x=1 then 'quoted text' done done printf
+readonly then grep "$1" cd 2>/dev/null readonly
+		readonly export | then ${HOME} "$@" export printf x=1 'quoted text' awk /usr/bin
+		then --verbose local then grep 2>/dev/null printf ${HOME} && x=1 --verbose x=1
+	'quoted text' "$@" printf | echo /usr/bin && cd /usr/bin -eu awk
+		printf local test awk 'quoted text'
+x=1 done test "$@" echo grep "$1" $(pwd) $(pwd) cd 'quoted text'
+	"$@" 2>/dev/null done -eu sed done "$1"
+$(pwd) 'quoted text' && /usr/bin | awk done $(pwd) grep printf 'quoted text'
+	done --verbose awk grep echo printf sed
+--verbose printf export cd | 'quoted text' awk test sed
+	${HOME} printf printf -eu printf "$@" --verbose -eu 'quoted text' /usr/bin printf
+	x=1 "$@" grep grep x=1 export done /usr/bin $(pwd) 2>/dev/null "$1"
+		"$@" sed readonly $(pwd) printf
+		/usr/bin sed 'quoted text' 2>/dev/null
+echo sed local 2>/dev/null
+		then local export -eu "$1" "$1" done 2>/dev/null printf --verbose $(pwd)
+	readonly 2>/dev/null | /usr/bin -eu then echo awk readonly grep --verbose
+x=1 "$@" $(pwd) ${HOME} echo ${HOME}
+printf export test -eu export 'quoted text' "$@" x=1 printf export local
+	cd awk readonly awk readonly -eu done x=1 && test /usr/bin awk && readonly
+'quoted text' printf -eu readonly $(pwd) -eu "$1" sed sed readonly
+printf test readonly done -eu sed cd
+		sed -eu export test -eu && ${HOME} -eu test printf echo export readonly 2>/dev/null
+		'quoted text' export printf "$1" 2>/dev/null local printf -eu awk test grep
+	--verbose grep | 'quoted text'
+	grep readonly --verbose printf 'quoted text' -eu test awk sed sed --verbose
+'quoted text' done "$1" ${HOME} echo
+		2>/dev/null test awk /usr/bin
+	$(pwd) local "$@" readonly
+sed "$1" test export 2>/dev/null
+$(pwd) ${HOME} 2>/dev/null then && export 2>/dev/null
+		| done awk local awk "$@" readonly
+	"$@" -eu printf 2>/dev/null -eu ${HOME} /usr/bin && echo "$@" cd local test
+		awk ${HOME} echo "$@"
+		-eu export --verbose echo echo x=1
+		"$@" export local $(pwd) /usr/bin grep readonly sed readonly test
+	2>/dev/null 'quoted text'
+	local done 2>/dev/null grep local
+		cd /usr/bin && "$1" 'quoted text' test
+		sed readonly ${HOME} 'quoted text'
+	test export "$1" grep "$@" printf -eu cd cd cd then test readonly sed 'quoted text'
+	then grep /usr/bin readonly
+	done | sed cd local | /usr/bin x=1 2>/dev/null | 'quoted text' grep cd
+	"$1" readonly cd then grep grep readonly echo && done
+2>/dev/null test then 'quoted text' 2>/dev/null
+		echo -eu printf 2>/dev/null | /usr/bin done export readonly
+	-eu --verbose -eu export "$1" x=1 /usr/bin $(pwd) x=1
+	"$@" && sed --verbose local && sed local then 2>/dev/null printf sed /usr/bin
+		&& ${HOME} "$@" "$1" /usr/bin readonly test
+"$1" echo --verbose cd "$@" 2>/dev/null 2>/dev/null ${HOME} -eu
+"$@" "$1" readonly --verbose && 2>/dev/null "$@" printf
+x=1 local -eu --verbose /usr/bin readonly 2>/dev/null done 2>/dev/null
+test grep 'quoted text' grep ${HOME} "$@" cd /usr/bin
+		local test local -eu done readonly && done "$1" done ${HOME} "$1" | -eu
+--verbose sed local "$1" printf x=1 "$1" 'quoted text' ${HOME}
+		--verbose --verbose done ${HOME} export
+		cd --verbose 2>/dev/null -eu sed -eu echo awk -eu "$@" done awk
+		export grep awk x=1 -eu awk cd /usr/bin grep done
+"$1" | awk --verbose test grep grep
+		$(pwd) local /usr/bin grep local x=1 /usr/bin then -eu grep cd --verbose $(pwd)
+'quoted text' $(pwd) local /usr/bin
+2>/dev/null ${HOME} local then 'quoted text' grep
+	"$@" readonly && cd grep && grep echo --verbose awk done $(pwd) "$@" sed /usr/bin
+		/usr/bin readonly /usr/bin x=1 "$1" x=1 done && "$1" sed cd done
+	--verbose done then -eu ${HOME} --verbose readonly
+done done "$1" done readonly done local 2>/dev/null
+	$(pwd) done /usr/bin /usr/bin | && cd sed echo 2>/dev/null awk sed export export
+	then then 'quoted text'
+cd printf cd /usr/bin local grep then ${HOME} /usr/bin
+		done awk local readonly --verbose done 'quoted text'
+&& $(pwd) && && done x=1 2>/dev/null done 2>/dev/null printf
+		/usr/bin "$@" 'quoted text' done grep cd export /usr/bin -eu "$1" "$@"
+echo ${HOME} cd "$@" echo && | echo export && "$@" &&
+		"$1" cd grep "$@" 'quoted text' sed ${HOME}
+awk grep then test readonly 'quoted text' awk test test "$@" export -eu 2>/dev/null
+		&& && then readonly && grep sed
+${HOME} 2>/dev/null "$1" test local awk ${HOME} $(pwd) /usr/bin cd
+		sed cd readonly awk --verbose --verbose /usr/bin "$@" done
+		printf then printf readonly grep /usr/bin
+'quoted text' printf /usr/bin grep --verbose then done grep 2>/dev/null "$1"
+	/usr/bin grep export --verbose export echo 2>/dev/null test "$@"
+		"$@" "$1" 'quoted text' awk cd printf 'quoted text' grep
+		grep 2>/dev/null --verbose 2>/dev/null $(pwd)
+"$1" && awk "$@" done && grep then printf readonly then $(pwd) ${HOME}
+	${HOME} --verbose /usr/bin echo "$@" "$@" 'quoted text' "$@"
+readonly test && done $(pwd) -eu | 2>/dev/null echo 2>/dev/null then grep --verbose
+		$(pwd) sed local /usr/bin 'quoted text' -eu cd /usr/bin
+	sed readonly && ${HOME} "$@" -eu local x=1 | $(pwd) test x=1 sed 'quoted text'
+	awk readonly done --verbose cd export -eu sed export
+	&& ${HOME} /usr/bin awk
+${HOME} test sed x=1 readonly && grep echo "$@"
+	--verbose readonly test 2>/dev/null
+	then $(pwd) printf export /usr/bin readonly then
+	&& /usr/bin local export
+"$1" && 2>/dev/null --verbose cd done readonly 'quoted text'
+		/usr/bin cd && done 'quoted text' test printf ${HOME} echo 'quoted text'
+| 2>/dev/null ${HOME} "$1" cd done echo printf | | export cd x=1
+	cd ${HOME} | grep | then && echo grep test
+awk x=1 grep /usr/bin "$1" 'quoted text' test 2>/dev/null
+		readonly done --verbose 2>/dev/null "$1" "$@" && readonly done cd printf /usr/bin
+	awk echo then awk grep test 2>/dev/null printf
+		test printf --verbose export /usr/bin local "$@" cd -eu printf awk then sed
+	local ${HOME} --verbose sed && | x=1 $(pwd) done cd echo
+x=1 2>/dev/null cd test readonly
+cd readonly ${HOME} awk x=1 x=1 done -eu test --verbose
+	local sed --verbose readonly cd && awk local then /usr/bin awk sed
+		done $(pwd) grep && $(pwd) sed
+	test "$@" then awk $(pwd) $(pwd)
+	done cd grep cd test local
+	-eu local echo then test readonly readonly test awk /usr/bin x=1 local then export
+	grep -eu "$@" $(pwd) "$1" export awk local "$1" ${HOME} 2>/dev/null /usr/bin
+	-eu echo test --verbose readonly x=1 "$@" echo 2>/dev/null "$@" ${HOME} readonly
+	&& 'quoted text' /usr/bin /usr/bin export local
+	sed --verbose cd "$@" --verbose $(pwd) ${HOME} /usr/bin /usr/bin -eu export readonly
+		"$@" ${HOME} local "$@" && ${HOME} | local --verbose readonly /usr/bin 'quoted text'
+${HOME} 2>/dev/null test echo ${HOME} cd -eu -eu readonly local echo awk /usr/bin
+--verbose && local cd | 'quoted text' "$1" 'quoted text' readonly printf -eu
+	readonly local then -eu "$1" && done grep test
+		sed 'quoted text' --verbose grep ${HOME} readonly cd
+		cd awk -eu | sed export sed echo done x=1 $(pwd) 'quoted text'
+		/usr/bin then export --verbose ${HOME} | done test x=1
+		"$@" ${HOME} echo sed awk sed grep awk done export 2>/dev/null export 2>/dev/null
+done local local grep local echo -eu printf cd done grep done &&
+		done -eu sed echo echo && local "$@" awk -eu | 2>/dev/null echo echo
+	"$@" cd test awk "$1" readonly printf /usr/bin echo echo echo done
+/usr/bin sed done grep export awk | $(pwd) awk "$1"
+then | printf printf readonly 'quoted text' sed
+	--verbose export $(pwd) cd readonly 'quoted text' $(pwd) 2>/dev/null -eu export
+| then --verbose --verbose
+		$(pwd) cd then "$@" export 'quoted text' readonly "$1" "$1" --verbose test
+	/usr/bin | x=1 $(pwd) "$@" $(pwd) 'quoted text'
+		readonly "$1" printf local export -eu /usr/bin ${HOME} &&
+		2>/dev/null 2>/dev/null export printf echo 'quoted text' grep echo /usr/bin
+grep readonly done -eu x=1 readonly "$@" grep sed && cd
+		awk cd done then /usr/bin printf test printf 2>/dev/null
+	test sed done awk awk local x=1 /usr/bin
+/usr/bin echo /usr/bin cd export printf /usr/bin awk "$@"
+printf /usr/bin export sed sed ${HOME} "$@" x=1 local readonly
+test x=1 $(pwd) /usr/bin then readonly ${HOME} x=1 export printf test -eu echo "$1"
+		awk then cd "$1" readonly awk ${HOME}
+	cd ${HOME} echo local then /usr/bin -eu echo && &&
+		$(pwd) -eu awk "$@" --verbose /usr/bin cd
+	readonly then export $(pwd) /usr/bin 2>/dev/null
+	"$@" 'quoted text' $(pwd) sed printf $(pwd) grep sed export echo
+echo sed cd sed grep echo sed cd "$@" $(pwd) printf -eu readonly
+"$1" cd test "$@" "$@" ${HOME} awk printf ${HOME}
+		2>/dev/null done $(pwd) test "$1" cd ${HOME} echo $(pwd) done
+	echo cd export x=1 -eu test printf sed then | awk
+	sed -eu local | $(pwd) "$@" $(pwd) awk $(pwd)
+		&& ${HOME} 'quoted text' && sed /usr/bin
+		"$@" 'quoted text' sed && -eu printf 'quoted text'
+		echo readonly export echo sed local
+	awk printf test awk readonly | 2>/dev/null printf local
+"$1" $(pwd) grep x=1 $(pwd) done sed -eu then --verbose sed grep 'quoted text'
+	$(pwd) /usr/bin done x=1 2>/dev/null /usr/bin readonly awk $(pwd)
+	--verbose local grep x=1 cd /usr/bin -eu cd --verbose x=1
+	done "$1" "$1" awk /usr/bin readonly ${HOME} "$1" done awk
+awk $(pwd) grep | done done ${HOME} grep 'quoted text' 2>/dev/null
+cd --verbose printf done /usr/bin "$1" echo then -eu "$1" -eu $(pwd) $(pwd)
+		${HOME} local echo $(pwd) -eu echo --verbose && | export -eu
+	cd /usr/bin done echo -eu printf
+	echo $(pwd) 2>/dev/null test readonly | export && readonly readonly grep done
+$(pwd) grep "$@" x=1 x=1 $(pwd)
+	echo ${HOME} export printf 'quoted text' /usr/bin export printf awk
+		/usr/bin echo sed grep $(pwd) $(pwd) | test grep "$1" $(pwd)
+	"$1" readonly 2>/dev/null --verbose cd --verbose readonly readonly
+awk test export $(pwd) test "$@" printf /usr/bin then |
+	readonly then | then done /usr/bin grep readonly
+	| export -eu readonly 2>/dev/null
+echo 2>/dev/null | test "$1" ${HOME} readonly "$@" x=1 then
+	'quoted text' then "$@"
+		x=1 readonly | | local "$@" x=1 x=1 cd -eu /usr/bin
+		grep readonly grep done grep export 2>/dev/null
+	readonly awk --verbose && --verbose
+		'quoted text' test test -eu cd "$@" "$@" grep test /usr/bin
+-eu ${HOME} /usr/bin | local -eu -eu
+$(pwd) export x=1 local $(pwd) /usr/bin "$@" /usr/bin awk 2>/dev/null
+		cd $(pwd) printf x=1 export && -eu echo /usr/bin
+-eu ${HOME} cd test grep -eu readonly "$1"
+'quoted text' grep 'quoted text'
+	2>/dev/null grep readonly
+	/usr/bin $(pwd) 'quoted text' 'quoted text' grep | done 2>/dev/null readonly
+	x=1 test "$1" "$1" cd 2>/dev/null
+	"$1" "$1" --verbose --verbose grep cd printf echo "$1" done
+	'quoted text' sed 2>/dev/null ${HOME} test x=1 'quoted text' ${HOME} -eu --verbose
+	then $(pwd) cd cd then "$@" echo local $(pwd) sed
+	$(pwd) ${HOME} "$@" test cd readonly awk
+	'quoted text' --verbose echo then
+$(pwd) sed printf x=1 /usr/bin
+	echo local ${HOME} 2>/dev/null 2>/dev/null
+	'quoted text' --verbose 2>/dev/null --verbose printf awk done /usr/bin
+readonly echo local sed sed echo echo export grep test
+grep /usr/bin /usr/bin awk awk "$@" "$1" --verbose
+'quoted text' --verbose grep && echo local then 2>/dev/null echo /usr/bin
+then done 'quoted text' export echo 2>/dev/null
+		echo done done "$@" awk test test test 'quoted text' 'quoted text'
+	cd ${HOME} 'quoted text' cd grep printf && grep
+	2>/dev/null echo "$@" readonly cd --verbose
+	"$@" /usr/bin then cd 'quoted text' 'quoted text' "$@" done
+		$(pwd) && "$@" then $(pwd) test && x=1 local 'quoted text' awk ${HOME}
+	awk $(pwd) echo test --verbose test sed cd test 'quoted text' $(pwd)
+readonly done ${HOME} "$1" echo local 2>/dev/null
+sed done grep "$1" readonly "$@" 'quoted text' awk then /usr/bin
+cd done echo export "$1" printf awk 2>/dev/null grep -eu && -eu x=1 awk
+grep echo then | ${HOME}
+	${HOME} echo test $(pwd) export 2>/dev/null 'quoted text' -eu test -eu
+readonly readonly $(pwd) --verbose test 'quoted text' sed readonly | then
+		export sed echo echo && "$1" then /usr/bin ${HOME}
+	| "$1" -eu /usr/bin readonly
+	"$@" --verbose ${HOME} "$@" grep export 2>/dev/null
+		done 2>/dev/null 'quoted text'
+		done "$@" | "$@" $(pwd) local done local cd readonly cd then -eu "$1" --verbose
+		x=1 x=1 'quoted text' grep done done export sed && $(pwd)
+	"$@" /usr/bin export sed /usr/bin 2>/dev/null cd done ${HOME}
+		test | -eu grep "$1" -eu test "$@" grep /usr/bin 'quoted text' done /usr/bin
+${HOME} printf local ${HOME} readonly done printf 'quoted text' && local awk
+cd --verbose ${HOME} grep | 2>/dev/null | cd | sed /usr/bin echo --verbose
+	&& local local export --verbose
+	test echo 'quoted text' "$@" "$1" echo readonly
+	grep printf --verbose then export && && cd awk done sed /usr/bin
+		echo local sed x=1 grep test local grep printf -eu && done
+		then sed $(pwd) grep sed
+		${HOME} export x=1 test readonly printf && &&
+	-eu 2>/dev/null && export x=1
+	$(pwd) cd && "$@" | 2>/dev/null grep "$1" 2>/dev/null
+&& --verbose "$1" done then readonly "$1" /usr/bin
+2>/dev/null -eu echo "$1" export
+	echo "$@" grep test done --verbose printf $(pwd) $(pwd) --verbose && && readonly
+2>/dev/null 2>/dev/null ${HOME} echo --verbose $(pwd) 'quoted text' "$@"
+grep /usr/bin awk readonly readonly done then cd export x=1 echo "$1" &&
+		${HOME} local "$@" grep local
+		cd $(pwd) grep cd then local /usr/bin sed awk ${HOME} | | readonly ${HOME} $(pwd)
+${HOME} cd x=1 cd readonly && local 2>/dev/null --verbose cd 2>/dev/null test
+		echo sed awk $(pwd) 'quoted text'
+	-eu cd echo test --verbose --verbose $(pwd)
+	readonly 'quoted text' awk grep "$1" |
+	done local sed local "$@" grep
+		| -eu | "$@" readonly && $(pwd) --verbose readonly readonly
+sed 2>/dev/null "$1" then "$1" x=1 grep sed --verbose sed
+| 'quoted text' /usr/bin export export printf && x=1 sed done $(pwd) test
+	grep x=1 grep -eu local export echo export sed x=1 --verbose local test cd | done
+	'quoted text' | $(pwd) cd x=1 export awk 'quoted text' printf /usr/bin
+	"$1" 2>/dev/null x=1 'quoted text' /usr/bin --verbose | | -eu $(pwd) printf
+cd then --verbose | printf "$1" sed printf 2>/dev/null cd x=1 | cd
+		| readonly ${HOME} && "$1" cd then grep then export test awk $(pwd) local
+| awk awk done "$1" then --verbose && -eu --verbose
+test readonly $(pwd) sed && -eu "$1" 2>/dev/null done
+		"$1" local local echo export
+		--verbose "$@" printf ${HOME} | "$1" 2>/dev/null done | echo ${HOME} $(pwd)
+	awk printf then then "$@" --verbose 2>/dev/null --verbose
+echo test then cd ${HOME} "$@" --verbose
+then export export then x=1 test ${HOME} 'quoted text'
+printf x=1 --verbose /usr/bin
+		&& awk cd done "$1" --verbose local readonly -eu "$@" export "$@" --verbose /usr/bin
+| then | x=1 -eu printf -eu | ${HOME}
+done $(pwd) done && --verbose "$1" readonly -eu x=1 awk export 2>/dev/null
+		2>/dev/null | local -eu
+2>/dev/null ${HOME} awk ${HOME} sed x=1 done | printf /usr/bin -eu test awk
+x=1 /usr/bin "$@" 2>/dev/null grep grep then && | readonly then test "$1" done
+cd "$1" --verbose x=1 sed local printf -eu "$1" printf sed test export
+	cd echo local printf "$@" ${HOME}
+| done sed printf then -eu "$@"
+		cd "$1" && test awk test printf /usr/bin test awk | 'quoted text' "$1" /usr/bin
+	cd $(pwd) -eu done | sed then then awk readonly then "$@" 2>/dev/null "$1" then
+	then "$@" awk 2>/dev/null 2>/dev/null done | grep $(pwd) then cd
+	cd test | --verbose readonly x=1 x=1 -eu ${HOME}
+		test printf readonly printf local echo --verbose "$1" grep
+	-eu -eu && echo "$@" "$@" cd 2>/dev/null
+		--verbose x=1 "$1" cd test awk && | x=1 2>/dev/null
+		'quoted text' test echo && done test awk awk sed done "$1" && echo
+	readonly cd | local --verbose -eu --verbose local -eu x=1 $(pwd) -eu
+		$(pwd) readonly readonly "$@" export awk readonly /usr/bin
+	$(pwd) sed "$@" x=1 grep then echo $(pwd) 2>/dev/null
+	${HOME} then sed $(pwd) export x=1 printf awk 'quoted text' test awk export
+		$(pwd) then | --verbose 'quoted text' 'quoted text'
+	test local "$@" x=1 cd -eu sed ${HOME} local && then
+	--verbose x=1 ${HOME} sed
+| export then sed && "$@" 2>/dev/null 2>/dev/null test
+	sed | 'quoted text' printf done printf ${HOME} local -eu awk $(pwd) | done $(pwd)
+x=1 --verbose grep done "$1" /usr/bin printf ${HOME} 2>/dev/null --verbose
+printf sed grep printf 2>/dev/null -eu printf
+		| $(pwd) ${HOME} --verbose sed | "$@" --verbose -eu | 'quoted text'
+		"$1" echo -eu echo printf 'quoted text' /usr/bin test export
+	$(pwd) -eu && /usr/bin --verbose
+	x=1 "$1" cd local grep grep --verbose cd -eu $(pwd) ${HOME}
+test awk --verbose readonly readonly && done then done local grep
+export grep 2>/dev/null 'quoted text'
+		x=1 cd && && awk ${HOME} 'quoted text'
+	local 'quoted text' export printf
+	2>/dev/null awk awk export
+		printf x=1 export printf ${HOME} test then
+	${HOME} 2>/dev/null grep 2>/dev/null
+		test cd -eu -eu printf test
+		export sed cd "$1" 'quoted text' | export sed $(pwd)
+		-eu 2>/dev/null then then -eu done ${HOME} && local
+echo 'quoted text' export printf "$1"
+"$@" sed echo 2>/dev/null sed awk && ${HOME} echo done
+$(pwd) --verbose test -eu | -eu sed --verbose x=1 'quoted text' echo
+		grep sed local /usr/bin x=1 echo --verbose test x=1 readonly
+	-eu 2>/dev/null then --verbose x=1 2>/dev/null
+readonly echo test ${HOME} test export 2>/dev/null then grep 2>/dev/null
+$(pwd) sed printf test $(pwd)
+2>/dev/null && sed awk -eu readonly | --verbose
+	test echo local export readonly local test
+	export "$1" awk cd $(pwd) local
+	cd then readonly cd 'quoted text' 2>/dev/null
+	sed /usr/bin export 2>/dev/null && awk $(pwd) export
+		test then readonly 'quoted text' cd 'quoted text' grep local printf local sed
+	| 2>/dev/null | local 2>/dev/null export x=1 x=1 2>/dev/null sed "$1" 'quoted text'
+		echo echo echo "$1" -eu done readonly local -eu export
+		| then cd --verbose "$1" awk x=1 2>/dev/null -eu 2>/dev/null sed 'quoted text'
+done test x=1 && -eu then $(pwd) export
+'quoted text' sed then x=1 grep -eu local done echo "$1" cd | ${HOME}
+		"$@" "$@" "$@" 'quoted text' 2>/dev/null echo /usr/bin
+	printf -eu 2>/dev/null local /usr/bin /usr/bin 2>/dev/null "$@" 'quoted text'
+cd x=1 printf echo $(pwd) done | grep awk "$@" local 2>/dev/null
+--verbose cd printf && $(pwd) done awk --verbose cd sed 2>/dev/null
+awk local done cd && 'quoted text'
+-eu then -eu readonly "$@" "$1" done export "$1" 2>/dev/null
+	x=1 2>/dev/null then test then 2>/dev/null && -eu then
+		printf "$@" grep 'quoted text' then --verbose "$1" export done sed test
+| readonly printf 'quoted text' grep --verbose then printf export
+	2>/dev/null ${HOME} 2>/dev/null ${HOME} then printf then local
+'quoted text' local sed
+		-eu readonly sed $(pwd) then then $(pwd) ${HOME} awk readonly
+	x=1 done ${HOME} 2>/dev/null local "$1" | sed
+	local local readonly test printf
+'quoted text' export ${HOME} --verbose 'quoted text' test "$1" /usr/bin
+		grep echo | echo 2>/dev/null x=1 test export readonly | "$@" local grep $(pwd)
+	sed "$@" 2>/dev/null "$1" test then
+"$1" "$@" then x=1 2>/dev/null --verbose
+	echo "$1" -eu -eu awk printf readonly sed
+done 2>/dev/null && printf printf 2>/dev/null
+	--verbose echo grep --verbose --verbose ${HOME} local x=1 && cd
+	$(pwd) && ${HOME} awk | done | readonly && x=1 done
+/usr/bin x=1 | 2>/dev/null printf readonly
+	export --verbose $(pwd) then
+x=1 "$@" local | test | $(pwd) 2>/dev/null
+-eu ${HOME} 2>/dev/null 'quoted text' echo cd 'quoted text'
+	grep then printf sed "$@" sed $(pwd) readonly cd awk | 'quoted text' 'quoted text'
+#include c135.sh
+echo local -eu local | then echo /usr/bin local
+readonly test export -eu --verbose
+printf then 2>/dev/null cd 'quoted text' awk
+		echo "$@" 'quoted text' printf export
+	awk grep readonly local awk cd | 'quoted text' sed
+then readonly --verbose local sed printf done -eu && -eu then printf
+		then cd x=1 echo -eu --verbose && ${HOME}
+		| $(pwd) printf 2>/dev/null then
+test ${HOME} && --verbose "$@" $(pwd) readonly
+done then echo done echo sed $(pwd) x=1 --verbose
+		2>/dev/null $(pwd) && "$@" then -eu awk ${HOME} $(pwd) "$@" | /usr/bin
+	2>/dev/null x=1 grep then "$@" 'quoted text' awk 2>/dev/null local readonly
+		export test -eu export -eu echo "$1" local readonly
+'quoted text' ${HOME}
+/usr/bin | | test /usr/bin local grep grep grep && printf echo done
+export 'quoted text' then awk "$@" | x=1 sed echo
+	echo local cd sed grep then export sed grep 'quoted text' 2>/dev/null grep
+| 2>/dev/null "$@" sed --verbose export
+		| | printf awk export cd export local && 'quoted text'
+readonly $(pwd) /usr/bin grep sed 'quoted text' then
+		'quoted text' && grep | "$@" 2>/dev/null then -eu done
+		grep -eu | --verbose && printf
+	sed "$1" awk test 'quoted text'
+		${HOME} ${HOME} awk "$1" echo
+	test | grep cd echo x=1 done
+	grep export x=1 sed --verbose
+export sed then && | -eu done then
+awk "$@" grep sed local "$@" 2>/dev/null "$@" "$@" test sed then 2>/dev/null x=1
+	"$1" x=1 -eu awk -eu test readonly then echo grep local
+	grep | "$@" printf test ${HOME}
+		export 2>/dev/null then 2>/dev/null 2>/dev/null | --verbose x=1 printf done
+sed sed local test && 2>/dev/null
+		readonly echo x=1 test && test --verbose local && ${HOME}
+done | test cd sed 'quoted text' sed "$1" ${HOME} local echo &&
+		| | sed 2>/dev/null local local && "$@" local 'quoted text'
+	sed readonly 2>/dev/null /usr/bin
+	done "$@" 2>/dev/null printf local local awk echo
+"$@" cd /usr/bin 'quoted text' $(pwd) 2>/dev/null
+	"$1" 2>/dev/null ${HOME} then "$1" && --verbose test printf readonly
+	cd 2>/dev/null done -eu -eu then local sed 2>/dev/null printf ${HOME} 2>/dev/null
+		readonly readonly printf
+	grep "$1" awk | local x=1
+		2>/dev/null sed echo done sed | x=1
+echo "$@" then --verbose export
+		then "$1" /usr/bin /usr/bin export echo 'quoted text'
+		-eu ${HOME} done && /usr/bin
+		then && awk echo "$1" $(pwd) then --verbose $(pwd) test local test
+		"$@" then readonly /usr/bin $(pwd) sed test awk x=1 grep readonly sed cd local
+		echo && sed printf local
+--verbose 'quoted text' echo cd
+		test awk cd 'quoted text' x=1 done echo local | echo -eu -eu
+	printf printf ${HOME} grep echo sed && done x=1 --verbose awk -eu "$1"
+'quoted text' echo then | x=1 "$@" ${HOME}
+		'quoted text' "$@" 2>/dev/null "$1" sed 2>/dev/null 2>/dev/null readonly
+	${HOME} sed $(pwd) | ${HOME} 'quoted text' -eu 'quoted text' echo "$@"
+export echo done then 'quoted text' $(pwd) $(pwd)
+$(pwd) then local done export /usr/bin -eu ${HOME} done x=1
+	x=1 local | "$1" sed export 'quoted text' local sed
+	x=1 awk sed done echo sed cd /usr/bin echo ${HOME} ${HOME}
+		2>/dev/null export sed test then done grep readonly local grep "$1" grep "$1"
+"$1" && -eu local && cd test | /usr/bin
+then $(pwd) echo awk then
+		"$1" $(pwd) 2>/dev/null local grep "$@" | "$1" /usr/bin then sed test local
+&& printf "$@" done 'quoted text' 2>/dev/null "$@" test
+		test x=1 /usr/bin printf grep sed ${HOME} done sed 'quoted text' $(pwd)
+	&& done then echo | local
+	sed 2>/dev/null local -eu awk ${HOME} test readonly -eu readonly local printf
+--verbose 'quoted text' --verbose sed sed
+		2>/dev/null local && --verbose test
+cd ${HOME} -eu 'quoted text' && sed then export
+		"$1" 2>/dev/null sed cd ${HOME}
+		cd done test echo local ${HOME} "$1" grep x=1 x=1 export awk
+	--verbose "$1" -eu "$1" 2>/dev/null x=1 /usr/bin | | && done readonly
+		then --verbose cd "$@" sed "$1" $(pwd) --verbose
+/usr/bin "$@" readonly $(pwd) echo echo done local 'quoted text'
+awk grep printf $(pwd) printf done "$1" && | "$1"
+	cd sed done echo /usr/bin -eu sed 'quoted text' then 2>/dev/null
+then cd sed printf && 2>/dev/null
+then 'quoted text' awk --verbose cd ${HOME} done ${HOME} test
+		| "$@" then grep readonly export $(pwd) x=1 then sed then echo "$1"
+	2>/dev/null printf sed sed "$@" ${HOME} | -eu && awk && x=1 test -eu "$1"
+		cd -eu export local export cd ${HOME} 2>/dev/null cd export 2>/dev/null
+x=1 /usr/bin 2>/dev/null export printf 'quoted text' printf
+		readonly "$@" -eu "$@" readonly grep done $(pwd) 2>/dev/null
+printf local printf export echo ${HOME} test -eu | readonly
+	local && -eu grep $(pwd) readonly awk done echo echo sed echo | 2>/dev/null x=1
+	export grep then export "$@" x=1 printf x=1 "$1" "$@" && readonly grep local echo
+		done x=1 "$@" "$1" awk printf | export then test
+${HOME} printf then sed sed test cd 2>/dev/null done -eu --verbose grep
+		"$@" then $(pwd) local
+		cd -eu 2>/dev/null 2>/dev/null
+| ${HOME} 'quoted text' grep 'quoted text' sed -eu "$@" --verbose
+	done -eu -eu x=1 /usr/bin printf
+	echo cd awk sed x=1 echo && $(pwd) then --verbose | printf
+	${HOME} then | cd cd -eu /usr/bin ${HOME} grep echo
+	cd "$@" --verbose -eu printf && /usr/bin | awk cd awk sed x=1 x=1
+	export done sed local && readonly $(pwd) test printf export then && ${HOME}
+-eu -eu "$1" echo export ${HOME}
+		echo export -eu 'quoted text'
+	"$1" local ${HOME} sed readonly
+	--verbose $(pwd) export awk test printf /usr/bin
+	awk -eu printf echo "$1" --verbose 'quoted text' 2>/dev/null
+'quoted text' x=1 --verbose -eu grep readonly /usr/bin $(pwd) sed then done
+		grep readonly then 2>/dev/null
+	grep sed 2>/dev/null ${HOME} "$1" $(pwd) local sed x=1 awk "$1"
+sed awk | "$1" sed $(pwd)
+	export --verbose printf cd
+&& /usr/bin 2>/dev/null readonly 'quoted text' then export test grep done "$@"
+	cd ${HOME} 'quoted text' then
+		echo --verbose readonly then test
+local local /usr/bin export ${HOME} grep local -eu test export local local
+		then done sed cd | sed export
+	grep ${HOME} done /usr/bin -eu cd printf $(pwd) /usr/bin
+		echo 2>/dev/null /usr/bin -eu export cd /usr/bin
+	done x=1 local local done done 2>/dev/null
+		awk && | export x=1 readonly | done cd $(pwd) 'quoted text' &&
+&& $(pwd) awk | then then "$@" export /usr/bin 'quoted text'
+${HOME} 'quoted text' /usr/bin
+		'quoted text' ${HOME} x=1 done ${HOME} test $(pwd)
+	"$1" readonly -eu export -eu sed && then
+		-eu "$@" printf --verbose -eu "$@"
+		"$1" done echo grep ${HOME} "$1" awk $(pwd) printf readonly
+		test x=1 cd echo $(pwd) grep export sed 'quoted text' then test
+| 2>/dev/null test | readonly
+	${HOME} echo readonly local 2>/dev/null
+/usr/bin test export 2>/dev/null export local local $(pwd) sed echo | sed grep
+		readonly then "$@" -eu cd printf
+	test readonly test sed $(pwd) grep -eu ${HOME} export done sed printf sed awk sed
+	/usr/bin "$1" x=1 $(pwd) export && && sed then 'quoted text' &&
+x=1 done test --verbose export done then local sed $(pwd)
+$(pwd) test sed && printf awk 'quoted text'
+		&& printf echo "$@" awk then awk awk |
+	local "$1" sed x=1 2>/dev/null ${HOME} x=1 test "$@" "$1" "$@"
+&& done /usr/bin x=1
+		${HOME} "$@" && | | test | -eu && ${HOME}
+$(pwd) readonly printf local 2>/dev/null awk && "$@" 'quoted text' 2>/dev/null
+cd "$@" | x=1 test then test export 2>/dev/null echo grep "$@" printf /usr/bin
+	export && test $(pwd) local echo local readonly echo readonly "$1" 'quoted text'
+-eu cd && -eu ${HOME} readonly && /usr/bin &&
+/usr/bin export sed echo | sed -eu test done awk done
+		2>/dev/null x=1 readonly /usr/bin
+		"$1" sed sed ${HOME} "$1" cd test readonly
+	--verbose readonly --verbose done sed x=1 printf echo
+	-eu 2>/dev/null awk /usr/bin awk printf export "$1" x=1 --verbose sed local printf
+	local test awk x=1 'quoted text' "$@" test ${HOME}
+		readonly "$@" --verbose $(pwd) 2>/dev/null
+		-eu sed ${HOME} 2>/dev/null $(pwd) -eu "$@"
+	x=1 then export cd 2>/dev/null grep test echo awk grep |
+		x=1 cd 'quoted text' cd 2>/dev/null --verbose -eu x=1 done
+-eu grep ${HOME} cd readonly done
+	test local | awk then export
+cd /usr/bin "$1" ${HOME} "$@" 2>/dev/null ${HOME} local "$1" ${HOME}
+x=1 "$1" | sed "$1" readonly $(pwd) local -eu cd test then then $(pwd) --verbose
+	x=1 && "$@" then grep -eu echo /usr/bin then done "$1" | $(pwd)
+		awk 'quoted text' /usr/bin local then grep -eu "$@" printf cd grep done $(pwd)
+echo 2>/dev/null 2>/dev/null 2>/dev/null awk then sed echo && readonly
+	export ${HOME} 2>/dev/null -eu x=1 cd awk
+		'quoted text' /usr/bin $(pwd) test export grep
+-eu "$@" -eu test sed cd "$@" --verbose
+		| -eu -eu /usr/bin --verbose
+	printf test 2>/dev/null awk --verbose cd grep $(pwd) sed
+	"$1" echo sed grep -eu 2>/dev/null grep test
+	readonly sed x=1 grep printf | /usr/bin
+printf 'quoted text' sed | | $(pwd) then
+x=1 then readonly local sed --verbose | awk export | echo "$@" | printf
+awk --verbose awk done | -eu
+		'quoted text' export "$@" 'quoted text' x=1 && && echo "$1" test "$@" &&
+then $(pwd) test 2>/dev/null sed | "$1" -eu |
+	-eu && awk | readonly ${HOME}
+		${HOME} readonly --verbose ${HOME} cd
+sed awk printf "$1" "$1" done
+		"$1" readonly $(pwd) test awk
+	then printf | local $(pwd) && && x=1
+	sed export echo "$1"
+	done $(pwd) && echo "$1" 'quoted text' sed 2>/dev/null
+	test then | awk readonly then export | sed 'quoted text' x=1 $(pwd) sed | done
+		--verbose 2>/dev/null sed sed readonly echo --verbose 'quoted text' 'quoted text'
+		sed done done "$1" export | done awk ${HOME} "$1" readonly printf --verbose
+		-eu /usr/bin local ${HOME} printf sed grep
+	"$@" test done done local test awk $(pwd) -eu echo awk x=1 x=1 local
+	x=1 grep cd ${HOME} x=1 export done local
+	export && grep echo -eu ${HOME} x=1 test /usr/bin done &&
+then | echo /usr/bin awk
+		awk local "$1" export sed
+		${HOME} --verbose $(pwd) readonly
+	done "$@" 2>/dev/null "$@" -eu --verbose
+	"$1" x=1 cd echo done
+	readonly -eu export sed | awk awk awk then x=1 printf
+--verbose "$1" done 'quoted text' awk x=1 x=1 readonly --verbose grep printf
+sed "$@" /usr/bin "$1" "$@" | printf 2>/dev/null sed ${HOME}
+		"$1" 'quoted text' | readonly
+cd 2>/dev/null then printf echo /usr/bin cd
+	sed | /usr/bin done done export done awk export --verbose test export export
+| -eu "$1" export awk
+	cd --verbose test awk awk x=1 && grep
+	'quoted text' printf cd "$@" 2>/dev/null sed
+	echo printf "$@" sed test 2>/dev/null --verbose done sed done
+		grep -eu "$1" x=1 "$1" export 'quoted text' grep printf /usr/bin echo grep
+	&& 2>/dev/null x=1 /usr/bin
+/usr/bin export -eu --verbose /usr/bin x=1 then sed export --verbose "$@" |
+"$1" "$1" awk then echo
+		local --verbose sed "$@" x=1 /usr/bin
+cd 2>/dev/null $(pwd) -eu -eu | ${HOME} "$@"
+printf && 'quoted text' cd local printf
+	echo && x=1 done cd && | "$@" && | export test /usr/bin 'quoted text'
+	cd -eu ${HOME} $(pwd) test awk -eu x=1 $(pwd) /usr/bin 'quoted text'
+	done local x=1 export |
+		cd done grep -eu echo 2>/dev/null "$1" -eu -eu then
+		$(pwd) awk $(pwd) /usr/bin export "$1" "$@" 'quoted text' readonly /usr/bin
+| /usr/bin $(pwd) test readonly x=1 local echo then | grep then local && 2>/dev/null
+	"$@" test "$1" printf sed | $(pwd) grep "$1"
+		cd x=1 2>/dev/null sed
+	"$@" export | --verbose local -eu "$@" echo test
+		"$1" 'quoted text' /usr/bin done --verbose && sed -eu grep done sed then "$@"
+	| $(pwd) awk readonly /usr/bin
+	grep printf cd grep echo printf /usr/bin local --verbose "$1" test $(pwd)
+	x=1 cd x=1 sed "$1" --verbose --verbose x=1 then --verbose x=1 x=1 -eu $(pwd)
+		grep && test | awk x=1 then grep $(pwd) | sed cd --verbose grep sed --verbose
+	local ${HOME} ${HOME} printf printf readonly echo "$1" "$@" -eu local | && echo
+	/usr/bin grep $(pwd) then "$@" then test --verbose
+	&& cd 'quoted text' $(pwd) sed awk "$1" ${HOME} x=1 "$@" ${HOME} awk
+		-eu cd "$@" && echo local --verbose export x=1 ${HOME} grep
+	$(pwd) x=1 awk done && export export
+grep 'quoted text' done printf "$1" printf
+		--verbose export --verbose grep sed then readonly done sed |
+		/usr/bin 'quoted text' test grep
+awk sed grep grep | printf echo then export test
+| 'quoted text' | grep | ${HOME} sed x=1
+	2>/dev/null && /usr/bin grep ${HOME} printf "$1" done printf "$@" sed 2>/dev/null
+	"$1" then 'quoted text' 'quoted text' readonly --verbose | then then done
+-eu local readonly "$1" cd 2>/dev/null echo done then echo --verbose
+"$1" $(pwd) x=1 "$1" then /usr/bin
+	"$1" cd $(pwd) "$@" "$@" done local
+&& ${HOME} awk --verbose /usr/bin
+${HOME} export ${HOME} echo | 2>/dev/null cd | 'quoted text'
+	2>/dev/null 'quoted text' echo done test 'quoted text' ${HOME} -eu
+	then $(pwd) cd sed | "$1"
+	${HOME} test test | echo 'quoted text' /usr/bin x=1 --verbose local awk
+'quoted text' local && $(pwd) done grep local
+	/usr/bin sed cd x=1 readonly 'quoted text' "$@" readonly /usr/bin
+	local awk done sed then sed && done x=1 readonly test grep "$1" 2>/dev/null
+cd readonly grep local then --verbose
+		"$@" echo done sed $(pwd) -eu x=1 printf x=1 then printf test $(pwd) && local
+	--verbose awk | awk --verbose "$1" grep "$1"
+echo awk awk /usr/bin grep $(pwd)
+		-eu export "$@" test --verbose 'quoted text'
+	printf echo "$1" then "$1" $(pwd) /usr/bin --verbose printf 2>/dev/null then "$1"
+	sed cd "$1" && grep ${HOME}
+	| "$@" then && -eu then awk "$1" x=1 /usr/bin 'quoted text' 2>/dev/null $(pwd)
+	local 2>/dev/null --verbose readonly -eu 'quoted text' export
+/usr/bin test $(pwd) then grep cd $(pwd) echo && local "$1"
+		cd export then sed done done /usr/bin -eu &&
+${HOME} $(pwd) export "$1" done echo ${HOME} then && "$@" printf readonly
+	'quoted text' 2>/dev/null then test cd x=1
+&& grep "$@" -eu then export export printf then x=1 && cd export
+	${HOME} then --verbose 2>/dev/null readonly | --verbose test export done $(pwd)
+test $(pwd) readonly -eu | x=1 2>/dev/null local 'quoted text'
+	${HOME} --verbose then --verbose echo x=1 ${HOME} 2>/dev/null
+		sed sed ${HOME} | 2>/dev/null && "$1" cd
+	printf export x=1 "$1" -eu x=1 $(pwd)
+-eu x=1 sed sed printf --verbose printf sed | /usr/bin cd $(pwd)
+then awk local printf 2>/dev/null | ${HOME} echo $(pwd)
+"$@" ${HOME} printf done --verbose 'quoted text' readonly sed -eu echo
+		--verbose then test ${HOME} --verbose ${HOME} export printf sed test "$@"
+		grep done /usr/bin $(pwd) local readonly -eu
+cd sed x=1 done x=1 "$@" -eu /usr/bin --verbose 'quoted text'
+		| ${HOME} test --verbose $(pwd) "$@"
+grep x=1 echo local 'quoted text' "$1" export
+		export --verbose awk "$@" | then 'quoted text' readonly
+	done 'quoted text' "$@" grep | /usr/bin && cd "$1" && sed grep x=1 done |
+	2>/dev/null export "$1" grep -eu "$1"
+	export export awk "$1" local printf printf
+		| ${HOME} cd readonly && x=1 "$1" local export readonly -eu -eu cd -eu cd then
+	${HOME} x=1 sed local | echo | local /usr/bin "$1" done | grep $(pwd) export
+	| printf && sed export printf
+		readonly 2>/dev/null export | "$1" export "$1" done && -eu
+	sed grep /usr/bin export "$@" /usr/bin ${HOME} then sed
+	export 'quoted text' local readonly ${HOME} done "$@" sed 'quoted text'
+		--verbose ${HOME} 2>/dev/null 'quoted text' ${HOME} awk | 2>/dev/null cd test --verbose
+		test cd sed local "$@" "$@" then printf "$@" $(pwd) --verbose
+		local readonly --verbose /usr/bin && ${HOME} 'quoted text'
+	-eu readonly 'quoted text' /usr/bin 'quoted text' echo
+	"$@" grep sed ${HOME} local 'quoted text' cd --verbose cd cd test -eu then printf
+sed export 2>/dev/null 2>/dev/null | readonly
+		sed printf sed | /usr/bin ${HOME} cd sed 'quoted text' cd 'quoted text'
+	printf ${HOME} "$@" then 2>/dev/null 'quoted text' ${HOME}
+		/usr/bin /usr/bin local -eu /usr/bin 'quoted text' echo local -eu awk printf
+cd printf x=1 | 2>/dev/null export "$@" readonly 2>/dev/null awk --verbose
+	-eu sed ${HOME} x=1 'quoted text' |
+		echo done 2>/dev/null "$@" cd 'quoted text'
+		-eu cd test "$@" "$@" "$1" sed
+	2>/dev/null awk awk ${HOME}
+cd "$@" printf export --verbose test -eu "$@" then then -eu then sed | done then
+'quoted text' test printf then export
+-eu "$@" -eu -eu cd then x=1 readonly done readonly cd x=1 -eu "$1"
+	'quoted text' --verbose "$1" /usr/bin "$1" "$@" -eu test test "$1"
+&& then | "$1" grep sed
+	${HOME} | grep export readonly sed readonly
+		x=1 export 2>/dev/null export sed readonly cd readonly test
+$(pwd) readonly local awk grep
+		export grep "$1" x=1 x=1 awk sed /usr/bin /usr/bin | test --verbose
+	sed cd test grep echo --verbose | ${HOME} && then /usr/bin "$1"
+		then | 'quoted text' readonly x=1 export x=1 && sed awk done /usr/bin
+	&& -eu -eu echo 2>/dev/null 'quoted text' ${HOME} printf
+		x=1 then --verbose "$@"
+done ${HOME} x=1 grep export sed
+"$1" grep && | "$1" "$1" "$1" done cd printf
+	'quoted text' 'quoted text' printf local cd /usr/bin /usr/bin /usr/bin 2>/dev/null
+local grep echo -eu done 2>/dev/null "$@" then printf 2>/dev/null test
+		--verbose | -eu sed then | -eu "$@"
+	echo --verbose local x=1 echo "$1" printf -eu test test "$1" ${HOME} then readonly
+		readonly ${HOME} awk x=1 "$1" awk ${HOME}
+x=1 echo awk then export awk /usr/bin 'quoted text' readonly sed
+		awk printf "$1" awk grep
+test sed readonly printf test && echo local local -eu test test local sed
+	2>/dev/null /usr/bin ${HOME} printf echo printf sed x=1 echo done test
+--verbose | then --verbose awk test x=1 "$@" --verbose 'quoted text' "$@" cd
+--verbose cd | /usr/bin
+		&& export ${HOME} grep printf
+-eu "$@" export | local "$@" ${HOME} done printf -eu 'quoted text'
+	awk && export -eu grep export cd --verbose 2>/dev/null 2>/dev/null test
+	test awk cd test cd awk export
+grep 'quoted text' printf &&
+then -eu /usr/bin export | printf sed printf |
+x=1 done 2>/dev/null sed local $(pwd) readonly $(pwd) x=1
+		2>/dev/null "$1" cd $(pwd) export done $(pwd) awk $(pwd) $(pwd) export 2>/dev/null
+		done awk x=1 -eu 'quoted text' sed "$@" then
+local local "$@" ${HOME} sed
+		-eu done test --verbose echo $(pwd)
+		cd 'quoted text' /usr/bin printf 2>/dev/null
+	&& test | --verbose 2>/dev/null
+		2>/dev/null 'quoted text' done printf /usr/bin "$1" printf done
+	done 'quoted text' readonly $(pwd) awk --verbose done -eu
+/usr/bin x=1 echo 'quoted text' readonly
+-eu local -eu x=1 done grep printf
+		/usr/bin 2>/dev/null "$1" && && ${HOME} grep export export "$@" grep
+$(pwd) --verbose cd echo
+		test awk local awk awk readonly then local "$1" test awk
+		export x=1 "$@" 'quoted text' grep && /usr/bin
+		"$@" 'quoted text' && sed
+	grep export local cd 'quoted text'
+	| "$1" cd | grep /usr/bin
+	awk "$@" grep $(pwd) cd awk
+awk "$1" readonly test x=1 readonly awk "$1" 2>/dev/null $(pwd) "$@" grep
+printf then && printf 'quoted text' grep
+		'quoted text' test | test done readonly
+		printf "$@" 'quoted text' $(pwd) cd | echo test
+		awk done ${HOME} sed ${HOME} test --verbose
+		"$1" export cd done "$@" 'quoted text' "$1" local /usr/bin "$1" -eu | readonly
+		cd --verbose local && local
+		--verbose "$@" printf local sed x=1 "$@" readonly /usr/bin
+	x=1 "$1" printf 'quoted text' local sed ${HOME} readonly
+		readonly sed 'quoted text' readonly /usr/bin "$1" 2>/dev/null
+	--verbose x=1 x=1 && grep test 2>/dev/null "$@" echo
+	local -eu --verbose local local export awk 'quoted text' sed /usr/bin
+--verbose ${HOME} echo test "$1" x=1
+		&& then /usr/bin 2>/dev/null
+-eu -eu done printf "$@" local "$@" /usr/bin
+	printf 2>/dev/null readonly "$1" /usr/bin
+		${HOME} --verbose x=1 sed done readonly
+	'quoted text' $(pwd) "$1" -eu 'quoted text' && --verbose
+echo export "$@" test sed && cd then done
+	&& "$@" "$@" awk "$@" then
+		-eu --verbose export -eu x=1
+	x=1 local 2>/dev/null grep done
+	'quoted text' cd echo -eu | then grep printf -eu ${HOME}
+		then 2>/dev/null ${HOME} ${HOME} 2>/dev/null test /usr/bin cd /usr/bin
+	grep && sed cd && --verbose $(pwd) --verbose
+		| -eu && printf 'quoted text' local cd test done | sed 2>/dev/null $(pwd) then
+| ${HOME} printf && --verbose
+		$(pwd) export $(pwd) "$1"
+		"$@" then 'quoted text' sed | ${HOME} ${HOME} "$@"
+awk readonly --verbose echo awk "$1" x=1 echo 'quoted text' --verbose
+		--verbose export 'quoted text'
+test "$@" 'quoted text' && 2>/dev/null test then && export done
+		/usr/bin test | local readonly "$1" $(pwd)
+		--verbose awk $(pwd) 2>/dev/null test awk -eu
+		&& "$1" /usr/bin && printf export ${HOME}
+		${HOME} | local "$1" | export
+$(pwd) && "$1" awk grep /usr/bin ${HOME}
+	"$@" "$@" && local && --verbose grep cd local -eu "$@" grep
+	"$1" /usr/bin sed printf --verbose ${HOME} "$@" ${HOME} done "$@"
+	-eu cd awk $(pwd) then readonly
+'quoted text' -eu sed x=1 /usr/bin sed done --verbose
+		$(pwd) printf x=1 awk then $(pwd) done readonly
+$(pwd) ${HOME} then test "$@" awk $(pwd) test && /usr/bin echo export
+test | && 2>/dev/null cd ${HOME} x=1 sed readonly | echo --verbose | $(pwd) | 2>/dev/null
+"$@" 'quoted text' ${HOME} export
+/usr/bin "$@" awk export printf printf x=1 $(pwd) --verbose && 'quoted text'
+2>/dev/null $(pwd) test x=1 "$@" echo x=1 local local then "$1"
+		$(pwd) /usr/bin test --verbose sed export
+echo local then grep test 'quoted text' -eu cd
+		echo "$1" && local --verbose 2>/dev/null readonly && cd --verbose x=1 | "$1"
+		-eu done /usr/bin echo "$1" awk "$1" local ${HOME} ${HOME} /usr/bin
+export --verbose 2>/dev/null readonly done 'quoted text' grep --verbose cd then
+grep ${HOME} awk ${HOME} --verbose && cd sed $(pwd) awk x=1 awk $(pwd) x=1
+		| test 2>/dev/null echo ${HOME} | local x=1 test /usr/bin
+		$(pwd) 'quoted text' -eu
+		done /usr/bin printf 'quoted text' "$1" $(pwd) $(pwd) echo done
+export /usr/bin | ${HOME} "$1" done --verbose then test readonly grep x=1 /usr/bin
+	done export done "$@" local export test "$1" then then -eu /usr/bin done ${HOME}
+	awk 2>/dev/null 'quoted text' done local | ${HOME}
+		${HOME} test && awk readonly 2>/dev/null
+		/usr/bin readonly "$1" "$@" awk echo awk then 2>/dev/null /usr/bin
+local export $(pwd) "$1" readonly ${HOME} local done x=1
+		--verbose export test | "$1" grep printf export "$1" printf then
+	"$1" $(pwd) sed && local
+	echo ${HOME} "$@" local test grep &&
+		sed cd printf && "$@" -eu awk 'quoted text' echo /usr/bin $(pwd) printf
+| done then local x=1 test export local --verbose local | grep export
+		echo 'quoted text' grep x=1
+	${HOME} ${HOME} done cd 'quoted text' && ${HOME} done grep cd --verbose echo
+'quoted text' local local ${HOME} printf -eu --verbose
+	${HOME} test done "$1" then
+"$@" x=1 echo local -eu then x=1 | 'quoted text' awk export "$@" --verbose
+		"$@" local printf --verbose x=1 $(pwd) cd then
+	| grep local readonly
+	"$@" "$@" then x=1 x=1 | 'quoted text' then --verbose -eu printf 'quoted text'
+		'quoted text' test local --verbose awk local cd | "$@" && ${HOME}
+	printf export awk test && cd cd 'quoted text' printf sed $(pwd) grep
+cd then "$@" 'quoted text' $(pwd) sed | -eu grep -eu --verbose awk
+then sed cd export && awk 'quoted text' done sed -eu echo /usr/bin awk
+	"$1" cd test done then done local awk
+	local ${HOME} | 'quoted text' x=1 local sed x=1 printf $(pwd) awk
+	--verbose test ${HOME} x=1 && ${HOME} "$1"
+echo "$1" "$@" cd "$@" "$1" echo readonly && && $(pwd) local grep -eu local
+	cd export awk 2>/dev/null
+		-eu done then sed readonly x=1 done local -eu "$1"
+		then local && cd done echo "$@"
+		-eu "$@" -eu readonly $(pwd) 2>/dev/null grep /usr/bin export then
+	sed -eu sed "$@" -eu | $(pwd) $(pwd) grep "$@" echo sed
+"$@" 2>/dev/null done x=1 x=1 "$@" 'quoted text' "$1" echo
+	/usr/bin echo sed then && export && x=1
+	"$@" export test test "$1" then | export
+-eu x=1 then 'quoted text' && --verbose awk && "$1" echo
+awk "$1" ${HOME} echo cd echo cd $(pwd) && cd then | then awk printf "$1"
+sed local printf x=1 && cd
+		echo 2>/dev/null "$@" awk 'quoted text'
+	x=1 $(pwd) done /usr/bin export
+'quoted text' awk readonly readonly
+	cd "$1" then "$1" cd sed $(pwd) 2>/dev/null "$1" --verbose
+printf then local -eu grep 'quoted text' ${HOME}
+/usr/bin awk --verbose "$1" local 2>/dev/null awk 'quoted text'
+		echo awk x=1 echo --verbose && printf awk $(pwd)
+"$@" x=1 sed 'quoted text'
+cd local --verbose grep cd cd
+	&& 2>/dev/null "$1" 2>/dev/null ${HOME} grep x=1 printf grep
+		awk 'quoted text' && | test 2>/dev/null local -eu awk readonly
+		then then printf /usr/bin x=1
+'quoted text' /usr/bin 'quoted text' done
+		--verbose --verbose awk cd | -eu 'quoted text' "$1" && local sed ${HOME} $(pwd)
+		done echo 2>/dev/null
+	then sed done 'quoted text' printf
+"$1" /usr/bin awk echo echo readonly test
+"$@" -eu "$1" $(pwd) /usr/bin -eu test /usr/bin
+$(pwd) x=1 test $(pwd) -eu grep readonly
+		x=1 cd x=1 cd done printf /usr/bin | done test "$1" -eu | ${HOME}
+		then | x=1 ${HOME} "$@" readonly grep cd cd /usr/bin ${HOME} echo /usr/bin
+	| "$1" sed 'quoted text' echo | sed "$1" test sed "$@"
+"$@" local 2>/dev/null -eu done && awk --verbose local
+		--verbose --verbose $(pwd)
+"$1" echo export 2>/dev/null awk --verbose /usr/bin done --verbose test then readonly
+local $(pwd) test /usr/bin /usr/bin
+	awk "$@" 'quoted text' 'quoted text' test /usr/bin local local awk echo | "$1"
+	cd /usr/bin --verbose --verbose && x=1 'quoted text' awk awk sed
+	local printf sed awk $(pwd) 'quoted text' 2>/dev/null
+/usr/bin local then ${HOME} grep
+	export done printf 2>/dev/null
+		${HOME} done "$1" sed done done printf x=1 x=1 then ${HOME} echo x=1 export
+| awk readonly $(pwd) | $(pwd) cd grep
+	$(pwd) && awk && 2>/dev/null echo readonly echo
+	readonly x=1 echo -eu "$@" echo grep readonly |
+		grep readonly && "$1" awk done $(pwd) export sed then
+printf && ${HOME} | then | "$@" | "$@" 'quoted text'
+		export 2>/dev/null ${HOME} x=1 $(pwd) 2>/dev/null x=1 printf
+	awk test done printf grep cd
+	cd echo export export readonly --verbose cd
+	| 2>/dev/null "$1" echo -eu "$@" x=1 printf
+	$(pwd) export awk /usr/bin done ${HOME}
+	done "$1" "$1" awk 'quoted text' sed done echo
+${HOME} && export readonly -eu | 'quoted text'
+grep 'quoted text' printf cd "$1" printf
+| done readonly -eu test cd $(pwd)
+		x=1 'quoted text' "$1" /usr/bin $(pwd)
+--verbose 2>/dev/null printf sed echo $(pwd) sed cd export 2>/dev/null
+		local -eu cd awk grep printf
+readonly sed echo done echo cd $(pwd) done && export sed echo -eu printf
+then -eu $(pwd) "$1" sed "$1" -eu $(pwd) /usr/bin
+		test /usr/bin done done awk
+		printf && then -eu then 'quoted text'
+	sed -eu x=1 $(pwd) -eu $(pwd) "$@" sed --verbose | readonly ${HOME}
+		&& grep grep /usr/bin export 2>/dev/null --verbose --verbose
+		2>/dev/null readonly x=1 done | done "$@" readonly -eu local grep
+echo local export echo echo | $(pwd) 'quoted text' awk local x=1 | $(pwd)
+	$(pwd) sed local "$@" readonly
+		&& -eu readonly "$1" -eu test readonly --verbose
+	readonly printf then 2>/dev/null
+	export echo done "$@" 2>/dev/null x=1 | 'quoted text'
+	/usr/bin "$@" sed grep "$1" awk done done ${HOME} && /usr/bin test /usr/bin $(pwd)
+2>/dev/null "$@" | awk printf && 'quoted text'
+	"$@" ${HOME} cd 2>/dev/null grep x=1 printf then -eu ${HOME} local readonly
+		echo grep local 2>/dev/null -eu "$@" -eu 'quoted text' printf --verbose --verbose
+	grep && then && grep /usr/bin sed done -eu "$@" 2>/dev/null "$1" then
+	cd x=1 then && --verbose awk grep grep 2>/dev/null
+	test echo | --verbose "$@" cd | local echo
+	2>/dev/null sed /usr/bin x=1 | --verbose awk ${HOME} export printf && readonly
+	'quoted text' -eu then 2>/dev/null "$1" x=1 sed export 'quoted text'
+grep done then "$@" /usr/bin printf local x=1 2>/dev/null /usr/bin -eu
+	export 2>/dev/null "$@" test "$1" printf x=1 -eu awk
+&& printf then x=1 ${HOME} done && 'quoted text'
+then 'quoted text' $(pwd)
+test grep cd cd test test export x=1 'quoted text' x=1 "$@"
+	--verbose ${HOME} printf -eu readonly --verbose && awk -eu printf
+	| sed cd x=1 x=1 cd done cd "$1" ${HOME} printf /usr/bin -eu --verbose
+x=1 test local local cd | x=1 'quoted text' 2>/dev/null
+then /usr/bin x=1 "$@" done x=1 "$1" && cd local done 2>/dev/null local -eu
+		-eu "$@" ${HOME} --verbose cd /usr/bin "$@" 2>/dev/null && echo "$1"
+2>/dev/null awk "$@"
+	| cd --verbose then "$@" 'quoted text' -eu cd export x=1 $(pwd) $(pwd)
+		done local export awk local /usr/bin | awk | $(pwd) 'quoted text' done $(pwd) "$1"
+	export /usr/bin awk awk echo local grep awk echo awk && $(pwd)
+echo 2>/dev/null then -eu "$1" local done
+		2>/dev/null grep grep
+		local ${HOME} test awk 2>/dev/null local sed then export 'quoted text'
+		local cd local test 'quoted text' local "$1"
+done --verbose awk local "$@" /usr/bin 2>/dev/null
+echo --verbose ${HOME} $(pwd) && done done 'quoted text' test && 'quoted text'
+sed "$1" /usr/bin ${HOME} 'quoted text'
+printf local 2>/dev/null $(pwd)
+x=1 echo ${HOME} "$@" echo readonly
+	x=1 local printf local awk sed test grep $(pwd)
+	x=1 /usr/bin /usr/bin $(pwd) sed --verbose echo done cd /usr/bin
+grep export local then x=1 test done then cd grep echo readonly
+	"$1" echo 'quoted text' local test
+		awk --verbose grep sed | export -eu 'quoted text' done "$1"
+	test then test "$1" cd x=1 export && export
+		"$1" cd test echo cd sed x=1 /usr/bin grep printf 'quoted text' 2>/dev/null
+printf x=1 printf -eu done local && local cd "$1" ${HOME}
+	echo "$1" && awk export readonly awk printf readonly then
+	2>/dev/null export sed /usr/bin
+	x=1 ${HOME} $(pwd) "$@" then echo sed cd done --verbose
+		export done /usr/bin --verbose && local && readonly then 'quoted text' x=1
+	-eu x=1 | && --verbose cd awk | --verbose
+awk "$@" | cd done readonly
+		readonly 'quoted text' local grep "$1" && -eu 2>/dev/null -eu x=1 -eu test
+		"$@" readonly 2>/dev/null --verbose "$@" awk echo -eu
+	$(pwd) export then | test printf local grep awk grep cd echo export awk 2>/dev/null
+printf sed && then --verbose
+sed && ${HOME} "$1" printf readonly local /usr/bin then 'quoted text'
+	grep $(pwd) -eu 'quoted text' cd 2>/dev/null
+	sed done local 'quoted text' "$1"
+-eu --verbose then 2>/dev/null ${HOME} 'quoted text' local then
+	export local 'quoted text' grep 2>/dev/null
+&& "$@" x=1 readonly then --verbose export && 2>/dev/null -eu local "$@"
+		x=1 'quoted text' cd local printf
+		${HOME} 2>/dev/null x=1 export 2>/dev/null /usr/bin 2>/dev/null test -eu grep
+		-eu local "$1" readonly 2>/dev/null
+		cd export echo && ${HOME} done awk
+		x=1 readonly | 2>/dev/null
+awk --verbose -eu cd | echo
+	${HOME} 'quoted text' grep 2>/dev/null printf && readonly 'quoted text' printf ${HOME}
+awk "$@" awk readonly test grep sed sed readonly "$@" ${HOME} export | && cd
+		awk test && printf | cd test --verbose local awk printf local local then sed done
+	'quoted text' "$1" /usr/bin awk printf "$1" "$1" export
+		readonly export export ${HOME} done grep ${HOME}
+	/usr/bin sed 2>/dev/null export grep
+	done grep ${HOME} then printf then then sed cd echo "$1" readonly x=1
+	then | done local then --verbose
+		"$1" cd done x=1 && readonly --verbose local "$@" x=1 then "$1" sed 'quoted text'
+	local 'quoted text' local | sed | 'quoted text'
+		local cd --verbose x=1 readonly x=1 export
+x=1 local /usr/bin test echo /usr/bin 2>/dev/null then done cd --verbose test x=1
+readonly awk readonly 'quoted text'
+		"$1" 2>/dev/null 'quoted text'
+	grep ${HOME} "$@" printf
+	then local --verbose sed readonly
+		awk awk -eu echo 'quoted text' -eu 'quoted text' -eu | done grep 'quoted text'
+${HOME} export then 2>/dev/null
+	sed --verbose -eu $(pwd) | echo done
+	readonly grep -eu x=1 "$1" x=1 && 'quoted text' -eu --verbose echo 'quoted text'
+		grep "$@" ${HOME} awk printf test then x=1 cd test grep --verbose printf echo
+	readonly 'quoted text' | -eu sed "$@" grep
+	"$1" test -eu "$@" && x=1
+		2>/dev/null printf local awk ${HOME} cd readonly
+		readonly && 'quoted text' sed "$1" && "$@" readonly
+x=1 echo readonly printf $(pwd) test test
+sed local grep export export
+	&& 'quoted text' printf sed cd
+| && && -eu -eu local done | /usr/bin awk export -eu --verbose -eu done x=1 grep
+local done local "$1" printf sed export | 'quoted text' awk ${HOME}
+| 2>/dev/null export export ${HOME} cd echo | -eu
+"$1" export sed "$@" echo
+	done $(pwd) readonly $(pwd) -eu
+	local x=1 sed | printf && 'quoted text' echo "$@" --verbose 2>/dev/null
+		x=1 export test x=1 "$1" 'quoted text'
+		readonly "$@" done readonly x=1 test 'quoted text'
+	| echo --verbose local grep local echo then -eu
+	-eu test then test "$1" 'quoted text' test readonly test &&
+	test && $(pwd) && 'quoted text' && 'quoted text' export "$1" && awk cd /usr/bin
+	x=1 /usr/bin printf && $(pwd) $(pwd) local x=1 done -eu
+		x=1 echo readonly export printf printf then 'quoted text' | readonly ${HOME}
+done test --verbose sed awk export done awk $(pwd) "$1" grep grep grep -eu
+'quoted text' done "$@"
+		${HOME} -eu x=1 x=1 done &&
+test 'quoted text' printf printf sed sed then awk | |
+$(pwd) readonly "$@" export 2>/dev/null
+printf grep 'quoted text' --verbose local --verbose | $(pwd)
+"$@" then $(pwd) 2>/dev/null echo "$@" | cd ${HOME} echo |
+		"$@" -eu cd /usr/bin ${HOME} --verbose /usr/bin "$@" export test | done
+export cd x=1 done echo export then && grep $(pwd) done 'quoted text'
+	"$1" test --verbose 2>/dev/null done "$@" echo
+	&& ${HOME} ${HOME} | readonly
+		test printf ${HOME} readonly | cd /usr/bin sed 2>/dev/null
+$(pwd) -eu | 'quoted text' export | cd test export echo cd -eu
+${HOME} grep export && $(pwd) done /usr/bin "$1" 'quoted text'
+	printf grep then printf $(pwd) awk | 'quoted text' "$1" done test
+test --verbose done x=1 'quoted text' grep test awk cd "$@" 'quoted text'
+		cd then echo readonly 'quoted text' export echo
+		/usr/bin awk 2>/dev/null | $(pwd) then --verbose -eu "$1" "$@" sed x=1
+	x=1 export test test ${HOME} ${HOME} /usr/bin cd
+		then export "$1" "$@" | then export 2>/dev/null grep
+printf done && "$1" ${HOME} grep --verbose done
+		export echo readonly $(pwd)
+		&& 'quoted text' test | sed 2>/dev/null --verbose then awk "$1" readonly
+		'quoted text' -eu awk -eu readonly local 'quoted text' sed "$@" cd done 'quoted text'
+		'quoted text' ${HOME} readonly awk then test --verbose printf
+	awk 2>/dev/null awk readonly | cd cd local
+grep "$1" x=1 export ${HOME} | | printf "$@" sed done -eu "$1" printf
+/usr/bin 'quoted text' echo
+		then done x=1 cd sed | 'quoted text' -eu test sed 2>/dev/null
+		done local printf printf && done ${HOME} x=1 2>/dev/null &&
+	x=1 "$1" sed $(pwd) x=1 readonly echo $(pwd) x=1 "$1" $(pwd) x=1
+${HOME} x=1 local grep ${HOME} $(pwd)
+grep local printf 2>/dev/null /usr/bin --verbose
+/usr/bin grep $(pwd) && && "$@" cd 'quoted text' local /usr/bin echo
+		--verbose done cd done && 2>/dev/null 2>/dev/null -eu 2>/dev/null ${HOME}
+		-eu grep x=1 readonly then export awk
+/usr/bin x=1 printf x=1 'quoted text' done ${HOME} sed /usr/bin done printf
+		cd "$1" test 2>/dev/null --verbose -eu cd cd 'quoted text' then cd printf
+	"$@" | x=1 grep done cd done printf 2>/dev/null
+export 2>/dev/null "$1" -eu | && $(pwd) grep
+	| && export readonly echo awk readonly awk printf then done
+		"$1" x=1 test grep "$@" && ${HOME} echo done local --verbose
+	&& awk export x=1 then -eu 'quoted text' 2>/dev/null printf $(pwd) ${HOME} sed
+	export && --verbose -eu /usr/bin grep sed cd ${HOME} readonly
+		export 2>/dev/null | /usr/bin && grep $(pwd) grep
+	-eu grep 2>/dev/null | ${HOME} ${HOME}
+		&& local grep test then readonly done then "$1"
+	sed x=1 test printf /usr/bin "$1" local | | printf awk then test $(pwd) then
+'quoted text' $(pwd) cd x=1 sed | "$@"
+	cd done && && then export readonly sed "$1" $(pwd) 2>/dev/null
+then --verbose 2>/dev/null grep && x=1 2>/dev/null "$1"
+	&& done /usr/bin --verbose ${HOME} x=1 awk sed /usr/bin awk readonly /usr/bin ${HOME}
+then export echo test x=1 sed
+awk $(pwd) grep --verbose test $(pwd) grep /usr/bin /usr/bin --verbose
+-eu && "$1" then grep ${HOME} test /usr/bin /usr/bin printf "$1" printf
+	local cd printf local echo echo done $(pwd) $(pwd) grep printf | /usr/bin x=1 $(pwd)
+		&& 'quoted text' done done local export cd awk local -eu | grep $(pwd)
+grep readonly --verbose -eu
+	'quoted text' test $(pwd) printf 2>/dev/null $(pwd)
+	awk local grep printf /usr/bin then | $(pwd) --verbose
+		test test && $(pwd) echo awk export x=1 "$1" test "$1"
+		/usr/bin grep -eu 2>/dev/null local done --verbose readonly
+		test 'quoted text' $(pwd) echo "$@" then 2>/dev/null sed
+		-eu then 'quoted text' test "$1" printf "$1" sed readonly printf sed
+then x=1 sed x=1 -eu local -eu /usr/bin
+readonly -eu 'quoted text' x=1 -eu -eu --verbose export
+		awk local --verbose ${HOME} --verbose "$@" $(pwd) 'quoted text'
+	then awk --verbose -eu done && cd /usr/bin | 2>/dev/null /usr/bin -eu echo
+"$1" sed echo then awk test then awk --verbose printf printf 2>/dev/null --verbose
+		sed 'quoted text' then done --verbose -eu sed 2>/dev/null export test $(pwd)
+awk --verbose && awk "$1" done cd 2>/dev/null 'quoted text' 2>/dev/null printf
+		'quoted text' | -eu "$@" then "$1" /usr/bin $(pwd) /usr/bin awk "$1" printf
+	readonly 'quoted text' printf | printf printf $(pwd)
+		-eu grep grep | test done awk | | ${HOME} printf then sed awk
+	--verbose sed --verbose "$1" 'quoted text'
+	| "$@" $(pwd) x=1 then readonly -eu done
+	$(pwd) 'quoted text' --verbose -eu test $(pwd)
+readonly "$@" sed cd --verbose /usr/bin local local |
+		2>/dev/null export printf grep awk
+	then then test | printf done x=1 x=1
+	-eu awk test readonly awk export $(pwd) cd grep sed /usr/bin | then && local &&
+	cd 'quoted text' x=1 awk then -eu "$1" | ${HOME} --verbose
+echo x=1 awk -eu 'quoted text' printf readonly echo "$1" ${HOME} export &&
+| 'quoted text' -eu grep sed printf local printf done local
+		then test $(pwd) "$@" -eu 2>/dev/null ${HOME} export $(pwd) "$@" test
+	echo test awk && "$@" -eu export
+		--verbose local && local /usr/bin grep /usr/bin
+| -eu && local test local -eu awk grep "$@" cd "$1" export
+		&& echo --verbose grep printf echo 2>/dev/null && 2>/dev/null "$@" then done
+		${HOME} echo --verbose ${HOME} grep x=1 cd $(pwd) "$@" readonly /usr/bin -eu then
+/usr/bin -eu local $(pwd) awk x=1 'quoted text' $(pwd) "$@"
+		sed export 'quoted text' export ${HOME} done echo test sed
+		$(pwd) ${HOME} cd 'quoted text'
+${HOME} x=1 printf local then then &&
+$(pwd) && local 'quoted text' "$1" "$1" export 'quoted text'
+x=1 2>/dev/null echo export && | && echo /usr/bin sed && | cd echo "$@"
+--verbose sed ${HOME}
+	/usr/bin then --verbose /usr/bin echo "$1" && then echo --verbose export
+		| | echo sed readonly awk grep export 'quoted text' printf
+	'quoted text' sed && echo 2>/dev/null then x=1 $(pwd) local
+		sed 'quoted text' then && /usr/bin awk test ${HOME} -eu -eu x=1
+printf cd x=1 grep grep test /usr/bin local
+	printf 2>/dev/null -eu sed "$@" export && then 2>/dev/null then x=1 $(pwd)
+	'quoted text' | ${HOME} awk then awk ${HOME} 2>/dev/null 'quoted text'
+		-eu sed cd x=1 local "$1" $(pwd) &&
+	local then readonly echo && --verbose
+	| 'quoted text' ${HOME} printf 'quoted text' x=1 cd echo "$@" readonly
+	2>/dev/null export 'quoted text' printf x=1 x=1
+$(pwd) awk grep --verbose $(pwd) then sed -eu echo
+	test done test ${HOME} /usr/bin --verbose
+	awk local local | /usr/bin test then /usr/bin | readonly "$1" 'quoted text'
+		test ${HOME} echo done awk "$1" ${HOME} && done echo
+		local local export && echo cd /usr/bin "$@" --verbose
+		grep $(pwd) "$1" echo /usr/bin "$@" echo cd "$@" x=1 "$1" cd --verbose "$1"
+		cd --verbose test done printf test export /usr/bin | "$@" 2>/dev/null
+		2>/dev/null then && --verbose x=1 /usr/bin
+	readonly printf x=1 echo echo local export 'quoted text'
+	sed test cd readonly done /usr/bin -eu awk then $(pwd) awk $(pwd) export
+	&& --verbose /usr/bin echo local cd 'quoted text' "$1" --verbose
+		'quoted text' -eu && --verbose local readonly --verbose printf export echo 2>/dev/null
+$(pwd) --verbose then awk done awk grep done awk echo local
+	"$1" "$@" x=1 -eu x=1 awk echo export echo readonly &&
+		awk test cd echo done awk sed 2>/dev/null
+	sed --verbose sed --verbose /usr/bin $(pwd) "$1" $(pwd) readonly
+/usr/bin then awk then "$1" | test awk then /usr/bin && done $(pwd)
+	&& cd done printf 2>/dev/null echo $(pwd) $(pwd) x=1 printf | done
+--verbose | export x=1 local then "$1" printf --verbose | done "$1" cd x=1
+		grep 2>/dev/null done | -eu "$@"
+	sed printf export | "$@" awk readonly x=1 readonly then test 2>/dev/null
+	/usr/bin --verbose | sed ${HOME}
+echo /usr/bin x=1 readonly ${HOME}
+test 2>/dev/null ${HOME} awk /usr/bin "$1" export grep done "$@" sed done 'quoted text'
+	echo cd "$1" | /usr/bin ${HOME} -eu export test printf x=1 /usr/bin
+	cd local x=1 done sed printf "$@" 2>/dev/null | readonly cd echo sed echo
+		/usr/bin $(pwd) cd $(pwd)
+		then --verbose && | --verbose 2>/dev/null $(pwd) $(pwd) 2>/dev/null local test echo
+		"$@" grep --verbose --verbose 2>/dev/null /usr/bin
+		'quoted text' done cd /usr/bin awk cd readonly -eu grep | x=1 printf && 'quoted text'
+| "$1" then x=1 2>/dev/null
+	x=1 "$@" local /usr/bin | local /usr/bin /usr/bin 2>/dev/null awk 2>/dev/null
+"$@" /usr/bin "$@" "$1" --verbose "$@" x=1 cd "$1" $(pwd)
+	readonly 2>/dev/null echo export | awk && awk then done 'quoted text'
+		&& echo && "$@" test -eu awk && x=1 printf test
+	then cd -eu cd export grep
+		| done /usr/bin echo readonly
+		/usr/bin ${HOME} x=1 ${HOME} && x=1 sed "$@" && done
+	--verbose /usr/bin echo
+done --verbose export "$1" sed awk test $(pwd) printf $(pwd) sed ${HOME}
+done "$1" "$1" ${HOME} | export 'quoted text' -eu --verbose done --verbose /usr/bin
+	cd "$@" "$@" then cd | local $(pwd) | --verbose echo local "$@" ${HOME} 2>/dev/null
+echo then sed $(pwd) cd export cd test "$@" 'quoted text'
+--verbose 2>/dev/null readonly /usr/bin --verbose local x=1 ${HOME} ${HOME}
+		test && cd 2>/dev/null readonly local echo cd /usr/bin echo
+echo --verbose then ${HOME} x=1 ${HOME} cd awk
+		'quoted text' done | local done printf then x=1 2>/dev/null
+echo grep readonly ${HOME} | sed
+	done "$1" local cd readonly
+	done done cd /usr/bin -eu test export ${HOME} -eu sed echo
+		x=1 "$1" test /usr/bin local grep 2>/dev/null
+	'quoted text' cd && $(pwd) | sed local x=1 cd | -eu done
+		then local && readonly sed echo
+export grep export export "$1" &&
+'quoted text' -eu /usr/bin | then 'quoted text' grep -eu local
+	2>/dev/null $(pwd) test $(pwd) "$1" printf && readonly done -eu --verbose
+/usr/bin /usr/bin -eu && -eu done 2>/dev/null ${HOME} test
+		--verbose $(pwd) done test printf test export "$1" then local "$1"
+		/usr/bin cd "$@" "$1" $(pwd) done readonly
+		test $(pwd) /usr/bin --verbose
+export grep local -eu /usr/bin
+	awk /usr/bin "$@" sed export grep grep 'quoted text' --verbose echo
+done -eu -eu grep cd sed --verbose x=1 'quoted text' x=1 grep readonly
+	echo "$1" | "$1" "$@" local 2>/dev/null readonly $(pwd) local "$@" 2>/dev/null
+'quoted text' ${HOME} 'quoted text'
+"$@" grep sed test then printf readonly -eu /usr/bin
+		'quoted text' && && readonly 'quoted text'
+		then echo | -eu "$@" done awk sed /usr/bin | done
+	${HOME} ${HOME} test && "$1" /usr/bin
+2>/dev/null "$@" 2>/dev/null cd cd echo printf 2>/dev/null export "$@" readonly
+"$1" export local cd export 2>/dev/null
+	awk sed export x=1 then cd grep ${HOME} ${HOME}
+	test | grep && -eu grep && local -eu && grep "$@" then then 2>/dev/null
+"$1" && export awk test then "$1" "$@" ${HOME} echo
+	cd -eu grep | awk sed readonly echo | grep "$@" && grep awk 'quoted text' "$@"
+	--verbose readonly cd &&
+readonly $(pwd) 'quoted text' readonly 'quoted text'
+then readonly test awk cd local export readonly sed $(pwd) done sed local then
+		2>/dev/null $(pwd) readonly "$1" local then 'quoted text'
+	| --verbose export sed local 'quoted text' x=1 2>/dev/null
+		sed sed --verbose "$@" printf 'quoted text' echo sed done
+sed /usr/bin /usr/bin && -eu grep
+		-eu test export x=1 then export test
+		-eu /usr/bin grep sed awk printf done $(pwd) --verbose "$1"
+		"$1" test readonly printf done && --verbose
+"$1" 2>/dev/null export awk cd export then printf sed && ${HOME} "$@" sed cd
+	then local "$@" /usr/bin echo | cd
+	$(pwd) --verbose local awk printf done "$1"
+	--verbose readonly printf sed /usr/bin "$1" | "$1" cd --verbose "$1" -eu grep
+test done 'quoted text' x=1 "$@" ${HOME}
+		$(pwd) echo /usr/bin | 2>/dev/null -eu /usr/bin | grep
+	then && then export cd cd && $(pwd) x=1 ${HOME} | "$@" ${HOME} echo --verbose
+awk then /usr/bin printf 2>/dev/null /usr/bin export sed && 2>/dev/null readonly
+		printf --verbose x=1 then sed ${HOME} test printf
+	then x=1 then 2>/dev/null | sed done $(pwd) echo x=1 /usr/bin "$@" $(pwd)
+		readonly sed awk x=1 --verbose 'quoted text' local readonly local
+		cd "$@" done -eu local awk | grep awk awk --verbose then && "$@"
+	test && readonly cd local | printf -eu cd "$@" awk then /usr/bin
+	/usr/bin readonly grep cd grep test 2>/dev/null 'quoted text' x=1 readonly 2>/dev/null
+	2>/dev/null ${HOME} cd | local export test readonly $(pwd)
+	awk cd -eu done cd 2>/dev/null cd awk awk /usr/bin |
+	cd /usr/bin x=1 echo x=1 grep
+x=1 && then --verbose cd grep test -eu grep $(pwd) --verbose test &&
+	then 2>/dev/null readonly echo --verbose 'quoted text'
+		printf && echo cd echo --verbose sed cd | -eu awk local x=1 local &&
+2>/dev/null && "$@" /usr/bin then
+done -eu -eu | x=1 'quoted text' done 2>/dev/null
+		${HOME} printf echo -eu then awk local done 'quoted text' $(pwd) -eu test
+		'quoted text' awk -eu grep awk cd awk 2>/dev/null
+		--verbose cd /usr/bin && x=1 2>/dev/null
+		sed $(pwd) 2>/dev/null $(pwd) && 2>/dev/null printf "$@" echo -eu
+grep ${HOME} | && export
+echo then | x=1 test grep test /usr/bin then sed echo --verbose
+$(pwd) ${HOME} 'quoted text' cd | ${HOME} done local local grep
+		sed export /usr/bin x=1 echo then 2>/dev/null "$@"
+		done -eu awk export && 2>/dev/null
+awk ${HOME} printf x=1 local 2>/dev/null done awk 'quoted text'
+		echo /usr/bin grep cd 'quoted text'
+/usr/bin "$@" "$1" ${HOME} awk 2>/dev/null cd then && && then awk sed cd export
+	-eu done awk readonly 'quoted text'
+&& "$@" then $(pwd) printf | sed | --verbose 'quoted text'
+$(pwd) readonly 2>/dev/null export --verbose grep awk $(pwd)
+		readonly 2>/dev/null echo then awk --verbose
+	awk done x=1 | done | export echo test | | $(pwd) "$@"
+		$(pwd) "$@" grep && /usr/bin
+	echo && sed ${HOME} readonly export $(pwd) && /usr/bin export
+	${HOME} $(pwd) x=1 "$@" readonly export readonly
+grep echo "$1" printf sed export
+		test "$@" awk 2>/dev/null grep then printf export x=1 awk export awk
+	done --verbose && ${HOME} 2>/dev/null
+	cd export printf "$@" "$1" -eu awk local grep
+		grep cd grep readonly done then && --verbose "$1" cd done readonly
+	cd awk readonly local "$1" && $(pwd) 2>/dev/null grep | --verbose
+		printf 2>/dev/null --verbose
+		"$@" printf $(pwd) --verbose
+		x=1 /usr/bin export | grep cd "$@" "$1"
+echo x=1 local "$@" && --verbose 'quoted text'
+	printf sed awk done export ${HOME} 2>/dev/null
+	x=1 printf && --verbose awk sed export
+		grep local echo printf printf ${HOME} readonly
+		readonly printf printf done echo "$1" local "$1" 'quoted text'
+--verbose local export local $(pwd) export
+	done then cd "$1" grep grep test $(pwd) test cd readonly echo $(pwd) test -eu
+		x=1 export printf | grep awk export 2>/dev/null | "$1" local --verbose
+	local ${HOME} /usr/bin export readonly local echo 'quoted text'
+| | /usr/bin | test local
+awk awk local -eu --verbose awk export test 'quoted text' grep "$1" local
+-eu | "$@" -eu sed done done printf x=1 x=1
+		| echo then export $(pwd) awk "$1" && readonly ${HOME} test
+printf readonly | sed "$@" 2>/dev/null x=1 test echo ${HOME}
+		echo x=1 'quoted text' awk --verbose echo readonly test
+		--verbose test printf echo test sed 'quoted text' then "$@" printf
+		/usr/bin test readonly /usr/bin "$@" /usr/bin awk --verbose "$@"
+		$(pwd) -eu "$1" "$1" "$1" && done "$@" readonly then "$@" && "$@" --verbose grep
+	test $(pwd) awk echo /usr/bin --verbose "$1" test | sed $(pwd) export then
+		-eu --verbose local test /usr/bin "$@" printf "$1" -eu awk -eu -eu
+		done --verbose printf awk --verbose
+x=1 local printf then readonly | ${HOME}
+	${HOME} local /usr/bin
+	readonly local "$1" done readonly && 2>/dev/null /usr/bin | --verbose
+		readonly --verbose /usr/bin sed x=1 export && readonly readonly
+test then echo -eu cd
+/usr/bin printf 'quoted text' export export echo $(pwd) export sed grep readonly
+cd 2>/dev/null --verbose | 2>/dev/null local -eu && done echo
+done then printf --verbose sed 2>/dev/null 2>/dev/null /usr/bin readonly
+done && && -eu 'quoted text' grep printf |
+done local export printf then 'quoted text' | "$@" | x=1 $(pwd) grep
+		cd local $(pwd) sed awk -eu export x=1 && sed | test export done
+	echo && test printf test x=1 readonly "$@"
+done && | 2>/dev/null printf | cd test $(pwd) "$@" $(pwd) ${HOME} echo
+	done "$1" echo grep | $(pwd)
+/usr/bin export done grep && $(pwd) | | --verbose then ${HOME} --verbose readonly
+	x=1 grep | sed 2>/dev/null
+/usr/bin test echo 'quoted text'
+	$(pwd) /usr/bin x=1 export -eu 2>/dev/null echo /usr/bin
+		"$1" --verbose export x=1
+cd grep echo local x=1 $(pwd) | then cd readonly
+		done | readonly 'quoted text' $(pwd)
+local 'quoted text' sed then 'quoted text'
+	awk -eu -eu ${HOME} then /usr/bin $(pwd) && echo grep test "$1" x=1 then 2>/dev/null
+		-eu && sed export 'quoted text' "$@" | "$@" | ${HOME} 'quoted text'
+	-eu | sed "$@" 'quoted text' sed sed grep
+		"$@" | readonly then export
+		${HOME} echo --verbose done --verbose "$@"
+	printf x=1 cd /usr/bin 'quoted text'
+$(pwd) "$@" 'quoted text'
+	local 2>/dev/null "$@" 2>/dev/null awk && --verbose -eu $(pwd) echo && ${HOME}
+	export ${HOME} readonly export readonly test done 'quoted text'
+	${HOME} done cd export printf 2>/dev/null $(pwd) printf
+	'quoted text' 'quoted text' local echo $(pwd) awk
+		export x=1 "$1" grep --verbose export
+	grep && && then grep grep | awk -eu ${HOME} awk awk /usr/bin -eu then awk sed readonly
+grep ${HOME} && awk "$@" && ${HOME} 2>/dev/null done && awk /usr/bin -eu
+	| local cd $(pwd) $(pwd) grep $(pwd) --verbose local $(pwd) 'quoted text' -eu
+export --verbose grep grep test "$@" grep local then export export /usr/bin grep
+export /usr/bin "$@" awk /usr/bin -eu /usr/bin ${HOME} then
+sed --verbose -eu sed "$1" echo && | done --verbose --verbose x=1 cd then printf
+local "$1" /usr/bin done --verbose test grep echo "$1" "$1"
+	| cd sed sed | sed | "$@" /usr/bin awk printf 'quoted text' /usr/bin
+	grep --verbose x=1 --verbose x=1 -eu readonly -eu 'quoted text' /usr/bin echo printf
+/usr/bin test export && printf test | printf readonly
+		awk 2>/dev/null echo cd | awk printf done printf "$1" export
+	sed awk grep done -eu local readonly 'quoted text' x=1 | $(pwd) ${HOME} $(pwd)
+"$@" done awk export ${HOME} readonly cd readonly cd /usr/bin |
+		printf 'quoted text' && && export local test export
+		test awk x=1 2>/dev/null readonly readonly grep awk /usr/bin done
+awk ${HOME} -eu awk readonly printf cd done awk echo 'quoted text'
+	/usr/bin then export ${HOME} -eu "$1" echo awk /usr/bin -eu "$1" "$1" /usr/bin
+		&& | 2>/dev/null && --verbose $(pwd) then
+	export awk /usr/bin sed export
+	then export readonly "$1" /usr/bin printf done printf grep /usr/bin cd printf
+		x=1 readonly | done awk test "$1" readonly sed sed "$1" awk $(pwd) grep 2>/dev/null
+	| && done | 'quoted text' sed
+	$(pwd) && "$1" readonly readonly x=1 x=1 echo
+		sed --verbose sed test
+&& echo local echo ${HOME} readonly /usr/bin $(pwd)
+		"$@" "$@" --verbose 'quoted text' readonly
+		"$@" local --verbose --verbose local $(pwd) "$1" echo then export --verbose printf
+printf printf done ${HOME}
+		echo "$@" sed /usr/bin local readonly | cd grep printf 'quoted text'
+		"$1" local then local cd printf cd done grep cd local then
+readonly cd readonly 'quoted text' sed "$1" echo
+		2>/dev/null test sed export --verbose 2>/dev/null $(pwd)
+"$1" readonly echo then "$1" cd $(pwd) 2>/dev/null echo grep grep 2>/dev/null
+		--verbose local && printf ${HOME} cd readonly ${HOME} cd grep echo
+		export cd /usr/bin test x=1 'quoted text' export echo
+		$(pwd) -eu readonly 2>/dev/null -eu readonly x=1 'quoted text'
+printf | ${HOME} awk ${HOME} |
+	test && 'quoted text' then && $(pwd)
+	echo 2>/dev/null | readonly
+	"$1" then awk x=1 then
+		cd 'quoted text' | 'quoted text' $(pwd) --verbose test
+		awk -eu grep $(pwd) $(pwd) ${HOME} sed then ${HOME} done $(pwd) then cd test
+	'quoted text' x=1 awk | then export test export x=1 sed awk | "$@" $(pwd) echo
+		then printf awk | test sed ${HOME} && --verbose | /usr/bin /usr/bin sed
+		2>/dev/null printf -eu "$@" "$@" echo
+cd echo "$1" echo --verbose cd ${HOME} "$@" "$1" awk ${HOME} echo
+		'quoted text' cd 2>/dev/null 2>/dev/null local /usr/bin
+	"$@" 'quoted text' then grep readonly grep then
+		--verbose "$1" export awk "$@"
+	cd 2>/dev/null then x=1 done test | then sed cd echo local ${HOME} --verbose
+	"$1" "$@" -eu done printf awk | 'quoted text'
+	sed -eu sed echo ${HOME} grep /usr/bin -eu --verbose $(pwd) /usr/bin && cd local
+		cd local test /usr/bin | 2>/dev/null printf done 2>/dev/null
+	then -eu then 'quoted text' --verbose test awk sed "$@" "$@" 'quoted text'
+${HOME} x=1 ${HOME} sed local test local awk printf
+		grep done /usr/bin -eu ${HOME} readonly echo /usr/bin awk
+printf "$1" 'quoted text' -eu printf printf export awk $(pwd)
+		export readonly then done --verbose
+	/usr/bin ${HOME} 'quoted text' readonly
+"$1" sed awk test ${HOME} 2>/dev/null
+		export "$1" 'quoted text' cd
+		'quoted text' echo x=1
+/usr/bin $(pwd) && --verbose "$1"
+| awk /usr/bin export printf "$1"
+grep then --verbose 2>/dev/null done && x=1 $(pwd) test 2>/dev/null echo
+		echo then x=1 && -eu x=1 |
+printf $(pwd) cd done test -eu grep "$1" "$1" x=1 sed test
+	export "$@" /usr/bin "$@" readonly sed done grep export x=1 done grep
+	grep --verbose "$@" done sed readonly readonly printf ${HOME}
+		2>/dev/null x=1 x=1 done
+	readonly "$@" done ${HOME} "$1" cd x=1 /usr/bin test 'quoted text'
+	printf | | 'quoted text' "$1" local 2>/dev/null "$@" awk ${HOME} printf
+	readonly sed -eu echo test
+local local && | $(pwd) | local x=1 done | done
+	echo $(pwd) done grep ${HOME} cd awk
+/usr/bin --verbose $(pwd) /usr/bin 'quoted text'
+		then grep done cd "$1" --verbose "$1" 2>/dev/null
+		2>/dev/null printf -eu then cd
+local && awk readonly done done /usr/bin readonly then "$1"
+sed awk awk sed sed export echo && && -eu awk
+		printf $(pwd) ${HOME} export sed grep 'quoted text' --verbose -eu | x=1 2>/dev/null
+	/usr/bin 'quoted text' "$@" | local export
+		readonly awk echo ${HOME} local |
+		awk 'quoted text' -eu 2>/dev/null -eu local "$1"
+printf -eu export $(pwd)
+readonly local grep grep local readonly
+	| 2>/dev/null grep "$@" /usr/bin "$1" local sed 'quoted text' "$@" done
+awk $(pwd) then grep test cd && export export x=1 sed export test --verbose -eu
+		| readonly --verbose export "$@" --verbose ${HOME} x=1 awk /usr/bin 2>/dev/null
+		--verbose x=1 x=1 local ${HOME} 2>/dev/null 'quoted text'
+export test --verbose done echo
+	grep grep awk test then done done "$@" --verbose
+		printf 2>/dev/null $(pwd) echo && echo && | test
+readonly $(pwd) --verbose 'quoted text'
+	sed grep cd | 2>/dev/null --verbose "$1" cd |
+	2>/dev/null local done grep
+	printf printf done awk 2>/dev/null "$@" /usr/bin
+	--verbose -eu local readonly sed /usr/bin
+test printf local x=1 done echo ${HOME} -eu then local ${HOME} done && done
+	2>/dev/null --verbose grep --verbose --verbose ${HOME}
@@ -0,0 +1,2001 @@
+		$(pwd) awk "$1" local then done then 2>/dev/null grep /usr/bin
+	local ${HOME} test echo "$1" printf done -eu $(pwd) $(pwd) /usr/bin
+	--verbose 'quoted text' "$@" awk test 2>/dev/null
+sed && $(pwd) $(pwd) --verbose $(pwd) sed && export
+readonly $(pwd) echo ${HOME} "$1" $(pwd) awk x=1 done awk sed printf
+	| done 'quoted text' printf sed | local grep $(pwd) done --verbose test
+		printf sed "$@" "$@" "$@" done 2>/dev/null /usr/bin readonly && sed printf
+printf 'quoted text' --verbose awk && | "$1"
+	-eu 'quoted text' export x=1 x=1 cd done echo sed "$1" test
+		printf export x=1 sed 2>/dev/null readonly then readonly /usr/bin printf "$@"
+	'quoted text' x=1 done "$1" /usr/bin sed
+x=1 then ${HOME} | x=1 -eu awk local sed sed local --verbose "$@"
+	readonly ${HOME} done 'quoted text' done -eu then --verbose done
+	export local "$1" 'quoted text' local -eu
+		$(pwd) x=1 "$1" readonly awk "$1" cd
+--verbose --verbose cd export done --verbose ${HOME}
+| ${HOME} readonly /usr/bin && test test
+"$1" && x=1 then done then done test done export test $(pwd)
+	"$1" "$@" awk 2>/dev/null printf
+		${HOME} done | $(pwd) | test
+		test awk grep /usr/bin done 'quoted text' 'quoted text' local
+readonly echo export cd 'quoted text'
+		done && && 2>/dev/null printf
+then cd "$1" grep test x=1 "$1" awk "$@" | --verbose
+readonly --verbose local
+	done echo readonly 'quoted text'
+	local cd 'quoted text' "$@" "$@" 'quoted text' grep ${HOME} && export readonly
+		done "$1" grep "$@" "$1" ${HOME}
+2>/dev/null && awk echo "$@" test "$1" grep echo cd sed "$@" grep
+	/usr/bin -eu awk | 'quoted text' sed done -eu && x=1 ${HOME}
+		'quoted text' /usr/bin ${HOME} then test grep /usr/bin x=1 echo
+	test 2>/dev/null then --verbose export | local
+done cd --verbose /usr/bin awk
+	grep ${HOME} "$1" cd "$@" cd x=1 /usr/bin sed && readonly then x=1
+sed export "$@" 2>/dev/null printf echo cd then local
+local local 'quoted text' echo then grep printf readonly
+'quoted text' ${HOME}
+done then 'quoted text'
+		export --verbose -eu then 'quoted text' cd "$1" awk test -eu printf && &&
+export 2>/dev/null cd printf | /usr/bin 2>/dev/null
+grep -eu export test "$@" /usr/bin -eu sed | grep sed -eu awk test
+		| test export 'quoted text' done echo then sed done sed grep grep awk printf
+		"$1" 2>/dev/null done -eu echo "$1"
+		local ${HOME} test printf local local
+export done 2>/dev/null sed
+	x=1 'quoted text' echo x=1 "$@"
+$(pwd) x=1 then "$@" "$@" sed "$1" sed printf
+		"$@" | && 2>/dev/null 2>/dev/null
+local ${HOME} x=1 x=1 'quoted text' then 2>/dev/null
+	export --verbose x=1 -eu | -eu sed printf export
+2>/dev/null printf test
+		"$1" done -eu then grep /usr/bin "$1" "$1" sed cd
+	-eu && test local then -eu local && sed 'quoted text'
+		then local "$1" ${HOME} readonly && test 'quoted text' then awk
+"$@" "$1" printf 2>/dev/null printf
+	'quoted text' && grep done && ${HOME} "$1" x=1
+	export local $(pwd) -eu sed done -eu |
+	awk ${HOME} && x=1 -eu --verbose sed
+	2>/dev/null x=1 ${HOME} awk readonly 'quoted text' readonly | echo sed printf
+	--verbose && 2>/dev/null
+echo 2>/dev/null -eu --verbose 'quoted text' test -eu
+grep test printf "$1" "$1" grep -eu x=1
+	2>/dev/null awk local 'quoted text' | /usr/bin
+		| local -eu then $(pwd) test
+--verbose --verbose $(pwd) 'quoted text' test -eu "$@" $(pwd)
+	local then 'quoted text' cd local x=1 "$1" echo cd readonly
+echo $(pwd) "$1" --verbose then sed test test printf $(pwd)
+	local export ${HOME} local "$1" sed echo cd $(pwd) export export sed
+	sed | ${HOME} | sed sed "$1" /usr/bin
+		cd cd cd sed x=1 export --verbose awk | echo && local local "$1" echo done
+	x=1 | done then printf x=1 awk readonly then printf local grep printf done
+		&& && echo awk $(pwd) awk then cd | "$@" done done /usr/bin
+		"$@" sed export 'quoted text' done --verbose $(pwd)
+		-eu echo grep --verbose --verbose then then 'quoted text' grep
+		awk x=1 local then echo awk "$1" "$@" test "$@" --verbose
+		cd 2>/dev/null grep echo cd x=1 | grep $(pwd) done && 2>/dev/null 'quoted text'
+		'quoted text' cd readonly && --verbose ${HOME} | "$1" readonly x=1 sed
+-eu x=1 readonly /usr/bin
+	then ${HOME} 'quoted text'
+		&& /usr/bin 2>/dev/null readonly echo $(pwd)
+	export x=1 --verbose --verbose cd -eu echo -eu sed test echo "$1" cd
+		readonly $(pwd) done done
+		x=1 readonly cd local ${HOME} -eu test local 2>/dev/null
+2>/dev/null "$1" "$@" grep readonly sed
+		grep awk ${HOME} echo "$1" local cd test done grep -eu 2>/dev/null
+cd then 'quoted text' printf readonly grep awk $(pwd)
+		sed --verbose && grep sed export "$@" /usr/bin --verbose
+	grep "$@" $(pwd) printf then "$1" export ${HOME} --verbose awk && done
+x=1 2>/dev/null $(pwd)
+		printf sed sed echo local ${HOME} done --verbose local done
+		$(pwd) grep test x=1 'quoted text' awk then printf
+		cd local export $(pwd) local x=1 test
+	2>/dev/null cd ${HOME} local /usr/bin --verbose x=1 $(pwd) &&
+	-eu x=1 && sed test ${HOME} done then grep echo --verbose printf
+awk grep test ${HOME} "$@" printf 'quoted text'
+		--verbose ${HOME} printf echo --verbose "$1" echo grep export
+$(pwd) local sed 2>/dev/null --verbose readonly local
+		2>/dev/null x=1 x=1 awk | sed sed grep done cd grep | done echo "$@" "$1" test export
+	$(pwd) 'quoted text' && sed cd
+	printf echo | && grep && cd done printf 2>/dev/null -eu "$1" /usr/bin done && &&
+	readonly done echo $(pwd) 2>/dev/null then x=1 sed && 'quoted text'
+echo "$@" | awk "$@" done -eu awk then "$@" 'quoted text' ${HOME} | x=1 sed ${HOME}
+	2>/dev/null $(pwd) printf "$1" --verbose | x=1 'quoted text' | readonly grep done
+		sed awk 'quoted text' printf -eu
+		local 'quoted text' && x=1 --verbose ${HOME} "$@" x=1 awk 2>/dev/null -eu
+		"$@" 'quoted text' printf
+	x=1 cd local local sed && printf
+		awk printf readonly x=1 printf done /usr/bin local "$1" echo echo test
+then x=1 readonly readonly ${HOME} && readonly export echo readonly readonly
+		2>/dev/null 'quoted text' printf -eu 2>/dev/null
+	-eu printf cd 'quoted text' readonly
+	"$@" 'quoted text' readonly export ${HOME} done
+		-eu local awk "$@" awk cd export ${HOME} test then | 2>/dev/null
+		"$1" && awk sed awk -eu ${HOME} printf
+${HOME} -eu | grep | -eu "$@" awk sed export "$1" -eu sed ${HOME}
+		readonly readonly cd 2>/dev/null local x=1 awk ${HOME} awk
+		export | local --verbose
+		grep printf ${HOME} "$@" 2>/dev/null 2>/dev/null -eu | done
+	printf | /usr/bin ${HOME} x=1 2>/dev/null
+		--verbose "$1" local readonly && && printf
+x=1 sed "$1" readonly export
+${HOME} done $(pwd) "$1" /usr/bin $(pwd) 'quoted text'
+| export then 2>/dev/null --verbose printf
+		| "$1" sed x=1 $(pwd) sed then cd done --verbose $(pwd) |
+	${HOME} echo done test --verbose export 2>/dev/null "$1" -eu test awk printf
+&& then test -eu && ${HOME} grep -eu 'quoted text' 'quoted text' -eu /usr/bin
+export -eu 2>/dev/null "$@" printf "$@" /usr/bin
+		--verbose && $(pwd) then /usr/bin sed && 'quoted text' -eu readonly sed
+		/usr/bin sed 2>/dev/null --verbose $(pwd) test cd
+"$1" 'quoted text' grep export x=1 -eu /usr/bin
+	/usr/bin sed $(pwd) "$@" "$1" -eu "$@"
+		done then 'quoted text' -eu /usr/bin
+cd local -eu export test --verbose && then
+| done grep "$@" -eu ${HOME} -eu /usr/bin echo
+	cd -eu --verbose export && ${HOME}
+	test /usr/bin x=1 /usr/bin
+		then 2>/dev/null 2>/dev/null | $(pwd) "$@" ${HOME} printf && 'quoted text' --verbose
+printf 2>/dev/null 2>/dev/null awk sed x=1 printf
+		/usr/bin "$@" -eu sed "$@" awk -eu
+echo --verbose readonly ${HOME} x=1 sed readonly $(pwd) | awk export 2>/dev/null
+$(pwd) done echo readonly local grep ${HOME} ${HOME}
+		then /usr/bin then | test /usr/bin
+	/usr/bin | readonly local cd printf ${HOME} export export | x=1 | ${HOME}
+	$(pwd) printf echo x=1 awk readonly
+grep $(pwd) export then "$@" local readonly readonly &&
+		done local && x=1 awk sed --verbose
+		/usr/bin then local then echo
+	$(pwd) grep then export --verbose done printf export "$@" awk test local echo
+		sed /usr/bin "$@" /usr/bin local "$1" then then local done $(pwd) awk
+	'quoted text' awk awk 2>/dev/null printf then printf && "$@"
+		local "$@" local "$@" "$@" cd printf x=1 && /usr/bin local sed
+	-eu echo awk $(pwd) echo readonly export then && "$@" --verbose
+		then 2>/dev/null then readonly echo done
+		awk export cd $(pwd) 'quoted text'
+x=1 awk local then done -eu "$@" export printf $(pwd)
+${HOME} x=1 grep done test "$@" echo then then "$@" --verbose "$@" | --verbose
+		done cd 2>/dev/null sed grep local -eu sed test cd -eu 'quoted text'
+test $(pwd) && done 'quoted text'
+		"$@" echo ${HOME} | printf awk done sed 'quoted text' x=1 grep readonly $(pwd)
+	export awk ${HOME} then then "$1" test done --verbose sed awk "$1" "$@"
+cd readonly "$@" "$1" printf 'quoted text' printf echo cd cd printf printf
+		grep 'quoted text' local
+	export echo done done /usr/bin 2>/dev/null echo | -eu done
+		export ${HOME} /usr/bin grep awk done printf "$@" export echo && $(pwd) sed
+		"$1" --verbose $(pwd) "$1" printf local readonly local
+		| -eu --verbose export $(pwd) test test cd done done && cd | done /usr/bin | printf
+test done x=1 cd local then printf export $(pwd) && export
+		awk awk "$1" cd done x=1 "$1" "$1" awk
+		readonly "$1" ${HOME} "$1" x=1 grep "$1" local $(pwd) test && -eu test awk "$1"
+	cd "$1" && "$1" test printf "$1" test export export
+	local --verbose --verbose ${HOME} local local "$@" readonly 2>/dev/null
+grep done x=1 /usr/bin 2>/dev/null && 'quoted text' export grep printf
+	'quoted text' readonly printf "$@" then | export echo 2>/dev/null
+	echo done --verbose "$@" echo /usr/bin
+		then grep local echo 2>/dev/null done
+$(pwd) $(pwd) | then echo printf
+		${HOME} "$1" x=1 printf local echo "$@" export /usr/bin
+'quoted text' -eu $(pwd) readonly done readonly grep echo 2>/dev/null
+		'quoted text' readonly --verbose
+		then readonly 'quoted text' grep --verbose awk "$1" --verbose 'quoted text'
+		then /usr/bin 'quoted text' test --verbose echo "$@" awk sed cd readonly cd &&
+		sed done x=1 | --verbose printf
+	'quoted text' -eu cd sed echo export test grep printf
+	done local $(pwd) 'quoted text' sed -eu
+"$1" grep sed grep "$@" 2>/dev/null local done $(pwd) ${HOME} echo $(pwd)
+	'quoted text' 'quoted text'
+		test /usr/bin 'quoted text' --verbose echo "$@" echo printf
+	cd --verbose "$@" export test readonly readonly
+	$(pwd) awk test 'quoted text'
+		--verbose readonly test done echo then && printf ${HOME} x=1 && x=1
+"$@" x=1 done cd done echo $(pwd) echo awk
+		-eu echo | $(pwd) done | "$1" && $(pwd) printf 2>/dev/null $(pwd)
+		then $(pwd) then local x=1 /usr/bin 'quoted text'
+grep printf "$@" 'quoted text'
+&& | 'quoted text' grep done -eu test -eu export && printf
+		readonly awk ${HOME} echo
+	local local then $(pwd) done 2>/dev/null
+	awk | cd ${HOME} 2>/dev/null grep -eu ${HOME} grep printf awk
+		local test -eu printf echo printf 2>/dev/null echo cd /usr/bin
+	${HOME} export local printf grep ${HOME}
+		"$1" "$1" awk test && awk /usr/bin --verbose /usr/bin cd /usr/bin
+x=1 "$@" cd grep sed --verbose done then x=1 sed sed
+		/usr/bin ${HOME} export printf $(pwd) -eu readonly
+		2>/dev/null cd "$@" "$1" | x=1 x=1 /usr/bin sed cd ${HOME} printf
+'quoted text' cd awk test x=1 x=1 | -eu awk 'quoted text' /usr/bin
+	test ${HOME} --verbose | grep -eu done $(pwd) && sed done
+x=1 done readonly && --verbose grep sed | printf "$@" -eu cd echo 'quoted text'
+	x=1 cd printf 2>/dev/null -eu readonly -eu done 2>/dev/null x=1 ${HOME}
+-eu echo ${HOME} | ${HOME}
+${HOME} grep --verbose then -eu /usr/bin
+done export done readonly | test grep $(pwd) cd echo --verbose "$1" 2>/dev/null
+then 'quoted text' cd then 2>/dev/null
+	-eu awk echo test $(pwd) "$@" x=1
+		done cd cd && test export $(pwd) $(pwd) 'quoted text'
+		${HOME} && "$1" && 2>/dev/null export ${HOME} && 'quoted text'
+printf && sed --verbose
+done local -eu grep 'quoted text' test awk -eu -eu grep $(pwd)
+	readonly echo then local 'quoted text' && done grep sed then 2>/dev/null
+then readonly test sed && --verbose
+	${HOME} $(pwd) awk printf --verbose 'quoted text' "$1" 'quoted text' /usr/bin
+export ${HOME} done &&
+		x=1 awk && "$@" cd test printf
+	readonly 2>/dev/null | "$1" then &&
+local readonly test local ${HOME} $(pwd)
+		done 2>/dev/null -eu x=1 ${HOME}
+		export awk export $(pwd) echo sed local awk --verbose 2>/dev/null export
+	sed /usr/bin "$@" && 'quoted text' ${HOME} "$1" cd $(pwd) sed done
+readonly echo sed export
+"$1" printf --verbose "$1" "$@" && sed export "$@" echo "$1" -eu
+	-eu done sed export echo printf done x=1 test "$1" "$1" awk && x=1 "$1"
+		'quoted text' ${HOME} -eu printf 'quoted text'
+	/usr/bin local "$@" export "$@" $(pwd) printf
+	sed sed --verbose export then "$1" readonly cd 'quoted text' x=1
+	"$1" $(pwd) -eu "$@" x=1 local $(pwd) ${HOME} 2>/dev/null test 2>/dev/null
+	| export 2>/dev/null -eu "$1" awk -eu && sed test -eu --verbose local
+	"$@" echo --verbose "$1" readonly "$1" echo "$@"
+	-eu x=1 done --verbose
+		grep sed | grep | done x=1 readonly cd x=1 "$@" ${HOME} then "$1"
+		/usr/bin ${HOME} done -eu "$1" "$@" "$@" test x=1 local 'quoted text'
+${HOME} /usr/bin done export local "$@" /usr/bin printf 'quoted text' x=1 -eu /usr/bin
+		local | awk done "$1" local ${HOME} awk printf && && -eu "$1" ${HOME}
+		&& grep local $(pwd) $(pwd) && readonly echo readonly grep "$1" export
+	readonly awk echo "$1" test -eu printf grep /usr/bin
+	--verbose /usr/bin | "$1" local "$1" | test sed x=1 2>/dev/null
+	2>/dev/null 2>/dev/null x=1 -eu && sed
+		$(pwd) 2>/dev/null -eu "$1" export export x=1 ${HOME} cd awk
+awk | /usr/bin ${HOME} then export grep /usr/bin x=1 test done 'quoted text'
+	local $(pwd) echo then awk && 'quoted text' cd /usr/bin
+		test "$1" "$@" --verbose x=1 -eu then "$1" echo --verbose echo 'quoted text'
+		x=1 printf test --verbose echo $(pwd)
+	test printf test $(pwd) /usr/bin
+	-eu awk export readonly ${HOME} grep test "$@" && awk grep -eu 'quoted text'
+		local 2>/dev/null x=1 cd "$1" "$@" --verbose done grep
+	$(pwd) done x=1 printf $(pwd)
+--verbose cd && --verbose grep then printf awk -eu then $(pwd)
+	export 'quoted text' local $(pwd) 2>/dev/null ${HOME}
+"$@" 2>/dev/null ${HOME} "$@" done grep export done awk awk "$@" | local
+	done /usr/bin export test awk echo
+		cd export local export
+		'quoted text' export "$@" local "$@" 'quoted text' readonly && -eu then test export
+		2>/dev/null then grep printf
+		x=1 $(pwd) sed -eu export 2>/dev/null
+readonly -eu 2>/dev/null
+		x=1 sed sed done grep printf x=1 then
+		readonly --verbose $(pwd) export cd
+grep cd /usr/bin local awk
+	${HOME} -eu ${HOME} echo awk --verbose echo 'quoted text' readonly $(pwd)
+		cd awk ${HOME} && readonly "$@" test awk test sed
+local then "$@" local | x=1 then cd local test ${HOME} ${HOME}
+		printf 2>/dev/null then done local awk 'quoted text' awk done
+		-eu "$@" /usr/bin then "$@" grep 'quoted text'
+then && printf && ${HOME} awk
+	-eu local ${HOME} awk && awk readonly test printf local /usr/bin
+		&& 'quoted text' test echo ${HOME} sed export local export export "$1" awk sed 2>/dev/null
+then done -eu | echo x=1 'quoted text' export then $(pwd) then done then x=1 'quoted text'
+	| -eu sed awk ${HOME} test && ${HOME}
+		echo export readonly then awk "$1" 'quoted text' local
+done --verbose -eu grep echo | done readonly sed local then
+	test readonly -eu printf echo 2>/dev/null
+	done ${HOME} ${HOME} "$@" test done local &&
+		"$@" export && $(pwd)
+		printf --verbose "$@" done sed $(pwd) "$1" awk 2>/dev/null
+	sed --verbose printf
+	'quoted text' echo 'quoted text'
+		cd awk readonly && then "$@" printf
+		x=1 -eu then printf 'quoted text'
+		grep -eu sed then local local /usr/bin /usr/bin sed x=1 'quoted text'
+		cd /usr/bin readonly --verbose /usr/bin x=1
+	2>/dev/null cd echo readonly local ${HOME} done 'quoted text' then
+awk "$1" "$1" test x=1 'quoted text' grep "$@" x=1 && && awk readonly awk |
+		--verbose -eu 2>/dev/null done 'quoted text' printf ${HOME}
+test 'quoted text' export
+	printf 2>/dev/null x=1 awk && --verbose readonly "$1" then
+		export printf readonly local x=1 -eu 'quoted text' $(pwd)
+--verbose grep $(pwd) && "$1" export x=1 printf && | $(pwd) "$@"
+readonly 2>/dev/null printf
+	x=1 grep echo readonly
+	x=1 "$@" $(pwd) -eu awk awk /usr/bin $(pwd) --verbose --verbose -eu
+"$@" cd printf sed $(pwd) 2>/dev/null local
+local readonly local $(pwd) test then && --verbose readonly
+		| && then done test "$@" grep && cd export 'quoted text' grep sed x=1 /usr/bin
+	x=1 export 'quoted text' local /usr/bin readonly readonly $(pwd) cd "$@" --verbose
+	then then /usr/bin awk | && && sed "$@" export
+		grep sed test "$@" sed cd "$1" done 2>/dev/null | readonly
+	sed printf "$@" $(pwd) awk x=1 then echo --verbose "$@"
+		printf -eu x=1 done local $(pwd) printf "$@" export
+	sed done /usr/bin /usr/bin awk && printf cd test
+		| "$@" done cd sed grep ${HOME} cd $(pwd) export ${HOME} readonly 'quoted text'
+	"$1" cd grep sed ${HOME} && 'quoted text' echo -eu grep test echo /usr/bin x=1
+	done --verbose /usr/bin echo cd "$1" x=1 'quoted text'
+		2>/dev/null x=1 'quoted text' echo && "$1" --verbose cd readonly awk readonly
+	readonly cd readonly && && --verbose /usr/bin
+	echo --verbose 'quoted text' printf sed export -eu && echo && export then echo
+x=1 test $(pwd) --verbose "$1" /usr/bin ${HOME} printf ${HOME}
+	test --verbose done cd local --verbose x=1 ${HOME} export /usr/bin
+		export && "$1" $(pwd) x=1 readonly awk ${HOME} sed "$1" local "$1" readonly
+	-eu 'quoted text' "$@" printf export export | printf local local then
+	sed && sed 'quoted text' export cd cd local | 2>/dev/null awk
+		| "$@" readonly "$1"
+	done test --verbose && export readonly ${HOME} grep && echo
+		then --verbose local done $(pwd) 2>/dev/null readonly -eu awk export $(pwd)
+	"$@" sed 2>/dev/null "$@" local awk && readonly $(pwd) 2>/dev/null
+${HOME} --verbose "$1" "$1" 2>/dev/null 2>/dev/null then test ${HOME} export
+${HOME} local cd echo /usr/bin "$1" echo | grep "$1" then /usr/bin
+	export "$1" 2>/dev/null export sed cd echo
+	&& && "$@" then $(pwd) $(pwd) echo 'quoted text'
+"$@" /usr/bin local $(pwd) export done awk grep printf 'quoted text'
+then | -eu export sed && readonly printf && local 2>/dev/null $(pwd)
+&& "$1" cd echo awk /usr/bin cd | sed awk echo grep
+		x=1 printf awk test x=1 then
+		echo done "$1" grep grep | -eu awk
+		2>/dev/null test local -eu $(pwd) -eu local local
+		sed echo | | -eu cd test | x=1
+	"$1" 'quoted text' | awk ${HOME} cd printf && --verbose 'quoted text' &&
+		awk test -eu echo x=1 then sed
+		x=1 2>/dev/null sed -eu && export local "$@" "$@" printf 'quoted text'
+/usr/bin && 2>/dev/null "$@" echo $(pwd) | local
+	readonly $(pwd) | x=1 2>/dev/null grep sed local cd
+		"$@" x=1 grep && sed then sed "$@" --verbose awk awk /usr/bin printf
+		${HOME} /usr/bin /usr/bin
+	"$1" local echo echo ${HOME} awk test /usr/bin /usr/bin 'quoted text' awk echo
+		printf x=1 "$@" ${HOME} &&
+'quoted text' cd export done echo sed sed $(pwd) -eu "$1" -eu
+		${HOME} --verbose $(pwd) && 'quoted text' 2>/dev/null ${HOME} sed --verbose
+	/usr/bin "$@" then sed sed "$@" "$1" $(pwd) 'quoted text'
+2>/dev/null 'quoted text'
+		/usr/bin echo grep 'quoted text'
+		export export ${HOME} ${HOME}
+	${HOME} x=1 grep export
+	echo cd ${HOME} --verbose "$@" "$1" test cd x=1 cd done -eu && | && grep $(pwd)
+-eu && ${HOME} $(pwd) x=1 test --verbose
+"$1" sed awk grep "$1" then --verbose | printf -eu export x=1 echo
+	local -eu $(pwd) sed && 'quoted text' | test export | /usr/bin local readonly "$@"
+		${HOME} test then then && then local cd x=1 awk done | && --verbose
+	-eu printf /usr/bin /usr/bin awk x=1 -eu
+		x=1 readonly x=1 then printf
+"$@" "$@" test "$@" export local && local "$1" sed test 2>/dev/null printf echo
+	test export cd sed && sed $(pwd) readonly
+		then "$@" test printf --verbose x=1 local readonly ${HOME}
+export done $(pwd) export $(pwd) && awk grep test 'quoted text'
+	${HOME} grep && "$1" then then cd && cd
+		--verbose printf | /usr/bin ${HOME}
+		export ${HOME} "$@" done
+		echo -eu "$1" $(pwd) 2>/dev/null grep
+${HOME} /usr/bin --verbose export sed echo $(pwd) grep | --verbose then
+		echo readonly -eu test &&
+&& echo -eu "$@" printf $(pwd) x=1 then export --verbose grep x=1 ${HOME} -eu
+test cd --verbose cd grep
+	awk 2>/dev/null local readonly $(pwd) 'quoted text' /usr/bin 2>/dev/null
+-eu $(pwd) x=1 cd "$1" cd -eu $(pwd) | --verbose then -eu 'quoted text' -eu
+-eu awk --verbose test ${HOME} 'quoted text' "$1" 2>/dev/null
+'quoted text' $(pwd) grep awk then echo ${HOME} "$1" /usr/bin | cd readonly |
+awk awk | echo 'quoted text' awk echo readonly "$@" | 'quoted text'
+		--verbose readonly readonly /usr/bin then cd test /usr/bin sed done
+sed readonly ${HOME} done /usr/bin sed export test x=1 && | "$@"
+	| done "$1" grep 'quoted text' /usr/bin x=1 && --verbose grep readonly export
+	test awk export grep ${HOME} sed awk then "$1" done done
+	grep 2>/dev/null $(pwd) export x=1 echo test grep | printf sed awk 2>/dev/null
+	x=1 export 2>/dev/null 2>/dev/null 2>/dev/null --verbose &&
+		test echo ${HOME} --verbose sed
+		local readonly done cd | then -eu echo "$1" 'quoted text' | 'quoted text'
+"$@" then /usr/bin "$1" && x=1 cd local -eu cd readonly "$1" grep $(pwd)
+		x=1 ${HOME} then test /usr/bin sed "$1" awk 2>/dev/null
+	then echo x=1 x=1 readonly grep echo --verbose "$1" "$1" then awk echo echo
+readonly "$@" $(pwd) printf -eu 2>/dev/null
+cd x=1 /usr/bin grep -eu && cd && "$1" -eu readonly | x=1 local test
+&& | ${HOME} then awk grep
+		x=1 2>/dev/null grep echo cd -eu "$@" --verbose awk x=1 $(pwd) echo printf
+		x=1 "$@" then printf grep grep 'quoted text' | cd readonly && awk "$@"
+then grep && -eu --verbose printf awk /usr/bin
+awk grep awk local "$1" export 'quoted text' grep sed grep local sed 'quoted text'
+echo done -eu done --verbose --verbose
+${HOME} --verbose "$1" sed test && sed printf done then export test /usr/bin
+&& "$@" 2>/dev/null /usr/bin --verbose "$1" awk
+		${HOME} 2>/dev/null printf $(pwd)
+readonly x=1 test then done -eu --verbose
+		${HOME} test export echo $(pwd) $(pwd) done printf printf
+-eu printf /usr/bin sed test 2>/dev/null "$@" /usr/bin 'quoted text'
+2>/dev/null 2>/dev/null
+		awk "$@" --verbose readonly
+	printf "$@" readonly ${HOME}
+		awk then local test export "$1" printf
+		"$@" && "$@" local then cd printf readonly | export cd | echo 'quoted text'
+		/usr/bin | local --verbose local cd export |
+	'quoted text' 'quoted text' $(pwd) | $(pwd) $(pwd) test | /usr/bin -eu awk &&
+awk $(pwd) sed && 'quoted text' -eu awk readonly grep --verbose
+	awk --verbose local ${HOME} x=1 sed local $(pwd) export readonly echo sed x=1
+test readonly then -eu ${HOME} cd then -eu --verbose
+--verbose done readonly sed 'quoted text' |
+echo $(pwd) test awk x=1 echo sed -eu
+	cd 2>/dev/null /usr/bin 2>/dev/null printf readonly x=1
+printf awk printf ${HOME} "$1" sed grep "$1" awk x=1 /usr/bin
+		$(pwd) ${HOME} | then export --verbose $(pwd)
+		'quoted text' $(pwd) local test done $(pwd) ${HOME} readonly export --verbose
+	done export && grep readonly echo -eu printf then then 2>/dev/null 2>/dev/null
+	"$@" --verbose /usr/bin done 2>/dev/null "$@" export test ${HOME} -eu /usr/bin |
+		readonly ${HOME} 2>/dev/null && echo x=1 printf cd cd grep local
+		then cd $(pwd) $(pwd) --verbose printf && "$@" --verbose 2>/dev/null --verbose
+		-eu test ${HOME} --verbose x=1 | then
+		sed | && local /usr/bin "$@"
+		test && | grep x=1 --verbose ${HOME} -eu $(pwd) --verbose
+		grep awk | export $(pwd) readonly /usr/bin then ${HOME} local 2>/dev/null
+	done ${HOME} sed "$1" then && && awk | x=1 --verbose
+		'quoted text' awk awk && $(pwd)
+readonly $(pwd) local | then -eu printf printf
+		printf readonly grep -eu grep
+	&& -eu done x=1 sed done export grep local -eu --verbose done printf
+x=1 done test echo --verbose x=1 $(pwd) && cd
+	"$@" printf && x=1 x=1 test done
+-eu && 'quoted text' 2>/dev/null printf --verbose
+awk readonly --verbose x=1
+	awk $(pwd) local && x=1 'quoted text'
+		grep then awk | 2>/dev/null local
+		"$1" printf $(pwd) done "$@" /usr/bin && -eu /usr/bin
+		local --verbose sed done "$@" done
+		"$1" printf sed "$1" export -eu 2>/dev/null
+	x=1 cd export $(pwd) "$@"
+	--verbose | "$@" sed $(pwd) $(pwd)
+		cd x=1 "$@" grep --verbose then | readonly 'quoted text' &&
+	readonly "$1" "$1" x=1 "$@" 2>/dev/null 'quoted text' cd "$@" grep local awk
+then && awk done done printf sed awk local x=1 --verbose
+		then "$1" cd grep "$@" readonly | $(pwd) "$1" $(pwd) 2>/dev/null --verbose
+| readonly done then 'quoted text' $(pwd) awk | $(pwd) grep then cd "$1" cd awk
+	-eu x=1 printf printf local printf 'quoted text' echo -eu -eu &&
+	done export /usr/bin /usr/bin
+		readonly test --verbose | printf /usr/bin x=1
+	x=1 readonly sed x=1 test -eu && local ${HOME} then cd then cd ${HOME}
+grep local local "$@" "$@" printf awk /usr/bin then 2>/dev/null
+		test readonly --verbose ${HOME} |
+	-eu $(pwd) | readonly 2>/dev/null | readonly | local
+x=1 export ${HOME} $(pwd) sed then then $(pwd)
+		2>/dev/null /usr/bin x=1 grep $(pwd) export
+		'quoted text' "$@" $(pwd) grep done "$1" ${HOME}
+		${HOME} then x=1 | echo cd then
+		grep printf && 'quoted text' ${HOME} done printf ${HOME} | cd
+'quoted text' grep local && printf export $(pwd) "$@" "$1" --verbose
+		sed "$1" && "$1" && 2>/dev/null done cd echo --verbose printf
+		"$@" "$@" printf echo echo --verbose sed export x=1 printf && && then "$1" test
+echo test -eu && cd | grep sed awk then awk
+		'quoted text' echo readonly --verbose "$1" echo -eu
+$(pwd) $(pwd) echo echo grep "$1" awk echo printf
+		&& ${HOME} local echo $(pwd) printf then $(pwd) "$1" $(pwd)
+		readonly test test | grep cd x=1 test | /usr/bin echo ${HOME} printf awk
+2>/dev/null && 2>/dev/null x=1 2>/dev/null awk
+2>/dev/null "$@" done then done && test && grep -eu /usr/bin
+		$(pwd) | | /usr/bin export grep "$@" $(pwd) then sed local "$1" awk grep
+| && readonly done --verbose x=1 then 'quoted text'
+	readonly ${HOME} export done --verbose
+		&& -eu ${HOME} && readonly "$@" export printf done x=1 $(pwd) grep
+		sed && 'quoted text' x=1 sed export
+		"$1" | export grep test
+test cd /usr/bin test 'quoted text' printf x=1 done "$@" local sed | sed
+	'quoted text' $(pwd) awk then 2>/dev/null 'quoted text' sed --verbose x=1
+local export export ${HOME} | -eu --verbose 'quoted text' x=1 test --verbose done
+| "$1" readonly && cd -eu -eu /usr/bin "$1" export cd 2>/dev/null
+	done export 'quoted text' /usr/bin
+"$1" awk local ${HOME} readonly local done cd then && done local
+		$(pwd) "$@" -eu readonly -eu /usr/bin readonly && done echo sed "$1"
+2>/dev/null "$1" --verbose cd awk 'quoted text' /usr/bin echo
+"$@" $(pwd) | /usr/bin echo done done sed ${HOME} printf local then sed done
+cd grep 2>/dev/null grep "$1" then awk sed "$1" --verbose local
+		export sed 'quoted text' echo && echo x=1 && awk 2>/dev/null grep
+"$@" ${HOME} readonly 2>/dev/null ${HOME} $(pwd) $(pwd) export
+	${HOME} x=1 cd ${HOME} cd && --verbose
+		test /usr/bin cd x=1 | ${HOME} done test echo 'quoted text' local readonly
+		awk 'quoted text' 2>/dev/null /usr/bin
+'quoted text' export sed 2>/dev/null local local |
+	"$@" 2>/dev/null then 'quoted text' 2>/dev/null cd $(pwd) done x=1 "$1"
+		local 2>/dev/null export /usr/bin "$1" test 2>/dev/null export local export
+$(pwd) 2>/dev/null then echo then
+		'quoted text' grep --verbose --verbose export 'quoted text'
+	${HOME} $(pwd) $(pwd) "$@" && readonly | printf awk ${HOME} grep then
+	grep then readonly readonly $(pwd) local readonly 'quoted text' && readonly |
+	"$@" printf --verbose then x=1 export local
+	local && /usr/bin x=1 -eu x=1 | cd "$@" /usr/bin
+		"$1" export 2>/dev/null local "$1" 'quoted text' grep
+	| grep x=1 "$@" --verbose grep --verbose ${HOME} -eu grep
+		echo local --verbose local cd -eu sed /usr/bin -eu ${HOME} && done /usr/bin
+		2>/dev/null "$@" awk -eu
+		"$@" local printf awk then export "$1"
+		/usr/bin | 'quoted text' cd ${HOME} "$1" echo | echo
+	test done $(pwd) readonly ${HOME} local done
+echo grep test ${HOME} -eu echo 2>/dev/null ${HOME} |
+		'quoted text' x=1 x=1 echo export "$@" readonly grep
+	"$1" 2>/dev/null $(pwd) --verbose 2>/dev/null
+	/usr/bin readonly $(pwd) | ${HOME} printf $(pwd)
+	2>/dev/null local done
+	sed /usr/bin "$1" printf grep then printf printf awk readonly sed readonly
+	2>/dev/null | "$@" "$@" | $(pwd) readonly x=1 awk
+		done readonly export ${HOME} echo awk local awk x=1 "$@" 'quoted text'
+${HOME} grep local $(pwd)
+		local --verbose ${HOME} echo test 2>/dev/null grep then cd x=1
+		2>/dev/null x=1 awk x=1 export then grep "$1" "$@" ${HOME} "$@" &&
+		"$1" /usr/bin test "$1" export "$1" 2>/dev/null ${HOME} awk
+readonly && test echo --verbose echo local "$1" | -eu 'quoted text'
+"$1" export cd --verbose test 2>/dev/null
+	/usr/bin printf echo then --verbose ${HOME}
+		cd -eu $(pwd) awk "$@" test /usr/bin "$1" export
+--verbose -eu sed 'quoted text' x=1 grep grep x=1 | sed x=1 printf | cd 'quoted text'
+	2>/dev/null local done 2>/dev/null sed 2>/dev/null cd
+	"$@" grep ${HOME} local -eu printf 'quoted text' --verbose 2>/dev/null
+		echo | cd x=1 "$1" done x=1 grep "$1" "$@" -eu echo --verbose test
+	export 'quoted text' 'quoted text' 2>/dev/null
+	then awk /usr/bin local cd local
+${HOME} sed x=1 sed echo && awk then export readonly
+sed /usr/bin "$@" awk $(pwd) printf test export done "$@" && echo printf local readonly
+		| done /usr/bin printf x=1 export cd $(pwd) echo cd 'quoted text' export
+"$@" | 'quoted text' local | echo "$@"
+	readonly export 2>/dev/null cd 'quoted text' --verbose 'quoted text' "$1"
+grep export local /usr/bin local 'quoted text' /usr/bin done 2>/dev/null
+-eu 'quoted text' awk x=1 then readonly cd readonly x=1 | $(pwd) printf
+		echo 'quoted text' x=1 grep test echo done | | -eu
+	local test awk && "$@" 'quoted text' x=1 ${HOME} printf
+printf local -eu && readonly 'quoted text' grep "$@"
+${HOME} local 'quoted text' cd 2>/dev/null cd done sed "$1" -eu printf sed grep
+test awk then cd local cd ${HOME} done local "$@" test ${HOME} "$@"
+		/usr/bin ${HOME} ${HOME} --verbose awk
+	sed cd grep readonly --verbose cd && grep "$1" readonly $(pwd) done printf
+	then awk 2>/dev/null then 2>/dev/null
+		-eu 'quoted text' local sed | 'quoted text' /usr/bin done "$@"
+		"$1" export && 'quoted text' test x=1 local "$@" "$1" 2>/dev/null
+		"$1" test -eu printf sed echo export sed /usr/bin sed sed test done
+--verbose | 'quoted text'
+	"$1" echo readonly readonly printf
+	echo 2>/dev/null x=1 done local 'quoted text' grep
+	${HOME} sed | export cd "$@" grep | 'quoted text'
+		-eu test "$1" then test $(pwd) x=1 awk local local $(pwd) --verbose cd "$@" 'quoted text'
+x=1 2>/dev/null awk awk "$1" /usr/bin x=1
+		'quoted text' ${HOME}
+	awk then printf 2>/dev/null
+$(pwd) 'quoted text' readonly local
+		"$1" --verbose x=1 readonly then export
+readonly -eu 'quoted text' --verbose export cd done printf && | &&
+'quoted text' export printf ${HOME} grep then "$@" done --verbose -eu "$@" echo
+	'quoted text' | ${HOME} awk export 2>/dev/null
+x=1 x=1 export "$1" local done && "$1" export printf --verbose export export
+		2>/dev/null $(pwd) -eu "$@" --verbose readonly
+		&& then test /usr/bin "$@" "$@" done "$1" awk echo
+	${HOME} grep -eu local --verbose 2>/dev/null "$1"
+	grep ${HOME} cd x=1 --verbose awk | 'quoted text' export
+	export printf ${HOME} "$@" $(pwd)
+	export $(pwd) awk "$1" local --verbose done 2>/dev/null
+/usr/bin printf --verbose $(pwd) ${HOME} readonly then && printf --verbose -eu
+	| done awk -eu -eu $(pwd) done 2>/dev/null
+local --verbose --verbose cd then grep 2>/dev/null ${HOME} awk awk /usr/bin 'quoted text'
+"$1" "$@" 2>/dev/null && then readonly local /usr/bin 2>/dev/null
+echo 'quoted text' sed $(pwd) -eu export done printf local local awk echo echo done
+	'quoted text' sed x=1 'quoted text' /usr/bin x=1 then "$1" "$1" local printf
+export && "$1" readonly "$1" x=1 awk test 'quoted text' "$@" export
+		cd && awk export sed 2>/dev/null 'quoted text' printf
+		export x=1 sed "$1" -eu 'quoted text' "$1" export && /usr/bin "$@" done ${HOME}
+x=1 echo -eu awk echo printf -eu sed test export
+	&& sed ${HOME} 'quoted text' | sed x=1
+	grep "$1" awk export && 2>/dev/null --verbose ${HOME}
+		cd test then "$@" 'quoted text'
+		then x=1 $(pwd) done /usr/bin ${HOME} sed && awk -eu /usr/bin
+grep && cd then "$1" ${HOME} test cd sed && printf |
+2>/dev/null awk "$1" | ${HOME} &&
+	awk cd ${HOME} test grep | cd --verbose --verbose test sed then "$1" 'quoted text'
+printf 2>/dev/null done x=1 ${HOME} -eu -eu "$@" --verbose echo
+echo x=1 sed done x=1 --verbose
+--verbose 2>/dev/null "$1" | 'quoted text'
+	printf printf sed ${HOME} ${HOME} x=1 && | $(pwd) cd | test "$1" ${HOME} printf
+		cd grep cd && | --verbose echo --verbose "$1" x=1 readonly /usr/bin
+cd "$@" "$1" grep /usr/bin /usr/bin --verbose
+	printf echo done local | $(pwd)
+2>/dev/null done printf printf export done
+		readonly local echo awk cd local "$@"
+	'quoted text' awk -eu done export "$1"
+test then "$@" test -eu cd && awk -eu cd export local --verbose printf /usr/bin
+sed awk sed cd done ${HOME} /usr/bin ${HOME} cd printf ${HOME} -eu
+		test export ${HOME} 2>/dev/null
+then grep 'quoted text' "$@"
+readonly x=1 readonly "$@" cd ${HOME} --verbose
+	echo -eu sed 2>/dev/null cd sed /usr/bin
+		'quoted text' 2>/dev/null cd export 2>/dev/null
+	local | 'quoted text' | | --verbose done --verbose
+		readonly printf x=1 awk ${HOME} && | then
+		-eu "$1" local && "$@" 2>/dev/null local printf | /usr/bin
+${HOME} readonly /usr/bin done export
+"$1" printf "$1" 'quoted text' && /usr/bin local
+	"$@" then echo "$1" -eu && 2>/dev/null awk echo awk awk done -eu printf -eu --verbose
+| $(pwd) then 'quoted text' x=1 sed done ${HOME} readonly
+	done $(pwd) -eu "$@" cd ${HOME} awk cd done export local readonly /usr/bin
+	&& 'quoted text' "$@" -eu export
+grep 'quoted text' printf sed local $(pwd) export local
+		then printf export && export readonly ${HOME} echo then
+	-eu readonly "$@" 2>/dev/null "$@" then 'quoted text' then --verbose
+		&& | test ${HOME} export awk --verbose sed "$@"
+	then readonly local "$1" echo test echo cd
+then export grep echo 2>/dev/null 'quoted text'
+		awk then --verbose printf
+		export printf x=1 awk awk then && export "$@" ${HOME} /usr/bin readonly -eu
+		grep export done -eu grep then "$1"
+		then test export done 2>/dev/null /usr/bin /usr/bin $(pwd) ${HOME} ${HOME}
+	sed export x=1 "$1" readonly --verbose
+${HOME} sed sed printf test ${HOME}
+		echo printf 2>/dev/null local echo ${HOME} sed local printf then ${HOME} /usr/bin
+	local local ${HOME} ${HOME} done cd grep then
+echo $(pwd) "$@" ${HOME} /usr/bin
+	test grep x=1 test "$@" echo then 'quoted text'
+		printf /usr/bin echo x=1
+		$(pwd) $(pwd) done printf
+	done cd "$1" "$@" 'quoted text' export --verbose "$@" echo && local $(pwd)
+local grep grep x=1 | then local grep then awk
+		--verbose x=1 test --verbose
+	--verbose local x=1 ${HOME} then test "$1" cd 2>/dev/null cd x=1 cd 'quoted text'
+		&& --verbose sed && cd printf /usr/bin then sed printf then "$1" printf
+		-eu $(pwd) then export "$@" local
+done /usr/bin $(pwd) grep test
+	printf cd -eu /usr/bin && --verbose && 2>/dev/null cd then then && export
+	awk grep | "$@" awk 'quoted text' done 2>/dev/null
+		2>/dev/null export "$1" | printf
+	-eu local /usr/bin test /usr/bin x=1 /usr/bin
+	local export --verbose cd printf "$1" 'quoted text' printf 'quoted text'
+		"$1" echo cd x=1 -eu -eu | cd $(pwd) done printf 2>/dev/null $(pwd) local 2>/dev/null
+		done ${HOME} 'quoted text' test
+	local readonly ${HOME} $(pwd) printf /usr/bin /usr/bin 'quoted text' && "$1"
+/usr/bin test then "$@" then grep ${HOME}
+		x=1 export -eu sed sed printf then local printf awk cd then --verbose 'quoted text'
+	then /usr/bin "$1" 2>/dev/null "$1"
+test echo /usr/bin "$1" x=1 && awk --verbose x=1
+	"$1" | done grep echo echo printf grep
+		done -eu then $(pwd) echo echo
+test test cd awk test && $(pwd) local then $(pwd) 2>/dev/null export
+		awk 'quoted text' x=1 awk readonly --verbose done printf ${HOME} $(pwd)
+		test /usr/bin export -eu ${HOME} export then
+	-eu "$@" --verbose /usr/bin && then "$1" $(pwd) "$@" test /usr/bin
+		then done --verbose $(pwd) export grep echo
+		$(pwd) echo sed done grep readonly "$@" then echo local sed 'quoted text'
+test awk export --verbose $(pwd) ${HOME} 2>/dev/null "$@" echo readonly
+printf cd printf "$@" | /usr/bin x=1 grep "$1" --verbose
+echo cd "$1" readonly sed "$@" grep "$@" then
+test sed test "$1" --verbose local /usr/bin | export printf "$1" "$@" cd
+	x=1 x=1 sed -eu awk echo then -eu done 'quoted text' && readonly
+	'quoted text' grep $(pwd) -eu readonly then
+		sed cd then -eu echo then
+	export "$@" x=1 /usr/bin
+		$(pwd) "$1" /usr/bin cd cd 2>/dev/null
+	$(pwd) 2>/dev/null 2>/dev/null
+	-eu done && printf export
+		x=1 "$1" ${HOME} "$1" x=1
+		/usr/bin x=1 /usr/bin /usr/bin sed "$1" then 2>/dev/null awk then local
+		$(pwd) "$@" readonly
+	&& /usr/bin then readonly $(pwd)
+	done export cd grep 2>/dev/null -eu
+	x=1 readonly 2>/dev/null -eu test awk "$1" 'quoted text' && --verbose -eu local
+		2>/dev/null then echo grep 2>/dev/null $(pwd) /usr/bin --verbose
+		-eu done then sed cd then ${HOME} then echo $(pwd)
+readonly -eu echo cd "$@" "$1" echo printf ${HOME} grep 'quoted text'
+		--verbose /usr/bin && cd done awk echo awk done ${HOME} cd | awk
+	/usr/bin cd export --verbose --verbose done "$@" | readonly sed
+		x=1 echo 2>/dev/null 2>/dev/null cd sed --verbose cd printf
+/usr/bin && 'quoted text' x=1 grep done x=1 echo
+	awk "$1" /usr/bin test cd /usr/bin grep local ${HOME} 2>/dev/null done
+	printf /usr/bin "$@" then then test --verbose grep | then grep test readonly
+		test ${HOME} sed 'quoted text' grep x=1 export -eu readonly grep x=1
+	cd local && awk local then export && echo -eu "$@"
+		2>/dev/null ${HOME} -eu sed printf local grep printf
+	"$1" cd && /usr/bin --verbose ${HOME} echo readonly 2>/dev/null
+	echo readonly /usr/bin -eu $(pwd) /usr/bin
+export --verbose x=1 sed then "$@" 'quoted text' "$@" --verbose
+		printf x=1 export test export cd awk test printf | "$@" grep
+		| local 'quoted text' ${HOME} ${HOME} /usr/bin && readonly ${HOME} && cd
+	"$1" $(pwd) "$@" | 'quoted text'
+	&& export ${HOME} sed "$@" x=1
+local sed ${HOME} --verbose readonly ${HOME} readonly 'quoted text'
+		then printf | printf awk cd export grep $(pwd) | && 'quoted text' local test
+	local then printf done /usr/bin grep echo -eu local | | printf readonly $(pwd)
+		cd 'quoted text' x=1 -eu 2>/dev/null ${HOME} sed && awk printf
+	${HOME} $(pwd) awk --verbose
+	awk printf "$@" 2>/dev/null "$1" && awk "$1" 'quoted text'
+		'quoted text' --verbose local 2>/dev/null export
+	--verbose | printf cd done
+		local cd -eu done x=1 -eu awk printf local -eu grep
+	x=1 export $(pwd) ${HOME} -eu && done 2>/dev/null $(pwd) done ${HOME}
+${HOME} 2>/dev/null then then local && 'quoted text'
+2>/dev/null done sed $(pwd) "$1" $(pwd)
+local cd echo cd | readonly
+	"$@" /usr/bin --verbose | | sed local 'quoted text'
+	cd printf test -eu grep done
+		2>/dev/null ${HOME} ${HOME}
+	x=1 && test sed readonly printf echo /usr/bin cd "$1" grep && 'quoted text'
+--verbose export done export done
+	-eu $(pwd) test then | 2>/dev/null "$1" awk | readonly cd export
+		$(pwd) printf 'quoted text' cd && "$1"
+		cd export done 2>/dev/null readonly | x=1 -eu "$@" then cd local "$1"
+/usr/bin -eu echo | grep "$1" export echo ${HOME} export
+	sed done $(pwd) 'quoted text' grep "$1" /usr/bin export /usr/bin &&
+		echo echo "$1" "$@" done sed 'quoted text' --verbose
+	printf grep awk cd done && done grep local local | 'quoted text'
+		readonly export echo local --verbose $(pwd) $(pwd) export then &&
+	echo "$@" -eu echo $(pwd) 2>/dev/null 2>/dev/null /usr/bin "$1" | --verbose
+		readonly test "$@" "$@"
+		test "$1" --verbose sed awk --verbose &&
+		2>/dev/null sed done done && readonly
+		&& x=1 printf echo x=1 export cd export "$@" x=1
+printf grep done grep local -eu local cd "$1" 2>/dev/null --verbose export
+		'quoted text' -eu grep test -eu -eu && --verbose "$1"
+--verbose 2>/dev/null echo printf done 'quoted text' cd
+$(pwd) $(pwd) && cd awk $(pwd) sed -eu sed local local
+	/usr/bin test --verbose local "$@" export
+		"$@" grep local --verbose export cd "$@" --verbose done $(pwd) export 'quoted text'
+		awk -eu readonly "$1" ${HOME} local grep | export ${HOME} cd &&
+"$1" 'quoted text' echo 2>/dev/null echo --verbose awk -eu sed 'quoted text'
+	echo -eu local x=1 -eu && done export /usr/bin test |
+		then awk $(pwd) 2>/dev/null printf 2>/dev/null "$@" && awk && 2>/dev/null
+local then printf printf grep 'quoted text' --verbose done
+	$(pwd) local ${HOME} local | 2>/dev/null -eu ${HOME} done
+	echo cd 'quoted text' -eu | export export grep then -eu -eu done
+export && && done then /usr/bin |
+	2>/dev/null | && test cd export export | awk "$@"
+		&& then ${HOME} done "$@" -eu echo
+$(pwd) local --verbose printf ${HOME} | test
+	test then sed grep export | -eu && local 2>/dev/null -eu cd
+export --verbose done ${HOME} grep $(pwd) -eu "$1" -eu test local /usr/bin
+sed done "$@" readonly
+export local grep local | "$1" --verbose ${HOME} done --verbose
+	grep awk | export readonly local local &&
+		echo 'quoted text' export readonly local readonly $(pwd)
+--verbose local | 2>/dev/null ${HOME} 'quoted text' x=1 grep then && test 2>/dev/null
+	$(pwd) | then done x=1 ${HOME} 'quoted text'
+		cd "$@" 2>/dev/null done printf local $(pwd) grep then --verbose | echo sed then
+		export 'quoted text' $(pwd) local -eu
+2>/dev/null x=1 sed 2>/dev/null
+		done x=1 echo && printf && cd readonly
+printf readonly export local grep | test grep
+2>/dev/null 2>/dev/null awk awk && $(pwd) ${HOME}
+		"$1" export printf x=1 echo awk x=1 && --verbose 2>/dev/null --verbose -eu "$@"
+		"$1" test echo printf 'quoted text' export "$@"
+		local grep sed cd 2>/dev/null printf export 2>/dev/null "$@"
+	| "$@" "$@" printf local then then test x=1 done --verbose
+grep 'quoted text' awk local readonly 2>/dev/null
+echo "$@" then local $(pwd) cd x=1 readonly --verbose then readonly echo export
+cd echo ${HOME} --verbose cd && echo done
+	export x=1 --verbose | -eu | -eu cd echo "$@" | && "$1" awk /usr/bin
+	printf "$@" /usr/bin /usr/bin $(pwd) export awk test --verbose
+--verbose $(pwd) awk 'quoted text' then
+local cd printf /usr/bin
+		readonly printf export /usr/bin
+/usr/bin --verbose test && readonly
+'quoted text' | $(pwd) grep "$1" local 2>/dev/null
+	awk --verbose x=1 done x=1 -eu then
+echo sed 'quoted text' cd printf cd export "$1" readonly ${HOME}
+		$(pwd) --verbose && --verbose
+	done $(pwd) test export awk 'quoted text' then local $(pwd) grep "$@" x=1
+	local printf cd /usr/bin x=1 $(pwd) readonly "$1" && "$1" $(pwd)
+	$(pwd) $(pwd) done 'quoted text'
+cd ${HOME} export sed test ${HOME}
+		test awk -eu "$@" awk sed test x=1
+		2>/dev/null "$@" -eu | awk cd "$@" && "$1" done /usr/bin 2>/dev/null --verbose
+${HOME} ${HOME} export printf && grep $(pwd) awk | ${HOME}
+printf local local cd -eu printf
+		--verbose sed awk printf echo -eu export then --verbose -eu
+readonly local "$@" -eu $(pwd) sed local x=1 x=1 "$1"
+printf | cd 2>/dev/null && grep x=1 'quoted text' | 'quoted text' | 2>/dev/null
+	grep -eu -eu grep 2>/dev/null done
+		grep sed "$1" cd 2>/dev/null -eu x=1 && export export cd local 2>/dev/null -eu
+		$(pwd) done "$@" "$1" ${HOME} done printf "$@"
+	--verbose && "$1" test --verbose echo | --verbose -eu
+		local x=1 "$1" -eu then | 2>/dev/null x=1 x=1 sed 2>/dev/null grep readonly
+		cd test grep local x=1 export "$@"
+printf awk && export ${HOME} /usr/bin printf
+	then /usr/bin | -eu grep
+awk ${HOME} done sed done
+	"$1" 'quoted text' ${HOME} 'quoted text' grep "$@" grep /usr/bin echo
+	/usr/bin grep grep ${HOME} export local
+		| export && "$1" /usr/bin done local awk
+		readonly cd -eu && readonly
+		${HOME} 2>/dev/null awk test /usr/bin
+		done 'quoted text' export | /usr/bin local test 2>/dev/null readonly
+x=1 && --verbose 'quoted text' 'quoted text' 'quoted text' $(pwd) 'quoted text'
+	$(pwd) printf readonly x=1 "$1" echo cd then
+&& "$1" awk echo readonly awk test local
+	/usr/bin local export | --verbose awk done cd printf
+	done test --verbose local local sed local | cd cd "$1" test && ${HOME}
+grep "$@" echo sed sed ${HOME} $(pwd) -eu ${HOME} printf sed -eu sed
+done /usr/bin x=1 grep "$@" cd done printf local export done then
+'quoted text' /usr/bin && "$1" grep sed -eu
+test then 2>/dev/null sed | export
+		readonly echo echo x=1 | | --verbose local
+sed sed cd sed local "$@" export 'quoted text' awk
+		--verbose 'quoted text' local sed then grep
+	grep echo "$1" then echo cd && --verbose then 2>/dev/null -eu --verbose
+done printf printf grep /usr/bin then 'quoted text'
+		-eu x=1 export 2>/dev/null
+		x=1 sed then cd 2>/dev/null awk export local printf "$1"
+	done x=1 2>/dev/null --verbose | "$1" done
+	"$@" export done done "$@" sed sed readonly sed 2>/dev/null "$@" echo 2>/dev/null
+	awk readonly cd export 'quoted text'
+		"$@" ${HOME} printf "$@" | | -eu "$1" sed echo sed printf
+local then readonly local
+		sed | export "$@" "$1" /usr/bin x=1 -eu && cd grep export
+cd | local test test export
+cd then export 'quoted text' && awk export && | test printf 'quoted text'
+	&& sed 'quoted text' /usr/bin sed cd cd awk done $(pwd) echo test ${HOME} export
+	local 'quoted text' --verbose
+cd && sed grep 'quoted text'
+&& 'quoted text' echo printf "$1" echo "$@" --verbose && 2>/dev/null local
+--verbose awk 'quoted text' 2>/dev/null $(pwd) 'quoted text'
+	| awk && --verbose export test
+		x=1 -eu test --verbose awk local /usr/bin local 'quoted text' x=1 grep local grep
+	$(pwd) test echo then | ${HOME} -eu export cd export ${HOME} local $(pwd) | then
+		--verbose cd test cd | grep awk -eu grep && then x=1 readonly /usr/bin
+&& awk readonly | cd | && ${HOME} --verbose "$1" awk --verbose 'quoted text'
+cd $(pwd) test grep done local cd awk awk then -eu ${HOME}
+	test 'quoted text' echo echo awk export printf awk $(pwd) -eu /usr/bin
+	-eu grep readonly printf grep test sed && cd --verbose x=1 2>/dev/null |
+	"$1" done -eu 2>/dev/null -eu grep 2>/dev/null 'quoted text' 2>/dev/null
+/usr/bin /usr/bin printf | "$1" ${HOME} 2>/dev/null done $(pwd) then local
+--verbose awk 2>/dev/null
+		| grep | test | echo then done echo then export
+x=1 --verbose x=1 x=1 ${HOME} echo && echo -eu 2>/dev/null sed /usr/bin
+		then "$1" "$@" x=1 --verbose && -eu grep && export awk export
+printf -eu "$@" -eu | sed x=1 readonly then local grep echo grep --verbose
+		&& "$1" | done awk 2>/dev/null
+		"$1" then echo then --verbose -eu "$@" /usr/bin "$1" $(pwd)
+	then readonly "$@" export && then 'quoted text' done
+$(pwd) echo printf sed printf test $(pwd) -eu readonly
+		local /usr/bin cd local cd cd sed 2>/dev/null done | 2>/dev/null awk $(pwd)
+test cd "$@" --verbose && /usr/bin 'quoted text' export then done cd
+sed cd "$1" /usr/bin sed 'quoted text' printf test 2>/dev/null x=1 x=1
+cd "$1" 'quoted text' $(pwd) cd then --verbose ${HOME} test -eu printf "$@"
+		| | done local x=1 'quoted text' && --verbose then export export "$1" x=1
+		then export test -eu awk "$@" sed 'quoted text' x=1 /usr/bin ${HOME}
+	"$1" "$@" grep /usr/bin && $(pwd) local done export /usr/bin &&
+		sed cd --verbose cd 'quoted text' 2>/dev/null -eu
+		sed ${HOME} ${HOME} readonly ${HOME} --verbose
+	echo readonly local $(pwd) -eu "$@" cd sed
+	cd --verbose "$@" | sed echo readonly --verbose then &&
+then ${HOME} -eu echo export 2>/dev/null && "$@" $(pwd) done /usr/bin readonly
+	-eu awk ${HOME} echo /usr/bin $(pwd) grep "$@" x=1 --verbose
+	export /usr/bin then 'quoted text'
+		x=1 then -eu "$1" cd echo readonly
+		${HOME} sed --verbose x=1 && ${HOME} sed --verbose test
+	"$@" export readonly ${HOME} && 2>/dev/null cd cd done $(pwd)
+		cd cd printf ${HOME} /usr/bin echo ${HOME} | | test x=1 'quoted text' $(pwd)
+		${HOME} sed sed readonly awk ${HOME} local "$@"
+2>/dev/null -eu /usr/bin awk grep done echo "$@" &&
+		cd sed sed "$1" done readonly export "$@"
+local cd | $(pwd) awk x=1 printf 'quoted text'
+		readonly | && "$1" /usr/bin "$@" x=1 grep -eu export done x=1 cd 'quoted text'
+awk --verbose $(pwd) echo "$@" then
+		sed test cd && | test awk "$@" 2>/dev/null printf /usr/bin
+	echo 2>/dev/null x=1 done x=1 $(pwd) ${HOME} /usr/bin local "$1" cd | ${HOME}
+&& "$@" grep sed x=1 /usr/bin awk 2>/dev/null cd printf
+	local | readonly $(pwd) printf 'quoted text' printf 'quoted text'
+	printf awk ${HOME} | awk grep sed awk readonly sed | 2>/dev/null grep && echo
+	echo -eu cd export test x=1 | ${HOME} sed /usr/bin 2>/dev/null
+	test done $(pwd) $(pwd) $(pwd) grep local echo readonly readonly "$@" export
+		2>/dev/null && $(pwd) printf
+-eu printf printf --verbose 2>/dev/null "$@" printf sed
+	local export then 2>/dev/null test $(pwd) awk ${HOME} "$1" printf
+${HOME} | 'quoted text' then printf $(pwd) test --verbose test $(pwd) | awk echo
+x=1 export printf grep | 'quoted text' /usr/bin $(pwd)
+then -eu x=1 then cd "$@" grep export "$1" && ${HOME} "$1" cd local "$@" ${HOME}
+sed grep cd readonly then done
+		local done cd $(pwd) grep sed /usr/bin echo --verbose $(pwd) | printf
+"$1" "$1" --verbose && test 2>/dev/null
+	/usr/bin echo | --verbose "$1" sed done readonly --verbose "$1" export
+		2>/dev/null 2>/dev/null cd 'quoted text' cd export export awk --verbose
+${HOME} grep "$@" "$1" awk ${HOME} --verbose then local
+sed awk readonly local /usr/bin done done done 2>/dev/null
+		x=1 sed printf ${HOME} x=1 2>/dev/null echo && && "$@" x=1 --verbose readonly echo
+| echo -eu test cd cd echo ${HOME} local
+	local readonly "$@" /usr/bin sed export && grep /usr/bin then ${HOME}
+		"$@" $(pwd) "$1" x=1 ${HOME} | "$1"
+	export local "$@" test -eu "$@" | ${HOME} local grep printf && echo
+		'quoted text' awk 'quoted text' x=1
+	cd test printf --verbose awk done |
+readonly --verbose && then --verbose test cd "$@" -eu cd awk -eu "$@"
+		/usr/bin 'quoted text' "$@" printf
+	'quoted text' -eu x=1 test 2>/dev/null done readonly sed
+	x=1 "$1" 2>/dev/null cd | -eu awk | x=1 "$@" sed local printf readonly
+		$(pwd) /usr/bin -eu --verbose 2>/dev/null then test echo --verbose printf local
+done then readonly 'quoted text'
+echo export 2>/dev/null echo done
+	$(pwd) -eu echo 'quoted text' ${HOME} printf /usr/bin "$@" | "$@" 'quoted text'
+	then | sed grep echo
+	local then --verbose test x=1 2>/dev/null
+"$1" /usr/bin 'quoted text' grep then && cd | x=1 $(pwd) | "$@" | cd done /usr/bin
+		then done 'quoted text' then
+		cd then export export --verbose 2>/dev/null -eu $(pwd)
+$(pwd) done "$@" --verbose printf -eu sed done "$1" -eu "$@" ${HOME} "$@"
+	-eu /usr/bin && export "$@" then $(pwd) 'quoted text' grep 2>/dev/null grep
+		sed then ${HOME} export cd x=1 done
+	then "$@" done --verbose done | ${HOME} echo done printf then /usr/bin cd 'quoted text'
+done ${HOME} awk 'quoted text' "$@" awk ${HOME} 'quoted text' --verbose
+		${HOME} done -eu test 'quoted text' printf readonly ${HOME} --verbose $(pwd) sed
+		awk cd awk x=1 cd ${HOME} export
+		awk /usr/bin 'quoted text'
+	export export readonly local -eu sed test done echo test
+done then readonly grep awk cd /usr/bin
+	readonly x=1 awk x=1 "$1" local /usr/bin ${HOME} /usr/bin /usr/bin
+		'quoted text' x=1 sed
+		sed local && cd x=1 "$@" /usr/bin ${HOME} && /usr/bin
+		then awk /usr/bin "$@" /usr/bin readonly 'quoted text' ${HOME} x=1 then
+	done "$@" "$1" echo --verbose export readonly "$@" local && --verbose --verbose
+/usr/bin $(pwd) export local readonly local --verbose "$@" "$@" then readonly
+		-eu "$1" x=1 cd local --verbose "$@" echo
+		then "$@" "$@" printf sed 'quoted text' ${HOME} then test
+x=1 test x=1 sed --verbose printf sed echo /usr/bin awk sed 2>/dev/null
+		${HOME} && export sed printf x=1
+		--verbose "$@" | done export cd ${HOME} 2>/dev/null
+	| | ${HOME} x=1 sed --verbose $(pwd) echo --verbose && printf | ${HOME}
+	"$1" 'quoted text' --verbose
+	then x=1 awk x=1 | awk x=1 /usr/bin &&
+		$(pwd) -eu sed cd readonly --verbose
+/usr/bin --verbose export $(pwd) $(pwd) "$1" -eu "$1" ${HOME}
+${HOME} printf done 'quoted text' "$@"
+	-eu x=1 /usr/bin grep && cd "$@" test | x=1 then test "$@" echo printf readonly
+"$1" sed "$@" then grep "$1" "$@" && echo test x=1 then && printf export
+$(pwd) done "$1" && "$@"
+	/usr/bin done awk test local 'quoted text'
+		printf printf 2>/dev/null local
+	-eu && --verbose done x=1
+--verbose done /usr/bin readonly
+	grep local $(pwd) /usr/bin -eu export $(pwd)
+		&& grep -eu 2>/dev/null x=1 local grep awk printf test done /usr/bin
+		-eu local cd "$1" sed cd
+	${HOME} echo readonly "$1" -eu local 'quoted text' grep 2>/dev/null awk readonly
+readonly sed echo ${HOME}
+"$@" ${HOME} --verbose test && printf /usr/bin printf printf sed | x=1 test
+"$1" grep "$@" 2>/dev/null done
+		2>/dev/null cd && 2>/dev/null
+		--verbose local && then then 2>/dev/null export echo
+		local awk /usr/bin --verbose test | then 'quoted text' && grep done done
+export cd sed sed test ${HOME} awk "$@" --verbose
+	| awk test export export && echo /usr/bin --verbose -eu 'quoted text'
+		$(pwd) && local printf /usr/bin readonly $(pwd)
+readonly | 2>/dev/null cd echo && printf x=1 'quoted text' 'quoted text' $(pwd)
+	then $(pwd) "$@" /usr/bin --verbose 'quoted text' $(pwd) grep ${HOME}
+		readonly /usr/bin "$@" --verbose export cd | echo readonly awk
+		/usr/bin && sed 'quoted text' test
+		then local "$1" ${HOME} local 'quoted text' -eu
+		/usr/bin readonly local ${HOME} local ${HOME} 'quoted text' then /usr/bin local
+		&& sed "$@" printf done sed ${HOME} 'quoted text' grep
+	| -eu | && echo sed x=1 cd then --verbose grep
+		2>/dev/null "$1" then cd /usr/bin x=1 export
+		$(pwd) x=1 printf 'quoted text'
+${HOME} local "$@" printf -eu x=1 test
+		readonly -eu done sed done 2>/dev/null
+	readonly printf x=1 done 2>/dev/null | then --verbose grep "$1"
+'quoted text' local readonly --verbose awk readonly 2>/dev/null
+"$@" $(pwd) export sed $(pwd) test 'quoted text'
+		'quoted text' ${HOME} | 2>/dev/null
+	readonly 'quoted text' && test
+		export readonly -eu cd && /usr/bin export cd -eu sed readonly readonly
+		cd ${HOME} "$1" "$1" done --verbose
+	| awk "$@" ${HOME} echo --verbose --verbose awk $(pwd) -eu grep sed cd
+		sed readonly sed done test "$@" "$@" printf "$@" -eu grep
+'quoted text' 2>/dev/null done
+	$(pwd) && $(pwd) printf 2>/dev/null readonly grep "$1" && ${HOME}
+	'quoted text' -eu export done cd 'quoted text'
+		x=1 export ${HOME} printf 'quoted text' --verbose | | 2>/dev/null 2>/dev/null
+'quoted text' 2>/dev/null "$@" | "$1" -eu ${HOME} "$1" printf sed |
+	awk "$1" | export then -eu |
+	local ${HOME} printf test ${HOME} awk readonly test cd echo test && echo
+		local local then "$@" 2>/dev/null
+		done -eu done /usr/bin cd && /usr/bin 2>/dev/null 2>/dev/null x=1 | --verbose
+sed $(pwd) grep 'quoted text'
+		echo ${HOME} 'quoted text'
+	&& grep readonly 'quoted text' done echo sed "$@"
+		export /usr/bin $(pwd) $(pwd)
+| echo grep "$1" local "$@" "$@" /usr/bin --verbose
+printf readonly ${HOME} echo | then --verbose readonly -eu echo cd export
+--verbose sed then done
+echo 2>/dev/null readonly then grep test then 2>/dev/null then && readonly
+cd -eu grep --verbose export grep "$@" x=1 2>/dev/null export test
+	-eu ${HOME} --verbose | grep readonly then sed 'quoted text' sed --verbose done
+/usr/bin grep $(pwd) readonly
+"$@" "$1" local sed awk "$1" readonly && 2>/dev/null
+${HOME} test sed --verbose 'quoted text'
+		then && "$@" "$1" test -eu then test cd --verbose && grep local ${HOME} $(pwd)
+	awk "$1" local -eu --verbose 'quoted text' && printf sed $(pwd) ${HOME} awk -eu
+"$1" then test /usr/bin cd echo awk local
+	--verbose sed done $(pwd) done done printf local cd echo test
+		/usr/bin local $(pwd) test then sed "$@" && cd cd | 'quoted text'
+grep grep /usr/bin readonly x=1 readonly && x=1 --verbose |
+		| readonly "$1" cd awk then sed printf test
+#include c136.sh
+	2>/dev/null -eu then --verbose
+export && -eu --verbose
+		echo done 'quoted text' "$@" local
+	cd "$1" 'quoted text' export x=1 sed ${HOME} x=1
+--verbose done local --verbose
+	2>/dev/null cd $(pwd) "$@"
+	then printf && /usr/bin then /usr/bin "$@"
+	readonly | cd | 'quoted text' 2>/dev/null export grep -eu "$1" local
+		awk export "$1" awk "$@" awk test -eu ${HOME} done $(pwd) sed export printf
+2>/dev/null --verbose cd cd printf echo x=1 -eu readonly printf
+	$(pwd) done cd then sed 2>/dev/null "$@" then
+		awk && | printf "$1" "$1" /usr/bin
+export ${HOME} sed --verbose test printf local
+	awk done $(pwd) "$1" $(pwd) readonly export "$@" grep readonly readonly
+x=1 done --verbose readonly ${HOME} cd x=1 'quoted text' x=1 test
+		$(pwd) 'quoted text' && export 'quoted text' printf 2>/dev/null printf
+	$(pwd) echo 'quoted text' local && echo 2>/dev/null cd grep
+grep $(pwd) readonly then $(pwd) export cd ${HOME} && --verbose && then -eu
+2>/dev/null -eu && && | && grep grep local && x=1 then 'quoted text'
+	'quoted text' -eu "$@" "$1" readonly readonly
+		"$@" $(pwd) x=1 cd grep cd local grep && export
+	awk echo printf 'quoted text' grep --verbose
+	done --verbose x=1 /usr/bin cd local
+cd x=1 "$1" local "$@" -eu export printf "$1" -eu -eu awk
+		printf $(pwd) x=1 then ${HOME} | --verbose sed grep 'quoted text' export
+		awk "$@" --verbose 2>/dev/null
+printf ${HOME} 'quoted text' && /usr/bin ${HOME} -eu ${HOME}
+		$(pwd) awk 'quoted text' && local grep grep "$1" | cd /usr/bin
+		grep 2>/dev/null ${HOME} "$@" $(pwd) cd 2>/dev/null sed cd ${HOME} done
+cd sed 'quoted text' test ${HOME} -eu echo && x=1 grep "$@" export
+		sed awk /usr/bin x=1 then $(pwd) ${HOME} | echo export
+${HOME} --verbose test --verbose then
+		--verbose readonly echo then export local printf "$@" -eu /usr/bin | "$@"
+	2>/dev/null /usr/bin test printf /usr/bin && "$@" 2>/dev/null echo "$@" 2>/dev/null
+	2>/dev/null cd --verbose awk awk echo test export | done cd -eu grep local printf
+	test 2>/dev/null | 2>/dev/null
+		x=1 readonly && printf export /usr/bin
+	done /usr/bin export x=1 sed /usr/bin readonly "$1" test local 'quoted text'
+$(pwd) readonly "$1" test done export
+local 'quoted text' echo cd echo cd /usr/bin 2>/dev/null /usr/bin x=1 --verbose
+		local 2>/dev/null test then local export grep --verbose | echo cd then then
+		export $(pwd) $(pwd) | ${HOME} 2>/dev/null
+	awk x=1 -eu 2>/dev/null $(pwd) awk test export awk export done done /usr/bin
+		-eu then test | test 2>/dev/null readonly readonly x=1 local printf export
+		readonly printf --verbose 'quoted text' && then "$@" -eu export
+export && | done 'quoted text' echo
+		local | "$1" ${HOME} ${HOME} local ${HOME} local --verbose done /usr/bin && export
+${HOME} sed test "$@" x=1 $(pwd) 'quoted text'
+	export test "$1" awk then && then done && test 2>/dev/null printf "$1" export
+done "$@" readonly awk cd test ${HOME} /usr/bin done ${HOME}
+		x=1 grep local -eu ${HOME} 2>/dev/null
+	awk x=1 --verbose then | --verbose grep "$@" 'quoted text' && export test
+		"$@" sed grep local cd local printf
+awk /usr/bin awk cd x=1 x=1 sed ${HOME}
+		/usr/bin "$@" then awk /usr/bin "$1" awk test then 2>/dev/null
+	2>/dev/null cd sed | 'quoted text' -eu /usr/bin "$@" readonly x=1
+	readonly sed then -eu sed "$1" $(pwd) export | "$@" cd echo awk sed --verbose export
+	&& grep printf && echo --verbose export && then && 2>/dev/null
+	x=1 'quoted text' done "$@" cd && cd printf test echo awk /usr/bin ${HOME}
+| done test /usr/bin done --verbose
+printf test sed 'quoted text' --verbose export -eu ${HOME} x=1
+	then /usr/bin printf test readonly then 2>/dev/null
+done readonly x=1 x=1 export $(pwd) done
+		done /usr/bin | cd "$1" 'quoted text' | printf
+		| x=1 "$1" printf ${HOME} sed echo
+--verbose test x=1 grep "$@" && readonly /usr/bin | awk
+"$1" sed ${HOME} x=1 export awk echo --verbose |
+	awk echo "$@" done "$1" 2>/dev/null
+		${HOME} sed ${HOME} x=1 echo "$@" printf -eu && echo done && then -eu then /usr/bin
+	awk then 2>/dev/null
+		/usr/bin then 2>/dev/null $(pwd)
+/usr/bin test awk grep "$@" export printf export && $(pwd)
+	test && ${HOME} "$1" done printf ${HOME} -eu printf | export awk
+then 'quoted text' then /usr/bin "$@" then grep test export cd && awk sed ${HOME}
+		-eu awk ${HOME} done | sed done cd then
+		export cd sed "$1" 'quoted text' done --verbose 'quoted text' "$@"
+	test printf /usr/bin local echo
+export 'quoted text' awk | echo --verbose cd 2>/dev/null
+		local awk 2>/dev/null && awk $(pwd) 'quoted text' -eu readonly x=1 2>/dev/null local
+		$(pwd) export export done sed -eu --verbose done echo
+sed then grep | | x=1 x=1 "$@" readonly grep done done
+		local 'quoted text' 2>/dev/null
+		local grep $(pwd) sed test "$1" cd export ${HOME} |
+		-eu printf readonly test $(pwd) 'quoted text' local "$@" "$1" then x=1 then
+test x=1 "$1" -eu awk && && readonly -eu
+| --verbose local -eu done && sed grep 'quoted text'
+	/usr/bin then && | x=1 ${HOME} x=1
+'quoted text' && x=1 readonly
+		| grep "$1" 'quoted text' --verbose local export && /usr/bin
+	/usr/bin test echo -eu then done --verbose export readonly
+	cd 2>/dev/null done awk echo 'quoted text' printf && && /usr/bin done awk export
+echo echo /usr/bin export readonly x=1 -eu grep export
+printf /usr/bin && export printf $(pwd) then test export 'quoted text'
+--verbose done x=1 --verbose readonly $(pwd)
+sed export && readonly "$1" awk cd | local printf /usr/bin
+		"$1" sed printf /usr/bin x=1 printf test &&
+		&& local grep x=1 grep "$1" "$@" 'quoted text' sed -eu done "$1" | readonly
+	"$@" grep printf && "$@" then sed -eu
+"$1" done 'quoted text' /usr/bin -eu /usr/bin then /usr/bin
+		grep --verbose -eu printf printf 'quoted text' -eu cd sed /usr/bin echo
+		grep test awk --verbose "$1"
+	then && local | echo grep
+		'quoted text' -eu awk test sed grep -eu /usr/bin export -eu "$@" ${HOME} --verbose
+then | | "$@" grep -eu
+		2>/dev/null /usr/bin cd export x=1 | then printf ${HOME}
+then --verbose ${HOME} $(pwd) /usr/bin export done then -eu 'quoted text' --verbose
+	test local && "$1" /usr/bin ${HOME} sed
+	$(pwd) "$1" awk 2>/dev/null
+&& cd 2>/dev/null --verbose 2>/dev/null local awk --verbose
+	sed 2>/dev/null local ${HOME}
+	sed x=1 "$@" "$1" $(pwd) 2>/dev/null export
+${HOME} export "$1" then
+		2>/dev/null "$@" cd 2>/dev/null
+	${HOME} awk readonly | test | local /usr/bin
+		cd | ${HOME} /usr/bin -eu sed sed export --verbose "$1" 2>/dev/null echo sed
+cd x=1 "$1" done printf awk export printf /usr/bin local then $(pwd) local
+		--verbose grep 'quoted text' ${HOME} then -eu
+		| /usr/bin sed "$1" "$@" --verbose local test --verbose
+		'quoted text' grep then -eu "$@" --verbose -eu
+	export sed readonly 2>/dev/null && cd test echo readonly echo "$@" /usr/bin
+export done -eu local done awk
+--verbose $(pwd) done sed cd && ${HOME} printf
+	grep -eu -eu export local echo -eu printf 2>/dev/null done ${HOME}
+export export && export done awk --verbose cd awk -eu sed grep
+echo local sed sed $(pwd) /usr/bin printf
+		${HOME} export "$@" -eu /usr/bin grep test then test ${HOME} "$@" test
+	/usr/bin 'quoted text' "$@" /usr/bin
+printf readonly --verbose cd readonly "$@" 'quoted text'
+local export -eu "$1"
+		echo 'quoted text' | readonly
+	${HOME} cd x=1 printf test && "$@"
+		&& ${HOME} -eu $(pwd) "$1" sed test
+	--verbose $(pwd) 2>/dev/null 'quoted text' && /usr/bin sed done && then then
+	readonly test local --verbose -eu --verbose
+		'quoted text' export export cd grep -eu 'quoted text' -eu 2>/dev/null
+	${HOME} done then ${HOME} local export readonly ${HOME} then readonly --verbose
+readonly /usr/bin echo local
+grep awk 'quoted text' done 'quoted text'
+		| ${HOME} export "$@" ${HOME} sed --verbose -eu done
+		awk grep readonly echo then 'quoted text'
+		-eu export /usr/bin -eu then grep | grep grep done awk "$1"
+		echo ${HOME} x=1 sed $(pwd) 'quoted text' echo --verbose awk $(pwd)
+		"$@" cd done -eu cd && 'quoted text' ${HOME} | | cd sed cd -eu
+	/usr/bin export -eu --verbose /usr/bin /usr/bin sed ${HOME} x=1 &&
+readonly x=1 done "$@" $(pwd) local -eu x=1 local grep done export "$@" 2>/dev/null
+		then export "$1" echo cd done ${HOME} "$1" ${HOME} "$1" "$@"
+		then x=1 x=1 cd 2>/dev/null sed printf then "$1" test local then "$1" ${HOME}
+"$1" "$@" && -eu echo test readonly "$@" | echo cd 'quoted text' 'quoted text'
+echo && awk && 'quoted text' "$1"
+sed then grep --verbose -eu | -eu
+		"$@" 'quoted text' local "$@" test
+	grep -eu "$1" 2>/dev/null | | /usr/bin
+		2>/dev/null done echo -eu then local "$@"
+		"$@" $(pwd) 2>/dev/null
+		test readonly test "$@" cd
+export sed 'quoted text' x=1 cd 2>/dev/null && /usr/bin
+	cd /usr/bin --verbose && 2>/dev/null printf sed local echo --verbose 'quoted text'
+		local readonly 'quoted text' printf "$1" | -eu $(pwd) $(pwd) "$@" local echo /usr/bin
+echo "$1" /usr/bin "$@" "$@" $(pwd)
+		done done readonly printf
+		grep -eu cd -eu "$@" printf && awk sed then ${HOME} printf "$@"
+"$@" | then 'quoted text' "$1" done grep && /usr/bin
+	done done "$1" printf test grep cd 2>/dev/null sed done | echo "$@" awk echo readonly
+		'quoted text' -eu cd export -eu
+"$1" done printf local --verbose
+export export x=1 echo awk | --verbose
+2>/dev/null /usr/bin 2>/dev/null x=1 ${HOME} --verbose done export printf
+		echo 'quoted text' "$@" 2>/dev/null --verbose "$1" && "$@" awk && --verbose
+		'quoted text' "$@" grep | echo "$@" sed "$1"
+--verbose printf --verbose | 2>/dev/null echo && awk awk sed
+	readonly -eu "$@" && /usr/bin local printf readonly sed then awk
+	-eu readonly printf export 'quoted text' "$1" | 2>/dev/null readonly sed
+	'quoted text' printf && cd cd cd echo printf x=1 printf local local
+	'quoted text' --verbose x=1 echo done ${HOME} --verbose sed readonly awk export
+	"$1" /usr/bin grep -eu
+export $(pwd) grep /usr/bin awk awk echo x=1 $(pwd) | awk &&
+test local && printf | "$@" sed --verbose local export 'quoted text'
+export awk x=1 'quoted text' /usr/bin "$@" x=1 done 'quoted text'
+	$(pwd) "$1" ${HOME} grep "$@" /usr/bin
+		sed && test && grep then sed
+		$(pwd) 'quoted text' x=1 grep done "$1" ${HOME} "$1" local ${HOME} export $(pwd)
+	done -eu echo printf sed 2>/dev/null
+		| /usr/bin ${HOME} /usr/bin "$1" readonly -eu echo
+	"$1" then test awk echo then
+	'quoted text' /usr/bin then then grep
+		readonly sed sed cd --verbose x=1 'quoted text' sed "$@" test local done
+		--verbose test $(pwd) -eu test local && done --verbose
+local ${HOME} | "$@" 'quoted text' awk 'quoted text'
+done printf grep sed -eu echo echo test local && readonly local
+		2>/dev/null awk && -eu && then x=1 /usr/bin 2>/dev/null | test
+		${HOME} --verbose test "$1" 2>/dev/null test
+	$(pwd) x=1 "$@" --verbose "$@" then 'quoted text' export /usr/bin local readonly
+	cd awk -eu /usr/bin local readonly readonly
+		/usr/bin local sed test && --verbose export readonly test then readonly
+printf -eu printf "$1"
+	--verbose readonly | -eu /usr/bin "$1" ${HOME} awk cd cd awk grep grep grep printf
+local awk $(pwd) 2>/dev/null readonly export ${HOME}
+		local -eu -eu printf local $(pwd) awk done done x=1 cd x=1
+2>/dev/null --verbose "$1" --verbose "$1" --verbose | export
+	/usr/bin && awk "$1" && 'quoted text' readonly && sed "$@"
+		awk 'quoted text' printf --verbose export "$@" local echo --verbose
+		2>/dev/null grep 2>/dev/null "$@" $(pwd) grep "$1" local grep
+	-eu "$@" echo 2>/dev/null grep
+	2>/dev/null $(pwd) readonly $(pwd) grep export $(pwd) && -eu --verbose &&
+${HOME} x=1 /usr/bin 2>/dev/null /usr/bin 2>/dev/null
+	printf ${HOME} "$1" grep test readonly 2>/dev/null
+local readonly done grep --verbose awk awk cd "$1" $(pwd)
+cd /usr/bin "$1" -eu "$1" sed printf
+sed cd "$1" "$@" local awk 'quoted text' && done test
+		'quoted text' then local "$1" printf
+${HOME} test "$1" "$1" ${HOME} awk done && ${HOME}
+test local export then x=1 printf | ${HOME} /usr/bin grep
+-eu "$@" test export then readonly
+	echo awk "$@" echo grep "$@" then 2>/dev/null x=1
+	--verbose done 2>/dev/null done --verbose
+printf readonly x=1 && 2>/dev/null 2>/dev/null 'quoted text'
+/usr/bin | test echo "$1" -eu "$1" export x=1 "$1" /usr/bin
+2>/dev/null then | x=1 /usr/bin printf | /usr/bin done "$@" x=1 echo "$1" --verbose
+	&& then local && cd /usr/bin cd then --verbose && --verbose printf then && $(pwd)
+	&& | && "$1" /usr/bin awk awk readonly -eu grep 'quoted text'
+		'quoted text' | then --verbose /usr/bin test cd export test printf $(pwd) x=1
+		printf grep x=1 local export
+	-eu -eu test local export cd "$1"
+	test && 'quoted text' sed sed 2>/dev/null awk printf $(pwd) readonly -eu ${HOME}
+		"$@" readonly echo grep 'quoted text' printf | sed test "$@" | |
+	printf -eu $(pwd) awk awk && x=1 local $(pwd)
+	2>/dev/null test "$@" local | export awk then | | cd
+		x=1 'quoted text' awk
+	cd "$1" --verbose --verbose sed 2>/dev/null
+	"$@" done readonly ${HOME}
+		'quoted text' x=1 "$1" export echo cd awk "$@" "$@"
+	"$1" --verbose | grep -eu --verbose done x=1 then | readonly ${HOME} && awk /usr/bin
+&& awk done echo $(pwd) "$@" $(pwd) readonly readonly
+		'quoted text' $(pwd) local echo echo ${HOME} export -eu local $(pwd)
+	local 2>/dev/null cd done awk cd export /usr/bin
+awk grep test --verbose ${HOME} test export "$1" | | $(pwd)
+	cd 2>/dev/null printf test "$1" 2>/dev/null 'quoted text' sed
+cd local | then sed export | done grep printf 'quoted text' --verbose awk
+		"$@" then "$1" printf cd && test ${HOME} export
+	$(pwd) grep done | grep x=1 done echo | ${HOME}
+	2>/dev/null "$1" 'quoted text' readonly
+		printf local $(pwd) $(pwd) done && 'quoted text' 2>/dev/null x=1 sed cd |
+		export && $(pwd) x=1 printf export local then $(pwd) then
+		grep cd cd export 'quoted text' "$@" grep sed "$1" ${HOME} && local done $(pwd)
+	--verbose sed echo | x=1 -eu sed /usr/bin then $(pwd) local cd readonly done grep
+	awk && && /usr/bin test
+		cd sed printf ${HOME} "$1" 'quoted text' "$1" then && local
+	&& --verbose awk awk | 'quoted text' ${HOME} && "$1"
+	"$@" $(pwd) grep readonly done $(pwd) done echo $(pwd) "$@"
+		then local then --verbose --verbose -eu /usr/bin
+	readonly test local "$@" --verbose then sed --verbose readonly /usr/bin
+	done readonly done sed cd done sed then x=1 x=1 export awk $(pwd)
+		grep $(pwd) "$@" /usr/bin -eu cd 'quoted text'
+		| then readonly sed --verbose && 'quoted text' readonly -eu done grep echo
+		done local | export -eu echo grep cd awk ${HOME} sed export
+		export | test printf grep grep awk awk -eu export readonly
+		${HOME} echo $(pwd) awk
+		--verbose "$1" readonly local done test grep readonly done printf sed $(pwd)
+	awk awk grep /usr/bin --verbose -eu
+	export grep export 'quoted text' readonly $(pwd)
+		echo 2>/dev/null 'quoted text' grep export
+test $(pwd) $(pwd) "$@" export readonly cd
+	echo x=1 sed awk export test export
+	"$@" done export "$@" grep -eu sed awk --verbose
+export awk -eu 'quoted text' readonly echo then cd 2>/dev/null
+	test $(pwd) | 'quoted text' | local "$@" 'quoted text' x=1 local test
+		test 2>/dev/null awk 2>/dev/null printf
+	done readonly | 'quoted text' export | test && -eu cd sed | cd done -eu
+		-eu 'quoted text' export "$@"
+"$1" local readonly sed -eu local "$@" local cd export readonly | grep $(pwd)
+test && then sed | -eu 'quoted text' 2>/dev/null awk
+	cd then | --verbose printf -eu --verbose cd done -eu "$1" | awk test /usr/bin
+	test && then done local x=1 cd echo x=1
+		"$@" $(pwd) $(pwd) /usr/bin --verbose test
+cd awk sed -eu /usr/bin local echo && --verbose done
+$(pwd) 'quoted text' awk then printf "$@" readonly
+sed echo --verbose x=1 done grep -eu "$@" $(pwd)
+		2>/dev/null -eu ${HOME} ${HOME} cd export sed
+	$(pwd) $(pwd) /usr/bin
+	x=1 $(pwd) awk 2>/dev/null ${HOME} test 'quoted text'
+	awk -eu test cd export then export cd then 'quoted text'
+		readonly /usr/bin cd export awk
+x=1 | $(pwd) readonly printf grep awk grep --verbose
+grep grep "$1" --verbose readonly $(pwd) export "$@" cd "$1" cd then
+	sed printf echo --verbose grep printf -eu done grep "$@" then
+	echo -eu "$1" 2>/dev/null --verbose | then sed $(pwd) "$1" $(pwd) ${HOME}
+	echo && printf test /usr/bin x=1 "$1" sed awk --verbose sed
+		-eu ${HOME} x=1 'quoted text' printf grep /usr/bin readonly
+		2>/dev/null && x=1 -eu local done export
+grep 'quoted text' export readonly printf "$@" sed ${HOME}
+	'quoted text' printf cd sed readonly /usr/bin /usr/bin -eu --verbose
+		awk && x=1 cd ${HOME} test $(pwd) "$1" done --verbose 'quoted text' ${HOME} test
+cd && cd then x=1 readonly "$1" echo sed x=1 "$1" done printf
+	--verbose readonly -eu sed
+		grep export --verbose 2>/dev/null test /usr/bin sed test awk
+		$(pwd) awk && && awk --verbose
+		local export ${HOME} --verbose -eu x=1 "$@" | "$1" 'quoted text' && echo && &&
+		$(pwd) /usr/bin sed /usr/bin
+local 'quoted text' export readonly test local 2>/dev/null grep ${HOME}
+"$@" echo ${HOME} export $(pwd)
+		'quoted text' done x=1 printf awk /usr/bin "$1" done $(pwd) echo -eu then --verbose
+		local awk readonly ${HOME} $(pwd) done $(pwd) done
+	"$1" x=1 done test echo --verbose then local local "$@"
+		sed 'quoted text' readonly
+		awk then printf then then then grep sed "$1" 'quoted text'
+	x=1 sed "$1" 2>/dev/null done then echo --verbose ${HOME} --verbose
+		cd echo /usr/bin $(pwd) x=1 | 2>/dev/null
+	sed | grep printf printf /usr/bin
+	'quoted text' then export
+		done && sed x=1 sed $(pwd) -eu /usr/bin sed test /usr/bin cd test
+	--verbose && "$@" done awk $(pwd)
+		2>/dev/null readonly printf echo test "$1" awk && -eu export "$@" readonly 2>/dev/null
+		/usr/bin -eu $(pwd) readonly echo
+	-eu ${HOME} "$1" grep "$1" --verbose
+test cd x=1 sed ${HOME} 2>/dev/null test printf local $(pwd) grep
+"$1" echo then /usr/bin --verbose local x=1 -eu 'quoted text' test export local
+		printf /usr/bin grep cd -eu printf awk 'quoted text' sed "$@"
+	"$1" | "$@" done 2>/dev/null $(pwd) readonly "$1"
+		printf -eu done ${HOME} cd | awk readonly cd awk sed awk test test export
+		done && --verbose && ${HOME} ${HOME} $(pwd) export
+	--verbose x=1 readonly test x=1 && grep local "$1" $(pwd) ${HOME} | $(pwd)
+	test && 2>/dev/null /usr/bin
+sed ${HOME} "$@" /usr/bin -eu | grep export local export "$1" then done readonly
+	| done printf printf done --verbose
+		2>/dev/null $(pwd) test sed | grep && -eu sed awk 2>/dev/null -eu printf x=1
+		done ${HOME} -eu | cd ${HOME} x=1 "$1" then readonly awk then sed | 'quoted text'
+-eu cd then grep done --verbose readonly $(pwd) --verbose local 'quoted text' 'quoted text'
+		then "$@" /usr/bin test awk ${HOME} "$@" -eu
+test && sed -eu /usr/bin
+	done export -eu -eu export awk done done export readonly && ${HOME}
+		-eu cd printf grep /usr/bin
+	readonly --verbose 'quoted text' echo --verbose done "$@" 2>/dev/null export x=1
+		cd -eu done "$@" grep grep | "$1" cd -eu "$1" echo sed
+	grep printf then "$@" "$1"
+		then $(pwd) x=1 awk | $(pwd) grep && awk /usr/bin
+		awk export awk grep then --verbose local | done readonly export local --verbose
+	'quoted text' readonly grep x=1 export && test readonly export readonly
+		"$1" /usr/bin && && readonly
+grep x=1 /usr/bin printf export cd && local
+		export readonly echo "$@"
+		echo --verbose then ${HOME} printf
+	/usr/bin x=1 export && awk $(pwd) $(pwd) awk 'quoted text'
+		grep local "$@" test
+		export /usr/bin 2>/dev/null "$1" printf export && local awk $(pwd) done grep
+	echo /usr/bin 2>/dev/null | -eu then grep 'quoted text' printf $(pwd)
+	"$@" $(pwd) test sed --verbose 2>/dev/null
+		readonly "$@" echo 2>/dev/null --verbose && grep /usr/bin
+		sed | printf printf $(pwd) echo printf | /usr/bin
+		x=1 grep awk test $(pwd) grep cd x=1 | 2>/dev/null ${HOME} grep then
+"$1" cd printf test x=1 | readonly cd cd then | cd cd grep 'quoted text'
+		export export grep && sed "$@" "$@" awk
+	2>/dev/null "$1" then | then --verbose readonly
+	'quoted text' test $(pwd) export done awk &&
+then ${HOME} $(pwd) local $(pwd) grep
+		sed && echo 'quoted text'
+		readonly "$@" "$@" cd x=1 cd x=1 echo 'quoted text' -eu $(pwd) | x=1 then cd
+readonly /usr/bin sed
+'quoted text' && --verbose && grep "$@" test ${HOME} && echo "$1" /usr/bin
+	$(pwd) 'quoted text' /usr/bin then echo ${HOME} /usr/bin "$@"
+--verbose awk printf awk sed grep x=1 /usr/bin cd cd ${HOME} printf local
+		"$@" ${HOME} grep -eu $(pwd) done | test test 2>/dev/null then printf cd && then
+	awk 2>/dev/null "$@" done readonly export
+	awk 2>/dev/null echo /usr/bin /usr/bin | ${HOME}
+		export --verbose x=1 awk awk
+done /usr/bin "$1" then /usr/bin cd done "$@"
+	| sed | --verbose ${HOME} grep $(pwd) sed sed cd
+readonly 2>/dev/null $(pwd) $(pwd)
+		readonly done 2>/dev/null -eu --verbose | 'quoted text'
+2>/dev/null printf --verbose local $(pwd) local then -eu | 2>/dev/null grep
+		/usr/bin local local readonly test done done
+		printf cd 2>/dev/null x=1 -eu "$@" grep | "$1" printf grep 2>/dev/null
+		/usr/bin done "$@" echo 'quoted text' grep x=1 done
+test echo sed readonly && /usr/bin sed x=1 $(pwd) export echo done ${HOME}
+	test test readonly ${HOME} "$@" ${HOME} printf --verbose
+		readonly | export then awk 'quoted text' grep $(pwd)
+		cd local /usr/bin && ${HOME} 2>/dev/null printf cd "$@" then ${HOME}
+	awk test echo | echo /usr/bin "$1" /usr/bin
+	awk "$1" && printf && | $(pwd)
+		--verbose export test cd | 2>/dev/null local --verbose printf grep
+"$1" "$@" printf && 2>/dev/null grep
+		echo printf -eu then --verbose printf
+x=1 /usr/bin --verbose x=1 && /usr/bin grep -eu done printf
+/usr/bin 'quoted text' 'quoted text' --verbose $(pwd) 'quoted text'
+	cd printf local echo sed grep | readonly
+	export /usr/bin 'quoted text' grep then readonly done ${HOME} cd readonly
+		| readonly -eu "$1" $(pwd) x=1 readonly local /usr/bin cd x=1 | $(pwd)
+	local -eu --verbose then | test then |
+"$@" "$1" then --verbose echo
+local then grep test printf
+		${HOME} echo printf then
+	echo local && export ${HOME} && --verbose test then done grep local cd
+	echo done "$@" --verbose "$@" /usr/bin local && sed then "$@"
+done ${HOME} /usr/bin x=1 -eu ${HOME} $(pwd) grep test grep echo 2>/dev/null cd
+	"$@" 2>/dev/null awk 2>/dev/null | awk "$1" 'quoted text' ${HOME}
+awk printf cd test 'quoted text' readonly
+readonly "$1" then readonly $(pwd)
+	/usr/bin printf /usr/bin echo grep x=1 2>/dev/null -eu x=1
+	&& "$1" grep echo 2>/dev/null "$1" 'quoted text' sed done -eu
+	then "$@" /usr/bin 'quoted text' cd cd | grep local --verbose $(pwd) awk x=1
+		local export export export local | x=1 "$1" export
+| then "$1" grep ${HOME} 2>/dev/null readonly test printf --verbose x=1
+		printf -eu export 'quoted text' 2>/dev/null
+		printf printf export x=1
+"$@" cd echo cd x=1 test
+	| /usr/bin "$1" 2>/dev/null printf local cd "$@"
+		local cd grep grep cd ${HOME} && | "$@" --verbose test && /usr/bin
+		awk 'quoted text' then printf "$@"
+2>/dev/null export 2>/dev/null x=1 sed test
+		x=1 "$1" done 'quoted text' && -eu cd
+		grep 'quoted text' done /usr/bin done then test
+	"$1" | /usr/bin "$1" 2>/dev/null 'quoted text' export sed sed
+		x=1 --verbose 2>/dev/null ${HOME} $(pwd) 2>/dev/null awk 2>/dev/null
+	"$1" ${HOME} "$@" 2>/dev/null
+		cd --verbose && -eu --verbose export
+2>/dev/null printf printf x=1 x=1 /usr/bin test cd
+		2>/dev/null sed && local && x=1 then sed "$@" "$@" --verbose
+		/usr/bin sed grep ${HOME} /usr/bin --verbose -eu | grep ${HOME} export echo
+cd /usr/bin export --verbose
+${HOME} $(pwd) cd grep "$1" then "$1" "$1" && sed "$1" 2>/dev/null
+"$1" cd && local /usr/bin grep echo echo readonly local test awk export export
+		echo $(pwd) -eu $(pwd) local readonly
+"$@" $(pwd) sed $(pwd) ${HOME}
+		cd done sed readonly grep -eu $(pwd) ${HOME} --verbose
+/usr/bin --verbose 2>/dev/null && ${HOME} x=1 cd test && | -eu local
+		-eu x=1 export "$@" --verbose echo "$1" local
+		2>/dev/null 2>/dev/null 2>/dev/null 'quoted text'
+	/usr/bin then "$1" printf local printf local sed export --verbose printf printf
+		-eu "$1" printf then grep "$@" $(pwd) $(pwd) /usr/bin -eu /usr/bin echo 'quoted text'
+| local "$@" "$@" done --verbose 2>/dev/null echo -eu ${HOME} "$@" grep
+awk ${HOME} readonly ${HOME} export | export | awk echo then then 2>/dev/null $(pwd)
+		x=1 printf grep $(pwd) test printf grep x=1
+		$(pwd) cd 2>/dev/null /usr/bin readonly --verbose
+		cd 2>/dev/null awk /usr/bin printf done | cd x=1 sed ${HOME}
+"$1" local && && export /usr/bin "$@"
+2>/dev/null printf local grep && grep printf
+	export "$1" grep $(pwd)
+"$@" local awk | && "$@" /usr/bin then
+&& echo | sed awk test sed ${HOME} awk && ${HOME} sed $(pwd) "$@" grep printf
+		export then sed /usr/bin grep grep local cd sed
+		${HOME} local sed --verbose done ${HOME}
+		"$1" then local --verbose x=1 "$1" 2>/dev/null
+		"$@" 'quoted text' awk then | /usr/bin && cd | "$1" done ${HOME} 2>/dev/null
+		then printf $(pwd) 'quoted text' "$1" cd export awk x=1 /usr/bin
+	done && grep -eu x=1 local "$1" grep cd 2>/dev/null
+x=1 test then done printf export && echo then && export | then test $(pwd) x=1 export
+		awk cd x=1 "$1" grep "$@" ${HOME} ${HOME} && -eu "$1"
+		x=1 local 'quoted text' -eu "$1" 2>/dev/null sed awk then export
+	&& x=1 --verbose | --verbose
+		echo export cd --verbose printf printf test -eu | | export
+sed then export test echo sed printf awk done local
+	awk /usr/bin printf awk grep "$@" $(pwd) "$1" readonly done | cd
+	x=1 x=1 "$1" "$@" echo 2>/dev/null
+		| readonly /usr/bin test then /usr/bin test --verbose echo test cd done | "$1"
+| ${HOME} --verbose printf cd "$@" && sed | readonly $(pwd) printf "$@" -eu
+		done 'quoted text' printf grep "$@" export echo ${HOME} echo test "$1" 2>/dev/null
+		export x=1 grep local test local
+cd export printf $(pwd) -eu done 'quoted text' test "$1" test
+2>/dev/null printf done 'quoted text' 2>/dev/null $(pwd)
+		done then awk $(pwd) | readonly --verbose /usr/bin "$1" x=1 "$1" "$1"
+		echo awk test readonly -eu ${HOME} $(pwd) 2>/dev/null cd -eu
+'quoted text' then 'quoted text' 'quoted text' sed
+		then && awk --verbose "$1" "$@" export export -eu echo awk echo | awk echo readonly
+		test $(pwd) done x=1 readonly local echo local cd x=1 done grep grep
+		| test --verbose "$@" then echo "$1" | grep test then local | && --verbose sed
+	readonly done "$1" cd test echo printf --verbose x=1 done "$1" "$@" done
+-eu x=1 echo then awk -eu
+		| && echo export 2>/dev/null cd && "$@"
+$(pwd) "$@" awk then -eu "$@"
+		awk --verbose $(pwd) then
+	sed then | "$@" sed &&
+$(pwd) awk /usr/bin export echo printf echo $(pwd)
+		-eu test "$1" test -eu
+&& export "$@" "$1" awk
+		&& export 'quoted text' done export "$@" export export test 2>/dev/null local
+	/usr/bin printf "$1" | 2>/dev/null -eu /usr/bin printf done
+		"$1" && local export /usr/bin local done 2>/dev/null
+		2>/dev/null && /usr/bin "$1" test cd /usr/bin "$1" ${HOME} -eu
+		printf export grep 'quoted text' test && --verbose cd readonly $(pwd)
+	then echo then printf sed ${HOME} done test then 'quoted text' done ${HOME}
+| 2>/dev/null readonly -eu grep --verbose export then export printf grep ${HOME}
+		| 2>/dev/null done export
+		$(pwd) awk done "$@" grep
+		awk then "$1" 'quoted text' x=1 --verbose readonly "$1" 2>/dev/null
+test local 'quoted text' 'quoted text'
+		local then cd $(pwd) done test then 'quoted text' export
+		sed grep export test cd grep --verbose /usr/bin sed && done /usr/bin
+	sed awk /usr/bin test test then done done printf local sed
+"$@" && done "$1" x=1 readonly readonly grep $(pwd) echo
+	'quoted text' -eu 2>/dev/null
+"$1" 2>/dev/null cd export readonly
+x=1 readonly | grep test | -eu then "$1" x=1 -eu
+	readonly export /usr/bin -eu readonly test 'quoted text' local then
+		done done --verbose $(pwd) x=1 'quoted text'
+grep sed "$@" local 2>/dev/null awk
+grep local test 'quoted text' 'quoted text' -eu local sed 2>/dev/null
+		sed grep --verbose test local awk export ${HOME} && -eu printf "$@"
+		readonly readonly -eu done cd printf export | 'quoted text'
+| /usr/bin /usr/bin grep | /usr/bin 2>/dev/null
+grep --verbose /usr/bin cd readonly done /usr/bin -eu local grep
+		done x=1 grep export --verbose local "$@" 2>/dev/null echo
+	--verbose "$@" --verbose cd &&
+${HOME} 'quoted text' -eu -eu x=1 test x=1 then cd then echo --verbose --verbose
+	--verbose x=1 test grep "$1"
+		$(pwd) $(pwd) echo --verbose echo -eu awk sed export cd /usr/bin sed echo printf
+	cd awk $(pwd) export
+	| local sed printf test x=1 done "$1" printf
+	'quoted text' && local cd
+export sed echo local 2>/dev/null
+printf -eu $(pwd) grep 'quoted text' cd x=1 'quoted text'
+	cd done 'quoted text' --verbose -eu
+test awk done /usr/bin $(pwd)
+	cd grep "$1" --verbose --verbose "$@" "$@" /usr/bin printf awk done readonly test
+2>/dev/null "$@" "$1" && readonly
+printf local x=1 done --verbose 2>/dev/null local printf 2>/dev/null
+		| then cd x=1 export 'quoted text'
+		grep | echo | local "$@" "$@" x=1 'quoted text'
+		-eu then awk | --verbose ${HOME} local awk $(pwd) "$1" "$1" $(pwd) $(pwd) readonly
+		awk done && then export 2>/dev/null sed | --verbose "$@"
+	"$1" printf sed local && 2>/dev/null --verbose /usr/bin "$@" ${HOME}
+		then x=1 "$1" x=1 echo $(pwd) "$1" /usr/bin ${HOME} export "$1" | 2>/dev/null
+		x=1 -eu local -eu local sed grep
+	| export 2>/dev/null then "$@" then
+		| "$@" test ${HOME} 2>/dev/null awk cd printf /usr/bin
+"$@" 'quoted text' ${HOME} ${HOME}
+"$@" test printf then cd grep "$1" x=1 ${HOME}
+		"$1" echo local 'quoted text'
+	"$1" then --verbose export ${HOME} then -eu 'quoted text' done && test
+x=1 --verbose export 'quoted text' grep
+	then | export --verbose $(pwd) echo awk test readonly "$1" sed x=1 awk sed
+		/usr/bin echo done ${HOME}
+	sed 2>/dev/null "$1" --verbose readonly 'quoted text' 'quoted text' grep sed
+'quoted text' export "$1" done done then && sed local
+		printf awk readonly /usr/bin then test $(pwd) then test "$@" "$@"
+		'quoted text' echo 2>/dev/null
+"$1" 2>/dev/null ${HOME} cd done "$1" awk cd "$@" grep "$@"
+2>/dev/null 'quoted text' echo then done cd ${HOME} sed "$1" --verbose
+		&& 2>/dev/null readonly grep $(pwd) "$1" printf "$@"
+		echo | --verbose ${HOME} printf 'quoted text' test ${HOME} -eu
+	"$1" x=1 printf /usr/bin done readonly export sed 'quoted text'
+	export --verbose then test test cd awk && /usr/bin sed ${HOME} sed awk done
+then && grep $(pwd) 'quoted text' /usr/bin --verbose
+		local 'quoted text' 'quoted text'
+	awk test echo echo "$1" "$1" then
+	export local printf cd "$1" readonly test /usr/bin
+| 2>/dev/null then awk awk readonly | 2>/dev/null
+/usr/bin -eu readonly sed then 2>/dev/null
+		cd sed x=1 -eu /usr/bin sed 'quoted text'
+	&& printf 'quoted text'
+2>/dev/null done --verbose "$@" cd x=1 local readonly
+"$1" --verbose echo then $(pwd) 'quoted text'
+		"$@" $(pwd) | local sed then cd grep 2>/dev/null
+then done export -eu then "$@" then $(pwd) ${HOME} grep
+		| then grep /usr/bin /usr/bin cd test then /usr/bin --verbose x=1 $(pwd)
+2>/dev/null export sed done readonly echo x=1 sed $(pwd) then echo done
+	&& sed grep cd "$1" done test test sed ${HOME} grep -eu
+awk "$@" "$@" test export $(pwd) export export sed /usr/bin echo "$1" test --verbose
+'quoted text' "$1" sed --verbose && awk | $(pwd) --verbose then readonly "$1" readonly
+		"$1" then export /usr/bin "$1" readonly
+	x=1 readonly grep readonly sed 2>/dev/null echo x=1 "$@" local readonly -eu cd
+		x=1 awk x=1 'quoted text' done x=1
+		export x=1 | sed $(pwd) readonly cd "$1" test
+export echo /usr/bin readonly
+		&& grep readonly then then 2>/dev/null "$@" then grep awk readonly printf |
+		local local local sed ${HOME} echo "$@" readonly "$@"
+2>/dev/null grep then --verbose $(pwd) printf "$1" ${HOME} printf --verbose
+awk awk then "$@" "$1"
+		echo $(pwd) printf 'quoted text' $(pwd) /usr/bin -eu | export then -eu
+		--verbose $(pwd) x=1 -eu readonly ${HOME} test sed &&
+	/usr/bin export sed export then
+		done grep 2>/dev/null x=1 export /usr/bin $(pwd) && export
+	"$1" printf x=1 'quoted text' "$@" $(pwd) "$1" --verbose
+"$1" --verbose && echo "$@" printf 'quoted text' "$@" $(pwd) cd --verbose
+		'quoted text' | cd grep cd then /usr/bin then printf grep grep --verbose 2>/dev/null
+	x=1 then ${HOME} ${HOME} printf x=1 'quoted text' then
+		test $(pwd) x=1 | "$@" 'quoted text'
+/usr/bin sed done /usr/bin -eu sed 2>/dev/null export awk /usr/bin test
+		"$@" then local | | local x=1 local 'quoted text' done "$1" cd x=1 grep
+-eu /usr/bin export echo awk local $(pwd) x=1 'quoted text' "$@" 2>/dev/null
+	| 2>/dev/null x=1 2>/dev/null | --verbose
+	sed --verbose --verbose "$1" awk "$1" | 2>/dev/null
+	-eu export local local
+		test 'quoted text' "$1" -eu echo
+		sed local -eu cd 2>/dev/null | cd | /usr/bin "$@" test test grep x=1 local &&
+		${HOME} "$1" then grep && 'quoted text'
+	printf local done /usr/bin "$@" x=1 -eu local printf awk grep "$1" ${HOME} then
+	$(pwd) && ${HOME} ${HOME} --verbose echo $(pwd) then
+	done export ${HOME} x=1 local
+	echo && 2>/dev/null readonly awk test --verbose readonly awk $(pwd) 2>/dev/null
+'quoted text' readonly test local "$@" $(pwd) ${HOME}
+	export grep --verbose echo awk x=1 "$@"
+"$1" 2>/dev/null -eu grep awk | cd -eu grep sed "$@" awk 2>/dev/null
+/usr/bin printf awk && done sed 2>/dev/null ${HOME} "$@"
+		readonly x=1 $(pwd) 2>/dev/null
+		&& cd 2>/dev/null cd "$@"
+x=1 readonly ${HOME} readonly awk cd && done "$@" local
+awk "$@" awk echo sed then sed | -eu
+$(pwd) printf local "$1" grep x=1 done "$1" local sed x=1 done "$@" "$1" printf
+		$(pwd) test readonly /usr/bin awk
+		/usr/bin -eu sed echo "$@" awk $(pwd) export --verbose
+"$1" local ${HOME} | && done grep && /usr/bin readonly
+	grep "$@" printf /usr/bin | && done grep local
+local then x=1 --verbose 'quoted text' sed "$1" $(pwd) "$1" test export x=1 export
+/usr/bin echo && --verbose "$1" 'quoted text' 'quoted text'
+	cd 2>/dev/null local | awk done
+&& done /usr/bin echo 2>/dev/null local x=1 export | | -eu "$@"
+/usr/bin /usr/bin "$1" test grep readonly
+	'quoted text' echo 'quoted text' 2>/dev/null local 2>/dev/null $(pwd) --verbose
+2>/dev/null $(pwd) sed done "$@" && "$1" | printf cd printf
+	readonly x=1 "$@" then printf /usr/bin ${HOME} | sed awk 2>/dev/null ${HOME} x=1
+		local | && done ${HOME} -eu | local awk "$@" x=1 --verbose -eu &&
+	--verbose "$1" $(pwd) && | -eu "$1" echo export sed 'quoted text'
+		-eu 'quoted text' -eu test done | awk | export test
+	--verbose awk then 'quoted text' grep && test test
+	printf x=1 -eu "$1" local echo printf -eu | printf "$1" 2>/dev/null
+	"$1" 2>/dev/null -eu
+	readonly then "$1" $(pwd) ${HOME} sed
+		readonly ${HOME} cd && then "$1" x=1 --verbose
+		cd $(pwd) export test x=1 then x=1 printf export
+	then done 2>/dev/null --verbose awk x=1 ${HOME} awk /usr/bin $(pwd) grep then
+export --verbose ${HOME}
+	2>/dev/null sed $(pwd) then "$1" "$@" --verbose printf $(pwd) $(pwd) printf
+		-eu awk grep printf local 2>/dev/null sed then
+grep export done "$@" ${HOME} echo readonly then -eu
+		done awk | "$@" test
+echo done echo && test 'quoted text' awk 2>/dev/null
+grep "$@" x=1 echo "$1"
+		"$@" "$1" | local done x=1 readonly
+	export grep -eu awk export awk -eu "$1" --verbose 'quoted text' -eu
+		then $(pwd) grep cd then echo then local grep
+		export readonly done "$@" && export grep | cd sed /usr/bin
+		sed x=1 "$1" "$@" local local grep sed then test ${HOME} && ${HOME}
+	$(pwd) done local --verbose sed && local then printf cd sed printf
+	grep printf sed x=1 2>/dev/null then printf $(pwd) local -eu x=1
+export printf "$1" readonly
+		"$@" printf awk then | --verbose "$@" 'quoted text'
+	then && 2>/dev/null 'quoted text'
+x=1 | 'quoted text' ${HOME} x=1 /usr/bin done sed
+'quoted text' | ${HOME} sed $(pwd) x=1 'quoted text' test -eu
+		/usr/bin ${HOME} "$@" /usr/bin local "$@" "$@" --verbose 2>/dev/null grep /usr/bin
+		| 'quoted text' readonly /usr/bin --verbose
+		printf cd echo -eu | local | test readonly awk readonly done 2>/dev/null
+		${HOME} --verbose cd local --verbose printf echo
+readonly readonly grep sed && x=1 2>/dev/null done $(pwd)
+	echo 'quoted text' echo $(pwd) echo && && test --verbose ${HOME} export test "$1"
+		$(pwd) test readonly 'quoted text' cd 'quoted text' 2>/dev/null
+	'quoted text' readonly cd sed -eu "$@" x=1
+export awk test | "$@" ${HOME} -eu test export
+${HOME} grep && x=1 sed then printf x=1 readonly ${HOME} grep awk
+'quoted text' export local printf then cd readonly
+	$(pwd) /usr/bin "$@" then then 2>/dev/null x=1 $(pwd) sed readonly export
+	x=1 ${HOME} test -eu grep printf done && sed 'quoted text' "$1"
+&& -eu printf local | x=1 $(pwd)
+		cd echo /usr/bin "$1" 'quoted text' $(pwd)
+	"$@" echo grep echo export
+sed "$1" 'quoted text'
+		2>/dev/null printf -eu /usr/bin
+		"$@" export awk "$1" done sed | 'quoted text' ${HOME} test sed
+-eu "$@" --verbose $(pwd) ${HOME}
+		$(pwd) && awk export export awk -eu
+		$(pwd) 2>/dev/null -eu 'quoted text' --verbose /usr/bin
+	x=1 | 2>/dev/null /usr/bin -eu local "$@" $(pwd) awk --verbose
+	printf ${HOME} /usr/bin "$1" awk "$1" "$@" printf
+$(pwd) test done ${HOME} /usr/bin
+	"$@" awk /usr/bin test printf printf --verbose local
+then $(pwd) readonly test "$@" | test 2>/dev/null
+	echo echo 2>/dev/null sed readonly awk $(pwd) done $(pwd) local && echo
+"$1" readonly local local echo 'quoted text' |
+	cd export ${HOME} awk ${HOME} echo awk cd export "$1"
+	then x=1 /usr/bin local sed awk ${HOME} $(pwd) $(pwd) printf printf | test echo
+	readonly printf "$@" printf -eu "$1" ${HOME} /usr/bin grep awk
+readonly -eu export "$1" | grep x=1 then x=1 "$@" test echo |
+"$@" -eu readonly export x=1 ${HOME} grep test /usr/bin /usr/bin
+		done /usr/bin echo readonly local echo x=1 --verbose done x=1
+		--verbose --verbose printf 'quoted text' /usr/bin
+		awk readonly ${HOME} readonly
+	x=1 $(pwd) sed x=1 awk sed -eu export x=1 local then
+		sed x=1 && /usr/bin -eu 2>/dev/null x=1 awk 2>/dev/null | -eu
+		readonly awk -eu ${HOME} 'quoted text' ${HOME} -eu -eu | readonly echo
+test then --verbose -eu then $(pwd) /usr/bin 2>/dev/null /usr/bin done |
+${HOME} grep test -eu ${HOME} done x=1 && "$@" 'quoted text' "$1" cd $(pwd) test
+x=1 | && | test --verbose test sed grep then printf test then 'quoted text'
+		"$1" printf export --verbose
+		x=1 "$1" "$@" sed sed grep --verbose readonly x=1 cd | $(pwd) $(pwd)
+	cd -eu awk done x=1 $(pwd) "$@" && && 2>/dev/null
+		grep -eu echo /usr/bin 'quoted text' cd echo export test done readonly --verbose
+$(pwd) test then grep readonly ${HOME} ${HOME} /usr/bin -eu echo test /usr/bin
+done 'quoted text' "$@" /usr/bin x=1 echo awk 'quoted text' printf
+		local /usr/bin 'quoted text' cd readonly echo /usr/bin printf ${HOME}
+		readonly $(pwd) export -eu grep echo
+		'quoted text' done 'quoted text' sed readonly "$@" "$@"
+local then "$@" && local "$@"
+readonly | -eu 2>/dev/null --verbose 'quoted text' -eu | printf
+	"$1" | cd --verbose done $(pwd) -eu "$@" sed done
+	readonly local /usr/bin done -eu then
+	/usr/bin printf $(pwd) 2>/dev/null done /usr/bin export -eu printf awk
+&& grep awk echo 'quoted text' &&
+		export export printf echo ${HOME} "$1" grep ${HOME} && export 2>/dev/null
+'quoted text' /usr/bin 'quoted text' /usr/bin echo
+'quoted text' test "$@" export local local echo ${HOME} test 2>/dev/null
+	&& echo export cd ${HOME} x=1 "$@" grep export
+		done awk /usr/bin ${HOME} $(pwd) cd test then 2>/dev/null
+	&& echo grep 2>/dev/null printf 2>/dev/null && then awk -eu 'quoted text' 2>/dev/null
+		x=1 x=1 done done sed && readonly export 2>/dev/null
+	2>/dev/null $(pwd) && "$@" grep local "$@" echo
+then /usr/bin x=1 echo "$@" cd $(pwd)
+test -eu --verbose &&
+x=1 local printf "$@" printf grep $(pwd)
+	cd 'quoted text' sed -eu $(pwd) readonly sed
+	'quoted text' --verbose echo echo "$@" --verbose 'quoted text'
+		printf x=1 -eu $(pwd) printf done sed /usr/bin
+&& echo local /usr/bin ${HOME}
+		2>/dev/null "$@" echo 2>/dev/null
+		local then test -eu 2>/dev/null x=1 &&
+		$(pwd) "$@" echo sed readonly /usr/bin cd printf cd "$1" --verbose
+		x=1 export 'quoted text' "$1"
+	sed | local $(pwd) "$@" "$1" export done "$1"
+		/usr/bin 'quoted text' echo ${HOME} sed local && 2>/dev/null "$@" 'quoted text'
+'quoted text' && /usr/bin --verbose
+	echo $(pwd) readonly && readonly cd "$1" -eu 'quoted text' $(pwd) --verbose test
+sed && awk | then local test | 'quoted text' awk
+$(pwd) readonly grep 2>/dev/null
+then x=1 done $(pwd) | | echo && $(pwd) grep $(pwd) && /usr/bin | x=1 local
+/usr/bin then cd x=1 /usr/bin 'quoted text' test cd | local ${HOME}
+		&& local 2>/dev/null readonly -eu $(pwd)
+	then then grep ${HOME}
+'quoted text' 'quoted text' | ${HOME} "$@" export then x=1 2>/dev/null
+		/usr/bin sed echo && grep local /usr/bin 'quoted text' local
+	echo test -eu sed ${HOME} 'quoted text' test |
+		"$1" grep x=1 local local cd
+	-eu cd readonly local done -eu x=1
+x=1 ${HOME} cd echo cd awk then grep ${HOME} x=1 export 2>/dev/null cd --verbose
+	echo ${HOME} done awk -eu $(pwd) ${HOME}
+	local then "$@" 2>/dev/null awk printf then
+printf && 'quoted text' "$@" "$1" echo grep | | ${HOME} then "$@" export x=1 grep
+	readonly done echo -eu
+		then 2>/dev/null -eu /usr/bin | cd "$1" "$@" x=1
+test "$1" /usr/bin done --verbose readonly export cd test "$1" printf -eu /usr/bin
+		2>/dev/null 'quoted text'
+awk grep $(pwd) export && "$1" x=1
+	'quoted text' /usr/bin $(pwd) echo then grep $(pwd) then "$1"
+		printf 'quoted text' "$@" test 2>/dev/null /usr/bin && -eu then sed "$@"
+test "$1" "$1" $(pwd) | then echo export grep 2>/dev/null echo $(pwd)
+	'quoted text' then local --verbose "$@" /usr/bin awk export 2>/dev/null
+then && done awk 'quoted text' done -eu readonly test --verbose --verbose && grep
+	test awk echo -eu -eu grep "$1" "$1" cd grep export readonly 2>/dev/null
+	&& done sed test /usr/bin "$1" awk "$@" | 'quoted text'
+	| -eu 'quoted text' grep $(pwd) then /usr/bin test 'quoted text'
+x=1 "$@" /usr/bin local local then $(pwd) grep
+		then -eu done grep cd local
+		grep ${HOME} printf awk awk | local done echo -eu sed then && cd
+'quoted text' printf readonly cd grep | test $(pwd) && /usr/bin export --verbose
+2>/dev/null && ${HOME} | export
+	&& test --verbose $(pwd) echo |
+		2>/dev/null /usr/bin done |
+		readonly 'quoted text' -eu then cd | then "$1" "$@" readonly readonly
+"$1" awk readonly | local "$@" /usr/bin export | awk cd
+		test local --verbose sed echo awk then awk cd --verbose
+	x=1 printf $(pwd) $(pwd) local
+		then ${HOME} grep test then then ${HOME} grep printf
+		"$1" /usr/bin export 2>/dev/null done 'quoted text' awk then
+	local -eu export test echo "$1"
+awk "$@" "$1" && --verbose "$@" --verbose --verbose export grep /usr/bin 2>/dev/null
+		then grep echo | readonly local "$1" printf "$1"
+		--verbose -eu $(pwd) echo
+	x=1 ${HOME} readonly /usr/bin sed echo && ${HOME}
+		--verbose then printf awk x=1 done ${HOME} x=1 -eu test | $(pwd) "$@"
+-eu awk "$@" cd cd grep readonly printf
+		sed "$@" done then local sed "$1" ${HOME} test $(pwd) sed grep -eu
+		test | x=1 "$1" echo 2>/dev/null done /usr/bin "$@" -eu | grep
+	export then awk then | --verbose 2>/dev/null export
+cd done -eu echo then 'quoted text' ${HOME} export --verbose 'quoted text'
+"$@" $(pwd) awk test awk local | awk sed
+	${HOME} 'quoted text' echo "$@" $(pwd) 2>/dev/null then && export
+	&& cd local $(pwd) 2>/dev/null x=1 --verbose x=1 local awk $(pwd)
+2>/dev/null grep echo awk $(pwd) then printf ${HOME} echo "$@" 2>/dev/null cd
+	"$1" 'quoted text' grep $(pwd) echo "$@" test | cd echo
+	done $(pwd) awk /usr/bin grep local "$1" "$@" local cd cd export
+&& local /usr/bin done --verbose export
+	cd grep /usr/bin then
+x=1 grep --verbose "$@" cd echo 'quoted text' ${HOME} test --verbose
+		/usr/bin /usr/bin --verbose export | awk 2>/dev/null local /usr/bin done "$1" awk
+sed 'quoted text' "$1" export && x=1 'quoted text' cd export x=1 printf grep
+-eu test cd 2>/dev/null export 'quoted text' sed cd readonly local "$@" then
+echo export "$1" echo echo readonly done grep "$@" grep
+		readonly --verbose sed awk $(pwd) 2>/dev/null --verbose | ${HOME}
+	export "$@" grep cd "$1" ${HOME} --verbose
+readonly then echo 2>/dev/null 2>/dev/null awk ${HOME} x=1 awk done echo
+"$@" then x=1 printf awk $(pwd) done 2>/dev/null then x=1 'quoted text'
+		| -eu cd local | "$1" readonly x=1 ${HOME} test --verbose "$1" | x=1 | -eu
+	local printf echo test awk --verbose export ${HOME}
+		readonly $(pwd) "$1" "$1" | done &&
+'quoted text' grep printf echo 'quoted text'
+| echo grep "$1" sed /usr/bin awk local then --verbose sed x=1 "$@"
+'quoted text' echo echo echo grep readonly && test
+		cd -eu ${HOME} test then local test $(pwd)
+x=1 readonly 'quoted text' && then awk
+export grep export export
+		"$1" then /usr/bin export
+	x=1 -eu 2>/dev/null "$1" cd printf --verbose grep $(pwd) echo ${HOME}
+	&& local -eu --verbose --verbose printf
+echo $(pwd) readonly "$1" local | readonly
+	then awk readonly test printf --verbose
+		sed readonly "$1" export x=1 2>/dev/null
+	grep sed /usr/bin -eu | export "$1" awk | $(pwd) && export
+	cd -eu cd -eu echo /usr/bin ${HOME}
+cd export -eu test echo test export
+		grep | 2>/dev/null sed cd awk grep x=1 "$@" sed readonly | --verbose "$1" test
+sed awk && -eu --verbose
+"$@" done printf readonly readonly grep echo echo ${HOME} test export 2>/dev/null
+export readonly echo awk 2>/dev/null echo ${HOME} $(pwd) test
+		readonly --verbose then grep export awk grep /usr/bin $(pwd) x=1
+		/usr/bin echo | awk -eu cd cd printf "$1" readonly -eu
+		echo echo grep | printf
+	$(pwd) cd 'quoted text' done 2>/dev/null then $(pwd) readonly 'quoted text'
+	echo $(pwd) /usr/bin && $(pwd) | awk readonly echo grep awk cd 2>/dev/null awk
+		cd awk --verbose /usr/bin ${HOME}
+"$1" x=1 readonly $(pwd) cd -eu $(pwd)
+"$@" $(pwd) grep -eu cd 'quoted text' cd readonly ${HOME} awk --verbose "$1" then
+	"$@" export "$@" readonly echo echo 2>/dev/null && test $(pwd) test -eu "$@" then
+	x=1 sed test 2>/dev/null /usr/bin x=1 "$1" 'quoted text' /usr/bin
+"$1" "$@" && local echo local "$@" --verbose then | done $(pwd) 'quoted text' sed
+	2>/dev/null 2>/dev/null then readonly sed x=1
+	${HOME} awk awk 'quoted text' cd -eu export
+export then /usr/bin local 2>/dev/null done "$@" $(pwd)
+		readonly ${HOME} 2>/dev/null printf --verbose readonly 'quoted text'
+	readonly /usr/bin local -eu readonly then "$1" 2>/dev/null
+	local cd printf local 2>/dev/null && test 2>/dev/null then /usr/bin
+		| -eu 2>/dev/null readonly
+export -eu --verbose
+done x=1 local -eu cd sed echo readonly printf "$1" export grep
+		/usr/bin then /usr/bin
+x=1 /usr/bin 'quoted text' ${HOME} cd then echo cd test "$1" -eu $(pwd) "$@"
+		done && ${HOME} /usr/bin | then done 2>/dev/null
+cd "$@" 'quoted text' && then readonly grep | "$1"
+	awk "$@" export cd 2>/dev/null $(pwd) then done --verbose "$1" local local
+		echo readonly | "$@" --verbose | 'quoted text' /usr/bin
+		done then 'quoted text' ${HOME} echo x=1 grep cd "$1" export $(pwd) test grep cd
+		"$@" test test grep "$1"
+		2>/dev/null x=1 local then x=1 grep
+	local $(pwd) -eu awk sed && then "$1" x=1 "$@" "$@" -eu test && $(pwd) awk echo
+	cd x=1 test | $(pwd) 'quoted text' "$@" printf | 'quoted text' echo
+$(pwd) readonly export 2>/dev/null sed ${HOME} 2>/dev/null
+	readonly printf "$@" && sed test local local "$@" readonly
+--verbose "$1" readonly x=1 cd &&
+		&& 2>/dev/null local --verbose done echo printf
+"$@" && && && test $(pwd) local awk 2>/dev/null cd sed --verbose 'quoted text'
+	echo 2>/dev/null "$1" test grep local
+		--verbose ${HOME} local | readonly --verbose --verbose sed "$1"
+	2>/dev/null test then
+		local 2>/dev/null readonly test | ${HOME} done 2>/dev/null echo 2>/dev/null
+	| 2>/dev/null cd test "$1" local then /usr/bin
+x=1 --verbose test "$@" export "$1" /usr/bin "$@" "$1" /usr/bin "$@" -eu -eu
+| 2>/dev/null readonly
+		done export && && 'quoted text' "$1" /usr/bin echo | &&
+		echo "$1" echo | test then | test
+'quoted text' echo x=1 awk export 2>/dev/null done 2>/dev/null
+		| echo "$@" done readonly export then then ${HOME}
+		${HOME} -eu export local local 'quoted text'
+		sed && | readonly "$@" cd awk awk local "$@" cd printf
+		/usr/bin "$@" $(pwd) grep test -eu | 2>/dev/null ${HOME}
+		test && "$1" awk 'quoted text'
+		test $(pwd) "$1" "$1" "$1"
+| "$@" 2>/dev/null ${HOME} done /usr/bin "$1" printf printf "$1" 'quoted text'
+printf 'quoted text' grep ${HOME} x=1 -eu 2>/dev/null test 'quoted text'
+		sed /usr/bin --verbose then sed local grep "$1" ${HOME} grep
+	2>/dev/null x=1 test x=1 "$1" printf "$@" then done | | 2>/dev/null
+test -eu done echo done awk "$@" test local export | grep /usr/bin grep x=1 local
+		2>/dev/null /usr/bin ${HOME} | awk test cd ${HOME} sed test x=1 grep ${HOME}
+		&& | ${HOME} test -eu test /usr/bin printf echo /usr/bin test awk awk sed $(pwd)
+test 2>/dev/null | grep cd /usr/bin x=1
+	$(pwd) | "$@" test done "$@" then then "$@"
+"$1" done | local | awk sed /usr/bin -eu -eu "$1" echo test local
+		-eu sed awk && | export then | echo
+		then echo 2>/dev/null x=1 export grep cd sed done export echo 2>/dev/null x=1
+		test export done awk test echo "$1" then then
+	"$@" 'quoted text' export /usr/bin "$@" "$@" "$1" grep "$1" --verbose
+	sed export cd x=1 && sed -eu
+		| echo && export test 'quoted text' test /usr/bin $(pwd) "$1"
+export done "$1" x=1 "$1"
+		test "$1" awk awk readonly $(pwd) --verbose printf test -eu "$1" 'quoted text'
+	awk x=1 readonly ${HOME} echo "$1"
+x=1 | 'quoted text' 'quoted text' done grep test 'quoted text'
+cd done test readonly done sed readonly "$1" then --verbose ${HOME}
+		then printf awk local readonly 'quoted text' done -eu --verbose export && 'quoted text'
+		x=1 --verbose -eu local 'quoted text'
+		awk printf echo -eu "$@" "$1" --verbose | "$@" readonly echo x=1 'quoted text'
+		done readonly test printf export 2>/dev/null --verbose grep --verbose
+echo echo -eu export | "$1" sed test --verbose echo "$@" sed
+x=1 readonly x=1 ${HOME} 2>/dev/null export $(pwd) "$@" printf sed local "$1" test
+	awk export | test done | "$@" "$@" local sed --verbose -eu then
+"$@" printf "$@" -eu echo -eu 2>/dev/null awk
+readonly readonly 2>/dev/null /usr/bin
+/usr/bin readonly echo ${HOME}
+		readonly local ${HOME} local
+	| --verbose | --verbose printf && /usr/bin ${HOME} | -eu | sed 'quoted text'
+printf grep "$1" -eu 2>/dev/null readonly export ${HOME}
+		local export cd sed test $(pwd) sed | sed test 2>/dev/null
+	then | /usr/bin x=1 printf sed cd local "$@" sed test grep cd | grep
+awk ${HOME} local "$@" |
+	test cd printf cd ${HOME} readonly
+-eu grep ${HOME} grep cd ${HOME} ${HOME} -eu grep
+then | local /usr/bin ${HOME}
+	export test ${HOME} local x=1 && export done 2>/dev/null
+		${HOME} "$1" && export | echo && /usr/bin "$1" "$1" readonly "$@" cd local "$1"
+	test ${HOME} 2>/dev/null grep | readonly 2>/dev/null done local
+&& grep && ${HOME} "$1" /usr/bin "$1" export
+export local "$1" export echo export
+		"$1" 2>/dev/null 2>/dev/null ${HOME} local $(pwd) done | /usr/bin grep $(pwd)
+2>/dev/null -eu /usr/bin x=1 | | $(pwd)
+&& echo grep done sed awk readonly
+printf "$1" export 'quoted text'
+x=1 local ${HOME} /usr/bin -eu -eu && export cd | cd /usr/bin -eu then -eu grep
+"$1" "$1" "$1" --verbose 'quoted text' /usr/bin then | "$@" local export
+	then --verbose printf sed
+done "$@" "$@" printf "$@" 2>/dev/null -eu awk "$@"
+		2>/dev/null then awk 'quoted text' echo local | -eu then --verbose
+-eu test awk "$1" --verbose printf awk sed printf "$1"
+		-eu | grep done | 2>/dev/null echo "$1" then "$1" cd awk ${HOME} "$1"
+test local 2>/dev/null x=1 "$@" test test
+'quoted text' printf 'quoted text' | cd local export
+		/usr/bin grep $(pwd) x=1 $(pwd) "$@" readonly
+		grep | grep "$@" readonly "$1" awk -eu local x=1 && "$@" 2>/dev/null sed sed
+		--verbose awk echo 2>/dev/null sed export printf $(pwd) 2>/dev/null 2>/dev/null
+	then cd x=1 2>/dev/null sed awk --verbose 2>/dev/null $(pwd)
+${HOME} x=1 awk 2>/dev/null
+$(pwd) /usr/bin "$1" grep -eu sed done $(pwd) $(pwd) "$1" test local sed awk
+		"$@" /usr/bin local 'quoted text' && export export cd x=1 local 'quoted text'
+	'quoted text' awk x=1 readonly test readonly "$@"
+| awk done test awk then | "$@" echo $(pwd) printf cd && -eu "$1" && echo
+		awk printf 'quoted text' echo x=1 -eu 2>/dev/null grep
+echo -eu echo -eu grep x=1 /usr/bin
+	/usr/bin 'quoted text' && -eu grep local cd printf printf
+		| "$@" 'quoted text' sed cd ${HOME} $(pwd) awk local test 'quoted text' printf
+		"$@" | readonly x=1 cd ${HOME} $(pwd) -eu export
+		-eu 2>/dev/null "$@" "$1" cd | -eu export "$@"
+	printf 'quoted text' "$@" local | && test
+		-eu | 2>/dev/null export $(pwd) x=1
+	"$1" 'quoted text' "$@" printf --verbose local
+export ${HOME} awk readonly done
+		test 2>/dev/null test printf "$@" sed readonly grep cd
+		then grep local grep 2>/dev/null ${HOME} awk ${HOME} done 'quoted text' --verbose
+/usr/bin x=1 export ${HOME}
+	awk test readonly readonly --verbose
+x=1 "$1" /usr/bin echo printf awk "$@" 2>/dev/null
+		done | && test x=1 && --verbose then "$@" && printf --verbose
+		echo test awk local "$@" $(pwd) x=1 --verbose ${HOME} "$1" /usr/bin sed ${HOME}
+	awk && "$@" grep "$1" test -eu $(pwd)
+test test $(pwd) "$1" done sed
+	--verbose printf /usr/bin grep --verbose test /usr/bin export
+readonly $(pwd) -eu ${HOME}
+sed then printf --verbose echo "$1" then "$1" done sed && grep $(pwd) done printf
+2>/dev/null readonly /usr/bin awk "$1" then x=1 "$1" cd ${HOME} awk sed
+${HOME} --verbose /usr/bin export --verbose ${HOME} export && grep -eu export "$1"
+		'quoted text' printf "$1" sed then /usr/bin
+awk ${HOME} && done ${HOME} "$@" 'quoted text' && $(pwd)
+	awk echo 'quoted text' 2>/dev/null grep export /usr/bin printf cd done awk |
+/usr/bin | readonly &&
+	${HOME} grep done -eu $(pwd) -eu && "$@" then export cd "$@" &&
+&& -eu --verbose cd -eu printf x=1
+x=1 grep -eu /usr/bin echo readonly
+"$@" | export test printf export
+	readonly -eu 2>/dev/null local readonly printf echo 'quoted text'
+		then 2>/dev/null ${HOME} readonly
+'quoted text' "$@" | | ${HOME} /usr/bin ${HOME}
+		readonly ${HOME} test readonly done "$1" --verbose test "$1" 'quoted text'
+		then 2>/dev/null --verbose export --verbose
+	"$1" local readonly x=1 sed x=1 "$@" | $(pwd) x=1 -eu "$1" echo cd done $(pwd) local
+'quoted text' test -eu "$1" done then 'quoted text' done --verbose sed printf |
+	$(pwd) 2>/dev/null $(pwd)
+	&& && sed done cd export
+readonly export done "$@" cd /usr/bin printf $(pwd) echo awk 2>/dev/null echo
+		readonly /usr/bin $(pwd) cd export local export
+	local $(pwd) 2>/dev/null
+		test ${HOME} --verbose x=1 --verbose 2>/dev/null 'quoted text'
+	${HOME} export x=1 --verbose echo 2>/dev/null done /usr/bin
+	then test sed readonly cd sed export
+readonly ${HOME} done "$1" echo cd sed x=1 -eu test -eu "$@" sed printf
+		awk --verbose /usr/bin
+		done echo done -eu echo && printf cd /usr/bin
+	then && | export --verbose readonly then printf readonly grep "$@" $(pwd) cd grep
+		"$1" cd local cd done awk && && -eu then /usr/bin x=1 2>/dev/null
+--verbose && && export --verbose "$1" done local awk done grep echo x=1 done
+	export x=1 grep $(pwd) test printf $(pwd) cd export 2>/dev/null
+echo -eu cd local printf $(pwd) done 'quoted text'
+cd done awk done "$@" then $(pwd) x=1 -eu awk "$@" printf sed -eu test -eu /usr/bin
+	x=1 2>/dev/null test $(pwd) printf awk echo cd
+	/usr/bin done $(pwd) done "$1" $(pwd) echo --verbose awk $(pwd) cd | grep sed awk
+	'quoted text' "$@" sed then "$1" -eu readonly | awk done
+		-eu ${HOME} local then | done grep echo local grep done "$@" $(pwd) ${HOME}
+	'quoted text' -eu printf echo $(pwd) cd
+		$(pwd) local ${HOME} test "$@" export 'quoted text' test | | cd test
+	-eu "$1" -eu "$@" awk | export local cd -eu -eu cd && 'quoted text'
+		readonly $(pwd) | local x=1 "$1"
+		"$1" 'quoted text' $(pwd) -eu local && && --verbose then x=1 echo
+	-eu "$@" cd local readonly /usr/bin $(pwd)
+grep --verbose cd echo "$1" "$1" | -eu readonly ${HOME} -eu readonly --verbose
+		grep --verbose then then /usr/bin
+"$@" cd 'quoted text' awk local 'quoted text'
+	-eu grep sed then readonly
+		sed echo 2>/dev/null ${HOME} done "$1"
@@ -0,0 +1,2001 @@
+-eu -eu awk grep awk /usr/bin "$1" readonly readonly 'quoted text' export x=1
+		${HOME} "$1" 2>/dev/null "$@" x=1 sed export then awk done cd $(pwd)
+		--verbose | x=1 ${HOME} $(pwd) "$@" test readonly printf done sed test "$1" /usr/bin
+		-eu readonly cd export
+then local readonly awk && 'quoted text' -eu "$@" awk export $(pwd) && 2>/dev/null
+		grep sed printf echo echo grep done printf
+		/usr/bin cd test readonly readonly "$@" /usr/bin printf grep then -eu grep
+	${HOME} 'quoted text' | "$1" cd && test then -eu
+		awk done echo ${HOME} 2>/dev/null
+		awk && x=1 test && awk cd sed export printf | grep
+	--verbose then sed 'quoted text' --verbose
+		x=1 ${HOME} done cd x=1 --verbose test /usr/bin
+"$@" ${HOME} then | export /usr/bin cd /usr/bin done echo echo local grep $(pwd)
+x=1 awk $(pwd) echo 2>/dev/null $(pwd) && -eu grep awk
+${HOME} -eu "$1" 2>/dev/null -eu local local
+	cd readonly && "$@" 'quoted text'
+sed --verbose ${HOME} cd 2>/dev/null
+cd echo printf | export x=1 $(pwd) && 2>/dev/null
+	--verbose -eu printf $(pwd) "$@" | readonly /usr/bin -eu
+	printf awk x=1 readonly "$1" && $(pwd) grep 2>/dev/null printf
+		| printf sed done test $(pwd) local test cd printf done ${HOME} "$@"
+printf cd 'quoted text' local echo x=1 echo
+		2>/dev/null --verbose awk ${HOME}
+	$(pwd) | then done /usr/bin printf 2>/dev/null /usr/bin ${HOME} test echo
+	${HOME} "$1" && local 2>/dev/null 2>/dev/null local /usr/bin $(pwd) sed
+	grep x=1 --verbose $(pwd) "$1" $(pwd) cd
+		export /usr/bin x=1 test 'quoted text' sed grep && $(pwd) $(pwd)
+		printf "$1" printf sed "$1" "$1" echo "$@" export
+	grep printf -eu ${HOME}
+	grep 2>/dev/null cd && --verbose
+	| -eu export cd then --verbose 2>/dev/null
+"$@" /usr/bin local awk
+readonly printf awk done test sed
+	echo $(pwd) | awk readonly done sed grep | ${HOME} 2>/dev/null then
+	| awk echo printf sed printf sed --verbose "$1" --verbose export test
+| 'quoted text' $(pwd) then awk sed readonly "$1" ${HOME}
+	test "$1" /usr/bin ${HOME} done
+	"$1" export echo /usr/bin
+done "$@" ${HOME} "$1" $(pwd) export awk x=1 2>/dev/null "$@" x=1 | | --verbose
+		readonly $(pwd) echo x=1 /usr/bin "$1" /usr/bin
+readonly x=1 ${HOME} then awk | printf && --verbose 'quoted text' export
+cd printf -eu echo $(pwd) cd grep -eu
+	sed $(pwd) local awk sed cd
+	grep $(pwd) 2>/dev/null done
+		&& "$@" | -eu export test sed /usr/bin sed --verbose
+		'quoted text' sed 2>/dev/null 'quoted text' then cd local
+		$(pwd) printf --verbose | sed awk $(pwd) $(pwd) ${HOME} | awk
+${HOME} --verbose ${HOME} $(pwd)
+$(pwd) readonly "$@" /usr/bin ${HOME} awk "$@" awk export grep awk "$@" -eu
+	readonly 'quoted text' echo ${HOME} then
+		grep echo sed sed "$@" echo 'quoted text' local
+		readonly /usr/bin 'quoted text' printf 2>/dev/null | done
+printf /usr/bin | --verbose test export && printf echo awk readonly
+test done done $(pwd) then printf 2>/dev/null x=1 2>/dev/null grep cd then
+cd test echo test sed --verbose export $(pwd)
+		export cd readonly /usr/bin printf done $(pwd) cd | "$1" then printf grep test grep
+echo "$1" x=1 x=1 printf | --verbose sed sed ${HOME}
+	$(pwd) grep "$@" | test 'quoted text' sed $(pwd) export $(pwd)
+	export local 2>/dev/null ${HOME}
+	local test x=1 printf $(pwd) local x=1 cd readonly
+	"$1" 'quoted text' -eu && ${HOME} --verbose
+	-eu readonly $(pwd) "$@" x=1 export
+| -eu 2>/dev/null export
+export 2>/dev/null grep cd $(pwd) grep awk
+	readonly export sed readonly x=1 sed
+	"$1" awk cd "$@" echo export then local x=1
+| export --verbose sed echo printf -eu
+	test awk | && "$1" x=1 echo echo 2>/dev/null /usr/bin "$1"
+"$1" export | | 'quoted text' && --verbose
+-eu | local "$@" --verbose 'quoted text'
+	x=1 readonly x=1 test $(pwd) | done -eu export done 'quoted text' test readonly
+		readonly /usr/bin --verbose sed export local
+	x=1 && ${HOME} --verbose
+		/usr/bin local 2>/dev/null | /usr/bin 2>/dev/null
+-eu /usr/bin local -eu export 'quoted text' && test |
+		'quoted text' 'quoted text'
+	"$@" printf "$@" 'quoted text' ${HOME} grep grep
+		echo readonly readonly local grep 2>/dev/null
+		'quoted text' 'quoted text' awk printf cd 'quoted text' | 'quoted text'
+readonly awk export grep ${HOME} -eu grep export
+| 'quoted text' "$1" -eu printf "$@" "$@" "$1" sed readonly ${HOME}
+	export awk test echo && 2>/dev/null -eu echo
+	--verbose 'quoted text' done $(pwd)
+	/usr/bin -eu x=1 /usr/bin "$@" | && $(pwd) awk echo printf
+		awk $(pwd) 2>/dev/null $(pwd) readonly cd cd test cd sed printf
+	&& sed sed test "$1" && grep printf done "$1" $(pwd) printf
+		"$@" then export sed cd readonly sed sed printf awk
+cd ${HOME} && -eu awk --verbose && cd export x=1 $(pwd) then /usr/bin
+${HOME} echo export awk test "$@" test awk readonly -eu
+	"$@" -eu "$1" -eu printf $(pwd) readonly ${HOME}
+'quoted text' export | /usr/bin $(pwd) sed ${HOME} --verbose 'quoted text'
+	readonly -eu done -eu local echo
+-eu printf | x=1 && "$@" -eu ${HOME} "$@" ${HOME} -eu export --verbose
+	cd export export "$1" test readonly local | 'quoted text' awk x=1
+		export export done grep ${HOME}
+	awk x=1 ${HOME} then echo x=1 readonly $(pwd)
+		export export "$1" readonly echo && grep export $(pwd) -eu
+		sed export --verbose x=1 sed awk local x=1 -eu
+	local "$1" --verbose done
+	$(pwd) "$@" -eu "$@" done grep
+	-eu -eu $(pwd) then export export
+	--verbose --verbose /usr/bin
+${HOME} then "$1" | then /usr/bin /usr/bin ${HOME} "$1" awk "$@" | "$@" /usr/bin
+	&& --verbose awk 'quoted text' then
+sed --verbose "$1" $(pwd) x=1 test ${HOME} "$@" $(pwd) && grep
+-eu then | /usr/bin $(pwd) echo readonly grep --verbose -eu --verbose x=1
+| --verbose export awk test export done ${HOME} printf done $(pwd)
+		printf --verbose test "$@" -eu 2>/dev/null "$@" --verbose sed -eu 2>/dev/null
+test test -eu then --verbose export printf x=1 sed x=1 'quoted text'
+--verbose local printf -eu readonly
+		&& ${HOME} sed 2>/dev/null local echo 2>/dev/null cd done cd local -eu
+		${HOME} printf export 2>/dev/null printf done cd ${HOME}
+	-eu sed "$@" 2>/dev/null 'quoted text'
+echo cd printf grep | export x=1 awk 'quoted text' 'quoted text' 2>/dev/null -eu
+	$(pwd) x=1 'quoted text'
+"$@" 2>/dev/null test export awk echo
+		then "$@" sed -eu then echo x=1 readonly printf readonly sed 'quoted text'
+		2>/dev/null then then "$1" printf done 'quoted text' printf
+echo export local x=1 /usr/bin "$1" then echo echo "$@" ${HOME}
+	local $(pwd) printf 'quoted text'
+		sed ${HOME} test ${HOME} $(pwd) sed sed printf
+grep export --verbose "$1" --verbose echo x=1 test awk done $(pwd) sed grep printf
+		--verbose x=1 grep done readonly done done 'quoted text' x=1
+		echo -eu export "$@" done sed "$@" | local local grep printf awk cd 'quoted text'
+'quoted text' grep test --verbose "$@" "$@" /usr/bin
+x=1 cd awk $(pwd) 'quoted text'
+		export /usr/bin cd grep done readonly --verbose
+	test --verbose "$@" 2>/dev/null readonly --verbose done readonly test 'quoted text'
+	awk "$@" | x=1 && local --verbose "$1" then export x=1 x=1 export done printf printf
+$(pwd) readonly -eu 'quoted text' local done --verbose export done --verbose
+		x=1 /usr/bin /usr/bin local "$@" awk export ${HOME} "$1" | sed
+&& readonly then 2>/dev/null | $(pwd) /usr/bin
+	/usr/bin grep x=1 test --verbose $(pwd) printf sed done sed | ${HOME} |
+		&& "$@" sed "$@" -eu x=1 done
+		"$1" 2>/dev/null then cd done "$1" then --verbose x=1 x=1 'quoted text'
+awk done -eu $(pwd) 2>/dev/null grep
+then | echo "$@" test "$@"
+		/usr/bin printf readonly x=1 test then --verbose | "$1" awk cd awk sed then then
+	--verbose && readonly ${HOME} then $(pwd) local
+&& then "$@" done $(pwd) /usr/bin
+		sed readonly awk then /usr/bin "$@" done 2>/dev/null grep
+	'quoted text' printf $(pwd) readonly "$1" printf done echo /usr/bin export --verbose
+		test | "$@" cd test && cd
+		printf printf done then cd
+		echo echo | ${HOME} ${HOME} | $(pwd) test
+		printf /usr/bin cd /usr/bin echo cd then 'quoted text' 2>/dev/null test /usr/bin
+echo echo -eu local then readonly | 'quoted text' done --verbose grep && printf
+${HOME} $(pwd) export --verbose done ${HOME} printf "$@" test "$@" local
+grep grep then cd $(pwd)
+		printf -eu "$@" grep --verbose 'quoted text' ${HOME}
+		then readonly readonly $(pwd) local x=1 local "$@"
+	'quoted text' 'quoted text' sed 2>/dev/null 'quoted text' 'quoted text' 'quoted text'
+	readonly readonly readonly export | export 'quoted text' printf && test 'quoted text'
+	export printf 2>/dev/null && readonly echo done printf
+	printf export "$@" grep readonly ${HOME} then cd local "$1" && | local "$1" echo
+printf then && $(pwd) x=1
+"$1" awk readonly printf x=1
+	&& "$@" grep readonly grep x=1
+sed awk cd cd /usr/bin cd readonly local echo ${HOME} readonly
+	test done "$@" 'quoted text' --verbose
+	then "$1" cd 2>/dev/null 2>/dev/null && export cd
+	-eu ${HOME} x=1 echo cd x=1 "$1" readonly && echo --verbose $(pwd) test printf
+sed echo export ${HOME} | -eu "$@" cd echo "$1"
+		grep then sed ${HOME} && "$1" ${HOME} 'quoted text' "$@" /usr/bin local
+		sed $(pwd) echo sed export -eu $(pwd) /usr/bin &&
+echo local test x=1 then | -eu echo done x=1 cd x=1
+export /usr/bin $(pwd) local
+"$@" --verbose ${HOME} done $(pwd) then -eu
+$(pwd) "$@" $(pwd) readonly grep awk printf | "$1" ${HOME} ${HOME}
+"$@" awk "$1" /usr/bin then grep then && local echo test | && echo && | printf
+	grep | -eu x=1 | x=1 grep readonly awk awk x=1 ${HOME}
+test 'quoted text' cd "$@" 'quoted text'
+	2>/dev/null test "$@" "$@" readonly | | sed && grep x=1 -eu awk done sed
+		done x=1 2>/dev/null then 2>/dev/null sed --verbose export printf then then
+		--verbose "$1" ${HOME} cd x=1 then done 2>/dev/null
+-eu test then done grep &&
+	sed "$1" x=1 then $(pwd) "$1" readonly grep -eu /usr/bin
+		sed 2>/dev/null awk printf
+x=1 readonly | printf 2>/dev/null
+	"$1" ${HOME} x=1 awk -eu $(pwd) && --verbose ${HOME} test
+	local ${HOME} | readonly then echo /usr/bin printf done then sed ${HOME} export
+		${HOME} x=1 x=1 cd awk ${HOME} --verbose readonly 2>/dev/null readonly
+		then -eu --verbose readonly |
+printf grep | export echo ${HOME} --verbose
+		awk $(pwd) test done grep /usr/bin readonly cd | "$1"
+		$(pwd) && --verbose 'quoted text' readonly grep printf x=1
+--verbose x=1 printf 'quoted text' x=1 local local readonly readonly grep |
+		2>/dev/null local $(pwd) cd && sed sed printf sed printf --verbose local
+		readonly $(pwd) "$@" test cd export --verbose grep then ${HOME}
+		printf 'quoted text' "$@" cd $(pwd) printf $(pwd) -eu $(pwd) cd readonly readonly
+		sed printf awk awk printf sed 2>/dev/null local ${HOME} ${HOME} grep
+	| 2>/dev/null "$@" 'quoted text' test
+	grep readonly echo export |
+&& printf --verbose $(pwd) -eu cd done sed && cd ${HOME}
+		readonly cd sed $(pwd) echo 2>/dev/null
+	-eu readonly && cd /usr/bin sed x=1 ${HOME}
+-eu local -eu local test | grep done sed -eu echo readonly
+cd echo done x=1 /usr/bin readonly then local ${HOME} readonly test
+		'quoted text' "$1" "$1" ${HOME}
+		readonly ${HOME} ${HOME} test awk --verbose export 2>/dev/null "$@"
+	${HOME} printf -eu sed -eu --verbose echo "$@" x=1 ${HOME}
+	printf echo then && x=1 ${HOME} grep --verbose test 2>/dev/null
+	x=1 awk awk && awk cd /usr/bin export awk grep sed 2>/dev/null
+sed | x=1 local sed local | --verbose awk -eu export -eu
+grep sed then --verbose echo "$1" readonly then 2>/dev/null grep
+	| ${HOME} "$@" printf /usr/bin local 'quoted text' --verbose -eu
+	/usr/bin cd /usr/bin export "$@" -eu -eu done then $(pwd)
+"$@" test "$@" ${HOME} grep test sed done export x=1 export then local export
+	sed /usr/bin 'quoted text' /usr/bin ${HOME} cd /usr/bin test readonly ${HOME}
+'quoted text' local local printf printf "$@"
+	'quoted text' cd "$1" ${HOME} $(pwd) test | sed | 'quoted text'
+x=1 readonly export then /usr/bin
+		readonly sed echo 'quoted text' /usr/bin 2>/dev/null printf "$1" -eu grep "$@"
+'quoted text' readonly done
+	"$1" awk local /usr/bin "$1" test export printf $(pwd)
+		$(pwd) $(pwd) 2>/dev/null echo /usr/bin "$1"
+		${HOME} | echo ${HOME} ${HOME} cd x=1 -eu echo
+echo local -eu then /usr/bin then echo ${HOME} sed 'quoted text'
+"$1" printf $(pwd) x=1 'quoted text' sed && sed cd
+printf cd test && readonly && then readonly
+		cd echo sed $(pwd) -eu -eu
+echo export /usr/bin export --verbose | -eu test "$1" | local done printf 2>/dev/null
+		--verbose awk local -eu grep awk 'quoted text' "$1"
+	| readonly awk cd done done
+| echo done local x=1 readonly 'quoted text' test test printf x=1 2>/dev/null
+		readonly cd "$@" 'quoted text'
+		then then -eu echo readonly "$1" awk export
+		echo sed sed awk "$@" $(pwd)
+	local local printf "$@" grep --verbose awk /usr/bin grep --verbose awk /usr/bin
+		readonly readonly "$@" cd then 'quoted text' local
+		readonly export && -eu ${HOME}
+	grep /usr/bin x=1 awk grep -eu awk cd then
+$(pwd) local && --verbose 2>/dev/null "$@" grep local
+"$@" done awk printf | /usr/bin | "$1" local x=1 grep $(pwd) && cd $(pwd) 2>/dev/null
+		/usr/bin 'quoted text' -eu test | ${HOME} awk test then 2>/dev/null
+		then 2>/dev/null sed cd -eu grep --verbose
+	'quoted text' sed then "$1" $(pwd) "$@" grep --verbose local $(pwd) awk
+		"$1" echo "$1" cd readonly --verbose
+${HOME} ${HOME} awk printf local ${HOME} && test | -eu grep grep && -eu "$@"
+'quoted text' awk export printf then ${HOME} cd printf local
+cd 'quoted text' && "$@" readonly test grep
+	'quoted text' | 'quoted text' | done -eu then echo printf grep grep
+	"$@" cd awk "$@" then ${HOME}
+echo readonly | ${HOME} then grep "$@" ${HOME} done x=1 -eu
+	--verbose export test
+		| x=1 "$1" grep test "$1" 'quoted text' $(pwd) && --verbose $(pwd) 'quoted text'
+		test 'quoted text' export echo 'quoted text'
+		export echo | x=1 readonly $(pwd) ${HOME} sed $(pwd) done grep | then test /usr/bin
+		&& ${HOME} echo awk && awk readonly test 2>/dev/null -eu ${HOME} cd /usr/bin
+		&& /usr/bin echo x=1 cd echo /usr/bin done
+		&& --verbose cd "$@" export
+grep local | echo grep x=1 && grep $(pwd)
+		readonly local test | awk done readonly grep 2>/dev/null
+$(pwd) /usr/bin grep 2>/dev/null -eu then
+		readonly printf test /usr/bin cd test printf
+	sed done | -eu local cd
+		local && $(pwd) done then -eu x=1 --verbose echo && sed "$@" "$@" ${HOME}
+grep 2>/dev/null $(pwd) grep test then export export cd test -eu /usr/bin
+		done export --verbose sed export | echo ${HOME} --verbose "$1" ${HOME} test
+		| $(pwd) done --verbose 'quoted text'
+		awk "$1" /usr/bin local grep printf printf test 2>/dev/null done | local -eu
+readonly $(pwd) x=1 test -eu /usr/bin sed sed x=1 sed 2>/dev/null
+		2>/dev/null done export local grep 'quoted text'
+	"$@" done readonly awk echo "$1" --verbose "$1" readonly sed done "$@" x=1 export
+		test cd cd sed sed && /usr/bin -eu x=1 local
+		local echo echo 2>/dev/null readonly test /usr/bin
+	readonly ${HOME} | export x=1 test "$@" /usr/bin x=1 printf export
+		$(pwd) ${HOME} cd printf
+-eu 2>/dev/null "$@"
+	/usr/bin readonly printf test then | sed x=1 readonly --verbose
+		echo "$1" && $(pwd) sed cd grep awk --verbose "$@" /usr/bin $(pwd)
+	/usr/bin export "$@" "$1"
+	done cd test then echo sed
+-eu $(pwd) | /usr/bin && printf | export printf awk test 2>/dev/null
+		sed $(pwd) awk x=1 sed then -eu grep "$1" $(pwd) 2>/dev/null sed
+	echo then export printf "$@" 'quoted text'
+		/usr/bin export done ${HOME} export x=1 export "$@" &&
+sed /usr/bin && test done done $(pwd) test printf &&
+	export local -eu && export -eu cd echo awk /usr/bin "$@" x=1
+then then readonly test echo 'quoted text' then echo echo
+	cd export readonly $(pwd) export local grep
+	echo readonly /usr/bin sed ${HOME} $(pwd) | printf
+	${HOME} x=1 ${HOME} 'quoted text' awk done
+	then "$@" "$1" local ${HOME}
+		done done x=1 then "$1" --verbose
+	local /usr/bin echo cd cd && /usr/bin echo awk -eu /usr/bin done && x=1 readonly
+	export | test cd test grep cd grep -eu test done awk 'quoted text' | ${HOME}
+$(pwd) done x=1 'quoted text' grep && /usr/bin
+x=1 local | echo 'quoted text'
+	'quoted text' "$@" local then echo 'quoted text'
+	echo "$@" 'quoted text' | export echo
+		"$1" then readonly export
+	grep $(pwd) --verbose 'quoted text'
+	--verbose export local cd $(pwd) cd export done cd export
+		export cd local $(pwd) "$@" cd x=1 test echo && | cd then 2>/dev/null x=1
+	"$1" grep export test export done test 'quoted text' | &&
+		x=1 ${HOME} export $(pwd) x=1 "$@" --verbose --verbose done "$1" sed then printf
+/usr/bin local x=1 'quoted text' && -eu local test "$@" export
+	"$@" echo --verbose done /usr/bin | 'quoted text'
+then x=1 grep --verbose -eu /usr/bin --verbose --verbose | /usr/bin
+		--verbose grep -eu done grep && ${HOME} echo
+		sed done local --verbose
+	${HOME} readonly printf export /usr/bin 2>/dev/null printf "$1" &&
+	--verbose test $(pwd) printf 'quoted text' local 2>/dev/null 'quoted text'
+	x=1 export then test 2>/dev/null 'quoted text' cd -eu $(pwd) export /usr/bin
+	printf awk done 2>/dev/null 2>/dev/null test then
+	${HOME} "$@" echo -eu -eu "$1" ${HOME} --verbose done "$1" -eu && local test awk
+	'quoted text' 2>/dev/null cd cd $(pwd) echo
+		done "$@" done local awk "$1" grep "$1" -eu $(pwd) done test ${HOME}
+		-eu -eu sed | readonly printf awk awk awk printf "$@" x=1
+grep export x=1 "$1" "$1" done sed grep echo | test x=1 'quoted text' --verbose
+	${HOME} sed export done printf grep echo grep done local then
+2>/dev/null 2>/dev/null /usr/bin && "$1" "$@"
+		readonly done echo && ${HOME} ${HOME} && "$1" && awk grep | | readonly grep "$@"
+grep export cd /usr/bin echo -eu grep test readonly
+&& --verbose "$@" "$@" readonly export ${HOME} 'quoted text' /usr/bin
+${HOME} printf 'quoted text' "$@"
+'quoted text' echo grep x=1 x=1 cd export /usr/bin grep /usr/bin /usr/bin
+		"$1" --verbose | "$1" done export readonly && && readonly local "$@" awk
+		$(pwd) "$@" /usr/bin cd ${HOME} -eu /usr/bin export
+		-eu sed done "$@" | readonly awk
+	2>/dev/null 2>/dev/null
+	done awk done done $(pwd) |
+		sed /usr/bin echo 'quoted text' 2>/dev/null export $(pwd) --verbose --verbose --verbose
+done export test $(pwd) /usr/bin
+		/usr/bin $(pwd) --verbose test "$1" -eu x=1 awk x=1
+${HOME} test then "$@" "$@" test test readonly done
+	then "$1" then -eu printf 'quoted text' then then 2>/dev/null
+cd done --verbose "$1" --verbose
+	test then "$@" export | local
+		| then "$@" x=1 && "$1" local 'quoted text'
+		'quoted text' local "$1" |
+test echo grep "$@" printf test x=1 -eu && done export | /usr/bin cd done
+done awk --verbose local then 'quoted text' --verbose
+/usr/bin -eu /usr/bin "$@" "$@" sed /usr/bin test done --verbose
+		export sed "$@" "$@" echo awk printf && 2>/dev/null "$1" --verbose local
+	grep 2>/dev/null test awk readonly $(pwd) awk awk |
+--verbose sed sed awk && | -eu readonly "$1" ${HOME} && "$1" awk x=1 readonly
+	${HOME} x=1 --verbose 'quoted text' &&
+grep sed "$@" 2>/dev/null test /usr/bin readonly done /usr/bin awk
+		"$@" readonly -eu $(pwd) $(pwd) then echo local awk awk 'quoted text'
+'quoted text' awk then then printf
+-eu sed awk echo local $(pwd)
+	${HOME} "$1" printf grep export /usr/bin test then
+	"$@" x=1 done 'quoted text' awk "$@" test echo export test printf x=1 | readonly
+2>/dev/null && "$1" /usr/bin then 2>/dev/null
+&& /usr/bin 'quoted text' ${HOME} grep /usr/bin
+x=1 --verbose x=1 "$1" done $(pwd) | x=1 $(pwd) test 2>/dev/null 2>/dev/null readonly
+cd 2>/dev/null local readonly && printf 'quoted text'
+	awk printf "$@" local sed grep "$1" then
+	$(pwd) $(pwd) --verbose 'quoted text' /usr/bin local echo /usr/bin /usr/bin
+$(pwd) --verbose printf x=1 x=1 awk 'quoted text' printf
+	cd "$@" "$@" export readonly grep "$1" grep grep
+	"$1" "$1" /usr/bin "$1" $(pwd)
+local --verbose "$1" x=1
+grep -eu x=1 awk readonly readonly export && ${HOME} cd "$@" $(pwd)
+--verbose printf /usr/bin --verbose
+	"$1" $(pwd) 2>/dev/null grep
+	| --verbose echo ${HOME} readonly --verbose
+		$(pwd) echo sed "$@" | "$@" x=1 cd
+	echo -eu "$@" local echo awk "$@" 2>/dev/null test cd sed -eu local
+	readonly echo awk local grep ${HOME} 2>/dev/null
+	-eu grep printf awk readonly "$@" export
+"$1" x=1 && x=1 | /usr/bin "$@"
+	/usr/bin printf readonly $(pwd) "$1" "$1" test
+		"$1" readonly grep then
+		2>/dev/null sed grep /usr/bin printf
+		test x=1 sed "$1" readonly printf -eu printf "$@" /usr/bin $(pwd) x=1
+	test then done $(pwd) "$1" local
+"$@" cd 'quoted text' readonly
+		"$1" export 2>/dev/null
+	--verbose --verbose /usr/bin | cd "$@" readonly cd $(pwd)
+cd /usr/bin readonly "$@" export "$1" test local ${HOME} ${HOME} && done
+	done "$1" export local cd done x=1 $(pwd) ${HOME} done
+'quoted text' "$@" echo && readonly 'quoted text' --verbose local
+x=1 readonly test "$1" 2>/dev/null printf awk ${HOME} export then
+x=1 done $(pwd) readonly 'quoted text'
+	| 'quoted text' printf awk x=1 test local export local && /usr/bin done
+	grep && | export x=1 local then ${HOME} 'quoted text'
+printf sed --verbose sed && 'quoted text' "$@" grep grep x=1 test awk readonly "$1"
+	x=1 ${HOME} "$@" -eu local && 2>/dev/null sed test --verbose
+		'quoted text' printf done
+echo echo export export local "$@" "$1" awk sed grep -eu
+	"$@" done readonly ${HOME} sed ${HOME} && && done
+	echo readonly then ${HOME} |
+test ${HOME} export grep $(pwd) "$@" --verbose
+		local export grep readonly test test $(pwd) "$@" sed grep
+	echo x=1 export x=1 ${HOME} done && "$1" echo && sed $(pwd)
+	then then readonly 2>/dev/null export x=1 done $(pwd) x=1 && /usr/bin then
+$(pwd) $(pwd) "$1" "$@" echo
+"$@" sed "$@" -eu sed grep
+$(pwd) | "$1" local sed 2>/dev/null readonly
+	${HOME} then cd 2>/dev/null
+	printf local printf local cd echo cd then done && sed -eu 2>/dev/null local
+	test "$@" printf readonly awk local echo /usr/bin then 2>/dev/null then /usr/bin
+		&& readonly 2>/dev/null echo echo /usr/bin awk | && echo 2>/dev/null awk readonly
+	printf local 2>/dev/null x=1 cd cd -eu export grep readonly
+'quoted text' test $(pwd) 'quoted text'
+	| printf | x=1 readonly "$1" done
+		--verbose x=1 | export -eu --verbose awk x=1 sed readonly awk | test
+	--verbose echo sed 'quoted text' echo sed test cd awk
+		readonly -eu 2>/dev/null test "$1"
+	awk done -eu ${HOME} then export test sed
+x=1 --verbose "$@" x=1 export ${HOME} 2>/dev/null
+		awk -eu | $(pwd) ${HOME} ${HOME} printf done then test export awk sed local done
+readonly test export export -eu --verbose echo ${HOME} echo cd printf done
+echo 'quoted text' 'quoted text' 2>/dev/null cd local grep export printf &&
+		"$1" awk sed /usr/bin "$1" $(pwd) local /usr/bin
+printf /usr/bin x=1 x=1 ${HOME} awk test --verbose
+	-eu 'quoted text' -eu /usr/bin -eu 'quoted text' ${HOME} /usr/bin then local --verbose
+	sed readonly local $(pwd) cd done then
+local ${HOME} --verbose $(pwd) sed
+		export printf printf "$1" cd --verbose $(pwd) local printf
+x=1 --verbose test printf done export grep && done export "$1" 2>/dev/null
+$(pwd) test printf test | x=1
+		test done test "$1" local test then "$@" 2>/dev/null
+-eu "$1" -eu $(pwd) sed
+	export | then -eu cd local x=1 local
+awk 'quoted text' /usr/bin 'quoted text' "$1" awk ${HOME} 'quoted text'
+	/usr/bin && echo 2>/dev/null ${HOME}
+		export | "$1" 2>/dev/null then | | readonly --verbose
+| | test awk echo | ${HOME} | echo /usr/bin $(pwd) export export done "$1" done
+		test "$@" ${HOME} readonly "$1" 'quoted text'
+&& echo export | $(pwd) grep printf then then && --verbose
+	x=1 --verbose /usr/bin readonly && printf
+printf printf export --verbose | then 2>/dev/null 2>/dev/null /usr/bin
+	test echo && export /usr/bin | sed
+		then | --verbose local && "$1" done ${HOME} /usr/bin "$1"
+cd cd readonly awk export test printf --verbose ${HOME} export
+	test $(pwd) local --verbose done sed | --verbose /usr/bin "$1" awk echo
+sed 'quoted text' "$1" 2>/dev/null
+		-eu test cd echo awk sed readonly --verbose ${HOME} local
+	echo then -eu --verbose test $(pwd) "$@" echo test
+		2>/dev/null 2>/dev/null test readonly test grep sed -eu
+	/usr/bin local -eu | x=1 done --verbose local then done
+	${HOME} $(pwd) -eu 2>/dev/null -eu cd done
+	export grep $(pwd) 'quoted text' grep 2>/dev/null
+awk printf echo -eu "$1" --verbose then then readonly
+	2>/dev/null /usr/bin "$1" local printf x=1 | sed grep sed readonly
+	echo local then then local --verbose
+	${HOME} 'quoted text' readonly $(pwd) local "$@" 'quoted text' test
+	&& --verbose 'quoted text'
+	'quoted text' local --verbose readonly 2>/dev/null
+		test cd /usr/bin sed ${HOME} printf | readonly "$@" | cd 'quoted text' awk "$@"
+done x=1 /usr/bin 'quoted text' 'quoted text' "$1" export
+test cd export done ${HOME} test
+	echo 2>/dev/null export 'quoted text'
+	sed done | /usr/bin "$1" 2>/dev/null
+		local echo -eu $(pwd) -eu --verbose printf /usr/bin ${HOME} cd $(pwd) ${HOME} x=1
+"$@" --verbose "$1" $(pwd)
+	"$@" -eu -eu x=1 sed echo printf readonly ${HOME} x=1 local ${HOME} cd
+	printf "$@" cd awk && 2>/dev/null test x=1 && 2>/dev/null ${HOME}
+	&& --verbose $(pwd) | 2>/dev/null printf test echo
+		--verbose 'quoted text' done
+	local echo | export ${HOME} done 'quoted text' 'quoted text' ${HOME} printf
+done 2>/dev/null --verbose "$@" 2>/dev/null 2>/dev/null done printf
+export ${HOME} echo cd /usr/bin
+'quoted text' sed "$@" "$1" 'quoted text' export $(pwd)
+'quoted text' $(pwd) x=1 $(pwd) awk then done "$@" -eu
+	sed 2>/dev/null then local echo test done test /usr/bin
+		cd x=1 awk 'quoted text' x=1 test -eu "$1" printf
+	awk printf "$@" "$1" awk | printf awk x=1 | printf done -eu test
+		&& /usr/bin export cd "$1" awk && local ${HOME} export cd "$1" awk /usr/bin
+	printf -eu sed cd test 2>/dev/null grep readonly sed $(pwd) -eu 'quoted text'
+	grep "$@" echo --verbose
+	&& sed "$@" && /usr/bin -eu 'quoted text'
+2>/dev/null readonly /usr/bin done readonly --verbose export
+	-eu x=1 then "$@" --verbose
+		printf echo grep --verbose ${HOME} "$@" -eu grep ${HOME}
+'quoted text' readonly "$@" --verbose test && "$@"
+		| grep echo sed "$@" readonly ${HOME} 'quoted text' export "$1" test
+	test grep /usr/bin test grep && export grep
+'quoted text' x=1 then grep /usr/bin
+		-eu then local then done --verbose "$1" | then done test awk /usr/bin
+		export && && | -eu && x=1 $(pwd)
+		$(pwd) export awk grep "$@" $(pwd) echo cd --verbose
+	printf printf awk /usr/bin && awk 'quoted text' readonly ${HOME}
+	test /usr/bin then 2>/dev/null 'quoted text'
+-eu awk sed sed readonly done /usr/bin awk then grep | test
+		x=1 printf --verbose then echo | ${HOME} local test
+		readonly | "$1" 2>/dev/null printf local export "$@" &&
+$(pwd) sed printf x=1 cd export grep done | awk export grep
+	"$@" "$1" -eu ${HOME} echo 'quoted text' cd ${HOME} then awk then 'quoted text'
+	x=1 export sed /usr/bin readonly
+	export grep $(pwd) readonly --verbose sed 2>/dev/null done && local awk local 'quoted text'
+	export echo done ${HOME} done $(pwd) cd "$1" $(pwd) awk "$1" cd 2>/dev/null
+		--verbose then "$@" 2>/dev/null
+		grep export && readonly sed done then cd readonly 'quoted text' -eu
+	sed awk sed export cd grep 'quoted text' then --verbose /usr/bin then export
+		grep then x=1 sed /usr/bin echo "$1" readonly | grep local
+	grep grep -eu sed then 'quoted text'
+printf test cd /usr/bin --verbose readonly &&
+2>/dev/null $(pwd) --verbose cd "$@" printf sed test test readonly test
+	x=1 printf export x=1 x=1 printf $(pwd) x=1 done then readonly
+		$(pwd) -eu 2>/dev/null grep test done 'quoted text' ${HOME} grep "$1" 'quoted text'
+	/usr/bin 2>/dev/null && local local printf awk cd awk sed
+	local then printf done
+grep then local 2>/dev/null "$1" then cd ${HOME} test 2>/dev/null cd "$1" printf
+	'quoted text' echo /usr/bin then readonly
+	| awk 2>/dev/null x=1 --verbose then
+	&& export done 'quoted text'
+		printf readonly -eu then echo "$@" /usr/bin cd x=1 sed ${HOME} sed "$@" done printf
+	| echo -eu $(pwd) ${HOME} sed then export then readonly
+		x=1 local "$1" then then ${HOME} done x=1 awk && --verbose readonly
+printf awk cd echo echo done "$1" ${HOME} then echo
+		sed cd ${HOME} test printf
+	${HOME} cd $(pwd) sed cd done echo done sed sed
+&& then then "$1" ${HOME} $(pwd) awk then | x=1 "$@" done awk
+	cd readonly x=1 --verbose local x=1 -eu awk
+	sed done --verbose "$1" &&
+export export awk awk -eu then grep
+cd && x=1 | cd readonly | "$@" test sed grep 2>/dev/null -eu
+		then 2>/dev/null local cd x=1 |
+'quoted text' -eu && && local readonly grep 2>/dev/null
+		cd | 'quoted text' then test then x=1 "$1" export && sed printf printf
+	&& awk readonly readonly done echo $(pwd)
+		sed ${HOME} -eu export | cd 2>/dev/null
+	| export /usr/bin | echo printf "$@"
+		&& 'quoted text' done printf | /usr/bin $(pwd) && 'quoted text' printf /usr/bin
+echo echo && && test "$@" 'quoted text' cd "$@" | --verbose
+		/usr/bin readonly "$@" /usr/bin "$1" readonly test "$@" cd sed
+		"$@" $(pwd) --verbose | 2>/dev/null -eu sed $(pwd) awk --verbose
+		done 2>/dev/null "$@" cd /usr/bin cd -eu 'quoted text' 2>/dev/null
+x=1 && /usr/bin readonly done x=1 x=1 local 'quoted text'
+-eu export grep 'quoted text' then ${HOME} 'quoted text' readonly readonly -eu
+	local -eu awk export echo x=1 /usr/bin "$@" cd 2>/dev/null "$@" test
+		awk test sed printf | echo awk -eu echo echo done -eu "$@" 2>/dev/null
+&& local 'quoted text' awk 'quoted text' && export && export ${HOME} then "$@"
+echo $(pwd) printf 2>/dev/null export local
+		test /usr/bin export x=1 grep cd --verbose
+	readonly && cd "$@" printf grep grep then awk then local
+	grep "$@" && /usr/bin awk $(pwd) then export ${HOME}
+export printf ${HOME} /usr/bin --verbose
+	readonly $(pwd) ${HOME} /usr/bin local printf
+	test $(pwd) "$1" then "$1" $(pwd) readonly export echo
+		${HOME} 'quoted text' local cd local readonly echo grep test x=1 --verbose
+/usr/bin "$1" then test done x=1 /usr/bin
+	done "$1" 'quoted text' /usr/bin grep local | test
+grep /usr/bin export $(pwd) && --verbose
+		export x=1 2>/dev/null printf x=1 echo grep $(pwd) sed | /usr/bin 'quoted text'
+sed local grep cd then local echo readonly 2>/dev/null -eu ${HOME} "$@" echo
+	test x=1 2>/dev/null sed "$1" then local /usr/bin && readonly local sed export
+test local test -eu /usr/bin then | printf grep local readonly "$@" awk then
+	done local 'quoted text' $(pwd) export /usr/bin 2>/dev/null
+	-eu echo --verbose test sed --verbose cd "$@" awk "$@" export
+	$(pwd) --verbose --verbose local
+		cd grep export /usr/bin printf echo x=1 $(pwd) readonly
+		"$1" export ${HOME} echo
+		| | local && local $(pwd)
+	x=1 /usr/bin "$1" sed export $(pwd) cd awk cd | cd "$@" grep sed printf
+		&& --verbose "$@" ${HOME} "$1" --verbose
+	sed && ${HOME} /usr/bin x=1 local 'quoted text' sed -eu grep
+	| -eu "$1" test grep $(pwd) done
+		${HOME} && $(pwd) local then "$1" ${HOME} cd echo readonly sed then --verbose
+	sed cd cd "$@" readonly test ${HOME} "$@" sed awk readonly $(pwd) ${HOME} "$@"
+"$1" "$1" /usr/bin readonly export grep printf
+	"$1" grep "$@" cd | | done cd $(pwd) then readonly 'quoted text'
+		&& test ${HOME} test 2>/dev/null
+/usr/bin export 2>/dev/null /usr/bin && echo done export --verbose
+'quoted text' --verbose "$@" awk 'quoted text' awk local
+	"$1" echo /usr/bin $(pwd) done local "$@" 'quoted text' local
+grep $(pwd) -eu /usr/bin readonly
+$(pwd) cd | test echo --verbose -eu readonly sed cd
+		echo ${HOME} --verbose
+		local readonly -eu "$1" --verbose ${HOME} test local "$@"
+		echo then --verbose grep export /usr/bin local -eu --verbose
+		echo local x=1 ${HOME} export test $(pwd) /usr/bin printf ${HOME} $(pwd) 2>/dev/null
+&& echo 2>/dev/null && "$1" "$1" readonly done x=1 printf then cd grep
+		cd /usr/bin && 'quoted text' sed printf "$1" /usr/bin
+	x=1 cd -eu cd cd | grep test local test sed 'quoted text'
+		readonly /usr/bin ${HOME} -eu done x=1 then 'quoted text' export
+&& awk sed local grep 'quoted text' local cd cd --verbose awk x=1 readonly
+"$1" export grep export | x=1 then local | /usr/bin done local | cd | | echo
+x=1 "$1" cd awk echo /usr/bin
+"$1" -eu $(pwd) export export x=1 "$@" ${HOME} -eu readonly
+	${HOME} awk /usr/bin sed echo local "$@" then | then
+	echo export | && "$1" --verbose
+		awk | readonly awk && printf 'quoted text' sed grep export awk $(pwd) /usr/bin
+	readonly local x=1 x=1 ${HOME} grep done -eu 'quoted text' -eu printf
+	printf $(pwd) cd --verbose 2>/dev/null "$@" done
+	-eu echo 'quoted text' x=1 --verbose | --verbose
+	awk x=1 grep local -eu -eu then x=1 | 'quoted text'
+	2>/dev/null sed "$@" x=1 2>/dev/null ${HOME} then local 'quoted text' --verbose
+&& && grep 2>/dev/null "$1" then done export $(pwd) test then
+/usr/bin 'quoted text' echo cd 'quoted text' ${HOME}
+	"$@" sed readonly "$1" cd -eu
+local awk --verbose then export
+readonly then done grep echo done | $(pwd) | && && | sed $(pwd)
+		-eu "$@" export "$1" printf readonly done then cd ${HOME}
+local 'quoted text' -eu cd readonly "$1"
+&& sed test then then --verbose done cd sed
+${HOME} /usr/bin export awk readonly echo local x=1 | echo
+		"$@" export 2>/dev/null awk x=1 'quoted text' grep ${HOME} readonly local && x=1
+	'quoted text' 'quoted text' && awk
+	$(pwd) cd test && cd readonly "$1" ${HOME} then sed /usr/bin cd then printf
+		2>/dev/null then --verbose echo test done sed "$1" --verbose ${HOME}
+	cd grep export printf | then export --verbose && grep "$1" test "$1" "$1"
+	"$1" cd sed grep "$@" && local awk readonly && 2>/dev/null
+		awk cd done -eu export $(pwd) printf ${HOME} done then | then ${HOME} done
+awk then echo /usr/bin --verbose grep printf
+&& test grep ${HOME} "$1" export | -eu "$@" export grep
+"$@" 2>/dev/null | printf "$@" "$@" ${HOME} awk readonly local /usr/bin readonly
+	local then "$@" "$@" "$@" grep cd local 'quoted text' ${HOME} && && | readonly
+		-eu local -eu then export ${HOME} echo -eu --verbose 2>/dev/null
+	/usr/bin grep "$1" 2>/dev/null /usr/bin $(pwd) printf /usr/bin
+	2>/dev/null ${HOME} local "$1" cd then local ${HOME} sed then cd export awk 'quoted text'
+		"$1" "$1" --verbose test /usr/bin -eu awk echo echo export 'quoted text' "$@" then
+-eu --verbose $(pwd) "$@" $(pwd) sed readonly
+		done | awk test grep $(pwd) --verbose "$@" $(pwd) --verbose sed done local readonly
+		${HOME} export cd done cd echo sed 'quoted text'
+		printf "$@" sed echo export local local test awk echo --verbose
+		--verbose printf "$1" printf
+sed 'quoted text' 'quoted text' "$@" readonly readonly then then -eu
+		"$1" export grep export /usr/bin $(pwd)
+'quoted text' readonly | printf grep /usr/bin --verbose export echo 'quoted text'
+-eu /usr/bin then /usr/bin test 'quoted text'
+		sed awk printf echo $(pwd) done
+	$(pwd) x=1 local -eu -eu local export
+${HOME} --verbose local -eu $(pwd) local grep /usr/bin
+'quoted text' 2>/dev/null | x=1 && then echo -eu
+		--verbose readonly $(pwd) /usr/bin "$1" printf local local awk grep echo "$@"
+	printf 'quoted text' readonly
+export cd cd cd readonly
+	test "$@" /usr/bin then | grep /usr/bin export grep
+-eu $(pwd) grep export "$@" echo then
+	cd awk | echo 'quoted text' printf --verbose
+		cd echo 2>/dev/null awk "$@" --verbose echo | then /usr/bin /usr/bin echo 'quoted text'
+		done done x=1 | ${HOME}
+		| done grep grep /usr/bin $(pwd) cd x=1 ${HOME} "$1" readonly done ${HOME}
+		'quoted text' test x=1 'quoted text'
+then "$@" test /usr/bin echo echo 2>/dev/null
+		"$@" echo cd 'quoted text' echo ${HOME}
+		echo printf local printf && test ${HOME} printf | 2>/dev/null
+then | /usr/bin sed | && printf x=1 cd readonly
+	test 2>/dev/null local
+	${HOME} test local then "$@" $(pwd)
+/usr/bin | -eu "$1" export x=1 grep readonly printf
+	test export echo -eu sed x=1
+	then x=1 sed 2>/dev/null readonly then -eu "$1" "$1" test awk 'quoted text'
+	echo x=1 done x=1 $(pwd) echo $(pwd) echo $(pwd) $(pwd) "$1"
+echo ${HOME} then ${HOME} grep printf export --verbose 2>/dev/null
+		"$1" readonly grep $(pwd) test sed | test export echo cd printf sed
+/usr/bin cd cd printf local echo awk cd local 'quoted text'
+		cd then | grep "$1" grep 2>/dev/null
+		done -eu test sed local x=1 echo then export then --verbose
+		readonly ${HOME} echo --verbose cd test -eu awk | awk
+		/usr/bin "$@" readonly --verbose && sed printf sed grep | awk echo
+2>/dev/null cd echo awk readonly test export grep && --verbose $(pwd) sed 2>/dev/null
+		x=1 test readonly sed "$1" -eu readonly local --verbose
+	-eu /usr/bin "$1" "$1" sed "$@" readonly
+local 2>/dev/null then 2>/dev/null "$@" sed -eu
+	awk --verbose && 'quoted text'
+	then echo $(pwd) /usr/bin x=1
+		then sed 2>/dev/null sed "$@" export "$@" -eu readonly /usr/bin readonly
+		readonly 'quoted text' printf sed "$1" grep 2>/dev/null &&
+	done && -eu | awk $(pwd) readonly -eu done /usr/bin grep
+	done echo local readonly
+	awk printf | "$@" grep 2>/dev/null
+	&& echo --verbose ${HOME} sed cd printf printf printf printf "$@" readonly
+	awk 'quoted text' $(pwd) echo "$1" /usr/bin awk
+--verbose "$@" -eu "$1" | --verbose local readonly printf --verbose 'quoted text'
+		printf | printf | 'quoted text' -eu
+		done ${HOME} then "$@" export test -eu echo "$1" /usr/bin
+		${HOME} ${HOME} | readonly cd && done
+		&& export awk && x=1 && $(pwd) "$@" "$1"
+	-eu done done ${HOME}
+	${HOME} 2>/dev/null awk awk && 2>/dev/null cd "$1" done 'quoted text' ${HOME}
+		2>/dev/null | $(pwd) test test cd | printf
+		x=1 grep printf printf printf printf $(pwd) sed "$1" | x=1 "$1"
+	grep printf | $(pwd) cd printf /usr/bin --verbose then cd 2>/dev/null
+		${HOME} && then /usr/bin x=1
+	cd --verbose done export | x=1 -eu local awk x=1 --verbose
+		then local --verbose "$1" "$1" done 2>/dev/null export x=1 'quoted text'
+	readonly -eu x=1 then "$1" done | && export
+		cd --verbose local | awk "$1"
+	--verbose --verbose done && -eu x=1 |
+	$(pwd) test printf awk local grep printf | "$@"
+grep grep cd --verbose $(pwd) cd "$@" printf local 2>/dev/null x=1 cd --verbose
+&& done --verbose local echo $(pwd)
+		/usr/bin grep ${HOME} $(pwd) awk printf test 'quoted text'
+	x=1 ${HOME} printf awk $(pwd) -eu
+	printf 'quoted text' 'quoted text' grep sed grep done
+		${HOME} sed | readonly readonly && test -eu test
+		grep then awk awk "$1" then echo then printf ${HOME} | awk printf
+	/usr/bin done printf x=1 cd /usr/bin local x=1 local 2>/dev/null readonly
+	"$1" && 'quoted text' ${HOME} -eu cd 2>/dev/null "$1" export
+test && local ${HOME} cd readonly done /usr/bin -eu test 2>/dev/null $(pwd)
+		readonly test 2>/dev/null 2>/dev/null local && export echo -eu
+	sed ${HOME} sed readonly test x=1 /usr/bin test -eu sed
+		test cd printf $(pwd) | x=1 printf done x=1 export local
+awk readonly cd printf local 'quoted text' then export echo "$@" | --verbose
+		'quoted text' readonly | 2>/dev/null printf printf
+	| | cd -eu readonly $(pwd) && export test grep /usr/bin && 2>/dev/null done
+'quoted text' cd cd $(pwd) cd then "$1" readonly cd printf grep "$@" 'quoted text'
+	'quoted text' $(pwd) 'quoted text'
+	2>/dev/null printf $(pwd) x=1 sed && 'quoted text' 'quoted text' export
+		grep 2>/dev/null awk -eu cd local --verbose awk $(pwd) printf "$1" "$@" echo readonly
+	then then test ${HOME} -eu /usr/bin
+	grep /usr/bin printf test done local printf "$@"
+		test | 'quoted text' done ${HOME} &&
+	"$@" && printf /usr/bin "$@" --verbose -eu /usr/bin x=1 sed $(pwd) printf |
+		/usr/bin printf grep then "$1" /usr/bin
+printf 'quoted text' test "$@" printf export -eu 2>/dev/null test -eu "$1" "$@"
+		"$1" local cd then export ${HOME} export readonly
+		printf readonly $(pwd) awk test --verbose && export | test "$@"
+readonly test export local
+		echo -eu grep | x=1 test --verbose test x=1 export
+	${HOME} /usr/bin x=1 && -eu "$1"
+	| "$1" export 2>/dev/null test local 'quoted text' printf local --verbose local
+	grep ${HOME} 'quoted text' 2>/dev/null x=1 test export done test --verbose --verbose
+		x=1 export export ${HOME} sed "$@" --verbose && printf
+printf "$1" --verbose then && -eu 2>/dev/null
+	awk "$1" test test test && -eu awk x=1 2>/dev/null cd test local
+	readonly | ${HOME} awk sed export
+		printf && export then &&
+	&& echo -eu 2>/dev/null printf x=1 readonly export |
+		| echo awk grep /usr/bin 'quoted text'
+		/usr/bin sed $(pwd) then echo awk | local readonly
+	$(pwd) 'quoted text' awk 'quoted text' readonly export
+"$1" 2>/dev/null 2>/dev/null x=1 x=1 "$@" export printf export
+	'quoted text' echo printf ${HOME} echo sed 'quoted text'
+then /usr/bin ${HOME} printf --verbose -eu then then | /usr/bin -eu export done
+	test test x=1 $(pwd) echo awk x=1 ${HOME} 2>/dev/null && local done cd --verbose
+		export printf "$@" "$@" $(pwd) export readonly test then export
+2>/dev/null awk -eu cd 2>/dev/null cd | "$1" /usr/bin done x=1
+test sed && --verbose sed x=1 grep 2>/dev/null local ${HOME} local
+		/usr/bin -eu cd $(pwd) /usr/bin 'quoted text' /usr/bin && | -eu export
+readonly test grep done sed
+		/usr/bin $(pwd) "$1" && sed then printf then sed printf
+	sed --verbose awk /usr/bin $(pwd) 2>/dev/null grep awk 2>/dev/null local ${HOME}
+	awk 2>/dev/null && awk "$@"
+		grep "$1" "$@" | echo readonly /usr/bin 'quoted text'
+	test readonly --verbose awk echo awk "$1" 2>/dev/null local "$1" export |
+		then | printf then local done x=1
+	done test "$1" x=1 sed /usr/bin "$1" echo then /usr/bin cd then "$@" $(pwd)
+done sed echo awk awk then
+echo echo 'quoted text' $(pwd) 2>/dev/null printf ${HOME} ${HOME}
+		then grep export readonly grep
+awk grep grep --verbose $(pwd) grep done cd "$1" x=1 && x=1 x=1 && done --verbose
+| local ${HOME} $(pwd) echo | local
+		--verbose 2>/dev/null test | $(pwd) sed 'quoted text'
+readonly 'quoted text' 2>/dev/null echo $(pwd) -eu awk && "$@"
+	${HOME} readonly x=1 ${HOME} printf | done "$@" local
+	2>/dev/null ${HOME} | ${HOME} -eu "$1" -eu /usr/bin readonly
+		then $(pwd) awk done ${HOME} "$@" grep | ${HOME} "$@"
+| export x=1 --verbose awk local | $(pwd) && export
+-eu "$@" "$1" local x=1 $(pwd) 'quoted text' printf
+"$@" echo /usr/bin readonly $(pwd) -eu done x=1 cd awk awk --verbose
+--verbose printf ${HOME} export test sed then 'quoted text' done /usr/bin done
+	export "$@" 2>/dev/null 2>/dev/null --verbose
+		grep export then cd printf local -eu ${HOME}
+then cd | then x=1 test then x=1 2>/dev/null
+	export -eu echo $(pwd) | done echo done test done ${HOME} "$1" readonly "$1"
+"$@" "$1" | cd x=1 && test export x=1 $(pwd)
+	${HOME} awk sed sed done sed --verbose export && then
+then && printf /usr/bin ${HOME} ${HOME}
+		awk $(pwd) printf cd local $(pwd)
+--verbose ${HOME} grep awk 2>/dev/null cd test
+local "$1" --verbose then done echo echo --verbose
+sed 2>/dev/null test cd 'quoted text' local
+	printf local -eu echo ${HOME} ${HOME} $(pwd) cd "$@" done x=1 awk test x=1 echo
+x=1 2>/dev/null "$@" awk test printf "$@" cd -eu && done
+	test local x=1 $(pwd) $(pwd) 'quoted text' echo "$@" readonly export
+/usr/bin readonly -eu && export sed | done readonly /usr/bin
+		| -eu awk grep x=1 | | 2>/dev/null done && | x=1 'quoted text' 'quoted text'
+		$(pwd) 'quoted text' local printf --verbose ${HOME}
+		printf /usr/bin echo cd ${HOME}
+	/usr/bin awk sed 2>/dev/null x=1 done ${HOME} grep
+	export "$@" grep sed local
+$(pwd) 2>/dev/null 'quoted text' && grep export
+		grep 'quoted text' --verbose 2>/dev/null
+	echo "$1" x=1 sed echo 2>/dev/null readonly then | cd | | local && /usr/bin
+		&& echo "$@" $(pwd) sed /usr/bin $(pwd) x=1 --verbose x=1 && cd $(pwd)
+		grep done $(pwd) awk -eu grep "$1" 2>/dev/null -eu printf $(pwd)
+		"$@" --verbose ${HOME} "$1" sed ${HOME}
+	2>/dev/null "$1" sed /usr/bin printf -eu then cd cd sed
+$(pwd) --verbose readonly /usr/bin | local export
+		$(pwd) cd sed -eu cd sed ${HOME} then 'quoted text' $(pwd) then "$1" printf
+	&& awk echo readonly sed "$@" then | test cd test test --verbose 'quoted text'
+		done 2>/dev/null $(pwd) --verbose 2>/dev/null test x=1 export printf
+		test 'quoted text' readonly
+test awk readonly --verbose done
+		done x=1 "$@" echo "$@" grep /usr/bin cd && 2>/dev/null local "$1" 'quoted text'
+		local ${HOME} export x=1 grep readonly
+		${HOME} 'quoted text' test 'quoted text' cd local && ${HOME}
+	echo -eu sed && /usr/bin printf && $(pwd) && sed -eu done echo local
+	done -eu 2>/dev/null
+		$(pwd) -eu done -eu -eu /usr/bin /usr/bin
+	$(pwd) grep export && then 2>/dev/null
+	export then grep "$1" 2>/dev/null "$1" cd grep test local then
+| && done ${HOME} local
+	"$1" "$1" x=1 echo local && sed
+	'quoted text' local -eu /usr/bin && then test /usr/bin "$@" $(pwd) 'quoted text'
+test 2>/dev/null test cd readonly | local readonly --verbose 2>/dev/null
+"$1" cd echo | done readonly
+--verbose --verbose 'quoted text'
+	awk "$@" export | awk cd awk 2>/dev/null cd grep "$1" awk
+		printf awk done readonly "$@"
+	-eu x=1 printf | "$1" ${HOME}
+/usr/bin /usr/bin "$1" ${HOME} then | --verbose 2>/dev/null /usr/bin
+		| grep --verbose 'quoted text'
+	"$@" local "$@" x=1 /usr/bin && 'quoted text' then /usr/bin test local ${HOME}
+	| | echo -eu cd done readonly && echo sed -eu && "$1" export
+		"$@" ${HOME} | $(pwd) cd awk x=1 2>/dev/null grep sed echo x=1
+		"$@" test local echo then && | 2>/dev/null export 'quoted text'
+	export sed $(pwd) test "$@" "$@" ${HOME} printf && local 'quoted text'
+		"$@" ${HOME} awk ${HOME} readonly
+	echo readonly 'quoted text' && x=1 readonly printf && then then export awk
+		x=1 echo --verbose $(pwd) -eu local -eu -eu -eu test && ${HOME} --verbose
+		/usr/bin 'quoted text' echo test readonly && awk readonly | 'quoted text'
+printf then 'quoted text'
+awk 2>/dev/null grep ${HOME} && local "$1" cd test
+		export export grep --verbose x=1 awk |
+2>/dev/null x=1 && -eu "$@" readonly
+sed "$@" "$@" $(pwd) done grep "$1"
+		then "$1" local local readonly ${HOME} local sed grep x=1
+	--verbose printf x=1 $(pwd) sed then echo local
+		2>/dev/null test && printf export test 2>/dev/null x=1 | | | $(pwd)
+		echo "$1" printf done "$@" ${HOME} awk /usr/bin "$@" echo && | "$1" done
+cd awk $(pwd) cd x=1 ${HOME} test local export x=1
+	sed /usr/bin sed grep echo then | --verbose export
+done printf then | done /usr/bin "$@" -eu awk grep 'quoted text' test | &&
+	"$1" "$@" 'quoted text' then ${HOME} --verbose grep awk
+		| then x=1 done echo && export "$1" awk
+&& $(pwd) echo 'quoted text'
+	echo cd sed ${HOME} echo grep local cd "$@"
+cd local "$@" grep printf /usr/bin 'quoted text' test "$1" local cd grep readonly
+&& then ${HOME} "$1" then grep
+| x=1 --verbose cd local /usr/bin && /usr/bin -eu ${HOME} test ${HOME} test
+		&& readonly -eu x=1 /usr/bin && echo awk readonly sed --verbose
+"$1" cd /usr/bin 'quoted text' test && sed && | /usr/bin --verbose cd |
+	x=1 /usr/bin test "$@" test printf 2>/dev/null printf cd echo printf /usr/bin
+	-eu "$1" awk /usr/bin sed "$@" ${HOME} $(pwd) && printf | x=1 grep "$@" x=1
+		local && "$1" --verbose | x=1 $(pwd) && -eu cd && readonly awk export
+	grep sed x=1 x=1 'quoted text' test /usr/bin 'quoted text' printf echo then
+		${HOME} cd ${HOME} "$1" && "$1" test cd "$1" done done done sed x=1 then
+		grep test 2>/dev/null -eu grep 2>/dev/null
+		then && awk "$1" 'quoted text' done sed x=1 sed x=1 local | local grep
+	printf | test awk test sed $(pwd) --verbose
+		cd | echo grep /usr/bin | awk awk echo && then && "$1" /usr/bin
+readonly test -eu awk
+	--verbose ${HOME} grep grep awk
+	grep local cd x=1 done local && then cd readonly | done --verbose
+		grep $(pwd) -eu test /usr/bin
+		&& /usr/bin grep ${HOME} | $(pwd) export x=1 printf done cd done done
+	| | /usr/bin export export
+	then 2>/dev/null $(pwd) then && --verbose local local
+2>/dev/null x=1 x=1 && printf -eu | -eu ${HOME} x=1 /usr/bin test test
+		readonly readonly /usr/bin done /usr/bin 2>/dev/null
+	local "$@" -eu test cd readonly export sed echo 2>/dev/null 2>/dev/null grep --verbose
+	awk $(pwd) then /usr/bin && 2>/dev/null readonly cd then
+	cd "$@" 2>/dev/null sed then ${HOME} test 2>/dev/null printf export done awk --verbose
+		awk readonly awk 'quoted text' grep | /usr/bin
+	awk "$@" | readonly readonly -eu | grep grep | awk grep done then grep x=1 | sed
+&& x=1 /usr/bin "$1" printf -eu then echo 'quoted text'
+then readonly x=1 --verbose readonly local 2>/dev/null
+/usr/bin "$@" | test awk /usr/bin readonly export
+	2>/dev/null | 'quoted text'
+		$(pwd) -eu --verbose && done cd /usr/bin "$@" 'quoted text' "$@" &&
+		"$1" ${HOME} export grep "$@" sed printf "$1" $(pwd) grep --verbose
+		| test cd --verbose grep ${HOME} /usr/bin sed /usr/bin 'quoted text'
+		&& "$1" | $(pwd) sed export | done && -eu | /usr/bin && echo cd local
+		export && readonly -eu then printf
+	x=1 x=1 grep 2>/dev/null sed grep ${HOME} test awk sed
+x=1 && ${HOME} "$@" ${HOME}
+		local echo "$1" "$@" done
+sed 'quoted text' cd "$@" /usr/bin -eu && grep $(pwd) --verbose cd 2>/dev/null sed
+	printf sed sed local "$1" $(pwd) --verbose printf done test
+	&& -eu readonly ${HOME} echo then done $(pwd) | "$@" printf test
+then --verbose local "$@" awk test local | /usr/bin test grep $(pwd) cd
+	readonly then then && -eu then /usr/bin $(pwd) && /usr/bin
+		printf awk awk grep | 2>/dev/null
+		cd "$@" echo x=1 2>/dev/null "$1" && ${HOME} /usr/bin sed --verbose
+		sed | echo readonly 2>/dev/null printf "$1"
+		done $(pwd) echo "$1" done | "$@" --verbose x=1 sed
+--verbose echo && then 2>/dev/null
+		"$1" printf 2>/dev/null test test
+cd 'quoted text' x=1 /usr/bin sed x=1 done ${HOME} then x=1 echo export sed
+echo then $(pwd) cd "$1" then | test awk echo 'quoted text' 'quoted text' /usr/bin
+	then readonly then | ${HOME} &&
+	done done --verbose export $(pwd) 2>/dev/null | grep grep
+		'quoted text' cd --verbose readonly
+$(pwd) grep done "$@" /usr/bin 2>/dev/null /usr/bin
+		&& && 2>/dev/null 2>/dev/null export ${HOME} 'quoted text' grep
+test awk cd echo export && 2>/dev/null
+		printf grep | local printf 2>/dev/null
+/usr/bin local $(pwd) "$1" then local ${HOME} $(pwd)
+		$(pwd) readonly grep /usr/bin export /usr/bin local sed
+		printf 'quoted text' then --verbose awk | echo
+	/usr/bin sed local local && printf "$@" /usr/bin sed x=1 -eu local then 2>/dev/null
+	x=1 done sed printf "$@"
+		| x=1 x=1 cd export -eu 2>/dev/null 2>/dev/null
+"$1" export done done -eu echo echo cd done && "$@" sed --verbose | done $(pwd)
+	printf echo export readonly ${HOME} grep 2>/dev/null
+		"$@" awk 'quoted text' --verbose
+awk | | readonly /usr/bin --verbose | "$@" cd "$1" ${HOME}
+&& /usr/bin 'quoted text' && test $(pwd) grep export test
+	local awk cd sed 2>/dev/null
+	done /usr/bin -eu test
+/usr/bin then sed -eu done
+		-eu awk local readonly --verbose test ${HOME} printf --verbose
+-eu sed -eu cd readonly "$@" $(pwd) && ${HOME} "$1" $(pwd) 'quoted text'
+		readonly 'quoted text' then 2>/dev/null x=1 local
+	grep then 'quoted text' local | printf -eu
+	--verbose done x=1 done then sed done
+echo cd x=1 cd sed "$@" "$1" sed
+		export && /usr/bin | x=1 && awk echo ${HOME} printf local readonly --verbose --verbose
+	${HOME} readonly /usr/bin "$@" grep
+	printf --verbose "$1" $(pwd) echo sed x=1 --verbose x=1 $(pwd) then local ${HOME}
+		done x=1 export 'quoted text' 'quoted text' readonly ${HOME}
+grep echo ${HOME} $(pwd) ${HOME} awk ${HOME} awk $(pwd) --verbose --verbose
+x=1 ${HOME} awk -eu done /usr/bin x=1 x=1
+		local "$@" done done local cd sed /usr/bin then -eu 2>/dev/null test --verbose
+-eu printf export sed printf
+	'quoted text' --verbose | local awk --verbose done "$1" --verbose ${HOME}
+2>/dev/null --verbose local --verbose "$@" echo && readonly cd && printf local
+echo $(pwd) readonly local cd local done && $(pwd) "$@" 2>/dev/null ${HOME}
+printf readonly x=1 printf test sed --verbose grep "$1" "$1"
+"$@" test "$1" "$@" $(pwd) cd $(pwd) then --verbose
+		local --verbose test echo cd ${HOME} /usr/bin
+	printf ${HOME} test export $(pwd) "$1" 2>/dev/null done echo grep /usr/bin
+		then sed -eu grep ${HOME} /usr/bin
+2>/dev/null --verbose export 'quoted text'
+test --verbose printf readonly ${HOME} "$@" then | $(pwd) x=1 then /usr/bin
+		--verbose /usr/bin echo ${HOME}
+	&& | "$1" readonly x=1 | "$@" echo
+	2>/dev/null local grep sed x=1 $(pwd) "$@"
+		${HOME} awk awk export x=1 && "$1" test readonly && grep then 2>/dev/null
+		done readonly "$@" x=1 cd 'quoted text' printf "$1"
+		'quoted text' local | 2>/dev/null | echo
+	--verbose awk x=1 'quoted text' readonly printf
+done sed then export /usr/bin then "$@" x=1 2>/dev/null echo test
+	${HOME} printf /usr/bin readonly awk grep ${HOME} test "$@" sed | then grep
+--verbose x=1 echo x=1 'quoted text'
+		local cd | x=1 $(pwd) done cd -eu grep grep test done
+		-eu "$@" 'quoted text' then done awk | echo grep
+	'quoted text' --verbose ${HOME} | ${HOME}
+	-eu test sed grep test cd awk 'quoted text' cd $(pwd)
+	printf x=1 export awk $(pwd) --verbose 2>/dev/null 2>/dev/null -eu done
+		local test 2>/dev/null
+'quoted text' printf sed test && echo readonly | --verbose export
+	sed -eu ${HOME} test export local cd grep echo test
+		$(pwd) ${HOME} awk done -eu --verbose
+		done "$@" readonly done /usr/bin done cd cd test /usr/bin cd readonly x=1
+then cd 'quoted text' export "$@" then ${HOME} x=1 local | "$@"
+done "$1" export grep -eu test awk 2>/dev/null done --verbose
+		&& "$1" awk | local -eu then
+	x=1 echo "$@" "$@" && done awk local local export
+	x=1 printf && $(pwd) local then && "$1" sed
+	-eu 'quoted text' cd sed cd "$1" 'quoted text' sed --verbose echo cd
+	$(pwd) test --verbose | --verbose /usr/bin ${HOME} $(pwd) x=1 && then
+		| done printf sed then then && -eu
+	sed | /usr/bin /usr/bin local /usr/bin echo printf 2>/dev/null printf 'quoted text'
+		&& done echo x=1 awk cd "$@" test $(pwd) "$1"
+	export ${HOME} export 2>/dev/null --verbose grep readonly then test
+		sed | x=1 "$@" "$1" echo awk export grep && && /usr/bin
+	test grep ${HOME} local $(pwd) local cd local grep echo 'quoted text'
+awk && --verbose cd done 2>/dev/null "$1" x=1 "$1"
+	&& && | grep $(pwd) then echo local cd export sed $(pwd) ${HOME} cd --verbose
+done 'quoted text' "$1" "$1" && --verbose 'quoted text' awk
+printf x=1 | 2>/dev/null | local grep 'quoted text' /usr/bin sed readonly
+		export /usr/bin echo
+	export && $(pwd) then -eu awk readonly /usr/bin then awk -eu cd ${HOME}
+		cd x=1 "$@" test local printf cd "$1" --verbose
+		test $(pwd) local sed
+	readonly test --verbose ${HOME} readonly /usr/bin printf /usr/bin cd awk
+		grep "$1" "$1" readonly | then then --verbose
+2>/dev/null export -eu test
+test cd local printf sed export -eu "$1" 'quoted text' 2>/dev/null export /usr/bin
+then sed test 2>/dev/null
+		"$1" done cd awk printf --verbose test readonly "$@" -eu awk awk "$@"
+echo grep "$@" /usr/bin
+sed /usr/bin --verbose test x=1 local 2>/dev/null printf 'quoted text'
+	/usr/bin $(pwd) local echo ${HOME}
+		/usr/bin local | test /usr/bin x=1 /usr/bin
+	$(pwd) "$1" --verbose ${HOME} test awk local | "$1" $(pwd) "$@" test
+	"$1" awk echo sed $(pwd) -eu then $(pwd) printf x=1 export 'quoted text'
+	printf && 'quoted text' ${HOME} echo -eu readonly
+		"$1" test ${HOME} "$@" x=1 sed && readonly ${HOME} | test $(pwd) 'quoted text'
+	printf && local /usr/bin cd sed then test /usr/bin
+--verbose echo /usr/bin x=1 then done -eu | x=1
+${HOME} sed cd grep | && $(pwd) sed "$@" &&
+	${HOME} "$@" grep && 'quoted text'
+		sed echo export test x=1 -eu readonly "$@" "$1" /usr/bin /usr/bin $(pwd) done
+&& --verbose readonly readonly local local export sed "$@" -eu --verbose
+	--verbose export printf local x=1 && "$1" | "$1"
+'quoted text' "$@" "$1" then export echo
+x=1 ${HOME} -eu then 2>/dev/null --verbose awk /usr/bin readonly
+	cd x=1 export echo "$1" "$@" -eu test printf $(pwd) readonly grep sed grep x=1
+cd --verbose "$@" test ${HOME} 2>/dev/null x=1 done "$1" 2>/dev/null then export
+"$@" && readonly | 'quoted text'
+	done $(pwd) 2>/dev/null export -eu sed
+test /usr/bin then cd sed done "$1" "$@" /usr/bin then
+x=1 'quoted text' awk test readonly "$1" sed done echo awk sed sed sed
+		/usr/bin printf /usr/bin x=1
+	then echo sed && sed export done
+		printf /usr/bin | --verbose cd then 2>/dev/null
+		"$@" 2>/dev/null then export then test then -eu test then export /usr/bin grep
+/usr/bin x=1 printf printf then 2>/dev/null
+		sed -eu done printf grep x=1 x=1 then local ${HOME} sed printf /usr/bin "$@"
+#include c137.sh
+test "$1" /usr/bin done local readonly "$1" 2>/dev/null
+done | $(pwd) then awk test echo ${HOME} | 2>/dev/null
+awk | done && 2>/dev/null | sed x=1 x=1 "$1" export x=1 readonly echo &&
+		test -eu grep -eu "$1" 2>/dev/null local -eu then echo
+		grep echo -eu done $(pwd) /usr/bin --verbose then echo done grep awk && cd 'quoted text'
+		printf done /usr/bin ${HOME} 'quoted text'
+		/usr/bin --verbose test "$1" 2>/dev/null -eu 'quoted text' echo local "$@" /usr/bin
+	"$1" "$@" then && 2>/dev/null done echo
+		"$1" then "$@" 'quoted text' $(pwd) | 2>/dev/null x=1
+grep --verbose -eu readonly printf echo --verbose cd "$1"
+cd grep echo done cd printf done $(pwd) && /usr/bin readonly export printf
+	x=1 awk -eu /usr/bin sed | "$@" --verbose
+	awk "$1" cd && "$@" && | export echo
+	/usr/bin ${HOME} local sed printf
+x=1 printf echo && 2>/dev/null "$1" echo | && readonly 'quoted text'
+sed awk 'quoted text' test readonly /usr/bin done
+		&& 'quoted text' --verbose done sed
+		${HOME} | export awk echo local 'quoted text' local
+	sed done -eu done then && sed --verbose test -eu awk /usr/bin "$1" /usr/bin
+		test x=1 readonly && awk 2>/dev/null grep export done 'quoted text' ${HOME} done
+	sed echo local cd readonly x=1 export $(pwd) x=1 test
+		echo sed 2>/dev/null "$1"
+	local --verbose sed awk readonly -eu echo
+	2>/dev/null awk export done echo then local readonly
+		awk printf then sed printf grep echo test grep ${HOME} $(pwd) 'quoted text'
+	x=1 'quoted text' local done | awk /usr/bin ${HOME} local
+		echo --verbose 'quoted text'
+		printf 'quoted text' printf -eu sed "$@" x=1 2>/dev/null cd
+	export | "$1" -eu echo cd /usr/bin && 2>/dev/null grep cd grep echo
+	$(pwd) test --verbose 2>/dev/null ${HOME} done && "$@" x=1 export test printf
+		/usr/bin "$@" test echo then 'quoted text'
+'quoted text' | sed -eu test --verbose -eu test then
+/usr/bin awk local echo 2>/dev/null awk done done "$@" test /usr/bin
+2>/dev/null printf echo 2>/dev/null then "$1" then 2>/dev/null
+		/usr/bin "$@" 'quoted text' sed $(pwd) --verbose &&
+| done "$1" -eu sed 2>/dev/null
+test x=1 export 'quoted text' done sed readonly ${HOME} test printf
+	done then 2>/dev/null -eu && printf ${HOME} "$1" | printf 2>/dev/null /usr/bin
+	done /usr/bin ${HOME} sed --verbose cd then then then done
+/usr/bin -eu -eu 2>/dev/null && ${HOME} readonly "$1" done cd test
+		x=1 ${HOME} ${HOME} && then export x=1 && then && $(pwd) /usr/bin
+'quoted text' "$1" /usr/bin
+	cd 2>/dev/null /usr/bin 2>/dev/null 2>/dev/null
+printf $(pwd) && x=1 test sed local && "$@" export --verbose export done $(pwd)
+	awk /usr/bin 2>/dev/null export readonly awk | ${HOME} $(pwd) 'quoted text'
+| printf cd grep /usr/bin done 'quoted text' | awk $(pwd) cd 2>/dev/null
+echo | | awk printf /usr/bin test
+cd grep "$1" done "$@" 2>/dev/null ${HOME} /usr/bin /usr/bin "$@"
+x=1 "$@" export ${HOME} then cd cd grep cd grep readonly --verbose
+2>/dev/null then cd && "$1" awk done --verbose | awk
+	sed && awk 'quoted text' x=1 cd "$1" && then 'quoted text' 'quoted text'
+	/usr/bin test awk readonly printf local && /usr/bin $(pwd) then sed done x=1
+		sed --verbose -eu export cd export export
+-eu local -eu | sed 'quoted text' && sed 2>/dev/null
+test "$1" printf x=1 test /usr/bin --verbose
+	$(pwd) cd 2>/dev/null local /usr/bin echo && export
+		grep /usr/bin && awk "$1" sed "$1" /usr/bin x=1 printf local local
+		local | && 'quoted text' cd sed
+cd printf done 2>/dev/null x=1 printf echo printf 'quoted text' /usr/bin
+	/usr/bin -eu cd awk /usr/bin /usr/bin
+	local 2>/dev/null && printf $(pwd) -eu grep cd | then echo
+		"$1" grep export test then
+printf echo ${HOME} test cd && "$1" 2>/dev/null done awk 2>/dev/null
+		| printf x=1 'quoted text' grep ${HOME}
+	done 2>/dev/null -eu -eu local printf && printf 2>/dev/null 2>/dev/null | done
+		${HOME} x=1 test 2>/dev/null
+		| done test 2>/dev/null awk | local sed x=1 readonly awk test grep &&
+		local ${HOME} done -eu "$@" 'quoted text'
+	"$1" echo -eu 2>/dev/null ${HOME} x=1 /usr/bin "$@" x=1 /usr/bin
+	readonly $(pwd) ${HOME} then printf sed && $(pwd) x=1 && then ${HOME} test
+done /usr/bin $(pwd) readonly export readonly awk echo | sed sed $(pwd)
+		${HOME} readonly grep sed 'quoted text'
+		$(pwd) test && 'quoted text' readonly
+	&& /usr/bin test test 'quoted text'
+	$(pwd) --verbose awk 2>/dev/null "$@" export | echo
+sed -eu 2>/dev/null cd /usr/bin
+		&& readonly 2>/dev/null -eu readonly $(pwd) export
+		done $(pwd) local done ${HOME} $(pwd) readonly awk printf && test --verbose
+	printf "$@" export echo && export export cd cd && /usr/bin test
+	then x=1 && grep echo ${HOME} &&
+		printf readonly cd then "$1" && 'quoted text' x=1 readonly sed "$@" && 'quoted text'
+$(pwd) readonly --verbose local
+	cd printf && "$@" 'quoted text' "$1" 2>/dev/null
+		2>/dev/null | -eu then 2>/dev/null
+		export grep && export "$1" grep echo cd "$@" awk
+	-eu ${HOME} grep x=1 sed
+		printf --verbose $(pwd)
+		&& "$@" | "$1" done ${HOME} /usr/bin test echo cd done && && local
+done echo test done 2>/dev/null --verbose "$@" cd && printf "$1" awk "$1" --verbose
+--verbose x=1 then /usr/bin "$1" $(pwd) printf done 2>/dev/null /usr/bin echo
+		echo local local 2>/dev/null cd cd readonly then local awk done
+--verbose x=1 done -eu grep /usr/bin
+		readonly then -eu test $(pwd) --verbose readonly
+awk | export printf $(pwd) $(pwd) cd cd "$@" 'quoted text'
+		-eu echo done then echo then
+	done done test awk done &&
+	grep /usr/bin 2>/dev/null 2>/dev/null 2>/dev/null -eu 'quoted text'
+	&& grep awk printf x=1 printf 2>/dev/null grep 2>/dev/null done x=1 printf "$@"
+		--verbose grep "$1" export | readonly readonly
+		--verbose awk done readonly test
+grep 'quoted text' -eu echo | 'quoted text' $(pwd) sed && ${HOME} awk $(pwd)
+		export ${HOME} | readonly test done echo local ${HOME}
+		&& then export --verbose local export --verbose readonly done done /usr/bin
+	"$1" 'quoted text' echo /usr/bin local x=1 awk /usr/bin "$@" then
+	| 'quoted text' && | readonly test grep readonly "$1" && "$1" test local grep
+	then | /usr/bin export grep --verbose cd | "$1" test | $(pwd) 'quoted text' sed
+| sed readonly 2>/dev/null ${HOME} -eu 'quoted text'
+"$1" "$1" --verbose 2>/dev/null "$1" && then sed
+local awk echo ${HOME} 'quoted text' done | echo test echo
+	then x=1 test sed | grep "$@" sed export then /usr/bin readonly test
+		"$@" $(pwd) echo cd | 2>/dev/null done ${HOME}
+		"$1" -eu printf echo "$@" 'quoted text' sed $(pwd) done readonly then test /usr/bin
+local 'quoted text' && x=1 | 2>/dev/null
+	test | printf | && readonly then grep local "$1" cd x=1 grep local &&
+		/usr/bin "$@" "$@" 'quoted text' 2>/dev/null
+	then -eu cd -eu cd local awk done x=1 -eu echo local && sed -eu test | echo
+	printf then local export then 2>/dev/null done done x=1 && && test
+		readonly echo $(pwd) ${HOME} awk then printf
+'quoted text' awk done && local
+	-eu then printf echo local -eu readonly test | sed
+		'quoted text' | x=1 "$1" -eu ${HOME}
+		cd $(pwd) "$1" 2>/dev/null $(pwd) 2>/dev/null sed ${HOME} grep 'quoted text'
+	local /usr/bin | ${HOME} cd printf 'quoted text' -eu /usr/bin -eu printf grep cd
+	printf then --verbose x=1 "$1" -eu ${HOME} grep grep
+export 2>/dev/null sed echo local local
+	-eu "$1" echo $(pwd) "$1" 'quoted text' ${HOME} readonly done
+x=1 readonly "$1" x=1 test 'quoted text' --verbose
+		| printf "$1" && -eu export x=1 test && $(pwd) printf
+&& cd $(pwd) x=1 -eu done sed test then then awk then cd "$1" && "$@"
+'quoted text' printf "$@" done sed echo | awk cd "$1" cd sed
+	"$@" sed sed printf "$@" cd && readonly echo
+		then awk test printf cd --verbose x=1
+	x=1 then readonly "$@" echo awk echo --verbose $(pwd) "$@" sed
+	x=1 export x=1 x=1 && then printf
+local printf awk export export 'quoted text' | local /usr/bin echo
+2>/dev/null --verbose printf 'quoted text' "$1" | awk --verbose
+		awk done awk local | x=1 "$@" then readonly --verbose export /usr/bin awk cd --verbose
+		printf sed ${HOME} --verbose test export /usr/bin && | sed 2>/dev/null
+	awk "$@" test grep --verbose echo -eu sed done sed then then $(pwd) echo
+${HOME} echo x=1 awk export awk $(pwd)
+	local test awk printf x=1 printf awk sed done local grep cd "$@" && "$1" awk sed
+		'quoted text' readonly then "$@" cd
+		export $(pwd) cd test readonly export $(pwd) echo
+	"$1" "$1" done x=1 readonly
+local /usr/bin x=1 sed awk && | /usr/bin ${HOME} --verbose awk
+	&& done 'quoted text' "$@" $(pwd) "$@" "$@" export awk /usr/bin grep
+	2>/dev/null 'quoted text' then ${HOME} then printf && /usr/bin /usr/bin printf
+readonly readonly 'quoted text' readonly export "$@" "$1" grep
+		/usr/bin ${HOME} 2>/dev/null sed test -eu done -eu && | printf
+		| | "$1" "$@" ${HOME} $(pwd) 'quoted text' ${HOME} 'quoted text'
+	grep x=1 "$@" 'quoted text'
+	sed --verbose sed export | 2>/dev/null
+		local "$@" x=1 --verbose local "$@" 'quoted text'
+x=1 cd test "$1" "$@" done && "$1" awk then 'quoted text' export /usr/bin x=1
+		sed readonly && | readonly "$@" readonly grep printf -eu local |
+	grep sed done local --verbose awk 'quoted text'
+x=1 test /usr/bin --verbose && -eu done then echo x=1 | && --verbose
+		test -eu readonly cd x=1 awk $(pwd) test test sed $(pwd)
+awk then "$@" x=1 2>/dev/null $(pwd) x=1 awk 2>/dev/null --verbose
+"$@" 'quoted text' ${HOME} cd local ${HOME}
+-eu readonly test --verbose printf sed
+--verbose printf -eu && export "$1" export printf $(pwd) sed grep x=1 grep cd then
+'quoted text' cd local cd 'quoted text' grep cd grep x=1
+	2>/dev/null test done awk "$@" awk sed export x=1 printf printf echo printf "$@"
+		x=1 $(pwd) then $(pwd) "$1" then -eu test cd --verbose && /usr/bin
+	$(pwd) echo readonly "$@" awk sed local awk x=1 ${HOME}
+	"$1" echo grep $(pwd) cd echo ${HOME}
+		2>/dev/null test && $(pwd)
+	"$@" 2>/dev/null $(pwd) test 2>/dev/null /usr/bin
+	echo sed then 'quoted text' 2>/dev/null
+$(pwd) readonly $(pwd) export x=1
+	| -eu test 2>/dev/null $(pwd) --verbose cd cd printf && "$@"
+2>/dev/null -eu --verbose local sed sed 2>/dev/null
+		printf export "$@" 'quoted text' awk cd awk && export
+		'quoted text' 'quoted text' printf echo
+$(pwd) awk done "$@" && echo
+		export sed local grep | cd local sed readonly x=1 cd x=1 then
+	--verbose x=1 readonly printf echo /usr/bin x=1 "$@" | grep then sed
+awk && then awk then sed cd 2>/dev/null 'quoted text'
+		cd "$@" | readonly sed export then | && /usr/bin /usr/bin
+sed awk 2>/dev/null then awk export grep 'quoted text' "$1" | done x=1
+		x=1 "$@" ${HOME} cd ${HOME} /usr/bin ${HOME}
+		"$1" readonly 'quoted text' ${HOME} --verbose readonly sed test echo |
+		x=1 --verbose "$@" -eu 'quoted text' echo sed "$1" grep
+local 2>/dev/null $(pwd) printf $(pwd) "$1" awk ${HOME} $(pwd)
+		done && done export test printf
+"$1" grep printf readonly
+sed test --verbose 2>/dev/null
+grep 'quoted text' --verbose
+	x=1 export --verbose $(pwd) 2>/dev/null $(pwd)
+		cd "$1" $(pwd) "$@" "$@" 2>/dev/null done
+		'quoted text' readonly x=1 local
+	x=1 x=1 /usr/bin ${HOME} local printf "$@" -eu "$@" $(pwd) --verbose
+--verbose local ${HOME} test
+grep awk echo 2>/dev/null 'quoted text' x=1 then | /usr/bin
+2>/dev/null readonly test done done ${HOME} grep
+		cd awk done echo cd $(pwd) ${HOME} -eu 'quoted text' local printf /usr/bin
+x=1 /usr/bin 2>/dev/null 2>/dev/null $(pwd) sed export $(pwd) echo && 'quoted text'
+		| "$1" "$1" ${HOME} /usr/bin grep -eu ${HOME} echo && export 'quoted text' echo
+-eu "$1" done x=1 /usr/bin ${HOME} 'quoted text' -eu local
+--verbose $(pwd) $(pwd) printf 'quoted text'
+		test 2>/dev/null "$@" printf sed then
+	'quoted text' then readonly awk export
+	-eu done $(pwd) 'quoted text' export readonly local awk | && readonly
+		${HOME} -eu 'quoted text'
+	x=1 $(pwd) "$@" && "$@" | awk ${HOME} cd "$@" awk done
+		${HOME} 2>/dev/null 'quoted text' grep sed 'quoted text' &&
+readonly sed | "$@" "$1" done "$@" $(pwd)
+${HOME} echo awk awk done sed echo
+		export then grep done grep | printf --verbose local --verbose | echo "$@" $(pwd)
+		export printf x=1 readonly readonly
+		sed "$1" -eu ${HOME} done $(pwd) "$1" export -eu readonly readonly
+	readonly local test x=1 echo readonly sed && test
+	${HOME} grep readonly sed readonly sed then
+	sed x=1 readonly echo $(pwd)
+		local | echo && "$@" echo
+		export echo echo grep printf done export grep "$1" readonly
+readonly 'quoted text' "$@" readonly test done readonly export $(pwd)
+printf && "$@" readonly 2>/dev/null
+"$1" cd 'quoted text' 'quoted text'
+		local local printf && --verbose x=1 test grep readonly awk cd /usr/bin
+	$(pwd) grep test grep done ${HOME} ${HOME}
+		local -eu echo "$@" | local then done 'quoted text' -eu $(pwd) grep readonly
+		&& ${HOME} 2>/dev/null 'quoted text' "$1" --verbose && grep -eu ${HOME} test
+cd then export awk echo && grep sed /usr/bin export sed
+		--verbose ${HOME} 'quoted text' --verbose export test ${HOME} awk
+	"$1" -eu 'quoted text' grep export "$1" -eu awk "$1" cd --verbose $(pwd) "$@"
+		local printf "$@" --verbose done $(pwd) readonly readonly "$1" ${HOME}
+	x=1 sed --verbose echo -eu
+		readonly "$1" 'quoted text' "$@" grep
+${HOME} 'quoted text' $(pwd) "$@" ${HOME} export -eu "$1" local
+		cd x=1 test printf x=1 test "$1" ${HOME} --verbose | export
+		printf export --verbose --verbose x=1 awk && echo export /usr/bin ${HOME}
+readonly 'quoted text' /usr/bin done "$@" --verbose $(pwd) "$@" readonly
+readonly 'quoted text' /usr/bin
+-eu local 2>/dev/null echo local
+x=1 x=1 test x=1 'quoted text' sed && /usr/bin
+		local done /usr/bin ${HOME} --verbose "$1" printf
+	printf --verbose awk "$1" $(pwd) "$1" sed export
+${HOME} local local export ${HOME} printf printf done /usr/bin 'quoted text'
+		then echo echo readonly 2>/dev/null && readonly sed $(pwd) grep
+&& grep 'quoted text' awk x=1 --verbose
+sed test $(pwd) x=1 "$1" $(pwd)
+	| then $(pwd) /usr/bin readonly sed && then "$@" $(pwd) "$@" x=1 awk
+		-eu 'quoted text' "$1" -eu ${HOME} ${HOME} test test test | ${HOME} &&
+		printf && $(pwd) then "$@" cd -eu test awk "$@" --verbose
+sed -eu export /usr/bin
+	readonly x=1 2>/dev/null --verbose /usr/bin 'quoted text' $(pwd)
+	&& printf awk ${HOME} $(pwd) 'quoted text' && "$1" && -eu local printf
+		"$1" done | awk | export readonly | 2>/dev/null
+		'quoted text' printf awk readonly echo 'quoted text' 'quoted text' then
+		grep "$@" awk x=1 ${HOME} awk local 2>/dev/null grep && test && --verbose "$@"
+export "$1" echo && printf readonly
+--verbose x=1 && $(pwd) | "$1" export then "$1" done export
+	grep --verbose 2>/dev/null -eu printf "$@" readonly then "$@" awk local
+	readonly done done | "$1" sed grep local "$1" awk echo
+	printf local /usr/bin |
+	-eu echo printf echo x=1 awk printf
+	awk printf then echo 'quoted text' cd
+	echo local readonly cd $(pwd) cd 'quoted text' awk "$1" readonly
+	cd "$@" cd test awk $(pwd) sed awk "$1" awk /usr/bin
+export sed | "$@" 2>/dev/null
+		| done then "$@" ${HOME} ${HOME} x=1
+		sed done "$1" --verbose
+awk export readonly printf echo
+/usr/bin "$1" echo readonly
+	cd "$@" ${HOME} "$@" --verbose then "$@" readonly export
+	echo done /usr/bin "$1" && export echo $(pwd) readonly
+	done "$1" | $(pwd) sed /usr/bin ${HOME} test test test sed --verbose echo $(pwd)
+		test done | readonly "$@" /usr/bin 2>/dev/null export printf test && test 'quoted text'
+		then x=1 "$1" sed grep cd 'quoted text'
+	'quoted text' ${HOME} $(pwd) | "$1" test "$1" done grep test then | "$1" printf
+		'quoted text' 2>/dev/null
+	x=1 echo "$1" then && awk export --verbose
+		-eu then --verbose 'quoted text' test && test "$1"
+then "$1" then "$@" --verbose "$1" done export x=1 && ${HOME}
+	"$1" --verbose 2>/dev/null local x=1 echo ${HOME}
+awk 'quoted text' printf done grep export x=1 grep sed test printf
+readonly sed export done && then
+	2>/dev/null $(pwd) grep printf --verbose
+export x=1 grep test grep
+	export echo "$@" 2>/dev/null
+		grep "$@" export sed export readonly export test echo
+grep 2>/dev/null 'quoted text' awk local printf && --verbose grep readonly export
+export local printf "$1" test "$@" "$1" awk --verbose ${HOME} /usr/bin
+		cd --verbose $(pwd) cd
+		done | export ${HOME} && 'quoted text' --verbose $(pwd) readonly | ${HOME} $(pwd)
+		sed 2>/dev/null "$@" ${HOME} ${HOME} $(pwd) ${HOME} printf | test --verbose
+done "$1" ${HOME} 'quoted text' sed "$1" $(pwd) then readonly test x=1 export
+echo -eu cd grep printf awk sed test /usr/bin | ${HOME} then awk grep then | "$1"
+test "$1" 'quoted text' "$@" readonly
+export $(pwd) awk 'quoted text' 'quoted text' && done sed test && --verbose
+	export local | local 2>/dev/null
+echo grep test local $(pwd) 2>/dev/null 2>/dev/null "$1" local -eu readonly
+sed echo "$@" printf 'quoted text' "$1"
+	$(pwd) grep echo export 2>/dev/null done ${HOME} /usr/bin
+		| ${HOME} done printf readonly -eu local readonly then "$1" local
+	'quoted text' echo printf $(pwd) && then /usr/bin printf | $(pwd)
+		2>/dev/null -eu "$1" then done
+		"$1" then sed done 2>/dev/null export
+	echo "$1" readonly $(pwd) && $(pwd)
+	"$1" readonly -eu grep /usr/bin "$@" local then
+test printf "$1" "$@" printf echo sed printf ${HOME} $(pwd) readonly
+		"$1" test /usr/bin local "$@" awk
+test | -eu test local cd readonly "$1" test && then 2>/dev/null 'quoted text'
+		${HOME} export "$@" awk echo x=1 export printf
+	2>/dev/null 'quoted text'
+		echo && awk x=1 /usr/bin -eu "$1"
+		readonly export test --verbose
+		"$@" $(pwd) 2>/dev/null sed done
+		${HOME} -eu -eu | $(pwd) test 'quoted text' then 2>/dev/null
+		test | done -eu sed local ${HOME} ${HOME} then ${HOME} awk
+	echo test then /usr/bin -eu | -eu && grep /usr/bin | $(pwd)
+	local /usr/bin then sed cd /usr/bin /usr/bin /usr/bin local awk 'quoted text'
+	--verbose cd 'quoted text' $(pwd) "$@" printf grep
+'quoted text' $(pwd) grep --verbose export
+x=1 export /usr/bin -eu -eu local -eu cd -eu awk $(pwd) printf "$1" $(pwd) &&
+		"$1" "$1" cd done echo 'quoted text' done readonly ${HOME}
+grep $(pwd) | 2>/dev/null -eu export
+	2>/dev/null echo x=1 "$@" printf --verbose sed cd $(pwd) x=1 awk
+		test cd test "$1" echo && ${HOME} "$1" "$@"
+local 'quoted text' sed && printf 2>/dev/null echo && -eu
+	done --verbose && readonly x=1 then
+		2>/dev/null local x=1 echo ${HOME}
+		done && --verbose done cd cd then done $(pwd) readonly
+		sed done readonly 2>/dev/null awk awk $(pwd) test then readonly test
+		${HOME} test cd "$@" done cd awk ${HOME} 'quoted text'
+		then readonly ${HOME} echo then 'quoted text' $(pwd) cd 'quoted text'
+echo echo grep "$1" awk printf readonly "$1" --verbose && -eu | $(pwd) "$@" |
+test | echo -eu sed /usr/bin awk /usr/bin test ${HOME} ${HOME} x=1 2>/dev/null readonly
+		${HOME} -eu "$@" cd printf sed $(pwd) printf x=1
+	/usr/bin && export -eu && test "$1" echo printf then -eu cd "$@"
+"$1" 'quoted text' ${HOME} | --verbose export &&
+2>/dev/null | then /usr/bin "$@" echo
+	readonly export 2>/dev/null sed readonly &&
+		done "$@" local ${HOME} export --verbose | done sed
+awk x=1 done -eu cd $(pwd) 2>/dev/null x=1 done grep echo ${HOME} ${HOME}
+	printf | test | x=1 done | sed grep
+echo /usr/bin export export
+done --verbose "$@" "$1" | done echo x=1 2>/dev/null -eu "$@" --verbose
+	/usr/bin && x=1 awk 'quoted text' readonly grep 'quoted text' then --verbose awk
+		readonly cd && local /usr/bin
+		cd 2>/dev/null "$1" "$@" cd "$1" local then && grep then ${HOME}
+done export grep cd $(pwd)
+	"$1" grep sed $(pwd) cd && grep 'quoted text' awk then printf -eu printf
+	${HOME} grep grep export "$@" sed awk "$@" /usr/bin sed then echo printf "$@"
+printf cd -eu awk echo then -eu "$@" x=1 awk
+	done done 'quoted text' done $(pwd) ${HOME} done printf 'quoted text'
+sed local && | done x=1 local
+		'quoted text' awk | | $(pwd) -eu export
+		$(pwd) printf done cd --verbose 2>/dev/null
+sed sed "$1" echo local done | --verbose | "$@" x=1 "$@"
+'quoted text' 2>/dev/null $(pwd) | "$1" $(pwd) ${HOME}
+-eu 2>/dev/null "$@" cd && done /usr/bin -eu awk cd echo "$@" cd printf
+		then printf cd printf echo -eu export -eu awk readonly
+	| /usr/bin local export readonly export 'quoted text' && | printf
+	test test awk -eu done export test then 2>/dev/null
+&& "$@" done | && cd sed $(pwd) awk 'quoted text' | x=1 awk local "$@"
+	/usr/bin ${HOME} "$@" $(pwd) /usr/bin ${HOME} done --verbose
+		/usr/bin local awk --verbose --verbose "$1" then | printf grep && cd
+export awk /usr/bin 2>/dev/null
+done --verbose "$1" --verbose $(pwd) "$1" && sed "$1" 'quoted text'
+		printf "$1" $(pwd) && cd /usr/bin readonly export --verbose cd printf -eu local
+	2>/dev/null done cd 'quoted text' && readonly -eu ${HOME}
+--verbose "$1" "$@" && then then grep grep && awk grep --verbose export
+	"$@" ${HOME} /usr/bin $(pwd)
+	$(pwd) export test --verbose 2>/dev/null
+	cd | awk 'quoted text' local sed local x=1 'quoted text'
+2>/dev/null printf ${HOME} sed
+	| grep local export export
+grep /usr/bin test export done
+		"$@" test awk -eu --verbose "$@" $(pwd) && done "$@" x=1 readonly
+	printf test -eu printf && && echo 2>/dev/null 'quoted text' x=1 test
+		-eu --verbose 2>/dev/null done ${HOME} $(pwd)
+test ${HOME} ${HOME} then local --verbose --verbose | local
+"$@" $(pwd) then "$1" grep test
+	test /usr/bin ${HOME} /usr/bin 'quoted text' grep "$1" readonly
+	-eu echo readonly && "$1"
+		--verbose cd ${HOME} awk 2>/dev/null awk
+"$1" export readonly -eu ${HOME} 2>/dev/null then readonly 2>/dev/null
+		&& echo -eu 2>/dev/null | awk ${HOME} /usr/bin --verbose echo sed 'quoted text'
+	then printf cd test grep done printf awk sed printf printf echo
+		x=1 cd "$@" test -eu done export x=1 'quoted text' printf local
+$(pwd) "$@" x=1 && echo
+$(pwd) local printf 2>/dev/null "$@" $(pwd) 'quoted text' 2>/dev/null
+awk 2>/dev/null ${HOME} x=1 $(pwd) && sed export readonly
+	printf -eu then awk echo awk printf
+sed local ${HOME} cd awk /usr/bin x=1 && then -eu grep
+	"$1" | ${HOME} -eu export 'quoted text' sed
+		&& --verbose /usr/bin export
+--verbose 2>/dev/null awk awk done done cd "$1" "$@" grep printf
+'quoted text' printf
+cd "$@" 'quoted text' awk --verbose $(pwd)
+	export awk local then 2>/dev/null "$1" "$@" $(pwd) readonly local /usr/bin
+	'quoted text' sed done $(pwd) then x=1 grep ${HOME} cd export $(pwd)
+&& export /usr/bin sed done --verbose cd "$1" --verbose awk local -eu x=1
+		| -eu printf 'quoted text' "$@" test ${HOME} export 2>/dev/null $(pwd)
+	export | cd sed ${HOME} test && | readonly |
+-eu && "$@" /usr/bin 'quoted text' then /usr/bin ${HOME} readonly "$@"
+	awk printf | export --verbose export "$1" | "$1"
+		test grep echo awk --verbose
+awk ${HOME} "$@" local
+		"$1" local export export && grep export readonly -eu && 'quoted text' local
+		/usr/bin echo "$@" sed cd awk x=1 "$1" |
+		then test && printf export export grep
+	&& cd && export awk grep | 'quoted text'
+		| --verbose grep then local sed
+test cd /usr/bin 'quoted text' && then x=1 2>/dev/null sed "$1" --verbose
+2>/dev/null && readonly && echo local ${HOME} export
+cd /usr/bin echo cd ${HOME} "$@" done ${HOME} sed --verbose "$1" x=1 "$@" "$1"
+"$@" printf export local test grep grep $(pwd) -eu x=1 "$1" | --verbose
+	--verbose awk 2>/dev/null --verbose
+		awk export && && done printf $(pwd) test readonly
+		echo local 2>/dev/null
+		test | "$@" awk "$1" sed echo -eu --verbose x=1 then then -eu done $(pwd) awk $(pwd)
+		/usr/bin "$1" printf awk --verbose
+		printf ${HOME} /usr/bin
+"$@" --verbose --verbose
+		"$@" grep --verbose 'quoted text' test ${HOME} printf x=1 && export local
+	$(pwd) --verbose "$1" echo then
+-eu ${HOME} test -eu grep | -eu printf cd awk /usr/bin
+	| test /usr/bin /usr/bin "$1" sed x=1 readonly 'quoted text' $(pwd)
+export $(pwd) awk | $(pwd) /usr/bin x=1
+| then 2>/dev/null local then && $(pwd) done
+		test awk printf export echo test
+done 2>/dev/null local 2>/dev/null
+	export /usr/bin done "$1" test cd test then
+	2>/dev/null "$1" | "$1" readonly /usr/bin export cd
+--verbose "$@" test cd 2>/dev/null
+"$@" local && test -eu test ${HOME} $(pwd) printf then "$1" | printf
+printf && echo awk then export
+		&& done echo && export echo cd awk 2>/dev/null awk -eu --verbose
+printf "$@" awk sed then done "$1" local 2>/dev/null printf readonly
+		cd local echo "$@" $(pwd) -eu export 2>/dev/null 'quoted text'
+		2>/dev/null awk export done "$1" echo 'quoted text' "$1" 2>/dev/null
+	&& done readonly x=1 x=1 readonly && printf sed done
+		"$@" && --verbose test done | "$@" then
+	readonly $(pwd) echo echo /usr/bin
+	done $(pwd) x=1 --verbose /usr/bin done done readonly
+		test test && $(pwd) 2>/dev/null "$1" x=1
+		echo done awk printf local "$@" grep
+done "$1" -eu ${HOME} local echo --verbose $(pwd) cd test /usr/bin
+cd export printf done "$1" | local /usr/bin -eu test readonly
+		done sed export printf readonly ${HOME}
+		export sed /usr/bin local local cd local cd then then
+	-eu /usr/bin -eu 2>/dev/null test echo ${HOME} $(pwd)
+"$@" 2>/dev/null done 2>/dev/null done sed
+	${HOME} awk grep 2>/dev/null --verbose awk /usr/bin
+		$(pwd) awk printf $(pwd) --verbose
+		export echo && done printf 2>/dev/null grep echo
+	local $(pwd) --verbose 2>/dev/null printf printf | local grep
+		"$1" then grep sed export "$@" readonly | -eu test sed ${HOME}
+		awk readonly | "$1" printf
+		${HOME} $(pwd) grep test "$@" grep $(pwd) x=1 cd
+	grep readonly grep export
+x=1 $(pwd) awk --verbose echo printf ${HOME} awk "$@" test
+	2>/dev/null sed printf cd 'quoted text' "$@" 2>/dev/null sed | grep echo ${HOME}
+		-eu -eu printf test cd x=1 printf readonly /usr/bin "$@" --verbose echo
+test ${HOME} then x=1 sed -eu && readonly /usr/bin
+		sed sed echo --verbose ${HOME} 'quoted text' export export /usr/bin echo | awk
+		${HOME} local && sed sed grep -eu x=1 awk local
+done && then printf "$1" then --verbose && "$1" "$1" --verbose "$@"
+		/usr/bin ${HOME} && |
+		export export 2>/dev/null readonly sed sed local | -eu done done cd
+		echo awk done awk $(pwd) test &&
+'quoted text' readonly "$1" /usr/bin awk $(pwd) --verbose sed local
+	| /usr/bin && done /usr/bin local echo
+	&& then "$@" | readonly | done readonly cd "$1" readonly "$@"
+$(pwd) "$@" ${HOME} ${HOME} cd cd echo 2>/dev/null cd
+2>/dev/null | $(pwd) sed printf export then then
+cd "$1" x=1 $(pwd) echo test 2>/dev/null ${HOME} "$1"
+	"$@" awk export 'quoted text' done
+'quoted text' done /usr/bin test x=1 local local awk 2>/dev/null ${HOME} sed test
+-eu /usr/bin ${HOME} "$@" "$1" printf awk x=1 readonly export cd |
+done done grep /usr/bin 2>/dev/null export 2>/dev/null readonly
+		${HOME} -eu /usr/bin grep &&
+sed echo --verbose awk
+	&& && export grep sed 2>/dev/null 'quoted text'
+	awk echo -eu -eu sed echo && echo -eu --verbose test
+local grep grep done
+		test x=1 readonly test echo grep done
+	$(pwd) done grep x=1 'quoted text' test awk
+export /usr/bin 2>/dev/null x=1 readonly cd readonly "$1" awk --verbose
+		awk -eu printf echo grep x=1 "$@"
+	readonly "$@" "$@" grep /usr/bin $(pwd) | echo "$@" local
+	done then --verbose /usr/bin sed x=1 readonly -eu echo echo
+	readonly "$@" test printf $(pwd) local
+"$@" 2>/dev/null test "$@" "$@" readonly done --verbose --verbose
+${HOME} awk sed export "$@"
+		2>/dev/null awk 2>/dev/null --verbose "$@" x=1 grep
+$(pwd) && cd "$1" export 'quoted text' && local /usr/bin test test grep printf
+	'quoted text' grep cd
+	sed --verbose /usr/bin "$1" 2>/dev/null cd test -eu
+		2>/dev/null awk then test && && test
+		printf x=1 "$1" done
+	readonly done $(pwd) --verbose 'quoted text' $(pwd) test local | $(pwd)
+| ${HOME} "$1" test && sed readonly export /usr/bin | && test sed grep sed "$1"
+--verbose ${HOME} export local x=1 "$@" test cd sed cd "$@" ${HOME} grep "$@" |
+"$@" awk -eu ${HOME} then awk --verbose awk 2>/dev/null 'quoted text'
+	/usr/bin local export $(pwd) ${HOME} ${HOME} --verbose
+	"$1" echo ${HOME} grep readonly grep --verbose 'quoted text'
+--verbose test 2>/dev/null $(pwd) ${HOME} $(pwd) ${HOME} printf printf
+	$(pwd) -eu awk ${HOME} grep | export
+		"$@" echo "$@" echo then $(pwd) local then readonly awk cd printf 2>/dev/null readonly
+	"$@" printf echo awk | sed 'quoted text' /usr/bin sed
+/usr/bin readonly $(pwd) export 'quoted text' sed awk done "$@"
+grep -eu grep "$1" x=1 awk | readonly "$1" "$1" -eu ${HOME}
+-eu $(pwd) readonly "$1" "$1" test x=1 grep
+	-eu --verbose then readonly 2>/dev/null
+	/usr/bin then 'quoted text' readonly x=1 done "$@" local -eu $(pwd)
+	done cd sed cd | sed sed "$@" export
+		"$1" local then 2>/dev/null export
+"$@" 2>/dev/null 'quoted text' /usr/bin 2>/dev/null awk -eu "$@"
+$(pwd) printf "$1" $(pwd) --verbose sed then --verbose then 'quoted text'
+local awk 2>/dev/null 2>/dev/null "$@" cd "$1" done grep -eu readonly local then
+export local printf readonly echo grep echo printf /usr/bin
+	test cd then x=1 awk cd 'quoted text' then awk --verbose "$@" 'quoted text' "$1"
+		'quoted text' grep echo -eu test awk "$@" then "$1" done grep awk printf --verbose
+		done then echo printf test
+		sed && grep $(pwd) $(pwd) $(pwd)
+		printf x=1 local printf export then grep ${HOME} &&
+		cd 'quoted text' | test /usr/bin
+	export $(pwd) then readonly 'quoted text' cd | "$@" 2>/dev/null then then 'quoted text'
+2>/dev/null export $(pwd)
+		echo cd "$@" printf then cd sed "$1" awk "$1" "$1" readonly -eu
+export grep then sed x=1 2>/dev/null printf ${HOME} |
+		| sed --verbose "$@" then "$1" 'quoted text' 2>/dev/null
+		"$@" awk local export local echo --verbose
+		'quoted text' && $(pwd) $(pwd) grep "$@" | readonly $(pwd) ${HOME} awk | "$1"
+	| cd test cd "$1" awk test "$1" /usr/bin /usr/bin
+		2>/dev/null -eu grep "$1" printf test printf grep test local 2>/dev/null
+	cd sed cd | awk /usr/bin "$1" then readonly
+		cd | grep printf --verbose echo && grep $(pwd)
+local cd /usr/bin x=1 then local printf sed local $(pwd) sed echo /usr/bin echo
+		grep "$@" 'quoted text' && 'quoted text'
+		cd && ${HOME} export 2>/dev/null "$1" ${HOME} echo echo
+'quoted text' then grep | cd 2>/dev/null
+		-eu --verbose $(pwd) 2>/dev/null test ${HOME} done -eu local then -eu
+-eu && test cd $(pwd) then 2>/dev/null local "$1" --verbose local
+		'quoted text' x=1 ${HOME} sed grep "$@" | awk sed test
+		sed then then test --verbose 2>/dev/null printf /usr/bin
+printf grep /usr/bin 2>/dev/null && done
+		awk $(pwd) then then then awk then | "$1" awk $(pwd) grep export
+$(pwd) "$@" 2>/dev/null ${HOME}
+	&& awk && 2>/dev/null printf local 'quoted text' "$@" x=1 -eu ${HOME} -eu 2>/dev/null
+		| awk 2>/dev/null grep then $(pwd) awk -eu --verbose "$1" done $(pwd)
+'quoted text' x=1 printf echo
+		cd | awk then grep | x=1 printf 'quoted text'
+| /usr/bin x=1 cd readonly "$@" 'quoted text' sed /usr/bin readonly --verbose
+	/usr/bin --verbose ${HOME}
+"$1" --verbose sed cd then then ${HOME} $(pwd) sed
+	"$1" "$1" cd printf 'quoted text' then local
+	--verbose done test test export awk "$@" grep -eu done done 'quoted text'
+-eu grep --verbose "$1" | awk printf local "$1" readonly grep ${HOME}
+	readonly then -eu --verbose local "$1" awk -eu 2>/dev/null
+	"$1" readonly grep then | x=1 | && printf
+local "$1" --verbose sed cd done --verbose "$@" "$1" -eu
+&& awk done "$1" $(pwd)
+${HOME} done done sed echo "$@"
+		-eu "$@" "$1" awk 2>/dev/null $(pwd)
+	cd && "$1" awk cd /usr/bin
+	'quoted text' export && "$1"
+x=1 done grep sed cd awk | | echo /usr/bin sed echo && $(pwd)
+		&& echo "$@" ${HOME} -eu 'quoted text' && awk grep grep printf 2>/dev/null
+		local awk "$@" cd /usr/bin sed readonly "$1" done
+		local echo printf "$@" 2>/dev/null 2>/dev/null echo cd echo grep "$1"
+	then x=1 --verbose $(pwd) echo --verbose "$@" test ${HOME}
+		echo && test "$1" grep -eu | cd printf
+		x=1 sed local /usr/bin "$1" cd /usr/bin then echo done "$@" | cd
+		then echo && grep -eu && export /usr/bin readonly
+		printf awk awk awk x=1 printf 'quoted text' test cd 'quoted text' ${HOME} export
+		cd export && readonly grep grep --verbose printf cd && cd
+	| grep sed cd "$1" -eu export then export
+		x=1 | done readonly grep 'quoted text'
+		sed awk grep "$@" awk
+	cd -eu sed then ${HOME} export /usr/bin -eu echo x=1 /usr/bin -eu printf -eu
+		--verbose --verbose grep printf awk ${HOME} |
+export then x=1 && ${HOME}
+		${HOME} 2>/dev/null 2>/dev/null local --verbose
+		| ${HOME} export "$@" /usr/bin "$1" local test awk -eu | test readonly local "$@"
+	cd /usr/bin cd cd 2>/dev/null x=1 'quoted text'
+	"$1" ${HOME} test --verbose grep "$1" && done
+	${HOME} ${HOME} | echo $(pwd) sed sed | "$1" ${HOME} export awk readonly
+		/usr/bin $(pwd) x=1 then
+		/usr/bin printf test cd -eu sed printf test local export
+		export 2>/dev/null ${HOME}
+$(pwd) ${HOME} readonly --verbose then done "$1" export sed --verbose ${HOME}
+"$1" $(pwd) -eu export "$@" 'quoted text' -eu 'quoted text' then done
+	${HOME} test --verbose ${HOME} awk --verbose
+-eu 'quoted text' readonly /usr/bin sed export cd then sed 'quoted text'
+cd "$@" cd /usr/bin -eu "$1" | 'quoted text' 2>/dev/null
+		cd test "$1" /usr/bin test export 2>/dev/null local awk
+	then -eu "$@" $(pwd) awk ${HOME} "$1" done echo
+awk done /usr/bin /usr/bin local readonly | "$1" && printf grep
+/usr/bin 2>/dev/null 'quoted text'
+	cd "$@" printf test --verbose grep "$1" grep then then grep && awk 'quoted text'
+	2>/dev/null cd $(pwd) local | "$@" done export
+| local printf readonly && "$1"
+	$(pwd) export | 2>/dev/null -eu sed 2>/dev/null "$1" awk
+| sed readonly /usr/bin cd --verbose -eu
+"$@" | 2>/dev/null grep x=1 2>/dev/null $(pwd) --verbose "$@"
+grep echo /usr/bin --verbose test $(pwd) --verbose --verbose export 2>/dev/null
+	grep export 2>/dev/null && done 2>/dev/null x=1 &&
+		'quoted text' local local echo cd $(pwd) && 2>/dev/null
+		cd grep 2>/dev/null --verbose awk then echo readonly cd $(pwd) echo export
+	"$@" && then --verbose "$1" then done done
+	local && 2>/dev/null sed x=1
+		$(pwd) grep "$@" && local $(pwd) 'quoted text'
+/usr/bin 'quoted text' grep 2>/dev/null "$1"
+	"$@" local printf /usr/bin | awk local "$1" echo "$1" done local awk "$@" $(pwd)
+	| awk -eu "$1" ${HOME} echo | done printf 2>/dev/null
+then --verbose $(pwd)
+done readonly printf printf cd "$1" local /usr/bin then 2>/dev/null
+	cd grep "$1" local -eu grep grep 'quoted text' -eu -eu --verbose && readonly "$@"
+	"$@" readonly cd | --verbose
+		done printf awk printf x=1 echo printf cd cd done 'quoted text'
+		2>/dev/null export echo 'quoted text'
+		-eu 2>/dev/null x=1 export | -eu 'quoted text'
+printf x=1 && awk done printf
+"$@" printf grep readonly | echo sed 'quoted text'
+	${HOME} local $(pwd) grep 2>/dev/null awk
+	--verbose echo $(pwd) "$@" readonly "$@" grep "$1" x=1 "$1" done ${HOME}
+sed "$1" --verbose then --verbose grep x=1 --verbose
+	export grep 2>/dev/null local awk awk
+| && sed local x=1 done "$@" --verbose "$@" | "$1"
+	$(pwd) --verbose | cd 'quoted text' readonly
+$(pwd) x=1 "$1" && x=1
+| grep awk /usr/bin local ${HOME} 'quoted text' sed then -eu
+	local echo then cd then done
+		--verbose /usr/bin && printf "$@" $(pwd)
+		-eu ${HOME} printf "$1" cd "$1" grep /usr/bin local local awk "$1" grep 2>/dev/null
+		2>/dev/null 'quoted text' awk | awk 'quoted text' 'quoted text'
+		echo && 2>/dev/null done cd && /usr/bin test 2>/dev/null local readonly
+		then test printf "$@" test "$1" &&
+	sed grep done "$1" grep $(pwd) test done &&
+	${HOME} ${HOME} readonly 'quoted text' done local test then printf local "$@" sed
+	&& printf echo printf export "$@" 'quoted text'
+		readonly printf done && done
+printf 'quoted text' export ${HOME} --verbose then --verbose test cd local "$1"
+	-eu /usr/bin local printf export
+	/usr/bin done && "$1" x=1 "$@"
+-eu local echo test && grep awk x=1 /usr/bin then -eu awk ${HOME} done grep 2>/dev/null
+	done ${HOME} $(pwd) awk /usr/bin 'quoted text'
+		sed 2>/dev/null 'quoted text' | then awk sed x=1 | $(pwd)
+export "$@" printf --verbose "$1" cd grep --verbose
+export test echo | cd && readonly && ${HOME} local export && awk
+| test then sed echo done test /usr/bin test -eu --verbose local | printf "$1"
+	"$@" 'quoted text' awk grep sed
+	$(pwd) sed echo 'quoted text' echo --verbose sed printf
+		x=1 2>/dev/null done done grep | done /usr/bin printf
+		done && /usr/bin /usr/bin test readonly x=1 sed /usr/bin
+	grep done test 2>/dev/null test then awk
+	grep ${HOME} /usr/bin echo && 2>/dev/null local
+readonly then "$1" test -eu export done
+	--verbose readonly export sed local 2>/dev/null echo ${HOME} export
+		grep "$@" readonly "$1" test export $(pwd)
+	-eu cd "$@" $(pwd) export --verbose test done /usr/bin grep /usr/bin
+		${HOME} | 'quoted text' sed -eu | grep printf
+	x=1 2>/dev/null x=1 | x=1 ${HOME} export 2>/dev/null x=1 | readonly && sed
+		${HOME} "$1" printf cd 'quoted text' "$1" x=1 'quoted text'
+echo echo && echo -eu 2>/dev/null
+	test export echo x=1 -eu 'quoted text' printf
+done test "$@" printf sed | && x=1 && | 2>/dev/null local $(pwd)
+2>/dev/null 'quoted text' awk 2>/dev/null
+sed 'quoted text' "$@" 'quoted text' "$@" "$1" sed sed "$1" 'quoted text'
+'quoted text' awk sed grep printf awk grep then ${HOME} printf
+cd printf cd cd x=1 -eu ${HOME} --verbose
+	cd "$1" sed local "$@" ${HOME}
+		--verbose export awk done readonly --verbose
+		'quoted text' --verbose /usr/bin local grep export
+		test awk --verbose /usr/bin && echo cd
+test $(pwd) test 2>/dev/null awk local grep awk "$@"
+		test local readonly x=1 echo 2>/dev/null 2>/dev/null
+	${HOME} --verbose x=1 "$@" printf export done ${HOME}
+	printf $(pwd) 2>/dev/null ${HOME} local -eu readonly /usr/bin printf
+	echo "$@" ${HOME} | test local awk sed test
+	cd then then "$@" -eu "$@" /usr/bin "$@" echo local export
+2>/dev/null grep 'quoted text' local | | -eu awk echo "$1" then -eu local
+local printf sed echo --verbose cd "$@" --verbose cd
+	&& readonly test export readonly echo readonly /usr/bin then export
+sed ${HOME} ${HOME} $(pwd) 'quoted text'
+		&& done readonly ${HOME} cd | ${HOME} && | cd cd /usr/bin
+local grep --verbose sed echo awk -eu sed /usr/bin export 2>/dev/null && 2>/dev/null
+	sed x=1 readonly && local grep /usr/bin 2>/dev/null export "$@" $(pwd)
+2>/dev/null ${HOME} "$@" /usr/bin echo
+		awk local | /usr/bin then -eu printf $(pwd)
+	x=1 local done /usr/bin test local x=1 sed printf --verbose $(pwd)
+	"$@" | ${HOME} cd sed 'quoted text' test /usr/bin "$1" --verbose readonly
+		printf "$1" awk $(pwd) | -eu cd awk cd local && $(pwd) "$1" cd awk "$@"
+		test 2>/dev/null echo printf awk local test
+done ${HOME} echo $(pwd) 2>/dev/null export grep
+	"$@" sed --verbose test 2>/dev/null "$1" --verbose 2>/dev/null
+		echo sed readonly ${HOME}
+printf $(pwd) | awk test /usr/bin
+		"$@" sed && grep cd echo 'quoted text' x=1 local readonly awk ${HOME}
+		'quoted text' then then awk 2>/dev/null awk
+	x=1 export local /usr/bin cd local /usr/bin grep x=1 "$@" x=1 && x=1 x=1 cd readonly
+		echo 'quoted text' "$@" && done printf grep /usr/bin
+	printf -eu awk 'quoted text' cd then && grep awk export $(pwd) echo
+		-eu readonly $(pwd) && local | done export awk && grep 'quoted text'
+"$1" cd cd test export 2>/dev/null x=1 sed x=1 /usr/bin x=1 done --verbose
+		x=1 --verbose && "$@" export sed ${HOME} readonly cd grep 'quoted text' x=1
+	'quoted text' | test "$1" "$1" "$@"
+		x=1 "$1" | printf 2>/dev/null test x=1 local "$1" | "$1"
+	then export 2>/dev/null ${HOME} done then "$1" $(pwd) test
+sed awk 'quoted text' 2>/dev/null readonly 2>/dev/null 'quoted text' readonly
+&& --verbose export grep
+		${HOME} echo test "$1" sed export && "$1" x=1 x=1 | export done
+	"$1" test x=1 local done
+		&& printf cd done $(pwd) then echo cd ${HOME}
+grep | 'quoted text' && && "$@" "$1" printf done test -eu $(pwd) printf
+		readonly test echo readonly | $(pwd) test
+		local local test -eu then && x=1 $(pwd) $(pwd)
+		-eu 2>/dev/null "$@" ${HOME} echo | then cd $(pwd) $(pwd) sed 2>/dev/null
+		-eu echo x=1 'quoted text' sed cd --verbose sed printf
+	/usr/bin ${HOME} awk done then export export 'quoted text'
+-eu x=1 printf && | $(pwd) grep grep /usr/bin export grep --verbose /usr/bin
+	done then export local echo 'quoted text' readonly readonly
+	local ${HOME} $(pwd) cd printf awk ${HOME} x=1 export grep
+| $(pwd) | grep $(pwd) echo cd done local done printf grep 2>/dev/null x=1
+	"$1" 2>/dev/null --verbose -eu /usr/bin local test /usr/bin printf && 'quoted text'
+	/usr/bin cd 2>/dev/null x=1 'quoted text' -eu x=1
+	$(pwd) ${HOME} done test local x=1 sed 2>/dev/null /usr/bin printf
+	done test cd test echo readonly -eu echo ${HOME} "$1" cd 'quoted text'
+'quoted text' then -eu
+		test grep /usr/bin export done /usr/bin 2>/dev/null
+	2>/dev/null && sed ${HOME} --verbose "$1"
+	"$1" && 'quoted text' && 2>/dev/null done x=1 local echo
+grep echo local then grep "$1" echo /usr/bin export grep printf cd | local
+then --verbose printf test "$@" 'quoted text'
+	2>/dev/null awk grep local $(pwd) | --verbose -eu ${HOME}
+/usr/bin x=1 done then x=1 && export ${HOME}
+	test 2>/dev/null then && -eu awk
+		/usr/bin && done awk local
+	then sed /usr/bin $(pwd) awk ${HOME}
+done && grep 2>/dev/null ${HOME} x=1 "$1" done then echo | "$@" echo 2>/dev/null
+$(pwd) export 'quoted text' -eu "$@" grep $(pwd) "$1" export done local -eu
+	local local readonly $(pwd) awk --verbose printf && x=1 then && 'quoted text'
+	awk done done readonly ${HOME} --verbose
+	$(pwd) "$1" 2>/dev/null /usr/bin
+	--verbose && x=1 done $(pwd) ${HOME}
+then | export test local --verbose sed 'quoted text'
+		export local /usr/bin echo "$1" readonly printf ${HOME}
+'quoted text' local $(pwd) ${HOME}
+/usr/bin -eu cd && -eu -eu "$1" 'quoted text' readonly 2>/dev/null x=1 --verbose
+export -eu test $(pwd) 'quoted text' -eu ${HOME}
+		sed --verbose -eu awk $(pwd) cd local
+then | x=1 grep grep local x=1 && /usr/bin -eu "$@" && printf
+		${HOME} --verbose | "$@" 'quoted text' $(pwd) /usr/bin $(pwd) export local echo
+-eu printf printf then echo && cd
+		/usr/bin -eu local "$@" cd | sed -eu echo test export "$1" then export
+		readonly test 'quoted text' export --verbose readonly printf then sed /usr/bin --verbose
+		echo ${HOME} | local "$@" local local awk -eu -eu --verbose
+	| export done done "$1" done $(pwd)
+local export cd readonly test
+done 2>/dev/null readonly /usr/bin
+	-eu then /usr/bin && local "$1" && | export
+		local done then | | "$1" then export sed $(pwd) -eu
+readonly awk "$1" 'quoted text' "$1" sed echo
+		'quoted text' export x=1 x=1 cd -eu 2>/dev/null $(pwd) 2>/dev/null grep -eu
+		export /usr/bin echo x=1 grep /usr/bin ${HOME} $(pwd) then
+	then cd done 2>/dev/null
+		--verbose --verbose echo /usr/bin 'quoted text' x=1 cd 'quoted text' ${HOME} then
+| x=1 | -eu 2>/dev/null cd printf printf sed sed | -eu test /usr/bin
+		/usr/bin x=1 cd 'quoted text' then -eu ${HOME} -eu local --verbose
+		x=1 --verbose "$@" -eu 'quoted text'
+		${HOME} --verbose readonly "$1" local ${HOME} "$1" /usr/bin echo printf &&
+	"$1" x=1 readonly 'quoted text' x=1 cd -eu
+sed "$@" printf grep export "$1" && local
+	export printf x=1 test /usr/bin
+		awk local test "$@" export echo
+	x=1 $(pwd) printf done grep ${HOME} done echo
+'quoted text' printf done "$1" sed grep awk done done then printf
+		printf sed test readonly 2>/dev/null -eu $(pwd) ${HOME}
+	--verbose && | echo /usr/bin test sed x=1 "$1" test
+	$(pwd) cd grep && grep ${HOME} readonly --verbose 'quoted text' "$1" 2>/dev/null
+export done | test /usr/bin done echo &&
+	'quoted text' then "$1" printf then printf 'quoted text'
+${HOME} local 'quoted text' && then "$1" x=1 echo /usr/bin printf
+		--verbose readonly readonly "$1" echo -eu export -eu 'quoted text' "$@" printf
+		awk printf "$@" 'quoted text' x=1
+$(pwd) x=1 'quoted text' then export | && | done echo | echo && sed 'quoted text'
+		local "$1" 2>/dev/null readonly x=1 -eu local
+"$1" awk "$@" x=1 grep /usr/bin "$1" export test "$@" $(pwd)
+${HOME} $(pwd) "$1" | local -eu local "$1" /usr/bin /usr/bin &&
+		2>/dev/null cd 2>/dev/null "$1" $(pwd) "$@"
+		done local done $(pwd) done --verbose 2>/dev/null
+		"$@" grep "$1" export local awk x=1 "$1" "$1" && export --verbose echo test local
+done cd awk /usr/bin awk local ${HOME}
+"$@" $(pwd) -eu printf 2>/dev/null "$1" "$1" grep
+local -eu "$@" grep 'quoted text' --verbose 'quoted text' | /usr/bin "$@"
+	&& "$@" awk && local sed 2>/dev/null
+	&& x=1 export x=1 "$@" && | echo 2>/dev/null /usr/bin sed --verbose sed
+	done sed "$1" test x=1 'quoted text'
+		echo printf test then $(pwd) | -eu | awk --verbose && test
+"$@" sed grep grep readonly export echo x=1
+		"$@" x=1 readonly done awk then export && sed $(pwd) "$@" && cd x=1 ${HOME} test
+/usr/bin printf | ${HOME} cd awk | $(pwd) ${HOME} x=1 readonly | export ${HOME}
+	"$1" && test printf 'quoted text'
+	$(pwd) x=1 ${HOME} echo "$@" export sed printf test "$1"
+		grep local x=1 $(pwd) export awk done
+		| $(pwd) echo 2>/dev/null
+	grep $(pwd) $(pwd) test "$@" 2>/dev/null readonly readonly
+		/usr/bin echo x=1 --verbose printf printf --verbose
+	'quoted text' sed ${HOME} ${HOME} readonly
+	echo /usr/bin | | readonly export /usr/bin sed $(pwd) readonly echo test
+		x=1 && sed x=1 "$1" awk && $(pwd) sed
+		done cd -eu done readonly local -eu cd /usr/bin
+	-eu 'quoted text' $(pwd) /usr/bin "$@" local /usr/bin
+done test -eu local --verbose 2>/dev/null test echo
+	--verbose printf local ${HOME} "$1" then local done export
+	/usr/bin test readonly x=1 ${HOME} /usr/bin ${HOME}
+	readonly ${HOME} | cd -eu sed then awk &&
+		-eu test 2>/dev/null --verbose "$1" $(pwd) then
+		$(pwd) $(pwd) export "$1" "$@" sed /usr/bin ${HOME}
+	export 2>/dev/null then 2>/dev/null cd local "$@" sed "$1" local
+${HOME} /usr/bin $(pwd) 2>/dev/null
+	local $(pwd) test echo readonly
+sed -eu 2>/dev/null echo then done then $(pwd) local &&
+test echo awk "$@" | 2>/dev/null "$1" "$1" test sed then test
+	"$1" x=1 -eu /usr/bin readonly export "$@" local done /usr/bin --verbose cd
+	awk 2>/dev/null echo | printf 2>/dev/null | printf
+/usr/bin /usr/bin $(pwd)
+		&& done "$1" export 2>/dev/null awk awk --verbose awk "$1" ${HOME} /usr/bin ${HOME}
+		grep -eu 'quoted text' done local readonly sed | && -eu -eu cd $(pwd)
+	&& cd $(pwd) /usr/bin sed grep ${HOME}
+		test "$@" $(pwd) done "$1" | grep --verbose echo export export export
+x=1 printf awk printf --verbose cd -eu sed /usr/bin 2>/dev/null "$1"
+		printf "$@" readonly test export x=1 --verbose grep local printf awk /usr/bin
+done 'quoted text' then local then cd done x=1 "$1" awk /usr/bin
+&& --verbose | cd $(pwd) export -eu "$1" cd
+-eu cd test -eu 'quoted text' && then printf $(pwd) grep cd awk --verbose
+		awk "$@" local x=1 cd export then
+		then awk test awk -eu done
+	test then printf /usr/bin | export x=1 sed local test $(pwd) /usr/bin
+	test sed "$@" ${HOME} /usr/bin done $(pwd)
+	2>/dev/null sed "$1" local then done export echo echo
+${HOME} x=1 x=1 "$1" | readonly awk x=1 --verbose test && readonly
+	${HOME} then /usr/bin --verbose && grep | printf
+		cd readonly -eu cd printf
+		"$1" 'quoted text' grep "$@" done done then echo printf readonly
+	/usr/bin /usr/bin "$1" /usr/bin awk ${HOME} --verbose && /usr/bin && 2>/dev/null
+		done /usr/bin export -eu grep && cd ${HOME}
+	$(pwd) done cd $(pwd) readonly cd
+'quoted text' done x=1 --verbose readonly ${HOME} -eu readonly /usr/bin
+		cd /usr/bin then x=1 && export -eu 2>/dev/null | x=1
+	${HOME} -eu printf echo readonly printf -eu done
+sed | sed readonly printf "$1" -eu $(pwd) printf 2>/dev/null $(pwd)
+		"$@" grep printf 2>/dev/null then local -eu export echo then printf "$@" then
+		"$@" local && | then echo readonly ${HOME}
+		sed $(pwd) 2>/dev/null "$1" test sed && local | $(pwd) && && &&
+		"$1" sed | awk then then export $(pwd) 2>/dev/null
+		--verbose -eu cd then --verbose 'quoted text' export echo
+		2>/dev/null 2>/dev/null x=1 'quoted text'
+		printf cd echo done /usr/bin readonly awk export $(pwd) 'quoted text'
+"$1" "$1" done 'quoted text' then "$@" ${HOME} ${HOME} done "$@"
+	cd readonly x=1 cd --verbose test grep "$@" | awk sed done local
+	then sed ${HOME} "$1" then readonly "$1" ${HOME} export cd cd "$@" "$1"
+		cd && done "$1" cd printf test export "$@" echo test && && && 'quoted text'
+	'quoted text' cd 'quoted text'
+	then then echo "$@" "$@" awk
+	x=1 | local cd x=1 ${HOME} then export export test
+		sed done --verbose awk /usr/bin 2>/dev/null test sed /usr/bin awk cd x=1
+export done printf echo done local "$1" echo printf
+&& "$@" "$1" | printf local then "$1" /usr/bin
+echo 2>/dev/null | /usr/bin 2>/dev/null printf then 2>/dev/null done local export
+"$1" then "$1" ${HOME} 2>/dev/null done
+printf "$1" echo ${HOME} grep && "$@" && then "$@" local $(pwd) local
+	then 2>/dev/null "$@" awk awk $(pwd) printf sed 2>/dev/null local done
+		| test test cd 2>/dev/null cd then --verbose && && --verbose x=1 done printf -eu
+		export "$1" $(pwd) "$1" grep $(pwd) --verbose cd
+		$(pwd) local echo /usr/bin then && then --verbose "$1" x=1 grep 'quoted text'
+&& cd done 'quoted text'
+	$(pwd) && -eu local x=1 test
+$(pwd) --verbose /usr/bin /usr/bin echo local 'quoted text' /usr/bin
+	grep ${HOME} x=1 export
+	printf ${HOME} grep then then ${HOME} && then cd x=1 printf | 'quoted text'
+	x=1 2>/dev/null cd sed
+		readonly echo 2>/dev/null then | done sed -eu
+	local /usr/bin done "$@" --verbose echo local 'quoted text' && done | ${HOME}
+awk awk printf grep grep test ${HOME} "$1" cd then test local then 2>/dev/null
+	'quoted text' echo ${HOME}
+	test "$@" local export done
+awk x=1 /usr/bin && grep 2>/dev/null -eu echo printf
+${HOME} && grep 2>/dev/null -eu /usr/bin
+	'quoted text' 2>/dev/null export -eu test ${HOME}
+		cd -eu cd x=1 readonly "$1" 2>/dev/null awk then ${HOME} 'quoted text'
+		local then echo export ${HOME}
+"$1" && | readonly grep test then -eu local awk
+${HOME} then 'quoted text' "$1" $(pwd) test then then done cd --verbose /usr/bin
+then && printf x=1 "$1" --verbose cd $(pwd) sed sed done
+2>/dev/null --verbose /usr/bin ${HOME} cd sed echo && --verbose
+awk local "$1" 2>/dev/null echo $(pwd)
+| done /usr/bin sed x=1 test local grep ${HOME} $(pwd) readonly
+	-eu /usr/bin awk test $(pwd) | --verbose
+		sed test -eu printf echo done then grep --verbose done
+| awk | local --verbose && x=1 x=1 cd printf readonly then /usr/bin
+echo printf cd sed "$1" 'quoted text'
+${HOME} then echo echo "$1" local $(pwd) then | $(pwd) local readonly
+		then test -eu --verbose | test | then && done /usr/bin
+		"$@" 2>/dev/null "$@" export 2>/dev/null "$1" "$1" x=1 && $(pwd) test
+	2>/dev/null | echo --verbose printf export | $(pwd) grep readonly
+		${HOME} /usr/bin local grep sed readonly awk --verbose
+	sed --verbose sed then grep printf 'quoted text'
+		${HOME} $(pwd) awk echo cd awk -eu "$1" echo done /usr/bin "$@"
+		"$@" sed done sed ${HOME} local printf
+		awk local x=1 "$1" | x=1 test export
+"$1" readonly export grep local export grep awk echo
+	echo ${HOME} grep export && --verbose printf awk echo printf x=1 'quoted text'
+cd ${HOME} export test "$@"
+	echo export test echo -eu local /usr/bin -eu grep cd cd printf readonly done
+then 2>/dev/null $(pwd) -eu readonly
+		x=1 test | "$1" /usr/bin
+		cd export $(pwd) readonly awk cd
+printf | local then $(pwd)
+		'quoted text' | -eu export awk done "$@" "$1" 2>/dev/null
+		x=1 done grep ${HOME} printf readonly -eu cd cd then
+		done sed 2>/dev/null 'quoted text' echo sed /usr/bin local grep x=1 sed 2>/dev/null
+	printf export /usr/bin | | 'quoted text' sed
+	| $(pwd) cd test export then 2>/dev/null $(pwd) local echo cd x=1 $(pwd) x=1 echo
+		awk local grep local && 2>/dev/null
+printf x=1 echo sed sed -eu test 2>/dev/null -eu && cd then local
+		$(pwd) test local done "$@" printf
+		"$1" /usr/bin | local awk sed done cd export local local -eu sed ${HOME}
+	"$@" awk 2>/dev/null $(pwd)
+	printf | ${HOME} test 'quoted text' ${HOME} $(pwd)
+	| "$@" --verbose grep --verbose && test printf /usr/bin
+"$1" cd 2>/dev/null -eu $(pwd) /usr/bin "$1" awk "$@"
+	grep -eu /usr/bin 'quoted text' 2>/dev/null -eu echo $(pwd) x=1
+--verbose 2>/dev/null awk "$1" then
+	cd 2>/dev/null "$1" then $(pwd) /usr/bin --verbose && $(pwd) "$1" local
+test $(pwd) done then /usr/bin awk echo $(pwd) /usr/bin
+		sed -eu 'quoted text' "$1" 'quoted text'
+	2>/dev/null 2>/dev/null
+readonly export sed local 'quoted text'
+		&& | awk then x=1 done
+	echo test readonly then -eu
+readonly ${HOME} "$1" 'quoted text' 'quoted text'
+2>/dev/null | done grep $(pwd) done x=1 | local cd "$@" echo $(pwd) 'quoted text'
+	$(pwd) test 'quoted text' 'quoted text' printf "$@" local "$1" -eu /usr/bin local
+	-eu printf then readonly ${HOME} readonly ${HOME}
+		$(pwd) awk grep --verbose
+		cd "$@" x=1 sed 'quoted text' readonly --verbose local 2>/dev/null 2>/dev/null
+		sed $(pwd) readonly echo cd echo printf local x=1 -eu local readonly then cd
+	${HOME} awk x=1 local cd then echo 'quoted text' grep 2>/dev/null local
+grep $(pwd) -eu /usr/bin cd awk cd
+grep local -eu done local
+local x=1 -eu 'quoted text'
+	$(pwd) && readonly /usr/bin --verbose grep export
+test --verbose "$1" done test --verbose local awk test ${HOME}
+$(pwd) export cd printf sed readonly export export /usr/bin
+	sed done "$@" x=1 2>/dev/null export export local awk local
+		sed local --verbose /usr/bin | x=1 -eu test 2>/dev/null ${HOME} 2>/dev/null
+then --verbose | && echo sed grep | ${HOME} --verbose "$1" grep
+		then -eu 'quoted text' readonly export readonly cd 'quoted text' awk done
+	cd done done sed "$1" 'quoted text' awk "$@" ${HOME} readonly done
+echo then && --verbose awk $(pwd) sed
+		-eu export echo export ${HOME}
+		grep printf "$1" 2>/dev/null | sed export local
+		export --verbose grep "$1" done then /usr/bin
+	--verbose 'quoted text' readonly then ${HOME} awk /usr/bin done -eu
+	test $(pwd) grep then 'quoted text' test 'quoted text'
+"$1" && then test export "$1" readonly x=1 test export
+	awk grep 'quoted text' -eu local && 'quoted text' &&
+	'quoted text' --verbose test
+	&& echo done -eu "$1" 'quoted text'
+	awk test x=1 -eu then then 2>/dev/null export /usr/bin
+		printf | -eu test "$@" printf
+test -eu /usr/bin | then "$@"
+	then sed $(pwd) printf
+		test then ${HOME} 'quoted text'
+	done /usr/bin awk grep /usr/bin
+	grep --verbose cd readonly printf -eu | echo "$1"
+		--verbose readonly $(pwd) done && 2>/dev/null echo x=1 /usr/bin readonly
+	awk local "$1" readonly test ${HOME} grep /usr/bin -eu done awk
+		"$@" printf awk $(pwd) echo /usr/bin sed 2>/dev/null
+	x=1 sed grep grep grep readonly 'quoted text' export test
+"$@" 'quoted text' 2>/dev/null then
+echo done echo awk awk then test awk x=1 2>/dev/null -eu export 'quoted text'
+	awk $(pwd) /usr/bin awk then
+echo /usr/bin $(pwd) cd done awk
+	export test ${HOME} cd ${HOME} export x=1 awk
+		&& && grep cd "$1" export awk printf
+		-eu x=1 && -eu ${HOME} echo export 'quoted text' export && local
+then test -eu cd readonly /usr/bin awk "$1" 2>/dev/null grep grep
+done ${HOME} awk "$1" cd 2>/dev/null export sed 2>/dev/null
+		| cd cd 'quoted text' | 'quoted text'
+		"$1" awk echo 2>/dev/null /usr/bin && done ${HOME} done local grep sed readonly
+	done done done 2>/dev/null printf done /usr/bin 2>/dev/null | 2>/dev/null
+		done awk local "$@" local grep local /usr/bin test done
+	--verbose awk ${HOME} local readonly done
+		awk x=1 2>/dev/null "$1" $(pwd) 2>/dev/null test
+grep cd export x=1 | --verbose export ${HOME} local | 2>/dev/null awk done sed "$1"
+		local echo grep && export 2>/dev/null cd export readonly --verbose done -eu
+	/usr/bin readonly x=1 echo
+		&& /usr/bin && grep done sed /usr/bin cd &&
+| 'quoted text' "$1" -eu local
+		printf echo then then readonly
+-eu echo "$@" cd grep --verbose awk sed then "$1"
+	&& done "$@" 'quoted text' -eu --verbose $(pwd) "$1" echo | awk then export
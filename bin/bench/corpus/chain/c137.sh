@@ -0,0 +1,2001 @@
+	'quoted text' cd 2>/dev/null echo 2>/dev/null export echo
+	&& "$@" then cd awk echo cd export readonly sed ${HOME}
+		readonly /usr/bin "$@" ${HOME}
+		grep $(pwd) done then done readonly local --verbose ${HOME} /usr/bin printf
+	--verbose done && && --verbose 2>/dev/null export && 2>/dev/null
+		'quoted text' echo local test -eu printf cd
+	then ${HOME} then then awk x=1 then "$1" && local cd | && echo done
+		"$@" printf test test $(pwd) sed readonly
+	then && $(pwd) sed then echo | x=1 readonly echo awk && then
+	&& then cd -eu sed echo done --verbose $(pwd) test awk -eu
+	grep -eu then "$@" /usr/bin grep ${HOME} "$1" done
+"$1" test /usr/bin printf test /usr/bin x=1 -eu ${HOME}
+	grep /usr/bin test | -eu test printf done grep /usr/bin --verbose
+	| then local local export cd grep | then -eu done readonly $(pwd) $(pwd) --verbose
+		export local awk done x=1 echo && awk local cd cd "$1" test $(pwd)
+printf readonly --verbose && "$1" --verbose
+	sed "$1" sed x=1 -eu 'quoted text' cd grep then done -eu cd export cd then ${HOME}
+	readonly done ${HOME} 2>/dev/null && --verbose cd -eu done sed
+		-eu "$1" readonly | echo done cd 2>/dev/null sed export 'quoted text' "$@" 'quoted text'
+	done test awk /usr/bin export test 2>/dev/null -eu sed echo --verbose local
+		echo /usr/bin local done done "$1" sed printf export local export "$@"
+done x=1 2>/dev/null 'quoted text' "$1" export | done local 'quoted text'
+grep $(pwd) "$@" && export --verbose
+${HOME} && awk echo 'quoted text' export export -eu readonly "$1" 2>/dev/null
+	'quoted text' | "$1" local printf x=1 echo "$@" test "$1" ${HOME} $(pwd) ${HOME}
+		${HOME} "$@" "$1" done -eu
+sed | "$1" readonly printf local /usr/bin
+-eu -eu x=1 ${HOME} awk local
+		x=1 sed test export echo "$@" "$1" x=1 readonly |
+echo export awk | cd "$1" awk /usr/bin awk local | -eu awk | then
+	/usr/bin && cd echo echo sed test
+		x=1 awk "$@" cd 'quoted text' printf
+"$1" $(pwd) -eu -eu export 2>/dev/null
+		readonly x=1 /usr/bin readonly /usr/bin && $(pwd) /usr/bin
+	2>/dev/null cd 2>/dev/null grep echo 2>/dev/null 2>/dev/null | awk
+	export cd awk 2>/dev/null x=1 cd test 2>/dev/null "$1" 'quoted text'
+	x=1 x=1 --verbose then awk /usr/bin /usr/bin
+	/usr/bin 2>/dev/null "$@" cd 'quoted text'
+echo ${HOME} && "$1" cd ${HOME} -eu printf | -eu &&
+echo echo cd grep -eu grep ${HOME} -eu
+		"$@" "$1" grep sed test 2>/dev/null "$1" then
+		&& export 2>/dev/null cd cd then cd export
+done local "$1" "$@" then then $(pwd) local cd cd ${HOME} export
+		echo test local $(pwd) cd x=1 "$@" readonly
+		'quoted text' export test /usr/bin "$@" "$@" | then echo printf
+	$(pwd) cd printf awk /usr/bin 2>/dev/null ${HOME}
+then "$1" cd x=1 export && 2>/dev/null local 'quoted text'
+		export export awk export local -eu "$@" "$@" grep | readonly awk --verbose
+	"$1" x=1 awk printf /usr/bin readonly 2>/dev/null --verbose
+		grep | cd cd local export local "$1" "$@" printf echo
+		readonly awk --verbose --verbose
+	done then "$1" "$@" test sed | "$@" ${HOME} readonly 2>/dev/null
+	readonly cd $(pwd) --verbose grep "$1" "$1" done printf grep readonly "$1" 'quoted text'
+	local printf --verbose /usr/bin test awk test -eu "$1" --verbose -eu grep
+	grep export -eu test 2>/dev/null cd cd
+		| local && export x=1 2>/dev/null done readonly
+sed cd readonly awk cd && && $(pwd)
+		'quoted text' /usr/bin test then "$@" local
+	echo echo --verbose then cd sed -eu awk then test $(pwd)
+		printf grep export 2>/dev/null readonly ${HOME} echo test local local
+cd test cd | grep --verbose
+	'quoted text' cd printf $(pwd) | x=1 $(pwd) export 'quoted text'
+	x=1 sed done -eu && echo
+	${HOME} awk readonly export awk echo 'quoted text' "$@"
+	printf cd x=1 /usr/bin
+/usr/bin | cd sed -eu | -eu
+'quoted text' -eu sed cd awk echo 2>/dev/null
+		readonly done "$@" grep awk awk -eu -eu "$@" grep
+	then awk $(pwd) cd $(pwd) done | | grep grep cd | readonly ${HOME} export --verbose
+	sed 'quoted text' 'quoted text' x=1 "$@" 'quoted text' "$1" echo echo echo local
+sed && 2>/dev/null printf
+	done sed "$1" $(pwd) awk ${HOME} ${HOME} awk
+	test sed | /usr/bin export x=1 && cd 'quoted text'
+	local 2>/dev/null 'quoted text' printf "$@" && x=1 export done -eu local
+		${HOME} export x=1 "$1" /usr/bin grep 2>/dev/null 'quoted text'
+		$(pwd) --verbose $(pwd) export awk "$1" $(pwd) done
+${HOME} "$@" 2>/dev/null 'quoted text'
+	-eu --verbose ${HOME} test sed "$1"
+		"$@" | $(pwd) awk --verbose then 2>/dev/null "$1"
+		"$@" --verbose 'quoted text' echo 2>/dev/null x=1
+awk x=1 --verbose --verbose
+	sed ${HOME} "$@" 2>/dev/null local done echo export printf &&
+		${HOME} && grep echo then test "$1" x=1 test 'quoted text'
+	then "$@" --verbose awk readonly --verbose grep then
+		--verbose grep sed 2>/dev/null /usr/bin local x=1 cd x=1
+		"$1" "$1" cd grep 'quoted text' 'quoted text' export grep local 'quoted text'
+awk export | awk "$@" &&
+		local && x=1 printf readonly $(pwd) ${HOME} then echo | --verbose local
+	sed awk grep test awk "$@"
+2>/dev/null cd x=1 awk echo test /usr/bin -eu cd done $(pwd)
+&& /usr/bin test grep local x=1 then && local cd /usr/bin &&
+	cd cd readonly grep /usr/bin
+	printf local local "$1" test then echo done grep
+		echo readonly $(pwd) 'quoted text'
+	printf printf x=1 /usr/bin grep /usr/bin ${HOME} readonly && 2>/dev/null
+test done | readonly 2>/dev/null
+	then test echo "$1" cd
+x=1 x=1 "$@" /usr/bin sed
+--verbose /usr/bin --verbose echo && awk
+	x=1 grep "$@" && "$1" "$1" /usr/bin grep awk done grep export cd then $(pwd)
+${HOME} "$@" local awk 'quoted text'
+		awk awk readonly 2>/dev/null printf x=1 && printf printf &&
+		export test x=1 && sed "$@" | | grep export awk local -eu
+	readonly && 2>/dev/null cd "$1" local x=1 $(pwd) &&
+"$@" "$@" | awk "$1" test -eu printf echo 2>/dev/null 'quoted text'
+		then echo export grep | $(pwd) 2>/dev/null "$@" /usr/bin test grep readonly
+		&& grep 'quoted text'
+		${HOME} sed -eu grep echo local
+2>/dev/null export export grep echo
+	echo && /usr/bin export "$@"
+test echo awk sed echo -eu -eu test "$@"
+		test done && ${HOME} grep sed test -eu 2>/dev/null sed 2>/dev/null
+x=1 | sed sed echo grep "$@" echo "$1" grep awk grep && "$1" && /usr/bin
+		then 'quoted text' done x=1 "$1" && /usr/bin ${HOME}
+	export done done 2>/dev/null
+grep test 'quoted text' 'quoted text' 2>/dev/null local /usr/bin && --verbose
+		sed cd local echo 2>/dev/null 'quoted text' 2>/dev/null awk
+		x=1 | -eu done "$1" local done /usr/bin
+		2>/dev/null 2>/dev/null /usr/bin
+	cd /usr/bin | sed grep /usr/bin "$1" then sed -eu --verbose -eu
+		x=1 cd ${HOME} then done 'quoted text' --verbose
+		cd x=1 "$@" 'quoted text' printf then
+	grep "$@" -eu grep sed ${HOME} "$@" echo export "$@" test grep readonly
+${HOME} sed ${HOME} --verbose done done 'quoted text'
+		echo readonly "$@" awk test ${HOME} readonly | echo cd readonly ${HOME} sed test
+${HOME} export x=1 -eu test
+--verbose -eu $(pwd) "$1" $(pwd) readonly echo readonly 'quoted text'
+then readonly "$@" --verbose local ${HOME} /usr/bin "$@" sed
+--verbose done sed cd local 2>/dev/null
+x=1 $(pwd) then cd ${HOME}
+2>/dev/null "$1" -eu x=1 test
+test cd && sed ${HOME} grep x=1 printf
+	echo local done echo test echo awk ${HOME}
+	printf 2>/dev/null --verbose local awk -eu printf --verbose printf test 2>/dev/null
+	${HOME} $(pwd) && done x=1 ${HOME}
+	/usr/bin $(pwd) readonly echo 2>/dev/null printf then
+		cd ${HOME} printf "$1" --verbose --verbose 'quoted text'
+		$(pwd) test 2>/dev/null export sed
+export 2>/dev/null | "$1" awk $(pwd) echo --verbose export "$1" test x=1
+-eu readonly export echo then "$@" "$1" -eu x=1 | awk local local
+done awk "$1" readonly && x=1 echo --verbose printf --verbose x=1 test
+readonly x=1 ${HOME}
+-eu awk sed 'quoted text' then
+local export "$1" printf export "$@" echo done cd
+printf "$@" echo | -eu local printf awk -eu then grep && export 2>/dev/null "$1"
+awk x=1 "$1" cd $(pwd) 'quoted text' cd 2>/dev/null
+	echo 2>/dev/null printf 'quoted text'
+		"$1" --verbose export -eu cd
+		"$@" readonly "$@" $(pwd) printf
+	echo cd 2>/dev/null done awk "$1" x=1 -eu then /usr/bin grep sed printf $(pwd) then
+	grep --verbose && sed then "$@" export echo readonly then export
+	grep | --verbose sed $(pwd) -eu local then 'quoted text'
+	grep cd "$1" $(pwd) awk echo awk printf && echo readonly sed awk awk done 'quoted text'
+then local test printf then /usr/bin "$@" /usr/bin -eu "$@" sed
+		local "$@" printf "$1" "$@" printf "$1" sed
+"$@" export sed cd --verbose sed --verbose cd -eu export ${HOME} done x=1
+		test test /usr/bin echo -eu echo export printf readonly 2>/dev/null
+		printf | export test 2>/dev/null
+		-eu echo -eu -eu -eu
+		readonly local -eu 2>/dev/null
+	test "$1" local local ${HOME} then done && test && readonly echo
+'quoted text' x=1 grep $(pwd) --verbose --verbose then export
+		"$1" $(pwd) -eu printf --verbose test 'quoted text'
+	2>/dev/null export test export 'quoted text' ${HOME}
+		x=1 2>/dev/null cd echo cd --verbose "$1" "$1" "$@" "$1"
+		| ${HOME} local $(pwd) printf
+"$@" awk grep 2>/dev/null local local local
+awk test 'quoted text' echo
+'quoted text' /usr/bin
+	export local && "$1" readonly test cd -eu readonly 2>/dev/null /usr/bin local done
+		echo && 2>/dev/null | cd "$@" then
+		cd --verbose "$@" --verbose -eu done awk readonly readonly
+	2>/dev/null sed echo export export
+		sed echo export sed /usr/bin "$1"
+		export "$@" then && "$1" cd -eu &&
+${HOME} && readonly ${HOME} readonly awk done readonly /usr/bin
+		sed --verbose grep 'quoted text'
+awk then readonly --verbose -eu | cd then "$1" $(pwd) done
+export | /usr/bin ${HOME} readonly 2>/dev/null local cd --verbose 2>/dev/null &&
+	x=1 2>/dev/null ${HOME} "$1" grep readonly
+2>/dev/null export $(pwd) "$1" sed
+	sed done ${HOME} ${HOME} grep -eu /usr/bin | awk && 2>/dev/null $(pwd)
+		cd local x=1 printf 'quoted text'
+		${HOME} ${HOME} test awk readonly $(pwd) /usr/bin grep
+		x=1 local readonly && done "$1" | done sed then && 'quoted text' "$1" -eu "$1"
+then grep 2>/dev/null $(pwd) /usr/bin $(pwd) done grep 2>/dev/null grep then
+		done | local done --verbose
+	x=1 readonly done && then "$@" then 2>/dev/null
+		readonly done awk /usr/bin printf -eu --verbose --verbose ${HOME} x=1 "$1"
+		done done "$@" echo echo -eu 2>/dev/null ${HOME} echo
+		--verbose echo "$1" sed 2>/dev/null cd -eu cd then
+		done $(pwd) ${HOME} | 2>/dev/null printf --verbose
+		grep cd ${HOME} cd "$@" grep $(pwd) done then 2>/dev/null readonly "$1" echo
+	-eu readonly done awk "$@" export local
+	test | done done | $(pwd)
+	then x=1 local -eu 2>/dev/null export "$@" grep 'quoted text'
+		echo "$@" ${HOME} x=1 && echo awk /usr/bin /usr/bin /usr/bin test -eu cd
+cd then --verbose | x=1 cd local then && ${HOME} /usr/bin cd ${HOME} echo
+		2>/dev/null "$1" ${HOME}
+test && "$1" $(pwd) $(pwd) | "$1" local
+		-eu "$1" export "$1" done "$1" cd sed
+sed echo printf | export && local -eu awk $(pwd) /usr/bin local printf x=1 readonly
+	/usr/bin && grep --verbose then --verbose 'quoted text' $(pwd) "$1" x=1
+--verbose -eu awk -eu export x=1 printf grep readonly $(pwd) export
+x=1 printf "$1" 2>/dev/null then "$@" sed readonly
+grep | cd export $(pwd) 'quoted text' x=1
+		test export cd printf $(pwd) done printf done local
+		test echo && done done --verbose
+/usr/bin done 'quoted text'
+		${HOME} echo then 2>/dev/null test 2>/dev/null cd
+	then readonly test | export
+$(pwd) export --verbose
+		${HOME} grep printf ${HOME} 'quoted text' "$1" grep "$1" "$@" local
+| awk grep | readonly -eu printf | ${HOME} -eu --verbose --verbose
+	&& $(pwd) readonly sed local readonly
+export local cd export then then test 2>/dev/null sed echo | test export
+		echo 'quoted text' /usr/bin ${HOME} local local
+	done cd readonly --verbose export -eu readonly x=1 $(pwd) export readonly
+	echo 'quoted text' $(pwd) $(pwd)
+	/usr/bin readonly awk && ${HOME}
+		/usr/bin -eu --verbose export export echo -eu readonly
+	awk done echo | test --verbose done x=1 printf "$@" then
+	${HOME} cd echo | "$1" echo "$1"
+	${HOME} local echo && grep 'quoted text' ${HOME} x=1 /usr/bin echo && $(pwd)
+		x=1 "$@" -eu sed x=1 test 2>/dev/null
+	-eu awk echo local awk readonly
+awk ${HOME} printf --verbose cd export export printf --verbose
+	--verbose --verbose cd --verbose /usr/bin 2>/dev/null
+"$1" test --verbose then awk sed x=1 $(pwd) awk
+	${HOME} then "$1" printf local echo cd echo /usr/bin
+| "$1" 'quoted text' "$1" echo echo done
+		/usr/bin -eu -eu echo x=1 && grep 'quoted text'
+	/usr/bin awk readonly 2>/dev/null $(pwd) grep && local
+		done /usr/bin echo then --verbose
+then readonly x=1 export awk grep sed /usr/bin 'quoted text' "$1" $(pwd)
+	&& $(pwd) awk local export echo x=1 done --verbose
+		readonly ${HOME} echo
+		done printf 'quoted text' done export export cd echo cd ${HOME}
+		test ${HOME} then | 2>/dev/null
+		${HOME} awk cd "$1" cd sed | done readonly && grep "$1"
+		/usr/bin "$1" local ${HOME} cd 2>/dev/null grep x=1 echo 2>/dev/null
+	&& ${HOME} sed cd test grep export test -eu ${HOME} 'quoted text' awk awk -eu
+x=1 x=1 $(pwd) x=1 "$@" -eu grep
+		sed readonly /usr/bin sed "$@" cd && cd then cd $(pwd)
+	--verbose printf x=1 $(pwd) $(pwd) sed | 'quoted text'
+	printf readonly "$1" sed grep awk "$1" awk awk &&
+		readonly then "$1" echo -eu printf $(pwd) sed "$@" | sed grep "$@" "$1" && grep
+		'quoted text' /usr/bin /usr/bin -eu /usr/bin printf test x=1 'quoted text'
+-eu -eu cd export /usr/bin ${HOME} -eu
+		printf 2>/dev/null "$1" echo $(pwd) echo 'quoted text' x=1 then cd $(pwd) local
+		"$@" done echo readonly -eu x=1 local
+	${HOME} "$1" sed export cd $(pwd) "$1" local 'quoted text' test ${HOME} 2>/dev/null
+export done printf ${HOME} local done | done sed 2>/dev/null done /usr/bin
+2>/dev/null x=1 -eu x=1 /usr/bin -eu done
+	$(pwd) grep awk ${HOME} echo then -eu echo echo &&
+		local --verbose | && echo readonly "$1" printf
+		| sed 2>/dev/null | "$@" local done export /usr/bin "$@" --verbose $(pwd) grep -eu
+		"$1" $(pwd) grep done /usr/bin sed && done cd echo readonly $(pwd)
+sed $(pwd) printf && 'quoted text' --verbose
+	$(pwd) awk cd done /usr/bin --verbose -eu then
+/usr/bin /usr/bin && cd --verbose readonly
+	--verbose && $(pwd) "$1" test
+then 2>/dev/null grep x=1
+		then 'quoted text' | |
+then 'quoted text' && awk
+		--verbose test echo sed then $(pwd) "$1" sed ${HOME} grep $(pwd) "$@" echo
+	printf 'quoted text' 'quoted text' x=1 --verbose
+cd sed readonly --verbose "$1" printf echo /usr/bin -eu "$1" cd printf printf
+readonly grep 'quoted text' | test local
+	sed then export "$1" done then export 2>/dev/null
+	-eu && x=1 $(pwd) awk -eu printf sed ${HOME}
+-eu $(pwd) --verbose echo 2>/dev/null 'quoted text' grep
+		printf -eu --verbose printf readonly
+		test sed | ${HOME} then --verbose ${HOME} | "$1"
+	'quoted text' "$1" test $(pwd) | -eu /usr/bin /usr/bin /usr/bin
+	cd "$@" grep $(pwd) cd local -eu
+		done then "$@" then "$1" awk
+		done readonly $(pwd) grep 'quoted text' awk awk echo cd | then "$1"
+printf then 2>/dev/null grep
+printf grep printf && x=1 local ${HOME}
+		printf echo then done /usr/bin x=1 local "$1" cd sed readonly 'quoted text'
+'quoted text' $(pwd) sed -eu awk done local 2>/dev/null printf "$1" /usr/bin
+printf local 2>/dev/null 2>/dev/null export sed --verbose readonly
+local 'quoted text' $(pwd) | export test local
+	export grep ${HOME} $(pwd) local done $(pwd) --verbose
+'quoted text' readonly then ${HOME} /usr/bin
+done test 2>/dev/null x=1 x=1 local awk "$@" echo cd 2>/dev/null then 2>/dev/null
+	$(pwd) sed /usr/bin printf x=1 ${HOME} 2>/dev/null "$1" --verbose test 2>/dev/null
+readonly sed 2>/dev/null -eu
+'quoted text' | readonly "$@" echo 2>/dev/null
+	x=1 readonly then | export awk done cd
+	'quoted text' export "$@" ${HOME} grep awk | x=1 done cd 'quoted text'
+	"$@" done then /usr/bin --verbose sed test test
+		sed done grep test cd
+		/usr/bin && 'quoted text' then /usr/bin $(pwd) grep -eu echo readonly awk 'quoted text'
+"$@" then --verbose 'quoted text' 'quoted text' done -eu
+	test 'quoted text' x=1 printf x=1 -eu test | x=1 "$1" echo 2>/dev/null /usr/bin
+	then 'quoted text' then local cd "$1" x=1
+	$(pwd) -eu grep -eu local $(pwd) -eu x=1 done echo -eu /usr/bin 'quoted text'
+sed /usr/bin grep 'quoted text' then sed
+then x=1 "$1" then printf &&
+	grep | then done --verbose readonly export
+export awk $(pwd) -eu "$@"
+| 2>/dev/null readonly &&
+	awk 2>/dev/null printf x=1 ${HOME} test readonly cd then readonly cd && cd echo
+	x=1 then $(pwd) "$1" 'quoted text' then cd $(pwd)
+-eu ${HOME} 'quoted text' ${HOME} local 'quoted text' && /usr/bin 2>/dev/null
+printf done grep echo sed
+	x=1 then then | grep "$1" sed sed done local x=1 --verbose local echo grep 'quoted text'
+	cd 2>/dev/null done "$1" sed
+	test echo "$1" "$1" x=1 $(pwd)
+"$1" "$@" /usr/bin /usr/bin test 2>/dev/null
+		&& done 2>/dev/null "$@"
+done done 'quoted text' ${HOME} x=1 sed && echo 'quoted text'
+	echo 2>/dev/null echo readonly echo /usr/bin "$1" /usr/bin $(pwd)
+	&& x=1 && grep done done awk x=1 'quoted text' /usr/bin --verbose && -eu
+sed 2>/dev/null $(pwd) readonly -eu cd x=1 local cd then echo grep 'quoted text'
+test test awk test printf -eu /usr/bin "$1" --verbose ${HOME} done
+		readonly x=1 printf readonly
+	${HOME} printf export done --verbose
+	2>/dev/null -eu $(pwd) x=1 "$@" ${HOME} grep test done grep
+		cd --verbose local x=1 x=1 awk "$1" test readonly done echo export 2>/dev/null
+&& awk sed printf then test $(pwd) sed && "$@" printf test sed
+-eu grep grep -eu "$1" x=1
+/usr/bin | --verbose sed then cd readonly ${HOME} /usr/bin
+		awk echo cd readonly echo awk awk -eu -eu
+$(pwd) test readonly test -eu 'quoted text' -eu ${HOME} printf
+		test awk echo --verbose x=1
+	done sed /usr/bin ${HOME} readonly readonly printf "$@" && 2>/dev/null echo 2>/dev/null
+	-eu 2>/dev/null 'quoted text' -eu 'quoted text'
+		-eu "$1" "$@" x=1 cd "$@"
+	-eu 2>/dev/null "$@" 2>/dev/null test | grep "$1" local then
+sed "$1" local test $(pwd)
+		"$@" && export grep 2>/dev/null printf 'quoted text' then export awk test
+	"$1" /usr/bin export "$1" -eu export -eu awk echo 'quoted text' local
+		&& $(pwd) sed "$1" local echo done 2>/dev/null "$1" "$@"
+		| /usr/bin grep $(pwd) local ${HOME}
+"$1" $(pwd) echo export test | echo readonly test
+		cd sed test x=1 'quoted text'
+		"$@" 'quoted text' test sed test --verbose ${HOME} export grep &&
+		/usr/bin grep -eu done local -eu awk done test
+	printf 'quoted text' | awk sed 2>/dev/null "$1" "$@" awk 2>/dev/null export /usr/bin
+	-eu "$1" echo $(pwd) grep "$@" sed "$@" /usr/bin then /usr/bin awk x=1 "$1"
+		printf -eu -eu --verbose cd x=1 ${HOME} 2>/dev/null export
+echo test readonly /usr/bin local cd test "$@" cd done sed "$1" cd && sed
+	-eu local test 'quoted text' cd cd then 'quoted text'
+	readonly done "$1" done awk awk ${HOME} "$1" test export awk 2>/dev/null
+		"$@" 'quoted text' done test ${HOME} printf echo
+x=1 "$1" -eu test "$@" readonly ${HOME}
+echo sed 'quoted text' printf | /usr/bin "$@" local /usr/bin test
+&& grep /usr/bin export awk /usr/bin 'quoted text' |
+"$1" cd 2>/dev/null cd then /usr/bin grep printf readonly test awk && printf
+		readonly cd "$1" readonly printf | test then
+cd --verbose ${HOME} "$1" "$@"
+		${HOME} done cd x=1 awk "$1" done
+	--verbose readonly done readonly |
+local ${HOME} -eu export
+	"$1" readonly sed /usr/bin grep printf -eu printf echo local /usr/bin x=1 "$1"
+	echo ${HOME} readonly
+		local grep /usr/bin cd "$1" /usr/bin
+		export grep then export grep readonly
+	printf 'quoted text' x=1
+	'quoted text' 2>/dev/null
+		'quoted text' 2>/dev/null x=1
+	echo --verbose awk | "$@" 2>/dev/null
+	readonly local cd printf "$@" awk $(pwd) --verbose local 'quoted text'
+		done "$@" && -eu && "$@" x=1 2>/dev/null 2>/dev/null export "$@" echo sed
+	--verbose --verbose 'quoted text' ${HOME}
+	done grep echo awk $(pwd) echo printf "$@" && 'quoted text'
+		--verbose readonly $(pwd) 2>/dev/null awk sed -eu export
+	"$@" grep x=1 done -eu sed "$1" 2>/dev/null $(pwd) --verbose
+&& 'quoted text' | 'quoted text' printf /usr/bin 'quoted text' grep x=1
+	2>/dev/null --verbose awk awk 2>/dev/null && grep | grep sed --verbose --verbose
+		2>/dev/null | test test local -eu -eu test 'quoted text' awk cd cd awk readonly
+	${HOME} echo awk $(pwd) && printf "$1"
+		echo $(pwd) grep $(pwd) readonly local
+--verbose x=1 /usr/bin grep test && then printf
+	x=1 awk grep -eu readonly then && | -eu cd ${HOME} cd local
+	readonly $(pwd) done "$1" echo "$1" printf export && $(pwd) printf export &&
+		-eu 'quoted text' x=1 x=1 awk "$1" echo local export
+&& "$@" export done ${HOME} | local 'quoted text' readonly
+	cd readonly ${HOME} printf local --verbose "$@" /usr/bin
+		grep test -eu /usr/bin | printf "$1" then done
+"$@" ${HOME} export x=1 readonly 2>/dev/null readonly x=1 "$@" ${HOME}
+		echo x=1 -eu /usr/bin 'quoted text' test then grep export
+		--verbose 'quoted text' "$@" cd readonly readonly local printf /usr/bin readonly
+	${HOME} awk 'quoted text'
+	$(pwd) local 2>/dev/null
+	"$@" then readonly --verbose export export printf "$1" && printf "$1" "$1"
+cd done then "$@" sed ${HOME} grep && printf x=1 "$1" done
+	awk "$@" /usr/bin readonly -eu /usr/bin
+		"$@" printf "$@" printf x=1 --verbose ${HOME} ${HOME} sed grep
+	export cd $(pwd) && echo printf echo sed -eu awk 'quoted text'
+| readonly "$@" -eu ${HOME}
+	x=1 2>/dev/null 2>/dev/null
+		sed export $(pwd) grep printf && test ${HOME} awk -eu x=1 $(pwd) &&
+grep local test 2>/dev/null awk echo /usr/bin cd 2>/dev/null --verbose
+		"$1" printf | then grep readonly grep $(pwd)
+	readonly done 'quoted text' done printf cd done
+	echo echo done then sed /usr/bin "$1" -eu
+"$@" export done grep awk --verbose -eu x=1 &&
+	'quoted text' grep | ${HOME}
+		$(pwd) export export && --verbose /usr/bin export then done then /usr/bin
+	&& grep local done test sed "$1" && grep sed done x=1 then --verbose
+		then cd done "$@" && test done echo awk $(pwd) readonly done
+	&& export printf then awk done x=1 -eu done cd 'quoted text'
+		sed test then done /usr/bin && 'quoted text' && -eu grep cd done x=1
+--verbose export ${HOME}
+	awk x=1 awk cd readonly && local echo grep done
+	echo grep export x=1 grep cd 'quoted text' 'quoted text' printf $(pwd) $(pwd)
+	| "$1" cd && test && /usr/bin
+	/usr/bin export --verbose x=1 ${HOME} ${HOME} local
+	x=1 awk "$@" awk 2>/dev/null printf "$1" readonly grep 'quoted text' grep /usr/bin
+	--verbose echo awk then printf && echo export
+	x=1 test awk done -eu sed -eu 'quoted text'
+		sed "$@" done grep sed awk ${HOME} /usr/bin /usr/bin
+	local $(pwd) sed printf ${HOME} readonly
+	--verbose | readonly && done awk ${HOME} x=1 local --verbose done awk readonly
+	&& test then /usr/bin export -eu /usr/bin /usr/bin 'quoted text' cd
+		printf "$1" | x=1 cd done /usr/bin export | | "$1" 2>/dev/null /usr/bin
+		sed ${HOME} --verbose export 'quoted text' test 2>/dev/null echo
+printf echo $(pwd) grep "$1" export awk ${HOME}
+		/usr/bin ${HOME} then grep cd sed /usr/bin awk sed -eu done "$1" -eu grep printf
+x=1 cd $(pwd) grep && printf $(pwd) grep 2>/dev/null
+		done then "$1" "$@" | x=1 then
+-eu "$@" grep awk 'quoted text' 'quoted text' test "$1" done 2>/dev/null local
+		$(pwd) grep "$1" --verbose test test echo grep /usr/bin readonly
+--verbose done done export "$@" done
+		awk sed then test readonly grep -eu printf
+"$1" awk "$1" printf done $(pwd) /usr/bin done --verbose local "$1" 2>/dev/null
+	local "$@" 'quoted text' then readonly local
+		awk cd done awk then then /usr/bin awk then grep --verbose awk grep then && && 'quoted text'
+	then readonly && test local awk "$1" --verbose
+		-eu -eu printf /usr/bin --verbose "$@" cd printf export &&
+	cd | x=1 && cd grep 'quoted text' echo sed x=1 /usr/bin /usr/bin printf local
+	done grep 'quoted text' readonly "$@" "$@" grep sed
+	local && && x=1 printf $(pwd) ${HOME} 2>/dev/null sed test "$@" /usr/bin "$@"
+test cd printf /usr/bin awk readonly x=1
+	'quoted text' && done sed --verbose /usr/bin export "$@" test grep
+	test readonly 'quoted text'
+	"$1" cd | readonly done --verbose --verbose 'quoted text'
+sed grep done then "$@"
+	local printf export awk readonly
+	sed local done "$1" cd printf then echo
+'quoted text' local && | printf printf --verbose "$1" printf && x=1 | readonly
+"$@" sed && "$1" done test readonly x=1 && 2>/dev/null
+"$1" && $(pwd) local -eu readonly readonly export export printf
+		${HOME} cd grep awk grep done echo
+		&& local "$@" done echo grep 2>/dev/null 2>/dev/null -eu then export local | | readonly
+		awk cd | cd $(pwd) /usr/bin "$@"
+export done /usr/bin then x=1 grep $(pwd) 2>/dev/null
+		"$1" sed sed "$@" ${HOME} echo /usr/bin && done sed | printf --verbose
+cd cd cd -eu echo echo "$@"
+	$(pwd) x=1 "$1" printf export
+${HOME} export "$1" test done 'quoted text' awk && local awk grep "$1"
+		sed --verbose export -eu export /usr/bin 'quoted text' -eu local then "$1" printf
+		readonly "$1" $(pwd) $(pwd) -eu grep readonly then echo awk ${HOME} -eu
+echo x=1 export echo ${HOME}
+	sed --verbose /usr/bin readonly local 'quoted text' 2>/dev/null echo printf "$1"
+	done echo export awk 'quoted text' local 'quoted text' then x=1 $(pwd)
+grep local printf "$@" | test $(pwd) cd awk 'quoted text'
+	--verbose readonly "$@" 'quoted text' && ${HOME} cd -eu && "$@" --verbose grep
+		export cd echo $(pwd) "$1" $(pwd) awk
+	'quoted text' cd --verbose local | --verbose cd
+		export readonly --verbose && readonly 'quoted text' x=1 cd awk 2>/dev/null
+		/usr/bin ${HOME} echo then
+	sed $(pwd) cd printf awk | 'quoted text'
+	'quoted text' readonly x=1 && && "$@" grep export export x=1 'quoted text'
+x=1 x=1 sed | /usr/bin awk "$@" echo x=1 /usr/bin grep "$@" readonly
+"$1" | $(pwd) awk then /usr/bin "$@" done 2>/dev/null -eu
+		--verbose export then awk && "$1" grep ${HOME} 2>/dev/null sed grep readonly ${HOME}
+	| && echo 'quoted text' | 'quoted text' awk
+	readonly --verbose printf -eu awk local $(pwd) printf x=1 /usr/bin printf done
+"$@" echo --verbose export sed /usr/bin awk then readonly
+export export export "$1" | awk -eu x=1 $(pwd) -eu cd "$@"
+	awk "$@" --verbose then --verbose test awk
+		local export test x=1 cd
+		sed 'quoted text' 'quoted text' $(pwd) x=1 "$@" /usr/bin "$1" 'quoted text'
+test $(pwd) test | /usr/bin readonly local cd cd cd /usr/bin local
+	/usr/bin grep /usr/bin | $(pwd) readonly grep cd export echo
+	local /usr/bin grep done printf echo "$@"
+'quoted text' 'quoted text' done export
+	2>/dev/null "$@" $(pwd) "$1" echo then $(pwd) && awk then -eu
+readonly $(pwd) ${HOME} awk local awk test 2>/dev/null sed grep x=1
+		&& --verbose export | printf 'quoted text' export && export "$@" printf
+	export awk "$@" -eu "$1" 'quoted text' /usr/bin 2>/dev/null
+x=1 /usr/bin -eu 'quoted text' "$1" $(pwd) local
+	x=1 | printf --verbose | 'quoted text'
+	/usr/bin then awk cd /usr/bin test readonly
+2>/dev/null cd printf export local
+	${HOME} /usr/bin 2>/dev/null "$1"
+		export sed && test | "$1" test /usr/bin
+	grep $(pwd) awk 2>/dev/null x=1 test local awk printf readonly
+	done "$1" && echo --verbose "$1" | --verbose local 2>/dev/null cd /usr/bin
+"$@" && echo then readonly && && x=1 ${HOME} done && 'quoted text'
+	then --verbose done -eu 'quoted text' && 'quoted text' echo --verbose ${HOME}
+	/usr/bin ${HOME} grep readonly then -eu
+	&& export test $(pwd) ${HOME} echo
+/usr/bin readonly grep "$1" done local printf awk ${HOME}
+readonly 'quoted text'
+		export echo -eu 2>/dev/null
+		awk && 'quoted text' | local readonly readonly ${HOME} done export
+readonly 2>/dev/null -eu then sed | test sed
+	echo --verbose then grep readonly 'quoted text'
+	$(pwd) 2>/dev/null /usr/bin
+		then && export test x=1 then | --verbose
+	then echo export -eu grep | cd readonly export sed 'quoted text' 2>/dev/null
+		/usr/bin done && readonly grep then x=1 grep echo readonly "$@" export echo
+		done -eu sed awk awk | "$1" then test cd echo readonly then | -eu
+	"$1" cd done awk sed -eu cd grep x=1 "$@" then "$@" cd x=1 'quoted text' 2>/dev/null
+		local local $(pwd) --verbose "$@" | -eu
+--verbose echo echo | --verbose grep grep
+		readonly 2>/dev/null ${HOME} x=1 echo readonly
+	done awk -eu test readonly done then awk cd |
+		test && export sed readonly
+awk cd readonly printf test test cd export 2>/dev/null echo
+"$1" /usr/bin then grep export export cd "$@"
+	--verbose echo && | local done test echo /usr/bin 2>/dev/null
+export test test 2>/dev/null sed 'quoted text' then "$@" export "$@"
+	readonly x=1 awk done readonly 2>/dev/null "$1" /usr/bin local echo sed test "$@"
+| -eu | local echo cd grep done printf done /usr/bin x=1 2>/dev/null
+		readonly --verbose sed ${HOME} export | done sed readonly done x=1 export -eu
+		x=1 ${HOME} sed cd "$@" echo test 2>/dev/null
+		then then echo ${HOME} test && $(pwd) "$@"
+awk then "$1" awk 2>/dev/null | export $(pwd) grep done done done
+	then "$1" | ${HOME} --verbose -eu readonly awk "$@" && export
+		local "$1" /usr/bin "$@" done readonly
+	sed sed cd x=1 /usr/bin && "$1" -eu && then | 'quoted text' then sed
+	'quoted text' readonly done ${HOME} cd test 2>/dev/null grep $(pwd) "$1"
+x=1 "$@" done "$@" awk --verbose
+cd && printf --verbose $(pwd) && /usr/bin awk $(pwd)
+'quoted text' 'quoted text' ${HOME}
+		"$1" then ${HOME} done local && done readonly then && | "$1" x=1 then "$@"
+'quoted text' "$@" done "$@" 'quoted text' &&
+	$(pwd) test export --verbose /usr/bin grep done
+	export test cd x=1 awk "$@" 'quoted text' ${HOME} awk && grep -eu && readonly
+grep done export echo grep test
+	/usr/bin && ${HOME} $(pwd) test "$@" echo printf done | test
+		${HOME} printf awk then readonly local
+cd cd "$1" local "$1" $(pwd) readonly 'quoted text'
+	x=1 | then grep printf 'quoted text' echo | 2>/dev/null "$1" printf done
+	grep test cd awk "$@" cd -eu readonly local 'quoted text' "$@" printf
+	"$@" printf --verbose --verbose test /usr/bin
+		printf /usr/bin done export -eu && && sed "$@" "$@" "$1" && local "$1"
+/usr/bin test then -eu "$1" -eu sed local
+export x=1 grep && | | ${HOME} done &&
+		$(pwd) grep && x=1 2>/dev/null "$1" $(pwd) --verbose
+	printf --verbose done test 'quoted text' awk 2>/dev/null
+	echo $(pwd) local sed test echo sed test
+	-eu export test x=1 test | | test x=1
+		"$1" -eu x=1 "$1" done "$@"
+	${HOME} | grep local ${HOME} "$1" | then readonly readonly
+$(pwd) done echo ${HOME} echo
+printf ${HOME} awk 2>/dev/null readonly ${HOME} --verbose grep $(pwd)
+	| x=1 grep && then "$1" 2>/dev/null && x=1 awk $(pwd) 'quoted text' "$@" grep
+		cd ${HOME} /usr/bin -eu -eu "$@" then
+awk export done | awk x=1 grep && /usr/bin && "$1" $(pwd) sed "$@" "$@" 2>/dev/null
+"$1" --verbose "$@" x=1 local "$1" | 'quoted text' printf
+		test && | ${HOME} test | | "$1" done grep then printf grep local export
+		"$1" "$1" "$@" then $(pwd) echo echo grep && --verbose done local
+		2>/dev/null readonly | awk
+test -eu cd --verbose echo printf 2>/dev/null
+	test 2>/dev/null ${HOME} $(pwd) sed printf
+		"$1" -eu cd 2>/dev/null readonly "$1" echo "$@" $(pwd) --verbose
+		readonly grep 'quoted text'
+&& x=1 sed 2>/dev/null "$1" -eu --verbose --verbose "$@" readonly echo
+		sed "$1" x=1 cd | done "$@" then "$@"
+	&& $(pwd) --verbose local "$1" cd "$1" "$@" awk 'quoted text' readonly $(pwd)
+		done readonly --verbose sed -eu sed printf
+	echo grep -eu x=1 test then "$@" ${HOME}
+	echo "$1" 'quoted text' 'quoted text'
+	done | "$@" grep local awk export printf
+2>/dev/null "$1" | "$@"
+	readonly 'quoted text' 2>/dev/null export cd export "$@"
+	test --verbose echo --verbose
+		test echo && grep x=1 /usr/bin x=1 $(pwd)
+		--verbose local readonly $(pwd) done
+test echo export grep "$@" 2>/dev/null --verbose echo && -eu then
+		"$@" 2>/dev/null 'quoted text' readonly 2>/dev/null done echo "$@" grep
+sed "$@" local readonly printf local readonly | awk $(pwd) done /usr/bin --verbose
+		then && 'quoted text' sed --verbose echo "$@" | then awk printf
+		-eu done $(pwd) sed echo 2>/dev/null $(pwd)
+printf 'quoted text' x=1 --verbose awk
+		readonly sed 'quoted text' $(pwd) grep export readonly
+	awk local x=1 "$@" readonly -eu sed && then --verbose -eu /usr/bin test &&
+		2>/dev/null 2>/dev/null done x=1 local grep echo $(pwd)
+		-eu -eu 'quoted text' --verbose echo sed grep x=1 printf
+		${HOME} export local "$1" "$1" $(pwd) sed && printf echo awk grep
+${HOME} cd && "$1" x=1 /usr/bin grep "$1" -eu sed cd 2>/dev/null cd grep
+	| done | printf 2>/dev/null local printf
+		--verbose | export readonly grep |
+'quoted text' cd cd $(pwd) "$@" /usr/bin "$@" awk /usr/bin
+		export -eu test | /usr/bin x=1 ${HOME} && readonly
+sed "$1" done sed grep readonly "$@" printf "$@" sed x=1 done grep cd | && 'quoted text'
+		sed 'quoted text' local /usr/bin && ${HOME} printf echo
+then --verbose sed awk done "$@" "$@" sed $(pwd) grep grep
+	sed --verbose --verbose
+	grep $(pwd) && then $(pwd) printf
+	"$@" then local awk test x=1 /usr/bin
+$(pwd) "$@" | $(pwd) && -eu printf test ${HOME} done "$1" grep grep
+		| readonly "$1" ${HOME} ${HOME} $(pwd) /usr/bin $(pwd) local
+		local "$@" test "$1" 'quoted text' grep "$1" "$@" ${HOME}
+	&& x=1 grep 2>/dev/null printf sed "$1" 2>/dev/null
+	"$@" local sed sed sed then 'quoted text' /usr/bin local grep
+		"$@" 'quoted text' readonly --verbose sed cd x=1 /usr/bin test echo
+		export $(pwd) grep | readonly echo && x=1 done 'quoted text' $(pwd) | sed done
+"$@" echo grep cd awk grep readonly 'quoted text' awk test test export echo
+		'quoted text' sed | then local export "$@" readonly | x=1 | "$@" echo readonly
+		done echo grep x=1 readonly
+		$(pwd) && 2>/dev/null /usr/bin "$1"
+x=1 $(pwd) sed ${HOME} --verbose local 2>/dev/null cd awk "$1" --verbose
+	/usr/bin echo && cd export 'quoted text' -eu ${HOME}
+--verbose ${HOME} /usr/bin grep printf /usr/bin /usr/bin readonly ${HOME}
+	sed cd then echo sed "$@" awk grep grep grep export echo
+		"$@" -eu && done export grep 2>/dev/null echo readonly
+local printf export then awk && && 'quoted text'
+	"$@" 2>/dev/null && -eu /usr/bin printf
+	test 2>/dev/null grep
+		'quoted text' awk readonly readonly export /usr/bin
+		&& test --verbose done then 'quoted text'
+		-eu 'quoted text' 'quoted text' /usr/bin export "$1" local local | local ${HOME}
+--verbose /usr/bin "$1" "$@" test --verbose "$@" local then printf
+	| printf awk 'quoted text' /usr/bin 2>/dev/null grep then -eu export then
+	$(pwd) grep grep --verbose done readonly export "$1" | -eu x=1
+"$1" $(pwd) -eu grep --verbose --verbose test test
+awk cd "$@" && 2>/dev/null --verbose awk /usr/bin export done 'quoted text' then
+		test readonly && && export && awk awk "$1" echo -eu "$@" awk sed ${HOME}
+		grep "$@" grep | grep 'quoted text'
+	2>/dev/null --verbose printf | | done 2>/dev/null then printf
+-eu test awk done --verbose test
+	cd grep export $(pwd) grep -eu printf readonly &&
+	$(pwd) && then readonly cd echo test $(pwd) -eu done "$1" $(pwd)
+grep printf /usr/bin readonly export
+		-eu echo printf -eu "$@" ${HOME} x=1 |
+	printf 'quoted text' done cd echo "$1" then ${HOME} local
+		--verbose sed sed readonly /usr/bin cd ${HOME} --verbose
+	test sed 2>/dev/null done printf sed grep test then 2>/dev/null echo
+	${HOME} awk && printf then && echo 2>/dev/null x=1 && 'quoted text' &&
+		x=1 'quoted text' export local test -eu --verbose
+&& --verbose grep /usr/bin
+printf sed local echo local 'quoted text' cd /usr/bin
+/usr/bin 'quoted text' |
+'quoted text' /usr/bin --verbose local | readonly local cd "$@"
+x=1 2>/dev/null "$1" --verbose cd x=1 ${HOME} --verbose
+	--verbose export then sed then done "$1" -eu 'quoted text'
+readonly x=1 /usr/bin awk 2>/dev/null readonly 2>/dev/null awk cd && $(pwd)
+sed 'quoted text' test -eu cd sed -eu readonly sed x=1 sed local |
+| $(pwd) $(pwd) readonly readonly "$1" printf sed
+test /usr/bin /usr/bin -eu then ${HOME} printf done grep local 2>/dev/null 'quoted text'
+	"$@" 2>/dev/null 'quoted text' | && && && done --verbose export
+		awk readonly then 'quoted text' "$1" && cd -eu &&
+	-eu "$1" test readonly $(pwd) cd
+printf "$@" x=1 awk "$1" printf sed grep "$@" | readonly
+		&& then done echo /usr/bin 2>/dev/null $(pwd) readonly
+$(pwd) "$1" export test "$1" then sed && -eu --verbose local
+	"$1" --verbose cd -eu ${HOME} "$@" | done --verbose sed ${HOME}
+		sed export 2>/dev/null ${HOME}
+		2>/dev/null "$1" readonly /usr/bin --verbose
+	2>/dev/null 2>/dev/null ${HOME} x=1 export "$1" -eu ${HOME} sed sed echo test
+		printf then echo printf --verbose readonly $(pwd) /usr/bin awk ${HOME} test sed
+done then awk cd $(pwd)
+		export done grep awk x=1 ${HOME} x=1 | readonly done local $(pwd) && done
+		2>/dev/null echo export
+	readonly export printf "$@" local -eu -eu | && then echo then
+	export cd test /usr/bin | local printf
+	then "$1" 2>/dev/null "$1" then echo awk
+	/usr/bin ${HOME} cd readonly
+	done 'quoted text' cd export ${HOME} "$1" printf cd sed local awk |
+	&& local readonly 2>/dev/null then $(pwd) $(pwd) ${HOME} awk sed printf echo cd
+		done "$1" printf ${HOME} echo awk --verbose --verbose
+"$1" 'quoted text' export readonly 2>/dev/null | x=1
+	sed && then "$1" awk test cd sed then $(pwd) /usr/bin
+		| then readonly --verbose -eu x=1 x=1 $(pwd)
+${HOME} local && local printf $(pwd) 2>/dev/null $(pwd) /usr/bin awk export 2>/dev/null
+	printf $(pwd) && printf readonly done --verbose cd "$1"
+		local 'quoted text' | "$@" ${HOME} -eu cd --verbose printf
+test && "$1" printf awk export readonly x=1 /usr/bin test grep
+	local printf export then /usr/bin local -eu &&
+export awk local readonly export then | sed test "$1" -eu "$@"
+/usr/bin -eu printf ${HOME}
+	'quoted text' local && && --verbose
+	"$@" local cd x=1 awk -eu | grep awk "$@" readonly 'quoted text'
+	then "$1" --verbose "$@" "$@" x=1
+	test done -eu | echo 2>/dev/null /usr/bin
+local echo $(pwd) grep local /usr/bin then cd awk local
+sed "$1" && echo sed echo $(pwd) ${HOME} printf -eu -eu then echo cd
+		echo done /usr/bin test "$1"
+	"$@" ${HOME} ${HOME} export then ${HOME} local awk echo echo 'quoted text'
+		| done | export done "$1" && test 'quoted text' test export then sed ${HOME}
+	$(pwd) | 2>/dev/null readonly echo /usr/bin x=1 2>/dev/null -eu printf
+		test then echo test ${HOME} --verbose local then cd test local readonly readonly
+		awk readonly "$@" sed 2>/dev/null
+echo ${HOME} grep then --verbose /usr/bin printf export 'quoted text'
+		/usr/bin ${HOME} done "$1" grep -eu done export
+${HOME} local printf 'quoted text' readonly printf ${HOME} echo --verbose
+	test x=1 | 2>/dev/null awk local local && then grep 'quoted text' -eu printf
+	awk x=1 && local sed readonly
+cd grep cd -eu x=1 "$@" && "$@" test echo awk grep done && | then sed
+	export echo | --verbose $(pwd) local done test then "$1" test grep
+		x=1 then 2>/dev/null sed --verbose done test echo
+&& cd local "$@" && && && x=1 /usr/bin "$@" x=1 /usr/bin
+		readonly test 'quoted text' export 2>/dev/null
+	$(pwd) 'quoted text' $(pwd)
+		"$@" -eu ${HOME} && local -eu done local test grep "$@" ${HOME}
+		--verbose export "$1" test /usr/bin grep printf | 'quoted text'
+		'quoted text' then test /usr/bin cd 2>/dev/null export cd $(pwd) /usr/bin $(pwd)
+/usr/bin printf test export sed "$1" 'quoted text'
+	test "$1" sed then -eu export
+		$(pwd) | && sed done && --verbose echo printf ${HOME} export
+		awk cd done /usr/bin readonly 'quoted text' then -eu echo $(pwd)
+awk export && 'quoted text' x=1 local "$1" grep ${HOME} x=1 sed awk 'quoted text'
+	"$1" x=1 && && local x=1 -eu grep ${HOME} ${HOME} echo
+		&& $(pwd) grep then | then -eu "$1" grep
+		"$@" test echo ${HOME} ${HOME} 'quoted text'
+		sed test printf 'quoted text' $(pwd) awk echo "$1" awk 'quoted text' "$1"
+	${HOME} sed $(pwd) 2>/dev/null "$1" grep
+		&& awk echo sed 'quoted text'
+	export ${HOME} -eu cd printf --verbose cd awk --verbose local
+	2>/dev/null printf echo /usr/bin awk then 2>/dev/null
+		-eu ${HOME} 2>/dev/null --verbose x=1
+	2>/dev/null -eu awk ${HOME} $(pwd)
+	"$1" awk cd /usr/bin --verbose /usr/bin $(pwd) grep then export
+--verbose 2>/dev/null local --verbose --verbose -eu -eu 2>/dev/null
+	/usr/bin cd "$@" --verbose "$1"
+then echo then && -eu /usr/bin
+"$1" awk 'quoted text' cd grep awk test done readonly grep sed && $(pwd)
+		${HOME} export /usr/bin && readonly
+	2>/dev/null "$1" "$@" /usr/bin
+		printf 2>/dev/null echo
+		done /usr/bin printf printf local cd test test 'quoted text' done sed
+'quoted text' /usr/bin test | test export done --verbose x=1 local -eu ${HOME}
+printf export -eu "$@" test
+"$1" -eu "$1" 'quoted text' ${HOME} | export | test grep
+	readonly "$1" local --verbose awk "$1" printf 2>/dev/null
+		x=1 ${HOME} $(pwd) test then "$@" done sed printf test 'quoted text'
+export grep "$@" cd test echo --verbose local
+--verbose readonly "$1" then 2>/dev/null
+		then 'quoted text' export echo /usr/bin grep --verbose export && grep
+		x=1 'quoted text' 'quoted text' ${HOME} 2>/dev/null $(pwd) "$1" echo "$1"
+echo "$1" 'quoted text'
+	$(pwd) "$@" echo export local | done sed 'quoted text' cd --verbose
+	done | cd awk printf x=1 --verbose --verbose test 2>/dev/null x=1 |
+echo "$1" echo then "$1" cd -eu 2>/dev/null done printf printf
+| echo cd 'quoted text'
+		export | "$@" cd $(pwd) $(pwd) "$1"
+sed && grep 'quoted text' "$@" then
+		| awk $(pwd) test grep awk
+		then grep $(pwd) "$1" then sed --verbose test test x=1 readonly && sed -eu
+		awk /usr/bin readonly printf $(pwd) ${HOME} $(pwd)
+	cd then local x=1 'quoted text' x=1 "$@" grep -eu 'quoted text' ${HOME} "$1" export
+readonly /usr/bin "$1" test "$1" | 'quoted text'
+	done sed | awk -eu /usr/bin grep export printf $(pwd)
+sed 'quoted text' x=1 | export done echo local /usr/bin
+"$1" --verbose printf awk
+"$1" cd done awk 2>/dev/null
+		awk /usr/bin x=1 x=1 local
+		"$1" sed "$1" export -eu 'quoted text' grep sed $(pwd) && $(pwd) --verbose |
+	${HOME} test local sed awk 'quoted text' local x=1 | -eu readonly "$1" x=1 2>/dev/null
+-eu grep test | x=1 cd $(pwd) ${HOME} x=1 done /usr/bin export
+		echo -eu $(pwd) local -eu local /usr/bin
+	-eu && 'quoted text' 'quoted text' done grep && export
+$(pwd) --verbose -eu 'quoted text' sed echo cd test
+		"$@" echo 'quoted text' awk 2>/dev/null
+		echo /usr/bin cd awk local cd local
+	awk "$@" echo sed readonly $(pwd) export x=1
+awk echo --verbose -eu /usr/bin printf ${HOME} 'quoted text' printf
+		then --verbose "$1" x=1 --verbose echo | "$@" "$1" local then
+	test 2>/dev/null ${HOME} /usr/bin grep cd printf cd readonly printf /usr/bin
+	${HOME} "$1" readonly && /usr/bin printf --verbose 2>/dev/null && done awk readonly
+readonly "$1" export awk local /usr/bin /usr/bin done 'quoted text'
+| $(pwd) echo "$@" test 'quoted text'
+awk 2>/dev/null then 'quoted text'
+-eu done printf local --verbose export x=1 printf "$@"
+	then "$@" grep local export /usr/bin ${HOME} export cd awk grep ${HOME} readonly
+cd cd awk export printf awk awk then 'quoted text' grep then ${HOME} /usr/bin
+		printf echo awk test cd /usr/bin | | && && echo echo x=1 --verbose awk
+	-eu echo sed "$@" --verbose
+x=1 cd readonly "$@" 'quoted text'
+printf "$@" then awk readonly
+-eu -eu "$@" "$1" grep 2>/dev/null -eu 2>/dev/null printf printf 2>/dev/null 2>/dev/null
+	awk test -eu && done x=1 --verbose /usr/bin 'quoted text' && | ${HOME}
+	2>/dev/null then "$@" -eu readonly
+		'quoted text' readonly cd ${HOME} done test | echo
+	awk sed && x=1 x=1 done sed /usr/bin printf local $(pwd) local 2>/dev/null
+	local 2>/dev/null export && sed
+"$1" echo -eu 'quoted text' test | cd printf echo $(pwd) printf 2>/dev/null
+		awk grep /usr/bin sed $(pwd) -eu local test readonly
+	--verbose "$@" cd -eu "$@" | printf
+/usr/bin sed grep | printf x=1 "$1" then echo export test cd echo readonly
+		printf $(pwd) -eu cd x=1 test awk readonly
+		done cd $(pwd) awk $(pwd) printf /usr/bin --verbose sed --verbose printf
+	export readonly 'quoted text'
+	"$@" printf x=1 grep x=1 sed -eu echo 2>/dev/null /usr/bin
+		"$@" -eu 2>/dev/null --verbose grep cd awk $(pwd) local --verbose "$@"
+	$(pwd) ${HOME} --verbose done && | 'quoted text' /usr/bin x=1 "$@"
+		echo test readonly -eu 2>/dev/null
+	"$@" awk "$@" local test && export awk "$1"
+		export x=1 | local 'quoted text' 2>/dev/null --verbose printf sed printf
+"$@" x=1 then awk grep ${HOME} done cd local ${HOME}
+	done /usr/bin | test cd | then done export
+$(pwd) ${HOME} cd done ${HOME} cd awk x=1 then
+	x=1 then readonly /usr/bin cd &&
+local echo /usr/bin 2>/dev/null awk ${HOME} grep /usr/bin then "$@" local done "$@"
+then done 'quoted text' | --verbose && /usr/bin /usr/bin
+	-eu --verbose | $(pwd) --verbose /usr/bin echo x=1 sed $(pwd)
+"$1" /usr/bin x=1 readonly ${HOME}
+"$@" awk readonly cd 2>/dev/null -eu --verbose done readonly "$1" printf
+	done local echo export "$@" x=1 ${HOME} x=1
+	awk x=1 "$1" | test --verbose $(pwd) "$1" $(pwd) "$1" "$@" done "$@" echo sed then
+then cd ${HOME} $(pwd) --verbose
+readonly /usr/bin ${HOME} export x=1 && test "$@" "$1" | 2>/dev/null
+then local readonly --verbose
+		2>/dev/null cd && sed "$@" $(pwd) export test $(pwd) local --verbose
+		local 'quoted text' x=1 printf 2>/dev/null -eu sed awk "$1"
+		test export "$1" cd $(pwd) 2>/dev/null echo done local "$@" local cd | /usr/bin
+x=1 sed export then ${HOME} x=1 "$1" x=1 grep -eu
+		cd done --verbose awk grep "$@"
+		--verbose local cd readonly -eu 2>/dev/null ${HOME}
+2>/dev/null sed -eu "$@" 'quoted text' local then 2>/dev/null printf
+		"$@" x=1 readonly && 'quoted text'
+	cd grep --verbose 2>/dev/null && sed | done then local /usr/bin
+export --verbose then sed | 'quoted text'
+	then && awk printf --verbose x=1 grep -eu then done local done /usr/bin
+$(pwd) "$@" printf grep --verbose
+	local done 'quoted text' /usr/bin 2>/dev/null grep done /usr/bin readonly
+		then "$1" "$@" $(pwd) grep
+	--verbose 2>/dev/null | test sed "$1" "$@" cd test | --verbose
+'quoted text' test readonly "$@" x=1 grep sed readonly test ${HOME} readonly
+	'quoted text' readonly done && printf cd echo x=1 local "$@" grep
+	local $(pwd) done 2>/dev/null /usr/bin 'quoted text' --verbose
+		-eu done done /usr/bin printf done "$1" | readonly readonly
+echo 'quoted text' | grep cd | done 2>/dev/null
+		| awk awk test sed printf awk 2>/dev/null export
+		then $(pwd) "$1" $(pwd) local sed done cd
+		grep done 'quoted text' test then
+sed done | test 2>/dev/null then cd cd readonly cd /usr/bin done
+		local 'quoted text' echo 'quoted text' readonly export
+--verbose /usr/bin /usr/bin grep x=1 --verbose | readonly /usr/bin "$@"
+"$@" --verbose $(pwd) readonly readonly
+		grep "$1" grep && x=1 /usr/bin 2>/dev/null
+		grep test "$1" -eu local test local cd printf 2>/dev/null grep --verbose
+		"$@" echo printf grep $(pwd) 'quoted text' grep local
+local 'quoted text' && readonly /usr/bin then cd && then
+		cd 'quoted text' $(pwd) local $(pwd) 'quoted text' export
+export awk echo export --verbose x=1 then export cd awk 'quoted text' 'quoted text'
+	2>/dev/null sed x=1 printf /usr/bin 2>/dev/null && /usr/bin ${HOME}
+	x=1 /usr/bin /usr/bin export then then cd grep && test test cd then readonly
+	| awk "$1" readonly ${HOME} test readonly
+		sed echo x=1 sed done 2>/dev/null sed x=1 test $(pwd)
+	${HOME} $(pwd) /usr/bin done then ${HOME} printf
+		'quoted text' test local
+		grep printf $(pwd) local -eu "$1"
+	${HOME} test /usr/bin awk ${HOME}
+x=1 x=1 done done test ${HOME} | export 2>/dev/null test
+	| $(pwd) "$@" ${HOME} /usr/bin $(pwd) echo x=1 echo export test done $(pwd)
+		echo grep 2>/dev/null "$1" && printf && cd /usr/bin done ${HOME} then
+	awk 'quoted text' cd awk ${HOME} sed printf then "$@" $(pwd) printf
+grep printf then -eu echo done
+	export test local && ${HOME} test readonly
+${HOME} echo "$1" printf ${HOME} cd x=1 && --verbose 'quoted text'
+		local local done 2>/dev/null echo grep export "$@" sed
+		readonly ${HOME} readonly "$1" 2>/dev/null then readonly export
+		"$1" ${HOME} 'quoted text' "$1" echo 2>/dev/null
+		&& "$@" ${HOME} printf cd /usr/bin
+export sed test cd "$1" -eu local x=1 then echo
+printf cd 'quoted text' echo /usr/bin x=1 local --verbose 'quoted text'
+		$(pwd) 'quoted text' 2>/dev/null "$1" test then
+	2>/dev/null 'quoted text' done "$@" 'quoted text'
+	-eu ${HOME} --verbose export | $(pwd) test
+	${HOME} done && then ${HOME}
+awk awk --verbose --verbose grep && "$@" ${HOME} | /usr/bin
+	cd export grep && 'quoted text' export readonly readonly |
+'quoted text' grep -eu echo awk /usr/bin local
+	test done x=1 readonly cd ${HOME} sed "$1"
+	x=1 2>/dev/null ${HOME} export "$@" then 'quoted text' export local grep
+echo export awk awk grep && ${HOME}
+		printf $(pwd) awk sed grep export readonly 2>/dev/null echo x=1 cd -eu test
+| local "$1" readonly x=1
+	-eu "$1" readonly 'quoted text' -eu 2>/dev/null done "$1" grep
+		--verbose --verbose awk "$@" echo
+grep ${HOME} printf grep grep && then local echo "$1" cd
+local awk sed done | cd grep ${HOME} done "$@"
+	2>/dev/null && test awk sed done then x=1 export
+cd 2>/dev/null $(pwd) sed 2>/dev/null then printf -eu
+	cd export /usr/bin && ${HOME}
+	--verbose readonly $(pwd) then then "$1" 2>/dev/null
+	export grep test "$@" x=1 grep echo "$1" "$1" 2>/dev/null
+	printf then "$@" ${HOME} test $(pwd)
+-eu 2>/dev/null "$@" "$@" --verbose
+		grep "$1" local test echo readonly "$1" ${HOME}
+'quoted text' then 'quoted text'
+2>/dev/null local x=1 local "$1" echo grep
+echo 'quoted text' then
+		readonly 2>/dev/null "$@" sed | cd x=1 /usr/bin test -eu awk
+	test awk && 2>/dev/null && x=1 "$1" grep cd x=1 $(pwd)
+		x=1 sed grep "$1" ${HOME} echo | test done readonly then --verbose
+		then cd ${HOME} "$@" "$1" 2>/dev/null 2>/dev/null test
+	grep sed then 2>/dev/null ${HOME}
+	cd then -eu done --verbose echo
+		&& "$1" $(pwd) then then awk test 'quoted text'
+		2>/dev/null printf 'quoted text'
+		/usr/bin --verbose && "$@" echo local --verbose ${HOME} | cd local
+-eu test awk "$1" "$@" sed x=1
+| cd && x=1 ${HOME} | 'quoted text' local export ${HOME} sed && /usr/bin
+	x=1 awk awk ${HOME} /usr/bin echo local grep
+export 'quoted text' | sed awk sed 2>/dev/null "$@"
+		"$1" readonly echo awk --verbose test && local done export
+		/usr/bin then ${HOME} "$1"
+	sed | 'quoted text' then sed 'quoted text' export
+test test then export grep grep echo 'quoted text' done -eu sed "$1" &&
+	-eu 2>/dev/null awk cd x=1 && "$@" then -eu test --verbose
+$(pwd) 2>/dev/null then echo
+		readonly --verbose echo "$1" readonly grep local "$1" local $(pwd)
+		export awk 'quoted text' 'quoted text' export printf -eu 2>/dev/null local /usr/bin
+		echo grep test 2>/dev/null test -eu && 'quoted text' && ${HOME}
+	x=1 -eu 'quoted text' local && ${HOME} printf
+		-eu done --verbose awk --verbose && $(pwd) --verbose done sed && local
+		done "$@" test local grep sed awk && "$1" sed
+"$1" echo test -eu 'quoted text' local /usr/bin printf
+	test grep printf ${HOME} x=1 'quoted text'
+sed -eu x=1 $(pwd) test
+		local echo "$1" 2>/dev/null 2>/dev/null ${HOME}
+		"$@" x=1 grep echo sed
+		readonly $(pwd) local echo x=1
+		--verbose printf echo local && done grep sed export
+	${HOME} export 2>/dev/null grep grep ${HOME} done /usr/bin 2>/dev/null
+		echo printf x=1 -eu /usr/bin -eu cd printf sed && awk done && awk grep
+	-eu x=1 x=1 "$1" 2>/dev/null "$1" "$@" echo export awk readonly done
+		local local "$1" "$@" test then test /usr/bin
+	| && x=1 done $(pwd) printf
+	local -eu /usr/bin -eu x=1 ${HOME} "$1"
+	cd && && x=1 then printf readonly printf && x=1 cd test awk
+		| awk readonly echo "$@" printf export
+--verbose --verbose "$@" done 'quoted text' done 2>/dev/null local && sed "$1"
+		'quoted text' && ${HOME} printf awk cd grep readonly awk ${HOME} /usr/bin 2>/dev/null
+readonly grep 2>/dev/null "$1" then cd printf && echo cd
+		local && export | $(pwd) --verbose done sed printf && /usr/bin
+	local readonly ${HOME} sed "$1" sed && "$1" && x=1 local cd
+	-eu "$@" -eu readonly "$@" /usr/bin
+	2>/dev/null readonly then ${HOME} test then test /usr/bin
+"$1" /usr/bin test readonly done /usr/bin x=1 cd cd
+	&& grep export local awk x=1 export done echo | test cd --verbose /usr/bin
+	cd readonly cd ${HOME} 2>/dev/null
+		export echo --verbose test 'quoted text' $(pwd) /usr/bin /usr/bin
+/usr/bin then /usr/bin | export
+		echo awk | --verbose | x=1
+--verbose readonly | 'quoted text' -eu -eu 'quoted text' grep
+	grep && x=1 'quoted text' /usr/bin "$1" /usr/bin && printf export 'quoted text'
+	sed 2>/dev/null echo printf echo
+x=1 x=1 ${HOME} sed done done
+		$(pwd) "$@" -eu --verbose sed
+		-eu && printf echo $(pwd) --verbose local
+	x=1 grep 'quoted text' 'quoted text' export then 2>/dev/null export
+	awk "$1" local cd /usr/bin sed done
+	sed printf echo cd ${HOME} export --verbose "$1" --verbose $(pwd) $(pwd) done
+		done ${HOME} --verbose done
+		readonly && && export /usr/bin readonly sed
+${HOME} /usr/bin readonly echo "$@" grep export printf 2>/dev/null "$@" 2>/dev/null
+		'quoted text' $(pwd) done x=1 cd echo then $(pwd) echo | test 'quoted text'
+"$@" | local $(pwd) 'quoted text' &&
+		x=1 | && | x=1 done | --verbose $(pwd) local export
+		export "$@" local "$@" /usr/bin done test |
+cd "$@" awk done test grep
+		-eu | done -eu --verbose sed 'quoted text' readonly "$@" echo
+		'quoted text' then | | then readonly
+	export $(pwd) "$@" 2>/dev/null readonly ${HOME} "$1" /usr/bin grep
+		2>/dev/null /usr/bin
+2>/dev/null "$@" /usr/bin x=1 export awk
+/usr/bin "$@" 2>/dev/null
+sed then printf echo test 'quoted text'
+	"$1" 'quoted text' done grep ${HOME} readonly && 2>/dev/null sed &&
+	"$1" readonly echo --verbose && && "$@"
+	/usr/bin readonly x=1 grep then printf sed | readonly
+		printf printf $(pwd) grep $(pwd) grep
+		&& x=1 readonly | "$1" test
+	test cd | awk x=1 printf ${HOME}
+readonly 2>/dev/null -eu then export ${HOME} then echo $(pwd) | grep
+		readonly /usr/bin printf grep && echo "$@" 2>/dev/null printf done
+		"$@" 'quoted text' | awk grep /usr/bin readonly 2>/dev/null
+	echo -eu 'quoted text' local grep "$@" local printf test "$@" 2>/dev/null
+x=1 "$@" $(pwd) then local awk then done 2>/dev/null
+test printf 2>/dev/null 'quoted text' -eu then /usr/bin /usr/bin then ${HOME}
+		readonly sed cd --verbose -eu done local cd sed
+		$(pwd) && grep 2>/dev/null
+		awk | ${HOME} ${HOME} sed awk "$@"
+	grep --verbose | cd local cd test --verbose | awk |
+	export local export -eu printf ${HOME} sed "$@" readonly --verbose x=1 $(pwd)
+	export test --verbose export "$@" "$@" /usr/bin awk printf done
+		cd 2>/dev/null done echo | -eu local readonly then 'quoted text' -eu "$@"
+		--verbose then local "$@" "$1" /usr/bin "$@"
+${HOME} ${HOME} 'quoted text' echo readonly printf echo x=1
+echo | awk 'quoted text' $(pwd) printf x=1 test awk
+		then echo --verbose sed /usr/bin awk
+		awk 'quoted text' $(pwd)
+	sed && /usr/bin export 'quoted text' echo && 'quoted text' $(pwd) then
+"$@" printf export sed then $(pwd) 2>/dev/null
+		x=1 | | ${HOME} ${HOME} test 'quoted text' "$1" test --verbose cd $(pwd)
+	'quoted text' x=1 local sed awk -eu
+	/usr/bin local 2>/dev/null grep readonly /usr/bin printf /usr/bin test "$1"
+readonly 2>/dev/null sed 'quoted text' export test grep 2>/dev/null
+#include c138.sh
+		test sed grep cd x=1 done 2>/dev/null && echo export && $(pwd) "$@" export
+	grep /usr/bin && ${HOME} --verbose then then | done --verbose 'quoted text' awk
+-eu local sed printf 2>/dev/null /usr/bin sed test
+export | local test export readonly local
+		awk ${HOME} -eu echo then ${HOME} && export "$1" grep
+cd | /usr/bin x=1 "$1" -eu done local export "$@"
+		done && done test awk echo && test readonly test --verbose $(pwd)
+awk $(pwd) 'quoted text' $(pwd) | sed /usr/bin $(pwd) readonly sed echo $(pwd)
+		awk ${HOME} "$1" | -eu ${HOME} ${HOME} test done $(pwd) 'quoted text'
+		"$1" 2>/dev/null sed 2>/dev/null
+	--verbose printf readonly cd then echo awk local x=1 | &&
+-eu | then "$@" sed $(pwd) /usr/bin -eu local --verbose
+		'quoted text' echo 2>/dev/null -eu printf -eu --verbose
+		sed sed printf x=1 ${HOME} done cd -eu printf local x=1 printf
+&& "$@" | readonly | /usr/bin test 2>/dev/null export 2>/dev/null
+	2>/dev/null | then awk done "$1" done 2>/dev/null
+		"$@" "$1" done 2>/dev/null "$1" test 2>/dev/null
+		--verbose --verbose awk "$@" local done && cd export cd --verbose sed 2>/dev/null
+		readonly /usr/bin then $(pwd) sed awk readonly x=1 test /usr/bin /usr/bin /usr/bin
+	test echo cd export printf grep
+		&& "$@" done x=1 "$@" ${HOME} --verbose x=1
+readonly $(pwd) --verbose grep $(pwd) awk && export sed awk
+		x=1 "$@" ${HOME} grep grep awk awk 'quoted text'
+		done echo ${HOME} ${HOME} readonly $(pwd) then /usr/bin export cd export
+		cd readonly "$@" x=1 then && "$1" -eu "$1" ${HOME}
+	2>/dev/null test "$1" x=1 2>/dev/null echo sed grep x=1 done then export
+	grep /usr/bin echo echo readonly cd echo | && -eu && x=1 && x=1
+then ${HOME} /usr/bin -eu local ${HOME} printf
+grep cd local sed sed test "$@" | test test /usr/bin
+		grep && cd /usr/bin done awk echo "$1"
+		done ${HOME} cd cd test printf printf -eu x=1 --verbose x=1
+		'quoted text' --verbose sed export grep export "$@" "$@" -eu sed test
+	sed 'quoted text' "$1" -eu done cd
+		awk cd awk && grep printf /usr/bin --verbose readonly ${HOME} | "$@" | --verbose
+then /usr/bin done awk test 'quoted text' readonly --verbose --verbose
+	grep ${HOME} then ${HOME} --verbose ${HOME}
+		cd then $(pwd) sed export && | then then awk done $(pwd) "$@" -eu awk test done
+	/usr/bin grep /usr/bin export grep
+readonly /usr/bin $(pwd) awk then test grep |
+		--verbose cd "$1" export
+export /usr/bin export | ${HOME} --verbose
+cd 2>/dev/null then x=1 awk
+export export test $(pwd) --verbose /usr/bin -eu awk
+/usr/bin x=1 echo test $(pwd) -eu awk | 'quoted text'
+&& --verbose awk done $(pwd) done "$@" awk -eu --verbose && cd ${HOME}
+		-eu then "$@" readonly ${HOME} -eu --verbose readonly 2>/dev/null then awk
+	cd sed 2>/dev/null readonly
+		/usr/bin | && && readonly && printf awk "$@" awk printf | 'quoted text'
+		local -eu 2>/dev/null 2>/dev/null cd done readonly printf printf "$1" sed
+		x=1 $(pwd) x=1 done test && -eu "$1" grep
+done then awk cd local "$@" test -eu readonly x=1 export echo awk cd /usr/bin
+		2>/dev/null printf done -eu $(pwd) 'quoted text' printf "$@" "$1" printf
+-eu cd export printf "$@" echo local ${HOME} sed
+	awk $(pwd) && --verbose -eu cd ${HOME} /usr/bin
+		local ${HOME} done test 'quoted text' $(pwd) grep
+		"$1" -eu "$@" /usr/bin done export
+	sed export -eu --verbose 'quoted text' x=1 done local | "$@" && done local 'quoted text'
+		echo "$@" --verbose test printf local awk done readonly grep
+		$(pwd) test "$@" done
+		/usr/bin readonly grep export done local local export echo
+		grep ${HOME} then --verbose --verbose "$1" readonly local
+		'quoted text' awk readonly printf printf x=1 2>/dev/null 'quoted text'
+		printf readonly "$1" sed cd
+${HOME} test "$1" done awk 'quoted text'
+		printf grep x=1 awk then /usr/bin cd 2>/dev/null |
+		local awk "$1" printf local ${HOME} ${HOME} ${HOME} "$1" | readonly
+	${HOME} readonly 'quoted text' /usr/bin --verbose x=1 x=1 cd -eu export 'quoted text'
+		/usr/bin test awk --verbose printf --verbose
+		cd 2>/dev/null awk ${HOME} echo
+		&& x=1 then local printf awk export x=1 test && -eu x=1 |
+		cd printf && 2>/dev/null grep printf "$1" /usr/bin
+		then -eu && printf /usr/bin then /usr/bin grep ${HOME} /usr/bin
+	--verbose export cd then
+		x=1 $(pwd) printf 2>/dev/null /usr/bin 'quoted text' test $(pwd) sed ${HOME} 'quoted text'
+	"$@" ${HOME} 2>/dev/null x=1 $(pwd) printf 'quoted text' awk 'quoted text'
+	sed test awk cd ${HOME} done cd 'quoted text' x=1 test local
+	awk awk $(pwd) 2>/dev/null ${HOME} sed then
+	"$@" grep 'quoted text' grep awk local /usr/bin -eu readonly cd "$@" /usr/bin -eu
+		test 2>/dev/null && ${HOME} -eu then 2>/dev/null -eu ${HOME} x=1 cd export printf
+$(pwd) /usr/bin --verbose
+	done awk 2>/dev/null grep local ${HOME}
+readonly awk "$1" "$@" echo echo test test cd /usr/bin
+	local 'quoted text' readonly sed --verbose | awk cd "$1" test /usr/bin
+	readonly x=1 sed echo export 2>/dev/null echo awk printf 2>/dev/null readonly
+export 2>/dev/null readonly echo $(pwd) readonly $(pwd) printf
+export ${HOME} grep -eu -eu x=1 export test $(pwd) then done
+echo readonly echo x=1 export 2>/dev/null cd cd && local done cd /usr/bin printf
+		| local sed sed | --verbose local local awk test x=1 x=1 sed awk echo cd sed
+--verbose printf "$1" awk local
+		export test grep "$1" sed 2>/dev/null local test "$1" ${HOME} test
+grep awk export --verbose grep --verbose
+		'quoted text' readonly $(pwd) "$1" awk readonly -eu
+		awk /usr/bin | then readonly
+		cd printf grep 'quoted text' test local
+		"$1" sed -eu echo && --verbose
+	grep printf then /usr/bin cd 'quoted text' | awk then
+		x=1 --verbose cd "$@" printf sed $(pwd) grep
+		${HOME} readonly readonly 'quoted text' printf --verbose
+	x=1 /usr/bin grep awk x=1 then
+	"$1" -eu 2>/dev/null "$@" cd /usr/bin
+	test readonly readonly | test "$1" test cd test $(pwd) 'quoted text'
+local && x=1 test "$@" done "$1" test /usr/bin "$1" local readonly awk
+		/usr/bin test local done | printf awk 2>/dev/null
+	$(pwd) readonly $(pwd) printf
+	$(pwd) awk x=1 echo | awk
+'quoted text' $(pwd) |
+'quoted text' $(pwd) sed
+		2>/dev/null export x=1 readonly readonly local cd readonly | local
+		done test then /usr/bin
+	${HOME} $(pwd) echo grep echo local /usr/bin x=1 export $(pwd) | awk test readonly
+		"$1" cd printf sed /usr/bin grep --verbose --verbose $(pwd) sed sed ${HOME}
+	x=1 done echo export awk done then grep "$@" "$1" grep ${HOME}
+		test 2>/dev/null readonly "$1" echo ${HOME} export sed --verbose | 2>/dev/null
+	then 2>/dev/null sed x=1 export -eu ${HOME} echo && printf 'quoted text'
+"$1" --verbose | sed cd awk "$@" test && cd && cd export grep grep
+	${HOME} -eu -eu grep grep 'quoted text' cd readonly "$1" awk ${HOME} x=1 && sed
+		| | -eu done ${HOME} awk test awk printf echo cd then
+&& 2>/dev/null cd echo --verbose /usr/bin && cd && ${HOME} echo x=1 -eu "$1" 'quoted text'
+sed ${HOME} echo grep -eu sed readonly
+		echo && 2>/dev/null -eu local sed /usr/bin -eu | x=1
+readonly grep then "$@" export sed printf ${HOME}
+	readonly 2>/dev/null readonly printf readonly
+	"$1" && /usr/bin x=1 && sed /usr/bin -eu /usr/bin
+		-eu --verbose printf test done export
+readonly printf ${HOME}
+		test awk readonly test done test -eu ${HOME}
+		x=1 awk /usr/bin echo /usr/bin -eu --verbose
+		echo && sed test awk 'quoted text' printf "$1" printf
+readonly sed awk --verbose "$1" then
+		'quoted text' export echo /usr/bin
+		"$1" export && grep "$@" sed -eu
+		cd awk 'quoted text' grep 'quoted text'
+	2>/dev/null printf export
+then then 2>/dev/null ${HOME}
+	2>/dev/null ${HOME} x=1
+x=1 'quoted text' | local 2>/dev/null -eu 2>/dev/null sed local readonly
+"$@" awk /usr/bin | then x=1 "$@" sed export
+	&& done cd echo "$1" sed 2>/dev/null "$1" "$1"
+	echo awk test echo "$1" x=1 && 'quoted text' awk sed -eu
+	then then local -eu | export x=1 local "$@" && grep export
+awk "$@" 'quoted text' printf printf local
+${HOME} printf then "$1" "$1" | -eu 'quoted text' x=1
+--verbose sed -eu "$@" && awk $(pwd) readonly /usr/bin
+export "$@" cd awk /usr/bin done export sed grep echo 2>/dev/null
+		echo -eu ${HOME} printf echo 'quoted text' printf local ${HOME} $(pwd) --verbose
+		cd echo 2>/dev/null cd x=1 local grep local --verbose
+	done done 'quoted text' /usr/bin sed done /usr/bin sed awk && x=1
+/usr/bin readonly cd awk -eu | done export
+&& /usr/bin "$1" "$1" "$1" done --verbose "$1"
+		echo done sed done "$@" $(pwd) local echo ${HOME}
+2>/dev/null "$@" done $(pwd)
+		"$1" 2>/dev/null test 2>/dev/null export --verbose
+	--verbose /usr/bin then $(pwd) done echo printf /usr/bin
+		/usr/bin /usr/bin then echo done readonly /usr/bin
+"$1" local /usr/bin export 'quoted text' grep readonly
+	$(pwd) && $(pwd) done test "$@" | grep 'quoted text' test test --verbose "$@"
+	"$@" 'quoted text' printf ${HOME} done 2>/dev/null x=1
+	echo ${HOME} done echo x=1 export ${HOME} sed -eu ${HOME} test
+readonly "$@" export sed echo local awk
+$(pwd) "$1" "$@" $(pwd) cd awk grep ${HOME} 'quoted text'
+cd | export cd export cd 2>/dev/null
+	printf local export 2>/dev/null readonly echo 'quoted text' grep 2>/dev/null
+export "$@" echo $(pwd) /usr/bin echo test $(pwd) | echo 'quoted text'
+	"$@" --verbose --verbose
+printf cd | sed local "$1" 'quoted text'
+| sed then | 'quoted text' echo export grep 'quoted text'
+	| readonly "$1" done
+		&& test /usr/bin 2>/dev/null done export local "$@" cd
+		"$@" sed awk echo --verbose && 2>/dev/null "$1"
+	x=1 | 'quoted text' sed $(pwd) printf echo local x=1 cd grep ${HOME}
+	cd readonly ${HOME} | "$@"
+&& ${HOME} "$@" "$1" printf local sed readonly export ${HOME} test /usr/bin
+		$(pwd) | test 'quoted text' echo /usr/bin test cd grep --verbose 2>/dev/null
+"$1" "$1" test local
+		"$@" then ${HOME} "$1" | readonly "$@" cd test ${HOME}
+		readonly $(pwd) then 2>/dev/null | local readonly awk then export readonly
+then grep readonly grep /usr/bin sed ${HOME}
+	local 'quoted text' x=1 | -eu
+		&& echo done 2>/dev/null /usr/bin 'quoted text' printf 2>/dev/null
+		printf local sed then "$1" "$1" x=1 2>/dev/null then | "$@" -eu awk -eu x=1 -eu
+	| echo export /usr/bin --verbose echo x=1 done /usr/bin
+printf awk test "$@" local grep 'quoted text' printf awk x=1 $(pwd)
+		echo /usr/bin --verbose printf
+	printf "$1" sed /usr/bin
+sed 'quoted text' readonly printf done echo
+	then x=1 cd "$@" x=1 awk
+		2>/dev/null then sed 2>/dev/null "$1" test /usr/bin
+		then awk sed grep readonly test
+		${HOME} -eu /usr/bin readonly done ${HOME} test grep
+| then /usr/bin printf echo test local "$@" $(pwd) sed echo test | |
+"$1" -eu export grep && 2>/dev/null && ${HOME} readonly
+	grep readonly && 2>/dev/null "$1" grep --verbose cd test ${HOME} | ${HOME}
+		x=1 then ${HOME} 'quoted text' sed 'quoted text' test ${HOME} done
+	test | "$@" | "$1" ${HOME} && | x=1 | -eu
+export x=1 done $(pwd) echo x=1 -eu 2>/dev/null /usr/bin /usr/bin &&
+	-eu then sed 'quoted text'
+		"$1" $(pwd) $(pwd) export local export 'quoted text'
+		-eu "$@" "$1" && -eu | "$1" $(pwd) sed | -eu /usr/bin awk $(pwd)
+	2>/dev/null -eu ${HOME} then --verbose 2>/dev/null export
+--verbose /usr/bin awk awk export export --verbose /usr/bin
+"$@" cd awk x=1 readonly $(pwd) -eu "$@" $(pwd) "$1"
+awk ${HOME} printf -eu local then /usr/bin -eu test local | $(pwd) sed $(pwd) 'quoted text'
+readonly echo --verbose x=1 readonly printf --verbose && 2>/dev/null
+		then /usr/bin grep $(pwd) $(pwd) 2>/dev/null && readonly && 'quoted text'
+2>/dev/null "$1" test -eu --verbose
+		'quoted text' readonly done 2>/dev/null
+	&& readonly 'quoted text' grep "$@" echo
+&& readonly grep local /usr/bin then readonly
+		local done awk "$@" sed
+		then | export /usr/bin 2>/dev/null readonly local 'quoted text'
+		cd printf $(pwd) export test
+2>/dev/null test grep export readonly 2>/dev/null -eu
+		/usr/bin "$1" done grep -eu then | done /usr/bin --verbose test && ${HOME}
+		&& -eu printf 'quoted text'
+		--verbose printf awk 'quoted text' | /usr/bin local ${HOME}
+	-eu 'quoted text' readonly "$@" 2>/dev/null then
+	-eu $(pwd) awk cd sed ${HOME} -eu && echo /usr/bin done
+		x=1 'quoted text' x=1 export cd export $(pwd) cd sed sed "$@" --verbose --verbose
+		--verbose "$1" -eu -eu cd -eu then local "$1" | awk | $(pwd) "$1" readonly
+		test grep test then echo grep readonly export test 'quoted text' |
+	printf awk --verbose 'quoted text' awk
+		then local /usr/bin "$@" local export 'quoted text' local
+	$(pwd) local local readonly export grep x=1 | "$@" $(pwd) then -eu
+	printf x=1 ${HOME} /usr/bin sed export awk done
+		grep /usr/bin x=1 x=1 "$@" "$@" 2>/dev/null --verbose printf done
+-eu readonly awk test sed x=1 /usr/bin /usr/bin done done
+	local "$@" local $(pwd) 'quoted text'
+test 'quoted text' ${HOME} done && --verbose
+/usr/bin ${HOME} cd readonly 2>/dev/null ${HOME} done
+	$(pwd) then /usr/bin printf /usr/bin local ${HOME} sed cd local
+	echo $(pwd) sed /usr/bin ${HOME} "$@" export
+	test then | $(pwd) printf grep x=1 | then
+		-eu printf grep printf /usr/bin
+		test -eu | --verbose ${HOME} "$@" sed done 2>/dev/null && x=1 cd | done $(pwd)
+	${HOME} | --verbose printf ${HOME} /usr/bin cd readonly done ${HOME} --verbose
+local && printf --verbose
+		-eu /usr/bin 2>/dev/null -eu /usr/bin grep
+-eu /usr/bin "$@" test done cd --verbose
+	"$1" cd && printf | 'quoted text' 'quoted text'
+"$@" test "$@" && readonly readonly -eu 'quoted text' export
+readonly done sed local ${HOME} done
+	done export "$1" 'quoted text' $(pwd) $(pwd)
+	'quoted text' test sed 'quoted text' readonly awk awk $(pwd)
+		export done 'quoted text' 2>/dev/null ${HOME}
+x=1 awk 'quoted text' grep printf ${HOME} | cd --verbose
+		"$1" "$@" then "$1" done test printf /usr/bin echo
+		sed --verbose awk "$1" /usr/bin x=1 printf echo export export readonly test "$@"
+	$(pwd) ${HOME} grep echo sed -eu | sed "$1" done local "$1" /usr/bin
+printf echo done sed /usr/bin echo awk --verbose export $(pwd) grep ${HOME} $(pwd)
+		grep grep cd local "$1" grep echo local readonly
+-eu sed grep done test "$@" cd ${HOME} ${HOME} awk "$@" awk 2>/dev/null | sed
+		test 2>/dev/null export && local printf awk "$1" export /usr/bin 2>/dev/null
+	export /usr/bin ${HOME} "$1" grep | local -eu
+		echo echo export && test x=1 local cd --verbose
+		sed "$@" sed ${HOME} $(pwd) then /usr/bin readonly done test /usr/bin local test
+		-eu | then ${HOME} test test "$@" ${HOME} cd echo --verbose grep --verbose
+awk "$1" export && local printf && x=1 'quoted text' local 2>/dev/null
+export grep | echo test done -eu cd then ${HOME} 'quoted text'
+	"$1" && x=1 awk x=1 sed then done ${HOME} cd done done
+done local 'quoted text' --verbose grep ${HOME} printf --verbose
+	"$@" echo then done export x=1 | local --verbose $(pwd)
+done 'quoted text' --verbose export sed --verbose done /usr/bin
+	--verbose local /usr/bin --verbose -eu echo awk echo
+		local --verbose /usr/bin -eu 'quoted text'
+cd && "$1" sed && $(pwd) printf | "$@" "$@" local readonly then
+	test | readonly 2>/dev/null -eu done "$@" printf /usr/bin awk local | then -eu
+	${HOME} $(pwd) export echo echo | then 2>/dev/null $(pwd) "$@"
+sed ${HOME} printf done echo awk x=1 awk echo $(pwd) test "$1" done then
+	local readonly /usr/bin "$1" ${HOME} grep export
+	$(pwd) cd then 'quoted text' export cd /usr/bin done --verbose
+	"$@" test then test x=1
+		/usr/bin ${HOME} export x=1 ${HOME}
+		-eu 'quoted text' --verbose 'quoted text'
+	-eu readonly x=1 x=1 test ${HOME} $(pwd) cd awk x=1 | |
+	'quoted text' $(pwd) sed -eu grep
+x=1 "$1" awk 'quoted text' --verbose 2>/dev/null local printf
+	x=1 then cd test readonly x=1 test readonly grep "$1"
+readonly sed echo $(pwd) readonly /usr/bin "$@" done && x=1 done readonly cd -eu
+		readonly cd --verbose then export 'quoted text' -eu echo 'quoted text'
+	x=1 | readonly /usr/bin
+	-eu --verbose sed /usr/bin $(pwd) --verbose grep cd local
+sed "$1" export | grep | printf export && grep then cd
+"$@" $(pwd) grep | cd cd echo
+	export && awk done test grep $(pwd)
+--verbose echo $(pwd) awk test grep cd --verbose local ${HOME} echo done ${HOME}
+	-eu cd | $(pwd) done printf cd sed export then
+x=1 awk cd awk /usr/bin 2>/dev/null -eu echo $(pwd) | --verbose
+		grep x=1 "$@" export local
+	${HOME} -eu ${HOME} printf readonly
+	cd readonly echo "$1" ${HOME}
+	--verbose /usr/bin /usr/bin test cd test /usr/bin 'quoted text' done printf
+readonly | printf awk $(pwd) $(pwd) -eu cd -eu 'quoted text' echo
+		"$1" "$1" done 'quoted text' /usr/bin ${HOME} | /usr/bin local test
+		&& | | done grep && echo 'quoted text' grep ${HOME} "$1" &&
+	awk "$@" ${HOME} local export
+"$@" echo ${HOME} awk "$@" | local && cd
+	2>/dev/null ${HOME} | test
+	"$@" done x=1 readonly | "$1"
+2>/dev/null 2>/dev/null done x=1 awk 'quoted text'
+		awk -eu -eu | sed done export readonly x=1
+	printf && sed "$@" -eu cd test | "$1" 'quoted text'
+		-eu then x=1 done echo &&
+	/usr/bin done test test grep "$1" then -eu -eu
+	| printf $(pwd) x=1 awk done && local 'quoted text' test awk ${HOME} 'quoted text'
+test | -eu 'quoted text' /usr/bin
+		"$1" --verbose "$@" ${HOME} 2>/dev/null
+local /usr/bin && readonly && export x=1 --verbose export
+	| -eu "$1" awk 2>/dev/null "$1" export export x=1 local /usr/bin printf
+	cd && -eu "$1" && && 'quoted text' done done readonly 2>/dev/null
+2>/dev/null done -eu readonly
+x=1 --verbose local 'quoted text' 'quoted text' test echo echo done
+	printf "$1" "$@" x=1 --verbose 'quoted text' $(pwd)
+		| local x=1 2>/dev/null sed local echo -eu
+		cd ${HOME} cd echo $(pwd) echo --verbose "$1" export awk awk 'quoted text'
+		cd done $(pwd) printf 'quoted text' export /usr/bin export test "$@" readonly readonly
+		grep printf done local --verbose ${HOME} echo && test grep
+		then then done x=1 /usr/bin | /usr/bin then then awk printf
+cd -eu --verbose printf grep ${HOME}
+		local done grep readonly 'quoted text' -eu "$@" done awk
+		local echo done "$@" $(pwd) sed done done | ${HOME}
+/usr/bin readonly then export /usr/bin readonly && local printf awk sed readonly
+		then | local 'quoted text' | export 'quoted text' readonly test
+$(pwd) && local "$1" printf
+	readonly local 'quoted text'
+		2>/dev/null echo 2>/dev/null && done test $(pwd) sed export then sed /usr/bin
+/usr/bin awk export export local grep done test -eu cd ${HOME} local /usr/bin
+--verbose local ${HOME} then
+	done 'quoted text' && "$1" export x=1 $(pwd) sed "$@" -eu
+		done && then test done | done $(pwd) done readonly
+	x=1 x=1 awk readonly --verbose test awk 'quoted text'
+		'quoted text' test cd export $(pwd) 'quoted text'
+'quoted text' test awk sed ${HOME} awk awk
+		printf --verbose --verbose $(pwd) 'quoted text' test
+		echo echo $(pwd) "$1" $(pwd) /usr/bin
+	x=1 then echo --verbose awk $(pwd) x=1 "$@" awk then cd -eu | --verbose
+echo echo cd export readonly $(pwd) | 2>/dev/null sed done sed local echo printf
+	2>/dev/null | "$1" test $(pwd) x=1 readonly cd x=1 | awk | && | x=1 done
+	grep grep --verbose grep
+	then "$1" /usr/bin echo test "$@" export -eu
+	--verbose "$1" $(pwd) sed /usr/bin done sed echo test then local test $(pwd)
+		echo | ${HOME} then | && | | "$@" --verbose printf awk grep | grep cd x=1 cd
+then --verbose /usr/bin --verbose --verbose local
+test then grep grep then
+	done --verbose && local "$@" x=1 /usr/bin
+	awk | then cd sed "$@" then /usr/bin $(pwd) echo | awk test test export grep done
+	test x=1 /usr/bin sed cd done | ${HOME} readonly /usr/bin export 2>/dev/null
+		"$@" --verbose local $(pwd) && "$@" "$@"
+		awk x=1 printf | "$1" --verbose
+		echo awk awk && sed x=1 $(pwd) | grep test readonly 2>/dev/null && sed
+		2>/dev/null "$1" echo --verbose
+		done then 2>/dev/null $(pwd) grep | grep 'quoted text' $(pwd)
+	local --verbose echo "$1" 2>/dev/null cd ${HOME} 2>/dev/null
+printf then export --verbose cd --verbose
+	-eu | test ${HOME} $(pwd) export grep local cd local readonly
+		grep && /usr/bin x=1 'quoted text' -eu
+test printf grep 'quoted text' "$@" $(pwd) local echo echo awk awk ${HOME} echo
+	cd printf cd local x=1
+		"$@" 2>/dev/null /usr/bin cd then /usr/bin x=1 -eu grep x=1 | done | echo "$@"
+		export grep --verbose /usr/bin --verbose ${HOME} && "$@" &&
+done grep ${HOME} cd test
+$(pwd) done ${HOME} cd export 2>/dev/null then -eu "$@"
+		'quoted text' 'quoted text' /usr/bin readonly local cd "$1" sed test
+		/usr/bin 2>/dev/null awk sed x=1 then $(pwd) then cd done x=1 "$@" sed
+	grep grep --verbose && ${HOME} awk | sed ${HOME} -eu
+grep 'quoted text' &&
+"$@" done -eu printf "$1" sed x=1 done | 2>/dev/null
+$(pwd) printf printf export
+		"$@" done readonly $(pwd) 'quoted text' export readonly printf echo
+		echo --verbose cd $(pwd) grep done local test "$1" grep /usr/bin readonly local
+		done --verbose printf && 'quoted text' /usr/bin done /usr/bin
+export export 'quoted text' 'quoted text' grep | x=1 x=1 | $(pwd)
+	x=1 "$@" && /usr/bin done $(pwd) --verbose
+	$(pwd) printf /usr/bin done | grep test export export awk readonly $(pwd) $(pwd)
+local && export --verbose
+		then "$1" 2>/dev/null readonly "$@" cd grep readonly grep then x=1
+-eu $(pwd) then cd done printf 2>/dev/null "$@" "$1"
+grep $(pwd) sed x=1 awk awk | echo $(pwd) cd "$@" export export 2>/dev/null
+	done cd grep x=1 printf --verbose readonly test 'quoted text' then "$@" cd test
+done awk then printf "$@" "$@" then sed
+		x=1 "$@" grep export $(pwd) done "$@" test local 'quoted text'
+		echo 'quoted text' export
+x=1 "$1" printf x=1 | grep $(pwd) local sed local done "$1" && sed ${HOME}
+local ${HOME} sed -eu done &&
+$(pwd) ${HOME} echo x=1 /usr/bin
+	awk test test readonly grep x=1
+	/usr/bin export awk ${HOME} 'quoted text' done done $(pwd) export then
+		--verbose 2>/dev/null then x=1 printf "$1" echo readonly | $(pwd) echo -eu -eu
+		/usr/bin /usr/bin | "$@" && --verbose -eu "$@" --verbose
+	| readonly printf && 2>/dev/null
+		local cd /usr/bin "$@" | grep -eu test echo sed | readonly test printf readonly
+"$@" | grep done cd grep $(pwd) /usr/bin then grep /usr/bin
+		grep printf && -eu test 'quoted text' 'quoted text'
+		| test printf 2>/dev/null x=1 | $(pwd) grep
+		/usr/bin grep echo cd done 2>/dev/null grep --verbose ${HOME}
+		"$1" printf awk /usr/bin 'quoted text' awk | export |
+	--verbose 2>/dev/null then local cd -eu then "$@" 'quoted text'
+	$(pwd) /usr/bin cd test ${HOME} printf readonly
+printf && sed then printf && && $(pwd) grep 'quoted text' done readonly
+		export echo echo -eu 'quoted text' printf 2>/dev/null x=1
+	'quoted text' ${HOME} export | "$@" export printf local
+then cd printf "$@" x=1 ${HOME}
+	then "$1" x=1 test local echo | && $(pwd) -eu "$@"
+	"$1" 'quoted text' -eu printf && 2>/dev/null
+	echo --verbose then cd "$@" &&
+2>/dev/null ${HOME} |
+'quoted text' /usr/bin -eu 'quoted text' test grep "$@" sed readonly then
+grep "$@" 2>/dev/null test --verbose done then grep readonly
+		/usr/bin 2>/dev/null ${HOME} ${HOME} then
+	x=1 /usr/bin then then x=1 "$@" printf "$1" done echo x=1
+readonly awk then 'quoted text'
+printf grep | $(pwd) x=1 export 'quoted text' cd grep ${HOME} cd $(pwd)
+		sed ${HOME} 'quoted text'
+	readonly done sed ${HOME} awk
+local 2>/dev/null "$@" cd done echo x=1 "$1" done "$@" --verbose ${HOME} "$@" sed
+done grep export test test 'quoted text' "$@" /usr/bin readonly "$1"
+		then cd 'quoted text' echo 'quoted text' $(pwd) ${HOME} cd /usr/bin
+		then local 'quoted text' sed awk then
+	&& "$1" local x=1 'quoted text' echo 2>/dev/null --verbose grep 'quoted text'
+		grep -eu /usr/bin export x=1 'quoted text' 2>/dev/null printf cd sed test done
+	grep && cd | "$1" 'quoted text' cd printf
+		"$@" test printf /usr/bin local -eu cd x=1 --verbose
+'quoted text' awk cd echo local $(pwd) --verbose grep
+		done test echo "$1" readonly
+test local /usr/bin echo cd -eu "$1" 2>/dev/null
+		"$1" test "$@" "$@" then 2>/dev/null
+/usr/bin ${HOME} awk 2>/dev/null cd --verbose
+| "$@" echo grep --verbose cd 2>/dev/null -eu
+$(pwd) $(pwd) local awk sed test export
+"$@" then then && --verbose -eu then "$1" echo 'quoted text'
+test sed "$@" export |
+	grep ${HOME} test sed 2>/dev/null ${HOME} &&
+'quoted text' ${HOME} /usr/bin
+		grep 'quoted text' | then --verbose $(pwd) sed printf
+	cd sed echo --verbose "$1" printf echo test ${HOME} 'quoted text'
+	awk done local awk export x=1 done readonly | "$@" x=1 x=1 2>/dev/null
+cd "$@" | awk ${HOME} grep ${HOME} sed then local awk 2>/dev/null grep 2>/dev/null
+		-eu awk then local 2>/dev/null --verbose cd awk && local awk grep /usr/bin
+	echo printf readonly 'quoted text' readonly grep test grep | /usr/bin echo
+		&& grep sed --verbose
+		awk -eu printf "$@" 'quoted text' ${HOME} export done done done "$1"
+	x=1 done readonly 'quoted text'
+		printf 2>/dev/null 2>/dev/null then x=1 | "$1" done test export then readonly
+cd test | --verbose awk "$@" "$1" "$@" | x=1 "$@" x=1 readonly
+--verbose --verbose export 2>/dev/null readonly
+		export "$1" "$1" echo ${HOME} 'quoted text'
+x=1 --verbose $(pwd) && sed cd
+export cd -eu 'quoted text' ${HOME} ${HOME} && echo "$1" $(pwd) done printf
+		2>/dev/null && -eu | --verbose
+awk "$@" echo 2>/dev/null x=1
+		-eu done $(pwd) grep 'quoted text'
+	readonly -eu x=1 "$1" awk
+awk ${HOME} done local | export --verbose local ${HOME} -eu 2>/dev/null 'quoted text'
+		${HOME} cd | local readonly done $(pwd) done "$@" local test cd done echo "$1"
+	${HOME} grep grep x=1 sed then /usr/bin
+$(pwd) grep done -eu local readonly then local /usr/bin
+	| test echo readonly awk "$1" --verbose sed printf /usr/bin 2>/dev/null
+x=1 $(pwd) x=1 grep 'quoted text'
+	/usr/bin "$@" grep 2>/dev/null awk then sed $(pwd) "$@" then "$1" /usr/bin
+		'quoted text' -eu echo done
+echo "$1" sed grep /usr/bin --verbose local
+	test 2>/dev/null /usr/bin /usr/bin readonly 'quoted text'
+then -eu "$@" $(pwd) "$@" | 2>/dev/null --verbose local cd /usr/bin "$1"
+		awk && cd test ${HOME} echo printf 'quoted text'
+	grep 'quoted text' | 'quoted text' --verbose
+	export ${HOME} awk 2>/dev/null
+--verbose ${HOME} "$@" && grep
+	then 2>/dev/null test | done 2>/dev/null 'quoted text' printf -eu
+	sed | --verbose 2>/dev/null -eu
+		grep 'quoted text' /usr/bin readonly sed printf awk test done | export
+	2>/dev/null x=1 -eu 'quoted text' grep grep && readonly && -eu local
+		cd --verbose printf 'quoted text' grep
+		done "$1" export local local --verbose ${HOME} -eu printf readonly
+	sed --verbose awk $(pwd) readonly -eu cd | local /usr/bin sed | x=1 $(pwd)
+done grep grep 2>/dev/null printf ${HOME}
+"$@" then test -eu echo readonly
+		then && cd -eu | | readonly
+	$(pwd) sed | sed ${HOME} local x=1 && sed 'quoted text' --verbose
+	--verbose cd local test
+| sed --verbose --verbose echo $(pwd) /usr/bin
+		printf 'quoted text' "$@" export test cd "$@"
+	printf local awk then
+		then local /usr/bin then -eu echo grep awk export --verbose
+		$(pwd) printf 2>/dev/null done "$1" sed 'quoted text' | "$@"
+	x=1 /usr/bin 2>/dev/null | awk awk done test --verbose export
+		grep x=1 && echo awk printf local sed $(pwd) echo printf sed "$1" 2>/dev/null
+sed cd local local 'quoted text' echo
+	--verbose x=1 sed cd |
+	sed local done cd && ${HOME} export ${HOME}
+export -eu && $(pwd) | test
+	test sed ${HOME} x=1 test sed done sed grep 'quoted text'
+	| local "$@" "$1" -eu export test && export done local done $(pwd) cd sed
+	x=1 export done done done -eu printf local | local printf readonly
+${HOME} printf ${HOME} sed test cd && grep ${HOME} export grep 2>/dev/null cd |
+done -eu x=1 'quoted text' ${HOME}
+export grep readonly test /usr/bin local
+		export cd ${HOME} 2>/dev/null test -eu then cd x=1 'quoted text'
+$(pwd) test -eu export | | && cd $(pwd) ${HOME} export
+	-eu done -eu test /usr/bin
+test done "$1" "$@" sed
+	"$@" "$1" grep /usr/bin
+--verbose $(pwd) sed $(pwd) echo then /usr/bin grep /usr/bin
+	2>/dev/null x=1 echo local echo 'quoted text' | grep
+--verbose sed echo local done grep awk --verbose then
+	${HOME} printf /usr/bin "$1" --verbose x=1 export -eu 'quoted text' -eu
+		echo awk | local echo printf then ${HOME} | "$1"
+	${HOME} grep done printf awk ${HOME} $(pwd) && sed -eu "$1" echo sed
+		${HOME} awk "$@" ${HOME} --verbose -eu "$@" "$@" ${HOME}
+	sed then echo test local awk | cd /usr/bin
+	| done local | --verbose grep x=1 awk 2>/dev/null local
+		2>/dev/null "$@" readonly
+	| grep grep -eu 'quoted text' export 2>/dev/null
+		printf ${HOME} "$1" cd export --verbose export
+	--verbose --verbose | ${HOME} 'quoted text' printf
+2>/dev/null grep local printf
+	printf | 2>/dev/null | test
+		readonly then then then awk /usr/bin --verbose
+	/usr/bin test ${HOME} | --verbose
+	readonly --verbose export readonly export readonly grep sed /usr/bin export
+	2>/dev/null export && readonly export printf
+'quoted text' readonly | $(pwd) sed "$@" test 2>/dev/null test
+then | local awk x=1 export -eu | $(pwd) x=1 cd sed 2>/dev/null |
+		x=1 export printf sed readonly sed cd 2>/dev/null
+		${HOME} && then awk -eu $(pwd)
+local awk done $(pwd) && 'quoted text' local
+		-eu 'quoted text' x=1 cd printf awk local 'quoted text'
+		&& done echo test test ${HOME} --verbose
+		cd x=1 /usr/bin $(pwd) $(pwd) awk cd export readonly echo grep /usr/bin
+	local test "$1" 'quoted text' "$@" local
+		echo 'quoted text' $(pwd)
+		echo | local test x=1 "$@" local echo cd awk /usr/bin
+	printf export x=1 | "$1" 2>/dev/null printf /usr/bin awk 2>/dev/null
+		local cd then printf 'quoted text' readonly 2>/dev/null sed 'quoted text' echo
+"$@" "$1" readonly "$1" --verbose test awk cd && "$@" export /usr/bin $(pwd) 2>/dev/null
+-eu export --verbose 2>/dev/null test
+		2>/dev/null && -eu /usr/bin test echo printf printf -eu
+		test ${HOME} && cd "$1" done
+		"$1" "$1" x=1 "$@" 'quoted text' ${HOME} done
+printf printf printf $(pwd) "$@" readonly
+	$(pwd) x=1 grep -eu printf grep then cd then readonly
+2>/dev/null test x=1 awk --verbose then export $(pwd)
+		echo $(pwd) -eu /usr/bin printf cd -eu && done printf readonly export test export
+	/usr/bin x=1 | done done cd done ${HOME} test -eu then 2>/dev/null | test
+	test readonly "$1" 2>/dev/null "$1" export readonly
+	test | | cd | echo then sed then x=1 local cd
+		/usr/bin && test then test cd awk
+local --verbose test $(pwd) export x=1 /usr/bin readonly 2>/dev/null x=1
+sed --verbose | readonly cd /usr/bin 2>/dev/null x=1 test -eu | echo
+readonly grep && ${HOME} cd /usr/bin done 2>/dev/null
+/usr/bin -eu test && export 2>/dev/null /usr/bin -eu ${HOME} export export
+		| && printf test "$1" --verbose 2>/dev/null
+--verbose | && test awk -eu printf readonly | x=1
+	local 'quoted text' then -eu then 'quoted text' 'quoted text' local
+		test ${HOME} 2>/dev/null
+readonly $(pwd) grep test "$1" $(pwd) export --verbose
+${HOME} readonly ${HOME} $(pwd) $(pwd) &&
+	'quoted text' 'quoted text' grep grep local grep echo export test
+	done ${HOME} done sed then cd /usr/bin --verbose export "$@" /usr/bin $(pwd) $(pwd)
+local "$@" 2>/dev/null local awk /usr/bin local ${HOME} done cd && $(pwd)
+	done "$1" $(pwd) $(pwd) printf done sed ${HOME} && && /usr/bin x=1 x=1
+	"$1" echo cd ${HOME} then printf printf /usr/bin -eu
+${HOME} ${HOME} /usr/bin $(pwd) grep
+	2>/dev/null && -eu -eu cd /usr/bin
+| sed | 'quoted text' | x=1 | awk && export /usr/bin local test /usr/bin &&
+	'quoted text' echo echo 2>/dev/null --verbose | done local "$1"
+test --verbose echo "$1" $(pwd) done export -eu
+${HOME} grep && "$1" export awk && "$1" sed local --verbose ${HOME} -eu "$1" "$1"
+		$(pwd) "$1" done test grep "$1" ${HOME} sed local $(pwd) export 'quoted text'
+		cd && --verbose 2>/dev/null ${HOME} && "$1" awk grep
+		printf -eu echo -eu --verbose printf readonly $(pwd) cd printf
+	| | readonly done export && grep readonly sed
+	x=1 $(pwd) /usr/bin printf
+		2>/dev/null then "$1" done $(pwd) sed sed awk "$1" "$@" test |
+	export --verbose | 'quoted text'
+cd -eu test x=1 done awk done
+		then sed test -eu /usr/bin --verbose
+	"$1" && "$1" then /usr/bin local "$1" then ${HOME}
+export readonly export printf local ${HOME} $(pwd) | -eu
+&& $(pwd) "$1" done "$1" readonly 'quoted text' 'quoted text'
+x=1 sed export done test 2>/dev/null $(pwd) local --verbose "$@" readonly
+| /usr/bin "$1" grep
+		printf && echo awk ${HOME} --verbose test --verbose
+&& /usr/bin cd | x=1 printf ${HOME} 'quoted text'
+	export 2>/dev/null sed then
+printf export && x=1 "$1" $(pwd) && export /usr/bin done export
+		$(pwd) --verbose ${HOME} readonly --verbose "$1" test 2>/dev/null
+		test awk grep 'quoted text' sed
+		/usr/bin then echo export test done /usr/bin ${HOME} "$@" /usr/bin -eu
+	2>/dev/null 2>/dev/null "$@"
+export readonly then export
+		readonly && local done echo readonly && && -eu -eu local echo grep /usr/bin sed
+		&& ${HOME} grep "$@" local
+	done cd printf test done echo | test "$@" 2>/dev/null echo local
+"$1" done /usr/bin --verbose -eu printf local
+-eu --verbose done "$@" sed cd ${HOME} sed x=1
+		'quoted text' ${HOME} ${HOME} 'quoted text' cd x=1 grep x=1 echo local echo
+		'quoted text' grep && -eu 'quoted text' test printf sed cd export export local
+		local 2>/dev/null "$@" "$@" readonly done --verbose "$1" awk --verbose
+	readonly && && done export grep "$@" sed local cd export
+	$(pwd) local printf 'quoted text' echo 2>/dev/null done -eu /usr/bin awk x=1 /usr/bin
+		grep --verbose --verbose | sed | --verbose test && then grep
+		$(pwd) 'quoted text' $(pwd)
+x=1 2>/dev/null -eu 'quoted text'
+		grep | ${HOME} then grep echo /usr/bin &&
+"$@" test "$@" done test "$@" done "$@" -eu awk --verbose grep done --verbose
+	printf cd then /usr/bin awk
+-eu done /usr/bin --verbose done && cd
+export echo "$@" --verbose sed "$@" local printf echo
+		/usr/bin 2>/dev/null export export -eu done printf local local export
+	echo $(pwd) test done "$@" /usr/bin && "$@" then
+	--verbose "$1" done sed | grep cd
+	test $(pwd) x=1 ${HOME} done done /usr/bin readonly x=1 readonly awk ${HOME}
+		printf "$1" echo printf 'quoted text' local done | awk "$@" 'quoted text' grep
+		x=1 awk -eu /usr/bin sed export ${HOME} export test
+	-eu sed $(pwd) 2>/dev/null | printf 'quoted text' export
+	local ${HOME} "$1" test printf cd awk 'quoted text' 'quoted text'
+		$(pwd) 'quoted text' | x=1 -eu "$1" test x=1 "$@" echo /usr/bin 2>/dev/null then
+		--verbose awk 2>/dev/null cd
+printf "$1" done echo | 2>/dev/null "$@" sed -eu sed /usr/bin "$1"
+cd local echo && printf -eu x=1 | grep awk then ${HOME}
+	awk awk done | printf -eu $(pwd) test cd 'quoted text'
+	| | local printf printf
+		&& 2>/dev/null | awk 'quoted text' 2>/dev/null printf sed | printf /usr/bin printf
+grep local done 'quoted text' 2>/dev/null
+		$(pwd) 2>/dev/null readonly grep readonly
+	echo cd done cd local export grep readonly | readonly local printf
+/usr/bin printf sed 'quoted text' printf ${HOME}
+		printf grep --verbose done printf readonly grep -eu then 'quoted text'
+	--verbose | $(pwd) sed
+		/usr/bin "$@" 'quoted text' export "$1" | done /usr/bin -eu local test local printf
+grep $(pwd) x=1 export awk local --verbose "$1" -eu
+then done cd -eu then /usr/bin -eu done then test export cd -eu
+	awk sed 2>/dev/null "$@" grep readonly $(pwd) -eu sed echo && grep echo -eu printf
+	x=1 export echo -eu "$@" && test -eu 2>/dev/null awk "$@"
+		awk then /usr/bin awk 'quoted text' local $(pwd) && --verbose test echo cd awk
+	-eu test local grep then | printf && printf awk && && "$@" /usr/bin export
+	echo --verbose then done local --verbose awk &&
+test ${HOME} x=1 printf test ${HOME} sed $(pwd) printf ${HOME} printf printf
+/usr/bin $(pwd) $(pwd) --verbose then ${HOME} test readonly printf sed awk
+-eu ${HOME} test --verbose /usr/bin readonly
+&& $(pwd) local -eu --verbose --verbose "$1" local x=1 printf export
+$(pwd) grep | echo ${HOME} x=1 | --verbose local awk ${HOME} echo local
+$(pwd) ${HOME} "$@" echo "$1" local cd local /usr/bin test cd ${HOME} --verbose
+	printf awk | done && done grep 'quoted text' then $(pwd) 2>/dev/null
+		-eu local echo echo sed cd cd -eu printf $(pwd) && readonly 'quoted text' /usr/bin
+		awk x=1 --verbose readonly $(pwd) /usr/bin cd 2>/dev/null "$1" test
+	/usr/bin -eu /usr/bin $(pwd) cd test export
+	then x=1 printf then -eu -eu "$@" cd /usr/bin printf
+		awk $(pwd) | readonly | 2>/dev/null -eu sed /usr/bin 'quoted text' cd grep $(pwd)
+		x=1 echo readonly --verbose 'quoted text' 2>/dev/null
+	x=1 grep /usr/bin "$1" | "$1" "$1" readonly --verbose "$@" sed --verbose
+	x=1 sed local local then echo --verbose then test printf x=1 printf
+done grep export ${HOME} done "$1" 'quoted text' --verbose local 'quoted text'
+		2>/dev/null echo cd 'quoted text' printf 'quoted text' then export
+		test -eu $(pwd) done grep x=1
+"$@" readonly && awk && ${HOME}
+-eu /usr/bin 'quoted text' then x=1 $(pwd) cd ${HOME} grep
+		-eu x=1 grep export local $(pwd) local $(pwd) then /usr/bin
+		done awk test ${HOME} cd "$1" awk | $(pwd) && local "$@" cd && 'quoted text'
+done sed grep grep done "$@" -eu echo | 2>/dev/null 2>/dev/null "$1" $(pwd)
+		'quoted text' -eu sed -eu test
+done done done printf readonly local
+		"$1" cd echo ${HOME} sed && printf "$@" x=1 export awk cd done
+readonly 'quoted text' export "$@" -eu awk 2>/dev/null echo printf
+	then x=1 "$1" printf "$1" x=1 export | 2>/dev/null 2>/dev/null
+	done "$1" cd done grep --verbose done --verbose &&
+"$1" export local $(pwd) | 2>/dev/null then
+		x=1 x=1 done | 'quoted text' test --verbose | "$1"
+| then 2>/dev/null && -eu $(pwd) 2>/dev/null test export echo test local local
+	awk printf && printf "$1" -eu local ${HOME}
+		$(pwd) test echo x=1 cd
+"$1" export /usr/bin --verbose
+		"$1" ${HOME} cd ${HOME} echo /usr/bin -eu
+	then ${HOME} grep ${HOME} test cd
+echo "$@" printf echo readonly cd cd then
+	cd printf test $(pwd) x=1 'quoted text' awk cd | cd --verbose grep --verbose 2>/dev/null
+	x=1 grep | 2>/dev/null && grep &&
+awk printf done export test readonly then "$@" awk && x=1 --verbose
+	sed 'quoted text' -eu export
+	grep | 'quoted text' | $(pwd) then "$@" $(pwd) /usr/bin cd
+	export done --verbose sed $(pwd) ${HOME} && then test test -eu 2>/dev/null
+		$(pwd) ${HOME} echo --verbose done local grep && --verbose
+	--verbose ${HOME} $(pwd) local -eu --verbose echo readonly test
+	then cd done awk "$1" | x=1 && printf done sed ${HOME} --verbose && 2>/dev/null
+		echo | readonly | readonly ${HOME} grep $(pwd)
+	x=1 /usr/bin export local test done cd "$1" && "$1" test printf | ${HOME}
+export awk -eu done sed --verbose local done export readonly 2>/dev/null
+awk /usr/bin | "$1" /usr/bin
+		local export "$1" awk "$@" export -eu test test && cd "$1"
+	printf then readonly "$1" local | --verbose --verbose echo grep cd grep x=1
+		/usr/bin /usr/bin export export readonly
+"$@" done then then ${HOME} -eu $(pwd)
+"$@" grep cd sed echo $(pwd) export && test test /usr/bin "$@" |
+		done --verbose "$@" local
+"$1" "$@" -eu printf 'quoted text' x=1 printf $(pwd) local "$@" "$1" && --verbose
+		test echo x=1 grep "$@" echo 2>/dev/null cd --verbose
+		printf 2>/dev/null printf readonly
+	sed done test 2>/dev/null --verbose "$@" --verbose
+		local 'quoted text' --verbose /usr/bin -eu export "$1" printf 'quoted text'
+		x=1 --verbose awk local awk | echo awk | test export
+		export then cd 2>/dev/null done | export local ${HOME} awk test sed
+		sed grep readonly /usr/bin | --verbose printf
+export $(pwd) cd ${HOME} echo | /usr/bin x=1
+$(pwd) export 2>/dev/null /usr/bin /usr/bin export local sed
+&& && export then export done then printf test ${HOME} "$1" --verbose && ${HOME}
+'quoted text' $(pwd) /usr/bin local readonly $(pwd) $(pwd)
+$(pwd) 'quoted text' sed ${HOME} test x=1 export 2>/dev/null
+-eu awk test "$@" 'quoted text'
+$(pwd) $(pwd) && local export grep local printf
+$(pwd) "$1" cd "$@" printf export /usr/bin x=1 x=1 local && done grep
+		/usr/bin --verbose readonly "$1" -eu 'quoted text' | grep printf
+	$(pwd) && readonly "$1" -eu --verbose awk /usr/bin
+		/usr/bin awk readonly | echo local x=1 /usr/bin 'quoted text'
+		x=1 grep 2>/dev/null local --verbose
+	"$@" "$1" cd readonly grep "$1" readonly then grep
+		-eu echo -eu awk --verbose export cd $(pwd) | -eu cd -eu sed "$1" grep
+done sed | test /usr/bin x=1 x=1 'quoted text'
+		"$1" sed done export 2>/dev/null
+		2>/dev/null 'quoted text' && cd $(pwd) local then --verbose
+-eu && local local local
+	2>/dev/null ${HOME} $(pwd) 'quoted text' cd done && -eu cd grep 'quoted text'
+		--verbose sed | cd --verbose x=1 printf local
+		test "$1" cd printf test | 2>/dev/null | /usr/bin echo ${HOME} --verbose
+--verbose x=1 test x=1 sed --verbose --verbose $(pwd) sed ${HOME} 'quoted text'
+"$@" | x=1 2>/dev/null test
+	grep x=1 --verbose x=1 "$@" grep then -eu cd 2>/dev/null $(pwd) ${HOME}
+		x=1 $(pwd) echo 2>/dev/null
+		"$@" -eu printf test echo sed sed "$@" readonly echo
+printf 2>/dev/null -eu done export ${HOME} readonly
+x=1 sed sed local local readonly echo grep local export done && readonly
+	"$@" -eu -eu --verbose export readonly
+		"$1" printf echo printf 'quoted text' | awk x=1 "$1" test /usr/bin 2>/dev/null
+		'quoted text' x=1 -eu printf "$@" -eu "$@" "$1" local sed x=1 done "$@" export
+		2>/dev/null | --verbose done test $(pwd) cd "$@" "$@" ${HOME} --verbose $(pwd)
+printf awk grep printf local cd printf local printf export
+		${HOME} x=1 local sed local x=1 2>/dev/null $(pwd) "$@" /usr/bin awk
+		done echo readonly grep echo /usr/bin | cd readonly then x=1 x=1 --verbose export
+	-eu awk "$1" grep $(pwd) x=1 --verbose "$@" x=1 --verbose
+		&& /usr/bin 2>/dev/null grep "$1" "$@" | readonly
+		grep awk $(pwd) --verbose --verbose $(pwd) readonly
+"$@" && export local ${HOME} -eu 'quoted text' test grep 2>/dev/null
+	x=1 done -eu awk cd x=1 test grep echo "$1" export
+grep done grep 2>/dev/null grep x=1 awk test && export "$@" /usr/bin
+test awk export export echo export export x=1 grep "$1" 2>/dev/null
+		readonly /usr/bin then then then
+	'quoted text' x=1 cd "$1" --verbose cd x=1 "$1"
+		then awk then local | readonly awk
+then | --verbose local awk done export
+		then local "$1" printf printf
+		export $(pwd) ${HOME} export ${HOME} grep printf sed 'quoted text'
+	/usr/bin then 2>/dev/null && cd /usr/bin
+&& grep readonly readonly export then test awk x=1 -eu x=1 sed cd echo export
+printf done readonly done
+	test awk --verbose && 2>/dev/null
+	printf -eu sed test x=1 'quoted text' echo /usr/bin ${HOME}
+		cd && export 'quoted text' --verbose 2>/dev/null "$@" then cd readonly ${HOME}
+then sed -eu test sed echo "$@" readonly then echo
+		$(pwd) echo local grep x=1 "$@" -eu "$@" && grep
+		${HOME} cd ${HOME} /usr/bin grep ${HOME} --verbose
+x=1 /usr/bin --verbose grep echo $(pwd) "$@"
+		--verbose then local -eu sed && sed cd -eu test ${HOME} ${HOME} local && 2>/dev/null
+		readonly cd local local -eu then local ${HOME} /usr/bin done x=1 /usr/bin
+	"$1" echo 2>/dev/null awk x=1 -eu /usr/bin
+	test "$@" then "$@" "$@" export printf
+	cd then grep && export 'quoted text' awk readonly sed ${HOME}
+${HOME} --verbose 'quoted text' cd readonly
+		&& grep readonly && cd "$@" | echo export printf
+		awk cd cd 2>/dev/null /usr/bin printf "$@" |
+		2>/dev/null grep done done 'quoted text' "$@" ${HOME}
+		sed "$1" readonly -eu test --verbose sed "$@" grep grep -eu --verbose | | &&
+		echo test | readonly && | done sed grep /usr/bin --verbose grep ${HOME} "$1" echo
+	-eu $(pwd) /usr/bin 2>/dev/null
+	done done readonly "$@" "$1" awk
+readonly cd $(pwd) cd export printf local
+	sed $(pwd) ${HOME} "$@" awk && --verbose local -eu then done
+	grep awk && then /usr/bin echo local /usr/bin
+		$(pwd) /usr/bin | /usr/bin /usr/bin grep x=1 cd ${HOME} 'quoted text' "$1"
+export -eu 2>/dev/null ${HOME} echo readonly
+	awk readonly --verbose done | test -eu
+		--verbose 'quoted text' awk /usr/bin done | ${HOME} export x=1 export --verbose
+	readonly printf 'quoted text' x=1 local done /usr/bin "$1" grep
+		echo printf 'quoted text' --verbose cd echo local export cd done then
+/usr/bin 'quoted text' ${HOME} -eu $(pwd) --verbose
+readonly export "$@" local && awk done then --verbose | x=1 done
+	"$@" test readonly echo -eu "$1" done readonly 2>/dev/null
+	readonly test 2>/dev/null "$@"
+grep export cd $(pwd) test
+		x=1 export && | done $(pwd)
+		"$1" then readonly cd sed x=1
+		readonly 2>/dev/null x=1
+	"$@" "$1" "$@" 2>/dev/null $(pwd) 2>/dev/null
+		2>/dev/null 'quoted text' 2>/dev/null grep awk -eu -eu ${HOME} "$1"
+/usr/bin "$1" $(pwd) && ${HOME} awk x=1 2>/dev/null && --verbose awk
+	readonly --verbose "$1" cd /usr/bin awk readonly
+		-eu | && echo "$1" ${HOME}
+done printf -eu | 2>/dev/null ${HOME} &&
+test ${HOME} grep 'quoted text' && | done cd x=1 x=1 && local
+sed | -eu 'quoted text' done && 2>/dev/null /usr/bin 'quoted text'
+${HOME} grep 'quoted text' awk grep && local local /usr/bin -eu
+	--verbose awk | --verbose export /usr/bin grep awk x=1 'quoted text' printf $(pwd)
+	2>/dev/null /usr/bin awk done export done test
+	readonly local 2>/dev/null test /usr/bin echo 2>/dev/null 'quoted text'
+		| $(pwd) | done ${HOME} sed "$@" $(pwd) 2>/dev/null ${HOME} test done | ${HOME}
+		2>/dev/null 'quoted text' --verbose
+		2>/dev/null "$@" $(pwd) 2>/dev/null x=1 /usr/bin
+	2>/dev/null "$@" --verbose
+/usr/bin done grep x=1 2>/dev/null
+| printf awk ${HOME} "$1" echo export 'quoted text' 'quoted text' | ${HOME} echo
+	"$@" 2>/dev/null -eu 2>/dev/null --verbose cd -eu "$@" | x=1 x=1 local "$1"
+		/usr/bin "$1" "$1" "$@" echo | -eu && readonly grep
+"$@" then export 'quoted text' printf ${HOME} | 'quoted text'
+		printf local "$1" awk then echo 'quoted text' readonly grep
+	--verbose done readonly readonly /usr/bin "$1"
+		test x=1 "$1" "$1" export --verbose
+		then readonly "$1" "$@" awk 2>/dev/null $(pwd) 'quoted text' && x=1 test
+	&& 'quoted text' then x=1 2>/dev/null $(pwd)
+	-eu x=1 2>/dev/null /usr/bin --verbose ${HOME} printf
+&& grep --verbose done sed "$@" &&
+	then then ${HOME} -eu then --verbose done grep test done "$1" $(pwd) grep
+		${HOME} done ${HOME} echo /usr/bin 2>/dev/null 2>/dev/null awk ${HOME}
+&& echo && local /usr/bin -eu printf $(pwd) /usr/bin sed ${HOME} test $(pwd)
+		&& then "$@" cd done | ${HOME} --verbose 'quoted text'
+	cd | cd $(pwd) grep "$@" $(pwd) $(pwd) --verbose 'quoted text'
+cd -eu sed $(pwd) done && "$1" x=1 cd ${HOME} done
+		--verbose ${HOME} printf cd local ${HOME} printf 2>/dev/null cd ${HOME}
+	| local /usr/bin local x=1 $(pwd) readonly
+	sed ${HOME} 'quoted text' -eu 'quoted text'
+		--verbose sed -eu grep local "$@" then 'quoted text' printf done "$1" test
+	sed /usr/bin && local awk && | 2>/dev/null
+	then $(pwd) $(pwd) done 'quoted text' 'quoted text' | "$@" x=1 done $(pwd) grep
+		'quoted text' export then readonly sed then
+	"$1" "$1" $(pwd) ${HOME} echo "$1" awk ${HOME} test 'quoted text'
+	printf && printf local
+then cd --verbose | echo -eu
+		'quoted text' /usr/bin 'quoted text' | test -eu echo /usr/bin
+		"$@" $(pwd) grep -eu | -eu awk 2>/dev/null sed then awk -eu x=1
+		cd --verbose echo local 'quoted text' 2>/dev/null && $(pwd)
+	${HOME} sed ${HOME} export cd printf
+	--verbose cd grep export 'quoted text'
+	readonly awk echo ${HOME} test awk "$1" then test sed
+	awk awk readonly x=1 local 'quoted text' echo local grep then | printf
+then "$@" ${HOME} grep echo test /usr/bin --verbose printf | --verbose
+	done cd 2>/dev/null then cd sed
+	$(pwd) | /usr/bin printf x=1 "$@" echo printf | -eu cd | /usr/bin test export
+sed && echo cd done ${HOME} x=1 "$@" grep x=1 export sed -eu awk export
+		cd 'quoted text' grep ${HOME} sed readonly "$@" grep grep done /usr/bin export /usr/bin
+		readonly --verbose 2>/dev/null -eu done done test | "$1" local cd sed cd x=1
+		done awk ${HOME} awk sed
+	local -eu awk x=1 grep test sed "$1" | cd "$1"
+		cd then grep | $(pwd) readonly local ${HOME} | ${HOME} local /usr/bin
+sed export "$@" 2>/dev/null | && --verbose -eu -eu cd done
+'quoted text' readonly cd /usr/bin
+test -eu -eu sed echo grep /usr/bin awk
+"$@" then export $(pwd) then export printf awk && && cd then then
+sed local echo ${HOME} $(pwd) x=1 -eu 2>/dev/null
+		printf --verbose done local grep $(pwd) /usr/bin cd | test -eu
+		"$1" x=1 local printf done --verbose local --verbose --verbose printf
+| echo $(pwd) printf 2>/dev/null local test done 'quoted text'
+		/usr/bin sed "$1" x=1 -eu then printf --verbose "$1"
+	2>/dev/null cd ${HOME} ${HOME} -eu sed /usr/bin $(pwd) test done
+		2>/dev/null x=1 sed grep echo --verbose
+		sed readonly --verbose local then sed test && /usr/bin sed && && ${HOME}
+		x=1 export local sed readonly 2>/dev/null $(pwd) --verbose local readonly readonly
+echo export then sed | ${HOME} readonly
+	sed done test "$@" ${HOME} cd grep -eu 'quoted text'
+		awk test /usr/bin local echo export 2>/dev/null ${HOME} awk 'quoted text'
+	cd "$@" readonly 2>/dev/null
+	printf ${HOME} readonly 'quoted text'
+readonly "$1" 'quoted text' export ${HOME} /usr/bin && readonly
+		--verbose test && then test printf 'quoted text'
+	awk "$@" $(pwd) "$1" 'quoted text' 'quoted text' ${HOME} echo 2>/dev/null $(pwd)
+	printf "$1" cd sed grep sed sed printf /usr/bin done
+sed "$1" | export cd x=1 'quoted text'
+${HOME} --verbose --verbose
+		test echo then export x=1 -eu
+		x=1 'quoted text' test && export /usr/bin grep echo -eu echo "$1" echo
+grep | 2>/dev/null x=1 readonly done readonly $(pwd) test echo ${HOME}
+&& "$@" sed grep --verbose
+local ${HOME} --verbose test
+readonly test export 'quoted text' sed && cd echo ${HOME}
+	2>/dev/null sed /usr/bin "$@" cd /usr/bin grep "$@" /usr/bin then -eu done
+test "$1" grep done /usr/bin "$@" && "$1" cd done && $(pwd) local
+readonly /usr/bin x=1 local done 2>/dev/null $(pwd)
+		printf && --verbose && && readonly sed $(pwd) echo
+		sed local then --verbose
+/usr/bin x=1 $(pwd) ${HOME} export cd --verbose grep 'quoted text'
+	-eu 2>/dev/null /usr/bin export && cd cd x=1 ${HOME} then test sed ${HOME} 'quoted text'
+		-eu ${HOME} && echo 2>/dev/null 'quoted text' -eu cd "$1" echo
+		awk printf sed "$@" && /usr/bin
+sed && then /usr/bin && "$@" "$@"
+		printf done sed then
+-eu ${HOME} export then printf
+	--verbose x=1 $(pwd) test 2>/dev/null local
+		/usr/bin done grep sed test echo && echo
+		&& cd done test /usr/bin
+		${HOME} done done 'quoted text'
+		| $(pwd) cd | local export
+	echo "$@" 2>/dev/null 2>/dev/null readonly | done awk
+		$(pwd) echo printf readonly
+		x=1 | echo done "$1"
+| "$@" "$1" then $(pwd) -eu x=1 grep printf cd -eu sed "$1" -eu grep
+echo echo sed readonly | cd "$@" sed test then
+		then then /usr/bin "$1" && awk grep "$@" 'quoted text'
+		echo cd -eu then readonly 2>/dev/null sed then /usr/bin -eu
+	'quoted text' export export -eu x=1 done 2>/dev/null 'quoted text' -eu
+	then -eu x=1 && | awk done test done then sed then 'quoted text' 'quoted text' $(pwd)
+	sed --verbose printf $(pwd) printf
+"$@" $(pwd) printf "$@" "$1" sed grep
+test /usr/bin --verbose done grep x=1 then -eu
+then cd grep $(pwd) grep
+		${HOME} readonly --verbose local x=1 cd 2>/dev/null
+'quoted text' grep 'quoted text' $(pwd) awk grep -eu ${HOME} grep /usr/bin
+	echo && test x=1 local grep grep export "$@" 'quoted text' 2>/dev/null
+		echo $(pwd) cd local && readonly --verbose | x=1 -eu cd printf then readonly
+		--verbose sed | -eu cd 2>/dev/null --verbose "$@" grep /usr/bin local export
+		cd 2>/dev/null local "$1" awk awk $(pwd) sed -eu test awk /usr/bin
+		done test 2>/dev/null cd readonly done ${HOME}
+		'quoted text' grep "$@" x=1 readonly /usr/bin
+test x=1 --verbose sed awk readonly
+/usr/bin awk 2>/dev/null x=1 sed echo sed printf printf echo
+		then /usr/bin /usr/bin export awk -eu -eu "$@"
+		local | echo printf awk $(pwd) 2>/dev/null
+	readonly export cd done grep echo x=1 readonly 2>/dev/null then --verbose export
+sed cd done awk /usr/bin export $(pwd) x=1
+		sed /usr/bin then sed && --verbose $(pwd) then | "$@" printf && done
+	$(pwd) grep export "$@" echo printf then grep then "$1" /usr/bin awk printf
+		awk && x=1 x=1 && "$1" sed done "$@" 2>/dev/null
+		export done /usr/bin grep then "$1" done 2>/dev/null /usr/bin
+	$(pwd) --verbose ${HOME} -eu "$1" /usr/bin x=1
+	awk export test then /usr/bin 2>/dev/null sed "$@" sed
+	awk $(pwd) ${HOME} /usr/bin grep $(pwd)
+	echo 'quoted text' awk readonly done | 2>/dev/null --verbose
+		'quoted text' test && local printf -eu export "$@" 2>/dev/null 'quoted text'
+sed test export readonly && grep | 2>/dev/null
+		"$1" done | 'quoted text' "$@" grep cd "$@" test "$1"
+"$1" cd 'quoted text' local 2>/dev/null ${HOME}
+		-eu echo then grep echo 'quoted text' then then 'quoted text' readonly && $(pwd)
+	echo printf printf && 'quoted text' ${HOME} "$1" grep 2>/dev/null
+		"$@" local awk 'quoted text' | --verbose 2>/dev/null ${HOME} "$@" export
+-eu export echo printf /usr/bin "$1" --verbose
+		awk test x=1 /usr/bin local x=1 && export printf local grep -eu
+	2>/dev/null "$1" | /usr/bin done "$1" cd && grep echo && && readonly
+	sed 2>/dev/null 'quoted text' awk 'quoted text'
+	awk grep "$@" export printf $(pwd) $(pwd) grep 'quoted text'
+${HOME} 'quoted text'
+	echo then "$1" test test -eu --verbose readonly local
+		${HOME} local /usr/bin "$1" ${HOME} awk ${HOME}
+	'quoted text' echo --verbose readonly export test
+	local | -eu 2>/dev/null printf
+	"$1" readonly echo -eu --verbose readonly readonly export test
+test local x=1 test sed "$1" sed local 'quoted text' echo -eu
+		printf "$@" 2>/dev/null && export readonly echo 'quoted text'
+	grep -eu awk awk | | echo sed /usr/bin
+$(pwd) sed -eu -eu readonly 2>/dev/null
+"$@" x=1 readonly && -eu "$@" x=1 readonly then | "$@"
+		printf "$1" grep cd local cd sed /usr/bin readonly --verbose
+	x=1 | cd cd x=1 echo /usr/bin && echo done | /usr/bin "$@" local
+| "$1" && echo then -eu "$@" && printf export x=1 ${HOME} x=1 'quoted text' -eu
+	--verbose "$1" ${HOME}
+local ${HOME} -eu 'quoted text' 2>/dev/null
+		cd 'quoted text' sed /usr/bin "$@" "$1"
+	then && 2>/dev/null ${HOME} done "$@" export readonly -eu grep "$@"
+		cd -eu printf done cd test test x=1 test readonly
+	local grep --verbose then cd test
+	"$@" x=1 grep && then local test $(pwd)
+	x=1 cd x=1 printf cd && readonly
+done cd 'quoted text' local
+	grep 2>/dev/null && /usr/bin && | /usr/bin 'quoted text'
+awk printf echo cd sed echo "$1"
+		${HOME} "$1" local 'quoted text' then local 'quoted text' -eu local 'quoted text'
+		x=1 export 2>/dev/null echo && 'quoted text' echo local -eu grep awk 2>/dev/null
+		/usr/bin local && cd "$@" "$@" 2>/dev/null
+printf | sed local printf awk sed readonly sed
+		grep && readonly ${HOME} sed | ${HOME} then cd test readonly test 2>/dev/null
+	--verbose "$@" test 2>/dev/null && cd done export local "$@" "$1"
+export sed 2>/dev/null ${HOME} echo then --verbose done
+	&& grep export "$1" $(pwd) echo grep "$@" then test 2>/dev/null awk
+		echo readonly 2>/dev/null sed 2>/dev/null local done export
+	sed then export echo echo /usr/bin
+		export 'quoted text' sed | -eu cd then $(pwd) ${HOME} echo
+	export awk ${HOME} awk printf 'quoted text'
+	test echo 2>/dev/null export | && 'quoted text' | "$@" /usr/bin awk "$@" "$1"
+		grep local done 2>/dev/null awk ${HOME}
+export /usr/bin -eu export cd
+	test ${HOME} printf "$@" "$1" ${HOME} printf && cd
+cd then $(pwd) local "$1" | x=1 test local test grep grep /usr/bin readonly
+/usr/bin 'quoted text' readonly echo awk printf
+		echo -eu test 2>/dev/null done cd echo /usr/bin
+		--verbose readonly local done /usr/bin
+		grep 'quoted text' "$@" then echo 'quoted text' printf
+	test done sed sed readonly $(pwd) "$@" done done
+		-eu readonly test grep x=1 --verbose $(pwd) x=1 2>/dev/null then then ${HOME}
+	readonly export cd ${HOME} echo && 2>/dev/null echo 'quoted text'
+readonly "$@" | -eu printf ${HOME} done && readonly local -eu
+	"$1" | ${HOME} cd "$1" test /usr/bin --verbose readonly
+		'quoted text' /usr/bin | 2>/dev/null 'quoted text' printf echo /usr/bin
+	done grep echo /usr/bin 2>/dev/null
+		sed ${HOME} grep "$@" /usr/bin "$1" ${HOME} $(pwd) "$@" -eu readonly "$1" export
+	x=1 awk "$1" awk && echo done echo "$1" local "$@" "$1"
+		readonly "$@" && printf echo
+"$1" echo ${HOME} --verbose printf /usr/bin echo && local | local
@@ -0,0 +1,2001 @@
+	cd | "$1" printf then awk "$1" done done export
+"$@" --verbose grep then printf
+	/usr/bin readonly -eu -eu
+done && readonly -eu printf
+		export export sed local
+		'quoted text' -eu ${HOME}
+	"$@" && then printf awk 'quoted text' 2>/dev/null | awk x=1 ${HOME}
+	done grep done echo done x=1 -eu -eu local $(pwd)
+grep "$1" printf 'quoted text' grep export
+	echo echo echo printf x=1 done
+	echo -eu then done printf && -eu export
+test 2>/dev/null x=1 "$1" $(pwd) local awk
+		test /usr/bin readonly export printf
+-eu local 2>/dev/null "$1" echo | sed $(pwd) then done test && printf
+	test readonly x=1 "$1" $(pwd) awk
+	then awk | 'quoted text' sed | cd done --verbose awk cd local "$1" then | --verbose
+		$(pwd) export local export readonly echo cd -eu x=1 "$1"
+		sed cd grep local test 'quoted text' --verbose ${HOME} 2>/dev/null
+		then cd ${HOME} ${HOME} local ${HOME} && -eu printf echo cd
+	echo -eu && 'quoted text' && 'quoted text'
+	'quoted text' awk $(pwd) ${HOME} 'quoted text'
+		export sed "$1" ${HOME} done $(pwd) readonly
+	export cd && done cd grep done sed readonly -eu
+		grep -eu 2>/dev/null "$1" then local readonly test -eu
+echo -eu ${HOME} sed "$@" "$1" cd test echo 2>/dev/null cd echo sed | export
+		2>/dev/null grep test "$1" | ${HOME} awk
+	/usr/bin grep then sed done "$@" grep | readonly && | | readonly
+		"$1" /usr/bin export sed | then $(pwd) x=1 cd printf
+		'quoted text' --verbose printf -eu "$@" && x=1
+		then | awk --verbose local /usr/bin "$@"
+		awk done printf export | awk 2>/dev/null && export awk -eu -eu echo
+		"$@" grep 2>/dev/null /usr/bin
+test readonly grep done local && "$@" sed sed $(pwd)
+		$(pwd) "$1" | grep "$1" 2>/dev/null -eu readonly sed $(pwd) test readonly
+	done test "$@" awk $(pwd) done grep /usr/bin
+	-eu test export test "$@"
+sed $(pwd) 'quoted text' printf readonly awk x=1 x=1 test
+| cd "$@" readonly grep ${HOME} awk | sed | 2>/dev/null
+export --verbose export local x=1 -eu grep
+awk ${HOME} done -eu cd --verbose $(pwd) cd /usr/bin /usr/bin printf
+	2>/dev/null -eu readonly export 'quoted text' awk $(pwd)
+		local test $(pwd) 'quoted text' | cd && 2>/dev/null cd 'quoted text' sed x=1 sed
+local -eu echo "$@" -eu done "$1" x=1 "$1" && then export test
+printf --verbose --verbose ${HOME} grep x=1 /usr/bin test x=1
+		printf "$1" && ${HOME} "$1" readonly printf | | cd echo 'quoted text'
+		| 2>/dev/null /usr/bin x=1 | && then printf
+echo awk 'quoted text' test && | --verbose $(pwd)
+		cd cd --verbose $(pwd)
+/usr/bin -eu ${HOME} awk "$@" $(pwd) readonly test "$1"
+	export sed x=1 'quoted text'
+x=1 printf ${HOME} 2>/dev/null then
+export echo /usr/bin awk | | local awk
+	$(pwd) && x=1 test "$1" readonly && test grep
+		| /usr/bin ${HOME} export | echo test grep -eu && 'quoted text'
+		| test grep local readonly cd | awk readonly awk export -eu awk cd $(pwd)
+		'quoted text' cd done --verbose $(pwd) local
+		"$1" test x=1 2>/dev/null "$1" test echo grep then awk
+printf /usr/bin local awk local export sed "$1"
+done export x=1 'quoted text' /usr/bin then | export "$1" printf
+		awk --verbose ${HOME} readonly cd grep awk /usr/bin cd cd sed --verbose
+test $(pwd) 2>/dev/null then
+		cd grep x=1 grep "$@" echo && --verbose then && sed printf x=1 "$1"
+2>/dev/null local sed $(pwd) --verbose 2>/dev/null
+local printf "$1" && && then readonly && then
+/usr/bin done "$1" /usr/bin 'quoted text' sed then --verbose | "$@" x=1 'quoted text'
+		awk -eu sed test x=1 then $(pwd) sed 'quoted text'
+	then $(pwd) test --verbose readonly
+test printf sed cd && /usr/bin cd -eu sed /usr/bin
+local 'quoted text' printf --verbose /usr/bin export 2>/dev/null grep 'quoted text'
+	-eu "$1" local grep --verbose then
+2>/dev/null awk && 'quoted text' && "$1" && done echo 'quoted text'
+local done local 2>/dev/null cd | sed test $(pwd) echo cd 2>/dev/null
+		local cd cd --verbose sed export printf "$1" sed test done $(pwd)
+then "$@" readonly --verbose
+		$(pwd) readonly awk then x=1 echo
+2>/dev/null then printf /usr/bin
+		readonly && ${HOME} && local | export ${HOME} 2>/dev/null $(pwd)
+		export readonly then local -eu echo && "$@" grep local sed $(pwd) --verbose
+	'quoted text' grep /usr/bin done 'quoted text' awk /usr/bin done then echo export
+x=1 test "$1" done readonly test
+"$@" readonly --verbose ${HOME}
+	--verbose "$1" awk local local 2>/dev/null
+	/usr/bin echo local ${HOME} -eu
+	test /usr/bin 'quoted text'
+	echo grep "$1" "$@" grep echo
+	readonly | local printf
+		$(pwd) "$1" echo echo
+	2>/dev/null -eu grep readonly
+	then --verbose then --verbose /usr/bin
+readonly "$1" grep done --verbose x=1 /usr/bin /usr/bin | "$@" sed --verbose
+		'quoted text' then then x=1 cd readonly export 'quoted text' x=1 ${HOME} x=1 then
+		done readonly "$1" then --verbose | x=1 done readonly done
+	printf | 2>/dev/null ${HOME} printf echo 'quoted text'
+		"$@" "$@" "$1" --verbose x=1 2>/dev/null 'quoted text'
+		| local sed --verbose echo
+$(pwd) $(pwd) 2>/dev/null x=1 && && then readonly awk ${HOME} sed sed "$1"
+	"$@" $(pwd) export echo test
+		sed "$1" /usr/bin "$@" sed /usr/bin then x=1 $(pwd) printf
+	x=1 ${HOME} printf && $(pwd) echo
+		done ${HOME} readonly | awk printf printf
+	test done echo 2>/dev/null local readonly grep grep && printf done sed && awk
+sed done -eu --verbose then readonly echo sed 'quoted text' x=1
+	local --verbose test | cd echo -eu grep "$1" | -eu awk
+"$@" $(pwd) && sed 'quoted text' && then
+		cd "$1" && $(pwd) --verbose && then echo done printf
+sed 'quoted text' test sed $(pwd) then sed x=1 "$@" $(pwd) x=1 "$@" test
+	export ${HOME} /usr/bin | test local /usr/bin /usr/bin done cd then "$@"
+		/usr/bin /usr/bin --verbose test | "$@" echo
+then then done /usr/bin | $(pwd) echo ${HOME} "$1" --verbose
+done | | --verbose printf sed test x=1 cd /usr/bin
+awk "$1" && 'quoted text'
+	cd cd --verbose -eu "$1" 'quoted text' test | -eu local done x=1 $(pwd)
+	export "$1" awk ${HOME} export $(pwd) ${HOME} awk --verbose export printf
+		2>/dev/null "$1" /usr/bin awk && local $(pwd) x=1 | printf export
+	$(pwd) && x=1 echo 2>/dev/null | ${HOME} then grep sed cd
+printf && | awk readonly then
+$(pwd) sed readonly printf -eu 'quoted text' local
+sed cd "$1" $(pwd) done /usr/bin export awk done x=1 local x=1 done | $(pwd)
+		readonly 'quoted text' cd awk "$@" && done | printf cd --verbose ${HOME} grep
+${HOME} sed | /usr/bin --verbose
+${HOME} --verbose && $(pwd) x=1 x=1 grep local -eu readonly --verbose then 2>/dev/null
+		cd && printf 'quoted text' "$1" $(pwd) -eu echo test /usr/bin then echo done
+${HOME} $(pwd) export && awk export $(pwd)
+		local grep cd test "$1" ${HOME} $(pwd) && readonly awk ${HOME} 'quoted text'
+	export 2>/dev/null printf local cd readonly
+	export readonly grep "$@" ${HOME} awk then readonly
+x=1 'quoted text' --verbose readonly "$1" -eu
+		done /usr/bin echo 'quoted text' | local then -eu awk "$1" ${HOME} awk
+		"$1" --verbose "$1" grep cd && test grep -eu
+		2>/dev/null $(pwd) 'quoted text'
+		--verbose | echo "$1" done 2>/dev/null sed cd 2>/dev/null ${HOME} then readonly
+export awk x=1 done printf /usr/bin then
+	/usr/bin -eu readonly test x=1 echo | -eu sed "$@"
+cd ${HOME} grep && done ${HOME} &&
+2>/dev/null printf test cd
+		sed then then "$1" echo | ${HOME} sed --verbose sed
+| readonly export local local 'quoted text' | local done sed local
+	readonly $(pwd) 2>/dev/null readonly awk done && printf /usr/bin
+	--verbose local $(pwd) awk export "$@"
+		awk "$@" awk grep "$1" | awk "$1" 'quoted text' /usr/bin local $(pwd) "$@" export
+	/usr/bin --verbose then export 2>/dev/null sed sed test cd
+$(pwd) "$@" readonly echo 2>/dev/null /usr/bin grep
+printf awk printf 'quoted text' -eu
+		2>/dev/null awk -eu 'quoted text' /usr/bin then -eu && done
+	test -eu cd --verbose --verbose 'quoted text'
+awk 'quoted text' done cd ${HOME} awk echo export printf 2>/dev/null
+		then cd "$1" /usr/bin -eu --verbose --verbose
+	grep cd awk then /usr/bin grep $(pwd) && x=1 2>/dev/null
+'quoted text' cd sed 2>/dev/null
+		2>/dev/null export ${HOME} x=1 "$1" $(pwd) export echo | "$@" done | echo
+	${HOME} local cd -eu "$1" cd cd x=1 readonly echo local done
+	&& && sed 2>/dev/null printf | export sed then test printf
+		echo | sed 'quoted text' && "$@" /usr/bin cd echo 2>/dev/null
+		then && 'quoted text' test -eu -eu cd /usr/bin "$1"
+cd x=1 x=1 cd readonly cd grep "$1" "$1" awk done export done sed
+		x=1 sed echo sed printf $(pwd) && | --verbose "$1" grep echo $(pwd) grep
+	&& sed then awk readonly printf
+	local echo cd /usr/bin awk local readonly --verbose $(pwd)
+test local 2>/dev/null sed --verbose 'quoted text' readonly done
+	readonly "$@" --verbose grep x=1 readonly awk awk local export cd
+	"$@" cd $(pwd) "$@" printf readonly done cd test
+	cd sed export "$1" /usr/bin done test
+printf $(pwd) | && done grep $(pwd) | readonly
+2>/dev/null grep -eu grep /usr/bin
+&& 'quoted text' "$@" -eu then echo "$1" --verbose
+	2>/dev/null "$1" readonly
+	export done sed 'quoted text' -eu
+	cd -eu then /usr/bin sed x=1 --verbose | printf sed
+	export export printf export grep
+"$1" --verbose -eu && --verbose readonly done export x=1 'quoted text' $(pwd)
+		'quoted text' export grep test "$1" local
+${HOME} -eu && printf | -eu 'quoted text' ${HOME}
+2>/dev/null $(pwd) "$1" ${HOME} /usr/bin readonly 2>/dev/null 'quoted text'
+export "$@" printf done $(pwd) done "$@" /usr/bin -eu grep /usr/bin "$@" /usr/bin
+		x=1 -eu $(pwd) x=1 awk /usr/bin test "$@" sed sed
+printf | /usr/bin readonly done awk "$@"
+local 'quoted text' test awk test echo test test export cd
+/usr/bin test cd --verbose done 2>/dev/null cd 'quoted text' grep
+		| --verbose printf -eu "$@"
+		readonly readonly ${HOME} --verbose done grep 2>/dev/null
+	/usr/bin awk grep then ${HOME} grep test $(pwd) 'quoted text' cd
+	echo grep test "$1" then cd 2>/dev/null
+local ${HOME} readonly -eu readonly /usr/bin --verbose test ${HOME} sed cd ${HOME}
+2>/dev/null cd printf $(pwd) echo sed 2>/dev/null x=1 printf -eu ${HOME}
+	grep echo readonly grep "$1" && printf readonly 'quoted text' export $(pwd)
+	&& echo grep 2>/dev/null "$@" sed 'quoted text'
+		$(pwd) cd && printf 'quoted text' 2>/dev/null then "$1" ${HOME} | 2>/dev/null
+	2>/dev/null 2>/dev/null then "$1" 2>/dev/null
+"$@" cd | test export && "$@" 'quoted text' awk ${HOME} test test
+	local "$@" then done && --verbose grep
+	done then 2>/dev/null printf printf awk --verbose grep
+	x=1 --verbose 'quoted text' --verbose then --verbose ${HOME} local local
+	${HOME} printf ${HOME} "$@" -eu readonly
+		2>/dev/null then x=1 'quoted text' && test cd echo x=1 awk sed cd then --verbose
+		${HOME} x=1 export cd -eu && grep 2>/dev/null
+	local 2>/dev/null | test 2>/dev/null local x=1 $(pwd) ${HOME} then
+	awk /usr/bin local $(pwd) readonly cd
+		&& echo then test ${HOME} echo
+		x=1 -eu cd | 'quoted text' ${HOME} printf /usr/bin
+printf && && sed test cd echo done 'quoted text'
+		2>/dev/null sed -eu -eu printf printf
+	readonly cd local 2>/dev/null sed 'quoted text' "$1" /usr/bin 2>/dev/null export
+	grep cd grep printf --verbose
+	awk /usr/bin && then 2>/dev/null --verbose
+${HOME} done grep done awk --verbose readonly
+		echo ${HOME} readonly test ${HOME} then then /usr/bin readonly x=1
+readonly x=1 -eu done "$1" "$1" readonly
+		then done test "$@" export grep $(pwd) -eu --verbose "$@" echo
+&& --verbose | cd grep local 'quoted text' test local printf
+2>/dev/null local export ${HOME} cd export cd 2>/dev/null
+then --verbose local ${HOME} awk awk 'quoted text'
+echo $(pwd) 'quoted text' then x=1 test "$1"
+		done grep ${HOME} 'quoted text' then then
+		done cd "$1" grep $(pwd) x=1 printf local | export 'quoted text' /usr/bin local
+x=1 x=1 ${HOME} -eu test ${HOME}
+sed x=1 x=1 2>/dev/null awk /usr/bin
+		test export 'quoted text' 'quoted text' sed test then export
+sed grep done && "$1" $(pwd) readonly --verbose echo done printf $(pwd)
+		"$1" printf $(pwd) cd grep -eu
+	local "$@" readonly printf $(pwd) --verbose /usr/bin grep sed
+		readonly -eu ${HOME} "$@" $(pwd)
+	awk -eu | 'quoted text' x=1 && x=1 grep | grep readonly
+		done export && /usr/bin done grep /usr/bin readonly test /usr/bin
+	echo sed awk export then | done
+		local 'quoted text' --verbose | cd awk done grep export 'quoted text'
+	x=1 done sed readonly local test 2>/dev/null sed ${HOME} /usr/bin "$1" printf
+	"$1" awk awk then sed sed "$1" readonly 'quoted text'
+awk grep local test printf /usr/bin done test
+		| then /usr/bin printf $(pwd) cd "$@" 'quoted text' readonly then readonly x=1
+2>/dev/null cd sed 'quoted text' cd -eu readonly 'quoted text' echo echo
+		x=1 test && sed grep ${HOME} | readonly
+grep ${HOME} awk done "$1" && cd export $(pwd) $(pwd) /usr/bin | printf
+		&& test then done readonly
+	export -eu /usr/bin grep "$@" awk "$1" 2>/dev/null $(pwd) "$@" x=1 ${HOME}
+		--verbose readonly 'quoted text' "$1" x=1 --verbose
+	readonly /usr/bin readonly | printf export grep then done awk /usr/bin
+	/usr/bin printf 'quoted text' --verbose -eu then "$1" printf "$@" "$@" &&
+test grep | export 2>/dev/null local local printf && 'quoted text' /usr/bin
+	test /usr/bin "$1" -eu printf cd test
+/usr/bin && && $(pwd) echo -eu $(pwd) sed done /usr/bin
+		"$@" | "$1" /usr/bin
+		--verbose && sed awk && sed |
+	${HOME} 2>/dev/null -eu echo printf | sed --verbose printf then /usr/bin grep
+	"$@" && export $(pwd) 2>/dev/null done |
+$(pwd) printf export -eu export $(pwd) printf printf local export
+echo grep sed "$1" done cd export done 2>/dev/null "$@" grep 'quoted text'
+	printf | export 'quoted text'
+	'quoted text' $(pwd) export 'quoted text'
+	&& echo -eu awk then --verbose grep && readonly cd
+		/usr/bin --verbose /usr/bin 2>/dev/null /usr/bin
+		"$1" --verbose -eu 2>/dev/null local cd printf 'quoted text' 2>/dev/null
+		${HOME} $(pwd) awk cd -eu
+		export ${HOME} local ${HOME}
+		$(pwd) grep echo "$@" x=1 export
+		"$1" awk "$@" && --verbose && sed && done grep 2>/dev/null
+		local 2>/dev/null "$1" readonly
+	cd ${HOME} && ${HOME} | /usr/bin done echo "$1" then /usr/bin local
+	x=1 ${HOME} awk then local
+	'quoted text' test then test
+grep printf printf | grep
+		awk | export echo /usr/bin && readonly printf x=1 'quoted text' local awk 'quoted text'
+"$1" test x=1 /usr/bin done "$@" cd $(pwd)
+2>/dev/null /usr/bin | | local cd 2>/dev/null /usr/bin
+		then $(pwd) 2>/dev/null
+		&& x=1 cd printf echo export $(pwd) $(pwd) "$1" awk printf cd && 'quoted text'
+		2>/dev/null readonly
+		echo x=1 "$@" $(pwd) $(pwd) $(pwd) -eu --verbose
+	| printf readonly --verbose /usr/bin x=1 x=1 echo cd echo echo ${HOME} 'quoted text'
+		awk ${HOME} test ${HOME} $(pwd) /usr/bin "$@" grep test cd echo && --verbose -eu
+sed /usr/bin export 'quoted text' echo
+		done local -eu x=1 printf && /usr/bin 2>/dev/null export grep 2>/dev/null
+		test | awk test | local cd
+	"$@" readonly 'quoted text' printf then -eu -eu 2>/dev/null
+${HOME} readonly sed "$1" "$1" export ${HOME}
+	printf export grep 2>/dev/null 2>/dev/null --verbose 2>/dev/null |
+printf && test $(pwd) local -eu "$@" done printf test -eu 2>/dev/null grep
+		sed export done echo sed | $(pwd) done cd x=1 cd ${HOME} x=1 done
+-eu | -eu sed $(pwd) 'quoted text'
+		echo awk cd done local readonly | | && /usr/bin -eu && | x=1 -eu sed then test
+		readonly readonly cd local awk "$1" && readonly printf printf
+		then | "$@" | ${HOME} sed readonly 2>/dev/null
+/usr/bin grep $(pwd) 2>/dev/null
+--verbose "$@" | sed test sed sed sed -eu echo printf -eu done readonly
+local | 'quoted text' "$@" 'quoted text'
+		/usr/bin ${HOME} echo ${HOME} && 2>/dev/null sed echo
+		local x=1 test printf awk awk --verbose local "$1" | awk printf grep local
+'quoted text' grep printf awk "$@"
+		$(pwd) local /usr/bin cd "$1" test /usr/bin grep /usr/bin $(pwd)
+test 2>/dev/null "$@" 'quoted text'
+	echo 'quoted text' x=1 "$@" "$@" $(pwd) local grep readonly
+x=1 test cd awk awk && grep "$1" awk echo echo $(pwd) cd grep "$1"
+		sed 2>/dev/null awk | ${HOME}
+readonly | test local -eu cd test then $(pwd) 'quoted text' readonly
+		--verbose then export sed sed
+		x=1 export x=1 "$@" /usr/bin
+	${HOME} 'quoted text' sed done export -eu -eu export "$1"
+		--verbose -eu x=1 -eu test
+--verbose x=1 done | echo 'quoted text'
+$(pwd) -eu local test /usr/bin export --verbose "$@" &&
+	echo then then awk cd --verbose
+		2>/dev/null test cd sed
+cd "$@" export "$1" done
+	x=1 && x=1 readonly "$1" echo printf 2>/dev/null 'quoted text' "$@" cd x=1 2>/dev/null
+		&& -eu && "$1" readonly --verbose $(pwd) && $(pwd) -eu &&
+	echo echo ${HOME} cd && readonly
+	readonly x=1 'quoted text' echo then && --verbose
+	$(pwd) printf then x=1 -eu $(pwd) readonly
+	local $(pwd) awk ${HOME} export echo
+-eu "$@" | --verbose done done /usr/bin --verbose export done
+	cd printf "$1" cd | done grep readonly -eu $(pwd)
+	sed done | && local /usr/bin readonly
+	"$@" cd && then sed $(pwd) $(pwd) export /usr/bin
+&& cd awk && readonly --verbose then export -eu | test printf grep | x=1 sed $(pwd)
+	"$1" 2>/dev/null cd echo sed ${HOME} "$@" cd 2>/dev/null readonly 'quoted text'
+then --verbose echo export && grep test
+		"$1" ${HOME} ${HOME} test "$1" | local | done $(pwd) /usr/bin then printf
+| "$@" done $(pwd) 2>/dev/null ${HOME} printf x=1 -eu done $(pwd) export done
+	"$1" local then "$1" --verbose
+	'quoted text' test grep | /usr/bin -eu "$1" cd then
+	${HOME} "$@" echo -eu sed done 2>/dev/null then done --verbose &&
+		printf export readonly /usr/bin readonly 2>/dev/null x=1
+		"$@" cd local --verbose | sed --verbose test -eu 'quoted text'
+		x=1 x=1 -eu readonly printf $(pwd)
+	printf test "$@" sed "$1" sed $(pwd) awk 2>/dev/null cd grep x=1 "$1" --verbose
+	export /usr/bin export "$1"
+	local -eu test /usr/bin --verbose
+		&& grep sed x=1 awk 'quoted text' awk "$1" --verbose
+	sed done local -eu $(pwd) grep 2>/dev/null grep done echo cd x=1
+		grep ${HOME} "$1" awk --verbose --verbose && && grep readonly
+done x=1 done $(pwd) 2>/dev/null done export ${HOME}
+	echo 'quoted text' cd x=1 local && && echo then cd && cd test sed 'quoted text'
+		awk x=1 readonly sed "$1" echo
+	${HOME} "$@" echo -eu && export printf 'quoted text'
+echo readonly /usr/bin test | --verbose done printf export local
+"$@" "$@" 2>/dev/null --verbose echo printf awk test done --verbose
+	then 'quoted text' grep awk $(pwd) --verbose --verbose && readonly
+--verbose && test "$1" /usr/bin | then cd --verbose
+		printf cd readonly && done export /usr/bin awk && -eu grep awk --verbose |
+		2>/dev/null cd echo awk && 'quoted text'
+--verbose "$1" echo | sed test 'quoted text' grep -eu /usr/bin 'quoted text'
+"$1" "$1" awk 'quoted text' readonly x=1 done local
+		sed then ${HOME} printf | && /usr/bin ${HOME} "$@" grep local local export
+	-eu && 'quoted text' 2>/dev/null export sed ${HOME}
+test "$@" $(pwd) "$1" grep awk 2>/dev/null echo x=1 "$@"
+	${HOME} "$1" readonly done "$@" cd --verbose echo printf
+		readonly && /usr/bin readonly 'quoted text' "$@" /usr/bin sed
+	2>/dev/null --verbose local local export grep printf "$1" --verbose readonly
+	'quoted text' $(pwd) cd ${HOME} 'quoted text' local printf x=1 echo -eu
+test -eu export done echo --verbose readonly readonly readonly | "$1" readonly
+	"$1" then "$@" sed $(pwd) ${HOME} x=1 | 2>/dev/null 2>/dev/null
+		readonly readonly $(pwd) then echo
+	${HOME} $(pwd) test sed printf readonly "$@"
+'quoted text' cd && cd "$@" $(pwd) echo 'quoted text'
+		sed then --verbose cd
+	export --verbose | export "$@" ${HOME} $(pwd)
+	sed cd -eu printf awk /usr/bin "$1" "$@" --verbose done -eu done sed printf readonly
+		sed sed sed x=1 awk local awk then "$1" ${HOME}
+	export | local 2>/dev/null x=1 | sed
+		local grep 'quoted text' | /usr/bin echo test ${HOME} done printf 'quoted text'
+		x=1 printf grep awk awk x=1 $(pwd)
+| cd /usr/bin && cd grep "$@" then done export
+		x=1 local x=1 grep then grep
+"$@" && echo then awk x=1 sed export cd && export
+		--verbose 'quoted text' sed $(pwd) grep -eu "$@" | grep echo echo
+		${HOME} /usr/bin local x=1 -eu /usr/bin 2>/dev/null export "$@"
+		grep ${HOME} $(pwd) echo readonly echo
+		export "$@" export test then echo $(pwd)
+	test ${HOME} awk local echo -eu ${HOME} "$@" -eu export |
+		${HOME} awk local --verbose 'quoted text' cd export -eu test "$@" grep && 'quoted text'
+done sed test --verbose then cd $(pwd) 2>/dev/null done test printf echo "$@"
+		sed x=1 --verbose && done 'quoted text' "$@" export
+	x=1 $(pwd) test test x=1 'quoted text' test 2>/dev/null sed local echo
+		done sed | printf --verbose "$1" x=1 cd && 2>/dev/null
+	--verbose 'quoted text' 2>/dev/null /usr/bin 'quoted text'
+${HOME} --verbose export export ${HOME}
+		-eu echo done --verbose export awk cd -eu 'quoted text' 'quoted text'
+		echo $(pwd) readonly -eu
+	"$1" echo printf local --verbose readonly
+	then -eu | ${HOME} test 2>/dev/null
+printf $(pwd) sed sed grep export
+"$@" readonly printf 2>/dev/null $(pwd) --verbose
+then sed -eu printf | done awk && cd local $(pwd) -eu test ${HOME} $(pwd)
+sed $(pwd) && grep sed done "$1" export && awk cd x=1 readonly echo $(pwd)
+$(pwd) 'quoted text' printf then /usr/bin done grep awk | /usr/bin
+	sed -eu done && export done export
+cd echo printf local -eu 2>/dev/null grep "$1" awk | 2>/dev/null
+		sed && 2>/dev/null local x=1 readonly && 'quoted text' 'quoted text'
+	then printf export 2>/dev/null
+		$(pwd) && local then | test then awk
+readonly test then done awk && local grep local test echo then
+		done local sed $(pwd) readonly "$1" "$1" x=1 echo readonly | export
+		2>/dev/null $(pwd) test then && done printf
+		sed "$1" | 'quoted text' awk grep ${HOME} $(pwd)
+| && --verbose done grep
+| export "$@" x=1 x=1 readonly export done --verbose -eu cd -eu 'quoted text'
+grep "$1" ${HOME} | readonly x=1 test
+	| readonly export grep ${HOME} done $(pwd)
+${HOME} echo printf test
+		then grep then printf --verbose
+		| -eu -eu 2>/dev/null local local awk done echo cd ${HOME}
+done 2>/dev/null sed grep then
+	export echo test cd grep printf 2>/dev/null
+"$@" && local ${HOME} 'quoted text' readonly printf test
+done grep printf 2>/dev/null
+		"$@" --verbose -eu 2>/dev/null x=1 | awk export
+then sed 'quoted text' then sed x=1 local $(pwd) x=1 test $(pwd) printf "$@"
+		/usr/bin 2>/dev/null test local && --verbose $(pwd) --verbose readonly
+	2>/dev/null export ${HOME} awk /usr/bin readonly
+-eu done sed echo grep
+	2>/dev/null awk x=1 | done
+	printf --verbose ${HOME} && "$@" readonly sed echo 2>/dev/null sed "$1"
+	$(pwd) $(pwd) sed 2>/dev/null grep then local --verbose
+grep --verbose awk && cd "$@" echo readonly 'quoted text' cd then -eu "$@"
+local && "$@" | sed echo "$@" ${HOME}
+	"$1" && grep readonly readonly grep cd "$1" 'quoted text'
+$(pwd) 2>/dev/null 2>/dev/null cd "$1" ${HOME}
+		"$@" readonly local awk /usr/bin test "$@" x=1 && awk "$@" done grep
+${HOME} awk then /usr/bin $(pwd)
+	| local /usr/bin "$1" "$1" echo ${HOME} done printf sed "$1" ${HOME}
+		-eu 'quoted text' "$1" ${HOME} local then readonly
+	'quoted text' awk awk done printf then echo 2>/dev/null
+		"$1" echo test test 2>/dev/null 'quoted text' export readonly
+local 'quoted text' sed --verbose test awk readonly /usr/bin echo then --verbose
+		printf awk readonly grep 'quoted text' "$1" && x=1 ${HOME} --verbose
+	done sed done && export local echo local grep $(pwd) "$1" echo readonly done ${HOME}
+	${HOME} local grep readonly readonly done "$1"
+		echo ${HOME} then local /usr/bin local export export
+	-eu done printf grep x=1 | sed echo | done sed printf | test
+	--verbose 2>/dev/null cd $(pwd) echo
+	"$@" | 2>/dev/null local echo done 2>/dev/null
+		local cd ${HOME} echo echo $(pwd) ${HOME} local "$1" local && && $(pwd)
+	printf -eu 2>/dev/null "$@" "$1" && 'quoted text' 2>/dev/null
+	--verbose && then --verbose /usr/bin $(pwd)
+then /usr/bin --verbose cd | "$1" awk awk 2>/dev/null
+		"$@" && export --verbose echo cd sed && then cd local test -eu
+		local echo "$1" 2>/dev/null -eu $(pwd) --verbose grep export export ${HOME}
+		-eu cd echo "$1" then test /usr/bin then
+| export ${HOME} done export 2>/dev/null | ${HOME} |
+	2>/dev/null --verbose export && readonly --verbose cd $(pwd) grep awk printf
+	| 2>/dev/null ${HOME} local test x=1 $(pwd) "$@"
+cd grep 2>/dev/null --verbose /usr/bin awk readonly done
+		then ${HOME} --verbose "$1" export readonly x=1 -eu /usr/bin -eu test printf "$@"
+	/usr/bin test local /usr/bin ${HOME} && $(pwd) "$@" /usr/bin $(pwd)
+		-eu "$@" ${HOME} grep grep done ${HOME}
+	${HOME} 2>/dev/null | -eu then -eu /usr/bin cd 'quoted text' --verbose
+	cd done -eu sed printf "$@" done $(pwd) --verbose echo x=1
+		cd 2>/dev/null && "$@" awk 2>/dev/null
+grep test then sed local echo
+	sed printf ${HOME} export grep "$@" -eu
+'quoted text' -eu echo local done "$@" 2>/dev/null done grep && sed cd readonly
+&& awk readonly | "$1" ${HOME} then echo
+-eu && local | --verbose grep ${HOME} awk then
+$(pwd) ${HOME} $(pwd) awk then 'quoted text' x=1 --verbose "$@" then echo then
+		2>/dev/null sed sed 'quoted text' "$@" && 'quoted text' readonly local
+		'quoted text' | then --verbose printf
+awk "$@" awk -eu --verbose
+readonly "$@" --verbose then -eu "$1" "$@" 'quoted text'
+done test then "$1" printf then && x=1 --verbose $(pwd) cd 'quoted text' echo awk
+		local readonly cd "$@" sed test -eu awk 2>/dev/null export
+		local printf export readonly -eu test $(pwd) test
+${HOME} && $(pwd) $(pwd) printf
+	awk $(pwd) grep then echo $(pwd) 2>/dev/null
+		grep grep $(pwd) export readonly
+		-eu cd then "$1" grep -eu "$1" readonly export -eu -eu 'quoted text'
+| "$@" cd | $(pwd) /usr/bin
+	then grep "$1" cd test echo done printf echo printf then printf awk export
+		readonly -eu echo ${HOME} echo export -eu 2>/dev/null --verbose
+	grep | then awk --verbose done sed awk && | --verbose $(pwd) /usr/bin
+"$1" && readonly 'quoted text' awk readonly x=1 -eu "$1"
+		export ${HOME} local grep then x=1 sed 2>/dev/null
+		${HOME} done 2>/dev/null "$@" 'quoted text' "$@" local
+sed "$1" 2>/dev/null 2>/dev/null sed && readonly
+	printf done && $(pwd) x=1 ${HOME} echo cd $(pwd) | "$@" -eu 2>/dev/null cd
+"$1" && | -eu --verbose 2>/dev/null
+export | printf cd done awk awk cd cd readonly --verbose readonly 'quoted text'
+$(pwd) sed done 2>/dev/null /usr/bin "$@" "$@" $(pwd) cd
+	cd echo && 'quoted text' test local --verbose local printf x=1 --verbose --verbose
+		"$1" printf then $(pwd) grep $(pwd) "$@" cd
+2>/dev/null cd sed awk && 'quoted text' echo grep ${HOME} |
+"$1" export "$@" sed "$1" readonly
+local readonly grep && --verbose grep export readonly
+		2>/dev/null local sed "$1" local ${HOME}
+	echo 'quoted text' x=1 && local && 2>/dev/null && grep x=1 $(pwd) echo
+${HOME} /usr/bin done grep readonly
+-eu readonly test echo awk export --verbose test 'quoted text'
+$(pwd) cd local then printf readonly readonly test local 2>/dev/null cd --verbose
+	'quoted text' 'quoted text' 2>/dev/null cd 2>/dev/null -eu && ${HOME} | x=1
+		"$1" test cd test --verbose ${HOME} 2>/dev/null local ${HOME} test
+| | --verbose /usr/bin sed --verbose
+		-eu local /usr/bin ${HOME} awk echo printf echo 2>/dev/null
+		cd readonly echo awk
+	'quoted text' -eu ${HOME} local /usr/bin 2>/dev/null done test | export then
+printf test x=1 test echo | local readonly
+echo $(pwd) awk $(pwd) sed sed cd | awk "$1" "$@" done
+"$1" --verbose "$1" $(pwd)
+"$@" cd 'quoted text' "$@" $(pwd)
+		readonly "$1" printf then then grep
+		local x=1 readonly -eu done ${HOME}
+		grep cd printf sed local | local | "$@"
+	&& awk /usr/bin $(pwd) "$@" readonly export /usr/bin x=1
+	local test done "$1" local ${HOME} ${HOME} "$@" $(pwd) grep test
+		grep export done sed test grep ${HOME} 'quoted text' $(pwd) then
+"$1" 2>/dev/null done "$1" ${HOME} readonly done -eu awk test then "$1" printf
+"$@" x=1 grep && readonly sed 'quoted text' x=1
+		local "$1" test readonly $(pwd)
+		printf && readonly export sed done export 'quoted text'
+x=1 "$1" cd then -eu
+		test /usr/bin awk 'quoted text'
+		$(pwd) printf readonly "$1" 'quoted text'
+		sed printf export cd awk
+	'quoted text' grep echo "$1" readonly awk "$@" export export then then
+test awk 2>/dev/null x=1 export
+printf x=1 awk echo test test
+test then "$@" then local
+echo "$1" printf --verbose local
+		done local "$@" cd done 2>/dev/null local echo readonly "$1" 2>/dev/null
+		cd /usr/bin then 2>/dev/null
+	| done 'quoted text' local export x=1 x=1 local x=1 readonly ${HOME} ${HOME}
+		readonly && grep sed 2>/dev/null
+		local | awk 2>/dev/null "$1" /usr/bin cd 'quoted text'
+	grep sed test $(pwd) 'quoted text'
+	$(pwd) awk readonly && local "$1" local echo 2>/dev/null sed --verbose
+	-eu export && --verbose 2>/dev/null -eu cd then readonly x=1 2>/dev/null
+$(pwd) awk ${HOME} echo ${HOME} /usr/bin
+	printf printf -eu --verbose awk done && "$1" "$@" grep grep && export readonly
+--verbose && export "$1" cd | echo -eu grep && awk
+	awk x=1 ${HOME} /usr/bin local
+${HOME} readonly | printf | echo awk sed /usr/bin then cd --verbose
+grep $(pwd) printf "$1" test "$@" 'quoted text' readonly
+	&& -eu local /usr/bin sed grep && done
+"$1" x=1 x=1 grep /usr/bin 2>/dev/null 2>/dev/null readonly done ${HOME} test
+	2>/dev/null x=1 then export ${HOME} cd printf awk
+	x=1 -eu awk 2>/dev/null printf printf $(pwd) test printf cd 2>/dev/null 2>/dev/null
+	"$@" "$@" | --verbose done local
+	/usr/bin export echo && local local export 2>/dev/null $(pwd) "$@" ${HOME}
+		"$@" "$@" && $(pwd) test sed
+		sed echo grep "$@" printf "$@" 2>/dev/null echo ${HOME} local -eu
+		/usr/bin readonly --verbose
+then $(pwd) $(pwd) "$@" export /usr/bin done readonly then "$1"
+	/usr/bin -eu $(pwd) -eu --verbose echo local --verbose "$@" 2>/dev/null
+local 2>/dev/null x=1 cd printf echo | 'quoted text'
+	--verbose export grep grep 'quoted text' printf
+		readonly grep local 'quoted text' readonly readonly /usr/bin
+echo --verbose $(pwd) 2>/dev/null -eu | export
+	-eu echo test local awk "$1" | /usr/bin sed
+	export $(pwd) echo cd ${HOME} $(pwd) ${HOME} x=1 awk ${HOME} | local
+	| --verbose 'quoted text' then done local echo echo ${HOME} /usr/bin "$1" local
+		| "$1" test printf "$1" x=1 /usr/bin
+		awk "$@" readonly test awk $(pwd) echo test readonly
+		$(pwd) export test 'quoted text' readonly sed sed --verbose done
+		grep sed ${HOME} "$1" ${HOME} "$1" "$1" "$1" | | /usr/bin done
+		-eu readonly printf "$@"
+		then then | "$@" && "$@" "$1" /usr/bin test readonly
+$(pwd) then | readonly local 'quoted text' x=1 ${HOME} done
+	awk sed done awk cd /usr/bin printf ${HOME}
+		readonly cd $(pwd) test 'quoted text' then
+		| awk 2>/dev/null --verbose 2>/dev/null printf sed
+	&& grep grep "$1" 'quoted text' ${HOME} awk && export readonly "$1" ${HOME}
+		2>/dev/null readonly && | "$@" local readonly done x=1
+		"$1" && $(pwd) --verbose && done && ${HOME} echo
+	echo sed x=1 --verbose printf
+	echo test done awk $(pwd) printf sed "$1" done awk "$@" done printf
+	test | then /usr/bin done 2>/dev/null printf cd /usr/bin /usr/bin export echo
+	test cd "$1" -eu local 2>/dev/null echo | readonly done
+-eu printf sed then 'quoted text' local sed printf && /usr/bin
+		done "$1" x=1 --verbose "$@" test $(pwd) ${HOME}
+echo echo readonly $(pwd) then
+	x=1 | -eu x=1 "$1" test ${HOME} sed test export -eu --verbose 2>/dev/null
+		test grep ${HOME} && local | grep cd | --verbose test echo done
+"$1" --verbose done awk /usr/bin
+	&& $(pwd) printf test "$@" done "$@" local readonly readonly local /usr/bin test
+		&& && 'quoted text' cd x=1 done 2>/dev/null $(pwd) awk
+| 'quoted text' echo "$@"
+	cd 'quoted text' test awk && --verbose awk "$1" $(pwd)
+		$(pwd) test "$1" --verbose awk
+	/usr/bin | x=1 $(pwd) done then 'quoted text'
+	echo | -eu then x=1 test sed "$@" && $(pwd) cd | export awk x=1 echo grep
+	"$1" echo grep /usr/bin grep 2>/dev/null local $(pwd) "$1" 2>/dev/null
+	| grep -eu sed /usr/bin export test $(pwd)
+$(pwd) x=1 x=1 cd grep -eu /usr/bin
+		&& done local "$1" test cd local cd export | -eu done 2>/dev/null
+	${HOME} "$1" readonly ${HOME} echo $(pwd) done --verbose
+	then --verbose 'quoted text' test $(pwd) awk && readonly /usr/bin export export
+	sed local awk /usr/bin | "$@" 2>/dev/null 2>/dev/null echo sed /usr/bin
+	| cd then sed ${HOME} --verbose done sed grep cd --verbose x=1 export
+	$(pwd) grep -eu awk -eu 2>/dev/null /usr/bin
+	| "$@" printf grep "$1" done
+		"$@" -eu awk 2>/dev/null 2>/dev/null
+		awk local awk cd cd printf $(pwd) echo
+	echo sed "$@" awk x=1 printf then 'quoted text'
+export | --verbose test test awk -eu
+then readonly grep $(pwd) -eu "$1" test | --verbose
+	$(pwd) export test echo | readonly export readonly "$1" then ${HOME}
+		printf sed then done "$1" $(pwd) ${HOME} printf sed export "$1" "$@" --verbose
+		2>/dev/null then done printf "$1" readonly $(pwd) test awk awk sed cd
+	"$1" cd done sed "$@" echo --verbose && $(pwd) then export
+		printf --verbose "$1" "$1" && echo test grep 'quoted text' 2>/dev/null
+	echo readonly done -eu 2>/dev/null x=1 cd 'quoted text' && x=1 cd
+/usr/bin "$1" -eu x=1 -eu done | -eu -eu sed 'quoted text' grep 'quoted text'
+		grep -eu $(pwd) awk 2>/dev/null "$@" "$@" sed 'quoted text'
+test local cd readonly -eu x=1 awk local x=1 "$1" "$@" local "$@"
+	2>/dev/null export readonly "$@" test grep then "$1" then ${HOME} sed --verbose
+"$1" printf --verbose cd $(pwd) "$@"
+	2>/dev/null x=1 done then --verbose ${HOME} grep grep && $(pwd) "$1"
+		$(pwd) "$@" x=1 then "$@"
+	local export cd ${HOME} then then cd 2>/dev/null 'quoted text' && grep awk
+cd "$1" export 'quoted text' test awk | --verbose "$@" test
+		local done cd done sed readonly then printf
+		'quoted text' "$@" x=1 x=1 "$@" 'quoted text' awk x=1 test then -eu
+	&& cd /usr/bin echo grep
+x=1 grep 2>/dev/null "$@" cd 2>/dev/null sed
+x=1 "$1" printf export local then grep 2>/dev/null
+| printf "$1" local ${HOME} local cd readonly "$@" -eu cd && -eu
+	x=1 printf "$1" ${HOME} cd readonly
+		awk test -eu cd "$1" -eu $(pwd) 'quoted text' export -eu local
+	sed $(pwd) --verbose grep local && then
+		2>/dev/null "$1" 'quoted text' awk | local && $(pwd) -eu then 2>/dev/null
+	local grep export -eu grep printf ${HOME}
+	then --verbose | readonly export 'quoted text' 'quoted text' test awk readonly
+		sed | test x=1 "$@" -eu | printf cd "$1" echo
+	done x=1 -eu grep | "$@" x=1 sed && $(pwd) x=1 done ${HOME}
+		printf | local ${HOME} 2>/dev/null | sed
+	| printf && 'quoted text'
+	then --verbose "$1" && grep ${HOME} cd
+readonly export local 'quoted text' test printf --verbose
+	done "$@" --verbose awk echo cd && |
+	echo then "$@" && --verbose -eu done printf awk && sed
+		-eu awk export 'quoted text' done --verbose local |
+		grep -eu test "$1" test export then "$1" printf echo 'quoted text'
+"$@" | | sed 'quoted text' readonly awk 'quoted text' awk
+	cd "$1" -eu sed x=1 'quoted text' && printf printf awk export readonly
+	readonly sed 2>/dev/null $(pwd) --verbose $(pwd)
+readonly then "$1" --verbose x=1 cd sed awk
+	export | --verbose test awk grep
+		echo sed x=1 export ${HOME} && readonly test -eu readonly awk readonly "$@"
+'quoted text' readonly awk test "$1" awk export local /usr/bin test awk local
+grep export cd test $(pwd) done | $(pwd) x=1 "$1" --verbose sed done sed sed
+		local printf export /usr/bin "$@" then
+		printf ${HOME} done cd "$@" ${HOME} test
+		--verbose test 'quoted text' --verbose 'quoted text' "$1" | grep
+	export 'quoted text' cd cd awk 'quoted text' cd cd "$@"
+awk done export grep 'quoted text' "$1" --verbose
+done ${HOME} printf --verbose /usr/bin -eu echo sed 2>/dev/null sed x=1 awk
+		'quoted text' 'quoted text' sed sed 2>/dev/null
+		| readonly ${HOME} awk 2>/dev/null
+		printf readonly local "$1" printf | /usr/bin
+/usr/bin local echo && readonly $(pwd) ${HOME} 2>/dev/null
+		&& grep x=1 sed grep "$@" 2>/dev/null "$@" awk
+-eu | "$@" echo "$1" grep 'quoted text'
+${HOME} test readonly $(pwd) readonly
+	'quoted text' awk readonly $(pwd) grep local
+	"$@" then -eu x=1 --verbose awk echo "$@"
+		done awk -eu grep $(pwd) grep export done 2>/dev/null
+		readonly then export then
+awk echo then test -eu export then done echo $(pwd) 2>/dev/null
+'quoted text' then --verbose && grep export local local cd grep 2>/dev/null
+		echo grep "$@" done sed x=1 local $(pwd)
+--verbose 2>/dev/null && cd printf readonly --verbose readonly grep
+-eu readonly awk test test then /usr/bin "$1" && -eu ${HOME} |
+"$@" echo ${HOME} ${HOME}
+	printf && grep export done cd ${HOME}
+		$(pwd) echo then --verbose cd "$@" done /usr/bin $(pwd)
+	then 2>/dev/null grep x=1 $(pwd)
+"$1" readonly printf x=1 readonly test awk test awk | && ${HOME}
+	'quoted text' grep "$1" $(pwd) 'quoted text' $(pwd) done | --verbose --verbose
+		cd | | "$@" "$1" 'quoted text'
+2>/dev/null | export "$1" sed --verbose
+		sed local then export -eu cd 'quoted text'
+		readonly /usr/bin export "$1" 2>/dev/null
+		x=1 "$@" export awk "$@" grep $(pwd) $(pwd) local
+	export done grep readonly readonly test &&
+	cd x=1 "$1" cd sed readonly /usr/bin readonly sed done --verbose
+echo printf export 2>/dev/null sed local | ${HOME} done awk x=1 --verbose ${HOME}
+	'quoted text' cd | printf echo -eu test echo ${HOME}
+$(pwd) test done echo | --verbose 2>/dev/null 'quoted text' then grep
+		test "$1" then /usr/bin --verbose readonly "$@" readonly
+&& grep 2>/dev/null then then "$1" cd test export 2>/dev/null "$1" awk ${HOME}
+local --verbose then echo cd ${HOME} --verbose "$1"
+		test then --verbose awk readonly awk cd
+local awk $(pwd) "$1" 2>/dev/null x=1 && local "$@" sed readonly
+		local "$1" "$@" readonly 'quoted text' $(pwd) export | done printf "$1" x=1
+	x=1 sed local readonly test sed 'quoted text'
+awk -eu test cd done printf test $(pwd) echo ${HOME} grep awk
+		/usr/bin grep --verbose
+then -eu test sed /usr/bin cd grep echo
+	"$1" cd | sed /usr/bin echo 2>/dev/null awk | | $(pwd)
+	export printf then | x=1 done grep x=1 'quoted text' local done
+		cd | local ${HOME} ${HOME} /usr/bin $(pwd) | "$1" x=1 --verbose cd local
+	grep export ${HOME} awk echo ${HOME} -eu test
+	&& && printf then grep -eu then | local $(pwd) x=1 local grep 'quoted text' echo
+	x=1 test 'quoted text' $(pwd)
+$(pwd) sed 2>/dev/null | $(pwd) sed awk
+	echo awk x=1 done 'quoted text' test printf readonly
+x=1 x=1 -eu printf sed ${HOME} "$@" "$@" awk --verbose
+sed printf awk local -eu sed export "$1" "$@" test grep
+		--verbose x=1 && --verbose done
+	printf local test echo export then -eu "$@" cd -eu /usr/bin export done
+		"$1" sed -eu done "$1"
+x=1 | -eu export readonly local done "$@" echo "$@" && ${HOME} then
+		x=1 x=1 awk $(pwd) $(pwd)
+test && "$1" "$@" && x=1 cd sed --verbose
+	done then "$@" grep -eu cd readonly cd
+grep 2>/dev/null cd -eu | 'quoted text' awk cd test test 'quoted text' --verbose
+export local /usr/bin echo export then echo echo -eu sed export
+		&& echo local cd cd 2>/dev/null && $(pwd) "$@" printf &&
+		echo | --verbose ${HOME} awk awk awk cd done done ${HOME} --verbose sed $(pwd)
+	local grep cd $(pwd) grep awk "$1" echo echo
+	readonly /usr/bin then ${HOME} 'quoted text'
+"$@" grep local test 'quoted text' sed x=1 $(pwd) "$1" done
+	${HOME} echo -eu "$1" done 2>/dev/null
+'quoted text' echo grep && readonly test
+		${HOME} "$1" && done cd sed --verbose
+local local "$1" "$1" | --verbose echo x=1 printf grep printf readonly
+	echo done --verbose 'quoted text'
+sed 'quoted text' cd && awk sed awk
+| done readonly /usr/bin | | "$1" /usr/bin
+	| sed awk sed x=1 && "$1" -eu readonly 2>/dev/null done grep /usr/bin 'quoted text'
+grep $(pwd) -eu awk cd then
+	sed test echo local | $(pwd) echo local export printf
+test && 2>/dev/null && ${HOME} grep 'quoted text'
+x=1 done sed ${HOME} ${HOME} then local 2>/dev/null "$@" sed ${HOME}
+	--verbose cd local test --verbose
+	test awk --verbose cd grep 2>/dev/null x=1
+	${HOME} grep ${HOME} printf readonly --verbose /usr/bin
+		--verbose ${HOME} awk x=1 local "$@" printf
+cd x=1 --verbose sed export 'quoted text' test echo echo local grep
+	test "$@" awk local sed grep
+done local then -eu && readonly grep done
+		printf $(pwd) echo "$1" echo export local test then | "$1" cd "$1" printf
+		${HOME} cd 2>/dev/null 'quoted text' x=1 /usr/bin test -eu export grep
+		-eu ${HOME} awk awk "$@" readonly
+| x=1 "$@" awk -eu x=1 x=1 && 'quoted text' grep echo 2>/dev/null test
+		--verbose /usr/bin export 2>/dev/null awk
+	cd 2>/dev/null printf /usr/bin | 'quoted text' x=1
+2>/dev/null "$@" && "$1" then echo then then 'quoted text' x=1 "$1" awk $(pwd)
+		test && ${HOME} test cd readonly test | local readonly sed printf
+&& --verbose grep printf $(pwd) done then $(pwd) "$@" cd | 'quoted text'
+grep 'quoted text' test -eu && "$@" grep --verbose printf grep printf
+	| $(pwd) /usr/bin -eu local
+		export -eu x=1 export then --verbose ${HOME} test then
+	--verbose done done | local && readonly -eu
+	readonly | "$1" /usr/bin export "$@" echo ${HOME}
+		2>/dev/null test printf sed echo export echo export then test
+	${HOME} then export x=1 $(pwd) 'quoted text' done
+		&& "$1" "$1" grep cd local 2>/dev/null "$@"
+	grep local 2>/dev/null local echo local local /usr/bin
+then test grep grep grep cd test
+	| readonly && done local -eu /usr/bin awk
+		test grep $(pwd) 'quoted text' --verbose grep 2>/dev/null
+		"$1" printf 'quoted text' sed local readonly readonly local "$1" $(pwd) 2>/dev/null
+readonly "$@" export x=1 readonly test
+	test "$@" x=1 export export "$@" awk $(pwd) $(pwd) --verbose
+		done test && echo readonly
+/usr/bin -eu printf ${HOME} 2>/dev/null done
+	--verbose done awk printf then sed --verbose --verbose
+	"$1" "$@" /usr/bin | readonly
+		&& 'quoted text' --verbose then "$@" --verbose printf --verbose
+	--verbose -eu echo 2>/dev/null
+${HOME} sed readonly 'quoted text' x=1
+	"$@" -eu readonly test cd sed "$@" "$1" $(pwd)
+	readonly $(pwd) echo cd "$@"
+echo local ${HOME} --verbose && echo done $(pwd) /usr/bin test
+		printf ${HOME} sed awk /usr/bin && done sed -eu printf x=1 sed $(pwd) ${HOME}
+2>/dev/null printf done 'quoted text' "$@" cd then test
+		"$@" sed readonly readonly cd
+awk --verbose && grep && ${HOME} -eu -eu |
+test ${HOME} export -eu done echo export sed grep test awk ${HOME} x=1 && done
+cd -eu readonly $(pwd) -eu "$1"
+awk --verbose x=1 | 'quoted text' && done cd test $(pwd) echo "$@" readonly x=1
+		cd ${HOME} && /usr/bin $(pwd) echo then x=1 x=1 'quoted text'
+$(pwd) awk 'quoted text' 2>/dev/null awk "$1" "$1" 'quoted text'
+	grep x=1 echo --verbose
+	awk then export $(pwd) "$@" printf sed done x=1 test $(pwd) done && done "$@" &&
+		export then x=1 -eu readonly echo
+	local grep cd 'quoted text' then test ${HOME} readonly sed
+		test "$1" sed readonly grep done test awk test echo
+	test x=1 /usr/bin then --verbose 2>/dev/null ${HOME} sed $(pwd)
+		"$@" printf then 'quoted text' ${HOME} then 'quoted text'
+	| ${HOME} ${HOME} 'quoted text' --verbose grep
+		"$@" done done -eu then "$@" cd 2>/dev/null
+		export --verbose echo export
+	export done ${HOME} done grep x=1 | then
+local echo local export local ${HOME} export
+		&& readonly && "$@" --verbose
+		cd x=1 sed "$1" readonly ${HOME} "$@"
+		echo cd local printf "$1" $(pwd)
+test echo sed 'quoted text' $(pwd) && x=1 | -eu awk x=1 local echo | done | sed
+	&& awk local test local cd readonly "$1" && -eu local ${HOME} &&
+		printf && && test x=1 /usr/bin test "$@" sed echo local | test grep
+		sed x=1 export 2>/dev/null echo 2>/dev/null $(pwd) && /usr/bin printf 'quoted text'
+		-eu local echo readonly test echo then $(pwd) "$1" && sed awk --verbose
+-eu && awk ${HOME} sed then echo &&
+		x=1 local "$@" sed test "$1"
+	local && grep /usr/bin $(pwd) awk sed grep
+	$(pwd) local 2>/dev/null local grep readonly
+		x=1 ${HOME} -eu sed cd test ${HOME} local /usr/bin x=1 /usr/bin
+	"$1" x=1 readonly readonly
+	$(pwd) 2>/dev/null | ${HOME} done 'quoted text' done then grep printf test awk
+		then sed then grep cd | printf 'quoted text'
+sed | 'quoted text' /usr/bin sed test "$@"
+		${HOME} then "$@" readonly "$@" grep --verbose
+'quoted text' cd export printf
+	grep "$1" --verbose readonly grep awk $(pwd) export test cd
+'quoted text' then --verbose --verbose printf -eu grep ${HOME} && export
+test $(pwd) readonly then 2>/dev/null
+		test local $(pwd) export x=1 --verbose local readonly ${HOME} done
+awk export /usr/bin ${HOME}
+		"$1" grep $(pwd) sed cd export
+	x=1 grep ${HOME} readonly awk "$@" 2>/dev/null printf -eu x=1 'quoted text'
+	--verbose export -eu && && | printf /usr/bin && readonly
+	printf -eu | test && echo then x=1 | | printf sed 'quoted text'
+		2>/dev/null done test cd test sed cd readonly export
+		sed cd printf then --verbose done -eu cd 'quoted text' export sed "$1" /usr/bin
+		x=1 /usr/bin readonly 'quoted text' 'quoted text' ${HOME} 2>/dev/null --verbose
+--verbose | sed 2>/dev/null local "$1" "$@" readonly export
+test printf | readonly printf sed /usr/bin
+	--verbose grep "$@" then test grep local 'quoted text' ${HOME}
+	"$1" && export | $(pwd) | -eu && echo --verbose test &&
+test readonly then "$@" $(pwd) | sed readonly "$1" local done printf done
+		"$@" /usr/bin "$@" export && --verbose --verbose then
+"$@" 2>/dev/null sed echo ${HOME} test | readonly
+	2>/dev/null done /usr/bin $(pwd)
+		"$1" 'quoted text' 2>/dev/null "$1" 2>/dev/null 2>/dev/null x=1 &&
+"$@" -eu grep local "$@" ${HOME} local "$1" test /usr/bin test cd -eu --verbose
+		'quoted text' ${HOME} then awk printf echo grep
+		export sed printf cd then done 2>/dev/null "$1" test && 'quoted text' echo
+	| $(pwd) sed echo local /usr/bin echo -eu local echo && test x=1
+	test 'quoted text' test
+readonly --verbose ${HOME}
+		then | printf && then "$@" echo -eu then printf printf | readonly "$1" /usr/bin
+		-eu local 'quoted text' cd export "$1" | cd | $(pwd) sed
+"$@" "$1" cd --verbose cd x=1 readonly local
+	test readonly 2>/dev/null sed --verbose "$@" then "$@" local then then
+	2>/dev/null ${HOME} -eu export readonly printf printf |
+	done grep $(pwd) cd local grep printf && printf awk ${HOME} x=1 done echo -eu
+	grep readonly local x=1 local export | cd then
+	printf 2>/dev/null export -eu -eu local test | 'quoted text' 'quoted text'
+		&& "$@" export sed | cd sed ${HOME}
+		-eu -eu "$@" --verbose then
+		&& "$1" local sed cd "$@" --verbose
+		${HOME} ${HOME} printf x=1 echo
+	x=1 local "$@" readonly readonly awk
+sed done "$1" -eu "$@" $(pwd) sed
+	"$1" echo -eu awk test readonly awk $(pwd) echo "$1" && && "$@" grep local
+	awk awk readonly local "$1" export readonly
+		"$@" export export 2>/dev/null "$@" printf done printf grep "$1" -eu readonly
+		$(pwd) awk export | readonly | /usr/bin
+		export awk "$@" "$1" "$@" readonly local --verbose | 'quoted text'
+		${HOME} local | export readonly awk
+	done "$1" cd test cd printf ${HOME} "$@" readonly
+		cd readonly export then $(pwd) $(pwd) export echo printf 2>/dev/null --verbose
+	x=1 sed -eu "$@" $(pwd) printf | /usr/bin && sed -eu --verbose sed export
+		export awk | printf cd echo x=1 export x=1 awk readonly -eu
+	grep cd && /usr/bin test printf export
+	| 'quoted text' awk -eu /usr/bin echo cd /usr/bin printf sed x=1 cd
+echo cd echo local printf sed /usr/bin /usr/bin export test && export "$1" 2>/dev/null
+		echo then && -eu printf test ${HOME} 2>/dev/null
+		$(pwd) && x=1 cd && "$1" --verbose -eu grep
+		"$@" 'quoted text' && done "$@" /usr/bin
+		"$1" export /usr/bin export 'quoted text' | readonly
+		echo printf 2>/dev/null readonly -eu printf
+	"$1" && 2>/dev/null done x=1 $(pwd) export /usr/bin
+		readonly local 2>/dev/null then x=1
+x=1 x=1 grep "$1" $(pwd) /usr/bin
+	grep local export echo "$@" 2>/dev/null readonly awk "$@" &&
+		printf /usr/bin $(pwd) local echo /usr/bin 'quoted text'
+	--verbose readonly 'quoted text' done readonly
+	export done then awk then x=1 done | /usr/bin printf
+		$(pwd) grep sed echo && cd |
+	"$@" export x=1 "$@" readonly --verbose echo local -eu readonly
+sed awk done awk sed "$@" && -eu test done cd printf awk
+		readonly awk "$@" x=1 "$1" echo export test /usr/bin -eu
+		--verbose ${HOME} x=1 | x=1 /usr/bin /usr/bin local done test
+printf printf cd echo -eu echo 'quoted text' --verbose x=1 "$@"
+		| && | /usr/bin && x=1 -eu | ${HOME} cd awk then ${HOME} printf cd
+test ${HOME} | && export $(pwd) | export -eu cd then
+$(pwd) 'quoted text' printf "$@" grep local export done
+		--verbose && awk ${HOME} readonly x=1
+	then test 'quoted text' x=1 echo ${HOME} awk printf
+echo done grep readonly export ${HOME} -eu awk -eu
+	"$@" sed "$1" -eu -eu | $(pwd) 'quoted text' --verbose done sed
+awk --verbose test 2>/dev/null 2>/dev/null local
+		then readonly test test | $(pwd) grep /usr/bin ${HOME} "$@" 2>/dev/null
+		2>/dev/null echo ${HOME} done export
+${HOME} printf sed | $(pwd) awk "$@" test then printf done
+	then x=1 $(pwd) readonly awk "$@" done export -eu /usr/bin then
+/usr/bin cd export grep "$1" local |
+		x=1 then 2>/dev/null echo
+	readonly $(pwd) $(pwd) done local export sed then local grep printf grep | ${HOME}
+		2>/dev/null && $(pwd) local printf --verbose grep then x=1 /usr/bin
+	grep sed 'quoted text' && export echo cd "$@" grep then
+	2>/dev/null cd cd local 'quoted text' sed -eu echo
+		| "$@" 2>/dev/null grep sed readonly && test readonly
+	awk 'quoted text' 'quoted text' && | /usr/bin then ${HOME} ${HOME}
+	cd "$1" local 2>/dev/null
+		${HOME} ${HOME} x=1 -eu -eu -eu
+	cd && -eu echo --verbose cd x=1
+	local done sed "$@" "$1" awk -eu 'quoted text' echo test cd
+		"$1" /usr/bin -eu -eu sed export 'quoted text'
+		printf export 2>/dev/null x=1 ${HOME} /usr/bin
+		"$1" echo 2>/dev/null ${HOME} readonly readonly $(pwd) 2>/dev/null
+	cd --verbose readonly -eu 2>/dev/null
+cd "$1" sed | readonly x=1 local export export test --verbose sed printf
+printf export export echo ${HOME} grep x=1 printf printf /usr/bin 'quoted text'
+local --verbose readonly test printf "$1" "$@" -eu test export
+grep cd cd ${HOME} 2>/dev/null cd -eu echo 2>/dev/null
+		printf && x=1 test ${HOME} sed 2>/dev/null $(pwd) -eu "$@" ${HOME} export cd --verbose
+x=1 'quoted text' local
+grep "$1" $(pwd) cd printf -eu --verbose -eu
+		/usr/bin /usr/bin sed echo /usr/bin local awk awk
+local | | && export local readonly
+	done echo ${HOME} | --verbose
+		then $(pwd) | sed test "$@"
+-eu "$@" cd --verbose local export printf local
+		awk grep && export printf local awk
+	x=1 --verbose sed then --verbose "$@" 2>/dev/null ${HOME} | test cd grep
+	cd 'quoted text' 2>/dev/null "$@" ${HOME} printf grep grep
+readonly sed ${HOME} cd local ${HOME} | -eu "$1" sed local
+	done grep 2>/dev/null && test grep printf cd readonly
+	sed --verbose --verbose done grep 'quoted text' "$1" x=1 sed sed echo /usr/bin
+		$(pwd) then cd awk export
+	"$1" printf -eu then ${HOME} --verbose 'quoted text' echo grep
+	/usr/bin test "$1" && x=1 local 'quoted text' ${HOME}
+$(pwd) done "$@" /usr/bin
+| --verbose $(pwd) cd && | grep 2>/dev/null "$@"
+	done echo -eu echo grep ${HOME} then | grep printf test "$1" grep awk
+"$@" && | --verbose local test local grep local
+then readonly "$1" awk -eu "$1" local && -eu export export test sed test
+	then sed export --verbose ${HOME} printf local $(pwd) then sed
+	-eu && awk && echo x=1 done && ${HOME} test printf printf
+	then printf awk printf test 2>/dev/null && readonly
+		'quoted text' /usr/bin "$1" --verbose sed x=1 local "$@" && grep test grep
+		echo sed 2>/dev/null test x=1 grep 2>/dev/null
+		awk local awk test "$1"
+	cd then 2>/dev/null -eu "$1" awk printf sed ${HOME} done
+-eu ${HOME} grep test then --verbose sed
+"$1" done x=1 "$@" echo local export cd $(pwd)
+	then | done $(pwd) "$@" $(pwd) ${HOME} readonly
+	| x=1 2>/dev/null "$1" | printf "$@" "$@"
+	done awk then echo $(pwd) awk x=1
+		export /usr/bin 2>/dev/null |
+		| /usr/bin -eu readonly test readonly /usr/bin readonly "$1"
+x=1 sed then echo sed "$@" && /usr/bin test -eu
+		local x=1 export readonly printf | cd /usr/bin 'quoted text' x=1
+		x=1 'quoted text' local $(pwd) done
+		printf cd /usr/bin local sed "$1"
+	then | echo echo test "$1" "$@" printf && $(pwd) cd
+cd x=1 awk && "$@" then 'quoted text'
+		cd 2>/dev/null done && $(pwd) "$1" cd -eu ${HOME} sed
+/usr/bin grep 2>/dev/null
+		| export 2>/dev/null 2>/dev/null
+	&& export export && export export echo awk test | "$@" --verbose local 'quoted text'
+export x=1 && done $(pwd)
+/usr/bin "$@" $(pwd) | 'quoted text'
+		readonly --verbose -eu grep export
+		&& /usr/bin /usr/bin "$@" /usr/bin local readonly ${HOME}
+	echo ${HOME} /usr/bin --verbose echo
+	"$1" awk echo ${HOME} local then grep -eu /usr/bin
+${HOME} done | 'quoted text' 'quoted text'
+		cd 'quoted text' sed readonly echo cd test 'quoted text' done | awk echo local
+		test local -eu readonly --verbose "$@"
+| ${HOME} ${HOME} done 2>/dev/null
+-eu "$1" local --verbose 2>/dev/null && | 'quoted text' $(pwd)
+	grep awk printf readonly | done "$@" /usr/bin test --verbose awk "$1" /usr/bin
+local export x=1 local echo "$1" 2>/dev/null done 'quoted text' x=1 --verbose
+	echo --verbose local done sed
+	local grep -eu | done 2>/dev/null 'quoted text' awk echo test /usr/bin
+		sed cd "$1" --verbose "$@" && --verbose local cd export 'quoted text'
+${HOME} sed | done cd "$@"
+		${HOME} -eu "$1" --verbose sed done $(pwd) && grep echo x=1 && "$@" cd --verbose
+	--verbose printf --verbose cd cd grep "$@" export then --verbose
+		cd --verbose printf | -eu --verbose sed
+		awk ${HOME} "$@" /usr/bin grep grep cd "$@" echo grep && $(pwd) printf
+	test export local x=1 cd x=1 --verbose grep sed done cd printf then printf
+readonly | awk printf 'quoted text' $(pwd) then "$1"
+--verbose done x=1 /usr/bin 'quoted text'
+		$(pwd) -eu "$1" cd sed export "$1" then grep -eu
+		"$@" && then local "$@" | sed "$@" echo local sed /usr/bin --verbose "$@" /usr/bin
+	2>/dev/null awk | --verbose "$1" | sed "$1" local cd export
+printf | && /usr/bin sed --verbose printf "$@" "$@" "$1"
+$(pwd) echo readonly /usr/bin "$@" test export then test
+	then -eu && sed -eu $(pwd) export x=1 && sed awk export -eu x=1 "$@" ${HOME}
+	readonly awk export local sed "$@" "$@" ${HOME} printf && local "$1" sed awk local
+		"$@" sed done /usr/bin test /usr/bin "$@"
+	--verbose cd test /usr/bin test /usr/bin sed done $(pwd) ${HOME} done
+echo -eu sed "$@" done sed
+	awk printf sed export x=1 readonly cd 'quoted text'
+/usr/bin | x=1 cd echo --verbose && --verbose /usr/bin x=1
+printf | /usr/bin "$@" echo test echo $(pwd) done
+		"$1" -eu 'quoted text' --verbose cd test | readonly test $(pwd) "$1" export &&
+test "$1" ${HOME} readonly printf
+	"$1" && && test && | echo readonly /usr/bin && readonly
+&& echo sed echo /usr/bin ${HOME} awk "$1" /usr/bin
+		done /usr/bin && && printf test printf grep 'quoted text' --verbose
+	done -eu 2>/dev/null 'quoted text' done sed echo local printf "$1" -eu awk "$1"
+	| grep && --verbose export test echo then
+		export && sed awk 'quoted text' "$1" "$1"
+printf test then sed readonly --verbose
+--verbose printf test grep
+'quoted text' readonly export $(pwd) "$1"
+#include c139.sh
+2>/dev/null export -eu printf -eu | sed -eu ${HOME} test awk
+	export readonly "$1" then done local
+	2>/dev/null cd "$@" --verbose
+export done local export export 'quoted text' -eu test
+		${HOME} 'quoted text' readonly 2>/dev/null $(pwd) local "$@" --verbose
+x=1 && 'quoted text' export printf cd /usr/bin test
+	'quoted text' test --verbose
+	sed then printf --verbose
+2>/dev/null readonly -eu && sed
+	then x=1 2>/dev/null cd
+		cd done test /usr/bin readonly /usr/bin /usr/bin readonly cd x=1 done "$1"
+	"$@" 2>/dev/null readonly "$@" echo x=1 && test sed 2>/dev/null
+		echo 'quoted text' local 2>/dev/null export awk 'quoted text'
+		"$@" "$1" 2>/dev/null --verbose /usr/bin
+		done printf then export awk export local && 'quoted text'
+/usr/bin local local 'quoted text'
+	local $(pwd) echo grep $(pwd) 'quoted text' cd sed
+	sed done x=1 ${HOME} --verbose cd /usr/bin
+'quoted text' readonly | "$1" grep $(pwd) --verbose readonly export
+	'quoted text' cd done -eu awk local local test cd x=1 "$@" $(pwd) cd
+	printf cd ${HOME} ${HOME} cd --verbose x=1
+		cd then ${HOME} awk cd -eu --verbose --verbose export $(pwd) printf
+	-eu 'quoted text' grep cd done local readonly "$1" ${HOME} then $(pwd)
+	x=1 readonly echo then x=1 ${HOME} echo grep --verbose sed --verbose
+	/usr/bin done /usr/bin local
+readonly --verbose echo -eu 'quoted text'
+sed && /usr/bin awk test 2>/dev/null
+		cd && export export test cd local readonly done
+		2>/dev/null x=1 echo echo x=1 -eu &&
+	printf 'quoted text' | done echo grep "$@" sed
+	echo 'quoted text' ${HOME} awk "$1" 'quoted text' echo
+	$(pwd) awk 2>/dev/null -eu then ${HOME} | readonly done 'quoted text'
+	'quoted text' then && "$1" -eu grep then && "$1"
+		2>/dev/null cd test && x=1 printf --verbose
+| grep done grep x=1 then cd x=1 local -eu && echo --verbose printf
+cd done -eu /usr/bin done --verbose cd --verbose awk -eu cd then cd ${HOME}
+then $(pwd) ${HOME} cd echo --verbose grep then | export local awk --verbose
+${HOME} -eu done ${HOME}
+	then /usr/bin && cd "$@" local cd 'quoted text' sed
+then test $(pwd) cd readonly "$1" --verbose ${HOME} "$1" cd
+--verbose x=1 2>/dev/null | cd | ${HOME} 2>/dev/null
+	done echo x=1 x=1 "$1" done grep done
+	-eu | test sed | "$@" local 'quoted text' test
+sed $(pwd) -eu echo cd readonly "$@" done --verbose echo export export
+2>/dev/null sed echo && then local && "$@" /usr/bin local $(pwd)
+		2>/dev/null 2>/dev/null $(pwd) echo "$@" 'quoted text'
+		"$@" export sed readonly | $(pwd) readonly
+readonly | "$1" test | test export --verbose "$1"
+	printf test local x=1 readonly ${HOME} x=1 x=1 test $(pwd) $(pwd) --verbose
+	done export sed done done x=1 readonly 2>/dev/null
+export done "$1" test x=1 "$1" grep -eu awk export
+	done $(pwd) --verbose "$1" printf "$@" 2>/dev/null "$@" cd sed
+	printf ${HOME} | local "$1"
+	done /usr/bin x=1 $(pwd) -eu
+	sed readonly test done | grep echo ${HOME}
+-eu ${HOME} -eu then $(pwd) then
+		-eu echo -eu awk printf done "$@" test printf | | test --verbose echo
+	| "$1" printf awk /usr/bin cd readonly && done then
+"$1" "$1" echo grep 2>/dev/null echo test test awk && x=1
+		readonly --verbose awk $(pwd) export "$@" -eu test grep echo
+grep --verbose /usr/bin 'quoted text' echo $(pwd) then 2>/dev/null echo test
+		"$1" cd $(pwd) echo $(pwd) $(pwd) cd 2>/dev/null $(pwd) sed 2>/dev/null
+echo cd ${HOME} awk done 'quoted text' done then 2>/dev/null grep awk
+export sed export /usr/bin | awk cd "$@" sed x=1 $(pwd) 'quoted text'
+	then printf | printf readonly "$@" "$@" x=1 cd "$@" | export printf awk test
+		--verbose cd 2>/dev/null done "$1" $(pwd)
+${HOME} x=1 printf done --verbose 'quoted text'
+	$(pwd) grep "$@" printf 2>/dev/null cd | grep export then sed
+| test 'quoted text' && | --verbose /usr/bin 'quoted text' grep
+local && readonly cd sed grep 2>/dev/null -eu $(pwd) x=1 test cd then test awk
+		printf | 'quoted text' awk 2>/dev/null "$@" awk -eu --verbose sed printf
+		readonly "$1" local then /usr/bin cd x=1 grep
+	sed done then echo printf -eu export -eu grep printf -eu sed /usr/bin
+-eu readonly done export "$@" then -eu then
+		"$1" x=1 export sed | "$1" ${HOME} | x=1 -eu test "$@" test
+		x=1 --verbose sed then | ${HOME} "$@" /usr/bin x=1 "$1" | local
+		--verbose -eu 'quoted text' export 2>/dev/null $(pwd) -eu /usr/bin
+		x=1 awk grep x=1 x=1 'quoted text'
+x=1 x=1 printf -eu echo local test 2>/dev/null ${HOME} grep cd 2>/dev/null
+local echo cd x=1 2>/dev/null echo
+	2>/dev/null echo --verbose echo echo -eu | $(pwd) done "$1" grep "$@" 2>/dev/null
+printf local echo local awk && 2>/dev/null sed -eu awk "$@" ${HOME}
+readonly test sed $(pwd) && /usr/bin "$1" ${HOME} echo local test
+	/usr/bin echo 'quoted text' export --verbose
+echo -eu grep 2>/dev/null ${HOME} grep -eu /usr/bin ${HOME} -eu done
+		done --verbose local readonly /usr/bin
+--verbose echo 'quoted text'
+	done local local -eu | local -eu ${HOME} /usr/bin | -eu /usr/bin
+printf cd x=1 /usr/bin && "$@" | echo 'quoted text'
+		printf x=1 && sed echo awk --verbose
+	echo echo readonly export test ${HOME} grep -eu local "$@" /usr/bin
+		sed -eu ${HOME} readonly done cd $(pwd) readonly "$1" test /usr/bin
+	2>/dev/null 2>/dev/null export | readonly cd printf local
+local then export "$1"
+	2>/dev/null 2>/dev/null readonly "$@"
+		cd -eu printf local /usr/bin |
+		/usr/bin -eu /usr/bin -eu grep "$1" local awk 'quoted text' --verbose --verbose
+		&& then grep done echo printf && export
+	${HOME} 2>/dev/null $(pwd) -eu sed /usr/bin 2>/dev/null
+printf done then --verbose done readonly cd 2>/dev/null | local 'quoted text' &&
+"$1" echo "$1" echo 2>/dev/null cd
+export readonly done sed x=1 ${HOME} grep -eu
+	done "$1" sed x=1 grep x=1 cd echo "$1" --verbose | test export -eu
+		"$@" export $(pwd) readonly /usr/bin | then "$1" sed x=1 export 2>/dev/null
+		then grep && x=1 | 2>/dev/null readonly
+cd "$1" | local "$@" "$@" ${HOME} x=1 2>/dev/null
+	${HOME} grep x=1 awk -eu then /usr/bin
+	awk done 2>/dev/null test echo ${HOME} test readonly sed 'quoted text' $(pwd)
+		grep -eu "$@" echo $(pwd)
+		-eu echo 2>/dev/null x=1
+		$(pwd) | 2>/dev/null -eu local $(pwd) grep test "$@" cd readonly -eu "$@"
+		awk echo done printf done x=1 done grep 'quoted text' grep done | "$@"
+grep ${HOME} grep done readonly grep export grep sed | awk awk -eu | cd then
+	cd then 'quoted text' "$1" && ${HOME}
+	printf x=1 done awk 'quoted text' 2>/dev/null
+	| | awk echo export 'quoted text'
+		/usr/bin -eu cd printf /usr/bin --verbose
+2>/dev/null 2>/dev/null /usr/bin "$@"
+export /usr/bin awk x=1 readonly 2>/dev/null echo "$1" --verbose 'quoted text'
+	then -eu | awk then done grep then x=1 && && echo 2>/dev/null
+		-eu cd done --verbose grep readonly local export sed && --verbose -eu ${HOME}
+	test "$1" $(pwd) $(pwd) test /usr/bin then 2>/dev/null
+2>/dev/null && 'quoted text' 'quoted text' printf echo $(pwd) grep done
+		| then ${HOME} awk then "$@" 'quoted text' -eu grep echo
+		done x=1 /usr/bin then readonly cd "$@" ${HOME} echo sed cd
+		-eu awk export $(pwd) then grep grep "$1" then cd | printf 2>/dev/null
+	grep export export printf 'quoted text'
+&& sed awk | "$1" cd echo -eu -eu 'quoted text' readonly
+local cd /usr/bin printf local $(pwd) --verbose
+		x=1 cd echo x=1 --verbose test awk /usr/bin
+${HOME} 'quoted text' cd
+		sed echo "$1" ${HOME} /usr/bin --verbose test readonly ${HOME} readonly -eu awk
+sed grep export x=1 2>/dev/null cd 2>/dev/null export awk grep readonly awk &&
+	local echo test $(pwd) local grep ${HOME} awk grep awk sed echo printf
+"$@" export export export awk echo local ${HOME} export |
+		${HOME} --verbose awk $(pwd) x=1 done --verbose local export readonly
+x=1 then ${HOME} --verbose --verbose x=1 printf local
+	grep awk then echo test ${HOME} export "$1"
+		x=1 "$@" -eu echo x=1 'quoted text' echo | -eu | 'quoted text' cd
+		"$@" "$@" ${HOME} /usr/bin then then then cd && printf ${HOME}
+	printf /usr/bin /usr/bin readonly grep "$@"
+		echo export readonly grep "$@" grep awk grep 'quoted text'
+	export export /usr/bin then x=1 export
+		&& export "$1" -eu "$1" then x=1 then $(pwd) cd $(pwd) ${HOME} $(pwd) echo
+	local grep grep 'quoted text' "$@" cd "$1" | 2>/dev/null sed --verbose awk readonly
+echo done then local "$1" /usr/bin sed 'quoted text'
+		then cd export sed printf
+		| "$@" /usr/bin then echo test sed test awk | local && printf 'quoted text'
+printf 2>/dev/null "$1" grep ${HOME}
+x=1 --verbose local ${HOME} export
+		--verbose | test "$@" ${HOME} $(pwd) ${HOME} && -eu ${HOME} export
+		| local local done 2>/dev/null grep "$@" && -eu readonly 'quoted text' -eu
+		sed && printf printf local cd grep printf && ${HOME} cd /usr/bin
+&& "$@" "$1" "$1" x=1 awk
+		awk 'quoted text' readonly sed $(pwd)
+	&& printf /usr/bin test 'quoted text' x=1 | && 'quoted text'
+	--verbose && && local 'quoted text' 'quoted text' cd ${HOME} -eu test
+	--verbose readonly -eu
+done local --verbose -eu awk grep then ${HOME} echo then x=1 /usr/bin readonly
+	local awk 'quoted text' "$1" /usr/bin readonly sed 'quoted text'
+cd cd && $(pwd) $(pwd)
+	"$@" 'quoted text' test done 2>/dev/null readonly
+--verbose export readonly ${HOME} ${HOME} awk 'quoted text' local /usr/bin
+local 'quoted text' done
+	export grep echo awk 2>/dev/null printf 2>/dev/null $(pwd) done
+'quoted text' sed 2>/dev/null
+&& test sed && then && ${HOME} "$1" test awk then test 2>/dev/null
+	"$1" local export done grep 'quoted text'
+echo | && readonly grep test "$1" | local 2>/dev/null "$@" /usr/bin
+sed 2>/dev/null | x=1 | 'quoted text' &&
+		"$@" /usr/bin printf x=1 | echo printf "$1" 'quoted text' /usr/bin grep printf
+	export "$1" done cd 2>/dev/null export
+	--verbose ${HOME} then sed $(pwd)
+done printf "$1" local 2>/dev/null test awk echo cd then
+		grep -eu ${HOME} sed readonly -eu
+		local cd printf /usr/bin 2>/dev/null $(pwd) "$1" -eu awk then readonly
+export 2>/dev/null then -eu
+		--verbose /usr/bin && cd then x=1 | test /usr/bin export export
+	"$1" cd local && then "$1" $(pwd) | done awk done local "$@"
+	local "$1" "$1" "$@" cd echo /usr/bin test "$1" -eu "$1" 2>/dev/null $(pwd) |
+		done /usr/bin then --verbose ${HOME} local awk cd echo done
+	/usr/bin export "$1" "$@" readonly
+grep -eu done done 'quoted text'
+		$(pwd) ${HOME} echo test
+	printf test test 2>/dev/null
+echo sed cd /usr/bin /usr/bin /usr/bin "$@" readonly then |
+		then $(pwd) export cd local echo
+		grep "$@" readonly local awk printf 2>/dev/null then ${HOME} then grep
+awk "$@" $(pwd) x=1 -eu awk "$1" ${HOME} test echo cd && grep local export
+		'quoted text' export ${HOME} test done sed --verbose cd local -eu local
+		printf | sed x=1 /usr/bin "$1" /usr/bin cd cd /usr/bin x=1 grep export && export
+	printf cd 2>/dev/null | done 2>/dev/null && | printf
+		cd 2>/dev/null 2>/dev/null cd printf
+sed sed printf 'quoted text' --verbose awk
+	/usr/bin grep sed /usr/bin cd
+	$(pwd) ${HOME} cd local "$@" $(pwd) test 'quoted text'
+"$1" test -eu --verbose -eu local ${HOME} readonly then --verbose
+	/usr/bin "$@" sed 2>/dev/null "$@" 'quoted text'
+		printf ${HOME} readonly local
+		awk 2>/dev/null test -eu test awk 2>/dev/null
+	then done "$@" cd readonly readonly awk x=1 -eu x=1 $(pwd) awk done x=1 'quoted text'
+cd -eu cd 'quoted text' | readonly printf
+		&& -eu && grep -eu 'quoted text' export x=1 printf /usr/bin 'quoted text' "$@"
+	/usr/bin awk | 2>/dev/null printf printf then
+		awk then echo test $(pwd) local
+	| local cd local 2>/dev/null -eu --verbose && 2>/dev/null echo
+&& cd printf $(pwd) echo cd && grep export readonly local printf done -eu x=1 /usr/bin
+		echo | sed $(pwd) /usr/bin "$1" "$@" grep
+		/usr/bin x=1 /usr/bin awk x=1 awk && grep sed 'quoted text'
+		cd cd readonly "$@" done cd cd then $(pwd) test
+		local awk export $(pwd) 'quoted text'
+		--verbose printf readonly printf -eu sed
+		done export readonly grep printf x=1 -eu printf "$1" /usr/bin cd echo test grep
+readonly done sed local done --verbose -eu printf | 'quoted text'
+	then test $(pwd) | 'quoted text' export then test done ${HOME}
+	then then 2>/dev/null -eu printf | awk export local
+		| awk cd then test 2>/dev/null printf "$@" --verbose cd "$1" local readonly sed
+done ${HOME} 'quoted text'
+		${HOME} awk readonly test
+	readonly /usr/bin && then $(pwd) "$@" sed 'quoted text' readonly | "$@"
+		echo readonly 2>/dev/null export done 'quoted text' 2>/dev/null
+awk --verbose | cd "$1"
+	${HOME} done 2>/dev/null "$@" ${HOME} "$1" | sed echo done then
+		echo --verbose $(pwd) "$1" --verbose ${HOME} "$@" test $(pwd) "$@" done
+	"$@" local x=1 then $(pwd) 2>/dev/null
+		x=1 --verbose 'quoted text' grep x=1 readonly readonly | sed
+		then | grep awk test && done | "$1" /usr/bin --verbose 2>/dev/null printf $(pwd)
+	echo "$1" && grep 'quoted text' && ${HOME} $(pwd) sed 2>/dev/null
+--verbose readonly done awk | echo then grep "$@" cd --verbose "$@" $(pwd) local
+	| done done printf local && awk
+'quoted text' export 'quoted text' done x=1 test readonly
+printf /usr/bin then --verbose "$@"
+		&& | then && done "$@" export local --verbose 'quoted text' awk readonly done sed
+	grep awk 'quoted text' export 2>/dev/null ${HOME} printf
+/usr/bin echo x=1 done "$1" echo echo done
+		grep | && grep --verbose "$@" "$@" $(pwd) echo awk
+	echo grep test "$1" ${HOME} export -eu awk sed "$1" awk readonly
+'quoted text' "$1" sed /usr/bin
+export grep 'quoted text' awk "$@" readonly | sed "$1" done
+		export echo done sed 'quoted text' "$@" echo -eu "$1" 'quoted text' --verbose
+grep --verbose 2>/dev/null "$1" then grep -eu grep done done
+local "$@" | --verbose | 2>/dev/null sed 'quoted text'
+	'quoted text' ${HOME} $(pwd) sed /usr/bin /usr/bin done awk then 2>/dev/null
+		"$1" && "$1" x=1 export done export
+	printf /usr/bin && cd $(pwd) echo printf cd -eu cd --verbose
+	grep | test awk grep cd --verbose readonly
+cd x=1 --verbose ${HOME} done "$1" test x=1 --verbose
+grep then awk -eu echo cd echo 2>/dev/null
+	&& echo sed /usr/bin export cd grep then /usr/bin export local sed echo
+	awk -eu test test "$1" $(pwd)
+	$(pwd) printf "$1" x=1 printf local
+done echo "$1" "$1" test --verbose sed grep echo $(pwd) grep cd local $(pwd)
+| export export x=1 echo 'quoted text' && done
+	${HOME} "$1" 2>/dev/null 2>/dev/null 'quoted text' local "$@"
+local x=1 done x=1 $(pwd) --verbose
+		echo x=1 'quoted text' test -eu x=1 then then && 'quoted text' done readonly
+		then then "$@" then local readonly 'quoted text'
+grep --verbose "$@" done 2>/dev/null | echo export printf awk
+		printf -eu -eu grep "$@" 'quoted text' && x=1 "$@" ${HOME} local /usr/bin
+export "$@" ${HOME} /usr/bin printf awk echo 'quoted text'
+		readonly | && 2>/dev/null "$@" ${HOME} echo printf x=1 readonly
+		grep sed export x=1 test
+	test /usr/bin $(pwd) sed readonly x=1
+		local 2>/dev/null | "$1" $(pwd) "$@" 2>/dev/null awk grep grep then
+		readonly --verbose -eu "$1" export ${HOME}
+export x=1 test 2>/dev/null readonly 2>/dev/null grep
+readonly x=1 local x=1 sed then then readonly "$@" | x=1 then sed "$1" ${HOME}
+	then -eu -eu /usr/bin 'quoted text'
+x=1 ${HOME} test --verbose -eu cd
+	echo export echo cd "$1" --verbose readonly x=1
+		$(pwd) --verbose 'quoted text' printf
+	then sed 'quoted text' grep 2>/dev/null
+		/usr/bin /usr/bin grep printf | done local echo && sed "$@" x=1 awk
+grep then test $(pwd) local x=1 done cd export -eu && /usr/bin grep ${HOME}
+		then "$@" ${HOME} 2>/dev/null
+		awk /usr/bin cd cd 2>/dev/null x=1 --verbose grep 2>/dev/null
+		cd grep -eu x=1 | $(pwd) awk test 2>/dev/null "$1" "$1" 2>/dev/null
+	export /usr/bin echo -eu cd local x=1 && && | | --verbose cd local grep --verbose
+	readonly "$@" sed 'quoted text' sed awk export "$@" ${HOME}
+		--verbose 'quoted text' awk echo
+	test done cd ${HOME} sed
+	sed readonly export local -eu sed "$@" /usr/bin --verbose -eu sed local
+$(pwd) sed grep "$@" sed -eu then done
+		cd -eu "$1" cd x=1 done 2>/dev/null test done 'quoted text'
+	cd ${HOME} local ${HOME}
+	then | awk ${HOME} local "$1" x=1 sed test -eu local && 'quoted text'
+	then $(pwd) ${HOME} local x=1 --verbose 2>/dev/null then printf $(pwd) ${HOME}
+		"$1" cd ${HOME} grep "$1" local "$1" x=1 "$1" x=1 x=1 test $(pwd) /usr/bin 2>/dev/null
+"$1" export test | /usr/bin cd readonly --verbose
+		"$@" then $(pwd) $(pwd) sed grep grep --verbose done -eu cd -eu "$1"
+cd done awk awk 2>/dev/null test test | | "$@" readonly test $(pwd) test local
+&& echo printf $(pwd) echo --verbose /usr/bin x=1 && test test 2>/dev/null
+		local cd grep export then then $(pwd) "$@" /usr/bin then && readonly
+	grep echo grep readonly /usr/bin
+	printf 'quoted text' -eu
+sed readonly "$1" awk test
+	done x=1 grep printf printf 'quoted text' then | sed $(pwd) test export
+		local export && /usr/bin cd -eu && done | awk
+		&& && test 'quoted text' ${HOME} ${HOME} sed "$1" test grep grep
+		"$1" grep "$1" local "$1" awk
+then 'quoted text' 'quoted text' awk awk "$@" ${HOME} done sed test printf
+	"$1" test done test --verbose --verbose
+	done export ${HOME} | /usr/bin "$1"
+	grep done "$@" x=1 grep test && $(pwd) sed | local "$@" local echo
+	'quoted text' echo sed ${HOME} local done && "$@" echo 'quoted text' 'quoted text'
+		'quoted text' export "$@" grep x=1 2>/dev/null then cd
+	test grep ${HOME} local echo 'quoted text' echo done then 2>/dev/null
+		&& echo 2>/dev/null $(pwd) /usr/bin sed 2>/dev/null echo && sed
+	&& ${HOME} "$@" readonly && 'quoted text'
+	-eu done x=1 test 'quoted text' "$@" cd 2>/dev/null && -eu x=1 |
+	awk readonly $(pwd) --verbose
+		"$1" sed cd cd $(pwd) done ${HOME} echo echo export
+		"$@" -eu grep done 2>/dev/null
+	x=1 /usr/bin printf /usr/bin $(pwd) printf && done grep done --verbose
+local -eu x=1 export 2>/dev/null
+export $(pwd) 'quoted text' grep echo x=1 "$@" export -eu $(pwd)
+		| "$@" && -eu "$1" /usr/bin readonly cd local
+printf && export /usr/bin 'quoted text' printf "$@" 2>/dev/null
+	/usr/bin "$1" "$@" then $(pwd) grep echo awk printf ${HOME} | x=1 awk grep
+	echo sed export readonly
+	export grep cd x=1 x=1 $(pwd)
+	grep export /usr/bin echo printf -eu "$@" /usr/bin "$1" test done export
+	sed export $(pwd) test export | "$@" echo && && 2>/dev/null "$@" &&
+	export test --verbose echo export 2>/dev/null
+		| 'quoted text' printf "$1" 2>/dev/null then done && /usr/bin
+done $(pwd) echo echo sed readonly awk x=1 local awk $(pwd) $(pwd) done readonly
+		--verbose test export grep local awk awk 'quoted text' "$1" x=1 -eu
+		/usr/bin local readonly local sed | sed test ${HOME} readonly
+test $(pwd) cd sed $(pwd) $(pwd) -eu /usr/bin
+&& cd sed export sed cd
+	printf printf ${HOME} done grep local x=1 x=1 "$@" readonly done readonly
+	printf x=1 "$1" "$@" -eu
+x=1 done 'quoted text' sed -eu readonly 'quoted text' test -eu
+	--verbose "$1" cd readonly
+		echo "$@" printf export local ${HOME} /usr/bin
+sed "$@" /usr/bin done then --verbose awk ${HOME} cd 2>/dev/null
+	&& export then readonly export
+"$@" test echo test "$1" done readonly
+		local && | local x=1 x=1 /usr/bin awk && grep 'quoted text'
+done ${HOME} sed --verbose test done
+echo awk then --verbose "$@" | printf
+	--verbose printf | cd grep --verbose cd --verbose echo --verbose
+		grep done x=1 readonly -eu | | -eu printf sed awk awk | 2>/dev/null
+export -eu "$1" --verbose 'quoted text' 2>/dev/null "$@" readonly && 2>/dev/null
+then sed "$1" x=1 "$@" cd 2>/dev/null "$@" awk 'quoted text' /usr/bin echo
+		-eu echo done cd 2>/dev/null /usr/bin --verbose
+	done printf sed $(pwd) "$1" x=1 --verbose then cd 2>/dev/null readonly ${HOME}
+then "$1" | -eu x=1 done export then
+	--verbose 2>/dev/null echo then done awk --verbose --verbose -eu printf "$1"
+| $(pwd) echo readonly sed cd /usr/bin
+	2>/dev/null | "$@" test grep export
+--verbose 'quoted text' readonly
+		printf test grep local then sed printf local then x=1 && && "$@"
+| echo $(pwd) | test readonly $(pwd)
+x=1 sed awk grep then cd x=1 | 2>/dev/null export echo $(pwd)
+	"$@" echo $(pwd) echo
+2>/dev/null 2>/dev/null ${HOME} then x=1 x=1
+		--verbose cd "$1" && --verbose "$1" --verbose test "$@" test $(pwd) x=1 local
+-eu sed 'quoted text' 'quoted text' x=1 | then /usr/bin
+2>/dev/null /usr/bin readonly awk 'quoted text' -eu test
+	'quoted text' $(pwd) $(pwd) 'quoted text' $(pwd) /usr/bin then test test /usr/bin
+'quoted text' $(pwd) | /usr/bin sed cd ${HOME} done --verbose
+	readonly | x=1 local done && /usr/bin printf printf export /usr/bin
+		printf export done done grep echo
+		done then then done printf echo "$1" $(pwd) then
+	grep $(pwd) ${HOME} /usr/bin $(pwd)
+	readonly | | local 2>/dev/null cd export && readonly readonly 2>/dev/null
+	x=1 x=1 | sed x=1 && sed $(pwd) ${HOME} readonly
+	--verbose $(pwd) sed test "$@" sed printf test | test then local then printf
+		done x=1 grep 'quoted text' x=1 'quoted text' test
+'quoted text' 'quoted text' "$1" -eu --verbose
+	local then -eu --verbose readonly $(pwd) awk $(pwd) -eu then test &&
+		$(pwd) --verbose "$1" &&
+/usr/bin export done cd | $(pwd) 2>/dev/null
+	&& "$@" done echo echo &&
+| | grep -eu 'quoted text' test $(pwd) sed 'quoted text' grep cd "$@"
+		-eu | -eu -eu awk export | --verbose cd && echo readonly grep | cd 2>/dev/null 2>/dev/null
+&& sed $(pwd) export printf export "$@"
+	test | 2>/dev/null readonly | "$@" | grep 2>/dev/null | echo -eu "$@"
+sed --verbose printf local cd readonly readonly then /usr/bin cd "$1" printf
+	"$1" printf "$@" "$1" export echo
+	x=1 grep done awk --verbose done "$1" 'quoted text'
+		--verbose 'quoted text' done printf printf | x=1 ${HOME} local && | export export
+	x=1 /usr/bin 2>/dev/null export -eu
+	export readonly | test local test test x=1 'quoted text' cd awk
+printf sed printf 2>/dev/null ${HOME} --verbose sed "$1" -eu sed 'quoted text'
+		${HOME} cd echo -eu done x=1 done && $(pwd) 'quoted text' readonly
+${HOME} && $(pwd) 'quoted text'
+	&& 2>/dev/null printf test local sed "$1" --verbose grep "$1"
+	| then sed --verbose && readonly && then --verbose | then awk ${HOME}
+local 2>/dev/null ${HOME} then sed "$@"
+		grep echo "$1" sed export "$@" awk x=1 export
+		awk cd $(pwd) awk then then "$@" "$1" echo "$1"
+then grep && /usr/bin done /usr/bin local "$@" echo printf awk grep done /usr/bin
+'quoted text' grep echo "$@" $(pwd) /usr/bin 2>/dev/null test
+test --verbose export /usr/bin --verbose echo /usr/bin sed | $(pwd)
+	done -eu -eu && export done cd readonly
+${HOME} /usr/bin /usr/bin printf x=1 printf $(pwd) then "$@" printf test test grep
+		--verbose awk printf grep "$1" awk echo x=1 sed awk
+		test sed /usr/bin "$1" local "$@" ${HOME} local sed && --verbose sed
+		grep $(pwd) "$1" 'quoted text'
+		awk local grep echo ${HOME}
+	awk 'quoted text' grep 2>/dev/null done cd | echo
+"$@" awk test /usr/bin
+		then grep awk grep done | local "$@"
+		done printf "$1" printf test 'quoted text' done
+--verbose test readonly test && 2>/dev/null readonly | export echo
+		then --verbose export echo
+		grep sed "$@" local sed 2>/dev/null | 2>/dev/null -eu grep /usr/bin
+		--verbose -eu done awk -eu | && --verbose "$@" then x=1 test local awk
+		$(pwd) 2>/dev/null readonly $(pwd) test test grep
+	x=1 "$1" --verbose --verbose x=1 test --verbose x=1 "$@" then -eu
+	awk 'quoted text' $(pwd) then readonly | && done
+printf "$@" 'quoted text'
+	readonly -eu cd test printf export 'quoted text' "$1" ${HOME} ${HOME}
+		export --verbose grep local && local export x=1 --verbose grep -eu
+${HOME} $(pwd) awk readonly
+awk then then test "$@" "$1" then 'quoted text'
+	"$@" ${HOME} $(pwd) && 2>/dev/null -eu 2>/dev/null
+		grep x=1 $(pwd) 2>/dev/null 2>/dev/null export && awk -eu export cd 'quoted text'
+		"$1" -eu ${HOME} $(pwd) | 'quoted text' "$@" --verbose
+x=1 then local | 2>/dev/null --verbose x=1 --verbose &&
+		readonly x=1 -eu sed | test --verbose && "$@" readonly
+"$1" done "$1" 'quoted text'
+		&& done readonly --verbose sed then printf grep 'quoted text' "$1" 2>/dev/null
+	done local cd awk awk -eu local 'quoted text' export printf
+${HOME} /usr/bin grep grep then "$@" 2>/dev/null cd 'quoted text'
+	| ${HOME} echo local grep test grep "$1" export && local then echo
+		printf 2>/dev/null $(pwd) --verbose
+	echo sed x=1 grep sed | | --verbose
+		${HOME} /usr/bin done sed export printf local sed readonly export 2>/dev/null
+	sed 2>/dev/null | 'quoted text' | 2>/dev/null awk "$@" 2>/dev/null
+		cd x=1 printf --verbose 'quoted text'
+		2>/dev/null | --verbose | 'quoted text' && --verbose && awk -eu 'quoted text'
+-eu echo "$@" "$1" test "$1" && ${HOME} cd sed -eu grep
+		&& 'quoted text' export then then export grep export sed /usr/bin sed grep
+	--verbose 'quoted text' --verbose local local -eu done "$@" x=1 echo sed
+		test echo 'quoted text'
+&& 2>/dev/null sed local 2>/dev/null -eu /usr/bin "$1" $(pwd)
+		echo echo && ${HOME} 2>/dev/null export
+| local -eu local readonly test readonly -eu "$@" && /usr/bin awk grep
+	test "$1" sed 2>/dev/null "$@" grep "$1" $(pwd) ${HOME} --verbose
+		awk $(pwd) echo grep readonly "$1"
+	local readonly ${HOME} then cd
+	grep && readonly --verbose $(pwd) x=1 | /usr/bin then 'quoted text'
+$(pwd) echo test local | awk | ${HOME} --verbose 'quoted text'
+		done export /usr/bin "$@" sed "$@" x=1 cd printf readonly $(pwd) x=1 --verbose
+	| $(pwd) $(pwd) 'quoted text'
+	grep 'quoted text' printf
+		&& grep local && 2>/dev/null echo | 'quoted text' test cd local
+	x=1 "$@" "$@" echo printf
+"$1" && $(pwd) "$1" 'quoted text'
+		${HOME} /usr/bin "$@" | sed ${HOME} awk $(pwd) printf
+export local awk local 'quoted text' x=1
+	printf "$@" "$@" | $(pwd) ${HOME} cd cd 'quoted text' echo $(pwd) |
+	export --verbose /usr/bin export "$1" readonly --verbose $(pwd) && | "$1" awk 2>/dev/null
+-eu test local awk sed $(pwd) "$@" sed $(pwd) export
+		printf echo local && && x=1 sed export 'quoted text' then -eu
+"$@" then grep /usr/bin | awk readonly grep -eu cd
+		'quoted text' grep awk "$@" x=1 /usr/bin awk then 'quoted text' then
+awk ${HOME} -eu test test local 2>/dev/null test /usr/bin
+	$(pwd) ${HOME} 'quoted text'
+export 'quoted text' 2>/dev/null done grep
+	local -eu cd awk | /usr/bin 'quoted text' x=1 echo cd
+export awk sed grep 'quoted text' 2>/dev/null
+		x=1 printf test /usr/bin grep x=1 cd x=1 $(pwd) readonly /usr/bin
+	done grep sed "$@" grep printf && | printf echo ${HOME} 2>/dev/null
+		local | /usr/bin x=1 grep then sed /usr/bin x=1 cd cd readonly 'quoted text'
+		cd test echo then | 'quoted text' grep readonly
+	-eu --verbose local -eu local
+		cd -eu test sed /usr/bin sed "$@" awk readonly
+/usr/bin then grep --verbose 2>/dev/null
+		done done "$@" readonly
+$(pwd) printf export test readonly test readonly export cd 2>/dev/null awk test
+		then 2>/dev/null then |
+grep /usr/bin $(pwd) readonly $(pwd) sed
+	export ${HOME} "$@" echo /usr/bin then awk "$@" awk local
+	export ${HOME} sed "$1" -eu printf echo 'quoted text'
+${HOME} ${HOME} awk then ${HOME}
+"$1" "$1" cd --verbose done "$@" then echo grep /usr/bin "$@" echo
+$(pwd) test 2>/dev/null printf --verbose cd awk --verbose
+	&& -eu 'quoted text' done then /usr/bin /usr/bin echo 2>/dev/null
+"$@" printf "$1" done x=1 readonly
+test sed done test grep "$@" 'quoted text' ${HOME} readonly | 'quoted text'
+		&& --verbose /usr/bin local readonly x=1 then local
+	readonly sed "$@" done cd 2>/dev/null "$@" 'quoted text'
+		-eu 'quoted text' | x=1 local --verbose
+		sed awk test ${HOME} "$1" x=1 cd printf --verbose
+	x=1 -eu echo sed grep sed | grep
+sed printf 'quoted text' grep ${HOME}
+	2>/dev/null grep grep x=1 "$1" 2>/dev/null ${HOME} | then grep | /usr/bin x=1
+test "$1" echo ${HOME} "$1" 2>/dev/null cd x=1 sed 'quoted text'
+grep "$1" sed printf awk 'quoted text' awk awk readonly
+	cd --verbose 'quoted text' | readonly echo
+		readonly local export x=1 --verbose
+		then local echo test export ${HOME} grep cd echo
+	/usr/bin ${HOME} printf
+-eu "$1" $(pwd) --verbose && &&
+	local ${HOME} readonly x=1 printf sed 2>/dev/null done awk readonly 'quoted text'
+	2>/dev/null --verbose x=1 &&
+		sed awk --verbose -eu sed readonly
+echo /usr/bin -eu awk sed
+		"$@" then /usr/bin local ${HOME} /usr/bin cd ${HOME} then
+--verbose 2>/dev/null ${HOME} export x=1 export echo
+--verbose ${HOME} printf
+		| 'quoted text' cd ${HOME} 'quoted text' printf test echo 'quoted text' local
+	| local 2>/dev/null -eu cd awk 'quoted text' readonly x=1
+		done cd sed echo --verbose grep $(pwd) cd done
+	-eu echo sed awk done then sed export sed awk | done test
+2>/dev/null export readonly printf grep x=1 readonly local -eu export
+awk "$1" --verbose "$1" export
+		/usr/bin && | $(pwd) echo 'quoted text' "$1"
+printf /usr/bin 'quoted text' 2>/dev/null test printf
+	sed readonly && then /usr/bin | | export echo ${HOME}
+		echo --verbose -eu sed | x=1 echo grep
+	test echo --verbose "$@" done echo 'quoted text' 2>/dev/null done -eu local
+echo /usr/bin printf sed done export && 'quoted text' printf
+	echo ${HOME} test x=1 local awk | "$1"
+		2>/dev/null "$1" 'quoted text' 'quoted text' ${HOME} awk "$@" && test x=1
+		| /usr/bin 2>/dev/null --verbose --verbose test /usr/bin awk printf local | then
+	readonly /usr/bin readonly sed 'quoted text'
+	export then && && 2>/dev/null test | x=1 sed local x=1 --verbose /usr/bin grep
+		export grep sed sed readonly test && $(pwd) local /usr/bin
+	local test grep test printf $(pwd)
+done readonly $(pwd) /usr/bin -eu "$1" local local
+	awk 'quoted text' --verbose cd printf
+		printf "$@" "$1" local "$@" test then | 'quoted text' then 2>/dev/null
+	'quoted text' x=1 /usr/bin
+"$1" "$@" ${HOME} --verbose export
+	${HOME} --verbose awk x=1 2>/dev/null ${HOME}
+		"$1" export && printf && -eu awk awk "$@"
+		"$@" x=1 'quoted text' --verbose export && export && echo local echo test
+		sed --verbose echo cd 'quoted text' readonly /usr/bin "$@"
+		&& --verbose && && echo 'quoted text' local
+2>/dev/null 'quoted text' --verbose $(pwd) ${HOME} printf done export then
+	'quoted text' 'quoted text' -eu
+	local export done local grep x=1 awk sed test && 2>/dev/null x=1 echo readonly --verbose
+		done "$1" then printf --verbose -eu 'quoted text' 'quoted text' sed local /usr/bin
+	cd then | -eu then awk 'quoted text' local /usr/bin /usr/bin readonly then "$@"
+	x=1 sed && -eu $(pwd) readonly local ${HOME} ${HOME} done
+		/usr/bin /usr/bin $(pwd) 'quoted text'
+test cd local local done 'quoted text' | 'quoted text'
+x=1 test grep done --verbose cd |
+cd grep local && && "$@" echo done "$1" then
+		2>/dev/null x=1 then ${HOME} -eu done awk && /usr/bin
+		local then $(pwd) | echo printf then echo
+		export readonly local cd grep --verbose
+	'quoted text' 2>/dev/null test test x=1 -eu sed printf cd x=1 printf
+	2>/dev/null local 2>/dev/null &&
+x=1 done -eu "$@" grep 2>/dev/null
+		| 2>/dev/null $(pwd) done cd 'quoted text' done
+		'quoted text' -eu 'quoted text' -eu --verbose export sed grep 2>/dev/null
+		printf 'quoted text' sed --verbose $(pwd) then awk 'quoted text' cd test
+		readonly cd -eu /usr/bin 2>/dev/null sed --verbose
+| "$1" "$@" echo $(pwd) done readonly awk done
+x=1 /usr/bin | --verbose 'quoted text' export
+	grep 2>/dev/null && && done then /usr/bin grep echo sed done then
+		-eu "$@" cd && x=1 local ${HOME} echo /usr/bin printf printf
+	'quoted text' then | awk 2>/dev/null
+	printf --verbose ${HOME} echo x=1 echo
+	'quoted text' printf printf "$@" readonly && /usr/bin
+echo "$1" grep test sed
+	local printf | && && | -eu export readonly 'quoted text' "$1" local
+	${HOME} $(pwd) awk x=1 "$@" readonly sed x=1 sed export
+	then $(pwd) $(pwd) export readonly sed && test printf local export then "$1" awk
+		export --verbose echo then x=1 && grep
+done && 2>/dev/null 'quoted text' export 2>/dev/null
+	${HOME} grep cd done awk 'quoted text'
+x=1 readonly && 2>/dev/null echo 2>/dev/null sed "$@" echo "$@"
+"$1" -eu export then -eu then 2>/dev/null
+grep awk ${HOME} cd 'quoted text' && | sed cd cd 2>/dev/null
+	export 2>/dev/null export 2>/dev/null "$@" && awk &&
+	'quoted text' local then 2>/dev/null test sed
+readonly echo $(pwd) printf cd readonly readonly grep printf export
+grep 2>/dev/null export grep $(pwd) local --verbose x=1 local
+	export readonly 2>/dev/null "$@" echo "$1" cd echo "$@" 'quoted text'
+grep "$1" grep sed ${HOME}
+	${HOME} readonly --verbose
+-eu test test echo readonly
+readonly x=1 | grep test && ${HOME} printf echo done
+-eu export export readonly
+then /usr/bin /usr/bin 2>/dev/null done export readonly
+	printf | ${HOME} test | done
+	--verbose local readonly sed ${HOME} export cd && grep $(pwd)
+		2>/dev/null awk ${HOME} "$@" 'quoted text'
+	${HOME} "$1" grep 'quoted text' "$1" local $(pwd) ${HOME} "$1" 2>/dev/null |
+test --verbose echo 'quoted text' --verbose 'quoted text' done then
+done done "$1" sed printf export /usr/bin echo test "$1" /usr/bin
+-eu cd 2>/dev/null local --verbose --verbose
+		test $(pwd) "$@" readonly && | $(pwd) --verbose
+		-eu 'quoted text' --verbose 'quoted text' $(pwd)
+test printf x=1 done x=1 readonly printf
+	/usr/bin readonly -eu 2>/dev/null ${HOME} ${HOME}
+		| sed --verbose ${HOME} && done awk 2>/dev/null -eu
+done | x=1 cd readonly 'quoted text'
+printf awk 'quoted text' local echo echo readonly -eu done done then sed $(pwd)
+	-eu --verbose export -eu printf local test readonly /usr/bin -eu 2>/dev/null
+	/usr/bin cd $(pwd) | export ${HOME}
+2>/dev/null grep then 'quoted text' ${HOME}
+	sed local | export echo --verbose
+		sed $(pwd) && grep $(pwd) 'quoted text' "$@" | sed /usr/bin
+		printf /usr/bin --verbose printf grep
+cd -eu -eu && test grep echo readonly echo 2>/dev/null -eu readonly --verbose
+	&& printf printf test test
+-eu 'quoted text' export 2>/dev/null x=1 cd then 'quoted text' echo
+		2>/dev/null echo sed printf sed awk $(pwd) /usr/bin -eu && && -eu
+	2>/dev/null 'quoted text'
+$(pwd) /usr/bin echo awk 2>/dev/null sed export
+		cd echo -eu x=1 -eu /usr/bin then --verbose
+		test done "$@" cd ${HOME} cd local x=1 -eu grep 'quoted text' export then |
+2>/dev/null 'quoted text'
+		"$@" $(pwd) && $(pwd) echo cd "$1" cd then test
+"$1" 2>/dev/null | x=1 export x=1 then
+done export /usr/bin ${HOME} $(pwd) echo $(pwd) $(pwd) --verbose local
+		done "$1" $(pwd) readonly done export test done then "$1" "$1"
+-eu 'quoted text' --verbose 'quoted text'
+		then export && printf x=1 'quoted text' printf test 2>/dev/null && readonly "$@"
+grep x=1 --verbose grep local ${HOME} awk echo "$@" $(pwd) "$@" "$@"
+		2>/dev/null readonly --verbose
+	printf cd sed && "$@" ${HOME} echo local test /usr/bin | export cd "$1"
+local readonly export "$@" &&
+printf export && test --verbose && then grep $(pwd) cd grep then $(pwd) printf
+		-eu printf "$1" then readonly cd cd "$1" then x=1 x=1
+		-eu --verbose x=1 --verbose $(pwd) x=1 ${HOME} grep x=1 "$@" 'quoted text'
+	sed -eu cd 'quoted text' printf grep ${HOME} grep local awk && sed echo local
+	&& awk "$@" /usr/bin export && 2>/dev/null local
+		${HOME} -eu test | done /usr/bin "$@"
+readonly 2>/dev/null awk readonly -eu "$1" echo $(pwd) local
+grep test 'quoted text' | "$1" 2>/dev/null x=1 $(pwd) -eu | readonly
+"$1" x=1 /usr/bin cd grep /usr/bin "$@" && readonly /usr/bin local
+grep "$1" local --verbose "$1" "$1" printf &&
+		then sed --verbose && local --verbose --verbose -eu local $(pwd) grep --verbose
+	sed | grep awk $(pwd) | export readonly "$1"
+		local test sed test 'quoted text' then -eu ${HOME} readonly
+		cd "$@" /usr/bin x=1 -eu sed done 'quoted text' "$@" 2>/dev/null 2>/dev/null
+	local x=1 && 2>/dev/null $(pwd) printf x=1 awk test "$@" && awk cd --verbose
+	| ${HOME} ${HOME} "$@" "$@" x=1 $(pwd) readonly -eu 'quoted text' $(pwd) awk
+		printf readonly test x=1 readonly echo $(pwd) "$@" readonly
+"$1" local test --verbose readonly
+then test export "$1" "$1" export then local echo printf cd export "$1"
+		-eu then 2>/dev/null
+grep then -eu -eu done $(pwd) test local 'quoted text' export
+test $(pwd) 2>/dev/null -eu readonly export |
+	"$1" export 2>/dev/null
+	"$@" x=1 "$@" test 2>/dev/null
+		$(pwd) local /usr/bin test 'quoted text' export export
+		${HOME} grep sed -eu grep 'quoted text' $(pwd) then "$1" --verbose
+then grep | "$@" then export 'quoted text'
+		awk --verbose && x=1 echo done
+	/usr/bin "$@" | 'quoted text' readonly sed "$@" "$1" awk printf grep x=1
+	"$@" awk cd ${HOME} 2>/dev/null export echo | 'quoted text'
+/usr/bin x=1 2>/dev/null awk x=1
+sed /usr/bin local "$1" export /usr/bin
+-eu echo 2>/dev/null /usr/bin x=1 /usr/bin local test /usr/bin "$1" printf done
+		cd "$@" awk done 2>/dev/null
+-eu then 'quoted text' --verbose /usr/bin echo local local done sed grep /usr/bin
+${HOME} then readonly x=1 ${HOME} local echo awk
+		readonly --verbose export local printf && test printf
+		done grep && echo --verbose
+	local sed -eu | echo 2>/dev/null && -eu then test test then cd printf local export
+	2>/dev/null ${HOME} -eu ${HOME}
+	'quoted text' grep | x=1 -eu readonly
+	2>/dev/null grep export done "$1" grep $(pwd) readonly test | done printf
+		| echo "$1" | printf sed 2>/dev/null --verbose -eu test && awk && awk sed 'quoted text'
+		x=1 printf "$1" readonly readonly awk &&
+	"$1" $(pwd) awk x=1 cd ${HOME} --verbose
+	grep $(pwd) && then awk test cd readonly "$1" x=1 /usr/bin
+		awk local cd test | "$@" test 2>/dev/null test
+	$(pwd) | && printf "$@" export --verbose
+		${HOME} echo -eu x=1 awk printf 'quoted text' cd export awk $(pwd)
+done done local done then
+	${HOME} awk && "$1" -eu | "$1" printf readonly
+	-eu echo done $(pwd) cd echo 2>/dev/null
+	printf "$@" cd printf local sed | readonly && ${HOME}
+test export --verbose grep echo done
+--verbose --verbose readonly "$1" x=1 done readonly 2>/dev/null | x=1 | test
+		readonly 2>/dev/null cd readonly /usr/bin
+	/usr/bin readonly echo local sed echo awk sed -eu local sed cd "$1" /usr/bin awk
+	"$1" | $(pwd) local local export 2>/dev/null printf
+	then readonly ${HOME} done grep done ${HOME} printf test sed "$@" done
+		cd test /usr/bin 2>/dev/null "$1" "$1" awk awk 2>/dev/null "$1"
+/usr/bin "$@" /usr/bin 'quoted text' --verbose then | --verbose x=1 | --verbose
+		"$1" 2>/dev/null /usr/bin "$@" 2>/dev/null done
+		readonly then "$1" /usr/bin -eu -eu "$1" && && "$1" $(pwd) printf readonly readonly
+	export $(pwd) local readonly 'quoted text'
+	awk 2>/dev/null --verbose && sed "$1" done |
+$(pwd) readonly sed /usr/bin
+	cd 'quoted text' export | $(pwd) -eu done 2>/dev/null "$1" "$1" readonly
+grep $(pwd) printf sed echo readonly
+	--verbose -eu local | && local
+	grep 'quoted text' "$1" $(pwd) /usr/bin printf
+sed awk /usr/bin echo && then | done 2>/dev/null
+	${HOME} test "$1" export printf test 'quoted text' test "$1" done 'quoted text'
+	echo $(pwd) readonly | cd test
+	done $(pwd) awk "$@" && && x=1 test cd then x=1 x=1 done /usr/bin "$1" ${HOME} test
+	cd echo sed sed /usr/bin --verbose readonly --verbose "$@" && then echo
+		grep 'quoted text' /usr/bin | sed && ${HOME} cd /usr/bin
+		$(pwd) --verbose sed "$1" && echo /usr/bin
+		/usr/bin -eu 'quoted text'
+awk done && sed printf -eu cd cd "$@"
+		'quoted text' /usr/bin echo "$@" echo awk grep -eu
+		printf -eu done readonly
+export x=1 export /usr/bin
+-eu /usr/bin -eu echo done local | "$1" | 'quoted text'
+		echo done -eu "$@" -eu printf "$1" cd test done export "$@" grep local --verbose
+	test 2>/dev/null awk "$1" -eu test ${HOME}
+--verbose printf "$1" x=1 'quoted text' "$@" readonly sed x=1 cd 'quoted text'
+		"$1" awk -eu --verbose --verbose "$1" | ${HOME} ${HOME} awk awk awk "$@"
+readonly /usr/bin grep /usr/bin "$1" export echo
+	readonly x=1 readonly local /usr/bin ${HOME} | local sed && sed "$@"
+/usr/bin --verbose then then printf awk done
+		"$@" awk then readonly | test "$1"
+		local 2>/dev/null then export | 2>/dev/null -eu
+	"$@" "$1" awk awk 'quoted text' then 'quoted text' "$@" x=1 cd 'quoted text'
+		test printf grep test test x=1 2>/dev/null
+		&& $(pwd) /usr/bin && export printf echo
+		&& done --verbose sed
+export cd "$@" readonly export x=1 --verbose && 2>/dev/null -eu
+		echo -eu readonly awk "$@" echo local test --verbose "$@" 2>/dev/null
+	| "$1" x=1 | -eu /usr/bin awk local ${HOME}
+		'quoted text' ${HOME} "$1" printf
+	2>/dev/null && test $(pwd) cd ${HOME} export ${HOME} ${HOME} 2>/dev/null $(pwd)
+		readonly done -eu local sed $(pwd) -eu ${HOME} "$1" 'quoted text'
+	'quoted text' printf then then 2>/dev/null
+		"$@" cd sed 2>/dev/null cd "$1" | -eu done readonly 'quoted text'
+--verbose 'quoted text' "$@" local -eu | then x=1 grep "$@" done "$1" then
+	/usr/bin x=1 ${HOME} 2>/dev/null
+		${HOME} printf -eu "$@" -eu echo done echo /usr/bin
+	cd 'quoted text' then then local export echo -eu awk export /usr/bin
+		| "$1" | sed export then
+	$(pwd) cd cd 'quoted text' test
+		test done then export grep ${HOME} printf 2>/dev/null
+	x=1 then "$1" test x=1 echo "$1" "$@"
+		2>/dev/null then "$1" ${HOME} grep -eu sed 'quoted text' done
+		echo cd awk readonly local readonly
+	| -eu --verbose done readonly export cd 2>/dev/null 'quoted text'
+grep --verbose then "$@" sed test printf x=1 then /usr/bin x=1 cd
+		"$1" local done export then && sed && cd | "$@" x=1
+		| 2>/dev/null printf -eu then
+		awk readonly grep then done sed 2>/dev/null export sed awk "$1" echo "$1"
+		'quoted text' /usr/bin | 'quoted text' awk echo readonly "$@" done grep
+		then awk cd cd sed x=1 $(pwd) local sed sed awk done && --verbose
+cd | echo grep 2>/dev/null done "$@" cd echo 2>/dev/null export cd
+		sed 2>/dev/null "$1" --verbose "$@" /usr/bin readonly echo 2>/dev/null x=1
+printf --verbose readonly echo
+sed ${HOME} x=1 /usr/bin test local awk
+${HOME} 'quoted text' "$1"
+		cd export "$1" cd echo awk 'quoted text' x=1 echo | 2>/dev/null
+	export && "$@" "$@" 'quoted text' /usr/bin sed 'quoted text'
+printf $(pwd) cd "$@" --verbose readonly "$@" printf --verbose export grep
+		&& ${HOME} --verbose | 2>/dev/null | -eu export 2>/dev/null printf
+		'quoted text' cd done printf
+		local done awk "$1" "$1" export
+test && | ${HOME} 2>/dev/null done echo sed
+	printf readonly awk grep printf /usr/bin local
+		${HOME} $(pwd) && echo test --verbose 2>/dev/null printf 'quoted text'
+	export x=1 | "$1" local | awk "$1" cd /usr/bin
+		$(pwd) printf "$@" echo printf "$1" then
+| x=1 --verbose 2>/dev/null sed $(pwd) awk | awk "$@" cd "$@" sed
+readonly grep test then test "$1" /usr/bin | --verbose --verbose
+	then 'quoted text' echo then export echo --verbose sed
+		--verbose then printf "$@" /usr/bin | local printf x=1 &&
+	${HOME} 'quoted text' "$1" /usr/bin x=1 ${HOME}
+	| readonly /usr/bin -eu &&
+	${HOME} printf then && local x=1 test 2>/dev/null --verbose && "$@" then
+		--verbose cd echo --verbose echo test test test then x=1 sed local
+"$1" ${HOME} export "$1" printf readonly && awk 'quoted text' grep then test test
+grep cd cd test done $(pwd)
+		local x=1 printf done "$@" grep echo done sed sed
+	2>/dev/null 2>/dev/null --verbose echo grep "$1" done -eu ${HOME} x=1 | /usr/bin
+x=1 done "$@" && grep "$1" then -eu 'quoted text' --verbose
+		x=1 x=1 printf -eu 'quoted text' "$@" printf
+	export "$@" ${HOME} -eu echo "$1" | cd export readonly --verbose
+local 2>/dev/null readonly printf printf |
+		| cd readonly echo grep 2>/dev/null "$1" 2>/dev/null
+echo readonly awk export "$1" | $(pwd) export local
+	export 2>/dev/null /usr/bin x=1 'quoted text'
+		| ${HOME} "$@" /usr/bin && -eu sed done && test $(pwd)
+	echo "$@" local 'quoted text'
+		printf awk 2>/dev/null 'quoted text'
+export grep --verbose $(pwd) -eu done done $(pwd) then
+	${HOME} test | local | awk 'quoted text' | grep $(pwd) grep /usr/bin echo ${HOME}
+sed /usr/bin "$@" && then echo $(pwd) && ${HOME} --verbose | "$1" ${HOME}
+| echo ${HOME} printf
+	local readonly && && && cd printf test done /usr/bin 'quoted text' ${HOME} x=1
+	grep readonly sed /usr/bin "$@" grep printf grep $(pwd) /usr/bin 'quoted text' $(pwd)
+x=1 2>/dev/null "$@" /usr/bin
+	x=1 done readonly | awk --verbose grep | then 2>/dev/null readonly | local
+/usr/bin grep 2>/dev/null -eu -eu cd sed readonly
+${HOME} printf | $(pwd) 'quoted text' local test printf 'quoted text'
+	done printf test then $(pwd)
+	-eu test x=1 printf "$@" printf sed x=1 x=1 -eu export $(pwd) "$@" echo &&
+		done sed --verbose /usr/bin
+'quoted text' x=1 x=1 done --verbose cd "$1" ${HOME} sed test echo
+		&& echo /usr/bin $(pwd) printf
+		--verbose 'quoted text' readonly "$@" local "$1" readonly grep --verbose
+		sed ${HOME} /usr/bin "$@" --verbose /usr/bin
+	echo 2>/dev/null grep done $(pwd) cd $(pwd) sed | /usr/bin export
+		"$1" | then && /usr/bin x=1 cd done "$1"
+	&& cd && grep "$1" sed local echo awk && done echo /usr/bin then
+	/usr/bin printf cd readonly readonly 2>/dev/null "$1" x=1 test
+	| | 'quoted text' readonly echo ${HOME} 2>/dev/null
+		echo local --verbose test -eu "$1" echo cd /usr/bin -eu sed $(pwd)
+		echo printf && cd 'quoted text' grep "$1" && x=1 awk
+	cd 'quoted text' -eu awk readonly
+		export grep readonly 'quoted text' | grep export /usr/bin printf export
+printf && /usr/bin test grep
+		awk --verbose x=1 2>/dev/null export test "$@" "$1" ${HOME} --verbose
+sed && readonly | printf readonly && sed x=1 x=1
+	-eu echo $(pwd) 2>/dev/null export
+/usr/bin 'quoted text' sed /usr/bin grep cd 2>/dev/null
+		done "$1" 2>/dev/null && x=1 echo x=1 printf then readonly readonly
+		export test "$@" echo sed awk /usr/bin test x=1 cd grep "$1"
+		test printf 2>/dev/null $(pwd) "$1" done /usr/bin /usr/bin x=1
+"$1" 'quoted text' && ${HOME} "$1" test 2>/dev/null "$@" x=1 sed done --verbose
+		local --verbose test 2>/dev/null 2>/dev/null /usr/bin export "$@" "$1" printf
+	--verbose 'quoted text' -eu cd
+	local local readonly done $(pwd) 2>/dev/null "$1" done test export
+printf awk test sed export test ${HOME} 2>/dev/null then | "$1" --verbose |
+		"$1" sed 'quoted text' $(pwd)
+/usr/bin test "$@" echo grep "$1" awk readonly --verbose local ${HOME}
+		&& awk then echo local 'quoted text'
+		$(pwd) 'quoted text'
+	"$1" "$1" test ${HOME} test "$1" 2>/dev/null export grep 2>/dev/null local
+	cd export echo --verbose then "$1" done "$1" grep x=1 $(pwd) 'quoted text' echo
+		test test | printf printf readonly export printf
+		$(pwd) /usr/bin 'quoted text' -eu 2>/dev/null
+	sed echo /usr/bin readonly grep "$1" ${HOME} /usr/bin 'quoted text'
+		2>/dev/null 2>/dev/null "$1"
+	echo $(pwd) cd cd x=1 sed ${HOME} awk -eu 'quoted text'
+		grep && test export && 'quoted text' local | x=1 printf done grep
+readonly "$1" "$1" done --verbose
+		printf printf echo "$1" && 'quoted text' 2>/dev/null cd "$1"
+		cd $(pwd) export x=1 2>/dev/null $(pwd) --verbose 2>/dev/null
+	grep "$1" awk | "$1" 'quoted text' ${HOME} --verbose "$1" test "$1"
+		test cd export 2>/dev/null -eu $(pwd) cd && /usr/bin cd | &&
+	echo 2>/dev/null echo x=1 export 'quoted text' --verbose
+	$(pwd) 2>/dev/null x=1 done x=1 awk
+	/usr/bin ${HOME} -eu grep grep 'quoted text' /usr/bin && test | test
+		sed "$@" done -eu $(pwd) printf "$1" $(pwd) echo x=1 "$@" sed
+echo printf -eu readonly
+	-eu echo readonly export
+'quoted text' 2>/dev/null readonly -eu && sed "$1"
+	readonly "$@" /usr/bin local && export printf && /usr/bin x=1
+	sed x=1 -eu /usr/bin /usr/bin then -eu cd
+		2>/dev/null then -eu "$1" local sed /usr/bin | 'quoted text' x=1 readonly
+	| /usr/bin local && --verbose x=1 test printf /usr/bin &&
+$(pwd) awk 2>/dev/null "$@" -eu cd cd "$@" --verbose
+	-eu -eu local awk /usr/bin sed --verbose export sed local
+"$1" cd $(pwd) --verbose 2>/dev/null
+		${HOME} -eu local | awk
+printf printf done local sed echo local "$@" | test done sed /usr/bin done --verbose
+		export --verbose readonly 2>/dev/null
+	${HOME} cd cd export awk | grep printf "$@"
+		&& "$1" && && 'quoted text' "$@" export "$1" local
+| readonly "$1" "$@" sed "$1"
+"$1" echo /usr/bin --verbose
+	'quoted text' && x=1 echo "$@" grep "$1" /usr/bin then echo && test 'quoted text'
+		cd | readonly 2>/dev/null ${HOME} grep
+	readonly "$@" export readonly
+	cd "$@" 'quoted text' --verbose -eu
+x=1 done sed 'quoted text' "$@" grep x=1 "$1" 'quoted text' "$@" readonly
+	"$1" test test local --verbose
+grep awk echo --verbose printf done local x=1 'quoted text' test x=1 local export
+then "$@" sed readonly grep /usr/bin && done grep cd ${HOME} | export &&
+	| readonly cd $(pwd) awk readonly 'quoted text' grep
+export ${HOME} "$@" done local -eu sed | readonly echo
+'quoted text' done printf && 'quoted text' test readonly
+		cd export readonly done echo cd x=1 && 'quoted text'
+export && | -eu ${HOME} then
+	printf export -eu cd readonly 'quoted text' test
+	readonly 'quoted text' "$@" awk
+'quoted text' test 'quoted text' sed test then printf 2>/dev/null
+	"$@" 'quoted text' 2>/dev/null printf ${HOME} export /usr/bin readonly 2>/dev/null
+	grep test "$@" x=1 cd 2>/dev/null "$1" export x=1 awk export /usr/bin echo 'quoted text'
+sed | "$1" awk $(pwd) 2>/dev/null then readonly /usr/bin
+sed | $(pwd) awk /usr/bin ${HOME} readonly echo -eu echo
+--verbose test sed 2>/dev/null export echo then
+readonly local readonly 'quoted text' local printf 'quoted text'
+	| local grep awk "$@" 'quoted text' local test "$@" printf --verbose && test
+	sed local sed "$@" ${HOME} | && 'quoted text'
+		done "$1" ${HOME} /usr/bin cd ${HOME} 'quoted text' $(pwd) cd printf cd
+done && grep --verbose test
+		${HOME} sed $(pwd) 'quoted text' | && 2>/dev/null &&
+	"$@" sed $(pwd) grep readonly -eu --verbose x=1 "$1" ${HOME} test printf
+		"$1" done test export done grep printf
+	'quoted text' printf done cd "$@" && echo
+		sed grep /usr/bin cd && "$1" "$@" done ${HOME}
+grep && 2>/dev/null grep readonly "$1" test cd ${HOME} awk 2>/dev/null
+		cd cd -eu 'quoted text' grep "$@" "$1" --verbose | /usr/bin x=1
+	2>/dev/null | && done cd local done local awk 2>/dev/null
+${HOME} ${HOME} | awk sed sed awk cd
+	test -eu /usr/bin sed echo printf done then | x=1 local export "$1" x=1 then
+grep "$@" export export ${HOME} && grep then
+| then cd --verbose ${HOME} /usr/bin
+		| /usr/bin 2>/dev/null done "$@"
+	-eu ${HOME} export awk export done 2>/dev/null done 'quoted text'
+		'quoted text' cd | local $(pwd) 2>/dev/null x=1 "$@" grep
+	done "$@" --verbose done cd -eu printf -eu printf && "$1" then "$1" && printf
+		sed awk test cd ${HOME}
+		local awk then printf printf then
+		local /usr/bin sed --verbose
+		echo ${HOME} printf && "$1" grep "$1" sed echo x=1 && awk 'quoted text' /usr/bin
+	cd export local cd local "$@" readonly awk $(pwd)
+		echo "$@" done | export local $(pwd) done 'quoted text' "$1" && ${HOME}
+	readonly local /usr/bin -eu "$1"
+		"$@" 'quoted text' "$@" export
+		"$1" local sed awk -eu | export ${HOME} then | "$@" ${HOME} cd done $(pwd)
+		done printf -eu done echo cd 2>/dev/null then --verbose | readonly echo | ${HOME}
+	'quoted text' done -eu $(pwd)
+x=1 sed -eu -eu && ${HOME} "$1" then done $(pwd) 'quoted text'
+	grep "$1" then "$1" awk | export awk /usr/bin
+done --verbose "$@" then $(pwd) -eu /usr/bin x=1 echo 'quoted text'
+		/usr/bin && grep test then grep echo 'quoted text' test
+		grep cd "$1" echo $(pwd)
+test cd done then then 'quoted text' $(pwd) export then ${HOME} test
+		'quoted text' local local awk then awk echo 2>/dev/null
+		| local cd then echo echo done ${HOME} --verbose
+	local test export ${HOME} test 2>/dev/null "$@" x=1 ${HOME}
+2>/dev/null test export -eu export readonly local -eu
+		2>/dev/null x=1 then |
+	cd sed echo done local then "$@" sed then x=1 2>/dev/null readonly "$1" x=1
+		local $(pwd) local printf printf cd && printf then done done
+	grep echo awk cd && sed -eu test 'quoted text' test local grep 2>/dev/null
+		sed sed /usr/bin 'quoted text' readonly done awk 'quoted text' $(pwd) printf then
+		readonly "$@" $(pwd) local "$@" done
+/usr/bin then -eu readonly
+		--verbose "$1" "$@" printf /usr/bin awk readonly
+	readonly "$@" 'quoted text'
+done "$1" export local -eu 'quoted text' "$1" test
+cd export grep printf "$1" $(pwd) "$@" grep 2>/dev/null
+then export --verbose ${HOME} local
+	/usr/bin 2>/dev/null
+	echo "$@" export test grep then "$1" sed "$@"
+	&& then ${HOME} sed "$@" readonly -eu done readonly
+then | && --verbose $(pwd) export cd readonly readonly x=1 "$1"
+${HOME} readonly echo awk awk
+awk grep 'quoted text' local x=1 then 'quoted text' echo $(pwd) printf
+$(pwd) -eu --verbose --verbose echo "$@" | echo | export export
+		export $(pwd) done --verbose && sed printf cd "$1" x=1 2>/dev/null -eu
+| "$1" $(pwd) test -eu -eu
+	then && local x=1 cd awk -eu grep
+local /usr/bin /usr/bin "$@" printf awk
+	export ${HOME} readonly echo
+'quoted text' && printf test --verbose cd test printf $(pwd)
+	test test then 'quoted text' 'quoted text' printf readonly printf
+	cd local "$1" --verbose 'quoted text' then readonly readonly sed --verbose
+		then ${HOME} $(pwd) --verbose export "$1" "$1" -eu ${HOME}
+	$(pwd) done "$@" 'quoted text' "$1" readonly cd
+	/usr/bin readonly 2>/dev/null export -eu && -eu cd && printf grep done -eu "$@"
+		x=1 ${HOME} printf 2>/dev/null awk echo &&
+	awk awk readonly printf
+		${HOME} cd test 2>/dev/null --verbose echo awk export grep then echo
+	cd echo done 2>/dev/null then "$@" cd x=1 ${HOME} awk
+	echo awk "$@" then sed -eu
+		export printf done | test x=1 | echo $(pwd) cd local sed
+		$(pwd) local 2>/dev/null /usr/bin
+		$(pwd) "$@" "$1" $(pwd) -eu then
+		2>/dev/null -eu --verbose 'quoted text' $(pwd)
+		/usr/bin | export $(pwd) && -eu sed
+	&& ${HOME} done cd "$1" grep x=1 printf $(pwd) ${HOME} awk printf grep
+	${HOME} && export /usr/bin && --verbose /usr/bin "$@" "$@"
+	$(pwd) "$1" awk && --verbose x=1 done x=1 local
+		${HOME} 'quoted text' 2>/dev/null
+export export cd local readonly local
+echo && "$@" -eu --verbose echo readonly cd printf && /usr/bin
+	echo printf done "$1" echo | grep x=1 -eu awk done -eu test readonly
+sed awk cd cd export x=1
+	"$1" | echo cd then --verbose grep printf grep
+sed $(pwd) done 2>/dev/null "$1" && | awk awk x=1 echo x=1 x=1
+	-eu awk "$1" /usr/bin local awk "$1" readonly echo
+		/usr/bin then export --verbose | grep -eu ${HOME} | x=1 ${HOME} export
+done -eu done && awk --verbose
+	-eu "$@" --verbose then then then test --verbose
+	then ${HOME} $(pwd) --verbose
+		&& ${HOME} sed echo cd readonly export /usr/bin echo export test
+		"$@" | local grep $(pwd) echo local | export then ${HOME}
+printf && x=1 -eu awk done then ${HOME} /usr/bin -eu
+${HOME} local test grep test "$@"
+	readonly 'quoted text' grep && x=1 readonly cd readonly sed then --verbose
+		cd "$1" 'quoted text' export local sed test echo sed local "$1"
+	readonly awk then "$@" ${HOME} x=1 "$1" test "$1" echo x=1 sed --verbose
+-eu /usr/bin export ${HOME} "$@" /usr/bin 'quoted text'
+grep $(pwd) x=1 && echo -eu "$1" done grep -eu
+&& done "$1" printf /usr/bin
+sed grep $(pwd) sed "$1" --verbose local cd done sed test | && &&
+		sed ${HOME} awk "$1" sed printf | ${HOME} --verbose
+		&& 2>/dev/null export test readonly readonly grep sed then readonly awk 2>/dev/null
+	cd awk awk export readonly
+	-eu awk awk printf 'quoted text' cd "$1" /usr/bin export
+		grep "$@" $(pwd) "$@" && "$@" cd
+		| sed awk "$1" grep 2>/dev/null
+echo /usr/bin ${HOME} "$@" done printf x=1 local
+/usr/bin awk --verbose local 'quoted text' awk --verbose cd grep printf test
+	/usr/bin x=1 -eu 'quoted text'
+	/usr/bin /usr/bin then readonly -eu printf /usr/bin
+readonly export test --verbose -eu x=1 cd grep readonly -eu sed && done --verbose
+--verbose done "$@" && awk /usr/bin export readonly
+"$@" $(pwd) | export $(pwd) | 'quoted text'
+awk sed --verbose printf cd | | readonly 2>/dev/null 'quoted text'
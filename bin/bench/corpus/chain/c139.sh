@@ -0,0 +1,2001 @@
+printf 2>/dev/null awk sed test -eu x=1 -eu -eu && /usr/bin
+		echo then -eu cd done awk "$@" sed ${HOME} |
+readonly $(pwd) --verbose | sed printf -eu | grep grep then 2>/dev/null
+		/usr/bin && "$@" "$1" "$@" printf printf -eu
+		2>/dev/null local && grep 'quoted text'
+cd printf sed readonly readonly --verbose then ${HOME} local "$@" && sed
+'quoted text' 2>/dev/null done readonly --verbose export awk ${HOME}
+local /usr/bin -eu local export --verbose /usr/bin $(pwd)
+echo echo 2>/dev/null --verbose --verbose
+	done 'quoted text' ${HOME} "$1" -eu done "$1" "$1" x=1 readonly
+grep x=1 'quoted text' ${HOME} /usr/bin $(pwd) && 'quoted text'
+		| done $(pwd) $(pwd) --verbose 2>/dev/null echo cd awk done readonly export
+		$(pwd) x=1 -eu export "$1" $(pwd) then then /usr/bin awk
+		awk awk readonly export -eu then -eu 'quoted text'
+test done echo printf "$@" $(pwd) echo --verbose && echo
+	-eu done awk /usr/bin awk 'quoted text' "$1" "$@" then $(pwd)
+	grep export "$1" x=1 "$1" 'quoted text' grep
+readonly local 2>/dev/null 2>/dev/null 2>/dev/null "$1"
+	"$@" "$1" printf echo readonly
+		cd -eu sed && -eu cd done | echo && "$1" 2>/dev/null
+'quoted text' ${HOME} x=1
+	echo -eu --verbose readonly $(pwd) test 'quoted text'
+	"$1" sed done 'quoted text' 'quoted text'
+		&& x=1 -eu sed grep local "$@" "$1" && "$@" x=1 'quoted text' awk cd
+"$@" awk readonly echo 'quoted text' cd x=1 readonly 'quoted text' /usr/bin
+test sed ${HOME} awk echo echo 'quoted text' printf $(pwd) 2>/dev/null
+		local 'quoted text' --verbose /usr/bin && readonly 2>/dev/null
+		printf printf sed /usr/bin "$@" awk
+		-eu sed sed -eu printf --verbose && grep | printf grep test x=1 readonly "$1"
+/usr/bin echo ${HOME} /usr/bin then local /usr/bin local /usr/bin
+		-eu 'quoted text' grep
+&& $(pwd) printf then x=1 2>/dev/null ${HOME} | --verbose then
+		awk | "$@" done readonly 2>/dev/null
+local $(pwd) cd "$1" -eu printf cd export printf readonly printf
+	'quoted text' "$1" echo awk export then -eu
+${HOME} printf awk 2>/dev/null test -eu x=1 $(pwd) && ${HOME}
+	export test grep $(pwd) $(pwd) x=1 -eu && && cd then grep 2>/dev/null
+		done ${HOME} echo x=1 cd printf local sed
+		'quoted text' 'quoted text' "$1" awk 2>/dev/null
+		sed 'quoted text' | done 2>/dev/null
+&& --verbose local && "$1" export 'quoted text' echo 2>/dev/null
+cd echo then test sed | export done
+	printf echo -eu printf $(pwd) "$@" cd awk
+		echo local | | /usr/bin grep done | ${HOME}
+	--verbose echo "$1" sed ${HOME} printf && echo x=1 x=1 grep cd $(pwd) 2>/dev/null
+export -eu && x=1 export
+	$(pwd) x=1 && 2>/dev/null 'quoted text' ${HOME} && echo --verbose done x=1 'quoted text'
+		/usr/bin ${HOME} $(pwd) sed then then -eu test &&
+	printf grep -eu sed then printf $(pwd) ${HOME} test readonly | export readonly
+export grep echo printf printf "$1" 'quoted text' -eu
+awk done ${HOME} echo 2>/dev/null $(pwd) && && -eu export
+		${HOME} 2>/dev/null /usr/bin $(pwd)
+$(pwd) 'quoted text' done /usr/bin grep export /usr/bin
+-eu sed test 2>/dev/null then /usr/bin && then /usr/bin export
+		${HOME} 'quoted text' /usr/bin
+	awk "$1" grep $(pwd) x=1 grep ${HOME} awk then ${HOME} awk "$1" 2>/dev/null
+	export test x=1 local 2>/dev/null /usr/bin
+	awk awk export test sed --verbose
+	/usr/bin echo && test -eu then echo sed x=1 echo | /usr/bin echo done printf
+"$@" && grep export echo test awk "$1" printf 'quoted text' readonly --verbose
+awk 'quoted text' echo echo 2>/dev/null ${HOME} grep printf -eu
+		then ${HOME} "$@" 'quoted text'
+	awk /usr/bin sed awk -eu awk printf && "$1" local --verbose printf
+x=1 awk ${HOME} printf readonly awk -eu local 2>/dev/null 2>/dev/null awk
+	done printf printf cd 2>/dev/null $(pwd)
+export readonly then "$@" printf | "$@" grep test grep grep "$1" $(pwd) sed
+&& test "$1" ${HOME} printf cd cd x=1 readonly /usr/bin
+		-eu x=1 /usr/bin "$@" 'quoted text' done export awk
+		--verbose x=1 "$@" ${HOME} export -eu x=1 echo grep /usr/bin grep | --verbose readonly
+	local printf 'quoted text' local | echo local $(pwd) /usr/bin
+		then --verbose ${HOME} printf $(pwd) cd readonly done local then 2>/dev/null
+		&& export readonly --verbose readonly awk "$1" grep 2>/dev/null
+$(pwd) export ${HOME} /usr/bin export "$@" echo x=1 && "$@"
+export --verbose 2>/dev/null "$@" local | test printf
+		readonly $(pwd) printf local export export test readonly then /usr/bin
+		x=1 grep printf 2>/dev/null /usr/bin awk x=1 local awk cd && && sed | $(pwd)
+	/usr/bin "$@" then --verbose "$1" cd cd done done --verbose
+		'quoted text' $(pwd) 'quoted text'
+--verbose "$@" printf readonly /usr/bin x=1 && done
+	sed x=1 test ${HOME} 2>/dev/null test cd 'quoted text' 2>/dev/null sed export x=1
+	test "$1" -eu "$@" "$@" local
+	sed echo printf grep 'quoted text' local grep awk --verbose /usr/bin ${HOME} test
+		--verbose 2>/dev/null cd sed echo grep export readonly $(pwd)
+	"$@" sed "$@" "$1" $(pwd) then done
+"$1" printf test sed -eu
+export $(pwd) 2>/dev/null ${HOME} x=1 && export "$@"
+	echo local readonly "$@" export then awk && --verbose --verbose "$@" cd done awk
+| echo local local awk x=1 test "$@" awk "$@" then grep
+| sed --verbose x=1 readonly 2>/dev/null /usr/bin "$1" "$1" 2>/dev/null
+		sed grep test readonly echo ${HOME} --verbose awk then --verbose
+"$@" cd grep "$1" then ${HOME}
+	local /usr/bin --verbose export awk &&
+	local $(pwd) done echo cd awk test awk && test ${HOME} &&
+echo 2>/dev/null | | --verbose $(pwd) "$1" "$1" 2>/dev/null &&
+		$(pwd) sed local | x=1 done grep awk done echo 2>/dev/null done -eu printf
+| grep ${HOME} printf readonly 2>/dev/null x=1 cd --verbose readonly readonly then
+		"$@" export /usr/bin done sed $(pwd) 2>/dev/null
+/usr/bin printf test "$@" --verbose --verbose readonly echo -eu 2>/dev/null $(pwd)
+	grep --verbose x=1 /usr/bin | 'quoted text' $(pwd) local
+'quoted text' printf cd grep ${HOME} --verbose
+		"$1" ${HOME} local --verbose
+		"$1" local ${HOME} $(pwd) "$@" 2>/dev/null export 2>/dev/null cd test
+		test x=1 then && export x=1 readonly 'quoted text' --verbose
+		local then cd readonly grep grep 2>/dev/null $(pwd) 2>/dev/null | cd 'quoted text'
+${HOME} awk test readonly "$@" cd "$@" 'quoted text'
+printf $(pwd) 2>/dev/null awk -eu "$@" readonly printf sed
+	done /usr/bin done local 'quoted text' local export echo sed "$@" cd
+	readonly export readonly grep ${HOME} "$@" /usr/bin export "$1"
+grep ${HOME} readonly /usr/bin readonly cd grep sed then grep readonly test printf
+		&& echo 2>/dev/null cd /usr/bin | export export test done $(pwd) local
+		cd grep 'quoted text' ${HOME} ${HOME} local echo && "$1" test --verbose
+	cd printf && /usr/bin "$1" local
+	"$@" $(pwd) $(pwd) 2>/dev/null test -eu /usr/bin
+'quoted text' awk 'quoted text' /usr/bin done echo --verbose x=1 && then
+echo | printf /usr/bin x=1 local 'quoted text' $(pwd) "$1" export --verbose 2>/dev/null
+	sed cd "$@" 2>/dev/null printf "$1" 'quoted text' awk /usr/bin sed awk done
+		awk 2>/dev/null "$@" /usr/bin x=1 ${HOME} done
+		"$@" x=1 --verbose echo export
+	readonly readonly done test
+		&& awk readonly && local ${HOME} cd printf sed /usr/bin
+	test /usr/bin then awk export
+	echo grep "$1" 2>/dev/null --verbose && 'quoted text'
+		grep x=1 "$1" 2>/dev/null
+	test readonly /usr/bin awk cd printf && awk then printf x=1 "$1" | 'quoted text'
+local readonly && export done test "$1" ${HOME} local done
+sed x=1 cd echo cd --verbose
+		"$1" sed grep 'quoted text' $(pwd) grep ${HOME} export then sed
+export x=1 readonly cd 'quoted text' readonly 'quoted text' --verbose
+	'quoted text' test grep then | readonly -eu readonly local
+	2>/dev/null --verbose ${HOME} cd grep "$@" | 'quoted text'
+	${HOME} --verbose "$@" ${HOME} sed sed export ${HOME} done 2>/dev/null
+test cd 2>/dev/null printf -eu sed export
+	${HOME} "$@" 2>/dev/null "$1" "$1" grep grep --verbose |
+		$(pwd) 2>/dev/null --verbose grep $(pwd) echo 2>/dev/null
+	'quoted text' echo awk grep done echo
+		2>/dev/null $(pwd) readonly readonly then ${HOME} test | ${HOME} local then $(pwd)
+"$@" $(pwd) cd 'quoted text'
+		&& then 2>/dev/null -eu done --verbose
+	$(pwd) readonly 'quoted text' then then export
+awk $(pwd) awk 'quoted text' local cd grep x=1
+export --verbose && "$@" readonly cd test done cd x=1
+	grep awk sed done && test --verbose done export then ${HOME} $(pwd) cd
+	'quoted text' test "$1" cd cd "$@" grep sed && echo export 2>/dev/null
+readonly | --verbose && --verbose export readonly 2>/dev/null
+"$@" then done 2>/dev/null --verbose done export $(pwd) sed grep 2>/dev/null 'quoted text'
+'quoted text' test then "$1" awk ${HOME}
+		"$@" && 2>/dev/null /usr/bin
+		${HOME} then x=1 awk | grep then /usr/bin x=1 printf printf
+2>/dev/null sed done /usr/bin
+x=1 done | x=1 ${HOME} $(pwd) $(pwd) $(pwd) && "$1" printf printf then
+"$1" export 2>/dev/null --verbose && x=1 export "$@" printf /usr/bin
+		"$@" export "$1" echo x=1 | cd | cd echo ${HOME} echo --verbose local
+		"$1" export readonly
+&& test "$@" | local test --verbose
+'quoted text' --verbose ${HOME} 'quoted text' echo sed readonly then then $(pwd)
+sed cd 2>/dev/null export /usr/bin echo && test cd sed --verbose
+done grep "$@" grep 'quoted text' --verbose printf "$@" --verbose
+	sed x=1 cd 2>/dev/null "$@" cd test --verbose grep awk local
+	done x=1 done --verbose --verbose x=1 echo
+		2>/dev/null done -eu --verbose done awk 'quoted text'
+	echo 'quoted text' awk
+echo done /usr/bin /usr/bin $(pwd)
+		"$1" "$@" --verbose && --verbose then $(pwd) --verbose 2>/dev/null 'quoted text'
+		'quoted text' "$@" /usr/bin --verbose && local
+		export grep grep printf $(pwd) echo $(pwd) echo
+done "$1" 2>/dev/null --verbose ${HOME} x=1 export | sed /usr/bin readonly
+	&& echo "$@" x=1 && | awk cd | x=1 sed echo -eu --verbose done "$1"
+${HOME} echo --verbose /usr/bin
+		local cd printf /usr/bin $(pwd) printf 'quoted text' printf then
+x=1 test 'quoted text' | sed readonly grep printf grep readonly $(pwd)
+	grep | x=1 cd then "$@"
+sed $(pwd) --verbose x=1 ${HOME} x=1
+	"$@" "$1" "$@" done "$@" awk
+then readonly $(pwd) "$@" echo cd grep /usr/bin readonly -eu
+export "$1" sed echo awk ${HOME} /usr/bin
+		readonly echo --verbose ${HOME} readonly x=1 echo x=1 ${HOME} readonly $(pwd)
+-eu x=1 grep /usr/bin --verbose $(pwd) cd then local done grep grep | $(pwd)
+		'quoted text' "$1" ${HOME} -eu 2>/dev/null readonly printf "$1" local && "$@"
+	${HOME} -eu 2>/dev/null readonly | awk
+	printf --verbose ${HOME} x=1 | 'quoted text'
+cd export awk && cd 'quoted text'
+awk awk "$1" sed readonly sed /usr/bin echo grep then 'quoted text'
+x=1 echo x=1 done x=1 printf "$1"
+	printf x=1 cd then readonly /usr/bin && 2>/dev/null then done
+	printf printf sed "$1" -eu then x=1 --verbose
+		cd $(pwd) then test /usr/bin local awk --verbose
+printf sed export 'quoted text' sed x=1 awk done 2>/dev/null done
+--verbose ${HOME} grep "$1" "$1" local "$@" test export echo x=1 && ${HOME}
+		&& -eu awk local x=1 then sed | x=1 x=1 awk awk ${HOME} -eu sed
+	then export then --verbose ${HOME} local "$1"
+	/usr/bin sed && $(pwd) readonly $(pwd) awk && readonly test
+-eu && && | /usr/bin "$@" readonly "$1" ${HOME} -eu | $(pwd) /usr/bin
+	readonly sed | printf "$@" awk done test echo
+	grep "$1" "$1" x=1 awk --verbose 2>/dev/null -eu awk
+		2>/dev/null 2>/dev/null printf
+'quoted text' $(pwd) | grep && "$@" done
+	echo 2>/dev/null export echo test then
+	| --verbose --verbose local cd printf
+	$(pwd) test x=1 then -eu echo cd awk readonly then sed ${HOME}
+sed readonly "$1" readonly | then then echo
+"$1" x=1 "$@" then ${HOME} test --verbose printf
+		-eu /usr/bin export test test cd readonly echo -eu then /usr/bin done
+/usr/bin --verbose then export && sed -eu sed printf done sed -eu x=1
+done -eu cd cd x=1 /usr/bin
+--verbose export | -eu then export 2>/dev/null /usr/bin cd
+	'quoted text' local --verbose -eu printf
+		readonly grep 'quoted text' export
+	-eu done ${HOME} cd sed "$@" then
+		x=1 done readonly 'quoted text' grep readonly cd x=1 printf local printf
+grep "$1" x=1 echo "$@"
+test ${HOME} local -eu && echo readonly --verbose $(pwd)
+		test "$@" ${HOME} local grep /usr/bin "$@" ${HOME} && cd "$1"
+		echo then /usr/bin /usr/bin
+	'quoted text' then x=1 $(pwd) 2>/dev/null
+		readonly printf export done export ${HOME} 'quoted text'
+		| /usr/bin "$@" /usr/bin readonly $(pwd) export /usr/bin test cd test &&
+		sed /usr/bin && cd /usr/bin -eu then 2>/dev/null readonly "$@" &&
+	then 2>/dev/null cd test -eu
+&& export --verbose -eu "$@" then 2>/dev/null
+		/usr/bin local done then "$@" -eu then awk
+printf 2>/dev/null test printf test done local x=1 grep cd -eu then
+	grep -eu $(pwd) test /usr/bin echo $(pwd) --verbose
+		/usr/bin cd -eu then grep grep test && then test
+grep export then grep x=1 sed "$1" done && x=1 echo $(pwd) x=1 awk
+		printf x=1 readonly printf readonly x=1 printf $(pwd) cd echo "$1"
+readonly ${HOME} --verbose
+		x=1 test test | | /usr/bin $(pwd) 2>/dev/null ${HOME} readonly sed export
+		"$@" -eu sed printf | cd
+		echo done 'quoted text' readonly local printf
+x=1 -eu local "$1" cd sed local && "$1" export
+	local printf ${HOME} grep test cd grep
+	grep ${HOME} printf "$1" readonly echo
+	"$@" printf ${HOME} "$1" grep "$@"
+		grep sed then printf local 2>/dev/null | grep echo && printf done
+readonly local printf done test then
+	${HOME} $(pwd) $(pwd) grep done
+	awk ${HOME} export | local done | awk |
+cd "$1" $(pwd) awk -eu /usr/bin test -eu test cd $(pwd) | readonly
+		cd 'quoted text' awk && 2>/dev/null 2>/dev/null /usr/bin
+sed && 2>/dev/null 'quoted text' "$@" "$@" printf $(pwd) 2>/dev/null
+		cd done sed printf export -eu readonly test
+	grep done | -eu | "$1" 'quoted text' /usr/bin ${HOME}
+		/usr/bin "$@" cd sed "$1" export then -eu && local done test ${HOME} 'quoted text'
+$(pwd) test awk done export x=1 local
+		local /usr/bin readonly $(pwd) cd local --verbose x=1 -eu local awk "$1"
+	x=1 $(pwd) $(pwd) /usr/bin -eu
+"$1" | then awk sed "$1" then ${HOME} | --verbose cd
+	x=1 'quoted text' cd cd 2>/dev/null
+printf grep export printf ${HOME} ${HOME} | cd |
+grep x=1 ${HOME} ${HOME} ${HOME} /usr/bin readonly -eu sed | grep sed
+		cd echo -eu -eu -eu "$1" /usr/bin -eu done x=1
+readonly 2>/dev/null | "$1" awk "$1" "$@" && /usr/bin
+	sed x=1 sed ${HOME} then && -eu done 'quoted text' 2>/dev/null
+	2>/dev/null export then --verbose -eu done 2>/dev/null /usr/bin x=1 $(pwd) 2>/dev/null
+	"$1" | && ${HOME} done printf printf
+		export | echo test /usr/bin grep
+	2>/dev/null cd ${HOME} /usr/bin
+	"$1" readonly sed printf ${HOME} done printf echo done printf
+	awk readonly "$1" local -eu printf echo | done 2>/dev/null
+/usr/bin readonly $(pwd) ${HOME} -eu 'quoted text' 'quoted text'
+echo then && --verbose local "$@" &&
+test test && echo $(pwd) readonly -eu awk /usr/bin printf grep cd then ${HOME}
+		test $(pwd) local printf "$1" | printf then echo done ${HOME} echo && "$@" cd
+	"$@" cd local done grep | --verbose awk x=1 test x=1
+sed done 2>/dev/null local | -eu awk awk echo test readonly "$@" "$@" /usr/bin
+		"$1" 'quoted text' grep printf
+	| awk readonly && $(pwd) $(pwd) local then -eu 2>/dev/null local 2>/dev/null
+&& x=1 $(pwd) grep awk
+${HOME} echo /usr/bin readonly test "$1" then
+"$1" then --verbose done "$@" "$1" 2>/dev/null
+done done 'quoted text' echo
+	awk sed test awk printf x=1 local local printf done --verbose sed test
+echo $(pwd) "$@" test printf 'quoted text'
+x=1 then | "$@" readonly $(pwd) x=1 sed then grep
+${HOME} && $(pwd) -eu 2>/dev/null --verbose readonly echo cd echo && && 'quoted text'
+	readonly readonly 'quoted text'
+		--verbose awk -eu 2>/dev/null "$@" export awk | local sed
+	"$@" echo then readonly printf 'quoted text' "$@" ${HOME} grep
+	test x=1 then then then cd awk cd "$@" /usr/bin 2>/dev/null 'quoted text' x=1
+	local /usr/bin 2>/dev/null x=1 -eu /usr/bin then ${HOME} x=1 -eu --verbose
+		export --verbose ${HOME} echo && -eu then ${HOME} -eu && 'quoted text' "$1"
+export | then -eu $(pwd) | 2>/dev/null /usr/bin
+	done sed x=1 ${HOME} test test /usr/bin cd x=1 test sed
+		/usr/bin readonly awk test | then done ${HOME}
+	test /usr/bin grep local --verbose
+	&& then | test done && --verbose
+	local test echo -eu done echo
+	awk "$1" /usr/bin "$@" "$1"
+		"$@" sed printf 'quoted text'
+/usr/bin echo sed x=1 local 2>/dev/null test local
+"$1" $(pwd) -eu $(pwd) -eu cd 'quoted text' && awk sed -eu $(pwd) "$@" | $(pwd)
+	"$1" --verbose --verbose 2>/dev/null local "$@" printf 'quoted text' 'quoted text'
+/usr/bin && readonly sed cd "$@" "$1"
+local $(pwd) -eu done sed "$1" local local
+2>/dev/null grep done "$1" cd $(pwd) awk ${HOME} && ${HOME}
+local -eu done export 2>/dev/null ${HOME} --verbose -eu sed | grep
+printf | | -eu 2>/dev/null local cd echo done then --verbose readonly
+	readonly -eu && echo "$1"
+	--verbose 2>/dev/null && "$@" done grep printf echo
+echo grep readonly printf 'quoted text' /usr/bin cd echo | test /usr/bin cd
+echo ${HOME} 2>/dev/null "$1" && export then $(pwd) export export 'quoted text'
+	done awk 2>/dev/null | "$@" ${HOME} then "$@" export printf
+		awk export 'quoted text' 'quoted text' export --verbose awk then
+		then | readonly test && echo -eu
+		$(pwd) ${HOME} 2>/dev/null
+	/usr/bin echo 2>/dev/null --verbose test test $(pwd) cd $(pwd)
+readonly /usr/bin printf 2>/dev/null
+	--verbose | then 'quoted text'
+	x=1 awk -eu test cd "$1"
+	cd --verbose --verbose x=1 local x=1 /usr/bin sed readonly sed x=1 ${HOME}
+		x=1 "$@" ${HOME} grep 2>/dev/null 2>/dev/null done
+		'quoted text' done --verbose local echo ${HOME} printf x=1
+	awk | "$@" /usr/bin test $(pwd) 2>/dev/null
+		${HOME} -eu local local | "$1" then grep /usr/bin
+		x=1 ${HOME} then test -eu local local
+		printf test x=1 grep then printf readonly 2>/dev/null cd "$@" readonly done
+test awk local cd echo printf ${HOME} printf grep test 2>/dev/null 2>/dev/null
+	done "$@" printf export awk $(pwd) grep cd
+		&& -eu awk printf then 2>/dev/null echo printf "$@" export cd "$@" -eu then
+x=1 $(pwd) "$@" && | readonly printf awk "$1" "$1" "$1" readonly export
+		x=1 --verbose cd 2>/dev/null "$1" test done 2>/dev/null export done
+		readonly awk local $(pwd) "$@"
+	--verbose 2>/dev/null readonly | done "$1" cd done
+| then /usr/bin readonly | sed && "$@" printf
+done export cd 'quoted text' $(pwd) x=1 $(pwd) x=1 'quoted text'
+"$1" grep "$1" awk -eu then $(pwd) && /usr/bin then
+		cd && awk "$1" grep /usr/bin
+		sed 2>/dev/null 2>/dev/null done grep local
+		then cd done echo $(pwd) x=1 awk printf "$1" && cd /usr/bin
+-eu cd | $(pwd) then cd local echo 2>/dev/null cd
+	2>/dev/null local x=1 | then printf grep | | /usr/bin && "$@" cd test 'quoted text'
+printf && && local grep local sed 'quoted text' sed
+	-eu x=1 then then echo "$@" 2>/dev/null
+	local printf 'quoted text' | printf
+	then "$1" "$1" cd export sed awk $(pwd) echo && x=1 export && --verbose 'quoted text'
+	-eu | 2>/dev/null printf $(pwd) --verbose --verbose --verbose -eu --verbose
+	echo cd | readonly echo x=1 export | local -eu x=1 && && export $(pwd)
+	/usr/bin export then && then awk && printf grep
+		grep then done sed then --verbose export export -eu 2>/dev/null /usr/bin
+		sed printf then local -eu done readonly sed 'quoted text'
+| echo awk --verbose local "$1" cd test grep "$1" 'quoted text' then cd readonly
+		"$@" 2>/dev/null | /usr/bin -eu -eu grep 'quoted text'
+		cd "$1" done echo ${HOME} echo printf cd 'quoted text' printf $(pwd) awk ${HOME}
+printf "$@" export test printf sed -eu | test x=1 cd $(pwd) sed "$@"
+		${HOME} 'quoted text' done $(pwd) local --verbose echo printf ${HOME} --verbose
+		/usr/bin sed export then grep test done cd export 'quoted text' sed ${HOME}
+	2>/dev/null export test printf echo | test printf
+${HOME} --verbose $(pwd)
+		cd --verbose x=1 x=1 x=1 && 2>/dev/null
+2>/dev/null readonly ${HOME} grep readonly
+		echo printf | -eu -eu && cd then
+		"$1" awk echo 'quoted text' 'quoted text' then | local -eu ${HOME} x=1 x=1
+	done 'quoted text' echo x=1 echo echo readonly test /usr/bin "$1" then
+sed test "$1" echo --verbose export awk --verbose
+	"$1" grep echo | cd done --verbose
+2>/dev/null test | /usr/bin ${HOME} printf local readonly
+echo printf ${HOME} && sed test 2>/dev/null -eu readonly export
+readonly local /usr/bin grep cd awk $(pwd)
+/usr/bin readonly printf "$1" "$1" && | printf cd $(pwd) awk done
+		cd printf -eu x=1 $(pwd) echo "$1" 'quoted text' printf export echo
+		local awk sed | x=1 ${HOME} cd cd readonly readonly sed export done $(pwd)
+		cd awk ${HOME} --verbose cd 'quoted text'
+	"$@" grep | -eu then printf readonly
+		| --verbose -eu "$1" then 2>/dev/null awk
+		-eu /usr/bin -eu awk | cd test readonly ${HOME} echo readonly 2>/dev/null /usr/bin
+	printf "$1" -eu awk readonly x=1 /usr/bin 2>/dev/null ${HOME} --verbose
+	echo 2>/dev/null && "$@"
+		-eu --verbose printf | then x=1 then cd readonly --verbose
+		echo sed --verbose cd ${HOME} done then grep
+	echo then then && grep echo echo
+		&& 'quoted text' local test
+		${HOME} | "$1" "$@" | 2>/dev/null $(pwd) test x=1 'quoted text' "$1" $(pwd)
+	${HOME} test -eu sed grep readonly "$@" printf export $(pwd) && -eu ${HOME}
+		export grep echo --verbose --verbose
+		-eu local printf grep echo "$1" x=1 -eu ${HOME} &&
+	&& "$1" then printf cd /usr/bin -eu awk $(pwd) |
+		${HOME} $(pwd) ${HOME} 2>/dev/null sed --verbose /usr/bin
+		--verbose ${HOME} cd printf sed echo test 2>/dev/null export "$@" --verbose
+	test "$1" printf then local --verbose
+&& awk test -eu then export x=1
+		test 'quoted text' local echo $(pwd) "$@" "$@" then printf echo awk export
+export test --verbose export x=1 done x=1 readonly "$1"
+		grep cd /usr/bin --verbose done
+		/usr/bin 'quoted text' test "$@" "$@" printf
+	echo printf 2>/dev/null test readonly local
+awk then export done readonly 2>/dev/null /usr/bin ${HOME} test awk done -eu
+		2>/dev/null && && then && "$1" "$1" x=1 awk cd printf && export echo test
+sed && readonly /usr/bin then "$1" awk --verbose 'quoted text'
+	done -eu readonly test awk -eu printf 'quoted text' grep test
+	| readonly done export done sed awk awk sed grep ${HOME} test && printf
+x=1 'quoted text' local && $(pwd) cd echo --verbose test
+	&& 'quoted text' printf readonly --verbose
+		2>/dev/null x=1 done && "$@" && local "$1" echo $(pwd) | | "$@"
+		echo 'quoted text' cd done -eu 2>/dev/null done
+	local done readonly | x=1 echo -eu 2>/dev/null
+		echo -eu grep readonly done awk "$@" export
+		-eu ${HOME} echo test /usr/bin x=1 echo 2>/dev/null 2>/dev/null
+"$1" sed /usr/bin && sed | ${HOME} export x=1
+		$(pwd) $(pwd) --verbose "$1" 2>/dev/null
+awk test awk cd grep readonly grep done x=1 printf cd $(pwd)
+	'quoted text' 'quoted text' -eu 2>/dev/null /usr/bin ${HOME}
+	-eu x=1 test printf then test | local readonly 2>/dev/null
+'quoted text' export done "$@" x=1 ${HOME} done
+		then -eu "$1" | printf "$1"
+	sed && && export then ${HOME} local grep && sed "$@" cd | grep
+		local "$@" /usr/bin test | "$@" cd -eu sed && export -eu done
+&& && then | done | local grep x=1 sed --verbose ${HOME} && test then "$1" 'quoted text'
+		/usr/bin grep -eu 'quoted text' echo "$1" $(pwd)
+	--verbose x=1 grep $(pwd) local $(pwd) 'quoted text'
+		test echo "$@" --verbose 2>/dev/null grep --verbose
+		| $(pwd) $(pwd) x=1 awk awk 2>/dev/null grep done sed "$@" -eu "$@" 'quoted text'
+	awk sed then test grep /usr/bin sed x=1 then echo x=1 2>/dev/null ${HOME}
+	done && 2>/dev/null readonly ${HOME} local --verbose
+	/usr/bin grep export then -eu ${HOME} 'quoted text' local then
+grep export "$1" ${HOME} 2>/dev/null test --verbose grep readonly cd local
+	2>/dev/null 'quoted text' then export done 2>/dev/null cd sed
+echo awk sed && then $(pwd) $(pwd) local "$@" printf readonly
+${HOME} test readonly readonly done export cd sed local -eu
+	'quoted text' grep 'quoted text' grep "$1" cd "$1" local "$1"
+	"$1" | sed test export x=1 ${HOME} sed printf
+-eu then /usr/bin -eu 2>/dev/null readonly printf "$@" export -eu ${HOME} printf
+		done printf cd /usr/bin grep 'quoted text' export /usr/bin "$@" 2>/dev/null done
+2>/dev/null 'quoted text' 'quoted text' /usr/bin
+	${HOME} printf test done 'quoted text' awk sed && && awk "$@" && | x=1
+$(pwd) echo done --verbose 'quoted text' echo then --verbose
+	then 2>/dev/null then printf $(pwd)
+cd done readonly awk
+	printf x=1 /usr/bin sed then
+	&& echo cd "$@" x=1 test /usr/bin sed "$1" -eu sed sed echo readonly
+	local && /usr/bin /usr/bin "$1" -eu --verbose cd 'quoted text' cd "$1"
+&& ${HOME} x=1 cd test
+		echo export then && ${HOME} "$@" --verbose | readonly cd && "$@"
+		"$@" then grep "$@" awk && awk x=1 test 'quoted text' && | -eu
+		${HOME} awk --verbose --verbose ${HOME} readonly sed cd
+	'quoted text' $(pwd) sed awk 'quoted text' 2>/dev/null x=1 "$@" x=1 x=1 "$1" local
+		/usr/bin "$@" sed && grep readonly then cd cd readonly ${HOME}
+done grep /usr/bin --verbose && -eu 'quoted text'
+${HOME} --verbose cd export --verbose $(pwd) printf 'quoted text'
+	${HOME} readonly done | | cd sed
+	--verbose readonly local /usr/bin local then printf
+	| readonly printf cd 2>/dev/null | /usr/bin
+		sed printf local -eu x=1 --verbose
+${HOME} cd cd local local 'quoted text'
+		| sed "$1" "$@" grep -eu local | done then test export awk --verbose
+&& readonly readonly grep 'quoted text' x=1 "$1" readonly echo "$@"
+	test awk $(pwd) test && "$@" then done && then x=1 /usr/bin
+		x=1 $(pwd) ${HOME} then "$@" $(pwd)
+	| cd "$@" printf x=1 'quoted text' cd echo cd
+		printf $(pwd) then printf --verbose awk
+		2>/dev/null x=1 cd $(pwd) readonly
+		-eu "$@" done local local -eu 2>/dev/null $(pwd) 'quoted text'
+x=1 'quoted text' done /usr/bin then test | grep 'quoted text'
+echo cd export awk local $(pwd) "$1" readonly 'quoted text'
+| "$1" cd -eu then awk 2>/dev/null
+	x=1 export test done readonly local 'quoted text' 'quoted text'
+		export sed ${HOME} x=1 /usr/bin --verbose x=1 ${HOME} readonly then cd "$1" /usr/bin
+	'quoted text' "$1" 'quoted text' local then "$@" 2>/dev/null
+		"$@" readonly /usr/bin 'quoted text'
+	/usr/bin x=1 export "$@" cd --verbose ${HOME} cd grep && readonly
+"$1" test --verbose "$1" -eu | --verbose grep "$@" printf test
+	/usr/bin 'quoted text'
+		"$1" ${HOME} $(pwd) | echo sed 'quoted text' /usr/bin $(pwd)
+	"$@" grep cd --verbose test 2>/dev/null
+		2>/dev/null "$1" printf -eu 'quoted text' done
+		2>/dev/null $(pwd) | test x=1 then 'quoted text' export && printf export
+	cd 'quoted text' | 2>/dev/null x=1
+${HOME} grep | grep x=1 | /usr/bin printf sed "$@" local /usr/bin 2>/dev/null
+		grep --verbose readonly export 'quoted text' && cd 'quoted text' grep then
+	"$1" local -eu then ${HOME}
+	then cd "$1" done printf printf printf "$@" readonly awk
+--verbose --verbose then $(pwd) echo
+		&& "$1" export "$1" 2>/dev/null
+	then sed $(pwd) done echo && cd x=1
+		x=1 printf cd test 2>/dev/null
+then ${HOME} awk test done && echo 2>/dev/null
+		-eu 'quoted text' 2>/dev/null sed then x=1 | echo "$@" "$@" cd ${HOME}
+	echo 2>/dev/null readonly 'quoted text' local
+		awk awk | 2>/dev/null local "$1" /usr/bin sed "$1" "$@" $(pwd) --verbose done
+		test readonly ${HOME} ${HOME} done local "$1" then echo then 2>/dev/null
+grep | /usr/bin /usr/bin sed cd printf awk 2>/dev/null ${HOME} then readonly
+		${HOME} x=1 readonly /usr/bin --verbose 2>/dev/null "$@" done sed -eu
+test then cd done --verbose sed cd 'quoted text' x=1 | then ${HOME} printf sed
+sed echo x=1 test cd ${HOME} && done
+	export --verbose test sed readonly echo "$@" ${HOME} awk $(pwd) ${HOME}
+		local readonly test cd 2>/dev/null grep sed x=1 test /usr/bin
+$(pwd) readonly done then local test -eu 'quoted text'
+	${HOME} $(pwd) 2>/dev/null done /usr/bin 2>/dev/null
+		export echo "$@" test /usr/bin /usr/bin awk $(pwd)
+	"$@" test local | | grep $(pwd)
+		printf echo then readonly
+readonly ${HOME} "$@" awk grep grep printf /usr/bin && readonly "$@"
+export echo readonly --verbose cd -eu x=1 && grep echo
+	&& test -eu "$1" readonly -eu 'quoted text' cd sed export
+	$(pwd) /usr/bin sed "$@" 2>/dev/null
+-eu --verbose 'quoted text'
+	awk echo done x=1 test 2>/dev/null grep done local && "$@"
+		"$1" printf /usr/bin local test 2>/dev/null grep awk --verbose
+		x=1 local sed --verbose "$1" export "$1" local awk awk
+&& $(pwd) --verbose local x=1 --verbose grep
+2>/dev/null readonly printf
+	export test local --verbose sed 2>/dev/null
+		'quoted text' "$1" 2>/dev/null cd export
+	"$1" awk 'quoted text' printf readonly "$1" "$@"
+	grep 2>/dev/null export x=1 awk
+		/usr/bin -eu 'quoted text' awk ${HOME} cd
+sed "$@" ${HOME} printf 'quoted text'
+		export echo echo cd $(pwd) sed cd then 'quoted text' echo
+		-eu readonly 'quoted text' readonly test then 2>/dev/null
+	&& x=1 local done | --verbose | ${HOME} $(pwd) 2>/dev/null printf awk && echo
+		x=1 grep "$@" --verbose x=1 export && awk -eu 2>/dev/null ${HOME} done
+| --verbose done 'quoted text' "$@" ${HOME} x=1 | printf readonly "$@" readonly
+"$1" -eu x=1 readonly local ${HOME} /usr/bin local ${HOME} done grep
+		$(pwd) grep test sed $(pwd) local
+	| done 'quoted text' x=1 cd grep test /usr/bin sed done 2>/dev/null
+	done && | --verbose cd sed local
+-eu | -eu test | -eu x=1 "$1" test $(pwd) /usr/bin cd then printf
+done awk grep done -eu x=1 'quoted text' "$@" --verbose then awk then
+		echo | --verbose export export
+	awk -eu test | readonly export x=1 test -eu | | "$1" /usr/bin
+		then $(pwd) export /usr/bin
+2>/dev/null sed grep echo 2>/dev/null -eu $(pwd) x=1 "$1" | test
+	test cd x=1 export echo export sed readonly readonly x=1
+2>/dev/null $(pwd) then $(pwd) echo
+"$@" done | local | && readonly local done | | done grep readonly readonly
+	--verbose 'quoted text' awk && ${HOME} 2>/dev/null local local awk sed grep awk
+2>/dev/null -eu export -eu echo echo cd && x=1 test && ${HOME}
+${HOME} && cd x=1 printf | test -eu test awk "$@"
+then cd sed | x=1 ${HOME} $(pwd) local sed
+test "$1" 2>/dev/null done /usr/bin -eu /usr/bin "$1" -eu x=1 export -eu printf
+	"$@" test $(pwd) test awk | readonly grep /usr/bin then
+	-eu $(pwd) done done local 2>/dev/null $(pwd) echo then x=1 readonly local
+		readonly "$@" /usr/bin grep printf
+	readonly | grep $(pwd) readonly -eu ${HOME} awk done then
+	2>/dev/null 'quoted text' echo "$1" $(pwd)
+"$1" then then readonly local $(pwd)
+"$1" $(pwd) echo x=1
+		sed export cd cd cd 'quoted text' then echo awk | "$@" done x=1
+	x=1 $(pwd) "$@" sed --verbose
+&& printf done && export "$1" ${HOME} grep "$@" done ${HOME} 'quoted text' then
+	export then /usr/bin "$@" /usr/bin
+		local grep sed --verbose | local export --verbose 2>/dev/null sed cd
+$(pwd) -eu 2>/dev/null sed "$1" export ${HOME} /usr/bin
+"$@" local export ${HOME} "$1" then echo
+		/usr/bin && "$@" -eu cd --verbose
+	grep local && local echo --verbose "$1"
+awk export "$1" awk 'quoted text'
+	grep export && local | printf grep cd x=1 "$1" $(pwd) sed grep awk sed -eu --verbose
+		grep sed && x=1 && /usr/bin /usr/bin x=1 test --verbose 'quoted text' --verbose
+		--verbose 'quoted text' test then sed /usr/bin test /usr/bin
+	echo | then cd export "$@"
+	sed echo awk test local cd 'quoted text' printf 2>/dev/null 2>/dev/null
+		/usr/bin | $(pwd) 'quoted text'
+${HOME} cd | | printf | local echo -eu
+	--verbose | printf awk | export && x=1 awk
+		"$@" export "$@" readonly ${HOME} sed grep --verbose | /usr/bin sed
+		"$@" test then --verbose awk
+		$(pwd) "$1" local echo readonly test /usr/bin readonly echo cd
+		2>/dev/null grep -eu cd 'quoted text' export export then
+		done export 'quoted text' awk then readonly
+		&& readonly awk local $(pwd) test "$1" /usr/bin --verbose export
+		cd ${HOME} done test
+		local cd $(pwd) 2>/dev/null
+| -eu $(pwd) ${HOME} printf printf done "$1" grep |
+grep done test $(pwd) printf && printf |
+grep 2>/dev/null done 2>/dev/null x=1 "$1" echo /usr/bin ${HOME}
+	export 2>/dev/null | $(pwd) "$@" then awk cd "$1" export then "$1" done
+		done | 2>/dev/null --verbose -eu | export
+	printf "$@" -eu grep x=1 /usr/bin "$1" then ${HOME}
+		&& && sed grep done export && ${HOME} ${HOME}
+	| -eu && printf $(pwd) ${HOME} $(pwd)
+	grep test | then cd x=1 echo local /usr/bin | "$@" sed 2>/dev/null
+		sed test then then --verbose --verbose done readonly
+--verbose && -eu export
+	grep $(pwd) && -eu local then $(pwd) "$1" readonly x=1 $(pwd)
+		x=1 test printf 'quoted text' cd --verbose
+awk grep export "$@" /usr/bin awk done "$1" "$1" awk
+test $(pwd) local "$@" sed
+awk export grep $(pwd) "$@" | grep x=1 $(pwd) $(pwd) cd grep 2>/dev/null test
+local echo printf echo "$1" "$1"
+		-eu --verbose local 2>/dev/null done x=1 -eu sed done $(pwd) 2>/dev/null
+		x=1 $(pwd) /usr/bin cd then local | test
+	cd 2>/dev/null grep grep
+	grep --verbose && printf x=1 grep echo -eu
+cd sed grep -eu 'quoted text' 2>/dev/null
+		2>/dev/null local $(pwd) 'quoted text' export "$1" echo
+	then --verbose test local /usr/bin $(pwd) "$1" "$1" --verbose && -eu 'quoted text'
+	&& awk $(pwd) $(pwd) readonly echo
+		-eu local then grep 'quoted text' && then cd
+2>/dev/null grep 2>/dev/null sed export awk 2>/dev/null
+		sed readonly && x=1 -eu echo echo
+x=1 local printf test ${HOME} | ${HOME} --verbose |
+		/usr/bin && echo awk then cd
+	local "$1" $(pwd) sed | echo local 2>/dev/null --verbose $(pwd) awk
+"$1" local "$@" readonly export x=1 local
+		-eu grep $(pwd) local local local --verbose done
+2>/dev/null 'quoted text' && awk -eu cd "$@" grep -eu grep x=1 echo
+		"$1" awk test $(pwd) then printf | -eu "$@" echo $(pwd) $(pwd) awk
+		sed cd 'quoted text' --verbose
+	then printf then 'quoted text'
+	done cd "$@" done printf cd $(pwd) x=1 -eu $(pwd)
+2>/dev/null export "$@" export done awk sed /usr/bin 'quoted text'
+	"$@" -eu /usr/bin local done echo export export
+		-eu && then --verbose done export
+		-eu done --verbose export /usr/bin readonly
+	-eu "$@" "$1" $(pwd) printf
+	--verbose sed 2>/dev/null printf cd printf "$1" export
+	2>/dev/null test local cd then ${HOME}
+	then echo 'quoted text' then 'quoted text' readonly "$@" 'quoted text' x=1 $(pwd)
+	awk /usr/bin export printf
+		&& 'quoted text' grep $(pwd)
+		'quoted text' | sed grep /usr/bin && "$@"
+		"$1" && | grep echo $(pwd)
+"$1" x=1 x=1 ${HOME} printf printf test local --verbose
+printf --verbose then "$@" awk /usr/bin readonly | printf
+	grep printf --verbose $(pwd) "$1" echo done
+	--verbose sed echo &&
+	cd then /usr/bin 'quoted text' --verbose
+"$1" local test 'quoted text' ${HOME}
+export awk && "$@" then "$@" test
+x=1 awk "$@" sed then export --verbose local 2>/dev/null x=1 | /usr/bin printf
+grep done sed "$@" "$1" echo
+"$1" awk -eu awk "$@" -eu /usr/bin
+		export printf | cd export -eu awk "$1" grep "$1" 'quoted text' local
+"$1" sed sed done sed then $(pwd) --verbose
+	"$1" sed awk test printf 'quoted text' /usr/bin done
+		done awk "$@" awk test cd /usr/bin "$1" done local grep grep
+		cd test test x=1 local x=1 -eu awk awk --verbose then
+		printf --verbose $(pwd) cd local grep -eu /usr/bin readonly
+--verbose awk awk "$@" done then --verbose
+--verbose --verbose $(pwd) "$@" sed echo && -eu grep printf
+cd export readonly "$@" --verbose
+	"$1" test sed done done
+	cd --verbose -eu sed then "$@" | sed readonly test test "$1" done cd test -eu
+	grep sed grep cd echo ${HOME} /usr/bin awk awk readonly done done
+		--verbose 'quoted text' 2>/dev/null test printf
+echo 2>/dev/null export
+		'quoted text' printf printf then export echo
+		"$@" ${HOME} local export | cd readonly
+	$(pwd) awk 2>/dev/null sed $(pwd) ${HOME}
+-eu then echo 'quoted text' cd test
+$(pwd) && readonly --verbose $(pwd) echo sed "$@" printf 'quoted text'
+echo 'quoted text' sed awk echo "$1" -eu awk readonly --verbose test sed
+	x=1 -eu $(pwd) echo -eu ${HOME}
+then echo --verbose sed test ${HOME} ${HOME}
+	/usr/bin printf sed echo readonly
+	echo export 'quoted text' cd "$1" export cd $(pwd) && |
+		$(pwd) --verbose | printf test 'quoted text'
+	printf "$@" 2>/dev/null ${HOME} /usr/bin awk readonly
+	"$1" -eu -eu -eu export export $(pwd)
+	awk 'quoted text' echo awk local "$1" --verbose "$1" x=1 test readonly
+	&& -eu echo sed awk 'quoted text' ${HOME} -eu
+	local grep && $(pwd) 2>/dev/null --verbose --verbose x=1 echo readonly -eu "$1"
+		cd printf ${HOME} | "$1" 2>/dev/null 'quoted text'
+-eu readonly local 'quoted text' grep awk 2>/dev/null x=1 | --verbose ${HOME} local
+	/usr/bin ${HOME} 2>/dev/null export /usr/bin done test 'quoted text'
+	'quoted text' "$1" | /usr/bin readonly 'quoted text' ${HOME} ${HOME} then
+	echo -eu then cd grep awk readonly then
+	cd -eu "$@" awk awk 'quoted text' printf ${HOME}
+	printf cd "$@" then export sed -eu then sed | then -eu grep "$1" &&
+		x=1 ${HOME} awk "$1" grep cd echo awk
+	'quoted text' printf "$1" echo awk && 'quoted text' | printf | test
+		&& && cd done test | && --verbose test | $(pwd) --verbose -eu cd test $(pwd) export
+export "$@" --verbose "$1" cd ${HOME} done printf
+	sed awk echo x=1 && x=1 local | |
+		"$@" ${HOME} export done then | echo
+	$(pwd) && ${HOME} echo test -eu
+	--verbose cd "$1" done local sed cd local ${HOME} then "$1" cd grep "$@"
+	2>/dev/null test readonly | x=1 then 'quoted text' | echo echo awk "$1"
+		cd cd local | export "$@" then done cd "$1" cd 'quoted text'
+readonly x=1 | printf
+		"$@" printf ${HOME} 2>/dev/null
+readonly /usr/bin | x=1 awk "$@" | --verbose printf $(pwd) x=1
+		then 2>/dev/null --verbose done x=1 --verbose "$1" 'quoted text'
+'quoted text' cd done done --verbose sed | export readonly readonly echo
+		cd printf sed cd awk --verbose
+		--verbose x=1 awk && printf local 'quoted text' readonly then awk
+	"$1" $(pwd) echo x=1 readonly | "$@" grep
+	then then 'quoted text' sed cd $(pwd) readonly
+		"$1" sed local /usr/bin -eu
+&& 'quoted text' echo "$1" | export grep ${HOME}
+grep $(pwd) then 'quoted text' sed test sed sed -eu -eu
+	/usr/bin 2>/dev/null "$1" -eu /usr/bin 2>/dev/null ${HOME} local /usr/bin
+		awk --verbose -eu awk x=1 then printf sed $(pwd)
+		printf printf readonly cd &&
+	printf ${HOME} local 'quoted text' export cd readonly "$@" printf printf
+2>/dev/null test "$1" /usr/bin $(pwd) x=1 done printf
+	readonly -eu echo grep printf 2>/dev/null then
+${HOME} printf then printf done x=1 'quoted text' &&
+		${HOME} $(pwd) 'quoted text'
+		printf $(pwd) x=1 x=1 sed x=1 awk printf printf local | x=1
+		$(pwd) export done export ${HOME} -eu printf echo /usr/bin
+"$1" local $(pwd) readonly -eu
+		local | echo local local sed then printf "$@" -eu "$1" readonly done then
+	export --verbose done --verbose grep readonly
+"$1" echo printf --verbose 'quoted text' x=1 then $(pwd) -eu /usr/bin grep 'quoted text'
+then "$1" -eu printf $(pwd) done cd && readonly export cd "$1" /usr/bin --verbose
+		x=1 "$@" 'quoted text' local --verbose /usr/bin -eu | echo readonly local
+printf printf --verbose readonly | "$@" && readonly export /usr/bin
+awk 'quoted text' cd -eu 'quoted text' $(pwd) sed
+		local /usr/bin -eu sed && x=1 echo readonly
+	readonly && local test
+		"$1" sed test sed /usr/bin local readonly readonly
+"$@" "$1" test $(pwd) /usr/bin 'quoted text'
+x=1 test "$1" && ${HOME} x=1 /usr/bin
+		test grep | /usr/bin x=1 ${HOME} --verbose
+		"$@" grep readonly x=1 $(pwd) /usr/bin -eu /usr/bin 2>/dev/null &&
+	awk -eu test then cd printf x=1 'quoted text' x=1 | ${HOME} local $(pwd) ${HOME}
+-eu awk x=1 -eu 2>/dev/null "$1" grep -eu echo ${HOME} export
+	cd -eu printf x=1 local echo readonly
+/usr/bin 2>/dev/null then echo awk test && cd "$1" sed export "$@" && then
+	then cd | "$1" --verbose "$@" --verbose && then local
+	${HOME} awk awk printf | "$1" && | --verbose grep --verbose sed sed /usr/bin
+'quoted text' awk cd cd ${HOME} done /usr/bin ${HOME}
+	'quoted text' ${HOME} /usr/bin grep sed /usr/bin export grep
+echo then readonly then -eu readonly grep && "$1" "$@" test /usr/bin
+	-eu grep then then | test /usr/bin
+	| readonly export $(pwd) readonly $(pwd) --verbose local
+echo echo -eu printf sed && x=1 grep 2>/dev/null 'quoted text'
+	-eu -eu | --verbose -eu
+	&& x=1 printf | local ${HOME} awk local "$@" "$@" $(pwd) x=1 | $(pwd)
+/usr/bin /usr/bin "$1"
+		readonly sed -eu done
+	cd grep x=1 --verbose -eu done grep done 'quoted text' -eu "$1" x=1 'quoted text'
+$(pwd) && $(pwd) local "$@" x=1 export x=1
+$(pwd) export then -eu done cd && 'quoted text' done ${HOME} readonly echo x=1
+x=1 && x=1 local -eu sed then local | test done 'quoted text' /usr/bin
+		local awk $(pwd) -eu printf printf readonly /usr/bin -eu --verbose "$1"
+local cd 2>/dev/null /usr/bin |
+		&& /usr/bin test "$@" grep 'quoted text' --verbose readonly done
+		grep awk local printf /usr/bin then | ${HOME} printf ${HOME} -eu test local
+		printf | "$@" test grep echo printf
+		export export 'quoted text'
+-eu echo echo 'quoted text' x=1 ${HOME} printf done cd sed && echo
+	${HOME} && awk sed && echo /usr/bin $(pwd) cd /usr/bin sed
+	| 2>/dev/null done awk "$1" --verbose then && -eu | 'quoted text' "$1"
+		| && sed /usr/bin readonly && 'quoted text' x=1 "$@" $(pwd) ${HOME} "$@"
+x=1 export test echo | grep printf -eu awk x=1 cd echo local
+	sed $(pwd) $(pwd) echo -eu /usr/bin
+readonly /usr/bin $(pwd) local
+readonly grep readonly grep "$@" grep $(pwd) local 2>/dev/null export
+	--verbose echo cd local 'quoted text' echo /usr/bin "$1" echo printf
+		/usr/bin done --verbose ${HOME} grep
+		'quoted text' export echo echo "$@" 2>/dev/null "$1" | printf x=1 -eu
+		grep awk local "$1" "$1" awk 2>/dev/null "$@" ${HOME} readonly
+	then -eu export readonly
+x=1 export "$@" awk printf ${HOME} awk printf then x=1 readonly "$@" local export
+		&& done readonly | sed export $(pwd) "$1" echo -eu | export | done /usr/bin export
+"$@" then done grep --verbose "$1" readonly
+local grep sed echo readonly "$1" sed --verbose
+awk printf "$1" x=1 readonly grep awk x=1 --verbose awk 2>/dev/null
+'quoted text' local --verbose ${HOME} cd x=1 2>/dev/null local sed
+		2>/dev/null test cd | cd cd x=1 test sed | awk sed --verbose done -eu done -eu
+cd /usr/bin --verbose export grep /usr/bin "$@" -eu -eu export "$@" 'quoted text'
+awk && printf readonly local $(pwd) 2>/dev/null echo done "$1" 'quoted text'
+		/usr/bin -eu done done --verbose && "$@" awk done | 'quoted text'
+	awk echo -eu echo && 'quoted text' x=1 && x=1 printf awk "$1" --verbose
+	"$@" echo && export done | --verbose --verbose "$1"
+| x=1 then -eu printf printf export && then done ${HOME}
+awk export 'quoted text' then readonly
+echo "$1" --verbose | sed
+		$(pwd) sed printf $(pwd) test sed "$@" -eu local | readonly "$@" grep
+		'quoted text' $(pwd) grep grep -eu "$@" local "$@" /usr/bin
+/usr/bin && $(pwd) && | done cd "$@" test done echo 2>/dev/null && "$@" 'quoted text'
+export --verbose --verbose --verbose export | -eu grep awk --verbose && grep --verbose
+| done 2>/dev/null done awk | echo
+	sed && && export | ${HOME} 'quoted text'
+		${HOME} /usr/bin 'quoted text' | export done 2>/dev/null local
+x=1 2>/dev/null local test /usr/bin
+	printf grep -eu readonly && --verbose -eu export awk local --verbose
+echo --verbose cd $(pwd) grep done sed export 'quoted text' echo
+sed echo | cd 2>/dev/null echo /usr/bin 2>/dev/null
+		readonly local /usr/bin local && --verbose then printf x=1
+printf ${HOME} cd grep "$@"
+done "$@" 2>/dev/null export "$@" then | -eu && 2>/dev/null
+		awk done -eu done "$@" 2>/dev/null
+'quoted text' && ${HOME} local /usr/bin
+readonly ${HOME} && echo && "$1" grep local x=1 test printf x=1
+	export grep cd sed done "$1" then -eu cd grep awk test
+	$(pwd) | --verbose | 'quoted text' then grep "$@" "$@" local | | |
+readonly -eu "$@" $(pwd) ${HOME} done printf /usr/bin
+then -eu echo printf done cd ${HOME}
+		test echo ${HOME} printf
+sed -eu export 'quoted text' readonly sed awk done "$1"
+		'quoted text' cd sed $(pwd) --verbose sed done local -eu
+	echo "$@" echo awk ${HOME} export readonly
+	-eu grep "$@" 2>/dev/null /usr/bin cd && sed "$@" cd readonly 'quoted text' x=1
+		grep test 2>/dev/null readonly $(pwd) export
+		test echo cd cd done $(pwd)
+	--verbose && x=1 readonly
+local 'quoted text' "$@" --verbose --verbose ${HOME} printf printf cd printf
+		/usr/bin x=1 local done local | 'quoted text'
+	$(pwd) test export export && "$@" printf && export /usr/bin
+	'quoted text' "$1" test "$1" /usr/bin readonly sed && "$@" 'quoted text' 'quoted text'
+	grep 2>/dev/null export sed printf printf && sed x=1 cd
+		-eu cd awk --verbose 'quoted text' -eu | then x=1 "$1"
+	${HOME} then sed | test
+"$1" readonly awk printf readonly done /usr/bin -eu sed
+printf --verbose local ${HOME} $(pwd) export /usr/bin test "$@" done test
+	'quoted text' cd x=1 && -eu grep 2>/dev/null awk "$1"
+		then -eu 2>/dev/null readonly 'quoted text' grep grep && "$@" printf
+		local local 'quoted text' 2>/dev/null export cd local ${HOME} grep && | local
+		readonly "$1" readonly --verbose
+	'quoted text' export awk sed
+	${HOME} test --verbose awk local cd 2>/dev/null then awk
+	${HOME} -eu | -eu done
+sed test | -eu 2>/dev/null printf
+	-eu printf | echo local local cd $(pwd)
+${HOME} 'quoted text' && "$1" echo /usr/bin && then
+&& | 'quoted text' local x=1 $(pwd) then | /usr/bin
+grep "$1" test ${HOME} local
+	awk && printf then then echo "$1" test then 2>/dev/null export $(pwd) 'quoted text'
+		$(pwd) ${HOME} local $(pwd) readonly printf echo 2>/dev/null
+-eu 'quoted text' echo $(pwd) echo $(pwd) grep export
+		$(pwd) export $(pwd) awk && /usr/bin sed 2>/dev/null 'quoted text'
+		--verbose test cd -eu 'quoted text'
+grep | awk test cd local
+grep done cd --verbose -eu then ${HOME} grep -eu "$@" local 2>/dev/null 2>/dev/null
+x=1 echo done x=1 /usr/bin 'quoted text' && test --verbose -eu grep --verbose
+		| grep 'quoted text' export cd /usr/bin done awk
+	awk /usr/bin cd -eu readonly
+-eu -eu awk /usr/bin | 2>/dev/null -eu done awk echo -eu cd && done
+x=1 x=1 test ${HOME} test
+	awk export | printf && sed test readonly test
+'quoted text' -eu cd /usr/bin export printf && /usr/bin grep awk --verbose 2>/dev/null
+		/usr/bin ${HOME} 2>/dev/null --verbose "$1" ${HOME} 'quoted text'
+		"$1" 2>/dev/null -eu then awk sed 'quoted text' sed cd sed 'quoted text'
+		"$1" -eu 'quoted text' "$1" echo "$@" $(pwd) "$1" /usr/bin export awk -eu printf
+		"$@" printf printf ${HOME} --verbose sed | --verbose printf
+	grep | -eu cd awk done ${HOME} -eu 2>/dev/null x=1 $(pwd) cd grep
+	cd done test echo --verbose sed "$@" "$1" 'quoted text'
+	/usr/bin cd -eu /usr/bin echo x=1 sed then cd done x=1 &&
+		--verbose x=1 printf $(pwd) readonly cd grep x=1
+		grep cd --verbose sed
+	then /usr/bin "$@" then printf
+	-eu readonly printf local cd awk printf
+grep 'quoted text' "$1" "$1" ${HOME} awk local printf "$@" &&
+	local 2>/dev/null export test
+		-eu then readonly printf awk
+	2>/dev/null "$1" cd /usr/bin && done /usr/bin printf then
+test /usr/bin x=1 2>/dev/null then x=1 | cd "$@"
+	then echo then test -eu printf &&
+-eu sed 'quoted text' echo readonly
+		$(pwd) 2>/dev/null | printf echo printf cd awk done
+	--verbose printf sed test then awk then $(pwd) /usr/bin test echo --verbose
+	local --verbose $(pwd) "$1" done local grep "$@" awk -eu grep --verbose
+	grep 'quoted text' ${HOME} sed export
+readonly awk then 2>/dev/null 2>/dev/null -eu then 'quoted text' --verbose cd
+		"$@" echo cd "$@" echo x=1 grep readonly local "$@" --verbose
+	printf awk x=1 done awk ${HOME} | awk sed $(pwd)
+		local ${HOME} && local /usr/bin awk printf sed then ${HOME}
+		local grep echo sed "$1" && echo /usr/bin sed export test
+	'quoted text' test $(pwd) && then | sed awk && local
+	readonly 2>/dev/null && | export test local export then $(pwd)
+		2>/dev/null "$@" then && readonly "$@" cd $(pwd) cd export sed 'quoted text'
+	--verbose "$@" -eu awk echo
+	${HOME} awk echo done "$@" | | echo && ${HOME} cd printf x=1 local $(pwd)
+		| 'quoted text' ${HOME} test local cd | -eu x=1 $(pwd) echo then && test
+	sed local --verbose local export
+	2>/dev/null | --verbose awk awk $(pwd) ${HOME} x=1 grep x=1 |
+		echo 'quoted text' then done 'quoted text' export
+x=1 && then then --verbose "$1" $(pwd) "$1" "$@"
+awk -eu /usr/bin --verbose | echo export /usr/bin 'quoted text' -eu -eu readonly
+-eu echo x=1 ${HOME} && 'quoted text' "$1"
+readonly done 2>/dev/null "$1" --verbose export 'quoted text' | readonly
+-eu 2>/dev/null echo ${HOME} done test 'quoted text' done 'quoted text'
+$(pwd) sed && /usr/bin then && $(pwd)
+		--verbose done then test ${HOME} ${HOME}
+		/usr/bin test then sed "$1" cd /usr/bin && "$@" | "$1" 'quoted text'
+	'quoted text' 'quoted text' printf
+	x=1 then export local sed | echo | awk
+grep ${HOME} done then export done x=1 awk "$1"
+$(pwd) x=1 x=1 awk "$@" sed -eu | printf echo "$@" ${HOME} echo
+'quoted text' export x=1 "$1" done echo sed ${HOME}
+${HOME} done cd /usr/bin done then | ${HOME} test printf test export
+"$1" $(pwd) test local awk test 'quoted text' x=1 "$1"
+		${HOME} awk awk then "$1" | "$@" readonly x=1
+echo --verbose echo sed "$@" cd /usr/bin sed export readonly local | ${HOME}
+	printf then "$1" awk $(pwd) && ${HOME} -eu --verbose "$1" "$@" -eu printf /usr/bin
+test 'quoted text' cd awk readonly 'quoted text' awk then -eu sed test x=1
+${HOME} cd $(pwd) /usr/bin | | "$@" cd -eu -eu printf && --verbose
+	test local ${HOME} awk -eu awk test readonly /usr/bin sed --verbose x=1
+	x=1 then then "$@" awk test export test readonly /usr/bin
+		$(pwd) 2>/dev/null grep 'quoted text' ${HOME} readonly
+"$1" printf sed "$1" && awk ${HOME} local --verbose 'quoted text'
+		x=1 local done x=1 cd readonly 'quoted text' sed x=1 && && grep local
+awk "$1" awk && -eu echo ${HOME}
+grep grep | "$1" /usr/bin "$1"
+	--verbose awk /usr/bin | echo x=1 grep "$@" ${HOME} ${HOME}
+		local local test 'quoted text' sed
+		printf -eu /usr/bin --verbose /usr/bin $(pwd) && x=1 /usr/bin
+awk -eu test 2>/dev/null "$1" /usr/bin -eu export cd "$@"
+		test -eu "$@" export then export test
+	awk x=1 local test printf grep echo $(pwd) done
+	2>/dev/null readonly | done export 'quoted text'
+--verbose local --verbose grep readonly cd printf $(pwd) --verbose
+	local $(pwd) $(pwd) sed --verbose export then "$1" | && export -eu export
+grep cd /usr/bin | local then 'quoted text'
+	export "$@" done /usr/bin
+		2>/dev/null && 'quoted text' | 'quoted text' test 'quoted text' --verbose
+	readonly echo done --verbose 2>/dev/null then "$@"
+	$(pwd) && cd x=1 readonly done local &&
+		then ${HOME} readonly local
+		printf sed 'quoted text' | awk echo sed printf x=1
+		done grep && /usr/bin ${HOME} && export "$@"
+		2>/dev/null && "$@" printf 'quoted text' printf | test then grep
+	export "$@" echo echo
+	cd readonly ${HOME} x=1 ${HOME} awk /usr/bin
+	then export grep grep done printf 'quoted text' -eu local -eu /usr/bin echo printf
+	'quoted text' sed test 'quoted text' test local 2>/dev/null done cd ${HOME} awk
+		awk done "$@" /usr/bin done --verbose echo export readonly printf
+| x=1 'quoted text' readonly
+	local $(pwd) test awk done 'quoted text' x=1 && awk cd && 2>/dev/null
+export local /usr/bin --verbose local && -eu local
+	x=1 | --verbose --verbose test sed
+	test test sed --verbose x=1 printf sed /usr/bin /usr/bin cd ${HOME}
+		cd x=1 x=1 cd awk export
+	local then readonly done test readonly test export "$1" sed 2>/dev/null readonly
+	awk | done --verbose 'quoted text' x=1 $(pwd) readonly
+	--verbose grep done --verbose test readonly 'quoted text' x=1 test echo x=1 local
+		readonly | local x=1 then
+&& grep readonly | | echo x=1 local test ${HOME}
+		x=1 done export sed 'quoted text' export then export 'quoted text' x=1 x=1
+		awk local "$1" awk $(pwd)
+sed $(pwd) --verbose 2>/dev/null 2>/dev/null x=1
+	export /usr/bin -eu export awk $(pwd) "$1" "$1" done "$@"
+	done | --verbose awk awk 2>/dev/null sed | --verbose
+awk readonly export /usr/bin awk export export $(pwd) $(pwd) ${HOME} readonly
+		2>/dev/null local printf then "$1" export done x=1 'quoted text'
+export grep then export export awk export &&
+		'quoted text' -eu "$@" 'quoted text'
+	printf x=1 /usr/bin ${HOME}
+		"$@" --verbose sed -eu | cd && /usr/bin cd sed local /usr/bin
+		cd grep -eu readonly sed "$@" local /usr/bin readonly 'quoted text' readonly sed
+		'quoted text' x=1 test sed cd "$@"
+		local "$1" "$@" grep && /usr/bin done
+	&& cd x=1 $(pwd) then /usr/bin cd
+		"$1" export printf 'quoted text' --verbose
+	local then printf printf local $(pwd) ${HOME} echo 2>/dev/null && &&
+		${HOME} then test local $(pwd) printf sed /usr/bin echo then cd -eu
+	readonly done --verbose echo sed then export $(pwd) | "$1" 'quoted text' $(pwd)
+		$(pwd) $(pwd) ${HOME} export done readonly done && grep /usr/bin /usr/bin
+		done -eu --verbose printf -eu | 'quoted text'
+export grep "$@" 'quoted text' | 'quoted text' test -eu $(pwd) grep grep 2>/dev/null
+"$1" awk x=1 done 2>/dev/null cd export | "$@" export /usr/bin cd ${HOME} "$1"
+	sed ${HOME} /usr/bin readonly grep x=1 $(pwd) then echo | "$@" "$@" export ${HOME}
+2>/dev/null ${HOME} $(pwd) echo
+	echo awk --verbose && echo -eu awk --verbose
+	2>/dev/null --verbose --verbose then --verbose | 'quoted text'
+		awk cd /usr/bin cd awk awk done export "$1" x=1 grep
+		&& readonly ${HOME} local sed "$1" "$@" local
+--verbose printf -eu
+		done then readonly $(pwd) done done "$1" grep --verbose
+		| sed && x=1 x=1 "$1" printf -eu sed test 2>/dev/null done
+	"$@" 2>/dev/null 2>/dev/null printf x=1
+	/usr/bin sed -eu then ${HOME} awk awk done
+| 2>/dev/null 2>/dev/null local grep printf ${HOME} sed test awk
+		sed /usr/bin ${HOME}
+		done $(pwd) export ${HOME} && "$@" then "$@" printf done 2>/dev/null
+then | done done "$1"
+readonly && then sed --verbose 'quoted text'
+x=1 then -eu echo && export /usr/bin sed $(pwd) cd export "$@" "$@" "$1"
+	'quoted text' then local echo x=1
+readonly readonly test printf 'quoted text' x=1 test
+	test test | local "$1" done test
+	| 2>/dev/null "$1" grep local awk "$1" done && then 2>/dev/null
+grep export test done awk "$1"
+	cd /usr/bin && grep sed && done then
+done | grep cd && "$1" sed then
+"$@" sed readonly ${HOME} grep |
+		export "$1" --verbose /usr/bin && printf printf readonly
+2>/dev/null echo awk "$@" local echo
+done ${HOME} done /usr/bin ${HOME}
+		| x=1 2>/dev/null && --verbose awk grep done cd x=1 echo x=1 echo x=1 x=1 readonly
+	then test test readonly "$1" "$1" "$1" &&
+	/usr/bin ${HOME} export readonly local cd
+	sed --verbose /usr/bin
+	2>/dev/null 2>/dev/null && "$1" test then done done 'quoted text'
+	echo "$1" local test readonly cd 'quoted text'
+	sed -eu echo && ${HOME} awk 2>/dev/null export then cd "$1"
+		"$1" | -eu | cd local "$1" cd /usr/bin awk $(pwd)
+	$(pwd) "$1" export test export x=1 /usr/bin done
+		awk "$@" echo | grep $(pwd) "$1" "$1" ${HOME} -eu | --verbose
+	export sed && export readonly cd "$@" && test x=1 /usr/bin done 'quoted text'
+	done test awk "$1" --verbose sed awk done echo "$1" /usr/bin
+	awk then sed --verbose x=1 "$@" -eu -eu readonly --verbose
+	awk && local then awk "$1" ${HOME} done readonly done printf local cd /usr/bin
+		--verbose x=1 x=1 /usr/bin 'quoted text' x=1 done && 2>/dev/null awk
+x=1 2>/dev/null 'quoted text' "$1" "$1" 'quoted text' 2>/dev/null local done
+done x=1 2>/dev/null then -eu test "$1" | export awk test local readonly --verbose
+		"$1" 2>/dev/null ${HOME} awk export grep
+	printf && ${HOME} test done then 'quoted text' sed "$1" printf sed printf
+		test done "$1" -eu local echo readonly $(pwd) grep | readonly && ${HOME} readonly
+		-eu ${HOME} && awk export done printf x=1 export 'quoted text'
+	| /usr/bin ${HOME} /usr/bin /usr/bin 'quoted text'
+		2>/dev/null done sed "$@" local readonly | "$1" echo | cd "$1" 'quoted text'
+	readonly "$@" sed | printf
+then | echo awk echo echo "$@" 2>/dev/null
+		test grep test awk /usr/bin done | cd done grep ${HOME}
+| test echo && | done printf $(pwd) $(pwd) -eu 'quoted text' /usr/bin local
+	grep -eu /usr/bin && --verbose | echo "$@"
+#include c140.sh
+		then "$@" 2>/dev/null ${HOME} 2>/dev/null sed cd ${HOME}
+echo awk grep done awk --verbose "$@"
+readonly x=1 printf "$@" --verbose /usr/bin ${HOME} printf x=1
+2>/dev/null readonly readonly 'quoted text' export done "$@" sed cd done
+	sed echo && x=1 "$@" sed done printf awk test printf
+		grep && | 2>/dev/null cd awk "$@" readonly cd && grep cd
+grep --verbose | readonly cd test echo "$1" 'quoted text'
+export readonly export ${HOME} -eu printf ${HOME} ${HOME} "$1" readonly
+	local cd ${HOME} ${HOME} echo && then cd grep
+	'quoted text' $(pwd) local 2>/dev/null
+cd echo local local echo
+		"$@" 'quoted text' -eu then 'quoted text'
+	done done done --verbose then && | readonly && cd export
+"$@" /usr/bin sed $(pwd) --verbose -eu 2>/dev/null
+		"$1" grep cd echo cd export "$1" echo test
+		&& grep x=1 ${HOME} then cd "$1" done printf
+	readonly cd local $(pwd) --verbose && "$@" && done 'quoted text'
+		grep x=1 /usr/bin 'quoted text' | echo | then "$1" test -eu x=1 then &&
+	--verbose then readonly test && readonly sed echo grep cd grep then | awk $(pwd)
+export grep && cd sed echo x=1 $(pwd) x=1 'quoted text'
+done "$1" "$@" $(pwd) "$@" $(pwd) 'quoted text' -eu
+	/usr/bin x=1 "$@" $(pwd) done sed --verbose awk done 2>/dev/null
+2>/dev/null "$@" /usr/bin
+	x=1 echo sed 2>/dev/null | /usr/bin "$1" --verbose cd -eu export
+	sed "$@" local | "$@" cd 2>/dev/null printf
+$(pwd) grep 'quoted text' ${HOME}
+		2>/dev/null then | awk then 2>/dev/null | && done grep done
+	echo test /usr/bin local "$@" ${HOME} test
+	echo 2>/dev/null done $(pwd) export "$@" grep echo
+--verbose echo echo echo /usr/bin $(pwd) sed && 2>/dev/null "$@" awk "$@" "$1"
+		sed done local readonly readonly $(pwd)
+		local $(pwd) export $(pwd) grep "$@"
+${HOME} $(pwd) done echo export
+"$1" local sed | sed local sed echo ${HOME} ${HOME} grep
+		grep done ${HOME} | "$@" 2>/dev/null
+	echo && readonly grep 2>/dev/null printf then grep echo | "$@"
+	&& printf && echo awk --verbose "$@" readonly export done awk
+"$@" printf cd --verbose $(pwd)
+	x=1 --verbose then readonly done
+		awk echo printf 2>/dev/null "$@" ${HOME}
+		--verbose "$@" cd && test "$@" "$1" 2>/dev/null sed done local 'quoted text'
+	x=1 export 2>/dev/null printf 'quoted text' done -eu &&
+done readonly && $(pwd) "$1" echo "$1" then 2>/dev/null
+	| 'quoted text' && -eu cd export --verbose x=1 grep printf echo
+&& printf grep --verbose readonly export done echo x=1 /usr/bin
+	/usr/bin done printf done ${HOME} "$@" ${HOME} echo test --verbose
+sed printf $(pwd) x=1 sed "$@"
+	then | --verbose cd printf "$1" printf $(pwd) cd test printf $(pwd)
+		&& ${HOME} $(pwd) "$1" grep then && x=1 -eu cd | cd --verbose 2>/dev/null local
+		$(pwd) 2>/dev/null --verbose "$@"
+		x=1 then local sed --verbose then echo then x=1 | "$@"
+-eu x=1 local /usr/bin && | "$1" 2>/dev/null
+	/usr/bin && readonly export ${HOME} printf x=1 test grep echo $(pwd)
+	test awk grep $(pwd) readonly done x=1 done local "$1" printf $(pwd)
+'quoted text' awk sed done -eu local grep ${HOME} | awk test $(pwd) export readonly
+		"$@" sed sed sed echo cd sed printf
+	$(pwd) test 'quoted text' export ${HOME} readonly grep cd ${HOME}
+export cd export 'quoted text' /usr/bin awk local export grep local then
+	test /usr/bin then readonly readonly cd awk
+		2>/dev/null grep 'quoted text'
+| && && echo test "$@" "$@" awk | readonly
+	export x=1 readonly export 'quoted text'
+		'quoted text' && local --verbose cd ${HOME} 'quoted text' "$1"
+		-eu "$@" sed readonly && test -eu echo printf awk ${HOME} sed ${HOME}
+echo 2>/dev/null awk then $(pwd) $(pwd) && test readonly local 'quoted text'
+sed "$1" x=1 /usr/bin 2>/dev/null 'quoted text'
+	$(pwd) test test ${HOME} echo
+		echo cd && -eu printf --verbose | "$1" && sed && /usr/bin test "$@" test grep
+		/usr/bin grep "$1" -eu
+done cd sed -eu $(pwd) /usr/bin ${HOME} $(pwd) "$@" "$@" "$@" 2>/dev/null
+| export 2>/dev/null 'quoted text' sed x=1 "$1" echo --verbose
+	-eu /usr/bin 'quoted text' done "$@" done -eu done && $(pwd) --verbose
+	"$@" 2>/dev/null x=1 sed readonly | -eu /usr/bin "$@" done "$1" grep
+	2>/dev/null "$1" -eu test local done | 2>/dev/null cd grep x=1 ${HOME}
+	done "$@" | "$1" test export export cd
+	export 'quoted text' grep then
+	/usr/bin test awk export 2>/dev/null "$1" sed 'quoted text' export readonly
+		done test "$@" printf -eu printf export done awk
+	| readonly cd readonly ${HOME}
+		${HOME} cd /usr/bin 'quoted text'
+--verbose --verbose | 'quoted text' x=1 printf 'quoted text'
+	export local 'quoted text'
+		--verbose $(pwd) 2>/dev/null awk --verbose $(pwd) local done /usr/bin x=1
+test ${HOME} $(pwd) && 'quoted text' export
+	done $(pwd) $(pwd) "$1" done readonly "$@" "$@" | --verbose 'quoted text' readonly
+		$(pwd) cd x=1 test $(pwd) ${HOME} cd | "$@" 2>/dev/null 'quoted text'
+		cd "$1" "$1" x=1 awk $(pwd) local
+		test grep awk -eu "$@" done x=1 grep
+		x=1 2>/dev/null "$@" readonly
+printf cd sed "$1" ${HOME} && grep
+		awk "$@" -eu ${HOME} 2>/dev/null "$1" then -eu ${HOME}
+awk /usr/bin printf 'quoted text' 2>/dev/null export /usr/bin test
+	done export awk -eu 2>/dev/null sed readonly
+		readonly grep local sed test test 'quoted text' sed
+		--verbose "$1" 'quoted text' 2>/dev/null echo cd local -eu
+		--verbose 2>/dev/null then $(pwd) awk 'quoted text' cd local echo
+		then "$@" test | --verbose | then cd "$@" then test readonly --verbose
+	'quoted text' test printf "$@" 2>/dev/null local export $(pwd) 'quoted text'
+		done "$@" awk printf readonly done printf
+	local 'quoted text' --verbose 'quoted text'
+"$1" /usr/bin done $(pwd) ${HOME} -eu "$@" test x=1 --verbose awk ${HOME}
+	printf /usr/bin then done --verbose
+done ${HOME} printf grep 2>/dev/null sed $(pwd) | /usr/bin -eu
+		2>/dev/null readonly printf 2>/dev/null cd then 2>/dev/null $(pwd) sed 2>/dev/null
+		cd local local sed echo export ${HOME} -eu printf
+		local | grep $(pwd) export -eu && readonly -eu awk x=1 2>/dev/null x=1 test
+local then 'quoted text' readonly
+		then | /usr/bin test awk done local "$@" local $(pwd) $(pwd) | -eu done "$1" "$1"
+		x=1 | 2>/dev/null then "$@" test sed x=1 local local $(pwd) printf "$1"
+	-eu sed $(pwd) echo x=1 echo ${HOME}
+export 2>/dev/null && readonly echo done grep x=1 grep
+"$@" grep 'quoted text' readonly test
+		2>/dev/null awk readonly
+		grep echo printf ${HOME} test "$@" 2>/dev/null
+		done ${HOME} test local then --verbose |
+'quoted text' -eu | cd | x=1 "$@" $(pwd) $(pwd) -eu export 2>/dev/null 2>/dev/null
+	test | /usr/bin cd /usr/bin test done awk
+		'quoted text' then printf export
+		-eu /usr/bin "$@" $(pwd) 'quoted text'
+/usr/bin 'quoted text' --verbose | 2>/dev/null ${HOME} readonly
+"$@" $(pwd) | cd /usr/bin -eu 'quoted text' readonly awk test /usr/bin echo
+export done grep done sed grep local echo ${HOME} /usr/bin
+	-eu 'quoted text' --verbose /usr/bin then
+	echo readonly 2>/dev/null --verbose ${HOME} "$@" readonly
+/usr/bin 2>/dev/null 2>/dev/null "$@" awk --verbose
+local ${HOME} 'quoted text' cd && grep "$@"
+-eu echo printf local printf "$@" /usr/bin grep && -eu export echo test &&
+		echo cd -eu sed 2>/dev/null local x=1 && $(pwd) 'quoted text' | then -eu
+	cd 'quoted text' awk grep "$1" --verbose "$@" /usr/bin | $(pwd) 'quoted text'
+/usr/bin "$@" 2>/dev/null && $(pwd) sed echo | test -eu 'quoted text'
+		"$@" local sed -eu sed -eu -eu echo ${HOME} sed sed 2>/dev/null
+		awk -eu test printf /usr/bin 2>/dev/null | "$1"
+	export x=1 grep then $(pwd)
+export x=1 'quoted text' printf
+		x=1 local sed --verbose
+'quoted text' "$1" --verbose -eu
+	test $(pwd) done $(pwd) $(pwd) awk grep $(pwd) awk 'quoted text' "$1" printf
+	then /usr/bin awk && awk
+grep && printf ${HOME} -eu test test
+"$@" then local 'quoted text'
+sed /usr/bin --verbose then --verbose readonly
+/usr/bin 'quoted text' --verbose done test readonly printf
+		x=1 awk done "$@" "$1" x=1 -eu local grep | printf done then readonly
+	--verbose | readonly x=1 "$@" /usr/bin
+"$1" export --verbose export readonly grep 'quoted text' local 'quoted text'
+		"$@" sed cd -eu "$@" && -eu | done then grep ${HOME} awk /usr/bin readonly done
+	then echo then && 'quoted text' printf 'quoted text' awk $(pwd) grep
+		readonly readonly x=1 | test cd x=1
+-eu "$1" grep export -eu awk cd sed export ${HOME}
+		2>/dev/null x=1 -eu | local
+	echo /usr/bin then awk then | cd export ${HOME} local awk ${HOME}
+x=1 $(pwd) --verbose | grep grep | /usr/bin
+		test sed sed /usr/bin 2>/dev/null 2>/dev/null sed
+test grep 'quoted text' x=1 printf cd 'quoted text'
+	cd sed grep 2>/dev/null && grep awk sed awk && /usr/bin ${HOME} printf cd ${HOME}
+		awk "$@" -eu --verbose 2>/dev/null
+		sed sed test printf sed then x=1 ${HOME} test x=1 done x=1 cd awk test grep 2>/dev/null
+		grep grep x=1 done export printf /usr/bin && echo && --verbose /usr/bin 'quoted text'
+"$@" /usr/bin -eu test echo
+--verbose "$@" export test test /usr/bin
+	echo x=1 export printf local 'quoted text' -eu "$@" "$@" | /usr/bin
+printf | echo --verbose && "$1" ${HOME} grep echo readonly 'quoted text'
+		| sed awk readonly 'quoted text' then | done done /usr/bin export -eu readonly
+readonly done -eu -eu readonly && echo | sed readonly
+	printf "$@" readonly grep export 2>/dev/null readonly
+	${HOME} ${HOME} && $(pwd)
+	grep --verbose cd /usr/bin test cd x=1 done echo then --verbose export
+/usr/bin local 'quoted text' | done -eu printf sed test echo &&
+		cd then | 'quoted text'
+	--verbose local printf export "$1" 2>/dev/null then
+		$(pwd) done local $(pwd) local
+	echo "$1" 2>/dev/null | then awk ${HOME} test test
+		| done then printf "$@" local x=1
+readonly readonly | export --verbose then local echo |
+/usr/bin 'quoted text' | | cd ${HOME} | /usr/bin local
+		local awk done readonly
+	| 'quoted text' | 'quoted text' 'quoted text'
+		sed local cd readonly local export $(pwd) && 'quoted text'
+	| | echo test ${HOME} 2>/dev/null ${HOME} ${HOME} ${HOME} cd export printf
+	awk printf echo echo done local &&
+2>/dev/null export | export ${HOME} ${HOME} test export awk test
+		awk 2>/dev/null "$@" grep 'quoted text'
+test "$1" readonly grep "$1" 2>/dev/null
+	cd local x=1 done echo
+	/usr/bin then 2>/dev/null 2>/dev/null
+	test local printf local sed --verbose grep export grep sed 2>/dev/null
+	/usr/bin test "$@" done "$1" grep | grep "$1"
+readonly --verbose sed export "$@" "$1" --verbose "$@" x=1 && -eu sed grep cd
+		export x=1 -eu --verbose && | --verbose cd done -eu local then /usr/bin
+		sed grep 2>/dev/null sed awk cd grep then ${HOME} --verbose x=1 $(pwd) grep test
+	local -eu done "$@" && test printf done test 2>/dev/null
+	${HOME} && then printf local awk
+	2>/dev/null $(pwd) awk | grep sed then && && /usr/bin 2>/dev/null /usr/bin
+		cd printf x=1 ${HOME} export
+then done 2>/dev/null /usr/bin x=1 then sed export
+local printf sed done awk echo /usr/bin 'quoted text' "$@" /usr/bin
+	cd && "$1" --verbose export 'quoted text'
+		x=1 grep && && readonly
+	/usr/bin | /usr/bin | "$@" $(pwd) /usr/bin local /usr/bin
+	--verbose && test local $(pwd) "$1" -eu 2>/dev/null x=1 x=1
+	cd /usr/bin awk 2>/dev/null test | "$@" printf done x=1 2>/dev/null printf cd |
+/usr/bin then 2>/dev/null then readonly
+"$@" 2>/dev/null /usr/bin && "$@" $(pwd) done echo printf
+		2>/dev/null 'quoted text' printf $(pwd)
+	printf "$@" x=1 x=1 then sed --verbose /usr/bin sed "$@" --verbose cd x=1 2>/dev/null
+printf 'quoted text' 'quoted text' x=1 --verbose
+		cd ${HOME} cd ${HOME} x=1 cd readonly local "$1" echo done ${HOME} "$1" test
+		grep awk readonly local $(pwd) done
+		done 2>/dev/null readonly
+test | then echo test cd test cd grep
+	done echo $(pwd) printf grep then 2>/dev/null x=1 && test readonly
+		awk echo then $(pwd) "$1" awk "$@"
+local test sed && | "$@" local | sed printf "$@" "$@" awk 'quoted text'
+	grep "$1" --verbose -eu x=1 awk -eu -eu grep awk grep echo ${HOME} readonly
+		-eu then export -eu then "$@" done $(pwd) sed readonly x=1 printf
+| 'quoted text' test done 'quoted text'
+readonly done ${HOME} && "$@" --verbose x=1 readonly local local
+		printf readonly cd cd local x=1 &&
+-eu "$@" printf local done --verbose awk test -eu
+	x=1 done local local x=1 cd done local then /usr/bin test awk printf &&
+	${HOME} x=1 "$1" local
+then readonly --verbose $(pwd) done
+		| export export done grep | done --verbose awk ${HOME} x=1 done && --verbose
+		export cd echo test printf "$1" x=1 | printf ${HOME} ${HOME} readonly
+-eu 2>/dev/null ${HOME}
+readonly 'quoted text' then echo echo /usr/bin $(pwd) 'quoted text'
+grep then grep 'quoted text' $(pwd) local
+"$@" echo $(pwd) awk readonly x=1 done -eu test awk 'quoted text'
+	export then printf readonly ${HOME} && 2>/dev/null "$1"
+"$@" "$1" -eu export local
+		export /usr/bin --verbose -eu 2>/dev/null awk sed
+		x=1 $(pwd) --verbose local --verbose
+done sed --verbose export "$@" $(pwd) readonly
+"$1" then ${HOME} grep local 'quoted text' "$1"
+export | readonly | $(pwd) x=1 2>/dev/null
+| ${HOME} 2>/dev/null then awk $(pwd) ${HOME} grep /usr/bin "$1"
+	"$@" -eu ${HOME} --verbose x=1 export grep && 2>/dev/null -eu
+&& 2>/dev/null grep --verbose then 2>/dev/null done 'quoted text' --verbose
+	| then $(pwd) readonly done
+printf 2>/dev/null printf then test awk echo -eu cd
+		"$1" export "$1" && readonly
+	then -eu grep export awk awk "$@" printf export --verbose local grep cd
+		2>/dev/null echo grep local test sed sed printf 'quoted text'
+		${HOME} cd x=1 && done grep done local printf echo local export ${HOME}
+	then readonly ${HOME} ${HOME} export "$1" | grep grep x=1 awk "$@"
+	local done sed local 'quoted text' readonly ${HOME} printf local readonly
+	readonly awk "$@" done 'quoted text' 2>/dev/null $(pwd)
+	--verbose sed cd sed && printf done cd
+		grep x=1 grep cd "$1" cd sed "$1" readonly awk ${HOME}
+-eu echo sed && 2>/dev/null --verbose echo printf awk awk
+	| x=1 'quoted text' 'quoted text' sed x=1 then 'quoted text' export readonly
+cd echo test local "$1" /usr/bin echo printf
+		sed readonly cd x=1 -eu
+printf --verbose "$@" && cd local cd sed local --verbose 2>/dev/null
+		export "$@" "$1" echo /usr/bin x=1 $(pwd)
+	cd cd | echo /usr/bin 'quoted text' awk grep /usr/bin
+	export | | -eu "$@" 2>/dev/null cd local awk $(pwd) readonly readonly ${HOME}
+		${HOME} -eu x=1 && ${HOME} x=1 echo -eu test test | printf awk grep test awk
+	'quoted text' readonly export 'quoted text'
+	readonly "$1" readonly done --verbose && ${HOME} done ${HOME} cd
+		cd sed | printf 2>/dev/null | -eu awk done
+	cd awk "$@" | test ${HOME} /usr/bin
+local | sed && "$1" ${HOME} 2>/dev/null cd cd $(pwd) --verbose
+/usr/bin cd "$@" sed grep 'quoted text' done &&
+		then /usr/bin readonly -eu then test echo cd then $(pwd)
+		"$1" "$@" "$@" 2>/dev/null $(pwd) "$1" cd awk export echo done done awk $(pwd) |
+	$(pwd) | && local 'quoted text' echo /usr/bin "$@" echo | "$@" grep --verbose
+	$(pwd) x=1 -eu 'quoted text' awk test echo "$1" grep | 2>/dev/null test
+sed export "$@" export printf
+		export $(pwd) cd x=1 --verbose local --verbose "$1" -eu then --verbose --verbose
+	export readonly --verbose 'quoted text' export printf 'quoted text' "$1"
+		echo && local $(pwd) awk done /usr/bin then sed grep "$1" "$@" cd | "$@" --verbose
+		printf "$@" $(pwd) cd | local
+awk export grep export -eu printf awk "$1"
+readonly x=1 && x=1 /usr/bin
+	2>/dev/null "$@" cd | && grep -eu "$1" then 2>/dev/null "$@"
+sed echo 2>/dev/null | --verbose then --verbose awk "$@" | grep sed "$@"
+	--verbose cd local readonly cd readonly cd "$@" 'quoted text' x=1 export
+echo cd echo test printf x=1 readonly readonly 'quoted text'
+$(pwd) done "$1" "$1" grep "$1" "$1" echo grep awk "$@" "$@" sed cd sed
+	"$1" $(pwd) --verbose "$@" $(pwd) x=1 grep awk test /usr/bin /usr/bin grep 2>/dev/null
+printf ${HOME} done 2>/dev/null | then
+	'quoted text' $(pwd) then ${HOME} sed 2>/dev/null echo
+	test x=1 grep local sed readonly grep ${HOME} local awk 'quoted text'
+		/usr/bin ${HOME} printf then export echo --verbose $(pwd) readonly
+	"$1" awk ${HOME} echo echo awk && 2>/dev/null sed echo -eu done readonly readonly
+	echo 'quoted text' readonly sed sed "$1"
+	then readonly -eu sed && "$@" printf
+	test grep -eu "$@" awk grep printf
+		| 'quoted text' grep local | then export cd export test printf ${HOME}
+		sed echo done then -eu echo then "$1"
+	-eu ${HOME} echo printf
+-eu readonly cd $(pwd) "$1" -eu 'quoted text' done "$@" test -eu && local
+		sed -eu -eu echo readonly x=1 | ${HOME} export | done awk export $(pwd) 'quoted text'
+2>/dev/null 2>/dev/null export 'quoted text'
+		local ${HOME} grep "$@" printf | /usr/bin $(pwd) /usr/bin then
+	grep 2>/dev/null echo /usr/bin
+		then | sed then printf printf $(pwd)
+		grep $(pwd) sed cd x=1 && $(pwd)
+	'quoted text' export grep local 2>/dev/null
+	x=1 x=1 $(pwd) awk -eu && done printf
+| printf 'quoted text' /usr/bin local awk
+	cd grep readonly --verbose
+		awk | cd "$@" ${HOME} 2>/dev/null
+	"$1" printf awk /usr/bin --verbose -eu done printf test -eu grep "$@" awk
+		-eu "$1" echo printf awk export "$@" /usr/bin
+-eu /usr/bin local 'quoted text' grep printf ${HOME} grep
+--verbose $(pwd) export sed /usr/bin printf echo echo export done /usr/bin 'quoted text'
+	'quoted text' "$@" echo -eu readonly && export "$@" 2>/dev/null
+		local local /usr/bin done readonly 'quoted text' test
+printf local awk echo sed $(pwd) done --verbose then echo "$1" readonly awk $(pwd)
+	--verbose sed done 'quoted text' local --verbose sed ${HOME} echo --verbose
+		x=1 "$@" readonly sed local test --verbose then && /usr/bin then
+2>/dev/null then 'quoted text' --verbose echo sed | echo echo readonly awk
+		&& then readonly sed $(pwd) then then
+${HOME} done export "$1" then readonly readonly cd then --verbose $(pwd) printf
+readonly 'quoted text' "$1" $(pwd) test cd test
+		x=1 export readonly local "$1" cd /usr/bin "$@" x=1 ${HOME} grep x=1
+"$1" x=1 local 'quoted text' export
+sed $(pwd) awk /usr/bin done ${HOME} readonly | test "$@" cd export export
+		local $(pwd) readonly test
+		'quoted text' readonly
+	grep export "$@" cd && ${HOME} /usr/bin echo "$@" 'quoted text'
+		&& echo readonly sed readonly done --verbose && grep && awk
+2>/dev/null $(pwd) | awk echo echo awk
+/usr/bin grep 'quoted text' 2>/dev/null -eu test then --verbose printf grep
+		| grep readonly export "$@" $(pwd)
+	export ${HOME} test -eu ${HOME}
+		$(pwd) grep && readonly --verbose --verbose export done sed readonly "$1"
+	${HOME} cd readonly "$@" export x=1 x=1 sed --verbose
+	echo "$@" -eu | done x=1 export 'quoted text'
+	test -eu -eu echo readonly ${HOME} 2>/dev/null "$1" echo test
+"$@" awk && done test 2>/dev/null grep 2>/dev/null then
+readonly grep 2>/dev/null 'quoted text' sed -eu 2>/dev/null --verbose done
+x=1 && readonly local x=1 x=1 $(pwd) export 'quoted text' x=1 && then --verbose
+		then cd "$1" x=1 printf /usr/bin -eu
+		/usr/bin --verbose $(pwd) 'quoted text' --verbose "$@" "$1" ${HOME}
+		"$@" 'quoted text' "$1" printf x=1 "$@" printf $(pwd) done 'quoted text'
+x=1 done printf test $(pwd) readonly test "$@" 'quoted text' $(pwd) 2>/dev/null
+	-eu | "$1" echo 'quoted text' printf printf
+	x=1 "$@" -eu grep local -eu x=1 awk local
+x=1 local --verbose $(pwd) x=1 /usr/bin /usr/bin sed "$1"
+		/usr/bin grep 2>/dev/null /usr/bin
+		grep -eu local grep then "$1" awk -eu 2>/dev/null
+	2>/dev/null | done test x=1 2>/dev/null local 'quoted text' grep printf x=1 |
+	&& "$1" /usr/bin awk local "$@" done awk test ${HOME} -eu done
+	printf -eu -eu /usr/bin grep x=1 local test awk x=1 x=1 export then echo readonly
+		export local $(pwd) echo --verbose grep then echo readonly local
+	sed export export local export
+	'quoted text' 2>/dev/null readonly
+	/usr/bin -eu 'quoted text' -eu /usr/bin "$@" then | | readonly
+2>/dev/null --verbose "$@" $(pwd) | local echo -eu $(pwd)
+		$(pwd) then grep ${HOME}
+		cd then 2>/dev/null cd | readonly printf then
+2>/dev/null sed grep local --verbose readonly ${HOME}
+		/usr/bin done "$1" x=1
+		-eu local printf grep export "$1" done 2>/dev/null
+	sed "$@" --verbose ${HOME} $(pwd) done x=1 printf echo printf
+		"$1" x=1 "$@" ${HOME}
+	'quoted text' printf echo $(pwd)
+"$1" awk $(pwd) "$1" 2>/dev/null "$@" /usr/bin
+		echo cd export readonly 'quoted text'
+	printf --verbose export 'quoted text' readonly grep readonly ${HOME}
+"$1" "$@" && echo && done 2>/dev/null readonly && cd /usr/bin "$@" test sed
+cd awk export 2>/dev/null 2>/dev/null
+	$(pwd) "$@" sed | local printf
+		grep awk printf 'quoted text'
+		local -eu 'quoted text' -eu $(pwd) awk "$@" | cd $(pwd) | cd then
+	&& x=1 awk -eu 2>/dev/null done printf /usr/bin | done test /usr/bin
+x=1 "$@" | then export
+		test $(pwd) --verbose cd "$@" grep ${HOME}
+sed | ${HOME} "$1" printf 'quoted text' -eu export
+	${HOME} test then -eu
+	done done --verbose sed -eu ${HOME} 2>/dev/null grep x=1
+then done 'quoted text' grep awk "$@" x=1 grep grep 2>/dev/null x=1 cd
+printf readonly grep done "$@" && 'quoted text' export grep echo "$@"
+	local && 'quoted text' "$1" -eu test sed export x=1 printf 'quoted text' $(pwd)
+	"$@" x=1 export x=1 done $(pwd) "$@" printf echo && && export
+grep ${HOME} x=1 grep cd ${HOME} awk echo 2>/dev/null
+	printf echo --verbose
+	'quoted text' 'quoted text'
+		local /usr/bin 2>/dev/null local && local $(pwd)
+	"$@" x=1 printf -eu && --verbose /usr/bin local -eu | local then ${HOME} grep
+"$1" --verbose "$@" grep -eu
+		&& -eu echo then then | x=1
+		done --verbose readonly done --verbose sed awk awk grep /usr/bin echo x=1 then export
+	"$@" readonly sed && 'quoted text' x=1 grep readonly 'quoted text' done 2>/dev/null
+	sed 2>/dev/null then 'quoted text' readonly done "$@" then 'quoted text' awk
+		'quoted text' -eu grep local cd echo 2>/dev/null awk -eu test sed awk local
+/usr/bin awk printf ${HOME} --verbose export sed
+		test done awk "$@" then "$@" --verbose cd then $(pwd)
+2>/dev/null "$@" cd /usr/bin sed -eu -eu 2>/dev/null readonly "$@" sed "$@" ${HOME}
+	then then awk grep printf done x=1 done x=1 then "$@" cd then
+	'quoted text' cd local
+		test --verbose echo /usr/bin
+		done --verbose ${HOME} "$@" 'quoted text' 'quoted text'
+		awk $(pwd) export ${HOME} "$@" printf
+	export then && readonly echo x=1 sed cd echo printf
+		-eu sed $(pwd) test export export "$@" done cd local done then
+	awk -eu printf "$1" | local
+	cd -eu x=1 sed "$@" x=1 "$1" && "$1" grep awk export export
+		grep "$@" | awk 2>/dev/null /usr/bin ${HOME} 'quoted text' 'quoted text'
+		sed readonly test "$@" && x=1 'quoted text' grep done
+$(pwd) --verbose test printf
+	&& 2>/dev/null sed then ${HOME} 2>/dev/null
+| x=1 awk test --verbose
+	printf x=1 ${HOME} readonly
+	--verbose local echo 2>/dev/null
+	| readonly $(pwd) done ${HOME} readonly export 2>/dev/null
+readonly $(pwd) done "$@" x=1 cd printf x=1 "$1" test -eu
+	echo --verbose /usr/bin readonly "$@" && grep cd 2>/dev/null 2>/dev/null
+		'quoted text' awk readonly then --verbose
+	local then cd && ${HOME} printf local /usr/bin "$@" awk
+readonly local sed grep /usr/bin | echo | export sed
+	awk export x=1 x=1 sed 2>/dev/null done
+	awk x=1 x=1 $(pwd) && /usr/bin awk then 2>/dev/null
+readonly export test test done local /usr/bin
+	-eu local --verbose printf awk | | $(pwd) --verbose readonly ${HOME} then
+readonly grep -eu printf | "$@"
+		local echo grep "$@" "$@" readonly 2>/dev/null |
+	-eu done && cd "$@" test export
+	local printf done && local "$1"
+| --verbose "$@" --verbose -eu $(pwd) awk "$1" ${HOME} ${HOME} /usr/bin
+	"$@" awk "$1" | local --verbose "$@" readonly export echo awk |
+	cd "$@" printf && awk 2>/dev/null $(pwd) /usr/bin /usr/bin test x=1
+	"$@" --verbose x=1 2>/dev/null awk --verbose done cd echo awk echo then /usr/bin
+	done local awk then sed "$1" 2>/dev/null "$1" ${HOME} 2>/dev/null "$1" /usr/bin
+		$(pwd) test && sed --verbose --verbose grep sed 2>/dev/null
+"$@" 'quoted text' done
+cd grep --verbose ${HOME} ${HOME} printf | "$@" 'quoted text'
+2>/dev/null printf --verbose 2>/dev/null
+	printf x=1 readonly sed local readonly awk local && printf test echo
+		local grep awk done -eu /usr/bin export
+then 'quoted text' printf | -eu | 2>/dev/null
+	test 'quoted text' test grep awk printf test echo
+	"$1" --verbose /usr/bin cd echo local 2>/dev/null -eu cd $(pwd) /usr/bin
+		/usr/bin export $(pwd) -eu ${HOME} export local
+-eu grep ${HOME} ${HOME} then --verbose
+readonly $(pwd) ${HOME} test /usr/bin grep done && $(pwd) readonly echo 2>/dev/null
+	done -eu printf sed readonly cd sed readonly done then 'quoted text' cd echo
+	cd && echo 'quoted text' --verbose
+"$1" 2>/dev/null 2>/dev/null readonly x=1 x=1
+	printf sed 2>/dev/null readonly done /usr/bin | test
+${HOME} 'quoted text' --verbose
+		echo echo $(pwd) printf awk x=1 -eu
+	"$@" sed x=1 echo then echo printf awk ${HOME} cd 'quoted text' ${HOME}
+		readonly "$1" "$1" grep sed /usr/bin awk -eu --verbose "$1" sed printf
+		grep local x=1 /usr/bin printf awk grep local /usr/bin sed x=1 && "$1" --verbose
+	echo && done -eu x=1 awk local awk cd local "$1" printf test 'quoted text'
+		${HOME} "$1" --verbose --verbose
+		x=1 "$1" printf echo grep x=1 2>/dev/null sed "$@" /usr/bin /usr/bin
+	printf -eu | /usr/bin grep readonly cd | test --verbose local cd x=1 printf
+${HOME} then echo awk /usr/bin readonly
+cd printf cd readonly 2>/dev/null printf x=1
+	-eu done export cd ${HOME} echo /usr/bin readonly
+	"$@" $(pwd) awk local
+		printf local export readonly ${HOME} 2>/dev/null x=1 local --verbose
+	$(pwd) sed test /usr/bin export readonly readonly
+		export ${HOME} $(pwd) test
+printf ${HOME} export && awk then "$@" --verbose 'quoted text'
+'quoted text' grep sed --verbose | 2>/dev/null
+done $(pwd) echo 2>/dev/null 'quoted text' | sed "$1" awk ${HOME} "$@" sed
+&& --verbose --verbose readonly /usr/bin echo echo sed
+		$(pwd) 'quoted text' sed awk echo "$1" local then
+	local --verbose local sed local $(pwd) printf
+	| done export $(pwd) -eu /usr/bin "$1"
+	test x=1 export $(pwd) x=1 then awk readonly "$1" printf done test awk
+test "$@" x=1 echo sed
+		2>/dev/null awk sed awk test cd grep --verbose
+&& -eu -eu done cd $(pwd) test | done
+| /usr/bin /usr/bin | grep awk done sed $(pwd) && $(pwd) sed grep
+	--verbose $(pwd) then "$@" export
+	'quoted text' then cd readonly --verbose readonly "$1" /usr/bin local awk
+		-eu then then local x=1 sed | -eu | | $(pwd) echo $(pwd) ${HOME} done x=1 local
+	awk -eu then -eu x=1 "$@" cd export
+	echo $(pwd) -eu done --verbose
+		done printf echo printf "$@" local 'quoted text' "$1" done ${HOME} awk export
+		grep sed --verbose x=1 2>/dev/null 'quoted text' x=1 done | $(pwd) &&
+		"$1" && local "$@" x=1 sed printf
+	sed sed "$@" -eu 2>/dev/null then | && then -eu 2>/dev/null ${HOME} sed export
+		$(pwd) -eu cd && && 'quoted text'
+		awk 2>/dev/null readonly --verbose echo done readonly echo 2>/dev/null
+	export x=1 awk test readonly && "$@" x=1 && --verbose
+	/usr/bin | "$@" awk "$@" awk
+	cd printf $(pwd) grep awk ${HOME} then
+&& then 'quoted text'
+--verbose && "$@" --verbose "$1" cd test /usr/bin $(pwd) 'quoted text' cd
+echo -eu echo ${HOME} "$1" /usr/bin x=1 awk "$@" /usr/bin
+2>/dev/null && echo awk $(pwd)
+	readonly then | sed printf done 'quoted text' echo 2>/dev/null $(pwd)
+	printf ${HOME} done 2>/dev/null
+	-eu --verbose cd test readonly 'quoted text'
+		export export "$@" done x=1 done $(pwd) then ${HOME}
+2>/dev/null "$1" "$@"
+	$(pwd) then ${HOME} done "$@" && "$@" cd grep -eu export &&
+-eu echo 2>/dev/null done -eu awk echo readonly "$@" 'quoted text'
+		| readonly | test printf done grep echo cd | printf sed
+		printf grep awk done cd
+	--verbose then ${HOME} export
+	printf && awk | | /usr/bin /usr/bin export /usr/bin then export | sed x=1 test
+		"$1" -eu awk --verbose 2>/dev/null local awk grep sed 2>/dev/null
+"$1" export "$1" 'quoted text' echo x=1 test cd sed printf
+sed "$@" test ${HOME} 'quoted text' local && test && done
+		test test | then "$@" && "$1" awk local -eu /usr/bin grep
+		done "$1" "$@" -eu 2>/dev/null $(pwd) 'quoted text' printf done /usr/bin awk
+export ${HOME} 2>/dev/null cd -eu
+"$@" x=1 'quoted text' readonly then done "$1" 'quoted text' readonly local
+	&& x=1 sed x=1 2>/dev/null cd sed cd
+	&& local cd sed 2>/dev/null $(pwd)
+	awk ${HOME} 2>/dev/null 'quoted text' then then | --verbose
+		grep ${HOME} "$@" ${HOME} --verbose
+grep done x=1 then done export ${HOME} 'quoted text' | readonly
+	"$1" readonly cd x=1 then export export && ${HOME} --verbose 'quoted text' local
+		&& printf local /usr/bin local --verbose export
+	&& export grep -eu -eu echo sed cd "$1"
+	${HOME} $(pwd) "$1" test x=1 done local test printf && && cd "$1" printf
+cd printf done echo echo grep export grep test then
+	-eu echo $(pwd) 2>/dev/null sed ${HOME} -eu printf
+| printf test -eu $(pwd) /usr/bin 2>/dev/null
+done echo grep && then test /usr/bin 2>/dev/null printf x=1 --verbose 2>/dev/null
+		'quoted text' printf done cd printf | done /usr/bin && | 2>/dev/null
+export cd 2>/dev/null -eu export
+&& grep cd x=1 awk test awk awk ${HOME}
+test then "$@" "$1" sed grep && echo 2>/dev/null $(pwd) ${HOME}
+		sed echo 2>/dev/null 'quoted text'
+	${HOME} -eu grep sed -eu "$@"
+		awk x=1 sed export && echo
+$(pwd) printf printf then "$1" "$1" awk then test 2>/dev/null export 'quoted text'
+		x=1 /usr/bin -eu cd grep readonly done test 'quoted text'
+	test done done awk ${HOME} local printf
+		grep "$@" -eu cd && | x=1 then |
+		| --verbose 2>/dev/null done local
+then --verbose test x=1 awk "$1" "$1" cd && test
+	2>/dev/null then --verbose /usr/bin /usr/bin echo
+		test export done && 'quoted text' 'quoted text' printf -eu --verbose grep printf
+grep "$1" done sed readonly done readonly awk cd && "$@" "$1" then
+local readonly grep echo
+	test done local test -eu "$1" "$@" && x=1 echo done echo local
+		echo "$1" sed awk done "$@"
+$(pwd) test "$1" echo 2>/dev/null export
+-eu cd done x=1 cd readonly awk local --verbose --verbose echo
+done cd | -eu x=1 'quoted text' "$1" readonly readonly
+		/usr/bin done awk | x=1 | ${HOME} 2>/dev/null
+test cd "$1" -eu -eu then x=1 | x=1 sed /usr/bin local grep
+		echo printf readonly "$@" test done /usr/bin then readonly -eu export
+		'quoted text' cd printf
+	test "$@" test "$1" /usr/bin && "$@"
+	"$1" printf "$1" /usr/bin local && printf
+2>/dev/null printf "$@"
+		x=1 cd x=1 "$@" local x=1 x=1 local -eu | -eu 'quoted text'
+		readonly 'quoted text' then echo && sed -eu &&
+sed test ${HOME} printf test 2>/dev/null
+	--verbose done ${HOME} then && cd | ${HOME} "$@" readonly "$@" "$1" then
+test then sed then "$@"
+		cd export awk done then local "$@" | "$@" ${HOME}
+	--verbose test -eu | test test grep
+	test $(pwd) local then grep grep
+echo "$1" x=1 grep test done then $(pwd)
+	cd cd awk 2>/dev/null then then "$@" echo
+	local export x=1 test done |
+		-eu test test "$1" test ${HOME} ${HOME}
+		test export grep -eu then local then
+	readonly cd "$1" export 2>/dev/null -eu test | cd 'quoted text' --verbose echo
+	then 2>/dev/null awk sed 2>/dev/null then "$1" local x=1 "$@" echo local
+sed grep echo && awk /usr/bin awk cd 'quoted text' x=1 2>/dev/null
+		grep | /usr/bin then 'quoted text' x=1 "$@"
+		local 2>/dev/null && printf | sed ${HOME} && export
+		grep /usr/bin awk --verbose | 'quoted text'
+	cd /usr/bin then test | x=1 -eu sed cd | cd 2>/dev/null echo echo
+		export "$@" cd echo 'quoted text' -eu sed export -eu && -eu done
+		cd "$@" x=1 && cd ${HOME} sed test
+		test --verbose cd 2>/dev/null
+"$@" "$1" export /usr/bin export awk "$1" $(pwd) readonly cd printf test ${HOME}
+		"$1" printf sed 2>/dev/null && echo cd readonly --verbose
+/usr/bin 'quoted text' --verbose && "$1" printf 'quoted text' x=1 ${HOME}
+test local x=1 grep $(pwd) test 2>/dev/null echo echo
+	then local --verbose -eu "$1" readonly 2>/dev/null
+		test && 2>/dev/null printf grep cd then
+/usr/bin | 2>/dev/null echo awk readonly cd 'quoted text' 2>/dev/null
+printf "$1" 'quoted text' readonly local $(pwd) $(pwd) 2>/dev/null test
+${HOME} grep -eu echo 'quoted text' local sed grep --verbose awk 2>/dev/null
+&& printf done export sed -eu "$@" x=1 awk $(pwd)
+		sed x=1 cd "$@" echo && "$1" readonly echo sed cd && echo cd cd awk echo
+		cd cd ${HOME} x=1 -eu echo grep 'quoted text' readonly
+	'quoted text' "$@" 2>/dev/null grep test 'quoted text' sed
+		$(pwd) local --verbose awk
+then "$1" -eu /usr/bin local local readonly | "$1" sed
+test x=1 export $(pwd) done "$@" export -eu
+"$@" && --verbose ${HOME} "$1" awk done
+"$@" $(pwd) echo | local then then
+	-eu x=1 cd x=1 then test local "$1" /usr/bin
+	grep printf ${HOME} export printf && done /usr/bin
+	| /usr/bin echo x=1 /usr/bin echo "$@" sed x=1 readonly cd
+		local "$@" sed && "$@" readonly --verbose sed "$1" | cd test printf | /usr/bin export
+printf && cd /usr/bin /usr/bin "$1" $(pwd) 2>/dev/null ${HOME} ${HOME}
+grep 'quoted text' -eu
+		2>/dev/null $(pwd) 2>/dev/null grep ${HOME}
+"$1" awk 2>/dev/null awk export printf "$1" 2>/dev/null readonly grep awk
+printf $(pwd) ${HOME} x=1
+	test export then cd 'quoted text'
+export cd -eu cd "$1" x=1 sed then printf
+test echo ${HOME} printf x=1 echo cd then ${HOME} 'quoted text' readonly
+		grep "$1" && "$@" awk /usr/bin export
+local x=1 /usr/bin printf grep ${HOME} $(pwd) grep 2>/dev/null ${HOME}
+	"$1" "$@" test readonly echo 'quoted text' /usr/bin
+	export x=1 --verbose echo "$@" ${HOME} done x=1 "$@"
+		${HOME} $(pwd) sed | cd | cd | then export test grep
+	x=1 sed cd /usr/bin ${HOME} sed sed readonly ${HOME} test echo $(pwd) 2>/dev/null
+	done then && sed printf awk test then readonly ${HOME}
+		done printf then /usr/bin /usr/bin && awk /usr/bin
+&& x=1 --verbose export test done sed readonly
+then grep printf ${HOME} cd -eu
+		"$1" | then test readonly export --verbose
+	export cd grep sed test "$@" "$@"
+		readonly "$1" readonly printf
+		2>/dev/null grep "$@" x=1 local "$1" printf 'quoted text'
+		grep awk /usr/bin -eu local
+	awk sed --verbose then -eu | x=1 "$@"
+		--verbose readonly sed
+	"$1" "$1" | echo 'quoted text'
+| $(pwd) sed x=1 | | "$1" x=1 readonly awk && && grep "$@" | export sed $(pwd)
+		awk "$1" local $(pwd)
+	"$1" cd | 2>/dev/null "$@" /usr/bin printf
+/usr/bin sed cd ${HOME} echo 'quoted text' --verbose readonly readonly echo 'quoted text'
+		"$@" 2>/dev/null $(pwd) readonly printf
+	--verbose export test --verbose $(pwd) test grep -eu
+	x=1 -eu 2>/dev/null printf then 'quoted text'
+	done grep -eu x=1 awk cd "$1" test "$1" export export x=1 echo done -eu grep ${HOME}
+	export 'quoted text' then "$1" done 2>/dev/null "$@" -eu sed
+		2>/dev/null printf awk /usr/bin then printf readonly --verbose 'quoted text'
+local ${HOME} -eu done 'quoted text' x=1 echo --verbose cd cd export printf 'quoted text'
+	${HOME} printf 2>/dev/null test done local 2>/dev/null grep
+printf grep "$1" ${HOME} then 2>/dev/null --verbose 2>/dev/null -eu
+		| done $(pwd) sed && cd printf grep x=1 cd x=1 printf
+		/usr/bin then done x=1 done export "$@" local $(pwd)
+	2>/dev/null ${HOME} | cd &&
+		"$1" export sed echo sed echo export
+		local export cd export awk
+		-eu sed "$@" 'quoted text' done awk sed test -eu 2>/dev/null | x=1 test cd
+		awk ${HOME} done done echo -eu 2>/dev/null "$@" done cd && 'quoted text' "$1"
+	printf && x=1 local cd "$@" -eu sed printf
+	then test grep "$@" readonly /usr/bin && cd printf printf
+	echo awk /usr/bin | sed --verbose
+${HOME} "$@" readonly && --verbose ${HOME} local export grep grep awk "$@" done
+| then && x=1 cd ${HOME} x=1 "$@" echo awk --verbose 'quoted text' printf
+	sed cd | /usr/bin --verbose printf x=1 test && x=1 $(pwd) $(pwd) echo
+	grep done local then 2>/dev/null
+	--verbose 2>/dev/null "$@" "$@" export local x=1 --verbose cd
+		local -eu readonly sed $(pwd) ${HOME} -eu "$@" export --verbose then 'quoted text'
+	test sed | && sed /usr/bin awk &&
+"$@" x=1 x=1 "$1" sed printf "$1" x=1 local | printf "$@" 'quoted text' awk
+	/usr/bin && "$1" awk -eu 2>/dev/null
+		--verbose x=1 done export test
+export /usr/bin done --verbose 'quoted text' test /usr/bin cd done done 'quoted text'
+		test 'quoted text' sed echo
+	then /usr/bin printf awk -eu /usr/bin 'quoted text'
+	sed /usr/bin ${HOME} --verbose -eu local
+| test cd test --verbose 'quoted text' "$@" x=1 "$1" 'quoted text'
+	/usr/bin $(pwd) sed | sed x=1 readonly /usr/bin
+		done awk /usr/bin x=1 readonly
+	'quoted text' done x=1 ${HOME}
+	readonly export "$1" readonly "$1" /usr/bin $(pwd) --verbose printf -eu 2>/dev/null
+	export grep 'quoted text' --verbose 2>/dev/null
+cd -eu export && $(pwd) echo then
+	sed then grep echo "$1" awk readonly ${HOME} "$@" x=1 cd
+		local $(pwd) sed local "$1" 'quoted text' | echo 'quoted text' printf
+	${HOME} --verbose $(pwd) readonly 'quoted text'
+		-eu export sed readonly && readonly printf | 2>/dev/null x=1 awk 2>/dev/null
+	"$1" | sed done --verbose && readonly
+	'quoted text' done 2>/dev/null echo echo grep "$1"
+then | printf then | grep sed echo "$@" then done 2>/dev/null
+sed done "$@" grep printf done export $(pwd)
+		/usr/bin 'quoted text' ${HOME} 2>/dev/null 2>/dev/null
+		/usr/bin export awk 'quoted text' grep | "$1" "$@" readonly
+	printf done grep 2>/dev/null
+	test local $(pwd) printf -eu -eu grep grep
+		printf | 'quoted text' grep grep then 'quoted text' then
+-eu "$1" | echo | "$@" echo && printf "$@" "$@" readonly ${HOME} test &&
+$(pwd) cd x=1 export local printf sed then ${HOME} export sed
+		-eu local "$1" done -eu test sed local "$1" | grep local echo
+		--verbose done grep --verbose "$1" echo x=1 && readonly
+$(pwd) --verbose grep "$@" awk 'quoted text' $(pwd)
+	export "$1" test --verbose awk done cd 'quoted text'
+export $(pwd) | && --verbose readonly
+then test && && readonly -eu done test
+readonly /usr/bin echo && /usr/bin echo 2>/dev/null test echo 2>/dev/null
+"$1" readonly test then -eu /usr/bin /usr/bin readonly export && && --verbose
+-eu export "$@" awk | && awk "$1" then 2>/dev/null --verbose printf sed x=1
+readonly $(pwd) export printf ${HOME} sed grep ${HOME}
+	local x=1 export printf test
+'quoted text' 'quoted text' 'quoted text' 2>/dev/null
+	export "$@" local then "$@" ${HOME} "$@" awk 'quoted text' --verbose
+		test printf done then printf cd x=1 -eu then printf test -eu -eu
+printf awk && 'quoted text' local
+	grep awk export then local 2>/dev/null grep
+"$1" readonly readonly 'quoted text' then done "$1"
+	--verbose grep -eu sed sed done $(pwd) ${HOME} /usr/bin 2>/dev/null
+		/usr/bin sed printf cd 2>/dev/null ${HOME} awk
+		"$1" awk --verbose 2>/dev/null local sed readonly
+awk | sed readonly /usr/bin && test echo -eu --verbose
+	&& cd sed "$@" --verbose local 2>/dev/null echo echo
+	printf export then --verbose local "$@" -eu && done export
+x=1 "$@" then --verbose awk 2>/dev/null --verbose grep awk cd sed
+		done ${HOME} test 2>/dev/null 2>/dev/null
+		'quoted text' "$@" -eu done -eu 2>/dev/null $(pwd) && then done sed sed
+		2>/dev/null sed --verbose echo ${HOME} && test "$@" echo readonly /usr/bin
+&& /usr/bin 'quoted text' ${HOME} test ${HOME} awk $(pwd) $(pwd)
+	readonly ${HOME} $(pwd) printf awk done "$1" test sed echo done
+echo x=1 -eu test grep "$1" awk grep ${HOME} grep "$1" "$1" done grep 'quoted text'
+		-eu done local then sed printf
+-eu done export echo "$@" /usr/bin ${HOME} export local export
+		awk printf then ${HOME} $(pwd) /usr/bin "$@" test
+"$1" export 2>/dev/null -eu awk && 2>/dev/null readonly local then echo local
+	"$@" echo export done export readonly
+	echo printf printf done ${HOME} local
+	'quoted text' 2>/dev/null local -eu ${HOME} 2>/dev/null
+		test $(pwd) "$@" | "$@" done cd test readonly $(pwd) /usr/bin
+${HOME} "$@" -eu cd readonly test
+-eu --verbose cd done local sed
+2>/dev/null sed export sed then local done $(pwd) awk test -eu && awk cd then /usr/bin
+"$@" cd grep && test grep
+	&& "$@" /usr/bin grep x=1 2>/dev/null then export ${HOME} ${HOME} readonly
+		done "$1" printf --verbose export
+cd ${HOME} awk "$1" "$@"
+		"$1" | printf printf echo 'quoted text' done sed readonly
+	cd "$1" 'quoted text' printf then test "$1"
+	| 'quoted text' && then sed "$1" printf
+		awk grep local "$1" cd awk "$@" | 'quoted text' awk local
+		"$1" export echo -eu done sed --verbose local printf sed "$1" sed 'quoted text'
+x=1 sed /usr/bin "$1" --verbose
+done grep sed | printf readonly test echo 'quoted text' 2>/dev/null readonly
+		sed /usr/bin 'quoted text' local
+	2>/dev/null $(pwd) --verbose
+sed "$1" ${HOME} done export
+printf "$@" && "$@" echo local
+test --verbose then --verbose x=1 /usr/bin $(pwd)
+	printf x=1 "$@" test export "$@" 2>/dev/null
+		'quoted text' echo /usr/bin awk sed sed $(pwd) 'quoted text'
+/usr/bin local 2>/dev/null cd /usr/bin 'quoted text' $(pwd)
+		local /usr/bin local 2>/dev/null /usr/bin test readonly /usr/bin x=1 x=1
+&& test cd local readonly sed --verbose test | grep cd grep
+| x=1 2>/dev/null readonly | readonly echo "$@" test
+cd then awk | local -eu $(pwd)
+${HOME} awk 'quoted text' grep
+		| --verbose local x=1 -eu export sed 'quoted text' printf --verbose
+--verbose /usr/bin x=1 | /usr/bin -eu ${HOME}
+echo ${HOME} /usr/bin --verbose "$1" "$@" $(pwd) $(pwd)
+	then ${HOME} test readonly echo echo "$1" awk "$1" x=1
+	x=1 --verbose 'quoted text' "$1"
+	"$1" sed done done grep $(pwd) 2>/dev/null cd /usr/bin "$1" export then readonly
+	test grep /usr/bin x=1 "$1" awk $(pwd)
+		sed export 2>/dev/null | "$1" ${HOME} test | "$1" then -eu cd ${HOME}
+readonly -eu 'quoted text' --verbose /usr/bin |
+2>/dev/null readonly test
+		| cd then printf done -eu 2>/dev/null awk 2>/dev/null grep $(pwd)
+	x=1 /usr/bin "$@" printf $(pwd) 'quoted text' "$1" $(pwd) && readonly awk
+	test export -eu ${HOME} readonly test done 'quoted text' ${HOME} 'quoted text'
+-eu grep ${HOME} grep grep "$@" ${HOME}
+printf --verbose cd readonly then /usr/bin grep awk sed 'quoted text'
+"$1" cd && awk "$1" echo 2>/dev/null awk -eu then
+		&& grep then done 2>/dev/null awk export && -eu local export
+2>/dev/null then && "$1" /usr/bin x=1 --verbose then && ${HOME} sed test
+test export "$1" --verbose then export local grep test x=1 && | awk awk
+		export test done -eu export cd 2>/dev/null
+done && sed test 2>/dev/null then
+		local export "$@" sed 'quoted text' sed --verbose ${HOME} x=1 "$1" && 'quoted text'
+		| /usr/bin && printf $(pwd)
+then x=1 readonly 2>/dev/null /usr/bin cd && readonly
+| /usr/bin && local printf then test readonly echo
+		sed awk 'quoted text' awk local
+		export ${HOME} "$@" grep
+	printf /usr/bin && x=1 | sed export $(pwd) -eu
+		${HOME} printf test readonly
+		-eu | grep awk readonly then export awk readonly printf 'quoted text'
+cd /usr/bin 2>/dev/null --verbose readonly -eu "$1" "$@" printf
+		2>/dev/null "$1" && 'quoted text' | && grep done ${HOME} 'quoted text' -eu "$1"
+		/usr/bin grep ${HOME} 'quoted text' printf
+	x=1 && done "$@" cd done ${HOME} export cd 2>/dev/null
+		done done "$1" then test grep -eu echo printf readonly 2>/dev/null
+	awk readonly test --verbose 'quoted text' "$@" $(pwd) | echo done $(pwd)
+		export "$1" -eu cd test
+		$(pwd) x=1 cd --verbose sed awk awk $(pwd) local printf
+	2>/dev/null --verbose printf cd readonly --verbose test $(pwd) --verbose
+2>/dev/null then sed && /usr/bin -eu -eu "$1"
+	${HOME} done /usr/bin then /usr/bin "$@" $(pwd) done && 2>/dev/null
+		-eu --verbose "$1" readonly $(pwd) | 'quoted text' 2>/dev/null
+printf cd sed sed $(pwd)
+echo x=1 /usr/bin && done test cd "$@" export done readonly
+	| "$@" "$1" "$@" cd echo 'quoted text' "$@"
+then && --verbose printf test test awk $(pwd) echo
+		awk 'quoted text' test readonly && $(pwd) /usr/bin then ${HOME}
+export -eu "$@" x=1 $(pwd) cd cd then --verbose sed done "$1" export x=1 test
+'quoted text' "$1" test x=1 grep test $(pwd)
+		2>/dev/null x=1 awk && awk 'quoted text' | "$1" "$1" "$@" readonly
+$(pwd) --verbose && test export "$@" $(pwd) x=1 x=1 $(pwd) --verbose readonly
+echo grep test grep 2>/dev/null local echo echo "$@" then test | x=1 'quoted text'
+		| printf cd /usr/bin /usr/bin -eu then awk done awk echo /usr/bin 2>/dev/null
+cd printf test then && cd readonly --verbose && | grep
+	'quoted text' /usr/bin local
+	&& -eu printf ${HOME} local test ${HOME}
+	&& "$@" -eu sed test "$@" x=1 'quoted text' | /usr/bin ${HOME} --verbose
+	"$@" x=1 readonly 2>/dev/null "$1" test local local local
+		| export 'quoted text' export "$@"
+printf x=1 | readonly done grep sed readonly x=1 grep then cd cd
+		$(pwd) export printf echo test && done printf x=1 x=1 --verbose grep local "$1"
+printf $(pwd) then sed test test echo grep test x=1
+		grep --verbose done awk export awk sed && x=1 | test -eu -eu
+2>/dev/null cd 2>/dev/null echo grep awk x=1 printf sed
+	done test sed "$@" test grep echo
+	/usr/bin -eu then && && ${HOME} printf
+		&& 'quoted text' then -eu x=1 cd grep awk $(pwd) 'quoted text'
+		grep "$@" sed -eu -eu 2>/dev/null ${HOME} --verbose
+	then export cd /usr/bin | "$1" awk awk x=1
+	test && ${HOME} grep 2>/dev/null x=1 test cd $(pwd)
+readonly grep "$@" done export done grep ${HOME} awk $(pwd) ${HOME} then $(pwd)
+printf echo x=1 sed local ${HOME}
+then "$1" done "$1" cd test $(pwd) "$1" x=1 readonly x=1 cd
+	/usr/bin grep $(pwd) && 'quoted text' $(pwd) "$@" 'quoted text' | "$@" test
+		2>/dev/null 'quoted text' ${HOME} && printf done export
+		echo test sed awk | && ${HOME} awk export printf printf $(pwd) grep cd ${HOME}
+		'quoted text' 2>/dev/null "$1" local readonly --verbose export
+		-eu /usr/bin sed readonly cd readonly local readonly
+	/usr/bin ${HOME} /usr/bin sed sed 2>/dev/null |
+2>/dev/null printf x=1 then then echo "$1" cd $(pwd)
+"$@" | 2>/dev/null then awk "$1" export
+	test | | test sed "$1" cd printf awk test test
+printf 2>/dev/null local && ${HOME} test
+		printf readonly local test export $(pwd)
+	awk && cd x=1 done "$@" /usr/bin
+	2>/dev/null printf /usr/bin
+local readonly local && 2>/dev/null $(pwd) | sed local 2>/dev/null
+readonly "$1" local readonly test && /usr/bin "$@"
+	local ${HOME} awk 2>/dev/null /usr/bin readonly grep 2>/dev/null /usr/bin
+grep "$1" -eu 2>/dev/null "$1" export readonly x=1 ${HOME}
+		| --verbose grep local export cd /usr/bin
+	'quoted text' echo done grep then readonly grep cd local /usr/bin awk then
+	printf 'quoted text' "$1" echo x=1 | test "$@" awk test test | test printf 2>/dev/null
+		sed "$1" -eu then /usr/bin test cd export grep --verbose
+		/usr/bin 2>/dev/null 'quoted text' readonly cd sed test cd grep test
+then ${HOME} ${HOME} /usr/bin awk 2>/dev/null echo done "$1"
+	awk x=1 "$1" && test local
+	&& test grep "$@" "$@" $(pwd) echo done test echo export awk --verbose
+		$(pwd) cd awk 'quoted text' cd grep done "$@"
+echo printf $(pwd) cd && cd /usr/bin $(pwd) grep ${HOME} | local
+sed 'quoted text' grep
+grep echo echo x=1 echo local readonly $(pwd)
+		/usr/bin grep -eu export echo --verbose 2>/dev/null ${HOME}
+	$(pwd) && grep local test x=1 'quoted text' then local
+awk "$1" local x=1 $(pwd) | && printf done && 'quoted text'
+readonly | -eu "$@" sed 2>/dev/null 'quoted text' "$@" $(pwd) && grep awk
+		echo -eu "$@" 2>/dev/null | cd && 2>/dev/null grep
+	printf x=1 $(pwd) local $(pwd) local then --verbose
+echo echo --verbose cd /usr/bin sed cd export awk ${HOME} $(pwd) awk
+echo test ${HOME} $(pwd) grep grep | sed -eu export cd readonly "$1" grep awk
+--verbose cd $(pwd) done 2>/dev/null
+		echo $(pwd) awk test --verbose test test $(pwd) "$@" sed
+	awk grep export ${HOME} | $(pwd)
+		awk awk sed /usr/bin --verbose readonly echo --verbose x=1 | then | sed
+	printf ${HOME} -eu awk | grep -eu export done $(pwd) ${HOME} export
+"$@" && readonly local export /usr/bin cd test
+	printf local cd --verbose /usr/bin 'quoted text'
+	2>/dev/null "$1" && echo done --verbose x=1
+2>/dev/null grep ${HOME} awk local 2>/dev/null && ${HOME} readonly && "$@" echo
+	local 2>/dev/null echo awk then then echo /usr/bin sed && echo readonly
+	local x=1 2>/dev/null "$1" cd $(pwd) cd cd 2>/dev/null export x=1 export
+	sed readonly then /usr/bin
+		readonly -eu "$1" "$1" ${HOME}
+	$(pwd) ${HOME} && 'quoted text' "$1" x=1
+/usr/bin "$@" 2>/dev/null sed local --verbose local awk cd
+	test /usr/bin then export grep && then 2>/dev/null
+		echo "$1" 2>/dev/null export -eu echo test cd grep 'quoted text' 2>/dev/null -eu
+then && export cd /usr/bin --verbose "$1" echo grep 2>/dev/null
+		/usr/bin 2>/dev/null $(pwd) $(pwd) "$@" local printf sed
+	cd printf grep /usr/bin test --verbose --verbose readonly
+	awk cd --verbose test grep $(pwd) done /usr/bin done "$1"
+		test readonly echo -eu done awk 'quoted text'
+	echo done /usr/bin -eu 'quoted text' 2>/dev/null printf done
+		/usr/bin ${HOME} printf && readonly
+		"$@" "$@" "$@" --verbose
+${HOME} echo "$@" test readonly
+	| --verbose -eu echo test sed "$1" then awk --verbose
+	"$@" | $(pwd) 2>/dev/null /usr/bin | --verbose 'quoted text' x=1 done
+		printf "$1" echo test grep echo printf x=1 sed
+$(pwd) readonly test $(pwd) echo grep
+		done sed cd awk sed cd --verbose 'quoted text'
+test ${HOME} 2>/dev/null local x=1 sed /usr/bin /usr/bin
+	'quoted text' $(pwd) local export done readonly printf
+	--verbose local $(pwd) x=1 'quoted text'
+		-eu ${HOME} "$@" && done -eu && $(pwd) readonly export 2>/dev/null /usr/bin
+printf test 2>/dev/null awk awk | local grep readonly ${HOME}
+	"$@" x=1 grep ${HOME} ${HOME} echo readonly sed local
+		readonly | sed 2>/dev/null -eu && local $(pwd) sed sed local
+then 2>/dev/null | done | | "$@" && done x=1 readonly awk printf sed
+	echo "$@" -eu | readonly sed sed x=1
+		awk /usr/bin export /usr/bin x=1 readonly
+${HOME} echo 2>/dev/null $(pwd) cd then
+	x=1 awk ${HOME} echo && cd | sed ${HOME} echo x=1 $(pwd) readonly $(pwd)
+--verbose printf "$1" ${HOME} && && echo echo $(pwd) "$@"
+		local cd printf "$1" --verbose echo /usr/bin $(pwd)
+	"$1" local done done
+'quoted text' 2>/dev/null awk grep 'quoted text'
+	readonly echo ${HOME} 2>/dev/null grep 2>/dev/null
+	-eu "$@" /usr/bin sed $(pwd) then --verbose $(pwd) sed
+		-eu grep awk "$@" test 2>/dev/null --verbose "$@"
+	&& awk "$@" printf cd local export /usr/bin -eu awk echo local done
+	| then ${HOME} 'quoted text'
+		grep "$1" echo grep local then -eu printf
+	then $(pwd) "$@" 'quoted text'
+	grep printf cd | readonly 2>/dev/null
+	x=1 'quoted text' && -eu awk x=1 printf cd 'quoted text' done "$@"
+done readonly test done "$1" echo 2>/dev/null printf
+x=1 grep readonly x=1 $(pwd) | -eu ${HOME}
+		| test 2>/dev/null test x=1 | local "$@" test
+	grep 2>/dev/null "$1" /usr/bin -eu grep
+	sed /usr/bin readonly printf
+	| then ${HOME} cd 2>/dev/null "$@" cd grep $(pwd) grep grep -eu /usr/bin cd
+		export "$1" && then done awk ${HOME}
+	$(pwd) sed export && -eu "$@" readonly /usr/bin /usr/bin
+	&& cd done $(pwd) test then readonly sed awk
+	$(pwd) local test awk --verbose
+	/usr/bin 2>/dev/null sed done $(pwd) local
+	readonly done x=1 awk x=1 sed then -eu
+	2>/dev/null done "$@" echo printf --verbose --verbose && ${HOME} 'quoted text'
+x=1 awk $(pwd) 'quoted text'
+	x=1 | export x=1 && test | --verbose echo then $(pwd) printf
+	readonly echo "$@" 'quoted text' --verbose
+		x=1 export readonly readonly awk cd local grep cd echo
+		awk ${HOME} awk --verbose then grep $(pwd) test ${HOME} "$@"
+${HOME} grep test sed -eu
+awk x=1 && echo && | $(pwd) then printf 'quoted text' awk grep sed -eu
+${HOME} | export then test test ${HOME} awk 2>/dev/null readonly "$1"
+	export cd test | "$1" done 2>/dev/null echo 2>/dev/null then echo export
+export awk readonly grep test | "$@" 2>/dev/null sed "$@" cd awk local "$@" cd
+2>/dev/null 2>/dev/null $(pwd) done test "$@" "$1" sed "$@" export ${HOME}
+	'quoted text' readonly
+		--verbose "$@" | sed done
+		awk && ${HOME} 2>/dev/null
+cd --verbose "$@" "$@" grep /usr/bin "$1" cd export echo
+/usr/bin grep "$1" printf /usr/bin ${HOME} test local awk printf -eu awk && "$1"
+		awk ${HOME} --verbose echo 2>/dev/null then
+cd /usr/bin done 'quoted text' $(pwd) done x=1 $(pwd) | echo
+	sed x=1 awk $(pwd) readonly then grep done
+x=1 echo readonly echo /usr/bin /usr/bin grep
+cd printf grep then --verbose local "$@" ${HOME} "$@" local
+		'quoted text' readonly test done echo readonly done sed printf grep
+		&& done test ${HOME} x=1 x=1 printf done && export --verbose
+	2>/dev/null readonly x=1
+		--verbose -eu export local | && export $(pwd)
+	| "$@" readonly | readonly x=1 --verbose test then 'quoted text'
+	$(pwd) | grep ${HOME} export awk done && 'quoted text' ${HOME} /usr/bin x=1 x=1
+		export 2>/dev/null echo "$1" $(pwd) x=1 'quoted text' cd /usr/bin
+awk 2>/dev/null local /usr/bin echo --verbose awk grep | export export 2>/dev/null
+then then "$1" cd test export printf
+--verbose readonly then
+		/usr/bin 2>/dev/null cd
+"$@" local --verbose cd cd x=1 -eu then echo done echo 'quoted text'
+		then $(pwd) grep readonly echo ${HOME} $(pwd)
+/usr/bin echo cd cd grep printf $(pwd) cd test
+	readonly 'quoted text' --verbose printf
+	sed readonly 2>/dev/null readonly
+		$(pwd) "$1" | export /usr/bin x=1 ${HOME} then readonly
+		cd $(pwd) /usr/bin done test && "$1"
+	done "$@" export "$1" then -eu -eu printf ${HOME} /usr/bin 'quoted text'
+		printf done local done
+	2>/dev/null --verbose -eu then sed
+		then local "$@" local "$1" x=1 sed done grep
+test 'quoted text' "$@" sed "$1" x=1 2>/dev/null
+	echo /usr/bin | "$1" && "$@" awk cd && "$1" cd grep "$@" $(pwd)
+	grep && echo "$1" "$1" --verbose readonly export | 'quoted text' "$@"
+	sed cd ${HOME} ${HOME} echo 'quoted text' grep local export ${HOME} $(pwd) ${HOME}
+	x=1 "$1" test "$@" --verbose
+		printf 2>/dev/null $(pwd) export done test grep export "$@" ${HOME} --verbose
+	${HOME} --verbose done 2>/dev/null -eu
+	export echo ${HOME} x=1 echo && printf
+test | $(pwd) printf awk $(pwd) then printf readonly 2>/dev/null
+	then 'quoted text' local x=1 x=1 "$1" -eu --verbose readonly
+	awk cd readonly /usr/bin |
+	test cd $(pwd) local readonly x=1 awk done cd awk | --verbose then local
+		printf x=1 --verbose readonly export
+	"$@" 2>/dev/null export local x=1 readonly
+		'quoted text' grep 2>/dev/null | /usr/bin "$@" 'quoted text'
+		export --verbose 'quoted text'
+'quoted text' sed then "$@" done 2>/dev/null 'quoted text' $(pwd) test echo
+x=1 sed $(pwd) "$@" | printf printf local -eu test readonly test
+	sed done done "$1" awk "$@" then --verbose
+	done "$1" local awk local grep awk awk -eu
+	/usr/bin echo awk awk grep && "$1" sed "$@" && then
+	"$@" local sed awk sed 2>/dev/null && --verbose
+		x=1 --verbose local printf 2>/dev/null
+		'quoted text' grep $(pwd)
+		test printf local done done local "$@" | -eu export
+then $(pwd) 'quoted text' done "$1" | export local export $(pwd)
+	"$1" test --verbose 'quoted text' done local /usr/bin local --verbose local
+	then cd export 2>/dev/null | ${HOME} awk 2>/dev/null
+	'quoted text' local then /usr/bin --verbose ${HOME}
+		done 'quoted text' x=1 done local /usr/bin sed printf readonly "$@" export
+		2>/dev/null -eu cd "$@" $(pwd) sed awk /usr/bin then | export sed $(pwd)
+		cd printf ${HOME} ${HOME} echo $(pwd) /usr/bin cd cd grep x=1 readonly test
+		readonly 2>/dev/null done local
+		sed -eu cd /usr/bin local awk --verbose local grep x=1 export test then --verbose
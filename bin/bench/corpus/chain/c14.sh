@@ -0,0 +1,2001 @@
+awk /usr/bin 'quoted text' awk printf test local echo sed $(pwd) local printf
+${HOME} export local /usr/bin "$1" $(pwd) printf "$1" x=1 --verbose
+awk ${HOME} printf printf awk local done --verbose --verbose /usr/bin sed
+		local -eu awk local awk && 2>/dev/null -eu cd cd cd sed x=1 $(pwd) -eu
+echo test 2>/dev/null &&
+		then awk -eu ${HOME} x=1 local /usr/bin "$@" awk && export "$1" && 2>/dev/null
+grep $(pwd) "$1" -eu sed local && && ${HOME} --verbose sed /usr/bin sed readonly
+	awk test local cd ${HOME} sed cd readonly $(pwd) sed && export ${HOME}
+	&& "$1" 'quoted text' cd grep echo
+	then cd 2>/dev/null done then 2>/dev/null cd then ${HOME} local /usr/bin
+	/usr/bin /usr/bin $(pwd) awk --verbose
+awk $(pwd) "$@" readonly "$@" done
+	&& --verbose test 2>/dev/null export printf done echo 'quoted text' cd
+${HOME} done readonly "$@" --verbose /usr/bin "$1" local x=1
+		done done x=1 $(pwd) 'quoted text' | readonly
+/usr/bin "$@" -eu $(pwd) export --verbose grep
+	local $(pwd) 'quoted text' $(pwd)
+	awk "$@" /usr/bin "$@" "$@" -eu "$@" grep local
+	'quoted text' -eu grep done grep cd awk x=1 export local 2>/dev/null local
+		'quoted text' done 'quoted text' --verbose done --verbose $(pwd) $(pwd)
+$(pwd) readonly local -eu then cd awk grep ${HOME} $(pwd) export printf
+		printf local export x=1 ${HOME} local /usr/bin
+&& echo && done echo then ${HOME} /usr/bin
+-eu cd 'quoted text' awk test "$@" --verbose awk printf
+	/usr/bin "$@" ${HOME} ${HOME} "$@" echo && test
+x=1 printf --verbose export
+${HOME} x=1 | | export $(pwd) then 2>/dev/null ${HOME} sed
+| grep -eu printf sed test 'quoted text' then
+	&& echo local 'quoted text' $(pwd) | printf "$@" test 2>/dev/null 2>/dev/null
+		"$1" /usr/bin "$@" readonly then then grep awk then /usr/bin export ${HOME}
+		${HOME} 2>/dev/null | 2>/dev/null printf grep -eu "$@" then /usr/bin
+cd ${HOME} -eu --verbose | sed local 2>/dev/null
+	&& sed then && "$@" grep awk printf awk 'quoted text'
+"$1" -eu "$1" awk export done grep printf ${HOME} grep printf -eu 2>/dev/null
+		done "$1" sed | --verbose echo printf --verbose sed
+		'quoted text' "$1" printf sed x=1 /usr/bin -eu grep ${HOME} readonly awk
+		done test "$1" -eu $(pwd) done
+	readonly -eu /usr/bin "$@" x=1 --verbose ${HOME} -eu |
+	x=1 local | -eu && grep "$@" && local awk 2>/dev/null $(pwd) "$1" $(pwd)
+	test done --verbose echo readonly "$1" export | $(pwd) /usr/bin 2>/dev/null
+test /usr/bin /usr/bin
+export done && readonly /usr/bin $(pwd) 'quoted text' sed | 'quoted text'
+readonly export 'quoted text' 'quoted text'
+		grep ${HOME} export 'quoted text'
+		export export awk "$@" local
+	readonly printf grep readonly x=1 $(pwd)
+x=1 cd "$1" /usr/bin sed cd test 2>/dev/null readonly
+awk --verbose ${HOME} grep echo "$1" grep "$@" x=1 export export done awk
+readonly ${HOME} "$1" awk | $(pwd) done grep
+	local 2>/dev/null readonly done grep test then -eu && "$1"
+	'quoted text' x=1 -eu echo
+	done then | $(pwd) "$@" $(pwd) echo cd then awk x=1 -eu | -eu local done
+		export awk local "$1" 'quoted text' /usr/bin "$1" x=1 then 2>/dev/null test
+"$@" "$1" "$@" x=1 "$@" local awk && ${HOME} test done --verbose
+&& printf grep 'quoted text' printf 'quoted text' printf
+printf "$1" --verbose readonly test | -eu grep ${HOME} test "$@"
+		echo printf x=1 && cd test
+done --verbose printf "$1" && grep grep x=1 ${HOME} "$@" done
+	local test done sed grep local cd test
+-eu /usr/bin local local test 'quoted text' export test "$1" local "$1" "$@"
+echo ${HOME} x=1 $(pwd) /usr/bin sed 2>/dev/null && export printf "$1" echo
+sed --verbose export && ${HOME} export grep $(pwd) echo --verbose sed done local
+	cd x=1 ${HOME} x=1 "$1" "$@" -eu done test printf local sed 2>/dev/null local
+		"$1" awk $(pwd) cd test done
+	done "$@" x=1 --verbose
+	printf readonly cd ${HOME} local && "$1" readonly 2>/dev/null | echo "$@"
+	$(pwd) sed "$1" && echo then 'quoted text'
+		echo "$1" ${HOME} 'quoted text'
+		$(pwd) grep export local x=1 --verbose then $(pwd) $(pwd) --verbose
+	cd ${HOME} $(pwd) test cd | /usr/bin -eu done /usr/bin
+| 2>/dev/null sed export done printf x=1 2>/dev/null done grep
+'quoted text' --verbose "$@" grep /usr/bin "$1" echo sed printf 2>/dev/null
+		'quoted text' grep /usr/bin
+		done "$1" export && 'quoted text'
+--verbose printf "$@"
+		done printf && then awk -eu cd export 2>/dev/null awk
+| cd sed test grep x=1 echo
+&& --verbose local echo
+	'quoted text' awk ${HOME} grep then x=1 'quoted text' test --verbose done export
+		"$1" "$1" grep --verbose awk 'quoted text' then done echo printf
+	local /usr/bin test printf export printf -eu --verbose
+		2>/dev/null awk && export 2>/dev/null && printf /usr/bin readonly echo local
+		readonly cd 'quoted text' done local --verbose
+	then printf printf awk 2>/dev/null --verbose -eu "$@"
+'quoted text' echo "$1" 'quoted text' echo x=1 "$1" ${HOME}
+done echo x=1 printf 'quoted text'
+		&& /usr/bin && 'quoted text' readonly 'quoted text'
+echo "$@" | 'quoted text' "$1" /usr/bin /usr/bin
+	2>/dev/null x=1 cd -eu sed done 2>/dev/null
+then --verbose | 2>/dev/null /usr/bin then $(pwd) && --verbose x=1 then x=1 x=1
+"$@" local -eu --verbose grep
+		echo done sed "$@" 'quoted text' printf x=1 local | echo
+		sed && ${HOME} "$1" test ${HOME}
+export cd sed 2>/dev/null sed echo awk cd done "$1" 2>/dev/null "$@"
+		grep grep test /usr/bin $(pwd) --verbose ${HOME} --verbose x=1 awk test 'quoted text'
+		"$@" awk echo done x=1 awk ${HOME} sed sed cd export x=1 2>/dev/null
+		2>/dev/null test then $(pwd) done done awk /usr/bin local cd $(pwd)
+export local 2>/dev/null -eu x=1 "$1" 2>/dev/null test cd sed --verbose
+--verbose "$1" grep "$1" "$@" /usr/bin
+		export x=1 awk "$1" local cd /usr/bin --verbose awk -eu x=1 x=1 printf 2>/dev/null
+		printf echo 'quoted text' printf | cd grep local 'quoted text'
+	then echo -eu test "$@" --verbose /usr/bin "$1" then
+${HOME} -eu done | ${HOME} x=1 awk readonly "$1" done then export
+		'quoted text' 2>/dev/null -eu local | echo x=1 readonly ${HOME} "$1" test
+		"$@" done grep awk awk cd -eu then export x=1 /usr/bin
+		local -eu awk "$1" "$1" | cd then &&
+then local echo local test echo readonly -eu "$1" --verbose $(pwd)
+		2>/dev/null && printf
+export -eu | done x=1 readonly test printf then test 'quoted text' && sed
+	"$@" x=1 readonly echo awk then then -eu "$1" readonly /usr/bin test ${HOME}
+	cd readonly --verbose /usr/bin cd ${HOME}
+		'quoted text' -eu awk sed sed local /usr/bin "$1" "$1" $(pwd) readonly
+		"$1" | test $(pwd) 'quoted text' "$1" done export $(pwd)
+	x=1 && readonly test test 'quoted text' -eu local
+	cd 2>/dev/null 2>/dev/null
+		${HOME} "$1" cd printf awk /usr/bin
+	local | "$1" grep && sed /usr/bin awk awk awk export -eu
+awk export readonly --verbose readonly
+	| --verbose x=1 local --verbose export test /usr/bin
+2>/dev/null then $(pwd) readonly echo echo
+		printf 2>/dev/null export echo 2>/dev/null x=1 $(pwd)
+	-eu "$@" --verbose 'quoted text'
+	'quoted text' --verbose export readonly
+export export /usr/bin readonly sed sed echo awk $(pwd) x=1 cd /usr/bin
+		"$1" printf echo done cd | test awk /usr/bin local
+	"$1" printf ${HOME} done cd | $(pwd) sed then --verbose /usr/bin
+	grep "$@" awk ${HOME} "$1" export x=1 && local
+| ${HOME} test /usr/bin printf cd 'quoted text' cd "$@"
+printf && echo local /usr/bin $(pwd) echo "$1" && local export $(pwd)
+echo echo readonly -eu 2>/dev/null 'quoted text' /usr/bin x=1 printf
+		'quoted text' local local test cd | done $(pwd) awk test $(pwd)
+		| grep --verbose test x=1 echo | echo done ${HOME} x=1 readonly /usr/bin done
+$(pwd) ${HOME} export test x=1 done sed 'quoted text' && ${HOME} 'quoted text'
+2>/dev/null "$1" readonly export cd
+printf 2>/dev/null x=1 export test ${HOME} --verbose
+		"$@" cd ${HOME} "$@" cd local 'quoted text' cd && x=1 cd --verbose
+	test printf grep 2>/dev/null "$1" 2>/dev/null local awk printf
+	echo awk readonly $(pwd) printf "$1" cd -eu test test 'quoted text'
+"$@" local printf echo local grep $(pwd) --verbose
+	echo 'quoted text' export -eu | sed local echo 2>/dev/null
+x=1 && echo test 2>/dev/null
+		test test test done echo test -eu local ${HOME} sed $(pwd)
+		--verbose "$@" local && cd /usr/bin export x=1 "$1" /usr/bin
+export grep "$@" ${HOME} ${HOME} x=1 cd
+		/usr/bin then test test --verbose cd awk "$1" | awk /usr/bin echo | /usr/bin
+	export grep then printf export --verbose
+/usr/bin done "$@" 2>/dev/null $(pwd)
+$(pwd) local -eu | awk done cd test && grep then ${HOME} sed then done
+	then && echo test | readonly x=1
+	2>/dev/null sed export grep printf && export
+	grep grep 2>/dev/null "$@" sed local grep | grep printf ${HOME} && sed "$@" "$1"
+	--verbose 2>/dev/null awk sed export sed $(pwd) | cd echo then local | echo done
+	cd export test test x=1
+		local printf $(pwd) then done "$1" "$1"
+| awk $(pwd) && | grep "$1" /usr/bin -eu readonly cd "$@" test done 2>/dev/null
+		&& "$1" 2>/dev/null --verbose cd 'quoted text' awk /usr/bin "$1" x=1
+	"$1" /usr/bin $(pwd) grep test "$1" && cd done /usr/bin readonly
+	printf --verbose done "$1" printf sed export --verbose
+done -eu local 2>/dev/null export local 2>/dev/null x=1
+	test $(pwd) echo 2>/dev/null done
+test -eu export /usr/bin then "$1" local then
+	awk then | export then
+		readonly awk then $(pwd) test printf cd | export -eu export
+	then done "$@" /usr/bin done $(pwd) 2>/dev/null echo /usr/bin
+	&& x=1 local --verbose -eu echo "$@" done "$@" done 'quoted text' ${HOME}
+	&& readonly echo | x=1 "$1" done "$1" 'quoted text' "$1" 'quoted text' cd export
+		sed cd && /usr/bin x=1 readonly "$1" then --verbose awk local ${HOME}
+	-eu "$@" && 2>/dev/null ${HOME} | --verbose 2>/dev/null awk cd --verbose
+		echo printf awk 'quoted text' --verbose export local 'quoted text' /usr/bin
+		&& --verbose --verbose local
+	-eu x=1 sed /usr/bin cd "$@"
+2>/dev/null "$1" /usr/bin /usr/bin
+		printf | --verbose local x=1 -eu sed
+awk awk ${HOME} grep --verbose
+done -eu --verbose echo /usr/bin 'quoted text' --verbose awk awk
+		x=1 awk sed export sed && && local echo sed ${HOME}
+test --verbose x=1 "$1" done then printf --verbose -eu | echo x=1 /usr/bin
+	&& x=1 sed $(pwd) readonly x=1
+	'quoted text' readonly readonly echo x=1 | grep
+	"$1" && echo | local readonly --verbose test --verbose "$1" 'quoted text' "$1"
+	--verbose /usr/bin readonly && echo -eu export /usr/bin
+		${HOME} export x=1 local test
+		| cd readonly && export x=1 2>/dev/null
+${HOME} $(pwd) $(pwd)
+x=1 export x=1 $(pwd) ${HOME} && local $(pwd) /usr/bin readonly "$@"
+	test --verbose /usr/bin then readonly /usr/bin && --verbose /usr/bin -eu grep
+awk local local -eu | cd grep readonly | --verbose then then /usr/bin /usr/bin
+		done local /usr/bin && x=1 'quoted text' 'quoted text'
+	done echo "$@" grep 'quoted text'
+		cd printf then done -eu "$@" --verbose
+sed awk 2>/dev/null export 2>/dev/null echo printf sed 'quoted text' x=1 x=1
+		--verbose awk then x=1
+		&& ${HOME} 'quoted text'
+		| awk awk readonly printf export sed echo export && x=1 cd grep 2>/dev/null
+	-eu done --verbose | done --verbose $(pwd) test -eu export
+	2>/dev/null 'quoted text' done |
+	"$@" ${HOME} 'quoted text' local
+	test grep readonly export /usr/bin 'quoted text'
+		/usr/bin cd && -eu x=1 2>/dev/null 'quoted text' local --verbose -eu && grep export
+2>/dev/null --verbose ${HOME} then export -eu export sed echo test /usr/bin
+		done /usr/bin sed "$@" && then | readonly cd done export "$1" x=1 then "$1" $(pwd)
+	local ${HOME} /usr/bin | echo /usr/bin -eu awk cd "$@" 2>/dev/null done
+	grep x=1 local ${HOME} cd readonly | done grep |
+		/usr/bin then x=1 sed test local cd 'quoted text' local /usr/bin
+		export sed test export export ${HOME} then -eu -eu sed then readonly
+echo $(pwd) readonly --verbose echo sed echo $(pwd) cd 'quoted text' sed
+/usr/bin sed sed sed cd test ${HOME} test sed
+		test readonly readonly $(pwd)
+	x=1 "$@" done readonly 'quoted text' x=1 --verbose | x=1 awk /usr/bin export
+	cd done grep done -eu | local export "$1" "$1" sed
+	--verbose $(pwd) echo local | | sed "$1" readonly export cd
+"$@" readonly echo --verbose cd grep 'quoted text' printf test x=1 done
+		'quoted text' -eu echo --verbose -eu readonly "$@"
+	-eu local x=1 && printf
+	$(pwd) --verbose awk -eu 'quoted text' cd test | 'quoted text' -eu |
+		${HOME} --verbose readonly |
+&& done | cd "$@" 'quoted text' 'quoted text' x=1 2>/dev/null test done
+		--verbose local --verbose grep done
+		&& sed cd x=1 && test 2>/dev/null export "$@" done
+		done cd | /usr/bin export done | x=1 export "$1" "$@" printf then echo 'quoted text'
+	sed -eu test $(pwd) | done ${HOME} readonly awk test export
+		x=1 awk test test echo echo -eu ${HOME}
+"$1" /usr/bin --verbose $(pwd) test grep printf /usr/bin done | echo "$1" cd
+printf local "$1" grep readonly "$@" "$@" cd 2>/dev/null 'quoted text'
+	| "$@" 'quoted text' sed
+		-eu && export 2>/dev/null
+echo $(pwd) printf local $(pwd) x=1 && ${HOME} local cd sed /usr/bin "$1"
+	/usr/bin --verbose echo grep 2>/dev/null
+	'quoted text' -eu "$1" grep 'quoted text' "$1" test awk done test sed sed
+	| echo "$@" x=1 awk ${HOME}
+echo printf echo sed 'quoted text' printf test 'quoted text' --verbose sed &&
+		echo | --verbose cd export
+export --verbose 'quoted text' test printf
+sed test grep | then -eu "$@" cd sed &&
+	x=1 2>/dev/null export sed awk export sed "$@"
+		then 'quoted text' "$1"
+2>/dev/null 2>/dev/null sed $(pwd)
+2>/dev/null done echo done test $(pwd) -eu $(pwd) grep
+	echo x=1 x=1 ${HOME} then export
+-eu --verbose "$@" 'quoted text'
+		done export cd x=1 grep $(pwd) local "$1" awk done | awk /usr/bin 2>/dev/null
+awk /usr/bin 'quoted text' $(pwd)
+	"$1" then ${HOME} 'quoted text'
+	awk 'quoted text' printf $(pwd) -eu done "$@" printf $(pwd) 2>/dev/null grep
+		cd done | done done readonly
+	&& then printf grep cd 'quoted text'
+	2>/dev/null readonly x=1 2>/dev/null grep
+2>/dev/null $(pwd) x=1 ${HOME} --verbose
+		export export && cd && ${HOME} "$1" | awk ${HOME} cd cd local ${HOME} -eu
+	echo -eu --verbose /usr/bin then
+	"$@" echo export then "$1" sed readonly
+	--verbose "$1" sed test cd sed -eu local $(pwd) readonly
+	test test done readonly awk -eu "$@"
+readonly -eu -eu -eu | --verbose "$@" --verbose
+		"$1" /usr/bin export grep "$1"
+| "$1" /usr/bin "$1" cd --verbose test -eu ${HOME} done -eu | done test --verbose
+	cd /usr/bin -eu echo x=1 echo && "$@" --verbose
+		2>/dev/null "$1" grep -eu awk grep done "$1" x=1 readonly sed test
+2>/dev/null local $(pwd) /usr/bin 2>/dev/null &&
+grep sed 'quoted text' echo test local sed
+sed sed local then -eu cd done printf
+awk $(pwd) /usr/bin --verbose ${HOME} 'quoted text' export 'quoted text'
+	2>/dev/null | awk | echo test
+		then local then printf && ${HOME} done && x=1
+		echo /usr/bin sed 'quoted text' -eu x=1 then "$@" -eu /usr/bin local --verbose
+	/usr/bin readonly -eu export /usr/bin awk awk then "$1" x=1
+"$@" -eu awk export 2>/dev/null then "$@" /usr/bin
+echo && 2>/dev/null local
+| printf cd && "$@" export awk printf
+/usr/bin local test awk sed "$1"
+	local echo && /usr/bin 'quoted text' 2>/dev/null x=1 "$1"
+	2>/dev/null grep "$1" 2>/dev/null x=1 cd --verbose
+$(pwd) then then "$@" printf awk
+export && readonly printf
+	"$@" && echo printf done readonly test 2>/dev/null echo 2>/dev/null awk sed x=1
+		'quoted text' 2>/dev/null
+export 'quoted text' cd export /usr/bin "$@" ${HOME} test
+then --verbose x=1 -eu test printf sed printf local then /usr/bin export
+		awk --verbose --verbose -eu test test --verbose
+		cd export done "$@" /usr/bin printf cd -eu awk $(pwd) | x=1 then test x=1
+		then ${HOME} local $(pwd) /usr/bin | --verbose "$@" "$1" x=1 done
+	grep printf -eu 'quoted text' local /usr/bin cd printf && awk readonly
+	2>/dev/null awk grep cd $(pwd) -eu $(pwd) /usr/bin local $(pwd) sed "$@" 2>/dev/null
+		x=1 echo grep && done done x=1 /usr/bin cd ${HOME} && 'quoted text'
+		"$@" | /usr/bin x=1 ${HOME} -eu "$1" grep $(pwd)
+		"$1" | local awk test 2>/dev/null "$@" test | /usr/bin readonly
+	readonly x=1 test awk 2>/dev/null
+	2>/dev/null $(pwd) local grep --verbose printf
+		| cd echo && /usr/bin | then ${HOME} "$1" echo export
+	--verbose printf x=1 2>/dev/null "$@" --verbose grep --verbose 'quoted text' awk
+$(pwd) then "$1" ${HOME} /usr/bin done
+--verbose test -eu "$1" && -eu then done local local export -eu printf ${HOME}
+2>/dev/null done x=1 ${HOME} awk 2>/dev/null
+	'quoted text' sed && --verbose
+sed grep /usr/bin x=1 $(pwd)
+	$(pwd) printf 2>/dev/null -eu --verbose readonly && done test
+	"$@" test && && export $(pwd) cd 'quoted text'
+		--verbose test ${HOME} awk x=1 awk /usr/bin | local --verbose /usr/bin
+		echo sed awk test "$1" then readonly done ${HOME}
+	readonly then echo awk done awk | "$@" local done /usr/bin local cd cd then
+		"$1" -eu 2>/dev/null /usr/bin cd "$@" done ${HOME} export /usr/bin
+	2>/dev/null local printf x=1 'quoted text' -eu /usr/bin ${HOME} sed "$@" $(pwd)
+	grep echo $(pwd) echo $(pwd) 2>/dev/null grep --verbose "$@" grep
+-eu | cd then cd cd sed -eu "$@" |
+	readonly --verbose 'quoted text' grep
+		sed && 2>/dev/null -eu test echo awk "$1" |
+		grep cd awk test 2>/dev/null sed echo 'quoted text' /usr/bin
+	"$1" $(pwd) sed /usr/bin &&
+sed then printf cd export then local /usr/bin grep 2>/dev/null -eu grep done echo
+	2>/dev/null readonly && | -eu $(pwd) x=1 x=1 --verbose "$1" && "$@" /usr/bin
+| && echo cd -eu ${HOME} then local
+		test $(pwd) then export 'quoted text' | sed 'quoted text' cd done export
+		export && 'quoted text' x=1 /usr/bin 'quoted text' && && local -eu | printf sed
+&& cd "$@" 2>/dev/null test "$1" cd test grep -eu 'quoted text'
+	-eu | cd local 2>/dev/null ${HOME} x=1 /usr/bin then 2>/dev/null
+		test local -eu | echo export
+test $(pwd) 2>/dev/null /usr/bin grep $(pwd) readonly
+	x=1 readonly "$@" local 'quoted text' grep then export --verbose | --verbose grep
+grep cd sed awk then sed sed --verbose $(pwd) x=1 then -eu $(pwd) /usr/bin
+	export readonly 'quoted text' -eu $(pwd) && | --verbose
+local && local --verbose && /usr/bin && readonly
+	test test readonly --verbose cd local printf && /usr/bin then
+		done /usr/bin $(pwd) &&
+/usr/bin 'quoted text' done then done readonly x=1 export ${HOME} "$1" awk
+		"$1" done "$@" ${HOME} grep echo
+		readonly "$@" cd printf then -eu /usr/bin -eu
+		cd printf "$1" x=1 test
+	$(pwd) 2>/dev/null readonly ${HOME} $(pwd) $(pwd) done $(pwd) --verbose
+	x=1 'quoted text' export ${HOME} grep
+	$(pwd) $(pwd) awk x=1 local
+		${HOME} test --verbose | test export ${HOME} ${HOME} --verbose
+x=1 2>/dev/null | "$1" --verbose
+		&& /usr/bin grep grep x=1 test printf --verbose done /usr/bin /usr/bin awk
+test 'quoted text' /usr/bin grep $(pwd) 'quoted text' -eu 'quoted text'
+	printf --verbose -eu -eu "$1" readonly
+		"$1" | test local grep ${HOME} -eu
+		done printf -eu -eu 'quoted text'
+printf "$@" printf -eu done ${HOME} echo then 2>/dev/null
+	${HOME} echo sed readonly 'quoted text'
+2>/dev/null x=1 echo grep
+sed echo then done ${HOME} /usr/bin && cd sed
+| grep x=1 cd then $(pwd) ${HOME} 'quoted text'
+		--verbose 2>/dev/null local 2>/dev/null readonly printf 2>/dev/null sed
+echo grep && && grep $(pwd) then 2>/dev/null
+2>/dev/null grep readonly --verbose | export | export grep
+"$1" "$1" readonly 'quoted text' sed | test cd /usr/bin "$@" export
+		x=1 readonly $(pwd) /usr/bin
+		test $(pwd) then && --verbose
+'quoted text' x=1 then /usr/bin && grep && awk awk echo
+echo "$@" | /usr/bin echo export && "$1" && ${HOME}
+$(pwd) --verbose /usr/bin
+	done then test then local && 'quoted text'
+	readonly "$1" | && awk sed | 'quoted text' && test && "$1"
+test grep test x=1 readonly readonly "$@" --verbose /usr/bin
+		then awk "$1" printf then awk then $(pwd) "$1" -eu
+	${HOME} sed printf awk x=1 'quoted text' echo 2>/dev/null sed
+'quoted text' grep "$1" done printf ${HOME} x=1 cd echo x=1 awk && awk /usr/bin
+		echo cd && "$@" x=1 --verbose -eu x=1 "$@" then local --verbose
+&& printf ${HOME} -eu export "$@" 2>/dev/null printf then
+	&& readonly printf --verbose echo readonly ${HOME} printf
+echo sed echo printf grep test awk /usr/bin done readonly --verbose awk
+	then | x=1 export "$@" done
+	printf test test 2>/dev/null readonly "$@" | cd ${HOME} awk /usr/bin
+		'quoted text' readonly x=1 2>/dev/null
+test done --verbose --verbose /usr/bin grep printf 2>/dev/null
+	x=1 then 2>/dev/null cd test && readonly x=1 2>/dev/null "$1" echo awk
+| local --verbose cd grep export "$@" && cd $(pwd) echo 2>/dev/null -eu
+	awk --verbose | --verbose awk grep 'quoted text'
+"$1" test -eu | --verbose
+		'quoted text' sed x=1 awk | grep awk
+local sed $(pwd) export export "$@" ${HOME}
+&& done | --verbose 2>/dev/null test done -eu 2>/dev/null
+	export 'quoted text' test --verbose ${HOME} grep "$@" echo readonly "$@"
+	-eu printf "$@" readonly ${HOME} ${HOME} cd 'quoted text'
+2>/dev/null done x=1 | cd echo export
+echo echo readonly done /usr/bin test /usr/bin "$1" export 2>/dev/null
+		export /usr/bin -eu done test then ${HOME}
+		'quoted text' && readonly ${HOME}
+	x=1 then | | /usr/bin grep echo /usr/bin
+		"$@" export grep -eu | export 'quoted text' sed 2>/dev/null then $(pwd) readonly
+	x=1 echo local test --verbose local "$1" printf then echo echo "$@" "$1" printf
+		then x=1 export 'quoted text'
+	then echo export /usr/bin
+	2>/dev/null --verbose sed "$1" 'quoted text' "$1" readonly
+		2>/dev/null local printf -eu
+/usr/bin --verbose printf grep "$1"
+	cd 'quoted text' $(pwd) $(pwd) sed --verbose readonly "$1" && | "$@" "$@"
+$(pwd) -eu 'quoted text' test -eu
+grep printf sed "$1" -eu echo
+	sed /usr/bin --verbose ${HOME} grep
+	-eu then 'quoted text' -eu printf
+"$1" grep then 2>/dev/null
+	x=1 export printf grep printf
+-eu local then "$1" --verbose awk awk readonly ${HOME} 2>/dev/null
+-eu echo awk x=1 'quoted text' "$@" 2>/dev/null
+then export /usr/bin && | $(pwd)
+		export export --verbose $(pwd) cd export
+'quoted text' $(pwd) readonly
+--verbose local grep "$1" awk export && /usr/bin local 'quoted text' readonly $(pwd)
+	export /usr/bin test $(pwd) && --verbose readonly awk -eu
+		local "$@" x=1 export 'quoted text' cd local cd -eu 2>/dev/null
+	'quoted text' | cd sed cd
+local ${HOME} printf $(pwd) "$@" | export
+	$(pwd) 'quoted text' cd
+	"$1" local 'quoted text' | && export $(pwd) test x=1
+$(pwd) sed test then then readonly ${HOME} ${HOME}
+		| echo sed /usr/bin && sed awk test && then $(pwd) 2>/dev/null ${HOME}
+		then cd | "$@" --verbose x=1 then
+awk "$1" cd && echo ${HOME} sed 'quoted text' && sed -eu "$@" done
+x=1 export done 'quoted text' sed 2>/dev/null test
+	cd 2>/dev/null $(pwd) 'quoted text'
+"$1" readonly test ${HOME} | -eu 'quoted text'
+		| | && $(pwd) /usr/bin awk echo 2>/dev/null -eu /usr/bin
+	/usr/bin test done export
+		$(pwd) export sed && local /usr/bin $(pwd)
+	'quoted text' -eu "$1" --verbose cd
+		done /usr/bin x=1 echo | readonly ${HOME} 'quoted text'
+	| sed echo local grep | $(pwd) then readonly -eu local $(pwd)
+	then echo then ${HOME} awk "$@" sed 'quoted text' local echo then
+	${HOME} -eu readonly 'quoted text' $(pwd) local grep cd readonly awk "$1"
+		$(pwd) local ${HOME} then
+	printf sed readonly && $(pwd) | grep printf
+grep $(pwd) -eu echo then
+		&& grep /usr/bin export sed 'quoted text' | 'quoted text'
+		&& sed then && printf grep --verbose && ${HOME} readonly local 'quoted text'
+	sed test echo echo "$@" x=1 "$1" x=1 echo 2>/dev/null x=1 --verbose --verbose
+		"$@" "$@" sed local "$1" /usr/bin "$1" printf "$1"
+	sed done done cd --verbose /usr/bin printf x=1 /usr/bin /usr/bin grep "$1" x=1 /usr/bin
+	/usr/bin readonly test /usr/bin
+		| --verbose printf local 2>/dev/null
+echo done | readonly export done x=1 && local
+--verbose echo 2>/dev/null test test 2>/dev/null cd --verbose
+test echo printf cd then "$1" "$@" then $(pwd)
+cd 'quoted text' export "$1" local local && done test readonly
+		grep 'quoted text' | then | "$@" /usr/bin $(pwd) printf
+		sed grep | echo test --verbose awk test readonly
+	grep && --verbose export then sed done export echo "$1" echo ${HOME}
+$(pwd) local export --verbose /usr/bin readonly --verbose
+		&& -eu echo "$@" "$1" "$1" done test $(pwd) grep echo $(pwd)
+	$(pwd) -eu ${HOME} $(pwd) printf --verbose
+		x=1 ${HOME} /usr/bin awk -eu ${HOME} --verbose $(pwd) done "$@" done 'quoted text'
+		${HOME} readonly grep export | ${HOME} | printf
+		/usr/bin "$@" | && sed | then cd --verbose x=1 export "$@"
+		| x=1 readonly readonly sed && test
+	sed then export test | cd test export done cd -eu ${HOME} ${HOME}
+		-eu echo export echo "$1" echo x=1 "$@" -eu readonly then sed sed test
+		done then printf ${HOME} $(pwd) x=1 local 'quoted text' test local x=1
+local export "$@" done ${HOME} then done 2>/dev/null then printf done
+		2>/dev/null "$1" then local grep printf
+then grep /usr/bin test export printf | && ${HOME} $(pwd) grep grep done done
+	x=1 done "$@" local export "$@" &&
+$(pwd) grep && printf -eu
+--verbose $(pwd) $(pwd) cd export "$@" local "$@" export test
+	cd printf cd "$@" export cd 'quoted text' printf
+	"$1" printf 2>/dev/null /usr/bin ${HOME}
+		"$@" && readonly ${HOME} x=1 awk && readonly cd /usr/bin
+		'quoted text' printf "$1" then grep | local 2>/dev/null
+	'quoted text' --verbose && /usr/bin $(pwd) -eu awk sed
+	cd echo then 'quoted text' 2>/dev/null "$@" grep | | "$@" awk then done
+	"$@" local printf sed /usr/bin --verbose done printf awk awk -eu grep awk sed
+		x=1 ${HOME} | sed export readonly readonly 2>/dev/null export awk
+echo export grep test readonly
+	readonly "$@" local "$1" && grep "$@" "$@" local "$@" cd printf sed
+		echo "$@" && --verbose sed 'quoted text'
+		sed x=1 readonly && local 'quoted text' done 2>/dev/null
+		$(pwd) $(pwd) export cd ${HOME} grep | --verbose test 'quoted text' &&
+	"$@" export /usr/bin x=1 "$1" "$1"
+grep 2>/dev/null x=1 done 2>/dev/null ${HOME} /usr/bin
+		&& done "$@" grep printf printf 2>/dev/null $(pwd) x=1 readonly awk
+cd 2>/dev/null ${HOME} -eu sed awk readonly ${HOME} 2>/dev/null echo
+sed && export "$@" awk ${HOME} printf
+		2>/dev/null test export then echo awk | local x=1 export "$@" && --verbose 'quoted text'
+	export | readonly "$1" sed /usr/bin -eu test --verbose &&
+grep test x=1 awk echo --verbose ${HOME}
+&& x=1 cd | ${HOME} | printf awk
+printf 2>/dev/null && export printf --verbose then
+		'quoted text' /usr/bin printf cd
+	--verbose awk ${HOME} ${HOME} "$1" ${HOME} readonly grep export $(pwd) $(pwd)
+local "$1" x=1 ${HOME} export
+		printf done 'quoted text'
+	readonly x=1 /usr/bin then "$@" "$@" -eu echo
+	"$1" x=1 $(pwd) then done printf done "$1" cd -eu export awk awk echo
+awk $(pwd) test 2>/dev/null cd $(pwd) export x=1 $(pwd) -eu x=1 export
+--verbose test && awk test then local cd printf
+readonly then 2>/dev/null printf awk sed ${HOME} 'quoted text' 'quoted text'
+-eu done export local x=1 test
+then grep --verbose export 2>/dev/null test local | awk | local local "$1" export
+	test ${HOME} export readonly readonly sed
+"$@" 'quoted text' | -eu ${HOME} sed $(pwd) "$@" done test test done --verbose local
+		test cd printf export awk "$@" "$@" -eu echo grep sed echo x=1 test ${HOME} export
+	then 2>/dev/null $(pwd) cd 'quoted text'
+-eu then printf echo sed | cd -eu grep done cd "$1" echo $(pwd) done awk 2>/dev/null
+	readonly done "$@" test $(pwd) && local test 'quoted text'
+		$(pwd) | grep --verbose readonly done
+	printf grep /usr/bin then grep awk /usr/bin
+		${HOME} x=1 --verbose grep readonly done $(pwd)
+	done grep 2>/dev/null --verbose
+	readonly awk ${HOME} && export grep printf 'quoted text'
+		2>/dev/null 'quoted text' awk
+		&& then then echo $(pwd) then done && sed x=1 export awk then /usr/bin
+local | awk printf printf readonly
+		local echo done printf export
+	2>/dev/null | printf done awk
+	x=1 sed done "$1" -eu test local | --verbose --verbose | /usr/bin
+export awk /usr/bin --verbose "$@" sed grep sed && /usr/bin cd awk
+local test -eu printf /usr/bin $(pwd) "$1" x=1 then
+cd && awk sed | then $(pwd) test
+		"$1" --verbose grep ${HOME} "$1" awk test sed "$1" 2>/dev/null
+	/usr/bin | 2>/dev/null 'quoted text'
+echo printf export printf cd "$@" grep printf export x=1 x=1 local
+	sed then ${HOME} export readonly "$@" cd sed then readonly
+echo printf 'quoted text' cd then local -eu
+	test test ${HOME} 'quoted text' cd echo && ${HOME}
+$(pwd) printf ${HOME} ${HOME} then ${HOME} then then readonly
+awk 2>/dev/null readonly 'quoted text' --verbose
+	sed done && | $(pwd) grep && -eu local sed x=1 readonly grep cd
+		&& -eu x=1 cd awk local 'quoted text' awk
+	"$1" "$1" --verbose grep 2>/dev/null cd
+'quoted text' cd $(pwd) 'quoted text'
+$(pwd) 'quoted text' test grep $(pwd) export ${HOME}
+	-eu local cd /usr/bin $(pwd) --verbose "$1"
+cd then test 'quoted text' local
+awk done $(pwd) $(pwd) echo
+readonly x=1 ${HOME} "$@" export
+	readonly /usr/bin 'quoted text' x=1 readonly cd x=1 test | grep
+		echo 2>/dev/null "$@" then 'quoted text'
+		/usr/bin "$@" sed test done ${HOME} -eu --verbose grep
+	export x=1 'quoted text' sed $(pwd) grep 'quoted text'
+"$1" 2>/dev/null readonly local "$@" -eu "$@" && 'quoted text'
+	readonly then cd -eu then test x=1 then export sed cd ${HOME} readonly ${HOME} x=1
+		test done local sed then done |
+&& 2>/dev/null cd local printf local | 'quoted text'
+echo export test awk test 'quoted text' /usr/bin
+	test "$@" 'quoted text' 'quoted text' awk && sed then done -eu
+readonly x=1 local sed | readonly done then "$@" "$@"
+	printf --verbose awk /usr/bin export export then |
+printf /usr/bin test | readonly local readonly awk cd readonly 2>/dev/null 'quoted text'
+		test done test export "$1" export && done /usr/bin "$@" sed then
+		| $(pwd) "$1" x=1 grep -eu "$1" local --verbose
+		"$@" $(pwd) echo test grep "$1" test "$1" --verbose -eu done
+x=1 printf done "$1" sed "$@" "$@" $(pwd)
+	sed "$1" 'quoted text' 2>/dev/null
+-eu /usr/bin ${HOME} readonly export printf awk awk ${HOME} $(pwd) cd readonly --verbose
+"$@" 'quoted text' 2>/dev/null grep test done export /usr/bin
+"$@" && | export | "$1" grep local awk $(pwd) test && &&
+		local awk test 'quoted text' | readonly "$1" done done
+	then "$@" cd 'quoted text' --verbose
+		awk -eu /usr/bin && x=1 --verbose readonly awk "$@" $(pwd) test echo
+		$(pwd) ${HOME} $(pwd) && 2>/dev/null 'quoted text' ${HOME}
+${HOME} "$1" grep cd "$1" 'quoted text'
+		readonly | cd -eu "$@" export "$@" 2>/dev/null
+		printf 2>/dev/null sed | x=1 2>/dev/null
+x=1 printf readonly /usr/bin cd "$@" export grep then ${HOME} done awk && test
+sed /usr/bin test && sed grep echo grep | printf | then test then 2>/dev/null
+		"$@" 'quoted text' /usr/bin
+printf "$1" x=1 /usr/bin readonly local 'quoted text' /usr/bin /usr/bin
+		"$1" local "$1" readonly && |
+"$1" grep -eu echo test done | --verbose grep && x=1 then x=1 $(pwd) grep
+		grep local test cd done echo cd grep "$@" "$@" then done
+grep "$1" export "$1" && readonly /usr/bin "$1" "$1" $(pwd) cd
+	test done -eu printf 2>/dev/null
+echo --verbose awk 'quoted text' 'quoted text'
+	2>/dev/null ${HOME} grep $(pwd) $(pwd) -eu -eu && awk printf "$1" local then &&
+	$(pwd) cd sed echo && $(pwd) test done sed local x=1 echo grep then
+	done | readonly local "$1" awk test "$1" && |
+	then ${HOME} readonly awk ${HOME} grep then --verbose sed /usr/bin grep printf
+echo x=1 export cd awk --verbose
+		-eu readonly 'quoted text' local
+		then ${HOME} x=1 "$@" test ${HOME} -eu "$@" 'quoted text' cd x=1 awk ${HOME}
+/usr/bin && "$1" 'quoted text' ${HOME}
+/usr/bin -eu readonly echo /usr/bin "$1"
+		&& done local test awk test test
+	"$1" "$1" done awk &&
+sed -eu awk --verbose export local x=1 'quoted text'
+	echo echo sed test local "$@" done test 2>/dev/null
+	-eu $(pwd) -eu sed sed done x=1 test "$@" awk readonly sed $(pwd) readonly
+&& --verbose 2>/dev/null test 'quoted text'
+		/usr/bin && local 'quoted text' "$1"
+	awk /usr/bin && "$@" echo awk -eu $(pwd)
+		-eu 'quoted text' ${HOME} x=1 && readonly cd "$1"
+		done then x=1 --verbose && | export
+printf test -eu test && test
+"$@" awk 2>/dev/null grep awk -eu done cd printf -eu
+	"$@" 2>/dev/null && |
+	readonly printf --verbose && | | -eu
+awk awk x=1 "$1" x=1 echo &&
+	test echo grep awk && 2>/dev/null 2>/dev/null export
+	readonly && /usr/bin cd export test local | x=1 -eu cd
+	"$@" $(pwd) local -eu 'quoted text' readonly "$1" export "$1" -eu
+		"$@" -eu done $(pwd) grep then x=1
+	"$@" cd ${HOME} && test printf
+	"$@" echo "$@" 'quoted text' | done "$@" -eu local local "$1" export
+	sed 'quoted text' && echo local done -eu ${HOME} 2>/dev/null && local
+		printf cd export x=1 --verbose printf then export x=1 | test /usr/bin
+$(pwd) sed --verbose cd grep && grep ${HOME} grep
+grep sed grep --verbose "$1" readonly 'quoted text' cd
+		'quoted text' "$1" sed printf
+	/usr/bin -eu 2>/dev/null local
+cd --verbose | "$@" printf | awk $(pwd) readonly && /usr/bin printf && grep then
+	grep readonly cd then | echo export -eu test printf 'quoted text'
+2>/dev/null grep -eu awk 'quoted text' 2>/dev/null local
+		| export sed && done --verbose ${HOME} then 2>/dev/null
+		-eu local echo grep $(pwd) --verbose
+	$(pwd) awk "$@" cd -eu && export 'quoted text'
+	done /usr/bin -eu printf ${HOME} x=1 | then "$@" local /usr/bin 2>/dev/null
+		test awk cd local grep sed printf cd
+		$(pwd) export 'quoted text' test
+		$(pwd) readonly "$@" x=1 sed "$@" grep /usr/bin "$1" /usr/bin
+| ${HOME} /usr/bin awk |
+	readonly "$1" x=1 --verbose done
+local awk readonly local test /usr/bin
+local 2>/dev/null 2>/dev/null --verbose
+		sed 'quoted text' export -eu awk printf cd --verbose | test
+		done && "$1" local done --verbose -eu ${HOME} --verbose
+		test awk printf x=1 -eu 2>/dev/null
+then grep "$@" export 'quoted text' 2>/dev/null done /usr/bin sed 'quoted text'
+	${HOME} readonly test 'quoted text' $(pwd) local then grep export
+	-eu && readonly /usr/bin done x=1 done local | then done ${HOME}
+test then 'quoted text' "$@" printf &&
+	readonly readonly x=1 $(pwd) 'quoted text' --verbose echo
+		&& done readonly printf --verbose local then sed awk $(pwd)
+		'quoted text' "$@" -eu test | test && x=1 | echo x=1 -eu
+x=1 ${HOME} sed && echo --verbose "$1" grep
+		cd grep "$1" printf export | printf echo ${HOME} x=1
+		--verbose then test | cd ${HOME} echo x=1 test 'quoted text'
+	export then ${HOME} done x=1 ${HOME} then local -eu | | $(pwd)
+then echo export | 'quoted text' readonly grep "$@"
+		sed test $(pwd) cd sed local "$1" x=1 "$1" printf | awk cd local
+		awk x=1 cd 2>/dev/null ${HOME} export &&
+		--verbose x=1 test 'quoted text' "$@" --verbose grep "$1" 2>/dev/null && local
+printf --verbose printf sed
+	echo /usr/bin echo && x=1 cd | echo local x=1 export readonly $(pwd)
+	--verbose "$1" | /usr/bin
+x=1 /usr/bin echo -eu test local
+"$1" local grep echo local cd | then echo 2>/dev/null "$1" "$1" ${HOME} --verbose
+		sed then /usr/bin sed export 'quoted text' x=1 export "$@" $(pwd) -eu then
+${HOME} done 2>/dev/null $(pwd) && | | && --verbose 'quoted text' x=1 grep
+		then grep done awk readonly
+echo x=1 -eu then | x=1
+awk 2>/dev/null ${HOME} grep -eu | && then printf export
+then then done /usr/bin | x=1 awk 'quoted text' 2>/dev/null
+${HOME} sed echo $(pwd) sed x=1 export done cd test printf printf cd
+echo && "$@" --verbose
+then $(pwd) echo grep then echo done 'quoted text' $(pwd) local done
+		printf cd awk x=1 awk grep /usr/bin x=1
+		then awk awk echo && "$1" "$1" done printf $(pwd) 2>/dev/null awk readonly
+grep local export test "$1" && && 'quoted text' && then "$1" readonly
+"$1" done cd ${HOME} 'quoted text' done | "$@" then "$1" cd $(pwd) done
+| 2>/dev/null then readonly "$@" && -eu test export
+		then grep "$@" local "$@" done sed $(pwd) x=1 grep
+		-eu 'quoted text' export export test 2>/dev/null x=1 "$@" awk 2>/dev/null
+		| | "$@" 2>/dev/null readonly awk local sed ${HOME} cd x=1 readonly done
+grep then export test 'quoted text'
+local printf && --verbose test echo /usr/bin --verbose
+${HOME} done printf sed ${HOME} done 2>/dev/null "$1" | 'quoted text'
+	--verbose "$@" done x=1 | cd --verbose --verbose cd
+		"$1" "$1" && local "$1" cd local
+		--verbose readonly test x=1
+test ${HOME} local local $(pwd) export x=1 "$1" 'quoted text'
+	local 2>/dev/null 2>/dev/null test x=1 cd | sed
+		/usr/bin /usr/bin -eu sed echo grep | awk echo echo
+		-eu cd "$1" $(pwd) printf /usr/bin echo
+	sed done cd grep | sed
+		/usr/bin done then readonly done "$@" cd | ${HOME} --verbose $(pwd)
+	grep done 2>/dev/null cd -eu test test "$@" 2>/dev/null echo
+	/usr/bin test -eu 2>/dev/null
+		| local --verbose $(pwd) 'quoted text' 2>/dev/null local awk | awk echo -eu awk
+done -eu export sed && local local readonly 2>/dev/null /usr/bin | /usr/bin
+	2>/dev/null cd 'quoted text' --verbose -eu 'quoted text' ${HOME} echo
+	readonly x=1 "$1" grep local -eu cd 2>/dev/null then local --verbose -eu
+"$@" echo readonly ${HOME} done printf
+"$@" echo done sed export x=1 sed 2>/dev/null export grep &&
+readonly "$1" /usr/bin 'quoted text' "$1" 2>/dev/null echo local
+	cd ${HOME} sed x=1 echo then
+		| readonly /usr/bin test 'quoted text' echo | readonly printf local
+	'quoted text' echo /usr/bin --verbose test --verbose "$1" ${HOME} printf local
+	test awk "$1" sed "$@" local && 2>/dev/null ${HOME} x=1 -eu cd awk done
+$(pwd) "$1" grep sed awk export awk sed cd export && | /usr/bin && "$1"
+| x=1 cd "$1" ${HOME} 2>/dev/null | "$@" -eu x=1 printf x=1 local ${HOME}
+	sed echo local local /usr/bin "$@" then
+		$(pwd) $(pwd) sed cd then $(pwd) && --verbose -eu sed
+		awk "$@" test "$@" export 2>/dev/null 2>/dev/null ${HOME} && then
+-eu ${HOME} export export grep
+		&& export -eu cd echo done local echo
+		sed sed local sed echo /usr/bin 2>/dev/null x=1 export -eu test grep &&
+sed ${HOME} local ${HOME} 'quoted text' printf printf export then export
+	readonly readonly cd printf
+	--verbose -eu test export cd --verbose 'quoted text' /usr/bin "$1" /usr/bin
+${HOME} readonly "$1" sed test local ${HOME} --verbose cd test echo done
+		| --verbose awk x=1 printf "$1" --verbose
+		export test printf /usr/bin grep test printf test awk then export $(pwd)
+	/usr/bin --verbose ${HOME} 'quoted text'
+${HOME} | && | grep echo
+test /usr/bin test readonly -eu | sed -eu /usr/bin /usr/bin
+&& "$1" -eu grep local x=1 --verbose "$@" ${HOME} export
+		local ${HOME} "$1" awk "$@" grep --verbose awk --verbose
+	done done -eu printf readonly ${HOME} /usr/bin test printf printf cd
+local done echo 'quoted text' sed ${HOME} "$1" /usr/bin 'quoted text'
+	then /usr/bin "$1" && /usr/bin then /usr/bin "$1" export "$1" -eu --verbose
+	done sed readonly grep ${HOME} grep local awk readonly | "$1" awk
+	readonly | 2>/dev/null
+sed test && && export printf done "$@" "$1" printf --verbose
+	&& 2>/dev/null 2>/dev/null
+		test ${HOME} "$@" sed /usr/bin sed grep then && echo --verbose awk
+local --verbose then echo printf awk | readonly export $(pwd) 2>/dev/null "$1"
+		/usr/bin --verbose printf local 'quoted text' "$@" -eu --verbose 2>/dev/null
+printf echo /usr/bin x=1 echo 2>/dev/null cd sed | "$1" then
+		"$@" 'quoted text' "$1"
+		&& export cd --verbose ${HOME} export echo $(pwd) "$1" 'quoted text'
+echo awk sed "$1" grep echo --verbose cd echo 'quoted text' grep sed
+		| done --verbose "$1" -eu echo $(pwd)
+2>/dev/null ${HOME} export printf test x=1 then grep
+"$@" $(pwd) -eu | printf $(pwd)
+		export "$1" "$@" 'quoted text' | -eu
+	then test readonly awk cd --verbose sed export 2>/dev/null --verbose
+	test "$1" 'quoted text' awk
+test awk test $(pwd) 'quoted text' ${HOME}
+"$1" readonly local then local awk echo | && /usr/bin readonly then 'quoted text'
+		/usr/bin awk "$1" grep sed x=1 $(pwd) /usr/bin --verbose done grep "$@" sed
+2>/dev/null local awk -eu 2>/dev/null 'quoted text' done
+$(pwd) "$@" ${HOME} ${HOME} then
+	local test --verbose echo local ${HOME}
+	local awk readonly cd --verbose x=1 -eu sed then grep
+local test then "$1" done export export awk awk then awk --verbose printf
+$(pwd) cd ${HOME} cd 2>/dev/null grep && ${HOME}
+done /usr/bin sed "$1"
+printf /usr/bin cd /usr/bin -eu cd -eu /usr/bin $(pwd) readonly sed done "$1"
+	cd | && export -eu echo 'quoted text'
+		done then awk && ${HOME} ${HOME} done
+		printf "$@" local 'quoted text' export -eu "$@" | "$@" && -eu sed /usr/bin readonly
+	/usr/bin "$@" echo -eu --verbose export $(pwd) 2>/dev/null echo test
+		readonly test export done "$@" x=1 awk 2>/dev/null
+		printf --verbose /usr/bin ${HOME} readonly printf "$@"
+printf sed export sed /usr/bin x=1 readonly $(pwd) ${HOME}
+		sed "$@" 2>/dev/null readonly && test
+"$1" done ${HOME} echo "$@" local grep readonly -eu "$1" 'quoted text'
+	readonly sed grep /usr/bin
+		then done && local grep ${HOME} "$1" 2>/dev/null export && readonly
+	grep printf export --verbose awk
+	"$@" 2>/dev/null export x=1 -eu echo ${HOME} /usr/bin ${HOME}
+		'quoted text' awk printf 2>/dev/null
+cd x=1 && "$1" done | /usr/bin
+'quoted text' printf 'quoted text' /usr/bin echo
+	/usr/bin local done grep export then grep done --verbose | | grep --verbose
+	&& /usr/bin grep 2>/dev/null "$@"
+--verbose ${HOME} sed 'quoted text'
+		awk /usr/bin grep export -eu printf 2>/dev/null
+		'quoted text' local then then printf -eu done sed cd ${HOME} -eu
+		| "$1" /usr/bin done ${HOME} readonly --verbose awk printf
+echo done echo then grep | ${HOME} test readonly |
+	-eu 2>/dev/null /usr/bin readonly /usr/bin | sed readonly test readonly
+--verbose readonly sed | done test printf readonly 'quoted text'
+		sed grep | /usr/bin export ${HOME} done
+		export awk done -eu "$1" 2>/dev/null
+	&& | then x=1 && cd --verbose $(pwd) "$1" && printf export printf
+		grep cd --verbose && x=1 grep cd "$@" echo x=1
+printf export "$1" /usr/bin then sed test -eu
+		readonly && test local ${HOME} echo done local "$@" 2>/dev/null 2>/dev/null
+"$@" "$@" -eu then readonly grep echo then /usr/bin test local
+	${HOME} readonly grep done export $(pwd)
+	awk test | $(pwd) echo --verbose
+2>/dev/null readonly printf ${HOME}
+		done then 'quoted text' --verbose x=1 printf
+		2>/dev/null then printf test ${HOME} then | && --verbose local && --verbose
+local --verbose ${HOME} $(pwd) x=1 cd sed local printf export x=1 |
+	--verbose --verbose x=1 2>/dev/null grep
+	x=1 test export /usr/bin awk export readonly /usr/bin sed 2>/dev/null
+	${HOME} local printf /usr/bin done
+	export -eu export ${HOME}
+'quoted text' "$1" 'quoted text' then export sed ${HOME} x=1 $(pwd)
+		x=1 cd test 'quoted text' 'quoted text'
+		export awk "$@" --verbose 'quoted text' --verbose 2>/dev/null
+x=1 ${HOME} "$1" then grep test
+	echo grep --verbose "$1" | 'quoted text'
+2>/dev/null "$1" -eu done
+	-eu -eu then && "$@" $(pwd) cd
+		sed readonly export -eu $(pwd) "$@" export /usr/bin printf cd echo &&
+		grep cd awk test ${HOME} | "$1" export grep ${HOME} sed $(pwd) readonly
+$(pwd) readonly local sed then printf then then echo export && 'quoted text' $(pwd)
+	&& "$@" sed /usr/bin export grep test echo export && readonly
+done printf echo sed then awk local
+	then awk test local export sed sed export readonly "$1" echo cd | test x=1
+		&& /usr/bin /usr/bin done then
+	x=1 "$@" grep -eu "$1" -eu
+	'quoted text' && sed grep readonly --verbose echo "$1" awk
+export readonly readonly grep readonly x=1
+export grep ${HOME} test --verbose
+	sed done "$@" 2>/dev/null grep cd
+	| export --verbose | sed echo && readonly cd x=1
+awk --verbose printf /usr/bin --verbose awk sed -eu done readonly
+done test echo sed 'quoted text' readonly -eu "$@"
+		local x=1 test cd readonly /usr/bin --verbose sed "$1" test then readonly | 'quoted text'
+		--verbose /usr/bin readonly then
+	&& ${HOME} | ${HOME} x=1 echo $(pwd) "$@" $(pwd)
+		then "$@" export awk test cd grep then cd
+awk -eu && x=1 --verbose readonly ${HOME}
+awk x=1 -eu -eu x=1 "$@"
+done readonly readonly test "$@" && sed --verbose ${HOME}
+$(pwd) -eu /usr/bin 2>/dev/null $(pwd) printf x=1 echo /usr/bin "$1" cd x=1 ${HOME}
+"$@" x=1 echo done local $(pwd) ${HOME} then x=1 done
+	grep printf export "$@" $(pwd) -eu && grep "$@"
+	printf --verbose "$@" then cd done done --verbose /usr/bin 2>/dev/null x=1 echo
+	sed /usr/bin "$@" cd 'quoted text'
+	local export readonly cd | test grep readonly "$1" -eu readonly done
+	${HOME} "$1" | awk readonly export sed | grep then
+x=1 awk --verbose ${HOME} printf --verbose echo x=1 readonly /usr/bin
+	then then -eu then done 2>/dev/null | "$@" then cd x=1 $(pwd) $(pwd) "$1"
+-eu grep cd grep export x=1 --verbose echo export /usr/bin "$1" x=1 sed done
+	-eu grep x=1 2>/dev/null x=1 $(pwd) export readonly /usr/bin
+test echo printf then done -eu cd cd -eu x=1 readonly grep --verbose
+		done sed "$1" ${HOME} 'quoted text' && 'quoted text' -eu
+cd grep printf test readonly
+--verbose ${HOME} --verbose export echo 'quoted text' sed 2>/dev/null "$1"
+	x=1 local x=1 "$1" ${HOME} sed $(pwd) "$1"
+		| test test /usr/bin && done
+	/usr/bin awk local sed export export 2>/dev/null
+	then "$1" done done done "$@" ${HOME} -eu
+$(pwd) sed 2>/dev/null awk 2>/dev/null done 2>/dev/null /usr/bin
+		x=1 cd sed sed "$@" "$1" $(pwd) "$@" echo readonly
+then "$1" awk --verbose grep test grep awk --verbose local readonly 2>/dev/null
+done export readonly done x=1 then x=1 grep echo sed 2>/dev/null
+'quoted text' test readonly $(pwd) echo done grep | /usr/bin
+		/usr/bin export 2>/dev/null local $(pwd)
+		"$1" local readonly export 'quoted text' done ${HOME}
+'quoted text' "$1" x=1 then "$@"
+local /usr/bin printf && grep x=1 -eu local awk /usr/bin printf "$1" "$1"
+	readonly -eu 'quoted text' export readonly echo local
+x=1 "$1" echo 'quoted text'
+		done test echo sed 'quoted text' sed echo awk then 2>/dev/null printf 2>/dev/null
+		"$1" echo 2>/dev/null test x=1 local "$@" --verbose
+"$@" --verbose awk echo cd "$1" cd export
+grep 2>/dev/null 'quoted text' done x=1 /usr/bin
+sed printf export ${HOME} awk test echo 'quoted text' |
+&& local -eu echo -eu grep $(pwd) | 'quoted text'
+	echo cd then && awk x=1 cd "$@" done cd grep -eu /usr/bin cd
+cd "$@" then awk export readonly && && "$@" -eu ${HOME}
+	grep -eu sed printf /usr/bin test 'quoted text' printf /usr/bin done
+x=1 --verbose "$@" /usr/bin $(pwd) grep -eu then local /usr/bin
+readonly sed done echo 'quoted text' local sed export --verbose 'quoted text'
+awk grep 2>/dev/null | local --verbose grep
+done 2>/dev/null 'quoted text' readonly
+	local readonly then echo printf /usr/bin echo test
+		$(pwd) $(pwd) -eu cd test -eu export $(pwd) | "$@" /usr/bin echo
+		&& grep cd --verbose then 2>/dev/null "$1" readonly "$1" grep $(pwd)
+	done --verbose export x=1
+	sed export x=1 -eu && readonly | export
+${HOME} local $(pwd) 2>/dev/null ${HOME} 'quoted text' echo export --verbose printf
+	done printf local x=1 | done $(pwd)
+	-eu cd 2>/dev/null && done | test cd
+	then x=1 --verbose readonly ${HOME} done grep test "$1" done
+		cd sed -eu export cd then printf then
+	done printf grep cd -eu | $(pwd) && x=1 /usr/bin /usr/bin /usr/bin sed done 2>/dev/null
+		done local ${HOME} grep -eu -eu test readonly printf
+	--verbose printf sed cd awk $(pwd) export "$@" /usr/bin printf cd -eu 'quoted text'
+		then /usr/bin 2>/dev/null -eu printf export x=1 $(pwd) grep export readonly
+/usr/bin 'quoted text' printf cd echo sed 2>/dev/null
+-eu x=1 grep --verbose --verbose --verbose --verbose readonly
+sed printf "$@" 2>/dev/null echo
+"$@" echo | /usr/bin "$@"
+		x=1 awk -eu then -eu "$1" cd printf $(pwd) local export export "$1"
+$(pwd) 2>/dev/null sed test echo cd "$@" x=1 test printf "$1" echo "$@" /usr/bin
+x=1 awk then $(pwd) readonly ${HOME} -eu ${HOME}
+done "$@" sed 2>/dev/null -eu $(pwd) local
+	export ${HOME} "$1" echo 2>/dev/null done readonly
+	then cd 'quoted text' 2>/dev/null
+		export done awk echo grep test -eu
+		-eu echo echo printf echo -eu -eu --verbose
+	done 'quoted text' export export export
+then export then test test "$@" $(pwd)
+		--verbose awk awk --verbose cd done --verbose sed
+		test 2>/dev/null -eu readonly test echo awk readonly grep printf cd --verbose
+awk x=1 test 2>/dev/null $(pwd) "$@"
+	export printf export --verbose 2>/dev/null local sed --verbose
+		grep local && "$@" cd x=1 | && then x=1 export
+grep ${HOME} && 2>/dev/null $(pwd) cd local printf -eu --verbose
+	then sed awk grep awk 2>/dev/null --verbose
+		echo test then && -eu /usr/bin readonly local && test -eu /usr/bin
+printf | -eu "$1" awk $(pwd) --verbose 'quoted text' cd $(pwd)
+${HOME} "$1" "$1" ${HOME} test "$@" /usr/bin then
+	${HOME} readonly --verbose | local readonly awk test echo |
+	| readonly "$@" -eu 'quoted text' $(pwd) awk -eu
+		local $(pwd) 'quoted text' cd awk done export $(pwd)
+	2>/dev/null then readonly
+		grep | test -eu -eu local cd then "$1" export "$@" 'quoted text'
+	readonly readonly sed sed /usr/bin $(pwd)
+		| done "$1" readonly echo
+	local x=1 "$1" awk awk $(pwd) $(pwd) /usr/bin
+	"$1" export --verbose 2>/dev/null "$@" test
+"$1" test then && 'quoted text' $(pwd) readonly then -eu $(pwd)
+then x=1 then printf grep ${HOME}
+| x=1 x=1 printf | printf
+		local | readonly sed "$1" test
+		$(pwd) then awk ${HOME} awk --verbose grep cd awk readonly
+"$@" /usr/bin done --verbose "$1" "$@" "$@" && 2>/dev/null | 2>/dev/null
+	then done sed test then && ${HOME}
+awk local local ${HOME} then cd ${HOME} x=1 --verbose ${HOME}
+then -eu awk local /usr/bin export &&
+		test test | "$1" local
+--verbose then /usr/bin
+	printf x=1 /usr/bin export local export && x=1 'quoted text' sed
+		then x=1 printf test /usr/bin "$1" "$1"
+test 2>/dev/null printf
+printf then && $(pwd) readonly printf x=1 /usr/bin
+	2>/dev/null x=1 | "$@" cd echo sed /usr/bin readonly printf then
+$(pwd) && "$1" 'quoted text' echo
+"$1" --verbose local 2>/dev/null
+	| cd && ${HOME} 2>/dev/null
+	local test ${HOME} cd grep ${HOME} "$@" awk export grep "$1"
+	/usr/bin -eu 'quoted text' awk readonly
+	--verbose grep echo then sed grep echo done 'quoted text' done then
+local && /usr/bin then local && /usr/bin export printf readonly echo
+awk done test -eu -eu /usr/bin sed
+		x=1 readonly ${HOME} &&
+awk && cd local cd --verbose ${HOME} cd 2>/dev/null
+		done awk -eu | | test && --verbose /usr/bin test printf readonly printf
+		awk x=1 echo done grep x=1 awk awk /usr/bin export
+then /usr/bin export x=1 'quoted text' ${HOME} ${HOME} -eu && awk cd
+	2>/dev/null local | export x=1 done ${HOME} test && 'quoted text'
+		echo then echo export 2>/dev/null
+	2>/dev/null sed awk then echo $(pwd)
+		${HOME} awk export x=1 $(pwd) export "$1" readonly
+/usr/bin "$1" x=1 /usr/bin printf then | done "$@" ${HOME} ${HOME}
+	then && awk grep done "$1" 2>/dev/null 2>/dev/null
+	cd | grep | /usr/bin done local readonly export && /usr/bin awk $(pwd) /usr/bin
+		test $(pwd) /usr/bin cd then echo | | awk export --verbose export
+"$@" export "$@" && then export export printf --verbose
+	grep $(pwd) ${HOME} ${HOME} local /usr/bin | grep ${HOME} | readonly test
+	x=1 -eu awk printf grep local test echo grep then echo x=1 x=1 grep local | printf
+		x=1 /usr/bin test local grep | && printf "$1" ${HOME}
+		--verbose -eu -eu test grep printf "$1" then /usr/bin
+		-eu 2>/dev/null 2>/dev/null readonly /usr/bin 2>/dev/null && --verbose
+	printf "$1" && cd done cd ${HOME} cd "$1"
+	cd 2>/dev/null /usr/bin export 'quoted text' cd export local ${HOME}
+	"$1" local $(pwd) grep sed 2>/dev/null /usr/bin x=1 awk x=1 && cd
+	-eu done && 'quoted text' x=1 export sed printf "$1" awk
+readonly echo cd readonly |
+	export && sed test then --verbose done echo "$1" "$@" echo --verbose ${HOME}
+	x=1 "$1" local ${HOME} printf done awk printf 2>/dev/null
+		readonly sed readonly --verbose --verbose
+		then printf test sed sed
+		printf printf printf && --verbose
+		'quoted text' --verbose awk grep
+		"$@" "$@" 2>/dev/null sed readonly cd sed --verbose then printf test -eu
+	awk grep awk local then sed export -eu grep printf && local 'quoted text'
+		grep awk echo local "$@" $(pwd) "$@" x=1 /usr/bin x=1
+readonly "$1" export --verbose --verbose export done local export sed test test
+	echo --verbose $(pwd) readonly | && readonly then $(pwd) 'quoted text'
+readonly done readonly -eu export
+	local 2>/dev/null $(pwd) export
+		&& cd local && "$@" echo grep awk ${HOME}
+sed printf "$@" local -eu echo -eu --verbose then && printf
+--verbose sed 'quoted text' readonly 'quoted text' sed /usr/bin sed then &&
+x=1 2>/dev/null -eu grep && done local sed cd cd cd x=1 export local 'quoted text'
+	2>/dev/null then echo -eu printf test -eu
+$(pwd) && --verbose sed -eu -eu
+readonly cd x=1 'quoted text' printf /usr/bin /usr/bin local then
+		grep awk grep printf local
+printf --verbose awk echo ${HOME} -eu $(pwd) ${HOME} awk 2>/dev/null sed
+/usr/bin /usr/bin printf cd done
+	local local x=1 local
+		cd echo local export cd readonly grep | x=1 then
+		/usr/bin && --verbose $(pwd) && cd ${HOME} ${HOME} ${HOME} $(pwd) then test
+done ${HOME} sed then /usr/bin 2>/dev/null "$1" $(pwd) readonly export
+		--verbose local ${HOME} $(pwd) cd 'quoted text' && printf x=1 && "$1" "$@"
+		readonly then grep export --verbose $(pwd) 2>/dev/null readonly done
+	--verbose "$@" then readonly --verbose 'quoted text' 'quoted text'
+cd /usr/bin grep done --verbose cd
+	local "$@" grep printf printf export
+		cd grep test grep 'quoted text' echo "$1"
+echo local ${HOME} && "$@" | export
+x=1 && ${HOME} awk ${HOME} grep $(pwd) && | 2>/dev/null 'quoted text'
+		--verbose export sed ${HOME}
+		-eu -eu && $(pwd) printf -eu test readonly local test | sed --verbose 'quoted text'
+| test "$@" readonly done x=1 awk && echo $(pwd) && -eu test | $(pwd)
+		sed ${HOME} "$1" 2>/dev/null local x=1 | then | ${HOME} awk 'quoted text' $(pwd)
+	done "$@" local export sed local 'quoted text' && echo echo
+'quoted text' 2>/dev/null readonly 2>/dev/null printf
+	$(pwd) awk -eu x=1 -eu export cd done "$@" cd test grep x=1 $(pwd) "$1" awk readonly
+'quoted text' -eu | cd --verbose $(pwd) -eu local -eu 2>/dev/null
+	--verbose /usr/bin /usr/bin echo sed test x=1 grep test grep
+		| "$1" /usr/bin then awk | awk test
+sed /usr/bin done readonly 2>/dev/null local --verbose -eu ${HOME} -eu
+x=1 export then 2>/dev/null then local test 'quoted text' printf sed done sed
+	test | cd "$1" | test echo local $(pwd) awk printf /usr/bin ${HOME}
+	sed done export --verbose ${HOME}
+	then awk "$1" awk $(pwd) done
+"$@" $(pwd) cd export && test "$1" sed echo /usr/bin | sed
+	sed -eu "$1" --verbose "$@" then 'quoted text' $(pwd)
+export --verbose ${HOME} sed echo /usr/bin 2>/dev/null
+		test local && test echo ${HOME} then export --verbose grep
+		local /usr/bin done readonly 2>/dev/null test
+	done -eu readonly echo done --verbose -eu done
+		local echo sed then $(pwd) local ${HOME} "$@" /usr/bin done then echo then
+	"$1" test -eu /usr/bin "$1" x=1 "$1" && grep local
+&& test | "$@" export echo -eu
+	2>/dev/null ${HOME} x=1 done --verbose export
+		awk readonly grep readonly echo printf
+		"$@" sed export && readonly $(pwd) "$1" test --verbose test done ${HOME} -eu -eu
+	readonly --verbose echo local 2>/dev/null "$@" "$1" readonly
+--verbose cd "$1" cd ${HOME} readonly
+#include c15.sh
+		grep x=1 test printf cd test "$1" 2>/dev/null then
+	$(pwd) done then "$1" test && then "$@" done cd test local --verbose ${HOME}
+		done $(pwd) "$1" then sed --verbose echo $(pwd)
+| x=1 readonly x=1 done ${HOME} 'quoted text' "$@" echo grep sed /usr/bin
+		cd "$@" 'quoted text' readonly | local local done ${HOME} test
+"$1" test sed export 2>/dev/null /usr/bin -eu /usr/bin done $(pwd)
+	"$1" sed x=1 then -eu /usr/bin && "$1" --verbose
+echo ${HOME} printf sed /usr/bin x=1 then echo ${HOME}
+		then done printf "$@" export grep test ${HOME} "$@" 2>/dev/null local $(pwd) &&
+cd sed | local | echo done readonly grep local "$1"
+		echo 2>/dev/null -eu local echo
+	'quoted text' sed --verbose sed
+| cd ${HOME} --verbose | $(pwd) grep grep then export
+		'quoted text' --verbose
+-eu awk awk "$1" cd local done cd -eu printf local sed && ${HOME}
+		done --verbose awk then local && $(pwd) cd local | grep local x=1 --verbose
+		&& $(pwd) echo awk cd grep "$1" printf grep "$1"
+	test ${HOME} ${HOME} $(pwd) sed x=1 echo grep x=1 done
+2>/dev/null done readonly "$1"
+	export local "$1" echo done
+	/usr/bin awk echo && done /usr/bin 2>/dev/null
+		| local local then x=1 x=1 grep "$@" 2>/dev/null $(pwd) echo then ${HOME}
+		test 'quoted text' ${HOME} sed "$@" /usr/bin $(pwd) 'quoted text'
+	"$@" 2>/dev/null $(pwd) 2>/dev/null | grep --verbose printf
+	--verbose /usr/bin --verbose /usr/bin printf printf done cd echo awk export echo
+echo sed --verbose 2>/dev/null | 'quoted text'
+		${HOME} printf readonly cd printf
+	readonly -eu grep cd
+		awk test printf "$@" && cd awk -eu 2>/dev/null | "$1" -eu "$@"
+	| 2>/dev/null /usr/bin echo readonly x=1
+		export readonly export | 2>/dev/null --verbose $(pwd) /usr/bin 'quoted text'
+	-eu 2>/dev/null ${HOME} $(pwd) local readonly x=1 readonly
+		awk test | readonly "$@" readonly echo printf ${HOME} local && --verbose sed
+		'quoted text' x=1 done done 'quoted text'
+	x=1 ${HOME} | then then
+		printf /usr/bin x=1 awk export
+| done printf $(pwd) $(pwd) test printf
+		&& awk test then readonly $(pwd) --verbose $(pwd) done cd local
+	done "$@" --verbose cd echo "$1"
+	sed --verbose | "$1" x=1 | $(pwd)
+echo done done readonly then --verbose local "$1" awk "$@" test then
+		--verbose grep export
+		"$@" "$1" 2>/dev/null --verbose x=1 $(pwd) readonly --verbose
+		x=1 && then sed "$1"
+		echo local then ${HOME} test test 2>/dev/null grep cd then sed test test
+/usr/bin grep cd local grep local printf && test -eu "$1" cd $(pwd) | &&
+		$(pwd) 'quoted text' "$1" local sed local
+sed sed "$@" export awk printf test "$@" test "$@" x=1 printf | printf grep
+		cd cd grep x=1 && cd awk export sed export sed awk "$1" then export
+	grep echo 2>/dev/null --verbose "$1" --verbose 2>/dev/null
+"$@" /usr/bin x=1 export awk echo readonly printf "$1" 2>/dev/null then
+		awk -eu $(pwd) /usr/bin x=1 $(pwd)
+		local /usr/bin sed | x=1 /usr/bin x=1 grep test
+		'quoted text' --verbose done --verbose
+	"$1" ${HOME} ${HOME} 2>/dev/null -eu readonly
+sed x=1 x=1 cd awk awk grep grep readonly export awk local test x=1 grep
+		echo awk $(pwd) cd 'quoted text' && /usr/bin then "$1" local readonly
+		done then $(pwd) && -eu "$1" cd && /usr/bin
+/usr/bin ${HOME} echo 'quoted text' -eu --verbose
+		readonly cd done && x=1 'quoted text' then "$1"
+grep grep echo grep test 'quoted text'
+		done "$@" --verbose then done grep $(pwd) "$1" ${HOME} $(pwd) readonly test
+	-eu grep 2>/dev/null then awk 'quoted text'
+cd done echo export sed /usr/bin sed --verbose "$1" "$@" local 'quoted text' sed
+	test printf sed --verbose cd "$1" export --verbose && then && 2>/dev/null && grep
+printf $(pwd) --verbose
+	2>/dev/null then ${HOME} 2>/dev/null "$@" | cd
+		2>/dev/null test local --verbose local awk export
+export local x=1 && "$@"
+		readonly x=1 then && 'quoted text' cd sed echo test sed sed
+		x=1 grep -eu ${HOME} | 2>/dev/null echo awk "$1" x=1 readonly test "$@" printf
+	awk cd --verbose printf x=1 --verbose
+"$@" --verbose ${HOME} awk local ${HOME} |
+export 2>/dev/null then $(pwd) readonly
+	readonly printf local readonly /usr/bin local | ${HOME} "$@"
+		readonly awk test --verbose test /usr/bin ${HOME}
+echo -eu "$@" printf $(pwd) $(pwd) 'quoted text' grep printf echo ${HOME} then
+	--verbose local 'quoted text' /usr/bin echo done "$@" test test 'quoted text'
+	done test && cd awk --verbose --verbose sed
+	/usr/bin $(pwd) "$@" && awk 2>/dev/null 'quoted text' cd $(pwd)
+then done echo 'quoted text' done readonly test $(pwd) "$@"
+readonly awk readonly | 2>/dev/null
+		-eu echo cd $(pwd) ${HOME} cd cd done then readonly "$1" cd then done
+		"$@" 2>/dev/null echo done 'quoted text'
+		"$@" grep /usr/bin export readonly test
+		$(pwd) "$1" sed $(pwd) --verbose then grep then awk 'quoted text'
+local printf export && cd "$1" grep then -eu export
+	2>/dev/null 'quoted text' "$1" export | awk x=1 x=1 test $(pwd)
+		local export | awk "$@" local --verbose && -eu readonly | 'quoted text' export
+${HOME} cd "$1" sed -eu "$@" cd /usr/bin done
+		"$@" printf 'quoted text'
+		x=1 /usr/bin printf && awk /usr/bin
+done readonly printf cd ${HOME} | readonly x=1
+		x=1 test then cd --verbose done x=1 awk then --verbose sed export echo sed
+		then test | ${HOME} printf cd echo grep x=1 && then
+export && "$@" readonly sed | 'quoted text' printf cd x=1
+	$(pwd) 2>/dev/null local
+-eu readonly then /usr/bin --verbose "$1" awk $(pwd)
+	done /usr/bin --verbose grep -eu && cd cd cd printf x=1 readonly x=1 ${HOME} cd
+	echo printf readonly done export grep done
+sed --verbose -eu done 2>/dev/null cd grep
+	export echo awk awk awk local "$1" && 2>/dev/null readonly sed "$1" cd --verbose
+	&& export printf awk readonly echo printf $(pwd) readonly --verbose then 'quoted text'
+	readonly grep /usr/bin "$@" echo ${HOME} ${HOME} local then "$1" then test done
+done readonly printf --verbose echo 'quoted text' cd x=1 --verbose
+		-eu | -eu test --verbose --verbose printf /usr/bin && awk test | done then
+		printf --verbose -eu readonly
+-eu cd test echo 'quoted text' 2>/dev/null
+	'quoted text' sed x=1 local "$1" "$@" echo && echo "$@" readonly
+		--verbose export "$1" x=1 && then "$1" awk readonly export
+		sed --verbose awk echo | grep x=1 echo /usr/bin -eu readonly 2>/dev/null
+	${HOME} test "$1" local /usr/bin cd echo export ${HOME} $(pwd) readonly test
+printf grep -eu then x=1 readonly done echo done 2>/dev/null done awk readonly
+	readonly awk -eu export -eu cd echo 'quoted text' -eu test && sed
+		| 2>/dev/null grep /usr/bin
+&& printf test x=1 -eu awk 2>/dev/null awk ${HOME} $(pwd) local awk sed printf
+		grep /usr/bin done readonly export
+readonly $(pwd) $(pwd)
+awk $(pwd) printf && | done -eu --verbose
+x=1 done local readonly export
+		x=1 "$@" grep $(pwd) local 2>/dev/null readonly
+2>/dev/null "$@" | export grep sed
+	'quoted text' cd grep && export done
+		&& | test readonly grep 'quoted text' x=1
+cd 'quoted text' "$1" --verbose
+		/usr/bin --verbose --verbose printf -eu printf
+		$(pwd) -eu 2>/dev/null done x=1 readonly && test cd cd cd sed local export
+		${HOME} $(pwd) 'quoted text'
+"$@" --verbose 2>/dev/null cd cd --verbose
+	printf /usr/bin -eu ${HOME} --verbose readonly -eu readonly
+		test "$1" x=1 readonly $(pwd) --verbose
+	${HOME} -eu grep cd local sed $(pwd) "$1" local awk ${HOME} readonly
+$(pwd) printf printf export awk cd awk && echo | printf awk /usr/bin
+echo echo awk "$1" -eu readonly --verbose
+	echo test readonly sed then /usr/bin 2>/dev/null export cd ${HOME} --verbose
+	awk local echo $(pwd) -eu && export 2>/dev/null test --verbose
+	echo --verbose | "$@" done && && awk readonly "$1" && x=1 echo x=1 /usr/bin
+	cd --verbose awk | --verbose readonly
+-eu local readonly cd $(pwd) grep
+		sed sed readonly /usr/bin cd --verbose
+	echo 'quoted text' echo --verbose awk 'quoted text' test 2>/dev/null sed
+	echo 'quoted text' -eu then export awk then | echo
+	grep $(pwd) local /usr/bin
+		$(pwd) ${HOME} grep -eu test -eu done "$@" "$1" --verbose
+	test 'quoted text' ${HOME} awk | printf then sed sed done
+$(pwd) $(pwd) test local grep /usr/bin local then "$1" | export then "$1"
+		x=1 /usr/bin | test done sed 2>/dev/null
+		"$1" awk 'quoted text' then awk readonly x=1 | sed 'quoted text'
+$(pwd) | | echo printf done local | readonly readonly done --verbose done sed
+	grep cd && done local /usr/bin /usr/bin | 2>/dev/null awk test
+	test then "$1" test x=1
+	&& export /usr/bin local echo printf $(pwd) grep local sed "$@"
+awk printf 'quoted text' awk ${HOME}
+	$(pwd) | --verbose x=1 /usr/bin 2>/dev/null
+	readonly 2>/dev/null 'quoted text' printf | --verbose printf test 'quoted text'
+		cd done test /usr/bin && --verbose cd test 2>/dev/null readonly
+		local | && "$1" --verbose x=1 grep 'quoted text' readonly | readonly local -eu
+		readonly -eu cd grep /usr/bin x=1 /usr/bin printf
+	x=1 then cd readonly local "$@" "$1" 'quoted text'
+	readonly awk printf "$@" "$@"
+	/usr/bin local grep awk x=1 echo $(pwd) $(pwd) x=1 "$@" 'quoted text'
+2>/dev/null --verbose
+	done printf sed x=1 sed awk cd /usr/bin --verbose --verbose
+cd $(pwd) $(pwd) done sed sed ${HOME} ${HOME} echo 2>/dev/null
+	grep export echo $(pwd) local "$1" echo --verbose then $(pwd) local | sed local
+local /usr/bin local ${HOME} echo &&
+		'quoted text' export "$@" echo 'quoted text' cd "$1"
+		done $(pwd) sed "$@" |
+$(pwd) "$1" /usr/bin echo 2>/dev/null
+		grep local test then readonly $(pwd)
+	$(pwd) $(pwd) /usr/bin printf readonly ${HOME} done done | -eu "$1"
+	grep done -eu readonly 'quoted text'
+-eu local 2>/dev/null test sed && "$1"
+		--verbose local && 'quoted text' export /usr/bin
+then "$1" export readonly ${HOME} | && grep test --verbose ${HOME} grep
+| | 2>/dev/null && then
+	awk grep $(pwd) readonly local $(pwd) $(pwd)
+	/usr/bin readonly && test
+readonly cd sed then && local /usr/bin readonly test sed --verbose sed $(pwd)
+		/usr/bin cd local then awk awk readonly
+		${HOME} 'quoted text' x=1 then | awk sed echo
+		readonly done && -eu | echo /usr/bin done && ${HOME} export
+-eu sed --verbose -eu 2>/dev/null grep sed /usr/bin && done echo then then cd readonly
+		sed -eu /usr/bin awk /usr/bin echo cd awk cd
+2>/dev/null x=1 then /usr/bin echo
+		"$@" /usr/bin -eu x=1 && echo export readonly x=1 ${HOME} $(pwd) grep "$@"
+		cd 2>/dev/null grep "$1" x=1 done readonly
+	sed local x=1 printf x=1 2>/dev/null printf
+	local cd ${HOME} --verbose echo x=1
+	--verbose && "$@" cd done grep
+	/usr/bin local 'quoted text' sed 'quoted text' test && "$@" && "$1" x=1
+	| /usr/bin -eu readonly export ${HOME} -eu
+		sed ${HOME} awk ${HOME}
+	printf /usr/bin $(pwd) 'quoted text' | export /usr/bin awk
+		x=1 "$@" grep grep readonly /usr/bin printf -eu x=1 readonly
+	2>/dev/null cd 'quoted text' test
+	--verbose printf sed && && printf cd grep 'quoted text' && readonly
+	x=1 --verbose sed awk /usr/bin cd
+	test 'quoted text' 2>/dev/null export readonly --verbose cd
+	"$1" 'quoted text' 2>/dev/null $(pwd) local 'quoted text' cd
+		2>/dev/null -eu /usr/bin then /usr/bin
+echo then | | 2>/dev/null --verbose ${HOME} grep 2>/dev/null
+	echo printf then 2>/dev/null echo local ${HOME} &&
+		grep x=1 test awk done -eu --verbose
+	cd /usr/bin x=1 | cd test cd "$@" printf printf grep
+		${HOME} grep readonly readonly "$@" cd --verbose 'quoted text' 2>/dev/null $(pwd)
+		/usr/bin local test done done cd
+--verbose done --verbose 2>/dev/null echo echo | test then
+&& "$@" cd | x=1 echo /usr/bin cd --verbose
+		"$1" readonly x=1 grep
+		$(pwd) done "$1" cd done 2>/dev/null
+		test grep done then then sed echo -eu --verbose
+awk local cd then --verbose echo done
+	readonly "$@" done grep local export readonly
+/usr/bin | local x=1 /usr/bin readonly echo $(pwd) "$1" echo printf
+	${HOME} export grep $(pwd) awk sed cd "$@" awk "$@"
+		'quoted text' 2>/dev/null readonly "$1" printf -eu ${HOME} cd "$1"
+	&& then x=1 test sed --verbose
+	"$@" export awk | | echo "$@" readonly readonly ${HOME} /usr/bin 2>/dev/null
+		${HOME} echo && -eu -eu awk $(pwd) echo grep
+then grep --verbose awk test local ${HOME} "$@" --verbose
+		&& ${HOME} grep export $(pwd) then | export echo
+	readonly "$@" awk "$@" export -eu ${HOME} done export awk echo --verbose
+	--verbose 'quoted text' readonly then local --verbose /usr/bin test "$@"
+then test -eu printf test done /usr/bin local x=1 ${HOME} --verbose &&
+"$1" awk $(pwd) x=1 grep $(pwd) then cd $(pwd) done 'quoted text'
+	done "$@" --verbose x=1 sed readonly
+&& then export /usr/bin /usr/bin printf /usr/bin 2>/dev/null test test export export
+'quoted text' test /usr/bin
+	awk readonly printf ${HOME} "$1" "$@" printf $(pwd) | echo readonly
+		-eu echo "$@" 2>/dev/null
+		export echo "$@" | -eu 'quoted text' then | "$@" awk $(pwd) "$@" 'quoted text'
+grep 'quoted text' --verbose
+--verbose -eu then local --verbose then done readonly echo
+		cd | "$@" && printf done sed awk 2>/dev/null
+		x=1 export ${HOME} echo grep "$1" local -eu done printf $(pwd)
+done x=1 "$@" ${HOME} local /usr/bin
+awk done x=1 awk x=1 x=1 $(pwd) awk grep
+	export x=1 cd ${HOME} /usr/bin grep echo then echo
+	then /usr/bin readonly readonly export 2>/dev/null done | then printf $(pwd)
+2>/dev/null --verbose -eu cd
+		--verbose /usr/bin x=1 awk "$@" --verbose then local --verbose then
+	readonly test && | printf local "$1" "$@" && -eu awk -eu | "$1" done cd | readonly
+readonly grep then && echo $(pwd)
+		printf sed local x=1 awk /usr/bin cd -eu x=1 | --verbose then x=1 x=1 export --verbose
+		then "$1" --verbose /usr/bin ${HOME}
+echo x=1 "$@" 'quoted text' -eu export -eu cd printf ${HOME}
+		done x=1 'quoted text' done printf test | export ${HOME} grep ${HOME} printf
+		local test $(pwd) readonly "$@" printf
+"$@" export cd x=1 echo -eu done
+		--verbose "$@" 2>/dev/null done "$@" done /usr/bin local /usr/bin
+/usr/bin awk x=1 readonly local --verbose
+echo local "$@" printf echo echo --verbose done $(pwd) echo
+		${HOME} grep "$1" cd printf done export /usr/bin
+	awk | x=1 --verbose readonly /usr/bin then then ${HOME} $(pwd) then then 2>/dev/null
+-eu "$1" | printf --verbose test cd x=1 local x=1
+awk "$1" local test "$1" printf local test sed test local 2>/dev/null local
+	grep echo -eu 'quoted text' "$@" sed --verbose
+		"$@" export "$@" x=1 -eu
+	"$1" local readonly local -eu && sed -eu grep
+sed sed "$@" ${HOME} cd x=1 | then done then | x=1 done sed readonly
+local x=1 /usr/bin && echo test /usr/bin
+	"$@" test 'quoted text' local local
+		grep readonly then then cd "$1" --verbose
+		"$@" then $(pwd) && done -eu printf
+	sed grep --verbose printf 'quoted text' sed export "$@" 'quoted text'
+		readonly printf then printf sed && | cd sed cd ${HOME}
+local local export 'quoted text' | local 'quoted text'
+awk 2>/dev/null ${HOME} done --verbose test echo "$1" "$1" test local
+echo x=1 2>/dev/null -eu then local
+	done "$1" done export local && && cd -eu echo test /usr/bin $(pwd)
+		sed 2>/dev/null printf awk
+'quoted text' 'quoted text' echo 2>/dev/null ${HOME} cd cd export done sed grep
+readonly echo cd "$@" echo $(pwd) /usr/bin done ${HOME} sed 'quoted text'
+	$(pwd) grep /usr/bin test printf && $(pwd) cd $(pwd)
+	readonly grep cd "$@" then test --verbose grep local
+	export "$@" x=1 --verbose test "$@" grep "$@" 'quoted text' "$@" ${HOME} cd
+	2>/dev/null printf && readonly --verbose -eu
+'quoted text' grep --verbose printf then grep
+done "$1" printf /usr/bin --verbose --verbose
+	| && then awk --verbose | && 2>/dev/null
+	sed then ${HOME} done -eu local export ${HOME}
+-eu test 'quoted text' export
+printf /usr/bin echo $(pwd) readonly echo echo printf test /usr/bin ${HOME} echo
+		$(pwd) echo readonly --verbose 2>/dev/null then done --verbose "$1" sed $(pwd)
+/usr/bin local 2>/dev/null grep grep
+		local sed cd sed "$@" $(pwd) 2>/dev/null "$@" export 'quoted text' -eu
+		"$1" --verbose then export "$1" local "$@"
+	readonly ${HOME} export export -eu printf ${HOME}
+	--verbose readonly awk export --verbose
+		test 2>/dev/null "$@" then "$1" sed ${HOME} --verbose "$@"
+x=1 "$@" $(pwd) readonly sed 2>/dev/null
+grep 2>/dev/null ${HOME} "$@" echo
+		| readonly --verbose test && grep ${HOME} ${HOME} /usr/bin $(pwd) "$1" grep
+$(pwd) -eu "$@" ${HOME} awk 'quoted text' $(pwd) --verbose
+x=1 'quoted text' ${HOME} ${HOME} /usr/bin
+		then grep | grep && /usr/bin printf "$@" printf cd ${HOME} ${HOME}
+2>/dev/null && 'quoted text' grep grep "$@" "$1"
+	x=1 printf | done grep readonly $(pwd) /usr/bin awk 'quoted text' test grep
+$(pwd) grep 2>/dev/null export $(pwd) "$@" "$1" printf 'quoted text' export ${HOME}
+"$1" 2>/dev/null -eu --verbose export
+		'quoted text' "$1" local $(pwd) awk ${HOME} awk 2>/dev/null awk
+		/usr/bin echo readonly echo $(pwd) then cd --verbose
+echo && "$1" "$@" awk --verbose awk /usr/bin $(pwd) --verbose
+$(pwd) done -eu cd && test local -eu && /usr/bin
+		'quoted text' printf -eu && "$@"
+	local local export 2>/dev/null done --verbose cd echo
+		export then && $(pwd) printf printf && then && local 'quoted text' export readonly
+	--verbose "$@" | -eu ${HOME}
+		--verbose readonly $(pwd) printf export $(pwd) readonly 2>/dev/null export ${HOME}
+export --verbose echo "$@" 2>/dev/null
+sed done "$@" printf cd 'quoted text'
+		local printf done x=1 -eu /usr/bin --verbose
+-eu ${HOME} local "$@" readonly cd /usr/bin awk -eu /usr/bin | cd $(pwd)
+		${HOME} echo grep grep readonly
+		--verbose local then cd then "$1" --verbose "$@"
+	echo 'quoted text' /usr/bin
+grep 2>/dev/null -eu $(pwd)
+		&& --verbose grep readonly export then --verbose printf
+	2>/dev/null done echo readonly x=1 readonly grep
+awk && ${HOME} && export test | -eu | readonly
+		--verbose then echo -eu grep export
+		"$1" -eu 'quoted text' done $(pwd) && then /usr/bin
+	${HOME} ${HOME} test grep grep && 2>/dev/null
+		grep && x=1 ${HOME} | awk --verbose 'quoted text' && grep && done "$@"
+		echo done done printf | $(pwd) readonly "$1" local
+	printf echo readonly 'quoted text' test grep $(pwd) | -eu x=1
+/usr/bin && $(pwd) printf readonly "$1" sed echo "$@" local 2>/dev/null
+	export 2>/dev/null /usr/bin --verbose 2>/dev/null local -eu "$@" sed awk
+	"$@" local 'quoted text' grep local printf
+		${HOME} 2>/dev/null test sed $(pwd) "$@" 'quoted text'
+	cd export echo local "$@" ${HOME} then 'quoted text' /usr/bin
+sed "$1" 2>/dev/null 'quoted text' 2>/dev/null "$@" echo
+		"$@" $(pwd) grep ${HOME} grep 2>/dev/null ${HOME} x=1
+	$(pwd) 'quoted text' cd export $(pwd) "$@" /usr/bin | ${HOME}
+	2>/dev/null | 2>/dev/null local
+	grep "$1" local grep local local ${HOME}
+	test $(pwd) printf | 2>/dev/null
+	${HOME} then /usr/bin
+${HOME} printf --verbose -eu 2>/dev/null -eu test then cd echo export
+		cd grep && awk -eu 2>/dev/null sed /usr/bin echo && /usr/bin -eu sed awk awk
+	x=1 test grep 2>/dev/null 'quoted text' -eu sed local x=1 test "$1"
+		printf x=1 2>/dev/null then ${HOME} grep export | "$@" grep -eu printf
+		2>/dev/null sed grep done 2>/dev/null local export echo test 2>/dev/null "$@"
+		${HOME} sed echo x=1 sed local
+export grep 2>/dev/null "$@" --verbose x=1 ${HOME} ${HOME} x=1 'quoted text' export
+	${HOME} done done awk
+	readonly 'quoted text' grep awk export readonly && cd
+		x=1 -eu done /usr/bin cd awk
+	sed done | -eu done --verbose 'quoted text' /usr/bin cd /usr/bin
+	&& ${HOME} done x=1 2>/dev/null
+local awk $(pwd) x=1 | $(pwd)
+grep x=1 echo then local printf /usr/bin
+		$(pwd) "$@" /usr/bin sed grep local then grep printf local grep && $(pwd) 'quoted text'
+	printf 2>/dev/null --verbose -eu readonly cd local test grep ${HOME} sed
+		then then echo printf cd -eu awk local test awk cd && cd local readonly x=1 printf
+	export test awk export cd
+		2>/dev/null $(pwd) printf readonly
+readonly 2>/dev/null "$1"
+	"$1" 2>/dev/null done cd "$1" "$1"
+		sed 2>/dev/null cd -eu ${HOME} export $(pwd) awk echo
+	&& && printf --verbose
+	grep -eu done local 2>/dev/null done --verbose echo | x=1 -eu sed local /usr/bin
+		local awk x=1 && "$@" "$@" echo export "$@" "$1" awk
+		-eu local echo cd --verbose 2>/dev/null $(pwd) readonly $(pwd) readonly
+echo local && $(pwd) ${HOME} awk printf ${HOME} test export
+		$(pwd) then "$1" grep done printf /usr/bin | && 2>/dev/null
+		echo --verbose test grep && cd && /usr/bin 2>/dev/null
+		"$@" done ${HOME} -eu echo awk 'quoted text' test sed x=1 export grep && readonly
+	printf echo then awk 2>/dev/null 'quoted text' grep export printf
+	x=1 grep /usr/bin sed export -eu ${HOME}
+	echo echo sed done $(pwd) 'quoted text'
+	cd ${HOME} | awk cd 'quoted text' printf x=1 | then
+echo then echo then && ${HOME} echo test
+awk export echo printf printf | export printf
+		awk ${HOME} then sed $(pwd)
+	| awk 'quoted text' | | x=1 ${HOME} -eu "$1" printf |
+		$(pwd) 'quoted text' grep local awk | "$@" 'quoted text'
+		printf "$1" "$@" grep sed 2>/dev/null 2>/dev/null 'quoted text'
+x=1 "$@" && x=1 cd /usr/bin "$1" /usr/bin test test && /usr/bin x=1
+		cd readonly export 'quoted text' --verbose && && local
+/usr/bin cd x=1 then echo cd && readonly && x=1 --verbose
+		&& 2>/dev/null -eu grep cd local local
+		awk $(pwd) /usr/bin 2>/dev/null
+		test ${HOME} && $(pwd) export grep local "$1" $(pwd) &&
+-eu awk then test readonly ${HOME} | && local
+		/usr/bin 'quoted text' 'quoted text'
+		test 'quoted text' 2>/dev/null ${HOME} test done awk 2>/dev/null
+		-eu $(pwd) $(pwd) export
+		&& && then awk test "$@" cd --verbose
+	test "$@" echo grep grep | done | cd --verbose
+grep --verbose 'quoted text' --verbose awk
+		printf --verbose 2>/dev/null "$@" "$@" printf $(pwd) 2>/dev/null
+		cd cd --verbose local export -eu -eu "$1" x=1 x=1 done export | awk grep export
+		echo | sed --verbose sed awk
+		local test echo 2>/dev/null readonly x=1 'quoted text' --verbose done
+		&& test cd readonly && "$1"
+/usr/bin cd $(pwd) grep readonly test "$1"
+done then ${HOME} printf /usr/bin "$1" ${HOME} local "$@" echo grep test
+		awk ${HOME} $(pwd) cd done ${HOME} 'quoted text'
+		grep grep grep done -eu /usr/bin x=1 "$@" "$1" then then 'quoted text'
+		$(pwd) 2>/dev/null | awk local ${HOME} && then grep sed x=1 sed
+	$(pwd) awk export "$1" export | done /usr/bin "$@" sed | test export
+2>/dev/null "$@" test 'quoted text' cd printf grep cd 2>/dev/null
+"$1" -eu local $(pwd) done | $(pwd) local "$1" "$@" done
+echo "$1" ${HOME} "$@" ${HOME} echo $(pwd) test "$1" done readonly
+--verbose x=1 then "$1" /usr/bin
+	$(pwd) readonly /usr/bin readonly printf /usr/bin "$@" ${HOME} awk local
+	"$@" 2>/dev/null done -eu --verbose "$@"
+	"$1" "$1" cd printf --verbose
+cd printf --verbose readonly "$@" sed export export printf
+	--verbose --verbose $(pwd) cd local export 2>/dev/null
+	-eu cd 2>/dev/null ${HOME}
+		--verbose | "$1" 2>/dev/null
+	"$1" test cd ${HOME} test awk sed grep ${HOME} $(pwd)
+	| 'quoted text' echo -eu printf -eu x=1 readonly
+x=1 done | test 'quoted text' x=1 export
+		/usr/bin && test --verbose /usr/bin then
+	export && 2>/dev/null ${HOME} x=1 grep x=1 | 2>/dev/null
+-eu test "$1" export /usr/bin
+printf -eu x=1 grep awk grep echo cd --verbose awk $(pwd)
+	awk $(pwd) /usr/bin | $(pwd) --verbose awk "$1" cd | readonly echo
+"$1" | x=1 local test test cd awk readonly "$@" readonly
+	x=1 export "$1" awk test test awk && && echo "$@" | done
+${HOME} "$@" "$@" /usr/bin
+-eu 'quoted text' && awk 2>/dev/null then && && readonly test
+		printf done readonly
+export 'quoted text' grep /usr/bin && echo
+	$(pwd) local done "$@" /usr/bin printf readonly | 'quoted text'
+printf /usr/bin awk ${HOME} "$1" 2>/dev/null "$@" printf
+	awk then echo readonly 2>/dev/null /usr/bin echo
+	echo cd $(pwd) && readonly echo | 2>/dev/null sed awk export export
+		'quoted text' $(pwd) done | && --verbose
+		awk test export done sed
+	&& echo test -eu | sed grep
+-eu export "$1" done awk --verbose
+		grep 2>/dev/null "$1" | -eu "$1" "$@" --verbose sed /usr/bin echo "$1" 'quoted text'
+printf | readonly /usr/bin 2>/dev/null local sed then sed "$@"
+		/usr/bin printf then -eu x=1 awk "$1" 2>/dev/null cd done $(pwd)
+2>/dev/null 'quoted text'
+then test then export export x=1 'quoted text'
+	-eu then then -eu | cd && export $(pwd)
+	2>/dev/null x=1 "$1" ${HOME} $(pwd) ${HOME}
+		done x=1 2>/dev/null -eu $(pwd)
+		$(pwd) grep local $(pwd) && echo "$@" sed readonly
+2>/dev/null printf "$1" /usr/bin
+		"$@" readonly readonly awk awk echo local local cd
+	x=1 cd | then "$1" cd cd done test x=1
+	sed echo --verbose "$@" | readonly ${HOME} --verbose
+x=1 done readonly $(pwd) grep cd export done cd local echo cd echo 2>/dev/null
+		&& -eu ${HOME} 'quoted text'
+	local 2>/dev/null && grep /usr/bin -eu $(pwd) x=1 grep readonly
+		'quoted text' sed --verbose readonly
+&& local 'quoted text' $(pwd) "$1" ${HOME}
+		"$@" /usr/bin && echo | export cd "$@" export 2>/dev/null printf printf
+		then then sed awk /usr/bin $(pwd) "$1" x=1 "$1" $(pwd)
+		export local "$@" 'quoted text' -eu 2>/dev/null echo grep done sed echo cd |
+	/usr/bin local /usr/bin awk /usr/bin echo 2>/dev/null ${HOME} then printf
+	${HOME} -eu | ${HOME} cd x=1 $(pwd)
+echo "$@" then then then then printf 2>/dev/null grep awk --verbose -eu
+	grep test sed 'quoted text' 2>/dev/null
+	then echo test then && done && ${HOME}
+		"$1" "$@" -eu ${HOME} cd 2>/dev/null && echo -eu printf done awk sed sed test
+		readonly then 2>/dev/null && grep
+echo cd export x=1 local done "$1" 2>/dev/null
+local 'quoted text' grep x=1 ${HOME}
+sed done export local readonly
+	export export --verbose readonly
+export printf then /usr/bin echo echo local "$@" printf 2>/dev/null cd awk then
+	printf --verbose ${HOME} readonly
+&& test done "$@" 2>/dev/null grep local 2>/dev/null 2>/dev/null "$1" sed
+	$(pwd) && cd readonly 2>/dev/null local && readonly sed
+	| --verbose ${HOME} $(pwd) "$1" "$1" 'quoted text' printf test local readonly
+--verbose 2>/dev/null | | "$1" cd
+/usr/bin "$@" "$1" cd done x=1 2>/dev/null /usr/bin printf $(pwd) ${HOME}
+	&& printf awk done 2>/dev/null -eu test echo
+	--verbose test --verbose 2>/dev/null
+		${HOME} cd | printf | printf printf export printf local
+		local test | grep --verbose awk grep /usr/bin then "$1" ${HOME}
+	"$1" x=1 printf printf 'quoted text'
+	cd | $(pwd) "$1" then grep local 2>/dev/null awk 2>/dev/null
+done ${HOME} done ${HOME} ${HOME} "$1" /usr/bin
+	$(pwd) /usr/bin && "$1" then $(pwd) ${HOME} echo awk local --verbose ${HOME}
+		export echo printf "$1" done grep | grep readonly $(pwd) --verbose then
+| echo /usr/bin 2>/dev/null
+	$(pwd) $(pwd) awk 2>/dev/null grep
+		-eu grep cd ${HOME} ${HOME} ${HOME}
+	echo local "$@" readonly export "$@" printf done $(pwd) echo /usr/bin
+	local sed $(pwd) awk readonly 2>/dev/null -eu cd 'quoted text'
+then test | --verbose test echo then grep grep local sed -eu
+		grep /usr/bin --verbose /usr/bin
+		grep sed 'quoted text' ${HOME} awk
+		-eu $(pwd) printf local local "$@" 2>/dev/null --verbose "$1" $(pwd)
+&& printf | ${HOME} then
+		then "$@" && $(pwd) done grep
+	&& test 'quoted text' export $(pwd) sed echo 'quoted text' done
+		| 'quoted text' --verbose ${HOME} "$1" | -eu "$1" x=1
+	local done export --verbose then
+	export readonly | export
+	local $(pwd) readonly 'quoted text' --verbose "$@"
+		/usr/bin 2>/dev/null && printf 'quoted text' | && --verbose --verbose echo
+printf then $(pwd) export cd export test ${HOME} awk $(pwd) -eu test echo 2>/dev/null
+x=1 2>/dev/null sed | export --verbose | printf | local /usr/bin x=1
+		&& | printf printf awk test x=1 ${HOME} echo "$@" readonly
+cd sed /usr/bin 'quoted text'
+done $(pwd) export --verbose -eu
+--verbose sed sed -eu /usr/bin test printf -eu ${HOME} 'quoted text' ${HOME} ${HOME}
+		awk test awk echo --verbose then x=1 -eu echo awk echo && 'quoted text'
+		x=1 && cd | test export /usr/bin "$1" done grep export "$1" ${HOME} --verbose
+local local -eu readonly printf /usr/bin "$@" export
+		awk echo x=1 awk grep 'quoted text' echo awk x=1
+		export | local --verbose sed test
+	x=1 | && 'quoted text' printf "$1" "$1" cd | cd echo "$1" sed cd export /usr/bin
+	printf ${HOME} export ${HOME} printf /usr/bin -eu then --verbose
+grep /usr/bin 2>/dev/null echo --verbose "$1" echo sed -eu x=1 cd --verbose
+	-eu export && then "$@" awk cd local "$@" "$@" awk $(pwd)
+	--verbose x=1 'quoted text' --verbose "$1" "$1" awk "$@" local
+"$1" local 'quoted text' 'quoted text' echo "$1"
+		--verbose $(pwd) -eu grep 2>/dev/null sed local readonly
+&& "$@" test && readonly
+then cd x=1 local 'quoted text'
+		${HOME} "$@" export /usr/bin
+		2>/dev/null cd test grep cd printf done done 2>/dev/null
+		-eu export ${HOME} readonly x=1 /usr/bin | awk
+| export awk then "$1" cd | awk readonly local | echo export test --verbose
+		"$1" cd sed then --verbose grep
+export && $(pwd) awk done 2>/dev/null ${HOME} --verbose cd done ${HOME}
+	-eu then $(pwd) readonly cd /usr/bin "$@" |
+${HOME} echo then awk -eu then done
+export --verbose $(pwd) grep 2>/dev/null then
+	awk done | cd /usr/bin test "$1" "$1" sed
+		"$1" "$@" sed "$@" "$@" test test then ${HOME}
+	then sed test printf 'quoted text' $(pwd) ${HOME} x=1 awk --verbose 'quoted text'
+		$(pwd) awk x=1 echo 2>/dev/null readonly grep x=1 test $(pwd) "$@" echo then
+		then /usr/bin "$1" "$@" ${HOME} 'quoted text'
+		echo then | | | 2>/dev/null --verbose cd "$1" awk done | awk test
+done printf local export test ${HOME} grep echo readonly 'quoted text' 2>/dev/null
+export x=1 local sed --verbose echo printf local
+test done test && printf grep then 'quoted text' echo ${HOME} "$@" done then
+		x=1 --verbose then awk done | $(pwd) local echo awk export 'quoted text' test
+	readonly 'quoted text' then && -eu x=1 test -eu then | export
+/usr/bin grep | "$1" echo grep | local "$@" local
+	test then sed && $(pwd) printf "$@" grep cd --verbose ${HOME} && -eu readonly
+		$(pwd) x=1 local export $(pwd) awk --verbose "$@" export awk -eu $(pwd) then
+		&& | readonly --verbose echo local "$@"
+	"$@" cd done $(pwd) | 2>/dev/null /usr/bin awk cd echo
+		"$1" $(pwd) local ${HOME} -eu grep echo local 'quoted text'
+	-eu echo -eu -eu awk "$@" -eu 2>/dev/null | readonly && x=1 $(pwd) && sed
+${HOME} sed grep 2>/dev/null sed 2>/dev/null $(pwd) then readonly
+		&& --verbose cd -eu echo readonly
+		readonly "$@" test "$@" local --verbose export done export "$1" x=1
+	sed sed echo done "$1" | /usr/bin cd test "$1"
+	${HOME} grep printf cd cd | done | cd printf && ${HOME}
+	| grep awk --verbose /usr/bin $(pwd) "$1" then | /usr/bin
+"$@" cd $(pwd) "$1" x=1 -eu "$1" cd $(pwd) 'quoted text' printf
+done readonly grep sed echo 'quoted text' export 'quoted text' ${HOME}
+done && && -eu $(pwd) /usr/bin "$1"
+"$@" 'quoted text' then export x=1 ${HOME} x=1 x=1 --verbose readonly
+done done awk grep 'quoted text' --verbose $(pwd) echo | && local echo 'quoted text'
+		then && awk /usr/bin export $(pwd) test export done
+		| "$1" done readonly then
+-eu ${HOME} echo 'quoted text'
+	test 2>/dev/null $(pwd)
+	'quoted text' "$1" x=1 local "$1" done printf cd
+	test $(pwd) export 'quoted text'
+		'quoted text' 2>/dev/null $(pwd) --verbose
+	-eu done "$@" --verbose then /usr/bin
+		&& awk x=1 grep awk 2>/dev/null && "$1" export 2>/dev/null
+		printf awk echo awk sed $(pwd)
+		echo "$@" test x=1 printf $(pwd) 'quoted text' /usr/bin then done
+		$(pwd) printf awk done 'quoted text' x=1
+		echo && then && | then test grep "$1" grep | sed "$@" --verbose $(pwd)
+	"$@" awk readonly && cd | test -eu readonly printf echo --verbose
+${HOME} local local awk grep
+"$1" 2>/dev/null local done grep "$1" cd "$@" /usr/bin
+test printf "$1" echo
+"$@" then export 'quoted text'
+	done /usr/bin local printf
+		x=1 awk | sed 'quoted text' 2>/dev/null done export &&
+	readonly $(pwd) local awk --verbose cd "$@" /usr/bin
+	export --verbose then x=1 printf
+$(pwd) | sed 'quoted text' "$@" 2>/dev/null
+		sed test x=1 readonly grep /usr/bin 2>/dev/null 2>/dev/null
+-eu "$@" ${HOME} ${HOME} readonly done /usr/bin
+	"$1" echo 2>/dev/null ${HOME} /usr/bin "$@" sed echo
+grep ${HOME} echo export done "$@" $(pwd) "$1" then 2>/dev/null "$1"
+	| export | 'quoted text' then "$@" local x=1 done
+	local && cd ${HOME} "$1" $(pwd) ${HOME}
+	${HOME} -eu /usr/bin readonly readonly echo cd "$@" "$1"
+		then -eu local | readonly "$@"
+		| cd x=1 grep test /usr/bin test grep 2>/dev/null "$1"
+		2>/dev/null x=1 -eu ${HOME} printf cd --verbose sed echo done grep readonly sed
+grep export export --verbose then
+	"$1" x=1 done "$@" | sed 2>/dev/null
+		2>/dev/null | awk x=1 export "$1" && && cd done 2>/dev/null
+done 'quoted text' printf readonly /usr/bin test 2>/dev/null cd then grep
+		grep --verbose "$@" "$@" cd | x=1 && awk then local grep -eu /usr/bin echo
+	x=1 "$1" && awk x=1 awk 2>/dev/null x=1
+	cd && cd done --verbose "$1" x=1
+	--verbose awk -eu done "$@"
+		awk export $(pwd) readonly $(pwd) sed x=1 export "$@" local
+	grep 'quoted text' sed cd cd --verbose
+	done echo local | "$@" awk &&
+	sed $(pwd) $(pwd) printf local awk grep /usr/bin
+	test "$1" | "$@" readonly printf then --verbose export
+grep "$@" echo $(pwd) --verbose 2>/dev/null
+	| 'quoted text' awk local local readonly ${HOME} then $(pwd) $(pwd) local cd test
+		printf test -eu local echo 2>/dev/null && /usr/bin export grep /usr/bin 2>/dev/null
+${HOME} --verbose printf then 'quoted text'
+	cd | printf "$1" $(pwd) test x=1 $(pwd) --verbose "$1" printf
+readonly readonly --verbose 'quoted text' ${HOME} ${HOME}
+local $(pwd) --verbose sed "$@" sed --verbose
+		&& then 'quoted text' | export printf $(pwd) $(pwd) --verbose x=1 echo && awk export
+x=1 local then 2>/dev/null
+		then 2>/dev/null "$1" "$1" sed x=1 $(pwd) printf test awk 2>/dev/null
+		cd local sed awk "$1" awk | ${HOME} done --verbose "$1" $(pwd) printf && echo then
+		"$@" 'quoted text' awk
+'quoted text' "$@" && echo readonly 'quoted text' then ${HOME} "$1" "$1" cd echo
+"$@" 2>/dev/null sed export | readonly done
+	'quoted text' awk ${HOME} "$@" && 'quoted text' echo 'quoted text' then
+	awk echo $(pwd) "$1" sed
+	-eu 'quoted text' sed printf -eu $(pwd) $(pwd) then sed local done
+		sed readonly printf "$@"
+done readonly sed | done ${HOME} | "$1" ${HOME}
+		cd readonly printf sed 'quoted text' -eu
+	done -eu "$@" done x=1 printf echo $(pwd) done test && "$@" -eu
+		| 2>/dev/null test test && -eu readonly local && echo ${HOME} "$1" "$@" -eu export
+		local -eu "$@" --verbose $(pwd) && printf echo ${HOME} sed test &&
+		${HOME} test ${HOME} sed test | 2>/dev/null
+awk -eu /usr/bin | then && && cd sed local readonly
+	sed | --verbose then -eu done export 2>/dev/null
+'quoted text' "$1" sed sed export ${HOME} ${HOME} 2>/dev/null sed $(pwd)
+cd ${HOME} cd --verbose done export sed readonly /usr/bin /usr/bin then
+		--verbose "$@" then local then export echo 'quoted text'
+&& done "$@" echo 2>/dev/null then && ${HOME} x=1
+	cd && echo local /usr/bin | -eu
+	"$1" | local --verbose sed "$1" 'quoted text' grep 2>/dev/null done x=1 done grep
+	export test x=1 export echo grep echo grep awk -eu ${HOME} local x=1 local then
+		/usr/bin 2>/dev/null echo
+2>/dev/null "$@" ${HOME} --verbose grep export
+		grep "$1" cd sed sed -eu done grep grep
+	printf 'quoted text' "$1" then "$@" $(pwd) awk printf done
+		grep $(pwd) awk "$@" x=1 awk echo "$1" then x=1 "$@" -eu ${HOME} printf
+	done readonly ${HOME} readonly grep grep test $(pwd) readonly
+	readonly ${HOME} sed /usr/bin ${HOME} --verbose readonly echo "$1"
+	echo 2>/dev/null 2>/dev/null $(pwd) export "$@" then /usr/bin | test --verbose
+		readonly local export $(pwd) export "$1" test awk /usr/bin
+'quoted text' && cd 'quoted text' | /usr/bin 2>/dev/null readonly awk &&
+		printf -eu awk cd 2>/dev/null readonly | /usr/bin
+		$(pwd) 2>/dev/null "$@" -eu && x=1 'quoted text'
+	cd | sed printf awk done echo export echo
+	&& test 2>/dev/null ${HOME} 'quoted text' cd && export
+		"$@" $(pwd) cd then ${HOME} sed "$1" readonly 'quoted text'
+	cd 'quoted text' then cd awk
+		cd printf -eu then then grep /usr/bin cd $(pwd) "$1" export |
+	"$1" ${HOME} export && 2>/dev/null "$1" readonly printf /usr/bin
+'quoted text' grep local 'quoted text'
+	echo printf x=1 "$@"
+	/usr/bin -eu export ${HOME} -eu done local readonly 'quoted text'
+"$@" test cd readonly then x=1 | done | test
+2>/dev/null ${HOME} ${HOME} -eu /usr/bin $(pwd)
+	done /usr/bin && export printf readonly --verbose printf
+		${HOME} local -eu echo | --verbose "$1" grep | $(pwd) $(pwd) done
+		--verbose "$1" done 2>/dev/null 'quoted text' local
+'quoted text' grep 2>/dev/null /usr/bin printf /usr/bin test cd export "$1"
+	"$@" printf $(pwd) --verbose "$@"
+		2>/dev/null "$@" x=1 done && | 'quoted text' -eu awk 'quoted text'
+	awk | awk grep "$1" --verbose
+		local "$1" "$1" --verbose && 'quoted text'
+-eu cd export x=1 readonly
+		grep local && 2>/dev/null local $(pwd) "$@" x=1 "$@" | "$1" local x=1 --verbose
+	then then test test export | "$@"
+	printf $(pwd) -eu printf 2>/dev/null $(pwd) 2>/dev/null
+		2>/dev/null "$@" cd awk readonly 'quoted text' then test echo
+		&& 'quoted text' | 'quoted text' export 2>/dev/null ${HOME} --verbose
+		2>/dev/null x=1 sed 'quoted text' export "$@" awk "$1" readonly awk /usr/bin /usr/bin
+		local test awk "$@" done export readonly awk 'quoted text'
+	'quoted text' /usr/bin | -eu printf done
+		awk readonly readonly then x=1 test ${HOME} awk sed -eu grep
+		&& local x=1 ${HOME} local awk && /usr/bin "$@" export
+	printf grep printf awk readonly printf
+		echo x=1 export cd | awk echo "$@" $(pwd)
+	&& --verbose readonly /usr/bin | then -eu echo "$@"
+	2>/dev/null echo grep test $(pwd) sed readonly
+grep then 'quoted text' printf grep 2>/dev/null then awk printf
+--verbose grep | done test grep 2>/dev/null printf grep local -eu printf
+		awk then echo $(pwd) awk readonly | done "$1"
+		grep /usr/bin printf 'quoted text'
+	echo test $(pwd) then local --verbose sed printf
+		-eu awk /usr/bin x=1 | echo sed | x=1 echo readonly done local $(pwd)
+awk cd -eu 'quoted text' grep ${HOME} && "$1" ${HOME} x=1 $(pwd) grep ${HOME}
+		awk grep $(pwd) "$@" | grep echo
+	2>/dev/null printf 2>/dev/null readonly sed echo done $(pwd) cd cd 2>/dev/null
+&& done ${HOME} export sed "$@" "$1" sed
+		&& done /usr/bin -eu -eu x=1 $(pwd) then | "$1" sed printf local
+	-eu done echo local ${HOME} -eu 2>/dev/null local $(pwd) test
+	&& then grep /usr/bin cd export awk 'quoted text' cd cd then
+2>/dev/null | readonly
+		/usr/bin x=1 test && sed $(pwd) ${HOME} cd && ${HOME}
+		--verbose $(pwd) test export echo echo export echo
+echo test 2>/dev/null done -eu then 'quoted text' cd
+	"$@" && -eu | cd | "$@" export 'quoted text' x=1 export -eu ${HOME} "$@"
+		"$@" done readonly then test x=1 -eu "$@" "$1"
+		-eu 'quoted text' awk then done "$@" export printf $(pwd) x=1 export
+		&& echo && && "$1" 2>/dev/null test $(pwd) && /usr/bin
+awk grep sed && ${HOME} local sed
+		"$1" ${HOME} echo readonly awk test "$@" cd readonly "$1" "$1" "$@"
+$(pwd) ${HOME} export | echo && "$@" x=1 'quoted text'
+	local /usr/bin && /usr/bin grep -eu 'quoted text' --verbose
+export cd && "$1" --verbose then done awk test grep --verbose
+&& awk local sed export
+	&& --verbose "$@" /usr/bin
+	-eu test cd local grep grep export 2>/dev/null | test "$1" -eu
+		sed && -eu readonly awk then 2>/dev/null awk "$1" /usr/bin | grep
+		sed | grep readonly -eu printf printf readonly && /usr/bin awk && export | "$@"
+-eu test $(pwd) && readonly x=1 x=1 'quoted text'
+"$1" echo "$@" sed sed "$@" 2>/dev/null 2>/dev/null
+'quoted text' done awk x=1 grep cd sed local ${HOME} -eu /usr/bin /usr/bin
+${HOME} echo echo $(pwd) x=1 printf
+readonly --verbose cd test x=1 cd | -eu 'quoted text' x=1 test grep
+	-eu 2>/dev/null /usr/bin "$1" "$1" cd | local then -eu --verbose && "$@"
+	-eu x=1 printf -eu local echo /usr/bin then
+	${HOME} grep then x=1 printf && echo | --verbose ${HOME}
+		"$@" "$@" then "$@" cd sed
+		--verbose "$@" /usr/bin export export echo test awk sed grep 'quoted text'
+		--verbose "$@" cd "$1" && test
+		/usr/bin test grep grep /usr/bin -eu
+	'quoted text' && cd "$@" done 'quoted text' grep grep
+		$(pwd) cd "$1" done sed 'quoted text' | 2>/dev/null
+$(pwd) sed printf done "$1" readonly printf && x=1 /usr/bin
+awk && awk then 2>/dev/null done cd | $(pwd) test echo "$1" cd then "$@"
+echo 2>/dev/null 2>/dev/null export done | then "$@"
+readonly local readonly "$@" awk --verbose
+echo done 2>/dev/null test awk $(pwd)
+then awk -eu 2>/dev/null | && /usr/bin /usr/bin sed echo "$1" /usr/bin printf
+printf grep test sed then 2>/dev/null $(pwd) "$@" sed ${HOME}
+2>/dev/null 'quoted text' "$@" then test printf grep
+printf ${HOME} "$@" --verbose --verbose && "$@" x=1 x=1 awk $(pwd) echo
+		local 'quoted text' $(pwd) x=1 printf test | | "$@" test "$@" export | grep awk
+then 2>/dev/null "$@" 2>/dev/null sed export then 'quoted text' export
+test "$@" cd then -eu "$@" "$1"
+done && sed printf echo local 2>/dev/null export
+		2>/dev/null "$1" /usr/bin | -eu grep "$@"
+		${HOME} && printf local done -eu local /usr/bin 'quoted text'
+/usr/bin -eu done "$1" done local local awk test
+then export sed export then
+	printf 2>/dev/null test 2>/dev/null
+sed done test cd awk "$1" $(pwd) "$@" echo sed /usr/bin x=1 &&
+-eu cd sed 'quoted text' then printf sed 2>/dev/null 'quoted text' --verbose
+		&& "$@" | sed | $(pwd) $(pwd) 'quoted text' done echo
+done 2>/dev/null cd $(pwd) 2>/dev/null
+		-eu 2>/dev/null -eu x=1 grep 2>/dev/null sed && local ${HOME} grep printf
+	2>/dev/null echo sed awk printf readonly | cd 'quoted text' test echo
+	export "$1" echo readonly ${HOME} && awk x=1 done $(pwd) /usr/bin
+	printf ${HOME} local printf
+	2>/dev/null && export sed x=1 --verbose
+sed "$1" "$1" sed "$1" done "$@" && readonly readonly
+echo test then ${HOME} --verbose sed cd --verbose --verbose $(pwd) --verbose
+	-eu done && local grep cd 'quoted text'
+	printf local "$@" -eu | local local x=1 awk /usr/bin --verbose 'quoted text'
+		/usr/bin readonly echo ${HOME}
+		echo /usr/bin echo export && export /usr/bin && grep x=1 printf printf
+	| && local 'quoted text' ${HOME} sed export x=1 export "$1" 2>/dev/null
+"$@" test sed x=1 /usr/bin /usr/bin "$1" --verbose
+sed export grep $(pwd) printf done x=1 --verbose "$@" cd local awk test echo
+done sed "$@" ${HOME} awk -eu -eu && done --verbose export $(pwd)
+readonly "$@" "$@" grep local "$1" grep && grep --verbose
+$(pwd) printf done then
+	"$@" -eu "$1" $(pwd) $(pwd) x=1 "$1" local awk done
+		export 2>/dev/null cd printf local echo local && /usr/bin
+		&& x=1 'quoted text' x=1 --verbose
+		awk && ${HOME} echo "$1" /usr/bin ${HOME} && sed x=1 awk 2>/dev/null && x=1
+		grep "$1" test local then "$1" 2>/dev/null
+		--verbose readonly --verbose
+echo awk && test | then done
+		cd "$@" 'quoted text' | "$@" done done test x=1 echo | /usr/bin cd local
+test ${HOME} 'quoted text' awk "$@" ${HOME} "$1" grep readonly test grep awk ${HOME}
+		$(pwd) "$1" --verbose
+export printf $(pwd) local
+		echo $(pwd) --verbose done then 'quoted text' && local awk /usr/bin
+		-eu 2>/dev/null awk /usr/bin
+2>/dev/null && ${HOME} 2>/dev/null
+		| echo cd sed grep 'quoted text' then && 'quoted text' printf
+	echo ${HOME} readonly && test echo "$1" /usr/bin
+	x=1 test awk /usr/bin grep readonly cd then "$1" --verbose
+--verbose 2>/dev/null -eu 'quoted text' 2>/dev/null --verbose
+x=1 awk cd -eu "$1" then x=1 awk export test /usr/bin
+		-eu ${HOME} grep | awk -eu cd && test printf sed && echo cd -eu &&
+	printf done | done x=1 2>/dev/null
+		"$1" -eu local -eu sed | &&
+	/usr/bin | 2>/dev/null cd echo export
+	sed local $(pwd) done 2>/dev/null export export grep && ${HOME}
+		$(pwd) readonly printf 'quoted text' && | | x=1
+awk x=1 then $(pwd) 2>/dev/null
+		&& | test grep then done done awk 'quoted text' test -eu test readonly 2>/dev/null
+	'quoted text' "$1" export printf test echo readonly /usr/bin readonly
+	grep 2>/dev/null awk grep 'quoted text' readonly
+echo "$@" -eu && && test
+grep done sed -eu /usr/bin readonly printf awk 2>/dev/null
+	done echo test /usr/bin cd | done then local "$1" | x=1 ${HOME} then export
+${HOME} 'quoted text' echo x=1 /usr/bin test export grep | 'quoted text'
+echo local 'quoted text' ${HOME} 'quoted text'
+	grep "$1" echo "$@" 2>/dev/null
+echo && --verbose echo done then $(pwd) "$1" | x=1 "$@"
+		--verbose done 2>/dev/null 'quoted text'
+		2>/dev/null /usr/bin 'quoted text' export /usr/bin done echo done
+		cd -eu 2>/dev/null local -eu x=1 export then echo
+		awk export && && | awk | "$1" "$1" $(pwd) 'quoted text'
+	&& export /usr/bin x=1 && "$@" "$@" then grep --verbose then printf test awk
+	awk echo local "$1" --verbose
+	test printf printf test &&
+	--verbose x=1 /usr/bin 2>/dev/null $(pwd) && | readonly "$@" ${HOME}
+		| ${HOME} $(pwd) awk /usr/bin awk 2>/dev/null x=1 --verbose echo | local then
+-eu 2>/dev/null "$@" && export readonly $(pwd) 2>/dev/null
+		| -eu done 2>/dev/null readonly local | --verbose
+	2>/dev/null echo done && test then readonly sed awk "$1" -eu | printf
+		--verbose && awk "$1" ${HOME} echo -eu /usr/bin
+sed done && x=1 /usr/bin cd && printf done && 2>/dev/null
+--verbose grep x=1 done ${HOME} x=1
+	awk x=1 x=1 'quoted text' then then echo x=1 -eu awk && /usr/bin -eu cd printf
+	--verbose ${HOME} then --verbose "$1" readonly test grep | x=1 --verbose 'quoted text'
+printf echo local awk --verbose -eu 2>/dev/null test x=1 $(pwd) cd
+		x=1 echo grep && ${HOME} 2>/dev/null printf && awk sed local
+		'quoted text' then ${HOME} "$@" grep echo local
+	done printf grep test 2>/dev/null "$@" -eu | local cd --verbose 2>/dev/null
+"$1" "$1" ${HOME} then readonly
+	awk && x=1 'quoted text' -eu x=1 cd -eu then "$1" "$1" test local
+	readonly -eu printf local export -eu $(pwd) then $(pwd) readonly
+test printf | 2>/dev/null
+	then grep | test $(pwd) test "$1" -eu readonly
+sed | 2>/dev/null --verbose export printf
+		&& readonly "$@" "$@" 'quoted text' sed awk 'quoted text'
+${HOME} readonly -eu /usr/bin /usr/bin printf x=1 readonly
+	&& $(pwd) printf done "$@" x=1 -eu printf && --verbose /usr/bin echo
+echo --verbose | x=1 -eu export 'quoted text'
+		2>/dev/null /usr/bin done "$1" /usr/bin /usr/bin export $(pwd) ${HOME}
+echo printf /usr/bin 2>/dev/null $(pwd) $(pwd) "$1" done 'quoted text'
+2>/dev/null 2>/dev/null --verbose && echo
+		test /usr/bin test done printf
+	cd $(pwd) done echo sed
+	echo /usr/bin sed -eu local grep echo x=1 $(pwd) printf 'quoted text'
+		then "$@" $(pwd) then "$@" echo && then "$1" done cd $(pwd) readonly -eu
+cd readonly awk x=1 --verbose 2>/dev/null grep
+		&& 'quoted text' 'quoted text' readonly ${HOME} readonly then printf
+	/usr/bin done readonly echo 2>/dev/null | /usr/bin echo "$@" /usr/bin
+x=1 echo && ${HOME} done awk readonly ${HOME} x=1 $(pwd) local done | /usr/bin
+		${HOME} local --verbose -eu x=1 then local "$1" x=1 'quoted text' "$1" x=1 test
+	'quoted text' -eu && printf x=1 done local && /usr/bin then
+	readonly readonly 2>/dev/null /usr/bin && && /usr/bin
+	"$1" -eu sed -eu sed cd "$@" cd "$@" $(pwd) --verbose test ${HOME} awk |
+		${HOME} /usr/bin readonly test -eu sed 'quoted text'
+		cd local -eu awk local awk echo done local printf $(pwd) export
+		awk --verbose --verbose printf local
+		test --verbose echo -eu test
+&& awk && readonly ${HOME}
+		--verbose && x=1 2>/dev/null ${HOME} | grep ${HOME}
+		x=1 echo readonly 'quoted text' cd 'quoted text'
+		--verbose done 2>/dev/null local then done grep cd "$1" test --verbose
+	awk | local ${HOME} -eu test done /usr/bin
+'quoted text' "$@" --verbose export local -eu awk
+export /usr/bin 2>/dev/null cd cd echo | done export "$1"
+	printf -eu cd -eu echo "$@" /usr/bin
+sed && | $(pwd) x=1 | x=1 --verbose
+	test readonly "$@" grep /usr/bin 'quoted text'
+then -eu printf $(pwd) readonly cd --verbose
+$(pwd) cd cd cd grep local grep readonly local 'quoted text' then
+		export local awk 2>/dev/null
+		| done sed "$1" --verbose export /usr/bin export local
+	awk grep /usr/bin "$@" then "$@" $(pwd) "$1" x=1 "$1" awk x=1
+	echo | local awk --verbose awk readonly -eu $(pwd)
+		&& grep 2>/dev/null done export local
+grep 2>/dev/null "$@" then x=1 then echo cd cd printf && 'quoted text'
+$(pwd) then --verbose test $(pwd) echo "$1" awk
+'quoted text' cd "$1" | -eu /usr/bin
+		-eu done then | export sed "$1" -eu "$1" awk grep
+		test $(pwd) readonly "$@" readonly x=1 test | && ${HOME}
+/usr/bin "$1" $(pwd) readonly "$1"
+		2>/dev/null ${HOME} /usr/bin then ${HOME} 'quoted text'
+printf readonly awk printf
+--verbose echo && grep 'quoted text'
+"$1" /usr/bin /usr/bin --verbose -eu done done done printf done /usr/bin sed
+readonly cd then "$1" ${HOME}
+		'quoted text' 2>/dev/null 'quoted text' |
+		${HOME} sed -eu local | -eu done | then then done sed -eu && echo --verbose awk
+		sed "$1" printf printf grep grep -eu then then $(pwd)
+	test awk "$@" x=1 $(pwd) 2>/dev/null
+		&& awk 'quoted text' 2>/dev/null 'quoted text' done
+	test test 2>/dev/null x=1 ${HOME} $(pwd) awk readonly "$@"
+done echo printf ${HOME} --verbose printf $(pwd) 2>/dev/null --verbose --verbose
+		x=1 | ${HOME} x=1 'quoted text' x=1 ${HOME} && "$@" cd cd sed export cd "$@" "$@"
+&& cd /usr/bin sed "$1" -eu readonly /usr/bin readonly --verbose test then x=1
+	| local awk awk ${HOME} -eu cd "$1" -eu done
+		2>/dev/null sed "$@" echo
+		/usr/bin && --verbose test printf "$@" cd 'quoted text' 2>/dev/null 'quoted text'
+| --verbose readonly x=1
+		x=1 export $(pwd) | "$@"
+$(pwd) cd done then readonly echo --verbose ${HOME} -eu | export cd printf "$@"
+	"$@" test awk x=1 'quoted text' $(pwd)
+	done sed export x=1 | awk printf awk "$1" export export /usr/bin
+		${HOME} ${HOME} && --verbose echo
+/usr/bin "$@" | done "$@" -eu test cd cd
+	local done export grep $(pwd) /usr/bin local
+	-eu && test "$@" cd "$1"
+| | echo test grep 2>/dev/null echo awk "$1" cd | done 'quoted text' printf export
+		awk "$@" cd export -eu local test awk --verbose "$@" -eu
+	x=1 printf done --verbose x=1 ${HOME} 'quoted text' $(pwd) awk /usr/bin
+	x=1 ${HOME} local then x=1 /usr/bin x=1
+	'quoted text' cd -eu $(pwd) --verbose awk /usr/bin "$1"
+		awk $(pwd) $(pwd) "$1" awk
+	"$1" /usr/bin x=1 awk "$@" x=1 "$1" -eu ${HOME} export
+export | /usr/bin | 'quoted text'
+	/usr/bin readonly 2>/dev/null export /usr/bin
+&& x=1 printf export awk printf then export x=1 done -eu grep $(pwd) $(pwd) -eu
+	done | -eu /usr/bin sed echo printf /usr/bin $(pwd) | "$@" "$1" local "$1" 2>/dev/null
+$(pwd) export x=1 | && echo $(pwd) $(pwd) 'quoted text' sed grep awk
+test ${HOME} 'quoted text' ${HOME} readonly /usr/bin export done
+		/usr/bin local readonly echo
+		echo then then readonly "$@" -eu --verbose export /usr/bin --verbose 'quoted text'
+	| "$1" 'quoted text' ${HOME} --verbose && "$1" awk -eu x=1 && 2>/dev/null
+$(pwd) awk --verbose x=1 grep
+local echo /usr/bin grep echo done test
+		grep "$@" echo local printf export local ${HOME} done /usr/bin test /usr/bin
+echo && test 2>/dev/null 'quoted text' 2>/dev/null grep "$1" "$1" ${HOME} 2>/dev/null
+	grep "$@" "$@" ${HOME} -eu 'quoted text' -eu echo
+		readonly "$1" test then 'quoted text' test
+		cd "$@" "$@" sed then sed --verbose test
+--verbose -eu "$1" sed /usr/bin sed ${HOME} | export
+		local local | sed | "$1" awk "$@" "$@" x=1 then awk
+sed export done done cd then cd sed
+		&& 'quoted text' local x=1 grep printf readonly 2>/dev/null done
+		local local -eu test -eu grep $(pwd) export grep printf | x=1
+/usr/bin && test readonly then -eu sed grep
+		/usr/bin local --verbose cd awk test $(pwd) echo "$1" cd 2>/dev/null test local
+--verbose echo done --verbose 'quoted text'
+	then echo local -eu &&
+		sed test done echo printf && readonly 2>/dev/null
+$(pwd) export "$1" $(pwd) cd "$1"
+	sed "$@" "$1" then x=1 'quoted text'
+/usr/bin echo -eu $(pwd) sed then readonly echo readonly && -eu --verbose
+		grep && --verbose then sed awk done local export
+	then /usr/bin 2>/dev/null "$@" x=1 awk | export 'quoted text'
+| "$1" local local | cd export &&
+		echo && "$@" /usr/bin 'quoted text' "$1" sed "$@" grep -eu
+	test printf | x=1 x=1 awk --verbose "$@"
+		'quoted text' local export
+		printf printf | /usr/bin 'quoted text' grep
+-eu "$@" | cd then sed "$1" "$1" --verbose 'quoted text' then
+"$@" $(pwd) $(pwd) /usr/bin ${HOME} awk export x=1 export
+		done awk export printf 'quoted text'
+		'quoted text' /usr/bin then /usr/bin --verbose "$1" /usr/bin
+	x=1 echo x=1 "$1" ${HOME} readonly export "$1" 'quoted text' "$1" x=1
+		test printf local echo 2>/dev/null $(pwd) printf 2>/dev/null
+		"$@" then readonly -eu cd --verbose awk | $(pwd) "$1" | printf
+grep $(pwd) printf 'quoted text' readonly export /usr/bin && $(pwd) -eu "$1"
+		printf local && grep
+x=1 $(pwd) "$@" | awk -eu local && x=1
+grep | local done local | echo test sed test local 2>/dev/null
+		x=1 printf 'quoted text' grep /usr/bin /usr/bin 'quoted text' readonly
+		--verbose "$@" --verbose
+/usr/bin awk grep then "$1" --verbose | 'quoted text' awk cd test done 2>/dev/null
+test 'quoted text' --verbose | --verbose &&
+		'quoted text' done grep x=1 ${HOME} "$@" "$@" cd && echo 2>/dev/null
+	then | export sed printf cd && readonly cd | 'quoted text' ${HOME} -eu
+	'quoted text' sed && grep && test awk 2>/dev/null then
+	done 2>/dev/null x=1 x=1 sed echo cd --verbose printf
+	${HOME} 'quoted text' awk local readonly | $(pwd)
+done readonly 2>/dev/null "$@" local | sed test echo
+	"$1" done local --verbose awk 2>/dev/null grep
+&& "$1" local $(pwd) readonly && export 'quoted text' &&
+		awk export $(pwd) "$@"
+	"$@" cd "$1" --verbose local test cd 'quoted text' grep
+	"$@" && $(pwd) "$@" readonly echo grep
+		-eu grep 'quoted text' "$@"
+		${HOME} $(pwd) --verbose sed $(pwd) then /usr/bin sed grep awk printf 'quoted text'
+	| ${HOME} echo echo | /usr/bin
+${HOME} x=1 local export ${HOME} && then ${HOME}
+		$(pwd) -eu x=1 2>/dev/null -eu local printf export echo
+done 'quoted text' local -eu | /usr/bin echo printf test echo
+	export sed /usr/bin export 2>/dev/null done /usr/bin then done echo
+/usr/bin sed grep cd test "$@"
+	awk --verbose /usr/bin ${HOME} 'quoted text' "$1" --verbose /usr/bin --verbose
+		-eu grep /usr/bin cd 'quoted text' 2>/dev/null
+	echo ${HOME} 2>/dev/null done export "$1" printf "$1" done "$@" ${HOME} echo /usr/bin
+${HOME} sed /usr/bin done sed sed printf awk 2>/dev/null
+echo "$1" readonly "$1" echo /usr/bin cd test "$1" ${HOME} readonly ${HOME}
+test then "$1" "$1" readonly 2>/dev/null test 2>/dev/null
+"$@" local sed x=1 'quoted text' --verbose readonly test /usr/bin readonly
+		awk echo --verbose printf | readonly local readonly "$1"
+	| x=1 readonly grep /usr/bin
+printf "$1" -eu readonly printf "$@" && local echo
+	cd test 2>/dev/null cd ${HOME}
+sed sed && -eu grep -eu echo printf sed readonly awk echo x=1 /usr/bin awk
+		done then cd "$1" -eu printf echo local "$@" grep local | grep
+		grep 'quoted text' /usr/bin && readonly
+		-eu ${HOME} && cd sed echo sed local echo cd done printf then
+		export readonly readonly sed grep grep readonly local
+$(pwd) /usr/bin -eu echo grep 2>/dev/null test cd | -eu 'quoted text'
+'quoted text' awk $(pwd) readonly test 'quoted text' | "$@" export awk
+"$@" grep cd echo echo 2>/dev/null sed -eu test
+echo /usr/bin test 'quoted text'
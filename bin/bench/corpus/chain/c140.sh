@@ -0,0 +1,2001 @@
+/usr/bin awk 'quoted text' && --verbose test ${HOME}
+--verbose /usr/bin /usr/bin --verbose 2>/dev/null 'quoted text' 'quoted text'
+local /usr/bin x=1 grep awk awk printf x=1 echo grep | then then
+		--verbose awk --verbose /usr/bin
+readonly "$1" 2>/dev/null 2>/dev/null grep readonly
+/usr/bin readonly test -eu echo -eu && "$1" x=1 then
+	"$@" local --verbose grep
+		local then --verbose "$1" | $(pwd) -eu 2>/dev/null cd 2>/dev/null
+		$(pwd) $(pwd) && cd x=1 --verbose | "$1" sed export cd echo && local
+	$(pwd) 2>/dev/null && $(pwd) ${HOME} 2>/dev/null
+'quoted text' readonly awk
+	"$@" "$1" /usr/bin sed ${HOME} "$@" local printf ${HOME} awk --verbose ${HOME} "$@"
+		local test local ${HOME} grep 2>/dev/null $(pwd) local
+		'quoted text' --verbose grep then printf
+		then awk cd -eu "$1" --verbose ${HOME}
+	"$@" "$1" && -eu export echo printf
+	"$1" printf awk awk printf /usr/bin export then
+		/usr/bin grep echo x=1 local test && | readonly 2>/dev/null
+		"$@" $(pwd) --verbose "$@" /usr/bin | cd --verbose done
+| done sed ${HOME} "$1" "$@" local "$@" 2>/dev/null cd grep local
+		test cd -eu "$1" awk export $(pwd) "$@" "$@" cd $(pwd)
+sed x=1 /usr/bin x=1 'quoted text' | test ${HOME} local readonly
+	printf --verbose 2>/dev/null /usr/bin /usr/bin grep $(pwd) 'quoted text'
+2>/dev/null local export readonly printf
+sed "$@" local sed $(pwd) "$1" && cd
+		| cd /usr/bin "$1" x=1 sed $(pwd) -eu sed grep ${HOME}
+	--verbose $(pwd) sed cd | "$@" echo $(pwd) test 2>/dev/null -eu "$@" 'quoted text'
+		"$1" 'quoted text' "$1" 'quoted text' 'quoted text' sed export /usr/bin
+		sed x=1 --verbose -eu "$1" && export -eu /usr/bin -eu
+	'quoted text' /usr/bin --verbose "$1" -eu "$@" /usr/bin then
+/usr/bin /usr/bin && done echo test done $(pwd)
+	$(pwd) | -eu "$1" export -eu
+local sed | done x=1 ${HOME} local /usr/bin | cd sed sed readonly
+grep export ${HOME} ${HOME} export "$@" cd test
+&& done | ${HOME} | test 2>/dev/null test x=1 -eu test test | sed echo /usr/bin
+local "$@" --verbose --verbose -eu test readonly then "$1" ${HOME}
+'quoted text' | 'quoted text'
+		printf "$1" done "$@" "$1" done 2>/dev/null $(pwd)
+	test printf /usr/bin $(pwd) test test --verbose sed 'quoted text' export | ${HOME}
+then 2>/dev/null && $(pwd) done local printf $(pwd) local /usr/bin cd
+		awk "$@" "$1" cd local -eu local export /usr/bin --verbose then "$1"
+		2>/dev/null ${HOME} then echo $(pwd) awk cd echo
+done test 2>/dev/null $(pwd) test printf
+"$@" echo cd printf grep && then && awk local echo awk printf
+	export && -eu local export echo test $(pwd) readonly ${HOME} cd | && x=1 sed x=1
+	2>/dev/null /usr/bin -eu x=1 ${HOME} then test
+		/usr/bin "$1" | grep /usr/bin "$1" "$1" readonly sed | local 2>/dev/null
+	echo echo "$1" 2>/dev/null --verbose
+--verbose printf | -eu ${HOME} /usr/bin local $(pwd)
+${HOME} done "$1" $(pwd) test test done echo x=1 local
+		'quoted text' "$@" then sed then --verbose "$@" echo "$@" 2>/dev/null | done
+		printf then grep $(pwd) -eu
+		readonly ${HOME} then readonly -eu "$1" then -eu test printf ${HOME} readonly
+		'quoted text' then "$@" ${HOME}
+'quoted text' cd then echo then x=1 /usr/bin --verbose
+	then x=1 -eu cd test local 2>/dev/null --verbose
+		awk && && echo test awk 2>/dev/null
+	printf readonly printf 'quoted text' printf x=1 cd /usr/bin printf
+2>/dev/null ${HOME} 'quoted text' /usr/bin cd $(pwd) done --verbose
+&& test export "$@" export done done then cd 2>/dev/null local echo local
+	--verbose echo "$1" x=1 export test --verbose export -eu --verbose && /usr/bin
+export export then ${HOME} awk --verbose "$@" -eu "$@" && /usr/bin
+sed | grep printf --verbose printf
+		printf && then printf done ${HOME} cd
+	--verbose echo grep | 2>/dev/null | 'quoted text' --verbose done --verbose /usr/bin
+test "$1" && --verbose then $(pwd) echo $(pwd)
+		echo export grep 2>/dev/null x=1 then -eu && && $(pwd)
+"$@" /usr/bin && "$1" 2>/dev/null done echo --verbose | && 2>/dev/null --verbose
+	then 2>/dev/null local --verbose /usr/bin
+then "$1" 2>/dev/null
+		x=1 && export --verbose local export -eu
+		"$1" printf local /usr/bin /usr/bin "$1" && done test done sed local
+		'quoted text' ${HOME} -eu 2>/dev/null done test awk "$@" | ${HOME}
+&& echo then $(pwd) 2>/dev/null cd readonly "$1" 'quoted text' local
+local readonly && "$@" /usr/bin | done --verbose local -eu
+		readonly ${HOME} test 2>/dev/null "$@" printf done cd 2>/dev/null
+		done awk grep grep echo test
+"$@" "$@" x=1 ${HOME} local "$1" | 'quoted text' 2>/dev/null cd ${HOME}
+printf cd readonly export echo
+sed echo "$1" test sed x=1 cd | then done sed x=1 /usr/bin cd | awk | printf
+	grep sed sed && awk printf 'quoted text' | &&
+awk readonly --verbose export export
+		printf local "$@" printf --verbose local printf |
+		x=1 grep /usr/bin done grep -eu "$1" | --verbose
+awk "$@" 'quoted text' --verbose -eu export --verbose
+echo local && 2>/dev/null ${HOME} readonly
+	/usr/bin cd 'quoted text' 2>/dev/null
+"$@" "$1" "$@" x=1 local -eu local ${HOME} /usr/bin && grep readonly
+		$(pwd) x=1 local "$@" "$@" --verbose /usr/bin
+awk cd echo x=1 test then done sed 'quoted text' "$1" echo | --verbose
+	| 2>/dev/null echo 'quoted text' export readonly
+--verbose -eu test done sed done grep test grep x=1 then grep && awk export
+cd cd local printf 2>/dev/null /usr/bin "$@" done then ${HOME} -eu printf ${HOME}
+	$(pwd) "$1" --verbose 2>/dev/null 'quoted text' grep then readonly && export
+	-eu && awk x=1 export /usr/bin
+	-eu ${HOME} cd ${HOME} "$@" then 2>/dev/null --verbose echo 2>/dev/null awk
+$(pwd) && echo sed then | 2>/dev/null local
+	"$@" local 2>/dev/null -eu /usr/bin
+then "$@" grep x=1 printf && x=1 readonly sed export ${HOME} sed done
+	-eu 2>/dev/null echo /usr/bin test -eu "$1" "$1" then
+--verbose local export echo then ${HOME} grep 'quoted text'
+test readonly export x=1 ${HOME} "$@" printf
+"$1" awk echo /usr/bin 2>/dev/null --verbose /usr/bin 'quoted text'
+	echo /usr/bin done --verbose 'quoted text'
+done 2>/dev/null test cd done x=1 'quoted text' echo "$@" | | 2>/dev/null
+		/usr/bin printf /usr/bin "$@" 'quoted text'
+$(pwd) ${HOME} printf "$@" 'quoted text'
+	test "$1" $(pwd) --verbose $(pwd) sed test grep /usr/bin
+		x=1 test readonly x=1 'quoted text'
+		echo ${HOME} cd -eu ${HOME} cd echo --verbose echo
+	then /usr/bin && -eu && ${HOME} readonly test 'quoted text'
+sed "$@" | cd awk grep then export -eu
+	'quoted text' --verbose | awk 'quoted text'
+"$@" cd cd ${HOME} echo | readonly ${HOME} sed 2>/dev/null | ${HOME} sed local
+	x=1 && echo x=1 export awk printf 2>/dev/null done x=1
+2>/dev/null echo /usr/bin then awk local "$1" cd cd cd
+		-eu $(pwd) && awk --verbose /usr/bin x=1 cd cd --verbose printf 2>/dev/null readonly
+2>/dev/null 2>/dev/null $(pwd) && awk local readonly
+${HOME} --verbose export done && cd $(pwd) x=1 'quoted text'
+		/usr/bin 2>/dev/null then $(pwd) local test /usr/bin $(pwd) export test
+	"$@" printf --verbose echo $(pwd) 2>/dev/null 'quoted text' local
+local | "$@" | -eu -eu then x=1 done printf | -eu
+	-eu 'quoted text' done /usr/bin local test
+| /usr/bin --verbose readonly
+		"$1" then 'quoted text' readonly echo --verbose 2>/dev/null echo $(pwd) /usr/bin
+	'quoted text' echo done /usr/bin /usr/bin 2>/dev/null then -eu echo printf
+		x=1 test && local done cd ${HOME}
+		grep x=1 printf x=1 sed local | then |
+$(pwd) x=1 /usr/bin grep done awk done ${HOME} local
+	sed readonly then $(pwd) cd printf "$@"
+		$(pwd) awk | && then printf awk echo -eu && echo
+	readonly grep && x=1 grep sed --verbose | /usr/bin printf echo
+		done -eu $(pwd) 'quoted text' awk "$@" 'quoted text'
+--verbose ${HOME} ${HOME} "$1" readonly 2>/dev/null echo x=1 /usr/bin sed
+"$@" printf test ${HOME} awk $(pwd) && done sed sed
+		&& printf done readonly ${HOME}
+| echo $(pwd) 2>/dev/null --verbose then readonly
+		cd -eu $(pwd) sed /usr/bin ${HOME} local | local local
+		printf /usr/bin "$1"
+		&& 'quoted text' awk sed
+-eu --verbose cd sed sed cd awk test cd /usr/bin $(pwd) && x=1 2>/dev/null
+		cd awk x=1 | sed x=1 grep
+	--verbose done printf printf export --verbose --verbose 2>/dev/null /usr/bin
+		&& 'quoted text' sed grep export 2>/dev/null cd "$@" done export 2>/dev/null
+		echo -eu --verbose && && "$1" "$@" local 2>/dev/null printf /usr/bin local
+		done awk 'quoted text' "$1" test grep printf done "$@" /usr/bin
+'quoted text' echo 2>/dev/null
+		printf export test | 'quoted text' 2>/dev/null echo 'quoted text'
+| /usr/bin /usr/bin done local export x=1 /usr/bin
+		echo echo 'quoted text' printf -eu "$1" echo cd 2>/dev/null
+-eu grep done done then ${HOME} ${HOME} grep echo export
+	"$@" "$1" grep export test done --verbose export test
+		grep -eu "$@" echo 2>/dev/null grep awk --verbose test ${HOME}
+		2>/dev/null test | test /usr/bin grep "$1" sed sed
+then echo 2>/dev/null "$@" readonly readonly
+sed 'quoted text' | | awk --verbose -eu x=1 /usr/bin "$@" /usr/bin
+| awk export | -eu | done local export | 'quoted text'
+then awk /usr/bin local sed grep x=1 ${HOME} /usr/bin 2>/dev/null
+then --verbose -eu cd local
+	cd printf x=1 sed -eu echo /usr/bin sed 'quoted text' |
+	awk x=1 && done printf cd $(pwd) $(pwd) -eu
+		2>/dev/null | x=1 test export
+	test "$1" -eu printf -eu "$@"
+		${HOME} 'quoted text' grep /usr/bin
+	-eu export readonly awk x=1 'quoted text' /usr/bin "$1" test
+		echo | done grep echo --verbose
+--verbose done "$@" "$1" && then printf x=1 readonly cd /usr/bin readonly
+		$(pwd) echo grep --verbose -eu echo --verbose $(pwd) "$@"
+	then readonly -eu sed $(pwd)
+&& -eu -eu then | 2>/dev/null awk ${HOME} x=1 grep | done 2>/dev/null
+		readonly test --verbose 2>/dev/null
+	| sed test then done then
+then "$1" sed done ${HOME} cd -eu --verbose
+		/usr/bin echo | 2>/dev/null printf test --verbose 2>/dev/null | awk "$@"
+	export | --verbose x=1 -eu x=1 cd awk grep /usr/bin
+		echo test grep readonly local x=1
+readonly export 2>/dev/null "$@" "$@" done "$@" 2>/dev/null ${HOME} 2>/dev/null
+	$(pwd) 'quoted text' echo echo test
+	| export done awk done /usr/bin
+		-eu grep -eu | "$@" && readonly sed export "$1"
+		x=1 2>/dev/null -eu printf && test $(pwd) | |
+	-eu 'quoted text' 'quoted text' -eu 2>/dev/null awk "$@" done local "$@" 2>/dev/null
+		grep then sed ${HOME} grep 2>/dev/null awk --verbose printf readonly &&
+done echo "$@" then && x=1 readonly x=1 2>/dev/null printf | && x=1
+	grep test $(pwd) done /usr/bin --verbose sed grep echo
+	"$1" x=1 "$@" export 2>/dev/null awk "$@" $(pwd) then
+		sed $(pwd) x=1 printf $(pwd) export grep && && sed echo --verbose then
+echo ${HOME} done "$@" done
+		'quoted text' printf cd "$1" local $(pwd)
+"$1" readonly --verbose /usr/bin readonly local /usr/bin
+	echo 2>/dev/null x=1 /usr/bin -eu echo ${HOME} local cd ${HOME} echo
+done "$@" 2>/dev/null "$1" local
+		cd readonly export /usr/bin awk printf 'quoted text' $(pwd) then test | readonly
+	sed sed then x=1 $(pwd) export
+"$1" export 'quoted text' | ${HOME} 'quoted text' | --verbose
+cd && test 'quoted text' grep | then "$@" sed cd test x=1
+cd test sed local && printf awk
+		readonly ${HOME} "$@" done "$@" $(pwd) "$@" && awk sed
+		2>/dev/null readonly readonly cd printf then
+	2>/dev/null done done 2>/dev/null done echo
+2>/dev/null cd printf && local test awk --verbose then printf
+	| printf ${HOME} 2>/dev/null -eu echo 2>/dev/null
+		&& test readonly $(pwd) cd | sed "$@" "$@" export | | $(pwd) export /usr/bin "$@"
+	x=1 | export done echo grep 'quoted text' 'quoted text' /usr/bin ${HOME}
+		"$1" /usr/bin -eu sed done --verbose grep 2>/dev/null
+		| grep cd 'quoted text' test "$1" then
+	"$1" awk && grep 2>/dev/null
+	x=1 --verbose echo ${HOME} x=1 'quoted text' grep --verbose "$@" -eu
+	grep 'quoted text' | 'quoted text' local --verbose
+		test echo sed -eu printf "$1" awk $(pwd) | then "$@" test sed && 2>/dev/null
+$(pwd) local cd ${HOME} awk && x=1 && grep && ${HOME}
+		grep then 2>/dev/null awk sed "$@" readonly grep local readonly
+$(pwd) ${HOME} /usr/bin done test 2>/dev/null
+		readonly 2>/dev/null printf -eu
+test local "$1" 2>/dev/null
+then grep --verbose -eu
+grep --verbose cd done test awk && --verbose $(pwd) $(pwd) -eu test cd 'quoted text'
+then sed | ${HOME} 'quoted text' local "$1" --verbose && printf printf
+sed --verbose ${HOME} x=1 done printf -eu x=1 "$@" readonly
+x=1 "$@" "$@" done && readonly then 2>/dev/null awk done && --verbose
+grep /usr/bin "$@" 'quoted text' x=1 x=1 x=1 printf "$@" ${HOME} "$@" -eu
+"$1" sed export readonly --verbose test sed cd
+		grep sed $(pwd) | then && -eu $(pwd) test sed test $(pwd) cd grep "$1"
+	test echo local /usr/bin ${HOME} "$1" export
+		| 2>/dev/null x=1 ${HOME} ${HOME} -eu readonly 'quoted text' test --verbose
+		printf 'quoted text' local awk test cd sed
+	test done --verbose sed readonly then cd
+		--verbose $(pwd) $(pwd) export grep
+		done sed readonly sed "$@" /usr/bin
+| then x=1 $(pwd) "$1" sed echo "$@" "$1" readonly /usr/bin done sed
+	--verbose 2>/dev/null local
+	export readonly printf 'quoted text' x=1 sed
+	readonly readonly test /usr/bin cd echo
+printf printf /usr/bin "$1" export "$1" sed --verbose $(pwd) && grep "$1" x=1
+	-eu grep grep "$1" export x=1 ${HOME} $(pwd) awk grep 'quoted text' "$1" /usr/bin
+		&& ${HOME} --verbose -eu done 'quoted text' -eu /usr/bin /usr/bin
+$(pwd) | x=1 x=1 x=1
+		'quoted text' 2>/dev/null -eu echo echo then --verbose printf
+	/usr/bin export grep && | grep "$1"
+2>/dev/null 'quoted text' 'quoted text' 2>/dev/null --verbose echo 2>/dev/null
+		local "$@" 'quoted text' "$1" done then x=1 "$@" && ${HOME} &&
+awk ${HOME} $(pwd) done && --verbose readonly grep export export "$@" -eu -eu test
+	then test done -eu sed x=1 x=1 && done "$@" then done /usr/bin readonly $(pwd)
+${HOME} export 'quoted text' --verbose x=1 /usr/bin ${HOME}
+| --verbose && done test
+'quoted text' sed readonly cd -eu "$1" sed awk
+grep awk local readonly 'quoted text' readonly cd
+	'quoted text' ${HOME} done local printf cd test "$@" $(pwd) --verbose printf ${HOME}
+then 'quoted text' 2>/dev/null cd $(pwd) done /usr/bin x=1 printf
+'quoted text' done x=1 test ${HOME}
+		--verbose test sed test export local readonly
+printf -eu "$@" cd done --verbose then 'quoted text' export sed -eu 2>/dev/null
+		x=1 ${HOME} && awk 2>/dev/null export /usr/bin
+		export cd local cd 'quoted text' export | x=1 cd export grep
+then --verbose awk /usr/bin
+	sed cd "$1" done 'quoted text' 'quoted text' awk &&
+		done test local "$@" readonly ${HOME} $(pwd) "$1" $(pwd) "$@" awk ${HOME}
+		-eu echo awk printf && grep ${HOME} echo cd && local -eu "$@"
+		x=1 2>/dev/null then echo $(pwd)
+	/usr/bin export local echo grep "$@" done
+		test done --verbose grep
+		readonly grep done x=1 2>/dev/null
+		--verbose x=1 test then x=1 then -eu ${HOME} done --verbose export then
+echo echo awk $(pwd) $(pwd) "$@" 2>/dev/null readonly cd |
+		/usr/bin "$1" echo "$1" test export then "$1"
+	printf 2>/dev/null local awk "$@" test -eu "$1" local printf local
+	2>/dev/null 'quoted text'
+	sed "$1" "$1" export grep grep x=1 /usr/bin -eu done "$1" x=1 'quoted text'
+awk awk sed $(pwd) "$1" done local $(pwd) ${HOME} "$@" awk printf
+		sed 2>/dev/null -eu test 2>/dev/null $(pwd) "$@" local readonly
+export "$1" x=1 readonly "$@" awk 2>/dev/null --verbose -eu
+		x=1 --verbose 'quoted text' printf grep "$@"
+	echo --verbose export | x=1 $(pwd) | export --verbose then sed --verbose
+/usr/bin 'quoted text' local echo -eu printf printf grep grep done ${HOME}
+	then 'quoted text' export cd && |
+	done | 2>/dev/null awk -eu -eu readonly 'quoted text' -eu readonly then
+	--verbose readonly 2>/dev/null --verbose test && "$@" then $(pwd) x=1 |
+	sed && sed x=1 --verbose then -eu 2>/dev/null
+	cd awk export -eu 2>/dev/null /usr/bin sed export | /usr/bin printf -eu test
+		sed readonly 'quoted text' --verbose 'quoted text' sed /usr/bin
+		x=1 export | x=1 export
+	done x=1 | /usr/bin readonly done -eu test done
+		${HOME} /usr/bin "$1" x=1 printf readonly x=1 cd done local "$1" export /usr/bin
+		local done then "$1" "$@" test x=1 echo 2>/dev/null grep local $(pwd)
+readonly "$1" $(pwd) x=1 --verbose --verbose
+local export --verbose "$@" readonly
+&& readonly | readonly 2>/dev/null cd readonly x=1
+x=1 --verbose sed local echo
+local cd "$1" 2>/dev/null awk | 2>/dev/null cd "$@" awk 2>/dev/null
+		'quoted text' "$1" /usr/bin
+		/usr/bin then -eu awk done export "$@" | printf then sed grep done cd sed test
+		cd grep cd 2>/dev/null printf done 'quoted text' then && sed grep grep
+	echo /usr/bin export ${HOME} done echo $(pwd) "$@" echo readonly grep
+	/usr/bin 2>/dev/null 2>/dev/null "$@" -eu $(pwd) --verbose readonly
+test 'quoted text' ${HOME} done local cd local printf 2>/dev/null test awk "$1"
+sed && export "$1" grep local local 2>/dev/null -eu ${HOME} ${HOME} export sed
+printf 'quoted text' readonly -eu local echo /usr/bin
+	sed x=1 && x=1 test --verbose 'quoted text' "$1" awk && -eu test readonly x=1 then
+		2>/dev/null -eu && printf 2>/dev/null /usr/bin -eu 'quoted text' then sed sed
+done cd x=1 2>/dev/null printf "$1" sed x=1 "$1" test
+	--verbose "$1" export awk 2>/dev/null "$1" /usr/bin printf /usr/bin then
+		$(pwd) local | | -eu printf awk awk "$1" echo local "$1" echo grep test
+awk done readonly local done -eu echo done readonly "$@" test "$1" $(pwd) echo
+	2>/dev/null printf awk "$@" printf awk
+		${HOME} readonly done awk awk sed awk "$1" x=1 done $(pwd)
+then printf awk then ${HOME} $(pwd)
+--verbose /usr/bin ${HOME} test 2>/dev/null
+then -eu $(pwd) | printf -eu && done test
+		grep sed echo test export
+"$@" /usr/bin printf 2>/dev/null | ${HOME} -eu "$@"
+	test local "$@" | | $(pwd) echo 2>/dev/null
+		x=1 test done printf 'quoted text' local "$@"
+		awk then /usr/bin export "$@" "$1" test
+		--verbose --verbose /usr/bin 'quoted text'
+		sed done "$@" export done /usr/bin
+	/usr/bin grep $(pwd) done /usr/bin export
+		readonly test done /usr/bin local | -eu grep done | 2>/dev/null x=1
+		test --verbose 2>/dev/null
+	"$@" "$1" "$1" 2>/dev/null x=1 | grep
+	--verbose 'quoted text' 'quoted text' -eu done | ${HOME}
+	then grep sed 'quoted text' -eu test grep /usr/bin cd export "$@"
+printf | awk "$@" | echo 'quoted text'
+	then done 'quoted text' sed then awk "$@" ${HOME} test awk
+		awk then awk $(pwd) export 2>/dev/null -eu then grep echo &&
+		${HOME} export echo "$@" -eu /usr/bin --verbose test done readonly
+	&& /usr/bin 2>/dev/null x=1 x=1 $(pwd) done echo "$1" --verbose then sed awk
+	x=1 -eu | local awk grep $(pwd) -eu -eu 'quoted text'
+awk 'quoted text' /usr/bin grep then grep printf awk then echo echo
+"$@" grep 2>/dev/null $(pwd) --verbose --verbose "$@" awk
+		$(pwd) echo ${HOME} test readonly --verbose local export printf
+	readonly cd /usr/bin --verbose /usr/bin export cd test local local $(pwd) "$@"
+${HOME} 2>/dev/null then "$@" 2>/dev/null cd | done sed
+| printf done printf echo --verbose
+	'quoted text' | test sed $(pwd) sed test echo export "$@" sed sed cd readonly $(pwd)
+	echo $(pwd) | ${HOME} local grep local echo then /usr/bin
+	sed ${HOME} export 'quoted text' printf 'quoted text' done local export
+	test --verbose -eu cd --verbose $(pwd) "$1" $(pwd)
+	readonly local --verbose 'quoted text' echo echo export cd ${HOME}
+		"$@" printf && export local "$@" -eu local 2>/dev/null readonly x=1 then
+		-eu echo test "$1" --verbose echo
+		grep grep then --verbose "$1"
+'quoted text' echo sed 2>/dev/null "$@" readonly
+	test $(pwd) cd "$1" "$1" 2>/dev/null grep "$@" $(pwd) done
+		2>/dev/null && | grep sed printf echo -eu
+	x=1 test sed awk $(pwd)
+		then | awk | "$1" "$1" then grep --verbose then export "$1" x=1 && then cd test
+	| /usr/bin && && ${HOME} test cd 2>/dev/null grep && grep cd grep printf
+		done test ${HOME} "$1" awk --verbose | 'quoted text' export --verbose
+printf readonly $(pwd) /usr/bin
+		&& $(pwd) 'quoted text' local grep cd ${HOME} awk test cd cd export grep
+	--verbose | "$@" export done sed echo sed printf 'quoted text'
+	"$@" cd done grep 2>/dev/null | grep awk
+		${HOME} --verbose | test "$@" ${HOME} /usr/bin sed "$1" | echo
+printf then done printf then "$1" --verbose 'quoted text' 2>/dev/null
+	awk 2>/dev/null "$@" /usr/bin
+		2>/dev/null $(pwd) /usr/bin sed
+done test "$1" awk $(pwd) && ${HOME} export x=1 done then 'quoted text'
+	"$@" --verbose "$1" "$1" awk
+		done $(pwd) printf then --verbose printf
+		echo echo sed --verbose printf
+printf export x=1 | && done readonly local --verbose cd "$@"
+	awk $(pwd) done done export local /usr/bin
+		"$@" printf 2>/dev/null -eu $(pwd) "$@"
+	sed cd export /usr/bin readonly test then done -eu
+	printf test cd x=1 awk then 'quoted text' grep sed echo --verbose
+		cd then /usr/bin readonly then | | "$1" -eu echo 'quoted text' && grep 'quoted text'
+	grep $(pwd) x=1 "$1" awk ${HOME} && local then && done
+	${HOME} sed && export --verbose export 2>/dev/null x=1 $(pwd) $(pwd) test "$@"
+'quoted text' x=1 cd echo --verbose | x=1 "$@" | awk printf && "$@"
+		done grep test grep $(pwd) readonly /usr/bin -eu echo x=1 cd "$@" then then
+	"$1" /usr/bin echo 2>/dev/null | readonly -eu cd
+printf "$@" 2>/dev/null "$1" cd done
+readonly x=1 awk -eu cd printf 2>/dev/null sed grep test "$@" "$1" printf
+x=1 && test "$1" local local 'quoted text' 'quoted text'
+		export echo $(pwd) printf
+		2>/dev/null then done echo -eu | 'quoted text'
+		"$1" 2>/dev/null x=1 /usr/bin awk --verbose
+		${HOME} --verbose readonly ${HOME} grep sed $(pwd) -eu ${HOME} readonly "$1"
+	sed sed readonly awk readonly | sed
+grep ${HOME} 2>/dev/null --verbose
+	then export "$1" echo echo echo -eu "$@" readonly && sed
+	/usr/bin ${HOME} awk grep | | echo | ${HOME} readonly 'quoted text'
+		done "$1" x=1 awk $(pwd) 'quoted text' --verbose done | awk 2>/dev/null
+readonly done "$1" 'quoted text' 'quoted text'
+/usr/bin awk 2>/dev/null export /usr/bin ${HOME} "$1" test echo --verbose
+	"$@" 2>/dev/null x=1 cd awk 'quoted text' done then cd 2>/dev/null
+done awk /usr/bin sed sed awk "$1" "$1" &&
+echo -eu "$@" awk cd test "$@" sed
+		printf "$1" x=1 && printf -eu $(pwd) ${HOME} | "$@" /usr/bin && ${HOME} /usr/bin
+printf sed "$1" test awk echo local
+done ${HOME} echo printf then /usr/bin cd /usr/bin awk then echo export
+	/usr/bin awk --verbose echo "$1" awk $(pwd) then
+then local $(pwd) ${HOME} cd awk awk done --verbose sed $(pwd) done -eu
+printf test echo --verbose then then | readonly local test x=1 'quoted text'
+	export | export cd then awk /usr/bin && test done && 'quoted text'
+export test test 'quoted text' -eu
+	&& | 'quoted text' sed then 2>/dev/null | cd export
+	--verbose local --verbose 'quoted text' -eu done --verbose readonly awk export
+	printf printf $(pwd) --verbose | "$1" sed sed ${HOME} test export ${HOME} then
+		&& test --verbose x=1 &&
+	sed done ${HOME} export /usr/bin -eu x=1 'quoted text'
+		'quoted text' ${HOME} 2>/dev/null then --verbose export 'quoted text'
+		done done && ${HOME}
+	2>/dev/null "$1" 2>/dev/null done sed $(pwd) && "$@" sed "$@" echo 'quoted text'
+		grep echo ${HOME} x=1 test $(pwd) /usr/bin local
+	done /usr/bin done | sed readonly /usr/bin | then 2>/dev/null && readonly
+		| --verbose sed 2>/dev/null
+cd $(pwd) cd awk "$@" awk readonly
+	$(pwd) $(pwd) -eu then sed && readonly then /usr/bin
+&& then $(pwd) "$@" 'quoted text' --verbose done readonly echo grep
+awk $(pwd) "$1" done x=1 x=1 'quoted text' | /usr/bin sed /usr/bin 'quoted text'
+grep x=1 echo export grep $(pwd) readonly "$1" -eu
+		| then x=1 /usr/bin -eu echo
+		"$1" grep readonly local readonly local --verbose x=1 --verbose
+		awk x=1 ${HOME} test "$1" | local grep sed "$@" --verbose
+		export | | sed printf --verbose | awk "$1" /usr/bin test test readonly done
+		done "$1" sed sed export sed 2>/dev/null
+	test export ${HOME} /usr/bin -eu
+export -eu /usr/bin export awk x=1 --verbose
+		local "$@" | ${HOME} x=1 grep printf sed export export | awk
+2>/dev/null && then "$@" --verbose $(pwd) | "$@" then 2>/dev/null x=1 done
+		test readonly $(pwd) "$1" | && x=1 --verbose done local then 2>/dev/null
+		done ${HOME} 'quoted text' printf grep "$1" --verbose
+		export -eu "$@" echo printf /usr/bin awk
+	&& echo grep test 2>/dev/null 'quoted text' local ${HOME} "$1" &&
+	/usr/bin && then grep x=1 grep --verbose /usr/bin
+echo /usr/bin then /usr/bin /usr/bin -eu export
+		${HOME} --verbose --verbose test && readonly
+	grep readonly $(pwd) echo awk ${HOME} echo then readonly 'quoted text'
+		"$@" printf -eu grep && x=1 local sed sed --verbose
+x=1 -eu sed export -eu "$1" $(pwd) printf "$@" awk 'quoted text' 2>/dev/null
+		awk printf $(pwd) local awk ${HOME} readonly
+sed awk | --verbose printf cd 2>/dev/null test x=1 then
+	readonly readonly && echo cd awk && local "$1" -eu printf readonly "$1"
+	"$1" export $(pwd) $(pwd) && done cd /usr/bin ${HOME} --verbose 2>/dev/null
+		x=1 "$@" && then printf sed --verbose
+	then /usr/bin awk echo
+		cd ${HOME} sed -eu then --verbose readonly cd "$1" --verbose export -eu | "$@"
+	'quoted text' /usr/bin /usr/bin
+"$@" readonly grep local | local 2>/dev/null echo printf ${HOME} x=1 readonly
+		--verbose awk local readonly "$@" cd echo $(pwd)
+2>/dev/null local x=1 test
+	/usr/bin "$1" test && && test $(pwd) 'quoted text'
+		awk x=1 then --verbose cd test --verbose |
+	sed | grep cd printf && /usr/bin local printf
+		"$1" ${HOME} | sed x=1 ${HOME} sed sed awk -eu --verbose
+	/usr/bin -eu "$@" 2>/dev/null grep export printf then export x=1
+	| export 'quoted text' "$1" "$1" printf awk echo $(pwd) ${HOME}
+		$(pwd) $(pwd) /usr/bin && -eu
+	x=1 readonly x=1 then | && test done readonly grep awk ${HOME} export test test
+awk && then awk && sed cd 2>/dev/null
+		"$@" x=1 export --verbose local export then
+		then export && ${HOME} sed
+		/usr/bin echo local awk readonly ${HOME} test $(pwd) grep x=1 readonly
+grep local --verbose |
+done --verbose export --verbose
+--verbose --verbose "$1" | 'quoted text' -eu
+&& --verbose x=1 awk grep 'quoted text' && x=1 --verbose "$1" cd grep export done
+		2>/dev/null cd && cd then done x=1
+$(pwd) cd -eu "$@" grep cd "$1" grep "$1" readonly /usr/bin readonly
+		'quoted text' x=1 cd --verbose sed local 'quoted text' && && cd test /usr/bin
+		readonly export $(pwd) cd printf | "$@" "$1" then
+	"$1" echo test then && test 2>/dev/null printf then local local
+	'quoted text' sed sed readonly 'quoted text'
+		awk | grep --verbose --verbose x=1 x=1 'quoted text'
+--verbose awk awk then --verbose ${HOME} awk awk --verbose echo -eu export
+		awk "$1" cd grep local grep && 2>/dev/null readonly local
+&& done | 'quoted text' readonly ${HOME} test
+		${HOME} 2>/dev/null -eu "$@" --verbose "$1" local then done | --verbose
+2>/dev/null printf test x=1 cd awk awk &&
+		/usr/bin | 2>/dev/null | sed awk sed | cd done grep
+$(pwd) -eu "$1" $(pwd) -eu && 'quoted text' "$1" local awk cd ${HOME} | | "$1"
+	echo "$1" -eu grep $(pwd)
+printf done /usr/bin echo
+	cd | echo readonly 2>/dev/null $(pwd) $(pwd) 2>/dev/null
+/usr/bin cd -eu -eu export
+test printf echo awk export done printf printf grep readonly ${HOME} ${HOME} export
+export done then export "$1" 'quoted text'
+		awk 2>/dev/null awk $(pwd) 2>/dev/null readonly --verbose
+		"$@" echo && | readonly -eu --verbose local test done 2>/dev/null
+	test grep && && done | "$@" grep local "$1" test 'quoted text'
+		--verbose cd local && | && grep "$1" test printf | cd $(pwd)
+printf x=1 2>/dev/null awk "$1" -eu && "$@" 2>/dev/null --verbose
+cd readonly 2>/dev/null printf local -eu
+	--verbose && then then grep "$1" --verbose export grep "$1" export awk
+	/usr/bin "$1" --verbose cd test -eu then cd
+		/usr/bin x=1 test export local cd /usr/bin ${HOME}
+		--verbose cd grep echo && then 'quoted text' -eu export "$@" "$@" grep
+| /usr/bin "$1" grep 2>/dev/null local awk local "$@" done awk --verbose echo
+awk awk --verbose done 2>/dev/null 'quoted text'
+		-eu -eu 2>/dev/null export $(pwd) $(pwd) export $(pwd) export
+		done && echo && 2>/dev/null awk sed
+	-eu -eu export printf cd | -eu "$@" /usr/bin
+	readonly /usr/bin cd 2>/dev/null | export "$@"
+&& /usr/bin 'quoted text' /usr/bin $(pwd)
+'quoted text' "$1" --verbose done awk then 'quoted text' awk then printf ${HOME}
+		x=1 2>/dev/null --verbose
+test grep 2>/dev/null sed then sed /usr/bin $(pwd) "$@"
+		export $(pwd) done "$1" --verbose
+$(pwd) 'quoted text' --verbose cd /usr/bin x=1 export -eu | "$1" $(pwd)
+&& 'quoted text' 'quoted text' /usr/bin ${HOME} done $(pwd) x=1 2>/dev/null &&
+sed $(pwd) 2>/dev/null echo "$@" && printf $(pwd) $(pwd)
+		2>/dev/null /usr/bin $(pwd) cd x=1 | local | $(pwd) readonly export && then cd
+export awk done local export local && readonly export export $(pwd) $(pwd) x=1 echo
+		$(pwd) | --verbose --verbose "$1" ${HOME} local 'quoted text'
+		export sed export "$@" x=1 x=1 sed /usr/bin 2>/dev/null awk &&
+	done && $(pwd) export echo x=1
+		2>/dev/null local then grep 'quoted text' x=1 test 2>/dev/null printf echo
+	then "$@" /usr/bin test "$1" then /usr/bin export printf /usr/bin 2>/dev/null
+x=1 done printf 'quoted text' printf
+		'quoted text' 'quoted text' done && test readonly local 'quoted text' echo
+		then 2>/dev/null grep cd test 'quoted text'
+	"$1" test grep -eu "$1"
+'quoted text' export readonly
+	"$@" readonly printf "$@" --verbose sed 'quoted text' cd export
+		/usr/bin "$1" done /usr/bin "$@" --verbose /usr/bin
+	cd "$1" readonly | && ${HOME} --verbose cd 'quoted text'
+	/usr/bin /usr/bin -eu cd | x=1 "$@" sed /usr/bin && sed
+sed sed "$@" awk --verbose then /usr/bin
+	grep then echo /usr/bin | local "$1" grep grep printf echo echo 'quoted text' |
+		"$@" "$1" test | && local echo 'quoted text'
+sed "$@" test local then
+/usr/bin sed export readonly
+"$@" "$1" test echo grep | $(pwd) export sed cd cd $(pwd) --verbose
+		&& test $(pwd) readonly 2>/dev/null && echo awk then grep awk "$@"
+| cd "$1" ${HOME} done export awk awk /usr/bin "$@" 'quoted text' x=1 -eu
+	readonly 2>/dev/null $(pwd) sed printf 2>/dev/null readonly "$1"
+		echo x=1 x=1 | ${HOME} -eu test --verbose "$@" 'quoted text'
+		sed $(pwd) x=1 /usr/bin test && | export echo "$@" sed readonly
+		$(pwd) awk "$1" x=1 then
+cd grep && readonly local ${HOME} cd export && "$@"
+"$@" grep "$@" ${HOME} 2>/dev/null
+		"$1" printf x=1 done && /usr/bin sed printf local x=1 readonly
+		x=1 test 'quoted text' then "$@" && echo printf then | 2>/dev/null -eu echo "$1"
+		cd readonly | echo --verbose -eu cd ${HOME} 2>/dev/null printf echo "$@" test
+	done | "$1" --verbose "$1" -eu done x=1 /usr/bin printf && awk x=1
+	${HOME} grep 'quoted text' ${HOME} 2>/dev/null echo printf "$@" grep $(pwd)
+	${HOME} readonly -eu ${HOME} readonly readonly
+echo local ${HOME} $(pwd) export "$@" /usr/bin awk -eu then "$@" awk "$1"
+| done /usr/bin grep local 2>/dev/null "$1" x=1 export $(pwd) test
+then local -eu awk && /usr/bin /usr/bin test $(pwd) x=1 /usr/bin
+'quoted text' grep echo
+		then $(pwd) && 2>/dev/null echo sed && cd sed
+local awk then && 'quoted text' export
+		export export printf then awk | printf | export -eu grep awk echo "$@" echo
+		| | -eu -eu 'quoted text' | grep grep test "$1"
+		done export /usr/bin cd "$1" awk echo local
+		&& $(pwd) 2>/dev/null 2>/dev/null cd | local "$1"
+		"$@" --verbose /usr/bin && x=1 'quoted text' export && x=1 "$1" cd
+printf 2>/dev/null awk
+		sed then 'quoted text' $(pwd) awk | 2>/dev/null /usr/bin cd $(pwd) sed $(pwd) --verbose
+"$@" export cd -eu "$1" printf cd 'quoted text' && awk
+"$1" x=1 export x=1 && "$@" && 2>/dev/null then 'quoted text'
+	export "$1" $(pwd) export local grep x=1 readonly && readonly x=1 test sed
+/usr/bin echo -eu export sed && "$@" ${HOME} $(pwd) readonly
+	--verbose 'quoted text' ${HOME} | ${HOME} sed printf
+test awk grep printf 'quoted text' done
+	cd x=1 'quoted text' grep local local x=1 cd printf "$1" "$1"
+	grep /usr/bin sed -eu && grep awk export 2>/dev/null 'quoted text'
+		local grep awk 'quoted text' | test cd x=1 ${HOME} "$@"
+		2>/dev/null local then test x=1
+grep then echo ${HOME} /usr/bin --verbose
+	export | sed export 'quoted text' --verbose /usr/bin local readonly 2>/dev/null
+		cd 'quoted text' --verbose done printf cd /usr/bin x=1 'quoted text'
+'quoted text' x=1 "$@" "$@"
+		local --verbose --verbose x=1 "$1" export --verbose
+	$(pwd) sed -eu grep 2>/dev/null | |
+		&& --verbose then | export cd then --verbose
+	cd -eu cd --verbose done readonly done echo
+		/usr/bin && --verbose export grep
+		cd local -eu 2>/dev/null | readonly | printf $(pwd) "$1" local
+/usr/bin done local $(pwd) printf export && 'quoted text' grep printf echo -eu
+	/usr/bin --verbose test done export done /usr/bin
+awk local local done x=1 cd "$1" done readonly -eu readonly
+	cd local -eu grep done grep 'quoted text' -eu --verbose then test echo
+		&& /usr/bin | | x=1 2>/dev/null --verbose "$@" echo local sed 'quoted text'
+-eu cd echo $(pwd) 'quoted text' sed -eu cd export printf 'quoted text' x=1 local
+grep grep | /usr/bin printf 'quoted text' done -eu --verbose printf awk
+		x=1 "$@" ${HOME} --verbose --verbose 2>/dev/null
+"$1" awk 'quoted text' readonly
+	2>/dev/null "$1" && ${HOME} x=1 test then
+echo x=1 ${HOME} awk $(pwd) --verbose printf --verbose done && awk test x=1 "$@"
+	&& "$1" /usr/bin export && cd x=1 done then cd test -eu echo | ${HOME} readonly
+echo then | /usr/bin then | 2>/dev/null
+readonly -eu x=1 ${HOME} echo export && local export export then $(pwd) 2>/dev/null
+		"$1" test readonly local readonly
+'quoted text' "$1" test
+	${HOME} local then echo grep ${HOME} "$1" local
+	$(pwd) | | ${HOME} ${HOME} sed x=1 done awk readonly
+	then test /usr/bin export echo printf readonly
+		--verbose test sed export --verbose --verbose cd 'quoted text'
+		2>/dev/null "$@" test
+		"$1" | && echo then readonly sed && done
+&& echo /usr/bin 2>/dev/null local ${HOME} --verbose /usr/bin readonly /usr/bin
+		"$1" | sed ${HOME} "$@" sed local export $(pwd) 'quoted text'
+	awk && done --verbose 'quoted text' --verbose awk -eu --verbose
+		"$1" x=1 test export 'quoted text' local readonly then "$1" printf echo | grep
+	local grep grep -eu readonly --verbose ${HOME}
+		awk && then ${HOME} "$@" && then readonly
+		readonly -eu then done awk cd export /usr/bin 'quoted text'
+		'quoted text' then ${HOME} "$1" export awk x=1 /usr/bin
+	sed then cd awk 'quoted text' export test grep "$1" 2>/dev/null
+		${HOME} ${HOME} sed && --verbose "$1" export 'quoted text'
+		| 2>/dev/null done ${HOME} /usr/bin local
+		cd $(pwd) local $(pwd) &&
+	&& test then local export
+done sed test -eu test --verbose test ${HOME} && | then x=1
+		test sed 'quoted text' && "$@" ${HOME} done cd done done 'quoted text' --verbose
+		2>/dev/null sed local local cd printf "$1" ${HOME} sed
+	local sed 'quoted text' /usr/bin
+local local awk | grep done sed done test
+	2>/dev/null | $(pwd) then 'quoted text' --verbose cd
+	2>/dev/null awk export export echo done then /usr/bin done -eu echo printf
+export local printf printf | readonly then && readonly cd cd then 'quoted text'
+grep x=1 'quoted text' then echo 2>/dev/null echo | x=1 printf
+	$(pwd) grep && local export export ${HOME} sed then /usr/bin done ${HOME}
+| "$1" /usr/bin local cd cd
+	2>/dev/null printf /usr/bin ${HOME} sed $(pwd)
+		then done "$@" ${HOME} done echo
+	/usr/bin test /usr/bin -eu done --verbose 'quoted text' ${HOME} readonly
+		'quoted text' -eu export 'quoted text' done && -eu x=1 --verbose
+	/usr/bin "$1" $(pwd) x=1 ${HOME}
+		"$@" awk done sed cd grep ${HOME} $(pwd) readonly ${HOME} awk | $(pwd) && cd
+	${HOME} done grep ${HOME} grep grep && $(pwd) readonly
+		echo -eu export grep | "$@" ${HOME}
+	"$1" test && sed /usr/bin test "$@" "$1" $(pwd) echo 2>/dev/null
+		--verbose --verbose | then && "$1" x=1 | "$@" export
+		${HOME} | echo 2>/dev/null echo grep test readonly cd "$@" test echo export
+"$1" --verbose then ${HOME} then test && test readonly test "$1" -eu "$1" && printf
+done printf test $(pwd) printf ${HOME} $(pwd) -eu printf
+--verbose test ${HOME} $(pwd) "$@" 'quoted text' local $(pwd) test cd cd test /usr/bin
+	${HOME} | then | | echo 2>/dev/null ${HOME} --verbose echo $(pwd) x=1 $(pwd)
+awk then 2>/dev/null echo
+"$@" ${HOME} && /usr/bin -eu --verbose
+		local test && ${HOME} sed && "$1" then readonly
+	grep "$@" | | && "$1" cd &&
+printf sed export "$1" /usr/bin "$1" then "$@" test $(pwd)
+	| ${HOME} readonly local "$@" then x=1 'quoted text' -eu echo -eu
+	${HOME} "$@" x=1 local --verbose printf printf cd ${HOME} $(pwd)
+	$(pwd) && awk readonly printf && $(pwd) && then ${HOME} | 'quoted text'
+		| cd | --verbose printf then test 'quoted text' "$1" export "$@" "$@"
+		grep "$@" "$@" grep --verbose
+		echo cd | awk test local x=1 test export printf
+then local done -eu "$1" readonly readonly echo $(pwd)
+	then 2>/dev/null | grep printf test
+	${HOME} then --verbose local export awk && cd then "$@"
+/usr/bin "$@" then 'quoted text' && cd | export echo grep 'quoted text'
+grep sed printf --verbose done done grep printf --verbose
+		-eu /usr/bin echo /usr/bin | --verbose -eu "$1" "$1" printf echo $(pwd) test
+	cd ${HOME} local | done $(pwd) 2>/dev/null
+		printf printf printf grep then /usr/bin
+	then "$@" readonly then x=1 'quoted text' ${HOME} /usr/bin 2>/dev/null
+printf 2>/dev/null --verbose
+	2>/dev/null export printf "$1" && -eu cd export grep printf && readonly
+		&& export "$1" x=1 "$1" test sed then printf x=1 done sed /usr/bin
+		/usr/bin sed awk done printf export 2>/dev/null printf ${HOME} &&
+	echo x=1 ${HOME} -eu x=1 printf
+'quoted text' printf awk 2>/dev/null
+		$(pwd) printf && export 'quoted text' /usr/bin printf test test cd 'quoted text'
+$(pwd) test then -eu local awk export $(pwd) test local /usr/bin
+		export echo x=1 ${HOME} readonly --verbose printf then
+	done $(pwd) && test -eu done printf "$@"
+/usr/bin "$1" && then 2>/dev/null
+${HOME} local $(pwd) readonly grep x=1 "$1" echo $(pwd) $(pwd)
+	&& done ${HOME} awk | awk
+printf | -eu then /usr/bin 2>/dev/null local "$1" printf
+		| $(pwd) grep ${HOME} 2>/dev/null awk 2>/dev/null then test export --verbose &&
+		/usr/bin ${HOME} x=1 sed && -eu then "$1" ${HOME} test
+		readonly then then 2>/dev/null
+&& -eu cd awk then ${HOME} --verbose -eu && && ${HOME}
+	/usr/bin printf export "$1" "$1" done "$@" then "$@" && cd done test awk
+	then awk sed -eu echo "$1" && grep sed $(pwd) /usr/bin readonly
+	local "$1" --verbose local sed export -eu export ${HOME} | ${HOME} "$1"
+		&& -eu ${HOME} readonly "$@" /usr/bin done done x=1 | ${HOME} awk cd then local
+	grep /usr/bin "$@" cd -eu && "$@" 2>/dev/null "$1" $(pwd) /usr/bin x=1
+	test test local "$@" "$@" awk
+		${HOME} "$@" -eu grep printf cd --verbose | 2>/dev/null
+done | printf 'quoted text' export -eu "$1" "$@" local 2>/dev/null
+done --verbose echo "$1" "$1" -eu then | local 'quoted text'
+		grep sed export /usr/bin local && 'quoted text' /usr/bin export
+${HOME} -eu then $(pwd) done "$1" then cd x=1 local echo /usr/bin
+		readonly local then | readonly local then
+"$1" sed grep && $(pwd) && &&
+	printf then "$@" "$@" export x=1 $(pwd)
+'quoted text' readonly
+"$@" x=1 printf sed --verbose
+printf local | -eu done -eu cd printf printf && $(pwd) done /usr/bin 'quoted text'
+	test "$1" 'quoted text' awk grep && grep -eu done
+		/usr/bin ${HOME} grep 'quoted text' grep
+		cd echo export printf 2>/dev/null cd printf |
+		--verbose ${HOME} readonly ${HOME}
+	-eu then ${HOME} done test --verbose | test && cd x=1 --verbose
+local x=1 sed local awk ${HOME} echo echo 2>/dev/null "$@" x=1 "$@" local /usr/bin
+		${HOME} ${HOME} readonly local "$@" $(pwd) cd /usr/bin awk "$@" $(pwd) -eu 2>/dev/null
+		test "$@" /usr/bin test 'quoted text'
+/usr/bin && 'quoted text' then done --verbose /usr/bin | readonly x=1 -eu readonly
+	'quoted text' ${HOME} cd -eu x=1 then export && export readonly sed "$1"
+		awk -eu echo 2>/dev/null awk test && echo --verbose test 'quoted text' local
+	'quoted text' then cd cd awk ${HOME} done printf awk then sed /usr/bin then
+${HOME} | sed "$1" done readonly
+	2>/dev/null then x=1 'quoted text' then then
+x=1 echo /usr/bin test local then --verbose readonly
+x=1 awk --verbose | then
+		&& "$@" local "$1" "$1" printf $(pwd) x=1 $(pwd) -eu test ${HOME} $(pwd)
+	echo ${HOME} "$@" printf $(pwd) /usr/bin -eu then && local grep
+		2>/dev/null grep grep local awk test grep /usr/bin cd --verbose
+	printf 'quoted text' readonly
+		-eu printf done sed x=1 local test /usr/bin | ${HOME} 2>/dev/null export ${HOME}
+	2>/dev/null local $(pwd) && local readonly done ${HOME} /usr/bin readonly grep ${HOME}
+readonly /usr/bin -eu printf
+		--verbose $(pwd) cd printf
+2>/dev/null echo cd sed awk --verbose then ${HOME} "$1" local
+	test awk x=1 "$@" 'quoted text' /usr/bin test 2>/dev/null echo done awk
+		sed grep sed export grep 2>/dev/null cd 'quoted text' sed echo test readonly
+$(pwd) echo grep echo sed && done awk | /usr/bin
+cd ${HOME} done grep printf grep $(pwd) grep "$@"
+x=1 printf ${HOME} local && test -eu cd printf && then "$1"
+x=1 echo x=1 "$1" $(pwd) test sed
+	readonly printf grep cd printf | local
+	--verbose --verbose echo printf 2>/dev/null
+	readonly 'quoted text' && 2>/dev/null awk readonly cd then done |
+"$1" grep printf echo test awk x=1 test
+		then then test printf awk test "$1" grep
+export readonly "$@" ${HOME} echo "$1" | awk | -eu grep awk cd 2>/dev/null echo
+		-eu readonly 'quoted text' ${HOME} "$@"
+$(pwd) ${HOME} printf && && echo
+	"$1" awk local --verbose "$@"
+		"$1" test export cd "$1" echo && -eu sed cd | done echo 2>/dev/null
+		$(pwd) && | readonly ${HOME} 'quoted text'
+x=1 sed -eu | ${HOME} && awk then cd ${HOME} -eu
+	export && cd printf awk cd then export 2>/dev/null
+		test /usr/bin local x=1 local /usr/bin "$@" export --verbose
+		${HOME} -eu x=1 --verbose done --verbose readonly cd x=1 local test -eu -eu $(pwd)
+	then cd $(pwd) then 'quoted text'
+	'quoted text' "$1" | echo readonly /usr/bin awk x=1 grep ${HOME}
+done readonly then test export -eu readonly
+	2>/dev/null echo ${HOME} | local --verbose readonly | echo ${HOME} "$1"
+	sed printf done readonly $(pwd) | 'quoted text' grep 2>/dev/null local
+local | /usr/bin 2>/dev/null awk cd 2>/dev/null done && sed
+		$(pwd) awk then /usr/bin "$1" 2>/dev/null printf 'quoted text' && && export
+-eu sed "$1" grep test local /usr/bin 'quoted text'
+readonly test "$1" local ${HOME} export readonly ${HOME}
+	--verbose -eu awk --verbose x=1 test test done export --verbose "$@" ${HOME}
+awk --verbose then awk ${HOME}
+	echo x=1 'quoted text' export readonly export readonly export 'quoted text'
+done done export "$1" echo x=1
+	$(pwd) "$1" sed local test grep /usr/bin "$@" --verbose
+		grep echo test grep echo then ${HOME} done "$@" then | x=1 then 2>/dev/null
+		local then local test /usr/bin cd awk awk printf "$@" sed
+	$(pwd) export grep local echo test grep "$1" "$1" && sed /usr/bin
+	${HOME} $(pwd) && "$1" then done
+		| x=1 "$1" echo | echo | readonly x=1 /usr/bin cd printf
+grep grep /usr/bin /usr/bin sed export "$1" then
+$(pwd) "$@" echo | awk
+	test cd grep -eu ${HOME}
+&& readonly && awk $(pwd) cd 2>/dev/null sed echo --verbose
+		test x=1 grep /usr/bin /usr/bin
+	test -eu -eu done printf && done sed | ${HOME}
+	${HOME} awk "$@" grep x=1
+		echo -eu echo "$1" -eu -eu $(pwd) sed echo local readonly
+		| cd then | /usr/bin /usr/bin
+done then /usr/bin export printf x=1 "$@" 2>/dev/null
+printf awk awk "$1" awk "$1" x=1 readonly
+	2>/dev/null done printf local test
+"$1" then "$1" sed --verbose --verbose
+		-eu readonly x=1 -eu | "$1" /usr/bin sed printf
+		"$1" 'quoted text' echo 'quoted text' sed echo grep ${HOME}
+"$@" cd cd done x=1 -eu export test sed | awk done /usr/bin $(pwd) export grep
+	| ${HOME} printf done echo 2>/dev/null x=1 "$1" | cd
+	2>/dev/null sed echo grep cd sed local "$1" done test awk x=1 awk | test | sed readonly
+		${HOME} 2>/dev/null awk cd $(pwd) sed local printf $(pwd) --verbose
+-eu done ${HOME} local "$@" /usr/bin sed done
+echo then test "$1" done --verbose
+	done test then 2>/dev/null readonly local
+		awk local 'quoted text' "$1" awk 'quoted text' "$@" echo
+echo sed --verbose awk then $(pwd) cd done test cd sed 2>/dev/null
+done then readonly -eu $(pwd) export "$1" readonly "$1" sed done printf
+		--verbose 2>/dev/null done echo 'quoted text' "$1" awk 'quoted text'
+/usr/bin | printf readonly sed test grep grep "$@" | export awk local 2>/dev/null
+	"$@" /usr/bin test awk printf && /usr/bin printf cd 'quoted text'
+		local | x=1 | -eu printf grep x=1 export -eu -eu awk /usr/bin
+	grep | 'quoted text' "$1" x=1 test cd $(pwd) /usr/bin
+$(pwd) echo printf x=1 $(pwd) --verbose test echo "$@" "$1"
+		--verbose --verbose done /usr/bin "$@" done && then
+local awk "$@" 2>/dev/null awk cd
+	awk printf done cd --verbose --verbose readonly
+		printf /usr/bin x=1 | echo -eu done echo
+		/usr/bin grep x=1 "$1" && "$@" readonly "$1" ${HOME} ${HOME} test test
+x=1 grep then && /usr/bin --verbose x=1 $(pwd) readonly
+test "$@" grep --verbose sed echo cd
+	then x=1 printf printf grep then readonly $(pwd)
+		echo grep ${HOME} "$@" done printf | /usr/bin 'quoted text' ${HOME} "$1"
+	export | && awk x=1 test 'quoted text' && 'quoted text' "$1" local x=1 done echo
+		/usr/bin cd ${HOME} "$1" printf --verbose printf "$@" -eu
+		x=1 cd echo cd done cd /usr/bin /usr/bin test export
+--verbose local "$1" ${HOME} ${HOME} export local readonly 2>/dev/null readonly
+"$@" | "$@" cd sed ${HOME}
+	x=1 printf /usr/bin 2>/dev/null -eu readonly printf $(pwd)
+	echo --verbose "$@" -eu test "$1" -eu
+"$@" test $(pwd) x=1 --verbose readonly
+		/usr/bin x=1 printf --verbose
+		| awk /usr/bin 'quoted text' done | export 2>/dev/null $(pwd) echo
+then printf "$1" readonly "$1" export export local done local --verbose
+local local printf x=1 printf 'quoted text' x=1 | "$1" "$1"
+		"$1" echo | done test cd cd local export "$@"
+echo done --verbose test
+		local then test | /usr/bin grep
+		readonly sed --verbose
+sed printf cd done /usr/bin && readonly test 'quoted text' sed x=1 'quoted text'
+		${HOME} sed --verbose -eu
+		/usr/bin && grep && /usr/bin export ${HOME} "$@" then --verbose readonly "$@"
+		2>/dev/null /usr/bin 2>/dev/null | then printf --verbose
+	echo test printf | |
+	-eu | sed test "$@" "$1" sed | "$@" readonly readonly
+	export && "$1" done | "$@" awk then -eu && $(pwd) then
+--verbose ${HOME} --verbose local && x=1 && "$1" 'quoted text'
+		printf test -eu 2>/dev/null 'quoted text'
+/usr/bin | export cd sed done local test -eu grep
+	sed local | cd cd readonly done
+| -eu done && 'quoted text' x=1 /usr/bin /usr/bin then
+${HOME} readonly cd done
+	| | -eu "$1" readonly $(pwd) readonly --verbose
+		&& --verbose $(pwd) test printf --verbose | local awk grep 'quoted text'
+		2>/dev/null 'quoted text' then readonly test /usr/bin echo
+	done && | x=1 x=1 then 2>/dev/null
+	awk | export sed $(pwd) $(pwd) readonly ${HOME} --verbose
+&& then -eu | 2>/dev/null --verbose awk --verbose awk x=1 done $(pwd) readonly
+		$(pwd) sed printf printf
+"$@" awk cd readonly 'quoted text' 2>/dev/null
+	cd 'quoted text' test && export printf
+	${HOME} then awk "$@" /usr/bin echo -eu -eu 'quoted text' awk test cd sed
+		then "$@" readonly readonly 2>/dev/null export printf
+		echo --verbose echo x=1 printf 'quoted text'
+	done test ${HOME} then --verbose /usr/bin 'quoted text' /usr/bin "$@" /usr/bin
+		export "$1" 2>/dev/null awk x=1 2>/dev/null echo done done grep
+'quoted text' sed then "$@"
+	awk local local test printf
+'quoted text' -eu echo | -eu cd "$1" cd local 2>/dev/null ${HOME}
+then --verbose /usr/bin export | 'quoted text' --verbose awk --verbose
+		&& done sed test 2>/dev/null cd
+	&& echo sed "$@" cd printf
+cd x=1 "$@" -eu printf "$1" -eu echo
+		export "$@" | cd && cd x=1
+cd /usr/bin "$1" 'quoted text'
+	--verbose ${HOME} local sed 'quoted text' /usr/bin $(pwd) 'quoted text' /usr/bin
+	$(pwd) local then then --verbose then
+		test echo printf awk x=1 done then ${HOME} local -eu $(pwd) printf readonly
+"$@" | --verbose done local sed x=1 --verbose
+		| x=1 done x=1 printf echo x=1 2>/dev/null
+	awk local ${HOME} then /usr/bin cd local 2>/dev/null --verbose echo
+		&& 'quoted text' cd x=1 "$@" readonly awk
+		printf cd "$1" 'quoted text' grep export echo | "$1" x=1 -eu /usr/bin awk 'quoted text'
+echo local | export export
+		$(pwd) test | && $(pwd) echo -eu --verbose | --verbose local 'quoted text'
+		"$1" done x=1 echo x=1 grep ${HOME}
+		x=1 /usr/bin echo /usr/bin echo ${HOME} "$1" $(pwd) test
+		--verbose awk | "$@" readonly
+	test echo && test local done -eu grep -eu done test ${HOME} "$1" sed readonly
+done -eu 'quoted text' 'quoted text' /usr/bin "$1" | | "$@"
+-eu echo 2>/dev/null export ${HOME}
+"$@" 2>/dev/null then awk local awk x=1 "$@" readonly echo echo
+		--verbose -eu | local --verbose echo | printf &&
+	"$1" ${HOME} grep printf "$@" ${HOME} "$1"
+"$1" readonly printf echo test --verbose printf $(pwd) --verbose
+		sed 'quoted text' test x=1 local test sed echo --verbose 'quoted text' ${HOME}
+	printf export sed echo x=1 ${HOME} -eu readonly then done
+	-eu awk /usr/bin x=1 --verbose $(pwd) local grep then readonly grep echo
+	test sed then grep grep "$1" echo test $(pwd) "$1" --verbose && x=1 /usr/bin
+		done done local "$1" cd cd ${HOME} echo sed cd then done 'quoted text'
+		--verbose /usr/bin done echo 2>/dev/null readonly
+	&& sed then echo x=1 -eu 2>/dev/null 'quoted text' export
+	echo $(pwd) "$1" cd 'quoted text' "$@" echo 'quoted text' printf "$1" |
+	"$@" "$@" 'quoted text' export ${HOME} then "$@" x=1
+	printf local -eu test export "$1" x=1 -eu --verbose then export
+	--verbose done $(pwd) /usr/bin | grep -eu then /usr/bin
+	-eu awk && | readonly readonly 2>/dev/null
+readonly -eu 2>/dev/null --verbose export
+done "$1" "$@" "$@" echo -eu grep then sed cd && && && export grep x=1 cd local
+| printf ${HOME} export -eu sed --verbose x=1 ${HOME} done x=1 $(pwd)
+		echo grep && awk && printf readonly --verbose -eu echo printf
+export awk "$@" "$@" echo sed done awk --verbose
+$(pwd) 'quoted text' test $(pwd) test done sed $(pwd) then
+		/usr/bin "$@" "$@" /usr/bin done awk "$1" awk printf -eu | x=1
+	done grep cd -eu x=1 awk x=1 "$1" 2>/dev/null | && done -eu done echo | &&
+		printf then /usr/bin then x=1 --verbose "$1" /usr/bin --verbose
+/usr/bin /usr/bin && -eu | "$1" test 'quoted text' /usr/bin printf "$1" "$@" local
+	| grep x=1 ${HOME} readonly printf 'quoted text' 'quoted text'
+'quoted text' | && local | $(pwd)
+		done local awk grep grep sed /usr/bin ${HOME} readonly --verbose cd
+"$@" export 2>/dev/null sed 2>/dev/null $(pwd) 2>/dev/null test /usr/bin cd /usr/bin
+	printf 'quoted text' done cd x=1 | | --verbose readonly done "$@" /usr/bin then
+		$(pwd) printf && -eu local x=1 --verbose
+	-eu cd x=1 "$1" | -eu "$@" echo $(pwd) cd printf done printf printf
+sed | ${HOME} export && sed /usr/bin done test 2>/dev/null export
+		x=1 export sed done 2>/dev/null readonly
+		done --verbose test echo 'quoted text' echo | --verbose -eu then && then
+	sed done x=1 grep cd 'quoted text' 2>/dev/null
+	export "$1" readonly $(pwd) awk ${HOME} export readonly 'quoted text' grep
+then cd "$1" sed "$@" test 2>/dev/null echo 'quoted text' grep export
+		&& -eu ${HOME} 2>/dev/null local 2>/dev/null | local cd -eu x=1 -eu local grep
+--verbose | then then done /usr/bin cd
+		grep && -eu 'quoted text' echo echo local then | cd done && /usr/bin echo awk 2>/dev/null
+	| grep sed export local && 'quoted text' done export ${HOME}
+		$(pwd) printf 'quoted text' awk sed test -eu 'quoted text'
+awk -eu /usr/bin ${HOME} echo grep 2>/dev/null done x=1 "$@" $(pwd) /usr/bin ${HOME}
+export export grep "$@" cd export x=1 local /usr/bin "$1" ${HOME} test
+		then -eu && echo export cd | grep local test 'quoted text' export "$1"
+2>/dev/null 'quoted text' --verbose awk export
+x=1 $(pwd) test 'quoted text' readonly readonly -eu
+${HOME} test grep echo test awk awk 'quoted text'
+'quoted text' 2>/dev/null | done --verbose readonly grep "$@"
+	readonly printf awk then 2>/dev/null echo --verbose grep x=1 echo
+sed -eu done echo done $(pwd) x=1 cd awk /usr/bin sed done $(pwd) printf
+		test grep done ${HOME} readonly
+local done "$@" printf local x=1 "$1" $(pwd) $(pwd) test grep -eu then
+'quoted text' test grep printf "$@"
+	test local echo readonly local $(pwd) && ${HOME} sed ${HOME} --verbose
+readonly sed && sed x=1 "$@" grep --verbose readonly grep
+/usr/bin awk local printf awk test cd then echo readonly
+	| "$1" echo && ${HOME} readonly 'quoted text' 'quoted text' cd
+		awk | test x=1 /usr/bin grep done sed ${HOME} x=1 cd x=1 sed | /usr/bin && awk
+	${HOME} cd echo then readonly cd $(pwd) then 2>/dev/null /usr/bin 2>/dev/null
+'quoted text' done cd awk sed cd printf echo "$1"
+	"$@" sed then local readonly 2>/dev/null grep done ${HOME}
+	&& -eu x=1 then 2>/dev/null ${HOME} "$@" export test 2>/dev/null |
+	$(pwd) readonly x=1 test
+	/usr/bin readonly $(pwd) $(pwd) 2>/dev/null readonly export
+		grep $(pwd) /usr/bin sed printf "$@" -eu && export --verbose
+test test $(pwd) x=1 export export
+		echo -eu done echo then local "$1" done ${HOME} test
+		"$@" test x=1 export
+grep 2>/dev/null export test done x=1 cd awk "$@"
+local test 2>/dev/null readonly grep "$1" sed "$@" | echo export ${HOME}
+awk --verbose ${HOME} && x=1 /usr/bin 2>/dev/null
+	| -eu printf $(pwd) export done ${HOME} | /usr/bin then export /usr/bin
+		&& cd $(pwd) then 'quoted text' x=1 && sed "$@" /usr/bin --verbose
+		x=1 test printf "$1" local | readonly cd awk -eu && 'quoted text'
+	export --verbose printf 'quoted text'
+		&& "$1" awk "$@" "$@" 2>/dev/null 'quoted text'
+-eu -eu x=1 /usr/bin | printf
+	sed | | grep "$1" /usr/bin
+		-eu --verbose --verbose readonly test local readonly cd -eu cd then
+		$(pwd) "$@" && export ${HOME}
+	"$@" "$@" "$1" --verbose echo "$1" $(pwd) printf "$@" grep x=1
+	x=1 /usr/bin echo $(pwd)
+		"$1" && local awk readonly "$1" -eu echo then
+/usr/bin /usr/bin $(pwd) then /usr/bin local local cd sed
+	--verbose cd export | echo 'quoted text' cd local x=1 local x=1 echo
+		| grep test cd export cd 2>/dev/null local readonly 2>/dev/null | 'quoted text'
+	echo && local x=1 ${HOME}
+		export /usr/bin local ${HOME} awk cd readonly ${HOME} awk cd
+awk printf -eu local --verbose test "$1" then readonly ${HOME} cd
+	"$1" done -eu test readonly readonly then then "$1" export cd
+		-eu -eu local ${HOME} printf
+${HOME} cd then 'quoted text' 'quoted text' echo readonly
+echo $(pwd) echo sed awk "$@" awk && 'quoted text' ${HOME} then "$1" && --verbose
+	'quoted text' printf awk done 2>/dev/null ${HOME} && test
+		${HOME} --verbose && grep $(pwd) grep | /usr/bin awk --verbose
+	printf cd $(pwd) /usr/bin grep local && printf echo echo | cd x=1
+	awk printf printf then | x=1 /usr/bin test ${HOME} test echo printf "$@"
+	--verbose ${HOME} 2>/dev/null grep grep printf -eu x=1 awk
+	grep printf "$1" echo awk $(pwd) x=1 $(pwd)
+	/usr/bin test then ${HOME} local
+	awk 2>/dev/null /usr/bin grep echo test /usr/bin done local $(pwd)
+	test local done local x=1 "$@" local local 'quoted text' "$@" -eu cd export
+export "$@" grep readonly awk 'quoted text' local echo "$1" 2>/dev/null
+		readonly printf -eu 2>/dev/null then cd 'quoted text' echo test -eu &&
+/usr/bin test --verbose ${HOME} export -eu
+sed --verbose ${HOME} printf /usr/bin && "$1"
+2>/dev/null 2>/dev/null awk /usr/bin grep "$1" grep done local echo /usr/bin
+"$1" $(pwd) -eu echo printf "$1" | echo "$@" "$@" $(pwd)
+local done 'quoted text' printf "$@" x=1 | ${HOME} 'quoted text'
+		cd then 'quoted text' then | ${HOME} printf sed x=1 then --verbose -eu done
+then export ${HOME} 'quoted text' && echo --verbose
+grep ${HOME} sed done then sed grep cd local "$@" echo awk
+	"$@" 2>/dev/null "$@"
+done test ${HOME} grep ${HOME}
+		local ${HOME} x=1 local test -eu | local "$1" test "$@" -eu awk then
+	"$1" sed readonly export cd done "$@" -eu grep $(pwd) $(pwd)
+		test x=1 echo then ${HOME} $(pwd) $(pwd)
+/usr/bin /usr/bin grep -eu && -eu local readonly
+	sed 'quoted text' echo printf
+readonly grep echo && $(pwd) $(pwd)
+		grep "$1" awk && done | awk then "$@" $(pwd) -eu "$1" /usr/bin $(pwd) sed
+		| "$@" export awk then readonly then --verbose 'quoted text'
+cd x=1 sed x=1 echo ${HOME} then test test printf done ${HOME}
+	export awk 2>/dev/null sed /usr/bin
+	sed done done "$1" --verbose -eu then export grep local test x=1 -eu
+		"$1" readonly x=1 local /usr/bin | awk sed 'quoted text' --verbose
+	2>/dev/null then "$1" "$@" test 2>/dev/null -eu awk 'quoted text'
+	"$1" 'quoted text' && /usr/bin x=1 x=1 then test test x=1 /usr/bin
+	cd done awk cd | cd "$1" cd "$@" && x=1 awk ${HOME}
+		"$@" export readonly 'quoted text' cd && test
+		2>/dev/null readonly readonly --verbose test readonly && 2>/dev/null
+echo readonly -eu --verbose x=1 ${HOME} 2>/dev/null --verbose test 'quoted text'
+		| /usr/bin readonly $(pwd) printf local done ${HOME} readonly
+		grep "$1" /usr/bin ${HOME} test "$1" echo sed && /usr/bin "$@" "$1" sed then
+		done local test "$1" then -eu 2>/dev/null | "$@" 'quoted text' 2>/dev/null
+		cd done local cd cd test local local /usr/bin grep /usr/bin
+	printf | cd awk --verbose sed && --verbose test cd cd -eu
+#include c141.sh
+export cd test && export x=1 awk echo cd awk done "$1"
+	grep 2>/dev/null "$1" printf | 2>/dev/null printf /usr/bin
+		--verbose printf sed local done
+sed export grep x=1 printf x=1
+		-eu "$1" && done readonly readonly done test
+	readonly then echo 2>/dev/null $(pwd) done
+	echo done local cd readonly export cd done printf 'quoted text' awk test grep
+		| --verbose cd awk "$@" test readonly $(pwd) sed
+grep printf | | local done done awk done --verbose
+	export sed grep readonly ${HOME} then
+	2>/dev/null done printf test export 'quoted text' ${HOME} "$@" --verbose echo printf
+		grep ${HOME} awk printf export x=1 /usr/bin cd test && 'quoted text'
+		cd awk /usr/bin && echo 'quoted text' done $(pwd)
+		test "$@" echo printf cd "$@" | "$1" cd --verbose $(pwd)
+		'quoted text' test 'quoted text' 'quoted text'
+		local -eu cd sed && printf "$1" then 2>/dev/null
+&& && "$1" ${HOME} -eu echo "$@" sed echo grep
+	test /usr/bin /usr/bin "$@" echo x=1
+	local export | test printf --verbose readonly
+		"$1" readonly x=1 sed | && sed && then printf -eu && "$@" "$@" echo done local x=1
+	"$1" grep -eu $(pwd) |
+then done --verbose x=1 then $(pwd) -eu 2>/dev/null then cd && then x=1 --verbose
+"$1" done printf && export 'quoted text' local
+	printf grep export done test /usr/bin "$@" "$@" echo test 'quoted text'
+export cd /usr/bin &&
+test "$@" grep -eu | "$1" readonly export --verbose
+done --verbose 'quoted text' 'quoted text' then --verbose "$1" 2>/dev/null sed echo
+	x=1 && --verbose $(pwd) then echo "$@" grep ${HOME}
+		$(pwd) x=1 awk -eu "$1" | && "$@" --verbose test | cd done 'quoted text'
+printf printf 'quoted text' export
+done readonly cd -eu done grep test -eu --verbose
+	${HOME} grep && "$1" then
+	x=1 "$@" x=1 local "$@" | ${HOME} test done echo echo done 'quoted text'
+		export ${HOME} x=1 "$@" --verbose --verbose printf test ${HOME}
+done done && --verbose ${HOME}
+	test local "$1" $(pwd) done "$@" printf 'quoted text'
+"$1" "$@" local local 2>/dev/null readonly
+	/usr/bin $(pwd) && /usr/bin x=1 done then $(pwd)
+		| 2>/dev/null echo then local sed 'quoted text' 'quoted text'
+		printf x=1 export printf $(pwd) awk | | echo /usr/bin -eu "$@"
+&& done sed ${HOME} && x=1 "$1"
+	printf grep grep grep local readonly echo readonly
+	| --verbose 2>/dev/null printf printf /usr/bin $(pwd) 2>/dev/null && ${HOME}
+		$(pwd) test cd "$@" 'quoted text' echo
+	done 'quoted text' 2>/dev/null local then 'quoted text' done local
+		| done "$@" cd export | then "$@"
+/usr/bin "$@" local /usr/bin done echo then --verbose
+printf local "$@" export local 'quoted text' then $(pwd) /usr/bin done --verbose
+		| grep 'quoted text' done x=1 awk
+		2>/dev/null echo 2>/dev/null printf grep export readonly
+	/usr/bin 2>/dev/null grep printf && ${HOME} ${HOME} sed test "$@" echo printf
+	readonly && 2>/dev/null 2>/dev/null sed "$1" grep --verbose
+	/usr/bin then | | 2>/dev/null echo "$@" awk cd
+grep sed && then awk echo "$1" echo then --verbose local "$1" done $(pwd) ${HOME}
+		printf /usr/bin && --verbose
+	$(pwd) $(pwd) then -eu "$1" && "$@" echo
+	readonly -eu /usr/bin readonly awk readonly export $(pwd) done x=1 readonly
+		echo -eu --verbose ${HOME} cd $(pwd) ${HOME} awk | && /usr/bin
+	cd "$1" --verbose /usr/bin grep sed local awk test -eu awk
+	echo x=1 'quoted text' | printf "$@" readonly cd printf
+		printf "$1" -eu local && sed "$@" done sed export sed grep 2>/dev/null
+		${HOME} "$1" 2>/dev/null printf 'quoted text' printf export --verbose test
+&& grep then echo --verbose grep
+x=1 done sed $(pwd) | --verbose --verbose 'quoted text' && x=1 -eu
+		/usr/bin --verbose "$1"
+	grep -eu echo awk local local test done /usr/bin && sed echo "$1"
+$(pwd) done | "$@" test && sed test ${HOME} local
+	"$1" sed "$@" -eu "$1" "$1" "$1" sed done $(pwd) --verbose
+		$(pwd) && export 2>/dev/null readonly x=1 local -eu echo grep -eu 2>/dev/null
+	-eu done x=1 then x=1 done then && local
+export awk /usr/bin sed | 2>/dev/null echo export
+		| $(pwd) echo --verbose readonly /usr/bin export echo readonly "$1"
+		/usr/bin local sed $(pwd) 'quoted text'
+		"$@" local /usr/bin --verbose /usr/bin -eu export
+"$1" test 2>/dev/null && sed test
+		export "$@" ${HOME} -eu sed readonly | grep done export done export
+	| done echo done "$1" "$@" 'quoted text' local
+x=1 "$@" echo cd then --verbose --verbose $(pwd) 2>/dev/null export 'quoted text'
+	"$1" x=1 && "$1" then /usr/bin 2>/dev/null readonly --verbose
+		x=1 2>/dev/null printf awk ${HOME} x=1 export then x=1
+	local echo && | "$@" /usr/bin -eu /usr/bin $(pwd) then
+		&& "$1" -eu sed local export 'quoted text' sed "$@" | 2>/dev/null
+	local readonly sed "$@" && /usr/bin "$1" --verbose |
+	echo "$@" grep 2>/dev/null
+	local sed cd local grep readonly awk done echo awk test
+		2>/dev/null ${HOME} 'quoted text'
+"$@" sed echo readonly "$1" x=1
+	| local -eu readonly test echo done "$@" local 2>/dev/null readonly 2>/dev/null
+-eu test echo 'quoted text' echo
+		${HOME} awk "$@" cd sed echo local && export
+	2>/dev/null 'quoted text' --verbose
+echo | export $(pwd) export printf "$@" sed readonly "$@" grep readonly /usr/bin
+	then printf --verbose awk readonly grep --verbose
+		-eu ${HOME} | -eu grep $(pwd) readonly --verbose
+&& ${HOME} then 'quoted text' export "$1" grep echo then /usr/bin --verbose
+	cd --verbose 2>/dev/null "$@" grep local export readonly "$@" test && -eu echo
+	--verbose then && sed
+echo "$@" /usr/bin then "$1" &&
+	done 2>/dev/null $(pwd) done local && --verbose
+	readonly 2>/dev/null echo done grep cd 'quoted text'
+		sed -eu /usr/bin -eu 2>/dev/null --verbose --verbose done local && printf
+	"$1" $(pwd) test export then | export --verbose
+	2>/dev/null test | 'quoted text' cd printf
+	sed cd $(pwd) then local grep sed 2>/dev/null sed -eu readonly echo sed $(pwd)
+		/usr/bin ${HOME} && local 'quoted text' 2>/dev/null $(pwd) x=1 ${HOME} x=1 | printf
+	then echo "$@" -eu grep awk && /usr/bin printf then | "$1"
+&& $(pwd) export -eu 'quoted text'
+		$(pwd) local x=1 sed | "$1" cd cd then -eu done
+		| readonly "$1" grep $(pwd) 'quoted text'
+	sed sed done local -eu echo -eu sed done cd export test ${HOME} awk | "$@"
+		--verbose /usr/bin && "$1" export local
+		printf cd 'quoted text' 'quoted text' x=1 /usr/bin "$1" $(pwd)
+		--verbose readonly "$1" $(pwd) && | local export echo export $(pwd)
+		&& export local done done then grep "$@" done readonly --verbose "$1" ${HOME} readonly
+'quoted text' test awk -eu sed readonly ${HOME} test
+		"$@" -eu test cd x=1 'quoted text' done export then x=1
+"$1" /usr/bin readonly
+	'quoted text' && 2>/dev/null /usr/bin grep printf sed grep grep printf 2>/dev/null
+awk -eu local echo local x=1 "$@" sed "$1"
+	test --verbose awk 2>/dev/null "$@" x=1
+"$1" 'quoted text' awk echo | readonly local done readonly 2>/dev/null
+cd 2>/dev/null grep test --verbose grep &&
+	${HOME} cd /usr/bin && $(pwd) printf "$1" x=1
+	--verbose done printf cd printf "$1" awk sed | -eu 2>/dev/null
+		"$1" x=1 awk printf x=1 && "$@" "$1" sed /usr/bin done 'quoted text'
+		'quoted text' $(pwd) awk -eu printf ${HOME} local done echo | awk test
+		2>/dev/null echo | sed /usr/bin then ${HOME} x=1 cd then sed --verbose
+	| ${HOME} readonly | export ${HOME} "$1" then ${HOME} --verbose
+sed "$1" ${HOME} test awk
+		local done "$@" grep --verbose cd 'quoted text' "$1" cd x=1 $(pwd) &&
+		readonly printf sed readonly
+--verbose readonly readonly done grep | printf ${HOME} --verbose
+	-eu then export -eu test 'quoted text' grep then x=1 --verbose echo
+	--verbose x=1 sed local local "$@" | test --verbose | "$@"
+export ${HOME} 'quoted text' ${HOME} x=1 then | echo readonly
+	sed 2>/dev/null done export sed then
+readonly test echo awk 'quoted text'
+test readonly sed awk then then printf 2>/dev/null grep readonly
+-eu grep "$@" 2>/dev/null $(pwd) "$1" cd x=1 --verbose local
+		export "$@" /usr/bin export x=1 awk
+		test export sed -eu test local echo | readonly
+	local --verbose grep "$1" test "$1" grep --verbose 2>/dev/null
+printf x=1 awk test "$@" test x=1 ${HOME} cd grep printf cd readonly echo
+	grep | | -eu $(pwd) 2>/dev/null cd grep test 'quoted text' /usr/bin x=1 --verbose
+	readonly /usr/bin /usr/bin then echo 2>/dev/null
+		x=1 printf echo grep x=1 | 2>/dev/null
+echo then grep done done awk 2>/dev/null printf | ${HOME} &&
+		then x=1 "$@" sed cd /usr/bin cd | grep echo && printf readonly /usr/bin /usr/bin
+		done --verbose cd test echo readonly done done echo --verbose
+	sed readonly 'quoted text' export 'quoted text'
+	${HOME} local "$@" && --verbose printf | && | test test && "$1" -eu "$@" --verbose
+		--verbose grep -eu sed awk $(pwd)
+	readonly x=1 ${HOME} "$1" --verbose
+		/usr/bin local /usr/bin 'quoted text'
+	export echo then $(pwd) grep 2>/dev/null local
+	-eu readonly done 2>/dev/null "$@" printf 2>/dev/null
+	/usr/bin then --verbose export printf "$1"
+x=1 --verbose sed $(pwd) "$1" local cd $(pwd) 'quoted text' then awk
+	sed printf x=1 grep sed
+		local then export $(pwd) ${HOME} cd
+cd then printf ${HOME} && grep sed 2>/dev/null 2>/dev/null
+$(pwd) "$@" printf 'quoted text' grep 'quoted text' 2>/dev/null 'quoted text'
+2>/dev/null | readonly grep then grep printf | cd ${HOME} "$1" printf test local
+		done cd cd sed awk sed printf cd local
+	'quoted text' "$1" --verbose
+	"$1" /usr/bin 2>/dev/null --verbose /usr/bin grep then 2>/dev/null 2>/dev/null
+	export "$@" 'quoted text' $(pwd) --verbose /usr/bin echo then 'quoted text'
+		-eu x=1 then echo && "$@" done readonly readonly | then 2>/dev/null test grep
+		test printf echo "$@" ${HOME}
+		export "$1" "$@" local
+local $(pwd) done local grep "$1"
+		x=1 grep echo done test "$1"
+		grep 'quoted text' 2>/dev/null echo | test test 2>/dev/null
+	local readonly printf awk sed x=1 "$1" /usr/bin readonly awk | awk cd $(pwd)
+		then && export | "$@" grep echo x=1 -eu export
+cd grep x=1 printf readonly "$1" "$1" done 'quoted text'
+	local --verbose && -eu awk
+		local printf echo done 2>/dev/null "$@"
+		grep && printf "$1" "$@" test echo readonly 2>/dev/null $(pwd) ${HOME} /usr/bin
+	printf | -eu done printf then printf 2>/dev/null export
+/usr/bin readonly ${HOME} 'quoted text' | local then
+	x=1 $(pwd) | awk sed test grep | --verbose sed local -eu 2>/dev/null
+	${HOME} cd printf "$@" 2>/dev/null | 2>/dev/null "$@" x=1 'quoted text'
+		sed echo sed done local grep done echo then 2>/dev/null
+	grep 2>/dev/null --verbose -eu awk -eu "$1" done done | then local "$@"
+x=1 export ${HOME} grep awk local && $(pwd)
+		/usr/bin "$@" $(pwd) x=1 x=1 ${HOME} --verbose done printf
+	--verbose && && then grep -eu
+	done | cd /usr/bin echo awk then
+	| "$1" export "$@" "$@" ${HOME} 'quoted text'
+${HOME} echo export ${HOME} local then $(pwd) printf ${HOME}
+		--verbose /usr/bin 'quoted text' awk -eu echo cd ${HOME} $(pwd) "$1"
+/usr/bin local && "$1" -eu | "$@"
+'quoted text' done && "$1" "$@" "$@" 'quoted text' echo /usr/bin
+echo readonly test echo --verbose $(pwd) "$@" --verbose ${HOME} ${HOME} $(pwd)
+		/usr/bin "$@" | done 'quoted text' echo "$@"
+"$1" && -eu then | grep awk readonly
+		"$1" printf x=1 grep readonly "$@" export
+	-eu /usr/bin grep 'quoted text' 'quoted text'
+	sed cd export /usr/bin /usr/bin readonly ${HOME} done then
+test x=1 test sed /usr/bin 2>/dev/null grep cd x=1 cd -eu 2>/dev/null && local
+		| "$1" | -eu printf test sed readonly echo sed echo "$@" ${HOME} x=1
+		"$1" sed readonly grep sed --verbose local cd then x=1 "$@"
+printf "$@" awk done $(pwd) grep ${HOME} --verbose 2>/dev/null local
+2>/dev/null ${HOME} grep export -eu --verbose "$1" 2>/dev/null local echo "$@"
+printf -eu 'quoted text' 2>/dev/null 'quoted text' printf cd "$1" local
+"$@" printf --verbose cd $(pwd) | awk 2>/dev/null test x=1
+		| echo --verbose awk $(pwd) -eu ${HOME} awk 2>/dev/null && 2>/dev/null
+		echo then x=1 echo readonly &&
+	printf cd && && then && -eu --verbose | export printf
+	then "$@" $(pwd) test grep "$@" /usr/bin x=1 cd /usr/bin "$@" 2>/dev/null
+echo echo sed && 2>/dev/null | ${HOME} $(pwd) grep && printf x=1
+		2>/dev/null printf sed done 'quoted text'
+awk x=1 $(pwd) ${HOME} cd done -eu && echo test /usr/bin /usr/bin "$1"
+	then awk "$1" 'quoted text' --verbose printf
+local test && awk --verbose local done 2>/dev/null ${HOME}
+/usr/bin "$@" && export 2>/dev/null 2>/dev/null done grep x=1 2>/dev/null
+	echo 'quoted text' readonly
+	readonly "$@" test && echo readonly done awk "$1" done 2>/dev/null "$@"
+	readonly "$1" local -eu sed x=1 x=1 cd echo then
+		x=1 -eu echo -eu $(pwd)
+then readonly test cd cd sed echo printf $(pwd) readonly 'quoted text'
+		sed export 2>/dev/null echo local grep local then "$@" export | $(pwd)
+		printf --verbose && done sed echo
+		then | awk local sed /usr/bin
+local && cd -eu grep sed "$1" readonly
+		$(pwd) "$@" done ${HOME} cd local
+sed sed "$@" then $(pwd) | awk
+	local readonly 'quoted text' "$@" awk x=1 x=1 local |
+"$@" done $(pwd) --verbose
+"$1" x=1 x=1 /usr/bin 'quoted text'
+2>/dev/null local x=1 --verbose 2>/dev/null && "$@"
+		then awk /usr/bin 'quoted text' readonly
+		--verbose local done sed
+		2>/dev/null printf 'quoted text' readonly sed "$1" then echo local $(pwd) grep
+--verbose export | /usr/bin printf
+		"$@" | sed x=1 "$@" readonly grep x=1 && x=1 /usr/bin echo
+awk grep then sed $(pwd) "$@" local test 2>/dev/null "$@" /usr/bin | printf
+		then sed done done done "$@" | | "$@" grep
+done printf 2>/dev/null /usr/bin && ${HOME} cd cd -eu done
+grep echo local "$1" local $(pwd) readonly x=1 awk
+test $(pwd) awk local echo 2>/dev/null ${HOME} -eu grep "$1"
+		awk $(pwd) test ${HOME} echo && grep 2>/dev/null "$@"
+	readonly printf "$1" then -eu ${HOME} -eu awk "$1" | export sed printf local
+		local export && readonly "$@" export then readonly
+	| 2>/dev/null "$@" --verbose echo && test | printf ${HOME}
+	sed then local "$1" $(pwd) "$@" x=1 --verbose export |
+&& | 2>/dev/null /usr/bin x=1 ${HOME} test cd sed echo "$@" cd local test && /usr/bin
+local | grep cd --verbose &&
+	$(pwd) sed --verbose then local && x=1 /usr/bin printf x=1 "$@" awk $(pwd)
+sed test $(pwd) cd "$@" | "$@" readonly | 'quoted text' ${HOME} awk 'quoted text'
+		readonly "$@" cd ${HOME} ${HOME} then $(pwd) 'quoted text' 2>/dev/null
+cd -eu test /usr/bin -eu done && awk -eu done
+		then export 'quoted text' --verbose
+		"$1" sed test "$@" | then $(pwd) local
+-eu readonly x=1 x=1 local readonly "$@" done
+		cd 'quoted text' x=1 grep export
+		cd local readonly echo ${HOME} --verbose x=1 "$1" grep x=1 test ${HOME}
+	${HOME} then grep cd $(pwd) readonly
+export sed 2>/dev/null readonly 2>/dev/null && readonly "$1" "$1" sed ${HOME}
+cd && --verbose --verbose printf
+	2>/dev/null awk echo local $(pwd) sed grep done
+	export --verbose export ${HOME} /usr/bin awk echo awk sed --verbose export
+		${HOME} | $(pwd) --verbose &&
+"$@" test --verbose x=1 /usr/bin 'quoted text'
+		/usr/bin done readonly "$@" done /usr/bin
+	readonly --verbose sed grep printf cd | 'quoted text'
+	${HOME} x=1 -eu local ${HOME}
+	"$1" && $(pwd) awk && "$@" then
+	"$1" test awk local then readonly /usr/bin --verbose --verbose
+	readonly readonly local local $(pwd) | -eu local 2>/dev/null grep
+"$@" && done | local && /usr/bin
+	test sed test sed 2>/dev/null test 2>/dev/null local | echo grep && /usr/bin
+	printf test -eu && sed /usr/bin
+printf test $(pwd) sed sed
+	2>/dev/null sed echo local echo &&
+${HOME} "$@" ${HOME} -eu local test export x=1 done local grep grep "$@"
+cd /usr/bin done awk readonly /usr/bin x=1 x=1 readonly
+local sed 'quoted text' grep "$1" awk
+	--verbose local /usr/bin -eu test sed
+		"$@" local x=1 $(pwd) && && echo &&
+	2>/dev/null /usr/bin | readonly | "$@" grep
+	--verbose ${HOME} "$1" awk cd done "$1" 'quoted text' then
+	export test x=1 -eu 2>/dev/null done
+		readonly /usr/bin x=1 'quoted text' sed ${HOME} sed sed
+echo cd done $(pwd) $(pwd) readonly
+cd 2>/dev/null export && cd sed done test && sed cd 'quoted text'
+	"$@" printf readonly grep
+		-eu printf "$1" && done local "$1" "$1" && then local
+	awk grep test /usr/bin 'quoted text' ${HOME} then grep $(pwd) 'quoted text' /usr/bin
+	sed test printf ${HOME} ${HOME} -eu echo $(pwd) $(pwd) local
+		${HOME} "$1" done sed $(pwd) readonly printf
+		${HOME} ${HOME} x=1 x=1 | done local
+		echo -eu export ${HOME} "$1" /usr/bin done
+x=1 "$@" cd awk | --verbose ${HOME} /usr/bin sed /usr/bin "$@"
+		"$@" $(pwd) 2>/dev/null /usr/bin grep $(pwd) grep then /usr/bin
+		-eu export x=1 x=1 export ${HOME} 'quoted text'
+		| cd -eu then then cd 'quoted text'
+"$1" --verbose $(pwd) --verbose "$@" done done 'quoted text'
+then /usr/bin echo && cd x=1 --verbose
+'quoted text' && done test /usr/bin
+		| cd $(pwd) | done x=1 printf cd
+	'quoted text' then ${HOME} /usr/bin echo then
+cd then then /usr/bin export then $(pwd)
+then 2>/dev/null cd test printf
+/usr/bin | x=1 $(pwd) awk test $(pwd) printf 2>/dev/null -eu 2>/dev/null | grep
+	echo grep echo ${HOME} x=1 x=1 -eu 2>/dev/null -eu done
+	printf x=1 --verbose export then grep
+printf 2>/dev/null grep ${HOME} && 'quoted text'
+	$(pwd) cd printf 'quoted text' 'quoted text' grep echo local test &&
+'quoted text' echo printf "$@" | export
+		export x=1 | cd done grep test | then sed echo echo export ${HOME} 'quoted text'
+	export --verbose sed ${HOME} 2>/dev/null x=1 local export -eu "$1"
+		awk test "$@" /usr/bin awk -eu --verbose 'quoted text'
+		| | readonly --verbose "$1" then export then "$@" | "$1" printf then 'quoted text'
+	grep x=1 grep "$@" x=1 /usr/bin then printf -eu local "$@" test /usr/bin done
+	$(pwd) local ${HOME} && readonly test then && /usr/bin /usr/bin
+	export test readonly ${HOME} --verbose --verbose
+		test -eu "$1" -eu test test "$1" | grep awk readonly
+		test echo && export --verbose x=1
+		done sed export 2>/dev/null grep "$1"
+${HOME} done $(pwd) done 2>/dev/null readonly x=1 cd "$@" ${HOME} --verbose
+	"$@" 'quoted text' -eu cd grep 'quoted text' && export sed 2>/dev/null
+		test readonly ${HOME} 'quoted text' readonly then cd export local
+	2>/dev/null 2>/dev/null $(pwd) --verbose
+	export $(pwd) /usr/bin echo "$1" && 'quoted text' "$@" awk
+"$1" local printf sed -eu export readonly test $(pwd) -eu local
+then done readonly local --verbose -eu -eu -eu local local && "$@" "$@" sed 2>/dev/null
+	grep readonly test done ${HOME} --verbose 2>/dev/null ${HOME} awk then
+cd ${HOME} echo "$@" done cd x=1 'quoted text' done
+	"$@" 2>/dev/null awk awk awk then
+readonly /usr/bin local awk -eu test done 'quoted text'
+	export done "$1" cd x=1 --verbose grep -eu | $(pwd) "$@" "$1" cd export
+	export printf --verbose test done $(pwd) export awk grep
+	printf "$@" | "$@" cd grep test /usr/bin awk 'quoted text'
+	awk x=1 'quoted text' test done printf readonly
+	test x=1 'quoted text' grep test --verbose 2>/dev/null done printf | && done
+		printf echo ${HOME} test 'quoted text' 'quoted text' $(pwd)
+	$(pwd) && cd awk export ${HOME} grep 2>/dev/null && cd readonly
+--verbose x=1 /usr/bin 2>/dev/null echo | printf && "$1" 'quoted text'
+'quoted text' ${HOME} /usr/bin "$@" awk | "$@" -eu
+	awk 2>/dev/null "$1" then
+grep x=1 echo | awk $(pwd) sed local echo echo /usr/bin "$@" cd "$1" readonly cd
+	done "$@" --verbose /usr/bin then ${HOME} then then 'quoted text' "$1"
+"$1" 'quoted text' cd readonly 2>/dev/null
+sed readonly $(pwd) printf export local 'quoted text'
+		x=1 echo 'quoted text' ${HOME} cd 2>/dev/null x=1 --verbose "$1" "$1" $(pwd)
+local done x=1 && echo
+	readonly printf grep test cd sed --verbose | 2>/dev/null local
+&& $(pwd) 'quoted text' -eu readonly
+	sed $(pwd) x=1 $(pwd) sed
+| test 2>/dev/null 'quoted text' && grep "$@" cd | 'quoted text'
+	test "$@" /usr/bin test export
+x=1 done done local /usr/bin 2>/dev/null sed -eu && /usr/bin -eu awk
+printf awk export done ${HOME} 2>/dev/null local | --verbose test
+		export $(pwd) -eu cd x=1 'quoted text' $(pwd) readonly grep
+--verbose cd $(pwd) && && x=1 "$1" 'quoted text' ${HOME}
+		/usr/bin readonly /usr/bin --verbose awk && export local |
+	&& && printf sed awk local awk sed
+| 2>/dev/null echo "$@" sed
+		-eu cd sed then grep 'quoted text' echo sed "$@" ${HOME}
+		"$@" "$@" /usr/bin cd grep local cd --verbose -eu done echo 'quoted text'
+	export then && sed awk grep 'quoted text' 'quoted text'
+sed cd 'quoted text' | grep sed cd test $(pwd) awk x=1 ${HOME} grep "$1" cd /usr/bin
+export && export sed readonly 2>/dev/null ${HOME} echo "$1" "$1"
+"$@" cd printf test echo | cd x=1 "$1" ${HOME} test grep done cd
+export "$1" test then done /usr/bin done grep "$@" -eu printf
+		| | sed && local x=1 cd readonly cd echo | printf $(pwd) grep ${HOME} printf
+	'quoted text' $(pwd) --verbose cd done
+		${HOME} $(pwd) $(pwd) done
+	export awk export grep $(pwd) test sed -eu export
+		'quoted text' 'quoted text' grep 2>/dev/null export test local "$1" 'quoted text'
+grep then x=1 export $(pwd) local "$1" grep local
+		x=1 cd "$@" test ${HOME} done
+	readonly x=1 local cd awk awk "$@" printf awk ${HOME} --verbose
+	"$@" sed $(pwd) "$1" 'quoted text' echo $(pwd)
+printf echo done grep echo export readonly
+x=1 echo --verbose sed 'quoted text' $(pwd)
+cd done readonly local && x=1
+echo printf echo $(pwd) export
+	$(pwd) --verbose grep ${HOME} -eu /usr/bin
+${HOME} sed sed readonly x=1 ${HOME} 2>/dev/null
+	&& 'quoted text' -eu done then readonly
+-eu 2>/dev/null then echo 2>/dev/null export
+	$(pwd) done awk export x=1
+		printf sed echo awk 'quoted text' $(pwd) then then 2>/dev/null readonly 2>/dev/null
+	"$@" export echo /usr/bin $(pwd) | --verbose "$@"
+		${HOME} export grep | "$1" test
+	sed x=1 test done --verbose
+grep sed $(pwd) "$@" done export sed "$@"
+		sed done printf grep $(pwd) "$@" readonly done test
+		x=1 export --verbose 'quoted text' 'quoted text'
+		2>/dev/null local echo 'quoted text' /usr/bin $(pwd) -eu cd sed 2>/dev/null
+		sed awk --verbose && printf "$1" 2>/dev/null done
+printf grep 'quoted text'
+	sed printf printf echo sed "$@" ${HOME} | $(pwd) x=1 |
+export export /usr/bin echo $(pwd) echo "$@" export
+awk echo printf x=1 sed x=1 /usr/bin printf && ${HOME}
+		done | /usr/bin 2>/dev/null
+		"$@" "$@" done cd 'quoted text' awk echo
+		&& "$1" readonly "$@" "$@" grep 'quoted text'
+	$(pwd) printf then | awk && ${HOME} 2>/dev/null /usr/bin
+$(pwd) grep 'quoted text' cd "$1" /usr/bin test x=1 x=1 then printf 2>/dev/null
+"$1" echo | 'quoted text' export --verbose
+		${HOME} test printf readonly -eu then echo 'quoted text' && local grep then
+&& test "$1" echo -eu cd && && readonly && grep
+		"$@" /usr/bin cd 'quoted text'
+test readonly export done readonly echo -eu "$1" && 2>/dev/null readonly
+		export done sed local 2>/dev/null | --verbose "$1" then then "$1"
+	'quoted text' -eu | echo test "$@" then && -eu export done $(pwd)
+		then cd | export done test && then x=1 2>/dev/null -eu then echo && $(pwd) "$1"
+x=1 cd --verbose 2>/dev/null /usr/bin -eu 2>/dev/null "$1" --verbose "$1"
+| test ${HOME} "$@" test "$@" && x=1 printf
+		'quoted text' local printf "$@" x=1 2>/dev/null awk x=1 grep export ${HOME}
+"$@" "$@" echo && awk "$1" local "$1" 'quoted text'
+		test cd ${HOME} 'quoted text' ${HOME} "$1" 'quoted text'
+		then cd $(pwd) sed readonly 2>/dev/null echo 2>/dev/null x=1 ${HOME} printf
+'quoted text' $(pwd) readonly local cd $(pwd) local done 'quoted text' ${HOME}
+	${HOME} && done test then && awk done x=1 awk 'quoted text' grep
+test x=1 test && done | "$@" ${HOME} sed --verbose test 2>/dev/null ${HOME}
+	${HOME} $(pwd) done && then /usr/bin export sed "$1"
+		2>/dev/null cd 2>/dev/null done | then grep readonly
+		x=1 2>/dev/null && 'quoted text'
+&& printf 'quoted text' "$@" "$1" "$@" awk printf grep local $(pwd) 2>/dev/null
+	grep | ${HOME} x=1 sed cd sed done --verbose | 'quoted text' cd readonly
+	&& readonly --verbose /usr/bin /usr/bin /usr/bin grep then $(pwd) |
+		'quoted text' --verbose export "$1" -eu x=1 && readonly
+printf cd then printf sed done /usr/bin export echo printf echo sed cd --verbose
+cd x=1 readonly -eu sed
+$(pwd) test awk then readonly
+	| then printf "$@" done awk readonly readonly --verbose
+		grep | cd $(pwd) && ${HOME} x=1 awk printf export awk $(pwd)
+awk printf grep ${HOME} grep awk ${HOME} done --verbose ${HOME} echo local local
+| readonly "$1" /usr/bin sed export $(pwd) && --verbose -eu sed
+		x=1 'quoted text' -eu then "$1" && x=1 --verbose $(pwd) x=1 cd readonly
+		2>/dev/null cd echo | awk sed done export grep
+	printf cd /usr/bin test sed
+	&& x=1 printf ${HOME} 2>/dev/null sed done then && echo 'quoted text'
+		export printf | ${HOME} /usr/bin "$1" "$1" 'quoted text'
+done | local && local /usr/bin 2>/dev/null cd awk then ${HOME} echo
+local "$@" | | 2>/dev/null done && awk "$@" -eu 'quoted text'
+	"$@" --verbose $(pwd) 2>/dev/null
+-eu 'quoted text' 2>/dev/null ${HOME} -eu && cd readonly printf export cd "$@"
+		awk echo sed then test
+		$(pwd) sed ${HOME} -eu test readonly readonly && | 'quoted text'
+	local then ${HOME} export then && local local "$@" --verbose
+echo /usr/bin export "$1"
+	-eu export done local readonly ${HOME} | printf
+x=1 printf export $(pwd) 2>/dev/null --verbose 'quoted text' printf
+	readonly local export 2>/dev/null grep sed ${HOME} cd 2>/dev/null
+		export echo done ${HOME} sed grep awk sed printf grep | export 'quoted text'
+&& export sed sed | test "$1" awk 2>/dev/null test local ${HOME} /usr/bin -eu printf
+-eu export cd readonly sed then export
+		printf -eu x=1 export then
+	printf sed "$1" -eu awk done grep && echo "$1" grep --verbose test
+export readonly ${HOME} x=1 2>/dev/null "$@" cd
+		echo $(pwd) 'quoted text' sed | 2>/dev/null x=1 test awk --verbose
+		then printf done "$1" --verbose awk awk sed $(pwd) awk
+| then grep 2>/dev/null printf cd sed echo $(pwd) cd test test awk then test ${HOME}
+	$(pwd) --verbose export
+then && | 2>/dev/null then | /usr/bin sed readonly -eu export &&
+	echo ${HOME} --verbose && awk x=1 /usr/bin
+$(pwd) grep 2>/dev/null 2>/dev/null grep
+sed export readonly test grep cd 2>/dev/null awk $(pwd) done /usr/bin 2>/dev/null
+		'quoted text' echo -eu ${HOME} sed export cd $(pwd) done -eu 2>/dev/null
+	/usr/bin awk test -eu --verbose /usr/bin then && sed x=1 cd test
+| | 2>/dev/null cd test 'quoted text' 'quoted text' -eu
+-eu sed printf x=1 grep export x=1
+then 'quoted text' readonly cd "$1" "$@" echo ${HOME}
+export | readonly export "$1" cd
+		test -eu --verbose local local awk printf
+x=1 grep | test done && grep -eu | --verbose
+	${HOME} grep sed x=1 /usr/bin "$1" | /usr/bin
+		then awk test /usr/bin export
+		${HOME} done -eu printf awk
+'quoted text' grep -eu -eu --verbose /usr/bin
+		-eu && awk readonly awk 'quoted text'
+	$(pwd) $(pwd) printf export done local $(pwd) 2>/dev/null
+	local && -eu then test readonly local then then done | export then "$1"
+	export grep local "$@" 2>/dev/null then /usr/bin printf $(pwd) then ${HOME}
+		cd then "$1" "$1" done local -eu cd readonly "$1" test sed
+	"$@" | echo done cd local readonly done /usr/bin local echo 'quoted text'
+		'quoted text' | done 2>/dev/null local local awk test sed x=1 echo
+		--verbose x=1 echo 2>/dev/null export /usr/bin | export readonly echo -eu printf
+	2>/dev/null && $(pwd) grep $(pwd) "$1" --verbose && sed 'quoted text'
+	$(pwd) echo --verbose | sed --verbose /usr/bin readonly echo 2>/dev/null
+	grep done | /usr/bin x=1 echo --verbose --verbose
+	x=1 -eu && 'quoted text' readonly readonly ${HOME} --verbose "$@" readonly 2>/dev/null
+	done local 2>/dev/null --verbose
+		/usr/bin cd && then grep && echo && --verbose printf test ${HOME}
+		"$1" local --verbose test --verbose "$@" x=1 /usr/bin done sed export "$@" echo
+	sed 2>/dev/null readonly local export
+		done --verbose echo grep
+		${HOME} "$1" x=1 /usr/bin $(pwd) $(pwd) then 'quoted text' test "$1" readonly
+local local readonly then printf "$@" ${HOME} 'quoted text'
+	cd printf && done $(pwd)
+		sed awk grep readonly && sed /usr/bin --verbose &&
+		'quoted text' done export cd local 'quoted text'
+'quoted text' ${HOME} 2>/dev/null
+		"$@" $(pwd) done grep x=1 'quoted text' then export sed awk awk /usr/bin
+		&& x=1 echo $(pwd) done $(pwd) then "$@"
+	"$@" test test cd | echo printf readonly grep $(pwd)
+		'quoted text' "$1" "$@" | 2>/dev/null
+| --verbose printf /usr/bin 2>/dev/null awk then done done then -eu --verbose
+echo "$@" /usr/bin x=1 printf echo done readonly
+	readonly sed --verbose done ${HOME} grep 'quoted text' | ${HOME} grep
+	grep 'quoted text' sed printf readonly | -eu
+	"$@" local done done /usr/bin printf | $(pwd) done readonly "$1" echo
+		test 2>/dev/null /usr/bin readonly |
+		echo local "$@" "$@" done echo
+	| 'quoted text' && sed test awk readonly
+		| then 2>/dev/null cd x=1 local export sed "$@" "$1" ${HOME} &&
+| sed "$1" grep grep 2>/dev/null awk export -eu printf
+		awk /usr/bin export 2>/dev/null
+sed then cd echo local "$1" awk
+	/usr/bin 2>/dev/null readonly awk "$@" then x=1 awk x=1 $(pwd)
+		${HOME} 2>/dev/null | &&
+	&& export "$@" done readonly "$@" -eu
+		${HOME} sed test sed done grep test done done readonly
+		x=1 then echo && printf --verbose
+		"$@" export /usr/bin printf ${HOME} && 2>/dev/null grep cd echo
+test sed export done "$@" export
+echo "$@" --verbose && --verbose
+"$1" export local readonly
+	-eu 'quoted text' test $(pwd) && done "$1" echo readonly /usr/bin cd then
+		cd "$@" export x=1 $(pwd)
+		$(pwd) test local | then printf test "$1" test test && 'quoted text' printf /usr/bin
+printf printf | 'quoted text' export
+		2>/dev/null -eu ${HOME} local cd grep sed | test | && printf sed 'quoted text'
+	"$@" "$1" sed && x=1 "$@" local x=1 awk
+		done grep grep x=1 readonly echo $(pwd) | | | cd | | $(pwd) /usr/bin
+printf then printf awk --verbose /usr/bin $(pwd)
+		"$1" 'quoted text' /usr/bin "$1" "$@" echo /usr/bin
+	echo -eu printf "$1" /usr/bin
+		local printf cd awk readonly local | "$1"
+printf test /usr/bin printf /usr/bin export echo done $(pwd)
+	awk readonly test ${HOME} done grep done printf cd ${HOME} "$@"
+		"$@" then -eu printf "$1" local "$@" cd "$1" x=1 "$1" sed grep
+		$(pwd) "$@" echo grep 2>/dev/null
+/usr/bin done "$@" /usr/bin && printf sed | cd $(pwd)
+		awk export awk x=1 readonly /usr/bin "$@" readonly /usr/bin 2>/dev/null
+		local x=1 printf done export local local test cd $(pwd) -eu "$@" done
+		grep grep awk "$@" sed $(pwd)
+x=1 ${HOME} "$@" 'quoted text'
+	grep local then readonly printf && then "$1"
+-eu grep local test awk ${HOME} printf 'quoted text' "$1" 2>/dev/null
+-eu $(pwd) echo && 2>/dev/null -eu cd /usr/bin readonly grep printf
+		export sed test grep printf
+	test x=1 x=1 local x=1 printf "$@" ${HOME} readonly then local grep
+then "$@" printf export -eu $(pwd) grep
+	then 2>/dev/null | --verbose awk 2>/dev/null readonly grep 'quoted text'
+	"$1" local -eu sed /usr/bin ${HOME} echo test /usr/bin
+		x=1 -eu "$1" readonly sed sed | echo readonly "$1" | 2>/dev/null sed /usr/bin
+		x=1 awk --verbose local export
+		done "$@" done x=1 grep done |
+	2>/dev/null cd | local
+	'quoted text' done 'quoted text'
+2>/dev/null readonly cd -eu done "$1" cd done && readonly
+		"$@" -eu done cd | 'quoted text' $(pwd) readonly cd "$1" then $(pwd)
+-eu $(pwd) $(pwd) awk "$1" -eu x=1 $(pwd) local test 'quoted text' sed
+$(pwd) readonly -eu printf then sed done 2>/dev/null
+	${HOME} grep 'quoted text' --verbose test $(pwd) echo local
+		grep $(pwd) "$1" x=1 "$1" --verbose ${HOME} "$1" done ${HOME}
+		$(pwd) awk $(pwd) echo x=1 local echo /usr/bin grep | local readonly
+	sed $(pwd) then --verbose 2>/dev/null x=1
+'quoted text' "$@" 2>/dev/null then done sed 2>/dev/null done test cd printf
+	done -eu sed "$1" | $(pwd) sed 'quoted text'
+		sed grep test && ${HOME} --verbose
+		cd local printf $(pwd) awk 'quoted text' -eu $(pwd) $(pwd) cd printf sed done grep
+/usr/bin echo --verbose && x=1 /usr/bin export printf then
+export && --verbose export awk && && x=1 sed echo x=1 awk readonly printf
+--verbose export then 'quoted text' 2>/dev/null export "$1" grep 2>/dev/null
+		${HOME} && 'quoted text' test ${HOME} x=1 "$1" 2>/dev/null readonly 2>/dev/null
+	printf "$@" "$1" awk cd x=1 2>/dev/null echo /usr/bin -eu
+		| done --verbose /usr/bin readonly test $(pwd) test && awk x=1 readonly
+		&& "$@" --verbose awk "$1" $(pwd)
+		test --verbose "$1" readonly awk "$@" "$1"
+grep readonly x=1 ${HOME} --verbose export --verbose export && readonly "$@" done
+	sed -eu 'quoted text' done "$@" grep && 2>/dev/null "$@" printf
+		grep --verbose awk $(pwd) | && echo done readonly cd done 'quoted text'
+		grep awk ${HOME} cd awk
+--verbose local awk /usr/bin local done test 'quoted text' awk printf export
+	readonly $(pwd) echo done
+		"$1" done echo $(pwd) "$1" 'quoted text' readonly -eu && done
+		| local printf && x=1 -eu readonly
+echo readonly cd readonly /usr/bin $(pwd) -eu echo "$@"
+	echo $(pwd) $(pwd) 2>/dev/null cd printf then $(pwd) -eu
+2>/dev/null echo cd && readonly local local | x=1 awk /usr/bin --verbose ${HOME}
+		cd $(pwd) && cd done "$@" "$1" sed readonly
+&& ${HOME} $(pwd) echo printf -eu grep 'quoted text' test then | readonly
+	cd | awk ${HOME} 'quoted text' && && grep $(pwd) export && "$1" readonly &&
+	x=1 x=1 /usr/bin | done export /usr/bin
+		"$@" done 2>/dev/null test x=1 "$1" grep
+		grep /usr/bin echo -eu $(pwd) cd --verbose | printf
+	sed "$@" test test /usr/bin && 2>/dev/null echo grep 'quoted text'
+		then 'quoted text' "$1" cd echo ${HOME} 'quoted text'
+	| 2>/dev/null grep $(pwd) && x=1 done -eu echo 2>/dev/null "$1" grep
+"$@" echo grep local | sed | ${HOME} grep 'quoted text' --verbose
+	x=1 2>/dev/null "$@" export done -eu echo /usr/bin
+	$(pwd) "$@" "$1" 2>/dev/null test echo -eu sed "$@" "$@" readonly "$@" grep printf
+		--verbose "$@" readonly export "$@" then /usr/bin 'quoted text' --verbose awk
+		'quoted text' /usr/bin awk 2>/dev/null
+2>/dev/null echo local awk 2>/dev/null
+x=1 local export "$@" && "$@" sed local
+	done "$@" && readonly x=1 test awk sed echo then local
+-eu then $(pwd) printf "$@" "$@"
+awk test "$1" test 2>/dev/null x=1 printf ${HOME} --verbose then
+	cd cd sed then 2>/dev/null awk grep 'quoted text'
+	"$@" test && readonly done x=1 | $(pwd) 2>/dev/null echo | sed printf
+/usr/bin /usr/bin then 'quoted text'
+	test printf && 2>/dev/null "$@"
+		done printf grep x=1 -eu local x=1 local
+	'quoted text' "$1" export test local export && grep "$@"
+2>/dev/null test sed readonly x=1 test -eu &&
+		test test echo && && | cd
+		'quoted text' grep printf 'quoted text' -eu export "$@" "$1" test then "$1"
+2>/dev/null "$1" done then test then sed x=1 then printf x=1 sed cd |
+readonly sed 2>/dev/null done
+"$@" && /usr/bin "$@" /usr/bin ${HOME} done test readonly readonly
+		echo echo | export "$@" echo 'quoted text' test ${HOME}
+		&& | done --verbose /usr/bin grep sed done cd 2>/dev/null
+		"$@" readonly grep grep 'quoted text' sed /usr/bin /usr/bin /usr/bin done /usr/bin
+		&& "$@" --verbose cd awk export then
+cd $(pwd) | x=1 | export "$@" local "$@" printf && done printf x=1 'quoted text'
+		readonly ${HOME} done /usr/bin 2>/dev/null 2>/dev/null
+		--verbose "$@" 2>/dev/null 'quoted text'
+		&& export echo readonly --verbose done then awk | then 'quoted text'
+printf "$@" echo "$@" done ${HOME}
+	${HOME} -eu done ${HOME} ${HOME} then -eu done "$1"
+	readonly -eu readonly 2>/dev/null test echo cd /usr/bin
+-eu test $(pwd) grep "$1" then 2>/dev/null ${HOME} "$1" "$1" x=1
+		local "$@" -eu export | x=1 && cd cd 2>/dev/null
+	x=1 | done -eu awk --verbose printf "$@" grep
+	test printf cd done printf && awk $(pwd) $(pwd) 2>/dev/null
+	| 2>/dev/null local && && ${HOME}
+		-eu x=1 grep cd export
+		'quoted text' awk "$1" done | then "$1" echo
+cd local local "$1" --verbose /usr/bin /usr/bin awk "$@" /usr/bin cd | cd
+	2>/dev/null $(pwd) echo "$1" awk 'quoted text'
+	echo ${HOME} 2>/dev/null local $(pwd) $(pwd) grep local readonly local readonly
+	-eu x=1 -eu readonly printf 'quoted text' -eu ${HOME} | test
+local && | grep then "$@" test grep sed sed grep printf $(pwd)
+"$1" ${HOME} ${HOME} printf readonly awk awk | printf
+${HOME} "$@" 'quoted text' readonly local
+		2>/dev/null "$@" printf grep | export then
+		export then | grep echo readonly awk --verbose test && $(pwd) 2>/dev/null
+"$@" cd 'quoted text' done awk -eu | sed done grep readonly $(pwd)
+		then /usr/bin grep then test 2>/dev/null -eu /usr/bin
+		-eu awk then echo cd printf x=1
+		awk | then then then printf export then 'quoted text'
+	readonly $(pwd) /usr/bin ${HOME} x=1 "$1" 2>/dev/null
+		readonly && then printf echo readonly x=1 "$1" |
+		cd export readonly test local echo 'quoted text' 2>/dev/null "$@"
+		export printf sed "$@" | cd
+"$@" 2>/dev/null --verbose | | echo 2>/dev/null
+cd --verbose "$1" "$@" local sed awk ${HOME} awk local sed 2>/dev/null
+		grep "$@" | $(pwd) $(pwd) -eu -eu && "$@" cd "$@" printf printf
+	sed && grep test cd x=1 printf 'quoted text'
+--verbose "$@" $(pwd) local sed
+-eu && ${HOME} awk --verbose grep --verbose $(pwd) awk -eu $(pwd) /usr/bin printf
+		$(pwd) "$@" | $(pwd) 'quoted text' export 'quoted text' "$@" 'quoted text' sed
+	readonly done && test "$1" grep export test -eu 'quoted text' local awk
+		2>/dev/null "$@" $(pwd) export test -eu "$@" x=1 "$@"
+	local test grep readonly
+export cd -eu ${HOME} ${HOME} local $(pwd) printf && -eu export
+	readonly done awk cd 'quoted text'
+		test ${HOME} local |
+		sed -eu -eu ${HOME} "$1"
+		/usr/bin $(pwd) export awk 2>/dev/null 2>/dev/null "$@"
+	${HOME} --verbose export
+		cd sed -eu "$1" readonly grep /usr/bin /usr/bin
+	$(pwd) $(pwd) 2>/dev/null
+&& then test /usr/bin -eu done "$@" export awk readonly done export local
+		awk sed | echo "$1" | --verbose ${HOME} done x=1 "$1" readonly "$@"
+	'quoted text' 'quoted text' local sed /usr/bin | /usr/bin
+	test printf 'quoted text' 2>/dev/null export test local && readonly 'quoted text'
+	"$1" echo echo sed 2>/dev/null test echo
+		--verbose readonly awk x=1
+		test cd readonly done "$@" sed readonly -eu export --verbose ${HOME} "$@" printf
+	"$1" /usr/bin export "$1" then sed && && --verbose local cd readonly
+&& /usr/bin test test awk
+	x=1 | then 'quoted text' awk test cd ${HOME} awk
+		x=1 local printf "$@" awk echo echo grep 'quoted text'
+	printf grep x=1 $(pwd) "$@" "$@" done
+		--verbose 2>/dev/null printf -eu -eu export 'quoted text' grep done && export
+	x=1 ${HOME} ${HOME} 'quoted text' $(pwd) sed export &&
+	cd "$@" "$@" export cd /usr/bin "$1" ${HOME} sed
+cd /usr/bin echo && local then test --verbose echo | 'quoted text'
+		${HOME} then local echo "$@" printf test echo
+	test export && cd --verbose cd | x=1 awk /usr/bin test grep done "$1" sed
+		/usr/bin /usr/bin && grep "$@" sed -eu -eu
+	&& export echo printf printf --verbose echo && "$@" 'quoted text' -eu
+cd 'quoted text' done readonly done -eu test
+	printf --verbose -eu "$@" "$1" cd test -eu awk $(pwd)
+		"$1" then "$1" readonly then cd --verbose && /usr/bin test
+awk test cd "$@" -eu | done then export echo && echo 'quoted text'
+		sed 2>/dev/null printf $(pwd) printf test
+	${HOME} -eu cd "$@" printf cd 2>/dev/null
+'quoted text' done 2>/dev/null
+	${HOME} readonly sed | 2>/dev/null done --verbose grep && 2>/dev/null cd done
+		then $(pwd) "$@" | x=1 done --verbose cd awk local echo ${HOME} $(pwd)
+		-eu "$@" local x=1 $(pwd) && $(pwd) awk cd readonly grep test sed
+		2>/dev/null --verbose $(pwd) local 'quoted text' awk readonly
+grep /usr/bin -eu done "$@" --verbose cd cd
+/usr/bin $(pwd) echo printf
+		test && "$1" x=1 2>/dev/null | --verbose local
+	--verbose && | then printf local "$1" ${HOME} /usr/bin
+local "$@" local --verbose awk "$@" | test -eu --verbose export 2>/dev/null
+		${HOME} --verbose 2>/dev/null $(pwd) -eu /usr/bin ${HOME} awk
+	cd echo && echo awk then echo test "$1" | 'quoted text'
+/usr/bin 2>/dev/null export --verbose then
+		printf "$1" readonly grep ${HOME} "$1" echo $(pwd) cd export sed
+	$(pwd) /usr/bin printf
+		&& export "$1" export $(pwd) echo $(pwd) x=1 readonly && | --verbose -eu -eu
+	sed printf -eu 2>/dev/null done
+	echo cd test && done 'quoted text' grep /usr/bin ${HOME}
+done sed test ${HOME} x=1 test export "$1" -eu --verbose "$@" --verbose | $(pwd)
+		"$1" /usr/bin local done -eu then /usr/bin 'quoted text' $(pwd)
+	awk test | && | export readonly -eu $(pwd)
+export sed ${HOME} printf -eu sed "$1" local ${HOME} && grep /usr/bin "$1" "$@"
+	done | done 2>/dev/null awk local
+	export grep local "$1" 'quoted text'
+		then "$@" "$1" --verbose awk done /usr/bin -eu grep
+	"$@" 'quoted text' $(pwd)
+--verbose readonly | done awk --verbose "$1" cd test local ${HOME}
+	2>/dev/null printf cd cd
+	readonly awk readonly x=1 --verbose ${HOME}
+	'quoted text' done "$1" sed "$1" echo "$@" "$1"
+	printf local sed grep grep echo
+	$(pwd) printf awk "$1" | ${HOME} /usr/bin 2>/dev/null
+		2>/dev/null 'quoted text' "$1"
+export then sed then && sed local --verbose 'quoted text'
+		'quoted text' && x=1 then /usr/bin "$@" -eu | --verbose 2>/dev/null readonly
+	local cd | 2>/dev/null "$@" awk sed sed /usr/bin --verbose cd && cd "$1" -eu
+		| awk then | test "$@" done sed "$@"
+		local done 2>/dev/null -eu "$1" grep cd --verbose sed | 2>/dev/null --verbose
+	x=1 echo cd test test readonly && $(pwd) awk cd
+		&& then cd $(pwd) /usr/bin echo -eu
+echo test | printf x=1 sed echo printf x=1 awk readonly "$@" readonly
+		printf --verbose cd -eu --verbose
+		${HOME} /usr/bin test && awk | echo done readonly grep readonly
+	printf 2>/dev/null done | --verbose
+grep 2>/dev/null cd && "$1" echo cd && --verbose -eu ${HOME} "$1" sed then
+		-eu --verbose "$@" "$@" awk sed /usr/bin 'quoted text'
+&& 2>/dev/null "$1" grep ${HOME} then readonly 'quoted text' sed | readonly
+	x=1 2>/dev/null cd test x=1 test | "$1" cd
+	'quoted text' -eu cd && sed grep 2>/dev/null local $(pwd) --verbose
+	"$@" grep x=1 ${HOME} local 'quoted text' cd && grep then -eu local 'quoted text'
+"$1" grep x=1 "$1" sed test grep sed "$1" $(pwd) cd awk
+-eu | grep test && cd echo
+		readonly export echo cd x=1 local /usr/bin -eu ${HOME} 'quoted text'
+	then sed -eu ${HOME} 'quoted text' readonly awk "$1" sed
+	then x=1 x=1 -eu | export then grep grep sed sed awk local /usr/bin 2>/dev/null
+		'quoted text' -eu grep 'quoted text'
+	echo local sed awk done --verbose cd cd ${HOME} 'quoted text' done
+	-eu 2>/dev/null /usr/bin awk x=1 ${HOME} export ${HOME} && /usr/bin echo && ${HOME}
+	grep 'quoted text' ${HOME} awk export | printf | then -eu then
+local readonly 'quoted text' 'quoted text'
+	${HOME} done cd echo echo test
+	awk then x=1 'quoted text' then && -eu sed cd "$@" | test
+sed --verbose grep grep
+$(pwd) local printf then sed --verbose x=1 "$1" | "$@"
+-eu cd -eu "$1" ${HOME} 2>/dev/null
+done -eu cd /usr/bin --verbose
+$(pwd) local | -eu test && && sed $(pwd) readonly 2>/dev/null local 2>/dev/null
+		${HOME} local cd "$@" then 2>/dev/null ${HOME} sed 2>/dev/null 'quoted text' | -eu
+test export && done ${HOME} | "$1" done echo export /usr/bin test cd sed done
+	sed && -eu $(pwd) done test printf awk export $(pwd) "$@" local && | grep && test
+	2>/dev/null 2>/dev/null grep /usr/bin
+	'quoted text' x=1 cd then $(pwd) local test grep "$1"
+local cd test "$@" ${HOME}
+		sed -eu 2>/dev/null ${HOME} awk sed local
+"$@" 2>/dev/null x=1 --verbose cd ${HOME} readonly $(pwd) cd -eu then printf
+	then echo "$@" then | export grep | 2>/dev/null /usr/bin 2>/dev/null
+	&& 2>/dev/null 2>/dev/null grep printf -eu awk | readonly "$@" 'quoted text'
+--verbose ${HOME} | readonly | --verbose ${HOME} export
+&& local 2>/dev/null 2>/dev/null && then -eu cd cd cd readonly
+'quoted text' "$@" | $(pwd)
+--verbose printf export -eu --verbose -eu "$1"
+	echo "$1" 2>/dev/null printf export printf "$@" readonly &&
+		printf grep done 2>/dev/null export local local grep
+	"$@" -eu sed done awk && /usr/bin 2>/dev/null done "$1" --verbose "$@"
+	echo then 'quoted text' cd ${HOME} 2>/dev/null
+	&& then 2>/dev/null ${HOME} 'quoted text' export "$@" -eu readonly printf --verbose
+		| && /usr/bin 'quoted text' | -eu 2>/dev/null awk sed 2>/dev/null
+		grep "$@" then test --verbose --verbose "$1"
+	--verbose /usr/bin | /usr/bin --verbose done x=1 | x=1 local "$1" test
+		test $(pwd) sed echo x=1 then readonly
+		"$1" sed x=1 /usr/bin ${HOME} $(pwd) "$@" awk 'quoted text'
+	then ${HOME} x=1 "$1" "$1" 2>/dev/null "$@" then then $(pwd) readonly
+"$@" test "$1" then awk
+test export export $(pwd) then 2>/dev/null cd echo
+	--verbose awk "$1" then -eu $(pwd) && echo printf $(pwd) done cd &&
+		| awk done && awk --verbose done | "$1"
+		| awk sed "$1" export "$@" grep 'quoted text' | -eu
+'quoted text' sed $(pwd) | /usr/bin awk cd done 'quoted text' | "$@" grep "$@"
+	test done && export "$@" 2>/dev/null 2>/dev/null printf --verbose $(pwd) awk cd
+echo readonly $(pwd) x=1 'quoted text'
+		$(pwd) x=1 'quoted text' cd cd "$@" ${HOME} then awk x=1 local $(pwd) test
+		${HOME} --verbose printf export cd cd --verbose
+	echo test ${HOME} export "$1" "$@" 2>/dev/null
+awk echo echo test done local
+then grep then 'quoted text' "$@" ${HOME} "$1" | ${HOME} $(pwd) 2>/dev/null
+| ${HOME} printf sed readonly /usr/bin local | readonly export
+/usr/bin 2>/dev/null 'quoted text' --verbose | 'quoted text' sed 'quoted text'
+	--verbose printf -eu "$@" then x=1
+	printf test cd ${HOME} sed echo sed 2>/dev/null
+sed printf grep export then export printf then awk /usr/bin "$@" x=1 printf
+	readonly /usr/bin awk -eu
+	local ${HOME} $(pwd) test x=1 done test
+		--verbose 2>/dev/null then 'quoted text' 2>/dev/null export cd 2>/dev/null
+		sed -eu sed | "$1" --verbose done $(pwd)
+"$1" /usr/bin readonly
+done 2>/dev/null ${HOME}
+	| sed 2>/dev/null && | then --verbose sed done --verbose cd local
+		2>/dev/null -eu local | --verbose export test awk /usr/bin /usr/bin 'quoted text'
+		local 2>/dev/null cd sed "$@" x=1 export sed 'quoted text' grep
+${HOME} sed ${HOME} "$1" x=1 test $(pwd) /usr/bin awk sed test 'quoted text'
+test /usr/bin | "$1" test printf 2>/dev/null 'quoted text' /usr/bin local
+	&& echo local then then cd awk && -eu x=1 done 'quoted text'
+	$(pwd) done awk then
+		awk awk "$1" "$@" ${HOME} "$@" local test 2>/dev/null local
+"$1" cd cd sed && 'quoted text' --verbose $(pwd) 2>/dev/null readonly --verbose
+--verbose "$1" 'quoted text' grep $(pwd) | grep export "$@" "$@" done 2>/dev/null
+		echo "$1" 2>/dev/null $(pwd)
+	$(pwd) awk -eu done && $(pwd) then x=1 echo
+		-eu | -eu test done awk /usr/bin ${HOME} | "$@" -eu echo
+		2>/dev/null then /usr/bin && && --verbose echo cd readonly /usr/bin
+	then readonly local "$1" sed readonly local local x=1
+--verbose x=1 "$@" -eu readonly printf 'quoted text'
+export echo echo readonly --verbose
+		| x=1 "$1" 'quoted text' test
+		sed $(pwd) -eu x=1 awk awk --verbose export $(pwd)
+	echo done /usr/bin cd && 2>/dev/null sed sed 'quoted text' awk
+2>/dev/null --verbose echo ${HOME} printf $(pwd) printf "$1" readonly printf
+	grep printf && | echo echo $(pwd) 'quoted text' done awk
+		"$@" done x=1 local 2>/dev/null 2>/dev/null 2>/dev/null
+	done $(pwd) echo cd cd "$1" $(pwd) | --verbose
+2>/dev/null test then printf 2>/dev/null done "$@" done awk
+	${HOME} readonly "$@" $(pwd)
+	then --verbose $(pwd) "$1" ${HOME} echo then
+		then echo /usr/bin readonly done $(pwd)
+	/usr/bin readonly $(pwd) sed | 2>/dev/null echo
+echo | x=1 && | done then | x=1 ${HOME} "$1" cd --verbose "$@" --verbose
+		printf grep readonly test
+'quoted text' 'quoted text'
+	test "$1" ${HOME} readonly grep readonly printf "$@" grep 2>/dev/null
+	x=1 then -eu grep x=1 export
+	sed test ${HOME} then x=1 readonly grep printf -eu
+then export 'quoted text'
+		cd "$@" 'quoted text' export
+		done x=1 "$@" grep --verbose local
+/usr/bin $(pwd) readonly 2>/dev/null /usr/bin
+	2>/dev/null "$@" $(pwd) printf awk | printf x=1 grep export awk
+		test readonly printf sed printf
+-eu --verbose /usr/bin 'quoted text' cd then 'quoted text' export 2>/dev/null done
+grep printf 'quoted text' "$1" -eu | local /usr/bin sed then printf grep $(pwd)
+	awk -eu grep printf --verbose
+cd cd /usr/bin export awk 'quoted text' $(pwd)
+		test && x=1 awk local "$@" x=1 local then export grep
+--verbose export 'quoted text' printf local
+	test "$1" grep "$@" "$1" x=1 'quoted text' && export
+		-eu "$@" | "$@" --verbose -eu ${HOME}
+		readonly sed echo "$@" | awk /usr/bin $(pwd) -eu grep 'quoted text' readonly echo
+		$(pwd) readonly -eu awk cd "$@" then
+	--verbose ${HOME} 'quoted text'
+	/usr/bin cd -eu printf "$@" | -eu cd "$@" 'quoted text' awk test grep $(pwd)
+	printf readonly readonly $(pwd) -eu grep x=1 ${HOME} --verbose
+	echo "$@" /usr/bin ${HOME}
+2>/dev/null ${HOME} done echo
+done readonly echo && then /usr/bin $(pwd)
+	| echo /usr/bin sed | local --verbose
+'quoted text' ${HOME} export grep $(pwd) /usr/bin export cd ${HOME} then printf
+	| "$1" printf /usr/bin | 'quoted text'
+echo sed sed done /usr/bin "$1" 2>/dev/null grep printf 'quoted text' readonly
+	then x=1 printf echo export $(pwd) local x=1 printf local
+	"$1" cd 'quoted text' -eu echo export cd 2>/dev/null && sed cd x=1 "$1" cd --verbose
+		/usr/bin awk readonly sed echo test x=1 test local /usr/bin ${HOME} "$@" awk
+${HOME} echo "$1" local "$1" test ${HOME} "$1" 'quoted text'
+	awk export printf sed 'quoted text'
+		${HOME} ${HOME} local "$@" | x=1 done && | --verbose /usr/bin $(pwd)
+	local "$1" test "$@" --verbose ${HOME} echo cd then /usr/bin /usr/bin x=1 printf
+		--verbose && "$@" awk "$1" "$@" printf && printf grep echo printf readonly
+	awk x=1 echo then cd && echo | test done $(pwd) printf sed echo 2>/dev/null
+	grep $(pwd) "$@" then grep -eu done --verbose
+2>/dev/null | export printf /usr/bin
+"$@" export printf | echo "$1" awk done awk sed then 2>/dev/null
+done "$1" -eu readonly grep "$@" awk echo &&
+		test --verbose | && done "$1" readonly ${HOME} sed "$@" x=1 ${HOME} | readonly
+test echo cd ${HOME} -eu ${HOME} local 'quoted text' 'quoted text' awk $(pwd)
+	export sed 2>/dev/null --verbose 2>/dev/null
+		test --verbose "$@" local
+	--verbose cd "$1" cd printf
+		x=1 'quoted text' cd --verbose done --verbose 2>/dev/null awk $(pwd)
+	${HOME} then done | "$@" "$1" 'quoted text' 'quoted text'
+	awk readonly sed awk ${HOME} awk "$1" && echo /usr/bin sed local test ${HOME}
+sed "$@" "$1" cd $(pwd) 'quoted text' && "$@" test then --verbose echo readonly
+	x=1 sed echo /usr/bin readonly
+	2>/dev/null echo sed readonly /usr/bin grep /usr/bin | "$1" -eu -eu export printf
+	export "$@" /usr/bin | /usr/bin 'quoted text' done
+2>/dev/null 'quoted text' sed -eu export x=1 done "$@" -eu --verbose
+| ${HOME} cd awk "$@" done "$1" $(pwd) awk awk printf $(pwd) $(pwd)
+	$(pwd) sed /usr/bin 2>/dev/null $(pwd) $(pwd) && sed done | export cd readonly
+		awk "$@" /usr/bin local ${HOME} 'quoted text'
+then echo x=1 'quoted text'
+		done $(pwd) --verbose && test ${HOME} 'quoted text'
+	'quoted text' --verbose x=1 then "$@" then echo cd done -eu | grep printf
+	'quoted text' echo printf "$@" printf echo && ${HOME} /usr/bin
+'quoted text' grep 'quoted text'
+		then export 'quoted text' awk ${HOME} | $(pwd) grep
+$(pwd) ${HOME} grep 2>/dev/null "$@" -eu local -eu x=1 --verbose "$@" done
+"$1" "$@" ${HOME} local done ${HOME} &&
+awk readonly grep test
+		export --verbose done /usr/bin --verbose "$@"
+		--verbose cd 'quoted text' sed
+		done 2>/dev/null local /usr/bin test grep cd 'quoted text' 'quoted text'
+	readonly 2>/dev/null --verbose grep x=1 readonly test ${HOME}
+$(pwd) "$@" grep test
+		local grep | test 'quoted text'
+	export ${HOME} ${HOME} -eu done && $(pwd) 'quoted text'
+readonly "$1" && echo
+	--verbose printf -eu export cd "$1" 'quoted text' grep echo /usr/bin --verbose
+	export "$@" cd test sed done 2>/dev/null "$1" echo sed "$1" awk awk then
+	'quoted text' ${HOME} /usr/bin $(pwd) "$1" printf
+		sed /usr/bin | --verbose && "$1" cd "$1" --verbose cd readonly done grep
+		grep | -eu x=1 x=1 awk 2>/dev/null /usr/bin 2>/dev/null 2>/dev/null
+		$(pwd) sed "$1" cd --verbose
+&& local x=1 grep done sed "$1" -eu then local $(pwd) done && readonly
+	'quoted text' done sed -eu 'quoted text' sed && readonly export export --verbose
+local done $(pwd) echo "$@" grep export ${HOME} printf local echo done
+		echo awk $(pwd) 2>/dev/null "$1" sed export local echo
+		awk | -eu --verbose export
+	&& --verbose grep x=1 "$@" awk x=1 awk 2>/dev/null
+2>/dev/null awk ${HOME} $(pwd) cd
+		grep 'quoted text' | && local cd echo awk done test
+	-eu /usr/bin ${HOME} /usr/bin printf then echo "$1" --verbose echo
+		| && 'quoted text' cd awk
+	${HOME} readonly | test && "$1" test test 2>/dev/null printf "$@" | -eu 2>/dev/null
+readonly readonly cd printf echo | /usr/bin 'quoted text' -eu "$@"
+	cd -eu printf then cd --verbose
+	'quoted text' $(pwd) grep printf grep
+	"$@" grep $(pwd) done test -eu && && -eu $(pwd) /usr/bin "$1" echo /usr/bin
+		&& echo x=1 sed "$1" grep grep sed 'quoted text' /usr/bin readonly then grep
+		$(pwd) printf --verbose done -eu | grep test awk export 2>/dev/null then
+		then /usr/bin && done | readonly -eu printf printf
+test sed 'quoted text' ${HOME} printf printf $(pwd) done sed local done 'quoted text'
+awk printf 'quoted text' -eu --verbose cd sed local "$@" 2>/dev/null
+cd "$@" 'quoted text' && "$@" cd cd
+		grep echo readonly sed grep "$1" 'quoted text'
+		/usr/bin | awk then 'quoted text' 'quoted text' export sed "$1" readonly
+--verbose | grep | /usr/bin echo readonly export
+		--verbose 2>/dev/null cd "$@"
+		"$1" -eu readonly awk ${HOME} && "$1" printf && done grep grep | cd
+	&& printf sed local test printf "$1" ${HOME}
+x=1 /usr/bin printf echo /usr/bin test $(pwd) local export
+--verbose -eu | /usr/bin awk -eu test x=1 2>/dev/null done echo && export
+$(pwd) ${HOME} ${HOME} then export
+		'quoted text' 2>/dev/null sed then sed local local --verbose "$1" export &&
+	${HOME} 'quoted text' echo then 2>/dev/null echo printf "$1" local
+	x=1 $(pwd) | readonly printf grep x=1 local
+		$(pwd) export done -eu sed $(pwd) | 2>/dev/null
+		readonly $(pwd) $(pwd) export test 2>/dev/null "$@"
+		$(pwd) cd echo export 2>/dev/null
+awk local grep && $(pwd) ${HOME} --verbose local awk printf awk readonly
+echo x=1 test grep then 'quoted text' echo export "$1"
+	test "$1" x=1 'quoted text' awk "$@" -eu printf "$@" /usr/bin 2>/dev/null
+	x=1 test 'quoted text' ${HOME} echo "$@" "$1" "$1" "$@" && export
+		${HOME} export echo readonly printf ${HOME}
+	done /usr/bin export test readonly done -eu --verbose "$1" ${HOME}
+		then test echo sed 'quoted text' printf then -eu sed |
+		printf local then export echo sed ${HOME}
+		readonly -eu && /usr/bin ${HOME}
+		2>/dev/null printf readonly $(pwd) grep $(pwd) sed local $(pwd) "$1" --verbose
+	readonly then test | --verbose awk $(pwd) | cd sed /usr/bin printf
+		&& grep then grep echo | $(pwd) test
+	local "$@" readonly sed awk then "$@" ${HOME}
+awk --verbose $(pwd) export && awk cd /usr/bin grep 'quoted text' 2>/dev/null
+	test cd $(pwd) 'quoted text' /usr/bin
+awk -eu --verbose export "$1" --verbose "$@"
+"$@" -eu ${HOME} ${HOME} x=1 -eu cd then 'quoted text'
+local "$1" grep awk -eu test sed readonly && done
+-eu $(pwd) test export | "$@" done echo "$@" readonly
+&& --verbose "$@" test readonly then
+"$1" --verbose awk /usr/bin sed
+		then printf --verbose awk "$1" "$@" then "$1" then -eu x=1
+		"$@" 'quoted text' ${HOME}
+		export export --verbose test
+-eu echo ${HOME} && /usr/bin ${HOME} then && x=1 $(pwd) sed then "$@" ${HOME}
+		then local grep awk ${HOME} test "$@" printf
+local 2>/dev/null && 'quoted text' -eu ${HOME} printf "$1" local x=1 export
+	grep "$1" printf echo "$@" && done printf | local readonly /usr/bin
+	printf awk awk ${HOME} | cd export awk echo awk printf awk grep printf
+	done --verbose /usr/bin && export sed --verbose && printf
+	"$1" export 2>/dev/null awk awk local
+		"$1" cd test /usr/bin awk
+awk | sed readonly -eu sed test 'quoted text'
+		$(pwd) then && && readonly x=1 'quoted text' "$@" -eu "$@" "$@" local ${HOME} 'quoted text'
+"$1" ${HOME} readonly grep done /usr/bin test /usr/bin |
+done -eu done test $(pwd) 'quoted text'
+	'quoted text' | readonly printf /usr/bin "$1" echo test
@@ -0,0 +1,2001 @@
+		cd test "$@" grep echo sed export grep printf echo ${HOME} test
+	test local echo ${HOME} grep /usr/bin export $(pwd) export local | 2>/dev/null
+readonly grep local echo 'quoted text' echo awk ${HOME}
+	--verbose sed /usr/bin then 'quoted text' readonly
+--verbose 'quoted text' ${HOME} 2>/dev/null
+	"$1" -eu grep export grep then 2>/dev/null
+		2>/dev/null test grep | grep export test export grep
+		'quoted text' grep local -eu -eu "$1" done
+		| printf | && 'quoted text' cd printf && sed -eu ${HOME} ${HOME}
+		done -eu export export then -eu "$@" /usr/bin
+	"$1" ${HOME} -eu echo grep sed "$1"
+sed /usr/bin grep | | readonly done /usr/bin
+		'quoted text' test "$1" "$1" $(pwd) -eu sed awk "$1"
+	done x=1 --verbose grep grep 'quoted text' then && cd echo grep
+2>/dev/null $(pwd) "$1" printf done export cd grep 'quoted text' ${HOME}
+awk --verbose && sed grep then -eu 2>/dev/null readonly test 2>/dev/null printf
+		readonly test 2>/dev/null test "$@" && "$@" readonly
+		echo echo ${HOME} local $(pwd) --verbose awk
+	local -eu 'quoted text' ${HOME} "$@" ${HOME} && grep 2>/dev/null 2>/dev/null -eu
+		test readonly echo awk cd && then -eu ${HOME}
+		test echo done then x=1 "$1" --verbose export x=1 ${HOME} && done grep 'quoted text'
+		| sed echo x=1 --verbose sed && x=1 "$@" --verbose test cd then echo sed
+x=1 'quoted text' --verbose && x=1 'quoted text' && echo --verbose /usr/bin
+sed --verbose done 'quoted text'
+		readonly -eu readonly x=1 | $(pwd)
+	test echo then -eu awk 'quoted text' --verbose echo /usr/bin cd local
+	cd printf x=1 then /usr/bin readonly
+	cd $(pwd) printf "$1" export "$@" test "$1"
+		| local local grep 2>/dev/null
+		echo "$1" then cd 'quoted text' local test then echo cd
+echo | grep done then 2>/dev/null test "$@" awk test 'quoted text'
+	cd 2>/dev/null "$1" readonly sed "$@" grep done
+	'quoted text' done 'quoted text' $(pwd)
+	printf echo local 2>/dev/null readonly grep grep test sed echo sed 2>/dev/null
+	'quoted text' local readonly test --verbose | awk then grep 'quoted text' readonly
+	sed export && done printf "$@" "$1" export -eu "$1" --verbose "$@" "$1"
+	&& | grep "$@" done "$@" --verbose
+	grep x=1 echo ${HOME} --verbose
+then test local | awk "$@" done local
+		&& ${HOME} && 'quoted text' local "$1" readonly ${HOME}
+cd ${HOME} export 'quoted text' 2>/dev/null 'quoted text'
+-eu $(pwd) printf $(pwd) awk test
+	printf then "$1" sed then -eu printf sed "$1" "$1" | --verbose "$1"
+cd grep "$1" --verbose awk "$1" printf /usr/bin && $(pwd) printf 2>/dev/null
+x=1 2>/dev/null | then export cd
+	echo | export printf local ${HOME}
+	export ${HOME} echo /usr/bin 'quoted text'
+	done printf grep $(pwd) awk | cd done && printf "$1"
+2>/dev/null 2>/dev/null readonly
+2>/dev/null && 2>/dev/null "$1" "$@" 2>/dev/null cd awk awk "$1" $(pwd)
+	'quoted text' printf export $(pwd) export 2>/dev/null 'quoted text'
+		$(pwd) test sed echo 'quoted text' sed && 'quoted text' readonly readonly
+		x=1 done --verbose -eu echo "$@" readonly 'quoted text'
+	&& --verbose then "$1" cd "$@" grep --verbose --verbose awk
+	printf $(pwd) "$1" && done done local
+	'quoted text' && /usr/bin done test 'quoted text'
+		test --verbose $(pwd) /usr/bin /usr/bin 'quoted text'
+	"$1" export && /usr/bin "$1" --verbose cd grep
+		cd "$@" export 'quoted text' 2>/dev/null readonly
+		then $(pwd) export 'quoted text' --verbose grep -eu 'quoted text' echo /usr/bin
+'quoted text' 2>/dev/null x=1 /usr/bin x=1 test
+done -eu /usr/bin local echo --verbose then local 2>/dev/null -eu sed /usr/bin
+/usr/bin sed x=1 /usr/bin export x=1 | grep
+export "$@" export cd awk 2>/dev/null "$@" export "$@" && 'quoted text'
+		${HOME} "$@" --verbose && echo | printf ${HOME} "$@" "$@"
+	"$@" 'quoted text' readonly local cd awk done echo local $(pwd)
+	readonly "$1" echo ${HOME}
+x=1 "$1" ${HOME} local "$@" sed awk
+test then ${HOME} test test "$1" x=1 "$1" cd test -eu readonly /usr/bin
+		| then | test "$1" x=1 $(pwd) --verbose
+	then test --verbose cd "$@" readonly "$1" done grep ${HOME}
+local -eu 2>/dev/null grep -eu done sed | ${HOME} printf
+		${HOME} echo "$1" && test echo x=1 $(pwd) sed
+sed && cd "$@" then 'quoted text'
+		done x=1 test local cd done ${HOME}
+	echo "$1" "$1" done grep /usr/bin && test cd done
+		--verbose "$1" && -eu done printf 'quoted text'
+		awk "$1" echo echo x=1 sed x=1 | printf | && awk local
+export grep 2>/dev/null -eu cd 'quoted text' $(pwd)
+printf sed "$1" ${HOME} /usr/bin
+	then awk 'quoted text' /usr/bin echo | echo grep sed 2>/dev/null export export
+		/usr/bin /usr/bin -eu | $(pwd) then cd awk export "$1" /usr/bin "$1" $(pwd) sed
+	&& x=1 "$@" /usr/bin awk --verbose 2>/dev/null cd 2>/dev/null 2>/dev/null
+		$(pwd) readonly then local
+x=1 sed /usr/bin then ${HOME} test ${HOME} then
+		export printf sed grep x=1
+		| test awk --verbose sed awk test done export && "$@" "$@" local readonly $(pwd)
+readonly done sed && awk readonly | sed "$@" ${HOME} printf
+awk /usr/bin && 'quoted text' test awk echo x=1 readonly echo awk
+		then && 'quoted text' echo /usr/bin cd | readonly local 'quoted text' -eu --verbose
+readonly x=1 export "$1" readonly sed && then 2>/dev/null
+	2>/dev/null readonly $(pwd) cd done echo -eu 2>/dev/null ${HOME}
+	awk test grep grep "$@"
+	printf -eu -eu test test "$@" test done /usr/bin sed /usr/bin echo "$1" grep
+&& sed | /usr/bin local /usr/bin awk
+		done then "$@" test sed export x=1 x=1 test ${HOME} echo grep "$1" export
+	local printf sed then grep -eu printf
+/usr/bin "$@" echo export -eu export echo local
+done 'quoted text' 'quoted text' --verbose local "$@"
+		done echo grep | printf && ${HOME} printf awk local readonly $(pwd) grep --verbose
+		then readonly test | done ${HOME} cd "$1" local export local readonly
+	| --verbose awk then x=1 'quoted text'
+$(pwd) echo local cd "$@" sed && readonly
+-eu local local $(pwd) then grep x=1 2>/dev/null "$@"
+${HOME} awk 'quoted text' then done
+&& 2>/dev/null 'quoted text' grep "$@" local test awk /usr/bin
+	&& printf -eu --verbose "$@" echo echo test 2>/dev/null
+		&& 'quoted text' "$@" x=1 echo 'quoted text'
+	/usr/bin 2>/dev/null $(pwd) export test && grep
+	$(pwd) 2>/dev/null then readonly 'quoted text' then &&
+		/usr/bin -eu 'quoted text' -eu echo x=1 readonly grep /usr/bin
+	local ${HOME} $(pwd) awk x=1 export sed -eu readonly
+		export grep -eu $(pwd) echo printf readonly /usr/bin readonly --verbose
+	echo local 'quoted text' local "$1" x=1 grep printf
+grep export sed -eu "$1" test --verbose &&
+/usr/bin cd 2>/dev/null printf test "$1" /usr/bin done awk 'quoted text'
+		${HOME} "$@" -eu printf "$1" local x=1 cd && /usr/bin sed $(pwd) grep readonly x=1
+		&& 'quoted text' export $(pwd) awk printf awk
+		local readonly then then /usr/bin -eu echo done done 2>/dev/null "$1"
+		readonly -eu -eu printf test 'quoted text' awk | 2>/dev/null
+	test -eu then echo --verbose grep
+	"$1" readonly 'quoted text' awk "$@" $(pwd) printf awk local readonly
+	| 'quoted text' | sed ${HOME} 'quoted text'
+local cd ${HOME} printf awk printf test test 'quoted text' grep readonly
+"$@" 'quoted text' grep --verbose 2>/dev/null && "$1" then
+		| 'quoted text' $(pwd) ${HOME} /usr/bin printf
+		done local "$@" "$@" sed then
+		sed echo "$@" printf /usr/bin
+	readonly readonly local then sed 2>/dev/null
+cd done test readonly local local /usr/bin test
+	"$@" 2>/dev/null $(pwd) export $(pwd)
+printf $(pwd) "$1" done test | $(pwd) -eu
+		x=1 cd export cd 'quoted text' 'quoted text' x=1 --verbose ${HOME} test
+printf x=1 -eu "$@" /usr/bin readonly
+"$@" readonly readonly 2>/dev/null local "$1" export then -eu test
+	grep awk echo grep export "$1" echo 'quoted text' then export test
+	x=1 /usr/bin 'quoted text' local -eu echo
+	echo export printf && --verbose local | |
+${HOME} awk $(pwd) --verbose && 'quoted text' printf
+sed cd then ${HOME} echo | done ${HOME}
+	'quoted text' 2>/dev/null |
+		then printf x=1 | awk done readonly local test --verbose "$1" ${HOME} "$@" awk
+		test sed x=1 awk -eu $(pwd) readonly readonly done then
+		${HOME} local then x=1 cd grep grep 'quoted text'
+	--verbose && test local local -eu printf -eu readonly ${HOME}
+--verbose | x=1 /usr/bin readonly
+	grep done done test grep awk
+	$(pwd) x=1 --verbose /usr/bin ${HOME} echo printf ${HOME} sed awk
+		"$@" cd -eu 2>/dev/null
+	"$@" x=1 --verbose done export
+export 2>/dev/null sed 'quoted text' --verbose
+		echo --verbose printf && cd readonly && readonly
+	x=1 2>/dev/null grep export
+local then 2>/dev/null then then x=1 awk
+2>/dev/null | test echo awk ${HOME} && echo echo $(pwd) awk export grep cd x=1
+		&& grep "$1" | echo $(pwd) && -eu -eu echo export x=1 && -eu printf "$@" "$@" /usr/bin
+		awk 2>/dev/null done grep "$1" test && /usr/bin $(pwd) | "$@" | --verbose "$@"
+	then ${HOME} local 'quoted text' 'quoted text' printf cd readonly
+test && /usr/bin 'quoted text' | | printf 2>/dev/null awk
+"$@" echo echo $(pwd) 2>/dev/null
+	done -eu grep x=1 --verbose 'quoted text' export
+cd local $(pwd) test then 'quoted text' -eu x=1 sed test -eu test printf cd export
+	grep local $(pwd) done then x=1 "$1"
+/usr/bin done awk -eu ${HOME} $(pwd) done ${HOME} local readonly --verbose cd 2>/dev/null
+		grep && 'quoted text' test "$@" grep test awk | ${HOME} readonly
+then 'quoted text' "$1" test readonly sed printf /usr/bin then && --verbose
+		test sed ${HOME} "$1" grep $(pwd) readonly
+		local x=1 -eu local test
+	then 2>/dev/null /usr/bin local x=1 test "$1" "$1" -eu awk 2>/dev/null
+'quoted text' printf grep $(pwd) sed test ${HOME} readonly
+done done grep awk echo local then awk -eu -eu grep $(pwd) x=1 "$@" test 2>/dev/null
+	| -eu ${HOME} local awk x=1 export sed export 2>/dev/null export -eu test done
+'quoted text' done printf local then /usr/bin
+		cd grep 2>/dev/null readonly x=1 -eu done export
+"$1" --verbose 2>/dev/null 'quoted text' x=1 x=1 export ${HOME} | "$@"
+--verbose $(pwd) local ${HOME} sed grep
+cd $(pwd) grep grep ${HOME} cd | local "$@" | | awk 2>/dev/null echo --verbose
+		&& && local --verbose local 2>/dev/null test export
+		export local local printf ${HOME} test export cd readonly -eu 2>/dev/null -eu 'quoted text'
+		export "$@" readonly -eu done 'quoted text' $(pwd) echo "$1" "$@" /usr/bin
+test export awk 'quoted text' ${HOME}
+		printf test "$@" local grep /usr/bin --verbose cd -eu export
+$(pwd) | echo then done /usr/bin "$@" sed printf awk
+	--verbose export echo --verbose && export "$1" grep && "$@" readonly --verbose
+	"$@" | && awk test awk "$1" x=1 'quoted text'
+"$@" -eu echo readonly "$@" local
+	done echo /usr/bin local then test readonly "$1" readonly $(pwd)
+	2>/dev/null cd test x=1 /usr/bin -eu export
+		grep test readonly "$@" "$@"
+		done ${HOME} 2>/dev/null
+		$(pwd) test done awk sed sed echo printf done
+		'quoted text' $(pwd) readonly
+	local cd grep awk cd sed 'quoted text' ${HOME} done -eu done $(pwd) --verbose
+		$(pwd) /usr/bin grep /usr/bin 'quoted text'
+	echo readonly ${HOME} -eu awk readonly then readonly
+	sed -eu --verbose "$@"
+		--verbose "$1" x=1 | grep $(pwd) $(pwd) echo
+	${HOME} && "$@" --verbose | echo printf awk then $(pwd) -eu
+		local | then readonly then test awk && readonly --verbose export --verbose
+	'quoted text' x=1 2>/dev/null done cd grep printf
+		then 2>/dev/null then sed "$@" ${HOME} awk export
+readonly --verbose $(pwd) export done echo test grep cd --verbose
+printf then --verbose "$1" echo "$@" --verbose
+	$(pwd) x=1 local /usr/bin export | ${HOME} "$@" then local
+echo grep cd ${HOME} done cd | 2>/dev/null | && test
+local test ${HOME} $(pwd) test $(pwd) x=1 readonly 2>/dev/null "$@" printf
+	"$@" x=1 ${HOME} $(pwd) done done ${HOME} then | local grep
+		| /usr/bin && awk | 2>/dev/null
+x=1 --verbose | --verbose echo && $(pwd) cd printf sed x=1 "$@" then |
+		then $(pwd) cd 'quoted text' export | -eu then && sed grep then awk /usr/bin
+sed grep cd local then awk | grep x=1 --verbose | sed $(pwd)
+		/usr/bin "$@" local then printf echo readonly readonly | echo "$@" then
+		done printf then sed 2>/dev/null local local 2>/dev/null cd
+	then --verbose cd x=1 done /usr/bin done && done 2>/dev/null -eu awk
+sed printf 2>/dev/null x=1 ${HOME} grep test sed sed cd $(pwd)
+	echo | ${HOME} local $(pwd) then 'quoted text' readonly x=1 && readonly
+	$(pwd) printf then sed "$@" && 2>/dev/null export ${HOME} sed printf
+	x=1 ${HOME} ${HOME} printf echo readonly && printf cd then readonly
+export grep && printf $(pwd) --verbose
+		-eu $(pwd) echo 'quoted text' echo "$@" -eu 2>/dev/null ${HOME}
+$(pwd) ${HOME} "$1" x=1 "$1"
+| cd export x=1 "$@" 'quoted text'
+printf cd readonly local readonly
+--verbose local | | cd "$@" | grep
+		--verbose && sed sed readonly | ${HOME}
+	grep readonly awk done echo done readonly --verbose done printf sed &&
+	done x=1 readonly "$1" "$1" "$1" x=1 readonly "$@" x=1 && then
+	printf grep sed cd sed | --verbose --verbose
+	awk ${HOME} $(pwd) -eu sed &&
+		readonly done "$@" readonly "$1" local done export awk echo readonly ${HOME}
+sed readonly grep local -eu 2>/dev/null && | x=1 $(pwd) echo |
+	readonly then done 'quoted text' echo cd "$@"
+&& $(pwd) -eu readonly test local done -eu echo | "$@"
+echo done export "$@" done local printf
+${HOME} grep "$@" ${HOME} test awk then cd readonly grep test
+		| 'quoted text' awk test /usr/bin | x=1 done 'quoted text'
+	&& "$1" --verbose ${HOME} /usr/bin export "$1" sed 'quoted text' export
+		${HOME} && x=1 then grep | $(pwd) cd export | | "$1" done then awk awk readonly
+		cd grep cd "$@" then "$@" echo | | sed "$@" $(pwd) "$@" && then /usr/bin
+readonly printf $(pwd) | && $(pwd) then ${HOME} && done | echo awk --verbose
+		grep sed && cd local &&
+test export --verbose ${HOME} $(pwd)
+then | readonly "$1" done awk awk grep 2>/dev/null grep
+	2>/dev/null test awk test
+		grep 2>/dev/null "$1" -eu 'quoted text' $(pwd) readonly readonly awk echo $(pwd)
+	grep printf echo export readonly
+&& 'quoted text' done sed && done "$@" done cd echo | $(pwd)
+		"$1" test echo export /usr/bin test local printf test 'quoted text'
+	printf x=1 done && export
+		readonly -eu 'quoted text' done ${HOME} awk x=1 export cd
+	local done echo -eu $(pwd) "$1" && "$1" /usr/bin
+		'quoted text' awk 2>/dev/null done ${HOME} printf
+		grep cd local awk $(pwd) cd $(pwd) then local && local "$@" -eu
+| ${HOME} readonly readonly
+		&& export --verbose awk grep $(pwd) echo /usr/bin local "$@" -eu
+	grep done cd "$1" grep test
+	"$@" "$1" echo test local done local readonly echo echo
+	grep --verbose local printf $(pwd) 'quoted text' sed
+/usr/bin export ${HOME} cd then local awk 'quoted text' echo -eu $(pwd)
+	${HOME} && "$@" 2>/dev/null x=1 then /usr/bin | export $(pwd) |
+	x=1 | ${HOME} "$@" 2>/dev/null
+	"$1" echo 'quoted text' x=1 local && done done readonly then 2>/dev/null
+grep ${HOME} done printf | readonly "$@" /usr/bin x=1 2>/dev/null test sed x=1
+grep sed 2>/dev/null --verbose | 'quoted text'
+2>/dev/null "$@" $(pwd) echo /usr/bin --verbose
+"$1" awk printf "$1" local echo test | 2>/dev/null
+	"$1" 'quoted text' --verbose x=1
+$(pwd) -eu && -eu sed | printf readonly sed echo
+		echo "$1" "$1" x=1 readonly local ${HOME} local then sed sed test sed export
+local cd printf | export then "$1"
+	export done --verbose sed grep echo
+local x=1 "$@" grep && | /usr/bin test printf ${HOME} --verbose test
+	| export 2>/dev/null ${HOME} --verbose
+		test | export printf cd -eu -eu "$1" 'quoted text' $(pwd)
+	cd local awk "$@" done "$@" 2>/dev/null awk
+readonly test sed grep
+	| 2>/dev/null "$@" "$1" done printf cd "$@" ${HOME} 'quoted text'
+		"$1" printf "$1" x=1 "$1" readonly 'quoted text' -eu -eu && printf 'quoted text'
+		cd | "$@" "$@" "$1" grep printf then 'quoted text' cd test --verbose 2>/dev/null
+		grep -eu grep ${HOME} ${HOME} export done | test local -eu then sed && $(pwd)
+echo sed 2>/dev/null 2>/dev/null local
+		-eu then | done -eu echo ${HOME} ${HOME} && $(pwd)
+echo cd export /usr/bin readonly sed export
+		done 'quoted text' | | x=1 ${HOME}
+		done --verbose awk ${HOME} grep ${HOME} local ${HOME} local readonly "$@" -eu
+		sed --verbose | --verbose
+		--verbose readonly "$@" local done awk grep -eu then cd ${HOME}
+done --verbose | "$1" "$1" printf -eu "$1" --verbose "$@"
+	"$1" local ${HOME} 'quoted text' cd 2>/dev/null "$@" "$@" test echo --verbose
+grep --verbose 'quoted text' "$1" -eu ${HOME} "$@" 2>/dev/null 'quoted text'
+	"$1" readonly test --verbose 2>/dev/null
+	local $(pwd) awk then ${HOME} done cd && | readonly ${HOME} "$@" echo sed echo
+		$(pwd) | local printf readonly
+	2>/dev/null export echo test -eu grep | 2>/dev/null
+done -eu done test then grep /usr/bin "$@" grep echo
+		local "$1" /usr/bin x=1
+		printf /usr/bin | done sed ${HOME}
+sed export && && awk
+		$(pwd) x=1 -eu -eu printf -eu local "$1" cd export readonly local ${HOME} printf
+	sed echo awk 2>/dev/null
+	${HOME} grep "$1" "$@" sed awk awk x=1 readonly 'quoted text' echo
+		readonly export x=1 printf
+	/usr/bin -eu | && x=1 ${HOME} export && printf 2>/dev/null x=1 done
+	sed test grep export readonly /usr/bin echo sed "$@" awk 2>/dev/null
+		echo test test cd "$1" local x=1 "$1" /usr/bin printf ${HOME} grep && readonly
+	local 'quoted text' ${HOME} readonly export test |
+		'quoted text' 'quoted text' && ${HOME}
+| awk $(pwd) && awk --verbose sed "$1" /usr/bin 2>/dev/null $(pwd) readonly
+		'quoted text' -eu readonly
+		&& done 2>/dev/null echo sed "$1" printf local export sed test /usr/bin
+done done printf then export local test printf "$1"
+printf cd cd local readonly "$@" | printf 2>/dev/null "$@"
+	cd then export local x=1 2>/dev/null done cd --verbose
+	export printf grep ${HOME} done grep ${HOME}
+--verbose x=1 /usr/bin --verbose
+		"$1" 'quoted text' x=1 -eu cd | export then then && printf then
+	"$1" | printf 2>/dev/null 'quoted text' cd printf /usr/bin local "$1" sed
+	$(pwd) grep && printf 'quoted text' echo awk then 2>/dev/null
+		x=1 export $(pwd) -eu local "$@" && sed | cd sed printf $(pwd) $(pwd) echo
+2>/dev/null printf && $(pwd) ${HOME}
+	"$@" cd | "$@" sed export --verbose awk readonly
+	/usr/bin echo 2>/dev/null echo "$@" grep local then x=1 $(pwd) x=1 awk
+--verbose readonly /usr/bin printf --verbose x=1 done readonly
+		grep sed | /usr/bin then $(pwd) "$@" $(pwd) export grep 2>/dev/null
+		echo "$1" $(pwd) awk | readonly test test 'quoted text' | awk printf |
+${HOME} 'quoted text' "$1" -eu done | printf
+	awk then 'quoted text' "$@" "$@" printf | echo local 2>/dev/null -eu "$1" then
+readonly ${HOME} echo echo
+x=1 x=1 test done export awk sed x=1 x=1 printf $(pwd)
+		$(pwd) then cd local && printf /usr/bin sed
+	local 2>/dev/null export 'quoted text' && $(pwd) 2>/dev/null
+		'quoted text' printf awk --verbose awk 2>/dev/null done grep 'quoted text'
+	readonly -eu | local && 'quoted text' x=1 grep 'quoted text' "$1" grep
+		then | --verbose -eu echo && 'quoted text' sed export export then grep readonly
+sed "$@" echo "$@" -eu --verbose $(pwd) printf $(pwd) then
+test cd readonly && printf sed 2>/dev/null sed 'quoted text'
+done -eu cd cd sed ${HOME} ${HOME} grep readonly echo --verbose x=1 printf cd
+export ${HOME} && 'quoted text' $(pwd) --verbose x=1 | echo export 2>/dev/null
+		"$1" "$1" -eu then echo /usr/bin ${HOME} | cd cd export x=1
+cd test done test echo local sed test /usr/bin
+		$(pwd) awk export ${HOME} ${HOME}
+		--verbose x=1 2>/dev/null 'quoted text' grep | 2>/dev/null printf -eu "$@" grep
+		x=1 then "$1" -eu | local 2>/dev/null readonly done done
+x=1 2>/dev/null "$1" $(pwd) grep /usr/bin grep ${HOME}
+	test && grep readonly then then x=1 x=1 sed -eu
+	local grep awk /usr/bin sed sed then grep "$1" local x=1 && test grep
+	printf test export readonly echo awk | export echo 2>/dev/null "$@" "$1"
+		test ${HOME} sed 'quoted text'
+	echo local cd grep done ${HOME} local printf awk --verbose sed printf test
+		x=1 $(pwd) echo "$1" x=1 local "$1" /usr/bin readonly cd --verbose
+"$1" export then echo ${HOME} then 2>/dev/null test readonly
+2>/dev/null sed ${HOME} test awk --verbose then echo readonly
+grep cd -eu test | "$@" test /usr/bin test sed 2>/dev/null readonly
+		2>/dev/null awk test x=1 done test ${HOME} "$1" "$1" done echo printf && test
+		readonly done done -eu export export
+	readonly grep echo readonly awk readonly printf
+		2>/dev/null ${HOME} done printf
+printf local "$@" sed -eu export 2>/dev/null --verbose grep export
+2>/dev/null "$@" cd -eu --verbose
+		| -eu sed grep "$1" "$@" ${HOME} ${HOME} sed /usr/bin ${HOME}
+	echo echo $(pwd) /usr/bin 'quoted text' "$@" /usr/bin test local local $(pwd) |
+	echo printf | 'quoted text'
+		awk /usr/bin readonly
+	cd | export cd ${HOME} export then 2>/dev/null
+cd --verbose local /usr/bin then | sed test then printf
+	| grep $(pwd) cd x=1 "$1" 2>/dev/null
+		echo cd readonly x=1 test grep then printf ${HOME} 'quoted text'
+x=1 done "$1" awk export then | readonly 2>/dev/null --verbose
+	echo && ${HOME} /usr/bin | done "$@" export 2>/dev/null export printf $(pwd)
+		printf grep cd "$@" local done printf local 2>/dev/null echo sed done ${HOME} local
+		local "$@" -eu ${HOME} then echo -eu done grep local
+		"$@" /usr/bin done x=1 --verbose grep | readonly 'quoted text'
+		sed $(pwd) && export 2>/dev/null sed then ${HOME} --verbose
+	'quoted text' 2>/dev/null "$@" echo --verbose sed /usr/bin printf 2>/dev/null
+/usr/bin awk cd printf 'quoted text' && ${HOME} local
+$(pwd) 'quoted text' grep && test echo grep printf then
+		echo | printf done test | sed readonly
+	"$1" local "$1" x=1 echo | sed done | grep
+		2>/dev/null && cd 2>/dev/null grep x=1 /usr/bin | -eu | "$@" readonly $(pwd)
+export local echo sed && sed /usr/bin awk printf -eu echo x=1
+then then x=1 && sed cd done $(pwd) ${HOME} grep ${HOME}
+	| then /usr/bin ${HOME} /usr/bin x=1 $(pwd) "$@" printf "$@" local
+--verbose /usr/bin ${HOME} 2>/dev/null && grep echo 2>/dev/null done
+	grep grep && done echo "$1" grep echo -eu test readonly -eu && "$1" awk readonly
+echo 'quoted text' readonly | grep |
+		echo --verbose awk then grep $(pwd) sed test local grep export && 'quoted text'
+		grep test 'quoted text' 'quoted text' test $(pwd) export
+		&& awk "$1" export grep
+	grep test readonly awk sed local export printf
+	done "$@" 'quoted text' sed $(pwd) && printf awk $(pwd) && grep grep cd
+-eu local printf export done then test
+readonly local printf cd echo local export "$1" done -eu "$1" 'quoted text'
+	--verbose sed "$1" x=1 export cd export then
+	"$@" done readonly export --verbose --verbose -eu ${HOME} "$@" awk
+	then "$@" done test printf echo
+		then local 2>/dev/null --verbose x=1 awk --verbose | "$@" --verbose 'quoted text'
+| done sed --verbose then echo ${HOME} awk readonly "$@"
+	sed local $(pwd) x=1 x=1 echo --verbose
+	--verbose $(pwd) "$@" awk && --verbose then ${HOME} export printf
+"$@" 'quoted text' sed -eu "$@" "$1"
+	'quoted text' --verbose grep ${HOME} readonly
+		test sed --verbose | && grep echo awk | $(pwd)
+| awk -eu printf test echo echo cd ${HOME} export test then grep
+		'quoted text' $(pwd) 2>/dev/null printf
+$(pwd) local ${HOME} | "$@" local &&
+	${HOME} "$1" echo $(pwd) local ${HOME} then then
+--verbose printf cd then "$@" awk "$1"
+		| awk --verbose 2>/dev/null cd "$1"
+x=1 echo "$@" x=1 --verbose
+	readonly readonly ${HOME} 2>/dev/null
+	2>/dev/null x=1 2>/dev/null "$1" "$1" sed 'quoted text' | 2>/dev/null
+		x=1 /usr/bin "$1" test export "$1" cd local /usr/bin
+then /usr/bin x=1 echo then x=1 'quoted text' grep "$@" x=1 && x=1 grep export
+		printf 'quoted text' readonly /usr/bin $(pwd) --verbose 2>/dev/null
+	readonly | sed 'quoted text' /usr/bin then --verbose cd && $(pwd) /usr/bin
+		done && cd grep sed x=1 ${HOME} $(pwd) "$@" readonly awk test
+x=1 && local | grep "$@" grep
+		--verbose /usr/bin sed && echo $(pwd) sed sed test printf ${HOME}
+		cd awk printf 'quoted text' && test --verbose local readonly
+	&& export test | export export printf -eu cd
+	readonly x=1 export "$1"
+		sed ${HOME} | "$@" "$@" "$1" $(pwd) awk | 'quoted text'
+done x=1 ${HOME} echo /usr/bin printf
+	2>/dev/null sed 'quoted text' -eu
+	readonly then sed grep -eu 'quoted text' cd awk printf export
+	'quoted text' x=1 $(pwd) cd test x=1 echo && x=1 && echo -eu readonly readonly
+	echo test readonly 'quoted text' done --verbose ${HOME} done local 2>/dev/null
+		sed $(pwd) readonly "$1" /usr/bin | && "$@" /usr/bin "$@" then "$1" | cd cd --verbose
+	&& export ${HOME} 'quoted text' /usr/bin 'quoted text'
+export sed "$@" grep --verbose
+| test local 'quoted text' then local done printf export
+printf local $(pwd) $(pwd) /usr/bin then "$@"
+	x=1 | $(pwd) grep grep /usr/bin | cd grep cd -eu cd 2>/dev/null
+/usr/bin printf awk cd sed $(pwd)
+		| export awk | echo ${HOME} done ${HOME}
+'quoted text' test "$1" --verbose -eu done ${HOME}
+	&& "$1" x=1 -eu x=1 /usr/bin
+done test /usr/bin /usr/bin done readonly echo "$1" printf
+		| /usr/bin $(pwd) --verbose
+| && done sed local grep /usr/bin && "$@"
+		test $(pwd) readonly x=1
+		cd | $(pwd) grep && export
+2>/dev/null /usr/bin 2>/dev/null 'quoted text' done 2>/dev/null
+		--verbose -eu export sed /usr/bin test
+	x=1 x=1 printf grep 2>/dev/null ${HOME} export local cd
+		/usr/bin readonly x=1 "$@" /usr/bin grep sed && readonly
+	export sed local && 2>/dev/null x=1 "$1" echo
+grep export "$1" printf cd export echo sed "$@" sed readonly
+done 2>/dev/null sed /usr/bin
+	sed x=1 done /usr/bin x=1 test -eu done "$@"
+--verbose cd echo 2>/dev/null | 2>/dev/null
+	| grep ${HOME} $(pwd) grep local
+		test awk $(pwd) sed 'quoted text' | sed echo -eu sed local
+	-eu "$@" cd && "$1" echo $(pwd) done cd "$@" && $(pwd) sed
+		${HOME} printf $(pwd) printf
+		local /usr/bin cd -eu "$@"
+		grep -eu ${HOME} --verbose $(pwd) local && | test grep grep "$1" printf
+		x=1 readonly /usr/bin "$@" echo test test "$1"
+	then && echo readonly | $(pwd) "$1" ${HOME} sed awk
+	echo --verbose cd 'quoted text' awk --verbose /usr/bin "$1" then export -eu 'quoted text'
+	grep && "$@" "$1" sed $(pwd) -eu echo done --verbose
+sed "$1" local grep x=1 2>/dev/null
+	/usr/bin "$1" "$1" x=1 cd /usr/bin "$1"
+		echo /usr/bin "$@" $(pwd) echo | && "$1" test 2>/dev/null
+--verbose test | $(pwd) awk "$1" | 'quoted text' cd 'quoted text'
+	sed export then grep export "$@" then local /usr/bin $(pwd)
+local 'quoted text' then "$@" done done /usr/bin
+		done export printf "$1" /usr/bin echo /usr/bin export ${HOME} 2>/dev/null
+	'quoted text' test ${HOME} /usr/bin sed --verbose -eu $(pwd)
+	"$@" $(pwd) && test && echo done ${HOME} "$@" export 'quoted text'
+sed then done 'quoted text'
+printf local sed 2>/dev/null
+		$(pwd) -eu readonly sed 2>/dev/null $(pwd) printf /usr/bin cd &&
+		awk then printf readonly "$1" grep awk ${HOME} x=1 cd 2>/dev/null
+| "$1" 2>/dev/null /usr/bin /usr/bin sed /usr/bin cd | 'quoted text' | then x=1
+	done echo -eu --verbose sed printf sed
+		sed local local 2>/dev/null readonly cd $(pwd) awk --verbose
+${HOME} cd ${HOME} test echo $(pwd) printf export
+cd 'quoted text' then cd | done 'quoted text' "$@" printf cd readonly | done
+		then "$1" && "$@" | awk ${HOME} && "$@" grep "$@" done then /usr/bin "$@" grep
+	'quoted text' x=1 "$1" readonly echo sed $(pwd) -eu grep awk --verbose
+awk done 'quoted text' /usr/bin
+done awk done echo cd local grep "$@" "$1" --verbose x=1 $(pwd)
+	"$@" -eu export done readonly export awk export
+	-eu --verbose /usr/bin "$@" --verbose export | printf
+	&& awk then grep /usr/bin printf export 2>/dev/null
+		2>/dev/null sed test printf /usr/bin
+	done export test sed | cd echo echo test done done "$1" done
+		printf readonly export ${HOME} then x=1
+	x=1 printf then 'quoted text' && && test -eu -eu printf awk printf
+then export $(pwd) done | 'quoted text'
+		'quoted text' echo && local x=1 done grep && 2>/dev/null
+cd cd readonly 2>/dev/null
+&& export test ${HOME} --verbose
+'quoted text' "$1" --verbose | x=1 /usr/bin $(pwd)
+	2>/dev/null "$1" sed grep 'quoted text' --verbose 'quoted text' "$@" test
+		-eu $(pwd) sed | && test && echo awk $(pwd) grep ${HOME} export cd awk sed
+	readonly --verbose done test
+	awk ${HOME} | "$1" -eu 2>/dev/null
+		&& grep $(pwd) local | awk printf --verbose
+$(pwd) export --verbose export
+	--verbose ${HOME} "$@" echo -eu then
+"$@" readonly 'quoted text' | /usr/bin cd
+		/usr/bin "$@" 2>/dev/null |
+	${HOME} && export 2>/dev/null x=1 2>/dev/null "$@" 2>/dev/null grep
+		&& printf awk 2>/dev/null --verbose $(pwd) 2>/dev/null x=1
+	-eu -eu "$1" --verbose && ${HOME} "$1" local $(pwd) "$@" then /usr/bin
+		${HOME} ${HOME} --verbose awk
+$(pwd) awk --verbose grep export /usr/bin $(pwd) done 'quoted text'
+		echo 'quoted text' /usr/bin echo export "$@" -eu && export x=1
+		/usr/bin readonly test /usr/bin
+${HOME} printf export 2>/dev/null echo readonly
+		x=1 readonly printf "$1" x=1 2>/dev/null "$1" done $(pwd) test cd -eu "$1" sed
+	2>/dev/null $(pwd) && sed 2>/dev/null
+	| ${HOME} export export "$1" ${HOME} 2>/dev/null
+	echo x=1 test cd echo ${HOME} local -eu local grep ${HOME} $(pwd)
+		cd | local $(pwd) ${HOME} grep "$@" "$1" && ${HOME} cd /usr/bin
+	x=1 readonly export grep --verbose 'quoted text' -eu /usr/bin $(pwd) | then
+2>/dev/null 'quoted text' printf "$@"
+		${HOME} $(pwd) | "$@" echo --verbose
+	| export --verbose x=1 "$@" export printf x=1 'quoted text' grep export
+	printf done -eu "$@" "$@" grep test 2>/dev/null /usr/bin readonly "$1" local echo
+	export printf -eu ${HOME} local
+readonly --verbose cd awk && 'quoted text'
+	"$@" x=1 "$1" then local then awk grep awk export
+		cd $(pwd) 'quoted text' "$1" 'quoted text'
+--verbose && readonly /usr/bin -eu $(pwd) --verbose /usr/bin
+		'quoted text' "$1" then awk then readonly /usr/bin cd then export
+	'quoted text' done --verbose readonly
+		export readonly done cd sed cd "$1" export readonly echo
+--verbose readonly | then
+	awk grep local /usr/bin sed awk export "$1" then x=1 done export 2>/dev/null
+		sed then then readonly done done cd -eu then echo
+	test | && cd /usr/bin echo && grep test awk done
+		grep cd test | "$@" readonly then -eu $(pwd) "$1" "$1" "$@" test test
+test && "$@" cd x=1 test --verbose --verbose
+${HOME} test $(pwd) export echo printf && /usr/bin --verbose
+'quoted text' x=1 x=1 sed "$@" grep | sed x=1 "$@" test x=1
+		test then ${HOME} "$@" sed export local test 'quoted text'
+"$@" --verbose $(pwd) cd
+--verbose ${HOME} awk readonly sed grep export && /usr/bin sed -eu then 'quoted text'
+	printf $(pwd) done "$1" readonly sed sed sed 2>/dev/null "$1" --verbose
+		printf --verbose | sed awk done printf --verbose "$1"
+		readonly then export "$1" /usr/bin export ${HOME} "$@" $(pwd)
+		2>/dev/null readonly awk sed
+		"$1" ${HOME} awk x=1 done -eu 2>/dev/null
+	test grep done 'quoted text' awk "$@" done 2>/dev/null sed
+export --verbose cd && echo sed "$1"
+	"$1" awk ${HOME} $(pwd)
+	'quoted text' awk cd ${HOME} local "$@" grep
+	cd ${HOME} then 'quoted text' "$1" local then $(pwd) printf export
+cd test | grep sed | done printf grep "$@" $(pwd)
+	grep readonly ${HOME} grep 2>/dev/null 'quoted text' /usr/bin --verbose done
+	then "$1" x=1 /usr/bin "$@" test && readonly export 'quoted text' --verbose "$1"
+	done then -eu 'quoted text' ${HOME} /usr/bin "$@" printf && | echo $(pwd)
+	${HOME} && sed sed --verbose grep "$1" --verbose x=1 /usr/bin readonly readonly
+done cd test awk x=1 "$@" awk grep done $(pwd)
+	2>/dev/null /usr/bin /usr/bin then awk grep 'quoted text' export "$1" | cd
+	test "$1" readonly export | --verbose ${HOME} /usr/bin && | $(pwd) awk --verbose
+	$(pwd) && x=1 'quoted text' --verbose 2>/dev/null ${HOME} local then
+	local $(pwd) "$@" export done test ${HOME} $(pwd) done "$@"
+then export printf && readonly --verbose $(pwd)
+	${HOME} readonly "$1" export
+	local test --verbose --verbose readonly test
+		'quoted text' ${HOME} done awk -eu grep 2>/dev/null
+readonly awk echo sed test 2>/dev/null "$@" -eu done
+${HOME} "$@" readonly printf sed readonly --verbose cd local
+	2>/dev/null export && sed sed | then test then printf x=1
+		echo "$@" printf cd then /usr/bin
+		grep then awk -eu "$1" then "$@" cd | 2>/dev/null && echo
+		x=1 test echo grep 2>/dev/null /usr/bin
+| cd | sed cd | 'quoted text' export ${HOME}
+	--verbose awk echo local | | printf x=1 | awk -eu cd test ${HOME}
+"$1" | $(pwd) x=1 test grep "$@" 'quoted text'
+		readonly readonly && $(pwd) grep done
+printf ${HOME} --verbose test --verbose readonly sed --verbose $(pwd) 'quoted text'
+	printf 'quoted text' local 2>/dev/null
+	readonly done export /usr/bin then /usr/bin
+"$1" /usr/bin echo 'quoted text' /usr/bin readonly
+${HOME} done /usr/bin cd test printf sed x=1 "$1" echo test 2>/dev/null
+echo /usr/bin sed "$1" sed --verbose $(pwd) local 'quoted text' /usr/bin && x=1
+${HOME} "$1" -eu --verbose
+		then export local then cd "$@" local | $(pwd) awk printf echo
+local x=1 echo awk test 'quoted text' test x=1 $(pwd) "$@" done sed
+	awk --verbose --verbose | $(pwd) test then done local 'quoted text'
+		export readonly ${HOME} printf --verbose
+	&& readonly 'quoted text'
+		$(pwd) ${HOME} readonly sed ${HOME}
+"$@" --verbose -eu 'quoted text' export
+		cd "$@" | /usr/bin export done "$@" "$@" printf && awk | local awk "$1"
+		then test then /usr/bin then && local x=1 sed sed ${HOME}
+		'quoted text' -eu --verbose "$@" /usr/bin printf cd "$@"
+	"$@" x=1 "$1" sed | && then ${HOME} x=1 'quoted text' then "$1" local -eu ${HOME}
+	-eu sed printf $(pwd) test echo | /usr/bin then local grep ${HOME}
+		x=1 sed $(pwd) echo done && printf done "$1" ${HOME} 2>/dev/null ${HOME} | awk
+	echo grep x=1 ${HOME} printf /usr/bin x=1 cd echo /usr/bin $(pwd) done
+		export && -eu "$@" test -eu x=1 then "$@" --verbose
+	2>/dev/null cd /usr/bin --verbose
+	--verbose | done export test
+	--verbose ${HOME} | --verbose
+"$1" /usr/bin "$1" /usr/bin -eu $(pwd)
+		readonly | then ${HOME} $(pwd) | "$@" readonly awk echo echo echo | &&
+${HOME} echo echo -eu && test cd test local /usr/bin $(pwd)
+		local -eu echo "$1" --verbose sed ${HOME} printf export cd && done export "$@"
+	| $(pwd) "$@" printf then then sed && test done test "$1" then
+	test --verbose x=1 grep then && export
+		--verbose cd -eu done -eu "$@" printf export /usr/bin readonly
+${HOME} readonly "$@" readonly grep ${HOME} done /usr/bin awk | | 2>/dev/null "$1"
+		&& cd | echo x=1 awk --verbose grep then awk test
+	export --verbose sed | printf awk done then
+	"$1" /usr/bin --verbose 'quoted text'
+	'quoted text' "$1" "$1" grep
+	readonly 'quoted text' export awk $(pwd)
+		"$@" --verbose x=1 "$@" printf echo grep 'quoted text' --verbose local
+	test x=1 $(pwd) --verbose --verbose 'quoted text'
+	awk 2>/dev/null --verbose ${HOME} cd && 2>/dev/null local grep
+		local done awk -eu /usr/bin cd
+		'quoted text' export awk 'quoted text' done "$@" ${HOME} 'quoted text'
+		done local x=1 grep 'quoted text' x=1 -eu $(pwd) "$@" test -eu cd /usr/bin x=1
+		local | test then 'quoted text' | grep /usr/bin then printf printf
+	test --verbose awk "$1" 'quoted text' sed printf
+	${HOME} $(pwd) awk sed printf printf 2>/dev/null 2>/dev/null
+| && printf -eu export $(pwd) "$1" sed done
+awk $(pwd) readonly 2>/dev/null
+	readonly $(pwd) echo grep x=1 sed test x=1 -eu /usr/bin x=1 | ${HOME}
+		| readonly --verbose && "$@" x=1 $(pwd) echo && --verbose readonly
+	'quoted text' -eu printf /usr/bin export done
+done | readonly "$@" done /usr/bin 2>/dev/null -eu "$@" done --verbose
+		-eu "$1" echo done && && "$1" test "$1" local
+		readonly sed | grep local -eu export awk "$1" ${HOME}
+	'quoted text' "$@" export ${HOME} "$1" printf x=1 grep
+	| printf sed printf local
+--verbose export readonly
+"$@" "$1" export 2>/dev/null && sed readonly -eu then
+		| done $(pwd) 2>/dev/null then |
+	"$@" printf ${HOME} 'quoted text'
+	x=1 "$@" 'quoted text' echo cd --verbose && readonly cd $(pwd) ${HOME} ${HOME} 'quoted text'
+	done /usr/bin echo "$@" --verbose readonly
+		--verbose && | --verbose 'quoted text'
+		then readonly cd $(pwd) then x=1 $(pwd) grep local 2>/dev/null done ${HOME}
+readonly echo 'quoted text' export 2>/dev/null local test --verbose test 'quoted text'
+echo && "$@" 2>/dev/null "$@" ${HOME} echo sed "$@" echo $(pwd) sed
+2>/dev/null then 2>/dev/null awk
+x=1 | sed "$1" x=1 grep ${HOME} then | echo test -eu
+test -eu local "$@" /usr/bin "$@" done
+		printf /usr/bin | 'quoted text'
+	${HOME} && /usr/bin sed && x=1 readonly printf export "$1"
+awk --verbose then /usr/bin local $(pwd) done && test test cd grep local
+	awk ${HOME} sed "$1" && readonly
+	/usr/bin then echo test awk "$1" export && && /usr/bin x=1 ${HOME}
+		2>/dev/null readonly "$1" ${HOME} --verbose
+		$(pwd) awk | sed "$@" done then grep sed sed done grep && "$@"
+then echo cd 2>/dev/null "$@" 'quoted text' /usr/bin
+'quoted text' printf test x=1 done
+-eu -eu "$@" x=1 'quoted text' "$1" | ${HOME} $(pwd) sed
+		-eu echo x=1 local 2>/dev/null cd
+	--verbose ${HOME} "$1" local echo "$@"
+		-eu test grep /usr/bin
+&& -eu $(pwd) $(pwd) $(pwd) | && "$@" echo echo /usr/bin echo awk $(pwd) && printf
+"$1" printf readonly ${HOME} awk test 2>/dev/null x=1 2>/dev/null
+		/usr/bin test local grep printf test awk "$1" 'quoted text' grep
+	grep export "$1" "$@" export 2>/dev/null ${HOME} | --verbose readonly then
+local | readonly "$1" echo 2>/dev/null
+		awk cd local $(pwd) /usr/bin then cd export export
+&& 2>/dev/null ${HOME} local export | "$1"
+		'quoted text' then /usr/bin
+	--verbose export $(pwd)
+	echo 2>/dev/null /usr/bin && printf grep -eu && x=1 x=1 readonly x=1 -eu printf
+	sed 'quoted text' export ${HOME} cd $(pwd) 'quoted text' "$1" sed printf
+echo local export done | readonly ${HOME} done
+	export /usr/bin grep ${HOME} 'quoted text' 2>/dev/null test sed "$@"
+		/usr/bin readonly export export test test $(pwd) test sed done
+cd readonly | awk && done 'quoted text' -eu local "$1" export 'quoted text'
+	"$1" "$1" sed grep grep printf 'quoted text' | echo
+x=1 test done -eu | $(pwd) 2>/dev/null cd awk
+		awk cd readonly -eu "$@" cd grep
+x=1 export /usr/bin grep cd awk
+		'quoted text' 'quoted text' -eu awk readonly test x=1 'quoted text' export
+		2>/dev/null readonly "$@" local ${HOME} then
+	test printf then printf readonly
+$(pwd) printf done export then readonly | local grep
+	'quoted text' | | && cd
+		echo -eu "$@" then local "$@" printf readonly echo awk awk awk && done then sed
+		x=1 -eu -eu && cd done /usr/bin printf readonly echo readonly test "$@"
+test sed "$1" ${HOME} -eu 'quoted text' done sed readonly done
+		/usr/bin x=1 -eu then done sed 'quoted text' "$1"
+		--verbose "$1" 2>/dev/null x=1 ${HOME} then done sed "$1"
+		&& ${HOME} x=1 $(pwd) awk
+		'quoted text' test echo 'quoted text'
+		-eu 'quoted text' echo
+test -eu done x=1 && -eu "$1" cd
+		sed "$@" --verbose echo grep then --verbose "$@" ${HOME} sed readonly
+		&& /usr/bin readonly awk then 'quoted text' awk 'quoted text' done
+$(pwd) sed done done done then export
+		done sed "$1" readonly | x=1 readonly x=1 /usr/bin && x=1 printf cd $(pwd) | echo
+$(pwd) | /usr/bin cd export done readonly export echo
+		"$@" then $(pwd) then -eu awk --verbose
+	$(pwd) "$1" cd ${HOME} 2>/dev/null grep | "$1" local
+		readonly && --verbose cd && then 2>/dev/null export | -eu local
+	2>/dev/null cd then --verbose
+		2>/dev/null sed --verbose | sed local $(pwd) then -eu x=1 printf
+		/usr/bin echo sed sed | 2>/dev/null 'quoted text' done --verbose cd /usr/bin
+		x=1 then 2>/dev/null "$@" "$@" ${HOME} 2>/dev/null done
+		--verbose "$@" ${HOME} local export awk && "$1" grep $(pwd) grep
+		2>/dev/null && $(pwd) 'quoted text' test cd echo | "$@"
+		export 'quoted text' ${HOME} | && export sed "$1" x=1 sed test done /usr/bin
+		&& "$@" x=1 --verbose /usr/bin $(pwd)
+		echo then --verbose 2>/dev/null -eu && local grep "$1" printf sed
+"$@" --verbose | export
+	grep echo readonly test | test x=1 printf cd done --verbose
+		/usr/bin awk /usr/bin "$1" /usr/bin | test sed --verbose "$@" 2>/dev/null
+		&& 2>/dev/null readonly "$@" sed 'quoted text' | "$1" readonly 'quoted text'
+	printf test awk grep then x=1 local 2>/dev/null ${HOME}
+		| echo then && echo /usr/bin printf export done
+	$(pwd) test --verbose cd && $(pwd) printf awk awk | 'quoted text'
+		done && $(pwd) /usr/bin sed /usr/bin cd done
+		2>/dev/null $(pwd) x=1 awk cd cd echo then
+'quoted text' test ${HOME} local && ${HOME} grep /usr/bin | then "$@" local
+/usr/bin local awk then "$@" --verbose -eu "$1" grep cd then grep
+		--verbose "$@" && "$1" -eu /usr/bin
+	/usr/bin 2>/dev/null echo "$@"
+then 2>/dev/null cd $(pwd) "$1" grep x=1 done sed x=1 cd -eu && export
+	2>/dev/null && export export
+$(pwd) printf test then "$1" | /usr/bin sed readonly local grep done
+-eu grep $(pwd) "$1" done grep --verbose test test 'quoted text'
+	readonly local x=1 grep readonly printf
+		x=1 x=1 local 2>/dev/null cd grep
+		done test cd $(pwd) grep awk
+		sed echo $(pwd) "$@" test export readonly readonly 2>/dev/null x=1 $(pwd) -eu grep
+	done grep echo "$1" test && test
+	${HOME} ${HOME} | -eu && then local export cd printf local $(pwd) readonly
+		grep -eu readonly /usr/bin --verbose
+	2>/dev/null $(pwd) x=1 grep done ${HOME}
+$(pwd) echo ${HOME} echo readonly then sed export readonly
+	| readonly && local 'quoted text' ${HOME}
+		sed readonly echo /usr/bin awk && && done
+		&& cd "$@" local "$1" 2>/dev/null then | cd echo
+		echo export ${HOME} /usr/bin echo /usr/bin awk | $(pwd) sed echo awk echo "$@"
+		2>/dev/null done local then export awk grep test then then x=1
+		readonly printf awk done
+		printf && | --verbose ${HOME} $(pwd) $(pwd)
+grep readonly readonly "$@" awk cd printf | 2>/dev/null
+cd "$1" sed cd --verbose then 2>/dev/null 'quoted text' /usr/bin x=1 export echo
+		"$@" echo local 2>/dev/null "$1" && -eu --verbose
+/usr/bin 2>/dev/null readonly /usr/bin "$1" readonly
+		x=1 | done grep ${HOME} awk /usr/bin ${HOME} test
+	awk readonly $(pwd) --verbose | local sed done readonly /usr/bin | | 2>/dev/null
+	printf -eu 'quoted text' readonly
+		local printf "$1" then 'quoted text' ${HOME} echo 'quoted text' local
+"$@" grep | /usr/bin done -eu "$1"
+x=1 readonly awk printf /usr/bin readonly $(pwd) test -eu --verbose /usr/bin
+		/usr/bin /usr/bin done --verbose done "$@" sed
+		x=1 sed "$@" 'quoted text' "$@" $(pwd) "$1" 2>/dev/null
+printf done readonly sed then x=1 awk echo local readonly printf awk
+		echo grep local /usr/bin then sed test done printf 2>/dev/null /usr/bin
+	cd cd 2>/dev/null && test ${HOME} cd "$@" "$1" echo --verbose awk x=1
+		echo export 2>/dev/null test /usr/bin done
+--verbose $(pwd) 2>/dev/null -eu --verbose "$@" done 'quoted text'
+		${HOME} cd grep cd then export then --verbose grep 'quoted text' x=1
+		"$1" echo ${HOME} then $(pwd) ${HOME} --verbose
+		then local "$1" --verbose awk done $(pwd) "$@" then test export echo "$@" $(pwd)
+	printf $(pwd) export ${HOME} printf 'quoted text' ${HOME} then printf
+		grep -eu grep ${HOME} | x=1 awk sed printf
+		'quoted text' echo echo done x=1 'quoted text' done 'quoted text' sed sed x=1
+	"$1" echo local grep grep awk test awk | readonly
+/usr/bin cd && then cd export && readonly
+		-eu --verbose 2>/dev/null | "$1" x=1
+done 2>/dev/null -eu cd grep cd
+	$(pwd) readonly export readonly 'quoted text' local 'quoted text' 'quoted text'
+	echo "$1" sed $(pwd) x=1 export
+x=1 done local && 2>/dev/null
+	x=1 export "$1" done $(pwd) grep awk grep export cd "$@" then done
+		grep "$@" && | grep awk awk --verbose done done echo "$@"
+		cd sed && sed $(pwd)
+export sed -eu local /usr/bin "$@" $(pwd)
+		x=1 'quoted text' 'quoted text' -eu --verbose $(pwd)
+	x=1 sed ${HOME} then --verbose done test $(pwd) sed
+readonly readonly test awk local awk ${HOME}
+&& then awk ${HOME} test "$1" ${HOME} test sed
+	2>/dev/null done -eu ${HOME} ${HOME} grep -eu local sed -eu /usr/bin
+${HOME} "$@" x=1 && ${HOME} then 'quoted text' x=1 x=1 2>/dev/null
+		&& local && printf awk grep -eu test cd && printf 2>/dev/null
+	echo export grep && --verbose && $(pwd)
+cd sed "$@" echo readonly
+&& test sed && x=1 test --verbose grep | echo --verbose
+		x=1 cd -eu printf | "$@" "$@" local "$@" "$@" grep
+		'quoted text' readonly export
+grep x=1 cd && && printf
+${HOME} printf cd | "$@" "$1" 'quoted text' test | done "$@" ${HOME}
+done local && | && test 2>/dev/null | "$1" local cd grep 'quoted text' readonly
+		readonly ${HOME} sed grep | sed | 'quoted text'
+	local printf sed /usr/bin readonly then "$@" ${HOME} done | 'quoted text'
+then -eu awk grep && $(pwd)
+		| sed printf test | 2>/dev/null local cd && grep awk test sed cd $(pwd)
+		local local cd sed grep $(pwd) $(pwd) printf sed 2>/dev/null local local
+		local export test then "$1"
+then awk grep -eu then -eu export -eu readonly ${HOME} "$@" $(pwd) test
+	${HOME} awk grep | /usr/bin
+		'quoted text' /usr/bin "$@" done
+		${HOME} cd sed export 2>/dev/null test then awk export ${HOME}
+	done "$@" x=1 | --verbose readonly
+		cd cd grep grep export x=1 "$@" 2>/dev/null /usr/bin
+export readonly echo --verbose "$1" echo /usr/bin 'quoted text'
+	$(pwd) "$@" readonly $(pwd) echo cd |
+readonly sed --verbose test export local local
+	"$@" $(pwd) | sed --verbose echo done test $(pwd)
+	'quoted text' then then test
+		-eu && cd awk echo && export printf echo test readonly awk grep
+$(pwd) then --verbose done $(pwd) sed
+		$(pwd) sed sed local echo then readonly then printf grep awk export test
+		cd --verbose sed local $(pwd) then -eu
+		${HOME} $(pwd) then echo test cd cd ${HOME}
+'quoted text' /usr/bin echo /usr/bin export
+${HOME} test readonly && export cd -eu awk x=1 2>/dev/null
+local local printf export "$1" export then readonly "$@" /usr/bin x=1 printf cd
+		grep cd echo readonly 2>/dev/null -eu /usr/bin echo | awk cd then
+2>/dev/null done && awk sed 'quoted text' test local sed "$1" &&
+		"$1" local /usr/bin 'quoted text' | && "$1" sed --verbose then then local
+	cd sed done "$1" readonly 2>/dev/null --verbose readonly
+		/usr/bin echo then -eu test local awk &&
+		printf done local -eu local export then 'quoted text' ${HOME} "$1" printf grep
+		x=1 local x=1 printf 2>/dev/null then local echo cd grep export
+awk x=1 grep done x=1
+		sed /usr/bin $(pwd) cd x=1 ${HOME} readonly && "$@" then 2>/dev/null /usr/bin
+	sed -eu export local awk |
+		done then sed 'quoted text' 2>/dev/null awk awk done -eu sed /usr/bin
+	local ${HOME} "$@" && grep 2>/dev/null grep readonly --verbose "$@" ${HOME}
+		2>/dev/null 2>/dev/null grep "$1"
+	2>/dev/null test "$@" awk export echo then | test readonly "$@" "$@"
+local -eu cd grep test x=1 readonly grep 2>/dev/null printf --verbose local
+	local x=1 local 2>/dev/null /usr/bin 2>/dev/null
+		export echo cd /usr/bin | -eu done /usr/bin ${HOME} awk readonly
+		"$1" export done printf ${HOME} done test /usr/bin 2>/dev/null | grep local readonly
+		printf /usr/bin "$1" grep 2>/dev/null echo echo export test done
+		$(pwd) then 2>/dev/null echo x=1 2>/dev/null
+	test 'quoted text' printf 2>/dev/null
+	&& --verbose /usr/bin local 'quoted text' 'quoted text'
+		awk echo done /usr/bin | awk | 2>/dev/null printf printf export $(pwd)
+		${HOME} && readonly then local then echo 'quoted text' 'quoted text'
+	grep -eu ${HOME} "$@" then && test test done | grep awk grep sed then echo
+	then "$@" test printf cd -eu export export
+		"$@" "$1" -eu | ${HOME} echo then export local done local $(pwd) ${HOME} x=1 --verbose
+$(pwd) awk sed cd --verbose 2>/dev/null cd readonly $(pwd)
+$(pwd) echo test x=1 awk ${HOME} sed grep grep "$1" | -eu
+		echo "$1" "$@" "$1" printf 2>/dev/null echo /usr/bin sed then printf then
+	"$@" "$@" "$1" /usr/bin awk /usr/bin && 2>/dev/null
+		2>/dev/null cd "$@" --verbose test printf cd local
+	'quoted text' ${HOME} export local 'quoted text' "$@" local "$@" echo "$@" ${HOME}
+		local "$1" x=1 awk --verbose 'quoted text' then 2>/dev/null printf &&
+	"$@" grep test printf local | echo then --verbose sed cd 'quoted text' readonly
+		done 'quoted text' /usr/bin /usr/bin
+done echo then sed echo readonly test "$1" export
+		'quoted text' "$1" test --verbose echo /usr/bin grep && "$@"
+	2>/dev/null "$1" done 'quoted text' local readonly export test
+--verbose && printf --verbose /usr/bin cd echo "$@" -eu printf sed export
+"$1" /usr/bin && grep awk then awk echo test /usr/bin --verbose
+	"$1" "$1" export "$@" cd /usr/bin 'quoted text'
+		"$1" x=1 local 'quoted text' test local awk $(pwd) cd "$1" 2>/dev/null
+	--verbose --verbose awk done "$@" --verbose
+	'quoted text' cd printf sed | grep awk local local test --verbose readonly
+	grep printf cd x=1 x=1 | "$@" ${HOME} "$1" printf echo export
+local x=1 | && -eu grep $(pwd) x=1 && -eu
+test awk done $(pwd) cd sed test | 'quoted text'
+2>/dev/null then 2>/dev/null readonly grep /usr/bin | export sed /usr/bin
+${HOME} && "$@" local echo 'quoted text' | 'quoted text'
+-eu printf && awk "$@" done "$1" printf
+export "$1" | then echo "$@" local awk
+	2>/dev/null -eu 'quoted text' 2>/dev/null
+cd test "$1" && printf 'quoted text' x=1 ${HOME} echo
+		x=1 test | ${HOME} 'quoted text' $(pwd) local done awk test --verbose | sed
+	readonly -eu 2>/dev/null awk sed -eu /usr/bin ${HOME} -eu test readonly
+echo $(pwd) /usr/bin 'quoted text' -eu export grep && 2>/dev/null
+	then --verbose --verbose export 'quoted text' readonly "$@" 2>/dev/null
+	x=1 export && local awk -eu echo export && done -eu
+	sed --verbose echo printf ${HOME} --verbose 'quoted text' ${HOME} && "$@" readonly
+	test && "$@" then cd printf ${HOME} cd test done printf | grep x=1 "$1" 2>/dev/null
+	export --verbose then printf ${HOME} && ${HOME} 'quoted text' | "$1" x=1
+then x=1 /usr/bin cd /usr/bin x=1
+--verbose awk test 'quoted text' -eu 2>/dev/null ${HOME} | test done test done
+'quoted text' grep awk echo ${HOME} cd 2>/dev/null
+sed readonly $(pwd) ${HOME} -eu export x=1 -eu /usr/bin echo
+		cd cd $(pwd) /usr/bin
+		cd | readonly /usr/bin sed "$@" --verbose $(pwd) cd $(pwd) readonly echo
+	awk x=1 /usr/bin 2>/dev/null cd
+		test then test --verbose --verbose grep 'quoted text' 2>/dev/null local "$1" done
+	--verbose cd 2>/dev/null then echo echo "$1" then 2>/dev/null grep -eu grep --verbose
+		awk sed "$1" echo "$@" 'quoted text' | echo /usr/bin done /usr/bin
+printf test readonly --verbose "$1" "$@" /usr/bin test | /usr/bin awk x=1 'quoted text'
+	awk "$1" done echo /usr/bin export | "$@"
+--verbose echo sed awk ${HOME} 'quoted text' -eu export 2>/dev/null
+${HOME} test cd --verbose printf
+		grep echo -eu x=1 x=1 "$1" "$1" echo 2>/dev/null export --verbose $(pwd)
+		&& printf export test $(pwd) echo readonly && ${HOME}
+	awk x=1 x=1 export sed
+		--verbose then /usr/bin ${HOME} readonly done echo | "$1" 2>/dev/null done echo
+${HOME} x=1 "$1" "$1" | 'quoted text' awk /usr/bin x=1 $(pwd) then awk 2>/dev/null
+-eu 2>/dev/null $(pwd) echo sed "$1" ${HOME} printf echo then readonly
+		then local done readonly 'quoted text' readonly then --verbose grep
+	then -eu awk awk export x=1 'quoted text' $(pwd) done awk awk then $(pwd) /usr/bin
+		x=1 done done local grep cd x=1
+		-eu printf "$@" then x=1 --verbose then "$1" cd echo
+	/usr/bin 'quoted text' printf readonly sed then "$1" /usr/bin "$1"
+		done test printf 2>/dev/null 2>/dev/null | -eu local 2>/dev/null "$@" local
+readonly --verbose sed |
+| test -eu export ${HOME} then sed cd echo -eu -eu | 'quoted text' 'quoted text'
+		&& -eu then printf cd 2>/dev/null then 'quoted text'
+		printf 2>/dev/null && -eu local
+	done done echo -eu | ${HOME} ${HOME} cd | done --verbose
+		grep --verbose 2>/dev/null $(pwd) 'quoted text' cd sed export --verbose
+		test && awk 2>/dev/null then 'quoted text' && export $(pwd) done $(pwd)
+		"$1" /usr/bin "$1" then readonly "$1" x=1 'quoted text'
+	'quoted text' local echo 'quoted text' $(pwd) local "$1"
+	x=1 grep "$1" x=1 ${HOME} --verbose done echo then -eu x=1 /usr/bin cd echo
+	printf readonly && /usr/bin readonly x=1 'quoted text' $(pwd) "$@" echo
+	--verbose cd -eu --verbose
+		"$@" echo "$@" && done "$@"
+	export --verbose $(pwd)
+		then x=1 printf grep export x=1 test ${HOME} "$1" -eu
+		x=1 export printf sed cd local done "$1" awk test test 'quoted text'
+--verbose 'quoted text' "$1" --verbose
+done ${HOME} done readonly "$@" export
+		export done x=1 echo | $(pwd) awk
+		&& ${HOME} printf /usr/bin
+		"$1" export local 2>/dev/null awk
+/usr/bin echo "$@" | awk export
+	test echo --verbose && export 2>/dev/null sed readonly 'quoted text'
+	'quoted text' done --verbose "$@" export 2>/dev/null
+		printf --verbose export done $(pwd) "$@" --verbose
+	awk && local && | test
+		"$@" "$1" test --verbose -eu test then test test x=1 cd
+2>/dev/null export cd awk awk then "$1"
+		$(pwd) "$@" then readonly /usr/bin 'quoted text' grep echo grep echo export
+sed $(pwd) "$@" | 2>/dev/null sed test
+	| grep | awk printf "$1" ${HOME} done "$1" $(pwd)
+readonly echo cd | done $(pwd) awk --verbose local ${HOME}
+export local echo /usr/bin $(pwd) && grep done grep -eu done -eu cd export &&
+echo | 'quoted text' sed
+	printf --verbose x=1 -eu
+	test 2>/dev/null 'quoted text'
+	cd 'quoted text' local local 2>/dev/null grep done awk && awk
+		'quoted text' | then && local --verbose awk then "$@" --verbose grep
+x=1 printf 'quoted text' sed "$@" $(pwd)
+		/usr/bin && /usr/bin && printf $(pwd) 'quoted text' grep -eu readonly echo
+	2>/dev/null echo | ${HOME} test --verbose sed && "$1" x=1 --verbose
+		readonly "$@" export 'quoted text'
+	done "$1" | readonly local -eu
+		/usr/bin x=1 awk sed x=1 awk x=1 --verbose
+	done /usr/bin 2>/dev/null printf x=1 sed local
+		"$@" --verbose then 2>/dev/null test x=1 test done 2>/dev/null --verbose
+| /usr/bin ${HOME} sed readonly cd x=1 $(pwd)
+	printf "$1" /usr/bin $(pwd)
+	local -eu echo done x=1 grep /usr/bin sed 2>/dev/null
+		local printf -eu "$@" --verbose | "$1" awk $(pwd)
+		2>/dev/null printf 2>/dev/null | ${HOME} export x=1 then | "$@" export
+echo printf --verbose ${HOME}
+		test "$1" readonly test sed
+$(pwd) then readonly grep printf test awk
+	| 2>/dev/null local && sed printf
+		"$@" | awk "$@" ${HOME} awk printf readonly
+"$1" | $(pwd) | readonly
+done grep test sed "$@" ${HOME} && cd cd test
+	'quoted text' 'quoted text' && /usr/bin readonly $(pwd) "$1" printf readonly
+	export sed cd && "$@" printf
+grep test cd grep readonly | test readonly 2>/dev/null test $(pwd) awk "$1" done
+done 2>/dev/null --verbose "$@" "$1"
+		done 'quoted text' then -eu readonly $(pwd) 'quoted text'
+	export awk 'quoted text' "$@" "$1"
+cd "$@" printf export /usr/bin -eu && --verbose /usr/bin
+	test x=1 done 'quoted text' /usr/bin && $(pwd) &&
+awk x=1 sed "$1" ${HOME} grep 'quoted text' grep printf
+sed -eu test 'quoted text' x=1
+		&& test 2>/dev/null ${HOME} 'quoted text'
+readonly ${HOME} printf
+	readonly | /usr/bin /usr/bin /usr/bin 'quoted text' grep
+		x=1 | cd /usr/bin -eu x=1 "$1" ${HOME} x=1 readonly sed ${HOME} && export
+&& ${HOME} then then x=1 'quoted text' echo
+export test 'quoted text' 'quoted text' -eu export "$1" sed
+/usr/bin --verbose sed echo printf x=1
+		--verbose echo 2>/dev/null ${HOME} -eu ${HOME} ${HOME} 2>/dev/null /usr/bin
+		grep | 2>/dev/null test && | cd "$1" readonly
+	&& "$@" echo ${HOME} -eu then local printf "$@" local readonly sed sed ${HOME}
+2>/dev/null --verbose "$1" x=1 sed x=1 printf 'quoted text' awk done $(pwd) grep
+"$@" | ${HOME} awk && /usr/bin 'quoted text' ${HOME}
+"$@" | sed printf then /usr/bin | --verbose "$@"
+readonly readonly echo -eu | "$1" 2>/dev/null
+		x=1 echo then then done && "$1" && "$1" echo awk x=1 -eu 2>/dev/null $(pwd) "$1"
+	grep then 'quoted text' readonly $(pwd) local done "$@" export export then
+		awk grep cd -eu x=1 awk 2>/dev/null 'quoted text' echo sed local export cd
+		2>/dev/null | cd local grep && "$1" "$1"
+	&& done readonly /usr/bin echo grep test "$1" readonly
+	sed then local 2>/dev/null export
+	grep --verbose $(pwd) then echo cd
+		echo then "$1" -eu x=1 "$@" | "$@" -eu 2>/dev/null x=1 readonly grep "$1" && -eu
+		| awk $(pwd) x=1 "$1" printf sed x=1
+readonly grep then $(pwd) "$1" 'quoted text'
+	local 'quoted text' awk sed printf
+	printf 'quoted text' "$@" "$1" grep 'quoted text' --verbose
+	2>/dev/null -eu awk 'quoted text' cd $(pwd) 2>/dev/null "$1"
+2>/dev/null test 'quoted text' | printf $(pwd) ${HOME} && grep echo
+		"$1" sed echo "$1" 2>/dev/null
+#include c142.sh
+	cd printf awk then done --verbose /usr/bin 'quoted text'
+/usr/bin /usr/bin test "$1" $(pwd) awk done awk $(pwd) "$1" cd -eu && x=1
+	&& done 2>/dev/null 'quoted text' grep x=1 sed "$1" $(pwd) then
+grep --verbose 2>/dev/null grep readonly $(pwd) echo
+${HOME} sed | grep && 'quoted text' "$1" 2>/dev/null /usr/bin
+		"$@" echo --verbose 2>/dev/null done then ${HOME}
+	--verbose sed 2>/dev/null ${HOME} --verbose
+		'quoted text' $(pwd) grep /usr/bin readonly
+		'quoted text' cd "$@" printf --verbose echo x=1 | -eu | printf sed done &&
+$(pwd) "$@" sed awk -eu cd 2>/dev/null -eu -eu 'quoted text'
+	then --verbose sed 2>/dev/null && printf export
+sed grep echo /usr/bin | x=1 "$1" ${HOME} "$1" && ${HOME}
+$(pwd) cd --verbose printf "$1" 2>/dev/null 'quoted text'
+	&& cd awk 'quoted text' x=1 awk test "$1" &&
+	done 2>/dev/null local echo test local -eu -eu "$1" readonly printf grep test awk
+'quoted text' -eu 2>/dev/null readonly export 2>/dev/null
+		local && --verbose --verbose then test printf --verbose cd "$@" x=1 --verbose
+local x=1 "$@" && printf done sed ${HOME} echo test --verbose x=1
+done grep 'quoted text' ${HOME} then grep && cd grep awk grep done 'quoted text'
+	done test done export echo test 2>/dev/null cd $(pwd) && x=1 done awk printf
+done then echo ${HOME} /usr/bin 'quoted text' "$@" echo export
+		/usr/bin 2>/dev/null | 'quoted text' "$@" cd 'quoted text' /usr/bin
+	readonly done /usr/bin /usr/bin
+	local echo grep "$@" x=1 then then -eu then sed done 2>/dev/null readonly
+2>/dev/null && cd ${HOME} export 2>/dev/null echo
+&& readonly -eu 'quoted text' readonly grep local
+	awk sed | -eu export readonly x=1 | 'quoted text' grep printf
+		"$@" 2>/dev/null "$1" --verbose
+readonly awk $(pwd) local awk awk cd local
+/usr/bin --verbose readonly
+		awk grep x=1 ${HOME} -eu sed /usr/bin "$@" done /usr/bin export --verbose 2>/dev/null
+-eu | /usr/bin && $(pwd)
+		readonly printf then && sed $(pwd) && /usr/bin test grep local
+	echo export ${HOME} 'quoted text' local
+2>/dev/null done awk x=1 printf /usr/bin
+	cd $(pwd) done then $(pwd) printf --verbose printf
+cd cd "$@" | "$1" test $(pwd) &&
+		local "$@" /usr/bin "$@" cd local readonly -eu "$1" 'quoted text' $(pwd) test
+		printf --verbose printf
+| test local "$1" 2>/dev/null
+	echo then local "$1" --verbose ${HOME} done
+echo sed printf --verbose -eu 'quoted text'
+	${HOME} export export sed && local printf && export grep cd ${HOME}
+	| echo readonly awk done then -eu grep --verbose --verbose && "$@" --verbose 2>/dev/null
+| /usr/bin 'quoted text' sed test test && /usr/bin 2>/dev/null
+readonly -eu printf sed && --verbose test awk ${HOME} done local done export &&
+printf "$@" echo done --verbose awk cd grep done export
+		export test "$@" 'quoted text' 'quoted text'
+x=1 x=1 awk "$@" grep test sed "$1" $(pwd) grep readonly export grep "$1" | local
+	--verbose done ${HOME} x=1
+		local then /usr/bin then ${HOME} readonly done awk x=1 cd 2>/dev/null cd -eu cd
+		$(pwd) readonly export awk readonly ${HOME}
+		test local "$1" x=1 done --verbose && then /usr/bin cd cd $(pwd) --verbose
+"$1" | --verbose test "$@" $(pwd) "$1" done then then --verbose
+then echo awk x=1 2>/dev/null sed x=1 --verbose readonly | printf --verbose
+	&& -eu awk "$@" x=1 $(pwd) "$1" test done | echo "$1" grep local /usr/bin
+--verbose /usr/bin local local $(pwd) then && cd then "$1" grep export "$@" export
+awk local sed 2>/dev/null 'quoted text'
+		--verbose sed $(pwd) echo --verbose sed test export -eu
+	"$@" export $(pwd) $(pwd) local export -eu 'quoted text' readonly
+		'quoted text' $(pwd) local awk ${HOME} awk 'quoted text' "$1" then grep export
+-eu $(pwd) "$@" readonly grep printf sed /usr/bin "$1" sed
+		readonly $(pwd) printf export
+		printf cd 2>/dev/null "$1" "$1" cd "$1" done
+	echo --verbose cd local sed ${HOME} sed then test "$1"
+"$@" --verbose export readonly export 2>/dev/null
+readonly 'quoted text' readonly test awk printf 'quoted text' 'quoted text'
+		cd done && readonly sed local
+		test 'quoted text' sed x=1 local "$1" -eu "$@" test readonly
+		| "$@" readonly ${HOME} | ${HOME} grep -eu done && "$1" printf readonly
+"$1" ${HOME} -eu "$1" export local echo -eu &&
+printf readonly && awk && x=1 awk 'quoted text'
+local awk $(pwd) x=1 /usr/bin ${HOME}
+	-eu readonly 2>/dev/null
+	-eu "$@" readonly awk echo cd echo
+| $(pwd) readonly echo done && --verbose
+	"$@" then grep --verbose | export &&
+--verbose --verbose ${HOME} --verbose cd --verbose "$1" -eu cd
+	'quoted text' "$@" --verbose 'quoted text' ${HOME} --verbose test ${HOME}
+	awk "$1" $(pwd) printf cd readonly | x=1 'quoted text' printf && && && "$1" /usr/bin
+	readonly awk "$@" grep ${HOME} && /usr/bin cd -eu ${HOME}
+	grep sed echo local /usr/bin $(pwd) ${HOME} export -eu x=1 /usr/bin "$@" awk
+cd 2>/dev/null "$1" x=1
+		then sed printf export --verbose
+		awk export x=1 && "$@" "$@"
+	x=1 --verbose "$@" local /usr/bin 'quoted text' -eu 'quoted text' printf readonly
+	$(pwd) done done 2>/dev/null
+	local export "$@" then done /usr/bin | "$@" readonly x=1 | /usr/bin $(pwd) export
+		awk awk 'quoted text' /usr/bin 2>/dev/null
+&& "$@" echo ${HOME} export sed
+	| local sed sed "$@" 2>/dev/null readonly
+	x=1 echo && "$1" 'quoted text' then grep local cd "$@"
+	"$@" x=1 export --verbose cd --verbose 2>/dev/null
+		then $(pwd) printf done "$@" cd grep done "$1" local printf $(pwd) then /usr/bin
+printf then awk | 2>/dev/null cd && "$1"
+	'quoted text' $(pwd) && $(pwd) /usr/bin grep grep && x=1 readonly
+echo awk grep $(pwd) ${HOME}
+cd 2>/dev/null | awk then export printf grep
+		'quoted text' $(pwd) local
+	done readonly sed sed | "$@" | 'quoted text'
+		local "$1" $(pwd) 2>/dev/null "$@" then 'quoted text' | done test test
+	/usr/bin "$@" export echo
+${HOME} 2>/dev/null && "$@" test $(pwd) echo grep x=1 /usr/bin
+		"$1" ${HOME} 'quoted text' ${HOME} /usr/bin 'quoted text'
+	x=1 ${HOME} 2>/dev/null x=1 ${HOME} local $(pwd) -eu "$@" --verbose $(pwd)
+		/usr/bin cd export /usr/bin test printf ${HOME} /usr/bin done 'quoted text'
+	done done local grep "$@" done x=1 export
+	${HOME} 2>/dev/null /usr/bin awk readonly export
+		grep && "$1" export /usr/bin --verbose | | --verbose -eu $(pwd) test done ${HOME}
+		readonly "$1" export grep export grep | export && then printf 2>/dev/null
+		"$1" export 'quoted text'
+	printf && printf test awk echo "$@" local 2>/dev/null
+	sed echo && sed $(pwd) printf done -eu | $(pwd) && "$1"
+	x=1 -eu $(pwd) ${HOME} cd | 2>/dev/null
+	awk awk 2>/dev/null echo readonly "$@" done readonly
+2>/dev/null test /usr/bin &&
+		${HOME} $(pwd) local &&
+		export 'quoted text' && then ${HOME} test test sed && grep
+$(pwd) -eu readonly | --verbose -eu | -eu && grep test
+	x=1 sed printf && 'quoted text' then && 2>/dev/null then echo
+	"$1" local $(pwd) x=1 printf && readonly /usr/bin | then cd -eu
+	x=1 echo "$1" x=1 "$@" readonly awk --verbose -eu "$@" cd echo cd x=1 then "$@"
+	/usr/bin awk && cd awk /usr/bin sed --verbose x=1 'quoted text' grep
+export $(pwd) local sed ${HOME} grep x=1 -eu export
+	awk echo --verbose sed awk x=1 2>/dev/null awk -eu "$@" test
+	export /usr/bin 2>/dev/null -eu grep && test then -eu && echo "$1" $(pwd)
+sed $(pwd) cd export ${HOME} "$1" x=1 echo
+$(pwd) 2>/dev/null done sed --verbose -eu then sed 2>/dev/null grep --verbose
+	2>/dev/null printf done | export readonly printf 'quoted text'
+	${HOME} cd cd readonly && awk grep && grep awk x=1 done sed | export echo
+| then 'quoted text' -eu done && /usr/bin --verbose test ${HOME}
+		cd --verbose -eu "$1" awk then sed
+	sed done "$@" -eu 2>/dev/null
+	$(pwd) printf done local /usr/bin --verbose test cd cd ${HOME} then sed --verbose
+	| sed $(pwd) sed awk awk done printf "$@" ${HOME} --verbose
+local awk echo ${HOME} sed 'quoted text'
+-eu readonly "$@" | -eu done -eu && 2>/dev/null printf then "$1"
+	| --verbose x=1 $(pwd) 'quoted text' echo awk -eu done awk printf
+		local --verbose awk export test
+		x=1 test export -eu -eu --verbose sed cd echo -eu cd 'quoted text' --verbose "$1"
+		awk | export && awk echo ${HOME} $(pwd) 2>/dev/null && /usr/bin "$1" grep local
+-eu -eu local 'quoted text' cd local
+	test -eu $(pwd) then cd ${HOME}
+	-eu awk grep done then 'quoted text' printf
+		'quoted text' --verbose echo local test
+	$(pwd) echo -eu -eu local cd | --verbose
+	printf local export printf printf 'quoted text' then "$@" grep 'quoted text'
+		cd "$1" && echo export && | x=1 test awk /usr/bin -eu test ${HOME}
+	printf -eu -eu grep ${HOME} export x=1 test
+	cd readonly local cd readonly "$1" && printf grep test | then
+		${HOME} cd export 2>/dev/null done
+		--verbose x=1 $(pwd) "$1" cd "$1" && ${HOME}
+	printf -eu awk --verbose && x=1 "$@" then ${HOME} then readonly 'quoted text'
+		"$1" then $(pwd) grep awk awk "$1" 2>/dev/null sed | awk sed 2>/dev/null awk
+	"$1" done sed done ${HOME} 2>/dev/null test x=1 ${HOME}
+	"$@" test local --verbose export "$1" echo then
+		awk | sed 2>/dev/null readonly | -eu && --verbose printf "$1"
+	"$@" sed "$@" 2>/dev/null echo local $(pwd) awk cd printf | done awk
+	$(pwd) "$1" then | awk readonly export
+		'quoted text' sed | sed awk
+		local grep 'quoted text' grep "$1" x=1 x=1 awk sed sed
+		'quoted text' "$@" grep && test awk --verbose "$@" --verbose
+	x=1 ${HOME} readonly cd grep -eu sed export test
+readonly $(pwd) printf grep sed grep /usr/bin 2>/dev/null grep --verbose 'quoted text'
+awk sed --verbose $(pwd)
+$(pwd) printf --verbose && echo && cd grep ${HOME} && 'quoted text' -eu | then
+		"$1" cd readonly grep "$1" export echo
+		printf $(pwd) echo awk "$@" /usr/bin | echo | export && grep $(pwd)
+	$(pwd) /usr/bin awk x=1 test export
+	--verbose export 2>/dev/null grep export grep ${HOME} $(pwd) "$1" done
+--verbose && -eu test --verbose && x=1 /usr/bin done test export $(pwd) /usr/bin
+		&& local export grep ${HOME} "$@" ${HOME}
+readonly done test | /usr/bin
+		readonly x=1 printf readonly sed ${HOME} local
+x=1 cd -eu --verbose readonly 'quoted text'
+	printf cd "$@" --verbose
+	cd done export echo done done local grep cd test echo test /usr/bin local sed |
+	"$@" grep 'quoted text' --verbose
+	$(pwd) echo sed | then $(pwd) && | echo --verbose | /usr/bin local $(pwd)
+	-eu awk 2>/dev/null --verbose local ${HOME}
+awk printf | --verbose readonly done echo then sed $(pwd) cd x=1 ${HOME} cd /usr/bin
+	echo --verbose done | then export /usr/bin "$1"
+	export && sed awk -eu test "$@" --verbose printf local && awk cd x=1 "$@"
+		-eu cd done --verbose x=1 sed -eu test && done 'quoted text'
+		local -eu local ${HOME}
+	cd ${HOME} $(pwd) | awk "$1" "$@" test "$@"
+		"$@" /usr/bin local && $(pwd) readonly /usr/bin 2>/dev/null 2>/dev/null
+	&& readonly sed echo readonly
+	x=1 -eu awk echo x=1 echo 2>/dev/null echo awk "$@" done grep test && /usr/bin
+"$1" sed --verbose done "$@" && 'quoted text' grep | cd ${HOME}
+	2>/dev/null done printf 2>/dev/null
+	&& 2>/dev/null local export -eu printf --verbose sed ${HOME} printf
+	"$@" -eu ${HOME} echo
+		cd grep export done | then cd printf sed && grep done test export ${HOME}
+		'quoted text' /usr/bin grep cd export
+/usr/bin $(pwd) --verbose grep --verbose | && "$@" ${HOME} "$1" echo --verbose
+	done local --verbose 2>/dev/null
+test sed "$@" local | then
+		sed export done then sed $(pwd) && then --verbose 2>/dev/null
+		echo && -eu x=1 -eu | $(pwd) cd /usr/bin
+		-eu /usr/bin | && ${HOME} /usr/bin
+	-eu --verbose "$@" "$1" printf readonly 'quoted text' done 'quoted text'
+	echo 'quoted text' && "$@" printf --verbose | then local cd readonly
+	printf cd 'quoted text' && cd sed export 2>/dev/null
+"$@" cd test then 2>/dev/null readonly | then then && awk -eu
+	test awk done sed grep 'quoted text'
+		readonly echo 2>/dev/null /usr/bin --verbose echo printf 2>/dev/null grep readonly
+grep grep /usr/bin printf awk readonly 'quoted text'
+		2>/dev/null local $(pwd) && --verbose
+	${HOME} --verbose awk readonly 'quoted text' printf "$@" $(pwd) -eu
+	/usr/bin grep ${HOME} sed grep --verbose sed "$@" done awk
+	| readonly "$1" local 'quoted text' export /usr/bin -eu sed ${HOME}
+-eu | printf export then echo && $(pwd) done "$@"
+		then done x=1 2>/dev/null 'quoted text' grep cd awk grep done 'quoted text'
+grep /usr/bin echo ${HOME} grep x=1
+2>/dev/null cd "$@" 'quoted text' /usr/bin cd
+	local sed awk 'quoted text' cd echo echo /usr/bin
+cd 'quoted text' awk local sed && "$1" "$1" 'quoted text' ${HOME} --verbose
+echo test | /usr/bin cd readonly
+	then awk test export test x=1 export awk grep --verbose
+	'quoted text' local ${HOME} readonly readonly /usr/bin -eu --verbose cd
+		local printf export "$1" local done && ${HOME} readonly
+		--verbose sed then /usr/bin $(pwd) 2>/dev/null awk echo grep $(pwd) && && test
+		echo then $(pwd) 2>/dev/null "$1" cd "$@" && ${HOME} --verbose
+local printf sed -eu local "$1" && local done $(pwd) readonly export
+		| done readonly "$@" "$1" then -eu local
+		x=1 "$1" cd 2>/dev/null "$1" grep done grep printf ${HOME} 'quoted text' -eu done
+		x=1 readonly $(pwd) && && grep test printf --verbose readonly local cd x=1
+$(pwd) done -eu "$1" 'quoted text'
+		"$1" grep awk "$@" local grep
+"$1" local $(pwd) -eu "$@" && $(pwd) "$1" "$@" "$@" "$1" test
+	${HOME} | /usr/bin echo x=1 grep then grep cd
+	-eu printf cd local ${HOME} cd ${HOME} | && local then grep $(pwd) readonly
+		export local /usr/bin export done export ${HOME} done export then "$1" --verbose
+	$(pwd) readonly /usr/bin done
+		2>/dev/null sed then printf 2>/dev/null -eu sed | "$1" export | "$@"
+	2>/dev/null "$@" grep then test sed --verbose then readonly local awk 2>/dev/null
+readonly sed local $(pwd) grep
+		readonly "$1" -eu "$@" done done x=1 | echo done cd --verbose | -eu /usr/bin
+		cd echo "$@" then local cd 2>/dev/null | local echo test ${HOME} echo then readonly
+	${HOME} printf -eu grep --verbose && ${HOME} grep /usr/bin awk
+		readonly "$@" local export printf
+/usr/bin cd "$1" x=1 then then &&
+		printf --verbose export printf test
+		cd /usr/bin ${HOME} "$1" sed sed echo export
+		-eu "$@" x=1 local ${HOME} 'quoted text' done ${HOME} local done -eu -eu -eu cd
+&& test x=1 && readonly awk ${HOME} then --verbose
+-eu cd -eu | then /usr/bin test test --verbose --verbose --verbose
+cd done "$1" sed 2>/dev/null /usr/bin cd local x=1 -eu "$1"
+		grep sed x=1 local done /usr/bin export export
+'quoted text' 2>/dev/null sed $(pwd) echo
+&& test /usr/bin local "$@" ${HOME} x=1 test readonly export sed sed echo
+		--verbose && -eu /usr/bin printf sed awk | readonly cd then
+	2>/dev/null cd readonly readonly -eu | sed export printf
+	"$1" | -eu "$@" /usr/bin 'quoted text' 'quoted text' -eu
+"$1" sed -eu ${HOME} && 'quoted text' 'quoted text' 2>/dev/null
+$(pwd) "$1" /usr/bin test local grep done
+sed --verbose awk 'quoted text' sed printf test $(pwd)
+2>/dev/null grep 2>/dev/null grep printf x=1 then $(pwd) grep grep local -eu
+'quoted text' readonly "$1" awk 'quoted text'
+		| $(pwd) "$@" cd then
+test ${HOME} x=1 awk 2>/dev/null --verbose echo grep done grep
+2>/dev/null readonly $(pwd) "$1" "$1"
+		cd /usr/bin ${HOME} 'quoted text' done readonly |
+		printf local && cd export
+		printf 2>/dev/null | readonly readonly | local then "$@" /usr/bin x=1 grep test
+		echo && echo sed test ${HOME} /usr/bin echo
+test 2>/dev/null $(pwd) grep sed grep x=1
+		readonly -eu echo test 2>/dev/null
+		&& | done sed --verbose cd printf | | "$1" && $(pwd) done test local | --verbose
+		awk cd /usr/bin sed $(pwd) x=1 "$@" cd grep -eu --verbose 'quoted text'
+		grep local cd x=1 | then 2>/dev/null export grep 'quoted text' echo
+	export readonly then | $(pwd) --verbose
+		printf grep "$1" x=1 done echo && 'quoted text' $(pwd) "$1"
+		grep 2>/dev/null cd 2>/dev/null grep awk /usr/bin 2>/dev/null
+echo x=1 local grep grep "$1" test "$@" "$@" sed done "$1"
+test grep printf 2>/dev/null
+	-eu grep ${HOME} /usr/bin
+"$1" test && | grep readonly local then "$@" awk "$@" "$1" "$@"
+printf printf local /usr/bin 2>/dev/null test awk -eu
+		"$1" | local 'quoted text' 'quoted text' readonly grep ${HOME} local
+	${HOME} /usr/bin test readonly
+	2>/dev/null export 2>/dev/null done done awk printf --verbose
+| cd local "$1" then then readonly --verbose
+| -eu printf --verbose test 'quoted text'
+	grep cd sed export sed sed test "$1" then $(pwd) 2>/dev/null -eu
+	cd 'quoted text' export sed export done && readonly then
+		test printf "$@" 'quoted text' cd echo sed done
+sed test then printf test --verbose --verbose sed readonly
+		test ${HOME} done -eu x=1 done x=1 export
+	echo test local cd echo awk 'quoted text'
+		local "$1" local --verbose then local /usr/bin x=1 | echo local "$@"
+	'quoted text' printf "$@" local printf $(pwd) /usr/bin -eu done then
+		-eu /usr/bin 'quoted text'
+	${HOME} awk export printf readonly && readonly "$1" x=1 ${HOME} -eu
+	printf export && -eu
+	test done echo -eu grep "$@" export readonly ${HOME} /usr/bin
+"$@" done done $(pwd) test awk local x=1 export
+		| readonly done "$1" ${HOME} sed /usr/bin grep echo sed grep sed grep | 2>/dev/null
+'quoted text' $(pwd) /usr/bin | export /usr/bin --verbose
+cd --verbose printf "$1" done -eu | test then $(pwd) 'quoted text' then
+		export grep 'quoted text'
+		test x=1 cd sed 'quoted text' ${HOME} 2>/dev/null export 2>/dev/null /usr/bin "$@"
+	grep ${HOME} /usr/bin --verbose then $(pwd) printf "$1" grep
+then sed ${HOME} local 'quoted text' /usr/bin then /usr/bin echo echo -eu --verbose
+		-eu export ${HOME} "$1" $(pwd) awk $(pwd) local
+	x=1 $(pwd) -eu x=1 done /usr/bin
+	&& --verbose -eu done awk sed --verbose $(pwd) then "$1"
+| "$1" awk "$1" then test
+"$1" | sed cd echo awk printf grep | then test "$@" echo x=1 2>/dev/null
+		export awk /usr/bin printf cd cd printf local /usr/bin x=1 local "$@"
+	echo "$1" done "$1" test 2>/dev/null done "$1"
+		readonly export echo 2>/dev/null then test printf echo then ${HOME}
+		grep 'quoted text' -eu 'quoted text'
+| | $(pwd) then cd cd -eu "$@" | sed then /usr/bin -eu ${HOME} x=1 "$1" x=1
+	cd --verbose grep "$1" --verbose export
+	sed /usr/bin awk | local -eu echo then printf /usr/bin /usr/bin printf echo
+		echo then 'quoted text' && cd 2>/dev/null
+	&& readonly 2>/dev/null grep export
+x=1 2>/dev/null then | done x=1 done
+		--verbose export test grep readonly done done
+&& grep /usr/bin x=1 'quoted text' printf --verbose
+sed /usr/bin x=1 x=1 local sed x=1 --verbose readonly local
+	-eu printf done grep $(pwd) 'quoted text'
+	then 'quoted text' | readonly | && readonly local sed x=1 &&
+/usr/bin then -eu local printf printf "$@"
+	awk export cd | x=1 | then local cd 2>/dev/null
+	grep test | readonly /usr/bin $(pwd) ${HOME} --verbose -eu awk done
+		done "$@" --verbose "$@" sed awk test local -eu x=1 grep
+	/usr/bin /usr/bin ${HOME} cd grep then readonly
+	cd printf "$1" echo x=1 'quoted text'
+| /usr/bin 2>/dev/null | /usr/bin local awk $(pwd) grep
+		2>/dev/null -eu printf /usr/bin
+		--verbose export readonly readonly | sed x=1 | grep "$1"
+		then --verbose done $(pwd) grep export --verbose --verbose export
+export x=1 --verbose | then 'quoted text' -eu
+	&& then ${HOME} | done $(pwd) test grep sed "$1" cd -eu sed sed
+		readonly echo 2>/dev/null done 'quoted text' -eu 'quoted text' sed ${HOME}
+		/usr/bin echo $(pwd) |
+export "$1" ${HOME} sed --verbose --verbose "$1" x=1
+		/usr/bin | ${HOME} -eu awk test 'quoted text'
+	-eu ${HOME} readonly echo x=1 cd ${HOME} --verbose --verbose "$@" -eu "$@" sed ${HOME}
+cd sed grep cd $(pwd) grep export "$1" $(pwd) then -eu /usr/bin
+x=1 $(pwd) cd readonly echo 2>/dev/null test export done x=1 then 2>/dev/null
+awk local ${HOME} cd /usr/bin readonly && $(pwd)
+'quoted text' "$1" && cd awk --verbose && ${HOME} --verbose -eu ${HOME} x=1
+		echo --verbose ${HOME} "$@" x=1 sed /usr/bin
+	/usr/bin test | 2>/dev/null
+	then 'quoted text' printf && --verbose awk done cd export "$@" test local
+${HOME} && test local "$1" 2>/dev/null "$@" ${HOME} --verbose
+grep sed --verbose test | then sed sed export 'quoted text'
+	--verbose done --verbose $(pwd) done sed done
+	"$1" awk 2>/dev/null -eu ${HOME} grep awk "$@" /usr/bin awk ${HOME}
+		sed grep ${HOME} x=1 then x=1 local awk test x=1 local |
+test awk local "$1" --verbose
+echo done cd x=1 readonly awk sed printf && ${HOME} $(pwd)
+		/usr/bin grep $(pwd) readonly
+sed | local then -eu "$1" readonly && && then
+	-eu | done cd /usr/bin --verbose -eu sed
+printf | echo && && --verbose "$@" then --verbose grep $(pwd) 'quoted text'
+	'quoted text' -eu x=1 -eu $(pwd) printf -eu then ${HOME}
+		done $(pwd) --verbose grep then x=1 $(pwd) "$@" "$@" then "$@" awk /usr/bin 'quoted text'
+		${HOME} test readonly echo "$1" readonly 2>/dev/null
+| grep x=1 printf "$@" local 'quoted text' echo $(pwd) /usr/bin then
+	--verbose --verbose && 2>/dev/null local --verbose
+"$1" awk test echo "$@" then -eu "$1" printf local
+	readonly /usr/bin x=1 export 'quoted text'
+	"$1" printf grep awk test -eu "$1" readonly echo
+	done /usr/bin x=1 export --verbose $(pwd) "$1" && grep awk --verbose
+	awk echo --verbose sed 2>/dev/null -eu readonly awk readonly cd grep &&
+		test | test "$@" done -eu echo -eu printf then "$1"
+		--verbose readonly then local ${HOME} /usr/bin 'quoted text'
+printf printf local x=1 local cd sed "$@" local printf test test
+	"$1" -eu echo sed local x=1 awk --verbose
+	printf sed cd echo then local done /usr/bin 'quoted text' grep &&
+		-eu then | && 'quoted text'
+	"$1" done 2>/dev/null ${HOME} echo && readonly readonly readonly "$@"
+--verbose /usr/bin grep x=1 && | --verbose /usr/bin grep
+		&& readonly ${HOME} echo echo ${HOME} ${HOME} 'quoted text' x=1 ${HOME}
+"$1" $(pwd) x=1 -eu ${HOME} $(pwd)
+sed local "$@" | then ${HOME} awk test awk
+		export local "$@" "$1" "$@" then cd awk sed | 2>/dev/null
+--verbose echo 2>/dev/null "$@" -eu done sed test readonly cd done then /usr/bin
+		export grep local then -eu printf test
+readonly done cd | grep $(pwd) then printf
+		test grep echo readonly then printf $(pwd) "$1"
+	cd readonly 'quoted text' 2>/dev/null x=1 "$@" grep then $(pwd) && ${HOME} then
+		/usr/bin test readonly export 2>/dev/null local echo /usr/bin
+	readonly then export "$@" printf && readonly --verbose
+		sed "$@" --verbose export 2>/dev/null --verbose cd
+	x=1 readonly done done cd "$@" /usr/bin "$1" | test
+		&& grep ${HOME} && sed "$1" export sed echo $(pwd) && then --verbose -eu
+		'quoted text' local cd /usr/bin printf
+sed sed "$1" sed /usr/bin
+		'quoted text' test $(pwd) "$1" /usr/bin cd && printf | && x=1 && echo
+	"$1" then "$1" sed readonly awk
+	--verbose "$@" printf test echo -eu 2>/dev/null -eu
+		"$1" "$@" 2>/dev/null 'quoted text' test "$1" sed "$@" $(pwd) echo 'quoted text'
+	cd cd cd && | sed && printf 'quoted text' local
+	awk export printf readonly echo "$1" printf x=1 awk "$1" readonly
+	"$1" --verbose grep done printf &&
+		2>/dev/null && x=1 sed cd sed export cd echo $(pwd)
+	2>/dev/null sed grep ${HOME}
+x=1 then then local -eu local done
+		"$@" readonly /usr/bin cd export
+		| "$@" export x=1 $(pwd)
+	then "$@" $(pwd) awk done grep "$1" "$1" --verbose sed
+		$(pwd) done awk | ${HOME} --verbose test "$@" awk "$1" ${HOME} awk printf grep
+	local --verbose 'quoted text'
+printf 2>/dev/null awk awk local grep
+		-eu /usr/bin export $(pwd) ${HOME} 'quoted text' "$1" -eu
+	2>/dev/null echo $(pwd) ${HOME} -eu
+		-eu echo -eu "$1" then $(pwd) sed /usr/bin && 2>/dev/null echo readonly local
+	local "$1" test then /usr/bin sed test | "$1" local awk grep
+	then printf then export echo awk "$1" $(pwd) readonly x=1 2>/dev/null readonly
+${HOME} readonly then -eu 2>/dev/null then test
+	$(pwd) readonly export $(pwd) test /usr/bin
+"$1" sed "$1" grep 'quoted text' done
+awk readonly cd awk echo then | local && /usr/bin sed 2>/dev/null cd "$1"
+$(pwd) local 2>/dev/null awk export "$1" ${HOME} cd && -eu echo
+		/usr/bin echo awk -eu test 'quoted text'
+grep grep | "$@" printf sed
+		-eu --verbose export | awk "$@" && echo x=1 && x=1 then && export 2>/dev/null
+		awk | done sed && printf | test --verbose readonly
+awk "$1" $(pwd) 2>/dev/null grep export /usr/bin 'quoted text' x=1 && then done
+		-eu test "$1" printf | done $(pwd) local echo printf done && 2>/dev/null done
+${HOME} "$@" grep cd test printf grep "$@" -eu ${HOME}
+		cd | | "$@" export ${HOME} ${HOME} x=1 "$@" echo 'quoted text'
+"$1" -eu $(pwd) 'quoted text' /usr/bin | -eu printf done awk
+done "$1" "$@" | printf sed $(pwd) "$@" $(pwd) export $(pwd) sed /usr/bin
+	readonly "$1" printf then 2>/dev/null done ${HOME} done echo grep cd
+'quoted text' awk printf x=1 2>/dev/null
+		"$1" then export readonly then cd $(pwd) readonly export "$1" 2>/dev/null
+x=1 && grep then | x=1 && && "$1" 'quoted text' cd "$@" ${HOME} $(pwd)
+	x=1 cd then echo ${HOME} printf "$@" -eu
+		&& 2>/dev/null cd done && readonly
+		then export $(pwd) export
+"$@" "$@" 'quoted text' export readonly grep -eu grep grep then -eu x=1 'quoted text'
+	2>/dev/null cd x=1 printf test local /usr/bin printf printf
+	'quoted text' /usr/bin | "$@" grep /usr/bin
+done then x=1 printf | -eu | ${HOME} test "$1" echo 'quoted text'
+| readonly && grep && local x=1 sed export $(pwd)
+		cd --verbose && 'quoted text'
+		sed $(pwd) echo && "$1" "$1" export local -eu "$1" export
+	local /usr/bin export readonly sed cd cd printf | grep
+| "$@" --verbose "$@"
+		2>/dev/null printf cd
+		local /usr/bin awk "$@" --verbose export | $(pwd) --verbose x=1 local
+		then $(pwd) test /usr/bin then 'quoted text' /usr/bin done "$@" done "$1"
+		done export sed ${HOME} x=1 test cd grep echo
+		${HOME} --verbose local /usr/bin | $(pwd)
+		"$@" cd local sed $(pwd) then export done /usr/bin x=1 grep
+&& --verbose -eu test readonly export "$@" sed done then "$@"
+echo awk && 'quoted text' printf
+	${HOME} $(pwd) $(pwd) then printf then
+"$1" echo printf echo awk $(pwd) grep export local echo | && 'quoted text'
+	awk && export "$1" printf done
+	| 'quoted text' --verbose --verbose printf done | 'quoted text'
+		&& sed readonly echo $(pwd) "$@" cd --verbose "$@" grep ${HOME}
+-eu -eu ${HOME} cd cd test awk -eu 2>/dev/null export echo
+	x=1 "$@" -eu done ${HOME} --verbose awk cd readonly
+done /usr/bin | /usr/bin export --verbose readonly "$1"
+x=1 && sed | cd printf && 2>/dev/null
+	echo --verbose local -eu ${HOME} x=1 'quoted text' echo readonly then --verbose
+		| "$@" test local echo done 2>/dev/null
+test sed cd then 2>/dev/null readonly
+done test grep x=1 cd awk 2>/dev/null local | echo awk x=1
+		grep cd local awk done /usr/bin x=1
+		readonly -eu awk done
+	&& then sed ${HOME} | && ${HOME} $(pwd) 2>/dev/null
+readonly x=1 'quoted text' -eu export cd echo export && readonly
+	/usr/bin done 2>/dev/null 2>/dev/null | "$@"
+	test 2>/dev/null && "$1" grep readonly sed done $(pwd)
+	| then 2>/dev/null x=1 "$@" | done sed ${HOME} "$1"
+		echo sed && grep "$@" readonly grep printf printf local ${HOME}
+	--verbose 2>/dev/null export
+"$1" echo printf cd 'quoted text' done echo x=1
+sed local | local x=1 export printf done done 2>/dev/null
+	x=1 cd cd 'quoted text' local
+echo test echo 'quoted text' "$@" sed printf "$1"
+		printf then cd done sed test ${HOME} x=1 grep cd | ${HOME} local echo
+cd readonly && printf grep x=1 2>/dev/null "$1" x=1 then 2>/dev/null
+		"$@" done x=1 echo cd cd ${HOME} | -eu done test local
+echo $(pwd) local sed /usr/bin "$@"
+		sed done 'quoted text' awk grep /usr/bin --verbose awk done
+	cd --verbose && done "$@" export | echo $(pwd) printf && ${HOME} grep && grep
+readonly /usr/bin /usr/bin --verbose
+		done cd echo readonly then awk && echo then cd && $(pwd) $(pwd) $(pwd) $(pwd)
+		--verbose 2>/dev/null sed "$1" then /usr/bin /usr/bin local awk "$@" awk
+		"$1" export --verbose | readonly && cd
+		&& "$1" printf --verbose /usr/bin "$@" local printf "$@" awk && 'quoted text'
+	then x=1 cd | -eu | awk sed sed -eu x=1 cd ${HOME}
+		"$@" 'quoted text' local awk 'quoted text' export printf cd done
+done /usr/bin --verbose ${HOME} 2>/dev/null
+readonly then "$@" "$1" test sed /usr/bin /usr/bin
+	| /usr/bin /usr/bin && $(pwd)
+	/usr/bin "$1" done x=1 x=1 grep printf "$@" $(pwd) awk readonly
+2>/dev/null /usr/bin done awk |
+		--verbose cd printf 'quoted text' then readonly cd -eu /usr/bin
+2>/dev/null export then awk $(pwd) --verbose --verbose readonly done printf
+printf test /usr/bin --verbose then 2>/dev/null -eu cd
+	"$@" --verbose && export x=1 | 'quoted text' $(pwd) $(pwd) export
+	printf | /usr/bin | grep grep | export ${HOME} "$1" ${HOME} x=1 | printf export
+test printf printf test
+	$(pwd) x=1 $(pwd) "$1"
+		-eu local awk then readonly --verbose --verbose ${HOME} done readonly "$@" "$1"
+		${HOME} && awk /usr/bin "$@" --verbose done
+		done sed && x=1 readonly /usr/bin 2>/dev/null test "$@" export
+		"$1" "$@" /usr/bin export x=1 -eu
+	| local cd /usr/bin /usr/bin grep echo --verbose
+local readonly cd "$1" cd cd test | readonly grep local sed 'quoted text' | printf
+		export export --verbose "$1" --verbose $(pwd)
+awk export /usr/bin readonly awk x=1 -eu
+${HOME} echo readonly -eu 2>/dev/null -eu | then done done 'quoted text'
+	local done && && then | readonly grep -eu 'quoted text' /usr/bin echo
+	$(pwd) readonly done $(pwd) $(pwd) export local
+echo local x=1 x=1 $(pwd) $(pwd) local local local
+		export $(pwd) | "$@" printf "$@" cd -eu /usr/bin
+	'quoted text' awk readonly | 'quoted text'
+		readonly 2>/dev/null x=1 echo && ${HOME} readonly ${HOME} "$1"
+		awk 2>/dev/null sed -eu test "$@" x=1 | sed 'quoted text' awk local -eu && done
+	'quoted text' 2>/dev/null awk sed && x=1 awk 2>/dev/null then
+		"$@" grep 'quoted text' x=1 awk grep $(pwd)
+	-eu /usr/bin awk /usr/bin sed cd printf export 2>/dev/null -eu "$1"
+	"$@" --verbose --verbose then /usr/bin --verbose local
+		test export 'quoted text' ${HOME} $(pwd) export $(pwd) printf $(pwd) export x=1
+printf "$1" cd printf -eu $(pwd) grep test
+&& grep readonly then export test local awk awk | echo test
+	2>/dev/null awk test awk $(pwd)
+		| local test 'quoted text' test awk done grep printf --verbose -eu printf
+	local cd grep --verbose 'quoted text'
+	${HOME} /usr/bin readonly && done "$1" x=1 --verbose x=1
+echo "$1" -eu printf readonly 'quoted text' printf && printf &&
+		echo /usr/bin done test /usr/bin "$@"
+printf cd -eu grep done echo
+	cd sed $(pwd) /usr/bin | 2>/dev/null
+		--verbose x=1 ${HOME} printf awk echo $(pwd)
+export grep x=1 printf x=1 grep --verbose grep 'quoted text'
+	test printf printf awk then /usr/bin && export grep local cd -eu grep
+	test cd $(pwd) 2>/dev/null cd && "$@" grep test test cd | x=1 export done "$@"
+		$(pwd) echo && grep ${HOME} 'quoted text' -eu local /usr/bin
+	test x=1 2>/dev/null "$@"
+	test | echo $(pwd) --verbose sed --verbose ${HOME}
+$(pwd) --verbose readonly /usr/bin test
+	printf printf cd 2>/dev/null
+		readonly local 2>/dev/null local $(pwd) local done cd test 'quoted text'
+"$1" ${HOME} "$1" $(pwd) test && sed printf "$@" /usr/bin printf /usr/bin
+| sed readonly readonly then | export $(pwd) test "$1" -eu local cd export 'quoted text'
+grep | export export grep | sed ${HOME} then awk export | 2>/dev/null x=1 ${HOME}
+	'quoted text' ${HOME} cd grep "$@" "$@" | /usr/bin
+	'quoted text' x=1 cd
+readonly local && then --verbose then
+"$1" cd "$1" export | --verbose /usr/bin x=1 "$1" sed printf
+$(pwd) grep /usr/bin ${HOME} /usr/bin --verbose | done
+	printf | sed "$1" $(pwd) printf done --verbose done export -eu sed sed && "$1"
+		done "$@" readonly awk
+	done ${HOME} readonly readonly "$@" local printf
+	grep x=1 grep cd test --verbose cd printf "$@" 2>/dev/null | x=1 "$@"
+	"$@" $(pwd) -eu readonly readonly 2>/dev/null $(pwd)
+cd grep then /usr/bin cd
+	printf /usr/bin local grep
+	2>/dev/null 2>/dev/null done cd x=1 $(pwd) printf grep readonly grep then /usr/bin
+	export ${HOME} --verbose then
+'quoted text' cd --verbose | $(pwd) then readonly --verbose
+awk awk /usr/bin local then -eu readonly /usr/bin
+		x=1 awk readonly cd x=1 export /usr/bin | | grep "$1" $(pwd) test grep ${HOME} 2>/dev/null
+		awk 2>/dev/null export echo local echo "$1" echo local $(pwd) 'quoted text' cd
+		x=1 "$@" local $(pwd) echo | printf
+sed done readonly then local 2>/dev/null echo local export
+		printf $(pwd) x=1 && $(pwd) $(pwd)
+	"$1" export cd awk export 'quoted text' /usr/bin awk ${HOME} done 2>/dev/null
+x=1 "$@" printf readonly awk 'quoted text'
+		"$@" sed 'quoted text' export
+then 'quoted text' $(pwd) | "$@" test x=1 x=1 readonly
+		$(pwd) -eu echo x=1 "$@" 2>/dev/null && ${HOME} readonly $(pwd) export
+-eu x=1 local then x=1 --verbose
+	--verbose done sed x=1 | "$1" 'quoted text' --verbose local test "$1" done
+		grep "$@" then printf then ${HOME} cd printf test grep export /usr/bin
+		cd /usr/bin cd printf local echo | test test --verbose grep export | "$@"
+| readonly 2>/dev/null /usr/bin && 'quoted text' cd then then then /usr/bin
+	'quoted text' x=1 x=1 | grep echo 'quoted text' 2>/dev/null
+readonly then 2>/dev/null readonly awk done export 2>/dev/null -eu cd 2>/dev/null
+	readonly /usr/bin "$1" export
+		awk cd readonly echo readonly export
+	export ${HOME} && echo $(pwd) "$1" 2>/dev/null awk done then -eu /usr/bin
+		$(pwd) -eu done --verbose done export readonly --verbose
+	'quoted text' export sed export && "$1" | -eu local 2>/dev/null readonly
+	2>/dev/null test then x=1 $(pwd) local 2>/dev/null "$@" cd 'quoted text'
+	test && ${HOME} /usr/bin /usr/bin 2>/dev/null
+		done "$@" -eu export then printf echo test /usr/bin grep printf
+		export "$@" cd ${HOME} "$@" cd export /usr/bin 2>/dev/null
+	local printf $(pwd) awk echo /usr/bin --verbose grep awk 'quoted text' "$1"
+cd $(pwd) local /usr/bin
+		'quoted text' "$1" readonly
+		| --verbose "$@" x=1 --verbose "$1" test awk awk
+cd sed x=1 $(pwd) "$@"
+		-eu | -eu 2>/dev/null
+x=1 sed test --verbose /usr/bin
+	--verbose "$1" && x=1 grep 2>/dev/null then 'quoted text' "$1" -eu cd readonly
+sed printf x=1 --verbose
+	--verbose test ${HOME} 'quoted text' "$@" "$1" done /usr/bin
+readonly then echo test then "$1" 2>/dev/null
+test done grep /usr/bin "$1" "$1" 2>/dev/null
+	sed "$@" readonly && 'quoted text' $(pwd) sed 'quoted text' test sed
+		--verbose "$1" local "$1" 2>/dev/null /usr/bin export --verbose
+awk cd then $(pwd) test --verbose local then && && awk /usr/bin -eu
+"$@" -eu test sed echo && export "$@" export cd awk awk --verbose /usr/bin "$1"
+local local --verbose 'quoted text' && echo x=1 test /usr/bin test ${HOME}
+		awk x=1 "$@" readonly cd grep sed sed "$1" done awk "$1" | done --verbose
+		/usr/bin then /usr/bin grep &&
+awk sed ${HOME} done -eu echo "$1" printf "$@" printf
+		-eu local local | grep /usr/bin test "$@" grep sed "$1"
+		&& 2>/dev/null cd | test 2>/dev/null --verbose test
+"$1" awk -eu done printf "$@" --verbose readonly $(pwd) printf grep ${HOME}
+awk "$1" && grep && /usr/bin
+echo readonly && | test "$@"
+'quoted text' printf $(pwd)
+&& --verbose 'quoted text' grep test
+${HOME} grep $(pwd) |
+"$1" "$@" local cd export sed sed && grep 'quoted text'
+done "$1" cd 2>/dev/null 'quoted text' "$1" readonly test readonly
+		"$1" grep --verbose 'quoted text' -eu && --verbose 'quoted text' 2>/dev/null awk
+$(pwd) && cd export && "$@" -eu "$1" | readonly 'quoted text'
+/usr/bin readonly test $(pwd)
+$(pwd) cd echo export local readonly cd local -eu local /usr/bin
+	${HOME} $(pwd) 'quoted text' awk -eu $(pwd) readonly export echo -eu $(pwd)
+"$@" readonly x=1 awk then done $(pwd) export "$1"
+		x=1 then grep printf /usr/bin "$1" then -eu local
+	grep 2>/dev/null done ${HOME} export | cd grep
+		'quoted text' readonly "$1" && grep && printf | --verbose -eu done
+	local then 2>/dev/null "$1" cd test ${HOME} && $(pwd) | "$@" $(pwd) 2>/dev/null
+		done | | sed 'quoted text' export
+		| local grep --verbose | printf 2>/dev/null
+		local -eu $(pwd) ${HOME} grep readonly sed "$@" printf test printf printf done $(pwd)
+		x=1 $(pwd) 'quoted text' ${HOME} "$1" cd
+		"$1" echo 'quoted text' | /usr/bin | awk | export && x=1
+echo cd --verbose | 2>/dev/null
+		done x=1 'quoted text' test /usr/bin /usr/bin awk grep then "$@" ${HOME}
+	${HOME} grep "$1" x=1 --verbose | export /usr/bin
+	--verbose done 2>/dev/null "$1" | 'quoted text'
+"$1" 'quoted text' sed export printf -eu sed "$@" x=1 "$1" -eu echo sed x=1
+-eu awk done -eu "$@" $(pwd) "$1" awk x=1 local "$1" done "$@" test && && -eu
+	readonly | echo sed /usr/bin awk local 2>/dev/null "$@" | readonly printf echo |
+	"$@" $(pwd) | --verbose printf 2>/dev/null 2>/dev/null test -eu local cd
+		export 2>/dev/null -eu --verbose ${HOME} /usr/bin x=1 local echo echo
+	sed && awk done 2>/dev/null readonly export echo awk 2>/dev/null "$1" grep /usr/bin
+	$(pwd) then 2>/dev/null readonly 2>/dev/null -eu -eu --verbose && sed "$@" printf
+awk "$1" cd $(pwd) --verbose export $(pwd) | printf local echo
+	printf && /usr/bin readonly
+		echo readonly "$@" grep grep printf && done export local export "$1"
+	"$@" /usr/bin cd "$@" -eu && echo awk grep /usr/bin
+		done printf ${HOME} $(pwd) done | x=1 /usr/bin
+		"$@" readonly grep "$1"
+	${HOME} -eu ${HOME} awk grep test awk 2>/dev/null then -eu readonly 2>/dev/null
+	'quoted text' x=1 grep test awk 'quoted text' then
+"$@" echo grep echo done local echo local grep local "$@" local
+	readonly cd | local local | | --verbose test -eu "$@" awk ${HOME} printf | local
+cd grep awk awk local "$@" --verbose &&
+grep echo grep ${HOME}
+	--verbose ${HOME} 2>/dev/null 2>/dev/null
+		/usr/bin $(pwd) test && echo --verbose sed then cd "$@" printf
+echo x=1 echo --verbose 'quoted text' readonly readonly 'quoted text'
+	-eu export | readonly -eu test && export && 2>/dev/null echo &&
+	sed echo -eu test "$1" && && x=1 readonly ${HOME} /usr/bin done "$1"
+	done -eu then && "$1" "$@" test $(pwd) 2>/dev/null && readonly
+&& export -eu printf printf $(pwd) local -eu awk echo x=1 readonly
+		"$1" grep sed $(pwd) local readonly done /usr/bin echo sed readonly done
+	echo 2>/dev/null printf cd grep
+		| echo cd -eu && awk export -eu grep echo sed awk sed "$@" "$1"
+	-eu printf sed export echo done export $(pwd) 'quoted text'
+		"$@" "$1" "$1" export 2>/dev/null
+	readonly x=1 printf sed "$@" grep echo sed printf readonly printf
+	awk done printf "$@" sed then readonly local -eu sed 2>/dev/null
+	--verbose x=1 ${HOME} awk -eu ${HOME} 'quoted text' awk ${HOME} done
+	"$@" -eu --verbose printf awk "$1" 2>/dev/null done $(pwd) printf x=1 $(pwd)
+	/usr/bin readonly grep && -eu "$@" local "$1"
+		--verbose ${HOME} 'quoted text'
+	${HOME} local "$@" "$@" "$1" test done done "$1" grep x=1
+then cd $(pwd) then grep cd local echo printf echo grep --verbose
+2>/dev/null test $(pwd) cd awk "$1" printf x=1 -eu
+	"$1" sed export grep 'quoted text' x=1 -eu grep 2>/dev/null ${HOME} $(pwd)
+		cd -eu printf sed --verbose then /usr/bin x=1 "$1" -eu
+		x=1 && readonly sed cd cd "$@" done 2>/dev/null
+	-eu readonly test 2>/dev/null && cd echo ${HOME} /usr/bin awk | sed awk /usr/bin
+readonly sed cd then | 'quoted text' /usr/bin
+export x=1 cd $(pwd) x=1 done done -eu done local 'quoted text'
+done grep cd cd awk | local awk readonly done
+		"$1" sed sed && -eu && ${HOME} -eu grep printf awk
+$(pwd) x=1 x=1 done ${HOME} --verbose && "$@" -eu
+	grep $(pwd) readonly "$1" test $(pwd)
+		local echo x=1 x=1 -eu grep sed -eu then $(pwd) readonly awk
+echo && test ${HOME} readonly done
+"$1" awk $(pwd) $(pwd)
+		$(pwd) | $(pwd) x=1 | "$1" "$@" awk --verbose cd cd export x=1 echo /usr/bin done
+		grep printf 'quoted text' sed 2>/dev/null "$@"
+export done grep cd cd /usr/bin test sed | ${HOME}
+		$(pwd) then awk --verbose cd | /usr/bin done && 'quoted text'
+grep then -eu "$1" | grep
+x=1 && /usr/bin ${HOME} printf $(pwd) test "$@"
+		sed local done 2>/dev/null local export grep grep export sed
+	test --verbose 2>/dev/null readonly sed done "$1" done | /usr/bin
+		2>/dev/null x=1 cd 'quoted text'
+	local $(pwd) export | | x=1 test then cd done export
+		echo 'quoted text' "$1" /usr/bin then ${HOME} then
+		$(pwd) "$@" printf | cd "$1" readonly 2>/dev/null --verbose -eu printf --verbose
+'quoted text' | echo cd ${HOME}
+"$1" --verbose local -eu /usr/bin test echo then x=1 grep | done sed $(pwd)
+		printf 2>/dev/null ${HOME} grep grep "$@" "$1" | ${HOME} cd export 'quoted text'
+	then cd awk ${HOME} | 'quoted text'
+	export 2>/dev/null cd readonly x=1 /usr/bin grep
+	--verbose 2>/dev/null /usr/bin /usr/bin
+	grep test echo 'quoted text' | readonly grep awk ${HOME} awk
+		"$1" grep done 'quoted text' done 2>/dev/null "$1" echo | awk
+	printf --verbose && 2>/dev/null --verbose
+"$1" x=1 | --verbose done
+	x=1 cd && test 'quoted text' test sed
+	readonly --verbose printf
+		sed "$1" sed $(pwd) cd ${HOME} $(pwd) $(pwd)
+echo echo -eu -eu && local | sed export "$@" && x=1 /usr/bin
+	grep "$1" echo test "$1" export grep 2>/dev/null
+sed -eu /usr/bin local cd sed $(pwd)
+	2>/dev/null --verbose echo then readonly
+	/usr/bin /usr/bin 2>/dev/null sed readonly | test -eu then awk "$1" x=1 && test
+	&& sed | "$@" 2>/dev/null && -eu -eu "$1" --verbose $(pwd)
+		grep x=1 | ${HOME} local cd cd awk export 2>/dev/null echo sed x=1 x=1 echo
+$(pwd) --verbose grep 'quoted text' x=1 2>/dev/null cd /usr/bin ${HOME} && $(pwd)
+${HOME} -eu local && /usr/bin
+'quoted text' local cd local
+		test "$@" echo --verbose $(pwd) 'quoted text' echo sed && /usr/bin sed
+"$@" readonly echo "$1" x=1 done | ${HOME} x=1 then
+	2>/dev/null --verbose grep 2>/dev/null local -eu grep export local -eu done $(pwd)
+		"$@" readonly export export && "$@" awk export local && export sed ${HOME}
+	"$1" --verbose ${HOME}
+		readonly awk done | 'quoted text'
+	${HOME} then printf -eu grep x=1 2>/dev/null
+local export done /usr/bin /usr/bin
+		printf local local 'quoted text'
+	${HOME} export x=1 printf local
+	"$1" --verbose then "$@" readonly then | "$1" awk ${HOME}
+x=1 -eu local done "$1" awk -eu local
+	export ${HOME} "$@" sed && sed test "$1" awk export echo readonly
+readonly then $(pwd) 'quoted text' /usr/bin cd local cd "$@" | then readonly
+		"$1" then "$@" echo then grep
+/usr/bin "$@" 'quoted text' then grep | test done local local readonly ${HOME}
+		local sed --verbose -eu
+--verbose "$@" echo "$1" grep 'quoted text' cd readonly export 2>/dev/null
+	then sed echo "$1" /usr/bin 'quoted text' grep then
+		"$@" grep awk 2>/dev/null test local awk "$1"
+		"$@" $(pwd) "$1" x=1 cd ${HOME}
+test | "$@" && ${HOME}
+export 2>/dev/null x=1 /usr/bin /usr/bin grep --verbose sed --verbose x=1 && &&
+	printf "$@" readonly | grep
+| local -eu test /usr/bin test 'quoted text'
+		--verbose ${HOME} done x=1 'quoted text' ${HOME} && local
+		sed /usr/bin cd "$@" export
+		readonly grep 'quoted text' echo $(pwd)
+	"$1" local /usr/bin /usr/bin "$@"
+		cd cd printf cd 2>/dev/null ${HOME} 'quoted text' "$@" done then
+		$(pwd) x=1 "$@" && --verbose | | | 'quoted text' --verbose done
+&& $(pwd) -eu then x=1 $(pwd) sed "$@" 2>/dev/null &&
+	-eu ${HOME} then cd "$@" sed && sed ${HOME} ${HOME} local "$1" /usr/bin
+sed printf readonly grep test 'quoted text' cd "$1" 'quoted text' cd --verbose
+		then grep readonly test
+"$1" /usr/bin && local printf 'quoted text'
+	test "$@" "$@" | export cd $(pwd) "$@" done export "$@" then
+		"$@" 'quoted text' test $(pwd)
+awk 2>/dev/null printf echo printf ${HOME} awk test awk "$@"
+		cd "$@" export "$1" $(pwd) sed readonly
+	echo printf "$1" sed ${HOME} ${HOME} && /usr/bin --verbose export echo grep
+	test --verbose -eu echo /usr/bin x=1 awk printf $(pwd) x=1 $(pwd) "$1" "$@" local
+		2>/dev/null && printf 2>/dev/null export --verbose echo --verbose /usr/bin
+		readonly test "$@" awk grep readonly
+&& awk x=1 2>/dev/null echo -eu 'quoted text' sed && export export
+"$@" printf | readonly --verbose ${HOME} --verbose done then sed grep $(pwd)
+	| x=1 2>/dev/null readonly awk ${HOME}
+export $(pwd) sed echo echo grep ${HOME} --verbose "$@" "$@"
+	${HOME} -eu $(pwd) -eu done awk
+	printf export 'quoted text' --verbose
+		cd cd readonly sed echo /usr/bin
+	readonly && $(pwd) cd awk printf test awk test test && awk
+		-eu /usr/bin -eu "$1" then ${HOME} sed ${HOME} export &&
+		'quoted text' test readonly awk done cd then echo
+grep readonly export local | awk 'quoted text' -eu 2>/dev/null printf | export
+local export && ${HOME} test then $(pwd) /usr/bin awk cd export x=1 "$1" ${HOME}
+&& ${HOME} local then $(pwd) export printf sed readonly
+	"$@" "$1" local then sed then $(pwd) | -eu x=1 -eu $(pwd) -eu sed $(pwd) $(pwd)
+local export | -eu ${HOME} /usr/bin x=1 --verbose then echo printf
+	"$1" 'quoted text' ${HOME} x=1
+		${HOME} -eu 2>/dev/null ${HOME} && then export test
+		then $(pwd) "$1" 2>/dev/null
+	2>/dev/null x=1 'quoted text'
+		| | --verbose --verbose | awk -eu test 'quoted text'
+	x=1 "$1" local sed ${HOME} done /usr/bin ${HOME} | done awk /usr/bin
+	printf --verbose echo readonly $(pwd) 2>/dev/null printf --verbose
+	cd grep --verbose cd then ${HOME} -eu 'quoted text' awk
+		&& export sed done grep done cd x=1 readonly /usr/bin
+		/usr/bin echo 'quoted text' /usr/bin | grep $(pwd)
+		local then awk ${HOME} local -eu /usr/bin
+	test printf readonly
+	"$@" $(pwd) cd "$@" test awk echo | export test x=1 ${HOME}
+"$1" echo export ${HOME}
+export grep ${HOME} export "$@" readonly | done
+	then | local -eu -eu cd local export x=1 "$@" 'quoted text'
+		${HOME} --verbose x=1 done $(pwd) export printf done awk echo $(pwd) "$1"
+-eu "$@" printf sed grep awk ${HOME} local readonly
+		-eu export echo "$1" cd local local "$1" --verbose readonly awk then $(pwd) cd
+	export local cd test grep "$1"
+		then --verbose readonly readonly /usr/bin export then -eu
+		x=1 test ${HOME} | /usr/bin "$1" --verbose
+"$@" sed 2>/dev/null then grep /usr/bin local printf done "$1" /usr/bin |
+		--verbose -eu sed local test 'quoted text' done
+		$(pwd) echo "$@" ${HOME} 2>/dev/null
+&& printf done sed ${HOME} test "$@" /usr/bin "$@" readonly
+		awk -eu x=1 -eu test -eu -eu readonly echo -eu echo
+	-eu | | then "$@" export done 'quoted text' export cd /usr/bin grep local
+$(pwd) 2>/dev/null export done ${HOME} cd readonly "$1"
+		x=1 2>/dev/null test $(pwd) "$@" "$1" cd && test done -eu grep
+&& echo $(pwd) awk printf sed /usr/bin test ${HOME} readonly awk x=1 'quoted text'
+	$(pwd) | awk 2>/dev/null -eu
+	/usr/bin "$@" test 2>/dev/null printf "$1" grep
+| then "$1" sed readonly "$@" && readonly readonly
+		grep grep x=1 && 2>/dev/null | grep readonly
+"$@" test $(pwd) "$@" && awk | local 2>/dev/null readonly done $(pwd)
+export done done "$1" /usr/bin
+	grep $(pwd) | /usr/bin echo sed -eu awk test 2>/dev/null local 'quoted text'
+&& 2>/dev/null /usr/bin "$1" then local
+	cd x=1 --verbose sed sed awk 'quoted text' ${HOME} && grep /usr/bin
+	grep x=1 export "$@" local --verbose /usr/bin done 'quoted text' local /usr/bin
+		cd local printf ${HOME}
+sed /usr/bin 2>/dev/null $(pwd) test "$1" local done -eu done done 2>/dev/null ${HOME}
+		"$1" | awk printf 2>/dev/null | --verbose 'quoted text' ${HOME} && ${HOME}
+		2>/dev/null printf awk "$@" $(pwd) 'quoted text' -eu local -eu printf
+grep "$1" --verbose then readonly local local echo
+		readonly 2>/dev/null cd grep test cd sed grep --verbose
+&& export sed /usr/bin cd "$@" export ${HOME} "$@" export --verbose
+	test readonly && awk $(pwd) 'quoted text' --verbose
+printf "$@" "$1" export 'quoted text' /usr/bin then x=1 "$1" "$@"
+then --verbose ${HOME} | sed "$1" test sed --verbose
+		-eu test ${HOME} 'quoted text' local x=1 local "$@" sed echo --verbose
+	echo "$@" x=1 'quoted text' done "$1" ${HOME} then --verbose
+-eu /usr/bin ${HOME} "$@" 'quoted text'
+		export then "$1" --verbose "$1" /usr/bin local
+"$1" cd ${HOME} awk "$@"
+		"$1" | echo 2>/dev/null done -eu test ${HOME} done
+-eu awk "$1" awk awk then | ${HOME} -eu $(pwd)
+		grep && echo then test -eu | echo sed "$@" echo $(pwd)
+	echo cd "$1" echo $(pwd) sed && "$@" /usr/bin
+	&& "$1" then | -eu grep readonly && /usr/bin
+export sed done test test && -eu 'quoted text' printf
+export awk grep local && && cd x=1 x=1 --verbose done export local
+printf && --verbose | then done "$@" grep printf 2>/dev/null
+		"$1" "$@" grep awk grep "$1" 2>/dev/null ${HOME}
+--verbose local 'quoted text' -eu | then readonly cd --verbose sed then
+done echo 2>/dev/null && echo 'quoted text' -eu x=1 echo
+	test awk sed "$1" awk test done | printf echo ${HOME} export 2>/dev/null
+local awk sed "$1" $(pwd) --verbose
+/usr/bin $(pwd) && | x=1 /usr/bin cd "$1" export
+	--verbose awk cd "$@" $(pwd) | printf 'quoted text' && 2>/dev/null done printf
+		readonly readonly 2>/dev/null $(pwd) then
+		test $(pwd) "$@" ${HOME} && done 'quoted text' /usr/bin && readonly done 'quoted text'
+	&& local readonly "$1" /usr/bin echo echo x=1 readonly
+	cd awk x=1 /usr/bin export readonly && -eu ${HOME} sed grep readonly |
+local done "$1" "$1" export test x=1 then $(pwd)
+		&& 2>/dev/null cd /usr/bin -eu sed $(pwd) done test
+		'quoted text' done && /usr/bin
+	"$@" awk echo -eu ${HOME} x=1 test /usr/bin then export 'quoted text'
+		&& 2>/dev/null x=1 -eu cd cd done then "$1" export echo && local
+	then --verbose readonly awk $(pwd) awk cd 'quoted text'
+export | && grep then $(pwd) readonly cd export ${HOME} --verbose test "$@"
+		local printf sed echo printf local sed x=1 export awk 'quoted text'
+	local printf && | printf
+	-eu awk grep export local test awk grep "$1" then -eu
+		"$@" local --verbose ${HOME} grep ${HOME}
+	awk /usr/bin 'quoted text' | && "$1" --verbose --verbose ${HOME} 2>/dev/null
+-eu cd 'quoted text' "$1" done
+	then sed printf export local ${HOME} then ${HOME}
+x=1 export 'quoted text' 'quoted text' 2>/dev/null sed then test printf ${HOME}
+	awk readonly awk ${HOME} x=1 printf $(pwd) "$@" /usr/bin readonly 2>/dev/null
+	readonly && 2>/dev/null grep grep x=1 done grep | x=1
+then && | test 'quoted text' $(pwd) then "$1"
+		&& sed cd && then | 2>/dev/null then done
+		awk then cd test awk grep ${HOME} --verbose /usr/bin test
+2>/dev/null ${HOME} test local "$@" -eu "$1" "$@" sed
+cd echo echo then /usr/bin local -eu -eu x=1 $(pwd) "$1" /usr/bin | then sed
+		"$1" local && 'quoted text' awk 2>/dev/null "$1" done then
+	readonly && 'quoted text'
+grep /usr/bin "$1" "$@" grep cd sed readonly
+echo --verbose 'quoted text' then /usr/bin printf then then cd $(pwd)
+		awk local sed | done -eu "$@" printf local test "$@" cd "$@" --verbose local
+	sed | $(pwd) local cd then
+		-eu local cd readonly cd 2>/dev/null cd printf "$@" -eu echo 2>/dev/null
+test export echo x=1 "$@" x=1 readonly
+	"$@" "$1" echo awk "$1" "$1" "$@" local export printf
+${HOME} sed cd printf echo x=1 cd printf "$@" then printf ${HOME} printf printf
+		done -eu "$1" local 'quoted text' awk echo --verbose awk --verbose | &&
+	/usr/bin --verbose && ${HOME}
+	export | printf /usr/bin "$@" test
+&& 2>/dev/null echo echo /usr/bin "$1" /usr/bin --verbose
+--verbose readonly export "$@"
+		| 2>/dev/null awk ${HOME} test local cd "$1" "$@" -eu
+$(pwd) | 2>/dev/null grep test $(pwd) local readonly
+	sed grep | | 'quoted text' sed --verbose ${HOME}
+		test cd test "$@" x=1 grep sed -eu x=1 /usr/bin /usr/bin /usr/bin
+--verbose 'quoted text' | && cd echo 2>/dev/null /usr/bin
+	export $(pwd) echo --verbose x=1 awk cd && x=1 2>/dev/null
+grep awk awk cd ${HOME}
+x=1 "$1" printf ${HOME} sed done test | sed
+		--verbose | grep export then then
+done x=1 done && grep export $(pwd) local -eu local
+grep printf x=1 sed "$@" "$1" awk awk && /usr/bin
+	"$1" -eu grep then awk grep && /usr/bin | $(pwd) &&
+	"$@" $(pwd) $(pwd) awk $(pwd) cd readonly | export 2>/dev/null "$1" --verbose
+		| awk awk --verbose x=1
+	$(pwd) sed done "$1" printf cd && export grep ${HOME} printf
+		awk then awk cd local awk sed then --verbose cd 'quoted text'
+		&& x=1 cd 'quoted text' then
+		'quoted text' "$1" ${HOME} grep awk export /usr/bin export | export --verbose 'quoted text'
+awk 2>/dev/null --verbose test export | --verbose -eu grep
+	export 'quoted text' 2>/dev/null cd --verbose awk readonly && awk && -eu x=1 "$@"
+local "$@" $(pwd) ${HOME} grep 2>/dev/null
+	export "$@" cd cd done --verbose sed x=1 printf
+	${HOME} echo /usr/bin $(pwd) test | $(pwd) "$1"
+		echo "$1" x=1 cd && then x=1
+-eu x=1 $(pwd) x=1 -eu /usr/bin readonly | --verbose ${HOME} $(pwd)
+		test -eu local --verbose | "$@" readonly
+	test test done sed | && | /usr/bin echo 'quoted text' printf "$@" | --verbose
+	--verbose then then /usr/bin then x=1 "$1" --verbose grep 2>/dev/null
+	$(pwd) $(pwd) then "$@" "$1" readonly awk "$1" grep 2>/dev/null export 'quoted text'
+'quoted text' "$@" 'quoted text' x=1 $(pwd) 'quoted text' -eu printf
+		${HOME} readonly sed readonly then x=1 printf --verbose readonly
+		'quoted text' cd export 2>/dev/null x=1 readonly x=1 done ${HOME}
+| local --verbose 2>/dev/null grep echo 2>/dev/null printf test
+'quoted text' then && then ${HOME} /usr/bin 2>/dev/null done cd
+	2>/dev/null && echo cd
+	grep sed printf readonly grep "$1" $(pwd) local echo
+x=1 done "$1" cd printf 2>/dev/null /usr/bin x=1 cd test | --verbose
+sed /usr/bin --verbose test echo --verbose ${HOME} "$@" printf
+		done ${HOME} cd --verbose local grep x=1 "$1"
+	printf grep /usr/bin grep done -eu ${HOME} then x=1 sed
+		sed "$1" -eu done -eu done $(pwd) x=1 $(pwd) export
+		x=1 /usr/bin -eu /usr/bin grep && readonly
+	${HOME} grep awk --verbose test awk readonly echo && sed $(pwd) local done
+	/usr/bin | ${HOME} $(pwd) export /usr/bin test
+		echo x=1 && ${HOME} test export export sed done local local echo 'quoted text' ${HOME}
+/usr/bin ${HOME} then printf | 'quoted text'
+'quoted text' "$1" x=1 test x=1 /usr/bin grep cd $(pwd) sed readonly
+grep "$@" done "$@" /usr/bin
+cd | local "$@" && local ${HOME} "$1"
+	'quoted text' $(pwd) export && test test echo -eu then ${HOME}
+export -eu -eu "$1" && then | -eu printf ${HOME}
+		test 'quoted text' printf "$1" ${HOME}
+		local printf export sed test
+	2>/dev/null 'quoted text' cd -eu test 2>/dev/null printf x=1 $(pwd)
+	x=1 export printf "$1" "$@" echo done
+	&& readonly ${HOME} 2>/dev/null sed
+$(pwd) echo "$1" -eu echo x=1 printf
+	done sed cd && x=1 sed "$@" | sed /usr/bin
+	| local echo && grep done test "$@" 2>/dev/null -eu then $(pwd) export "$@" /usr/bin
+	export x=1 "$@" /usr/bin /usr/bin "$@" readonly
+		sed x=1 $(pwd) -eu cd awk sed -eu && && | local | export
+		awk "$1" -eu sed awk printf sed echo sed
+	readonly -eu /usr/bin "$1" "$@" -eu | awk grep readonly
+		grep $(pwd) | sed | echo readonly 'quoted text' awk 2>/dev/null 2>/dev/null
+	awk | echo printf test awk grep export awk cd grep 'quoted text' sed 2>/dev/null
+		local sed export 'quoted text'
+	'quoted text' "$1" $(pwd) sed echo done /usr/bin
+		/usr/bin ${HOME} --verbose 'quoted text'
+		"$1" then local readonly export grep | local sed then 2>/dev/null local -eu awk
+		grep ${HOME} sed readonly echo -eu "$1" done cd test 2>/dev/null awk readonly
+	"$1" -eu printf sed echo x=1 then export ${HOME} done /usr/bin /usr/bin then
+	-eu grep readonly local "$1" "$1" "$@" --verbose $(pwd) export awk
+	&& && --verbose done 'quoted text' printf ${HOME} ${HOME} echo --verbose grep
+cd grep local echo ${HOME} local ${HOME} printf export echo awk |
+		'quoted text' sed local 2>/dev/null export $(pwd)
+		printf printf then readonly
+	awk awk readonly -eu export 'quoted text'
+	cd test --verbose "$1" x=1 --verbose $(pwd)
+	printf export sed "$1" export export "$@" -eu readonly
+		test 2>/dev/null "$1" readonly && && then /usr/bin && awk printf awk
+| 2>/dev/null 'quoted text' awk "$1"
+		--verbose cd | "$@" 2>/dev/null &&
+		export printf done test readonly | grep local then then /usr/bin $(pwd) x=1 printf
+	/usr/bin && 2>/dev/null --verbose grep $(pwd) sed export
+		export "$@" test done test export
+	readonly | /usr/bin awk 'quoted text' done cd ${HOME} $(pwd) sed
+		x=1 echo cd local 'quoted text' /usr/bin 2>/dev/null
+	cd 2>/dev/null cd x=1 x=1 export -eu test ${HOME} /usr/bin 2>/dev/null local
+		'quoted text' -eu | echo
+test export grep 'quoted text' x=1 sed | awk -eu printf awk | --verbose
+	${HOME} && "$1" 2>/dev/null
+	&& cd ${HOME} awk "$1" grep sed "$1" printf done done ${HOME} /usr/bin printf
+	| ${HOME} export 2>/dev/null grep local cd --verbose "$@" export export
+	awk && ${HOME} x=1 ${HOME}
+grep -eu && cd echo | |
+		done && sed readonly grep awk echo
+	awk x=1 awk local 'quoted text'
+then | echo 2>/dev/null --verbose 2>/dev/null "$1"
+		then awk $(pwd) printf export local "$1"
+	"$1" local 'quoted text' 2>/dev/null readonly && x=1 "$1" && "$@" -eu
+	sed 'quoted text' readonly awk local cd export && sed "$@" -eu --verbose
@@ -0,0 +1,2001 @@
+	$(pwd) readonly export done grep
+	'quoted text' 'quoted text' cd readonly sed --verbose 'quoted text' sed /usr/bin
+		cd test printf cd echo done awk && printf
+		--verbose -eu test $(pwd) 2>/dev/null then sed
+		sed && done "$@" export /usr/bin readonly /usr/bin -eu
+echo "$@" done awk then
+	/usr/bin local x=1 ${HOME} then cd --verbose sed /usr/bin readonly
+		awk printf ${HOME} && ${HOME} printf "$@" && local done grep "$1" $(pwd)
+grep grep export "$1" local ${HOME} 2>/dev/null
+		then test test printf export cd 2>/dev/null
+		done test $(pwd) ${HOME} | && x=1 grep 2>/dev/null "$@" echo printf done
+echo grep awk cd "$1" /usr/bin
+| "$1" "$@" --verbose --verbose
+		test "$@" 2>/dev/null "$@" sed
+"$1" done 2>/dev/null readonly
+	sed done $(pwd) grep sed grep echo "$1" local cd cd
+	sed test sed readonly -eu $(pwd) readonly 2>/dev/null -eu
+test -eu grep done 2>/dev/null /usr/bin
+done grep awk 2>/dev/null -eu x=1 awk -eu echo grep then
+| ${HOME} -eu 'quoted text' ${HOME} -eu cd 'quoted text' --verbose
+${HOME} /usr/bin --verbose
+	-eu export "$1" ${HOME} export sed
+export 'quoted text' && grep 'quoted text' then
+2>/dev/null | ${HOME} cd echo awk ${HOME} -eu
+	"$1" done "$@" test 2>/dev/null awk local test local x=1 "$1" x=1 awk
+	-eu export 2>/dev/null -eu cd readonly awk | echo
+		export printf export done done -eu --verbose grep "$1"
+&& | ${HOME} done echo "$@" x=1 2>/dev/null sed /usr/bin test readonly
+cd cd readonly /usr/bin | "$@" export
+--verbose x=1 cd /usr/bin export /usr/bin export awk
+	local then | done x=1 "$@" "$1" awk sed "$@"
+--verbose awk "$@" -eu grep
+	cd printf && /usr/bin && export readonly sed | --verbose
+		sed sed /usr/bin printf --verbose "$1" test | 2>/dev/null sed export --verbose
+grep ${HOME} readonly && grep readonly "$1" readonly
+	x=1 2>/dev/null readonly done grep done
+	/usr/bin export x=1 done && 2>/dev/null done
+	export "$@" sed printf
+&& printf 2>/dev/null 2>/dev/null
+'quoted text' readonly 'quoted text'
+		cd "$@" local export cd | "$@" /usr/bin 'quoted text' printf
+awk --verbose /usr/bin ${HOME} | 'quoted text' export
+		&& then -eu && awk cd awk grep --verbose
+test 'quoted text' local export echo grep ${HOME} 'quoted text' --verbose
+	printf then "$1" x=1 /usr/bin
+x=1 -eu && /usr/bin "$@" 2>/dev/null $(pwd)
+| x=1 && readonly && awk printf printf
+2>/dev/null x=1 2>/dev/null /usr/bin "$1" /usr/bin 'quoted text'
+		local cd /usr/bin sed printf test sed x=1 'quoted text'
+done x=1 $(pwd) echo 2>/dev/null grep "$1" readonly "$@" grep export grep local
+local local readonly $(pwd) done $(pwd) cd readonly local printf then /usr/bin
+&& grep done then -eu grep cd done then x=1
+	printf | ${HOME} sed --verbose sed test /usr/bin
+		local echo "$1" 'quoted text' |
+local 'quoted text' local grep then
+x=1 readonly ${HOME} | printf echo local 'quoted text' local | awk | test then
+	test export awk --verbose -eu cd --verbose 2>/dev/null grep sed done $(pwd)
+	&& export awk -eu | sed export | "$@" -eu cd ${HOME} -eu $(pwd)
+then /usr/bin grep cd echo /usr/bin done 'quoted text' 2>/dev/null done
+	sed done -eu --verbose local export "$@" export
+	"$1" local then grep && printf echo grep --verbose
+	--verbose then "$1" | ${HOME} x=1 "$@" "$1" x=1 x=1 readonly | $(pwd) x=1 grep
+"$1" export $(pwd) test -eu x=1
+2>/dev/null $(pwd) test && | "$@" 'quoted text' && $(pwd) --verbose
+cd then done done export | sed
+	grep 'quoted text' cd test
+${HOME} done local printf ${HOME} "$@"
+cd local ${HOME} local 'quoted text' 'quoted text' ${HOME} readonly &&
+	"$@" readonly ${HOME} --verbose
+		| awk printf sed "$@" "$@" --verbose 2>/dev/null -eu awk echo
+| printf x=1 grep && 'quoted text' -eu test
+export ${HOME} x=1 $(pwd) x=1 grep echo printf x=1 grep local ${HOME}
+	done $(pwd) echo "$@" sed 2>/dev/null
+	${HOME} local ${HOME} ${HOME} --verbose x=1 grep readonly local --verbose
+"$@" readonly cd test -eu /usr/bin readonly && then then
+		cd cd 2>/dev/null --verbose
+		export readonly export /usr/bin then
+		--verbose /usr/bin grep cd --verbose
+	$(pwd) && grep cd readonly 2>/dev/null
+	grep readonly cd 2>/dev/null sed grep echo echo then "$1"
+		$(pwd) /usr/bin test printf --verbose $(pwd) /usr/bin 2>/dev/null sed done
+		export --verbose printf printf /usr/bin done test
+	test cd readonly sed awk sed 2>/dev/null ${HOME}
+	cd local "$@" local 'quoted text' &&
+	&& x=1 /usr/bin sed && cd local "$1" /usr/bin /usr/bin "$@" "$@" grep
+	${HOME} "$1" $(pwd) "$1" && awk printf
+	'quoted text' -eu 'quoted text' local local readonly then cd readonly test
+	then printf printf 'quoted text' then test "$1" awk ${HOME} grep grep
+--verbose echo cd /usr/bin
+cd echo x=1 "$1" test local x=1 && && printf 2>/dev/null
+$(pwd) /usr/bin awk /usr/bin sed grep 2>/dev/null awk test cd sed
+	| readonly grep cd local awk | awk
+echo x=1 cd done ${HOME} "$@" $(pwd) printf
+		$(pwd) awk 2>/dev/null test awk export done echo done
+	sed --verbose printf grep x=1 local test x=1 /usr/bin 2>/dev/null readonly
+--verbose printf echo awk 2>/dev/null /usr/bin "$1" grep sed cd sed "$1"
+		${HOME} 'quoted text' 'quoted text' local && test 'quoted text'
+/usr/bin sed && sed "$1"
+	awk 'quoted text' "$@" readonly echo test then 'quoted text'
+		printf -eu then then && $(pwd) ${HOME} grep awk 2>/dev/null local export /usr/bin
+	export ${HOME} | && export "$@" done 'quoted text' test test echo readonly | grep
+		printf /usr/bin --verbose 'quoted text' $(pwd) export -eu x=1 -eu done $(pwd)
+	x=1 /usr/bin $(pwd) echo then grep sed && done sed local --verbose export printf
+		local done && x=1 --verbose done local | "$1" echo
+		awk echo readonly sed awk export sed awk echo
+	&& $(pwd) echo cd --verbose && done -eu sed x=1
+--verbose awk awk test echo echo -eu sed grep local test x=1 done
+		done "$1" readonly test readonly
+	"$1" "$@" local grep /usr/bin cd done sed echo "$@" /usr/bin grep | readonly
+	grep && then "$1" printf cd readonly
+		/usr/bin --verbose 2>/dev/null export "$@" /usr/bin | awk /usr/bin awk | done
+'quoted text' export grep grep grep awk -eu /usr/bin grep echo local
+	'quoted text' done echo cd
+	--verbose awk ${HOME} grep printf && /usr/bin then 'quoted text'
+		grep && 2>/dev/null test grep ${HOME} then cd 'quoted text' grep
+		$(pwd) test grep echo cd -eu cd "$@" sed printf awk awk --verbose $(pwd)
+	export | echo test done sed --verbose $(pwd) sed && then && echo readonly
+		awk -eu /usr/bin grep sed grep /usr/bin
+export awk test 2>/dev/null --verbose printf echo sed then 2>/dev/null x=1 export
+	--verbose ${HOME} | test local awk done test awk printf
+	grep && 'quoted text' -eu awk cd 'quoted text'
+		2>/dev/null done printf ${HOME} /usr/bin ${HOME} readonly test cd echo
+	then echo readonly $(pwd) then /usr/bin -eu local readonly ${HOME} -eu
+	then done printf test printf done $(pwd) && $(pwd) 'quoted text' export
+	${HOME} readonly $(pwd) printf sed test done --verbose
+grep x=1 local test cd ${HOME} $(pwd) export printf "$@" test printf 2>/dev/null
+/usr/bin $(pwd) $(pwd) sed local /usr/bin | -eu local grep -eu -eu "$@"
+		readonly then 2>/dev/null echo awk "$@" "$@" && -eu ${HOME} test $(pwd) sed test
+	-eu --verbose ${HOME} grep /usr/bin export test $(pwd) printf
+awk then test local --verbose 'quoted text' 'quoted text' test done
+	then -eu /usr/bin "$1" awk readonly 'quoted text'
+test "$1" grep "$@" test echo printf sed "$@" --verbose 2>/dev/null ${HOME}
+		/usr/bin export done -eu x=1 echo
+		"$1" | --verbose local 2>/dev/null 'quoted text' echo printf readonly echo grep
+		'quoted text' "$@" "$@" export && export x=1
+	/usr/bin export -eu /usr/bin awk
+	echo "$@" sed readonly "$1" export then "$@"
+	then 'quoted text' then 'quoted text'
+export local -eu 'quoted text' echo done done |
+	local 'quoted text' then "$@" readonly
+awk test | test printf "$1" ${HOME} then 2>/dev/null x=1
+$(pwd) then 'quoted text' test awk -eu && cd 'quoted text'
+		printf /usr/bin then 2>/dev/null "$@" done x=1 $(pwd) printf local
+	/usr/bin cd grep --verbose /usr/bin
+	--verbose "$@" $(pwd) x=1 done ${HOME}
+${HOME} sed ${HOME} export --verbose
+x=1 'quoted text' | export grep echo awk
+readonly "$1" export local then "$1" local 2>/dev/null ${HOME} export
+	then -eu awk readonly $(pwd) -eu sed awk /usr/bin awk -eu printf -eu "$1"
+		-eu && "$1" readonly echo then cd test
+	"$@" awk local && test
+$(pwd) 2>/dev/null grep local ${HOME} 2>/dev/null local grep readonly test
+		done grep 2>/dev/null 2>/dev/null then && /usr/bin "$1" echo "$@" ${HOME}
+		printf awk readonly /usr/bin sed grep && "$1" done $(pwd)
+${HOME} "$@" readonly --verbose ${HOME} printf &&
+'quoted text' /usr/bin ${HOME} test done |
+	readonly "$1" "$1" 'quoted text' local 2>/dev/null printf $(pwd) "$@" "$@" ${HOME}
+		then export readonly done local
+	test then export awk "$1" $(pwd) "$@" echo done ${HOME} echo
+		printf /usr/bin export | readonly 2>/dev/null 2>/dev/null --verbose 2>/dev/null
+export /usr/bin ${HOME}
+		then export | -eu awk echo cd cd local export && /usr/bin test $(pwd) ${HOME}
+		cd && awk export cd ${HOME} echo sed
+		/usr/bin && echo "$1" x=1 ${HOME} test $(pwd) ${HOME} echo && export cd local
+	"$1" awk local cd && readonly done 'quoted text' ${HOME} "$@" $(pwd) local
+	$(pwd) local /usr/bin cd local grep && && | sed cd /usr/bin
+	'quoted text' 2>/dev/null
+x=1 /usr/bin echo "$1" --verbose done 2>/dev/null -eu
+printf grep -eu done | | done $(pwd) ${HOME} awk grep readonly sed local 'quoted text'
+		--verbose printf -eu awk --verbose
+	${HOME} && ${HOME} | cd && "$@" printf x=1
+		"$1" -eu readonly /usr/bin /usr/bin readonly export |
+		${HOME} printf --verbose test local 'quoted text' "$@" export | && /usr/bin test
+	"$@" test readonly test "$1" export awk then awk "$@" test 'quoted text'
+		export "$1" sed done export awk then printf /usr/bin readonly |
+		printf | local "$@" cd && && "$@" then /usr/bin
+then export cd "$1" echo echo cd readonly cd local printf done "$1" x=1
+/usr/bin "$1" ${HOME} --verbose echo /usr/bin cd x=1 "$@" then "$@"
+	"$1" then /usr/bin && printf && printf "$1" echo --verbose
+local done -eu grep test "$@" "$@" /usr/bin readonly x=1 awk $(pwd)
+		"$@" 2>/dev/null -eu && | | readonly 'quoted text' cd 2>/dev/null
+&& awk && "$@" ${HOME} ${HOME} &&
+	2>/dev/null test ${HOME} printf
+	awk 'quoted text' local
+awk && echo test x=1 readonly then sed --verbose
+		local cd "$1" echo awk test
+	readonly /usr/bin "$1" /usr/bin readonly "$@" export
+	echo test $(pwd) /usr/bin 'quoted text' readonly printf && /usr/bin ${HOME}
+		echo "$@" printf /usr/bin $(pwd) ${HOME} "$@" then done /usr/bin ${HOME}
+		then local 2>/dev/null local 'quoted text' "$1" awk 'quoted text'
+2>/dev/null local local echo cd local $(pwd)
+cd cd -eu && then "$@" export
+--verbose done | "$1" 2>/dev/null "$1" printf sed cd sed /usr/bin
+-eu grep grep printf | done
+		"$1" "$1" done x=1 cd then then awk grep
+	2>/dev/null /usr/bin ${HOME} local "$@" 2>/dev/null
+	--verbose test readonly readonly
+awk | cd ${HOME} awk | $(pwd) /usr/bin 'quoted text' then local 2>/dev/null
+echo readonly $(pwd) "$1" --verbose
+		local local then sed --verbose test export
+		awk export ${HOME} readonly done
+awk done && 'quoted text' ${HOME}
+x=1 echo readonly printf 'quoted text' 2>/dev/null test echo $(pwd) done
+	awk -eu --verbose -eu sed x=1 $(pwd) && export
+		readonly cd test "$1" done awk | && x=1 /usr/bin done grep test "$@"
+	$(pwd) -eu then test x=1 export printf
+		--verbose "$1" awk --verbose grep awk cd sed
+	'quoted text' | then 2>/dev/null | done "$1" /usr/bin then printf then
+		export cd sed && done x=1 test done | done "$1" sed grep grep
+	$(pwd) /usr/bin | 'quoted text' "$@" && export sed $(pwd) | awk readonly
+	'quoted text' local export
+done awk 2>/dev/null 'quoted text' && -eu | awk $(pwd) export awk test 2>/dev/null
+		grep ${HOME} awk test "$@" --verbose 2>/dev/null
+awk 'quoted text' "$1" echo export cd awk then done /usr/bin
+	${HOME} readonly 'quoted text' cd grep ${HOME}
+sed test 'quoted text' --verbose && export awk | readonly export printf
+	2>/dev/null /usr/bin export
+'quoted text' 'quoted text' --verbose
+grep "$@" readonly 2>/dev/null "$1" export ${HOME}
+		/usr/bin awk 2>/dev/null
+	-eu x=1 x=1 done | awk --verbose
+$(pwd) "$1" 'quoted text' ${HOME} $(pwd) printf "$@" -eu 'quoted text' --verbose
+	awk echo done 'quoted text'
+	| echo && | test echo local
+		'quoted text' x=1 'quoted text' printf -eu $(pwd) echo then /usr/bin 2>/dev/null
+-eu cd cd 'quoted text' awk sed cd 'quoted text' local
+		| cd test export "$1" grep
+"$@" readonly /usr/bin printf ${HOME} "$@"
+	echo | grep awk | --verbose
+grep grep --verbose grep done -eu local printf |
+		local 'quoted text' echo printf cd printf then
+| 2>/dev/null /usr/bin --verbose | x=1
+		&& cd --verbose cd cd export
+-eu 'quoted text' 'quoted text'
+	printf 'quoted text' done 'quoted text' then local
+then /usr/bin 'quoted text' | ${HOME} readonly
+&& export && -eu $(pwd)
+		done local done --verbose local -eu $(pwd) "$1" test -eu local /usr/bin
+	printf --verbose echo ${HOME}
+		"$1" && export "$@" printf "$1" then
+2>/dev/null "$@" 2>/dev/null /usr/bin
+	awk -eu | then $(pwd)
+| then export grep local readonly grep readonly grep readonly done test 'quoted text'
+x=1 echo /usr/bin sed ${HOME} readonly
+	grep x=1 test sed printf $(pwd) printf echo 'quoted text'
+		x=1 --verbose && readonly ${HOME}
+		local ${HOME} done sed && | then local test readonly printf export cd && 'quoted text'
+	then grep export echo -eu done then cd printf
+test | --verbose sed test cd then done 'quoted text' x=1 2>/dev/null
+	export ${HOME} /usr/bin "$1" export local x=1 grep
+then --verbose awk then x=1 && cd done cd x=1 && -eu grep -eu export
+"$1" "$@" && -eu export ${HOME} -eu x=1 done test 2>/dev/null
+		then awk /usr/bin "$1" printf
+	export | grep test printf $(pwd) "$@" sed x=1 echo /usr/bin
+		awk cd "$1" test 2>/dev/null
+		awk export 2>/dev/null 2>/dev/null
+&& /usr/bin export | --verbose && x=1 /usr/bin --verbose 'quoted text' done &&
+then readonly awk "$1" $(pwd) export printf
+echo /usr/bin --verbose echo 2>/dev/null $(pwd) | | then
+		2>/dev/null /usr/bin /usr/bin x=1
+2>/dev/null local done then | test
+2>/dev/null "$@" 2>/dev/null grep x=1 "$1" --verbose
+		-eu awk "$@" cd then ${HOME}
+		'quoted text' -eu 2>/dev/null awk sed $(pwd) readonly
+		2>/dev/null printf echo echo
+	| printf 'quoted text' cd /usr/bin
+	'quoted text' grep "$1" | local && cd local
+		${HOME} ${HOME} echo readonly
+	$(pwd) x=1 2>/dev/null 2>/dev/null test cd echo ${HOME} "$@"
+		then ${HOME} cd "$1" | $(pwd) sed readonly readonly done
+x=1 "$@" sed grep --verbose
+"$@" $(pwd) echo | && local export local
+	done echo && done awk then
+		then echo done x=1 && then "$@" ${HOME} then 'quoted text' -eu x=1 readonly
+		local --verbose && grep /usr/bin
+cd | $(pwd) printf --verbose printf
+		export awk done ${HOME} then
+		/usr/bin -eu "$@" "$1" 'quoted text' "$@" awk "$1" "$1" export then /usr/bin
+cd ${HOME} x=1 | then done echo
+	-eu /usr/bin sed -eu export done awk x=1 $(pwd) export /usr/bin
+	then test printf sed awk x=1 awk
+		-eu --verbose readonly | printf
+		--verbose x=1 2>/dev/null sed cd "$1"
+	$(pwd) printf -eu ${HOME} 2>/dev/null
+	echo "$@" && 2>/dev/null
+x=1 grep echo ${HOME} x=1 export printf | echo readonly
+	readonly "$@" readonly echo 2>/dev/null $(pwd) && "$@"
+	export ${HOME} && "$@" printf -eu export $(pwd) done x=1
+--verbose -eu cd readonly x=1 -eu "$@" "$1" && test ${HOME} | $(pwd) readonly
+"$@" readonly cd | x=1 sed then /usr/bin x=1 ${HOME} echo
+	readonly sed x=1 then "$@" grep
+cd test export readonly echo
+	--verbose "$1" x=1 grep -eu readonly then
+sed then && echo echo awk 'quoted text'
+		$(pwd) $(pwd) local test done | export --verbose -eu local readonly then
+		'quoted text' done cd
+		"$1" ${HOME} awk readonly cd 'quoted text' 'quoted text'
+	awk 2>/dev/null $(pwd)
+awk --verbose 'quoted text' cd
+grep test "$@" "$1" -eu x=1 sed && awk | 'quoted text' local export
+sed --verbose export --verbose
+		'quoted text' /usr/bin ${HOME} then "$1" readonly
+		&& -eu then $(pwd) test
+local -eu readonly "$1" then echo 'quoted text' --verbose
+		sed printf grep ${HOME} x=1 | awk 2>/dev/null /usr/bin -eu
+2>/dev/null -eu cd sed 2>/dev/null "$1" && local awk &&
+	grep && && 'quoted text' $(pwd)
+${HOME} "$@" /usr/bin 2>/dev/null then test local "$@" 'quoted text' -eu
+		'quoted text' export $(pwd) $(pwd) export && local 'quoted text'
+	2>/dev/null local --verbose 2>/dev/null
+local --verbose printf local 'quoted text' $(pwd) test /usr/bin done
+	echo "$@" grep test echo sed readonly
+awk "$@" "$1" awk && x=1 ${HOME} $(pwd) then "$1" -eu && 2>/dev/null x=1
+		-eu awk awk $(pwd) "$@" | test cd export cd cd 2>/dev/null "$@" | && local
+	&& printf printf export grep
+		then -eu printf awk x=1 /usr/bin -eu && awk then /usr/bin then
+grep /usr/bin x=1 $(pwd) echo readonly && | awk 2>/dev/null
+cd 'quoted text' ${HOME}
+2>/dev/null sed export local export grep "$1" test /usr/bin x=1 local
+echo echo grep && readonly "$@" | /usr/bin x=1 awk awk
+		cd sed "$@" $(pwd) "$1" sed export 2>/dev/null "$1" --verbose
+		--verbose x=1 done readonly --verbose
+$(pwd) -eu -eu ${HOME} ${HOME} echo && "$@" 'quoted text' grep |
+/usr/bin sed cd cd -eu /usr/bin test $(pwd) grep
+	'quoted text' | done /usr/bin --verbose x=1 -eu readonly
+	"$@" $(pwd) 'quoted text'
+	"$1" /usr/bin ${HOME} && cd readonly readonly --verbose -eu done 'quoted text'
+sed x=1 /usr/bin 'quoted text' 2>/dev/null
+local test | -eu sed then grep
+		'quoted text' export 2>/dev/null awk readonly export && x=1 local cd "$@"
+'quoted text' then -eu then "$1" $(pwd) 2>/dev/null
+	awk sed readonly grep -eu -eu test
+then cd sed /usr/bin -eu sed "$1" test "$@" /usr/bin
+		-eu test test | -eu printf $(pwd) x=1 readonly
+grep ${HOME} grep -eu "$1" readonly x=1 printf
+	| x=1 printf sed grep x=1 "$@" test
+		then local echo 2>/dev/null done export sed x=1 | grep x=1 grep x=1 then cd 'quoted text'
+sed grep /usr/bin x=1 -eu sed then cd | ${HOME} $(pwd) 'quoted text' /usr/bin
+awk /usr/bin 2>/dev/null /usr/bin
+		test "$@" awk local done export sed then $(pwd) printf echo
+&& sed ${HOME} && "$1" $(pwd) ${HOME} echo && grep $(pwd) printf /usr/bin
+done grep && "$1" 2>/dev/null
+		$(pwd) sed grep sed export printf cd $(pwd)
+done ${HOME} && -eu --verbose readonly printf echo 'quoted text'
+	/usr/bin printf $(pwd) awk grep then awk $(pwd) |
+-eu done "$@" grep -eu "$1" 2>/dev/null printf 2>/dev/null awk test done "$1" cd
+		readonly export local --verbose
+		cd test done 'quoted text' awk
+	done grep 2>/dev/null done $(pwd) /usr/bin grep grep
+	local $(pwd) "$@" awk then
+	$(pwd) -eu x=1 && && $(pwd) export done sed export
+		"$@" sed readonly then x=1 printf /usr/bin then awk readonly cd then awk | 2>/dev/null
+	/usr/bin "$@" -eu sed export readonly /usr/bin sed test "$@"
+	&& done awk 'quoted text' x=1 --verbose --verbose "$1" x=1 ${HOME} export
+printf printf "$1" readonly
+		test done local 'quoted text' | ${HOME} x=1 then $(pwd) done done
+		readonly readonly echo 2>/dev/null
+	/usr/bin grep awk ${HOME} local
+	"$1" $(pwd) local cd sed cd /usr/bin --verbose grep printf
+--verbose 'quoted text'
+	/usr/bin echo echo /usr/bin export 2>/dev/null echo
+		"$1" local ${HOME} done then readonly cd cd --verbose $(pwd) $(pwd)
+$(pwd) cd test awk 'quoted text'
+	-eu test -eu sed ${HOME} test cd $(pwd)
+local readonly printf readonly readonly 2>/dev/null "$@" -eu "$1"
+		&& readonly grep --verbose
+x=1 grep --verbose "$1" 2>/dev/null $(pwd) 'quoted text' 'quoted text'
+		--verbose "$@" $(pwd) local | ${HOME}
+		2>/dev/null $(pwd) echo $(pwd) $(pwd)
+		printf x=1 -eu $(pwd) x=1 "$1" -eu printf grep
+	-eu && x=1 cd 'quoted text' then test then -eu then printf "$1" ${HOME}
+	awk 2>/dev/null test awk echo grep local then && echo 2>/dev/null local echo --verbose
+--verbose awk local -eu export echo
+	${HOME} readonly | 'quoted text' awk && local
+	2>/dev/null readonly done echo local test sed sed /usr/bin
+	&& -eu local "$@" ${HOME} grep
+--verbose && && 2>/dev/null ${HOME} sed -eu then "$1" 'quoted text'
+	| && 2>/dev/null local then export "$1" then --verbose
+	then "$@" export 'quoted text' 'quoted text'
+done $(pwd) then | echo | --verbose
+printf | awk grep /usr/bin done -eu echo
+	"$1" test | awk x=1 awk x=1 x=1 && $(pwd) x=1 done done 'quoted text'
+${HOME} printf grep --verbose cd
+done readonly done && "$@" x=1 /usr/bin done cd cd echo test printf
+printf "$1" test done sed awk "$1" printf grep 2>/dev/null
+awk --verbose "$1" ${HOME} echo then -eu $(pwd) local x=1 done local
+	test awk ${HOME} printf export grep awk | $(pwd) | 2>/dev/null
+		printf local readonly awk export
+awk test grep ${HOME} "$1" test --verbose
+"$1" sed /usr/bin awk printf export printf readonly export
+then echo export /usr/bin awk sed cd readonly -eu && x=1 sed export
+	grep readonly cd ${HOME} -eu
+sed export cd sed $(pwd) readonly
+sed --verbose /usr/bin readonly /usr/bin printf 2>/dev/null
+'quoted text' echo export "$@" test | "$@" awk awk "$@" echo export && echo
+'quoted text' ${HOME} -eu 'quoted text'
+	&& 2>/dev/null test "$@" sed /usr/bin /usr/bin echo "$1" awk test -eu /usr/bin
+-eu sed /usr/bin export 2>/dev/null echo
+		--verbose $(pwd) | ${HOME} test done ${HOME} "$1" cd "$1" --verbose echo then test
+	| 2>/dev/null "$@" awk sed 'quoted text'
+	awk then x=1 | -eu local grep cd test "$@" grep readonly -eu -eu then
+	done local && sed 'quoted text' 'quoted text'
+	-eu ${HOME} echo awk done sed awk -eu "$@" && 'quoted text' test local "$@"
+	$(pwd) cd readonly done 'quoted text'
+		printf 2>/dev/null grep export readonly
+	${HOME} local grep sed then export "$@" 'quoted text' && done
+	cd --verbose --verbose grep
+		${HOME} $(pwd) export "$@" 'quoted text' local x=1 'quoted text' printf "$1"
+	sed /usr/bin readonly && export done cd
+	echo done $(pwd) local export 2>/dev/null
+	test test "$1" | test $(pwd) | readonly 2>/dev/null --verbose
+		$(pwd) /usr/bin test local awk 'quoted text' ${HOME} 2>/dev/null /usr/bin /usr/bin
+echo test "$@" x=1 x=1 /usr/bin /usr/bin "$1" | export x=1 grep $(pwd) /usr/bin
+		echo "$1" grep awk grep
+	grep then 'quoted text' local /usr/bin
+	x=1 x=1 local -eu $(pwd) then -eu echo export && 'quoted text'
+'quoted text' printf 'quoted text'
+cd printf x=1 awk export export echo then awk printf "$1" local $(pwd) /usr/bin
+		then test test --verbose sed "$1" done "$1" --verbose
+	${HOME} | export && readonly -eu $(pwd) cd echo "$@" done test
+'quoted text' test && sed printf $(pwd) "$1" ${HOME}
+		| awk /usr/bin 'quoted text'
+	"$1" "$1" /usr/bin $(pwd) | "$1" cd 'quoted text'
+"$1" 2>/dev/null && && test sed
+| "$@" grep readonly /usr/bin
+		'quoted text' "$1" awk export local
+-eu "$1" done "$@" 'quoted text' /usr/bin local -eu
+	/usr/bin /usr/bin "$1"
+		grep "$@" $(pwd) x=1 done export | $(pwd) local 2>/dev/null $(pwd)
+printf $(pwd) echo then sed ${HOME}
+		done 'quoted text' -eu -eu x=1 'quoted text'
+		local awk /usr/bin local cd grep awk /usr/bin
+		done local 'quoted text' $(pwd)
+		/usr/bin 2>/dev/null echo "$@" x=1 echo x=1 $(pwd) printf
+		${HOME} test sed -eu /usr/bin | "$@" export
+	/usr/bin "$@" && /usr/bin awk 2>/dev/null "$@" 2>/dev/null awk done done printf
+	"$1" local export $(pwd) printf readonly done 2>/dev/null 2>/dev/null then --verbose
+grep x=1 then | sed "$@" ${HOME}
+	then 'quoted text' 2>/dev/null done export cd "$1" x=1 x=1 readonly
+	awk export done printf "$1" echo /usr/bin test $(pwd) 2>/dev/null
+	echo cd echo cd 2>/dev/null
+	echo --verbose cd export $(pwd)
+readonly "$1" 'quoted text' -eu sed printf && export cd sed done && echo
+	--verbose /usr/bin local 'quoted text'
+| readonly 2>/dev/null test "$@" -eu && awk -eu $(pwd) test | --verbose
+	done printf export && --verbose
+x=1 grep done | -eu grep 2>/dev/null
+	&& 'quoted text' /usr/bin echo
+then export "$@" | /usr/bin done awk cd --verbose
+		done done done "$@" "$@" export
+	sed then | grep 2>/dev/null x=1
+	printf local --verbose done sed 'quoted text' printf
+		cd cd printf local grep printf awk awk
+test x=1 echo "$@" local "$1" awk readonly test then
+	readonly 2>/dev/null awk x=1 echo sed then
+		export 2>/dev/null readonly local cd readonly
+		&& 'quoted text' 2>/dev/null test
+		2>/dev/null | then 2>/dev/null then echo printf export echo | --verbose done printf
+		printf x=1 /usr/bin export x=1 /usr/bin grep 2>/dev/null
+export readonly ${HOME} cd x=1 grep /usr/bin x=1 local "$@" cd
+		echo done --verbose readonly export
+	/usr/bin --verbose test cd printf $(pwd) printf && then
+printf awk -eu && 'quoted text' && test | done /usr/bin
+		local done cd grep | printf "$@" awk && then 2>/dev/null
+	awk awk done x=1 done readonly echo echo &&
+	grep grep -eu printf
+		sed "$@" --verbose /usr/bin
+	${HOME} then --verbose -eu ${HOME}
+	sed --verbose $(pwd) then $(pwd) | x=1 x=1 -eu /usr/bin grep $(pwd) "$1" $(pwd)
+cd x=1 done export test && printf grep --verbose
+done -eu then /usr/bin done
+		-eu local done grep 'quoted text'
+		awk printf $(pwd) sed ${HOME} awk -eu $(pwd) /usr/bin
+	then /usr/bin then "$@" "$@" && test sed awk
+	/usr/bin $(pwd) sed then 2>/dev/null local test "$1" /usr/bin && x=1 local
+grep -eu sed --verbose grep readonly | printf | grep
+		printf local local | "$1" readonly then $(pwd) "$1" 'quoted text' then x=1 ${HOME}
+		"$@" 2>/dev/null printf readonly sed done cd | awk sed sed -eu readonly x=1 echo
+		done --verbose && "$1" sed readonly -eu grep /usr/bin 2>/dev/null -eu grep 'quoted text'
+		local echo | cd export 'quoted text' && local
+	cd done $(pwd) printf && test | then awk && x=1 sed done 'quoted text'
+	printf readonly ${HOME} then -eu cd test && x=1 echo done /usr/bin sed done
+--verbose export printf --verbose ${HOME} sed 'quoted text'
+/usr/bin "$@" | local | ${HOME} --verbose
+	-eu done export then && then
+	$(pwd) && echo grep echo grep "$@" /usr/bin grep
+"$@" export && cd printf --verbose "$1" -eu printf 2>/dev/null -eu $(pwd) printf
+-eu $(pwd) -eu echo --verbose test sed awk
+		'quoted text' then x=1 printf
+	&& test sed sed /usr/bin "$1" && -eu |
+export /usr/bin export local cd "$@" done
+	grep $(pwd) && done /usr/bin && done $(pwd) $(pwd) local grep 2>/dev/null
+		cd awk "$1" done 'quoted text'
+awk && "$@" "$@" sed | local 2>/dev/null
+	test /usr/bin grep then -eu x=1 grep 2>/dev/null
+	awk test awk printf "$@" --verbose $(pwd) 'quoted text'
+	"$@" cd test export test &&
+		| $(pwd) ${HOME} /usr/bin /usr/bin $(pwd) export printf $(pwd)
+	sed done x=1 local sed readonly && cd test --verbose echo $(pwd) cd "$@"
+done cd echo cd grep -eu done && x=1 --verbose then local grep | /usr/bin --verbose
+	| local then "$@" && awk grep
+		$(pwd) then readonly cd
+		| then -eu && -eu export /usr/bin
+	&& printf echo test cd "$1" then sed grep export
+printf -eu cd x=1 /usr/bin sed ${HOME} x=1 export ${HOME}
+		x=1 && export 'quoted text' sed then
+echo export 'quoted text' "$@" export
+	test | /usr/bin /usr/bin cd readonly "$@" 2>/dev/null
+--verbose /usr/bin local readonly
+'quoted text' 'quoted text'
+test cd cd 2>/dev/null
+cd echo "$@" export /usr/bin
+echo 2>/dev/null --verbose "$@" sed --verbose grep export "$@" then --verbose
+	grep awk local then cd done test 'quoted text' x=1 && echo sed "$1" cd test
+	| ${HOME} && 'quoted text' done x=1 -eu grep then
+		'quoted text' printf --verbose sed test
+	sed done ${HOME} ${HOME} "$@" 'quoted text' done
+		grep /usr/bin sed --verbose done done --verbose 2>/dev/null 'quoted text' 2>/dev/null
+	then done readonly grep awk $(pwd)
+	grep && done then 'quoted text' export ${HOME} ${HOME} ${HOME} echo then
+		--verbose grep done 'quoted text' --verbose /usr/bin ${HOME}
+		echo then $(pwd) 'quoted text'
+${HOME} "$@" "$@" ${HOME} ${HOME} --verbose done -eu /usr/bin
+		/usr/bin done printf printf | 'quoted text' local
+	then then -eu --verbose -eu echo --verbose readonly then cd |
+		| 2>/dev/null ${HOME} /usr/bin
+--verbose -eu echo echo "$1" test printf
+--verbose export cd && /usr/bin
+		export 2>/dev/null "$@" awk --verbose grep x=1 readonly done then /usr/bin
+		$(pwd) awk $(pwd) done done x=1 ${HOME} -eu &&
+		readonly "$1" /usr/bin && /usr/bin awk then test echo echo printf
+	export 'quoted text' grep -eu export --verbose
+&& export 2>/dev/null | export "$@" "$@" --verbose sed --verbose -eu then
+	local grep "$1" test printf $(pwd) x=1 test export cd "$@" cd grep
+2>/dev/null ${HOME} | /usr/bin $(pwd) ${HOME} sed grep
+${HOME} export | printf done export test ${HOME} -eu && ${HOME} /usr/bin &&
+'quoted text' done "$@"
+		awk --verbose done -eu "$1"
+		| x=1 then cd -eu done local 'quoted text' 2>/dev/null readonly && export test test
+		&& $(pwd) $(pwd) awk sed done x=1 then then /usr/bin then $(pwd)
+		&& "$@" | then printf test -eu awk then sed readonly x=1 cd
+	local x=1 local done "$1" 2>/dev/null readonly echo
+		then "$@" readonly "$1" --verbose sed 2>/dev/null awk 'quoted text' printf
+| -eu | then && awk x=1
+echo cd 2>/dev/null "$@" printf test sed $(pwd) | 2>/dev/null
+--verbose ${HOME} "$@" 2>/dev/null done done --verbose x=1
+printf "$1" local grep --verbose
+	sed && echo | readonly readonly
+		/usr/bin test export 2>/dev/null cd grep awk export readonly
+	${HOME} --verbose readonly "$@" && $(pwd) echo
+/usr/bin then | awk local
+		| 2>/dev/null sed then --verbose echo cd "$1" done 'quoted text'
+	export ${HOME} $(pwd) grep /usr/bin printf "$@" 2>/dev/null awk
+${HOME} test && | echo ${HOME} 2>/dev/null ${HOME} -eu echo done awk test readonly
+		&& echo $(pwd) printf $(pwd) readonly -eu 'quoted text' /usr/bin "$@" ${HOME}
+--verbose "$@" local readonly /usr/bin local "$1" readonly
+	${HOME} done readonly grep local echo
+	cd then cd ${HOME} echo | 'quoted text' x=1 | export local "$1" local "$@" --verbose
+		done /usr/bin printf done /usr/bin grep echo awk
+		/usr/bin /usr/bin awk grep local ${HOME} cd export --verbose "$1"
+	"$1" $(pwd) -eu printf --verbose done $(pwd) done -eu -eu | awk -eu --verbose
+	readonly awk done echo echo --verbose 'quoted text'
+		| "$@" printf sed "$1" -eu readonly then 2>/dev/null
+		done 'quoted text' printf
+	--verbose readonly | awk then grep && echo
+	x=1 "$1" 2>/dev/null echo test && "$@" "$1" awk "$1" ${HOME}
+	"$1" -eu grep cd -eu readonly cd export
+'quoted text' test test
+		/usr/bin done grep awk grep printf test --verbose test x=1 test
+	$(pwd) export export grep cd | ${HOME} "$1" x=1 then sed 'quoted text'
+	${HOME} cd then awk x=1 ${HOME} done && 2>/dev/null readonly
+	${HOME} awk ${HOME} test | echo "$@" then --verbose $(pwd) readonly
+2>/dev/null | export printf 'quoted text' done awk "$@" $(pwd) | readonly
+		| sed export test 'quoted text'
+		echo 2>/dev/null "$1" "$@"
+	cd 2>/dev/null /usr/bin local
+		awk sed done test -eu grep x=1 awk awk
+	readonly export done cd awk -eu
+		"$@" local cd "$1" cd test readonly && cd | x=1 x=1 | printf ${HOME} $(pwd)
+cd "$@" export /usr/bin
+"$@" then | --verbose done awk cd printf printf /usr/bin
+awk x=1 export && 'quoted text'
+	export /usr/bin "$1" grep "$1" grep x=1 'quoted text' grep "$@" then $(pwd) --verbose
+		printf printf "$@" printf $(pwd) readonly ${HOME} 2>/dev/null readonly
+| "$1" test ${HOME} export printf local done test
+	-eu "$@" $(pwd) "$1" x=1 cd 'quoted text'
+export awk cd local echo export
+--verbose --verbose $(pwd) export /usr/bin readonly "$1" echo readonly
+	done awk "$@" "$1" local
+	export && grep test awk local echo 2>/dev/null "$1" | 'quoted text'
+	--verbose "$1" sed | && printf ${HOME} $(pwd) "$1" && | cd "$1" -eu grep &&
+then done then export echo 'quoted text' grep test -eu $(pwd) "$@" --verbose
+		local then awk printf grep awk /usr/bin done then cd --verbose cd printf x=1
+	| awk 2>/dev/null 2>/dev/null echo && "$@" && "$@" "$@" ${HOME}
+/usr/bin done done printf 2>/dev/null cd 'quoted text' local /usr/bin
+/usr/bin $(pwd) test local
+x=1 /usr/bin "$@" local local -eu printf ${HOME}
+echo printf cd x=1 local && grep 2>/dev/null cd $(pwd)
+		test x=1 cd awk readonly
+local awk printf && cd "$@" "$@" local
+		printf readonly 2>/dev/null
+sed sed /usr/bin awk then | test test "$@"
+	cd printf test sed printf printf awk &&
+'quoted text' x=1 | && --verbose && /usr/bin readonly
+		--verbose then 'quoted text' "$@" | --verbose echo
+	"$@" echo test sed $(pwd)
+		-eu -eu $(pwd) local 'quoted text' && 'quoted text' "$@" awk awk $(pwd)
+		test | printf cd /usr/bin echo
+	cd --verbose --verbose $(pwd)
+		$(pwd) then -eu echo test done "$@" | cd echo local ${HOME} "$1" "$1"
+		--verbose --verbose "$@" then test sed cd "$@" $(pwd)
+"$@" $(pwd) 'quoted text' --verbose /usr/bin x=1 done x=1
+		x=1 ${HOME} export | /usr/bin readonly sed "$@" cd echo 'quoted text' 'quoted text'
+	echo 2>/dev/null -eu export done "$1" readonly && readonly test done 2>/dev/null
+	2>/dev/null then printf readonly printf ${HOME} awk sed
+${HOME} 2>/dev/null "$@" | ${HOME} "$@" --verbose
+--verbose $(pwd) 'quoted text' cd "$1" ${HOME} | export export
+	$(pwd) 2>/dev/null done printf
+grep "$@" export --verbose
+		done 2>/dev/null "$@" done awk sed && --verbose local "$@"
+		awk done sed && then grep "$1" --verbose echo x=1 $(pwd) /usr/bin 'quoted text'
+		"$1" export printf 2>/dev/null
+${HOME} x=1 printf --verbose x=1 x=1 grep done sed cd cd $(pwd) sed
+2>/dev/null grep --verbose
+echo cd ${HOME} "$1" export "$@" ${HOME} grep printf
+	"$1" -eu printf x=1 --verbose
+		then $(pwd) "$1" export local
+'quoted text' export test "$1" done "$@" then readonly test 'quoted text' awk then
+	2>/dev/null "$@" 'quoted text' local
+		done 2>/dev/null test export grep && test -eu grep
+		| sed cd then "$1" printf
+export echo local "$1" then /usr/bin test then done x=1 done "$@" && printf
+	${HOME} $(pwd) 'quoted text' done x=1 test readonly then $(pwd) echo | 'quoted text'
+'quoted text' echo 2>/dev/null | | "$@" test --verbose awk
+		-eu /usr/bin echo | sed ${HOME} done then then
+		$(pwd) cd printf 'quoted text' cd test "$1" 2>/dev/null
+		cd sed readonly cd done cd | | grep
+readonly awk 'quoted text' -eu then -eu ${HOME} cd $(pwd)
+then x=1 "$1" readonly /usr/bin cd "$1"
+/usr/bin --verbose x=1 local readonly --verbose
+	test && | echo readonly /usr/bin ${HOME} readonly grep -eu "$1" && awk
+export sed "$@" x=1 -eu local x=1 cd
+x=1 sed /usr/bin /usr/bin --verbose "$@" x=1 test then
+	x=1 "$1" /usr/bin "$@" "$1"
+		x=1 test cd local --verbose awk -eu x=1 ${HOME}
+		-eu 'quoted text' test export test -eu local ${HOME} test awk
+	grep --verbose x=1 | cd printf ${HOME} $(pwd)
+	awk echo then x=1 echo 'quoted text' "$@" 2>/dev/null echo $(pwd) --verbose x=1
+		${HOME} ${HOME} sed done done $(pwd) echo --verbose
+readonly 'quoted text' "$1" cd 2>/dev/null echo -eu echo
+	"$1" test && /usr/bin done | && -eu cd local export ${HOME} export 2>/dev/null
+	$(pwd) test && grep awk "$@" test printf
+	&& awk 2>/dev/null && $(pwd) x=1 printf awk /usr/bin printf done
+| /usr/bin 'quoted text' test "$@" grep ${HOME} echo "$1" then /usr/bin export
+test done test grep | x=1 test readonly && test --verbose readonly sed sed printf
+	readonly 2>/dev/null 2>/dev/null printf grep
+printf export "$1" echo --verbose done export done
+	"$1" grep 'quoted text' x=1 local sed
+awk "$1" /usr/bin done cd /usr/bin then echo --verbose cd test /usr/bin
+then echo $(pwd) printf -eu readonly && echo
+	'quoted text' "$1" export
+	test && grep printf done awk /usr/bin
+	/usr/bin x=1 2>/dev/null "$1" 'quoted text' done readonly "$1"
+	'quoted text' $(pwd) "$1" echo --verbose awk x=1 export
+	awk -eu cd /usr/bin done grep test 'quoted text'
+	2>/dev/null done test export cd "$1" then 'quoted text' -eu done | then | && 'quoted text'
+		echo export readonly then then echo x=1
+	--verbose awk -eu ${HOME} grep $(pwd) 'quoted text'
+		${HOME} x=1 awk && done -eu export -eu sed cd $(pwd) cd export --verbose 2>/dev/null
+	"$1" && x=1 awk done grep 2>/dev/null --verbose
+		done 'quoted text' "$1" | then sed && printf sed /usr/bin $(pwd) /usr/bin
+	&& ${HOME} $(pwd) | awk local
+$(pwd) done $(pwd) cd 'quoted text' 2>/dev/null local then
+${HOME} printf && local x=1 grep x=1 echo sed done printf
+	grep ${HOME} local x=1 local /usr/bin awk "$@" done "$1" awk -eu export cd
+readonly then "$@" done echo 'quoted text' sed export test | 2>/dev/null
+sed awk cd 2>/dev/null "$1" cd done printf | ${HOME} readonly sed && printf then
+--verbose --verbose && 2>/dev/null grep done local
+&& 2>/dev/null | readonly | x=1 "$@" local local 2>/dev/null
+	test | $(pwd) printf | | test export sed "$@"
+	&& && then export $(pwd)
+		--verbose printf readonly -eu readonly printf /usr/bin "$1" local 'quoted text'
+	done local 'quoted text' done | 2>/dev/null
+	x=1 ${HOME} $(pwd) local && export x=1 --verbose local && 2>/dev/null
+2>/dev/null awk /usr/bin grep printf then printf $(pwd) local x=1 sed export ${HOME}
+'quoted text' 2>/dev/null
+		| "$@" local grep -eu && echo cd x=1 "$@" "$1" then echo
+		awk /usr/bin ${HOME} $(pwd) local && && readonly
+		$(pwd) 2>/dev/null export /usr/bin sed then
+	grep | echo | "$1" "$1"
+"$@" ${HOME} local --verbose export local printf then "$1" 'quoted text'
+		sed x=1 done $(pwd) 'quoted text' done --verbose test
+grep awk done ${HOME} local
+	"$@" ${HOME} | test grep "$@" /usr/bin "$1"
+		"$1" test sed export "$@" done local grep local /usr/bin x=1
+done "$@" export && cd done export sed local | | 'quoted text' printf
+export echo cd | grep && grep 'quoted text' grep echo -eu then | -eu && --verbose
+	local test printf printf ${HOME} "$1" ${HOME}
+local then x=1 "$1" then
+--verbose grep grep && test "$1"
+		sed export | "$1" "$1" local export -eu 2>/dev/null --verbose "$@" sed export
+/usr/bin awk "$@" then local | && 'quoted text' | cd "$@" cd done | x=1 'quoted text'
+/usr/bin 'quoted text' 'quoted text'
+local /usr/bin /usr/bin ${HOME} | && 2>/dev/null readonly "$@" $(pwd)
+export done 'quoted text' "$@" readonly readonly "$1" "$@"
+	"$1" | then $(pwd) grep 2>/dev/null export --verbose grep 'quoted text'
+		local | grep ${HOME} then awk printf "$1" ${HOME} "$1"
+	export local "$1" "$1" 2>/dev/null -eu $(pwd) 'quoted text'
+	then "$1" 2>/dev/null export -eu --verbose
+	printf awk done cd cd ${HOME} cd "$1" done export grep grep done --verbose
+cd local $(pwd) awk --verbose echo ${HOME} echo
+cd 'quoted text' 2>/dev/null export
+	2>/dev/null /usr/bin echo x=1 x=1 && test x=1 done -eu /usr/bin x=1
+	grep sed done 2>/dev/null
+		2>/dev/null then /usr/bin grep grep x=1
+/usr/bin /usr/bin local local printf awk 2>/dev/null
+| | && "$1" awk /usr/bin $(pwd)
+	grep printf && test local ${HOME}
+then 'quoted text' x=1 'quoted text'
+${HOME} -eu then printf local && --verbose 2>/dev/null
+	'quoted text' && "$1" 'quoted text' -eu then
+		--verbose test cd grep $(pwd) echo awk
+done echo --verbose "$@" then
+	$(pwd) cd x=1 2>/dev/null sed
+x=1 | printf awk | sed -eu -eu "$@" sed
+		echo test -eu "$@" sed cd local export test readonly export
+		test printf export 2>/dev/null test -eu grep export then echo -eu test cd ${HOME}
+	--verbose | local $(pwd) then
+printf && x=1 $(pwd) printf --verbose --verbose -eu -eu --verbose
+		${HOME} -eu export "$@" | local 2>/dev/null
+printf 'quoted text' printf $(pwd) ${HOME} 2>/dev/null "$1"
+	x=1 2>/dev/null readonly x=1 awk
+	&& printf 2>/dev/null echo local export cd 'quoted text' 2>/dev/null sed test
+		"$@" && && echo awk awk | echo "$@" awk test then
+		local sed x=1 -eu cd echo -eu
+		x=1 "$@" && echo /usr/bin readonly
+	printf ${HOME} | -eu $(pwd) awk done export local && --verbose
+		x=1 export && x=1 echo ${HOME} awk -eu "$1" grep /usr/bin local -eu "$1" sed 2>/dev/null
+		| 2>/dev/null 'quoted text' sed
+x=1 local cd "$1" 2>/dev/null
+2>/dev/null ${HOME} printf 'quoted text' x=1 "$1" | local --verbose done -eu
+	then echo -eu 'quoted text' echo ${HOME} awk test grep ${HOME} then && $(pwd) printf
+		cd "$1" test 'quoted text' ${HOME} "$@" 2>/dev/null
+	--verbose grep 2>/dev/null awk "$1" grep $(pwd) --verbose
+		| -eu 2>/dev/null -eu 2>/dev/null -eu then grep /usr/bin done readonly sed local
+		cd then ${HOME} readonly done awk -eu export
+then grep echo --verbose -eu local 2>/dev/null local test test x=1
+done 2>/dev/null printf printf 'quoted text' $(pwd) printf x=1 readonly
+	awk /usr/bin local $(pwd)
+awk grep x=1 sed "$1" | cd awk "$@" local done then "$@"
+	local test echo "$1" "$1"
+export /usr/bin done grep 2>/dev/null
+		"$1" readonly ${HOME} done ${HOME} local | $(pwd) grep grep /usr/bin
+		&& 2>/dev/null readonly 'quoted text' 2>/dev/null echo then done awk
+		${HOME} awk sed 'quoted text'
+		2>/dev/null grep "$@" "$@" export readonly local 2>/dev/null
+${HOME} 'quoted text' then --verbose ${HOME}
+	/usr/bin cd local ${HOME} done 'quoted text'
+		-eu "$@" 2>/dev/null 'quoted text' ${HOME}
+--verbose cd /usr/bin | readonly "$@" x=1 cd x=1 awk
+	readonly sed "$@" then export
+	done ${HOME} echo "$1" --verbose printf 'quoted text'
+	-eu awk test x=1 export ${HOME} sed $(pwd) cd --verbose "$1"
+grep | test done echo "$1" ${HOME} | 'quoted text'
+	/usr/bin ${HOME} export done "$1" readonly
+${HOME} 'quoted text' x=1 done
+&& -eu -eu then echo printf
+-eu "$@" local 'quoted text'
+	local cd sed then $(pwd) grep | local echo readonly cd sed echo x=1 2>/dev/null
+cd 2>/dev/null --verbose x=1 'quoted text' | "$@" printf "$@" export $(pwd)
+printf x=1 done /usr/bin export done -eu ${HOME} /usr/bin awk local local $(pwd)
+	&& cd test cd echo ${HOME} cd
+	2>/dev/null awk echo | -eu echo ${HOME} test x=1
+'quoted text' 'quoted text' export --verbose
+	then --verbose x=1 -eu "$1" awk local /usr/bin grep then 2>/dev/null
+	cd then | x=1 "$1" /usr/bin /usr/bin printf $(pwd) --verbose
+	$(pwd) --verbose ${HOME} then "$@" test awk
+	$(pwd) awk $(pwd) $(pwd) done echo echo | sed printf && local /usr/bin
+	"$1" "$@" "$@" "$1" | ${HOME}
+	export grep sed "$@" $(pwd) awk
+	export -eu done test awk /usr/bin | local && && 2>/dev/null --verbose
+		2>/dev/null $(pwd) readonly export then "$@"
+export "$@" then x=1 test --verbose done
+		"$@" -eu "$@" | "$1" echo echo
+		'quoted text' cd local then grep cd 2>/dev/null then
+	| ${HOME} 'quoted text' cd "$1"
+test readonly grep printf 'quoted text' cd done --verbose
+		cd x=1 grep export export export x=1 | /usr/bin x=1 2>/dev/null cd "$@"
+		then grep x=1 cd 2>/dev/null ${HOME} -eu "$1" "$@" printf /usr/bin
+	readonly 2>/dev/null sed readonly /usr/bin $(pwd) | && local echo
+readonly -eu x=1 grep
+	--verbose awk $(pwd) /usr/bin echo
+	printf 2>/dev/null grep /usr/bin awk then
+	2>/dev/null grep awk grep
+	&& $(pwd) printf "$1" cd done ${HOME}
+&& /usr/bin && | sed -eu 'quoted text'
+done readonly -eu awk ${HOME} |
+		readonly readonly /usr/bin local done local local 'quoted text' test test --verbose
+sed /usr/bin x=1 x=1 printf echo then && && then readonly
+readonly printf readonly "$@" && x=1 grep x=1 | grep 'quoted text' readonly
+echo cd sed export -eu -eu readonly
+		-eu grep --verbose echo cd export awk | --verbose
+echo sed echo $(pwd) local /usr/bin awk /usr/bin done "$@" 2>/dev/null
+	readonly printf readonly -eu readonly echo "$@" grep test grep x=1 done --verbose
+	${HOME} 'quoted text' ${HOME} sed local 2>/dev/null "$1" 'quoted text' "$@" cd
+-eu done && 'quoted text'
+printf printf then --verbose awk --verbose grep 2>/dev/null
+cd printf x=1 x=1 readonly readonly
+		then 'quoted text' local export
+		export local export -eu --verbose cd 'quoted text' then test
+		'quoted text' echo ${HOME} sed export local readonly "$1" done sed $(pwd)
+		sed 2>/dev/null 'quoted text' $(pwd) grep then echo test --verbose /usr/bin
+"$@" "$1" x=1 'quoted text' test test echo x=1 local test
+	x=1 then $(pwd) printf readonly x=1 "$@" export echo readonly
+	cd local "$1" | test printf && local /usr/bin local
+		-eu | readonly grep readonly x=1 test 'quoted text' $(pwd) /usr/bin printf
+-eu | "$1" | "$@" cd $(pwd)
+		local grep export printf cd cd ${HOME} ${HOME} | | x=1 grep echo "$1" /usr/bin
+		"$@" "$@" export local then "$@" grep
+	then | echo "$1" grep | printf 2>/dev/null printf && -eu "$1" -eu
+		sed 2>/dev/null done && --verbose printf export local ${HOME}
+"$@" && | $(pwd) x=1 test && export readonly "$1" grep
+	sed x=1 echo test echo awk | ${HOME}
+	"$@" x=1 local cd "$@" test
+		export --verbose then readonly "$1" echo 'quoted text' export "$1" done
+	${HOME} then && printf printf "$1" 2>/dev/null grep test echo 2>/dev/null export
+		$(pwd) cd then readonly ${HOME} export echo /usr/bin x=1 sed | "$@"
+then x=1 local /usr/bin readonly -eu then grep $(pwd) done 'quoted text'
+		2>/dev/null echo grep "$@" echo 'quoted text' 2>/dev/null
+$(pwd) x=1 done -eu | /usr/bin cd "$@" sed
+		'quoted text' cd export "$@" then done --verbose ${HOME} local printf
+		awk ${HOME} && "$@" $(pwd) readonly
+	-eu echo local "$@" awk then done cd 2>/dev/null
+		done x=1 export "$1" 'quoted text'
+| grep printf | /usr/bin printf $(pwd) local readonly && | export cd
+local | "$@" echo printf awk local
+		${HOME} 2>/dev/null /usr/bin "$1" --verbose
+	test export ${HOME} | export done local local done then /usr/bin x=1 awk
+		export printf ${HOME} test "$1" && echo --verbose then $(pwd) printf grep
+--verbose printf readonly "$1" "$@" grep export ${HOME}
+-eu "$1" grep ${HOME} then echo printf $(pwd) local
+		x=1 cd 'quoted text' -eu sed "$1" grep "$@" | 2>/dev/null done printf
+2>/dev/null done | && printf
+		/usr/bin -eu "$1" grep "$1" "$@" printf awk x=1
+		x=1 printf | 'quoted text' cd printf 'quoted text' awk local
+		/usr/bin && test test ${HOME} cd cd export | export grep ${HOME} 'quoted text'
+-eu done $(pwd) cd $(pwd) 2>/dev/null && awk cd -eu ${HOME} $(pwd) local --verbose
+local -eu ${HOME} /usr/bin awk "$1" ${HOME} ${HOME}
+test --verbose "$1" awk 'quoted text' $(pwd)
+	done export "$1" then readonly "$@" $(pwd) done 2>/dev/null
+		--verbose printf "$1" export printf sed printf "$@"
+	| grep "$@" 'quoted text'
+	cd && | 'quoted text' 2>/dev/null --verbose echo export /usr/bin
+printf 'quoted text' test "$@" -eu done --verbose
+		printf "$1" awk export 2>/dev/null 2>/dev/null then $(pwd) && 2>/dev/null
+		grep "$1" awk awk sed $(pwd) 'quoted text'
+export && grep sed printf
+		cd "$@" 'quoted text' echo 2>/dev/null export x=1
+	-eu "$@" $(pwd) "$@" 2>/dev/null
+	then $(pwd) awk readonly 2>/dev/null test 'quoted text'
+then local sed sed && echo done awk "$@" echo |
+-eu grep 2>/dev/null grep ${HOME} -eu done ${HOME} printf --verbose echo sed 'quoted text'
+		${HOME} grep readonly | echo printf 'quoted text' "$@"
+"$@" local --verbose "$@" then done local export awk
+		then && 2>/dev/null "$@" && ${HOME} local printf sed
+		cd 2>/dev/null awk test && grep "$1" 2>/dev/null
+export -eu 'quoted text' -eu
+done /usr/bin test done then && 'quoted text' "$1" ${HOME}
+		x=1 /usr/bin readonly --verbose 'quoted text' echo
+	"$1" /usr/bin "$1" test test && printf $(pwd) ${HOME} done then --verbose then
+	&& "$1" --verbose echo $(pwd) ${HOME} grep sed echo -eu grep sed && -eu --verbose
+local "$@" $(pwd) | -eu printf x=1 2>/dev/null
+echo ${HOME} /usr/bin readonly done "$@" 2>/dev/null export then
+		printf -eu x=1 readonly readonly 'quoted text' "$1" x=1 x=1 grep test
+	grep test /usr/bin ${HOME} awk x=1 readonly
+local awk local grep $(pwd) local done echo /usr/bin | test x=1
+cd 'quoted text' readonly x=1
+		printf "$1" && 'quoted text' && test --verbose /usr/bin cd printf
+	/usr/bin done ${HOME} printf done export "$1" ${HOME} done ${HOME} export
+		awk done printf echo local && cd ${HOME} $(pwd) |
+	${HOME} /usr/bin then 2>/dev/null "$1" 2>/dev/null | x=1
+		printf ${HOME} | ${HOME} 'quoted text' local
+-eu | awk x=1 cd printf readonly -eu /usr/bin then grep | local readonly
+		${HOME} then | -eu $(pwd) awk
+		done readonly -eu "$@" done x=1 -eu export cd $(pwd) | && test grep local 'quoted text'
+	"$1" sed awk echo done && && test
+test ${HOME} awk sed 'quoted text' echo printf test readonly
+	"$1" x=1 export 'quoted text'
+		then $(pwd) grep grep "$1" printf
+		'quoted text' export awk $(pwd) grep
+		${HOME} then done $(pwd) done && ${HOME} test ${HOME} x=1
+		export local 2>/dev/null "$1" echo test
+test grep cd ${HOME} grep -eu then grep "$1" readonly
+		"$@" 'quoted text' -eu echo sed printf then $(pwd) && --verbose
+then then x=1 readonly 2>/dev/null then && x=1 'quoted text' "$@" local grep
+printf test && | cd && cd x=1 sed x=1 --verbose cd printf && echo export
+		echo export grep readonly $(pwd)
+		2>/dev/null cd "$1" readonly printf --verbose ${HOME}
+	"$1" x=1 $(pwd) cd local 'quoted text' grep "$1" export |
+	then echo | grep /usr/bin readonly
+		/usr/bin test then ${HOME}
+	x=1 -eu test grep && 'quoted text'
+		local export ${HOME} |
+	export awk echo -eu ${HOME} && "$1" $(pwd) echo export 'quoted text'
+		-eu "$1" x=1 local && 2>/dev/null 2>/dev/null "$1" local test
+	then test sed then ${HOME} awk then export then && test cd then readonly
+	then $(pwd) /usr/bin readonly
+		local then "$1" "$@" x=1 2>/dev/null test
+&& && grep printf "$1" --verbose --verbose
+printf grep /usr/bin 2>/dev/null export sed
+	grep local test done cd x=1 then 2>/dev/null --verbose echo -eu then grep
+		--verbose done -eu then "$@" echo /usr/bin local awk x=1 x=1
+		export "$@" /usr/bin 'quoted text' && | done && test ${HOME} local cd
+then 2>/dev/null "$@" awk readonly --verbose then "$@"
+		grep --verbose $(pwd) local awk --verbose
+local 'quoted text' -eu
+export 'quoted text' -eu | printf test echo done
+"$1" && | "$1" cd "$@" test readonly --verbose cd grep ${HOME} -eu awk "$@"
+	awk && then awk grep test -eu done grep && "$@" export 2>/dev/null 2>/dev/null
+readonly then sed 2>/dev/null $(pwd) -eu | done && then
+printf awk 2>/dev/null sed "$@" sed then && local awk -eu ${HOME} /usr/bin "$@"
+then 2>/dev/null done then 2>/dev/null "$@" x=1 grep
+	&& local x=1 export /usr/bin $(pwd) printf test awk | |
+		printf | sed awk 'quoted text'
+	sed done $(pwd) readonly awk export sed cd cd && grep
+	sed $(pwd) && then 2>/dev/null local
+	x=1 $(pwd) grep -eu echo /usr/bin
+echo "$@" "$1" ${HOME} $(pwd)
+		${HOME} awk grep 2>/dev/null /usr/bin | done $(pwd) export 2>/dev/null sed
+$(pwd) 2>/dev/null --verbose done export done then test "$@" readonly 2>/dev/null
+		then local then grep x=1 ${HOME}
+	x=1 && x=1 ${HOME} && "$@" -eu local ${HOME} /usr/bin -eu "$1" echo 2>/dev/null
+2>/dev/null && 2>/dev/null printf 'quoted text' printf x=1 | /usr/bin
+	| 2>/dev/null then "$@" && grep then grep test -eu "$@" grep "$@" -eu cd local
+	x=1 x=1 sed printf $(pwd) grep grep | /usr/bin
+	"$@" /usr/bin local x=1 done test x=1 printf ${HOME} grep /usr/bin -eu
+cd then x=1 test --verbose $(pwd) local
+test && | 2>/dev/null printf cd $(pwd) echo awk /usr/bin awk grep "$1" --verbose
+grep grep | ${HOME} echo | test --verbose $(pwd)
+		then export readonly sed echo then ${HOME}
+	awk -eu 'quoted text' "$1" "$1" echo $(pwd) | | -eu export
+	local "$1" echo echo grep ${HOME} then "$@" echo then echo -eu printf "$@"
+		awk 2>/dev/null printf done "$1" sed grep ${HOME} -eu -eu /usr/bin
+awk x=1 done "$@" readonly done sed --verbose /usr/bin
+		local 2>/dev/null && printf
+		test echo "$@" then "$@" then then /usr/bin
+	-eu sed "$@" export "$@" "$@" echo $(pwd) 2>/dev/null
+	/usr/bin awk x=1 $(pwd) x=1 && x=1 ${HOME}
+		awk 2>/dev/null | export "$1" grep printf
+echo | -eu local 'quoted text' done ${HOME} --verbose --verbose
+	grep done export echo ${HOME} --verbose ${HOME} "$@" ${HOME}
+	readonly /usr/bin sed readonly
+then | "$@" printf && | |
+	sed 'quoted text' /usr/bin 2>/dev/null then 2>/dev/null
+sed 2>/dev/null sed grep cd local
+	"$@" "$@" export $(pwd) sed then local sed export 2>/dev/null test test awk
+	local "$1" "$1" "$@" done | grep "$1"
+	"$@" done sed /usr/bin done
+	$(pwd) "$@" echo export "$1" /usr/bin "$@" local echo 2>/dev/null
+	local $(pwd) "$1" done done | test "$@" "$1" x=1
+		then 2>/dev/null --verbose && 'quoted text'
+		&& done -eu --verbose echo test echo test
+cd test cd printf "$1" test export export
+	"$@" grep grep "$@" ${HOME} x=1 test "$@" grep cd $(pwd) export
+	sed grep | sed -eu /usr/bin && awk 'quoted text' printf done cd "$1" printf then
+		2>/dev/null sed -eu --verbose
+	2>/dev/null local cd ${HOME} && done local sed && sed readonly
+		| done test export echo 'quoted text'
+		awk | cd 'quoted text' then /usr/bin echo -eu readonly local 2>/dev/null
+		readonly readonly echo sed "$1" awk --verbose $(pwd) awk
+'quoted text' /usr/bin 2>/dev/null local 'quoted text' awk readonly
+local export x=1 readonly readonly 2>/dev/null awk 2>/dev/null echo printf --verbose
+		printf -eu 2>/dev/null echo then $(pwd) -eu readonly
+	&& | sed done done awk grep x=1 echo x=1 ${HOME} 'quoted text'
+echo printf /usr/bin $(pwd) && 'quoted text' x=1 awk 'quoted text'
+$(pwd) 'quoted text' readonly test ${HOME}
+		--verbose 2>/dev/null "$@" 'quoted text' -eu /usr/bin
+export $(pwd) test --verbose sed x=1 /usr/bin printf printf 2>/dev/null
+| ${HOME} awk ${HOME} then ${HOME} /usr/bin
+	printf 'quoted text' && test grep echo then export /usr/bin
+		/usr/bin awk awk sed "$1" 'quoted text'
+	local sed --verbose echo awk done sed 2>/dev/null sed x=1
+${HOME} 2>/dev/null export | && awk
+	$(pwd) 2>/dev/null done grep | awk grep awk /usr/bin
+	'quoted text' echo export then && then
+	"$@" export printf grep -eu -eu then cd sed --verbose /usr/bin
+	2>/dev/null printf --verbose 'quoted text' ${HOME} export local
+test 'quoted text' | echo x=1 readonly done export sed 2>/dev/null x=1 local
+		x=1 done 'quoted text' "$@"
+'quoted text' | then
+	&& $(pwd) printf grep x=1 x=1 --verbose local
+export $(pwd) export --verbose cd done 'quoted text'
+cd 2>/dev/null sed cd $(pwd) -eu "$1" test $(pwd) /usr/bin local readonly 'quoted text'
+2>/dev/null /usr/bin readonly awk awk
+		sed $(pwd) awk "$@" export sed then /usr/bin /usr/bin
+		done "$1" then printf echo "$1" | then 2>/dev/null -eu sed --verbose "$@"
+test -eu grep done test 'quoted text' sed grep ${HOME} sed
+x=1 2>/dev/null cd echo export cd export test readonly then awk "$@" x=1 readonly
+"$@" "$@" --verbose sed sed "$@" echo test 2>/dev/null
+"$1" 2>/dev/null | "$@" test $(pwd) readonly --verbose 2>/dev/null --verbose
+#include c143.sh
+	readonly "$1" -eu $(pwd) awk /usr/bin
+		--verbose && export "$1" done "$1" grep "$@" 'quoted text'
+		2>/dev/null --verbose "$@" "$@" local export local awk | done
+| export ${HOME} --verbose --verbose
+/usr/bin readonly --verbose
+		readonly cd then done && export printf /usr/bin export "$1" 'quoted text'
+		2>/dev/null test grep test /usr/bin && ${HOME} --verbose cd "$1"
+| awk "$@" ${HOME} "$1" done ${HOME} /usr/bin "$1" echo 'quoted text'
+export "$1" grep 2>/dev/null
+--verbose --verbose local ${HOME} local readonly
+	"$@" sed "$@" cd "$1" readonly 2>/dev/null $(pwd) done | $(pwd)
+export /usr/bin -eu | readonly readonly then && local echo printf 2>/dev/null
+		cd --verbose local then sed $(pwd) | then cd 2>/dev/null
+| | grep 'quoted text' "$1" printf awk export
+		${HOME} grep $(pwd) -eu
+--verbose export -eu 'quoted text' 2>/dev/null awk ${HOME} export cd
+grep /usr/bin "$1" readonly grep then -eu "$1" 2>/dev/null 'quoted text'
+x=1 cd 2>/dev/null ${HOME} echo then test --verbose
+export readonly $(pwd) x=1 'quoted text' echo then --verbose cd grep
+	cd cd $(pwd) awk && echo && grep --verbose
+	grep printf local sed /usr/bin then echo sed sed 'quoted text' test
+		local cd x=1 local -eu x=1
+echo && awk sed /usr/bin awk /usr/bin awk awk
+local --verbose --verbose then done cd test 'quoted text'
+cd $(pwd) test echo printf done test cd && export grep echo "$1"
+	grep | x=1 'quoted text' 'quoted text' 2>/dev/null
+--verbose cd "$1" test awk test then $(pwd) "$1" awk | sed awk cd
+	-eu "$1" "$1" echo && done x=1 | && export -eu sed printf
+${HOME} --verbose readonly
+		awk "$@" 2>/dev/null $(pwd) "$1" --verbose test then $(pwd) printf
+x=1 readonly local -eu --verbose x=1 export 'quoted text' cd ${HOME}
+	-eu done 2>/dev/null x=1 awk local readonly && ${HOME} sed x=1 printf
+		"$1" "$@" readonly local "$@" $(pwd) local grep /usr/bin test test ${HOME}
+echo cd 2>/dev/null export | $(pwd) ${HOME}
+local awk -eu then readonly $(pwd) && sed 'quoted text' then awk echo cd
+	local done | awk 'quoted text' "$1" | test test -eu x=1 grep then $(pwd) -eu readonly
+		then --verbose grep test
+		--verbose $(pwd) "$1" then /usr/bin printf | awk && -eu sed ${HOME} grep
+| 'quoted text' test then test && readonly
+		/usr/bin x=1 printf done readonly export "$@" sed
+x=1 ${HOME} grep readonly grep grep export 2>/dev/null 'quoted text'
+&& then sed cd -eu export -eu
+		readonly grep x=1 export x=1 cd x=1
+done grep "$@" | -eu ${HOME}
+'quoted text' 2>/dev/null $(pwd) ${HOME}
+readonly cd then echo export /usr/bin x=1
+local test test --verbose echo /usr/bin readonly
+		done cd 2>/dev/null x=1 awk && /usr/bin ${HOME} grep done done readonly
+	cd export 2>/dev/null 2>/dev/null -eu awk then $(pwd) awk readonly --verbose
+	echo then /usr/bin "$1" && echo echo && cd sed readonly "$1" printf ${HOME}
+		"$@" ${HOME} x=1 echo --verbose ${HOME} cd readonly echo $(pwd) ${HOME} 'quoted text'
+${HOME} $(pwd) then awk export ${HOME} local local grep "$1"
+		x=1 x=1 export export printf
+grep /usr/bin ${HOME} "$1"
+export $(pwd) readonly -eu /usr/bin grep local
+	sed cd sed | echo 2>/dev/null 2>/dev/null && --verbose
+		grep local echo && readonly
+		sed 'quoted text' /usr/bin test && $(pwd)
+'quoted text' | 'quoted text' 'quoted text'
+	${HOME} 2>/dev/null done local test printf
+		-eu local done echo | cd test test "$1" $(pwd) "$@"
+then test awk /usr/bin "$@" printf
+readonly "$@" export done readonly
+		cd $(pwd) --verbose then awk | cd | readonly
+		readonly "$1" | then && readonly readonly x=1 cd $(pwd) "$1"
+	export -eu -eu -eu $(pwd) export x=1 /usr/bin done done && local cd test
+		&& 2>/dev/null 2>/dev/null
+	printf /usr/bin /usr/bin 2>/dev/null -eu cd
+	grep cd test awk done 'quoted text' readonly
+		done export awk 'quoted text' local cd
+		2>/dev/null then --verbose grep awk | then --verbose then 'quoted text' x=1 awk
+	x=1 printf --verbose cd test $(pwd) && "$@" 2>/dev/null
+${HOME} local 2>/dev/null test
+	x=1 && 'quoted text' && $(pwd) sed "$@" readonly
+		readonly 2>/dev/null ${HOME} sed ${HOME}
+		awk 'quoted text' grep printf --verbose --verbose awk sed "$1" test "$@" cd 2>/dev/null
+	&& $(pwd) awk -eu && awk x=1 'quoted text' x=1 --verbose -eu printf
+	test local export readonly printf ${HOME}
+echo grep ${HOME} export then cd -eu "$@" "$@" -eu x=1 "$1" 2>/dev/null
+		test grep --verbose grep ${HOME} test $(pwd) then 'quoted text' local /usr/bin
+	/usr/bin cd echo grep done 'quoted text' -eu && 2>/dev/null
+		--verbose ${HOME} -eu "$@" -eu /usr/bin 'quoted text' /usr/bin printf
+	/usr/bin /usr/bin "$@" awk cd local 2>/dev/null "$1"
+	cd printf echo ${HOME} | grep
+		${HOME} done printf local local local ${HOME} awk 'quoted text'
+	"$1" | test "$1" echo cd printf $(pwd) grep /usr/bin printf
+| /usr/bin "$@" export export "$1" ${HOME} $(pwd) export awk test done done
+		sed readonly $(pwd) 'quoted text' echo && "$@" echo x=1 export export
+		readonly export done /usr/bin --verbose -eu grep x=1 "$@" --verbose x=1 --verbose
+		sed sed "$1" export ${HOME} done local $(pwd) done
+	"$@" export 2>/dev/null --verbose /usr/bin $(pwd) -eu cd x=1 printf &&
+		| "$@" grep test sed "$1" test -eu cd cd done
+	echo "$1" 'quoted text' --verbose
+test sed echo readonly ${HOME} cd awk | done test 'quoted text' readonly done
+'quoted text' grep done echo -eu $(pwd) export ${HOME} export readonly x=1 done
+test done export readonly then awk $(pwd) local echo $(pwd)
+	'quoted text' local x=1 "$1" sed /usr/bin
+"$@" /usr/bin | awk x=1 test x=1 test test ${HOME} "$@" -eu x=1 cd $(pwd) "$1"
+		| awk sed && 2>/dev/null --verbose
+	export then awk grep x=1 done then /usr/bin cd "$1" -eu echo && cd ${HOME}
+		2>/dev/null grep awk printf "$1" "$1" echo
+	${HOME} cd -eu ${HOME} local --verbose cd test "$1"
+	local then "$1" awk "$1" sed readonly
+	x=1 'quoted text' $(pwd) && && --verbose echo | "$@" x=1 export x=1
+readonly "$1" $(pwd) && cd echo grep
+done export then /usr/bin awk readonly done readonly /usr/bin readonly
+		grep readonly test then cd local
+cd printf x=1 grep test "$@" readonly $(pwd) done
+	&& x=1 && readonly printf -eu cd && "$@" sed "$@" done /usr/bin | "$@"
+sed then then ${HOME} local awk then | 'quoted text' test $(pwd)
+	x=1 local printf cd && /usr/bin echo | readonly
+	| awk awk x=1 export $(pwd) "$1"
+		-eu grep awk echo && 'quoted text'
+local "$1" test cd grep done done local echo sed ${HOME} "$@" --verbose
+	echo done --verbose export 'quoted text'
+local 'quoted text' sed awk | readonly ${HOME}
+	printf 'quoted text' 'quoted text' export "$1"
+	grep done printf grep local then
+awk readonly 'quoted text' -eu --verbose printf "$@" test
+grep done export export test
+		done ${HOME} then ${HOME} --verbose printf sed done -eu local "$@"
+	x=1 cd then export printf 2>/dev/null ${HOME}
+local readonly done echo /usr/bin $(pwd)
+echo printf export "$1" sed then
+printf grep -eu 'quoted text' && grep echo cd grep then ${HOME} readonly
+then test --verbose && && -eu export
+		&& "$@" | sed "$1" then done $(pwd) sed awk --verbose
+	sed done grep "$1" cd test
+	echo && test | 'quoted text' "$@" done then printf test "$1" | 2>/dev/null
+"$1" "$1" /usr/bin done
+&& "$@" sed done sed x=1 $(pwd)
+--verbose ${HOME} "$1" $(pwd) $(pwd)
+printf done sed test 2>/dev/null
+		${HOME} 'quoted text' done grep /usr/bin "$1" grep readonly
+	| sed test $(pwd) && -eu && /usr/bin readonly done "$@" then
+/usr/bin awk local cd 'quoted text' 'quoted text' /usr/bin
+	cd -eu | local grep awk 2>/dev/null done printf then echo sed "$@" 2>/dev/null
+	/usr/bin export cd printf "$1" "$1" "$@" grep echo export
+	x=1 x=1 grep awk "$@" test "$@"
+	grep grep then 'quoted text' awk "$@" readonly cd local && sed grep "$@"
+"$@" grep -eu awk 'quoted text'
+		x=1 "$1" grep && printf "$@" sed sed
+local export then printf cd $(pwd) awk "$1" ${HOME} | ${HOME} -eu ${HOME}
+	'quoted text' "$@" $(pwd) -eu sed sed local -eu
+	echo "$1" --verbose "$1" then printf then 'quoted text' 2>/dev/null
+		test 2>/dev/null --verbose ${HOME} "$1" "$@"
+then grep awk export | x=1 ${HOME} $(pwd) then readonly 2>/dev/null
+		export test | /usr/bin
+grep printf export readonly | printf cd test awk
+		${HOME} sed 'quoted text' --verbose /usr/bin readonly 'quoted text'
+	/usr/bin grep --verbose | --verbose then local --verbose &&
+		then --verbose 2>/dev/null "$@"
+	&& -eu grep | && $(pwd) readonly readonly | -eu readonly "$@"
+		done "$1" grep sed "$1" ${HOME} | && --verbose "$@" /usr/bin "$@"
+		--verbose sed sed | --verbose -eu ${HOME} x=1 2>/dev/null "$@" x=1 'quoted text'
+	printf local then 'quoted text' ${HOME} export 'quoted text'
+	done -eu then ${HOME} "$@" grep
+	&& | sed 'quoted text' done ${HOME} readonly
+'quoted text' | done -eu x=1 sed ${HOME}
+	2>/dev/null 'quoted text' local /usr/bin "$@" export
+	"$@" then $(pwd) x=1 awk local local test "$1" cd readonly | | echo
+	${HOME} readonly awk "$1" x=1 done ${HOME} 'quoted text'
+		${HOME} ${HOME} sed done cd cd test local 2>/dev/null
+		| | 'quoted text' cd && /usr/bin local grep -eu ${HOME} printf ${HOME} $(pwd)
+	done 2>/dev/null 2>/dev/null --verbose done local readonly
+		export /usr/bin grep printf "$@" --verbose && &&
+	'quoted text' awk && --verbose "$@" done export
+	local 2>/dev/null cd | cd 2>/dev/null awk printf ${HOME} echo local ${HOME} /usr/bin
+		then then | done done sed sed &&
+	| test && cd awk done printf echo && test /usr/bin printf && printf x=1 printf
+		local -eu 2>/dev/null done readonly local "$@" export
+	grep $(pwd) 2>/dev/null && && 'quoted text' cd | x=1 echo 2>/dev/null
+	'quoted text' grep local 'quoted text' awk 2>/dev/null --verbose "$1"
+	&& && awk test && x=1 $(pwd)
+awk grep test grep cd awk x=1 export && 'quoted text' --verbose 'quoted text'
+		readonly sed x=1 test done printf test --verbose $(pwd) grep test $(pwd)
+grep sed ${HOME} printf "$@" sed 2>/dev/null awk printf
+grep local export --verbose "$1" | && sed x=1 grep grep sed awk printf
+	echo && test ${HOME} test printf awk test local sed $(pwd) cd sed &&
+	/usr/bin x=1 readonly 'quoted text' ${HOME}
+"$@" | echo $(pwd) test local done
+		${HOME} done /usr/bin --verbose then sed export
+	then printf done sed && "$@" ${HOME} /usr/bin 'quoted text' && /usr/bin
+	'quoted text' -eu done | export
+	"$1" export echo "$@" -eu export then echo export local /usr/bin $(pwd)
+	/usr/bin cd x=1 $(pwd) && done --verbose cd 'quoted text' "$1" --verbose
+	readonly done -eu "$@" "$@"
+		'quoted text' awk /usr/bin readonly "$1" 2>/dev/null "$1" then "$1" | "$@" ${HOME}
+'quoted text' | export test readonly $(pwd) "$1" then awk -eu grep &&
+awk ${HOME} ${HOME} sed printf
+	'quoted text' readonly /usr/bin ${HOME} echo "$1"
+grep readonly awk done echo 'quoted text' grep ${HOME} -eu $(pwd) local "$@"
+		echo export readonly x=1 -eu grep x=1 readonly cd cd printf 'quoted text' "$@"
+sed echo done ${HOME} --verbose
+export --verbose "$@" then 2>/dev/null readonly
+	| cd /usr/bin | local $(pwd) 'quoted text' then export -eu printf
+	export --verbose test
+	done then "$1" export ${HOME}
+	export "$1" "$1" | printf export local --verbose /usr/bin done --verbose
+	-eu echo $(pwd) "$@" 2>/dev/null
+/usr/bin cd /usr/bin x=1 "$@" $(pwd) && x=1 x=1 test local
+x=1 | ${HOME} $(pwd) "$1" "$@"
+"$1" "$@" sed "$1" -eu export $(pwd) sed --verbose --verbose -eu ${HOME} && "$@"
+	export "$@" "$@" sed test test echo then export $(pwd) | --verbose
+		${HOME} ${HOME} local export
+		$(pwd) grep -eu --verbose ${HOME} then "$@" "$1" "$1" ${HOME} grep awk
+test ${HOME} ${HOME} grep -eu cd | 2>/dev/null cd | grep grep $(pwd)
+		| then cd --verbose $(pwd)
+	grep "$@" | x=1 "$1" -eu done && x=1 local done -eu && x=1 ${HOME} export then
+		"$1" awk echo -eu --verbose test /usr/bin printf awk readonly awk readonly -eu
+	&& export then && x=1 cd test echo 2>/dev/null then awk
+		local x=1 2>/dev/null test | | "$@"
+awk 'quoted text' awk cd printf
+		then echo 'quoted text'
+test | cd test readonly 2>/dev/null done && 'quoted text'
+	then grep echo "$@" -eu then && ${HOME} -eu x=1 local
+--verbose grep done test && cd printf --verbose
+	${HOME} "$@" 'quoted text' sed
+/usr/bin awk -eu grep -eu --verbose $(pwd) | done
+&& awk -eu readonly then --verbose export readonly -eu test done readonly
+${HOME} | grep | && $(pwd) $(pwd)
+		&& 'quoted text' 2>/dev/null readonly "$@" x=1 then printf
+		awk echo /usr/bin -eu awk local echo
+	/usr/bin 'quoted text' "$@" $(pwd) test && done ${HOME} printf --verbose
+		sed test cd 'quoted text' export sed 2>/dev/null
+	'quoted text' $(pwd) /usr/bin sed
+	"$@" 'quoted text' test printf
+readonly | 2>/dev/null echo "$@" cd x=1 --verbose grep
+"$@" "$1" && "$1" cd printf
+/usr/bin grep local readonly "$1"
+printf --verbose --verbose local done test readonly export readonly $(pwd)
+local export /usr/bin && -eu grep 'quoted text'
+	cd -eu | awk "$@" $(pwd) 2>/dev/null cd --verbose
+		x=1 local ${HOME} echo /usr/bin "$@" awk
+		awk $(pwd) 2>/dev/null $(pwd) echo done ${HOME} printf
+	local then 'quoted text' export x=1 awk done sed sed done
+-eu sed --verbose 'quoted text' "$@" done export
+x=1 then 'quoted text' --verbose
+	2>/dev/null printf 2>/dev/null
+		then $(pwd) "$1" done -eu -eu awk $(pwd) 'quoted text'
+	done "$@" cd | echo ${HOME} local printf
+echo /usr/bin then /usr/bin
+cd -eu local "$1" 2>/dev/null
+	'quoted text' awk ${HOME} 'quoted text' then cd -eu export $(pwd) test readonly
+		local printf export -eu -eu "$1" grep done grep && grep 'quoted text' --verbose
+test printf grep -eu 'quoted text'
+		-eu printf | ${HOME} awk test "$1" printf /usr/bin $(pwd) printf test
+		sed echo readonly 'quoted text' /usr/bin $(pwd) 2>/dev/null
+2>/dev/null | "$@" echo sed awk awk grep awk echo cd 2>/dev/null -eu printf local
+	echo cd x=1 /usr/bin grep export 'quoted text'
+&& && /usr/bin "$@" /usr/bin
+	awk && test | local echo
+"$@" -eu done --verbose "$@" cd local export
+		"$1" printf "$1" test local ${HOME} awk "$@" 2>/dev/null awk $(pwd) /usr/bin -eu
+	done grep 'quoted text' && | 2>/dev/null 'quoted text'
+	'quoted text' readonly x=1 local done done
+then x=1 2>/dev/null cd ${HOME} sed --verbose test 'quoted text' echo $(pwd)
+	--verbose test 'quoted text' ${HOME} -eu x=1 then "$@" readonly ${HOME}
+grep | cd cd readonly 2>/dev/null "$1" &&
+x=1 $(pwd) $(pwd) export | printf | "$1" ${HOME} && | | readonly awk local export
+	sed "$1" local grep printf
+awk printf printf cd -eu && local export /usr/bin printf "$@" x=1 && export
+	sed x=1 /usr/bin export /usr/bin ${HOME}
+done | awk test sed then | "$@" then printf awk
+	$(pwd) local local printf readonly
+		done ${HOME} /usr/bin readonly /usr/bin cd awk /usr/bin
+		x=1 "$1" readonly sed awk done $(pwd) sed | then printf && ${HOME}
+	'quoted text' x=1 -eu grep then
+	sed | "$1" readonly sed local cd $(pwd) "$1" cd 'quoted text' cd "$@" echo && printf
+readonly | printf sed && sed ${HOME} /usr/bin then echo /usr/bin ${HOME}
+echo | test test sed x=1 echo "$1" /usr/bin
+/usr/bin 2>/dev/null 2>/dev/null 2>/dev/null && "$@" ${HOME}
+'quoted text' && awk local echo sed 'quoted text' cd echo
+		grep "$@" && && printf | readonly grep -eu 'quoted text'
+		echo 2>/dev/null test test sed -eu echo
+		'quoted text' "$@" "$@" grep --verbose -eu | "$@" /usr/bin $(pwd)
+	awk done export --verbose readonly ${HOME}
+	awk cd x=1 | 'quoted text' done sed "$1" done sed --verbose "$@" readonly export
+'quoted text' ${HOME} grep "$1" export local test ${HOME}
+	2>/dev/null printf $(pwd) /usr/bin echo test printf then awk "$1" 'quoted text'
+/usr/bin 'quoted text' local export test local /usr/bin
+	awk --verbose -eu local echo "$1" done sed echo | grep readonly &&
+		test | readonly x=1 echo sed /usr/bin
+	done local test test /usr/bin $(pwd) sed printf grep x=1 local "$1" echo
+		${HOME} cd "$1" test 'quoted text' x=1 /usr/bin then readonly
+	'quoted text' test && readonly grep readonly readonly &&
+"$@" sed grep ${HOME} "$@" readonly $(pwd) | x=1 cd readonly sed
+		-eu $(pwd) --verbose x=1 /usr/bin && readonly
+	echo export /usr/bin $(pwd) sed
+	"$@" "$1" printf --verbose 'quoted text'
+	local export "$1" awk readonly cd sed 'quoted text' printf export grep
+		readonly cd echo "$1" grep awk cd "$1" cd done && awk ${HOME}
+readonly && | readonly awk "$@"
+echo 2>/dev/null /usr/bin
+	export x=1 "$1" "$@" | 'quoted text' "$@"
+	awk $(pwd) grep then export 'quoted text'
+	"$1" ${HOME} test then -eu local $(pwd)
+		readonly --verbose -eu 2>/dev/null echo awk /usr/bin
+		then $(pwd) --verbose grep echo | 'quoted text'
+sed x=1 --verbose "$1" ${HOME} $(pwd) "$1" | then | "$@" 'quoted text'
+x=1 then grep done readonly
+		"$1" sed sed local "$1" awk done 'quoted text' readonly ${HOME} $(pwd) local
+		$(pwd) awk done "$@" sed then cd $(pwd) 'quoted text' printf
+		x=1 echo sed sed "$@" -eu awk "$1"
+	$(pwd) done printf /usr/bin cd x=1 "$@" && cd
+&& -eu export 'quoted text' | local local readonly then
+printf then /usr/bin echo local ${HOME} local awk test then cd
+	"$1" 'quoted text' "$@" ${HOME} test | 2>/dev/null "$@" grep 'quoted text'
+	export test then done test done test readonly
+	$(pwd) done 2>/dev/null ${HOME} test echo
+		2>/dev/null printf test /usr/bin "$@"
+done echo awk --verbose done x=1 test local "$1" grep grep --verbose
+		${HOME} readonly local printf "$@" "$@"
+--verbose $(pwd) cd echo "$1" --verbose cd then 2>/dev/null ${HOME} "$1" grep /usr/bin
+"$@" printf sed grep echo export then -eu echo | local "$1" 2>/dev/null readonly
+	grep $(pwd) x=1 then echo 2>/dev/null --verbose &&
+local echo printf printf 2>/dev/null ${HOME} then export export
+		-eu awk | sed --verbose local -eu 'quoted text' sed
+		echo local "$1" --verbose sed done printf awk readonly echo printf sed echo
+		grep printf x=1 x=1 test && ${HOME} -eu -eu ${HOME}
+		"$@" --verbose grep "$@" 'quoted text' grep done x=1
+		/usr/bin test export test $(pwd) x=1 -eu x=1 then 'quoted text' then
+printf done readonly awk --verbose
+${HOME} awk echo "$1" awk
+		export && x=1 test /usr/bin
+-eu awk test -eu readonly | $(pwd) test $(pwd) $(pwd)
+	--verbose readonly sed -eu then readonly test
+printf --verbose "$1" "$1" 'quoted text' /usr/bin echo /usr/bin
+'quoted text' export test x=1 test ${HOME} printf x=1 grep awk x=1 'quoted text'
+printf "$@" test $(pwd) 'quoted text' awk sed
+		cd printf echo -eu | -eu local --verbose readonly x=1 x=1 'quoted text' "$@"
+		export then ${HOME} ${HOME} --verbose local local | grep
+2>/dev/null printf ${HOME} ${HOME} 'quoted text' ${HOME} printf
+	printf x=1 grep 2>/dev/null readonly export -eu export readonly 'quoted text'
+	| sed && test -eu x=1 "$@" --verbose 2>/dev/null test export grep
+		local done then awk export $(pwd) readonly then x=1 grep 'quoted text' ${HOME}
+	awk 'quoted text' "$@" -eu grep sed
+		cd readonly && && then 'quoted text' cd -eu export &&
+	| && | 'quoted text' ${HOME} x=1 awk printf sed "$@"
+		readonly | readonly grep test
+/usr/bin && x=1 done | | --verbose grep "$1" awk printf x=1 'quoted text'
+	echo done local grep /usr/bin && 2>/dev/null "$1" 'quoted text'
+"$1" echo cd then /usr/bin echo then 'quoted text' | ${HOME} x=1 printf
+		&& export --verbose test "$@" printf export echo done && | "$@" printf
+done x=1 ${HOME} x=1 'quoted text' 'quoted text' "$1" 'quoted text'
+		"$1" -eu done && printf echo 'quoted text' grep $(pwd) 'quoted text' printf
+		--verbose | | && readonly $(pwd)
+	"$1" local -eu 'quoted text' echo grep sed awk
+	printf cd awk readonly 'quoted text' "$@" --verbose echo $(pwd)
+	printf /usr/bin 'quoted text' readonly "$1"
+	readonly local $(pwd) then cd readonly cd echo
+printf done 2>/dev/null
+		grep export "$1" x=1 done "$1" export printf ${HOME} printf local
+		| ${HOME} | /usr/bin then
+test ${HOME} grep --verbose "$1" printf ${HOME} awk -eu export "$@" "$@"
+		grep && 2>/dev/null echo readonly $(pwd) export | then sed
+	done printf "$@" grep ${HOME} 2>/dev/null cd ${HOME} echo export
+awk | /usr/bin grep export readonly test 2>/dev/null
+		local /usr/bin grep grep /usr/bin
+	-eu local local "$1" /usr/bin "$1"
+-eu test done readonly --verbose ${HOME} test readonly export cd export
+		"$@" "$1" sed ${HOME} readonly -eu awk grep |
+		&& "$@" echo export "$@" | "$1" 'quoted text' then && --verbose
+$(pwd) /usr/bin export && --verbose
+then ${HOME} "$1" cd local printf x=1 /usr/bin awk done x=1 "$1"
+x=1 sed && "$@" readonly && sed
+		"$1" | | x=1 local /usr/bin && --verbose && x=1
+		| ${HOME} 2>/dev/null grep echo printf
+	local x=1 --verbose printf 2>/dev/null ${HOME} test 'quoted text' awk printf
+	test /usr/bin $(pwd) readonly
+		awk grep readonly && && 2>/dev/null 'quoted text' export test cd sed sed --verbose
+$(pwd) -eu "$@" --verbose printf
+then "$@" export readonly export awk
+		2>/dev/null /usr/bin /usr/bin $(pwd) export
+		"$@" then done local local
+printf "$1" echo awk then printf printf "$@" | export
+	x=1 'quoted text' 2>/dev/null --verbose
+local grep ${HOME} awk x=1 grep then readonly && done printf | done
+		then $(pwd) printf x=1 then
+	"$@" $(pwd) $(pwd) "$@" && export readonly awk local 'quoted text' 2>/dev/null
+		--verbose "$1" test "$@"
+grep echo ${HOME} /usr/bin --verbose
+"$1" local -eu 2>/dev/null
+		"$1" $(pwd) printf /usr/bin test awk && $(pwd) $(pwd)
+	-eu then cd awk cd echo 2>/dev/null -eu done test readonly 2>/dev/null
+		"$@" printf /usr/bin done /usr/bin | readonly /usr/bin ${HOME} grep test ${HOME}
+		then -eu | "$1" cd "$1" 'quoted text'
+		-eu echo readonly "$@" "$1" printf printf | | /usr/bin x=1 'quoted text'
+		done "$@" -eu --verbose export ${HOME}
+	readonly done test awk printf echo --verbose test
+export "$@" --verbose echo then echo && sed local export
+		/usr/bin -eu x=1 x=1 printf 'quoted text' && done readonly
+	$(pwd) "$1" /usr/bin then 'quoted text' done x=1 then grep
+	--verbose done grep local
+	--verbose | -eu -eu export awk x=1 echo "$1" readonly --verbose | "$@" "$1" "$@"
+		'quoted text' printf readonly local printf printf echo
+		printf then | 2>/dev/null $(pwd) local 'quoted text'
+local | $(pwd) cd echo
+		grep 'quoted text' -eu $(pwd) grep $(pwd)
+	then then $(pwd) export echo
+	done done /usr/bin echo local -eu ${HOME} $(pwd)
+	cd readonly $(pwd) -eu grep 2>/dev/null grep awk local 'quoted text'
+		'quoted text' sed 2>/dev/null then && readonly echo printf -eu then cd
+		'quoted text' readonly done readonly
+2>/dev/null export grep awk && readonly test
+		sed done "$1" local export "$1" cd readonly 'quoted text' sed done && export local
+	done | -eu echo cd "$1" ${HOME} x=1 /usr/bin 'quoted text' /usr/bin sed
+x=1 done | "$1" | --verbose $(pwd) then
+	'quoted text' 2>/dev/null
+"$@" x=1 readonly -eu grep awk then "$@" cd cd local readonly printf test printf
+	'quoted text' --verbose cd sed -eu test test && --verbose ${HOME} ${HOME} "$@" sed
+	then 2>/dev/null then
+		&& 2>/dev/null echo awk ${HOME} x=1 /usr/bin --verbose && done
+	'quoted text' local readonly ${HOME} cd grep "$1" readonly
+		grep -eu sed cd export test --verbose local cd cd echo printf readonly
+awk export -eu sed 'quoted text' $(pwd) grep
+		-eu test echo done | "$@" printf then
+$(pwd) $(pwd) then |
+	2>/dev/null grep sed awk cd 2>/dev/null
+printf export awk echo | --verbose cd echo cd test "$@" echo echo
+$(pwd) done /usr/bin /usr/bin sed echo | ${HOME} echo test x=1
+	done x=1 --verbose awk awk grep | then | then $(pwd) -eu awk
+		${HOME} test echo local echo cd 2>/dev/null local echo
+${HOME} cd ${HOME} grep readonly then readonly
+	cd --verbose $(pwd) awk && awk ${HOME} readonly --verbose -eu done sed awk
+${HOME} $(pwd) export "$1" "$@" sed done ${HOME} x=1 readonly x=1 ${HOME} cd
+awk $(pwd) && --verbose | then -eu /usr/bin
+	grep ${HOME} "$@" grep printf echo && /usr/bin
+		&& x=1 -eu ${HOME} 2>/dev/null sed -eu 2>/dev/null export 'quoted text'
+readonly "$@" && awk done readonly && && "$@" ${HOME} ${HOME} $(pwd) sed -eu
+		printf echo --verbose "$1" x=1 done sed /usr/bin --verbose
+test $(pwd) $(pwd) echo "$1" "$@" 'quoted text'
+		"$@" | grep done export
+	| test sed awk local done then sed
+done 2>/dev/null && ${HOME}
+then local cd /usr/bin echo "$@" readonly test then local done grep export
+	--verbose sed local /usr/bin
+	readonly | "$1" 'quoted text' grep then | grep then && echo done -eu -eu --verbose
+${HOME} grep grep && 2>/dev/null 'quoted text' echo ${HOME} grep
+		printf export test grep sed /usr/bin printf readonly sed 2>/dev/null
+		"$1" sed -eu | readonly -eu ${HOME} --verbose grep
+then printf | "$@" ${HOME}
+${HOME} -eu grep --verbose sed && export export "$@" ${HOME}
+		done echo awk x=1 "$@" -eu x=1 /usr/bin $(pwd) /usr/bin echo sed then local |
+		cd local grep 'quoted text'
+		cd $(pwd) test /usr/bin "$1" awk $(pwd)
+		cd "$1" echo cd && x=1 x=1 /usr/bin
+x=1 --verbose echo local
+		test /usr/bin test ${HOME} export 'quoted text' --verbose cd echo
+	readonly awk grep "$1" printf "$1" --verbose done 'quoted text' printf
+	-eu "$1" --verbose printf sed "$1" ${HOME} $(pwd) echo local | grep
+		-eu echo x=1 grep 2>/dev/null 2>/dev/null
+		&& $(pwd) --verbose ${HOME} test /usr/bin /usr/bin cd local
+then 'quoted text' --verbose
+		readonly echo awk 2>/dev/null sed echo
+	test then readonly 2>/dev/null done cd $(pwd) | -eu sed 'quoted text'
+local sed printf awk grep readonly
+	echo x=1 "$@" | cd --verbose "$1" ${HOME} done
+		sed done $(pwd) export echo local -eu --verbose echo cd
+	"$1" done cd sed readonly grep "$@" test 2>/dev/null 2>/dev/null
+cd cd "$1" readonly sed awk done printf "$1" "$1" then printf | awk -eu local export
+	&& -eu export export -eu | ${HOME} $(pwd) echo 'quoted text' --verbose
+test sed --verbose export awk cd | then
+		&& ${HOME} readonly $(pwd) export "$@" $(pwd) --verbose "$@"
+		$(pwd) /usr/bin sed ${HOME} "$@" --verbose $(pwd)
+	local --verbose test x=1 readonly ${HOME} -eu | /usr/bin
+	awk echo readonly sed then printf printf cd "$@" --verbose grep awk echo
+	readonly -eu printf && echo done
+		printf 2>/dev/null | readonly grep -eu export grep -eu readonly -eu grep
+		"$@" 'quoted text' export --verbose done
+	"$1" readonly export done grep 2>/dev/null printf 'quoted text'
+readonly 'quoted text' readonly x=1 echo awk readonly $(pwd) x=1
+		${HOME} "$1" ${HOME} -eu 'quoted text'
+	readonly -eu 'quoted text' then test $(pwd) printf then 'quoted text'
+	then grep -eu echo && 'quoted text' -eu test local cd --verbose
+	2>/dev/null test grep 2>/dev/null $(pwd) | 2>/dev/null done local grep
+"$@" --verbose /usr/bin export | test "$1" x=1 cd /usr/bin $(pwd)
+	echo printf grep && sed export
+sed readonly done 2>/dev/null 2>/dev/null readonly cd | 'quoted text' x=1 export
+		"$1" printf /usr/bin 2>/dev/null -eu
+	x=1 "$1" "$1" cd echo $(pwd) --verbose $(pwd) test local grep /usr/bin done
+	&& printf sed export cd "$1" ${HOME} local && && 'quoted text' printf -eu ${HOME}
+echo readonly /usr/bin | "$@" 'quoted text' echo ${HOME} | && local export ${HOME}
+echo printf sed grep done 2>/dev/null cd "$@" awk sed cd local
+echo /usr/bin x=1 grep sed ${HOME}
+export echo -eu local 'quoted text'
+	&& | cd echo test echo 2>/dev/null | cd --verbose cd -eu
+		then 2>/dev/null && "$1" -eu $(pwd) export | sed $(pwd) grep local local
+	"$@" /usr/bin awk local test 2>/dev/null
+	test readonly cd $(pwd) readonly "$@" cd "$1" 'quoted text' local | done --verbose
+'quoted text' /usr/bin 'quoted text' "$@"
+		"$1" /usr/bin 2>/dev/null cd && cd x=1 test export /usr/bin
+'quoted text' cd echo printf
+		&& echo sed echo "$1" grep awk cd printf done "$@" sed /usr/bin
+	local 2>/dev/null grep $(pwd) done printf 2>/dev/null done $(pwd)
+	awk -eu awk test | $(pwd) $(pwd)
+		printf readonly readonly then "$1" && export test "$1"
+		-eu -eu | -eu grep readonly "$@" awk done readonly readonly
+		'quoted text' export
+		&& $(pwd) x=1 awk local $(pwd) -eu && -eu awk sed --verbose
+		cd -eu | 2>/dev/null 'quoted text' done echo "$@" awk /usr/bin && 'quoted text'
+/usr/bin test then local "$1" | local x=1 grep
+		grep 2>/dev/null export cd done done cd export x=1 sed x=1 readonly ${HOME}
+awk then printf local grep readonly cd
+		then /usr/bin sed -eu test --verbose 2>/dev/null
+		awk sed "$@" | sed printf "$@" cd && cd
+grep export export 2>/dev/null -eu "$@" printf echo
+test sed x=1 && "$@" printf awk -eu awk /usr/bin sed /usr/bin -eu cd then
+		test readonly export local export x=1 readonly $(pwd) -eu done export -eu cd printf
+"$1" local echo "$@" test -eu $(pwd) awk "$@"
+		sed readonly "$1" $(pwd) 2>/dev/null x=1 -eu
+	$(pwd) grep grep cd && && local local printf done && -eu ${HOME} $(pwd) 2>/dev/null
+	then echo printf /usr/bin /usr/bin awk
+export awk "$1" printf test /usr/bin awk echo
+		grep "$1" ${HOME} 'quoted text' && 'quoted text' "$@" test grep x=1 $(pwd)
+		then sed done awk && local printf printf sed export --verbose 2>/dev/null
+	echo "$@" test export local grep test 2>/dev/null
+		/usr/bin /usr/bin 2>/dev/null
+	x=1 "$1" echo --verbose 'quoted text' 2>/dev/null
+awk echo -eu sed export readonly sed ${HOME} 2>/dev/null
+--verbose local local then && cd "$@" printf local awk $(pwd)
+'quoted text' $(pwd) x=1 done printf printf test "$@"
+	-eu /usr/bin ${HOME} awk && "$@" cd ${HOME}
+$(pwd) test $(pwd) 'quoted text' echo x=1
+		readonly echo test grep | "$@" x=1 ${HOME} "$1" then grep grep --verbose && echo
+	&& echo cd readonly test -eu $(pwd) then "$@" grep
+	readonly -eu export printf cd local printf then x=1 ${HOME} --verbose &&
+		| done local sed export test awk "$@" "$1" cd then -eu /usr/bin "$1" readonly
+		awk /usr/bin $(pwd) then /usr/bin
+sed /usr/bin "$1" --verbose grep 2>/dev/null "$1" "$@" && grep echo local readonly
+		grep printf 2>/dev/null sed --verbose grep echo 2>/dev/null
+awk then 2>/dev/null 2>/dev/null ${HOME} ${HOME} && "$1" 2>/dev/null export export
+local readonly test "$1" test | -eu &&
+		echo echo 2>/dev/null readonly x=1 cd local done test --verbose cd
+	$(pwd) echo 'quoted text' sed 'quoted text'
+printf --verbose echo export then echo x=1 local
+	'quoted text' done 'quoted text'
+	printf printf "$@" sed 'quoted text' export x=1
+done 2>/dev/null x=1 --verbose
+		readonly /usr/bin | "$@"
+		&& "$1" cd local "$@" 2>/dev/null
+		local cd $(pwd) done "$@" && done 2>/dev/null "$@" done
+		done local 2>/dev/null $(pwd) 2>/dev/null /usr/bin
+"$1" 'quoted text' $(pwd) printf sed ${HOME}
+${HOME} then readonly ${HOME} ${HOME} printf -eu "$1" 2>/dev/null
+${HOME} x=1 $(pwd) 'quoted text' | done readonly /usr/bin test grep grep
+	readonly --verbose 'quoted text' export $(pwd) && echo readonly
+	awk done export grep cd $(pwd) "$1" awk then echo done
+'quoted text' 'quoted text' export export | && 2>/dev/null cd "$@" | && done -eu
+		cd 'quoted text' sed done "$1" | 'quoted text'
+		x=1 --verbose export ${HOME} && then -eu readonly "$@" grep echo $(pwd)
+	export -eu $(pwd) export cd $(pwd)
+		--verbose ${HOME} 2>/dev/null sed awk ${HOME} 2>/dev/null
+cd local readonly cd /usr/bin && "$1" x=1 awk -eu done printf
+--verbose local 'quoted text' 2>/dev/null grep 2>/dev/null
+		sed /usr/bin grep grep $(pwd)
+		then test /usr/bin cd $(pwd) then | $(pwd) "$1"
+	sed --verbose $(pwd) cd | test "$@" $(pwd) "$@" local cd x=1 |
+	grep "$@" $(pwd) /usr/bin
+		awk -eu "$1" cd ${HOME} echo grep cd $(pwd) then
+	$(pwd) cd "$1" printf printf $(pwd) echo
+x=1 done | $(pwd) "$@" done
+		2>/dev/null "$@" && readonly local awk /usr/bin && done grep
+	sed "$1" grep grep sed grep export export
+	then test ${HOME} awk test 2>/dev/null "$1" printf done
+		readonly grep "$1" awk cd awk
+		2>/dev/null export && grep | test export 'quoted text' export
+'quoted text' awk x=1 awk "$1" echo --verbose
+sed test $(pwd) cd x=1 /usr/bin
+	echo awk sed awk grep -eu "$1" export export local --verbose "$1" echo -eu
+sed 2>/dev/null 'quoted text' 2>/dev/null
+		--verbose ${HOME} grep 'quoted text'
+readonly echo readonly -eu 2>/dev/null
+		done test readonly export test --verbose -eu
+cd done printf 2>/dev/null awk echo "$@" x=1 && 'quoted text' local
+		--verbose cd /usr/bin --verbose ${HOME} "$1" awk
+		x=1 grep -eu /usr/bin sed && sed test 'quoted text'
+	$(pwd) awk echo && --verbose readonly grep
+	echo grep x=1 'quoted text' "$@" cd /usr/bin readonly sed "$@" "$@"
+	then -eu x=1 sed echo sed then "$@" export -eu printf "$1" done
+x=1 grep then printf ${HOME} 'quoted text' readonly
+sed 2>/dev/null then 'quoted text' cd test printf 2>/dev/null
+	test --verbose printf local export "$@" | "$@" test
+	&& export -eu --verbose sed | -eu sed done export
+		local done local grep ${HOME} test then "$@" $(pwd) local
+test local --verbose local
+		'quoted text' 'quoted text' done --verbose readonly export 2>/dev/null
+	| export printf 'quoted text' cd /usr/bin x=1
+	grep local 2>/dev/null test readonly done "$1" export
+	/usr/bin readonly awk grep printf $(pwd) ${HOME} 2>/dev/null
+/usr/bin x=1 2>/dev/null awk readonly x=1 grep done
+		-eu done cd export 2>/dev/null
+"$@" x=1 then then export
+	--verbose then ${HOME} 'quoted text' "$1" "$1" && -eu
+"$1" echo export printf ${HOME} | local ${HOME}
+then test 2>/dev/null cd grep printf
+then $(pwd) "$@" | grep && -eu echo && --verbose
+	${HOME} local -eu && test
+	${HOME} -eu echo 'quoted text' && test $(pwd) awk
+	2>/dev/null ${HOME} $(pwd) local ${HOME} echo awk printf
+	test --verbose x=1 2>/dev/null printf printf export "$@" $(pwd) grep then
+	2>/dev/null grep "$@" echo 2>/dev/null x=1 "$@" && printf export
+		printf local echo -eu export awk
+		'quoted text' --verbose local echo
+	${HOME} $(pwd) 'quoted text'
+	echo export /usr/bin export x=1 "$@" ${HOME}
+	printf cd "$1" done --verbose 'quoted text'
+$(pwd) awk export test echo ${HOME}
+	--verbose x=1 readonly then && export 2>/dev/null
+		$(pwd) "$@" && test --verbose ${HOME} 'quoted text' awk cd
+printf ${HOME} printf --verbose x=1 /usr/bin printf $(pwd) 'quoted text' grep then
+	cd /usr/bin grep $(pwd) sed grep "$1" $(pwd) readonly /usr/bin
+		&& grep export awk 2>/dev/null echo local
+		grep /usr/bin | test /usr/bin --verbose
+	then printf && && grep done "$1" $(pwd) ${HOME} cd echo printf test "$1" readonly
+echo && local && $(pwd)
+	"$@" x=1 'quoted text' x=1 grep /usr/bin && /usr/bin --verbose cd /usr/bin
+${HOME} test && x=1 echo printf readonly $(pwd) done
+'quoted text' cd "$@"
+		printf $(pwd) then readonly
+"$1" awk "$@" 'quoted text' | --verbose cd 'quoted text' -eu awk $(pwd)
+2>/dev/null readonly cd "$1" ${HOME} 2>/dev/null ${HOME} printf
+		done local --verbose awk readonly ${HOME} | x=1
+readonly done -eu $(pwd) &&
+done done printf "$@" ${HOME} /usr/bin "$@" echo printf 2>/dev/null
+	then x=1 export cd "$1" local then
+	-eu test -eu awk 'quoted text' x=1 local export | local sed | export export
+		echo 'quoted text' echo cd -eu printf --verbose test cd echo
+		echo readonly done export cd echo done
+	$(pwd) -eu -eu $(pwd)
+x=1 2>/dev/null | cd grep x=1 "$@" 'quoted text' done grep 2>/dev/null printf
+		"$1" local grep awk 'quoted text'
+		/usr/bin | "$@" | ${HOME} printf "$1" then | "$@" printf sed "$1" && /usr/bin
+&& && echo $(pwd) export 'quoted text' printf then grep local &&
+		printf readonly 'quoted text' 2>/dev/null echo $(pwd)
+		then readonly "$@" -eu local /usr/bin readonly
+		-eu /usr/bin 2>/dev/null /usr/bin done | done -eu 2>/dev/null
+	&& export x=1 awk printf --verbose $(pwd) 'quoted text' printf --verbose
+	x=1 sed local 'quoted text' export $(pwd) x=1 "$1" "$1" 2>/dev/null "$1"
+	done done test x=1 cd then 'quoted text' printf local | test
+		2>/dev/null --verbose ${HOME} /usr/bin ${HOME} "$1" awk local
+	'quoted text' echo "$1" awk test 2>/dev/null --verbose
+	${HOME} sed /usr/bin "$@" sed "$@" readonly grep readonly
+then && sed "$1" sed "$1" printf cd cd 2>/dev/null ${HOME} echo
+cd $(pwd) | then && 2>/dev/null
+$(pwd) 2>/dev/null /usr/bin /usr/bin cd | 'quoted text' 'quoted text' x=1 echo
+export grep | echo echo sed done 'quoted text'
+	| "$@" /usr/bin /usr/bin --verbose cd export test cd $(pwd) /usr/bin
+		$(pwd) ${HOME} ${HOME} cd --verbose
+&& && done x=1 -eu sed cd && x=1 --verbose echo "$1" /usr/bin done "$1" "$@"
+printf "$1" x=1 /usr/bin /usr/bin && export $(pwd) ${HOME} x=1 export "$@" "$@"
+	/usr/bin --verbose awk export then -eu "$1" 'quoted text' -eu 2>/dev/null
+	x=1 /usr/bin readonly /usr/bin test grep awk | x=1 2>/dev/null printf printf
+	"$1" test done | grep awk ${HOME}
+sed | /usr/bin ${HOME} "$1" x=1 printf
+	awk "$1" local 2>/dev/null echo printf
+'quoted text' echo -eu -eu 2>/dev/null
+	'quoted text' sed "$1" local
+		local && awk local echo cd grep
+		-eu test sed grep -eu sed printf then export printf done "$@"
+	done grep /usr/bin /usr/bin | "$@" | test "$1" /usr/bin "$1" awk export
+/usr/bin local awk "$1" && grep
+awk then "$1" done x=1 awk sed && readonly | printf "$1" -eu
+		2>/dev/null printf -eu 2>/dev/null printf /usr/bin 2>/dev/null awk export 2>/dev/null
+x=1 -eu readonly local grep 'quoted text'
+&& | ${HOME} export -eu echo "$1" test /usr/bin | -eu export
+	then x=1 x=1 grep grep export awk awk done cd grep
+cd && && then $(pwd) done "$@" test | done $(pwd) x=1 grep export grep local
+local grep then then local ${HOME}
+		"$@" "$1" readonly done done $(pwd) echo "$@" "$@" printf awk done ${HOME}
+		done printf echo "$1" x=1 "$1" done awk && "$@"
+"$1" sed readonly /usr/bin done | printf export then grep --verbose test "$1"
+		'quoted text' echo grep done "$1" 'quoted text' "$@" printf 2>/dev/null
+awk | x=1 'quoted text' ${HOME}
+		readonly export local && /usr/bin
+&& echo local readonly test readonly --verbose | done x=1 'quoted text'
+	local export | readonly
+readonly readonly 'quoted text' local 2>/dev/null local
+		| test | cd 'quoted text' done 2>/dev/null
+		done local --verbose done then awk echo |
+'quoted text' --verbose done
+		test printf local && export test test
+awk export -eu awk readonly export "$@" echo readonly -eu grep test | --verbose
+		test -eu | awk then "$1" echo readonly |
+		export "$@" printf /usr/bin 2>/dev/null cd readonly grep awk cd $(pwd)
+	'quoted text' export --verbose && sed --verbose | 2>/dev/null sed /usr/bin echo
+grep awk readonly local "$1" then awk printf -eu local /usr/bin
+		cd 'quoted text' export "$@" export sed cd local ${HOME} printf 'quoted text'
+		sed 2>/dev/null awk echo test ${HOME} export printf
+local cd "$@" 2>/dev/null | "$1" export
+		"$@" ${HOME} local ${HOME} -eu -eu 'quoted text' grep x=1 local grep
+	readonly then grep /usr/bin "$@" test
+	&& awk sed echo 'quoted text' then
+	/usr/bin cd "$1" 2>/dev/null echo && && sed echo echo readonly x=1 awk then
+awk x=1 -eu sed grep awk grep -eu sed
+		'quoted text' 2>/dev/null 2>/dev/null echo echo | cd printf printf echo
+	then export echo echo | test x=1 echo export
+&& test printf awk echo 2>/dev/null
+	"$1" local ${HOME} grep 'quoted text'
+	grep printf --verbose printf ${HOME} export
+grep | export 2>/dev/null /usr/bin "$@" ${HOME} && cd cd local echo -eu export
+/usr/bin done ${HOME} awk && echo then x=1 cd
+2>/dev/null | x=1 printf "$1" x=1 x=1 x=1 test test printf "$1"
+"$1" && awk "$1" | grep 2>/dev/null local x=1
+2>/dev/null x=1 printf sed /usr/bin local -eu sed awk /usr/bin
+/usr/bin awk printf then
+	readonly ${HOME} readonly echo x=1 local x=1 | ${HOME} sed /usr/bin /usr/bin $(pwd)
+sed && echo echo ${HOME} done $(pwd) "$@"
+	x=1 awk export cd export done
+		--verbose done local echo "$1" "$@" "$@" test
+		export -eu awk | && --verbose test local x=1 printf ${HOME} export && grep printf
+	export /usr/bin /usr/bin sed "$1" export printf echo
+-eu x=1 x=1 -eu export x=1 "$1"
+| grep "$1" sed awk 'quoted text' echo
+		readonly readonly done x=1 x=1 export 'quoted text'
+	echo readonly export 'quoted text' $(pwd)
+		grep "$@" local awk export
+		then grep "$@" sed grep local grep readonly
+		x=1 "$@" 'quoted text' readonly grep cd ${HOME} readonly
+		test then sed x=1 test grep 'quoted text' 'quoted text' ${HOME}
+	"$@" echo 2>/dev/null echo test "$1" 'quoted text'
+grep readonly "$1" ${HOME} ${HOME} cd -eu
+		local 2>/dev/null export ${HOME} -eu
+&& && export "$@" x=1 grep then sed $(pwd) && $(pwd) x=1 && ${HOME} cd cd
+	export --verbose ${HOME} "$@"
+		cd awk --verbose ${HOME} sed ${HOME} --verbose "$1" --verbose done
+export local echo grep --verbose /usr/bin
+${HOME} done 2>/dev/null && -eu printf ${HOME} sed -eu
+		local then cd local test printf "$@" local echo then then done then
+		test grep cd export 2>/dev/null printf then then sed /usr/bin
+	echo awk && test printf readonly grep cd export done
+		'quoted text' ${HOME}
+		2>/dev/null $(pwd) then | done readonly grep -eu test -eu test grep sed --verbose
+		export grep printf 2>/dev/null x=1 "$1" echo cd echo grep $(pwd)
+"$@" --verbose grep grep test -eu x=1 export && $(pwd) 2>/dev/null
+echo printf | printf sed 2>/dev/null 2>/dev/null
+		&& export 'quoted text' test
+printf && x=1 "$@" -eu 'quoted text' local
+	$(pwd) "$@" cd "$@" "$@" awk --verbose "$@"
+	echo "$@" sed grep cd | export sed local ${HOME} "$1"
+done done $(pwd) "$@" "$@" awk echo "$@" test printf "$1" printf
+echo $(pwd) done printf 'quoted text' 'quoted text' && 2>/dev/null
+2>/dev/null test 'quoted text' cd x=1 $(pwd) readonly
+		| 2>/dev/null local local 'quoted text' local | "$1" --verbose
+		readonly x=1 'quoted text' cd && --verbose --verbose done x=1
+	'quoted text' | done $(pwd) export -eu readonly
+	printf echo /usr/bin grep -eu awk export
+		| /usr/bin /usr/bin sed cd done ${HOME} readonly sed done then grep
+		awk | && x=1 then 2>/dev/null printf 'quoted text' export cd 2>/dev/null
+		-eu awk awk /usr/bin awk readonly awk -eu export local "$@"
+		test echo 2>/dev/null /usr/bin echo export awk
+"$1" --verbose 2>/dev/null "$1" 2>/dev/null --verbose "$1"
+		"$@" 2>/dev/null printf x=1 printf test
+awk test printf local --verbose "$1" 'quoted text' 'quoted text'
+		printf && --verbose echo && 'quoted text' grep --verbose test done
+grep && export 'quoted text' | --verbose
+printf | local 2>/dev/null ${HOME} grep echo
+		"$@" && -eu then | --verbose x=1 cd cd 2>/dev/null
+"$1" then export awk then --verbose /usr/bin $(pwd) then $(pwd) awk "$1" /usr/bin
+		$(pwd) && test -eu | ${HOME} done printf echo $(pwd) printf export sed "$@" $(pwd)
+		cd -eu sed $(pwd) done printf $(pwd)
+	x=1 && test x=1 readonly export | local readonly 2>/dev/null
+awk readonly then cd sed x=1 /usr/bin local echo "$1" && readonly
+cd 2>/dev/null -eu local
+		"$@" "$@" /usr/bin echo then 2>/dev/null
+	$(pwd) 2>/dev/null grep 'quoted text'
+		"$1" echo ${HOME} x=1 ${HOME} export | cd "$1" export
+	readonly done test x=1 local 'quoted text' readonly
+	echo test 2>/dev/null $(pwd) export
+	cd --verbose awk awk "$@" grep readonly $(pwd) local grep
+	local 2>/dev/null -eu "$@" "$1" cd sed local echo "$@" grep test then
+then x=1 sed 2>/dev/null 2>/dev/null
+	cd | sed echo cd export /usr/bin 'quoted text'
+"$@" ${HOME} export $(pwd) local "$1" awk
+	/usr/bin | "$1" --verbose -eu 2>/dev/null -eu
+	| test /usr/bin local && -eu 'quoted text' local /usr/bin
+"$@" /usr/bin "$@" "$@" sed ${HOME}
+	done "$@" sed /usr/bin --verbose sed && readonly local test $(pwd) 2>/dev/null
+		readonly 2>/dev/null /usr/bin export --verbose echo | test 'quoted text'
+awk test done && test "$@" sed "$@" x=1 export awk then done ${HOME}
+	echo $(pwd) 'quoted text' 'quoted text' "$@" 'quoted text' sed ${HOME}
+readonly --verbose awk 2>/dev/null cd 'quoted text' sed done | --verbose
+'quoted text' sed awk test local --verbose test 2>/dev/null
+		${HOME} | && sed local printf
+	"$@" ${HOME} /usr/bin export test printf | "$1" 'quoted text'
+then $(pwd) 2>/dev/null "$1" $(pwd) awk 'quoted text'
+then then done then "$@" cd export 2>/dev/null -eu
+		"$@" $(pwd) "$1" done -eu "$1" then readonly echo && echo "$@"
+		--verbose $(pwd) $(pwd) && then then -eu
+		local 'quoted text' "$@" cd printf echo export "$@" | sed done --verbose
+	2>/dev/null --verbose 2>/dev/null
+	'quoted text' /usr/bin --verbose export x=1 cd cd grep --verbose /usr/bin
+		export then export readonly ${HOME} cd /usr/bin -eu "$1" $(pwd)
+	"$1" awk then "$1" local --verbose
+awk ${HOME} 2>/dev/null done printf --verbose $(pwd)
+&& x=1 sed printf echo 'quoted text' sed done grep $(pwd)
+	x=1 printf --verbose grep
+		| local grep echo then 'quoted text'
+		local grep done 'quoted text'
+	awk test x=1 awk && readonly $(pwd) ${HOME} -eu grep --verbose 2>/dev/null
+printf && --verbose "$1" /usr/bin
+echo awk done done awk awk ${HOME} "$1" done "$1" x=1 then /usr/bin
+		$(pwd) ${HOME} && test x=1 --verbose
+	'quoted text' --verbose echo grep 2>/dev/null
+	then done echo then export --verbose /usr/bin done
+		"$@" ${HOME} "$@" awk export done
+		sed "$@" -eu cd test grep sed -eu $(pwd)
+&& test awk readonly grep 'quoted text' test echo --verbose
+		done export /usr/bin 'quoted text' "$1" ${HOME} | sed x=1 test
+		sed printf ${HOME} "$1" local
+/usr/bin "$@" ${HOME} x=1 sed | sed
+	"$@" ${HOME} done 'quoted text'
+export local && cd awk /usr/bin echo echo echo printf printf -eu awk
+	printf && 2>/dev/null x=1 "$1" x=1 done
+done readonly x=1 2>/dev/null -eu done grep && export cd "$1"
+/usr/bin export printf 'quoted text'
+	&& printf -eu "$1" echo awk --verbose
+--verbose ${HOME} -eu awk $(pwd) local readonly printf then echo
+	-eu $(pwd) done export echo /usr/bin printf && "$1" sed echo echo
+		export then /usr/bin 2>/dev/null awk "$@" done
+local readonly 2>/dev/null readonly
+readonly local "$1" $(pwd) echo local awk 2>/dev/null printf
+awk x=1 grep 'quoted text' | printf "$@" -eu x=1 2>/dev/null
+		then -eu ${HOME} ${HOME} echo
+	| | readonly 'quoted text' export done export grep && 2>/dev/null x=1 ${HOME}
+		"$1" local "$@" awk printf --verbose done -eu sed ${HOME} cd 2>/dev/null
+	awk printf then cd test readonly 2>/dev/null | && --verbose grep
+		"$@" grep awk -eu "$@" ${HOME} --verbose $(pwd) -eu
+		$(pwd) 2>/dev/null x=1 -eu --verbose done /usr/bin 2>/dev/null
+	readonly "$1" grep echo | 'quoted text'
+	then grep --verbose "$1" ${HOME} "$1" && && test cd export readonly grep ${HOME}
+$(pwd) "$1" local local "$1" printf local then --verbose export "$1"
+		$(pwd) export $(pwd) $(pwd) export "$1" |
+		awk test then readonly cd local then "$1" readonly echo
+${HOME} $(pwd) echo then
+	/usr/bin && "$@" -eu test 2>/dev/null
+	2>/dev/null 2>/dev/null grep | sed x=1 ${HOME} awk export export grep echo readonly
+		$(pwd) && readonly x=1 "$1" test
+2>/dev/null done -eu --verbose printf test 2>/dev/null "$@" "$@" -eu | -eu printf
+	sed "$1" done --verbose grep then 2>/dev/null export export -eu printf
+		echo "$1" "$@" 'quoted text' /usr/bin -eu 'quoted text' readonly
+	| test -eu $(pwd) readonly printf
+	&& $(pwd) x=1 /usr/bin readonly | sed local "$@"
+done then -eu done 'quoted text' "$@" export cd sed grep $(pwd) /usr/bin
+echo printf printf grep test done "$@"
+export cd 'quoted text' x=1 awk /usr/bin | cd cd grep printf then done sed test
+	awk 2>/dev/null printf x=1 grep done export grep 2>/dev/null printf grep ${HOME}
+		${HOME} readonly $(pwd) done local
+	done echo local 2>/dev/null cd ${HOME} awk export ${HOME} $(pwd) 'quoted text'
+awk /usr/bin x=1 $(pwd) 2>/dev/null
+	awk -eu --verbose x=1 --verbose
+		local sed "$1" echo printf done awk $(pwd) "$@" -eu
+		$(pwd) 2>/dev/null x=1 && export x=1 local
+		2>/dev/null && local /usr/bin "$1" awk x=1 /usr/bin sed x=1 'quoted text'
+		-eu local awk | --verbose then $(pwd) "$1" test printf
+	${HOME} test /usr/bin -eu --verbose "$1" "$1"
+	| readonly echo readonly grep export /usr/bin test done "$1" export "$1" -eu
+		printf export x=1 && && $(pwd) done 'quoted text' --verbose "$1" "$1" grep
+	awk /usr/bin then ${HOME} -eu -eu "$@" readonly && /usr/bin
+export done sed && --verbose readonly sed local -eu local -eu -eu |
+"$1" then && /usr/bin | --verbose test local "$@" && local local 'quoted text'
+		${HOME} "$@" awk readonly echo export
+		grep 2>/dev/null "$1" | 2>/dev/null export
+		x=1 cd "$@" grep readonly echo "$@" --verbose then test echo done ${HOME}
+$(pwd) sed 'quoted text' && sed | local -eu "$1"
+	&& export then --verbose && printf done
+--verbose 'quoted text' awk test /usr/bin
+grep local "$@" "$1" "$@" echo 'quoted text' | --verbose
+		/usr/bin 2>/dev/null sed ${HOME} then ${HOME} readonly && cd grep test -eu
+then export x=1 x=1 cd local && test | /usr/bin &&
+		local $(pwd) "$1" 'quoted text' 2>/dev/null ${HOME}
+	'quoted text' --verbose 'quoted text'
+		readonly export local then --verbose cd export && echo echo ${HOME} x=1 readonly
+	then 2>/dev/null sed then awk -eu -eu readonly x=1
+		${HOME} --verbose "$1" $(pwd) /usr/bin readonly
+	${HOME} ${HOME} $(pwd) echo cd awk "$1" x=1 cd
+--verbose cd x=1 | -eu /usr/bin printf grep "$@" -eu
+grep awk awk 'quoted text' test && done "$@" 'quoted text' echo
+awk awk local "$@" && 'quoted text' export x=1 awk x=1 "$1"
+"$1" | printf $(pwd) test sed done done
+awk sed readonly export | readonly
+'quoted text' && "$@" x=1 sed -eu printf "$1" awk
+		printf "$1" ${HOME} x=1 | x=1 local -eu "$1"
+		2>/dev/null echo readonly && readonly $(pwd)
+then ${HOME} "$1" /usr/bin | echo /usr/bin sed sed
+	echo then grep --verbose sed local done ${HOME} -eu awk echo /usr/bin "$1" sed "$1"
+		grep /usr/bin x=1 cd --verbose done done
+$(pwd) echo | printf sed echo printf grep --verbose x=1 then
+		'quoted text' ${HOME} awk 'quoted text'
+		-eu test echo then $(pwd) 'quoted text'
+printf --verbose readonly --verbose awk "$@" ${HOME}
+	echo printf ${HOME} done "$@" cd done echo /usr/bin
+/usr/bin grep 2>/dev/null /usr/bin | "$@" export -eu echo
+		export | done $(pwd) && awk printf
+	grep /usr/bin export
+	${HOME} -eu --verbose readonly 2>/dev/null test x=1 ${HOME} readonly "$@"
+x=1 done cd local /usr/bin
+	grep cd test grep 2>/dev/null test printf $(pwd) "$@" "$@" test export echo echo
+sed x=1 && | grep -eu then && -eu -eu export 2>/dev/null /usr/bin
+cd "$@" cd ${HOME} awk | printf
+--verbose $(pwd) local then -eu "$@" "$1" "$1" echo printf "$1"
+-eu /usr/bin x=1 echo /usr/bin export readonly export "$1" "$@" echo &&
+echo 'quoted text' "$@" cd "$@" printf /usr/bin "$@" --verbose
+"$@" readonly 2>/dev/null test | printf 'quoted text'
+		'quoted text' sed readonly cd printf test && export
+cd awk x=1 2>/dev/null local && test done grep awk 'quoted text' $(pwd)
+'quoted text' "$@" /usr/bin
+		-eu awk | /usr/bin 2>/dev/null grep "$1" grep 2>/dev/null sed cd --verbose
+	"$1" && readonly printf done readonly sed
+sed "$1" x=1 2>/dev/null $(pwd) -eu | then
+grep sed -eu | sed test "$@" export "$1" 2>/dev/null
+		then "$@" done then "$@" x=1 grep ${HOME} awk readonly 2>/dev/null
+		cd then --verbose --verbose "$1"
+		-eu | "$1" local readonly
+then 'quoted text' export done done | /usr/bin
+2>/dev/null then cd test
+'quoted text' 2>/dev/null echo local readonly printf -eu --verbose
+		/usr/bin -eu "$@" local readonly x=1 test
+	--verbose awk local $(pwd) | test then ${HOME}
+"$1" $(pwd) then 2>/dev/null
+"$@" --verbose printf grep --verbose "$@" local done
+		awk ${HOME} readonly -eu /usr/bin "$@" export /usr/bin done && | x=1 && &&
+local | "$@" export "$1" test cd then printf
+	grep grep done -eu && /usr/bin printf x=1
+	then awk && grep x=1 awk export
+x=1 | 'quoted text' "$1" sed test /usr/bin
+	${HOME} "$@" sed printf then 2>/dev/null
+x=1 2>/dev/null ${HOME} --verbose $(pwd) grep export cd /usr/bin $(pwd)
+export export 'quoted text' cd grep --verbose | done
+		export 2>/dev/null 'quoted text' local printf
+$(pwd) cd --verbose "$@"
+'quoted text' && $(pwd) /usr/bin -eu local --verbose ${HOME} "$@" --verbose
+		awk sed 2>/dev/null 'quoted text' &&
+/usr/bin $(pwd) "$1" cd local local echo echo test x=1 cd $(pwd)
+		"$1" $(pwd) local readonly local
+		"$@" 2>/dev/null printf readonly export
+		| readonly 2>/dev/null --verbose readonly && $(pwd) "$1" sed 2>/dev/null
+		grep sed $(pwd) test 'quoted text'
+	export | awk -eu sed awk test "$1" grep && grep echo "$1" test readonly 'quoted text'
+${HOME} $(pwd) awk 2>/dev/null --verbose | && readonly "$@" "$@" grep echo "$@"
+&& grep x=1 2>/dev/null $(pwd)
+"$1" 2>/dev/null --verbose "$1" awk /usr/bin test grep printf local
+sed sed ${HOME} 'quoted text' echo printf test /usr/bin
+then -eu $(pwd) --verbose test
+	echo cd "$@" sed done awk /usr/bin
+	--verbose then cd "$@" then
+	| grep printf printf done local local "$1" readonly awk x=1 test && awk x=1
+		-eu cd sed 2>/dev/null then $(pwd) echo test readonly -eu "$1" "$@"
+	local cd 2>/dev/null local "$1" 2>/dev/null | x=1 test ${HOME} "$1" -eu export
+		then $(pwd) 'quoted text' echo 'quoted text' readonly /usr/bin sed local /usr/bin
+	/usr/bin $(pwd) awk | ${HOME} echo grep done sed && $(pwd) "$@" export
+	cd -eu cd awk grep cd cd x=1 /usr/bin --verbose && then printf done --verbose
+	awk 'quoted text' grep x=1 -eu then sed x=1 ${HOME} awk sed export
+local readonly printf done sed --verbose then local 'quoted text' --verbose ${HOME}
+		echo ${HOME} then "$@" grep $(pwd) "$1" echo --verbose
+		--verbose then local 2>/dev/null
+/usr/bin "$1" "$1" awk -eu 'quoted text'
+		-eu x=1 "$1" test awk --verbose grep
+test && x=1 && test sed 'quoted text' ${HOME}
+echo "$@" && then export cd -eu "$1" x=1 printf $(pwd) && echo 'quoted text' export
+	awk $(pwd) "$1" done && local test --verbose /usr/bin --verbose ${HOME}
+-eu printf "$1" $(pwd) ${HOME} then ${HOME} "$@" printf x=1
+local done | 'quoted text' --verbose | readonly
+	grep x=1 grep readonly -eu local 2>/dev/null --verbose done readonly
+		echo x=1 echo printf cd x=1 -eu $(pwd) readonly && cd echo "$1" x=1 |
+done | printf ${HOME} echo printf test -eu printf --verbose "$@" --verbose /usr/bin
+echo local | printf && ${HOME} readonly | grep then | --verbose && local awk --verbose
+		/usr/bin test test x=1 readonly "$1" then && cd /usr/bin 'quoted text'
+	2>/dev/null && /usr/bin
+	&& --verbose echo grep readonly "$1" && echo | test /usr/bin
+	x=1 awk echo readonly | --verbose export export echo
+		${HOME} readonly sed --verbose
+		&& && local then -eu grep "$1" --verbose --verbose done "$1" cd "$@" then
+		grep sed local x=1 "$@" echo $(pwd) 'quoted text' 'quoted text' $(pwd)
+echo test | && grep && $(pwd) printf grep 'quoted text'
+x=1 x=1 cd test 2>/dev/null
+		awk local echo local printf $(pwd) sed printf readonly local | readonly test
+	local 2>/dev/null awk --verbose && | sed
+x=1 sed x=1 cd 'quoted text' "$1" --verbose readonly $(pwd)
+		$(pwd) sed $(pwd) x=1 echo
+		cd /usr/bin local --verbose cd then "$@" local /usr/bin
+		grep done /usr/bin | /usr/bin 'quoted text' done
+		--verbose local local grep readonly then echo
+${HOME} 'quoted text' -eu echo echo done && then done | && | local local
+		"$1" -eu 2>/dev/null -eu export echo "$1" cd 2>/dev/null
+readonly /usr/bin readonly readonly
+"$1" then awk x=1 --verbose
+${HOME} cd "$1" echo export 2>/dev/null --verbose
+	2>/dev/null sed $(pwd)
+		test ${HOME} $(pwd) ${HOME} cd local /usr/bin 'quoted text'
+readonly "$1" | && printf -eu grep 'quoted text' /usr/bin export echo local
+	awk "$@" local /usr/bin --verbose echo echo "$@" $(pwd) grep x=1
+		printf awk /usr/bin done test awk -eu local -eu awk
+sed awk | sed "$@" grep "$1" $(pwd) $(pwd) test sed
+	&& grep printf /usr/bin "$1" x=1 cd $(pwd) "$@" sed printf cd test "$1" printf
+	local grep done 'quoted text' "$@" x=1
+		local test printf -eu x=1 test then grep then x=1 --verbose 2>/dev/null
+	$(pwd) 'quoted text' cd printf "$@" 2>/dev/null "$@" "$@" $(pwd) && -eu export
+	readonly x=1 done readonly && $(pwd) sed /usr/bin --verbose sed export echo
+		'quoted text' readonly "$@" -eu then done /usr/bin "$@" $(pwd) "$@" 2>/dev/null
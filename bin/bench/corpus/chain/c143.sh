@@ -0,0 +1,2001 @@
+	$(pwd) "$1" test test test --verbose readonly
+2>/dev/null then 'quoted text' 'quoted text'
+		cd echo /usr/bin /usr/bin x=1 test
+$(pwd) awk 'quoted text' grep 2>/dev/null local ${HOME} test sed $(pwd)
+	2>/dev/null "$@" $(pwd) then 'quoted text' then local printf
+	export readonly readonly x=1 --verbose ${HOME} sed grep printf --verbose 'quoted text'
+	export sed && readonly test --verbose | readonly then
+		"$@" cd test local | done echo "$@"
+		done sed /usr/bin /usr/bin local
+	x=1 then "$@" grep done && done /usr/bin then readonly "$@"
+	"$1" done cd $(pwd) "$@" -eu
+		readonly printf grep echo printf 2>/dev/null
+awk 2>/dev/null export printf | --verbose echo x=1 /usr/bin test ${HOME} 2>/dev/null
+	"$1" ${HOME} "$@" test && "$@" sed 'quoted text' sed grep
+	'quoted text' --verbose grep x=1 && echo | local | awk -eu -eu echo
+		&& sed awk "$1" awk export cd && $(pwd) export /usr/bin
+	&& "$1" then echo "$@" then --verbose -eu |
+		sed readonly -eu cd $(pwd) readonly | "$@" "$1" readonly
+export ${HOME} 'quoted text' "$@" ${HOME}
+	echo x=1 "$1" export local "$1" "$@" awk awk cd 2>/dev/null sed echo test
+		awk --verbose export grep printf local "$@" && then sed awk awk
+	"$1" grep readonly x=1 echo cd echo "$1" "$1" 'quoted text'
+	awk echo echo local cd $(pwd) readonly "$1"
+	export $(pwd) 2>/dev/null printf sed "$1" test | --verbose export 2>/dev/null
+	/usr/bin echo export sed test printf
+		/usr/bin export echo |
+then printf printf && x=1 "$1" grep x=1 x=1 export && sed "$@" export -eu |
+/usr/bin test --verbose -eu
+x=1 readonly && sed && local 'quoted text'
+		grep && cd | then "$@"
+		&& /usr/bin "$1" 'quoted text' && export grep grep
+		sed -eu test | ${HOME} local
+grep then printf && done grep export printf && $(pwd) test then "$@"
+		&& readonly $(pwd) "$1" then &&
+	--verbose cd /usr/bin readonly ${HOME} | readonly | "$@" printf
+		"$@" "$1" export /usr/bin awk cd grep awk && echo && printf -eu /usr/bin local
+$(pwd) echo x=1 /usr/bin test /usr/bin
+	x=1 local "$1" cd sed done awk grep export x=1 ${HOME} echo 'quoted text'
+	echo done local x=1 grep echo /usr/bin "$@" sed then then local printf done /usr/bin
+	test then echo -eu cd /usr/bin x=1 echo 2>/dev/null test done $(pwd)
+		local x=1 $(pwd) done test then then "$@" "$@" "$@" echo | ${HOME} printf
+		--verbose 'quoted text' export
+		grep --verbose "$1" "$@" local readonly awk then export
+test && sed printf readonly cd awk
+--verbose 'quoted text' --verbose local then --verbose
+--verbose awk grep 'quoted text' readonly -eu done test "$@"
+	test "$@" echo ${HOME} 'quoted text'
+echo 2>/dev/null 'quoted text' done local $(pwd) "$1"
+		then then readonly echo --verbose grep echo "$1" -eu
+	/usr/bin /usr/bin test 'quoted text'
+	then export then && test --verbose test
+	local 2>/dev/null 'quoted text' printf cd -eu
+	done done grep grep -eu
+done then x=1 | 'quoted text' printf "$1" echo | readonly echo
+then "$@" "$1" grep cd sed 2>/dev/null
+		-eu 2>/dev/null ${HOME} export "$@" ${HOME} printf printf
+		| readonly awk readonly ${HOME} x=1 x=1 then
+	--verbose grep grep ${HOME} local export local
+export local awk export --verbose done -eu local -eu "$1"
+		awk -eu --verbose -eu readonly | ${HOME} awk $(pwd) readonly
+		sed -eu done sed x=1 "$1" printf
+"$@" echo done --verbose echo /usr/bin /usr/bin export ${HOME}
+2>/dev/null sed ${HOME} x=1 --verbose awk | /usr/bin grep then
+		then 2>/dev/null test cd 2>/dev/null local -eu awk echo | sed 'quoted text'
+--verbose grep export | sed 2>/dev/null && --verbose 'quoted text' printf
+		grep 2>/dev/null "$@" "$@" 'quoted text'
+	done local ${HOME} && export test x=1 awk test test
+cd "$@" -eu sed cd export
+printf $(pwd) x=1 ${HOME} 'quoted text' export printf sed $(pwd) $(pwd)
+	awk then readonly x=1 cd sed awk 2>/dev/null cd echo && awk awk done grep
+	grep x=1 local | "$1" awk x=1 sed cd &&
+		local 2>/dev/null awk local 'quoted text' "$@" grep "$@" ${HOME} readonly
+		then then | echo 2>/dev/null echo export sed 'quoted text' test x=1
+"$1" ${HOME} echo "$1"
+	export local awk "$1" | readonly test
+	"$@" ${HOME} /usr/bin printf &&
+	printf grep | local done | 'quoted text' then && 'quoted text'
+		x=1 $(pwd) -eu --verbose --verbose cd 2>/dev/null echo | $(pwd)
+		"$@" $(pwd) echo export grep 'quoted text' --verbose --verbose printf
+	grep test readonly --verbose done
+	&& done --verbose ${HOME} x=1 echo -eu cd done readonly
+cd done export awk local readonly && && cd 2>/dev/null test
+readonly echo -eu done cd /usr/bin ${HOME}
+		'quoted text' sed then && 'quoted text'
+-eu 'quoted text' export done ${HOME} then
+| "$1" printf 2>/dev/null 'quoted text' sed && x=1 -eu $(pwd) ${HOME} readonly
+	--verbose $(pwd) done printf /usr/bin local
+$(pwd) $(pwd) /usr/bin && done -eu ${HOME} ${HOME}
+	| printf export sed readonly $(pwd) 2>/dev/null awk done x=1 x=1 echo cd grep
+	$(pwd) -eu x=1 --verbose local 2>/dev/null local 'quoted text'
+echo --verbose "$@" grep ${HOME} readonly sed 'quoted text'
+test cd --verbose -eu local -eu cd $(pwd) grep "$@" && ${HOME} -eu
+		'quoted text' -eu | $(pwd) -eu -eu && grep "$@" grep | | printf 2>/dev/null
+		${HOME} sed echo 'quoted text' 'quoted text' export "$1"
+		&& cd awk test sed awk 2>/dev/null cd --verbose /usr/bin
+		--verbose echo -eu cd x=1 /usr/bin -eu grep printf echo grep export
+		-eu --verbose 'quoted text' sed sed x=1
+		cd && 2>/dev/null awk grep done 2>/dev/null
+	awk | | readonly echo echo awk echo /usr/bin
+then --verbose cd 2>/dev/null --verbose --verbose cd done /usr/bin | -eu /usr/bin
+		/usr/bin x=1 awk --verbose printf
+		--verbose cd ${HOME} echo 'quoted text' "$1"
+		awk && sed cd printf done $(pwd) ${HOME} cd printf $(pwd) echo
+		/usr/bin cd awk 'quoted text' 2>/dev/null /usr/bin awk sed local test
+	"$1" grep sed grep "$@"
+		awk readonly 'quoted text' awk ${HOME} --verbose printf "$@" | $(pwd)
+	done grep | x=1 $(pwd) ${HOME} test grep
+		awk ${HOME} && ${HOME} grep 2>/dev/null
+		grep 'quoted text' echo
+		local | grep test /usr/bin cd "$1" then local "$@" 2>/dev/null readonly export
+		export 'quoted text' local local awk | 2>/dev/null sed sed 'quoted text'
+	x=1 'quoted text' grep
+	readonly 'quoted text' ${HOME} --verbose -eu cd printf x=1 | awk export $(pwd)
+	grep echo && 'quoted text' ${HOME} ${HOME} "$1" cd printf $(pwd) local echo export
+${HOME} cd && grep echo
+		'quoted text' 2>/dev/null "$1"
+printf && sed "$@" then grep 'quoted text' grep 'quoted text'
+	-eu ${HOME} "$1" && sed "$@" 2>/dev/null 2>/dev/null export test | "$@" export
+&& | echo then done test test ${HOME} && export test
+x=1 then local $(pwd) local
+	grep then local $(pwd) test cd export ${HOME} 2>/dev/null && echo echo
+/usr/bin ${HOME} "$1" $(pwd) sed printf done
+	local "$1" readonly awk
+	done then export /usr/bin echo | | readonly export
+	then done x=1 grep $(pwd) sed | export sed printf $(pwd)
+echo printf $(pwd) x=1 done /usr/bin
+		printf | printf 2>/dev/null x=1 && "$1" "$@" printf awk
+		cd 2>/dev/null grep then "$@" then x=1 -eu 2>/dev/null "$@" test local awk x=1
+		2>/dev/null cd && --verbose cd "$1" $(pwd) -eu export awk then && test
+/usr/bin test sed | grep | $(pwd) | printf "$@" local && grep "$1"
+-eu -eu readonly echo done done
+readonly sed "$1" -eu readonly done "$@" | then
+2>/dev/null export ${HOME} done ${HOME} sed "$@" x=1 -eu test printf
+		"$@" awk x=1 x=1 2>/dev/null sed 'quoted text'
+	printf cd local "$@" then "$1" "$@" x=1
+grep export --verbose -eu ${HOME} | test printf
+		export $(pwd) -eu echo
+	done done /usr/bin then "$@" "$1" echo -eu local | done
+awk /usr/bin ${HOME} done sed readonly test $(pwd)
+		echo "$@" printf ${HOME} test
+		'quoted text' sed "$@" awk test test sed $(pwd) grep export test | test -eu --verbose
+	2>/dev/null "$@" printf grep x=1 echo printf export
+-eu test sed $(pwd) -eu /usr/bin $(pwd)
+2>/dev/null echo readonly -eu --verbose readonly cd test awk 2>/dev/null sed "$@"
+		-eu done sed -eu "$1" /usr/bin
+awk ${HOME} x=1 printf | $(pwd) sed done x=1 grep
+echo test grep "$@" local /usr/bin $(pwd)
+		local $(pwd) && --verbose done readonly "$@" printf printf awk ${HOME} local done
+		grep export sed 'quoted text'
+	export "$1" then sed local local readonly awk test sed
+		--verbose $(pwd) | 'quoted text' awk "$@" done 'quoted text'
+		sed cd -eu $(pwd) export readonly
+'quoted text' -eu then cd sed sed export 'quoted text' 'quoted text' cd "$@"
+	$(pwd) "$1" "$@" 2>/dev/null grep 2>/dev/null
+		| sed echo then -eu -eu grep "$1" printf local 2>/dev/null "$1"
+/usr/bin local test 'quoted text' echo x=1
+	${HOME} /usr/bin awk $(pwd) done
+		cd local 2>/dev/null -eu local "$@" grep /usr/bin test
+		done $(pwd) grep ${HOME} done | local export echo cd 'quoted text'
+/usr/bin awk then done --verbose
+"$@" then readonly && awk | 2>/dev/null awk --verbose "$1" && then then
+		&& sed done then && test $(pwd) printf
+&& --verbose && awk local
+awk cd -eu readonly local
+	'quoted text' 'quoted text' test && 2>/dev/null echo && printf cd ${HOME}
+'quoted text' 2>/dev/null export readonly
+readonly x=1 --verbose sed 'quoted text'
+		printf echo done cd cd echo --verbose
+done done $(pwd) "$@" then x=1 echo /usr/bin --verbose
+	export x=1 export grep --verbose --verbose done echo "$1"
+-eu 2>/dev/null 'quoted text' -eu $(pwd) 'quoted text' 'quoted text' export
+'quoted text' local grep grep "$@" -eu test readonly done "$1" /usr/bin
+	printf readonly echo "$1" printf ${HOME} $(pwd) | 2>/dev/null done &&
+&& done awk x=1 export then 2>/dev/null test /usr/bin
+		| | test /usr/bin grep -eu --verbose x=1 export
+	x=1 2>/dev/null test echo x=1 ${HOME} ${HOME} -eu then export test --verbose
+	local grep done $(pwd) "$@" printf
+printf done grep printf done /usr/bin awk
+		then && readonly -eu "$@" then awk
+		2>/dev/null then && && sed awk | then then printf awk --verbose
+	"$1" 'quoted text' export ${HOME} ${HOME} && 'quoted text' export
+		| 'quoted text' sed | | | awk test 'quoted text' && printf done | $(pwd)
+	export test /usr/bin done test cd grep ${HOME}
+		export then -eu 'quoted text' then
+		--verbose 2>/dev/null echo printf cd then readonly 2>/dev/null
+	2>/dev/null --verbose then "$1" test "$@" grep
+		| "$1" -eu && printf readonly "$1" printf "$1" local "$1" ${HOME}
+local sed /usr/bin cd done grep awk then sed local echo 'quoted text'
+		-eu x=1 sed then sed local export echo awk grep echo done awk echo
+test awk readonly local "$1"
+	'quoted text' test export then ${HOME}
+		test readonly readonly
+		2>/dev/null local /usr/bin $(pwd) ${HOME} ${HOME} 'quoted text' cd test done
+		&& x=1 cd | $(pwd) local echo 'quoted text' "$@" "$@" printf
+		'quoted text' x=1 "$@" awk printf /usr/bin "$@" 2>/dev/null
+	printf ${HOME} local /usr/bin /usr/bin test
+	-eu readonly x=1 export local then grep export x=1 ${HOME} cd 2>/dev/null
+--verbose --verbose grep "$@" printf printf --verbose
+	export then -eu --verbose "$1" local
+x=1 awk echo | /usr/bin -eu "$1" sed -eu /usr/bin --verbose "$1" && echo /usr/bin
+	test ${HOME} 2>/dev/null 'quoted text' $(pwd) "$@" 2>/dev/null 'quoted text'
+	local $(pwd) export printf $(pwd) --verbose "$1"
+	${HOME} local && ${HOME} sed ${HOME} x=1 grep -eu done cd printf $(pwd) ${HOME}
+export "$1" ${HOME} done && x=1 test then ${HOME} x=1 | $(pwd) export
+		x=1 export awk readonly "$1" then then /usr/bin /usr/bin $(pwd)
+		x=1 2>/dev/null /usr/bin ${HOME} 'quoted text'
+		"$1" cd 2>/dev/null done $(pwd) awk then local
+		${HOME} ${HOME} test cd $(pwd)
+--verbose --verbose x=1 2>/dev/null grep "$1" awk --verbose
+export 'quoted text' readonly /usr/bin x=1 2>/dev/null |
+'quoted text' && $(pwd) x=1 local sed $(pwd) cd then "$1" 2>/dev/null
+	&& x=1 cd -eu done sed --verbose test 'quoted text' 2>/dev/null
+| cd export $(pwd) "$@" local export cd printf &&
+	"$@" $(pwd) -eu ${HOME} cd | sed sed printf -eu x=1 sed awk test awk then local
+"$@" "$1" --verbose sed $(pwd) then 2>/dev/null done
+	2>/dev/null | sed grep $(pwd) grep "$1" awk x=1 -eu
+	2>/dev/null && cd awk -eu 2>/dev/null 'quoted text'
+test sed cd ${HOME} -eu | local export export $(pwd) readonly
+-eu ${HOME} | 2>/dev/null sed awk export "$1" readonly cd awk $(pwd) x=1
+	-eu "$1" $(pwd) local --verbose && export /usr/bin test readonly done x=1 test
+readonly printf readonly cd cd --verbose cd
+echo printf printf "$1" test test
+		done -eu echo | | cd sed 'quoted text' x=1 cd $(pwd) awk x=1 && ${HOME} then
+sed local 'quoted text' grep local then test $(pwd) "$1" $(pwd)
+	-eu awk "$1" local -eu "$@" echo echo local echo 'quoted text' | awk
+"$@" "$@" sed printf awk --verbose
+		printf then then -eu grep local done echo
+		awk 'quoted text' export then then readonly $(pwd) export
+	grep "$1" local echo -eu cd "$1" export awk ${HOME} && awk 'quoted text'
+		--verbose "$@" --verbose awk -eu done awk grep local awk --verbose
+	test ${HOME} sed grep --verbose "$@" printf -eu printf done
+export echo test x=1 && echo printf 'quoted text'
+	'quoted text' export "$@" printf $(pwd) sed /usr/bin
+		-eu -eu awk $(pwd) 2>/dev/null 2>/dev/null ${HOME} export readonly
+		awk /usr/bin grep /usr/bin echo "$1" | local sed cd && cd readonly readonly grep
+	2>/dev/null awk export local ${HOME} "$@" ${HOME}
+then "$1" "$@" test done | x=1 "$@" echo && grep x=1 printf
+	2>/dev/null grep $(pwd)
+	printf awk done ${HOME} echo -eu export sed x=1 awk
+	--verbose echo 'quoted text' /usr/bin printf grep -eu ${HOME}
+/usr/bin $(pwd) echo
+awk 2>/dev/null grep sed "$@" test --verbose x=1 "$1" 2>/dev/null && /usr/bin
+/usr/bin | awk cd ${HOME} readonly --verbose sed | | --verbose
+printf 2>/dev/null then readonly -eu done -eu ${HOME} echo
+grep /usr/bin echo 2>/dev/null awk ${HOME} test 'quoted text' ${HOME} "$@" cd sed
+	'quoted text' -eu test sed grep
+printf 2>/dev/null /usr/bin x=1 2>/dev/null local echo printf && readonly
+		| awk $(pwd) printf 2>/dev/null grep "$@" | awk && --verbose /usr/bin
+	2>/dev/null sed done "$1" --verbose -eu ${HOME} --verbose
+local readonly sed /usr/bin
+&& "$1" grep && awk -eu sed awk 2>/dev/null then awk x=1 echo test then readonly
+cd grep echo printf --verbose x=1 $(pwd) $(pwd) then 2>/dev/null
+		${HOME} /usr/bin readonly "$1" x=1
+		/usr/bin | done x=1 --verbose
+		readonly export printf local $(pwd) sed 2>/dev/null
+		awk | grep /usr/bin sed
+		then ${HOME} readonly ${HOME}
+	export done printf 'quoted text' 'quoted text' done /usr/bin
+export local done readonly echo
+		"$1" "$1" x=1 done "$1" export $(pwd) x=1 $(pwd) awk ${HOME} 2>/dev/null
+	local /usr/bin awk && readonly readonly local --verbose sed | awk grep ${HOME}
+	${HOME} then then && printf readonly local done $(pwd) grep
+		| local test 'quoted text' "$1" | test export readonly test test 2>/dev/null
+		--verbose then "$@" /usr/bin "$1" $(pwd) grep $(pwd)
+		echo && | then && export grep ${HOME}
+$(pwd) --verbose awk echo readonly
+sed "$@" grep ${HOME} $(pwd) done grep test "$1" 'quoted text' "$1" export
+	awk $(pwd) echo "$@" cd 2>/dev/null "$1" x=1 grep
+	cd readonly then done x=1 -eu $(pwd) /usr/bin 'quoted text' $(pwd) 'quoted text'
+printf && /usr/bin readonly ${HOME} echo sed
+		sed local && --verbose awk &&
+	awk --verbose awk grep readonly local
+		printf then echo cd printf
+	2>/dev/null then "$@" sed -eu ${HOME}
+		/usr/bin test x=1 local cd "$1"
+| 'quoted text' sed grep cd cd ${HOME} then 2>/dev/null --verbose
+	cd --verbose grep grep local
+done "$@" | $(pwd) sed awk && x=1 done then x=1
+	awk export awk ${HOME} test sed then $(pwd) $(pwd)
+	-eu && && awk readonly | then 'quoted text' echo "$@" "$1" awk
+export then x=1 export 2>/dev/null sed readonly
+		| /usr/bin printf export x=1 echo awk cd then --verbose 2>/dev/null
+	cd "$1" local done $(pwd) $(pwd) done -eu -eu test then
+2>/dev/null 2>/dev/null awk echo /usr/bin
+		"$1" 2>/dev/null $(pwd) $(pwd) test 2>/dev/null
+		'quoted text' x=1 -eu /usr/bin -eu && export ${HOME} 2>/dev/null then "$1"
+awk test x=1 /usr/bin printf test awk x=1
+		sed && -eu readonly local readonly ${HOME} $(pwd) 2>/dev/null
+	&& $(pwd) export done test ${HOME} ${HOME} /usr/bin export
+	echo readonly 'quoted text' local /usr/bin awk
+		"$1" sed grep "$1" printf 'quoted text' echo -eu 'quoted text'
+done x=1 && local cd echo
+	-eu awk done "$@" done sed "$1" test
+	${HOME} then 2>/dev/null grep test "$@" local "$1" --verbose
+	export then --verbose ${HOME} test | awk test grep
+		readonly 2>/dev/null readonly | "$1" -eu $(pwd) ${HOME}
+		done $(pwd) --verbose done awk && awk grep &&
+	2>/dev/null readonly awk x=1 readonly readonly
+		local cd -eu --verbose then
+		readonly export $(pwd) local -eu && && x=1 "$1" then $(pwd) "$@" then echo local
+		done printf cd 2>/dev/null | -eu -eu grep /usr/bin /usr/bin cd $(pwd) ${HOME}
+export awk && cd export cd ${HOME} --verbose
+		x=1 done ${HOME} export echo readonly "$1" test && then awk | 2>/dev/null
+	"$1" /usr/bin grep readonly grep local --verbose export cd
+		x=1 | | grep sed then then 2>/dev/null x=1 x=1 | awk grep grep readonly $(pwd)
+		'quoted text' cd ${HOME} /usr/bin awk && grep printf test local $(pwd) export
+$(pwd) 'quoted text' echo -eu $(pwd) --verbose then printf
+	-eu ${HOME} "$1" local printf 2>/dev/null ${HOME} export
+2>/dev/null "$@" grep 2>/dev/null
+${HOME} 2>/dev/null sed
+		--verbose --verbose /usr/bin
+		--verbose 'quoted text' "$1" ${HOME} test
+		sed "$@" test $(pwd) done sed ${HOME} $(pwd) "$@" grep && -eu echo
+		&& x=1 'quoted text' "$@" ${HOME}
+awk "$@" grep echo test local -eu readonly
+	awk export 'quoted text' "$1" $(pwd) grep done sed test export
+		readonly --verbose && awk "$1" && done local && sed /usr/bin sed
+		'quoted text' sed ${HOME} -eu sed | --verbose 2>/dev/null -eu |
+2>/dev/null 2>/dev/null -eu -eu cd x=1
+	printf "$@" printf test readonly "$@" export /usr/bin test /usr/bin "$1" $(pwd)
+	--verbose grep sed test /usr/bin readonly
+	$(pwd) sed printf "$@"
+export echo then && /usr/bin
+&& | "$1" export grep
+| done sed printf test local test --verbose && cd awk
+	&& readonly local 'quoted text' "$1" && 2>/dev/null
+	"$@" ${HOME} 2>/dev/null "$@" cd ${HOME} /usr/bin
+echo x=1 export x=1 /usr/bin cd local grep -eu 'quoted text' test ${HOME}
+	then 2>/dev/null --verbose done && "$1" echo export grep export
+&& awk printf readonly "$1" sed
+	test -eu | local ${HOME} ${HOME} ${HOME} /usr/bin
+	echo printf "$1" $(pwd) /usr/bin readonly sed sed printf
+	cd echo 2>/dev/null local export x=1
+echo export done --verbose /usr/bin done printf test test /usr/bin
+awk && | then /usr/bin | test echo x=1
+then x=1 then /usr/bin && export /usr/bin
+sed awk test sed | awk cd readonly
+		grep readonly --verbose echo $(pwd) $(pwd) --verbose cd $(pwd)
+		local test --verbose readonly local -eu cd grep grep && test ${HOME}
+/usr/bin echo then awk 'quoted text' sed grep readonly -eu done awk test 'quoted text'
+		test then "$@" "$@" /usr/bin
+	$(pwd) awk "$@" done awk x=1 --verbose
+local "$1" /usr/bin /usr/bin | && done $(pwd) grep test then awk test x=1 export
+		then printf grep --verbose cd "$1" export test local ${HOME}
+		'quoted text' readonly done "$1" then "$@" --verbose /usr/bin done
+	then awk done 'quoted text' x=1 done 2>/dev/null ${HOME} done
+		cd done readonly 'quoted text' sed
+		readonly "$1" then $(pwd)
+		"$1" -eu printf readonly $(pwd) $(pwd)
+		test x=1 x=1 2>/dev/null && 'quoted text' $(pwd)
+	done x=1 --verbose x=1 x=1 --verbose --verbose
+cd printf $(pwd) then printf
+	2>/dev/null printf 2>/dev/null awk | printf x=1 done cd echo
+	echo /usr/bin 2>/dev/null /usr/bin -eu echo $(pwd) then ${HOME} | /usr/bin
+echo test done readonly $(pwd) then readonly | export -eu
+"$@" export "$@" 2>/dev/null awk test x=1 "$1" 2>/dev/null
+export grep && test sed export test "$@"
+	grep 2>/dev/null test printf printf sed awk 'quoted text'
+x=1 echo ${HOME} --verbose sed test echo /usr/bin done -eu done echo export /usr/bin
+	--verbose readonly && -eu $(pwd) local --verbose ${HOME} printf awk && grep
+		"$1" ${HOME} "$@" $(pwd) test -eu x=1 local
+"$@" ${HOME} "$1" | x=1 echo cd
+&& export && /usr/bin export $(pwd) 'quoted text' /usr/bin
+		awk -eu 2>/dev/null then awk grep cd cd /usr/bin local local "$1" "$1" x=1
+	--verbose awk 'quoted text' 'quoted text' awk /usr/bin
+	$(pwd) $(pwd) "$@" local test export cd --verbose ${HOME} $(pwd) printf
+		printf done && readonly 2>/dev/null /usr/bin
+	echo /usr/bin $(pwd) $(pwd) -eu "$@" --verbose 'quoted text' 2>/dev/null
+	x=1 printf $(pwd) -eu 2>/dev/null ${HOME} test x=1 'quoted text'
+	grep sed x=1 readonly sed local readonly ${HOME} ${HOME} | readonly
+test $(pwd) done export export $(pwd) local done readonly printf "$@" --verbose
+	grep readonly $(pwd) cd then "$@" 2>/dev/null
+"$1" 2>/dev/null 2>/dev/null
+	done | $(pwd) "$@" sed grep 2>/dev/null "$1" x=1 "$@" $(pwd) /usr/bin printf
+/usr/bin 'quoted text' ${HOME} "$1" test "$1" awk "$1" && done readonly
+		local grep $(pwd) --verbose readonly | export $(pwd) echo printf printf && sed
+grep local echo printf /usr/bin 2>/dev/null ${HOME} echo
+		$(pwd) && --verbose local $(pwd) sed cd readonly done test then
+	'quoted text' cd grep 'quoted text' 2>/dev/null ${HOME}
+		grep "$@" local --verbose grep local 'quoted text' export then && "$1" cd echo
+--verbose "$@" 'quoted text' local export echo
+		&& echo "$@" done sed ${HOME} x=1 "$@" /usr/bin awk | printf
+then $(pwd) -eu -eu && && done
+$(pwd) -eu "$@" && | "$@" && then echo
+		cd x=1 'quoted text' then cd readonly -eu local
+	cd then "$1" /usr/bin -eu done
+		x=1 && test "$1" test $(pwd) | done && test --verbose then 2>/dev/null
+	awk export ${HOME} /usr/bin "$1"
+		${HOME} cd done | $(pwd) printf printf readonly export printf "$@"
+	sed test awk --verbose && "$1" local
+2>/dev/null done && grep && ${HOME} then sed "$@" 2>/dev/null
+--verbose cd ${HOME} readonly 'quoted text' test 'quoted text' -eu test
+		test export 'quoted text' | done then /usr/bin "$@" sed export test $(pwd)
+		readonly test echo then
+readonly /usr/bin echo awk local cd "$1" "$1"
+&& echo 'quoted text' readonly awk /usr/bin cd
+		2>/dev/null 'quoted text' local grep "$@" echo
+'quoted text' "$1" $(pwd) ${HOME} grep --verbose
+&& -eu awk && echo ${HOME} test x=1 -eu
+awk sed done then | 2>/dev/null local $(pwd) printf $(pwd)
+sed cd awk "$@" awk sed x=1 printf
+	local test readonly --verbose cd printf --verbose /usr/bin
+		$(pwd) awk printf readonly sed $(pwd) $(pwd) -eu printf "$1"
+		sed -eu && printf printf echo test $(pwd) 'quoted text'
+	readonly sed printf x=1 export
+"$@" -eu printf "$1" "$1" ${HOME} printf x=1 cd 2>/dev/null
+		awk grep local echo grep
+	--verbose sed awk readonly -eu /usr/bin printf grep grep 'quoted text'
+		awk && x=1 local readonly sed "$1" awk cd ${HOME} awk | printf
+readonly grep ${HOME} -eu test cd awk
+		readonly grep local then 2>/dev/null
+test local echo --verbose echo "$@" 'quoted text' && $(pwd) printf echo grep
+		test "$1" /usr/bin /usr/bin then echo && /usr/bin grep | grep awk sed | readonly
+		local --verbose awk 'quoted text'
+		local -eu cd "$@" echo "$1" local "$@" sed then
+	| export local --verbose cd --verbose readonly --verbose printf local
+	then 'quoted text' /usr/bin printf local sed printf
+		"$@" 'quoted text' local -eu 'quoted text' local cd then
+local $(pwd) awk /usr/bin done ${HOME} sed done sed /usr/bin
+		printf && -eu sed "$1" export readonly "$@" --verbose 2>/dev/null
+	echo cd && --verbose then
+		local cd local grep ${HOME} $(pwd) /usr/bin --verbose 2>/dev/null
+x=1 2>/dev/null $(pwd)
+${HOME} 2>/dev/null sed 'quoted text'
+done "$@" local 2>/dev/null readonly export --verbose "$1" awk $(pwd)
+		$(pwd) x=1 then printf cd "$1" then -eu $(pwd) $(pwd) | $(pwd)
+$(pwd) then export --verbose "$@" && --verbose printf
+		grep /usr/bin awk cd done test /usr/bin --verbose ${HOME} -eu echo | "$1"
+	done && x=1 local echo $(pwd) --verbose -eu
+	sed --verbose done "$@" awk readonly echo && readonly export 2>/dev/null export
+		then "$@" 'quoted text'
+${HOME} export --verbose then
+		$(pwd) "$1" x=1 /usr/bin
+		"$@" export readonly 2>/dev/null export $(pwd)
+		cd $(pwd) printf && && "$@" echo echo ${HOME}
+		export local x=1 awk done 2>/dev/null export ${HOME} && "$1" -eu "$1" ${HOME}
+	x=1 'quoted text' x=1 export done &&
+2>/dev/null $(pwd) x=1 -eu sed cd then ${HOME} local sed export export test
+		-eu 2>/dev/null | then x=1 "$1" && awk
+done test export printf readonly ${HOME} ${HOME}
+x=1 cd readonly done sed "$@" cd $(pwd) --verbose then "$1"
+	awk ${HOME} readonly "$1" readonly export export x=1 export -eu cd -eu cd readonly
+		echo 2>/dev/null "$1" ${HOME} readonly "$@" test | x=1 -eu printf cd grep x=1
+sed | /usr/bin ${HOME} /usr/bin && printf
+--verbose 'quoted text' x=1
+		"$1" cd x=1 "$1" | done test export &&
+	export $(pwd) && "$1" 2>/dev/null export | -eu 'quoted text'
+		test --verbose printf | "$@" readonly readonly then -eu 'quoted text'
+printf 2>/dev/null echo grep --verbose test
+	echo sed /usr/bin x=1 "$@" then && echo
+	/usr/bin readonly "$1" --verbose $(pwd) | && "$1" -eu sed "$1" local
+		$(pwd) "$1" awk echo
+		echo -eu local "$1" cd echo $(pwd) 2>/dev/null
+'quoted text' "$1" x=1 ${HOME} sed done local readonly cd --verbose "$1"
+${HOME} done test printf
+	| $(pwd) readonly && "$@" /usr/bin 2>/dev/null | "$1" $(pwd) done 'quoted text'
+'quoted text' --verbose readonly | then "$@" x=1 test && local grep cd then ${HOME}
+| export printf --verbose cd /usr/bin 'quoted text' done 2>/dev/null
+		echo x=1 grep | --verbose sed export $(pwd) printf test awk test awk printf
+"$1" "$@" 2>/dev/null done export done awk --verbose printf echo 2>/dev/null
+		2>/dev/null && printf /usr/bin "$@" grep --verbose test local
+		local && /usr/bin echo /usr/bin /usr/bin
+		${HOME} echo cd echo done 2>/dev/null -eu done test awk echo
+		export /usr/bin "$1" readonly
+	printf cd local cd -eu printf then done echo | test
+sed export && x=1 "$@" "$@" "$@" "$@" awk export && /usr/bin 'quoted text'
+	printf x=1 export sed x=1 $(pwd) "$@" done ${HOME} $(pwd) -eu ${HOME}
+	&& "$1" 2>/dev/null ${HOME} 'quoted text' $(pwd) awk done 2>/dev/null
+	awk -eu && "$1" && /usr/bin -eu --verbose ${HOME} -eu cd echo /usr/bin 'quoted text'
+		$(pwd) "$1" --verbose /usr/bin test | local ${HOME}
+'quoted text' local then echo sed done export sed | /usr/bin
+"$@" local --verbose grep
+/usr/bin x=1 "$@" | /usr/bin ${HOME} 'quoted text' ${HOME}
+| readonly | readonly -eu 'quoted text' x=1 grep
+	--verbose printf ${HOME} cd then | -eu readonly $(pwd) then $(pwd) 2>/dev/null
+		--verbose test 2>/dev/null "$1"
+		printf --verbose ${HOME} then test grep echo
+		--verbose $(pwd) local ${HOME}
+		&& x=1 test then ${HOME} local done -eu /usr/bin printf && sed "$1" local && /usr/bin
+		| ${HOME} printf test printf printf "$@" 2>/dev/null
+		2>/dev/null awk export "$1" 2>/dev/null export
+	-eu awk test printf then export /usr/bin $(pwd) readonly
+	"$1" --verbose echo /usr/bin then 'quoted text'
+	sed export /usr/bin local "$1" x=1 --verbose
+cd 'quoted text' ${HOME} then $(pwd) sed -eu -eu x=1 'quoted text'
+test 'quoted text' then ${HOME} sed x=1 | awk | test
+	2>/dev/null cd "$@" readonly --verbose done awk -eu awk printf
+	export printf export readonly $(pwd) test ${HOME} local sed
+/usr/bin then /usr/bin done 2>/dev/null $(pwd) then "$@" && &&
+		${HOME} | awk readonly readonly cd sed done $(pwd) 'quoted text'
+&& sed printf && test
+	readonly "$1" then /usr/bin readonly
+printf readonly cd printf echo sed
+x=1 /usr/bin | -eu done 'quoted text'
+	printf "$@" test grep then local -eu then
+	--verbose 'quoted text' /usr/bin /usr/bin --verbose $(pwd) "$@"
+	${HOME} export test |
+-eu 2>/dev/null echo echo cd ${HOME} then printf
+	'quoted text' | then
+		$(pwd) done sed 'quoted text' sed "$1"
+		2>/dev/null echo grep 2>/dev/null cd sed | grep test /usr/bin "$@" /usr/bin
+x=1 | /usr/bin "$1" --verbose then "$1" && grep grep sed
+		| 'quoted text' "$@" done export export local
+grep test 2>/dev/null 'quoted text' cd then sed sed
+		sed done "$1" done "$1" "$1" sed export grep
+	"$@" | awk 2>/dev/null local done x=1 "$1" sed 2>/dev/null test -eu awk ${HOME}
+		grep 2>/dev/null -eu sed --verbose test cd grep cd --verbose cd then
+printf 'quoted text' && test x=1 export export /usr/bin test
+		"$1" "$@" printf readonly -eu then echo
+		echo sed -eu cd awk then ${HOME} --verbose 2>/dev/null
+	local "$@" printf local 'quoted text' test /usr/bin echo | local 'quoted text'
+		"$@" echo 2>/dev/null 2>/dev/null "$@" sed | --verbose
+	| && x=1 "$1" test x=1 ${HOME} 'quoted text' local
+		echo grep 2>/dev/null 'quoted text'
+2>/dev/null then ${HOME} readonly readonly ${HOME} then awk
+	$(pwd) -eu 'quoted text' "$@" 'quoted text'
+	readonly test x=1 grep printf 2>/dev/null printf test test done ${HOME} x=1 2>/dev/null
+sed grep ${HOME} ${HOME} && done
+		cd then test ${HOME} 'quoted text' /usr/bin readonly
+awk export 'quoted text' awk 2>/dev/null awk 2>/dev/null && "$1" --verbose "$@"
+		export then export /usr/bin printf && local "$@"
+echo x=1 2>/dev/null then $(pwd) ${HOME}
+		sed && x=1 then ${HOME}
+	echo local "$1" printf |
+/usr/bin readonly "$@" --verbose x=1 awk then --verbose /usr/bin
+2>/dev/null grep "$@" done --verbose export ${HOME} -eu &&
+local $(pwd) ${HOME} awk 2>/dev/null
+		&& "$@" test awk --verbose sed test echo $(pwd) local "$1" done "$@" local --verbose
+then cd $(pwd) ${HOME} 2>/dev/null printf export cd "$1"
+	sed 2>/dev/null --verbose export grep -eu 2>/dev/null -eu grep grep done ${HOME}
+done "$1" | && -eu && ${HOME} printf | "$1" /usr/bin echo
+		${HOME} then $(pwd) printf "$@" /usr/bin awk "$1" ${HOME} $(pwd)
+		readonly --verbose then ${HOME} grep readonly
+	grep ${HOME} "$@" ${HOME} /usr/bin /usr/bin printf
+	${HOME} "$1" local export 'quoted text' then test echo $(pwd) x=1
+then "$1" local echo 'quoted text' 2>/dev/null
+x=1 then 'quoted text'
+		export test /usr/bin export | --verbose $(pwd) then ${HOME}
+		| ${HOME} sed printf printf cd /usr/bin && | "$@" then --verbose /usr/bin
+$(pwd) --verbose readonly echo && awk | "$@" --verbose
+	local x=1 2>/dev/null then echo x=1 && printf
+		| -eu "$@" awk /usr/bin ${HOME} local && /usr/bin "$1" ${HOME} awk done sed --verbose
+	x=1 ${HOME} test ${HOME}
+local | test grep && "$1" -eu grep -eu 2>/dev/null 2>/dev/null
+		done -eu echo sed echo done 2>/dev/null x=1 local --verbose then awk $(pwd) sed
+/usr/bin | x=1 | "$1" awk awk readonly 2>/dev/null 2>/dev/null
+cd then done echo local grep /usr/bin --verbose --verbose | awk done echo
+		done cd $(pwd) $(pwd) grep sed -eu x=1 then -eu /usr/bin
+grep && ${HOME} grep grep printf readonly echo
+		test && printf printf x=1 --verbose then awk | && then
+	awk -eu grep -eu -eu done "$1" | ${HOME} 'quoted text'
+	awk ${HOME} --verbose test awk sed -eu x=1 --verbose 2>/dev/null
+"$1" --verbose export /usr/bin done cd /usr/bin test grep done /usr/bin
+	--verbose cd --verbose | test /usr/bin | then echo readonly
+sed local 2>/dev/null /usr/bin
+	--verbose printf awk "$1" 'quoted text' done export sed readonly echo $(pwd)
+export | /usr/bin sed $(pwd) export
+		'quoted text' ${HOME} export printf cd 'quoted text' ${HOME} awk
+	${HOME} awk grep x=1 && $(pwd) /usr/bin && "$@" cd "$1" x=1 x=1 -eu cd
+&& export /usr/bin ${HOME}
+		sed then done /usr/bin test sed cd "$@" cd 2>/dev/null | export local
+	printf grep "$1" | awk --verbose grep
+local /usr/bin --verbose | readonly local cd 'quoted text'
+		| && sed readonly --verbose "$1" sed test echo done
+export sed echo export "$1" ${HOME} /usr/bin
+	${HOME} done local "$@" sed --verbose local 2>/dev/null
+		export readonly printf export readonly ${HOME} grep -eu grep then test "$@"
+then awk export test 'quoted text' 2>/dev/null /usr/bin awk done
+		| awk echo x=1 && -eu | echo $(pwd) printf grep $(pwd) printf test
+cd 2>/dev/null done done 2>/dev/null grep -eu sed /usr/bin grep
+	"$@" /usr/bin awk "$@" test export cd 2>/dev/null "$1" ${HOME}
+	awk ${HOME} -eu && 2>/dev/null export && | cd awk $(pwd) -eu grep test
+test awk | grep && "$1"
+		/usr/bin && sed | sed x=1 local --verbose
+printf | local export test "$1" "$1" cd /usr/bin $(pwd)
+--verbose awk export sed ${HOME} $(pwd) printf printf
+	test test $(pwd) test | && --verbose
+readonly 'quoted text' readonly 'quoted text' readonly 'quoted text'
+	$(pwd) readonly printf x=1 awk /usr/bin
+awk && export printf | 2>/dev/null sed readonly sed sed ${HOME} $(pwd)
+	"$@" --verbose awk export "$@" readonly 2>/dev/null 'quoted text' export
+	&& 2>/dev/null test printf sed --verbose $(pwd) then "$@" "$1" awk x=1 awk awk
+	local 2>/dev/null local echo | printf
+done awk 'quoted text' $(pwd) cd readonly ${HOME} 2>/dev/null
+		test cd export x=1 "$@" test x=1 sed && 2>/dev/null
+		test local --verbose cd 2>/dev/null printf test
+		${HOME} && export export done -eu local printf /usr/bin --verbose then
+	local readonly local sed export && -eu grep "$1" x=1 'quoted text' echo 2>/dev/null
+	/usr/bin "$1" && 'quoted text' done sed test --verbose $(pwd)
+		| && export echo grep ${HOME} cd test --verbose
+		$(pwd) test local 2>/dev/null sed 2>/dev/null /usr/bin
+		readonly "$@" done test --verbose
+	/usr/bin export 2>/dev/null readonly local grep 'quoted text'
+		test awk done test $(pwd) readonly grep printf local 'quoted text'
+	cd --verbose /usr/bin export
+		printf 'quoted text' && sed local 'quoted text' /usr/bin 2>/dev/null
+test readonly /usr/bin done x=1 readonly $(pwd)
+"$@" 'quoted text' --verbose
+		local | done local then | readonly cd then "$1" done 'quoted text'
+		sed test x=1 -eu x=1 -eu && --verbose ${HOME} "$@" printf &&
+printf printf grep test -eu $(pwd) done
+		cd printf /usr/bin grep
+cd cd cd -eu | echo | echo && readonly 2>/dev/null
+'quoted text' $(pwd) printf | "$1" /usr/bin
+	2>/dev/null "$1" printf then $(pwd) printf
+		'quoted text' cd 'quoted text' local && export
+cd "$@" then && -eu echo grep echo "$1" "$1"
+		2>/dev/null "$1" "$1" done test test export sed
+	sed awk "$@" readonly awk | 'quoted text'
+	export 'quoted text' cd "$1" "$1" sed | && ${HOME} x=1 'quoted text' then
+	then $(pwd) export done printf done x=1 test grep local ${HOME} "$1" cd awk echo
+	echo local $(pwd) grep export local export
+	-eu $(pwd) cd 'quoted text'
+		sed 'quoted text' test 2>/dev/null
+		"$@" grep --verbose && export printf sed 2>/dev/null "$@" --verbose cd -eu
+test $(pwd) | echo /usr/bin done | && readonly /usr/bin export 2>/dev/null sed
+"$@" done awk "$@" cd /usr/bin
+${HOME} /usr/bin export sed cd readonly local grep "$1" x=1 readonly
+	"$@" --verbose grep awk ${HOME} ${HOME} && "$@" 'quoted text'
+		test test local local echo local $(pwd)
+"$@" 2>/dev/null test 'quoted text' "$@" -eu
+	--verbose $(pwd) && awk done sed grep grep "$@" 2>/dev/null ${HOME}
+$(pwd) grep sed cd then local
+-eu done | readonly local 'quoted text' /usr/bin 2>/dev/null local awk /usr/bin
+$(pwd) sed x=1 export /usr/bin then
+		"$@" 2>/dev/null done echo $(pwd) echo 'quoted text' ${HOME}
+	"$@" echo 2>/dev/null ${HOME} printf 2>/dev/null
+	"$1" echo 'quoted text' && echo sed && done done printf
+	$(pwd) export $(pwd) "$@" readonly "$@" "$1" | done printf local "$1"
+		done "$1" then 2>/dev/null then "$@" && printf
+		readonly export "$@" printf -eu awk
+	cd /usr/bin printf local | x=1 && x=1 $(pwd)
+	$(pwd) "$1" "$@" --verbose echo test readonly echo 2>/dev/null test readonly
+		${HOME} done local export then test --verbose printf echo
+'quoted text' sed && | done export then done "$1"
+	"$@" then awk x=1 export
+	sed readonly sed sed | --verbose "$@" export export 'quoted text' sed "$1" readonly
+printf cd "$@" | "$1" --verbose "$@" then
+/usr/bin done awk 2>/dev/null
+		&& $(pwd) awk export echo local test -eu x=1 'quoted text' local
+sed test done awk ${HOME} "$1" export --verbose
+	sed done done --verbose cd "$1" cd then echo /usr/bin | --verbose then
+	then /usr/bin /usr/bin -eu readonly export
+		grep -eu export /usr/bin && "$1" "$1" echo -eu grep /usr/bin
+	/usr/bin echo 'quoted text' x=1 grep
+grep 'quoted text' 'quoted text' readonly
+awk | 2>/dev/null "$@" then -eu then cd echo $(pwd) "$@"
+grep /usr/bin 'quoted text' grep
+grep awk printf echo 2>/dev/null 'quoted text' echo 'quoted text' then /usr/bin
+	grep readonly awk "$@" awk echo "$1" x=1 done -eu test "$@" done | | then ${HOME}
+"$@" readonly test then --verbose cd && done readonly 'quoted text'
+	sed $(pwd) $(pwd) --verbose | test test
+awk -eu readonly "$@" then local printf then /usr/bin echo "$1" && printf export
+		local printf --verbose 2>/dev/null
+	printf 2>/dev/null 'quoted text'
+	-eu /usr/bin sed $(pwd) echo grep /usr/bin test sed /usr/bin
+sed "$@" readonly sed echo echo $(pwd) test then
+		grep export done --verbose -eu then awk awk /usr/bin
+		local $(pwd) 2>/dev/null awk
+	readonly "$1" done cd /usr/bin --verbose grep then "$@" grep $(pwd) printf 2>/dev/null
+echo 'quoted text' cd $(pwd) then "$@" && | "$1" && "$1" printf "$1" export
+awk | done printf --verbose && cd ${HOME} sed "$@" export test local done
+	$(pwd) $(pwd) ${HOME} 2>/dev/null
+	--verbose /usr/bin printf
+	local --verbose printf local
+readonly readonly | readonly cd ${HOME}
+	--verbose sed export ${HOME} && printf local
+x=1 grep done && | then | printf readonly readonly 'quoted text'
+--verbose $(pwd) printf $(pwd) "$1" cd "$1" && sed -eu sed awk /usr/bin sed
+	then && test x=1 awk done then test test "$@" readonly ${HOME}
+		grep readonly printf grep
+		2>/dev/null awk grep local
+	local sed $(pwd) "$@" echo readonly 'quoted text' x=1 ${HOME} export x=1 sed test
+		then --verbose ${HOME} local then done test -eu local sed awk readonly
+		"$1" && /usr/bin readonly local export &&
+		sed ${HOME} echo cd "$@" 'quoted text'
+done cd 2>/dev/null grep "$1" 2>/dev/null then cd sed echo $(pwd) "$1"
+		cd echo "$@" 2>/dev/null export local
+	"$@" local --verbose 2>/dev/null sed test done /usr/bin
+	"$@" echo "$@" cd export --verbose cd grep 'quoted text' done --verbose
+	cd | | 'quoted text' export sed --verbose ${HOME} -eu
+local sed readonly /usr/bin -eu test $(pwd) grep cd x=1 then --verbose
+	sed test ${HOME} then readonly export local export -eu "$1" cd printf awk 'quoted text'
+	then x=1 sed 2>/dev/null $(pwd)
+$(pwd) test awk 'quoted text'
+awk then test local export printf grep /usr/bin sed "$1" 'quoted text'
+readonly printf export done -eu echo readonly echo echo then --verbose 2>/dev/null
+	2>/dev/null awk /usr/bin -eu --verbose -eu x=1 /usr/bin cd grep readonly
+x=1 sed "$1" grep $(pwd) ${HOME} awk
+		/usr/bin printf 'quoted text' | "$1" test echo local 'quoted text'
+		2>/dev/null cd export export sed then
+	--verbose readonly 'quoted text' ${HOME} && grep "$@" sed printf printf
+		&& export ${HOME} then
+		x=1 "$1" awk 2>/dev/null then 2>/dev/null local
+		| echo x=1 awk --verbose export then done 'quoted text'
+	cd "$1" awk awk && sed readonly x=1 x=1 x=1 "$1" local printf -eu
+		-eu x=1 --verbose | x=1 test grep $(pwd) && "$@" awk
+${HOME} done cd $(pwd) && ${HOME} sed "$@" done grep "$1" grep echo
+/usr/bin readonly x=1 test
+	'quoted text' ${HOME} test && export ${HOME} 2>/dev/null 'quoted text'
+'quoted text' grep -eu | awk
+readonly grep cd -eu grep then /usr/bin test awk printf cd /usr/bin
+		readonly export local && ${HOME} test export local
+		awk && 2>/dev/null cd "$@" awk test printf then test
+${HOME} --verbose printf local readonly
+		export 'quoted text' "$1" | 2>/dev/null readonly
+	sed readonly && printf local -eu 2>/dev/null
+| /usr/bin ${HOME} ${HOME} 2>/dev/null done export && "$@"
+	echo x=1 local printf export
+		readonly printf -eu && --verbose
+test grep x=1 "$1" x=1 local local awk export --verbose echo readonly done
+cd local /usr/bin awk /usr/bin ${HOME} -eu /usr/bin
+	${HOME} then awk $(pwd) test "$1" 'quoted text' awk local echo
+	echo export x=1 export && --verbose "$1" "$1" export export
+		printf grep printf $(pwd) then x=1 grep x=1
+	export echo "$1" readonly cd 'quoted text' /usr/bin local
+	--verbose "$@" test --verbose x=1 2>/dev/null then printf printf
+--verbose printf x=1 cd grep test printf awk ${HOME} then awk grep
+		cd /usr/bin 2>/dev/null cd export
+| && export readonly cd "$@" done
+sed $(pwd) "$1" -eu sed x=1 "$@" test
+local sed "$1" --verbose x=1 'quoted text'
+export export "$1" printf test local then awk 2>/dev/null
+	echo /usr/bin awk grep sed | export test
+readonly /usr/bin ${HOME} ${HOME}
+grep "$@" -eu 'quoted text' 'quoted text' -eu $(pwd)
+grep awk "$1" readonly export echo --verbose export /usr/bin | "$@" 'quoted text'
+&& ${HOME} -eu 2>/dev/null export printf
+"$@" "$@" "$1" 'quoted text' local
+	-eu local printf awk ${HOME}
+"$@" grep 'quoted text' cd local 'quoted text' 'quoted text' readonly --verbose
+		--verbose sed cd cd --verbose x=1 2>/dev/null ${HOME} --verbose
+		/usr/bin 'quoted text' "$@" readonly "$@" printf ${HOME}
+	--verbose echo 2>/dev/null export x=1 then echo test echo awk --verbose | awk
+	"$1" 2>/dev/null 'quoted text' $(pwd) cd test grep then local x=1 printf then
+		2>/dev/null then 'quoted text' export --verbose -eu done "$@" echo grep cd -eu
+		'quoted text' test sed printf "$@"
+	${HOME} readonly test 2>/dev/null && ${HOME} /usr/bin "$@" $(pwd) cd export then
+	$(pwd) $(pwd) grep "$@" cd --verbose
+		test readonly cd | x=1 --verbose
+	done cd x=1 $(pwd) x=1 then 2>/dev/null
+		grep awk 'quoted text' 'quoted text' /usr/bin export
+local then test x=1 --verbose local /usr/bin
+${HOME} ${HOME} 2>/dev/null -eu awk done
+export 'quoted text' && ${HOME} local && local grep test
+		"$@" printf done sed then sed sed printf 2>/dev/null
+		'quoted text' sed cd grep /usr/bin
+		export | ${HOME} x=1 ${HOME} /usr/bin then "$@"
+	grep awk awk $(pwd) echo "$@" export then 2>/dev/null
+	"$1" grep | then 'quoted text'
+	done awk -eu export x=1 sed 2>/dev/null 2>/dev/null printf echo
+	export 2>/dev/null /usr/bin sed 'quoted text' sed x=1 cd readonly
+		'quoted text' printf awk "$@" --verbose --verbose && 'quoted text' echo readonly
+&& "$@" "$1" test --verbose
+awk done -eu 2>/dev/null | -eu --verbose cd local
+then /usr/bin /usr/bin && test $(pwd) readonly local done sed "$@"
+| sed $(pwd) printf awk
+x=1 && | --verbose -eu $(pwd)
+-eu 2>/dev/null ${HOME} done cd
+		${HOME} readonly printf test 'quoted text' then grep echo $(pwd) -eu echo
+	echo -eu cd --verbose printf && "$1" awk export && sed "$@" "$@" --verbose local
+printf readonly local 'quoted text' local local sed ${HOME} echo awk
+/usr/bin -eu export "$1" cd readonly 2>/dev/null $(pwd) test /usr/bin cd
+		--verbose --verbose --verbose
+		'quoted text' && x=1 'quoted text' done "$1" --verbose
+		--verbose && && local done
+	sed sed 2>/dev/null "$1" readonly printf done
+	"$@" grep "$1" readonly echo 'quoted text'
+		local $(pwd) then test $(pwd)
+		awk echo | 2>/dev/null -eu "$@" echo $(pwd) awk
+	--verbose | $(pwd) 2>/dev/null echo grep grep awk && local
+	export 2>/dev/null -eu sed echo done awk 2>/dev/null
+	export then grep ${HOME} then -eu echo 2>/dev/null echo local export
+	"$@" -eu $(pwd) -eu | x=1 printf | readonly "$@" -eu readonly
+	export done -eu 2>/dev/null -eu export grep export export readonly $(pwd) /usr/bin
+export --verbose local then "$1" cd 2>/dev/null awk readonly test
+$(pwd) then x=1 done $(pwd) done && done $(pwd) -eu 2>/dev/null local x=1 done
+	/usr/bin && echo ${HOME} echo && 2>/dev/null
+export printf --verbose local test test local
+		| sed $(pwd) --verbose "$1" cd test x=1 done
+	/usr/bin readonly | | 2>/dev/null sed echo local /usr/bin 2>/dev/null local printf
+	local grep && export && then /usr/bin local | $(pwd) readonly && | awk "$@"
+	test 2>/dev/null then 'quoted text' $(pwd) --verbose
+		${HOME} grep -eu -eu -eu
+local cd test 'quoted text' --verbose && 2>/dev/null then --verbose
+		cd ${HOME} 2>/dev/null -eu &&
+	&& echo sed export sed x=1 "$@" readonly && sed sed $(pwd) readonly
+		readonly grep $(pwd) "$@" -eu sed -eu "$@" cd sed sed 'quoted text'
+		cd echo --verbose local readonly
+grep echo 'quoted text'
+	'quoted text' --verbose "$@" && 'quoted text' printf done cd local $(pwd) readonly
+		&& /usr/bin --verbose "$1" && | echo awk then echo "$1" export readonly -eu /usr/bin
+		"$@" 'quoted text' export grep x=1 -eu test export "$@"
+done printf sed "$1" done --verbose test printf 'quoted text'
+done export "$@" then export 'quoted text' then test export
+	$(pwd) printf then local
+		cd local && 'quoted text' export /usr/bin export
+--verbose echo local local grep export
+	/usr/bin x=1 x=1 && ${HOME} awk | --verbose | ${HOME} 2>/dev/null $(pwd)
+	x=1 printf printf readonly test then
+cd 2>/dev/null $(pwd) export printf echo printf
+2>/dev/null done done | sed $(pwd) done sed echo | | && 2>/dev/null $(pwd) "$1"
+		test readonly export export /usr/bin $(pwd) printf
+	echo test sed then 'quoted text' 'quoted text' "$1"
+"$1" $(pwd) sed export ${HOME} 'quoted text' readonly
+		readonly echo sed grep x=1 then "$1" cd && && printf
+sed readonly awk sed "$1" readonly $(pwd)
+		done echo | "$1" done "$@"
+cd printf && awk cd done "$@" 2>/dev/null readonly -eu ${HOME} done export |
+	echo -eu cd 'quoted text' |
+		--verbose grep printf 'quoted text' 'quoted text' | local printf
+grep /usr/bin cd "$1" &&
+printf printf 2>/dev/null readonly "$@" --verbose --verbose
+		-eu done | "$1" echo awk && export -eu $(pwd)
+		2>/dev/null $(pwd) | 2>/dev/null x=1 $(pwd) && readonly
+		| --verbose | then export "$1"
+	cd ${HOME} done test | sed echo export /usr/bin x=1 cd |
+		readonly cd sed ${HOME}
+	awk export then && -eu awk cd echo test 'quoted text'
+	-eu $(pwd) done $(pwd) printf $(pwd) test 'quoted text' "$1" "$@"
+	awk ${HOME} "$@" grep sed &&
+	printf sed printf | -eu done then export $(pwd) | grep readonly 2>/dev/null
+	local export ${HOME} grep readonly x=1 local && "$@" done "$@" /usr/bin
+	then -eu "$1" done | --verbose -eu printf
+		sed x=1 "$@" sed -eu export done
+		test "$@" "$1" echo --verbose 'quoted text' sed --verbose 2>/dev/null printf
+	test cd done printf export grep readonly "$1" done readonly done printf
+		printf /usr/bin /usr/bin $(pwd) /usr/bin | x=1 &&
+printf | /usr/bin cd sed awk x=1 grep ${HOME} test printf 2>/dev/null "$1" test
+		echo /usr/bin x=1 /usr/bin
+	done cd done $(pwd) 'quoted text' sed | /usr/bin
+local cd --verbose printf then
+	sed "$1" printf grep --verbose && | "$1" grep cd ${HOME} then readonly
+		test printf then "$@" -eu echo "$@" --verbose
+		export sed /usr/bin readonly | done cd "$1" printf x=1 && 'quoted text'
+	"$@" then sed export test readonly printf 'quoted text' test test
+	x=1 local echo test "$1" -eu
+	awk 2>/dev/null -eu x=1 awk export awk
+		done --verbose cd x=1 export done test then /usr/bin awk 2>/dev/null
+	-eu local "$@" local x=1 "$@"
+		then awk && sed sed && $(pwd) "$1" $(pwd) awk ${HOME} readonly /usr/bin awk
+	"$1" sed export --verbose -eu --verbose
+done local -eu cd 'quoted text' 'quoted text' cd 'quoted text' export --verbose
+		readonly "$1" -eu grep readonly cd local test export x=1
+&& && export "$1" -eu /usr/bin | 2>/dev/null export echo test | grep printf
+test echo awk $(pwd) --verbose cd grep --verbose awk
+	$(pwd) /usr/bin then $(pwd) awk -eu done && /usr/bin
+awk && cd | "$1" test /usr/bin printf sed "$@" | /usr/bin 2>/dev/null
+	awk done readonly grep /usr/bin | printf test 'quoted text' test
+$(pwd) grep ${HOME} | then readonly export "$@"
+x=1 then readonly awk ${HOME} printf
+x=1 done grep | done printf cd echo printf |
+	test cd cd readonly "$1" $(pwd)
+		grep ${HOME} 'quoted text' && printf
+	test done printf ${HOME} awk x=1 done -eu ${HOME}
+	done grep export echo test "$@"
+	echo export readonly done echo --verbose
+	-eu awk test local 2>/dev/null done sed | 2>/dev/null grep ${HOME} local ${HOME}
+cd $(pwd) test done test | local local
+	printf && /usr/bin readonly
+	local "$@" "$@" done local awk local
+	${HOME} printf export &&
+	cd -eu 'quoted text' $(pwd)
+		'quoted text' ${HOME} && local cd cd local done "$1" test x=1 awk
+		awk | ${HOME} awk grep
+	export awk grep local grep 'quoted text' | readonly
+		| awk export echo cd ${HOME}
+-eu done /usr/bin ${HOME} /usr/bin awk -eu && export -eu readonly test "$@"
+	'quoted text' "$1" 'quoted text' grep ${HOME} local "$@"
+		local 2>/dev/null sed x=1 "$@" /usr/bin
+		export --verbose awk && x=1 awk local awk
+		cd 'quoted text' local export printf cd local 2>/dev/null
+		2>/dev/null local cd
+		echo then printf "$@" | $(pwd) test | test done 2>/dev/null test test
+	sed then 2>/dev/null -eu /usr/bin test grep
+done then echo "$@" $(pwd) 2>/dev/null -eu 2>/dev/null "$1" done awk
+		/usr/bin x=1 "$1" "$@" "$@" then
+-eu 'quoted text' "$@" -eu && | echo
+		readonly awk printf && echo x=1 ${HOME} awk "$1" printf "$1"
+		export /usr/bin 2>/dev/null echo 2>/dev/null $(pwd) | 'quoted text' readonly
+awk printf printf grep sed && readonly local then echo $(pwd)
+	2>/dev/null ${HOME} -eu ${HOME} | printf done 'quoted text' 'quoted text' echo
+awk | awk -eu then | awk then 'quoted text' printf
+export readonly -eu -eu echo awk $(pwd) grep cd "$1"
+$(pwd) 'quoted text' --verbose ${HOME} then --verbose then readonly test
+		2>/dev/null grep "$1" 'quoted text' ${HOME} &&
+		| then test ${HOME} test
+		&& awk done -eu 2>/dev/null printf $(pwd) "$1" $(pwd) echo test | "$@" -eu
+	| | printf --verbose x=1 $(pwd)
+		'quoted text' "$1" --verbose | | --verbose /usr/bin printf && ${HOME}
+2>/dev/null "$1" 2>/dev/null
+-eu "$1" /usr/bin test "$@" $(pwd) sed test sed && printf
+	grep "$@" ${HOME} then $(pwd) -eu /usr/bin
+	then test "$1" "$1" printf "$@" sed $(pwd) printf echo 2>/dev/null sed $(pwd) done
+	sed cd | local "$1" ${HOME} 'quoted text'
+--verbose && readonly local $(pwd) echo ${HOME} 2>/dev/null
+		local 'quoted text' && awk -eu
+$(pwd) test --verbose "$1"
+		echo "$@" 2>/dev/null x=1 'quoted text'
+'quoted text' $(pwd) readonly cd && echo grep printf /usr/bin grep test -eu
+		local export sed echo local --verbose -eu $(pwd) "$@" && cd | /usr/bin | && then
+	"$@" -eu | /usr/bin then awk printf readonly
+	x=1 "$@" $(pwd) local export "$1" sed echo /usr/bin test
+	awk && "$1" local /usr/bin readonly awk | "$1" | printf && ${HOME} then
+| ${HOME} done | sed done ${HOME}
+		-eu $(pwd) printf echo --verbose
+		"$1" "$1" "$1" test cd local ${HOME} test test local
+		"$1" cd && -eu && echo $(pwd) done printf
+	| awk /usr/bin ${HOME} readonly
+readonly x=1 awk -eu 'quoted text' $(pwd)
+	readonly ${HOME} readonly cd export sed ${HOME}
+	&& | export -eu readonly x=1 /usr/bin
+cd $(pwd) -eu /usr/bin readonly cd && sed cd $(pwd) done "$@"
+then printf | 'quoted text' $(pwd) printf && done "$@" "$@" | -eu grep awk
+		-eu readonly readonly $(pwd) --verbose grep /usr/bin awk readonly x=1 cd
+		/usr/bin printf cd && $(pwd) $(pwd) sed awk --verbose
+		grep awk | | "$@" && 'quoted text' grep export ${HOME} done $(pwd) && sed 'quoted text'
+		/usr/bin "$1" x=1 "$@" "$1"
+		x=1 /usr/bin grep echo sed cd --verbose sed $(pwd) /usr/bin
+| readonly printf 2>/dev/null grep test ${HOME}
+		grep export 'quoted text' "$@" "$1" 'quoted text' "$1" cd 'quoted text'
+	--verbose /usr/bin /usr/bin $(pwd) sed awk sed /usr/bin
+sed cd sed cd export then "$@" done x=1 x=1 /usr/bin /usr/bin "$1"
+		grep 'quoted text' && 2>/dev/null 'quoted text' 2>/dev/null
+		$(pwd) done 2>/dev/null cd --verbose cd local --verbose cd
+	-eu "$@" echo | -eu export ${HOME} /usr/bin grep test done test echo
+	--verbose done /usr/bin test echo awk x=1 sed |
+		sed "$@" /usr/bin "$@" grep done 'quoted text' readonly ${HOME}
+grep 'quoted text' ${HOME} done readonly x=1 -eu "$@"
+		sed echo "$@" 2>/dev/null local /usr/bin
+		printf --verbose readonly
+done grep 'quoted text' "$1"
+	printf sed /usr/bin /usr/bin 'quoted text'
+export 2>/dev/null export cd 2>/dev/null --verbose -eu awk export cd x=1 /usr/bin
+	${HOME} then /usr/bin echo readonly &&
+		/usr/bin export | "$@" printf 'quoted text' | /usr/bin
+		export local test "$@"
+	awk grep export printf x=1 test test cd $(pwd) printf | "$@" printf $(pwd) x=1
+local 2>/dev/null x=1 readonly 'quoted text' test
+		test && "$@" cd cd $(pwd) readonly "$@" printf "$@"
+		then export grep "$1" done done test "$1" done readonly
+sed sed x=1 done 'quoted text' ${HOME}
+grep local /usr/bin printf
+test "$@" /usr/bin ${HOME} &&
+	-eu 2>/dev/null 'quoted text' -eu readonly test sed awk --verbose then ${HOME}
+&& 'quoted text' printf
+sed -eu local done 'quoted text' /usr/bin then | echo |
+'quoted text' test --verbose
+readonly local then cd readonly $(pwd) /usr/bin
+echo test then 2>/dev/null cd cd done done "$1" awk echo | done "$@"
+	done echo --verbose 2>/dev/null | | then | printf
+		--verbose 'quoted text' done | printf /usr/bin $(pwd) 2>/dev/null ${HOME}
+"$1" "$1" local -eu /usr/bin test done 'quoted text'
+		/usr/bin /usr/bin printf echo printf | echo
+	done "$1" x=1 "$1" 'quoted text' done awk 'quoted text' cd /usr/bin awk $(pwd)
+	awk --verbose x=1 awk && then
+"$1" 'quoted text' sed ${HOME} ${HOME}
+		readonly && --verbose readonly
+done awk /usr/bin $(pwd)
+		awk sed -eu done test x=1 | export echo --verbose awk /usr/bin echo /usr/bin
+		x=1 printf export echo test $(pwd)
+	local "$@" export 2>/dev/null "$@" /usr/bin done done --verbose
+"$1" x=1 readonly /usr/bin done printf cd ${HOME} 2>/dev/null
+cd local done done $(pwd) then awk
+	"$@" 2>/dev/null echo awk done printf sed readonly sed ${HOME} "$1"
+/usr/bin -eu then printf grep "$1" awk awk echo --verbose grep cd done "$1" done
+grep -eu printf && | then printf ${HOME} "$1" printf printf export
+echo 2>/dev/null sed sed | test --verbose /usr/bin ${HOME}
+export local /usr/bin 2>/dev/null
+	cd done "$@" 'quoted text' 'quoted text' ${HOME} --verbose
+awk echo echo readonly x=1 $(pwd)
+	local x=1 x=1 --verbose ${HOME} local cd && 'quoted text' 2>/dev/null 2>/dev/null
+	--verbose 'quoted text' awk 2>/dev/null
+local grep readonly x=1 printf then echo 2>/dev/null $(pwd) -eu then
+	echo printf $(pwd) awk test awk 2>/dev/null printf done 2>/dev/null cd --verbose
+	--verbose then test grep && | done export x=1 x=1
+	readonly then printf then cd --verbose | 2>/dev/null printf
+		sed test test | 2>/dev/null ${HOME} "$1" && test
+-eu /usr/bin test | cd 2>/dev/null readonly local
+	test sed local $(pwd) then
+		readonly local done 2>/dev/null test /usr/bin local -eu awk 2>/dev/null done | &&
+	'quoted text' local printf
+		readonly x=1 /usr/bin grep "$1" -eu x=1
+2>/dev/null echo printf /usr/bin "$@"
+		export x=1 -eu done cd && cd $(pwd) 2>/dev/null
+		'quoted text' echo "$@"
+x=1 | | cd 2>/dev/null "$@" then done then awk $(pwd) ${HOME}
+export local echo echo x=1 printf /usr/bin /usr/bin local readonly
+		2>/dev/null "$1" local test && | "$@" ${HOME} sed cd --verbose /usr/bin
+		then ${HOME} 2>/dev/null then test grep "$@" x=1 local "$1" /usr/bin $(pwd) -eu
+	--verbose done /usr/bin $(pwd) "$@" printf cd grep && "$1" echo
+	readonly grep | | -eu export -eu
+	test "$1" sed echo "$@"
+"$@" local export -eu printf --verbose
+	done awk done | $(pwd) $(pwd) --verbose cd x=1 local x=1 x=1 $(pwd)
+		2>/dev/null "$@" grep /usr/bin
+echo /usr/bin grep local ${HOME} "$@" awk 2>/dev/null then
+export readonly $(pwd) $(pwd) $(pwd) $(pwd) | done echo then echo
+	&& echo | && | awk --verbose then echo cd export echo "$@" | local
+		then test -eu awk $(pwd) test readonly -eu ${HOME} 'quoted text' 2>/dev/null
+#include c144.sh
+test done "$@" then awk readonly 'quoted text' ${HOME} 'quoted text'
+		| && local x=1 "$@" "$@" then done -eu 'quoted text' local 'quoted text' done local
+		"$1" cd done then | "$1"
+	local /usr/bin --verbose printf "$@" local test x=1
+| sed 2>/dev/null cd | local | grep test sed ${HOME} test echo
+&& cd local $(pwd) cd ${HOME} grep ${HOME} export
+then printf local "$1" export grep --verbose
+	done x=1 $(pwd) -eu test && local cd
+	"$@" -eu test ${HOME} -eu grep ${HOME} "$@" 2>/dev/null awk readonly
+	cd echo $(pwd) awk done && grep | readonly
+	| && readonly "$1" printf done --verbose && readonly done "$1" printf "$1"
+	export x=1 test grep --verbose then 'quoted text'
+		-eu done --verbose 'quoted text' --verbose "$1" ${HOME} "$1" then x=1
+		awk "$@" -eu "$@" local x=1
+	then "$1" printf cd then
+	awk printf export sed export 'quoted text'
+	--verbose 2>/dev/null test x=1 | ${HOME} sed echo awk then -eu grep printf
+		"$1" then echo done sed ${HOME}
+local readonly 'quoted text' sed -eu grep
+		local awk grep sed awk grep export sed --verbose x=1 && grep
+"$@" --verbose | ${HOME} echo "$1" "$1" "$@" -eu done test "$1" test
+	/usr/bin cd then readonly local test echo done test
+done readonly awk | && done &&
+		test 2>/dev/null /usr/bin done test "$@" printf export /usr/bin
+	${HOME} test 'quoted text' echo grep "$@" export
+	"$@" | cd -eu then x=1 local ${HOME} echo "$1" export done "$@" ${HOME} ${HOME}
+	readonly "$1" sed && ${HOME} "$@" --verbose /usr/bin export
+	&& awk "$@" then local printf cd done sed 'quoted text'
+export ${HOME} local awk x=1 ${HOME} "$@" grep --verbose awk x=1 $(pwd) cd grep
+		$(pwd) test 'quoted text' test 2>/dev/null
+	awk "$1" cd "$1" done then local printf x=1 "$1" local sed x=1
+		2>/dev/null sed echo x=1 printf cd cd sed echo $(pwd) "$1" local "$@" 'quoted text'
+	sed x=1 done --verbose 'quoted text' awk
+		--verbose /usr/bin $(pwd) ${HOME} 'quoted text'
+-eu $(pwd) 'quoted text' 'quoted text' x=1 --verbose
+		then /usr/bin then local done export then local --verbose "$1" echo grep
+${HOME} ${HOME} sed echo echo grep "$1" "$1" test printf
+		cd | sed done done && grep 2>/dev/null then x=1 'quoted text'
+	"$@" echo -eu ${HOME} echo cd cd done | sed | --verbose readonly
+	| test done "$1" 'quoted text' cd "$@" done x=1
+		| "$@" /usr/bin ${HOME} "$@" | --verbose done ${HOME} -eu
+readonly readonly done "$1"
+	/usr/bin then -eu 2>/dev/null -eu awk
+		"$1" x=1 /usr/bin awk && $(pwd) printf awk "$1" ${HOME} then printf
+awk awk echo $(pwd) printf
+/usr/bin echo && sed cd --verbose cd x=1 readonly
+awk awk test ${HOME} readonly 2>/dev/null local sed
+$(pwd) then 2>/dev/null /usr/bin
+$(pwd) && ${HOME} --verbose printf $(pwd) export
+		| x=1 awk awk "$1" x=1 --verbose
+done readonly $(pwd) && ${HOME} test $(pwd) test awk --verbose
+	test readonly -eu --verbose echo readonly $(pwd) grep test readonly
+		"$1" $(pwd) local ${HOME} echo
+		&& then local 'quoted text' 2>/dev/null then printf $(pwd)
+		done echo -eu 'quoted text' readonly 2>/dev/null 2>/dev/null
+	$(pwd) "$@" x=1 done --verbose printf 2>/dev/null done x=1 /usr/bin
+		-eu then cd ${HOME} $(pwd) export $(pwd) --verbose --verbose
+	2>/dev/null && $(pwd) cd
+then local --verbose 2>/dev/null | then --verbose test local export then
+		"$1" 'quoted text' export
+		awk --verbose 2>/dev/null "$1" test && done 2>/dev/null | grep cd && ${HOME}
+		| "$1" 2>/dev/null | --verbose /usr/bin && export cd 2>/dev/null
+		awk | $(pwd) | echo grep done 2>/dev/null sed sed local x=1 x=1 ${HOME} "$@" export
+local local local export cd && test cd
+export echo -eu -eu | --verbose /usr/bin test sed
+	cd printf 'quoted text' grep done test test readonly echo sed "$@" then x=1 x=1
+	"$@" local "$@" grep && done "$1" grep "$1" done
+	&& 2>/dev/null awk sed /usr/bin /usr/bin done -eu
+	cd cd done && echo | 2>/dev/null /usr/bin echo local printf ${HOME} then
+"$@" -eu "$1" /usr/bin --verbose
+then awk local --verbose "$1" --verbose "$@"
+		$(pwd) x=1 printf echo grep sed cd cd x=1 ${HOME} echo --verbose x=1 sed
+		"$1" x=1 x=1 sed -eu test x=1 grep 'quoted text' x=1 echo local
+	| readonly echo -eu ${HOME} awk
+	"$@" 2>/dev/null x=1 2>/dev/null local cd awk export
+$(pwd) $(pwd) echo && awk echo printf 2>/dev/null grep $(pwd) 2>/dev/null
+		sed grep sed printf -eu test local done printf | && /usr/bin 'quoted text'
+	export cd "$@" echo test
+	| awk awk && -eu -eu -eu
+$(pwd) done 2>/dev/null x=1 /usr/bin local | | awk export cd readonly
+	2>/dev/null cd $(pwd) $(pwd) $(pwd) "$@" "$1" x=1 "$@" "$1" $(pwd) cd grep
+		cd printf 'quoted text' "$@" $(pwd) --verbose "$@" 'quoted text'
+${HOME} sed grep echo then
+export cd && x=1 -eu -eu 2>/dev/null && | x=1 | export
+2>/dev/null done readonly then $(pwd) printf awk -eu done && done | sed |
+		then awk "$@" 2>/dev/null export done && test
+	local done awk test "$1" then
+		--verbose 'quoted text' /usr/bin done | test readonly "$1" "$1" &&
+	then ${HOME} 2>/dev/null local
+		local then /usr/bin cd sed printf | local grep | /usr/bin then
+	printf test $(pwd) test x=1 cd
+"$1" 'quoted text' awk --verbose 2>/dev/null "$1" test 2>/dev/null 'quoted text'
+	sed readonly cd local sed export
+	printf "$1" cd --verbose cd
+test sed local grep awk
+	$(pwd) /usr/bin test sed printf export sed done grep
+		/usr/bin /usr/bin export printf awk | ${HOME} && -eu readonly
+	${HOME} -eu -eu && test grep --verbose && local readonly /usr/bin --verbose -eu
+2>/dev/null "$@" && grep $(pwd) &&
+		"$1" /usr/bin awk x=1 grep readonly ${HOME} 2>/dev/null "$@"
+$(pwd) then echo export | 'quoted text'
+	sed then "$@" && "$@" readonly
+	$(pwd) local then test then then 'quoted text'
+	cd | then x=1 grep grep x=1 "$@" 'quoted text' echo |
+awk $(pwd) awk sed export local -eu done sed done done 'quoted text' export
+	awk $(pwd) local echo "$1" && "$@" 2>/dev/null cd
+	export export 'quoted text'
+	&& $(pwd) -eu /usr/bin printf --verbose
+local $(pwd) printf 'quoted text' awk "$@" "$1" readonly
+&& grep done 'quoted text' "$@" -eu test 2>/dev/null $(pwd)
+'quoted text' | test export echo readonly cd 'quoted text' ${HOME}
+	&& local --verbose sed grep then "$@" printf 'quoted text'
+	echo cd | test -eu --verbose local 2>/dev/null 2>/dev/null ${HOME} /usr/bin
+		| | local 2>/dev/null 'quoted text' sed printf test
+		2>/dev/null test printf
+done export sed 'quoted text' awk ${HOME}
+	2>/dev/null done $(pwd) $(pwd) x=1 test echo awk done 'quoted text' echo
+readonly echo readonly | test done 2>/dev/null /usr/bin
+	cd sed "$1" cd -eu sed 'quoted text' export grep local grep readonly
+		cd x=1 "$1" cd echo export -eu echo 'quoted text' x=1 done ${HOME} "$1"
+grep "$@" local export && echo "$1" -eu && local
+	x=1 export export printf echo | readonly echo x=1
+		done awk "$1" test readonly $(pwd) ${HOME} 'quoted text' cd 2>/dev/null
+| done "$1" cd readonly then test 2>/dev/null
+		x=1 export "$@" 2>/dev/null sed cd readonly | /usr/bin
+		-eu export readonly export echo | $(pwd) ${HOME} 2>/dev/null
+		readonly ${HOME} --verbose sed echo x=1 printf cd sed --verbose
+| echo grep printf | $(pwd) cd printf test --verbose 2>/dev/null x=1 local "$@"
+"$1" printf echo --verbose awk done local | x=1 then local echo "$@"
+	| "$1" echo 'quoted text' x=1 && printf && local | ${HOME} then
+	"$@" export sed x=1 local "$1" printf test
+printf awk 'quoted text' test
+		--verbose | sed ${HOME} test sed /usr/bin grep "$1" echo awk --verbose
+		x=1 /usr/bin && cd -eu
+	echo echo x=1 | --verbose
+	readonly test test readonly echo
+	cd export -eu ${HOME} grep x=1
+		printf echo "$1" "$@" ${HOME} && export export done
+export readonly -eu echo $(pwd) ${HOME} 2>/dev/null cd -eu /usr/bin
+export printf "$@" echo echo ${HOME} ${HOME} sed
+		done sed done done | -eu 'quoted text' cd
+		"$@" | cd $(pwd) 2>/dev/null
+	x=1 sed test 2>/dev/null x=1 grep done /usr/bin ${HOME} 'quoted text' export
+	readonly /usr/bin readonly local awk awk $(pwd) printf sed done ${HOME} --verbose
+		$(pwd) grep sed x=1 sed readonly sed /usr/bin -eu
+2>/dev/null export printf export grep
+	"$1" then ${HOME} --verbose printf "$1" -eu && $(pwd) grep | | /usr/bin grep
+	printf /usr/bin test && grep awk grep /usr/bin | cd "$@" cd "$1" -eu cd "$1" echo
+		echo sed 'quoted text' && test x=1
+'quoted text' | awk grep | -eu printf
+--verbose printf then test sed -eu cd grep cd
+	$(pwd) ${HOME} sed done | awk readonly sed 'quoted text' "$@" $(pwd)
+done sed "$1" 2>/dev/null x=1 local printf | "$1" --verbose x=1 x=1 printf
+	then -eu ${HOME} /usr/bin /usr/bin $(pwd) export sed cd 'quoted text' /usr/bin
+		printf grep sed 2>/dev/null --verbose grep /usr/bin echo -eu && grep export readonly
+2>/dev/null "$@" /usr/bin --verbose
+	then grep /usr/bin x=1 --verbose printf
+		2>/dev/null --verbose then done $(pwd) test x=1 grep sed 2>/dev/null 'quoted text'
+		| done "$@" local printf sed "$1" sed readonly readonly -eu 'quoted text' printf
+printf sed grep sed "$@" "$1" $(pwd) printf grep "$@" printf
+		echo /usr/bin --verbose ${HOME} | $(pwd)
+readonly x=1 && | 'quoted text'
+/usr/bin sed test 'quoted text' local ${HOME} $(pwd) | readonly sed "$1"
+	--verbose echo x=1 && test echo export ${HOME} -eu done ${HOME} x=1 "$1" then
+$(pwd) 2>/dev/null "$@" echo awk
+'quoted text' -eu && ${HOME} echo x=1 grep x=1 readonly awk --verbose local test
+readonly 2>/dev/null "$1" $(pwd) ${HOME}
+--verbose /usr/bin x=1 "$@" test sed cd "$@" 2>/dev/null
+	test export readonly then "$@" echo export
+		printf test awk printf ${HOME} | readonly 2>/dev/null
+--verbose echo --verbose ${HOME} export test
+		/usr/bin 2>/dev/null 'quoted text' ${HOME} test $(pwd) awk --verbose local
+		-eu sed "$@" 'quoted text' --verbose export /usr/bin "$1" sed
+	&& /usr/bin && $(pwd) x=1 grep /usr/bin && echo cd test 2>/dev/null
+		${HOME} 'quoted text' awk then grep test local | --verbose
+		x=1 --verbose $(pwd) 2>/dev/null
+$(pwd) test 2>/dev/null "$@" test sed /usr/bin "$@" then
+done awk export export done readonly 2>/dev/null done sed ${HOME} test grep then
+/usr/bin /usr/bin 'quoted text' export "$@" --verbose --verbose
+cd $(pwd) "$1" | then sed --verbose
+	printf -eu x=1 && grep
+	2>/dev/null 2>/dev/null sed 'quoted text' /usr/bin printf
+&& test export done x=1 "$1" "$1" --verbose /usr/bin "$1" printf
+		printf $(pwd) readonly ${HOME} /usr/bin "$@" 2>/dev/null local "$@" then 2>/dev/null
+		sed export sed 'quoted text' echo $(pwd) cd "$1" local done grep ${HOME} && "$1"
+		readonly 2>/dev/null x=1 echo 2>/dev/null readonly then
+readonly /usr/bin "$1" "$@" && then ${HOME} readonly && x=1 $(pwd)
+	echo 'quoted text' done echo echo done done sed
+		printf grep test && -eu --verbose echo ${HOME} 'quoted text' && 2>/dev/null
+		awk $(pwd) sed sed 2>/dev/null 'quoted text' cd export $(pwd)
+printf x=1 then sed 2>/dev/null /usr/bin $(pwd) cd 2>/dev/null x=1
+		/usr/bin $(pwd) done readonly | x=1 x=1 sed 'quoted text' grep
+sed ${HOME} 2>/dev/null awk --verbose /usr/bin
+then /usr/bin 2>/dev/null awk readonly $(pwd) echo echo cd grep --verbose
+	echo "$@" done "$@" x=1 && cd ${HOME}
+grep "$@" local $(pwd) --verbose echo
+"$@" readonly grep then awk cd grep /usr/bin 2>/dev/null "$1"
+		done "$@" sed 2>/dev/null sed "$1" 2>/dev/null "$1" export printf
+		cd cd "$1" export "$@" readonly "$@" -eu grep | local /usr/bin grep
+		readonly /usr/bin && grep --verbose awk grep $(pwd) 2>/dev/null
+		local --verbose | test /usr/bin cd printf grep done done awk printf 2>/dev/null
+&& ${HOME} cd done done ${HOME} cd $(pwd) "$1" | test awk sed cd
+	export "$1" awk $(pwd) --verbose "$1" /usr/bin x=1 grep -eu &&
+export printf && --verbose grep grep local --verbose
+		$(pwd) export then ${HOME} readonly echo test sed
+readonly ${HOME} 2>/dev/null -eu "$@" x=1 x=1
+		'quoted text' ${HOME} "$@" "$1"
+	'quoted text' "$1" cd "$@" && $(pwd) "$1" done 2>/dev/null sed echo ${HOME} grep
+		--verbose && sed then "$1" $(pwd)
+		sed /usr/bin $(pwd) awk --verbose --verbose /usr/bin local sed cd printf
+	done "$1" echo 2>/dev/null
+		local 2>/dev/null /usr/bin done test export test ${HOME} --verbose
+awk --verbose 'quoted text' printf $(pwd) sed
+		done done grep then cd
+		echo printf awk local awk --verbose 2>/dev/null | "$@" then 'quoted text'
+	'quoted text' echo test -eu then ${HOME} --verbose
+	"$@" test ${HOME} x=1 |
+		-eu awk done printf "$@" export -eu 2>/dev/null /usr/bin sed "$@" | -eu done readonly
+	cd test echo x=1 local x=1
+		${HOME} readonly local printf
+printf --verbose --verbose grep 2>/dev/null then x=1 local -eu
+cd readonly then 'quoted text' export
+	--verbose printf && readonly /usr/bin --verbose readonly "$1" -eu
+	export cd sed $(pwd) then
+| done && printf export echo export printf --verbose grep "$@" echo
+'quoted text' 2>/dev/null local "$1" test printf "$@" 2>/dev/null
+grep | /usr/bin echo "$@" test | cd awk local -eu readonly test -eu
+	test 2>/dev/null done then 'quoted text'
+	| "$@" then then test -eu "$@" 2>/dev/null 'quoted text' --verbose grep /usr/bin
+		--verbose sed printf local /usr/bin
+		x=1 then sed test grep export done readonly sed "$@"
+		x=1 'quoted text' | readonly printf ${HOME} grep readonly
+	grep | 'quoted text' -eu sed
+	/usr/bin $(pwd) echo /usr/bin readonly 2>/dev/null 2>/dev/null then
+	sed done --verbose cd cd test -eu $(pwd) awk echo $(pwd) test grep
+		then 2>/dev/null x=1 /usr/bin && awk cd readonly
+	awk done test "$1" sed local
+'quoted text' awk -eu readonly x=1 "$@" export
+printf 'quoted text' awk echo && ${HOME} x=1 done 2>/dev/null test --verbose
+sed local --verbose /usr/bin test && test "$@" | done /usr/bin local
+	done "$1" 2>/dev/null --verbose awk -eu export sed ${HOME}
+-eu --verbose "$1" 'quoted text' "$1" 2>/dev/null
+		$(pwd) 2>/dev/null readonly grep done cd done $(pwd) local readonly
+'quoted text' grep | echo done | -eu awk --verbose --verbose grep ${HOME}
+awk grep grep done "$1" -eu grep -eu x=1 x=1 echo echo -eu 'quoted text' echo
+		then && 2>/dev/null x=1 done $(pwd) sed | --verbose /usr/bin "$@"
+		${HOME} -eu | readonly grep grep
+then cd cd awk $(pwd) awk x=1 printf export awk sed "$1" "$1" ${HOME} "$1"
+awk readonly awk | "$@" then readonly printf 'quoted text'
+		&& then "$1" "$@" --verbose export local readonly then export
+	/usr/bin --verbose echo awk cd then done 'quoted text' sed
+	${HOME} --verbose && "$@" | readonly export -eu local | then
+'quoted text' awk echo awk x=1 cd && ${HOME} awk --verbose
+		printf then /usr/bin grep "$1" local --verbose $(pwd)
+		"$@" export grep | export then awk readonly export
+		${HOME} ${HOME} --verbose /usr/bin awk printf readonly printf local
+	cd grep export done --verbose export -eu /usr/bin test 2>/dev/null $(pwd) /usr/bin
+--verbose echo $(pwd) 'quoted text' test x=1 then | $(pwd)
+		done export 'quoted text' awk | /usr/bin $(pwd) cd
+-eu test --verbose test /usr/bin $(pwd) awk x=1 grep test 2>/dev/null sed printf
+done ${HOME} /usr/bin "$@" | && "$1" "$@" readonly x=1 sed $(pwd)
+		sed | $(pwd) ${HOME} 'quoted text'
+	then $(pwd) cd /usr/bin "$@" --verbose printf x=1 ${HOME}
+	2>/dev/null && test x=1 sed 2>/dev/null
+awk $(pwd) grep awk ${HOME}
+	'quoted text' --verbose awk readonly
+	done --verbose --verbose readonly 'quoted text'
+x=1 $(pwd) x=1 grep grep sed
+		"$1" readonly $(pwd) awk echo cd export local --verbose "$1"
+then "$@" 2>/dev/null -eu cd grep awk
+	echo echo ${HOME} cd grep | | local done awk ${HOME} --verbose
+		sed | test readonly ${HOME} && && /usr/bin
+		"$1" readonly ${HOME} ${HOME} --verbose
+		grep test "$@" --verbose --verbose
+then done readonly "$1" grep $(pwd) done --verbose printf cd done -eu grep done
+		awk x=1 then readonly x=1 | 'quoted text' && && awk ${HOME} awk echo
+		then printf grep echo test $(pwd) test 'quoted text' $(pwd)
+	"$@" cd --verbose echo grep export 2>/dev/null 2>/dev/null
+	test --verbose readonly test $(pwd)
+		readonly export test --verbose sed grep |
+/usr/bin then && x=1 printf echo awk $(pwd) local echo grep printf awk
+&& 2>/dev/null then grep echo printf printf ${HOME} && $(pwd) "$@" $(pwd)
+		readonly ${HOME} grep | then export ${HOME} grep && | readonly
+		"$@" cd echo "$1" $(pwd) local --verbose
+local printf then $(pwd) x=1 echo "$1" cd $(pwd) test done readonly
+grep test test echo export -eu "$1" /usr/bin readonly done
+		sed echo && then | x=1 --verbose printf cd echo done
+$(pwd) sed then echo $(pwd) grep readonly
+		"$1" | local "$1" done awk 'quoted text'
+	then 2>/dev/null "$@" x=1
+		readonly 'quoted text' then "$@" $(pwd) sed sed readonly
+	x=1 then local $(pwd) --verbose && x=1 grep readonly
+	printf done test printf echo printf
+		"$@" test | "$1" -eu ${HOME} awk done
+		test echo "$@" then x=1 -eu "$1" && 2>/dev/null 'quoted text' --verbose
+cd --verbose -eu "$@" readonly | "$@" 2>/dev/null
+	$(pwd) local printf awk cd local --verbose "$@" x=1 grep | --verbose
+		export "$@" -eu 'quoted text' sed -eu 'quoted text' then local cd cd && readonly
+sed printf done printf
+	| test --verbose done printf 2>/dev/null
+		$(pwd) sed -eu -eu cd awk done && 'quoted text' ${HOME} then x=1
+printf | 'quoted text' awk && export echo awk sed echo ${HOME} echo
+${HOME} local local done $(pwd) cd &&
+-eu -eu ${HOME} "$@" $(pwd) $(pwd) readonly
+		export awk done local ${HOME} 2>/dev/null done x=1 grep --verbose "$@"
+	export 'quoted text' cd -eu then 2>/dev/null "$@" echo | done x=1
+	/usr/bin awk x=1 "$1" "$1"
+		$(pwd) then sed ${HOME} sed 2>/dev/null
+export -eu sed "$1" awk sed sed sed /usr/bin done local "$@" --verbose
+		printf export --verbose grep
+then ${HOME} ${HOME} "$1" echo sed done 2>/dev/null
+	"$1" echo done $(pwd) done then $(pwd) done
+		| ${HOME} cd echo then 'quoted text'
+	test readonly --verbose readonly 'quoted text' sed export awk then grep "$1"
+${HOME} done readonly export 2>/dev/null |
+	/usr/bin && echo test x=1 done done | $(pwd) grep export && "$@" $(pwd)
+/usr/bin "$1" cd awk 'quoted text' local done "$@" then printf && $(pwd)
+	printf && | cd 'quoted text'
+--verbose 'quoted text' local "$1" then 'quoted text' cd awk
+sed --verbose | export --verbose test ${HOME}
+	&& "$@" --verbose --verbose readonly
+echo | done --verbose echo export |
+--verbose ${HOME} "$@" done cd then export
+		grep export --verbose --verbose awk readonly 2>/dev/null readonly readonly
+local ${HOME} sed ${HOME} awk "$1" then done -eu readonly readonly ${HOME} echo
+test && local sed /usr/bin
+$(pwd) grep test | then echo grep 'quoted text' "$@" ${HOME}
+	/usr/bin x=1 sed grep && "$@" 'quoted text' awk 2>/dev/null
+		&& done 'quoted text' 'quoted text' $(pwd)
+	$(pwd) echo "$@" 2>/dev/null
+${HOME} grep | awk cd "$@"
+2>/dev/null local awk | --verbose 'quoted text' "$@" 2>/dev/null
+	| | 'quoted text' test printf "$@" grep done $(pwd) /usr/bin $(pwd) export
+x=1 -eu "$@" $(pwd) export local && "$1" then readonly 'quoted text' 2>/dev/null
+then 'quoted text' export echo readonly -eu /usr/bin grep --verbose
+		done /usr/bin && local x=1 then $(pwd) readonly && local && awk
+"$1" printf done --verbose sed x=1 test | $(pwd) | |
+		2>/dev/null grep readonly
+		/usr/bin | test awk "$@" 2>/dev/null test --verbose && printf 'quoted text'
+awk done then 'quoted text' local printf sed && local then /usr/bin 'quoted text'
+		cd x=1 /usr/bin "$@" then test sed ${HOME} cd "$1" awk sed /usr/bin "$@"
+printf then ${HOME} "$@" -eu $(pwd) 2>/dev/null echo 2>/dev/null
+$(pwd) cd $(pwd) /usr/bin 2>/dev/null
+awk readonly awk test $(pwd) ${HOME} "$@" done then readonly
+	printf awk sed && test echo grep "$1"
+		/usr/bin printf awk test && readonly "$1" | "$1" --verbose && ${HOME} export
+done /usr/bin sed $(pwd) cd local done echo test --verbose
+		grep -eu | /usr/bin --verbose | done 'quoted text' $(pwd) export 2>/dev/null
+		test x=1 2>/dev/null -eu "$1" -eu
+	sed /usr/bin echo "$1" echo
+		$(pwd) --verbose /usr/bin "$@" | printf | local x=1 && /usr/bin x=1 x=1 sed -eu
+	2>/dev/null $(pwd) | /usr/bin --verbose
+		cd test "$1" export ${HOME} awk --verbose 'quoted text' sed cd
+"$1" awk x=1 cd 'quoted text' "$@" x=1 readonly then test "$@" printf
+		readonly done awk --verbose local "$@" "$@" printf
+		printf done 'quoted text' export 2>/dev/null then cd sed then then
+		--verbose printf done awk then cd 2>/dev/null "$1" grep | cd awk x=1 &&
+/usr/bin done | --verbose
+		readonly /usr/bin $(pwd) x=1
+	grep local -eu "$@" /usr/bin then printf
+		local awk 'quoted text' ${HOME} echo 'quoted text' 2>/dev/null --verbose 2>/dev/null
+		| then done done echo
+awk export --verbose grep | awk
+| printf printf --verbose | ${HOME} x=1 x=1 export echo &&
+grep ${HOME} 2>/dev/null
+		grep done --verbose printf local 2>/dev/null echo -eu /usr/bin --verbose test 'quoted text'
+	"$1" test | ${HOME} | then x=1 $(pwd) echo awk cd x=1
+		done /usr/bin "$@" printf then then done && then sed --verbose "$1"
+		2>/dev/null export -eu export printf --verbose export
+	"$@" /usr/bin 'quoted text' $(pwd) then ${HOME} readonly "$@" cd cd grep awk
+		/usr/bin "$1" local && local
+then 'quoted text' --verbose
+	$(pwd) "$1" echo x=1 && awk readonly printf printf sed | 2>/dev/null /usr/bin "$@"
+	| awk readonly cd "$@" x=1 done export grep readonly export local readonly --verbose
+	sed "$1" 'quoted text' -eu sed 2>/dev/null
+		awk 2>/dev/null test awk then 'quoted text' --verbose --verbose -eu $(pwd)
+		awk $(pwd) grep sed 2>/dev/null
+	${HOME} readonly "$1" readonly 2>/dev/null "$1"
+		echo ${HOME} 'quoted text' -eu ${HOME} 'quoted text' echo "$@" -eu
+&& printf x=1 echo && then x=1 'quoted text' "$1" /usr/bin --verbose grep
+		"$1" /usr/bin x=1 /usr/bin $(pwd) "$1" readonly |
+		$(pwd) readonly awk done test | --verbose
+		"$@" cd "$@" /usr/bin "$1" | $(pwd) "$1" /usr/bin
+		| 'quoted text' then "$1" -eu printf ${HOME}
+test "$1" 2>/dev/null $(pwd) "$@" then cd readonly "$@" ${HOME} | local
+cd grep -eu sed /usr/bin done done | test $(pwd) export awk -eu grep readonly
+	echo test | sed --verbose export then echo grep
+		then local x=1 "$@" readonly awk printf --verbose then cd "$1" 2>/dev/null /usr/bin
+		done printf && && --verbose --verbose -eu $(pwd) | 'quoted text' cd local x=1 2>/dev/null
+| sed done then --verbose test /usr/bin awk --verbose
+	"$1" x=1 readonly grep printf /usr/bin /usr/bin printf
+	-eu done 2>/dev/null sed
+'quoted text' 'quoted text'
+		sed grep x=1 printf | cd awk awk
+	local 2>/dev/null && local "$@" && && /usr/bin x=1 'quoted text' x=1 "$@"
+	echo cd grep --verbose x=1 2>/dev/null export done export
+cd 2>/dev/null done test "$@" done |
+cd cd test "$@" readonly $(pwd) printf /usr/bin 2>/dev/null
+	2>/dev/null export x=1 awk --verbose -eu 2>/dev/null awk then readonly echo -eu
+sed grep && sed then "$1"
+	done && $(pwd) x=1 --verbose $(pwd)
+2>/dev/null printf --verbose | sed "$1" ${HOME} $(pwd) done | then test sed
+	-eu 2>/dev/null x=1 "$1" && then "$@" local export
+| "$@" && done x=1 2>/dev/null ${HOME} -eu grep
+		x=1 sed sed done ${HOME}
+	--verbose grep -eu done /usr/bin local local --verbose "$@" /usr/bin ${HOME}
+		"$@" then && echo grep readonly then echo cd x=1 readonly sed "$1" && cd "$@"
+		2>/dev/null $(pwd) cd cd local test | && echo
+	"$1" --verbose 'quoted text' export sed "$@" sed echo test done local then
+	2>/dev/null sed 'quoted text' --verbose 'quoted text' awk sed export local
+		sed echo awk echo done test /usr/bin echo local
+x=1 echo printf | | test | printf ${HOME} | | sed then sed
+	/usr/bin x=1 /usr/bin ${HOME} readonly cd $(pwd) /usr/bin
+	"$1" local printf x=1 done grep export /usr/bin $(pwd) $(pwd) ${HOME}
+local local "$@" 2>/dev/null
+'quoted text' echo && --verbose readonly 2>/dev/null
+		--verbose && done && --verbose local sed x=1 x=1 sed
+	export $(pwd) grep /usr/bin local 2>/dev/null sed test export
+done /usr/bin && 'quoted text' && awk --verbose
+		cd -eu ${HOME} sed export --verbose printf then export /usr/bin awk "$@"
+--verbose echo "$1" test --verbose awk --verbose cd sed cd "$1" local -eu
+		"$@" && test 'quoted text' "$1" && && sed
+then export "$1" "$1" test test -eu done cd then done /usr/bin
+		grep echo cd --verbose $(pwd) x=1
+		$(pwd) then && grep then
+	readonly | "$1" "$@" test awk --verbose
+		&& sed printf readonly x=1 2>/dev/null 2>/dev/null then grep export done 'quoted text'
+--verbose /usr/bin cd && export printf then test "$1" local
+		"$1" x=1 $(pwd) grep 'quoted text' sed grep readonly then 'quoted text' then export
+readonly grep -eu printf cd echo printf test x=1 then -eu readonly 'quoted text'
+		echo grep done /usr/bin $(pwd) 2>/dev/null
+sed then x=1 'quoted text' readonly done --verbose cd
+	--verbose --verbose then ${HOME} sed /usr/bin
+		| ${HOME} "$@" printf test x=1 x=1 printf local sed /usr/bin export
+		'quoted text' /usr/bin test sed then echo 'quoted text'
+	${HOME} x=1 && /usr/bin sed ${HOME}
+		2>/dev/null printf | x=1 && -eu /usr/bin
+grep local sed then readonly sed /usr/bin /usr/bin 2>/dev/null 'quoted text' 2>/dev/null
+		sed -eu grep sed 2>/dev/null "$@" /usr/bin "$1" "$@" done
+"$@" 'quoted text' && 'quoted text' readonly sed /usr/bin x=1 --verbose local
+done $(pwd) "$@" local ${HOME} export --verbose
+readonly /usr/bin -eu 2>/dev/null export | ${HOME} 2>/dev/null
+	&& 2>/dev/null "$1" "$@" ${HOME} ${HOME}
+sed readonly awk 'quoted text' 2>/dev/null "$1" --verbose -eu x=1 then local
+		| -eu sed 'quoted text' | 2>/dev/null done test $(pwd) ${HOME} sed
+awk grep ${HOME} -eu /usr/bin echo local $(pwd) x=1 sed -eu test -eu cd
+		readonly $(pwd) done $(pwd) test then x=1 cd -eu "$1" grep
+		readonly 'quoted text' done "$@"
+cd local 'quoted text' cd 2>/dev/null
+cd awk && 2>/dev/null readonly -eu awk
+'quoted text' /usr/bin -eu /usr/bin done
+	x=1 -eu --verbose export 2>/dev/null "$@"
+		$(pwd) --verbose awk $(pwd)
+	-eu sed readonly printf "$1" then then
+	awk "$@" cd ${HOME} /usr/bin 2>/dev/null | echo /usr/bin
+-eu export && readonly
+	printf "$@" local awk | 'quoted text' $(pwd) readonly
+		sed "$@" grep done test local test $(pwd) |
+	'quoted text' ${HOME} | 'quoted text' /usr/bin "$1" $(pwd) "$@"
+		done echo printf awk readonly sed $(pwd) 'quoted text' done
+readonly done $(pwd)
+	2>/dev/null "$1" --verbose printf 2>/dev/null
+2>/dev/null echo "$@" -eu sed echo test printf export
+| test && then --verbose grep ${HOME} --verbose 'quoted text'
+		awk local -eu echo test printf cd sed echo "$@" $(pwd)
+	sed $(pwd) printf sed test sed printf then
+		"$@" ${HOME} export readonly done sed sed "$1" 'quoted text'
+		"$1" local && "$@" printf
+/usr/bin | 2>/dev/null then ${HOME} ${HOME} $(pwd)
+$(pwd) test "$1" grep then && "$@"
+echo $(pwd) then export 2>/dev/null ${HOME}
+"$1" /usr/bin echo ${HOME} | x=1 "$@" then done
+	"$@" "$1" x=1 2>/dev/null && ${HOME} sed --verbose ${HOME}
+then printf export -eu 'quoted text' awk -eu local echo grep 'quoted text' test
+	local local && export $(pwd) ${HOME}
+| 2>/dev/null /usr/bin 'quoted text' -eu
+printf | "$@" printf ${HOME} cd then sed printf && -eu --verbose
+grep echo local grep x=1 then export "$1" -eu echo printf
+	grep x=1 2>/dev/null cd cd readonly printf awk x=1 test export
+	then echo && awk "$@" done --verbose readonly export --verbose ${HOME} | -eu
+| test "$1" grep printf | echo test readonly test --verbose x=1 readonly
+'quoted text' awk && $(pwd)
+printf /usr/bin echo then
+		"$@" ${HOME} --verbose x=1 awk
+	echo readonly sed echo sed done | --verbose "$1" ${HOME} grep "$1" printf x=1 /usr/bin
+printf -eu | x=1 awk 'quoted text' $(pwd) "$@" test
+	--verbose -eu local cd && 'quoted text' /usr/bin
+		done cd export ${HOME} sed --verbose x=1 cd export done "$1"
+| printf then then cd
+	'quoted text' "$1" /usr/bin
+	readonly -eu done printf $(pwd) /usr/bin cd x=1 &&
+	/usr/bin test | -eu readonly ${HOME} 2>/dev/null && -eu cd $(pwd) done
+	export sed grep 'quoted text' local awk cd
+	${HOME} printf x=1 "$@" grep printf /usr/bin "$@" then $(pwd) 2>/dev/null awk
+/usr/bin then printf then readonly ${HOME} 2>/dev/null
+		$(pwd) "$@" awk --verbose
+| done --verbose readonly readonly done
+		cd 2>/dev/null test echo "$@" done | sed $(pwd) local sed "$1" $(pwd)
+printf done 2>/dev/null /usr/bin
+		"$1" local /usr/bin echo && then awk export /usr/bin -eu local 2>/dev/null cd 2>/dev/null
+	&& -eu echo cd && readonly
+	done 'quoted text' 2>/dev/null echo | readonly --verbose
+	local "$1" "$@" readonly --verbose "$1" local
+	awk grep /usr/bin --verbose "$@" printf local local then 2>/dev/null "$@"
+	then local 'quoted text'
+		&& printf test ${HOME} printf "$1" grep printf done
+		${HOME} 2>/dev/null -eu
+| $(pwd) cd readonly grep
+	--verbose /usr/bin local && grep cd 'quoted text' /usr/bin local |
+"$@" grep 'quoted text' done then "$@"
+	grep x=1 'quoted text' grep printf export cd printf readonly "$@" -eu $(pwd) then
+		'quoted text' cd grep test --verbose test readonly -eu
+	printf && local x=1 $(pwd) ${HOME} 'quoted text' 'quoted text' -eu $(pwd) awk
+	&& 2>/dev/null /usr/bin local test "$1" echo echo echo "$@" awk done $(pwd) 'quoted text'
+awk printf then /usr/bin 'quoted text' local then done grep cd "$1" printf
+cd grep done 2>/dev/null done 2>/dev/null "$1" sed "$1"
+	--verbose test ${HOME} sed cd x=1 "$1" printf
+		"$1" $(pwd) ${HOME} ${HOME} && -eu test ${HOME} awk echo x=1 awk | x=1 /usr/bin
+	${HOME} /usr/bin $(pwd) test $(pwd) sed
+		'quoted text' | "$1" cd export grep printf 'quoted text' | --verbose
+echo --verbose then 2>/dev/null readonly sed 2>/dev/null
+		&& done then 2>/dev/null 2>/dev/null
+--verbose -eu ${HOME} 'quoted text' /usr/bin "$@" then grep cd
+		printf ${HOME} 2>/dev/null printf done | echo
+export --verbose "$1" x=1 sed --verbose echo "$@" --verbose
+		done test 2>/dev/null x=1 2>/dev/null 'quoted text' -eu ${HOME}
+'quoted text' export 'quoted text' ${HOME} "$1" 2>/dev/null
+	echo $(pwd) echo then export "$1" readonly readonly
+	export readonly /usr/bin "$@" && /usr/bin printf export /usr/bin grep
+2>/dev/null test test local local test --verbose | && awk sed printf $(pwd) --verbose
+		"$1" grep "$@" "$1" x=1
+	x=1 local && echo -eu done sed 'quoted text' "$@" x=1 local
+		cd 2>/dev/null cd 2>/dev/null
+test --verbose test test "$@" sed done readonly && done
+	awk | printf 2>/dev/null grep
+2>/dev/null "$1" test ${HOME} grep "$1" echo export
+test ${HOME} grep --verbose "$@" "$@" ${HOME} test | echo 'quoted text' sed &&
+	grep --verbose local
+		--verbose "$@" ${HOME} grep ${HOME} -eu --verbose ${HOME} -eu -eu export test cd
+		/usr/bin export printf
+		readonly done | test grep then grep 2>/dev/null cd local x=1 "$1" -eu
+	awk ${HOME} --verbose readonly
+export then | "$1" grep x=1 test done x=1 sed printf grep --verbose x=1 cd
+	"$1" | 'quoted text' awk test test readonly grep 'quoted text' --verbose export
+	| /usr/bin $(pwd) x=1 grep -eu $(pwd) then ${HOME} x=1 then readonly
+	awk local && $(pwd) --verbose | x=1 cd awk done /usr/bin | test 'quoted text'
+${HOME} "$@" readonly test 'quoted text' grep local && awk "$@" echo
+2>/dev/null ${HOME} readonly 'quoted text' && $(pwd) echo 'quoted text'
+		-eu $(pwd) "$@" cd $(pwd) /usr/bin test --verbose && && printf && "$1" awk
+awk sed 'quoted text' x=1 'quoted text' ${HOME}
+then export /usr/bin echo "$@" ${HOME} echo printf --verbose local local
+		&& | $(pwd) -eu local | export test grep /usr/bin
+		echo 'quoted text' sed cd export /usr/bin then x=1
+		echo 'quoted text' export /usr/bin
+done test x=1 done echo && 2>/dev/null && -eu 'quoted text' -eu grep export
+	export readonly local readonly "$1"
+		/usr/bin --verbose $(pwd) "$1" echo awk done export echo --verbose | --verbose
+grep $(pwd) then ${HOME} sed $(pwd) printf awk
+		-eu then echo 'quoted text' 'quoted text' echo export
+		| then awk && ${HOME} then done /usr/bin
+		"$1" -eu export x=1 awk test printf
+sed readonly cd cd echo 2>/dev/null
+x=1 printf test ${HOME} --verbose then /usr/bin grep local
+awk export sed export | "$1" test then $(pwd) ${HOME} then cd
+		export awk printf x=1 -eu grep readonly done grep
+		grep awk grep $(pwd) 'quoted text' readonly /usr/bin sed 2>/dev/null
+readonly export test "$@" then ${HOME} grep local x=1 local
+		grep --verbose then test "$@" 2>/dev/null echo && local "$@" awk
+		-eu cd 'quoted text' $(pwd) 2>/dev/null
+		/usr/bin | then "$@" awk then --verbose -eu $(pwd) cd test echo ${HOME}
+		&& 'quoted text' local $(pwd)
+		'quoted text' echo --verbose sed $(pwd) local "$1" then x=1 test printf /usr/bin
+	${HOME} cd done -eu test | cd echo sed done cd
+		"$1" "$1" --verbose test awk then printf && && readonly test sed "$@" 'quoted text'
+	${HOME} local --verbose | echo printf then ${HOME} $(pwd) 2>/dev/null
+		/usr/bin /usr/bin readonly --verbose awk echo sed $(pwd) then --verbose
+"$1" "$1" $(pwd) sed printf 'quoted text' awk then --verbose test printf --verbose
+		then | $(pwd) export export 2>/dev/null --verbose "$1"
+	readonly export /usr/bin | "$@" 2>/dev/null
+--verbose ${HOME} "$@" then then
+done /usr/bin export grep /usr/bin && "$@" readonly 2>/dev/null
+		readonly cd local -eu done sed local "$@"
+	echo local cd -eu local "$1" local
+		'quoted text' awk --verbose export 2>/dev/null /usr/bin /usr/bin
+2>/dev/null test grep -eu cd echo "$@" 'quoted text'
+	$(pwd) | && $(pwd) sed local cd /usr/bin readonly -eu | --verbose
+	--verbose grep cd then echo -eu $(pwd) && 2>/dev/null awk --verbose
+	local grep readonly 'quoted text' done $(pwd) cd
+		/usr/bin --verbose "$@" export x=1 then sed done ${HOME} readonly
+"$1" readonly "$1" export grep printf test test cd printf 2>/dev/null 2>/dev/null
+then --verbose done --verbose sed done
+	$(pwd) 2>/dev/null $(pwd) && "$@" local done sed
+readonly 2>/dev/null grep printf "$@" -eu export --verbose
+		-eu && grep grep grep /usr/bin
+		/usr/bin --verbose readonly local then done awk -eu readonly x=1 done -eu
+| 2>/dev/null export then x=1 cd ${HOME} -eu $(pwd) --verbose printf
+	2>/dev/null 2>/dev/null x=1 -eu readonly 2>/dev/null echo
+	'quoted text' done local ${HOME} echo echo ${HOME}
+	done | echo done sed /usr/bin 2>/dev/null echo | printf
+		"$@" 2>/dev/null -eu 'quoted text' awk 2>/dev/null export && $(pwd) cd
+	local "$1" /usr/bin ${HOME} --verbose sed sed
+export -eu awk sed cd 2>/dev/null 'quoted text'
+		sed | test export 2>/dev/null x=1
+		echo done then -eu local | echo "$1"
+	x=1 readonly local echo readonly done cd
+	/usr/bin export --verbose local ${HOME} x=1 "$@" awk sed then export "$1" local
+echo --verbose then test sed readonly grep 'quoted text' grep
+	test awk readonly readonly | 'quoted text'
+--verbose local | grep done "$@" readonly
+test export test sed /usr/bin local $(pwd) && local | $(pwd) 'quoted text'
+${HOME} -eu /usr/bin local /usr/bin then
+		'quoted text' /usr/bin echo
+| x=1 done "$@" 'quoted text' "$1" readonly
+&& 'quoted text' | -eu export echo export && grep
+	"$1" x=1 $(pwd) awk x=1 grep | printf
+		readonly "$@" "$@" && local then --verbose
+	2>/dev/null printf ${HOME} |
+x=1 "$1" $(pwd) --verbose sed "$@" ${HOME} export
+'quoted text' $(pwd) awk "$@" 2>/dev/null printf x=1 "$1" "$@" then "$@" -eu
+		-eu $(pwd) --verbose $(pwd) then
+	&& ${HOME} "$@" done | cd local $(pwd) x=1 local 2>/dev/null
+local && ${HOME} local 2>/dev/null
+	echo sed sed 2>/dev/null x=1 x=1 done ${HOME} /usr/bin | sed grep local
+	"$1" "$1" readonly -eu | awk "$1" $(pwd) readonly | readonly cd --verbose
+		grep then export ${HOME} local
+		then grep --verbose && export done -eu cd done --verbose
+| /usr/bin && done ${HOME} sed $(pwd) sed done -eu ${HOME}
+${HOME} ${HOME} then "$@" 'quoted text'
+	echo local done done x=1 export /usr/bin printf
+	awk | $(pwd) 'quoted text' "$1" $(pwd) readonly then grep -eu done -eu then grep
+		readonly 2>/dev/null ${HOME}
+cd "$@" cd then | printf grep 2>/dev/null -eu -eu ${HOME} printf
+then | && | -eu export /usr/bin x=1 'quoted text' local
+x=1 | $(pwd) -eu done export -eu "$1" 'quoted text'
+	then "$1" awk --verbose readonly $(pwd)
+		"$1" local ${HOME} "$@" "$1" /usr/bin printf "$@" test
+&& "$@" echo done 'quoted text' then test /usr/bin "$@"
+		'quoted text' ${HOME} && -eu local 'quoted text' ${HOME} awk test
+/usr/bin awk done export "$1" grep $(pwd)
+--verbose -eu grep cd ${HOME} done
+	readonly then "$1" test local readonly --verbose
+	| --verbose awk echo /usr/bin grep readonly cd /usr/bin x=1 cd 2>/dev/null grep
+		grep ${HOME} cd 'quoted text' x=1 'quoted text'
+	&& -eu then 'quoted text' --verbose echo then && printf
+		local && echo 2>/dev/null x=1 'quoted text'
+		local && readonly local awk --verbose export cd --verbose
+	/usr/bin awk export export test 'quoted text'
+	grep --verbose cd cd
+		then printf 2>/dev/null $(pwd) 'quoted text'
+	printf -eu "$1" | --verbose "$@" && export then |
+		/usr/bin && local awk $(pwd) -eu local local /usr/bin sed
+&& echo test "$@" awk x=1 $(pwd)
+	then "$1" readonly grep cd awk done cd "$1"
+		readonly readonly grep --verbose --verbose $(pwd) cd 'quoted text'
+x=1 awk | printf ${HOME} cd 'quoted text' --verbose 2>/dev/null awk
+		x=1 printf test local && "$1" cd 2>/dev/null
+&& 'quoted text' ${HOME} /usr/bin 2>/dev/null
+		-eu sed echo "$1" grep grep $(pwd) sed echo && x=1 cd x=1 local ${HOME} test
+then printf export grep | 'quoted text' "$@" "$@" "$1" && awk | "$@" | cd done printf
+grep -eu $(pwd) | local readonly test -eu awk
+		'quoted text' "$1" x=1 awk export echo
+	awk then test then sed x=1 test 'quoted text' 'quoted text'
+		2>/dev/null test grep readonly test x=1 test --verbose 2>/dev/null
+x=1 cd export grep $(pwd) | printf /usr/bin
+	$(pwd) printf && x=1 readonly && grep local readonly "$@" local then test
+	sed local cd export ${HOME} -eu
+echo && readonly export ${HOME} sed cd
+	test sed /usr/bin ${HOME} echo local done printf -eu "$1" --verbose
+		/usr/bin && --verbose export readonly x=1
+	x=1 then awk then sed x=1
+	test 'quoted text' 'quoted text' local
+	x=1 && echo x=1 readonly
+	${HOME} "$1" test done cd then $(pwd) test awk "$@" sed &&
+		sed local printf cd echo sed "$@"
+	-eu ${HOME} $(pwd) "$1" awk local "$1" export ${HOME} echo && test
+		awk echo printf cd readonly grep done --verbose "$1" /usr/bin test cd $(pwd)
+		'quoted text' test 'quoted text'
+printf done "$1" | "$@"
+-eu | echo grep printf printf "$@" x=1 local "$@" --verbose
+		awk local export && test $(pwd) -eu done sed done 'quoted text'
+-eu 'quoted text' sed awk grep echo grep -eu "$@" 2>/dev/null sed done ${HOME}
+	/usr/bin && readonly readonly --verbose
+	-eu then readonly "$1" done printf 2>/dev/null export x=1 local
+	-eu done readonly /usr/bin
+	then sed then --verbose 2>/dev/null awk sed test && test local --verbose
+readonly readonly "$1" 'quoted text' x=1 then -eu readonly ${HOME} done x=1
+&& printf -eu printf test sed 'quoted text' awk "$1" printf | --verbose
+printf printf x=1 local done ${HOME} done "$1" $(pwd)
+	local printf 2>/dev/null $(pwd) && | test test local && printf x=1
+		test x=1 done /usr/bin done "$@" $(pwd)
+		then cd then done local 'quoted text' test /usr/bin test | "$@" awk grep
+		printf "$1" --verbose done local done printf x=1 "$@" && 'quoted text' done
+'quoted text' /usr/bin grep grep ${HOME} echo "$1" readonly grep | "$@"
+	grep cd | "$1" "$1" cd done 2>/dev/null 2>/dev/null
+		echo "$@" done readonly
+'quoted text' 2>/dev/null then "$1" --verbose local then readonly -eu sed
+		/usr/bin grep awk cd export cd "$1" then && 2>/dev/null
+		| 2>/dev/null sed --verbose 2>/dev/null $(pwd)
+		sed x=1 && echo $(pwd) "$@" readonly && readonly
+		| 'quoted text' "$@" && grep | then done --verbose
+	cd $(pwd) --verbose "$@" grep awk export readonly sed -eu grep 2>/dev/null
+readonly then x=1 printf &&
+	cd "$@" "$@" 2>/dev/null done done sed awk x=1 printf | | cd readonly
+	| cd "$1" grep 'quoted text'
+	then cd -eu 'quoted text'
+		awk then x=1 /usr/bin grep test --verbose echo cd grep awk then sed --verbose
+	/usr/bin printf | export cd local done -eu | printf done | "$1" "$1"
+	/usr/bin sed /usr/bin sed
+		cd cd printf --verbose
+		--verbose awk sed then $(pwd) local 2>/dev/null test 2>/dev/null test
+		done -eu x=1 $(pwd) test local export printf cd awk readonly
+	grep $(pwd) -eu export cd x=1 --verbose then x=1 then readonly --verbose local
+		grep grep -eu && ${HOME} "$@" ${HOME} | cd | awk echo echo
+		$(pwd) | && 2>/dev/null | local
+	/usr/bin -eu ${HOME} ${HOME} /usr/bin x=1 2>/dev/null /usr/bin awk readonly
+local cd $(pwd) "$@" ${HOME} -eu $(pwd) echo
+		'quoted text' export printf
+		${HOME} sed $(pwd) /usr/bin | 2>/dev/null
+	&& $(pwd) cd ${HOME} && done
+	'quoted text' readonly
+	"$1" local then $(pwd) echo test cd local
+		cd x=1 echo --verbose sed $(pwd) echo printf ${HOME} ${HOME} then "$@"
+local /usr/bin x=1 readonly
+echo sed readonly "$1" printf test export awk
+	readonly "$@" readonly 'quoted text'
+	--verbose ${HOME} 'quoted text'
+2>/dev/null then printf export $(pwd) 'quoted text' awk && "$1"
+&& local 'quoted text' -eu --verbose awk printf
+	printf "$1" 2>/dev/null x=1 test /usr/bin 2>/dev/null awk printf "$1" "$1"
+		export test readonly grep /usr/bin readonly done echo readonly local &&
+		-eu -eu | -eu grep x=1 | done grep printf local grep $(pwd) /usr/bin --verbose
+x=1 grep local sed -eu echo /usr/bin
+		printf -eu | awk printf | --verbose 'quoted text' awk test
+&& done readonly ${HOME} echo printf
+	local ${HOME} "$@" 2>/dev/null 'quoted text' | test
+	export test "$1" | --verbose test 'quoted text'
+"$@" grep echo test -eu $(pwd)
+test $(pwd) "$1" export readonly
+		--verbose printf then /usr/bin x=1 ${HOME} done grep echo 2>/dev/null -eu $(pwd)
+	/usr/bin "$1" sed cd then 'quoted text' echo printf sed
+	cd 'quoted text' -eu cd "$1" done cd 2>/dev/null $(pwd) $(pwd) cd "$@"
+		-eu then sed 2>/dev/null 2>/dev/null grep
+	&& done "$@" "$@" printf 'quoted text'
+	local --verbose cd "$@" /usr/bin $(pwd) awk
+	| done /usr/bin $(pwd) done "$@" test 2>/dev/null -eu
+		| test 'quoted text' ${HOME} "$1" cd then done local 2>/dev/null local
+		$(pwd) x=1 local test awk test "$@"
+		-eu then "$1" cd readonly 'quoted text' printf | then | "$@" "$1" --verbose
+-eu "$1" -eu grep 'quoted text' test printf readonly "$1" cd ${HOME} ${HOME}
+		2>/dev/null grep | 'quoted text' --verbose export "$@" export $(pwd) echo
+	cd x=1 ${HOME} test sed
+		awk readonly then ${HOME} 'quoted text' done 'quoted text' x=1 then
+	--verbose awk $(pwd) "$@" echo printf
+| export readonly sed printf done then "$@" grep
+	&& && then readonly export "$1" done sed | awk 'quoted text'
+		| test grep 2>/dev/null --verbose echo -eu done done
+readonly echo test "$1" grep export 2>/dev/null
+		'quoted text' readonly done --verbose grep /usr/bin
+readonly readonly readonly $(pwd) --verbose
+local awk then done -eu --verbose -eu export "$1"
+	grep && grep local echo export export done -eu /usr/bin cd cd printf
+		sed cd "$1" /usr/bin "$@" local grep 'quoted text' "$1"
+	sed ${HOME} /usr/bin echo 2>/dev/null | then "$1" "$@" export
+	/usr/bin awk 'quoted text' local awk ${HOME} "$1"
+		-eu awk echo | printf "$1" -eu "$1"
+x=1 && /usr/bin test /usr/bin export | ${HOME} && grep ${HOME} $(pwd) "$1" readonly
+	'quoted text' grep readonly "$1" | --verbose done printf 'quoted text'
+x=1 then done && test then awk local && printf sed grep
+printf cd grep ${HOME} | "$@"
+| "$1" printf "$@" then x=1 grep grep --verbose x=1 &&
+		then cd 'quoted text' sed --verbose | done -eu /usr/bin
+	then $(pwd) 2>/dev/null readonly echo printf $(pwd) local -eu "$1" -eu export
+"$@" test printf printf "$1" local "$@" echo "$1" -eu /usr/bin && -eu sed
+2>/dev/null done /usr/bin ${HOME} | local --verbose
+		done sed awk "$@" grep sed awk "$@" then && readonly printf x=1 test local awk
+		cd 'quoted text' --verbose 2>/dev/null printf done test export
+		sed 2>/dev/null 2>/dev/null --verbose local awk --verbose
+		readonly printf test local readonly
+		then ${HOME} $(pwd) export ${HOME} echo 'quoted text' export echo "$1" readonly
+	grep x=1 sed echo --verbose then /usr/bin
+		'quoted text' --verbose local x=1 "$@" cd x=1 test ${HOME}
+	then echo test ${HOME} 2>/dev/null cd test echo done
+		| 'quoted text' readonly | "$@"
+	then 2>/dev/null test test awk grep local $(pwd) x=1 export -eu printf echo echo
+		&& -eu local printf readonly awk && ${HOME} x=1 export $(pwd) x=1 done
+	done cd done export readonly 'quoted text' x=1 readonly |
+	2>/dev/null "$@" $(pwd) printf | printf
+		| test --verbose sed 'quoted text' echo ${HOME} grep x=1 -eu
+"$@" -eu then 'quoted text'
+		printf sed test export printf printf
+	| local test x=1 export
+	| && grep printf $(pwd) ${HOME} readonly cd "$1" sed -eu && sed cd "$1"
+	--verbose grep then echo sed 'quoted text'
+		readonly -eu export ${HOME}
+		"$1" test done 'quoted text' echo /usr/bin "$1" local export awk --verbose
+&& --verbose grep ${HOME} then done sed printf printf printf
+	-eu test x=1 && /usr/bin 'quoted text' 'quoted text' printf
+		2>/dev/null 'quoted text' 2>/dev/null printf && cd sed done $(pwd) 'quoted text'
+"$1" 2>/dev/null 'quoted text' cd
+		export printf | done cd
+	$(pwd) "$@" && awk printf done cd awk
+	local ${HOME} local 2>/dev/null 2>/dev/null test
+cd grep export "$1" 2>/dev/null
+"$@" readonly printf $(pwd)
+	| then /usr/bin echo done "$1" "$@" sed "$@" && readonly readonly
+	done 'quoted text' "$@" export "$1" && 2>/dev/null /usr/bin 2>/dev/null
+	grep $(pwd) x=1 $(pwd) cd
+		local /usr/bin --verbose && sed local done sed
+sed echo sed x=1 printf | 'quoted text'
+		test /usr/bin "$1" readonly x=1 $(pwd) x=1 /usr/bin && "$@"
+done done echo grep 2>/dev/null
+		| /usr/bin awk && sed 'quoted text'
+		cd "$1" printf cd done -eu grep
+	readonly 'quoted text' --verbose "$@" 'quoted text' "$@"
+		"$@" done awk "$@" 2>/dev/null test done | echo done && ${HOME}
+		then test && 2>/dev/null local sed -eu export --verbose "$@" ${HOME} -eu
+		readonly cd --verbose test -eu ${HOME} 2>/dev/null
+		"$@" test x=1 2>/dev/null local
+		"$1" && "$1" then -eu ${HOME} ${HOME} "$@" 'quoted text'
+	printf done grep sed sed 'quoted text' "$1" -eu /usr/bin sed local && echo
+	x=1 "$@" x=1 cd awk 'quoted text'
+		"$@" done export && $(pwd) -eu --verbose "$@" 'quoted text' 2>/dev/null
+readonly cd printf test
+	echo export "$1" grep then printf 2>/dev/null
+		done -eu | -eu x=1 awk export 'quoted text' export local $(pwd) cd cd /usr/bin
+export test | 2>/dev/null $(pwd) "$@" -eu --verbose sed cd /usr/bin
+	readonly | cd export test 2>/dev/null cd export x=1 export
+		"$@" --verbose "$1" "$@" "$@" printf 'quoted text' "$1" -eu done -eu ${HOME} "$1"
+		then sed then local 'quoted text'
+	2>/dev/null ${HOME} && $(pwd) x=1 printf | "$1" awk | local 2>/dev/null
+&& -eu --verbose -eu x=1 echo
+| cd "$@" echo cd "$1" "$@" "$@" x=1 then test "$1" -eu
+printf sed $(pwd) sed | --verbose cd 2>/dev/null ${HOME} test --verbose done "$@"
+done 'quoted text' 2>/dev/null sed -eu test grep --verbose $(pwd) /usr/bin x=1
+		then sed readonly echo -eu
+		$(pwd) test awk $(pwd) echo
+		then x=1 /usr/bin echo "$@" printf
+${HOME} && echo awk awk $(pwd)
+	cd && /usr/bin readonly
+		/usr/bin "$1" x=1 grep awk -eu readonly | awk 2>/dev/null
+${HOME} | x=1 x=1 /usr/bin 'quoted text' /usr/bin -eu test
+$(pwd) grep && then --verbose printf grep -eu done 'quoted text'
+${HOME} "$1" done export test 2>/dev/null
+		"$@" grep printf 2>/dev/null readonly x=1 then printf "$@"
+	-eu x=1 echo grep done $(pwd) $(pwd) grep printf export then && && --verbose
+	"$1" "$@" 'quoted text' && export printf "$1" -eu readonly ${HOME}
+	2>/dev/null ${HOME} | x=1 sed "$@" ${HOME} grep && done export
+--verbose local printf && then local --verbose
+local 'quoted text' readonly then -eu test done -eu "$1" -eu -eu --verbose
+	done x=1 readonly 'quoted text'
+x=1 "$@" readonly "$1" done readonly printf then --verbose |
+		'quoted text' /usr/bin printf x=1 "$1" then $(pwd) | /usr/bin ${HOME}
+grep -eu sed ${HOME} --verbose awk awk "$@"
+		&& "$@" -eu --verbose /usr/bin cd /usr/bin -eu cd ${HOME} awk done ${HOME}
+sed export | 'quoted text' --verbose $(pwd) -eu
+--verbose test && /usr/bin awk "$1" printf grep
+sed sed | sed $(pwd) 'quoted text' printf sed
+	--verbose x=1 -eu | $(pwd) | printf printf
+readonly /usr/bin -eu readonly && "$1" ${HOME} /usr/bin | 'quoted text'
+/usr/bin && x=1 -eu export && "$@" "$1" grep then "$@" -eu done
+		test sed -eu then printf done sed "$@"
+then grep 2>/dev/null awk grep cd --verbose -eu export -eu cd ${HOME} sed | echo
+		/usr/bin -eu 'quoted text' "$1" echo export printf test x=1 --verbose 'quoted text'
+"$1" test 2>/dev/null
+		${HOME} cd 'quoted text' "$1" /usr/bin awk 2>/dev/null sed grep sed
+	/usr/bin ${HOME} cd export x=1 done
+		x=1 | 2>/dev/null --verbose readonly cd "$@"
+		export awk "$@" export local awk /usr/bin
+		$(pwd) 2>/dev/null done then --verbose test done grep && ${HOME} done $(pwd)
+	grep | export && -eu export "$@" | grep
+	'quoted text' grep --verbose echo echo -eu local -eu readonly sed local
+		printf -eu 2>/dev/null | test 2>/dev/null sed sed
+	echo done local && x=1 test $(pwd) echo then cd done printf
+		| printf 'quoted text' ${HOME} -eu /usr/bin | sed 2>/dev/null && then grep
+	sed printf /usr/bin 'quoted text'
+cd /usr/bin local && grep readonly 'quoted text'
+test cd "$1" readonly echo ${HOME}
+awk 'quoted text' sed ${HOME}
+-eu cd && 2>/dev/null /usr/bin printf test ${HOME} "$1" grep readonly x=1
+		local /usr/bin 'quoted text'
+		local "$@" then 'quoted text'
+	"$@" cd ${HOME} readonly echo "$@" printf cd cd local 2>/dev/null
+'quoted text' $(pwd) export
+		"$1" test awk ${HOME} -eu "$@" then 'quoted text' /usr/bin test test $(pwd)
+		2>/dev/null local printf ${HOME} /usr/bin ${HOME} x=1 then "$@"
+		grep 'quoted text' done
+		cd cd -eu /usr/bin awk test awk local readonly 'quoted text' printf -eu sed
+	/usr/bin cd then awk local && readonly echo
+		"$@" export "$1" "$1" x=1 'quoted text' "$@" cd x=1
+		--verbose sed $(pwd) 'quoted text' x=1 x=1 && export
+		export then 'quoted text' grep readonly readonly
+		"$@" cd test local 'quoted text' "$@" "$1" then
+	test echo -eu grep | export sed | local done done "$@" | cd
+		cd ${HOME} test $(pwd) test grep readonly --verbose -eu cd x=1 sed readonly "$1"
+		local echo done "$1" test test grep ${HOME}
+	'quoted text' $(pwd) x=1 x=1 -eu done grep printf | readonly
+done done | --verbose -eu printf awk
+		done awk test grep then /usr/bin grep /usr/bin grep ${HOME} test $(pwd) && done
+grep local 'quoted text' "$1" /usr/bin | echo ${HOME} awk sed $(pwd) sed
+		local local -eu then awk awk printf done "$1" readonly $(pwd) | ${HOME}
+grep -eu then ${HOME} /usr/bin --verbose grep "$@" then export
+/usr/bin | x=1 sed /usr/bin
+| awk && --verbose /usr/bin x=1 2>/dev/null
+-eu 'quoted text' echo echo
+		--verbose readonly 2>/dev/null | 2>/dev/null 2>/dev/null "$@" --verbose
+	/usr/bin $(pwd) done -eu --verbose x=1 awk 2>/dev/null | grep ${HOME}
+		readonly echo done awk cd local then ${HOME} "$@"
+$(pwd) echo done && export then done /usr/bin | printf $(pwd) awk printf -eu sed
+		then "$1" grep -eu | "$@" readonly -eu 'quoted text'
+	$(pwd) ${HOME} grep -eu readonly readonly readonly
+cd done done /usr/bin
+		test echo --verbose done awk 'quoted text'
+	echo && /usr/bin test printf sed readonly then
+x=1 printf /usr/bin grep test --verbose
+cd sed | "$1" printf /usr/bin $(pwd) printf x=1 x=1 ${HOME} sed awk local /usr/bin
+echo /usr/bin "$@" local --verbose awk awk local /usr/bin local
+readonly x=1 "$@" "$@" done 2>/dev/null | 2>/dev/null 2>/dev/null test 'quoted text'
+"$1" local && export 2>/dev/null sed /usr/bin grep $(pwd) && readonly ${HOME}
+	--verbose cd export $(pwd) readonly 'quoted text' done
+		cd cd "$1" test x=1 cd cd sed done then | --verbose echo "$1" export
+done $(pwd) readonly local test
+	-eu 'quoted text' 2>/dev/null 2>/dev/null --verbose printf
+		grep echo --verbose test echo grep --verbose
+	readonly awk --verbose
+		cd awk 'quoted text' && local readonly
+"$@" sed cd readonly echo 2>/dev/null printf
+sed $(pwd) test readonly then
+	--verbose done | -eu sed 'quoted text' export --verbose done done
+		&& echo local ${HOME} echo readonly 'quoted text' echo export grep
+	$(pwd) local "$1" | | readonly echo --verbose -eu export
+	cd ${HOME} "$1" test | "$@" && /usr/bin sed sed
+		x=1 grep x=1 readonly && "$@"
+		"$1" local test printf export 2>/dev/null && 'quoted text' grep grep
+		'quoted text' local --verbose awk "$@" /usr/bin --verbose 'quoted text'
+	readonly $(pwd) x=1 "$1" $(pwd) echo local printf -eu 'quoted text' export /usr/bin
+	cd ${HOME} --verbose /usr/bin grep "$@" test grep x=1 2>/dev/null sed $(pwd)
+	$(pwd) sed cd echo grep export done
+-eu readonly echo awk local
+		done | /usr/bin 2>/dev/null test /usr/bin
+	"$1" then done --verbose awk -eu echo grep printf --verbose "$@" ${HOME}
+printf awk echo 2>/dev/null 2>/dev/null | echo "$1"
+		sed done /usr/bin then | readonly | test
+		x=1 awk echo test /usr/bin cd "$@"
+	then 2>/dev/null ${HOME} ${HOME} echo local echo readonly "$@" "$@" "$@"
+		2>/dev/null "$1" printf "$1"
+		-eu x=1 -eu -eu sed | grep local | ${HOME} local echo awk /usr/bin
+		local 2>/dev/null done |
+$(pwd) | "$1" then awk grep awk test $(pwd) printf 'quoted text'
+		export cd x=1 local $(pwd)
+	/usr/bin test awk readonly
+	&& 2>/dev/null --verbose 2>/dev/null -eu "$1" -eu --verbose
+	cd "$@" "$@" test grep $(pwd) -eu && readonly done ${HOME}
+		${HOME} 'quoted text' && echo && test
+awk 2>/dev/null /usr/bin readonly then printf
+then awk export export $(pwd) awk printf
+	local export "$1" 2>/dev/null ${HOME} local echo ${HOME}
+		local test 'quoted text' -eu then "$1" done && test cd
+'quoted text' "$@" ${HOME} readonly
+		${HOME} /usr/bin x=1 echo grep
+		export 'quoted text' | ${HOME} export /usr/bin --verbose
+		$(pwd) echo "$1" cd echo export | cd "$@" export grep -eu local "$1" && done
+	$(pwd) cd readonly awk --verbose echo 2>/dev/null cd printf
+done /usr/bin x=1 cd
+		/usr/bin x=1 /usr/bin local readonly && /usr/bin
+		'quoted text' sed sed x=1 x=1 export
+		export then | readonly export /usr/bin | then -eu sed 'quoted text'
+| grep "$1" /usr/bin printf sed 2>/dev/null local
+	local 'quoted text' "$1" 'quoted text' "$1" awk
+	local | test sed sed -eu readonly export
+	&& && cd sed local "$1" export --verbose then -eu x=1 grep awk test $(pwd) cd --verbose
+&& grep test echo ${HOME} | --verbose then -eu -eu && -eu
+	"$1" grep | export ${HOME} -eu test 'quoted text' printf
+	"$@" | 2>/dev/null && printf test local done $(pwd) echo then
+	/usr/bin | | "$@" then | export sed sed -eu local | x=1 test
+		/usr/bin $(pwd) export && --verbose "$@" done &&
+	test cd grep $(pwd) printf done -eu done $(pwd) readonly
+$(pwd) cd x=1 /usr/bin export ${HOME} "$@" awk sed --verbose "$1" done
+	done x=1 then test -eu && $(pwd) -eu $(pwd) && 'quoted text'
+	then -eu readonly $(pwd)
+	local then 'quoted text' test --verbose "$@" grep
+	done test cd done && $(pwd)
+		then done x=1 $(pwd) $(pwd) | export
+	export sed -eu local 'quoted text' echo "$1" export
+readonly | /usr/bin grep $(pwd)
+	${HOME} | && 2>/dev/null done export 2>/dev/null "$@" "$@" "$1" $(pwd)
+sed | && | /usr/bin awk -eu | cd
+&& $(pwd) readonly "$@" sed done -eu awk $(pwd) echo grep /usr/bin readonly
+		local readonly local && && /usr/bin --verbose --verbose
+| "$@" "$1" cd done --verbose
+	/usr/bin export cd echo "$@" sed | 2>/dev/null -eu "$1" 'quoted text' readonly
+		then "$@" done --verbose awk echo grep test 2>/dev/null awk export
+		export then done /usr/bin
+		| && "$1" ${HOME} echo awk grep cd grep test 2>/dev/null
+		"$1" grep /usr/bin readonly
+local export readonly local readonly done echo test 2>/dev/null
+		grep readonly && $(pwd) $(pwd) x=1 $(pwd) local
+	readonly grep ${HOME} local done
+		local test export done 2>/dev/null --verbose
+		$(pwd) "$@" ${HOME} echo echo done 'quoted text' x=1 awk x=1 "$1" /usr/bin
+	awk -eu local printf then x=1 export done cd
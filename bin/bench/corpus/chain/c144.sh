@@ -0,0 +1,2001 @@
+then grep "$1" /usr/bin grep | readonly test ${HOME} /usr/bin export printf | grep
+	x=1 ${HOME} /usr/bin /usr/bin echo printf $(pwd) --verbose grep "$@" grep "$@"
+		--verbose done local local /usr/bin
+		readonly then x=1 awk "$1" "$1" echo x=1 ${HOME} -eu -eu 2>/dev/null
+cd 2>/dev/null cd printf awk "$1" sed echo /usr/bin
+		"$1" --verbose then /usr/bin then 2>/dev/null cd echo | && "$1" | /usr/bin
+	then awk sed $(pwd) cd /usr/bin sed x=1
+		sed then "$1" then sed grep "$1" echo done /usr/bin 'quoted text'
+	/usr/bin && | readonly | "$1" done "$1" $(pwd) readonly test
+echo awk ${HOME} -eu export $(pwd) -eu "$@" 2>/dev/null 2>/dev/null
+	&& grep && printf cd /usr/bin export export sed grep | 'quoted text'
+readonly export -eu && readonly local readonly export
+		awk | ${HOME} awk "$1" sed /usr/bin readonly "$@"
+		-eu $(pwd) printf 2>/dev/null
+		export && $(pwd) grep then
+"$1" 'quoted text' cd /usr/bin "$@" "$1" -eu printf awk readonly printf ${HOME}
+		echo ${HOME} && 'quoted text' local 'quoted text' $(pwd) 2>/dev/null 'quoted text'
+	-eu local printf test
+		2>/dev/null --verbose x=1 "$1"
+	${HOME} x=1 2>/dev/null $(pwd)
+		"$@" printf done ${HOME} -eu done ${HOME} 2>/dev/null
+	printf --verbose $(pwd) 'quoted text'
+	local --verbose --verbose
+		| /usr/bin done awk done 'quoted text' --verbose
+		$(pwd) ${HOME} "$1" echo --verbose "$1" "$1" x=1 'quoted text'
+	$(pwd) cd done $(pwd) test /usr/bin awk ${HOME} && $(pwd)
+		"$@" echo grep /usr/bin x=1 sed cd local | test readonly awk 'quoted text' then
+		$(pwd) -eu 2>/dev/null echo /usr/bin
+		export --verbose x=1 "$@" "$@" x=1 awk readonly test local local printf $(pwd)
+		echo echo readonly /usr/bin then ${HOME}
+		sed "$1" done readonly grep awk "$@"
+grep /usr/bin then done --verbose
+"$1" "$@" echo $(pwd) grep $(pwd)
+	sed readonly --verbose x=1 --verbose 'quoted text' then | "$@" "$1"
+		&& ${HOME} $(pwd) printf test echo | -eu grep /usr/bin
+	'quoted text' /usr/bin 'quoted text'
+		'quoted text' $(pwd) then test /usr/bin sed
+test done local awk printf
+		cd then export && printf "$@" then --verbose
+cd /usr/bin printf ${HOME} --verbose && /usr/bin cd sed /usr/bin && ${HOME}
+		grep cd export && readonly 2>/dev/null
+	grep 'quoted text' && printf "$1" 'quoted text' /usr/bin
+--verbose | "$1" grep printf readonly
+		readonly x=1 then cd $(pwd) sed
+	'quoted text' readonly --verbose done -eu x=1 local "$@" 2>/dev/null done
+		$(pwd) | $(pwd) x=1 'quoted text' $(pwd) "$1" 2>/dev/null -eu test done export
+export test local test readonly 'quoted text' -eu
+test awk cd -eu then -eu --verbose grep --verbose 2>/dev/null cd printf echo
+&& "$1" printf export "$1" x=1 cd --verbose x=1 x=1 sed x=1 done cd
+		${HOME} then -eu "$1" -eu grep then then -eu
+done readonly cd then echo $(pwd) x=1 readonly "$@" test echo
+	$(pwd) test readonly readonly
+	-eu 2>/dev/null ${HOME} ${HOME} "$1" -eu $(pwd) "$1" readonly /usr/bin
+		"$@" cd grep done ${HOME} done "$@"
+	export -eu export | --verbose awk
+printf -eu $(pwd) done printf sed done ${HOME}
+		x=1 "$@" 'quoted text' done "$@" && test echo | /usr/bin
+	grep printf $(pwd) cd "$@" sed export 'quoted text'
+		${HOME} grep cd 2>/dev/null sed local | $(pwd) local -eu local export
+sed "$1" $(pwd) printf
+	-eu test grep readonly awk local export -eu done -eu local awk printf awk x=1
+		'quoted text' cd | 2>/dev/null "$1" "$@" sed awk "$1" done cd | ${HOME} |
+	x=1 printf "$1" echo --verbose "$1" cd then printf 'quoted text'
+	awk awk -eu ${HOME} export && sed readonly
+	then /usr/bin --verbose && printf && readonly $(pwd) done cd test
+	sed ${HOME} local "$@" awk | ${HOME} | 'quoted text' "$1" export echo ${HOME}
+grep $(pwd) then printf 2>/dev/null x=1 ${HOME}
+		cd printf "$1" 'quoted text' 2>/dev/null 'quoted text' cd "$1" export export
+grep /usr/bin $(pwd) x=1 ${HOME}
+		${HOME} | local sed then sed cd x=1 'quoted text'
+	done | x=1 awk 'quoted text' && test cd printf | awk grep sed local sed "$@"
+printf "$1" echo | echo | echo readonly test -eu | | export then export -eu
+"$1" grep 'quoted text'
+local printf "$@" | ${HOME} grep 'quoted text' "$1" && x=1 export
+		echo readonly | "$1" "$@" sed readonly sed && && 'quoted text'
+then && sed grep then then | local x=1 printf 'quoted text'
+| done "$@" echo sed sed --verbose | awk
+		"$@" 2>/dev/null cd printf local -eu done
+		&& 'quoted text' test local test 'quoted text' echo readonly echo ${HOME}
+		"$1" /usr/bin && readonly
+		export local 'quoted text' ${HOME}
+		local grep echo /usr/bin
+sed /usr/bin printf /usr/bin -eu "$1" awk "$1" done printf
+	2>/dev/null local readonly export cd grep x=1 grep "$@" ${HOME} "$1" printf
+cd echo grep $(pwd) printf
+	"$1" printf awk x=1 grep --verbose
+	$(pwd) done ${HOME} "$@"
+${HOME} | printf --verbose
+	$(pwd) printf | awk "$1"
+	2>/dev/null "$1" 2>/dev/null local "$1" printf
+	then 'quoted text' sed x=1 2>/dev/null ${HOME} -eu sed | 'quoted text'
+		grep "$1" /usr/bin 2>/dev/null grep done 2>/dev/null test
+		${HOME} "$1" /usr/bin done printf sed readonly | sed grep && echo
+	$(pwd) test test $(pwd) $(pwd) /usr/bin
+	readonly grep export | /usr/bin readonly --verbose done 2>/dev/null
+		"$1" readonly export -eu printf --verbose readonly 2>/dev/null grep readonly
+	--verbose printf grep "$@" 2>/dev/null
+${HOME} test 'quoted text'
+	/usr/bin /usr/bin readonly then x=1 export test x=1 readonly local x=1 x=1
+	printf echo 'quoted text' printf printf cd
+-eu awk sed awk export local "$@" printf "$@"
+cd echo -eu test printf echo && sed printf &&
+		echo $(pwd) | /usr/bin export "$@" done "$1" && -eu 'quoted text'
+2>/dev/null 2>/dev/null | printf export 'quoted text' test x=1
+	"$@" printf grep "$@" 2>/dev/null grep
+echo && | grep "$@" -eu "$1" -eu -eu --verbose
+$(pwd) | -eu cd /usr/bin done --verbose
+	'quoted text' "$@" && 2>/dev/null "$@" -eu then 'quoted text'
+		"$@" then 'quoted text' done "$1" local sed printf
+printf export test local echo &&
+		"$@" /usr/bin readonly "$@" then local ${HOME} /usr/bin x=1 awk
+test readonly ${HOME} ${HOME}
+	'quoted text' $(pwd) "$1" "$@" local --verbose -eu "$1" $(pwd)
+'quoted text' /usr/bin ${HOME} local cd printf | | --verbose
+cd "$@" --verbose 2>/dev/null echo then test ${HOME}
+'quoted text' -eu ${HOME} test grep
+		$(pwd) 'quoted text' test "$@" 'quoted text' 'quoted text' export grep readonly
+	x=1 /usr/bin done ${HOME} sed 2>/dev/null cd awk 2>/dev/null && 'quoted text'
+--verbose 'quoted text' "$@" printf -eu ${HOME} sed printf sed 2>/dev/null 2>/dev/null
+		&& then -eu 'quoted text' readonly $(pwd) $(pwd) printf
+		"$1" export "$@" readonly readonly export sed test cd then 2>/dev/null
+		grep sed 2>/dev/null -eu 2>/dev/null
+	cd 2>/dev/null -eu echo test 'quoted text' "$1" local 'quoted text'
+	awk /usr/bin export printf
+| echo x=1 grep /usr/bin -eu | 'quoted text'
+	readonly "$@" echo | $(pwd) local grep sed
+		test grep readonly --verbose grep ${HOME} && "$1" done | test -eu && 'quoted text'
+${HOME} $(pwd) sed then -eu && /usr/bin sed printf --verbose "$1"
+readonly "$@" /usr/bin local printf | printf x=1 'quoted text' grep "$1" sed then
+"$1" "$1" ${HOME} 'quoted text' cd sed local
+	x=1 grep readonly sed grep
+	echo echo local sed test echo $(pwd) grep x=1 | cd cd
+	cd 2>/dev/null readonly /usr/bin export x=1 --verbose ${HOME}
+		grep "$1" sed | local grep "$1" awk ${HOME} x=1 printf readonly local
+		awk /usr/bin printf export done -eu
+	echo printf done done $(pwd) "$1" $(pwd) && x=1 ${HOME} --verbose
+$(pwd) done sed ${HOME} test
+'quoted text' grep /usr/bin printf $(pwd) 'quoted text' && "$@" "$1"
+		$(pwd) printf local --verbose "$@" done $(pwd) then
+	| grep export then echo grep x=1 'quoted text' |
+		2>/dev/null cd echo /usr/bin "$1" done echo export
+| export cd --verbose && local $(pwd) | ${HOME} readonly readonly grep cd ${HOME}
+grep 'quoted text' cd done --verbose | export "$1"
+		&& ${HOME} local export printf 'quoted text' ${HOME} cd "$1" sed awk
+	awk && awk cd echo printf local | echo --verbose ${HOME} readonly sed | printf
+		printf test 2>/dev/null && then --verbose sed awk -eu
+	local test test echo && printf test
+"$1" ${HOME} -eu grep | then
+		cd echo 2>/dev/null done sed x=1 | awk | export 'quoted text' awk 2>/dev/null
+x=1 sed 2>/dev/null sed $(pwd) | then 'quoted text' /usr/bin readonly /usr/bin
+		&& $(pwd) test $(pwd) cd export sed ${HOME} ${HOME} "$1" | "$@"
+		export local printf readonly export 2>/dev/null cd awk --verbose export
+	| "$@" 2>/dev/null 'quoted text' --verbose ${HOME} "$@" sed then test echo
+	printf x=1 sed "$1" echo x=1 x=1 echo cd 'quoted text'
+		-eu x=1 grep 2>/dev/null ${HOME} printf awk ${HOME} "$1" ${HOME}
+	-eu x=1 cd | export sed && cd /usr/bin awk echo ${HOME} | /usr/bin grep sed cd
+	grep export ${HOME} awk awk echo printf "$@" sed awk
+local readonly echo 'quoted text' -eu echo awk done 'quoted text'
+cd done cd echo echo x=1 && x=1 /usr/bin x=1 printf
+| "$1" && "$1" done sed /usr/bin "$1" awk test awk "$1"
+&& "$@" printf | grep awk $(pwd) sed $(pwd) $(pwd) printf
+"$@" 2>/dev/null echo sed sed -eu -eu sed /usr/bin echo 2>/dev/null
+$(pwd) x=1 echo then local readonly 2>/dev/null ${HOME} "$1" sed /usr/bin
+		readonly test 2>/dev/null echo export 2>/dev/null 2>/dev/null
+"$@" "$1" x=1 "$1" export |
+	printf && awk /usr/bin --verbose --verbose echo test 2>/dev/null && cd echo -eu
+		"$1" awk | printf ${HOME} export "$@" | "$1"
+		cd "$1" done sed "$@" then "$@" "$@" test export --verbose printf test
+		| "$@" --verbose /usr/bin
+'quoted text' sed "$1" x=1 -eu done | && local 'quoted text' ${HOME} awk export
+	printf "$1" done awk 'quoted text'
+readonly 2>/dev/null "$@" cd readonly
+--verbose /usr/bin awk x=1 'quoted text' 2>/dev/null test
+	"$@" && cd done -eu awk
+		$(pwd) then then export printf sed ${HOME} 'quoted text' done "$1" ${HOME} --verbose
+	sed test /usr/bin cd readonly done $(pwd) | $(pwd) /usr/bin "$1" 'quoted text'
+		export sed | | then echo "$@" --verbose /usr/bin
+-eu awk sed | $(pwd) -eu -eu awk 2>/dev/null
+	sed done x=1 readonly sed x=1 2>/dev/null "$@" awk then done
+		readonly ${HOME} /usr/bin && -eu -eu
+	/usr/bin sed -eu -eu echo /usr/bin test | 2>/dev/null
+printf 2>/dev/null && -eu 'quoted text' ${HOME}
+		'quoted text' echo then ${HOME} -eu grep "$@" cd && sed "$1" 'quoted text'
+local done "$1" | test -eu done 'quoted text' local grep awk $(pwd) /usr/bin cd
+		"$@" local test | grep x=1 export done then awk test --verbose
+&& local /usr/bin ${HOME} echo cd grep local --verbose
+local printf local cd 2>/dev/null echo $(pwd) test 2>/dev/null 2>/dev/null x=1
+	-eu -eu readonly "$1" readonly cd test "$@" printf
+/usr/bin "$@" x=1 printf then export sed
+		done /usr/bin /usr/bin ${HOME} grep ${HOME} --verbose
+		cd export ${HOME} /usr/bin $(pwd) -eu cd -eu grep "$@" 2>/dev/null grep &&
+	2>/dev/null awk | sed done /usr/bin test cd then cd local then 2>/dev/null
+	readonly /usr/bin echo x=1 readonly printf && local x=1
+		--verbose | done 'quoted text' 'quoted text' &&
+		grep readonly grep echo "$@" /usr/bin then 2>/dev/null 'quoted text'
+		test printf x=1 "$@" sed 'quoted text' ${HOME} -eu awk ${HOME} sed ${HOME}
+	| /usr/bin 'quoted text' | | 'quoted text'
+		&& cd /usr/bin --verbose export $(pwd) | test "$@" test test cd printf
+	done echo cd --verbose 2>/dev/null sed && x=1 $(pwd) grep x=1
+	"$1" awk awk export readonly readonly local /usr/bin
+	sed ${HOME} grep echo done "$@" test local 2>/dev/null -eu
+	x=1 $(pwd) 2>/dev/null done export /usr/bin /usr/bin
+	sed readonly 'quoted text' awk "$@"
+		sed done then test ${HOME} && 'quoted text' --verbose
+	grep x=1 grep ${HOME} $(pwd) "$1" 'quoted text'
+-eu test x=1 then echo then printf test $(pwd) sed local awk -eu
+export 'quoted text' done $(pwd) x=1 test -eu done sed -eu cd echo
+echo echo done grep export local "$@" "$1" 'quoted text' && echo 'quoted text'
+'quoted text' ${HOME} printf printf --verbose
+done "$@" export echo 2>/dev/null
+		test --verbose sed 'quoted text' cd cd sed "$1" echo
+	printf x=1 2>/dev/null 2>/dev/null sed ${HOME} echo awk && $(pwd) -eu &&
+		--verbose test --verbose
+		awk sed x=1 sed readonly cd echo "$1" && export sed --verbose
+	cd then "$@" --verbose -eu sed x=1 -eu echo cd
+	"$1" x=1 ${HOME} -eu | echo awk ${HOME} cd done $(pwd) && then "$1" &&
+		${HOME} test grep done
+	printf cd grep test then export x=1 then echo 'quoted text'
+	local "$1" test done then /usr/bin export "$1" &&
+	then awk --verbose 'quoted text' test cd done echo test $(pwd) readonly
+	$(pwd) echo then | echo "$1" /usr/bin done | "$1" && printf test x=1 --verbose
+		--verbose test /usr/bin
+	/usr/bin "$1" -eu done
+	-eu 2>/dev/null local 'quoted text' export grep printf local
+echo awk x=1 then $(pwd) echo local local
+	&& "$@" export 'quoted text' printf echo
+| $(pwd) "$@" printf local && $(pwd) grep readonly --verbose echo x=1
+		then echo /usr/bin ${HOME} test "$1" ${HOME} 2>/dev/null cd echo
+echo sed grep 'quoted text' x=1 x=1 test $(pwd) printf echo
+2>/dev/null ${HOME} awk $(pwd) export test /usr/bin "$@" sed printf done
+&& 'quoted text' printf grep done then --verbose printf $(pwd)
+		export "$@" sed then local export
+	x=1 sed --verbose 2>/dev/null test then "$@" then 'quoted text' local -eu
+'quoted text' -eu | 2>/dev/null
+		"$1" local local | printf echo sed
+done | then export printf then printf printf readonly -eu 'quoted text'
+		then export "$1" then then
+	done export echo awk echo -eu 2>/dev/null x=1 then $(pwd) x=1 $(pwd) then "$1" 'quoted text'
+	awk 'quoted text' && export 'quoted text' | --verbose "$1" "$1"
+		${HOME} local | | readonly awk sed && awk && | sed cd
+'quoted text' printf && --verbose ${HOME} test &&
+	"$1" ${HOME} grep done /usr/bin ${HOME}
+2>/dev/null "$1" printf sed then -eu then ${HOME}
+	cd $(pwd) $(pwd) echo /usr/bin 2>/dev/null readonly && grep
+		-eu $(pwd) "$@" x=1 x=1 -eu readonly done grep --verbose cd
+		'quoted text' 'quoted text'
+	${HOME} $(pwd) cd 2>/dev/null readonly ${HOME} awk && $(pwd)
+	${HOME} /usr/bin | | printf echo | "$1" x=1 done x=1 echo test done test
+cd printf x=1 awk && awk "$@" sed "$1" ${HOME} export done cd /usr/bin
+		local && printf 2>/dev/null 2>/dev/null readonly x=1
+sed done ${HOME} export test printf
+		x=1 grep --verbose local "$@" sed
+		then ${HOME} grep cd "$1" -eu /usr/bin export echo
+		test 'quoted text' $(pwd) done 'quoted text' /usr/bin then done
+	cd 2>/dev/null awk ${HOME} done local sed x=1 then
+	"$1" cd --verbose test then 'quoted text'
+		"$1" | | | sed cd cd x=1 --verbose && | echo echo ${HOME} 2>/dev/null 'quoted text'
+printf && "$@" done && echo | printf -eu cd
+	local 'quoted text' test
+	x=1 sed $(pwd) grep local readonly ${HOME} readonly | --verbose grep 2>/dev/null
+	| awk printf then cd && /usr/bin && $(pwd) x=1 "$@"
+/usr/bin grep printf $(pwd) printf export /usr/bin
+	sed x=1 done readonly ${HOME} readonly 2>/dev/null local | grep sed "$@"
+	local 'quoted text' awk 2>/dev/null "$1" test done awk then 'quoted text'
+	sed cd "$1" 2>/dev/null --verbose printf 'quoted text' |
+	'quoted text' test | ${HOME} sed
+	echo cd --verbose cd cd awk awk x=1
+	x=1 cd awk -eu sed test sed readonly 2>/dev/null local readonly grep then done
+	"$1" cd grep "$@" /usr/bin printf done $(pwd) x=1 "$@" | -eu
+	echo && 2>/dev/null "$1" local printf
+		2>/dev/null 2>/dev/null "$1" | ${HOME} | echo && awk sed printf && done
+sed ${HOME} grep cd grep /usr/bin printf readonly x=1 sed -eu 'quoted text'
+		sed grep local test 2>/dev/null test printf
+'quoted text' done && --verbose echo /usr/bin /usr/bin readonly awk
+readonly grep local then | &&
+	sed then cd export 2>/dev/null
+readonly echo grep awk sed done | export $(pwd) -eu local
+/usr/bin grep grep /usr/bin awk echo test test | echo
+	test cd | awk 2>/dev/null sed test $(pwd) export /usr/bin | --verbose 2>/dev/null
+		-eu --verbose grep local | test --verbose
+	export x=1 echo --verbose "$@" readonly --verbose
+		2>/dev/null then "$@" printf export local awk test then /usr/bin echo $(pwd)
+"$1" readonly printf test local awk "$1" "$@" readonly x=1 $(pwd) test awk
+then x=1 grep x=1 'quoted text' echo 2>/dev/null && sed 2>/dev/null
+		then ${HOME} "$@" echo local ${HOME} | |
+		cd "$1" ${HOME} export 2>/dev/null cd awk "$@" echo $(pwd) cd ${HOME}
+	readonly sed awk test export | local "$@"
+		/usr/bin --verbose 'quoted text' $(pwd) echo cd grep printf
+awk /usr/bin export "$@" echo 2>/dev/null && then echo | export
+	${HOME} x=1 export && export
+${HOME} printf x=1 -eu sed "$1" echo | ${HOME} && | | 'quoted text' export
+${HOME} export export ${HOME} "$@" cd
+		"$1" readonly -eu "$@" printf | -eu /usr/bin then ${HOME} grep
+	-eu && then -eu "$1" /usr/bin &&
+		"$1" readonly --verbose readonly | $(pwd) /usr/bin readonly 'quoted text'
+x=1 done x=1 $(pwd) "$@" | awk local 'quoted text' ${HOME} readonly readonly
+		then local awk "$@" && cd awk echo $(pwd) printf 'quoted text' cd echo local
+		| "$1" "$1" echo printf test && "$1" cd && local -eu $(pwd) printf /usr/bin
+"$@" /usr/bin export 'quoted text' /usr/bin awk
+	x=1 "$@" "$1" x=1 "$1" ${HOME} printf
+		sed && "$@" export 'quoted text'
+x=1 export ${HOME} 2>/dev/null ${HOME} cd -eu "$@" /usr/bin echo $(pwd) cd test
+awk done printf export awk printf | printf cd readonly -eu readonly sed "$1"
+local sed $(pwd) local then
+		export done export grep awk 'quoted text' "$1"
+'quoted text' awk 2>/dev/null
+		"$@" cd 'quoted text' 2>/dev/null --verbose 2>/dev/null local
+	then awk 'quoted text' readonly then
+		then grep printf --verbose grep then cd export 2>/dev/null echo --verbose ${HOME}
+awk | | test readonly -eu ${HOME} cd sed echo $(pwd) /usr/bin printf echo sed
+	echo cd awk sed cd "$@" export grep done awk echo done 'quoted text' /usr/bin
+		| export && local awk --verbose sed done "$@" printf done $(pwd) grep readonly |
+then /usr/bin local ${HOME} $(pwd) | "$1" $(pwd)
+		export --verbose sed readonly awk -eu -eu done /usr/bin
+		local echo | then grep done
+	test -eu echo $(pwd) && awk local
+test | cd $(pwd) done test 2>/dev/null cd printf cd -eu echo /usr/bin
+	${HOME} --verbose 'quoted text' "$1" grep 2>/dev/null 'quoted text'
+	${HOME} 'quoted text' test done /usr/bin
+local export then printf cd done --verbose export test
+		echo --verbose grep $(pwd) "$@" && --verbose
+	-eu printf readonly cd done readonly 2>/dev/null --verbose local && ${HOME}
+	$(pwd) $(pwd) awk grep /usr/bin x=1 awk test awk -eu --verbose $(pwd) -eu grep
+"$@" && -eu /usr/bin 2>/dev/null $(pwd) -eu sed "$@" sed ${HOME} sed "$1" then
+	cd cd "$@" test --verbose $(pwd) test done /usr/bin printf test grep
+cd cd 2>/dev/null && "$@" x=1 test ${HOME} 'quoted text'
+${HOME} readonly | /usr/bin local 2>/dev/null test done && "$1"
+$(pwd) printf ${HOME} sed x=1 ${HOME}
+		export --verbose test --verbose echo local
+	test local && /usr/bin awk "$@" grep x=1 grep readonly done export
+		local 2>/dev/null awk x=1 cd | local --verbose /usr/bin
+cd x=1 "$@" 2>/dev/null local | && $(pwd) "$1" | /usr/bin printf local /usr/bin
+		then /usr/bin --verbose x=1 readonly $(pwd) ${HOME}
+		sed ${HOME} printf local cd sed /usr/bin
+	done done cd $(pwd) test
+	&& readonly "$@" "$@" awk then /usr/bin done
+test cd 'quoted text' grep then then /usr/bin /usr/bin && --verbose $(pwd)
+		readonly test x=1 then
+	| done "$1" sed echo "$@" --verbose $(pwd) grep "$1" -eu done test then "$1"
+	"$@" --verbose --verbose test export readonly readonly local
+		done "$1" then test | x=1 -eu 'quoted text'
+echo readonly /usr/bin grep "$1" x=1 'quoted text' --verbose ${HOME} &&
+--verbose -eu "$1" "$1" cd test printf x=1 export
+--verbose awk ${HOME} test cd && ${HOME}
+export test export $(pwd) --verbose cd && awk readonly done cd ${HOME} test
+		"$1" | "$1" done export sed sed 2>/dev/null |
+	'quoted text' cd 'quoted text' --verbose -eu -eu 'quoted text' export
+cd ${HOME} $(pwd) readonly readonly "$1"
+	echo x=1 then --verbose readonly awk awk --verbose $(pwd)
+	2>/dev/null grep awk cd --verbose test && sed ${HOME} printf printf 2>/dev/null
+	export sed local /usr/bin local export "$@"
+then local 'quoted text' -eu sed
+	printf echo export awk
+		"$@" -eu /usr/bin readonly awk x=1 grep 'quoted text' done 2>/dev/null
+		grep ${HOME} local echo sed $(pwd)
+then $(pwd) printf export local export grep "$@" && awk "$@" cd grep /usr/bin
+		export export /usr/bin --verbose -eu sed x=1 sed sed -eu awk
+${HOME} cd ${HOME} /usr/bin
+	test "$@" && --verbose -eu && then test -eu | -eu printf ${HOME} && printf -eu printf
+	/usr/bin "$@" $(pwd) printf test then 2>/dev/null grep readonly
+--verbose x=1 'quoted text' done && ${HOME} "$@" test x=1 /usr/bin
+	"$@" grep --verbose awk -eu
+	'quoted text' printf "$1" "$1" -eu x=1 "$@" sed x=1 export && cd | printf
+grep | awk 'quoted text'
+"$1" 2>/dev/null $(pwd) x=1
+cd 'quoted text' printf test
+cd $(pwd) awk /usr/bin done /usr/bin done cd -eu --verbose ${HOME} sed
+	test $(pwd) test echo "$1" 2>/dev/null ${HOME} | test grep
+	-eu "$1" export grep /usr/bin "$@" 'quoted text' sed sed --verbose
+	| export export echo --verbose test x=1 'quoted text' $(pwd)
+awk then then /usr/bin "$1" test /usr/bin
+"$@" grep readonly "$@" $(pwd) readonly "$1" done export ${HOME}
+	/usr/bin ${HOME} test awk awk then export 2>/dev/null echo readonly
+	x=1 done /usr/bin ${HOME} -eu export then export x=1 "$@" grep --verbose local
+	$(pwd) /usr/bin x=1 --verbose -eu /usr/bin grep --verbose printf
+	export grep 2>/dev/null
+		local then printf sed ${HOME} local
+		${HOME} "$1" $(pwd) then done export
+	"$1" | grep echo awk $(pwd)
+test then $(pwd) local test readonly $(pwd) grep x=1 /usr/bin sed "$1" test
+-eu test export $(pwd) readonly | /usr/bin then x=1 $(pwd) cd 2>/dev/null
+test export grep && ${HOME} "$@" 2>/dev/null cd done && echo export
+		awk echo echo /usr/bin sed test then done 'quoted text'
+		x=1 | 2>/dev/null ${HOME} grep printf && grep grep
+	"$1" readonly local readonly --verbose
+	printf then then "$1" grep "$1" "$1" "$1" --verbose
+		done | ${HOME} | $(pwd) export | "$1" then echo -eu test -eu 'quoted text'
+		| sed test 2>/dev/null $(pwd)
+	--verbose cd | "$1" echo $(pwd) test awk "$@" --verbose
+-eu export "$1" printf "$@" then 'quoted text'
+then cd then awk sed x=1 $(pwd) /usr/bin 2>/dev/null
+echo then echo /usr/bin printf local awk /usr/bin && /usr/bin && then export
+	then cd -eu cd ${HOME}
+echo /usr/bin readonly --verbose $(pwd)
+printf 'quoted text' readonly
+	test | 'quoted text' echo readonly awk -eu sed && 2>/dev/null
+		test 2>/dev/null sed test
+		| readonly && echo "$@" x=1 x=1 x=1 readonly cd cd ${HOME} 2>/dev/null then /usr/bin
+	export local ${HOME} awk | "$@" sed
+	${HOME} local "$@" printf 'quoted text'
+	cd 2>/dev/null x=1 local
+"$@" grep sed --verbose -eu done local x=1 grep grep ${HOME} 2>/dev/null done
+/usr/bin && "$@" ${HOME} "$@" cd local export x=1 ${HOME}
+awk -eu then | cd $(pwd) echo "$1" && ${HOME} then awk "$@" awk cd
+test awk readonly -eu cd $(pwd) --verbose
+		done ${HOME} ${HOME} ${HOME} x=1
+		local --verbose sed grep && export | awk --verbose
+		-eu done "$@" printf then | -eu readonly then test export ${HOME} ${HOME} "$@"
+"$@" "$@" --verbose "$@" cd "$@" -eu then
+	local /usr/bin -eu && cd "$1"
+$(pwd) ${HOME} echo local printf "$@" export awk | ${HOME} | readonly
+	${HOME} export readonly | export x=1 'quoted text' done $(pwd)
+		awk echo -eu done x=1 --verbose awk cd readonly
+	test cd done "$@" "$@" ${HOME} && local "$1" "$1" done | 'quoted text' local ${HOME}
+	sed -eu | grep ${HOME} "$1" |
+readonly "$1" cd | readonly &&
+		local export -eu awk -eu -eu 2>/dev/null
+| /usr/bin export printf printf printf -eu /usr/bin --verbose 2>/dev/null
+		printf done --verbose "$@"
+		--verbose sed ${HOME} awk test export "$1" "$1" sed then sed
+2>/dev/null readonly && 2>/dev/null "$1" "$1"
+		grep x=1 -eu sed echo grep "$@" && printf printf --verbose
+cd ${HOME} | && grep readonly readonly | 'quoted text'
+		readonly printf x=1 x=1 cd export /usr/bin cd test x=1 echo "$1"
+	grep ${HOME} | 'quoted text' local done -eu echo
+	then sed sed grep $(pwd)
+	x=1 grep then readonly 2>/dev/null --verbose local /usr/bin readonly test test
+		export done $(pwd) export
+'quoted text' export grep cd $(pwd) printf cd readonly local 'quoted text' readonly
+then 'quoted text' printf
+		awk then --verbose sed x=1 printf /usr/bin grep test
+sed 2>/dev/null echo cd | sed export export | printf echo && && "$@" x=1 -eu ${HOME}
+$(pwd) /usr/bin /usr/bin awk $(pwd) -eu /usr/bin
+/usr/bin $(pwd) then $(pwd) 'quoted text' awk
+	/usr/bin "$1" local test
+	then --verbose cd echo cd readonly 'quoted text' &&
+then awk sed $(pwd) | awk then done x=1 awk
+echo then then test -eu /usr/bin | test |
+		printf ${HOME} test && export -eu
+	&& x=1 awk x=1 "$@" sed "$@" grep $(pwd) awk then && /usr/bin
+	echo test grep local "$@" then done printf then then $(pwd) -eu readonly local
+		cd -eu "$1" && 2>/dev/null && printf sed "$1" "$1" "$@" grep | /usr/bin
+	/usr/bin grep test cd x=1 /usr/bin printf "$@" 2>/dev/null
+	export "$1" "$@" /usr/bin cd 'quoted text'
+-eu printf "$1" ${HOME} /usr/bin ${HOME}
+		"$@" 'quoted text' $(pwd) grep test test
+	$(pwd) grep local sed echo echo $(pwd) 'quoted text'
+local readonly readonly
+test $(pwd) sed export 2>/dev/null x=1
+		sed sed export cd echo awk echo export | | cd cd 'quoted text'
+$(pwd) $(pwd) printf done && local "$@" sed done
+		--verbose | echo local sed ${HOME} done then done printf
+${HOME} test echo $(pwd) grep echo echo cd "$@" "$@" "$1"
+	test grep awk | sed x=1 printf printf
+/usr/bin 'quoted text' sed
+		done echo 'quoted text' --verbose 2>/dev/null
+	| sed "$1" test done "$@" test sed | cd local
+/usr/bin ${HOME} local 2>/dev/null "$1" readonly done then awk local
+sed grep readonly 2>/dev/null
+$(pwd) ${HOME} "$1" 2>/dev/null $(pwd) "$1"
+&& printf ${HOME} && /usr/bin awk done && --verbose
+	echo -eu ${HOME} then ${HOME} $(pwd)
+		sed printf echo export -eu "$1"
+		"$@" cd printf && readonly
+cd 'quoted text' "$@" cd "$1" then local local readonly 'quoted text'
+	'quoted text' --verbose | readonly sed local && local 2>/dev/null readonly printf
+grep -eu ${HOME} then | printf test readonly echo test && | sed -eu 2>/dev/null
+		/usr/bin 2>/dev/null /usr/bin -eu
+/usr/bin --verbose echo sed printf done 'quoted text' | -eu | readonly
+		"$1" | -eu printf "$@" export test local && readonly 'quoted text'
+		-eu export then 'quoted text' awk --verbose ${HOME} sed -eu sed | 'quoted text'
+2>/dev/null export ${HOME} test grep 'quoted text' 2>/dev/null cd sed
+x=1 awk /usr/bin grep readonly
+-eu grep "$1" printf printf cd export -eu $(pwd) done --verbose
+$(pwd) "$1" export cd echo export
+$(pwd) 'quoted text' export then /usr/bin grep
+		export ${HOME} x=1 "$1" printf
+	awk "$1" export awk -eu printf
+	export --verbose export 'quoted text' cd x=1 && then
+	"$1" export 2>/dev/null 2>/dev/null 'quoted text' grep printf --verbose
+/usr/bin local then "$@" ${HOME} test "$@"
+	test /usr/bin awk done "$@" |
+	${HOME} --verbose then awk cd x=1 test sed readonly |
+		cd "$1" awk 2>/dev/null export "$1" then grep sed
+		grep sed printf -eu then -eu "$1" printf 'quoted text'
+	local awk awk cd 2>/dev/null cd x=1 echo 'quoted text' then printf awk
+	grep 'quoted text' "$@" export
+		"$1" 'quoted text' --verbose -eu --verbose awk cd x=1 ${HOME} test grep | sed export
+	"$1" done | cd -eu "$1" cd /usr/bin printf then then "$@" cd
+done readonly "$1" sed
+	cd readonly printf export ${HOME} echo sed ${HOME} printf
+	| && echo done --verbose done then done grep grep printf -eu "$@" done echo
+cd | grep && ${HOME} ${HOME} | printf "$1" ${HOME} 2>/dev/null
+$(pwd) --verbose "$@" --verbose echo echo
+	"$1" cd printf export local done
+"$@" awk test local 'quoted text' /usr/bin "$1" --verbose grep then
+-eu printf 'quoted text' --verbose
+| echo sed --verbose printf -eu "$1" echo test local awk --verbose
+	sed printf grep echo sed 2>/dev/null then
+test grep 2>/dev/null && then --verbose sed
+export test readonly x=1 export grep echo /usr/bin awk
+	2>/dev/null ${HOME} | export
+awk export test grep grep 2>/dev/null "$1" test test done /usr/bin
+		then then test 2>/dev/null "$1" "$1" done done /usr/bin "$@" then awk
+	${HOME} "$@" printf "$1"
+	&& | test /usr/bin "$1" --verbose $(pwd) export $(pwd) echo
+	then -eu readonly $(pwd) ${HOME}
+cd "$@" -eu "$@" "$@" echo printf awk --verbose echo "$1" awk grep "$@" "$@"
+sed x=1 sed && awk then readonly "$@" $(pwd) 2>/dev/null readonly $(pwd) cd
+	2>/dev/null ${HOME} readonly grep x=1 local -eu $(pwd) --verbose then awk "$1"
+	| sed readonly "$1" done sed test $(pwd) --verbose 'quoted text' "$@" "$@"
+done $(pwd) --verbose printf /usr/bin sed
+		export then sed | echo echo -eu 2>/dev/null ${HOME} done echo
+		printf ${HOME} --verbose "$@" printf
+		cd awk done echo "$@" "$@"
+-eu cd -eu test 2>/dev/null then x=1 readonly && "$@" --verbose
+	then "$1" echo test echo
+cd "$@" -eu 2>/dev/null
+printf 2>/dev/null echo test /usr/bin done -eu printf x=1 -eu export cd
+	x=1 readonly then local $(pwd) x=1 && /usr/bin sed 'quoted text'
+x=1 x=1 "$@" awk ${HOME} readonly /usr/bin sed echo 'quoted text'
+	awk && printf export "$1" echo "$@" done && printf 2>/dev/null echo && --verbose
+	test && then ${HOME} 2>/dev/null "$@" x=1 sed then 'quoted text'
+export && "$@" printf awk 2>/dev/null awk
+	test grep $(pwd) printf readonly
+	awk 'quoted text' x=1 cd /usr/bin && /usr/bin "$@" test echo export 2>/dev/null
+	printf 'quoted text' 2>/dev/null
+"$@" readonly local ${HOME} "$1" export && ${HOME} readonly "$1"
+		'quoted text' sed -eu export then | &&
+--verbose cd ${HOME} done readonly
+		-eu /usr/bin test 2>/dev/null sed $(pwd)
+		grep grep --verbose sed
+		"$@" cd done $(pwd) then 2>/dev/null test "$1" ${HOME}
+	&& sed 'quoted text' echo /usr/bin cd && x=1 2>/dev/null
+	"$1" $(pwd) --verbose local ${HOME} && export grep grep echo awk
+	printf --verbose grep --verbose "$@" printf export x=1
+	&& "$@" printf done $(pwd) readonly | then | ${HOME}
+		sed readonly readonly ${HOME} local readonly
+	"$@" 'quoted text' /usr/bin "$@" 2>/dev/null awk $(pwd)
+grep done printf "$1" sed echo sed && "$@" "$1"
+		| export | "$@" cd 2>/dev/null "$@" 2>/dev/null /usr/bin -eu then cd done cd
+--verbose export then awk echo 2>/dev/null
+awk sed export --verbose
+${HOME} local readonly export export ${HOME} x=1 export | -eu && "$1" $(pwd)
+		"$1" "$1" "$@" "$@" readonly
+echo cd test readonly x=1 done
+		| /usr/bin sed --verbose local sed printf
+	/usr/bin "$1" "$@" | "$@"
+		&& ${HOME} awk 2>/dev/null ${HOME} test then $(pwd) $(pwd) --verbose sed
+		--verbose 2>/dev/null "$1" --verbose 2>/dev/null readonly printf sed sed -eu
+		done echo "$1" -eu 'quoted text' grep grep "$@"
+		grep local | ${HOME} export
+		/usr/bin test sed readonly cd grep "$@" "$@" done "$1" "$@" grep | 2>/dev/null
+/usr/bin ${HOME} $(pwd) export awk
+	test /usr/bin /usr/bin -eu $(pwd) "$1" local 2>/dev/null local local
+"$@" x=1 --verbose local printf grep
+	awk "$@" export "$@" export grep -eu test printf printf x=1 done -eu
+		echo -eu 2>/dev/null "$@" --verbose /usr/bin
+	/usr/bin grep "$@" awk /usr/bin done "$@" x=1 printf cd test | /usr/bin export
+	then done cd test awk test | local -eu | awk then done /usr/bin test grep
+	| awk export echo local grep export --verbose grep test "$@" 'quoted text'
+		'quoted text' test printf cd /usr/bin printf "$@" grep
+${HOME} grep 2>/dev/null cd sed 2>/dev/null "$@" printf
+	'quoted text' 'quoted text' cd "$@" export local done
+then --verbose 2>/dev/null printf printf /usr/bin readonly 2>/dev/null
+		x=1 printf | x=1 "$@" local 'quoted text'
+		done $(pwd) printf -eu | cd awk export printf test printf 'quoted text' awk
+		"$1" 2>/dev/null x=1 && done "$1" x=1 printf "$@" 2>/dev/null ${HOME} x=1 "$1"
+		&& export then 2>/dev/null test then | ${HOME} then grep
+export "$@" export readonly | local
+printf grep | --verbose $(pwd) export sed awk printf export readonly
+	2>/dev/null 2>/dev/null ${HOME} export
+		&& test sed sed x=1 2>/dev/null awk echo -eu echo $(pwd) && export grep readonly
+	sed 2>/dev/null sed 2>/dev/null --verbose grep cd cd /usr/bin cd done --verbose
+	${HOME} "$1" echo then 'quoted text' done ${HOME} grep 'quoted text' --verbose
+	--verbose "$@" "$1" printf 'quoted text'
+"$@" awk ${HOME} grep -eu
+sed 2>/dev/null $(pwd) readonly done --verbose ${HOME} 2>/dev/null
+'quoted text' ${HOME} cd -eu cd grep 'quoted text'
+x=1 ${HOME} && 2>/dev/null test -eu
+		"$@" $(pwd) test 'quoted text' x=1 awk
+awk --verbose && cd cd 'quoted text' x=1 export cd $(pwd) 'quoted text' cd --verbose
+echo && 2>/dev/null local && awk /usr/bin
+readonly export local --verbose $(pwd) sed "$@" $(pwd) sed
+export --verbose export --verbose
+		test "$1" 'quoted text' | "$1" then -eu | "$1" /usr/bin
+		then --verbose 'quoted text'
+	cd "$1" "$@" ${HOME} export printf awk cd test 'quoted text'
+then ${HOME} test done test printf test "$1" -eu /usr/bin "$1" "$1" sed 2>/dev/null
+	"$1" "$1" /usr/bin -eu
+"$@" 'quoted text' | --verbose cd | "$@" /usr/bin
+	then && "$@" 2>/dev/null 'quoted text'
+export echo && local /usr/bin "$1"
+	sed 2>/dev/null x=1 cd local | printf echo test
+		$(pwd) readonly export cd cd "$@" then /usr/bin readonly
+	sed --verbose && "$@" sed awk awk echo export 2>/dev/null
+	test | export -eu readonly 'quoted text'
+		export then "$1" ${HOME} ${HOME} -eu x=1 ${HOME}
+		2>/dev/null "$1" echo "$1" then x=1 export
+	awk x=1 /usr/bin ${HOME} ${HOME} echo
+then 2>/dev/null $(pwd) && x=1 x=1
+sed readonly export then "$@" cd local
+&& printf done | ${HOME} grep "$@" printf
+awk | sed ${HOME} done 2>/dev/null local 'quoted text' &&
+	grep sed local /usr/bin -eu "$1" test -eu test "$@"
+		export echo test then printf then readonly export "$1" -eu local "$1" done
+		cd 2>/dev/null 2>/dev/null && awk done 2>/dev/null
+2>/dev/null "$1" export grep
+$(pwd) done ${HOME} -eu echo "$@" echo export 'quoted text' 2>/dev/null
+		x=1 -eu "$@" local test /usr/bin local $(pwd) "$1" then /usr/bin $(pwd) "$1" /usr/bin
+	sed --verbose local cd && done
+	export && export done x=1 cd cd ${HOME} echo && $(pwd) --verbose
+	x=1 readonly 2>/dev/null -eu
+	2>/dev/null /usr/bin --verbose local 'quoted text' done x=1
+/usr/bin 2>/dev/null then -eu
+cd $(pwd) awk grep then readonly ${HOME} 'quoted text' "$1" printf test 2>/dev/null
+	sed "$@" 2>/dev/null -eu -eu grep -eu cd
+		local ${HOME} test /usr/bin 2>/dev/null local echo x=1 'quoted text'
+		done export && "$@" export ${HOME} $(pwd)
+	-eu /usr/bin readonly cd then grep export
+awk readonly | /usr/bin test local && /usr/bin sed export $(pwd) awk | --verbose
+--verbose grep awk cd awk ${HOME} --verbose test awk then x=1 'quoted text' sed
+	readonly "$@" ${HOME} "$1" sed /usr/bin -eu 2>/dev/null sed then sed "$@"
+		printf $(pwd) "$1" echo ${HOME} "$1" && echo ${HOME}
+		local export then 2>/dev/null | awk export --verbose 2>/dev/null 'quoted text'
+		local --verbose readonly export 'quoted text' readonly
+--verbose local $(pwd) local readonly sed $(pwd) echo local 'quoted text'
+	"$@" /usr/bin -eu printf grep
+	readonly -eu --verbose "$1" export | ${HOME}
+	export -eu sed grep | readonly "$@" 2>/dev/null
+		grep /usr/bin 'quoted text'
+	local && | x=1 -eu && cd test then
+awk 2>/dev/null | x=1 2>/dev/null test 2>/dev/null sed && ${HOME}
+		export done | grep --verbose done test && ${HOME} /usr/bin -eu echo
+		x=1 $(pwd) export -eu export && "$@" export cd local
+echo /usr/bin readonly $(pwd) 2>/dev/null grep export --verbose ${HOME}
+	readonly export && cd &&
+	cd ${HOME} 'quoted text' echo cd grep cd "$@" printf x=1 --verbose 2>/dev/null
+		local awk echo "$@" x=1 test printf -eu sed awk grep | printf readonly export /usr/bin
+sed 'quoted text' "$@" --verbose
+		cd ${HOME} awk && 2>/dev/null local "$1" 2>/dev/null test export done echo
+		done -eu done "$@" then done export test /usr/bin ${HOME} sed &&
+	cd local test export then grep sed "$@"
+"$@" cd test /usr/bin 'quoted text' printf 'quoted text' | | 'quoted text'
+sed "$@" && /usr/bin readonly test awk done 2>/dev/null local
+		awk 'quoted text' grep x=1 --verbose
+${HOME} "$@" "$1" ${HOME} -eu awk awk printf
+${HOME} export export done
+export export "$1" && 2>/dev/null $(pwd) readonly 2>/dev/null "$@" "$1" readonly
+awk ${HOME} /usr/bin "$1" /usr/bin cd
+		grep /usr/bin && $(pwd) "$1" export local --verbose sed -eu done
+	-eu grep done -eu | printf ${HOME} | cd done test $(pwd)
+	then grep echo | "$1" ${HOME} 2>/dev/null
+local | local test x=1
+		printf 2>/dev/null 2>/dev/null $(pwd) printf 2>/dev/null
+${HOME} cd sed echo grep "$@" --verbose test --verbose
+export then export test cd x=1 done | test test 2>/dev/null
+	local | x=1 'quoted text'
+	local | export x=1 done ${HOME} readonly
+"$@" 2>/dev/null -eu 'quoted text'
+grep readonly local awk sed readonly local echo printf
+		$(pwd) | 2>/dev/null 'quoted text' awk test grep
+		"$@" cd | grep awk 2>/dev/null ${HOME} 2>/dev/null && 'quoted text'
+sed sed then -eu cd "$@" grep ${HOME}
+x=1 /usr/bin 'quoted text' && 'quoted text' 2>/dev/null awk | printf echo $(pwd)
+		grep --verbose | --verbose done then
+	| 'quoted text' /usr/bin grep --verbose then echo 2>/dev/null 'quoted text'
+	2>/dev/null echo ${HOME} ${HOME} local grep then done done grep $(pwd)
+		then cd | $(pwd) printf done grep
+	2>/dev/null 'quoted text' echo test then 2>/dev/null cd local
+	--verbose printf grep /usr/bin
+		done sed ${HOME} readonly x=1 | -eu printf awk "$1" export --verbose "$1" export
+"$@" readonly ${HOME} -eu echo x=1 -eu sed --verbose "$@" done grep
+readonly -eu $(pwd) then -eu
+	| "$1" && 'quoted text' local | -eu
+awk | then 2>/dev/null
+/usr/bin printf "$1" --verbose echo --verbose x=1 readonly readonly ${HOME}
+		done 2>/dev/null then test export printf "$1" "$@" then test 2>/dev/null
+cd 2>/dev/null awk x=1
+"$1" test test $(pwd) echo "$1" "$1" done
+		&& "$@" -eu local sed 2>/dev/null
+	-eu $(pwd) awk export --verbose cd 'quoted text' x=1 printf
+	sed awk x=1 then export | readonly x=1 /usr/bin -eu sed
+'quoted text' grep x=1 echo "$1" x=1 readonly "$@" awk
+	sed ${HOME} $(pwd) -eu cd done --verbose awk ${HOME} readonly cd | "$@" && 2>/dev/null
+	| cd 2>/dev/null | test --verbose /usr/bin
+	| test 2>/dev/null awk local && awk x=1 && export
+		$(pwd) readonly "$@" awk echo local 2>/dev/null grep sed "$1" then export
+		test $(pwd) sed grep grep done test "$@"
+		local -eu export echo export | printf 'quoted text' 2>/dev/null readonly awk $(pwd)
+		local sed ${HOME} done | export test && local "$1" -eu
+/usr/bin done --verbose echo awk && /usr/bin 'quoted text'
+	test printf awk then awk ${HOME} echo readonly 2>/dev/null -eu "$@" local
+"$1" printf | local "$@" | "$@" echo -eu "$1" echo sed export $(pwd) printf
+readonly && done "$@" readonly "$@"
+		cd then done sed sed sed 'quoted text'
+	$(pwd) echo sed echo then /usr/bin "$@" awk x=1 2>/dev/null export && test then
+	${HOME} 2>/dev/null "$1" | && x=1 awk sed done readonly grep /usr/bin local
+		-eu $(pwd) cd printf printf cd local "$@" echo "$@" awk printf 2>/dev/null
+	${HOME} done x=1 | printf grep sed x=1 printf sed x=1 local then
+printf awk --verbose cd test --verbose
+	then | "$1" 2>/dev/null --verbose local readonly sed done ${HOME}
+then local printf && 'quoted text' sed x=1 2>/dev/null
+	sed 'quoted text' export 'quoted text' 2>/dev/null 2>/dev/null
+		printf -eu grep x=1 awk 2>/dev/null printf awk "$1" sed "$@"
+		| done /usr/bin grep
+	cd ${HOME} --verbose -eu done export cd "$1" done then export ${HOME}
+echo readonly sed x=1 grep $(pwd) readonly && "$1" "$@" 'quoted text' echo
+export readonly "$@" ${HOME} awk readonly
+	readonly --verbose "$@" -eu $(pwd) printf
+	'quoted text' export "$1" 2>/dev/null
+	local $(pwd) local ${HOME} export 2>/dev/null
+		| echo echo cd grep awk awk echo && /usr/bin
+	| grep ${HOME} export 2>/dev/null sed test then && /usr/bin "$1"
+	local /usr/bin then awk readonly
+test then | sed 2>/dev/null done then printf --verbose
+	2>/dev/null cd x=1 done
+readonly awk "$@" x=1 grep test | $(pwd) ${HOME} /usr/bin
+		$(pwd) sed readonly 2>/dev/null 'quoted text'
+		$(pwd) sed test "$1" readonly echo && test sed && echo printf 2>/dev/null
+	| $(pwd) /usr/bin echo then x=1 --verbose $(pwd) test printf | sed
+local sed /usr/bin then local cd "$@" 'quoted text' readonly
+$(pwd) cd 'quoted text' ${HOME}
+grep readonly then done /usr/bin echo ${HOME} printf /usr/bin -eu | cd ${HOME}
+local ${HOME} cd ${HOME} export echo done | done "$@" "$1" ${HOME}
+export && grep /usr/bin $(pwd) "$1" printf
+		printf readonly --verbose x=1
+export test test ${HOME} --verbose 'quoted text'
+		x=1 x=1 | ${HOME} /usr/bin "$@" done grep
+	2>/dev/null done then done ${HOME} /usr/bin /usr/bin done echo
+		done echo grep "$@" awk done ${HOME} 2>/dev/null echo --verbose
+	"$1" --verbose readonly /usr/bin
+	x=1 sed cd $(pwd) printf readonly $(pwd) 2>/dev/null
+echo sed x=1 && -eu | ${HOME} "$1" awk readonly 'quoted text' readonly
+		$(pwd) grep sed 2>/dev/null export $(pwd) awk ${HOME}
+		| done | 'quoted text' --verbose | readonly "$@" cd echo 'quoted text'
+		| ${HOME} awk then 'quoted text' $(pwd) sed
+		test && done local echo export --verbose cd | export && /usr/bin "$1" 2>/dev/null
+	/usr/bin "$@" readonly && ${HOME} local done "$1" echo "$1" cd export printf
+		| | --verbose --verbose &&
+	test "$@" test x=1 x=1 then 'quoted text'
+&& sed 'quoted text' done | then && cd | then printf sed grep cd awk
+		test grep echo sed 'quoted text' ${HOME} readonly readonly sed printf readonly
+	/usr/bin "$@" readonly && awk awk done readonly then && /usr/bin
+		--verbose then readonly "$1" $(pwd) $(pwd) 2>/dev/null readonly x=1 /usr/bin
+		| -eu x=1 test sed test ${HOME} "$1" awk /usr/bin done readonly "$1" /usr/bin printf
+then | test test && /usr/bin ${HOME} /usr/bin printf
+	echo grep grep x=1 x=1 "$@" awk readonly $(pwd)
+	printf test x=1 done done
+		--verbose sed ${HOME} "$1" readonly awk awk --verbose printf
+readonly "$@" x=1 cd export printf "$1" echo
+done --verbose ${HOME} ${HOME} -eu grep $(pwd) cd grep printf readonly
+	test export grep && 2>/dev/null --verbose done printf | cd --verbose
+	sed ${HOME} export --verbose
+	local x=1 cd ${HOME} test "$@"
+		cd done x=1 printf x=1 "$1" then printf
+		| && 'quoted text' --verbose
+x=1 2>/dev/null test --verbose
+	export 2>/dev/null then $(pwd) ${HOME} export ${HOME}
+		test sed echo && export readonly
+	/usr/bin ${HOME} then | 'quoted text' grep grep && test local ${HOME}
+	--verbose -eu 'quoted text'
+	&& grep echo "$1" ${HOME} /usr/bin export awk --verbose
+| grep -eu && sed readonly local grep done local done export grep
+'quoted text' 2>/dev/null -eu $(pwd) test /usr/bin
+x=1 ${HOME} export done 'quoted text' test printf
+	done awk && done /usr/bin cd then sed &&
+export /usr/bin readonly then export --verbose
+		"$1" "$1" awk ${HOME} export --verbose
+${HOME} "$@" ${HOME} 'quoted text' sed --verbose cd awk /usr/bin done cd then
+	--verbose $(pwd) then test local
+	-eu done readonly /usr/bin 'quoted text'
+	2>/dev/null readonly && -eu grep sed 'quoted text'
+		done | && printf grep ${HOME} $(pwd) 2>/dev/null then then
+	x=1 $(pwd) | done done export --verbose local then 'quoted text' local
+		test echo -eu --verbose export $(pwd) && &&
+	done x=1 done local | /usr/bin done cd echo test
+	&& | "$1" ${HOME} then grep
+		done awk --verbose grep "$@" 'quoted text'
+	-eu awk $(pwd) then 'quoted text' 2>/dev/null
+grep printf awk test -eu && awk 'quoted text' "$@"
+	readonly -eu 2>/dev/null grep export 2>/dev/null export echo
+then ${HOME} $(pwd) ${HOME} $(pwd) test grep readonly sed 2>/dev/null done
+x=1 /usr/bin "$@" /usr/bin "$1" export awk readonly
+/usr/bin local | x=1 $(pwd) 'quoted text' awk "$@" && test | echo grep printf
+		sed local && done local cd $(pwd) "$@" 'quoted text'
+--verbose readonly test 'quoted text' && grep | export
+	export 2>/dev/null x=1 -eu x=1 sed "$@" sed cd $(pwd)
+		done printf | /usr/bin
+	"$1" local done sed --verbose $(pwd) grep --verbose export
+		sed "$@" /usr/bin local printf /usr/bin --verbose ${HOME}
+	$(pwd) $(pwd) ${HOME} local echo grep $(pwd) export x=1
+	${HOME} then then grep done -eu -eu local awk awk grep "$1" $(pwd) --verbose
+done readonly | local
+-eu 2>/dev/null grep grep 'quoted text' x=1 cd | test cd x=1 "$1" grep "$@"
+grep then then $(pwd) printf
+cd 'quoted text' 'quoted text' 2>/dev/null test ${HOME} 'quoted text' grep "$@"
+-eu local cd "$@" cd | done "$@" --verbose export ${HOME}
+		"$1" x=1 test -eu echo cd printf "$1" "$@" --verbose "$@" awk 2>/dev/null sed
+	done export && awk "$1" $(pwd) readonly && ${HOME}
+echo test local readonly ${HOME} cd test echo | 2>/dev/null
+	2>/dev/null 2>/dev/null echo
+		then cd cd "$@" echo grep readonly
+	--verbose done | "$@" ${HOME} echo
+'quoted text' --verbose /usr/bin
+| 'quoted text' test x=1 ${HOME} cd $(pwd) cd readonly test ${HOME} "$@" local
+export ${HOME} local awk x=1 readonly awk export
+		then -eu | --verbose grep grep then echo sed "$@" 'quoted text'
+		printf readonly readonly && /usr/bin
+		'quoted text' done | --verbose grep local test && local awk
+"$@" && local --verbose | 2>/dev/null awk readonly
+	readonly "$@" then sed then /usr/bin "$1" echo then then | x=1
+$(pwd) "$1" x=1 x=1 printf then --verbose "$1" sed
+	local ${HOME} echo test "$1" cd 2>/dev/null $(pwd) ${HOME} grep && test x=1
+sed export /usr/bin x=1 "$1" 'quoted text' test
+"$1" "$1" test then awk $(pwd)
+	"$@" printf test awk /usr/bin printf "$@" --verbose then sed 2>/dev/null
+		local -eu && printf /usr/bin local x=1 --verbose
+	2>/dev/null export grep grep ${HOME} then awk "$1" 'quoted text'
+test /usr/bin 2>/dev/null ${HOME} export then -eu local /usr/bin
+		'quoted text' readonly | && --verbose $(pwd) echo "$@" echo
+		sed export -eu printf echo then done grep local export printf
+sed readonly echo 2>/dev/null 2>/dev/null local local echo ${HOME} | done "$@" /usr/bin
+readonly printf done
+x=1 printf /usr/bin -eu | echo --verbose readonly
+${HOME} local 2>/dev/null 2>/dev/null echo printf x=1 x=1 sed | echo x=1
+		${HOME} local "$@" echo echo -eu x=1 ${HOME} --verbose "$@" done x=1 done
+		awk x=1 'quoted text' 2>/dev/null --verbose
+	local done sed | echo readonly 2>/dev/null
+		local done echo export grep ${HOME} "$@" local && readonly
+awk readonly readonly --verbose | printf printf && local export --verbose
+		export "$@" done done ${HOME} printf "$@" 'quoted text' --verbose
+		| | x=1 test then local
+		"$@" /usr/bin test printf ${HOME} && awk
+	then done test grep export grep
+		grep export done /usr/bin "$@" grep 'quoted text'
+2>/dev/null test sed grep 2>/dev/null 2>/dev/null
+	test echo awk readonly local sed then sed printf
+	then "$1" local then x=1 test cd "$@" echo "$1" sed sed | x=1
+'quoted text' --verbose local 2>/dev/null | ${HOME} "$1" ${HOME}
+	-eu awk x=1 'quoted text' local cd readonly
+		${HOME} cd sed 'quoted text'
+cd echo then echo cd --verbose sed 'quoted text' x=1 local --verbose
+		$(pwd) then && /usr/bin awk echo readonly local "$1"
+2>/dev/null "$1" "$@" | 2>/dev/null --verbose test echo | -eu | -eu
+		2>/dev/null -eu 'quoted text' then && -eu printf
+	local test x=1 2>/dev/null x=1 awk /usr/bin done --verbose readonly 'quoted text'
+	${HOME} $(pwd) | 2>/dev/null
+"$1" readonly "$@" --verbose local | /usr/bin 'quoted text'
+&& /usr/bin cd -eu grep $(pwd) grep
+export local echo readonly | readonly grep echo then $(pwd) --verbose done done
+		cd sed -eu cd readonly /usr/bin && "$1" echo
+	'quoted text' export -eu sed export -eu local
+	done grep ${HOME} "$@" then grep
+		| readonly -eu test then grep "$1" "$@" echo && printf echo cd
+"$1" printf $(pwd) -eu ${HOME} $(pwd)
+		'quoted text' /usr/bin sed echo local $(pwd) printf sed -eu x=1
+	${HOME} /usr/bin "$@" ${HOME} -eu "$@" awk 2>/dev/null
+		awk -eu $(pwd) export cd grep 2>/dev/null grep | echo ${HOME} cd && grep
+		grep then $(pwd) echo | /usr/bin 2>/dev/null && 'quoted text' ${HOME}
+		${HOME} awk ${HOME} printf local x=1 cd x=1 ${HOME} "$@" 'quoted text' echo ${HOME}
+		2>/dev/null --verbose echo
+		awk then sed printf grep printf "$1" "$1"
+	/usr/bin test ${HOME} done then local x=1 $(pwd) echo | readonly
+printf printf /usr/bin readonly sed echo --verbose --verbose "$1"
+		"$@" -eu --verbose $(pwd) $(pwd) test local 2>/dev/null
+--verbose test sed printf $(pwd) sed x=1 --verbose printf -eu test awk
+		printf grep 'quoted text' test --verbose
+		grep cd local awk echo printf export awk 2>/dev/null
+	printf 'quoted text' grep then
+		'quoted text' sed test export awk | readonly
+/usr/bin 2>/dev/null echo done $(pwd) --verbose
+		--verbose /usr/bin local 2>/dev/null "$@" 'quoted text' /usr/bin x=1
+cd "$1" 2>/dev/null $(pwd) readonly ${HOME} done -eu "$1" /usr/bin
+		'quoted text' readonly sed 'quoted text' local
+	test export then grep done then x=1 -eu ${HOME}
+	done $(pwd) grep /usr/bin done test "$1" local
+"$@" && sed /usr/bin "$@" cd sed 'quoted text' printf
+	/usr/bin x=1 2>/dev/null awk /usr/bin
+	| cd local x=1 export $(pwd) -eu /usr/bin echo $(pwd) readonly 'quoted text'
+		awk readonly && printf test
+| export $(pwd) test 'quoted text' readonly then
+		$(pwd) sed x=1 echo export
+		-eu test cd 'quoted text' cd x=1 | local done --verbose
+	$(pwd) then done sed "$@" | "$1"
+	"$@" grep printf done -eu 2>/dev/null then grep -eu ${HOME}
+		"$@" local awk 'quoted text' cd 2>/dev/null
+test "$1" --verbose --verbose
+		cd "$1" done && sed /usr/bin grep 'quoted text' printf
+done then x=1 then printf awk printf "$1" local 2>/dev/null cd --verbose
+awk ${HOME} grep printf grep export /usr/bin && "$@" x=1 sed test
+local sed x=1 awk -eu 2>/dev/null done $(pwd) 'quoted text'
+		export awk | export export | -eu cd "$1" /usr/bin
+		local x=1 printf x=1 grep --verbose echo --verbose ${HOME} printf grep
+grep && "$1" --verbose sed cd x=1 /usr/bin
+	export readonly then $(pwd)
+| awk local 'quoted text' awk readonly printf /usr/bin $(pwd) echo
+	readonly 'quoted text' ${HOME} local echo awk printf x=1 cd cd 2>/dev/null
+	export cd x=1 2>/dev/null local x=1 awk x=1 cd -eu test --verbose
+	printf $(pwd) readonly printf awk "$@" done -eu grep "$@" 'quoted text'
+		${HOME} local ${HOME} "$1" then
+		${HOME} -eu test grep awk printf cd $(pwd) | && "$1" export $(pwd) $(pwd) "$@"
+		| "$@" awk then test && && cd done test "$1" --verbose
+	printf awk 2>/dev/null then ${HOME} "$1" 'quoted text' export
+-eu sed readonly && "$@" --verbose --verbose /usr/bin sed
+		2>/dev/null -eu test grep $(pwd) /usr/bin 2>/dev/null then
+		&& "$@" test | echo export readonly $(pwd) "$1" echo
+	done local x=1 sed $(pwd) done x=1 export cd
+export printf local "$1" | "$1" | grep | test grep -eu | sed x=1 2>/dev/null
+&& $(pwd) --verbose $(pwd) export "$1" test && 'quoted text'
+sed then "$@" x=1 printf 2>/dev/null then
+'quoted text' echo sed sed
+	test "$1" done test local test readonly grep printf sed
+cd test awk x=1 awk "$@" --verbose $(pwd) sed -eu | local /usr/bin
+	awk -eu --verbose /usr/bin && sed
+${HOME} /usr/bin 2>/dev/null && test cd sed grep printf "$1" grep /usr/bin
+2>/dev/null export ${HOME} ${HOME} 2>/dev/null 2>/dev/null grep --verbose
+$(pwd) readonly "$@" /usr/bin readonly sed && done $(pwd)
+$(pwd) cd ${HOME} --verbose ${HOME} printf test sed awk test
+		--verbose /usr/bin && done grep sed -eu test grep 'quoted text' "$1"
+	readonly test echo -eu "$@" 2>/dev/null --verbose
+	2>/dev/null done local --verbose test x=1 --verbose sed $(pwd) test echo $(pwd)
+awk test /usr/bin x=1 ${HOME} sed cd test "$1" 2>/dev/null readonly /usr/bin -eu
+cd sed cd grep $(pwd) 2>/dev/null export test awk "$1"
+		| test x=1 | sed && ${HOME} readonly
+		export ${HOME} && ${HOME}
+		'quoted text' 2>/dev/null readonly grep $(pwd) "$@" --verbose | test
+done printf --verbose /usr/bin ${HOME} readonly then
+x=1 grep printf && x=1 export then ${HOME} printf &&
+		/usr/bin "$1" "$@" echo "$1" --verbose export local then local test $(pwd) |
+		then test --verbose 2>/dev/null &&
+		2>/dev/null --verbose cd && awk test readonly && printf then
+		then printf readonly local export readonly sed --verbose
+	x=1 awk cd local local then "$@" -eu then
+sed local | $(pwd) readonly then echo 'quoted text'
+then export then echo 'quoted text' local grep
+then done done "$1" readonly 'quoted text'
+	--verbose x=1 export --verbose
+		readonly then export "$@" "$@" awk /usr/bin done export
+	cd done -eu && echo readonly
+		x=1 local 'quoted text' $(pwd)
+		--verbose && local x=1 export then 'quoted text' local
+"$1" x=1 cd x=1 x=1 && -eu grep && done readonly $(pwd) grep test then
+/usr/bin grep echo x=1 awk readonly echo
+	printf -eu --verbose 2>/dev/null
+	readonly printf cd 2>/dev/null | x=1 2>/dev/null readonly then export
+	echo "$1" | /usr/bin x=1 test local done
+sed "$1" cd | then /usr/bin readonly
+	"$@" done printf then /usr/bin
+	2>/dev/null then "$@" $(pwd) ${HOME} /usr/bin | done local /usr/bin
+		| printf export local 'quoted text'
+	cd --verbose | done then export cd x=1 "$1" test grep -eu | test printf sed
+local sed printf 'quoted text' --verbose done --verbose
+--verbose then printf 'quoted text' local cd local /usr/bin | printf echo
+x=1 $(pwd) test && --verbose readonly grep 2>/dev/null cd $(pwd)
+$(pwd) grep export ${HOME} /usr/bin 'quoted text'
+export grep sed ${HOME} readonly then && readonly "$@"
+	awk cd export cd sed "$1" 2>/dev/null x=1 2>/dev/null
+cd grep -eu /usr/bin $(pwd)
+		${HOME} "$1" /usr/bin && -eu ${HOME} 'quoted text' then
+	readonly ${HOME} "$1" | done export done grep -eu "$@" $(pwd)
+	&& x=1 "$@" printf readonly && grep 'quoted text' done
+		2>/dev/null test $(pwd) "$1" ${HOME} 2>/dev/null then
+	2>/dev/null "$1" --verbose -eu "$1" "$@" /usr/bin && echo echo
+$(pwd) then awk 2>/dev/null printf "$1" then 'quoted text' "$1" ${HOME} then
+		2>/dev/null local printf 2>/dev/null --verbose local printf grep
+		readonly export --verbose x=1
+	${HOME} local "$@" | 'quoted text' printf export awk grep sed readonly done | |
+	"$@" /usr/bin --verbose /usr/bin 'quoted text' sed test /usr/bin "$@"
+	'quoted text' export sed 'quoted text' 2>/dev/null cd --verbose "$@" local
+		done test printf "$1" export readonly
+		test && $(pwd) --verbose grep
+		test done 2>/dev/null printf "$1" 'quoted text' export
+		$(pwd) awk --verbose printf grep $(pwd) $(pwd) export $(pwd) 'quoted text'
+		printf ${HOME} "$@" readonly export --verbose done export x=1 ${HOME} 'quoted text'
+	2>/dev/null /usr/bin "$@" done -eu ${HOME}
+sed cd | 2>/dev/null printf readonly ${HOME} sed && && echo $(pwd) test
+		/usr/bin local "$1" $(pwd) grep ${HOME} --verbose then awk 2>/dev/null then
+		done /usr/bin /usr/bin readonly local /usr/bin $(pwd) "$1" then done sed
+		then ${HOME} export --verbose 2>/dev/null /usr/bin 'quoted text' --verbose
+		echo | grep 2>/dev/null export then -eu "$@" $(pwd)
+	x=1 echo grep test sed local x=1 awk echo "$1" then "$1" 'quoted text'
+${HOME} x=1 local 2>/dev/null export
+x=1 local readonly echo /usr/bin awk grep local local -eu readonly "$1"
+		done $(pwd) awk cd echo $(pwd) local "$@" test
+		done then grep ${HOME} && readonly 'quoted text' 'quoted text'
+	grep --verbose awk "$@" sed | echo x=1
+	echo cd export then local then 'quoted text' "$1" cd $(pwd) 2>/dev/null
+		$(pwd) "$1" x=1 grep
+		printf 'quoted text' test cd readonly echo echo
+2>/dev/null export test readonly x=1 test | then printf
+		$(pwd) awk && echo done export printf export cd sed | cd
+printf printf echo --verbose && 2>/dev/null
+	then grep ${HOME} test && x=1 /usr/bin -eu /usr/bin | "$@" x=1 -eu "$1" sed
+		cd | readonly echo | local 2>/dev/null
+	$(pwd) test printf x=1 "$@" local && --verbose /usr/bin echo "$@" && ${HOME} sed
+export readonly then test "$1" | export 'quoted text'
+sed /usr/bin -eu then |
+test grep grep done x=1 readonly "$1" readonly printf 2>/dev/null
+$(pwd) x=1 cd $(pwd) printf local
+#include c145.sh
+'quoted text' readonly done /usr/bin test echo "$1" | readonly "$@"
+2>/dev/null cd | "$1" 'quoted text' test "$@" /usr/bin $(pwd) -eu readonly
+	--verbose cd then /usr/bin 'quoted text' test echo awk echo grep "$@" then
+-eu | | echo readonly
+		--verbose && sed ${HOME} sed
+&& local test /usr/bin readonly grep test | grep
+		"$@" x=1 then local awk export grep then -eu export
+		| test "$1" /usr/bin done echo ${HOME}
+	sed "$@" 2>/dev/null $(pwd) 'quoted text' echo "$@" readonly
+	awk "$@" -eu printf cd cd test
+local grep $(pwd) 2>/dev/null test export test sed ${HOME} && test
+done sed && && sed done $(pwd)
+		sed /usr/bin | local "$@" 2>/dev/null
+	cd "$@" export "$1" cd grep
+readonly $(pwd) "$@" export export
+		export echo "$@" $(pwd) --verbose done grep /usr/bin
+	done sed local 2>/dev/null done --verbose -eu &&
+		export done "$1" printf -eu echo && export cd /usr/bin readonly
+local "$@" | grep 'quoted text' "$@" then grep x=1 --verbose 'quoted text' grep
+done --verbose $(pwd) local --verbose
+		echo 'quoted text' then export "$1" ${HOME}
+&& --verbose | "$@" "$@" echo "$@" printf x=1 grep test cd x=1 "$1" grep
+test && --verbose export readonly 2>/dev/null local echo 2>/dev/null -eu
+		echo | then ${HOME} -eu x=1 -eu sed /usr/bin "$1" then awk
+	2>/dev/null then | -eu test awk local |
+done local printf ${HOME} 'quoted text'
+x=1 export /usr/bin echo "$1" x=1 readonly | done --verbose local cd "$1" $(pwd)
+		'quoted text' ${HOME} "$1" grep 2>/dev/null grep readonly
+	cd readonly | $(pwd) | /usr/bin -eu echo ${HOME} done "$1" grep && cd test
+test "$@" test readonly --verbose && "$@" 2>/dev/null && | --verbose 'quoted text'
+		'quoted text' "$1" ${HOME} cd ${HOME} sed
+	x=1 $(pwd) printf printf local test echo test $(pwd) grep && -eu
+done sed awk sed -eu readonly && /usr/bin "$1" echo "$@" -eu
+&& sed export test cd export /usr/bin --verbose && ${HOME} grep readonly ${HOME}
+		x=1 sed /usr/bin local readonly awk cd
+	printf && echo "$@" && grep local done then printf 2>/dev/null
+		printf --verbose cd -eu | 2>/dev/null 2>/dev/null
+		local cd 'quoted text' done local
+2>/dev/null grep printf 2>/dev/null
+done readonly then echo 2>/dev/null printf sed 2>/dev/null
+"$1" test /usr/bin 2>/dev/null "$@" && $(pwd) $(pwd) then cd readonly
+	grep local 2>/dev/null local cd ${HOME} local test | grep grep /usr/bin readonly
+--verbose echo "$1" local -eu
+--verbose 2>/dev/null local awk done export test ${HOME}
+		then | test then then --verbose then /usr/bin x=1 "$@" then
+	sed 2>/dev/null ${HOME} 2>/dev/null
+	export readonly $(pwd) awk $(pwd) export cd | && "$1" sed "$@"
+done "$@" "$@" grep cd $(pwd) && $(pwd) 'quoted text'
+		${HOME} --verbose $(pwd) -eu echo sed "$1"
+		sed $(pwd) local local
+	| printf 'quoted text' $(pwd) --verbose local -eu && export echo | then "$1" then
+		--verbose export echo x=1 cd sed -eu
+	&& $(pwd) 2>/dev/null --verbose 2>/dev/null -eu sed
+done --verbose ${HOME} done --verbose /usr/bin --verbose
+		"$1" | readonly local 2>/dev/null sed sed "$1" awk sed "$1" --verbose x=1 printf
+test printf ${HOME} && -eu 2>/dev/null 2>/dev/null
+		'quoted text' printf --verbose && grep "$@"
+grep printf ${HOME} "$@"
+	awk --verbose readonly /usr/bin readonly echo local
+${HOME} export 2>/dev/null 2>/dev/null
+local done $(pwd) 'quoted text'
+		awk done 2>/dev/null x=1 -eu 2>/dev/null -eu $(pwd)
+'quoted text' readonly awk "$1" done ${HOME}
+export done --verbose then 'quoted text' -eu -eu | "$1" | printf then | cd
+		"$@" "$1" readonly readonly -eu && ${HOME} sed echo grep ${HOME}
+		cd | && readonly readonly /usr/bin
+		--verbose awk x=1 2>/dev/null grep $(pwd) sed ${HOME} 2>/dev/null
+	local "$@" "$1" 2>/dev/null -eu -eu "$@" 2>/dev/null export local x=1 /usr/bin
+	export "$1" export $(pwd) "$@" x=1 grep /usr/bin
+	'quoted text' awk done | x=1 test "$1" -eu sed then cd | awk 2>/dev/null $(pwd)
+local && ${HOME} "$@" "$@" then "$@" cd cd x=1 done awk
+local 2>/dev/null then --verbose cd export
+		"$1" done x=1 $(pwd) 2>/dev/null && $(pwd) 'quoted text' done then $(pwd) 'quoted text'
+	2>/dev/null --verbose 'quoted text' --verbose
+	-eu local "$@" grep x=1 readonly echo && echo | then export local done
+2>/dev/null test && 2>/dev/null 2>/dev/null grep -eu readonly "$@" ${HOME}
+readonly export grep done -eu done
+sed export --verbose --verbose local x=1 "$1" test "$1"
+2>/dev/null && 2>/dev/null
+		printf export --verbose readonly "$1" --verbose then && export /usr/bin && cd cd
+cd "$@" done grep $(pwd) done -eu && && -eu printf printf cd export
+		export local | then echo done grep done printf /usr/bin test awk done && "$@"
+/usr/bin /usr/bin && "$1" cd
+export $(pwd) local | $(pwd) 2>/dev/null echo && export
+	then --verbose | echo then $(pwd) "$1" export -eu printf readonly $(pwd) | echo
+		'quoted text' local -eu "$@" -eu done $(pwd) printf -eu printf
+x=1 export then "$1" sed | export -eu x=1 $(pwd) sed | "$@" 2>/dev/null
+		cd test /usr/bin | echo sed /usr/bin --verbose
+export test local printf && "$@"
+echo --verbose -eu test test
+		grep local sed $(pwd) 'quoted text'
+	test then cd 'quoted text' test --verbose cd | ${HOME} && test local sed sed $(pwd)
+${HOME} x=1 readonly local
+	done done local readonly test && readonly --verbose 2>/dev/null awk 'quoted text'
+	readonly && local awk sed printf then grep "$@" export /usr/bin
+	sed --verbose done grep --verbose ${HOME} done sed cd ${HOME}
+	| test then test grep sed && && /usr/bin readonly
+		awk -eu cd awk && /usr/bin sed awk done "$1" grep done readonly local
+&& ${HOME} sed awk then done $(pwd) $(pwd)
+local echo export export then sed awk "$@" $(pwd) /usr/bin test local printf ${HOME}
+	-eu readonly 'quoted text' --verbose && | 2>/dev/null done --verbose $(pwd) &&
+| --verbose 2>/dev/null grep ${HOME}
+export 'quoted text' local cd printf export
+		${HOME} grep $(pwd) -eu ${HOME}
+	&& readonly 2>/dev/null cd printf readonly test printf
+	x=1 $(pwd) && then grep local "$1" export && 'quoted text'
+		| ${HOME} | "$@" 2>/dev/null sed
+awk sed export "$1" cd grep grep test readonly local /usr/bin
+test local 2>/dev/null
+$(pwd) ${HOME} readonly echo sed
+	test -eu printf grep printf sed --verbose $(pwd) && grep awk && x=1 | $(pwd)
+	"$1" 'quoted text' awk "$@" sed --verbose 'quoted text'
+		&& x=1 2>/dev/null --verbose test | awk "$@" export && local awk x=1 then
+"$1" readonly /usr/bin
+		"$1" ${HOME} done cd test cd
+	test echo 2>/dev/null 2>/dev/null ${HOME} ${HOME}
+		export 'quoted text' awk && awk cd done --verbose -eu 'quoted text'
+		readonly && printf "$1" sed 'quoted text' local
+		export "$@" 2>/dev/null then test done printf
+		printf $(pwd) cd then done && 2>/dev/null "$1" cd x=1 'quoted text'
+	done echo then echo test "$1" $(pwd)
+		--verbose /usr/bin -eu "$@" sed
+		export grep $(pwd) readonly
+| ${HOME} cd readonly | printf "$@" -eu done
+		export done /usr/bin readonly test 2>/dev/null --verbose x=1
+	/usr/bin grep done then $(pwd) test
+awk 'quoted text' | awk then local
+		--verbose printf local "$@" 2>/dev/null ${HOME} "$@"
+	local | sed sed test 'quoted text' && cd echo $(pwd) x=1 --verbose then ${HOME}
+${HOME} 'quoted text'
+		cd 2>/dev/null then && 'quoted text' sed
+	test --verbose /usr/bin awk printf
+	sed echo "$1" -eu "$1" $(pwd) "$1" done $(pwd) then "$@" | |
+test then sed 'quoted text' sed readonly
+	echo export readonly done
+		| ${HOME} 2>/dev/null | awk && "$@" printf local then
+sed && "$@" 2>/dev/null
+	done readonly -eu export sed
+		/usr/bin "$@" | ${HOME} "$@" x=1 x=1 echo -eu test /usr/bin x=1 -eu | cd "$1"
+	done "$1" ${HOME} readonly 2>/dev/null "$1" readonly sed
+		grep local echo cd x=1
+x=1 x=1 --verbose 'quoted text' cd
+| $(pwd) readonly && $(pwd)
+export export /usr/bin "$1" cd then
+		sed awk x=1 "$@" test local done grep
+&& $(pwd) export printf echo done grep | 2>/dev/null x=1 sed cd
+		"$1" awk export /usr/bin && awk x=1 awk test
+	sed $(pwd) done $(pwd) done "$1" -eu 2>/dev/null grep
+2>/dev/null export test awk sed readonly && 2>/dev/null
+	echo && ${HOME} ${HOME} readonly x=1 sed done cd 2>/dev/null
+	--verbose then export 2>/dev/null then sed sed 2>/dev/null x=1 "$1" grep
+	$(pwd) echo --verbose export test awk
+		${HOME} then printf ${HOME} test -eu x=1 printf && grep --verbose echo x=1
+readonly "$@" x=1 cd 'quoted text'
+	"$1" cd grep awk readonly --verbose local grep test grep --verbose awk export
+then test $(pwd) && x=1 grep | | $(pwd) --verbose printf
+		'quoted text' printf ${HOME} --verbose
+		done "$1" then ${HOME}
+echo | done | -eu export "$@"
+	&& done /usr/bin local
+local | 'quoted text' ${HOME} grep local | | cd grep "$1" -eu grep then
+	${HOME} 'quoted text' sed local x=1 sed export $(pwd) sed sed echo
+export | test awk printf --verbose
+	cd then grep 2>/dev/null printf readonly sed
+then && 2>/dev/null test export done echo /usr/bin "$@" readonly
+	export sed export done export echo done cd 'quoted text' local "$@" -eu
+	echo x=1 "$@" export --verbose
+	x=1 then echo done $(pwd) echo | /usr/bin sed local $(pwd) 'quoted text'
+| grep awk done "$@" ${HOME} | test "$@"
+	sed readonly ${HOME} grep 2>/dev/null && readonly cd
+"$1" echo readonly && printf && "$1"
+--verbose readonly cd &&
+	"$@" "$1" 2>/dev/null 2>/dev/null
+&& && local done done /usr/bin local 'quoted text' -eu $(pwd)
+printf readonly printf echo grep cd done export then -eu awk
+		${HOME} 2>/dev/null -eu export printf export readonly
+cd $(pwd) printf sed awk --verbose grep then sed readonly | test
+		"$1" $(pwd) printf local sed x=1 awk /usr/bin readonly "$1" | 'quoted text'
+	| done --verbose test readonly
+	"$@" ${HOME} | 'quoted text' 'quoted text' cd -eu && sed test x=1 2>/dev/null
+	-eu grep "$1" printf local -eu 'quoted text' grep readonly /usr/bin 'quoted text'
+	then && export echo "$1" "$@" cd printf
+grep ${HOME} test ${HOME} $(pwd) ${HOME} 2>/dev/null cd local awk | ${HOME} 2>/dev/null
+		awk awk x=1 echo -eu 'quoted text'
+	echo printf -eu done printf local 2>/dev/null test
+	${HOME} "$@" then 'quoted text' /usr/bin
+		echo 'quoted text' export echo cd $(pwd)
+	-eu x=1 $(pwd) grep printf -eu x=1 export | echo test cd ${HOME}
+"$@" test grep x=1 "$@" cd cd echo "$1" printf printf export
+/usr/bin grep x=1 && $(pwd) readonly done grep local | awk "$@" grep && "$1" then
+	&& 2>/dev/null readonly 'quoted text'
+x=1 local grep awk printf awk grep 'quoted text' && "$1" then
+$(pwd) local $(pwd) ${HOME} sed sed sed 'quoted text' then "$1" 2>/dev/null done
+	'quoted text' $(pwd) then -eu then echo printf "$1" grep done "$1"
+	export 'quoted text' cd "$1" local -eu done readonly
+		local sed echo /usr/bin sed local "$1" "$@" grep readonly
+	'quoted text' | sed | ${HOME} test done then | "$1" "$1"
+	| then | "$@" echo awk
+	sed | && 2>/dev/null test cd | 2>/dev/null $(pwd) cd echo local 2>/dev/null
+	/usr/bin && cd x=1 && && x=1 --verbose
+	'quoted text' awk printf
+	/usr/bin readonly --verbose then awk sed awk local 2>/dev/null
+| 'quoted text' export local local export "$1" local
+'quoted text' printf sed $(pwd) echo --verbose
+	test 2>/dev/null --verbose export cd "$@" 2>/dev/null
+cd 'quoted text' $(pwd)
+2>/dev/null export cd readonly /usr/bin
+${HOME} echo "$1" printf 2>/dev/null "$1" /usr/bin ${HOME}
+local test 'quoted text' 'quoted text' "$@" $(pwd) export
+	2>/dev/null ${HOME} grep sed | then local awk done grep echo $(pwd)
+		awk "$1" readonly cd awk cd done done printf && 2>/dev/null
+	$(pwd) "$1" export done awk --verbose echo sed "$@" grep /usr/bin "$1" grep &&
+x=1 x=1 "$@" && export 'quoted text' readonly && then printf && "$1"
+readonly x=1 printf "$1" local --verbose cd cd export
+	done ${HOME} "$@" test && cd readonly x=1 && "$1" x=1 $(pwd) done
+	cd "$@" test ${HOME} ${HOME} "$@" echo cd test --verbose /usr/bin
+2>/dev/null x=1 echo $(pwd) x=1 printf grep $(pwd) awk echo then awk
+export sed "$@" export ${HOME} -eu test awk grep
+/usr/bin readonly cd ${HOME} |
+-eu 'quoted text' cd /usr/bin done then "$1" test && sed done 2>/dev/null
+		$(pwd) local x=1 echo --verbose done printf local local
+local $(pwd) awk done sed --verbose $(pwd)
+x=1 "$1" local "$1" && done 2>/dev/null printf ${HOME} x=1 $(pwd)
+printf done x=1 ${HOME} && test $(pwd) x=1 ${HOME} test -eu "$1"
+	&& local $(pwd) x=1 cd grep "$@" | $(pwd) echo "$@" |
+-eu /usr/bin local done export $(pwd) awk && then | awk printf
+awk sed -eu done awk -eu &&
+		x=1 then && grep export 'quoted text' 'quoted text' -eu then "$@" | --verbose
+test 2>/dev/null then 'quoted text' -eu
+	"$@" x=1 sed -eu ${HOME}
+		local printf echo | -eu readonly grep x=1 -eu cd cd | && awk sed sed sed cd
+	"$1" 'quoted text' -eu "$@" 2>/dev/null $(pwd)
+	sed | x=1 awk x=1 'quoted text'
+		--verbose awk /usr/bin ${HOME} printf export export --verbose
+	&& | | $(pwd) $(pwd) "$1" readonly
+	--verbose printf /usr/bin x=1 sed local && ${HOME}
+	-eu "$@" cd sed test cd -eu
+		test then printf printf --verbose | printf
+		test | x=1 done cd then echo sed then
+sed x=1 done cd "$@" /usr/bin test cd "$1" ${HOME} echo "$@"
+x=1 printf && -eu grep sed sed readonly grep cd ${HOME}
+sed 'quoted text' "$@" grep awk awk | /usr/bin
+	'quoted text' echo 2>/dev/null /usr/bin
+		printf grep --verbose 'quoted text' 2>/dev/null cd x=1 ${HOME}
+		2>/dev/null sed awk 2>/dev/null -eu export ${HOME} x=1 $(pwd) export
+| grep 2>/dev/null | -eu local x=1 $(pwd)
+		-eu awk echo $(pwd) echo 'quoted text' 'quoted text' "$1"
+local "$1" /usr/bin readonly && x=1 --verbose
+		/usr/bin export && grep && -eu grep then then readonly done cd x=1 cd readonly
+$(pwd) "$1" | 2>/dev/null grep 'quoted text' 'quoted text' sed done echo "$1"
+	done 'quoted text' sed printf export test export readonly
+test "$1" export -eu 'quoted text' ${HOME} 'quoted text' done
+2>/dev/null $(pwd) | "$@" | && --verbose echo
+	readonly && cd awk | x=1 -eu done ${HOME} 2>/dev/null
+		&& echo test x=1 test printf echo | done | 2>/dev/null awk "$1"
+	--verbose printf grep 2>/dev/null
+		&& $(pwd) readonly test | test --verbose echo done
+		grep x=1 $(pwd) grep done "$1" /usr/bin done
+	sed /usr/bin $(pwd) local ${HOME}
+		readonly "$@" ${HOME} | cd | -eu
+		2>/dev/null "$1" "$1" done readonly
+grep echo done --verbose "$1" readonly | 2>/dev/null ${HOME} test done then
+		cd sed /usr/bin done done x=1 "$1" 'quoted text' ${HOME} /usr/bin
+	${HOME} -eu | awk grep 2>/dev/null | | "$1" 2>/dev/null -eu cd
+		test echo | readonly | ${HOME} 2>/dev/null 'quoted text' done export awk | then
+'quoted text' /usr/bin awk echo 'quoted text' local sed local printf
+		$(pwd) 2>/dev/null readonly export cd /usr/bin cd export $(pwd)
+		&& echo "$1" then -eu then done /usr/bin sed grep then ${HOME} grep readonly /usr/bin
+		test ${HOME} --verbose printf cd export $(pwd) 'quoted text' sed
+	readonly -eu $(pwd) 2>/dev/null 'quoted text'
+		"$1" test echo "$@" done export --verbose
+		grep then then "$1" printf printf test export test readonly cd x=1 then ${HOME}
+	export echo cd 2>/dev/null | done export printf && && | readonly export ${HOME}
+"$1" $(pwd) && -eu 2>/dev/null sed done echo && --verbose cd export /usr/bin
+		2>/dev/null "$1" then | "$@" local 'quoted text' readonly
+	&& --verbose $(pwd) $(pwd) echo echo $(pwd) echo local "$1" $(pwd) cd ${HOME}
+	echo readonly $(pwd) $(pwd) grep local --verbose done
+	x=1 readonly local -eu 'quoted text' "$1"
+${HOME} -eu -eu ${HOME} /usr/bin done grep $(pwd) local cd ${HOME} awk then export
+&& then ${HOME} "$1" x=1 local readonly | cd grep 'quoted text' printf cd awk
+&& local 'quoted text' -eu --verbose cd /usr/bin $(pwd) grep -eu
+then 'quoted text' readonly && --verbose sed 'quoted text'
+test export printf "$1" --verbose echo cd 2>/dev/null $(pwd)
+readonly -eu grep printf done readonly cd sed 2>/dev/null
+		readonly then --verbose 2>/dev/null done echo echo "$1" $(pwd) -eu then export
+		"$@" test cd then then ${HOME}
+	readonly /usr/bin readonly | readonly
+	then export cd readonly readonly "$@" export test printf
+	readonly echo /usr/bin /usr/bin readonly ${HOME} local local export
+	--verbose cd --verbose && "$1" local
+		"$1" readonly --verbose && sed
+		&& 2>/dev/null 'quoted text' "$1"
+	${HOME} $(pwd) && local awk ${HOME} -eu local export
+'quoted text' 2>/dev/null done then -eu export && | done sed export test
+		-eu test $(pwd) export test printf done
+	${HOME} && grep test 'quoted text'
+x=1 printf 2>/dev/null |
+grep done export readonly
+		printf $(pwd) readonly local 'quoted text' $(pwd)
+		awk printf x=1 "$1" 2>/dev/null done cd test export 'quoted text' 2>/dev/null
+		"$1" x=1 local local
+	| done 2>/dev/null /usr/bin echo
+	| 'quoted text' awk | done /usr/bin local local grep
+		printf done 2>/dev/null --verbose
+/usr/bin grep then echo x=1 printf grep -eu && -eu --verbose x=1 x=1
+		2>/dev/null $(pwd) printf 2>/dev/null awk then && readonly done ${HOME}
+	| cd test sed 2>/dev/null 2>/dev/null
+awk local /usr/bin then -eu echo sed x=1 --verbose grep 2>/dev/null
+		then printf "$@" "$1" x=1 | grep -eu printf
+	sed then test "$1" echo | then x=1 test readonly "$@" $(pwd) | export 'quoted text'
+		"$1" export 'quoted text' printf x=1 printf && x=1 done | local printf printf
+		2>/dev/null && /usr/bin then export "$@" x=1 sed x=1
+		cd "$@" | grep x=1 test ${HOME} export echo
+		sed done ${HOME} --verbose local done | awk
+		then test x=1 test export awk $(pwd) $(pwd) cd echo awk && export
+	x=1 --verbose /usr/bin $(pwd) cd grep
+		test readonly 'quoted text' grep
+		awk ${HOME} "$1" then grep ${HOME} && 2>/dev/null
+	readonly printf sed echo
+	export | ${HOME} echo /usr/bin x=1 local
+		${HOME} 2>/dev/null test echo sed sed printf local test export /usr/bin then
+	$(pwd) readonly cd 'quoted text' test printf /usr/bin -eu
+"$1" /usr/bin then "$@" then printf 2>/dev/null readonly sed local /usr/bin
+	"$1" "$@" x=1 then "$@" echo x=1 2>/dev/null sed sed awk sed grep cd $(pwd)
+		--verbose local test | done
+		| $(pwd) && 'quoted text' export
+		"$@" ${HOME} $(pwd) grep test readonly | && -eu --verbose ${HOME}
+		test export echo local printf -eu $(pwd) --verbose
+printf sed printf "$1" grep -eu then cd ${HOME}
+&& export 2>/dev/null | test export done local readonly sed done | ${HOME}
+awk echo local then cd /usr/bin
+sed then -eu ${HOME} $(pwd) readonly "$1" printf
+| --verbose echo done x=1 /usr/bin -eu /usr/bin "$@" readonly grep
+		sed -eu grep printf --verbose && x=1 test
+	test done "$@" then sed export
+--verbose printf sed local 'quoted text' -eu "$@" 2>/dev/null cd echo 'quoted text'
+	$(pwd) printf export 2>/dev/null local | echo 'quoted text' done
+"$1" x=1 "$@" "$1" | grep grep local --verbose
+		&& cd 'quoted text' "$1"
+		| printf sed ${HOME} "$@" && ${HOME} "$@" local echo local ${HOME} "$1"
+	x=1 /usr/bin 'quoted text' readonly then
+	| /usr/bin --verbose readonly sed -eu cd --verbose
+| export echo $(pwd) ${HOME} printf
+	echo 2>/dev/null ${HOME} awk local 2>/dev/null test done printf
+"$1" then | export grep then test && x=1 "$@" "$@" | then
+2>/dev/null $(pwd) cd "$1" test $(pwd) then cd
+	sed printf local --verbose readonly
+		sed echo && sed "$@" "$1" /usr/bin sed 'quoted text' printf sed sed $(pwd)
+		awk test echo "$1" 'quoted text' x=1 2>/dev/null
+		x=1 x=1 echo "$1" 2>/dev/null then | local export 'quoted text'
+		then sed -eu sed $(pwd) && "$@" -eu done local test
+		awk 2>/dev/null export
+		export | export awk | ${HOME} cd $(pwd) local
+		readonly x=1 && && cd test readonly -eu awk x=1 printf $(pwd)
+	x=1 local x=1 'quoted text'
+		awk x=1 local && | --verbose done x=1 "$@"
+	'quoted text' echo && 'quoted text' export
+	awk done 'quoted text' export export
+done $(pwd) ${HOME} /usr/bin grep awk printf awk 'quoted text' x=1
+		-eu "$1" 'quoted text' -eu readonly done 'quoted text'
+	done "$1" "$1" local export cd then printf ${HOME} grep
+done export grep grep awk sed printf done echo --verbose
+	2>/dev/null ${HOME} ${HOME} ${HOME} echo 2>/dev/null
+	done 'quoted text' local && test 2>/dev/null test then |
+readonly x=1 && local ${HOME} -eu "$1" local "$@" 2>/dev/null
+		echo 2>/dev/null awk "$@" awk cd done sed "$1" --verbose
+		grep done --verbose awk 2>/dev/null /usr/bin sed cd echo
+export && sed done x=1
+	${HOME} x=1 readonly "$@" awk "$@" done readonly 2>/dev/null
+	/usr/bin readonly echo --verbose 'quoted text'
+	awk /usr/bin "$1" printf -eu echo && echo x=1 local
+| sed then then test && ${HOME} awk /usr/bin done local $(pwd) "$1" then cd x=1
+		readonly then $(pwd) echo ${HOME} $(pwd) ${HOME}
+-eu cd ${HOME} done readonly echo export done x=1 "$@" sed readonly
+	local sed cd x=1 "$1" --verbose -eu readonly grep printf 'quoted text'
+--verbose done $(pwd) "$@" "$1" -eu grep /usr/bin local
+		export | $(pwd) 2>/dev/null test $(pwd) sed 2>/dev/null x=1 $(pwd)
+		cd then test export /usr/bin test export done "$@" "$1" ${HOME} printf
+		2>/dev/null printf --verbose readonly sed
+		"$@" echo readonly readonly awk 2>/dev/null
+	&& then echo 'quoted text' /usr/bin "$1" -eu 'quoted text'
+		${HOME} done then && then sed /usr/bin then then sed
+test then x=1 echo "$@" sed sed echo "$1" && "$@" --verbose done 'quoted text'
+'quoted text' cd && 'quoted text' grep local printf test -eu
+/usr/bin x=1 && test awk readonly echo /usr/bin grep && grep /usr/bin
+		-eu printf 2>/dev/null sed
+		test "$@" then export local local printf x=1
+	awk local --verbose echo done readonly
+		awk then readonly echo echo readonly $(pwd) /usr/bin
+	--verbose -eu grep /usr/bin -eu | /usr/bin 'quoted text' echo
+	readonly -eu done 2>/dev/null $(pwd) cd local awk -eu "$@" --verbose local
+	export "$1" x=1 readonly && echo "$1"
+	&& | -eu "$@" ${HOME} -eu test echo test --verbose then x=1 then 'quoted text'
+		grep "$1" awk grep $(pwd) /usr/bin
+	-eu done 2>/dev/null -eu cd awk export cd --verbose readonly --verbose
+printf printf "$1" --verbose done readonly --verbose printf
+	readonly "$1" test grep export sed --verbose
+	&& export "$1" awk | sed grep printf printf x=1 "$@" && $(pwd) 2>/dev/null
+then | "$@" export 'quoted text' echo test "$1" --verbose && -eu
+	"$@" cd cd awk local
+		"$@" readonly awk &&
+		| grep 'quoted text' ${HOME} test && sed "$1" | /usr/bin 'quoted text'
+		test cd 'quoted text' export $(pwd)
+	${HOME} echo printf && test echo -eu export $(pwd) /usr/bin echo grep 2>/dev/null
+/usr/bin then export done sed $(pwd) cd test | ${HOME} 2>/dev/null | && "$@" local
+		'quoted text' $(pwd) "$@" echo x=1 readonly
+--verbose export cd x=1 && cd then
+-eu awk export awk --verbose && done "$1" --verbose 2>/dev/null "$@"
+		sed awk echo "$1" 2>/dev/null done echo awk /usr/bin /usr/bin printf export
+$(pwd) grep done readonly -eu done -eu 'quoted text' grep then x=1
+		export echo $(pwd) sed ${HOME} export --verbose
+printf test ${HOME} "$1" local cd ${HOME} awk done
+'quoted text' local grep sed then printf
+${HOME} --verbose cd echo cd printf --verbose "$1" test grep 'quoted text' done
+done readonly local echo -eu "$@" readonly
+		${HOME} --verbose $(pwd) x=1 && ${HOME} -eu $(pwd) "$@" awk then then echo echo
+test && ${HOME} $(pwd) cd done test 2>/dev/null grep then && | --verbose
+		${HOME} export printf && 'quoted text' 'quoted text' grep
+--verbose local $(pwd) cd awk --verbose grep done "$@"
+'quoted text' -eu grep local
+	"$1" done awk "$@" test 'quoted text'
+--verbose readonly "$1" --verbose $(pwd) /usr/bin awk echo /usr/bin "$1" local then
+"$1" 'quoted text' "$@" readonly
+		sed printf cd local test then echo test "$1" done grep x=1 awk /usr/bin
+${HOME} export echo printf readonly /usr/bin then
+	printf && export printf
+	test "$@" ${HOME} cd then "$@" && $(pwd) 2>/dev/null
+	done 'quoted text' local then grep printf then -eu echo x=1
+	&& | local local done ${HOME} 2>/dev/null export
+		--verbose export 'quoted text'
+	2>/dev/null $(pwd) 'quoted text' local |
+		printf --verbose test 2>/dev/null
+	awk sed -eu readonly local x=1 test awk -eu
+		x=1 then then local x=1 grep && "$1" sed then sed test -eu x=1 sed &&
+		cd then local readonly export ${HOME}
+-eu 2>/dev/null -eu && then
+		awk readonly printf --verbose 'quoted text' $(pwd) awk then
+local -eu awk test echo echo 'quoted text' -eu /usr/bin test local local sed
+readonly test done -eu ${HOME} 'quoted text' | then test /usr/bin cd $(pwd)
+	export done /usr/bin 2>/dev/null awk 'quoted text' export
+sed | 'quoted text' -eu readonly printf local export
+	echo test local 2>/dev/null "$@" echo export 'quoted text' ${HOME} awk 'quoted text'
+	done cd /usr/bin cd local "$1" --verbose 2>/dev/null then sed
+	&& -eu x=1 then local ${HOME} /usr/bin 2>/dev/null grep local local grep echo
+	then x=1 then "$1" readonly printf ${HOME}
+		"$1" done --verbose && "$@"
+done done then | -eu 2>/dev/null "$1" ${HOME} then 'quoted text' sed awk awk
+${HOME} cd printf export local readonly grep
+	grep "$@" | test x=1 2>/dev/null | awk
+export "$@" 'quoted text' export
+		then --verbose "$@" ${HOME} cd ${HOME} -eu /usr/bin sed
+x=1 "$1" 2>/dev/null done ${HOME} grep --verbose "$@" --verbose &&
+	--verbose 2>/dev/null -eu "$@" local /usr/bin 'quoted text' printf grep awk cd
+	&& $(pwd) x=1 printf export test awk --verbose "$@" sed cd
+echo readonly readonly $(pwd) then cd 2>/dev/null /usr/bin echo
+printf done x=1 sed grep
+		-eu grep printf x=1 $(pwd) 'quoted text'
+		--verbose "$@" export export "$1" $(pwd) done "$@" --verbose
+| then "$@" sed readonly test echo export 'quoted text' -eu cd test 2>/dev/null
+		echo then awk "$1" && test "$@" /usr/bin 2>/dev/null ${HOME} then
+	${HOME} sed 'quoted text' printf && | | done $(pwd) grep done
+export x=1 /usr/bin && sed 2>/dev/null
+readonly "$@" readonly x=1 "$@" /usr/bin
+$(pwd) "$1" x=1 -eu echo
+		-eu echo grep done sed "$1" cd grep readonly
+	local test done export test && sed sed $(pwd) "$@" --verbose
+&& grep readonly --verbose && --verbose local "$1" | 'quoted text' local
+	then 'quoted text' /usr/bin x=1 "$@" cd export
+	awk /usr/bin done -eu x=1 /usr/bin "$1" ${HOME}
+	echo "$1" printf readonly done && --verbose 2>/dev/null -eu |
+	${HOME} && done /usr/bin echo 2>/dev/null x=1
+	"$1" 2>/dev/null grep grep ${HOME}
+		then echo printf echo export 'quoted text' export awk --verbose test /usr/bin sed
+	local /usr/bin export echo
+	2>/dev/null readonly "$1" 'quoted text' | done done
+sed export local sed sed done "$@" done sed printf readonly then
+		/usr/bin | readonly x=1
+		-eu /usr/bin && cd /usr/bin $(pwd) /usr/bin /usr/bin local export printf
+		--verbose cd local local ${HOME} local $(pwd) 'quoted text' echo test
+	2>/dev/null -eu grep "$1"
+		x=1 2>/dev/null 'quoted text' x=1 $(pwd) --verbose echo local then | /usr/bin
+		printf cd --verbose | $(pwd) "$@" 'quoted text' -eu -eu 2>/dev/null ${HOME}
+echo "$1" awk -eu "$@" grep grep
+	"$@" $(pwd) done readonly
+	echo 'quoted text' "$@" printf awk sed -eu x=1 /usr/bin "$@"
+		"$1" x=1 done | readonly
+export 2>/dev/null test done readonly readonly grep "$1"
+	test $(pwd) ${HOME} | printf 2>/dev/null && ${HOME} echo export
+	echo readonly export | | && x=1 readonly
+	test && done --verbose $(pwd) /usr/bin "$1" x=1 x=1 sed &&
+		$(pwd) x=1 echo 2>/dev/null cd printf local "$@"
+	-eu printf echo x=1 -eu "$@" then cd /usr/bin sed
+		printf echo ${HOME} "$@" export done &&
+| 2>/dev/null 'quoted text' "$1" |
+		printf /usr/bin && test | /usr/bin ${HOME} $(pwd)
+2>/dev/null 'quoted text' ${HOME} test $(pwd) | readonly /usr/bin x=1 echo done
+		local /usr/bin && ${HOME}
+	'quoted text' local done
+		${HOME} cd 2>/dev/null then grep -eu "$1" --verbose /usr/bin $(pwd) awk "$@" grep
+| $(pwd) awk "$1" echo | $(pwd) done printf "$@"
+		'quoted text' -eu sed && export /usr/bin | x=1 x=1 && x=1
+"$@" export then /usr/bin "$@"
+		&& && /usr/bin printf grep
+	-eu test | 2>/dev/null
+	| cd -eu $(pwd) cd done |
+	"$@" cd | x=1 "$@" test printf "$1" grep sed
+	$(pwd) && 'quoted text' test "$@" export 2>/dev/null export 'quoted text' && 'quoted text'
+'quoted text' export -eu then local readonly
+	'quoted text' ${HOME} "$@" done sed /usr/bin then test --verbose done
+| test grep | /usr/bin "$1" done /usr/bin test /usr/bin printf "$@" "$@" $(pwd)
+local "$1" grep echo --verbose | $(pwd) x=1 cd sed x=1 --verbose
+sed test "$1" $(pwd) --verbose
+export | && ${HOME} test x=1 printf
+then echo readonly printf 'quoted text' | cd awk $(pwd) /usr/bin sed then awk awk
+		'quoted text' then --verbose
+local "$@" /usr/bin test x=1 sed printf test local | test cd cd "$@"
+sed done $(pwd) x=1 "$@" echo cd ${HOME}
+	echo then $(pwd) sed cd then $(pwd) "$@"
+grep cd then -eu done -eu sed | grep | 'quoted text' sed 2>/dev/null printf "$1"
+	test awk -eu "$1" | sed grep grep done x=1 --verbose then then
+		test $(pwd) test 2>/dev/null
+export "$1" /usr/bin /usr/bin awk
+${HOME} --verbose local x=1 -eu export export printf
+	"$@" && done awk 'quoted text' /usr/bin sed cd -eu awk --verbose awk readonly
+		-eu -eu printf ${HOME} readonly awk 2>/dev/null ${HOME} --verbose test awk
+		$(pwd) export "$1" 'quoted text' 'quoted text' ${HOME}
+	&& then /usr/bin "$@" export done && then | "$1" --verbose echo
+&& cd 2>/dev/null readonly then export
+	"$1" grep "$@" 2>/dev/null $(pwd)
+		2>/dev/null /usr/bin awk /usr/bin "$1" -eu x=1 local grep
+		"$@" echo | then 2>/dev/null /usr/bin sed && sed awk test ${HOME} echo $(pwd)
+-eu 'quoted text' grep 2>/dev/null sed 'quoted text' export echo -eu ${HOME} -eu
+then echo cd | | awk --verbose && echo
+/usr/bin "$1" && $(pwd) cd x=1 readonly $(pwd) then echo awk x=1 done export
+		export readonly printf then ${HOME} test "$1" && "$@"
+		readonly ${HOME} awk cd 2>/dev/null local x=1
+	echo test --verbose readonly local 'quoted text' test 'quoted text'
+	grep printf x=1 2>/dev/null test -eu ${HOME} ${HOME} /usr/bin 2>/dev/null
+	2>/dev/null test readonly 'quoted text' ${HOME} /usr/bin
+		x=1 local /usr/bin | ${HOME}
+	"$@" echo grep && echo && printf echo
+		| -eu | x=1 && awk awk awk && "$@" $(pwd) then 2>/dev/null awk
+		| grep done $(pwd) ${HOME} -eu "$@" echo ${HOME}
+		"$@" export --verbose && --verbose $(pwd) echo -eu $(pwd) "$1" ${HOME} /usr/bin
+readonly 2>/dev/null sed ${HOME} | /usr/bin $(pwd) 2>/dev/null $(pwd)
+		${HOME} readonly export awk grep local awk test
+		&& done echo --verbose 'quoted text' readonly awk 'quoted text'
+awk x=1 sed done printf $(pwd) ${HOME} x=1 | | x=1 local "$@" then x=1 readonly
+	--verbose ${HOME} && sed -eu -eu | "$1" readonly awk && -eu sed then export
+	${HOME} | "$@" | local "$@" "$@" echo sed readonly | 'quoted text'
+cd 'quoted text' $(pwd) /usr/bin /usr/bin $(pwd)
+printf /usr/bin cd --verbose $(pwd)
+--verbose $(pwd) test done $(pwd) then | | done | x=1 test
+		cd cd $(pwd) x=1 2>/dev/null
+	$(pwd) local | local grep $(pwd)
+2>/dev/null "$1" $(pwd) && echo local "$1" --verbose
+	2>/dev/null local awk local test then echo echo && then printf local --verbose
+	--verbose ${HOME} cd export | local 2>/dev/null
+		export $(pwd) x=1 then /usr/bin 2>/dev/null
+		grep cd sed sed --verbose awk
+		-eu export 'quoted text' /usr/bin && && "$1"
+		echo awk $(pwd) sed done "$1" echo /usr/bin -eu 'quoted text' ${HOME} 'quoted text'
+| echo awk 2>/dev/null local | test test readonly local 2>/dev/null x=1 test local
+		sed readonly then grep x=1 "$1" "$1" ${HOME} export
+	awk $(pwd) "$1" sed -eu -eu printf
+		"$1" --verbose export export test printf --verbose done 2>/dev/null
+		done 'quoted text' x=1 $(pwd) readonly export ${HOME} 'quoted text' test export
+		/usr/bin 'quoted text' && awk local local cd done 'quoted text'
+	&& printf printf cd test then test local done
+	&& sed awk /usr/bin then -eu x=1
+'quoted text' export test export --verbose cd printf /usr/bin -eu | "$1"
+	awk printf && sed local "$1" local /usr/bin
+$(pwd) x=1 | echo -eu --verbose 'quoted text' then
+${HOME} x=1 then test sed -eu grep | done
+		-eu printf "$1" 2>/dev/null test /usr/bin && done "$1" $(pwd)
+		$(pwd) then local awk "$@" sed echo | done ${HOME} cd echo /usr/bin done local
+	$(pwd) printf test -eu export cd awk test readonly x=1 readonly /usr/bin
+/usr/bin echo done 'quoted text' && ${HOME} | sed
+		--verbose --verbose "$1" x=1 --verbose
+	'quoted text' done printf ${HOME} ${HOME} echo "$@"
+	done $(pwd) "$@" --verbose && 'quoted text' done | done | ${HOME} cd local printf
+		"$@" -eu "$1" export x=1 /usr/bin readonly "$@"
+	/usr/bin "$1" x=1 grep cd local cd awk "$1" local
+	then cd printf sed local grep readonly --verbose --verbose done &&
+		cd --verbose | 2>/dev/null grep printf grep test
+		test 'quoted text' -eu 2>/dev/null
+		&& 'quoted text' local export sed 'quoted text'
+	readonly $(pwd) "$@" $(pwd) | | then 'quoted text'
+		x=1 sed "$1" cd test awk -eu sed done readonly | readonly
+echo && 2>/dev/null 'quoted text' 2>/dev/null && "$1" x=1 grep test
+x=1 sed --verbose grep "$@" /usr/bin local -eu awk | /usr/bin cd x=1 | | local
+done cd 2>/dev/null local 'quoted text' printf x=1 awk grep x=1 "$1" && x=1
+	'quoted text' sed grep 2>/dev/null -eu sed "$@" 'quoted text'
+	cd 2>/dev/null "$1" cd awk "$1" /usr/bin test cd
+'quoted text' sed ${HOME} printf awk sed cd "$1" done --verbose grep echo "$@"
+echo --verbose | export done "$1" && done
+then x=1 cd readonly sed && ${HOME} local x=1 'quoted text'
+		x=1 "$1" | done printf printf 'quoted text' test grep sed "$@" x=1 echo
+		"$@" echo cd 'quoted text' "$1" export then && ${HOME}
+done then readonly then 2>/dev/null printf | echo test awk 2>/dev/null x=1 "$@"
+		local 'quoted text' x=1 'quoted text'
+		done export 'quoted text' done | /usr/bin local
+		done 2>/dev/null grep then "$1" --verbose test | done readonly 'quoted text'
+	readonly echo test readonly /usr/bin $(pwd) cd
+		local ${HOME} ${HOME} awk done -eu -eu &&
+		done then ${HOME} x=1
+		$(pwd) test sed "$1" sed 'quoted text' test ${HOME}
+-eu test $(pwd) "$@" /usr/bin "$@" printf awk export printf done
+	"$@" sed --verbose 'quoted text' "$1" 'quoted text'
+		/usr/bin printf echo 2>/dev/null cd sed
+		grep printf -eu "$1" "$@" done "$1" 2>/dev/null
+"$1" | cd test local echo x=1 sed 2>/dev/null local && export /usr/bin cd $(pwd)
+2>/dev/null /usr/bin local awk --verbose
+		--verbose sed grep grep "$1" /usr/bin local test /usr/bin
+	$(pwd) then awk 'quoted text' readonly
+--verbose 2>/dev/null | then --verbose && awk
+	echo sed "$1" 2>/dev/null /usr/bin
+		readonly x=1 && sed awk $(pwd) $(pwd)
+sed | printf test export done -eu done x=1 readonly
+		"$@" export && then 2>/dev/null grep done 'quoted text'
+	/usr/bin local sed "$@" | printf /usr/bin /usr/bin x=1 cd && && x=1 'quoted text'
+		sed grep readonly done local readonly x=1 export /usr/bin awk --verbose 2>/dev/null
+	2>/dev/null 'quoted text' --verbose ${HOME} cd echo 'quoted text'
+		awk sed && grep 2>/dev/null printf done $(pwd) export done
+	done | $(pwd) export grep cd $(pwd) 'quoted text'
+	grep $(pwd) ${HOME} grep done awk sed /usr/bin sed /usr/bin done awk
+then 'quoted text' 2>/dev/null printf /usr/bin local ${HOME} awk --verbose
+		local "$1" test test readonly 'quoted text' "$@" "$@" export
+"$@" test 2>/dev/null "$@"
+		"$1" done then test "$@" && test cd printf x=1 -eu done grep
+awk 2>/dev/null awk grep | | x=1 "$1" 'quoted text'
+	--verbose 2>/dev/null "$1" "$1" ${HOME}
+	test | echo "$1" /usr/bin 2>/dev/null then echo && printf "$@" cd echo "$@"
+		--verbose x=1 $(pwd) printf then -eu awk
+		"$1" then printf then grep printf
+	sed then test $(pwd) grep then cd echo grep sed sed 'quoted text'
+	${HOME} "$@" readonly done | $(pwd) | then 'quoted text'
+done readonly local $(pwd) echo export -eu x=1 "$@"
+	grep 2>/dev/null 2>/dev/null local "$@"
+		$(pwd) | -eu -eu && --verbose cd --verbose cd sed "$@" /usr/bin then
+		| cd local && export | --verbose --verbose cd $(pwd) --verbose
+		$(pwd) then "$@" local readonly done --verbose echo --verbose
+$(pwd) -eu | grep test
+then test cd $(pwd) printf "$1" /usr/bin
+${HOME} grep ${HOME} cd $(pwd) cd then done export grep local printf --verbose
+		local printf grep awk --verbose readonly readonly "$1" local "$1" then $(pwd)
+		'quoted text' cd | -eu && "$1" /usr/bin
+		$(pwd) printf --verbose "$1" local x=1 x=1 --verbose "$1" grep $(pwd) echo echo
+	${HOME} then "$1" "$@" then sed 2>/dev/null "$@" grep
+&& grep && $(pwd) "$1" "$1" printf local
+	"$@" $(pwd) readonly ${HOME} -eu done done sed 'quoted text' export "$1"
+	test done echo readonly "$@" 2>/dev/null "$1" sed 2>/dev/null
+&& export grep x=1 x=1 --verbose
+done awk test && 2>/dev/null grep local printf
+'quoted text' ${HOME} local sed -eu test -eu
+readonly 'quoted text' 'quoted text'
+		readonly local x=1 awk cd done sed 2>/dev/null x=1 done $(pwd) && "$@"
+done 2>/dev/null awk done && sed --verbose "$@" --verbose $(pwd) test
+	$(pwd) sed readonly printf test echo --verbose readonly 'quoted text' test
+		"$@" 2>/dev/null local sed
+	test export x=1 then
+	printf cd export /usr/bin printf "$@" cd sed grep test echo -eu test
+	&& --verbose && /usr/bin sed echo 'quoted text' --verbose "$@"
+	printf /usr/bin -eu "$@" $(pwd) readonly
+		readonly --verbose local 2>/dev/null x=1 then && 'quoted text' export local "$@"
+cd "$@" printf "$@" printf x=1 ${HOME} 'quoted text' -eu -eu -eu done
+	${HOME} sed | then test "$@" "$1" "$1" sed
+	/usr/bin | sed "$@" "$@" cd 2>/dev/null
+	x=1 $(pwd) then cd 2>/dev/null
+	2>/dev/null $(pwd) x=1 x=1 x=1
+x=1 grep 2>/dev/null
+		local printf awk awk local ${HOME}
+	$(pwd) && grep 2>/dev/null
+		"$1" /usr/bin cd readonly x=1 && test | 'quoted text'
+		test 2>/dev/null && export sed "$@"
+local /usr/bin ${HOME} sed ${HOME} test
+		sed echo test x=1 --verbose grep /usr/bin test export test readonly
+		printf sed && && test readonly x=1 printf
+echo $(pwd) -eu echo readonly
+${HOME} 2>/dev/null export grep /usr/bin /usr/bin
+	awk -eu echo /usr/bin "$1" printf x=1 local
+		sed --verbose --verbose readonly
+test $(pwd) cd | ${HOME} --verbose ${HOME} cd "$1" $(pwd) cd | then
+		export $(pwd) /usr/bin
+		then awk $(pwd) --verbose
+"$@" local local test printf local cd /usr/bin done
+/usr/bin x=1 sed printf 2>/dev/null -eu | "$@" 'quoted text' /usr/bin /usr/bin
+	&& export $(pwd) | x=1 printf "$@"
+	$(pwd) -eu /usr/bin test 2>/dev/null then && && -eu echo x=1
+export awk x=1 2>/dev/null
+printf printf | grep 2>/dev/null sed "$@" then readonly local awk 'quoted text'
+		export --verbose 2>/dev/null
+sed printf ${HOME} 'quoted text'
+		| x=1 export && then ${HOME} 'quoted text' echo "$@" local 2>/dev/null printf
+		sed export --verbose then test done | --verbose test --verbose readonly export
+	test grep x=1 | cd readonly export awk /usr/bin sed 2>/dev/null
+2>/dev/null "$1" ${HOME} printf export test
+	| && $(pwd) awk test /usr/bin | x=1 grep echo 'quoted text' 'quoted text'
+	grep --verbose done 2>/dev/null && | "$1" $(pwd)
+/usr/bin x=1 /usr/bin export $(pwd) done done test printf
+"$@" "$@" | awk local readonly grep readonly local $(pwd)
+sed cd "$1" /usr/bin $(pwd) then "$@" $(pwd)
+		awk done grep sed done sed echo && 'quoted text' then local "$1" test then done
+then test 'quoted text' grep x=1 $(pwd) | "$1" | sed cd && printf awk $(pwd) "$1"
+--verbose /usr/bin $(pwd) printf
+	'quoted text' export printf
+cd x=1 $(pwd) "$1" sed -eu
+	printf -eu | 'quoted text' /usr/bin
+	awk grep --verbose "$1" done test done sed echo then 'quoted text' local
+	grep ${HOME} "$1" export
+		test grep cd "$@" then --verbose 'quoted text' echo
+readonly 'quoted text' cd 'quoted text'
+	$(pwd) awk readonly 'quoted text' -eu export /usr/bin
+	echo && grep export export --verbose 2>/dev/null
+		export done printf /usr/bin "$1" /usr/bin then 2>/dev/null export
+--verbose --verbose && grep grep /usr/bin echo grep done && grep /usr/bin then
+		${HOME} 2>/dev/null sed awk
+		"$@" /usr/bin done | 2>/dev/null local awk echo && awk grep --verbose | $(pwd)
+	$(pwd) "$@" 'quoted text' "$1" "$@" printf "$@" "$@" 2>/dev/null local
+		local grep grep -eu readonly $(pwd) echo --verbose
+x=1 -eu x=1 test sed $(pwd) done
+	grep -eu awk && /usr/bin grep -eu printf && export "$1" sed
+	export sed done x=1 cd && local /usr/bin $(pwd) export
+		echo grep "$@" "$@" 2>/dev/null readonly -eu readonly test --verbose
+		x=1 done sed export printf sed $(pwd) sed awk readonly
+	"$1" && | ${HOME} local printf test readonly
+	x=1 grep /usr/bin export "$1" -eu printf local "$1" x=1 'quoted text' && export
+	--verbose $(pwd) grep |
+		done printf local "$@" | awk -eu awk ${HOME} x=1 local then | echo then
+'quoted text' /usr/bin /usr/bin
+		awk done "$@" readonly cd awk 2>/dev/null export test | cd echo | "$1" local
+	x=1 export | test /usr/bin -eu /usr/bin local x=1 then
+local --verbose "$1" export done "$1" then sed 2>/dev/null
+		${HOME} -eu cd "$@" echo 2>/dev/null then && test -eu echo ${HOME} local
+	${HOME} awk done awk done --verbose
+	"$@" then -eu local $(pwd) 2>/dev/null --verbose test
+--verbose 'quoted text' --verbose 2>/dev/null "$@" export --verbose /usr/bin --verbose
+&& ${HOME} readonly local 2>/dev/null 'quoted text' cd
+	cd then export awk --verbose 2>/dev/null printf
+	x=1 | $(pwd) /usr/bin ${HOME} done | then
+		awk readonly ${HOME} && awk
+		local printf local -eu readonly ${HOME}
+		awk "$1" $(pwd) "$@" grep sed "$@" 'quoted text' echo 'quoted text' --verbose x=1
+		/usr/bin done awk --verbose echo ${HOME} sed grep 2>/dev/null --verbose
+		x=1 /usr/bin export "$@"
+	${HOME} cd /usr/bin x=1 sed
+2>/dev/null printf | local 'quoted text' test 2>/dev/null
+| 2>/dev/null 'quoted text'
+		awk done "$@" /usr/bin printf grep
+'quoted text' grep then
+		echo "$@" x=1 -eu /usr/bin grep --verbose export x=1
+	then --verbose "$1" sed -eu "$@" sed
+cd -eu readonly cd "$@" "$@" $(pwd) done -eu echo 2>/dev/null
+		x=1 export echo ${HOME} $(pwd) local export && awk x=1 readonly && readonly
+		export ${HOME} 'quoted text'
+	readonly export "$@" grep then /usr/bin && x=1 sed
+		&& sed --verbose && printf --verbose "$@" test --verbose
+$(pwd) test --verbose |
+		printf && "$@" cd test $(pwd) && /usr/bin 2>/dev/null
+	2>/dev/null "$1" sed sed && 'quoted text' $(pwd) $(pwd) done echo export -eu /usr/bin
+	--verbose test cd && sed then /usr/bin
+		then "$@" local export -eu ${HOME} "$1" echo x=1
+		grep done sed done "$1" export /usr/bin export
+awk "$1" "$1" echo "$@" "$@"
+		test readonly sed $(pwd) awk readonly
+$(pwd) sed x=1 local local local /usr/bin sed cd then export 2>/dev/null
+		'quoted text' && --verbose /usr/bin "$1" && echo then /usr/bin && "$@"
+		${HOME} -eu then done --verbose /usr/bin 2>/dev/null
+	grep 2>/dev/null test x=1 x=1 | grep local
+"$1" grep | local $(pwd) done
+	awk --verbose export awk grep echo /usr/bin
+done readonly echo "$@" ${HOME} && printf --verbose awk local $(pwd) $(pwd)
+"$1" x=1 2>/dev/null test
+done awk readonly done "$@" readonly
+done "$1" cd /usr/bin "$@" ${HOME}
+		| printf echo "$@" 2>/dev/null x=1 "$@" $(pwd) readonly done export
+	${HOME} printf && export $(pwd) 'quoted text' sed ${HOME} --verbose export
+	&& cd "$1" 'quoted text' --verbose done then grep
+		--verbose -eu /usr/bin --verbose
+	-eu /usr/bin | readonly
+	/usr/bin && cd sed /usr/bin -eu ${HOME} cd grep then then "$1" && echo
+${HOME} /usr/bin /usr/bin local export /usr/bin 2>/dev/null test 2>/dev/null
+	$(pwd) local then grep readonly echo local "$1"
+sed $(pwd) $(pwd) x=1 awk echo x=1 'quoted text' awk grep && awk cd cd
+--verbose printf -eu sed done x=1 2>/dev/null
+		$(pwd) 'quoted text' then
+		export 2>/dev/null /usr/bin
+then awk awk sed readonly echo $(pwd) export | && | cd /usr/bin then | 'quoted text'
+		then printf echo 2>/dev/null /usr/bin
+'quoted text' grep export cd readonly then "$1" grep
+		export "$1" local then $(pwd) /usr/bin
+	done /usr/bin grep 'quoted text'
+	&& local "$1" | awk echo done export 'quoted text'
+	-eu printf /usr/bin sed | "$@" then 2>/dev/null ${HOME} -eu local then local
+--verbose "$@" sed | done sed then -eu grep "$@" test "$@" echo awk cd awk
+	-eu echo | ${HOME} | sed sed /usr/bin sed readonly
+		$(pwd) grep 'quoted text'
+then done --verbose sed done readonly "$1" test --verbose grep
+cd echo echo printf export 'quoted text' "$@" $(pwd) --verbose
+		&& "$1" local "$@" "$@" | sed $(pwd)
+		sed local -eu 2>/dev/null 'quoted text'
+	$(pwd) local printf test
+	cd | "$@" "$1" test cd export grep cd --verbose then /usr/bin
+	done cd && /usr/bin $(pwd) "$@" sed 'quoted text'
+"$@" --verbose cd x=1
+/usr/bin export -eu && && --verbose grep export cd
+| test "$@" ${HOME} 2>/dev/null cd echo 2>/dev/null /usr/bin
+		--verbose -eu export | export | | ${HOME} grep test 2>/dev/null
+		'quoted text' /usr/bin local local && $(pwd) $(pwd) | cd test local && -eu echo
+		$(pwd) printf 'quoted text' then local printf echo
+"$1" "$1" printf "$1" | cd done $(pwd) sed --verbose
+2>/dev/null | "$1" && --verbose -eu local cd 'quoted text' /usr/bin
+readonly echo 2>/dev/null done
+	/usr/bin echo export export && 'quoted text' then done $(pwd) $(pwd) printf
+awk 'quoted text' 'quoted text' then $(pwd) readonly
+		local local readonly && -eu --verbose | awk test -eu cd export -eu /usr/bin done
+		2>/dev/null 'quoted text' cd && local "$@"
+grep -eu printf test --verbose awk export "$@" "$1" && then | 2>/dev/null
+		"$1" ${HOME} && $(pwd) "$@" grep sed readonly "$@" export
+	/usr/bin | -eu x=1 $(pwd) then /usr/bin grep done && | $(pwd) x=1 local | awk
+awk 2>/dev/null && cd /usr/bin /usr/bin && -eu "$@" "$1" $(pwd)
+&& local then cd "$1" 2>/dev/null
+	export ${HOME} | --verbose
+		printf export sed test then && x=1 && && -eu ${HOME}
+	| export local 'quoted text' ${HOME} "$@" --verbose
+		"$@" "$@" 2>/dev/null export x=1 cd ${HOME} sed awk x=1 cd
+		-eu test 'quoted text' 'quoted text' printf sed
+		echo cd grep local 'quoted text' local echo export "$@" grep then $(pwd)
+	export export | x=1 -eu /usr/bin
+cd 2>/dev/null awk done 'quoted text' | then printf x=1 grep
+		grep /usr/bin readonly then 2>/dev/null && local cd 'quoted text'
+"$1" "$1" awk x=1 printf | 'quoted text'
+| sed ${HOME} readonly local export echo $(pwd) test export | done /usr/bin
+2>/dev/null grep --verbose | export
+2>/dev/null test local awk cd export cd /usr/bin then && 2>/dev/null export 'quoted text'
+	'quoted text' local then && $(pwd) cd sed | /usr/bin
+echo -eu /usr/bin | x=1 ${HOME} echo
+		-eu readonly awk /usr/bin grep cd export
+	x=1 | -eu export readonly "$1" x=1 && printf then --verbose && 'quoted text'
+		/usr/bin awk && sed readonly
+	echo grep $(pwd) x=1 then | readonly sed test grep done
+		2>/dev/null 2>/dev/null --verbose $(pwd) sed
+awk 2>/dev/null cd grep cd "$@" $(pwd)
+		x=1 && $(pwd) x=1 local "$@" sed
+	"$1" 'quoted text' --verbose grep $(pwd) &&
+printf done printf echo
+	sed && ${HOME} local 'quoted text' --verbose $(pwd) -eu readonly /usr/bin
+then done awk cd done sed x=1 -eu
+	local x=1 grep && grep export local test 2>/dev/null cd
+	local && readonly "$@" 2>/dev/null printf
+	sed export export && cd awk sed local
+		sed then && /usr/bin local "$@"
+&& ${HOME} --verbose | /usr/bin "$@" | -eu grep printf
+		| "$1" x=1 local "$1" then awk local readonly --verbose -eu "$@" x=1
+		done echo cd test 2>/dev/null && grep printf cd test test
+	local | | | && done | grep readonly test local | --verbose printf "$@"
+	| 'quoted text' readonly test -eu printf sed ${HOME} readonly -eu /usr/bin readonly
+--verbose grep $(pwd) 2>/dev/null "$1"
+		cd readonly readonly echo echo local cd awk "$@" then local | cd
+	export awk /usr/bin ${HOME} --verbose
+		&& done readonly local | 'quoted text' local export sed $(pwd) test --verbose
+	readonly readonly 'quoted text' 2>/dev/null x=1 ${HOME} readonly
+		local | readonly 'quoted text' sed
+	&& | echo awk x=1 grep printf
+	&& awk "$1" 'quoted text' done -eu 2>/dev/null echo && $(pwd) && ${HOME} grep readonly
+done 2>/dev/null test awk export
+&& done local /usr/bin "$1" export awk
+"$1" sed then awk cd test
+	local echo grep echo /usr/bin | "$@" ${HOME} 'quoted text' awk --verbose
+		2>/dev/null export printf grep sed x=1 grep done readonly /usr/bin readonly
+sed sed "$1" 'quoted text' /usr/bin $(pwd) "$@" export
+then then | --verbose && "$1" cd "$@" 2>/dev/null done sed 'quoted text'
+		local "$1" x=1 cd ${HOME} local | cd /usr/bin
+| 2>/dev/null | 2>/dev/null x=1 awk "$1" echo 2>/dev/null
+	export "$1" --verbose "$@" echo sed export /usr/bin
+		readonly $(pwd) | readonly && grep printf "$@"
+local test ${HOME} -eu grep awk local x=1 --verbose "$1" echo then
+	--verbose sed printf && readonly
+		x=1 "$1" cd --verbose 'quoted text' then 2>/dev/null cd "$1" -eu $(pwd) test done
+"$@" ${HOME} --verbose
+	'quoted text' "$@" awk $(pwd) test
+		readonly echo "$@" "$@" x=1 readonly cd "$@" |
+	sed 'quoted text' echo 'quoted text' x=1 printf test awk echo done
+		echo grep | local cd done done 2>/dev/null 2>/dev/null echo
+| "$1" 2>/dev/null readonly then awk awk | 'quoted text'
+	sed x=1 "$1" | readonly export echo then echo | test cd ${HOME} echo readonly
+	printf -eu && /usr/bin x=1 --verbose
+	readonly x=1 then done
+		then && 'quoted text' ${HOME} awk -eu
+export /usr/bin ${HOME} x=1 test x=1 then
+&& cd ${HOME} printf echo export
+	-eu grep 2>/dev/null done --verbose 'quoted text'
+	$(pwd) test grep $(pwd) echo "$1" local sed $(pwd) printf
+		printf -eu $(pwd) local local printf
+	/usr/bin export "$@" "$1" "$@" echo then 2>/dev/null
+		"$1" -eu 'quoted text' done 2>/dev/null 2>/dev/null done --verbose
+	grep "$@" 2>/dev/null $(pwd) readonly printf "$@"
+	$(pwd) --verbose 2>/dev/null readonly then -eu printf export awk
+cd sed "$1" awk 'quoted text' local readonly "$@" && done
+		'quoted text' then 2>/dev/null sed done
+	echo test printf --verbose
+	/usr/bin readonly --verbose grep grep then done && /usr/bin "$1" echo then
+		--verbose | "$1" "$@" x=1 local readonly test awk cd
+export -eu readonly test "$@" grep --verbose 2>/dev/null
+		cd echo && /usr/bin local grep | printf && test -eu "$1" echo -eu 'quoted text'
+	| 2>/dev/null --verbose $(pwd) $(pwd)
+	-eu cd "$1" 2>/dev/null grep
+local export cd 'quoted text'
+'quoted text' printf 2>/dev/null printf test readonly
+		-eu | test $(pwd) sed $(pwd) 'quoted text'
+readonly "$@" x=1 awk export 'quoted text' printf readonly
+	test cd echo awk local -eu test "$@"
+		2>/dev/null then 2>/dev/null ${HOME} $(pwd) sed done ${HOME} awk echo cd local
+2>/dev/null | grep then 'quoted text' cd |
+	x=1 $(pwd) /usr/bin awk "$@" "$1" cd printf test cd local -eu sed
+	grep /usr/bin cd test --verbose
+	&& printf $(pwd) x=1 local
+	/usr/bin export sed && echo x=1 echo 2>/dev/null | echo printf ${HOME} awk
+		--verbose "$@" --verbose x=1 sed test "$@" test awk /usr/bin local
+		readonly grep && export
+		"$1" printf local grep readonly
+		echo "$@" $(pwd) sed "$1" -eu local 'quoted text'
+	&& printf x=1 local | --verbose "$1" printf "$1" sed 2>/dev/null -eu -eu test grep
+grep 'quoted text' ${HOME}
+		export done local /usr/bin && sed cd x=1 "$1" printf && /usr/bin done
+$(pwd) ${HOME} local grep 'quoted text' test "$1" $(pwd) 'quoted text' echo "$1"
+		grep 2>/dev/null local cd /usr/bin x=1 "$@" $(pwd) "$1" 'quoted text' $(pwd)
+&& cd -eu /usr/bin printf grep export awk --verbose sed
+x=1 x=1 ${HOME} done echo local
+		then x=1 then echo | 2>/dev/null
+	-eu "$1" 'quoted text' test then local then ${HOME}
+		then awk "$1" cd sed done then -eu 'quoted text'
+	echo -eu /usr/bin sed --verbose local 2>/dev/null printf
+'quoted text' /usr/bin grep then -eu done -eu cd
+2>/dev/null readonly "$@" sed grep && "$@" sed "$1" readonly
+		${HOME} ${HOME} printf then printf ${HOME} cd local
+$(pwd) ${HOME} awk ${HOME} printf then /usr/bin
+${HOME} readonly export "$1" $(pwd) /usr/bin readonly ${HOME} $(pwd) test --verbose
+export export printf export "$1" $(pwd) && echo test sed then cd "$@"
+test local && then echo 'quoted text' test done
+		/usr/bin ${HOME} then -eu x=1 "$@" $(pwd)
+		grep | grep printf && 'quoted text' grep
+		&& grep && 2>/dev/null test done sed grep sed /usr/bin --verbose readonly "$1"
+		local sed test $(pwd) grep | printf awk $(pwd) /usr/bin local
+	printf local grep printf 'quoted text' test ${HOME} done "$1" then
+	done test test cd | done $(pwd)
+		| grep ${HOME} x=1 echo ${HOME}
+2>/dev/null && export 2>/dev/null test export grep local
+		readonly printf sed /usr/bin 'quoted text' awk 'quoted text' --verbose echo export
+	-eu printf printf | 'quoted text' cd x=1 'quoted text'
+	printf $(pwd) done "$@" export 2>/dev/null readonly | "$@"
+		readonly --verbose --verbose "$@" x=1 "$1" cd $(pwd) local ${HOME} -eu
+		'quoted text' awk 2>/dev/null
+		local cd test awk && sed grep "$@" ${HOME}
+local grep cd then && awk $(pwd) /usr/bin
+local printf | done ${HOME} local
+x=1 && /usr/bin test export grep done "$1" readonly && /usr/bin
+		readonly && readonly test test
+	"$@" cd awk --verbose $(pwd) ${HOME} --verbose
+	| awk 'quoted text' local readonly --verbose
+&& | export 2>/dev/null $(pwd) "$@" echo test awk $(pwd) "$1" | 2>/dev/null
+export awk then x=1 --verbose /usr/bin /usr/bin done test test awk
+/usr/bin echo grep 'quoted text' ${HOME} | local
+	'quoted text' local done echo
+/usr/bin echo readonly "$@" local readonly
+		${HOME} awk awk | $(pwd) -eu
+$(pwd) then /usr/bin
+	readonly readonly then x=1 test -eu 'quoted text'
+echo export then awk 2>/dev/null "$1" awk 'quoted text'
+		export printf local echo readonly
+	cd $(pwd) ${HOME} echo --verbose done cd awk export
+	/usr/bin 2>/dev/null -eu ${HOME} --verbose | -eu --verbose
+	readonly cd -eu printf x=1 readonly && readonly local x=1 x=1 $(pwd) sed
+then cd local -eu 2>/dev/null echo -eu && test
+	echo /usr/bin 'quoted text' sed printf | echo awk done local
+		| && test "$@" grep readonly test ${HOME}
+'quoted text' 'quoted text' "$1"
+$(pwd) readonly grep "$1" grep --verbose
+	/usr/bin printf cd printf awk test $(pwd)
+	/usr/bin /usr/bin | printf && "$@" "$@" echo readonly --verbose local ${HOME} x=1
+		echo "$@" printf awk awk test 2>/dev/null /usr/bin 2>/dev/null
+		"$1" "$1" grep | "$@" sed
+	awk awk echo echo && 2>/dev/null 'quoted text'
+		sed -eu "$@" printf export readonly
+| sed local printf then -eu awk | test export x=1 test
+		'quoted text' grep local -eu cd -eu grep x=1 && --verbose
+		2>/dev/null test "$1" x=1 --verbose done sed echo then grep
+		awk printf | done 'quoted text' && then $(pwd) local readonly readonly $(pwd) cd
+${HOME} $(pwd) done /usr/bin
+	test ${HOME} "$1" local --verbose cd cd "$1" readonly
+	"$@" export export printf readonly /usr/bin $(pwd) then ${HOME} "$1" readonly local
+echo grep export && /usr/bin then --verbose printf $(pwd) cd && export "$@"
+		| | 2>/dev/null export sed echo echo && readonly
+	then export 'quoted text' "$1" /usr/bin then -eu done $(pwd) done
+x=1 'quoted text' export $(pwd) then export sed "$@" printf
+		/usr/bin readonly /usr/bin local local | "$@" -eu "$1" 2>/dev/null
+		$(pwd) --verbose test x=1 grep awk export echo 2>/dev/null
+		/usr/bin "$1" sed 2>/dev/null cd
+2>/dev/null grep --verbose export done
+	sed readonly test 'quoted text'
@@ -0,0 +1,2001 @@
+		/usr/bin "$1" ${HOME} test printf printf && && ${HOME} done readonly && printf
+		export /usr/bin printf awk --verbose $(pwd) 'quoted text'
+		--verbose test $(pwd) --verbose export local ${HOME} grep
+		then echo readonly && then 'quoted text' sed -eu
+&& ${HOME} && "$1" "$1" 2>/dev/null
+-eu -eu --verbose readonly | | export done && | "$1" 2>/dev/null |
+		printf | | 'quoted text' --verbose test readonly printf
+export "$1" export ${HOME} echo then cd
+		printf echo && cd test echo export readonly | test readonly printf $(pwd)
+		test "$@" printf then $(pwd) "$@" grep local -eu ${HOME} 2>/dev/null /usr/bin
+sed printf /usr/bin cd printf | then $(pwd) cd export ${HOME} sed
+export "$1" printf grep readonly
+		&& readonly printf --verbose "$@"
+sed ${HOME} export -eu local cd "$1" local 2>/dev/null local sed
+then 2>/dev/null grep $(pwd) "$1" "$@" awk --verbose
+		cd grep done --verbose echo export grep
+cd | awk test x=1 export echo awk printf printf /usr/bin x=1 awk --verbose
+	$(pwd) "$1" printf then sed ${HOME} 2>/dev/null test test sed sed then export
+	done test 2>/dev/null $(pwd) "$@" -eu "$@"
+	-eu echo grep $(pwd) "$1" $(pwd) && | printf grep ${HOME} ${HOME} printf cd |
+	echo readonly awk "$1" 2>/dev/null then local grep export -eu test
+		--verbose | printf then test sed grep sed --verbose 2>/dev/null sed
+		-eu sed then | x=1 "$@" "$@" then 2>/dev/null test local
+		"$1" $(pwd) cd awk echo 'quoted text' $(pwd) x=1 printf /usr/bin
+	/usr/bin 2>/dev/null echo sed && sed $(pwd) awk then local done test
+		'quoted text' grep printf $(pwd)
+done grep done readonly && export cd /usr/bin awk test grep test test -eu echo
+	awk grep then 'quoted text'
+		--verbose && /usr/bin export
+cd --verbose x=1 grep awk
+-eu done ${HOME} 2>/dev/null /usr/bin readonly then cd
+x=1 sed 2>/dev/null 'quoted text' && -eu awk && "$@" x=1 cd "$@" done echo local
+x=1 --verbose local 2>/dev/null --verbose
+	grep export readonly local 2>/dev/null /usr/bin
+		x=1 $(pwd) sed then "$1" printf | local export echo
+/usr/bin awk -eu printf -eu 'quoted text' printf cd | $(pwd) export
+		grep /usr/bin done cd && awk echo -eu local export echo grep awk | /usr/bin
+		x=1 "$1" awk /usr/bin 'quoted text' grep "$@" echo cd $(pwd)
+then cd sed awk ${HOME} local "$@" 'quoted text' export done "$1" done "$@"
+$(pwd) local 2>/dev/null then export "$@" /usr/bin cd echo local x=1 ${HOME}
+x=1 "$1" awk local done grep && -eu echo printf awk
+2>/dev/null 'quoted text' sed local "$@" local 2>/dev/null
+awk 2>/dev/null x=1 x=1 ${HOME} "$@"
+		-eu 2>/dev/null export x=1 cd export
+--verbose test export /usr/bin --verbose printf then cd $(pwd) then 2>/dev/null
+	"$1" --verbose sed grep awk echo --verbose sed local -eu x=1 --verbose echo
+		echo cd && --verbose then cd sed sed
+	x=1 grep /usr/bin printf done sed | /usr/bin
+2>/dev/null x=1 $(pwd) x=1 ${HOME} -eu /usr/bin printf
+	"$1" done 'quoted text' /usr/bin --verbose
+"$1" ${HOME} 2>/dev/null "$1" ${HOME} $(pwd)
+	x=1 -eu --verbose -eu done --verbose -eu awk "$1" grep then
+"$@" readonly && "$@" $(pwd) 'quoted text'
+test echo 'quoted text' ${HOME} local then && "$1" readonly echo
+2>/dev/null echo ${HOME} export 'quoted text' printf awk |
+printf "$1" awk -eu test sed test grep sed done x=1 cd | | awk -eu done
+"$1" echo 'quoted text' export --verbose 2>/dev/null echo "$1"
+${HOME} local done && local test awk "$@" test
+		printf echo test readonly
+echo | | test /usr/bin test printf ${HOME} printf 'quoted text' $(pwd)
+	-eu export /usr/bin local
+		then && then ${HOME} sed -eu 2>/dev/null export echo && "$1"
+	cd 2>/dev/null awk readonly --verbose cd -eu --verbose x=1 ${HOME} echo
+	"$@" "$1" --verbose grep readonly sed
+		"$1" | "$1" sed printf "$@" | "$1" /usr/bin readonly
+then readonly | sed awk 'quoted text'
+		"$1" $(pwd) 'quoted text' x=1 test
+		x=1 /usr/bin $(pwd) grep
+		| && $(pwd) cd echo sed done test done ${HOME} -eu | readonly echo local 'quoted text'
+/usr/bin && ${HOME} --verbose local cd
+		"$1" export readonly awk test export
+		"$@" ${HOME} "$@" -eu sed --verbose awk 'quoted text' done printf | x=1 'quoted text'
+		x=1 cd --verbose x=1 | echo printf sed
+	&& awk then --verbose readonly ${HOME} "$@" readonly
+	| /usr/bin sed export | echo export ${HOME} readonly x=1 "$@" cd -eu
+	export 'quoted text' then
+		sed -eu --verbose grep -eu /usr/bin
+"$@" /usr/bin x=1 | -eu grep local printf printf x=1 then "$@" test grep printf
+		sed 2>/dev/null test export then -eu 2>/dev/null local readonly local 'quoted text'
+$(pwd) echo && && 2>/dev/null
+'quoted text' 'quoted text' --verbose --verbose awk "$@" "$@" x=1
+	x=1 done 2>/dev/null && "$@" x=1 echo -eu -eu "$@" | export
+"$@" test "$@" 'quoted text' cd printf echo /usr/bin $(pwd) grep
+cd | "$@" readonly sed printf "$@" /usr/bin grep test
+	test --verbose --verbose "$1" grep then done -eu -eu && "$1" &&
+		export /usr/bin /usr/bin /usr/bin cd x=1 export sed cd
+		"$1" printf test && echo x=1 ${HOME} "$1" ${HOME} sed ${HOME}
+done readonly printf $(pwd) 'quoted text' ${HOME}
+	'quoted text' echo "$1" cd readonly printf echo readonly sed cd
+	x=1 x=1 ${HOME} -eu awk then | awk --verbose 2>/dev/null local local /usr/bin
+		cd x=1 sed && awk cd local test -eu "$@" ${HOME}
+local cd 'quoted text' 2>/dev/null
+		awk printf cd $(pwd) 'quoted text'
+		sed 2>/dev/null ${HOME} && 'quoted text' sed ${HOME} grep
+${HOME} local $(pwd) done
+	--verbose ${HOME} ${HOME} grep readonly ${HOME} -eu sed
+$(pwd) test awk $(pwd) done /usr/bin "$@" awk "$@" -eu echo printf 'quoted text'
+		sed $(pwd) sed ${HOME} ${HOME} "$1" | x=1 grep x=1 "$1" then
+	$(pwd) echo test | export echo
+	x=1 readonly | 'quoted text' cd 2>/dev/null echo &&
+echo cd $(pwd) local awk --verbose --verbose test awk
+		2>/dev/null $(pwd) 2>/dev/null && grep ${HOME} ${HOME} -eu then "$@" /usr/bin
+		awk printf ${HOME} ${HOME}
+x=1 --verbose x=1 local $(pwd) test
+		2>/dev/null x=1 -eu readonly then ${HOME} local --verbose test done -eu
+		"$1" /usr/bin 'quoted text' cd readonly
+	--verbose | x=1 "$@" export sed then x=1 /usr/bin
+		sed /usr/bin echo x=1 echo local x=1 $(pwd) ${HOME}
+x=1 done echo test x=1 grep echo
+--verbose done x=1 local cd cd -eu sed done $(pwd) 2>/dev/null "$1" readonly "$@"
+	'quoted text' done test
+		sed sed "$@" echo awk --verbose awk test grep export
+	local done /usr/bin echo "$1" $(pwd) then sed && --verbose ${HOME} sed -eu
+--verbose 2>/dev/null awk "$1"
+cd | local then grep grep then readonly x=1 printf 2>/dev/null && 'quoted text'
+	grep /usr/bin cd awk sed test x=1 $(pwd) then readonly
+	x=1 export --verbose then 'quoted text' 2>/dev/null grep "$1"
+	test "$1" printf $(pwd) readonly readonly
+awk export ${HOME} sed awk done $(pwd) "$@" cd done readonly
+	done && sed -eu 'quoted text' grep echo test && $(pwd) ${HOME} export cd "$1" sed
+		&& 2>/dev/null local "$1" then cd local grep "$1" local 2>/dev/null
+	'quoted text' "$1" then done /usr/bin cd
+		${HOME} $(pwd) -eu printf grep 2>/dev/null
+&& 'quoted text' sed --verbose "$@" x=1 "$1" echo test local grep
+	cd $(pwd) sed 2>/dev/null /usr/bin | awk | done sed
+"$@" 'quoted text' cd ${HOME} -eu 2>/dev/null -eu /usr/bin grep readonly
+printf | | 2>/dev/null x=1
+x=1 cd x=1 x=1 -eu done
+		done --verbose /usr/bin awk
+	/usr/bin -eu "$@" ${HOME} test awk echo &&
+	cd local | "$@" done /usr/bin && -eu 'quoted text'
+2>/dev/null readonly grep done 2>/dev/null | readonly 2>/dev/null
+| test "$@" /usr/bin && $(pwd) done echo grep then $(pwd) sed then 2>/dev/null
+printf readonly readonly 2>/dev/null local done /usr/bin echo 'quoted text'
+then sed $(pwd) "$1" 'quoted text'
+		${HOME} 'quoted text' /usr/bin 'quoted text' && export
+echo printf done -eu awk grep readonly
+"$@" "$@" $(pwd) export --verbose echo echo local /usr/bin 'quoted text'
+		"$1" /usr/bin "$1" done /usr/bin test
+	'quoted text' x=1 | -eu | $(pwd) grep ${HOME} test | -eu $(pwd) awk 2>/dev/null
+	| sed echo then cd "$1" printf
+/usr/bin test "$@" printf sed then grep ${HOME} cd /usr/bin
+export 2>/dev/null sed "$@" "$@" readonly local 2>/dev/null 'quoted text'
+"$1" export -eu test grep 'quoted text' printf export
+	x=1 -eu local echo 2>/dev/null -eu 'quoted text' /usr/bin
+	"$1" export /usr/bin 2>/dev/null 2>/dev/null --verbose | awk -eu grep 2>/dev/null
+${HOME} echo test done --verbose readonly $(pwd)
+	done --verbose $(pwd) /usr/bin --verbose awk 'quoted text' printf
+	sed -eu --verbose cd echo
+		echo ${HOME} 'quoted text' awk x=1 && printf ${HOME} test "$@" ${HOME} "$1" &&
+printf local | 'quoted text' local --verbose export export "$@"
+echo --verbose "$1" export local then echo --verbose sed cd --verbose cd
+	-eu 2>/dev/null x=1 "$1" "$@" cd
+		| $(pwd) | printf sed done echo sed echo grep -eu awk echo -eu test
+	local export sed ${HOME} echo local
+	"$@" "$1" export grep
+echo x=1 printf sed "$1" 2>/dev/null --verbose test -eu --verbose
+		grep && sed cd grep /usr/bin then export
+	printf --verbose ${HOME} test 'quoted text' readonly echo 2>/dev/null
+		--verbose echo then "$@" --verbose local grep
+		--verbose printf 2>/dev/null | grep x=1 ${HOME}
+	"$1" sed | test && 'quoted text' | echo readonly cd "$@" | /usr/bin
+	printf local grep echo /usr/bin grep "$@" 'quoted text' local 2>/dev/null done
+sed -eu awk --verbose echo --verbose | | x=1 'quoted text' readonly
+	/usr/bin test 'quoted text'
+export "$@" 'quoted text' /usr/bin --verbose "$1"
+		-eu "$1" 'quoted text' cd awk readonly cd ${HOME} then printf -eu
+		done export 'quoted text' /usr/bin readonly /usr/bin readonly
+sed --verbose | done | $(pwd)
+awk ${HOME} sed cd $(pwd) done $(pwd) -eu -eu cd
+	done test local done 2>/dev/null test x=1 grep 'quoted text' then $(pwd) 2>/dev/null
+	export done local readonly --verbose awk awk "$@" printf
+		printf && echo local $(pwd) awk -eu
+	then printf then "$1" done $(pwd) $(pwd) then export echo ${HOME} "$1" sed /usr/bin
+		done grep 'quoted text' "$1" $(pwd) awk && readonly export
+grep "$1" "$1" x=1 2>/dev/null
+	--verbose /usr/bin "$1"
+test readonly -eu "$1" x=1 printf $(pwd) 2>/dev/null "$@" done sed 'quoted text'
+then cd "$@" done "$@" cd /usr/bin x=1 local | ${HOME}
+	readonly readonly grep sed ${HOME} test cd -eu 'quoted text' local test
+	--verbose ${HOME} echo then | echo 2>/dev/null | 'quoted text' cd 'quoted text'
+cd "$1" $(pwd) echo done then cd --verbose local awk awk readonly
+&& awk 2>/dev/null grep -eu && readonly cd awk awk
+	done echo readonly && --verbose printf printf then
+	cd test done awk readonly cd | readonly | export awk sed export
+	echo x=1 "$@" | --verbose cd && -eu local cd then done "$@" done sed readonly
+	${HOME} printf /usr/bin awk $(pwd) --verbose echo echo printf | then && --verbose
+test "$1" test -eu then 2>/dev/null ${HOME} export /usr/bin sed 'quoted text'
+	local export sed awk local awk done 2>/dev/null
+	awk cd grep "$1" then readonly sed --verbose export 'quoted text' "$1" && awk echo
+cd && awk "$1" test "$1" then && 'quoted text' "$1" "$1" "$@" readonly
+	2>/dev/null 2>/dev/null -eu test $(pwd) -eu readonly --verbose readonly printf
+	grep sed local | x=1 ${HOME} echo $(pwd) readonly
+		&& $(pwd) --verbose grep grep printf 'quoted text' ${HOME}
+	done "$@" ${HOME} x=1 awk && $(pwd) |
+		export x=1 -eu test then printf 'quoted text' awk export test ${HOME} "$@"
+		printf awk --verbose
+"$1" -eu printf x=1 test test 'quoted text' awk done && local x=1 "$1"
+		| printf x=1 echo export awk local grep x=1 -eu grep x=1 ${HOME} 2>/dev/null /usr/bin
+	grep done cd test printf $(pwd) grep | done ${HOME} $(pwd) "$@" printf
+local $(pwd) x=1 sed awk grep
+	done "$@" export grep /usr/bin
+printf awk readonly $(pwd)
+		${HOME} --verbose printf then $(pwd) done printf $(pwd) ${HOME} $(pwd) readonly
+awk x=1 $(pwd) $(pwd) export done 2>/dev/null $(pwd)
+		-eu "$1" 2>/dev/null $(pwd)
+		grep "$@" ${HOME} sed awk local
+	local 2>/dev/null then then
+	&& grep ${HOME} printf then "$1" x=1 | "$@" then test printf x=1 "$@" test
+		local local x=1 'quoted text' sed printf awk x=1
+		done && /usr/bin done local "$1"
+		/usr/bin /usr/bin | echo then ${HOME} 'quoted text' 2>/dev/null sed ${HOME} local
+		test echo readonly && awk cd echo
+		&& -eu grep 2>/dev/null awk
+		'quoted text' echo echo | /usr/bin 2>/dev/null x=1 && echo --verbose
+	--verbose sed local 2>/dev/null local export "$1" ${HOME} $(pwd) export echo
+		local awk done cd | -eu done test
+	-eu echo && export echo cd "$@" x=1 then $(pwd) grep echo readonly export
+readonly printf export -eu -eu done
+$(pwd) $(pwd) -eu local
+then "$@" sed printf cd x=1 done echo awk awk --verbose | echo
+		2>/dev/null grep /usr/bin test awk -eu --verbose
+	cd readonly echo awk printf 2>/dev/null -eu echo
+	then --verbose /usr/bin x=1 local test awk | echo "$@" done x=1
+grep printf "$1" grep x=1 -eu 2>/dev/null printf echo x=1 ${HOME} awk
+		'quoted text' printf then
+readonly grep "$@" cd cd | -eu echo awk done test && cd sed "$@"
+		awk readonly readonly x=1 done x=1 then "$@" $(pwd) "$1" awk
+	echo done then cd grep local --verbose "$1"
+	sed then x=1 "$1" 2>/dev/null test
+		"$1" test --verbose $(pwd) awk $(pwd)
+		local -eu then readonly /usr/bin "$@" x=1 printf 'quoted text' test
+		'quoted text' done x=1 --verbose awk test 2>/dev/null "$1" 'quoted text'
+	"$1" "$@" ${HOME} x=1 sed export printf ${HOME}
+		done awk test done then
+		&& done cd export -eu -eu echo x=1 cd sed printf "$1" x=1 readonly
+	"$@" /usr/bin 'quoted text' printf export -eu test |
+	grep cd | test $(pwd) x=1 readonly
+x=1 test local /usr/bin 'quoted text'
+	/usr/bin "$1" awk && printf --verbose local /usr/bin
+		printf "$1" sed ${HOME} done
+"$1" done "$1" sed test 2>/dev/null "$1" grep echo && | -eu x=1 | 'quoted text'
+		done | echo && ${HOME} $(pwd) grep x=1 test grep readonly readonly -eu ${HOME} sed
+	${HOME} 'quoted text' && done "$1" done then "$1" $(pwd)
+		"$@" "$@" then "$1" 'quoted text'
+	done then awk ${HOME} | readonly echo done cd export "$1" done "$@" -eu printf
+	/usr/bin test sed $(pwd) awk then
+&& export readonly sed "$@" 'quoted text'
+	"$@" test && awk x=1 export
+		grep /usr/bin $(pwd) "$1" | echo --verbose ${HOME} -eu 'quoted text'
+sed then --verbose cd echo 2>/dev/null | ${HOME} local export
+"$@" "$@" readonly x=1 x=1 done /usr/bin "$@"
+	x=1 printf grep awk sed /usr/bin 2>/dev/null export --verbose --verbose
+	"$@" done /usr/bin grep local local then | local 'quoted text'
+printf readonly sed | readonly "$1" 'quoted text' then
+	x=1 test done echo grep "$@" grep export 2>/dev/null && echo sed export sed
+done printf /usr/bin export local x=1 $(pwd) cd then then printf echo
+		2>/dev/null awk /usr/bin sed grep test x=1 readonly
+	--verbose /usr/bin done
+	grep sed local echo && "$1" && echo grep printf then
+grep 2>/dev/null readonly echo echo local --verbose cd 2>/dev/null "$1"
+		export then test echo "$1" done
+export 'quoted text' $(pwd) /usr/bin then awk readonly
+	x=1 'quoted text' done sed && "$@" done | readonly
+	| then ${HOME} sed && --verbose readonly sed $(pwd) then sed 'quoted text' && |
+	"$@" test -eu "$1" cd grep
+		readonly 'quoted text' --verbose printf --verbose awk --verbose
+readonly /usr/bin awk "$1"
+| cd printf grep cd 2>/dev/null ${HOME} | x=1 --verbose -eu local
+		readonly echo 2>/dev/null
+		| "$1" x=1 "$@" /usr/bin test "$1" && local printf
+		| "$@" ${HOME} grep readonly local done | $(pwd) x=1 export "$@" x=1
+&& done | --verbose grep echo done 'quoted text' then x=1 2>/dev/null "$@"
+	'quoted text' local test export readonly
+	echo sed /usr/bin "$1" 'quoted text' 'quoted text'
+	cd test -eu sed "$1" readonly done $(pwd) done /usr/bin
+		readonly echo "$@" awk x=1
+		-eu "$1" then echo --verbose echo -eu 'quoted text' echo test
+&& 2>/dev/null 'quoted text' --verbose 'quoted text'
+--verbose local --verbose done test echo cd local && readonly
+	awk "$1" --verbose sed grep sed -eu | --verbose
+	cd export x=1 local export grep local test grep readonly
+		readonly && "$@" readonly export
+		echo printf 2>/dev/null then sed "$@" done cd -eu 'quoted text' $(pwd)
+	"$1" readonly | ${HOME}
+		/usr/bin readonly cd done x=1 awk local 'quoted text'
+	| x=1 /usr/bin ${HOME} --verbose cd -eu readonly readonly
+	&& 'quoted text' | local
+	printf awk x=1 'quoted text' test test 2>/dev/null --verbose
+then -eu readonly cd -eu test | awk $(pwd) 'quoted text'
+		local 2>/dev/null /usr/bin export ${HOME} done x=1 done awk test echo -eu awk /usr/bin
+	local ${HOME} "$@" then 'quoted text' awk --verbose
+2>/dev/null awk -eu readonly "$1" cd test
+"$1" sed readonly --verbose -eu -eu cd /usr/bin cd -eu export
+		--verbose --verbose 2>/dev/null test export -eu --verbose test sed printf
+		/usr/bin grep done awk grep --verbose --verbose /usr/bin done | test test echo
+		| printf --verbose done
+		--verbose $(pwd) echo x=1 then
+-eu printf sed 2>/dev/null then /usr/bin
+		sed | test 'quoted text' ${HOME} -eu
+	grep --verbose 2>/dev/null /usr/bin
+		"$1" /usr/bin && --verbose echo /usr/bin
+	echo -eu --verbose -eu cd --verbose ${HOME} echo && 'quoted text' local echo
+	awk printf --verbose done 2>/dev/null readonly | sed export 2>/dev/null
+		then cd --verbose 'quoted text'
+	awk && export readonly cd "$1" "$@" -eu
+cd "$1" grep done sed echo local grep 'quoted text'
+		| x=1 echo /usr/bin done readonly then cd local
+test && | awk | 'quoted text' export "$1" "$1" $(pwd) 2>/dev/null
+		test && --verbose /usr/bin 2>/dev/null
+"$@" /usr/bin export readonly && "$1" echo readonly readonly
+then readonly cd readonly
+	$(pwd) test && "$1" export printf ${HOME} 2>/dev/null "$@" local "$1" 'quoted text'
+test "$@" /usr/bin x=1 test readonly "$@" export
+	-eu sed "$@" | grep echo -eu ${HOME}
+printf && then awk local awk | x=1 "$@" export x=1 then ${HOME}
+	/usr/bin local "$1" local
+	test echo cd awk "$@" test
+	local -eu readonly -eu sed 'quoted text' grep export
+	done --verbose | /usr/bin $(pwd) local
+cd readonly ${HOME} then export -eu | export "$1"
+		"$1" x=1 grep readonly grep | readonly awk readonly
+x=1 -eu | --verbose $(pwd) "$@"
+	2>/dev/null -eu ${HOME} -eu cd | then x=1 echo 'quoted text' -eu readonly
+	then local echo ${HOME} test grep cd $(pwd)
+cd "$1" "$1" && sed -eu ${HOME} readonly 'quoted text' local $(pwd) printf
+		-eu && | $(pwd) printf 2>/dev/null export readonly
+	sed readonly cd $(pwd) "$1" cd /usr/bin done local $(pwd)
+&& awk test ${HOME} printf
+		printf /usr/bin echo "$@" /usr/bin /usr/bin printf "$1" local echo 2>/dev/null
+awk -eu printf echo 2>/dev/null readonly
+	/usr/bin "$@" "$@" --verbose | cd done export test export
+	--verbose local then then
+		echo printf grep local cd $(pwd) $(pwd) "$1" sed "$@" "$@" readonly
+done test /usr/bin echo x=1 && "$@" --verbose ${HOME} awk $(pwd)
+then done $(pwd) -eu local 2>/dev/null
+	&& test local sed $(pwd) test 2>/dev/null
+awk sed sed /usr/bin printf /usr/bin x=1 | --verbose awk | sed 'quoted text'
+	"$1" awk done export local test printf readonly /usr/bin
+"$@" "$@" ${HOME} "$1" x=1 /usr/bin
+'quoted text' 2>/dev/null cd 'quoted text'
+	"$1" | printf ${HOME} 2>/dev/null sed readonly
+		export "$1" echo export -eu readonly -eu /usr/bin
+"$1" done cd export echo /usr/bin $(pwd) && local cd awk sed -eu sed 'quoted text'
+2>/dev/null 2>/dev/null printf
+&& $(pwd) /usr/bin sed done "$1" $(pwd)
+	-eu ${HOME} printf printf readonly "$@" /usr/bin x=1 done x=1 2>/dev/null
+	| "$@" && printf then x=1 x=1
+| sed done && local | readonly x=1 awk echo "$@" then done grep "$1"
+		$(pwd) done done echo grep "$1" x=1
+		2>/dev/null 'quoted text' "$1" | 'quoted text' 2>/dev/null
+		grep printf cd "$1" local
+--verbose && $(pwd) -eu
+	${HOME} cd cd readonly $(pwd) ${HOME}
+		/usr/bin x=1 printf cd --verbose "$@" done 'quoted text' -eu $(pwd)
+		printf && "$@" ${HOME} 2>/dev/null test -eu test "$1" grep x=1 then
+	/usr/bin test echo awk ${HOME} grep awk sed cd "$1" -eu
+	/usr/bin done echo printf && awk "$1" sed ${HOME} 'quoted text' 2>/dev/null
+	awk local "$@" sed --verbose "$1" printf /usr/bin export "$@" grep sed
+test test ${HOME} local ${HOME} awk awk "$@" done echo then "$1" x=1 -eu cd test
+x=1 done /usr/bin test "$@" | cd | done ${HOME} grep &&
+		then awk $(pwd) readonly printf "$1" ${HOME} "$@" ${HOME}
+	test printf | x=1 done -eu test && | | /usr/bin | sed
+	export then grep 2>/dev/null && readonly printf && | echo readonly "$1" x=1 'quoted text'
+	2>/dev/null export --verbose cd 'quoted text' $(pwd) --verbose
+		echo cd "$1" ${HOME} | && $(pwd) 2>/dev/null
+	printf 'quoted text' local 'quoted text' $(pwd) test cd readonly 2>/dev/null printf
+		"$@" export "$1" grep
+	export "$1" $(pwd) export --verbose
+	"$1" readonly 'quoted text' echo echo
+$(pwd) local awk export then awk printf
+		awk grep readonly printf sed local local cd -eu export
+		readonly $(pwd) $(pwd) 2>/dev/null --verbose export done ${HOME} 'quoted text'
+		cd 2>/dev/null /usr/bin "$@"
+then done done 'quoted text' local ${HOME} printf cd printf sed
+		'quoted text' grep $(pwd) $(pwd) export export printf
+	sed grep ${HOME} | local local export then done awk then /usr/bin
+	| ${HOME} --verbose x=1 then 2>/dev/null sed grep grep then 2>/dev/null
+sed readonly "$@" cd sed then "$1" && "$1" done readonly "$@"
+	test --verbose cd x=1 | "$@" cd
+	"$@" sed local echo "$1" "$1" then awk test export readonly 2>/dev/null
+		awk local --verbose /usr/bin local --verbose done ${HOME}
+	/usr/bin && printf $(pwd) | export | cd awk cd
+	done $(pwd) export --verbose export awk awk
+		then 'quoted text' printf -eu --verbose --verbose grep 2>/dev/null -eu $(pwd)
+		readonly | && --verbose awk awk 'quoted text' | 2>/dev/null local local
+		"$@" grep local /usr/bin
+		sed | 2>/dev/null then then cd $(pwd) awk export echo grep test
+$(pwd) sed awk -eu echo --verbose --verbose cd 2>/dev/null done readonly
+--verbose export echo -eu done done | 2>/dev/null && sed printf local
+echo echo export "$@" ${HOME} --verbose awk 'quoted text' then 'quoted text'
+	/usr/bin grep export done export awk readonly
+awk test $(pwd) then printf echo local cd echo test
+	/usr/bin test local -eu cd sed awk 'quoted text' | 2>/dev/null readonly readonly
+${HOME} export local /usr/bin
+	printf export test readonly export | /usr/bin
+| grep then sed sed cd -eu
+		| 'quoted text' --verbose -eu
+done printf export 'quoted text'
+	awk | printf --verbose awk x=1 "$@" test | | ${HOME} ${HOME} export
+	grep cd "$1" readonly echo cd --verbose /usr/bin 'quoted text'
+	test $(pwd) export -eu echo test
+&& done && "$@" --verbose export -eu local readonly "$1" then /usr/bin
+	echo then "$@" "$1" |
+		done | done 'quoted text' echo /usr/bin export readonly $(pwd) echo
+		then --verbose --verbose echo grep
+		2>/dev/null test printf 'quoted text' /usr/bin
+		grep cd sed x=1 grep -eu sed echo readonly ${HOME} x=1 -eu cd
+-eu 2>/dev/null && sed --verbose | printf local test readonly ${HOME} /usr/bin
+	local grep done printf --verbose | echo -eu done $(pwd) 'quoted text'
+then 2>/dev/null sed test ${HOME} grep readonly awk -eu /usr/bin
+$(pwd) ${HOME} -eu sed grep cd grep awk
+		echo 'quoted text' awk then 2>/dev/null
+readonly test awk readonly && printf cd 'quoted text'
+then 2>/dev/null | "$@" done | ${HOME}
+| $(pwd) done sed /usr/bin then cd grep -eu test done export "$1" x=1 sed
+${HOME} /usr/bin "$@" "$@" 2>/dev/null cd
+		--verbose printf $(pwd) "$1" export echo readonly "$@" ${HOME} "$@" export
+		"$1" awk | local printf | 2>/dev/null then sed echo | "$1" -eu
+'quoted text' | export
+grep 'quoted text' done 'quoted text' /usr/bin test
+	x=1 cd && done sed x=1 test -eu ${HOME} ${HOME}
+		test "$@" awk 2>/dev/null done /usr/bin
+local grep -eu echo "$1" echo "$@" x=1 | test export &&
+		done readonly /usr/bin local echo "$@" && --verbose "$1" ${HOME} "$@"
+		awk cd "$@" echo cd ${HOME} then cd sed printf local
+		readonly then 2>/dev/null $(pwd) /usr/bin
+	grep echo test printf /usr/bin test printf cd /usr/bin --verbose
+	'quoted text' --verbose echo --verbose
+		${HOME} awk export 'quoted text'
+x=1 printf then grep
+2>/dev/null local "$1" /usr/bin 'quoted text' x=1 --verbose
+awk grep --verbose readonly $(pwd)
+/usr/bin --verbose --verbose
+	--verbose "$1" x=1 cd
+		| -eu ${HOME} then export awk cd export x=1 x=1 $(pwd)
+		'quoted text' printf --verbose --verbose grep | local echo printf ${HOME} done
+grep /usr/bin "$1" $(pwd) -eu export cd "$1" export test /usr/bin
+	test sed grep done awk then sed --verbose --verbose readonly --verbose && grep 2>/dev/null
+	&& /usr/bin echo echo && awk && readonly
+'quoted text' cd --verbose | cd cd && awk /usr/bin
+local readonly printf test readonly && x=1 grep --verbose x=1 readonly
+	${HOME} grep export --verbose
+'quoted text' 2>/dev/null "$1"
+		grep 2>/dev/null x=1 $(pwd) printf
+	printf printf test export
+	x=1 awk cd -eu sed cd readonly 'quoted text' then --verbose --verbose readonly
+&& echo readonly awk /usr/bin --verbose $(pwd) "$@" grep
+		awk printf cd echo -eu test --verbose
+	$(pwd) 'quoted text' then x=1 /usr/bin printf
+test -eu ${HOME} sed --verbose
+		'quoted text' /usr/bin --verbose grep -eu done grep echo done
+		"$1" grep sed && done done echo local
+	/usr/bin && -eu local "$1"
+		${HOME} sed test cd | printf x=1 /usr/bin
+		"$1" echo ${HOME} cd done
+		$(pwd) awk echo | printf 'quoted text'
+		${HOME} readonly /usr/bin cd awk done 'quoted text' "$@" ${HOME} echo
+	echo printf ${HOME} done 2>/dev/null | sed readonly -eu export
+		-eu echo "$@" "$1" test echo done test echo sed echo done -eu && done cd /usr/bin
+		${HOME} export /usr/bin && -eu
+test sed && test -eu $(pwd) done sed && /usr/bin
+		x=1 "$@" | readonly printf readonly $(pwd) ${HOME} "$1" sed
+	/usr/bin --verbose "$1" "$@" done ${HOME} awk then 'quoted text'
+		cd "$1" echo readonly x=1 echo $(pwd) 2>/dev/null
+	-eu -eu | ${HOME} 2>/dev/null $(pwd) x=1 local grep done && awk
+	test $(pwd) test test export
+		&& "$1" /usr/bin ${HOME} "$1"
+&& then echo awk printf
+	2>/dev/null 2>/dev/null then then "$@" then "$1" awk -eu
+-eu sed then awk awk x=1 'quoted text' awk /usr/bin
+		-eu x=1 sed local /usr/bin $(pwd) then then printf && done grep ${HOME}
+	| 'quoted text' sed printf && && $(pwd)
+	done --verbose then && x=1 then grep cd test cd local cd 'quoted text' &&
+2>/dev/null x=1 test 'quoted text' 'quoted text'
+	test sed done test "$1" -eu ${HOME} awk
+		then echo awk readonly cd 'quoted text' done then
+	local "$@" sed | 2>/dev/null x=1 --verbose
+		local --verbose then && echo ${HOME} test grep
+		'quoted text' 'quoted text' --verbose
+	printf awk 2>/dev/null 2>/dev/null 'quoted text'
+"$@" && $(pwd) $(pwd) awk
+		--verbose 2>/dev/null echo $(pwd) x=1
+	local 'quoted text' then && then 2>/dev/null 'quoted text' --verbose $(pwd)
+awk export then 'quoted text' --verbose
+		&& $(pwd) x=1 done | -eu $(pwd) echo x=1 ${HOME} | awk x=1
+		${HOME} $(pwd) ${HOME} && printf /usr/bin echo echo && $(pwd) "$@" export
+	$(pwd) --verbose | 2>/dev/null awk 'quoted text' done echo 'quoted text' sed export
+	"$@" --verbose x=1 "$@" /usr/bin ${HOME} sed -eu 2>/dev/null
+	grep awk awk "$1" awk
+	'quoted text' printf cd grep sed 2>/dev/null x=1 printf grep readonly
+'quoted text' /usr/bin sed
+	-eu "$@" -eu cd ${HOME} 'quoted text' -eu
+		"$1" echo cd "$1" printf readonly
+	local "$1" "$1" x=1 /usr/bin $(pwd) && | export test
+	then -eu then | /usr/bin then export x=1 -eu awk
+readonly x=1 ${HOME} then printf "$1" echo
+-eu -eu 2>/dev/null grep printf && --verbose ${HOME} local grep export
+		${HOME} awk local ${HOME} | $(pwd) --verbose
+	${HOME} 2>/dev/null | then --verbose awk
+		export --verbose echo && $(pwd) cd awk -eu ${HOME} && $(pwd) done grep
+		readonly local local 'quoted text'
+done printf && --verbose
+	done -eu printf then 2>/dev/null x=1 local -eu && "$1" && grep cd && test --verbose
+		2>/dev/null readonly readonly
+'quoted text' cd 2>/dev/null grep grep then x=1 /usr/bin done then ${HOME}
+awk grep "$1" $(pwd) "$@" "$1" |
+		x=1 printf export x=1 cd then readonly
+		${HOME} awk | /usr/bin x=1 readonly && done
+		test grep cd 2>/dev/null -eu && --verbose grep | then local "$@" $(pwd)
+		2>/dev/null then && test printf && export $(pwd) -eu $(pwd)
+		cd grep ${HOME} 2>/dev/null | 2>/dev/null
+		-eu $(pwd) && | grep echo local sed cd -eu readonly
+	"$1" $(pwd) grep test --verbose
+	cd ${HOME} sed echo | ${HOME} | --verbose then -eu
+awk "$@" 'quoted text' | --verbose local 2>/dev/null local awk local
+then | export $(pwd) awk -eu export "$@" export
+	echo -eu --verbose $(pwd) x=1 "$@" grep printf export --verbose local
+		awk && 2>/dev/null then $(pwd) readonly | | grep export
+	echo cd ${HOME} | cd cd echo "$1" export readonly grep | ${HOME} /usr/bin
+		readonly awk "$1" "$1" test awk
+echo printf ${HOME} done 2>/dev/null
+| "$1" 'quoted text' "$@" $(pwd) $(pwd) x=1 $(pwd)
+then 2>/dev/null $(pwd) --verbose export x=1 $(pwd) grep awk x=1 test
+	cd printf printf test grep local readonly "$@" test $(pwd) test done | done
+		"$@" 2>/dev/null --verbose
+awk awk "$1" grep --verbose "$1" --verbose -eu $(pwd)
+2>/dev/null "$1" done echo "$@" printf -eu then readonly local grep "$1"
+		"$@" -eu --verbose "$@" test readonly $(pwd) sed
+	/usr/bin cd | $(pwd) sed then 2>/dev/null ${HOME} export
+		| readonly 'quoted text' ${HOME} | 'quoted text' ${HOME} 2>/dev/null
+	readonly echo grep ${HOME} -eu x=1 "$1" && x=1 "$1" readonly
+	${HOME} | $(pwd) sed ${HOME} "$1" test
+	x=1 printf --verbose "$@" done ${HOME} ${HOME} sed grep then local 'quoted text'
+	then x=1 then test 2>/dev/null
+'quoted text' printf test test x=1 done printf
+'quoted text' export ${HOME} cd -eu $(pwd) x=1 && "$@" -eu
+x=1 sed -eu then readonly
+		/usr/bin /usr/bin $(pwd) 'quoted text' 2>/dev/null "$@" | grep awk then --verbose
+sed "$1" && "$1" | grep sed
+local x=1 | done test sed echo grep test
+	sed readonly "$1" local done 'quoted text' ${HOME} 'quoted text' cd awk
+	$(pwd) local "$1" then "$1" | 2>/dev/null echo ${HOME} cd "$1" export
+		x=1 && readonly 'quoted text' grep x=1 'quoted text' awk grep done readonly
+sed local --verbose awk /usr/bin awk then then then sed
+grep --verbose sed 'quoted text' ${HOME} | --verbose
+		-eu local cd -eu /usr/bin x=1 local && 2>/dev/null
+export local x=1 --verbose readonly 'quoted text' x=1 /usr/bin grep
+readonly awk "$1" "$@" printf 2>/dev/null $(pwd) "$1"
+grep done /usr/bin $(pwd) -eu ${HOME} ${HOME} awk $(pwd) grep
+	"$1" ${HOME} "$1" -eu sed
+	readonly then readonly awk then cd
+&& $(pwd) sed test sed /usr/bin done | 2>/dev/null
+${HOME} 2>/dev/null export --verbose then export --verbose 'quoted text' sed --verbose
+sed && "$@" printf --verbose ${HOME} 2>/dev/null
+		x=1 readonly cd -eu "$1" echo awk 2>/dev/null "$@" then sed ${HOME} -eu done then
+-eu printf then test local sed export awk --verbose sed grep grep
+	&& -eu | grep | "$@" readonly done then export readonly
+readonly -eu grep readonly --verbose 2>/dev/null
+"$@" test $(pwd) readonly
+	cd /usr/bin awk echo x=1 'quoted text' "$@" "$1" "$1" x=1 test 2>/dev/null
+	grep $(pwd) "$1" grep --verbose readonly --verbose
+	awk 'quoted text' $(pwd) /usr/bin $(pwd) 2>/dev/null then "$1" readonly printf
+"$@" echo done "$@" -eu ${HOME} "$@"
+	-eu -eu 2>/dev/null "$@" && done ${HOME} | echo then done "$@" 'quoted text'
+	&& then -eu "$@" 2>/dev/null -eu done 2>/dev/null then "$@" readonly sed export
+		export "$1" test | && sed $(pwd) echo export test then then sed -eu
+	x=1 -eu "$1" echo "$1" grep readonly
+		| test x=1 2>/dev/null "$1" readonly | $(pwd) ${HOME} readonly readonly local
+		&& awk x=1 --verbose && sed grep
+		"$@" cd -eu test | done grep 2>/dev/null grep
+		done readonly /usr/bin done export grep && done | readonly -eu "$@" done
+	test echo test then cd echo then x=1 grep export echo 'quoted text'
+'quoted text' "$1" $(pwd) "$1"
+	printf "$@" export | 2>/dev/null 'quoted text' echo | -eu sed sed
+"$1" 2>/dev/null awk x=1 sed 'quoted text' echo local | test $(pwd)
+	grep x=1 done then | -eu && readonly grep echo done sed ${HOME} && printf |
+export 2>/dev/null 2>/dev/null $(pwd) 'quoted text' local
+		| cd local --verbose export grep
+		&& "$1" done --verbose /usr/bin
+		cd local done 2>/dev/null cd awk echo sed | "$@" cd $(pwd) x=1 cd printf -eu
+		awk $(pwd) cd local /usr/bin
+	sed /usr/bin printf export "$1" | test 'quoted text' done --verbose then ${HOME}
+'quoted text' $(pwd) x=1 printf ${HOME} ${HOME} then sed 'quoted text'
+		"$1" && local $(pwd) export
+/usr/bin test cd ${HOME} x=1 -eu cd export then cd && --verbose 'quoted text'
+	local sed grep "$1" sed awk 2>/dev/null /usr/bin /usr/bin && |
+	done sed "$1" | ${HOME} --verbose | "$@" then 'quoted text'
+	done "$@" && sed | -eu --verbose readonly ${HOME} local
+${HOME} 'quoted text' x=1 ${HOME} | $(pwd) readonly
+test cd grep export local cd printf
+		| local && test ${HOME} done test x=1
+-eu test test -eu printf export cd "$@" "$1" cd sed "$@" grep export
+	2>/dev/null ${HOME} cd "$1" -eu done test -eu awk then | grep /usr/bin grep
+then 'quoted text' ${HOME} cd printf
+		echo x=1 export 2>/dev/null
+then "$1" test x=1 done "$@" -eu echo -eu "$1"
+		local export echo awk $(pwd)
+		echo 2>/dev/null $(pwd) export then "$1" && echo test awk "$1" && | ${HOME}
+$(pwd) --verbose awk sed | "$1" sed ${HOME} ${HOME}
+		/usr/bin $(pwd) sed export echo | --verbose x=1 "$1" --verbose readonly awk $(pwd)
+test --verbose "$@" grep printf printf --verbose test $(pwd)
+	done 'quoted text' x=1 /usr/bin export grep done
+		export | readonly 2>/dev/null "$1" --verbose "$@" /usr/bin local --verbose
+		&& 2>/dev/null ${HOME} | done local 'quoted text' echo readonly local
+	${HOME} | then "$@" done test grep readonly readonly 2>/dev/null printf --verbose
+2>/dev/null test "$1"
+		"$@" export -eu $(pwd) 2>/dev/null
+		done then "$1" | /usr/bin x=1 echo printf
+x=1 /usr/bin x=1 -eu |
+		&& | 2>/dev/null | grep done | awk ${HOME} echo echo
+local --verbose sed /usr/bin "$@" grep -eu /usr/bin /usr/bin 2>/dev/null
+2>/dev/null then | sed sed printf awk 'quoted text' -eu awk
+'quoted text' test local 'quoted text' test 'quoted text' export
+		awk -eu printf test 2>/dev/null
+	'quoted text' -eu awk local
+		awk 2>/dev/null | -eu -eu -eu sed
+	$(pwd) local echo local "$1" awk printf /usr/bin
+	export x=1 | -eu "$@" then
+grep ${HOME} readonly cd awk awk -eu x=1 | 2>/dev/null
+readonly echo && "$1" x=1 -eu $(pwd) "$1" awk --verbose
+		readonly local x=1 then 'quoted text' printf local readonly then
+	cd $(pwd) -eu | sed "$1" "$@" done -eu local awk --verbose
+test grep awk --verbose | then echo "$@" ${HOME} readonly x=1 "$@" 'quoted text'
+local readonly ${HOME} printf then -eu x=1 sed echo /usr/bin "$@"
+	-eu -eu local local ${HOME} 'quoted text' "$@" local |
+	test -eu done 2>/dev/null then 2>/dev/null /usr/bin
+		readonly local local grep 2>/dev/null -eu -eu then -eu
+		${HOME} -eu 'quoted text'
+	cd readonly "$1" grep echo && test /usr/bin local | 2>/dev/null cd x=1 2>/dev/null
+	echo 'quoted text' sed | export "$@" "$1"
+	printf echo /usr/bin
+	| local 2>/dev/null then cd "$@" sed printf 'quoted text' grep done
+	${HOME} 'quoted text' $(pwd) /usr/bin
+		-eu && then $(pwd) -eu --verbose -eu grep sed cd
+&& -eu grep | -eu then && readonly grep /usr/bin -eu awk awk -eu
+	local test ${HOME} test awk local test test awk ${HOME} then
+	--verbose ${HOME} echo ${HOME} awk export sed | && awk done --verbose x=1 readonly
+	&& | grep done --verbose -eu "$@" | $(pwd) local 'quoted text' --verbose 2>/dev/null
+		/usr/bin 'quoted text' 2>/dev/null
+	'quoted text' /usr/bin printf cd --verbose -eu done -eu x=1 2>/dev/null
+done x=1 "$@" local sed cd | | --verbose echo /usr/bin done $(pwd) grep -eu
+		done grep "$@" done readonly done
+	grep printf echo export --verbose
+		awk then then echo 'quoted text' export local printf /usr/bin
+export 2>/dev/null done local /usr/bin -eu "$1" cd then | | ${HOME}
+sed && then echo local
+	done $(pwd) cd then 'quoted text'
+/usr/bin 'quoted text' | "$1" 'quoted text' then then then -eu then
+		cd export 'quoted text' 2>/dev/null awk ${HOME} | ${HOME} "$1" test
+		"$1" local local 2>/dev/null && export readonly 'quoted text'
+		| local 'quoted text' sed "$@" "$1" cd 2>/dev/null ${HOME} readonly "$1" then
+2>/dev/null /usr/bin x=1 test cd
+		${HOME} | 'quoted text' awk cd then done | done 2>/dev/null && $(pwd) ${HOME}
+		readonly grep done local readonly printf
+		&& printf grep "$1" grep $(pwd)
+		printf --verbose printf
+local && | done -eu && grep awk printf done x=1
+		'quoted text' ${HOME}
+	x=1 && awk echo cd "$@" then --verbose
+	x=1 -eu -eu sed sed printf local readonly $(pwd) cd "$1" local done --verbose
+		awk "$@" echo x=1 && test awk readonly sed --verbose -eu printf cd | $(pwd)
+'quoted text' "$1" 'quoted text' "$1" --verbose test export readonly
+		| echo done 'quoted text' && x=1 then awk -eu -eu local local printf 'quoted text'
+	test done "$1" 2>/dev/null ${HOME} "$@" "$@" 'quoted text' done
+		echo sed export | | grep 2>/dev/null
+-eu 2>/dev/null --verbose 2>/dev/null "$@" $(pwd) readonly
+		awk echo sed -eu test "$@" done -eu then then awk -eu printf 'quoted text'
+export ${HOME} done 2>/dev/null export /usr/bin --verbose
+grep "$@" | grep --verbose local x=1
+		cd && x=1 printf test
+sed done grep export grep 'quoted text' -eu done echo echo export
+	$(pwd) && then done --verbose then local | grep grep echo $(pwd) 'quoted text'
+local ${HOME} sed awk --verbose
+		"$1" readonly "$@" "$1" "$1" echo done x=1 awk ${HOME} readonly "$1" test export
+		-eu sed done $(pwd) "$@" ${HOME} awk 'quoted text' readonly 2>/dev/null
+	then readonly export printf /usr/bin -eu | 2>/dev/null x=1 "$@" /usr/bin
+x=1 readonly 'quoted text' --verbose local 2>/dev/null $(pwd) "$1" 2>/dev/null
+		| grep sed 'quoted text' && readonly test
+		/usr/bin echo cd | -eu -eu 'quoted text' local grep x=1 -eu readonly ${HOME}
+test awk grep cd ${HOME} | echo -eu "$@" cd test ${HOME}
+		&& 'quoted text' x=1 $(pwd) -eu x=1 readonly "$1" test "$@" 'quoted text'
+sed printf cd ${HOME} echo done echo 2>/dev/null -eu export --verbose echo
+test /usr/bin local test
+	sed /usr/bin /usr/bin 2>/dev/null
+		"$@" | "$1" test x=1 echo then awk export "$@" echo
+	printf export "$1" 'quoted text'
+		printf cd printf grep x=1 x=1 printf && "$@"
+		grep cd && cd -eu | test ${HOME} sed 'quoted text' grep -eu awk
+"$1" "$@" done cd 'quoted text' echo
+&& 2>/dev/null "$1" done
+printf echo readonly printf --verbose --verbose "$@" awk done ${HOME}
+	"$1" cd test export | "$1" test "$@" readonly 2>/dev/null cd test
+		2>/dev/null ${HOME} local sed readonly then
+x=1 'quoted text' && test --verbose
+	local "$1" sed cd "$1" readonly "$@" then cd -eu 'quoted text'
+/usr/bin then 'quoted text' /usr/bin $(pwd) && x=1 2>/dev/null test
+printf done $(pwd) "$1" x=1 done grep printf --verbose -eu
+grep 'quoted text' --verbose
+sed $(pwd) grep done 2>/dev/null $(pwd) cd /usr/bin
+	test local awk cd echo /usr/bin 2>/dev/null awk x=1
+		grep --verbose cd x=1 done test && echo done ${HOME} --verbose -eu "$1" "$1" local
+		test cd x=1 local 2>/dev/null awk then sed readonly | awk then done readonly
+	done ${HOME} sed grep cd x=1 2>/dev/null
+	'quoted text' then export ${HOME} done echo /usr/bin --verbose
+	echo $(pwd) $(pwd) |
+		echo awk | printf --verbose printf $(pwd) printf 2>/dev/null
+		echo && cd 'quoted text' 2>/dev/null
+cd cd --verbose cd readonly printf | echo readonly awk -eu cd done done
+&& local 'quoted text' done /usr/bin then --verbose test /usr/bin x=1
+		done 'quoted text' && "$@" | echo then then
+		grep echo -eu x=1 --verbose grep readonly
+		"$1" 2>/dev/null 2>/dev/null
+		x=1 readonly "$@" readonly -eu export test ${HOME} -eu
+	done awk "$@" -eu then awk 2>/dev/null --verbose awk test "$@"
+	x=1 --verbose grep "$1" awk -eu
+	$(pwd) test $(pwd) local -eu printf local "$1"
+	"$@" grep local ${HOME}
+"$@" export grep awk "$@" then grep test "$@" printf 'quoted text' 'quoted text'
+echo done && grep /usr/bin test --verbose /usr/bin local --verbose /usr/bin
+printf cd done cd $(pwd)
+		readonly --verbose printf 'quoted text' /usr/bin "$@" | then
+	"$1" export 2>/dev/null /usr/bin x=1 ${HOME} awk readonly awk
+	| export "$@" -eu 2>/dev/null
+	/usr/bin ${HOME} "$@" test $(pwd)
+	test export 'quoted text' printf
+		${HOME} export printf readonly x=1 cd sed cd && "$@" echo "$1" local 'quoted text'
+		awk then x=1 awk echo test sed then awk
+	done grep export done cd | $(pwd) && done printf
+"$@" $(pwd) readonly grep 'quoted text' echo -eu then ${HOME}
+		${HOME} grep --verbose "$1" test printf x=1 cd --verbose -eu echo sed sed local
+	x=1 2>/dev/null | "$1" x=1 | echo local ${HOME} 2>/dev/null --verbose
+		--verbose export ${HOME} sed && echo echo printf --verbose awk
+		-eu /usr/bin --verbose
+	$(pwd) --verbose "$@" local "$1" "$1" test echo
+		${HOME} awk && $(pwd)
+	'quoted text' /usr/bin local readonly /usr/bin done sed test
+${HOME} test ${HOME} local x=1 cd done test -eu -eu local
+/usr/bin "$1" local /usr/bin
+	x=1 printf x=1 local then "$1" sed cd cd readonly x=1
+done export readonly awk "$@" test local 'quoted text'
+2>/dev/null echo && echo done
+'quoted text' done readonly 'quoted text' --verbose grep grep x=1 awk sed grep
+		sed sed echo | readonly grep awk "$@" grep awk then ${HOME}
+	echo -eu export awk 2>/dev/null --verbose $(pwd) echo grep cd
+	test 2>/dev/null x=1 2>/dev/null then "$1" awk
+-eu local --verbose export x=1 then echo 'quoted text' -eu ${HOME} &&
+	--verbose then ${HOME} ${HOME}
+printf grep 'quoted text' done $(pwd) | "$1" echo --verbose sed /usr/bin done then
+		'quoted text' test x=1 cd ${HOME} 'quoted text' | awk grep grep sed done
+		export /usr/bin sed $(pwd) echo
+		sed --verbose --verbose export local "$1" echo "$@" 'quoted text'
+	/usr/bin | x=1 x=1 -eu done local done
+		-eu ${HOME} --verbose $(pwd) export ${HOME} then test ${HOME} printf
+	'quoted text' then printf test "$1"
+/usr/bin echo printf grep done awk done local | /usr/bin 'quoted text' x=1 grep
+echo /usr/bin local 2>/dev/null 2>/dev/null local "$1" ${HOME} 'quoted text' awk
+	| awk -eu done cd grep readonly local && 2>/dev/null sed printf
+	${HOME} ${HOME} --verbose --verbose awk -eu awk readonly echo $(pwd) x=1 | awk
+${HOME} grep echo ${HOME} echo cd "$@"
+	test -eu --verbose | x=1 $(pwd) readonly ${HOME} "$@" export -eu | "$1" 'quoted text'
+	grep sed echo grep done /usr/bin local echo done readonly $(pwd)
+	'quoted text' 'quoted text' then
+	| /usr/bin export "$1" ${HOME} then test readonly
+		sed x=1 | 2>/dev/null -eu "$@" sed sed /usr/bin $(pwd) export then | $(pwd)
+	done sed export -eu ${HOME} printf done
+	echo && grep 'quoted text' then test then --verbose | local readonly printf
+sed ${HOME} then && echo sed && x=1 export 2>/dev/null echo
+		test printf /usr/bin local | local x=1 $(pwd) x=1 -eu then
+		test --verbose 2>/dev/null x=1 | sed readonly | local | x=1 ${HOME}
+	done local echo cd /usr/bin cd awk "$1"
+	then /usr/bin "$1" echo "$1"
+sed x=1 awk && x=1 "$@" done --verbose --verbose "$1" echo grep readonly
+	export --verbose -eu | $(pwd) x=1
+		"$1" x=1 done 2>/dev/null | export $(pwd)
+		$(pwd) export ${HOME} echo 'quoted text'
+	-eu && /usr/bin && export x=1 -eu sed then export
+	'quoted text' x=1 local "$1" 2>/dev/null 'quoted text'
+	-eu echo && /usr/bin printf 2>/dev/null "$@" ${HOME}
+-eu -eu 2>/dev/null export 'quoted text' x=1 | test ${HOME}
+		printf | 'quoted text' printf
+		readonly sed done export readonly echo --verbose readonly readonly $(pwd)
+	"$1" cd --verbose test
+	${HOME} done $(pwd) local test echo --verbose
+	export "$1" 'quoted text' cd "$1" 2>/dev/null then
+		grep test test export "$@" -eu
+		--verbose "$1" done export |
+		"$1" && --verbose $(pwd) echo local "$@" $(pwd) ${HOME} 'quoted text' --verbose
+		cd test | "$1" x=1 awk local $(pwd) done echo ${HOME} 'quoted text' "$1" printf
+"$1" awk 'quoted text' cd local && x=1 export awk then
+	'quoted text' && readonly
+		printf | -eu awk echo readonly
+		"$1" sed x=1 then echo -eu && local -eu done
+sed | "$1" && printf echo
+	-eu test readonly readonly 2>/dev/null $(pwd) sed done readonly x=1 x=1 local
+echo x=1 $(pwd) $(pwd) /usr/bin done "$1" "$@" readonly local ${HOME} readonly
+		"$1" "$1" grep echo cd ${HOME} ${HOME} --verbose echo "$1" && then
+| test readonly 'quoted text' /usr/bin
+		done sed x=1 readonly 2>/dev/null export
+x=1 awk "$@" printf cd export x=1 ${HOME} 2>/dev/null
+		done --verbose | | grep $(pwd) then | --verbose -eu
+		${HOME} $(pwd) echo | "$@" cd printf cd local
+		awk /usr/bin test -eu echo readonly -eu | /usr/bin
+		--verbose grep test && "$1" sed |
+"$@" echo 2>/dev/null "$1" 'quoted text' 'quoted text'
+&& export cd done ${HOME} cd /usr/bin x=1 sed --verbose grep
+	${HOME} 'quoted text' test "$@" printf 2>/dev/null
+	echo echo "$1" printf cd done
+readonly x=1 readonly $(pwd) export echo
+x=1 2>/dev/null -eu sed printf $(pwd) done readonly 2>/dev/null
+	printf echo printf --verbose done 2>/dev/null 2>/dev/null
+	/usr/bin --verbose $(pwd) test && test
+		'quoted text' sed 'quoted text' echo && -eu done awk 2>/dev/null && /usr/bin
+		test sed 'quoted text' test sed readonly cd "$@" awk "$@" export "$1" echo
+then -eu grep test echo 2>/dev/null done "$@" /usr/bin
+		x=1 echo cd x=1 test then /usr/bin
+&& export echo local && /usr/bin x=1 printf awk $(pwd) "$1" $(pwd) 2>/dev/null
+| --verbose local && local /usr/bin done 'quoted text' printf
+then echo then done sed ${HOME} cd | ${HOME} "$@" --verbose then
+&& "$1" done "$1" x=1 && grep $(pwd) cd test x=1 sed x=1 sed
+		--verbose | | export --verbose
+		awk grep cd "$1" printf test echo done | readonly /usr/bin "$@"
+sed cd printf ${HOME} x=1 cd && && | "$1"
+		grep "$1" then && | ${HOME} | local echo then --verbose echo && readonly readonly
+	export then then awk 2>/dev/null x=1
+then && cd awk export 'quoted text'
+		cd 'quoted text' done then
+${HOME} grep readonly -eu "$@" done x=1 awk test echo 2>/dev/null done
+cd 'quoted text' && "$1" local x=1 printf x=1 $(pwd) local | echo awk echo
+done readonly 2>/dev/null $(pwd) -eu ${HOME} | --verbose
+-eu $(pwd) sed | -eu $(pwd) sed echo 'quoted text' $(pwd)
+	"$1" readonly printf 2>/dev/null
+'quoted text' awk test | /usr/bin
+"$1" && then test echo --verbose grep
+	printf -eu "$@" printf test sed "$1" "$@"
+	&& 2>/dev/null local test 'quoted text' | readonly then sed grep
+x=1 echo && "$1" sed "$1" "$1" printf
+then export && ${HOME} --verbose readonly local local --verbose
+export then grep test "$@" test cd done | /usr/bin local test ${HOME}
+-eu /usr/bin -eu done "$@" && echo
+grep "$@" --verbose $(pwd) "$1" cd local echo 'quoted text' done | ${HOME} "$1"
+		/usr/bin x=1 local $(pwd) then && readonly
+		2>/dev/null && -eu 'quoted text' readonly "$1" then readonly
+		grep awk x=1 && echo printf && then awk done
+		sed awk -eu "$@" grep echo && awk -eu awk readonly test ${HOME} readonly printf
+	| readonly local $(pwd) test /usr/bin
+		then "$@" --verbose | echo --verbose
+		$(pwd) then sed readonly done readonly "$@" $(pwd)
+		2>/dev/null local export /usr/bin --verbose grep
+	--verbose ${HOME} "$@" grep ${HOME} "$@" --verbose printf awk 'quoted text' ${HOME}
+	x=1 grep sed export export && -eu && awk /usr/bin -eu |
+		--verbose awk sed export test done then readonly "$1" $(pwd)
+		awk "$1" cd test /usr/bin ${HOME} then local
+	cd | "$@" | x=1 | 'quoted text'
+printf && 2>/dev/null -eu then then echo
+		export then awk "$@" | | && -eu 'quoted text'
+/usr/bin echo test x=1 cd grep ${HOME} done && --verbose
+done "$1" $(pwd) done --verbose
+	-eu awk 'quoted text' grep then | echo sed $(pwd) && local test
+		| /usr/bin && $(pwd) --verbose -eu export 'quoted text' readonly
+grep awk --verbose grep 'quoted text' then sed test 2>/dev/null /usr/bin
+		2>/dev/null 2>/dev/null echo done 2>/dev/null | | 'quoted text'
+	local ${HOME} sed /usr/bin echo sed sed && $(pwd) 2>/dev/null
+	"$@" -eu && | 2>/dev/null sed grep 'quoted text' sed x=1 && done readonly
+then $(pwd) grep | "$@" printf 2>/dev/null
+		export && --verbose | readonly export sed test 'quoted text'
+		done /usr/bin "$@" 2>/dev/null 2>/dev/null sed test
+	cd /usr/bin printf 'quoted text' then cd 'quoted text'
+		echo 'quoted text' export cd done 'quoted text' "$@" done $(pwd) readonly --verbose
+	--verbose export awk "$1"
+	/usr/bin cd x=1 x=1 2>/dev/null export /usr/bin
+	--verbose export && export readonly /usr/bin --verbose
+	${HOME} 2>/dev/null grep && sed --verbose cd
+	grep /usr/bin grep -eu test "$1" export -eu done /usr/bin readonly test 2>/dev/null
+	then done "$@" "$1" local && ${HOME} export test x=1
+		&& then && sed awk 'quoted text' readonly && cd
+local cd readonly sed test "$@"
+echo --verbose $(pwd) $(pwd) /usr/bin /usr/bin -eu readonly
+local grep -eu grep 2>/dev/null
+	&& $(pwd) local "$@" local x=1 local then /usr/bin local 'quoted text'
+	printf | local export test --verbose
+awk awk echo x=1 | sed /usr/bin ${HOME}
+		--verbose "$@" "$1" x=1 "$1"
+		done ${HOME} /usr/bin
+$(pwd) && "$1" ${HOME} | grep
+		echo | /usr/bin readonly "$1"
+	printf $(pwd) 2>/dev/null grep && "$1" printf sed 'quoted text' 'quoted text'
+	$(pwd) readonly test test
+		test printf readonly then sed "$1" export --verbose export x=1 done
+test done printf "$@" && sed export | | echo sed "$1" -eu
+done export "$@" test x=1 | | done echo 2>/dev/null /usr/bin
+export export then sed
+	--verbose done grep 'quoted text'
+	local --verbose sed cd
+	export 'quoted text' test awk ${HOME} && --verbose then
+&& && test | x=1 echo "$1" && printf
+	"$1" awk test "$1" test "$@" --verbose
+		done printf local awk --verbose done 'quoted text' -eu $(pwd) readonly cd $(pwd)
+readonly cd export && ${HOME} 'quoted text'
+'quoted text' | && cd test "$@"
+		printf "$1" /usr/bin then x=1 --verbose /usr/bin
+	cd awk cd $(pwd) local -eu sed -eu export
+	${HOME} printf /usr/bin then then | "$1" done cd x=1 $(pwd)
+		"$1" ${HOME} "$@" ${HOME} "$@" awk && sed && grep /usr/bin
+		&& then readonly -eu readonly readonly local export readonly echo x=1
+		$(pwd) sed 'quoted text' sed done && echo --verbose done
+	"$@" printf done cd /usr/bin --verbose 2>/dev/null test x=1 then $(pwd) ${HOME}
+		${HOME} then x=1 local 2>/dev/null
+	test export printf | -eu awk export local --verbose $(pwd) test ${HOME}
+		${HOME} && awk $(pwd)
+local --verbose /usr/bin -eu ${HOME} done && ${HOME} $(pwd)
+x=1 | cd test export echo done sed 2>/dev/null x=1 cd printf
+		$(pwd) awk local grep $(pwd) $(pwd) awk 'quoted text' 'quoted text'
+$(pwd) 'quoted text' grep cd awk ${HOME} && grep grep local then
+	done "$@" "$@" $(pwd) readonly
+		cd cd --verbose test | 'quoted text' && awk grep | printf
+		cd export test readonly "$1" readonly $(pwd) local test awk -eu done 'quoted text'
+	| cd local -eu echo then
+awk echo | --verbose /usr/bin ${HOME} 'quoted text' ${HOME} export
+	/usr/bin x=1 2>/dev/null "$1" 'quoted text'
+	-eu printf grep /usr/bin "$@"
+	then --verbose local 'quoted text' printf export cd ${HOME}
+	-eu grep $(pwd) readonly test local done ${HOME}
+	&& cd export /usr/bin $(pwd) -eu printf grep | test 2>/dev/null
+	grep | printf $(pwd) readonly
+	x=1 'quoted text' --verbose then printf grep x=1
+		export x=1 readonly && && 2>/dev/null /usr/bin
+		-eu x=1 sed 2>/dev/null 'quoted text' ${HOME} local --verbose awk 2>/dev/null
+		'quoted text' then "$1" 2>/dev/null sed && test && /usr/bin | $(pwd)
+&& 'quoted text' test grep | && 2>/dev/null $(pwd) export x=1 local done test
+export /usr/bin printf | 2>/dev/null
+		echo x=1 readonly x=1 --verbose done x=1 readonly
+'quoted text' x=1 sed then x=1 $(pwd) -eu echo 'quoted text'
+		then ${HOME} $(pwd) $(pwd) && export awk sed 2>/dev/null 2>/dev/null -eu
+local cd "$@" -eu echo -eu "$1" echo 'quoted text' "$1"
+	${HOME} -eu 2>/dev/null "$@" -eu awk $(pwd)
+	"$@" 2>/dev/null 2>/dev/null 'quoted text' 2>/dev/null | "$1" test readonly
+"$@" test | "$1" printf local x=1 local echo cd "$@" then "$1" | awk
+sed | export local export ${HOME} then x=1 ${HOME}
+		| 2>/dev/null --verbose
+&& ${HOME} | ${HOME} printf
+		"$1" readonly "$@" echo "$1" "$1" then | "$@" &&
+	x=1 2>/dev/null echo /usr/bin export
+		"$@" local --verbose export test 'quoted text' "$1" "$@"
+	-eu export ${HOME} -eu -eu
+	awk grep --verbose | 2>/dev/null /usr/bin -eu 'quoted text'
+	--verbose ${HOME} 'quoted text' "$@" 2>/dev/null readonly
+		readonly "$@" readonly ${HOME}
+	sed echo $(pwd) $(pwd) ${HOME} cd echo "$@" --verbose
+test && x=1 --verbose "$1" /usr/bin awk "$@" x=1
+	export && && 'quoted text'
+		sed cd test $(pwd) /usr/bin awk
+		grep "$@" "$@" grep "$@" export test export
+2>/dev/null -eu sed echo $(pwd) "$1" readonly ${HOME} x=1 "$1" grep test ${HOME}
+| && | x=1 "$1" -eu readonly cd
+		--verbose 2>/dev/null awk /usr/bin "$@" cd $(pwd)
+	test done done done sed then && "$@" readonly
+"$1" $(pwd) done "$@" "$@" 'quoted text'
+		awk export readonly && cd printf ${HOME} printf echo /usr/bin
+	2>/dev/null test done done ${HOME} echo readonly $(pwd) $(pwd) cd -eu
+&& 2>/dev/null readonly readonly test -eu export export echo done "$1"
+		test x=1 | test export
+	awk ${HOME} ${HOME} ${HOME} /usr/bin x=1 2>/dev/null then && $(pwd) --verbose
+	sed local local readonly && echo ${HOME} 'quoted text'
+	done echo x=1 x=1 sed test readonly
+	&& awk x=1 then sed cd readonly $(pwd) sed 'quoted text' -eu ${HOME}
+	sed export -eu sed "$1" x=1 readonly sed 2>/dev/null printf "$1"
+	printf sed /usr/bin sed echo "$@" $(pwd) awk 2>/dev/null sed 2>/dev/null
+	'quoted text' --verbose readonly $(pwd) ${HOME} --verbose then readonly readonly
+${HOME} printf test grep 2>/dev/null awk sed then local printf awk echo awk
+sed ${HOME} readonly 2>/dev/null 2>/dev/null echo test readonly 2>/dev/null
+		local "$@" then | test $(pwd)
+sed test 'quoted text' x=1 printf --verbose test done "$@" && echo | readonly
+sed "$@" sed export then -eu "$@" grep done done 'quoted text'
+	grep "$1" | /usr/bin && sed 2>/dev/null $(pwd) "$1" export printf test
+	export done 'quoted text' sed test printf | awk cd export
+		grep echo /usr/bin -eu | printf /usr/bin /usr/bin printf
+		2>/dev/null $(pwd) -eu cd test echo x=1 "$1" /usr/bin echo x=1 done
+		-eu grep then --verbose
+		grep then echo then 2>/dev/null | $(pwd) test /usr/bin
+	test 2>/dev/null /usr/bin
+	export awk "$1" printf grep test 'quoted text' "$1" test
+	awk --verbose then $(pwd) "$1" "$@"
+		/usr/bin done printf echo --verbose
+2>/dev/null x=1 'quoted text' --verbose "$@" sed printf x=1 test
+		then $(pwd) then grep --verbose done then "$@" local
+	$(pwd) local x=1 awk --verbose 2>/dev/null /usr/bin | && readonly
+echo $(pwd) -eu echo x=1 done echo --verbose
+		test && | && 2>/dev/null then cd cd ${HOME} x=1 'quoted text'
+	then /usr/bin "$@" | local cd -eu && 'quoted text'
+		"$@" 2>/dev/null echo x=1 local
+export | readonly cd 2>/dev/null grep awk
+		${HOME} then sed | printf export then printf --verbose cd echo
+cd "$1" done 2>/dev/null grep 2>/dev/null test awk "$1" cd done 'quoted text' cd
+	test 2>/dev/null local grep && ${HOME} grep -eu -eu cd /usr/bin echo export
+		export sed /usr/bin export
+then "$1" then 'quoted text'
+	local readonly export local 2>/dev/null /usr/bin then
+		'quoted text' ${HOME} export ${HOME} x=1 x=1 echo awk sed echo
+		done ${HOME} --verbose | ${HOME} x=1 -eu -eu local sed echo then
+#include c146.sh
+&& "$@" export test $(pwd) done sed x=1 readonly readonly awk
+	export cd -eu | "$1" /usr/bin printf done "$@" && then && awk then x=1
+		-eu --verbose echo 2>/dev/null && awk test test
+--verbose 2>/dev/null test
+		done ${HOME} then sed export test echo export | && awk 'quoted text'
+	test done done "$@" grep local | ${HOME} sed
+	--verbose cd -eu readonly 2>/dev/null test 'quoted text' $(pwd) "$@" x=1 |
+	"$@" grep readonly --verbose printf "$1" sed local grep export x=1 cd
+printf | -eu "$@" -eu 'quoted text' awk --verbose awk | then "$1" echo readonly
+2>/dev/null local $(pwd) ${HOME} then awk cd 'quoted text' grep "$@" export
+		$(pwd) readonly readonly test export cd
+	${HOME} cd grep readonly 2>/dev/null done readonly readonly 'quoted text' "$@"
+		"$@" /usr/bin sed echo "$1" export awk local --verbose 'quoted text'
+then 2>/dev/null grep /usr/bin -eu x=1 "$1" awk grep "$@" awk -eu then
+	grep | readonly /usr/bin readonly
+		grep 'quoted text' printf printf printf "$@" "$1" | done
+	grep export /usr/bin ${HOME} ${HOME} | local "$1" then cd test awk awk test
+	/usr/bin awk /usr/bin readonly local "$@" "$1" 2>/dev/null $(pwd) | | export
+	$(pwd) export $(pwd) | grep awk
+		&& -eu $(pwd) /usr/bin then 2>/dev/null export /usr/bin 2>/dev/null
+echo /usr/bin "$@" "$@" ${HOME} printf printf
+cd 2>/dev/null | /usr/bin ${HOME} ${HOME} | then then awk awk 'quoted text' -eu
+"$1" | x=1 then | "$1" sed echo -eu $(pwd)
+	sed $(pwd) then 2>/dev/null x=1 then grep test --verbose
+$(pwd) export ${HOME} --verbose 2>/dev/null "$@" printf test grep sed | 2>/dev/null
+		2>/dev/null printf /usr/bin
+		sed x=1 'quoted text' 2>/dev/null
+		printf 'quoted text' test cd
+	/usr/bin cd readonly grep --verbose $(pwd) -eu then then cd sed readonly readonly
+		readonly -eu $(pwd) test && /usr/bin "$1" awk x=1 test done done cd printf
+	&& printf 'quoted text' 2>/dev/null "$1" grep --verbose x=1 echo awk ${HOME}
+sed echo sed 'quoted text'
+cd then | done "$1" 'quoted text' sed
+		grep grep -eu --verbose local 2>/dev/null "$1" cd
+'quoted text' x=1 "$1" sed done 2>/dev/null
+sed && test 'quoted text' then
+"$1" 'quoted text' -eu
+printf then "$1" cd export readonly readonly $(pwd)
+	/usr/bin awk 'quoted text'
+	printf ${HOME} 'quoted text' readonly echo --verbose awk local /usr/bin
+		export cd "$1" /usr/bin 'quoted text' then test sed
+	done 2>/dev/null printf 2>/dev/null | && cd export test x=1 done
+	echo ${HOME} -eu grep awk local echo readonly export "$@"
+	"$@" /usr/bin cd echo test 'quoted text' local 'quoted text' 'quoted text' "$1"
+		echo $(pwd) x=1 | --verbose then $(pwd) 2>/dev/null "$@" awk test export &&
+	then ${HOME} cd sed | readonly export "$1" "$@" cd ${HOME} echo 'quoted text'
+| grep cd "$@" echo $(pwd)
+		$(pwd) awk ${HOME} && $(pwd) | $(pwd) cd ${HOME}
+		/usr/bin readonly sed 2>/dev/null 'quoted text'
+	'quoted text' then local done "$1"
+		2>/dev/null grep /usr/bin && done 'quoted text'
+	cd ${HOME} echo done "$1" sed | printf "$1" awk grep | ${HOME} sed | $(pwd) -eu
+		-eu -eu test local 2>/dev/null then "$1" && sed readonly "$@" printf awk -eu &&
+sed done local test awk &&
+		| local sed export ${HOME} /usr/bin | test local | | printf | | && &&
+		grep -eu | 2>/dev/null --verbose 2>/dev/null export grep
+	awk 2>/dev/null 2>/dev/null grep 2>/dev/null local awk echo ${HOME}
+	done 'quoted text' 2>/dev/null then $(pwd)
+$(pwd) "$1" done 'quoted text'
+		done echo "$@" then export -eu printf export x=1 echo sed cd 'quoted text'
+		test export ${HOME} cd $(pwd) local awk grep "$1" 'quoted text' local /usr/bin
+"$@" readonly -eu "$1" /usr/bin && | 2>/dev/null && echo cd $(pwd) cd awk ${HOME}
+		"$1" ${HOME} $(pwd) x=1 local x=1 ${HOME} test 'quoted text' then
+	--verbose sed 'quoted text' "$@"
+	x=1 then done test done 2>/dev/null
+	-eu sed grep ${HOME} 2>/dev/null "$@" -eu test && cd -eu
+		export awk test | local printf echo echo ${HOME} $(pwd) local
+"$1" 2>/dev/null ${HOME} echo done x=1 sed awk 'quoted text' awk x=1 test 2>/dev/null
+--verbose | ${HOME} export awk && awk --verbose 'quoted text'
+	cd export "$@" "$1" --verbose awk printf sed
+	2>/dev/null | -eu test then "$1" | --verbose printf readonly | sed
+		"$@" cd sed /usr/bin ${HOME} export --verbose && then then /usr/bin test
+readonly local export $(pwd) awk sed
+	x=1 echo export grep $(pwd) printf "$@" echo --verbose test "$@"
+	export echo echo grep -eu 'quoted text' | local 'quoted text'
+		grep 'quoted text' -eu $(pwd) | "$1" local --verbose 2>/dev/null 2>/dev/null
+	test local 2>/dev/null 2>/dev/null "$@" sed 'quoted text' | /usr/bin done local
+		then sed printf cd "$1" && done export grep -eu 'quoted text'
+		| awk local printf grep 'quoted text' -eu x=1
+grep $(pwd) echo done
+		"$1" $(pwd) x=1 -eu done --verbose printf 2>/dev/null printf ${HOME} -eu x=1
+printf "$@" "$1" export grep | test local "$@" 2>/dev/null printf x=1 && then $(pwd)
+	&& local cd export && 2>/dev/null ${HOME} cd printf
+	printf cd sed x=1 x=1 test readonly printf export | grep
+	$(pwd) | echo ${HOME} export done
+readonly readonly readonly then
+		grep "$1" awk printf local awk printf /usr/bin $(pwd) done $(pwd) x=1 printf
+	local | test $(pwd) local | test sed "$1"
+2>/dev/null local awk | --verbose $(pwd) "$@" printf "$@" $(pwd)
+	printf "$1" local done readonly /usr/bin echo awk readonly sed -eu 2>/dev/null
+	"$1" x=1 2>/dev/null cd local then awk export test ${HOME}
+		--verbose awk local sed export
+	export 'quoted text' export cd && done printf -eu done && sed ${HOME} test
+	$(pwd) awk awk /usr/bin
+		done echo "$1" local then echo 2>/dev/null done cd
+"$1" then done 'quoted text' export $(pwd) sed /usr/bin 2>/dev/null
+	${HOME} readonly x=1 $(pwd) -eu test then --verbose | local "$@" 'quoted text'
+done | echo awk done --verbose grep printf /usr/bin local cd test
+	&& printf grep ${HOME} awk export -eu local --verbose
+	$(pwd) sed echo "$1" -eu awk && $(pwd) export -eu then 'quoted text'
+		local x=1 grep "$@" ${HOME}
+| "$@" cd "$1" ${HOME} local
+	/usr/bin 2>/dev/null done -eu "$1" test readonly
+		'quoted text' $(pwd) awk | cd -eu echo --verbose then "$1" -eu awk -eu
+"$1" test $(pwd) "$@" awk awk grep done /usr/bin ${HOME} -eu test --verbose
+"$@" readonly && readonly
+test && done "$1" --verbose | printf echo && -eu ${HOME} local x=1 then /usr/bin
+$(pwd) | | /usr/bin readonly
+local ${HOME} export
+	| awk "$@" cd /usr/bin 'quoted text' grep then $(pwd) awk $(pwd) local
+--verbose && then printf export && /usr/bin echo /usr/bin
+	printf /usr/bin 2>/dev/null && "$1" /usr/bin
+awk cd 2>/dev/null $(pwd) -eu | "$1" "$1"
+${HOME} then $(pwd) sed local 2>/dev/null done local test ${HOME}
+	&& 'quoted text' sed sed
+		then --verbose ${HOME} -eu --verbose --verbose grep /usr/bin
+| printf awk test printf done awk /usr/bin 'quoted text'
+	awk $(pwd) "$@" /usr/bin grep 'quoted text' 'quoted text'
+test awk 2>/dev/null grep "$@" awk readonly readonly
+grep --verbose $(pwd) echo awk printf $(pwd) x=1 --verbose && --verbose
+	"$1" "$1" -eu 'quoted text' awk |
+		local 'quoted text' "$@" cd --verbose
+	"$@" awk -eu --verbose awk test awk sed | cd sed ${HOME}
+		readonly /usr/bin /usr/bin
+	then "$@" echo 'quoted text' "$@" -eu export ${HOME} x=1 printf export
+${HOME} 'quoted text' done readonly awk sed awk x=1 -eu --verbose sed
+		readonly $(pwd) -eu sed echo "$1" awk
+		awk && sed readonly /usr/bin "$@" test /usr/bin
+'quoted text' done test /usr/bin grep sed
+then export printf test printf
+	x=1 sed then then grep readonly
+	then 'quoted text' $(pwd) "$@" "$1" ${HOME} then printf sed done export
+printf export awk --verbose && -eu
+	--verbose cd echo -eu 'quoted text' sed
+	| "$1" local awk export test sed "$@" --verbose export $(pwd) grep export
+		echo done cd sed local /usr/bin local x=1 sed "$1" test "$@" then "$@" sed
+	$(pwd) 2>/dev/null "$@" export && 2>/dev/null --verbose
+--verbose && export $(pwd) printf ${HOME} /usr/bin readonly then export printf
+	then --verbose awk printf
+		| $(pwd) ${HOME} -eu echo 2>/dev/null
+grep awk $(pwd) then --verbose x=1 "$@" $(pwd) awk grep /usr/bin
+	then done done | && "$@" && readonly echo local test
+	cd x=1 "$1" x=1 'quoted text' test cd done "$1" --verbose
+		'quoted text' "$1" -eu printf local "$@"
+		sed readonly done cd export printf then
+		/usr/bin "$1" readonly 2>/dev/null -eu echo 'quoted text' awk readonly ${HOME} awk
+		$(pwd) then readonly grep export grep test $(pwd) | $(pwd) 'quoted text'
+echo /usr/bin grep -eu $(pwd) readonly
+--verbose | grep echo awk "$@" then echo sed printf
+2>/dev/null printf local
+	local cd done 2>/dev/null printf | "$@" /usr/bin
+		$(pwd) "$@" && "$1" 'quoted text'
+2>/dev/null -eu "$@" -eu --verbose "$1"
+	grep "$1" 2>/dev/null done
+		$(pwd) -eu printf x=1 "$@" then "$@" && local /usr/bin
+	${HOME} -eu 2>/dev/null cd echo
+	"$1" printf then readonly 2>/dev/null "$1" $(pwd) export 'quoted text' | /usr/bin
+		2>/dev/null printf sed sed
+		"$1" /usr/bin test $(pwd) local awk
+2>/dev/null local ${HOME}
+	--verbose done sed "$@" "$@" export 'quoted text' local x=1 ${HOME}
+		cd "$@" done printf && done sed /usr/bin then
+	then grep --verbose "$1" "$1" "$1" && echo cd awk $(pwd) local | && $(pwd)
+		--verbose test -eu echo 'quoted text' done test -eu printf && x=1 then
+		x=1 then "$1" 'quoted text' -eu local $(pwd) cd 2>/dev/null
+--verbose printf "$@" "$1" echo ${HOME}
+		local printf test ${HOME} echo awk test readonly done | x=1 awk grep
+local sed echo $(pwd) /usr/bin ${HOME} --verbose echo echo "$1" -eu
+		--verbose "$@" x=1 x=1 'quoted text'
+		| /usr/bin awk && cd export test readonly "$1" awk 'quoted text'
+	"$@" readonly done "$1" readonly ${HOME} then readonly echo "$1"
+cd 'quoted text' | sed "$@" "$1" then printf awk 2>/dev/null
+x=1 printf 2>/dev/null sed printf then readonly
+	local then $(pwd) awk readonly echo test 'quoted text'
+	done /usr/bin done readonly
+/usr/bin ${HOME} /usr/bin printf cd 2>/dev/null
+		--verbose 2>/dev/null export 'quoted text' cd
+	--verbose echo printf sed
+printf cd -eu $(pwd) --verbose && awk --verbose 2>/dev/null
+		readonly readonly cd x=1 local
+	$(pwd) then --verbose "$@" && /usr/bin -eu local echo
+--verbose export -eu -eu | readonly done grep printf /usr/bin "$1" then --verbose
+		local x=1 sed x=1 "$1" 'quoted text' export ${HOME} $(pwd) local grep
+export x=1 "$@" test then x=1 echo | "$@" "$@"
+	'quoted text' cd 2>/dev/null echo cd "$@" readonly --verbose
+	&& -eu test -eu ${HOME} x=1 ${HOME}
+sed export test local "$@"
+test 2>/dev/null /usr/bin /usr/bin x=1 awk sed sed && readonly
+readonly "$@" "$1" sed "$@" x=1 --verbose "$1" && --verbose local awk --verbose
+test echo x=1 $(pwd) "$1" "$1" $(pwd)
+		$(pwd) $(pwd) export "$@" local -eu && -eu sed "$1" grep cd done
+export done then && test x=1 echo echo 2>/dev/null awk 'quoted text'
+		test 'quoted text' readonly
+-eu local "$1" ${HOME} "$@" x=1
+		readonly | --verbose grep echo --verbose
+		grep "$1" local && local then sed local "$@" local done cd && awk local printf
+	"$1" then 'quoted text' "$1" printf awk && "$@"
+		printf readonly test 2>/dev/null printf readonly
+2>/dev/null && "$1" grep local /usr/bin echo /usr/bin readonly | "$1"
+		| test done cd export readonly 'quoted text'
+		printf local x=1 /usr/bin x=1 printf
+		grep then -eu printf then $(pwd) printf awk printf then cd local
+| done local export printf x=1 then
+		$(pwd) local then then "$@" printf | 'quoted text' export ${HOME}
+		echo printf 'quoted text' echo /usr/bin readonly | $(pwd) test printf
+		printf 'quoted text' printf $(pwd) "$@" test test ${HOME} 2>/dev/null awk 'quoted text'
+"$@" then "$@" 'quoted text' awk sed ${HOME} 'quoted text'
+		$(pwd) printf | echo
+	-eu cd --verbose --verbose x=1 /usr/bin 2>/dev/null
+	/usr/bin --verbose test "$@" "$1" --verbose grep sed /usr/bin
+		cd | ${HOME} local x=1 awk x=1 cd "$@" awk |
+/usr/bin "$@" x=1 echo 'quoted text' "$1" 2>/dev/null
+	awk awk --verbose "$1" echo --verbose
+	&& grep readonly sed $(pwd) echo x=1
+	local "$1" sed test --verbose echo 'quoted text' && --verbose /usr/bin
+		cd sed test /usr/bin cd done $(pwd) "$1" "$@" -eu "$@"
+cd -eu ${HOME} cd -eu && "$1" --verbose "$1" -eu "$1" printf printf readonly
+		| $(pwd) ${HOME} | then local $(pwd)
+--verbose awk --verbose
+	${HOME} export awk -eu
+	${HOME} 'quoted text' local cd $(pwd) echo test
+	/usr/bin -eu sed x=1 awk
+		then ${HOME} -eu "$@" /usr/bin $(pwd) --verbose then ${HOME} then 'quoted text'
+--verbose x=1 -eu | local "$@" /usr/bin 'quoted text'
+cd done echo grep done | echo /usr/bin printf awk 'quoted text'
+${HOME} x=1 x=1 --verbose printf "$1" 'quoted text' sed readonly
+cd "$@" $(pwd) | echo readonly then | printf "$1" ${HOME} "$@" echo grep readonly
+	readonly export 'quoted text' x=1 awk --verbose
+		--verbose --verbose export
+		| local grep $(pwd) /usr/bin sed "$1" then grep /usr/bin sed | local echo
+		x=1 "$@" "$1" done -eu "$@" awk | then "$@" ${HOME}
+'quoted text' done test && && readonly then
+		--verbose awk --verbose ${HOME} done && /usr/bin /usr/bin
+$(pwd) $(pwd) "$@" /usr/bin | export local && printf
+		'quoted text' sed readonly then done grep then
+		"$@" x=1 "$1" "$1" && local grep readonly "$1" test test "$1"
+		'quoted text' -eu test
+	done "$@" "$@" && "$1"
+cd "$@" ${HOME} grep export
+	2>/dev/null test test export echo "$@" local cd done ${HOME} done /usr/bin done
+2>/dev/null grep printf | then local then cd test local x=1 local
+		&& then -eu then ${HOME} done
+		sed --verbose x=1 cd "$@" then | && done local /usr/bin | cd
+		export cd echo 'quoted text' local cd | "$1" 'quoted text' awk awk done local 'quoted text'
+		| x=1 sed 2>/dev/null cd x=1 ${HOME} echo test readonly then export echo sed
+export ${HOME} sed done readonly 'quoted text'
+-eu "$@" awk awk "$@" awk export $(pwd) && sed local 'quoted text'
+| awk ${HOME} --verbose then $(pwd) "$1" $(pwd) "$1" "$1"
+		"$1" export "$1" --verbose export echo echo $(pwd) "$@" test
+	readonly -eu --verbose readonly printf awk
+"$@" | then 2>/dev/null
+	| local sed cd ${HOME} awk -eu then printf && $(pwd) && grep /usr/bin
+	printf | export then -eu x=1 echo
+		export 'quoted text' "$1" awk $(pwd) -eu sed awk readonly test
+	export done && export 2>/dev/null then echo printf grep x=1 "$@"
+&& then ${HOME} x=1 cd local printf echo 'quoted text' 2>/dev/null
+grep x=1 sed test export $(pwd) 'quoted text'
+--verbose /usr/bin local grep $(pwd) "$@" -eu -eu printf readonly
+		then -eu printf /usr/bin --verbose then cd x=1 --verbose
+	then ${HOME} echo "$@" "$@" 'quoted text'
+	sed test | readonly cd then export then 2>/dev/null "$@"
+	"$@" done local --verbose -eu grep
+		echo && printf ${HOME}
+"$1" then x=1 $(pwd) local grep x=1 sed ${HOME}
+	printf export done echo ${HOME} export "$1" sed 'quoted text'
+	local grep done awk ${HOME} --verbose
+echo | export echo then /usr/bin done readonly "$1" export
+export done cd grep local local awk | then $(pwd) 2>/dev/null
+	test -eu sed /usr/bin 'quoted text' printf export grep grep then 'quoted text'
+	x=1 x=1 2>/dev/null echo test | "$1" 'quoted text' done 2>/dev/null
+		/usr/bin readonly cd "$1" readonly grep awk printf | | echo
+	-eu then "$1" then && && local && awk "$1"
+		"$1" ${HOME} --verbose -eu printf done test | ${HOME}
+		cd 'quoted text' | local printf export sed x=1 cd "$1" ${HOME}
+'quoted text' --verbose $(pwd) then 'quoted text'
+	echo printf readonly grep |
+-eu then cd test done $(pwd) ${HOME} x=1 cd
+		awk x=1 sed printf -eu 'quoted text'
+		"$@" done 2>/dev/null local $(pwd) | "$1" "$1" /usr/bin --verbose x=1 echo "$@"
+2>/dev/null cd test test local test sed ${HOME} local echo | then test readonly
+		grep done grep cd then /usr/bin | x=1 x=1 then then /usr/bin readonly printf
+	-eu -eu && local x=1 && --verbose
+		awk then $(pwd) -eu ${HOME} done x=1 grep 'quoted text'
+-eu --verbose "$@" $(pwd) readonly sed sed 2>/dev/null $(pwd) then awk
+echo && "$@" ${HOME} "$1" x=1 echo $(pwd) grep "$1" 2>/dev/null $(pwd)
+		'quoted text' 'quoted text' export sed 2>/dev/null -eu sed
+		then 'quoted text' local sed | awk "$@" local echo ${HOME} done local sed echo
+	--verbose ${HOME} --verbose -eu 'quoted text'
+		"$@" ${HOME} "$1" | printf
+	"$@" export -eu sed $(pwd) grep
+	&& "$1" --verbose echo ${HOME} && then cd export cd grep x=1 $(pwd)
+readonly export && -eu $(pwd) "$@" && /usr/bin cd awk
+	"$@" readonly "$@" test test local local 2>/dev/null
+	test readonly "$1" x=1 awk
+--verbose --verbose done | done cd local awk sed x=1 -eu echo grep ${HOME}
+		echo then awk grep awk local && sed -eu --verbose
+	x=1 sed test 2>/dev/null echo done && 2>/dev/null "$1" 'quoted text'
+-eu $(pwd) export ${HOME} echo
+	printf && then done local /usr/bin grep --verbose
+		echo echo sed | test export /usr/bin -eu cd x=1 test awk echo 'quoted text'
+	$(pwd) export /usr/bin
+	printf 2>/dev/null && readonly --verbose readonly echo cd test $(pwd)
+	readonly local "$1" -eu "$@" readonly 2>/dev/null
+readonly | readonly ${HOME} -eu sed test && awk echo /usr/bin export -eu 'quoted text'
+		local /usr/bin "$1" x=1 $(pwd)
+-eu /usr/bin && $(pwd) echo --verbose 2>/dev/null then 'quoted text' "$1" 2>/dev/null
+awk then printf export | && $(pwd) then
+	/usr/bin ${HOME} | $(pwd) then sed && export | printf done "$@" grep printf
+	local readonly /usr/bin "$@" done local awk --verbose --verbose
+| done readonly sed 2>/dev/null printf cd -eu "$1" ${HOME}
+		cd "$@" 'quoted text' 'quoted text' 'quoted text' local x=1 2>/dev/null
+		done test 'quoted text' readonly then | then cd local $(pwd)
+x=1 x=1 x=1 grep "$1" cd test 'quoted text' "$@" x=1 "$1" 'quoted text' "$@"
+"$1" cd "$@" readonly then x=1
+'quoted text' local sed test
+export && done 2>/dev/null grep && ${HOME} cd grep awk |
+grep awk test then $(pwd) 2>/dev/null cd ${HOME}
+test export echo 2>/dev/null $(pwd) 'quoted text' "$@" ${HOME} readonly
+grep export cd 2>/dev/null local "$1" cd && cd && 2>/dev/null
+printf readonly readonly printf grep -eu readonly then && done x=1 printf
+	then "$@" -eu --verbose /usr/bin 2>/dev/null
+-eu awk /usr/bin --verbose printf grep $(pwd) test --verbose /usr/bin
+awk 'quoted text' ${HOME} x=1 then "$@" ${HOME} 'quoted text'
+	x=1 && "$1" | echo x=1 $(pwd)
+	cd grep sed x=1 | $(pwd) cd export
+		'quoted text' echo done done printf ${HOME} 'quoted text'
+then test export then export -eu done grep cd echo cd grep grep
+echo then /usr/bin && 'quoted text' done sed $(pwd) export | sed sed awk
+	export then echo echo ${HOME}
+	&& grep cd x=1 $(pwd) $(pwd) x=1 "$1" "$1" x=1 ${HOME} /usr/bin
+		grep 'quoted text' export echo x=1 export
+local test 'quoted text' 'quoted text' -eu done awk /usr/bin test local
+		| && then ${HOME} --verbose local cd $(pwd) "$1" cd echo
+		cd awk awk --verbose local then -eu printf "$1" then echo
+done export 'quoted text' readonly cd
+	/usr/bin done -eu --verbose | printf 'quoted text'
+2>/dev/null 'quoted text'
+	'quoted text' echo awk | cd test readonly sed | then
+	then 2>/dev/null sed test /usr/bin cd
+local done echo done x=1 then -eu && then ${HOME}
+		then && cd done /usr/bin "$1" then 2>/dev/null | then done done x=1 2>/dev/null
+x=1 x=1 && "$@" -eu "$1" echo export awk "$@" grep 2>/dev/null
+	x=1 export "$1" export --verbose
+test ${HOME} x=1 /usr/bin "$1" printf echo echo "$1" "$@" --verbose
+	| printf awk | "$1" readonly --verbose 2>/dev/null | x=1 "$1"
+	done x=1 $(pwd) test then awk echo /usr/bin readonly done
+	2>/dev/null x=1 "$@" echo done cd 2>/dev/null /usr/bin test 2>/dev/null
+done test "$@" sed "$1"
+	test 2>/dev/null grep 'quoted text' done ${HOME} -eu
+	cd 'quoted text' 2>/dev/null ${HOME} awk /usr/bin
+cd | x=1 /usr/bin ${HOME} export 2>/dev/null
+		export 2>/dev/null -eu ${HOME} cd
+	done /usr/bin export test local "$@" -eu "$@" 2>/dev/null
+	sed done --verbose "$@" grep
+		$(pwd) printf "$@" export $(pwd) "$1" "$1" sed
+		${HOME} /usr/bin test && sed $(pwd) 'quoted text' export
+		2>/dev/null local 'quoted text' awk grep done
+		${HOME} grep | grep awk export
+		export echo grep awk | -eu done readonly
+	grep sed 'quoted text' done local "$1" test "$@" && -eu && echo
+	2>/dev/null done readonly echo x=1 "$1" $(pwd) printf "$1" awk awk readonly "$1"
+"$@" --verbose "$@" "$@" local
+		local echo then ${HOME} | --verbose "$@" --verbose local
+		2>/dev/null local done 'quoted text' -eu --verbose
+$(pwd) -eu grep cd "$1" x=1 sed awk ${HOME} x=1 && grep --verbose cd sed readonly
+		&& printf /usr/bin && --verbose local |
+	--verbose awk x=1 $(pwd)
+		printf awk -eu "$@" then
+	x=1 echo then --verbose "$1" | cd sed cd | | 2>/dev/null done awk |
+grep test cd echo x=1 export test test export cd -eu cd done /usr/bin
+/usr/bin | 2>/dev/null cd then echo readonly printf readonly
+| -eu export | awk sed export readonly test /usr/bin printf /usr/bin -eu 'quoted text'
+2>/dev/null readonly cd readonly
+	done | then $(pwd) grep "$1" "$@" awk cd "$@" echo
+		/usr/bin "$@" | --verbose -eu printf
+	$(pwd) grep -eu readonly "$1" readonly
+	x=1 | x=1 export x=1 sed sed readonly | $(pwd) readonly export echo test
+done 'quoted text' test "$@" /usr/bin local ${HOME} -eu
+		readonly export echo | local 2>/dev/null $(pwd) test "$1" export grep cd | "$1"
+	2>/dev/null /usr/bin x=1 "$1" local done test
+	readonly && echo local | /usr/bin
+		local done awk cd printf && 2>/dev/null
+		awk local sed | printf ${HOME} ${HOME} test 2>/dev/null $(pwd) "$@" 2>/dev/null
+		-eu $(pwd) | --verbose /usr/bin cd export $(pwd)
+/usr/bin echo && then ${HOME} done local 2>/dev/null cd cd x=1
+		--verbose local then sed "$1" then -eu local 'quoted text' awk ${HOME} &&
+x=1 grep x=1 x=1 done readonly done grep test
+		${HOME} printf printf grep local cd sed done printf echo local $(pwd)
+		'quoted text' "$1" test $(pwd) printf
+	"$@" sed export && readonly 2>/dev/null export && $(pwd) local
+		local echo && local printf then
+readonly -eu && $(pwd) local ${HOME}
+		| then awk | "$@" done export 'quoted text' grep then $(pwd)
+readonly then export awk awk ${HOME} ${HOME} 'quoted text' grep cd awk $(pwd)
+	test export sed awk then then ${HOME} awk $(pwd) sed cd awk 2>/dev/null 2>/dev/null
+	/usr/bin -eu "$@" 'quoted text' "$@"
+	readonly done test --verbose "$@" && && grep export
+x=1 -eu && "$@" cd cd /usr/bin cd | -eu "$@" export cd grep local --verbose
+"$@" then grep then then "$1" done readonly 'quoted text'
+echo ${HOME} awk local | cd awk printf cd "$1" --verbose export cd then ${HOME}
+		cd | readonly $(pwd) "$1" 2>/dev/null awk "$1"
+grep /usr/bin && -eu 'quoted text' && -eu cd -eu printf
+		| done echo | local then && local ${HOME} sed awk done export
+		sed done done 'quoted text' /usr/bin "$@" echo test printf local -eu
+		echo && x=1 awk 2>/dev/null 'quoted text' done done 2>/dev/null 'quoted text'
+	test export echo 'quoted text' 2>/dev/null echo /usr/bin cd && | x=1 "$1"
+		&& 'quoted text' --verbose -eu echo -eu cd ${HOME} awk echo 'quoted text'
+	--verbose local grep x=1 /usr/bin
+		'quoted text' x=1 grep done 'quoted text' sed "$@"
+	echo && then "$1" 'quoted text' x=1 /usr/bin sed then
+	readonly 'quoted text'
+	sed cd -eu x=1 export "$1" cd grep
+-eu ${HOME} local printf "$@" local "$@" | /usr/bin grep
+		| && | | test cd | sed --verbose "$@" grep sed $(pwd) then
+	local --verbose readonly done 2>/dev/null
+		export echo 2>/dev/null export readonly
+	then "$1" grep x=1 "$@" "$1" printf
+'quoted text' ${HOME} ${HOME} export readonly
+&& export local $(pwd) && printf awk export ${HOME} 'quoted text' local
+local | echo 'quoted text' && echo test $(pwd)
+	grep sed awk --verbose grep cd /usr/bin --verbose test 2>/dev/null test
+	sed readonly "$@" -eu export /usr/bin
+echo && done $(pwd) $(pwd) local 2>/dev/null "$@"
+	cd --verbose --verbose printf printf
+&& ${HOME} then then local readonly "$1" sed -eu echo 'quoted text'
+	echo "$@" awk then test "$@" awk local printf $(pwd) "$1" export
+		'quoted text' $(pwd) test local export -eu done "$@" readonly awk echo 'quoted text'
+then x=1 sed "$@" /usr/bin
+		-eu printf -eu readonly ${HOME} printf cd printf
+		"$@" export echo then --verbose sed
+export 2>/dev/null printf "$1" ${HOME} ${HOME} export done | test
+		sed /usr/bin x=1 awk ${HOME} grep --verbose
+	-eu echo x=1 done awk "$@" then ${HOME} | ${HOME} --verbose | sed cd 2>/dev/null
+		local $(pwd) test $(pwd) --verbose "$1" | "$1"
+		printf $(pwd) -eu -eu -eu test readonly printf sed done ${HOME}
+	${HOME} | $(pwd) test sed 'quoted text' sed --verbose 'quoted text' cd cd
+		"$@" -eu "$1" "$1" sed then echo sed grep printf
+test awk /usr/bin $(pwd) "$1" x=1 -eu echo then cd /usr/bin -eu /usr/bin
+	local printf 2>/dev/null
+cd /usr/bin /usr/bin grep cd local local && local $(pwd) "$@"
+	awk export local done x=1 test grep "$1" awk done export grep x=1 echo
+	x=1 done ${HOME} /usr/bin local echo $(pwd)
+	&& -eu -eu readonly "$1" done --verbose echo 'quoted text' sed
+awk printf grep local then echo
+		then test -eu readonly then | 'quoted text' readonly
+		/usr/bin | grep ${HOME} readonly awk
+		readonly $(pwd) awk /usr/bin test readonly
+		awk local /usr/bin $(pwd)
+		"$@" echo test awk grep grep
+	"$@" test readonly awk | test | grep --verbose /usr/bin "$@" --verbose
+	-eu 2>/dev/null 2>/dev/null echo grep cd printf
+	"$1" -eu --verbose "$@" printf
+	grep sed awk "$1" "$@" grep readonly "$@" "$@" test "$1" x=1 awk sed
+	local "$1" | grep "$1" done readonly /usr/bin grep grep && "$1"
+	printf x=1 x=1 && $(pwd) export 2>/dev/null | 'quoted text'
+		cd cd x=1 then cd done $(pwd) printf grep | x=1 | echo 2>/dev/null
+		2>/dev/null grep /usr/bin awk && awk -eu awk awk x=1 "$@" awk | local &&
+		printf grep "$@" cd grep ${HOME} export then | "$@" readonly
+		done ${HOME} -eu local export
+		readonly 2>/dev/null export 2>/dev/null "$1" && "$@" grep "$@" "$1" printf
+-eu && x=1 /usr/bin 2>/dev/null 2>/dev/null
+	then test awk grep grep test $(pwd) x=1 --verbose "$@" sed export $(pwd) echo
+		export x=1 test readonly grep test "$@" x=1 /usr/bin "$@" 2>/dev/null cd
+x=1 "$1" "$1" awk ${HOME} &&
+/usr/bin export | x=1 grep 2>/dev/null
+then x=1 2>/dev/null cd awk $(pwd) "$@"
+		cd "$1" local export echo readonly -eu printf && grep then export && printf
+		2>/dev/null $(pwd) | echo cd -eu
+	x=1 -eu "$1" /usr/bin then 'quoted text'
+	| 2>/dev/null /usr/bin --verbose "$@" | /usr/bin
+	2>/dev/null | --verbose "$1" sed -eu cd done --verbose -eu
+	--verbose cd ${HOME} "$1" sed 2>/dev/null readonly
+"$@" $(pwd) $(pwd) /usr/bin export readonly grep $(pwd)
+	"$@" && "$@" && $(pwd) cd awk /usr/bin done ${HOME} ${HOME} then && readonly ${HOME}
+		| ${HOME} && export awk test 2>/dev/null sed then export
+		local then then grep ${HOME} 2>/dev/null grep --verbose then 'quoted text'
+		"$1" $(pwd) /usr/bin grep echo "$@" && awk
+printf test $(pwd) readonly test
+		readonly readonly ${HOME}
+	2>/dev/null x=1 -eu export readonly 'quoted text'
+"$1" cd awk readonly 'quoted text' x=1 export /usr/bin grep
+	| ${HOME} export export done readonly "$1" local 'quoted text' --verbose
+$(pwd) 2>/dev/null test | | done --verbose $(pwd) export readonly "$@"
+		test 2>/dev/null && done
+		$(pwd) && echo printf 2>/dev/null && export local x=1 then
+		cd echo x=1 printf 2>/dev/null then sed echo then export readonly
+	"$@" readonly local sed "$@" grep x=1 x=1 x=1 --verbose export
+	readonly | then then --verbose "$@" done sed
+echo "$1" 'quoted text' awk
+done ${HOME} $(pwd) echo "$1" export | x=1 sed readonly "$@" printf 'quoted text'
+	done "$1" sed sed "$@" --verbose -eu sed local | test /usr/bin
+		"$1" export then 2>/dev/null && local printf
+		done /usr/bin 2>/dev/null awk ${HOME} -eu grep
+export done "$@" printf /usr/bin
+	grep | grep readonly readonly awk readonly -eu then then then $(pwd) --verbose
+echo $(pwd) grep /usr/bin && | sed && test then --verbose then --verbose
+	cd test test -eu printf x=1 x=1 local test "$@" 'quoted text'
+		"$1" echo grep cd x=1 "$1" x=1 $(pwd) 2>/dev/null
+		printf ${HOME} x=1 /usr/bin --verbose && grep done 2>/dev/null awk 2>/dev/null
+printf awk export && /usr/bin test 2>/dev/null
+-eu /usr/bin awk --verbose export
+		/usr/bin export readonly /usr/bin ${HOME} then local --verbose
+	"$@" 2>/dev/null "$@" cd test --verbose printf printf | "$1" -eu ${HOME}
+echo | sed readonly | awk grep printf -eu sed then readonly echo --verbose
+done /usr/bin "$@" sed | | export done
+--verbose ${HOME} $(pwd) cd readonly
+readonly readonly then && test "$@" $(pwd) local echo /usr/bin readonly
+$(pwd) | test x=1 -eu awk then grep echo "$@" -eu
+echo cd --verbose "$1" awk | readonly
+	x=1 -eu awk x=1 grep sed
+	cd ${HOME} "$1" sed readonly export cd test
+	echo /usr/bin && "$1" 2>/dev/null "$1" "$1" ${HOME} cd readonly then && 'quoted text'
+	"$@" ${HOME} 2>/dev/null sed export 'quoted text' local
+awk 2>/dev/null x=1 $(pwd) then $(pwd)
+export local cd "$1" --verbose "$@" local x=1 /usr/bin echo x=1
+	test --verbose /usr/bin grep grep "$1" grep sed printf 2>/dev/null
+awk ${HOME} 'quoted text' ${HOME} cd awk awk echo $(pwd) then grep then
+'quoted text' awk export readonly export
+	grep then echo cd && "$1" --verbose | ${HOME} 2>/dev/null
+	test 2>/dev/null cd "$1" done export | | && echo | awk && ${HOME}
+		/usr/bin -eu && echo x=1 && awk /usr/bin cd
+		${HOME} && 2>/dev/null ${HOME} /usr/bin
+	--verbose local 'quoted text' readonly
+		'quoted text' cd sed echo readonly
+done grep ${HOME} /usr/bin 2>/dev/null done --verbose cd --verbose
+local cd -eu ${HOME} then echo done printf awk test | ${HOME} grep /usr/bin
+done "$1" echo sed then sed awk ${HOME} | export cd 2>/dev/null
+	test test -eu && 2>/dev/null --verbose
+	done "$@" then then -eu $(pwd) echo readonly /usr/bin done | done
+readonly cd --verbose echo local awk
+	$(pwd) $(pwd) | done export /usr/bin
+		| printf 2>/dev/null x=1
+	cd 'quoted text' then
+		-eu | readonly $(pwd) "$@" ${HOME} /usr/bin local echo
+		2>/dev/null 2>/dev/null x=1 awk && done export local | "$1" --verbose -eu test
+2>/dev/null --verbose cd "$@" "$@" && local
+	grep "$@" export local -eu grep $(pwd) x=1 $(pwd)
+"$1" cd /usr/bin "$1" ${HOME} echo grep done x=1 then export | ${HOME} test
+test awk echo cd export --verbose done
+	-eu && && echo /usr/bin | "$1" | cd $(pwd) -eu local -eu "$1"
+&& --verbose grep && echo test export local 'quoted text' /usr/bin test "$1"
+	2>/dev/null sed readonly printf
+	test --verbose awk && "$@" cd export printf "$@"
+	&& ${HOME} 'quoted text' 2>/dev/null "$@" x=1 'quoted text'
+	sed echo | | -eu "$@" sed local test
+		"$1" done readonly export cd "$1" -eu ${HOME} printf grep
+-eu --verbose cd ${HOME} $(pwd)
+	done done echo -eu 2>/dev/null "$1" "$1" grep echo
+	readonly cd $(pwd) local $(pwd)
+	x=1 $(pwd) echo "$@" done export local printf
+		&& 'quoted text' --verbose local then && done local 'quoted text'
+		${HOME} $(pwd) done "$1" local grep "$@" 2>/dev/null ${HOME} $(pwd)
+	${HOME} | -eu cd test cd --verbose readonly
+	'quoted text' x=1 grep | ${HOME} local cd
+"$1" | cd test readonly export --verbose /usr/bin
+	"$@" ${HOME} $(pwd) test sed "$1" | && local local x=1 done
+"$@" done echo x=1 x=1 test x=1 test cd x=1 then echo x=1 && echo
+	grep then 2>/dev/null | awk done
+	local awk && done grep export printf --verbose cd then echo echo grep printf
+	2>/dev/null awk 2>/dev/null
+	--verbose then test cd /usr/bin | && "$@" 2>/dev/null
+	'quoted text' $(pwd) ${HOME} -eu ${HOME} x=1 "$@" cd -eu x=1
+		test then ${HOME} done local grep /usr/bin export test ${HOME} | then && ${HOME}
+		export local test echo grep cd done 2>/dev/null $(pwd)
+		| "$@" --verbose test $(pwd) | "$@"
+	$(pwd) echo test /usr/bin
+awk "$1" awk export export && printf 2>/dev/null
+		'quoted text' grep then ${HOME} cd 2>/dev/null
+	-eu printf ${HOME} grep cd test
+		then cd 2>/dev/null "$1" export test -eu 2>/dev/null
+		"$1" echo local grep test export grep /usr/bin awk
+	then && $(pwd) 'quoted text' local echo printf test
+		echo cd $(pwd) /usr/bin -eu test 2>/dev/null cd $(pwd)
+		| echo x=1 then $(pwd) export
+		${HOME} done sed | "$1"
+	&& export awk readonly local awk awk x=1 "$@" 2>/dev/null
+		printf echo printf 2>/dev/null sed readonly /usr/bin "$@" awk
+-eu "$1" printf test awk awk cd local 2>/dev/null 'quoted text' /usr/bin /usr/bin
+local -eu "$1" 'quoted text' "$@" test 'quoted text' 'quoted text' x=1 local
+	/usr/bin $(pwd) --verbose --verbose
+		readonly export | grep 2>/dev/null done && $(pwd) test export then
+		test x=1 "$@" awk then awk ${HOME} local "$@" sed printf "$1" 'quoted text'
+	&& $(pwd) then done printf $(pwd) readonly x=1 $(pwd) /usr/bin
+	awk grep cd export x=1 cd export cd awk |
+	2>/dev/null grep --verbose done "$@" then local
+2>/dev/null sed x=1 test cd "$@" cd /usr/bin | x=1 readonly then cd cd done $(pwd)
+		$(pwd) --verbose awk then ${HOME} | sed readonly
+		echo export test grep printf printf | done /usr/bin
+	local --verbose "$1" x=1 printf printf
+		--verbose cd -eu /usr/bin cd $(pwd) && local echo && test --verbose && | then
+		echo test awk ${HOME} done --verbose /usr/bin echo readonly "$@" readonly
+		2>/dev/null /usr/bin cd awk /usr/bin
+2>/dev/null cd | awk awk
+	"$@" /usr/bin sed test echo grep then ${HOME} 2>/dev/null
+--verbose /usr/bin awk local ${HOME} cd grep | && "$@" 'quoted text' then sed
+		printf local /usr/bin sed cd local sed echo 2>/dev/null export x=1
+	${HOME} cd test readonly local
+2>/dev/null test && then --verbose
+		local done 'quoted text' 2>/dev/null readonly
+		awk 'quoted text' && --verbose 'quoted text' awk
+	--verbose readonly cd echo test sed local
+local echo test -eu grep grep "$1" ${HOME} then export echo && cd x=1 done |
+		/usr/bin "$@" && | x=1 /usr/bin --verbose && echo
+		export "$1" printf test | printf /usr/bin "$1" -eu local echo awk printf sed --verbose
+	then cd --verbose "$@" && export grep
+		then done export then $(pwd) then x=1 x=1 $(pwd) awk -eu 2>/dev/null
+		awk done "$@" sed | "$1" printf
+	| cd "$1" --verbose awk $(pwd) /usr/bin test --verbose
+	then | --verbose 2>/dev/null export 'quoted text'
+		/usr/bin printf done done readonly $(pwd) cd &&
+		"$@" readonly readonly cd x=1 && cd --verbose test x=1 $(pwd) printf test cd test
+local "$1" test 'quoted text' test export printf 2>/dev/null cd sed ${HOME}
+	"$1" then | awk 2>/dev/null
+	awk 2>/dev/null x=1 "$1" echo then export -eu grep /usr/bin local sed cd then
+2>/dev/null $(pwd) sed "$1" /usr/bin --verbose
+		x=1 "$1" export "$@" then then -eu done printf 2>/dev/null done
+	printf ${HOME} readonly && "$1" | /usr/bin ${HOME} "$@" sed ${HOME} && sed local
+		sed done readonly cd sed export
+	cd | "$1" cd echo 'quoted text' "$@" test
+		x=1 done "$@" "$@" && -eu "$@" awk grep ${HOME} echo -eu /usr/bin printf printf
+		export awk cd readonly 2>/dev/null done /usr/bin local /usr/bin cd "$1" cd grep
+		export "$1" $(pwd) | local awk readonly cd /usr/bin cd printf "$@" test "$@"
+		${HOME} awk /usr/bin && --verbose
+	| export echo grep awk "$@" && x=1 sed then export sed grep 2>/dev/null x=1 "$1"
+${HOME} readonly cd /usr/bin -eu export local 2>/dev/null
+-eu grep local "$1" printf echo && cd test --verbose
+		export "$1" cd printf "$@" grep done
+		then echo printf 'quoted text' done readonly
+local local grep ${HOME} test $(pwd) printf --verbose sed local --verbose awk
+		&& then readonly --verbose --verbose 2>/dev/null && printf --verbose
+		awk "$@" echo awk /usr/bin 'quoted text' export /usr/bin "$1"
+awk ${HOME} grep grep
+		test printf awk ${HOME} | -eu readonly echo ${HOME} grep && | grep -eu /usr/bin
+export export cd && x=1 | readonly "$1" "$@" readonly ${HOME}
+"$@" --verbose then export then awk export | printf sed /usr/bin
+	$(pwd) printf readonly awk readonly echo -eu readonly && echo && && "$@" --verbose
+	"$1" export 2>/dev/null && "$1" ${HOME}
+	2>/dev/null printf "$1" && printf 2>/dev/null --verbose $(pwd) test grep x=1
+	--verbose export -eu echo then /usr/bin awk 'quoted text'
+	echo x=1 local sed /usr/bin test
+		readonly cd /usr/bin "$1" ${HOME}
+x=1 /usr/bin export "$@" printf ${HOME}
+	"$1" done done awk /usr/bin readonly x=1
+	test echo grep x=1 ${HOME} done "$1" 'quoted text' export done grep
+		sed 'quoted text' x=1 then export x=1 /usr/bin $(pwd) 'quoted text' then
+done readonly --verbose 'quoted text' x=1 local then awk done printf then
+/usr/bin ${HOME} sed | x=1 grep /usr/bin then awk x=1 $(pwd) x=1 x=1 /usr/bin
+		awk printf /usr/bin then export 2>/dev/null "$1" "$@" sed 2>/dev/null
+		then readonly x=1 -eu test
+	'quoted text' readonly /usr/bin
+		--verbose printf 2>/dev/null grep
+	/usr/bin $(pwd) x=1 "$@" x=1 2>/dev/null readonly local then grep awk cd
+echo grep grep then local grep /usr/bin grep ${HOME} ${HOME} /usr/bin
+	| awk && test sed printf test local awk then printf | 'quoted text' done "$@" grep
+	readonly then "$1" "$@" printf done awk echo
+	${HOME} -eu 'quoted text' -eu ${HOME} readonly echo "$@" sed
+		"$@" && && grep cd awk 2>/dev/null
+x=1 /usr/bin $(pwd) 'quoted text' | | printf export grep $(pwd) export local --verbose
+	echo export local /usr/bin grep && $(pwd) grep test 2>/dev/null
+cd export grep && "$1" x=1 "$1" "$1" $(pwd) test test 'quoted text'
+		| "$1" printf readonly /usr/bin 2>/dev/null cd --verbose readonly
+		"$@" sed && --verbose --verbose 2>/dev/null
+&& echo $(pwd) 2>/dev/null then readonly
+	readonly sed then awk "$1" awk printf grep done ${HOME}
+		'quoted text' x=1 cd && printf awk 2>/dev/null -eu "$1" cd cd awk readonly
+	echo $(pwd) 2>/dev/null echo 2>/dev/null
+		printf "$1" 2>/dev/null cd echo done done ${HOME} x=1 $(pwd) 2>/dev/null
+test "$@" then echo -eu then
+test echo local export local 2>/dev/null 'quoted text' cd readonly
+'quoted text' grep 'quoted text' $(pwd) cd done
+	x=1 | grep "$@" sed &&
+		| cd "$@" cd 'quoted text'
+awk cd --verbose done | "$1" local --verbose
+		--verbose --verbose x=1 test printf test | | sed ${HOME}
+		2>/dev/null "$@" echo && 2>/dev/null -eu awk done cd echo test local
+$(pwd) cd cd 'quoted text' "$1" awk export
+		"$@" sed echo -eu --verbose && done done 2>/dev/null
+--verbose 'quoted text' ${HOME} 'quoted text' -eu done local 'quoted text' &&
+printf "$1" test readonly cd 2>/dev/null
+	--verbose "$@" "$1" 'quoted text' x=1 awk "$@" && local sed 'quoted text' &&
+		printf ${HOME} test printf "$@" 'quoted text' done echo cd test --verbose
+		/usr/bin "$1" cd test $(pwd) cd -eu "$@" "$@" /usr/bin "$@" ${HOME}
+export $(pwd) sed && -eu awk $(pwd)
+		echo grep echo awk x=1 export | --verbose grep test
+	2>/dev/null --verbose 'quoted text' && cd done 2>/dev/null x=1 "$@" "$@" local
+	x=1 | -eu "$1" $(pwd) -eu ${HOME} | | | && grep done 'quoted text'
+		echo then 'quoted text' readonly done x=1 then "$1" cd
+grep "$@" 'quoted text' grep 'quoted text' export sed && grep "$1"
+test /usr/bin "$1" local readonly then && test $(pwd) $(pwd)
+	done "$1" readonly $(pwd) then test awk local printf then echo export
+echo sed "$@" "$@" $(pwd) ${HOME} 'quoted text'
+		echo | grep /usr/bin awk cd grep /usr/bin
+	2>/dev/null sed awk "$@" done cd /usr/bin /usr/bin "$@"
+		done x=1 -eu ${HOME} cd echo printf readonly "$1" -eu "$1"
+	"$@" ${HOME} printf --verbose export awk printf local sed echo cd $(pwd) readonly
+		then "$1" test /usr/bin
+		grep 2>/dev/null awk /usr/bin grep $(pwd) ${HOME} -eu export
+		cd --verbose grep --verbose grep
+local $(pwd) done && done "$1" -eu printf ${HOME} export 2>/dev/null
+		2>/dev/null 'quoted text' then awk cd
+grep local local export | echo | echo
+then export && echo sed grep "$1" /usr/bin 2>/dev/null grep "$@" sed
+grep 'quoted text' readonly
+done "$@" ${HOME} then "$@" "$1" then done
+		--verbose -eu $(pwd) "$1" $(pwd) done /usr/bin local /usr/bin grep
+| 2>/dev/null then /usr/bin then "$1" 2>/dev/null
+/usr/bin /usr/bin "$1" export printf
+	$(pwd) cd /usr/bin echo cd ${HOME}
+	then | 2>/dev/null echo ${HOME} local cd export grep test
+	| x=1 local "$@" echo readonly awk
+| $(pwd) sed x=1 $(pwd) awk 2>/dev/null readonly "$@"
+echo readonly printf "$@" --verbose
+--verbose printf readonly grep local done
+export "$1" cd "$@" awk export printf "$1" export awk 'quoted text' | sed then
+	&& | 'quoted text' ${HOME} test then ${HOME} x=1 |
+		"$@" export export /usr/bin | | && "$@" grep then sed 'quoted text'
+		grep local "$1" "$1" && ${HOME} echo local $(pwd) then export cd done export
+2>/dev/null done | awk grep test test local local &&
+	--verbose done x=1 ${HOME} -eu && cd "$@" then -eu sed 2>/dev/null --verbose "$@"
+	local cd sed readonly -eu x=1 'quoted text' grep
+	$(pwd) $(pwd) test test local 2>/dev/null test ${HOME} readonly
+		awk done grep awk readonly "$1" 'quoted text'
+		awk | "$1" awk "$@" | printf sed "$1" "$1" echo test
+	test x=1 local --verbose sed -eu then x=1
+${HOME} export cd done "$@" | readonly --verbose export $(pwd) x=1
+export readonly && echo -eu sed 2>/dev/null
+		x=1 /usr/bin /usr/bin test 'quoted text'
+	"$@" "$@" ${HOME} /usr/bin && echo cd done ${HOME} awk cd "$@" export
+cd export sed awk | "$1" printf 2>/dev/null
+readonly readonly test grep cd test x=1
+sed /usr/bin local readonly
+	&& echo $(pwd) | /usr/bin
+	sed echo local awk $(pwd) grep -eu /usr/bin ${HOME} 2>/dev/null
+	printf export echo 2>/dev/null
+	local && | grep readonly -eu "$1" $(pwd)
+	x=1 --verbose readonly && local then "$1" echo && echo export local -eu x=1
+		2>/dev/null $(pwd) $(pwd) "$@" "$1" readonly "$@"
+		--verbose grep printf export /usr/bin grep $(pwd)
+-eu grep | $(pwd) grep test | cd ${HOME} x=1 echo --verbose then
+		${HOME} /usr/bin cd ${HOME} test x=1
+	cd 'quoted text' grep local export --verbose done awk -eu
+		done local x=1 done test printf $(pwd) sed
+		cd printf grep printf done export sed "$1" test awk awk printf
+	export readonly "$1" 2>/dev/null 'quoted text'
+		-eu sed 'quoted text' export "$1" -eu $(pwd) awk /usr/bin then "$1" $(pwd) ${HOME}
+		${HOME} x=1 2>/dev/null printf 'quoted text' ${HOME} echo "$@" export
+		grep --verbose local local "$@" printf
+	$(pwd) grep | ${HOME} -eu | -eu grep done done 'quoted text' x=1
+		2>/dev/null x=1 --verbose -eu
+	'quoted text' "$@" cd 2>/dev/null
+	then grep printf grep grep echo &&
+cd sed printf cd grep then /usr/bin awk ${HOME} sed readonly cd grep echo then
+		printf --verbose local local echo x=1 --verbose then done "$@" 'quoted text'
+		echo | | awk export sed -eu
+	'quoted text' sed done "$1" local $(pwd) --verbose 2>/dev/null $(pwd) printf x=1
+		"$@" && echo grep "$@" --verbose test done then --verbose x=1
+sed cd "$1" sed 'quoted text' local
+	"$@" -eu "$1" /usr/bin | /usr/bin | && $(pwd) x=1 && sed readonly 'quoted text'
+		then --verbose done --verbose test awk --verbose /usr/bin "$1" "$1" 2>/dev/null
+awk --verbose local /usr/bin -eu local cd cd readonly x=1 printf --verbose
+		--verbose readonly sed -eu $(pwd) printf
+		${HOME} printf 2>/dev/null then && readonly
+	local --verbose test export && done | --verbose 2>/dev/null --verbose
+		"$1" $(pwd) -eu then -eu
+$(pwd) --verbose export cd awk "$@"
+then done && ${HOME} grep
+awk sed $(pwd) -eu cd then done --verbose test cd
+	cd 2>/dev/null "$@" echo 2>/dev/null
+	then export test -eu x=1 --verbose export local then x=1 /usr/bin --verbose
+	${HOME} "$1" x=1 "$1" cd local local
+-eu grep sed cd readonly cd echo awk x=1 2>/dev/null printf
+		local sed then x=1 -eu export readonly && $(pwd) x=1 awk 'quoted text' sed x=1
+		-eu then echo "$1" printf -eu sed $(pwd)
+	"$@" readonly then export done -eu x=1
+"$@" cd "$1" local | && "$@" | "$1" --verbose grep
+/usr/bin done local grep "$1" 2>/dev/null
+		$(pwd) /usr/bin 2>/dev/null grep /usr/bin grep /usr/bin export -eu "$@" cd grep
+local x=1 echo "$@" "$1" test ${HOME} 2>/dev/null done echo --verbose /usr/bin
+	sed | && grep -eu && x=1 printf /usr/bin
+2>/dev/null export grep /usr/bin /usr/bin x=1
+	sed cd export local awk printf /usr/bin
+		&& awk /usr/bin export sed 2>/dev/null && 'quoted text' readonly
+awk printf x=1 grep ${HOME} -eu "$@" then grep --verbose && sed $(pwd) "$@" readonly
+		export local export sed
+		local done export -eu 'quoted text' "$1" -eu ${HOME} readonly
+	/usr/bin test grep then $(pwd) printf 'quoted text' 'quoted text'
+		cd ${HOME} export grep done $(pwd) then "$1" -eu sed ${HOME}
+		local awk awk cd --verbose --verbose
+		"$1" 'quoted text' test 2>/dev/null
+	local && then -eu echo --verbose /usr/bin && | sed
+local 'quoted text' /usr/bin then then then echo cd $(pwd) 'quoted text' && local
+	2>/dev/null echo cd --verbose done local readonly 2>/dev/null
+"$@" readonly echo /usr/bin
+printf printf 2>/dev/null $(pwd) && && -eu -eu /usr/bin -eu 'quoted text'
+		test test done awk x=1 $(pwd) cd printf /usr/bin then test
+		cd sed 2>/dev/null test echo "$@" --verbose
+"$@" test "$1" printf 2>/dev/null "$1" then echo local "$@" export
+		local /usr/bin 'quoted text' /usr/bin 'quoted text' readonly
+sed | x=1 --verbose && /usr/bin printf readonly test awk "$@"
+"$1" --verbose "$1" --verbose done readonly local 2>/dev/null local
+		/usr/bin --verbose done grep && grep /usr/bin ${HOME}
+done ${HOME} 'quoted text'
+x=1 export | /usr/bin ${HOME} printf local x=1 sed awk echo "$1" -eu
+"$1" ${HOME} "$1" $(pwd) readonly | && $(pwd) echo x=1 $(pwd) local cd x=1
+		${HOME} $(pwd) local /usr/bin readonly $(pwd) awk echo sed
+&& 'quoted text' sed | $(pwd) "$@" export grep 'quoted text'
+		test printf $(pwd) sed cd --verbose test done local local test sed 'quoted text'
+	| done local readonly x=1 | readonly ${HOME} 'quoted text'
+done echo test cd export printf readonly -eu x=1 cd
+		"$@" cd && | local printf 'quoted text' /usr/bin 'quoted text' -eu local
+${HOME} echo "$1" sed $(pwd) --verbose cd x=1 cd printf local 2>/dev/null
+done awk printf ${HOME} /usr/bin
+		done test -eu $(pwd) 'quoted text'
+		"$1" cd sed sed readonly test test sed printf $(pwd) | test --verbose 'quoted text'
+		then 2>/dev/null grep "$1" done 'quoted text' test 'quoted text' sed
+		readonly then "$@" /usr/bin
+		readonly /usr/bin readonly 'quoted text' readonly readonly
+		| 2>/dev/null cd export --verbose readonly && grep local "$@" | test --verbose
+		export readonly --verbose printf grep test "$1" test -eu export "$1"
+	'quoted text' grep cd x=1 export "$@" readonly done test then x=1
+		$(pwd) /usr/bin done $(pwd) test readonly |
+		| sed x=1 'quoted text' cd echo x=1 x=1 -eu ${HOME}
+	"$1" | 'quoted text' sed
+test readonly $(pwd) cd export cd local /usr/bin -eu -eu "$1" 2>/dev/null then 'quoted text'
+/usr/bin "$1" 'quoted text' 'quoted text'
+&& test then local readonly
+| --verbose | 2>/dev/null export ${HOME} test
+		export done 2>/dev/null local $(pwd)
+sed done local then | $(pwd) ${HOME}
+		readonly test sed then ${HOME} printf "$1" 2>/dev/null sed ${HOME} 'quoted text'
+	readonly readonly $(pwd) --verbose "$@" "$@" cd awk grep && "$1" readonly
+	grep x=1 --verbose /usr/bin readonly done /usr/bin cd readonly
+		sed export grep echo 2>/dev/null cd local
+		"$1" 'quoted text' --verbose done --verbose && sed then awk sed
+sed 'quoted text' printf 2>/dev/null grep $(pwd) 2>/dev/null | sed 2>/dev/null
+		echo ${HOME} && ${HOME} ${HOME} sed awk cd cd local echo readonly ${HOME}
+	"$@" 2>/dev/null test --verbose
+	-eu "$@" awk x=1 cd x=1 sed --verbose sed export then /usr/bin --verbose
+	then 'quoted text' echo done sed /usr/bin --verbose
+		readonly --verbose export "$@" "$@"
+		2>/dev/null printf cd printf ${HOME} grep -eu && x=1 x=1 'quoted text'
+		'quoted text' "$@" local local readonly cd x=1 test cd
+		export local "$1" "$@" then --verbose | sed
+--verbose $(pwd) "$@" readonly 2>/dev/null x=1 'quoted text' ${HOME}
+	cd readonly && "$@" --verbose --verbose x=1 && 'quoted text' 'quoted text' readonly
+--verbose then sed printf
+	printf done test "$@" cd grep --verbose 2>/dev/null
+	export then export done /usr/bin
+	x=1 | cd echo "$@" awk local readonly "$1" --verbose
+		printf grep done done -eu export local
+export cd awk --verbose grep -eu cd && -eu cd "$1" "$1" echo
+	--verbose ${HOME} awk 'quoted text'
+		$(pwd) grep cd echo --verbose
+| "$@" $(pwd) "$1" test local ${HOME} /usr/bin x=1 $(pwd) &&
+	| local $(pwd) --verbose "$@" 'quoted text'
+		${HOME} --verbose printf -eu | awk test
+		/usr/bin "$1" grep ${HOME}
+	"$@" -eu 'quoted text' && | done readonly "$1" cd "$@" 2>/dev/null
+		awk 'quoted text' 'quoted text' $(pwd) $(pwd) local 2>/dev/null cd 'quoted text'
+	local $(pwd) && test printf then /usr/bin echo
+cd -eu $(pwd) printf done readonly 'quoted text' grep echo sed then cd awk
+		then then x=1 readonly local sed sed awk awk --verbose awk 2>/dev/null
+	export && test printf readonly awk x=1 done x=1 "$@" && ${HOME} awk /usr/bin
+	'quoted text' then $(pwd) | local sed printf -eu "$1" cd local -eu "$@" && readonly
+2>/dev/null && /usr/bin x=1 done done --verbose test done
+	/usr/bin done 2>/dev/null "$1"
+		$(pwd) cd | --verbose local | "$1" /usr/bin && export readonly grep $(pwd) export
+${HOME} -eu "$1" echo /usr/bin --verbose printf ${HOME} 2>/dev/null test grep sed
+		printf sed | printf export | | cd "$1" readonly echo 'quoted text' |
+-eu export printf test then 'quoted text' | readonly
+		x=1 printf 'quoted text' cd readonly export /usr/bin printf done
+	local awk "$@" "$1" ${HOME} /usr/bin test && && done -eu /usr/bin
+		'quoted text' && echo local grep local test "$1"
+cd -eu $(pwd) $(pwd) --verbose && 2>/dev/null $(pwd)
+test printf ${HOME} /usr/bin
+		export export $(pwd) test
+2>/dev/null | printf 2>/dev/null ${HOME} |
+		&& && test test grep readonly local "$@" test x=1 "$1"
+		-eu | | 2>/dev/null x=1 local then readonly echo
+grep -eu printf "$1" ${HOME} &&
+		"$@" then --verbose awk && done x=1
+echo | printf echo then local | "$@" $(pwd) grep /usr/bin grep test "$1" $(pwd)
+	$(pwd) grep test export 'quoted text'
+	"$@" export "$@" $(pwd) ${HOME}
+	"$@" 'quoted text' --verbose awk local | ${HOME}
+		'quoted text' export && -eu --verbose
+		sed "$1" | printf done grep test | sed 'quoted text' "$@" done grep done
+		${HOME} /usr/bin test "$@" && local test then ${HOME} printf readonly ${HOME}
+'quoted text' -eu 'quoted text' /usr/bin
+done local cd | 2>/dev/null export
+		2>/dev/null /usr/bin $(pwd) && grep then sed 2>/dev/null test /usr/bin local
+local then -eu && grep printf /usr/bin
+		local printf "$1" && then sed
+		readonly | test $(pwd) grep && echo ${HOME} readonly x=1 2>/dev/null
+	done 'quoted text' local "$@"
+	2>/dev/null "$@" $(pwd) "$1" "$@"
+	readonly local "$1" "$@" echo done echo
+	printf /usr/bin awk echo awk && sed awk grep $(pwd) x=1 'quoted text' $(pwd)
+awk /usr/bin local printf "$1" && && awk awk awk
+echo export local echo echo grep --verbose
+		2>/dev/null printf "$@" test sed "$1"
+	done 2>/dev/null awk test --verbose
+		awk x=1 "$@" export then $(pwd)
+	readonly cd export $(pwd) | "$@"
+	export "$1" | 'quoted text' local
+2>/dev/null "$1" test readonly 2>/dev/null
+		"$@" "$1" done $(pwd) local test echo
+x=1 'quoted text' local test
+		$(pwd) readonly -eu && x=1 printf && 2>/dev/null
+	2>/dev/null "$1" then $(pwd) local echo readonly
+"$1" cd sed sed local grep local export then echo local 2>/dev/null
+	| grep done readonly test done grep cd sed
+'quoted text' ${HOME} "$@" 2>/dev/null
+		readonly ${HOME} test -eu -eu awk then
+		local awk test cd "$@" readonly done ${HOME}
+	then | && readonly test export | /usr/bin /usr/bin awk && && $(pwd) ${HOME}
+		done "$@" --verbose --verbose
+		2>/dev/null readonly export grep cd grep ${HOME} echo $(pwd)
+/usr/bin cd cd 2>/dev/null
+	grep export | cd $(pwd) "$@" printf "$@" readonly
+	then $(pwd) -eu then "$@" then "$@" done x=1 -eu 2>/dev/null then "$@"
+	--verbose sed printf export /usr/bin --verbose local -eu printf && sed 2>/dev/null
+$(pwd) --verbose local "$1" then "$@" "$1" --verbose readonly
+printf done awk --verbose sed | 2>/dev/null
+		grep | | cd sed export ${HOME}
+	sed && /usr/bin | grep then --verbose
+	local test 2>/dev/null 'quoted text' export 'quoted text'
+	export test "$@" "$@" "$@" export sed
+		"$@" grep "$@" --verbose local 'quoted text'
+&& && --verbose readonly x=1 awk 'quoted text' -eu "$@" 2>/dev/null then
+	$(pwd) 'quoted text' echo readonly -eu && /usr/bin
+	$(pwd) 'quoted text' then && echo "$@" done 'quoted text' done then x=1 awk
+	echo printf local /usr/bin 'quoted text'
+		'quoted text' awk readonly && x=1 | --verbose
+grep -eu "$1" | printf local
+'quoted text' cd && done -eu test cd -eu printf --verbose done -eu cd grep 'quoted text'
+		export printf && echo ${HOME} -eu -eu 2>/dev/null printf --verbose
+	readonly export 'quoted text'
+-eu test done sed local $(pwd) "$@" sed --verbose 'quoted text' done "$@" printf
+		readonly $(pwd) sed export export && 2>/dev/null local -eu x=1 test x=1 awk
+		x=1 local done test test done cd grep 'quoted text' sed awk 2>/dev/null && export
+awk --verbose cd -eu 'quoted text' "$@" ${HOME}
+done printf -eu export ${HOME} && /usr/bin grep
+	&& export cd printf then $(pwd) "$1" cd $(pwd) readonly awk readonly $(pwd)
+		'quoted text' && export echo local local done grep local -eu 'quoted text' awk
+${HOME} then --verbose "$1" awk x=1 grep "$1" cd export |
+		$(pwd) then --verbose 'quoted text'
+2>/dev/null grep awk
+		&& cd sed --verbose sed printf "$@" sed /usr/bin echo | $(pwd) test
+		$(pwd) export printf x=1 done && 'quoted text' then done | done
+	cd export -eu "$1" export
+sed grep 'quoted text' -eu /usr/bin && /usr/bin --verbose $(pwd) readonly --verbose
+	'quoted text' printf --verbose ${HOME}
+	awk -eu local /usr/bin export x=1
+test | sed -eu echo | test $(pwd)
+	2>/dev/null export | export grep --verbose
+	$(pwd) done ${HOME} $(pwd) "$1" -eu && printf sed -eu 'quoted text'
+		&& -eu ${HOME} then then --verbose -eu readonly 2>/dev/null printf
+	awk local local 2>/dev/null done
+		2>/dev/null "$@" -eu | then "$1" sed printf | done
+	then 'quoted text' --verbose --verbose $(pwd) $(pwd) test
+		sed cd readonly 2>/dev/null
+cd 'quoted text' echo sed --verbose test x=1 readonly $(pwd)
+readonly $(pwd) x=1 ${HOME} 'quoted text' sed local grep export
+"$1" 2>/dev/null 2>/dev/null
+	then 2>/dev/null x=1 x=1 printf awk $(pwd)
+		readonly -eu /usr/bin x=1 readonly -eu |
+awk done 2>/dev/null echo test then then --verbose
+		"$1" /usr/bin printf
+grep $(pwd) echo readonly "$@" printf sed printf printf local
+		readonly 2>/dev/null local echo export 2>/dev/null
+		then export echo 2>/dev/null 2>/dev/null done 2>/dev/null
+	printf 'quoted text' $(pwd) awk "$1" cd echo
+	grep done sed /usr/bin printf && "$@" $(pwd) then done echo
+	awk then ${HOME} /usr/bin ${HOME}
+export sed "$1" x=1 | /usr/bin
+export | ${HOME} x=1 sed "$1" echo echo 'quoted text' echo test printf
+local | 'quoted text' awk done 2>/dev/null
+	/usr/bin sed then 'quoted text' |
+	| grep "$1" local $(pwd) 2>/dev/null
+'quoted text' -eu $(pwd) then $(pwd) "$@" grep then cd test awk /usr/bin 'quoted text'
+&& test readonly done | ${HOME} test
+echo export awk sed "$1"
+		readonly export && test test -eu then printf sed --verbose 'quoted text'
+		'quoted text' "$1" echo grep test ${HOME} 2>/dev/null
+		${HOME} --verbose ${HOME} test $(pwd) ${HOME} local awk $(pwd) /usr/bin
+	sed local grep echo echo "$1" test done /usr/bin sed grep grep $(pwd)
+		local local then then | 'quoted text' --verbose
+2>/dev/null 2>/dev/null --verbose "$@" awk echo echo printf awk -eu done /usr/bin
+	&& readonly --verbose grep echo
+		'quoted text' done printf sed "$1" ${HOME} && ${HOME} awk 2>/dev/null
+-eu 'quoted text' "$@" export printf
+		2>/dev/null ${HOME} $(pwd) 2>/dev/null awk done readonly && /usr/bin
+		awk 2>/dev/null local sed -eu grep local cd echo then
+export cd printf "$1" test then export
+		export echo && 'quoted text' && then | | done printf then ${HOME}
+		-eu 2>/dev/null sed echo && x=1 export
+	$(pwd) awk readonly --verbose | 'quoted text'
+		"$@" local echo printf then -eu cd printf
+readonly echo --verbose export local /usr/bin local
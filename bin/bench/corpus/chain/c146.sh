@@ -0,0 +1,2001 @@
+"$1" --verbose test local $(pwd) local $(pwd) && "$1"
+		'quoted text' -eu test printf awk sed
+		test 'quoted text' "$@" test echo sed cd "$1" && sed | printf readonly
+		awk /usr/bin printf -eu printf printf local sed 'quoted text'
+	then cd ${HOME} readonly export awk $(pwd) -eu /usr/bin printf
+| $(pwd) sed $(pwd) $(pwd) test done "$@"
+	&& done test export --verbose awk 'quoted text'
+		/usr/bin then export ${HOME} /usr/bin 'quoted text' done --verbose
+	readonly ${HOME} local test ${HOME} $(pwd) done cd /usr/bin /usr/bin
+		--verbose 2>/dev/null grep "$1" ${HOME} -eu echo readonly 'quoted text'
+		grep /usr/bin 'quoted text'
+		2>/dev/null test grep local
+	"$1" | local x=1 /usr/bin sed grep -eu && test -eu
+	'quoted text' local readonly -eu
+| readonly cd then cd $(pwd) grep x=1 cd && sed --verbose sed
+	/usr/bin /usr/bin then echo x=1 $(pwd) x=1
+	sed -eu awk | then then
+		&& export test 2>/dev/null
+		${HOME} 'quoted text' readonly x=1 then done local | 'quoted text' | awk x=1
+		local grep x=1 awk /usr/bin
+		${HOME} then sed local export "$1" 'quoted text' 'quoted text' -eu
+	/usr/bin printf "$1" 2>/dev/null -eu sed export
+		x=1 -eu 2>/dev/null --verbose x=1 readonly /usr/bin
+	${HOME} 'quoted text' -eu awk test "$@" readonly readonly
+	&& /usr/bin $(pwd) "$@" "$@" test "$1" then x=1 2>/dev/null -eu printf done --verbose
+	export sed echo sed echo
+		local printf -eu sed sed ${HOME} printf printf
+readonly | readonly 'quoted text' cd --verbose /usr/bin
+		echo x=1 printf echo /usr/bin cd ${HOME} /usr/bin
+local /usr/bin cd "$@" "$1" export grep done cd awk | 'quoted text'
+$(pwd) x=1 local awk && "$@" -eu && ${HOME} grep "$@" awk 'quoted text'
+		${HOME} grep 'quoted text'
+	${HOME} printf done /usr/bin -eu sed --verbose 'quoted text'
+	then echo echo $(pwd) printf 2>/dev/null sed done done done $(pwd)
+		test test echo 2>/dev/null -eu 2>/dev/null 'quoted text'
+	x=1 "$1" | /usr/bin "$@" /usr/bin | grep grep | readonly | grep ${HOME} x=1 printf
+cd done $(pwd) --verbose
+	$(pwd) done test done x=1 ${HOME} done done grep 'quoted text'
+		"$1" awk grep $(pwd) 'quoted text' /usr/bin "$@" readonly 'quoted text'
+	test /usr/bin "$@" 'quoted text' "$@" local $(pwd) /usr/bin
+x=1 -eu ${HOME} /usr/bin then readonly export -eu done awk awk
+export cd -eu 2>/dev/null /usr/bin
+		readonly test done echo printf cd x=1 2>/dev/null test
+		--verbose done local cd | "$@" echo && && done echo /usr/bin readonly x=1 && |
+		| test grep | done --verbose local
+	grep | "$1" export ${HOME} --verbose /usr/bin echo --verbose
+		2>/dev/null "$1" export awk cd | done done awk "$1" 2>/dev/null
+	export "$1" /usr/bin "$1" "$1" && ${HOME} local | $(pwd) && echo | echo cd awk
+		| | export $(pwd) $(pwd) readonly awk echo $(pwd) /usr/bin -eu readonly
+| done then && /usr/bin local cd sed | export
+	&& x=1 sed 'quoted text' export done /usr/bin readonly echo
+		grep $(pwd) ${HOME} test | export x=1
+awk 'quoted text' /usr/bin | test --verbose -eu awk printf grep 2>/dev/null 'quoted text'
+		sed sed done grep printf done "$1" echo "$@"
+		export ${HOME} x=1 printf "$1" sed then printf awk "$@" ${HOME} --verbose
+		$(pwd) export 'quoted text' /usr/bin x=1 done $(pwd)
+readonly ${HOME} cd local awk $(pwd)
+		| ${HOME} done cd | test "$1"
+		-eu /usr/bin x=1 echo --verbose
+		${HOME} printf ${HOME} $(pwd) done 2>/dev/null
+	printf awk sed 'quoted text' 2>/dev/null local x=1 sed "$@" cd then --verbose grep
+	| --verbose "$@" then $(pwd) /usr/bin readonly
+		$(pwd) "$1" done cd readonly cd ${HOME} grep grep echo
+	cd local "$1" sed --verbose
+		&& local readonly test export
+		| readonly /usr/bin export grep test printf
+	cd 'quoted text' && test cd sed readonly printf -eu "$1" --verbose 'quoted text'
+readonly grep -eu -eu 2>/dev/null
+"$1" "$@" | export grep --verbose
+		-eu grep readonly --verbose ${HOME}
+		2>/dev/null "$1" sed export local printf cd grep sed /usr/bin
+&& readonly /usr/bin grep
+	then then readonly 2>/dev/null then 'quoted text'
+	done && "$1" export | cd echo grep printf /usr/bin export
+/usr/bin && x=1 /usr/bin
+	${HOME} cd x=1 then local ${HOME} --verbose printf echo
+	echo /usr/bin cd "$1" x=1 grep cd 2>/dev/null "$1" /usr/bin printf
+	awk grep 'quoted text' sed $(pwd) 2>/dev/null then $(pwd) 'quoted text' $(pwd)
+printf "$1" echo export -eu echo "$@" ${HOME} test
+--verbose $(pwd) export /usr/bin
+		x=1 test "$1" cd ${HOME} 2>/dev/null "$@" 2>/dev/null
+	printf cd grep echo then cd test $(pwd)
+2>/dev/null -eu && readonly "$@" "$@" $(pwd) sed | $(pwd)
+		printf "$@" local "$1" then | grep
+	| sed awk readonly export "$@"
+	2>/dev/null done cd x=1 "$1" sed 2>/dev/null
+	readonly sed /usr/bin then $(pwd) done
+	sed export "$@" "$@" | local cd -eu echo sed cd then local printf
+		then "$@" echo local "$1" echo | local --verbose then
+"$@" ${HOME} readonly --verbose grep "$@" "$1" sed ${HOME} ${HOME} && awk
+	/usr/bin && awk grep readonly test /usr/bin && grep && readonly "$@" -eu -eu readonly
+		-eu --verbose then done then 2>/dev/null && 2>/dev/null grep cd
+	| done export x=1 | /usr/bin readonly printf $(pwd)
+		"$1" $(pwd) done printf ${HOME} x=1 then printf x=1 $(pwd) awk readonly
+	"$1" local cd printf local -eu export local x=1 done done echo
+		local then export ${HOME}
+cd $(pwd) printf awk $(pwd)
+	'quoted text' local x=1 readonly ${HOME} printf "$@" sed cd &&
+--verbose readonly export "$1" /usr/bin
+	then echo 2>/dev/null local $(pwd) awk then /usr/bin done -eu export export
+x=1 readonly sed printf "$@"
+		grep -eu | then echo "$@" && $(pwd) --verbose
+echo | $(pwd) export done | ${HOME} cd export readonly done "$@" "$@"
+		done $(pwd) export --verbose ${HOME} printf
+${HOME} readonly awk "$1"
+		readonly echo $(pwd) readonly /usr/bin export
+	cd 2>/dev/null test printf done --verbose --verbose $(pwd) grep
+	"$1" done export 2>/dev/null done awk test | | test awk test awk x=1 "$1" "$1"
+		grep grep -eu "$@" 'quoted text' awk
+	'quoted text' /usr/bin then export
+	2>/dev/null done sed x=1 "$@"
+echo ${HOME} local sed "$@" 'quoted text'
+		$(pwd) test test grep "$@" sed -eu "$@" grep |
+	x=1 cd 2>/dev/null test export sed test echo then sed
+/usr/bin export local /usr/bin test then "$@"
+		${HOME} readonly | readonly "$@" done /usr/bin ${HOME} cd ${HOME}
+	2>/dev/null /usr/bin $(pwd) printf done -eu cd "$1" sed x=1 export
+"$1" local && cd $(pwd) done echo test -eu
+		grep grep sed done sed $(pwd) "$1" /usr/bin $(pwd) "$@" && readonly
+	&& ${HOME} local done -eu "$@"
+grep /usr/bin test 'quoted text'
+		"$@" 2>/dev/null "$@" && printf 'quoted text'
+	| local ${HOME} -eu | awk readonly sed cd x=1
+	echo then $(pwd) cd -eu x=1 done export &&
+awk ${HOME} "$1" export sed done test readonly
+		$(pwd) ${HOME} readonly -eu 2>/dev/null
+		test printf "$@" done done grep
+local sed "$@" "$1" -eu "$1" | 2>/dev/null sed $(pwd) 2>/dev/null
+	test ${HOME} ${HOME} x=1 sed test $(pwd)
+then -eu $(pwd) sed then --verbose
+sed grep $(pwd) --verbose then readonly | echo then
+	"$@" /usr/bin grep x=1 "$1" $(pwd) printf $(pwd) $(pwd) $(pwd) 2>/dev/null
+| grep ${HOME} done local "$1" cd --verbose $(pwd) awk export cd x=1
+	x=1 readonly /usr/bin sed readonly sed cd && export export echo printf
+x=1 readonly then readonly x=1 --verbose x=1 2>/dev/null echo local
+printf -eu test grep cd echo "$1"
+		sed readonly 'quoted text' cd grep
+-eu test "$1" --verbose -eu /usr/bin export -eu -eu 2>/dev/null "$1" 'quoted text'
+		${HOME} local "$1" /usr/bin /usr/bin local local --verbose
+	echo 2>/dev/null then $(pwd) &&
+	cd --verbose | "$1" echo sed test done awk /usr/bin local export done readonly
+		'quoted text' grep test sed then 2>/dev/null
+	readonly "$@" sed sed printf --verbose sed -eu /usr/bin
+	done $(pwd) sed test done sed readonly && -eu
+		printf local then -eu && x=1 awk done && && "$1" awk
+	"$1" sed "$1" grep "$1" grep 2>/dev/null
+printf cd /usr/bin local $(pwd) sed ${HOME}
+-eu | "$1" 'quoted text' "$1" echo
+	sed local /usr/bin then cd && -eu --verbose readonly 'quoted text'
+		&& cd "$@" awk -eu 2>/dev/null
+	x=1 x=1 | awk grep && /usr/bin ${HOME} /usr/bin echo "$1" "$@"
+	then local ${HOME} done test printf readonly $(pwd)
+cd --verbose sed export
+		-eu echo x=1 test grep sed /usr/bin printf done then &&
+	cd then then printf "$@" done "$@" export grep "$@" export "$1" printf
+	| | readonly $(pwd) ${HOME} readonly then ${HOME} sed "$@" x=1 /usr/bin
+		-eu echo 2>/dev/null -eu printf done
+		echo x=1 awk printf "$@"
+local cd 'quoted text' 2>/dev/null --verbose |
+	--verbose ${HOME} local sed sed test "$1" 2>/dev/null
+		| echo test grep -eu $(pwd) 2>/dev/null test x=1 "$1" 2>/dev/null | then 2>/dev/null
+	cd "$1" local --verbose $(pwd) grep test awk test /usr/bin -eu then "$@" awk then
+		-eu --verbose echo sed grep
+		echo $(pwd) 'quoted text' printf done 'quoted text'
+	&& x=1 grep x=1 then ${HOME} printf
+		done awk echo sed && ${HOME} ${HOME} "$1" echo 'quoted text'
+printf readonly echo "$@" | && 2>/dev/null readonly
+test cd readonly x=1 | $(pwd) test x=1 2>/dev/null sed
+		/usr/bin export awk done 'quoted text' sed "$1" ${HOME}
+		-eu x=1 test readonly export done x=1 cd ${HOME} readonly | "$1" x=1
+sed done local 2>/dev/null 2>/dev/null 2>/dev/null
+awk /usr/bin local 2>/dev/null ${HOME} cd | local
+	'quoted text' grep export x=1 export "$@" awk 2>/dev/null /usr/bin
+		sed $(pwd) -eu then 'quoted text' local
+--verbose --verbose "$1" cd
+	done then $(pwd) local x=1 && "$1" && grep --verbose grep awk /usr/bin cd "$@"
+		sed printf export | printf x=1 sed --verbose test sed
+x=1 ${HOME} --verbose && export x=1 then readonly | readonly
+		grep done ${HOME} cd $(pwd) then grep 'quoted text' -eu 2>/dev/null
+cd "$@" --verbose awk local 2>/dev/null test && echo local test -eu
+	export /usr/bin export 2>/dev/null sed test && local 'quoted text' done
+	"$1" done readonly 'quoted text'
+		local grep then 'quoted text' 'quoted text' "$@" ${HOME} "$1" $(pwd) $(pwd)
+		/usr/bin sed | -eu -eu x=1 test grep -eu "$1" done awk export test export test
+awk 2>/dev/null echo awk && done local
+		readonly grep local --verbose && $(pwd) readonly echo 'quoted text' 2>/dev/null
+		sed "$@" 2>/dev/null export readonly cd awk ${HOME} test
+awk -eu awk grep 2>/dev/null --verbose "$@" export x=1 then then && test cd test
+&& 'quoted text' ${HOME} && test | grep /usr/bin
+2>/dev/null grep 'quoted text' local readonly /usr/bin grep && 2>/dev/null
+		test readonly --verbose ${HOME} "$@" then "$@" sed | /usr/bin local
+x=1 x=1 'quoted text' test | local test | test printf readonly awk --verbose
+local "$1" "$@" "$@" ${HOME} $(pwd) then export -eu export
+	echo 2>/dev/null --verbose "$1" 'quoted text' awk --verbose
+		test $(pwd) "$@" local export x=1 "$@" | test
+x=1 printf "$@" cd -eu --verbose then ${HOME} done "$1" done
+		echo then && "$@" sed readonly test export $(pwd) local "$@" sed --verbose
+&& local 2>/dev/null "$@" -eu done readonly "$1" "$1" awk | $(pwd) readonly $(pwd)
+sed 2>/dev/null "$1" printf then grep
+x=1 --verbose /usr/bin readonly local echo
+	local ${HOME} test "$@" x=1 export "$@" -eu
+	sed cd -eu cd cd grep readonly
+"$@" -eu then ${HOME} export -eu
+		"$@" awk cd "$1" "$@" printf /usr/bin printf readonly cd
+$(pwd) 'quoted text' $(pwd) /usr/bin done "$@"
+"$1" --verbose | /usr/bin 2>/dev/null "$1" 'quoted text' /usr/bin
+		"$1" $(pwd) done grep "$@" $(pwd)
+		| then done sed then local awk local $(pwd) readonly done readonly
+		${HOME} then /usr/bin test --verbose readonly /usr/bin
+		"$1" --verbose grep "$1"
+		| echo "$1" done awk echo | /usr/bin
+		local test sed awk echo -eu local
+"$@" --verbose local 'quoted text'
+	sed "$1" sed x=1 x=1 sed /usr/bin
+		${HOME} cd echo test /usr/bin grep -eu test -eu cd printf export
+		${HOME} awk x=1 -eu | 'quoted text' /usr/bin printf "$1" "$1" /usr/bin printf
+		2>/dev/null | 'quoted text'
+		${HOME} 2>/dev/null 'quoted text'
+awk "$1" cd | "$@" cd local 2>/dev/null "$@" "$1" 'quoted text'
+	echo ${HOME} --verbose
+		export grep -eu | && ${HOME} -eu export printf sed then readonly readonly
+	&& /usr/bin "$@" 'quoted text' x=1 readonly
+	test | -eu ${HOME} --verbose done cd $(pwd) 'quoted text' grep echo
+		echo "$@" 'quoted text' test | "$1" printf echo awk echo then "$@"
+	printf awk cd local && readonly
+		grep sed && | x=1 && echo ${HOME} printf then cd x=1 sed echo $(pwd) /usr/bin
+	awk ${HOME} && --verbose then export awk 2>/dev/null
+		/usr/bin $(pwd) sed cd --verbose "$@" awk ${HOME} echo x=1 local cd /usr/bin
+grep then --verbose "$1"
+		local "$@" "$1" ${HOME} export "$@" export 2>/dev/null
+		awk | local "$1" test cd "$1" $(pwd) echo cd 'quoted text'
+	"$1" ${HOME} -eu echo sed ${HOME} done echo then 2>/dev/null "$@"
+		-eu $(pwd) x=1 sed sed | sed then local -eu
+		awk x=1 ${HOME} 2>/dev/null local 2>/dev/null | export
+x=1 /usr/bin 'quoted text' echo
+		test /usr/bin "$@" && /usr/bin awk done test awk x=1 && 2>/dev/null grep $(pwd)
+	cd /usr/bin /usr/bin 'quoted text' && "$1" done x=1 cd local printf cd $(pwd)
+		"$1" $(pwd) done x=1 2>/dev/null x=1 ${HOME} x=1 "$1" export test test
+awk export -eu export printf -eu $(pwd) awk "$1" 'quoted text' test 'quoted text'
+		${HOME} cd cd -eu readonly /usr/bin $(pwd) 'quoted text' readonly
+	sed --verbose x=1 -eu --verbose x=1 $(pwd) $(pwd)
+sed /usr/bin printf $(pwd) cd
+test /usr/bin cd "$@" /usr/bin "$@" -eu printf $(pwd) then awk --verbose ${HOME}
+		"$1" done $(pwd) sed x=1 2>/dev/null export 2>/dev/null awk && 'quoted text'
+	--verbose | 2>/dev/null --verbose && "$@" /usr/bin cd && && echo
+		2>/dev/null grep done x=1 awk x=1 ${HOME} grep "$1" echo echo
+		echo done 'quoted text' test
+		cd | printf printf ${HOME} local printf
+local /usr/bin awk -eu 'quoted text'
+		sed --verbose cd printf -eu
+		&& sed ${HOME} x=1 echo ${HOME} export export
+| echo 2>/dev/null grep sed -eu "$1" export grep 2>/dev/null ${HOME} done
+		readonly then printf /usr/bin 2>/dev/null x=1
+	'quoted text' --verbose done local test
+awk awk x=1 done x=1 grep local printf "$1" readonly echo
+		--verbose --verbose printf grep test test export "$1" readonly then
+	--verbose cd grep --verbose -eu && local /usr/bin
+		"$@" ${HOME} sed $(pwd) echo "$1" 2>/dev/null awk sed -eu --verbose
+	x=1 "$1" ${HOME} | --verbose 2>/dev/null sed 2>/dev/null sed "$1" --verbose
+&& ${HOME} ${HOME} sed sed "$@" x=1 | ${HOME} && test local awk readonly
+	-eu local | | printf ${HOME} export sed $(pwd)
+		local test x=1 sed export "$@" test done awk x=1 test readonly /usr/bin export -eu
+		echo | $(pwd) | | 2>/dev/null echo then "$@" x=1 && sed
+local readonly readonly readonly | local
+--verbose grep then /usr/bin 2>/dev/null
+	--verbose "$1" printf grep --verbose 'quoted text'
+		echo awk done echo $(pwd) cd /usr/bin
+&& "$@" then export printf ${HOME} 'quoted text' printf x=1 "$@" --verbose
+--verbose ${HOME} cd "$@" awk grep $(pwd) printf readonly readonly
+	--verbose $(pwd) $(pwd) 'quoted text' awk
+		${HOME} readonly 2>/dev/null
+		"$1" done | awk then /usr/bin readonly ${HOME} echo
+$(pwd) 'quoted text' x=1 | "$@"
+	cd printf local $(pwd) printf echo && test "$1" ${HOME} "$1" 'quoted text'
+${HOME} test test awk /usr/bin /usr/bin echo cd
+	/usr/bin test && ${HOME}
+		sed $(pwd) && x=1 'quoted text' grep "$1" awk 'quoted text'
+		&& export "$1" local readonly awk $(pwd) ${HOME} -eu cd awk --verbose 'quoted text'
+	$(pwd) && "$@" echo 'quoted text' "$1" done "$1" test /usr/bin local grep done
+--verbose /usr/bin 2>/dev/null
+		local "$@" grep export printf printf echo done 2>/dev/null
+readonly test test && "$1" x=1 printf then
+| grep && readonly -eu "$1" | | x=1 -eu &&
+done done ${HOME} echo $(pwd) $(pwd)
+	${HOME} | ${HOME} done grep "$1" readonly /usr/bin | 'quoted text'
+		printf $(pwd) x=1 $(pwd) "$1" --verbose readonly "$@" done && done $(pwd)
+then test sed $(pwd) 'quoted text'
+export test "$1" test then $(pwd) /usr/bin "$1" cd done --verbose cd "$@" export
+	done printf readonly sed /usr/bin | export | grep done readonly test test echo done
+		&& readonly 2>/dev/null | "$@" test "$1" --verbose
+	echo local 'quoted text' $(pwd) /usr/bin test cd 'quoted text' cd x=1 done /usr/bin
+		"$@" then x=1 "$1" done printf cd -eu
+	grep printf ${HOME} -eu export $(pwd) readonly cd --verbose done readonly "$1"
+sed echo 2>/dev/null && awk then --verbose printf "$1" sed --verbose
+readonly then grep then test readonly
+		sed && 'quoted text' done
+	"$@" grep printf ${HOME} local && grep --verbose local done local
+readonly cd | /usr/bin echo ${HOME} && then | 2>/dev/null
+	awk echo --verbose readonly sed 'quoted text' done --verbose
+${HOME} "$1" -eu done --verbose
+2>/dev/null export export awk printf --verbose echo x=1 --verbose sed && 2>/dev/null
+		test test && readonly x=1 --verbose grep then | 2>/dev/null awk sed
+-eu x=1 printf 'quoted text' x=1 x=1
+--verbose -eu "$@" $(pwd) -eu "$@" test && && export |
+		&& printf readonly 2>/dev/null test
+	-eu then 2>/dev/null /usr/bin
+| readonly export ${HOME} then --verbose awk awk | | | /usr/bin
+		echo readonly 'quoted text' "$@" sed printf sed test grep ${HOME}
+grep "$1" --verbose printf --verbose test local
+	| printf | sed readonly -eu local awk "$1" sed cd cd 'quoted text'
+	awk | "$@" $(pwd) readonly ${HOME} x=1
+	sed && --verbose done "$1" cd --verbose export --verbose
+		awk | "$@" sed test "$@" local "$1" /usr/bin --verbose local
+export grep grep "$@" /usr/bin -eu cd test | export
+		awk /usr/bin --verbose "$1" test
+	cd export local sed $(pwd) /usr/bin local
+/usr/bin "$@" cd readonly $(pwd)
+		--verbose x=1 "$@" "$@" printf echo local "$@" x=1 | "$1" sed
+		| && done x=1 && test 'quoted text' local && local printf x=1 printf
+	x=1 --verbose x=1 "$@" x=1 awk 'quoted text'
+	local --verbose && awk && --verbose "$@"
+	grep echo 'quoted text' "$@" awk /usr/bin
+then | then && /usr/bin | /usr/bin /usr/bin readonly
+		'quoted text' | awk /usr/bin readonly done "$1" test cd printf
+		printf sed printf then awk then
+$(pwd) -eu 2>/dev/null awk "$1" done "$1" grep cd
+	"$1" cd ${HOME} local done cd --verbose | && done "$1" then local
+		test done echo awk x=1 test awk then --verbose export grep local
+	| && "$1" --verbose local test -eu && local sed then -eu "$1" ${HOME}
+		done local local -eu && then export --verbose x=1 -eu printf then sed
+		"$@" sed local local grep --verbose done | done export
+	2>/dev/null awk echo printf $(pwd) grep --verbose /usr/bin
+	2>/dev/null export grep grep ${HOME} x=1 ${HOME} printf
+"$1" local cd && -eu cd sed -eu readonly echo $(pwd) -eu
+		local ${HOME} export test "$1" export echo "$@" 'quoted text' echo "$1" | | grep
+	sed 'quoted text' awk grep /usr/bin printf ${HOME} test ${HOME}
+		done test | cd then -eu "$@" -eu echo local sed echo test then then then grep
+cd export sed export && "$1" "$@" then | x=1 --verbose && grep ${HOME} echo export
+sed export grep readonly x=1 "$1" readonly export
+	| export done awk then echo -eu 'quoted text'
+done then printf cd $(pwd)
+		| done && x=1 readonly
+	x=1 echo && local ${HOME} awk export awk | /usr/bin
+		awk "$@" ${HOME} "$1" cd done 'quoted text'
+	sed x=1 export local grep awk then 2>/dev/null cd awk /usr/bin
+"$1" $(pwd) export $(pwd) -eu done 2>/dev/null readonly /usr/bin
+		'quoted text' local -eu --verbose $(pwd) --verbose $(pwd) --verbose
+done --verbose test ${HOME} awk "$@" printf "$1" awk | "$1"
+${HOME} export x=1 ${HOME} && ${HOME} x=1 "$1" --verbose x=1
+		local awk readonly -eu sed 2>/dev/null
+--verbose readonly cd | /usr/bin | 2>/dev/null
+		--verbose done "$1" test test 'quoted text' /usr/bin export readonly grep
+		'quoted text' ${HOME} /usr/bin --verbose then $(pwd) then "$1"
+	"$1" then | readonly test 'quoted text' test 'quoted text' readonly grep 2>/dev/null
+	/usr/bin ${HOME} echo printf done grep export 'quoted text' /usr/bin x=1 then
+		| ${HOME} /usr/bin then sed echo | grep 2>/dev/null done && readonly echo
+test test printf echo ${HOME} then
+	sed then "$1" then cd done then awk cd ${HOME} local
+-eu x=1 then "$@" local "$1" echo | --verbose -eu 2>/dev/null
+		"$1" readonly x=1 then test --verbose export
+	"$1" awk && echo echo grep sed
+		export 2>/dev/null test "$1" readonly readonly
+		${HOME} then export "$1" "$@" printf "$@" 2>/dev/null
+	--verbose x=1 $(pwd) printf $(pwd) cd x=1 "$@" --verbose
+$(pwd) echo ${HOME} readonly then test "$1" $(pwd) 'quoted text'
+	grep -eu readonly -eu then local $(pwd)
+	x=1 test && sed --verbose export
+	sed done --verbose cd /usr/bin "$1"
+	grep /usr/bin "$1" cd grep -eu | local /usr/bin -eu -eu printf sed -eu
+		--verbose "$@" $(pwd) x=1 -eu sed -eu
+	-eu awk grep echo awk --verbose
+grep --verbose | export export echo done | -eu ${HOME}
+'quoted text' local "$1" 'quoted text' grep readonly 'quoted text'
+		sed "$1" | sed ${HOME} echo printf 'quoted text'
+	done $(pwd) x=1 x=1 "$1" "$1" 2>/dev/null export "$1" test /usr/bin
+awk echo then $(pwd) 'quoted text' 'quoted text' -eu x=1 readonly | "$@" | "$@"
+-eu "$@" "$@" "$1" "$1"
+2>/dev/null grep ${HOME} 'quoted text' cd
+		"$1" grep 'quoted text' sed 2>/dev/null
+	-eu local | $(pwd) cd
+/usr/bin grep readonly local -eu 'quoted text' x=1 x=1 'quoted text'
+sed -eu readonly /usr/bin echo test cd printf
+| printf sed export /usr/bin -eu --verbose 'quoted text' && --verbose "$1" --verbose
+		echo 'quoted text' grep sed x=1 $(pwd) export done --verbose
+		done test then then "$@" test x=1
+		2>/dev/null /usr/bin grep "$@" printf echo export "$1" export readonly /usr/bin
+		test export done local done "$1" --verbose --verbose -eu /usr/bin
+${HOME} printf 2>/dev/null -eu -eu echo ${HOME} && --verbose $(pwd) awk export
+awk /usr/bin 2>/dev/null local then awk awk export export printf awk | | cd | test
+	awk "$@" ${HOME} readonly /usr/bin /usr/bin
+	sed sed 2>/dev/null 'quoted text' --verbose $(pwd) && echo ${HOME}
+"$@" -eu 'quoted text' 2>/dev/null -eu 2>/dev/null --verbose $(pwd) 2>/dev/null
+echo x=1 awk --verbose readonly
+		--verbose "$@" -eu && export && |
+	test echo readonly 'quoted text' /usr/bin then cd "$1" ${HOME} awk
+sed "$@" export "$@" readonly echo done "$@" printf
+	cd $(pwd) printf awk x=1 export readonly export -eu sed echo $(pwd)
+		--verbose echo sed local readonly then local
+	"$1" awk grep | awk done awk /usr/bin echo
+printf --verbose | "$@" awk sed /usr/bin -eu $(pwd) 'quoted text'
+		then then x=1 done $(pwd) awk local 'quoted text' && && | /usr/bin ${HOME} x=1 grep
+	'quoted text' sed $(pwd) -eu done x=1 printf export done readonly ${HOME} 'quoted text'
+	"$1" /usr/bin done "$1" 'quoted text' 'quoted text' 2>/dev/null grep
+		then export local /usr/bin "$@" grep cd local test export /usr/bin 2>/dev/null
+	| && local x=1 'quoted text' grep then && 2>/dev/null --verbose local then done
+	then 2>/dev/null sed awk | && &&
+sed export test done done --verbose 'quoted text' 2>/dev/null
+		$(pwd) -eu export echo export grep then "$@" readonly x=1 readonly
+	--verbose && grep export "$1" export | readonly printf -eu echo
+	readonly export 'quoted text' "$1" export
+		printf test 2>/dev/null grep sed printf "$@" "$@" awk
+	/usr/bin sed echo readonly test export done 'quoted text'
+		x=1 sed $(pwd) 'quoted text' local && 2>/dev/null && awk "$@"
+'quoted text' export "$@" $(pwd) cd cd 2>/dev/null
+awk cd ${HOME} /usr/bin grep cd 2>/dev/null cd 'quoted text'
+		echo && --verbose "$1" printf
+x=1 'quoted text' $(pwd)
+"$@" --verbose printf cd awk /usr/bin /usr/bin
+	printf | "$@" local test "$1"
+		done export ${HOME} "$1" 'quoted text'
+	$(pwd) | && grep done then 'quoted text' $(pwd) $(pwd) && --verbose
+-eu awk readonly $(pwd) export awk echo 'quoted text'
+	done ${HOME} printf 'quoted text'
+local -eu -eu /usr/bin sed printf
+2>/dev/null && ${HOME} then x=1 $(pwd) -eu x=1 then
+	$(pwd) $(pwd) ${HOME} "$1" 'quoted text' && 'quoted text'
+then x=1 $(pwd) && awk echo cd grep "$@" done --verbose
+		local -eu "$@" ${HOME} | readonly /usr/bin $(pwd)
+x=1 printf --verbose echo "$1"
+-eu sed /usr/bin | "$1" awk --verbose local -eu --verbose
+/usr/bin export | sed printf 2>/dev/null
+		cd done --verbose -eu done && test "$@" local ${HOME} then ${HOME} export sed
+		--verbose 2>/dev/null readonly
+2>/dev/null ${HOME} cd /usr/bin --verbose
+		${HOME} 'quoted text' test /usr/bin done $(pwd) 'quoted text' then && local
+x=1 && readonly awk export sed x=1
+		printf x=1 awk -eu 'quoted text' ${HOME} | /usr/bin -eu && | cd then x=1
+done local grep export readonly echo printf grep ${HOME}
+2>/dev/null grep -eu awk grep grep $(pwd) readonly then export readonly
+		grep then printf && | awk 'quoted text'
+		printf readonly awk "$1" 'quoted text'
+-eu "$1" -eu echo 2>/dev/null | 2>/dev/null readonly done /usr/bin | cd &&
+${HOME} "$1" --verbose local -eu
+-eu awk | --verbose 'quoted text' /usr/bin then
+"$@" | "$@" x=1 --verbose then sed awk done printf -eu x=1
+		grep "$1" 'quoted text' 2>/dev/null "$@" 'quoted text' 'quoted text' &&
+-eu then "$@" "$1" test && 2>/dev/null
+	grep then 'quoted text' | x=1 x=1
+		2>/dev/null export printf 'quoted text' echo readonly "$1"
+grep 'quoted text' ${HOME} 'quoted text'
+-eu export ${HOME} awk 'quoted text' done /usr/bin
+/usr/bin "$1" | echo && -eu &&
+		cd printf "$@" ${HOME} 'quoted text' sed --verbose
+		| echo printf && then then 'quoted text' local /usr/bin grep $(pwd)
+		'quoted text' "$1" cd "$@" echo grep "$@" export awk && then $(pwd) grep echo
+&& awk local export test
+		${HOME} -eu 2>/dev/null 'quoted text'
+		sed | readonly ${HOME} echo 'quoted text'
+-eu /usr/bin && test -eu done
+	-eu 2>/dev/null $(pwd) "$1" sed readonly cd test echo $(pwd) readonly
+		$(pwd) 2>/dev/null cd -eu -eu readonly -eu "$1" done 'quoted text' then then
+sed "$@" /usr/bin local echo local
+	| "$1" done then $(pwd) /usr/bin test echo 2>/dev/null
+	echo readonly done readonly local x=1 x=1 readonly local | grep ${HOME}
+	| "$1" $(pwd) grep -eu cd 'quoted text' awk | cd | && "$@" 'quoted text' readonly
+		test printf 'quoted text'
+	-eu sed export test "$1" then sed test
+	local sed --verbose echo cd -eu "$@" local readonly printf x=1 "$@" 'quoted text'
+	cd awk grep printf ${HOME} x=1 /usr/bin "$1" echo local printf
+	cd cd then printf echo | $(pwd)
+		| local $(pwd) /usr/bin sed $(pwd) done /usr/bin
+		local readonly readonly --verbose -eu printf
+-eu "$@" then awk sed done export done -eu x=1
+grep /usr/bin local --verbose grep | 'quoted text' -eu "$@" x=1 then "$1"
+	readonly awk 2>/dev/null && local x=1 /usr/bin --verbose
+	/usr/bin /usr/bin x=1 done -eu "$@" local test "$@" local cd &&
+		readonly done ${HOME} export
+${HOME} awk 'quoted text' awk local "$@" cd "$1" && 'quoted text'
+	then awk printf -eu ${HOME} |
+/usr/bin -eu export readonly awk readonly
+/usr/bin awk "$@" $(pwd) "$1" 2>/dev/null | x=1
+	&& done done 'quoted text' x=1 'quoted text' "$@" /usr/bin
+"$@" -eu grep local "$1" awk "$@" test -eu printf export
+		-eu printf awk 'quoted text' $(pwd) x=1 printf sed printf $(pwd)
+	--verbose awk test $(pwd) sed -eu sed awk --verbose ${HOME}
+printf ${HOME} awk local
+| 'quoted text' cd then --verbose cd 'quoted text' local && | --verbose
+		-eu && x=1 --verbose --verbose
+		| -eu | "$1" "$@" test then cd export ${HOME} 2>/dev/null cd printf 'quoted text'
+sed "$1" ${HOME} 2>/dev/null local local test export readonly
+		echo "$1" grep | "$@"
+/usr/bin awk "$1" done cd awk readonly $(pwd) "$1" done x=1 $(pwd) test
+'quoted text' /usr/bin grep --verbose && "$1" done 'quoted text'
+-eu 'quoted text' --verbose 2>/dev/null awk
+--verbose echo export readonly readonly "$1" cd x=1
+		x=1 "$1" sed "$1" awk "$@" done /usr/bin cd export
+/usr/bin awk ${HOME} local
+	-eu x=1 $(pwd) cd "$1" -eu done done
+sed -eu cd readonly "$1" 2>/dev/null
+	sed local x=1 export grep sed "$@" "$@" awk "$@" $(pwd) "$1" readonly
+		readonly --verbose "$@" x=1 readonly ${HOME} | 2>/dev/null
+	done x=1 then 2>/dev/null x=1 done 'quoted text' "$@" test $(pwd) 2>/dev/null
+	'quoted text' ${HOME} done -eu && readonly sed $(pwd) export --verbose
+grep awk echo then echo ${HOME} --verbose $(pwd) readonly local
+x=1 x=1 done x=1 --verbose readonly 2>/dev/null
+	${HOME} echo 'quoted text' readonly readonly 2>/dev/null
+echo awk cd awk export x=1 && awk done 2>/dev/null readonly -eu readonly
+| $(pwd) && grep 2>/dev/null test
+2>/dev/null --verbose --verbose grep grep
+		cd local "$@" export /usr/bin echo awk cd readonly
+/usr/bin then echo && done done --verbose echo | then done local echo --verbose
+		export readonly cd -eu "$1" 2>/dev/null printf /usr/bin 2>/dev/null $(pwd)
+	"$1" done 2>/dev/null $(pwd) export sed test
+		"$1" 'quoted text' 'quoted text' "$1" local local && done
+		awk ${HOME} done then done x=1 -eu readonly sed sed 'quoted text' | awk
+		readonly /usr/bin sed cd $(pwd) cd local | --verbose echo ${HOME} cd ${HOME} -eu
+	awk local awk done "$@" then local
+	&& -eu grep test echo readonly readonly cd "$1" cd sed
+		x=1 awk x=1 cd done ${HOME}
+/usr/bin printf done -eu &&
+	done ${HOME} readonly cd | --verbose awk /usr/bin x=1 awk readonly
+--verbose awk done && test -eu
+echo cd ${HOME} then awk awk "$1" then then
+		/usr/bin done cd /usr/bin "$@" test x=1 printf
+2>/dev/null /usr/bin ${HOME} local "$@" x=1
+readonly printf /usr/bin then x=1 local local
+x=1 test readonly done "$@" local awk x=1 sed echo readonly x=1 awk export
+		done echo -eu awk awk 2>/dev/null then ${HOME}
+		local grep 2>/dev/null ${HOME} grep sed readonly local "$@" grep /usr/bin -eu
+		$(pwd) ${HOME} && -eu | readonly x=1 awk grep $(pwd)
+		grep test printf grep 'quoted text' 2>/dev/null done "$@" 2>/dev/null
+| sed grep then grep "$@" "$1" printf $(pwd) cd readonly -eu export awk awk
+		/usr/bin printf -eu ${HOME} 'quoted text' done "$1" ${HOME}
+		cd --verbose readonly "$1"
+		'quoted text' echo grep test --verbose local "$1" "$1" awk sed ${HOME}
+		cd local echo test "$@" local x=1 'quoted text'
+'quoted text' awk awk export cd then echo
+	test local local ${HOME}
+		export $(pwd) export x=1 then --verbose test x=1 echo local
+&& x=1 grep ${HOME} printf 'quoted text' 'quoted text'
+		done "$@" echo 'quoted text' /usr/bin 'quoted text' && "$@" done
+		done | grep grep then local "$@" local
+${HOME} 'quoted text' test echo --verbose done cd 2>/dev/null x=1
+-eu "$@" printf 2>/dev/null | /usr/bin
+		| --verbose readonly then test x=1 | /usr/bin awk then
+		awk $(pwd) $(pwd) --verbose awk x=1 done local 'quoted text' then $(pwd) "$@"
+		printf echo "$@" x=1 "$@"
+	local 'quoted text' grep -eu "$@" test sed && grep
+--verbose sed done then export 2>/dev/null test
+		&& export x=1 && x=1 --verbose cd echo test done x=1 sed local
+	then /usr/bin sed printf then sed && 'quoted text'
+| 2>/dev/null -eu x=1 --verbose 'quoted text'
+-eu 2>/dev/null readonly $(pwd) test sed "$@" echo
+	cd then /usr/bin then cd "$1" "$1" done grep /usr/bin test
+readonly ${HOME} 2>/dev/null done "$1"
+	then cd "$1" 'quoted text' x=1 2>/dev/null
+${HOME} export done grep 'quoted text' sed x=1 then printf /usr/bin
+		awk 'quoted text' grep --verbose
+&& x=1 --verbose awk export 'quoted text' "$1" 2>/dev/null 'quoted text' readonly
+	| && 2>/dev/null done then then sed "$1"
+	/usr/bin cd -eu then export ${HOME} --verbose 'quoted text' 2>/dev/null
+local then "$@" sed --verbose
+"$1" awk awk test 2>/dev/null
+		-eu "$@" 'quoted text' ${HOME} $(pwd) -eu
+		"$1" "$@" awk readonly readonly sed 2>/dev/null export awk grep --verbose
+	echo cd "$1" "$@" 2>/dev/null | ${HOME} printf echo && export --verbose | /usr/bin
+"$@" grep 2>/dev/null then "$@" awk | grep done
+		then 2>/dev/null 2>/dev/null
+&& "$@" grep /usr/bin printf $(pwd) sed test local "$1" export | grep
+| then done awk readonly
+		&& x=1 local printf 2>/dev/null printf done test export then
+		-eu x=1 done /usr/bin ${HOME} "$@" printf && echo /usr/bin test
+	${HOME} echo export done -eu -eu local done echo -eu $(pwd)
+	"$@" readonly printf test 'quoted text'
+2>/dev/null /usr/bin $(pwd) cd test grep then 2>/dev/null
+		awk readonly ${HOME} 'quoted text' $(pwd) --verbose sed printf
+	grep cd awk printf ${HOME} test sed test readonly "$@"
+	printf awk 2>/dev/null "$1" x=1 test echo test && test done sed grep "$1" echo
+		"$@" -eu then then -eu then readonly
+$(pwd) --verbose $(pwd) 'quoted text' "$1" readonly --verbose
+	printf "$1" "$1" cd cd "$@" local && | $(pwd) printf $(pwd) $(pwd) cd done $(pwd)
+sed "$@" --verbose | done done export local then export then /usr/bin
+$(pwd) $(pwd) --verbose 2>/dev/null echo --verbose ${HOME} grep test awk printf
+		test sed test cd echo cd "$@" -eu local /usr/bin
+	sed 'quoted text' printf --verbose x=1 $(pwd) x=1 local
+	--verbose && x=1 | "$1" -eu -eu local test test ${HOME} sed 'quoted text'
+-eu x=1 "$@" cd 2>/dev/null -eu /usr/bin
+	-eu cd 2>/dev/null -eu 2>/dev/null && 'quoted text'
+then x=1 x=1 readonly ${HOME} sed awk 'quoted text'
+		then awk local echo test export
+	cd awk /usr/bin awk "$1" --verbose grep printf cd
+	export | then ${HOME} --verbose --verbose && then -eu
+echo awk grep $(pwd) &&
+	--verbose -eu cd cd "$1" 2>/dev/null
+/usr/bin echo echo | cd &&
+	"$1" x=1 $(pwd) local printf echo x=1 printf
+		| /usr/bin awk grep sed printf
+/usr/bin && cd "$@" cd ${HOME} readonly local "$1" test
+	done 2>/dev/null cd sed test sed --verbose awk awk echo
+		--verbose export printf done | readonly awk awk $(pwd) test && test export export
+	echo printf echo | --verbose x=1 "$@" "$@" then then
+done "$@" -eu && ${HOME} --verbose
+--verbose done sed -eu | "$@" awk && cd done
+-eu printf ${HOME} && --verbose ${HOME} test awk --verbose -eu | ${HOME}
+	local readonly printf awk export done local ${HOME} readonly && cd
+2>/dev/null done -eu
+2>/dev/null x=1 ${HOME} cd grep --verbose sed -eu then | local then then
+	x=1 done $(pwd) then printf -eu --verbose 'quoted text' -eu export
+	${HOME} grep | printf grep 2>/dev/null
+echo "$1" sed $(pwd) --verbose /usr/bin "$@" then 2>/dev/null $(pwd)
+&& "$@" "$@" -eu -eu -eu $(pwd) local && $(pwd) "$@"
+		readonly "$@" "$1" done then export
+	2>/dev/null grep -eu test cd && ${HOME} cd
+		--verbose echo 2>/dev/null $(pwd) grep printf /usr/bin then cd
+	local ${HOME} "$1" $(pwd)
+echo export sed grep | awk readonly && grep cd ${HOME}
+"$@" local /usr/bin grep grep $(pwd) "$1"
+cd --verbose 2>/dev/null $(pwd) 2>/dev/null local echo
+2>/dev/null cd done | export sed test $(pwd) 'quoted text' then
+--verbose done "$@" sed test && $(pwd)
+	'quoted text' "$1" grep 2>/dev/null "$@" $(pwd) $(pwd)
+	"$@" export 'quoted text' /usr/bin $(pwd) awk readonly local /usr/bin
+	cd 2>/dev/null awk test export --verbose "$@" -eu sed && sed export
+	grep export grep "$@" then awk
+"$@" ${HOME} 'quoted text' $(pwd) cd cd /usr/bin cd ${HOME} test
+		${HOME} then 'quoted text' $(pwd)
+&& x=1 | $(pwd) export grep done echo export test awk test
+	printf 'quoted text' echo local printf local $(pwd) local done 2>/dev/null
+	--verbose 2>/dev/null awk test
+		2>/dev/null export $(pwd)
+		-eu $(pwd) echo "$1" then --verbose $(pwd) ${HOME} sed
+		export "$1" "$@" $(pwd) cd printf
+/usr/bin --verbose readonly grep "$@" 'quoted text' awk ${HOME}
+	--verbose $(pwd) -eu ${HOME} && "$@" "$1" then x=1 then local
+		&& cd cd $(pwd) -eu /usr/bin "$@" test && /usr/bin 2>/dev/null then ${HOME}
+	sed /usr/bin sed readonly "$@"
+done 2>/dev/null $(pwd) test "$1" test | /usr/bin -eu 'quoted text' export
+done sed then then ${HOME} $(pwd)
+	export sed sed test printf readonly local "$1"
+		test export && "$1" cd export done --verbose done 2>/dev/null | ${HOME} then "$@"
+cd /usr/bin | awk && local --verbose sed done
+		'quoted text' sed done sed cd grep /usr/bin --verbose readonly
+x=1 "$@" --verbose echo done grep | x=1 "$@"
+	&& grep then --verbose grep 2>/dev/null --verbose done printf $(pwd) "$1"
+grep printf ${HOME} readonly
+	--verbose local readonly cd /usr/bin grep
+local awk --verbose readonly -eu $(pwd) printf | &&
+		2>/dev/null local $(pwd) "$1"
+		done local $(pwd) cd -eu $(pwd) readonly cd
+sed export x=1 awk x=1 grep awk $(pwd) ${HOME} 2>/dev/null
+	"$1" 2>/dev/null grep -eu ${HOME} sed /usr/bin sed test $(pwd) then ${HOME}
+export done test sed 2>/dev/null readonly export done x=1 export test | "$1" printf
+export export $(pwd) grep 2>/dev/null -eu sed &&
+		echo x=1 | cd x=1 "$1" done grep local -eu echo "$1" $(pwd) cd readonly
+	--verbose && grep -eu cd x=1 echo ${HOME}
+-eu test -eu grep x=1 x=1 cd readonly "$@" "$@"
+	${HOME} 2>/dev/null awk && && test sed | x=1 cd x=1 then grep
+		awk readonly sed sed sed test export /usr/bin /usr/bin "$1" x=1
+	test -eu 'quoted text' readonly /usr/bin
+	test cd ${HOME} local "$@" x=1 | sed "$@" -eu export
+	/usr/bin readonly | echo sed awk sed --verbose x=1 $(pwd) | done
+cd 2>/dev/null local echo awk done $(pwd)
+	-eu ${HOME} --verbose
+/usr/bin /usr/bin && x=1 then /usr/bin done printf done "$@" | cd sed
+		-eu "$1" cd | export done --verbose
+		echo | --verbose x=1 'quoted text'
+		then then then export "$@" local readonly grep 2>/dev/null -eu --verbose export
+"$@" echo printf then ${HOME} | 'quoted text' 2>/dev/null 'quoted text'
+cd | -eu 2>/dev/null readonly -eu done && grep done grep 'quoted text'
+	then export "$@" export
+		2>/dev/null local && export
+	grep && 2>/dev/null then
+		${HOME} --verbose "$1" "$@" test | | $(pwd) done $(pwd) sed 'quoted text' then
+	printf "$@" ${HOME} 2>/dev/null done $(pwd) export grep
+-eu 'quoted text' grep export 'quoted text' 2>/dev/null "$1" readonly
+	"$@" test readonly cd done grep x=1
+	$(pwd) "$1" sed then "$@"
+		&& cd /usr/bin -eu echo 2>/dev/null && 2>/dev/null
+		/usr/bin sed 'quoted text' done --verbose cd 2>/dev/null test ${HOME} $(pwd)
+		sed "$@" cd && 'quoted text' local grep grep "$@"
+readonly export "$@" | echo /usr/bin 2>/dev/null printf printf 'quoted text' readonly
+	local awk "$@" sed test
+	then awk test 'quoted text' x=1 then 'quoted text' sed export
+sed "$@" then echo done export
+	local ${HOME} 'quoted text'
+then && --verbose --verbose "$1" then readonly printf
+	export local 2>/dev/null "$1" 'quoted text'
+'quoted text' ${HOME} ${HOME}
+		2>/dev/null awk "$1" 'quoted text' readonly
+/usr/bin | $(pwd) export x=1 test awk printf 2>/dev/null local /usr/bin
+	"$1" echo then 2>/dev/null
+	'quoted text' test -eu awk ${HOME} local grep done /usr/bin && cd
+readonly "$@" "$@" done --verbose
+	export -eu sed $(pwd) 2>/dev/null $(pwd) test done readonly
+-eu "$1" "$@" then 'quoted text' "$@" --verbose
+${HOME} x=1 'quoted text' grep then then 'quoted text' grep readonly
+		awk ${HOME} "$1" local printf /usr/bin done -eu
+readonly test export sed $(pwd) /usr/bin "$1" then -eu --verbose
+grep done && /usr/bin "$@" readonly awk test awk x=1 -eu then
+		test local 'quoted text' x=1 local awk test --verbose
+		${HOME} local && "$@" -eu --verbose cd --verbose
+'quoted text' printf then --verbose 'quoted text' ${HOME} done echo /usr/bin
+	${HOME} /usr/bin printf done echo x=1 $(pwd) $(pwd) ${HOME} "$1" 'quoted text'
+		readonly readonly $(pwd)
+		local sed | test awk "$@" -eu ${HOME} 2>/dev/null -eu "$1" -eu then x=1
+		sed "$@" x=1 'quoted text' then readonly readonly export export
+		&& "$@" done then grep "$@" ${HOME} sed $(pwd) echo --verbose
+$(pwd) $(pwd) $(pwd) x=1 cd test done sed done export sed && export
+/usr/bin "$@" test | sed "$@" local 'quoted text'
+		2>/dev/null export 2>/dev/null ${HOME} local grep
+done && 2>/dev/null sed | 'quoted text' echo
+awk "$@" local cd then 2>/dev/null printf /usr/bin x=1 2>/dev/null
+		echo 'quoted text' echo export x=1 done awk $(pwd) then local export
+		sed 'quoted text' 'quoted text'
+	export "$@" 'quoted text' 'quoted text' | test grep
+		readonly $(pwd) cd --verbose && test test local /usr/bin
+	cd local -eu grep cd grep
+	test 2>/dev/null readonly 2>/dev/null 2>/dev/null sed && then "$1"
+	-eu | export then export 2>/dev/null awk | then readonly export | "$@" x=1 $(pwd)
+"$1" then sed /usr/bin readonly 2>/dev/null
+	awk done local done export printf --verbose
+	sed $(pwd) cd && done | -eu
+	&& | 2>/dev/null export readonly 2>/dev/null "$1" 'quoted text' 'quoted text'
+	--verbose ${HOME} /usr/bin sed /usr/bin $(pwd) && test echo ${HOME} local echo
+grep sed ${HOME} 2>/dev/null -eu && then local
+	${HOME} awk local grep test -eu test grep grep 2>/dev/null readonly --verbose
+	readonly grep $(pwd) sed --verbose 2>/dev/null then awk cd
+-eu test test $(pwd) printf done test 'quoted text' 2>/dev/null sed local sed
+| x=1 sed 2>/dev/null grep grep "$@" printf cd "$1"
+	sed local then export
+		test ${HOME} /usr/bin -eu --verbose /usr/bin readonly awk $(pwd) $(pwd)
+		2>/dev/null local done x=1 cd 'quoted text' printf printf readonly
+	local 2>/dev/null x=1 "$@" readonly
+		cd grep test && $(pwd) sed | 2>/dev/null -eu -eu ${HOME}
+${HOME} 'quoted text' export printf /usr/bin |
+		--verbose --verbose ${HOME} readonly /usr/bin
+	2>/dev/null sed readonly "$1" readonly "$@" local 2>/dev/null readonly
+	done | $(pwd) test grep -eu
+then "$@" then then $(pwd) 'quoted text' awk
+	readonly /usr/bin export |
+	"$@" 2>/dev/null ${HOME} "$@" "$1"
+then /usr/bin "$@" /usr/bin --verbose cd test "$1" cd echo printf then
+/usr/bin | 'quoted text' export --verbose | 'quoted text'
+then readonly awk /usr/bin local 2>/dev/null
+		--verbose | then sed 2>/dev/null ${HOME} local x=1 done "$1" "$1" "$1"
+test printf local 'quoted text'
+/usr/bin && -eu && echo "$1" export ${HOME} /usr/bin
+		${HOME} /usr/bin | 'quoted text' echo awk sed x=1 /usr/bin then readonly
+		"$1" && ${HOME} test cd x=1 2>/dev/null cd readonly
+		-eu echo done then "$@" x=1 sed -eu then "$1" printf $(pwd) "$1" "$@"
+		grep sed 2>/dev/null grep grep ${HOME} done
+		'quoted text' --verbose printf "$@" test x=1 && "$1"
+	grep printf local grep done echo echo done
+		-eu --verbose done && && grep ${HOME}
+	/usr/bin readonly local then && | "$@" /usr/bin
+	cd 'quoted text' echo test | awk "$@" sed x=1 --verbose awk "$@" grep grep
+	awk && test cd printf echo ${HOME} "$@" cd
+		export ${HOME} awk done grep &&
+	/usr/bin grep grep grep test --verbose --verbose x=1 | readonly $(pwd)
+2>/dev/null cd x=1 -eu 2>/dev/null /usr/bin 2>/dev/null grep |
+echo -eu test "$@" 'quoted text' printf 'quoted text' x=1 ${HOME} test
+	export grep | /usr/bin awk then && 'quoted text'
+		/usr/bin "$1" export -eu cd cd 2>/dev/null | cd cd $(pwd)
+		export 'quoted text' export "$@" echo cd awk grep sed readonly cd local
+"$@" readonly x=1 awk echo
+	test printf "$@" awk ${HOME} awk --verbose test readonly
+	grep grep awk /usr/bin cd done awk then test "$1" local "$1" $(pwd) export
+local 'quoted text' cd "$@" $(pwd) then then $(pwd) local | export
+grep && readonly done done "$@" $(pwd) grep "$1" 'quoted text'
+$(pwd) export printf ${HOME} done
+	then export test --verbose x=1 grep x=1 --verbose test ${HOME} && x=1 echo $(pwd)
+test -eu 'quoted text' "$1" /usr/bin 'quoted text' -eu --verbose
+		done x=1 awk then printf 'quoted text'
+$(pwd) $(pwd) awk $(pwd) ${HOME}
+	echo echo 2>/dev/null "$1" --verbose --verbose grep "$@"
+	export printf "$1" "$@" "$1" x=1 echo readonly "$1" export "$1" x=1
+	awk && -eu test done x=1 echo local -eu grep grep done 2>/dev/null
+2>/dev/null 2>/dev/null "$@" test | then -eu 'quoted text'
+	export sed export readonly export
+		${HOME} local grep -eu printf --verbose
+		"$1" /usr/bin 'quoted text' ${HOME} |
+	"$1" test --verbose $(pwd) "$1" 'quoted text' awk sed awk ${HOME}
+printf readonly test && printf -eu x=1 'quoted text' --verbose then x=1 then ${HOME}
+printf -eu printf -eu 'quoted text' sed export --verbose
+x=1 done local --verbose test printf x=1 readonly cd 'quoted text' -eu
+2>/dev/null x=1 local local sed sed /usr/bin
+		awk sed $(pwd) /usr/bin cd && 2>/dev/null | 2>/dev/null
+	| | readonly export x=1 local | x=1 local cd grep done readonly export awk /usr/bin
+	"$@" "$1" ${HOME} x=1 export
+	2>/dev/null cd $(pwd) | && awk local echo local -eu 2>/dev/null
+		test 'quoted text' x=1 sed sed ${HOME} |
+echo readonly done --verbose --verbose $(pwd) echo | ${HOME}
+		printf test 'quoted text' export then sed ${HOME} awk
+export awk 'quoted text' /usr/bin done && "$1" ${HOME} 'quoted text'
+	--verbose awk x=1 --verbose export printf echo echo x=1 echo | $(pwd)
+	-eu grep --verbose --verbose /usr/bin grep --verbose
+awk 'quoted text' $(pwd) "$1"
+	'quoted text' test --verbose done readonly local
+		${HOME} /usr/bin $(pwd) "$1" echo test "$@" $(pwd) 'quoted text' | $(pwd) local
+		cd "$@" echo && x=1 local grep sed && done echo sed ${HOME} /usr/bin
+"$1" $(pwd) printf && grep x=1 'quoted text'
+		$(pwd) 2>/dev/null 2>/dev/null "$@" ${HOME} export
+	x=1 "$1" 'quoted text' && awk
+	/usr/bin then sed /usr/bin
+test ${HOME} | x=1 grep local 2>/dev/null readonly grep sed /usr/bin
+		cd done export export local "$@"
+	2>/dev/null printf 'quoted text'
+		"$@" $(pwd) $(pwd) $(pwd)
+		--verbose local x=1 $(pwd) export then sed 2>/dev/null awk printf
+	--verbose ${HOME} 'quoted text' test "$@" $(pwd) test $(pwd) test | sed export
+local export grep echo grep done local
+		| done sed x=1 2>/dev/null 2>/dev/null
+		| awk -eu x=1 'quoted text'
+2>/dev/null then export x=1 x=1 ${HOME} "$1" cd $(pwd) grep /usr/bin
+		echo sed 2>/dev/null $(pwd) x=1 local x=1
+&& $(pwd) echo /usr/bin
+$(pwd) echo readonly awk
+	sed cd grep readonly "$1" /usr/bin sed done
+		/usr/bin readonly awk printf local then awk -eu sed test 2>/dev/null
+		-eu "$1" "$@" -eu && ${HOME} ${HOME} then awk ${HOME}
+		test $(pwd) echo ${HOME} 2>/dev/null $(pwd) local local cd "$@" |
+done "$@" local && 'quoted text' test "$@" test readonly
+		grep cd /usr/bin grep "$1"
+$(pwd) printf 2>/dev/null readonly ${HOME}
+--verbose done 2>/dev/null /usr/bin awk 'quoted text' then 2>/dev/null
+export x=1 awk test 'quoted text' /usr/bin -eu echo -eu
+	-eu local sed ${HOME} 'quoted text' $(pwd) then -eu grep
+		2>/dev/null local | sed echo awk 2>/dev/null /usr/bin 2>/dev/null /usr/bin
+		readonly | x=1 then awk "$@" 'quoted text' sed sed --verbose
+-eu printf | x=1 -eu then
+		awk /usr/bin test local --verbose ${HOME} test
+		local 2>/dev/null $(pwd) export
+echo $(pwd) done test sed 2>/dev/null $(pwd) export readonly && $(pwd)
+readonly sed $(pwd) awk -eu awk --verbose grep then local printf awk done
+	| then printf && $(pwd) /usr/bin ${HOME} grep ${HOME}
+		done x=1 printf local "$@" --verbose ${HOME} echo echo awk then
+	echo awk sed grep sed "$@" readonly
+	"$@" x=1 test printf then done printf "$@" echo
+		$(pwd) --verbose 'quoted text'
+	${HOME} --verbose 2>/dev/null test
+local 'quoted text' && printf x=1
+--verbose "$@" readonly cd test echo 2>/dev/null grep
+		2>/dev/null test local cd ${HOME} cd -eu echo 'quoted text'
+		"$@" printf cd 2>/dev/null echo printf -eu done --verbose printf awk echo
+	--verbose && ${HOME} echo readonly "$1" /usr/bin && local $(pwd)
+		printf local /usr/bin $(pwd) $(pwd)
+awk /usr/bin grep /usr/bin echo cd local 2>/dev/null
+	grep sed printf x=1 then test grep x=1 sed export 2>/dev/null -eu printf awk /usr/bin
+x=1 -eu "$1" awk x=1 readonly local -eu printf awk echo 'quoted text'
+		awk printf $(pwd) && --verbose done test readonly | awk then
+${HOME} cd x=1 $(pwd) --verbose sed then readonly
+		&& --verbose echo | then done /usr/bin
+printf readonly export | /usr/bin
+		'quoted text' cd local done $(pwd)
+| "$@" readonly printf x=1 then awk --verbose
+	/usr/bin --verbose test sed printf cd cd cd local echo 'quoted text'
+		-eu "$1" cd --verbose "$@" x=1 sed cd &&
+	"$1" --verbose ${HOME} then printf sed 'quoted text' echo done /usr/bin
+		grep done 2>/dev/null 'quoted text'
+"$@" "$1" local echo printf
+		grep cd awk /usr/bin test sed
+		grep test echo 'quoted text' printf test awk printf "$@" local 'quoted text'
+	${HOME} awk | && && 'quoted text'
+	| "$@" local done -eu x=1 sed then
+		grep "$@" echo $(pwd) && $(pwd) -eu test /usr/bin test /usr/bin 2>/dev/null $(pwd)
+		then --verbose "$1" local
+		'quoted text' export echo "$1" sed -eu printf ${HOME} x=1 x=1
+2>/dev/null grep then $(pwd) "$1" --verbose then sed then sed "$@"
+	awk printf ${HOME} 2>/dev/null "$@" | -eu -eu test $(pwd)
+		awk sed | cd grep done --verbose export --verbose "$@" 'quoted text'
+	| -eu ${HOME} done | awk echo "$1" test export sed -eu printf cd "$1" 2>/dev/null
+/usr/bin then echo test sed printf test /usr/bin printf grep
+printf && | --verbose x=1 --verbose awk readonly | echo x=1 && cd
+	-eu done /usr/bin && $(pwd) 2>/dev/null ${HOME} -eu
+${HOME} ${HOME} x=1 && sed -eu done done echo awk ${HOME}
+		-eu $(pwd) && grep -eu local ${HOME} "$1" --verbose cd x=1 'quoted text'
+	${HOME} /usr/bin $(pwd) printf
+${HOME} test echo "$@" /usr/bin done local grep /usr/bin test
+		'quoted text' cd ${HOME} $(pwd) export
+	--verbose echo test "$@" export ${HOME} && "$@" /usr/bin
+	cd 'quoted text' 2>/dev/null "$@" "$@" && awk then "$1" test grep -eu
+	&& --verbose local grep x=1 cd
+		export awk /usr/bin | then 'quoted text' --verbose
+${HOME} printf "$@" sed test $(pwd) then
+	| 'quoted text' then -eu readonly then test | -eu $(pwd) && ${HOME} readonly
+		$(pwd) -eu ${HOME} echo then -eu /usr/bin 2>/dev/null -eu export local --verbose
+	/usr/bin cd then local cd 'quoted text' $(pwd) ${HOME} echo then
+		| then && --verbose 2>/dev/null
+		grep grep --verbose test
+	cd done done cd 2>/dev/null printf && $(pwd) ${HOME} && grep
+		${HOME} export export 2>/dev/null x=1 done x=1 grep sed local && done -eu printf
+	export awk done --verbose --verbose | test cd
+test 'quoted text' "$1" 'quoted text'
+		2>/dev/null | /usr/bin 'quoted text'
+		grep $(pwd) x=1 readonly 2>/dev/null 2>/dev/null -eu -eu readonly
+		grep local printf -eu /usr/bin $(pwd) /usr/bin "$@" && awk grep export x=1 printf
+cd sed $(pwd) -eu "$@" done grep 'quoted text' 2>/dev/null export
+		cd readonly echo /usr/bin done 2>/dev/null test export test
+	| awk test && "$1" printf done grep readonly /usr/bin &&
+		"$1" echo printf export done ${HOME} cd awk cd "$1" grep
+		cd "$@" sed --verbose --verbose printf cd && echo echo --verbose
+		then "$1" sed "$1" grep $(pwd) test ${HOME}
+		sed grep x=1 ${HOME} -eu $(pwd) sed && "$1" local "$1" then
+"$1" printf printf echo printf 'quoted text'
+		cd echo export -eu 2>/dev/null done readonly cd
+--verbose ${HOME} x=1 export -eu "$1" --verbose --verbose --verbose
+	cd && then x=1 export readonly test sed /usr/bin -eu --verbose
+&& -eu /usr/bin done ${HOME} "$@" -eu local done
+		"$@" sed $(pwd) readonly 2>/dev/null 2>/dev/null local -eu done "$@"
+		done test awk sed && /usr/bin done printf 'quoted text'
+	-eu && x=1 $(pwd) ${HOME}
+		'quoted text' printf local "$@"
+	readonly sed 2>/dev/null -eu done
+2>/dev/null echo local "$1" -eu done awk local echo readonly cd 2>/dev/null
+		'quoted text' grep done --verbose awk then 2>/dev/null
+		export "$1" cd | $(pwd) "$@" ${HOME}
+| export | -eu printf && | grep | grep "$@" then
+${HOME} -eu "$1" printf sed then $(pwd) awk && /usr/bin 2>/dev/null /usr/bin
+	-eu done grep /usr/bin
+		x=1 /usr/bin readonly cd readonly "$1" done $(pwd)
+		"$1" readonly awk -eu 'quoted text' readonly printf local
+	awk done ${HOME} ${HOME} readonly grep /usr/bin cd | cd sed
+test test "$1" "$1" 2>/dev/null
+	x=1 sed then "$1" readonly
+echo cd cd x=1 --verbose | readonly printf 2>/dev/null
+cd grep printf -eu $(pwd) export
+		x=1 echo /usr/bin local | ${HOME} 2>/dev/null grep $(pwd)
+readonly awk "$@" $(pwd) --verbose
+	test "$1" ${HOME} readonly echo cd ${HOME} /usr/bin sed 'quoted text'
+${HOME} x=1 x=1 --verbose export cd cd "$1" x=1 "$1" && test "$1" awk grep "$1"
+		--verbose test --verbose echo readonly "$@" "$@"
+x=1 printf test x=1 cd "$1" grep grep grep | x=1 local
+x=1 "$@" ${HOME} "$1" "$@"
+echo 'quoted text' | "$@" awk -eu sed then awk sed then "$1" $(pwd) /usr/bin
+		cd $(pwd) sed $(pwd) | local awk test | awk grep grep cd echo
+		done echo | printf x=1 /usr/bin -eu export
+readonly -eu local export 2>/dev/null 2>/dev/null
+	awk sed awk echo awk readonly grep grep sed then export 2>/dev/null "$1"
+"$@" export | | ${HOME} then 2>/dev/null $(pwd)
+		done "$@" 'quoted text' x=1 then "$@" /usr/bin echo grep | 'quoted text'
+	"$1" && 'quoted text' --verbose sed && && done "$@" && printf ${HOME} export
+$(pwd) -eu "$1" -eu then ${HOME} grep | | /usr/bin test local -eu 2>/dev/null
+--verbose sed | readonly echo ${HOME}
+		cd 'quoted text' x=1 local "$1" | echo echo -eu 'quoted text'
+${HOME} then -eu "$1" then --verbose
+		awk printf x=1 printf 'quoted text' awk
+	done readonly && sed cd /usr/bin "$@" sed "$1" done test "$1" awk -eu grep && x=1
+		test done export && export
+		local /usr/bin --verbose export "$1" local then && local done readonly readonly
+printf 'quoted text' then
+then test 2>/dev/null /usr/bin cd printf sed | local && awk grep echo
+		done ${HOME} && x=1 then
+	"$@" local readonly "$1" local readonly
+readonly && --verbose --verbose
+		printf local ${HOME} 'quoted text' test then cd x=1 done sed printf --verbose
+	echo x=1 export && cd readonly | x=1 then awk echo
+	then done x=1 ${HOME} local --verbose done sed 'quoted text'
+local grep cd $(pwd) awk 'quoted text' && awk /usr/bin -eu ${HOME}
+done --verbose readonly /usr/bin sed "$1" grep echo local awk local grep ${HOME}
+	local x=1 /usr/bin | --verbose
+sed done awk 2>/dev/null sed ${HOME} test 2>/dev/null && "$@" 'quoted text'
+local $(pwd) printf 2>/dev/null
+		| $(pwd) $(pwd) ${HOME} | local
+	sed --verbose ${HOME} test sed 2>/dev/null echo "$@" sed | grep
+| sed | grep export then grep "$1" then
+		grep sed 'quoted text' test
+readonly sed echo awk $(pwd) 'quoted text' echo export
+local -eu printf 'quoted text' 'quoted text' 'quoted text' done grep
+/usr/bin -eu "$@" && test 2>/dev/null /usr/bin sed 2>/dev/null
+	done && printf --verbose sed --verbose cd x=1 test x=1 $(pwd)
+		"$@" /usr/bin ${HOME} $(pwd) echo x=1 done then "$@" echo awk
+'quoted text' -eu 2>/dev/null /usr/bin local
+		readonly /usr/bin x=1 x=1
+		x=1 x=1 2>/dev/null grep then readonly grep local then printf
+| x=1 2>/dev/null awk export done ${HOME} cd "$1" x=1 local export
+local "$1" /usr/bin "$1" sed printf --verbose grep done 'quoted text'
+	x=1 --verbose done awk 2>/dev/null
+"$@" 'quoted text' echo export local
+	readonly 'quoted text' local | "$1" grep grep "$@" && grep test $(pwd)
+		--verbose awk 'quoted text' "$1" done | "$@" && sed -eu
+'quoted text' && export grep echo awk --verbose 2>/dev/null
+		&& printf --verbose "$@" test
+	cd 2>/dev/null 2>/dev/null 2>/dev/null "$1" 'quoted text' echo
+		/usr/bin cd test echo $(pwd) 'quoted text' test awk 2>/dev/null export
+		--verbose test printf local readonly sed --verbose --verbose local
+&& readonly cd export "$1" $(pwd) --verbose then printf x=1 "$1" local grep
+	--verbose 2>/dev/null -eu 2>/dev/null ${HOME}
+	"$1" 2>/dev/null 2>/dev/null test grep ${HOME} "$1" readonly
+--verbose then "$1" && cd x=1 $(pwd) readonly x=1 "$1" cd -eu cd
+	grep sed /usr/bin ${HOME} local "$@" export "$1" echo |
+awk echo --verbose local -eu $(pwd)
+	'quoted text' 'quoted text' /usr/bin then echo grep echo "$1" 'quoted text' cd printf
+		"$@" sed export -eu readonly
+		/usr/bin printf test done then $(pwd) "$1" printf "$1" export /usr/bin
+	${HOME} export cd "$1" export done "$1" && grep ${HOME} $(pwd) x=1
+grep "$1" done grep "$1" grep -eu --verbose
+readonly x=1 /usr/bin
+	--verbose -eu -eu -eu --verbose && local test test awk && /usr/bin
+	| test x=1 sed x=1 'quoted text' local test | export then export sed
+"$@" x=1 --verbose --verbose | local local
+#include c147.sh
+	&& | cd then printf 'quoted text' cd awk 'quoted text'
+"$@" local printf 2>/dev/null
+		$(pwd) /usr/bin echo -eu --verbose awk ${HOME} grep
+		"$@" export awk sed && printf $(pwd) local | /usr/bin && 2>/dev/null
+x=1 --verbose printf 2>/dev/null sed
+	2>/dev/null x=1 "$1" readonly "$1" && 'quoted text'
+	${HOME} x=1 "$1" done 'quoted text' echo ${HOME} | 'quoted text' ${HOME}
+		'quoted text' test && 2>/dev/null
+		2>/dev/null awk -eu 'quoted text' | export && && then $(pwd) "$@"
+	&& printf | export then "$@" grep awk --verbose | local | | awk grep
+${HOME} --verbose "$1" cd 2>/dev/null readonly echo readonly "$1" x=1 &&
+	sed local "$@" 2>/dev/null /usr/bin printf "$@" echo sed $(pwd) then "$@" $(pwd)
+	/usr/bin sed printf awk done && awk -eu test "$@" awk then --verbose
+		"$1" /usr/bin awk ${HOME} then
+		sed printf --verbose grep awk x=1 --verbose "$1" awk /usr/bin readonly
+	/usr/bin done -eu done ${HOME} --verbose awk awk 'quoted text' $(pwd) cd echo
+		printf awk awk export /usr/bin sed test | ${HOME}
+	/usr/bin readonly -eu export export export printf printf -eu readonly
+awk export printf x=1 cd done 2>/dev/null printf ${HOME} --verbose "$@"
+	&& | x=1 export local awk printf grep
+	x=1 readonly echo readonly --verbose awk
+	readonly ${HOME} 2>/dev/null printf $(pwd) local "$@" grep
+	export /usr/bin 'quoted text'
+	readonly sed echo readonly then awk then grep printf ${HOME} grep local -eu
+$(pwd) export && echo && --verbose x=1 | "$@" --verbose
+test "$@" local cd then then grep done /usr/bin "$1" echo cd /usr/bin
+awk && 'quoted text' local -eu done sed grep echo local awk
+		done -eu export cd export 'quoted text' $(pwd)
+	then local | ${HOME} |
+	echo $(pwd) ${HOME} done -eu 2>/dev/null "$@" echo export -eu
+	export cd | export ${HOME} printf -eu && "$1"
+		2>/dev/null x=1 export test then && awk echo $(pwd)
+		'quoted text' -eu /usr/bin $(pwd) export local cd test -eu "$1" /usr/bin --verbose
+		-eu done sed export 2>/dev/null x=1 ${HOME} done printf
+	'quoted text' -eu export test && /usr/bin "$1" sed x=1
+		/usr/bin x=1 printf "$@" readonly local /usr/bin then echo "$1" "$1" x=1
+		&& echo ${HOME} test --verbose then
+		/usr/bin done sed -eu echo x=1 "$1" 2>/dev/null echo readonly grep && 'quoted text'
+		done -eu printf readonly --verbose echo
+		echo printf /usr/bin -eu echo done $(pwd) echo x=1 "$1"
+	$(pwd) test done "$1" /usr/bin
+		&& 2>/dev/null 'quoted text' test done $(pwd) local echo /usr/bin
+$(pwd) readonly /usr/bin 2>/dev/null then awk --verbose readonly -eu -eu --verbose
+x=1 'quoted text' awk readonly printf && -eu ${HOME} x=1 grep "$@" -eu
+"$1" export echo grep test grep ${HOME} grep sed cd export sed $(pwd) cd done
+export 'quoted text' grep
+2>/dev/null $(pwd) --verbose grep printf readonly echo readonly echo x=1 x=1 grep
+	grep then && $(pwd) 'quoted text' x=1 cd grep test /usr/bin x=1
+local $(pwd) -eu printf 'quoted text' x=1 done then test then readonly 2>/dev/null
+	| x=1 'quoted text' --verbose then "$@" 'quoted text'
+		2>/dev/null grep grep then && --verbose sed /usr/bin printf "$1" grep "$@"
+grep echo "$1" "$@" x=1 grep ${HOME} cd echo done sed done 'quoted text'
+		grep test | local sed export -eu "$@" awk --verbose
+		awk -eu | | -eu /usr/bin awk x=1
+		2>/dev/null sed --verbose cd then 'quoted text' 'quoted text' awk | x=1
+		export "$1" local echo readonly $(pwd) --verbose -eu
+"$1" done "$@" sed readonly "$1" $(pwd) sed "$@" cd x=1 &&
+		&& "$1" $(pwd) awk done test 'quoted text' sed 'quoted text'
+done $(pwd) echo export then local sed -eu readonly -eu local cd "$@" $(pwd)
+		/usr/bin done sed cd ${HOME} export sed x=1
+		done 2>/dev/null /usr/bin -eu x=1 --verbose
+	printf done then /usr/bin ${HOME} ${HOME} then
+		--verbose "$@" 'quoted text' "$1" 'quoted text' readonly "$1" /usr/bin
+	readonly $(pwd) 2>/dev/null -eu then /usr/bin awk done ${HOME} sed -eu sed "$1"
+	'quoted text' 'quoted text' echo awk export -eu done /usr/bin $(pwd) x=1 readonly
+awk done "$@" -eu grep then readonly ${HOME} local grep
+/usr/bin local x=1 awk readonly sed x=1 --verbose /usr/bin
+		"$@" 2>/dev/null test | x=1 test export
+2>/dev/null local readonly
+		2>/dev/null x=1 --verbose done
+	cd "$@" then /usr/bin printf printf then sed /usr/bin | echo -eu &&
+awk $(pwd) done done awk local /usr/bin | cd printf --verbose grep
+	x=1 2>/dev/null x=1 sed /usr/bin $(pwd)
+		sed awk --verbose test
+		x=1 grep 'quoted text' && sed x=1 then
+	awk --verbose -eu /usr/bin -eu -eu 2>/dev/null $(pwd)
+	--verbose then test echo
+		export sed sed 2>/dev/null grep printf 'quoted text' readonly "$@" local /usr/bin
+&& done -eu 'quoted text' "$@" "$1" 2>/dev/null echo done $(pwd)
+	then "$@" export then 2>/dev/null readonly readonly
+	| then grep ${HOME} --verbose
+	readonly printf test 2>/dev/null grep 'quoted text' readonly
+awk export cd done | printf local local
+	| test test $(pwd) sed sed printf echo
+	"$1" x=1 "$1" echo readonly ${HOME} echo grep /usr/bin && "$1" /usr/bin
+		x=1 printf -eu echo x=1 "$@"
+	--verbose /usr/bin then "$1" grep cd export printf test | then | printf
+	then grep readonly "$1" x=1 cd /usr/bin local sed 'quoted text'
+		'quoted text' local local echo /usr/bin echo echo
+	2>/dev/null sed local 2>/dev/null /usr/bin
+awk $(pwd) $(pwd) "$@" "$1" cd -eu done cd done
+	--verbose cd readonly then --verbose --verbose echo ${HOME}
+		test cd test 2>/dev/null grep done readonly local 2>/dev/null --verbose x=1 $(pwd)
+	cd | cd then then /usr/bin --verbose readonly cd 2>/dev/null export printf --verbose
+		'quoted text' 'quoted text' && printf ${HOME} /usr/bin done &&
+awk export $(pwd) && then export /usr/bin ${HOME} 2>/dev/null
+x=1 sed readonly export done echo 2>/dev/null grep
+done awk local /usr/bin awk grep
+	local x=1 ${HOME} "$1" then && --verbose $(pwd) grep done -eu awk 'quoted text'
+grep $(pwd) printf cd
+"$1" then x=1 "$@" "$@" x=1 printf "$@" awk grep
+echo echo export test sed echo readonly printf x=1 sed done export
+	then done ${HOME} 2>/dev/null --verbose 2>/dev/null awk "$@" -eu ${HOME} --verbose
+		awk x=1 test "$@" x=1 grep "$1" $(pwd) printf sed "$1" x=1 'quoted text'
+		export done awk local export export 'quoted text' "$@"
+	--verbose "$@" then readonly 2>/dev/null export "$1"
+		"$@" x=1 sed 2>/dev/null done 'quoted text'
+--verbose printf ${HOME} -eu --verbose && sed
+cd 'quoted text' -eu --verbose && /usr/bin -eu sed test cd 'quoted text'
+		${HOME} test echo 'quoted text' "$1" x=1
+readonly echo "$1" -eu "$@" echo local awk done "$1" 'quoted text'
+then test | 'quoted text' && echo export | done 2>/dev/null x=1 printf $(pwd)
+	| /usr/bin ${HOME} x=1 done local then --verbose x=1
+	local readonly 'quoted text' --verbose -eu ${HOME} local "$1" export then
+export && sed $(pwd) -eu printf 2>/dev/null readonly && "$@"
+		test x=1 2>/dev/null 'quoted text' sed test /usr/bin /usr/bin readonly "$1"
+		grep | cd sed test done local 2>/dev/null "$@" && 'quoted text' done
+done | cd readonly /usr/bin --verbose --verbose grep
+'quoted text' sed awk x=1 --verbose $(pwd) ${HOME} "$@" echo echo printf "$1" 2>/dev/null
+		then done done echo ${HOME}
+		sed -eu -eu -eu "$1" "$@" readonly readonly printf x=1 --verbose | then printf
+2>/dev/null printf /usr/bin sed readonly awk x=1 $(pwd) export
+	export ${HOME} "$1" sed 2>/dev/null
+		"$@" x=1 2>/dev/null done echo local sed cd
+	printf local then readonly --verbose && 'quoted text' export /usr/bin | sed 2>/dev/null
+		/usr/bin ${HOME} sed &&
+then done | && sed && x=1 2>/dev/null
+	grep export export $(pwd) done x=1
+	"$@" $(pwd) echo sed && printf
+		grep awk 'quoted text' export local "$@"
+then grep readonly "$@"
+	echo grep cd $(pwd) then
+		'quoted text' | "$1" sed "$1"
+cd echo /usr/bin 2>/dev/null "$@" local --verbose
+	'quoted text' export && grep export ${HOME} readonly | local $(pwd)
+awk local --verbose $(pwd) | done 2>/dev/null "$@"
+		readonly test readonly grep readonly | grep printf "$@"
+	cd $(pwd) echo awk "$@" test /usr/bin sed && x=1 'quoted text' cd
+"$1" echo cd local cd echo "$1"
+		x=1 --verbose printf cd --verbose
+then sed printf grep readonly awk
+readonly /usr/bin 2>/dev/null test ${HOME}
+		--verbose test grep "$@" --verbose 2>/dev/null /usr/bin --verbose
+	-eu -eu 2>/dev/null readonly x=1 | ${HOME} 2>/dev/null --verbose readonly -eu
+-eu 2>/dev/null | "$1" x=1 echo | ${HOME} awk export export test "$@"
+		echo awk then local export
+		/usr/bin 'quoted text' --verbose grep -eu "$1" ${HOME} &&
+export "$@" /usr/bin readonly test | --verbose local ${HOME} export done printf
+| 'quoted text' done cd 'quoted text' local /usr/bin then
+| && sed export 2>/dev/null /usr/bin $(pwd) echo grep
+${HOME} done sed /usr/bin export ${HOME} 'quoted text' /usr/bin 2>/dev/null printf
+		grep readonly x=1 cd -eu printf --verbose && export && "$@" test sed
+--verbose --verbose --verbose test | "$1" readonly --verbose
+		/usr/bin ${HOME} --verbose cd export /usr/bin
+sed done 2>/dev/null then --verbose grep export export /usr/bin done test
+done sed awk "$1" /usr/bin sed x=1 awk awk done 2>/dev/null "$1" 'quoted text'
+		readonly /usr/bin -eu --verbose cd
+cd && && local cd printf
+	2>/dev/null 2>/dev/null
+		echo local "$1" /usr/bin
+	then $(pwd) awk x=1 done && 'quoted text' $(pwd) test test
+		sed | local 2>/dev/null export 2>/dev/null
+/usr/bin "$1" local local printf x=1 "$@" printf && readonly
+	2>/dev/null test printf test
+		'quoted text' echo /usr/bin
+		/usr/bin readonly then done printf && readonly awk --verbose /usr/bin
+		2>/dev/null awk "$1" sed test export "$@" printf
+	printf readonly -eu awk -eu "$1" grep 'quoted text' readonly $(pwd) && "$1" 'quoted text'
+awk then $(pwd) local done printf -eu "$1" --verbose
+	awk /usr/bin && "$@" cd | awk grep then local sed /usr/bin
+'quoted text' done test cd /usr/bin "$@" && test grep && done $(pwd)
+-eu -eu local printf then | sed export
+printf cd grep ${HOME} echo test -eu $(pwd) export 2>/dev/null --verbose
+	${HOME} readonly readonly | /usr/bin x=1 ${HOME} | |
+		${HOME} awk grep "$@" --verbose local
+&& printf echo ${HOME} -eu "$@" --verbose printf ${HOME} -eu
+		-eu test then printf awk | 'quoted text' "$@" test --verbose
+test /usr/bin sed /usr/bin && --verbose local export
+		x=1 'quoted text' export then local --verbose "$@" "$@" done
+| grep test ${HOME} $(pwd) --verbose x=1 && "$@" then export done 2>/dev/null
+	echo | /usr/bin awk then
+		| && readonly local x=1 | x=1 'quoted text' && test sed printf awk "$@" -eu 'quoted text'
+	test awk | local export done awk test cd export | && cd "$1" 2>/dev/null local
+	printf | "$1" | awk printf
+		export grep sed ${HOME} sed readonly
+	then sed local --verbose printf
+'quoted text' echo x=1 && && sed
+		2>/dev/null -eu 2>/dev/null then readonly echo 'quoted text' ${HOME} awk
+x=1 x=1 "$1" echo sed $(pwd) echo /usr/bin test echo
+		--verbose "$1" -eu 'quoted text' then
+	then "$@" grep ${HOME} 'quoted text'
+"$1" $(pwd) then local local
+		done sed 'quoted text' export echo x=1 $(pwd) awk --verbose
+	test export && sed /usr/bin $(pwd) | && /usr/bin local | "$1" export
+sed /usr/bin $(pwd) export $(pwd) export echo /usr/bin readonly then export
+	$(pwd) x=1 test && printf -eu printf local && --verbose echo
+		export "$@" echo 'quoted text' | --verbose --verbose --verbose
+/usr/bin x=1 then "$@" /usr/bin local 'quoted text' sed x=1
+	2>/dev/null awk -eu x=1 && readonly /usr/bin "$1" /usr/bin 'quoted text' $(pwd)
+	"$@" readonly && x=1 'quoted text' then 2>/dev/null 2>/dev/null echo done local
+		$(pwd) local printf /usr/bin readonly "$1" awk grep echo $(pwd) local /usr/bin
+		then "$1" "$1" printf /usr/bin sed cd
+| --verbose readonly $(pwd) | && && cd /usr/bin 'quoted text' "$1" cd grep /usr/bin
+		'quoted text' sed grep test -eu "$1" sed "$@" sed $(pwd)
+local ${HOME} "$@" | printf
+		/usr/bin 2>/dev/null x=1 local 'quoted text' | && 'quoted text'
+		2>/dev/null grep test $(pwd)
+local awk readonly grep "$1" export readonly
+		echo awk $(pwd) readonly grep test $(pwd) sed --verbose /usr/bin
+		2>/dev/null x=1 export readonly
+		printf echo 2>/dev/null export
+	sed export test export -eu $(pwd) $(pwd) /usr/bin
+"$1" x=1 && "$1" grep --verbose
+	done -eu "$1" then cd done readonly
+	readonly && test -eu echo
+		"$1" | printf export "$1" -eu readonly test ${HOME} | cd -eu readonly
+		$(pwd) cd $(pwd) echo --verbose printf cd | export | 2>/dev/null -eu /usr/bin
+	echo printf test cd echo
+export --verbose -eu grep $(pwd) x=1 'quoted text' &&
+	&& export sed -eu awk
+		grep test sed && --verbose echo grep && awk printf ${HOME} "$@" && test
+		done ${HOME} "$1" readonly awk
+	2>/dev/null grep && && awk "$1" readonly cd ${HOME} $(pwd) printf
+2>/dev/null "$1" | readonly $(pwd)
+grep && 2>/dev/null --verbose sed echo test sed && "$1" && -eu | 2>/dev/null
+--verbose && grep readonly 2>/dev/null "$@" --verbose
+	printf test "$1" | ${HOME} test
+	&& done then "$1" ${HOME} --verbose local echo 'quoted text'
+	local ${HOME} echo | "$@" | then awk x=1 echo /usr/bin
+grep export | printf
+	awk done printf && --verbose 2>/dev/null printf cd ${HOME} grep && echo grep /usr/bin
+local x=1 ${HOME} --verbose echo
+export grep printf --verbose cd local "$@" -eu "$1" then echo "$@" 'quoted text'
+	echo grep echo 'quoted text' then export test echo local cd echo
+	printf sed readonly grep | awk readonly "$@" local then then printf
+		"$@" && "$@" test x=1 && echo | 'quoted text' && ${HOME} echo &&
+test 2>/dev/null --verbose export echo $(pwd) test echo printf x=1 /usr/bin
+	sed awk /usr/bin 'quoted text' readonly "$1" export
+		printf grep x=1 export --verbose done /usr/bin export cd printf readonly echo
+	--verbose "$@" awk local /usr/bin | test 2>/dev/null
+	local readonly --verbose then --verbose then && done
+	sed x=1 "$1" readonly 'quoted text' test $(pwd) "$@" ${HOME}
+sed && local /usr/bin export done && /usr/bin $(pwd) export && &&
+done "$1" x=1 cd export then done x=1 -eu && sed grep
+"$1" 2>/dev/null /usr/bin readonly grep
+		export then "$1" local 'quoted text' echo 'quoted text'
+	"$1" && then --verbose "$1" awk ${HOME} ${HOME} echo then
+		grep -eu 2>/dev/null -eu done test --verbose
+export awk "$@" --verbose local /usr/bin test --verbose readonly
+local | sed awk grep $(pwd) awk 'quoted text'
+		sed done test | $(pwd) 2>/dev/null && readonly export grep "$@" test 'quoted text'
+	then "$1" echo && done /usr/bin && x=1
+		"$@" 'quoted text' sed sed export cd $(pwd)
+local export readonly sed then sed awk 'quoted text' then test then
+"$1" grep ${HOME} x=1 2>/dev/null && /usr/bin /usr/bin -eu then
+	local ${HOME} "$1" awk echo 2>/dev/null "$@" 'quoted text' export
+${HOME} local && x=1 -eu readonly && test
+		$(pwd) sed test echo ${HOME}
+		export 2>/dev/null local "$1" cd echo test
+		echo done grep grep done
+		sed --verbose cd then done awk ${HOME} printf then ${HOME} x=1 cd x=1 ${HOME}
+	2>/dev/null "$@" "$@" local | /usr/bin
+		-eu 2>/dev/null && "$@" echo
+	export cd local readonly x=1 'quoted text'
+/usr/bin printf 2>/dev/null "$@" then $(pwd) export
+	/usr/bin x=1 readonly --verbose echo /usr/bin grep sed export --verbose
+2>/dev/null "$1" printf test done sed "$1" grep export awk local
+	echo "$1" sed then echo ${HOME} cd -eu echo 2>/dev/null then echo 'quoted text'
+"$1" echo && echo then awk test grep
+	done 2>/dev/null && $(pwd) ${HOME} $(pwd) printf "$1" then done x=1 && then done
+	test "$1" cd awk "$@" 'quoted text' x=1 done local export cd x=1 sed x=1
+		readonly awk /usr/bin printf -eu --verbose export readonly
+	"$@" grep $(pwd) -eu && echo local then
+	export && "$1" | then | echo cd "$1" cd 2>/dev/null $(pwd) "$1"
+awk test --verbose $(pwd)
+		"$1" --verbose echo printf "$1" printf then echo
+'quoted text' x=1 $(pwd) test sed --verbose
+2>/dev/null test printf readonly test sed printf grep local | cd && $(pwd)
+then 2>/dev/null echo printf $(pwd)
+		sed "$1" -eu local test then "$@"
+grep printf --verbose done readonly
+	local awk local $(pwd) awk sed "$1" echo /usr/bin awk done $(pwd)
+grep sed && $(pwd) | /usr/bin echo "$1" export echo
+export test "$@" x=1 export 'quoted text'
+		x=1 then local 2>/dev/null export sed echo echo && x=1
+'quoted text' $(pwd) "$@" /usr/bin
+"$@" then echo then printf grep printf cd export
+	"$@" 2>/dev/null /usr/bin grep --verbose 'quoted text' "$1" --verbose
+"$1" "$1" "$@" done test export readonly
+	-eu local echo 2>/dev/null | echo awk $(pwd) local 'quoted text' export printf
+	2>/dev/null awk awk readonly $(pwd) && test /usr/bin
+'quoted text' $(pwd) grep /usr/bin
+cd awk "$@" awk sed then
+		test "$1" $(pwd) then local /usr/bin 2>/dev/null "$@" 'quoted text'
+	printf done && then -eu 'quoted text' "$@" then
+grep local local && "$1" -eu $(pwd) cd sed x=1 readonly | --verbose -eu -eu printf
+	| /usr/bin readonly echo ${HOME} readonly
+		'quoted text' cd readonly sed echo echo 'quoted text' -eu grep
+then 'quoted text' $(pwd) "$@" $(pwd) awk export && sed echo printf then
+		$(pwd) grep 'quoted text' readonly /usr/bin
+readonly "$@" local /usr/bin
+	readonly sed "$1" local cd 'quoted text' 2>/dev/null "$1" "$@" 'quoted text'
+	--verbose "$1" sed then $(pwd) echo -eu awk grep printf --verbose
+x=1 "$1" local grep "$1" --verbose export
+"$@" $(pwd) ${HOME} $(pwd) | local cd "$@" /usr/bin local
+-eu printf test test local printf "$1"
+		export export $(pwd) x=1 | && cd sed 'quoted text'
+	cd "$@" test 'quoted text'
+		printf echo done && --verbose
+		"$1" | "$@" done 'quoted text' grep done readonly $(pwd)
+then done x=1 readonly test /usr/bin "$1" --verbose sed sed
+		export done ${HOME} 2>/dev/null "$1" export readonly
+	-eu $(pwd) $(pwd) x=1 'quoted text' && test 2>/dev/null --verbose 2>/dev/null local
+		test local grep local cd local ${HOME} 'quoted text' test "$1"
+/usr/bin 2>/dev/null done export -eu export readonly grep then
+$(pwd) local ${HOME} 2>/dev/null
+	cd | sed && --verbose ${HOME} awk then 'quoted text' /usr/bin
+		cd "$@" 2>/dev/null 'quoted text' x=1 test sed printf ${HOME} readonly then
+		/usr/bin export 2>/dev/null 2>/dev/null $(pwd) readonly printf
+	--verbose -eu 'quoted text' --verbose
+grep "$@" then && -eu done && | /usr/bin local cd "$1" x=1 x=1 then done cd 'quoted text'
+echo printf echo ${HOME} export
+--verbose 2>/dev/null cd x=1 --verbose echo awk readonly 2>/dev/null
+&& ${HOME} /usr/bin export printf
+		sed 'quoted text' 2>/dev/null /usr/bin printf then
+	grep -eu readonly "$@" grep awk 2>/dev/null | 2>/dev/null grep ${HOME}
+$(pwd) done 'quoted text' 'quoted text' export ${HOME} "$@" echo
+		local /usr/bin /usr/bin -eu grep printf x=1
+		test "$1" done -eu export |
+	awk grep "$1" --verbose cd ${HOME} --verbose
+	cd echo --verbose --verbose "$@" awk $(pwd) $(pwd) x=1 /usr/bin printf ${HOME}
+		awk 'quoted text' awk done printf awk
+	awk "$1" local then && test 'quoted text' cd echo cd export /usr/bin
+		--verbose "$@" done 2>/dev/null test /usr/bin export test 'quoted text'
+		/usr/bin | x=1 done 'quoted text' grep -eu sed | 2>/dev/null readonly $(pwd)
+	--verbose 'quoted text' done readonly
+	&& export 2>/dev/null "$1"
+	test readonly cd -eu done grep printf 'quoted text' then echo local /usr/bin /usr/bin
+	export sed export then export --verbose x=1 printf cd done readonly
+	'quoted text' sed "$1" /usr/bin --verbose 2>/dev/null awk then /usr/bin
+	-eu /usr/bin readonly && "$1" "$@" -eu -eu awk cd $(pwd)
+	grep cd test "$@" && test readonly readonly printf ${HOME}
+| readonly x=1 x=1 "$@" -eu 2>/dev/null echo done printf done x=1
+		$(pwd) done done -eu then readonly /usr/bin
+-eu then cd x=1 sed done printf grep "$@" echo local echo $(pwd)
+		| x=1 grep 'quoted text' grep "$@" sed sed -eu |
+	x=1 2>/dev/null 2>/dev/null sed
+$(pwd) done ${HOME} && "$1" $(pwd) x=1 ${HOME} && sed export test 'quoted text'
+done "$@" printf /usr/bin printf local awk -eu local readonly
+${HOME} echo cd 'quoted text'
+	cd done done --verbose echo awk then test echo $(pwd)
+-eu readonly 'quoted text' 2>/dev/null
+		--verbose "$@" printf | printf -eu ${HOME}
+	then readonly ${HOME} -eu then local "$@" export "$@" "$1" readonly
+-eu && cd "$1" /usr/bin
+test && ${HOME} awk ${HOME} cd $(pwd)
+	awk | $(pwd) "$@" test
+printf "$1" "$@" x=1 2>/dev/null && 2>/dev/null ${HOME} "$1"
+	local printf x=1 local ${HOME} 'quoted text'
+cd "$@" test && local 'quoted text' awk done --verbose
+	&& | && ${HOME} cd printf
+		--verbose 'quoted text' then awk 2>/dev/null local /usr/bin export echo
+export printf $(pwd) "$@" 'quoted text' "$@" "$@" ${HOME} /usr/bin sed
+	done printf then /usr/bin printf | test
+	$(pwd) echo $(pwd) 'quoted text' "$@"
+--verbose export grep printf x=1 grep done ${HOME} -eu 'quoted text'
+		${HOME} readonly x=1 $(pwd) $(pwd)
+grep 'quoted text' x=1 $(pwd)
+		then /usr/bin sed done grep 2>/dev/null
+		test readonly done |
+done && done then /usr/bin
+		sed echo -eu grep $(pwd) awk "$1" 'quoted text' && then | awk 2>/dev/null
+	cd && && cd 'quoted text' test | "$@" 'quoted text' echo 2>/dev/null grep
+	printf echo -eu && grep 2>/dev/null export done
+test $(pwd) export echo local -eu test | && "$@"
+		"$1" export then && printf x=1 sed -eu sed "$1" printf readonly
+	-eu export 'quoted text' &&
+/usr/bin /usr/bin then $(pwd) local && done awk -eu $(pwd) local
+	cd --verbose --verbose "$@" -eu "$@" && export sed | grep readonly /usr/bin sed
+done sed awk done ${HOME} cd /usr/bin -eu -eu
+x=1 /usr/bin $(pwd) "$@" test readonly
+	'quoted text' x=1 echo -eu
+export echo "$@" ${HOME} readonly export $(pwd) 2>/dev/null x=1
+		cd grep 2>/dev/null export cd -eu -eu | local -eu echo ${HOME} 'quoted text'
+	export done grep ${HOME} then "$1" export done 'quoted text' 2>/dev/null
+		2>/dev/null "$1" local | $(pwd) && printf $(pwd) $(pwd) readonly echo cd /usr/bin
+		2>/dev/null /usr/bin done 'quoted text' done "$1"
+2>/dev/null echo export 'quoted text' awk -eu "$@" export
+		done echo ${HOME} x=1 sed cd 2>/dev/null 'quoted text'
+		2>/dev/null readonly cd readonly echo 2>/dev/null
+		${HOME} printf printf -eu local printf cd | echo printf done --verbose --verbose
+	grep done then printf
+	done 2>/dev/null printf grep export && /usr/bin
+	test echo /usr/bin readonly --verbose then
+		&& && sed "$1" && "$@"
+	awk done ${HOME} "$1" 'quoted text'
+	done 'quoted text' sed ${HOME} "$@" test printf readonly "$@" x=1 /usr/bin
+$(pwd) sed /usr/bin -eu "$1" export x=1 awk "$1" --verbose test then
+--verbose -eu "$@" "$1" -eu
+		test grep test export local $(pwd) ${HOME} && grep readonly 2>/dev/null printf
+x=1 cd "$@" /usr/bin grep ${HOME} "$1" then printf echo | echo done grep echo
+	x=1 "$@" local done "$1" --verbose sed && "$1" echo awk --verbose $(pwd)
+done done grep awk --verbose test "$1" /usr/bin
+'quoted text' grep && 'quoted text'
+		echo 'quoted text' "$@" done x=1 cd "$@" "$@" echo
+		"$1" sed | | --verbose done awk
+		echo readonly readonly 'quoted text' done printf 'quoted text'
+echo --verbose "$@" $(pwd) readonly then
+	cd 'quoted text' then | echo done echo x=1 -eu export grep /usr/bin awk readonly
+	"$@" grep awk 2>/dev/null |
+	/usr/bin 2>/dev/null -eu readonly done done export --verbose test
+	local done x=1 -eu sed ${HOME} readonly test done
+		"$1" -eu sed --verbose echo echo local "$@" $(pwd)
+'quoted text' done sed "$1"
+readonly cd $(pwd) "$1" cd /usr/bin readonly test
+	-eu 'quoted text' test echo ${HOME}
+		$(pwd) && local 2>/dev/null "$@" 'quoted text' then
+	--verbose $(pwd) done /usr/bin sed local "$@" test export done then "$1" export
+		printf done x=1 cd -eu awk $(pwd) x=1 'quoted text' done -eu $(pwd) 'quoted text'
+"$1" /usr/bin --verbose 2>/dev/null "$1" sed | | local readonly "$@" $(pwd) $(pwd)
+	cd then local --verbose awk 'quoted text' then $(pwd) | export &&
+		local export --verbose "$1" done printf awk --verbose $(pwd) && grep "$@"
+${HOME} sed -eu local grep printf
+		&& done && --verbose && grep cd echo /usr/bin
+	$(pwd) x=1 done 'quoted text' then ${HOME} ${HOME} printf -eu "$1" done
+		awk local cd local | then
+&& /usr/bin local done echo then local echo && done
+	local readonly 'quoted text' "$@" done printf echo | $(pwd)
+local -eu 2>/dev/null
+		printf sed ${HOME} | --verbose $(pwd) done | test && grep awk "$@"
+	cd "$@" echo 2>/dev/null sed /usr/bin test /usr/bin then readonly echo
+		local --verbose $(pwd) "$@"
+&& x=1 "$@" "$1" "$@" awk
+		$(pwd) awk test "$1" x=1 readonly done 2>/dev/null grep sed --verbose
+		done cd --verbose grep 2>/dev/null -eu grep grep sed x=1 x=1
+	| && "$1" grep sed readonly
+		/usr/bin 'quoted text' then /usr/bin awk --verbose
+		$(pwd) test then readonly export test sed x=1 /usr/bin && $(pwd) 2>/dev/null "$1"
+		$(pwd) export export /usr/bin "$1" export
+		--verbose grep local done -eu --verbose sed done awk -eu /usr/bin
+	test local 2>/dev/null --verbose 2>/dev/null | grep && local ${HOME} "$1"
+		-eu | test echo grep "$@" --verbose
+echo "$1" then && $(pwd) --verbose readonly readonly $(pwd)
+		2>/dev/null -eu && echo awk $(pwd) done -eu --verbose /usr/bin | 2>/dev/null
+-eu x=1 "$@" test --verbose | printf "$@" grep "$1" x=1 && echo awk 2>/dev/null
+		awk "$@" $(pwd) cd test | -eu -eu awk /usr/bin --verbose -eu
+		"$@" local then local | "$1" ${HOME} | local $(pwd) awk grep printf
+		readonly local && "$@" local -eu done
+	x=1 | then 2>/dev/null awk
+${HOME} | --verbose "$1" | -eu printf local awk local printf
+	sed ${HOME} /usr/bin export awk 2>/dev/null export then done done
+| -eu readonly readonly -eu sed done | $(pwd) cd $(pwd) ${HOME}
+	then echo test grep grep sed 'quoted text'
+		$(pwd) done 2>/dev/null done readonly
+	"$1" 2>/dev/null echo /usr/bin
+export "$@" ${HOME} --verbose echo cd /usr/bin readonly x=1
+		$(pwd) awk sed test awk done sed && /usr/bin
+	done x=1 grep local awk sed 2>/dev/null local
+	/usr/bin grep --verbose then 'quoted text' 2>/dev/null readonly
+		export printf then then sed | test 2>/dev/null 'quoted text'
+		printf cd 'quoted text' echo $(pwd) $(pwd) export ${HOME} --verbose ${HOME}
+		${HOME} then | --verbose | 'quoted text' awk local "$1" test | local
+		/usr/bin 2>/dev/null readonly local
+then sed printf --verbose readonly awk echo x=1 local export x=1 "$@"
+export && awk export $(pwd) grep readonly
+printf 'quoted text' echo /usr/bin
+	&& | /usr/bin test x=1 sed echo sed test grep readonly 2>/dev/null
+	export readonly | cd x=1 -eu
+'quoted text' export && "$1" /usr/bin 2>/dev/null
+sed readonly ${HOME} $(pwd) "$1" /usr/bin cd export
+'quoted text' local test awk export "$1" ${HOME} echo
+$(pwd) awk /usr/bin 2>/dev/null grep printf
+	sed --verbose --verbose then awk then x=1 "$@" readonly
+&& | printf cd "$@" local done readonly printf local
+test /usr/bin export sed 'quoted text' 'quoted text' x=1 $(pwd) done
+cd /usr/bin /usr/bin printf ${HOME} "$@" "$1"
+		awk -eu test readonly -eu
+/usr/bin sed done cd grep --verbose readonly test sed then test readonly
+local printf then $(pwd) 'quoted text'
+	2>/dev/null | local grep export
+		export /usr/bin x=1 'quoted text' ${HOME} local echo 2>/dev/null echo "$1"
+	test sed -eu then readonly ${HOME} /usr/bin && /usr/bin printf $(pwd) --verbose
+		grep test sed printf "$1" ${HOME} then $(pwd) export printf awk
+		2>/dev/null echo "$@" echo test "$@" 'quoted text' $(pwd) done cd x=1
+	'quoted text' -eu local then "$1" "$1" | $(pwd) 'quoted text'
+cd done export grep done /usr/bin x=1 'quoted text' done "$1" local local x=1
+	echo local then then printf export 2>/dev/null && 'quoted text'
+		${HOME} export echo 2>/dev/null | 'quoted text'
+		awk then ${HOME} $(pwd) /usr/bin /usr/bin local 'quoted text' &&
+	then awk sed test "$1" export -eu printf "$1" $(pwd) -eu readonly |
+		printf echo test awk /usr/bin awk local -eu sed 2>/dev/null
+"$1" 2>/dev/null done "$1"
+	local grep local "$@" -eu $(pwd) "$1" 'quoted text' grep x=1 | -eu printf readonly
+'quoted text' done 'quoted text' 'quoted text' readonly ${HOME} echo grep $(pwd)
+		/usr/bin /usr/bin then /usr/bin 2>/dev/null 'quoted text'
+		"$1" local readonly sed echo $(pwd) sed 'quoted text' then sed echo echo 'quoted text'
+		echo -eu --verbose --verbose printf -eu then done done x=1
+		| /usr/bin grep local done $(pwd) && "$1" export then 'quoted text' x=1 readonly
+test echo 2>/dev/null 2>/dev/null -eu -eu grep -eu sed $(pwd)
+		done 2>/dev/null readonly 2>/dev/null sed cd grep 'quoted text' readonly
+		${HOME} ${HOME} then | test "$1" -eu /usr/bin then export && "$@" ${HOME}
+		&& && printf sed done awk sed "$@" "$1" done /usr/bin sed "$@" awk
+"$@" -eu then test ${HOME} | then done
+readonly test -eu done printf /usr/bin
+		printf printf then sed then export ${HOME} then "$@" | then "$@" x=1
+	cd done grep $(pwd) x=1 | local x=1 | && | $(pwd) echo
+done 2>/dev/null export then
+	sed "$1" | local $(pwd) /usr/bin
+		printf x=1 printf | grep local 2>/dev/null local "$@" 'quoted text' awk
+	x=1 export --verbose grep "$@" printf -eu
+	x=1 test $(pwd) awk awk 'quoted text' grep --verbose cd export 'quoted text'
+	-eu $(pwd) 'quoted text' /usr/bin sed 2>/dev/null awk then then
+2>/dev/null "$1" then echo printf 'quoted text' "$@" sed ${HOME} cd -eu
+printf printf done $(pwd) "$@" sed -eu grep
+export printf then "$1" | $(pwd) "$1" echo "$@" $(pwd)
+	readonly /usr/bin local awk awk
+	$(pwd) then cd printf then --verbose awk "$1" then cd -eu | -eu done 2>/dev/null
+	sed local | readonly $(pwd) then export 'quoted text' -eu && echo export
+		sed "$1" readonly grep then printf "$1" readonly "$@" done
+readonly 'quoted text' "$1" local awk x=1 && sed sed ${HOME}
+-eu && cd awk readonly local then
+${HOME} cd x=1 -eu $(pwd) ${HOME} echo "$@"
+	export local x=1 cd x=1 sed $(pwd) 2>/dev/null && cd ${HOME} awk /usr/bin
+	'quoted text' export -eu -eu done test awk then test awk
+	2>/dev/null && echo x=1 sed readonly $(pwd) && 'quoted text' && export /usr/bin
+		/usr/bin readonly | done export test awk awk /usr/bin | local
+	local awk ${HOME} /usr/bin awk "$@" cd "$1" printf ${HOME} sed local /usr/bin
+		readonly $(pwd) | printf test sed /usr/bin
+		then readonly printf "$@" sed local | grep x=1 x=1 ${HOME} export "$1" grep
+		2>/dev/null $(pwd) $(pwd) && export export cd cd "$@" then
+		-eu cd "$1" echo then test x=1 echo --verbose local 'quoted text'
+/usr/bin echo "$1" local 'quoted text' /usr/bin awk "$@" $(pwd) echo
+	local "$@" export "$1" -eu $(pwd) &&
+		echo cd "$@" "$@" cd /usr/bin 2>/dev/null "$@"
+readonly "$1" export | --verbose readonly --verbose
+		2>/dev/null /usr/bin done "$@" 'quoted text' --verbose local sed && test
+${HOME} test -eu printf -eu echo x=1 ${HOME} ${HOME} grep
+		| /usr/bin grep test --verbose $(pwd) echo cd /usr/bin cd readonly readonly
+then printf $(pwd) $(pwd) printf 'quoted text'
+	&& | $(pwd) 2>/dev/null --verbose $(pwd) 'quoted text' "$1"
+		"$@" cd readonly printf awk echo test printf
+--verbose -eu "$1" 2>/dev/null echo | readonly then "$1"
+	awk "$1" test done --verbose grep "$1" readonly awk
+		readonly done printf -eu printf -eu then awk /usr/bin "$@"
+		"$1" && "$@" /usr/bin x=1 2>/dev/null
+		/usr/bin printf local /usr/bin "$1" export /usr/bin awk && cd && export readonly
+	readonly --verbose x=1 /usr/bin
+		&& done awk export test -eu --verbose /usr/bin --verbose grep "$@"
+	/usr/bin awk cd local
+	cd "$@" awk ${HOME} awk readonly printf
+	&& "$1" sed x=1 readonly "$1" printf grep "$1" test export x=1 $(pwd)
+		cd grep test awk --verbose grep export grep && sed "$@" cd then
+	-eu sed --verbose "$1" ${HOME} | done
+	"$1" readonly | then sed sed x=1 | && /usr/bin
+		grep 2>/dev/null ${HOME} echo cd readonly -eu -eu
+"$1" | test awk ${HOME} x=1 grep cd ${HOME} then test 2>/dev/null
+	echo local --verbose 'quoted text'
+		-eu cd x=1 && export local grep echo "$@" $(pwd) echo printf
+	${HOME} 'quoted text' $(pwd) test awk "$1" "$@" grep
+x=1 export cd "$@" done readonly 'quoted text' "$1" 2>/dev/null &&
+	'quoted text' test "$@"
+	then ${HOME} done && printf sed test awk --verbose echo x=1
+	grep readonly 'quoted text' echo test
+		awk awk && export x=1 then | done sed grep
+local $(pwd) $(pwd) x=1 "$1" 'quoted text'
+		| then echo --verbose 'quoted text'
+		printf readonly --verbose readonly
+test cd -eu 'quoted text' export export "$1" readonly
+	grep sed printf cd done done echo awk cd readonly
+	"$@" done "$@" /usr/bin /usr/bin ${HOME} test 2>/dev/null
+local "$@" "$@" awk echo cd 2>/dev/null awk ${HOME} done
+		grep test local x=1 done ${HOME} done awk readonly | $(pwd) "$@" then readonly
+-eu local sed -eu && x=1 | done
+	'quoted text' && "$1" "$@"
+		"$1" then awk awk 'quoted text'
+	grep cd --verbose echo /usr/bin done --verbose grep done printf --verbose
+	done export sed x=1 echo "$1" printf sed -eu |
+	&& -eu ${HOME} | done x=1 /usr/bin $(pwd) cd sed then then ${HOME}
+		echo 'quoted text' x=1 'quoted text' 2>/dev/null
+	| echo local x=1 && --verbose done then readonly 2>/dev/null grep --verbose --verbose
+'quoted text' x=1 awk --verbose readonly echo -eu awk
+/usr/bin && test readonly test export 'quoted text'
+		export local --verbose ${HOME} && ${HOME} awk printf done grep export
+grep done x=1 --verbose
+	"$@" test echo "$@" 'quoted text'
+	local 2>/dev/null local then --verbose sed "$@" "$1" 2>/dev/null 2>/dev/null echo
+	readonly ${HOME} awk && done readonly
+		$(pwd) echo 'quoted text' test $(pwd) 2>/dev/null cd echo && /usr/bin
+	-eu sed && printf && | ${HOME} cd then
+		| | "$@" done -eu local && 2>/dev/null && "$@" 'quoted text'
+test awk grep readonly -eu -eu readonly sed readonly done done
+		x=1 "$1" awk echo sed | done /usr/bin ${HOME}
+	x=1 $(pwd) done "$@" readonly readonly --verbose 2>/dev/null
+cd /usr/bin -eu $(pwd) export grep done x=1
+sed 'quoted text' grep --verbose readonly "$@" echo
+	x=1 "$1" cd "$1" 2>/dev/null sed sed
+		/usr/bin cd -eu done export && -eu "$1" 'quoted text' printf
+	$(pwd) echo $(pwd) && &&
+		x=1 | /usr/bin -eu done 'quoted text' test ${HOME} local "$@" printf
+-eu awk test cd -eu cd sed "$1" | $(pwd) 2>/dev/null
+grep ${HOME} && 2>/dev/null echo -eu "$1" export awk -eu && cd test --verbose "$@"
+		--verbose "$@" && awk
+	'quoted text' x=1 local x=1 readonly sed 2>/dev/null test echo && readonly
+	printf done --verbose printf "$@"
+	echo echo "$@" x=1 --verbose
+	"$1" x=1 /usr/bin --verbose readonly --verbose test export readonly -eu
+		export | cd local x=1 2>/dev/null "$1" test then -eu awk && /usr/bin
+| echo ${HOME} ${HOME} $(pwd) test awk && "$1" readonly x=1 test -eu
+		grep | export -eu grep then sed then ${HOME} readonly test | cd done --verbose
+sed "$1" 'quoted text' x=1 readonly 'quoted text'
+	sed awk $(pwd) /usr/bin "$1"
+	x=1 cd --verbose printf export "$@" local export export && cd printf
+		echo && readonly then ${HOME} grep sed awk awk "$1" $(pwd) done local --verbose
+-eu sed ${HOME} "$@" done awk printf sed local && awk $(pwd) cd then echo echo /usr/bin
+2>/dev/null $(pwd) x=1 |
+		"$@" export "$@" -eu x=1 then awk then | x=1 "$@" printf
+	sed 2>/dev/null test sed printf then -eu /usr/bin local
+/usr/bin cd cd /usr/bin | awk | done x=1 $(pwd) | -eu readonly
+		${HOME} ${HOME} | 'quoted text'
+		&& "$1" "$1" echo echo 2>/dev/null /usr/bin 2>/dev/null
+	x=1 'quoted text' $(pwd) "$@" $(pwd) 'quoted text' echo test awk
+	"$1" x=1 /usr/bin | export ${HOME} printf test awk 'quoted text' printf "$1"
+		cd && /usr/bin printf cd export 'quoted text' sed export
+		x=1 $(pwd) /usr/bin readonly test x=1 /usr/bin printf done
+export -eu cd "$1" cd 2>/dev/null then -eu /usr/bin "$@" x=1 local 'quoted text'
+export ${HOME} && "$1" printf --verbose done readonly
+export printf cd echo $(pwd) 'quoted text' echo
+	export x=1 --verbose ${HOME} && printf --verbose
+cd 'quoted text' awk | sed --verbose $(pwd) ${HOME} export
+sed | then /usr/bin | -eu test export local $(pwd) 'quoted text' readonly
+		&& printf 'quoted text' readonly printf "$@"
+		${HOME} x=1 /usr/bin "$@" cd test
+	readonly export grep grep | grep "$@" 2>/dev/null export 'quoted text'
+	"$@" printf local --verbose
+	sed --verbose test export test then x=1 done cd test sed | --verbose
+		local cd echo cd then "$1" -eu local "$1" done awk && echo done echo && 2>/dev/null
+	then 'quoted text' x=1 then 'quoted text' export readonly
+x=1 && ${HOME} ${HOME} awk awk printf cd $(pwd) 'quoted text' then
+		$(pwd) sed then 'quoted text' /usr/bin awk /usr/bin -eu test grep
+		/usr/bin export 'quoted text' "$@" "$@" | && x=1 grep && /usr/bin --verbose local
+--verbose test -eu then /usr/bin 2>/dev/null
+	x=1 "$1" echo printf test $(pwd) ${HOME} "$1" 'quoted text' echo | $(pwd)
+| then 2>/dev/null 'quoted text'
+		&& grep test done grep sed && 2>/dev/null echo awk ${HOME} /usr/bin readonly
+	echo grep x=1 -eu then grep test $(pwd) cd
+		export local export sed "$1" -eu x=1 awk awk then 'quoted text'
+	&& local /usr/bin ${HOME} local done 2>/dev/null
+	${HOME} done done ${HOME} local "$1" grep "$1" x=1 'quoted text'
+		local printf awk "$@" && 'quoted text'
+	sed 2>/dev/null done printf grep test done
+		/usr/bin readonly /usr/bin readonly local then cd awk 'quoted text' grep done awk
+		then -eu echo --verbose grep | done ${HOME} printf awk -eu
+"$@" ${HOME} /usr/bin printf "$1" cd readonly cd readonly local | local /usr/bin
+"$@" "$1" -eu --verbose printf 2>/dev/null awk
+sed -eu 'quoted text' readonly test done --verbose then printf export echo 2>/dev/null
+local | readonly $(pwd)
+${HOME} 2>/dev/null | printf export | then
+2>/dev/null grep /usr/bin "$1" then then
+		x=1 -eu 2>/dev/null then test done "$@" grep --verbose
+	--verbose test awk && cd printf cd
+${HOME} "$1" readonly | awk cd cd --verbose readonly "$@" then
+/usr/bin "$1" ${HOME} ${HOME} x=1 $(pwd) ${HOME} printf "$@" sed printf -eu
+"$@" --verbose $(pwd) readonly
+done "$1" grep x=1 "$1" /usr/bin "$@" local printf -eu -eu && then
+		echo ${HOME} x=1 x=1 printf "$@" "$1" awk | --verbose
+export -eu $(pwd) 'quoted text' then | test x=1 2>/dev/null
+		sed sed test ${HOME} grep local grep local grep -eu ${HOME} done test printf
+		local cd sed readonly ${HOME} local done -eu --verbose echo ${HOME}
+	'quoted text' 'quoted text' "$@"
+		--verbose readonly printf 2>/dev/null -eu ${HOME}
+	'quoted text' 'quoted text' ${HOME} --verbose /usr/bin x=1 2>/dev/null readonly
+	grep test "$@" -eu then | /usr/bin export /usr/bin then
+	echo echo -eu grep /usr/bin
+printf sed -eu $(pwd) 2>/dev/null cd export
+	awk && 2>/dev/null | then grep printf readonly printf test then
+$(pwd) && x=1 export echo -eu readonly local grep /usr/bin x=1 grep -eu echo cd
+$(pwd) /usr/bin export sed ${HOME} done test && test readonly then echo x=1
+		&& test awk "$@" 'quoted text'
+		"$@" sed /usr/bin "$1" "$@" -eu awk sed
+		printf readonly -eu done readonly test done
+	echo readonly readonly "$1" grep --verbose
+		&& ${HOME} $(pwd) cd printf ${HOME} echo && local
+	"$1" then cd sed export --verbose awk printf then $(pwd) ${HOME}
+test sed /usr/bin export && grep export test test
+2>/dev/null test printf && $(pwd) echo sed awk ${HOME} printf 'quoted text' grep
+	x=1 'quoted text' "$1" /usr/bin
+		--verbose done --verbose $(pwd) "$@" --verbose
+		"$@" done -eu | done ${HOME} grep $(pwd)
+2>/dev/null grep x=1 readonly local export printf /usr/bin --verbose
+		grep export test cd /usr/bin ${HOME} 2>/dev/null export printf then
+-eu echo cd x=1 then done "$1"
+		cd sed "$@" && ${HOME} awk grep --verbose local --verbose
+		${HOME} readonly grep 'quoted text'
+awk awk 'quoted text' local && done
+	done | readonly printf echo local "$1" -eu awk "$1" readonly grep readonly ${HOME}
+	done printf "$1" ${HOME} grep "$@" test "$@" 2>/dev/null awk
+${HOME} awk sed --verbose test readonly -eu local "$1" awk
+		2>/dev/null 'quoted text' "$1" -eu --verbose sed ${HOME} export x=1 --verbose 'quoted text'
+done 2>/dev/null grep | printf ${HOME} /usr/bin echo 2>/dev/null
+	then done echo readonly "$1" $(pwd)
+	| done then $(pwd) awk then cd test echo export
+		cd readonly echo && --verbose
+2>/dev/null $(pwd) | ${HOME} "$@" /usr/bin ${HOME}
+echo 2>/dev/null cd $(pwd) local && sed $(pwd) "$1" -eu echo -eu readonly
+		readonly test awk | then "$@" test sed local | && x=1 ${HOME}
+	sed ${HOME} 2>/dev/null
+	| 'quoted text' test $(pwd) 'quoted text' "$@" grep awk -eu && ${HOME}
+"$@" $(pwd) sed && $(pwd) cd grep grep
+	cd $(pwd) && export test echo ${HOME} then /usr/bin /usr/bin ${HOME}
+	${HOME} "$1" && 2>/dev/null ${HOME}
+'quoted text' test printf test local grep readonly
+grep -eu | test cd 2>/dev/null
+export printf grep "$@" | 'quoted text' sed | readonly cd cd 2>/dev/null
+		"$1" test | /usr/bin echo ${HOME} done echo /usr/bin
+		readonly readonly x=1 $(pwd) local export echo then export -eu export sed test
+		done test "$@" local printf
+		-eu "$1" cd awk --verbose x=1 -eu cd
+		2>/dev/null $(pwd) export
+	grep /usr/bin /usr/bin printf
+2>/dev/null 'quoted text'
+local $(pwd) export && local done sed | grep 'quoted text' export sed --verbose
+		echo test grep done local printf -eu awk 'quoted text'
+		--verbose | "$1" -eu test cd x=1 --verbose --verbose
+cd local ${HOME} export
+&& $(pwd) x=1 "$@" awk echo
+--verbose then then printf --verbose -eu grep readonly
+	2>/dev/null 2>/dev/null readonly cd | "$@" --verbose cd
+"$1" printf readonly -eu | sed awk local then
+&& -eu x=1 test /usr/bin -eu export then echo cd 2>/dev/null
+then awk printf printf ${HOME} x=1 -eu /usr/bin -eu "$1" test
+		done && --verbose local echo --verbose local test $(pwd) awk /usr/bin "$@"
+	echo | sed awk $(pwd)
+	grep "$@" done /usr/bin readonly echo ${HOME} 2>/dev/null
+&& x=1 done ${HOME} printf ${HOME} awk test readonly x=1 done
+| ${HOME} cd sed && readonly | -eu 2>/dev/null then ${HOME} then export "$1" echo
+		then local $(pwd) test grep "$1" /usr/bin
+&& awk grep export "$@" --verbose ${HOME}
+	done echo -eu -eu && ${HOME} sed
+	x=1 "$1" export then export "$1" 'quoted text' 'quoted text' 2>/dev/null && cd -eu
+		2>/dev/null local && "$@" 'quoted text'
+	local done 'quoted text' ${HOME} "$1" readonly export echo awk test
+		awk $(pwd) x=1 x=1 'quoted text' then -eu awk $(pwd) 2>/dev/null readonly
+	&& "$@" 2>/dev/null && echo
+	&& x=1 x=1 /usr/bin --verbose
+		echo "$1" export x=1 printf "$@" 2>/dev/null "$@"
+		x=1 | -eu then done && "$@" "$@" && local readonly "$@" sed
+cd done && echo "$@" "$1"
+local awk "$1" && 2>/dev/null local -eu printf
+echo test awk ${HOME} x=1 done awk awk
+	-eu then done ${HOME} /usr/bin
+	local sed --verbose "$@" 'quoted text' /usr/bin
+	readonly "$@" 2>/dev/null -eu --verbose 'quoted text' "$1" done && done
+grep | export awk "$@" ${HOME} test
+awk --verbose "$@" | "$@"
+	${HOME} printf --verbose && | "$@" echo cd then done
+test 2>/dev/null awk 2>/dev/null
+		echo 2>/dev/null done 'quoted text'
+		then 'quoted text' x=1 cd 2>/dev/null "$1" 2>/dev/null then then /usr/bin ${HOME}
+test echo done "$@" done local echo x=1
+	/usr/bin /usr/bin -eu awk "$1" sed sed local local
+	done --verbose && 2>/dev/null && done | sed
+		awk sed readonly /usr/bin echo sed awk readonly
+		2>/dev/null cd | -eu 'quoted text'
+	"$1" $(pwd) 'quoted text' --verbose done -eu /usr/bin ${HOME} "$@" cd grep 2>/dev/null
+2>/dev/null ${HOME} x=1 x=1 readonly "$@" /usr/bin
+	| $(pwd) test grep echo echo awk && --verbose && "$1" readonly local $(pwd)
+	'quoted text' sed "$1" cd "$1" sed done | awk "$@" readonly
+readonly 2>/dev/null | local test --verbose sed grep printf cd 2>/dev/null 'quoted text'
+readonly then "$1" --verbose && | "$1" sed x=1 "$1" awk readonly x=1
+		${HOME} 'quoted text' "$1" grep 2>/dev/null
+		-eu grep echo then readonly --verbose
+grep 2>/dev/null "$1" readonly cd /usr/bin $(pwd) "$1" x=1 printf | "$1" | "$@"
+	test test sed test sed sed awk then --verbose readonly 2>/dev/null 2>/dev/null
+'quoted text' printf local "$@" export x=1 grep -eu -eu local 2>/dev/null
+'quoted text' "$1" echo cd | echo 'quoted text' | echo --verbose /usr/bin
+awk export local awk local 2>/dev/null 2>/dev/null x=1 echo done test --verbose
+	export local x=1 printf "$@" -eu cd readonly
+2>/dev/null | && "$@" $(pwd)
+		&& cd --verbose ${HOME} grep
+		'quoted text' grep 'quoted text' test "$1" x=1 2>/dev/null --verbose $(pwd)
+	&& && && printf /usr/bin echo 2>/dev/null
+		readonly "$@" --verbose /usr/bin && "$1" readonly ${HOME} grep
+		grep grep x=1 -eu 2>/dev/null && "$1" grep /usr/bin
+printf awk test "$@" then awk local cd --verbose cd
+	sed sed x=1 "$1" $(pwd) export 'quoted text' -eu /usr/bin test local ${HOME}
+		then /usr/bin local 2>/dev/null
+		"$@" $(pwd) readonly local then
+		--verbose awk ${HOME} "$@" then
+x=1 grep test sed | ${HOME} 2>/dev/null
+cd readonly "$@" printf readonly
+		x=1 "$1" local | ${HOME} done export -eu then
+"$@" "$@" /usr/bin awk /usr/bin 2>/dev/null
+&& echo printf 'quoted text' $(pwd) grep export test "$1" printf printf
+then 'quoted text' sed -eu $(pwd) then grep 'quoted text'
+		local then "$@" ${HOME} "$@" export
+/usr/bin export test -eu export cd sed readonly
+	$(pwd) x=1 ${HOME} test export /usr/bin then grep -eu
+echo sed 2>/dev/null export |
+		--verbose "$@" --verbose
+		awk 'quoted text' --verbose echo 2>/dev/null awk local
+grep printf test then | then
+done 'quoted text' grep printf && 2>/dev/null echo /usr/bin x=1 && local
+x=1 /usr/bin /usr/bin | "$1"
+	| $(pwd) $(pwd) "$1" "$@" ${HOME}
+		x=1 echo "$@" local "$@" export readonly -eu test echo test 2>/dev/null && 2>/dev/null
+2>/dev/null then && "$1" 2>/dev/null --verbose $(pwd) printf
+		test export grep "$@" cd export "$@" | test printf grep | ${HOME} | grep --verbose
+"$1" grep "$@" -eu 'quoted text' printf then test export test readonly
+	local local -eu test done grep awk readonly echo
+x=1 -eu "$@" printf --verbose test
+		grep then 2>/dev/null
+/usr/bin readonly && cd $(pwd) --verbose 2>/dev/null sed readonly export $(pwd)
+printf grep printf echo readonly echo test $(pwd) "$1" done test --verbose /usr/bin
+	printf $(pwd) /usr/bin $(pwd) cd 'quoted text' grep awk readonly
+		2>/dev/null ${HOME} local && then cd "$@" printf printf -eu
+echo $(pwd) 2>/dev/null readonly
+		sed "$@" cd printf done awk done x=1 2>/dev/null
+		$(pwd) then x=1 readonly awk "$@" -eu export "$1" printf 'quoted text'
+	| test 'quoted text' 'quoted text' then 'quoted text' "$@"
+grep && --verbose "$@" readonly
+	| awk -eu $(pwd) then export | printf
+		x=1 echo --verbose $(pwd) ${HOME} readonly 'quoted text' --verbose
+then readonly done | 'quoted text' then "$1" | sed $(pwd)
+done sed sed local done done
+		cd sed 'quoted text' awk test -eu ${HOME} awk awk grep cd /usr/bin then | "$@"
+	readonly awk grep --verbose then then grep export
+	$(pwd) $(pwd) /usr/bin -eu && printf readonly
+	echo grep test done 2>/dev/null grep "$1" awk sed test
+export sed awk x=1 then sed
+		${HOME} "$1" | | test ${HOME} grep awk export awk then | then local "$1" --verbose
+/usr/bin -eu 2>/dev/null ${HOME} | test --verbose --verbose
+		/usr/bin /usr/bin ${HOME} cd && then -eu sed --verbose -eu cd cd "$1"
+	then /usr/bin sed export sed local -eu --verbose readonly
+| done ${HOME} && echo -eu
+	${HOME} printf && x=1 test --verbose
+	2>/dev/null readonly "$1" "$@" ${HOME} ${HOME} ${HOME} local export
+&& echo then 2>/dev/null -eu "$@" /usr/bin -eu ${HOME} sed
+		grep 'quoted text' ${HOME} &&
+awk cd /usr/bin printf
+	&& 'quoted text' local -eu "$1" ${HOME} sed /usr/bin sed test --verbose 'quoted text'
+		awk grep awk x=1 | ${HOME} test awk
+		printf ${HOME} export awk test | echo done done
+	--verbose cd done && cd "$@" sed sed
+		local export --verbose $(pwd) x=1 'quoted text' x=1 | -eu &&
+	/usr/bin | && | printf "$@" /usr/bin ${HOME} awk
+		x=1 ${HOME} awk "$@" "$1" 2>/dev/null --verbose "$@"
+	export awk && sed local sed awk "$1" then x=1 export awk local readonly
+		then && cd && printf readonly ${HOME} | test readonly $(pwd) sed printf --verbose
+	cd && | --verbose x=1 local -eu test done "$@" --verbose
+done "$1" 2>/dev/null $(pwd)
+printf test grep echo x=1 /usr/bin 'quoted text'
+	echo -eu ${HOME} done && readonly "$1"
+		local echo printf sed
+echo export 'quoted text' --verbose /usr/bin grep test done
+local "$@" printf export grep then --verbose --verbose "$@" local $(pwd)
+		local -eu && then | /usr/bin && /usr/bin
+		$(pwd) readonly | && | -eu sed awk test grep --verbose test
+&& local && --verbose -eu --verbose export sed
+cd sed sed test readonly then sed echo awk cd grep /usr/bin /usr/bin
+	cd sed --verbose "$1" && x=1 local export export -eu printf test
+test cd test $(pwd) 2>/dev/null test readonly cd 'quoted text' --verbose
+printf "$@" "$1" | readonly | local readonly /usr/bin then "$@" -eu
+x=1 awk 2>/dev/null then /usr/bin export
+$(pwd) ${HOME} sed "$1" | "$1" && | grep x=1 --verbose
+		x=1 ${HOME} local | x=1 export /usr/bin 'quoted text' /usr/bin && local
+	sed readonly test 'quoted text'
+done awk printf echo local $(pwd) "$1" test cd && | $(pwd) ${HOME} ${HOME}
+"$1" | sed && cd ${HOME} local /usr/bin export readonly awk -eu
+		-eu ${HOME} done $(pwd)
+		sed printf export sed grep --verbose then -eu 'quoted text'
+	| && test grep -eu && /usr/bin local export | test $(pwd) --verbose cd printf
+echo | then local echo awk then grep && then "$@" x=1 /usr/bin
+		&& --verbose readonly then
+'quoted text' printf printf
+		"$@" "$1" | 2>/dev/null cd then export 'quoted text' awk
+	-eu -eu local test then
+printf x=1 'quoted text' ${HOME} $(pwd) --verbose /usr/bin
+	&& 'quoted text' local test cd --verbose then && -eu cd done
+		$(pwd) "$1" test readonly 'quoted text' -eu | local done $(pwd) ${HOME}
+	done done done printf "$@" -eu local export /usr/bin ${HOME}
+$(pwd) | $(pwd) ${HOME} awk test grep && grep "$1"
+		-eu | test x=1 x=1 then x=1 "$1"
+	echo -eu export --verbose $(pwd) 2>/dev/null export
+	done 'quoted text' echo grep | --verbose awk --verbose done local --verbose
+/usr/bin then sed echo done local "$@" test grep sed
+readonly /usr/bin /usr/bin /usr/bin 2>/dev/null | awk ${HOME}
+cd printf printf grep /usr/bin readonly | 'quoted text' ${HOME} && grep
+		"$@" "$@" printf 2>/dev/null
+	printf echo done | /usr/bin | local ${HOME} cd then cd && /usr/bin
+then $(pwd) export --verbose x=1 cd test awk && /usr/bin "$@"
+		-eu awk printf 'quoted text' 2>/dev/null ${HOME} printf ${HOME} "$@" sed
+local readonly done done $(pwd) awk sed ${HOME} test local /usr/bin
+	cd | local x=1 printf printf /usr/bin test readonly
+x=1 x=1 "$@" | /usr/bin x=1 $(pwd) done readonly
+		done cd awk local sed 2>/dev/null echo cd done
+		export done "$@" /usr/bin printf --verbose local ${HOME} done "$1"
+		printf export done local -eu sed ${HOME} sed cd awk ${HOME} cd "$@" grep
+	printf export cd && /usr/bin printf
+x=1 x=1 then readonly ${HOME} sed | test
+		| && test grep && 2>/dev/null
+"$@" $(pwd) "$1" printf awk export grep done done 2>/dev/null
+	2>/dev/null && x=1 'quoted text' test test
+	$(pwd) readonly then -eu awk | then local test then awk local && awk echo cd awk
+	&& "$1" "$1" grep echo x=1 /usr/bin 2>/dev/null cd cd grep export && && -eu readonly
+		$(pwd) --verbose --verbose printf test --verbose /usr/bin
+printf && grep echo export sed local local echo -eu -eu "$@" readonly export
+		printf 'quoted text' printf 2>/dev/null && sed x=1 test /usr/bin /usr/bin
+		"$@" /usr/bin -eu cd /usr/bin "$1" x=1 echo $(pwd) grep awk $(pwd) "$@" cd
+-eu | /usr/bin cd && ${HOME}
+		grep local | readonly -eu readonly x=1 cd grep 'quoted text' then local && /usr/bin
+--verbose $(pwd) /usr/bin cd
+echo cd echo sed sed cd test test /usr/bin awk grep echo -eu readonly
+then 2>/dev/null 'quoted text' 'quoted text' then printf -eu printf
+	$(pwd) x=1 done echo readonly cd 2>/dev/null printf | $(pwd) cd "$1" local
+local grep done --verbose then
+	${HOME} awk test x=1 "$@" cd echo -eu 2>/dev/null -eu
+		test x=1 /usr/bin sed /usr/bin
+	$(pwd) done 'quoted text' test $(pwd) sed readonly echo export
+	2>/dev/null | awk export ${HOME}
+$(pwd) local awk $(pwd) -eu sed local x=1 local echo
+		x=1 /usr/bin done done then --verbose "$1" x=1 grep readonly
+	-eu readonly x=1 "$@" "$@" "$@" "$1"
+sed && done export "$@" 2>/dev/null then 2>/dev/null
+	2>/dev/null 'quoted text' sed --verbose
+	$(pwd) -eu 2>/dev/null --verbose x=1 && $(pwd) grep printf test 2>/dev/null
+-eu && "$1" readonly x=1 test /usr/bin printf
+		sed 2>/dev/null echo sed 2>/dev/null done && done cd 2>/dev/null printf "$@" test
+export -eu readonly echo printf ${HOME} sed
+		/usr/bin 2>/dev/null test --verbose
+&& | then echo 2>/dev/null | then
+		"$@" 'quoted text' "$1" done export && 2>/dev/null printf local done
+	echo then printf 'quoted text'
+		"$1" done -eu ${HOME} readonly echo --verbose
+	&& export x=1 readonly ${HOME} test echo ${HOME}
+| 'quoted text' sed echo /usr/bin -eu readonly | $(pwd) test grep echo "$@" "$@"
+		2>/dev/null "$1" -eu --verbose readonly
+		done | sed test | ${HOME} grep local && awk ${HOME}
+x=1 printf cd /usr/bin ${HOME}
+		grep --verbose 'quoted text' done printf && 2>/dev/null
+grep | cd "$1" readonly then echo && -eu ${HOME} && echo -eu cd awk 2>/dev/null
+		readonly /usr/bin "$@" 'quoted text' readonly 'quoted text' && readonly cd
+local sed -eu then $(pwd) readonly 'quoted text' 2>/dev/null grep export echo printf
+		"$@" then sed --verbose --verbose readonly $(pwd) grep x=1 --verbose
+	export grep export sed echo then
+	done done && ${HOME} --verbose awk printf
+--verbose printf --verbose
+	"$@" ${HOME} sed readonly "$@" x=1
+&& ${HOME} sed 2>/dev/null then then --verbose "$1" awk $(pwd)
+		-eu 2>/dev/null && 2>/dev/null
+		done "$1" ${HOME} "$1" -eu $(pwd) --verbose x=1 test
+-eu test "$@" echo 2>/dev/null 'quoted text' echo /usr/bin
+'quoted text' 'quoted text'
+'quoted text' test echo $(pwd)
+readonly then --verbose done $(pwd) test $(pwd) echo
+		awk $(pwd) grep | echo export x=1 printf echo -eu
+		2>/dev/null done export sed grep 'quoted text' export
+printf ${HOME} export readonly x=1 x=1 grep then
+printf "$@" 2>/dev/null printf export readonly -eu local
+${HOME} readonly export -eu sed "$1"
+readonly local echo "$@" -eu 'quoted text' $(pwd) test && local x=1
+		2>/dev/null awk && done then && test
+		$(pwd) "$@" local /usr/bin
+readonly 2>/dev/null printf grep && local "$1" "$1" then
+readonly $(pwd) $(pwd) /usr/bin 2>/dev/null test -eu
+2>/dev/null "$1" /usr/bin -eu -eu x=1 "$@" cd local && cd $(pwd)
+cd $(pwd) local export 'quoted text' cd ${HOME} -eu -eu
+done then --verbose && sed grep ${HOME} $(pwd) then export done --verbose
+		$(pwd) test ${HOME} test ${HOME}
+	/usr/bin test export ${HOME} grep echo "$@" echo then 'quoted text' test done
+'quoted text' done $(pwd) && 'quoted text'
+${HOME} awk sed --verbose printf /usr/bin --verbose done -eu | awk --verbose
+printf test awk awk sed x=1 | printf "$1"
+		'quoted text' cd ${HOME} readonly "$1" printf grep && cd
+	cd | readonly "$@" awk -eu ${HOME} ${HOME} --verbose export
+		-eu x=1 | then cd readonly
+	-eu /usr/bin export export done
+	"$@" 'quoted text' "$@" 2>/dev/null
+	export grep x=1 $(pwd) sed awk cd "$1" /usr/bin 'quoted text' -eu
+readonly ${HOME} readonly done /usr/bin /usr/bin ${HOME} test $(pwd)
+		grep cd "$@" 'quoted text' test
+		--verbose ${HOME} grep cd "$1" &&
+		cd then cd | ${HOME} && ${HOME} echo | "$1" -eu done export 2>/dev/null
+		| | then ${HOME} -eu 'quoted text' cd $(pwd)
+&& echo x=1 sed test cd sed ${HOME} "$@" -eu echo readonly then awk sed echo x=1
+echo --verbose readonly ${HOME} "$@" $(pwd) sed awk | -eu --verbose sed
+	&& "$@" readonly then $(pwd) awk 'quoted text' /usr/bin "$@" awk
+2>/dev/null && ${HOME} "$1" grep "$@" && | readonly
+-eu /usr/bin printf export test "$1" printf 'quoted text' readonly ${HOME}
+		then echo 2>/dev/null ${HOME} 2>/dev/null "$@"
+'quoted text' 'quoted text' echo 'quoted text'
+	printf /usr/bin readonly
+then test awk done sed
+	echo cd x=1 readonly printf 2>/dev/null
+local grep | -eu echo
+	done local && /usr/bin done -eu 'quoted text' local | $(pwd) --verbose --verbose
+done 'quoted text' $(pwd) --verbose | --verbose cd $(pwd) /usr/bin
+		readonly | -eu readonly echo test then --verbose
+export cd --verbose "$@" export
+		export echo -eu 'quoted text' then --verbose
+	test -eu printf && then cd --verbose test "$1"
@@ -0,0 +1,2001 @@
+	export ${HOME} then x=1 "$1" 'quoted text' 'quoted text'
+		x=1 done done && x=1 test grep done
+	readonly && | sed local sed echo
+local done 'quoted text' --verbose sed "$1"
+	| echo /usr/bin readonly $(pwd) echo
+	sed "$@" export test echo --verbose && readonly
+	2>/dev/null grep cd awk then cd
+&& cd "$1" test -eu echo test $(pwd) then /usr/bin then local -eu -eu test
+	export ${HOME} echo cd sed echo 'quoted text' sed "$@"
+${HOME} 'quoted text' && done | "$1" readonly
+	readonly 'quoted text' local x=1 "$1" export sed $(pwd) -eu export
+2>/dev/null | x=1 awk readonly 'quoted text' ${HOME} x=1
+		$(pwd) "$@" readonly export ${HOME} grep grep && --verbose test
+"$1" readonly ${HOME} grep /usr/bin readonly x=1 x=1 export --verbose
+		/usr/bin x=1 x=1 && local grep x=1 done /usr/bin | local cd "$1" 2>/dev/null
+		awk export x=1 2>/dev/null /usr/bin grep $(pwd) grep ${HOME} printf
+		readonly then then printf 'quoted text' 'quoted text' export
+		&& "$1" awk "$1" /usr/bin -eu local done "$1" export test $(pwd) 'quoted text'
+$(pwd) awk "$1" /usr/bin 2>/dev/null ${HOME} --verbose
+done test /usr/bin "$@" ${HOME} "$@" export local then "$@" $(pwd) x=1 ${HOME}
+		export /usr/bin printf done
+		'quoted text' test printf "$@" "$1"
+	'quoted text' ${HOME} readonly
+		${HOME} test -eu awk export x=1 cd $(pwd) $(pwd) awk "$1"
+		printf printf export -eu local grep readonly "$1" | $(pwd) then 'quoted text'
+		echo test 2>/dev/null grep && export
+sed x=1 grep -eu && cd awk && /usr/bin 2>/dev/null x=1 export 'quoted text'
+	&& done /usr/bin grep grep --verbose | && printf
+	&& readonly "$@" --verbose then
+		test grep grep cd 'quoted text' then export && echo "$1" --verbose sed &&
+		-eu 2>/dev/null && -eu -eu && cd
+test x=1 "$@" cd awk local then cd "$1" awk | done test cd test
+	sed readonly | "$1" ${HOME} readonly && "$1" /usr/bin "$@"
+		cd grep cd $(pwd) && 2>/dev/null ${HOME} test | /usr/bin export awk echo --verbose
+		readonly awk "$1" --verbose 'quoted text' sed -eu then ${HOME} export
+/usr/bin /usr/bin then local $(pwd) ${HOME}
+	"$@" grep | sed echo printf --verbose sed $(pwd) then test
+&& test -eu echo printf grep --verbose readonly 2>/dev/null
+		2>/dev/null 2>/dev/null done grep &&
+	--verbose grep --verbose --verbose export && then readonly awk test && then /usr/bin
+grep "$@" done grep && x=1 readonly echo
+'quoted text' --verbose done "$1" export -eu local /usr/bin
+	readonly --verbose printf ${HOME} 2>/dev/null cd printf
+	"$1" --verbose grep /usr/bin 'quoted text' | echo /usr/bin awk "$@" export
+	grep echo "$1" then awk grep local -eu "$@" "$@" 'quoted text' 'quoted text'
+		then "$@" grep then | test cd 2>/dev/null readonly "$1" local -eu
+/usr/bin echo 'quoted text' sed 2>/dev/null -eu "$@"
+		sed --verbose 2>/dev/null awk readonly printf /usr/bin local 'quoted text'
+	&& "$@" awk 'quoted text' export then
+--verbose readonly test test "$1" "$@" /usr/bin "$@" awk 2>/dev/null
+		--verbose test --verbose echo --verbose 2>/dev/null $(pwd) sed
+	"$1" readonly -eu export | cd cd /usr/bin grep done &&
+		&& local /usr/bin && x=1
+		'quoted text' printf | "$1" ${HOME} awk | grep export grep
+		--verbose --verbose && grep
+	export done local $(pwd) -eu ${HOME} 'quoted text' 'quoted text'
+${HOME} done 'quoted text'
+		sed $(pwd) readonly done x=1 sed 'quoted text' 'quoted text' sed echo ${HOME} 2>/dev/null
+&& done ${HOME} $(pwd) local readonly --verbose x=1 /usr/bin grep
+	sed sed then grep grep local "$1" x=1 2>/dev/null "$1" sed local cd export then
+	test --verbose test -eu awk && 2>/dev/null local 2>/dev/null -eu "$@" | 'quoted text'
+	-eu 2>/dev/null awk echo --verbose
+	${HOME} then then -eu echo cd grep echo x=1 x=1 -eu ${HOME}
+		export sed done --verbose
+	test readonly "$@" readonly then then 'quoted text'
+	&& | then export export | test 'quoted text' 2>/dev/null 2>/dev/null export
+printf grep "$@" -eu /usr/bin /usr/bin 'quoted text' "$1" local $(pwd)
+${HOME} then then echo awk
+	local grep 2>/dev/null export awk x=1 "$1" /usr/bin export | export "$1" export
+		x=1 ${HOME} "$@" ${HOME} grep ${HOME} && "$1" grep /usr/bin ${HOME}
+readonly -eu printf | printf
+x=1 export cd "$@" printf printf grep grep --verbose "$@"
+cd --verbose readonly
+		printf grep cd test "$1" sed 2>/dev/null test ${HOME} && "$1" sed then
+		readonly --verbose /usr/bin echo awk | ${HOME} cd cd
+printf done export export | cd local cd x=1 2>/dev/null "$1"
+		sed test --verbose export local local sed done cd ${HOME} | 'quoted text'
+	/usr/bin cd sed x=1 export grep ${HOME} local --verbose | awk &&
+	"$1" done -eu $(pwd) readonly test | export | printf awk readonly x=1
+done cd awk grep && echo 'quoted text' /usr/bin readonly export test
+		$(pwd) awk 2>/dev/null local
+	2>/dev/null --verbose
+	2>/dev/null 2>/dev/null printf cd cd "$@"
+grep "$@" && grep && local "$@" ${HOME} ${HOME} | $(pwd)
+	local echo cd then -eu 2>/dev/null
+/usr/bin /usr/bin test done | ${HOME} --verbose
+then printf sed -eu ${HOME} "$1"
+	2>/dev/null awk 'quoted text' 'quoted text' 'quoted text'
+	--verbose local done local done $(pwd)
+	then local && cd && sed --verbose /usr/bin awk ${HOME} && grep
+	then cd done "$@" export --verbose
+"$@" "$1" cd printf done x=1 echo -eu
+awk cd 'quoted text' -eu local /usr/bin then readonly
+	awk then $(pwd) echo export done echo | readonly export cd local | then /usr/bin
+	"$@" sed /usr/bin $(pwd) /usr/bin "$@" | 'quoted text'
+		/usr/bin 'quoted text' printf && /usr/bin sed --verbose
+	| "$@" 'quoted text' ${HOME} echo then printf /usr/bin
+		'quoted text' | awk cd local | 2>/dev/null
+	done local 'quoted text' then $(pwd) test awk cd grep /usr/bin
+then "$1" ${HOME} printf awk 'quoted text' grep echo sed test |
+		$(pwd) "$1" local 2>/dev/null local test
+	awk 'quoted text' 2>/dev/null
+sed done echo --verbose local
+		x=1 -eu x=1 then echo --verbose sed test | --verbose ${HOME}
+readonly | done -eu readonly
+cd x=1 echo $(pwd) test local printf done test readonly readonly done 'quoted text'
+		| | 2>/dev/null && && 2>/dev/null cd sed && "$1" local x=1 awk local "$@"
+		export -eu sed printf $(pwd) --verbose x=1
+grep -eu readonly awk "$@" sed done readonly local
+		/usr/bin /usr/bin /usr/bin local grep -eu | done
+		--verbose && $(pwd) 'quoted text' /usr/bin sed $(pwd) /usr/bin "$@"
+awk "$1" x=1 then "$@" export | "$1" x=1 && --verbose
+grep 2>/dev/null 'quoted text' /usr/bin $(pwd) --verbose echo && readonly readonly
+$(pwd) sed cd sed cd "$1" "$1" && "$1" done $(pwd)
+		sed readonly awk grep
+	printf export echo /usr/bin cd "$@" | "$@" readonly
+export grep | export grep x=1 local &&
+	--verbose echo | local export export $(pwd) --verbose | x=1 test awk grep
+		&& test ${HOME} "$@" local export "$@" local test --verbose
+	printf && local ${HOME} 'quoted text' /usr/bin 2>/dev/null
+		printf $(pwd) 'quoted text' /usr/bin grep $(pwd) local
+		'quoted text' "$@" | $(pwd) sed 'quoted text'
+		$(pwd) awk export cd x=1 test readonly 2>/dev/null
+		echo --verbose then -eu x=1 local sed cd awk 2>/dev/null printf
+		--verbose sed 'quoted text' awk readonly local sed "$1" done readonly local
+		/usr/bin ${HOME} readonly
+x=1 printf /usr/bin x=1 && 'quoted text'
+readonly "$@" | && | cd /usr/bin printf
+	local then && -eu test readonly then then readonly 'quoted text' readonly
+	grep export 2>/dev/null /usr/bin done 'quoted text' then sed test --verbose
+		then ${HOME} local then export test sed
+		"$1" x=1 "$1" /usr/bin | | 2>/dev/null
+local printf -eu "$1" test -eu awk export echo x=1 ${HOME} "$1" $(pwd) "$@"
+${HOME} /usr/bin sed grep readonly grep --verbose done cd $(pwd) awk -eu cd /usr/bin
+	"$1" export echo $(pwd) 2>/dev/null -eu export export --verbose ${HOME}
+		${HOME} grep readonly | readonly "$@"
+		export "$@" /usr/bin --verbose "$1" then export
+readonly 2>/dev/null --verbose --verbose done echo -eu readonly grep
+	done test 'quoted text' 2>/dev/null x=1 /usr/bin done "$@" sed
+	echo local export export cd
+-eu echo local export --verbose export 2>/dev/null
+		printf x=1 test x=1 cd export done /usr/bin printf &&
+cd grep x=1 /usr/bin done cd
+	sed && "$1" test 'quoted text' "$1" "$1" test $(pwd) grep awk x=1 cd 'quoted text'
+	readonly cd --verbose done grep x=1 printf "$@" awk then readonly awk /usr/bin
+		readonly grep --verbose grep $(pwd)
+		grep readonly then grep "$@" "$@" -eu && local
+	--verbose ${HOME} -eu | $(pwd) sed | grep sed /usr/bin printf test && test 'quoted text'
+	sed done "$@" 2>/dev/null cd
+		| sed grep echo 2>/dev/null ${HOME} "$1" "$1" /usr/bin /usr/bin 'quoted text'
+-eu done "$@" | ${HOME} cd readonly && done done
+		test test /usr/bin printf -eu x=1 /usr/bin then | then -eu echo grep cd ${HOME}
+done grep echo -eu --verbose -eu && x=1 export "$1"
+"$1" | awk then | sed 2>/dev/null grep awk && done done 2>/dev/null $(pwd)
+--verbose printf done | && /usr/bin grep --verbose
+	"$1" $(pwd) cd --verbose 2>/dev/null local echo export printf echo
+		then awk $(pwd) export local sed
+		x=1 -eu 2>/dev/null cd && x=1 x=1 printf done printf
+		printf grep done test then --verbose 'quoted text' test
+		readonly local ${HOME} 2>/dev/null printf "$@" 2>/dev/null -eu ${HOME}
+test -eu --verbose local | awk 'quoted text' printf cd local done awk
+readonly /usr/bin 2>/dev/null done $(pwd) done 2>/dev/null "$1"
+	test --verbose awk -eu local | local
+	grep readonly x=1 $(pwd) awk | test --verbose
+		"$@" local "$@" "$1" 'quoted text' 'quoted text' && 2>/dev/null $(pwd)
+then && then readonly &&
+	sed -eu /usr/bin local local sed grep -eu 'quoted text' awk
+| --verbose readonly | "$@" test ${HOME}
+		cd cd 'quoted text' && | $(pwd) export
+		sed local test grep /usr/bin
+		"$@" "$1" done "$@" /usr/bin "$@" cd | | test
+"$1" && awk local done grep $(pwd) sed -eu && echo
+		test 2>/dev/null 'quoted text' -eu /usr/bin awk
+	printf | printf $(pwd) awk cd readonly printf x=1
+		${HOME} | 'quoted text' echo "$@" grep 2>/dev/null
+'quoted text' -eu --verbose -eu -eu "$1" readonly
+		local $(pwd) printf then && then sed then local local local
+		${HOME} && ${HOME} ${HOME} echo "$@" local printf 'quoted text' cd
+		| readonly --verbose test ${HOME} x=1 then $(pwd) /usr/bin
+		printf --verbose $(pwd)
+"$1" | ${HOME} | "$@" printf done local 'quoted text' export
+	/usr/bin x=1 -eu -eu /usr/bin echo "$1" readonly sed --verbose
+		2>/dev/null readonly grep --verbose
+		export echo export readonly
+		&& test --verbose ${HOME} x=1 'quoted text' cd grep /usr/bin $(pwd) && -eu sed
+		done then printf local local done sed 'quoted text' cd done "$1" sed
+		${HOME} && export && "$@" $(pwd)
+'quoted text' test done $(pwd) ${HOME} $(pwd) "$@" grep ${HOME} test export awk
+export grep echo ${HOME} $(pwd) cd
+-eu 'quoted text' | | | echo
+	/usr/bin --verbose cd awk awk 2>/dev/null export $(pwd) | /usr/bin
+sed export awk "$@" awk readonly 'quoted text' sed printf printf
+x=1 local $(pwd) 2>/dev/null 2>/dev/null "$1"
+		--verbose done cd -eu test -eu --verbose x=1
+		/usr/bin 'quoted text' then
+| readonly grep "$@" done printf
+		grep echo -eu 2>/dev/null local then grep
+test 2>/dev/null readonly $(pwd) sed /usr/bin && x=1 x=1 --verbose test ${HOME}
+&& then echo 'quoted text' test sed done sed
+		"$1" "$1" echo "$1" 'quoted text' cd | $(pwd) /usr/bin ${HOME} awk |
+		done "$@" readonly | "$1" /usr/bin sed | awk 2>/dev/null ${HOME} && readonly
+x=1 && 'quoted text' done grep
+		export "$1" then 'quoted text' then
+		sed 'quoted text' readonly
+	"$1" printf -eu $(pwd) "$@" cd ${HOME} then -eu echo
+		&& "$@" /usr/bin done | ${HOME} printf done 'quoted text' cd
+done 2>/dev/null ${HOME} 'quoted text' "$1" local 'quoted text'
+		$(pwd) "$1" 'quoted text'
+		${HOME} "$@" 2>/dev/null grep "$@"
+2>/dev/null grep ${HOME} grep sed --verbose
+then printf $(pwd) local readonly "$1" echo readonly "$@"
+grep $(pwd) 'quoted text' done ${HOME}
+		-eu then 2>/dev/null cd "$@" grep readonly --verbose test $(pwd) "$@" test "$@"
+		sed 'quoted text' awk /usr/bin | ${HOME} 2>/dev/null
+	printf --verbose test done awk echo 2>/dev/null echo ${HOME} export -eu
+| && awk --verbose "$@" "$@" && test export
+		export readonly && 'quoted text' awk $(pwd) | ${HOME} --verbose -eu $(pwd)
+"$1" sed test -eu readonly
+		grep printf "$1" $(pwd) /usr/bin export readonly
+		2>/dev/null && sed local /usr/bin
+		'quoted text' grep $(pwd) then 2>/dev/null sed
+2>/dev/null 2>/dev/null readonly echo | "$@" /usr/bin awk ${HOME}
+'quoted text' sed local export awk done 'quoted text'
+test "$@" -eu then "$@" "$1" --verbose local done 'quoted text' echo x=1 'quoted text'
+		sed | echo "$1" "$@" cd "$@" ${HOME}
+	${HOME} 2>/dev/null /usr/bin printf /usr/bin 2>/dev/null readonly -eu test
+		"$1" $(pwd) "$@" && ${HOME} awk echo then $(pwd)
+		grep $(pwd) printf x=1 export ${HOME}
+		2>/dev/null sed then --verbose sed then
+	cd ${HOME} cd /usr/bin cd -eu readonly
+	export "$1" sed printf | | awk "$@" "$@"
+x=1 && sed "$@" cd "$@" echo ${HOME} "$@" "$1" test ${HOME} printf
+grep 'quoted text' 2>/dev/null --verbose --verbose grep export 'quoted text'
+		"$@" readonly test grep
+	"$@" "$@" echo && "$1" done /usr/bin
+		"$@" 'quoted text' ${HOME} && done awk "$1" -eu ${HOME}
+	then /usr/bin grep local local 2>/dev/null "$1" sed --verbose cd
+	echo ${HOME} export cd done /usr/bin | x=1
+test -eu echo sed export done local test
+sed grep --verbose 'quoted text' && cd local 2>/dev/null -eu
+	--verbose echo -eu -eu
+	2>/dev/null then then sed --verbose
+	2>/dev/null --verbose &&
+		&& done $(pwd) cd grep ${HOME} then $(pwd) echo cd -eu awk -eu
+	${HOME} ${HOME} 2>/dev/null ${HOME} printf "$1" 2>/dev/null
+2>/dev/null test 2>/dev/null local --verbose export 'quoted text' "$@"
+		$(pwd) test /usr/bin printf test
+echo $(pwd) then $(pwd) -eu done local sed echo && ${HOME} x=1 sed cd test "$@"
+		"$@" && cd done awk test
+	--verbose export done ${HOME} && "$1" done $(pwd) x=1 grep | && $(pwd) | printf
+	local --verbose awk done && sed 'quoted text'
+		local sed -eu /usr/bin | /usr/bin 2>/dev/null export printf then
+		| cd printf -eu sed readonly
+	2>/dev/null -eu x=1 ${HOME} printf $(pwd) -eu then then readonly cd local
+| local local test grep "$@" then $(pwd) sed
+| ${HOME} echo $(pwd) echo readonly "$@" x=1 --verbose /usr/bin test --verbose
+	$(pwd) readonly && ${HOME} sed | 2>/dev/null /usr/bin
+		| $(pwd) export 'quoted text' "$@"
+		"$@" $(pwd) $(pwd) 2>/dev/null then -eu x=1 $(pwd) 2>/dev/null
+		cd cd awk printf readonly --verbose
+printf | && --verbose grep "$@" then "$1" cd 'quoted text' readonly --verbose
+	awk printf sed cd ${HOME} export
+		--verbose x=1 export sed cd cd
+		-eu test sed sed printf
+	'quoted text' | printf -eu readonly $(pwd) x=1 cd sed sed | && -eu /usr/bin
+${HOME} export 2>/dev/null -eu $(pwd) printf --verbose | export x=1 -eu | awk
+-eu && then done echo awk awk "$1"
+		grep x=1 echo readonly --verbose /usr/bin
+		cd awk awk printf x=1 /usr/bin
+	awk 2>/dev/null /usr/bin "$@"
+	cd ${HOME} export done cd --verbose cd
+"$@" grep ${HOME} 2>/dev/null
+		printf -eu -eu local && awk | 2>/dev/null test printf readonly
+done "$1" "$@" cd echo /usr/bin echo done 'quoted text'
+	sed /usr/bin "$@" grep sed sed --verbose
+	"$@" local readonly readonly then | --verbose --verbose local | && awk
+	x=1 sed cd 2>/dev/null grep test then ${HOME} grep ${HOME}
+local readonly 2>/dev/null
+2>/dev/null 'quoted text' 2>/dev/null
+	$(pwd) | 'quoted text' "$1" printf -eu --verbose export 2>/dev/null
+		export sed local 'quoted text'
+		"$@" -eu cd cd grep test $(pwd) export then
+	"$@" ${HOME} "$1" then sed then done export "$1" -eu $(pwd)
+grep /usr/bin && done echo x=1 "$@" 'quoted text' awk && done 2>/dev/null grep
+	sed then --verbose "$1"
+	sed && cd $(pwd) cd 'quoted text' -eu echo readonly 'quoted text'
+		${HOME} sed test grep readonly test readonly
+x=1 2>/dev/null printf x=1 /usr/bin
+	export "$1" readonly test awk --verbose
+test readonly -eu sed echo export "$1" readonly echo 'quoted text' done
+	echo $(pwd) test "$1" $(pwd) local --verbose grep test then
+		local 2>/dev/null x=1 readonly test
+		x=1 && done echo sed 'quoted text'
+		$(pwd) $(pwd) readonly done ${HOME} ${HOME} grep sed
+	then --verbose && $(pwd) echo grep $(pwd)
+		awk ${HOME} cd "$@" export export 2>/dev/null /usr/bin 'quoted text'
+		awk --verbose | "$1" then /usr/bin local echo
+		local export grep readonly 'quoted text' 2>/dev/null local "$1"
+	echo | awk $(pwd) "$1" 2>/dev/null
+readonly then grep sed --verbose -eu $(pwd)
+grep sed printf ${HOME} grep
+test test $(pwd) awk export readonly grep readonly -eu --verbose
+--verbose x=1 ${HOME} test /usr/bin
+$(pwd) --verbose export readonly export --verbose /usr/bin printf awk cd awk
+"$@" then | awk readonly readonly --verbose
+		then echo awk echo | readonly x=1 echo 2>/dev/null $(pwd) awk printf "$@" -eu
+grep $(pwd) local 'quoted text' awk $(pwd) | echo sed
+		&& 'quoted text' | 'quoted text'
+then done awk -eu "$1" 'quoted text' cd local local && export
+-eu 'quoted text' printf printf
+	&& echo 2>/dev/null x=1 ${HOME} local 2>/dev/null "$@" "$1" export ${HOME} printf
+		$(pwd) grep "$@" x=1 "$@" 'quoted text'
+	local 2>/dev/null cd $(pwd) local
+		then awk /usr/bin then printf -eu /usr/bin
+	&& 'quoted text' awk done sed 'quoted text'
+		done awk x=1 "$@" readonly -eu -eu sed /usr/bin sed
+	'quoted text' cd && --verbose --verbose echo "$1" "$@"
+	printf grep "$1" --verbose "$1" export sed "$@" test export "$1" |
+	printf "$1" x=1 $(pwd) $(pwd) $(pwd)
+printf "$1" x=1 then test -eu printf
+	&& && x=1 then cd then ${HOME} x=1 export local cd "$1" && then test grep --verbose
+"$1" local && "$@" then "$1" -eu | "$@"
+		&& && $(pwd) --verbose done ${HOME}
+&& printf -eu 2>/dev/null /usr/bin readonly
+test then "$@" "$1" && $(pwd)
+	local readonly && /usr/bin done cd local $(pwd) printf
+		test "$1" grep "$1" 2>/dev/null
+		cd echo && export /usr/bin | export local | 2>/dev/null test echo $(pwd)
+		echo /usr/bin "$1" "$@" ${HOME} $(pwd) export x=1 then /usr/bin
+		--verbose -eu grep export awk "$1" cd -eu -eu readonly
+	--verbose awk | test 2>/dev/null | /usr/bin awk 2>/dev/null ${HOME}
+"$@" $(pwd) readonly "$@" echo readonly export --verbose
+	printf -eu $(pwd) ${HOME} test awk test cd
+'quoted text' "$1" export /usr/bin export "$@" printf printf &&
+		sed 2>/dev/null "$1" export 'quoted text' "$@" /usr/bin sed x=1 test 'quoted text'
+echo ${HOME} && | cd "$@" echo export cd $(pwd)
+		echo then -eu x=1 cd "$1" 2>/dev/null awk $(pwd)
+	awk test 2>/dev/null && readonly local awk 'quoted text' 'quoted text' test
+	-eu --verbose grep --verbose done | /usr/bin
+		$(pwd) | x=1 test x=1 done done && readonly
+		"$@" then local printf $(pwd) export
+		&& cd then grep -eu 2>/dev/null $(pwd) then done test awk --verbose
+		"$1" export -eu echo --verbose export readonly readonly 2>/dev/null
+&& x=1 readonly sed done printf | cd awk "$@" then printf ${HOME}
+sed --verbose 2>/dev/null awk echo
+	awk grep then ${HOME} readonly cd && then
+--verbose && "$1" readonly 2>/dev/null
+"$1" -eu echo && cd | | done
+	printf ${HOME} printf test
+echo | echo | "$@" --verbose
+	cd && awk $(pwd) cd grep echo && awk local "$@" then test sed readonly
+	"$@" /usr/bin sed | 'quoted text' sed readonly 'quoted text' ${HOME}
+		-eu readonly readonly /usr/bin
+&& "$1" local -eu -eu
+		/usr/bin /usr/bin cd "$1" then sed -eu done $(pwd) --verbose sed -eu
+${HOME} | -eu $(pwd) printf && --verbose "$1" 'quoted text'
+	grep local cd x=1 printf printf --verbose 2>/dev/null
+		--verbose awk cd grep x=1 readonly test --verbose --verbose
+	export "$1" readonly local
+		"$1" --verbose then sed done done echo "$@" cd && printf "$@" --verbose
+	&& export cd 2>/dev/null /usr/bin &&
+		-eu "$@" 'quoted text' awk | && ${HOME}
+	"$1" && test test 2>/dev/null ${HOME} x=1 local ${HOME} "$1" sed "$@"
+		| "$@" echo readonly "$@" &&
+		-eu && && $(pwd) "$@" $(pwd) | ${HOME} awk /usr/bin
+test && then echo 2>/dev/null
+		echo && /usr/bin --verbose && -eu && readonly export
+-eu $(pwd) done && -eu 'quoted text' /usr/bin export readonly -eu "$@" ${HOME}
+		sed export "$@" then 'quoted text' test "$@" done "$@" $(pwd) done awk
+		"$1" echo export $(pwd) echo sed grep | grep sed "$1" && 2>/dev/null x=1 "$1"
+echo "$1" 'quoted text'
+--verbose ${HOME} grep printf | x=1 2>/dev/null test printf
+	"$@" awk | --verbose "$1" | echo x=1 | awk readonly cd 2>/dev/null then "$@"
+done echo done done 2>/dev/null grep readonly export grep ${HOME}
+		2>/dev/null done -eu x=1 echo cd then cd
+then test && done printf | readonly
+$(pwd) 'quoted text' printf
+	$(pwd) cd x=1 echo -eu ${HOME} done local sed
+printf test done x=1 x=1 local awk printf --verbose echo readonly x=1 -eu
+"$1" 2>/dev/null awk done | -eu | x=1 echo -eu -eu test export
+	sed && done echo "$@"
+export export export awk then $(pwd) printf test $(pwd) --verbose --verbose
+echo -eu cd && sed | | echo | 2>/dev/null awk done x=1 'quoted text' -eu
+	sed readonly x=1 -eu x=1 readonly | "$1" cd | test sed 'quoted text' then
+${HOME} sed x=1 awk readonly sed sed echo "$@" x=1 export -eu "$1" x=1 test
+${HOME} "$@" -eu local printf grep /usr/bin
+	cd sed awk done /usr/bin then x=1
+local test --verbose -eu x=1 --verbose cd test cd x=1 export | printf export
+	${HOME} | --verbose local 2>/dev/null test "$1"
+	2>/dev/null /usr/bin -eu "$1"
+/usr/bin "$@" then test "$1" "$1" --verbose
+		printf grep printf ${HOME} awk | done awk
+	sed -eu readonly grep "$1" 2>/dev/null readonly local cd
+		$(pwd) readonly printf test | x=1
+--verbose /usr/bin printf x=1 'quoted text' sed grep sed -eu printf grep
+		&& local 'quoted text' "$1" && 2>/dev/null printf /usr/bin readonly
+	| then local --verbose | sed --verbose
+| -eu cd 2>/dev/null x=1 $(pwd) local
+		then -eu export sed $(pwd) 2>/dev/null
+/usr/bin local "$@" x=1
+		printf /usr/bin test then cd test sed local grep x=1 x=1 "$@" local x=1
+		--verbose && local x=1 awk -eu && readonly sed /usr/bin "$@" printf
+	x=1 then /usr/bin grep echo
+'quoted text' 'quoted text' echo /usr/bin ${HOME} $(pwd) ${HOME} done
+		printf | 2>/dev/null awk sed -eu 2>/dev/null readonly readonly "$1" --verbose
+	x=1 $(pwd) $(pwd) x=1 x=1 'quoted text' done /usr/bin sed | ${HOME}
+export $(pwd) "$1" ${HOME} --verbose
+${HOME} "$1" "$@" cd awk local cd ${HOME} printf readonly
+	"$@" awk ${HOME} 'quoted text' $(pwd)
+	sed local test | export awk sed && | --verbose
+		/usr/bin | | /usr/bin then printf grep export
+		-eu awk /usr/bin 'quoted text' local "$@" readonly sed cd
+grep "$@" local then printf grep $(pwd) | export readonly /usr/bin export
+2>/dev/null done done | grep cd local "$@" /usr/bin x=1 2>/dev/null
+local "$1" readonly then test 2>/dev/null readonly sed "$@" $(pwd)
+	test $(pwd) -eu -eu ${HOME} -eu awk echo local "$@" && "$@" ${HOME} $(pwd)
+	"$@" awk sed then | $(pwd) "$1" grep cd cd echo done readonly
+		awk echo | readonly 'quoted text'
+	x=1 local grep x=1 awk --verbose ${HOME}
+x=1 grep test then 2>/dev/null "$1"
+| cd "$1" echo ${HOME} /usr/bin then
+'quoted text' | local
+	awk ${HOME} test --verbose local
+		2>/dev/null test 2>/dev/null local 'quoted text' --verbose
+grep then x=1 'quoted text' printf printf readonly
+		${HOME} /usr/bin cd printf "$@" then printf 'quoted text' echo 2>/dev/null test
+	--verbose printf then "$1" grep ${HOME} /usr/bin
+	sed && export sed "$@" export --verbose printf readonly
+export x=1 done grep ${HOME} printf /usr/bin done x=1
+		export /usr/bin export $(pwd)
+	test echo export then ${HOME} | printf 'quoted text'
+/usr/bin -eu ${HOME} "$1" cd --verbose
+		done "$@" 'quoted text' readonly $(pwd) ${HOME} readonly
+cd 'quoted text' printf ${HOME}
+	2>/dev/null 2>/dev/null && ${HOME} "$1" printf
+	sed sed readonly readonly
+		2>/dev/null awk && local && then local
+		then ${HOME} sed sed $(pwd) "$@" "$1" export grep ${HOME} $(pwd) 2>/dev/null
+		export echo "$@" | awk test readonly | grep x=1 sed /usr/bin cd -eu "$1" then
+		printf ${HOME} local ${HOME} "$1" echo --verbose
+		2>/dev/null x=1 "$@" then export "$1" sed /usr/bin printf echo test
+	awk "$@" export 'quoted text' test ${HOME} "$1"
+		cd ${HOME} 2>/dev/null local "$@" "$1" awk
+		&& cd printf x=1 then /usr/bin then awk echo "$1" $(pwd) 2>/dev/null -eu
+		printf /usr/bin readonly --verbose local "$1" |
+--verbose echo local /usr/bin sed x=1 export --verbose then $(pwd) cd readonly echo
+		${HOME} -eu local ${HOME} | grep
+	then | x=1 grep "$@" && "$1" --verbose then cd 'quoted text' |
+		printf echo "$1" ${HOME} &&
+		'quoted text' "$1" printf x=1 'quoted text' local
+done x=1 readonly && then && ${HOME} awk | $(pwd) "$1" "$1" && /usr/bin
+		"$@" readonly echo then awk
+	"$1" -eu sed | ${HOME} -eu awk --verbose -eu | echo | then cd
+		x=1 "$1" then 'quoted text' "$@" cd 2>/dev/null then x=1 test && local done ${HOME}
+	/usr/bin --verbose echo printf awk test grep readonly ${HOME} then done grep
+		test ${HOME} grep 'quoted text' 'quoted text' grep 2>/dev/null
+	export 'quoted text' local /usr/bin --verbose "$@" readonly done test
+cd -eu | printf grep echo ${HOME} 'quoted text' cd 2>/dev/null -eu export
+		'quoted text' grep $(pwd) --verbose -eu
+	/usr/bin "$1" then && export "$1" --verbose && sed ${HOME}
+	$(pwd) ${HOME} | ${HOME}
+		/usr/bin ${HOME} echo cd
+		then then readonly /usr/bin done local /usr/bin 2>/dev/null printf &&
+		echo printf grep export test "$@"
+		grep test echo --verbose
+		test readonly cd sed 'quoted text' --verbose | done export then && "$1" cd
+		export && grep test then -eu x=1 export
+		cd cd grep ${HOME} && sed "$1" export --verbose grep grep
+	awk "$1" readonly export |
+		'quoted text' "$1" cd $(pwd) ${HOME}
+"$@" x=1 -eu "$@" 2>/dev/null echo "$1" done awk x=1 awk local test test "$@" ${HOME}
+	"$@" readonly -eu 2>/dev/null test "$1"
+local $(pwd) echo cd cd && then /usr/bin local readonly x=1 2>/dev/null /usr/bin
+		grep awk printf printf
+	export -eu printf printf
+${HOME} printf readonly awk done /usr/bin x=1 "$@" done awk 2>/dev/null grep
+	echo "$@" -eu then echo && "$@"
+		then sed test local grep awk
+	'quoted text' | then /usr/bin ${HOME} local --verbose sed
+/usr/bin echo test local "$1" 'quoted text'
+printf test export grep --verbose ${HOME} echo && echo /usr/bin echo 'quoted text'
+		${HOME} && && awk x=1 then | test ${HOME} "$@"
+readonly ${HOME} --verbose export cd echo export sed ${HOME} $(pwd) echo /usr/bin
+&& sed "$@" then && x=1 echo sed then
+sed x=1 sed export 2>/dev/null
+	local done sed "$@" export "$1" -eu sed awk echo 2>/dev/null
+	-eu grep 2>/dev/null local "$1" grep
+readonly $(pwd) 'quoted text' then awk
+local ${HOME} ${HOME} $(pwd) --verbose &&
+		readonly --verbose 2>/dev/null 2>/dev/null
+test then x=1 echo readonly "$@" then |
+x=1 local done "$@" "$@" cd awk 2>/dev/null
+readonly echo "$@" readonly -eu readonly "$1" readonly cd printf | printf x=1
+	done local ${HOME} 'quoted text' 2>/dev/null sed "$@" "$1" test "$1" x=1
+$(pwd) /usr/bin "$1" echo awk then 2>/dev/null 'quoted text' $(pwd) local --verbose
+${HOME} $(pwd) printf ${HOME} | printf cd ${HOME}
+	"$@" $(pwd) grep echo readonly
+	"$1" -eu ${HOME} -eu cd grep 2>/dev/null grep echo awk readonly -eu
+		readonly && grep echo readonly && $(pwd) echo test cd 2>/dev/null
+		printf test echo /usr/bin printf
+		/usr/bin export $(pwd) local done "$@" x=1 'quoted text' /usr/bin
+	printf echo /usr/bin | local x=1 sed "$@" && test echo readonly done
+local 2>/dev/null $(pwd) grep sed sed x=1 export sed /usr/bin export local
+--verbose test && "$@" export 2>/dev/null printf then $(pwd) sed && sed x=1
+		sed sed test ${HOME} --verbose
+		/usr/bin /usr/bin /usr/bin 2>/dev/null
+	readonly 2>/dev/null 2>/dev/null /usr/bin echo x=1 ${HOME} "$1"
+		sed "$1" /usr/bin ${HOME} export "$@" 2>/dev/null printf
+	--verbose $(pwd) && sed "$@" x=1 ${HOME} grep --verbose grep
+awk export "$@" done $(pwd) awk cd &&
+	readonly printf local
+export --verbose echo grep 2>/dev/null "$1" echo test printf | /usr/bin done
+		printf ${HOME} echo --verbose
+	--verbose echo then done
+'quoted text' awk ${HOME} x=1 local export cd -eu ${HOME} "$@" --verbose
+	export x=1 printf readonly cd && 2>/dev/null cd && x=1 echo
+		grep awk printf export export sed then done /usr/bin --verbose then | -eu
+		-eu ${HOME} export -eu --verbose
+		$(pwd) --verbose --verbose then awk "$@"
+		-eu grep echo local awk
+		/usr/bin $(pwd) | printf readonly export
+		${HOME} export -eu x=1 x=1 $(pwd) export $(pwd) && "$1" /usr/bin 'quoted text'
+		-eu ${HOME} export x=1 --verbose /usr/bin echo /usr/bin
+	x=1 $(pwd) awk printf /usr/bin then "$@" 'quoted text' echo --verbose
+		&& grep "$1" --verbose
+x=1 echo export grep cd 'quoted text' done && "$@" --verbose
+x=1 done "$1" done ${HOME} printf test | "$@"
+local sed /usr/bin -eu 'quoted text' awk grep x=1 cd readonly $(pwd)
+done awk grep "$@" awk sed x=1 export cd
+		done 'quoted text' export ${HOME} "$@" export sed && ${HOME} grep sed "$1"
+x=1 /usr/bin sed printf echo then ${HOME}
+	echo && echo x=1 test echo
+"$@" && local readonly awk "$1" "$@" test ${HOME}
+	printf 'quoted text' --verbose | | printf cd export done
+		2>/dev/null ${HOME} test cd 2>/dev/null -eu ${HOME} export sed ${HOME}
+echo 2>/dev/null export /usr/bin 'quoted text' export echo test
+"$1" echo printf awk "$1" -eu --verbose -eu /usr/bin awk 2>/dev/null readonly
+	then x=1 $(pwd) cd awk && echo && done x=1 export /usr/bin | echo test
+cd ${HOME} $(pwd) local echo -eu echo test "$@" printf cd && ${HOME}
+		cd 'quoted text' then export 'quoted text'
+'quoted text' 2>/dev/null then ${HOME} cd local -eu $(pwd) -eu sed -eu test local
+awk export export export ${HOME} "$1"
+		${HOME} grep x=1 -eu "$1" readonly then | --verbose | sed
+	done done export test test readonly "$1" awk /usr/bin && then | x=1 done done 2>/dev/null
+test $(pwd) done --verbose "$@" 'quoted text' sed echo cd ${HOME}
+"$1" then awk cd done test
+echo local echo then cd && && sed cd printf x=1 x=1 sed "$@" 'quoted text'
+export 'quoted text' 'quoted text' 2>/dev/null export 2>/dev/null readonly x=1 2>/dev/null
+		export | 2>/dev/null readonly
+	readonly /usr/bin sed $(pwd) /usr/bin then
+export x=1 --verbose ${HOME} test 'quoted text' then export ${HOME} then 'quoted text'
+$(pwd) "$@" 2>/dev/null ${HOME} && test awk export readonly local x=1
+		sed printf readonly ${HOME} echo
+	x=1 $(pwd) grep ${HOME} x=1 --verbose echo echo /usr/bin export done $(pwd)
+		grep printf && ${HOME} 'quoted text' 2>/dev/null grep "$1" done local
+		"$@" then "$@" cd --verbose "$@" /usr/bin 2>/dev/null printf
+		-eu | readonly && ${HOME} | echo readonly && then
+	${HOME} x=1 sed "$@" sed awk --verbose
+	export grep ${HOME} echo -eu cd sed $(pwd) "$@" grep | then printf local x=1
+		x=1 done ${HOME} done --verbose --verbose
+		done grep --verbose done | test | $(pwd) -eu -eu readonly readonly grep x=1 grep
+"$1" grep sed cd "$1" 'quoted text' test then | grep awk /usr/bin "$@" 'quoted text'
+		test done printf /usr/bin then /usr/bin test grep done local 'quoted text'
+		cd test local grep x=1
+printf 2>/dev/null 'quoted text' |
+	2>/dev/null 'quoted text' "$@" ${HOME}
+	$(pwd) /usr/bin 2>/dev/null && done printf "$1"
+		sed 'quoted text' awk "$@" cd "$@" export x=1 /usr/bin echo
+/usr/bin ${HOME} done -eu ${HOME} cd
+		export -eu ${HOME} --verbose ${HOME}
+		/usr/bin --verbose cd 'quoted text' /usr/bin
+		'quoted text' 2>/dev/null /usr/bin cd 2>/dev/null
+		--verbose cd "$@" ${HOME} echo ${HOME}
+${HOME} cd readonly "$1" $(pwd) export sed 2>/dev/null ${HOME}
+x=1 'quoted text' | echo grep export cd echo then cd x=1 cd $(pwd) $(pwd) done
+		-eu then x=1 -eu export 'quoted text' echo printf printf && $(pwd) ${HOME} &&
+		x=1 printf 2>/dev/null /usr/bin done --verbose "$@" cd
+	&& 2>/dev/null -eu -eu
+		done 'quoted text' --verbose echo -eu -eu cd grep
+	sed local x=1 ${HOME} /usr/bin readonly
+		awk "$@" 'quoted text'
+	cd ${HOME} ${HOME} echo test sed cd | x=1 then "$1" export
+	printf | cd local -eu readonly
+echo && 'quoted text' 'quoted text' ${HOME} printf
+${HOME} --verbose test "$1" printf done | test
+"$1" readonly | "$1" echo awk && && readonly 2>/dev/null $(pwd) grep && -eu
+	printf 'quoted text' readonly
+done /usr/bin $(pwd) --verbose grep
+	readonly -eu x=1 "$1" $(pwd) -eu printf $(pwd) test
+		&& $(pwd) 'quoted text' -eu 2>/dev/null ${HOME}
+		x=1 "$@" $(pwd) ${HOME} /usr/bin $(pwd) ${HOME} cd
+	done test sed test ${HOME}
+		done | /usr/bin export then 2>/dev/null && | then 2>/dev/null export $(pwd)
+sed cd "$@" 2>/dev/null echo && $(pwd) local then -eu /usr/bin 'quoted text'
+--verbose 2>/dev/null 'quoted text' then printf cd readonly x=1 /usr/bin then
+"$1" | 'quoted text' -eu $(pwd) grep ${HOME} then /usr/bin -eu
+		/usr/bin sed 2>/dev/null 2>/dev/null
+		echo printf then echo 'quoted text' export
+echo done 2>/dev/null ${HOME} "$1"
+		grep x=1 then sed sed echo readonly | ${HOME} test -eu printf
+	printf readonly && "$1" | readonly
+-eu local $(pwd) test done readonly
+| 2>/dev/null awk 'quoted text'
+	sed sed $(pwd) ${HOME} printf -eu test x=1 local
+	sed "$@" /usr/bin sed grep ${HOME} cd export ${HOME} cd test readonly 2>/dev/null
+	x=1 grep sed readonly local --verbose grep "$@" done local && | test awk ${HOME}
+	local 'quoted text' echo --verbose cd ${HOME} -eu export
+		| $(pwd) -eu then && grep
+		"$@" -eu "$1" x=1 /usr/bin test
+	test awk 'quoted text' "$1" done grep "$@" 'quoted text' $(pwd) --verbose
+		echo echo grep printf sed -eu printf sed ${HOME} cd awk local
+		export awk 'quoted text' done /usr/bin
+test "$@" sed "$1" grep then test awk printf echo /usr/bin printf | printf test
+	2>/dev/null --verbose
+		--verbose 2>/dev/null test 'quoted text' printf printf then | -eu ${HOME}
+"$1" echo -eu "$@" grep sed -eu -eu then test
+echo --verbose local test echo printf awk done
+/usr/bin awk awk sed sed "$1" cd cd && grep x=1 "$1" readonly x=1 --verbose
+		cd "$1" --verbose 2>/dev/null
+		x=1 | awk cd && /usr/bin ${HOME}
+--verbose test local test readonly test done local export -eu /usr/bin
+	&& | 'quoted text' --verbose export /usr/bin --verbose local grep printf x=1 $(pwd)
+		x=1 ${HOME} grep 'quoted text'
+	cd readonly --verbose readonly $(pwd)
+		2>/dev/null cd sed test then | --verbose ${HOME} $(pwd) "$1" |
+	then awk test "$1" readonly then "$1" readonly
+"$@" 'quoted text' readonly -eu ${HOME} 2>/dev/null echo
+	&& --verbose "$@" sed | 'quoted text' "$1"
+	x=1 echo local local export "$@" 2>/dev/null test ${HOME}
+		&& 2>/dev/null x=1 readonly cd | 2>/dev/null -eu echo test done
+	"$1" x=1 && readonly grep 'quoted text' test local x=1 done
+	"$1" | local export then --verbose local echo --verbose readonly
+		echo -eu -eu "$1" "$1" "$@" && "$@"
+done -eu local /usr/bin "$1" /usr/bin printf echo
+	test cd --verbose && --verbose ${HOME} export sed sed /usr/bin "$@" /usr/bin
+'quoted text' sed export "$1"
+	sed cd export readonly ${HOME} 2>/dev/null printf "$1"
+export awk test $(pwd) 'quoted text' ${HOME} export x=1 'quoted text'
+x=1 readonly --verbose export echo cd /usr/bin
+$(pwd) 'quoted text' printf export cd done 2>/dev/null
+'quoted text' $(pwd) | -eu export 2>/dev/null ${HOME}
+--verbose /usr/bin x=1 x=1 | ${HOME} && x=1 export
+	awk -eu /usr/bin --verbose && 'quoted text' then echo && test
+		done test then sed x=1 export done done 'quoted text' ${HOME}
+2>/dev/null grep readonly local | "$1" export
+	sed done test then "$@" "$1" ${HOME} 'quoted text'
+		&& printf done $(pwd) --verbose
+'quoted text' ${HOME} && 2>/dev/null
+		"$@" then 2>/dev/null grep 'quoted text' echo 2>/dev/null
+&& -eu --verbose printf local export 2>/dev/null
+&& $(pwd) -eu sed sed test --verbose
+sed readonly $(pwd) awk -eu 2>/dev/null readonly -eu
+		awk -eu "$@" local grep then | $(pwd) 2>/dev/null cd --verbose | ${HOME} /usr/bin
+		2>/dev/null $(pwd) awk
+'quoted text' awk done | export echo local local awk /usr/bin
+	"$1" ${HOME} && sed cd 2>/dev/null
+	printf echo --verbose done cd /usr/bin &&
+		done export -eu --verbose 'quoted text' sed 'quoted text' && then awk
+	test echo "$@" export
+done local && -eu "$@" -eu "$1" $(pwd) grep then | /usr/bin && echo ${HOME} sed
+		2>/dev/null echo ${HOME} ${HOME} readonly --verbose sed awk /usr/bin && awk done
+		test "$@" printf printf /usr/bin done export
+		$(pwd) /usr/bin "$@" awk | grep /usr/bin
+	x=1 echo sed printf --verbose /usr/bin done sed -eu
+	${HOME} printf readonly printf local -eu 'quoted text' x=1 2>/dev/null -eu echo
+	x=1 awk echo 'quoted text' $(pwd) sed | then
+		| done test --verbose awk "$@" ${HOME} local --verbose printf echo -eu local 2>/dev/null
+| local "$@" ${HOME} done 'quoted text' cd
+test echo local /usr/bin ${HOME} /usr/bin $(pwd)
+		/usr/bin then && $(pwd) sed "$@" then export 'quoted text'
+then printf -eu /usr/bin readonly 'quoted text'
+	/usr/bin local ${HOME} "$@" done echo | printf
+	done /usr/bin 'quoted text'
+		/usr/bin awk local local 'quoted text' -eu readonly done then done
+		local 2>/dev/null test 2>/dev/null
+	2>/dev/null then "$@" $(pwd) printf | export echo printf 'quoted text' readonly
+		&& $(pwd) /usr/bin awk && -eu awk | sed | | "$1" done /usr/bin
+		&& export 2>/dev/null $(pwd) export /usr/bin
+	| 'quoted text' test test | ${HOME}
+		x=1 "$1" "$@" awk "$1" --verbose | done
+		| | printf "$@" 'quoted text' cd
+	-eu printf "$@" then readonly 'quoted text'
+	$(pwd) test 2>/dev/null cd local awk "$1" &&
+		done readonly grep $(pwd) /usr/bin ${HOME}
+		2>/dev/null $(pwd) ${HOME} --verbose test export
+test x=1 x=1 echo 2>/dev/null awk local
+		"$1" ${HOME} done | $(pwd) local /usr/bin "$@" readonly test awk
+	test "$1" awk && $(pwd) done x=1
+		sed export -eu export "$1" && readonly test echo "$@"
+		--verbose /usr/bin then 'quoted text'
+		done export && printf printf -eu readonly readonly grep x=1 test local
+		done awk cd ${HOME} grep | readonly
+	export sed ${HOME} -eu grep 'quoted text' grep cd | cd 'quoted text' grep
+x=1 "$1" $(pwd) awk 'quoted text'
+	then export ${HOME} grep then printf 'quoted text' | printf x=1 test /usr/bin
+"$1" && echo && cd -eu done then export local local
+	local $(pwd) test 2>/dev/null cd readonly | 2>/dev/null "$1" "$1" grep
+&& awk && test local printf "$@" sed grep "$@" local done awk local
+	grep local && readonly && grep grep -eu printf local "$@" x=1
+	"$@" export sed /usr/bin "$1" && echo echo local "$1"
+	export | -eu cd --verbose readonly /usr/bin "$1" printf x=1 -eu 'quoted text'
+	$(pwd) 2>/dev/null "$@" printf /usr/bin done
+		/usr/bin export done echo local printf
+		$(pwd) done --verbose local 2>/dev/null $(pwd) then /usr/bin | /usr/bin grep
+echo 'quoted text' sed 2>/dev/null grep 2>/dev/null x=1 echo
+		sed cd sed 'quoted text' &&
+'quoted text' /usr/bin | --verbose -eu | then echo printf
+		export sed "$1" $(pwd) local local grep 'quoted text' 2>/dev/null
+		sed $(pwd) done 'quoted text' -eu echo 2>/dev/null grep
+awk cd x=1 -eu 'quoted text' then then "$1"
+	$(pwd) test -eu local done && export awk
+		local /usr/bin then "$@" "$@" local
+$(pwd) x=1 'quoted text' "$1" --verbose
+grep awk ${HOME} 'quoted text' --verbose
+"$@" && 'quoted text' then then local
+awk /usr/bin test export cd sed cd x=1 done -eu local grep done then printf
+	'quoted text' "$@" --verbose sed 'quoted text'
+test 'quoted text' export "$@" done 2>/dev/null
+done awk test $(pwd) done export done | grep x=1 then $(pwd) sed done -eu local
+| done local 2>/dev/null printf -eu | /usr/bin cd cd export
+		$(pwd) 2>/dev/null "$1"
+	| sed --verbose $(pwd) 2>/dev/null cd export
+/usr/bin done -eu sed 'quoted text' --verbose then sed $(pwd) export cd "$1"
+	"$@" then $(pwd) sed grep local -eu -eu 'quoted text'
+"$@" -eu -eu 2>/dev/null
+	&& 2>/dev/null done echo export | local readonly x=1 readonly
+		awk echo "$@" done 'quoted text'
+	test printf then export 2>/dev/null done printf -eu "$1" test
+	'quoted text' x=1 export && local export then
+cd /usr/bin readonly grep | 'quoted text' printf printf
+		x=1 "$1" "$@" 'quoted text' x=1 "$1" echo $(pwd) "$1" "$1" printf &&
+		echo | -eu grep 'quoted text' echo grep awk -eu && -eu cd test
+test x=1 test printf local then /usr/bin
+/usr/bin then /usr/bin done -eu x=1 grep echo awk awk cd /usr/bin test 'quoted text'
+		"$@" x=1 --verbose done /usr/bin done 2>/dev/null /usr/bin
+	export 'quoted text' "$1" 2>/dev/null
+x=1 then | sed | done test "$1" && 'quoted text' echo awk test
+	printf "$1" sed readonly "$@" x=1 x=1 -eu && grep
+'quoted text' $(pwd) test x=1 -eu | printf readonly echo
+		/usr/bin 2>/dev/null && "$1" done local sed done -eu $(pwd) echo 2>/dev/null
+local x=1 --verbose 'quoted text' && test | cd test test printf readonly export
+		local echo printf sed /usr/bin $(pwd) ${HOME} ${HOME} ${HOME} local
+	sed --verbose | $(pwd) export && --verbose -eu echo awk | && then cd grep /usr/bin
+	x=1 | sed "$1" && /usr/bin && grep "$@" ${HOME} cd 2>/dev/null
+	-eu done $(pwd) 2>/dev/null -eu export echo readonly -eu -eu $(pwd) "$@"
+grep local sed x=1 test sed
+sed export done ${HOME} | test export awk readonly --verbose then export
+"$@" 'quoted text' grep cd | local --verbose
+	-eu grep grep ${HOME} test sed printf $(pwd) grep readonly done then done then awk
+${HOME} grep echo readonly grep printf -eu -eu printf
+2>/dev/null echo $(pwd) test 2>/dev/null -eu --verbose "$@" x=1
+		echo echo sed grep $(pwd) -eu then printf
+	cd -eu 2>/dev/null sed export export && /usr/bin
+-eu 2>/dev/null cd -eu "$@" "$@" echo local test test export x=1
+&& done sed export local 2>/dev/null $(pwd) /usr/bin
+	local x=1 local sed readonly done | x=1
+done sed -eu ${HOME} printf "$1" x=1 cd then echo 2>/dev/null /usr/bin local
+		/usr/bin -eu echo -eu $(pwd) /usr/bin "$@" cd "$1" then
+	| 2>/dev/null test "$1" | | x=1 export done --verbose echo
+		-eu $(pwd) "$1" sed &&
+	"$@" -eu sed ${HOME} $(pwd) | awk export done | export "$1" | 'quoted text'
+		sed grep x=1 'quoted text' -eu "$@" local /usr/bin echo then grep
+	x=1 ${HOME} 'quoted text' grep local "$1" cd then 2>/dev/null
+printf sed --verbose echo $(pwd) "$@" 'quoted text' then echo 2>/dev/null
+"$1" ${HOME} export | readonly export printf /usr/bin
+	&& export cd 2>/dev/null done local cd 2>/dev/null readonly 'quoted text'
+"$1" grep sed | readonly ${HOME}
+| printf -eu | "$@" readonly echo sed -eu ${HOME} export ${HOME}
+	done grep grep awk "$1" local echo ${HOME} then $(pwd) $(pwd) readonly x=1
+		${HOME} "$1" --verbose --verbose "$1" --verbose then cd
+		&& cd /usr/bin done 'quoted text'
+/usr/bin echo grep grep -eu | echo echo test test /usr/bin grep /usr/bin sed
+	awk && grep && --verbose
+		printf local awk && test test $(pwd) echo
+-eu $(pwd) local printf awk awk then readonly export grep
+	| echo test readonly && 'quoted text' x=1 ${HOME} 'quoted text' "$@" echo "$@"
+		then test then test "$@" /usr/bin test
+		awk --verbose /usr/bin x=1 awk local
+	export $(pwd) $(pwd) "$1" local -eu $(pwd) "$@" cd
+		${HOME} cd -eu /usr/bin 'quoted text' 'quoted text' 2>/dev/null
+	sed echo then 'quoted text' local local x=1 cd echo 'quoted text' export
+2>/dev/null export -eu cd cd -eu
+		export x=1 grep awk "$1" 'quoted text' "$1" 'quoted text'
+		x=1 2>/dev/null && printf awk local sed then "$1" awk grep
+	&& --verbose local sed && -eu $(pwd)
+	| printf $(pwd) done printf sed "$1" then $(pwd) grep -eu then x=1 export
+--verbose -eu printf cd local cd x=1 echo printf
+	export ${HOME} "$1" "$1" then
+test "$@" then | | sed "$@" grep "$1" | local
+grep -eu "$1" 'quoted text' ${HOME} export
+		'quoted text' $(pwd) readonly test local "$@" cd | 2>/dev/null 'quoted text'
+		echo 2>/dev/null --verbose -eu sed
+	| then done done "$@" readonly printf ${HOME}
+	--verbose /usr/bin local
+then then cd 'quoted text' /usr/bin printf
+local $(pwd) -eu $(pwd) $(pwd)
+	printf x=1 -eu x=1 'quoted text'
+2>/dev/null echo "$1" awk
+	grep then cd /usr/bin sed 2>/dev/null 'quoted text' ${HOME} then cd echo 'quoted text'
+printf | -eu awk printf "$@" sed
+		awk awk $(pwd) "$1" echo grep "$1" grep test --verbose
+	grep done -eu -eu /usr/bin
+		readonly 'quoted text' --verbose test -eu "$@" | && 2>/dev/null grep
+echo awk "$1" x=1 echo local local && x=1 printf export &&
+	printf ${HOME} $(pwd) | echo $(pwd) sed
+x=1 readonly sed sed /usr/bin done "$1" /usr/bin ${HOME} -eu
+&& grep | "$1" 'quoted text' x=1 | $(pwd) 'quoted text'
+--verbose awk printf x=1 awk done "$1" | local $(pwd) grep 'quoted text' done
+	done 'quoted text' readonly "$1" "$1" ${HOME} readonly local cd x=1 cd x=1
+	done cd 2>/dev/null readonly grep printf x=1 "$1" test sed sed printf readonly readonly
+	readonly x=1 x=1 grep && "$@" $(pwd) | --verbose
+"$1" local readonly local readonly 2>/dev/null awk && then
+local sed --verbose cd $(pwd) $(pwd)
+	"$1" cd grep -eu "$@" -eu /usr/bin grep awk --verbose "$@"
+grep local sed done --verbose sed -eu echo | export sed /usr/bin 'quoted text' "$@"
+		x=1 local done 'quoted text' $(pwd) sed grep 2>/dev/null 2>/dev/null readonly echo
+x=1 local local awk local readonly done
+"$1" test printf test cd local ${HOME} grep $(pwd) local -eu sed sed &&
+		/usr/bin sed "$1" echo 'quoted text' local 2>/dev/null
+readonly echo cd then local
+	cd $(pwd) readonly done ${HOME} 'quoted text' sed ${HOME} ${HOME} printf
+local "$1" awk readonly done ${HOME}
+		| awk readonly x=1 "$@" export local x=1 | ${HOME} -eu done export ${HOME} printf
+		done then local grep x=1 --verbose $(pwd) x=1 test /usr/bin
+	sed echo grep cd test then ${HOME} -eu x=1 'quoted text' printf --verbose
+	${HOME} "$@" | echo x=1 "$@" readonly local done "$@"
+	| done printf local --verbose readonly --verbose $(pwd) "$1" grep echo
+	echo && echo "$1" sed "$@"
+	$(pwd) echo awk cd then "$@" x=1 -eu awk grep
+		-eu && local $(pwd) --verbose test test local cd ${HOME}
+-eu echo cd local 2>/dev/null -eu readonly export x=1
+&& x=1 2>/dev/null readonly 'quoted text'
+then $(pwd) awk x=1 | local | cd $(pwd) done printf | "$@" done
+	"$@" then "$1" printf done printf 2>/dev/null
+-eu readonly awk "$@" && export then ${HOME} local
+		sed done "$1" grep && cd awk export cd cd --verbose && then $(pwd) done
+	grep ${HOME} "$@" sed cd cd "$@" "$@" && && export
+		echo test "$@" "$@" ${HOME}
+	printf --verbose 'quoted text' ${HOME} cd sed /usr/bin ${HOME}
+	sed local echo -eu /usr/bin local 2>/dev/null
+	then --verbose done "$1" | readonly
+	-eu export "$@" printf 2>/dev/null
+printf printf done test export
+		awk 2>/dev/null 2>/dev/null then test export export printf sed printf local "$1"
+-eu && "$1" export cd sed | awk
+2>/dev/null "$@" local ${HOME} 'quoted text' x=1 sed | grep 'quoted text'
+"$1" then && then && ${HOME}
+		test done && done cd export 'quoted text' echo
+	-eu -eu readonly 'quoted text' x=1 | done sed export "$1" 2>/dev/null ${HOME} --verbose
+		'quoted text' --verbose ${HOME} then "$@" cd "$@" sed
+	"$1" cd --verbose 2>/dev/null test | done printf awk
+		${HOME} test readonly awk test
+/usr/bin -eu && "$1" readonly --verbose 'quoted text' done
+		${HOME} && echo $(pwd) 2>/dev/null "$@" 2>/dev/null /usr/bin "$1"
+export -eu echo "$1" x=1 sed readonly test
+done "$1" "$1" echo x=1 done | awk local -eu && | x=1 test printf 'quoted text'
+$(pwd) sed "$@" sed local -eu local done then /usr/bin && test && echo
+$(pwd) 2>/dev/null 2>/dev/null grep 2>/dev/null --verbose "$1" grep
+	| && sed && "$@" local $(pwd) export $(pwd) && grep printf
+		awk local --verbose test | readonly printf |
+grep -eu ${HOME} ${HOME}
+		'quoted text' printf grep
+		&& -eu --verbose then | $(pwd) /usr/bin ${HOME} 2>/dev/null
+		| then readonly && $(pwd) then --verbose /usr/bin
+	readonly -eu -eu --verbose --verbose
+	test readonly grep test done awk then
+then cd | readonly && && /usr/bin
+	cd sed done printf "$1" local cd
+then test 2>/dev/null 'quoted text' sed 'quoted text'
+	printf echo "$@" "$@" && export local --verbose local local printf "$@"
+		echo grep local /usr/bin grep
+		'quoted text' done export /usr/bin readonly
+	&& && && $(pwd) x=1 /usr/bin
+/usr/bin printf -eu printf export && "$1" test done sed done local
+		2>/dev/null awk 'quoted text' "$@" local done /usr/bin | printf test && -eu
+"$@" --verbose -eu echo --verbose
+--verbose local "$1" sed 2>/dev/null 'quoted text'
+	local export local | test readonly cd local -eu "$@" local | done test 'quoted text'
+		-eu $(pwd) x=1 readonly grep 2>/dev/null echo 'quoted text'
+		-eu 2>/dev/null awk --verbose "$@" x=1 | "$@" cd "$1" | "$@"
+	grep sed export grep | "$@" "$@" x=1 then cd "$1"
+	-eu 'quoted text' test cd readonly ${HOME} printf "$@" printf done
+		echo echo && $(pwd) awk 'quoted text'
+	| local printf grep "$1" --verbose "$@" $(pwd) cd local
+	done "$@" grep echo | sed test awk test --verbose $(pwd) -eu
+	grep readonly local done sed | awk ${HOME}
+	| sed test sed $(pwd)
+	printf printf "$1" /usr/bin grep /usr/bin readonly test | "$@"
+	$(pwd) readonly awk | test x=1 && sed local "$1" sed export
+--verbose sed && export test test test --verbose x=1 grep test sed sed readonly
+		2>/dev/null echo --verbose
+		| done grep export -eu test
+		| && grep printf grep x=1 printf 'quoted text' printf "$@" &&
+	$(pwd) then "$1" $(pwd) test x=1 done $(pwd) awk readonly
+	done "$@" 2>/dev/null sed cd x=1 export test then -eu
+	2>/dev/null "$@" && --verbose 2>/dev/null local
+	done awk export --verbose && ${HOME} $(pwd) "$@" x=1 test done
+"$@" -eu local ${HOME} test | -eu readonly export
+		| done export $(pwd) readonly awk "$1" &&
+awk grep grep 2>/dev/null cd sed 'quoted text'
+		x=1 sed then | $(pwd) readonly
+		--verbose export then export done $(pwd) -eu | | then grep grep printf
+	--verbose --verbose && $(pwd) cd sed 'quoted text' -eu 'quoted text'
+/usr/bin "$@" $(pwd) | -eu && cd done awk printf ${HOME} cd cd
+--verbose 'quoted text' then test $(pwd) "$1" echo sed 'quoted text'
+-eu && 2>/dev/null /usr/bin "$1" -eu done printf cd && export
+	sed then echo echo sed | "$@" && done grep grep then "$@" 'quoted text' printf
+		awk done done --verbose $(pwd) ${HOME} 2>/dev/null done awk sed | export echo awk
+-eu done x=1 | /usr/bin printf "$1" then cd -eu && 2>/dev/null "$@" -eu 2>/dev/null
+	cd test | ${HOME} | x=1 done cd grep local x=1 readonly && "$@" sed grep export
+test && x=1 readonly sed
+"$@" "$1" ${HOME} awk awk cd ${HOME} /usr/bin export
+	cd /usr/bin readonly --verbose done cd
+| cd cd grep $(pwd) cd cd
+'quoted text' 2>/dev/null /usr/bin ${HOME}
+	printf 2>/dev/null awk
+		$(pwd) then echo --verbose $(pwd) cd $(pwd) 2>/dev/null
+local "$@" cd && "$1"
+grep "$1" 'quoted text' grep local then readonly sed grep |
+${HOME} --verbose && 'quoted text' "$@" test /usr/bin
+echo sed 2>/dev/null cd | /usr/bin printf 'quoted text' --verbose printf
+	'quoted text' | 2>/dev/null local
+		'quoted text' && grep | then "$1"
+done --verbose then readonly "$1" readonly 2>/dev/null
+		| local printf ${HOME} cd x=1 "$1" awk ${HOME} "$@" done $(pwd) /usr/bin
+		echo sed readonly "$@" |
+"$@" cd 2>/dev/null cd "$@" awk done cd
+		${HOME} x=1 "$1" && local $(pwd) readonly 'quoted text' | "$1" | $(pwd)
+		awk grep | && awk printf test 2>/dev/null
+		"$1" /usr/bin grep test done /usr/bin $(pwd) awk $(pwd)
+		'quoted text' then cd local grep && && printf
+	cd --verbose 'quoted text' awk $(pwd) "$@" x=1 grep ${HOME} awk --verbose x=1
+	awk | test --verbose --verbose readonly 2>/dev/null local --verbose x=1
+2>/dev/null /usr/bin
+		test $(pwd) "$@" -eu test export printf $(pwd) then then
+		cd sed grep 2>/dev/null done "$@" x=1 then && ${HOME} --verbose export --verbose
+readonly 'quoted text'
+		grep "$1" --verbose sed --verbose test sed awk /usr/bin | -eu x=1
+		sed 2>/dev/null $(pwd) awk $(pwd) printf
+x=1 && x=1 -eu awk $(pwd) printf test && export readonly --verbose
+x=1 2>/dev/null cd $(pwd) cd 2>/dev/null ${HOME} readonly
+	| --verbose done cd /usr/bin cd /usr/bin ${HOME} sed "$1" test
+		done -eu export then /usr/bin done
+		/usr/bin then "$1" sed --verbose ${HOME}
+		done /usr/bin -eu 'quoted text'
+	cd $(pwd) then readonly cd echo done && readonly grep export "$@" 'quoted text'
+	cd ${HOME} | -eu export x=1 'quoted text' -eu readonly "$1"
+-eu | awk "$1" echo grep x=1 then done grep
+	2>/dev/null awk printf readonly
+&& export | /usr/bin local 2>/dev/null
+"$@" export awk && printf done 2>/dev/null done cd 'quoted text' grep -eu "$1"
+		"$1" && -eu cd cd echo awk 'quoted text'
+test sed x=1 ${HOME} 'quoted text'
+		then && x=1 "$@" readonly /usr/bin readonly 'quoted text' sed "$@"
+	readonly grep | x=1 done printf readonly
+	cd "$1" then awk then --verbose -eu 'quoted text' export x=1 local && "$1" cd
+sed test -eu --verbose cd awk grep ${HOME} awk export | printf local /usr/bin
+		readonly done $(pwd) done --verbose ${HOME} "$@" 2>/dev/null
+	sed "$@" then 2>/dev/null /usr/bin "$1" then printf -eu x=1 readonly
+&& "$@" 2>/dev/null sed 2>/dev/null && awk
+	x=1 "$1" readonly awk then "$@" --verbose $(pwd) | /usr/bin 2>/dev/null
+local grep /usr/bin "$@" printf --verbose $(pwd) done "$1" grep export
+		--verbose sed sed printf -eu
+test cd | && 2>/dev/null x=1 /usr/bin then export -eu export
+then 'quoted text' "$1" sed export local done done cd printf x=1 --verbose printf
+echo grep cd ${HOME} then local
+	then /usr/bin 2>/dev/null readonly 2>/dev/null grep | test --verbose
+	echo 2>/dev/null then 'quoted text' 'quoted text' export export "$@" $(pwd) sed
+done && test x=1 /usr/bin | printf cd grep ${HOME} done | sed readonly
+	then | "$1" $(pwd) "$@" --verbose -eu sed 'quoted text' /usr/bin
+		x=1 'quoted text' test && grep
+	2>/dev/null printf done export && && printf ${HOME}
+	awk then local && 2>/dev/null -eu cd /usr/bin && echo printf --verbose
+		done ${HOME} export done printf export
+"$1" then x=1 /usr/bin grep local test local printf -eu test "$@"
+	awk then echo test /usr/bin then 2>/dev/null /usr/bin
+	local | $(pwd) then ${HOME} awk | | printf printf done && 2>/dev/null
+printf sed 2>/dev/null echo "$1" | | 2>/dev/null
+	-eu then sed | awk cd --verbose
+-eu 2>/dev/null 'quoted text' cd && export awk 2>/dev/null
+sed local ${HOME} | echo done ${HOME} | grep
+		x=1 local $(pwd) x=1 test export
+	awk export printf -eu test done test 2>/dev/null
+sed awk export $(pwd) /usr/bin test export 'quoted text' -eu &&
+	printf export echo printf test export "$1" echo
+	2>/dev/null 2>/dev/null | && readonly export
+		| cd 2>/dev/null then grep awk awk grep local x=1
+"$@" $(pwd) echo "$@" export "$1" readonly local && && test 'quoted text'
+"$1" awk "$@" done sed printf 'quoted text' sed export local
+	then test 2>/dev/null done
+	done /usr/bin -eu --verbose sed 'quoted text'
+2>/dev/null cd /usr/bin "$1" echo printf | export
+sed echo "$@" -eu printf $(pwd) cd $(pwd) ${HOME} "$1" sed export --verbose
+done "$@" && 'quoted text' && ${HOME} 2>/dev/null export
+		"$1" --verbose done cd awk grep 2>/dev/null 'quoted text' "$1" "$@" &&
+		"$1" printf 'quoted text' cd test "$@" readonly grep -eu
+		--verbose "$@" ${HOME} 2>/dev/null local done && local --verbose
+	grep local 2>/dev/null | grep $(pwd) grep
+local printf "$@" 2>/dev/null ${HOME} /usr/bin ${HOME}
+/usr/bin | ${HOME} 2>/dev/null
+#include c148.sh
+awk | && done export grep cd
+	2>/dev/null local -eu $(pwd) test 2>/dev/null local
+	local -eu -eu export
+		-eu $(pwd) /usr/bin then --verbose $(pwd)
+"$@" grep 2>/dev/null grep /usr/bin sed done done readonly
+		then -eu --verbose $(pwd)
+-eu export && | echo 2>/dev/null done
+		done cd awk ${HOME} printf ${HOME} export -eu $(pwd) -eu awk sed 'quoted text'
+		${HOME} $(pwd) "$1" readonly ${HOME} "$@" then ${HOME} --verbose -eu
+	"$@" "$@" local done export x=1 local "$1" then
+	| cd local readonly cd | grep && 2>/dev/null -eu grep
+	x=1 grep readonly 'quoted text' && --verbose 'quoted text'
+x=1 2>/dev/null echo "$1" echo x=1
+		| "$1" 2>/dev/null "$@" && x=1
+awk export printf grep
+awk readonly "$@" && $(pwd) echo /usr/bin
+	/usr/bin && "$@" "$1" test && 2>/dev/null
+sed then ${HOME} -eu "$@" export echo printf
+	/usr/bin sed echo 2>/dev/null then 'quoted text' && --verbose /usr/bin
+"$1" test 2>/dev/null grep echo readonly
+	printf x=1 awk cd $(pwd) awk 2>/dev/null 'quoted text' /usr/bin
+readonly local done && --verbose && grep 2>/dev/null
+-eu export grep readonly ${HOME} done
+		done cd printf test done grep "$1" printf /usr/bin
+		"$1" ${HOME} 'quoted text'
+"$@" $(pwd) ${HOME} -eu sed "$1" -eu --verbose done grep 2>/dev/null
+		-eu "$@" /usr/bin ${HOME} local 'quoted text' sed done printf awk 'quoted text'
+		test cd grep | sed /usr/bin printf awk "$@" "$1"
+	export grep && $(pwd) "$1" x=1 readonly awk 'quoted text' readonly
+	grep export && export cd
+echo readonly grep $(pwd) local -eu then grep --verbose
+local 2>/dev/null | $(pwd) grep export 'quoted text' echo
+	printf "$1" -eu ${HOME} "$@" "$1" readonly sed ${HOME} /usr/bin $(pwd) done $(pwd)
+	'quoted text' $(pwd) $(pwd) grep echo $(pwd) cd ${HOME}
+		'quoted text' grep 'quoted text' readonly sed readonly printf test $(pwd)
+	${HOME} then ${HOME} local "$@" "$1" && readonly readonly
+		export $(pwd) sed ${HOME} local test done printf --verbose
+echo --verbose export -eu readonly
+		&& "$1" done sed x=1 "$1" /usr/bin
+		${HOME} | --verbose printf
+	&& awk then readonly "$@" $(pwd) "$1" then local cd /usr/bin
+	local grep 2>/dev/null cd x=1 then export | "$@" x=1 "$1" "$@" readonly
+	"$1" "$@" awk readonly --verbose then done ${HOME} sed
+'quoted text' local && local grep then 'quoted text' | "$1" 2>/dev/null
+		cd cd 'quoted text' "$1" local
+/usr/bin x=1 done --verbose -eu awk local --verbose 'quoted text'
+		2>/dev/null grep ${HOME} 'quoted text'
+done "$@" grep readonly
+		echo done readonly grep then test test && /usr/bin 'quoted text' "$@"
+		'quoted text' printf --verbose cd local && 'quoted text'
+		test test cd | test cd then export x=1 readonly &&
+		| cd cd "$@" echo grep /usr/bin grep done x=1
+		-eu sed | sed 2>/dev/null && cd awk "$@" x=1 "$1" -eu |
+	done then done awk echo sed x=1 awk then --verbose "$1"
+		/usr/bin 2>/dev/null "$@" cd &&
+	local /usr/bin echo --verbose
+	"$1" && | | x=1 test printf test grep 'quoted text'
+		${HOME} -eu ${HOME} $(pwd) "$1" $(pwd)
+		echo test printf test echo ${HOME} --verbose && export export 'quoted text'
+&& "$1" awk x=1 /usr/bin then readonly printf echo 2>/dev/null | --verbose
+	/usr/bin "$@" cd sed echo | local ${HOME} "$@" sed readonly done "$1" -eu 2>/dev/null
+		"$@" printf readonly ${HOME} printf done | echo -eu | grep awk "$1"
+"$@" grep /usr/bin ${HOME} awk cd && echo test echo local
+	local /usr/bin && echo printf awk printf 2>/dev/null grep
+	awk 'quoted text' && cd $(pwd)
+&& "$@" "$1" $(pwd) printf 'quoted text' export local local done
+	2>/dev/null --verbose done done sed -eu | sed
+| x=1 2>/dev/null --verbose 'quoted text' printf "$@" test printf $(pwd)
+	--verbose export | -eu test x=1 printf -eu grep test grep "$1" grep
+	-eu then cd grep echo /usr/bin cd printf
+		&& | $(pwd) sed echo local "$1" export 'quoted text'
+	/usr/bin done echo -eu && ${HOME} export export x=1 x=1 export -eu -eu --verbose
+		| ${HOME} | 2>/dev/null -eu ${HOME} printf test printf x=1 awk
+		printf x=1 && printf grep readonly grep sed export
+		'quoted text' cd readonly x=1 'quoted text' ${HOME} printf sed export
+	sed -eu printf "$1" readonly then x=1 x=1 $(pwd) readonly /usr/bin
+		printf grep /usr/bin done awk echo test /usr/bin
+	grep && | awk 2>/dev/null then local && 'quoted text'
+	/usr/bin ${HOME} done "$1" then 2>/dev/null ${HOME} --verbose sed ${HOME} sed --verbose
+		sed $(pwd) -eu printf sed echo -eu x=1 done then cd "$1" local
+cd ${HOME} 'quoted text' echo "$1" 'quoted text' $(pwd)
+x=1 | ${HOME} then awk done 2>/dev/null printf echo local && ${HOME} cd
+		2>/dev/null sed ${HOME} x=1 echo then "$1" awk readonly local
+${HOME} "$1" test then echo done --verbose 'quoted text' /usr/bin then "$@"
+-eu $(pwd) && | done "$@" --verbose test awk ${HOME} -eu x=1 printf
+2>/dev/null grep then "$@" test $(pwd) 2>/dev/null grep
+	--verbose -eu test --verbose $(pwd) /usr/bin -eu readonly
+"$1" /usr/bin export readonly 'quoted text'
+		$(pwd) test ${HOME} && grep cd /usr/bin
+awk grep then readonly ${HOME} cd $(pwd) printf "$1" x=1 'quoted text' cd
+printf && cd "$1" test x=1 ${HOME} "$1" echo
+	test | x=1 printf && test export
+	readonly --verbose $(pwd) printf -eu echo awk awk export awk ${HOME}
+export "$@" cd | --verbose ${HOME} done | awk export readonly done
+	echo ${HOME} then && && sed readonly ${HOME} echo awk 'quoted text' && --verbose
+		cd && readonly readonly awk -eu ${HOME}
+		2>/dev/null && /usr/bin
+sed test export then readonly done x=1 $(pwd) local /usr/bin awk then
+		/usr/bin && then readonly "$1" grep -eu
+	-eu | -eu echo && cd awk sed $(pwd) "$@" test test
+"$@" local /usr/bin then cd cd $(pwd) && | cd printf readonly
+	awk /usr/bin export readonly x=1 test done
+cd sed readonly "$1" $(pwd) printf "$1" awk awk
+		local echo && | cd 'quoted text' |
+cd grep grep grep &&
+	sed printf | 2>/dev/null readonly x=1 | then --verbose
+	export "$1" 'quoted text' cd ${HOME} cd -eu cd
+-eu ${HOME} done /usr/bin readonly | export readonly && 2>/dev/null
+		then cd /usr/bin 'quoted text' done 'quoted text' x=1 awk
+printf cd && then "$1" /usr/bin && x=1 export printf
+		printf then 2>/dev/null then awk "$1" | | ${HOME}
+then then then /usr/bin done -eu awk "$1" $(pwd) echo cd then cd export -eu 'quoted text'
+		export x=1 --verbose $(pwd) 'quoted text' cd 2>/dev/null test done x=1 test
+	x=1 awk --verbose --verbose | awk printf ${HOME}
+awk export --verbose $(pwd) && local | | readonly grep "$1"
+		"$1" sed awk && awk $(pwd) cd "$1" 2>/dev/null "$1" printf && -eu --verbose
+sed grep ${HOME} awk "$@"
+-eu readonly 'quoted text' cd export && ${HOME}
+&& test then printf /usr/bin done done && export ${HOME} sed 2>/dev/null
+		$(pwd) export test "$1" 'quoted text' done cd sed readonly export 'quoted text'
+	--verbose ${HOME} local then 'quoted text' sed ${HOME}
+cd && readonly readonly && && 2>/dev/null local
+"$@" readonly sed "$@" && export 'quoted text'
+		/usr/bin grep "$1" cd echo printf export
+	x=1 "$1" $(pwd) "$@" readonly sed --verbose
+		sed grep "$@" x=1 | test | test test -eu sed "$@" awk
+		"$1" test awk export "$@" "$1"
+	grep | ${HOME} printf readonly echo x=1 /usr/bin | local 2>/dev/null
+		test "$@" 'quoted text' grep 2>/dev/null sed awk
+	/usr/bin test done 'quoted text' then awk /usr/bin ${HOME} local grep awk ${HOME}
+		--verbose ${HOME} sed readonly
+		"$@" export readonly local ${HOME} cd $(pwd) sed local --verbose | "$1" /usr/bin
+echo grep export x=1 -eu
+/usr/bin printf cd test x=1 then 2>/dev/null
+		sed -eu "$@" 2>/dev/null 2>/dev/null awk -eu | -eu "$1" "$@" x=1 done awk
+local grep 2>/dev/null printf --verbose --verbose then local local /usr/bin
+$(pwd) done done printf ${HOME} 'quoted text' "$1" --verbose
+		readonly printf x=1 then
+done "$1" && grep "$@" ${HOME} cd --verbose $(pwd) printf cd /usr/bin grep x=1
+	x=1 local echo grep $(pwd) then cd "$@" test cd sed $(pwd) "$@" x=1 $(pwd)
+	export 'quoted text' "$1" && $(pwd) export && 'quoted text'
+	echo grep test test --verbose "$@" "$@" done --verbose export "$@" export test
+	x=1 x=1 cd "$@" export cd ${HOME} 'quoted text'
+printf 2>/dev/null echo -eu printf -eu
+	export 2>/dev/null sed local $(pwd)
+		then readonly local $(pwd) "$@" "$@" $(pwd) test 2>/dev/null
+		x=1 /usr/bin /usr/bin then sed "$1" 'quoted text' 2>/dev/null
+	awk 'quoted text' grep "$1" 'quoted text' --verbose
+awk -eu "$1" && local done echo echo "$1" readonly -eu done && 'quoted text' printf
+	-eu then ${HOME} grep sed printf --verbose 'quoted text'
+		test grep local x=1 | awk "$@" "$@" $(pwd) done /usr/bin 2>/dev/null
+printf 'quoted text' --verbose grep x=1 x=1 ${HOME} 2>/dev/null --verbose sed
+$(pwd) cd 2>/dev/null export test $(pwd)
+		${HOME} echo export ${HOME} "$1" test x=1 /usr/bin "$@"
+$(pwd) | printf sed -eu sed && "$@" ${HOME} test | ${HOME} done grep
+		cd printf | done export awk --verbose echo cd awk test
+	cd awk "$@" /usr/bin --verbose done "$@" done --verbose "$1" $(pwd)
+		x=1 && "$@" readonly awk "$@" then sed -eu x=1
+	$(pwd) | 'quoted text' cd ${HOME} -eu "$1" printf /usr/bin && x=1 readonly 2>/dev/null
+		export then printf echo readonly grep
+		sed then done $(pwd) awk
+export x=1 sed "$@" "$@" local --verbose "$@" grep grep
+		x=1 /usr/bin ${HOME} ${HOME} sed 'quoted text' -eu "$@" export done
+export "$@" 'quoted text' test ${HOME} done "$1" done && test "$@"
+		local local test 2>/dev/null grep "$1" "$@" readonly then --verbose
+	grep 2>/dev/null | grep | grep
+		then then && sed printf local -eu test $(pwd)
+		grep /usr/bin 'quoted text' "$@" $(pwd) x=1 ${HOME}
+		"$1" echo $(pwd) && 'quoted text' grep grep | && 'quoted text' printf
+		test sed awk cd && test export
+&& then $(pwd) --verbose then test x=1 done
+echo | /usr/bin --verbose ${HOME} grep
+	sed --verbose $(pwd) "$@" 'quoted text'
+		--verbose export && 2>/dev/null x=1 done local "$@" cd 2>/dev/null "$@" x=1
+-eu x=1 "$@" echo echo 'quoted text'
+		&& /usr/bin then 'quoted text'
+	2>/dev/null ${HOME} -eu test && /usr/bin sed awk --verbose
+'quoted text' export cd grep grep | ${HOME} local printf &&
+sed sed /usr/bin 'quoted text' readonly -eu echo printf --verbose done
+		then && test -eu 2>/dev/null /usr/bin done --verbose
+	done sed local printf x=1 --verbose echo /usr/bin echo $(pwd)
+$(pwd) test awk 'quoted text' x=1 && awk /usr/bin
+&& --verbose | --verbose then readonly
+		'quoted text' sed "$@" ${HOME} $(pwd) --verbose
+	printf ${HOME} x=1 "$@" | local
+"$@" 2>/dev/null 2>/dev/null
+readonly --verbose awk then $(pwd) -eu then sed --verbose grep "$@" test sed grep
+echo echo --verbose 2>/dev/null export "$@" printf 'quoted text' | then
+	awk cd 'quoted text' grep "$1" | && x=1 local "$1" readonly sed
+	cd 'quoted text' /usr/bin awk grep 2>/dev/null printf /usr/bin echo then
+	cd 2>/dev/null -eu local grep
+		test cd local then 'quoted text' readonly echo 'quoted text'
+	"$@" | x=1 2>/dev/null 'quoted text' grep -eu ${HOME} 'quoted text'
+		grep export then cd "$1" sed /usr/bin readonly readonly "$1" 2>/dev/null grep grep
+		grep $(pwd) "$1" | awk && cd x=1 test printf
+x=1 'quoted text' --verbose "$@" printf | 'quoted text'
+${HOME} x=1 export "$1" -eu $(pwd) local $(pwd) awk $(pwd)
+sed printf /usr/bin x=1 2>/dev/null
+		done cd done --verbose readonly sed $(pwd) /usr/bin
+	"$@" ${HOME} grep /usr/bin export
+		/usr/bin grep "$1" | 2>/dev/null "$1" "$1" 'quoted text' $(pwd) --verbose
+	-eu --verbose cd grep printf $(pwd) printf done readonly "$@" | "$1" --verbose
+	echo && $(pwd) grep printf --verbose then x=1 | printf -eu readonly ${HOME}
+export ${HOME} --verbose
+"$@" test "$@" | printf
+	then | 'quoted text' "$1" 2>/dev/null local then x=1 done "$@" "$@" local awk
+	sed ${HOME} $(pwd) printf 2>/dev/null 2>/dev/null "$@"
+readonly local --verbose "$@" printf export ${HOME} echo export local cd
+		cd /usr/bin echo awk test && "$@" 2>/dev/null | 2>/dev/null then readonly x=1 $(pwd)
+		'quoted text' --verbose cd sed grep 'quoted text' 2>/dev/null
+then -eu 'quoted text' "$@" --verbose
+	awk awk grep then && 'quoted text'
+readonly 2>/dev/null printf -eu ${HOME} "$1" then | readonly ${HOME} $(pwd)
+		"$@" "$@" --verbose | && then && 2>/dev/null -eu -eu echo $(pwd) -eu x=1 local
+		$(pwd) --verbose readonly | printf ${HOME} cd printf
+sed done export done readonly ${HOME} cd
+	grep "$1" 2>/dev/null /usr/bin x=1 /usr/bin "$1"
+	readonly --verbose then $(pwd) readonly cd -eu local 'quoted text'
+		-eu sed ${HOME} awk printf then export sed -eu "$@" awk -eu test
+-eu && grep done cd 'quoted text' "$1" export
+		grep sed ${HOME} readonly -eu then grep test
+		/usr/bin sed export --verbose $(pwd) --verbose test local | grep "$@" | cd export
+		/usr/bin test 2>/dev/null
+	x=1 $(pwd) done | awk 2>/dev/null
+readonly "$1" test test echo local ${HOME} cd $(pwd) | 2>/dev/null test sed
+		done cd -eu readonly -eu --verbose test "$1" $(pwd)
+test test grep 2>/dev/null
+	export export grep -eu cd export then | "$@" test
+		'quoted text' cd readonly "$1"
+		/usr/bin "$@" x=1 'quoted text' 'quoted text' 2>/dev/null
+	awk ${HOME} && 2>/dev/null -eu "$@" then echo export
+	printf local export echo -eu
+		-eu 'quoted text' local 'quoted text' test then --verbose
+		awk awk cd printf && "$1" printf readonly /usr/bin $(pwd) awk
+		then grep awk 2>/dev/null "$@" cd x=1
+	--verbose --verbose "$1" cd
+		x=1 | x=1 --verbose echo
+		printf printf local sed
+2>/dev/null then $(pwd)
+2>/dev/null /usr/bin -eu "$1" -eu sed done awk
+	${HOME} | | 2>/dev/null $(pwd) printf "$1" sed && grep | --verbose 'quoted text'
+		test readonly -eu grep awk grep $(pwd) | x=1 echo "$1"
+	"$@" 2>/dev/null ${HOME} echo
+	awk && local ${HOME} 'quoted text' -eu printf grep
+		-eu echo ${HOME} "$@" 2>/dev/null
+local sed ${HOME} 'quoted text'
+	x=1 export x=1 awk grep printf $(pwd)
+		printf --verbose $(pwd) 2>/dev/null done done 2>/dev/null
+		grep | ${HOME} then && "$@" done x=1 ${HOME} local -eu printf
+	&& "$1" "$@" ${HOME} ${HOME} done then awk export sed ${HOME} cd cd -eu x=1 | printf
+		/usr/bin then --verbose done then readonly "$@" readonly "$1" test x=1
+		local readonly 2>/dev/null awk 2>/dev/null ${HOME} | -eu then && awk ${HOME} 2>/dev/null
+readonly "$1" cd cd local x=1 printf | "$1"
+		export x=1 test 'quoted text' && "$1" readonly && awk
+		done grep local -eu "$1" /usr/bin echo --verbose 'quoted text'
+awk "$1" then "$@" -eu "$1" -eu printf sed done 2>/dev/null
+		-eu $(pwd) ${HOME} awk | | --verbose
+	&& "$1" echo cd 2>/dev/null test echo
+		printf "$1" 2>/dev/null printf -eu sed x=1 done sed
+sed "$@" && done grep done awk x=1 grep then test grep export ${HOME} && printf
+test | local test /usr/bin --verbose export test then test sed test ${HOME}
+		"$1" echo "$@" sed printf /usr/bin "$1" | export "$1" x=1 2>/dev/null --verbose
+		x=1 local --verbose $(pwd) "$1" awk $(pwd) -eu
+		then "$1" export --verbose "$1" /usr/bin grep && "$@" $(pwd) then
+&& /usr/bin /usr/bin ${HOME} "$1" sed /usr/bin cd local
+	$(pwd) export "$1" then awk | local x=1 2>/dev/null export
+	2>/dev/null 'quoted text' "$@" awk 'quoted text' $(pwd) awk echo | export
+awk 2>/dev/null "$1" /usr/bin local echo && then ${HOME}
+	printf ${HOME} grep echo | ${HOME} $(pwd)
+		grep ${HOME} "$1" 2>/dev/null readonly x=1 /usr/bin
+sed sed $(pwd) $(pwd) --verbose ${HOME} 2>/dev/null
+-eu grep x=1 $(pwd) local ${HOME} $(pwd) sed local cd printf
+	echo test && echo done sed echo printf x=1 /usr/bin --verbose
+		&& "$1" printf 'quoted text' $(pwd) /usr/bin 'quoted text'
+		export --verbose test -eu cd then cd 2>/dev/null
+${HOME} local && "$@" x=1 test
+/usr/bin then echo printf grep test
+		2>/dev/null 'quoted text' export ${HOME} printf ${HOME} && "$@"
+${HOME} done && x=1 "$1" -eu awk done -eu | x=1 readonly
+		awk --verbose printf echo grep export --verbose /usr/bin
+		grep local local then then
+		sed test echo $(pwd) export ${HOME} grep echo | export
+	printf done ${HOME} awk && awk done
+2>/dev/null then | sed && echo printf local |
+	done echo && --verbose $(pwd) "$1" 2>/dev/null /usr/bin x=1 then "$1"
+		x=1 awk export local && cd ${HOME} readonly x=1 grep test ${HOME} export
+		test $(pwd) printf ${HOME} $(pwd) x=1 grep "$@" ${HOME} ${HOME}
+/usr/bin 'quoted text' $(pwd) 2>/dev/null
+local /usr/bin export
+		/usr/bin -eu -eu /usr/bin echo $(pwd) test 'quoted text'
+	$(pwd) --verbose echo /usr/bin local /usr/bin
+		$(pwd) awk sed "$1" && && /usr/bin
+		| readonly 2>/dev/null test
+		'quoted text' test printf export test --verbose
+done then sed | -eu export sed ${HOME} | awk /usr/bin 'quoted text' "$1"
+"$@" printf sed 2>/dev/null test && ${HOME}
+	printf /usr/bin "$@" --verbose
+'quoted text' readonly echo | && export test grep cd && done then test done
+/usr/bin "$@" $(pwd) awk
+		'quoted text' local grep
+local ${HOME} awk cd sed awk then echo
+	awk local grep echo done export sed 2>/dev/null | | cd /usr/bin test
+	'quoted text' | 2>/dev/null 2>/dev/null 2>/dev/null echo local "$@" 2>/dev/null
+		local "$@" 'quoted text' done sed echo
+readonly ${HOME} printf readonly echo echo awk test 'quoted text' "$1" -eu --verbose
+	grep 2>/dev/null 2>/dev/null sed 2>/dev/null
+		export x=1 x=1 /usr/bin --verbose test local readonly readonly "$1" local
+2>/dev/null done 'quoted text' test then sed && "$@" ${HOME} echo x=1 ${HOME}
+		then export done awk test printf ${HOME} $(pwd) grep local then
+${HOME} then /usr/bin cd /usr/bin
+readonly -eu awk $(pwd) local 'quoted text' export printf
+	cd "$@" | x=1 2>/dev/null readonly "$@" 2>/dev/null cd local 'quoted text'
+		printf then -eu then $(pwd)
+	'quoted text' local $(pwd) printf "$@" then sed cd done /usr/bin test 'quoted text'
+done test cd | awk printf echo sed test awk local 2>/dev/null
+		sed echo awk done --verbose $(pwd) readonly ${HOME} x=1 -eu printf
+done printf 'quoted text' | | x=1 x=1
+	'quoted text' grep "$1" $(pwd)
+	"$1" sed grep "$@" /usr/bin
+readonly 'quoted text' done printf -eu done printf
+		readonly --verbose -eu x=1 grep sed done -eu "$1" test x=1
+		done cd && test awk x=1 -eu ${HOME}
+grep awk -eu export sed 'quoted text' test cd x=1 test $(pwd) test /usr/bin /usr/bin
+'quoted text' "$@" local printf export grep readonly printf x=1 ${HOME} 'quoted text'
+	cd && "$1" 'quoted text' ${HOME} printf
+'quoted text' printf sed readonly "$@"
+printf && "$1" /usr/bin -eu sed test
+cd readonly $(pwd) local | $(pwd) /usr/bin "$1" -eu grep export 'quoted text'
+	$(pwd) then $(pwd) sed 2>/dev/null 2>/dev/null test
+		export then | readonly $(pwd) awk /usr/bin | then $(pwd) grep done printf 'quoted text'
+then x=1 then 2>/dev/null readonly /usr/bin echo then
+		$(pwd) 'quoted text' ${HOME} x=1 /usr/bin
+		"$1" then cd export | 2>/dev/null printf -eu readonly | cd | done local
+		echo --verbose && -eu x=1 --verbose $(pwd) -eu export sed $(pwd) echo && then
+	'quoted text' grep $(pwd) local
+		grep | --verbose "$@" x=1 /usr/bin | x=1 x=1
+	"$1" x=1 'quoted text' local "$@" local readonly 'quoted text' | $(pwd)
+		x=1 local 2>/dev/null readonly local export ${HOME} $(pwd) then
+echo /usr/bin local test
+	export "$@" /usr/bin | $(pwd) 'quoted text' -eu -eu printf $(pwd)
+&& -eu "$@" 2>/dev/null readonly "$@" cd -eu then
+-eu "$1" then /usr/bin awk --verbose done local 2>/dev/null
+		${HOME} x=1 "$@" "$@" sed && done sed $(pwd) "$@" awk
+printf "$@" printf 'quoted text' "$@"
+	test 'quoted text' 'quoted text' sed readonly echo $(pwd)
+awk | $(pwd) local ${HOME} test
+	done | awk "$1" grep printf "$1" sed 2>/dev/null
+		echo export grep export grep grep "$@" 'quoted text'
+	$(pwd) readonly sed printf done local grep x=1 readonly
+		&& grep "$1" 2>/dev/null done | local
+		&& "$@" printf local cd "$1" --verbose local
+	readonly 'quoted text' cd done awk
+$(pwd) x=1 /usr/bin /usr/bin local /usr/bin
+${HOME} awk "$@" && export then echo cd test readonly export grep "$1" x=1 --verbose
+"$@" /usr/bin local x=1 $(pwd)
+	| readonly cd -eu test done echo /usr/bin export local -eu &&
+		printf done 'quoted text' test grep "$@" "$@" $(pwd) "$@" readonly
+	grep -eu grep then then
+	x=1 /usr/bin ${HOME} then
+		then 'quoted text' grep cd printf x=1 -eu ${HOME} then x=1
+	local | /usr/bin -eu cd x=1 /usr/bin cd echo readonly printf 2>/dev/null local
+	then sed printf then x=1 /usr/bin printf && cd readonly 2>/dev/null
+		/usr/bin sed cd --verbose 2>/dev/null printf $(pwd) 'quoted text'
+	--verbose cd "$1" sed && echo $(pwd) /usr/bin
+readonly done grep grep --verbose cd "$1" sed
+cd local -eu echo "$@" local done -eu "$@" local grep "$1" grep && | test x=1 readonly
+	export -eu grep /usr/bin "$@" awk export
+		$(pwd) awk | then echo 'quoted text' ${HOME} -eu "$1" export x=1 -eu
+		/usr/bin printf "$@" awk
+done "$@" echo ${HOME} "$1" && cd $(pwd) --verbose then && ${HOME} export test
+	"$1" x=1 'quoted text' sed $(pwd) export done x=1 /usr/bin
+'quoted text' /usr/bin && echo | "$1" cd echo test -eu sed | ${HOME} 2>/dev/null
+	--verbose x=1 done --verbose
+		then echo local export "$1"
+/usr/bin export then then /usr/bin x=1 test test 'quoted text' cd export
+$(pwd) awk "$@" done 'quoted text' export export test cd x=1 --verbose
+	${HOME} -eu sed grep ${HOME} 'quoted text'
+		${HOME} /usr/bin 'quoted text' echo
+	&& -eu sed export grep export "$1" readonly printf --verbose
+		then sed && readonly && 'quoted text' then
+		then "$1" echo 2>/dev/null "$@" x=1 local
+		printf grep done local 'quoted text' then x=1 awk ${HOME} then --verbose && -eu
+	export readonly readonly printf readonly echo x=1 export "$1" | ${HOME}
+		"$1" done echo sed awk sed readonly && then -eu printf grep &&
+		| printf export --verbose | local printf && "$@" | 'quoted text' ${HOME}
+	echo --verbose x=1 /usr/bin local cd 'quoted text'
+		-eu --verbose awk sed "$1" /usr/bin
+	grep readonly test echo done readonly --verbose
+echo cd "$1" local $(pwd) then cd done --verbose ${HOME} test test "$@"
+		/usr/bin 2>/dev/null --verbose export sed export
+	-eu x=1 ${HOME} done "$@" -eu "$1" done | "$1" ${HOME} && "$@"
+		"$1" && printf "$@" | -eu export export cd $(pwd)
+	echo && sed export export && /usr/bin
+	test grep export done --verbose test | /usr/bin | "$@" cd printf
+	"$1" export ${HOME} awk export export sed local echo done
+		test grep then export | $(pwd) ${HOME} export | "$@" printf
+export "$@" 2>/dev/null $(pwd) readonly --verbose
+		cd ${HOME} x=1 "$1" /usr/bin 2>/dev/null local test && export
+		sed -eu x=1 cd readonly grep printf done
+export ${HOME} local 2>/dev/null test printf printf "$1" then local x=1
+export done then /usr/bin
+	export done awk && local awk "$@" --verbose | | echo "$1" /usr/bin x=1
+	--verbose awk cd x=1 x=1 |
+		done "$@" /usr/bin --verbose cd && x=1 awk done /usr/bin --verbose 'quoted text'
+done readonly "$@" "$1" "$1" export test
+		printf local $(pwd) && x=1 "$@" "$@" grep 'quoted text'
+export done ${HOME} test cd | done export 'quoted text' | local
+	x=1 "$1" && | --verbose cd readonly
+	cd done | echo done done /usr/bin done ${HOME} 'quoted text'
+	'quoted text' --verbose | | grep $(pwd) "$@" "$1" /usr/bin
+	'quoted text' --verbose ${HOME} export x=1
+		readonly x=1 2>/dev/null grep
+		$(pwd) test --verbose "$@" x=1 /usr/bin
+		sed test "$@" --verbose export x=1 && awk cd echo printf local
+	| ${HOME} local printf local && sed "$@" | 'quoted text' -eu cd --verbose
+	x=1 | cd -eu "$1" awk export | printf grep printf cd then --verbose echo awk cd
+	| --verbose 2>/dev/null /usr/bin "$@" "$1" readonly export local /usr/bin
+| echo "$1" x=1 x=1 readonly local ${HOME}
+$(pwd) /usr/bin echo echo awk printf awk "$1" x=1 && -eu 'quoted text'
+sed "$@" awk --verbose "$@" x=1 -eu printf done && $(pwd) x=1 -eu 'quoted text'
+readonly && "$1" local echo export
+		--verbose -eu && "$@" && 'quoted text' x=1 x=1 && $(pwd) /usr/bin
+test 'quoted text' echo "$1" x=1 2>/dev/null 'quoted text' echo printf echo
+	export 'quoted text' "$1" | test /usr/bin test /usr/bin echo "$@"
+		$(pwd) /usr/bin awk awk done test export
+		grep export "$@" 'quoted text' && done grep /usr/bin local
+$(pwd) awk local ${HOME}
+echo "$@" x=1 --verbose x=1 cd
+		printf 2>/dev/null readonly --verbose x=1 -eu $(pwd) done readonly
+"$@" then && | awk ${HOME} && printf 2>/dev/null cd
+	local $(pwd) printf readonly cd /usr/bin &&
+	export $(pwd) grep test 2>/dev/null cd -eu && "$1" export
+	"$1" sed printf echo "$1" x=1 export /usr/bin grep
+		x=1 printf $(pwd) echo --verbose cd ${HOME} && readonly -eu ${HOME} x=1 export
+		&& 'quoted text' grep echo local x=1 test readonly export
+	done export cd -eu x=1 "$1" /usr/bin then && done
+		printf 2>/dev/null then | local --verbose readonly "$1" 2>/dev/null
+	"$1" /usr/bin $(pwd) test /usr/bin
+awk ${HOME} "$1" "$@" $(pwd) ${HOME} "$@"
+	export done sed /usr/bin sed && printf "$@" --verbose
+	-eu $(pwd) local x=1 'quoted text' sed && "$@" 2>/dev/null "$1" then test | $(pwd)
+	echo cd 2>/dev/null 2>/dev/null printf 'quoted text' readonly x=1 && awk grep
+	"$1" test 2>/dev/null | /usr/bin
+		awk 'quoted text' test grep x=1 then printf
+echo 2>/dev/null -eu cd grep -eu awk ${HOME} echo -eu test /usr/bin
+--verbose x=1 "$1" printf
+	local grep readonly /usr/bin sed /usr/bin test && -eu "$1" /usr/bin grep local
+		export "$@" -eu --verbose /usr/bin | awk 2>/dev/null --verbose x=1 && $(pwd)
+		"$@" test 'quoted text' --verbose ${HOME} echo printf then && local test then
+	readonly "$@" awk then --verbose
+--verbose "$@" test readonly 2>/dev/null readonly
+		export -eu local "$1" $(pwd)
+		grep /usr/bin awk test sed readonly grep done 2>/dev/null | grep
+	then ${HOME} "$@" done awk done && "$@" done 'quoted text'
+	--verbose printf 'quoted text' x=1 2>/dev/null 'quoted text' "$1" then
+-eu x=1 x=1 sed /usr/bin 2>/dev/null printf "$@"
+		grep x=1 $(pwd) -eu ${HOME}
+		"$@" test grep ${HOME} 2>/dev/null grep && && sed done "$1" grep -eu awk
+	"$@" "$1" local awk local | cd cd then readonly
+--verbose 2>/dev/null -eu "$@" cd ${HOME} ${HOME} 'quoted text' /usr/bin ${HOME}
+cd 2>/dev/null done && readonly readonly --verbose echo echo -eu
+		--verbose awk local 'quoted text' x=1 /usr/bin
+		&& /usr/bin "$@" cd "$1" 2>/dev/null
+	${HOME} then 'quoted text' done then "$@" grep readonly
+"$1" | "$@" echo -eu -eu local readonly
+	then printf local sed "$@" 2>/dev/null export -eu test cd && sed readonly
+--verbose 2>/dev/null export 'quoted text' cd | done cd echo grep
+		then --verbose /usr/bin awk --verbose test
+		export 2>/dev/null echo -eu grep cd done 'quoted text' awk
+2>/dev/null test "$1" cd grep
+/usr/bin $(pwd) ${HOME} -eu grep -eu then then 'quoted text' 2>/dev/null
+test /usr/bin 'quoted text' $(pwd) 2>/dev/null
+--verbose printf cd awk grep then readonly
+awk && 'quoted text' readonly cd x=1 test /usr/bin then
+	2>/dev/null then ${HOME} done sed x=1
+"$@" x=1 $(pwd) $(pwd) 'quoted text' ${HOME}
+"$@" grep test -eu export x=1 "$1" x=1 readonly
+"$@" sed 2>/dev/null $(pwd) printf "$@"
+		--verbose printf awk awk 2>/dev/null /usr/bin x=1 x=1 local local
+test sed export --verbose printf export awk
+		"$1" cd test printf -eu "$1" awk then printf grep
+2>/dev/null 2>/dev/null x=1 'quoted text' --verbose
+-eu done 'quoted text' readonly && "$1" cd x=1 x=1 export "$1" ${HOME} "$@"
+done x=1 /usr/bin 2>/dev/null 2>/dev/null
+		printf readonly awk cd export 'quoted text'
+		${HOME} -eu ${HOME} readonly then 'quoted text' "$@" --verbose | printf ${HOME}
+		--verbose export echo then done --verbose 2>/dev/null --verbose grep awk awk cd
+		sed printf x=1 sed readonly | sed 'quoted text' printf cd -eu export local grep
+	grep $(pwd) -eu 2>/dev/null ${HOME} printf "$1" local local grep echo x=1
+"$@" -eu done cd | test echo then
+	"$@" ${HOME} test --verbose "$1" | x=1 readonly
+		printf readonly | done done "$@" printf --verbose done test awk grep
+	test echo ${HOME} done "$@" x=1 && awk "$1" then test 2>/dev/null
+		'quoted text' -eu sed --verbose export
+	-eu echo printf cd $(pwd) ${HOME}
+local test sed grep $(pwd) && then /usr/bin -eu local 'quoted text'
+	test "$1" "$@" && printf test then done awk "$@" test cd "$1"
+		test $(pwd) readonly echo x=1 /usr/bin test /usr/bin && awk done
+	cd x=1 export "$1" echo && x=1 echo then local export export x=1 -eu /usr/bin
+		done cd $(pwd) 'quoted text' "$@" export | test awk cd awk /usr/bin
+echo x=1 export x=1 done "$1"
+		cd cd awk test | then grep
+	sed 2>/dev/null done printf export then 'quoted text' done
+		x=1 "$@" | x=1 -eu && 2>/dev/null
+cd local printf then "$@" | 2>/dev/null test /usr/bin ${HOME} | cd done awk &&
+"$@" --verbose | | && | "$1" 'quoted text'
+then local 2>/dev/null && "$@" done /usr/bin done export done --verbose
+	awk /usr/bin ${HOME} /usr/bin printf awk 2>/dev/null printf sed "$@"
+	"$@" $(pwd) && x=1 x=1 export --verbose done awk
+		printf grep | "$@" && x=1 printf grep "$1"
+		sed x=1 export sed ${HOME} && -eu /usr/bin readonly
+		awk awk grep local ${HOME}
+	export local "$@" "$@" cd | readonly /usr/bin sed cd "$1" x=1 printf then
+		awk awk done 2>/dev/null grep export -eu "$@" -eu test done readonly x=1
+"$@" then && -eu readonly $(pwd) --verbose sed
+	cd 'quoted text' $(pwd) 'quoted text'
+		done export readonly local x=1 done ${HOME}
+		awk ${HOME} readonly | grep awk grep sed | /usr/bin sed $(pwd) x=1 "$1" sed printf
+local x=1 cd 2>/dev/null done ${HOME} && /usr/bin then awk done export
+		export --verbose echo x=1 $(pwd)
+	2>/dev/null ${HOME} --verbose
+	awk then done test ${HOME} then 'quoted text'
+| "$@" printf awk x=1 'quoted text' -eu $(pwd) "$@" readonly 2>/dev/null
+	-eu local "$1" "$@" -eu /usr/bin && test $(pwd) then grep done cd "$1" /usr/bin
+echo --verbose test done /usr/bin "$1" cd "$1" echo
+x=1 local /usr/bin cd readonly awk --verbose done sed then
+&& sed -eu printf awk local echo && then -eu
+		${HOME} readonly test awk local -eu
+		-eu 'quoted text' 2>/dev/null grep x=1 ${HOME}
+		2>/dev/null ${HOME} awk 'quoted text' x=1 echo 2>/dev/null echo | "$@" readonly
+		| export -eu 2>/dev/null cd --verbose $(pwd) 'quoted text'
+	local then ${HOME} "$@" export "$1" echo awk done /usr/bin $(pwd) grep done
+		done /usr/bin x=1 test -eu
+/usr/bin echo test | printf | 2>/dev/null | "$@" awk printf
+		awk 2>/dev/null -eu then -eu sed then 2>/dev/null && echo done done x=1
+echo readonly -eu x=1 --verbose --verbose "$1" "$@" echo x=1 export 'quoted text'
+local 2>/dev/null $(pwd) then test grep "$@" $(pwd)
+cd ${HOME} echo 2>/dev/null
+cd 'quoted text' -eu && export
+		local export | export readonly then "$@" --verbose
+--verbose 'quoted text' printf $(pwd) "$1" local
+'quoted text' then 2>/dev/null && /usr/bin awk -eu printf printf
+		then then /usr/bin 'quoted text' --verbose "$@" then sed $(pwd) --verbose $(pwd)
+2>/dev/null x=1 && echo awk | printf printf echo awk local "$1" $(pwd)
+		"$@" $(pwd) printf export readonly test | "$@" | local | | ${HOME} 'quoted text'
+	then && done -eu awk ${HOME} $(pwd)
+	"$@" ${HOME} --verbose cd
+readonly test $(pwd) $(pwd) export 'quoted text' printf grep | && awk $(pwd)
+	local --verbose "$1" done
+done /usr/bin "$@" printf readonly printf export grep && 2>/dev/null grep --verbose
+	echo done printf grep done && -eu && $(pwd) printf echo export && awk echo $(pwd)
+	/usr/bin ${HOME} -eu "$1" /usr/bin "$1"
+	echo readonly "$1" "$1" && && then | cd grep cd ${HOME} 2>/dev/null /usr/bin
+		${HOME} done done export 'quoted text' | echo export awk --verbose -eu awk
+		test | echo && /usr/bin export
+	local -eu /usr/bin 'quoted text' --verbose awk "$@" cd "$@"
+	done "$1" echo ${HOME}
+	${HOME} /usr/bin && x=1 x=1 --verbose done --verbose "$1" ${HOME} x=1 | 'quoted text'
+	cd then -eu echo | /usr/bin local local
+${HOME} done && printf && "$1" && 'quoted text' awk local awk
+x=1 test "$1" | x=1 done awk "$@" sed 'quoted text'
+		printf echo ${HOME} -eu |
+	${HOME} grep export local "$1"
+then cd $(pwd) /usr/bin 2>/dev/null export $(pwd) | 2>/dev/null
+local --verbose local && awk x=1 && 'quoted text' cd | done test
+	then echo readonly cd "$@" $(pwd) /usr/bin then export export sed
+export sed ${HOME} done done x=1 readonly /usr/bin cd echo "$@"
+/usr/bin /usr/bin | printf 2>/dev/null
+	done ${HOME} /usr/bin && -eu x=1 && export /usr/bin "$@" printf --verbose
+'quoted text' -eu test
+	cd done | -eu "$@" echo echo ${HOME} 'quoted text' sed
+		/usr/bin ${HOME} awk ${HOME} then echo test ${HOME} "$1" readonly | $(pwd) --verbose
+		grep local export echo "$1" -eu test grep
+		grep $(pwd) printf echo | echo then "$1" 'quoted text'
+	| && sed sed printf ${HOME} cd -eu -eu
+| sed cd test grep printf ${HOME} test -eu echo | then local printf test export
+		| -eu local ${HOME} grep
+		local done ${HOME} echo ${HOME} |
+		$(pwd) grep local done $(pwd) ${HOME} "$@" local sed
+&& 2>/dev/null | "$1" done ${HOME}
+	echo readonly x=1 && x=1 grep readonly
+	/usr/bin -eu | cd /usr/bin ${HOME} echo --verbose x=1 x=1 export
+local export $(pwd) printf --verbose 'quoted text' ${HOME} /usr/bin 2>/dev/null
+sed -eu --verbose x=1 export "$1" --verbose then | sed ${HOME} export
+	printf | export then ${HOME} then 'quoted text' /usr/bin cd 'quoted text' | test
+	sed && awk && local cd printf 'quoted text'
+		readonly sed printf local "$@"
+	awk readonly "$@" $(pwd) 2>/dev/null 'quoted text' printf && sed echo test local
+		-eu "$1" 'quoted text' printf |
+sed echo local --verbose -eu 'quoted text'
+2>/dev/null "$@" local 2>/dev/null "$@"
+local "$@" sed $(pwd) printf export
+x=1 awk cd echo /usr/bin printf then local && x=1 ${HOME} grep printf
+		grep ${HOME} printf /usr/bin test
+	2>/dev/null awk /usr/bin then export --verbose -eu awk /usr/bin -eu | -eu
+	echo test done | -eu then 'quoted text' "$1" /usr/bin
+		&& readonly grep /usr/bin printf /usr/bin readonly
+		${HOME} -eu grep $(pwd) sed then
+		cd /usr/bin /usr/bin 'quoted text' export
+		readonly test echo --verbose | export --verbose --verbose
+		'quoted text' cd "$1" readonly "$1" done "$1" -eu sed x=1 'quoted text'
+awk 'quoted text' --verbose 'quoted text' "$@" | 2>/dev/null $(pwd)
+	"$1" local "$1" ${HOME}
+	echo 'quoted text' cd
+		echo "$1" --verbose "$@" echo --verbose 'quoted text' then test "$@" echo
+		&& grep test && /usr/bin done "$1" readonly grep grep && readonly grep && cd test
+	--verbose export "$1" printf printf printf && && done
+	--verbose then then awk ${HOME} 2>/dev/null /usr/bin --verbose
+readonly -eu 2>/dev/null export && && readonly --verbose /usr/bin && done -eu $(pwd)
+	sed && x=1 -eu export grep ${HOME} |
+	done 'quoted text' ${HOME} test
+	sed cd ${HOME} -eu readonly grep 2>/dev/null ${HOME} 'quoted text' ${HOME}
+| export /usr/bin /usr/bin
+	done cd export x=1 $(pwd) then 2>/dev/null ${HOME} && printf "$@" grep test export
+cd "$@" 'quoted text' "$@" test x=1
+		x=1 -eu && ${HOME} -eu $(pwd) grep test "$1"
+&& then printf echo $(pwd) printf
+	-eu grep 'quoted text' x=1 then
+awk done printf done /usr/bin
+test "$@" done awk | done -eu local
+	grep then && echo sed -eu cd export cd && ${HOME} printf "$1" sed readonly
+		2>/dev/null export && export "$1" 'quoted text' done sed echo grep "$1" done |
+$(pwd) test | | 'quoted text' ${HOME} 2>/dev/null | sed
+| cd | ${HOME} $(pwd) sed $(pwd) test awk
+printf sed done test printf test
+		--verbose | export | readonly | /usr/bin
+	&& && x=1 2>/dev/null $(pwd) | /usr/bin awk grep sed --verbose cd printf
+export grep grep done echo then echo ${HOME} local readonly
+2>/dev/null grep | then
+		grep && export test | | -eu $(pwd) export local
+	sed sed -eu echo readonly cd x=1 test && printf "$1" -eu
+		printf /usr/bin | 'quoted text' awk sed echo test export 2>/dev/null
+	&& test | 2>/dev/null 'quoted text'
+x=1 cd "$1" cd then local
+		/usr/bin | 2>/dev/null
+	readonly test awk done
+	--verbose 2>/dev/null sed awk "$1" echo echo readonly printf
+	x=1 grep $(pwd) 2>/dev/null grep 'quoted text' $(pwd) --verbose
+		"$1" readonly grep $(pwd) $(pwd)
+		x=1 local && -eu export $(pwd) echo grep
+		awk ${HOME} grep export | -eu cd | awk x=1 "$1" 2>/dev/null
+then --verbose grep "$1" cd ${HOME} local
+	$(pwd) | done --verbose /usr/bin then test then export readonly
+		readonly --verbose local local
+	echo 2>/dev/null x=1 readonly --verbose
+	awk echo then --verbose && "$1" awk 'quoted text' $(pwd)
+then x=1 test then -eu done x=1 sed awk "$@" x=1 local /usr/bin
+		sed --verbose $(pwd) ${HOME} printf ${HOME} sed && awk x=1 printf ${HOME}
+		x=1 then sed x=1 grep readonly && grep local "$@" printf $(pwd) | 2>/dev/null
+		readonly $(pwd) -eu /usr/bin echo "$@" echo -eu readonly --verbose
+	'quoted text' grep $(pwd) echo grep echo
+	echo && 2>/dev/null 2>/dev/null
+local cd export | ${HOME} sed x=1 printf | && then $(pwd) $(pwd)
+local /usr/bin -eu export ${HOME} done
+		"$1" 'quoted text' --verbose --verbose then test export /usr/bin -eu $(pwd) &&
+	2>/dev/null grep && test local $(pwd) 'quoted text' ${HOME} export awk "$1"
+	test done echo awk "$@" awk test printf $(pwd)
+		cd done printf | echo echo && /usr/bin 2>/dev/null then --verbose grep | cd &&
+| ${HOME} local --verbose -eu "$@" local echo grep
+--verbose x=1 /usr/bin x=1 /usr/bin /usr/bin then "$1" -eu
+		"$1" 'quoted text' x=1 readonly done -eu sed ${HOME} &&
+	awk awk sed cd 'quoted text' then --verbose --verbose 'quoted text' "$1" "$@"
+cd echo --verbose local ${HOME} | x=1 /usr/bin
+awk -eu $(pwd) sed local && 'quoted text' 2>/dev/null export done
+		/usr/bin cd x=1 /usr/bin && printf | sed
+		--verbose readonly readonly
+	then | readonly sed cd grep grep | sed
+2>/dev/null printf && | local done printf
+	2>/dev/null | /usr/bin cd /usr/bin /usr/bin
+	printf readonly readonly /usr/bin done printf
+		"$@" sed echo done x=1 "$1" /usr/bin
+		grep x=1 local printf test done $(pwd) printf export "$@" --verbose readonly -eu
+	sed done grep cd grep --verbose echo
+	"$@" -eu readonly awk
+		awk cd local "$@" readonly && readonly sed "$@" echo | printf --verbose test "$1"
+		$(pwd) then /usr/bin export "$1" awk /usr/bin
+	done local export then 'quoted text' | "$1"
+	| "$@" /usr/bin export --verbose echo then sed test then test sed local
+	echo $(pwd) "$@" | local /usr/bin export printf
+		export then export ${HOME} then x=1 printf "$@" -eu test grep /usr/bin &&
+'quoted text' 'quoted text' local echo "$@" "$@" 'quoted text'
+"$@" grep --verbose "$1" $(pwd) "$@"
+	-eu awk "$1" test | test --verbose -eu -eu test && grep && | printf readonly
+		'quoted text' | | "$@" | | done readonly 2>/dev/null
+		echo printf && 'quoted text' "$@" sed echo grep printf readonly
+	test -eu 2>/dev/null local 'quoted text' cd x=1 |
+		grep $(pwd) grep awk /usr/bin
+		printf $(pwd) grep 'quoted text' | && cd | grep grep 'quoted text'
+	printf then cd $(pwd) 2>/dev/null awk && "$@" "$1" awk x=1 --verbose
+	printf -eu x=1 then echo sed && --verbose echo printf -eu local echo ${HOME}
+"$@" grep && cd x=1 printf then 'quoted text'
+	&& "$1" -eu && done export
+	'quoted text' sed x=1 &&
+		&& $(pwd) awk cd test &&
+	printf awk done ${HOME} 'quoted text' local printf cd ${HOME} sed then
+${HOME} awk printf local x=1 done 2>/dev/null local x=1 then 2>/dev/null echo
+		export sed sed "$1" printf cd done sed 'quoted text' grep "$@" "$@" /usr/bin
+		test && then readonly test printf $(pwd) readonly 2>/dev/null
+	-eu 'quoted text' then 2>/dev/null && export 2>/dev/null readonly /usr/bin
+| then printf grep grep then printf export
+	${HOME} --verbose test awk test test export grep cd | test grep then sed local
+test export sed -eu export "$1" done
+	$(pwd) awk $(pwd) done printf "$@" -eu "$@" /usr/bin $(pwd) | awk
+	| x=1 'quoted text' printf -eu ${HOME} 2>/dev/null printf "$@" 2>/dev/null
+		'quoted text' /usr/bin "$@" -eu local ${HOME} -eu done cd 'quoted text' 2>/dev/null
+		then printf "$@" then 2>/dev/null
+	test 'quoted text' grep ${HOME} echo readonly "$1" 'quoted text'
+$(pwd) then ${HOME} printf test readonly "$1" "$1" -eu done
+	'quoted text' grep readonly echo --verbose
+$(pwd) | "$1" then $(pwd)
+		cd --verbose "$@" /usr/bin sed printf then && printf 'quoted text' printf
+		echo 2>/dev/null 2>/dev/null cd printf echo printf 2>/dev/null
+		export | 'quoted text' 'quoted text' x=1 /usr/bin sed $(pwd) && $(pwd) grep
+		echo test | done 2>/dev/null
+-eu readonly test "$1"
+export echo cd grep then $(pwd)
+	local printf x=1 --verbose done 2>/dev/null x=1 then readonly sed ${HOME} grep
+		2>/dev/null "$1" && echo | 'quoted text' local readonly
+	echo "$@" /usr/bin && local $(pwd) /usr/bin test | ${HOME} ${HOME} "$@" 2>/dev/null
+local grep x=1 grep printf cd "$@"
+then test "$@" printf then readonly awk &&
+	-eu "$@" --verbose then export awk
+grep awk x=1 done $(pwd) 2>/dev/null
+		"$@" test grep cd ${HOME} awk sed readonly grep readonly readonly printf
+printf --verbose 'quoted text' 'quoted text' "$1" -eu "$1" done cd echo 'quoted text'
+		${HOME} awk "$1" done $(pwd) 'quoted text' && x=1 then 'quoted text' cd
+'quoted text' && -eu test | -eu local | export | local 'quoted text'
+	readonly 'quoted text' echo sed awk cd local ${HOME} "$@" done &&
+	2>/dev/null -eu test then
+grep | -eu 'quoted text' /usr/bin && "$1" 'quoted text' 2>/dev/null echo
+	--verbose export -eu 2>/dev/null printf | -eu 2>/dev/null
+echo /usr/bin /usr/bin "$1"
+'quoted text' 2>/dev/null sed | printf
+		sed --verbose echo local readonly readonly local echo sed
+export grep ${HOME} printf cd done local sed 2>/dev/null -eu
+	x=1 | -eu local 2>/dev/null local cd test "$@" $(pwd) 'quoted text'
+		&& export cd awk printf local export printf "$1" x=1 "$1" awk --verbose
+local | test 'quoted text' --verbose awk --verbose local | sed echo
+		2>/dev/null -eu test local then --verbose 2>/dev/null
+	readonly echo /usr/bin 2>/dev/null
+	grep ${HOME} | local readonly x=1 test
+awk /usr/bin sed -eu -eu printf
+	sed $(pwd) $(pwd) then ${HOME} local $(pwd) | sed && "$1" 2>/dev/null
+--verbose ${HOME} && | x=1 awk | echo /usr/bin ${HOME}
+"$@" -eu $(pwd) x=1 && /usr/bin | && cd x=1 "$1" x=1 cd readonly x=1 grep ${HOME}
+	done 2>/dev/null --verbose sed 'quoted text' sed "$1" --verbose awk --verbose
+--verbose $(pwd) --verbose | then
+		test 'quoted text' export then -eu
+cd readonly ${HOME} /usr/bin x=1 readonly awk grep
+	| $(pwd) done | $(pwd) then "$1" printf readonly printf --verbose
+		"$1" test cd export 2>/dev/null 'quoted text' then then grep --verbose
+		readonly -eu 'quoted text' then readonly
+		cd cd -eu then x=1 x=1 local x=1 cd | 'quoted text' cd $(pwd) echo |
+local local cd /usr/bin
+	"$@" local /usr/bin ${HOME}
+echo echo export --verbose sed
+		local 2>/dev/null "$1" && grep
+		then && cd --verbose x=1
+	done then grep && && export --verbose test then --verbose /usr/bin "$@"
+	printf local local "$1" local 2>/dev/null | local
+readonly 2>/dev/null 'quoted text'
+		$(pwd) /usr/bin && sed then /usr/bin sed done then | local echo | printf cd "$1"
+	then ${HOME} sed 2>/dev/null echo export test /usr/bin
+	local then test local grep printf test "$1" cd 2>/dev/null
+	export 2>/dev/null awk | --verbose /usr/bin | cd 2>/dev/null echo local
+		grep cd "$@" printf && && $(pwd) /usr/bin cd /usr/bin 2>/dev/null
+&& --verbose | readonly "$1"
+test /usr/bin test export --verbose
+	x=1 export grep sed x=1 --verbose /usr/bin
+	'quoted text' ${HOME} /usr/bin awk readonly echo 2>/dev/null ${HOME} x=1 local ${HOME}
+/usr/bin ${HOME} "$@" sed 'quoted text'
+	sed "$1" cd cd echo --verbose
+	${HOME} test done printf $(pwd) "$@" cd readonly &&
+		| done local --verbose --verbose then "$@" -eu | cd test "$@" printf --verbose
+	2>/dev/null awk ${HOME} 'quoted text' sed done echo local then
+'quoted text' x=1 /usr/bin test awk $(pwd) printf local x=1
+		echo && --verbose grep test export echo --verbose "$@" && /usr/bin 'quoted text'
+	local export --verbose test && -eu printf
+		${HOME} grep 'quoted text' echo x=1 2>/dev/null --verbose echo readonly --verbose
+	printf then grep done $(pwd) x=1 $(pwd) --verbose $(pwd) readonly "$1" then --verbose
+		'quoted text' readonly echo local printf --verbose echo --verbose readonly "$1"
+	-eu sed $(pwd) $(pwd) 2>/dev/null 'quoted text' -eu
+		printf && echo local local
+	$(pwd) then echo && x=1 printf
+x=1 export echo x=1 && $(pwd) x=1 export grep cd 'quoted text'
+	sed | "$1" awk 'quoted text' local -eu 'quoted text' readonly
+echo readonly $(pwd) --verbose
+	cd awk done -eu /usr/bin && export cd -eu grep
+/usr/bin cd export $(pwd) "$@" $(pwd) readonly x=1 x=1 echo
+| ${HOME} 'quoted text' x=1 local -eu grep export awk 'quoted text'
+	"$@" awk done 'quoted text' cd sed | cd ${HOME} -eu && ${HOME}
+		--verbose readonly --verbose local | 2>/dev/null | /usr/bin
+&& /usr/bin echo ${HOME} 2>/dev/null grep 'quoted text'
+		then then 2>/dev/null then done test --verbose ${HOME}
+		awk echo "$@" done ${HOME} && | readonly awk && 2>/dev/null
+awk export export --verbose 'quoted text' done
+	sed local -eu printf "$1" "$@" sed
+"$1" && awk awk printf cd && then
+		sed echo --verbose printf then printf grep done
+	printf "$@" sed "$1" | "$1" "$1" "$1" awk done cd $(pwd)
+		readonly | cd "$1" && cd done
+		| grep sed x=1 export printf /usr/bin 2>/dev/null
+	x=1 then x=1 printf | "$1" && ${HOME} readonly grep sed /usr/bin && x=1 &&
+echo /usr/bin ${HOME} 'quoted text'
+		'quoted text' grep 2>/dev/null ${HOME} | --verbose readonly cd
+	&& 2>/dev/null echo 2>/dev/null printf | $(pwd) printf $(pwd) awk
+		cd $(pwd) grep sed cd cd $(pwd) && export printf local echo ${HOME}
+export && -eu grep printf printf 'quoted text' "$@" 2>/dev/null
+| awk echo readonly "$1" | "$@" 'quoted text' 2>/dev/null ${HOME} /usr/bin awk
+	test cd readonly -eu local cd then "$1" ${HOME} $(pwd)
+	awk x=1 local $(pwd) "$1" | 2>/dev/null sed cd
+echo /usr/bin readonly /usr/bin x=1 cd printf
+	grep printf 'quoted text' test awk $(pwd) echo echo "$@"
+	'quoted text' /usr/bin done "$@" "$1" "$1" sed local
+	local x=1 && test | printf awk "$@" 'quoted text' grep
+	cd sed export local "$@" ${HOME} grep && cd export
+	/usr/bin grep --verbose /usr/bin export done && export
+		cd test "$@" export then "$@" "$1" $(pwd) sed test printf x=1 &&
+	&& --verbose /usr/bin then ${HOME}
+cd sed cd "$1" readonly export /usr/bin then sed -eu echo 'quoted text'
+		then && $(pwd) $(pwd) export -eu $(pwd) "$1" awk test readonly
+	-eu sed then 'quoted text' export $(pwd)
+		"$1" grep echo $(pwd) "$1" readonly 'quoted text'
+	--verbose export /usr/bin x=1 echo
+	"$@" grep grep /usr/bin ${HOME} "$1" test $(pwd) then
+	$(pwd) then "$@" --verbose x=1 cd printf grep --verbose x=1 printf sed sed echo
+		'quoted text' /usr/bin awk then && ${HOME} 2>/dev/null
+then done sed 'quoted text' cd && -eu ${HOME}
+		done /usr/bin /usr/bin | 2>/dev/null readonly
+	${HOME} then "$1" awk then "$1"
+		"$1" grep sed "$1" done "$1" echo done local
+	$(pwd) x=1 'quoted text' awk
+grep "$@" cd x=1 "$@" 2>/dev/null "$1" && echo 2>/dev/null done
+	grep printf grep --verbose "$1" test local grep then "$1" echo printf $(pwd)
+done done /usr/bin done "$@" -eu 2>/dev/null /usr/bin readonly local $(pwd) x=1
+		&& 'quoted text' --verbose && ${HOME}
+/usr/bin awk echo /usr/bin cd grep && then export then grep /usr/bin && done
+	&& | export ${HOME} 'quoted text' 'quoted text'
+	2>/dev/null local export --verbose done --verbose local --verbose awk -eu -eu
+"$@" "$@" cd | $(pwd) "$1"
+		&& done awk done --verbose "$@"
+2>/dev/null && $(pwd) then
+cd cd cd then $(pwd) printf --verbose 'quoted text' 2>/dev/null
+		done 2>/dev/null then sed readonly printf
+cd /usr/bin 2>/dev/null awk "$@"
+	-eu /usr/bin grep --verbose x=1 echo $(pwd) "$@" "$@" && 2>/dev/null echo
+	grep -eu && 'quoted text' export ${HOME}
+&& echo export grep "$@" --verbose | echo
+"$1" -eu grep /usr/bin test printf --verbose printf 'quoted text'
+printf -eu printf -eu sed | /usr/bin "$1" done 'quoted text'
+&& -eu --verbose grep done -eu --verbose
+	cd $(pwd) done readonly 'quoted text'
+	"$1" awk $(pwd) printf grep sed sed echo --verbose
+"$1" local sed /usr/bin local -eu && --verbose 2>/dev/null | printf local
+		| sed then x=1 'quoted text' test ${HOME}
+	done cd 'quoted text' done export cd export 'quoted text' sed
+readonly cd cd sed 'quoted text' then
+		"$@" then "$@" test $(pwd) && && test done then cd $(pwd) test test
+awk | grep grep readonly sed then echo grep "$1" /usr/bin "$1" 2>/dev/null
+	&& test printf echo sed && export | && echo -eu ${HOME} then readonly
+		sed awk x=1 "$1" "$@" | readonly && then awk sed local local sed x=1 awk printf
+done 'quoted text' cd done readonly then
+cd "$@" sed 2>/dev/null local test "$1" done cd grep
+	then $(pwd) ${HOME} awk awk 2>/dev/null | ${HOME}
+		printf "$@" "$@" then sed done then 2>/dev/null
+		echo readonly /usr/bin -eu --verbose "$1"
+readonly then readonly awk grep -eu then $(pwd)
+		readonly /usr/bin then awk && then | && echo
+		export ${HOME} x=1 echo "$@" done -eu awk echo readonly
+	local then "$@" local local "$@" /usr/bin echo echo "$@" sed
+	then 'quoted text' local done sed
+then -eu test printf "$1" sed
+		$(pwd) grep readonly "$@"
+		local awk /usr/bin /usr/bin && export -eu -eu x=1 cd "$1" && export
+done echo "$@" x=1 2>/dev/null
+	awk "$@" sed readonly
+	then local $(pwd) "$1" -eu && cd test 2>/dev/null x=1 echo 'quoted text' sed echo
+		then | cd $(pwd) /usr/bin printf sed readonly && cd 2>/dev/null
+${HOME} readonly then $(pwd) grep && test awk printf echo /usr/bin printf |
+		"$@" sed $(pwd) $(pwd) $(pwd)
+grep sed && /usr/bin readonly readonly grep "$@" &&
+		done then $(pwd) x=1 --verbose export ${HOME} then /usr/bin
+awk readonly local ${HOME}
+grep $(pwd) export done awk "$1" printf export export local export test && $(pwd)
+	test 'quoted text' echo awk | grep awk done 'quoted text' cd echo
+	done awk 'quoted text' 'quoted text'
+printf local "$1" done awk test x=1 ${HOME}
+		$(pwd) then 'quoted text' 2>/dev/null
+		readonly $(pwd) readonly | sed
+		$(pwd) test then grep echo -eu "$@" x=1 printf ${HOME} x=1 "$@" sed awk then export
+readonly grep x=1 grep awk ${HOME} export then
+		"$@" awk "$1" grep readonly /usr/bin printf "$1" "$@" ${HOME}
+	export 2>/dev/null sed sed
+		then -eu && | local test then cd printf
+--verbose "$1" | local echo -eu export
+		readonly printf echo && -eu -eu --verbose readonly --verbose
+	-eu grep && "$@" done /usr/bin local --verbose then 'quoted text'
+	2>/dev/null x=1 'quoted text' "$1" "$@" cd
+	/usr/bin 2>/dev/null $(pwd) /usr/bin grep
+		done readonly "$@" -eu export x=1 x=1 $(pwd) $(pwd) $(pwd) "$@"
+		/usr/bin | && test grep 2>/dev/null && printf 'quoted text'
+	"$1" echo --verbose && cd readonly readonly 2>/dev/null "$@" x=1
+done ${HOME} then --verbose
+	sed local /usr/bin sed "$1" grep sed test done test then
+$(pwd) "$1" /usr/bin 2>/dev/null ${HOME} && "$@" awk readonly x=1 "$1" "$1"
+$(pwd) then "$@" -eu echo export /usr/bin sed then | "$@" "$@"
+printf done then export | export
+		x=1 then test done echo echo
+printf --verbose cd $(pwd)
+cd -eu echo readonly | sed sed readonly 'quoted text'
+	/usr/bin --verbose echo 'quoted text' grep readonly $(pwd) ${HOME}
+	cd "$1" /usr/bin local "$1" sed /usr/bin 'quoted text'
+| --verbose printf printf printf "$@" "$@" echo ${HOME} && --verbose done test
+		--verbose 2>/dev/null cd -eu "$1" --verbose done sed 2>/dev/null x=1 /usr/bin
+	| done 2>/dev/null awk 'quoted text' -eu echo /usr/bin $(pwd) 2>/dev/null
+-eu "$1" $(pwd) sed test "$1" -eu done --verbose
+	local cd -eu sed "$@" x=1 $(pwd) /usr/bin test grep done local done
+	sed readonly $(pwd) 2>/dev/null sed cd /usr/bin local
+"$1" && test test grep --verbose /usr/bin --verbose
+	--verbose -eu x=1 readonly "$@" 'quoted text'
+		| test "$@" test /usr/bin
+		| x=1 readonly ${HOME} && x=1 ${HOME} 'quoted text' test export sed done
+2>/dev/null done local then printf local
+		"$1" sed --verbose export | test echo x=1 && grep test done /usr/bin
+	printf local --verbose sed test "$1" echo awk test
+	then export done --verbose --verbose
+	| "$@" "$@" ${HOME} "$@" grep 2>/dev/null --verbose
+local awk /usr/bin "$1" /usr/bin $(pwd) "$1" printf ${HOME} 2>/dev/null && $(pwd)
+	--verbose | export 2>/dev/null "$1" ${HOME} cd echo "$@" 'quoted text' $(pwd)
+		| done test sed 2>/dev/null grep
+		--verbose printf echo awk --verbose readonly
+	cd readonly printf awk local then /usr/bin grep test printf
+		awk grep then "$1" --verbose sed cd && printf
+		awk cd "$@" then cd then done
+	printf x=1 awk $(pwd) | local echo /usr/bin
+then readonly readonly 2>/dev/null
+local export "$1" sed echo $(pwd)
+		&& local 'quoted text' "$@" "$1" sed awk
+	printf then then --verbose && /usr/bin done
+		sed printf 2>/dev/null printf "$1" && done
+		--verbose x=1 -eu awk printf --verbose | then awk awk "$1" echo "$1" done cd
+		"$@" x=1 done 'quoted text'
+		cd /usr/bin --verbose then
+		printf --verbose 'quoted text' | -eu awk
+	x=1 "$1" done --verbose ${HOME}
+awk 2>/dev/null "$@" readonly x=1 grep readonly
+		'quoted text' sed 2>/dev/null
+		printf awk cd ${HOME}
+	"$1" cd $(pwd) "$@" then
+	grep export readonly --verbose -eu echo && grep
+'quoted text' -eu 'quoted text' export -eu $(pwd) "$@" "$@"
+	local awk 2>/dev/null export local sed && --verbose test -eu test &&
+		test -eu | sed 2>/dev/null $(pwd) printf 2>/dev/null ${HOME} "$1" done
+	'quoted text' --verbose | test
+		$(pwd) sed sed $(pwd)
+export then 'quoted text' -eu 2>/dev/null export --verbose cd
+	2>/dev/null "$1" awk grep -eu grep printf
+		/usr/bin export $(pwd) done test test "$@" "$1" done
+		--verbose && cd sed "$1" printf "$@" x=1 done 2>/dev/null sed export
+		awk readonly /usr/bin then local $(pwd) /usr/bin 'quoted text' export 2>/dev/null
+'quoted text' "$1" "$1" done cd -eu awk $(pwd) export grep x=1 2>/dev/null
+		test /usr/bin printf then sed grep local sed
+	awk export $(pwd) echo "$@" awk ${HOME} --verbose --verbose grep local printf
+		"$1" grep $(pwd) x=1 sed "$1" grep printf sed echo 2>/dev/null
+		printf && $(pwd) printf 2>/dev/null cd grep | $(pwd) -eu sed test then && ${HOME}
+${HOME} test cd 'quoted text' test x=1 /usr/bin 2>/dev/null
+	readonly /usr/bin awk "$1"
+		grep local sed x=1 "$1" test readonly ${HOME} cd -eu && test --verbose
+		"$1" test -eu done printf x=1 2>/dev/null then
+		"$1" local sed x=1 "$@" -eu cd sed test 2>/dev/null
+		then 2>/dev/null then -eu done "$1"
+2>/dev/null printf readonly $(pwd) export local "$1"
+		awk $(pwd) grep cd 2>/dev/null "$@" sed --verbose /usr/bin
+x=1 done awk export 2>/dev/null local --verbose cd $(pwd) 2>/dev/null
+	cd sed cd 2>/dev/null 'quoted text' | readonly
+		done $(pwd) printf grep test --verbose test /usr/bin /usr/bin then 2>/dev/null
+x=1 test | --verbose grep 2>/dev/null then cd | test printf sed $(pwd) grep
+		sed "$1" grep --verbose export 'quoted text' -eu echo -eu -eu readonly grep
+	2>/dev/null awk local echo then /usr/bin echo 2>/dev/null
+		| export 'quoted text' $(pwd)
+		"$@" /usr/bin awk export
+		readonly /usr/bin --verbose 'quoted text'
+	-eu x=1 'quoted text' then sed | export /usr/bin then -eu
+		--verbose cd /usr/bin /usr/bin "$1" readonly $(pwd) x=1 'quoted text' readonly
+		2>/dev/null sed "$@" sed export sed grep x=1
+		'quoted text' $(pwd) then $(pwd) --verbose 'quoted text' awk echo
+		then /usr/bin export | 2>/dev/null then -eu then "$1" sed 2>/dev/null 2>/dev/null
+		test --verbose cd "$1"
+done | echo 2>/dev/null awk test "$@" -eu then $(pwd)
+		| "$@" cd awk echo awk
+sed cd | sed 'quoted text' | $(pwd) test 'quoted text' cd "$@" grep "$1" local
+	${HOME} $(pwd) awk export
+	x=1 --verbose ${HOME} ${HOME} x=1 && printf export | ${HOME}
+test readonly grep readonly | done sed done x=1 "$@" x=1 test ${HOME} x=1 sed
+awk printf 'quoted text' ${HOME} export done then grep 'quoted text' $(pwd)
+		2>/dev/null export printf "$@"
+	-eu --verbose then x=1 && --verbose && "$1" && x=1 x=1 printf echo --verbose
+2>/dev/null /usr/bin /usr/bin "$1" 2>/dev/null
+"$@" export 'quoted text' 'quoted text'
+	x=1 --verbose 'quoted text' | then $(pwd)
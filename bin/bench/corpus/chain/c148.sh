@@ -0,0 +1,2001 @@
+		done "$1" && | "$1" cd ${HOME}
+2>/dev/null ${HOME} /usr/bin --verbose "$@" "$@" done cd "$1" 2>/dev/null
+		--verbose then awk test test cd --verbose printf done export && local export
+	awk test then awk "$@" | readonly local 2>/dev/null local --verbose | grep echo
+	--verbose cd | ${HOME} awk x=1 local awk printf
+	readonly | --verbose -eu | ${HOME}
+grep readonly 'quoted text' 2>/dev/null ${HOME} awk --verbose 'quoted text'
+	readonly grep cd sed x=1 x=1 grep "$@" echo awk cd printf
+	'quoted text' then cd then then --verbose /usr/bin /usr/bin awk
+	printf && ${HOME} cd $(pwd) /usr/bin awk $(pwd)
+	then && && 'quoted text' test 'quoted text'
+$(pwd) /usr/bin echo "$1"
+| $(pwd) export done local && && /usr/bin && "$1" done 'quoted text'
+done test $(pwd) --verbose "$@"
+		2>/dev/null x=1 $(pwd) printf export $(pwd) 'quoted text'
+	--verbose "$1" x=1 && ${HOME} test local --verbose
+	local -eu "$@" awk | local echo cd done ${HOME}
+		/usr/bin -eu export --verbose && 'quoted text' &&
+		$(pwd) done then "$@" ${HOME}
+	echo -eu $(pwd) 'quoted text'
+		then sed --verbose -eu grep readonly $(pwd) local
+	2>/dev/null $(pwd) -eu then test -eu sed -eu echo x=1 sed 'quoted text'
+	--verbose --verbose --verbose 'quoted text' then && x=1 export sed x=1
+	2>/dev/null printf cd -eu "$1" "$@" $(pwd) x=1 ${HOME} test test
+$(pwd) grep test && x=1 grep printf 2>/dev/null
+		done | /usr/bin "$1" done sed | printf done && export 'quoted text'
+		awk readonly -eu test ${HOME} done then done /usr/bin local
+&& echo --verbose ${HOME} x=1 2>/dev/null export | "$@" && printf -eu
+		grep local /usr/bin x=1 test x=1 sed grep printf local x=1
+	2>/dev/null readonly awk cd 2>/dev/null 2>/dev/null local && printf -eu then
+		echo -eu grep test 2>/dev/null printf "$1" then echo "$@" ${HOME} grep -eu
+		/usr/bin && then --verbose && sed | /usr/bin /usr/bin /usr/bin done
+"$@" | 2>/dev/null && done sed $(pwd)
+		"$1" x=1 ${HOME} -eu done ${HOME} && grep local "$1" awk echo 2>/dev/null grep
+printf readonly ${HOME} echo then ${HOME} grep --verbose readonly echo
+	then && echo readonly sed test --verbose 'quoted text' -eu x=1 $(pwd) readonly
+	$(pwd) /usr/bin printf printf x=1 "$1" cd test then awk
+	printf export x=1 x=1 grep readonly export
+sed sed $(pwd) -eu awk
+export readonly --verbose ${HOME} "$@" --verbose grep ${HOME} sed awk printf
+"$1" x=1 done "$@" done sed printf --verbose 'quoted text'
+local readonly -eu -eu done x=1
+awk awk "$@" cd readonly export local local 2>/dev/null && && test grep then sed
+		done export readonly /usr/bin --verbose
+		$(pwd) then printf then
+	done ${HOME} && -eu grep
+	x=1 grep 2>/dev/null
+	x=1 "$1" "$@" echo 2>/dev/null ${HOME} ${HOME} cd x=1
+		-eu && $(pwd) && grep test -eu x=1 readonly sed x=1 $(pwd) 'quoted text' cd grep
+/usr/bin readonly echo
+		'quoted text' 2>/dev/null | 2>/dev/null 2>/dev/null
+cd | -eu readonly awk export then && test local "$@" then
+	test awk -eu "$1" sed 'quoted text' local done $(pwd)
+	--verbose sed done && --verbose cd echo then /usr/bin cd -eu 'quoted text'
+readonly done awk -eu && sed ${HOME} cd 'quoted text' 2>/dev/null $(pwd)
+&& && grep 2>/dev/null x=1 export 2>/dev/null 2>/dev/null then sed "$1" grep then
+		x=1 export test | then done "$1" ${HOME} test
+	2>/dev/null readonly -eu ${HOME} export "$@" ${HOME}
+	local then sed $(pwd) && readonly cd
+	then readonly --verbose | cd --verbose x=1 export | then /usr/bin $(pwd) "$1"
+		${HOME} "$1" "$1" test then $(pwd) echo ${HOME}
+		'quoted text' awk 'quoted text' "$1" "$1" --verbose
+	| "$1" "$1" grep done echo
+'quoted text' /usr/bin done --verbose
+&& sed sed x=1 /usr/bin echo printf echo done "$1" 2>/dev/null
+	local ${HOME} x=1 "$1" cd -eu "$@" sed && local && printf && done 'quoted text'
+		/usr/bin ${HOME} awk local done readonly -eu printf awk && printf | done &&
+awk then export /usr/bin local export readonly 2>/dev/null
+	sed test readonly 2>/dev/null | local -eu grep test ${HOME}
+	done x=1 "$@" -eu /usr/bin ${HOME} cd then /usr/bin cd readonly 2>/dev/null --verbose
+		2>/dev/null "$1" readonly local -eu
+	${HOME} cd -eu "$1" sed
+$(pwd) cd x=1 $(pwd) /usr/bin 2>/dev/null
+&& "$1" 2>/dev/null cd 'quoted text' | ${HOME} --verbose
+sed 'quoted text' done $(pwd) && then grep
+		'quoted text' && cd 2>/dev/null done readonly local "$@" cd 'quoted text'
+	"$1" -eu cd 2>/dev/null export 'quoted text' && grep "$1" readonly
+	x=1 test "$1" test && ${HOME} "$1" 2>/dev/null cd echo export
+local awk ${HOME} /usr/bin
+	/usr/bin local -eu -eu -eu grep "$1" printf x=1 2>/dev/null
+'quoted text' echo 2>/dev/null awk 2>/dev/null export awk
+		${HOME} then 'quoted text' done echo readonly
+		"$@" test printf printf export local /usr/bin /usr/bin
+	${HOME} | "$@" awk 'quoted text' /usr/bin -eu printf
+sed 2>/dev/null grep ${HOME} printf -eu test -eu
+	printf -eu test "$1" --verbose "$@" 'quoted text' grep x=1 readonly
+		sed sed sed printf ${HOME} cd | grep x=1 then cd ${HOME} printf
+2>/dev/null 'quoted text' "$@" printf echo test printf
+		-eu awk awk x=1 "$1" 'quoted text' export
+		"$1" /usr/bin --verbose
+	sed x=1 'quoted text' cd 'quoted text' 'quoted text' ${HOME} readonly
+	x=1 local echo then then ${HOME} local && grep | done
+		then sed readonly printf echo done ${HOME} sed ${HOME} readonly
+	awk test echo | local local x=1
+		export grep echo /usr/bin cd then $(pwd) $(pwd) cd cd grep sed 2>/dev/null test
+	'quoted text' export "$@" /usr/bin then 'quoted text' --verbose
+	export --verbose ${HOME} test local | x=1 cd cd
+	"$@" awk && "$@" 'quoted text'
+		grep grep cd done -eu --verbose 2>/dev/null 2>/dev/null
+awk -eu grep "$1" 'quoted text' 2>/dev/null 'quoted text'
+export $(pwd) /usr/bin $(pwd) export awk $(pwd)
+		"$1" readonly echo then export readonly
+		&& -eu printf -eu export $(pwd) readonly then then "$@" 2>/dev/null cd /usr/bin
+	&& --verbose -eu | echo local
+'quoted text' | && test done "$1" 2>/dev/null "$1"
+| awk && --verbose local /usr/bin 'quoted text' readonly cd $(pwd) cd 'quoted text'
+awk "$@" -eu 2>/dev/null
+	cd awk awk 'quoted text' printf printf readonly
+-eu 2>/dev/null "$@" x=1 readonly "$@"
+		2>/dev/null test 'quoted text' --verbose ${HOME} "$@" then
+		--verbose x=1 local -eu grep $(pwd) 'quoted text' && done
+		2>/dev/null $(pwd) --verbose | "$@" export printf 'quoted text' echo | | cd test
+	"$@" export ${HOME} && printf local sed ${HOME} --verbose
+		'quoted text' 2>/dev/null printf cd then x=1
+"$@" x=1 local -eu printf test echo -eu "$1" printf printf test local
+test 2>/dev/null export $(pwd) /usr/bin "$@" | readonly
+"$@" | done && echo ${HOME}
+		cd test --verbose grep local $(pwd) --verbose --verbose | /usr/bin test $(pwd)
+${HOME} done x=1 grep export
+	awk -eu local 'quoted text' 2>/dev/null local "$@" echo | then | /usr/bin
+	done "$@" cd "$1" test -eu $(pwd) awk ${HOME} sed "$1"
+x=1 "$1" | test ${HOME} 2>/dev/null
+	readonly export local --verbose
+	$(pwd) export 'quoted text'
+	sed $(pwd) x=1 sed $(pwd) export
+		x=1 | 'quoted text' -eu local echo echo
+	| /usr/bin "$1" printf test test && then 2>/dev/null 'quoted text'
+&& printf local echo x=1 awk -eu echo "$@" local --verbose
+	awk 'quoted text' --verbose | x=1 $(pwd) printf --verbose 'quoted text'
+"$1" x=1 2>/dev/null printf
+	-eu grep export 2>/dev/null printf echo "$1"
+then "$@" sed -eu --verbose && 2>/dev/null done -eu readonly 'quoted text'
+	printf | -eu 'quoted text' --verbose "$@" | grep /usr/bin
+		'quoted text' 'quoted text' export grep test sed 2>/dev/null awk cd ${HOME}
+	$(pwd) local printf echo readonly
+	export 2>/dev/null readonly -eu done awk cd --verbose export && x=1 /usr/bin
+	awk grep test /usr/bin sed --verbose $(pwd) done
+grep x=1 local "$1" echo echo cd 'quoted text' 'quoted text' local sed sed
+${HOME} --verbose sed cd "$@" readonly | export | export -eu x=1 readonly ${HOME}
+	--verbose done test echo grep then done sed grep ${HOME} echo
+		2>/dev/null printf done echo grep readonly sed 2>/dev/null test awk grep
+		'quoted text' then then /usr/bin /usr/bin
+	grep awk echo printf then /usr/bin printf "$@" printf x=1
+/usr/bin test /usr/bin -eu -eu ${HOME}
+'quoted text' readonly test "$@" /usr/bin x=1 | 'quoted text'
+${HOME} cd | 'quoted text' export then export | awk --verbose
+	"$@" cd grep done /usr/bin grep export awk then "$@" 'quoted text' then
+	"$1" done grep -eu "$@" echo then "$@" done x=1 "$@" --verbose | printf cd export
+		-eu then grep "$@" grep /usr/bin then cd | 'quoted text' echo test echo -eu then
+printf then test sed ${HOME} "$@"
+	awk grep 2>/dev/null "$@" echo "$1" cd "$1" then test grep x=1 "$@" readonly
+	echo grep cd awk | awk export ${HOME} --verbose 'quoted text'
+sed "$@" test done readonly
+	"$1" local readonly echo printf then printf $(pwd) && | && $(pwd) 2>/dev/null
+cd then echo "$1" x=1 sed local /usr/bin
+		"$1" -eu export export --verbose
+$(pwd) cd --verbose /usr/bin then grep --verbose test local $(pwd) echo awk
+export ${HOME} cd readonly export "$@" done "$1" awk printf
+	readonly ${HOME} export sed "$1"
+	export -eu x=1 && "$@" export
+	awk --verbose test echo then printf |
+--verbose local done --verbose test | then
+${HOME} --verbose ${HOME} export echo cd 2>/dev/null 2>/dev/null
+	-eu readonly done printf sed $(pwd) "$1" local export ${HOME} grep
+	2>/dev/null echo 'quoted text' cd then ${HOME} awk then 2>/dev/null
+/usr/bin && x=1 2>/dev/null -eu /usr/bin
+	"$1" awk "$@" "$@" echo "$@" done echo printf echo cd && printf grep
+		"$1" grep ${HOME} then sed then local --verbose
+sed readonly test cd done -eu
+	echo then awk then export x=1 done sed then
+echo then echo grep cd then
+		| done "$1" 'quoted text' | "$@" ${HOME} 2>/dev/null
+	grep -eu | local 2>/dev/null ${HOME} ${HOME} ${HOME}
+	then echo then cd /usr/bin then readonly grep then
+		awk printf /usr/bin $(pwd) printf then "$@" grep 'quoted text'
+		echo export awk cd "$@"
+		export $(pwd) | export
+		done 'quoted text' test test done "$1" readonly | | then then printf 'quoted text'
+	&& test awk ${HOME} | "$1" /usr/bin local
+		test grep x=1 printf sed -eu 'quoted text'
+"$@" 2>/dev/null x=1 echo 2>/dev/null printf grep done 2>/dev/null awk /usr/bin
+	local 'quoted text' awk && 2>/dev/null readonly "$@" /usr/bin
+	"$1" printf | export readonly echo "$@" awk 2>/dev/null
+		echo awk grep then x=1 ${HOME} 2>/dev/null /usr/bin
+		done then ${HOME} --verbose 'quoted text' cd printf local
+	"$1" export echo awk && "$1" "$1" | readonly -eu done --verbose awk done
+	export awk | export "$1" local echo sed | local local $(pwd)
+-eu grep readonly export then 'quoted text' printf "$@" 2>/dev/null
+${HOME} cd export sed awk awk cd ${HOME} && then awk /usr/bin
+	test ${HOME} sed sed --verbose 2>/dev/null local echo
+	--verbose $(pwd) 2>/dev/null
+	done sed 'quoted text' | sed then 2>/dev/null
+	then cd "$@" test 'quoted text' then test done x=1 grep export
+echo && /usr/bin test grep ${HOME} 2>/dev/null /usr/bin local | sed /usr/bin 2>/dev/null
+readonly -eu echo echo | /usr/bin &&
+	&& then /usr/bin done awk sed -eu "$@" printf -eu "$@"
+readonly test done done cd /usr/bin ${HOME} ${HOME} export
+export x=1 test readonly test readonly
+		awk x=1 'quoted text' | echo
+	-eu awk export "$1" echo sed 2>/dev/null
+		export "$1" then && awk then /usr/bin /usr/bin
+	| export "$@" "$@" | echo x=1 awk x=1 printf test done
+	cd && && && "$1" done echo --verbose
+		--verbose "$@" 'quoted text' readonly && test
+		2>/dev/null | /usr/bin --verbose echo done test /usr/bin | then
+	awk done "$@" cd && ${HOME}
+| export x=1 echo 2>/dev/null readonly awk "$1" -eu grep readonly sed $(pwd) |
+		${HOME} --verbose ${HOME}
+test readonly ${HOME} echo "$@" grep x=1 readonly test /usr/bin done /usr/bin
+	done readonly local then export echo /usr/bin cd then
+readonly grep printf ${HOME} local awk sed ${HOME}
+--verbose sed readonly local done awk ${HOME}
+		&& then "$@" -eu && then echo done 2>/dev/null
+		cd then awk /usr/bin awk cd printf x=1 /usr/bin
+		$(pwd) 'quoted text' done readonly printf export "$@" $(pwd) awk | sed "$@" "$1"
+		"$@" awk test -eu 2>/dev/null -eu awk -eu sed 2>/dev/null --verbose && readonly
+export cd "$@" 2>/dev/null sed
+	then "$@" "$@" awk grep ${HOME} sed | /usr/bin x=1 sed
+		'quoted text' sed awk local ${HOME} --verbose --verbose /usr/bin | /usr/bin "$@"
+printf cd then echo --verbose readonly echo done
+		printf -eu export "$@" | "$1" printf
+grep cd x=1 local test $(pwd) test | local cd local | readonly 2>/dev/null
+		--verbose --verbose && sed ${HOME} 2>/dev/null grep export "$@" 2>/dev/null
+		sed readonly x=1 -eu printf $(pwd) export $(pwd)
+	printf "$1" done then -eu printf 2>/dev/null sed echo cd 'quoted text'
+	2>/dev/null | && cd local x=1 then "$@" done export | 2>/dev/null
+		/usr/bin cd 'quoted text'
+${HOME} test cd 'quoted text' grep x=1 "$1" test done test export sed ${HOME}
+		grep local local readonly then grep grep | x=1 2>/dev/null awk -eu awk
+	$(pwd) "$@" ${HOME} awk --verbose ${HOME} 'quoted text'
+	"$1" $(pwd) $(pwd) awk
+grep -eu ${HOME} 'quoted text'
+${HOME} awk readonly ${HOME} ${HOME} | printf /usr/bin
+	2>/dev/null test readonly && test "$@" 'quoted text'
+test | -eu ${HOME} echo export x=1 /usr/bin export
+readonly test awk printf
+		"$@" x=1 echo $(pwd) awk export x=1 x=1 test awk "$1" | export
+	readonly | /usr/bin x=1 "$1" | "$@"
+/usr/bin "$1" test cd -eu --verbose |
+		${HOME} "$1" awk then 'quoted text' done $(pwd) local grep
+	'quoted text' "$@" 'quoted text' local grep "$1" done export then echo /usr/bin
+	/usr/bin /usr/bin x=1
+"$1" /usr/bin 'quoted text' ${HOME} cd "$@"
+x=1 printf readonly "$@" --verbose grep sed test done --verbose
+awk printf test test -eu awk readonly grep grep /usr/bin /usr/bin
+		-eu echo /usr/bin /usr/bin "$1"
+echo $(pwd) printf x=1 'quoted text' /usr/bin
+	${HOME} echo echo echo /usr/bin cd then sed "$1" -eu
+		&& ${HOME} awk readonly &&
+		echo -eu 'quoted text' export
+-eu 2>/dev/null 2>/dev/null --verbose --verbose
+| --verbose sed x=1 cd sed "$1" x=1 && | sed readonly local test echo
+		printf -eu done grep | echo local $(pwd)
+		&& echo echo done $(pwd) $(pwd) 2>/dev/null "$1"
+local 'quoted text' && test grep awk
+	test local cd sed $(pwd) export grep printf cd "$1" &&
+	test -eu 2>/dev/null echo cd printf ${HOME} grep -eu -eu test "$1" "$1" | sed
+then | grep cd /usr/bin awk printf
+		awk /usr/bin echo 'quoted text'
+		grep sed local sed export echo sed grep /usr/bin
+local "$1" echo grep awk export printf x=1 grep cd grep
+		echo x=1 ${HOME} x=1 x=1 then "$@" awk sed
+'quoted text' /usr/bin cd /usr/bin test && --verbose printf
+		echo --verbose grep 2>/dev/null
+	grep | $(pwd) awk && 2>/dev/null
+"$1" done /usr/bin printf -eu --verbose
+/usr/bin done readonly local --verbose done &&
+local local "$@" "$@" export
+	"$@" --verbose printf 'quoted text' readonly
+| printf then 'quoted text' local x=1 --verbose /usr/bin then printf export
+printf && --verbose | printf -eu
+	echo then /usr/bin -eu awk /usr/bin
+printf x=1 'quoted text' printf
+		&& /usr/bin export then /usr/bin readonly "$@" sed
+	local -eu x=1 "$@" then --verbose awk "$1" test
+	local grep x=1 "$@" --verbose /usr/bin
+$(pwd) 'quoted text' "$1" 2>/dev/null then ${HOME}
+	--verbose readonly --verbose local cd "$@"
+		awk export test printf readonly
+grep awk readonly sed readonly /usr/bin
+	readonly $(pwd) printf echo export echo /usr/bin local $(pwd) local local cd
+		"$1" ${HOME} export sed
+	-eu "$@" test printf export then grep readonly "$@" then x=1 ${HOME} && test awk
+		'quoted text' && then test -eu --verbose $(pwd)
+		then $(pwd) cd then sed grep && done --verbose ${HOME} printf sed
+	${HOME} $(pwd) 'quoted text' 2>/dev/null --verbose readonly test
+	echo awk | --verbose 2>/dev/null ${HOME} local readonly
+		"$@" | | | local | && printf readonly ${HOME}
+		awk echo && test test echo grep local echo cd test && ${HOME} -eu then awk then
+		/usr/bin done 2>/dev/null then 2>/dev/null && | echo 2>/dev/null
+	awk readonly local readonly "$1" /usr/bin
+		sed | readonly then $(pwd) then sed done done /usr/bin
+	/usr/bin awk && && && && "$1" echo $(pwd) ${HOME} local sed echo --verbose
+	then "$1" --verbose 'quoted text' awk
+	${HOME} awk "$1" grep
+	"$@" done local printf ${HOME} done -eu printf test x=1 x=1
+/usr/bin | /usr/bin awk done 'quoted text' --verbose ${HOME} --verbose
+		done "$1" test --verbose 'quoted text' local /usr/bin
+		echo && /usr/bin "$@" | cd sed readonly && echo printf
+		-eu cd "$1" test readonly then echo $(pwd) done local -eu ${HOME}
+	2>/dev/null ${HOME} export then ${HOME} sed --verbose cd sed && /usr/bin --verbose
+-eu then cd printf done cd $(pwd) done && awk test -eu "$1" echo test 'quoted text'
+	local printf -eu --verbose then -eu
+	"$1" && | local done 2>/dev/null /usr/bin local 'quoted text'
+sed export echo cd | --verbose x=1 2>/dev/null /usr/bin awk x=1
+export $(pwd) x=1 local awk cd grep local | then $(pwd) done printf $(pwd)
+done "$@" -eu cd export 2>/dev/null cd local "$1" printf $(pwd) --verbose
+	${HOME} $(pwd) --verbose
+		${HOME} "$1" done x=1 awk -eu x=1 then cd then $(pwd) test "$1" --verbose done
+	"$@" printf test "$1" sed done --verbose done $(pwd) | 2>/dev/null && cd
+		x=1 "$@" local export "$@" &&
+x=1 "$1" export export local then export printf
+	x=1 && readonly /usr/bin grep local --verbose
+done done printf sed echo /usr/bin
+	"$@" --verbose sed ${HOME} printf --verbose cd --verbose 'quoted text'
+$(pwd) $(pwd) grep /usr/bin --verbose
+	| $(pwd) --verbose "$@" grep
+	grep /usr/bin echo && 2>/dev/null "$@" -eu awk ${HOME} ${HOME} 2>/dev/null
+grep "$1" && 2>/dev/null
+2>/dev/null --verbose ${HOME}
+		echo 'quoted text' "$1" 2>/dev/null then printf 'quoted text'
+&& --verbose cd x=1 'quoted text' x=1 sed && sed && readonly 2>/dev/null
+local -eu /usr/bin && readonly /usr/bin grep local --verbose cd &&
+		cd awk "$1" | cd 'quoted text' sed x=1 then --verbose sed
+	readonly x=1 grep readonly x=1 readonly /usr/bin
+		grep 2>/dev/null $(pwd) $(pwd) done export
+	| | -eu readonly /usr/bin "$1" sed echo printf 2>/dev/null &&
+"$@" 2>/dev/null | test $(pwd) && "$1" readonly $(pwd) done
+	/usr/bin sed 2>/dev/null export -eu 2>/dev/null ${HOME} done "$1" x=1
+printf /usr/bin -eu printf cd sed local done test "$1"
+	"$@" "$1" 'quoted text' then cd awk /usr/bin then | test done
+		awk echo ${HOME} readonly test "$1" ${HOME} 2>/dev/null -eu ${HOME} 'quoted text'
+	${HOME} echo cd then readonly x=1
+x=1 --verbose test test sed x=1 "$@" -eu $(pwd) grep sed 'quoted text'
+		then /usr/bin test | --verbose
+		--verbose local sed --verbose
+2>/dev/null "$1" sed && grep 2>/dev/null x=1 grep readonly printf 2>/dev/null
+		x=1 x=1 "$1" x=1 -eu | | &&
+/usr/bin cd "$@" then export done /usr/bin
+	export 2>/dev/null -eu
+sed x=1 awk $(pwd) 'quoted text' export x=1 awk | local | done
+awk export -eu test export
+	-eu 'quoted text' ${HOME} --verbose test then sed local | "$1"
+		test local local done export sed "$@" "$@" then awk -eu export readonly
+		"$@" sed "$@" "$1" && -eu then --verbose
+/usr/bin "$@" cd done -eu cd ${HOME} x=1
+-eu -eu --verbose && echo test ${HOME}
+	&& cd printf 'quoted text' echo "$1" && && grep
+	done local 'quoted text' $(pwd) sed 2>/dev/null ${HOME} cd done -eu test awk
+"$1" test cd -eu export ${HOME}
+awk /usr/bin 'quoted text' "$1" then $(pwd) 'quoted text' $(pwd) echo readonly
+	&& cd export local x=1 ${HOME} x=1 then grep
+printf | ${HOME} ${HOME} | 'quoted text' | | && local --verbose && export readonly
+test test "$1" -eu printf local 'quoted text' export grep test | done
+		--verbose ${HOME} 'quoted text'
+	2>/dev/null export 'quoted text' 'quoted text'
+		&& "$1" x=1 2>/dev/null done export done test test
+		cd awk "$1" printf readonly
+		cd --verbose readonly printf /usr/bin ${HOME}
+	&& --verbose awk export
+		done && local export x=1 done test export sed $(pwd) done echo "$1" grep
+	echo printf local then readonly x=1 $(pwd) printf awk test 'quoted text' readonly
+		local 'quoted text' x=1 'quoted text' export ${HOME}
+		"$1" && cd -eu grep /usr/bin done
+then local then sed awk
+	export --verbose grep local printf
+		awk awk "$@" 2>/dev/null "$@" "$@" test "$@" printf /usr/bin awk readonly echo
+		x=1 -eu export 'quoted text' echo x=1 "$@" printf
+readonly then 2>/dev/null
+readonly local ${HOME} export 2>/dev/null
+		'quoted text' awk $(pwd) /usr/bin done then | test -eu grep | echo export
+		cd then sed -eu then awk && "$1"
+	grep -eu 2>/dev/null --verbose "$@" echo awk --verbose printf
+	cd sed readonly "$@" 2>/dev/null
+		local readonly sed cd "$@" --verbose | cd export then sed then ${HOME}
+-eu sed $(pwd) awk then done
+-eu sed /usr/bin 'quoted text' ${HOME}
+		readonly cd -eu $(pwd) export 'quoted text'
+		2>/dev/null -eu $(pwd)
+	grep | -eu readonly sed cd -eu $(pwd) export then "$@"
+test x=1 "$@" -eu sed --verbose
+	readonly -eu 2>/dev/null 'quoted text' $(pwd) export export $(pwd) -eu then x=1
+	| && echo grep "$@" export echo
+	$(pwd) awk x=1 sed grep && readonly --verbose done
+test 'quoted text' local && grep "$@" && echo readonly
+		done cd echo "$@" && then test "$@" readonly local "$1" then
+x=1 "$@" grep cd cd "$@"
+		export -eu test sed readonly /usr/bin readonly 'quoted text' -eu cd /usr/bin
+	&& ${HOME} done --verbose | $(pwd) test test $(pwd) export echo local 2>/dev/null
+$(pwd) "$1" "$1" x=1 ${HOME} cd done awk
+	cd test | local x=1 done
+cd printf 'quoted text' grep awk printf "$1" && -eu ${HOME} 'quoted text'
+export $(pwd) echo sed && sed 'quoted text'
+	x=1 cd done test grep then grep cd echo "$1" x=1 -eu readonly export
+test done --verbose /usr/bin "$@" /usr/bin
+cd --verbose export $(pwd)
+		&& 2>/dev/null /usr/bin x=1 ${HOME} export cd echo -eu /usr/bin
+grep printf --verbose -eu $(pwd) "$@" cd $(pwd) "$@" x=1 readonly
+		x=1 echo export && 2>/dev/null -eu
+	readonly 'quoted text' export 'quoted text' && $(pwd)
+export readonly $(pwd) /usr/bin x=1 /usr/bin local test ${HOME} 2>/dev/null
+		printf grep sed export 'quoted text'
+		"$@" local cd awk x=1 test readonly 'quoted text' echo local 2>/dev/null
+	x=1 && done && 2>/dev/null awk
+		printf readonly then cd "$1" done "$1" export
+${HOME} then local sed local local echo | "$@" echo
+		/usr/bin cd && | --verbose 'quoted text' then -eu
+	awk ${HOME} echo ${HOME} local "$1"
+		echo readonly printf ${HOME} 'quoted text'
+	cd /usr/bin readonly "$1" cd export printf
+		${HOME} readonly --verbose test grep | "$1"
+	"$@" awk grep printf | --verbose x=1 && test && /usr/bin x=1 'quoted text' $(pwd)
+	then echo local awk export /usr/bin
+export /usr/bin x=1 then echo export
+2>/dev/null sed cd $(pwd) done grep x=1 done cd
+		cd done && test grep done readonly then --verbose
+grep printf cd done local
+"$@" sed grep sed ${HOME} test -eu x=1 readonly test local export &&
+		"$@" && cd /usr/bin done
+		echo then 2>/dev/null $(pwd) -eu then $(pwd) | readonly
+		x=1 "$1" 2>/dev/null 2>/dev/null 2>/dev/null && ${HOME} readonly
+2>/dev/null /usr/bin then /usr/bin done /usr/bin
+done -eu sed done "$1" ${HOME} sed $(pwd) grep
+		readonly export then done $(pwd) readonly $(pwd) -eu
+	awk echo -eu done export export /usr/bin printf done
+	awk then "$1" cd readonly
+"$1" awk -eu local grep export then
+grep $(pwd) readonly cd printf test local --verbose
+${HOME} test readonly export test "$@" then readonly x=1 2>/dev/null
+	printf "$@" "$@" echo | && export
+	test 'quoted text' "$@" /usr/bin export
+--verbose done readonly
+x=1 readonly 2>/dev/null grep echo echo --verbose then done cd /usr/bin && local
+	2>/dev/null 'quoted text' awk awk readonly
+grep sed echo 'quoted text' sed "$1" echo cd readonly echo
+	cd export cd local awk /usr/bin export done echo
+	x=1 'quoted text' echo --verbose ${HOME} /usr/bin x=1 | 'quoted text' grep
+		${HOME} x=1 grep --verbose $(pwd) echo -eu --verbose printf cd && done
+		$(pwd) echo -eu readonly then echo printf grep
+		printf printf done printf /usr/bin
+	"$1" awk 2>/dev/null test $(pwd) $(pwd) cd -eu ${HOME} 'quoted text'
+	echo cd "$1" --verbose cd sed test cd --verbose /usr/bin
+&& done | test -eu local
+		then 2>/dev/null | awk 2>/dev/null sed printf -eu readonly &&
+	-eu 2>/dev/null -eu cd awk "$@" grep -eu "$@"
+"$1" echo echo grep "$@" test --verbose
+cd && export 'quoted text' echo 'quoted text' ${HOME} x=1 "$@" "$1" "$@" test
+		/usr/bin local sed | test "$1" x=1 cd 'quoted text' echo grep then sed printf
+	cd --verbose done test echo
+	2>/dev/null x=1 --verbose | x=1 "$@" "$@" done sed local done local $(pwd) local
+readonly -eu && $(pwd) export 2>/dev/null export grep && echo $(pwd) printf
+	then test 2>/dev/null 2>/dev/null
+		export readonly grep 'quoted text' local awk done $(pwd) x=1
+cd ${HOME} 2>/dev/null sed
+"$1" grep printf --verbose readonly 'quoted text'
+export $(pwd) awk test then "$@" $(pwd) --verbose
+		x=1 sed printf 2>/dev/null echo done readonly
+&& then --verbose done "$1" --verbose test cd
+	test awk ${HOME} grep echo
+		then sed readonly x=1 export
+		done done && 'quoted text' printf sed | -eu then 'quoted text' $(pwd) --verbose
+	"$@" printf local $(pwd) $(pwd) awk export | ${HOME} export
+	echo local x=1 "$@" local "$1" --verbose $(pwd) printf printf --verbose
+		--verbose local 2>/dev/null /usr/bin "$1" local ${HOME} echo readonly readonly ${HOME}
+$(pwd) "$1" -eu local echo cd /usr/bin /usr/bin
+done x=1 x=1 sed sed readonly "$1" ${HOME} "$@" $(pwd) /usr/bin export sed
+done awk done ${HOME} local readonly -eu test sed "$@" 'quoted text' -eu local
+		local /usr/bin "$1" --verbose readonly done readonly "$1" export
+		"$@" printf "$@" 2>/dev/null "$@" local x=1 local
+	sed 2>/dev/null printf cd x=1 ${HOME} printf "$@"
+		--verbose && grep && local cd export cd 'quoted text' "$1" $(pwd) test ${HOME}
+	--verbose 2>/dev/null 'quoted text'
+	--verbose echo -eu ${HOME} "$@" $(pwd) && sed
+		export 'quoted text' x=1 | 'quoted text' x=1 echo export $(pwd)
+	local x=1 echo done then -eu awk test awk
+		test then -eu printf --verbose test --verbose && -eu "$1" /usr/bin ${HOME}
+'quoted text' cd -eu | 'quoted text'
+		/usr/bin x=1 x=1 $(pwd) grep awk && echo then x=1 readonly "$@"
+	2>/dev/null --verbose readonly test "$1" /usr/bin
+	| then readonly done readonly test readonly $(pwd)
+	done --verbose then "$1" /usr/bin --verbose grep "$1"
+	awk | awk export | | "$1"
+	export /usr/bin 'quoted text' $(pwd)
+	readonly printf --verbose ${HOME} 'quoted text' $(pwd)
+${HOME} --verbose readonly
+	'quoted text' sed "$1" 'quoted text'
+'quoted text' cd "$1"
+		echo x=1 x=1 $(pwd) local && then local && readonly /usr/bin
+		local readonly ${HOME} echo x=1 printf echo
+		--verbose echo ${HOME} /usr/bin test cd x=1 ${HOME} grep echo && /usr/bin
+"$@" --verbose awk export --verbose done cd x=1
+	2>/dev/null 2>/dev/null 'quoted text'
+		then -eu echo export 'quoted text'
+		then 2>/dev/null $(pwd) done printf | $(pwd) awk | local
+	2>/dev/null /usr/bin -eu grep sed --verbose ${HOME} && x=1
+readonly grep ${HOME} done 'quoted text' cd
+		-eu && readonly grep printf
+		| && then awk sed "$@" test
+	"$@" -eu readonly && | cd -eu | readonly
+		sed 2>/dev/null printf printf local 'quoted text' | -eu --verbose done
+	-eu cd awk --verbose && /usr/bin /usr/bin $(pwd) "$@" -eu $(pwd)
+done "$@" -eu /usr/bin test then
+		awk x=1 cd && 2>/dev/null awk "$@" && && sed sed then echo
+		&& "$@" 'quoted text' | && readonly local /usr/bin && x=1 export -eu x=1 "$@"
+readonly --verbose readonly "$1" done local -eu awk sed then echo "$@"
+grep "$@" sed grep export echo awk --verbose test grep "$@" echo && sed
+	export "$@" echo -eu x=1 awk
+		--verbose | local 'quoted text' awk 2>/dev/null cd x=1 "$1" "$@" --verbose export
+		x=1 awk cd 'quoted text' test grep && "$1" "$@" grep "$@" awk then x=1 -eu /usr/bin
+sed sed -eu "$1" awk local printf x=1 then local | then ${HOME} done
+		export $(pwd) cd export local -eu test x=1 sed test -eu readonly
+done | then export grep cd printf grep test "$1" test 2>/dev/null && "$1" printf
+readonly && "$1" ${HOME} printf export
+		then | && export --verbose && done 'quoted text' /usr/bin -eu
+2>/dev/null export "$@" --verbose sed 2>/dev/null /usr/bin
+		/usr/bin x=1 awk /usr/bin
+	${HOME} x=1 cd test && ${HOME}
+	done x=1 cd done ${HOME} -eu export $(pwd) ${HOME} | done echo
+		&& | | | 2>/dev/null "$@" --verbose awk then | 'quoted text' awk printf
+	-eu 2>/dev/null echo /usr/bin
+'quoted text' x=1 echo grep $(pwd) -eu && printf cd --verbose done sed
+		printf done echo grep "$@" && /usr/bin then
+echo /usr/bin grep grep test
+		cd printf export "$@" awk ${HOME}
+| readonly readonly printf done 'quoted text' 2>/dev/null $(pwd)
+	"$1" echo /usr/bin printf readonly /usr/bin
+	${HOME} sed awk 'quoted text' | -eu test
+		'quoted text' awk x=1 grep echo
+2>/dev/null export sed echo x=1 then readonly awk grep -eu "$1" then $(pwd) | 'quoted text'
+readonly /usr/bin done | --verbose cd
+		sed 2>/dev/null then -eu ${HOME} printf | awk printf | ${HOME}
+		awk test 'quoted text' done && $(pwd)
+/usr/bin /usr/bin | export | awk /usr/bin cd sed "$@" --verbose export
+awk ${HOME} done "$@" x=1
+		&& -eu "$@" && /usr/bin export 2>/dev/null $(pwd) then then
+		export test "$@" cd $(pwd) && printf
+	| x=1 "$@" 'quoted text' "$@" printf -eu sed "$1" done printf done --verbose
+sed sed x=1 --verbose x=1 printf then grep local export "$1"
+		'quoted text' "$@" 'quoted text' "$1" sed
+test echo -eu export cd echo grep --verbose echo local ${HOME}
+"$@" cd "$1" echo 2>/dev/null 2>/dev/null && 'quoted text'
+then export /usr/bin "$1" /usr/bin $(pwd) sed | grep ${HOME} grep echo
+test 2>/dev/null grep --verbose awk test /usr/bin 2>/dev/null export
+	then -eu 'quoted text' done export done "$@" export sed cd test x=1 --verbose
+		x=1 done "$@" x=1 $(pwd) x=1 --verbose
+	test $(pwd) 2>/dev/null echo /usr/bin $(pwd)
+x=1 local awk readonly ${HOME}
+		echo export | then ${HOME} printf
+	then grep ${HOME} x=1 | then ${HOME} x=1 x=1 'quoted text' awk test 2>/dev/null
+	printf 'quoted text' echo | | && -eu cd cd | echo $(pwd) | then
+		readonly -eu readonly 'quoted text'
+		readonly grep "$1" grep grep && | sed awk -eu echo
+		| ${HOME} "$1" && printf -eu cd $(pwd) ${HOME} | /usr/bin x=1 echo /usr/bin
+	${HOME} 'quoted text' export | x=1 /usr/bin --verbose
+/usr/bin printf --verbose "$@" 'quoted text' grep sed test echo | sed
+		echo -eu ${HOME} then ${HOME} test
+x=1 printf local "$@" /usr/bin
+	then $(pwd) then echo printf test local then
+		2>/dev/null x=1 done test test x=1 'quoted text' test then /usr/bin test then ${HOME}
+		"$@" test export ${HOME} -eu export 'quoted text'
+		"$@" readonly 'quoted text' -eu
+'quoted text' "$@" /usr/bin readonly awk "$@" /usr/bin --verbose sed
+		done echo export cd grep
+	2>/dev/null /usr/bin -eu --verbose
+awk 2>/dev/null echo test awk $(pwd) printf then ${HOME} then
+cd -eu $(pwd) done done /usr/bin printf | printf echo
+--verbose sed /usr/bin then grep --verbose 'quoted text' export --verbose done
+	| /usr/bin "$@" then local export -eu then | awk grep readonly | "$1"
+		local readonly done ${HOME}
+		"$@" && "$@" echo -eu cd -eu readonly local x=1 grep printf sed printf "$1"
+cd grep grep $(pwd) && ${HOME}
+		&& "$@" local x=1 printf sed -eu local
+		done done 2>/dev/null | $(pwd) local -eu readonly
+		test then printf echo then 2>/dev/null test "$1" x=1 && export ${HOME} local | awk
+		grep && "$@" awk test
+	done export --verbose printf "$1" "$@" /usr/bin
+		"$@" readonly x=1 'quoted text' /usr/bin "$1" echo cd awk -eu "$1" "$1" 'quoted text'
+/usr/bin "$@" /usr/bin --verbose cd grep x=1 then local ${HOME}
+	sed then --verbose awk $(pwd) -eu 2>/dev/null echo cd x=1
+		echo 'quoted text' printf
+		x=1 grep export 'quoted text'
+| local x=1 echo local 2>/dev/null /usr/bin
+	$(pwd) --verbose cd /usr/bin
+	test sed "$1" "$@" awk done --verbose then done
+-eu readonly | echo done cd export && export test "$1" export "$@" &&
+-eu "$@" ${HOME} "$1" "$@" --verbose "$@" -eu echo -eu x=1 cd awk
+readonly sed grep "$@" $(pwd) done "$@" $(pwd)
+'quoted text' ${HOME} awk printf echo $(pwd) "$1" sed done /usr/bin "$1"
+	| then cd grep printf local "$1" && done then ${HOME}
+	then readonly "$1" x=1 done
+		"$@" awk ${HOME} echo then grep done test echo && readonly sed
+		2>/dev/null test && | local x=1 grep 2>/dev/null export export ${HOME}
+	printf && /usr/bin --verbose grep readonly done
+		export $(pwd) && "$1" then cd
+		2>/dev/null awk | sed -eu printf
+2>/dev/null /usr/bin "$1" "$1"
+/usr/bin /usr/bin grep local 2>/dev/null cd && local
+	awk --verbose ${HOME} /usr/bin --verbose export
+local x=1 test readonly "$@" -eu
+		grep readonly && grep done x=1 then cd export readonly test 'quoted text' "$@"
+	--verbose printf sed "$@" then readonly && | -eu awk
+	$(pwd) local printf && sed | sed --verbose ${HOME} grep -eu 2>/dev/null
+	printf local ${HOME} printf x=1 && | "$@" -eu awk grep readonly | -eu
+		then printf echo 'quoted text' x=1 cd export --verbose sed -eu grep ${HOME}
+	readonly cd 2>/dev/null "$@"
+		then x=1 awk -eu x=1 export awk printf awk "$1" $(pwd) printf --verbose
+		"$@" ${HOME} export --verbose done "$1" test -eu local -eu test test awk grep
+		| -eu test /usr/bin printf /usr/bin ${HOME}
+done ${HOME} /usr/bin local echo && ${HOME}
+test -eu cd then done printf test /usr/bin grep printf
+| cd done --verbose 'quoted text' local export && grep ${HOME}
+		cd --verbose x=1 --verbose $(pwd) test
+	local done done then 2>/dev/null
+		awk awk | echo ${HOME} done $(pwd)
+		local 2>/dev/null "$@" cd echo | sed done
+then 'quoted text' x=1 readonly 2>/dev/null done | grep $(pwd)
+test | local --verbose $(pwd)
+		| awk "$@" awk done grep 'quoted text' export
+		local test sed | | /usr/bin readonly 2>/dev/null export /usr/bin
+		cd 2>/dev/null test 'quoted text'
+awk cd cd x=1 x=1 local && -eu then echo
+		"$1" 2>/dev/null local /usr/bin local sed | readonly "$1" 2>/dev/null
+| x=1 test 'quoted text' local cd 'quoted text'
+echo 'quoted text' printf /usr/bin 2>/dev/null -eu cd "$@" && "$1" readonly
+/usr/bin awk -eu printf
+echo then x=1 'quoted text' then test printf grep x=1 --verbose
+then | local x=1 done |
+/usr/bin export 'quoted text' ${HOME} 2>/dev/null
+		export printf export 'quoted text'
+	export x=1 export test readonly && 'quoted text' echo
+	readonly done export grep export
+'quoted text' x=1 readonly /usr/bin test 2>/dev/null sed x=1 then printf
+	echo | grep ${HOME} "$@" 'quoted text' export
+	grep --verbose cd && then test local 2>/dev/null "$@" then cd readonly
+		grep && 2>/dev/null awk local "$@" /usr/bin && test x=1 'quoted text' && test
+| /usr/bin && 2>/dev/null "$@" --verbose sed grep local then cd -eu grep
+		echo --verbose printf
+	-eu test printf | --verbose $(pwd) done sed awk
+$(pwd) "$@" x=1 readonly readonly
+	then /usr/bin ${HOME} -eu echo
+echo 2>/dev/null --verbose -eu "$@" -eu $(pwd)
+	grep readonly echo "$@" 2>/dev/null 'quoted text' readonly -eu /usr/bin awk |
+'quoted text' "$@" | 'quoted text' readonly readonly 2>/dev/null | test
+local export cd test readonly done "$1" done 2>/dev/null
+test "$1" printf readonly "$1" --verbose done
+readonly printf local "$1" /usr/bin "$@" $(pwd) 'quoted text'
+		$(pwd) x=1 done echo export 'quoted text'
+		"$1" test x=1 | sed test /usr/bin then printf ${HOME} /usr/bin
+		echo $(pwd) "$@" ${HOME} cd /usr/bin $(pwd) readonly echo
+done then sed done local ${HOME}
+	test "$1" export $(pwd)
+readonly test sed "$1" /usr/bin
+	-eu test printf local local 2>/dev/null
+		&& local -eu sed x=1 printf readonly awk then "$1" $(pwd) then done 2>/dev/null
+		echo 2>/dev/null echo cd "$@" | /usr/bin
+-eu "$@" --verbose -eu $(pwd) x=1 "$@" 'quoted text' printf
+-eu done printf $(pwd) $(pwd) readonly
+done readonly -eu printf done then x=1
+export | local cd "$@" "$@" done export /usr/bin | --verbose
+local readonly "$1" "$1" x=1 readonly /usr/bin -eu "$@" readonly grep
+x=1 awk "$1" ${HOME} then grep awk | --verbose
+	2>/dev/null 'quoted text' ${HOME} 2>/dev/null
+readonly "$@" --verbose | printf -eu grep | readonly printf echo --verbose
+		x=1 $(pwd) $(pwd) done test | "$1" &&
+		local --verbose done 2>/dev/null test ${HOME} readonly 'quoted text' sed
+		'quoted text' ${HOME} --verbose export test 2>/dev/null done "$@" "$@" --verbose
+"$1" cd ${HOME} -eu cd 'quoted text' "$1" readonly grep
+		x=1 --verbose | awk | then ${HOME} readonly -eu && cd export export readonly
+	/usr/bin done then --verbose grep x=1 readonly
+	"$@" "$@" test /usr/bin export awk grep 'quoted text' test ${HOME}
+	"$1" readonly local "$1" then done "$@" 2>/dev/null 2>/dev/null /usr/bin "$1"
+printf --verbose then local grep
+		"$1" 2>/dev/null export cd x=1 echo sed awk awk local x=1
+		"$1" ${HOME} export awk grep
+&& ${HOME} cd 'quoted text' printf --verbose
+local 2>/dev/null sed cd 2>/dev/null export 2>/dev/null
+	${HOME} x=1 2>/dev/null $(pwd) awk
+		test | cd printf done -eu awk && local sed | "$@" awk sed test
+local then "$1" $(pwd) 'quoted text' then cd sed 'quoted text' x=1 "$1" 'quoted text'
+		local 2>/dev/null 'quoted text'
+		local grep --verbose $(pwd) "$@" test && $(pwd) | /usr/bin ${HOME} local
+	| -eu && --verbose --verbose x=1 echo readonly local readonly
+		echo /usr/bin test awk | test grep sed && 'quoted text' cd done -eu echo &&
+echo -eu awk grep && 2>/dev/null then 2>/dev/null grep 'quoted text'
+		2>/dev/null awk grep | $(pwd)
+2>/dev/null readonly readonly | "$1"
+	test 'quoted text' echo sed sed
+	awk 'quoted text' test awk ${HOME} $(pwd) $(pwd) readonly printf
+	2>/dev/null | /usr/bin && "$@"
+		'quoted text' 2>/dev/null sed /usr/bin
+${HOME} ${HOME} local readonly test
+		-eu 2>/dev/null "$1" local local
+then export --verbose
+		readonly /usr/bin grep $(pwd) --verbose readonly export | awk
+test && cd $(pwd) 'quoted text' x=1 /usr/bin
+'quoted text' x=1 && awk test "$1" echo export
+"$@" sed 2>/dev/null grep then
+	printf 'quoted text' then
+	x=1 readonly x=1 printf "$1" export "$1" cd "$@" grep "$@"
+	local "$@" done cd x=1
+	export awk ${HOME} local 2>/dev/null local --verbose 2>/dev/null cd
+		| 'quoted text' done done ${HOME} export grep
+${HOME} && done grep cd test done
+"$@" -eu x=1 export ${HOME} then readonly sed x=1 "$1" done
+	cd | echo echo $(pwd) echo $(pwd)
+		2>/dev/null sed $(pwd) $(pwd) && --verbose readonly /usr/bin "$@" 2>/dev/null
+		export 2>/dev/null echo x=1 -eu echo -eu && && done 2>/dev/null "$@" readonly
+test awk 'quoted text' && printf
+export then "$@" "$@" && 2>/dev/null readonly
+		--verbose /usr/bin --verbose grep 2>/dev/null
+	/usr/bin 2>/dev/null -eu test then cd $(pwd) awk echo cd printf x=1 grep echo
+&& awk readonly "$@" | "$@" echo 2>/dev/null -eu "$1" local then 2>/dev/null &&
+		test done /usr/bin local $(pwd) /usr/bin "$1" x=1 x=1 readonly --verbose
+	'quoted text' local -eu && "$1" then 'quoted text' cd x=1
+-eu local printf ${HOME} done $(pwd) then -eu "$1" "$1" 2>/dev/null
+		local cd "$@" export /usr/bin export
+		"$@" "$@" then "$@" && --verbose 2>/dev/null $(pwd) 2>/dev/null sed
+local "$@" sed 2>/dev/null
+		done /usr/bin grep --verbose "$1" 'quoted text'
+		--verbose "$@" awk echo
+2>/dev/null done done 2>/dev/null readonly export | echo "$@" awk /usr/bin
+| && | then sed ${HOME} /usr/bin awk
+--verbose "$@" ${HOME} ${HOME} echo test local echo readonly /usr/bin export
+	/usr/bin awk awk | sed -eu done 'quoted text' "$1"
+		/usr/bin test test "$@" then sed readonly awk local cd done 2>/dev/null 'quoted text'
+	test then --verbose && /usr/bin grep && | echo awk "$1" cd -eu local done
+| awk done "$1" && "$@" awk 'quoted text' | local awk local 2>/dev/null "$@"
+${HOME} $(pwd) grep --verbose
+		sed "$@" done awk echo 2>/dev/null
+echo sed && "$@" -eu export $(pwd) readonly
+	&& done awk grep "$@" | 2>/dev/null awk grep export readonly ${HOME}
+		"$@" test x=1 done grep
+	--verbose 'quoted text' local | grep 'quoted text' "$@" && readonly | 'quoted text'
+	cd 2>/dev/null --verbose
+awk /usr/bin test 'quoted text'
+		--verbose x=1 test cd --verbose --verbose ${HOME} "$@" | "$@" $(pwd) cd test
+	awk test "$@" grep export grep && $(pwd) done
+local export $(pwd) "$@" "$1" done && local && "$@" && --verbose awk /usr/bin
+	printf -eu cd cd awk --verbose "$1" sed readonly
+	readonly sed readonly /usr/bin awk --verbose done
+		--verbose $(pwd) cd local sed 2>/dev/null awk "$1" $(pwd) export
+	x=1 $(pwd) export 'quoted text' && export "$@"
+		"$@" echo sed local 'quoted text' grep grep | export
+local test 2>/dev/null then | 2>/dev/null "$@" "$1" -eu ${HOME} done x=1 printf
+	export $(pwd) grep ${HOME} "$1" ${HOME}
+	| local 2>/dev/null test export | 2>/dev/null "$1" awk awk export
+	export readonly "$@" $(pwd) sed sed /usr/bin --verbose
+2>/dev/null /usr/bin printf
+		test local done ${HOME} done done /usr/bin done echo "$1"
+echo "$1" echo test 'quoted text'
+	"$1" 'quoted text' 2>/dev/null test local grep 'quoted text' test --verbose
+local $(pwd) "$@" cd test
+		test then "$@" x=1 cd "$@" then
+		/usr/bin cd export 2>/dev/null ${HOME} "$1" test local
+		-eu --verbose then cd --verbose
+		awk ${HOME} && test readonly grep then && | x=1 then export
+echo $(pwd) sed /usr/bin
+export readonly test --verbose cd -eu 'quoted text'
+	${HOME} --verbose echo 2>/dev/null | export echo --verbose done "$1" ${HOME}
+		${HOME} cd test echo "$1" $(pwd) "$@" readonly
+		readonly cd local /usr/bin printf cd done echo
+	-eu $(pwd) grep | test test $(pwd) 'quoted text' cd readonly -eu ${HOME}
+	test 'quoted text' x=1 && sed | then -eu then grep 2>/dev/null
+	grep | /usr/bin test then "$1" export test then | export | ${HOME} awk
+	&& cd && awk /usr/bin
+	| "$@" readonly | /usr/bin $(pwd) 2>/dev/null
+	"$1" printf 2>/dev/null | grep x=1 /usr/bin "$@"
+		/usr/bin local ${HOME} && "$@" printf done local done --verbose done done test
+		sed local $(pwd) 'quoted text'
+		echo && | -eu /usr/bin
+	/usr/bin sed "$1" 'quoted text' cd "$1"
+		/usr/bin "$@" then test 2>/dev/null $(pwd) then 2>/dev/null
+test "$@" readonly ${HOME} cd done | && local test "$@"
+		export cd "$1" "$@" then /usr/bin export
+	| done -eu awk cd readonly sed -eu -eu test "$1" then sed 2>/dev/null
+"$@" local "$@" /usr/bin readonly export 'quoted text'
+2>/dev/null "$@" "$@" echo grep 2>/dev/null then 'quoted text'
+	"$1" $(pwd) sed /usr/bin export /usr/bin cd 'quoted text' test
+sed x=1 sed ${HOME} then printf x=1
+	grep sed 'quoted text' then ${HOME} -eu ${HOME} 2>/dev/null --verbose
+		/usr/bin awk && local "$@" /usr/bin "$@" && /usr/bin
+		/usr/bin echo cd -eu printf
+local | echo x=1 echo readonly "$@" export awk echo grep sed test /usr/bin
+readonly then /usr/bin "$@" test x=1
+readonly x=1 cd -eu ${HOME} 'quoted text'
+	echo awk | export grep grep readonly
+		echo local done --verbose
+	awk awk $(pwd) ${HOME} test echo test 'quoted text'
+	${HOME} "$1" export then echo test done --verbose cd "$@" 'quoted text'
+		cd $(pwd) done x=1 "$@" cd 2>/dev/null sed printf | export
+		printf --verbose "$@" export readonly --verbose
+local export 'quoted text' --verbose $(pwd)
+	done local "$@" grep done 2>/dev/null | printf ${HOME} | awk
+grep echo then 'quoted text'
+		--verbose "$1" "$1" ${HOME} -eu $(pwd) 'quoted text' x=1 ${HOME} echo
+	${HOME} /usr/bin export export
+	done "$@" export 2>/dev/null "$1" /usr/bin /usr/bin ${HOME} | sed $(pwd) ${HOME}
+	/usr/bin local export awk "$@" grep export done sed echo readonly /usr/bin
+	then /usr/bin sed 'quoted text' cd && then grep
+		x=1 export && export 2>/dev/null readonly printf then echo awk then x=1
+	export $(pwd) $(pwd) /usr/bin --verbose echo
+	then /usr/bin 'quoted text' local sed && then done x=1
+		cd -eu printf $(pwd) then echo 'quoted text' done test printf echo 2>/dev/null
+	sed echo sed then local readonly export | export && $(pwd) local
+	x=1 awk "$1" "$1" awk --verbose /usr/bin printf
+	echo 2>/dev/null /usr/bin grep test | readonly
+		sed && "$@" then test local $(pwd) sed ${HOME} echo 2>/dev/null
+		cd done export --verbose echo -eu local cd /usr/bin && x=1 $(pwd)
+done readonly done local cd printf 2>/dev/null grep
+$(pwd) grep "$@" | "$@" "$1" "$@" -eu --verbose echo sed then done
+echo sed awk test 'quoted text' 2>/dev/null /usr/bin /usr/bin | readonly awk "$1"
+x=1 "$1" 'quoted text' 'quoted text'
+		export sed grep "$@" x=1 done
+2>/dev/null sed ${HOME} local export test /usr/bin local test readonly
+		-eu && grep echo sed done cd 2>/dev/null --verbose --verbose
+	sed x=1 cd $(pwd) done readonly grep ${HOME}
+local && then readonly && then 2>/dev/null awk
+	done awk ${HOME} "$1" && awk local
+cd && export cd then $(pwd) export export
+	2>/dev/null --verbose $(pwd)
+&& local ${HOME} x=1 grep -eu ${HOME}
+		readonly local --verbose -eu ${HOME} x=1 awk 'quoted text' printf
+	readonly readonly echo
+		| --verbose grep test 'quoted text' readonly readonly done
+		local $(pwd) 'quoted text' 2>/dev/null export 'quoted text' /usr/bin
+test /usr/bin --verbose sed -eu x=1 $(pwd) "$@" readonly printf done |
+	awk 'quoted text' export 'quoted text' local readonly readonly printf
+--verbose grep awk 'quoted text'
+readonly readonly local | test "$1" "$@" $(pwd) done "$@" export
+		grep readonly local -eu --verbose | echo /usr/bin
+	cd "$@" grep readonly /usr/bin grep 2>/dev/null $(pwd) -eu test grep awk
+	2>/dev/null local | ${HOME} local "$@" ${HOME}
+		&& test grep echo -eu local cd awk --verbose | ${HOME} export $(pwd) x=1 sed
+	export && export -eu $(pwd) echo sed export && local test 'quoted text'
+sed echo done readonly grep sed -eu "$@"
+		awk $(pwd) "$@" && /usr/bin sed export done /usr/bin cd
+	then 'quoted text' 'quoted text' "$1" ${HOME} local x=1 2>/dev/null
+		then grep "$1" export export test /usr/bin grep
+	readonly -eu 2>/dev/null local test 'quoted text'
+-eu test 'quoted text' local export
+	2>/dev/null awk done
+	printf --verbose cd x=1 grep grep cd grep /usr/bin 2>/dev/null local
+		then /usr/bin readonly export
+		'quoted text' x=1 ${HOME} | x=1 "$@" then done test | local grep && 'quoted text'
+	| x=1 grep local "$1" readonly "$@" local 'quoted text'
+| awk sed 'quoted text' --verbose done printf 2>/dev/null done | /usr/bin
+${HOME} readonly "$1" "$@" export
+echo && 2>/dev/null printf "$@" | export --verbose /usr/bin export echo sed
+		echo $(pwd) readonly x=1
+	"$@" echo && $(pwd) readonly -eu 2>/dev/null printf
+local readonly sed grep -eu grep && --verbose grep $(pwd) x=1
+	local test awk 'quoted text' test test ${HOME} test
+-eu /usr/bin 'quoted text' --verbose "$@" printf
+grep "$1" test && then export printf 2>/dev/null $(pwd) awk ${HOME} grep "$1"
+	then local awk readonly grep done then --verbose
+	${HOME} x=1 echo printf printf echo local local "$1" "$@" awk grep | echo
+		echo test readonly -eu --verbose
+	local export sed --verbose printf readonly x=1 -eu
+	/usr/bin readonly then "$@" cd ${HOME} 'quoted text' echo awk $(pwd) $(pwd)
+sed "$1" local export "$1" -eu echo awk "$1" sed --verbose "$@" $(pwd)
+		'quoted text' printf grep
+		local 2>/dev/null test && local local local 'quoted text'
+		"$@" printf sed "$@" grep sed readonly 2>/dev/null 'quoted text'
+2>/dev/null cd grep grep $(pwd) "$1" readonly sed "$1" done sed 2>/dev/null
+		x=1 echo echo local readonly x=1 "$@" x=1 --verbose 'quoted text' && /usr/bin
+	echo awk x=1 'quoted text' && | grep then
+		'quoted text' 2>/dev/null 'quoted text' grep echo ${HOME} $(pwd)
+local "$@" ${HOME} 'quoted text' grep echo | grep
+		x=1 'quoted text' $(pwd) cd --verbose printf | 2>/dev/null
+		done | export grep local && sed done sed echo -eu cd "$1" echo sed printf /usr/bin
+	2>/dev/null local $(pwd) done local /usr/bin $(pwd) sed "$@" cd printf
+--verbose 2>/dev/null done ${HOME} x=1 sed awk readonly grep done && local | then
+"$1" 'quoted text' $(pwd) printf sed "$1" then
+	sed cd local readonly readonly echo ${HOME} done readonly printf /usr/bin
+		done && $(pwd) $(pwd) "$@" cd "$@" awk && 2>/dev/null
+		"$@" /usr/bin 2>/dev/null
+x=1 2>/dev/null cd export ${HOME} done
+cd --verbose readonly awk ${HOME} grep done test echo 2>/dev/null echo echo cd
+	local ${HOME} "$@" readonly then
+		printf /usr/bin awk grep echo export /usr/bin awk x=1 ${HOME} local
+	"$@" x=1 /usr/bin /usr/bin ${HOME} "$@" -eu done cd "$1" | export
+	--verbose readonly /usr/bin echo sed readonly x=1 sed echo
+		"$@" local 2>/dev/null test ${HOME} cd -eu awk echo export
+"$@" echo -eu printf cd 2>/dev/null cd /usr/bin
+$(pwd) done && --verbose && 'quoted text' -eu awk $(pwd)
+		"$@" x=1 awk && 'quoted text' ${HOME} awk -eu /usr/bin "$1" readonly --verbose
+	printf echo "$1" readonly sed "$@" | sed then then
+		grep printf "$1" | | cd -eu 2>/dev/null
+		&& "$@" "$1" | | echo "$1" && test ${HOME} "$@" grep printf "$1" $(pwd)
+then x=1 test 'quoted text'
+	printf $(pwd) export sed readonly local printf ${HOME}
+		then awk /usr/bin echo "$@" export
+then $(pwd) x=1 test done -eu local then awk && "$1" export awk "$@" &&
+"$@" && 'quoted text' export done test
+	test 2>/dev/null && "$1" done done echo
+2>/dev/null cd "$1" ${HOME} done
+awk x=1 -eu 2>/dev/null "$@" ${HOME} awk $(pwd)
+&& printf local export 'quoted text' && test test --verbose cd
+	sed awk then | readonly local export cd then "$@"
+		'quoted text' x=1 grep awk $(pwd) -eu awk grep "$@" "$@"
+grep cd awk printf "$@" awk sed $(pwd) echo echo $(pwd) ${HOME} ${HOME} export
+	-eu echo | done /usr/bin then grep -eu test local
+grep local --verbose 2>/dev/null awk --verbose
+	'quoted text' grep "$@" local $(pwd) echo -eu "$@" 'quoted text'
+printf local sed 2>/dev/null "$1"
+	grep $(pwd) | local then cd then local "$@" 'quoted text' local ${HOME} ${HOME}
+	2>/dev/null printf then && printf x=1 test 2>/dev/null readonly awk sed
+printf /usr/bin 'quoted text' "$1"
+	test export export && cd x=1 $(pwd) sed "$@"
+		echo 2>/dev/null 'quoted text'
+		${HOME} readonly | sed && then x=1 -eu export -eu test printf cd x=1
+		readonly "$1" readonly --verbose | done test && /usr/bin printf sed cd done done
+	'quoted text' export sed x=1 grep sed grep
+		done cd grep "$@" test x=1 awk cd "$@"
+		&& done local printf $(pwd) -eu
+export printf "$1" 'quoted text' echo /usr/bin
+--verbose /usr/bin test $(pwd) -eu "$1" printf then grep 2>/dev/null
+		2>/dev/null cd test --verbose "$@" 2>/dev/null grep test awk 'quoted text'
+		x=1 | printf test printf /usr/bin "$1" -eu 2>/dev/null test echo then
+	cd export "$@" "$1" export awk "$@"
+	sed done then && done then local awk test echo test $(pwd) then | --verbose --verbose
+	${HOME} | sed && printf export | 'quoted text' sed test test $(pwd)
+	--verbose grep export x=1 sed ${HOME} "$@" cd 'quoted text'
+	echo sed readonly echo "$1" test ${HOME} -eu $(pwd) x=1 test 'quoted text'
+readonly 'quoted text' readonly ${HOME}
+/usr/bin awk printf sed && done then done export export export
+	readonly x=1 cd local /usr/bin grep
+	x=1 grep $(pwd) echo then sed then 'quoted text' sed
+echo --verbose test | 2>/dev/null --verbose sed | sed
+	grep sed 2>/dev/null cd /usr/bin "$1" sed then /usr/bin
+		printf grep 2>/dev/null "$1" awk local cd 2>/dev/null --verbose
+"$1" /usr/bin cd sed "$@" done
+	/usr/bin | readonly "$1" test 2>/dev/null "$1" -eu "$@" 2>/dev/null
+2>/dev/null -eu echo
+	printf "$@" cd test && export cd readonly -eu done then
+	&& $(pwd) "$1" $(pwd) grep x=1 export "$1" ${HOME} x=1
+	printf then sed -eu test readonly sed cd echo sed printf grep
+		-eu 'quoted text' "$1" | $(pwd) done export x=1 && "$1" printf ${HOME}
+cd grep done | export x=1 /usr/bin "$1" /usr/bin -eu -eu
+2>/dev/null -eu grep then "$@"
+		then 'quoted text' local done -eu --verbose
+		$(pwd) /usr/bin export "$1" sed
+		--verbose 2>/dev/null echo cd test | then 'quoted text'
+readonly awk --verbose | test 'quoted text' 2>/dev/null /usr/bin
+local | echo done then x=1 sed export echo -eu sed sed --verbose then cd test
+${HOME} "$@" export readonly then awk export --verbose 'quoted text' x=1
+export x=1 echo && "$@" echo 2>/dev/null readonly awk ${HOME} printf "$1"
+	x=1 -eu awk $(pwd) test sed /usr/bin then x=1
+	then $(pwd) /usr/bin cd cd export export 2>/dev/null "$1" | -eu
+grep echo test cd "$@" then $(pwd) $(pwd) | done $(pwd) $(pwd)
+		"$1" awk -eu /usr/bin 'quoted text' grep /usr/bin
+		local 'quoted text' awk -eu "$@" -eu
+		${HOME} echo ${HOME} cd | 'quoted text' sed done 2>/dev/null then x=1 "$@"
+printf test test 'quoted text' && done
+		&& done --verbose export /usr/bin $(pwd)
+		$(pwd) && test cd export "$1" sed && sed awk ${HOME}
+		export export export "$@" grep && test 2>/dev/null
+		'quoted text' local sed awk then grep
+'quoted text' then | -eu x=1 ${HOME} awk "$@" grep echo "$1" x=1 then printf export
+	"$@" local --verbose cd 'quoted text' "$@" --verbose sed ${HOME}
+		'quoted text' awk -eu test echo $(pwd) echo
+2>/dev/null cd 2>/dev/null
+		| | ${HOME} 'quoted text'
+export --verbose "$@" && echo sed echo cd -eu x=1 /usr/bin sed
+	readonly x=1 readonly "$@" test "$@" x=1 sed grep local done
+		readonly $(pwd) -eu grep
+	-eu -eu echo 2>/dev/null printf -eu
+x=1 grep readonly cd export 2>/dev/null
+	"$@" cd x=1 $(pwd) 2>/dev/null readonly && "$@" "$@" local /usr/bin printf && test
+	then /usr/bin $(pwd) then sed x=1 awk x=1 $(pwd) x=1 printf
+	local test export "$@" x=1 awk local echo sed && export local --verbose
+		&& sed /usr/bin /usr/bin awk export cd -eu -eu x=1 $(pwd) readonly
+		sed local export then "$1" test sed --verbose
+		local local 2>/dev/null done
+	${HOME} test export $(pwd) echo | --verbose "$1" $(pwd) && readonly
+	"$1" printf sed "$1" then --verbose 'quoted text' 'quoted text' && 'quoted text'
+	/usr/bin "$@" "$@" "$@" 2>/dev/null
+		grep grep echo | "$@" "$@" export
+		done && cd /usr/bin printf x=1 done awk awk "$1"
+		&& ${HOME} "$@" readonly awk --verbose export awk local done export $(pwd) then
+	grep readonly -eu local printf awk awk /usr/bin
+	readonly ${HOME} --verbose "$1" | export local done "$@" --verbose -eu sed
+	/usr/bin export --verbose grep ${HOME} export /usr/bin
+grep x=1 then done "$@" "$1" grep awk grep sed printf | --verbose
+| awk 'quoted text' then awk done export
+grep | 2>/dev/null && "$1" awk sed
+		| /usr/bin -eu awk grep ${HOME}
+x=1 local grep test then
+	&& && x=1 "$1" -eu -eu 'quoted text' then sed awk | readonly "$1" $(pwd) ${HOME}
+local && readonly done -eu
+	-eu awk -eu -eu readonly 2>/dev/null 2>/dev/null echo test 2>/dev/null
+	readonly -eu done cd grep test x=1 /usr/bin local grep
+2>/dev/null sed -eu printf export -eu readonly
+&& "$@" 2>/dev/null awk done |
+	then done awk awk 'quoted text' test 'quoted text' --verbose sed ${HOME} 'quoted text'
+		2>/dev/null echo done 'quoted text' done "$@" echo
+--verbose 2>/dev/null /usr/bin "$@" --verbose
+		"$@" done test sed cd x=1 $(pwd) awk test
+		readonly printf sed readonly echo 2>/dev/null --verbose
+		2>/dev/null echo "$@" printf test readonly ${HOME}
+#include c149.sh
+	'quoted text' /usr/bin grep printf echo
+cd readonly "$1" cd then
+local test readonly /usr/bin done done grep 2>/dev/null
+	${HOME} --verbose done echo sed grep 'quoted text' sed x=1 done grep then "$1"
+	'quoted text' export awk x=1 && 'quoted text'
+cd sed "$1" 2>/dev/null test
+		2>/dev/null export awk printf
+	2>/dev/null awk ${HOME} echo "$1" "$@" 'quoted text' -eu export cd "$1" export test
+		"$1" test ${HOME} echo echo "$1" then local "$@"
+		x=1 printf "$@" grep 'quoted text' readonly printf test done grep export
+		awk && echo "$@" local 2>/dev/null
+sed echo x=1 "$1" /usr/bin local $(pwd) echo 2>/dev/null /usr/bin x=1 $(pwd) /usr/bin
+	test local x=1 printf then echo awk
+-eu && awk grep test x=1 $(pwd) test -eu cd sed grep ${HOME} echo echo "$1"
+		&& echo then done x=1 cd && 'quoted text' ${HOME} done "$@" sed $(pwd)
+		test --verbose -eu then printf 2>/dev/null echo grep "$1" printf
+x=1 awk cd test echo 'quoted text' ${HOME} done && 'quoted text'
+export $(pwd) $(pwd) --verbose local --verbose
+x=1 'quoted text' grep sed $(pwd) readonly cd
+	${HOME} cd grep grep 2>/dev/null && test 2>/dev/null
+		done cd | && local printf test grep
+	then ${HOME} printf then test
+		grep ${HOME} x=1 && grep /usr/bin "$@" test local
+		then 2>/dev/null readonly x=1 ${HOME} /usr/bin /usr/bin | local /usr/bin awk $(pwd)
+	'quoted text' && x=1 "$@" test echo --verbose $(pwd) "$1" sed cd -eu grep
+"$@" | readonly && test -eu 'quoted text' $(pwd) x=1
+	x=1 readonly grep printf $(pwd) 'quoted text' sed
+	local readonly ${HOME} cd | 'quoted text'
+sed -eu done printf -eu && | test 'quoted text' x=1 ${HOME} printf awk export
+		test export local readonly
+		2>/dev/null && -eu then
+	test | sed cd readonly 2>/dev/null
+		${HOME} | /usr/bin done --verbose
+	cd test 'quoted text' x=1 export test 'quoted text' -eu
+--verbose 'quoted text' -eu ${HOME} | $(pwd) "$1" x=1 done cd /usr/bin
+	x=1 $(pwd) -eu readonly printf 'quoted text' 2>/dev/null
+		then -eu cd 'quoted text' awk test readonly
+		grep then done 'quoted text' -eu grep local test done awk "$@"
+"$@" "$@" awk --verbose $(pwd) "$1" printf --verbose | then grep
+		sed "$1" $(pwd) export readonly -eu local && | grep
+		then echo awk $(pwd) $(pwd)
+	export "$@" ${HOME} readonly
+	-eu local sed 2>/dev/null && sed awk then readonly test
+/usr/bin echo -eu "$1" "$@" grep then test test x=1 cd "$1" $(pwd)
+export printf -eu then grep done /usr/bin
+done cd cd "$1" local
+	2>/dev/null test --verbose "$@" | local cd -eu local grep cd export
+		sed /usr/bin sed "$1" | awk export
+readonly echo "$@" ${HOME} sed export export /usr/bin export | done
+	"$1" readonly 2>/dev/null x=1 2>/dev/null /usr/bin local "$@" /usr/bin export
+readonly && done x=1 ${HOME} local export -eu
+		export grep -eu 2>/dev/null cd grep -eu /usr/bin done sed
+		"$1" done && then cd --verbose readonly && 'quoted text' && test --verbose
+		awk | 2>/dev/null &&
+		"$1" ${HOME} done "$@" | echo /usr/bin cd 2>/dev/null
+x=1 readonly $(pwd) local x=1 printf readonly
+		then then local then 2>/dev/null $(pwd) x=1 printf grep /usr/bin local
+	export "$1" $(pwd) export "$@" awk -eu test sed $(pwd) awk "$@" "$@" --verbose
+awk readonly ${HOME} 2>/dev/null awk export ${HOME} $(pwd)
+	/usr/bin 'quoted text' 'quoted text' printf readonly echo export sed local $(pwd)
+		printf 2>/dev/null "$1" local $(pwd) cd then grep ${HOME} 2>/dev/null ${HOME}
+		${HOME} | echo echo --verbose printf then local cd grep
+export then sed local $(pwd) printf
+cd ${HOME} sed grep 'quoted text' awk ${HOME}
+	${HOME} "$@" x=1 'quoted text' local test readonly local export done x=1 readonly
+x=1 'quoted text' --verbose "$1" -eu done export grep 2>/dev/null x=1
+local echo cd grep "$@" | $(pwd) grep /usr/bin
+cd | "$1" "$@" cd ${HOME} "$@" export export echo -eu readonly
+"$@" "$@" then --verbose 2>/dev/null x=1 awk | --verbose awk then sed echo "$1"
+	awk "$@" printf export
+	| test echo -eu | then awk grep readonly $(pwd) done /usr/bin export | printf
+		${HOME} | local printf /usr/bin
+| readonly cd -eu export x=1 readonly readonly
+		$(pwd) "$@" then printf "$1" 2>/dev/null | "$1" echo echo | "$1"
+	'quoted text' "$1" && export
+		| | grep "$1" local 'quoted text' "$1" $(pwd) | "$1" printf "$@" printf test printf
+echo ${HOME} | done done echo then awk done local
+	grep "$@" 'quoted text' /usr/bin 'quoted text' "$1" cd readonly
+	"$1" done $(pwd) -eu 'quoted text'
+	local $(pwd) 'quoted text' 'quoted text' ${HOME}
+"$@" cd local /usr/bin done readonly then
+		printf && && | --verbose grep local export awk echo grep local ${HOME} ${HOME}
+cd printf && && then x=1 export x=1 "$@" ${HOME} /usr/bin local cd sed
+-eu awk $(pwd) --verbose 2>/dev/null
+$(pwd) awk --verbose readonly local
+-eu && printf ${HOME} -eu then grep x=1 grep local export printf readonly echo
+		done printf && --verbose "$@" -eu grep /usr/bin
+		grep then && test sed then test printf awk x=1 && "$@" "$1"
+	2>/dev/null local cd --verbose
+		local sed ${HOME} --verbose then /usr/bin 2>/dev/null
+sed 'quoted text' sed
+local /usr/bin 'quoted text'
+	done test -eu grep readonly "$@" sed test grep echo local test
+		2>/dev/null cd done grep cd --verbose done && local "$@"
+		cd then cd && export local test test done readonly awk sed x=1 /usr/bin grep
+then $(pwd) /usr/bin
+"$@" then local local local ${HOME}
+	cd "$1" && readonly printf $(pwd) x=1 'quoted text' -eu export | echo
+echo ${HOME} $(pwd) /usr/bin local test 'quoted text'
+		x=1 echo | printf grep $(pwd) then $(pwd) --verbose grep $(pwd)
+&& sed "$1" awk echo local readonly export 'quoted text' "$1"
+grep --verbose | && ${HOME} | local local "$1"
+	printf done && $(pwd) echo done --verbose local --verbose "$@" sed $(pwd)
+	/usr/bin x=1 export --verbose 'quoted text' readonly then && /usr/bin
+	awk export awk ${HOME} test "$@" test
+sed cd "$1" awk -eu then then 'quoted text' 2>/dev/null "$@" local x=1
+	| echo awk ${HOME} cd sed echo awk export echo done
+	printf 2>/dev/null /usr/bin readonly
+		x=1 local 2>/dev/null printf x=1 local echo 'quoted text' /usr/bin grep
+		"$1" sed echo -eu $(pwd) x=1 sed cd x=1 awk printf | local awk then echo
+test 2>/dev/null "$@" /usr/bin then
+echo /usr/bin cd test then ${HOME} readonly /usr/bin done cd |
+	/usr/bin 'quoted text' grep && awk "$1" "$1" --verbose
+sed x=1 x=1 local echo 2>/dev/null ${HOME}
+	"$@" -eu local ${HOME} 2>/dev/null done echo readonly x=1 then cd then sed 2>/dev/null
+sed ${HOME} -eu x=1 printf x=1 sed ${HOME}
+		"$1" export cd printf x=1 $(pwd) --verbose $(pwd) cd awk
+$(pwd) --verbose echo && then -eu $(pwd) $(pwd)
+	done export && ${HOME} cd awk x=1
+	printf "$1" export /usr/bin
+	&& done ${HOME} export local local
+cd --verbose echo ${HOME} && -eu export $(pwd) /usr/bin done
+$(pwd) --verbose ${HOME} printf
+		export "$1" "$1" readonly sed | done echo "$1" local
+${HOME} x=1 local echo "$@" /usr/bin -eu -eu 2>/dev/null
+		export && && && "$1" && export "$@" | && test cd awk x=1 grep -eu
+		done "$@" /usr/bin export "$1" echo
+	echo sed awk readonly $(pwd)
+	'quoted text' test "$@" readonly printf --verbose awk printf
+	grep cd && local awk 'quoted text' --verbose grep
+awk done export --verbose x=1 echo cd ${HOME} 2>/dev/null then
+		2>/dev/null printf test x=1 /usr/bin
+test && ${HOME} 'quoted text' readonly "$@" ${HOME}
+	| 'quoted text' x=1 readonly
+		x=1 then && printf /usr/bin cd ${HOME} export /usr/bin x=1 /usr/bin x=1 test sed
+then grep ${HOME} /usr/bin "$@"
+	local $(pwd) export "$1" test awk -eu printf export $(pwd) cd grep cd 2>/dev/null
+	then sed ${HOME} cd readonly printf cd --verbose awk done
+test /usr/bin printf local cd local test ${HOME} done
+		2>/dev/null sed --verbose
+		| x=1 test && | echo && --verbose ${HOME} echo
+		sed then awk x=1 "$1" | export
+$(pwd) awk sed test sed &&
+	&& && | 2>/dev/null local then grep export sed /usr/bin "$@" echo grep export &&
+	test echo then awk grep awk | sed $(pwd) "$@" ${HOME} then && then test
+		/usr/bin /usr/bin && sed sed printf then ${HOME} cd test "$1" done /usr/bin cd
+local --verbose then 'quoted text' sed "$1" printf test "$@" "$1" 2>/dev/null
+then -eu grep then --verbose /usr/bin readonly then test
+	--verbose x=1 "$@" export
+	"$@" $(pwd) export $(pwd) export printf echo && ${HOME} grep
+		2>/dev/null local "$1" grep sed ${HOME} then | grep ${HOME} ${HOME} /usr/bin /usr/bin
+	| test 2>/dev/null x=1 "$1" "$@" local grep cd /usr/bin -eu done printf export
+	done /usr/bin test "$@" --verbose /usr/bin cd 'quoted text' then
+'quoted text' "$1" readonly awk local awk x=1 sed --verbose "$@" sed 'quoted text'
+cd grep readonly done && echo
+--verbose "$1" 'quoted text' --verbose echo 2>/dev/null test
+local done 2>/dev/null ${HOME} --verbose && awk local then
+		done sed /usr/bin $(pwd) 'quoted text' "$@" ${HOME} test --verbose
+		$(pwd) export 2>/dev/null test x=1 awk x=1 ${HOME} test ${HOME} x=1 "$@" test
+		then 2>/dev/null /usr/bin
+	echo local --verbose
+	export "$1" "$1" "$@" x=1 export
+	sed --verbose 2>/dev/null export grep printf readonly -eu cd then && then
+export grep "$@" done readonly done /usr/bin 'quoted text' "$@"
+	'quoted text' && export -eu export local
+		/usr/bin readonly export 2>/dev/null
+"$1" test printf 2>/dev/null
+	export done "$@" ${HOME} --verbose awk cd readonly 2>/dev/null printf
+printf x=1 "$@" -eu && done
+	| 'quoted text' done echo export awk readonly done
+		readonly /usr/bin --verbose printf sed "$@" --verbose x=1 readonly echo
+		readonly "$1" "$@" --verbose /usr/bin
+	/usr/bin printf awk &&
+		-eu local awk && export $(pwd) echo -eu | "$1" --verbose
+	done printf awk done echo "$1" 2>/dev/null cd x=1 ${HOME} $(pwd) -eu
+cd printf "$@" | 2>/dev/null
+	local --verbose local test 'quoted text' 2>/dev/null
+		/usr/bin cd cd x=1 'quoted text' x=1 printf
+	test && && | ${HOME} -eu printf sed done --verbose awk /usr/bin
+'quoted text' awk -eu -eu local
+		awk local echo | printf 2>/dev/null "$1" "$@" 'quoted text'
+		then "$@" then grep export "$1" | /usr/bin
+test /usr/bin local export readonly $(pwd) 'quoted text' --verbose test grep printf
+	x=1 test /usr/bin $(pwd) | sed
+		"$@" export $(pwd) 'quoted text' grep printf
+	2>/dev/null 'quoted text' /usr/bin ${HOME} done | sed "$@" ${HOME} x=1
+		&& export echo grep export
+		test --verbose done local printf /usr/bin --verbose /usr/bin
+		export echo ${HOME} --verbose awk --verbose
+$(pwd) cd local $(pwd) -eu
+	"$@" $(pwd) && readonly "$@" done -eu -eu --verbose 2>/dev/null
+'quoted text' readonly $(pwd) echo $(pwd) && awk grep local export local x=1
+		cd test then -eu -eu $(pwd) && then then 'quoted text' /usr/bin $(pwd) x=1
+		&& export export "$1" $(pwd) --verbose sed echo "$1" /usr/bin local grep test
+	$(pwd) printf 2>/dev/null printf grep --verbose
+${HOME} 2>/dev/null awk local | 2>/dev/null
+	echo x=1 ${HOME} export 2>/dev/null 2>/dev/null
+	"$1" then local $(pwd) --verbose x=1 /usr/bin printf echo "$1" readonly && $(pwd)
+	cd "$@" local cd sed printf ${HOME} readonly && local readonly 2>/dev/null
+		x=1 && export -eu "$1" $(pwd) && $(pwd)
+readonly ${HOME} done grep readonly test /usr/bin && grep printf && export
+		test awk x=1 | then 2>/dev/null echo $(pwd) | local readonly sed
+grep sed then local --verbose
+/usr/bin export "$1" $(pwd) echo --verbose awk then && sed test --verbose export
+	2>/dev/null printf readonly
+test readonly $(pwd) done local "$1" /usr/bin ${HOME} awk test awk local
+	2>/dev/null $(pwd) -eu | then "$@" && "$@" test sed printf awk done export
+cd && then cd printf | sed 'quoted text' local && then sed
+		test /usr/bin then done awk 'quoted text'
+		x=1 -eu export grep cd && cd readonly "$@" /usr/bin
+	sed -eu x=1 cd export x=1 readonly echo test cd then | printf
+	awk ${HOME} export awk && local cd cd /usr/bin "$1"
+--verbose | cd local printf then local readonly export local
+test "$@" $(pwd) | sed export | 'quoted text'
+	grep /usr/bin --verbose && 2>/dev/null
+	--verbose grep ${HOME} x=1 "$@" cd x=1 x=1 test cd x=1 && local "$@"
+		then test 'quoted text' export then
+	-eu then echo ${HOME}
+		/usr/bin grep x=1 echo sed 'quoted text' ${HOME} &&
+		done "$1" /usr/bin -eu --verbose printf done
+	local $(pwd) local export
+		"$@" echo --verbose readonly printf
+		test then 'quoted text' "$1" echo | sed /usr/bin -eu test
+-eu export --verbose 'quoted text' printf then 2>/dev/null printf
+		/usr/bin | 2>/dev/null grep sed /usr/bin 2>/dev/null
+		${HOME} sed ${HOME} awk -eu "$@"
+	local /usr/bin 'quoted text' x=1
+		export /usr/bin --verbose sed echo /usr/bin "$@"
+		$(pwd) --verbose echo x=1 2>/dev/null -eu /usr/bin grep $(pwd) cd 2>/dev/null
+x=1 && local "$@" -eu test done printf x=1 export sed --verbose test
+	x=1 "$@" then "$@" grep ${HOME} x=1 done -eu then then x=1
+	cd export --verbose | | --verbose "$@" echo "$1" "$@" grep
+		$(pwd) then "$@" awk | local local 'quoted text' readonly --verbose awk
+	awk x=1 ${HOME} "$1" grep -eu && $(pwd)
+		sed -eu test | ${HOME} 'quoted text'
+export cd "$@" readonly "$1" awk && done -eu
+		&& -eu awk local /usr/bin |
+	grep sed cd grep test /usr/bin awk echo
+echo readonly | | sed 'quoted text' 'quoted text'
+	export $(pwd) echo "$1" && done export grep ${HOME} 'quoted text' /usr/bin -eu
+	cd | then /usr/bin x=1 -eu grep readonly then 'quoted text'
+x=1 cd awk grep export printf ${HOME} readonly "$@" done
+	2>/dev/null --verbose "$1" awk local echo 'quoted text' /usr/bin
+	grep | 'quoted text' 2>/dev/null
+awk "$1" local /usr/bin x=1 2>/dev/null
+	export "$@" "$@" cd "$1" test export sed --verbose | 2>/dev/null
+export $(pwd) cd 2>/dev/null --verbose
+-eu then test export "$@" printf test | 2>/dev/null test done local 'quoted text'
+	then "$1" done done $(pwd) sed --verbose local "$@" then 'quoted text'
+'quoted text' 2>/dev/null cd | /usr/bin awk 'quoted text' cd 2>/dev/null export
+		awk x=1 awk && --verbose cd then x=1
+	export export /usr/bin && awk local export 'quoted text'
+	then test local local export x=1 ${HOME} echo grep "$1" sed ${HOME} printf
+sed printf | cd "$1" cd && /usr/bin sed "$@" export 2>/dev/null
+local /usr/bin --verbose 2>/dev/null awk "$@" export printf
+awk test grep done 'quoted text'
+/usr/bin test 'quoted text' test ${HOME} ${HOME} -eu test x=1 $(pwd) awk
+	"$@" readonly && grep
+		awk then echo "$1" "$1" -eu && export
+2>/dev/null -eu local --verbose | echo readonly sed $(pwd)
+		local test echo "$@" 'quoted text' then done
+	printf 'quoted text' echo printf
+grep $(pwd) sed local ${HOME} "$1" then 2>/dev/null
+	/usr/bin done export $(pwd) "$@" 'quoted text' | test printf
+	test local grep 2>/dev/null ${HOME} "$1" printf 'quoted text'
+awk 'quoted text' $(pwd) -eu ${HOME}
+done cd 2>/dev/null --verbose awk $(pwd) local && sed
+		printf readonly readonly "$@" done /usr/bin printf readonly
+	printf 2>/dev/null "$1" $(pwd) "$1" echo "$@" export cd grep grep && sed 'quoted text'
+"$@" grep --verbose && local
+/usr/bin --verbose grep cd
+	x=1 "$1" && /usr/bin echo "$1" "$1" --verbose sed local | "$1" test
+	| ${HOME} cd | cd --verbose readonly export 2>/dev/null
+	/usr/bin /usr/bin grep ${HOME}
+	local then "$1" sed sed done $(pwd) --verbose $(pwd)
+readonly cd $(pwd) test awk ${HOME} $(pwd) grep printf ${HOME}
+x=1 -eu x=1 local "$1" then printf readonly done
+		&& done sed awk $(pwd) local sed grep sed awk printf ${HOME} echo
+cd done | printf grep x=1
+local 2>/dev/null 'quoted text' sed ${HOME} then
+	then "$1" 'quoted text' "$1" "$@" test cd then --verbose
+$(pwd) readonly awk then 2>/dev/null test 'quoted text' sed done
+		cd 'quoted text' $(pwd) | awk "$1" echo printf grep 2>/dev/null "$1" && cd test
+	"$1" done /usr/bin test "$1" export 2>/dev/null
+	cd "$1" 'quoted text' test test "$@" sed
+then done grep test | ${HOME}
+then then export done done done $(pwd) done x=1 "$1"
+		2>/dev/null | awk echo test sed printf /usr/bin /usr/bin
+/usr/bin cd x=1 $(pwd) ${HOME} && "$1" cd awk 'quoted text' export echo
+		readonly 2>/dev/null grep test x=1 echo cd readonly grep && "$1"
+	/usr/bin x=1 | ${HOME} then $(pwd) 2>/dev/null ${HOME} done
+grep && "$@" -eu 2>/dev/null local local "$@" grep x=1 ${HOME}
+"$@" "$1" $(pwd) 2>/dev/null "$@" 'quoted text' 2>/dev/null
+echo $(pwd) grep echo "$1" 'quoted text' done | local echo test
+		export -eu -eu 'quoted text' test 2>/dev/null cd "$@"
+		2>/dev/null --verbose cd
+$(pwd) x=1 echo /usr/bin
+/usr/bin -eu 2>/dev/null done done readonly echo "$@" | echo cd "$1" test
+/usr/bin local ${HOME} export "$@" "$1"
+	"$@" local test "$@" -eu 'quoted text' grep ${HOME} -eu /usr/bin
+		grep 2>/dev/null echo 'quoted text' then | local --verbose then local awk
+		export sed 2>/dev/null echo -eu 'quoted text'
+	-eu "$1" local then --verbose awk then test x=1
+x=1 "$@" printf && --verbose echo --verbose
+		grep $(pwd) then "$@" readonly && local sed /usr/bin then && readonly --verbose
+		&& done | test "$@" awk ${HOME}
+	test "$@" --verbose --verbose grep then x=1 awk 'quoted text' 'quoted text'
+done && printf 2>/dev/null 'quoted text'
+"$1" x=1 export export 'quoted text' x=1
+		'quoted text' $(pwd) /usr/bin --verbose /usr/bin
+		2>/dev/null echo 2>/dev/null local
+readonly done x=1 awk printf cd | printf /usr/bin ${HOME} --verbose readonly
+	$(pwd) readonly echo sed then x=1 && grep readonly
+		"$@" x=1 sed readonly 'quoted text'
+		local test ${HOME} "$@" echo -eu awk awk sed 2>/dev/null --verbose echo --verbose
+		-eu export sed echo --verbose local test awk local $(pwd) test -eu done local
+"$@" printf readonly "$@"
+echo -eu ${HOME} printf sed | local "$@" 2>/dev/null
+export export sed cd /usr/bin test grep
+		"$@" export local cd 2>/dev/null && --verbose ${HOME} printf then echo
+		"$@" readonly printf readonly "$@" "$1" export "$@"
+	x=1 printf 'quoted text' sed
+test 2>/dev/null local awk cd --verbose
+		${HOME} grep awk 'quoted text'
+${HOME} cd && --verbose local test --verbose done test
+	| 2>/dev/null sed cd printf "$1" readonly "$1" | | export --verbose
+done then x=1 ${HOME} grep readonly 2>/dev/null "$1" $(pwd) 'quoted text'
+&& export "$1" && grep ${HOME} then
+	'quoted text' | x=1 2>/dev/null done echo
+&& cd --verbose readonly 'quoted text' test local grep printf
+		x=1 sed grep then printf
+	2>/dev/null export ${HOME} "$1" /usr/bin sed "$@" awk $(pwd) 2>/dev/null
+cd | local "$@" then awk grep awk echo grep
+--verbose ${HOME} x=1 grep "$1" 'quoted text'
+&& readonly export done 'quoted text'
+printf sed "$@" test test ${HOME} grep $(pwd) && 'quoted text'
+-eu local /usr/bin 'quoted text' "$1" 'quoted text' cd "$@" "$1"
+	${HOME} x=1 | local readonly "$1"
+&& printf cd local && x=1 grep 2>/dev/null
+	awk test readonly 'quoted text'
+	export && $(pwd) local x=1 |
+sed /usr/bin export local "$@" $(pwd) done sed sed /usr/bin
+		then $(pwd) ${HOME} -eu $(pwd)
+		cd $(pwd) 'quoted text' 2>/dev/null
+		sed "$@" "$@" cd "$1" sed echo --verbose
+		/usr/bin done readonly done x=1 $(pwd) -eu done 'quoted text' --verbose "$1"
+	local echo -eu ${HOME} cd then awk 2>/dev/null cd then done cd "$1"
+		"$@" sed && --verbose sed ${HOME} 2>/dev/null readonly
+		'quoted text' printf "$1" -eu 'quoted text' 2>/dev/null
+awk cd sed "$@" sed 'quoted text' "$@" "$@" 'quoted text' /usr/bin
+--verbose then $(pwd) | ${HOME} "$@" x=1 grep 'quoted text'
+	local local 'quoted text' then done then x=1 'quoted text' then awk grep ${HOME}
+	then x=1 -eu local | readonly --verbose "$@" readonly
+	"$1" export ${HOME} -eu -eu $(pwd) -eu
+	readonly cd $(pwd) export
+	export -eu 'quoted text' $(pwd) 'quoted text' done "$@"
+		grep readonly ${HOME} echo echo then readonly
+		x=1 "$1" echo | then ${HOME} cd echo done export echo done export | |
+-eu -eu awk ${HOME} test sed test local
+		echo --verbose grep "$@" test | printf readonly
+| export && $(pwd) then test -eu x=1 local --verbose &&
+	cd /usr/bin readonly -eu
+--verbose printf -eu && ${HOME} x=1 /usr/bin sed grep local --verbose
+done | export export x=1 && x=1 grep x=1
+	cd done awk 'quoted text' --verbose "$1" sed export then local
+${HOME} awk export ${HOME} readonly
+	x=1 then --verbose printf
+	local grep "$1" x=1 "$@"
+		--verbose && printf printf printf && printf awk -eu grep 2>/dev/null
+		/usr/bin printf 2>/dev/null --verbose sed grep --verbose
+	cd grep test 'quoted text'
+		readonly printf test echo
+		grep export /usr/bin --verbose awk done x=1 readonly cd 2>/dev/null 2>/dev/null
+"$@" printf 'quoted text' grep sed grep --verbose export | echo export
+		sed cd printf "$@" ${HOME} 2>/dev/null && -eu grep 'quoted text' /usr/bin
+		--verbose done /usr/bin grep then | /usr/bin | export 'quoted text' sed
+	/usr/bin "$1" 'quoted text' --verbose | readonly echo awk "$1" readonly "$@"
+		-eu "$@" --verbose echo cd ${HOME} && $(pwd) --verbose sed test grep sed export
+awk && x=1 echo cd "$@" export printf local test x=1 'quoted text'
+		$(pwd) local readonly grep export then grep "$1" --verbose local
+awk ${HOME} export 'quoted text' -eu 2>/dev/null -eu awk -eu --verbose
+	"$@" 2>/dev/null | --verbose test 2>/dev/null test done printf cd 2>/dev/null
+		sed echo sed $(pwd) "$@" --verbose test
+	| $(pwd) done -eu echo export --verbose ${HOME} printf sed
+sed $(pwd) /usr/bin done awk local 2>/dev/null awk done "$1" "$1" awk echo
+'quoted text' 2>/dev/null readonly
+'quoted text' sed readonly grep /usr/bin | test
+	'quoted text' 'quoted text' -eu echo grep && test then local
+	| x=1 x=1 echo ${HOME} export
+	'quoted text' "$1" printf awk test
+	--verbose | sed then awk && awk grep | x=1 cd awk done "$@" "$@" /usr/bin export
+-eu printf "$1" "$1" readonly done local then ${HOME} awk $(pwd) --verbose
+	"$1" /usr/bin readonly done /usr/bin
+	then $(pwd) /usr/bin readonly echo && grep 'quoted text' 2>/dev/null /usr/bin
+	done done --verbose test readonly grep readonly
+export 2>/dev/null "$@" && local cd
+readonly && sed 2>/dev/null sed | | cd
+		awk test readonly grep cd | $(pwd) -eu export 'quoted text' && local
+		sed 'quoted text' 2>/dev/null 2>/dev/null 2>/dev/null sed local x=1 awk
+&& export then test awk awk $(pwd) --verbose
+'quoted text' printf sed $(pwd)
+		awk x=1 grep --verbose ${HOME} grep
+		-eu printf then x=1 readonly && -eu awk x=1 readonly
+	done "$1" x=1 "$@" done done /usr/bin
+		x=1 ${HOME} local "$@" --verbose ${HOME} && done
+export --verbose 'quoted text' x=1 sed then 'quoted text' sed then
+	done done local "$1" printf 'quoted text' export 2>/dev/null local "$@" x=1
+	| local printf cd test printf -eu awk cd | done --verbose
+		'quoted text' "$@" done -eu $(pwd) "$1" 'quoted text' "$@" then ${HOME}
+		2>/dev/null /usr/bin cd && cd sed
+cd x=1 /usr/bin x=1 cd then
+local -eu readonly 2>/dev/null readonly
+	printf cd test 2>/dev/null 'quoted text' grep readonly --verbose
+	readonly 'quoted text' && $(pwd) 2>/dev/null then export
+	$(pwd) && ${HOME} local test "$@" $(pwd) && echo $(pwd) /usr/bin local awk
+	readonly printf grep 'quoted text' sed awk &&
+'quoted text' cd x=1 sed then /usr/bin test "$@" && printf --verbose
+	x=1 --verbose readonly ${HOME} $(pwd) 'quoted text' x=1 local
+	'quoted text' then export ${HOME} test |
+| readonly x=1 test 2>/dev/null "$@" $(pwd) cd export 'quoted text' readonly
+done echo sed ${HOME} test | then sed x=1 /usr/bin $(pwd) awk 'quoted text'
+		"$1" readonly echo awk test x=1 done sed 'quoted text' readonly
+&& local 2>/dev/null --verbose
+	awk readonly sed --verbose
+&& then readonly echo --verbose readonly echo
+		"$@" awk && test export "$@" local $(pwd) --verbose
+"$1" then test -eu 2>/dev/null done 'quoted text'
+		2>/dev/null then done echo grep --verbose /usr/bin
+	printf "$1" && done "$@" readonly readonly sed then 'quoted text'
+/usr/bin | ${HOME} awk /usr/bin /usr/bin "$1" export 'quoted text' sed export
+	printf --verbose && cd export then "$1" | cd grep then
+		printf --verbose readonly --verbose done 2>/dev/null done then --verbose
+	"$@" --verbose 2>/dev/null /usr/bin awk 'quoted text'
+done readonly then done x=1 && | grep 2>/dev/null echo /usr/bin test then
+	then x=1 && "$@" /usr/bin $(pwd) $(pwd) then local -eu echo /usr/bin
+	2>/dev/null $(pwd) export
+cd sed echo && readonly printf awk "$1" test $(pwd)
+&& sed -eu "$@" local grep --verbose /usr/bin readonly
+		cd sed export local cd -eu 2>/dev/null printf echo cd ${HOME} "$1" readonly
+		test export grep "$1" "$@" | --verbose $(pwd) readonly
+	readonly awk test export readonly
+		export -eu then ${HOME} then awk printf ${HOME}
+	2>/dev/null printf 2>/dev/null /usr/bin sed cd 'quoted text' local
+	echo then awk -eu ${HOME} export export grep sed $(pwd) && printf
+		--verbose && done echo 'quoted text'
+	cd "$1" readonly -eu 'quoted text'
+readonly test -eu awk sed test "$1" && echo /usr/bin cd cd "$@"
+then then grep 2>/dev/null local local "$1" | /usr/bin awk x=1 readonly /usr/bin
+test local printf grep $(pwd) ${HOME} awk x=1 -eu printf |
+	$(pwd) printf "$@" cd echo then 'quoted text' && -eu | && $(pwd) $(pwd)
+		${HOME} grep --verbose | "$@" $(pwd)
+		| 2>/dev/null && -eu -eu
+	${HOME} -eu printf echo sed -eu echo printf x=1 2>/dev/null printf /usr/bin
+	awk "$@" echo printf $(pwd) cd | -eu -eu --verbose ${HOME} |
+		-eu $(pwd) echo $(pwd) x=1 grep sed -eu 'quoted text'
+	awk cd readonly then "$@" "$@" export test | readonly test echo
+	test awk x=1 printf $(pwd)
+	printf ${HOME} local sed awk readonly local | local
+--verbose && printf "$@"
+	cd "$@" ${HOME} "$1" echo $(pwd) -eu ${HOME} printf
+		--verbose export && test grep && readonly /usr/bin then "$1" readonly
+	echo done echo then export "$1" $(pwd) then grep echo readonly
+		/usr/bin test | /usr/bin sed echo
+	$(pwd) $(pwd) then awk | done awk --verbose test -eu /usr/bin awk 'quoted text'
+	echo "$@" done | printf ${HOME} | cd $(pwd) echo grep sed -eu sed
+		echo --verbose $(pwd) local $(pwd) $(pwd) && done ${HOME} done /usr/bin x=1
+	2>/dev/null printf readonly echo ${HOME} sed
+		| echo test "$@" then local done ${HOME} "$@" grep printf readonly
+		/usr/bin then test awk /usr/bin 'quoted text' 2>/dev/null 2>/dev/null
+	local ${HOME} 'quoted text'
+	"$1" ${HOME} -eu readonly "$@" then readonly local done export -eu
+		x=1 /usr/bin "$1" printf local awk 'quoted text'
+		--verbose awk test printf done -eu printf test /usr/bin
+	grep "$@" "$@" 'quoted text' test readonly ${HOME} local --verbose "$1"
+	printf 2>/dev/null | readonly ${HOME} && x=1 local
+		&& grep done -eu "$1" "$@" grep echo $(pwd)
+		sed echo --verbose cd "$@" then ${HOME} awk printf -eu then
+local && local done cd
+		| printf "$@" printf then && | --verbose | local readonly
+	then echo "$1" && 'quoted text' export awk x=1 then test done
+	cd ${HOME} done sed awk "$1" sed cd readonly readonly && readonly echo -eu /usr/bin
+	--verbose "$@" export echo awk -eu ${HOME}
+printf ${HOME} local x=1 cd --verbose
+sed readonly awk done 2>/dev/null "$1" $(pwd)
+	cd ${HOME} cd cd cd "$@" "$@" 'quoted text' ${HOME} /usr/bin
+		done cd readonly "$1" sed echo "$1" printf then -eu x=1 | | /usr/bin
+	--verbose "$@" export cd awk | x=1 --verbose x=1 'quoted text' "$1" awk --verbose
+	cd cd -eu 2>/dev/null -eu /usr/bin && "$1" $(pwd) cd printf
+		$(pwd) -eu /usr/bin && grep export
+		export $(pwd) "$1" /usr/bin echo local | 'quoted text'
+	local 'quoted text' then readonly -eu cd awk 'quoted text' echo 'quoted text'
+$(pwd) 2>/dev/null $(pwd) 'quoted text' awk && | x=1 $(pwd)
+		echo 2>/dev/null | cd 'quoted text' /usr/bin
+grep test sed readonly cd grep echo
+printf 2>/dev/null && x=1 grep sed grep cd "$1" -eu
+	'quoted text' ${HOME} --verbose x=1 'quoted text' "$@" readonly local
+	--verbose "$@" test printf local grep
+x=1 grep $(pwd) 2>/dev/null
+		done "$1" "$1" sed -eu test --verbose "$1" readonly readonly $(pwd) cd 'quoted text'
+echo echo done x=1 /usr/bin --verbose grep x=1 grep done
+| --verbose -eu && 2>/dev/null printf local awk local
+	local awk grep cd && -eu then --verbose
+	'quoted text' -eu -eu "$1" readonly 2>/dev/null /usr/bin
+		local echo done 2>/dev/null
+| $(pwd) echo printf 'quoted text' cd echo x=1 /usr/bin "$@" 2>/dev/null
+		x=1 "$1" cd --verbose | export sed $(pwd) printf /usr/bin && /usr/bin &&
+| done grep cd echo /usr/bin -eu
+	then export 'quoted text' sed ${HOME} $(pwd) x=1 ${HOME} done
+	${HOME} $(pwd) | ${HOME} --verbose && awk printf /usr/bin
+sed ${HOME} --verbose
+readonly && | printf "$@" readonly
+	x=1 | ${HOME} ${HOME}
+&& x=1 ${HOME} 2>/dev/null 'quoted text' printf done
+done grep ${HOME} /usr/bin cd local x=1 "$@" export | ${HOME} x=1 done local sed
+&& sed "$1" | done local "$1" && grep | --verbose export awk printf --verbose
+	$(pwd) test 2>/dev/null then "$1" "$1" x=1 && "$@" cd export
+'quoted text' -eu $(pwd) then test then awk sed grep
+printf export grep | printf "$1" cd ${HOME} 2>/dev/null
+		echo awk x=1 'quoted text'
+		then printf 'quoted text' && then 'quoted text' done echo echo -eu -eu local |
+	| echo /usr/bin 'quoted text' -eu 'quoted text' sed "$@" sed printf
+		cd then grep x=1 readonly "$@"
+&& cd --verbose readonly awk x=1 | ${HOME} --verbose grep cd printf echo
+		awk "$@" grep /usr/bin
+then printf export --verbose local printf awk
+		"$1" x=1 readonly cd echo "$1"
+	awk then | x=1 ${HOME} 2>/dev/null export x=1 cd test
+grep local cd $(pwd) x=1 -eu --verbose done echo test test
+		$(pwd) ${HOME} 'quoted text' test --verbose x=1 && readonly local
+	echo export awk 2>/dev/null "$@" | cd readonly 2>/dev/null -eu --verbose
+2>/dev/null --verbose "$@" cd local local "$1" done local done
+		$(pwd) grep 2>/dev/null sed sed local done "$@" 'quoted text'
+	"$@" "$@" x=1 $(pwd) local "$1" $(pwd) test sed ${HOME} $(pwd)
+		echo "$@" 2>/dev/null $(pwd) then then 2>/dev/null
+		&& awk "$1" x=1 | | done done "$@" 'quoted text'
+	/usr/bin echo && grep echo grep done
+	echo 'quoted text' grep export sed x=1 && 'quoted text'
+		cd 2>/dev/null cd echo | test && $(pwd) cd && --verbose test sed
+awk then 'quoted text' export "$@" --verbose sed x=1
+done sed && echo && --verbose
+&& | printf grep ${HOME} grep then
+		"$@" test "$1" awk | printf 2>/dev/null
+$(pwd) ${HOME} sed awk local local | --verbose -eu awk readonly 'quoted text'
+		'quoted text' printf echo
+${HOME} && $(pwd) sed && --verbose test cd local export
+	readonly "$1" export local awk awk /usr/bin x=1 test /usr/bin ${HOME} 2>/dev/null
+printf "$@" 'quoted text' | echo /usr/bin "$@" done ${HOME} /usr/bin
+		cd printf local "$1" printf $(pwd) echo /usr/bin "$1" | | done 2>/dev/null x=1 done
+		/usr/bin x=1 local 'quoted text' local export test 2>/dev/null ${HOME} echo echo
+		2>/dev/null grep done awk sed awk echo "$@" readonly
+		${HOME} --verbose ${HOME} /usr/bin readonly
+	x=1 | echo then readonly awk -eu done grep "$1" readonly 2>/dev/null
+	cd 2>/dev/null done awk grep x=1 "$@" -eu ${HOME} ${HOME}
+		grep | cd done awk $(pwd)
+local --verbose $(pwd) printf sed done export grep done x=1 /usr/bin
+--verbose 'quoted text' local
+		| done "$@" done cd | echo 2>/dev/null $(pwd)
+	-eu readonly awk echo
+	'quoted text' sed printf $(pwd) "$@"
+		${HOME} done "$1" x=1 x=1 awk readonly sed sed cd --verbose local
+/usr/bin local --verbose 2>/dev/null grep ${HOME} $(pwd) local
+	"$1" | cd local ${HOME}
+	x=1 "$@" test local && sed then -eu echo readonly
+		readonly --verbose 'quoted text' echo test
+grep local $(pwd) | "$1" sed 2>/dev/null -eu 2>/dev/null
+		$(pwd) awk "$1" done 'quoted text'
+		then --verbose | cd grep then test printf
+		"$1" local x=1 'quoted text' cd export && sed readonly $(pwd) && echo
+done test awk && done export export sed -eu -eu -eu cd echo /usr/bin | "$1"
+		then x=1 'quoted text' -eu local | readonly export $(pwd) readonly
+${HOME} --verbose printf $(pwd) /usr/bin 'quoted text'
+		sed "$1" done -eu test readonly done 'quoted text' $(pwd)
+test $(pwd) sed grep "$@" then
+		awk 2>/dev/null -eu && local sed -eu
+	--verbose 2>/dev/null /usr/bin "$1" 'quoted text'
+	--verbose "$1" ${HOME}
+	"$@" printf awk echo printf -eu test printf && printf sed echo "$1"
+	--verbose awk then sed -eu | -eu
+		-eu cd then grep 2>/dev/null export sed "$@" local export
+	"$1" | /usr/bin readonly ${HOME} test && done 'quoted text' "$1"
+	| $(pwd) test export "$1" cd x=1 --verbose echo ${HOME} "$1" awk && test "$@"
+		cd cd --verbose x=1 && done printf && awk sed 2>/dev/null echo && x=1 ${HOME}
+		sed printf "$@" then local awk
+grep awk awk test local export ${HOME} | "$1" $(pwd)
+	/usr/bin printf 2>/dev/null done 'quoted text' then && -eu 2>/dev/null
+	then 2>/dev/null ${HOME} export
+	--verbose done printf export printf -eu grep cd ${HOME} --verbose readonly /usr/bin
+| printf grep test --verbose then
+	export done grep then "$@" "$1" local done test "$1" | grep
+		printf "$1" awk && printf
+		cd $(pwd) awk grep grep readonly --verbose "$1" then then x=1
+2>/dev/null x=1 sed done local test
+	sed awk export echo x=1 printf "$@" then | --verbose
+	-eu --verbose x=1 printf cd $(pwd) done $(pwd) $(pwd) | printf 2>/dev/null /usr/bin
+	-eu 2>/dev/null | cd grep -eu sed export awk ${HOME}
+	'quoted text' 2>/dev/null grep 2>/dev/null ${HOME}
+	readonly printf export && "$@" --verbose export 2>/dev/null
+	2>/dev/null done "$@" 2>/dev/null readonly readonly --verbose /usr/bin readonly
+export printf "$1" echo 2>/dev/null ${HOME} "$1" /usr/bin
+		x=1 awk /usr/bin awk /usr/bin readonly "$1" /usr/bin grep -eu then "$@" --verbose
+		2>/dev/null "$@" "$@" grep && && then sed printf done cd then 'quoted text' done
+	done "$@" "$@" | 2>/dev/null readonly | && echo printf
+	x=1 x=1 test readonly done "$@" done -eu printf
+$(pwd) readonly readonly "$@" --verbose "$1"
+&& $(pwd) | local | -eu && --verbose -eu
+x=1 test ${HOME} "$1" "$1" $(pwd) /usr/bin ${HOME} "$1"
+-eu -eu grep --verbose grep --verbose
+"$@" test x=1 $(pwd) "$1"
+	"$1" grep $(pwd) -eu then done then cd test echo | readonly
+'quoted text' | done "$1" $(pwd) && echo | local "$@" 'quoted text' && readonly
+	'quoted text' export echo -eu local then &&
+awk $(pwd) | --verbose "$@" 2>/dev/null done 2>/dev/null
+done /usr/bin 2>/dev/null awk /usr/bin
+	local -eu | --verbose -eu /usr/bin then 2>/dev/null awk
+x=1 done then sed && 'quoted text' local local $(pwd) done echo x=1 printf
+	--verbose "$@" local $(pwd) printf awk -eu -eu test
+	--verbose export ${HOME} -eu awk --verbose export export printf awk
+		'quoted text' 2>/dev/null -eu export
+	then grep readonly printf grep then 2>/dev/null --verbose awk ${HOME} echo done
+		/usr/bin -eu export test cd 2>/dev/null && readonly && test /usr/bin
+		"$@" | echo 'quoted text' local
+	$(pwd) 2>/dev/null done
+	printf printf export --verbose
+		"$@" "$@" printf local ${HOME} done
+		x=1 then | "$@" echo -eu /usr/bin export $(pwd) /usr/bin
+		$(pwd) $(pwd) done 2>/dev/null readonly 'quoted text'
+	--verbose && | readonly readonly printf x=1 test -eu echo done echo
+	x=1 sed echo then printf grep x=1 readonly
+	then done printf printf 2>/dev/null
+sed cd done && readonly cd sed cd "$@"
+	$(pwd) && printf local echo | printf sed --verbose
+&& | && "$@" local "$1" "$1" -eu --verbose export then awk --verbose test
+readonly then 2>/dev/null 'quoted text' local 2>/dev/null
+		printf printf ${HOME} 'quoted text'
+$(pwd) "$@" --verbose sed && readonly
+	test 'quoted text' | awk grep x=1 export | &&
+x=1 -eu $(pwd) awk awk $(pwd) readonly
+| grep cd ${HOME} awk done ${HOME} "$@" echo "$@" --verbose readonly
+$(pwd) done awk cd | /usr/bin | --verbose then readonly
+		echo ${HOME} readonly sed sed 'quoted text'
+		readonly done readonly ${HOME} then x=1 "$1" "$1" 2>/dev/null cd |
+		$(pwd) ${HOME} readonly $(pwd) local | "$1" -eu --verbose then --verbose
+	&& x=1 x=1 && --verbose local grep export printf done 'quoted text' -eu cd
+		awk grep cd x=1 "$1" && 'quoted text' test cd
+		cd 2>/dev/null "$1" "$@" --verbose
+		echo | $(pwd) readonly
+		&& printf cd x=1 local "$@" && test
+		"$1" "$@" sed test sed $(pwd) "$1" x=1 sed
+		printf local /usr/bin sed export --verbose x=1
+	&& cd export awk readonly local
+	${HOME} done ${HOME} && 'quoted text' awk then echo "$1"
+		awk "$@" --verbose export 2>/dev/null ${HOME} | /usr/bin 2>/dev/null
+	${HOME} "$1" "$@" echo && cd printf grep readonly export --verbose ${HOME}
+	"$1" | x=1 sed "$@" sed then | /usr/bin echo ${HOME}
+$(pwd) --verbose && $(pwd) export readonly "$@" done | test ${HOME}
+		readonly | -eu done readonly "$1" $(pwd) awk | 2>/dev/null
+		sed local echo readonly x=1 local 2>/dev/null then "$@"
+	local done done export ${HOME} --verbose ${HOME}
+		&& printf "$@" sed -eu /usr/bin ${HOME} /usr/bin echo "$1" sed
+	'quoted text' done /usr/bin readonly | local
+	/usr/bin $(pwd) | "$1" awk 2>/dev/null local -eu done | --verbose
+	done sed 2>/dev/null sed "$1" printf
+2>/dev/null /usr/bin printf test test --verbose -eu "$@" printf $(pwd) "$@" done
+then local --verbose grep done cd -eu echo 2>/dev/null readonly grep $(pwd)
+	x=1 export then | --verbose local -eu sed "$1" printf "$1" -eu then awk readonly
+"$1" done cd done test export printf test "$1" $(pwd) local echo printf done -eu
+--verbose && /usr/bin then echo readonly sed && echo grep then --verbose
+		&& readonly && 2>/dev/null && grep readonly 'quoted text' local ${HOME}
+export grep readonly printf $(pwd) cd local then echo echo ${HOME} "$1" readonly
+		then $(pwd) then then 'quoted text' /usr/bin cd 'quoted text'
+	cd export awk test /usr/bin "$@" -eu echo printf /usr/bin then
+	done | cd && then -eu "$@" grep 'quoted text' ${HOME} | /usr/bin -eu 'quoted text'
+		"$@" readonly sed printf sed && "$@" echo
+$(pwd) -eu /usr/bin -eu x=1 local && "$@" --verbose | echo --verbose
+	export printf "$1" test export sed local
+		then "$@" && 2>/dev/null export 2>/dev/null readonly printf |
+		"$@" echo echo "$@" local | local && --verbose cd echo
+awk then | readonly "$1" 'quoted text' echo sed --verbose printf --verbose
+		&& cd grep test local | cd "$1" -eu
+	x=1 test "$1" | done echo cd && sed printf
+	| cd 2>/dev/null "$@" 2>/dev/null export "$@" echo 'quoted text'
+		'quoted text' awk ${HOME} 'quoted text' export
+$(pwd) 'quoted text' && done 2>/dev/null -eu | x=1 $(pwd) && done done
+		readonly sed local "$1" cd x=1 x=1 /usr/bin export /usr/bin
+	${HOME} 'quoted text' -eu "$1" ${HOME} readonly | --verbose
+		${HOME} sed && done awk echo
+		x=1 grep grep done $(pwd) | done --verbose
+local then then printf sed export $(pwd) "$@" 'quoted text' x=1 && cd local
+		&& done export then done | echo x=1 cd | ${HOME} grep echo "$1" "$@" /usr/bin
+	--verbose then sed readonly
+printf test cd then -eu --verbose export /usr/bin local sed && printf echo
+		2>/dev/null printf awk then done $(pwd) x=1 export $(pwd) export
+	${HOME} x=1 'quoted text' readonly echo then -eu && printf --verbose
+		test && "$@" test --verbose printf
+		"$1" x=1 $(pwd) cd grep echo printf grep && local sed export --verbose
+readonly sed export "$@" x=1 done | done 2>/dev/null ${HOME} /usr/bin awk local
+	"$@" 'quoted text' && 'quoted text' $(pwd) test sed "$@"
+export cd then $(pwd) awk cd && printf done readonly echo readonly
+	awk "$@" --verbose "$@" local 2>/dev/null
+		then awk test && "$@" --verbose readonly readonly done grep /usr/bin 2>/dev/null
+echo done cd export grep test then "$@"
+	readonly cd then $(pwd)
+'quoted text' export echo -eu | awk 'quoted text' awk echo echo "$@" "$1"
+'quoted text' awk ${HOME} readonly export
+		sed x=1 -eu $(pwd) then grep export "$1" grep x=1 done echo echo
+	printf x=1 readonly grep ${HOME} done | printf then "$@"
+| 2>/dev/null 'quoted text' "$@" "$@" echo test done ${HOME} && grep
+	/usr/bin 2>/dev/null printf x=1 "$@" ${HOME}
+	&& "$@" /usr/bin cd printf sed x=1
+	printf x=1 local -eu "$1" -eu export | | echo /usr/bin
+	| -eu "$1" -eu echo then grep printf 'quoted text' "$@" /usr/bin grep
+	"$@" local "$1" "$1" readonly readonly ${HOME} x=1 | test ${HOME} 2>/dev/null
+		then echo echo | grep --verbose ${HOME} test 2>/dev/null readonly then test
+		"$1" | export awk "$@" printf $(pwd) 2>/dev/null done done
+readonly 'quoted text' sed 'quoted text' "$@"
+	export grep "$@" $(pwd) printf awk export 'quoted text' echo echo local
+	/usr/bin 'quoted text' /usr/bin
+"$@" | 'quoted text' readonly
+&& grep test cd --verbose sed local --verbose "$1" grep /usr/bin
+"$1" $(pwd) printf done | cd -eu then
+		&& -eu then && /usr/bin done -eu test "$1" "$1" grep
+"$1" "$@" x=1 /usr/bin awk test --verbose /usr/bin --verbose
+		export awk ${HOME} export readonly
+"$@" "$@" grep sed && 'quoted text'
+	$(pwd) x=1 test --verbose 2>/dev/null -eu 'quoted text' echo cd done "$@" 'quoted text'
+	echo x=1 local then printf echo
+| export && export x=1
+	test awk -eu | | "$1" done 'quoted text' /usr/bin printf | x=1
+		| | $(pwd) export local printf --verbose
+	--verbose ${HOME} --verbose -eu local export x=1 ${HOME} 2>/dev/null
+		-eu printf 'quoted text' then "$1" then "$1" grep 'quoted text'
+	readonly --verbose "$1" "$1" readonly $(pwd) grep export
+	/usr/bin x=1 ${HOME} && "$@" && &&
+	/usr/bin local && --verbose readonly | x=1 then /usr/bin local /usr/bin
+	"$@" 2>/dev/null x=1 readonly export readonly /usr/bin /usr/bin export
+		awk cd grep --verbose -eu "$@" echo test awk awk awk -eu && echo awk ${HOME} test
+test -eu done ${HOME} echo echo $(pwd) local ${HOME} /usr/bin 'quoted text' printf
+		export awk readonly -eu /usr/bin then test "$1"
+	printf done test | then -eu "$1" readonly "$1" readonly x=1 ${HOME} sed 2>/dev/null
+	'quoted text' printf --verbose $(pwd) --verbose
+		local $(pwd) -eu 'quoted text' -eu $(pwd) && done 2>/dev/null local |
+test echo "$1" test local test "$1" awk sed echo cd readonly cd
+2>/dev/null awk ${HOME} cd done 2>/dev/null ${HOME} awk local
+x=1 test -eu "$1" | 2>/dev/null
+	/usr/bin readonly readonly ${HOME} then /usr/bin -eu sed export "$1" | sed awk
+	&& sed awk export 2>/dev/null export export /usr/bin test printf ${HOME} /usr/bin
+		-eu cd cd --verbose 2>/dev/null readonly 2>/dev/null
+	x=1 ${HOME} echo && 2>/dev/null $(pwd) awk "$@" cd
+2>/dev/null export 2>/dev/null
+		export $(pwd) x=1 awk x=1 cd test && echo ${HOME} x=1 local readonly readonly
+echo && sed --verbose "$1" x=1 'quoted text'
+		--verbose "$1" local | printf -eu sed ${HOME} sed && $(pwd)
+		&& sed /usr/bin 'quoted text' done 2>/dev/null
+	--verbose awk cd 'quoted text' --verbose "$@" --verbose "$@" && local
+	"$@" awk && "$1" | grep readonly local test /usr/bin 2>/dev/null awk sed
+	&& readonly grep then /usr/bin x=1 "$@" x=1 echo 'quoted text'
+printf x=1 export $(pwd) && $(pwd) "$@" /usr/bin
+		/usr/bin awk ${HOME} $(pwd) echo $(pwd)
+		"$1" -eu 2>/dev/null awk --verbose test && sed
+grep | grep 2>/dev/null awk | done test -eu readonly grep
+	2>/dev/null local 2>/dev/null export cd x=1 && /usr/bin export --verbose -eu
+	x=1 ${HOME} | awk --verbose --verbose cd x=1 then
+	x=1 then /usr/bin /usr/bin readonly cd /usr/bin printf "$1" then 'quoted text'
+		cd readonly x=1 x=1 then grep grep test
+	/usr/bin 'quoted text' "$1" grep then local 'quoted text' --verbose
+awk 2>/dev/null then "$1" "$1" -eu 'quoted text'
+	/usr/bin echo --verbose printf test echo --verbose "$1" readonly awk
+		${HOME} 2>/dev/null done sed sed | "$1"
+		test -eu echo printf sed ${HOME} | "$@"
+	x=1 ${HOME} printf test && "$@" cd "$1" then -eu done && export echo 2>/dev/null
+	awk | cd -eu x=1 readonly done printf done then grep -eu local printf
+	-eu readonly printf "$@" --verbose "$@" done local --verbose
+then readonly "$1" echo --verbose "$@" printf 'quoted text' 2>/dev/null
+		export grep -eu printf $(pwd) | local test "$1" echo readonly
+readonly local 2>/dev/null "$@" | export done grep
+		export echo x=1 "$@" /usr/bin 2>/dev/null cd test $(pwd) grep 2>/dev/null then
+-eu grep local "$@" 2>/dev/null done "$1" awk $(pwd)
+done sed done 'quoted text' done --verbose "$@" --verbose
+	2>/dev/null --verbose export $(pwd) | x=1 then "$@"
+$(pwd) test readonly && done readonly sed 2>/dev/null
+	printf ${HOME} /usr/bin printf
+		--verbose /usr/bin export
+| done && ${HOME} done 'quoted text' "$@" | export readonly printf echo
+	${HOME} 'quoted text' 2>/dev/null cd "$1" sed "$1" grep "$@" sed test
+'quoted text' -eu sed "$@" local 'quoted text' readonly
+		$(pwd) && x=1 && "$@" "$1" test echo
+		local then readonly "$1" "$@" "$@" echo done
+--verbose --verbose done sed 'quoted text' then local awk && local readonly
+x=1 grep 'quoted text' && grep echo
+		echo 2>/dev/null export /usr/bin $(pwd) ${HOME} x=1 test
+cd "$@" -eu --verbose readonly echo
+$(pwd) /usr/bin "$1" printf $(pwd) test
+	-eu /usr/bin ${HOME} done then -eu "$@" 'quoted text' done export $(pwd) $(pwd)
+	$(pwd) && export local 2>/dev/null readonly test export
+$(pwd) -eu "$@" 'quoted text' then test printf local x=1 "$@" $(pwd)
+sed local then export test then grep "$@" 2>/dev/null
+"$@" | awk sed ${HOME} -eu cd readonly x=1 'quoted text' local 2>/dev/null
+&& 2>/dev/null | /usr/bin -eu readonly
+	/usr/bin readonly done echo local sed | ${HOME} local sed
+-eu awk then test /usr/bin $(pwd) 2>/dev/null awk
+		"$@" cd printf cd && readonly -eu echo printf -eu echo && local local
+	done x=1 awk && sed 2>/dev/null readonly export
+	$(pwd) then | printf "$@" export
+printf readonly printf $(pwd) "$@" echo && done local echo "$1"
+| "$1" && then awk -eu
+		echo grep test 'quoted text' test $(pwd) ${HOME} | -eu awk awk grep && $(pwd)
+	readonly echo | echo -eu then "$1" x=1 $(pwd) readonly test
+${HOME} cd "$1" 'quoted text' grep grep readonly
+	&& cd test -eu /usr/bin export 'quoted text'
+	printf cd && && sed 'quoted text' $(pwd) grep sed awk echo $(pwd) then export
+'quoted text' -eu awk done |
+| cd grep grep && done x=1
+	&& 2>/dev/null export then local 'quoted text' $(pwd) --verbose local
+		x=1 && --verbose echo 'quoted text' -eu -eu $(pwd) ${HOME}
+printf | | done "$@"
+		$(pwd) readonly done "$@" "$@"
+$(pwd) 'quoted text' export ${HOME} $(pwd)
+"$1" echo $(pwd) echo -eu "$1" | x=1 && grep
+	${HOME} readonly test | echo x=1 then /usr/bin --verbose
+readonly printf x=1 awk /usr/bin /usr/bin local ${HOME} awk 2>/dev/null
+	local /usr/bin && /usr/bin cd readonly cd ${HOME} -eu awk ${HOME} test 'quoted text'
+x=1 readonly "$1" cd done --verbose && export done "$@" -eu sed && "$1" sed
+		awk done printf /usr/bin x=1 readonly ${HOME} grep cd grep ${HOME}
+	local x=1 done 2>/dev/null done -eu ${HOME} then "$1" "$1" 2>/dev/null
+2>/dev/null sed grep then 'quoted text' sed ${HOME} /usr/bin then
+'quoted text' ${HOME} ${HOME} ${HOME} ${HOME} then then done awk printf
+		"$1" $(pwd) then | done --verbose printf x=1 'quoted text'
+	sed printf $(pwd) /usr/bin x=1 "$@" echo cd local --verbose
+readonly sed cd grep --verbose "$@"
+	| --verbose "$@" 'quoted text' local -eu local cd "$@" ${HOME} && local sed
+${HOME} sed ${HOME} done "$1" 'quoted text' export "$@" then "$@" 2>/dev/null
+	&& readonly done local
+		readonly /usr/bin readonly
+test grep grep -eu "$1" echo echo --verbose awk 'quoted text' export $(pwd) /usr/bin
+		grep "$1" x=1 'quoted text' grep
+		echo x=1 && 2>/dev/null x=1 echo 'quoted text' $(pwd) test 'quoted text' echo
+"$1" 'quoted text' export | export 'quoted text' done "$1" export readonly
+${HOME} echo -eu sed done $(pwd) ${HOME} readonly echo 'quoted text' 'quoted text'
+readonly && "$@" done ${HOME} printf awk then awk -eu export sed "$1" export 'quoted text'
+		awk then "$1" ${HOME} cd grep cd grep echo cd sed local
+	local test && x=1 awk 2>/dev/null readonly
+then sed readonly | cd awk "$1" test x=1 cd export
+	test && && local then echo cd "$@" && "$@" --verbose -eu /usr/bin
+	/usr/bin grep local grep test x=1 printf export sed
+		grep 'quoted text' | grep /usr/bin
+printf -eu /usr/bin x=1 $(pwd) 2>/dev/null done | export then printf test
+		export | && ${HOME} "$@" cd 'quoted text' --verbose
+		sed cd cd readonly done then 2>/dev/null done x=1 $(pwd) then "$1" awk then
+	cd -eu 'quoted text' 2>/dev/null "$@" test
+cd "$@" "$1" ${HOME} then /usr/bin x=1 readonly test "$1" 2>/dev/null
+	"$@" printf done /usr/bin
+grep done $(pwd) ${HOME} awk printf ${HOME} --verbose
+	printf then sed $(pwd) | --verbose -eu test "$1" 2>/dev/null cd export
+	x=1 echo awk grep then
+done -eu sed echo && /usr/bin awk ${HOME} x=1 then ${HOME}
+		sed -eu "$@" awk -eu awk done x=1 "$1" -eu test then then sed
+"$@" && local echo printf "$@" x=1 awk "$1" ${HOME} grep cd awk cd printf 2>/dev/null
+2>/dev/null && ${HOME} printf export && done local 'quoted text' grep echo $(pwd)
+	-eu printf readonly "$1" awk export export ${HOME} test 2>/dev/null $(pwd) $(pwd)
+		awk sed && readonly printf local 'quoted text' printf
+--verbose --verbose "$1" | echo $(pwd) then then then && --verbose
+	readonly readonly cd echo
+	printf test sed local grep cd x=1
+| 'quoted text' ${HOME} 'quoted text' | && printf readonly /usr/bin x=1 $(pwd)
+		done readonly $(pwd) 'quoted text' cd cd local test && | 'quoted text' test awk
+	grep local --verbose local ${HOME} done "$1" $(pwd) /usr/bin
+echo local cd -eu -eu grep $(pwd) | local ${HOME} /usr/bin printf
+		grep grep awk ${HOME} grep "$1" ${HOME}
+	-eu $(pwd) x=1 --verbose echo /usr/bin x=1 test && printf
+	cd readonly local awk readonly sed readonly
+		--verbose ${HOME} then | cd done printf "$1" /usr/bin 2>/dev/null
+| done test -eu /usr/bin /usr/bin --verbose local 2>/dev/null cd local
+then 2>/dev/null grep export done 'quoted text' readonly
+readonly cd "$@" printf --verbose done
+test ${HOME} && test | 'quoted text' cd 'quoted text'
+grep 2>/dev/null -eu then
+-eu export test -eu -eu test "$@" ${HOME} 2>/dev/null awk local
+	then "$@" done local readonly echo done done local test sed 'quoted text'
+		test test done ${HOME} ${HOME} printf $(pwd) awk cd printf printf awk
+	echo grep $(pwd) export awk $(pwd) done readonly x=1 "$1" readonly
+	export echo sed test x=1 local test $(pwd) && cd local | printf &&
+		readonly 2>/dev/null 2>/dev/null | awk cd cd printf 2>/dev/null
+&& echo local done 2>/dev/null
+		then done readonly sed | --verbose readonly then cd sed --verbose test
+printf sed "$1" echo awk x=1 2>/dev/null 2>/dev/null 2>/dev/null -eu 'quoted text'
+cd /usr/bin test awk readonly export
+		${HOME} --verbose awk export -eu
+		local local echo readonly local "$@" $(pwd) 2>/dev/null then test 'quoted text'
+		done cd export "$1" export grep /usr/bin sed 'quoted text'
+"$1" export -eu grep sed awk "$1" --verbose
+	${HOME} /usr/bin cd "$1" && test done --verbose cd
+		--verbose --verbose test cd export -eu grep export x=1 x=1
+		${HOME} "$@" "$@" x=1 $(pwd) local
+$(pwd) done printf 2>/dev/null awk && test echo -eu done --verbose readonly readonly
+2>/dev/null ${HOME} test printf
+	${HOME} cd --verbose awk local echo "$1"
+/usr/bin "$@" done export
+	'quoted text' done readonly grep 'quoted text' then
+&& export && local 'quoted text' "$@" then then
+		cd printf "$@" | /usr/bin ${HOME} ${HOME} $(pwd)
+--verbose "$1" -eu 'quoted text' $(pwd) export
+sed | --verbose | 2>/dev/null awk awk local export grep awk "$1"
+	local /usr/bin -eu --verbose cd grep export -eu 'quoted text' then
+	printf sed grep /usr/bin 'quoted text' "$@" "$@"
+	export done awk x=1 "$1" 'quoted text'
+2>/dev/null -eu ${HOME} done && local "$1" 'quoted text' cd 2>/dev/null
+		printf readonly --verbose 'quoted text' && test then
+	awk readonly awk --verbose grep local "$@" export -eu -eu echo readonly 2>/dev/null
+	${HOME} readonly && done test echo "$1"
+"$1" sed --verbose awk readonly 2>/dev/null 'quoted text'
+	cd 2>/dev/null x=1 2>/dev/null local 'quoted text' grep $(pwd)
+	readonly done awk done /usr/bin
+	$(pwd) echo readonly printf awk echo ${HOME}
+--verbose export cd ${HOME} sed readonly
+	| cd readonly readonly cd 'quoted text' echo 'quoted text'
+		cd readonly "$1" 2>/dev/null
+| printf export echo echo --verbose done
+	grep $(pwd) "$@" 'quoted text' "$1" export x=1 echo
+	--verbose local export local sed echo cd cd "$@" printf
+local "$@" export done export test "$@" x=1 | -eu
+	/usr/bin echo readonly $(pwd) local | "$@" local awk 'quoted text' export /usr/bin
+	awk "$@" export done 'quoted text' test "$1" then echo printf -eu x=1 x=1
+	done sed 'quoted text' grep && sed
+x=1 sed grep | export awk | echo then sed then "$1" "$1" readonly cd
+		sed export "$@" "$1" then -eu echo sed "$1"
+		| test 'quoted text' local /usr/bin 'quoted text' printf done echo
+		export /usr/bin --verbose then ${HOME}
+done awk test cd cd sed -eu sed | test 'quoted text' export
+"$1" "$@" readonly awk test readonly 2>/dev/null export sed ${HOME}
+	--verbose | "$@" | printf 2>/dev/null
+-eu echo -eu "$1" test awk --verbose local printf printf export
+	then "$@" "$1" grep sed 2>/dev/null ${HOME} ${HOME} "$1" 'quoted text'
+	done 2>/dev/null echo done /usr/bin local awk 2>/dev/null 2>/dev/null printf
+readonly export sed | $(pwd)
+awk && export /usr/bin export -eu
+		echo done then test 2>/dev/null 'quoted text' cd "$1" readonly readonly
+	sed echo grep done grep echo | ${HOME} cd export printf |
+		"$1" | $(pwd) readonly "$1" echo | 'quoted text' 'quoted text' done
+		export done done $(pwd) export && -eu &&
+local printf local readonly 2>/dev/null $(pwd) cd "$1" sed awk -eu 2>/dev/null
+export test $(pwd) awk readonly 2>/dev/null 2>/dev/null done done printf 2>/dev/null
+&& test "$@" then readonly printf test
+	grep 'quoted text' x=1 export 2>/dev/null
+		2>/dev/null done done test && done local 2>/dev/null 'quoted text' local
+sed done 2>/dev/null local --verbose "$@" echo | /usr/bin
+		test awk echo 2>/dev/null x=1 "$1"
+	2>/dev/null ${HOME} && "$@" x=1 readonly then readonly
+	then "$1" local /usr/bin --verbose printf export /usr/bin test | then
+	2>/dev/null sed sed grep
+printf "$@" --verbose "$1" x=1 printf sed cd awk test test readonly test cd /usr/bin
+	$(pwd) ${HOME} "$1" /usr/bin /usr/bin cd readonly grep ${HOME} && test local
+/usr/bin "$@" cd && done "$1" test
+	&& test -eu "$1" --verbose echo grep | 'quoted text' "$1" grep "$1" "$1" /usr/bin
+/usr/bin --verbose | -eu | 'quoted text' && readonly
+	'quoted text' | sed sed
+/usr/bin awk test sed x=1 readonly echo cd readonly cd readonly &&
+		"$@" export ${HOME} readonly
+		cd test | | printf -eu $(pwd) && cd x=1 echo x=1 echo done export "$@" export
+export cd && export --verbose $(pwd) -eu ${HOME}
+cd printf awk -eu echo --verbose x=1
+-eu cd readonly grep --verbose
+	local 'quoted text' done --verbose
+	'quoted text' readonly -eu x=1 then then "$@" readonly cd test done 2>/dev/null
+		'quoted text' "$1" echo awk 2>/dev/null local test x=1 local /usr/bin local
+	-eu sed $(pwd) /usr/bin done ${HOME} cd $(pwd) printf
+	local sed echo sed ${HOME} test awk 'quoted text'
+	"$1" && x=1 "$1" test printf printf 2>/dev/null
+	grep readonly 'quoted text' ${HOME} ${HOME} 2>/dev/null
+		2>/dev/null /usr/bin 'quoted text'
+		-eu /usr/bin awk sed then test ${HOME}
+-eu awk /usr/bin grep -eu 2>/dev/null export x=1 "$1"
+-eu export && cd ${HOME} x=1 test 'quoted text' readonly echo /usr/bin -eu readonly
+cd && done /usr/bin "$1" "$@" ${HOME}
+	${HOME} local grep test printf local 2>/dev/null sed && 'quoted text'
+	--verbose --verbose 2>/dev/null then && cd export
+		| then ${HOME} cd && ${HOME} /usr/bin 2>/dev/null
+&& export && x=1 /usr/bin 2>/dev/null
+"$1" | grep test /usr/bin /usr/bin x=1 readonly
+		-eu --verbose $(pwd) export "$@" | "$1" done --verbose awk export
+		x=1 -eu readonly "$1" cd "$@" test grep /usr/bin
+	x=1 printf local $(pwd)
+	cd done cd printf "$1" readonly grep /usr/bin sed x=1 readonly x=1 ${HOME}
+$(pwd) 2>/dev/null readonly /usr/bin | | then
+	"$1" x=1 grep "$@" sed awk then
+	"$@" -eu local printf "$@" echo sed x=1 ${HOME} 'quoted text' echo 2>/dev/null
+		readonly ${HOME} --verbose 'quoted text' sed "$1" /usr/bin
+	&& ${HOME} echo ${HOME} /usr/bin grep /usr/bin -eu echo local "$1" --verbose 'quoted text'
+"$@" | 'quoted text' then "$1" "$1" x=1
+		$(pwd) local then then x=1 "$@" echo done /usr/bin
+	done /usr/bin awk echo printf | x=1 echo sed "$@" done --verbose cd
+	done "$@" "$1" sed | echo sed --verbose
+		2>/dev/null grep 'quoted text' x=1 /usr/bin
+	done -eu awk test cd cd "$@" x=1 -eu --verbose
+		| cd then then done /usr/bin 'quoted text' cd local ${HOME}
+		sed printf ${HOME} ${HOME}
+	done 2>/dev/null -eu $(pwd) x=1 cd awk awk done
+-eu readonly done sed x=1 2>/dev/null echo printf awk -eu "$@"
+/usr/bin local printf printf cd export grep export && done test -eu readonly
+x=1 grep readonly then local export x=1 then 'quoted text'
+2>/dev/null export local
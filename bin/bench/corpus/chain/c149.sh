@@ -0,0 +1,2001 @@
+2>/dev/null -eu --verbose sed awk 'quoted text'
+2>/dev/null "$1" && printf done $(pwd) then printf && &&
+printf sed cd "$@" test
+printf $(pwd) sed $(pwd) "$1" 2>/dev/null
+local printf -eu done 2>/dev/null
+	test sed x=1 cd "$@" cd
+	"$@" printf printf $(pwd) echo printf ${HOME}
+	awk x=1 test cd then export readonly printf echo
+	done readonly test 2>/dev/null done -eu --verbose printf readonly test
+		readonly ${HOME} 'quoted text' "$@" $(pwd) readonly local && done readonly "$@"
+	&& -eu ${HOME} then "$1"
+2>/dev/null grep "$@" printf ${HOME}
+		"$1" 'quoted text' cd then
+	cd local grep -eu grep grep done printf ${HOME} /usr/bin then
+		then grep "$@" "$1" "$@" --verbose export test grep test test |
+$(pwd) cd cd awk ${HOME} ${HOME} echo && 'quoted text' -eu "$1" "$1" ${HOME}
+		awk x=1 && awk "$@" sed && | x=1 "$1" $(pwd) "$@" grep
+printf readonly printf 2>/dev/null 2>/dev/null printf
+"$1" done cd grep && && 'quoted text' "$@" 'quoted text' 2>/dev/null
+		${HOME} && export "$@" -eu export awk grep ${HOME} ${HOME} grep cd grep
+	done | done done awk done sed && ${HOME} test
+| grep ${HOME} "$@" | 2>/dev/null done && -eu && done && "$1"
+		local then cd done | printf grep readonly
+	test && "$@" ${HOME} "$@" test printf cd local local
+		"$@" then 2>/dev/null awk grep printf /usr/bin && local && awk -eu ${HOME} 'quoted text'
+	awk sed test 'quoted text' readonly done | readonly readonly 'quoted text'
+		--verbose -eu /usr/bin local printf -eu printf --verbose 'quoted text' echo readonly
+	awk 2>/dev/null $(pwd) readonly echo
+		test cd grep awk then done readonly -eu cd grep echo
+		test local awk printf done export sed -eu readonly echo
+		export x=1 "$@" export ${HOME} 'quoted text' -eu sed "$1" $(pwd) /usr/bin
+${HOME} x=1 sed awk $(pwd) export x=1 export "$1" sed && 2>/dev/null x=1 export
+local local printf then sed sed 'quoted text' 2>/dev/null
+		'quoted text' "$1" ${HOME} -eu sed awk
+done "$@" | && test local 2>/dev/null 2>/dev/null
+then readonly $(pwd) grep grep cd echo grep 2>/dev/null export -eu 'quoted text'
+		export /usr/bin test /usr/bin readonly local
+${HOME} && /usr/bin |
+	'quoted text' then x=1 awk
+| sed && done awk 'quoted text' "$@" printf echo then echo
+		--verbose --verbose grep then $(pwd) "$@" $(pwd) $(pwd)
+2>/dev/null ${HOME} export then /usr/bin $(pwd) echo
+	&& ${HOME} local printf
+		'quoted text' ${HOME} echo printf 2>/dev/null | readonly printf $(pwd) grep readonly
+	${HOME} printf --verbose
+&& readonly /usr/bin x=1 sed echo | awk --verbose "$1" | then 'quoted text'
+		cd /usr/bin grep awk cd awk ${HOME} echo
+	cd cd --verbose $(pwd) test ${HOME} x=1 x=1 sed /usr/bin -eu done cd test
+${HOME} readonly ${HOME} then sed readonly | export done | cd awk
+		${HOME} ${HOME} then /usr/bin awk local export readonly export | --verbose
+local $(pwd) 2>/dev/null 2>/dev/null
+	local readonly cd && grep sed
+$(pwd) grep then grep "$1" | done cd
+local cd awk 'quoted text' "$@" 'quoted text' sed
+	readonly sed export done export
+		"$@" /usr/bin local then sed "$1"
+		sed -eu -eu awk cd $(pwd) export echo
+	then --verbose x=1 test printf --verbose ${HOME}
+echo then sed $(pwd) 2>/dev/null -eu then cd export awk 2>/dev/null
+		"$1" echo done grep | echo 2>/dev/null
+| export printf test
+		cd cd | local then grep readonly awk "$1"
+	done awk cd 'quoted text' awk 2>/dev/null awk printf
+x=1 awk printf echo awk --verbose awk export done "$1" x=1 cd
+		test then /usr/bin local export local local cd
+		2>/dev/null grep /usr/bin grep local --verbose /usr/bin /usr/bin
+		"$1" awk --verbose done "$1" printf "$1" -eu awk export awk test "$@" /usr/bin
+	sed "$@" readonly test | /usr/bin
+		x=1 grep cd then $(pwd) cd /usr/bin awk "$@" /usr/bin cd printf printf /usr/bin
+	printf --verbose | $(pwd) awk done local done /usr/bin 'quoted text' 'quoted text'
+		$(pwd) test echo test local awk --verbose ${HOME} cd "$1" 2>/dev/null
+	/usr/bin then local cd sed --verbose ${HOME} "$1" 'quoted text'
+	"$1" done $(pwd) cd sed --verbose -eu 2>/dev/null
+	echo printf echo awk 'quoted text' echo -eu sed readonly "$@" test test grep
+	"$1" | 'quoted text' test | x=1 test ${HOME} grep 'quoted text' cd then
+		"$@" --verbose /usr/bin && --verbose "$@" 2>/dev/null readonly &&
+	${HOME} 2>/dev/null grep $(pwd)
+		${HOME} 2>/dev/null grep cd grep --verbose 2>/dev/null sed && 'quoted text'
+	--verbose cd 2>/dev/null echo sed cd $(pwd) cd -eu
+		printf | sed | test then
+local "$1" local awk test 2>/dev/null readonly done
+grep | then local echo 'quoted text' && printf $(pwd) awk printf sed 2>/dev/null
+	x=1 grep ${HOME} awk x=1 echo readonly then test "$1" 2>/dev/null --verbose
+'quoted text' sed printf 2>/dev/null && "$1" grep test awk grep echo
+"$1" printf | ${HOME} export 'quoted text' "$@" ${HOME} ${HOME} then cd grep "$@"
+	'quoted text' $(pwd) --verbose && && echo echo printf
+		${HOME} && printf "$@" "$1" export
+done export --verbose /usr/bin 'quoted text' cd --verbose "$1" 'quoted text'
+		done "$@" export local local printf done grep
+	"$@" readonly | -eu | local $(pwd) && $(pwd) -eu &&
+-eu grep cd && ${HOME} printf done printf
+printf cd grep sed printf
+		--verbose test grep cd echo 'quoted text' sed grep --verbose
+	"$@" && cd done export "$@" done -eu /usr/bin readonly
+	'quoted text' local then 2>/dev/null done done "$@" printf
+	readonly 'quoted text' /usr/bin "$@" readonly readonly ${HOME} "$1" --verbose
+	"$@" grep printf "$1" awk awk -eu readonly grep
+| awk "$1" 2>/dev/null then ${HOME} local
+		grep then ${HOME} 'quoted text' x=1 local cd echo $(pwd) cd --verbose done test
+${HOME} | test test x=1 'quoted text' echo done -eu 2>/dev/null --verbose
+/usr/bin then printf 'quoted text' "$@" sed --verbose then --verbose 2>/dev/null
+	done $(pwd) "$1" /usr/bin ${HOME} grep done
+		| export done 2>/dev/null export then readonly ${HOME} local local /usr/bin
+	local x=1 echo echo x=1 cd test 'quoted text' | "$1" readonly --verbose "$1" done
+readonly echo x=1 && grep $(pwd) ${HOME}
+		| x=1 -eu "$@" ${HOME} awk test echo 2>/dev/null $(pwd) readonly --verbose
+		readonly awk && local echo 2>/dev/null
+test /usr/bin --verbose echo export readonly
+grep -eu -eu done --verbose test then
+		--verbose done test then 'quoted text' x=1 ${HOME} export echo $(pwd) -eu
+		sed sed | readonly printf readonly done
+	/usr/bin && printf export local && /usr/bin ${HOME}
+grep export done /usr/bin awk then ${HOME} ${HOME} test -eu |
+"$@" export ${HOME} ${HOME} done test "$@" $(pwd) local /usr/bin
+	$(pwd) export x=1 "$1" export 2>/dev/null test x=1 ${HOME} | readonly sed export
+"$1" 2>/dev/null cd export grep readonly sed
+		"$@" printf echo $(pwd) grep | export done local printf ${HOME} done
+"$@" $(pwd) then $(pwd) sed -eu --verbose
+'quoted text' done printf readonly grep 2>/dev/null local ${HOME} test then
+	test --verbose "$@" $(pwd) grep | --verbose
+		2>/dev/null --verbose printf echo grep
+		then then local x=1 local | echo test export "$@" done
+/usr/bin | 'quoted text' sed
+	grep test grep sed grep /usr/bin x=1 echo ${HOME}
+		then awk sed "$@" $(pwd) 'quoted text' | cd ${HOME} $(pwd) -eu && -eu grep readonly
+awk test 'quoted text' export export 2>/dev/null 2>/dev/null local
+	2>/dev/null "$1" readonly 'quoted text' done then
+	cd 2>/dev/null --verbose
+	export cd $(pwd) 2>/dev/null -eu 'quoted text' awk "$1" "$@" done "$1" then
+	| ${HOME} -eu sed echo $(pwd)
+	--verbose awk "$@" done "$@" | printf local done
+	grep cd $(pwd) export grep
+		--verbose x=1 -eu --verbose | export
+		&& grep cd 'quoted text' -eu | | "$@" printf sed local cd | "$@" echo sed && $(pwd)
+readonly awk local && test "$1" | -eu readonly -eu cd | ${HOME}
+		| -eu local local local sed ${HOME}
+		cd local "$@" printf local -eu | x=1 echo printf readonly grep echo
+x=1 | echo && sed "$@" printf
+	x=1 local export test local then "$@" --verbose export --verbose
+"$1" 2>/dev/null printf grep grep export "$1" ${HOME} done
+	grep awk test grep test local "$1" local 'quoted text' /usr/bin done 'quoted text'
+2>/dev/null && "$@" -eu x=1 /usr/bin awk printf grep awk "$1" | /usr/bin
+		readonly "$1" grep -eu
+	grep /usr/bin local printf
+	${HOME} readonly readonly echo printf echo "$1" && sed "$1" && x=1 local 'quoted text'
+-eu && x=1 local done 'quoted text' export
+local awk cd done awk printf && 'quoted text' test &&
+	/usr/bin export test "$@"
+awk grep "$@" local $(pwd)
+then printf awk ${HOME} $(pwd) | "$1" -eu && && 2>/dev/null
+	"$@" /usr/bin test awk -eu 2>/dev/null x=1 local 2>/dev/null
+		awk "$@" cd /usr/bin sed cd echo grep cd x=1 -eu $(pwd) readonly export awk printf
+	sed 2>/dev/null awk && x=1 local
+--verbose /usr/bin ${HOME}
+${HOME} "$@" $(pwd) /usr/bin cd "$1" 2>/dev/null x=1 --verbose 'quoted text'
+printf 2>/dev/null && readonly sed x=1 ${HOME} --verbose
+		"$1" done cd cd test local
+		echo export sed --verbose
+		${HOME} echo "$1" /usr/bin /usr/bin done ${HOME} cd sed local printf then
+awk 'quoted text' readonly "$1" export awk "$1" $(pwd) grep 2>/dev/null
+-eu -eu cd sed $(pwd) sed ${HOME}
+		local -eu export local "$1" local printf readonly /usr/bin -eu
+readonly echo x=1 x=1 done echo 'quoted text' done -eu
+"$1" done readonly "$@" "$1"
+--verbose readonly && 'quoted text' x=1 awk done readonly
+cd | printf then --verbose readonly done local
+		$(pwd) ${HOME} test /usr/bin && export then 'quoted text'
+	| grep 2>/dev/null export export
+		&& x=1 done test test 'quoted text' grep awk
+	"$1" awk then grep readonly /usr/bin $(pwd) readonly
+then then /usr/bin "$1" cd | -eu | 2>/dev/null
+		"$@" sed $(pwd) readonly 2>/dev/null | x=1 /usr/bin
+		$(pwd) readonly then -eu 2>/dev/null sed | 'quoted text' readonly x=1
+	awk "$1" $(pwd) cd "$@" -eu cd 2>/dev/null "$@" $(pwd) x=1 ${HOME}
+		printf printf cd local 'quoted text' -eu printf done x=1 | done 'quoted text'
+	--verbose "$1" "$1" ${HOME} local /usr/bin 2>/dev/null then x=1 "$1"
+		local 2>/dev/null "$1"
+	/usr/bin test -eu | -eu --verbose
+printf "$1" $(pwd) $(pwd) grep then printf awk 2>/dev/null
+	2>/dev/null awk $(pwd) done sed printf done local cd && export "$1" grep $(pwd)
+	test x=1 -eu "$1" grep echo x=1 -eu local 'quoted text'
+	awk | $(pwd) done | echo done /usr/bin "$1" ${HOME} sed -eu echo
+		test 'quoted text' $(pwd) --verbose
+		echo readonly --verbose 2>/dev/null
+/usr/bin printf readonly then 2>/dev/null
+	"$@" readonly $(pwd) --verbose -eu && readonly | cd
+	then test readonly readonly "$@" ${HOME} local ${HOME} ${HOME} then
+"$1" && "$@" sed local 2>/dev/null 'quoted text'
+local export export printf printf
+	echo "$1" x=1 local printf $(pwd) "$1"
+		done grep -eu $(pwd) ${HOME} sed "$1" sed readonly readonly 'quoted text'
+		$(pwd) /usr/bin "$@" export sed grep | ${HOME} "$@" printf "$@" 'quoted text'
+local -eu --verbose cd --verbose cd ${HOME} echo export
+		done test && "$1" grep local local "$@" | test /usr/bin readonly
+		/usr/bin && grep "$@" 2>/dev/null
+		&& test -eu x=1 grep -eu 2>/dev/null
+	$(pwd) x=1 x=1 "$@" | grep awk done
+		| "$@" awk x=1 ${HOME} x=1 export --verbose
+		awk awk | export "$@" sed ${HOME} sed awk
+		printf sed done printf ${HOME} readonly awk awk
+		"$@" printf 'quoted text' -eu grep sed | ${HOME}
+	local local -eu --verbose ${HOME} ${HOME} echo then grep --verbose
+		cd ${HOME} export cd x=1 then "$@" sed grep
+	2>/dev/null -eu sed "$@" --verbose 'quoted text'
+	local -eu $(pwd) printf "$@" readonly awk "$@" done x=1 'quoted text' 2>/dev/null
+		x=1 --verbose readonly ${HOME} echo export done printf
+	x=1 $(pwd) awk sed then
+	--verbose "$1" ${HOME} 'quoted text' export then echo
+	test -eu ${HOME} x=1 export | test x=1
+/usr/bin --verbose x=1 then "$@" --verbose 2>/dev/null -eu 2>/dev/null sed "$1"
+	echo && done $(pwd) $(pwd)
+"$@" then /usr/bin done grep | ${HOME} 'quoted text'
+	awk ${HOME} then $(pwd) 2>/dev/null "$1" $(pwd) "$@" 'quoted text'
+		/usr/bin --verbose awk "$1" readonly export && grep readonly done grep
+		x=1 x=1 sed "$1" sed done test /usr/bin local ${HOME}
+	printf grep awk 2>/dev/null
+		--verbose then then x=1 "$@" $(pwd) test -eu test "$@"
+&& test awk printf --verbose 'quoted text' "$@" /usr/bin
+2>/dev/null grep awk readonly /usr/bin
+		cd ${HOME} --verbose 2>/dev/null && | sed local
+grep echo ${HOME} grep then && printf --verbose
+-eu awk sed cd export sed
+	-eu printf printf export local /usr/bin "$@" && | printf test
+		done /usr/bin sed awk "$1" echo awk ${HOME}
+	${HOME} | /usr/bin | "$@" "$1" export
+		/usr/bin local ${HOME} sed
+		/usr/bin ${HOME} $(pwd) -eu then echo grep "$1" echo readonly cd ${HOME} | sed
+echo awk "$1" done "$@" echo
+	"$1" x=1 /usr/bin then sed readonly printf export export --verbose readonly awk
+/usr/bin then 2>/dev/null "$@" awk grep $(pwd) printf $(pwd)
+		--verbose readonly cd done && echo awk local
+		"$@" | $(pwd) sed | grep awk $(pwd) | | && export && test /usr/bin grep &&
+--verbose cd sed "$1" | "$1" 2>/dev/null test 'quoted text' then -eu readonly
+	2>/dev/null done | 2>/dev/null export
+test echo /usr/bin test export local -eu $(pwd) readonly | --verbose readonly export
+grep -eu 'quoted text' test
+x=1 "$@" printf && cd then x=1
+2>/dev/null 2>/dev/null
+	${HOME} cd | 2>/dev/null "$1" && $(pwd) test readonly local -eu /usr/bin grep
+		&& echo $(pwd) awk grep 'quoted text'
+		| printf then echo x=1 echo export $(pwd) readonly sed printf | 2>/dev/null
+	cd cd && grep $(pwd) 2>/dev/null -eu /usr/bin echo 2>/dev/null sed
+then --verbose $(pwd) 'quoted text' --verbose "$1" "$1"
+"$1" $(pwd) printf printf 2>/dev/null
+		x=1 x=1 test export then 'quoted text' ${HOME} | | then done local "$@"
+"$@" grep x=1 test && printf printf "$@" -eu
+	-eu ${HOME} $(pwd) readonly then "$@" | then done
+	then "$1" x=1 && grep --verbose 2>/dev/null sed
+	2>/dev/null then awk "$1" grep $(pwd) 'quoted text' readonly 'quoted text'
+done grep x=1 awk printf ${HOME} /usr/bin $(pwd) grep "$@" && echo awk
+done $(pwd) local $(pwd) grep "$@" echo && "$@" echo && done local
+		grep -eu printf test 2>/dev/null
+export $(pwd) 'quoted text' local grep && sed
+		local ${HOME} /usr/bin printf cd local
+printf -eu /usr/bin | 'quoted text' 'quoted text'
+test x=1 export 2>/dev/null then readonly /usr/bin
+		test "$1" "$@" x=1 printf "$@" 'quoted text' echo | /usr/bin 'quoted text'
+	/usr/bin && 2>/dev/null 'quoted text' "$@" $(pwd)
+x=1 awk x=1 local $(pwd) $(pwd) test echo "$1" export -eu $(pwd)
+	/usr/bin /usr/bin x=1 "$1" "$@" printf export readonly cd -eu 2>/dev/null
+		echo /usr/bin sed sed ${HOME} -eu readonly awk --verbose grep printf --verbose
+echo local -eu awk grep 'quoted text' "$@" "$@" ${HOME} printf $(pwd) 2>/dev/null
+	cd echo && "$@" $(pwd) readonly && /usr/bin test "$@" 'quoted text'
+	--verbose /usr/bin $(pwd) echo $(pwd) -eu 2>/dev/null $(pwd) cd readonly
+	&& test export /usr/bin test 'quoted text' sed sed x=1 sed printf
+	/usr/bin "$1" | && then $(pwd) "$1" readonly export grep
+	printf sed export 2>/dev/null local readonly /usr/bin
+grep test "$@" echo "$1" awk sed test 'quoted text' --verbose | then grep
+		test | awk readonly --verbose x=1 then 'quoted text' -eu /usr/bin done export
+	"$1" local --verbose
+	grep 2>/dev/null /usr/bin sed --verbose 'quoted text' then then x=1 grep $(pwd)
+	x=1 local local 2>/dev/null export 'quoted text' awk "$@" awk
+		local 2>/dev/null 2>/dev/null awk test local done
+	echo "$1" -eu awk | done printf $(pwd)
+	then awk local | $(pwd) cd done 2>/dev/null
+		| export "$@" done awk awk /usr/bin grep local
+| echo done awk awk export -eu "$1"
+| 2>/dev/null cd done "$@"
+		echo done --verbose && -eu /usr/bin local
+--verbose export --verbose readonly
+	export ${HOME} /usr/bin x=1 awk readonly
+	printf done echo 2>/dev/null x=1 /usr/bin 'quoted text'
+		sed test test 2>/dev/null 'quoted text' export then cd x=1 --verbose
+"$@" awk cd grep readonly then test printf test $(pwd) printf
+then "$@" && x=1 export grep | local export $(pwd) echo readonly echo --verbose
+	sed readonly --verbose $(pwd) /usr/bin "$1" 2>/dev/null -eu sed
+		then done && $(pwd) $(pwd) $(pwd) 2>/dev/null export
+	grep $(pwd) --verbose | echo awk cd cd grep
+awk | "$@" | done done test cd
+	-eu readonly | && $(pwd) cd test export x=1 /usr/bin && export
+	grep $(pwd) done echo readonly 2>/dev/null local 2>/dev/null "$@" test cd
+"$1" local export awk local sed then --verbose printf awk printf
+		| -eu grep "$1" sed export -eu awk -eu ${HOME} done 'quoted text'
+$(pwd) cd -eu done local x=1 'quoted text' /usr/bin | 'quoted text'
+/usr/bin | /usr/bin sed sed printf --verbose ${HOME} $(pwd) readonly readonly
+		| printf awk done "$@" awk awk | test -eu "$@" then -eu /usr/bin && readonly
+	| test grep readonly readonly ${HOME} grep echo && "$@" --verbose
+		'quoted text' cd grep "$@" then readonly cd printf test /usr/bin
+echo $(pwd) readonly sed 'quoted text' -eu ${HOME} "$@"
+$(pwd) cd test /usr/bin ${HOME}
+x=1 "$1" && "$1" awk cd x=1 $(pwd) printf grep -eu "$@" "$@" --verbose -eu "$1"
+&& sed x=1 -eu local grep awk $(pwd) ${HOME} "$1" $(pwd)
+	'quoted text' sed export cd
+export "$1" --verbose export "$@" cd cd printf
+	test ${HOME} local && /usr/bin
+		export export grep --verbose "$1" ${HOME} /usr/bin
+		test /usr/bin done 2>/dev/null
+	${HOME} readonly ${HOME} "$@" "$@" --verbose readonly echo ${HOME}
+'quoted text' 2>/dev/null test x=1 grep test export awk /usr/bin
+-eu "$1" $(pwd) printf done local $(pwd) printf done awk ${HOME} sed sed
+	| awk && test cd /usr/bin local 'quoted text'
+	export export 'quoted text' ${HOME} echo local echo
+	cd then test export | ${HOME}
+	$(pwd) local 2>/dev/null 'quoted text' done "$1" $(pwd) && ${HOME} done sed cd echo
+"$@" printf printf sed 2>/dev/null grep "$@" x=1 "$1" local
+export cd "$1" $(pwd) 'quoted text' x=1 'quoted text'
+		then printf ${HOME} printf printf $(pwd) ${HOME}
+	printf 2>/dev/null | grep
+	'quoted text' && done test echo done done 2>/dev/null local local
+	done readonly done local /usr/bin && then --verbose "$1" 2>/dev/null --verbose
+		printf local sed && -eu $(pwd)
+		cd done && export echo | test done --verbose export printf x=1 "$1"
+	'quoted text' ${HOME} -eu readonly -eu 'quoted text' awk /usr/bin x=1 echo printf
+'quoted text' grep ${HOME} export /usr/bin
+		"$1" | cd readonly x=1 readonly && $(pwd) --verbose 'quoted text' x=1 | /usr/bin
+	local 2>/dev/null export -eu ${HOME} local sed test sed echo
+	--verbose awk 2>/dev/null test echo
+2>/dev/null 'quoted text' local done test
+	printf x=1 readonly export
+| printf local then "$@" export sed awk /usr/bin sed grep | --verbose
+	'quoted text' grep -eu test "$@"
+		cd -eu grep $(pwd) export
+	echo then | awk -eu | sed
+${HOME} readonly awk --verbose export "$@" echo grep export then test
+		printf /usr/bin echo 2>/dev/null 2>/dev/null
+	cd 'quoted text' test local printf local -eu &&
+printf test local then "$1" | done cd -eu $(pwd) grep then readonly done -eu |
+echo local --verbose --verbose $(pwd)
+	| sed "$1" 'quoted text' --verbose
+	awk test test $(pwd) -eu done ${HOME} ${HOME} echo echo "$@" then
+	awk /usr/bin test grep awk $(pwd) /usr/bin $(pwd) cd then echo /usr/bin then
+&& cd --verbose awk export sed x=1 $(pwd) $(pwd) readonly cd grep readonly $(pwd)
+	cd /usr/bin done readonly echo --verbose grep
+/usr/bin ${HOME} cd local "$@" "$1" | awk x=1 awk
+	'quoted text' | 'quoted text'
+done done --verbose --verbose 'quoted text' local
+	&& --verbose printf --verbose grep then --verbose 'quoted text' x=1 export
+		$(pwd) "$1" /usr/bin then sed then test x=1 readonly
+		--verbose /usr/bin echo done ${HOME} readonly echo ${HOME} -eu local
+	done readonly && local cd --verbose ${HOME} | cd then test x=1 "$@" export
+${HOME} cd -eu && "$1" test readonly awk --verbose "$@" local 'quoted text' then
+		printf $(pwd) test sed -eu "$@" grep awk sed --verbose
+		then "$@" awk $(pwd) | x=1 "$1" local done "$1" test
+	awk | sed "$@" -eu $(pwd)
+		cd x=1 $(pwd) echo test /usr/bin printf -eu grep
+	then x=1 local grep done
+		"$@" echo && sed && sed "$1"
+		&& "$1" "$@" ${HOME} x=1 $(pwd)
+		then 'quoted text' ${HOME} then -eu
+		export cd test 'quoted text' awk printf export ${HOME} $(pwd) |
+		done export local readonly $(pwd) $(pwd) cd printf 'quoted text'
+	x=1 local sed && 'quoted text' awk $(pwd) "$1" x=1 done 2>/dev/null done /usr/bin
+	${HOME} "$1" echo readonly echo && 2>/dev/null -eu local local
+	$(pwd) test printf $(pwd) && 'quoted text' export x=1 readonly
+'quoted text' && --verbose
+		cd | local 'quoted text' cd "$1" x=1 then "$@" &&
+grep awk printf "$1" readonly
+printf ${HOME} "$1" $(pwd) && ${HOME} /usr/bin && "$1" "$@" sed
+	${HOME} then printf 2>/dev/null x=1 && ${HOME}
+		/usr/bin $(pwd) --verbose "$1" $(pwd) "$1" printf then
+		$(pwd) --verbose "$@" export "$1" printf /usr/bin
+$(pwd) test then -eu ${HOME}
+	printf x=1 sed grep -eu grep /usr/bin printf
+	then 2>/dev/null "$1" "$@" -eu cd grep readonly sed "$1" local
+		| | /usr/bin --verbose | readonly x=1 "$1" awk
+	/usr/bin sed echo "$@" readonly test
+		awk grep cd cd cd cd 2>/dev/null
+local echo | && 'quoted text' cd ${HOME} ${HOME} local "$@" "$@"
+	"$@" x=1 2>/dev/null | echo then
+| && done cd && sed -eu --verbose sed cd grep export | --verbose 2>/dev/null
+echo echo -eu | awk "$1" local then $(pwd)
+--verbose "$@" readonly && &&
+	echo printf printf $(pwd) ${HOME} grep local 2>/dev/null sed
+		then --verbose 2>/dev/null sed
+	done done readonly printf && then $(pwd) 'quoted text'
+		-eu | readonly done cd --verbose
+		readonly echo echo cd cd echo export
+		'quoted text' awk "$@" /usr/bin /usr/bin printf "$@" cd -eu
+		$(pwd) readonly readonly -eu x=1 $(pwd) cd echo "$@"
+"$@" && local 'quoted text' sed /usr/bin
+	x=1 printf /usr/bin printf x=1 awk export echo echo
+test 'quoted text' readonly
+		printf readonly "$1" -eu test -eu "$1" echo 2>/dev/null
+	$(pwd) -eu ${HOME} /usr/bin grep
+		grep sed grep --verbose x=1 done $(pwd) export $(pwd) printf /usr/bin 'quoted text'
+/usr/bin readonly test && test "$@" x=1 x=1 cd
+	-eu readonly then cd local
+	-eu echo "$@" echo ${HOME} ${HOME}
+		| 2>/dev/null cd test done grep 2>/dev/null $(pwd) local sed echo
+		$(pwd) local 2>/dev/null
+		$(pwd) done awk printf
+	-eu then then sed "$@" awk ${HOME} sed -eu
+		grep -eu then awk && awk export readonly -eu -eu
+local local then --verbose --verbose
+	export -eu --verbose 'quoted text' echo 2>/dev/null then cd 2>/dev/null done test
+		x=1 /usr/bin 2>/dev/null printf printf grep
+	then export test done ${HOME} sed 2>/dev/null
+		${HOME} && && && && export awk cd 2>/dev/null --verbose /usr/bin
+'quoted text' ${HOME}
+	awk && 'quoted text' readonly && then -eu then --verbose
+		-eu printf echo -eu grep grep "$1" 'quoted text' grep export done
+	done awk --verbose then "$1" done readonly done | printf done
+		| then --verbose ${HOME} awk readonly "$@" 'quoted text' test
+/usr/bin && printf $(pwd)
+'quoted text' ${HOME} readonly ${HOME} "$1"
+	echo sed awk readonly ${HOME}
+		grep /usr/bin -eu --verbose printf
+		2>/dev/null | -eu ${HOME} local then $(pwd) awk done local ${HOME} done sed
+	readonly awk done /usr/bin printf && readonly $(pwd) 'quoted text'
+		-eu local --verbose done --verbose 'quoted text'
+	export x=1 cd printf then "$@" && "$1" printf $(pwd) | readonly readonly then
+&& x=1 x=1 -eu --verbose "$1" cd x=1 $(pwd) test --verbose
+		| --verbose export export sed "$1" sed awk --verbose
+	"$@" "$@" sed sed --verbose export cd ${HOME} grep
+	test /usr/bin "$1" --verbose x=1 awk /usr/bin
+test cd export grep $(pwd) export --verbose 'quoted text'
+| readonly --verbose grep | echo "$1" && readonly x=1 -eu done then
+	'quoted text' echo -eu --verbose readonly 'quoted text' awk grep then cd
+	printf sed local cd 'quoted text' "$1" && then -eu --verbose -eu 'quoted text' ${HOME}
+	cd 'quoted text' test ${HOME} then 2>/dev/null
+		&& grep --verbose /usr/bin then && then 'quoted text'
+	${HOME} then then awk echo test --verbose test 2>/dev/null readonly awk
+&& echo sed readonly --verbose | x=1 awk 'quoted text' sed --verbose then
+	cd /usr/bin local -eu test /usr/bin grep export printf sed "$@" --verbose
+	2>/dev/null ${HOME} 2>/dev/null
+		export "$1" done 'quoted text' $(pwd) local ${HOME} grep x=1 done grep
+cd --verbose $(pwd) sed "$1" grep -eu done echo readonly
+then done /usr/bin 'quoted text' "$1" $(pwd)
+printf /usr/bin "$1" cd cd ${HOME} $(pwd) ${HOME} "$@" test echo
+grep --verbose readonly | /usr/bin
+		local "$1" test cd then /usr/bin "$1" then -eu x=1 $(pwd) local export readonly
+		2>/dev/null export grep local 2>/dev/null test echo printf done grep then printf
+${HOME} printf echo echo
+		2>/dev/null readonly /usr/bin test | cd echo $(pwd) -eu && readonly 2>/dev/null
+-eu /usr/bin then x=1 printf
+		x=1 done /usr/bin readonly --verbose /usr/bin 'quoted text' /usr/bin
+readonly awk sed sed 'quoted text' $(pwd) echo local printf
+$(pwd) grep echo test | "$@" done awk done x=1 "$1" && --verbose export then /usr/bin
+	done x=1 2>/dev/null x=1 test sed sed x=1 && grep grep 2>/dev/null echo
+	/usr/bin test | done "$1" --verbose "$1" /usr/bin
+		| | 2>/dev/null $(pwd) "$1" cd "$@" "$@" cd test | echo
+		awk cd $(pwd) 2>/dev/null local done $(pwd)
+"$@" -eu -eu then readonly 'quoted text' | local "$@"
+	| test x=1 awk done grep -eu sed cd && echo cd local
+local export sed awk export -eu echo readonly && then 'quoted text'
+		| && 'quoted text' --verbose cd "$@" | | done test printf
+readonly printf readonly printf x=1 then local test x=1 export 'quoted text'
+		grep 'quoted text' 'quoted text' grep -eu | readonly export 2>/dev/null
+--verbose 2>/dev/null done echo grep 'quoted text' | x=1 printf | --verbose readonly
+/usr/bin done "$@" readonly /usr/bin
+echo grep /usr/bin awk && -eu printf && then readonly --verbose --verbose
+--verbose "$1" awk "$@" x=1 readonly && readonly x=1 grep cd
+		--verbose x=1 $(pwd) sed "$1" $(pwd) | awk done /usr/bin then "$1"
+		printf /usr/bin printf x=1 /usr/bin | --verbose printf grep then
+		readonly 'quoted text' ${HOME} /usr/bin 2>/dev/null ${HOME} then "$@" local
+$(pwd) test x=1 "$@" -eu
+&& then x=1 sed awk --verbose x=1
+		2>/dev/null grep ${HOME} "$1" readonly x=1 done /usr/bin sed
+	sed sed x=1 && readonly sed echo
+export printf grep readonly --verbose grep "$1" && "$@" printf local sed
+	$(pwd) 'quoted text' 2>/dev/null
+-eu echo done ${HOME} export
+		/usr/bin "$1" grep -eu "$1" cd 2>/dev/null
+	x=1 then test cd local -eu "$@" readonly
+		grep 'quoted text' printf /usr/bin x=1 local
+printf done "$1" export cd /usr/bin awk export printf sed --verbose 2>/dev/null
+		-eu /usr/bin then x=1 export grep
+done cd cd then echo --verbose awk
+	'quoted text' "$@" printf test "$1"
+	"$1" awk grep $(pwd) readonly
+"$@" 2>/dev/null test
+'quoted text' test 'quoted text'
+		"$@" "$@" 2>/dev/null x=1 cd "$@" test "$1" --verbose readonly
+		-eu done done test "$@" export sed | 2>/dev/null
+	"$1" local echo test --verbose then export $(pwd) ${HOME} && test "$@" | readonly
+	local /usr/bin done --verbose "$1" sed awk done sed x=1 readonly
+"$@" && export then -eu ${HOME} sed ${HOME} echo ${HOME}
+grep test && awk | --verbose printf grep sed | readonly
+	test ${HOME} x=1 sed printf --verbose echo 'quoted text' --verbose
+		test cd /usr/bin grep 2>/dev/null awk export "$@" --verbose ${HOME} "$@" cd --verbose
+readonly | 'quoted text' then $(pwd) && awk echo cd | done $(pwd) cd "$@"
+	done x=1 echo | grep ${HOME} grep $(pwd)
+"$1" cd cd cd && sed | then local then -eu "$@" /usr/bin 2>/dev/null then
+	readonly grep 'quoted text' awk sed /usr/bin $(pwd)
+	"$1" x=1 then test test &&
+	echo 'quoted text' then $(pwd) 2>/dev/null sed /usr/bin awk then done &&
+	test cd local && --verbose --verbose then done "$1" && 2>/dev/null
+		done readonly sed $(pwd) sed /usr/bin done readonly -eu
+	cd && then echo /usr/bin
+awk x=1 awk "$1" "$@" cd done grep local 2>/dev/null awk /usr/bin 'quoted text'
+		--verbose echo | 2>/dev/null sed 'quoted text' && --verbose
+		/usr/bin done ${HOME} ${HOME} echo -eu | | printf done
+	done 2>/dev/null $(pwd) export ${HOME} --verbose x=1 grep
+		/usr/bin 2>/dev/null then awk /usr/bin x=1 local "$@" export
+/usr/bin ${HOME} x=1 test export "$@" done then grep "$@" then $(pwd) printf
+	sed awk awk local -eu echo "$1" $(pwd)
+x=1 2>/dev/null "$1" | 'quoted text' /usr/bin echo
+| ${HOME} echo x=1 'quoted text' | sed --verbose sed
+printf -eu 'quoted text' done $(pwd) "$@"
+	export --verbose awk grep -eu --verbose 'quoted text' awk && "$1"
+	printf sed /usr/bin x=1 readonly local cd "$@" echo
+		/usr/bin "$1" test ${HOME} 'quoted text' ${HOME}
+	2>/dev/null "$1" -eu echo $(pwd) "$1" cd awk
+		"$@" && readonly && readonly --verbose test -eu -eu then 'quoted text'
+$(pwd) grep sed && ${HOME} sed --verbose grep
+--verbose /usr/bin printf local local echo done readonly local
+then 'quoted text' awk local /usr/bin sed 2>/dev/null export printf
+printf "$1" test && $(pwd) /usr/bin --verbose
+		/usr/bin local sed "$@" readonly && printf cd ${HOME}
+	2>/dev/null sed && readonly export then
+export readonly awk grep local sed readonly --verbose
+cd --verbose && printf ${HOME} "$1" "$@" done
+		local "$@" test echo --verbose -eu test test
+	--verbose && | 2>/dev/null test printf 2>/dev/null readonly awk test grep printf
+		then export sed export test --verbose printf "$1" sed test sed
+readonly "$1" $(pwd) printf ${HOME}
+"$@" && $(pwd) x=1 readonly sed cd export /usr/bin
+${HOME} done -eu $(pwd) grep echo x=1 test local local /usr/bin 2>/dev/null
+export grep local local ${HOME} ${HOME} --verbose export grep "$@"
+'quoted text' "$@" awk -eu sed
+--verbose -eu done "$1" then -eu local --verbose sed 2>/dev/null cd $(pwd)
+		then --verbose grep cd readonly x=1 sed "$@" /usr/bin $(pwd) local 'quoted text'
+	test /usr/bin sed --verbose
+		awk sed export x=1 awk then local cd && | | sed awk
+		then test readonly awk
+	echo 2>/dev/null && awk sed readonly test echo -eu "$@" export sed echo
+		then sed printf 'quoted text' --verbose local -eu "$@" cd $(pwd) printf --verbose
+		readonly sed printf sed awk -eu | cd sed
+	export awk 'quoted text' echo -eu cd "$@" awk export -eu test
+printf ${HOME} echo 2>/dev/null done
+		/usr/bin 'quoted text' grep awk test x=1 x=1 echo
+	echo --verbose grep readonly grep echo awk $(pwd) /usr/bin printf
+	grep --verbose | "$1" 2>/dev/null cd
+grep printf echo --verbose then
+		$(pwd) awk 'quoted text' readonly x=1 /usr/bin
+		/usr/bin done /usr/bin ${HOME} x=1 local echo test local x=1 export cd 2>/dev/null
+done test --verbose cd grep done "$1" export && then test sed
+printf local --verbose sed awk -eu
+		then $(pwd) "$1" ${HOME}
+"$1" then local echo grep -eu then x=1
+	echo sed | -eu printf printf ${HOME} awk "$1" && readonly 2>/dev/null /usr/bin
+export printf $(pwd) done awk "$1" done local then then
+&& ${HOME} --verbose readonly 'quoted text' awk then "$@" | &&
+awk && export local echo $(pwd) "$1" done
+		x=1 export $(pwd) cd sed grep
+	echo && readonly && "$@" | x=1 printf 'quoted text' grep cd echo done /usr/bin
+		test x=1 export cd done export echo -eu x=1 x=1 test local
+		-eu grep $(pwd) export sed done --verbose readonly
+	2>/dev/null "$@" 'quoted text' ${HOME}
+	awk /usr/bin grep && printf
+		printf test echo | sed "$1" cd awk cd | | echo sed awk ${HOME}
+		2>/dev/null export local awk export echo local /usr/bin export ${HOME} /usr/bin
+		sed x=1 sed -eu 'quoted text' export
+echo -eu "$1" && echo then
+local then -eu readonly test -eu ${HOME} ${HOME} "$1" then ${HOME} readonly
+		echo awk test cd --verbose --verbose echo &&
+	"$@" 'quoted text' "$1" --verbose /usr/bin cd done x=1 awk 'quoted text'
+cd cd export | | readonly done export local && done $(pwd) cd local
+		done echo --verbose 2>/dev/null
+	-eu awk ${HOME} --verbose "$@" local awk $(pwd) local readonly local
+	local "$@" export test --verbose
+grep -eu /usr/bin local local ${HOME} readonly printf
+--verbose readonly --verbose test echo x=1 printf && done 2>/dev/null ${HOME}
+	"$@" printf x=1 x=1 grep && test echo /usr/bin test
+		export $(pwd) awk && cd "$1"
+local 'quoted text' /usr/bin readonly x=1 echo local
+| awk --verbose awk export sed sed 2>/dev/null | then echo "$1" 'quoted text' printf
+grep x=1 done ${HOME} x=1 "$1" then 2>/dev/null
+	then 2>/dev/null grep cd done readonly then ${HOME} done
+	$(pwd) grep -eu sed done local cd readonly
+export export ${HOME} echo awk ${HOME} x=1 awk "$1" $(pwd) done done
+	${HOME} cd sed | "$1" -eu
+		${HOME} then "$@" then cd "$@" "$1" printf x=1 done export
+		$(pwd) export /usr/bin local
+	echo done local awk | export grep
+		"$1" done then 'quoted text' local --verbose test export -eu "$@" | export test
+| echo "$@" sed "$@" export /usr/bin "$1" test x=1 'quoted text' local &&
+grep readonly | 2>/dev/null
+	done readonly x=1 export | /usr/bin printf done printf echo --verbose
+		sed done done echo 'quoted text' x=1 echo "$1" ${HOME} grep | done
+		${HOME} /usr/bin x=1 x=1 /usr/bin cd --verbose printf printf cd
+		done export 'quoted text' $(pwd)
+then 'quoted text' test then grep -eu sed then readonly 'quoted text'
+		test "$@" | /usr/bin awk echo readonly awk sed
+	&& 2>/dev/null done test cd done
+export cd 2>/dev/null cd echo local local cd "$@" x=1 ${HOME} grep
+'quoted text' ${HOME} 'quoted text' "$@" $(pwd) "$1" --verbose $(pwd)
+	echo readonly then "$@" readonly && done cd readonly awk
+	x=1 export "$@" cd ${HOME} /usr/bin then "$@" "$@" "$@" printf --verbose
+	grep grep 2>/dev/null -eu printf sed awk ${HOME} /usr/bin
+		| echo test | 2>/dev/null then sed 'quoted text'
+2>/dev/null then local printf done printf x=1 -eu readonly | cd
+		then test export then test local -eu -eu cd then awk echo | --verbose "$@" readonly
+	local then -eu 'quoted text' $(pwd) | done cd
+		x=1 awk local ${HOME} --verbose then 'quoted text' export
+	| /usr/bin awk sed --verbose 2>/dev/null printf readonly "$@"
+--verbose local grep cd $(pwd) ${HOME}
+	&& readonly 2>/dev/null printf ${HOME} sed done then echo | 'quoted text'
+| 'quoted text' sed ${HOME} --verbose
+grep ${HOME} && sed echo awk -eu awk cd --verbose test
+local ${HOME} /usr/bin | | printf grep | && 'quoted text' --verbose
+		readonly 'quoted text' $(pwd) "$@" echo sed && awk awk done
+	--verbose sed local awk ${HOME} ${HOME} awk echo 'quoted text' $(pwd)
+'quoted text' printf then --verbose export sed done x=1
+2>/dev/null readonly --verbose done awk $(pwd) cd
+		then local export done 2>/dev/null
+"$@" "$1" -eu --verbose done grep ${HOME} /usr/bin cd 2>/dev/null
+		readonly "$@" echo 2>/dev/null test sed 2>/dev/null $(pwd)
+		/usr/bin done awk -eu printf -eu 2>/dev/null "$1" "$1"
+	/usr/bin ${HOME} 2>/dev/null --verbose
+		test local /usr/bin local awk
+		2>/dev/null /usr/bin readonly done test ${HOME} awk "$@" ${HOME}
+	readonly then awk && ${HOME} test --verbose "$1" awk "$1" cd sed /usr/bin
+	'quoted text' readonly | sed
+		${HOME} --verbose done local printf | --verbose /usr/bin awk then &&
+	then ${HOME} sed grep 'quoted text' local then test /usr/bin 2>/dev/null
+		x=1 ${HOME} 'quoted text' done 'quoted text' -eu awk --verbose
+		printf 'quoted text' $(pwd) 'quoted text' readonly grep done --verbose grep
+--verbose x=1 echo "$1" readonly "$1" readonly | grep cd | cd test
+	${HOME} "$@" /usr/bin printf
+		echo readonly local 'quoted text' test readonly local
+	export export echo then
+		$(pwd) test && /usr/bin sed awk $(pwd) x=1 'quoted text'
+	export "$@" 2>/dev/null 2>/dev/null sed x=1 echo --verbose x=1
+		then 'quoted text' | 'quoted text'
+"$1" $(pwd) test "$@" --verbose /usr/bin awk "$@" local done
+	local test 2>/dev/null
+'quoted text' -eu printf test 2>/dev/null ${HOME} grep local local $(pwd) readonly
+	x=1 cd $(pwd) $(pwd) then readonly
+	printf sed then "$@" "$@" local
+	&& sed local printf grep export
+	/usr/bin /usr/bin echo grep printf -eu && cd "$1" local && done grep $(pwd) /usr/bin
+	done awk ${HOME} grep readonly printf "$1" awk "$1" $(pwd) -eu echo done printf
+		x=1 export export test grep sed "$1" local $(pwd)
+		--verbose 'quoted text' "$@" x=1 export printf printf awk "$1" readonly
+'quoted text' echo /usr/bin /usr/bin grep --verbose | && && done awk
+	&& --verbose "$@" local local "$1" export echo
+		then "$1" ${HOME} grep cd readonly then done "$@" cd awk && echo cd x=1 /usr/bin
+	grep cd "$@" done ${HOME} readonly awk then /usr/bin 'quoted text'
+		${HOME} "$1" "$@" then x=1 echo
+awk $(pwd) -eu --verbose | "$1" grep $(pwd)
+		cd test "$@" "$1" done -eu test && && local cd done --verbose readonly
+		done then /usr/bin x=1 && -eu | test echo cd test 'quoted text' $(pwd)
+then grep awk --verbose printf 'quoted text' export printf && printf && export
+2>/dev/null awk echo /usr/bin export
+		cd | "$1" 2>/dev/null ${HOME} x=1 printf && "$@" then -eu ${HOME} then | grep
+		/usr/bin 'quoted text' then sed awk -eu $(pwd) done 2>/dev/null
+	awk --verbose sed grep /usr/bin awk test readonly && grep test 2>/dev/null
+grep awk --verbose |
+		cd ${HOME} "$1" local done && -eu /usr/bin then awk --verbose
+&& 'quoted text' $(pwd) echo 2>/dev/null
+	then done "$@" local
+	| cd --verbose sed test /usr/bin cd /usr/bin test test
+		"$1" sed export $(pwd) ${HOME} done
+	/usr/bin -eu readonly /usr/bin
+$(pwd) 2>/dev/null echo readonly
+		'quoted text' | && /usr/bin 'quoted text'
+	"$@" 'quoted text' "$1" 'quoted text' ${HOME} sed $(pwd) && ${HOME} /usr/bin
+		echo echo cd "$@" local grep cd awk printf awk
+	/usr/bin done done local echo awk cd --verbose
+		then $(pwd) 2>/dev/null awk local ${HOME} local --verbose test test local
+		readonly -eu grep -eu
+		awk 2>/dev/null --verbose readonly local
+	done "$1" test $(pwd) sed printf 'quoted text' /usr/bin then /usr/bin
+awk ${HOME} test --verbose done printf export sed cd test 2>/dev/null
+		$(pwd) test sed echo echo
+--verbose printf 'quoted text' "$@" then --verbose | 'quoted text' $(pwd) cd grep
+	done then ${HOME} echo cd ${HOME} sed "$1" readonly printf $(pwd) && then | 2>/dev/null
+	cd 2>/dev/null local "$1" awk readonly
+	export export export | local --verbose local -eu 2>/dev/null && && $(pwd) "$@" printf
+		local echo echo local cd x=1
+&& echo test 2>/dev/null "$1" export | --verbose "$1"
+awk echo | test -eu "$1" cd "$1"
+	grep /usr/bin --verbose export done sed echo "$@" /usr/bin $(pwd) local && readonly
+x=1 grep awk grep sed 'quoted text' | grep sed
+	then echo 2>/dev/null
+"$@" awk 'quoted text' $(pwd) echo ${HOME} readonly cd then 'quoted text'
+	echo "$1" export x=1 2>/dev/null "$1" --verbose
+x=1 ${HOME} test $(pwd) | -eu
+sed 'quoted text' | echo grep
+done /usr/bin "$1" --verbose
+then printf $(pwd) export test "$1" x=1 echo && test
+		printf --verbose printf x=1
+	local then 2>/dev/null ${HOME} readonly
+	cd 2>/dev/null cd "$@" 2>/dev/null
+		/usr/bin echo then ${HOME} printf | "$@" export ${HOME} test then test
+	local sed local $(pwd) export $(pwd) $(pwd) ${HOME} cd x=1
+		echo $(pwd) | done then awk && awk awk awk sed then local export
+		"$@" ${HOME} x=1 x=1 local -eu export /usr/bin sed 'quoted text'
+	/usr/bin --verbose done
+grep grep readonly echo test $(pwd) && sed printf 'quoted text' 2>/dev/null
+	sed --verbose $(pwd) test
+		x=1 test awk --verbose ${HOME} 2>/dev/null
+| --verbose /usr/bin done
+		"$1" $(pwd) "$@" printf "$@" test readonly /usr/bin readonly 'quoted text'
+	"$1" done then ${HOME} test done
+test done done done ${HOME} export sed readonly | -eu then export /usr/bin
+export "$1" then "$1" "$1" 'quoted text'
+	${HOME} done 2>/dev/null cd "$1" export
+		/usr/bin -eu cd $(pwd) /usr/bin ${HOME}
+	then sed printf awk awk 2>/dev/null cd echo 'quoted text'
+	| export awk && echo test done cd then grep printf --verbose
+	| $(pwd) 'quoted text' grep /usr/bin 'quoted text' $(pwd) "$@" "$@" $(pwd)
+		cd printf -eu then -eu sed $(pwd) --verbose --verbose
+test x=1 then -eu -eu grep then export x=1 'quoted text' export | test export
+	"$@" printf cd "$@" cd done 2>/dev/null readonly | 'quoted text'
+	done local cd then test | $(pwd) "$1" echo awk then then "$1" done export
+		'quoted text' 2>/dev/null readonly "$@" readonly cd -eu x=1 readonly awk sed 'quoted text'
+	local ${HOME} done --verbose
+then echo awk grep -eu
+$(pwd) ${HOME} 2>/dev/null 2>/dev/null awk printf -eu
+	-eu echo ${HOME} 'quoted text' echo done -eu cd &&
+x=1 /usr/bin sed printf && -eu | printf --verbose ${HOME} /usr/bin
+		grep then test /usr/bin printf awk local && x=1 x=1 readonly 'quoted text'
+	${HOME} 2>/dev/null printf awk
+	local /usr/bin 'quoted text' 2>/dev/null local then "$@" echo --verbose
+	'quoted text' cd "$1" then test ${HOME}
+	&& export export test -eu local readonly local
+	x=1 | --verbose 'quoted text' cd test readonly readonly |
+	done awk 'quoted text' "$1" sed awk grep && -eu test echo
+	then ${HOME} readonly sed
+${HOME} /usr/bin readonly "$@" grep 2>/dev/null 2>/dev/null
+		grep cd printf $(pwd) cd ${HOME} cd awk "$@" echo done awk --verbose
+sed -eu done --verbose then x=1
+	echo -eu "$@" grep -eu done "$@"
+$(pwd) | 'quoted text' echo "$@"
+	"$@" | sed done test 'quoted text' --verbose printf awk /usr/bin
+	local grep then | 2>/dev/null cd done "$1"
+	printf cd grep echo | "$@" && awk echo
+&& sed sed 2>/dev/null "$@" "$1" test ${HOME}
+local echo && 2>/dev/null awk ${HOME} x=1 grep 'quoted text' done cd cd && "$1"
+	--verbose awk local printf sed local cd sed grep
+		cd then sed test export && 'quoted text' $(pwd) printf awk sed -eu
+		awk readonly grep -eu -eu "$1" grep | awk grep ${HOME} export sed $(pwd) -eu
+	$(pwd) "$@" export printf test "$@"
+"$1" 'quoted text' 2>/dev/null "$@" export --verbose
+	test awk 2>/dev/null awk
+/usr/bin cd -eu echo ${HOME} | sed x=1
+sed 'quoted text' $(pwd) awk echo awk x=1 test /usr/bin test "$1" /usr/bin "$@"
+	sed sed && echo /usr/bin --verbose
+		readonly done | cd echo $(pwd)
+		done test -eu 2>/dev/null x=1 awk /usr/bin /usr/bin test
+		&& printf -eu local $(pwd) printf test $(pwd) "$@" export local && sed --verbose
+	-eu then cd 'quoted text' readonly -eu $(pwd) && "$1" test
+	--verbose /usr/bin printf awk test cd test --verbose --verbose /usr/bin readonly
+		'quoted text' -eu && && $(pwd) grep ${HOME} local /usr/bin done | grep cd
+then grep -eu && local 'quoted text' --verbose --verbose "$1" sed
+	| then test export /usr/bin 'quoted text' cd test --verbose
+		readonly "$1" "$1" export export sed local export export done 2>/dev/null -eu $(pwd)
+		/usr/bin | cd readonly cd echo
+		then ${HOME} $(pwd) "$@" printf
+		$(pwd) grep --verbose test "$@" --verbose
+		printf --verbose awk --verbose | done --verbose 'quoted text'
+${HOME} x=1 test --verbose -eu echo export /usr/bin $(pwd) /usr/bin "$@"
+"$1" echo export readonly sed $(pwd) readonly "$@"
+		| $(pwd) $(pwd) --verbose 'quoted text' 'quoted text' 'quoted text'
+echo awk sed sed then then "$@" 2>/dev/null --verbose "$@"
+	local awk readonly grep
+	"$@" && --verbose | echo export export --verbose done ${HOME} 2>/dev/null
+		&& export local "$@" $(pwd) x=1 | echo export local printf && | /usr/bin
+	readonly "$1" x=1 "$@" printf local
+		x=1 ${HOME} export "$1"
+	| --verbose done then sed 'quoted text' ${HOME} awk grep 2>/dev/null
+		echo done x=1 /usr/bin && done "$@" cd sed -eu --verbose
+		readonly $(pwd) "$1" x=1 ${HOME} local && | printf 'quoted text' x=1 x=1 ${HOME}
+	local x=1 'quoted text' x=1 printf
+		test 'quoted text' $(pwd) local test awk 'quoted text' cd test local sed &&
+		readonly grep 'quoted text' grep readonly && "$1" && "$@" then /usr/bin
+export | export && ${HOME} "$@" "$1" 2>/dev/null && $(pwd) cd readonly
+	x=1 printf readonly -eu /usr/bin
+${HOME} printf readonly "$@" ${HOME} 2>/dev/null /usr/bin export
+sed then grep && 'quoted text' -eu 2>/dev/null echo 2>/dev/null
+		2>/dev/null $(pwd) readonly
+		--verbose 2>/dev/null --verbose printf sed -eu
+	local && x=1 2>/dev/null -eu local --verbose "$@" sed && --verbose sed printf
+		done readonly readonly --verbose grep -eu ${HOME}
+then export && -eu && | "$1" echo "$@" then printf /usr/bin cd "$@"
+	export sed cd awk $(pwd) awk $(pwd) 'quoted text' ${HOME} x=1 'quoted text'
+then | grep /usr/bin printf printf ${HOME} sed awk echo | && /usr/bin
+	2>/dev/null cd && cd export local $(pwd) -eu
+		"$1" "$@" readonly "$@" -eu local "$@" then export
+	cd awk 'quoted text' awk export && grep
+	"$1" | printf 2>/dev/null local /usr/bin then
+	${HOME} echo --verbose 2>/dev/null ${HOME} then export x=1 ${HOME}
+		-eu 2>/dev/null export grep "$@" 'quoted text' then | "$@" ${HOME}
+		| x=1 "$1" cd export grep 2>/dev/null sed | local | test -eu echo "$1"
+		local echo 2>/dev/null -eu --verbose -eu --verbose 'quoted text' local 2>/dev/null
+		'quoted text' /usr/bin
+		echo sed done "$1" --verbose | $(pwd) test ${HOME} ${HOME} $(pwd) sed
+		x=1 local ${HOME} 2>/dev/null local test awk test cd done x=1
+	printf echo echo ${HOME} $(pwd) then $(pwd) /usr/bin grep | test cd cd sed
+	/usr/bin ${HOME} -eu export $(pwd) printf x=1 "$@" "$1" --verbose
+| readonly && x=1 local /usr/bin /usr/bin awk -eu /usr/bin
+	2>/dev/null readonly $(pwd) printf "$1" $(pwd) /usr/bin
+test local export sed 2>/dev/null ${HOME} "$1" grep ${HOME} -eu 2>/dev/null
+		sed echo export 2>/dev/null grep printf readonly $(pwd)
+test sed echo local export ${HOME} printf cd done --verbose -eu | x=1 done
+-eu $(pwd) grep -eu grep export printf "$@" --verbose echo x=1 && echo
+		"$1" done echo -eu test $(pwd) grep 2>/dev/null readonly /usr/bin then "$@"
+done readonly awk then cd "$1" x=1 x=1 done done echo x=1 printf $(pwd) "$1"
+		${HOME} printf x=1 ${HOME} x=1 ${HOME} printf local $(pwd) then echo readonly
+	then done /usr/bin --verbose done local --verbose "$@" done
+		then printf export awk cd --verbose awk local ${HOME} 2>/dev/null --verbose test
+| awk readonly sed 2>/dev/null "$1" done
+	x=1 awk /usr/bin "$1" --verbose "$1" done 'quoted text' sed "$@" readonly then
+	| test awk -eu export then 2>/dev/null done --verbose
+${HOME} "$@" done --verbose --verbose x=1 && awk grep echo "$1" /usr/bin /usr/bin
+"$@" sed "$@" "$@" --verbose -eu echo x=1 test --verbose "$@" local
+	printf 2>/dev/null local "$@" "$1" 2>/dev/null
+		sed cd "$1" local sed
+	local ${HOME} echo 2>/dev/null done && awk "$@"
+	"$@" "$@" -eu 'quoted text'
+	then "$1" 'quoted text' $(pwd) ${HOME} test "$@" printf cd -eu 2>/dev/null
+$(pwd) $(pwd) && sed ${HOME} 2>/dev/null
+		'quoted text' test --verbose ${HOME} printf /usr/bin &&
+test $(pwd) test test export
+		then then done | $(pwd) | awk
+		--verbose then sed export printf then readonly
+2>/dev/null /usr/bin && && grep /usr/bin then echo printf grep cd local 'quoted text'
+"$@" done 2>/dev/null /usr/bin && --verbose
+		--verbose "$@" export --verbose $(pwd) done && 2>/dev/null grep /usr/bin /usr/bin
+	'quoted text' 2>/dev/null | ${HOME} echo cd local 'quoted text' x=1 done
+awk /usr/bin "$@" export readonly done $(pwd) export -eu export ${HOME}
+sed "$1" 'quoted text' test readonly /usr/bin export && "$1" grep "$@" $(pwd)
+		2>/dev/null && x=1 "$@" echo --verbose x=1 2>/dev/null
+		/usr/bin grep cd ${HOME} ${HOME} -eu $(pwd) -eu "$1" then cd -eu test --verbose
+	grep -eu then readonly export
+		then sed done printf export sed --verbose x=1 "$@" && cd cd --verbose
+&& then local "$1" "$@" $(pwd)
+	"$@" /usr/bin 'quoted text' printf
+	"$@" done x=1 echo "$1" $(pwd)
+	| grep test done readonly $(pwd) cd 2>/dev/null
+readonly done cd ${HOME} grep cd ${HOME} "$1" --verbose 2>/dev/null echo
+		"$1" && awk 2>/dev/null test "$1" then local x=1
+	'quoted text' ${HOME} then sed then sed 'quoted text'
+		test ${HOME} export -eu $(pwd) | done test
+-eu export --verbose export "$1" sed ${HOME} --verbose printf export
+	| sed export printf done /usr/bin export "$1" then test local
+&& 2>/dev/null readonly ${HOME} then && 2>/dev/null -eu printf -eu ${HOME}
+	readonly x=1 printf cd local local local echo "$1" "$1" grep test && | $(pwd)
+	export $(pwd) local /usr/bin awk 2>/dev/null ${HOME} x=1
+$(pwd) 'quoted text' && 'quoted text' x=1 sed echo
+	"$@" then cd /usr/bin 'quoted text' grep && --verbose cd |
+		--verbose -eu | awk $(pwd) sed grep
+		printf done $(pwd) ${HOME} sed printf 'quoted text' done cd local export
+		readonly sed local --verbose
+	"$@" awk 2>/dev/null "$@" | printf
+		echo printf cd "$@" /usr/bin awk test $(pwd) 'quoted text' --verbose
+		$(pwd) -eu "$@" cd grep "$1"
+	sed readonly test ${HOME} cd export "$@" done --verbose -eu $(pwd)
+	done 'quoted text' local 2>/dev/null | then x=1 done
+	awk awk done 'quoted text'
+		export 2>/dev/null -eu $(pwd) awk done cd export readonly awk
+	&& cd done awk echo cd readonly
+&& && x=1 x=1 sed ${HOME} cd 'quoted text' local --verbose
+	2>/dev/null -eu $(pwd) x=1 && then readonly -eu local
+	cd && echo export printf
+	echo cd /usr/bin printf awk readonly echo grep "$1" then cd "$@"
+then | /usr/bin echo test -eu done then | echo awk && x=1 readonly 2>/dev/null
+		${HOME} | local /usr/bin done echo --verbose export --verbose
+grep cd -eu test done $(pwd)
+'quoted text' sed | $(pwd) x=1
+grep readonly grep echo cd sed sed "$1" && "$@" ${HOME}
+	then --verbose export cd awk awk then &&
+		--verbose --verbose printf
+awk grep echo readonly "$@"
+--verbose test -eu printf ${HOME} sed "$1" | cd sed ${HOME} | export awk 2>/dev/null
+	readonly && && printf "$@"
+test && "$@" printf export /usr/bin
+	cd sed "$@" local then -eu 2>/dev/null $(pwd)
+	$(pwd) 'quoted text' readonly
+		"$@" local && /usr/bin cd readonly readonly | readonly export
+	| "$@" 'quoted text' x=1 cd $(pwd) cd cd -eu --verbose
+	x=1 cd ${HOME} | then && export echo local awk x=1 then sed $(pwd) readonly
+2>/dev/null "$1" then
+	--verbose local readonly printf ${HOME} -eu readonly then readonly 'quoted text'
+		&& 'quoted text' x=1 /usr/bin
+	readonly 'quoted text'
+	/usr/bin cd test | -eu then $(pwd) -eu "$@" ${HOME} | --verbose
+echo "$1" awk --verbose 'quoted text' | --verbose readonly
+		readonly test --verbose "$1" local local cd /usr/bin "$@" 'quoted text'
+	printf "$@" /usr/bin $(pwd) export
+	"$@" | 2>/dev/null "$1" | x=1 -eu readonly
+	$(pwd) /usr/bin | local "$1" readonly 2>/dev/null "$1" sed printf $(pwd) local
+then cd sed echo -eu && local grep /usr/bin 2>/dev/null -eu local
+		&& x=1 --verbose x=1 "$1" "$1" && 2>/dev/null printf "$@" | local test 2>/dev/null
+	--verbose && export cd readonly grep done -eu 'quoted text' &&
+echo x=1 then /usr/bin grep && $(pwd) /usr/bin "$1" --verbose
+		test /usr/bin "$@" then "$@" && export --verbose 'quoted text'
+x=1 -eu test && echo | /usr/bin -eu sed cd local then export | && echo 2>/dev/null
+		-eu --verbose done test $(pwd) 'quoted text' "$1" 'quoted text' then local
+	${HOME} $(pwd) 2>/dev/null grep local cd 'quoted text'
+	"$1" cd && then --verbose local | "$1" then $(pwd)
+		sed local grep "$1" echo done 2>/dev/null
+	printf cd echo cd local awk ${HOME} 'quoted text' 'quoted text' then /usr/bin
+then | printf sed && ${HOME} then export local $(pwd) cd
+&& printf x=1 export then done 'quoted text'
+		"$@" printf then && done echo cd -eu "$1" local
+	sed -eu | "$@" -eu && grep test export /usr/bin
+awk grep "$1" -eu 'quoted text' | local readonly printf 'quoted text'
+	&& grep --verbose test
+		cd local echo $(pwd) ${HOME}
+	2>/dev/null x=1 awk then | then | 'quoted text' /usr/bin -eu then && printf
+"$@" --verbose then 2>/dev/null test -eu ${HOME} done 'quoted text'
+		'quoted text' sed "$@" test then --verbose $(pwd) done 'quoted text'
+export test cd "$@" cd x=1 x=1 $(pwd) export "$1" 'quoted text' 'quoted text'
+awk $(pwd) -eu ${HOME}
+	echo grep -eu awk $(pwd)
+	export | "$@" "$1" ${HOME} 2>/dev/null "$@" -eu
+2>/dev/null grep sed -eu export --verbose
+$(pwd) test cd x=1 test --verbose "$@" test $(pwd) /usr/bin 'quoted text'
+printf cd "$@" then 'quoted text' readonly printf test test /usr/bin
+cd | x=1 awk local --verbose x=1 -eu
+		grep --verbose "$@" export then --verbose "$@" 'quoted text'
+	awk export echo done x=1 "$@" export /usr/bin done
+	&& sed 2>/dev/null && x=1 $(pwd) export 'quoted text' --verbose --verbose 'quoted text'
+		cd export ${HOME} ${HOME} --verbose cd "$@"
+		sed cd test cd export echo --verbose "$@" export
+printf awk sed 2>/dev/null 'quoted text' $(pwd) awk /usr/bin done
+export "$@" sed done 'quoted text' test readonly "$@" x=1 /usr/bin
+	"$1" "$@" done "$1" -eu export local echo 2>/dev/null /usr/bin then "$@" 'quoted text'
+		"$1" /usr/bin | -eu 2>/dev/null "$1" grep
+		test readonly 2>/dev/null echo done $(pwd)
+	--verbose readonly x=1 -eu && | then then 'quoted text' -eu && ${HOME}
+		/usr/bin grep && test test test "$@" readonly x=1
+		cd 2>/dev/null local done 2>/dev/null 'quoted text' | readonly
+done local x=1 readonly grep readonly /usr/bin readonly 2>/dev/null /usr/bin
+| | sed grep "$@" sed --verbose sed then /usr/bin
+	"$1" --verbose test test awk test printf
+		echo 2>/dev/null -eu -eu "$1" sed /usr/bin test
+sed cd | ${HOME} printf 'quoted text' sed sed --verbose test
+	"$@" "$1" test -eu x=1 grep x=1 cd readonly && echo "$@" echo 2>/dev/null
+--verbose 'quoted text' awk --verbose | 'quoted text'
+		2>/dev/null printf cd grep /usr/bin --verbose
+		/usr/bin 2>/dev/null 'quoted text'
+cd test | --verbose cd awk
+'quoted text' x=1 local "$1" $(pwd) && | cd 'quoted text' readonly -eu 'quoted text'
+		--verbose 2>/dev/null ${HOME} done | readonly export $(pwd) && x=1 local
+		"$1" 'quoted text' && | cd /usr/bin export /usr/bin -eu local printf -eu | sed
+	cd awk local sed cd export && -eu | sed 'quoted text'
+	local export export export sed sed | export "$@" sed export grep "$1"
+		grep $(pwd) "$1" awk cd printf export "$@" readonly sed readonly
+		done cd 2>/dev/null 2>/dev/null
+/usr/bin grep done ${HOME} --verbose
+--verbose ${HOME} export then "$1" /usr/bin 'quoted text' -eu done $(pwd)
+		'quoted text' "$@" 'quoted text'
+"$@" -eu test -eu done sed cd 2>/dev/null | 2>/dev/null ${HOME} 2>/dev/null
+export readonly readonly --verbose && export
+		'quoted text' $(pwd) "$@" export echo /usr/bin | --verbose && "$@" /usr/bin then
+-eu awk awk "$@" 'quoted text'
+		x=1 sed local && sed | $(pwd)
+	readonly grep -eu local "$@" "$1" "$1" then printf
+	readonly printf | "$1"
+grep -eu "$@" local x=1
+	$(pwd) "$@" x=1 x=1 test
+	done ${HOME} echo done &&
+test local readonly local grep 'quoted text' 'quoted text'
+local /usr/bin printf "$@" sed
+		export cd export local -eu "$1" echo "$1" export
+	cd done | export done x=1 ${HOME} printf local grep
+		"$@" awk cd 2>/dev/null awk "$@" "$1" grep -eu -eu "$@" "$@"
+		${HOME} $(pwd) | readonly printf test done printf
+	local x=1 local test $(pwd) ${HOME} | export then export
+		echo /usr/bin "$@" done readonly then test && --verbose
+	'quoted text' grep "$1" cd export export x=1
+export cd x=1 cd $(pwd) "$1" readonly x=1 2>/dev/null test printf export
+"$@" "$1" printf sed then export
+		local export awk cd awk
+echo then readonly $(pwd) --verbose $(pwd) /usr/bin
+		readonly test cd local echo
+	readonly cd cd readonly awk awk
+	| | sed /usr/bin test grep
+echo export /usr/bin --verbose echo echo cd sed 'quoted text' awk && awk -eu
+	$(pwd) /usr/bin 'quoted text' "$@" "$@" &&
+		echo readonly echo 2>/dev/null
+		${HOME} 2>/dev/null printf $(pwd) local
+printf local && -eu readonly grep local "$@" readonly "$@" 2>/dev/null then | "$1"
+-eu "$1" readonly 2>/dev/null 'quoted text' done cd done 2>/dev/null 'quoted text'
+	$(pwd) /usr/bin done $(pwd) "$@" "$1"
+		"$1" echo "$@" x=1 | 'quoted text' awk --verbose export test
+		'quoted text' --verbose test grep "$1"
+"$1" -eu grep local readonly done
+| then then echo --verbose
+echo awk local | $(pwd)
+	sed readonly grep -eu sed 'quoted text' x=1 ${HOME} echo 2>/dev/null 2>/dev/null
+-eu | "$1" done "$@" printf $(pwd) 2>/dev/null
+		x=1 test 'quoted text' cd sed | echo -eu printf readonly done /usr/bin printf
+		&& ${HOME} ${HOME} x=1 cd sed export grep sed /usr/bin awk readonly
+		--verbose grep -eu -eu /usr/bin $(pwd) | "$@" 2>/dev/null ${HOME}
+2>/dev/null grep 2>/dev/null && --verbose
+#include c150.sh
+		--verbose "$1" awk x=1 readonly
+		$(pwd) "$1" --verbose /usr/bin sed awk && | | printf ${HOME}
+-eu printf cd awk export 'quoted text' "$@" cd grep /usr/bin
+$(pwd) /usr/bin -eu | --verbose grep test cd -eu cd grep printf |
+	| --verbose printf done awk 2>/dev/null "$1"
+		2>/dev/null "$1" x=1 awk -eu
+	test "$@" cd -eu "$@" done printf sed $(pwd) cd 2>/dev/null | | $(pwd) then
+/usr/bin $(pwd) /usr/bin x=1 --verbose local then then done
+"$@" done readonly | echo x=1 -eu
+test 2>/dev/null cd "$1" /usr/bin | -eu test done grep export readonly test printf
+"$1" x=1 ${HOME} sed $(pwd) x=1
+		"$@" export x=1 test $(pwd) $(pwd) $(pwd) export 2>/dev/null
+		${HOME} done 2>/dev/null grep | then "$1" 'quoted text'
+		-eu export && x=1 && test test
+		-eu awk "$@" local printf
+	'quoted text' then 'quoted text' export test printf
+awk sed "$1" "$1" "$@" test $(pwd) x=1 cd printf --verbose 2>/dev/null
+	test ${HOME} awk "$@" then 'quoted text'
+"$1" readonly --verbose | 'quoted text' x=1 -eu "$1" && sed readonly
+	then 'quoted text' then test "$@" printf
+		echo export x=1 cd printf then
+test export ${HOME} 2>/dev/null && local x=1 2>/dev/null grep "$@" $(pwd)
+	readonly && printf done echo
+		cd test --verbose printf
+		/usr/bin /usr/bin --verbose export readonly "$@" then readonly "$1" sed
+		| "$@" "$@" "$@" "$@" grep 'quoted text' 'quoted text' "$@"
+	"$1" awk then "$@" cd "$@" /usr/bin | ${HOME} echo echo "$@" /usr/bin echo
+		printf $(pwd) "$1" done
+		| grep --verbose echo "$@" "$@" -eu $(pwd) export -eu cd --verbose awk
+--verbose x=1 | -eu export | test readonly
+	--verbose awk test export sed 'quoted text'
+readonly readonly done done test /usr/bin /usr/bin 'quoted text' awk grep "$@" x=1
+	done --verbose readonly sed | ${HOME} "$1" sed local awk --verbose then -eu
+'quoted text' export /usr/bin | 2>/dev/null test echo echo echo
+		test && export test then echo "$@" 'quoted text'
+${HOME} awk 'quoted text' -eu --verbose
+	grep cd 'quoted text' echo | --verbose
+	2>/dev/null "$1" ${HOME} x=1
+test readonly done export --verbose | done
+'quoted text' sed "$1" then --verbose
+	printf 'quoted text' && readonly done export local "$1" -eu echo local
+		grep export grep grep readonly export | then echo "$@" export then
+		"$1" ${HOME} then done 'quoted text' awk readonly echo
+x=1 awk ${HOME} grep printf export && "$@" "$@" printf
+	local $(pwd) readonly -eu echo x=1 awk grep $(pwd) $(pwd)
+		&& "$1" then then -eu | export | test printf 2>/dev/null
+		cd $(pwd) test && readonly "$1" "$@" 'quoted text'
+		sed "$1" -eu --verbose readonly grep grep awk | printf ${HOME}
+2>/dev/null /usr/bin --verbose done -eu then export local ${HOME}
+	printf -eu /usr/bin cd echo --verbose
+	export -eu cd --verbose done readonly local readonly 'quoted text'
+	${HOME} 2>/dev/null readonly ${HOME} cd then echo grep x=1 ${HOME}
+	done printf $(pwd) -eu test local awk --verbose sed sed
+grep x=1 x=1 then | awk grep
+		then ${HOME} 'quoted text' test
+	2>/dev/null echo "$@" readonly "$1" export grep $(pwd) --verbose test then
+then ${HOME} 2>/dev/null "$1" cd
+		/usr/bin awk readonly $(pwd) "$1"
+${HOME} | cd $(pwd) export
+sed | x=1 local cd $(pwd) x=1 done 2>/dev/null
+		test "$1" && echo -eu $(pwd) cd readonly
+x=1 'quoted text' /usr/bin -eu readonly "$@" then test readonly "$1"
+		sed /usr/bin sed && /usr/bin -eu 2>/dev/null cd readonly test local $(pwd)
+&& -eu | printf grep awk readonly && -eu
+	test -eu awk "$1" && | readonly
+		grep printf x=1 --verbose then | local
+	printf -eu done $(pwd) local awk grep /usr/bin $(pwd) $(pwd) readonly local
+then readonly echo 2>/dev/null "$1" | -eu then
+		| then "$@" then local awk "$@" echo ${HOME}
+-eu "$1" 'quoted text' x=1 sed
+		awk $(pwd) -eu readonly echo echo test readonly readonly sed && ${HOME} 2>/dev/null
+		readonly printf done /usr/bin local
+-eu test local "$1" 2>/dev/null "$1" x=1 ${HOME} export $(pwd) | 2>/dev/null local
+	/usr/bin $(pwd) grep -eu "$1" "$@" cd --verbose 2>/dev/null
+	| printf printf -eu grep "$1" printf sed sed
+		-eu && /usr/bin $(pwd) ${HOME} && export export printf
+${HOME} grep 2>/dev/null $(pwd) ${HOME}
+		done $(pwd) ${HOME} echo
+| --verbose | "$1" $(pwd) printf grep /usr/bin
+	awk local "$1" awk 2>/dev/null export awk
+	$(pwd) 'quoted text' -eu --verbose
+		| export export && local then /usr/bin readonly
+	awk done then export test then $(pwd) "$1" $(pwd) test cd "$1" 2>/dev/null
+	"$1" 'quoted text' test printf local done 'quoted text'
+		&& | local | 2>/dev/null ${HOME} export sed --verbose
+	printf && grep sed local
+		2>/dev/null -eu done local "$@" /usr/bin awk test /usr/bin 'quoted text' &&
+"$@" export readonly 'quoted text'
+--verbose -eu && x=1 awk printf x=1 2>/dev/null
+		${HOME} local sed sed -eu "$@" | "$1" awk awk -eu test local printf
+		readonly cd | 'quoted text' x=1
+--verbose /usr/bin 2>/dev/null -eu --verbose
+	readonly -eu /usr/bin -eu echo $(pwd) then cd x=1 "$1" export done x=1
+readonly x=1 x=1 && | --verbose echo -eu awk -eu
+--verbose done sed export x=1 test
+		done "$@" done ${HOME} 2>/dev/null /usr/bin export printf
+	printf echo /usr/bin ${HOME} -eu printf
+	'quoted text' "$@" printf grep test done && test test $(pwd) sed /usr/bin
+&& test then awk awk done x=1 cd printf grep export awk
+		readonly then x=1 && x=1 "$@"
+		"$@" "$1" 2>/dev/null awk && 'quoted text' printf cd local test sed grep -eu
+	--verbose sed readonly "$1" --verbose echo then x=1 "$@" sed awk ${HOME}
+		printf | x=1 -eu grep $(pwd)
+export | /usr/bin x=1 readonly test awk "$@" printf
+	"$1" grep sed readonly printf local cd
+	x=1 --verbose /usr/bin export && sed && awk awk $(pwd) export export
+awk awk readonly /usr/bin grep $(pwd) grep done "$@" | "$@" | awk echo done test
+		grep printf printf echo awk ${HOME} --verbose
+-eu sed | export awk sed $(pwd) $(pwd) x=1 ${HOME} test $(pwd) | ${HOME}
+	awk ${HOME} | done local x=1 export --verbose echo done
+&& ${HOME} echo -eu --verbose $(pwd) 'quoted text'
+-eu cd cd --verbose echo ${HOME} /usr/bin awk cd test printf /usr/bin
+		--verbose cd test ${HOME} && local test 'quoted text' done grep x=1 'quoted text'
+"$@" $(pwd) --verbose test awk $(pwd)
+test | "$@" printf local done 'quoted text'
+	x=1 echo --verbose && grep grep /usr/bin 2>/dev/null "$@" "$1" export then
+	awk x=1 grep sed --verbose awk printf --verbose export
+		grep x=1 $(pwd) cd awk then then cd | done && && --verbose
+	done $(pwd) $(pwd) | && && printf printf then /usr/bin
+	--verbose readonly $(pwd) $(pwd)
+grep ${HOME} local echo && "$1"
+		then echo done printf x=1 printf
+x=1 local $(pwd) /usr/bin 'quoted text' test cd local $(pwd) export cd 'quoted text'
+then then printf test cd 'quoted text' done | --verbose -eu -eu
+	2>/dev/null grep -eu local -eu readonly ${HOME}
+	$(pwd) --verbose echo --verbose $(pwd) /usr/bin x=1 then /usr/bin
+		grep "$@" && /usr/bin export
+echo /usr/bin then test "$@" echo $(pwd) x=1 "$1" x=1 echo
+readonly --verbose export cd awk /usr/bin cd "$1" cd done test 2>/dev/null
+		sed export done echo then done "$1" "$@" | 'quoted text' grep -eu
+		sed cd x=1 | done "$1" export --verbose then x=1 2>/dev/null ${HOME} readonly
+sed cd /usr/bin sed ${HOME} /usr/bin
+		awk $(pwd) x=1 $(pwd) sed /usr/bin done sed then && readonly
+then grep -eu "$@" ${HOME} printf sed cd done "$@" grep echo local
+		-eu x=1 printf "$1" printf && 2>/dev/null cd local | grep ${HOME}
+	done "$@" readonly x=1 'quoted text' printf -eu &&
+		sed ${HOME} 'quoted text'
+cd cd 2>/dev/null readonly -eu "$@"
+	printf "$@" readonly export 2>/dev/null
+		| then printf test /usr/bin done "$1" "$1" /usr/bin grep
+		'quoted text' cd cd readonly "$@" /usr/bin grep cd export $(pwd) &&
+	--verbose && cd -eu echo readonly "$1" export
+	sed 2>/dev/null /usr/bin ${HOME} sed --verbose cd &&
+"$@" done | | echo sed awk echo done export done awk x=1 export grep
+		$(pwd) awk test && x=1 "$1" && x=1 local 'quoted text' export
+		test awk "$@" cd "$@" export cd sed 'quoted text' x=1 ${HOME} echo local
+		grep sed x=1 test $(pwd) $(pwd) awk $(pwd) "$@" "$@" printf
+		grep | local "$1" /usr/bin export -eu export
+		done done $(pwd) printf sed x=1 local export
+	/usr/bin cd then done local
+	done done -eu -eu x=1 -eu export echo 2>/dev/null -eu
+		export | -eu grep --verbose
+	--verbose | awk export
+	then then echo test x=1 done 'quoted text' test
+		sed then /usr/bin export grep readonly --verbose
+		&& --verbose | && && "$@" readonly
+	sed export local x=1 -eu $(pwd) awk then $(pwd) x=1
+	test done then cd printf &&
+'quoted text' done readonly | done done cd local | sed echo grep "$1" local
+	test --verbose sed --verbose test
+	done done ${HOME} "$@" echo local done printf local ${HOME}
+		"$@" ${HOME} 2>/dev/null grep local done printf --verbose 2>/dev/null && ${HOME}
+	done cd | awk echo x=1 grep && echo
+printf cd sed --verbose && sed /usr/bin
+		-eu printf --verbose "$@" printf 2>/dev/null 2>/dev/null local "$@" awk done
+	printf readonly ${HOME} then --verbose --verbose 2>/dev/null awk --verbose "$1"
+	"$1" /usr/bin test then awk export /usr/bin "$1" echo grep "$1"
+	--verbose echo 'quoted text' grep sed awk test cd 2>/dev/null 2>/dev/null
+		'quoted text' awk cd -eu 'quoted text' "$1" $(pwd)
+	${HOME} test | printf x=1 | "$@" then echo readonly test echo cd printf done /usr/bin
+		--verbose "$1" "$1" cd local /usr/bin
+cd "$@" x=1 "$1" export
+		local done "$@" awk --verbose export
+		"$@" local 2>/dev/null grep "$1" awk -eu 2>/dev/null
+awk -eu done 'quoted text' export | && grep awk | sed
+		/usr/bin "$1" /usr/bin export local awk
+test | ${HOME} 'quoted text' 'quoted text' test sed x=1 local /usr/bin echo
+x=1 then local test 'quoted text' x=1 test x=1 --verbose | awk local && test x=1
+		-eu local -eu grep && export awk readonly
+	then sed then done local echo
+		export then done cd then local grep -eu done && "$@" 'quoted text' | "$@" 2>/dev/null
+/usr/bin local awk && done then | cd printf then x=1 --verbose
+		-eu /usr/bin export awk local /usr/bin x=1 "$1" && test done local readonly
+	done sed readonly export grep ${HOME} awk | 'quoted text' | -eu /usr/bin
+	grep done test | readonly readonly sed | then ${HOME} awk echo
+/usr/bin printf /usr/bin awk readonly x=1 test 'quoted text'
+		echo grep x=1 grep && then readonly
+		x=1 'quoted text' "$1" test awk "$1" "$@"
+		test done --verbose x=1 $(pwd) && "$@" grep
+		export && done $(pwd) ${HOME}
+		x=1 grep x=1 --verbose then "$@" echo 'quoted text' ${HOME} echo test --verbose
+	2>/dev/null | grep x=1 | -eu "$1" 2>/dev/null awk readonly local echo | "$@"
+		${HOME} 'quoted text' ${HOME} 'quoted text' export /usr/bin "$1" sed printf
+grep cd -eu | ${HOME} grep 2>/dev/null readonly "$@" sed echo cd local && local
+2>/dev/null done test awk sed "$@" ${HOME} printf -eu echo ${HOME}
+	grep sed echo 'quoted text' && "$1" 2>/dev/null printf
+| | && export done test then
+echo 2>/dev/null cd "$@" grep "$@" grep -eu $(pwd)
+		--verbose x=1 "$1" readonly sed test done sed grep 2>/dev/null
+		--verbose 2>/dev/null -eu && printf
+		done -eu cd test && 2>/dev/null 'quoted text'
+--verbose --verbose && && echo echo echo x=1 "$1" echo echo readonly
+		'quoted text' test "$1" cd cd -eu sed then sed echo done local sed 2>/dev/null |
+	-eu printf "$@" ${HOME} export
+	echo test /usr/bin | --verbose done then echo x=1 echo /usr/bin
+	printf export "$@" printf grep export
+| $(pwd) cd echo sed sed "$1" export sed
+readonly | && && /usr/bin
+$(pwd) --verbose /usr/bin awk
+		then "$1" export | x=1 2>/dev/null | done
+		cd 'quoted text' printf awk awk x=1 export printf
+"$@" readonly x=1 test && awk awk && printf echo
+echo $(pwd) $(pwd) 'quoted text' grep then 'quoted text' echo sed "$1"
+		| grep "$@" "$1" "$@" x=1 then "$1" local
+		| 2>/dev/null x=1 test -eu grep ${HOME} ${HOME} $(pwd) grep --verbose
+		test ${HOME} test printf done $(pwd) -eu echo "$1" -eu test "$1"
+done /usr/bin awk printf
+	$(pwd) "$@" done -eu then "$@" /usr/bin
+	export cd local 'quoted text' export readonly && --verbose 'quoted text' "$@"
+	/usr/bin printf readonly
+	'quoted text' awk "$@" 2>/dev/null "$1" "$1" echo local
+"$1" cd sed --verbose -eu
+	-eu /usr/bin && local -eu && test "$1"
+&& export "$@" --verbose -eu test x=1 --verbose
+		printf grep printf 'quoted text'
+		| readonly grep test /usr/bin readonly 2>/dev/null
+$(pwd) sed local 2>/dev/null echo test test readonly "$@" 'quoted text'
+		grep | 'quoted text' printf --verbose --verbose -eu echo export && test
+	x=1 "$@" /usr/bin 2>/dev/null
+	sed echo grep /usr/bin then sed && "$1" "$@" then "$@" awk cd x=1 grep
+${HOME} x=1 test printf local export -eu 'quoted text' awk $(pwd) "$1" then readonly
+| "$1" "$1" $(pwd) $(pwd) test then ${HOME} echo && |
+${HOME} --verbose awk echo readonly test printf printf "$1" $(pwd) "$@"
+		2>/dev/null sed "$1" awk local printf cd cd local echo /usr/bin 2>/dev/null echo
+"$1" export then local
+	grep "$@" ${HOME} sed grep /usr/bin 2>/dev/null && "$@" && "$@" "$@" done
+grep done "$@" --verbose done printf
+		&& && grep ${HOME} $(pwd) done "$@" x=1 export export echo done grep sed /usr/bin
+"$1" $(pwd) sed local test awk grep grep
+		export local "$1" --verbose 'quoted text'
+| "$@" --verbose cd | 'quoted text' | "$1" -eu ${HOME} sed
+	grep printf local awk local readonly cd
+$(pwd) /usr/bin readonly done "$1"
+cd "$@" done readonly ${HOME} | --verbose test local done $(pwd) $(pwd) 2>/dev/null
+		then echo echo && "$1" 'quoted text' "$@" ${HOME} local cd awk cd readonly
+| -eu sed -eu 2>/dev/null
+		cd echo test "$1" && 'quoted text' awk echo -eu $(pwd)
+	export printf -eu "$1" sed test printf --verbose
+	printf echo then sed awk
+		printf printf /usr/bin /usr/bin local grep printf echo export "$1" readonly
+cd echo sed 2>/dev/null awk
+	done cd x=1 2>/dev/null $(pwd) printf | printf
+		-eu 2>/dev/null printf awk echo ${HOME} done export cd export
+		-eu cd /usr/bin local ${HOME} -eu x=1 --verbose awk sed sed local
+	${HOME} readonly echo
+		| | awk cd grep && done x=1 && echo "$@" done "$@" x=1 x=1 && local $(pwd)
+		grep ${HOME} readonly ${HOME}
+		x=1 2>/dev/null done 'quoted text'
+		cd 2>/dev/null /usr/bin /usr/bin /usr/bin export --verbose export x=1 x=1
+	--verbose "$1" done | export x=1 && grep grep test $(pwd) readonly
+	&& test export --verbose /usr/bin -eu readonly then done 2>/dev/null local
+		test /usr/bin --verbose 'quoted text' printf grep then "$@" readonly ${HOME}
+| then && cd cd test
+'quoted text' test sed echo readonly grep
+	$(pwd) "$@" "$@" done && export local
+| x=1 x=1 sed done export -eu 2>/dev/null then $(pwd) x=1 | x=1
+| export x=1 | test grep awk local "$1" echo "$1" then grep | readonly then 2>/dev/null
+	then -eu done sed 'quoted text' readonly --verbose cd 'quoted text'
+		2>/dev/null export readonly ${HOME} --verbose x=1 ${HOME} 'quoted text'
+		test grep /usr/bin done --verbose test "$@" 2>/dev/null x=1 grep export
+		'quoted text' awk printf $(pwd) --verbose
+	then -eu && "$@" readonly "$1" -eu "$1" "$1" 'quoted text' -eu
+test -eu cd "$@" -eu -eu test 'quoted text'
+		&& --verbose ${HOME} echo ${HOME} $(pwd) ${HOME} 'quoted text' test
+		"$@" "$@" -eu ${HOME} $(pwd) printf | | 'quoted text' grep 2>/dev/null
+		&& grep export test x=1 then
+awk cd | /usr/bin awk 'quoted text' "$@" 2>/dev/null 2>/dev/null 'quoted text'
+cd $(pwd) export ${HOME} 2>/dev/null sed 2>/dev/null --verbose
+		${HOME} printf x=1 2>/dev/null readonly
+	sed readonly cd cd --verbose "$1" sed export ${HOME} done
+	2>/dev/null echo readonly "$@" -eu
+		printf 2>/dev/null done done /usr/bin
+		/usr/bin sed grep grep $(pwd) x=1 $(pwd)
+		${HOME} local cd cd sed grep export "$1" test
+grep then sed /usr/bin 2>/dev/null --verbose
+	"$1" printf echo sed x=1 echo --verbose echo then readonly x=1 sed
+then printf local local
+	--verbose export done $(pwd) printf done export cd test | ${HOME} done
+--verbose sed 'quoted text' local
+local cd readonly test /usr/bin done 'quoted text' ${HOME} $(pwd) "$1"
+		awk ${HOME} 2>/dev/null && readonly
+		${HOME} cd export echo 'quoted text' 2>/dev/null -eu test echo -eu
+cd "$@" 'quoted text' $(pwd) 2>/dev/null x=1 export 2>/dev/null
+awk 2>/dev/null | then 2>/dev/null -eu -eu readonly then
+'quoted text' grep sed local 2>/dev/null awk 'quoted text'
+	echo -eu awk local ${HOME} awk printf /usr/bin done /usr/bin readonly
+	"$@" echo readonly $(pwd) 2>/dev/null
+2>/dev/null 'quoted text' "$@"
+		cd export /usr/bin ${HOME} then -eu sed readonly
+	grep --verbose && -eu 'quoted text' "$1" && local local $(pwd)
+	'quoted text' echo done export test 2>/dev/null
+export | echo cd grep local grep local "$@"
+"$1" -eu sed local cd -eu && "$1" /usr/bin -eu done
+		x=1 readonly "$1" --verbose test 'quoted text' then ${HOME}
+2>/dev/null | export sed sed sed grep | | sed
+	"$1" export "$@" x=1 'quoted text'
+	local cd --verbose --verbose x=1
+		/usr/bin ${HOME} grep && done -eu grep cd x=1 --verbose -eu
+echo test done /usr/bin
+		echo "$@" "$1" echo printf
+		awk grep x=1 test ${HOME} readonly done done 2>/dev/null cd printf "$1" 'quoted text'
+	cd "$1" export 'quoted text' 2>/dev/null
+		-eu awk test | awk 'quoted text'
+		echo ${HOME} echo $(pwd) test
+	done awk echo -eu ${HOME} | 2>/dev/null local echo
+${HOME} done readonly then then $(pwd) 2>/dev/null
+	"$1" && 2>/dev/null done awk then sed export "$@" && test ${HOME} --verbose
+done | 'quoted text' grep cd $(pwd) ${HOME} --verbose readonly x=1 echo | -eu
+	/usr/bin export readonly --verbose done ${HOME}
+	printf ${HOME} x=1 echo printf readonly then awk done "$1" printf | ${HOME} then
+echo | readonly ${HOME} local "$@" "$1" $(pwd) 2>/dev/null
+	readonly 2>/dev/null done then --verbose export | awk --verbose printf
+grep test readonly "$1" sed 2>/dev/null then x=1 && | 2>/dev/null "$@" grep ${HOME}
+	local --verbose grep "$1" grep sed "$1" ${HOME} sed then ${HOME}
+x=1 && x=1 2>/dev/null 'quoted text' /usr/bin -eu ${HOME}
+		done ${HOME} done local sed awk | "$@" ${HOME}
+		x=1 && grep | then && --verbose "$@" done 'quoted text' sed x=1 $(pwd) "$@" /usr/bin
+then echo -eu --verbose local "$@" 2>/dev/null done
+	then ${HOME} printf local export test then "$@" "$1" x=1 awk
+$(pwd) $(pwd) awk sed | $(pwd) 'quoted text' grep "$1"
+	$(pwd) readonly /usr/bin
+		printf /usr/bin test sed x=1 sed "$1" && echo
+export && $(pwd) export "$@" local && $(pwd) sed
+		readonly "$@" sed "$1" -eu /usr/bin x=1 readonly x=1 /usr/bin
+"$@" awk printf 2>/dev/null | ${HOME}
+$(pwd) local local $(pwd) local then "$1" | -eu
+	2>/dev/null export done x=1 ${HOME} --verbose "$1" awk readonly printf
+"$1" awk x=1 "$@" local then && "$1" "$1" -eu $(pwd) export 2>/dev/null
+&& readonly ${HOME} grep | -eu 'quoted text' "$1"
+grep sed readonly $(pwd) && "$@"
+2>/dev/null 2>/dev/null done
+		"$@" -eu awk "$@" 2>/dev/null grep | ${HOME} awk grep 2>/dev/null
+'quoted text' done done 2>/dev/null --verbose
+local "$1" cd 'quoted text'
+		| 2>/dev/null && test done awk export $(pwd) readonly 2>/dev/null ${HOME} ${HOME}
+readonly "$@" "$1" done then x=1 /usr/bin export
+		-eu | readonly cd printf export "$1" "$1" x=1 readonly
+x=1 -eu sed export $(pwd) done export | grep -eu then echo grep grep
+		readonly printf then -eu local cd local
+then 'quoted text' && printf
+x=1 ${HOME} /usr/bin /usr/bin 2>/dev/null done cd local test 2>/dev/null
+		/usr/bin 'quoted text' export $(pwd) ${HOME} $(pwd)
+	done readonly x=1 then "$1" ${HOME} then
+	readonly 'quoted text' cd local test done 'quoted text' readonly
+	/usr/bin /usr/bin && "$1" grep
+/usr/bin -eu | printf cd sed cd grep done cd local done -eu sed printf
+grep test sed -eu ${HOME} done printf export echo --verbose -eu "$1" export
+		"$@" done ${HOME} | ${HOME} sed -eu readonly export printf && | /usr/bin done /usr/bin
+cd local --verbose done | done
+cd 2>/dev/null awk export
+		test awk /usr/bin echo printf readonly sed echo sed "$1" awk -eu
+	$(pwd) then -eu cd 'quoted text' sed sed then test
+		"$1" local -eu -eu x=1 | printf ${HOME} | readonly local --verbose x=1 "$@"
+readonly cd sed 'quoted text' ${HOME}
+		2>/dev/null 2>/dev/null $(pwd) "$1" export
+	-eu grep 2>/dev/null local local readonly $(pwd)
+	"$@" readonly echo "$@" 2>/dev/null | printf cd "$@" printf | "$1" --verbose
+		'quoted text' cd --verbose 2>/dev/null
+2>/dev/null /usr/bin -eu done "$1" grep readonly sed x=1 -eu | cd
+grep printf $(pwd) readonly grep -eu printf done grep --verbose
+${HOME} awk printf 2>/dev/null test done local test
+--verbose "$1" "$1" echo $(pwd) sed "$@" printf grep /usr/bin "$@" /usr/bin
+printf "$1" export && printf "$@" then 2>/dev/null
+	-eu --verbose "$@" $(pwd)
+echo then export cd export readonly
+x=1 test 2>/dev/null "$@" x=1 'quoted text' test test
+	then && $(pwd) done "$@" "$@" $(pwd) $(pwd) test sed 'quoted text' sed --verbose
+awk printf "$1" readonly | 'quoted text' "$@" grep x=1 then "$@" export /usr/bin
+readonly $(pwd) 2>/dev/null -eu test cd x=1 'quoted text' export
+	cd cd local "$@" sed "$1" echo awk 'quoted text'
+	awk 2>/dev/null x=1 $(pwd) 2>/dev/null | local local done readonly
+	test ${HOME} done | $(pwd) sed | /usr/bin
+		x=1 done /usr/bin "$1" grep /usr/bin --verbose /usr/bin sed readonly
+		done sed local readonly cd local 'quoted text' --verbose "$1" $(pwd) local
+		done sed done test then grep --verbose readonly export then 2>/dev/null
+	local 2>/dev/null x=1 test
+		awk "$1" "$@" test awk | awk sed "$@"
+	"$1" | readonly 2>/dev/null 'quoted text' sed &&
+		${HOME} local grep $(pwd)
+	&& -eu -eu then 'quoted text' local
+	2>/dev/null ${HOME} &&
+readonly then /usr/bin "$@" export sed readonly x=1 --verbose sed printf /usr/bin
+	done "$1" then /usr/bin cd printf
+	readonly -eu readonly "$@" readonly $(pwd) 2>/dev/null --verbose
+test sed readonly then ${HOME} --verbose grep done
+		cd "$@" 2>/dev/null -eu export -eu
+		done x=1 awk local ${HOME} | && sed export echo sed $(pwd) /usr/bin | grep ${HOME}
+		"$1" /usr/bin "$@" ${HOME} "$1"
+awk -eu sed "$@" -eu 2>/dev/null cd readonly 2>/dev/null -eu readonly
+	cd 2>/dev/null awk then x=1 grep done && /usr/bin
+x=1 $(pwd) readonly 2>/dev/null /usr/bin 'quoted text'
+x=1 then x=1 then "$@" $(pwd) -eu 'quoted text' sed awk && grep | printf
+		$(pwd) test then cd done -eu $(pwd) $(pwd) awk test local then test echo
+		-eu cd cd sed 'quoted text' 'quoted text' --verbose ${HOME} done 2>/dev/null
+then export awk printf cd
+${HOME} -eu printf export readonly echo && 'quoted text'
+		"$1" then cd echo awk /usr/bin test cd ${HOME}
+cd then ${HOME} /usr/bin
+"$@" awk sed test test 'quoted text' done grep
+		local && /usr/bin cd cd readonly export
+echo 2>/dev/null && ${HOME} grep | /usr/bin --verbose 2>/dev/null
+		local ${HOME} 2>/dev/null -eu "$@" grep 'quoted text' grep test sed /usr/bin echo
+		then --verbose export export cd printf grep readonly test echo
+'quoted text' sed export export $(pwd)
+	echo export cd 'quoted text' 'quoted text'
+	&& $(pwd) grep local printf sed && 2>/dev/null cd 2>/dev/null
+	'quoted text' grep readonly /usr/bin local ${HOME}
+		2>/dev/null awk printf export
+	export 'quoted text' x=1 /usr/bin x=1 2>/dev/null
+	echo cd --verbose grep echo ${HOME} -eu ${HOME} then --verbose
+	local done 'quoted text' local "$@" grep echo
+	export 'quoted text' 2>/dev/null
+/usr/bin $(pwd) then echo echo &&
+${HOME} grep "$1" 2>/dev/null 'quoted text' ${HOME} /usr/bin readonly "$@"
+	done && --verbose sed done
+echo /usr/bin ${HOME} x=1 echo local
+	--verbose $(pwd) --verbose
+		"$1" done local "$@" |
+	/usr/bin | grep test awk awk done "$@" test | test x=1 echo
+		x=1 x=1 | | x=1 then export "$@" then -eu done x=1 readonly
+-eu 2>/dev/null test awk then readonly export sed grep sed -eu "$@" -eu
+awk readonly && then && 'quoted text'
+	done | ${HOME} /usr/bin export x=1 then $(pwd) 2>/dev/null
+test awk then -eu test --verbose $(pwd) $(pwd) then x=1 done grep /usr/bin
+	echo done local && printf awk
+	cd | done /usr/bin x=1 readonly printf ${HOME} printf done done $(pwd)
+done echo --verbose ${HOME} | grep $(pwd) readonly $(pwd)
+/usr/bin readonly grep readonly grep ${HOME} /usr/bin -eu 2>/dev/null
+		then test | readonly test $(pwd) test "$1" awk 'quoted text' 'quoted text'
+x=1 done local "$@" 2>/dev/null
+	$(pwd) ${HOME} then readonly awk -eu sed 2>/dev/null
+'quoted text' 2>/dev/null && sed | && sed test awk sed 'quoted text' 2>/dev/null
+'quoted text' ${HOME} "$@" $(pwd) "$1" x=1 sed test 'quoted text'
+	"$1" -eu done "$@" cd x=1 -eu test ${HOME} test printf -eu
+	export /usr/bin sed printf test --verbose "$@" grep awk readonly ${HOME}
+		| readonly --verbose -eu /usr/bin cd
+	x=1 x=1 local awk sed echo ${HOME} local /usr/bin | $(pwd) && x=1
+--verbose printf 'quoted text'
+		$(pwd) "$@" test 2>/dev/null x=1 echo "$@" "$1" | 2>/dev/null && x=1
+		"$@" test test 'quoted text' readonly printf echo printf --verbose export
+		2>/dev/null sed printf | x=1 echo grep 'quoted text'
+		${HOME} "$1" local "$1" "$1" 2>/dev/null 'quoted text' 2>/dev/null
+		readonly /usr/bin $(pwd) grep /usr/bin cd export printf | -eu && echo --verbose
+awk $(pwd) x=1 echo /usr/bin cd | readonly then
+		awk $(pwd) local 'quoted text' -eu awk export
+		| "$@" test 2>/dev/null "$1" -eu local echo export
+		2>/dev/null -eu export echo grep
+$(pwd) 2>/dev/null 2>/dev/null 'quoted text'
+readonly awk -eu $(pwd) 2>/dev/null awk x=1 export
+	2>/dev/null 2>/dev/null export "$1" export --verbose "$1" awk
+/usr/bin 'quoted text' test local 2>/dev/null cd grep $(pwd)
+	"$1" awk $(pwd) export -eu /usr/bin readonly ${HOME} && |
+	readonly "$@" done then
+test local -eu | --verbose ${HOME} /usr/bin 'quoted text' local
+sed ${HOME} ${HOME} then ${HOME} && | -eu $(pwd) $(pwd) local
+	&& --verbose grep local -eu && -eu | "$@"
+		echo | 2>/dev/null printf 2>/dev/null readonly ${HOME} sed
+--verbose && --verbose local ${HOME}
+local 2>/dev/null then export echo --verbose | test then awk then
+	x=1 printf ${HOME} ${HOME} /usr/bin
+/usr/bin | then --verbose done
+	"$1" | --verbose --verbose $(pwd) test test
+sed echo "$1" -eu then sed readonly cd export printf
+	grep "$@" /usr/bin done done readonly --verbose | grep | export
+	-eu 2>/dev/null -eu test ${HOME} "$1" 2>/dev/null x=1 grep then awk
+test && printf export $(pwd) x=1 local $(pwd) awk 2>/dev/null -eu
+		2>/dev/null --verbose readonly
+$(pwd) | && grep /usr/bin awk awk -eu x=1 "$1" $(pwd)
+		'quoted text' /usr/bin grep
+		sed x=1 /usr/bin ${HOME} /usr/bin
+	x=1 && echo printf && -eu grep $(pwd) && ${HOME}
+	export ${HOME} then echo grep | | echo x=1 2>/dev/null
+	echo export awk 2>/dev/null
+test grep local $(pwd) ${HOME} --verbose printf
+	export local export awk printf ${HOME} readonly
+		grep -eu printf sed echo 2>/dev/null 2>/dev/null test printf sed export
+	then && | "$@" 'quoted text' readonly
+		| --verbose | local grep
+local cd --verbose ${HOME} printf
+test $(pwd) awk then local then test "$1" export readonly
+		sed awk $(pwd) ${HOME} local awk export 'quoted text'
+	/usr/bin done $(pwd) cd then sed
+	done "$@" && test test printf done &&
+	${HOME} "$@" printf "$1" local done awk cd printf ${HOME} export cd /usr/bin
+	grep cd cd $(pwd) | export "$1" 'quoted text' 'quoted text'
+--verbose x=1 | printf sed
+	grep export 2>/dev/null
+		cd | readonly "$@" -eu sed
+--verbose readonly sed x=1 local
+		"$1" x=1 readonly $(pwd)
+	--verbose --verbose export -eu export
+cd 'quoted text' 'quoted text' cd $(pwd)
+| && cd awk 'quoted text' x=1 export "$@" test local export x=1 /usr/bin
+awk /usr/bin $(pwd) cd then export
+&& "$1" x=1 then echo test cd /usr/bin "$@" local 2>/dev/null
+	done echo -eu export 2>/dev/null
+		--verbose "$@" cd echo && "$@" sed "$@" /usr/bin
+x=1 printf 'quoted text' sed -eu local local -eu --verbose
+"$1" x=1 "$1" test readonly 2>/dev/null export echo 'quoted text' 'quoted text'
+	then "$1" "$@" done done $(pwd) export then grep grep
+awk ${HOME} /usr/bin | readonly -eu x=1 'quoted text' | sed
+		"$1" sed grep sed export awk local "$@" done done then test
+	local "$1" readonly $(pwd) && 2>/dev/null ${HOME} /usr/bin "$1" x=1 test test
+		--verbose 2>/dev/null 'quoted text'
+		done then printf ${HOME} /usr/bin export $(pwd) /usr/bin --verbose $(pwd) local
+cd --verbose test done grep local local | grep /usr/bin "$1" | "$@" local
+--verbose 2>/dev/null sed cd 2>/dev/null --verbose export x=1
+		--verbose 'quoted text' sed sed --verbose done awk done | sed printf --verbose
+		x=1 test export export done test && done --verbose grep
+		'quoted text' /usr/bin cd sed cd export readonly
+		readonly $(pwd) printf $(pwd) 'quoted text' sed "$@"
+		awk grep "$@" "$1" sed && -eu && readonly 'quoted text' "$@" echo awk then
+		test x=1 printf "$1" grep "$@" done readonly
+		echo local export "$@" | printf ${HOME} 2>/dev/null awk 2>/dev/null test "$1" awk
+		--verbose -eu && export test && then printf "$1" && printf then
+	$(pwd) cd echo echo | "$@" export /usr/bin /usr/bin $(pwd) printf
+		$(pwd) && readonly ${HOME} "$@" $(pwd) ${HOME}
+'quoted text' local ${HOME} cd && ${HOME} /usr/bin export 2>/dev/null
+	&& sed --verbose && 2>/dev/null --verbose x=1 grep test "$@" awk printf
+		awk $(pwd) done ${HOME} && printf
+2>/dev/null -eu grep "$@" echo 'quoted text' x=1 $(pwd) then
+		awk done "$@" --verbose test awk local && sed -eu readonly ${HOME} test export
+	-eu -eu "$@" cd then cd cd echo -eu readonly echo ${HOME} then
+		"$@" readonly readonly
+		"$@" 'quoted text' -eu cd done "$1" -eu x=1 x=1 x=1 grep "$@" cd local
+		"$1" sed test sed sed awk
+| awk printf awk readonly sed 'quoted text' cd -eu 2>/dev/null
+		&& $(pwd) --verbose -eu export test ${HOME}
+	local "$1" --verbose | /usr/bin "$1" then done --verbose
+	awk && | -eu --verbose x=1 "$@" --verbose
+	printf done awk test /usr/bin sed 2>/dev/null "$1" export cd 2>/dev/null "$1"
+	printf test /usr/bin cd
+--verbose x=1 export ${HOME} sed grep /usr/bin
+${HOME} local 'quoted text' &&
+	then export printf printf export local
+	2>/dev/null sed done "$1" x=1 then | export | export
+	"$@" printf 'quoted text' --verbose x=1 ${HOME}
+		then cd "$1" local echo 'quoted text'
+	printf 'quoted text' echo 'quoted text'
+	$(pwd) ${HOME} && readonly | ${HOME} && test x=1 2>/dev/null printf local
+awk awk | -eu 'quoted text' test echo grep local readonly -eu
+$(pwd) $(pwd) awk sed grep local readonly -eu
+echo "$1" && test echo
+	&& cd $(pwd) grep ${HOME}
+	export local export cd && | echo test | awk --verbose
+test 2>/dev/null sed && printf printf /usr/bin
+		| export -eu | | x=1 local test 2>/dev/null 'quoted text' "$@" grep 'quoted text'
+		${HOME} ${HOME} export "$1" -eu $(pwd) "$1" printf echo then printf
+		${HOME} && 'quoted text' -eu x=1 grep
+	cd | then test 2>/dev/null --verbose
+		'quoted text' "$1" 'quoted text' local -eu echo /usr/bin 'quoted text'
+	test 'quoted text' printf printf export readonly grep echo /usr/bin "$1" "$@"
+		grep "$1" /usr/bin test readonly 2>/dev/null
+	-eu -eu sed 'quoted text' $(pwd) sed sed 'quoted text' echo grep grep &&
+		readonly "$1" $(pwd) echo echo "$@" /usr/bin && -eu awk cd local "$@" "$1"
+		'quoted text' "$1" $(pwd) 2>/dev/null grep sed $(pwd)
+echo grep awk ${HOME} awk grep test readonly readonly /usr/bin awk export "$1"
+		"$1" 'quoted text' cd done /usr/bin
+	echo then awk cd ${HOME} echo printf done | grep -eu echo local
+		local grep then && "$1" readonly && grep echo "$@" grep
+	test echo then local printf ${HOME} ${HOME} local | | readonly echo |
+awk | done printf readonly done $(pwd)
+"$@" x=1 done then awk $(pwd) 'quoted text' 'quoted text' grep printf echo
+		2>/dev/null cd grep 'quoted text' x=1
+	"$@" export "$1" then done "$1" export x=1 sed /usr/bin x=1 $(pwd) "$@" /usr/bin
+readonly awk test "$1" awk test /usr/bin printf echo local -eu ${HOME}
+		echo then test ${HOME} -eu sed | done 2>/dev/null awk | cd readonly $(pwd) -eu
+	export done "$@" -eu "$@" echo $(pwd) $(pwd)
+		echo then then sed export readonly grep | "$@" cd cd local
+	$(pwd) awk printf test test /usr/bin 2>/dev/null done $(pwd) "$@" "$1" test
+then --verbose 'quoted text' readonly | then -eu /usr/bin echo ${HOME} 'quoted text'
+readonly echo "$@" ${HOME} ${HOME} test 'quoted text' |
+		&& local -eu cd ${HOME} readonly sed 2>/dev/null
+	"$1" readonly awk local printf
+		$(pwd) echo && /usr/bin sed then readonly echo local printf test cd sed readonly
+	awk | && echo done local sed --verbose readonly
+	printf then && grep local -eu ${HOME} awk echo
+		sed done test -eu ${HOME} | cd 2>/dev/null $(pwd) grep
+printf printf 2>/dev/null /usr/bin readonly
+printf | then | test "$@" local 2>/dev/null ${HOME} echo cd --verbose
+&& then 'quoted text' ${HOME}
+		cd local export cd && 'quoted text'
+--verbose printf "$@" awk then test echo local awk --verbose grep --verbose "$1"
+"$1" test && export && ${HOME} "$1" && $(pwd) readonly "$1"
+	done echo && && 'quoted text' $(pwd) test printf
+		sed /usr/bin && done 2>/dev/null ${HOME} local awk echo then echo ${HOME}
+	--verbose /usr/bin printf 'quoted text' grep
+		sed && test -eu 'quoted text' then readonly && --verbose
+export 'quoted text' 'quoted text'
+		grep ${HOME} test && 2>/dev/null export
+sed local sed | cd echo readonly echo done cd echo
+x=1 done local $(pwd) local $(pwd)
+		--verbose $(pwd) $(pwd) grep readonly /usr/bin export
+	sed "$@" test -eu test readonly test grep test | 'quoted text' export test ${HOME}
+"$@" local "$@" x=1 readonly 'quoted text'
+		${HOME} 'quoted text' 'quoted text' 'quoted text' 2>/dev/null "$1" grep then
+| local readonly cd -eu local grep 'quoted text' local export
+		${HOME} awk x=1 then grep x=1 printf local
+done local then awk ${HOME} "$@" test ${HOME} done $(pwd) "$1"
+cd 2>/dev/null local sed | echo cd then && grep printf | export
+		local ${HOME} cd cd 2>/dev/null 'quoted text' cd && 'quoted text'
+		cd echo sed 2>/dev/null | x=1 awk
+	${HOME} x=1 "$1" $(pwd) printf cd $(pwd) --verbose printf
+sed ${HOME} printf done
+		test cd local "$@" awk "$1" /usr/bin /usr/bin sed 'quoted text'
+		sed && awk -eu export $(pwd) done cd --verbose
+		&& sed && x=1 printf cd "$@" grep --verbose x=1
+	echo /usr/bin 'quoted text' test --verbose
+then ${HOME} export "$@"
+echo /usr/bin export ${HOME} sed "$1" sed then && && "$1" printf && done
+$(pwd) then sed echo 2>/dev/null test $(pwd)
+	'quoted text' ${HOME} then | /usr/bin
+test echo x=1 then printf 'quoted text'
+	local /usr/bin export x=1 sed 2>/dev/null
+echo "$1" /usr/bin readonly | $(pwd) -eu cd local ${HOME} readonly local grep
+		printf printf sed "$1" test $(pwd) test "$@" --verbose x=1
+		"$@" sed then $(pwd) sed $(pwd)
+		${HOME} | awk done 2>/dev/null
+		&& done test test done ${HOME} awk done grep -eu | | --verbose -eu
+x=1 export -eu export awk $(pwd) then test done /usr/bin
+		readonly && local echo | -eu readonly ${HOME} sed && test cd $(pwd) awk
+| test 2>/dev/null done done done /usr/bin "$@" awk 'quoted text' done | awk
+${HOME} /usr/bin done $(pwd) $(pwd) sed $(pwd) /usr/bin
+	done -eu $(pwd) grep test && --verbose local | x=1 /usr/bin grep ${HOME}
+	--verbose "$1" echo | ${HOME} /usr/bin | ${HOME}
+&& "$1" export -eu $(pwd) 'quoted text'
+	done done --verbose printf printf "$@" -eu ${HOME} --verbose
+	echo then && 2>/dev/null && then awk local "$@" then
+-eu -eu "$1" done "$@" 2>/dev/null ${HOME}
+	local printf $(pwd) printf 2>/dev/null | readonly printf printf 2>/dev/null then
+/usr/bin printf "$1" grep ${HOME} readonly -eu sed awk "$@" /usr/bin echo | printf
+readonly | x=1 --verbose sed then x=1 sed 2>/dev/null grep
+readonly "$1" awk readonly ${HOME} $(pwd) done done local
+		'quoted text' echo printf -eu printf export
+printf x=1 | echo x=1 "$1" sed test -eu export
+readonly then "$@" ${HOME} sed -eu
+		then 'quoted text' $(pwd) awk 2>/dev/null cd cd done then grep | awk
+		awk printf readonly awk x=1 local 2>/dev/null test 2>/dev/null
+${HOME} x=1 | sed done x=1 then local --verbose echo /usr/bin test x=1
+	readonly $(pwd) | --verbose
+cd done local --verbose --verbose awk then | -eu test echo "$1"
+		then 'quoted text' sed cd && then "$@" local "$1" printf
+		'quoted text' -eu 'quoted text' 'quoted text' echo && done grep
+		'quoted text' echo test awk "$@" printf && readonly readonly
+	grep -eu then cd ${HOME} ${HOME} 2>/dev/null && $(pwd)
+		echo test --verbose | "$1" awk echo ${HOME} awk | readonly printf
+	"$1" ${HOME} awk "$@" sed readonly cd done
+	/usr/bin done 2>/dev/null 'quoted text'
+/usr/bin printf done | 2>/dev/null ${HOME}
+	x=1 grep cd 2>/dev/null $(pwd) 'quoted text' && "$1" local echo 'quoted text'
+		${HOME} readonly $(pwd) readonly $(pwd) echo | ${HOME} --verbose
+		export -eu then sed printf test
+then 'quoted text' local 'quoted text'
+/usr/bin x=1 $(pwd) x=1 --verbose sed && --verbose echo grep echo 2>/dev/null
+	${HOME} 'quoted text' 2>/dev/null "$@" | readonly | printf sed -eu ${HOME}
+	-eu --verbose cd --verbose -eu 'quoted text'
+	x=1 grep grep test export | cd $(pwd)
+	cd local export "$@" -eu /usr/bin ${HOME}
+--verbose $(pwd) local 'quoted text' "$1" --verbose && x=1 'quoted text'
+		printf test "$1" --verbose 'quoted text' 2>/dev/null
+	$(pwd) && && "$@" --verbose "$1" sed printf x=1 readonly
+readonly sed && ${HOME} done 'quoted text'
+	"$@" grep $(pwd) grep 'quoted text' --verbose cd
+		grep test awk | /usr/bin --verbose -eu awk $(pwd) "$1" x=1
+	sed ${HOME} printf printf then grep x=1 -eu
+--verbose awk /usr/bin awk /usr/bin && x=1 x=1 $(pwd) "$@" sed sed
+	${HOME} /usr/bin /usr/bin
+	/usr/bin sed grep then echo -eu 2>/dev/null
+		done grep x=1 ${HOME} printf cd then -eu ${HOME}
+&& local local then readonly 2>/dev/null test 'quoted text' cd readonly --verbose
+	2>/dev/null /usr/bin cd awk
+then printf awk ${HOME} $(pwd) done 'quoted text' sed test 2>/dev/null --verbose
+		-eu /usr/bin "$1" "$1" -eu && "$@"
+cd 2>/dev/null 'quoted text' "$1" $(pwd) local
+		done cd cd readonly | printf
+printf local sed ${HOME} $(pwd) --verbose ${HOME}
+		"$1" 'quoted text' readonly ${HOME} 'quoted text'
+		echo awk | && /usr/bin | cd local 'quoted text' && test
+		'quoted text' --verbose /usr/bin cd
+		"$@" printf ${HOME} /usr/bin /usr/bin grep | then -eu
+&& grep local grep x=1 local && then export "$@" printf test awk $(pwd) grep
+		&& ${HOME} && "$@" "$1" $(pwd) 2>/dev/null
+sed grep sed then test test
+	sed "$@" grep x=1 2>/dev/null export local && test sed $(pwd) && test
+	-eu "$1" | && && printf readonly grep && readonly /usr/bin then ${HOME} &&
+&& sed printf | "$1" cd "$@" grep test /usr/bin grep test echo &&
+	test x=1 sed x=1 grep && done | test
+	then sed then && /usr/bin cd x=1 | then ${HOME}
+-eu done printf done "$1" then
+	$(pwd) --verbose ${HOME}
+/usr/bin then echo | readonly
+	printf x=1 "$1" awk 'quoted text' 'quoted text'
+		awk grep test echo sed 2>/dev/null then grep ${HOME}
+	x=1 grep awk x=1 "$1" printf export ${HOME} ${HOME} | "$@"
+	${HOME} grep x=1 grep
+		/usr/bin | "$@" echo -eu local -eu export 'quoted text'
+"$@" x=1 sed cd -eu && printf 2>/dev/null $(pwd) grep | /usr/bin export ${HOME}
+		/usr/bin echo | | && -eu awk test "$1"
+"$1" cd "$1" /usr/bin sed
+		done x=1 test x=1 | /usr/bin local
+		'quoted text' awk cd export "$1" --verbose "$@" --verbose test done
+$(pwd) x=1 && $(pwd) sed "$1" "$1" done
+printf ${HOME} echo echo grep echo
+		2>/dev/null | | then done -eu echo
+		done | x=1 sed echo $(pwd) x=1 echo printf x=1 ${HOME} then readonly "$1" $(pwd)
+	/usr/bin done export test --verbose grep local local printf -eu
+		grep then | /usr/bin printf echo
+	cd | $(pwd) $(pwd) "$@"
+&& 'quoted text' $(pwd) sed "$1" cd local then
+awk readonly export 2>/dev/null
+x=1 | ${HOME} sed grep && 'quoted text' $(pwd) cd && test -eu cd cd 'quoted text'
+	&& && -eu export grep "$@" -eu grep && 2>/dev/null
+	echo $(pwd) "$@" "$1" export && sed
+		x=1 sed "$1" --verbose --verbose 2>/dev/null "$@" && readonly
+	${HOME} echo "$@" local done -eu "$1" echo then "$1" then awk printf $(pwd)
+x=1 'quoted text' ${HOME} 2>/dev/null ${HOME} -eu x=1 /usr/bin && $(pwd) ${HOME}
+		awk -eu done grep $(pwd) export && done
+	awk /usr/bin ${HOME} "$1" then local 2>/dev/null echo cd grep
+		printf 2>/dev/null printf x=1 2>/dev/null echo grep | cd readonly 'quoted text'
+| done /usr/bin ${HOME} x=1 | "$1" "$@" export
+$(pwd) $(pwd) -eu done 2>/dev/null test 'quoted text' readonly sed /usr/bin then
+	cd echo /usr/bin echo 'quoted text' echo ${HOME} then export local
+readonly test sed test x=1 -eu "$@" printf ${HOME}
+	'quoted text' printf readonly done 'quoted text' local 'quoted text'
+		then done then "$1" export readonly export echo | "$1" readonly
+printf --verbose readonly readonly local $(pwd) ${HOME} && $(pwd)
+		done 'quoted text' $(pwd) | 2>/dev/null 2>/dev/null "$@" 'quoted text' local
+| ${HOME} "$1" grep printf -eu sed local grep cd then --verbose cd
+		2>/dev/null $(pwd) /usr/bin "$1" ${HOME} /usr/bin echo test "$1" local sed 2>/dev/null
+"$1" /usr/bin export export "$@" -eu
+	2>/dev/null sed cd 2>/dev/null
+awk done printf grep && -eu printf -eu x=1 $(pwd) local x=1 | readonly export echo
+	"$@" readonly | "$@" 'quoted text' sed readonly
+		${HOME} ${HOME} -eu "$@" ${HOME} "$@" 'quoted text' | 2>/dev/null
+		test x=1 -eu then && 'quoted text' done 2>/dev/null "$@" --verbose test
+	x=1 && | && cd then done local ${HOME}
+sed | grep "$@" -eu readonly export done 'quoted text' 2>/dev/null
+"$@" ${HOME} printf awk local $(pwd) local echo done "$1"
+cd awk 'quoted text' --verbose
+awk | --verbose readonly echo done ${HOME} 2>/dev/null x=1 test 'quoted text'
+then test /usr/bin done readonly then
+	sed --verbose /usr/bin $(pwd)
+		2>/dev/null /usr/bin
+	grep export printf | then /usr/bin awk done $(pwd) readonly ${HOME}
+		echo x=1 then export "$@" echo sed printf grep -eu "$@" grep | echo cd "$1" printf
+	test printf --verbose sed "$@" test
+grep 2>/dev/null "$@" local "$@" 'quoted text' "$@" --verbose -eu grep
+		grep test -eu $(pwd) then -eu ${HOME} sed "$@" | "$@" then printf
+	then $(pwd) "$1" $(pwd)
+		readonly export awk then export grep "$1" sed test readonly awk
+		printf grep export "$1" &&
+	${HOME} --verbose "$1" "$@" test && $(pwd) test x=1 sed /usr/bin x=1 2>/dev/null
+then cd -eu grep cd /usr/bin readonly test
+	2>/dev/null -eu readonly
+sed printf grep echo sed local ${HOME}
+		${HOME} x=1 --verbose x=1 grep
+		sed test /usr/bin grep done done 'quoted text' --verbose
+printf ${HOME} && $(pwd)
+-eu /usr/bin && && echo /usr/bin 'quoted text' ${HOME} && x=1 echo
+		sed printf /usr/bin "$@" 'quoted text'
+		$(pwd) local local x=1 local && --verbose then "$1" $(pwd) "$1" --verbose done
+sed awk 'quoted text' 'quoted text' then cd
+		$(pwd) readonly test then $(pwd) && 'quoted text' printf awk "$@" readonly then
+&& 2>/dev/null --verbose local $(pwd) --verbose && printf | ${HOME} done
+	then awk x=1 test "$@" ${HOME} echo export -eu echo printf sed /usr/bin
+		${HOME} $(pwd) local test "$1" && awk done cd readonly cd /usr/bin done
+2>/dev/null | && then | readonly printf "$@" -eu echo printf ${HOME}
+	"$1" sed /usr/bin $(pwd) 2>/dev/null grep echo awk
+		| ${HOME} 2>/dev/null | "$1" done export --verbose
+| awk readonly && --verbose $(pwd) && 2>/dev/null
+	'quoted text' grep awk x=1 local | --verbose readonly
+		awk awk sed echo "$1" "$@" grep ${HOME} "$1" && && cd "$1"
+		&& printf then && awk test 'quoted text'
+"$@" test grep then readonly $(pwd) --verbose grep
+		-eu echo -eu x=1 awk test "$@" test then --verbose --verbose "$1" $(pwd) then
+		cd done --verbose 2>/dev/null | local /usr/bin
+echo done export readonly printf grep echo
+		printf $(pwd) printf test
+		-eu 2>/dev/null awk readonly
+		'quoted text' then | ${HOME} awk 'quoted text'
+	"$1" | x=1 cd "$1" local test export 2>/dev/null local "$1" --verbose
+	"$@" $(pwd) then then sed
+printf printf --verbose && cd
+	readonly sed cd grep /usr/bin x=1 --verbose /usr/bin "$1" 2>/dev/null
+readonly /usr/bin grep echo grep test ${HOME} then x=1 local 'quoted text'
+		awk printf --verbose -eu done test grep sed /usr/bin
+		local "$@" then done ${HOME} awk 'quoted text'
+		-eu printf "$@" grep 2>/dev/null awk printf --verbose $(pwd) cd x=1 echo export
+	local "$1" awk "$@" "$1" 'quoted text' done "$@" printf readonly 'quoted text'
+sed done && awk -eu x=1 "$@" ${HOME} export grep
+	"$1" awk --verbose 'quoted text' && awk x=1 then printf /usr/bin local 2>/dev/null
+export -eu sed 'quoted text' ${HOME} -eu $(pwd) grep export
+		cd ${HOME} printf readonly sed cd printf -eu test export 'quoted text' --verbose
+	echo test readonly done ${HOME} local | x=1 && done awk grep x=1
+		grep "$1" ${HOME} local "$@" printf "$@" export
+readonly | "$1" 'quoted text'
+		"$@" grep awk readonly /usr/bin
+	--verbose echo printf printf
+-eu export "$@" $(pwd) 'quoted text' x=1 grep 'quoted text' printf readonly
+		local then x=1 -eu printf
+$(pwd) test && && | ${HOME} x=1 readonly
+		local "$1" then local grep x=1 $(pwd)
+$(pwd) export done readonly echo grep printf sed sed -eu echo "$1" 2>/dev/null "$1"
+"$@" local && readonly ${HOME} export $(pwd) "$@" /usr/bin export test echo test
+		cd cd /usr/bin /usr/bin 2>/dev/null $(pwd) local && local sed awk test
+		echo readonly | grep 'quoted text'
+awk "$1" -eu grep "$1" --verbose readonly
+		/usr/bin grep grep readonly $(pwd) test sed readonly
+	'quoted text' "$@" echo 2>/dev/null ${HOME} "$@" 'quoted text' printf awk done
+x=1 -eu "$@" x=1 printf $(pwd) "$@" then
+	sed -eu "$1" "$1" local 2>/dev/null export awk --verbose then test local
+	--verbose done readonly /usr/bin $(pwd) grep 'quoted text'
+-eu x=1 export readonly
+		sed ${HOME} 2>/dev/null echo local export ${HOME}
+		then "$@" local local test test export ${HOME} done local readonly test grep
+$(pwd) sed ${HOME} export ${HOME} -eu cd "$@" awk sed awk --verbose
+${HOME} "$@" sed awk local sed then 2>/dev/null
+		&& /usr/bin 2>/dev/null && "$1" x=1 test local --verbose ${HOME}
+	sed "$1" "$@" /usr/bin awk sed awk echo done grep sed && /usr/bin awk 2>/dev/null
+		'quoted text' test done "$1" printf printf ${HOME} echo -eu ${HOME} ${HOME}
+done $(pwd) test && done
+		&& "$1" local export $(pwd) $(pwd) | && awk 2>/dev/null 2>/dev/null cd
+then done awk export printf 2>/dev/null
+		&& x=1 sed "$@" echo -eu "$@" awk then
+		sed $(pwd) export 'quoted text' cd $(pwd) cd sed sed grep test cd && $(pwd)
+2>/dev/null | $(pwd) done
+		${HOME} -eu --verbose cd && "$1" -eu then awk
+		| -eu then then export -eu readonly cd grep done grep cd sed -eu -eu && echo
+	-eu 'quoted text' ${HOME} done grep awk sed sed "$1" printf x=1 echo
+		"$@" export "$@" cd 'quoted text' local then && "$1" -eu sed --verbose
+&& 2>/dev/null && $(pwd) -eu test cd && "$1"
+"$1" && -eu 'quoted text' | 2>/dev/null
+awk "$1" awk readonly --verbose 2>/dev/null /usr/bin awk awk export grep "$1"
+	2>/dev/null --verbose export local readonly
+x=1 -eu x=1 && -eu cd "$1"
+"$1" sed export echo -eu cd /usr/bin
+	printf then "$1" then 2>/dev/null
+"$1" "$1" then echo readonly
+	grep readonly x=1 awk $(pwd) --verbose test local -eu -eu echo then awk readonly
+		printf sed x=1 cd printf
+echo && /usr/bin cd $(pwd) grep printf
+		&& local 2>/dev/null test x=1 2>/dev/null ${HOME} test ${HOME} printf cd
+2>/dev/null grep | readonly ${HOME} cd x=1 2>/dev/null done
+cd printf cd -eu cd && done
+	test done "$@" export 2>/dev/null -eu
+&& printf readonly echo --verbose cd --verbose
+	test done printf ${HOME} printf export awk && then 'quoted text'
+	awk cd done cd 'quoted text' 2>/dev/null "$@" export
+	readonly | grep && 2>/dev/null local
+		local | readonly ${HOME} done ${HOME} then ${HOME} && x=1
+		awk echo test awk | then printf 'quoted text'
+	sed readonly readonly readonly then
+export --verbose "$@" 'quoted text' local | $(pwd) /usr/bin awk readonly awk
+&& x=1 grep test done readonly export "$1" ${HOME} grep
+		&& 'quoted text' readonly grep
+&& readonly 'quoted text' | | | "$1" ${HOME} readonly local
+/usr/bin 'quoted text' ${HOME}
+cd readonly sed test echo done 2>/dev/null
+	&& /usr/bin printf local readonly 2>/dev/null done /usr/bin awk && x=1 x=1
+	-eu test awk printf --verbose --verbose
+	$(pwd) 'quoted text' awk --verbose --verbose sed awk sed echo test
+		${HOME} export && cd | sed printf test
+2>/dev/null x=1 export "$1" ${HOME} 2>/dev/null
+		| $(pwd) 2>/dev/null 'quoted text' done "$1" "$@"
+		cd sed && /usr/bin --verbose -eu test export local 'quoted text' "$@" $(pwd)
+	--verbose -eu sed cd
+		2>/dev/null 'quoted text' $(pwd) && echo
+		test $(pwd) done done printf $(pwd) $(pwd) "$1" grep /usr/bin
+		-eu grep export export $(pwd) export "$@" done test test x=1
+	cd --verbose readonly test x=1 "$@" | /usr/bin sed local "$@" test awk
+		test echo ${HOME} then done test printf printf
+		"$@" sed export export ${HOME}
+		test cd /usr/bin | 'quoted text' "$1" 'quoted text' export 'quoted text'
+	done "$@" local test readonly done "$1" --verbose
+		cd cd /usr/bin $(pwd) readonly x=1 echo test 2>/dev/null
+		$(pwd) echo then --verbose echo test then ${HOME} -eu readonly
+		-eu -eu sed readonly awk -eu "$@" cd && 'quoted text' "$1"
+		"$@" printf 2>/dev/null 'quoted text' "$@" export "$1" test 'quoted text'
+echo $(pwd) sed local cd -eu local grep grep --verbose $(pwd) ${HOME} $(pwd)
+	sed readonly 2>/dev/null 2>/dev/null
+	grep then grep && && printf test export done awk -eu 'quoted text' 'quoted text'
+export --verbose -eu local echo | "$@" && echo -eu | x=1 test
+local done done "$@" local
+	--verbose cd "$@" then echo
+	${HOME} echo /usr/bin then "$@" "$@" | "$@" x=1 grep test 'quoted text' cd grep
+done 'quoted text' awk local export then x=1 x=1 /usr/bin x=1 done readonly
+cd "$1" printf export 'quoted text'
+	readonly sed ${HOME} printf
+		test awk -eu echo ${HOME} 'quoted text'
+echo grep | 'quoted text' awk /usr/bin echo grep 2>/dev/null
+	local cd -eu local grep sed -eu
+2>/dev/null printf $(pwd) printf awk "$@" done
+awk then ${HOME} -eu $(pwd) readonly 2>/dev/null
+		x=1 sed "$1" 'quoted text' then
+	printf ${HOME} sed && then x=1 "$1" "$@" sed
+-eu then cd 'quoted text' | readonly ${HOME} "$@" -eu "$@"
+	--verbose "$1" grep export cd awk echo
+		export export 'quoted text' /usr/bin sed sed | grep export done -eu /usr/bin
+		${HOME} 'quoted text' && readonly x=1 readonly /usr/bin readonly
+		&& then printf local 2>/dev/null
+'quoted text' /usr/bin then
+	${HOME} sed export 'quoted text' test -eu printf test awk -eu cd test grep
+		x=1 "$@" sed then 'quoted text' | 'quoted text'
+	--verbose x=1 && printf awk cd
+$(pwd) | -eu local printf | /usr/bin
+grep local sed 2>/dev/null
+echo then "$1" sed x=1 --verbose && done 'quoted text'
+/usr/bin echo 'quoted text' readonly -eu
+		--verbose done printf /usr/bin "$1" "$1" 2>/dev/null x=1 $(pwd) --verbose
+	/usr/bin 'quoted text' local
+	local printf $(pwd) awk "$@" awk 'quoted text' test ${HOME} --verbose
+&& $(pwd) echo test x=1 test echo local awk local x=1 awk awk --verbose sed
+	export cd readonly 'quoted text' --verbose
+sed echo "$1" 2>/dev/null 2>/dev/null x=1 local awk cd "$1" printf 'quoted text'
+printf test --verbose "$@" test --verbose
+	&& $(pwd) local | echo 2>/dev/null "$1" readonly
+		x=1 && 2>/dev/null && cd awk 2>/dev/null
+/usr/bin x=1 test export 2>/dev/null cd && sed -eu then x=1 --verbose grep
+readonly x=1 readonly sed printf | awk x=1 grep local "$@"
+		"$@" | "$1" echo ${HOME} printf echo "$1" echo then test ${HOME} | then x=1 echo
+then test echo done 2>/dev/null "$@" ${HOME} awk 2>/dev/null readonly
+cd local --verbose awk cd export $(pwd) cd echo | "$@" "$1" awk
+		2>/dev/null grep ${HOME} --verbose
+	grep then grep && /usr/bin x=1 then && --verbose cd local local sed cd awk
+	test done grep && 'quoted text'
+&& -eu test done $(pwd) export printf grep then "$1" ${HOME}
+		-eu export readonly ${HOME} printf
+	$(pwd) | $(pwd) sed local
+		readonly --verbose x=1 echo /usr/bin test test /usr/bin --verbose then sed 2>/dev/null
+		-eu test awk test export then grep -eu ${HOME} "$@" "$1"
+		2>/dev/null -eu readonly "$1" readonly done "$1" export echo "$1"
+"$1" echo readonly local readonly readonly
+'quoted text' x=1 local "$1" x=1 --verbose 'quoted text' "$1" 2>/dev/null
+readonly printf echo grep done
+		| ${HOME} && /usr/bin sed
+		grep awk local grep | then local awk export $(pwd)
+		${HOME} readonly readonly
+	readonly 'quoted text' test export x=1 done cd echo x=1 cd
+local $(pwd) printf echo 'quoted text' sed && printf local --verbose
+	echo done done x=1 ${HOME} echo grep
+sed 'quoted text' "$@" echo && "$1" 'quoted text' && then readonly
+&& /usr/bin printf "$@" && printf
+test "$@" sed x=1 x=1 -eu ${HOME} "$1" /usr/bin &&
+	sed grep export 'quoted text' test printf /usr/bin "$@" test sed export echo
+		cd | printf $(pwd) readonly
+/usr/bin -eu readonly printf done x=1 printf 'quoted text'
+	test then && awk test $(pwd) | done && ${HOME}
+grep grep then -eu x=1 ${HOME}
+	grep sed ${HOME} done then grep local $(pwd) && "$1" ${HOME}
+'quoted text' readonly ${HOME}
+then done then grep readonly $(pwd) then "$@" && 2>/dev/null grep printf
+		printf x=1 grep echo "$1" grep local local ${HOME}
+		| test then test && awk cd awk ${HOME} ${HOME} --verbose ${HOME} -eu | echo
+	export 'quoted text' --verbose grep 2>/dev/null x=1 export
+	local done done | cd then
+		echo $(pwd) | grep sed awk "$1" test "$1" x=1 /usr/bin printf --verbose sed
+	sed sed 'quoted text' --verbose done 2>/dev/null ${HOME} echo
+${HOME} 2>/dev/null test printf echo /usr/bin 'quoted text'
+	awk export "$1" cd | 'quoted text' --verbose
+| x=1 'quoted text' readonly "$1" test printf /usr/bin
+	echo printf awk then --verbose "$1" readonly /usr/bin readonly readonly "$1"
+	echo export /usr/bin 2>/dev/null export 'quoted text' echo $(pwd) "$1" x=1 then
+	/usr/bin 2>/dev/null readonly awk ${HOME} --verbose grep test -eu && --verbose
+grep test --verbose 'quoted text' -eu "$@" test local printf
+	-eu 2>/dev/null sed | grep awk sed then printf "$@" | sed -eu
+$(pwd) readonly 'quoted text' | export --verbose | 2>/dev/null -eu
+	${HOME} 'quoted text' test 'quoted text' awk grep 'quoted text' printf printf then
+		--verbose "$1" cd local then cd /usr/bin
+&& export sed && "$@" test echo $(pwd) then printf && then "$1" x=1 --verbose
+	| printf "$@" x=1 done
+		grep cd $(pwd) /usr/bin "$@" test
+		$(pwd) echo -eu readonly
+	test sed done 2>/dev/null -eu then echo | awk $(pwd) grep
+	cd && ${HOME} local then sed ${HOME} printf export $(pwd) "$@" sed cd
+	"$@" local then ${HOME} cd $(pwd) "$@" 'quoted text' $(pwd)
+	&& echo then | "$1" ${HOME} cd /usr/bin sed sed ${HOME} sed && sed sed
+&& "$1" done local grep awk cd printf grep -eu --verbose "$1" readonly local "$@"
+		/usr/bin && echo printf done
+		-eu | test local awk && 'quoted text' done
+		${HOME} $(pwd) grep local | 2>/dev/null --verbose printf echo "$1" -eu "$1" local
+printf grep x=1 && sed "$@" done export readonly
+--verbose echo export test $(pwd) ${HOME} | x=1 | local
+cd local sed grep then "$1"
+${HOME} -eu 'quoted text' ${HOME} local readonly ${HOME} $(pwd) -eu 'quoted text'
+"$1" -eu $(pwd) cd /usr/bin echo cd
+/usr/bin echo then | "$1" 'quoted text'
+	readonly $(pwd) | x=1 "$1" 'quoted text' /usr/bin then cd -eu readonly readonly
+	/usr/bin test "$@" local done done grep export -eu 2>/dev/null awk
+	&& grep export printf then --verbose local ${HOME} x=1 'quoted text' echo then
+		done /usr/bin "$1" echo cd 'quoted text' awk awk cd /usr/bin $(pwd)
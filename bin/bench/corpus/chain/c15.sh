@@ -0,0 +1,2001 @@
+	'quoted text' grep echo readonly readonly export sed "$@" grep local cd awk --verbose
+	awk export readonly sed /usr/bin
+		cd grep grep grep "$1"
+local "$1" sed sed grep done then 2>/dev/null $(pwd) local ${HOME}
+grep --verbose --verbose ${HOME}
+		readonly && "$1" done done "$@" sed $(pwd) 'quoted text' ${HOME} 'quoted text'
+		/usr/bin done /usr/bin "$@" 2>/dev/null
+		local $(pwd) ${HOME} -eu "$@" sed "$1" test test export
+/usr/bin export "$@" $(pwd) "$@" --verbose "$1" then "$1" x=1 && $(pwd) test
+	readonly test awk sed | grep test test sed sed x=1 /usr/bin awk /usr/bin then
+		export && /usr/bin -eu -eu test test export local local sed printf 'quoted text'
+	'quoted text' local readonly grep && echo ${HOME}
+		awk then 'quoted text' "$1" local then "$1" test test then 2>/dev/null x=1
+		"$1" printf done 2>/dev/null local awk 'quoted text'
+	"$1" "$1" x=1 2>/dev/null echo --verbose $(pwd) "$1" echo "$@" && printf
+	readonly x=1 $(pwd) "$@" then 'quoted text' grep sed
+readonly local sed ${HOME} "$1" export --verbose
+		echo done printf && /usr/bin -eu cd 2>/dev/null
+	2>/dev/null "$@" test 2>/dev/null --verbose "$@" --verbose
+		local readonly echo export | done | grep local "$1" grep test 2>/dev/null ${HOME}
+x=1 done then grep x=1 "$1" |
+		local -eu local then export readonly test awk sed --verbose readonly
+export printf -eu test sed -eu $(pwd) ${HOME}
+	done local cd export cd | 2>/dev/null export then && done && ${HOME} cd
+	-eu && grep test local export sed awk 2>/dev/null "$@"
+	sed 'quoted text' 2>/dev/null sed --verbose cd grep sed test sed echo
+| local 2>/dev/null echo
+x=1 awk then printf && then ${HOME}
+	cd ${HOME} $(pwd) /usr/bin ${HOME} export 2>/dev/null then printf printf test
+| && 2>/dev/null echo printf "$1" grep
+	grep --verbose sed 'quoted text'
+${HOME} printf local -eu ${HOME} | done 'quoted text' 2>/dev/null
+	| 'quoted text' done x=1 'quoted text' $(pwd)
+		"$@" "$1" "$@" echo -eu "$1"
+	2>/dev/null export -eu cd printf printf | 2>/dev/null
+	printf $(pwd) "$1" && echo "$1"
+	export "$@" ${HOME} "$@" test cd 'quoted text' ${HOME} --verbose export -eu
+	/usr/bin -eu echo awk awk printf sed sed -eu
+-eu /usr/bin 2>/dev/null cd ${HOME} echo
+	echo local echo cd $(pwd) local sed then /usr/bin awk /usr/bin && cd done
+	2>/dev/null ${HOME} 'quoted text' sed readonly
+	"$@" export "$1" | | x=1 "$@" done test awk -eu printf -eu 2>/dev/null 2>/dev/null
+--verbose 2>/dev/null -eu
+		--verbose -eu cd cd cd sed 'quoted text'
+		awk 'quoted text' x=1 'quoted text' --verbose
+	awk done then --verbose cd "$@" "$@" done 2>/dev/null
+	'quoted text' export "$1" $(pwd) echo sed test 2>/dev/null
+	"$@" grep 'quoted text' readonly local "$@" 2>/dev/null
+readonly 'quoted text' cd -eu --verbose
+		sed cd cd then x=1 --verbose "$1" --verbose 2>/dev/null 'quoted text'
+--verbose | | "$@" /usr/bin sed done && 'quoted text'
+	export cd local cd 2>/dev/null
+	"$1" 2>/dev/null | echo ${HOME}
+		done awk 2>/dev/null local done then $(pwd) | "$@" /usr/bin
+--verbose sed 2>/dev/null
+	awk && ${HOME} "$@" awk
+		2>/dev/null ${HOME} local readonly
+done cd 'quoted text' echo "$1" then
+	done cd then awk export && printf | readonly printf | 'quoted text' $(pwd)
+		'quoted text' -eu "$1" sed echo x=1 'quoted text' echo printf
+	'quoted text' echo sed grep --verbose local /usr/bin --verbose echo "$1" then
+"$@" ${HOME} 2>/dev/null echo "$1" grep awk awk --verbose "$@"
+		| grep readonly && $(pwd) | "$1" then test
+		--verbose awk x=1 local $(pwd) then awk awk readonly
+	readonly | awk echo done -eu awk grep 'quoted text' done sed 2>/dev/null
+		readonly test then then 2>/dev/null readonly grep readonly echo cd local
+cd test echo test && && cd 2>/dev/null && awk
+	$(pwd) 'quoted text' export grep
+	--verbose done sed $(pwd) 2>/dev/null /usr/bin 'quoted text'
+	local test done "$1" then ${HOME} readonly local &&
+	/usr/bin then readonly awk
+cd test awk "$@" echo
+		local "$@" grep local
+2>/dev/null echo | -eu $(pwd) $(pwd) 2>/dev/null then echo sed readonly
+	--verbose grep /usr/bin "$@" 2>/dev/null $(pwd)
+		awk then export local awk printf --verbose 2>/dev/null local grep local && -eu then
+		done --verbose sed /usr/bin && echo test ${HOME} ${HOME}
+		echo "$1" done --verbose test
+		x=1 2>/dev/null | cd x=1 grep readonly
+	/usr/bin -eu local grep ${HOME} echo /usr/bin 'quoted text' readonly echo cd ${HOME}
+		x=1 echo export $(pwd) sed x=1 /usr/bin 'quoted text'
+done awk printf /usr/bin local
+x=1 $(pwd) export --verbose "$1" then x=1 done x=1 $(pwd) /usr/bin local
+		"$1" -eu "$1" echo x=1 --verbose readonly ${HOME} $(pwd) /usr/bin 'quoted text'
+		awk "$1" sed && printf cd then 2>/dev/null /usr/bin 2>/dev/null "$@"
+	local "$1" x=1 /usr/bin done x=1 local readonly /usr/bin
+	done /usr/bin -eu --verbose sed then readonly --verbose "$@"
+	cd && done "$1" test
+	readonly awk x=1 grep 'quoted text' -eu x=1 && printf cd
+sed ${HOME} awk awk readonly local printf 2>/dev/null -eu
+x=1 /usr/bin x=1 readonly test readonly
+		2>/dev/null echo grep /usr/bin cd done && then && $(pwd)
+	x=1 echo && sed done cd printf sed done 'quoted text' test ${HOME}
+		/usr/bin ${HOME} --verbose "$1" test x=1 printf echo && export --verbose
+/usr/bin 2>/dev/null | "$1" sed && --verbose --verbose test readonly
+	2>/dev/null done printf readonly
+	/usr/bin x=1 test then x=1 sed grep grep local export /usr/bin echo ${HOME} ${HOME}
+	--verbose local printf 2>/dev/null awk /usr/bin test --verbose ${HOME} local
+$(pwd) export local local
+		echo then done then sed echo
+		grep sed then printf "$1" $(pwd) x=1 -eu local test --verbose readonly
+	-eu grep $(pwd) 'quoted text' |
+printf /usr/bin /usr/bin
+'quoted text' echo "$@" cd
+		test printf | echo "$1" cd printf echo cd local cd | printf
+test test x=1 $(pwd) "$@" cd sed -eu echo 'quoted text' x=1 sed
+	$(pwd) done /usr/bin && grep ${HOME} export "$@" && &&
+	echo local awk -eu x=1 ${HOME} && --verbose
+		printf done "$@" sed && done echo then test printf printf test grep sed
+		x=1 "$1" grep then -eu --verbose ${HOME} cd "$1" && sed readonly x=1 readonly
+	2>/dev/null --verbose then
+	export echo printf x=1 --verbose echo
+	awk --verbose test export printf
+	test /usr/bin && -eu /usr/bin 2>/dev/null awk grep -eu | done echo
+		$(pwd) sed /usr/bin local awk test --verbose --verbose printf "$@" | awk echo -eu
+		test test && export 'quoted text' $(pwd) 'quoted text'
+done "$1" echo x=1 $(pwd) echo grep awk "$1" export ${HOME} sed test 2>/dev/null
+		--verbose "$@" "$1" /usr/bin printf local "$1" local "$@"
+awk $(pwd) sed /usr/bin 'quoted text' "$@" test
+test "$@" awk done echo $(pwd) $(pwd) awk && && test readonly printf
+	readonly ${HOME} echo
+		"$@" printf -eu x=1 /usr/bin export echo |
+	echo "$1" $(pwd) echo test $(pwd) /usr/bin $(pwd) && echo echo readonly sed
+		grep cd -eu -eu sed test
+	"$1" "$@" /usr/bin cd --verbose ${HOME} "$@" /usr/bin $(pwd) && export x=1
+grep awk test export 2>/dev/null
+	test --verbose "$@" local && $(pwd) grep printf done | test awk
+	echo readonly "$1" readonly x=1 awk done printf ${HOME} echo /usr/bin grep
+		done $(pwd) x=1 cd 2>/dev/null 'quoted text' then | 2>/dev/null
+export $(pwd) done --verbose
+		cd grep cd $(pwd) awk |
+	--verbose $(pwd) ${HOME} && -eu echo 2>/dev/null
+		$(pwd) -eu --verbose | sed x=1 'quoted text' awk "$@" | test done x=1 ${HOME}
+then 'quoted text' test printf awk "$1" | cd /usr/bin
+		printf | readonly readonly 'quoted text' then x=1 && done
+		printf echo $(pwd) 'quoted text' cd x=1 -eu test awk $(pwd)
+		cd readonly ${HOME} echo local 'quoted text' "$@" grep /usr/bin local
+		"$1" "$@" then --verbose local export readonly readonly
+		--verbose x=1 2>/dev/null "$@" --verbose && "$1" done "$@" 'quoted text' local
+${HOME} awk $(pwd) awk test export ${HOME} cd
+${HOME} /usr/bin "$@" local 'quoted text' printf readonly echo "$@"
+-eu done grep echo /usr/bin echo && readonly 'quoted text' $(pwd)
+	test export printf 'quoted text' "$@" done grep --verbose awk local
+		local readonly -eu grep && -eu -eu grep /usr/bin then /usr/bin
+	"$1" sed "$1" && /usr/bin test done 2>/dev/null readonly $(pwd)
+		&& "$1" awk local test "$@" done then then grep
+	cd 'quoted text' test | cd grep 2>/dev/null sed && x=1 export /usr/bin | &&
+--verbose readonly --verbose --verbose echo export done 'quoted text'
+		awk done x=1 --verbose printf && 'quoted text' printf local $(pwd) -eu then
+	2>/dev/null done local
+local 'quoted text' --verbose then $(pwd)
+		cd 2>/dev/null cd --verbose grep ${HOME} /usr/bin
+"$@" x=1 --verbose $(pwd) --verbose awk 'quoted text' cd test "$1"
+2>/dev/null readonly grep printf && --verbose done $(pwd)
+	local then then echo done 'quoted text' readonly cd done $(pwd)
+		'quoted text' then then /usr/bin
+	--verbose echo --verbose /usr/bin sed 2>/dev/null 2>/dev/null
+${HOME} | "$@" $(pwd) sed
+		grep 'quoted text' && 'quoted text' cd
+	grep grep -eu | test done echo 2>/dev/null "$@" && x=1 $(pwd) 2>/dev/null
+awk /usr/bin export readonly cd cd printf $(pwd) local
+	sed then && local readonly done
+		then cd 'quoted text' local grep | then $(pwd) $(pwd) | "$@" grep echo
+		&& 2>/dev/null cd $(pwd) "$@" x=1 /usr/bin x=1 cd
+	x=1 ${HOME} "$@" ${HOME} ${HOME} x=1 && ${HOME} cd echo
+	/usr/bin then echo 2>/dev/null && 2>/dev/null readonly
+test 'quoted text' ${HOME} -eu awk --verbose
+&& 2>/dev/null $(pwd) /usr/bin
+		-eu grep $(pwd) && | test local test readonly ${HOME} done /usr/bin
+	$(pwd) local x=1 awk | $(pwd) printf printf 'quoted text' sed 2>/dev/null
+		--verbose $(pwd) --verbose local "$@" printf cd done test awk cd
+| done | 2>/dev/null awk 2>/dev/null
+		then x=1 awk && x=1 printf "$1" awk cd "$1" && "$@" "$@" sed printf
+		sed test export /usr/bin 'quoted text' test cd sed "$1" -eu 2>/dev/null
+"$1" -eu | "$@" grep then /usr/bin /usr/bin export echo &&
+	printf echo $(pwd) /usr/bin ${HOME}
+$(pwd) $(pwd) grep /usr/bin done local --verbose ${HOME} echo
+		sed $(pwd) local echo readonly local sed
+	x=1 done && -eu | test 'quoted text'
+	-eu printf local sed "$1" awk "$@" echo
+		$(pwd) x=1 2>/dev/null 2>/dev/null awk /usr/bin grep && local
+	sed test readonly grep local "$1" -eu cd echo echo test ${HOME} -eu
+	-eu 2>/dev/null sed printf
+		"$@" readonly readonly "$1" export "$1" echo echo
+'quoted text' readonly /usr/bin awk ${HOME}
+	'quoted text' --verbose | x=1 test x=1 "$1" ${HOME} awk
+	/usr/bin /usr/bin 2>/dev/null awk
+	readonly grep printf ${HOME} printf then x=1 sed ${HOME} readonly awk | "$1"
+	readonly /usr/bin -eu then /usr/bin -eu then cd done
+	/usr/bin ${HOME} --verbose "$@" sed -eu | -eu /usr/bin cd then cd 2>/dev/null
+local ${HOME} 'quoted text' x=1 readonly printf printf -eu &&
+	printf && "$1" -eu ${HOME} $(pwd) --verbose
+/usr/bin && test && then cd cd readonly x=1 ${HOME} | /usr/bin sed sed printf
+	--verbose && sed awk --verbose
+		$(pwd) ${HOME} $(pwd) cd done $(pwd) ${HOME}
+/usr/bin ${HOME} x=1 export then -eu test
+		cd local "$1" "$@" "$1" -eu
+-eu | --verbose readonly x=1 --verbose && readonly
+	echo $(pwd) local cd local printf export sed x=1
+		2>/dev/null $(pwd) --verbose /usr/bin 2>/dev/null test "$@" readonly awk "$@"
+echo test && && 2>/dev/null
+done | readonly sed && readonly ${HOME} $(pwd) ${HOME} local --verbose test "$1"
+--verbose awk test readonly echo sed x=1 echo
+sed && cd export 2>/dev/null cd 'quoted text'
+		printf grep x=1 printf export 'quoted text' 'quoted text' 'quoted text'
+		grep $(pwd) ${HOME} test local x=1 $(pwd) "$1" 2>/dev/null
+	&& --verbose sed done "$1" "$@"
+	cd 2>/dev/null export "$@" test cd -eu "$1" && "$@" printf $(pwd)
+"$@" printf 2>/dev/null printf --verbose "$@" export "$1" x=1 &&
+done grep echo x=1 -eu -eu done && "$@" readonly local awk -eu | "$1"
+		printf sed "$1" && readonly | printf
+"$@" "$@" echo echo readonly
+sed "$1" | --verbose awk && $(pwd)
+printf ${HOME} 'quoted text' readonly local | | sed
+2>/dev/null export -eu printf then ${HOME} 2>/dev/null test $(pwd) awk grep
+	-eu 2>/dev/null local "$1" x=1 $(pwd)
+	"$@" $(pwd) x=1 readonly local
+	sed cd "$1" export && done readonly
+		local done done echo -eu "$1" done readonly
+"$1" 'quoted text' cd /usr/bin | x=1 /usr/bin
+export echo then export && /usr/bin 'quoted text' "$1" local 2>/dev/null
+	printf done | -eu done && 'quoted text' cd
+		done && 'quoted text' 2>/dev/null | test cd | && 2>/dev/null cd
+		sed awk test local printf test && done x=1 grep local done test
+	&& $(pwd) | grep test grep /usr/bin
+		| readonly x=1 ${HOME} then "$1" | done local "$1" sed
+"$@" /usr/bin ${HOME} ${HOME} --verbose awk -eu 'quoted text' --verbose readonly
+&& x=1 "$1" grep done awk
+	"$@" x=1 "$1" --verbose --verbose ${HOME} 'quoted text'
+	--verbose then 2>/dev/null printf $(pwd) test awk sed x=1 sed && x=1 /usr/bin
+	sed then grep "$1" cd | awk 'quoted text' ${HOME} $(pwd) cd
+	"$@" test local local local && test | test grep $(pwd) local
+cd && awk grep cd readonly "$@" echo "$1" $(pwd) ${HOME}
+		done -eu 2>/dev/null echo printf grep x=1 "$1" ${HOME} grep readonly && --verbose
+	&& "$1" x=1 printf --verbose echo &&
+		"$1" x=1 /usr/bin sed printf grep && echo readonly
+	'quoted text' echo done local 2>/dev/null
+		printf 2>/dev/null $(pwd) "$@" awk echo 'quoted text'
+		test ${HOME} grep cd "$@" echo cd "$@" echo x=1 && -eu cd cd $(pwd)
+/usr/bin -eu --verbose printf then /usr/bin
+	cd done local $(pwd) $(pwd) "$1" 'quoted text' x=1 local
+		cd printf test awk done export x=1 $(pwd) ${HOME} printf -eu | 2>/dev/null
+	${HOME} x=1 2>/dev/null then -eu | printf awk "$1"
+$(pwd) printf $(pwd) -eu -eu printf /usr/bin "$1" | export $(pwd)
+		&& done | "$1" 'quoted text' x=1 -eu $(pwd) readonly
+		"$1" 'quoted text' x=1 && && | then echo
+local "$1" export sed printf test then
+		| done x=1 /usr/bin awk then --verbose --verbose "$@" readonly sed
+$(pwd) echo | | 'quoted text' test sed grep done then grep done export awk
+	local local sed readonly sed /usr/bin
+	'quoted text' && printf "$@" 2>/dev/null then export test ${HOME} grep
+		readonly then --verbose "$@" readonly "$1" done 'quoted text'
+		then printf test 2>/dev/null "$@" grep
+		/usr/bin export --verbose done "$@" 2>/dev/null x=1 awk
+	$(pwd) | x=1 $(pwd) echo awk printf done 'quoted text' "$1"
+grep 2>/dev/null then echo sed awk --verbose && export readonly test &&
+	sed local "$@" then sed 2>/dev/null /usr/bin
+		x=1 done echo $(pwd) ${HOME} cd local /usr/bin cd done then 'quoted text'
+		${HOME} | "$1" $(pwd) grep && --verbose grep -eu ${HOME} awk grep && echo
+export sed echo awk /usr/bin ${HOME} readonly
+	-eu 'quoted text' x=1 "$@" export readonly export &&
+	"$1" && done 2>/dev/null $(pwd)
+		| sed echo 'quoted text' "$@" $(pwd) | test
+x=1 local && local then /usr/bin 2>/dev/null 2>/dev/null
+		printf ${HOME} test && then $(pwd)
+	&& awk printf grep && cd $(pwd) test "$1" "$@" cd cd "$@"
+echo printf --verbose awk "$@" grep done awk /usr/bin
+		readonly test sed && then $(pwd)
+/usr/bin 2>/dev/null cd cd printf export ${HOME} -eu printf
+		$(pwd) ${HOME} && printf export local
+"$@" echo x=1 done export 2>/dev/null printf then "$1" test readonly cd | echo
+	--verbose awk "$1" printf
+"$@" echo 2>/dev/null ${HOME}
+	readonly local done awk cd "$1" && done "$1" ${HOME} "$1" | echo awk sed $(pwd)
+	| local grep readonly grep then "$1"
+	echo cd local "$@" && $(pwd) "$@" 2>/dev/null test x=1 | "$@" sed
+test cd 2>/dev/null 2>/dev/null then
+"$1" test ${HOME} test local then
+	-eu --verbose 2>/dev/null export awk cd 'quoted text' then echo | $(pwd) /usr/bin
+	x=1 printf readonly cd $(pwd) $(pwd)
+awk -eu grep export test && local "$@" && done "$@" local awk test
+	${HOME} | then x=1 -eu "$1" then "$@" echo done --verbose 'quoted text'
+	${HOME} ${HOME} ${HOME} "$@" ${HOME} -eu | then readonly
+		then | local export 'quoted text' readonly -eu local sed awk cd
+printf | | done done printf sed cd 2>/dev/null
+	then x=1 echo local cd grep test awk && x=1 then local sed "$@" awk "$1" -eu
+		x=1 printf && printf export echo then "$1" readonly $(pwd) export awk awk "$1"
+2>/dev/null export sed
+		--verbose "$@" && | test test cd x=1 'quoted text' x=1 then
+		x=1 test "$@" printf echo
+	printf test ${HOME} done local "$1" test $(pwd) "$1" readonly
+	2>/dev/null export /usr/bin /usr/bin
+"$@" grep local printf 2>/dev/null ${HOME} awk && ${HOME}
+'quoted text' 2>/dev/null 2>/dev/null echo
+	grep then $(pwd) cd /usr/bin ${HOME} local /usr/bin
+grep ${HOME} then 'quoted text' local x=1
+	awk cd awk 'quoted text' cd 'quoted text' 'quoted text' | test
+		awk --verbose "$@" && export x=1 'quoted text' "$@" done echo x=1 "$1"
+		/usr/bin export -eu --verbose
+	test x=1 "$1" test 2>/dev/null ${HOME} "$@" $(pwd)
+"$1" --verbose "$1" sed printf grep ${HOME} done /usr/bin done "$1"
+	export export 'quoted text' done $(pwd) test /usr/bin 'quoted text'
+		local awk awk x=1 x=1 grep 'quoted text' printf readonly | awk
+	/usr/bin grep "$@" $(pwd)
+		2>/dev/null test /usr/bin done | local --verbose "$1" echo -eu "$@" done "$@"
+	x=1 grep x=1 sed echo echo
+-eu "$@" done "$@" test test | local
+	"$@" "$@" 'quoted text' printf
+'quoted text' cd export "$@" "$@"
+		then done export then awk echo | export x=1
+	&& "$@" done && echo local -eu $(pwd) && --verbose | test "$1" "$@" "$1" --verbose
+--verbose ${HOME} readonly "$1" $(pwd) && /usr/bin "$1"
+"$@" awk printf test x=1 |
+	awk then echo cd && done test sed "$@" && local -eu --verbose --verbose
+		-eu test test ${HOME} sed ${HOME}
+	readonly sed | | export sed echo x=1 x=1 | local x=1 sed "$@" readonly 'quoted text'
+	'quoted text' 2>/dev/null awk
+		/usr/bin "$@" "$@" /usr/bin
+grep -eu "$@" -eu x=1 $(pwd) cd "$1" then then then
+	local $(pwd) sed readonly -eu
+	| awk local x=1 readonly readonly 2>/dev/null echo |
+	x=1 awk && test then printf 2>/dev/null readonly then readonly
+	2>/dev/null 2>/dev/null | test readonly ${HOME} 2>/dev/null
+		"$@" then awk done grep 'quoted text'
+printf 2>/dev/null awk "$1" $(pwd) "$@" test test
+| /usr/bin echo "$1" "$1" | sed done printf test "$@" 2>/dev/null
+	echo x=1 "$@" --verbose "$1" /usr/bin "$1" x=1 -eu export then
+		grep "$1" "$@" cd "$@" x=1 readonly readonly && "$1" printf "$1" "$1" local
+local done test then then 2>/dev/null && $(pwd) then -eu && sed && x=1
+	"$1" 'quoted text' --verbose | local -eu | -eu /usr/bin
+		--verbose export 'quoted text' "$1" test grep awk test echo local
+	"$1" && x=1 'quoted text' && local && grep readonly cd && done
+/usr/bin cd x=1 readonly ${HOME} "$@" $(pwd)
+&& 2>/dev/null echo readonly then
+/usr/bin awk local export "$1" -eu export
+-eu $(pwd) echo -eu 2>/dev/null -eu export | "$1" 'quoted text'
+	echo sed ${HOME} grep local readonly printf | $(pwd)
+$(pwd) 'quoted text' /usr/bin export --verbose printf printf -eu test
+| sed "$1" ${HOME} awk export test $(pwd) "$1" 'quoted text' echo /usr/bin "$@"
+-eu printf 'quoted text' awk "$@" printf grep
+grep awk "$@" "$@" | echo local readonly then
+printf -eu | sed local ${HOME} printf
+		printf readonly "$@" --verbose export export ${HOME} awk done | readonly
+	${HOME} grep "$@" sed cd $(pwd) export --verbose --verbose
+		${HOME} | grep && | "$1" x=1 "$@" export awk "$1" readonly "$1" test 2>/dev/null
+	&& cd ${HOME} done cd 'quoted text'
+done /usr/bin "$@" sed done 'quoted text' grep && local cd "$1" && local
+	| "$@" cd -eu /usr/bin echo | local -eu | cd readonly readonly done
+printf $(pwd) echo grep &&
+	test 2>/dev/null ${HOME} awk test 2>/dev/null 2>/dev/null test ${HOME} sed /usr/bin
+&& $(pwd) cd awk 2>/dev/null export then ${HOME} x=1 -eu
+${HOME} grep echo then grep "$1" cd
+		echo then -eu x=1 test done export -eu local awk | 'quoted text' 2>/dev/null
+		$(pwd) ${HOME} done 2>/dev/null echo
+-eu readonly grep then --verbose ${HOME} sed local "$1" export export
+--verbose --verbose local readonly readonly
+	readonly then awk -eu done "$1" --verbose readonly 2>/dev/null "$@"
+'quoted text' $(pwd) --verbose && --verbose
+		| 2>/dev/null "$1" cd --verbose sed done then x=1 cd then test done 2>/dev/null
+		'quoted text' local sed ${HOME} then -eu export done test awk export |
+printf "$1" /usr/bin 'quoted text'
+"$@" echo done then "$1"
+&& -eu cd --verbose awk then "$1" 'quoted text' cd readonly
+sed x=1 then export done awk x=1 readonly printf "$@" grep 'quoted text' echo --verbose
+	printf export export cd local
+		sed 2>/dev/null ${HOME} test && cd 'quoted text' "$@" then | 2>/dev/null
+	/usr/bin awk ${HOME} 2>/dev/null cd && sed readonly
+		export test "$@" grep test test
+	echo -eu && && echo cd $(pwd) -eu 2>/dev/null && export "$1" --verbose printf
+		$(pwd) printf | echo export done sed then done | "$@" $(pwd) echo --verbose
+--verbose "$1" 2>/dev/null grep then grep test export
+	grep x=1 && cd ${HOME} echo && printf echo 2>/dev/null --verbose -eu x=1 grep
+		${HOME} --verbose "$1" 'quoted text' ${HOME} x=1 sed test
+	/usr/bin $(pwd) grep ${HOME} test -eu $(pwd) printf export
+$(pwd) 'quoted text' test export cd $(pwd) "$1"
+		test sed | /usr/bin /usr/bin cd 2>/dev/null readonly readonly done x=1
+	echo echo then x=1 export
+	${HOME} test $(pwd) "$1" /usr/bin then &&
+		x=1 cd readonly readonly -eu export
+local cd /usr/bin done done | readonly
+	sed "$@" --verbose -eu grep "$1" $(pwd) 'quoted text' sed echo awk
+		&& awk --verbose "$@" 2>/dev/null --verbose test readonly x=1
+	export "$1" test printf grep --verbose local "$1" --verbose && && $(pwd)
+	then done x=1 grep grep /usr/bin readonly export "$1" && $(pwd)
+sed readonly readonly done done test then
+		&& readonly sed done x=1 awk done readonly cd 'quoted text'
+	printf awk $(pwd) awk /usr/bin sed readonly
+'quoted text' local 2>/dev/null printf readonly then
+	sed export /usr/bin local | -eu awk ${HOME} && ${HOME} printf
+		printf /usr/bin echo then $(pwd) "$@" grep test done done
+	grep | echo local sed local local done readonly sed done local | --verbose
+/usr/bin | 2>/dev/null "$1" sed then printf printf
+	grep test grep /usr/bin local sed $(pwd) sed export --verbose x=1 /usr/bin
+2>/dev/null done cd /usr/bin | printf done $(pwd)
+grep readonly 2>/dev/null printf
+grep done printf printf "$1" "$1" 'quoted text'
+grep sed sed --verbose then
+${HOME} awk sed 2>/dev/null export x=1 awk printf then && cd x=1 printf
+-eu export grep -eu local 'quoted text' sed /usr/bin 'quoted text' 'quoted text'
+		/usr/bin readonly readonly
+		echo done $(pwd) echo then sed test readonly printf grep -eu export ${HOME}
+cd && 'quoted text' echo
+cd $(pwd) 2>/dev/null 2>/dev/null 2>/dev/null cd 'quoted text'
+	then /usr/bin -eu /usr/bin local sed /usr/bin awk then
+	cd 'quoted text' | 2>/dev/null -eu
+		x=1 readonly sed x=1 2>/dev/null ${HOME} x=1 local sed awk /usr/bin local printf
+	echo done -eu cd done x=1 -eu export --verbose "$1" /usr/bin && local
+		cd cd printf echo awk
+printf ${HOME} "$@" echo then "$1" "$@" "$1" grep && cd
+		printf local x=1 export -eu "$@" done sed
+	| awk 2>/dev/null printf cd printf
+cd grep printf -eu && echo
+	$(pwd) local grep readonly
+		sed && "$1" local 'quoted text'
+	awk | && cd export 'quoted text' readonly
+		done ${HOME} 2>/dev/null export grep readonly "$@" --verbose && -eu | -eu
+	awk echo "$1" 2>/dev/null printf 'quoted text' test printf
+/usr/bin grep /usr/bin awk readonly grep grep 2>/dev/null ${HOME}
+	2>/dev/null "$1" echo ${HOME} --verbose local -eu then test --verbose
+"$@" "$1" export sed "$1" 2>/dev/null | grep sed printf local | test /usr/bin
+$(pwd) && echo $(pwd) test awk x=1 printf then done cd echo sed /usr/bin
+	$(pwd) test 2>/dev/null awk x=1 --verbose x=1 cd printf "$@"
+	test 'quoted text' then printf test grep cd cd grep
+'quoted text' readonly 'quoted text' readonly --verbose readonly
+	grep && | done readonly test export x=1 2>/dev/null
+| $(pwd) export printf | cd /usr/bin
+		-eu ${HOME} echo local then local grep cd x=1
+"$@" 2>/dev/null /usr/bin "$1" cd
+		done echo local x=1 $(pwd)
+	/usr/bin sed then cd readonly --verbose cd awk 2>/dev/null "$1" echo --verbose
+awk test ${HOME} echo "$@" x=1 cd | export $(pwd) "$1" -eu --verbose
+		grep then then sed echo 'quoted text' then "$@" printf
+		/usr/bin x=1 "$@" x=1 --verbose sed sed x=1
+	2>/dev/null printf test then then local readonly
+"$@" printf x=1 printf test 2>/dev/null grep printf
+cd -eu "$@" --verbose /usr/bin
+cd -eu test cd 'quoted text'
+		grep "$@" --verbose export ${HOME} $(pwd)
+$(pwd) sed printf grep sed /usr/bin cd ${HOME} printf
+echo readonly export readonly -eu && $(pwd) local grep export cd | 'quoted text'
+	| readonly && x=1 then sed test --verbose x=1 export grep && "$1"
+cd 2>/dev/null --verbose grep --verbose
+	"$@" "$1" "$1" 2>/dev/null
+		&& done x=1 ${HOME} "$@" done awk readonly x=1 printf
+		$(pwd) 'quoted text' /usr/bin -eu awk test "$1" sed awk printf awk echo /usr/bin
+local | local local done ${HOME} -eu "$1" && ${HOME} "$1" done 'quoted text'
+		readonly sed -eu | "$1" && test local export $(pwd) /usr/bin
+		--verbose echo 'quoted text' done -eu $(pwd) | 2>/dev/null ${HOME} -eu
+		x=1 --verbose then cd "$1" 'quoted text' && 2>/dev/null then
+printf echo awk $(pwd) readonly printf echo cd ${HOME} readonly
+		readonly -eu printf --verbose done test cd cd 'quoted text' awk ${HOME} sed
+	cd echo "$1" echo 'quoted text'
+${HOME} then x=1 -eu then grep 'quoted text' cd ${HOME} test test then &&
+echo "$1" local 'quoted text'
+	--verbose /usr/bin sed ${HOME} ${HOME} then && --verbose "$@" cd grep
+	"$1" test printf "$1" then 'quoted text' awk printf sed
+		test --verbose local sed cd test && 'quoted text' x=1 awk "$@" | readonly
+	${HOME} awk sed echo export test export
+	'quoted text' test | cd then export local
+2>/dev/null "$@" "$1" ${HOME} echo done echo 'quoted text' done readonly ${HOME}
+		${HOME} awk && cd awk -eu readonly done printf $(pwd)
+sed "$@" readonly "$@" /usr/bin "$1" "$@" awk awk x=1
+"$1" "$1" test "$1" cd /usr/bin | export x=1 then printf
+	x=1 grep 'quoted text' "$1" then echo export grep ${HOME}
+done x=1 then done grep cd -eu then then done printf
+done sed echo printf 2>/dev/null echo readonly export -eu done
+	echo test grep done --verbose echo && test
+test cd 2>/dev/null 'quoted text'
+2>/dev/null grep | done 'quoted text' -eu 'quoted text' test
+		local /usr/bin --verbose && ${HOME} local readonly export $(pwd)
+	-eu -eu $(pwd) awk | 2>/dev/null 2>/dev/null "$@" && then then cd then
+	test ${HOME} grep done printf | then
+--verbose --verbose x=1 2>/dev/null "$@"
+		sed printf grep ${HOME} -eu --verbose 2>/dev/null $(pwd) 'quoted text'
+/usr/bin sed --verbose --verbose -eu echo sed sed ${HOME} printf -eu done --verbose
+		done 'quoted text' | -eu
+awk && "$@" done then &&
+	readonly grep 2>/dev/null
+	test export "$1" done cd "$@" printf test local /usr/bin export --verbose
+	-eu 2>/dev/null 'quoted text' local
+	echo "$1" /usr/bin cd "$@" local /usr/bin export readonly
+		then $(pwd) /usr/bin readonly "$1" done sed 'quoted text' done sed ${HOME} cd
+x=1 --verbose "$@" /usr/bin /usr/bin
+${HOME} 'quoted text' printf local then x=1 | echo
+	&& -eu "$1" && then grep /usr/bin awk
+	/usr/bin -eu sed grep 'quoted text' cd printf "$1" --verbose
+	&& $(pwd) -eu sed done | readonly cd "$1" "$@" "$1" -eu done --verbose -eu
+test "$@" "$@" --verbose awk awk cd echo export -eu echo
+		grep -eu "$@" "$@" && export /usr/bin "$1" then 2>/dev/null readonly
+test test --verbose --verbose /usr/bin printf
+	$(pwd) cd "$1" ${HOME} ${HOME} 2>/dev/null export
+echo cd grep | $(pwd) printf 2>/dev/null
+		sed "$@" export done && cd local readonly
+x=1 cd cd readonly | |
+echo awk then | then -eu awk local 2>/dev/null cd printf sed ${HOME} export
+awk cd -eu printf "$@" done echo readonly grep ${HOME} 2>/dev/null
+		-eu 'quoted text' sed readonly readonly "$@"
+		echo grep --verbose local
+		| /usr/bin test 'quoted text' 'quoted text' then /usr/bin printf ${HOME} | 2>/dev/null
+	sed cd $(pwd) && cd sed /usr/bin ${HOME} cd awk ${HOME} local
+${HOME} sed $(pwd) done printf grep -eu sed readonly done -eu printf
+		test printf x=1 printf $(pwd) done && printf test
+		&& done then echo local test /usr/bin printf echo "$1" | && -eu "$1" x=1
+x=1 && --verbose export -eu printf test grep "$1" -eu 2>/dev/null $(pwd)
+awk readonly "$@" --verbose readonly sed /usr/bin
+		test grep | 'quoted text' "$@" /usr/bin export "$@" 'quoted text'
+printf ${HOME} local sed awk
+		then ${HOME} && sed && local --verbose cd --verbose
+		"$1" export export 2>/dev/null
+	export -eu | then --verbose local done grep 'quoted text' grep "$@" printf x=1
+	done "$1" sed awk x=1 $(pwd) readonly | sed local
+sed echo x=1 cd 'quoted text' local awk x=1 | awk "$@" 'quoted text'
+		grep echo awk cd cd test ${HOME} "$@" x=1 /usr/bin "$1"
+readonly /usr/bin $(pwd) --verbose grep sed x=1
+		cd sed "$1" --verbose -eu 2>/dev/null local 2>/dev/null
+'quoted text' awk 'quoted text'
+printf --verbose 'quoted text' test export export sed "$@"
+test -eu /usr/bin echo readonly && readonly x=1 | "$@" 2>/dev/null then --verbose
+		"$@" $(pwd) then "$@" "$@" grep 2>/dev/null $(pwd) awk then echo awk x=1
+readonly 'quoted text' | echo | awk ${HOME}
+local cd 2>/dev/null done cd ${HOME} local x=1 -eu
+		sed 2>/dev/null "$@" -eu done x=1 --verbose
+		"$@" x=1 && done "$1" cd readonly grep awk x=1 /usr/bin ${HOME} readonly
+	grep grep grep 'quoted text'
+sed cd "$@" /usr/bin "$1" echo
+	| $(pwd) /usr/bin && local printf $(pwd) printf
+		then local grep export printf -eu /usr/bin printf echo $(pwd) --verbose grep
+	printf ${HOME} $(pwd) /usr/bin
+	$(pwd) awk awk "$1" ${HOME} done x=1 echo /usr/bin "$@"
+then -eu $(pwd) ${HOME}
+		"$@" readonly sed "$1" grep && sed | | "$1" then
+		${HOME} export then "$1" && ${HOME}
+	"$@" sed 'quoted text' -eu local
+	export /usr/bin x=1 -eu done echo
+then readonly $(pwd) export local x=1 /usr/bin cd "$1" test awk local readonly
+&& 'quoted text' printf && --verbose | x=1 $(pwd) 'quoted text'
+${HOME} test awk x=1 /usr/bin export
+${HOME} $(pwd) x=1 cd /usr/bin $(pwd) readonly
+2>/dev/null echo export then awk ${HOME} -eu echo "$1" ${HOME} printf awk /usr/bin
+	'quoted text' printf printf x=1 grep done "$@"
+printf 2>/dev/null then --verbose
+		grep "$@" ${HOME} awk $(pwd) cd x=1 done --verbose 2>/dev/null
+	&& && done /usr/bin then awk 'quoted text'
+	echo test 2>/dev/null test
+then echo /usr/bin -eu | "$@" cd 2>/dev/null $(pwd) grep --verbose --verbose
+		x=1 export local 'quoted text' printf printf sed "$@" cd
+		'quoted text' then done 'quoted text' 2>/dev/null awk then 'quoted text'
+	readonly cd 2>/dev/null "$@" then /usr/bin | echo
+	then export -eu done local 'quoted text' local local ${HOME} done test export
+"$1" sed ${HOME} ${HOME} /usr/bin
+		${HOME} 2>/dev/null ${HOME} --verbose "$1" printf cd then printf ${HOME}
+awk "$@" 2>/dev/null 'quoted text' echo local done
+	done ${HOME} && cd --verbose printf then
+		${HOME} --verbose echo -eu then ${HOME} "$1" cd
+	test export readonly x=1 done readonly test
+then "$@" "$@" local
+echo readonly 'quoted text' done cd "$1" "$@" test
+	grep 'quoted text' -eu grep ${HOME}
+	&& $(pwd) && 2>/dev/null export "$1" local awk | sed $(pwd)
+		sed 'quoted text' printf sed sed x=1 sed /usr/bin then
+echo ${HOME} --verbose "$1" 'quoted text' sed $(pwd) local printf &&
+"$@" readonly "$1" -eu /usr/bin | 'quoted text' cd | grep && "$1" then grep 2>/dev/null
+awk && --verbose awk done -eu "$@" $(pwd) "$1" test test $(pwd)
+	-eu test test -eu printf $(pwd) local printf 2>/dev/null
+		${HOME} done --verbose test export printf -eu "$1" &&
+"$1" ${HOME} && done -eu "$1" export readonly && grep x=1 ${HOME} --verbose
+x=1 test printf test | $(pwd) awk printf cd | /usr/bin
+		/usr/bin then 2>/dev/null && local "$@" readonly
+grep then export local printf
+--verbose local export awk awk sed | ${HOME} -eu then sed
+	"$@" local x=1 x=1 test awk --verbose x=1 --verbose then cd export && done
+	'quoted text' printf export
+		cd sed --verbose awk && readonly --verbose "$@" | "$@" grep "$@" ${HOME}
+		| -eu 'quoted text' grep ${HOME}
+local | 2>/dev/null awk ${HOME} export grep "$1" "$@" "$1" echo "$1" printf
+| export printf "$@" echo printf $(pwd) | ${HOME} printf
+/usr/bin | $(pwd) cd done printf export
+$(pwd) then | --verbose then /usr/bin echo
+		$(pwd) then done test done readonly "$1" | echo -eu && printf "$@" test then /usr/bin
+	done ${HOME} && printf 'quoted text' x=1 sed printf then /usr/bin grep grep
+	"$@" $(pwd) sed grep local done test readonly "$1" echo local done local cd
+	export -eu cd export -eu printf
+	cd 'quoted text' && x=1
+	echo | "$1" "$1" grep awk test cd x=1 -eu readonly | --verbose 'quoted text'
+	test cd | cd $(pwd) grep ${HOME} cd ${HOME} $(pwd) | echo then
+	test x=1 done | cd then awk | then && $(pwd) "$1" -eu local test "$@" local sed
+sed ${HOME} cd --verbose && 'quoted text' sed export sed
+		2>/dev/null | test x=1 sed ${HOME} | export --verbose "$@"
+awk done then cd /usr/bin done local sed then printf
+	local --verbose sed grep cd grep 'quoted text' awk local
+sed --verbose -eu readonly done && local x=1 awk 'quoted text' printf "$@" readonly
+echo cd sed local local | && ${HOME} grep echo printf 'quoted text'
+2>/dev/null /usr/bin $(pwd) | ${HOME} ${HOME} --verbose 'quoted text' /usr/bin
+	--verbose cd sed ${HOME} ${HOME} printf x=1 test readonly readonly
+	cd && export printf $(pwd) && cd -eu test sed 2>/dev/null
+--verbose test /usr/bin awk awk export /usr/bin
+	grep export -eu export grep export awk done $(pwd)
+	-eu $(pwd) ${HOME} export -eu printf $(pwd) echo printf
+printf grep "$1" readonly "$@" -eu readonly awk x=1 x=1
+	readonly ${HOME} sed then | && 'quoted text' && --verbose done cd printf done
+	echo then 2>/dev/null && done sed
+"$@" "$1" /usr/bin grep cd done | 'quoted text'
+	cd "$1" "$1" --verbose echo done x=1 $(pwd)
+test /usr/bin readonly done awk
+	"$1" --verbose /usr/bin echo grep sed
+"$@" test && && "$@" "$1" |
+		then readonly ${HOME} ${HOME} $(pwd) 2>/dev/null "$1" then printf
+	/usr/bin then "$1" 2>/dev/null readonly sed 2>/dev/null "$@"
+		readonly /usr/bin $(pwd) -eu done | -eu local 'quoted text'
+	readonly | "$1" 'quoted text' ${HOME} x=1 -eu test echo x=1 done awk
+		&& local "$@" x=1 cd sed export cd $(pwd)
+	then /usr/bin cd local -eu printf printf ${HOME} echo /usr/bin --verbose then
+	test then awk 'quoted text' awk printf
+		test readonly ${HOME} "$1" && && -eu local x=1 'quoted text'
+	readonly x=1 /usr/bin test
+	"$@" $(pwd) "$1" cd "$1" readonly /usr/bin cd /usr/bin
+-eu printf 'quoted text' sed local ${HOME} -eu "$@" --verbose then sed 'quoted text'
+		export done export $(pwd) export "$1" local 2>/dev/null printf
+	printf test x=1 "$1" 2>/dev/null "$@" then sed printf readonly $(pwd) /usr/bin
+		sed x=1 grep | grep $(pwd) "$1" "$@" sed done printf grep
+	cd cd grep "$@" -eu cd test /usr/bin
+	&& grep "$@" "$@" local readonly then /usr/bin
+done awk readonly test "$1" local && cd done sed -eu -eu && local --verbose &&
+"$1" export then | x=1 x=1 sed x=1 x=1 local test done echo && done
+		x=1 export "$@" export && test export then
+	cd "$1" test then cd | --verbose readonly -eu --verbose local 2>/dev/null
+	readonly awk && | done readonly cd /usr/bin x=1 printf sed
+		/usr/bin then "$@" cd printf /usr/bin x=1 sed /usr/bin
+	x=1 $(pwd) --verbose grep "$@" &&
+	| grep --verbose x=1 readonly test awk printf then $(pwd) echo 'quoted text'
+grep local /usr/bin then | readonly x=1 /usr/bin then readonly done then |
+	grep printf printf && "$@" 'quoted text' /usr/bin readonly "$1" then echo ${HOME}
+sed --verbose awk $(pwd)
+2>/dev/null printf ${HOME} ${HOME} $(pwd) echo printf | cd
+	grep 2>/dev/null /usr/bin export echo grep echo awk local && /usr/bin
+'quoted text' $(pwd) 2>/dev/null
+"$@" export x=1 then 2>/dev/null
+	test local --verbose cd 2>/dev/null awk local grep
+		grep export 'quoted text' x=1 "$@" local x=1
+then done "$1" x=1 && -eu $(pwd) 2>/dev/null test
+		cd $(pwd) awk x=1 x=1 grep 2>/dev/null "$1"
+	echo -eu --verbose /usr/bin done cd done ${HOME} "$@" | $(pwd) x=1 /usr/bin readonly
+		readonly "$@" grep "$1" cd 2>/dev/null test then -eu -eu sed done -eu sed 2>/dev/null
+		printf "$@" printf ${HOME} | --verbose ${HOME} | /usr/bin echo x=1 && then
+cd test --verbose 'quoted text' export --verbose && printf
+	--verbose $(pwd) $(pwd) echo && --verbose readonly $(pwd) export
+	printf export echo then local -eu local -eu -eu grep done && "$1" 'quoted text'
+		done 'quoted text' 'quoted text' "$@" --verbose $(pwd) awk ${HOME} | ${HOME}
+		--verbose export $(pwd) readonly "$@" -eu sed
+		readonly cd $(pwd) "$1" -eu done grep printf /usr/bin then export | "$1"
+		"$@" test "$@" x=1 && "$1" | 'quoted text' test x=1 && printf done awk
+		--verbose then /usr/bin export sed local 2>/dev/null 2>/dev/null awk grep sed
+readonly sed x=1 --verbose 'quoted text'
+		"$@" export /usr/bin /usr/bin export x=1 done export
+"$@" --verbose -eu printf ${HOME} "$@" sed grep --verbose
+	printf 2>/dev/null 'quoted text'
+"$1" $(pwd) awk then readonly "$@" | cd awk cd
+		echo ${HOME} && | done awk echo $(pwd) sed
+done -eu 2>/dev/null awk
+printf 2>/dev/null x=1 "$1" awk -eu $(pwd) && x=1 --verbose
+		then -eu 'quoted text' ${HOME} "$1" ${HOME} "$1"
+		awk /usr/bin 2>/dev/null $(pwd) 2>/dev/null test x=1 local readonly local then
+		readonly grep export test local printf
+local "$@" && $(pwd) then local "$1"
+		grep ${HOME} -eu export ${HOME} readonly
+		echo $(pwd) echo export "$1" && "$1" done -eu $(pwd) readonly /usr/bin
+then | awk 'quoted text'
+		'quoted text' test awk && --verbose "$1" && 2>/dev/null -eu grep
+		-eu grep /usr/bin && local
+${HOME} 2>/dev/null local $(pwd) 2>/dev/null | ${HOME} "$1"
+	x=1 cd done 'quoted text' test ${HOME} local test
+		/usr/bin sed sed readonly readonly $(pwd)
+	sed export sed 2>/dev/null --verbose "$1" cd -eu printf --verbose then
+	printf printf ${HOME} $(pwd) "$1" export export cd -eu && ${HOME} then "$@"
+done local printf then /usr/bin $(pwd) "$@"
+	$(pwd) x=1 && 'quoted text' cd cd -eu | | done 'quoted text' export done
+	${HOME} grep readonly /usr/bin
+		"$1" test -eu echo /usr/bin $(pwd) --verbose grep /usr/bin --verbose && test
+		sed readonly | awk then then export ${HOME} && /usr/bin printf export
+then | cd $(pwd) grep | printf grep && /usr/bin grep "$@" "$1" cd -eu | &&
+-eu grep | "$@" /usr/bin && "$1" --verbose readonly local local 2>/dev/null grep
+cd ${HOME} -eu "$1" printf && ${HOME} then cd awk
+done x=1 | printf x=1 "$1" printf
+		readonly awk "$@" sed "$@" echo sed printf local test "$1" && test --verbose
+	readonly printf --verbose printf "$@" --verbose
+test local && 2>/dev/null cd done then readonly
+		/usr/bin grep "$1" "$@" "$1" awk test /usr/bin echo awk then /usr/bin | done
+		printf /usr/bin then 2>/dev/null
+	"$@" --verbose /usr/bin export "$1" done local readonly local readonly readonly
+	local awk local cd then 'quoted text' && "$@" 2>/dev/null | && $(pwd) $(pwd)
+	/usr/bin && local cd test cd $(pwd) --verbose grep "$1" -eu
+		readonly printf cd && echo -eu readonly --verbose && test /usr/bin -eu "$@" 2>/dev/null
+	printf x=1 grep test test "$1" sed printf echo done
+		--verbose /usr/bin sed readonly export "$1" done cd ${HOME} grep export
+x=1 "$@" ${HOME} /usr/bin done cd then sed 2>/dev/null "$@" sed "$1"
+--verbose export && "$1" && done $(pwd) ${HOME} $(pwd) 2>/dev/null
+	then then cd printf 'quoted text'
+test | -eu x=1 readonly printf cd done | $(pwd) 2>/dev/null readonly --verbose
+echo "$@" awk | && local sed test readonly cd "$@" "$1"
+	grep grep --verbose awk readonly test local done sed /usr/bin local echo sed ${HOME}
+x=1 "$1" grep | local readonly
+	sed readonly export test then "$1" cd | export test grep test 2>/dev/null
+	x=1 grep $(pwd) test 'quoted text' ${HOME} && done cd 2>/dev/null "$1" 2>/dev/null
+	"$@" done "$1" 'quoted text' export echo awk readonly
+&& test grep 'quoted text' $(pwd) "$1" 2>/dev/null
+	cd x=1 && cd x=1 && &&
+		done --verbose --verbose -eu $(pwd)
+	/usr/bin cd "$@" echo | --verbose
+'quoted text' export grep "$1" "$1" done readonly
+	-eu readonly cd 'quoted text' 2>/dev/null &&
+		'quoted text' --verbose printf test "$1" ${HOME} cd readonly 'quoted text'
+$(pwd) readonly test /usr/bin
+	done readonly "$@" printf awk cd -eu done grep
+		then --verbose awk --verbose "$@"
+		echo "$@" && && $(pwd) test grep && ${HOME} then 2>/dev/null
+x=1 grep awk 'quoted text' echo
+		"$1" -eu -eu -eu export local "$1"
+		/usr/bin --verbose readonly export $(pwd) "$@"
+	grep ${HOME} && awk "$@" printf "$1" &&
+	&& local x=1 then 'quoted text' /usr/bin
+-eu "$1" test local $(pwd) sed "$@" --verbose printf -eu -eu "$@"
+"$1" --verbose awk /usr/bin ${HOME} then -eu readonly | x=1 "$@"
+		cd local cd 2>/dev/null readonly "$1" | $(pwd) export done local &&
+		then cd export /usr/bin printf echo && printf "$@"
+		2>/dev/null x=1 'quoted text' echo
+		--verbose 'quoted text' 2>/dev/null
+		awk echo export "$@" && then printf awk local "$@" echo
+echo echo && ${HOME} "$@" grep -eu local grep export && | local $(pwd)
+awk $(pwd) -eu local awk
+		test 2>/dev/null | printf "$@" && "$@" sed -eu 2>/dev/null echo $(pwd)
+	test "$@" $(pwd) 2>/dev/null
+	local | local x=1 sed | 2>/dev/null
+then test | "$@" test then "$1"
+	${HOME} 2>/dev/null -eu -eu x=1 "$1" x=1
+${HOME} ${HOME} echo cd grep echo export local 'quoted text' grep readonly
+		--verbose && && 'quoted text' 'quoted text' "$@" ${HOME} /usr/bin then | then
+test cd -eu local "$1" "$@" /usr/bin --verbose $(pwd) && export done
+		&& grep grep sed done grep ${HOME}
+	local | awk 'quoted text' awk --verbose printf 2>/dev/null --verbose test $(pwd)
+		grep local sed printf printf "$@" x=1 | then sed "$1" &&
+		echo $(pwd) awk export -eu cd -eu printf sed printf readonly ${HOME} /usr/bin
+		then local done "$@" grep cd grep awk local readonly ${HOME} cd --verbose
+		${HOME} $(pwd) 2>/dev/null --verbose test
+	&& $(pwd) --verbose --verbose
+printf "$@" | $(pwd) printf then readonly awk && 2>/dev/null echo $(pwd) $(pwd)
+test x=1 export && ${HOME} done test | printf
+	then 'quoted text' grep
+awk export echo grep local cd export
+		echo /usr/bin sed echo local
+cd --verbose then "$1" 2>/dev/null
+	"$1" sed "$1" $(pwd) readonly "$@" test --verbose grep | && && -eu local
+&& local readonly | printf grep 2>/dev/null
+		"$@" readonly --verbose | $(pwd) 'quoted text' /usr/bin
+| x=1 "$1" awk test echo "$@" -eu 'quoted text' grep
+grep ${HOME} | $(pwd) readonly sed --verbose x=1 x=1 local
+	/usr/bin | "$@" 2>/dev/null "$1" "$1" sed 2>/dev/null ${HOME} export
+	--verbose cd -eu 2>/dev/null grep
+		printf local "$@" /usr/bin test /usr/bin "$1" -eu readonly
+	done echo grep cd "$@" x=1 sed export /usr/bin echo
+		${HOME} cd -eu grep done then echo grep export sed test --verbose -eu grep "$@"
+		printf export 2>/dev/null /usr/bin
+"$@" ${HOME} x=1 ${HOME} readonly test 'quoted text' then export -eu printf
+printf echo then 'quoted text' 2>/dev/null done && then -eu local
+	readonly readonly export | "$1" local "$@" then -eu sed --verbose
+--verbose awk test 'quoted text'
+		echo && readonly "$1" -eu grep sed | then "$@" /usr/bin /usr/bin
+&& printf sed /usr/bin awk -eu grep -eu /usr/bin --verbose
+"$@" --verbose printf grep printf sed echo 'quoted text' echo x=1 x=1
+		readonly x=1 export /usr/bin "$1" -eu ${HOME} echo 'quoted text' readonly
+${HOME} awk $(pwd) readonly 2>/dev/null
+	&& $(pwd) "$1" cd --verbose
+/usr/bin "$@" export readonly 2>/dev/null 2>/dev/null echo cd then export readonly
+		local x=1 2>/dev/null "$1" 'quoted text' -eu grep "$@" export /usr/bin
+	printf --verbose done /usr/bin "$@" | 'quoted text' then 2>/dev/null awk
+	awk | done "$@" && readonly $(pwd) "$1" cd -eu readonly
+	'quoted text' then echo --verbose | printf 'quoted text'
+	printf printf done 'quoted text' printf ${HOME} sed
+		"$@" test --verbose $(pwd) export readonly "$@"
+		awk awk readonly done -eu ${HOME} && cd 2>/dev/null local && test | $(pwd) done
+		echo 2>/dev/null 2>/dev/null | 'quoted text' export 2>/dev/null awk sed "$1" ${HOME}
+	| x=1 then $(pwd) "$@" $(pwd) echo | ${HOME} test x=1 "$@" $(pwd) -eu "$1" --verbose
+done | awk && x=1 test "$@" cd ${HOME}
+--verbose printf sed then local
+	&& sed 2>/dev/null /usr/bin test ${HOME} | /usr/bin sed "$1" cd -eu
+		done --verbose "$@" /usr/bin | -eu && cd ${HOME} awk export
+'quoted text' awk -eu readonly export | readonly export 'quoted text' ${HOME}
+"$1" ${HOME} 2>/dev/null && --verbose export 2>/dev/null /usr/bin
+| awk local cd grep then
+	export 2>/dev/null done -eu done sed --verbose ${HOME}
+	/usr/bin export $(pwd) "$@"
+	"$@" echo "$@" x=1 --verbose "$1" $(pwd)
+-eu && done cd /usr/bin && local readonly 2>/dev/null printf 2>/dev/null
+$(pwd) /usr/bin "$1" awk "$1" local 'quoted text' export | "$@" $(pwd) awk
+		&& "$@" export --verbose x=1 -eu $(pwd) echo && cd local readonly "$1" awk
+	sed --verbose test 'quoted text' printf 'quoted text' readonly sed 'quoted text'
+	--verbose 2>/dev/null awk
+		'quoted text' "$@" printf && /usr/bin grep /usr/bin awk ${HOME} ${HOME} echo local
+		--verbose --verbose then printf | test
+	export done --verbose sed $(pwd)
+	x=1 cd then --verbose then /usr/bin then
+printf "$@" -eu | 'quoted text' -eu /usr/bin 'quoted text' echo
+	printf "$1" | awk 2>/dev/null --verbose
+	/usr/bin grep echo "$1" export done local awk local export local export
+readonly then "$1" awk cd awk sed "$1"
+readonly cd -eu 'quoted text' 'quoted text'
+2>/dev/null readonly |
+	| done /usr/bin 'quoted text' ${HOME}
+awk 2>/dev/null "$@" echo test
+&& "$1" printf --verbose then local x=1 "$1" done cd awk 'quoted text' readonly
+grep cd 'quoted text' ${HOME} 'quoted text' local
+		sed $(pwd) sed then cd "$@" test sed printf grep
+		$(pwd) sed x=1 ${HOME} local --verbose "$@" -eu sed "$1" sed
+--verbose "$1" ${HOME} echo "$@" local && -eu
+	&& "$1" export 'quoted text' printf "$@" /usr/bin sed -eu test && 'quoted text'
+$(pwd) "$1" "$1" ${HOME} export echo
+		"$@" cd "$1" 'quoted text' awk ${HOME} printf local 2>/dev/null awk
+	export $(pwd) awk cd printf sed 'quoted text'
+		test done readonly awk x=1 export readonly
+		--verbose awk printf then test ${HOME} -eu sed
+	"$@" sed "$@" sed x=1 'quoted text' echo | then "$1" local readonly
+| 2>/dev/null done export export sed cd $(pwd) "$@" | "$1"
+		$(pwd) done readonly && cd "$1" 2>/dev/null
+awk grep --verbose cd /usr/bin
+		test | test grep echo printf ${HOME} test grep sed $(pwd)
+		"$@" local test then echo 'quoted text' "$@" cd grep
+	--verbose done test readonly x=1 -eu /usr/bin | 2>/dev/null test then $(pwd)
+		export ${HOME} test done
+		$(pwd) grep --verbose printf local
+'quoted text' grep -eu then test test grep | $(pwd) $(pwd) sed --verbose &&
+/usr/bin grep | grep "$@" local cd export echo "$1" then echo $(pwd) && 'quoted text'
+done | /usr/bin grep "$1" --verbose $(pwd) done
+	local x=1 local && sed
+	/usr/bin export "$1" "$@" |
+	cd export local export grep ${HOME} sed export sed /usr/bin awk --verbose
+cd sed readonly export echo local 2>/dev/null sed sed local
+	cd done then $(pwd) test /usr/bin 2>/dev/null "$1" grep --verbose | export
+		export 'quoted text' done 'quoted text'
+		local 2>/dev/null "$1" "$1" export grep export
+	done sed echo export 2>/dev/null "$@"
+		-eu -eu sed cd ${HOME} ${HOME}
+'quoted text' local grep 'quoted text' echo --verbose
+/usr/bin printf | 'quoted text' cd -eu "$1" echo awk readonly export --verbose
+		cd "$@" readonly x=1 && --verbose x=1 readonly readonly done 2>/dev/null "$@"
+		${HOME} x=1 readonly echo $(pwd) --verbose
+printf && && --verbose && --verbose
+then awk && 'quoted text' |
+	echo local grep && echo "$@" | readonly
+2>/dev/null ${HOME} echo local printf "$1" && ${HOME} -eu done --verbose
+"$@" 2>/dev/null test | "$1" ${HOME} readonly ${HOME} --verbose
+	done readonly "$1" ${HOME} $(pwd) --verbose /usr/bin --verbose
+		then echo export done 'quoted text'
+		${HOME} grep awk -eu local | echo cd local -eu local export ${HOME} then
+		printf printf --verbose /usr/bin echo awk cd x=1 echo "$1" local "$1"
+	&& cd -eu export done -eu
+	printf | done "$1" /usr/bin then grep && cd
+	&& done echo printf x=1 echo 2>/dev/null x=1 2>/dev/null test
+	echo -eu then readonly -eu printf | done readonly then export
+awk --verbose awk cd printf "$1" grep ${HOME} 2>/dev/null
+cd x=1 2>/dev/null local test test --verbose
+	echo 2>/dev/null -eu sed cd echo --verbose $(pwd) grep && done printf
+		test && 'quoted text' awk "$1" --verbose
+readonly "$@" awk echo /usr/bin awk export done 2>/dev/null
+	grep "$1" then cd --verbose ${HOME} $(pwd) echo printf sed
+	readonly /usr/bin echo
+		"$@" sed -eu -eu cd | grep --verbose | && done && printf
+	readonly ${HOME} "$1" sed grep printf then export cd then
+	printf export done cd grep && | then test /usr/bin
+	${HOME} done cd /usr/bin | grep 'quoted text'
+then | /usr/bin then | readonly cd readonly then test export
+x=1 2>/dev/null 2>/dev/null echo 2>/dev/null awk sed | 2>/dev/null
+${HOME} -eu local | then
+		export 'quoted text' -eu $(pwd)
+	"$1" | readonly export "$1" 'quoted text' --verbose sed 'quoted text'
+	test 2>/dev/null 'quoted text' | echo done readonly $(pwd) then $(pwd)
+	test local cd then ${HOME} -eu 2>/dev/null
+		export test grep "$@" awk && $(pwd) "$@" &&
+	"$@" then 'quoted text' -eu --verbose grep -eu echo readonly local
+	x=1 /usr/bin sed $(pwd) /usr/bin $(pwd) ${HOME} | 2>/dev/null
+		$(pwd) x=1 "$@" awk local | readonly readonly printf printf && | grep test
+		echo "$1" printf then "$@" && "$1" sed export x=1
+grep sed 2>/dev/null cd &&
+echo local readonly local readonly
+	x=1 "$@" /usr/bin export "$1" awk echo printf local
+		then test done export "$1" ${HOME} && -eu 2>/dev/null 'quoted text' done printf
+	printf export grep /usr/bin
+"$1" grep 2>/dev/null x=1 done | printf -eu grep then done x=1 awk
+		sed $(pwd) then readonly 2>/dev/null printf -eu
+		/usr/bin local then /usr/bin ${HOME} test sed 'quoted text'
+2>/dev/null printf 2>/dev/null local -eu -eu --verbose
+done "$1" readonly readonly
+"$1" --verbose /usr/bin test export | then "$1" cd export readonly --verbose
+cd cd /usr/bin 2>/dev/null awk $(pwd) local 2>/dev/null "$@" ${HOME}
+	then | local --verbose "$1" /usr/bin sed ${HOME} local "$@"
+	local then 2>/dev/null sed sed export
+	then export /usr/bin awk test grep 'quoted text' printf "$1"
+	then printf --verbose --verbose local $(pwd)
+done "$1" cd | x=1 done cd test export ${HOME} grep printf
+		2>/dev/null | local readonly
+2>/dev/null | readonly
+		--verbose -eu sed test printf sed
+'quoted text' 2>/dev/null
+	cd x=1 printf $(pwd) test
+		export $(pwd) | export 2>/dev/null 2>/dev/null "$1" | $(pwd) local
+	local --verbose cd printf $(pwd) local && grep 'quoted text'
+	${HOME} 2>/dev/null /usr/bin --verbose sed 2>/dev/null local
+	/usr/bin | && echo ${HOME}
+		readonly && --verbose 2>/dev/null ${HOME} /usr/bin test done /usr/bin then
+	"$1" export readonly -eu "$@" then
+	$(pwd) cd cd readonly 'quoted text' grep 2>/dev/null x=1 -eu local
+		sed echo test grep "$1" $(pwd)
+		test readonly "$1" 'quoted text' --verbose "$@" 'quoted text' -eu /usr/bin
+		awk "$@" export done 'quoted text' awk done echo
+	test -eu /usr/bin -eu printf /usr/bin
+		"$@" 2>/dev/null "$@"
+		cd 2>/dev/null done export "$1" awk grep test grep
+		awk $(pwd) test echo ${HOME} export -eu done sed | done then "$@" && 2>/dev/null
+	| /usr/bin printf done awk 'quoted text' -eu x=1 ${HOME} awk echo "$1" test printf
+	x=1 readonly 'quoted text' | ${HOME}
+/usr/bin cd grep 2>/dev/null "$1" done done $(pwd) /usr/bin sed then && "$1" -eu
+	-eu | test ${HOME} export cd
+	readonly 2>/dev/null "$@" local local -eu 2>/dev/null test test then
+		grep 'quoted text' test && export cd test test /usr/bin "$@" then && --verbose
+		&& echo "$1" ${HOME}
+		-eu --verbose local printf grep --verbose readonly echo --verbose echo echo
+		| 'quoted text' echo grep awk export
+awk --verbose test && 'quoted text'
+		export $(pwd) -eu export sed ${HOME} sed local grep "$@" | x=1 && local readonly
+		echo cd awk "$1" /usr/bin && "$1" test | /usr/bin
+	${HOME} x=1 'quoted text' sed ${HOME} "$1" && done ${HOME} && cd awk
+grep local export 2>/dev/null
+	x=1 "$1" grep && export echo then then printf $(pwd) | local printf
+	x=1 awk | /usr/bin export printf 'quoted text' 2>/dev/null then --verbose
+	-eu ${HOME} done -eu && /usr/bin
+		sed && echo echo "$1" awk && awk export sed --verbose done
+		printf readonly printf --verbose test /usr/bin --verbose ${HOME} cd
+		awk echo echo cd /usr/bin /usr/bin 2>/dev/null && cd | grep $(pwd)
+	readonly /usr/bin "$1" /usr/bin -eu echo "$@" then export echo
+		then awk then sed echo done cd echo done cd echo awk cd printf "$1" $(pwd)
+		"$1" /usr/bin -eu test awk $(pwd) "$1" sed && local --verbose
+		| then 'quoted text'
+	echo sed local --verbose
+${HOME} done printf awk readonly x=1 done local cd
+"$1" test readonly export done test | 2>/dev/null then local
+	${HOME} $(pwd) 'quoted text'
+		awk -eu done done -eu -eu && | --verbose && "$@" sed "$@" test --verbose
+		sed --verbose readonly awk "$1"
+		--verbose /usr/bin then ${HOME} grep
+	| printf readonly local /usr/bin
+| done && sed 'quoted text' | echo && printf local awk then echo echo then
+	/usr/bin "$@" test x=1
+		'quoted text' grep done 'quoted text' printf done done printf --verbose
+	printf && $(pwd) test x=1 readonly printf ${HOME} && local export echo then
+"$@" done $(pwd) -eu |
+/usr/bin -eu test printf $(pwd) export
+$(pwd) done cd done done printf test readonly ${HOME} done 2>/dev/null
+done test done done test sed grep "$@"
+		--verbose ${HOME} /usr/bin 2>/dev/null
+		export test awk $(pwd) 'quoted text' local 'quoted text'
+-eu readonly then x=1 awk cd cd ${HOME} then &&
+		"$@" sed grep test &&
+	awk && $(pwd) x=1 local awk x=1 done $(pwd) ${HOME} && --verbose --verbose then
+awk ${HOME} awk export $(pwd) $(pwd) local printf local printf
+		grep && awk ${HOME} local local then && | readonly -eu
+	echo test 2>/dev/null "$@" -eu readonly
+	export 2>/dev/null -eu test --verbose local x=1 2>/dev/null then echo
+done --verbose export -eu /usr/bin /usr/bin /usr/bin sed
+/usr/bin local sed grep sed ${HOME} awk 2>/dev/null
+		echo 'quoted text' "$1" awk | "$1"
+/usr/bin grep ${HOME} test awk awk printf --verbose 2>/dev/null /usr/bin && |
+	local readonly test | -eu export $(pwd) cd test test
+x=1 awk grep echo 'quoted text' readonly "$@" && ${HOME} -eu local "$1"
+	$(pwd) --verbose then ${HOME} ${HOME} readonly then | cd "$1"
+2>/dev/null --verbose --verbose "$1" --verbose x=1 done "$@" "$@"
+	/usr/bin 2>/dev/null 'quoted text'
+"$@" /usr/bin cd readonly local 2>/dev/null &&
+		readonly "$@" then test done sed "$@" grep readonly
+	awk cd -eu test "$1" "$@" --verbose test sed $(pwd) x=1 -eu
+	-eu /usr/bin done printf export -eu cd /usr/bin printf
+		&& ${HOME} | -eu "$1" printf "$@" ${HOME} "$1" 'quoted text' -eu && test grep
+		2>/dev/null echo 2>/dev/null
+		&& awk 2>/dev/null -eu
+	done then 2>/dev/null
+		| printf awk echo | awk /usr/bin grep /usr/bin
+local -eu --verbose local export then && ${HOME} awk awk 'quoted text'
+	${HOME} local done x=1 readonly sed done "$@" x=1
+grep && $(pwd) "$@" "$1" readonly local -eu grep $(pwd) echo --verbose
+2>/dev/null done echo awk "$@" 2>/dev/null
+	local ${HOME} 2>/dev/null | cd $(pwd) $(pwd) local awk && sed $(pwd)
+		local awk $(pwd) echo && "$@" readonly /usr/bin
+	"$@" /usr/bin --verbose $(pwd) && "$1" /usr/bin awk /usr/bin local 'quoted text'
+		$(pwd) x=1 x=1 | 'quoted text' local | sed -eu 2>/dev/null grep -eu local x=1
+&& grep $(pwd) "$1" "$@" export | grep readonly
+	then echo | ${HOME} x=1 readonly --verbose sed awk 2>/dev/null 'quoted text'
+		"$1" ${HOME} local export ${HOME} --verbose "$1" $(pwd) | awk cd grep
+readonly ${HOME} awk "$1" 2>/dev/null cd test echo readonly
+| && 2>/dev/null | 'quoted text' awk printf ${HOME} | echo
+		printf done readonly echo
+		"$1" "$1" 'quoted text' then && ${HOME} test --verbose export /usr/bin echo sed
+$(pwd) "$@" local 2>/dev/null printf ${HOME}
+--verbose export $(pwd) --verbose x=1 2>/dev/null then test
+#include c16.sh
+	"$@" echo sed local "$1" $(pwd) "$@" export 'quoted text'
+echo then done 2>/dev/null 2>/dev/null awk
+		test export --verbose 2>/dev/null x=1 then readonly
+| /usr/bin | 'quoted text' local echo "$1" echo
+export | "$@" -eu $(pwd)
+	"$@" -eu $(pwd) | 'quoted text' awk test 'quoted text' sed x=1 ${HOME} then
+		&& $(pwd) && grep x=1 grep done $(pwd) "$1"
+	$(pwd) awk | ${HOME} /usr/bin echo 'quoted text'
+		printf && sed 'quoted text' 'quoted text' $(pwd) 2>/dev/null "$@"
+		printf | local ${HOME} printf ${HOME}
+		"$1" test ${HOME} test ${HOME} sed /usr/bin grep 'quoted text' sed ${HOME}
+		"$1" readonly x=1 local printf sed 'quoted text' ${HOME}
+	grep cd /usr/bin --verbose "$@" "$1" cd awk done 2>/dev/null &&
+		echo readonly "$@" ${HOME} export sed grep ${HOME}
+	awk 2>/dev/null sed done x=1 test readonly readonly && ${HOME} 2>/dev/null
+/usr/bin 'quoted text' cd sed --verbose test local test printf sed cd ${HOME}
+grep readonly sed sed local "$@"
+	$(pwd) export cd printf then /usr/bin export "$1" && cd "$@"
+then x=1 -eu export export "$1" --verbose test echo --verbose
+		awk "$@" | x=1 && local $(pwd) $(pwd) awk done
+	$(pwd) cd 2>/dev/null
+readonly awk sed | /usr/bin echo && then
+	sed awk /usr/bin grep grep
+local ${HOME} "$@" -eu ${HOME} printf grep readonly done then
+	echo awk sed -eu && "$@" awk ${HOME} | 'quoted text'
+grep | ${HOME} 'quoted text' 'quoted text'
+then $(pwd) -eu "$1" --verbose -eu done $(pwd) test 'quoted text'
+	echo grep grep $(pwd) | | awk "$1" echo
+	sed local $(pwd) && "$@" x=1
+	"$1" cd export export sed awk 'quoted text'
+	&& test && export "$@" $(pwd) printf 2>/dev/null local 'quoted text'
+	"$1" readonly local x=1 /usr/bin echo
+| sed readonly done then 2>/dev/null
+'quoted text' 'quoted text' readonly echo /usr/bin readonly
+local echo --verbose sed $(pwd) -eu echo ${HOME} echo x=1
+		/usr/bin 2>/dev/null 2>/dev/null 2>/dev/null ${HOME} test ${HOME} $(pwd)
+		readonly export --verbose export "$@" export export local
+		--verbose "$1" && x=1 ${HOME} "$1"
+	${HOME} ${HOME} echo test && test awk readonly "$@" awk $(pwd) then cd 'quoted text'
+		sed "$@" ${HOME} printf | 'quoted text' local | $(pwd) export && grep echo --verbose
+export && export printf x=1 printf printf 2>/dev/null
+	x=1 2>/dev/null export --verbose --verbose x=1 ${HOME} /usr/bin done
+		&& 'quoted text' /usr/bin
+	awk test | awk -eu x=1 sed then sed -eu x=1 then
+		grep "$1" grep 'quoted text' printf printf awk "$@" local echo $(pwd) "$@"
+	printf readonly --verbose ${HOME} readonly --verbose
+		-eu | local 2>/dev/null awk "$@" local export
+| grep done x=1 --verbose 2>/dev/null
+"$1" local | $(pwd) --verbose test done
+	&& ${HOME} readonly done 'quoted text'
+	echo grep cd sed then | "$1" cd sed readonly
+	${HOME} then -eu x=1 then awk 2>/dev/null echo x=1 cd printf grep echo
+		awk awk local $(pwd) $(pwd)
+	test grep awk ${HOME} ${HOME} /usr/bin local then "$@"
+		export 2>/dev/null && && ${HOME} ${HOME}
+test -eu ${HOME} export 2>/dev/null -eu ${HOME} export $(pwd) | sed export
+		test | grep export export echo
+-eu printf -eu grep "$1" &&
+		sed $(pwd) "$1" /usr/bin then echo printf readonly "$@" echo
+$(pwd) && echo /usr/bin test test x=1 echo readonly test
+	done "$1" --verbose 'quoted text' 2>/dev/null then ${HOME}
+readonly local grep "$1" test "$1" -eu cd | local
+2>/dev/null cd x=1 sed printf test -eu readonly /usr/bin
+		echo "$@" awk --verbose $(pwd) -eu then sed /usr/bin $(pwd) done | | /usr/bin /usr/bin
+-eu local cd /usr/bin -eu done 2>/dev/null export awk printf
+		sed export export $(pwd) sed && test $(pwd) then printf grep "$1" "$@"
+x=1 | 'quoted text' local done "$@" grep 2>/dev/null /usr/bin printf
+test sed then then $(pwd) then "$1" then --verbose then | -eu ${HOME} printf
+		grep export x=1 grep ${HOME} test
+		test awk $(pwd) export readonly
+grep echo /usr/bin 2>/dev/null test test printf "$1" cd 'quoted text' 'quoted text'
+&& -eu x=1 awk awk -eu done readonly | --verbose -eu 2>/dev/null x=1
+	| readonly "$@" cd then | --verbose | awk awk "$1"
+	"$@" local printf test --verbose
+		--verbose /usr/bin 2>/dev/null 'quoted text'
+		echo then x=1 grep && grep $(pwd) /usr/bin export grep 2>/dev/null
+'quoted text' $(pwd) sed ${HOME} --verbose
+	/usr/bin done -eu local export -eu echo readonly x=1 done "$@" sed printf |
+	| --verbose /usr/bin --verbose grep
+		| $(pwd) test awk /usr/bin test cd printf echo /usr/bin
+'quoted text' cd export test 'quoted text'
+	done then --verbose echo done 'quoted text' $(pwd) grep
+readonly printf printf grep done local then --verbose /usr/bin cd
+sed local ${HOME} readonly
+		local grep export x=1 echo ${HOME} sed | | grep
+$(pwd) && "$@" test $(pwd)
+	grep sed ${HOME} -eu then sed 'quoted text' sed x=1 local printf
+		sed 'quoted text' $(pwd) "$1" | export
+		done sed then done && printf echo && test readonly x=1 | -eu ${HOME} then
+cd 'quoted text' readonly printf awk "$@" grep && && "$1" printf 2>/dev/null
+		-eu --verbose && sed 2>/dev/null ${HOME}
+local sed awk && "$1" cd echo grep printf
+sed awk cd grep | readonly 'quoted text' then | test readonly export
+	"$1" printf --verbose -eu
+x=1 | awk local --verbose printf 'quoted text' then cd /usr/bin
+		sed cd test then x=1 'quoted text' "$1" ${HOME} "$1" 2>/dev/null 2>/dev/null
+		"$@" $(pwd) local grep sed cd printf ${HOME} && $(pwd) local printf
+	'quoted text' && "$1" test export done 'quoted text' done
+	test && test | $(pwd) --verbose export
+2>/dev/null ${HOME} -eu done done
+	export awk && ${HOME} ${HOME} then sed -eu done 2>/dev/null /usr/bin
+	sed local readonly done echo 'quoted text' /usr/bin sed then grep test
+	"$1" -eu 'quoted text' ${HOME} cd echo x=1 ${HOME} done --verbose "$@" local
+--verbose test grep /usr/bin
+		export 'quoted text' 'quoted text'
+		${HOME} test grep | | printf then /usr/bin sed done
+	&& $(pwd) ${HOME} 2>/dev/null
+		then 'quoted text' test --verbose done sed test /usr/bin sed $(pwd) readonly
+		'quoted text' export "$@" x=1 -eu printf 'quoted text'
+		/usr/bin && --verbose | $(pwd) local export
+		then sed x=1 /usr/bin ${HOME} 'quoted text' done | grep printf
+		readonly test $(pwd) test && --verbose -eu 2>/dev/null "$@"
+		--verbose then awk --verbose $(pwd) "$1" "$@" 'quoted text' done
+	x=1 2>/dev/null /usr/bin local sed $(pwd) sed "$1" awk awk "$1" echo |
+		--verbose awk | && export
+	export "$@" test $(pwd) 2>/dev/null "$1" then 2>/dev/null export
+		x=1 x=1 readonly | done /usr/bin -eu cd local && x=1 then | $(pwd) -eu grep
+	then done /usr/bin echo awk "$1" $(pwd) done readonly ${HOME} local cd -eu
+done readonly then local /usr/bin
+	"$1" ${HOME} done x=1 cd 'quoted text' ${HOME}
+		/usr/bin sed local x=1 'quoted text' $(pwd) then
+	local ${HOME} readonly then && grep test export /usr/bin awk cd ${HOME} echo | 2>/dev/null
+		"$@" test --verbose $(pwd) printf echo export x=1 && printf
+local echo export sed export
+	${HOME} ${HOME} done awk cd awk --verbose 'quoted text'
+done test 'quoted text'
+		local readonly local
+		$(pwd) --verbose echo --verbose && readonly
+		export "$@" sed printf "$@" test -eu then /usr/bin done readonly cd /usr/bin awk
+$(pwd) --verbose 2>/dev/null "$@" printf export ${HOME} /usr/bin grep
+then x=1 readonly test 'quoted text' --verbose
+"$1" $(pwd) /usr/bin printf "$@"
+		grep local cd sed "$1" 2>/dev/null "$1" /usr/bin && export
+	echo | "$@" -eu printf $(pwd) | x=1
+	sed | "$@" echo x=1 echo awk "$1" export | grep printf cd
+--verbose $(pwd) local && echo
+		sed "$@" $(pwd) test "$@" /usr/bin --verbose --verbose $(pwd) done done | test readonly
+		done 2>/dev/null then
+		export /usr/bin --verbose grep local | --verbose awk ${HOME} "$@" ${HOME} export
+	cd | cd 2>/dev/null $(pwd) $(pwd)
+		awk && /usr/bin x=1 test /usr/bin 'quoted text' readonly
+	test -eu 'quoted text' awk awk -eu "$1" export | -eu "$@" && test printf done
+	x=1 -eu && "$1" printf test && grep
+	then -eu --verbose -eu
+	| test readonly cd echo done /usr/bin
+	printf done cd awk && test && echo "$@" 'quoted text'
+		grep local && "$@" 2>/dev/null export 2>/dev/null awk export readonly export
+		'quoted text' echo | sed then
+	"$@" readonly readonly local 'quoted text' sed export readonly x=1 /usr/bin --verbose
+		then -eu 2>/dev/null 'quoted text' export cd done awk
+	&& && | ${HOME} then 2>/dev/null
+${HOME} -eu test 2>/dev/null awk test sed cd $(pwd) && sed readonly test
+	x=1 awk then done sed -eu cd local test
+'quoted text' -eu "$1" | awk then done readonly
+	test cd 2>/dev/null -eu test "$@" && export then sed "$1" printf local awk
+--verbose | then cd readonly --verbose $(pwd) --verbose
+		--verbose echo export sed && readonly sed
+	local test x=1 --verbose 2>/dev/null | local "$1" && sed /usr/bin export | x=1
+export grep readonly then sed sed done cd echo
+	-eu | --verbose then awk local test grep --verbose ${HOME} "$@"
+then && $(pwd) then echo -eu $(pwd) /usr/bin readonly
+cd -eu /usr/bin then x=1 sed $(pwd)
+2>/dev/null local then
+		cd && then ${HOME} && done local x=1 "$1" printf
+-eu awk test awk && -eu /usr/bin 'quoted text' local
+		${HOME} $(pwd) x=1 readonly awk cd cd 'quoted text' -eu | grep cd
+	awk | awk awk then grep sed then cd 2>/dev/null
+	test | awk --verbose --verbose readonly grep /usr/bin export
+	--verbose /usr/bin echo local /usr/bin export -eu printf x=1 ${HOME}
+		--verbose 2>/dev/null x=1 "$@" echo readonly --verbose 2>/dev/null "$@" export
+x=1 "$@" local 'quoted text' --verbose export export x=1 printf x=1 x=1
+--verbose 2>/dev/null "$@" awk ${HOME}
+	x=1 x=1 cd 'quoted text' | --verbose ${HOME} then cd readonly x=1
+		readonly "$@" ${HOME} "$@" echo export
+		2>/dev/null printf --verbose grep done /usr/bin
+export | -eu printf --verbose local done cd done echo export && printf "$1"
+	"$1" export && sed "$1" printf 'quoted text' && cd /usr/bin awk "$@"
+	/usr/bin sed then done echo 'quoted text' local $(pwd) then local
+		awk sed echo 2>/dev/null awk local readonly | 2>/dev/null /usr/bin
+printf | done printf 'quoted text'
+		--verbose sed ${HOME} awk 'quoted text' done printf $(pwd) cd -eu
+	readonly awk done | then
+/usr/bin cd 2>/dev/null test | "$@" 2>/dev/null /usr/bin
+	test cd -eu --verbose test "$@" readonly "$@" awk
+	printf 2>/dev/null "$@" ${HOME} awk ${HOME} sed "$1" ${HOME} | -eu ${HOME}
+	/usr/bin grep grep $(pwd) $(pwd) done local sed local sed
+	awk "$@" local done "$1" -eu && export export x=1 echo echo 'quoted text' done
+		&& /usr/bin ${HOME} --verbose 'quoted text' --verbose
+		/usr/bin 2>/dev/null
+awk && x=1 "$1" --verbose ${HOME} ${HOME} && ${HOME}
+grep 2>/dev/null -eu "$1" readonly
+		| "$1" local "$1" readonly "$@"
+${HOME} $(pwd) "$@" readonly x=1 export awk echo readonly export done /usr/bin
+local 2>/dev/null "$1" done sed 2>/dev/null echo printf -eu "$@" && | -eu /usr/bin
+		${HOME} grep export 'quoted text' then $(pwd)
+	then done export cd readonly x=1 printf -eu --verbose | x=1 | readonly "$@" ${HOME}
+	readonly export printf
+test x=1 'quoted text' x=1 2>/dev/null x=1 sed "$@" readonly local test ${HOME}
+		readonly done -eu "$1" echo /usr/bin
+	--verbose sed sed --verbose "$@" local
+	grep awk /usr/bin $(pwd) test $(pwd) echo echo && readonly ${HOME}
+		readonly --verbose echo &&
+		awk -eu grep test then echo readonly test --verbose done -eu ${HOME}
+test /usr/bin | local awk $(pwd)
+	cd done done --verbose sed cd $(pwd) "$1" "$1" "$@" --verbose then ${HOME}
+	echo readonly grep 2>/dev/null done x=1
+	grep cd 2>/dev/null --verbose ${HOME} echo done readonly $(pwd)
+echo then 2>/dev/null x=1 local | -eu /usr/bin grep
+		readonly 2>/dev/null readonly then local --verbose export 2>/dev/null
+		export echo test --verbose readonly
+		grep 'quoted text' && awk cd | printf grep "$1" --verbose 'quoted text'
+	"$@" local $(pwd) --verbose ${HOME} grep done grep then echo echo sed done awk
+"$@" | x=1 sed /usr/bin && --verbose sed sed "$1"
+	test sed done 2>/dev/null --verbose readonly ${HOME} "$1"
+	x=1 echo awk done "$@" awk 'quoted text' 'quoted text' printf 2>/dev/null
+"$1" local ${HOME} printf /usr/bin x=1 done 'quoted text' grep echo echo echo
+	cd "$@" then done echo "$@" "$1" then then 'quoted text'
+		echo cd echo ${HOME} && x=1 && grep
+		&& done && awk printf test
+sed export then && grep "$@" -eu -eu sed echo --verbose 'quoted text'
+	"$1" ${HOME} /usr/bin export x=1 | then printf "$1" done
+/usr/bin test then /usr/bin x=1 ${HOME} | test 'quoted text'
+		readonly sed && $(pwd) then sed "$1" "$@" sed | printf test "$1" then 'quoted text'
+printf 'quoted text' cd | cd test grep test $(pwd) readonly ${HOME} readonly
+cd printf readonly -eu local 2>/dev/null
+export 2>/dev/null grep
+export --verbose awk 2>/dev/null
+/usr/bin local local 2>/dev/null ${HOME}
+		then export grep ${HOME} local readonly
+		/usr/bin ${HOME} ${HOME} -eu --verbose local "$1" awk && test x=1
+		--verbose sed x=1 readonly
+		cd ${HOME} $(pwd) export 'quoted text' done export export 2>/dev/null
+		"$1" echo cd && grep 2>/dev/null printf --verbose
+		echo -eu --verbose test sed | printf printf awk $(pwd) "$1"
+		done export -eu x=1 test local echo grep
+		| readonly "$@" $(pwd) readonly "$@" cd printf
+	export "$1" "$1" /usr/bin then ${HOME} grep
+	-eu ${HOME} test x=1 /usr/bin sed then readonly | "$@" printf &&
+		grep && /usr/bin awk "$@" echo "$@" done --verbose 2>/dev/null echo --verbose
+		x=1 done export && awk echo ${HOME} 2>/dev/null
+cd $(pwd) /usr/bin printf x=1 -eu 'quoted text'
+"$@" | 'quoted text' -eu ${HOME} && cd "$1" awk export local
+	grep done 'quoted text' | done sed test local $(pwd) grep grep
+| x=1 then awk local readonly x=1 echo /usr/bin printf readonly local
+local "$@" done "$@" ${HOME} readonly then grep local echo cd
+echo sed $(pwd) | 2>/dev/null sed sed awk x=1 readonly
+	-eu export test && "$@"
+	${HOME} /usr/bin 2>/dev/null
+		export sed local 'quoted text' x=1 --verbose
+x=1 grep 'quoted text' && awk echo 'quoted text' ${HOME} --verbose export
+	local | x=1 x=1 /usr/bin cd export then 'quoted text' grep awk
+then grep awk && local sed printf sed export ${HOME} done test | /usr/bin
+		2>/dev/null "$@" readonly grep sed sed ${HOME} -eu local "$1" 2>/dev/null
+	cd awk ${HOME} cd cd test ${HOME} --verbose test && $(pwd) "$@" 2>/dev/null
+		readonly $(pwd) && test sed ${HOME} then && /usr/bin
+"$1" grep $(pwd) && echo ${HOME} grep cd | 'quoted text'
+printf "$@" && awk $(pwd)
+	"$1" echo awk --verbose -eu export readonly printf
+		cd local test grep | $(pwd) awk printf $(pwd) -eu $(pwd) local x=1 'quoted text'
+	'quoted text' && awk --verbose x=1 export "$@"
+		printf export /usr/bin grep --verbose
+	"$@" done export readonly printf 2>/dev/null cd
+| readonly | $(pwd) sed x=1 local 2>/dev/null then |
+	&& then readonly && x=1 printf
+echo test done cd && then
+	x=1 x=1 2>/dev/null --verbose export readonly awk then
+	readonly sed ${HOME} test done test
+		"$@" local then local test echo /usr/bin x=1 done x=1 "$@" x=1 "$@" "$@" readonly
+	echo -eu done test x=1 awk local
+	"$@" ${HOME} export local done /usr/bin grep
+	done export printf $(pwd) local cd 2>/dev/null echo 'quoted text' done | export
+${HOME} grep --verbose
+		| readonly printf ${HOME} x=1 echo /usr/bin awk then export printf grep printf
+		2>/dev/null awk then printf grep export local readonly test -eu "$@" then
+/usr/bin --verbose x=1 readonly /usr/bin export sed "$1" 2>/dev/null sed && cd
+		sed "$@" grep export local echo --verbose
+	'quoted text' x=1 echo cd sed 'quoted text'
+	done grep "$1" local 2>/dev/null &&
+		done test awk test 2>/dev/null "$1" /usr/bin awk then && 'quoted text'
+grep echo 'quoted text' x=1 "$1" awk cd | grep awk then awk then awk echo | -eu
+		done /usr/bin x=1 /usr/bin /usr/bin sed then local && "$@" readonly
+		local then printf printf $(pwd) local
+&& cd echo export /usr/bin export | ${HOME} | sed && grep -eu --verbose
+		$(pwd) x=1 done done done awk done && test x=1 sed | then -eu "$@" test | grep
+		x=1 && printf echo then sed -eu 2>/dev/null x=1 done local 2>/dev/null
+	'quoted text' awk && readonly $(pwd) /usr/bin -eu export sed /usr/bin "$@" -eu
+	2>/dev/null x=1 | awk sed awk "$@" grep
+		echo done "$1" sed local export
+		'quoted text' "$@" $(pwd) /usr/bin readonly --verbose then test then -eu -eu x=1
+	2>/dev/null "$1" printf awk done local printf $(pwd)
+	"$1" $(pwd) "$@" "$@" then | printf done x=1 sed readonly --verbose
+-eu printf readonly export grep
+	echo --verbose -eu awk /usr/bin echo && "$@" readonly --verbose /usr/bin --verbose
+then && sed && | local
+		export local 'quoted text' done grep echo ${HOME}
+		awk 2>/dev/null ${HOME} $(pwd) then x=1 echo sed done grep test echo
+	test ${HOME} echo cd sed cd /usr/bin then $(pwd) local x=1 "$@" ${HOME}
+	printf sed sed grep 2>/dev/null test
+"$@" printf local $(pwd) sed printf /usr/bin "$1" 'quoted text' -eu --verbose
+echo awk "$@" --verbose ${HOME} sed readonly "$@" $(pwd) 'quoted text'
+"$1" readonly readonly echo /usr/bin --verbose 'quoted text'
+	"$@" 'quoted text' test then && export -eu grep "$@" $(pwd)
+export printf ${HOME} echo printf then done
+	/usr/bin then ${HOME} -eu test
+x=1 -eu local $(pwd) x=1 printf "$1" printf 'quoted text'
+	"$@" export awk && printf && echo | echo /usr/bin -eu x=1
+		/usr/bin echo printf x=1 cd --verbose --verbose $(pwd)
+readonly /usr/bin done -eu
+		export grep sed awk done
+cd awk ${HOME} printf && | then test
+local | "$1" -eu 2>/dev/null 2>/dev/null "$1" | done "$1" then
+x=1 echo 'quoted text' && done -eu then export local echo | export printf
+test then | local export sed "$1" done awk readonly printf grep "$@"
+		printf export /usr/bin | grep export
+		&& $(pwd) $(pwd) echo $(pwd) && -eu $(pwd) done /usr/bin
+		done printf readonly /usr/bin grep export echo x=1 /usr/bin --verbose
+$(pwd) | grep readonly | awk /usr/bin printf cd grep
+		2>/dev/null /usr/bin then | readonly && printf done | "$1" export
+		grep 2>/dev/null 2>/dev/null grep && sed -eu
+&& cd then /usr/bin grep readonly
+	2>/dev/null then readonly
+		$(pwd) "$@" local x=1
+	${HOME} 2>/dev/null 'quoted text' printf then /usr/bin test --verbose
+"$@" 'quoted text' 2>/dev/null grep ${HOME} "$@" "$@" echo then export /usr/bin
+		'quoted text' -eu | ${HOME} readonly printf echo ${HOME} 'quoted text' /usr/bin
+	export awk "$1" | local "$1" 2>/dev/null
+	"$1" test "$1" then cd then | --verbose
+		cd && /usr/bin cd sed
+	printf printf | 2>/dev/null
+$(pwd) "$1" --verbose && awk && "$@" 2>/dev/null 'quoted text'
+		printf /usr/bin grep 'quoted text' printf
+		sed "$1" 'quoted text' && --verbose echo /usr/bin
+		"$1" sed "$1" ${HOME} local /usr/bin /usr/bin sed sed -eu then --verbose
+		export done readonly && "$@" echo printf --verbose echo awk printf done -eu $(pwd)
+		export local export export /usr/bin printf
+/usr/bin /usr/bin echo 'quoted text' && grep then export readonly ${HOME} then
+		printf x=1 $(pwd) $(pwd) x=1 $(pwd) done test 'quoted text'
+		test grep && x=1 && | -eu local 2>/dev/null "$1"
+		echo "$1" "$1" readonly printf "$1" printf /usr/bin sed grep "$1" sed echo 'quoted text'
+	x=1 cd sed awk done "$1" /usr/bin grep && && "$1" then -eu export local
+	readonly && then 'quoted text'
+		'quoted text' awk grep grep 2>/dev/null echo awk done
+2>/dev/null printf && grep done test sed -eu then
+		${HOME} 'quoted text' 2>/dev/null done readonly x=1 echo export
+	'quoted text' readonly /usr/bin -eu --verbose test "$@" grep | export
+cd ${HOME} 2>/dev/null readonly && -eu grep ${HOME} "$1" cd 'quoted text'
+	cd done then grep $(pwd) echo awk local x=1 $(pwd) done awk ${HOME}
+test export export 'quoted text' ${HOME} grep export ${HOME} x=1 cd then
+	test done | $(pwd) echo --verbose -eu | --verbose
+	echo 2>/dev/null readonly 2>/dev/null test "$1" x=1 /usr/bin
+		$(pwd) 2>/dev/null -eu 'quoted text' /usr/bin --verbose
+	| export -eu "$1" test --verbose ${HOME} "$1"
+	x=1 test 2>/dev/null then | "$@" ${HOME} grep x=1
+		printf then sed sed ${HOME} && ${HOME} local echo "$@" x=1 sed sed sed 2>/dev/null
+sed echo done | test 'quoted text' done grep echo
+x=1 x=1 -eu x=1 export cd $(pwd) awk x=1 test
+		"$1" then done grep done export 'quoted text' awk test grep printf echo x=1
+	${HOME} 2>/dev/null && readonly "$@" $(pwd)
+		"$@" --verbose export /usr/bin
+		then 2>/dev/null /usr/bin $(pwd) grep echo ${HOME}
+2>/dev/null 'quoted text'
+	local "$@" sed then printf printf
+"$@" printf done /usr/bin x=1 cd test --verbose
+		sed test then echo /usr/bin
+	export "$@" $(pwd) 2>/dev/null then ${HOME} "$1" printf
+| test then cd export grep ${HOME}
+		-eu && ${HOME} && "$1" --verbose && done "$@" &&
+		"$1" $(pwd) --verbose $(pwd) cd
+	done "$@" test x=1 -eu && awk "$1" grep "$1" done --verbose then
+	"$1" | "$@" --verbose test awk awk sed "$@" then grep | export
+	done local --verbose --verbose
+done /usr/bin 'quoted text' awk then awk cd then echo && awk cd
+		readonly export /usr/bin test 2>/dev/null | ${HOME}
+	then | x=1 sed | /usr/bin then local x=1 -eu export --verbose
+	x=1 --verbose cd x=1 cd | then sed x=1 readonly test /usr/bin done grep "$@"
+	awk export sed x=1 && export done sed -eu ${HOME} "$@" "$@"
+	"$1" echo "$@" 2>/dev/null &&
+echo printf local readonly 'quoted text' test "$@" readonly
+printf sed --verbose ${HOME} 2>/dev/null
+-eu 2>/dev/null export $(pwd) then "$1" awk test -eu $(pwd) cd x=1
+| && "$@" readonly local 'quoted text' -eu
+cd test "$1" sed 2>/dev/null test test -eu "$@" /usr/bin 'quoted text' "$@" $(pwd)
+	grep grep --verbose 2>/dev/null
+"$1" done $(pwd) $(pwd) grep
+		$(pwd) && echo grep | echo test 2>/dev/null readonly x=1 export readonly
+	${HOME} awk -eu export
+		local --verbose "$1" done $(pwd) && printf
+/usr/bin then 'quoted text' echo ${HOME} local
+'quoted text' "$@" "$1" sed "$1" echo
+	"$1" && ${HOME} grep | "$1" sed cd local "$@" local printf done
+		--verbose then grep 'quoted text' /usr/bin | readonly cd printf grep
+	cd local $(pwd) awk "$1" 2>/dev/null ${HOME} printf --verbose echo
+		cd -eu 2>/dev/null test && then printf "$1" | grep -eu $(pwd) 2>/dev/null
+	-eu cd ${HOME} awk 2>/dev/null sed test ${HOME} 'quoted text'
+	$(pwd) | /usr/bin export -eu printf
+	--verbose export grep -eu test
+		local export readonly --verbose "$@"
+		"$@" readonly /usr/bin awk ${HOME} && 2>/dev/null then printf echo
+		local export sed -eu && sed awk printf 2>/dev/null
+		| local | local | printf -eu echo x=1 'quoted text' $(pwd) readonly 'quoted text'
+"$1" /usr/bin sed | 2>/dev/null done cd cd && readonly
+	2>/dev/null echo done then 'quoted text' x=1 echo grep 'quoted text' local $(pwd)
+		2>/dev/null sed grep export
+sed $(pwd) | printf readonly test "$@" && "$@" ${HOME} local
+	done x=1 cd | && -eu cd readonly | printf done printf 'quoted text' done local
+then -eu "$1" cd export -eu $(pwd)
+		-eu | "$1" cd test echo local &&
+	awk echo | -eu test 2>/dev/null x=1 echo done printf
+		"$1" test awk then /usr/bin readonly
+awk awk x=1 2>/dev/null --verbose readonly ${HOME} "$1" awk /usr/bin printf export
+		"$@" | --verbose 'quoted text' grep local
+		grep "$1" readonly x=1 | grep cd cd --verbose
+		echo 'quoted text' 'quoted text'
+		grep -eu 2>/dev/null $(pwd) | sed
+	"$@" cd local && printf 2>/dev/null done /usr/bin && sed && sed -eu 2>/dev/null
+		${HOME} ${HOME} echo x=1 $(pwd) printf --verbose 2>/dev/null 'quoted text' /usr/bin
+--verbose readonly 'quoted text'
+	2>/dev/null && cd done ${HOME} "$1" "$1" --verbose ${HOME} awk printf sed grep
+done | awk cd sed ${HOME} --verbose ${HOME} -eu 2>/dev/null printf
+"$1" test echo ${HOME} grep ${HOME} echo cd --verbose sed sed cd $(pwd) test
+		done 'quoted text' local --verbose -eu grep printf /usr/bin cd 2>/dev/null
+&& "$@" done ${HOME} --verbose x=1 sed printf "$@" ${HOME} "$1"
+	${HOME} x=1 && then echo cd $(pwd) && ${HOME} export printf echo
+cd ${HOME} done -eu done --verbose local 'quoted text' grep ${HOME} printf echo
+	--verbose | && done grep 2>/dev/null | echo x=1 grep done x=1 then
+	grep readonly echo $(pwd) 'quoted text' then readonly echo awk
+		readonly ${HOME} x=1 echo export cd printf 2>/dev/null -eu echo sed | then 2>/dev/null
+	-eu "$1" 'quoted text' then cd test 2>/dev/null export
+	test done ${HOME} export -eu 'quoted text' 'quoted text'
+	readonly done $(pwd) local $(pwd) $(pwd) cd x=1 "$@" -eu "$@" done export
+cd x=1 cd readonly cd grep
+	${HOME} done && done -eu 'quoted text' --verbose 2>/dev/null
+	"$@" ${HOME} 'quoted text' grep /usr/bin done "$1" ${HOME} sed done sed x=1 readonly
+awk test --verbose done local local local
+readonly printf $(pwd) "$@" then
+		readonly readonly then x=1 sed ${HOME} 2>/dev/null readonly "$1" --verbose "$1"
+"$1" awk grep x=1 | printf /usr/bin then printf x=1 &&
+		x=1 done printf 2>/dev/null sed --verbose local test 2>/dev/null ${HOME}
+		| "$@" then then cd -eu echo
+		-eu ${HOME} test echo echo $(pwd) grep -eu test /usr/bin x=1 local
+		done test x=1 "$@" $(pwd)
+	readonly --verbose local "$@" test
+		"$1" awk -eu printf grep "$1" then "$@" $(pwd) local then sed -eu
+| $(pwd) x=1 "$1" -eu sed awk ${HOME} export cd x=1 ${HOME}
+		awk --verbose | then -eu export printf test && x=1 cd -eu /usr/bin cd
+		${HOME} -eu $(pwd) local $(pwd) && && 'quoted text' $(pwd) 2>/dev/null done 'quoted text'
+		readonly 2>/dev/null ${HOME} cd then ${HOME}
+		&& x=1 "$1" export grep export "$@" then echo done x=1 echo awk grep "$@" sed
+	${HOME} && readonly cd then 2>/dev/null "$@" cd |
+		'quoted text' 'quoted text' cd grep export && printf echo
+test echo then "$@" local local x=1 awk "$1" 'quoted text'
+		printf local sed "$1"
+		grep 2>/dev/null $(pwd) readonly done cd echo ${HOME} -eu "$1" &&
+	-eu 'quoted text' "$1" done
+		then 2>/dev/null 'quoted text' && $(pwd)
+		/usr/bin "$@" /usr/bin "$@" 2>/dev/null | 'quoted text' | -eu sed echo cd --verbose
+-eu echo $(pwd) cd "$@" done printf 'quoted text' "$@"
+		test done ${HOME} readonly printf 'quoted text' 2>/dev/null
+| /usr/bin x=1 cd printf x=1 | test then done 'quoted text' -eu "$1"
+| "$1" -eu test done ${HOME} --verbose export awk /usr/bin
+	awk "$1" awk export local "$@" | && x=1 grep "$1" echo /usr/bin -eu "$1" export
+	--verbose awk sed grep x=1 test -eu $(pwd) grep &&
+&& -eu then sed cd grep test done x=1 then echo "$@" grep done sed
+	/usr/bin ${HOME} x=1 grep | done "$1" test x=1 done | $(pwd)
+readonly --verbose awk && printf test $(pwd) sed 2>/dev/null
+	readonly cd 2>/dev/null printf export readonly readonly /usr/bin /usr/bin
+		/usr/bin --verbose sed export "$1" &&
+	--verbose readonly sed /usr/bin
+'quoted text' 'quoted text' -eu x=1 "$@" printf grep && test printf 'quoted text'
+	2>/dev/null done export x=1 echo "$1" /usr/bin test done "$1" export 'quoted text'
+		'quoted text' grep readonly ${HOME} awk export awk
+	"$@" local readonly export
+		export done grep /usr/bin x=1 then x=1 x=1 export "$1" --verbose
+		2>/dev/null $(pwd) test sed printf | sed sed "$1" test done | && /usr/bin
+		2>/dev/null cd local | -eu x=1 | test ${HOME} && cd grep && --verbose
+	test echo $(pwd) x=1
+$(pwd) awk $(pwd) grep "$@" -eu grep x=1 | 2>/dev/null 'quoted text'
+		local test done && test sed awk 2>/dev/null readonly grep
+	done done then cd 2>/dev/null 2>/dev/null "$@" local
+"$@" grep -eu done sed readonly export printf $(pwd)
+		then 'quoted text' "$1" echo done cd grep 'quoted text' --verbose
+--verbose export local "$1" x=1
+awk --verbose | $(pwd) echo local sed
+		cd test echo ${HOME} then export | --verbose cd done test
+	sed "$@" && sed $(pwd) cd then /usr/bin 'quoted text' test
+	${HOME} test done $(pwd) readonly awk printf
+		done grep awk | $(pwd) | printf 2>/dev/null
+readonly ${HOME} "$@" "$@" then
+		x=1 /usr/bin -eu readonly
+		&& "$1" 'quoted text' -eu ${HOME} 2>/dev/null 2>/dev/null
+	"$1" sed "$@" | 'quoted text' test -eu grep done echo awk x=1 "$@" 'quoted text'
+		'quoted text' /usr/bin 2>/dev/null ${HOME} && $(pwd) grep
+	readonly "$@" echo test ${HOME} grep && "$@" awk done done test then 2>/dev/null
+		export echo "$1" readonly then 'quoted text' done
+		'quoted text' then sed x=1 /usr/bin
+		export 2>/dev/null echo |
+		export --verbose then printf readonly
+	echo 2>/dev/null | printf local echo 'quoted text' 2>/dev/null
+grep "$1" && "$1" printf printf done 'quoted text'
+	-eu echo local then /usr/bin awk grep "$1"
+	readonly done then echo local sed then 'quoted text'
+		sed readonly cd then --verbose printf 'quoted text'
+--verbose $(pwd) 2>/dev/null "$1" 'quoted text'
+	-eu export readonly | && test x=1 -eu sed done then cd grep then ${HOME} "$1"
+&& /usr/bin done | grep local ${HOME} sed sed
+export export printf awk echo "$@" cd then test "$1" test export &&
+		&& && ${HOME} test awk cd 'quoted text' done && echo test readonly
+	/usr/bin grep /usr/bin awk printf test x=1 printf --verbose
+	cd --verbose test cd x=1 then 'quoted text'
+		awk --verbose sed test /usr/bin local
+	/usr/bin | "$@" $(pwd) sed then echo readonly /usr/bin
+		awk && then /usr/bin ${HOME} --verbose
+	$(pwd) then && grep x=1 export && grep 2>/dev/null "$1" export
+	"$1" /usr/bin then /usr/bin done local &&
+"$@" then && done x=1 /usr/bin --verbose cd printf cd && export && echo
+then 'quoted text' awk done "$@" "$@" 2>/dev/null ${HOME} readonly $(pwd)
+		${HOME} ${HOME} ${HOME} | grep cd "$@" $(pwd) && x=1 2>/dev/null
+-eu 'quoted text' export test | $(pwd) cd local echo 2>/dev/null "$1"
+cd echo ${HOME} 'quoted text' readonly
+	done /usr/bin test --verbose grep -eu 2>/dev/null grep
+	sed 2>/dev/null ${HOME} "$1" --verbose --verbose
+	/usr/bin 'quoted text' grep --verbose "$@" cd local && "$1" then readonly
+'quoted text' export printf cd local printf | && done --verbose "$1" $(pwd)
+	grep grep then export sed
+	/usr/bin --verbose && x=1
+		--verbose awk done x=1 $(pwd) x=1 x=1 2>/dev/null printf sed
+		printf $(pwd) x=1 /usr/bin $(pwd)
+	cd "$1" cd sed $(pwd) | -eu $(pwd) "$@"
+	done local test ${HOME} "$@" done test "$1" test export --verbose
+	local -eu echo 'quoted text' && done sed x=1 printf 'quoted text' export
+		printf printf echo $(pwd) grep ${HOME} test ${HOME}
+		"$@" grep /usr/bin 'quoted text' grep ${HOME} readonly
+		local readonly test 2>/dev/null awk -eu x=1 sed &&
+local grep done printf done cd ${HOME} then local sed echo
+--verbose --verbose echo --verbose "$@" done 2>/dev/null
+	done --verbose x=1 test 2>/dev/null
+		'quoted text' done "$@" cd awk 'quoted text' grep readonly 'quoted text'
+	export test /usr/bin 'quoted text' $(pwd) "$1" | -eu
+		local cd echo test export then printf cd local &&
+	$(pwd) export ${HOME} | printf
+		awk readonly "$@" sed local -eu local
+		local ${HOME} done echo done awk "$1" printf
+2>/dev/null 2>/dev/null sed
+		awk /usr/bin 'quoted text' echo | x=1 sed local ${HOME} x=1 printf --verbose
+then | $(pwd) sed cd local /usr/bin sed ${HOME} printf
+		test "$1" local local echo ${HOME} printf cd && done grep
+export cd $(pwd) export done cd 2>/dev/null
+export readonly "$@" test $(pwd) sed
+	| test sed awk ${HOME} local echo
+grep ${HOME} local printf test printf
+		&& test 'quoted text' then sed test 2>/dev/null
+2>/dev/null readonly --verbose 2>/dev/null --verbose local sed
+	&& cd "$1" cd x=1 | 'quoted text' /usr/bin cd awk 2>/dev/null readonly && &&
+"$1" cd --verbose test | export && 'quoted text' $(pwd) ${HOME} "$1" "$@" -eu "$@"
+sed local awk test printf printf
+local awk echo --verbose echo
+	test -eu 2>/dev/null export grep sed cd "$1"
+		test -eu "$1" $(pwd) readonly
+	readonly --verbose "$@" -eu printf local "$@" x=1 'quoted text'
+		2>/dev/null sed readonly "$@" ${HOME} 'quoted text' 'quoted text'
+		| -eu awk 'quoted text' && 2>/dev/null then test test && then && 2>/dev/null
+x=1 $(pwd) cd ${HOME} then printf export sed awk $(pwd) readonly sed 'quoted text'
+		test grep cd && then /usr/bin /usr/bin ${HOME} 2>/dev/null $(pwd) readonly | local
+local 'quoted text' cd | grep /usr/bin 'quoted text' then | 2>/dev/null
+		grep 'quoted text' readonly "$1" x=1 /usr/bin echo -eu "$@" /usr/bin
+x=1 "$1" then test done "$1" printf
+		&& | && | $(pwd) 2>/dev/null ${HOME} ${HOME}
+		readonly export | | awk ${HOME} ${HOME} export then
+	awk echo grep local ${HOME}
+"$@" then --verbose "$1" ${HOME}
+		printf sed export 2>/dev/null | local readonly grep done /usr/bin
+		--verbose done readonly "$1" $(pwd) "$1" 'quoted text'
+	then cd readonly grep -eu -eu "$1" && 2>/dev/null 2>/dev/null
+local awk -eu readonly $(pwd) $(pwd) readonly then echo sed x=1
+		printf && done 'quoted text' printf then $(pwd) echo
+2>/dev/null -eu "$@" 'quoted text'
+		x=1 local readonly -eu x=1 readonly
+then export local echo then 2>/dev/null $(pwd) "$1" export | | printf
+		sed sed done echo cd local "$1" test grep x=1 $(pwd) grep local
+		${HOME} done x=1 && /usr/bin done | x=1 readonly
+	export -eu 2>/dev/null && /usr/bin --verbose --verbose readonly
+		done --verbose && x=1 echo then
+		sed "$1" ${HOME} export local cd done "$@" | local sed echo sed 2>/dev/null
+	awk /usr/bin cd then test 2>/dev/null -eu awk local --verbose && awk
+		done grep x=1 && echo && && local
+		--verbose echo test readonly -eu -eu test then 'quoted text' local export x=1 readonly
+	then /usr/bin x=1 && echo sed 2>/dev/null $(pwd)
+	grep local -eu "$1" 2>/dev/null --verbose
+	printf cd awk then sed 2>/dev/null
+	'quoted text' awk test export cd readonly && x=1 sed grep
+		readonly --verbose -eu test then done /usr/bin echo ${HOME} $(pwd) readonly done
+awk local export readonly 2>/dev/null
+	readonly "$1" grep x=1 sed 'quoted text' echo "$1"
+	/usr/bin x=1 x=1 | "$@" $(pwd) sed done readonly ${HOME} test cd printf
+		printf "$@" awk then $(pwd) 'quoted text' x=1 then /usr/bin x=1 sed grep
+cd done done test done local 'quoted text' $(pwd) test $(pwd) ${HOME} readonly
+		2>/dev/null 'quoted text' export $(pwd) $(pwd)
+	done readonly printf
+	--verbose grep done sed readonly "$1" 2>/dev/null
+	2>/dev/null export 2>/dev/null && then then --verbose readonly x=1 --verbose grep
+		&& readonly grep /usr/bin echo 2>/dev/null
+		done then ${HOME} | 'quoted text' | /usr/bin
+	| grep "$1" printf test cd "$@" printf export 'quoted text' | then 'quoted text'
+"$@" "$@" sed "$1" "$1" readonly awk readonly "$@" done $(pwd) --verbose
+		awk printf --verbose awk
+		grep 2>/dev/null | | ${HOME} cd echo grep "$@" 'quoted text'
+		-eu test -eu 'quoted text' test 2>/dev/null
+	awk readonly ${HOME} && printf then 'quoted text'
+		&& /usr/bin x=1 printf /usr/bin 'quoted text' x=1 sed /usr/bin
+| 2>/dev/null /usr/bin && printf /usr/bin then test echo grep
+	--verbose $(pwd) test "$1" sed /usr/bin
+export done "$1" local "$1" grep -eu x=1 "$1" &&
+local then grep "$1" | x=1 awk echo grep $(pwd) cd /usr/bin
+	grep readonly x=1 export 'quoted text' x=1 readonly && readonly 2>/dev/null
+${HOME} && "$1" grep awk "$1" sed x=1 then --verbose
+	"$1" -eu test && local && $(pwd) then readonly | "$@"
+		export awk cd done /usr/bin -eu export
+	awk --verbose grep printf sed -eu --verbose 'quoted text' echo 'quoted text'
+printf echo --verbose readonly "$@" 2>/dev/null -eu then x=1 local export local
+test ${HOME} printf 2>/dev/null
+		| printf && test readonly ${HOME} export /usr/bin /usr/bin printf $(pwd) x=1
+	local sed then export --verbose 'quoted text' /usr/bin
+/usr/bin done cd echo done test && /usr/bin "$@" "$@" test then "$@" echo "$@"
+	local /usr/bin $(pwd) "$@" echo readonly | awk echo
+	sed 'quoted text' grep local
+		/usr/bin 2>/dev/null && 'quoted text'
+"$@" echo then "$@" awk awk sed "$1"
+		test /usr/bin /usr/bin | then echo && grep then
+		"$1" then test export ${HOME} ${HOME} ${HOME}
+done "$1" cd && readonly 2>/dev/null cd readonly cd grep done test 'quoted text'
+	| /usr/bin $(pwd) && echo
+done /usr/bin then -eu && --verbose done local
+printf "$@" ${HOME} export awk "$1" ${HOME}
+	export x=1 local printf awk
+		awk grep "$@" sed "$1" "$1" echo $(pwd) $(pwd) test awk | 'quoted text'
+		awk done $(pwd) $(pwd) awk local then && && | awk
+	"$@" export ${HOME} "$1" done local $(pwd) local "$@" ${HOME} echo cd cd local
+	export echo -eu readonly "$1"
+'quoted text' --verbose printf printf
+x=1 sed "$@" ${HOME} |
+	&& grep $(pwd) && echo -eu awk -eu /usr/bin echo | readonly "$1" echo $(pwd)
+	echo /usr/bin "$1" /usr/bin local && export $(pwd)
+		test && awk echo awk test test
+readonly awk 'quoted text'
+	| done /usr/bin cd echo readonly --verbose
+		awk export /usr/bin cd readonly "$1"
+/usr/bin done readonly "$1" --verbose ${HOME} local /usr/bin
+	awk | then /usr/bin $(pwd) readonly "$1" | "$@" /usr/bin x=1 sed
+	cd echo /usr/bin | cd
+	readonly test -eu done "$@" grep x=1 cd export "$1" 'quoted text'
+		/usr/bin && "$@" then --verbose done local /usr/bin export
+	2>/dev/null sed awk readonly echo "$1" | ${HOME}
+		$(pwd) cd $(pwd) echo | --verbose done ${HOME}
+		'quoted text' grep sed printf | local echo "$1" echo then /usr/bin local readonly
+echo --verbose $(pwd) /usr/bin "$1" echo | "$1" grep "$@" "$@" x=1
+	--verbose grep readonly "$@" readonly "$@" -eu ${HOME} then
+		cd then "$@" cd echo grep test done echo
+"$1" "$1" local x=1 printf
+		test "$1" cd && done grep awk x=1
+		done ${HOME} -eu /usr/bin then "$@" sed readonly "$@" $(pwd) | && 'quoted text'
+		done --verbose readonly "$1" x=1
+then 'quoted text' export
+	x=1 ${HOME} test done x=1
+		done --verbose x=1 --verbose grep then ${HOME} done 'quoted text' 2>/dev/null
+then 'quoted text' awk 'quoted text' |
+export /usr/bin "$1" readonly export export 2>/dev/null then
+		readonly 2>/dev/null "$@" 'quoted text' 2>/dev/null | echo $(pwd) awk awk cd -eu
+	/usr/bin awk sed 2>/dev/null /usr/bin | done && local "$1" --verbose
+"$@" -eu echo 2>/dev/null
+2>/dev/null done 'quoted text' "$@" ${HOME}
+--verbose && | cd then $(pwd) done 2>/dev/null
+	local | "$@" "$@" ${HOME} "$@" ${HOME} grep
+export done | export 'quoted text' 'quoted text' | then | sed grep readonly export
+		"$1" && -eu "$@" local echo then awk sed awk
+	'quoted text' awk cd "$@"
+		cd "$@" -eu echo -eu echo grep export x=1 export test $(pwd)
+	"$1" 'quoted text' "$@" x=1 readonly printf done "$1" x=1 printf | | && ${HOME}
+	cd x=1 readonly -eu "$@" awk printf | readonly && x=1 sed $(pwd)
+	sed ${HOME} $(pwd) sed printf awk awk done
+	printf printf 2>/dev/null then cd grep echo printf cd printf && ${HOME} 2>/dev/null
+	test grep then "$1" grep | local awk | export
+	"$@" x=1 "$@" -eu then then | |
+		awk /usr/bin grep x=1 ${HOME} echo x=1 -eu "$@" | readonly 2>/dev/null 'quoted text'
+done readonly --verbose test | sed x=1 2>/dev/null cd done -eu printf export
+--verbose test done ${HOME} "$@" printf awk echo readonly
+echo local cd "$@" 'quoted text' sed 2>/dev/null then readonly done
+	--verbose awk ${HOME} -eu grep printf x=1 test
+	"$1" && && $(pwd) && done test /usr/bin $(pwd) -eu done then $(pwd) printf
+		-eu sed 'quoted text' | readonly "$1" export --verbose awk 'quoted text'
+${HOME} done local 'quoted text'
+'quoted text' && "$@" done echo readonly 2>/dev/null sed 2>/dev/null test
+cd x=1 2>/dev/null sed cd done "$@" "$1" --verbose export 2>/dev/null $(pwd) 'quoted text'
+${HOME} --verbose 'quoted text'
+grep export cd 2>/dev/null test sed
+grep ${HOME} done done grep && readonly awk && done
+		&& local -eu | test done then sed && awk "$1" 2>/dev/null -eu echo /usr/bin
+		grep readonly printf cd done readonly ${HOME}
+"$@" 'quoted text' then 'quoted text'
+		-eu 'quoted text' local sed awk readonly awk 2>/dev/null | | |
+local $(pwd) sed printf awk awk test --verbose
+		/usr/bin /usr/bin test printf export local "$@" && export export
+		readonly $(pwd) printf 2>/dev/null
+	2>/dev/null sed cd awk -eu readonly x=1 echo
+	x=1 readonly && export x=1 local cd grep 2>/dev/null 'quoted text'
+$(pwd) sed echo done then test local --verbose x=1 readonly
+		cd ${HOME} | | test local | printf done -eu
+	local awk $(pwd) /usr/bin x=1 && awk
+	${HOME} sed ${HOME} cd ${HOME} ${HOME} readonly
+grep echo && && test test ${HOME} readonly then printf local sed ${HOME}
+		readonly local printf export ${HOME} 'quoted text'
+	sed grep --verbose | grep --verbose 'quoted text' grep $(pwd)
+		-eu echo && -eu --verbose export 2>/dev/null "$1"
+		'quoted text' local 2>/dev/null
+readonly awk /usr/bin echo echo
+		| cd sed local local && &&
+	${HOME} "$1" $(pwd) "$@" ${HOME} | readonly | ${HOME} local ${HOME}
+&& export awk "$@" local awk readonly echo test /usr/bin 'quoted text' readonly
+&& /usr/bin "$@" readonly "$@"
+		-eu cd test && echo test done local && awk "$@" $(pwd) --verbose echo 'quoted text'
+test printf echo grep 2>/dev/null /usr/bin awk
+		cd && sed 'quoted text' ${HOME} x=1 'quoted text' | done
+"$@" "$@" done ${HOME} test echo then awk cd echo
+	echo test ${HOME} "$1"
+	"$@" readonly 'quoted text' "$@"
+	$(pwd) test && done done readonly "$1" /usr/bin 2>/dev/null awk
+		--verbose cd echo done cd --verbose x=1 then printf -eu grep ${HOME} 2>/dev/null
+	echo echo printf sed printf $(pwd) readonly ${HOME} &&
+x=1 printf 2>/dev/null "$1" test -eu | $(pwd) local | awk export
+		${HOME} readonly awk then readonly -eu
+printf then grep done 2>/dev/null then 2>/dev/null x=1 awk
+		cd ${HOME} $(pwd) export /usr/bin cd ${HOME} awk $(pwd)
+	echo -eu done done /usr/bin printf -eu -eu "$@" "$@" echo | "$@"
+	&& sed awk readonly x=1 printf then readonly echo "$1" printf
+	2>/dev/null | sed cd |
+| x=1 | done ${HOME} then x=1
+		--verbose sed grep --verbose sed
+		'quoted text' awk x=1 "$@" sed cd --verbose "$@" cd export ${HOME}
+	printf --verbose then then /usr/bin export -eu cd x=1 then | | /usr/bin printf export
+printf cd -eu && printf sed test local x=1 --verbose printf $(pwd)
+		2>/dev/null readonly test
+	printf "$1" -eu sed grep sed printf && test
+	$(pwd) local | test && readonly grep $(pwd)
+		${HOME} grep test /usr/bin sed -eu "$@" "$@" | "$@" /usr/bin
+cd "$@" then done x=1 echo export && awk ${HOME}
+test && sed grep local sed $(pwd) awk then /usr/bin $(pwd) x=1 sed test printf
+| done 'quoted text' export 2>/dev/null test
+		--verbose local done x=1 -eu printf "$@" local echo test
+done done && ${HOME} --verbose
+	| 'quoted text' export echo 2>/dev/null | readonly "$@"
+		"$@" 2>/dev/null sed local readonly $(pwd) grep $(pwd)
+		"$@" /usr/bin ${HOME} echo printf grep done
+x=1 && ${HOME} ${HOME} "$1" export /usr/bin
+		local then test awk | && x=1 cd "$1"
+	--verbose $(pwd) 'quoted text' then $(pwd)
+		cd echo | $(pwd) readonly 'quoted text'
+		| "$@" readonly grep ${HOME} -eu 2>/dev/null
+		sed local -eu cd test then "$@" && 'quoted text'
+		2>/dev/null 2>/dev/null then ${HOME} x=1 'quoted text' then ${HOME} local
+		&& local readonly /usr/bin "$1" done $(pwd) local $(pwd) $(pwd)
+printf "$1" awk -eu $(pwd) printf local test ${HOME}
+grep cd "$@" && x=1 "$@" /usr/bin -eu test done /usr/bin local cd
+	&& done "$1" echo ${HOME} awk sed local grep x=1
+$(pwd) x=1 readonly grep echo then readonly printf "$@" echo 'quoted text'
+--verbose local | /usr/bin /usr/bin $(pwd)
+		'quoted text' then local | test
+	x=1 "$1" $(pwd) printf echo | -eu "$@" -eu --verbose grep "$1"
+	cd done sed sed ${HOME} sed export cd ${HOME}
+	printf "$1" test && echo --verbose "$@"
+	$(pwd) local --verbose done grep "$1" done cd $(pwd) test "$@" grep export
+	printf "$@" local readonly | then
+	done readonly "$@" then 'quoted text' 'quoted text' ${HOME} export
+	export /usr/bin readonly test readonly
+	${HOME} then --verbose -eu 'quoted text' sed grep 2>/dev/null
+	"$1" echo "$1" printf ${HOME} test -eu test -eu export done export
+x=1 local local test --verbose /usr/bin "$1" test "$@" done | | -eu
+		| --verbose 2>/dev/null then readonly 2>/dev/null cd grep 'quoted text'
+export readonly local 'quoted text'
+	--verbose "$1" && && then printf printf --verbose
+	"$@" sed x=1 ${HOME} /usr/bin "$1" printf cd "$1"
+	readonly awk echo grep local test && --verbose test
+		$(pwd) awk ${HOME} $(pwd) then
+grep awk ${HOME} && test echo "$@" readonly printf test export x=1 then
+		sed cd echo "$@" readonly
+	then $(pwd) /usr/bin export local then ${HOME} cd 'quoted text' x=1
+		then /usr/bin ${HOME} /usr/bin awk
+readonly done 'quoted text' echo "$@" echo awk 'quoted text'
+grep cd | grep ${HOME} 'quoted text' "$1" | printf
+export sed then printf -eu /usr/bin printf done
+		readonly -eu $(pwd) -eu
+		"$@" export | sed awk 2>/dev/null
+&& x=1 local 2>/dev/null && done
+		local echo && then printf printf
+${HOME} --verbose && /usr/bin && && ${HOME} /usr/bin /usr/bin
+		then readonly awk then /usr/bin
+	export then local "$@"
+	2>/dev/null --verbose x=1 && export ${HOME} local local export 'quoted text'
+		'quoted text' && printf
+	/usr/bin "$@" | | $(pwd)
+-eu readonly echo done && awk x=1 test --verbose x=1
+	then && "$1" /usr/bin x=1 then readonly printf
+	printf $(pwd) "$@" sed "$@" "$@" cd readonly
+	readonly --verbose -eu /usr/bin export && export
+		done awk echo && done export printf local done readonly 'quoted text'
+		'quoted text' echo $(pwd) ${HOME} x=1 export export | -eu awk sed printf
+	grep sed 'quoted text' --verbose done test printf cd cd -eu
+then "$1" "$1" "$@" cd $(pwd) /usr/bin
+		-eu --verbose --verbose | --verbose echo x=1 awk ${HOME} 'quoted text' readonly
+'quoted text' /usr/bin --verbose sed then /usr/bin "$1"
+	"$1" awk x=1 --verbose grep done $(pwd) sed
+	"$@" && done && 2>/dev/null
+	grep "$1" then awk -eu test test printf export then sed cd 'quoted text'
+		"$1" --verbose sed then done
+	sed x=1 x=1 export readonly
+local echo -eu awk done readonly "$1" "$1" then x=1 then test printf
+		readonly /usr/bin | && then $(pwd) 'quoted text' 'quoted text'
+		done done export && "$1" printf grep ${HOME} && ${HOME} /usr/bin local -eu
+	x=1 && x=1 test echo then sed printf grep printf
+&& "$@" local --verbose "$1" done ${HOME} /usr/bin x=1 && printf
+$(pwd) cd readonly ${HOME} grep x=1 | printf && grep "$1" 'quoted text' -eu
+	echo echo then then 2>/dev/null -eu | 2>/dev/null
+	readonly --verbose --verbose then
+		'quoted text' cd then
+	test sed readonly /usr/bin awk test cd x=1 cd | ${HOME}
+readonly export && x=1 readonly $(pwd) --verbose sed && ${HOME} "$@"
+	done echo | --verbose -eu readonly /usr/bin
+		'quoted text' export | done local
+$(pwd) grep then echo "$@" x=1 /usr/bin echo -eu --verbose export awk x=1
+		| "$@" -eu x=1 readonly cd
+	$(pwd) printf --verbose && export x=1 awk then
+		$(pwd) "$@" then printf 'quoted text'
+	sed | 'quoted text' 'quoted text' awk grep -eu cd "$@" grep && awk "$@"
+	${HOME} printf export test printf cd awk done x=1
+	done export ${HOME} | ${HOME} 'quoted text' test "$1" /usr/bin grep /usr/bin
+		&& grep readonly awk --verbose | ${HOME} 'quoted text'
+	-eu /usr/bin then echo "$1" echo
+'quoted text' "$1" test "$@" "$@" sed | cd local done sed $(pwd)
+	done local "$@" readonly cd cd ${HOME} awk
+		${HOME} local readonly --verbose echo /usr/bin printf -eu done --verbose /usr/bin
+		test then --verbose x=1 x=1 "$1" readonly
+		--verbose local then --verbose
+		'quoted text' "$1" 'quoted text' echo
+		done local --verbose sed cd done 2>/dev/null readonly 2>/dev/null
+	local "$1" 'quoted text' "$@" cd awk awk -eu sed x=1
+	local && -eu readonly done
+		2>/dev/null done then printf then
+	--verbose "$@" echo "$@"
+		local "$1" done 'quoted text' then && local
+readonly /usr/bin printf /usr/bin echo ${HOME} -eu /usr/bin $(pwd) test && grep
+then $(pwd) printf "$1" test 2>/dev/null then -eu /usr/bin "$1"
+then | x=1 2>/dev/null then export && --verbose cd cd export "$@" 2>/dev/null
+echo sed echo test sed then
+	"$1" -eu then 'quoted text' && printf printf --verbose
+		sed then grep | export echo then printf $(pwd) local cd awk printf local |
+	'quoted text' | grep sed x=1 ${HOME} | x=1 sed done readonly --verbose /usr/bin
+"$1" done "$@" then /usr/bin x=1 test export test x=1 then ${HOME}
+	"$1" printf x=1 printf $(pwd)
+grep $(pwd) then $(pwd) $(pwd)
+		then -eu 'quoted text' cd sed cd 'quoted text' | -eu /usr/bin printf test
+readonly | && /usr/bin | --verbose x=1 grep printf grep printf done
+"$1" echo --verbose "$1"
+	'quoted text' printf test test done awk cd readonly
+	2>/dev/null echo readonly ${HOME}
+		local -eu test $(pwd) && awk && test -eu awk
+		grep | "$@" 2>/dev/null export && local done sed awk local $(pwd) ${HOME}
+printf x=1 "$@" readonly export | --verbose echo printf x=1 awk test
+		| 2>/dev/null /usr/bin grep awk readonly 2>/dev/null "$@" -eu export cd 2>/dev/null
+2>/dev/null 'quoted text'
+		cd printf done then test | done
+	test 'quoted text' |
+	local cd && /usr/bin "$1" ${HOME}
+'quoted text' "$1" x=1 -eu /usr/bin $(pwd) 'quoted text' readonly
+	-eu done test done local "$1" $(pwd) grep test grep -eu done export echo
+	&& cd $(pwd) /usr/bin /usr/bin printf ${HOME} grep test 2>/dev/null $(pwd)
+	2>/dev/null awk echo | 2>/dev/null 2>/dev/null && x=1 | echo local grep "$1"
+		export "$1" 2>/dev/null echo --verbose
+"$1" readonly | $(pwd) grep -eu grep $(pwd) then then 2>/dev/null
+	test then echo local echo 2>/dev/null
+		grep local then export local readonly "$@" 2>/dev/null readonly /usr/bin
+${HOME} test printf 2>/dev/null export
+		printf sed "$@" 2>/dev/null -eu && awk | -eu /usr/bin
+&& then test ${HOME} $(pwd) "$@" && | /usr/bin
+		printf --verbose "$1" 'quoted text'
+	$(pwd) | grep sed sed /usr/bin && test then test echo
+		awk awk grep printf 2>/dev/null && ${HOME} -eu 2>/dev/null test local
+		| export then | grep "$1" x=1 2>/dev/null done --verbose && /usr/bin ${HOME}
+done test | then x=1 export echo --verbose export "$@" cd then
+	${HOME} then && $(pwd) 2>/dev/null
+		$(pwd) done test x=1 done local printf local test local
+	| ${HOME} -eu --verbose x=1 ${HOME} test /usr/bin grep --verbose "$1" export
+echo printf sed -eu "$1" awk cd -eu test test $(pwd) && echo --verbose
+x=1 | then readonly ${HOME} sed && export
+export local printf grep -eu "$@" "$1"
+x=1 "$1" cd --verbose export /usr/bin /usr/bin --verbose && grep then done ${HOME}
+	'quoted text' "$1" 2>/dev/null test sed /usr/bin
+		echo | grep awk sed then "$@" awk export
+		| sed done test sed local | "$1" ${HOME} local
+	/usr/bin -eu 2>/dev/null $(pwd) --verbose &&
+		x=1 ${HOME} test 2>/dev/null
+		$(pwd) 2>/dev/null $(pwd) 'quoted text' cd --verbose
+/usr/bin | 'quoted text'
+	"$@" grep cd test readonly -eu -eu local
+		local $(pwd) echo "$1" awk local 'quoted text' $(pwd) printf echo export &&
+grep cd && echo /usr/bin echo "$@" awk | printf
+awk export $(pwd) x=1 readonly x=1 'quoted text' /usr/bin "$1" --verbose
+	| awk local "$1" $(pwd) ${HOME}
+	-eu cd /usr/bin && --verbose sed 'quoted text' sed echo "$@" $(pwd) /usr/bin awk
+		2>/dev/null export --verbose
+		readonly echo readonly echo
+2>/dev/null -eu /usr/bin "$@" readonly readonly ${HOME}
+		/usr/bin done 2>/dev/null "$@" --verbose ${HOME}
+	"$@" | "$@" export done
+		test test --verbose $(pwd) echo done | ${HOME}
+		grep --verbose test "$@" | then export 2>/dev/null
+then awk "$@" awk printf -eu then ${HOME} "$@" x=1 | && awk then
+		2>/dev/null 'quoted text' readonly "$1" | local "$@" export sed
+		x=1 -eu grep 2>/dev/null local "$@" readonly echo done --verbose | 'quoted text'
+	local /usr/bin -eu readonly -eu 2>/dev/null
+		"$@" 'quoted text' -eu | awk -eu then && $(pwd) ${HOME}
+local /usr/bin sed test && grep
+		echo "$@" && awk | $(pwd) echo ${HOME} printf --verbose then
+-eu "$1" ${HOME} $(pwd) test
+		&& echo /usr/bin echo $(pwd)
+	test awk cd ${HOME} then done grep -eu grep x=1 awk -eu 'quoted text'
+		&& 'quoted text' local && 2>/dev/null
+local ${HOME} done "$@"
+	x=1 echo awk 2>/dev/null echo awk 'quoted text' done printf
+test awk 2>/dev/null awk $(pwd) local /usr/bin
+export test && x=1 /usr/bin
+		test x=1 readonly local
+		"$1" readonly | grep sed ${HOME} && awk grep test
+		| awk 2>/dev/null local x=1 export printf x=1 --verbose echo printf printf
+	grep test "$@" test -eu "$1" "$@" | echo cd "$@" then 'quoted text'
+		--verbose local export $(pwd) && done then
+		${HOME} | /usr/bin /usr/bin "$@" grep 2>/dev/null
+		then cd then then then
+	readonly /usr/bin $(pwd) $(pwd)
+done export 'quoted text' | /usr/bin 'quoted text' readonly grep done test grep
+/usr/bin grep echo awk printf $(pwd) readonly
+	done /usr/bin 2>/dev/null readonly awk /usr/bin ${HOME} 2>/dev/null
+	$(pwd) ${HOME} "$1" 2>/dev/null sed sed export
+	2>/dev/null /usr/bin printf -eu $(pwd) grep sed then awk 2>/dev/null x=1 "$@"
+	"$1" "$@" "$@" "$1" export ${HOME} echo --verbose
+		done x=1 local readonly --verbose done readonly done /usr/bin "$@" echo readonly
+		sed test x=1 "$1" 'quoted text' awk "$1" grep x=1 "$@"
+	/usr/bin test test 2>/dev/null cd
+	sed --verbose test && export awk /usr/bin test && /usr/bin "$@"
+		test $(pwd) echo export
+"$1" && ${HOME} 'quoted text' cd awk x=1 cd $(pwd) "$1"
+	local 'quoted text' | 'quoted text'
+	grep cd --verbose --verbose --verbose echo 2>/dev/null --verbose $(pwd) printf
+	export done -eu 'quoted text' done && done
+		then awk /usr/bin x=1 test done done 2>/dev/null ${HOME} export readonly cd printf
+	awk | | "$@" local then 2>/dev/null ${HOME} done readonly -eu printf cd --verbose
+		grep -eu "$1" readonly "$1" "$@" printf
+	local | -eu readonly && 'quoted text' x=1 local sed then local 2>/dev/null
+		awk done -eu "$@" done x=1 2>/dev/null x=1 then echo -eu 'quoted text' cd echo
+awk sed local sed readonly awk ${HOME} sed echo 'quoted text'
+-eu x=1 --verbose /usr/bin && export 2>/dev/null --verbose
+		readonly "$1" -eu 'quoted text' ${HOME} readonly local test
+	local $(pwd) grep readonly -eu
+	then local $(pwd) export "$@" -eu -eu awk local -eu awk ${HOME}
+		/usr/bin sed ${HOME} x=1 ${HOME} x=1
+	then printf "$@" then 'quoted text' awk readonly $(pwd)
+	x=1 && done sed done sed 'quoted text'
+		| export ${HOME} done 2>/dev/null echo local -eu
+	/usr/bin awk x=1 && readonly done --verbose
+	echo sed $(pwd) readonly "$1" "$1" 'quoted text' test
+		echo printf $(pwd) --verbose then echo | x=1 awk ${HOME} --verbose --verbose
+		"$@" cd $(pwd) x=1 test 'quoted text'
+	&& "$1" sed "$1" local --verbose grep 2>/dev/null -eu
+		-eu -eu printf then done && 'quoted text' x=1 local "$1" ${HOME} then printf
+		--verbose cd awk 2>/dev/null 2>/dev/null echo cd readonly sed /usr/bin "$1" done
+--verbose 2>/dev/null echo done && done
+	echo "$@" echo grep cd | -eu readonly
+		done echo && export -eu test export
+echo && 'quoted text' done readonly export export
+$(pwd) cd | && 2>/dev/null "$1" printf printf export | printf
+-eu local x=1 done done | then &&
+		grep x=1 2>/dev/null export && cd /usr/bin | test 'quoted text'
+	-eu $(pwd) printf then ${HOME} test
+		$(pwd) -eu ${HOME} && then
+$(pwd) "$1" sed | local awk 2>/dev/null
+		grep 2>/dev/null local $(pwd)
+&& readonly done /usr/bin printf
+	done "$1" 2>/dev/null ${HOME} then test $(pwd)
+		-eu test --verbose readonly
+${HOME} readonly local 'quoted text' awk export echo && test
+		-eu x=1 $(pwd) /usr/bin done ${HOME}
+local "$@" ${HOME} ${HOME}
+"$1" ${HOME} printf readonly | x=1 $(pwd) readonly echo echo
+		"$1" "$1" cd printf /usr/bin readonly awk --verbose
+		x=1 /usr/bin && done -eu cd 2>/dev/null -eu 'quoted text' -eu echo
+-eu /usr/bin "$@" 2>/dev/null sed --verbose x=1 readonly
+		then then --verbose awk awk grep /usr/bin --verbose echo local
+echo && --verbose $(pwd) readonly
+	readonly done test sed "$1" x=1 | echo 2>/dev/null
+	cd -eu 2>/dev/null x=1 grep then then awk /usr/bin --verbose
+		${HOME} 2>/dev/null $(pwd) printf done printf | && sed test --verbose readonly
+		${HOME} "$@" 'quoted text' &&
+	printf readonly "$@" local ${HOME} "$@" && && $(pwd) 'quoted text'
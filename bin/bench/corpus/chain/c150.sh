@@ -0,0 +1,2001 @@
+test cd | sed awk 2>/dev/null awk
+		done "$@" test 'quoted text' local /usr/bin "$@" $(pwd) awk --verbose "$@" x=1 printf
+	readonly x=1 test done ${HOME} 'quoted text' /usr/bin --verbose /usr/bin
+		"$@" 2>/dev/null && export -eu grep
+	sed then x=1 grep "$@" -eu -eu echo readonly test
+2>/dev/null export echo sed $(pwd) printf | awk local printf
+	2>/dev/null x=1 | "$1" x=1 done awk x=1 "$1" ${HOME} local 2>/dev/null
+		&& echo && readonly --verbose "$@" printf | awk 2>/dev/null
+	$(pwd) $(pwd) -eu export 2>/dev/null
+		${HOME} done x=1 "$1" "$@" echo awk &&
+	echo grep export echo cd sed $(pwd) cd ${HOME} x=1 | --verbose
+	test cd echo then && x=1
+	&& $(pwd) "$1" done cd sed then local && cd |
+		"$1" cd then --verbose x=1 grep "$@" x=1
+	| readonly x=1 "$@" printf sed ${HOME} "$1" export done
+		x=1 && test "$1" "$1" awk 2>/dev/null 2>/dev/null /usr/bin awk
+cd | printf awk "$@" test echo export grep
+--verbose /usr/bin 'quoted text' && --verbose then done
+	2>/dev/null 'quoted text' then "$1" 2>/dev/null |
+		${HOME} readonly echo printf
+		grep grep test echo --verbose printf done "$1"
+cd "$@" /usr/bin 2>/dev/null && | done /usr/bin awk then 'quoted text'
+	echo 2>/dev/null /usr/bin "$@" "$1" sed done "$1" test printf export
+	x=1 "$@" 2>/dev/null 2>/dev/null $(pwd) "$1" x=1 done export test
+&& readonly -eu export && -eu /usr/bin echo "$@" export done awk --verbose
+	awk $(pwd) ${HOME} printf printf ${HOME} 2>/dev/null awk
+		"$1" x=1 && 2>/dev/null
+echo export local grep printf grep && 'quoted text' 2>/dev/null
+		/usr/bin then test | x=1 test -eu echo export test
+	printf sed readonly done ${HOME} | then echo /usr/bin
+"$1" -eu && sed | echo
+	then grep local -eu export
+2>/dev/null sed 'quoted text' cd $(pwd) cd then
+-eu x=1 test done grep "$1" readonly ${HOME} --verbose
+	done test "$@" done /usr/bin local cd export awk ${HOME}
+	printf $(pwd) export $(pwd) && "$1" cd done cd 2>/dev/null ${HOME} done
+local "$@" printf "$1" echo
+		$(pwd) readonly $(pwd) x=1 then grep echo | echo --verbose
+then ${HOME} printf x=1 echo then --verbose -eu /usr/bin export
+"$1" 2>/dev/null && $(pwd) "$1" "$1"
+grep export then x=1 sed ${HOME} 2>/dev/null
+	done | readonly awk | export grep echo $(pwd) 2>/dev/null awk then
+		cd echo awk awk awk echo x=1 x=1 -eu /usr/bin sed --verbose readonly
+export then 'quoted text' | 'quoted text' local sed "$1" printf cd readonly
+	then grep export 'quoted text' awk grep grep printf "$1" x=1 test readonly 'quoted text'
+	&& sed local 'quoted text' then echo x=1
+--verbose && printf awk cd readonly
+		'quoted text' local done grep export sed done readonly --verbose
+	--verbose echo readonly 2>/dev/null &&
+		"$1" --verbose test grep awk echo cd cd then x=1
+${HOME} /usr/bin 2>/dev/null sed
+done export 2>/dev/null $(pwd) done readonly "$1" /usr/bin 'quoted text'
+		/usr/bin echo local grep readonly done local | sed "$@" 'quoted text'
+sed cd sed then sed $(pwd) readonly printf cd x=1 /usr/bin $(pwd)
+	test "$1" awk readonly cd 2>/dev/null cd test && done export
+2>/dev/null /usr/bin ${HOME} local awk ${HOME}
+		-eu --verbose sed test | export local | --verbose ${HOME} -eu $(pwd)
+		--verbose /usr/bin x=1 test sed sed printf "$@" ${HOME}
+2>/dev/null /usr/bin -eu | -eu ${HOME} 'quoted text'
+export | export local done | awk /usr/bin x=1 printf ${HOME} export x=1 printf 'quoted text'
+sed test grep | printf 2>/dev/null
+&& | "$1" --verbose --verbose grep local sed local echo cd printf -eu
+		'quoted text' "$1" readonly then awk cd then echo sed sed "$@" cd "$@" export
+printf 2>/dev/null | readonly
+		sed echo local awk test "$@" readonly /usr/bin 'quoted text' x=1 &&
+| cd sed ${HOME} readonly -eu local printf
+	/usr/bin $(pwd) done local --verbose echo "$1" done done /usr/bin "$@" sed | /usr/bin
+	${HOME} printf ${HOME} printf export readonly "$1" export then -eu $(pwd) /usr/bin
+		test && 2>/dev/null local 2>/dev/null done cd
+		x=1 then $(pwd) export | test
+local 'quoted text' /usr/bin cd $(pwd) 2>/dev/null /usr/bin x=1 x=1
+	/usr/bin grep awk done "$1" ${HOME} ${HOME} echo export cd local 'quoted text'
+		${HOME} "$@" --verbose
+		then sed local echo -eu sed grep | && echo --verbose
+	x=1 $(pwd) then 2>/dev/null x=1 test done "$@" awk cd
+	$(pwd) --verbose test /usr/bin /usr/bin then ${HOME} done
+$(pwd) printf $(pwd) ${HOME}
+$(pwd) --verbose readonly cd grep -eu 'quoted text' /usr/bin awk echo grep sed
+	${HOME} x=1 /usr/bin printf export
+local sed export /usr/bin cd 2>/dev/null && x=1 local grep awk
+printf printf x=1 'quoted text' /usr/bin grep
+	"$@" grep export awk readonly --verbose
+-eu /usr/bin "$1" printf awk printf "$1" | export echo echo
+	-eu export 'quoted text' then readonly
+| | "$@" test "$@" test 2>/dev/null && awk | | -eu export echo
+then | 2>/dev/null echo grep sed sed && echo x=1 local /usr/bin "$@"
+x=1 done && cd "$1" cd "$1" local then --verbose 'quoted text'
+echo 'quoted text' "$1" export echo test readonly "$1" 2>/dev/null
+	/usr/bin /usr/bin | ${HOME} sed readonly
+	cd printf 2>/dev/null | awk 2>/dev/null then done | cd sed /usr/bin
+	local && done | "$@" export test done
+export echo "$1" -eu readonly
+&& cd echo readonly /usr/bin then then ${HOME} /usr/bin
+	local "$1" 2>/dev/null 2>/dev/null -eu && echo readonly grep --verbose
+	export printf -eu x=1 echo echo sed grep /usr/bin 'quoted text' echo
+	'quoted text' && then -eu $(pwd) sed -eu && "$@" sed --verbose 'quoted text' cd
+		2>/dev/null x=1 "$1" cd test $(pwd) export echo done ${HOME}
+sed cd /usr/bin sed readonly then done then printf 'quoted text' done
+test --verbose grep --verbose
+sed printf 2>/dev/null
+		--verbose && awk /usr/bin local "$@" && then 'quoted text' grep export -eu x=1 grep
+	2>/dev/null /usr/bin "$1" x=1 echo awk then then
+	test sed awk awk grep sed | "$1" /usr/bin --verbose
+	sed echo | x=1 grep grep sed sed --verbose
+	'quoted text' /usr/bin
+		${HOME} 2>/dev/null ${HOME} -eu 'quoted text'
+done ${HOME} then echo local done $(pwd) --verbose done 'quoted text'
+2>/dev/null 'quoted text'
+awk "$1" $(pwd) awk local x=1 --verbose 'quoted text' $(pwd) -eu
+--verbose then 'quoted text' echo local x=1 grep 'quoted text'
+sed $(pwd) 'quoted text' 2>/dev/null "$@" printf done x=1 local sed
+		${HOME} echo local sed awk awk sed
+sed && 2>/dev/null local done awk
+2>/dev/null --verbose "$@" echo -eu "$@" printf &&
+	done cd $(pwd) export --verbose grep x=1 $(pwd) $(pwd) grep
+		printf done x=1 'quoted text' then
+"$@" awk done --verbose
+	&& /usr/bin ${HOME} "$1" x=1 -eu readonly sed $(pwd)
+	done "$@" local 2>/dev/null
+&& /usr/bin x=1 awk $(pwd) done 2>/dev/null | echo grep /usr/bin test ${HOME}
+then printf --verbose cd "$1" grep /usr/bin
+${HOME} grep ${HOME} 2>/dev/null 2>/dev/null | ${HOME} then local export
+		sed then --verbose grep then --verbose awk 'quoted text' | local echo echo
+	test sed --verbose echo $(pwd) 'quoted text'
+	grep $(pwd) readonly --verbose -eu "$1" 2>/dev/null
+	grep readonly 'quoted text'
+	grep 'quoted text' echo grep export "$1" done done echo 2>/dev/null
+		| local 2>/dev/null echo 2>/dev/null /usr/bin $(pwd) export -eu echo | "$1"
+		sed echo 'quoted text' test done then awk /usr/bin x=1 then
+		cd x=1 sed grep export "$@" $(pwd) "$1" "$1" -eu -eu export x=1 "$@" /usr/bin
+	2>/dev/null grep local && ${HOME} readonly sed "$1" export done /usr/bin grep x=1
+		"$1" echo readonly then
+		${HOME} 2>/dev/null then 'quoted text' | x=1 ${HOME}
+		&& awk $(pwd) /usr/bin ${HOME}
+	/usr/bin /usr/bin grep && sed sed sed -eu cd -eu -eu 'quoted text' then
+	cd echo x=1 x=1 x=1 local export
+	"$@" x=1 test && sed -eu awk ${HOME} --verbose -eu -eu awk "$@" readonly
+then test && awk /usr/bin then grep readonly printf
+	grep local local grep export echo "$@" printf 2>/dev/null
+	test cd export -eu 2>/dev/null echo
+		then cd sed -eu -eu "$1" "$1" $(pwd) /usr/bin 2>/dev/null "$@" "$@" $(pwd)
+	readonly then awk x=1 awk | 2>/dev/null export /usr/bin awk test 'quoted text'
+	${HOME} ${HOME} local readonly "$1" grep ${HOME} 2>/dev/null
+test $(pwd) | printf test "$@" echo 'quoted text' $(pwd) ${HOME}
+/usr/bin echo --verbose 2>/dev/null --verbose 'quoted text' test ${HOME} 2>/dev/null
+	"$@" "$@" 'quoted text' /usr/bin x=1 test then export /usr/bin
+sed /usr/bin --verbose then ${HOME} sed local test grep echo
+readonly test --verbose export readonly
+	$(pwd) test -eu test export /usr/bin then sed grep cd 2>/dev/null then
+-eu $(pwd) ${HOME} cd export && -eu "$1" | grep awk cd sed "$@" --verbose
+		-eu echo sed grep $(pwd) grep test grep echo ${HOME} "$@" 'quoted text'
+	'quoted text' x=1 "$1" /usr/bin "$@" local export --verbose grep test grep --verbose
+	-eu $(pwd) x=1 "$1" local -eu --verbose test | echo then local
+	awk printf /usr/bin readonly $(pwd) && echo echo --verbose -eu 2>/dev/null /usr/bin
+x=1 readonly printf --verbose
+	"$1" then ${HOME} "$1" readonly
+"$1" local $(pwd) ${HOME} | ${HOME} x=1 $(pwd)
+		sed 2>/dev/null $(pwd) "$1" grep /usr/bin
+echo test cd "$1" sed awk -eu "$1" -eu --verbose awk cd "$1" echo awk printf
+'quoted text' awk --verbose "$@" export 'quoted text' printf
+	readonly --verbose echo "$1" "$1" test readonly $(pwd) sed cd local printf $(pwd)
+		"$1" echo then awk "$1" /usr/bin 'quoted text' done "$1" echo grep
+		| printf test cd "$1" 'quoted text' --verbose test
+		"$1" ${HOME} /usr/bin $(pwd) 2>/dev/null ${HOME}
+		/usr/bin ${HOME} x=1 then
+		| done "$@" awk sed --verbose /usr/bin && -eu done x=1 "$1" "$@" then grep
+		"$@" local -eu /usr/bin /usr/bin done sed ${HOME}
+2>/dev/null && grep --verbose ${HOME} x=1 --verbose
+		done /usr/bin | "$@" local "$@" "$@" grep export
+		grep ${HOME} sed 'quoted text'
+	'quoted text' cd x=1 then echo x=1 x=1 echo -eu --verbose /usr/bin 'quoted text'
+		export -eu x=1 -eu --verbose echo 2>/dev/null local local
+	-eu x=1 then printf /usr/bin "$@" $(pwd) "$1"
+--verbose sed --verbose -eu 'quoted text' printf
+done /usr/bin done | "$1" then ${HOME} | cd awk ${HOME} then
+/usr/bin export 'quoted text' $(pwd)
+		'quoted text' "$1" done awk echo awk sed awk | 2>/dev/null /usr/bin
+		| 2>/dev/null grep -eu
+		&& awk grep $(pwd) 'quoted text'
+	x=1 echo test then test test echo --verbose "$@" test $(pwd) 'quoted text'
+	done --verbose export /usr/bin "$1" 2>/dev/null
+x=1 x=1 2>/dev/null && sed
+	$(pwd) done then x=1 local sed 2>/dev/null -eu "$1" readonly
+&& && x=1 x=1 'quoted text' cd printf cd $(pwd) x=1 | done $(pwd)
+		done $(pwd) ${HOME} | done 'quoted text' export done "$1" x=1 local -eu $(pwd)
+	$(pwd) test printf 2>/dev/null grep "$@" /usr/bin x=1 "$@" printf $(pwd)
+	/usr/bin 2>/dev/null cd "$1" && 2>/dev/null
+&& /usr/bin --verbose /usr/bin
+'quoted text' sed ${HOME} awk printf readonly && sed printf sed
+		x=1 --verbose ${HOME} test then test
+		then done && ${HOME} sed readonly
+	sed -eu --verbose echo $(pwd) echo x=1 /usr/bin done ${HOME} done awk
+sed sed grep local test "$1" echo "$1" 'quoted text' cd awk
+		"$1" cd readonly printf && readonly done | printf
+--verbose printf printf x=1 "$1" then readonly local done --verbose
+		${HOME} awk readonly export export done grep && --verbose -eu test "$1" then
+"$@" printf x=1 printf ${HOME} then --verbose
+sed local grep printf test $(pwd) && done export "$@" grep 2>/dev/null then
+		awk readonly $(pwd) ${HOME} local grep awk grep
+	$(pwd) 'quoted text' local ${HOME}
+	echo cd | 2>/dev/null --verbose then /usr/bin cd 2>/dev/null
+	--verbose 'quoted text' 2>/dev/null sed done 'quoted text' readonly
+	x=1 awk grep "$1" sed 2>/dev/null echo readonly
+	--verbose $(pwd) | 'quoted text' sed "$@" sed "$1"
+readonly awk | $(pwd) "$1"
+	${HOME} /usr/bin test -eu export printf -eu local 2>/dev/null test
+	&& local | local test | cd readonly ${HOME} 2>/dev/null --verbose
+		awk local /usr/bin test test
+sed ${HOME} printf /usr/bin awk /usr/bin local
+	--verbose x=1 test 'quoted text'
+		"$@" done printf "$@" | grep cd "$@" $(pwd) ${HOME}
+	$(pwd) /usr/bin grep export then then local sed export --verbose
+		--verbose then ${HOME} awk test local awk | then local && then export local ${HOME}
+		"$@" local 'quoted text' then grep 2>/dev/null
+	'quoted text' 'quoted text' cd "$@" then done test
+'quoted text' export ${HOME} then printf -eu test ${HOME} cd && $(pwd)
+		printf "$@" $(pwd) cd export /usr/bin x=1 2>/dev/null then local then
+test $(pwd) --verbose cd --verbose printf
+cd done 'quoted text' --verbose then export
+		readonly echo readonly echo readonly "$1" sed 'quoted text'
+	--verbose ${HOME} then -eu sed local readonly grep then printf "$@" 'quoted text'
+done then done "$1" sed ${HOME}
+		awk awk -eu test cd readonly && awk x=1
+		sed $(pwd) && readonly grep local 2>/dev/null && grep printf 'quoted text'
+printf test 2>/dev/null -eu printf 2>/dev/null
+		test "$@" -eu test 'quoted text' 'quoted text' x=1 | readonly sed "$1"
+		--verbose -eu cd 2>/dev/null "$1" 'quoted text' "$@" "$@" "$@" |
+		&& awk printf --verbose done x=1 cd x=1 echo awk "$1" export printf sed "$@"
+	export cd awk then grep x=1 export test echo "$@" 2>/dev/null export test export
+		test 'quoted text' printf
+		printf printf "$1" sed test
+	&& grep /usr/bin 'quoted text' test awk 'quoted text'
+	&& export /usr/bin then x=1 test ${HOME} ${HOME} ${HOME} echo cd -eu
+		grep 'quoted text' --verbose export 2>/dev/null --verbose export done export
+	done sed awk readonly cd $(pwd) readonly
+	x=1 "$1" local then local --verbose && "$1" "$1" $(pwd) done local export
+	"$@" export done | ${HOME} && awk /usr/bin awk /usr/bin export
+		'quoted text' export x=1 --verbose
+		grep echo readonly x=1 "$1" /usr/bin cd "$@" done /usr/bin
+cd done local cd grep
+x=1 then x=1 "$1" "$1" | /usr/bin
+x=1 "$@" x=1 readonly | "$1" $(pwd)
+-eu printf test sed done
+		done done readonly then then cd && printf && 'quoted text'
+	readonly "$1" local local cd "$@" |
+		2>/dev/null cd x=1 awk ${HOME} ${HOME} readonly awk grep "$@"
+		/usr/bin sed echo | local && | grep "$@" 'quoted text' echo done echo echo
+	--verbose --verbose test 2>/dev/null /usr/bin x=1 -eu readonly
+		/usr/bin && local done x=1 x=1 grep
+'quoted text' ${HOME} grep cd printf then "$1"
+		2>/dev/null test readonly then &&
+		printf | x=1 2>/dev/null grep readonly cd sed
+		then grep ${HOME} 'quoted text' local ${HOME} "$1" "$1" awk -eu "$1"
+		cd /usr/bin readonly readonly local export "$1" -eu test
+		2>/dev/null ${HOME} --verbose done "$@" export -eu printf sed /usr/bin
+2>/dev/null readonly echo cd test printf cd printf awk $(pwd) "$@" /usr/bin &&
+		x=1 /usr/bin printf -eu awk
+	${HOME} awk | test readonly test && readonly 'quoted text'
+/usr/bin 2>/dev/null cd 'quoted text' /usr/bin && sed then 2>/dev/null 2>/dev/null
+		done export echo /usr/bin --verbose
+	/usr/bin -eu done x=1 $(pwd) test printf
+	${HOME} x=1 -eu ${HOME} then --verbose echo
+		"$@" -eu | /usr/bin cd then echo | x=1 | grep x=1 2>/dev/null cd local
+	x=1 readonly printf "$@" $(pwd)
+"$1" --verbose "$1" --verbose $(pwd) sed && ${HOME} printf | printf
+echo cd "$@" "$1" "$@" printf cd sed
+$(pwd) x=1 $(pwd) echo local readonly printf
+done readonly 'quoted text' /usr/bin local && then cd readonly /usr/bin && awk
+		export && readonly readonly local "$@" echo x=1 printf 2>/dev/null
+	/usr/bin /usr/bin ${HOME} -eu cd $(pwd)
+readonly cd && grep x=1 --verbose -eu --verbose 2>/dev/null
+		"$@" 'quoted text' | cd test 'quoted text' 'quoted text' cd local
+'quoted text' cd $(pwd) sed export done /usr/bin echo export
+	cd then --verbose local local printf && 'quoted text' --verbose readonly 'quoted text'
+		printf "$@" 2>/dev/null readonly grep
+readonly --verbose printf &&
+	grep "$1" local --verbose test 2>/dev/null then awk --verbose | x=1
+then 'quoted text' --verbose echo cd $(pwd) awk "$@" && awk printf -eu
+	$(pwd) sed "$1" cd ${HOME} x=1 readonly $(pwd) awk 'quoted text' | | --verbose
+	readonly echo sed /usr/bin readonly test "$1" local awk readonly printf --verbose
+cd local -eu printf 2>/dev/null /usr/bin -eu -eu
+		"$@" awk "$1" printf ${HOME} ${HOME} sed sed /usr/bin
+&& && sed "$1" $(pwd) $(pwd) x=1 "$@"
+	--verbose ${HOME} /usr/bin local
+local sed && export test -eu export --verbose grep && "$@" && cd echo ${HOME}
+	"$@" local -eu export sed done then printf $(pwd) readonly 'quoted text'
+		awk grep test 'quoted text' done printf readonly "$@"
+		sed "$1" -eu sed 2>/dev/null test then
+echo "$1" --verbose readonly | printf echo "$@" "$@" x=1
+	| && echo awk export 2>/dev/null grep
+export --verbose x=1 sed x=1 "$1" echo readonly "$@" then "$1" | export local export
+then done --verbose $(pwd) ${HOME} --verbose
+	test --verbose | awk 2>/dev/null printf $(pwd)
+	local "$@" 'quoted text' ${HOME} printf --verbose && echo sed
+	export "$1" "$1" ${HOME} "$@" done 2>/dev/null
+		"$1" awk -eu echo readonly && sed
+		local "$1" printf "$@" x=1 $(pwd) test echo
+		&& readonly -eu export | test test && /usr/bin cd sed readonly | && "$@" "$1" 2>/dev/null
+	&& printf grep done then | -eu printf grep 2>/dev/null
+	${HOME} awk echo 'quoted text' ${HOME} readonly then x=1 readonly
+		--verbose 'quoted text' echo sed | x=1 "$@"
+	--verbose x=1 sed "$@" --verbose readonly $(pwd) awk readonly
+		grep && | x=1 then local 'quoted text' echo
+&& 2>/dev/null $(pwd) awk done "$1" x=1 x=1 done --verbose printf
+		awk echo && then printf sed --verbose --verbose
+sed done sed x=1 readonly /usr/bin $(pwd) --verbose
+		/usr/bin "$@" --verbose | export echo -eu readonly awk 2>/dev/null
+'quoted text' | export ${HOME} cd | /usr/bin grep readonly readonly test
+		then sed x=1 "$1" "$1" then sed awk 2>/dev/null && local test cd cd $(pwd)
+	--verbose /usr/bin done readonly ${HOME} ${HOME}
+--verbose cd /usr/bin done 'quoted text' cd sed export "$@" ${HOME} awk | cd
+awk | cd local 2>/dev/null
+readonly 'quoted text' cd grep grep grep export $(pwd) /usr/bin sed
+/usr/bin -eu ${HOME} $(pwd) -eu
+2>/dev/null export grep done $(pwd) && /usr/bin "$1" --verbose
+	x=1 ${HOME} export awk 2>/dev/null echo x=1 --verbose "$@" sed /usr/bin
+		then && "$1" printf local awk export export local --verbose "$@" 'quoted text'
+	| done x=1 'quoted text' "$@" export 'quoted text' export
+then "$1" && && readonly | 2>/dev/null
+local 2>/dev/null 'quoted text'
+		-eu /usr/bin -eu awk echo
+/usr/bin sed "$@" x=1 readonly awk
+sed readonly export awk ${HOME} x=1 /usr/bin "$@" "$1" $(pwd) done echo
+done export awk echo && && echo test echo 2>/dev/null ${HOME} echo
+/usr/bin sed local awk readonly 'quoted text' then $(pwd) test
+awk then -eu local done 'quoted text'
+	--verbose /usr/bin awk grep && 'quoted text'
+	sed -eu -eu printf "$@"
+test -eu awk awk 'quoted text' 2>/dev/null ${HOME} | echo
+/usr/bin export awk "$1" done 2>/dev/null x=1
+		readonly "$@" --verbose test grep grep /usr/bin && awk done
+export /usr/bin --verbose 2>/dev/null
+	awk --verbose done -eu $(pwd)
+done printf sed --verbose &&
+| && "$@" ${HOME} 2>/dev/null /usr/bin test local test 2>/dev/null done
+	'quoted text' ${HOME} export then x=1
+	sed $(pwd) -eu 'quoted text' 'quoted text' && "$1"
+sed cd export then "$@" sed
+	--verbose sed "$@" x=1 /usr/bin "$@" "$1" && readonly ${HOME} done test
+grep sed "$1" $(pwd) | done /usr/bin local
+		-eu test done echo 'quoted text' sed x=1 -eu --verbose
+	printf --verbose "$1" awk | ${HOME} awk local "$@" awk done |
+	"$1" "$@" ${HOME} 'quoted text'
+${HOME} export /usr/bin -eu 'quoted text' sed && test /usr/bin
+		readonly /usr/bin cd $(pwd) echo 2>/dev/null /usr/bin -eu local -eu grep
+		export done local local 'quoted text' printf
+		"$1" awk 'quoted text' test
+		"$1" local -eu grep grep cd | awk then && export -eu grep x=1 local
+printf --verbose export 2>/dev/null
+		awk echo 'quoted text' test echo done printf export cd 2>/dev/null $(pwd)
+'quoted text' 2>/dev/null then
+	${HOME} cd -eu grep export /usr/bin
+	test /usr/bin export grep sed export && then echo
+export x=1 "$1" done 'quoted text' --verbose /usr/bin
+		$(pwd) sed --verbose readonly done x=1 grep export
+	then printf 'quoted text' ${HOME} 'quoted text'
+	export then grep 2>/dev/null "$@" grep sed --verbose then x=1 -eu | sed $(pwd)
+	"$1" 'quoted text' /usr/bin x=1 test "$1" done test test 'quoted text' ${HOME}
+-eu "$@" printf sed 2>/dev/null
+	printf grep /usr/bin done printf
+| test "$1" grep sed 'quoted text' awk printf -eu
+		then done --verbose 'quoted text' test && $(pwd) echo export $(pwd)
+	"$1" "$@" 'quoted text'
+echo export 2>/dev/null
+$(pwd) "$1" export done $(pwd)
+		done export grep "$1" "$1" /usr/bin -eu grep awk export
+	printf ${HOME} printf 'quoted text' printf -eu 2>/dev/null grep
+echo printf done ${HOME} 2>/dev/null x=1 sed grep x=1 $(pwd) awk &&
+	-eu --verbose awk printf done readonly -eu | ${HOME} cd x=1 2>/dev/null
+		${HOME} export /usr/bin cd echo
+	"$1" && printf && readonly
+	local $(pwd) done done |
+	--verbose ${HOME} | /usr/bin local $(pwd) $(pwd) /usr/bin
+		| -eu sed $(pwd) /usr/bin readonly "$@" -eu --verbose 'quoted text' $(pwd)
+		echo grep 'quoted text' x=1 -eu then
+		$(pwd) --verbose 'quoted text' readonly done x=1 grep sed awk $(pwd) test
+printf grep x=1 "$1" -eu local | && grep grep sed ${HOME} readonly ${HOME} ${HOME}
+		then cd local done cd && "$1" "$1" 2>/dev/null echo ${HOME} then $(pwd) "$1"
+readonly sed grep ${HOME} -eu sed /usr/bin
+	awk ${HOME} x=1 | ${HOME} test -eu readonly --verbose | $(pwd) then
+	| done local echo grep local test echo | && then 'quoted text'
+"$@" 2>/dev/null && echo ${HOME} test then
+	printf "$@" "$@" printf cd /usr/bin --verbose ${HOME} "$@" local $(pwd) --verbose
+"$@" | cd test "$@" sed export $(pwd) awk export
+	${HOME} | grep /usr/bin 'quoted text' grep "$@" test export export readonly
+		cd /usr/bin "$1" | grep local
+	/usr/bin test /usr/bin sed test "$@" awk awk sed "$@" readonly
+--verbose 2>/dev/null then 2>/dev/null sed /usr/bin
+	readonly 'quoted text' echo done 'quoted text' awk
+		test 2>/dev/null printf export /usr/bin then 2>/dev/null echo "$1" "$@" && /usr/bin
+	printf grep $(pwd) grep
+sed done sed /usr/bin printf
+		local "$@" readonly test cd x=1
+${HOME} "$@" then then awk "$1" export "$@"
+		test readonly -eu | test export "$1" --verbose local sed done readonly
+		${HOME} sed export cd done printf echo sed
+		sed --verbose && x=1 sed then sed test x=1 echo ${HOME}
+2>/dev/null ${HOME} sed ${HOME}
+readonly echo | "$1" "$1" --verbose x=1 2>/dev/null /usr/bin
+2>/dev/null readonly export $(pwd) /usr/bin
+		test then -eu export grep ${HOME} done local $(pwd)
+		awk then -eu local printf cd then sed local "$@" |
+	2>/dev/null 2>/dev/null /usr/bin 2>/dev/null | | test 'quoted text'
+		-eu && cd grep --verbose done $(pwd) done ${HOME} test
+${HOME} readonly /usr/bin 'quoted text' readonly echo $(pwd) 'quoted text'
+$(pwd) then printf done printf export "$@" readonly sed ${HOME}
+	printf && export /usr/bin $(pwd)
+		then local 2>/dev/null readonly /usr/bin
+export -eu | /usr/bin test cd test | -eu --verbose test sed test awk
+	cd export "$@" x=1 /usr/bin printf test echo
+echo done cd 2>/dev/null cd $(pwd) local grep "$1" $(pwd) --verbose grep 2>/dev/null
+	grep ${HOME} echo /usr/bin 'quoted text' export
+sed 'quoted text' 2>/dev/null 'quoted text' awk /usr/bin --verbose test 2>/dev/null
+	done ${HOME} cd --verbose 2>/dev/null
+'quoted text' "$@" "$@" && ${HOME} -eu -eu done 2>/dev/null && -eu
+awk test test grep 2>/dev/null $(pwd) 'quoted text' && 'quoted text' 2>/dev/null
+		2>/dev/null test x=1 | then 'quoted text' echo cd then x=1 sed
+"$1" export awk x=1 local test "$1" cd --verbose awk then
+"$1" && 2>/dev/null cd then readonly
+		sed awk grep sed awk -eu ${HOME} 2>/dev/null "$@" 'quoted text'
+	2>/dev/null test sed printf grep 2>/dev/null -eu 'quoted text' awk -eu printf
+		sed then export sed export then
+echo && grep | $(pwd) "$@" test -eu printf "$@" then sed done "$@"
+	test ${HOME} awk echo x=1 printf printf --verbose 2>/dev/null sed echo 2>/dev/null
+-eu ${HOME} awk && sed cd && && echo | local
+	echo "$@" $(pwd) export echo awk "$1" /usr/bin "$1" readonly /usr/bin
+then grep printf test export grep grep 'quoted text' readonly grep
+		cd -eu 'quoted text' && "$@"
+		/usr/bin "$@" printf /usr/bin $(pwd)
+	x=1 -eu done test && awk export done x=1 readonly
+		2>/dev/null test 'quoted text' $(pwd) && echo local "$@" --verbose
+cd export "$1" done test ${HOME} export cd cd --verbose
+-eu grep 2>/dev/null && local sed "$1" x=1 printf 'quoted text'
+	${HOME} 2>/dev/null sed
+		&& awk x=1 'quoted text'
+cd sed 2>/dev/null export grep 'quoted text'
+		-eu 2>/dev/null ${HOME} 2>/dev/null echo $(pwd) "$1"
+&& grep 2>/dev/null 2>/dev/null /usr/bin
+		2>/dev/null && awk 'quoted text' $(pwd) -eu
+--verbose echo $(pwd) done grep $(pwd) -eu cd
+		done | "$@" printf | then readonly && sed
+local | && readonly sed test
+$(pwd) readonly grep readonly readonly
+	local local "$@" && -eu echo local sed
+		"$@" --verbose then test | ${HOME}
+	test 2>/dev/null local grep ${HOME} done then 'quoted text'
+-eu local --verbose $(pwd) --verbose local export test 2>/dev/null
+sed printf x=1 "$@" printf /usr/bin readonly
+		'quoted text' local awk ${HOME} /usr/bin
+	&& cd printf cd echo 2>/dev/null -eu /usr/bin printf
+-eu "$@" | sed ${HOME}
+| cd ${HOME} 'quoted text'
+test --verbose -eu printf test
+		--verbose cd readonly /usr/bin done sed 'quoted text'
+$(pwd) local echo echo "$1" export printf "$@" /usr/bin export --verbose | sed
+		&& -eu export -eu readonly done then then done | readonly printf ${HOME}
+	local echo readonly | readonly
+2>/dev/null export $(pwd) -eu "$@" "$@" done test | 'quoted text'
+echo --verbose sed 'quoted text'
+	'quoted text' -eu grep --verbose && then
+echo echo ${HOME} ${HOME} -eu done
+printf local -eu "$@" echo 'quoted text' && 'quoted text'
+printf test && 'quoted text' test awk
+		awk --verbose test 'quoted text'
+awk "$@" echo -eu sed x=1
+	--verbose x=1 awk then cd --verbose sed
+echo 2>/dev/null $(pwd) local /usr/bin
+	done cd test readonly sed readonly 'quoted text'
+awk ${HOME} | then 'quoted text' $(pwd) /usr/bin readonly cd local grep printf
+	then 'quoted text' /usr/bin awk | done printf then sed
+	local 'quoted text' export sed readonly /usr/bin
+		done cd -eu && 2>/dev/null ${HOME} -eu test readonly export -eu | -eu sed -eu
+	$(pwd) "$@" awk done cd grep
+2>/dev/null done done local readonly printf
+		awk /usr/bin "$1" && -eu 'quoted text' -eu 'quoted text' awk
+		test -eu x=1 test echo --verbose grep sed /usr/bin awk x=1 readonly echo
+	$(pwd) cd x=1 done local local -eu | x=1
+&& readonly $(pwd) export x=1 done echo
+		&& -eu sed 'quoted text' then echo -eu test x=1 |
+awk 2>/dev/null awk -eu export && 'quoted text' cd sed 'quoted text' sed 'quoted text'
+	-eu $(pwd) printf local ${HOME} && grep cd && $(pwd) && /usr/bin
+	done test done $(pwd) --verbose "$1" test cd | echo 'quoted text' -eu
+done awk "$1" echo "$1" test 2>/dev/null
+		then local export grep awk test | echo export
+	/usr/bin 2>/dev/null "$@" done ${HOME} cd sed awk cd | 2>/dev/null local x=1 awk
+	export ${HOME} $(pwd) readonly
+		x=1 ${HOME} export local sed export test --verbose ${HOME} &&
+	'quoted text' done done 2>/dev/null
+test local test ${HOME} then printf echo --verbose /usr/bin x=1
+		local grep test export $(pwd) awk 'quoted text' && "$1" && awk echo done
+&& cd readonly awk sed && 2>/dev/null printf ${HOME} "$1"
+readonly x=1 readonly ${HOME} echo $(pwd) sed readonly test test printf export
+	readonly grep awk local 'quoted text' sed printf "$1" test sed
+	"$@" sed -eu awk readonly test local then && awk x=1 "$@" grep cd
+	--verbose x=1 grep ${HOME} echo cd
+export echo /usr/bin awk "$1" awk then "$1" && test /usr/bin -eu
+	then | grep /usr/bin 'quoted text' sed
+	--verbose ${HOME} && sed awk test printf /usr/bin local 2>/dev/null cd then grep
+	2>/dev/null 2>/dev/null -eu -eu 'quoted text' export
+		"$1" "$@" x=1 sed then export echo ${HOME} grep 2>/dev/null |
+	echo x=1 "$@" done awk ${HOME} awk | && awk
+/usr/bin printf | then | local "$1" "$@"
+		then 2>/dev/null printf printf "$@" 'quoted text' test
+	readonly ${HOME} sed 'quoted text'
+		printf export 'quoted text' printf "$@" | export cd ${HOME} && printf
+		"$@" echo | $(pwd) grep sed echo 2>/dev/null done test --verbose
+		grep x=1 grep echo "$1" 2>/dev/null -eu 'quoted text'
+	cd ${HOME} $(pwd) x=1 "$@" echo "$@" --verbose $(pwd)
+$(pwd) done | local | x=1 && | -eu /usr/bin --verbose x=1 $(pwd)
+		sed sed ${HOME} "$1" | printf && export done && | /usr/bin ${HOME} && echo "$1"
+	--verbose | test awk local "$1" readonly "$@" "$1" printf then 'quoted text'
+sed -eu echo -eu then 2>/dev/null --verbose
+		/usr/bin test /usr/bin echo export
+	cd sed 'quoted text' readonly "$1" then "$1" local
+		$(pwd) sed export then
+		| && /usr/bin test export | "$@"
+	${HOME} local export 'quoted text' ${HOME}
+		local ${HOME} test cd grep local grep ${HOME} 'quoted text' printf done echo
+	export --verbose -eu && "$1" 'quoted text' -eu x=1
+	| --verbose readonly
+cd export cd 2>/dev/null "$@" && | readonly 'quoted text' awk cd | echo readonly
+	done echo sed $(pwd) /usr/bin -eu --verbose
+		--verbose readonly echo local grep test /usr/bin grep $(pwd)
+$(pwd) printf cd 2>/dev/null 'quoted text' -eu printf
+| done grep --verbose done "$@" 'quoted text'
+		then 2>/dev/null -eu 'quoted text' && local cd x=1 cd x=1 /usr/bin "$@"
+		&& && export sed echo done test
+	x=1 test echo echo "$@" 2>/dev/null then local "$1" grep "$1" /usr/bin
+		'quoted text' | echo export | cd local "$@"
+		-eu awk -eu "$1" printf 'quoted text' | | sed
+		printf then ${HOME} awk printf
+		'quoted text' then ${HOME}
+	"$@" --verbose "$1" /usr/bin "$1" | test done "$1" x=1 /usr/bin
+	done export && sed test awk /usr/bin sed awk test ${HOME} awk export sed grep
+		2>/dev/null awk 'quoted text' sed /usr/bin
+cd 2>/dev/null local 'quoted text' && "$1" /usr/bin export
+		$(pwd) "$1" && echo 2>/dev/null readonly grep done "$1" -eu test
+'quoted text' sed printf awk --verbose && cd export done sed ${HOME} then
+sed printf local 2>/dev/null awk 2>/dev/null 'quoted text'
+2>/dev/null ${HOME} readonly /usr/bin $(pwd) test echo readonly 2>/dev/null readonly
+	x=1 && ${HOME} awk export then $(pwd) 'quoted text' done
+cd 'quoted text' | | done -eu local
+done sed --verbose sed 2>/dev/null /usr/bin export
+	$(pwd) then echo 2>/dev/null local test ${HOME}
+	local x=1 test | "$1" then
+"$1" "$1" grep grep sed | ${HOME} local
+		done /usr/bin export /usr/bin cd $(pwd) | then test test "$@" local
+		printf "$1" then | -eu "$1" cd export -eu
+	$(pwd) -eu awk then /usr/bin
+	${HOME} --verbose sed done
+		readonly printf -eu $(pwd) x=1 $(pwd) test grep "$@" -eu $(pwd) && local
+	--verbose then ${HOME} then local
+		/usr/bin 2>/dev/null x=1 && done
+		then $(pwd) readonly export "$@" local local 2>/dev/null
+$(pwd) -eu local test x=1 local x=1 echo && readonly echo export |
+		'quoted text' && | awk local -eu then export printf
+	"$1" sed sed grep 'quoted text' /usr/bin
+readonly $(pwd) ${HOME} ${HOME} --verbose awk --verbose 'quoted text'
+		export x=1 local local | | ${HOME}
+${HOME} cd readonly ${HOME} 2>/dev/null printf "$@"
+then sed printf awk 2>/dev/null cd $(pwd)
+	test grep export printf grep done /usr/bin readonly x=1 export cd && local
+/usr/bin done 'quoted text' /usr/bin export grep echo awk export cd
+	${HOME} --verbose then "$@" then then test "$@" ${HOME} 2>/dev/null readonly export
+done local readonly done test | readonly 2>/dev/null "$1"
+	| then awk $(pwd) export | printf 2>/dev/null "$1" ${HOME}
+	cd ${HOME} grep printf "$@" test export sed $(pwd) readonly $(pwd)
+	readonly printf local done ${HOME} local 'quoted text'
+	done $(pwd) readonly --verbose done done sed /usr/bin awk local echo
+$(pwd) | grep echo -eu /usr/bin --verbose
+	"$@" "$1" "$1" readonly local local ${HOME} "$@"
+		export echo && "$1" x=1 $(pwd) then done /usr/bin export x=1 | awk awk
+"$@" /usr/bin "$@" | /usr/bin readonly
+awk x=1 cd $(pwd) cd -eu test 'quoted text'
+"$1" "$1" /usr/bin && && | readonly printf 2>/dev/null cd awk
+		export local x=1 readonly awk && "$@" --verbose /usr/bin awk 'quoted text'
+-eu cd && test cd $(pwd) -eu /usr/bin 2>/dev/null && grep readonly then export
+	awk echo x=1 grep "$@" printf -eu awk 'quoted text' 2>/dev/null grep "$@" /usr/bin
+export && echo --verbose "$1" "$@" grep sed
+/usr/bin --verbose "$1" export && 'quoted text' | && "$@" export
+	x=1 awk 2>/dev/null "$1" awk "$1" test "$1" test local printf
+	2>/dev/null 'quoted text' done echo 'quoted text'
+	x=1 && -eu x=1 printf -eu printf ${HOME} readonly "$@" test
+	echo --verbose "$@" cd -eu | --verbose && --verbose | grep done "$1" awk readonly
+test --verbose echo && grep grep x=1 cd test readonly export local
+awk --verbose 2>/dev/null
+		'quoted text' then "$@" export
+-eu grep printf local /usr/bin "$@" printf "$1" 2>/dev/null x=1
+	"$@" awk test $(pwd) | printf then
+		/usr/bin "$1" 2>/dev/null local /usr/bin
+	test "$1" 'quoted text' local
+	"$1" sed local grep && local then done /usr/bin | done
+	cd "$@" $(pwd) then $(pwd) "$@" printf 2>/dev/null
+		grep | ${HOME} 2>/dev/null /usr/bin grep
+	"$@" echo 'quoted text' then /usr/bin echo grep then
+		export "$1" $(pwd) -eu /usr/bin done local x=1 --verbose awk x=1 | /usr/bin
+"$1" readonly && done echo "$1" echo awk grep printf
+		local then x=1 echo 'quoted text' 2>/dev/null test ${HOME} && -eu 'quoted text'
+2>/dev/null local test | 2>/dev/null
+"$@" -eu $(pwd) | | export sed readonly then --verbose $(pwd) 2>/dev/null
+	echo /usr/bin done export cd /usr/bin --verbose
+2>/dev/null "$@" export readonly 2>/dev/null /usr/bin test printf
+		readonly "$1" test "$@" | "$1" "$@"
+	${HOME} sed export /usr/bin | export printf grep x=1 echo grep /usr/bin 2>/dev/null
+	printf && $(pwd) test then x=1 printf && cd
+	echo then done cd 2>/dev/null done x=1 sed 'quoted text'
+	export awk awk awk "$@" /usr/bin && && 'quoted text' readonly
+	done echo /usr/bin echo
+		grep grep done sed local
+	grep | cd printf sed readonly --verbose grep 2>/dev/null "$@" --verbose
+		$(pwd) x=1 -eu printf "$1" local
+	/usr/bin printf export -eu done "$1" -eu then then "$1" x=1 then
+	printf /usr/bin -eu ${HOME} then test && readonly && grep cd 2>/dev/null
+		printf printf 2>/dev/null echo done | 'quoted text'
+'quoted text' done -eu cd sed "$@" awk "$@"
+&& echo done grep | local cd
+	2>/dev/null 2>/dev/null export
+cd -eu awk export $(pwd) local grep
+	printf /usr/bin printf -eu printf then export $(pwd) done x=1 -eu done
+		done test "$1" then then sed export
+| -eu "$@" -eu x=1 'quoted text'
+		&& --verbose cd export sed
+	awk test /usr/bin sed --verbose 2>/dev/null test grep "$1" "$@" cd 2>/dev/null 2>/dev/null
+		$(pwd) "$@" ${HOME} -eu printf echo $(pwd) awk test cd "$1" "$1" echo echo 2>/dev/null
+$(pwd) --verbose ${HOME} 'quoted text' done printf cd echo test "$1" echo
+	${HOME} printf ${HOME} export x=1 --verbose
+	readonly readonly /usr/bin $(pwd) done "$@" then --verbose $(pwd) local
+${HOME} | -eu echo done grep awk | local -eu echo readonly done
+x=1 /usr/bin "$@" -eu then cd export
+	grep $(pwd) grep && grep &&
+done local x=1 "$1" grep sed $(pwd) grep "$1"
+2>/dev/null done && 'quoted text' -eu echo -eu then
+		sed --verbose "$1" done
+grep --verbose | readonly 2>/dev/null
+		&& grep then grep "$@" then ${HOME} export --verbose "$@" x=1 ${HOME} test
+&& sed local && test x=1 | sed
+| x=1 /usr/bin "$1" x=1 readonly done /usr/bin
+		local done printf cd export awk then printf && sed --verbose
+	$(pwd) then export cd -eu ${HOME} awk test ${HOME} | /usr/bin
+readonly test -eu awk "$1" x=1 /usr/bin
+	| "$@" -eu cd ${HOME} "$@" sed then
+	sed 'quoted text' -eu cd readonly ${HOME} "$1" sed echo echo -eu x=1
+	/usr/bin "$@" "$1" "$1" 'quoted text' /usr/bin | && /usr/bin grep
+		awk ${HOME} done sed sed && echo ${HOME}
+	echo "$1" sed awk | "$@" awk 2>/dev/null 2>/dev/null printf then
+		| readonly -eu --verbose awk | export
+		"$@" export && sed -eu test printf grep test -eu sed awk
+		awk sed /usr/bin "$@" readonly ${HOME}
+	| -eu "$1" | awk cd readonly --verbose done "$1" done $(pwd) sed printf
+	grep -eu cd grep sed -eu --verbose sed readonly local "$1" "$1"
+done awk /usr/bin export grep printf then test echo
+		-eu test "$1" $(pwd) x=1 test 2>/dev/null
+	&& test "$1" test echo -eu /usr/bin done --verbose printf
+		"$@" "$1" awk 'quoted text' "$1" 2>/dev/null --verbose printf
+	test echo ${HOME} $(pwd) readonly printf local then export ${HOME}
+grep && --verbose "$@" test $(pwd) 'quoted text' done
+		x=1 echo echo "$1" x=1 | && 'quoted text' echo local 'quoted text' $(pwd) grep
+		${HOME} && then grep 'quoted text' then awk --verbose x=1 done /usr/bin
+then ${HOME} -eu awk | | cd $(pwd) readonly ${HOME} done cd "$@" x=1 local
+readonly cd 2>/dev/null test sed --verbose awk x=1 then
+${HOME} done grep export grep x=1
+		awk export 2>/dev/null
+		local sed "$@" cd 'quoted text'
+		$(pwd) awk awk 'quoted text' grep echo echo echo 2>/dev/null
+		done 'quoted text' sed "$1"
+		${HOME} local cd echo 'quoted text' "$@" then grep /usr/bin
+	local sed awk --verbose echo sed && echo grep then printf grep test
+"$1" $(pwd) echo cd $(pwd) readonly
+		$(pwd) && grep awk | -eu awk x=1 sed echo | /usr/bin -eu |
+		$(pwd) && 2>/dev/null | | done && ${HOME} ${HOME}
+		| -eu 'quoted text' test 2>/dev/null "$1" ${HOME}
+/usr/bin -eu local grep
+	"$@" 2>/dev/null "$@" -eu printf
+	2>/dev/null awk readonly then /usr/bin awk -eu ${HOME}
+readonly then && -eu export
+	| local $(pwd) sed ${HOME} done -eu printf -eu
+		then sed then 2>/dev/null "$@" -eu -eu echo cd echo x=1 test local ${HOME}
+x=1 --verbose awk 2>/dev/null printf |
+		2>/dev/null $(pwd) /usr/bin
+		then /usr/bin readonly test done
+	${HOME} | local printf /usr/bin /usr/bin && printf
+'quoted text' test grep export export
+		2>/dev/null grep then /usr/bin "$@" grep ${HOME} done cd awk sed echo grep
+done export $(pwd) echo 2>/dev/null test --verbose /usr/bin x=1 -eu
+		done -eu awk awk test $(pwd)
+		export printf ${HOME} --verbose
+	readonly -eu done local readonly 'quoted text' && readonly grep cd
+test then --verbose 2>/dev/null awk done 2>/dev/null | cd local /usr/bin -eu 2>/dev/null
+		"$1" $(pwd) test local cd "$@" grep done 'quoted text'
+	done --verbose awk $(pwd)
+		&& ${HOME} readonly $(pwd) grep | -eu readonly done cd readonly "$1" "$@" --verbose
+	test grep 2>/dev/null readonly "$@"
+	export --verbose local "$@" "$@" --verbose printf | grep printf ${HOME}
+		awk -eu --verbose /usr/bin local sed cd local grep test 2>/dev/null
+echo $(pwd) x=1 && | done /usr/bin local
+		cd export grep ${HOME} test 2>/dev/null printf x=1 then echo echo "$@"
+	local done 2>/dev/null 2>/dev/null "$@" "$1" | done
+--verbose "$1" cd 2>/dev/null 2>/dev/null
+		--verbose echo x=1 "$1" cd export /usr/bin ${HOME} ${HOME} printf
+	test 2>/dev/null /usr/bin readonly 2>/dev/null
+	${HOME} --verbose awk local x=1 sed
+	local 'quoted text' awk x=1 | 2>/dev/null done printf x=1 'quoted text'
+then -eu -eu readonly cd
+		'quoted text' | 2>/dev/null cd "$1"
+$(pwd) readonly cd sed printf ${HOME} local && 2>/dev/null && then
+export $(pwd) /usr/bin printf test 'quoted text'
+		then && x=1 "$@" sed --verbose | printf && readonly $(pwd) "$1" printf printf
+		-eu $(pwd) $(pwd) cd --verbose 'quoted text' $(pwd) grep readonly "$@"
+	sed | -eu /usr/bin -eu awk "$1" ${HOME} awk -eu export test test 'quoted text'
+readonly echo --verbose printf 2>/dev/null grep $(pwd)
+		2>/dev/null /usr/bin cd 'quoted text'
+	readonly done ${HOME} --verbose /usr/bin x=1 x=1 "$@" 2>/dev/null then &&
+	export grep x=1 -eu --verbose test "$1" test "$1" echo
+	grep | export && then local sed cd echo 'quoted text' 2>/dev/null
+	| test grep cd local x=1 echo local 2>/dev/null export
+		${HOME} "$1" echo x=1 done printf -eu grep "$1"
+x=1 /usr/bin grep $(pwd) grep "$@" ${HOME} -eu then "$@" local
+		&& "$1" 2>/dev/null local cd sed | &&
+		awk "$@" done done /usr/bin printf sed grep
+	local $(pwd) awk && "$1" x=1 export
+	'quoted text' grep done 2>/dev/null awk grep test 'quoted text' /usr/bin
+	${HOME} grep readonly 'quoted text' readonly
+${HOME} | -eu 2>/dev/null done -eu 'quoted text'
+		2>/dev/null 'quoted text' cd -eu readonly readonly grep 'quoted text'
+	readonly "$1" $(pwd) ${HOME} 'quoted text'
+	awk then && grep /usr/bin
+-eu awk echo -eu "$@"
+	readonly "$1" awk then $(pwd) "$1" $(pwd) then "$@" echo ${HOME}
+		cd printf 'quoted text' && readonly "$1" ${HOME}
+-eu sed -eu readonly && "$@" ${HOME} "$1" /usr/bin x=1 ${HOME}
+	awk grep /usr/bin awk
+	"$1" printf ${HOME} x=1 --verbose --verbose 2>/dev/null sed sed echo test x=1 -eu
+	${HOME} awk done && && test 'quoted text' grep $(pwd) 'quoted text'
+		awk sed "$1" awk printf "$@" then test then cd 'quoted text'
+'quoted text' $(pwd) printf ${HOME} echo
+x=1 && ${HOME} done echo -eu then
+--verbose 'quoted text' local -eu
+	x=1 "$1" echo | local test local -eu test -eu test | echo | cd done 'quoted text'
+--verbose 'quoted text' --verbose awk sed
+		done /usr/bin done test echo x=1 /usr/bin | local readonly /usr/bin
+/usr/bin "$@" cd "$1"
+		$(pwd) echo readonly 'quoted text' grep printf $(pwd) test done
+		/usr/bin | -eu test cd $(pwd)
+${HOME} sed --verbose /usr/bin | export sed x=1 local grep
+	sed 'quoted text' "$@" cd cd /usr/bin
+		printf readonly x=1 cd readonly
+local --verbose local -eu x=1 printf printf
+		echo ${HOME} awk echo && 'quoted text' && /usr/bin --verbose
+2>/dev/null then then export --verbose /usr/bin echo readonly readonly
+done "$@" /usr/bin test done && $(pwd) printf grep cd $(pwd)
+	&& awk $(pwd) $(pwd) | cd awk export sed echo "$1" echo --verbose
+	readonly test ${HOME} -eu ${HOME} done /usr/bin | awk cd "$1" printf 'quoted text'
+"$1" "$@" export 2>/dev/null
+	$(pwd) x=1 "$@" -eu -eu /usr/bin printf echo 2>/dev/null
+		$(pwd) -eu sed then --verbose awk test
+	sed echo readonly && -eu grep awk local cd local 'quoted text' ${HOME} --verbose
+		2>/dev/null test sed /usr/bin then /usr/bin && readonly readonly
+/usr/bin awk done -eu $(pwd) | x=1 cd readonly 'quoted text'
+/usr/bin 'quoted text' "$@" test 'quoted text' -eu x=1 cd readonly
+		grep local awk "$@" local "$@" 'quoted text' echo awk
+then $(pwd) echo grep $(pwd) "$1" $(pwd) cd then
+		-eu done done | grep readonly then grep && -eu test "$1" --verbose
+	then ${HOME} cd done then sed $(pwd) then 2>/dev/null
+sed 2>/dev/null /usr/bin echo "$@" printf
+		cd "$1" echo --verbose echo $(pwd) readonly done 2>/dev/null
+readonly -eu /usr/bin export | done sed readonly test grep 'quoted text' readonly
+		echo test 2>/dev/null sed
+	| 2>/dev/null printf --verbose then export
+		${HOME} printf ${HOME} echo done "$@" echo export && test sed ${HOME} x=1 test
+	cd 'quoted text' local sed
+&& /usr/bin -eu $(pwd)
+test "$1" grep | $(pwd) test done /usr/bin test
+		${HOME} echo && ${HOME}
+		&& x=1 sed readonly "$1" echo 2>/dev/null --verbose then printf
+		cd sed grep test "$@" /usr/bin $(pwd) $(pwd) "$@" --verbose "$@" done 'quoted text'
+'quoted text' printf local 'quoted text'
+		printf "$@" test "$1" x=1 | sed done 'quoted text'
+	--verbose 2>/dev/null --verbose local test
+	| x=1 printf --verbose $(pwd) local grep ${HOME} test /usr/bin cd ${HOME}
+		2>/dev/null done printf | done grep export test x=1 && "$1" then then test
+printf 'quoted text' 'quoted text' | $(pwd) sed "$@" | -eu "$@" "$@"
+		"$@" && && sed ${HOME} 'quoted text' "$1" | done x=1 /usr/bin export
+| printf printf && then
+then "$1" cd ${HOME} -eu test
+		| "$1" -eu local awk ${HOME} | /usr/bin
+	x=1 ${HOME} grep grep 'quoted text' done x=1 local -eu grep
+&& printf x=1 readonly done "$1"
+/usr/bin 'quoted text' awk printf awk sed
+	"$1" ${HOME} "$@" done then "$1" done 2>/dev/null
+printf $(pwd) then 'quoted text' "$1" | done $(pwd)
+	${HOME} | -eu && && x=1 echo 'quoted text' $(pwd) test
+x=1 export sed 2>/dev/null export 'quoted text' awk /usr/bin test && sed echo
+		then ${HOME} $(pwd) -eu $(pwd) export
+	x=1 readonly awk ${HOME} --verbose grep "$@" "$@" $(pwd) then 'quoted text' sed
+	awk x=1 test $(pwd) /usr/bin cd cd grep 'quoted text'
+local test local cd "$@" "$@"
+		/usr/bin "$1" /usr/bin "$1" --verbose --verbose 2>/dev/null
+printf ${HOME} && then | 2>/dev/null 'quoted text'
+	--verbose -eu x=1 grep done then && test /usr/bin echo
+| && | "$1" ${HOME} then "$1" readonly -eu "$1" echo local cd then export cd
+$(pwd) --verbose /usr/bin 'quoted text'
+grep 'quoted text' $(pwd) grep 'quoted text' sed sed
+		printf sed /usr/bin grep -eu printf /usr/bin $(pwd) echo "$@" --verbose
+"$1" /usr/bin 2>/dev/null -eu then
+sed /usr/bin x=1 x=1 test 2>/dev/null ${HOME}
+	readonly -eu export printf test
+printf | && cd local 2>/dev/null
+'quoted text' x=1 awk 'quoted text' | $(pwd) 2>/dev/null ${HOME} sed
+awk local then local local cd | 2>/dev/null echo done done sed ${HOME}
+	&& x=1 ${HOME} "$1" "$1" 2>/dev/null 2>/dev/null
+$(pwd) cd sed | x=1 local --verbose --verbose x=1 cd then --verbose grep
+		| "$1" x=1 local done ${HOME} awk awk echo export local "$1" cd x=1 | cd awk 2>/dev/null
+	local done 'quoted text'
+		then echo awk $(pwd) awk /usr/bin printf
+	grep printf && echo --verbose then | awk then export
+	--verbose x=1 | printf 2>/dev/null
+		&& "$1" cd -eu 'quoted text' export "$1" awk && done export
+	export --verbose local cd ${HOME} "$1" | x=1 'quoted text' then done
+/usr/bin "$@" test 'quoted text' done done printf readonly ${HOME}
+"$1" echo ${HOME} 2>/dev/null ${HOME} && 2>/dev/null
+		export x=1 | --verbose grep ${HOME} echo -eu &&
+$(pwd) $(pwd) /usr/bin --verbose readonly test "$1" cd echo local
+	readonly "$@" && $(pwd) then 2>/dev/null export -eu
+	| cd sed test readonly --verbose 'quoted text' sed | export && "$@"
+cd printf then /usr/bin done 'quoted text' cd cd done &&
+		printf cd x=1 awk awk x=1 | && printf grep cd -eu
+test 'quoted text' test printf then readonly printf "$@" ${HOME} printf ${HOME}
+cd export 'quoted text' | grep echo awk "$1"
+&& "$1" grep && "$1" && 'quoted text' grep "$@" export
+'quoted text' awk echo done local 2>/dev/null export then 'quoted text'
+	'quoted text' 2>/dev/null "$1" cd cd x=1 ${HOME} &&
+		then test /usr/bin local "$1" -eu ${HOME}
+	$(pwd) echo && cd grep printf printf awk "$1" x=1 grep readonly -eu x=1
+-eu local "$1" printf done x=1 local ${HOME}
+awk awk local --verbose local && x=1 x=1 'quoted text' printf ${HOME} /usr/bin
+		sed | /usr/bin --verbose test then printf 2>/dev/null
+	local cd "$@" "$@" readonly --verbose $(pwd) "$1" ${HOME}
+	&& export grep printf echo printf done grep test
+readonly grep test export $(pwd) $(pwd) printf
+	-eu -eu x=1 grep grep export readonly "$1" /usr/bin readonly
+		cd x=1 cd x=1 --verbose awk -eu done &&
+awk -eu cd local export sed -eu sed local cd
+	cd $(pwd) 2>/dev/null ${HOME} readonly local
+readonly grep echo local $(pwd) --verbose x=1 export export sed awk
+		&& 'quoted text' awk "$@" export local then 'quoted text'
+		${HOME} awk --verbose sed && 'quoted text'
+	/usr/bin test "$1" ${HOME} test $(pwd) --verbose $(pwd) done 2>/dev/null
+	echo awk $(pwd) $(pwd) readonly
+	"$1" | /usr/bin done printf awk echo done x=1 && export readonly 2>/dev/null grep
+test | echo | 2>/dev/null done sed "$1" printf grep 'quoted text'
+		cd echo echo awk ${HOME} x=1 --verbose
+		local 2>/dev/null | | /usr/bin cd | sed "$@" "$1" export /usr/bin
+	'quoted text' 'quoted text' readonly grep grep 'quoted text' export
+		--verbose awk export grep ${HOME}
+		| ${HOME} x=1 awk test echo readonly 2>/dev/null
+	grep | $(pwd) export ${HOME} export --verbose cd
+	printf 2>/dev/null then $(pwd) 2>/dev/null ${HOME} cd grep 'quoted text' echo -eu
+	cd /usr/bin export test done export --verbose echo /usr/bin
+	cd local readonly printf sed /usr/bin export printf
+	&& $(pwd) "$@" sed "$@" ${HOME} "$@" && test test x=1 cd && cd
+"$@" cd ${HOME} 2>/dev/null "$@" /usr/bin x=1 "$@" "$@" echo printf then "$1"
+-eu && cd && export then done --verbose
+		awk local 2>/dev/null --verbose awk awk test readonly ${HOME} grep grep
+	export && done cd local then sed $(pwd) printf --verbose test
+/usr/bin test /usr/bin ${HOME} export export --verbose
+&& ${HOME} sed && local 2>/dev/null test sed --verbose | sed ${HOME}
+		then local done x=1 done test 2>/dev/null local printf $(pwd)
+echo && test x=1 ${HOME}
+		| sed /usr/bin 2>/dev/null x=1 grep &&
+		awk sed cd "$1" | "$@" -eu test /usr/bin 'quoted text'
+		cd then && test "$@" sed && | local x=1 | printf /usr/bin cd
+	'quoted text' then readonly /usr/bin test
+	readonly cd test sed grep local then x=1 echo grep && $(pwd) "$1" "$@"
+		grep then export x=1 /usr/bin grep printf $(pwd) local | export
+	grep && sed done x=1 export 2>/dev/null cd "$1" cd $(pwd) --verbose
+readonly done --verbose | --verbose --verbose && -eu readonly done test
+	| echo sed local sed printf local "$1"
+"$@" grep echo 'quoted text'
+	--verbose then $(pwd) -eu /usr/bin
+	/usr/bin awk cd /usr/bin echo done
+	test && && cd readonly then cd -eu sed -eu awk echo
+readonly printf "$1" 'quoted text'
+		echo cd --verbose --verbose readonly 'quoted text' 'quoted text'
+	cd 'quoted text' 'quoted text' export
+local sed echo grep "$@" 'quoted text' test done local 2>/dev/null local
+	--verbose 'quoted text' export awk | cd "$1" awk /usr/bin readonly -eu done
+	readonly cd ${HOME} 'quoted text' readonly 'quoted text' && awk "$1" awk echo
+		"$@" 'quoted text' test sed -eu x=1 export | readonly
+then /usr/bin echo cd --verbose printf then done printf
+		done "$@" cd -eu x=1 'quoted text' then /usr/bin cd --verbose sed then
+	then readonly x=1 then "$1" x=1 'quoted text'
+$(pwd) done readonly 'quoted text' export && printf && export $(pwd) "$1" $(pwd)
+printf sed && "$1" readonly "$1" then --verbose test /usr/bin
+	$(pwd) --verbose then $(pwd) readonly readonly 'quoted text'
+	done cd sed "$@" echo echo cd sed grep readonly -eu export $(pwd) x=1 sed cd printf
+	local | done 'quoted text' /usr/bin echo done "$@" &&
+	"$1" $(pwd) | readonly export local | 'quoted text'
+	| -eu $(pwd) cd awk test awk
+	'quoted text' && done && "$@" export ${HOME}
+	done printf /usr/bin --verbose | | local --verbose
+then grep x=1 awk --verbose "$1" | local
+&& sed 2>/dev/null "$1"
+	cd done | sed printf sed export ${HOME} test -eu sed export sed cd echo echo
+		&& "$1" | --verbose -eu 2>/dev/null echo local
+	readonly awk --verbose /usr/bin test --verbose export x=1 'quoted text' export
+		printf awk sed 2>/dev/null /usr/bin
+		readonly 2>/dev/null then awk sed cd export | local done -eu awk ${HOME}
+	grep "$1" readonly --verbose done 'quoted text' $(pwd) sed
+	export "$1" done grep local awk /usr/bin
+local | $(pwd) /usr/bin | cd "$@" export then printf
+${HOME} "$@" readonly export done local grep |
+	x=1 echo local awk --verbose && $(pwd) awk local ${HOME}
+awk done ${HOME} ${HOME} ${HOME} echo grep done --verbose
+${HOME} --verbose awk export /usr/bin cd -eu test local sed /usr/bin awk "$1" 2>/dev/null
+	grep --verbose printf --verbose awk x=1 ${HOME} readonly 'quoted text'
+		/usr/bin "$1" | | printf local test --verbose sed "$@" done "$1"
+	-eu local awk test 2>/dev/null awk "$1" echo printf
+printf 2>/dev/null -eu ${HOME} --verbose -eu printf /usr/bin --verbose
+	awk readonly local then done 'quoted text' readonly --verbose then
+		2>/dev/null && then printf
+-eu local grep ${HOME} echo cd awk $(pwd) readonly
+| grep "$@" ${HOME} sed cd "$@" $(pwd) 2>/dev/null
+	"$@" printf ${HOME} readonly test readonly | 'quoted text' --verbose grep
+	-eu printf awk done grep sed echo cd readonly x=1 -eu /usr/bin
+	done | /usr/bin "$1" &&
+readonly | readonly --verbose --verbose awk echo done local echo grep echo
+cd /usr/bin | && printf local
+		echo awk then readonly cd 2>/dev/null /usr/bin -eu then then
+	awk "$@" 2>/dev/null export export local /usr/bin cd ${HOME} printf sed | printf
+		awk done "$@" awk grep then then x=1 export -eu 2>/dev/null ${HOME} then printf
+	sed 'quoted text' 'quoted text'
+"$@" ${HOME} --verbose local echo ${HOME} awk 'quoted text'
+		local /usr/bin 2>/dev/null | readonly echo "$1" ${HOME} "$1" sed && $(pwd) cd local
+		echo readonly ${HOME} | test && grep test test done then grep cd cd then readonly
+	| x=1 readonly "$@" local
+--verbose 2>/dev/null 2>/dev/null done export $(pwd)
+	--verbose awk then local x=1 ${HOME} cd awk sed echo cd local x=1 "$1" then
+	grep "$1" local sed test $(pwd) echo ${HOME} cd export
+-eu $(pwd) grep then awk 'quoted text' | ${HOME}
+	printf echo local sed /usr/bin
+awk ${HOME} && x=1 test export done readonly /usr/bin done
+		local sed $(pwd) printf "$1" -eu grep local "$1"
+$(pwd) "$1" | "$1" awk echo -eu "$1" $(pwd) sed readonly then
+	grep x=1 done export grep --verbose "$1" awk "$@" done grep done
+	grep /usr/bin test /usr/bin x=1 $(pwd) 2>/dev/null
+	test echo done | /usr/bin $(pwd) -eu local x=1 $(pwd)
+	--verbose 'quoted text' "$@" cd "$@" $(pwd) "$@" awk x=1 export --verbose
+awk test "$1" /usr/bin ${HOME} x=1 ${HOME} | done $(pwd) /usr/bin | "$@"
+	echo cd /usr/bin export then --verbose /usr/bin x=1 readonly then
+		grep cd -eu awk echo export export | printf readonly
+2>/dev/null local 'quoted text' 'quoted text'
+awk awk --verbose ${HOME} | local | | 'quoted text'
+&& 'quoted text' test then
+	2>/dev/null sed cd readonly | printf | sed /usr/bin
+$(pwd) test grep readonly then "$1" test "$1" readonly then
+local --verbose --verbose printf /usr/bin 'quoted text' awk export test export
+	"$@" grep "$1" $(pwd) cd /usr/bin 'quoted text'
+		/usr/bin "$1" cd test /usr/bin
+"$@" | --verbose cd /usr/bin 'quoted text' "$@" sed test
+		/usr/bin grep done cd test && -eu test $(pwd) && done awk export test
+	'quoted text' | 'quoted text' /usr/bin
+test && done ${HOME} awk readonly "$1" "$1" grep
+'quoted text' done --verbose done && --verbose sed grep
+	export done -eu local then | done printf sed /usr/bin | 2>/dev/null
+		"$@" "$@" && --verbose $(pwd) -eu printf
+		"$1" ${HOME} ${HOME} cd grep export export readonly "$1" done awk printf awk
+| cd && then "$@" readonly
+x=1 -eu export test export | x=1 grep cd x=1 awk grep export done cd then
+done readonly grep "$1" 2>/dev/null awk ${HOME} done test printf
+awk sed "$1" x=1 "$1" "$1" /usr/bin sed cd --verbose
+	readonly local x=1 2>/dev/null $(pwd) "$1" --verbose --verbose
+2>/dev/null grep readonly 2>/dev/null local 'quoted text' local
+		/usr/bin then x=1 "$@" /usr/bin
+	cd then done done export && ${HOME} awk export grep export
+export awk sed "$1" test done -eu test x=1 2>/dev/null
+		printf done local awk -eu "$@" cd 'quoted text' awk echo awk | readonly ${HOME}
+	printf done readonly 2>/dev/null 'quoted text' $(pwd) done grep x=1 echo
+2>/dev/null | echo sed && --verbose "$@" 'quoted text'
+		--verbose ${HOME} | --verbose ${HOME} x=1 ${HOME} export local "$@" export 2>/dev/null
+	| "$@" then export "$1" echo test 2>/dev/null readonly "$@" "$1" && local cd awk
+	readonly echo echo "$@" $(pwd) $(pwd) 2>/dev/null awk local
+		sed x=1 printf local local test --verbose awk --verbose grep printf 2>/dev/null
+	readonly echo local 'quoted text' local
+		$(pwd) -eu --verbose echo test then 'quoted text'
+		local x=1 "$1" | $(pwd) -eu "$1" --verbose
+		'quoted text' --verbose local x=1 $(pwd) then then ${HOME}
+&& $(pwd) cd 2>/dev/null
+sed readonly cd then cd awk awk done awk "$@"
+		grep printf --verbose -eu "$1" readonly echo test
+		awk && 'quoted text' then && echo "$1" grep -eu test grep "$1" readonly
+done export | done /usr/bin -eu sed grep --verbose "$@" sed --verbose
+"$@" printf grep printf cd -eu sed printf
+		printf --verbose printf cd --verbose cd 2>/dev/null readonly
+	local printf x=1 printf readonly x=1 printf grep $(pwd)
+		test local then done test export 'quoted text'
+	"$@" ${HOME} test echo local && grep && 2>/dev/null printf &&
+	| 'quoted text' 'quoted text' x=1 printf then && x=1
+	grep grep echo test local
+'quoted text' | $(pwd) 2>/dev/null x=1 local
+--verbose local $(pwd) "$@" -eu "$@" $(pwd) export
+#include c151.sh
+readonly sed printf --verbose 2>/dev/null "$1" local --verbose -eu sed
+	--verbose $(pwd) printf "$1" /usr/bin readonly grep -eu ${HOME} 'quoted text'
+		sed -eu done local x=1 /usr/bin 2>/dev/null test "$1" awk then
+	| sed printf x=1 printf done 'quoted text'
+	${HOME} | readonly local readonly
+		echo x=1 2>/dev/null test | --verbose
+	sed $(pwd) awk 'quoted text' --verbose printf
+		${HOME} --verbose 2>/dev/null 'quoted text'
+		done "$@" --verbose -eu -eu readonly test sed "$1" cd local "$1" cd local | $(pwd)
+		'quoted text' printf -eu | ${HOME} then then --verbose ${HOME}
+		"$1" echo /usr/bin echo
+	echo -eu "$@" export "$@"
+done "$@" grep echo local /usr/bin
+"$1" awk ${HOME} echo "$@" 'quoted text'
+	echo && "$1" done /usr/bin && test grep ${HOME} sed $(pwd)
+		sed done awk --verbose | 'quoted text' readonly export
+	cd "$1" ${HOME} "$@" --verbose "$@" cd $(pwd) $(pwd) x=1 x=1 echo then 'quoted text'
+		grep 'quoted text' "$@" cd --verbose
+/usr/bin local local /usr/bin export $(pwd) echo --verbose
+	"$1" printf grep -eu ${HOME} printf printf test | /usr/bin
+done test "$@" cd printf local cd awk --verbose x=1 --verbose $(pwd)
+	&& 2>/dev/null sed printf awk /usr/bin readonly cd --verbose test sed 2>/dev/null
+		printf 'quoted text' 'quoted text'
+	cd done "$1" grep awk x=1 --verbose printf 2>/dev/null
+		&& export --verbose done readonly
+	grep /usr/bin "$1" local ${HOME} 2>/dev/null readonly awk 2>/dev/null
+${HOME} printf 2>/dev/null /usr/bin done 'quoted text' local "$1"
+	--verbose 2>/dev/null x=1 $(pwd) cd 2>/dev/null then awk grep export $(pwd)
+		| 2>/dev/null "$@" "$@" | local grep
+		sed then 2>/dev/null ${HOME} then then &&
+		test done export done "$1" -eu x=1 then ${HOME} test printf then -eu
+local ${HOME} then cd -eu $(pwd) && done awk && readonly | x=1 readonly then --verbose
+		-eu 2>/dev/null $(pwd) 2>/dev/null |
+		$(pwd) export -eu && && awk local sed && grep
+done && echo && readonly cd -eu && printf printf
+	echo echo export /usr/bin x=1 "$1"
+	/usr/bin sed then then echo 'quoted text' then test $(pwd)
+		$(pwd) "$1" export --verbose $(pwd) printf "$@" sed test x=1 then local &&
+	echo 2>/dev/null test test export echo "$@" "$@" then /usr/bin -eu test
+		local test ${HOME} test | x=1 then local grep test
+	sed readonly cd test -eu 'quoted text' 'quoted text' printf "$@" grep --verbose
+	readonly --verbose /usr/bin sed 'quoted text' then local readonly
+		done echo 2>/dev/null ${HOME} "$1" readonly 'quoted text' export -eu --verbose
+	/usr/bin "$@" | "$@" readonly cd then awk "$@" $(pwd) export done
+	x=1 $(pwd) "$1" cd grep cd -eu printf x=1 awk local cd && echo --verbose
+	${HOME} && then ${HOME} ${HOME} test printf export echo 'quoted text' /usr/bin
+	2>/dev/null local 2>/dev/null awk "$@" done x=1 sed local
+	then | "$1" test grep printf --verbose "$@" "$1" sed && cd local grep
+awk && sed x=1 then done done grep then ${HOME} "$@" ${HOME}
+	done local && grep "$@" readonly
+		grep /usr/bin done "$1" | 'quoted text' grep && "$@"
+	"$@" local printf && x=1 | x=1 readonly done --verbose 'quoted text' done --verbose
+	&& 'quoted text' ${HOME} $(pwd)
+cd cd local && && printf "$1"
+		grep local readonly export && cd then --verbose -eu |
+		test done then | -eu 'quoted text' awk | printf 2>/dev/null local readonly readonly
+"$@" x=1 && /usr/bin | ${HOME} sed done done && --verbose printf sed x=1 /usr/bin
+		cd ${HOME} $(pwd) && | --verbose
+		"$1" then then "$@" -eu 2>/dev/null x=1 $(pwd) $(pwd)
+done export local | ${HOME} then
+		cd x=1 awk done --verbose ${HOME} sed -eu
+	"$@" "$1" "$1" awk 'quoted text' done printf
+	--verbose ${HOME} | "$1" 2>/dev/null x=1 x=1 echo echo x=1 2>/dev/null grep
+done readonly cd printf sed -eu readonly
+--verbose -eu ${HOME} 2>/dev/null 'quoted text' export && sed x=1
+readonly x=1 -eu x=1 ${HOME} x=1 x=1 printf echo local ${HOME} $(pwd)
+		done awk awk -eu printf export && "$1" awk printf
+	| 2>/dev/null printf awk local ${HOME} ${HOME} -eu "$1" cd 2>/dev/null then echo
+		| printf test "$1" printf "$@" sed $(pwd) | readonly test | test "$1" local |
+	cd then grep 2>/dev/null --verbose && "$@" then 'quoted text' && awk grep then
+		'quoted text' --verbose --verbose done && printf /usr/bin then export 'quoted text'
+	"$1" $(pwd) export "$1" -eu x=1 export done readonly awk readonly export sed
+		done ${HOME} sed test "$1" readonly readonly "$@" ${HOME} cd 'quoted text'
+	--verbose sed /usr/bin done 'quoted text' cd test x=1
+		x=1 /usr/bin awk printf && && 'quoted text' | $(pwd) "$@" "$@" "$@" then
+done test /usr/bin /usr/bin local 'quoted text' printf | "$@" echo readonly
+	x=1 | /usr/bin /usr/bin /usr/bin local done $(pwd) awk then | && printf -eu sed
+		"$@" "$@" $(pwd) $(pwd) then grep readonly sed -eu
+		&& $(pwd) grep && readonly && $(pwd) &&
+		${HOME} export x=1 2>/dev/null /usr/bin "$1" ${HOME}
+		sed && | readonly ${HOME} printf done sed
+grep printf "$1" sed | awk test && export 2>/dev/null 'quoted text' /usr/bin readonly
+grep cd local | awk cd 'quoted text' then export awk
+	grep "$1" ${HOME} 2>/dev/null then export printf then ${HOME} /usr/bin
+| -eu done export cd local 2>/dev/null "$@" && x=1 cd "$1" 2>/dev/null /usr/bin
+	$(pwd) --verbose awk ${HOME} /usr/bin echo grep $(pwd)
+-eu test grep ${HOME} echo 'quoted text' ${HOME} grep readonly | printf 2>/dev/null
+echo then local then && printf
+	cd readonly | cd cd 'quoted text' test then readonly local done
+		x=1 cd | "$@" cd echo -eu export --verbose
+2>/dev/null x=1 && | cd /usr/bin cd $(pwd) cd cd grep sed printf awk sed printf
+		x=1 /usr/bin readonly && awk printf "$@" local printf $(pwd) export
+cd 'quoted text' $(pwd) /usr/bin /usr/bin ${HOME} /usr/bin
+	| -eu test cd x=1 cd x=1 done ${HOME} && echo done test 'quoted text'
+		awk awk ${HOME} then $(pwd) $(pwd) readonly -eu 'quoted text' --verbose
+	awk "$@" 2>/dev/null /usr/bin 'quoted text' test
+		done then grep local 'quoted text' sed
+		export "$1" export 'quoted text' sed x=1 local cd echo echo ${HOME} --verbose
+		done test export "$1" readonly export echo $(pwd) "$@" export awk done x=1
+	| local export test then /usr/bin ${HOME}
+		2>/dev/null --verbose ${HOME} grep && /usr/bin cd then "$1" && ${HOME}
+	&& then $(pwd) && export echo cd done readonly
+	$(pwd) sed $(pwd) 2>/dev/null then awk readonly printf ${HOME} then
+	local echo export echo "$1" && --verbose "$1" && "$@" grep $(pwd) readonly
+	$(pwd) && readonly test done test && x=1 "$1" readonly awk grep -eu &&
+grep $(pwd) done | printf "$1" -eu export x=1 2>/dev/null local
+${HOME} then "$@" 2>/dev/null | done test x=1 "$@" x=1 export cd export
+--verbose cd local --verbose 2>/dev/null awk -eu then && local echo
+		awk local awk cd grep local awk 'quoted text' 2>/dev/null test
+	$(pwd) test readonly $(pwd) printf
+	| cd export | -eu local x=1 then ${HOME} sed --verbose local "$1" "$@" printf
+echo "$@" printf done x=1 -eu |
+		--verbose done awk |
+		${HOME} -eu done --verbose cd awk $(pwd) awk done grep "$@" awk cd "$1"
+		"$@" 2>/dev/null x=1 then local sed -eu printf readonly
+then 2>/dev/null ${HOME}
+		test then 'quoted text' awk "$1" ${HOME} 2>/dev/null awk then local
+		-eu readonly readonly -eu readonly "$@"
+--verbose 2>/dev/null export x=1 export done "$1"
+&& local export $(pwd) readonly done sed --verbose printf 2>/dev/null awk
+	--verbose "$1" $(pwd) export && "$1" readonly readonly "$@" && printf $(pwd) echo
+x=1 "$1" readonly sed sed x=1
+export x=1 ${HOME} echo -eu --verbose
+		cd cd done done sed cd local awk awk export && test /usr/bin --verbose
+	--verbose cd && x=1 ${HOME} then test ${HOME} 'quoted text'
+	grep "$@" x=1 sed 2>/dev/null done
+| --verbose $(pwd) sed printf 2>/dev/null
+grep | test | local grep /usr/bin /usr/bin printf ${HOME} --verbose 2>/dev/null
+	--verbose export -eu sed x=1 x=1 test && awk echo awk grep cd test awk
+	| "$1" printf then && 2>/dev/null
+sed -eu grep "$1" echo awk echo 'quoted text' --verbose -eu sed then ${HOME}
+&& done --verbose 2>/dev/null $(pwd) grep -eu
+	'quoted text' /usr/bin --verbose export | -eu then x=1 then x=1 export
+	cd "$@" awk "$1" /usr/bin "$1" sed -eu awk then x=1 /usr/bin
+		-eu && local $(pwd) grep test "$1" sed then -eu --verbose
+export "$1" grep ${HOME} | -eu then test then then cd sed "$@" printf
+		cd ${HOME} echo && | awk 'quoted text' local && awk | cd "$1" awk --verbose 'quoted text'
+cd 2>/dev/null then then
+		then export done done && sed printf cd local /usr/bin printf export 2>/dev/null
+	test sed 'quoted text' --verbose
+	2>/dev/null $(pwd) | sed grep --verbose local local ${HOME}
+	x=1 test $(pwd) "$@" --verbose 'quoted text' x=1 x=1 then awk then local grep local
+	sed readonly echo && "$@" --verbose --verbose -eu echo "$@" && export readonly
+	"$@" 'quoted text' local printf /usr/bin cd "$1" readonly then ${HOME} ${HOME}
+	test done grep done grep -eu then -eu --verbose local grep -eu export
+	readonly "$@" 'quoted text' test local printf 2>/dev/null -eu x=1 "$@" 'quoted text'
+printf && | x=1 grep /usr/bin 2>/dev/null "$1" then grep local "$1" "$1"
+	test export --verbose test
+| ${HOME} && "$1" 2>/dev/null 2>/dev/null
+	sed echo "$@" | printf export echo 'quoted text' done $(pwd)
+		'quoted text' test test ${HOME} printf ${HOME} test ${HOME} grep
+	printf then 'quoted text' cd printf cd /usr/bin "$1" grep /usr/bin then local
+		test test cd --verbose export 'quoted text' | | $(pwd) then
+		2>/dev/null cd sed local 2>/dev/null -eu --verbose
+	$(pwd) grep "$1" readonly done printf then
+		/usr/bin --verbose done 'quoted text' export
+		then grep echo "$1" local $(pwd) echo done 'quoted text' awk cd /usr/bin local "$@"
+readonly x=1 2>/dev/null cd local "$@" --verbose -eu && printf test printf
+	sed --verbose -eu && x=1 printf 2>/dev/null | echo test $(pwd)
+		readonly "$1" -eu $(pwd) readonly -eu printf cd
+		"$@" printf ${HOME} 'quoted text' then
+sed ${HOME} "$@" | 2>/dev/null echo && echo
+	local -eu 'quoted text' printf test test 'quoted text' 'quoted text'
+&& export ${HOME} readonly local $(pwd)
+	readonly ${HOME} echo grep then test /usr/bin $(pwd)
+		$(pwd) 'quoted text' x=1
+		$(pwd) test sed $(pwd) "$1" printf
+	cd done printf | | --verbose grep &&
+	awk local done local && export --verbose grep 2>/dev/null | cd readonly
+"$@" "$@" grep cd $(pwd) grep done
+	"$1" /usr/bin --verbose $(pwd)
+readonly x=1 -eu grep sed 2>/dev/null "$@" awk /usr/bin /usr/bin --verbose | 'quoted text'
+		local local printf "$@" -eu | "$1" sed printf
+		-eu readonly 2>/dev/null && awk
+local "$@" printf $(pwd) printf grep echo 'quoted text' ${HOME}
+done awk x=1 sed /usr/bin 'quoted text' then echo $(pwd) local printf $(pwd)
+		printf sed -eu | "$@" -eu sed done grep -eu local echo awk ${HOME} "$@"
+		awk sed local awk 'quoted text' --verbose awk --verbose
+	${HOME} readonly "$1" ${HOME} /usr/bin "$@" /usr/bin
+	| -eu printf export done test
+	| export export "$@" test sed local sed then 'quoted text' x=1 then && "$1"
+	cd done readonly /usr/bin "$1" -eu test sed 'quoted text' test /usr/bin
+test echo ${HOME} 2>/dev/null cd 2>/dev/null --verbose done ${HOME} 'quoted text'
+2>/dev/null test readonly local -eu test --verbose then x=1 test
+	local test | $(pwd) && $(pwd) --verbose then --verbose "$@" | x=1 |
+"$@" local awk echo done
+		-eu grep "$1" grep export printf && --verbose grep done
+cd && --verbose $(pwd) cd | --verbose cd -eu awk
+	/usr/bin done readonly readonly 2>/dev/null
+	local echo /usr/bin 'quoted text'
+awk "$@" sed printf test ${HOME} | done export readonly
+	test awk x=1 && local ${HOME} | ${HOME} echo local export 'quoted text' sed local
+test readonly --verbose ${HOME} 'quoted text'
+		readonly -eu ${HOME} -eu /usr/bin && ${HOME} sed sed echo --verbose
+'quoted text' echo cd cd "$1" | done -eu test "$@"
+&& echo done done echo x=1 ${HOME}
+&& "$1" --verbose awk
+grep /usr/bin 'quoted text' $(pwd) grep 2>/dev/null done cd echo 2>/dev/null
+'quoted text' sed test -eu local "$1"
+then awk export "$@" echo echo ${HOME} then | readonly export
+grep --verbose grep echo echo --verbose sed ${HOME} awk test 2>/dev/null
+		"$@" ${HOME} readonly grep cd printf local done local local && done -eu "$@"
+then "$@" test sed -eu && && awk $(pwd) cd -eu then 2>/dev/null
+local --verbose cd ${HOME} && $(pwd)
+echo | --verbose ${HOME} | --verbose readonly
+	done 'quoted text' "$@" /usr/bin "$@"
+	readonly then -eu $(pwd) "$1" test sed "$@" echo local /usr/bin printf "$1"
+local local 2>/dev/null && -eu ${HOME} && $(pwd) $(pwd) cd
+	x=1 2>/dev/null cd | -eu grep /usr/bin grep ${HOME} x=1 ${HOME} | local ${HOME}
+	$(pwd) x=1 echo && sed echo --verbose 'quoted text'
+${HOME} test grep printf | printf sed export ${HOME} /usr/bin /usr/bin ${HOME}
+		readonly done ${HOME} ${HOME}
+	-eu x=1 /usr/bin /usr/bin
+&& then done grep --verbose --verbose
+		printf cd printf printf awk done
+		--verbose export -eu sed 2>/dev/null 'quoted text'
+	sed local done ${HOME} | export then export ${HOME} grep readonly
+		-eu "$@" --verbose --verbose readonly $(pwd) test done 2>/dev/null -eu grep
+		then /usr/bin -eu export readonly sed 2>/dev/null
+	export $(pwd) test grep export sed --verbose done cd local awk printf
+then | readonly readonly cd then | sed printf "$1" cd | readonly
+		cd readonly 2>/dev/null local local
+	printf "$1" sed --verbose "$@" done grep echo "$1"
+local -eu "$1" test awk -eu "$1" x=1 2>/dev/null 2>/dev/null
+		| printf --verbose echo cd awk local /usr/bin readonly awk then export cd
+		'quoted text' test "$1" "$@" export echo /usr/bin ${HOME} 2>/dev/null x=1
+		done export readonly readonly "$@" readonly /usr/bin readonly grep
+		x=1 done --verbose local local test "$@" readonly ${HOME}
+		/usr/bin x=1 x=1 done grep test 2>/dev/null
+		sed | "$@" printf /usr/bin -eu "$1" | "$@" x=1 then echo test printf echo x=1
+	x=1 2>/dev/null then | awk then echo local printf 2>/dev/null echo --verbose
+		local --verbose grep readonly "$@" | 2>/dev/null
+		"$@" /usr/bin 'quoted text' 2>/dev/null && grep test ${HOME}
+		&& echo test ${HOME} local 'quoted text' echo
+	test && local test -eu --verbose
+	printf --verbose grep && echo
+	awk 2>/dev/null | | x=1 echo -eu 'quoted text' readonly 'quoted text'
+		'quoted text' done x=1 $(pwd) sed ${HOME} --verbose "$1" then cd awk /usr/bin
+&& -eu | then 2>/dev/null readonly
+		grep printf --verbose readonly
+	&& export $(pwd) test 2>/dev/null
+		"$1" awk /usr/bin | 2>/dev/null
+	"$1" then /usr/bin x=1 && 2>/dev/null --verbose
+local 'quoted text' local -eu /usr/bin
+	test --verbose $(pwd) printf readonly echo echo echo
+	then then done test --verbose test -eu && readonly
+	cd then local 'quoted text' x=1 sed "$1"
+	echo export cd --verbose "$@" readonly test 'quoted text' then -eu
+	local awk && ${HOME} readonly then 2>/dev/null test then
+		--verbose "$1" printf cd && &&
+	grep $(pwd) sed | test
+		awk 'quoted text' awk readonly --verbose awk $(pwd)
+		/usr/bin && export "$@"
+		then 2>/dev/null done --verbose "$@" ${HOME} export printf printf echo test local
+"$@" local 2>/dev/null local local x=1 readonly -eu --verbose
+		export -eu awk "$@" "$@" readonly "$@" printf awk /usr/bin test 2>/dev/null
+	"$1" "$1" export echo readonly --verbose then ${HOME}
+	cd grep "$@" then && export awk cd 2>/dev/null
+	done x=1 2>/dev/null then | printf /usr/bin x=1 "$1" && readonly
+test 2>/dev/null 'quoted text'
+$(pwd) -eu "$1" readonly 'quoted text' printf 2>/dev/null
+		&& ${HOME} "$@" readonly awk | -eu
+		x=1 done then export test test done 2>/dev/null ${HOME} $(pwd) | | x=1 awk -eu
+		${HOME} echo x=1 grep readonly 2>/dev/null $(pwd) export $(pwd)
+"$@" cd --verbose $(pwd) $(pwd) awk sed grep
+'quoted text' --verbose 2>/dev/null
+		grep printf 'quoted text' local cd | 2>/dev/null
+sed grep x=1 sed readonly local local awk
+	--verbose then 2>/dev/null readonly "$@" cd
+"$@" export | 'quoted text' --verbose
+		then printf cd export $(pwd) "$1" -eu | | local -eu x=1 'quoted text' readonly
+	printf "$@" readonly && then grep local $(pwd) /usr/bin
+"$1" "$1" awk then --verbose x=1 done x=1 /usr/bin x=1 "$1" grep x=1 done 2>/dev/null
+	/usr/bin test done awk ${HOME} test sed
+export printf 2>/dev/null -eu
+		'quoted text' local readonly -eu awk done
+	test | local x=1 grep readonly --verbose ${HOME} "$1" done cd
+| awk && 'quoted text' -eu /usr/bin
+		--verbose && $(pwd) export $(pwd) $(pwd) test test && 2>/dev/null grep readonly
+x=1 2>/dev/null export then ${HOME} then "$@" export
+		export 'quoted text' done printf awk then --verbose $(pwd) done printf
+	sed --verbose 2>/dev/null cd | sed sed
+	&& ${HOME} echo readonly export
+		local cd readonly --verbose --verbose printf sed 2>/dev/null
+	export /usr/bin | export
+		then printf && 'quoted text' echo && 2>/dev/null 2>/dev/null done
+	awk test done x=1 awk && local export x=1 echo /usr/bin -eu printf 'quoted text'
+	export export echo && -eu | done ${HOME} && sed "$1"
+		"$1" sed && test /usr/bin $(pwd) x=1 printf /usr/bin cd awk 2>/dev/null
+		done x=1 --verbose 2>/dev/null -eu
+sed --verbose export /usr/bin ${HOME} $(pwd) then --verbose
+		local export then export sed "$1"
+	$(pwd) done ${HOME} grep $(pwd) readonly
+export x=1 && cd $(pwd) --verbose sed 2>/dev/null printf
+	echo export local -eu "$@" then awk 2>/dev/null 2>/dev/null ${HOME} done awk
+		sed printf sed export /usr/bin && printf "$@" x=1 -eu grep ${HOME}
+	&& "$1" "$@" --verbose readonly readonly 2>/dev/null
+	grep then awk ${HOME}
+		done ${HOME} test local done ${HOME} grep 'quoted text'
+		-eu /usr/bin "$@" export readonly awk awk grep export done cd --verbose done
+		"$1" echo awk $(pwd) export sed -eu done -eu done test "$1" grep test then cd
+grep then -eu grep cd ${HOME}
+done grep 2>/dev/null test
+	readonly | sed "$@" 'quoted text'
+		grep | then grep grep --verbose
+/usr/bin x=1 grep && then export test grep test
+		"$@" 'quoted text' grep
+		'quoted text' "$@" ${HOME} test readonly
+readonly grep awk | export /usr/bin awk "$1" done 2>/dev/null
+	grep && printf sed x=1 sed sed
+x=1 $(pwd) /usr/bin then $(pwd) /usr/bin local && echo done grep
+	$(pwd) x=1 && done 'quoted text' local then readonly $(pwd) ${HOME}
+		x=1 2>/dev/null -eu x=1 echo sed
+	local local test export 2>/dev/null && local echo
+${HOME} echo grep done cd --verbose "$1" echo "$@" x=1 -eu ${HOME}
+		-eu && export && ${HOME} | done $(pwd) 'quoted text' grep printf
+		sed export export ${HOME} ${HOME} 2>/dev/null "$@" local $(pwd) --verbose
+	sed 'quoted text' cd x=1 | "$@" 2>/dev/null
+		cd local x=1 "$@" done && | x=1 then
+		cd -eu -eu export && local "$@" | readonly readonly ${HOME} "$@"
+		export export awk local local x=1 readonly | "$@"
+--verbose awk grep ${HOME} awk readonly cd x=1 awk 'quoted text'
+test test --verbose local
+export awk 'quoted text' printf --verbose echo printf grep
+	x=1 "$@" --verbose printf
+2>/dev/null done printf cd done awk readonly test x=1
+	printf /usr/bin printf sed /usr/bin
+	| local export | -eu "$@" awk
+test --verbose "$1" --verbose /usr/bin /usr/bin
+	printf readonly 2>/dev/null readonly
+	echo 'quoted text' "$@" test sed $(pwd) /usr/bin | "$1" done /usr/bin "$@" echo
+		awk done $(pwd) $(pwd) export echo "$@" --verbose $(pwd)
+	$(pwd) grep grep x=1 && 'quoted text' --verbose 'quoted text' $(pwd)
+	then | then echo done awk cd sed "$1" then 'quoted text' test test export done
+/usr/bin cd 'quoted text' echo "$1" && export
+-eu $(pwd) readonly printf readonly grep awk 2>/dev/null | awk
+		$(pwd) -eu $(pwd) local && readonly sed grep /usr/bin echo grep printf $(pwd)
+	test -eu ${HOME} "$1" awk echo done
+	/usr/bin then /usr/bin readonly cd printf --verbose readonly
+2>/dev/null echo readonly printf
+	-eu -eu "$1" $(pwd) -eu done cd test
+	2>/dev/null echo x=1 export
+&& x=1 grep export echo ${HOME} awk | cd --verbose then cd
+		2>/dev/null $(pwd) ${HOME} && sed "$1" ${HOME}
+	awk -eu $(pwd) 'quoted text' x=1 export echo /usr/bin
+	${HOME} --verbose "$1" sed echo 2>/dev/null 2>/dev/null
+printf 'quoted text' readonly
+/usr/bin $(pwd) "$1" grep && && | test 'quoted text' -eu -eu readonly 2>/dev/null
+	${HOME} printf -eu export | then -eu done 'quoted text' test cd
+	export x=1 'quoted text' "$@"
+		then then --verbose grep --verbose done local x=1 2>/dev/null
+--verbose x=1 sed "$@" export && printf $(pwd)
+		readonly done done | grep done cd echo export -eu
+-eu ${HOME} ${HOME} $(pwd) local then | grep printf ${HOME} local 'quoted text'
+		local x=1 printf "$@" ${HOME} printf ${HOME} awk grep grep
+	--verbose | printf printf local export 2>/dev/null 'quoted text'
+		'quoted text' "$@" done && sed && cd awk then sed
+export sed | echo x=1 local ${HOME} | grep "$1" readonly
+	done awk -eu readonly | then /usr/bin cd
+grep "$@" cd printf -eu echo then -eu 'quoted text' "$@"
+		grep | /usr/bin ${HOME} "$1" echo /usr/bin printf test -eu /usr/bin readonly
+		'quoted text' "$1" x=1 done x=1 test cd /usr/bin then test &&
+$(pwd) local ${HOME} then ${HOME} 'quoted text' grep $(pwd) echo /usr/bin
+		local sed 2>/dev/null sed printf
+	2>/dev/null $(pwd) "$@" awk x=1 sed
+		x=1 export "$1" export "$1" $(pwd)
+		readonly done test "$1" cd 2>/dev/null then test then
+		"$@" grep grep "$1" --verbose "$@" then echo printf "$1"
+local "$1" export 'quoted text' && sed grep export local
+	grep -eu --verbose "$1" then awk export 'quoted text'
+		grep then readonly cd then export 2>/dev/null x=1 && printf then test && then
+${HOME} "$@" sed sed printf test test --verbose "$1" grep local | local ${HOME}
+		local export then test
+then export printf awk cd printf printf readonly then export awk then
+	-eu readonly cd readonly cd
+cd grep test awk /usr/bin echo grep test "$1" | sed local 'quoted text'
+		printf cd ${HOME} local echo "$@" then local readonly export
+| grep local readonly 2>/dev/null 2>/dev/null printf done
+	awk 'quoted text' sed local grep -eu 2>/dev/null test | $(pwd) test 2>/dev/null
+		'quoted text' /usr/bin -eu local readonly
+readonly readonly $(pwd) "$@" then "$@" -eu
+	cd $(pwd) /usr/bin grep then x=1 done -eu cd $(pwd)
+&& 2>/dev/null grep readonly
+$(pwd) grep cd sed 2>/dev/null
+	-eu grep "$@" sed "$@" -eu 2>/dev/null
+${HOME} done local done done grep sed $(pwd) sed awk test
+	"$@" local grep "$1" export 'quoted text' x=1 echo printf | awk
+grep x=1 awk local local && /usr/bin cd -eu "$@"
+		--verbose awk done ${HOME} $(pwd) grep awk awk 'quoted text' local && /usr/bin
+		"$1" grep export -eu && local /usr/bin cd ${HOME} $(pwd)
+		test done --verbose echo --verbose test sed "$@" awk done 'quoted text' "$@"
+done readonly printf export then --verbose printf 2>/dev/null
+	"$1" grep test "$@" $(pwd) export
+	local readonly sed x=1 test && export
+		sed -eu -eu /usr/bin -eu awk x=1 printf 'quoted text' awk x=1 export --verbose
+/usr/bin local "$@" local x=1 2>/dev/null grep
+		echo && 2>/dev/null awk export 'quoted text'
+	-eu test /usr/bin sed local echo $(pwd) "$1" x=1 readonly "$@"
+-eu export /usr/bin x=1
+	then -eu 2>/dev/null then grep
+2>/dev/null ${HOME} "$1" awk x=1 2>/dev/null
+then 'quoted text' awk ${HOME} then echo cd echo
+	"$1" x=1 2>/dev/null readonly local x=1 cd export 2>/dev/null done --verbose
+		2>/dev/null local ${HOME} 'quoted text' cd
+		"$1" awk && grep export /usr/bin then -eu grep --verbose && grep printf
+		then 'quoted text' | "$1" grep
+	echo awk "$1" sed "$@" readonly local local done --verbose sed 'quoted text'
+		${HOME} printf grep ${HOME} /usr/bin awk -eu readonly | printf --verbose awk
+		'quoted text' readonly done
+--verbose then readonly sed echo --verbose "$1" "$1" "$1" &&
+	then | local | "$@" test sed 'quoted text' grep | x=1
+	2>/dev/null done local local then grep | local $(pwd) -eu x=1 'quoted text'
+	awk readonly test done test readonly
+		readonly test "$1" && printf
+		local /usr/bin x=1 x=1 readonly
+	local --verbose readonly then 2>/dev/null
+		grep "$@" | export export /usr/bin sed "$1"
+	/usr/bin 'quoted text' ${HOME} awk &&
+	then done $(pwd) && echo | --verbose awk "$@" echo /usr/bin
+	echo printf printf 2>/dev/null x=1 then "$1" then done local x=1 'quoted text'
+	sed sed printf 'quoted text' -eu export 'quoted text' done cd export export
+		| 'quoted text' "$1" ${HOME} 2>/dev/null
+		awk sed 2>/dev/null then
+		printf "$1" x=1 test
+x=1 "$1" | export awk $(pwd) local readonly --verbose
+sed test -eu local export done "$@" echo $(pwd)
+&& grep /usr/bin then printf export awk
+/usr/bin awk done readonly
+-eu done awk done awk readonly $(pwd) export "$1" export
+	| $(pwd) ${HOME} then printf
+/usr/bin export --verbose awk /usr/bin readonly
+		$(pwd) printf x=1 && printf --verbose /usr/bin
+	done x=1 awk readonly ${HOME} |
+		$(pwd) printf "$1" then grep done done readonly
+cd ${HOME} then "$1" local echo awk printf
+		printf ${HOME} | /usr/bin done grep 2>/dev/null
+		readonly "$@" local /usr/bin -eu 2>/dev/null grep readonly then -eu
+	local | "$1" $(pwd) x=1 grep "$1" export echo export ${HOME} done grep sed
+		| -eu then sed "$1" ${HOME} awk "$@" export && awk /usr/bin $(pwd) awk
+		-eu $(pwd) readonly $(pwd) test "$1" readonly done 'quoted text' readonly sed
+sed "$@" && export 2>/dev/null /usr/bin done
+		"$1" awk ${HOME} "$@" printf x=1 /usr/bin
+readonly grep "$@" then && /usr/bin $(pwd) -eu x=1 then && --verbose cd
+$(pwd) test --verbose "$@" -eu 'quoted text'
+		readonly $(pwd) --verbose | | test "$1" 'quoted text' --verbose then
+	'quoted text' ${HOME} "$@" cd cd awk local 'quoted text' local readonly
+'quoted text' && awk -eu "$@" awk test --verbose
+local done && then then readonly
+		awk echo "$1" | grep --verbose "$1" echo -eu $(pwd) echo | cd test
+		export x=1 awk "$1" local local | sed
+		done "$@" "$1" test grep "$1" cd /usr/bin sed done | printf 2>/dev/null
+then --verbose -eu | 'quoted text'
+$(pwd) echo then ${HOME} | "$@" then test sed cd "$@" -eu -eu cd && x=1 "$@"
+	"$@" then | --verbose 2>/dev/null awk | local echo local printf x=1 echo local
+		cd local /usr/bin 'quoted text' test printf | | printf cd "$1" && && /usr/bin
+	sed | readonly readonly "$@" 'quoted text' |
+	2>/dev/null readonly local local --verbose sed 2>/dev/null
+/usr/bin awk && then local awk -eu local done awk grep --verbose ${HOME} /usr/bin
+	/usr/bin && "$@" 'quoted text'
+	done $(pwd) -eu echo /usr/bin | "$1" printf 'quoted text' done
+then "$1" readonly printf awk $(pwd) sed x=1 "$1" 'quoted text'
+"$@" cd readonly local "$@" 'quoted text' --verbose
+echo export local /usr/bin then
+	printf echo sed cd test | local sed cd readonly ${HOME}
+'quoted text' ${HOME} echo
+		-eu awk local && "$1" ${HOME}
+'quoted text' sed awk printf local export printf awk sed $(pwd) done ${HOME}
+		x=1 2>/dev/null x=1 printf awk
+		$(pwd) awk export && awk $(pwd) 'quoted text' export x=1 readonly echo cd 2>/dev/null
+"$1" x=1 echo echo local cd cd grep echo $(pwd) 'quoted text'
+	x=1 local sed readonly grep x=1 grep --verbose
+	sed then local test readonly "$@" $(pwd) && readonly -eu /usr/bin
+	&& "$@" | export readonly "$@" 2>/dev/null
+--verbose then printf ${HOME} 'quoted text'
+2>/dev/null done ${HOME} grep ${HOME}
+	grep x=1 echo cd ${HOME} awk /usr/bin sed awk export
+echo local cd then echo --verbose cd /usr/bin 'quoted text' cd | cd then -eu
+	readonly x=1 /usr/bin local then readonly 'quoted text'
+	sed /usr/bin echo && /usr/bin && done "$@" test test && then then /usr/bin
+		--verbose grep awk echo
+awk /usr/bin 2>/dev/null | done
+	echo sed printf 'quoted text'
+		done readonly local test local cd export ${HOME} sed x=1 sed then grep export
+		&& && && "$1" echo awk grep x=1 printf sed test then echo | readonly sed
+	echo awk export cd ${HOME} "$1" test ${HOME}
+		x=1 "$@" readonly sed x=1 'quoted text' $(pwd) $(pwd) 'quoted text'
+	${HOME} ${HOME} printf &&
+		echo done 'quoted text' cd x=1 readonly
+test | && 'quoted text' readonly then "$1" cd ${HOME} grep local /usr/bin x=1 echo
+	x=1 -eu sed grep readonly
+		"$1" printf x=1 2>/dev/null $(pwd) && grep /usr/bin
+printf 'quoted text' x=1 'quoted text' --verbose
+echo ${HOME} x=1 "$1" "$1" readonly printf readonly ${HOME}
+	x=1 -eu echo test /usr/bin | && cd grep awk grep "$@" then printf grep export
+cd echo | done local --verbose ${HOME} --verbose
+test | test $(pwd) echo local | cd echo /usr/bin
+${HOME} /usr/bin /usr/bin -eu x=1 /usr/bin --verbose local 2>/dev/null "$1"
+-eu 'quoted text' -eu printf export "$@" readonly | cd && /usr/bin
+x=1 "$@" | done test echo export cd 'quoted text'
+	sed done grep printf echo /usr/bin "$@" x=1 sed echo test grep x=1
+	export printf ${HOME} export cd "$@" ${HOME} done local x=1
+done "$1" test readonly echo /usr/bin
+--verbose then --verbose
+	local awk 'quoted text' 'quoted text' echo "$1" ${HOME} readonly done local awk
+"$@" printf then /usr/bin ${HOME} -eu echo readonly
+	test test printf 2>/dev/null | --verbose sed
+		x=1 "$@" "$1" readonly ${HOME} -eu --verbose && "$1" 2>/dev/null
+		done local done "$@" printf "$@" export ${HOME} export echo "$1"
+	"$@" /usr/bin 'quoted text' 2>/dev/null | printf
+"$1" -eu | "$@" && "$1" -eu grep
+	grep sed done /usr/bin awk cd --verbose
+	${HOME} $(pwd) then 2>/dev/null
+		awk -eu ${HOME} done 2>/dev/null
+	sed 2>/dev/null x=1 'quoted text' cd echo && readonly
+		${HOME} grep x=1 sed x=1 2>/dev/null
+		awk echo readonly "$1" done
+		| 2>/dev/null -eu && && && --verbose 'quoted text' -eu readonly
+--verbose 'quoted text' echo -eu && awk awk && test printf /usr/bin then
+		x=1 readonly "$@" -eu | test "$1" test
+'quoted text' export export done "$@" cd local "$@" echo -eu /usr/bin
+	2>/dev/null && echo --verbose
+	local --verbose "$1" awk /usr/bin --verbose
+		printf done -eu ${HOME} -eu local test
+echo && $(pwd) "$1" local readonly printf | x=1
+	-eu then -eu done awk
+	'quoted text' export cd cd "$1" $(pwd) printf
+		2>/dev/null ${HOME} x=1 "$@" ${HOME} then "$1" cd -eu grep "$1"
+$(pwd) printf echo /usr/bin local awk export printf "$@" export done printf
+test && awk && $(pwd) local test sed $(pwd) awk done "$@"
+	sed /usr/bin cd -eu grep "$1" test local 'quoted text'
+		test local echo x=1 grep x=1 readonly /usr/bin sed $(pwd) x=1 done 2>/dev/null
+		/usr/bin grep && grep sed 'quoted text' ${HOME} local
+	"$1" 2>/dev/null /usr/bin local sed ${HOME} x=1 && 'quoted text' | cd
+$(pwd) && done printf cd test cd | local grep done "$@" -eu echo local 2>/dev/null
+--verbose done && "$@" done --verbose done then
+	grep test printf readonly && then 2>/dev/null sed export done local test cd test
+'quoted text' readonly sed $(pwd)
+local cd /usr/bin readonly printf 'quoted text' echo
+		grep cd ${HOME} && sed | readonly && | local done && sed
+	printf -eu --verbose test
+cd local -eu "$@" $(pwd) && test test $(pwd) | export ${HOME}
+		export test grep then 2>/dev/null cd echo export
+sed awk echo --verbose | 2>/dev/null grep /usr/bin 2>/dev/null
+	printf then done cd --verbose /usr/bin 'quoted text' && awk
+		sed printf grep && readonly then 2>/dev/null
+grep then $(pwd) ${HOME} sed sed "$@" | -eu grep x=1 done --verbose
+	printf && echo echo test cd echo printf awk --verbose --verbose
+	grep local done test x=1 "$1" && echo && /usr/bin 2>/dev/null
+	cd -eu local grep done cd -eu
+	readonly cd --verbose /usr/bin then grep cd 2>/dev/null grep 2>/dev/null
+		--verbose $(pwd) local $(pwd) cd /usr/bin
+	export export -eu local then ${HOME} echo cd grep
+	local done "$@" awk cd cd readonly /usr/bin
+x=1 printf readonly grep && printf ${HOME} export ${HOME} local
+	printf | 'quoted text' test echo -eu "$1" --verbose ${HOME}
+	$(pwd) done sed cd $(pwd) sed $(pwd) cd | readonly
+	-eu awk test export done 'quoted text'
+2>/dev/null --verbose && sed done grep --verbose 'quoted text' then local
+		$(pwd) test 'quoted text' printf "$@" test /usr/bin && test
+		--verbose local "$@" | then echo /usr/bin sed /usr/bin ${HOME} ${HOME} && $(pwd)
+	export sed $(pwd) 'quoted text' | export
+awk "$1" /usr/bin /usr/bin && printf cd test | done
+		"$1" && /usr/bin awk 'quoted text' -eu /usr/bin x=1 | awk grep
+| "$1" x=1 grep x=1 /usr/bin "$1"
+		then readonly -eu ${HOME}
+		echo done | "$@" export /usr/bin done | x=1 test && test | x=1 printf
+then x=1 | -eu "$@" 2>/dev/null local printf ${HOME} /usr/bin 'quoted text' $(pwd)
+printf --verbose 2>/dev/null ${HOME} -eu readonly ${HOME} x=1 readonly
+		"$@" sed -eu | "$1" export grep x=1 local $(pwd) "$@" sed local
+	echo test "$1" sed $(pwd) done && cd sed x=1 cd
+	2>/dev/null done test --verbose
+		"$1" cd echo sed done /usr/bin cd --verbose
+		grep /usr/bin -eu 'quoted text'
+		grep local printf echo
+		cd echo ${HOME} grep "$1" then | export 2>/dev/null
+		readonly sed ${HOME}
+		"$@" awk "$@" done done /usr/bin done | x=1 2>/dev/null
+		&& printf 2>/dev/null "$@" local && x=1 "$1" "$1" then cd --verbose "$1" "$@" readonly
+cd export "$@" -eu "$1" sed 2>/dev/null "$@" && --verbose printf $(pwd) export
+		export $(pwd) awk 2>/dev/null sed 'quoted text' printf echo
+	| local ${HOME} sed awk "$1" readonly 2>/dev/null /usr/bin
+		${HOME} then test $(pwd) done x=1 "$1" test && $(pwd) |
+"$1" ${HOME} done export echo local done
+		$(pwd) $(pwd) /usr/bin | $(pwd) ${HOME}
+		-eu echo x=1 "$1" then then local sed "$1" readonly
+$(pwd) | test 'quoted text' | readonly test then "$1" awk echo then
+		x=1 done "$1" && "$1" awk --verbose local "$1" 2>/dev/null /usr/bin "$1" "$@" awk
+		local $(pwd) test readonly --verbose
+"$1" readonly printf readonly done sed x=1 awk grep echo export done
+		"$1" -eu $(pwd) $(pwd) readonly x=1 then echo sed local then awk $(pwd)
+local then --verbose sed
+awk grep --verbose 'quoted text' test printf "$@" "$@" test -eu | local
+cd sed "$@" grep $(pwd) awk printf "$@" echo test export printf
+'quoted text' then echo cd local && readonly | cd 'quoted text'
+	2>/dev/null grep && test 'quoted text' then then -eu && 'quoted text' 'quoted text'
+| 'quoted text' done readonly --verbose grep 2>/dev/null $(pwd) cd && echo cd
+	${HOME} printf echo 2>/dev/null --verbose 'quoted text' 2>/dev/null
+		'quoted text' sed ${HOME} done
+	2>/dev/null | done | cd export
+echo sed --verbose cd
+		awk $(pwd) awk local "$1" "$1" ${HOME} sed --verbose -eu sed done cd test
+&& printf awk done x=1
+		awk -eu ${HOME} ${HOME} awk && then local then "$@" 'quoted text' grep
+	--verbose -eu test && 'quoted text' ${HOME} /usr/bin
+2>/dev/null local test -eu cd | awk | readonly
+		export 'quoted text' && cd && 'quoted text'
+grep --verbose readonly && -eu --verbose x=1 $(pwd) "$@" "$@"
+		&& printf awk echo grep "$1" "$1" test -eu echo -eu $(pwd) awk cd
+		printf ${HOME} cd --verbose test echo x=1 -eu done $(pwd) export
+2>/dev/null cd -eu test "$1" sed awk 2>/dev/null 'quoted text'
+2>/dev/null grep --verbose --verbose "$@"
+x=1 local && echo | echo 2>/dev/null echo sed
+		printf ${HOME} "$1" $(pwd)
+		x=1 cd export sed $(pwd) | cd -eu && $(pwd) cd printf "$@" export "$1" x=1
+awk export $(pwd) sed export
+		done done --verbose "$@" then --verbose $(pwd) awk
+	awk -eu ${HOME} export /usr/bin /usr/bin
+	'quoted text' local awk awk grep | export "$1" local readonly
+echo local x=1 x=1 printf "$@" readonly "$1" "$1" done "$1" "$@" -eu $(pwd)
+		/usr/bin 'quoted text' readonly then grep awk then -eu ${HOME} grep export "$@"
+	x=1 readonly --verbose /usr/bin "$1" x=1 export
+		awk cd done sed printf echo 'quoted text' local "$@" readonly
+		$(pwd) /usr/bin printf --verbose
+		${HOME} sed local printf cd grep ${HOME} sed done -eu echo echo
+	"$1" sed awk test export echo 2>/dev/null 2>/dev/null sed $(pwd) then "$1" sed
+--verbose export --verbose /usr/bin | -eu "$@" export --verbose
+then awk grep /usr/bin awk 'quoted text' readonly
+awk -eu && readonly && echo ${HOME} test x=1 'quoted text' echo
+		then sed cd export then printf awk 2>/dev/null
+local $(pwd) "$@" local readonly printf then --verbose cd grep test
+		printf echo local echo cd grep 'quoted text' $(pwd)
+	"$1" x=1 "$@" then -eu export test printf x=1 export --verbose then
+		echo "$1" 2>/dev/null $(pwd) export printf echo | ${HOME} --verbose "$@" test readonly
+		awk --verbose then grep $(pwd) printf 2>/dev/null echo
+$(pwd) awk 'quoted text' then "$1"
+${HOME} cd /usr/bin readonly export
+	/usr/bin export "$1" | /usr/bin $(pwd) echo ${HOME}
+"$@" ${HOME} then 'quoted text' $(pwd) then && && sed export /usr/bin ${HOME}
+-eu --verbose "$1" export local local printf export grep
+	"$@" $(pwd) export awk printf "$@" test ${HOME}
+		2>/dev/null sed export cd printf cd x=1 awk && "$@" grep "$@"
+	export ${HOME} ${HOME} test test x=1 /usr/bin
+awk awk "$@" echo then x=1 $(pwd) echo /usr/bin
+		readonly 'quoted text' | /usr/bin
+	cd awk /usr/bin then done 2>/dev/null | readonly "$1" test --verbose
+echo --verbose then -eu export ${HOME} export "$@" cd -eu 'quoted text' local
+local --verbose test sed echo -eu && cd test 2>/dev/null export --verbose 2>/dev/null
+		-eu "$1" --verbose awk "$1" cd sed cd x=1 --verbose
+		test && sed 'quoted text' "$1" cd echo sed "$1" 2>/dev/null
+		printf printf 'quoted text' echo ${HOME} printf awk sed awk /usr/bin
+test ${HOME} $(pwd) /usr/bin then
+	sed && && "$@" done ${HOME} printf && --verbose 2>/dev/null ${HOME} "$@" 'quoted text'
+		test done --verbose local done && sed sed done export sed ${HOME}
+awk cd printf 'quoted text' "$1" --verbose 'quoted text' 2>/dev/null test
+	readonly awk && grep grep
+	readonly local sed $(pwd) --verbose cd then ${HOME} ${HOME}
+awk readonly -eu echo 'quoted text' /usr/bin test ${HOME}
+then local echo grep ${HOME} /usr/bin /usr/bin
+	2>/dev/null --verbose ${HOME} $(pwd) printf cd && done && printf && printf
+		export export awk readonly export "$1" echo printf 2>/dev/null x=1 cd x=1 ${HOME}
+		grep local done 2>/dev/null | readonly | sed x=1 ${HOME} local done echo done "$1"
+	&& export && --verbose --verbose cd export "$1" then readonly | 'quoted text'
+	local done $(pwd) "$@" then grep /usr/bin printf cd done awk -eu then x=1 "$1"
+&& "$1" readonly done -eu readonly $(pwd) "$1" | /usr/bin "$@" "$1"
+		/usr/bin grep 'quoted text' --verbose -eu grep &&
+	2>/dev/null done then then
+	/usr/bin "$1" ${HOME} test echo -eu ${HOME} /usr/bin
+		| test sed $(pwd) 2>/dev/null awk grep | 'quoted text' cd cd "$@" "$1"
+	local printf x=1 --verbose printf done
+"$1" echo export echo ${HOME}
+	printf done && export echo "$1"
+printf /usr/bin printf 'quoted text' /usr/bin
+		grep ${HOME} $(pwd) readonly "$@" printf "$@" $(pwd) export cd
+$(pwd) printf 2>/dev/null "$1" echo ${HOME} | cd sed cd
+export test cd local readonly grep sed test grep
+		${HOME} "$@" "$@" --verbose
+	${HOME} local readonly "$1" | 2>/dev/null cd && echo ${HOME} --verbose sed -eu
+	${HOME} 2>/dev/null printf awk printf export && x=1 export
+		awk ${HOME} local then | sed x=1 "$1" x=1 test test && ${HOME}
+printf "$@" "$1" "$@" /usr/bin local $(pwd) awk printf "$@"
+	$(pwd) 'quoted text' "$@" && && "$@" $(pwd) sed local
+		-eu && /usr/bin grep 'quoted text'
+--verbose awk 2>/dev/null readonly done "$@" "$@" x=1 x=1 -eu /usr/bin
+2>/dev/null $(pwd) | test /usr/bin x=1 grep grep awk x=1 x=1
+| printf /usr/bin cd done ${HOME} test sed awk "$@" ${HOME}
+| && ${HOME} x=1 2>/dev/null "$1" echo | $(pwd) 'quoted text'
+		awk cd grep local "$1" -eu readonly readonly sed export x=1
+/usr/bin test printf x=1 && local -eu local
+	export cd sed 2>/dev/null 'quoted text' 'quoted text' /usr/bin test
+	test | "$1" && -eu done done && ${HOME} 2>/dev/null
+	"$1" local ${HOME} "$@" local readonly "$1" /usr/bin 'quoted text'
+		${HOME} cd awk sed then --verbose ${HOME} && echo printf readonly sed awk
+sed --verbose readonly "$@" export done grep 'quoted text' sed ${HOME}
+/usr/bin -eu && cd x=1 echo local "$@" -eu "$1" /usr/bin readonly sed
+		2>/dev/null $(pwd) x=1 -eu x=1 done "$@" ${HOME} x=1 --verbose
+	"$@" printf cd "$@" awk
+	printf then export 'quoted text' | 'quoted text' --verbose && done 'quoted text'
+echo | awk "$1" | 2>/dev/null ${HOME} $(pwd) "$1" --verbose
+		local export export echo
+/usr/bin && x=1 then sed ${HOME} printf ${HOME} cd -eu
+		&& 'quoted text' "$1" "$@" 'quoted text' --verbose --verbose 2>/dev/null export
+--verbose 2>/dev/null then sed
+"$@" "$@" then sed cd echo --verbose --verbose 2>/dev/null
+$(pwd) x=1 x=1 grep --verbose grep local x=1 awk | 2>/dev/null export
+	-eu "$@" "$1" /usr/bin test cd printf printf /usr/bin
+	x=1 x=1 $(pwd) 'quoted text' sed x=1 export | readonly
+		then printf --verbose done "$1" sed done 2>/dev/null "$1"
+printf local echo && readonly && "$1" ${HOME} done "$1"
+		$(pwd) readonly ${HOME} $(pwd) && "$@" grep cd
+	sed /usr/bin printf grep cd export | $(pwd)
+	'quoted text' "$@" printf && && -eu then ${HOME}
+		x=1 echo 2>/dev/null 2>/dev/null then local /usr/bin
+		export sed 'quoted text' then --verbose 'quoted text'
+| "$@" -eu --verbose "$1" -eu awk -eu export 2>/dev/null "$1" -eu
+awk -eu && "$@" test awk export $(pwd) x=1 && export readonly
+"$1" printf grep export
+local 2>/dev/null echo export local grep 2>/dev/null echo
+awk export x=1 -eu 2>/dev/null $(pwd) 2>/dev/null
+		echo local x=1 cd && 'quoted text'
+	awk test ${HOME} then done -eu ${HOME} cd --verbose echo local then sed awk
+		echo "$@" /usr/bin printf then local ${HOME} "$1" && grep
+	grep "$1" local test test
+		$(pwd) then --verbose | printf awk
+"$@" --verbose sed readonly cd then /usr/bin
+	'quoted text' $(pwd) "$1" cd "$@" 'quoted text' 'quoted text'
+	echo "$1" x=1 2>/dev/null done --verbose 2>/dev/null 'quoted text'
+export x=1 echo local /usr/bin
+--verbose | cd ${HOME} cd -eu export echo done readonly
+	${HOME} /usr/bin done x=1 echo local awk local -eu "$1"
+	--verbose && | then echo then export printf printf then echo export x=1 printf
+	"$@" printf cd awk readonly test $(pwd) sed -eu | done printf
+cd then sed "$1" test awk then export printf local ${HOME}
+	&& done 'quoted text' then then "$1" ${HOME}
+	done ${HOME} export x=1 ${HOME} readonly 'quoted text'
+	--verbose "$1" printf echo test test done &&
+		local && echo "$1" printf grep awk
+	echo "$@" awk cd then awk 2>/dev/null printf 'quoted text' cd test
+local && && /usr/bin ${HOME} export
+cd "$1" "$1" && awk "$1" done done
+-eu ${HOME} ${HOME} local test 'quoted text'
+x=1 echo test export printf 2>/dev/null
+		echo grep /usr/bin 'quoted text' /usr/bin | --verbose
+local done grep sed 'quoted text'
+	${HOME} 'quoted text'
+		awk | 'quoted text' cd done cd /usr/bin x=1 'quoted text' 'quoted text' sed |
+printf -eu && local grep grep | local awk printf "$@" ${HOME}
+		awk then done && printf
+	| then test cd /usr/bin --verbose /usr/bin "$1" /usr/bin
+| readonly awk ${HOME} $(pwd)
+	/usr/bin export --verbose 2>/dev/null printf 'quoted text' /usr/bin sed
+		then 'quoted text' test export cd local
+${HOME} export grep then -eu local ${HOME}
+	'quoted text' export 2>/dev/null echo local then export
+${HOME} local echo $(pwd) cd
+test printf && | | printf 'quoted text'
+	&& $(pwd) test grep "$@" "$1" printf grep 2>/dev/null cd awk x=1 printf
+"$1" then local readonly printf --verbose sed "$1" $(pwd) ${HOME} /usr/bin
+	2>/dev/null && "$@" echo | "$@" awk 2>/dev/null test readonly echo | local
+2>/dev/null -eu awk grep ${HOME} export "$1" --verbose
+		cd $(pwd) 'quoted text' "$1" local then "$@" done "$@"
+	cd then ${HOME} $(pwd) "$1" export local then "$@" sed ${HOME} x=1 export
+awk 'quoted text' 'quoted text' $(pwd) -eu x=1 echo
+--verbose ${HOME} then cd readonly
+		grep 'quoted text' printf cd done export
+	grep export cd "$1" readonly
+		"$1" 'quoted text' then -eu done ${HOME}
+done "$@" && grep ${HOME} "$@" echo
+grep --verbose --verbose test -eu grep cd ${HOME}
+	echo $(pwd) $(pwd) x=1 test |
+		/usr/bin readonly /usr/bin /usr/bin export
+then done readonly $(pwd)
+		printf -eu "$@" "$1" "$1" local sed export 'quoted text'
+-eu && echo 2>/dev/null then test 'quoted text' export done local
+		local "$@" then readonly printf
+		cd | -eu $(pwd) done 'quoted text' -eu local awk test local | echo -eu awk export
+'quoted text' test "$1" readonly 'quoted text' --verbose
+		grep awk /usr/bin --verbose done ${HOME} --verbose && $(pwd) export $(pwd)
+	export sed printf printf "$1" "$1" "$@"
+${HOME} done done | -eu && -eu && export printf -eu 2>/dev/null test test
+grep x=1 awk && test /usr/bin grep x=1 x=1 "$@" echo 'quoted text'
+/usr/bin sed cd $(pwd) -eu export then x=1
+$(pwd) && /usr/bin "$@" /usr/bin 2>/dev/null done "$@" "$1"
+		--verbose && x=1 -eu local done 'quoted text' 'quoted text' --verbose
+${HOME} printf --verbose
+	${HOME} /usr/bin cd | sed "$1" --verbose sed ${HOME} local /usr/bin awk /usr/bin
+	then echo local then && ${HOME} "$1" | "$@" local | echo
+		export 'quoted text' "$@" "$@" done cd
+	2>/dev/null echo -eu -eu awk 'quoted text' "$@" ${HOME} done | export x=1
+	printf 'quoted text' ${HOME} printf | cd local
+	echo readonly $(pwd) "$1" then ${HOME} done -eu local done then grep done && cd
+--verbose ${HOME} sed | $(pwd) | sed printf -eu export
+	2>/dev/null test ${HOME} local -eu local 2>/dev/null
+2>/dev/null x=1 --verbose && then "$1" x=1 awk echo export cd x=1 done
+	local x=1 'quoted text' "$@" printf done x=1 export done grep printf then 2>/dev/null
+		grep | && awk then "$@" 2>/dev/null
+		/usr/bin /usr/bin local sed --verbose
+		awk "$1" cd 'quoted text' then grep then printf done
+		sed local -eu grep done sed $(pwd) "$1" awk &&
+grep then 2>/dev/null local echo done cd
+	export | ${HOME} 2>/dev/null readonly x=1 "$@" | -eu "$@" then -eu /usr/bin echo
+	printf "$1" awk cd then local | readonly local "$@" ${HOME} $(pwd) ${HOME} export
+	x=1 echo export export grep ${HOME}
+	sed 'quoted text' readonly 'quoted text' x=1 printf
+	"$@" -eu printf cd -eu awk done -eu $(pwd) /usr/bin sed /usr/bin ${HOME} readonly
+echo "$1" done echo printf test
+		2>/dev/null /usr/bin "$@" x=1
+printf "$1" sed x=1 --verbose
+done test x=1 -eu /usr/bin test 'quoted text'
+test -eu done export $(pwd) test ${HOME} then
+		/usr/bin x=1 "$1" sed 2>/dev/null
+	sed /usr/bin awk export echo done then "$1" ${HOME} |
+cd local echo export readonly export 2>/dev/null export "$1"
+/usr/bin && sed export export ${HOME} && x=1 grep export ${HOME} $(pwd)
+	printf && export then then "$1" then readonly grep
+&& done done done $(pwd) /usr/bin -eu && awk
+readonly sed -eu done echo local
+	"$1" "$@" done "$@" sed echo export
+		sed 2>/dev/null then "$1" then then 'quoted text' "$@" readonly cd then -eu -eu
+		| done "$@" export --verbose
+printf cd local export readonly x=1 "$1" echo local |
+${HOME} cd awk test "$1" x=1 done $(pwd) -eu export
+"$@" printf test $(pwd) readonly grep grep readonly -eu 2>/dev/null
+		2>/dev/null && test ${HOME} done done ${HOME} cd echo test readonly
+		test awk $(pwd) echo && test $(pwd) test
+printf x=1 cd done --verbose grep echo local readonly x=1 | && awk printf
+2>/dev/null | "$@" cd x=1 printf -eu grep done x=1 test awk /usr/bin $(pwd)
+	$(pwd) done x=1 --verbose && echo local then /usr/bin local grep
+-eu | awk local grep
+		$(pwd) ${HOME} 'quoted text'
+	printf ${HOME} readonly awk export "$@" echo | 2>/dev/null awk ${HOME}
+	"$1" ${HOME} "$1" "$1" sed "$@"
+-eu cd test 'quoted text' sed then done -eu cd readonly
+export printf test echo x=1 test /usr/bin then x=1
+		printf awk echo sed --verbose local
+	| cd test --verbose awk "$1" then
+	awk && sed test then ${HOME} && "$@" x=1 "$1" printf
+		| test readonly cd x=1 sed sed local printf ${HOME}
+		then done cd awk --verbose local && readonly
+	"$1" test 2>/dev/null awk ${HOME} $(pwd) "$@" && echo printf --verbose 2>/dev/null
+		${HOME} sed x=1 printf /usr/bin export awk awk test ${HOME} -eu | printf && "$@"
+export sed done local /usr/bin && done 'quoted text' awk | done "$@" readonly
+		2>/dev/null then echo echo
+	2>/dev/null | awk ${HOME} x=1 x=1 echo awk "$@" printf
+		then done ${HOME} readonly sed 2>/dev/null
+		done "$@" awk x=1 awk cd "$1" test
+		printf ${HOME} readonly then 2>/dev/null "$1"
+	"$1" /usr/bin done "$1" /usr/bin 'quoted text' export "$@" 2>/dev/null
+		&& grep "$@" test local grep
+		then 'quoted text' grep readonly local "$@"
+		-eu export x=1 then && /usr/bin 2>/dev/null printf local "$@"
+	sed 'quoted text' local 2>/dev/null printf ${HOME} export
+	'quoted text' then "$@" ${HOME} awk export sed sed export
+		x=1 printf awk -eu readonly /usr/bin | sed /usr/bin 2>/dev/null done readonly
+	&& ${HOME} "$1" --verbose export printf ${HOME} /usr/bin "$1" cd
+test printf $(pwd) $(pwd) printf 2>/dev/null local "$1" "$1"
+"$@" 'quoted text' test awk && then 'quoted text' test $(pwd)
+		--verbose && -eu --verbose --verbose && | readonly ${HOME} awk done ${HOME} /usr/bin
+grep echo readonly cd printf printf cd -eu done "$@" awk x=1 && readonly
+	export then export done done "$@" /usr/bin then -eu
+		grep 'quoted text' local local test "$1"
+		printf 2>/dev/null then $(pwd) then 'quoted text'
+	"$1" then grep sed --verbose cd echo
+		grep ${HOME} test test 2>/dev/null
+	echo $(pwd) 'quoted text' grep 'quoted text'
+sed x=1 2>/dev/null export x=1 echo then x=1
+then echo grep readonly ${HOME}
+echo 2>/dev/null grep cd | $(pwd) /usr/bin | "$1"
+		$(pwd) readonly export printf sed readonly test then grep
+	test sed ${HOME} -eu local echo
+/usr/bin ${HOME} printf $(pwd) local cd awk
+	&& 'quoted text' 2>/dev/null -eu cd -eu ${HOME} "$1"
+		cd ${HOME} $(pwd) /usr/bin
+		readonly printf $(pwd) grep 'quoted text' 2>/dev/null grep 'quoted text'
+local -eu printf grep "$@" ${HOME}
+then echo echo readonly x=1 done awk awk printf "$@" awk export && | echo 'quoted text'
+	export $(pwd) ${HOME} | printf && x=1 readonly 2>/dev/null -eu $(pwd) && && local
+		local cd awk 2>/dev/null | --verbose then then export local echo x=1 'quoted text'
+done /usr/bin test export 2>/dev/null x=1 then "$@" test test
+	$(pwd) local -eu /usr/bin /usr/bin readonly local -eu ${HOME} sed --verbose
+| printf | 2>/dev/null && 'quoted text' --verbose test grep | x=1 -eu
+		| echo x=1 grep done --verbose local awk awk
+"$@" awk awk $(pwd) printf "$1" /usr/bin done test then "$1" echo
+sed grep 'quoted text' test 'quoted text' export "$1" "$@" sed awk
+		local grep readonly export local
+echo "$1" /usr/bin --verbose export test grep test "$@" then /usr/bin /usr/bin
+/usr/bin 2>/dev/null readonly "$@" --verbose echo
+sed then then sed grep echo 2>/dev/null
+	&& done export echo local echo awk awk 2>/dev/null ${HOME} && awk ${HOME}
+		awk $(pwd) && "$@" done echo grep
+export test printf awk 'quoted text' printf
+test cd cd local "$1" --verbose 'quoted text' "$@" printf "$@" $(pwd) $(pwd)
+	-eu $(pwd) $(pwd) local readonly -eu ${HOME} test -eu
+	then echo readonly ${HOME}
+	2>/dev/null --verbose then $(pwd) "$@"
+	&& awk done | export | $(pwd) && sed -eu | "$1" test -eu readonly readonly
+done cd x=1 ${HOME} done test ${HOME}
+-eu $(pwd) ${HOME} --verbose x=1
+	cd then sed 'quoted text' "$1" 2>/dev/null printf ${HOME} --verbose $(pwd) grep
+| local --verbose $(pwd) sed -eu printf
+		awk local readonly -eu done grep x=1 echo sed cd ${HOME} done done then
+--verbose awk ${HOME} | 2>/dev/null cd sed && sed -eu
+		then 'quoted text' cd x=1 2>/dev/null "$1"
+	/usr/bin printf "$1" local 2>/dev/null 2>/dev/null /usr/bin
+"$1" 'quoted text' cd
+	"$1" export && printf "$@" local /usr/bin "$@" done $(pwd)
+		local 2>/dev/null x=1 $(pwd) cd 2>/dev/null
+	"$1" done local echo --verbose sed cd done grep -eu
+		| ${HOME} --verbose -eu cd awk "$@" readonly then cd 2>/dev/null test
+readonly && --verbose echo printf done readonly ${HOME} export
+		/usr/bin grep --verbose ${HOME} printf sed local
+		printf export cd 'quoted text'
+grep --verbose $(pwd) grep echo echo printf $(pwd)
+		echo test awk --verbose local readonly ${HOME} 'quoted text'
+x=1 "$@" printf "$1" cd export done awk test
+	awk | /usr/bin readonly awk done export local ${HOME} | echo test "$1" awk x=1
+		sed 'quoted text' $(pwd) awk $(pwd) "$@" -eu /usr/bin cd
+-eu test readonly export local x=1 $(pwd)
+	export ${HOME} 2>/dev/null awk && grep local
+		test /usr/bin 2>/dev/null export
+&& && "$@" then grep export --verbose
+local 'quoted text' --verbose readonly |
+	$(pwd) sed then export --verbose printf /usr/bin
+	&& "$@" done "$@" $(pwd) | printf
+	x=1 | sed ${HOME} test /usr/bin
+	-eu awk | test awk readonly grep grep grep -eu sed 'quoted text'
+		awk local readonly x=1 test grep cd echo "$@"
+	awk echo "$@" then | grep ${HOME}
+		awk /usr/bin echo "$@" cd cd /usr/bin
+		| 2>/dev/null /usr/bin local /usr/bin done /usr/bin
+export 2>/dev/null readonly echo $(pwd) then test test export printf
+		&& && awk "$@" 'quoted text' x=1 export
+	'quoted text' -eu /usr/bin export ${HOME} ${HOME} grep
+		export cd awk local test --verbose awk grep $(pwd) | && "$@" /usr/bin
+		2>/dev/null export x=1 test ${HOME}
+	cd readonly test | "$1" 'quoted text' echo echo test grep printf then --verbose
+	readonly ${HOME} $(pwd) && ${HOME} "$@" --verbose "$@" | "$@" done 2>/dev/null
+${HOME} $(pwd) printf cd
+	-eu --verbose -eu awk --verbose sed grep
+2>/dev/null echo | -eu /usr/bin -eu local cd | awk && echo sed --verbose sed
+		x=1 "$1" -eu | echo cd x=1
+cd -eu echo cd echo && && "$@" ${HOME} done done && export printf printf
+	&& 2>/dev/null $(pwd) 'quoted text' /usr/bin | /usr/bin grep 'quoted text'
+done test | -eu 2>/dev/null done printf --verbose
+	echo export 2>/dev/null | then then ${HOME} readonly readonly
+$(pwd) printf cd done then
+	then /usr/bin 'quoted text' local && ${HOME} | 2>/dev/null printf
+	awk local sed cd | $(pwd) export $(pwd) $(pwd) $(pwd) printf
+$(pwd) grep && ${HOME}
+printf test && readonly local && export grep /usr/bin "$1" sed
+awk cd export then --verbose $(pwd) printf awk printf export "$1" /usr/bin test
+		grep "$@" grep x=1 'quoted text' "$@" test
+	"$@" test 2>/dev/null && 2>/dev/null
+	printf 2>/dev/null 'quoted text' "$1" /usr/bin awk ${HOME} printf then 'quoted text'
+		awk /usr/bin /usr/bin "$1" 'quoted text' awk
+test "$1" $(pwd) 'quoted text'
+then ${HOME} 2>/dev/null --verbose
+	export 'quoted text' --verbose 'quoted text' 2>/dev/null local --verbose cd x=1
+test readonly printf echo
+		/usr/bin awk "$1" awk "$1"
+echo export ${HOME} printf ${HOME} readonly x=1 awk printf | cd x=1
+	-eu 2>/dev/null printf test ${HOME} x=1 -eu "$@" "$@" ${HOME}
+		printf done awk then readonly readonly awk && /usr/bin awk local grep grep
+printf local readonly readonly x=1 grep awk done awk local /usr/bin /usr/bin
+	"$1" cd local $(pwd) /usr/bin sed
+		${HOME} "$1" ${HOME} "$1" echo /usr/bin $(pwd) printf "$@" | echo awk
+		"$1" /usr/bin printf "$1" local /usr/bin -eu echo /usr/bin |
+		echo cd local then --verbose 'quoted text'
+		then then cd ${HOME} grep export $(pwd) readonly test
+	x=1 ${HOME} export 2>/dev/null
+2>/dev/null then grep /usr/bin "$1" local export export $(pwd)
+--verbose --verbose $(pwd) test done sed test | echo
+export ${HOME} 2>/dev/null 'quoted text' ${HOME} | readonly "$@" 2>/dev/null then
+2>/dev/null test /usr/bin "$@" 2>/dev/null "$1" readonly then done echo export
+		--verbose cd "$@" 'quoted text'
+2>/dev/null export ${HOME}
+		&& local grep local readonly -eu export awk x=1 'quoted text' local | done 2>/dev/null
+export done echo && 'quoted text' 'quoted text' grep echo readonly printf
+printf $(pwd) then done | x=1 | | then
+printf /usr/bin | then done readonly --verbose --verbose /usr/bin sed x=1 sed
+		printf export grep then readonly 'quoted text'
+		-eu $(pwd) ${HOME} cd grep awk 2>/dev/null then echo sed readonly
+	&& cd 2>/dev/null && sed 2>/dev/null
+	-eu export $(pwd) local --verbose done grep /usr/bin --verbose then
+		2>/dev/null -eu && sed echo && grep then
+	printf then readonly cd grep done "$@" 2>/dev/null && $(pwd)
+grep x=1 2>/dev/null sed awk printf "$@" $(pwd) "$@" then done export 2>/dev/null
+		"$1" x=1 awk export export printf readonly local printf
+"$@" -eu -eu done "$1" local $(pwd) --verbose /usr/bin 2>/dev/null grep
+		"$1" readonly | x=1 cd ${HOME}
+| x=1 local | $(pwd) 'quoted text' test -eu then local 'quoted text'
+	awk local test 2>/dev/null local export $(pwd) /usr/bin
+		"$@" x=1 grep grep $(pwd) readonly
+		x=1 $(pwd) x=1 2>/dev/null local test
+		"$@" export /usr/bin 'quoted text' -eu printf 'quoted text'
+		readonly grep 2>/dev/null local test local 'quoted text' $(pwd) export x=1 awk
+printf then done ${HOME} test /usr/bin
+		${HOME} $(pwd) echo /usr/bin $(pwd) test sed printf
+		printf ${HOME} sed --verbose then awk grep ${HOME} ${HOME} /usr/bin x=1 --verbose
+cd local /usr/bin ${HOME} "$@" grep export 'quoted text'
+local awk readonly "$@" sed echo -eu done sed x=1 && sed local
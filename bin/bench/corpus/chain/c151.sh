@@ -0,0 +1,2001 @@
+	/usr/bin readonly x=1 | sed /usr/bin grep export x=1 export -eu export grep
+		test 'quoted text' then | | x=1 local /usr/bin then awk
+		--verbose ${HOME} echo $(pwd) readonly 'quoted text'
+	export "$@" -eu -eu done $(pwd)
+	local "$@" grep export "$@" then /usr/bin /usr/bin ${HOME}
+then "$1" grep /usr/bin export cd ${HOME} && test then then ${HOME} grep echo
+&& x=1 'quoted text' cd 2>/dev/null cd x=1 $(pwd)
+	then echo "$1" -eu echo local x=1
+	then -eu cd "$1" sed local -eu --verbose
+local awk export /usr/bin 'quoted text' x=1 awk "$@" x=1 sed ${HOME}
+local /usr/bin cd done "$1"
+export | sed grep 2>/dev/null
+		&& grep && done grep printf done --verbose echo local test --verbose | ${HOME}
+	x=1 'quoted text' x=1 -eu export --verbose
+		x=1 awk -eu cd x=1 $(pwd) x=1 x=1 /usr/bin ${HOME}
+readonly --verbose then printf | x=1 awk echo
+		grep ${HOME} readonly ${HOME} readonly
+	readonly $(pwd) then 'quoted text' cd |
+	echo && local && 'quoted text' ${HOME} done local
+	--verbose sed /usr/bin "$@" local
+		| readonly awk 2>/dev/null &&
+		cd "$1" ${HOME} cd 2>/dev/null
+	sed "$1" && 'quoted text' | echo 2>/dev/null x=1 echo grep
+	local --verbose x=1 && test /usr/bin echo -eu awk awk cd cd then
+	| "$1" grep "$@" then readonly ${HOME} test /usr/bin 2>/dev/null
+		"$1" && x=1 sed then 'quoted text' echo echo 'quoted text'
+		-eu x=1 printf | && local /usr/bin grep sed cd awk
+| x=1 "$@" echo ${HOME} 'quoted text' ${HOME} readonly 2>/dev/null --verbose 'quoted text'
+		&& | "$@" /usr/bin cd -eu awk readonly "$1" readonly local 2>/dev/null
+		${HOME} --verbose x=1 cd 'quoted text'
+	--verbose awk done then "$1" export
+	'quoted text' x=1 test printf echo /usr/bin $(pwd) $(pwd) $(pwd)
+	"$1" readonly 2>/dev/null
+awk 'quoted text' "$1" readonly then
+		&& echo 'quoted text'
+	'quoted text' printf -eu then ${HOME} cd export -eu && | | echo
+		cd && "$1" $(pwd) local awk readonly $(pwd) local readonly "$@"
+	-eu x=1 'quoted text' readonly
+$(pwd) export ${HOME} | test -eu printf
+		$(pwd) 2>/dev/null --verbose ${HOME} test 'quoted text' ${HOME} awk
+		done /usr/bin ${HOME} local x=1 cd
+printf grep x=1 then done 'quoted text' printf 2>/dev/null ${HOME}
+		'quoted text' 'quoted text' 'quoted text' sed "$@" printf then local /usr/bin
+		${HOME} echo grep sed echo "$@" then
+		${HOME} -eu printf 'quoted text' awk cd $(pwd) grep local export 'quoted text'
+/usr/bin done /usr/bin test "$@" test "$@" x=1 |
+		cd cd && export /usr/bin "$1" test && 2>/dev/null then x=1 grep echo
+-eu --verbose cd export sed --verbose 'quoted text'
+awk cd x=1 /usr/bin grep cd | readonly -eu awk local 'quoted text' ${HOME} && grep
+then sed sed 2>/dev/null cd
+		x=1 test readonly awk printf 'quoted text' done
+		echo awk 'quoted text' export && -eu $(pwd)
+awk readonly awk local /usr/bin /usr/bin $(pwd) | x=1 'quoted text' test echo
+		x=1 "$@" echo "$1" sed 2>/dev/null && ${HOME} -eu /usr/bin
+		/usr/bin grep --verbose && then /usr/bin grep -eu export --verbose local
+	--verbose ${HOME} $(pwd) awk x=1 local then $(pwd) "$@" "$1" --verbose
+		/usr/bin --verbose --verbose && /usr/bin export
+	grep x=1 awk then echo /usr/bin
+	echo sed "$@" sed test -eu done "$1" local
+"$@" | && "$@" x=1 grep ${HOME} readonly
+sed grep -eu sed ${HOME} --verbose 2>/dev/null "$1" grep export 2>/dev/null
+		'quoted text' sed cd ${HOME} export "$1"
+	-eu -eu "$@" awk test
+	${HOME} x=1 then | export 'quoted text' readonly done export --verbose
+		/usr/bin export then cd --verbose cd readonly then ${HOME} --verbose
+	echo "$1" printf 'quoted text' export
+	then -eu --verbose "$@" 'quoted text' awk sed export export ${HOME}
+	done && /usr/bin $(pwd) &&
+awk printf | | done ${HOME} awk export test
+		/usr/bin "$@" then cd awk $(pwd) sed "$@" | -eu printf --verbose
+/usr/bin "$@" && $(pwd) printf 2>/dev/null /usr/bin readonly ${HOME}
+done ${HOME} "$1" then test /usr/bin test -eu
+	"$@" "$1" | -eu && done echo sed $(pwd) grep ${HOME} ${HOME} sed /usr/bin
+	'quoted text' test | 'quoted text'
+		done printf readonly ${HOME} done awk && /usr/bin /usr/bin local
+local -eu echo --verbose /usr/bin export /usr/bin
+	"$@" test cd /usr/bin cd && done sed readonly local grep cd local
+		-eu done --verbose export
+grep awk -eu --verbose $(pwd) test printf "$@" then -eu awk /usr/bin done
+		-eu printf -eu ${HOME} /usr/bin ${HOME} $(pwd) sed
+grep grep grep sed 2>/dev/null | test
+test x=1 /usr/bin sed -eu local "$@" x=1 readonly
+/usr/bin ${HOME} awk printf /usr/bin sed $(pwd) 2>/dev/null
+	echo test test | done cd "$@" /usr/bin
+	sed echo grep "$@" cd printf "$1" awk ${HOME} /usr/bin "$@" awk
+sed && "$1" echo ${HOME} /usr/bin ${HOME} | x=1 --verbose "$@" --verbose printf
+		cd 'quoted text' then cd
+readonly $(pwd) cd test "$@" done
+test sed --verbose local done x=1 -eu echo $(pwd) -eu -eu | /usr/bin /usr/bin
+$(pwd) export sed ${HOME} printf
+	2>/dev/null cd --verbose export echo done 2>/dev/null
+		awk 'quoted text' test awk echo x=1 cd ${HOME} 'quoted text' --verbose ${HOME}
+		export done "$@" 'quoted text' && /usr/bin printf -eu ${HOME}
+local sed then sed 2>/dev/null
+done 2>/dev/null echo local echo local echo
+		x=1 readonly local $(pwd) awk export sed 'quoted text' export local export $(pwd)
+		2>/dev/null local export echo "$1" awk then
+		grep local local -eu 2>/dev/null --verbose
+	then $(pwd) readonly --verbose echo "$1" done cd done "$@" printf
+		echo grep done done --verbose && 'quoted text' export -eu |
+		export grep && echo $(pwd) then --verbose 2>/dev/null 'quoted text'
+		-eu -eu printf local echo export $(pwd) 'quoted text'
+	| /usr/bin done --verbose
+	export -eu test 2>/dev/null -eu &&
+		-eu sed "$@" "$1" readonly
+	then echo | done x=1 export sed done printf --verbose grep
+export awk printf --verbose readonly 'quoted text' | readonly local
+"$1" cd "$1" 2>/dev/null
+cd readonly --verbose | | printf ${HOME} && then readonly
+	"$@" 'quoted text' echo grep printf
+		'quoted text' $(pwd) printf -eu grep test cd awk /usr/bin "$1" done 2>/dev/null
+		awk echo | $(pwd) | then echo readonly cd 'quoted text' printf export
+cd awk awk 2>/dev/null "$@" $(pwd) cd printf
+		awk -eu | $(pwd) test && 'quoted text' "$@" printf sed test -eu -eu test "$@"
+	export --verbose 'quoted text' |
+		2>/dev/null printf "$1" echo local printf "$@" awk printf /usr/bin "$1" awk 'quoted text'
+		local test ${HOME} printf "$1" /usr/bin --verbose | sed --verbose local
+x=1 $(pwd) "$@" | 'quoted text' && --verbose --verbose readonly sed test | 'quoted text'
+	done test echo printf readonly
+	sed | echo -eu printf && printf done 'quoted text' export
+then $(pwd) test $(pwd) && -eu 'quoted text' grep "$1" cd grep cd | 'quoted text'
+&& sed -eu cd -eu awk --verbose readonly echo &&
+		/usr/bin local readonly "$1" sed /usr/bin test ${HOME}
+	echo test then echo $(pwd) then "$1" grep
+		x=1 2>/dev/null 'quoted text' "$1" x=1 readonly "$@" --verbose cd 2>/dev/null
+		local printf 'quoted text' done && then ${HOME} printf | local printf
+	local "$1" | x=1 ${HOME} x=1 "$@" grep awk "$1" printf done -eu
+"$1" readonly local 'quoted text' cd readonly grep
+		export export | --verbose awk local --verbose export --verbose printf "$@"
+		then local && sed "$@" | "$@" -eu ${HOME} readonly test 'quoted text'
+	grep grep && test "$1" grep x=1 --verbose ${HOME} x=1 awk "$1" &&
+	-eu 'quoted text' $(pwd) awk printf
+	printf test | ${HOME} test $(pwd) cd &&
+| printf "$1" | then $(pwd) sed cd echo printf -eu echo sed
+		x=1 then then $(pwd) && 2>/dev/null test cd
+done awk sed x=1 x=1 'quoted text' && awk --verbose export
+local export && cd $(pwd) 2>/dev/null done done
+	-eu --verbose "$@" printf printf sed local "$1" test x=1
+	cd && sed /usr/bin test && then awk
+		x=1 ${HOME} printf done | $(pwd) done
+sed && grep grep "$1" --verbose 'quoted text' sed awk grep readonly 'quoted text'
+echo sed && ${HOME} --verbose --verbose then ${HOME}
+test test cd 2>/dev/null readonly | ${HOME} ${HOME} "$@" cd && grep x=1 sed
+export readonly ${HOME} export $(pwd)
+cd test /usr/bin -eu grep export test ${HOME} --verbose
+export ${HOME} readonly "$@" 'quoted text' sed 'quoted text' local grep "$@"
+	echo export local echo |
+	--verbose test -eu printf 2>/dev/null
+		'quoted text' && ${HOME} export /usr/bin awk $(pwd) && sed --verbose export
+local $(pwd) -eu local export 2>/dev/null echo "$1" | then local local grep
+	/usr/bin local $(pwd) | | | $(pwd)
+local 2>/dev/null --verbose test 'quoted text'
+-eu "$1" | ${HOME} "$1" "$@"
+		| awk sed printf export "$1" echo test test "$1" awk &&
+	-eu awk "$@" ${HOME} "$1" ${HOME} "$1" /usr/bin
+		'quoted text' export test then readonly sed then local
+		"$@" 'quoted text' then --verbose --verbose
+		-eu x=1 readonly x=1 printf --verbose echo then "$1" echo "$@" sed
+test --verbose awk "$1" "$@" 2>/dev/null "$1" 2>/dev/null awk
+export done 2>/dev/null readonly local grep 'quoted text' -eu printf "$1" printf
+		$(pwd) sed done awk && 'quoted text' $(pwd)
+		&& 2>/dev/null --verbose test "$1"
+		cd readonly local "$@" echo cd cd | echo
+		'quoted text' done -eu -eu 2>/dev/null "$@" | 2>/dev/null x=1 'quoted text'
+		$(pwd) -eu ${HOME} grep ${HOME} readonly
+		echo "$@" export && echo awk $(pwd) "$@" x=1
+done cd 2>/dev/null && --verbose | local test --verbose cd ${HOME} 'quoted text'
+--verbose && x=1 | done $(pwd) done printf export echo export readonly
+	grep && cd -eu "$1" "$@" echo $(pwd) "$@" ${HOME} ${HOME} sed ${HOME} ${HOME} 2>/dev/null
+sed test "$@" 'quoted text' ${HOME} echo /usr/bin $(pwd) --verbose export export
+	-eu --verbose echo readonly $(pwd)
+--verbose 2>/dev/null then cd | readonly readonly local | done readonly
+local && sed 2>/dev/null 2>/dev/null /usr/bin printf cd sed "$1"
+	&& "$1" local awk export /usr/bin && 2>/dev/null cd awk 'quoted text'
+	grep readonly 2>/dev/null sed export grep ${HOME} awk
+${HOME} then printf then then export echo grep 2>/dev/null export
+		local export "$@" cd done /usr/bin
+	grep /usr/bin export grep 2>/dev/null
+	cd ${HOME} "$1" echo echo test --verbose /usr/bin echo local echo done
+&& $(pwd) "$@" "$1" sed --verbose printf
+	$(pwd) 'quoted text' grep ${HOME} 2>/dev/null readonly x=1 -eu awk echo
+		${HOME} /usr/bin $(pwd) local --verbose
+	echo "$1" grep ${HOME} done readonly export
+	"$@" ${HOME} 'quoted text' local printf then | printf | export ${HOME}
+	echo then 2>/dev/null $(pwd)
+	cd cd printf local --verbose printf /usr/bin "$@" "$@"
+	done awk "$1" echo | "$@" | ${HOME} awk /usr/bin -eu x=1 "$1" local printf
+		/usr/bin 2>/dev/null $(pwd) export ${HOME} grep ${HOME} local ${HOME} ${HOME}
+then readonly 2>/dev/null printf 'quoted text' sed
+	then x=1 printf local awk $(pwd)
+		done readonly 2>/dev/null cd readonly && printf ${HOME} /usr/bin "$1" x=1 echo
+	awk && 'quoted text' | | | done local awk awk done echo "$1"
+	$(pwd) x=1 readonly "$@" "$1" $(pwd)
+"$1" $(pwd) then readonly | readonly grep | 2>/dev/null -eu sed cd | done x=1
+	'quoted text' awk ${HOME} then /usr/bin x=1 x=1 x=1 done -eu done awk awk
+	'quoted text' cd then export test sed
+		cd /usr/bin $(pwd) printf
+		test printf $(pwd) readonly
+	x=1 readonly 2>/dev/null ${HOME} local
+"$1" sed && sed --verbose awk printf "$@" "$1" then export cd --verbose
+		'quoted text' | local readonly test -eu "$@" /usr/bin test export awk x=1
+		echo then --verbose && ${HOME} -eu cd 2>/dev/null
+readonly --verbose x=1 echo
+		'quoted text' --verbose cd awk local 2>/dev/null ${HOME} | /usr/bin
+		&& && printf /usr/bin --verbose printf local
+"$1" "$@" grep then done -eu printf 2>/dev/null && sed | && |
+	"$1" echo | /usr/bin readonly
+-eu awk 2>/dev/null /usr/bin "$@" x=1 "$1"
+	x=1 local --verbose export sed | 'quoted text' $(pwd)
+test local then sed -eu 'quoted text' "$@"
+	done $(pwd) grep printf --verbose --verbose
+local echo then "$@" "$1" -eu cd $(pwd)
+then done then awk --verbose -eu 2>/dev/null --verbose local
+	export -eu /usr/bin --verbose
+	--verbose readonly done
+done grep local test "$@" grep printf
+-eu /usr/bin cd local
+		| awk sed "$@" grep done echo cd $(pwd) cd ${HOME} printf --verbose
+	2>/dev/null done 'quoted text' "$1" --verbose x=1 local ${HOME} --verbose
+	local then local /usr/bin export cd test "$1"
+x=1 done export awk && --verbose && then
+	done awk done export | done "$@" 'quoted text' 'quoted text' ${HOME}
+local grep cd /usr/bin
+	readonly /usr/bin test awk /usr/bin --verbose done echo 'quoted text' grep
+awk "$1" /usr/bin readonly "$@" 'quoted text'
+local awk printf done
+"$@" grep -eu local done 2>/dev/null
+x=1 /usr/bin echo 'quoted text' readonly
+	2>/dev/null -eu cd 'quoted text' x=1 /usr/bin export cd export 2>/dev/null 2>/dev/null
+	then awk -eu then | awk "$1" /usr/bin "$@" | ${HOME}
+		x=1 then readonly --verbose && done export echo done
+	then sed export 2>/dev/null
+		export then printf /usr/bin 'quoted text' | cd readonly awk readonly
+'quoted text' -eu awk --verbose readonly test done echo printf
+	| | && test "$@" printf | 'quoted text'
+		x=1 local sed && test | cd && readonly grep export --verbose
+	then x=1 then && $(pwd) --verbose printf
+| test && test grep $(pwd) | done
+		readonly cd export cd 'quoted text' grep readonly 'quoted text'
+	/usr/bin $(pwd) | grep 'quoted text'
+		cd local export awk echo | awk echo awk && 2>/dev/null
+readonly sed grep cd x=1 local local awk test --verbose test --verbose
+		export /usr/bin readonly local test
+&& | local local export cd then local sed sed
+		done cd 'quoted text' then cd -eu | 2>/dev/null -eu ${HOME} | $(pwd) ${HOME}
+--verbose awk sed && awk then local test then -eu test cd awk
+${HOME} awk 'quoted text'
+		cd readonly /usr/bin 'quoted text'
+	grep | --verbose done && --verbose 'quoted text'
+	/usr/bin printf "$1" test -eu $(pwd)
+	--verbose $(pwd) 'quoted text' 'quoted text'
+	2>/dev/null x=1 ${HOME} && done test printf cd --verbose then 2>/dev/null -eu
+| cd local test printf /usr/bin grep awk test
+	cd then x=1 cd ${HOME}
+		${HOME} /usr/bin export $(pwd) 'quoted text' $(pwd) sed /usr/bin sed 2>/dev/null
+&& grep done && readonly $(pwd)
+--verbose test cd echo awk awk printf -eu awk local readonly done 'quoted text'
+sed ${HOME} echo awk 'quoted text'
+done | then 'quoted text' done -eu
+	-eu local ${HOME} x=1 2>/dev/null
+test $(pwd) --verbose "$@" done 2>/dev/null cd --verbose awk local && --verbose
+		2>/dev/null | $(pwd) ${HOME}
+	readonly echo local grep
+	done 'quoted text' cd then "$@" ${HOME} /usr/bin "$@" $(pwd) $(pwd) x=1 "$@" &&
+	| "$@" 2>/dev/null 2>/dev/null ${HOME} && x=1 printf "$@" grep
+		echo 'quoted text' 2>/dev/null
+printf 2>/dev/null /usr/bin ${HOME}
+	local ${HOME} cd -eu test "$1" sed printf export cd "$1" test printf readonly
+	--verbose echo 2>/dev/null cd --verbose 2>/dev/null
+	"$@" echo sed 'quoted text' | 2>/dev/null ${HOME}
+echo ${HOME} echo grep "$@" -eu grep awk 'quoted text' export then | echo awk
+readonly echo awk test sed cd test done "$1" 'quoted text'
+grep awk --verbose sed export --verbose readonly awk grep /usr/bin test
+done printf then awk /usr/bin sed ${HOME} awk 'quoted text' /usr/bin
+export sed then "$1" 2>/dev/null | | sed sed && cd --verbose sed export
+--verbose -eu 'quoted text' /usr/bin awk --verbose then -eu x=1 $(pwd)
+	export printf then done local awk
+then printf "$@" grep readonly awk && && 2>/dev/null
+		${HOME} then echo $(pwd) awk 2>/dev/null
+		echo then printf awk && 'quoted text' cd printf printf 'quoted text'
+		awk printf grep test done "$@" awk 2>/dev/null "$@"
+"$1" printf "$1" done cd /usr/bin readonly sed
+	local "$1" /usr/bin grep $(pwd) ${HOME} -eu export 'quoted text' local "$@" 2>/dev/null
+$(pwd) 2>/dev/null $(pwd)
+	&& cd printf grep $(pwd) "$@" $(pwd) grep 'quoted text' done --verbose
+--verbose echo 2>/dev/null | awk sed
+		-eu --verbose $(pwd) local export then readonly && done
+		export grep then --verbose
+	readonly ${HOME} export && grep
+sed readonly readonly x=1 /usr/bin local && done --verbose "$1" export local
+	-eu test echo -eu grep $(pwd) done 2>/dev/null /usr/bin export
+		"$@" awk grep grep cd then --verbose sed x=1 awk 'quoted text'
+"$1" x=1 printf test x=1 'quoted text' grep "$1" printf sed cd --verbose
+${HOME} grep awk local grep done
+	grep echo export awk -eu echo
+	-eu "$@" then /usr/bin echo printf grep x=1 2>/dev/null
+x=1 | sed awk x=1 -eu then ${HOME} $(pwd)
+		2>/dev/null local 'quoted text' "$1" --verbose sed done sed -eu
+	x=1 export /usr/bin 'quoted text'
+echo printf "$1" ${HOME} /usr/bin
+2>/dev/null --verbose && | 2>/dev/null then "$@"
+	cd test | 2>/dev/null x=1 'quoted text' readonly && "$1" ${HOME} ${HOME}
+		'quoted text' "$@" $(pwd) -eu awk sed done
+	${HOME} ${HOME} --verbose echo done /usr/bin
+	then cd /usr/bin "$@"
+		readonly export x=1 test /usr/bin cd test cd export 'quoted text'
+		'quoted text' 'quoted text' $(pwd) awk export export $(pwd)
+then && "$@" echo cd export 2>/dev/null
+$(pwd) awk /usr/bin x=1 cd "$@" test "$1" sed
+		cd cd $(pwd) printf printf ${HOME} awk readonly echo cd grep | 'quoted text' printf
+echo 2>/dev/null local sed done local
+"$1" "$@" grep -eu cd sed then 2>/dev/null | "$1" | --verbose /usr/bin | --verbose
+awk "$1" | | then && export /usr/bin readonly
+2>/dev/null then 'quoted text' local | | echo 2>/dev/null
+$(pwd) done echo -eu sed -eu "$@" ${HOME} test x=1 local
+${HOME} printf ${HOME} awk local | export -eu local $(pwd) x=1 export /usr/bin
+$(pwd) "$1" cd && grep x=1
+${HOME} readonly x=1 "$@" --verbose export test && 'quoted text'
+	printf export then 2>/dev/null
+2>/dev/null then -eu "$1" export x=1 ${HOME} $(pwd) test -eu grep --verbose 'quoted text'
+		readonly | $(pwd) done "$@" local echo
+	"$@" | "$@" | $(pwd) echo export export &&
+		"$@" echo local done "$@"
+	--verbose 2>/dev/null test grep sed local | sed 2>/dev/null
+		printf export echo sed echo test "$1" echo x=1 local 2>/dev/null | x=1 cd $(pwd)
+'quoted text' && -eu 2>/dev/null
+&& $(pwd) test /usr/bin export | x=1 -eu "$1" awk done && "$@" 'quoted text'
+		-eu then export /usr/bin x=1 2>/dev/null local printf
+	&& && x=1 "$1" x=1 test 2>/dev/null
+		printf x=1 "$1" $(pwd) "$@" export
+	echo test 'quoted text' ${HOME} &&
+"$@" echo export export sed 'quoted text' done ${HOME} 'quoted text' readonly
+	'quoted text' test printf | x=1 local export grep printf
+	awk cd printf /usr/bin x=1 local
+printf awk export ${HOME} cd test $(pwd) "$@"
+	2>/dev/null /usr/bin "$1" ${HOME} -eu echo printf "$@" cd printf ${HOME} echo
+		echo /usr/bin x=1 sed | 2>/dev/null x=1 'quoted text' 2>/dev/null "$@" 2>/dev/null
+x=1 /usr/bin done awk "$@" done test -eu 2>/dev/null
+		$(pwd) awk grep awk grep | printf 'quoted text' 'quoted text' 'quoted text'
+readonly x=1 /usr/bin ${HOME} readonly export 2>/dev/null sed 2>/dev/null
+		awk printf then | ${HOME} then $(pwd) then
+		export --verbose printf printf readonly test
+	$(pwd) awk sed export x=1 printf echo $(pwd) /usr/bin
+	/usr/bin $(pwd) done /usr/bin
+${HOME} then then ${HOME} | /usr/bin echo grep | x=1 grep 'quoted text' "$@"
+		${HOME} ${HOME} -eu 'quoted text' | local awk export
+		$(pwd) "$@" grep sed x=1 | "$1" x=1 x=1 ${HOME}
+		awk x=1 "$1" "$1" ${HOME} cd ${HOME} grep ${HOME} ${HOME} export
+		readonly test 2>/dev/null echo done --verbose "$1"
+	/usr/bin 2>/dev/null --verbose done done
+		local --verbose printf printf 2>/dev/null
+/usr/bin && awk ${HOME} done $(pwd) sed printf local
+	test && local $(pwd) grep cd sed done cd x=1 grep sed $(pwd) 2>/dev/null printf
+	$(pwd) x=1 awk x=1 cd done && x=1 "$1" | printf
+		then && export grep "$1" readonly readonly "$@" x=1 export 'quoted text' "$1"
+		--verbose && printf /usr/bin 'quoted text' --verbose ${HOME} | readonly
+	x=1 ${HOME} readonly --verbose -eu 2>/dev/null --verbose
+"$1" then && local /usr/bin "$@" done
+		awk 2>/dev/null grep test && cd 2>/dev/null then
+		--verbose 2>/dev/null && ${HOME} x=1 x=1 done export
+${HOME} --verbose && printf
+		"$1" export "$@" $(pwd) | local 2>/dev/null then test
+	x=1 ${HOME} 'quoted text' cd done ${HOME}
+| awk --verbose /usr/bin "$1" sed readonly ${HOME} awk "$@"
+&& grep 'quoted text' grep "$1" local local local cd awk printf
+	readonly 'quoted text' 2>/dev/null "$1" printf test cd x=1 -eu x=1 2>/dev/null
+awk "$@" cd | export then /usr/bin awk "$1" cd /usr/bin test then test --verbose
+		2>/dev/null done 2>/dev/null
+test "$@" then | /usr/bin /usr/bin then ${HOME} then awk "$1" cd cd $(pwd)
+echo | cd cd /usr/bin "$1" | sed printf export ${HOME} 'quoted text' 2>/dev/null
+	2>/dev/null "$@" test then 2>/dev/null
+		test --verbose -eu --verbose
+done awk readonly grep then 'quoted text' awk ${HOME}
+sed readonly 2>/dev/null done cd echo && printf local 2>/dev/null
+		echo done local x=1 then
+export local /usr/bin export && sed sed /usr/bin 2>/dev/null then
+		--verbose cd test awk test awk echo /usr/bin then ${HOME} test | cd | cd done
+grep export done then echo awk sed awk sed | sed "$1" "$1" /usr/bin
+		x=1 grep && readonly echo
+	grep echo cd 'quoted text' awk $(pwd) ${HOME} then x=1 ${HOME}
+	grep $(pwd) sed /usr/bin readonly 'quoted text' "$1"
+| echo 2>/dev/null sed local -eu local
+		grep grep | readonly local --verbose && echo done && echo sed && local
+	test 2>/dev/null -eu --verbose done then readonly readonly grep echo
+$(pwd) export "$@" sed done $(pwd) ${HOME} grep done readonly then && then awk
+		--verbose /usr/bin done export grep /usr/bin done -eu done printf | ${HOME} done
+	2>/dev/null echo "$1" | printf local 2>/dev/null
+local readonly 'quoted text' done awk export ${HOME} cd echo then printf grep test
+then test grep cd done local -eu test -eu done ${HOME} | readonly echo
+	${HOME} awk then --verbose 2>/dev/null grep cd /usr/bin
+		| sed 2>/dev/null $(pwd) readonly --verbose cd --verbose then
+		$(pwd) 2>/dev/null 2>/dev/null
+printf "$@" local cd then && echo "$1" "$@"
+		done awk "$1" /usr/bin
+		sed sed "$@" grep "$1" ${HOME} printf
+	&& cd x=1 | ${HOME} "$1" awk done ${HOME} awk export grep
+		test sed 2>/dev/null "$@" done ${HOME} echo --verbose /usr/bin sed cd
+"$1" printf echo then readonly "$@" readonly
+		readonly export $(pwd) 'quoted text' echo "$1" ${HOME} readonly cd --verbose
+&& sed --verbose -eu then 'quoted text'
+2>/dev/null echo "$1" export ${HOME} sed cd done grep x=1 echo "$@" local
+		$(pwd) done 2>/dev/null grep sed &&
+		/usr/bin cd cd -eu "$1" export cd cd cd $(pwd)
+		x=1 export sed cd -eu grep -eu test awk readonly x=1 done --verbose
+		'quoted text' $(pwd) && done then
+--verbose test | awk x=1 local
+	awk local 2>/dev/null export /usr/bin
+		2>/dev/null "$@" sed cd $(pwd) local
+		'quoted text' "$1" test && ${HOME} /usr/bin ${HOME} local export
+		grep | echo awk "$@" echo -eu -eu readonly --verbose 'quoted text' && echo
+	local printf then /usr/bin && 2>/dev/null
+	-eu sed export -eu then $(pwd) /usr/bin
+	2>/dev/null then "$1" && test $(pwd) --verbose done test sed
+$(pwd) --verbose && x=1 /usr/bin
+&& 'quoted text' 'quoted text' 2>/dev/null grep local done
+	$(pwd) test ${HOME} $(pwd) ${HOME} awk -eu readonly
+$(pwd) then cd awk export readonly printf
+		local awk 'quoted text' printf ${HOME} ${HOME} printf "$1" awk && 'quoted text'
+--verbose ${HOME} -eu printf
+$(pwd) printf -eu cd --verbose test 2>/dev/null echo --verbose grep
+$(pwd) readonly export export awk $(pwd) sed
+	readonly 2>/dev/null grep 2>/dev/null --verbose ${HOME} export
+	local --verbose then 2>/dev/null local x=1 export --verbose
+	-eu done done sed echo test sed grep x=1 $(pwd) /usr/bin test then | && x=1
+		| printf cd -eu -eu done /usr/bin && local "$@" "$@" 2>/dev/null grep ${HOME}
+	| then done 'quoted text'
+	then --verbose test | awk ${HOME} --verbose then test -eu test
+		| test awk && x=1 ${HOME}
+		readonly export grep "$1" 2>/dev/null | export $(pwd)
+	$(pwd) "$1" readonly && local $(pwd) grep then then awk && grep local
+		readonly local echo readonly printf "$@" grep 'quoted text' 2>/dev/null
+awk awk readonly grep && grep | /usr/bin 2>/dev/null "$@" test
+	'quoted text' $(pwd) 2>/dev/null local && | x=1 printf --verbose
+		${HOME} ${HOME} echo -eu echo x=1 readonly export local $(pwd)
+		${HOME} --verbose /usr/bin 2>/dev/null readonly grep ${HOME} awk grep test export
+	| cd awk 2>/dev/null x=1 sed readonly --verbose cd && echo echo "$@" printf
+echo "$1" 2>/dev/null printf 2>/dev/null
+		printf test | sed local | done && "$1" cd -eu /usr/bin
+		"$1" awk /usr/bin awk then then export -eu
+	"$@" ${HOME} export cd grep 'quoted text' x=1 local then grep
+		echo 'quoted text' ${HOME} "$1" /usr/bin
+	/usr/bin local x=1 && --verbose
+	$(pwd) echo && cd grep done cd && && | $(pwd) awk grep echo && 2>/dev/null
+	&& && "$1" local local printf
+test test echo export
+	2>/dev/null 'quoted text' then x=1 x=1
+	test 2>/dev/null /usr/bin cd ${HOME} "$@" ${HOME} done export export
+		"$@" --verbose x=1 grep test cd cd sed awk local then done local echo then
+		'quoted text' "$1" $(pwd) export local done local 'quoted text' | 'quoted text'
+		"$@" $(pwd) /usr/bin readonly done export
+	-eu /usr/bin -eu echo -eu echo "$1" 2>/dev/null "$@" /usr/bin
+	cd ${HOME} && echo sed sed x=1
+	awk printf readonly $(pwd) awk cd | then grep
+	$(pwd) "$1" cd /usr/bin ${HOME} 2>/dev/null done export
+		-eu 'quoted text' -eu local printf 2>/dev/null printf then "$1"
+	| echo then done --verbose /usr/bin export echo
+		| test cd then $(pwd) 'quoted text' sed echo awk &&
+		/usr/bin awk grep test
+	printf printf awk test grep sed
+	cd 'quoted text' 'quoted text' echo cd sed | grep
+	cd sed 'quoted text' "$@" sed /usr/bin cd printf readonly echo && readonly
+		--verbose /usr/bin export echo export | | $(pwd) "$@" cd local
+	readonly test then "$@"
+export /usr/bin test &&
+	-eu "$@" 'quoted text' "$1" ${HOME}
+	readonly test 'quoted text' then
+	$(pwd) 'quoted text' 2>/dev/null "$1" --verbose
+		&& grep | /usr/bin 'quoted text' awk test --verbose readonly awk "$1"
+-eu grep --verbose echo cd 'quoted text' test "$1" /usr/bin --verbose
+		printf grep local && $(pwd) ${HOME} cd && 'quoted text' | "$1"
+		cd /usr/bin test | x=1 --verbose done -eu sed /usr/bin $(pwd) done 'quoted text'
+echo test echo /usr/bin 2>/dev/null grep then printf test done --verbose
+readonly readonly | readonly | -eu readonly -eu echo grep 2>/dev/null
+local ${HOME} 2>/dev/null sed $(pwd) /usr/bin x=1 $(pwd) -eu
+		grep local echo 'quoted text' 'quoted text' grep cd awk "$1"
+		grep then echo printf local && export 2>/dev/null
+		then ${HOME} cd && --verbose 2>/dev/null "$1" then "$1" "$@" -eu 'quoted text'
+	printf $(pwd) 'quoted text' 'quoted text' -eu x=1 local sed test | ${HOME} 2>/dev/null
+	-eu local then readonly | "$1" echo | -eu -eu
+	echo then sed 'quoted text' readonly export test done /usr/bin -eu 2>/dev/null
+		-eu --verbose -eu "$@" cd awk readonly echo && --verbose test 2>/dev/null then "$@"
+	sed local test awk cd "$1" "$1"
+		echo x=1 then grep then -eu readonly --verbose grep cd grep
+		cd cd "$@" export printf $(pwd) "$@" export && $(pwd)
+	cd --verbose /usr/bin then
+		readonly awk ${HOME} 'quoted text'
+		cd printf 'quoted text' /usr/bin /usr/bin ${HOME} $(pwd) -eu
+export ${HOME} export ${HOME} | -eu test readonly /usr/bin echo x=1 grep ${HOME}
+	${HOME} export 'quoted text' readonly 'quoted text'
+awk readonly readonly "$@" --verbose
+	/usr/bin && grep export done then test sed awk local x=1 sed
+		echo export "$@" local /usr/bin
+"$@" ${HOME} cd cd 2>/dev/null x=1 sed awk done && 'quoted text' $(pwd)
+local awk grep && x=1 "$@" /usr/bin $(pwd) | printf readonly test "$@"
+done cd ${HOME} "$@" then grep ${HOME} "$1" done $(pwd) local
+done 'quoted text' awk local export echo x=1 grep
+		export 'quoted text' 2>/dev/null done x=1 printf $(pwd) ${HOME}
+	done local then echo
+/usr/bin 2>/dev/null "$@" 'quoted text' cd test ${HOME} export |
+echo awk readonly grep sed test "$@" printf sed local "$@" readonly
+'quoted text' then $(pwd) readonly "$1" "$1" -eu test test echo awk "$@"
+	test && readonly | x=1 printf grep
+		done | && && | /usr/bin && cd then | 2>/dev/null then && "$@" sed then local
+		cd 2>/dev/null && then --verbose grep | cd ${HOME} readonly -eu
+local cd grep grep 2>/dev/null | printf x=1 'quoted text'
+		export ${HOME} test | export grep
+| --verbose /usr/bin 2>/dev/null printf $(pwd) export
+	$(pwd) | 2>/dev/null echo echo sed test
+		awk -eu -eu then grep -eu x=1 test ${HOME} "$@" 'quoted text' test echo
+	readonly && -eu grep awk export ${HOME} then
+	cd /usr/bin grep ${HOME}
+		"$@" "$1" x=1 $(pwd) && | grep "$@"
+x=1 awk done 2>/dev/null --verbose "$@"
+		x=1 x=1 ${HOME} 2>/dev/null 'quoted text'
+		x=1 "$@" x=1 test | awk cd x=1 grep | grep
+local | local "$@" readonly $(pwd) done echo echo then sed then
+	2>/dev/null sed && printf /usr/bin
+test export && "$1" readonly 2>/dev/null
+	export local -eu export readonly
+grep $(pwd) 'quoted text' cd export local awk $(pwd) sed done local grep readonly
+		printf readonly 2>/dev/null
+		'quoted text' readonly "$@" printf echo printf /usr/bin &&
+	readonly grep echo /usr/bin x=1
+		grep ${HOME} $(pwd) --verbose | awk test cd done echo
+		sed --verbose /usr/bin && "$1" | x=1 x=1 /usr/bin $(pwd) | printf /usr/bin $(pwd)
+'quoted text' && then && /usr/bin "$1" "$1" x=1
+		/usr/bin | awk | grep 2>/dev/null x=1 "$@" 2>/dev/null "$@" echo 'quoted text'
+'quoted text' sed readonly "$@" done && then | $(pwd)
+		2>/dev/null /usr/bin awk then grep 'quoted text' "$@" cd && cd "$1"
+		x=1 2>/dev/null test awk echo | 'quoted text' | done "$1"
+readonly "$1" sed $(pwd) test /usr/bin "$@" awk readonly sed done
+"$1" export awk grep test
+		readonly /usr/bin && $(pwd) readonly test | "$1" local grep
+	printf 'quoted text' grep echo readonly && /usr/bin export "$@"
+		printf export /usr/bin "$1" 'quoted text' | done
+		'quoted text' printf "$@" grep sed -eu -eu awk 'quoted text'
+		cd ${HOME} $(pwd) 'quoted text' && test local
+		grep 'quoted text' export readonly sed ${HOME} "$1" echo test -eu
+	export sed | printf export done "$1" awk | done
+		--verbose && 'quoted text' then 2>/dev/null $(pwd) 'quoted text' test printf
+sed ${HOME} echo echo $(pwd) "$@" /usr/bin sed sed &&
+		printf 2>/dev/null x=1 'quoted text' done --verbose /usr/bin 'quoted text' test
+		/usr/bin export | "$1" done /usr/bin && --verbose echo ${HOME} $(pwd) --verbose
+grep --verbose x=1 export $(pwd) sed cd sed "$1" local done sed | $(pwd) local
+		"$1" grep done awk then echo x=1 --verbose done /usr/bin grep 'quoted text'
+export /usr/bin 'quoted text' done | readonly done echo && printf $(pwd)
+	&& readonly 2>/dev/null /usr/bin
+		grep --verbose 2>/dev/null sed $(pwd) --verbose 'quoted text' local echo
+then export $(pwd) awk "$@" "$1"
+	-eu "$1" readonly readonly "$1" -eu test
+local /usr/bin printf cd &&
+		sed awk --verbose /usr/bin -eu readonly 2>/dev/null readonly local grep done export
+printf ${HOME} awk 2>/dev/null "$1" "$1" awk 2>/dev/null
+readonly awk -eu $(pwd) 'quoted text'
+	sed | test /usr/bin echo readonly 'quoted text'
+		| export "$@" && sed -eu
+sed export grep test readonly sed grep then
+	-eu 'quoted text' 2>/dev/null export
+		--verbose x=1 readonly
+	| -eu done 2>/dev/null --verbose
+test 'quoted text' local grep | 'quoted text' export readonly echo done
+	-eu sed | awk printf done sed grep "$1" -eu ${HOME} echo /usr/bin then --verbose
+	grep x=1 | cd printf -eu printf
+		2>/dev/null ${HOME} "$@"
+	-eu $(pwd) --verbose local then $(pwd) done
+		readonly done 'quoted text' && --verbose -eu 'quoted text' sed /usr/bin
+	-eu cd ${HOME} sed printf then then | --verbose ${HOME} $(pwd) readonly "$@"
+		-eu export 'quoted text'
+	grep 2>/dev/null export grep "$@" echo test && done
+export "$1" then export then --verbose printf cd grep | export then x=1 ${HOME}
+	local "$1" "$@" /usr/bin $(pwd) ${HOME} 'quoted text'
+x=1 $(pwd) done --verbose grep /usr/bin && sed "$@" &&
+local then "$1" 2>/dev/null && 'quoted text' then export $(pwd)
+		2>/dev/null "$1" awk echo cd export
+	cd "$@" local test /usr/bin local | printf export /usr/bin readonly grep test
+	cd export && | ${HOME} -eu -eu /usr/bin local
+		cd cd awk local "$1" 'quoted text' then then 'quoted text'
+		"$@" grep then /usr/bin
+awk "$@" x=1 export /usr/bin
+	| $(pwd) "$@" --verbose sed export readonly
+then readonly $(pwd) then awk /usr/bin /usr/bin awk
+		2>/dev/null echo $(pwd) cd readonly sed x=1
+local export done x=1 then "$@" export echo then cd
+		then -eu done sed 'quoted text' $(pwd) ${HOME} | sed
+		"$1" "$@" grep 'quoted text' awk
+		--verbose export local printf --verbose
+	test local sed grep done -eu cd sed
+cd 2>/dev/null done echo local "$@"
+		--verbose test | "$1" sed local --verbose echo 2>/dev/null
+		-eu ${HOME} echo 2>/dev/null cd local printf export printf | cd
+	${HOME} then ${HOME} ${HOME} x=1 cd && 2>/dev/null
+cd $(pwd) export cd ${HOME} awk echo echo grep | 'quoted text' awk echo
+${HOME} export && -eu "$@" 'quoted text'
+	'quoted text' ${HOME} "$1" printf printf 'quoted text'
+		-eu && /usr/bin -eu grep -eu 2>/dev/null "$1" ${HOME} 2>/dev/null $(pwd)
+		${HOME} echo -eu && then "$@" "$@" 2>/dev/null sed cd 'quoted text' &&
+		x=1 awk ${HOME} printf grep && then
+		"$1" readonly && export 2>/dev/null 2>/dev/null
+		cd export "$1" test done readonly export | awk x=1 --verbose
+		2>/dev/null ${HOME} --verbose -eu
+		export test echo --verbose
+		&& 2>/dev/null --verbose then
+		-eu /usr/bin readonly export -eu sed 'quoted text' echo "$1" then readonly "$1"
+	then local 2>/dev/null printf
+x=1 /usr/bin awk /usr/bin | 'quoted text' /usr/bin
+grep echo export echo -eu printf echo sed sed done -eu --verbose &&
+&& then then && "$1" "$@" -eu sed $(pwd) | $(pwd) done
+'quoted text' echo readonly awk export awk -eu local && then $(pwd)
+local ${HOME} then export printf echo done test test test
+		sed local then grep then readonly printf x=1 export -eu && && ${HOME}
+	awk done awk awk done 'quoted text' 'quoted text'
+	| --verbose 2>/dev/null awk
+	readonly $(pwd) awk | done then && x=1 grep /usr/bin
+"$@" test x=1 readonly local 2>/dev/null 'quoted text' -eu 'quoted text'
+export "$1" readonly --verbose
+"$1" readonly test grep done awk "$@" 'quoted text'
+then && echo local test readonly "$@" && awk test echo local grep test awk "$@"
+	test 'quoted text' x=1 "$@" --verbose /usr/bin "$@" local done
+	x=1 awk readonly 2>/dev/null grep printf --verbose awk
+	| local export --verbose "$1" && readonly then 2>/dev/null local printf awk
+/usr/bin | "$@" grep local printf x=1 -eu 'quoted text' sed "$@" export local
+		--verbose done echo done test 2>/dev/null 2>/dev/null | done grep x=1 $(pwd) echo
+		${HOME} grep --verbose grep x=1 local "$1" --verbose readonly
+		echo cd "$1" printf readonly printf local x=1 | && local -eu x=1
+		cd $(pwd) ${HOME} 2>/dev/null
+	awk --verbose 'quoted text'
+		$(pwd) "$@" /usr/bin "$1" done "$1" -eu "$1"
+sed echo printf test 2>/dev/null 'quoted text'
+"$1" cd "$1" "$1" $(pwd) && ${HOME} 'quoted text' awk
+2>/dev/null printf 2>/dev/null $(pwd) printf
+	"$1" && $(pwd) "$@" -eu "$@" -eu done sed sed local 'quoted text' ${HOME} "$1"
+		'quoted text' ${HOME} 2>/dev/null 2>/dev/null x=1 awk x=1 /usr/bin --verbose
+		printf local sed local 2>/dev/null then
+	local | grep $(pwd) then local grep && done done /usr/bin printf
+		done $(pwd) then -eu awk | && "$@" export | 2>/dev/null
+	-eu test $(pwd) --verbose 2>/dev/null /usr/bin
+	local cd readonly sed /usr/bin test x=1 printf export
+grep done cd "$@" awk 'quoted text' && 2>/dev/null
+	printf done && "$1" /usr/bin grep /usr/bin readonly
+"$@" --verbose && export 2>/dev/null awk "$1"
+	awk echo grep -eu test ${HOME} then
+		$(pwd) | cd "$1" "$1" /usr/bin readonly test x=1 sed -eu --verbose $(pwd)
+		"$1" echo x=1 grep | && cd echo "$@" grep
+	test "$@" echo /usr/bin ${HOME} local
+export cd $(pwd) 'quoted text' done "$1" "$1" printf awk
+	readonly done "$@" awk 'quoted text'
+	--verbose /usr/bin 'quoted text' test readonly
+	test 'quoted text' local | done printf done /usr/bin test 2>/dev/null $(pwd)
+		'quoted text' sed export grep
+	--verbose done "$1" then /usr/bin done "$@" grep export | readonly
+		test 'quoted text' sed x=1 done "$@" 'quoted text' readonly export readonly
+	awk sed readonly -eu && --verbose 'quoted text' export $(pwd) /usr/bin echo
+		| -eu cd awk local sed cd sed
+	sed printf grep done readonly done cd /usr/bin
+awk x=1 then sed local then grep
+		sed -eu 2>/dev/null local | 'quoted text' /usr/bin printf
+		local 2>/dev/null && | && local ${HOME}
+	2>/dev/null grep echo cd sed /usr/bin cd cd /usr/bin grep test cd awk "$1" /usr/bin
+grep test local -eu -eu 2>/dev/null then 'quoted text' "$1"
+	2>/dev/null | --verbose ${HOME} then done test ${HOME} /usr/bin 'quoted text' 'quoted text'
+		test echo grep grep awk | then --verbose
+	then -eu "$1" $(pwd) grep export echo local readonly local x=1 && printf
+		printf then 2>/dev/null | export && echo --verbose
+		"$@" cd done $(pwd) sed then printf awk echo 2>/dev/null sed 'quoted text'
+		${HOME} awk cd cd 'quoted text' test cd grep sed /usr/bin
+awk /usr/bin 'quoted text' 2>/dev/null && test | cd "$1" test local echo
+		cd readonly --verbose "$1" local -eu sed
+cd "$@" then --verbose grep export ${HOME} local
+		test echo | export $(pwd)
+	${HOME} 'quoted text' "$@" echo cd echo test test echo ${HOME} local cd --verbose
+x=1 ${HOME} 2>/dev/null export test export --verbose
+		'quoted text' cd grep cd $(pwd) export && readonly | | -eu awk printf ${HOME}
+	--verbose 'quoted text' done grep then done done printf --verbose
+		"$1" then grep && /usr/bin
+	| readonly --verbose echo readonly sed && && sed --verbose local test
+	'quoted text' 'quoted text' then -eu grep readonly export
+	readonly "$@" cd local $(pwd) awk $(pwd) awk then echo test readonly |
+--verbose printf -eu grep readonly
+export cd $(pwd) local "$1" /usr/bin done 'quoted text' export -eu &&
+	-eu "$@" ${HOME} "$@" awk && readonly x=1 awk 'quoted text'
+		-eu readonly grep | echo readonly
+		&& sed "$@" 'quoted text' "$@" --verbose echo printf x=1 $(pwd) 2>/dev/null
+"$@" readonly $(pwd) echo
+	echo $(pwd) cd -eu "$1" local && readonly ${HOME}
+local /usr/bin export $(pwd) done export done readonly 2>/dev/null
+		echo x=1 readonly | done | --verbose
+		--verbose test 'quoted text' $(pwd) export "$1" | echo "$@" awk
+grep grep printf grep -eu local x=1
+		x=1 awk "$@" local cd && sed 'quoted text' && $(pwd) done then echo export
+		2>/dev/null test -eu --verbose awk "$1" readonly test local "$1" local
+		$(pwd) $(pwd) readonly -eu /usr/bin local sed --verbose 'quoted text' awk 'quoted text'
+	2>/dev/null x=1 | echo readonly
+		$(pwd) grep test --verbose 2>/dev/null 2>/dev/null printf -eu readonly grep grep
+printf cd 2>/dev/null | export readonly
+		'quoted text' printf x=1 2>/dev/null then test done then cd /usr/bin
+"$@" $(pwd) x=1 -eu ${HOME} "$@" "$1" -eu cd echo readonly --verbose &&
+	| awk $(pwd) sed echo export "$@" -eu sed ${HOME} printf
+	x=1 sed sed local readonly | sed echo |
+	&& ${HOME} awk test "$1" 'quoted text' /usr/bin grep 2>/dev/null
+--verbose /usr/bin then then $(pwd) -eu cd echo ${HOME} 'quoted text'
+	done grep && printf cd
+	readonly export "$@" --verbose
+		readonly -eu sed done x=1 local 'quoted text' /usr/bin && --verbose
+		printf grep $(pwd) export printf x=1 cd local && $(pwd)
+		"$1" -eu grep test "$1" cd "$1" /usr/bin --verbose awk cd done printf |
+sed 'quoted text' awk echo
+	local ${HOME} then "$@" /usr/bin echo then
+		local x=1 2>/dev/null grep ${HOME}
+${HOME} sed /usr/bin echo /usr/bin
+		printf && test x=1 test && /usr/bin
+		awk -eu echo cd /usr/bin
+${HOME} && sed x=1 then sed && --verbose
+		-eu readonly -eu done then
+printf -eu test local awk
+x=1 x=1 printf x=1 x=1 --verbose --verbose 'quoted text' echo
+readonly "$1" 'quoted text' ${HOME} export 'quoted text' awk
+	sed printf ${HOME} | 2>/dev/null awk done then readonly
+		then "$1" && sed ${HOME} "$1" grep -eu 'quoted text'
+echo 'quoted text' sed readonly x=1 readonly "$@" sed 2>/dev/null
+	/usr/bin printf "$1" 'quoted text' ${HOME} grep readonly
+	-eu local && "$1" sed x=1 2>/dev/null -eu then ${HOME} && grep
+		grep printf test export test
+		"$1" ${HOME} x=1 printf readonly /usr/bin cd --verbose printf /usr/bin 'quoted text'
+		${HOME} cd printf printf grep --verbose cd 'quoted text' done
+	2>/dev/null /usr/bin export readonly $(pwd) local
+	| readonly grep "$@" readonly "$@" | test echo --verbose
+${HOME} awk cd /usr/bin x=1 printf test "$1" grep && done $(pwd) local export done
+		${HOME} grep -eu export --verbose awk
+	"$1" ${HOME} grep 'quoted text' "$@" then
+		cd 2>/dev/null echo export cd
+		--verbose awk 'quoted text' 2>/dev/null done local | x=1 'quoted text' echo grep
+		--verbose echo ${HOME} 'quoted text' local
+	2>/dev/null readonly x=1 echo 2>/dev/null ${HOME}
+$(pwd) echo -eu echo echo && done local
+	sed $(pwd) grep && cd "$@" --verbose -eu export x=1 && /usr/bin
+awk && test --verbose -eu awk printf
+then 2>/dev/null grep | "$@" -eu "$1" cd x=1 | --verbose
+		| export 'quoted text' grep echo ${HOME} test 'quoted text'
+cd test done && cd --verbose && "$1"
+		test 2>/dev/null | "$@" cd ${HOME} $(pwd) sed done
+	'quoted text' "$@" done printf grep && done && readonly printf
+	"$1" | "$1" $(pwd) $(pwd) grep x=1
+readonly done awk printf -eu 'quoted text'
+2>/dev/null -eu /usr/bin && echo -eu --verbose "$1" "$@" $(pwd) local
+'quoted text' 2>/dev/null /usr/bin 'quoted text' local cd "$@" cd then grep 2>/dev/null
+&& sed test && sed export sed echo then x=1 $(pwd) then cd local
+	printf then --verbose readonly awk readonly | test
+	readonly local $(pwd) && ${HOME} | $(pwd) local awk test 'quoted text'
+		"$@" readonly readonly -eu export $(pwd) test grep "$1" && 'quoted text'
+	$(pwd) cd readonly x=1
+	sed done 2>/dev/null export x=1 sed printf 'quoted text'
+		sed --verbose ${HOME} sed 'quoted text'
+	echo "$@" grep /usr/bin printf grep "$@" "$1" echo x=1 -eu
+	${HOME} local 'quoted text' "$1" export /usr/bin "$1" ${HOME} done x=1 awk
+${HOME} grep x=1 test grep export done 2>/dev/null then 'quoted text' |
+local export 'quoted text' | cd cd test 'quoted text' sed ${HOME} x=1 | grep
+		readonly 'quoted text' awk sed printf /usr/bin 2>/dev/null "$@" awk export cd
+/usr/bin awk ${HOME} $(pwd) -eu -eu ${HOME} --verbose readonly grep "$@"
+2>/dev/null awk 'quoted text' then && --verbose
+$(pwd) --verbose sed ${HOME} /usr/bin sed grep /usr/bin grep && 'quoted text'
+		printf readonly ${HOME} grep
+	test && sed cd echo cd -eu 2>/dev/null
+	done ${HOME} 2>/dev/null test 2>/dev/null
+		x=1 printf 2>/dev/null 2>/dev/null x=1 --verbose | "$@"
+$(pwd) "$@" printf "$@" && done x=1 test printf | readonly 'quoted text' -eu local
+	$(pwd) "$@" $(pwd) test then x=1 $(pwd) cd && export grep
+	/usr/bin local /usr/bin echo ${HOME} cd 2>/dev/null --verbose
+/usr/bin sed -eu "$1" 2>/dev/null cd export echo grep then x=1 x=1 cd cd
+readonly $(pwd) printf /usr/bin ${HOME} local "$@" cd /usr/bin --verbose
+		grep "$1" | $(pwd) cd awk awk then /usr/bin
+		"$@" local $(pwd) x=1 local /usr/bin "$1" 'quoted text'
+readonly awk grep 'quoted text' sed 'quoted text' x=1 cd -eu awk readonly
+x=1 --verbose && then cd ${HOME} --verbose --verbose echo
+		'quoted text' sed export printf "$1" readonly ${HOME} printf && echo readonly
+		echo | 2>/dev/null --verbose done 'quoted text' done printf
+		x=1 | local 'quoted text'
+	awk readonly 2>/dev/null sed --verbose echo awk
+	readonly -eu -eu awk 'quoted text'
+2>/dev/null /usr/bin readonly cd test "$1" test
+	--verbose x=1 "$1" echo grep cd --verbose awk
+		x=1 ${HOME} printf x=1 then && 2>/dev/null /usr/bin test /usr/bin "$1" "$@" echo
+	/usr/bin 2>/dev/null "$1" x=1 awk /usr/bin
+	"$@" /usr/bin printf echo 'quoted text'
+		cd "$1" then done sed echo
+$(pwd) $(pwd) && awk "$@" 'quoted text' awk | done "$@" | && echo
+sed done "$1" /usr/bin test
+		test then 2>/dev/null --verbose
+x=1 "$@" /usr/bin --verbose then $(pwd) -eu echo
+		sed export then ${HOME} | readonly 'quoted text'
+		done test $(pwd) export |
+		${HOME} | echo export && printf export sed readonly echo
+	/usr/bin --verbose 'quoted text'
+	'quoted text' cd printf echo grep test | --verbose -eu test /usr/bin
+readonly x=1 test 2>/dev/null export && --verbose done
+readonly "$1" --verbose /usr/bin then cd
+	'quoted text' done grep echo "$1" x=1 -eu cd export
+		done then sed cd /usr/bin echo 2>/dev/null
+	export 2>/dev/null export /usr/bin sed
+		grep export grep -eu printf
+"$1" $(pwd) $(pwd) awk 'quoted text' sed && export
+readonly test readonly &&
+		-eu "$@" export -eu grep $(pwd) local export 2>/dev/null --verbose -eu "$@" done
+		export -eu export local done printf local --verbose grep
+	then local x=1 -eu | --verbose cd --verbose readonly awk test export
+"$1" sed "$@" cd test ${HOME} ${HOME}
+sed local "$1" export "$1" "$1" then "$@" printf
+export test echo $(pwd) cd --verbose printf && test printf local
+	export x=1 test done /usr/bin 'quoted text' /usr/bin 'quoted text'
+	echo ${HOME} -eu readonly -eu -eu sed /usr/bin /usr/bin awk grep "$1"
+	cd grep "$1" 'quoted text'
+		printf ${HOME} $(pwd) awk x=1 --verbose
+		-eu sed | 'quoted text' cd "$1"
+export test $(pwd) sed export "$1" $(pwd) --verbose export
+		$(pwd) && awk awk 2>/dev/null test "$1" export
+/usr/bin printf test test grep x=1 echo export 'quoted text' -eu
+		local echo /usr/bin "$1" ${HOME} x=1 test "$@" 2>/dev/null
+grep 'quoted text' printf readonly
+done | export local -eu && "$1"
+awk awk --verbose "$1" done printf "$1" test && /usr/bin /usr/bin
+	-eu --verbose awk $(pwd) &&
+		export /usr/bin 2>/dev/null test readonly --verbose printf "$1" awk done sed echo
+		${HOME} x=1 sed test --verbose printf ${HOME}
+		cd | then "$1" readonly "$1"
+		"$1" printf ${HOME} ${HOME} local /usr/bin ${HOME}
+${HOME} done grep printf cd export echo $(pwd) local grep
+		export grep echo /usr/bin then cd "$1" then
+		cd cd /usr/bin readonly /usr/bin printf
+	'quoted text' "$1" /usr/bin echo test printf
+	'quoted text' "$1" export
+readonly local test && "$1" done && cd /usr/bin export
+		local x=1 2>/dev/null 'quoted text'
+	readonly sed export 'quoted text' $(pwd) cd 'quoted text' then
+	cd && -eu $(pwd) /usr/bin cd ${HOME} printf "$1" readonly
+&& $(pwd) printf | echo x=1 local | 'quoted text' 2>/dev/null "$1" && $(pwd)
+$(pwd) readonly grep /usr/bin
+grep awk export "$@" 'quoted text' echo --verbose $(pwd) test readonly
+		echo "$@" $(pwd) 2>/dev/null
+grep $(pwd) --verbose 2>/dev/null sed x=1 done awk
+	"$@" then ${HOME} $(pwd) x=1
+${HOME} x=1 -eu $(pwd) local test "$1" x=1 printf sed --verbose "$1" export echo
+printf 'quoted text' awk 2>/dev/null
+		'quoted text' --verbose sed ${HOME} awk | x=1 | --verbose then x=1 cd
+		/usr/bin "$1" grep 2>/dev/null
+		test printf printf done "$@" $(pwd) printf export 'quoted text'
+	test then export && $(pwd) export | 'quoted text' | readonly
+	| echo then /usr/bin | local | done printf export x=1 x=1 printf
+	2>/dev/null | echo /usr/bin export cd 'quoted text' $(pwd)
+	2>/dev/null local && 'quoted text' done $(pwd) | readonly
+then && $(pwd) "$1" cd && x=1 $(pwd) local then -eu | -eu
+	echo ${HOME} /usr/bin printf | local done test | test cd printf 2>/dev/null -eu
+	&& /usr/bin echo echo "$@" /usr/bin readonly local done done
+		'quoted text' $(pwd) done "$@" test readonly --verbose
+awk export /usr/bin "$@" local
+		export test test awk echo $(pwd)
+	local 2>/dev/null cd export then "$@" sed "$@"
+	"$1" then sed cd test grep ${HOME} && export | --verbose
+	grep cd cd 2>/dev/null done "$@" /usr/bin awk local /usr/bin && x=1
+	-eu test "$1" test sed --verbose $(pwd)
+$(pwd) /usr/bin awk 'quoted text' local test -eu local
+echo readonly --verbose 'quoted text' sed done then /usr/bin 2>/dev/null
+	printf && readonly export "$1" -eu grep test
+	done $(pwd) --verbose readonly $(pwd) $(pwd) readonly /usr/bin export $(pwd)
+		"$1" 'quoted text' sed && cd printf -eu && test /usr/bin
+		grep done test done "$@" printf
+	x=1 export then $(pwd) done "$1" printf 'quoted text' -eu
+x=1 local readonly --verbose "$@" readonly x=1 export "$@" done cd awk $(pwd) x=1
+"$@" --verbose printf local "$@" 'quoted text' printf |
+		'quoted text' x=1 readonly /usr/bin done awk
+		local && local readonly printf done test local test -eu echo -eu
+printf /usr/bin 2>/dev/null export /usr/bin export echo
+	'quoted text' grep $(pwd) export cd 'quoted text'
+	&& local $(pwd) cd test done "$1" cd | --verbose cd $(pwd) done sed
+$(pwd) cd --verbose 2>/dev/null 'quoted text' grep
+	printf x=1 | --verbose $(pwd) "$@" $(pwd)
+x=1 'quoted text' awk echo "$1" /usr/bin && sed | cd 2>/dev/null local "$1"
+	"$1" /usr/bin "$@" 2>/dev/null 'quoted text'
+		${HOME} export x=1 printf "$1" 2>/dev/null x=1 export cd sed printf | && grep
+		x=1 | 'quoted text' echo | 'quoted text'
+$(pwd) local done -eu printf ${HOME}
+	echo 2>/dev/null grep 'quoted text' /usr/bin -eu local
+		${HOME} "$1" "$@" && then echo
+		readonly sed && done ${HOME} then test grep --verbose awk export "$@"
+		grep done $(pwd) --verbose | local $(pwd) /usr/bin
+cd local --verbose printf export $(pwd) readonly
+local && sed && echo && local sed grep "$1" readonly 'quoted text' printf cd
+| /usr/bin sed echo "$1" "$@" -eu /usr/bin echo readonly
+&& done sed done echo sed /usr/bin local grep
+		cd sed then 2>/dev/null 'quoted text' "$@" $(pwd) export /usr/bin local awk
+	${HOME} then then printf
+	&& "$1" then -eu printf readonly
+		printf then -eu x=1 grep ${HOME} "$@" 2>/dev/null |
+	test --verbose grep printf 'quoted text'
+	x=1 readonly /usr/bin export awk && test $(pwd) grep readonly
+	${HOME} echo "$1" sed "$@" --verbose $(pwd) then
+	x=1 test readonly readonly readonly awk then "$1" /usr/bin | --verbose --verbose
+	local x=1 local local grep export
+		echo "$1" /usr/bin sed cd done && 2>/dev/null
+	/usr/bin echo "$1" test test x=1 readonly --verbose export | 2>/dev/null /usr/bin
+	test -eu ${HOME} x=1 "$1" 2>/dev/null readonly x=1
+	--verbose sed $(pwd) test export local done x=1
+	| -eu export x=1 awk cd ${HOME} printf
+	$(pwd) grep awk 2>/dev/null done 2>/dev/null 2>/dev/null
+&& readonly awk then ${HOME}
+		local sed test -eu export | then --verbose awk 'quoted text' "$@"
+	done | echo cd local -eu awk --verbose /usr/bin 'quoted text' cd done
+		/usr/bin awk "$1" local
+then | --verbose $(pwd) --verbose
+	readonly $(pwd) && echo grep cd 2>/dev/null then
+-eu 2>/dev/null --verbose awk local && sed $(pwd) | sed && -eu
+	printf echo test then && $(pwd) awk "$1" echo | cd --verbose
+	done sed local then readonly awk | --verbose
+		printf x=1 -eu printf echo "$@" x=1 $(pwd) local
+		"$@" /usr/bin && export grep /usr/bin 2>/dev/null "$1" $(pwd)
+		test echo local then "$@" grep grep printf 2>/dev/null "$1" x=1 x=1 export readonly
+'quoted text' echo $(pwd) printf | $(pwd)
+		then $(pwd) done test "$1" && readonly then then awk $(pwd) readonly 'quoted text'
+| done --verbose then ${HOME} 2>/dev/null done "$1" -eu grep
+	&& | grep printf local ${HOME} /usr/bin
+		awk grep export /usr/bin "$@" 'quoted text' local export grep
+	local echo x=1 --verbose then 2>/dev/null test then --verbose sed
+then test echo x=1 readonly 'quoted text' 2>/dev/null awk /usr/bin done
+	then readonly grep then then x=1 sed local && && sed cd local
+	then $(pwd) test $(pwd) ${HOME}
+		done test awk -eu done $(pwd) --verbose printf awk echo $(pwd)
+		-eu 'quoted text' then echo $(pwd) $(pwd) echo printf /usr/bin export
+	--verbose grep done echo sed $(pwd)
+export 'quoted text' printf ${HOME} x=1 $(pwd) cd export
+	/usr/bin ${HOME} 2>/dev/null /usr/bin x=1 | sed --verbose export -eu
+		--verbose 'quoted text' test awk 2>/dev/null printf awk readonly
+		grep test sed cd printf "$1" then -eu | echo x=1 ${HOME}
+	awk 2>/dev/null | 'quoted text' -eu echo -eu &&
+	&& /usr/bin local sed then cd export -eu "$@" sed -eu "$1" /usr/bin
+	'quoted text' 2>/dev/null -eu sed
+		then 2>/dev/null export -eu printf
+	2>/dev/null "$@" test then 2>/dev/null
+	sed readonly then readonly export done x=1 export "$1" x=1 awk --verbose $(pwd)
+${HOME} -eu 'quoted text' -eu --verbose --verbose
+	readonly ${HOME} done "$1" 'quoted text' then local readonly
+		-eu printf -eu $(pwd) test done /usr/bin done readonly --verbose "$@"
+		'quoted text' readonly then
+'quoted text' readonly 2>/dev/null x=1 local ${HOME}
+	readonly 2>/dev/null 'quoted text' cd echo ${HOME} echo done
+		sed cd && 'quoted text' test 'quoted text' ${HOME} $(pwd)
+	grep readonly x=1 ${HOME} 'quoted text' echo test --verbose
+	export /usr/bin --verbose && 'quoted text' /usr/bin $(pwd) /usr/bin
+	| | sed local test export
+printf printf export "$@" export 'quoted text' | | printf
+awk grep $(pwd) "$@" readonly awk echo
+	--verbose -eu readonly printf ${HOME} sed done "$@" && awk then | 'quoted text'
+then done done echo x=1 grep done
+	2>/dev/null done --verbose printf awk && awk printf --verbose "$1" --verbose
+printf /usr/bin test "$@" printf export "$@"
+echo local readonly export --verbose x=1
+		echo /usr/bin -eu "$@" awk
+		/usr/bin cd /usr/bin x=1 "$@" test 'quoted text' then
+	/usr/bin local ${HOME} then ${HOME} echo then cd 'quoted text'
+	grep test printf cd readonly cd then /usr/bin --verbose --verbose
+		local "$@" grep -eu cd awk test $(pwd) printf awk test export test test "$@" export
+	awk done && /usr/bin -eu x=1 echo echo local | | --verbose
+	done echo x=1 "$1" x=1 export -eu
+		/usr/bin 2>/dev/null "$@" /usr/bin | done printf $(pwd) awk 2>/dev/null cd $(pwd)
+	grep then readonly sed test grep echo --verbose cd $(pwd)
+	sed then && ${HOME} test
+	&& x=1 x=1 cd "$@" readonly x=1 2>/dev/null
+	"$@" local test --verbose
+grep readonly x=1 local awk local && done printf echo ${HOME} --verbose local
+		&& sed 2>/dev/null && /usr/bin then export x=1 2>/dev/null printf printf
+	-eu echo /usr/bin -eu $(pwd) /usr/bin export -eu 'quoted text'
+		cd x=1 'quoted text' local test
+	test && "$@" sed && "$1" echo 'quoted text'
+		then /usr/bin 2>/dev/null cd && $(pwd) x=1 printf "$@" --verbose ${HOME} $(pwd)
+		$(pwd) local "$1" done && cd 2>/dev/null
+printf cd test readonly local then | test /usr/bin echo printf /usr/bin
+		echo sed sed export /usr/bin readonly "$@" export $(pwd) grep awk echo local "$@"
+| done echo printf grep x=1 -eu /usr/bin 'quoted text' && test ${HOME}
+		cd test 2>/dev/null 'quoted text' "$1" && then && 'quoted text'
+		&& readonly local awk "$@" $(pwd) then -eu 'quoted text' /usr/bin test
+x=1 && sed ${HOME} "$1" readonly local "$@" ${HOME} sed echo x=1 printf
+local local cd export && local | sed ${HOME} "$@" x=1 "$@" test export
+	2>/dev/null done local 2>/dev/null $(pwd) cd
+| cd echo /usr/bin test --verbose grep awk cd cd local
+		echo done -eu grep done ${HOME}
+		x=1 ${HOME} local 'quoted text' "$1" then local "$1" "$1" then $(pwd) export
+	echo cd 2>/dev/null $(pwd) /usr/bin export "$1" "$@" x=1 grep
+sed $(pwd) cd done ${HOME}
+	$(pwd) readonly 'quoted text'
+		cd awk printf 2>/dev/null export printf sed echo "$@" && "$1" && cd $(pwd)
+	cd --verbose done grep $(pwd)
+	done /usr/bin 'quoted text' 2>/dev/null sed cd /usr/bin local
+"$1" $(pwd) --verbose awk then readonly
+	grep 'quoted text' | ${HOME} readonly grep $(pwd) ${HOME} grep "$1"
+		&& grep --verbose test && done "$1" && --verbose cd
+grep echo test then sed echo "$1" export "$1" "$1"
+local -eu test ${HOME} done export x=1 "$1" printf ${HOME} sed readonly 'quoted text'
+	readonly | "$1" echo 'quoted text' then awk printf grep /usr/bin test
+		local /usr/bin printf "$1" echo ${HOME} grep grep test /usr/bin x=1 echo export
+-eu local ${HOME} readonly ${HOME}
+printf sed /usr/bin echo readonly then "$1" sed x=1 done ${HOME} $(pwd) $(pwd)
+		2>/dev/null test $(pwd) && 2>/dev/null
+		${HOME} "$1" x=1 export -eu $(pwd) done x=1 "$1"
+#include c152.sh
+	x=1 sed ${HOME} 2>/dev/null x=1 export awk -eu sed "$1" echo
+	"$@" --verbose /usr/bin then then echo done local sed
+	sed printf sed 2>/dev/null --verbose done /usr/bin
+	| x=1 cd ${HOME} cd "$1" cd printf local "$@"
+"$1" -eu sed ${HOME} grep x=1 printf && cd 2>/dev/null readonly
+		| | $(pwd) cd | awk sed cd export readonly --verbose
+		local 'quoted text' test && export $(pwd) && cd -eu test
+	grep --verbose /usr/bin readonly 'quoted text' --verbose $(pwd)
+	export x=1 done --verbose then 'quoted text' | awk &&
+	$(pwd) test then --verbose ${HOME} grep && ${HOME}
+		x=1 /usr/bin -eu readonly 2>/dev/null --verbose printf "$@" ${HOME}
+"$@" awk awk printf | | /usr/bin
+	"$@" local local awk test /usr/bin grep local 'quoted text'
+${HOME} $(pwd) | echo $(pwd) -eu echo
+awk grep | $(pwd) 'quoted text' -eu export -eu $(pwd) echo ${HOME} "$@" --verbose
+		export printf ${HOME} then 2>/dev/null test readonly readonly -eu
+		awk local $(pwd) local 'quoted text' --verbose ${HOME} x=1 'quoted text'
+	${HOME} | sed echo --verbose
+		--verbose 'quoted text' -eu 'quoted text' local done x=1 x=1
+	export /usr/bin done | then cd then local cd export
+--verbose 2>/dev/null 'quoted text' && | 'quoted text'
+	'quoted text' export 2>/dev/null "$1"
+		then export /usr/bin && export printf readonly then /usr/bin then && grep export
+	${HOME} ${HOME} echo readonly ${HOME} readonly export --verbose "$1" test $(pwd)
+	x=1 local readonly 2>/dev/null awk "$@" "$@" printf
+		readonly local grep 'quoted text'
+		readonly export -eu then echo /usr/bin echo
+export ${HOME} "$@" "$1" --verbose test ${HOME} "$1" done awk test
+"$1" awk done | sed "$1" printf
+$(pwd) test test && grep then $(pwd) then -eu done -eu -eu
+		/usr/bin done ${HOME} done $(pwd) echo export /usr/bin then 'quoted text'
+--verbose $(pwd) local sed --verbose awk test ${HOME} | -eu done then cd
+done grep ${HOME} awk "$@" "$@" readonly
+	then test x=1 2>/dev/null done then /usr/bin printf x=1
+		| grep readonly $(pwd) 2>/dev/null
+"$@" "$@" cd sed --verbose echo done "$1" "$1" | ${HOME} -eu grep x=1 test "$@"
+	export cd then "$1" "$@" grep -eu printf |
+	/usr/bin /usr/bin -eu echo | sed test done 'quoted text' cd $(pwd) x=1
+'quoted text' 2>/dev/null --verbose --verbose
+	readonly /usr/bin echo
+/usr/bin test /usr/bin --verbose $(pwd) done /usr/bin
+		-eu $(pwd) "$1" readonly echo export "$@" awk export $(pwd) && $(pwd) then
+	sed && 2>/dev/null sed test
+		$(pwd) --verbose 'quoted text' "$1"
+'quoted text' 'quoted text' x=1 export x=1 && awk /usr/bin ${HOME}
+		then printf sed readonly 2>/dev/null
+2>/dev/null "$1" done "$1" export export | 2>/dev/null
+/usr/bin ${HOME} test cd cd --verbose cd 2>/dev/null
+	$(pwd) --verbose local grep done 'quoted text' readonly
+--verbose awk "$@" readonly printf "$@" test sed done /usr/bin && -eu x=1 --verbose
+		test echo $(pwd) grep grep 2>/dev/null cd done
+		x=1 "$1" "$@" 'quoted text' "$@" /usr/bin
+	awk test test grep grep -eu ${HOME} -eu awk | && -eu cd done then cd local "$@"
+		'quoted text' then done ${HOME} 2>/dev/null
+	sed 'quoted text' "$@" sed "$1" | cd done local printf $(pwd) /usr/bin
+	cd grep --verbose /usr/bin x=1 export sed test
+/usr/bin printf grep -eu -eu sed "$1" awk export
+cd $(pwd) 2>/dev/null awk -eu /usr/bin awk 'quoted text'
+		"$1" sed awk x=1 && ${HOME} then
+		"$1" $(pwd) 2>/dev/null readonly grep sed printf /usr/bin |
+	done -eu ${HOME} "$@" "$1" readonly done "$1"
+		--verbose ${HOME} "$1" $(pwd)
+	"$@" grep then awk printf awk "$@" /usr/bin
+		$(pwd) sed awk printf $(pwd) then grep echo "$1" echo 'quoted text'
+		local "$@" export echo local ${HOME} ${HOME} readonly sed grep
+		--verbose /usr/bin grep awk 2>/dev/null x=1 echo $(pwd) awk "$@" readonly
+echo echo 'quoted text' 'quoted text' --verbose local echo echo 'quoted text'
+	-eu "$1" grep "$@" awk x=1 x=1
+then 'quoted text' ${HOME} $(pwd) ${HOME} done 'quoted text'
+test readonly test awk "$1" && 'quoted text' x=1 echo /usr/bin echo ${HOME}
+	${HOME} "$1" --verbose cd awk done $(pwd) awk && readonly | grep 2>/dev/null
+		"$1" echo ${HOME} /usr/bin readonly x=1 cd -eu 2>/dev/null test $(pwd) --verbose
+		awk done grep ${HOME} sed test sed sed then then printf $(pwd) /usr/bin export
+		test $(pwd) ${HOME} $(pwd)
+${HOME} export && | 'quoted text' test -eu printf echo | awk
+test x=1 local && printf readonly /usr/bin
+	readonly local 'quoted text' "$@" awk sed readonly done local
+sed awk sed sed cd printf && awk readonly x=1
+-eu ${HOME} sed && /usr/bin sed done grep
+-eu printf local -eu done sed x=1 cd /usr/bin $(pwd) $(pwd) -eu export
+		/usr/bin && "$@" then done x=1 -eu done | test readonly
+	printf /usr/bin echo local done && --verbose --verbose awk local
+cd | sed $(pwd) ${HOME} 'quoted text' cd awk x=1 "$1" 2>/dev/null
+		&& x=1 awk 'quoted text' echo local test "$1" cd readonly
+		grep | grep readonly printf readonly readonly done "$@"
+	export sed | done then grep | ${HOME} printf x=1 export awk -eu $(pwd)
+	"$@" 2>/dev/null ${HOME} ${HOME}
+echo readonly test 2>/dev/null export $(pwd) test "$@"
+echo grep "$1" --verbose cd test cd x=1 && 'quoted text'
+		2>/dev/null echo | readonly /usr/bin 'quoted text' grep awk then echo -eu
+		done --verbose awk x=1 ${HOME} 2>/dev/null
+	2>/dev/null local 'quoted text'
+	local 'quoted text' ${HOME} local awk
+local cd /usr/bin $(pwd) | /usr/bin
+	&& readonly export awk x=1 then
+cd 2>/dev/null "$1" "$@" 2>/dev/null --verbose
+		printf done -eu cd export "$@" cd -eu x=1
+		done -eu "$@" local "$@"
+		readonly local x=1 && $(pwd) | awk | readonly local $(pwd)
+-eu then ${HOME} $(pwd) "$@" grep printf -eu echo --verbose 'quoted text'
+"$1" | /usr/bin 'quoted text' "$1" readonly 2>/dev/null
+		-eu -eu readonly cd "$1" grep grep echo 'quoted text' | x=1 | x=1 sed &&
+	${HOME} done "$@" awk --verbose "$@" 'quoted text'
+/usr/bin done grep 2>/dev/null --verbose &&
+		"$@" 2>/dev/null /usr/bin cd sed local $(pwd)
+sed done readonly "$@" /usr/bin test
+		done --verbose 2>/dev/null -eu then $(pwd) && $(pwd) -eu grep "$1" done $(pwd)
+	$(pwd) readonly /usr/bin $(pwd) 2>/dev/null
+	readonly "$@" --verbose awk done && --verbose test && sed
+$(pwd) | && sed sed | 2>/dev/null
+	2>/dev/null --verbose awk /usr/bin cd 2>/dev/null test
+	printf "$1" readonly cd 2>/dev/null --verbose x=1
+		awk readonly --verbose readonly
+test -eu | "$1" local -eu cd 2>/dev/null ${HOME} 'quoted text' --verbose |
+-eu readonly grep x=1 --verbose
+	grep cd -eu ${HOME} export readonly
+		echo $(pwd) -eu echo x=1 /usr/bin &&
+	${HOME} --verbose x=1 /usr/bin -eu ${HOME} test
+sed awk -eu grep x=1 x=1 "$@" --verbose local "$@" grep grep --verbose
+printf sed "$@" local x=1
+	| $(pwd) export readonly sed | echo x=1 sed echo local x=1 local "$1" echo then
+sed | grep $(pwd) done "$@" 2>/dev/null 'quoted text' grep export awk
+	cd ${HOME} && && && | "$@" printf x=1
+	"$1" "$@" echo && ${HOME} 2>/dev/null test | x=1 | --verbose echo export export
+awk -eu awk 2>/dev/null local
+		"$1" 2>/dev/null 2>/dev/null
+"$1" printf -eu -eu readonly $(pwd) /usr/bin
+done local -eu local --verbose 2>/dev/null | $(pwd) awk "$1" 'quoted text'
+sed x=1 export readonly "$1" export | test --verbose "$@" | ${HOME}
+$(pwd) ${HOME} | "$@" -eu printf
+printf && $(pwd) grep 2>/dev/null "$@" local awk x=1 ${HOME} x=1 x=1 sed
+done export test done
+	x=1 awk ${HOME} "$1" -eu &&
+	readonly 'quoted text' then --verbose sed printf export $(pwd)
+		$(pwd) awk ${HOME} export
+&& ${HOME} export test sed readonly
+		test -eu 2>/dev/null --verbose ${HOME}
+grep awk x=1 echo x=1 'quoted text' sed "$@" && --verbose
+export ${HOME} | -eu && printf
+		test -eu | 'quoted text' local /usr/bin
+local $(pwd) awk 'quoted text' done test awk ${HOME} readonly
+'quoted text' test x=1
+		test "$1" export printf
+	echo /usr/bin /usr/bin
+export 2>/dev/null then
+		sed | then x=1 grep awk sed 'quoted text' | | $(pwd) 'quoted text'
+&& | | local export "$1" test "$@" $(pwd)
+'quoted text' readonly /usr/bin 'quoted text'
+	done --verbose readonly x=1 readonly readonly
+| echo then /usr/bin "$1" "$1" -eu cd --verbose && /usr/bin test 2>/dev/null
+&& cd -eu 'quoted text' sed export sed 'quoted text' 'quoted text' 'quoted text'
+		$(pwd) sed --verbose 'quoted text'
+		x=1 "$1" | --verbose test ${HOME} awk $(pwd) readonly "$1"
+$(pwd) $(pwd) $(pwd) "$@"
+	2>/dev/null && echo readonly
+awk printf x=1 && x=1 then 'quoted text' /usr/bin x=1 printf then done "$@" x=1
+		sed 2>/dev/null export then cd readonly export "$@" sed 2>/dev/null
+sed export cd echo awk | export | cd 2>/dev/null && /usr/bin "$@" awk done
+x=1 $(pwd) test --verbose x=1 readonly readonly && ${HOME}
+--verbose 2>/dev/null cd && local x=1 "$1" | local test && local "$1"
+echo local -eu export export sed 2>/dev/null x=1 done "$1" --verbose |
+	local x=1 then export echo --verbose --verbose printf printf /usr/bin awk cd
+		| "$1" --verbose ${HOME} && "$1"
+	${HOME} ${HOME} 2>/dev/null test export
+		grep grep test cd echo export 2>/dev/null && -eu cd sed local echo cd 'quoted text'
+		local test | | "$1" && sed export cd local ${HOME} && ${HOME} then |
+		readonly $(pwd) $(pwd) test
+		--verbose awk x=1 2>/dev/null
+		$(pwd) $(pwd) grep local /usr/bin awk $(pwd)
+	readonly -eu /usr/bin $(pwd) "$1" test ${HOME} -eu 2>/dev/null && --verbose
+		done test local 'quoted text'
+		--verbose && readonly printf && sed cd local echo
+	2>/dev/null printf $(pwd) done sed done grep echo "$@" $(pwd)
+--verbose grep echo ${HOME} "$1" printf "$1"
+2>/dev/null -eu 2>/dev/null
+-eu export x=1 printf ${HOME} echo readonly done grep
+		$(pwd) echo 2>/dev/null export then && "$1" ${HOME} echo "$1"
+	test test awk done readonly then export local && local test "$1"
+done sed grep echo done --verbose
+	then test then test -eu
+"$1" ${HOME} local printf done 'quoted text' echo "$1" 2>/dev/null
+test printf ${HOME} -eu 'quoted text' "$@" done x=1 | x=1 echo awk
+		'quoted text' --verbose /usr/bin ${HOME} ${HOME} && ${HOME} x=1 $(pwd) x=1 --verbose
+$(pwd) x=1 "$@" grep --verbose awk then "$1" done -eu awk
+		/usr/bin "$1" ${HOME} readonly echo 'quoted text' && grep sed grep readonly
+		grep 2>/dev/null --verbose cd x=1 echo 'quoted text'
+		2>/dev/null "$@" 'quoted text' | then cd cd echo ${HOME} "$1" local
+	grep local test printf $(pwd) --verbose "$1" ${HOME}
+		sed | x=1 --verbose done --verbose -eu done
+	echo /usr/bin 'quoted text' export /usr/bin export awk export -eu
+		awk -eu "$1" /usr/bin x=1 test grep x=1 ${HOME} local done test done export
+	$(pwd) 'quoted text' echo export "$1"
+		"$@" cd grep awk local "$1" grep printf
+export done local "$1" awk
+	awk printf test "$1" echo 'quoted text' "$1" --verbose export ${HOME} done
+		x=1 then | grep sed "$@" awk $(pwd) readonly
+	grep "$1" -eu | echo awk sed | export 'quoted text' then sed -eu
+| readonly /usr/bin "$@"
+--verbose printf && /usr/bin grep cd
+"$@" cd 2>/dev/null -eu 'quoted text' | echo 2>/dev/null 2>/dev/null
+	readonly export awk | readonly "$@" export then -eu printf 'quoted text'
+grep awk "$@" test x=1 2>/dev/null printf
+		2>/dev/null --verbose "$1" "$1" && sed cd "$@"
+	2>/dev/null 2>/dev/null "$1" printf &&
+		&& export $(pwd) sed "$@" export cd grep export /usr/bin
+	"$1" then test "$1" --verbose
+	local /usr/bin --verbose grep && ${HOME} ${HOME} local
+		then readonly 'quoted text' "$1" --verbose 2>/dev/null done cd
+		awk -eu printf export readonly grep | 'quoted text' ${HOME} x=1 echo x=1 grep
+| test && printf test grep readonly 'quoted text' local
+then then "$1" 'quoted text' | cd x=1
+	printf test "$1" printf ${HOME} sed readonly cd "$@" done 2>/dev/null readonly readonly
+readonly 2>/dev/null cd | readonly then && then done
+		readonly x=1 local "$1"
+--verbose | printf $(pwd) printf export test /usr/bin
+awk done sed 'quoted text'
+	"$1" /usr/bin x=1 -eu 'quoted text' ${HOME}
+awk sed && then awk done --verbose local -eu readonly /usr/bin $(pwd) /usr/bin
+export && && sed 2>/dev/null | readonly "$@"
+		x=1 awk /usr/bin 2>/dev/null /usr/bin echo -eu 'quoted text' sed
+	/usr/bin local /usr/bin test readonly cd 2>/dev/null "$1" "$1" cd done $(pwd)
+		--verbose done x=1 echo && local x=1 $(pwd) ${HOME}
+	$(pwd) then "$1" local local local awk "$@" echo | sed
+		$(pwd) /usr/bin readonly done "$@" |
+2>/dev/null test then done cd local readonly readonly ${HOME} 'quoted text'
+awk local 2>/dev/null && grep | echo awk && echo sed ${HOME} -eu printf
+		then echo ${HOME} test readonly $(pwd) &&
+	local "$1" "$@" $(pwd) test && "$1"
+	export "$@" done --verbose local done
+	test export printf "$@" 2>/dev/null echo cd "$1"
+"$@" sed local cd && | /usr/bin
+		&& -eu echo sed $(pwd) 2>/dev/null test "$@" 2>/dev/null 2>/dev/null
+	-eu && x=1 && ${HOME} awk "$@" test awk printf --verbose && local x=1 sed then
+	"$1" -eu && export cd grep then | sed local readonly 'quoted text' cd
+	then printf | /usr/bin echo printf
+--verbose echo test 2>/dev/null awk test -eu 'quoted text' done readonly 'quoted text'
+x=1 --verbose printf test ${HOME} ${HOME} 2>/dev/null $(pwd)
+	test export grep export 2>/dev/null -eu 'quoted text'
+2>/dev/null "$1" grep test local --verbose 2>/dev/null
+export cd cd /usr/bin | grep readonly 2>/dev/null cd printf
+		-eu export export cd "$1" done 2>/dev/null then "$@" printf --verbose
+| x=1 --verbose printf && export export
+"$@" "$@" $(pwd) sed /usr/bin then | then 2>/dev/null --verbose export printf
+then sed awk /usr/bin "$@" | --verbose echo readonly test "$1"
+	done printf 2>/dev/null $(pwd) grep /usr/bin export export -eu ${HOME} readonly
+		sed printf test export x=1 export
+	${HOME} 'quoted text' echo --verbose done ${HOME} cd grep -eu x=1 test 2>/dev/null
+echo | cd local 'quoted text' x=1 2>/dev/null | readonly export 'quoted text'
+| /usr/bin sed ${HOME} printf cd 'quoted text'
+		sed x=1 done "$1" cd 'quoted text' && export x=1 ${HOME}
+	printf $(pwd) then local readonly echo sed cd x=1 -eu sed awk done export
+readonly 'quoted text' readonly "$1" -eu awk grep local --verbose cd export
+	done test -eu awk 2>/dev/null awk done cd printf
+x=1 done printf test printf "$@" printf local && x=1 'quoted text' echo
+	'quoted text' grep awk local echo then 2>/dev/null "$1" printf && "$1"
+	"$1" printf done ${HOME} --verbose ${HOME} /usr/bin --verbose "$1" /usr/bin
+done "$@" "$1" --verbose then test printf readonly echo done -eu grep && local
+	local && "$@" "$1" "$@" && export x=1
+	'quoted text' -eu export x=1 readonly "$@" 2>/dev/null
+		"$@" local awk sed echo sed "$1" "$1" awk -eu /usr/bin awk test
+grep cd test done awk local then local $(pwd) export /usr/bin
+		export sed /usr/bin 'quoted text' printf -eu 2>/dev/null /usr/bin
+sed local 'quoted text' && cd -eu local done --verbose echo
+		&& local --verbose awk sed readonly cd grep
+	"$@" done 2>/dev/null /usr/bin 'quoted text'
+		grep local /usr/bin done $(pwd) test readonly then
+		"$1" grep sed "$1" then --verbose then "$@"
+2>/dev/null test local && $(pwd) done
+	local "$@" "$1" /usr/bin sed local $(pwd) test "$@" sed -eu 2>/dev/null
+readonly printf readonly readonly && grep export awk
+	then -eu "$1" /usr/bin grep local 2>/dev/null echo echo
+${HOME} 2>/dev/null /usr/bin
+		done done cd 'quoted text' x=1 awk
+$(pwd) local export 2>/dev/null --verbose
+export local ${HOME} awk export
+then export done | "$1" readonly cd sed grep then awk
+| 'quoted text' x=1 $(pwd)
+	sed then readonly 2>/dev/null done echo | --verbose
+		'quoted text' awk | printf awk /usr/bin "$1" && grep 2>/dev/null x=1 -eu /usr/bin
+		&& test /usr/bin cd | 'quoted text' echo
+		-eu "$@" -eu echo echo /usr/bin done --verbose cd $(pwd) local
+${HOME} | cd && cd printf -eu &&
+	--verbose -eu 2>/dev/null readonly "$1"
+	"$@" local x=1 -eu printf
+		'quoted text' awk | 2>/dev/null
+	local --verbose printf "$1" awk 2>/dev/null
+	local grep printf 'quoted text' && export
+"$1" local done $(pwd) grep "$@" done grep cd "$1" &&
+	printf export --verbose |
+	awk | /usr/bin grep test /usr/bin then export "$@" local 'quoted text'
+		&& "$1" "$@" ${HOME} x=1 | && && 2>/dev/null && then readonly 'quoted text'
+test /usr/bin 2>/dev/null readonly
+	local "$1" grep test grep && "$@" export "$1" printf && sed
+		local -eu "$@" && test ${HOME} x=1 && awk "$@" printf test readonly
+		'quoted text' export export
+		"$1" readonly test done printf local
+	printf --verbose "$@" export
+echo awk local --verbose -eu echo &&
+		2>/dev/null export && sed grep x=1 -eu echo | "$1" 'quoted text'
+echo awk -eu | then 2>/dev/null -eu $(pwd) $(pwd) && test
+	-eu --verbose "$1" sed 'quoted text' awk "$@" -eu ${HOME}
+		$(pwd) test --verbose ${HOME} x=1 readonly ${HOME} local "$1"
+local grep awk then done sed ${HOME} && --verbose grep readonly
+	"$@" then export done test | 2>/dev/null "$@" && export 2>/dev/null ${HOME} local
+	"$1" cd 2>/dev/null cd x=1
+	2>/dev/null ${HOME} printf
+		cd export x=1 "$1" 'quoted text' awk && $(pwd) export local
+		'quoted text' x=1 printf cd then && ${HOME} -eu -eu && -eu | -eu then
+echo local ${HOME} ${HOME} 'quoted text' export 2>/dev/null
+	$(pwd) 'quoted text' printf "$1" | sed
+"$@" /usr/bin test printf 'quoted text' local echo local
+	test "$@" --verbose 'quoted text'
+printf -eu awk printf printf 2>/dev/null 'quoted text'
+		2>/dev/null test then then $(pwd) "$@" readonly cd local cd
+"$@" test test echo grep
+readonly done --verbose $(pwd) done --verbose export
+$(pwd) sed "$@" ${HOME}
+	2>/dev/null "$1" grep printf sed echo --verbose
+	test grep local && | echo "$@" "$@" then cd export echo
+test then printf 'quoted text'
+| && 'quoted text' sed then awk x=1 then --verbose
+		grep awk | /usr/bin sed
+"$1" grep then "$@" x=1 readonly sed local "$1" sed "$1" local
+"$@" | export printf printf
+		| awk /usr/bin x=1 2>/dev/null then | | local
+x=1 x=1 "$@" done export sed $(pwd) awk readonly x=1 export &&
+readonly readonly test readonly awk x=1 cd export
+		x=1 "$@" then readonly then test "$@"
+		-eu echo export cd /usr/bin && grep 2>/dev/null
+	local cd grep export $(pwd) -eu --verbose
+		&& x=1 "$@" && x=1 "$1" "$@" -eu grep awk ${HOME} && test readonly printf
+		awk printf export 'quoted text'
+		sed 'quoted text' echo && export /usr/bin
+-eu "$@" -eu grep grep then cd -eu ${HOME} "$@" sed $(pwd) awk 2>/dev/null
+	| --verbose test | $(pwd) 2>/dev/null -eu -eu && test 2>/dev/null
+	readonly && /usr/bin grep export grep && readonly
+		x=1 cd "$1" "$1" $(pwd) 2>/dev/null --verbose cd echo echo
+	readonly -eu done "$1" "$@" x=1
+	cd && test | 2>/dev/null test export export printf
+		| local sed && awk /usr/bin
+	${HOME} 'quoted text' $(pwd) then local
+-eu then local 2>/dev/null printf then
+awk "$1" sed test readonly 'quoted text' printf printf sed readonly "$@"
+	printf grep then readonly 2>/dev/null $(pwd) grep 2>/dev/null "$1" done
+	"$@" cd 2>/dev/null -eu "$1"
+		x=1 ${HOME} awk 2>/dev/null printf test && $(pwd) done
+		| sed /usr/bin grep grep cd ${HOME}
+		$(pwd) $(pwd) then "$@" x=1 x=1 local awk
+	$(pwd) "$1" && -eu export $(pwd) printf $(pwd) readonly ${HOME} $(pwd)
+	readonly local sed 'quoted text' 2>/dev/null --verbose --verbose local "$1"
+--verbose -eu "$1" $(pwd) 2>/dev/null grep /usr/bin && ${HOME}
+	then printf $(pwd) local && $(pwd) then printf "$@" awk "$1" "$1"
+		sed /usr/bin | then -eu local then readonly local printf ${HOME} sed
+	local awk cd "$1" export sed test --verbose
+	sed "$1" --verbose 'quoted text' awk grep 2>/dev/null cd /usr/bin awk
+echo 'quoted text' "$@" sed readonly ${HOME} 2>/dev/null "$@" ${HOME} | done awk
+cd readonly "$@" then printf awk export test printf local ${HOME}
+	echo local then ${HOME} readonly 2>/dev/null export --verbose then -eu echo
+/usr/bin cd 2>/dev/null /usr/bin "$1" ${HOME} "$@" cd readonly 'quoted text'
+2>/dev/null -eu 2>/dev/null grep echo done then
+"$1" cd | cd && then readonly done sed awk grep
+	"$1" "$1" echo done cd "$1" "$1" local sed readonly
+| awk then 'quoted text' local "$1" then
+		echo done sed ${HOME} /usr/bin printf x=1 grep export export readonly
+grep local && readonly $(pwd) done x=1 --verbose printf readonly local
+		/usr/bin 'quoted text' | test && ${HOME} | 2>/dev/null test readonly
+		x=1 /usr/bin | sed x=1
+test export echo "$1" /usr/bin export grep
+awk printf cd printf 2>/dev/null
+2>/dev/null readonly
+--verbose printf -eu readonly -eu "$@" ${HOME} done 2>/dev/null readonly /usr/bin
+$(pwd) grep && 'quoted text' 'quoted text' then x=1 local $(pwd) /usr/bin
+	-eu test local cd sed /usr/bin && x=1
+	printf printf then "$@" printf done readonly 2>/dev/null then
+		--verbose | readonly printf -eu local
+		x=1 "$@" 'quoted text' echo grep grep
+grep && readonly then printf "$1" sed | done /usr/bin
+echo | --verbose | -eu x=1
+		'quoted text' x=1 sed "$@" -eu ${HOME}
+	sed printf export 2>/dev/null "$1" done 'quoted text'
+	x=1 ${HOME} readonly done "$@" readonly x=1 awk
+"$@" -eu 2>/dev/null sed echo export && echo && -eu --verbose
+	cd --verbose /usr/bin 'quoted text' readonly then -eu && -eu 'quoted text'
+	awk "$@" x=1 printf ${HOME} sed sed x=1
+		awk "$1" --verbose | --verbose export local | done
+	| "$1" ${HOME} "$@" printf
+		$(pwd) done done done then local then sed x=1 "$1" --verbose awk --verbose | test
+x=1 | 2>/dev/null $(pwd) test
+export "$@" -eu x=1 && export /usr/bin "$1" printf grep
+	test 2>/dev/null /usr/bin ${HOME}
+		sed export ${HOME} | sed "$@" /usr/bin grep grep "$1" $(pwd) then export local
+		--verbose -eu | cd x=1 test && && /usr/bin export awk printf readonly &&
+		-eu done /usr/bin grep then $(pwd) $(pwd) export 2>/dev/null
+		'quoted text' local sed readonly test && cd 2>/dev/null "$@" | x=1 done
+		then -eu 2>/dev/null -eu -eu && 2>/dev/null --verbose echo sed grep "$@"
+	${HOME} -eu cd --verbose readonly "$1" ${HOME}
+		2>/dev/null test && ${HOME} /usr/bin export "$@"
+grep -eu /usr/bin "$1" local sed then printf ${HOME} 2>/dev/null
+printf /usr/bin -eu grep local
+"$1" /usr/bin | "$1" sed "$1" export readonly then local
+-eu /usr/bin readonly /usr/bin done "$1" echo 2>/dev/null
+awk readonly printf then $(pwd) local readonly
+	/usr/bin printf done export x=1 "$@" x=1 "$@" sed export local export |
+		/usr/bin && --verbose --verbose "$@" cd "$@" --verbose -eu export
+	export echo sed sed /usr/bin export export export "$@" export --verbose cd $(pwd)
+	'quoted text' $(pwd) local
+"$1" ${HOME} && 'quoted text' printf then 2>/dev/null x=1 && readonly awk "$1"
+		echo grep readonly | x=1 done printf sed then -eu x=1 grep $(pwd)
+		/usr/bin "$1" grep done "$1" --verbose then cd x=1 grep "$1" printf -eu
+	--verbose $(pwd) awk "$@" cd test test
+	echo test x=1 /usr/bin 2>/dev/null test ${HOME} cd grep
+		printf done x=1 done "$@"
+	"$1" local && /usr/bin
+		readonly | sed | printf /usr/bin readonly 2>/dev/null
+		${HOME} done local 2>/dev/null local /usr/bin && |
+done && awk printf | readonly --verbose
+	${HOME} | 'quoted text' grep 2>/dev/null 2>/dev/null --verbose
+	echo 'quoted text' -eu --verbose test /usr/bin
+	cd cd $(pwd) cd cd awk echo grep awk test local sed printf && grep
+	-eu $(pwd) awk printf 'quoted text'
+		local export ${HOME} && --verbose
+		then 2>/dev/null local cd --verbose $(pwd) | grep test
+done sed 'quoted text' -eu --verbose 'quoted text' awk && $(pwd) local 2>/dev/null
+		x=1 done printf done sed /usr/bin local $(pwd) "$1"
+"$1" local export "$1" | "$1" test 'quoted text' readonly
+		2>/dev/null then | --verbose sed then cd /usr/bin | $(pwd) -eu
+	"$1" done --verbose --verbose printf --verbose x=1 awk export printf then test
+sed grep --verbose test readonly
+	then /usr/bin && test readonly "$1" x=1 2>/dev/null then echo done printf "$1"
+	local printf awk sed done -eu
+&& x=1 ${HOME} readonly "$1" then cd grep && $(pwd) test
+		then sed done then -eu -eu | test
+	readonly -eu | sed 'quoted text' /usr/bin $(pwd) test echo -eu -eu grep --verbose
+		readonly $(pwd) --verbose
+	awk local && printf 2>/dev/null cd grep sed awk $(pwd) readonly x=1 test ${HOME}
+		readonly export | readonly grep $(pwd)
+		-eu 'quoted text' -eu
+	echo cd local grep grep echo | --verbose "$@" printf $(pwd) printf
+-eu export printf | 'quoted text' printf "$@" awk | readonly grep "$1"
+	${HOME} awk readonly $(pwd) | test echo x=1 echo local && done 'quoted text'
+		export test printf printf $(pwd) awk echo 'quoted text'
+		export "$@" done done export && cd local -eu "$@" printf x=1 $(pwd) local
+	cd done 'quoted text' x=1 test printf 'quoted text'
+		&& then done ${HOME} /usr/bin readonly ${HOME} x=1
+		cd awk x=1 cd done ${HOME} export | local test done done grep
+		--verbose ${HOME} grep ${HOME}
+x=1 printf export readonly export "$1"
+		--verbose grep 'quoted text' then cd sed
+--verbose 'quoted text' 2>/dev/null | | then 2>/dev/null echo
+test then echo && readonly 2>/dev/null then x=1 test printf done
+	"$@" echo "$1" ${HOME} cd sed
+	awk printf sed cd --verbose $(pwd) && printf awk test sed sed then 'quoted text'
+		"$@" grep 'quoted text' grep --verbose ${HOME} /usr/bin
+echo x=1 -eu "$@" echo $(pwd) sed && sed --verbose "$1" ${HOME} $(pwd)
+	"$@" $(pwd) local /usr/bin echo sed readonly ${HOME} 2>/dev/null x=1
+	done ${HOME} ${HOME} && --verbose 'quoted text' $(pwd) awk 'quoted text'
+	readonly /usr/bin ${HOME} 'quoted text' && 'quoted text' printf printf done then
+		-eu 2>/dev/null printf -eu
+		$(pwd) sed "$1" x=1 printf export test test
+		2>/dev/null "$@" 'quoted text'
+		export cd printf local grep --verbose test
+		export "$@" 2>/dev/null $(pwd) cd awk then -eu export awk "$@" 'quoted text'
+| sed $(pwd) done "$1"
+	readonly sed -eu echo then x=1 2>/dev/null cd grep --verbose echo grep
+x=1 "$1" x=1 export grep ${HOME} -eu done printf grep
+		sed cd grep "$1" awk local cd
+done $(pwd) ${HOME} 'quoted text' ${HOME} "$@"
+"$1" grep cd && local "$@" done "$1"
+	--verbose echo test "$1" test 2>/dev/null
+	| export -eu -eu then ${HOME} "$1" local done
+	"$@" done --verbose 2>/dev/null $(pwd) --verbose cd "$1" export
+	${HOME} "$@" cd cd $(pwd) readonly test readonly 'quoted text' echo "$@" x=1
+		printf test $(pwd) cd && awk -eu --verbose x=1 --verbose test "$@" grep test
+2>/dev/null $(pwd) | && then 2>/dev/null
+		'quoted text' && | x=1 "$@" /usr/bin
+		sed 'quoted text' grep /usr/bin && x=1 grep --verbose printf "$1" x=1 local
+		/usr/bin sed cd /usr/bin cd --verbose readonly awk
+	${HOME} readonly $(pwd) && /usr/bin -eu ${HOME} printf
+${HOME} then export && x=1 ${HOME} ${HOME} x=1 readonly ${HOME}
+		grep $(pwd) test local ${HOME} then readonly awk /usr/bin export export 'quoted text'
+	echo awk 'quoted text' cd -eu sed ${HOME}
+test cd "$1" readonly local cd
+2>/dev/null echo cd && x=1 printf
+'quoted text' && test sed | ${HOME} cd | export sed echo
+		${HOME} export local --verbose | local local grep /usr/bin
+	| -eu readonly readonly export
+		readonly 2>/dev/null echo readonly --verbose
+printf "$@" done grep readonly 2>/dev/null awk 'quoted text' awk then /usr/bin
+		"$@" echo -eu 2>/dev/null echo x=1 echo 2>/dev/null test
+	export readonly grep awk awk | export 2>/dev/null echo "$@" then |
+		x=1 ${HOME} readonly 'quoted text'
+	grep "$1" awk then cd awk awk readonly printf $(pwd) then echo $(pwd) export
+	grep then | $(pwd) readonly "$1" test | echo x=1
+'quoted text' ${HOME} then cd done && echo grep echo | /usr/bin
+		${HOME} printf | $(pwd) echo && local ${HOME} done echo export readonly
+	-eu --verbose "$@" "$@" done
+		cd then 2>/dev/null 2>/dev/null export local
+	'quoted text' sed cd "$1" printf --verbose | | local /usr/bin
+		cd "$1" sed sed readonly echo && grep done
+| readonly export cd export test local /usr/bin
+cd $(pwd) | "$@" cd 'quoted text' grep 2>/dev/null
+		printf 'quoted text' cd -eu
+$(pwd) "$1" echo 'quoted text' printf local awk
+cd cd printf grep --verbose ${HOME} export
+		-eu done export printf sed | cd -eu sed 'quoted text'
+/usr/bin && export --verbose
+	${HOME} echo 2>/dev/null 'quoted text' $(pwd)
+	then /usr/bin cd "$@" -eu -eu 2>/dev/null 2>/dev/null
+		--verbose export $(pwd) $(pwd) then readonly local $(pwd)
+2>/dev/null /usr/bin printf sed /usr/bin /usr/bin awk local
+		$(pwd) /usr/bin $(pwd) 2>/dev/null echo 2>/dev/null
+test "$@" grep grep $(pwd) && done cd /usr/bin echo 2>/dev/null
+-eu && $(pwd) then printf 'quoted text'
+	test test | cd cd "$@" ${HOME} then
+grep test echo then ${HOME} "$@" /usr/bin && done |
+awk then then echo test printf 'quoted text' cd $(pwd) $(pwd) && done && echo
+2>/dev/null | 'quoted text' grep && 2>/dev/null $(pwd)
+test "$1" x=1 "$1" 'quoted text' 2>/dev/null done echo export
+${HOME} $(pwd) "$1" --verbose "$1" && export ${HOME} then "$@" readonly &&
+--verbose --verbose printf $(pwd)
+$(pwd) "$@" grep printf "$@" awk awk /usr/bin readonly printf
+	printf sed ${HOME} 'quoted text' ${HOME} export /usr/bin export
+printf x=1 then done $(pwd) cd
+	| --verbose "$@" done
+2>/dev/null sed export ${HOME} /usr/bin cd 2>/dev/null
+awk "$@" "$1" readonly cd then "$1"
+"$@" && 2>/dev/null "$1" ${HOME}
+export awk done | echo ${HOME} 'quoted text' --verbose done 2>/dev/null
+	&& 2>/dev/null $(pwd) 'quoted text' "$1" /usr/bin printf
+		sed ${HOME} test export printf 'quoted text' 2>/dev/null readonly sed 'quoted text'
+	printf local printf printf "$@" readonly local printf -eu "$@" local sed cd 2>/dev/null
+	--verbose 2>/dev/null 'quoted text' "$@" x=1
+		2>/dev/null done && awk 2>/dev/null && "$@" -eu cd | x=1 awk cd then cd "$1"
+2>/dev/null done && readonly /usr/bin
+	-eu /usr/bin "$@" x=1 local local -eu grep --verbose 'quoted text' sed
+&& $(pwd) x=1 grep echo readonly 'quoted text'
+	--verbose local sed "$@" 'quoted text' local && 'quoted text'
+		awk | $(pwd) sed grep export "$1" local
+	printf local /usr/bin then $(pwd) "$@" printf
+| ${HOME} 'quoted text' "$1" readonly
+		"$1" /usr/bin grep test cd readonly
+		'quoted text' echo 'quoted text' printf ${HOME} grep "$@"
+| "$1" readonly | then x=1 sed done $(pwd) 'quoted text'
+		readonly cd local | /usr/bin export -eu -eu --verbose done awk /usr/bin local
+--verbose x=1 ${HOME} | sed local awk local grep
+"$1" then awk "$1" | grep
+		export then -eu --verbose /usr/bin /usr/bin printf grep then done awk done
+		awk awk /usr/bin 'quoted text' /usr/bin 2>/dev/null 2>/dev/null
+-eu --verbose $(pwd) printf export done -eu local "$1" |
+	then "$1" echo ${HOME} $(pwd) awk "$1" then
+	-eu test readonly echo x=1 -eu awk grep "$@" --verbose "$1" echo done "$@" ${HOME}
+	--verbose && && grep "$1" export 'quoted text' sed 'quoted text' "$1" ${HOME} readonly
+		-eu export x=1 local 'quoted text' 2>/dev/null
+		echo sed then 2>/dev/null && cd grep --verbose local local /usr/bin echo
+	--verbose "$1" && done echo readonly
+$(pwd) echo --verbose ${HOME} local local
+		/usr/bin ${HOME} | --verbose "$1"
+2>/dev/null cd && export "$@" /usr/bin --verbose printf | 2>/dev/null &&
+	printf local awk then 2>/dev/null ${HOME} --verbose printf
+		"$1" x=1 -eu echo ${HOME} 2>/dev/null ${HOME} -eu grep $(pwd) x=1
+sed 'quoted text' cd awk ${HOME} ${HOME} readonly
+	echo local && && | grep then
+		${HOME} x=1 echo awk cd "$@" /usr/bin && 'quoted text' cd export awk
+| sed readonly sed $(pwd) readonly
+2>/dev/null -eu echo sed local then 2>/dev/null grep ${HOME}
+	sed export sed awk 2>/dev/null 'quoted text'
+		| export /usr/bin 'quoted text'
+-eu awk printf && "$@" 2>/dev/null test
+	| "$1" readonly local export $(pwd) 'quoted text'
+		test export printf grep readonly
+	sed readonly $(pwd) echo grep | done readonly
+		sed x=1 | cd echo $(pwd)
+	/usr/bin done sed 2>/dev/null ${HOME} local readonly | printf | then echo $(pwd)
+	then -eu 'quoted text' export /usr/bin "$@" cd
+	test 2>/dev/null awk local done printf $(pwd) export ${HOME} --verbose 2>/dev/null
+		${HOME} local --verbose 'quoted text' readonly test readonly awk "$@" printf
+		--verbose readonly sed printf sed test awk $(pwd) printf
+cd grep test awk && --verbose
+readonly --verbose x=1 --verbose test | cd 2>/dev/null
+&& "$1" -eu ${HOME} /usr/bin awk
+	'quoted text' x=1 echo grep && "$1" | "$1" && $(pwd) then export
+		&& x=1 && sed export x=1 2>/dev/null cd echo | "$@" export
+	-eu cd then grep echo sed | local -eu awk && 'quoted text'
+"$1" local && /usr/bin && $(pwd) test local sed then sed sed printf x=1 'quoted text'
+readonly x=1 grep then "$@" ${HOME} echo
+		2>/dev/null done -eu && export sed "$1" done
+test $(pwd) ${HOME} 'quoted text' -eu /usr/bin
+	done 'quoted text' then readonly readonly -eu cd
+		readonly printf 'quoted text' done "$@" ${HOME} export "$1"
+/usr/bin | awk printf 2>/dev/null ${HOME} -eu sed printf local 'quoted text'
+local echo test 'quoted text'
+	$(pwd) echo printf $(pwd)
+		echo --verbose export cd | "$@"
+	${HOME} $(pwd) ${HOME} 'quoted text' done test export /usr/bin cd printf awk
+		&& 'quoted text' ${HOME} x=1 "$@" "$1" local grep $(pwd) then export echo "$@"
+		awk then ${HOME} ${HOME} local
+grep cd ${HOME} && echo export done "$1" "$1" "$@" && 'quoted text' --verbose
+	echo local done done printf export sed cd | /usr/bin printf | 2>/dev/null 2>/dev/null
+		2>/dev/null x=1 then 'quoted text' readonly grep $(pwd) 'quoted text'
+	done then 'quoted text' export $(pwd) echo echo && "$@" $(pwd)
+	grep "$@" 'quoted text' done "$@" 2>/dev/null grep test local echo "$1"
+printf | $(pwd) readonly --verbose done test local x=1 && --verbose 'quoted text'
+		readonly && done | 2>/dev/null
+	2>/dev/null --verbose 'quoted text'
+	export test x=1 awk "$@" done local --verbose && printf 2>/dev/null
+		readonly readonly "$@" test x=1 readonly readonly local
+	&& -eu test && printf cd
+		local 2>/dev/null && sed readonly echo export then "$@" -eu grep
+		x=1 export 2>/dev/null "$1"
+		$(pwd) sed 2>/dev/null | done printf ${HOME}
+	--verbose /usr/bin /usr/bin
+readonly awk $(pwd) $(pwd) grep export printf 'quoted text'
+		export export "$1" "$1" sed 2>/dev/null export done test then local --verbose
+"$1" printf echo && $(pwd) && awk printf $(pwd)
+-eu "$1" -eu --verbose local local export $(pwd) ${HOME} /usr/bin
+		printf test sed printf "$@" $(pwd) $(pwd) --verbose && ${HOME} export test
+		printf 'quoted text' 'quoted text' | 2>/dev/null
+	echo 'quoted text' 2>/dev/null 'quoted text' sed "$1" grep
+"$@" "$@" test && && $(pwd) done "$@" readonly ${HOME}
+	done && cd && --verbose cd done
+		then "$@" /usr/bin "$@" -eu awk 'quoted text' -eu /usr/bin
+		$(pwd) --verbose | readonly grep && 'quoted text' "$@" done
+		awk test -eu --verbose 2>/dev/null && then then cd
+		then -eu --verbose 'quoted text' export
+	awk test "$@" $(pwd) export awk then 2>/dev/null && "$@" printf "$@" "$@" cd
+x=1 "$@" test test -eu /usr/bin 'quoted text'
+-eu awk echo grep sed --verbose
+/usr/bin local ${HOME} x=1 test x=1 then echo cd then done
+		sed 'quoted text' ${HOME} "$1" /usr/bin /usr/bin --verbose $(pwd) export cd
+		export $(pwd) --verbose 2>/dev/null
+test x=1 done 'quoted text' done
+printf -eu $(pwd) --verbose /usr/bin $(pwd) 'quoted text' printf grep
+	export && grep awk grep --verbose then local sed
+		readonly && local grep done cd "$1" export local done
+sed $(pwd) printf "$1" cd
+${HOME} | -eu /usr/bin echo awk done printf x=1 readonly
+&& "$@" test echo ${HOME} test -eu then cd local echo /usr/bin
+	test done done -eu printf 2>/dev/null test --verbose sed "$1"
+		$(pwd) readonly readonly 'quoted text' echo && $(pwd) export readonly
+	local echo /usr/bin ${HOME} /usr/bin $(pwd) then printf 'quoted text'
+printf && sed done --verbose
+	grep && 2>/dev/null printf then then "$@" "$1" 'quoted text' echo
+local /usr/bin then echo grep 'quoted text' ${HOME} 2>/dev/null
+	"$1" $(pwd) | grep local export 'quoted text' --verbose
+		"$@" test && then printf && local 2>/dev/null cd | "$1" cd done 2>/dev/null
+	--verbose --verbose cd | sed "$1" readonly local sed test
+	done 'quoted text' awk done sed test --verbose
+	$(pwd) awk export grep "$1" printf test printf $(pwd) then --verbose done
+echo -eu 'quoted text' cd x=1 export
+		&& $(pwd) then echo && export grep done done export
+		local then sed 2>/dev/null printf -eu 2>/dev/null $(pwd) x=1 export export printf
+sed test printf 'quoted text'
+		2>/dev/null cd echo $(pwd) test
+	${HOME} sed -eu grep grep awk --verbose then cd "$1" "$@" x=1 |
+	2>/dev/null awk sed awk && ${HOME} test
+		$(pwd) ${HOME} readonly test x=1 | then then x=1 && sed x=1 then
+grep then "$1" $(pwd) /usr/bin -eu export $(pwd)
+		grep cd $(pwd) test export test /usr/bin 'quoted text'
+	export local -eu cd local "$@" "$@" 'quoted text'
+awk local x=1 /usr/bin awk local && then 2>/dev/null printf && done
+	/usr/bin "$@" "$@" readonly grep readonly readonly
+		| $(pwd) export then export then done "$@" "$@"
+		sed export then awk "$@" $(pwd) | x=1 then $(pwd) export
+	awk /usr/bin x=1 local && && -eu "$@" printf echo "$1" export
+		| awk | grep 2>/dev/null /usr/bin echo "$1" && "$1" test -eu
+export | test && then | | | "$1" then printf 'quoted text' /usr/bin
+"$@" | ${HOME} local echo /usr/bin test 2>/dev/null -eu printf /usr/bin 'quoted text'
+	readonly 'quoted text' 'quoted text' /usr/bin $(pwd)
+	sed x=1 | "$1" readonly && "$1" grep 'quoted text' | test 2>/dev/null
+	x=1 readonly 'quoted text' export awk ${HOME} local export
+/usr/bin 'quoted text' && ${HOME}
+local test readonly test
+'quoted text' x=1 x=1 export --verbose
+		-eu export export | test then cd echo &&
+		test printf 'quoted text' x=1 cd "$1" "$@" -eu --verbose
+		x=1 grep test grep --verbose local then | sed --verbose
+-eu 'quoted text' $(pwd) sed | "$@" -eu 2>/dev/null then sed test done then "$1"
+	export then | /usr/bin sed local local local echo local sed export
+${HOME} sed sed && && sed readonly --verbose
+then --verbose "$1" sed sed grep "$1" local
+	$(pwd) awk test echo && readonly cd export sed echo -eu ${HOME} awk readonly
+		then "$1" ${HOME} echo "$@" done
+		--verbose done $(pwd)
+		${HOME} local then awk sed readonly
+/usr/bin echo -eu $(pwd) --verbose then echo
+		echo /usr/bin --verbose awk $(pwd) | local readonly
+'quoted text' x=1 2>/dev/null local && x=1 cd test done then | 2>/dev/null
+sed local $(pwd) && 'quoted text'
+printf cd cd && $(pwd) cd 'quoted text'
+		"$@" awk && $(pwd) $(pwd)
+-eu && export 'quoted text' 'quoted text' | -eu printf x=1 'quoted text'
+	sed -eu sed 2>/dev/null 2>/dev/null 2>/dev/null
+readonly /usr/bin && --verbose echo then local grep export 2>/dev/null grep
+	then ${HOME} local done 2>/dev/null printf sed && && sed sed 2>/dev/null
+local -eu export 2>/dev/null "$1" awk
+		export readonly done --verbose | --verbose $(pwd) -eu awk sed
+		/usr/bin $(pwd) && x=1 "$@" $(pwd) x=1 printf ${HOME} done 'quoted text'
+	&& x=1 local cd local && local
+	&& test echo -eu --verbose -eu export
+	/usr/bin cd ${HOME} test --verbose $(pwd) test
+		awk awk 'quoted text' 2>/dev/null && x=1 ${HOME} -eu
+		"$@" grep done && && export
+		2>/dev/null "$@" $(pwd) x=1 | 'quoted text' ${HOME} readonly
+	--verbose | -eu 2>/dev/null
+	awk $(pwd) done "$1" | done 2>/dev/null then && printf done test printf x=1
+		test ${HOME} && awk then && $(pwd)
+	then "$@" && && cd readonly | --verbose && 2>/dev/null 2>/dev/null
+		"$@" printf -eu awk /usr/bin 'quoted text' cd -eu export
+&& "$1" test && x=1 test
+	printf printf export 2>/dev/null /usr/bin cd
+	/usr/bin done sed $(pwd) 'quoted text' local local awk ${HOME} printf
+	'quoted text' cd --verbose "$@" done cd done
+		local x=1 --verbose $(pwd) 'quoted text' readonly /usr/bin 'quoted text' && --verbose
+export sed -eu --verbose grep ${HOME} "$@" 2>/dev/null awk awk sed -eu &&
+	/usr/bin --verbose "$@" --verbose printf echo x=1 printf -eu 'quoted text'
+	${HOME} 'quoted text' ${HOME} done local then readonly /usr/bin
+		echo test done --verbose "$@" sed cd cd x=1 done "$1"
+local -eu echo export --verbose readonly test
+2>/dev/null readonly readonly x=1 'quoted text' echo echo local sed local grep --verbose
+		${HOME} then "$@" test 2>/dev/null $(pwd) grep
+	cd 'quoted text' done -eu 'quoted text' "$1" export export
+		local x=1 awk sed then --verbose awk grep test -eu sed then && x=1 -eu | -eu sed
+		"$@" -eu ${HOME} export local ${HOME} awk done x=1 /usr/bin --verbose
+done "$1" grep --verbose test $(pwd) 2>/dev/null awk /usr/bin
+"$1" x=1 $(pwd) "$@" "$1" | then | done $(pwd) export done echo
+	done printf grep 2>/dev/null awk readonly grep -eu
+grep -eu 'quoted text' local 2>/dev/null
+		grep export readonly printf --verbose
+		export sed then ${HOME} 2>/dev/null ${HOME} awk test | x=1 local | cd 2>/dev/null
+cd x=1 "$@" $(pwd) 'quoted text' cd readonly then -eu grep readonly grep "$1" 2>/dev/null
+	${HOME} "$@" local | export x=1
+test echo | /usr/bin sed printf local "$1" export
+x=1 x=1 printf test 'quoted text' ${HOME} readonly
+	"$1" /usr/bin echo x=1 /usr/bin 2>/dev/null x=1 cd | readonly
+		x=1 awk cd awk $(pwd) $(pwd) test x=1 test "$@" awk readonly sed
+	-eu printf $(pwd) ${HOME} "$1" "$1" 'quoted text' done cd sed
+export done | sed cd -eu ${HOME} test 2>/dev/null
+	sed ${HOME} echo local readonly grep sed awk x=1 sed readonly cd readonly 2>/dev/null
+	"$@" $(pwd) 'quoted text' 'quoted text'
+--verbose -eu -eu x=1 2>/dev/null readonly && awk awk cd grep grep -eu | then
+2>/dev/null $(pwd) "$@" $(pwd)
+	done 2>/dev/null $(pwd) 2>/dev/null
+"$1" printf /usr/bin printf 'quoted text' awk grep "$@"
+		export x=1 'quoted text' local "$1" "$@" echo $(pwd) done 'quoted text'
+local "$1" echo --verbose
+		grep && awk ${HOME} | echo readonly awk awk test && local --verbose
+sed && 2>/dev/null -eu 'quoted text' awk
+	x=1 echo awk grep ${HOME} echo
+		${HOME} && sed $(pwd) |
+		--verbose | ${HOME} $(pwd) $(pwd)
+		sed ${HOME} readonly printf awk | "$@" cd local ${HOME} grep ${HOME}
+'quoted text' "$1" 'quoted text' $(pwd) "$@"
+		2>/dev/null readonly sed printf
+printf "$@" | --verbose local && printf 2>/dev/null "$1" "$1" local awk then readonly
+'quoted text' && ${HOME} --verbose sed then 'quoted text' test ${HOME} echo -eu
+	awk done readonly /usr/bin ${HOME} | cd test $(pwd) x=1 readonly -eu
+	echo --verbose 'quoted text' then printf /usr/bin export && 'quoted text' "$1"
+"$@" test grep readonly && awk then /usr/bin ${HOME} 'quoted text' 'quoted text'
+--verbose printf readonly local "$@"
+${HOME} test then "$@"
+		&& /usr/bin --verbose /usr/bin
+		printf readonly ${HOME} printf echo cd cd | 'quoted text'
+	echo printf 2>/dev/null then --verbose
+cd | /usr/bin grep -eu grep local sed $(pwd) --verbose done
+grep --verbose export then "$1" echo 2>/dev/null
+| "$@" ${HOME} 'quoted text' cd /usr/bin /usr/bin
+		echo "$@" echo grep $(pwd) echo printf readonly export cd awk -eu "$@"
+'quoted text' --verbose -eu | /usr/bin --verbose | export test "$1"
+	$(pwd) 2>/dev/null /usr/bin cd then export then sed && grep $(pwd) then "$1" test
+test test ${HOME} sed -eu
+sed $(pwd) 2>/dev/null "$1" && "$@" ${HOME} -eu
+		local export "$@" local echo then sed then grep $(pwd) --verbose done
+x=1 x=1 $(pwd) "$@" done cd && 'quoted text'
+		x=1 $(pwd) then readonly local ${HOME} | --verbose
+	export 2>/dev/null sed test $(pwd) | /usr/bin 2>/dev/null
+then export done | awk "$1" readonly 'quoted text'
+	2>/dev/null awk 'quoted text' grep "$@" cd then 2>/dev/null grep
+$(pwd) x=1 then "$@" readonly 'quoted text' -eu 'quoted text'
+	"$1" export readonly && 'quoted text' | ${HOME}
+test printf /usr/bin done && printf echo
+		done local && "$@" -eu && then export 2>/dev/null
+	x=1 x=1 -eu /usr/bin then
+test -eu done export "$1" 'quoted text' readonly readonly
+done cd then --verbose then x=1
+		-eu sed 'quoted text' grep test echo then then grep "$1" then 2>/dev/null
+	local /usr/bin then "$1" x=1 grep ${HOME} -eu "$@" printf echo ${HOME} readonly
+test printf readonly && x=1 "$@" grep readonly test
+		-eu test $(pwd) | readonly
+	${HOME} test local cd "$@" printf --verbose x=1
+	"$1" "$1" echo | grep grep printf done --verbose 'quoted text'
+		grep echo -eu then awk done
+export done "$@" awk "$1" sed done then $(pwd)
+		printf local cd sed cd /usr/bin -eu cd --verbose cd then test $(pwd)
+		grep ${HOME} then -eu 2>/dev/null
+&& local echo export | ${HOME} awk 'quoted text'
+&& cd "$@" cd printf cd && | awk echo 2>/dev/null ${HOME} "$@" sed
+	/usr/bin /usr/bin then then /usr/bin --verbose printf /usr/bin export cd
+	/usr/bin awk done | printf ${HOME} "$@" grep -eu local then 'quoted text'
+		export readonly local awk export $(pwd) readonly done
+		-eu x=1 'quoted text'
+awk "$@" test printf export cd -eu echo local readonly awk -eu
+"$1" sed $(pwd) export export export -eu && | -eu | $(pwd) export
+	&& 'quoted text' grep sed printf "$@" 'quoted text'
+		-eu echo /usr/bin $(pwd) /usr/bin test cd "$@" "$1"
+		-eu -eu readonly "$1" --verbose then cd 'quoted text' grep echo 2>/dev/null echo
+		| $(pwd) | "$@" 'quoted text' | |
+	test "$@" 'quoted text' export cd ${HOME}
+		'quoted text' grep readonly echo 'quoted text'
+x=1 readonly 2>/dev/null done -eu sed printf sed 'quoted text'
+		-eu "$@" local 'quoted text' 2>/dev/null sed done cd printf local sed then
+		done grep /usr/bin /usr/bin echo done -eu 2>/dev/null printf "$1"
+readonly grep readonly printf sed && done | readonly x=1 /usr/bin
+		awk /usr/bin echo cd | done awk grep echo readonly $(pwd) then --verbose sed 2>/dev/null
+	| /usr/bin echo 2>/dev/null ${HOME} cd done test -eu x=1 echo
+	/usr/bin --verbose export 'quoted text' 'quoted text' then && readonly
+${HOME} done test export -eu 2>/dev/null
+	readonly grep done 2>/dev/null $(pwd)
+		test 2>/dev/null --verbose grep 2>/dev/null
+'quoted text' done test
+then --verbose -eu /usr/bin awk ${HOME}
+	local -eu && 'quoted text' ${HOME} && --verbose
+	test "$1" readonly readonly
+		/usr/bin echo printf $(pwd) done && $(pwd) 'quoted text'
+	awk readonly test echo && done "$1" "$1"
+		done $(pwd) export "$@" export && /usr/bin then "$@" 'quoted text'
+		'quoted text' then sed $(pwd) 'quoted text' ${HOME} readonly $(pwd) readonly
+	"$1" then $(pwd) then sed -eu echo awk sed
+		-eu /usr/bin x=1 sed ${HOME} "$@" printf | | cd
+$(pwd) --verbose export -eu -eu 2>/dev/null $(pwd) x=1 /usr/bin cd --verbose
+		"$1" cd /usr/bin local -eu ${HOME} sed local export local
+	x=1 cd 'quoted text' "$1" test
+readonly ${HOME} test printf && printf --verbose 'quoted text'
+		2>/dev/null done sed then 2>/dev/null 2>/dev/null
+		$(pwd) test $(pwd) grep 'quoted text' test local cd x=1 test grep "$1"
+$(pwd) export local awk echo export && 2>/dev/null /usr/bin -eu -eu 2>/dev/null
+$(pwd) echo --verbose x=1 ${HOME} "$1" -eu | grep
+	-eu sed "$@" then --verbose "$1" ${HOME} "$1" export done --verbose
+x=1 grep $(pwd) "$@" grep grep
+	readonly printf x=1 && printf export 'quoted text'
+		"$1" | -eu 'quoted text' $(pwd)
+		| x=1 $(pwd) | printf /usr/bin -eu 'quoted text' then local 2>/dev/null
+	done ${HOME} "$@" sed "$1" readonly "$@" printf grep 2>/dev/null
+	done awk x=1 && --verbose
+		-eu "$1" ${HOME} sed awk export && echo &&
+"$1" && grep grep --verbose cd local then awk sed echo test --verbose
+	awk $(pwd) readonly local done "$1" 2>/dev/null printf done --verbose
+echo && "$@" printf then
+readonly "$1" sed ${HOME} 2>/dev/null local awk
+		done "$1" echo then x=1 export --verbose x=1
+		x=1 "$1" "$@" $(pwd) "$1" --verbose && | $(pwd) echo --verbose
+then 2>/dev/null readonly printf "$@" -eu readonly /usr/bin
+	'quoted text' awk x=1 local export
+"$1" --verbose | 2>/dev/null
+	2>/dev/null cd x=1 local 2>/dev/null "$1" $(pwd)
+	| cd sed $(pwd) cd sed echo local echo local echo && readonly
+	${HOME} $(pwd) grep cd "$@" "$1" echo -eu cd cd $(pwd)
+	'quoted text' export x=1 && then echo test x=1 cd && "$1" printf
+	printf echo && ${HOME} awk printf grep awk 'quoted text' export
+'quoted text' "$@" -eu "$1" --verbose cd && printf ${HOME} echo | export 2>/dev/null
+	"$1" "$1" "$1" | grep cd
+	local cd grep --verbose && && cd test -eu awk --verbose
+		awk && local grep printf -eu 2>/dev/null
+	"$@" grep done done && printf /usr/bin
+	-eu ${HOME} sed awk then "$@" "$@"
+		$(pwd) && --verbose --verbose -eu printf "$@"
+		$(pwd) 2>/dev/null $(pwd) then 'quoted text'
+-eu test cd awk printf | -eu awk grep 'quoted text'
+		then readonly x=1 printf --verbose local grep printf grep /usr/bin
+		grep | awk echo x=1 grep printf $(pwd) sed
+		echo 2>/dev/null "$1" grep | local ${HOME} printf
+test readonly local | sed | x=1 $(pwd) | local
+	local && "$@" local $(pwd) "$1" |
+	cd awk 'quoted text' 2>/dev/null echo ${HOME} awk && && --verbose "$1" $(pwd) done
+		| x=1 grep export grep $(pwd) test -eu then done test done
+		"$1" | test "$@" /usr/bin
+	grep local cd test sed $(pwd) ${HOME} done ${HOME} sed x=1 && && 2>/dev/null
+		2>/dev/null then export -eu printf
+grep $(pwd) export /usr/bin echo readonly -eu echo
+		echo "$1" echo readonly $(pwd) "$1" x=1 awk cd && &&
+		awk | x=1 "$1" 'quoted text'
+		awk "$1" && "$@" export /usr/bin "$@"
+done sed x=1 printf ${HOME} done 2>/dev/null 2>/dev/null
+	x=1 grep export echo readonly grep --verbose local "$@" $(pwd) 2>/dev/null
+x=1 $(pwd) awk done printf export cd
+		printf test 2>/dev/null && "$@" export echo test readonly -eu local sed done
+awk /usr/bin test | readonly local --verbose --verbose x=1
+	&& /usr/bin local "$1" grep && readonly "$1" export echo
+		&& readonly then "$1" $(pwd)
+awk "$@" $(pwd) 2>/dev/null "$@" sed readonly printf
+	${HOME} | 'quoted text' done x=1 ${HOME} then "$1" awk readonly &&
+	/usr/bin --verbose awk
+		readonly export local grep "$@" $(pwd) 2>/dev/null readonly echo done
+		echo local && local grep 2>/dev/null -eu
+	--verbose ${HOME} echo local cd cd "$1" &&
+	/usr/bin --verbose --verbose "$1" 'quoted text' $(pwd) sed printf
+	/usr/bin awk /usr/bin awk /usr/bin 2>/dev/null
+		cd readonly export printf readonly export ${HOME} ${HOME} readonly
+	$(pwd) export awk -eu | test echo
+		2>/dev/null test $(pwd)
+/usr/bin test --verbose sed x=1 awk readonly $(pwd) "$@" --verbose
+		--verbose awk sed printf "$@" 2>/dev/null && && cd -eu x=1
+&& $(pwd) /usr/bin echo ${HOME} &&
+		test test 'quoted text' | $(pwd) /usr/bin
+		--verbose -eu $(pwd) test 'quoted text'
+$(pwd) printf readonly ${HOME} grep printf && then grep 2>/dev/null x=1
+		test ${HOME} x=1 readonly done grep "$1" /usr/bin test grep readonly /usr/bin
+		then x=1 -eu x=1 awk $(pwd) printf done | && --verbose
+		cd "$@" then -eu x=1 sed readonly
+	readonly /usr/bin cd -eu 2>/dev/null x=1
+		export grep cd done local
+		"$@" x=1 --verbose printf then
+echo | printf grep 'quoted text' then && "$1" 2>/dev/null /usr/bin
+		test grep test awk | readonly done $(pwd)
+		/usr/bin test x=1 x=1 awk $(pwd) /usr/bin $(pwd) 'quoted text' readonly ${HOME}
+	2>/dev/null awk "$@" printf x=1 'quoted text' "$1"
+${HOME} /usr/bin ${HOME} readonly done ${HOME} echo
+		&& grep /usr/bin awk /usr/bin "$1" grep
+	cd cd /usr/bin "$1" printf echo test cd /usr/bin cd done
+	2>/dev/null printf sed -eu ${HOME} echo ${HOME} "$1"
+		'quoted text' echo 2>/dev/null sed $(pwd) --verbose
+	&& grep "$@" x=1 test done echo test
+	--verbose printf done x=1 2>/dev/null && 'quoted text' "$1" $(pwd)
+	"$1" printf x=1 readonly -eu readonly "$1" printf export /usr/bin x=1 -eu then /usr/bin
+--verbose local && 'quoted text' && x=1 export done printf
+		x=1 "$1" -eu 2>/dev/null --verbose "$1" | done sed --verbose "$1" cd --verbose
+x=1 test $(pwd) printf grep export readonly --verbose echo
+		"$@" test x=1 -eu then ${HOME} local grep awk | then test && printf ${HOME}
+	awk echo 2>/dev/null test printf then done local ${HOME} --verbose 'quoted text'
+echo grep readonly readonly | "$@" --verbose x=1
+		export -eu readonly sed "$1" -eu
+	local sed sed && --verbose "$@"
+	${HOME} /usr/bin | x=1 $(pwd) $(pwd) "$1" done "$1" "$1"
+	sed 'quoted text' cd /usr/bin --verbose
+&& 'quoted text' cd then /usr/bin $(pwd) echo echo
+		readonly && test "$@" --verbose x=1 local
+	grep awk grep done 2>/dev/null local test /usr/bin | -eu cd /usr/bin
+	x=1 test "$1" /usr/bin export "$1" 'quoted text' then
+grep printf "$@" 2>/dev/null done 2>/dev/null readonly 'quoted text'
+	test --verbose && | -eu
+local $(pwd) ${HOME} printf then 2>/dev/null printf
+&& -eu readonly $(pwd)
+		--verbose readonly /usr/bin --verbose && | -eu awk && readonly then x=1 then
+	grep awk 2>/dev/null
+	-eu local "$1" -eu | done --verbose "$@" readonly "$1" sed
+		echo readonly "$1" awk ${HOME} awk && x=1
+	"$@" echo echo | readonly cd | grep local
+-eu --verbose test awk printf printf "$@" | cd | ${HOME} "$@" test 2>/dev/null
+	-eu -eu cd readonly local printf -eu && readonly $(pwd)
+readonly test echo done sed /usr/bin sed
+		${HOME} x=1 sed readonly 2>/dev/null "$@" readonly --verbose x=1
+	$(pwd) done 'quoted text' export printf test
+		printf done then local cd done
+	| 2>/dev/null then x=1 2>/dev/null $(pwd) 2>/dev/null local grep
+sed echo | $(pwd) echo cd &&
+	2>/dev/null export export grep "$1" "$1"
+awk 'quoted text' echo done readonly done printf readonly --verbose /usr/bin
+export sed "$1" cd cd -eu local local cd
+--verbose | readonly -eu 2>/dev/null && --verbose "$@"
+		'quoted text' printf export 2>/dev/null awk "$1" ${HOME} "$@" 2>/dev/null
+x=1 test test && echo x=1 done ${HOME} echo
+	done local test --verbose | readonly readonly awk --verbose /usr/bin sed ${HOME}
+/usr/bin 'quoted text' -eu | local /usr/bin echo
+export printf readonly export -eu test cd awk grep sed 2>/dev/null 2>/dev/null
+		"$1" test -eu sed "$@" export 'quoted text'
+		2>/dev/null then printf $(pwd) ${HOME} sed test
+local local then test cd "$1" printf /usr/bin
+	export grep readonly printf test printf cd then grep 'quoted text' -eu --verbose
+		/usr/bin awk cd x=1 "$1" && 2>/dev/null | 2>/dev/null
+		sed ${HOME} | grep 2>/dev/null awk readonly x=1 awk 2>/dev/null -eu cd sed printf
+x=1 echo then sed 'quoted text' x=1 /usr/bin 2>/dev/null
+echo -eu 2>/dev/null printf /usr/bin local cd "$1" readonly
+	"$@" sed sed sed $(pwd) sed grep then echo /usr/bin
+		'quoted text' printf printf
+then --verbose test sed
+		local cd "$1" -eu grep "$@"
+		--verbose --verbose $(pwd) test "$1" "$1" printf grep readonly /usr/bin export
+--verbose x=1 x=1 ${HOME} printf --verbose "$1" local 'quoted text' grep
+sed x=1 done && cd "$1" sed awk sed echo then then
+then | 'quoted text' /usr/bin export printf && readonly
+		$(pwd) -eu $(pwd) ${HOME}
+/usr/bin 'quoted text' echo 'quoted text' ${HOME}
+	'quoted text' done "$@" printf
+${HOME} -eu sed "$@" --verbose ${HOME} cd awk $(pwd) /usr/bin
+	2>/dev/null 'quoted text'
+	--verbose printf | test local 'quoted text'
+	"$1" -eu /usr/bin then -eu 2>/dev/null "$1" readonly
+	export 2>/dev/null done 2>/dev/null
+	printf export printf "$@" ${HOME} printf $(pwd)
+sed --verbose --verbose awk "$@" "$1" --verbose
+	then "$1" grep echo done then
+	printf sed test "$@" export grep | export 'quoted text' "$@"
+$(pwd) export --verbose
+x=1 /usr/bin grep printf awk "$@" then readonly awk local test then && grep
+	done /usr/bin sed sed then done grep "$@" /usr/bin &&
+	${HOME} local ${HOME} awk awk 'quoted text' 2>/dev/null test --verbose echo
+	| $(pwd) cd | test 2>/dev/null 2>/dev/null printf export sed then
+		grep test ${HOME} local 'quoted text' && ${HOME} grep 'quoted text'
+&& "$1" grep readonly "$@" && export readonly 'quoted text' 'quoted text' echo readonly
+	then && ${HOME} $(pwd) test
+awk cd 'quoted text' then cd done 'quoted text' sed
@@ -0,0 +1,2001 @@
+		x=1 /usr/bin cd printf local -eu | export -eu done $(pwd) 'quoted text'
+	echo local "$@" done /usr/bin "$1" ${HOME} test 'quoted text' "$@" export
+sed test awk 2>/dev/null 'quoted text' && test
+	-eu | ${HOME} && -eu test done printf "$1" then --verbose x=1
+awk done test /usr/bin "$@" test local $(pwd) $(pwd) done sed printf awk -eu $(pwd)
+--verbose sed grep test
+		2>/dev/null ${HOME} "$1" grep local export
+&& /usr/bin export $(pwd) | test $(pwd) export done
+	/usr/bin /usr/bin -eu | export echo grep "$@" export then local
+	x=1 2>/dev/null | --verbose then then --verbose
+		test printf 'quoted text' | sed --verbose then x=1 readonly export
+		&& | local local "$1" sed && | test $(pwd) sed "$@" 2>/dev/null --verbose
+		test x=1 then echo awk -eu then "$@" ${HOME} 'quoted text'
+		export 2>/dev/null local then x=1 |
+--verbose then && done ${HOME} | -eu cd ${HOME} "$1" cd &&
+	export | sed --verbose done | && local "$1" then sed $(pwd) /usr/bin -eu cd test
+awk "$1" $(pwd) && "$1" $(pwd)
+-eu -eu x=1 printf readonly echo done ${HOME} --verbose "$1"
+cd awk "$@" test printf x=1 | export $(pwd) export --verbose
+	| echo sed --verbose awk export "$1" 2>/dev/null /usr/bin test printf
+x=1 "$@" cd cd export echo && export local printf "$1" /usr/bin
+2>/dev/null --verbose printf 'quoted text' test /usr/bin
+/usr/bin 2>/dev/null ${HOME} test printf -eu 2>/dev/null awk | ${HOME} export
+	'quoted text' /usr/bin 'quoted text' 2>/dev/null
+		done --verbose sed $(pwd) grep "$1" cd done $(pwd) 'quoted text' 'quoted text'
+		"$1" then test "$1" "$@" done 2>/dev/null -eu awk -eu
+--verbose && then test -eu && "$@" grep local
+&& readonly awk local readonly /usr/bin --verbose
+x=1 /usr/bin --verbose then
+	-eu done -eu echo --verbose sed 2>/dev/null && -eu printf 2>/dev/null
+		"$@" /usr/bin echo 2>/dev/null 2>/dev/null
+cd grep test "$1" /usr/bin | ${HOME} /usr/bin cd "$@"
+		grep 'quoted text' export cd grep sed then sed "$1" test
+echo x=1 && "$1" x=1 grep ${HOME} /usr/bin printf x=1 export x=1 done x=1
+cd $(pwd) test printf $(pwd) readonly
+	sed 'quoted text' "$1" /usr/bin
+	export --verbose x=1 "$@" ${HOME} && printf x=1
+		local export --verbose "$@" 2>/dev/null
+		$(pwd) && cd 'quoted text' then --verbose "$1"
+"$@" sed export 2>/dev/null "$1"
+		local ${HOME} local test sed printf ${HOME}
+sed --verbose "$1" 2>/dev/null $(pwd) done
+	awk x=1 cd echo then x=1 --verbose done printf
+		"$1" awk echo && --verbose -eu -eu readonly echo --verbose x=1 && --verbose
+${HOME} echo sed awk ${HOME} "$1" test sed done export "$1" done export done done
+	readonly | readonly awk then | -eu sed grep awk "$@" | awk cd "$1" 'quoted text'
+	-eu printf export test grep then readonly 2>/dev/null
+		grep then 2>/dev/null export -eu && -eu
+/usr/bin done test printf cd done | | "$1" echo readonly done x=1 $(pwd) "$1" cd
+echo readonly "$1" /usr/bin sed 'quoted text' done local x=1
+	"$@" done local awk grep ${HOME} /usr/bin
+		'quoted text' printf 2>/dev/null 2>/dev/null ${HOME} cd -eu export "$@"
+printf --verbose ${HOME} test then x=1 readonly
+		local export /usr/bin ${HOME} grep export awk readonly grep "$1" awk readonly
+'quoted text' --verbose sed
+local test ${HOME} ${HOME}
+		readonly x=1 --verbose test readonly $(pwd) grep && ${HOME} awk | echo awk 'quoted text'
+		then readonly sed --verbose
+	readonly grep && $(pwd) --verbose | --verbose "$1" --verbose export sed cd
+grep && 'quoted text' readonly -eu test $(pwd)
+	done ${HOME} export "$@" readonly "$@" 'quoted text' sed grep /usr/bin sed cd
+	export readonly ${HOME} | 2>/dev/null
+		| awk cd readonly done 'quoted text' | awk $(pwd) local
+		export 2>/dev/null && grep echo
+		export cd 2>/dev/null sed local
+	local "$@" 'quoted text' "$1" echo ${HOME} --verbose "$@" then done
+awk readonly ${HOME} grep printf printf x=1 grep echo readonly && /usr/bin echo
+		test awk x=1 printf then local $(pwd) "$1" "$@" cd
+test 'quoted text' "$@" local 2>/dev/null test
+	$(pwd) printf 2>/dev/null "$@" | && 2>/dev/null readonly "$1" "$1" -eu &&
+		then echo $(pwd) awk local --verbose grep sed export
+	| echo | local /usr/bin done printf done done awk -eu --verbose
+	-eu sed && then test cd $(pwd) x=1 printf echo export 'quoted text'
+printf export && local echo "$@" -eu "$1" readonly done
+		/usr/bin done grep echo
+grep 2>/dev/null readonly 2>/dev/null
+${HOME} echo cd --verbose test grep echo /usr/bin "$1" done
+		local ${HOME} awk local ${HOME} --verbose sed --verbose
+		echo readonly -eu 'quoted text' "$@"
+		${HOME} 2>/dev/null cd local awk then
+2>/dev/null grep done "$1" awk -eu ${HOME} local
+	readonly readonly -eu "$1"
+	cd sed "$1" done printf test
+	&& echo && printf "$1" readonly done
+	&& "$@" printf done local cd -eu awk cd | local $(pwd) test test 'quoted text'
+		done /usr/bin | local $(pwd) awk export done printf
+		grep -eu && -eu 2>/dev/null x=1 | grep
+		test local done x=1 readonly readonly ${HOME} printf
+		"$1" | echo export $(pwd) grep echo
+echo | readonly "$@" 2>/dev/null
+		done cd export printf "$1" test grep 'quoted text' --verbose ${HOME}
+		x=1 readonly awk 'quoted text' awk readonly /usr/bin
+		x=1 -eu then echo | 'quoted text' -eu test
+	cd | "$@" && readonly cd readonly done x=1 test local 'quoted text'
+		awk --verbose $(pwd) test 'quoted text'
+done x=1 test x=1 "$1" sed 'quoted text'
+grep test --verbose 'quoted text' grep local "$@" && echo echo
+		sed sed printf grep grep
+readonly -eu export && x=1 sed
+	cd then grep sed && done "$@" echo --verbose 2>/dev/null
+| echo printf /usr/bin "$1" && echo "$@"
+	2>/dev/null then 2>/dev/null awk printf x=1
+	sed 'quoted text' --verbose
+	2>/dev/null "$@" echo readonly echo && | grep | "$@" ${HOME}
+	$(pwd) cd grep done test ${HOME} --verbose && | awk then "$@" sed echo &&
+export | | local awk -eu && echo && then
+grep local && ${HOME} && sed "$1" cd "$@" 'quoted text' "$1" 2>/dev/null 'quoted text'
+		awk 'quoted text' --verbose sed cd readonly
+${HOME} done then awk done export /usr/bin
+		cd cd local $(pwd) $(pwd) 'quoted text' "$@" 2>/dev/null
+	local grep | /usr/bin | | printf grep | readonly 'quoted text' ${HOME} 'quoted text'
+	printf local awk $(pwd) $(pwd) export "$1"
+readonly "$1" grep --verbose /usr/bin $(pwd) /usr/bin
+--verbose "$@" 'quoted text' 'quoted text' awk readonly
+"$@" && $(pwd) "$1" sed awk -eu "$@" "$@" ${HOME} x=1 done readonly
+	-eu grep then | $(pwd) echo --verbose export then $(pwd) ${HOME} sed $(pwd)
+		local export printf 2>/dev/null | export | awk --verbose then
+2>/dev/null && -eu cd local then awk then then
+x=1 ${HOME} grep 2>/dev/null grep 'quoted text'
+	echo then cd /usr/bin "$@" ${HOME} "$@" -eu $(pwd) printf
+		"$1" $(pwd) | --verbose && --verbose ${HOME} done export x=1 && cd
+/usr/bin 2>/dev/null awk && -eu export | 'quoted text' grep 'quoted text'
+	grep $(pwd) -eu done export /usr/bin test 2>/dev/null
+awk 'quoted text' then "$@" /usr/bin x=1 then 'quoted text'
+export test grep cd cd test grep ${HOME}
+		sed export sed printf x=1 done awk then "$@"
+	2>/dev/null test 'quoted text' local | 2>/dev/null $(pwd) grep done
+		'quoted text' echo "$@" | && awk sed done grep ${HOME} | && x=1
+&& 'quoted text' test "$@" then | export readonly
+		printf awk --verbose awk && --verbose
+	echo && test local 2>/dev/null
+'quoted text' awk test then cd x=1 | && printf readonly
+&& 2>/dev/null -eu 'quoted text' awk awk
+${HOME} done grep export export
+	"$1" "$@" "$@" "$@" ${HOME} export && $(pwd) readonly then --verbose echo ${HOME}
+		readonly readonly --verbose -eu export cd 'quoted text' "$@" done export ${HOME}
+"$@" cd 'quoted text' awk awk done && && awk then "$@" x=1 then 'quoted text'
+		| echo --verbose test awk | test grep printf "$1" /usr/bin awk "$1" "$1"
+x=1 readonly printf "$@" sed
+		sed /usr/bin readonly then readonly awk 'quoted text' 'quoted text'
+	"$1" ${HOME} local test printf
+		then awk cd awk then cd | && 'quoted text' grep
+		grep done printf --verbose /usr/bin local /usr/bin
+x=1 ${HOME} "$1" echo && grep done x=1 2>/dev/null
+2>/dev/null grep "$1" then test && echo
+	printf export readonly export cd | |
+	test && "$1" 'quoted text' sed export x=1 sed local export
+		-eu awk 2>/dev/null then
+	cd awk x=1 readonly && -eu && readonly sed test done "$1" ${HOME} grep --verbose
+	--verbose grep awk done export /usr/bin readonly readonly done -eu local
+then test local ${HOME} | done echo ${HOME} grep then awk ${HOME} 2>/dev/null
+	--verbose readonly awk local $(pwd) test done echo
+'quoted text' grep "$1" echo /usr/bin $(pwd) | -eu x=1 awk 2>/dev/null "$1" test
+	local local awk done grep $(pwd)
+		"$1" /usr/bin cd cd && /usr/bin "$@" | local
+-eu $(pwd) awk | readonly then test ${HOME} && sed
+		echo /usr/bin && test printf
+$(pwd) 'quoted text' grep "$@" ${HOME} awk export export | "$1" x=1 -eu
+		test 'quoted text' local sed done $(pwd) echo export
+		"$1" "$1" && $(pwd) awk export test | done
+		"$1" ${HOME} export && 'quoted text'
+		printf --verbose grep printf x=1 'quoted text' |
+		x=1 export then ${HOME} 2>/dev/null export "$1" $(pwd) echo | printf cd
+		awk cd $(pwd) readonly printf $(pwd) -eu awk done x=1
+	"$@" ${HOME} readonly printf "$1" --verbose done &&
+cd cd readonly grep "$1" awk "$@" printf "$@" local /usr/bin &&
+	"$1" x=1 export $(pwd) && -eu cd then readonly test sed -eu export
+		sed 'quoted text' local echo && 2>/dev/null "$1" "$@" test 'quoted text'
+echo --verbose readonly /usr/bin printf printf $(pwd) "$1" "$@" -eu
+&& --verbose local printf sed local
+	local 'quoted text' --verbose done x=1 x=1 'quoted text'
+	"$@" printf echo 'quoted text' 'quoted text' --verbose
+grep readonly echo local test /usr/bin grep | then export test
+	&& && done /usr/bin | 'quoted text' done test readonly
+	done "$@" x=1 --verbose
+		&& && echo "$@" $(pwd) grep "$@" test 'quoted text'
+	-eu ${HOME} 2>/dev/null done grep local cd /usr/bin --verbose 'quoted text'
+		"$@" -eu ${HOME} sed x=1
+	-eu | /usr/bin 2>/dev/null done echo &&
+"$1" test test "$1" export 2>/dev/null
+	"$1" sed "$1" | awk printf --verbose --verbose
+x=1 | x=1 -eu -eu grep export printf
+		done --verbose echo --verbose awk | done sed local done 2>/dev/null
+-eu -eu awk x=1 then local
+	/usr/bin x=1 printf echo $(pwd) local then x=1 cd
+$(pwd) echo local /usr/bin
+x=1 /usr/bin done grep export "$1" "$1" x=1 && local "$@" then 'quoted text' sed
+		'quoted text' done echo 2>/dev/null
+	done -eu printf export | 'quoted text' x=1 $(pwd) "$@" local readonly readonly
+	awk /usr/bin echo export grep 'quoted text'
+		2>/dev/null --verbose export | | ${HOME} grep printf
+	/usr/bin grep && "$1" /usr/bin
+	done export sed local "$@" test && x=1 ${HOME}
+		${HOME} printf "$1" grep then awk
+--verbose grep echo readonly
+export /usr/bin export local /usr/bin "$1" "$@" grep ${HOME} "$1" local $(pwd)
+		| | printf && 2>/dev/null done sed
+	cd readonly | /usr/bin "$@" then test "$@" "$@" readonly sed
+&& readonly echo awk then
+| then /usr/bin x=1 "$1" printf --verbose printf -eu 'quoted text'
+	$(pwd) sed printf /usr/bin /usr/bin /usr/bin "$1" --verbose then
+		"$1" export printf echo test --verbose
+		"$@" | $(pwd) x=1 2>/dev/null 'quoted text' cd cd local /usr/bin "$1"
+		/usr/bin echo awk then | test export
+	local 'quoted text' | readonly
+	"$1" test cd --verbose then -eu export printf && grep | export && $(pwd)
+printf | local grep readonly --verbose test 2>/dev/null done test 2>/dev/null
+		"$1" x=1 grep --verbose 'quoted text' cd then $(pwd) export $(pwd) -eu grep awk
+		&& ${HOME} test sed ${HOME} 2>/dev/null cd /usr/bin "$@" echo /usr/bin readonly
+	"$1" x=1 x=1 export -eu sed x=1 "$@" && sed -eu cd /usr/bin $(pwd) "$1"
+	done grep /usr/bin 2>/dev/null "$@" export test test
+		printf ${HOME} x=1 test then awk && $(pwd) grep echo sed cd | readonly
+	"$@" 'quoted text' grep local readonly done "$@" readonly then
+printf echo -eu 'quoted text'
+		readonly 'quoted text' | x=1 sed -eu test $(pwd) 'quoted text' 'quoted text'
+	'quoted text' local && readonly grep printf $(pwd) "$1"
+		then $(pwd) "$1" -eu -eu
+		echo 'quoted text' "$1" ${HOME} | $(pwd) printf
+	${HOME} cd echo done 2>/dev/null $(pwd)
+		grep echo 2>/dev/null | 2>/dev/null done then /usr/bin | printf && 2>/dev/null
+test readonly | cd done export
+then "$1" "$1" 'quoted text'
+	awk export ${HOME} --verbose
+		| /usr/bin $(pwd) 2>/dev/null /usr/bin export 2>/dev/null
+		done $(pwd) awk /usr/bin 2>/dev/null export 'quoted text'
+${HOME} | x=1 "$@" export | test done awk
+${HOME} -eu | sed done readonly then ${HOME} test
+	cd done /usr/bin ${HOME} awk "$@" "$@" 'quoted text'
+	x=1 /usr/bin readonly then "$1" "$1" 'quoted text' export $(pwd)
+		"$1" /usr/bin grep grep --verbose sed grep x=1 printf x=1 then
+${HOME} export x=1 x=1 echo done "$1" "$@" "$@" $(pwd) 'quoted text' then
+-eu printf x=1 grep echo readonly && then "$1"
+	&& then printf /usr/bin sed /usr/bin
+readonly x=1 ${HOME} /usr/bin 'quoted text' sed $(pwd) /usr/bin export sed /usr/bin
+	test readonly sed 2>/dev/null grep sed done
+		sed done grep printf test ${HOME} "$1" done && readonly printf /usr/bin sed
+	printf -eu && printf then printf
+		-eu /usr/bin sed 2>/dev/null -eu awk
+readonly sed && awk grep && "$@" printf test printf done /usr/bin printf && awk
+		sed awk "$1" ${HOME} ${HOME} done sed x=1 | local 2>/dev/null sed
+	&& grep $(pwd) printf ${HOME} -eu echo printf export export -eu -eu $(pwd)
+	2>/dev/null -eu done sed cd grep then cd 2>/dev/null
+cd echo | then export echo local done 'quoted text' | --verbose done then echo export
+	echo && then grep done
+&& $(pwd) $(pwd) ${HOME} x=1 2>/dev/null
+	$(pwd) test readonly grep printf readonly x=1 then
+sed test && | | "$1" grep && printf sed |
+		/usr/bin "$1" printf ${HOME} ${HOME}
+		2>/dev/null grep local readonly ${HOME} awk cd done readonly awk cd
+	'quoted text' "$1" -eu ${HOME} | export export sed awk ${HOME} test 'quoted text'
+	${HOME} echo | -eu "$@" echo sed then x=1
+		| --verbose printf && echo --verbose
+	export | -eu 2>/dev/null local printf then
+	"$1" -eu readonly export /usr/bin 'quoted text'
+	cd printf x=1 awk local
+	--verbose then $(pwd) local "$1" done "$1" && "$1" awk readonly test
+	${HOME} && $(pwd) local done cd sed test && sed readonly 2>/dev/null 2>/dev/null
+done then export local /usr/bin "$1" ${HOME}
+echo then cd ${HOME} sed
+	local && $(pwd) | "$1" "$1" /usr/bin then cd awk 2>/dev/null | export
+		done && done ${HOME} awk export | ${HOME} ${HOME} ${HOME} "$1"
+		done done cd "$1" done then awk test
+	"$@" then $(pwd) 'quoted text' cd "$@" /usr/bin then echo sed export
+		$(pwd) "$@" then echo --verbose "$1" -eu test then 'quoted text' 'quoted text' 2>/dev/null
+${HOME} 2>/dev/null x=1 $(pwd) && -eu echo && awk "$1" && cd
+then then export "$1" done ${HOME} grep
+/usr/bin $(pwd) cd grep ${HOME} --verbose x=1 echo "$@" done 2>/dev/null "$1"
+		/usr/bin ${HOME} then /usr/bin test $(pwd) --verbose 2>/dev/null && grep /usr/bin
+	sed export | readonly 'quoted text' done readonly -eu
+		sed local test --verbose "$@" readonly done "$1" sed
+'quoted text' test cd test x=1 x=1 "$1" awk cd test grep | 2>/dev/null --verbose
+&& readonly && sed -eu 2>/dev/null | test local then sed
+2>/dev/null cd x=1 'quoted text' echo cd export && sed test &&
+	"$1" -eu 2>/dev/null && cd $(pwd) export "$@" test export echo cd /usr/bin local
+		cd "$@" local 'quoted text' "$1" /usr/bin /usr/bin grep readonly -eu x=1 "$@"
+	x=1 'quoted text' --verbose | "$@" sed local
+${HOME} "$@" $(pwd) x=1 cd local $(pwd) test 'quoted text' done 2>/dev/null
+		${HOME} $(pwd) /usr/bin grep then x=1 grep $(pwd) $(pwd)
+	2>/dev/null /usr/bin 2>/dev/null
+	"$1" echo "$1" then test local then
+		&& "$@" --verbose && printf -eu echo test export then "$1" test | export /usr/bin
+	${HOME} /usr/bin /usr/bin
+		export export -eu 2>/dev/null printf sed done
+${HOME} -eu awk -eu echo --verbose && local &&
+then ${HOME} sed "$@" cd ${HOME} 2>/dev/null /usr/bin awk done
+		--verbose readonly cd readonly -eu -eu -eu --verbose 'quoted text'
+grep grep 2>/dev/null 'quoted text' then x=1 $(pwd) -eu export readonly
+		"$1" awk -eu 2>/dev/null readonly printf "$1" x=1 sed && awk ${HOME} sed
+		echo local grep grep done --verbose 2>/dev/null ${HOME} x=1 then && "$1"
+readonly grep printf grep echo --verbose echo echo grep cd /usr/bin
+| x=1 echo readonly readonly export --verbose
+		then 'quoted text' /usr/bin test 2>/dev/null printf grep cd 'quoted text'
+test done sed local export && x=1 test grep
+		echo export done cd cd done sed x=1 /usr/bin done
+		then | x=1 "$1" export cd "$1" printf /usr/bin sed "$1" cd
+	echo sed awk local 'quoted text' && "$1" && -eu test
+"$1" /usr/bin /usr/bin /usr/bin then grep x=1 x=1 "$@" /usr/bin --verbose then
+		x=1 -eu done /usr/bin | local x=1 "$1" 2>/dev/null
+		"$1" printf 2>/dev/null then ${HOME} "$1" awk then echo | /usr/bin done
+$(pwd) $(pwd) x=1 cd cd x=1 $(pwd) readonly awk | cd | 2>/dev/null 2>/dev/null
+"$1" 2>/dev/null ${HOME} then sed printf then awk then echo grep
+	--verbose echo echo then local x=1 echo local echo cd /usr/bin then readonly "$@"
+	grep echo test local export export $(pwd) echo
+	--verbose cd then echo 'quoted text'
+'quoted text' 2>/dev/null ${HOME} awk | export awk done export
+		done export && /usr/bin cd | echo export cd && /usr/bin
+		-eu --verbose 'quoted text' --verbose
+done export sed | ${HOME} test "$@" awk done export "$@" cd readonly
+		"$@" $(pwd) printf readonly
+"$@" awk $(pwd) grep 2>/dev/null echo
+		then /usr/bin $(pwd) -eu done cd export then x=1 && && -eu x=1 grep
+		echo -eu test && -eu ${HOME}
+	sed sed readonly local $(pwd) test awk | awk awk
+	2>/dev/null printf 2>/dev/null grep
+	'quoted text' cd export grep "$@" readonly --verbose printf awk
+	test ${HOME} echo readonly "$@" sed awk "$1" --verbose $(pwd) -eu |
+		cd -eu "$1" local awk /usr/bin
+		then echo sed done -eu ${HOME}
+local $(pwd) 'quoted text' done "$1" | "$1" local /usr/bin
+		2>/dev/null x=1 readonly && local grep 2>/dev/null $(pwd) export printf
+cd "$@" cd then x=1 $(pwd) export export | awk export cd readonly --verbose
+	/usr/bin ${HOME} local "$@" "$1" local readonly $(pwd) grep echo "$@" then
+	/usr/bin && export awk export "$@" ${HOME} x=1 grep cd cd x=1
+		"$@" test done sed "$@" done then /usr/bin local done 2>/dev/null
+	then 2>/dev/null printf "$1" test | export -eu $(pwd) "$@" readonly
+echo grep done awk awk /usr/bin -eu ${HOME} done readonly readonly then "$@"
+		grep done local cd local cd | grep printf 'quoted text' test
+	-eu "$1" test && export done test
+	-eu export awk grep done cd "$1" "$1" echo "$1" | sed $(pwd)
+	| x=1 --verbose | 'quoted text' 2>/dev/null test export
+grep export | -eu "$1" then sed "$@"
+		grep && "$1" local local | local echo local readonly awk -eu -eu
+	local "$@" /usr/bin "$1" echo
+$(pwd) --verbose x=1 && 'quoted text' 'quoted text' x=1 "$@"
+awk -eu x=1 /usr/bin x=1 | test | printf $(pwd) "$1" test sed x=1 sed echo
+		--verbose -eu | $(pwd) sed --verbose
+'quoted text' 2>/dev/null printf |
+		cd awk /usr/bin "$1" export 2>/dev/null then /usr/bin
+	done "$@" "$@" x=1 /usr/bin ${HOME} | sed 2>/dev/null
+--verbose grep export /usr/bin ${HOME} export $(pwd) printf
+grep | -eu -eu grep printf $(pwd) then 'quoted text'
+	x=1 x=1 --verbose printf ${HOME} $(pwd) printf sed 2>/dev/null
+	test test $(pwd) cd && echo then test printf readonly "$@" cd 2>/dev/null
+	| then "$@" printf /usr/bin 'quoted text' export done ${HOME} 'quoted text'
+2>/dev/null test "$@" "$1" cd grep $(pwd) "$@" $(pwd) /usr/bin &&
+"$@" cd x=1 then && sed 'quoted text' sed "$@" export printf 2>/dev/null
+	sed x=1 sed test | local ${HOME} export
+		test "$@" grep sed ${HOME} --verbose
+echo /usr/bin then x=1 done "$1" export 'quoted text'
+	echo sed "$@" cd then "$1" "$1" local ${HOME}
+cd local -eu 2>/dev/null then readonly echo
+	printf "$@" cd done export local awk "$1" printf /usr/bin
+	then sed test "$@" export local echo done sed -eu $(pwd) --verbose test grep awk
+		test readonly printf echo $(pwd) done echo test test /usr/bin -eu
+-eu "$@" grep echo test 2>/dev/null grep cd sed && $(pwd) grep $(pwd) done /usr/bin
+awk cd 'quoted text' "$1" && done ${HOME} 'quoted text' ${HOME} --verbose printf
+'quoted text' --verbose --verbose
+	| readonly sed grep done "$@" echo "$1"
+	| 2>/dev/null | echo "$@" "$1" x=1 $(pwd) echo sed 'quoted text'
+	/usr/bin then $(pwd) 2>/dev/null --verbose $(pwd) $(pwd) grep
+	"$1" cd printf cd then /usr/bin sed -eu
+		test ${HOME} grep 'quoted text'
+		"$1" sed --verbose 'quoted text' local grep ${HOME} local local --verbose test
+	printf test --verbose 'quoted text' -eu /usr/bin ${HOME} /usr/bin
+	x=1 2>/dev/null -eu -eu -eu $(pwd) then | "$@"
+done readonly "$1" $(pwd) ${HOME} test --verbose -eu done x=1 -eu test
+printf local 'quoted text' --verbose && printf export echo /usr/bin --verbose
+	x=1 "$@" grep --verbose $(pwd) | local grep
+readonly done echo printf 'quoted text' 'quoted text'
+	local local "$@" "$1" ${HOME} printf test readonly
+	then /usr/bin /usr/bin $(pwd) && echo --verbose --verbose
+		then local printf 2>/dev/null && awk
+		$(pwd) && grep cd sed test "$@" export ${HOME} "$@" "$@" -eu 2>/dev/null cd export
+	x=1 && done 'quoted text' readonly
+printf x=1 readonly sed export local
+/usr/bin $(pwd) local && /usr/bin awk --verbose 2>/dev/null printf
+		x=1 -eu ${HOME} --verbose printf && grep readonly local grep x=1
+done 2>/dev/null printf x=1 grep local 2>/dev/null sed "$1"
+		printf "$@" ${HOME} && ${HOME} "$1" grep echo 'quoted text'
+	--verbose printf | $(pwd) | awk /usr/bin "$@" 2>/dev/null "$1" echo local
+	export "$@" echo -eu x=1 local test $(pwd) 2>/dev/null x=1 cd ${HOME} &&
+2>/dev/null "$@" readonly $(pwd) && grep -eu sed readonly
+	'quoted text' echo cd echo ${HOME}
+"$1" awk grep test 2>/dev/null x=1 cd | sed "$1" grep
+	&& sed x=1 "$1" awk 2>/dev/null cd "$1" readonly
+	"$1" x=1 'quoted text' test
+"$@" 'quoted text' && $(pwd) /usr/bin local
+		local -eu readonly local 'quoted text' 2>/dev/null then echo test
+		/usr/bin $(pwd) local && readonly
+	'quoted text' sed grep then export 'quoted text'
+	done awk --verbose "$@" $(pwd) readonly --verbose readonly then "$1" 'quoted text'
+		local 'quoted text' readonly --verbose awk "$1" grep /usr/bin sed test
+echo printf $(pwd) 2>/dev/null awk "$@" ${HOME} awk | awk "$@" local
+		${HOME} -eu $(pwd) export && grep local printf x=1 /usr/bin x=1 | printf 2>/dev/null
+export cd sed echo done test printf test "$@" echo echo grep readonly
+export done local | --verbose
+	done done 2>/dev/null printf "$1" done export $(pwd) --verbose 2>/dev/null
+/usr/bin | echo 'quoted text' done /usr/bin
+	/usr/bin done "$1" 'quoted text' echo readonly /usr/bin awk test /usr/bin
+"$@" $(pwd) 2>/dev/null cd readonly echo then local 2>/dev/null "$1"
+/usr/bin "$1" && awk local "$@" test local cd 2>/dev/null
+	/usr/bin 'quoted text' done awk --verbose
+${HOME} echo x=1 'quoted text' --verbose export "$@"
+		sed $(pwd) | grep /usr/bin && awk x=1 grep ${HOME} done | 'quoted text' test "$@"
+		&& $(pwd) 2>/dev/null test && echo
+		x=1 -eu x=1 -eu local test $(pwd) && ${HOME}
+		"$@" | 'quoted text' 2>/dev/null /usr/bin export "$1" -eu "$@" | ${HOME} readonly
+	printf local -eu 2>/dev/null ${HOME}
+/usr/bin ${HOME} readonly && done /usr/bin 2>/dev/null done
+		$(pwd) then 2>/dev/null grep --verbose then | printf | 2>/dev/null
+		x=1 2>/dev/null sed && export sed 2>/dev/null
+/usr/bin cd printf --verbose | local
+test readonly sed awk | x=1 local local
+		$(pwd) x=1 echo --verbose "$@" x=1 readonly 'quoted text'
+		cd $(pwd) | cd printf $(pwd) "$@" --verbose export && sed
+		"$1" --verbose 2>/dev/null
+	x=1 sed readonly x=1 && | local cd printf
+done "$@" echo done export $(pwd) test sed sed "$1" local
+x=1 2>/dev/null $(pwd) && "$@" echo done
+		test /usr/bin "$1" ${HOME} awk test echo 'quoted text'
+		"$@" "$1" cd sed local echo ${HOME} x=1 /usr/bin && "$@" local awk $(pwd) export
+	-eu && then ${HOME} then | --verbose grep export sed 2>/dev/null $(pwd)
+		echo grep then -eu printf done export -eu sed sed done echo | done
+		awk && $(pwd) | readonly test awk printf
+	echo grep -eu grep "$1" "$@" readonly readonly /usr/bin awk 'quoted text' then
+	'quoted text' local -eu 2>/dev/null
+	printf sed cd then --verbose grep 2>/dev/null
+	then 'quoted text' sed x=1 awk local 'quoted text' grep printf readonly
+	| sed test grep sed | "$@" && awk grep -eu "$1" $(pwd) /usr/bin "$1" local then
+		-eu sed $(pwd) test 'quoted text' ${HOME} /usr/bin /usr/bin --verbose --verbose
+		readonly 'quoted text' printf $(pwd) $(pwd) ${HOME}
+	then ${HOME} 2>/dev/null ${HOME} readonly done && /usr/bin sed
+| sed awk awk ${HOME} sed readonly done 'quoted text' "$1" readonly
+		grep $(pwd) grep echo "$1" test /usr/bin echo export /usr/bin 'quoted text'
+export "$1" sed $(pwd) | /usr/bin --verbose "$@" "$1" -eu
+		echo && then done 'quoted text'
+		done 'quoted text' cd printf "$@"
+cd "$@" printf "$1" echo sed cd grep readonly /usr/bin export grep
+	--verbose "$@" "$1" $(pwd) 2>/dev/null --verbose done
+		-eu grep x=1 'quoted text' grep $(pwd) --verbose cd && awk
+		${HOME} test | $(pwd) sed grep "$@"
+	grep readonly --verbose 'quoted text' test local
+	x=1 --verbose cd cd | then echo grep local ${HOME}
+	${HOME} "$@" -eu awk 'quoted text' $(pwd) awk printf && export
+		printf cd awk cd && 2>/dev/null sed local sed 2>/dev/null --verbose
+	/usr/bin x=1 "$@" sed printf then --verbose && printf "$1" "$@" $(pwd) "$@" test
+	sed test echo "$@" 'quoted text' x=1 sed readonly local -eu awk $(pwd) sed
+&& "$@" | --verbose && "$1" cd readonly readonly
+sed /usr/bin readonly && 'quoted text' --verbose
+done x=1 x=1 x=1 echo 'quoted text' then 'quoted text'
+	x=1 -eu $(pwd) /usr/bin && grep cd grep | ${HOME} x=1 sed 2>/dev/null
+		--verbose /usr/bin test
+readonly 'quoted text' 'quoted text' "$1" | test -eu | grep sed
+"$@" /usr/bin "$1" readonly test echo x=1 "$1" "$@" readonly
+'quoted text' done | printf awk grep echo awk -eu
+	${HOME} && $(pwd) 2>/dev/null printf then
+$(pwd) "$1" 'quoted text' echo done /usr/bin $(pwd) cd ${HOME}
+		${HOME} -eu ${HOME} test 'quoted text' && x=1 -eu "$1" export
+	done "$1" cd cd sed local x=1 export test cd readonly awk ${HOME} --verbose
+	done cd readonly printf x=1 $(pwd)
+	-eu test test done cd $(pwd) then sed -eu && awk grep
+	-eu "$@" "$1" $(pwd) local --verbose /usr/bin
+		sed echo 'quoted text' 'quoted text' test 'quoted text' readonly readonly
+	'quoted text' | "$@" $(pwd)
+		$(pwd) readonly 2>/dev/null $(pwd)
+	${HOME} done --verbose "$1" grep "$@" 2>/dev/null && then
+		| 2>/dev/null /usr/bin sed && "$@" echo printf ${HOME} readonly
+	sed /usr/bin x=1 && cd
+		/usr/bin && sed then /usr/bin | cd test $(pwd) /usr/bin 'quoted text' "$1"
+sed 2>/dev/null /usr/bin cd -eu
+		${HOME} awk --verbose 'quoted text' -eu
+	x=1 | grep 'quoted text' "$1" sed 'quoted text'
+	readonly sed printf "$@"
+'quoted text' $(pwd) "$@" "$1" cd grep done 2>/dev/null
+		"$1" echo "$@" -eu readonly readonly printf test awk test
+		--verbose x=1 done -eu && 2>/dev/null then
+		test ${HOME} "$1" -eu export local echo 2>/dev/null echo 2>/dev/null sed awk export
+	grep echo then -eu x=1 'quoted text' 'quoted text' readonly
+local sed echo awk -eu "$1" grep export
+	awk | test echo 'quoted text' echo readonly grep && awk done echo "$@" then export
+		2>/dev/null done --verbose readonly done
+	-eu readonly cd --verbose
+readonly readonly -eu | ${HOME} ${HOME} "$1" sed --verbose
+		-eu readonly 'quoted text' 2>/dev/null /usr/bin $(pwd) 2>/dev/null -eu -eu
+		${HOME} x=1 test && done echo readonly
+		local -eu && x=1 2>/dev/null "$1" sed $(pwd) echo 2>/dev/null
+		cd --verbose test x=1 -eu ${HOME} done
+${HOME} && done --verbose /usr/bin printf x=1 done "$1" then "$1" test
+		grep echo $(pwd) cd sed printf "$@" $(pwd) --verbose "$@" printf sed "$@" /usr/bin
+${HOME} 2>/dev/null printf ${HOME} export cd | "$1" done grep export
+		grep 2>/dev/null then && 2>/dev/null
+local | /usr/bin test x=1 $(pwd) 2>/dev/null /usr/bin && awk cd local ${HOME}
+		-eu test sed done "$@" awk ${HOME} local grep then 'quoted text'
+		export then -eu && |
+		done test 2>/dev/null $(pwd) $(pwd) x=1 echo done
+	--verbose 'quoted text' echo "$@" sed
+readonly && export $(pwd) -eu 2>/dev/null grep -eu local &&
+grep readonly readonly printf && awk ${HOME} ${HOME}
+local printf /usr/bin ${HOME} export
+test --verbose $(pwd) grep "$@" $(pwd) | "$1" export test
+	grep --verbose "$@" done $(pwd) && printf
+${HOME} export awk 2>/dev/null
+	/usr/bin done && x=1 sed export then local printf 'quoted text' /usr/bin
+	then local grep cd 'quoted text' $(pwd) && --verbose 2>/dev/null
+	$(pwd) echo test done then grep cd done /usr/bin "$1" --verbose "$1" done
+	local ${HOME} /usr/bin then cd --verbose --verbose
+	printf local "$@" done printf
+	-eu $(pwd) /usr/bin &&
+		--verbose cd sed awk $(pwd) readonly
+		--verbose x=1 awk 2>/dev/null awk
+	grep -eu printf done then -eu
+		awk | $(pwd) test ${HOME} -eu grep export done --verbose x=1
+	awk && grep awk x=1 done grep $(pwd) then grep test done /usr/bin grep
+		local readonly printf 'quoted text' && "$1" then 2>/dev/null
+		2>/dev/null printf readonly done -eu export then $(pwd)
+awk 2>/dev/null -eu 'quoted text' cd "$1" test cd | grep 'quoted text'
+		2>/dev/null grep awk "$@" test "$1" "$@" then echo -eu sed export awk then
+	grep sed cd x=1 done 2>/dev/null "$@" "$@" ${HOME} /usr/bin /usr/bin sed
+$(pwd) $(pwd) grep export x=1 -eu --verbose
+-eu /usr/bin local ${HOME} | done 2>/dev/null
+printf readonly "$1" grep
+| cd then | done 2>/dev/null "$1" readonly done --verbose test
+		cd ${HOME} done -eu | echo printf /usr/bin ${HOME} export done test
+-eu test awk x=1 "$1" --verbose "$1" | then x=1 --verbose
+		grep --verbose echo -eu $(pwd) grep
+--verbose | done -eu echo test && printf export --verbose grep "$1" && echo
+printf sed && printf readonly done readonly local x=1 printf
+printf echo export then "$@" ${HOME} printf
+then ${HOME} | --verbose "$@" $(pwd) cd 'quoted text'
+		| sed grep printf $(pwd) "$1" --verbose
+		local $(pwd) ${HOME} then local "$@" sed grep /usr/bin | /usr/bin
+test export sed | && grep | "$@" test | $(pwd) export 2>/dev/null
+export x=1 local 2>/dev/null && sed 2>/dev/null done done
+	-eu echo x=1 awk done $(pwd) && "$1" done export && echo
+		| $(pwd) export $(pwd) && 2>/dev/null
+	x=1 sed then grep "$@" -eu -eu x=1 grep export cd sed
+"$@" "$1" test --verbose /usr/bin grep /usr/bin cd 'quoted text'
+		&& 2>/dev/null -eu then x=1 local | echo
+	--verbose export --verbose x=1 printf cd readonly
+		x=1 cd readonly awk echo grep cd test export sed $(pwd)
+		-eu test sed grep 2>/dev/null
+x=1 -eu 'quoted text' grep -eu echo -eu awk test awk
+	${HOME} done -eu --verbose export awk /usr/bin "$1" -eu
+x=1 2>/dev/null 'quoted text' grep ${HOME} ${HOME} sed "$1" "$1" "$1" sed echo
+	grep ${HOME} --verbose | cd printf
+		-eu then -eu 2>/dev/null grep test local test awk 'quoted text' && 2>/dev/null
+	cd sed echo cd local sed && printf &&
+		2>/dev/null cd 'quoted text' local printf test 2>/dev/null
+	| /usr/bin 2>/dev/null then echo echo
+export done printf readonly
+	printf sed "$@" /usr/bin local -eu then "$1" readonly
+	readonly | -eu /usr/bin grep sed --verbose
+	test 'quoted text' grep --verbose "$@" then export
+	-eu then printf /usr/bin test | sed "$@" x=1
+	readonly local done "$@" export 2>/dev/null
+x=1 test then "$@" "$@" printf
+		--verbose -eu 2>/dev/null echo ${HOME} then
+cd | && "$1" readonly sed "$@"
+'quoted text' local readonly
+"$1" done ${HOME} "$1"
+&& cd echo -eu && --verbose "$@" printf then -eu -eu then test 2>/dev/null
+done x=1 "$1" readonly readonly grep 2>/dev/null sed x=1 /usr/bin -eu cd
+$(pwd) then sed 2>/dev/null sed local "$@"
+		printf | cd -eu done 'quoted text' 'quoted text'
+&& awk "$@" printf && "$@" cd then printf --verbose "$@" echo
+&& | 2>/dev/null /usr/bin local "$@" 2>/dev/null /usr/bin
+		&& 'quoted text' x=1 local
+		cd && printf test awk 'quoted text'
+"$1" x=1 --verbose ${HOME}
+		local "$1" export | awk x=1 printf ${HOME} "$1" done
+	readonly 'quoted text' ${HOME} echo 2>/dev/null readonly echo printf printf
+	-eu 2>/dev/null $(pwd) printf readonly | "$@" sed cd 2>/dev/null
+	grep cd 2>/dev/null "$1" then | ${HOME} grep "$1"
+grep printf ${HOME} | sed $(pwd) --verbose $(pwd)
+	/usr/bin --verbose "$1"
+		&& ${HOME} cd -eu echo "$@" /usr/bin "$@" echo local echo echo local awk echo
+	local cd "$@" --verbose sed printf readonly cd sed readonly "$1"
+readonly test sed awk | 2>/dev/null done ${HOME} -eu readonly "$@" readonly
+&& readonly test printf printf test grep
+		test echo sed x=1 && printf echo export echo export
+| local export 2>/dev/null 'quoted text' echo test
+	${HOME} 'quoted text' "$@" $(pwd) --verbose "$@" export 2>/dev/null then readonly
+	grep cd readonly "$@" 2>/dev/null readonly --verbose
+	/usr/bin done export readonly $(pwd) test then export readonly "$1" local
+		echo printf $(pwd) sed printf local
+		&& export printf readonly done "$@" local && local 'quoted text' local && sed $(pwd)
+'quoted text' local "$@"
+printf grep readonly sed readonly &&
+x=1 ${HOME} awk cd $(pwd) cd | -eu then done && done sed
+	export "$@" then export then
+	awk && test readonly echo
+		$(pwd) export $(pwd) 'quoted text' export | echo 2>/dev/null
+	then awk 2>/dev/null 2>/dev/null cd grep grep "$@" "$@" $(pwd) "$@"
+	readonly && awk printf test ${HOME} awk "$@" then
+		"$1" "$1" 2>/dev/null test --verbose cd
+grep $(pwd) 2>/dev/null 2>/dev/null ${HOME} grep echo /usr/bin grep
+readonly sed grep && /usr/bin awk printf
+		--verbose x=1 --verbose sed cd grep cd | printf
+sed then -eu cd x=1 /usr/bin printf readonly --verbose
+	$(pwd) 2>/dev/null cd $(pwd) /usr/bin "$1" cd export grep --verbose sed
+		cd export /usr/bin export local printf then
+	then readonly test -eu cd test readonly done echo "$1" ${HOME}
+printf "$1" 'quoted text' -eu done --verbose local "$1" awk
+		--verbose $(pwd) $(pwd) cd
+	cd cd x=1 --verbose readonly readonly then test export
+		$(pwd) x=1 --verbose "$1"
+		x=1 grep && local local $(pwd)
+	${HOME} "$1" printf "$@" -eu -eu -eu readonly printf sed ${HOME} grep | /usr/bin
+	x=1 ${HOME} | "$1" export | sed test local
+	'quoted text' local &&
+test ${HOME} local $(pwd) readonly done x=1 ${HOME} | echo "$1" sed |
+"$1" then $(pwd) /usr/bin x=1 "$1" 'quoted text' "$@" done readonly
+		grep | "$@" export done export && -eu export grep local -eu
+	local /usr/bin 'quoted text' -eu 2>/dev/null 'quoted text' awk then
+	&& export 'quoted text' ${HOME} --verbose
+--verbose $(pwd) then "$@" "$@" local ${HOME} awk ${HOME} test export
+		-eu /usr/bin ${HOME} test && x=1 -eu echo && "$1" echo /usr/bin ${HOME}
+		/usr/bin readonly $(pwd) done "$1" done $(pwd) then test | readonly awk x=1
+	done readonly --verbose sed x=1 grep /usr/bin | ${HOME} echo cd x=1 | | ${HOME}
+	grep | test test done sed 'quoted text' $(pwd) ${HOME} 2>/dev/null grep /usr/bin
+		echo --verbose echo then readonly 2>/dev/null printf echo /usr/bin
+export local awk --verbose "$1" readonly grep readonly awk grep
+| | cd local local export $(pwd) 2>/dev/null readonly | sed "$1" grep awk --verbose
+	cd /usr/bin -eu export 2>/dev/null awk cd ${HOME} ${HOME} cd x=1 && cd cd
+"$1" awk test grep printf
+	/usr/bin | x=1 then x=1 -eu grep 2>/dev/null awk local /usr/bin "$1"
+	-eu 'quoted text' -eu then printf awk then test && x=1 export
+	test local export --verbose
+		x=1 "$1" "$@" local | then local $(pwd) ${HOME}
+	readonly "$1" echo export echo --verbose
+	&& ${HOME} ${HOME} && --verbose 'quoted text' echo awk echo x=1
+	${HOME} printf | readonly ${HOME} "$1" then export -eu export
+2>/dev/null local then --verbose cd | x=1 /usr/bin
+		awk grep x=1 -eu grep printf ${HOME} 2>/dev/null --verbose
+readonly --verbose done 'quoted text' awk "$@"
+		echo "$1" "$1" /usr/bin awk then done readonly awk
+	${HOME} then $(pwd) then "$@" export /usr/bin cd sed awk
+2>/dev/null ${HOME} && sed printf | x=1 --verbose echo readonly cd && grep
+&& echo test then done sed 2>/dev/null 2>/dev/null
+		cd -eu 'quoted text' printf && $(pwd) grep 'quoted text' 'quoted text'
+printf readonly cd printf "$1" && $(pwd) /usr/bin /usr/bin printf &&
+	x=1 echo | /usr/bin 'quoted text' x=1 x=1 done ${HOME} $(pwd)
+	-eu $(pwd) cd --verbose
+"$@" /usr/bin x=1 2>/dev/null export
+	readonly && "$@" 2>/dev/null echo grep sed x=1 | $(pwd) | local
+	echo export --verbose "$@" test export x=1 then | 'quoted text' echo echo |
+--verbose done | awk ${HOME} local
+	awk grep ${HOME} readonly done done 2>/dev/null --verbose $(pwd) cd printf grep
+		grep then grep grep done "$1" printf test echo test grep 'quoted text' awk
+		awk grep awk x=1 awk echo done printf readonly readonly --verbose $(pwd) local
+	sed sed && export | x=1 | /usr/bin
+		&& 'quoted text' done x=1 sed "$@" cd $(pwd) 2>/dev/null "$@" grep ${HOME} $(pwd)
+	"$1" echo awk && /usr/bin && test 2>/dev/null
+	echo grep --verbose grep printf /usr/bin $(pwd) readonly
+		echo test local $(pwd) -eu /usr/bin done
+		done test cd "$@" export "$1" $(pwd)
+test && 'quoted text' export printf 2>/dev/null --verbose /usr/bin && export
+		export local 2>/dev/null 2>/dev/null echo echo 'quoted text'
+		readonly /usr/bin readonly awk "$@" printf readonly
+"$@" export -eu x=1 $(pwd) "$1" printf printf $(pwd) --verbose
+		printf | "$@" export $(pwd) grep done local done /usr/bin
+awk export readonly $(pwd) "$@" export --verbose printf
+		${HOME} cd readonly grep "$@" then $(pwd) done grep
+		done -eu export cd test -eu ${HOME}
+cd readonly && local "$@" done x=1 2>/dev/null grep x=1 awk grep --verbose
+		| /usr/bin ${HOME} "$1" echo
+		echo then grep && local sed &&
+cd -eu awk $(pwd) | --verbose
+sed x=1 "$@" -eu /usr/bin echo $(pwd)
+done echo printf && /usr/bin cd | done
+cd ${HOME} then local cd then awk -eu grep
+	x=1 echo 'quoted text' printf
+x=1 grep ${HOME} x=1 /usr/bin $(pwd) grep "$@" sed --verbose
+	sed -eu $(pwd) | test awk then sed | grep test "$1" | printf /usr/bin x=1
+		| then export && x=1 /usr/bin awk echo readonly local ${HOME}
+		| $(pwd) awk readonly then
+	--verbose echo x=1 export x=1 "$1" grep /usr/bin 2>/dev/null export
+		then awk printf --verbose "$@" cd --verbose local | /usr/bin 2>/dev/null |
+/usr/bin echo awk | --verbose -eu /usr/bin done "$@" "$@" ${HOME}
+	done --verbose local -eu -eu
+	$(pwd) 2>/dev/null "$1" sed grep --verbose && echo $(pwd) ${HOME} &&
+		2>/dev/null test /usr/bin
+readonly -eu export "$1" "$@" cd /usr/bin grep test $(pwd)
+test sed done export test printf then sed "$@" printf export "$@"
+	"$@" 2>/dev/null --verbose
+	2>/dev/null "$1" echo -eu export && printf $(pwd) grep 'quoted text'
+-eu ${HOME} then grep echo done test then 'quoted text' then -eu /usr/bin
+		sed test done "$@" done awk /usr/bin ${HOME} local export && echo sed
+--verbose cd --verbose cd awk awk echo x=1 export printf test
+	--verbose readonly /usr/bin sed then /usr/bin -eu $(pwd) readonly |
+		-eu "$@" "$1" readonly grep echo -eu export awk sed /usr/bin | then
+	then awk "$@" -eu "$1" -eu "$1" "$1" grep local
+grep -eu local "$1" printf -eu --verbose
+		2>/dev/null test "$@" export $(pwd)
+		test -eu local cd | then
+		awk printf local $(pwd) --verbose printf | sed
+/usr/bin 2>/dev/null 'quoted text' local then readonly printf
+	done then local 'quoted text'
+		"$1" $(pwd) awk ${HOME} --verbose ${HOME} -eu /usr/bin test "$@"
+	| cd /usr/bin /usr/bin cd --verbose export 2>/dev/null
+	grep "$@" /usr/bin && 'quoted text' /usr/bin
+	2>/dev/null readonly ${HOME}
+		then "$1" export grep "$@" "$@" done local sed test
+sed $(pwd) grep 2>/dev/null awk sed /usr/bin "$@" x=1 ${HOME} 2>/dev/null
+test "$@" /usr/bin then cd ${HOME}
+	sed $(pwd) --verbose "$@" cd then "$@"
+	sed "$1" $(pwd) local 2>/dev/null "$@" "$1"
+		then -eu ${HOME} cd export cd printf "$@" awk && -eu "$@" local readonly ${HOME}
+		awk x=1 test sed cd done --verbose x=1
+test ${HOME} awk -eu awk && sed done ${HOME} printf --verbose "$@"
+-eu $(pwd) done grep -eu then done test cd awk ${HOME} grep ${HOME} 2>/dev/null
+		--verbose then grep ${HOME} 2>/dev/null x=1 printf "$@" printf
+		export -eu | readonly local ${HOME}
+test sed sed echo sed 2>/dev/null done awk --verbose readonly 2>/dev/null "$1"
+	/usr/bin cd then export "$1" local $(pwd)
+		awk "$@" awk grep grep local "$1" --verbose awk "$@" --verbose sed $(pwd) local
+	"$1" local $(pwd) 2>/dev/null cd ${HOME} done
+then --verbose then ${HOME} x=1 awk /usr/bin echo printf 2>/dev/null
+	--verbose test local cd grep local --verbose "$@" local readonly ${HOME} printf
+	awk echo /usr/bin done $(pwd) $(pwd) sed
+		test "$@" printf export grep "$1" /usr/bin 'quoted text'
+local -eu then 2>/dev/null --verbose printf | x=1 "$1"
+	"$@" | export x=1 && sed echo
+	"$1" 2>/dev/null export 'quoted text' cd readonly local then -eu sed 'quoted text'
+		--verbose echo awk "$@"
+	"$1" printf 2>/dev/null --verbose
+--verbose 'quoted text'
+	&& x=1 awk test grep export $(pwd) printf --verbose $(pwd) -eu -eu
+readonly local cd && 'quoted text' x=1 local awk echo | $(pwd) cd ${HOME} x=1
+		"$1" local /usr/bin then test -eu printf $(pwd) 'quoted text' && grep 2>/dev/null
+		$(pwd) /usr/bin test test cd cd && grep printf then done ${HOME} --verbose
+		2>/dev/null 2>/dev/null ${HOME} $(pwd) 'quoted text' $(pwd) -eu
+		--verbose test ${HOME} --verbose --verbose
+'quoted text' grep /usr/bin
+/usr/bin test 'quoted text' export cd 'quoted text' echo
+		sed | local done test done readonly 2>/dev/null
+	$(pwd) local sed local x=1 then "$@" done cd cd 'quoted text'
+		test printf 'quoted text' $(pwd) done |
+-eu sed && test awk cd 'quoted text'
+--verbose --verbose grep /usr/bin test $(pwd) -eu --verbose export grep
+grep "$1" export readonly
+	export 'quoted text' | cd cd printf -eu | readonly sed -eu sed && && ${HOME}
+awk grep ${HOME} x=1 awk printf --verbose then "$1"
+"$@" export export grep
+readonly export local cd | then --verbose
+"$1" "$1" echo awk && local local /usr/bin "$@" done -eu --verbose
+2>/dev/null readonly export
+		2>/dev/null 'quoted text' test readonly sed
+2>/dev/null "$1" printf && awk 'quoted text'
+test local cd export | printf
+'quoted text' -eu 'quoted text' x=1 /usr/bin grep 'quoted text' ${HOME} --verbose
+test -eu echo x=1 printf export printf "$1" $(pwd)
+		awk local echo readonly printf
+		'quoted text' 'quoted text' then /usr/bin
+		test 'quoted text' x=1 2>/dev/null grep cd | 'quoted text'
+test test grep -eu readonly echo /usr/bin grep
+	test "$@" "$1" $(pwd) -eu then echo export /usr/bin sed
+$(pwd) cd test sed done $(pwd) "$@" 'quoted text' cd $(pwd) test readonly grep test
+	x=1 local echo "$1" 2>/dev/null test sed | sed
+local | -eu 'quoted text'
+	| 2>/dev/null $(pwd) printf sed x=1 test "$@" printf
+	"$1" printf 'quoted text' done | echo test test printf
+		${HOME} 'quoted text' local then then sed ${HOME}
+echo local && export | done "$1" x=1 $(pwd) /usr/bin then "$@" ${HOME} ${HOME}
+		readonly /usr/bin grep test && ${HOME} $(pwd) export
+	x=1 cd sed sed "$@" 'quoted text'
+-eu $(pwd) printf x=1 sed && x=1 grep readonly "$@" readonly
+echo | awk 2>/dev/null -eu then ${HOME}
+		/usr/bin -eu | "$1" | "$@" "$1" export
+		export --verbose cd echo local cd grep readonly x=1 printf /usr/bin
+"$1" then awk awk --verbose then && export local cd x=1 2>/dev/null
+test --verbose $(pwd)
+	readonly echo /usr/bin ${HOME} sed 2>/dev/null $(pwd) "$1" $(pwd) -eu
+/usr/bin && then 2>/dev/null then 2>/dev/null test export
+	sed | sed then ${HOME} "$@" $(pwd) 'quoted text'
+	cd $(pwd) && awk export
+${HOME} printf -eu 2>/dev/null 2>/dev/null readonly done grep /usr/bin
+printf test 2>/dev/null x=1 ${HOME} local cd | /usr/bin awk |
+		$(pwd) | grep -eu ${HOME} --verbose
+		export 2>/dev/null /usr/bin -eu printf "$1" export "$1" x=1 | "$1" test test
+-eu "$1" | sed cd done test cd sed
+'quoted text' export cd readonly grep readonly cd echo |
+		"$1" sed echo test | export $(pwd) "$1" "$@" grep
+		$(pwd) --verbose /usr/bin cd 'quoted text' export
+"$1" echo && 'quoted text'
+		grep grep export "$1" ${HOME} echo 2>/dev/null 'quoted text'
+test awk grep --verbose && echo "$@"
+		grep ${HOME} 'quoted text' "$1" sed && awk awk awk --verbose 'quoted text' x=1
+-eu grep done printf "$@" echo 2>/dev/null
+	"$@" export && "$1" "$@"
+		&& /usr/bin done && awk sed | 2>/dev/null printf "$@" grep 'quoted text'
+then x=1 grep printf | sed echo /usr/bin printf sed
+	cd $(pwd) export 'quoted text' 2>/dev/null $(pwd) 2>/dev/null
+	/usr/bin --verbose done awk echo grep $(pwd)
+--verbose export export printf -eu && /usr/bin test grep $(pwd) local /usr/bin
+	test | | done awk local local --verbose grep local $(pwd) "$@" cd |
+2>/dev/null local then x=1 && printf --verbose
+printf "$@" 2>/dev/null readonly 2>/dev/null "$@" /usr/bin grep test && readonly
+		/usr/bin readonly then local && "$@" "$@"
+	&& readonly -eu printf "$@" "$@" && local -eu /usr/bin sed
+echo 2>/dev/null | -eu sed | | && awk $(pwd) test
+'quoted text' 2>/dev/null 'quoted text' printf -eu "$1" done echo && "$1"
+done /usr/bin ${HOME} 2>/dev/null then grep printf done /usr/bin
+		echo printf echo readonly -eu export export done cd 2>/dev/null ${HOME} ${HOME}
+then test x=1 $(pwd) printf /usr/bin sed 2>/dev/null "$@" then export done export
+		sed test --verbose echo | sed 'quoted text' --verbose && printf then test then
+		&& cd cd && export printf 'quoted text' cd done "$1" cd
+		local "$@" -eu done then awk awk | "$@" | "$1" done "$1" -eu then
+	cd readonly && echo readonly then cd test | $(pwd) $(pwd)
+	printf $(pwd) sed /usr/bin 'quoted text'
+		/usr/bin readonly -eu
+		cd /usr/bin | then sed test x=1 | local 'quoted text' /usr/bin
+	test readonly "$@" then awk done 'quoted text'
+		cd --verbose readonly $(pwd) | --verbose test | then echo &&
+		echo --verbose then "$@" $(pwd) -eu
+	then && cd then cd --verbose sed "$1" readonly -eu test && grep -eu echo
+--verbose export "$1" awk grep | x=1 awk echo "$@" ${HOME} grep -eu grep
+		2>/dev/null cd | readonly "$@" $(pwd) printf sed && "$1" | export "$1" awk "$1"
+		sed cd x=1 /usr/bin x=1 cd | printf test 'quoted text' then $(pwd) echo printf
+	test $(pwd) 'quoted text'
+		printf export $(pwd) test
+readonly printf --verbose ${HOME} ${HOME} "$1" 'quoted text'
+-eu "$@" x=1 --verbose grep | awk grep | "$1" x=1 local test cd done
+awk cd sed readonly $(pwd) -eu "$@" x=1 x=1 x=1 'quoted text' -eu --verbose
+printf awk $(pwd) done $(pwd) test echo cd && printf -eu -eu -eu export
+		-eu grep done then cd echo 2>/dev/null echo x=1 test
+		test && 'quoted text' cd 'quoted text'
+		x=1 echo && local export "$@" "$@" x=1 local && local 2>/dev/null
+		--verbose sed then ${HOME} sed | "$1" echo printf
+printf printf local sed
+awk | --verbose echo ${HOME} --verbose --verbose readonly done grep /usr/bin echo
+awk printf sed $(pwd) ${HOME}
+		'quoted text' "$@" /usr/bin ${HOME} /usr/bin $(pwd) "$@" grep echo && "$@" x=1 readonly
+printf ${HOME} export $(pwd) --verbose | export awk $(pwd) readonly
+	echo /usr/bin $(pwd) awk local readonly ${HOME} /usr/bin readonly && -eu echo ${HOME}
+	/usr/bin 2>/dev/null "$1" awk grep printf --verbose "$@" "$@" --verbose ${HOME}
+	-eu ${HOME} "$1" --verbose readonly grep local
+		$(pwd) && "$@" 2>/dev/null grep 2>/dev/null printf
+	--verbose grep sed export ${HOME} awk -eu "$1" 2>/dev/null x=1 "$1"
+printf readonly ${HOME} test readonly x=1 && then x=1 cd
+test $(pwd) test awk ${HOME}
+done local local $(pwd)
+2>/dev/null && | grep --verbose -eu awk readonly echo
+${HOME} local test echo | echo cd 2>/dev/null "$1" ${HOME} 2>/dev/null
+	2>/dev/null cd "$1" echo grep -eu done awk | "$@" test awk
+		awk test | && echo --verbose
+	/usr/bin /usr/bin readonly
+		cd done cd sed ${HOME} ${HOME} export
+--verbose local -eu local $(pwd) awk -eu sed
+	then awk test awk grep | ${HOME} test
+printf printf local then /usr/bin
+		-eu awk /usr/bin && export
+	/usr/bin $(pwd) grep cd "$@" then grep test grep readonly && "$1" x=1
+		"$1" $(pwd) | 'quoted text' "$1" -eu $(pwd) then then printf grep
+		${HOME} --verbose $(pwd) local awk export readonly | echo sed readonly --verbose
+	/usr/bin 2>/dev/null
+	x=1 readonly sed | && readonly
+		grep done | 'quoted text' echo "$@" sed grep | readonly "$@"
+		readonly /usr/bin grep ${HOME} local /usr/bin sed export 2>/dev/null
+export readonly 'quoted text' -eu printf echo sed local
+		2>/dev/null --verbose && test export local $(pwd) "$@" echo local | /usr/bin
+&& printf /usr/bin && sed ${HOME} echo
+		${HOME} readonly grep "$1" $(pwd) grep "$1" local 'quoted text'
+	sed then ${HOME} --verbose
+	| cd 2>/dev/null && ${HOME} local sed echo | | echo -eu sed grep 2>/dev/null
+export | | test "$@" sed echo /usr/bin echo /usr/bin --verbose export
+"$1" | readonly -eu "$1" /usr/bin echo && | readonly
+		cd echo /usr/bin 'quoted text' awk -eu local echo local 'quoted text' | -eu
+		${HOME} ${HOME} "$@" -eu printf
+echo sed test readonly --verbose grep printf | export | |
+cd && sed done | -eu echo && "$1" echo x=1 x=1 $(pwd)
+test | -eu --verbose /usr/bin
+	-eu local && echo echo export export
+	x=1 then export x=1 awk -eu 2>/dev/null awk $(pwd)
+		'quoted text' readonly && readonly "$1"
+	2>/dev/null then /usr/bin awk readonly done | sed sed printf 'quoted text'
+		cd 'quoted text' cd && /usr/bin 2>/dev/null "$@" /usr/bin then printf local
+		--verbose sed 'quoted text' test local $(pwd) $(pwd) "$1" sed 'quoted text'
+| export test export -eu then 2>/dev/null grep awk
+	then grep $(pwd) cd $(pwd) $(pwd) ${HOME} /usr/bin cd -eu "$@" grep readonly
+		/usr/bin done awk && readonly printf awk cd echo awk grep /usr/bin ${HOME}
+	local echo test readonly "$@"
+	x=1 test grep cd x=1 && local -eu sed 2>/dev/null &&
+${HOME} | | --verbose && | "$@" readonly -eu test grep
+	&& --verbose export awk test awk -eu
+--verbose | "$1" -eu --verbose
+then -eu "$@" done 'quoted text'
+	${HOME} local ${HOME} $(pwd) 2>/dev/null --verbose local sed then
+local test ${HOME} "$@" export && --verbose "$1" 2>/dev/null echo cd
+sed printf sed 2>/dev/null cd sed 2>/dev/null
+-eu "$1" local awk 2>/dev/null "$1" x=1 2>/dev/null
+	echo 'quoted text' && then readonly test && -eu awk | && $(pwd) x=1 sed
+		grep export awk $(pwd) x=1 2>/dev/null ${HOME} readonly printf local readonly
+	"$@" ${HOME} 2>/dev/null
+x=1 then 'quoted text' cd /usr/bin printf 'quoted text' -eu sed printf
+	"$@" /usr/bin export test printf "$@"
+	/usr/bin test export grep --verbose echo local ${HOME} x=1
+2>/dev/null 'quoted text'
+awk echo sed readonly cd 2>/dev/null | | export /usr/bin --verbose
+grep "$1" echo sed local && -eu "$1" readonly $(pwd) $(pwd) grep export | | echo
+		/usr/bin "$@" $(pwd) && -eu printf test 2>/dev/null
+		"$@" sed x=1 "$@" --verbose export printf | then ${HOME}
+		-eu x=1 "$1" "$@" sed
+		"$@" awk -eu export test "$1" /usr/bin | local then readonly $(pwd) printf
+		test | --verbose $(pwd) -eu readonly local /usr/bin
+		export "$@" -eu test export grep
+x=1 done awk "$1" local test local -eu && && "$1" ${HOME} grep
+cd -eu 'quoted text' "$1" $(pwd) cd -eu export -eu x=1 local "$1" test export
+	then $(pwd) readonly then 2>/dev/null export x=1 echo printf
+	done x=1 awk local awk done printf awk export -eu test then local
+	/usr/bin x=1 export then $(pwd) then printf
+	awk grep export --verbose "$1" export export then
+echo $(pwd) export "$1"
+		readonly printf --verbose export "$1" then done local readonly x=1 "$1"
+| then && 'quoted text' --verbose
+		echo readonly | | -eu test done -eu cd --verbose echo 2>/dev/null local
+sed | test done && test export -eu --verbose 'quoted text'
+	echo local x=1 awk export && ${HOME}
+	cd | "$@" ${HOME} done test local | ${HOME} local
+		readonly | | $(pwd) "$1" 'quoted text'
+	local | "$@" cd done test sed sed ${HOME} awk --verbose --verbose then 'quoted text'
+		local 'quoted text' /usr/bin ${HOME} | printf
+		then x=1 -eu readonly /usr/bin x=1 grep export
+done && test cd 2>/dev/null | then -eu local sed done x=1 "$1" grep cd --verbose
+/usr/bin local grep local "$1" echo cd done $(pwd) 'quoted text' echo done 2>/dev/null
+		local readonly export done printf && 'quoted text' cd awk --verbose awk x=1 /usr/bin
+	readonly echo done readonly ${HOME} /usr/bin /usr/bin test cd cd
+	"$1" x=1 local then --verbose awk awk readonly $(pwd)
+	${HOME} x=1 test | | local | then
+		/usr/bin 'quoted text' -eu readonly export grep then sed cd /usr/bin
+	local "$@" sed && export then && cd test awk "$@" grep --verbose readonly readonly
+grep "$1" && 2>/dev/null x=1 sed "$@" | printf readonly "$@" "$1" ${HOME} printf
+| readonly local awk test --verbose readonly
+x=1 sed x=1 x=1 export printf ${HOME} --verbose
+	printf --verbose $(pwd) sed sed export grep
+		"$1" $(pwd) 2>/dev/null 2>/dev/null echo sed 'quoted text'
+	--verbose echo test x=1 'quoted text'
+		-eu "$1" then test done 2>/dev/null && sed awk readonly /usr/bin
+	"$1" local sed ${HOME} grep $(pwd) test done done "$1" x=1 2>/dev/null
+then --verbose sed "$@" printf -eu printf -eu test cd readonly $(pwd) cd 'quoted text'
+		'quoted text' 2>/dev/null && && "$@" && export
+	then awk awk local 2>/dev/null test
+		"$1" /usr/bin $(pwd) echo sed 2>/dev/null $(pwd) x=1
+		sed | echo x=1 readonly test awk "$@" then readonly export && 2>/dev/null $(pwd)
+		cd echo printf readonly -eu export --verbose test test /usr/bin
+		| printf ${HOME} /usr/bin /usr/bin test $(pwd) then cd local
+	--verbose "$1" -eu | printf $(pwd) readonly 2>/dev/null "$1"
+$(pwd) then $(pwd) "$1" 2>/dev/null awk then ${HOME} "$@" 'quoted text' x=1 'quoted text'
+/usr/bin 'quoted text'
+| x=1 && local | | "$@"
+done "$1" ${HOME} done --verbose sed "$1" grep
+		"$@" export local printf --verbose sed test --verbose | echo
+		echo --verbose done test done /usr/bin 'quoted text' sed export $(pwd) $(pwd)
+	/usr/bin 2>/dev/null done readonly $(pwd)
+	/usr/bin test 2>/dev/null cd $(pwd) printf done | grep "$1"
+		&& x=1 $(pwd) printf readonly "$@" then echo /usr/bin "$@"
+		--verbose cd printf readonly awk printf local "$@" test awk 2>/dev/null
+	/usr/bin cd "$@" "$@" -eu $(pwd) /usr/bin awk echo 'quoted text' $(pwd)
+	/usr/bin 'quoted text' x=1 test
+sed 2>/dev/null 'quoted text' export
+awk x=1 sed readonly | x=1 && sed 2>/dev/null
+		x=1 2>/dev/null done local
+	printf && printf local /usr/bin awk
+		test printf then -eu
+	sed then x=1 2>/dev/null $(pwd) echo | grep 2>/dev/null --verbose && "$@" | awk
+		grep printf cd /usr/bin "$1" test cd x=1 echo && done cd --verbose done && awk grep
+	test | sed done 2>/dev/null
+	'quoted text' cd 'quoted text'
+		done "$@" && ${HOME} echo echo
+		$(pwd) -eu 'quoted text' ${HOME} "$@" 2>/dev/null cd
+	local readonly then ${HOME} local test | local $(pwd)
+		'quoted text' readonly test | && cd --verbose grep 'quoted text'
+sed /usr/bin -eu sed
+| echo ${HOME} && 'quoted text' readonly test
+		then echo sed done 2>/dev/null
+		then done /usr/bin --verbose done sed printf 2>/dev/null "$1" export sed test |
+		/usr/bin cd ${HOME} -eu -eu readonly done && /usr/bin awk local
+	x=1 $(pwd) cd x=1 'quoted text' grep export done 'quoted text'
+	'quoted text' 'quoted text' grep -eu
+	readonly export test readonly ${HOME} printf printf "$@" readonly /usr/bin
+2>/dev/null "$1" $(pwd) ${HOME}
+--verbose --verbose 2>/dev/null /usr/bin awk awk 'quoted text' awk sed |
+		sed sed && "$1" test local sed sed readonly /usr/bin readonly
+| -eu awk done $(pwd) then 2>/dev/null printf $(pwd) done | echo x=1
+	/usr/bin done ${HOME} test test && then /usr/bin
+then then 'quoted text' /usr/bin "$1" cd -eu readonly "$1" /usr/bin
+		then echo 2>/dev/null echo done echo --verbose -eu 2>/dev/null
+"$@" 'quoted text' then export test ${HOME} cd && "$1" readonly
+	${HOME} $(pwd) && --verbose /usr/bin
+| $(pwd) awk x=1 $(pwd) local x=1 | grep
+readonly /usr/bin --verbose grep readonly
+2>/dev/null local awk 2>/dev/null 2>/dev/null
+	'quoted text' -eu export 2>/dev/null printf ${HOME} 2>/dev/null 2>/dev/null
+cd done x=1 echo "$1" /usr/bin 'quoted text'
+| done grep echo sed --verbose sed local echo then "$1" readonly readonly |
+	test local --verbose test |
+	2>/dev/null awk awk x=1 ${HOME} ${HOME} cd
+awk $(pwd) | | ${HOME} printf 2>/dev/null local sed printf "$@" echo -eu
+		"$@" local cd printf 2>/dev/null export
+	$(pwd) --verbose then readonly "$1" sed awk 2>/dev/null "$@" ${HOME} |
+#include c153.sh
+		test cd ${HOME} && -eu sed "$1" | --verbose
+	then echo local then | export
+sed 2>/dev/null readonly
+done ${HOME} /usr/bin export "$1" grep readonly "$1" $(pwd) "$1" x=1
+		awk local -eu local cd "$1" 2>/dev/null 2>/dev/null | --verbose
+	then -eu ${HOME} /usr/bin | export | cd printf && -eu "$@" 'quoted text'
+	2>/dev/null -eu test --verbose awk && "$1" && awk
+awk awk x=1 cd awk && echo 'quoted text'
+		done done && $(pwd) readonly sed grep test ${HOME} done echo readonly
+	printf /usr/bin readonly export "$1" test
+		| cd awk "$1" grep printf "$@" then && x=1 echo printf done test readonly
+cd "$1" | done --verbose echo -eu && 'quoted text'
+	export "$1" ${HOME} done
+	&& $(pwd) cd -eu x=1 awk cd 'quoted text' -eu local printf cd $(pwd) printf readonly
+/usr/bin cd export | readonly -eu sed printf printf $(pwd)
+	local echo readonly awk awk grep && -eu local
+		then test $(pwd) grep grep
+$(pwd) | x=1 export && echo 2>/dev/null printf
+	cd && 2>/dev/null $(pwd) "$1" x=1
+		-eu /usr/bin test 'quoted text' --verbose
+	awk test 2>/dev/null printf | -eu | "$@" 'quoted text' x=1 | grep
+awk | printf printf readonly 2>/dev/null
+x=1 test && | "$@" test done
+	cd 2>/dev/null && local 'quoted text' -eu && grep
+		local 'quoted text' done
+$(pwd) "$1" printf local
+	readonly then echo local echo x=1
+		export /usr/bin | "$@" ${HOME} x=1 $(pwd) then
+		2>/dev/null --verbose x=1 && 2>/dev/null 2>/dev/null |
+		"$@" echo --verbose x=1 "$1" && readonly
+	-eu "$@" 'quoted text' $(pwd)
+	readonly | sed echo -eu done test printf | --verbose echo --verbose
+	'quoted text' x=1 readonly /usr/bin readonly then /usr/bin | export | printf
+		test x=1 --verbose export
+| then then --verbose $(pwd) test | $(pwd)
+		"$1" x=1 'quoted text' ${HOME} cd $(pwd) export local 2>/dev/null
+		echo then $(pwd) --verbose "$@" 2>/dev/null -eu then
+	cd 2>/dev/null "$1" awk cd done
+"$@" | 'quoted text' "$1" "$@" done 2>/dev/null
+		printf then /usr/bin echo x=1 done -eu cd awk
+-eu sed /usr/bin export "$@"
+&& export printf echo test sed "$@" $(pwd) x=1 printf
+		grep echo done local "$@" "$1" echo echo
+test && $(pwd) sed --verbose sed 'quoted text' test printf
+&& test "$@" 'quoted text' readonly
+/usr/bin echo then 'quoted text' printf ${HOME} printf
+done cd "$@" echo 2>/dev/null /usr/bin then
+		readonly export /usr/bin
+-eu done -eu ${HOME} x=1 "$@" done --verbose printf test
+	$(pwd) grep /usr/bin 'quoted text' echo cd readonly local
+		test | export cd "$1"
+		| "$@" 'quoted text' "$1" $(pwd) "$1" && sed
+awk 2>/dev/null local | export -eu cd echo grep printf done /usr/bin
+| done then && 2>/dev/null local 2>/dev/null echo 'quoted text'
+	"$1" && $(pwd) sed echo --verbose test
+	&& "$1" "$@" --verbose grep awk test x=1 | readonly test cd | test ${HOME} readonly
+		-eu /usr/bin test -eu x=1 --verbose
+	echo grep local awk test && cd then readonly "$@" | readonly
+| done && /usr/bin cd grep -eu local test --verbose 2>/dev/null
+/usr/bin --verbose echo | -eu cd cd
+	/usr/bin readonly $(pwd)
+		2>/dev/null printf $(pwd) echo
+	"$1" done "$@" done 2>/dev/null
+2>/dev/null 2>/dev/null cd "$@" cd readonly local && -eu printf done
+	echo awk && 2>/dev/null then export 2>/dev/null && /usr/bin
+printf x=1 --verbose -eu | export --verbose readonly grep "$1" && grep 'quoted text'
+2>/dev/null awk then 'quoted text' 'quoted text' local cd ${HOME} awk
+then grep /usr/bin --verbose
+	"$@" readonly "$1" awk grep export && "$@" done local sed 2>/dev/null
+then export awk test ${HOME}
+export cd /usr/bin awk "$@"
+2>/dev/null printf "$1" cd cd "$1" cd sed test 2>/dev/null
+		echo ${HOME} 2>/dev/null
+		test "$1" readonly grep "$@" -eu ${HOME} "$@" ${HOME}
+		-eu --verbose 2>/dev/null local readonly echo
+done "$@" export x=1 then
+	$(pwd) && grep -eu -eu echo echo
+		$(pwd) cd done && echo echo
+	2>/dev/null done grep | -eu | | export && && test 2>/dev/null x=1 'quoted text'
+		${HOME} printf echo export "$1" export 'quoted text' 2>/dev/null printf && /usr/bin
+	local readonly $(pwd) grep readonly --verbose "$1" x=1 "$1"
+	--verbose sed "$1" | x=1
+		grep done test -eu awk -eu local then
+		readonly awk then --verbose cd
+	/usr/bin -eu ${HOME} 2>/dev/null awk cd export "$@" 'quoted text'
+	printf then --verbose echo
+	-eu awk cd "$1" done grep | /usr/bin sed x=1 | 2>/dev/null done local
+	| x=1 /usr/bin && $(pwd) $(pwd) ${HOME} ${HOME} awk $(pwd) printf done
+	2>/dev/null /usr/bin done printf cd local local
+		| done echo then done 2>/dev/null local &&
+export local --verbose | printf local x=1 $(pwd) x=1 done then $(pwd)
+	$(pwd) && awk export 2>/dev/null done x=1 /usr/bin
+local sed done 2>/dev/null test awk -eu test grep printf | then
+"$@" done 2>/dev/null x=1 'quoted text' -eu
+		${HOME} sed 2>/dev/null test -eu
+	printf echo export test /usr/bin "$@"
+		test local cd | test 'quoted text' local x=1 2>/dev/null readonly echo test
+	"$@" "$@" ${HOME} 2>/dev/null -eu echo echo && 'quoted text' awk echo cd | ${HOME}
+	cd --verbose awk local "$@" --verbose grep then | done printf cd
+	then grep sed --verbose /usr/bin awk
+sed printf awk echo 'quoted text' then && | grep test then --verbose
+		'quoted text' && then sed echo then
+	-eu export cd "$1" grep x=1 "$1" 2>/dev/null
+export echo export awk 2>/dev/null
+done 2>/dev/null done sed /usr/bin x=1 -eu sed x=1 readonly printf done | echo
+		then x=1 'quoted text' "$1" local x=1 awk $(pwd) awk --verbose
+grep $(pwd) -eu | test --verbose 2>/dev/null /usr/bin ${HOME} sed &&
+		test printf printf export sed local export
+test | 'quoted text' readonly --verbose readonly then | awk && $(pwd) "$@" done
+done sed && && then x=1
+		/usr/bin 'quoted text' local readonly printf local grep
+-eu export awk | /usr/bin
+&& printf echo ${HOME} sed then -eu awk awk x=1 x=1 readonly "$@" /usr/bin
+"$1" && then && -eu /usr/bin done sed "$@"
+&& -eu "$1" --verbose export | | cd --verbose && /usr/bin echo echo done $(pwd)
+		"$1" done sed awk /usr/bin
+printf echo grep test --verbose awk awk "$@" done sed export echo test awk printf
+		readonly cd 2>/dev/null ${HOME} readonly
+	printf test ${HOME} 2>/dev/null
+		cd done cd $(pwd) echo $(pwd) then echo grep /usr/bin 'quoted text'
+	x=1 export x=1 && "$1" x=1 cd
+done readonly local grep x=1 echo |
+	test done x=1 && done x=1 printf | done printf
+test echo done ${HOME} ${HOME} --verbose 'quoted text' -eu readonly then 'quoted text'
+		export export --verbose x=1 then done -eu && then $(pwd)
+		${HOME} 2>/dev/null "$@" /usr/bin --verbose printf readonly export echo ${HOME}
+"$@" grep 2>/dev/null ${HOME} && then "$@" test done test
+--verbose done && local local echo 2>/dev/null && export
+	then ${HOME} then export
+		'quoted text' && -eu grep grep /usr/bin echo printf | cd "$1" "$@" -eu
+export x=1 local $(pwd) | && -eu -eu echo then 'quoted text' --verbose 2>/dev/null
+awk done x=1 | readonly export
+echo awk 2>/dev/null "$1" 2>/dev/null sed $(pwd) awk | -eu /usr/bin
+		sed ${HOME} 2>/dev/null grep
+test test printf readonly
+	x=1 cd test /usr/bin local sed
+	&& /usr/bin x=1 && | export export && done -eu done test
+-eu printf readonly 2>/dev/null cd readonly 'quoted text' ${HOME} readonly
+		sed --verbose && then 'quoted text' grep sed 2>/dev/null /usr/bin x=1
+	$(pwd) ${HOME} printf x=1
+	"$@" /usr/bin "$@" then --verbose local sed cd | awk | | "$@" cd /usr/bin echo
+		$(pwd) readonly awk local
+x=1 local -eu x=1 x=1 ${HOME} -eu 2>/dev/null
+awk x=1 $(pwd) "$@" cd echo
+		awk 'quoted text' cd ${HOME} 'quoted text' 2>/dev/null awk /usr/bin "$@" printf
+		-eu export "$1" "$@" "$@" -eu && 2>/dev/null /usr/bin
+		'quoted text' "$@" grep printf local sed ${HOME} readonly readonly
+readonly awk && --verbose done done | sed done local
+| done grep export printf cd
+--verbose done grep local local cd export && && | 2>/dev/null
+	&& | && readonly local 'quoted text' "$@" && echo local
+	printf "$@" printf | "$1" awk | x=1 cd ${HOME} then
+	cd echo sed ${HOME} && -eu /usr/bin | done | local /usr/bin grep awk /usr/bin
+printf -eu test done && x=1 echo 2>/dev/null 'quoted text' | x=1 /usr/bin
+awk && "$@" && --verbose "$@"
+		sed 'quoted text' test /usr/bin readonly -eu local test
+		x=1 -eu sed then echo printf -eu done test
+	printf readonly 2>/dev/null $(pwd) --verbose ${HOME} cd /usr/bin
+		done export export readonly
+		/usr/bin --verbose ${HOME} sed readonly x=1 /usr/bin ${HOME} test then
+	printf x=1 /usr/bin echo readonly
+	x=1 $(pwd) cd test export then cd 'quoted text' 'quoted text' "$@"
+2>/dev/null awk readonly done /usr/bin | x=1 export
+echo "$1" done grep cd | grep test sed | cd && /usr/bin
+	"$@" grep local export done $(pwd) printf --verbose sed echo echo printf -eu 2>/dev/null
+	| awk /usr/bin && local
+		--verbose "$@" done awk x=1 | done -eu export done x=1 printf echo awk | | grep
+	$(pwd) sed local 'quoted text'
+	"$1" && sed $(pwd) $(pwd) awk done printf readonly
+		echo | readonly x=1 'quoted text' test ${HOME} $(pwd)
+awk local && export -eu printf echo
+	| echo local awk readonly awk ${HOME} && then awk
+	grep -eu awk cd | grep x=1
+| done | "$1" awk grep "$@" cd test export ${HOME} -eu x=1 export --verbose /usr/bin
+	x=1 grep grep cd /usr/bin sed -eu printf $(pwd) printf
+	test grep grep /usr/bin
+	local test export cd export -eu then local local -eu
+	cd /usr/bin sed awk "$@" "$@" cd /usr/bin readonly
+cd readonly printf export -eu x=1 test 2>/dev/null x=1 /usr/bin
+"$1" ${HOME} | 2>/dev/null sed ${HOME}
+		| grep -eu readonly /usr/bin test | "$@" awk 'quoted text' | then 2>/dev/null local
+	${HOME} "$1" echo sed
+export export printf local echo "$1" x=1 echo 2>/dev/null 'quoted text'
+2>/dev/null /usr/bin export test echo test x=1
+		${HOME} && -eu test | sed 2>/dev/null $(pwd) /usr/bin sed --verbose
+		--verbose awk then 2>/dev/null local then --verbose | $(pwd) then
+	grep local echo ${HOME} echo 2>/dev/null
+--verbose /usr/bin | echo 2>/dev/null
+		then -eu grep && printf test 'quoted text' $(pwd) echo readonly test
+	/usr/bin -eu x=1 "$@" 'quoted text'
+		${HOME} cd /usr/bin local local --verbose --verbose
+		${HOME} 'quoted text' sed 2>/dev/null echo x=1 printf awk done echo x=1 awk
+	then cd /usr/bin 2>/dev/null $(pwd) x=1
+		-eu 2>/dev/null awk 'quoted text' grep export
+		/usr/bin echo /usr/bin $(pwd) | cd --verbose 2>/dev/null | 'quoted text'
+	awk && then printf cd export
+sed /usr/bin printf readonly 2>/dev/null && x=1 test $(pwd) export
+	"$@" /usr/bin cd 2>/dev/null "$@" printf sed --verbose
+		grep 2>/dev/null readonly $(pwd) printf printf 'quoted text' local
+	sed --verbose export --verbose
+local 2>/dev/null awk echo echo export
+		local cd --verbose local "$@" x=1 "$1" 2>/dev/null 2>/dev/null
+		2>/dev/null printf done && local done -eu awk -eu export 'quoted text'
+-eu 'quoted text' done && echo
+		readonly local "$@" printf done awk test ${HOME} | --verbose sed export && grep
+	sed printf "$1" export "$@" ${HOME} 2>/dev/null 'quoted text' "$@" 'quoted text'
+"$1" "$@" awk "$@" | done test
+sed --verbose "$1" then local grep --verbose ${HOME}
+		"$@" export --verbose done sed printf printf printf cd grep done $(pwd)
+| awk -eu /usr/bin 2>/dev/null
+| export x=1 then ${HOME} then then $(pwd) && readonly --verbose 'quoted text'
+		awk | x=1 && 2>/dev/null 2>/dev/null
+"$1" local printf done 2>/dev/null 2>/dev/null
+	'quoted text' && | test 'quoted text'
+		'quoted text' sed local "$@" then -eu sed sed ${HOME}
+	&& -eu x=1 && 'quoted text' x=1
+		-eu -eu "$1" echo && local then --verbose
+		"$@" done then echo "$1" then 2>/dev/null
+		-eu grep x=1 then printf test "$1"
+	export echo test "$@" test printf
+x=1 grep local test sed awk | export "$@" sed cd export local "$@"
+"$@" then ${HOME} done grep && /usr/bin echo local awk echo printf
+		'quoted text' 'quoted text' "$@" grep test done local /usr/bin cd | $(pwd)
+	grep grep 2>/dev/null 'quoted text' then grep
+		$(pwd) -eu printf "$@" readonly 2>/dev/null readonly 2>/dev/null
+	${HOME} test 'quoted text' ${HOME} $(pwd) export | /usr/bin
+		$(pwd) echo export 2>/dev/null
+	readonly done printf test grep sed export $(pwd) ${HOME}
+	"$1" awk grep | x=1 test 'quoted text'
+local x=1 /usr/bin && 2>/dev/null $(pwd) export -eu done done && printf
+echo then /usr/bin sed /usr/bin printf -eu -eu x=1 echo awk local
+	test done x=1 ${HOME} printf 2>/dev/null $(pwd)
+	$(pwd) /usr/bin $(pwd) local printf "$1" 2>/dev/null x=1 grep echo -eu
+	x=1 grep done test | cd | $(pwd) cd then test grep echo grep x=1 x=1 x=1 -eu ${HOME}
+/usr/bin then -eu sed 'quoted text' test test awk
+	"$@" local ${HOME} done "$@" -eu grep printf
+		cd -eu "$@" && test then done -eu awk local ${HOME} /usr/bin export export "$1"
+	sed "$@" ${HOME} then export readonly
+printf "$@" /usr/bin | 2>/dev/null && --verbose done --verbose done local
+local done 'quoted text' 2>/dev/null
+		readonly then /usr/bin 2>/dev/null printf | grep --verbose
+local "$1" 'quoted text' sed done printf $(pwd) done && "$@" "$@" done then
+	&& echo awk && "$@" cd $(pwd) test
+		"$@" done -eu && /usr/bin grep --verbose then --verbose x=1 printf awk "$@" grep
+		readonly sed x=1 "$@" done
+		x=1 $(pwd) x=1 cd sed local
+	cd test "$1" done /usr/bin done test
+		echo "$1" "$1" --verbose $(pwd) -eu readonly 2>/dev/null
+		awk test -eu then | readonly printf sed
+		awk "$1" cd cd printf test 'quoted text'
+--verbose "$@" sed printf 'quoted text' local grep "$@"
+	"$1" sed --verbose $(pwd) local test test grep echo $(pwd)
+		'quoted text' 'quoted text' test --verbose --verbose --verbose --verbose test
+done test "$1" printf 'quoted text' local cd $(pwd) $(pwd)
+	local done awk grep &&
+	sed $(pwd) done "$@" cd test "$1" sed /usr/bin "$1" awk awk grep local cd test
+-eu then cd awk export done done -eu ${HOME} | readonly
+| | -eu 'quoted text' export then $(pwd)
+	cd printf cd test --verbose cd echo 'quoted text'
+	&& printf grep test printf then test -eu x=1 test export grep
+	cd "$@" then export $(pwd) echo 2>/dev/null
+	echo export "$1" && local then "$@" export readonly $(pwd)
+		"$1" awk awk -eu printf sed grep ${HOME} readonly
+	sed export awk && $(pwd) "$@" then
+		2>/dev/null | -eu $(pwd) x=1 done echo then done grep | printf ${HOME} ${HOME}
+		then done -eu "$@" -eu x=1 ${HOME} -eu
+		"$1" && | --verbose grep sed export readonly
+	cd ${HOME} x=1 'quoted text' cd echo ${HOME} local --verbose --verbose
+		x=1 grep "$1" 'quoted text'
+	/usr/bin && --verbose "$@" test printf echo --verbose readonly printf -eu 2>/dev/null
+	export sed ${HOME} local "$@" then readonly local
+	then | echo /usr/bin /usr/bin --verbose
+x=1 | test -eu readonly 'quoted text' x=1 done | awk local awk awk -eu
+echo 2>/dev/null cd 2>/dev/null
+		echo ${HOME} -eu --verbose cd && done grep
+		"$1" echo cd done | awk
+	local | x=1 2>/dev/null "$1" "$1" | done x=1 readonly
+done ${HOME} export echo /usr/bin
+	/usr/bin export sed test
+	cd /usr/bin done done local done 'quoted text' "$@" then test
+		awk 2>/dev/null readonly x=1 $(pwd) "$@"
+	test test readonly "$@" local then done | | | -eu echo
+then done export x=1 "$@" echo then $(pwd) awk $(pwd) 2>/dev/null
+		2>/dev/null 'quoted text' local && grep "$1" $(pwd) | awk
+then sed local cd grep done
+--verbose 'quoted text' export ${HOME} export $(pwd) 2>/dev/null
+		export then echo "$1" export awk test --verbose awk ${HOME} export "$@" /usr/bin
+	readonly cd export && echo readonly grep 2>/dev/null printf "$1" sed && "$@"
+export printf then -eu echo /usr/bin local printf /usr/bin 'quoted text'
+		echo "$1" readonly export printf /usr/bin ${HOME}
+		&& 2>/dev/null --verbose
+local x=1 grep -eu &&
+$(pwd) done then sed readonly readonly $(pwd) ${HOME}
+	then 2>/dev/null 'quoted text' cd "$1" --verbose
+printf grep 'quoted text' then $(pwd) readonly $(pwd) printf $(pwd)
+echo | printf "$1" "$@" export export
+printf "$1" && test test test grep
+	sed readonly $(pwd) $(pwd)
+	test "$1" export printf x=1 && $(pwd) done then x=1 && ${HOME}
+		local 'quoted text' /usr/bin readonly
+readonly --verbose grep sed
+	"$1" 'quoted text' /usr/bin /usr/bin "$1" 'quoted text'
+	local grep $(pwd) && printf test readonly local 2>/dev/null grep
+		&& export --verbose --verbose && | local && /usr/bin sed $(pwd)
+		sed test local x=1 cd readonly echo $(pwd) local x=1
+		'quoted text' echo readonly echo /usr/bin ${HOME} local then grep $(pwd)
+		local export | -eu ${HOME} 2>/dev/null -eu "$@" local "$@" "$@" printf
+'quoted text' done then | awk | --verbose
+	awk && | then "$@" && "$@" local sed test | && echo then grep x=1
+| /usr/bin $(pwd) 'quoted text' "$@" /usr/bin x=1 -eu cd awk
+awk printf "$@" echo | export cd "$@" test awk
+	readonly /usr/bin "$1" x=1 | then cd "$@" ${HOME} local readonly ${HOME} sed sed
+	printf x=1 --verbose 'quoted text'
+		local && cd -eu printf ${HOME} --verbose /usr/bin x=1 then 2>/dev/null printf
+	grep "$@" 'quoted text' sed && && local 2>/dev/null /usr/bin cd sed "$@" sed
+	'quoted text' test /usr/bin /usr/bin -eu -eu sed done /usr/bin echo 2>/dev/null
+${HOME} $(pwd) done 'quoted text' /usr/bin test 'quoted text'
+	local export printf echo awk --verbose
+	$(pwd) test "$@" then "$1" cd 'quoted text' -eu 2>/dev/null test
+done printf local --verbose "$@"
+		then printf sed "$1" then sed grep "$1" && -eu echo ${HOME} "$1"
+cd readonly cd "$@" then test "$1" test
+	$(pwd) export | "$@" done cd "$1" done grep awk 'quoted text' echo test
+	${HOME} ${HOME} echo x=1 awk sed sed cd echo $(pwd) 'quoted text' 2>/dev/null
+	"$@" readonly export -eu --verbose
+	printf then | x=1 $(pwd) ${HOME} test
+	export "$1" 2>/dev/null printf sed done --verbose x=1
+	local printf grep 2>/dev/null export readonly
+		/usr/bin 'quoted text' test && | ${HOME} ${HOME} printf cd "$@" --verbose
+	then /usr/bin $(pwd) local "$1" 2>/dev/null 'quoted text' then
+		| $(pwd) "$1" readonly done echo grep test grep x=1 sed 'quoted text' done
+	${HOME} export export "$@" --verbose local | | 'quoted text' -eu /usr/bin grep
+	echo then then cd /usr/bin "$1" export 'quoted text'
+	'quoted text' then "$1" echo x=1 echo local
+		-eu | readonly $(pwd) echo echo "$@" grep echo awk echo $(pwd) echo -eu
+sed --verbose -eu "$@" "$1" /usr/bin 2>/dev/null
+local test echo | then awk 2>/dev/null export cd "$@" "$@" cd local --verbose
+	"$1" cd then echo cd echo /usr/bin
+	"$1" ${HOME} echo grep --verbose 2>/dev/null
+	'quoted text' 2>/dev/null done then 2>/dev/null -eu | test 'quoted text'
+printf "$@" $(pwd) $(pwd) printf grep --verbose awk && && 2>/dev/null then -eu
+grep then local sed awk readonly readonly
+"$@" test --verbose awk 2>/dev/null
+	test /usr/bin cd ${HOME} awk awk
+/usr/bin sed test test export /usr/bin cd local --verbose local
+	-eu | done printf then $(pwd) "$1" grep export sed grep readonly
+	/usr/bin | $(pwd) sed /usr/bin sed -eu && printf
+	echo "$@" cd --verbose && 2>/dev/null &&
+awk test cd -eu /usr/bin grep --verbose /usr/bin
+	done cd export && grep grep -eu && -eu printf readonly printf
+		&& readonly /usr/bin grep ${HOME} $(pwd)
+		-eu done readonly export -eu
+	local test "$1" cd grep grep "$@" 'quoted text' 'quoted text' echo readonly
+$(pwd) done then echo grep echo 2>/dev/null awk
+	/usr/bin --verbose local 'quoted text'
+	-eu then export && sed "$@" --verbose -eu readonly /usr/bin
+	printf 2>/dev/null && "$@" && test echo export --verbose
+cd $(pwd) local /usr/bin then done grep
+	done test done $(pwd) then export ${HOME} --verbose "$@" | awk grep $(pwd) &&
+	grep test printf -eu export
+	local /usr/bin readonly readonly grep awk cd then 'quoted text'
+	done test 2>/dev/null readonly 'quoted text' local x=1 "$1" ${HOME} then
+	/usr/bin readonly x=1 done done && local printf echo --verbose && /usr/bin
+-eu 2>/dev/null $(pwd) 'quoted text'
+		readonly grep printf 2>/dev/null done 'quoted text' cd awk -eu "$1" local "$1"
+		export ${HOME} /usr/bin -eu echo 'quoted text' | ${HOME} printf --verbose
+		| --verbose -eu && then test && 2>/dev/null
+		${HOME} awk && echo local --verbose
+sed && echo && $(pwd) 'quoted text'
+		$(pwd) readonly && --verbose printf
+x=1 -eu && && "$@" awk local -eu x=1 done 'quoted text' x=1 x=1 | local -eu
+	${HOME} export $(pwd) grep -eu 'quoted text' export awk | then
+		-eu then 2>/dev/null 'quoted text' "$1" done
+		readonly readonly 2>/dev/null 'quoted text' then $(pwd)
+-eu then echo $(pwd) --verbose ${HOME} then /usr/bin then
+$(pwd) $(pwd) printf /usr/bin && -eu "$1" grep echo cd "$@" printf awk "$1"
+		sed | x=1 grep awk echo awk grep readonly x=1
+	awk "$@" $(pwd) /usr/bin 2>/dev/null -eu && --verbose
+		local ${HOME} && grep local readonly echo "$1" done awk --verbose
+	--verbose | && --verbose then /usr/bin then then then test cd --verbose
+		printf /usr/bin readonly ${HOME} 'quoted text' printf
+$(pwd) "$@" x=1 then done && grep
+	2>/dev/null awk $(pwd) "$@" echo printf grep | echo
+		&& done readonly -eu cd --verbose echo printf test && "$@" x=1 local then
+	printf then readonly 2>/dev/null echo
+		${HOME} readonly 'quoted text' done echo $(pwd) grep 'quoted text' printf
+		local echo echo done local sed export /usr/bin sed x=1 $(pwd) $(pwd)
+-eu grep done -eu sed /usr/bin local $(pwd) cd sed
+		${HOME} 'quoted text' $(pwd)
+		"$1" --verbose | -eu ${HOME} then ${HOME} test done --verbose test cd &&
+	done export "$1" printf
+	then x=1 then then x=1 then && /usr/bin
+	grep --verbose readonly awk cd && -eu x=1 $(pwd) x=1 done readonly
+	test test --verbose local readonly cd awk done 2>/dev/null "$1" "$@" && $(pwd)
+		cd grep "$@" echo "$1" "$1" awk awk -eu printf
+		awk sed "$1" -eu printf 2>/dev/null export 2>/dev/null cd test echo
+	echo sed -eu && printf local --verbose then local cd ${HOME} awk ${HOME} readonly
+		&& then "$@" sed "$@" -eu
+'quoted text' export x=1 $(pwd) "$@" | | 'quoted text' --verbose "$@"
+	'quoted text' --verbose &&
+| export x=1 $(pwd) && "$1" done $(pwd)
+		-eu /usr/bin then $(pwd) --verbose local
+	readonly done local grep "$1" then grep && echo
+x=1 printf local local printf cd export
+/usr/bin | export ${HOME} printf readonly then
+2>/dev/null ${HOME} |
+&& local printf && export $(pwd)
+		done export "$1" "$1" "$1" /usr/bin $(pwd) grep -eu
+	export printf then "$@" printf 2>/dev/null -eu then printf
+	awk "$1" $(pwd) $(pwd) && -eu
+		"$1" 2>/dev/null test "$@" echo done --verbose 2>/dev/null --verbose
+	&& -eu done then local local local
+		2>/dev/null printf -eu 2>/dev/null
+		$(pwd) export done "$@" ${HOME} export export local awk
+x=1 --verbose awk -eu 2>/dev/null awk --verbose local sed grep grep
+	printf awk readonly | local ${HOME} 'quoted text' local x=1 grep | then
+		test "$1" x=1 awk x=1 "$@" x=1 && done awk echo printf
+		then awk 'quoted text' | $(pwd) awk local done done readonly
+		$(pwd) && /usr/bin ${HOME} cd 2>/dev/null 2>/dev/null
+-eu "$1" /usr/bin export ${HOME} echo /usr/bin
+	${HOME} 'quoted text' "$@" -eu awk $(pwd) then | 'quoted text' test
+	test --verbose /usr/bin -eu local then /usr/bin $(pwd) "$@" grep
+		readonly printf 'quoted text' x=1 && then then
+		awk x=1 | ${HOME} -eu 'quoted text' awk -eu test export
+	x=1 2>/dev/null 2>/dev/null ${HOME} -eu grep && test cd sed | --verbose
+/usr/bin awk 2>/dev/null test printf
+		done 2>/dev/null /usr/bin /usr/bin 'quoted text' --verbose awk "$1" 2>/dev/null
+	${HOME} $(pwd) x=1 $(pwd) "$1" &&
+sed /usr/bin cd ${HOME} grep sed -eu export then --verbose /usr/bin
+sed export readonly cd 'quoted text' -eu
+		printf --verbose cd && -eu /usr/bin $(pwd) "$@" readonly done sed echo
+	-eu && "$@" local sed then done export -eu sed readonly 'quoted text' $(pwd) /usr/bin
+done done then "$@" | -eu 2>/dev/null then sed 2>/dev/null
+		then x=1 $(pwd) "$@" --verbose
+	&& local ${HOME} 'quoted text' grep x=1 -eu -eu
+'quoted text' echo | done test "$1" export 2>/dev/null
+		'quoted text' done -eu readonly cd -eu "$1" /usr/bin -eu
+		/usr/bin echo && export x=1
+		grep awk cd done echo export x=1 /usr/bin awk "$1"
+		then 'quoted text' | export done "$@" -eu cd cd --verbose export -eu
+	2>/dev/null --verbose $(pwd) 'quoted text' ${HOME} done then --verbose "$1" $(pwd)
+readonly test ${HOME} test test cd x=1
+/usr/bin export 'quoted text' 2>/dev/null
+--verbose then --verbose $(pwd) 2>/dev/null /usr/bin --verbose echo test done
+		export | awk -eu | export done --verbose sed
+--verbose test x=1 test $(pwd) ${HOME} readonly
+awk -eu && /usr/bin "$1" -eu grep test test -eu then --verbose echo done | | printf
+"$@" | 2>/dev/null printf then printf echo "$@" x=1 | "$@" export x=1 then
+	echo ${HOME} awk --verbose cd echo 'quoted text'
+test 2>/dev/null test
+		export "$1" "$1" ${HOME} test 2>/dev/null echo printf awk ${HOME} && 2>/dev/null
+2>/dev/null grep printf "$@" sed local $(pwd) ${HOME}
+then && echo -eu then /usr/bin done local 'quoted text' x=1
+	${HOME} "$1" printf local
+x=1 local local cd echo
+cd --verbose x=1 test | sed printf
+local export 'quoted text' 'quoted text' readonly then --verbose -eu && local
+		test | -eu /usr/bin --verbose
+grep "$@" ${HOME} /usr/bin grep
+| "$1" then grep echo local cd
+printf "$@" export 'quoted text' grep
+	&& export cd 'quoted text' /usr/bin then test
+		| printf test then local grep export
+	&& test awk local export sed && then echo readonly /usr/bin
+	${HOME} /usr/bin readonly export cd x=1 done 'quoted text'
+"$@" "$@" awk local then ${HOME} sed readonly $(pwd) | "$@"
+/usr/bin done awk --verbose x=1 test done && "$1" sed
+		local export local local --verbose 2>/dev/null 'quoted text'
+		sed 'quoted text' "$@" awk && grep && -eu /usr/bin grep -eu readonly
+cd echo | --verbose "$@" readonly ${HOME} "$1" 2>/dev/null then
+		printf ${HOME} $(pwd) $(pwd) echo 'quoted text' -eu &&
+$(pwd) -eu grep printf /usr/bin "$@" test
+awk export 2>/dev/null $(pwd) test done grep "$1" $(pwd) 2>/dev/null
+		2>/dev/null "$@" ${HOME} 'quoted text' then printf printf local readonly
+		&& done local grep "$@" echo awk /usr/bin --verbose cd printf
+	then 'quoted text' echo readonly awk local echo --verbose
+	| done 2>/dev/null done ${HOME} then
+| && ${HOME} echo then /usr/bin /usr/bin | grep awk awk done done
+		test done && test awk 2>/dev/null
+	"$@" cd test 'quoted text'
+		--verbose echo then then -eu --verbose $(pwd) "$1" --verbose export printf
+	done export printf cd --verbose
+		x=1 'quoted text' x=1 grep export done /usr/bin $(pwd) sed
+		${HOME} done printf -eu 'quoted text' 'quoted text'
+x=1 --verbose readonly sed && local readonly $(pwd) done readonly "$1" awk
+		2>/dev/null 2>/dev/null sed ${HOME} /usr/bin
+	export sed test -eu echo "$1" cd && printf grep
+test readonly --verbose x=1 done
+	"$1" $(pwd) test grep $(pwd) "$1" && cd export grep --verbose awk echo grep 2>/dev/null
+	$(pwd) && local -eu ${HOME}
+	awk test -eu grep x=1
+	2>/dev/null cd sed --verbose && "$@"
+		test $(pwd) done ${HOME} grep | readonly --verbose sed then
+then done 2>/dev/null then /usr/bin local test && awk
+test echo echo readonly sed printf x=1 then $(pwd) "$1" "$1" && ${HOME}
+		"$1" | x=1 done /usr/bin "$@" ${HOME} done
+		echo grep --verbose 2>/dev/null grep sed ${HOME} /usr/bin
+grep test $(pwd) then /usr/bin
+export grep --verbose sed 2>/dev/null
+grep && sed 'quoted text' "$@" $(pwd) printf awk
+grep $(pwd) readonly printf local sed 'quoted text' local
+		local && 2>/dev/null x=1 export x=1 'quoted text' --verbose x=1 "$1" x=1 sed --verbose
+-eu ${HOME} 2>/dev/null done
+	"$@" "$1" "$1" readonly grep /usr/bin local printf 2>/dev/null 2>/dev/null awk
+	local export cd local -eu
+	| done awk --verbose /usr/bin awk
+		readonly test printf && done -eu export readonly
+	--verbose && test x=1 $(pwd) -eu $(pwd) sed
+	echo readonly 'quoted text' x=1 2>/dev/null
+	'quoted text' printf then printf /usr/bin ${HOME}
+export export readonly echo -eu
+	awk local local x=1 | readonly
+	&& -eu printf test --verbose 'quoted text' $(pwd) --verbose printf $(pwd) --verbose
+	&& local ${HOME} done 'quoted text' "$1" 2>/dev/null 'quoted text' grep cd x=1
+	local export "$@" /usr/bin x=1 && $(pwd)
+	local | 2>/dev/null local
+	grep readonly ${HOME} /usr/bin -eu 2>/dev/null
+		grep export --verbose printf
+printf "$1" $(pwd) /usr/bin test --verbose /usr/bin
+	readonly echo x=1 x=1 sed awk then "$@" awk test --verbose echo
+	"$@" grep printf test export 'quoted text'
+"$@" then | printf grep echo test export ${HOME} grep local
+		local printf x=1 test local test echo $(pwd) then 2>/dev/null
+		2>/dev/null sed test "$@" readonly then test test readonly
+	--verbose echo "$@" ${HOME} local /usr/bin x=1 "$@"
+cd 'quoted text' "$@" echo /usr/bin
+		&& grep sed /usr/bin && export
+		grep local test export readonly awk awk test /usr/bin
+		test printf "$@" 'quoted text' 2>/dev/null done then
+		test ${HOME} export awk then done echo awk printf export export echo grep 'quoted text'
+		-eu | awk "$@" 2>/dev/null local && sed sed then grep printf done then
+		| awk /usr/bin cd then awk done && then x=1 grep sed test
+then -eu ${HOME} ${HOME} grep then
+	$(pwd) 'quoted text' | export printf
+		readonly 'quoted text' local echo awk test sed --verbose export /usr/bin
+	awk --verbose && 2>/dev/null /usr/bin export 'quoted text'
+		export then 'quoted text' x=1 'quoted text' awk "$1" grep cd
+		then cd grep local && ${HOME} 'quoted text'
+grep && 'quoted text' -eu --verbose cd && $(pwd) awk awk $(pwd)
+	2>/dev/null 'quoted text' "$1" "$@"
+		'quoted text' sed ${HOME} "$1" test |
+		x=1 printf 2>/dev/null echo
+		export "$@" done ${HOME} "$1" 'quoted text' local local export
+local done ${HOME} /usr/bin readonly -eu && --verbose awk export &&
+	readonly "$1" ${HOME} echo cd then x=1 "$@" sed && echo 'quoted text'
+sed export done -eu grep export "$1" "$1"
+&& echo 2>/dev/null --verbose 'quoted text' -eu printf "$@" /usr/bin readonly
+	sed && export grep "$1" sed export && --verbose export
+	--verbose ${HOME} $(pwd) awk echo cd $(pwd) 'quoted text'
+--verbose 2>/dev/null "$1" --verbose export
+		printf ${HOME} done export
+		cd /usr/bin $(pwd) ${HOME} &&
+	"$1" local done local
+${HOME} && local "$1" export "$@"
+/usr/bin $(pwd) 'quoted text' "$1" -eu /usr/bin ${HOME}
+		$(pwd) sed 'quoted text' "$1" done
+		awk echo readonly && | 'quoted text' 'quoted text' && test sed --verbose
+	'quoted text' "$@" ${HOME} sed
+		grep export /usr/bin $(pwd)
+		sed x=1 2>/dev/null done test readonly "$1" /usr/bin export
+-eu /usr/bin then awk grep | sed $(pwd) sed test "$1" echo sed "$@"
+/usr/bin --verbose --verbose
+x=1 grep awk cd printf sed x=1 'quoted text' /usr/bin local test x=1
+	"$1" export ${HOME} test readonly "$1" sed done local awk cd $(pwd) "$1"
+	| -eu -eu 2>/dev/null sed printf /usr/bin export test test "$1" "$1" cd 2>/dev/null
+		| done 'quoted text' 2>/dev/null
+"$1" local ${HOME} -eu test | | 2>/dev/null | x=1 local grep "$1"
+	awk grep x=1 cd $(pwd) cd
+awk --verbose grep local awk
+	/usr/bin && 'quoted text' done --verbose sed "$@" local x=1 test done
+	local echo awk /usr/bin grep /usr/bin echo
+'quoted text' sed awk echo sed -eu cd then sed local sed 2>/dev/null
+		printf grep then /usr/bin | /usr/bin --verbose /usr/bin "$@"
+	test x=1 awk awk done /usr/bin x=1 'quoted text' $(pwd)
+	then printf x=1 --verbose local
+local x=1 'quoted text' grep
+cd test readonly export export
+		| ${HOME} awk printf sed && x=1 | | x=1 && local readonly x=1 "$1" && printf
+	x=1 "$1" export awk x=1 done --verbose echo done "$1" -eu "$@" $(pwd)
+		sed readonly /usr/bin 'quoted text' && sed /usr/bin export readonly
+	/usr/bin "$1" 'quoted text' 2>/dev/null
+grep export && x=1 printf -eu export
+	then /usr/bin awk echo 'quoted text'
+		export 'quoted text' test cd printf done cd -eu ${HOME} local "$1"
+${HOME} x=1 test echo "$1"
+	test printf /usr/bin export "$@" "$1" echo sed export
+	&& test "$1" cd 2>/dev/null sed done readonly 'quoted text' done -eu local
+	test then sed then x=1 /usr/bin && echo then echo test then x=1 'quoted text'
+	x=1 $(pwd) x=1 echo | cd | export
+	-eu /usr/bin printf awk export $(pwd)
+	then && printf done grep echo
+$(pwd) | test /usr/bin local && -eu x=1 sed -eu echo
+	grep $(pwd) --verbose && && ${HOME} done /usr/bin export local 2>/dev/null
+		'quoted text' /usr/bin done
+${HOME} cd export printf test readonly -eu --verbose cd && ${HOME} "$@"
+| test echo sed export awk | --verbose 'quoted text'
+	"$@" --verbose | test 2>/dev/null -eu printf -eu readonly
+		2>/dev/null done readonly | x=1 --verbose grep -eu echo "$1" done "$@" "$1" readonly
+		--verbose test echo printf 2>/dev/null local awk $(pwd) x=1 ${HOME}
+local readonly | export --verbose echo 'quoted text'
+${HOME} 2>/dev/null cd -eu "$1" "$1" awk -eu 'quoted text'
+readonly printf -eu x=1 x=1 printf ${HOME} sed echo done "$@" sed cd export
+/usr/bin 2>/dev/null grep sed cd then grep then "$1" readonly awk
+		awk grep awk cd echo /usr/bin ${HOME} "$@" 2>/dev/null
+local done ${HOME} --verbose done echo local done
+then 'quoted text' printf grep printf 2>/dev/null cd grep x=1 "$@" printf
+'quoted text' sed $(pwd) cd grep
+		export printf test --verbose && sed readonly x=1 test 'quoted text' "$@" --verbose
+		x=1 x=1 ${HOME} local 'quoted text' | x=1 readonly ${HOME} cd grep test
+/usr/bin 'quoted text' $(pwd) -eu then readonly "$1"
+		2>/dev/null cd | "$1" 'quoted text'
+readonly test 2>/dev/null
+"$1" grep x=1 grep readonly &&
+		test grep ${HOME} awk | -eu ${HOME} $(pwd) sed -eu --verbose
+	sed awk printf "$@" "$1" grep ${HOME} "$@" local | $(pwd) done test then
+echo echo echo "$@" done printf awk export -eu test readonly cd readonly
+		echo x=1 echo grep -eu done export cd done readonly printf && readonly then
+echo --verbose done sed printf x=1 local | "$1" awk echo && echo $(pwd) printf echo
+done $(pwd) cd "$@" printf awk awk ${HOME}
+	readonly readonly | --verbose
+		/usr/bin x=1 done echo
+		x=1 test 'quoted text' $(pwd) "$@" x=1
+/usr/bin ${HOME} && && awk 2>/dev/null ${HOME}
+	2>/dev/null sed 2>/dev/null "$1" then local | echo test
+		readonly test sed 'quoted text' awk export | then ${HOME}
+echo then printf then export local echo /usr/bin readonly
+		x=1 cd test 'quoted text' x=1 sed 'quoted text' 'quoted text'
+$(pwd) /usr/bin 'quoted text' | grep sed -eu local 'quoted text'
+		2>/dev/null $(pwd) grep /usr/bin
+		then grep "$1" $(pwd) then /usr/bin x=1 ${HOME} "$1" --verbose then test | printf
+	/usr/bin "$1" test awk grep export && "$@" /usr/bin export cd ${HOME}
+		cd 2>/dev/null echo ${HOME} done test test readonly
+cd then && 2>/dev/null printf "$@" | ${HOME} -eu then
+	sed $(pwd) done $(pwd) sed "$@" printf $(pwd) "$@" "$1" 2>/dev/null
+	then $(pwd) then $(pwd) readonly done sed /usr/bin "$@" then /usr/bin
+	-eu "$1" export $(pwd) done printf echo "$1"
+	&& done | sed cd test ${HOME} echo "$1"
+		${HOME} 'quoted text' | --verbose then | local test 'quoted text'
+	test done ${HOME} $(pwd) then "$1" $(pwd) x=1 local -eu x=1 then cd cd 2>/dev/null
+-eu "$@" readonly --verbose ${HOME} printf "$1"
+| && done x=1 awk ${HOME} --verbose readonly sed printf ${HOME} /usr/bin
+	echo /usr/bin -eu 'quoted text' sed "$1" awk
+	"$1" -eu "$@" /usr/bin /usr/bin "$@" awk sed
+$(pwd) grep /usr/bin 'quoted text'
+		"$1" sed && "$@" printf "$1" local
+	'quoted text' "$1" "$@" 'quoted text' 'quoted text' cd echo
+		then "$1" x=1 'quoted text' cd cd
+		"$@" ${HOME} x=1 cd local readonly x=1 printf | then | readonly ${HOME} && export
+		local export "$1" awk x=1 |
+		$(pwd) then $(pwd) "$1" -eu sed "$1" sed -eu export
+cd ${HOME} sed grep -eu export 'quoted text'
+	"$@" /usr/bin test $(pwd) done awk test readonly
+	printf awk readonly awk grep "$1" done sed readonly && then -eu then sed
+		local "$1" --verbose readonly done && printf test ${HOME} -eu "$@" sed
+	${HOME} /usr/bin local "$1" test --verbose
+	printf local && export local echo 2>/dev/null "$@"
+/usr/bin readonly ${HOME} test printf
+	2>/dev/null sed grep then && "$@" -eu printf grep -eu echo $(pwd)
+x=1 local -eu cd done readonly test x=1 $(pwd)
+		echo local --verbose "$1" --verbose done
+	x=1 "$1" -eu cd awk 'quoted text' then sed
+	printf --verbose local | echo | 2>/dev/null done then export "$@" done 'quoted text'
+		$(pwd) "$1" awk test ${HOME}
+	export awk then x=1 "$1" echo && "$@" test readonly 2>/dev/null
+	export /usr/bin readonly --verbose
+		--verbose export sed x=1 | 'quoted text' -eu "$@" --verbose
+	printf readonly done export 2>/dev/null
+		/usr/bin readonly x=1 | grep x=1 cd "$1" readonly grep awk "$1"
+then export && test cd
+test | $(pwd) --verbose $(pwd) | grep then
+test && test sed ${HOME} x=1
+		$(pwd) ${HOME} 'quoted text' printf test grep | $(pwd)
+	'quoted text' local /usr/bin && awk
+--verbose --verbose cd readonly
+		then x=1 "$1" && "$@" 2>/dev/null test | "$@" | echo
+printf 2>/dev/null | done ${HOME} 'quoted text'
+readonly grep test "$1" x=1 x=1 done awk $(pwd)
+	'quoted text' local && then awk export x=1 echo test "$@"
+grep export export 'quoted text' local grep done 'quoted text'
+		grep grep "$1" awk export cd "$@" --verbose
+		sed local ${HOME} done sed awk cd -eu cd -eu cd
+		"$1" /usr/bin test local $(pwd) --verbose 2>/dev/null readonly cd "$@"
+x=1 x=1 ${HOME} | 'quoted text' $(pwd) -eu awk echo cd $(pwd) cd export export
+		"$1" awk ${HOME} readonly grep export x=1 readonly done $(pwd) readonly
+		test $(pwd) then | 'quoted text' sed ${HOME} grep
+		export done "$@" "$@" readonly grep
+		&& then printf /usr/bin
+then sed awk 'quoted text' printf readonly ${HOME} | printf then awk
+		-eu export /usr/bin grep x=1 "$1" echo
+&& local cd grep | grep "$@" $(pwd) 2>/dev/null grep test cd readonly ${HOME}
+		2>/dev/null test -eu --verbose grep "$@" 2>/dev/null sed done cd export /usr/bin
+		/usr/bin --verbose | sed $(pwd) awk && "$@" readonly ${HOME}
+		done "$1" ${HOME} echo "$@" --verbose
+	"$@" sed test awk local "$@" -eu local --verbose
+	then printf readonly then sed grep
+	/usr/bin echo 'quoted text' export awk local
+	cd readonly && $(pwd) then
+done --verbose export awk | cd "$@" x=1 2>/dev/null sed cd --verbose x=1 awk
+${HOME} sed "$1" && grep then "$@" sed
+awk 2>/dev/null readonly $(pwd) test
+local --verbose then /usr/bin
+&& 2>/dev/null sed --verbose grep then sed readonly --verbose
+| export cd ${HOME} --verbose "$@" ${HOME} 'quoted text'
+		then $(pwd) export ${HOME} awk --verbose awk --verbose sed && ${HOME}
+x=1 sed "$1" ${HOME} 2>/dev/null ${HOME}
+		echo "$@" /usr/bin awk 'quoted text'
+		cd export sed test then grep 2>/dev/null
+		| grep ${HOME} 2>/dev/null
+--verbose echo test ${HOME} export awk printf ${HOME} --verbose awk
+test then $(pwd) export ${HOME} sed awk "$1" then "$@" "$@" "$1" done | readonly
+	echo "$@" cd printf test
+	&& then 2>/dev/null then "$@"
+		"$@" --verbose export "$@" 'quoted text' printf | && test grep local export 2>/dev/null
+$(pwd) ${HOME} --verbose
+	then export --verbose x=1 --verbose
+		done awk && then 'quoted text' printf local grep
+		then printf readonly x=1 "$1" export local 'quoted text' export
+then 'quoted text' local awk cd grep -eu cd test
+		done export $(pwd) echo "$@" echo x=1 done readonly sed --verbose
+	local "$@" x=1 | ${HOME}
+		cd | test done /usr/bin then "$@" test test ${HOME} "$1"
+		readonly grep awk | -eu && export sed ${HOME} ${HOME} x=1 cd test
+test then grep "$1" done echo sed local cd /usr/bin cd then grep export cd sed
+	--verbose -eu /usr/bin printf ${HOME}
+&& ${HOME} --verbose done then local readonly /usr/bin export "$@" echo local
+	local local echo export && $(pwd) awk -eu "$1" local then 'quoted text'
+"$@" export -eu 2>/dev/null grep $(pwd) export
+	x=1 cd "$@" 2>/dev/null ${HOME} echo 'quoted text'
+		"$@" && $(pwd) awk sed ${HOME} done then | /usr/bin grep x=1 awk readonly
+	"$1" readonly echo 2>/dev/null
+| && ${HOME} 2>/dev/null echo /usr/bin 2>/dev/null 2>/dev/null
+	grep then local done "$1" echo local && $(pwd)
+		'quoted text' /usr/bin $(pwd) 2>/dev/null sed
+	sed echo "$1" && ${HOME} "$@" $(pwd)
+		"$@" done --verbose -eu "$@" | --verbose
+	printf test grep readonly printf ${HOME} local grep export local
+		x=1 "$@" sed && export
+	then --verbose export /usr/bin awk printf echo echo
+	cd $(pwd) | "$@" awk grep /usr/bin "$@" local sed -eu "$@"
+	cd $(pwd) ${HOME} "$@" readonly
+	sed grep -eu "$@" /usr/bin
+"$@" $(pwd) x=1 "$@" "$1" /usr/bin x=1 2>/dev/null $(pwd) readonly awk /usr/bin
+	local ${HOME} | 'quoted text'
+		test && --verbose ${HOME} awk ${HOME} readonly
+	awk 2>/dev/null -eu readonly 'quoted text' done 'quoted text' 2>/dev/null
+	x=1 -eu then export 2>/dev/null
+	grep awk x=1 "$@" "$@"
+		'quoted text' x=1 test awk
+	'quoted text' "$1" "$1" ${HOME} 'quoted text' readonly awk --verbose
+$(pwd) then done && "$1" awk $(pwd) printf then done grep | x=1 'quoted text'
+| local export then grep "$1" echo then x=1 x=1 /usr/bin
+-eu echo $(pwd) 2>/dev/null
+	grep "$1" test then 2>/dev/null then readonly then 'quoted text' readonly sed
+	local /usr/bin readonly local -eu | $(pwd) $(pwd) done echo readonly -eu export
+		local | ${HOME} sed | $(pwd)
+echo grep -eu printf 'quoted text' readonly
+	printf local 2>/dev/null "$1" 2>/dev/null $(pwd) $(pwd) x=1 awk /usr/bin "$@"
+		2>/dev/null -eu "$@" cd awk export sed echo /usr/bin grep | grep x=1
+"$@" ${HOME} local export export test --verbose readonly then 'quoted text' then
+		x=1 /usr/bin done -eu --verbose
+		sed printf ${HOME} printf 2>/dev/null x=1 x=1
+	grep done done x=1 x=1
+then readonly printf printf grep "$@" --verbose done local
+		$(pwd) && sed local readonly | done && &&
+		printf local 'quoted text' "$@" && "$@" then $(pwd)
+		echo "$1" | readonly printf readonly export export "$1" && $(pwd)
+		awk export grep test $(pwd) readonly printf
+		&& --verbose | "$@" $(pwd)
+--verbose test grep "$@" then sed local
+&& x=1 then | /usr/bin readonly
+	export then local | | $(pwd) local 'quoted text'
+export --verbose -eu x=1 ${HOME} sed && cd --verbose
+-eu /usr/bin awk export done local
+	local export && sed "$@" sed $(pwd) "$@" x=1 then done
+		readonly "$@" 2>/dev/null export $(pwd) cd grep test ${HOME} $(pwd)
+-eu /usr/bin "$1" "$@" test then done local "$@" then readonly |
+		'quoted text' -eu cd x=1 cd
+'quoted text' $(pwd) export "$@" awk
+		${HOME} -eu -eu | && 'quoted text' --verbose
+		2>/dev/null $(pwd) 2>/dev/null -eu 2>/dev/null && echo -eu $(pwd) 2>/dev/null
+${HOME} readonly "$1" ${HOME} sed "$@" 'quoted text' printf 2>/dev/null
+-eu && | $(pwd) /usr/bin "$@"
+	/usr/bin local x=1 2>/dev/null done local
+sed export echo then awk
+cd cd && "$@" readonly 'quoted text' local
+		done local | $(pwd) x=1 | && sed $(pwd)
+	export cd "$1" && "$1" "$1" 'quoted text' done
+		'quoted text' 2>/dev/null "$1" printf awk
+	2>/dev/null /usr/bin readonly && /usr/bin -eu 'quoted text' && && export
+	/usr/bin then x=1 awk ${HOME} sed done readonly local then readonly
+	'quoted text' readonly local test awk printf local && /usr/bin
+	test local sed readonly printf
+	export -eu --verbose cd cd grep done sed 2>/dev/null
+		-eu then test 'quoted text' cd "$1" then 'quoted text' export
+	awk $(pwd) /usr/bin grep --verbose $(pwd) then awk "$1" | "$@" "$1" sed --verbose
+		-eu readonly "$@" /usr/bin --verbose "$1" 'quoted text'
+		printf 2>/dev/null cd "$@" $(pwd) local export readonly test /usr/bin
+	sed | --verbose "$1" x=1
+		grep export && sed $(pwd) grep | -eu sed && $(pwd) $(pwd)
+	echo "$@" then -eu "$@" ${HOME}
+sed ${HOME} 2>/dev/null "$@" then | awk readonly $(pwd) sed echo
+		x=1 'quoted text' -eu
+	$(pwd) then --verbose && && $(pwd) | "$@" && "$@" awk grep test 'quoted text'
+		readonly "$@" local /usr/bin then grep 2>/dev/null
+	printf grep done && echo x=1 -eu ${HOME} 2>/dev/null $(pwd)
+	${HOME} "$@" 'quoted text' cd
+awk then --verbose grep export
+		printf "$@" | test awk x=1 x=1 sed sed
+		/usr/bin done local echo ${HOME} 2>/dev/null cd then | x=1 "$@" ${HOME} | -eu
+		2>/dev/null cd done ${HOME} -eu cd $(pwd) awk done grep && local 'quoted text'
+--verbose 'quoted text' sed grep awk sed awk | --verbose 'quoted text'
+printf /usr/bin -eu x=1 --verbose test cd export -eu cd awk /usr/bin grep "$1"
+	--verbose 'quoted text' printf 'quoted text' local && -eu -eu "$1" "$1"
+		local | && echo local export /usr/bin
+	x=1 grep then 2>/dev/null done | /usr/bin /usr/bin
+		local 'quoted text' readonly export export "$1" export
+		readonly local 2>/dev/null -eu --verbose
+	/usr/bin awk $(pwd) sed local readonly /usr/bin --verbose
+export cd sed awk printf sed echo -eu -eu test x=1 $(pwd) grep echo
+		--verbose 'quoted text' x=1 grep readonly echo echo sed ${HOME} "$@" printf
+echo printf -eu sed "$@" | echo test
+"$1" && | "$@" export /usr/bin
+--verbose sed done done done | 'quoted text' local 'quoted text'
+	--verbose test 'quoted text' --verbose cd && test x=1
+		local echo 'quoted text' export then /usr/bin
+	"$1" echo && 2>/dev/null local "$@" 2>/dev/null
+		"$@" && "$1" ${HOME} "$@" &&
+local $(pwd) $(pwd) x=1 --verbose ${HOME}
+2>/dev/null local awk sed then export "$@" && cd echo printf
+test | awk test x=1 --verbose "$1" done
+${HOME} echo 2>/dev/null && "$1" readonly done then /usr/bin x=1 printf then |
+| | done 2>/dev/null awk -eu awk &&
+$(pwd) -eu $(pwd) then readonly && "$1" readonly --verbose "$@" readonly
+echo $(pwd) then readonly awk done "$@" $(pwd) test x=1 /usr/bin
+		sed cd 'quoted text' cd cd && "$1" $(pwd) sed
+	grep "$@" test printf local --verbose local printf grep x=1 export
+		local 2>/dev/null sed test 2>/dev/null
+		"$@" export sed "$@" "$@" /usr/bin awk readonly ${HOME} /usr/bin /usr/bin then
+	&& --verbose sed printf test 'quoted text' ${HOME} 2>/dev/null
+	readonly "$@" "$@" ${HOME} printf | x=1 -eu then then /usr/bin then
+		sed done then sed then echo | grep && ${HOME} ${HOME}
+	awk --verbose "$1" readonly "$@"
+test then then sed test -eu grep 'quoted text' export /usr/bin
+printf 'quoted text' export "$1" ${HOME} $(pwd) /usr/bin
+		sed 2>/dev/null printf printf then done done 2>/dev/null
+		test x=1 cd cd echo | echo && -eu /usr/bin
+	/usr/bin cd && test x=1 sed ${HOME} test x=1 "$@" done done | local
+cd then test && grep "$1" ${HOME} 'quoted text' && sed x=1 echo 'quoted text' grep
+		printf done export 2>/dev/null test echo echo "$1" && /usr/bin
+sed export printf local -eu $(pwd) $(pwd) export "$1" printf
+		local echo awk 'quoted text' | -eu /usr/bin
+	grep x=1 "$@" grep --verbose
+	then 'quoted text' 'quoted text'
+	-eu "$1" 'quoted text' 'quoted text' echo
+	2>/dev/null echo /usr/bin $(pwd) 2>/dev/null sed ${HOME} && 'quoted text'
+"$1" sed x=1 printf |
+x=1 grep local awk --verbose test x=1 2>/dev/null
+		export $(pwd) --verbose done | printf grep | echo grep sed -eu && -eu
+	sed "$1" printf "$1" grep awk "$1" -eu && "$@" $(pwd) readonly then 2>/dev/null
+	test 'quoted text' echo "$@" ${HOME} test -eu
+		local sed readonly x=1 -eu "$1" 2>/dev/null x=1
+		local grep 2>/dev/null printf readonly grep readonly "$@" -eu --verbose | grep
+	printf x=1 | test --verbose then awk export /usr/bin ${HOME} grep export
+		'quoted text' echo /usr/bin echo printf 2>/dev/null
+	&& local readonly /usr/bin readonly printf test then
+	| && awk "$@" | 'quoted text' grep /usr/bin
+		cd printf | printf then test done then printf "$@" grep printf
+	"$@" grep 2>/dev/null x=1 printf awk grep done local local
+	/usr/bin && then grep && "$1" grep local local test grep "$1" --verbose
+--verbose -eu $(pwd) ${HOME} "$1" grep export readonly "$1" local
+x=1 readonly readonly local grep "$@" sed grep echo
+	then local echo "$@" printf
+	$(pwd) $(pwd) printf done "$@" readonly | ${HOME} readonly $(pwd) | grep
+		test ${HOME} test 'quoted text'
+	${HOME} grep awk --verbose x=1 2>/dev/null
+	readonly grep $(pwd) sed && printf "$@" echo awk -eu /usr/bin cd --verbose
+	export 'quoted text' x=1 test then 'quoted text' x=1 grep printf local
+	| echo 2>/dev/null $(pwd) $(pwd) x=1 "$@" readonly $(pwd) grep then then done
+	&& x=1 test $(pwd) echo x=1 && export
+	2>/dev/null local awk cd awk /usr/bin 2>/dev/null
+		test --verbose $(pwd) printf awk awk cd "$@" /usr/bin
+--verbose export sed export sed cd grep readonly | done
+		/usr/bin -eu cd printf local
+		readonly local done readonly | done | -eu /usr/bin
+	grep test then $(pwd) -eu printf "$1" 'quoted text' done printf $(pwd)
+local export test echo local cd -eu x=1 'quoted text' --verbose sed --verbose
+		awk grep "$@" readonly awk "$@" x=1 done 'quoted text' cd readonly
+${HOME} "$1" awk && done readonly cd sed $(pwd) && x=1
+readonly && awk echo 2>/dev/null echo --verbose
+		-eu cd cd local --verbose && x=1 printf | grep printf
+		x=1 sed $(pwd) --verbose awk export grep test awk echo $(pwd) --verbose readonly
+	/usr/bin 'quoted text' readonly test
+--verbose readonly --verbose then ${HOME} local awk 2>/dev/null echo 'quoted text'
+	grep $(pwd) local cd && 'quoted text' cd sed awk
+local grep export export
+cd cd $(pwd) $(pwd) cd then | cd awk test printf ${HOME} $(pwd)
+		awk --verbose export /usr/bin 2>/dev/null 'quoted text' printf -eu 'quoted text'
+	"$1" "$1" sed "$@" 2>/dev/null local ${HOME} x=1 'quoted text' 'quoted text'
+		then cd cd sed | "$1" x=1 local x=1 2>/dev/null "$@" "$@" && --verbose
+	"$@" export printf 2>/dev/null | awk export "$1" $(pwd) then local echo then
+		cd echo | /usr/bin $(pwd) cd printf 2>/dev/null && grep awk readonly
+| "$1" -eu echo grep -eu --verbose
+-eu /usr/bin /usr/bin /usr/bin printf local
+	x=1 test test printf --verbose
+	"$@" | x=1 awk awk && $(pwd) printf grep sed done local -eu local export cd &&
+		test then done /usr/bin 2>/dev/null cd | export -eu 2>/dev/null echo
+done test then 2>/dev/null cd /usr/bin then then cd cd grep printf 'quoted text'
+| then "$1" sed --verbose | --verbose
+	awk && readonly /usr/bin sed -eu ${HOME} export --verbose
+	sed | --verbose && printf cd 2>/dev/null --verbose $(pwd) then
+	echo export "$@" 'quoted text' awk "$@" sed
+readonly && && 'quoted text' sed awk x=1 echo printf ${HOME}
+	printf readonly -eu x=1 then ${HOME} | readonly --verbose
+	"$@" --verbose 'quoted text' then
+		local /usr/bin then awk sed --verbose cd then "$@" x=1 done cd -eu done
+readonly awk echo && 2>/dev/null ${HOME} test awk | $(pwd) test
+	local echo local --verbose then test readonly readonly
+	"$@" "$@" ${HOME} ${HOME} then export
+		&& then $(pwd) done /usr/bin $(pwd) done x=1 awk export
+	echo done /usr/bin cd awk $(pwd) -eu
+		"$1" x=1 sed --verbose
+then && --verbose $(pwd) --verbose echo
+${HOME} grep cd cd && sed export && "$@" -eu
+&& ${HOME} 2>/dev/null awk readonly
+		readonly done x=1 && "$1" 'quoted text'
+		${HOME} readonly local sed readonly cd -eu
+		awk readonly /usr/bin awk cd "$@" 'quoted text' /usr/bin then --verbose cd readonly
+		echo printf -eu | && 'quoted text' 'quoted text' grep
+	then export local cd printf test "$1" then readonly x=1 && 2>/dev/null x=1
+	--verbose 'quoted text' /usr/bin
+		export $(pwd) -eu -eu
+${HOME} cd 2>/dev/null readonly
+${HOME} "$1" readonly /usr/bin x=1 /usr/bin
+	test local local x=1 -eu ${HOME} readonly $(pwd)
+	cd --verbose done readonly then readonly echo
+		"$@" ${HOME} ${HOME} export echo local then --verbose --verbose
+		--verbose then export printf -eu export 2>/dev/null
+readonly && 'quoted text' grep cd ${HOME} ${HOME} awk
+	$(pwd) cd --verbose done "$1" "$1" x=1
+		awk -eu sed /usr/bin printf 'quoted text' echo then --verbose cd $(pwd) ${HOME}
+		/usr/bin /usr/bin /usr/bin
+		readonly local "$@" $(pwd) 2>/dev/null /usr/bin "$@" cd cd -eu grep
+		x=1 | --verbose printf ${HOME}
+x=1 export export ${HOME} 2>/dev/null
+local sed 2>/dev/null test export --verbose
+		printf "$@" local 'quoted text' "$@"
+	echo cd awk export then
+		printf ${HOME} readonly /usr/bin then readonly readonly
+$(pwd) "$@" sed --verbose "$@" x=1 $(pwd) x=1 -eu test -eu --verbose readonly
+x=1 "$@" "$1" test sed readonly 'quoted text'
+/usr/bin 'quoted text' -eu && | echo /usr/bin && --verbose sed sed printf
+/usr/bin then local test grep done -eu -eu readonly "$@" awk
+		readonly test "$1" 'quoted text' done readonly local
+printf readonly then
+		awk local $(pwd) awk "$1" && && x=1 echo sed
+$(pwd) readonly awk then /usr/bin sed cd export
+awk ${HOME} 2>/dev/null --verbose && -eu --verbose readonly 'quoted text'
+		"$@" "$1" awk then "$1" x=1 && | echo echo | awk "$@"
+		then -eu then --verbose x=1 'quoted text' "$@" local readonly
+	echo | "$@" echo awk "$1" $(pwd) printf echo 2>/dev/null 2>/dev/null awk done
+	echo test /usr/bin then $(pwd) --verbose awk ${HOME} /usr/bin grep ${HOME} /usr/bin
+		awk test && -eu then echo export then 'quoted text' printf
+	export echo && sed sed export grep local
+	"$1" printf awk echo cd done | "$1" done && awk done x=1 -eu grep 'quoted text'
+-eu readonly done "$1" export local
+printf "$1" then "$@" | ${HOME} && readonly x=1 readonly
+-eu then local export "$1" "$1" sed grep "$@" "$1" "$@" -eu x=1 x=1
+	--verbose "$@" 'quoted text' grep readonly
+done | $(pwd) && test ${HOME} $(pwd) then export local 'quoted text'
+	| | && export "$@" 2>/dev/null grep /usr/bin export "$1" $(pwd) done
+		echo && local $(pwd) x=1
+		&& readonly "$@" $(pwd) grep -eu
+done /usr/bin "$@" && "$@" 2>/dev/null
+	x=1 local cd echo local 2>/dev/null cd --verbose
+	cd --verbose 2>/dev/null test done
+local $(pwd) x=1 printf readonly local test sed
+		--verbose 2>/dev/null sed then readonly done readonly "$1" readonly test
+		export ${HOME} test ${HOME} --verbose "$@" awk && awk sed "$@" 2>/dev/null
+	"$1" test grep grep grep -eu echo /usr/bin
+	export grep "$@" x=1 && $(pwd) then sed readonly /usr/bin export export test echo
+sed test -eu && x=1 "$@" grep export
+test && | cd /usr/bin ${HOME} done "$@" ${HOME} $(pwd)
+		$(pwd) && --verbose awk
+		-eu "$@" /usr/bin test awk $(pwd) -eu test
+		sed test done | && $(pwd) test sed /usr/bin
+		"$1" readonly && /usr/bin
+		cd awk x=1 cd printf then /usr/bin 2>/dev/null -eu local
+--verbose | 'quoted text' grep test then "$@" cd readonly
+	done echo --verbose | /usr/bin 2>/dev/null "$1"
+	cd $(pwd) awk | "$@" export local "$1" ${HOME} /usr/bin
+	test local grep /usr/bin echo "$@" readonly awk echo x=1 readonly
+printf sed export ${HOME} test cd printf
+-eu 'quoted text' x=1
+		echo "$@" then x=1 awk sed echo 2>/dev/null "$1"
+		export 2>/dev/null 2>/dev/null
+local $(pwd) readonly local local "$1" "$1" $(pwd) $(pwd) awk
+		cd local /usr/bin --verbose echo export "$@" -eu "$@" export "$@"
+		| /usr/bin echo grep printf -eu $(pwd) awk /usr/bin awk $(pwd) | awk x=1
+		"$1" sed cd 'quoted text' awk x=1 ${HOME}
+	local printf --verbose then 2>/dev/null printf ${HOME} x=1 export grep
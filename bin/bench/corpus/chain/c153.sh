@@ -0,0 +1,2001 @@
+"$@" then $(pwd) "$1" /usr/bin grep x=1 then --verbose
+	-eu -eu then readonly | -eu echo --verbose grep 'quoted text'
+		awk 2>/dev/null then local
+	printf readonly 2>/dev/null printf grep "$@" "$1"
+	${HOME} && echo /usr/bin /usr/bin $(pwd) readonly export "$1" x=1 --verbose "$1"
+$(pwd) echo $(pwd) /usr/bin awk local $(pwd) x=1 && export /usr/bin
+x=1 2>/dev/null done test local readonly
+	| echo --verbose test | done grep then && x=1 export readonly then x=1 done grep
+		--verbose x=1 x=1 $(pwd) then $(pwd) awk cd sed grep then -eu "$@" && then printf
+		done done sed $(pwd) grep readonly cd export done x=1
+	${HOME} sed "$1" sed && | readonly export local x=1 $(pwd)
+		"$@" then -eu x=1 grep "$1" -eu done printf
+	| then local && local grep test local done echo sed
+	2>/dev/null sed then test sed cd done && 'quoted text'
+cd awk export && 2>/dev/null "$@" grep "$@" "$@" then awk grep then
+	then $(pwd) ${HOME} /usr/bin readonly
+		done printf printf grep
+"$1" echo echo echo cd /usr/bin local
+		| sed readonly test "$@" /usr/bin
+		--verbose export done test
+| export echo && ${HOME} /usr/bin
+&& 'quoted text' then ${HOME} printf test done x=1
+		readonly -eu /usr/bin "$1" grep test "$1" --verbose -eu --verbose
+&& x=1 cd done printf -eu $(pwd)
+		grep $(pwd) export printf | 'quoted text' sed test cd | sed
+		&& cd && "$1" x=1 done --verbose $(pwd) export 'quoted text' readonly --verbose
+		grep cd x=1 readonly awk test readonly 2>/dev/null then sed sed export grep
+	${HOME} then && x=1 then local | -eu done --verbose /usr/bin grep printf
+	'quoted text' awk awk sed test | export cd | done export export then
+		/usr/bin then $(pwd) then test awk then test done && && done "$1" printf
+&& printf awk -eu then "$@" $(pwd) ${HOME} printf
+		"$@" test cd -eu "$@" ${HOME}
+	'quoted text' cd -eu test -eu $(pwd) | grep
+cd $(pwd) test x=1 x=1 -eu
+		echo x=1 $(pwd) -eu x=1 2>/dev/null
+		printf --verbose /usr/bin /usr/bin printf then "$1" then export
+		grep echo /usr/bin | local grep && $(pwd)
+	export echo "$@" "$@" $(pwd) 'quoted text' cd ${HOME}
+readonly done done $(pwd)
+	test then test | then then --verbose
+		--verbose x=1 x=1 ${HOME} $(pwd)
+	'quoted text' 'quoted text' export && echo sed local $(pwd) done then $(pwd)
+	"$@" sed sed echo -eu $(pwd) done echo $(pwd) --verbose -eu done
+	cd sed -eu | awk cd | awk test 'quoted text' --verbose awk x=1 printf
+cd export && cd done grep --verbose done sed /usr/bin 2>/dev/null
+sed then "$@" | export cd x=1
+		"$1" test "$1" export 'quoted text' 'quoted text' 'quoted text' && cd
+		/usr/bin sed /usr/bin 2>/dev/null
+		2>/dev/null "$@" done awk grep printf local grep readonly ${HOME} --verbose
+"$@" test cd export --verbose /usr/bin export
+		${HOME} printf test "$@" then test readonly
+	--verbose export readonly then "$@" /usr/bin
+		-eu ${HOME} readonly /usr/bin readonly
+&& local 'quoted text' awk done 'quoted text' | then | | "$1" cd $(pwd) local
+		"$@" echo grep echo && sed grep x=1 then grep then export
+	-eu test $(pwd) grep /usr/bin 2>/dev/null /usr/bin grep cd printf
+	"$1" "$1" ${HOME} awk $(pwd) awk && 'quoted text' local readonly x=1 "$@"
+cd 'quoted text' cd readonly /usr/bin grep cd cd
+		-eu printf "$1" -eu test sed awk grep
+	test | echo echo test /usr/bin awk local
+	sed test "$@" && done "$1" awk ${HOME} awk then echo && "$1" echo
+	cd x=1 | awk | then /usr/bin awk
+readonly cd printf printf then ${HOME}
+cd printf grep sed "$1" 'quoted text'
+/usr/bin -eu -eu readonly grep 'quoted text'
+		/usr/bin awk ${HOME} 2>/dev/null grep cd export then export echo then grep then
+export 2>/dev/null /usr/bin sed
+		/usr/bin printf | --verbose printf awk then 'quoted text' readonly then ${HOME}
+	grep echo "$@" -eu x=1 /usr/bin grep done "$@"
+		--verbose ${HOME} /usr/bin --verbose test done
+		echo -eu grep ${HOME} /usr/bin then readonly export
+		grep -eu awk --verbose local "$1"
+	done readonly --verbose &&
+		x=1 cd x=1 ${HOME} test -eu sed cd test "$1" export "$1" test echo ${HOME}
+		"$1" ${HOME} sed printf grep && done "$1" ${HOME}
+	awk then sed awk && readonly 2>/dev/null echo readonly cd ${HOME}
+		readonly then then grep cd "$@" export test cd local
+		x=1 printf x=1 sed | sed --verbose $(pwd)
+		/usr/bin ${HOME} done | --verbose
+		done 'quoted text' then 'quoted text'
+		2>/dev/null 2>/dev/null echo "$@" --verbose then ${HOME}
+"$@" echo ${HOME} printf echo "$@" awk "$1" local --verbose readonly
+		export done cd "$1" && 2>/dev/null cd
+		$(pwd) done /usr/bin $(pwd) local printf --verbose
+| readonly echo | sed test --verbose test
+	sed /usr/bin ${HOME} readonly test printf local -eu grep cd
+local awk --verbose /usr/bin then x=1 echo &&
+| printf sed "$@" "$1" 2>/dev/null
+	sed -eu ${HOME} export /usr/bin
+		echo echo --verbose 2>/dev/null
+	-eu export ${HOME} /usr/bin $(pwd)
+	test test && -eu $(pwd) export
+		printf /usr/bin 2>/dev/null && echo sed | && cd ${HOME} awk test export
+	echo sed ${HOME} 'quoted text' then cd x=1
+		x=1 sed awk --verbose && cd done -eu grep then 2>/dev/null 2>/dev/null
+"$1" x=1 readonly ${HOME}
+	'quoted text' && done /usr/bin 2>/dev/null readonly echo $(pwd) --verbose
+		readonly then export 'quoted text'
+		$(pwd) grep && done 2>/dev/null x=1 grep grep --verbose
+awk ${HOME} 2>/dev/null "$@" local echo then --verbose ${HOME} | $(pwd)
+	done --verbose x=1 ${HOME} && readonly export x=1 awk grep export export
+then done /usr/bin printf sed && cd awk then then done sed sed test -eu && x=1
+x=1 | done sed done 'quoted text' /usr/bin 2>/dev/null
+	-eu 'quoted text' "$@" done ${HOME} printf -eu export &&
+		test done ${HOME} export echo
+	2>/dev/null x=1 && awk && 'quoted text' cd x=1
+	| sed && 'quoted text' ${HOME} done printf ${HOME} ${HOME} sed "$1"
+&& then printf ${HOME} /usr/bin done
+	"$1" done then -eu cd ${HOME} "$@" "$@" | -eu
+	cd x=1 cd then then "$@" -eu $(pwd)
+	| sed "$1" "$@" ${HOME} --verbose export sed export ${HOME} 2>/dev/null
+		2>/dev/null printf awk | cd export then 2>/dev/null cd && "$1"
+sed test printf ${HOME} test "$1" done 'quoted text' printf local readonly done
+done --verbose printf "$@" | /usr/bin then "$1" local
+cd | "$1" --verbose readonly sed test grep
+	"$1" test ${HOME} sed | printf "$1" "$1" readonly
+		echo readonly echo cd 2>/dev/null 'quoted text' "$@" done
+/usr/bin $(pwd) && export
+	"$@" $(pwd) ${HOME} readonly --verbose
+test test test x=1 "$1" ${HOME} sed --verbose
+	test | && && | grep "$@"
+	-eu x=1 --verbose -eu test echo -eu local
+	--verbose /usr/bin && sed | $(pwd) "$@" awk | done awk |
+		local x=1 cd local local printf x=1
+	local grep export grep readonly echo x=1 && 2>/dev/null done "$@" sed $(pwd)
+		printf done "$@" | | ${HOME} local
+		/usr/bin readonly --verbose "$@" readonly
+"$1" grep 2>/dev/null
+sed cd export awk /usr/bin echo 2>/dev/null "$1" 'quoted text' /usr/bin printf
+	"$1" --verbose grep grep /usr/bin --verbose
+		printf /usr/bin printf /usr/bin
+cd sed && echo x=1 'quoted text' -eu && -eu
+		echo | local ${HOME} | test test grep 'quoted text' $(pwd)
+	echo x=1 ${HOME} sed && done "$1" "$@" | sed done /usr/bin
+		--verbose echo x=1 test test $(pwd) ${HOME} then done 'quoted text'
+		test test then && && "$1" --verbose sed x=1 "$@" sed export "$1" /usr/bin ${HOME}
+&& | -eu sed 2>/dev/null
+	done readonly 'quoted text' test echo sed cd "$@" | export | readonly 'quoted text'
+	local "$@" -eu cd local && export
+		sed test && --verbose x=1 sed x=1 test && "$1" readonly "$@"
+		"$1" sed export awk /usr/bin awk sed /usr/bin cd printf printf
+	-eu awk printf && test 'quoted text'
+		--verbose 2>/dev/null
+| x=1 test done readonly test "$@" ${HOME} 2>/dev/null $(pwd)
+	--verbose && then sed "$1" local --verbose
+	done "$@" | export grep export $(pwd) $(pwd) | export done ${HOME}
+		&& 'quoted text' -eu sed local sed awk done then echo "$@" x=1
+| then local /usr/bin done local "$1" then cd $(pwd) /usr/bin /usr/bin
+${HOME} | sed -eu grep 'quoted text' readonly "$1" test "$1"
+	2>/dev/null --verbose cd grep grep grep sed && 'quoted text'
+&& -eu 2>/dev/null export "$@" -eu 'quoted text'
+	"$1" echo echo 'quoted text' local cd --verbose "$1" awk 'quoted text' grep --verbose
+		printf awk ${HOME} x=1
+		grep printf grep && then done printf grep -eu sed test printf export export
+	-eu $(pwd) cd export export
+		sed then "$1" awk printf x=1 grep sed done x=1 x=1 awk --verbose grep readonly
+	&& test --verbose readonly /usr/bin done -eu cd done 'quoted text' awk ${HOME}
+'quoted text' local test done --verbose
+${HOME} "$@" local $(pwd) done -eu
+	${HOME} echo test $(pwd) grep export
+		'quoted text' --verbose local awk ${HOME}
+export printf readonly local sed --verbose --verbose cd 2>/dev/null x=1 sed
+readonly done $(pwd) done then test local test printf --verbose test
+	&& 'quoted text' --verbose sed x=1 local
+done awk cd ${HOME} test /usr/bin export "$1" export done -eu | --verbose
+	grep --verbose export -eu readonly local $(pwd) local $(pwd) -eu "$@" export
+	"$@" export "$@" | -eu cd -eu && grep awk grep "$1" | then 2>/dev/null
+	/usr/bin sed ${HOME} echo /usr/bin grep && export && "$@" grep ${HOME} cd
+	sed cd "$@" && sed export 2>/dev/null -eu "$1" 'quoted text'
+	cd done awk then readonly test test --verbose then /usr/bin | cd ${HOME} x=1
+		test awk awk /usr/bin "$1" then &&
+	| x=1 local 'quoted text' awk
+awk 2>/dev/null local -eu test
+	then /usr/bin 'quoted text' awk 2>/dev/null
+	'quoted text' printf awk | readonly cd 'quoted text' ${HOME} export
+	then echo grep /usr/bin "$@"
+-eu local readonly cd "$@" "$@" 'quoted text' cd
+		done /usr/bin local readonly ${HOME} | 'quoted text' ${HOME} /usr/bin
+	echo readonly grep 'quoted text'
+	echo readonly 'quoted text' echo
+	-eu cd | "$1" done export sed export && awk local
+"$@" --verbose x=1 cd
+| "$@" ${HOME} && awk export
+		&& then export "$@" /usr/bin sed export "$@" cd cd local readonly -eu test "$1"
+	2>/dev/null /usr/bin 2>/dev/null "$1" echo
+grep $(pwd) sed sed grep 'quoted text' 'quoted text'
+	echo awk done readonly echo "$@" 'quoted text' printf "$@" && sed then
+		x=1 then -eu /usr/bin 'quoted text' | /usr/bin grep
+		then /usr/bin $(pwd) /usr/bin /usr/bin x=1 2>/dev/null 'quoted text'
+		export readonly done grep 2>/dev/null
+		awk 2>/dev/null cd export "$@" 2>/dev/null 2>/dev/null
+	2>/dev/null readonly done test |
+		grep readonly "$1" | x=1 x=1 | awk /usr/bin
+readonly --verbose done
+	printf printf done | test 'quoted text' cd local awk cd
+done 'quoted text' | grep -eu done
+		-eu && test x=1 /usr/bin "$@" test echo --verbose
+		local echo "$1" "$@" --verbose "$@"
+export readonly then -eu echo sed cd | grep -eu awk /usr/bin
+	echo readonly echo awk && sed ${HOME} 'quoted text' grep sed
+	awk echo printf readonly && $(pwd) sed $(pwd) printf readonly local |
+readonly --verbose 2>/dev/null ${HOME} $(pwd) grep cd sed local test x=1 "$1"
+--verbose then $(pwd) 2>/dev/null && ${HOME} awk --verbose printf grep 'quoted text'
+		done grep echo export "$@" ${HOME} -eu 'quoted text' 'quoted text' 'quoted text'
+		cd local "$@" 'quoted text' grep $(pwd) /usr/bin "$1" 2>/dev/null printf
+awk --verbose sed | && /usr/bin
+grep 2>/dev/null echo "$@" "$1" echo --verbose export printf && 2>/dev/null ${HOME}
+		"$1" "$@" awk readonly -eu "$1"
+		'quoted text' grep grep done && test echo
+readonly cd --verbose /usr/bin "$@" echo echo test sed awk test ${HOME} done sed
+		then 2>/dev/null -eu &&
+		sed sed ${HOME} 2>/dev/null -eu ${HOME}
+		2>/dev/null && cd export -eu done /usr/bin then readonly test echo done /usr/bin
+		x=1 then "$1" then local cd ${HOME} $(pwd) sed sed "$1"
+	--verbose awk && cd printf
+		printf /usr/bin test cd
+		-eu x=1 cd 2>/dev/null grep 'quoted text'
+	then readonly && export -eu --verbose && /usr/bin
+"$1" ${HOME} readonly && test 2>/dev/null
+	grep x=1 $(pwd) 2>/dev/null x=1 -eu done | test "$@" /usr/bin
+		x=1 -eu awk 'quoted text' then
+		export then "$@" printf x=1 $(pwd) --verbose echo 'quoted text'
+-eu "$1" --verbose /usr/bin printf --verbose "$@" x=1 2>/dev/null
+		2>/dev/null done test && | 2>/dev/null test grep 2>/dev/null
+	echo --verbose printf done x=1 "$@" then test --verbose "$@" $(pwd) --verbose test
+		--verbose --verbose cd echo ${HOME} test readonly --verbose
+x=1 2>/dev/null 'quoted text'
+	$(pwd) x=1 $(pwd) awk ${HOME}
+		done "$1" test export local /usr/bin x=1 /usr/bin --verbose export
+		export 2>/dev/null x=1 echo && readonly
+		test then then /usr/bin test -eu echo --verbose "$1" then
+"$@" echo printf readonly -eu ${HOME} readonly $(pwd) /usr/bin -eu x=1 awk
+		-eu echo sed cd echo export
+		| $(pwd) sed cd local && "$1" /usr/bin sed awk printf -eu
+		awk 'quoted text' "$@" readonly cd x=1 test 2>/dev/null ${HOME} 2>/dev/null
+readonly /usr/bin x=1 && | readonly sed $(pwd)
+		printf 'quoted text' 'quoted text' printf $(pwd) "$1" -eu -eu | | local
+"$1" --verbose done done then $(pwd) -eu
+printf && printf && sed sed 2>/dev/null
+		test export local -eu 2>/dev/null $(pwd) $(pwd)
+		'quoted text' grep test printf printf local ${HOME} "$@" sed done
+		grep --verbose -eu "$1" $(pwd) "$1" &&
+awk grep sed --verbose sed "$@" x=1 done ${HOME} then test
+		--verbose 'quoted text' $(pwd) readonly x=1
+		echo sed /usr/bin grep test "$1" echo -eu test local cd 'quoted text'
+grep readonly 'quoted text' x=1 --verbose local
+		$(pwd) $(pwd) x=1 "$1" --verbose done sed --verbose $(pwd) ${HOME}
+		&& printf /usr/bin done --verbose done "$1" && awk grep /usr/bin "$@"
+		sed cd sed $(pwd) printf --verbose
+		echo /usr/bin readonly ${HOME} | "$1" 'quoted text' 'quoted text' --verbose
+		printf then cd test 'quoted text' cd $(pwd) sed export
+export readonly && sed
+sed x=1 done 2>/dev/null --verbose sed "$1" local
+		readonly local export local
+"$@" local echo -eu cd "$1" printf awk "$@"
+		${HOME} sed 'quoted text' test
+echo then then then echo done 'quoted text'
+&& && local cd && test --verbose readonly -eu grep
+sed && ${HOME} then 2>/dev/null readonly grep && $(pwd) -eu -eu
+		then sed $(pwd) grep echo
+	"$@" echo --verbose grep $(pwd) then readonly "$@" $(pwd) -eu local
+	"$1" echo grep 'quoted text'
+	readonly cd echo readonly local "$@" sed sed | -eu test then | "$1"
+readonly awk test printf $(pwd) | && echo done
+/usr/bin 2>/dev/null grep "$@" "$@" echo done "$@" x=1 echo && | x=1
+cd && ${HOME} echo -eu -eu ${HOME} "$@" then $(pwd) /usr/bin
+	"$@" 2>/dev/null awk x=1 -eu awk then -eu "$@" "$1" cd $(pwd) |
+"$1" export x=1 awk /usr/bin $(pwd) then --verbose local
+		export done test 'quoted text' ${HOME} cd /usr/bin ${HOME} -eu "$@" 'quoted text'
+	local x=1 "$@" readonly readonly 'quoted text' "$1" 'quoted text' /usr/bin "$1"
+		export then test 2>/dev/null
+		--verbose export "$1" done awk sed 2>/dev/null grep
+'quoted text' /usr/bin /usr/bin cd readonly awk
+		| -eu then export done 'quoted text' | readonly
+'quoted text' x=1 done awk done 'quoted text' cd then
+	"$1" then then sed ${HOME} "$@" /usr/bin test 'quoted text' $(pwd) local
+	/usr/bin grep 2>/dev/null 'quoted text' "$@" awk printf local test export readonly
+	| grep awk "$1" $(pwd) local x=1 "$@" |
+		--verbose ${HOME} /usr/bin x=1 sed printf "$1" echo $(pwd)
+	cd export $(pwd) local local ${HOME} /usr/bin
+awk ${HOME} export 'quoted text'
+| && readonly -eu --verbose x=1 grep /usr/bin /usr/bin
+/usr/bin "$1" "$@" readonly then echo then $(pwd) echo 2>/dev/null
+	test "$1" | --verbose grep 'quoted text' && export
+2>/dev/null then "$1" grep 'quoted text' | cd then && sed "$@" $(pwd)
+	${HOME} "$@" cd then echo local ${HOME} "$1" 'quoted text' then echo
+/usr/bin ${HOME} | x=1 cd sed /usr/bin &&
+	done --verbose /usr/bin grep awk echo sed then test readonly cd "$@" export printf
+grep && printf | test cd
+echo test awk /usr/bin awk --verbose ${HOME}
+"$1" printf ${HOME} "$1" echo local then 2>/dev/null sed readonly ${HOME}
+local printf /usr/bin "$1" readonly printf "$@" awk local
+| 2>/dev/null echo test printf export cd local 'quoted text' "$@" test
+		done "$@" done $(pwd) && sed test grep ${HOME} grep "$@" x=1 then cd | 2>/dev/null
+	${HOME} ${HOME} printf sed sed &&
+"$@" -eu export 'quoted text' sed && 'quoted text' test
+		export && ${HOME} export
+	printf x=1 --verbose -eu echo then 'quoted text'
+		"$@" done "$@" cd then -eu | done printf
+	&& --verbose ${HOME} printf test then awk echo local | 'quoted text'
+"$@" grep "$1" 2>/dev/null 'quoted text' echo export /usr/bin
+	done ${HOME} awk 'quoted text' export grep local x=1 --verbose
+		| 2>/dev/null echo 2>/dev/null
+		--verbose export test grep done "$@" 2>/dev/null echo "$@"
+		2>/dev/null && local 'quoted text'
+	"$1" local -eu $(pwd) sed done
+local x=1 local sed cd readonly echo sed test local -eu done && awk
+readonly echo local 'quoted text'
+readonly cd -eu "$1" "$1" "$@" grep ${HOME} && local
+	'quoted text' test /usr/bin -eu test echo --verbose x=1
+x=1 ${HOME} ${HOME} $(pwd) 'quoted text' ${HOME} awk sed $(pwd) x=1 "$@"
+		awk grep /usr/bin ${HOME} printf --verbose
+	$(pwd) && awk readonly && readonly printf sed ${HOME} ${HOME}
+/usr/bin cd awk test 2>/dev/null sed 2>/dev/null
+readonly done readonly readonly printf export --verbose "$@"
+	local echo cd "$1" "$1" readonly && 'quoted text' readonly 2>/dev/null
+	awk readonly "$@" then 'quoted text' grep grep $(pwd) echo
+cd sed local printf "$@" /usr/bin x=1 $(pwd)
+		/usr/bin sed 2>/dev/null 2>/dev/null readonly x=1 grep "$@" grep grep | printf
+	$(pwd) cd 'quoted text' 'quoted text'
+		/usr/bin awk export printf local test
+		x=1 local | 'quoted text' done && -eu -eu "$1" cd then 'quoted text'
+		2>/dev/null grep --verbose test && readonly "$@" export
+	export "$@" then 2>/dev/null 'quoted text' grep awk awk local printf
+		awk cd echo local awk then && readonly printf printf --verbose test -eu grep
+	$(pwd) /usr/bin | printf local | readonly readonly
+		grep "$1" test sed cd local ${HOME} export readonly "$@" grep "$@" done
+	"$@" | awk cd $(pwd) test local "$1" | then then
+		readonly sed sed $(pwd) printf awk /usr/bin printf
+		"$@" done printf local 'quoted text' $(pwd)
+	"$1" export test x=1 && 'quoted text' x=1 local export
+		export /usr/bin -eu --verbose
+/usr/bin readonly readonly
+local && done test then sed echo cd --verbose test local "$1" cd
+&& export ${HOME} x=1 export echo grep -eu ${HOME} | export -eu --verbose
+| export awk done done && /usr/bin sed ${HOME}
+	then readonly $(pwd) done | && sed /usr/bin x=1 cd grep 2>/dev/null
+	done --verbose "$@" printf && sed -eu awk 2>/dev/null then "$@" "$@"
+		done ${HOME} "$1" sed grep printf local ${HOME} export printf x=1
+		2>/dev/null "$1" 'quoted text' && readonly readonly
+	readonly readonly then grep test done 2>/dev/null awk sed
+$(pwd) readonly "$1" ${HOME} --verbose echo local 'quoted text'
+	x=1 cd 'quoted text' echo then done | readonly "$1" test grep &&
+		'quoted text' | 'quoted text'
+		"$@" /usr/bin readonly cd x=1 echo printf x=1
+then then sed local echo local /usr/bin done echo $(pwd) x=1 --verbose
+| | -eu readonly readonly
+		readonly x=1 "$1" "$1"
+		"$1" local && -eu 'quoted text' test then
+		done sed ${HOME} 2>/dev/null "$@" --verbose --verbose 2>/dev/null
+		| 2>/dev/null printf sed export sed
+	"$1" readonly --verbose printf export 2>/dev/null x=1 test
+sed then done $(pwd) 'quoted text' echo done "$1" export
+		/usr/bin echo done cd $(pwd) --verbose
+	$(pwd) -eu 2>/dev/null "$1" readonly export "$1" x=1 --verbose "$@"
+	done 'quoted text' done sed
+	'quoted text' x=1 /usr/bin then local then grep x=1 --verbose
+	$(pwd) 'quoted text' "$@" $(pwd) printf -eu -eu cd readonly && | then echo cd
+	| /usr/bin ${HOME} printf && ${HOME} test export local
+sed ${HOME} -eu then x=1 readonly "$@" done &&
+	test printf 2>/dev/null /usr/bin
+	"$1" | echo x=1 local done | export x=1 x=1 grep printf awk sed --verbose sed "$@"
+'quoted text' grep local | done
+sed x=1 done test $(pwd) 'quoted text' 'quoted text'
+	&& --verbose export local "$1" 2>/dev/null readonly sed /usr/bin
+		sed $(pwd) "$1" export printf
+	$(pwd) grep sed then then $(pwd) --verbose | "$1" printf -eu
+$(pwd) /usr/bin cd then && awk echo local local readonly echo echo then
+		${HOME} 'quoted text' sed cd local printf $(pwd) $(pwd) /usr/bin
+	--verbose -eu printf "$1" "$@" x=1 export
+		"$@" | grep done printf /usr/bin 'quoted text' ${HOME} then awk then 2>/dev/null
+	echo export readonly export awk local | ${HOME}
+	x=1 2>/dev/null sed 2>/dev/null 2>/dev/null test done x=1 $(pwd)
+test awk && readonly local 2>/dev/null
+		x=1 ${HOME} then 2>/dev/null awk sed ${HOME} /usr/bin grep export 2>/dev/null
+	${HOME} awk then 'quoted text' x=1 2>/dev/null -eu "$1" "$@" export
+grep awk "$1" awk 'quoted text' ${HOME} && grep --verbose && echo /usr/bin
+sed ${HOME} grep echo "$1"
+	echo cd | local "$@" readonly local sed local then then /usr/bin cd test x=1
+		done $(pwd) $(pwd) grep "$@" $(pwd) | cd "$@" 2>/dev/null
+done export $(pwd) 'quoted text'
+	then x=1 test then $(pwd) done local echo "$1" then local 2>/dev/null test && grep
+	then readonly 2>/dev/null cd /usr/bin 2>/dev/null $(pwd) then done x=1 test
+		awk readonly x=1 && --verbose done done cd --verbose
+		${HOME} 'quoted text' grep awk x=1 export local "$1"
+&& "$1" ${HOME} "$@" ${HOME} test awk cd && /usr/bin "$@" echo "$1" /usr/bin cd
+awk ${HOME} | -eu echo export
+		sed "$@" $(pwd) export /usr/bin 'quoted text' then && x=1 cd
+'quoted text' cd grep cd 'quoted text' local 'quoted text' $(pwd) cd done
+		&& local "$1" -eu echo readonly | -eu sed $(pwd) | then
+		test cd x=1 | cd $(pwd) && cd /usr/bin readonly | readonly
+	awk --verbose 2>/dev/null printf
+		test 'quoted text' export done "$@" --verbose
+		local 2>/dev/null "$1" "$1" sed sed 2>/dev/null /usr/bin
+	'quoted text' --verbose test | -eu
+	-eu | sed done "$@" echo ${HOME} 'quoted text' 2>/dev/null
+		2>/dev/null local x=1 then done test cd done 2>/dev/null
+	"$1" && -eu printf test export --verbose
+	readonly --verbose "$1" ${HOME} "$@" 'quoted text' grep /usr/bin
+	readonly test $(pwd) awk -eu printf awk x=1 /usr/bin | local -eu "$1" /usr/bin
+	2>/dev/null -eu && /usr/bin local sed then export 'quoted text' /usr/bin
+	readonly -eu echo done then x=1 printf $(pwd) x=1 --verbose export
+		local printf | cd printf cd x=1 then "$1" then x=1 printf $(pwd)
+	sed printf done --verbose -eu && ${HOME} ${HOME} printf
+		grep then /usr/bin printf printf printf
+		awk done local x=1 cd x=1 sed
+"$@" local done ${HOME} -eu | $(pwd) echo x=1 export
+grep grep sed "$@" grep $(pwd) "$1" "$@" "$1" local
+$(pwd) test x=1 "$@" ${HOME} cd then x=1 "$1" test then ${HOME}
+	--verbose done local && $(pwd) then readonly local | --verbose &&
+		| -eu local cd --verbose test --verbose /usr/bin 'quoted text'
+		awk "$@" echo "$1" -eu 'quoted text' sed echo printf -eu $(pwd) $(pwd)
+		sed | then "$@" printf local | readonly
+		export 'quoted text' /usr/bin 2>/dev/null
+		grep cd 2>/dev/null echo "$1" printf printf then done awk
+2>/dev/null then done test echo test printf
+		then "$1" export /usr/bin cd cd done -eu echo readonly $(pwd) grep x=1 | /usr/bin
+		readonly /usr/bin ${HOME} -eu
+${HOME} "$@" export 'quoted text'
+then done printf /usr/bin "$@" | 2>/dev/null $(pwd) 2>/dev/null
+		sed echo "$@" grep then cd then grep sed 2>/dev/null done
+	printf -eu ${HOME} "$@" then ${HOME} echo export /usr/bin $(pwd)
+		'quoted text' test $(pwd) /usr/bin
+$(pwd) done ${HOME} /usr/bin $(pwd)
+	/usr/bin x=1 done test awk |
+"$1" sed cd awk local grep grep /usr/bin
+		printf 'quoted text' /usr/bin /usr/bin then "$1" test local $(pwd) grep test
+	readonly echo && grep --verbose then "$1" &&
+	done sed grep /usr/bin "$1" && | local $(pwd) local
+echo printf /usr/bin then grep printf --verbose then test
+		cd && awk 2>/dev/null "$1" export --verbose
+	&& test echo -eu then then "$@" ${HOME} grep test readonly echo
+| cd printf 'quoted text' && test | | printf cd | "$1" x=1
+		then 2>/dev/null test 2>/dev/null
+	echo | 2>/dev/null ${HOME} "$@" --verbose export cd $(pwd) ${HOME} export
+	${HOME} x=1 'quoted text' sed
+	--verbose done test local readonly printf readonly local 2>/dev/null
+		x=1 done done $(pwd) cd 2>/dev/null done 'quoted text' done
+awk ${HOME} export then printf printf done --verbose export $(pwd)
+then /usr/bin 2>/dev/null
+export done grep | done x=1 test "$1" -eu
+	printf | && && grep | x=1 readonly x=1
+test test echo test -eu && "$1" awk 2>/dev/null
+2>/dev/null done $(pwd) /usr/bin export ${HOME} x=1 /usr/bin
+		2>/dev/null readonly test export done sed awk
+		echo cd "$@" 2>/dev/null
+		x=1 readonly echo x=1 --verbose echo --verbose x=1 ${HOME}
+		readonly 2>/dev/null local 'quoted text' echo printf -eu --verbose -eu -eu
+	$(pwd) $(pwd) sed x=1 "$1" --verbose done
+	done --verbose cd $(pwd) "$1" then x=1 "$1"
+	"$1" then "$@" awk readonly x=1 cd export test &&
+		"$1" $(pwd) /usr/bin | 'quoted text' && printf cd
+awk x=1 'quoted text' 'quoted text'
+		-eu "$1" 2>/dev/null then then 2>/dev/null "$@" sed
+sed cd cd echo test sed test printf cd 2>/dev/null echo |
+echo printf "$@" | cd | sed 2>/dev/null | sed 2>/dev/null
+	"$1" then test local "$@" 2>/dev/null --verbose
+done "$1" cd && sed -eu grep export readonly test done "$@" "$1" "$1" local
+	'quoted text' ${HOME} done ${HOME} ${HOME} then --verbose $(pwd)
+	grep readonly sed cd x=1 awk && then readonly "$1" local 'quoted text' |
+	local grep local then cd printf ${HOME} "$1" x=1 then export x=1 $(pwd) grep |
+${HOME} /usr/bin sed then "$@" "$@"
+	local then x=1 -eu "$@" test readonly
+		'quoted text' grep done 'quoted text' echo readonly && 'quoted text' test |
+	"$@" sed done ${HOME} /usr/bin sed echo test ${HOME} "$1" ${HOME} local
+		-eu then grep 'quoted text' grep export
+-eu --verbose && 2>/dev/null ${HOME} /usr/bin && local readonly 2>/dev/null
+		| --verbose ${HOME} then test then -eu -eu x=1 local sed printf -eu
+	2>/dev/null /usr/bin then grep "$@"
+	x=1 cd 2>/dev/null test
+"$@" 2>/dev/null then x=1 | grep "$1" grep grep readonly -eu readonly readonly
+test | /usr/bin ${HOME} "$@" printf printf
+	x=1 && "$@" $(pwd) local --verbose grep export grep
+grep --verbose && awk test then 'quoted text' ${HOME} 2>/dev/null /usr/bin
+$(pwd) | echo "$1" --verbose "$@" readonly then readonly
+	"$1" --verbose done local local readonly cd
+		'quoted text' -eu cd $(pwd) 'quoted text' --verbose cd /usr/bin export "$1" grep
+grep sed test ${HOME} "$1" then test
+		then "$@" "$1" /usr/bin awk readonly done echo done echo 'quoted text'
+		readonly printf local /usr/bin
+awk printf "$@" | grep printf | printf echo readonly
+		${HOME} test $(pwd) sed done -eu cd | readonly && grep
+--verbose 2>/dev/null -eu readonly 'quoted text' $(pwd)
+		then printf 'quoted text' && readonly x=1
+	2>/dev/null -eu then then ${HOME} printf then "$1" "$@" $(pwd) grep
+	sed $(pwd) export 'quoted text' $(pwd) done
+		test then readonly | && && sed then /usr/bin
+	test /usr/bin local cd 2>/dev/null $(pwd) && readonly grep grep echo ${HOME} 2>/dev/null
+	"$@" --verbose local 'quoted text' && then done "$1" done "$@"
+local && awk readonly done "$1" 'quoted text' -eu sed local export 'quoted text'
+		awk ${HOME} "$1" grep export readonly grep $(pwd) then && && "$1" awk export x=1
+"$@" | printf test cd x=1 grep x=1 local /usr/bin export x=1 | test $(pwd)
+		test -eu printf x=1 awk cd cd 'quoted text' | | then printf cd cd local awk done
+	--verbose test x=1 local ${HOME} | local
+	${HOME} 'quoted text' 'quoted text'
+	${HOME} test "$@" x=1 --verbose export echo "$@"
+&& x=1 /usr/bin "$1" 'quoted text'
+		"$1" done printf test "$1" then && then /usr/bin --verbose awk /usr/bin --verbose
+		printf "$@" test ${HOME} then $(pwd) readonly "$1"
+	test cd done readonly -eu sed grep local "$1" ${HOME} && grep &&
+	2>/dev/null then 2>/dev/null echo grep readonly 'quoted text' echo
+"$@" x=1 'quoted text' 2>/dev/null 2>/dev/null
+		${HOME} readonly /usr/bin --verbose
+| done -eu awk $(pwd) export awk
+	$(pwd) x=1 && "$@" "$@" | |
+		${HOME} /usr/bin -eu grep readonly local done $(pwd) "$@" awk grep
+	local export local /usr/bin
+awk cd ${HOME} /usr/bin readonly readonly readonly readonly then && -eu && export
+		done ${HOME} awk then awk awk 'quoted text' done then test
+	$(pwd) readonly sed sed export done && "$@"
+	done local awk | test then export && cd "$1" /usr/bin
+		readonly -eu cd "$@" local && -eu then done /usr/bin ${HOME} done export
+	'quoted text' x=1 test readonly printf done local $(pwd) --verbose then | cd
+		then sed 'quoted text' then grep then | -eu | 2>/dev/null && |
+	&& x=1 sed "$1" done x=1 ${HOME}
+		| "$1" && "$@" local --verbose && --verbose /usr/bin --verbose /usr/bin
+		&& local then 2>/dev/null x=1 done echo sed then cd "$1" sed 2>/dev/null --verbose
+	"$1" "$1" /usr/bin printf | 2>/dev/null sed sed printf
+		local 2>/dev/null "$@" 'quoted text' 'quoted text' export
+	readonly ${HOME} grep then /usr/bin && --verbose x=1 'quoted text' awk
+	export test awk done --verbose --verbose |
+		echo | "$1" readonly then printf ${HOME} 2>/dev/null ${HOME} x=1 --verbose
+	-eu x=1 printf awk export local grep
+		&& "$1" --verbose && echo sed done test 2>/dev/null export readonly printf
+		$(pwd) readonly awk "$1" done done /usr/bin then --verbose awk 'quoted text'
+x=1 export | export cd cd 'quoted text' x=1 grep awk --verbose
+$(pwd) test | | --verbose export "$1" "$1" ${HOME} --verbose grep ${HOME}
+		${HOME} "$@" test "$1" sed --verbose
+		"$1" ${HOME} sed | 'quoted text' 'quoted text' done
+		grep "$1" --verbose && sed $(pwd) --verbose then -eu awk ${HOME}
+sed "$1" readonly export then -eu 2>/dev/null && done $(pwd) done "$@"
+	printf cd local sed 2>/dev/null ${HOME} --verbose $(pwd) "$@" |
+$(pwd) readonly awk then --verbose awk test
+		grep $(pwd) local /usr/bin | /usr/bin readonly $(pwd) $(pwd) $(pwd) export $(pwd)
+		cd done printf -eu 'quoted text' grep -eu | echo ${HOME} "$@" ${HOME}
+	'quoted text' sed $(pwd) --verbose done | "$@" ${HOME} awk grep
+	printf "$1" x=1 ${HOME} printf 'quoted text' sed export 2>/dev/null
+	done --verbose -eu grep | readonly | sed /usr/bin
+	x=1 /usr/bin readonly cd awk then grep sed
+		"$@" sed done awk grep echo --verbose
+		$(pwd) then printf done local --verbose local 'quoted text' echo "$1" "$@"
+		local test | /usr/bin ${HOME} sed /usr/bin x=1
+		done awk export --verbose 'quoted text' $(pwd) grep
+		printf echo echo readonly test test $(pwd) --verbose 'quoted text' grep ${HOME}
+| readonly readonly printf 2>/dev/null "$@" 'quoted text' export
+		grep test test export 'quoted text' test | "$1"
+test grep 'quoted text' local | -eu echo ${HOME} -eu then 2>/dev/null
+	x=1 printf readonly /usr/bin then --verbose $(pwd) awk 'quoted text' done readonly
+	cd ${HOME} "$@" cd -eu "$@" /usr/bin -eu
+	"$1" local x=1 'quoted text'
+awk -eu grep ${HOME} done awk ${HOME} "$@" then "$@" test test "$@" readonly
+	'quoted text' local echo awk done awk 'quoted text' && echo test
+	'quoted text' | done -eu readonly
+	local 'quoted text' | x=1 x=1 $(pwd) 'quoted text'
+"$1" sed ${HOME} sed -eu $(pwd) awk sed 2>/dev/null
+	then local export then &&
+		/usr/bin awk test -eu echo printf cd
+	test ${HOME} echo then -eu $(pwd)
+${HOME} awk ${HOME} --verbose
+	local done --verbose && grep
+		--verbose awk printf sed
+"$@" --verbose local /usr/bin then /usr/bin test cd sed --verbose
+		sed export && done --verbose grep readonly printf
+export printf then -eu ${HOME} done then --verbose -eu ${HOME} readonly
+test $(pwd) | printf 2>/dev/null "$@" ${HOME} export echo test done 'quoted text'
+${HOME} done /usr/bin printf awk then 'quoted text' sed cd "$1" 2>/dev/null
+--verbose 2>/dev/null "$1" ${HOME} --verbose printf | done readonly "$1"
+		--verbose "$1" sed test | && "$@" x=1 "$@" printf cd 'quoted text'
+$(pwd) 'quoted text' -eu grep | ${HOME}
+done 'quoted text' -eu "$1"
+x=1 test export readonly "$@" -eu $(pwd) echo --verbose then /usr/bin
+done then "$1" done awk cd test done done
+	cd "$@" && done /usr/bin "$1" local
+	then local grep test $(pwd) grep "$1" grep readonly -eu export -eu export
+		&& cd 2>/dev/null $(pwd) sed | /usr/bin grep -eu 2>/dev/null cd awk ${HOME}
+	x=1 done then then then x=1 awk | && "$1" --verbose "$1" ${HOME} "$@" x=1
+		done test $(pwd) export && ${HOME} local readonly --verbose
+		/usr/bin local local "$1" "$1" awk "$1" ${HOME} grep "$1" sed $(pwd) | done $(pwd)
+export grep echo && printf --verbose echo
+		test 'quoted text' -eu test cd x=1 "$@" | ${HOME} done readonly grep x=1
+		test sed 'quoted text'
+	export x=1 sed readonly then --verbose 'quoted text' sed /usr/bin done "$@"
+'quoted text' "$@" | && printf grep | x=1
+printf --verbose local printf && /usr/bin
+test x=1 then readonly then && | | then then readonly grep
+	awk /usr/bin echo -eu test awk "$@" readonly test /usr/bin
+		export $(pwd) test "$@" 2>/dev/null echo "$@" export "$@" grep
+	echo awk --verbose 'quoted text' echo then -eu "$@" test then
+		&& printf /usr/bin | readonly readonly
+		then 'quoted text' local -eu echo && /usr/bin /usr/bin
+		test "$@" awk $(pwd) | | sed readonly 2>/dev/null
+		-eu cd sed export -eu readonly -eu export cd -eu export readonly
+local "$@" --verbose readonly x=1
+printf "$@" $(pwd) && printf local sed done done grep done ${HOME}
+	awk 2>/dev/null 2>/dev/null
+	"$@" $(pwd) awk && local
+	export "$@" 'quoted text' export then grep readonly grep
+	'quoted text' /usr/bin 2>/dev/null 'quoted text' 'quoted text' awk x=1 ${HOME}
+		'quoted text' export 2>/dev/null $(pwd) cd && "$@" sed ${HOME} echo ${HOME} cd $(pwd)
+		grep sed local $(pwd) readonly --verbose $(pwd) 'quoted text' ${HOME}
+-eu "$@" cd 'quoted text' 2>/dev/null x=1 sed test "$1"
+		${HOME} awk && printf && readonly printf printf | | then awk && sed test
+	"$@" /usr/bin | --verbose $(pwd)
+	grep 2>/dev/null echo test then $(pwd)
+'quoted text' readonly grep 'quoted text' "$@" readonly 'quoted text' cd
+	"$1" ${HOME} $(pwd) "$1" then local grep printf export | -eu local export
+x=1 done test --verbose done sed local /usr/bin sed
+	'quoted text' "$@" /usr/bin echo $(pwd) test ${HOME} --verbose 2>/dev/null
+then | | echo "$@" test 2>/dev/null -eu "$@" grep test -eu -eu then
+		echo "$@" && | ${HOME} 'quoted text' echo
+	| "$1" "$1" then "$@" | cd --verbose done --verbose grep
+	-eu /usr/bin -eu sed | done sed "$@" done && export readonly "$@" | 'quoted text'
+printf x=1 test "$@" local x=1 done 'quoted text' cd "$@" sed awk export
+		echo printf "$1" test test 'quoted text' "$1" 2>/dev/null awk printf "$@" --verbose
+		echo grep grep && | grep echo /usr/bin "$@"
+		--verbose -eu test printf
+printf cd -eu $(pwd) readonly x=1 "$1" x=1 readonly /usr/bin x=1 "$@" -eu readonly
+		--verbose sed 'quoted text' done export ${HOME} readonly grep 2>/dev/null
+		test -eu test cd echo then done x=1 then --verbose echo grep printf grep local $(pwd)
+-eu /usr/bin test cd ${HOME} ${HOME} /usr/bin
+${HOME} grep export | grep local then 'quoted text' export x=1
+export awk "$1" -eu --verbose
+		x=1 grep grep | cd | /usr/bin -eu echo echo printf
+	--verbose $(pwd) then /usr/bin local test
+awk cd "$@" && /usr/bin done | 'quoted text' | "$1" grep 'quoted text'
+x=1 | echo then done "$1" -eu sed export ${HOME} local
+	done done local $(pwd) readonly 2>/dev/null readonly $(pwd)
+/usr/bin export /usr/bin local grep local
+	sed $(pwd) test 2>/dev/null then && "$@" readonly $(pwd) test
+		$(pwd) | x=1 readonly cd &&
+	-eu ${HOME} | grep then 2>/dev/null 2>/dev/null 2>/dev/null done
+grep printf "$@" | awk ${HOME}
+		sed export test local $(pwd) printf sed local local --verbose |
+		&& 2>/dev/null 2>/dev/null "$@" local echo
+	readonly | sed /usr/bin ${HOME} --verbose local $(pwd) cd 'quoted text' &&
+	sed --verbose && && "$1" cd awk ${HOME} 2>/dev/null printf -eu export
+	cd | test echo local /usr/bin test cd test $(pwd) then export && sed export
+&& cd local cd /usr/bin echo echo then x=1 "$@" && export echo
+		$(pwd) readonly sed -eu 2>/dev/null cd 2>/dev/null x=1
+echo then /usr/bin --verbose readonly "$1" grep | /usr/bin readonly
+		"$@" && 'quoted text' ${HOME} awk awk
+done awk && --verbose local "$@" "$@" && readonly "$@" awk then sed cd echo
+	"$1" 'quoted text' "$@" "$@" sed cd /usr/bin sed
+		"$1" "$@" echo test "$1" 'quoted text' done -eu --verbose
+		| done done test cd cd x=1 ${HOME} 'quoted text' -eu cd local x=1 'quoted text'
+awk x=1 grep local /usr/bin grep done && "$1" readonly export /usr/bin test 2>/dev/null
+then ${HOME} && echo sed done -eu export 2>/dev/null
+	readonly printf echo echo awk then /usr/bin
+	/usr/bin -eu -eu test done "$1" readonly local
+		'quoted text' | x=1 | then echo ${HOME}
+		/usr/bin x=1 cd "$@" echo grep 'quoted text' then "$1" | cd sed /usr/bin echo
+local done ${HOME} awk 2>/dev/null x=1 echo grep $(pwd) -eu 2>/dev/null
+	x=1 | echo $(pwd) cd test && 'quoted text' printf then local
+	echo 2>/dev/null | x=1 /usr/bin printf echo sed local cd
+	"$@" sed $(pwd) x=1 "$1" readonly 2>/dev/null $(pwd) printf "$@" "$@" && readonly
+| readonly $(pwd) printf && "$@" $(pwd) $(pwd)
+-eu -eu grep export awk -eu test "$@"
+	/usr/bin grep "$@" test test -eu "$1" -eu $(pwd) 'quoted text'
+		2>/dev/null then && 'quoted text' sed /usr/bin x=1 grep 'quoted text' --verbose
+${HOME} /usr/bin test $(pwd) x=1 /usr/bin
+test /usr/bin cd 'quoted text' --verbose
+		--verbose awk test test $(pwd) sed "$@" && export export ${HOME} awk echo $(pwd)
+		"$1" echo cd "$@" x=1 /usr/bin "$1" printf grep $(pwd) x=1 readonly
+"$@" -eu export local 2>/dev/null | readonly
+		x=1 "$1" $(pwd) echo x=1 --verbose then x=1 -eu test test --verbose then
+	sed /usr/bin --verbose
+test x=1 | sed ${HOME} 'quoted text'
+		readonly printf 2>/dev/null x=1 printf x=1 "$@" | $(pwd) readonly "$1" then test
+	"$@" x=1 "$1" 'quoted text' readonly ${HOME} --verbose
+	echo sed $(pwd) | "$@" sed local
+echo 'quoted text' ${HOME} "$1" 2>/dev/null
+$(pwd) && printf readonly
+'quoted text' export done local grep printf | echo /usr/bin x=1 && ${HOME} printf
+local /usr/bin grep awk printf x=1 printf x=1 grep export "$@"
+/usr/bin ${HOME} --verbose
+		--verbose printf x=1 readonly $(pwd) "$@" x=1
+		2>/dev/null /usr/bin export awk ${HOME} then "$1" --verbose local
+		/usr/bin "$1" printf sed 2>/dev/null sed 'quoted text' "$@" echo -eu &&
+		echo awk export test readonly ${HOME}
+		test awk awk /usr/bin grep test "$1" readonly done cd cd done $(pwd) awk
+"$@" && sed readonly /usr/bin sed
+2>/dev/null printf 'quoted text' 2>/dev/null -eu x=1
+readonly printf ${HOME}
+		--verbose sed 'quoted text' -eu done local && $(pwd) awk
+then $(pwd) test printf "$@" sed test done x=1 $(pwd) local && local -eu ${HOME}
+	awk done --verbose 'quoted text' echo
+	/usr/bin done test test "$@" done && done /usr/bin
+		done $(pwd) ${HOME} echo
+$(pwd) "$1" sed local test local cd && grep done test
+echo ${HOME} then && $(pwd)
+&& "$1" local "$1" printf 2>/dev/null && /usr/bin ${HOME} grep cd &&
+	$(pwd) local 'quoted text' "$1"
+		'quoted text' "$1" done local local /usr/bin | ${HOME} done && export
+		awk sed then 'quoted text'
+then $(pwd) test | | /usr/bin x=1 echo ${HOME} 'quoted text'
+grep cd "$@" ${HOME} 'quoted text'
+| sed export local "$1" 'quoted text' x=1 awk 2>/dev/null grep echo x=1 grep "$1"
+	done sed 2>/dev/null grep test && echo --verbose /usr/bin --verbose
+${HOME} | test /usr/bin local cd --verbose $(pwd) done | "$@" /usr/bin awk ${HOME}
+	done export $(pwd) sed export cd cd test x=1 echo
+-eu | "$@" $(pwd) $(pwd) local test 'quoted text' 'quoted text' printf done
+&& cd local cd local x=1 x=1 grep "$1" 'quoted text' sed done $(pwd)
+	done echo test 'quoted text' sed /usr/bin 'quoted text' $(pwd) x=1 printf --verbose
+		echo && grep 'quoted text' sed x=1 readonly | $(pwd) echo awk x=1
+	grep --verbose sed echo echo cd /usr/bin sed 'quoted text'
+	grep done $(pwd) echo done 2>/dev/null grep done "$@" 'quoted text'
+		"$@" "$1" && done local --verbose local
+		| printf 'quoted text' && readonly export readonly
+	2>/dev/null grep local -eu then printf awk echo && sed --verbose readonly grep
+		awk $(pwd) done x=1 printf echo awk "$@" ${HOME} -eu -eu
+		readonly && then --verbose done /usr/bin 'quoted text' awk x=1 'quoted text'
+	&& /usr/bin ${HOME} | ${HOME} local printf && done
+	export && sed 2>/dev/null sed -eu /usr/bin local then -eu --verbose
+		readonly 2>/dev/null test --verbose
+	then sed 2>/dev/null -eu then && x=1 | --verbose x=1 local
+	'quoted text' | export && cd grep 2>/dev/null
+	local awk grep echo done test 2>/dev/null grep local awk
+${HOME} ${HOME} sed then && "$1" local printf done cd
+	/usr/bin export | "$1" test 'quoted text' --verbose /usr/bin 2>/dev/null 'quoted text'
+&& /usr/bin then | "$1" export | awk sed --verbose export -eu
+sed echo grep x=1 readonly /usr/bin done grep && ${HOME}
+readonly local done awk printf 'quoted text'
+	cd sed export readonly sed ${HOME} | cd done && printf "$1" -eu 2>/dev/null
+		local 'quoted text' done 2>/dev/null /usr/bin "$@" && && ${HOME} | /usr/bin
+echo --verbose awk 'quoted text' 2>/dev/null grep && done awk export
+| --verbose cd "$@" echo
+	printf && then sed cd -eu printf -eu sed $(pwd) "$@"
+readonly sed cd | done | 'quoted text'
+	'quoted text' export "$@" ${HOME} cd cd | cd
+echo 'quoted text' 2>/dev/null | "$1" export grep done grep local
+	2>/dev/null sed printf "$@" grep export /usr/bin x=1 "$1" | /usr/bin
+awk -eu sed done --verbose grep grep $(pwd) local then $(pwd)
+	'quoted text' done then test /usr/bin export echo 'quoted text'
+awk test echo sed export local
+		"$@" -eu then done --verbose ${HOME} test | sed sed readonly
+	done ${HOME} echo -eu --verbose test done | $(pwd) sed x=1 local
+x=1 cd cd then ${HOME} cd 2>/dev/null ${HOME} done /usr/bin export cd
+	| cd 2>/dev/null ${HOME} sed 2>/dev/null readonly awk ${HOME} 'quoted text' "$1"
+		export | echo echo -eu done then | local 2>/dev/null printf 2>/dev/null "$1"
+	&& x=1 2>/dev/null test cd cd sed awk then $(pwd) --verbose awk 2>/dev/null
+2>/dev/null "$1" && --verbose
+'quoted text' ${HOME} ${HOME} | export then "$@" | test cd local awk
+		then 2>/dev/null cd sed $(pwd)
+"$1" 2>/dev/null grep awk test printf test sed /usr/bin
+| ${HOME} grep then x=1
+	2>/dev/null "$1" local test 2>/dev/null awk && $(pwd)
+		local printf printf | printf
+		echo printf local 'quoted text' grep local printf 'quoted text'
+${HOME} then | && /usr/bin
+| grep | "$@" awk printf local 2>/dev/null
+"$1" "$1" x=1 /usr/bin awk --verbose
+		grep "$1" cd awk local printf export awk $(pwd) then 2>/dev/null
+		grep --verbose x=1 && export 2>/dev/null awk readonly grep /usr/bin
+${HOME} 2>/dev/null -eu
+x=1 -eu awk x=1 ${HOME} done local cd echo 'quoted text' /usr/bin grep && 'quoted text'
+"$1" --verbose test "$1" readonly /usr/bin "$1" awk "$1" readonly 'quoted text'
+	--verbose && "$@" x=1 | grep done sed echo | grep grep grep test export
+readonly awk done test $(pwd) 'quoted text' then printf 2>/dev/null
+	"$1" x=1 "$@" /usr/bin
+$(pwd) printf "$1" awk printf 2>/dev/null
+'quoted text' /usr/bin 'quoted text' /usr/bin | x=1 grep done
+	-eu --verbose awk awk /usr/bin 2>/dev/null
+		2>/dev/null grep /usr/bin
+		printf ${HOME} | echo
+${HOME} 2>/dev/null grep "$@" "$@" --verbose readonly 2>/dev/null grep
+		$(pwd) 2>/dev/null printf done 'quoted text' x=1 then ${HOME} "$@"
+/usr/bin then 'quoted text' -eu
+--verbose test 2>/dev/null ${HOME} then 2>/dev/null readonly done sed 'quoted text'
+	export export x=1 test | printf printf sed -eu --verbose readonly 'quoted text'
+		sed sed $(pwd) local x=1 ${HOME} cd ${HOME} test x=1 printf
+		| "$1" $(pwd) then echo printf export printf /usr/bin echo grep 2>/dev/null 'quoted text'
+		${HOME} printf /usr/bin done $(pwd) printf -eu 2>/dev/null
+readonly cd /usr/bin test printf x=1 --verbose 'quoted text'
+		awk local -eu /usr/bin -eu -eu --verbose 2>/dev/null
+	awk | && cd readonly done --verbose ${HOME} "$1" && echo -eu "$1" printf grep
+		cd sed printf "$1" echo sed 2>/dev/null "$@" cd readonly ${HOME} awk ${HOME}
+	"$1" cd --verbose awk test 'quoted text' echo done readonly x=1 --verbose
+		--verbose awk --verbose echo 2>/dev/null
+	| then "$@" 2>/dev/null awk test local grep
+		sed x=1 test && cd test printf $(pwd) printf && ${HOME} 'quoted text' &&
+		${HOME} done && "$1" "$1" --verbose
+$(pwd) | awk local done "$1" cd | | | grep x=1 echo 2>/dev/null
+done local local x=1 done /usr/bin
+		| | -eu sed 2>/dev/null readonly "$1" ${HOME} "$1" grep awk
+awk export | local "$@" printf -eu then
+		2>/dev/null grep "$@" /usr/bin x=1 | readonly export done -eu
+		sed echo sed --verbose awk -eu export export printf -eu export
+&& "$@" /usr/bin sed done readonly
+		'quoted text' echo "$@" 2>/dev/null echo "$1" --verbose 2>/dev/null cd "$@"
+		cd $(pwd) 'quoted text' && local 2>/dev/null
+done export local export done sed sed printf grep then
+'quoted text' then 'quoted text' export
+	then | test printf printf export ${HOME} cd local sed /usr/bin 2>/dev/null
+	--verbose export export | then $(pwd) awk && local
+	$(pwd) -eu "$@" local printf x=1 grep 2>/dev/null test then readonly
+| test test grep $(pwd) "$1" readonly x=1 2>/dev/null "$1" /usr/bin 2>/dev/null
+cd local 2>/dev/null then && readonly "$@" 'quoted text'
+/usr/bin "$1" export -eu "$@" 2>/dev/null
+	echo $(pwd) /usr/bin readonly
+	local done done printf --verbose "$@"
+--verbose --verbose --verbose local done readonly
+| done then $(pwd) test $(pwd)
+		then "$1" --verbose x=1 cd && && /usr/bin grep $(pwd)
+local echo cd "$@" export ${HOME} /usr/bin grep awk x=1 2>/dev/null
+"$@" $(pwd) then sed printf --verbose
+	$(pwd) "$1" cd x=1 echo local -eu 2>/dev/null
+--verbose test echo grep done
+	awk readonly then done 2>/dev/null sed --verbose
+		sed 2>/dev/null done grep readonly local x=1 /usr/bin
+"$@" then -eu ${HOME} awk export 'quoted text' sed awk readonly ${HOME} local
+		awk | cd export then && --verbose | && "$1" done && -eu export echo && export
+x=1 done local grep 2>/dev/null -eu export 'quoted text'
+test export ${HOME} | "$@" done echo | $(pwd) | done done "$1" printf export
+$(pwd) 'quoted text' "$1" && cd test 2>/dev/null awk export sed
+		/usr/bin cd then -eu -eu readonly && $(pwd) echo readonly cd "$1" /usr/bin
+${HOME} | --verbose cd local printf grep export ${HOME} "$@" ${HOME}
+printf echo -eu && 'quoted text' done local echo -eu ${HOME} /usr/bin
+readonly done -eu /usr/bin --verbose grep cd "$@" -eu
+		| awk --verbose ${HOME}
+		"$1" done 2>/dev/null grep awk | export awk | x=1 --verbose x=1 &&
+		grep printf done --verbose ${HOME} 'quoted text' readonly sed
+	then sed "$1" echo echo done 'quoted text' -eu -eu ${HOME}
+		| "$@" ${HOME} "$@" --verbose awk $(pwd) echo && ${HOME} "$@"
+	$(pwd) x=1 $(pwd) -eu cd local --verbose cd test | /usr/bin
+		"$@" --verbose sed echo grep export cd grep | ${HOME}
+	&& "$@" echo done /usr/bin cd ${HOME} readonly | cd $(pwd) -eu 2>/dev/null
+	cd $(pwd) grep local -eu cd "$1"
+		done then local printf local export
+		-eu test $(pwd) "$1" 2>/dev/null -eu local local --verbose then | done
+		"$@" 2>/dev/null "$1" && done --verbose
+	&& printf x=1 export -eu ${HOME} 2>/dev/null
+	readonly "$1" local 'quoted text' x=1 sed x=1 && | && echo /usr/bin "$@" 2>/dev/null
+		2>/dev/null "$@" --verbose
+		local readonly "$@" "$@" export printf cd && | && export test $(pwd) echo
+export sed sed 'quoted text' 'quoted text' 2>/dev/null 'quoted text'
+	done test "$@" cd readonly printf readonly
+sed cd test | "$1" 'quoted text'
+"$@" ${HOME} "$@" 2>/dev/null awk && /usr/bin then "$@" 2>/dev/null local
+printf printf export /usr/bin $(pwd) local /usr/bin x=1 cd /usr/bin
+		echo --verbose 2>/dev/null 2>/dev/null echo 'quoted text'
+	"$1" /usr/bin /usr/bin -eu local readonly && export echo readonly test export "$1"
+	sed /usr/bin cd then | then ${HOME} printf readonly --verbose echo -eu
+2>/dev/null cd --verbose -eu echo ${HOME} sed "$1" cd test "$@" test local
+		x=1 && --verbose "$@" printf /usr/bin --verbose test echo "$@" && printf
+	readonly grep /usr/bin printf | $(pwd) test
+		cd && -eu done cd done grep x=1 2>/dev/null "$@" --verbose test "$1" /usr/bin
+/usr/bin --verbose /usr/bin && printf --verbose local done
+	--verbose awk export | cd --verbose
+&& awk "$@" test export 'quoted text' printf sed && test |
+		export x=1 local && 2>/dev/null
+	readonly grep readonly cd test awk done --verbose cd "$1" /usr/bin
+	printf -eu --verbose awk local awk
+	"$1" 2>/dev/null readonly | -eu export
+${HOME} x=1 awk x=1 x=1 "$1" printf done $(pwd) $(pwd) sed test test done
+		export ${HOME} /usr/bin test then readonly export
+readonly "$@" ${HOME}
+-eu x=1 echo printf 'quoted text' --verbose
+grep | --verbose "$@" grep echo sed && -eu 2>/dev/null && && 2>/dev/null then
+		test cd local printf readonly "$1" export printf
+	-eu 2>/dev/null awk printf test --verbose
+	test cd local "$1" $(pwd) "$1" then then awk cd awk readonly
+	"$1" awk then cd $(pwd) grep awk test grep
+printf done -eu done ${HOME} sed export sed printf $(pwd) $(pwd) done
+	awk printf 'quoted text' done && export | done local
+| | 'quoted text' local export
+		grep done awk /usr/bin sed export printf grep sed then
+	--verbose $(pwd) | --verbose
+	x=1 cd echo ${HOME} export cd "$@" | | echo $(pwd) ${HOME} /usr/bin echo printf
+grep local export x=1 grep printf --verbose x=1
+	echo 'quoted text' export cd "$@" && export --verbose x=1
+		--verbose echo "$1" x=1 printf cd -eu
+export 'quoted text' export export cd readonly "$@" awk -eu
+		| cd "$1" 'quoted text'
+&& printf -eu --verbose /usr/bin -eu
+printf ${HOME} export grep "$@" printf "$1" sed export
+| echo readonly readonly "$1" done sed test awk
+		local grep "$1" echo awk ${HOME} done test 'quoted text' export
+		${HOME} test x=1 grep x=1 echo then sed ${HOME} awk local | x=1
+		| 'quoted text' sed --verbose test done -eu x=1 export
+sed | $(pwd) printf sed -eu export echo /usr/bin
+		-eu 2>/dev/null ${HOME} 2>/dev/null awk && local then cd echo "$1" 2>/dev/null
+		-eu ${HOME} "$@" sed done done sed local test ${HOME}
+		local /usr/bin local 2>/dev/null &&
+		export sed ${HOME} sed
+--verbose then then ${HOME} cd "$@" readonly test --verbose | ${HOME} test
+		test readonly grep readonly readonly echo
+		readonly local | local local then "$1" -eu echo | export echo |
+		"$1" test sed grep awk echo cd ${HOME} 2>/dev/null x=1 x=1 local
+	then printf awk /usr/bin sed && local echo 'quoted text'
+${HOME} ${HOME} 2>/dev/null done grep 'quoted text' cd echo test
+		"$1" readonly then "$1" test test
+cd export cd x=1 echo printf cd sed 2>/dev/null export | local "$@"
+	local local test "$@" readonly readonly "$@" export then $(pwd) export
+sed --verbose --verbose && | /usr/bin | && ${HOME} done test --verbose echo readonly
+		done 'quoted text' sed "$@" -eu local
+		test cd cd 2>/dev/null cd "$1"
+	--verbose -eu readonly 2>/dev/null done /usr/bin cd
+	"$1" x=1 local then then sed then 'quoted text'
+grep /usr/bin "$@" export cd test awk && /usr/bin awk -eu --verbose 'quoted text'
+| -eu printf 2>/dev/null --verbose
+		$(pwd) echo x=1 --verbose
+	echo && 2>/dev/null echo export printf /usr/bin cd awk awk
+sed sed sed "$1" | 'quoted text' -eu printf 'quoted text'
+x=1 readonly 2>/dev/null x=1 grep && awk grep -eu awk printf grep $(pwd)
+	x=1 "$1" /usr/bin then ${HOME} cd $(pwd) "$@" | cd && grep cd 2>/dev/null
+then sed $(pwd) readonly local "$1"
+sed test /usr/bin local then sed $(pwd) test --verbose x=1 awk
+done done ${HOME} readonly readonly /usr/bin x=1
+--verbose ${HOME} then readonly grep printf && awk x=1 grep
+	echo grep ${HOME} cd awk x=1 --verbose "$@" x=1 x=1 2>/dev/null -eu readonly
+x=1 | grep --verbose --verbose /usr/bin 'quoted text'
+cd test export | 'quoted text'
+	&& cd done $(pwd) /usr/bin cd 'quoted text' printf then ${HOME}
+'quoted text' cd echo --verbose ${HOME} $(pwd) awk
+$(pwd) done /usr/bin local ${HOME} awk ${HOME}
+	"$1" -eu /usr/bin "$@" grep then export readonly 'quoted text' done x=1 2>/dev/null
+"$1" | 2>/dev/null $(pwd) &&
+		| awk x=1 $(pwd) export sed then sed grep
+		"$1" $(pwd) && cd local "$1" then export sed printf done 'quoted text' --verbose
+	$(pwd) export && done ${HOME} cd printf --verbose | | sed then &&
+		-eu done printf 2>/dev/null cd && done "$@" 2>/dev/null done local x=1 x=1
+grep echo grep "$1" "$@" grep "$1" "$@" then grep
+	then readonly 2>/dev/null "$@" --verbose
+		--verbose echo readonly readonly | "$1" test then |
+		$(pwd) 'quoted text' "$1"
+		done | echo --verbose "$1" /usr/bin readonly /usr/bin "$@" local
+'quoted text' printf ${HOME}
+| "$@" test /usr/bin "$1" 2>/dev/null $(pwd)
+	echo 2>/dev/null ${HOME} ${HOME} -eu echo test
+	local $(pwd) test && ${HOME} 'quoted text' readonly
+cd grep cd --verbose -eu cd -eu "$@" "$1" | | ${HOME} x=1 local --verbose
+		$(pwd) ${HOME} cd -eu $(pwd) "$@" readonly 'quoted text' $(pwd) --verbose export
+printf "$@" "$@" 'quoted text' sed "$1" 'quoted text'
+	grep "$@" | && -eu printf awk | local /usr/bin "$@" printf grep --verbose && | done
+	echo cd "$@" then cd grep "$@" /usr/bin /usr/bin
+	"$1" local 'quoted text' cd
+	-eu cd "$1" awk 'quoted text' awk grep /usr/bin -eu sed ${HOME} sed "$1"
+	export readonly $(pwd) -eu /usr/bin x=1 && grep export awk 'quoted text' &&
+	grep then --verbose 'quoted text' /usr/bin sed --verbose 2>/dev/null
+grep --verbose export echo grep then test readonly
+	/usr/bin /usr/bin -eu printf && "$1" export sed then grep 'quoted text' x=1 echo
+	grep 2>/dev/null done
+	-eu done 2>/dev/null then 2>/dev/null grep 2>/dev/null
+&& | local ${HOME} printf 'quoted text'
+"$1" | local $(pwd) | $(pwd) readonly export export echo local
+	-eu local then --verbose /usr/bin cd export /usr/bin export echo 'quoted text'
+printf readonly --verbose ${HOME} export --verbose && then
+		'quoted text' | printf --verbose sed cd x=1 && test 2>/dev/null cd $(pwd)
+		"$@" grep 'quoted text' local cd | $(pwd) x=1 "$1" x=1 grep cd then
+		${HOME} sed $(pwd) /usr/bin && done && 'quoted text' && readonly
+x=1 echo -eu -eu $(pwd) printf
+		| test readonly "$1" ${HOME} ${HOME} echo
+		export sed readonly grep && test grep /usr/bin cd grep test
+done test done && awk sed $(pwd) export $(pwd) && --verbose
+	$(pwd) -eu "$1" x=1 | test awk export ${HOME} done printf
+--verbose "$@" grep "$1" | cd | awk "$1" && awk cd local printf
+	/usr/bin /usr/bin ${HOME} x=1 && export "$@" cd 'quoted text'
+	export test grep cd sed readonly $(pwd)
+	2>/dev/null readonly printf $(pwd)
+		&& export 'quoted text' then local 2>/dev/null awk /usr/bin
+		done export 2>/dev/null 'quoted text' awk &&
+		cd then cd then 'quoted text' echo sed $(pwd) grep -eu
+	cd x=1 x=1 echo --verbose printf /usr/bin
+sed && ${HOME} && awk "$1" readonly --verbose x=1 cd then printf local
+-eu then 'quoted text' | x=1 "$1" | ${HOME} 'quoted text'
+		export sed cd -eu ${HOME} local | readonly local && echo && cd grep printf
+/usr/bin grep x=1 cd done
+echo readonly x=1 export ${HOME} echo ${HOME} grep then | "$@"
+		/usr/bin --verbose | then echo ${HOME} done 2>/dev/null
+	export -eu --verbose then | sed "$1" ${HOME} 2>/dev/null export 'quoted text'
+		test echo then then local && grep sed --verbose
+		readonly 'quoted text' && cd export $(pwd)
+printf printf -eu export readonly
+		"$1" 'quoted text' /usr/bin awk $(pwd) x=1 -eu && sed | /usr/bin
+		2>/dev/null printf && cd
+		--verbose done then | $(pwd) done done
+		$(pwd) local /usr/bin done "$1" /usr/bin sed cd /usr/bin
+		local ${HOME} local | x=1 readonly && $(pwd) 'quoted text' test local /usr/bin
+	/usr/bin --verbose echo
+done $(pwd) sed "$1" printf /usr/bin "$@" -eu awk grep
+&& done export /usr/bin test echo
+x=1 ${HOME} echo readonly test -eu readonly $(pwd)
+		--verbose $(pwd) local "$@" export 2>/dev/null
+	--verbose cd "$1" x=1 readonly echo
+export cd "$1" readonly $(pwd) "$1" local printf printf awk 2>/dev/null
+cd 'quoted text' --verbose
+	2>/dev/null /usr/bin then readonly "$1" --verbose printf readonly
+'quoted text' $(pwd) grep echo x=1 'quoted text' 'quoted text' x=1 'quoted text'
+	then local /usr/bin printf local then 'quoted text' "$@" $(pwd) cd sed 2>/dev/null
+		| "$@" export cd "$@" -eu -eu cd && printf ${HOME} cd | cd then readonly | awk
+	$(pwd) grep | | "$@" echo awk grep && grep -eu cd 'quoted text' done
+"$1" "$@" 2>/dev/null "$1" readonly readonly "$@" | ${HOME}
+local -eu grep test test ${HOME} done 'quoted text'
+	awk "$@" export then $(pwd) "$1" then "$@" 2>/dev/null export
+	test ${HOME} "$1" then && "$1" "$1"
+	${HOME} sed then cd --verbose readonly ${HOME} && --verbose local done local grep
+	'quoted text' 2>/dev/null grep ${HOME} /usr/bin &&
+	printf test cd readonly "$@" done -eu "$@" cd awk done printf
+		export sed | | $(pwd) readonly
+		echo $(pwd) && local then
+#include c154.sh
+2>/dev/null sed awk --verbose -eu "$1" done "$1" && 2>/dev/null
+		x=1 sed printf 'quoted text' readonly local done echo printf printf sed 2>/dev/null
+	$(pwd) done 'quoted text' awk
+		x=1 && echo "$@" "$1" && printf readonly x=1 "$@" cd x=1
+		export x=1 && readonly && cd readonly sed local && 2>/dev/null
+	&& && "$1" 2>/dev/null done printf "$1" $(pwd) /usr/bin $(pwd) 2>/dev/null
+	2>/dev/null cd awk &&
+		grep readonly test -eu
+	local echo printf then "$@"
+		2>/dev/null done "$@" x=1 export
+	grep sed export done $(pwd) readonly --verbose
+		"$1" local printf cd echo then 'quoted text' echo -eu then &&
+	local && echo printf | grep printf
+then local readonly x=1 done
+${HOME} && "$@" awk "$@" $(pwd) -eu /usr/bin awk | export then done -eu done
+		done then | local local --verbose grep "$1"
+2>/dev/null echo local printf echo 2>/dev/null | -eu
+		printf "$1" local done awk then awk echo --verbose | printf grep test readonly
+		"$1" awk done && && | $(pwd) /usr/bin sed
+local sed done 2>/dev/null x=1 grep "$@" then | cd done printf "$@" test
+		printf --verbose 2>/dev/null -eu readonly && grep printf
+2>/dev/null awk export sed sed 'quoted text' printf readonly readonly
+		x=1 echo echo export /usr/bin readonly 'quoted text'
+	then "$@" sed x=1 awk x=1 ${HOME} export "$1"
+		/usr/bin | /usr/bin readonly local -eu then then | readonly && awk printf local
+	| x=1 /usr/bin echo /usr/bin /usr/bin /usr/bin | sed 2>/dev/null ${HOME} local
+		$(pwd) cd "$1" "$1" -eu --verbose
+	grep local --verbose done
+$(pwd) $(pwd) test cd /usr/bin awk sed local $(pwd) local echo "$@"
+		&& --verbose && && "$@" | printf
+| grep done test $(pwd) ${HOME} then x=1 test $(pwd) -eu cd -eu && test grep
+	$(pwd) awk /usr/bin -eu readonly test 'quoted text' awk readonly
+	sed 'quoted text' -eu readonly readonly test then echo "$@" cd done printf
+x=1 local 'quoted text' export test sed 'quoted text' grep
+-eu $(pwd) grep --verbose grep "$@" "$1" "$1" ${HOME} local echo /usr/bin
+	--verbose test printf x=1
+"$1" /usr/bin test local 'quoted text'
+	echo grep $(pwd) local "$@" "$1" readonly
+2>/dev/null x=1 export -eu "$@" done --verbose /usr/bin --verbose export grep
+	x=1 awk "$@" done export grep echo cd 2>/dev/null echo export -eu echo echo
+printf cd "$@" /usr/bin 2>/dev/null
+	$(pwd) 'quoted text' && printf
+		export --verbose cd test /usr/bin test awk
+		echo 2>/dev/null -eu grep echo test awk printf
+	awk echo --verbose then /usr/bin $(pwd) sed x=1 /usr/bin awk printf echo awk done
+readonly printf readonly sed readonly grep --verbose ${HOME}
+		local | then grep 'quoted text' ${HOME} readonly | --verbose printf
+		&& 'quoted text' readonly $(pwd) x=1 "$@" | ${HOME} | 2>/dev/null x=1
+		awk --verbose 2>/dev/null printf --verbose
+	x=1 x=1 $(pwd) -eu awk local /usr/bin sed awk readonly /usr/bin --verbose
+	| && then cd readonly sed printf $(pwd) "$1" readonly -eu cd printf
+x=1 awk awk grep "$1" 2>/dev/null $(pwd) test | grep
+readonly awk && -eu readonly echo grep test printf
+2>/dev/null printf printf readonly $(pwd) -eu | 2>/dev/null
+&& local -eu echo ${HOME} ${HOME} echo
+then x=1 "$@" cd printf awk "$@" grep cd "$1" /usr/bin local printf then echo
+		${HOME} && cd x=1 cd 2>/dev/null | sed "$@" awk x=1 done 'quoted text' -eu awk -eu
+		--verbose export -eu export done -eu
+		"$@" test ${HOME} local 2>/dev/null
+	"$@" /usr/bin then --verbose
+		${HOME} 2>/dev/null then && export /usr/bin cd $(pwd) && done ${HOME} --verbose
+	-eu cd 2>/dev/null done | 2>/dev/null "$@" -eu sed local --verbose "$@"
+x=1 export readonly then -eu $(pwd) "$@" "$@" -eu sed "$@"
+	&& /usr/bin -eu readonly printf
+echo && --verbose "$@" export cd export && "$1" cd grep cd local x=1 sed --verbose
+		&& "$@" && --verbose -eu --verbose 'quoted text'
+	grep then 'quoted text' "$@" "$@" done | && readonly
+	printf | 2>/dev/null done ${HOME} echo | /usr/bin
+		x=1 echo local readonly test cd cd 2>/dev/null export printf
+"$@" readonly readonly done && "$1" | ${HOME} grep $(pwd) ${HOME} $(pwd)
+	'quoted text' printf readonly local test readonly printf && grep $(pwd)
+	grep test $(pwd) cd "$1" --verbose -eu awk --verbose printf x=1 sed
+	echo x=1 2>/dev/null ${HOME} && local printf
+		awk grep then && x=1 x=1 'quoted text' done export
+"$1" export readonly sed grep | && done ${HOME} readonly local cd grep
+		echo /usr/bin $(pwd) echo 'quoted text' readonly --verbose | 2>/dev/null
+		cd done grep local local "$@" printf "$1" done local cd readonly
+&& done | awk | export && sed printf grep -eu grep 2>/dev/null 'quoted text'
+-eu ${HOME} export "$1" && test
+		test 'quoted text' /usr/bin test --verbose export x=1 readonly ${HOME} ${HOME}
+		x=1 "$1" -eu echo x=1 grep && done 'quoted text' test ${HOME} ${HOME} printf
+	-eu ${HOME} "$@" "$1" /usr/bin --verbose test
+done $(pwd) x=1 "$1" done | export x=1 printf
+		cd ${HOME} | -eu awk then printf ${HOME} cd printf && && grep then done &&
+2>/dev/null grep sed readonly done /usr/bin --verbose x=1 $(pwd) local local "$@"
+awk sed export --verbose "$@" -eu "$@" local $(pwd) echo
+		&& 'quoted text' cd export x=1 x=1 -eu /usr/bin
+	then "$@" local readonly 'quoted text' cd $(pwd)
+local 'quoted text' printf | sed --verbose
+x=1 test --verbose -eu /usr/bin
+		'quoted text' awk sed && then "$1" cd then local grep "$1" --verbose local
+export then 'quoted text' "$@" sed test | ${HOME}
+	'quoted text' readonly && 'quoted text' ${HOME} then
+2>/dev/null "$@" export ${HOME} "$@" grep local echo test echo export readonly
+"$@" sed $(pwd) echo then printf local then sed 2>/dev/null "$1" export && printf
+		&& export ${HOME} "$@" ${HOME}
+		grep "$1" "$@" -eu export then
+		sed done then then test "$1" --verbose
+		x=1 sed && --verbose "$@"
+		/usr/bin /usr/bin x=1 x=1 readonly cd $(pwd) then
+	| ${HOME} 'quoted text' "$@" x=1 ${HOME} sed | then export then && 'quoted text'
+"$1" "$@" then awk 'quoted text' test test cd readonly test export -eu echo
+local --verbose grep then
+	'quoted text' $(pwd) /usr/bin -eu ${HOME} "$@"
+		${HOME} -eu 2>/dev/null sed awk "$1" awk "$@" printf readonly
+"$1" then -eu awk $(pwd) sed export awk "$@"
+		sed then | ${HOME} cd 2>/dev/null readonly done 2>/dev/null local export
+/usr/bin "$1" local /usr/bin $(pwd) printf x=1 then export ${HOME} --verbose
+		sed printf x=1 printf /usr/bin --verbose printf readonly export then |
+--verbose grep printf test readonly local ${HOME}
+		sed local then cd readonly awk "$@" "$@" "$@" 'quoted text' grep
+		grep test && then export echo export /usr/bin --verbose
+	'quoted text' echo echo | && sed $(pwd)
+		x=1 local -eu 2>/dev/null $(pwd) 'quoted text'
+	--verbose cd done cd ${HOME} -eu 'quoted text' echo 2>/dev/null ${HOME} ${HOME}
+	export $(pwd) | then && ${HOME} x=1 readonly test test readonly printf local --verbose
+		| $(pwd) export | 'quoted text'
+	'quoted text' 2>/dev/null 2>/dev/null cd awk awk printf && x=1 --verbose
+		'quoted text' -eu echo cd readonly
+		export 2>/dev/null echo /usr/bin then local x=1
+&& local ${HOME} cd x=1 export done "$1"
+		awk "$@" sed test ${HOME} 2>/dev/null sed && done ${HOME}
+sed /usr/bin grep awk printf "$@" grep test -eu
+	readonly printf local 'quoted text' "$1" cd done -eu
+		| $(pwd) ${HOME} cd awk local x=1 local awk 2>/dev/null
+		'quoted text' "$1" cd local && "$1" "$@" -eu
+		| x=1 export | sed && echo ${HOME} --verbose
+&& 2>/dev/null readonly -eu "$1" $(pwd) printf ${HOME}
+		grep $(pwd) awk cd sed test "$1"
+		cd printf printf /usr/bin sed printf grep grep
+		"$1" printf sed export 2>/dev/null "$1" done export
+	sed printf test export "$@" $(pwd) then -eu readonly readonly --verbose then /usr/bin
+	printf test "$@" /usr/bin then 2>/dev/null
+		done grep /usr/bin echo local export x=1 && printf test 2>/dev/null
+local "$1" readonly readonly
+		2>/dev/null cd 'quoted text'
+x=1 2>/dev/null $(pwd) grep ${HOME} test
+readonly printf ${HOME} export echo
+		&& --verbose test /usr/bin -eu
+	--verbose 2>/dev/null "$1" ${HOME} /usr/bin
+'quoted text' cd done export awk /usr/bin awk readonly /usr/bin 2>/dev/null
+$(pwd) local grep awk | 'quoted text'
+		2>/dev/null done "$@" ${HOME} test readonly
+		'quoted text' sed -eu grep 'quoted text' /usr/bin done test -eu printf done
+		then local x=1 done 'quoted text' --verbose $(pwd) --verbose
+grep | /usr/bin printf sed readonly ${HOME} --verbose &&
+sed awk cd | export 2>/dev/null
+		grep echo 'quoted text' cd /usr/bin --verbose --verbose local export
+	printf $(pwd) -eu test 'quoted text' export sed 2>/dev/null sed && sed x=1 "$1"
+	'quoted text' echo 'quoted text'
+	$(pwd) ${HOME} 'quoted text'
+test $(pwd) cd done printf && "$1" echo /usr/bin test cd -eu && ${HOME} /usr/bin
+		"$1" cd && $(pwd) echo 'quoted text' 2>/dev/null
+	then "$@" $(pwd) printf local
+	done -eu cd "$1" 2>/dev/null 'quoted text'
+export grep echo sed && -eu echo && sed ${HOME}
+| readonly sed -eu x=1 'quoted text'
+test 2>/dev/null readonly export then
+		awk "$1" done awk "$1" cd done done
+	awk 2>/dev/null awk $(pwd) echo x=1
+		readonly cd local -eu x=1 printf -eu
+		then | --verbose ${HOME} -eu awk printf local cd
+$(pwd) test grep | echo $(pwd) x=1
+	echo "$1" local && && "$@" grep grep "$@" 2>/dev/null $(pwd)
+local 'quoted text' sed x=1 awk done then "$@" test x=1 test
+		'quoted text' then 'quoted text' export sed
+	&& 2>/dev/null then "$1" 2>/dev/null awk grep test done /usr/bin then
+		awk --verbose 2>/dev/null "$@" && 'quoted text'
+| x=1 | grep awk echo -eu awk --verbose
+		local x=1 readonly awk local -eu then cd echo x=1 2>/dev/null grep
+/usr/bin sed cd && -eu -eu echo printf --verbose then done sed /usr/bin &&
+sed -eu ${HOME} 2>/dev/null local readonly |
+		then sed $(pwd) 2>/dev/null readonly | then /usr/bin && then cd "$@" awk awk
+"$1" ${HOME} echo | | export $(pwd) export
+	cd | readonly x=1 2>/dev/null
+/usr/bin awk --verbose sed printf "$1" x=1 && printf /usr/bin done local "$@"
+	then echo x=1 /usr/bin echo grep sed $(pwd) export echo test
+then sed readonly local 2>/dev/null readonly /usr/bin echo
+"$1" ${HOME} cd then grep -eu then ${HOME} cd readonly | 'quoted text' done test
+		-eu sed export -eu /usr/bin --verbose 'quoted text' local "$1" echo
+		test && -eu | --verbose ${HOME} grep awk
+		-eu readonly readonly x=1 sed
+		printf local sed 'quoted text' local
+	echo $(pwd) "$@" --verbose test | done
+	| readonly then then /usr/bin -eu export 'quoted text' 'quoted text' $(pwd) |
+		test echo "$1" 2>/dev/null 2>/dev/null printf readonly "$@" grep
+		test test /usr/bin printf x=1 --verbose echo -eu "$1" && test "$1" local 'quoted text'
+		2>/dev/null --verbose 'quoted text' echo local -eu cd
+		cd "$@" "$@" "$@" | 2>/dev/null
+	| sed 'quoted text' test echo test done grep /usr/bin export | /usr/bin grep
+cd ${HOME} awk echo ${HOME}
+then -eu readonly test echo cd sed 'quoted text' | done ${HOME} sed $(pwd)
+	cd done awk cd 2>/dev/null then $(pwd) echo echo --verbose local
+	awk 'quoted text' 2>/dev/null test 2>/dev/null
+		printf 2>/dev/null cd --verbose $(pwd) grep ${HOME} test ${HOME} | -eu
+		sed printf done && x=1 $(pwd) "$@" x=1 /usr/bin 2>/dev/null awk 'quoted text'
+--verbose awk "$1" -eu "$@" 2>/dev/null sed -eu done test done sed "$@"
+2>/dev/null then echo readonly ${HOME} then echo --verbose readonly
+	'quoted text' local --verbose
+&& local "$1" && sed awk --verbose
+echo export 'quoted text' grep cd sed awk x=1 "$1" awk local test /usr/bin --verbose
+		echo echo "$1" /usr/bin then && then readonly x=1
+		--verbose local --verbose | then --verbose
+		/usr/bin 'quoted text' /usr/bin
+	done printf "$@" grep ${HOME} | printf /usr/bin readonly
+	/usr/bin cd echo "$@" printf /usr/bin
+	export local $(pwd) awk -eu 2>/dev/null done
+		local 2>/dev/null sed grep "$1" printf readonly then export done -eu x=1 --verbose
+	"$@" "$@" 'quoted text' local then cd x=1 "$@" -eu && local then grep &&
+	"$@" cd export test |
+	test --verbose sed readonly printf sed 2>/dev/null
+	&& $(pwd) cd test awk -eu "$@" then grep "$1"
+done export then | && | echo $(pwd) --verbose done echo done echo -eu test
+	test echo echo "$1" grep
+test $(pwd) ${HOME} $(pwd)
+	x=1 local -eu test sed export test printf printf ${HOME}
+		-eu then sed awk sed "$1" local
+export grep local readonly | x=1 /usr/bin export local
+	then ${HOME} echo cd echo cd | cd cd && ${HOME}
+		cd readonly echo cd local
+export x=1 export done then test readonly
+	local $(pwd) printf awk -eu $(pwd) -eu 2>/dev/null test
+done done awk done -eu
+	'quoted text' readonly | $(pwd) "$@" sed 'quoted text' printf /usr/bin
+	cd $(pwd) local awk --verbose /usr/bin grep 2>/dev/null
+	test done test sed ${HOME} then
+	/usr/bin $(pwd) ${HOME} "$1" echo | sed "$@" cd && test $(pwd) /usr/bin
+	sed echo test $(pwd) -eu $(pwd) -eu done 2>/dev/null "$@" cd /usr/bin sed "$1"
+"$1" x=1 done "$1" local local 2>/dev/null /usr/bin export local && "$@" printf
+		"$@" then "$1" -eu --verbose
+2>/dev/null /usr/bin printf -eu | then
+		test readonly ${HOME}
+	"$@" local 2>/dev/null cd awk
+		x=1 done grep "$1" awk awk "$1" readonly -eu test -eu x=1 $(pwd) echo done export
+-eu local grep sed sed awk printf export
+		then && 'quoted text' done "$@" --verbose && "$@" x=1
+		/usr/bin 2>/dev/null readonly local $(pwd) export readonly --verbose $(pwd)
+test echo readonly local sed --verbose then grep sed "$@" sed
+	${HOME} export 'quoted text' $(pwd)
+		awk export cd ${HOME} && cd "$@" done /usr/bin done cd $(pwd)
+	awk echo | readonly x=1 /usr/bin
+| done -eu 'quoted text'
+		--verbose "$1" test "$1" cd sed "$@"
+		done "$@" 2>/dev/null done awk then cd ${HOME} echo export
+	cd sed && then x=1 && && --verbose "$@" grep awk then
+		echo ${HOME} export local ${HOME}
+	test test ${HOME} -eu test sed cd && ${HOME} "$1" awk
+	readonly test sed echo readonly export 2>/dev/null test "$1" done echo
+$(pwd) readonly -eu then awk readonly | awk test 2>/dev/null
+	2>/dev/null test readonly then done awk printf | printf | /usr/bin
+		x=1 grep printf 2>/dev/null sed "$1" done printf done echo --verbose
+		readonly --verbose ${HOME} then
+$(pwd) -eu ${HOME} sed | | && test && printf
+		cd echo test printf 2>/dev/null && done 'quoted text'
+	awk --verbose ${HOME} -eu grep /usr/bin readonly done
+awk | printf | /usr/bin
+	x=1 "$1" && 'quoted text' 'quoted text' test then | cd local test test "$1" "$1"
+	--verbose | --verbose cd export then test then 'quoted text'
+		x=1 test ${HOME} $(pwd) echo readonly 'quoted text' grep "$@" /usr/bin
+"$1" test $(pwd) echo x=1 'quoted text' 2>/dev/null
+	sed | "$1" test --verbose 2>/dev/null "$@" "$1" printf /usr/bin
+		"$1" grep 'quoted text' readonly readonly -eu | echo
+		&& cd && done && echo 'quoted text'
+sed readonly grep awk echo && test readonly grep then "$1" x=1 awk
+export --verbose echo "$1" printf
+		sed sed grep "$@" grep sed cd && x=1 readonly echo 'quoted text' readonly then
+	readonly printf printf && && && printf readonly printf done "$@" test
+	echo done test && sed "$@" --verbose
+2>/dev/null ${HOME} done -eu -eu -eu echo "$@" test "$1" --verbose && "$@" --verbose
+echo printf local $(pwd) --verbose
+grep test ${HOME} export echo && | test test grep grep then printf
+		&& done && "$1" grep echo "$@" done grep ${HOME} done $(pwd)
+	local cd then done -eu "$1" cd 'quoted text' --verbose $(pwd) 'quoted text' readonly
+	'quoted text' ${HOME} printf
+then 'quoted text' "$1" awk && x=1
+printf test /usr/bin "$@" echo test -eu echo | awk /usr/bin then 'quoted text'
+export export | grep then "$1" 'quoted text' 2>/dev/null "$1" "$1" | readonly
+	/usr/bin test readonly echo "$1" local --verbose test
+	awk sed export echo export sed $(pwd) echo printf "$1"
+	&& printf sed | /usr/bin "$@" done done | then test printf test x=1 -eu $(pwd) test
+	test "$1" 'quoted text' local 'quoted text' "$@" "$@" ${HOME} done
+echo local sed --verbose readonly awk echo --verbose
+	'quoted text' test "$@" grep then done sed x=1 grep --verbose && then ${HOME}
+		then ${HOME} 2>/dev/null done x=1 sed 2>/dev/null grep awk /usr/bin test
+--verbose | ${HOME} export cd 2>/dev/null
+		awk done awk awk done -eu readonly sed "$1" -eu then "$@" "$@" echo | readonly
+		2>/dev/null test --verbose x=1 x=1
+--verbose ${HOME} ${HOME} sed printf
+&& awk printf 'quoted text' awk | 2>/dev/null
+--verbose 'quoted text' test 2>/dev/null 2>/dev/null
+	test $(pwd) "$@" 'quoted text' x=1 then
+| /usr/bin then printf /usr/bin $(pwd) grep /usr/bin printf
+	sed export $(pwd) | grep
+		awk test sed local sed test "$@" "$@"
+	echo export | $(pwd) then "$@" && -eu sed 'quoted text' /usr/bin grep
+${HOME} cd ${HOME} awk --verbose done printf --verbose x=1 local echo echo cd
+export "$1" test cd 2>/dev/null -eu ${HOME} 'quoted text' /usr/bin
+--verbose && ${HOME} grep "$1" local grep "$1" local
+		/usr/bin 'quoted text' done printf
+		done local /usr/bin /usr/bin
+	--verbose done x=1 test
+	${HOME} readonly "$1" 'quoted text' awk then done "$@" x=1
+/usr/bin 2>/dev/null
+	2>/dev/null readonly --verbose | local then then readonly
+printf awk | -eu readonly 'quoted text' export /usr/bin --verbose cd
+sed && 'quoted text' --verbose 2>/dev/null test x=1 -eu grep
+local then --verbose done $(pwd)
+		printf done awk cd echo
+| done -eu done 'quoted text' sed --verbose | export readonly then
+	grep $(pwd) 'quoted text'
+	&& ${HOME} && --verbose echo done export
+		printf | export export
+		sed export 'quoted text' local readonly sed 'quoted text' 2>/dev/null | readonly
+	${HOME} readonly | sed ${HOME}
+$(pwd) readonly x=1 "$@" /usr/bin local export export printf
+	printf --verbose 2>/dev/null grep then 'quoted text'
+	done x=1 awk 'quoted text'
+readonly test "$@" 'quoted text'
+	| then $(pwd) && cd test -eu local /usr/bin sed 'quoted text' echo echo |
+cd grep done then done /usr/bin
+		cd 'quoted text' ${HOME} -eu -eu /usr/bin
+	"$1" x=1 /usr/bin printf sed | "$1" 2>/dev/null
+		cd -eu ${HOME} done 2>/dev/null && ${HOME} cd grep readonly ${HOME}
+	sed $(pwd) $(pwd) cd awk -eu sed x=1 export cd echo 'quoted text' ${HOME}
+	readonly --verbose 2>/dev/null --verbose
+	${HOME} readonly echo && sed --verbose
+	sed && && 'quoted text' -eu readonly ${HOME} && | "$1"
+echo --verbose echo $(pwd) ${HOME} done
+printf "$@" local 2>/dev/null local sed
+		echo readonly export && echo awk readonly "$1" export then 2>/dev/null $(pwd)
+		echo sed cd printf cd export local /usr/bin echo 2>/dev/null
+		-eu cd echo "$1" x=1 "$1" printf then awk 2>/dev/null
+		2>/dev/null /usr/bin
+	"$@" local readonly $(pwd) export awk printf | /usr/bin 'quoted text'
+		2>/dev/null grep 'quoted text'
+	done --verbose done sed printf readonly readonly sed done && "$@" /usr/bin
+	grep ${HOME} ${HOME} readonly "$1" --verbose echo && test local "$@" -eu |
+		-eu x=1 "$1" ${HOME} then 2>/dev/null
+sed x=1 x=1 echo && local /usr/bin 2>/dev/null && $(pwd) cd ${HOME}
+"$@" cd awk test | 'quoted text' done export "$1" --verbose "$1" awk local 'quoted text'
+		test | "$@" local printf | done 2>/dev/null local done
+		then "$@" | awk local then "$1" && cd ${HOME} -eu ${HOME} local grep
+	test then --verbose awk export ${HOME} readonly test cd x=1
+		done $(pwd) ${HOME} && 2>/dev/null x=1 grep && grep
+&& cd x=1 then 'quoted text' | /usr/bin then then && "$1" cd then then 'quoted text'
+		-eu /usr/bin "$1" sed "$@" readonly | sed sed ${HOME} --verbose
+		"$@" cd --verbose x=1 echo /usr/bin --verbose -eu then "$@" echo 2>/dev/null
+	echo 'quoted text' export x=1
+		"$1" export --verbose done x=1 && -eu
+		| | done "$1" sed 'quoted text' grep &&
+grep | done echo then
+	done 2>/dev/null x=1 "$1" 2>/dev/null | sed x=1 sed
+		cd 2>/dev/null readonly $(pwd) sed x=1 printf export | echo awk "$@" x=1 ${HOME}
+		awk "$@" sed $(pwd) awk done awk && echo "$1" 'quoted text'
+		${HOME} "$@" sed local 'quoted text' cd then 2>/dev/null local && printf then
+"$@" $(pwd) -eu && 'quoted text' test sed then local printf
+		test "$1" "$@" readonly grep -eu printf sed 'quoted text'
+	export && 'quoted text' ${HOME}
+		cd $(pwd) printf "$1" done
+	"$1" /usr/bin test test local sed export cd awk
+"$@" --verbose then $(pwd) sed
+		2>/dev/null readonly && -eu && readonly grep && done readonly
+	&& 'quoted text' --verbose && 2>/dev/null x=1 readonly awk
+printf -eu cd then local "$1" ${HOME} "$@" x=1 readonly readonly
+"$1" then printf cd ${HOME} 2>/dev/null sed sed awk test export
+		echo done local ${HOME} test -eu test echo
+		/usr/bin local awk 'quoted text' awk && grep x=1 done "$@" cd echo 'quoted text'
+local test /usr/bin ${HOME} echo && echo echo && $(pwd) ${HOME}
+	${HOME} -eu awk "$1" 'quoted text' readonly && done -eu $(pwd) readonly readonly
+	'quoted text' local 2>/dev/null "$1" | && --verbose
+	export export readonly readonly && --verbose done cd | sed ${HOME} grep
+	then printf $(pwd) /usr/bin cd readonly -eu grep "$1"
+grep 'quoted text' "$@" | sed done 'quoted text' test -eu $(pwd) && echo /usr/bin
+		| local 'quoted text' test "$1" awk readonly | done ${HOME} local && grep printf
+	readonly printf export --verbose export /usr/bin awk awk readonly --verbose awk
+cd | /usr/bin 2>/dev/null awk "$1" "$@" -eu |
+	sed test /usr/bin $(pwd) export done done && sed ${HOME} then then
+	| -eu printf printf sed 2>/dev/null --verbose done echo test echo
+	-eu x=1 --verbose --verbose ${HOME}
+'quoted text' awk readonly "$@" && readonly
+	"$1" ${HOME} grep sed cd /usr/bin done $(pwd) cd done printf 2>/dev/null
+		"$1" printf export 'quoted text' echo
+	grep cd x=1 grep x=1 2>/dev/null then ${HOME} $(pwd)
+		${HOME} -eu 'quoted text' readonly
+		echo 'quoted text' -eu grep
+'quoted text' readonly x=1 --verbose
+	| ${HOME} printf export /usr/bin echo export ${HOME}
+local sed "$@" then awk x=1 echo done cd /usr/bin local echo 'quoted text'
+	cd x=1 "$@" done export done "$@" "$@" $(pwd) awk
+| readonly | -eu | --verbose
+'quoted text' then test grep test x=1 -eu readonly ${HOME} echo
+	printf 2>/dev/null readonly sed test -eu | sed awk readonly x=1 && grep
+		'quoted text' echo grep 2>/dev/null export awk --verbose
+	"$@" export cd "$1" 2>/dev/null
+	cd export /usr/bin test then -eu local local $(pwd)
+then cd test /usr/bin &&
+		'quoted text' awk "$@" && $(pwd) export awk "$@" awk local
+	cd --verbose | --verbose | local printf "$@" done ${HOME} 2>/dev/null local
+${HOME} test then ${HOME} 'quoted text'
+		awk local sed /usr/bin then awk done cd grep --verbose x=1
+2>/dev/null readonly 'quoted text' readonly -eu x=1 sed | export export /usr/bin
+	&& then local x=1 "$@" -eu "$@" then sed -eu --verbose cd ${HOME}
+	printf | ${HOME} grep awk -eu awk grep | 'quoted text' /usr/bin
+		-eu | awk printf x=1 echo $(pwd) awk
+	cd printf 'quoted text' readonly ${HOME}
+-eu cd ${HOME} "$@" --verbose
+		-eu printf cd | "$@" && | ${HOME} grep 'quoted text'
+		echo echo then 'quoted text' export
+		grep done $(pwd) local export 2>/dev/null 'quoted text' echo && then x=1 "$@" awk
+test | done sed --verbose grep --verbose ${HOME} 2>/dev/null /usr/bin
+	"$1" 'quoted text' done cd cd done sed
+		then x=1 test local ${HOME} done --verbose awk /usr/bin done printf
+"$1" "$1" cd sed $(pwd) | /usr/bin echo done readonly echo readonly /usr/bin
+		then && $(pwd) cd then && "$@" test local x=1 grep 'quoted text' export $(pwd)
+done /usr/bin printf | "$1" printf /usr/bin readonly |
+	/usr/bin "$1" x=1 | --verbose
+		then grep ${HOME} test 2>/dev/null sed echo grep -eu local readonly test
+		printf 2>/dev/null grep ${HOME} ${HOME} 2>/dev/null
+local test "$@" grep && x=1 sed $(pwd) | done | ${HOME} | 2>/dev/null $(pwd)
+		cd "$1" readonly export grep $(pwd) && ${HOME} awk then export
+		-eu export "$@" /usr/bin grep $(pwd) then /usr/bin
+	cd "$@" awk export printf then readonly 2>/dev/null
+		export printf then 2>/dev/null -eu export $(pwd) cd /usr/bin
+		-eu 2>/dev/null /usr/bin cd echo && ${HOME}
+sed sed | done grep export "$@" ${HOME} done export grep && x=1 "$@" $(pwd)
+	--verbose --verbose 'quoted text' printf | 2>/dev/null
+	"$1" sed /usr/bin /usr/bin
+sed --verbose printf -eu 'quoted text' ${HOME} "$@" && readonly --verbose cd
+		then -eu ${HOME} grep x=1 "$1" 'quoted text' && "$@" sed /usr/bin 2>/dev/null
+		test awk /usr/bin -eu then sed done | 2>/dev/null echo &&
+		done -eu | "$1" --verbose printf local ${HOME}
+		then awk $(pwd) ${HOME} "$1" 'quoted text' "$@" && x=1 export "$1" export
+	/usr/bin local "$@" x=1 /usr/bin | --verbose ${HOME} readonly sed -eu
+	x=1 $(pwd) $(pwd) test done export cd echo awk grep "$1" && "$1" 'quoted text'
+		awk sed "$@" /usr/bin test done sed | ${HOME} "$1" 2>/dev/null /usr/bin
+2>/dev/null | sed grep grep echo printf test
+done /usr/bin local 2>/dev/null cd 'quoted text' cd 'quoted text'
+echo test -eu $(pwd) awk done -eu 2>/dev/null
+	printf readonly readonly x=1 "$1" "$@" local $(pwd) echo test echo "$@" printf
+	x=1 awk "$@" /usr/bin 2>/dev/null
+		sed grep && 'quoted text' cd ${HOME} local test -eu "$@" $(pwd) x=1
+	| ${HOME} 'quoted text' "$1" sed "$1" echo "$1" ${HOME} local
+	/usr/bin done sed awk && local then then 'quoted text'
+-eu then $(pwd) "$@" $(pwd) 2>/dev/null 2>/dev/null $(pwd) done 2>/dev/null
+	&& echo sed $(pwd) cd sed ${HOME} readonly then readonly
+		readonly awk local readonly then export test -eu then cd $(pwd) 'quoted text'
+	grep /usr/bin /usr/bin echo && export
+	then local cd /usr/bin awk --verbose --verbose then --verbose done "$@" cd &&
+		readonly cd /usr/bin cd cd test && "$1" local "$1" $(pwd) grep "$@" grep
+	sed "$1" ${HOME} $(pwd) echo printf export x=1 export printf --verbose $(pwd) ${HOME}
+	awk $(pwd) printf echo printf export --verbose /usr/bin
+'quoted text' printf 'quoted text' -eu -eu $(pwd) "$@" local printf
+		'quoted text' grep x=1 awk x=1 -eu x=1 then
+	cd -eu $(pwd) grep --verbose export sed --verbose
+	/usr/bin 'quoted text' "$1" printf local cd
+		test "$@" test x=1 done x=1 ${HOME} test sed ${HOME} "$1" local
+cd grep local awk $(pwd) export x=1 cd grep grep
+"$1" x=1 "$1" $(pwd) x=1 readonly done 'quoted text'
+	readonly /usr/bin "$1" grep
+		$(pwd) "$@" readonly 'quoted text' awk -eu local 'quoted text' /usr/bin
+export 2>/dev/null "$@" /usr/bin
+-eu && ${HOME} echo /usr/bin grep ${HOME} local "$1"
+	2>/dev/null ${HOME} then readonly readonly $(pwd) "$1" 'quoted text' sed 2>/dev/null
+		done readonly $(pwd) /usr/bin -eu done awk | echo
+	then test printf cd ${HOME} /usr/bin printf "$@" ${HOME}
+readonly && && sed 2>/dev/null |
+		| --verbose | readonly $(pwd) x=1 $(pwd)
+done --verbose "$@" local "$1" --verbose grep -eu local
+readonly grep "$1" printf export echo then --verbose | then test --verbose
+echo awk done printf | printf done readonly ${HOME} | printf
+	${HOME} export export printf
+	$(pwd) readonly "$@" /usr/bin x=1 --verbose 'quoted text'
+	sed grep echo /usr/bin test 2>/dev/null awk ${HOME}
+	x=1 printf export export test done echo /usr/bin "$1" -eu local printf
+'quoted text' 2>/dev/null
+		| export -eu ${HOME} && /usr/bin | -eu --verbose echo -eu printf printf
+	--verbose /usr/bin && cd "$1" && printf && done done /usr/bin readonly --verbose
+	"$@" readonly sed ${HOME} cd -eu "$1"
+		then export done ${HOME}
+	local then | -eu printf export printf export readonly && "$@" sed
+		grep echo "$@" printf printf done grep awk awk sed
+		"$@" $(pwd) then then awk 'quoted text' 'quoted text' --verbose
+		&& && && awk 'quoted text' 2>/dev/null x=1 | awk $(pwd) -eu printf export
+	echo grep export echo --verbose
+		--verbose then 'quoted text' awk cd "$1" ${HOME} local then | then ${HOME}
+awk cd cd $(pwd) -eu local test --verbose local
+	export sed "$@" printf --verbose
+		&& export 2>/dev/null x=1 && then /usr/bin
+printf /usr/bin then sed local export export ${HOME}
+	test 'quoted text' cd sed test cd local "$@"
+	'quoted text' 'quoted text' 'quoted text'
+		sed grep readonly printf echo test --verbose local 'quoted text'
+		done $(pwd) awk local test --verbose grep then then
+local 2>/dev/null 2>/dev/null | $(pwd) awk test local 2>/dev/null -eu
+	cd export /usr/bin readonly
+echo --verbose done done local "$@" "$@" 2>/dev/null
+export "$1" grep | "$@"
+		printf 2>/dev/null awk then x=1 ${HOME}
+		cd -eu readonly 2>/dev/null export --verbose cd --verbose echo
+		cd echo $(pwd) then 'quoted text'
+		--verbose export --verbose --verbose sed readonly && done
+	readonly export "$@" $(pwd) export cd --verbose ${HOME} ${HOME} test
+cd local local echo && x=1 echo 'quoted text' echo echo 2>/dev/null
+		&& && cd echo export | readonly -eu readonly && sed /usr/bin
+	--verbose "$@" --verbose $(pwd) then --verbose done then "$1" then
+		grep export export "$@" readonly --verbose done cd then cd "$@" sed done "$@" |
+	done $(pwd) ${HOME} "$1" test && then 2>/dev/null "$@" "$1" ${HOME} /usr/bin
+local 'quoted text' awk && test
+		2>/dev/null local test -eu x=1 "$@" grep then local "$@"
+printf "$@" /usr/bin test then --verbose done sed awk test /usr/bin readonly
+		cd && /usr/bin 'quoted text'
+	echo then then awk then grep &&
+	then cd export awk 2>/dev/null
+	grep $(pwd) cd "$@" /usr/bin | | grep test readonly sed grep printf --verbose
+		x=1 -eu cd 2>/dev/null && | grep cd ${HOME} 2>/dev/null readonly awk local export
+		${HOME} /usr/bin echo --verbose 'quoted text' then 2>/dev/null
+	echo done 'quoted text' /usr/bin ${HOME} awk awk local test local
+		/usr/bin -eu readonly local x=1 done printf
+		local && $(pwd) grep then "$1" local 'quoted text' grep printf
+	echo "$1" awk "$@" 2>/dev/null x=1 sed readonly sed --verbose -eu $(pwd) $(pwd)
+2>/dev/null echo echo "$@" "$@" test
+'quoted text' sed awk echo
+grep grep local | "$1" sed "$1" printf local
+		local | export "$1" export --verbose -eu /usr/bin ${HOME} readonly ${HOME}
+		"$@" test 'quoted text'
+		grep echo ${HOME} echo sed && --verbose
+'quoted text' cd /usr/bin export cd sed "$1" cd | "$1" /usr/bin then then "$1"
+		test "$@" "$@" /usr/bin /usr/bin -eu cd grep 2>/dev/null
+x=1 --verbose cd "$1" ${HOME} ${HOME} printf test readonly
+		&& readonly /usr/bin ${HOME} 2>/dev/null awk 'quoted text' $(pwd)
+-eu then done --verbose 2>/dev/null grep
+| export then grep ${HOME} readonly awk 2>/dev/null echo && --verbose "$1" --verbose
+/usr/bin 'quoted text' grep export "$@"
+$(pwd) readonly x=1 --verbose
+local /usr/bin --verbose x=1
+		$(pwd) printf local x=1 "$@" cd /usr/bin
+		cd readonly x=1 echo | ${HOME} grep printf
+grep && x=1 test --verbose 'quoted text'
+2>/dev/null ${HOME} | "$1" 2>/dev/null
+		cd done 'quoted text' -eu test --verbose awk
+'quoted text' printf grep sed $(pwd) test $(pwd) then test done "$@" |
+then then grep /usr/bin /usr/bin -eu -eu --verbose 'quoted text' "$@" $(pwd) -eu
+then then awk sed | 'quoted text' grep "$@" ${HOME} 2>/dev/null
+local echo $(pwd) $(pwd) ${HOME} awk $(pwd) | |
+readonly | sed cd "$1" awk grep
+		/usr/bin -eu done "$@" cd x=1
+grep "$1" sed export "$@" && readonly /usr/bin cd x=1 cd grep "$1"
+	| && "$@" test local 'quoted text' | sed && readonly $(pwd) local 2>/dev/null
+	-eu $(pwd) local -eu done export "$@" /usr/bin sed | echo ${HOME} then
+readonly done then done echo echo /usr/bin cd 'quoted text'
+		&& cd export 'quoted text' 'quoted text' | | ${HOME} |
+export $(pwd) x=1 printf "$1" && readonly | x=1 | && "$@" done &&
+		local readonly export x=1 export cd grep 'quoted text' x=1 test
+	printf "$@" test "$1" 2>/dev/null test local then -eu 2>/dev/null export
+	${HOME} done --verbose then readonly sed && echo $(pwd) test -eu grep printf test
+		| 2>/dev/null echo 'quoted text'
+${HOME} /usr/bin export grep grep | 2>/dev/null -eu 2>/dev/null
+x=1 "$@" then $(pwd) /usr/bin local
+awk /usr/bin -eu 2>/dev/null
+export awk x=1 x=1 $(pwd) test -eu x=1 && export -eu grep test sed
+	$(pwd) test -eu /usr/bin then echo printf && local $(pwd)
+	test echo x=1 2>/dev/null grep 'quoted text' awk echo && /usr/bin x=1 echo cd awk
+		test "$@" awk awk x=1 "$@" -eu done x=1 $(pwd) -eu test printf then test -eu then
+		awk x=1 $(pwd) "$@" printf 2>/dev/null | 2>/dev/null awk local ${HOME} then
+		printf cd export export cd awk ${HOME}
+		2>/dev/null && --verbose --verbose 'quoted text'
+	--verbose | 2>/dev/null sed | $(pwd) grep then printf test $(pwd) test "$1" x=1
+	"$1" readonly 2>/dev/null test x=1 awk printf printf
+		done readonly "$@" export | | then local "$1"
+${HOME} sed echo then "$1" /usr/bin
+	$(pwd) cd awk "$1" x=1 2>/dev/null sed "$@"
+		local -eu -eu | | x=1 cd
+	&& echo readonly --verbose "$@" then cd "$@" export
+	'quoted text' "$1" cd test &&
+/usr/bin $(pwd) -eu 2>/dev/null sed local readonly export ${HOME} export x=1
+-eu done | -eu $(pwd) 2>/dev/null
+-eu grep printf awk /usr/bin printf "$@" "$1" $(pwd) export /usr/bin readonly awk
+awk $(pwd) "$1" "$@" awk /usr/bin x=1 2>/dev/null export --verbose -eu /usr/bin
+	&& | 2>/dev/null echo done "$1" --verbose $(pwd)
+	done then && -eu grep echo 2>/dev/null export 2>/dev/null grep awk x=1
+/usr/bin "$@" 2>/dev/null then -eu --verbose echo local
+		$(pwd) test done -eu 2>/dev/null readonly sed "$1"
+		"$@" 2>/dev/null "$@" done grep && done sed /usr/bin ${HOME} /usr/bin readonly
+/usr/bin then 'quoted text' | cd ${HOME} -eu echo
+"$1" printf /usr/bin then then
+		sed readonly /usr/bin test $(pwd) test -eu $(pwd) grep done printf
+		echo readonly && --verbose -eu test $(pwd) echo && grep
+	&& test cd awk grep then done && test x=1 printf local -eu test
+${HOME} 'quoted text' x=1 cd 2>/dev/null
+echo x=1 'quoted text' $(pwd) | local done export awk done
+| grep local $(pwd) then readonly awk && readonly grep && test export
+'quoted text' 2>/dev/null
+		${HOME} /usr/bin then readonly "$1" export export "$1" done ${HOME} -eu test "$@"
+then local awk --verbose readonly --verbose
+		cd && local local export done done done local | /usr/bin | "$1" 'quoted text'
+		x=1 x=1 $(pwd) 'quoted text' sed "$@" local 2>/dev/null echo sed awk export 'quoted text'
+${HOME} test --verbose --verbose "$@" local
+	${HOME} 'quoted text' --verbose export test local $(pwd)
+${HOME} | "$1" --verbose 2>/dev/null awk echo 'quoted text' | 'quoted text'
+	&& && done $(pwd) && x=1 export ${HOME} --verbose 'quoted text' readonly done
+${HOME} export "$1" test
+		printf x=1 --verbose /usr/bin done "$1" done readonly x=1 $(pwd) done
+printf && cd grep /usr/bin local "$@" readonly export done test && ${HOME}
+'quoted text' 2>/dev/null awk cd readonly 'quoted text' ${HOME}
+	$(pwd) local /usr/bin -eu 'quoted text'
+x=1 test 2>/dev/null x=1 done $(pwd) local "$1" test cd /usr/bin then
+	--verbose readonly /usr/bin --verbose --verbose awk 2>/dev/null ${HOME}
+		2>/dev/null test test cd ${HOME} test readonly test readonly 'quoted text'
+		done $(pwd) echo local readonly then
+	cd test local readonly readonly grep /usr/bin /usr/bin ${HOME}
+		'quoted text' export readonly export
+done 'quoted text' readonly export "$1" readonly $(pwd) grep "$@" export 'quoted text'
+		export x=1 /usr/bin test done
+cd $(pwd) grep && && "$@" && x=1 ${HOME}
+	'quoted text' test && cd /usr/bin echo test | "$@" -eu && cd 'quoted text'
+test local grep awk sed readonly 2>/dev/null
+/usr/bin done 'quoted text' readonly -eu | readonly $(pwd) --verbose
+		test ${HOME} local awk test printf
+	grep x=1 cd done printf
+	x=1 export test then awk export "$@" && export 'quoted text' grep 'quoted text'
+	awk "$1" "$@" grep $(pwd) test
+		$(pwd) then awk | then -eu then readonly then "$1" awk sed printf test x=1 then
+	local /usr/bin cd cd -eu --verbose
+		"$1" 2>/dev/null 2>/dev/null cd printf && readonly done --verbose | && then "$1"
+		test ${HOME} x=1 local x=1
+	$(pwd) "$@" grep printf /usr/bin
+	'quoted text' sed -eu done "$@" test readonly /usr/bin 2>/dev/null
+"$1" 'quoted text' | done "$1" -eu x=1
+		2>/dev/null then x=1 ${HOME} sed readonly readonly x=1 done done
+	/usr/bin export | awk /usr/bin local ${HOME}
+| --verbose x=1 echo && done "$1" done
+		printf /usr/bin sed local cd local done cd --verbose test done 'quoted text'
+	printf "$1" /usr/bin done ${HOME} cd local sed cd printf $(pwd)
+echo test "$@" 'quoted text' "$1" $(pwd) export | 2>/dev/null echo ${HOME} "$@"
+readonly echo "$@" local -eu export | /usr/bin "$1"
+	${HOME} awk ${HOME} &&
+	done $(pwd) /usr/bin /usr/bin 2>/dev/null $(pwd) export
+		export /usr/bin 'quoted text' "$1" --verbose x=1 local
+	-eu cd readonly 'quoted text' $(pwd) done -eu 'quoted text' x=1 --verbose
+		test x=1 | "$@" "$@" /usr/bin readonly sed test cd "$1" then export
+"$@" -eu awk export --verbose cd --verbose awk awk echo 'quoted text'
+		-eu local export | test --verbose "$1" && -eu printf grep -eu /usr/bin cd cd echo
+export grep printf export done grep export "$1"
+readonly then sed /usr/bin then "$1" "$1" sed
+		x=1 "$1" cd "$@" "$1" 2>/dev/null
+	echo "$1" printf cd then
+		| printf local echo | && awk | 'quoted text' then readonly awk | sed "$1"
+		&& readonly -eu 'quoted text'
+		| readonly echo 'quoted text' "$@" "$@" "$1" | $(pwd) /usr/bin
+	readonly 'quoted text' then 'quoted text' 'quoted text' sed
+		$(pwd) -eu local "$@" export then export printf awk awk sed
+		awk && 2>/dev/null | local printf && /usr/bin then echo readonly "$1"
+	&& "$@" | && awk "$1" printf local done done done | readonly
+		sed readonly cd 2>/dev/null | -eu "$@" readonly cd $(pwd) | --verbose
+	local grep test -eu printf x=1 -eu readonly export test
+		printf printf 2>/dev/null -eu printf grep x=1 -eu sed export -eu 'quoted text'
+	/usr/bin sed cd | | cd test
+'quoted text' x=1 grep && printf x=1 export cd
+		-eu done && readonly then echo local local
+/usr/bin "$1" cd && ${HOME} awk "$@" cd cd && echo "$1" $(pwd) 2>/dev/null export
+	export cd | | echo ${HOME} x=1 then export done | "$@" cd printf export ${HOME}
+		-eu -eu -eu printf then grep awk sed && 2>/dev/null --verbose "$1" x=1 /usr/bin
+		printf test local | --verbose 2>/dev/null 'quoted text' | --verbose $(pwd) awk echo
+test ${HOME} 'quoted text' $(pwd) && "$@"
+		$(pwd) | cd sed /usr/bin
+		awk && awk cd "$1" x=1 /usr/bin local echo readonly | readonly awk 'quoted text'
+	/usr/bin $(pwd) -eu sed x=1 && 'quoted text' /usr/bin
+		-eu done printf x=1 test /usr/bin -eu local --verbose
+		awk && printf readonly then done local sed "$@" grep cd readonly then then
+	${HOME} 2>/dev/null $(pwd) 'quoted text' && grep --verbose 2>/dev/null
+	-eu x=1 ${HOME} "$@" "$@" export grep
+	done printf local | awk readonly 2>/dev/null grep
+${HOME} export "$@" 2>/dev/null printf cd 'quoted text'
+grep printf printf ${HOME} printf /usr/bin then /usr/bin grep
+		--verbose $(pwd) | $(pwd) | 'quoted text' 2>/dev/null printf x=1 "$1" then
+$(pwd) -eu $(pwd) $(pwd) --verbose
+		x=1 | local --verbose x=1 ${HOME} local export | --verbose cd local printf
+		printf printf export --verbose awk && cd $(pwd) done cd "$1" 'quoted text'
+"$@" done grep test export
+$(pwd) 'quoted text' $(pwd) cd $(pwd) printf x=1 then awk --verbose "$@" awk test
+-eu readonly ${HOME} then "$1" "$@"
+	"$1" 'quoted text' export $(pwd) 'quoted text' cd
+	"$@" "$@" awk cd && local 'quoted text' ${HOME} 2>/dev/null done
+		sed test grep done ${HOME} test ${HOME} $(pwd)
+	echo ${HOME} then "$1"
+2>/dev/null "$1" 2>/dev/null test ${HOME} | | && cd done done
+		${HOME} "$@" -eu then done grep local then awk 2>/dev/null /usr/bin
+x=1 -eu awk 2>/dev/null printf ${HOME}
+&& | -eu readonly --verbose 'quoted text'
+cd sed "$@" awk | cd done
+'quoted text' $(pwd) local /usr/bin ${HOME} then grep "$1" /usr/bin 'quoted text'
+		sed readonly export cd
+	sed && then echo "$@" /usr/bin
+	local test 2>/dev/null test readonly 'quoted text'
+	sed 'quoted text' x=1 done "$1" | export echo printf /usr/bin /usr/bin
+then "$@" 'quoted text' sed then "$1" sed
+		printf /usr/bin && grep 2>/dev/null 2>/dev/null -eu sed
+		local test readonly test $(pwd) echo /usr/bin
+		| awk export export "$1" echo "$1" grep local local readonly then
+		printf then test $(pwd) /usr/bin readonly -eu
+		local local $(pwd) "$@" ${HOME} done -eu then then /usr/bin ${HOME} "$@" && 'quoted text'
+		done -eu printf echo /usr/bin echo done grep echo "$1" "$@" readonly /usr/bin
+	'quoted text' cd x=1 sed sed awk && /usr/bin sed test grep $(pwd)
+2>/dev/null 2>/dev/null local "$@" | "$@" export 'quoted text' 2>/dev/null export
+-eu done 'quoted text' | /usr/bin
+'quoted text' | $(pwd) done done done then
+awk cd | && readonly readonly
+then sed x=1 | --verbose && "$@" -eu && echo cd
+	grep | awk local export 2>/dev/null x=1 x=1 $(pwd) export readonly
+	x=1 -eu sed $(pwd) grep $(pwd)
+		echo 'quoted text' grep done
+-eu done ${HOME} local && && done
+		'quoted text' local $(pwd) 2>/dev/null
+		${HOME} cd test echo x=1 -eu grep then $(pwd) "$@" sed
+export $(pwd) -eu | echo readonly
+awk printf cd export then
+		2>/dev/null 2>/dev/null done printf done export grep cd $(pwd)
+	--verbose $(pwd) -eu test /usr/bin
+"$@" /usr/bin printf cd grep x=1 sed "$@" then local sed local x=1 ${HOME}
+		x=1 printf cd /usr/bin
+/usr/bin /usr/bin local "$@" grep awk "$@" echo x=1
+		${HOME} printf ${HOME} "$1" cd local readonly cd && echo
+printf 'quoted text' export 'quoted text' printf echo
+2>/dev/null "$@" /usr/bin "$@" $(pwd) "$1" x=1 x=1 readonly done readonly
+export 2>/dev/null then test /usr/bin x=1 local
+	local echo printf echo 'quoted text' | /usr/bin x=1 ${HOME}
+&& | | cd $(pwd) /usr/bin test
+&& grep readonly 2>/dev/null /usr/bin $(pwd) local sed awk 'quoted text' printf
+		x=1 cd echo x=1 then "$1" /usr/bin sed /usr/bin test x=1
+	local --verbose readonly awk 'quoted text' |
+export awk done | printf 2>/dev/null && printf echo grep sed -eu "$1"
+readonly cd --verbose grep sed cd
+		cd printf ${HOME} 2>/dev/null -eu done
+	awk $(pwd) sed ${HOME} | done cd $(pwd) 'quoted text' "$@" "$1" test 2>/dev/null
+-eu then x=1 grep done x=1 x=1 awk done "$@" 'quoted text'
+	$(pwd) awk cd 'quoted text'
+		2>/dev/null 2>/dev/null echo grep done --verbose cd ${HOME}
+'quoted text' export local /usr/bin "$@"
+local $(pwd) | sed 2>/dev/null done ${HOME} done
+	--verbose 'quoted text' ${HOME} done local export
+		--verbose /usr/bin echo test ${HOME} ${HOME} --verbose "$1" -eu --verbose && 2>/dev/null
+	local --verbose ${HOME} local /usr/bin cd local sed x=1 grep done
+local sed x=1 -eu 2>/dev/null | /usr/bin printf $(pwd) 2>/dev/null export
+		local 2>/dev/null "$1" 2>/dev/null
+cd 'quoted text' then 'quoted text' echo
+		"$1" $(pwd) test readonly | then 'quoted text' x=1 then 'quoted text'
+grep "$1" ${HOME} && -eu readonly done x=1 'quoted text'
+then | "$@" $(pwd) sed cd
+		printf done test | ${HOME} readonly 2>/dev/null test 2>/dev/null
+	cd awk --verbose && /usr/bin
+		awk done sed /usr/bin export printf
+	echo then 2>/dev/null && local sed echo export
+	"$1" "$1" test && done test cd test readonly "$1" cd | "$@" printf
+		echo "$@" "$1" /usr/bin awk sed cd awk grep -eu 'quoted text' export
+'quoted text' --verbose &&
+awk local x=1 $(pwd) then 'quoted text' 'quoted text' "$@"
+		2>/dev/null x=1 done grep then cd sed "$1"
+		echo sed 2>/dev/null x=1 test /usr/bin
+test x=1 x=1 awk $(pwd) --verbose /usr/bin then sed 2>/dev/null 'quoted text'
+		done 'quoted text' cd sed grep | "$1" -eu then | test 'quoted text' $(pwd)
+cd --verbose 'quoted text' $(pwd) $(pwd) x=1 readonly then "$@"
+		cd printf | | -eu cd x=1 local done done echo /usr/bin -eu -eu then grep "$@"
+cd --verbose echo awk test ${HOME} echo /usr/bin "$@" grep "$@" printf
+export then && /usr/bin then printf awk -eu then /usr/bin test
+		test -eu echo --verbose ${HOME}
+		"$@" local done grep export
+	2>/dev/null grep echo echo awk awk printf sed printf local then ${HOME} readonly
+		--verbose export ${HOME} grep readonly 2>/dev/null $(pwd)
+--verbose grep readonly then awk /usr/bin then "$@" done "$@" echo x=1 printf 'quoted text'
+then echo --verbose -eu
+/usr/bin grep awk local export $(pwd) ${HOME} 2>/dev/null
+then sed 'quoted text' readonly 2>/dev/null then "$1" ${HOME}
+printf 'quoted text' grep sed && -eu cd printf local printf "$@" cd printf
+--verbose -eu -eu awk -eu printf test
+	2>/dev/null "$@" sed test -eu then grep ${HOME}
+		test $(pwd) 'quoted text' ${HOME} printf awk | "$1" then test $(pwd) readonly
+| "$1" | 'quoted text' cd printf --verbose awk 2>/dev/null x=1 /usr/bin grep
+		2>/dev/null local done 2>/dev/null "$1" printf test readonly 'quoted text'
+	&& ${HOME} echo sed -eu 2>/dev/null awk printf export 2>/dev/null "$1" export
+then printf "$1" grep printf sed echo export "$@" sed $(pwd) /usr/bin local done
+		'quoted text' ${HOME} 'quoted text' printf "$@" 'quoted text'
+		2>/dev/null $(pwd) $(pwd) x=1 "$1" printf export | 'quoted text' export grep
+	/usr/bin export "$@" 2>/dev/null printf
+		sed done --verbose "$@" -eu export 2>/dev/null
+"$1" export echo && awk export $(pwd) "$1" $(pwd) $(pwd) 'quoted text' | then
+		'quoted text' cd sed sed awk sed then --verbose grep $(pwd) $(pwd) cd
+		export "$1" export "$1" cd --verbose
+		"$@" printf -eu | ${HOME}
+--verbose test 2>/dev/null awk x=1 2>/dev/null awk
+		export 2>/dev/null 2>/dev/null ${HOME} "$1" export awk
+		"$@" readonly readonly | | ${HOME} sed local -eu "$1" cd 'quoted text' awk
+		-eu done echo | readonly ${HOME} export readonly
+		awk echo $(pwd) grep -eu readonly --verbose
+x=1 then "$@" ${HOME} $(pwd) sed -eu x=1 | sed export local export
+x=1 test printf 2>/dev/null $(pwd) && echo cd /usr/bin done awk | 2>/dev/null
+	local grep ${HOME} then 2>/dev/null echo printf --verbose x=1 ${HOME} --verbose
+	${HOME} x=1 && local /usr/bin local echo "$1" awk awk x=1 2>/dev/null
+	grep test --verbose readonly
+		-eu 'quoted text' export grep then && 'quoted text'
+		--verbose sed then && cd local echo sed done
+"$@" cd -eu grep printf readonly readonly local | cd
+		/usr/bin "$@" x=1 sed x=1
+		export done awk export test local printf | done awk |
+		done x=1 local | --verbose $(pwd) /usr/bin --verbose echo printf
+	local export x=1 "$1" x=1 "$@" && x=1 cd x=1 ${HOME} done test printf
+"$1" "$1" printf echo 'quoted text' 'quoted text' && 2>/dev/null then
+		echo printf 2>/dev/null echo && ${HOME} | then sed grep sed local | export
+	done 'quoted text' echo "$1" "$1" sed
+		local 2>/dev/null sed cd ${HOME} "$1" && then grep then awk $(pwd)
+		2>/dev/null awk --verbose $(pwd) echo "$@" 2>/dev/null awk /usr/bin 'quoted text'
+		${HOME} export printf "$1" ${HOME} local
+	/usr/bin cd done "$@" "$1" done
+	'quoted text' cd "$@"
+		test local awk printf 2>/dev/null awk then && then export x=1 "$1" 2>/dev/null
+--verbose 2>/dev/null "$1" && export /usr/bin | "$1" then readonly local
+		export 2>/dev/null /usr/bin
+		| readonly done echo sed 2>/dev/null
+	"$@" local $(pwd) | cd grep 2>/dev/null | x=1 /usr/bin -eu grep
+		cd -eu $(pwd) "$@" export done
+		--verbose then test ${HOME} sed
+2>/dev/null printf sed $(pwd) cd test 'quoted text'
+		done cd | grep grep 'quoted text'
+$(pwd) local 'quoted text' ${HOME} export "$1" 'quoted text' x=1 awk
+${HOME} local sed "$1" local
+		${HOME} 'quoted text' "$1" test ${HOME} $(pwd) echo awk done && ${HOME}
+	&& grep 2>/dev/null grep
+	local 'quoted text' grep -eu -eu
+test -eu test grep --verbose "$@" /usr/bin "$1" | local
+	readonly 2>/dev/null then export local && then 2>/dev/null "$@" && $(pwd)
+	x=1 | "$1" /usr/bin "$@" 2>/dev/null 'quoted text'
+	"$1" grep export "$1" echo sed sed | printf grep "$@" then -eu readonly
+		done grep 'quoted text' --verbose /usr/bin 2>/dev/null $(pwd)
+		then --verbose printf sed export x=1 | cd | export 2>/dev/null 'quoted text'
+	'quoted text' then done -eu test --verbose local then $(pwd) cd echo
+	export $(pwd) "$1" cd $(pwd) readonly ${HOME}
+		local --verbose 2>/dev/null ${HOME} echo 2>/dev/null readonly
+readonly $(pwd) then echo | then local
+	"$@" /usr/bin echo echo awk done "$1" --verbose | export && /usr/bin
+		| done -eu --verbose -eu
+	grep /usr/bin ${HOME} && "$@" 'quoted text' awk $(pwd) $(pwd) $(pwd) awk readonly
+		2>/dev/null | ${HOME} x=1 2>/dev/null
+export sed test awk $(pwd) local test test printf && test --verbose "$1" "$1"
+	--verbose | cd then awk
+	printf test cd local grep | then ${HOME} sed 2>/dev/null
+	awk /usr/bin "$@" $(pwd) export
+		"$@" 'quoted text' done /usr/bin export test x=1 x=1 done && then && && sed then
+		${HOME} readonly printf "$@" ${HOME}
+test --verbose | test done | awk 2>/dev/null 2>/dev/null "$1" grep cd "$1" "$1"
+"$1" ${HOME} sed --verbose echo readonly then "$@" "$1"
+		2>/dev/null test echo
+		then /usr/bin 2>/dev/null cd printf 'quoted text' export "$1" readonly x=1 --verbose
+		local && grep echo 2>/dev/null local local grep awk readonly "$1"
+readonly "$@" local cd /usr/bin
+2>/dev/null awk && "$@" local 2>/dev/null 'quoted text' &&
+		"$@" printf && "$1" export /usr/bin cd printf -eu local
+	/usr/bin --verbose grep
+		done /usr/bin printf cd export 'quoted text' awk "$@"
+		/usr/bin 2>/dev/null "$@" "$1"
+/usr/bin sed readonly -eu x=1 $(pwd) export && awk sed echo cd printf |
+'quoted text' --verbose "$1" cd local grep ${HOME} $(pwd) sed 'quoted text'
+		&& && 2>/dev/null "$@" x=1 $(pwd) local 'quoted text' $(pwd) then
+grep "$1" $(pwd) test sed echo --verbose printf $(pwd) printf then "$@" readonly
+	awk "$1" done "$1" --verbose /usr/bin test
+grep 2>/dev/null "$@" grep
+		awk local --verbose done export local -eu /usr/bin
+	done --verbose x=1 local readonly then 2>/dev/null
+	local grep printf printf /usr/bin local --verbose -eu | readonly printf
+		"$1" | test x=1 grep 2>/dev/null readonly export "$1" printf then grep grep
+	sed ${HOME} "$1" && cd 2>/dev/null -eu | local local
+-eu then then "$1" done export
+		'quoted text' export "$1" grep --verbose 2>/dev/null
+grep sed done readonly 'quoted text' then 'quoted text' test done 'quoted text'
+		done "$1" 'quoted text' grep
+	--verbose 'quoted text' -eu -eu grep 'quoted text' x=1 && "$@"
+"$1" echo 2>/dev/null readonly "$@" x=1 export awk done cd -eu --verbose
+		export x=1 readonly --verbose $(pwd) /usr/bin sed "$1" "$@" && x=1 -eu
+	sed "$1" -eu x=1 test awk 2>/dev/null readonly "$@" -eu done
+		done test 'quoted text' ${HOME} /usr/bin cd echo x=1 --verbose &&
+cd --verbose test cd grep export
+		export "$@" 2>/dev/null ${HOME} && -eu
+-eu 2>/dev/null -eu $(pwd) x=1
+	done $(pwd) --verbose /usr/bin awk export
+done then printf ${HOME} cd x=1 printf && -eu
+		local "$1" 'quoted text' sed -eu local printf done | grep ${HOME} grep
+	printf test printf grep x=1 && grep $(pwd) printf ${HOME} ${HOME}
+	local cd sed local /usr/bin sed test | printf 2>/dev/null $(pwd) readonly
+	test done then sed awk --verbose
+		awk cd printf printf 2>/dev/null sed readonly then sed /usr/bin
+		2>/dev/null "$1" 'quoted text' awk awk ${HOME} local |
+	echo x=1 printf | $(pwd) echo ${HOME} "$1" && done x=1 /usr/bin test &&
+	&& awk done --verbose 2>/dev/null
+		"$@" echo then cd $(pwd) /usr/bin done "$@"
+		x=1 | "$@" $(pwd) ${HOME} "$1" printf local $(pwd) echo "$@"
+		2>/dev/null awk cd /usr/bin echo && awk
+/usr/bin done printf --verbose cd -eu done && && 2>/dev/null readonly awk awk ${HOME}
+		cd cd then sed x=1 grep export export | 2>/dev/null "$1"
+then then --verbose local x=1 ${HOME} export sed --verbose && "$1" && cd export
+printf printf grep 2>/dev/null -eu "$1" test | then
+		"$@" "$1" cd && -eu echo && local grep | $(pwd)
+	printf printf awk x=1 'quoted text' cd "$1" "$1"
+		/usr/bin awk echo -eu ${HOME} "$@" && printf && --verbose
+		-eu done readonly awk awk then "$@" grep printf
+		grep printf --verbose export 2>/dev/null -eu x=1 test export
+		export test sed 'quoted text' -eu test 2>/dev/null
+		--verbose sed x=1 --verbose | && ${HOME} "$1" 'quoted text' ${HOME} test sed 'quoted text'
+		${HOME} then ${HOME} /usr/bin "$@" | printf local local ${HOME} -eu /usr/bin
+-eu then done && $(pwd)
+		x=1 -eu cd then --verbose "$@" /usr/bin grep export
+$(pwd) grep /usr/bin "$@" export echo && $(pwd) test x=1 local --verbose
+		cd 2>/dev/null cd local echo $(pwd) /usr/bin --verbose
+local x=1 test done --verbose "$1" x=1 'quoted text' "$@"
+		| printf printf ${HOME} cd --verbose
+"$@" sed && $(pwd) done 2>/dev/null 2>/dev/null
+		x=1 awk done $(pwd) cd sed done cd printf
+	'quoted text' awk "$1" awk --verbose then readonly
+${HOME} /usr/bin 2>/dev/null cd --verbose 'quoted text' -eu
+	export export cd grep /usr/bin test x=1 "$1" local 'quoted text' awk x=1 local
+"$1" sed "$@" export /usr/bin | && | then
+	$(pwd) awk printf /usr/bin export $(pwd) test export
+local done "$@" /usr/bin printf
+&& then ${HOME} 2>/dev/null $(pwd)
+	| cd /usr/bin grep | awk grep --verbose printf $(pwd) sed
+then 'quoted text' cd grep readonly grep "$@"
+sed awk "$1" then "$@" --verbose ${HOME} local "$1" export $(pwd)
+	${HOME} $(pwd) then readonly | sed --verbose then $(pwd) done 2>/dev/null
+	| -eu && awk echo $(pwd) grep --verbose local x=1 2>/dev/null export && ${HOME}
+	${HOME} done $(pwd) readonly 2>/dev/null
+	grep "$@" x=1 echo "$1" sed ${HOME} ${HOME} done 2>/dev/null
+	'quoted text' ${HOME} sed awk "$1" readonly
+		$(pwd) printf -eu $(pwd) echo 2>/dev/null echo "$1" done grep ${HOME}
+		${HOME} readonly echo cd sed then grep
+		$(pwd) local sed local then "$1" grep grep /usr/bin local awk export export
+${HOME} export | 2>/dev/null readonly local -eu ${HOME}
+x=1 printf grep 2>/dev/null export 2>/dev/null
+		| cd test cd /usr/bin "$@" cd ${HOME}
+&& && local grep /usr/bin | x=1
+--verbose printf /usr/bin local
+	$(pwd) done cd $(pwd) awk --verbose /usr/bin readonly done local "$@" | | cd
+		local export | "$1" 'quoted text' cd printf grep "$@" | local echo sed
+		$(pwd) $(pwd) test 2>/dev/null done "$@" /usr/bin x=1 readonly
+		then | export ${HOME} local export --verbose grep echo sed
+	-eu grep $(pwd) readonly x=1 "$@" -eu awk cd echo cd $(pwd) /usr/bin echo |
+-eu ${HOME} local grep && then readonly printf 'quoted text'
+echo grep readonly --verbose | echo awk --verbose ${HOME}
+		"$1" grep 2>/dev/null 'quoted text'
+		then | 'quoted text' $(pwd) echo sed local "$@" $(pwd) "$1" readonly
+	"$@" export /usr/bin /usr/bin --verbose 'quoted text'
+&& ${HOME} cd readonly test export then echo
+		then && "$1" -eu echo
+x=1 --verbose readonly 'quoted text'
+		2>/dev/null 'quoted text'
+	'quoted text' grep awk printf echo ${HOME}
+cd 'quoted text' readonly awk "$1" $(pwd) done
+		then awk test sed -eu 2>/dev/null
+'quoted text' local | test grep echo sed sed ${HOME} --verbose
+	sed grep 'quoted text' then local "$@" test -eu "$1"
+"$@" sed 'quoted text'
+		test | /usr/bin "$@" done
+		${HOME} then sed test -eu local
+"$1" then cd sed 'quoted text' cd ${HOME} sed sed /usr/bin echo done
+	grep --verbose test done 'quoted text'
+		${HOME} printf cd 2>/dev/null done
+| /usr/bin then grep printf echo 2>/dev/null | x=1
+		local awk --verbose ${HOME} cd "$@" "$@"
+		${HOME} local -eu ${HOME} -eu readonly local
+awk done ${HOME} grep echo | 2>/dev/null /usr/bin test /usr/bin $(pwd) | sed done
+	'quoted text' printf && cd
+		--verbose test "$@" printf $(pwd) cd x=1 x=1 then x=1 -eu /usr/bin 'quoted text'
+	export sed awk "$1" cd 'quoted text' 2>/dev/null "$1" x=1 then echo /usr/bin echo
+2>/dev/null awk awk export
+--verbose ${HOME} printf readonly $(pwd) echo $(pwd)
+	printf -eu then echo ${HOME} | grep "$1" 'quoted text' "$1"
+		test -eu x=1 grep grep readonly x=1 'quoted text' sed done
+	readonly export done printf
+/usr/bin $(pwd) "$@" local "$@" done done 'quoted text'
+${HOME} 'quoted text' test 'quoted text'
+readonly $(pwd) done x=1 local x=1
+		| then cd local 2>/dev/null 2>/dev/null | sed readonly done export
+	awk readonly done readonly "$@" /usr/bin printf echo && grep
+	$(pwd) done readonly export "$1"
+	then | printf -eu "$1" done local
+		cd echo ${HOME} grep 2>/dev/null then "$1"
+	| test test done --verbose $(pwd) --verbose 2>/dev/null local
+		&& sed && printf local | "$@" export 2>/dev/null printf
+		--verbose ${HOME} 2>/dev/null then printf cd /usr/bin
+	&& "$1" -eu "$@" test readonly grep "$@" && test -eu done 'quoted text' &&
+--verbose --verbose grep done echo cd echo local
+		export 2>/dev/null cd -eu printf sed
+	$(pwd) ${HOME} $(pwd) $(pwd) local "$@" grep grep local "$1" "$1"
+--verbose && grep -eu ${HOME} $(pwd) -eu $(pwd) readonly readonly $(pwd)
+"$1" cd x=1 printf export local "$1" local $(pwd)
+		/usr/bin 2>/dev/null echo 2>/dev/null 'quoted text' --verbose
+sed export readonly echo x=1 echo --verbose
+		| test -eu then "$@" done | 'quoted text'
+		cd done readonly cd sed $(pwd) ${HOME} cd sed local then export "$1"
+$(pwd) $(pwd) echo printf export --verbose "$@" then | --verbose export cd "$@"
+	local done ${HOME} && local echo /usr/bin 2>/dev/null
+		&& ${HOME} | readonly /usr/bin echo then "$@" ${HOME}
+		2>/dev/null && 2>/dev/null awk local "$@" done "$1" 'quoted text'
+	2>/dev/null printf local export grep x=1 ${HOME} done && "$@"
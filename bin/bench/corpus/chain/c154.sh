@@ -0,0 +1,2001 @@
+'quoted text' "$1" /usr/bin 2>/dev/null -eu "$@" "$1" test | printf -eu cd
+		grep readonly $(pwd)
+		&& 'quoted text' echo --verbose printf | | echo 'quoted text' test $(pwd)
+2>/dev/null "$@" 'quoted text' "$@" 'quoted text' | done ${HOME}
+sed sed awk test local ${HOME} "$@" --verbose "$@" printf
+x=1 && awk x=1 x=1 "$1" printf sed 2>/dev/null grep
+	sed readonly done test "$@" test 'quoted text' cd ${HOME} $(pwd) x=1 sed echo cd
+		echo 'quoted text' /usr/bin $(pwd) $(pwd) readonly then
+/usr/bin cd -eu x=1 /usr/bin "$@" export 2>/dev/null
+	printf then export -eu cd
+	grep done 'quoted text'
+	export cd && cd $(pwd) cd 2>/dev/null
+readonly "$@" --verbose
+x=1 && test grep --verbose "$1" cd echo then awk local
+	$(pwd) x=1 /usr/bin 2>/dev/null | 2>/dev/null
+	&& readonly done printf x=1 --verbose "$@" test export | then "$@" 2>/dev/null
+	-eu awk sed done /usr/bin 2>/dev/null
+		2>/dev/null "$1" 'quoted text' && then
+cd cd "$1" | export "$1" x=1 export 'quoted text' local "$@" local
+		2>/dev/null "$@" | | cd --verbose "$@" export $(pwd) readonly
+grep sed -eu /usr/bin done cd "$@" x=1 2>/dev/null ${HOME} sed ${HOME}
+		"$1" "$1" done "$1" "$@" grep -eu 2>/dev/null
+		echo $(pwd) --verbose test readonly
+	grep /usr/bin "$@" export x=1 printf
+"$@" "$1" cd 'quoted text' x=1 printf "$@" grep && 2>/dev/null
+	x=1 local 2>/dev/null $(pwd) "$1"
+		then $(pwd) readonly cd printf && 'quoted text' local | grep "$1" ${HOME} --verbose
+		cd x=1 grep | sed -eu sed sed cd export 'quoted text' && grep done 2>/dev/null
+	'quoted text' ${HOME} "$1" | grep
+--verbose x=1 "$1" x=1 test echo "$1" "$1" export local local grep sed &&
+test test 'quoted text' sed "$@" "$@" -eu cd --verbose readonly --verbose
+		2>/dev/null /usr/bin readonly "$@"
+awk sed ${HOME} cd test | local | then --verbose
+x=1 echo then printf 2>/dev/null export "$1" 2>/dev/null
+-eu --verbose cd | $(pwd) $(pwd) 2>/dev/null
+	readonly local --verbose "$@" "$1" test cd | local then "$@" 2>/dev/null export
+	export test 2>/dev/null &&
+| grep "$@" 2>/dev/null $(pwd) "$@" local sed | awk && local $(pwd) --verbose
+		done printf done local echo then "$@" done "$@" $(pwd) test "$@" --verbose awk
+then test then readonly local | $(pwd) --verbose
+	awk "$1" export done "$1" then 2>/dev/null echo
+done 'quoted text' readonly x=1 ${HOME} export sed 2>/dev/null
+		"$@" | local "$1" x=1 | /usr/bin done /usr/bin
+'quoted text' $(pwd) awk /usr/bin echo printf printf readonly /usr/bin
+sed && -eu done local grep cd "$1" x=1 /usr/bin x=1 && export "$@"
+	test -eu /usr/bin "$1" grep done "$@" 2>/dev/null --verbose ${HOME} sed
+2>/dev/null && grep test | readonly
+grep $(pwd) --verbose test sed "$@" then grep export echo readonly done
+		$(pwd) "$@" readonly x=1
+		echo 2>/dev/null awk "$@" cd "$1" "$1" awk -eu sed && printf echo echo grep
+	'quoted text' echo readonly 2>/dev/null
+	x=1 readonly "$1" "$1" readonly -eu local "$1" export --verbose echo then
+'quoted text' test "$@" 'quoted text' test test 2>/dev/null
+	"$@" echo --verbose export done grep /usr/bin | --verbose local readonly
+local 2>/dev/null 2>/dev/null echo done $(pwd)
+	x=1 printf test --verbose printf && export /usr/bin -eu -eu 2>/dev/null
+	-eu --verbose readonly $(pwd) awk ${HOME} echo
+		done echo echo | cd --verbose echo -eu /usr/bin
+	x=1 test export ${HOME} 'quoted text'
+$(pwd) --verbose "$@" | /usr/bin grep 2>/dev/null -eu /usr/bin && done
+		2>/dev/null export -eu readonly "$1"
+x=1 2>/dev/null sed | $(pwd) /usr/bin | done test $(pwd) echo --verbose
+		done sed ${HOME} then --verbose
+/usr/bin grep | | done && /usr/bin echo cd export export -eu echo echo --verbose
+		readonly /usr/bin echo x=1 ${HOME} /usr/bin $(pwd)
+done | -eu | 'quoted text' /usr/bin test grep --verbose $(pwd) -eu then readonly
+	echo then x=1 -eu test -eu local 'quoted text' then ${HOME} -eu grep
+| /usr/bin && test local 'quoted text' grep readonly 2>/dev/null
+cd 2>/dev/null echo awk --verbose done "$1" "$@" /usr/bin readonly
+readonly --verbose "$1" "$1" -eu 'quoted text' then 'quoted text'
+		sed echo "$@" "$1" /usr/bin printf echo done &&
+	sed 'quoted text' /usr/bin /usr/bin && echo export | echo readonly
+		sed echo --verbose grep sed /usr/bin printf 2>/dev/null awk -eu
+	${HOME} sed | export -eu && ${HOME} /usr/bin printf
+done sed printf readonly && done printf sed --verbose
+-eu cd local $(pwd) echo test | | 2>/dev/null
+printf printf echo "$1" ${HOME} -eu test "$@" grep sed 'quoted text'
+	then /usr/bin export --verbose readonly "$@" /usr/bin /usr/bin
+	-eu 'quoted text' test x=1 $(pwd) echo grep "$@"
+	export then ${HOME} printf ${HOME} sed 2>/dev/null
+	sed done printf awk --verbose test done then $(pwd)
+	| sed --verbose /usr/bin ${HOME}
+$(pwd) test grep -eu awk $(pwd)
+		2>/dev/null then test --verbose cd local printf x=1
+		readonly export done readonly /usr/bin
+cd 'quoted text' && done done sed x=1 cd test ${HOME} --verbose "$1"
+&& 'quoted text' 2>/dev/null "$@" ${HOME} 2>/dev/null grep printf then | | local
+		export | grep "$@" awk && printf
+	$(pwd) x=1 then awk x=1 test 'quoted text'
+		done cd awk awk cd cd 'quoted text' then --verbose $(pwd) "$@" ${HOME} awk grep
+		local 2>/dev/null awk /usr/bin "$@" test printf then
+		'quoted text' local export
+		--verbose test ${HOME} --verbose done -eu x=1 local && "$@" x=1
+		test | awk ${HOME} /usr/bin -eu printf x=1 printf
+	readonly | then printf --verbose grep 'quoted text' readonly
+		"$1" then cd "$@" /usr/bin --verbose cd printf done 2>/dev/null echo 2>/dev/null
+	awk awk x=1 printf -eu done readonly cd local cd | ${HOME}
+	awk "$@" awk test export test ${HOME} /usr/bin done grep local
+	$(pwd) && 2>/dev/null grep -eu ${HOME}
+	'quoted text' grep x=1
+$(pwd) && local printf awk local echo then echo local sed /usr/bin -eu 'quoted text'
+		awk readonly sed printf x=1 x=1 printf cd && grep
+	-eu then local "$1" awk x=1 local readonly
+	local cd ${HOME} echo $(pwd) x=1
+readonly grep | --verbose
+printf test $(pwd) cd "$1" -eu ${HOME} $(pwd)
+	/usr/bin -eu | 'quoted text' readonly cd | sed awk readonly
+	export ${HOME} && ${HOME} done cd x=1 awk export ${HOME}
+export awk awk | $(pwd) echo x=1 ${HOME} && grep test printf readonly
+	/usr/bin -eu readonly then 'quoted text' sed $(pwd) readonly
+	2>/dev/null local printf 'quoted text' done printf /usr/bin
+		'quoted text' && done test 2>/dev/null "$@" cd x=1 printf "$1"
+		--verbose export x=1 $(pwd) "$@" "$1" test --verbose test done && grep then awk
+	--verbose test echo x=1 "$@" 'quoted text'
+		sed readonly grep echo readonly export export
+export x=1 | sed grep printf export ${HOME} local -eu local 2>/dev/null
+'quoted text' x=1 export awk awk done then printf
+/usr/bin sed 2>/dev/null sed x=1 cd x=1 done readonly grep && export
+echo "$@" readonly ${HOME} x=1 readonly "$@" printf && 2>/dev/null "$1" awk ${HOME}
+		cd readonly test printf /usr/bin && 2>/dev/null
+	${HOME} printf cd done sed
+${HOME} "$@" -eu echo export | && ${HOME} printf 2>/dev/null awk
+		&& /usr/bin 2>/dev/null local --verbose ${HOME} --verbose x=1
+		readonly -eu done export export sed export grep sed grep printf -eu export
+	$(pwd) "$@" printf /usr/bin echo | | /usr/bin export export "$1" printf --verbose
+		2>/dev/null then awk 'quoted text' done cd | printf
+		--verbose && -eu cd export cd then
+	grep echo awk awk --verbose export --verbose local done done
+		${HOME} printf echo $(pwd) test
+	printf && cd echo cd ${HOME}
+printf 'quoted text' $(pwd) 'quoted text' && 'quoted text' /usr/bin
+	grep echo echo done grep --verbose test grep sed &&
+		'quoted text' done /usr/bin local "$@" x=1 done /usr/bin awk test
+	done then local sed -eu x=1 -eu done --verbose printf --verbose local
+		| "$1" --verbose 'quoted text' /usr/bin
+		done "$@" ${HOME} ${HOME} sed printf
+2>/dev/null | --verbose 2>/dev/null
+		cd | echo export | --verbose local "$@" 2>/dev/null done /usr/bin
+	2>/dev/null "$@" -eu then 2>/dev/null x=1
+		"$@" cd printf sed echo x=1 ${HOME} then
+'quoted text' | printf /usr/bin local grep /usr/bin
+	&& "$1" test -eu 2>/dev/null
+	cd grep local ${HOME} "$@" sed readonly test test printf printf 'quoted text' then
+		-eu "$@" export --verbose "$1" export test && 'quoted text'
+	then done && "$@" echo cd x=1 "$1" sed 2>/dev/null /usr/bin
+		&& $(pwd) ${HOME} ${HOME} "$1" done | awk local "$@" && export
+	$(pwd) "$@" $(pwd) test $(pwd) | printf then sed "$@" $(pwd)
+	/usr/bin cd x=1 "$@" $(pwd) x=1 -eu test grep
+		"$1" done "$1" $(pwd) readonly cd ${HOME} --verbose export --verbose 2>/dev/null
+cd x=1 x=1 export test printf
+		--verbose echo "$@" done echo local then cd then && x=1 done x=1 echo $(pwd)
+		${HOME} $(pwd) "$1" && /usr/bin "$1" awk ${HOME} echo
+"$1" "$1" export "$1" sed
+		awk ${HOME} grep --verbose echo $(pwd) echo cd test export sed
+		| cd printf local local export $(pwd)
+local echo printf sed test "$@" awk | | export 'quoted text'
+		sed grep && /usr/bin awk | /usr/bin test
+export | readonly | readonly && "$1" "$1" done
+'quoted text' cd -eu x=1 /usr/bin /usr/bin awk sed x=1
+	$(pwd) -eu && test local 'quoted text' | "$@"
+		readonly then 'quoted text' readonly export grep x=1 /usr/bin "$1" local 2>/dev/null
+${HOME} 2>/dev/null | test test echo 'quoted text' 2>/dev/null echo ${HOME}
+	2>/dev/null x=1 echo test cd ${HOME} -eu
+	$(pwd) "$1" grep 2>/dev/null awk ${HOME} ${HOME} local grep
+cd awk /usr/bin done sed
+	'quoted text' --verbose done echo readonly awk done then then $(pwd)
+	"$@" grep then /usr/bin --verbose $(pwd) grep /usr/bin
+/usr/bin "$1" sed "$@" then ${HOME} -eu export "$1" then
+		$(pwd) echo $(pwd) && export sed sed echo /usr/bin && 2>/dev/null 2>/dev/null
+'quoted text' echo export ${HOME} awk export
+		${HOME} --verbose local $(pwd) /usr/bin | export local export readonly 2>/dev/null
+		grep $(pwd) export --verbose --verbose echo /usr/bin then
+	sed printf printf readonly export grep | --verbose
+	'quoted text' | export && 'quoted text' x=1 sed -eu readonly grep echo
+		| echo done sed grep /usr/bin test --verbose
+printf /usr/bin grep sed && then cd grep ${HOME}
+		local printf -eu readonly readonly
+		echo && test "$@" test 2>/dev/null cd $(pwd) cd grep then export | ${HOME}
+	--verbose readonly sed -eu "$@" done -eu && echo test && &&
+		local "$@" -eu sed readonly ${HOME} sed printf readonly "$@" $(pwd)
+x=1 && -eu awk ${HOME} then awk
+		/usr/bin then cd | "$1" && sed export ${HOME} | 2>/dev/null
+	&& echo test printf local /usr/bin x=1
+		${HOME} --verbose cd local --verbose readonly local 'quoted text' x=1 --verbose
+then export sed done awk "$@" local export 'quoted text'
+	echo | x=1 printf awk $(pwd) done local echo grep $(pwd) --verbose echo 2>/dev/null
+		&& echo echo then 'quoted text' cd $(pwd) "$@" then ${HOME}
+		cd "$1" done done --verbose then 2>/dev/null
+		"$1" ${HOME} awk /usr/bin export
+	readonly $(pwd) $(pwd) x=1 test "$1" local readonly "$@" $(pwd) cd
+		&& 2>/dev/null | readonly readonly 2>/dev/null
+then ${HOME} 2>/dev/null x=1 && local /usr/bin test
+		"$1" cd 2>/dev/null export
+	awk --verbose local cd /usr/bin --verbose 'quoted text' local printf
+	printf readonly --verbose awk "$@" local -eu test cd readonly
+	--verbose | && $(pwd) "$1" && $(pwd)
+	2>/dev/null cd printf /usr/bin --verbose
+	done awk -eu readonly /usr/bin then done done printf | ${HOME}
+		"$@" grep ${HOME} -eu -eu
+${HOME} readonly printf ${HOME} 2>/dev/null export "$@" x=1 then --verbose
+	local awk -eu awk export
+		export "$1" cd | then awk awk printf sed readonly
+sed $(pwd) "$1" done 2>/dev/null readonly export 'quoted text'
+$(pwd) export awk readonly awk then | awk export sed "$@" awk --verbose echo
+	sed 2>/dev/null done cd 'quoted text' | then && awk "$@" "$1" 'quoted text'
+	awk --verbose cd $(pwd)
+	sed awk awk $(pwd) x=1 printf test
+		export "$1" printf "$1" local grep test "$1" readonly export -eu
+done ${HOME} test done then awk
+		awk awk ${HOME} awk printf readonly 'quoted text' grep local ${HOME} "$1" "$1" |
+&& 2>/dev/null then /usr/bin
+		grep 2>/dev/null "$@" 2>/dev/null
+		&& printf && $(pwd) && --verbose
+sed test --verbose x=1 /usr/bin cd printf ${HOME} $(pwd) /usr/bin grep
+done "$1" && $(pwd) grep test printf
+		/usr/bin cd 'quoted text' ${HOME} --verbose
+readonly local -eu then readonly
+		awk readonly --verbose then done sed && x=1 2>/dev/null sed done 2>/dev/null
+	| readonly local $(pwd) echo grep x=1 --verbose echo grep /usr/bin
+readonly grep $(pwd) /usr/bin
+	| /usr/bin test ${HOME} then | --verbose "$@" cd awk awk -eu
+		export 2>/dev/null grep | test 'quoted text' readonly "$1" sed
+		echo local /usr/bin $(pwd) x=1 "$@" printf sed $(pwd) export $(pwd) awk
+"$@" cd && && "$1" printf cd sed --verbose echo ${HOME} /usr/bin echo | --verbose
+sed 'quoted text' printf cd export $(pwd) $(pwd)
+		${HOME} readonly then $(pwd) "$@" grep
+	sed "$@" grep && | "$1" grep done x=1 $(pwd) awk && cd then
+readonly then x=1 x=1 awk export done
+readonly /usr/bin && test
+-eu && | 'quoted text'
+	${HOME} cd | "$1" -eu awk 'quoted text' done cd local export cd
+		&& printf /usr/bin ${HOME} awk printf done --verbose
+	grep echo local then echo
+		'quoted text' /usr/bin printf 'quoted text' ${HOME}
+x=1 'quoted text' done | sed --verbose
+"$1" "$@" | "$@" cd 2>/dev/null test ${HOME} 2>/dev/null grep -eu done "$@"
+		-eu "$@" $(pwd) readonly $(pwd) --verbose awk local && ${HOME} export ${HOME} readonly
+cd export | 'quoted text' local ${HOME} /usr/bin readonly
+--verbose /usr/bin test readonly "$@" 'quoted text' "$1"
+		"$@" printf ${HOME} "$@" grep 2>/dev/null done cd "$@" export "$@" "$1" "$1" &&
+"$1" test local /usr/bin readonly 'quoted text' -eu "$@" $(pwd) "$@"
+readonly 'quoted text' grep then 'quoted text' x=1 echo "$@" printf
+		${HOME} done -eu sed
+then then x=1 sed sed
+		awk local then --verbose
+		/usr/bin cd x=1 awk then --verbose ${HOME} "$1" 'quoted text'
+	printf sed export 'quoted text' cd $(pwd)
+		grep awk $(pwd) cd local then | "$1"
+		'quoted text' "$@" echo 'quoted text' 2>/dev/null 2>/dev/null -eu
+		cd awk readonly readonly awk local sed done --verbose local --verbose "$@"
+	echo then done | x=1 x=1 then
+	done readonly export export 2>/dev/null export
+export "$@" awk ${HOME} /usr/bin "$1" | -eu 'quoted text' x=1
+cd printf cd $(pwd) ${HOME} done 2>/dev/null
+	'quoted text' grep readonly printf -eu sed
+	/usr/bin /usr/bin /usr/bin sed grep local awk readonly -eu printf then awk &&
+	sed x=1 "$@" && x=1 test 'quoted text' "$1"
+'quoted text' done awk /usr/bin
+&& | cd 'quoted text' -eu ${HOME} local export grep
+done --verbose x=1 cd --verbose export done readonly cd readonly awk export
+		x=1 grep -eu "$@" 'quoted text' ${HOME} $(pwd) test export
+		x=1 readonly $(pwd) "$@" readonly --verbose && 'quoted text' "$@" "$1"
+local printf grep then --verbose $(pwd) then export
+printf cd cd grep sed test /usr/bin echo printf 'quoted text'
+		sed "$1" "$1" | sed awk then $(pwd) test "$@" done x=1 cd -eu
+	cd ${HOME} cd grep export 'quoted text' export &&
+--verbose done /usr/bin awk test done awk sed ${HOME} test printf sed /usr/bin
+	test $(pwd) test cd | 2>/dev/null awk --verbose
+	export printf ${HOME} && printf ${HOME} awk awk readonly export x=1 cd | test
+	test then readonly -eu
+--verbose grep grep test echo export
+	'quoted text' cd printf 2>/dev/null /usr/bin
+		/usr/bin printf "$@" export 'quoted text'
+		then sed 'quoted text' "$1" sed -eu ${HOME} local ${HOME} awk then
+	then sed "$1" export awk -eu test ${HOME} cd
+	"$1" && "$1" | cd --verbose
+2>/dev/null --verbose -eu grep readonly ${HOME} --verbose awk readonly
+sed printf local echo export readonly -eu 'quoted text' 'quoted text' &&
+	then -eu 2>/dev/null /usr/bin done "$1" grep sed done | then
+		printf 2>/dev/null | done --verbose $(pwd) test /usr/bin then |
+${HOME} printf awk --verbose "$@" sed printf
+		${HOME} "$1" 'quoted text'
+"$1" export sed "$@" test && sed local done 'quoted text' | done done
+/usr/bin -eu x=1 && x=1
+		printf echo cd /usr/bin "$@"
+/usr/bin "$@" done cd -eu awk ${HOME} readonly grep cd
+		awk && readonly test "$@" && grep && echo then readonly
+	echo $(pwd) 2>/dev/null export printf
+		done export awk --verbose -eu grep done 2>/dev/null cd echo test /usr/bin
+		echo readonly then test
+		awk cd printf printf ${HOME}
+cd -eu 2>/dev/null echo done local
+		/usr/bin /usr/bin echo -eu done local -eu 2>/dev/null ${HOME} --verbose
+test then --verbose export local then /usr/bin -eu $(pwd) $(pwd) local awk
+	readonly | awk x=1 "$1" "$1" --verbose x=1
+		awk 'quoted text' --verbose export ${HOME} "$@" done
+		"$1" -eu then ${HOME} done
+		local readonly local readonly grep sed | "$@" $(pwd) /usr/bin
+-eu | done grep "$@" then ${HOME} 2>/dev/null
+	test "$@" | done 2>/dev/null x=1 | -eu awk x=1
+${HOME} ${HOME} cd awk export ${HOME} then "$@" local cd readonly
+		2>/dev/null | ${HOME} echo then 2>/dev/null awk export x=1 "$1" local
+	/usr/bin grep export 'quoted text'
+		-eu /usr/bin --verbose "$1" x=1 $(pwd) "$@" /usr/bin awk export
+grep then x=1 awk awk 2>/dev/null then /usr/bin $(pwd) sed && -eu
+grep "$1" cd 'quoted text' "$1" | $(pwd) awk export sed "$1"
+		--verbose x=1 -eu cd export 'quoted text'
+x=1 readonly awk "$1" | echo test | --verbose --verbose
+		${HOME} /usr/bin done echo then -eu /usr/bin done --verbose
+"$1" cd readonly | awk "$1" | awk
+	"$1" 2>/dev/null 'quoted text' grep && then $(pwd) cd
+	then && awk printf "$1" $(pwd) readonly x=1 --verbose "$1"
+	| sed cd echo test x=1 grep export x=1 grep cd $(pwd) x=1 --verbose "$@"
+		${HOME} "$1" test echo ${HOME}
+readonly cd ${HOME} sed echo sed /usr/bin "$@" sed $(pwd) "$@"
+	export readonly echo x=1 then grep test "$@" ${HOME} test $(pwd) $(pwd)
+	$(pwd) 2>/dev/null --verbose readonly "$1" readonly grep sed
+'quoted text' sed && "$@" done | local && "$1" | ${HOME}
+		sed x=1 done awk awk cd echo 'quoted text' /usr/bin
+${HOME} 'quoted text' --verbose $(pwd) grep test then local readonly done
+| --verbose /usr/bin | | "$@" "$1" grep done 2>/dev/null && printf
+		echo 2>/dev/null awk done readonly cd then local cd readonly local ${HOME}
+		cd printf done readonly 2>/dev/null export local test
+grep && 2>/dev/null awk ${HOME} -eu 'quoted text' x=1 export | 2>/dev/null $(pwd)
+	-eu x=1 x=1 $(pwd) ${HOME} awk sed $(pwd) then | then cd | "$@" |
+	"$@" ${HOME} test && cd grep 2>/dev/null done --verbose /usr/bin /usr/bin "$@" cd
+2>/dev/null echo done 'quoted text' printf "$@" test local echo $(pwd) /usr/bin
+${HOME} grep --verbose | printf $(pwd)
+export local local 'quoted text'
+2>/dev/null 2>/dev/null && 2>/dev/null done --verbose | awk 2>/dev/null -eu
+		test done echo sed echo
+	-eu "$1" -eu awk sed | /usr/bin test grep 2>/dev/null awk local x=1 echo
+		/usr/bin "$@" cd echo 'quoted text' readonly x=1
+	test done grep "$@" cd x=1 readonly test then /usr/bin
+	readonly $(pwd) x=1 $(pwd) x=1 awk 2>/dev/null
+	readonly 'quoted text' cd cd export --verbose then -eu 2>/dev/null
+		| "$1" cd --verbose then awk ${HOME} printf export grep 'quoted text' | "$@"
+	grep 2>/dev/null /usr/bin awk readonly -eu then sed -eu then "$@" 'quoted text'
+	readonly echo echo && echo
+"$1" 2>/dev/null grep $(pwd) sed
+/usr/bin sed done done readonly test echo /usr/bin echo then --verbose
+	export echo awk grep x=1 test $(pwd) /usr/bin -eu echo awk 2>/dev/null
+	/usr/bin grep $(pwd) echo x=1 export /usr/bin $(pwd)
+then export cd awk cd printf /usr/bin
+	-eu cd readonly awk x=1 cd x=1
+	"$1" "$1" local then "$1" test &&
+		test x=1 | x=1 done "$1" sed --verbose
+		printf "$1" 2>/dev/null x=1 $(pwd)
+	"$1" then printf 'quoted text' | echo
+"$1" -eu grep test sed
+		echo && --verbose && echo readonly printf $(pwd)
+	readonly readonly grep test grep test 'quoted text' local readonly
+	| local "$@" | --verbose
+2>/dev/null && x=1 /usr/bin grep then
+echo "$@" 2>/dev/null test then grep sed local && test local
+	printf ${HOME} test printf && "$@" "$1"
+	cd awk cd test test /usr/bin test /usr/bin
+local /usr/bin x=1 "$1" /usr/bin
+		test -eu x=1 echo 'quoted text' $(pwd)
+readonly local awk sed 2>/dev/null cd /usr/bin readonly ${HOME}
+	sed $(pwd) done x=1 && ${HOME} | && cd echo test /usr/bin
+/usr/bin ${HOME} awk test export 'quoted text' "$1" x=1 export sed test
+	/usr/bin --verbose done readonly then $(pwd) printf done test
+x=1 $(pwd) --verbose "$@" echo /usr/bin
+	--verbose "$1" ${HOME} "$@" local awk test
+$(pwd) 'quoted text' "$@" && | "$@" /usr/bin
+export "$@" "$1" grep -eu "$@" sed ${HOME} 'quoted text'
+		&& awk "$1" 'quoted text' "$@" sed echo "$1" sed x=1 done awk readonly 2>/dev/null
+		local x=1 /usr/bin local "$1" printf export | sed ${HOME} done
+$(pwd) "$@" --verbose awk --verbose ${HOME}
+	"$@" readonly $(pwd) sed export awk sed readonly echo done local
+	"$@" cd "$@" | awk then readonly sed awk grep cd done
+		$(pwd) done echo local x=1 local | sed done
+		/usr/bin "$@" export printf printf cd --verbose
+	cd export export ${HOME} "$@" printf 2>/dev/null
+sed done -eu readonly local grep /usr/bin -eu
+test 2>/dev/null test sed $(pwd)
+local awk cd sed "$@" awk
+cd grep /usr/bin printf grep done cd "$1" ${HOME} printf 'quoted text' --verbose
+	$(pwd) echo done && 2>/dev/null 2>/dev/null /usr/bin
+	$(pwd) sed | grep /usr/bin printf echo /usr/bin
+		echo grep ${HOME} grep 2>/dev/null export done sed awk sed grep
+grep "$@" $(pwd) done readonly awk echo --verbose 'quoted text' ${HOME}
+-eu grep grep cd cd "$1" sed --verbose sed | "$1" && grep $(pwd)
+	-eu cd sed export readonly --verbose 2>/dev/null $(pwd) done sed 2>/dev/null
+readonly export x=1 | 2>/dev/null echo /usr/bin readonly awk -eu
+		-eu 'quoted text' --verbose then grep --verbose readonly | && 2>/dev/null
+	&& ${HOME} local cd ${HOME} x=1 /usr/bin local -eu "$@" grep
+	sed echo "$@" /usr/bin "$@" done ${HOME} readonly cd echo "$1" /usr/bin
+		"$@" --verbose echo local readonly ${HOME} "$1" "$@" 'quoted text'
+	$(pwd) 'quoted text' && "$1" test grep sed printf "$@" ${HOME} grep "$@"
+	-eu sed printf grep sed 'quoted text' "$1" "$1" awk -eu /usr/bin readonly
+readonly 2>/dev/null --verbose local && awk echo
+		"$1" echo --verbose | "$@" readonly $(pwd) readonly /usr/bin
+	${HOME} --verbose /usr/bin /usr/bin echo test x=1
+grep grep sed $(pwd) awk -eu $(pwd) export done readonly awk
+	| cd 'quoted text' -eu readonly export done --verbose --verbose --verbose
+x=1 cd local then then printf "$1" awk echo "$1"
+		test 'quoted text' readonly
+	printf | sed && ${HOME} 2>/dev/null echo
+		&& "$@" --verbose "$@" "$1" x=1 cd local sed $(pwd) done /usr/bin
+	cd echo --verbose "$1" 'quoted text' | printf 2>/dev/null awk grep
+test echo ${HOME} printf readonly
+"$@" "$1" --verbose $(pwd)
+-eu | "$1" done ${HOME} && printf sed --verbose | printf
+2>/dev/null readonly && x=1 awk
+		--verbose readonly test cd ${HOME} 'quoted text' ${HOME}
+		awk cd test printf readonly
+	--verbose local local &&
+2>/dev/null cd printf $(pwd) done done export x=1 awk awk && grep
+local ${HOME} export /usr/bin sed -eu awk cd /usr/bin
+		--verbose "$@" ${HOME} export then awk -eu 'quoted text'
+	/usr/bin x=1 readonly readonly
+	x=1 readonly done --verbose
+	printf $(pwd) --verbose local
+	| "$1" -eu ${HOME} && printf
+		x=1 x=1 | echo export x=1 sed 'quoted text' 2>/dev/null ${HOME}
+		| --verbose ${HOME} $(pwd)
+	'quoted text' export ${HOME} sed
+		export then 2>/dev/null local
+--verbose test local | /usr/bin
+		printf -eu cd && export
+sed test local && echo printf 2>/dev/null x=1
+		"$1" then printf 'quoted text' $(pwd) export "$1" echo readonly
+		readonly echo export awk cd awk printf readonly export cd then
+		-eu 2>/dev/null awk local
+	local | --verbose echo | x=1 -eu
+'quoted text' grep then grep
+		cd 'quoted text' echo x=1 /usr/bin
+	$(pwd) -eu 2>/dev/null sed /usr/bin test cd
+	"$@" | echo test local readonly "$1" cd echo printf done 2>/dev/null 'quoted text'
+	x=1 $(pwd) export printf export sed x=1 -eu
+"$1" x=1 'quoted text' $(pwd) ${HOME} --verbose local sed done done
+	readonly sed grep | "$1" | "$1"
+		"$@" && local test local -eu grep 'quoted text' "$@"
+		x=1 'quoted text' echo ${HOME} 'quoted text'
+		then awk test local export export 'quoted text' "$@" cd 'quoted text'
+	x=1 printf local ${HOME} "$1" local then "$1" | sed echo local
+grep x=1 sed -eu local --verbose /usr/bin cd x=1 local ${HOME} /usr/bin
+		$(pwd) ${HOME} readonly grep printf then $(pwd) /usr/bin
+awk "$1" "$@" local readonly --verbose export awk 2>/dev/null $(pwd)
+	cd x=1 export "$@" cd awk -eu x=1 "$1" "$1" readonly 'quoted text' && echo
+	"$@" ${HOME} printf then printf test
+grep | ${HOME} x=1 cd 'quoted text' echo awk
+	echo --verbose $(pwd) printf grep test test 2>/dev/null --verbose done
+		--verbose then "$1" 'quoted text' 2>/dev/null then
+local grep 2>/dev/null | readonly 2>/dev/null then grep grep grep
+	cd grep readonly local "$@" export cd awk grep
+		export sed 'quoted text' "$1" local /usr/bin $(pwd) printf x=1 sed
+	printf printf awk --verbose export && $(pwd) local echo
+"$@" then local then 'quoted text' awk local | test "$1" readonly
+	test $(pwd) readonly /usr/bin
+		cd 'quoted text' $(pwd)
+x=1 echo cd readonly "$@" printf
+printf x=1 cd then sed readonly
+		${HOME} x=1 x=1 then -eu readonly ${HOME} cd --verbose
+	export && -eu "$@" ${HOME} test readonly && && local printf ${HOME} 'quoted text'
+		done cd export cd -eu 'quoted text' echo grep then local x=1 test cd "$@"
+cd readonly then && /usr/bin 2>/dev/null echo sed test echo echo sed 'quoted text'
+		export "$@" printf echo done grep && "$1" --verbose
+		grep $(pwd) done $(pwd) cd $(pwd) 'quoted text'
+	2>/dev/null && awk readonly ${HOME}
+/usr/bin cd local test then awk readonly -eu export $(pwd) 2>/dev/null then
+		"$1" export x=1 2>/dev/null /usr/bin awk cd printf x=1 ${HOME} --verbose awk
+	x=1 x=1 "$@" ${HOME} test 2>/dev/null grep "$@" | "$1"
+2>/dev/null "$1" /usr/bin && awk $(pwd) -eu cd $(pwd)
+		cd --verbose x=1 && then &&
+		echo 'quoted text' test readonly export ${HOME}
+		"$@" sed --verbose awk -eu "$@" x=1 x=1 local
+		sed $(pwd) 'quoted text' x=1
+		sed grep 2>/dev/null cd awk 2>/dev/null "$1" echo "$@" 2>/dev/null && 2>/dev/null
+		echo /usr/bin | grep done test && sed cd done export
+	export $(pwd) grep $(pwd) 'quoted text' "$@" done printf echo done
+x=1 readonly "$@" /usr/bin "$@" printf x=1 x=1 $(pwd) sed | 2>/dev/null cd cd
+echo ${HOME} sed readonly x=1
+${HOME} | awk test then -eu ${HOME}
+	test -eu -eu -eu awk export
+	readonly ${HOME} export "$@" /usr/bin 'quoted text' then $(pwd)
+2>/dev/null done local then printf printf 2>/dev/null
+"$@" /usr/bin 2>/dev/null
+		-eu -eu cd 2>/dev/null && echo $(pwd)
+	"$@" 'quoted text' -eu "$@" readonly "$1" /usr/bin && cd -eu $(pwd)
+	printf echo then && 2>/dev/null cd $(pwd) done ${HOME} awk
+		local awk x=1 2>/dev/null
+	2>/dev/null readonly readonly echo --verbose
+cd then -eu readonly --verbose
+cd grep && awk --verbose 'quoted text' --verbose
+	"$1" "$@" local --verbose "$1" --verbose "$@" sed cd 'quoted text'
+		'quoted text' grep printf 2>/dev/null "$1" | "$@" sed
+	"$@" export cd readonly grep x=1 done local echo "$@" cd &&
+	cd grep test sed sed -eu export | awk sed
+		"$@" | $(pwd) -eu export 2>/dev/null $(pwd)
+export 'quoted text' 'quoted text' echo local 2>/dev/null
+	"$@" echo test awk "$@" done "$1" x=1
+		$(pwd) sed 'quoted text' 2>/dev/null $(pwd) ${HOME} export /usr/bin 2>/dev/null
+&& && "$@" printf test "$@" sed &&
+local sed /usr/bin 2>/dev/null cd -eu | sed 2>/dev/null done cd $(pwd) "$1" sed
+		local x=1 printf | /usr/bin "$@" -eu x=1 ${HOME}
+${HOME} test sed 'quoted text' ${HOME} export grep sed
+"$@" printf "$1" done --verbose cd "$1" sed then ${HOME} local $(pwd)
+		awk grep readonly "$@" /usr/bin x=1 grep && grep cd done /usr/bin test
+		export x=1 $(pwd) awk ${HOME} $(pwd) --verbose then ${HOME}
+		/usr/bin awk test 'quoted text'
+		echo ${HOME} 'quoted text' 'quoted text' --verbose --verbose "$1" echo
+		-eu done cd cd | "$@" 'quoted text'
+readonly local printf | --verbose readonly grep test /usr/bin
+		-eu ${HOME} echo && x=1 cd test sed "$@" /usr/bin export && sed cd echo ${HOME}
+-eu --verbose 'quoted text' $(pwd) test export echo "$@"
+	cd then "$@" | "$1" done --verbose 2>/dev/null grep local
+awk 'quoted text' -eu grep test test | awk test awk
+		$(pwd) sed test 2>/dev/null x=1 then 2>/dev/null
+		grep && done local printf echo local "$1" | $(pwd) cd then
+		cd x=1 ${HOME} 2>/dev/null 'quoted text' | awk done done test
+echo 2>/dev/null done echo export sed && local /usr/bin
+--verbose local then $(pwd) printf printf awk export
+done done printf "$1" 2>/dev/null
+export awk 'quoted text' readonly 2>/dev/null
+		export 2>/dev/null "$@" -eu /usr/bin export /usr/bin export "$@" grep $(pwd)
+	&& cd echo 'quoted text' x=1 export -eu "$1" 'quoted text' 2>/dev/null local
+		grep printf cd 'quoted text' readonly --verbose 2>/dev/null printf then
+		--verbose $(pwd) $(pwd) "$1" $(pwd) $(pwd)
+		printf "$@" awk 2>/dev/null | "$@" "$1" done | --verbose cd 2>/dev/null sed then
+	| then 2>/dev/null ${HOME}
+/usr/bin -eu local --verbose local echo 'quoted text'
+		"$1" ${HOME} export 'quoted text' readonly local | "$@"
+	export x=1 done 2>/dev/null --verbose ${HOME} cd --verbose sed && "$1" awk done
+"$@" printf 2>/dev/null sed sed "$1"
+		--verbose sed /usr/bin $(pwd) x=1 -eu export && export printf
+	-eu "$1" -eu --verbose $(pwd) /usr/bin test --verbose sed /usr/bin
+		sed --verbose local x=1 awk -eu --verbose x=1 &&
+$(pwd) 'quoted text' | echo export export printf
+&& && ${HOME} awk -eu done sed -eu
+		"$@" x=1 2>/dev/null ${HOME} local 'quoted text'
+		x=1 test printf x=1 x=1 grep 2>/dev/null test 2>/dev/null
+cd --verbose $(pwd) readonly "$1" | | /usr/bin then 2>/dev/null
+/usr/bin awk 2>/dev/null test test ${HOME} /usr/bin
+		grep ${HOME} x=1 sed "$1" test -eu x=1 then awk | readonly "$@" "$@" awk
+	readonly done ${HOME} done grep echo awk "$@" export $(pwd) printf "$1"
+grep grep -eu --verbose "$1" --verbose /usr/bin x=1 cd grep sed | --verbose
+${HOME} printf awk "$1" $(pwd) sed ${HOME} /usr/bin local then "$1" local
+-eu ${HOME} awk readonly awk awk 'quoted text' then /usr/bin $(pwd)
+		/usr/bin grep cd $(pwd) then | done grep "$1" test 2>/dev/null
+printf export "$1" sed -eu sed local echo sed /usr/bin printf printf $(pwd) ${HOME}
+		readonly readonly export --verbose then grep "$1" awk ${HOME} ${HOME} then
+		&& sed x=1 sed 'quoted text' "$@" sed local ${HOME}
+	local export readonly grep /usr/bin 'quoted text' readonly readonly | cd done
+${HOME} test "$1" local /usr/bin
+	-eu $(pwd) cd cd grep sed printf
+		printf 'quoted text' "$1" echo printf $(pwd) --verbose x=1 "$@" done echo -eu
+then done $(pwd) "$1" /usr/bin ${HOME} 'quoted text' --verbose readonly &&
+	sed readonly 2>/dev/null
+	'quoted text' "$1" printf grep
+--verbose cd export | echo && awk "$1" 'quoted text' | && "$1" export
+then /usr/bin export echo "$@" cd echo
+	test /usr/bin export export x=1 "$1" grep echo "$1" sed "$1"
+readonly then /usr/bin $(pwd) local then test /usr/bin readonly
+	local done printf && cd 2>/dev/null --verbose -eu cd printf grep
+	grep grep echo "$1" && && ${HOME} "$@" 'quoted text' "$1" /usr/bin
+&& echo | && cd grep local && export --verbose test $(pwd) -eu
+	export awk readonly && --verbose -eu "$1" export grep x=1 "$1"
+	'quoted text' "$1" && --verbose test done "$@"
+local done $(pwd) grep | then "$1" 2>/dev/null
+grep && awk "$@" test --verbose 2>/dev/null
+	then ${HOME} then x=1 x=1 -eu readonly
+		test cd "$1" readonly | && sed $(pwd) export awk sed | && "$1" x=1 | test
+x=1 ${HOME} /usr/bin -eu readonly readonly
+grep export then $(pwd) test printf
+	&& x=1 sed awk export done --verbose
+grep then && local /usr/bin | readonly && done "$1" cd
+	'quoted text' && test x=1 grep 2>/dev/null done
+	$(pwd) /usr/bin $(pwd) && then
+then "$1" x=1 'quoted text' local 2>/dev/null "$@" -eu
+		local printf grep then readonly
+	-eu "$@" local test 'quoted text' cd awk x=1 done
+	--verbose printf $(pwd) -eu "$@" awk local awk then sed "$@" done 'quoted text'
+${HOME} then && ${HOME} printf grep then "$1" $(pwd) local
+	done "$1" cd cd ${HOME} sed cd && then printf && local
+	'quoted text' "$@" ${HOME} | "$1" | cd printf
+		'quoted text' "$@" "$1" --verbose export x=1 'quoted text' awk printf export
+		"$1" 2>/dev/null x=1 sed "$1" readonly x=1 "$1"
+		-eu local "$@" cd -eu echo
+| export -eu then 2>/dev/null
+		"$@" -eu --verbose export "$@" test
+2>/dev/null then export x=1 "$@" export "$1" local echo cd sed done ${HOME}
+| $(pwd) printf 'quoted text' ${HOME} test /usr/bin
+$(pwd) | cd then done "$@" awk $(pwd) grep sed local x=1 $(pwd) --verbose $(pwd)
+"$@" ${HOME} grep local export --verbose
+		--verbose echo && -eu /usr/bin done cd export readonly
+/usr/bin 'quoted text' "$@" "$1" grep then cd 2>/dev/null then awk test
+sed 2>/dev/null "$1" export done grep printf 'quoted text' -eu
+		${HOME} "$@" done awk printf && export
+		"$1" ${HOME} -eu cd -eu done test
+&& awk 2>/dev/null x=1 -eu "$@" awk /usr/bin
+		awk "$@" local echo then ${HOME} test 2>/dev/null readonly "$1" x=1
+	export echo x=1 grep local x=1 export
+		cd ${HOME} --verbose then then /usr/bin sed done
+		awk /usr/bin && "$@" grep test done && --verbose "$@"
+x=1 x=1 | "$@" test ${HOME} --verbose awk grep grep "$@" 2>/dev/null cd readonly
+	sed "$1" /usr/bin x=1
+	"$@" printf echo -eu 2>/dev/null readonly awk ${HOME} readonly local &&
+'quoted text' awk 'quoted text' then printf | "$1"
+-eu export local "$1" sed /usr/bin && readonly /usr/bin /usr/bin printf
+	&& "$@" readonly "$@" done export then "$@"
+sed && && local echo 2>/dev/null "$1" awk export /usr/bin readonly sed
+sed export sed echo -eu
+		-eu cd "$@" test x=1 sed $(pwd)
+		${HOME} grep done | test -eu grep awk
+	2>/dev/null awk done sed test $(pwd) sed export 2>/dev/null
+	| sed -eu --verbose | ${HOME} local 'quoted text'
+		cd test 'quoted text' $(pwd) --verbose then
+		then grep local ${HOME} --verbose sed --verbose
+	2>/dev/null awk then -eu |
+'quoted text' "$1" ${HOME}
+--verbose readonly test --verbose
+	echo -eu /usr/bin /usr/bin
+-eu 2>/dev/null echo ${HOME}
+		'quoted text' readonly
+		"$1" "$@" 'quoted text' x=1 'quoted text'
+		sed "$@" cd | echo cd -eu 2>/dev/null cd ${HOME} echo x=1 export then
+-eu $(pwd) -eu $(pwd) -eu sed
+sed cd "$@" awk /usr/bin awk echo "$@" then 2>/dev/null /usr/bin
+printf echo x=1 local && "$1" cd x=1 awk | /usr/bin && ${HOME} printf ${HOME}
+		readonly ${HOME} local echo echo
+	-eu x=1 | readonly 'quoted text' cd 2>/dev/null
+	-eu sed awk "$1" --verbose readonly
+&& $(pwd) done -eu done done grep ${HOME} $(pwd) 'quoted text'
+	sed sed | | $(pwd) "$@" ${HOME}
+	done printf "$@" && && "$@" awk then sed printf x=1 cd export export
+	test 2>/dev/null 2>/dev/null 'quoted text' test "$1" grep printf /usr/bin
+	sed x=1 -eu sed readonly && echo local printf sed cd done
+		done $(pwd) local test local $(pwd) | readonly export
+	grep awk awk 2>/dev/null grep done cd then
+| sed readonly 2>/dev/null 'quoted text' 2>/dev/null
+	/usr/bin test then test $(pwd)
+2>/dev/null 2>/dev/null 'quoted text' 2>/dev/null
+		printf echo /usr/bin local export then
+	printf readonly echo ${HOME}
+then "$1" local awk 2>/dev/null echo -eu ${HOME} readonly 'quoted text' 2>/dev/null
+		local "$@" grep && local --verbose ${HOME}
+		cd 2>/dev/null "$1" && sed printf
+&& readonly awk printf x=1 x=1 "$@" local 'quoted text'
+		local /usr/bin echo done
+		"$@" ${HOME} done grep 'quoted text' sed --verbose cd && sed echo
+	${HOME} ${HOME} test --verbose $(pwd)
+		'quoted text' echo "$@" | $(pwd) $(pwd) local echo
+	&& 'quoted text' /usr/bin local
+	then cd 2>/dev/null awk sed && test && cd sed | sed sed 2>/dev/null
+	"$1" 2>/dev/null then "$@" then local then local "$1" export sed $(pwd) readonly
+		readonly echo $(pwd) /usr/bin -eu &&
+sed readonly awk "$@" ${HOME}
+		${HOME} grep local echo awk sed
+		then | cd --verbose echo readonly 'quoted text'
+		local grep && "$1" 2>/dev/null && cd 2>/dev/null echo ${HOME} sed "$1" -eu
+		then printf && grep sed done 2>/dev/null x=1 done
+sed --verbose -eu ${HOME} done sed 2>/dev/null
+		sed | x=1 -eu readonly "$@" 2>/dev/null
+	2>/dev/null readonly echo $(pwd) -eu ${HOME}
+		--verbose sed -eu export | ${HOME} 2>/dev/null "$@" grep 2>/dev/null printf printf
+	readonly 2>/dev/null /usr/bin 2>/dev/null
+	| local x=1 'quoted text' export "$@" -eu test then
+		test -eu "$1" done awk
+local awk cd 2>/dev/null test
+		cd | -eu cd local $(pwd) done | $(pwd)
+		grep x=1 2>/dev/null echo test printf 'quoted text' "$@" local ${HOME} sed
+		then x=1 readonly | && "$1" "$1" 2>/dev/null "$@" echo grep 'quoted text'
+		/usr/bin test cd done export 2>/dev/null x=1 local local "$@" grep $(pwd) "$@" x=1
+		readonly $(pwd) awk 'quoted text' "$@" awk readonly
+/usr/bin awk done export local sed
+		printf x=1 then "$1" cd $(pwd) -eu local sed -eu ${HOME}
+	-eu awk awk --verbose $(pwd) ${HOME}
+"$1" test "$1" && echo x=1 "$1" done sed "$@"
+	printf "$1" test $(pwd) sed cd grep |
+	then "$@" test --verbose | awk local then
+	-eu printf echo sed x=1 sed 2>/dev/null echo local
+		test readonly readonly "$1" echo
+	"$@" awk "$@" echo ${HOME} -eu readonly ${HOME}
+		"$@" readonly echo printf
+	| 2>/dev/null then printf 2>/dev/null
+sed echo readonly printf && local 2>/dev/null
+	$(pwd) test grep local cd printf export ${HOME} cd printf done then 2>/dev/null
+export "$1" echo printf awk &&
+echo "$1" x=1 grep /usr/bin cd printf
+	local then printf readonly /usr/bin /usr/bin && --verbose awk 'quoted text'
+	local /usr/bin ${HOME} --verbose sed local ${HOME} &&
+	&& grep "$1" -eu 2>/dev/null --verbose export
+	$(pwd) "$@" x=1 then x=1 --verbose done
+--verbose 2>/dev/null readonly ${HOME}
+${HOME} | then "$@" test then ${HOME} "$1" grep 'quoted text'
+	awk echo $(pwd) test -eu "$@" "$1" export readonly /usr/bin
+	--verbose local cd local test
+		awk -eu | "$@" grep 'quoted text' 'quoted text' && | local
+2>/dev/null 2>/dev/null then sed 'quoted text' "$@" "$1" "$@" 'quoted text'
+"$@" "$1" readonly x=1 -eu -eu -eu printf
+test 2>/dev/null | 2>/dev/null sed ${HOME}
+&& echo "$@" x=1 cd -eu test && 'quoted text' grep test -eu -eu
+	$(pwd) readonly readonly "$@" /usr/bin
+	printf local export cd && $(pwd) | | cd printf 'quoted text' cd --verbose
+		cd cd --verbose awk echo test cd x=1 'quoted text'
+awk cd "$1" export -eu awk x=1 --verbose export /usr/bin -eu readonly echo
+		readonly cd printf "$1" sed awk export ${HOME} test 'quoted text' "$1" grep
+local $(pwd) "$1" ${HOME} 'quoted text' $(pwd) --verbose && 'quoted text'
+	done then ${HOME} "$@" "$1" printf cd x=1 awk "$@" -eu "$@" $(pwd) | 2>/dev/null
+$(pwd) then ${HOME} cd printf x=1 export done done grep test
+${HOME} 2>/dev/null readonly x=1 readonly export /usr/bin
+		awk sed awk | "$@" 'quoted text' cd --verbose grep export done "$@"
+	local test -eu printf x=1 then x=1 cd /usr/bin
+		printf cd then ${HOME} 2>/dev/null "$1" test grep | sed printf ${HOME} echo
+	done awk "$1" cd awk echo done
+"$@" awk awk "$1" readonly cd 2>/dev/null 'quoted text'
+	"$1" local cd export grep
+		echo 2>/dev/null x=1 /usr/bin x=1 test /usr/bin -eu --verbose
+	local echo readonly test /usr/bin local cd readonly 'quoted text' && --verbose
+		sed --verbose --verbose echo
+"$1" | echo x=1 awk echo -eu --verbose test --verbose
+		'quoted text' $(pwd) 'quoted text'
+	$(pwd) | ${HOME} ${HOME}
+		| 2>/dev/null grep then 2>/dev/null
+		then then cd test test printf "$1" --verbose
+		'quoted text' && export export
+		export local done test printf awk
+$(pwd) done 2>/dev/null -eu "$@" $(pwd) test ${HOME} export
+		readonly 2>/dev/null -eu local -eu
+	"$@" $(pwd) export sed done 'quoted text' then --verbose cd
+		echo grep 2>/dev/null /usr/bin | 'quoted text'
+	echo $(pwd) printf 2>/dev/null | printf
+	sed 2>/dev/null sed readonly --verbose
+		$(pwd) "$@" done export echo cd sed echo local export
+readonly grep ${HOME} x=1 "$@" export $(pwd)
+--verbose $(pwd) && --verbose echo "$@"
+then printf -eu sed x=1 printf 'quoted text'
+	$(pwd) readonly "$@" 'quoted text' 2>/dev/null export
+		${HOME} 'quoted text' 2>/dev/null echo done "$1" done awk cd 'quoted text'
+		local "$@" | 2>/dev/null 'quoted text' printf grep x=1 'quoted text'
+readonly "$@" test printf echo sed --verbose "$1" printf
+		"$1" $(pwd) --verbose local | export 2>/dev/null --verbose && then
+$(pwd) then /usr/bin --verbose sed 2>/dev/null
+	test readonly x=1 -eu export
+${HOME} ${HOME} then local grep 'quoted text' local sed then $(pwd) export /usr/bin
+		done $(pwd) "$@" -eu "$1" 2>/dev/null
+	awk done --verbose 'quoted text' test grep x=1 -eu export
+	then sed grep $(pwd) cd echo "$@" "$1" printf
+$(pwd) export 2>/dev/null awk readonly
+	${HOME} x=1 then ${HOME} "$@" then $(pwd) && done local ${HOME}
+	2>/dev/null test /usr/bin
+		$(pwd) 'quoted text' ${HOME}
+		-eu awk x=1 ${HOME} done then local ${HOME} /usr/bin x=1 awk /usr/bin printf
+'quoted text' /usr/bin x=1 "$1" awk && ${HOME} --verbose
+	export then ${HOME} 'quoted text' ${HOME}
+local x=1 awk local awk "$@" && awk "$1" readonly /usr/bin echo local test
+		$(pwd) "$@" ${HOME} $(pwd) -eu $(pwd) $(pwd) | printf local
+		"$@" cd local "$1" x=1 --verbose
+grep 'quoted text' "$@" /usr/bin readonly 2>/dev/null awk cd awk done --verbose
+	sed $(pwd) echo echo echo 2>/dev/null /usr/bin "$1" cd $(pwd) 'quoted text'
+		$(pwd) -eu --verbose echo | printf
+		grep cd cd awk && 2>/dev/null grep 'quoted text' sed && local echo awk 2>/dev/null
+	test --verbose ${HOME} readonly echo 'quoted text'
+done 'quoted text' awk "$@" && "$@" "$@" grep 2>/dev/null echo "$@" 2>/dev/null
+	grep awk printf && printf done
+	-eu test readonly readonly done done --verbose grep ${HOME} grep && ${HOME} /usr/bin
+	--verbose "$@" printf /usr/bin local 'quoted text' "$1" sed 'quoted text' "$@"
+	local ${HOME} then /usr/bin 'quoted text' readonly readonly done readonly --verbose
+		| cd 'quoted text' cd echo x=1 $(pwd) && grep echo
+"$1" 'quoted text' $(pwd) | export export ${HOME} export awk done
+	local then 2>/dev/null -eu
+	cd printf --verbose then test /usr/bin 'quoted text'
+local cd readonly awk then echo cd
+		$(pwd) 'quoted text' --verbose
+awk cd done 'quoted text' | sed "$1"
+test printf done x=1 local done echo awk /usr/bin readonly
+		test $(pwd) | --verbose
+		printf sed grep && | test 'quoted text' printf readonly "$1" -eu
+		"$1" --verbose awk grep | grep readonly /usr/bin /usr/bin "$@" 2>/dev/null "$1"
+cd readonly test | sed sed
+		sed done | x=1 sed 2>/dev/null readonly readonly echo && then test readonly export
+		| x=1 cd done x=1 done export | 2>/dev/null sed 2>/dev/null | test 'quoted text'
+	/usr/bin && grep done local test /usr/bin cd cd done then
+	export done readonly cd export --verbose | printf 'quoted text' "$@"
+test export readonly && export && grep
+		test 'quoted text' $(pwd) x=1 sed
+	$(pwd) printf awk 'quoted text' --verbose
+	echo | test sed then "$@" | ${HOME} printf "$1" grep printf --verbose
+&& readonly --verbose /usr/bin done cd -eu "$1" $(pwd) && export 'quoted text'
+	"$@" local 'quoted text' "$@" --verbose done 2>/dev/null
+&& local then "$1" done
+		local grep printf test echo | test ${HOME} -eu --verbose
+x=1 echo ${HOME} | awk 2>/dev/null ${HOME} sed "$@" export "$@"
+		done test sed "$@" echo $(pwd) cd -eu 'quoted text' printf ${HOME} done
+done 'quoted text' ${HOME} awk awk sed /usr/bin echo echo
+	${HOME} "$@" 'quoted text' $(pwd) awk sed ${HOME} x=1
+		&& printf local $(pwd) readonly $(pwd) test cd "$@" -eu cd "$@" grep "$1" &&
+"$1" -eu printf readonly local printf -eu "$1" --verbose 2>/dev/null sed 2>/dev/null
+	readonly -eu readonly export
+		printf export --verbose 'quoted text' then printf /usr/bin 2>/dev/null printf
+	"$1" && then done "$1" && local cd -eu done 2>/dev/null "$@" sed
+	$(pwd) export echo done local && -eu && x=1 x=1
+	"$1" awk -eu x=1 'quoted text' cd grep | local sed
+printf echo | test awk export "$1" then sed test 2>/dev/null
+		'quoted text' printf $(pwd)
+		x=1 sed test "$@" readonly printf -eu /usr/bin
+echo && then echo local -eu --verbose x=1 then $(pwd) export readonly
+	${HOME} "$@" "$@" --verbose $(pwd) printf x=1 "$@" 2>/dev/null
+		grep cd | export && cd readonly
+test "$1" done grep done
+'quoted text' x=1 then -eu x=1 x=1 printf "$@"
+	readonly /usr/bin 2>/dev/null export -eu -eu
+		then ${HOME} echo export printf
+	sed 'quoted text' 'quoted text' echo |
+		"$@" local -eu then 'quoted text'
+	test "$@" "$1" "$@" ${HOME} --verbose
+		$(pwd) 2>/dev/null echo x=1 test
+		readonly ${HOME} test /usr/bin printf --verbose grep cd local then printf "$1"
+		then "$@" x=1 echo done done "$1" readonly 2>/dev/null ${HOME} ${HOME} ${HOME}
+	-eu 2>/dev/null test ${HOME} awk 2>/dev/null | awk grep sed cd /usr/bin |
+	${HOME} test -eu echo grep then "$@" | | --verbose awk
+	| export "$1" done export ${HOME}
+	$(pwd) 'quoted text' x=1 && ${HOME} done printf
+		export test printf grep cd printf 2>/dev/null x=1 --verbose grep awk grep
+		cd x=1 printf /usr/bin
+		${HOME} && local awk local echo $(pwd) 'quoted text'
+		then 'quoted text' readonly 'quoted text' echo local ${HOME} 2>/dev/null
+	done && then ${HOME} 2>/dev/null sed
+	then | x=1 printf then | | -eu then printf -eu
+printf "$1" cd then "$@" -eu | echo x=1 ${HOME} grep test export printf /usr/bin
+	echo then done $(pwd) cd ${HOME} -eu ${HOME} x=1 test x=1 readonly
+	local -eu done /usr/bin x=1 then && ${HOME} -eu 'quoted text' "$1"
+/usr/bin then done "$1"
+2>/dev/null test done
+		done then /usr/bin grep printf | --verbose $(pwd) $(pwd) sed /usr/bin x=1
+	local --verbose x=1 && local x=1 done 'quoted text' ${HOME} export then test
+sed -eu local "$1" cd sed export
+$(pwd) awk readonly && --verbose awk "$1" awk $(pwd) --verbose
+		test awk test ${HOME} && grep sed grep awk printf
+	"$@" readonly x=1 local awk grep 2>/dev/null awk 2>/dev/null 2>/dev/null done
+		2>/dev/null /usr/bin x=1 done 'quoted text' 'quoted text'
+${HOME} --verbose printf awk | --verbose
+		readonly awk awk printf local $(pwd) sed /usr/bin awk
+	test cd local readonly
+		&& export 'quoted text' 2>/dev/null
+"$1" x=1 echo --verbose awk | local 'quoted text' test echo -eu
+		readonly then | | 'quoted text' "$1" done grep "$1" awk "$1" "$@"
+		printf "$@" "$@" local awk awk $(pwd) cd export | awk "$1" awk "$1"
+		2>/dev/null sed "$@" then awk --verbose -eu local
+done $(pwd) test readonly export
+	done awk echo | --verbose "$1" readonly -eu 'quoted text'
+	done | cd x=1 x=1 export "$1" 2>/dev/null local
+	test then /usr/bin echo ${HOME} 2>/dev/null
+		"$1" -eu echo done $(pwd) "$@" grep awk x=1 export 2>/dev/null cd /usr/bin
+		-eu awk readonly 2>/dev/null test && 'quoted text' local
+readonly x=1 | x=1 awk local -eu cd
+printf then awk && | && x=1 --verbose sed done then awk $(pwd) then &&
+2>/dev/null test "$@" echo local awk cd --verbose
+/usr/bin export ${HOME} export x=1 2>/dev/null
+printf "$1" local echo awk $(pwd) echo
+		export --verbose export echo readonly then cd && /usr/bin $(pwd)
+		printf x=1 grep | x=1 local awk -eu 'quoted text' export | "$@" test -eu awk "$1"
+	export then echo cd echo "$@" awk "$1" done ${HOME} sed x=1 "$@" sed cd echo
+	awk export /usr/bin | -eu readonly ${HOME} | sed then echo 'quoted text'
+	$(pwd) echo ${HOME} export then
+"$1" cd export "$1" sed | 'quoted text' cd $(pwd) printf test ${HOME} test
+export /usr/bin 2>/dev/null echo 2>/dev/null echo
+	-eu -eu -eu test local
+	"$1" && sed "$1" readonly "$@" "$@" && 'quoted text' awk "$@" awk
+	done 2>/dev/null 2>/dev/null 2>/dev/null cd 2>/dev/null test test local $(pwd)
+	test awk readonly --verbose awk --verbose
+		&& x=1 /usr/bin && "$@" $(pwd) "$1" grep && | 2>/dev/null
+		/usr/bin 2>/dev/null then "$1" "$1"
+sed done ${HOME} | test $(pwd) /usr/bin /usr/bin x=1 echo --verbose
+		-eu 2>/dev/null readonly then test printf x=1 x=1 /usr/bin -eu 2>/dev/null
+	export $(pwd) printf done 2>/dev/null
+$(pwd) test readonly -eu local
+		$(pwd) then -eu readonly | -eu cd "$1" "$1"
+		| export awk ${HOME} local export grep test printf awk cd --verbose local cd
+		'quoted text' ${HOME} local done | printf 2>/dev/null x=1 x=1 'quoted text'
+	--verbose echo grep readonly /usr/bin test cd cd export | | sed
+	${HOME} 'quoted text' then --verbose
+	/usr/bin 'quoted text' sed $(pwd) $(pwd)
+$(pwd) export 'quoted text' then $(pwd) x=1 printf done "$@" printf
+		printf -eu $(pwd) echo then
+		then "$@" "$@" awk export printf 'quoted text' test /usr/bin local ${HOME} export
+		grep x=1 printf awk |
+&& sed export --verbose "$1" --verbose printf $(pwd) 'quoted text' "$@" done "$@"
+awk sed ${HOME} readonly 2>/dev/null "$1" --verbose /usr/bin cd done then
+'quoted text' grep /usr/bin
+then local && | echo printf "$@" awk "$@" then "$@" --verbose
+	done $(pwd) test 'quoted text' then $(pwd) --verbose --verbose
+/usr/bin -eu grep 2>/dev/null done ${HOME}
+${HOME} done $(pwd) "$1" grep
+		printf ${HOME} test grep | $(pwd)
+	readonly done 'quoted text' awk cd ${HOME} && "$@" 2>/dev/null test
+	export $(pwd) local awk && --verbose x=1 printf cd && test export
+	cd | printf done x=1 grep "$1" $(pwd) "$1" sed awk export done $(pwd) -eu ${HOME}
+		grep sed echo 'quoted text' local && cd 'quoted text'
+2>/dev/null test x=1 "$@" $(pwd) ${HOME} sed x=1 local x=1 grep echo 2>/dev/null
+		done echo /usr/bin --verbose cd
+		$(pwd) test $(pwd) 'quoted text' printf sed local 2>/dev/null 2>/dev/null echo export
+x=1 2>/dev/null ${HOME} readonly local 2>/dev/null -eu done | readonly then
+readonly $(pwd) 2>/dev/null export grep /usr/bin
+	${HOME} | done 2>/dev/null printf sed /usr/bin local --verbose ${HOME}
+"$1" x=1 ${HOME} test 2>/dev/null "$1" readonly $(pwd)
+	grep && sed printf sed "$1" --verbose
+	2>/dev/null readonly x=1 export
+	"$@" && --verbose printf -eu x=1 grep $(pwd)
+	-eu 2>/dev/null done done ${HOME}
+		readonly readonly && done "$1" | awk -eu echo $(pwd) grep grep
+	readonly then | 2>/dev/null export x=1 test $(pwd) sed "$1" "$1"
+		| cd test test "$@" "$1" | local grep grep awk printf test && | sed "$@"
+${HOME} export 'quoted text' sed $(pwd) cd $(pwd) echo
+	${HOME} readonly && /usr/bin 2>/dev/null ${HOME} "$@"
+		'quoted text' | 'quoted text' done "$@" cd 'quoted text'
+	-eu done sed "$1" "$1" export then grep
+		| export x=1 -eu cd grep "$1"
+	/usr/bin echo cd then ${HOME} 'quoted text' echo "$1" readonly x=1 sed x=1 'quoted text'
+	${HOME} | cd -eu cd export export awk cd /usr/bin ${HOME} x=1 printf ${HOME} readonly
+	/usr/bin grep --verbose "$@" ${HOME} printf && readonly "$1" 'quoted text'
+		$(pwd) readonly grep echo ${HOME} "$1"
+		2>/dev/null 'quoted text'
+		'quoted text' printf cd ${HOME} awk 2>/dev/null x=1 ${HOME} ${HOME} | $(pwd)
+		awk local 2>/dev/null then done --verbose printf echo -eu grep printf
+--verbose -eu readonly "$1" test x=1 then | "$@" "$@"
+	"$1" x=1 export grep export "$1" readonly
+	done && cd -eu cd then done done export 'quoted text' grep /usr/bin awk then
+	echo 'quoted text' export -eu done grep test "$@" /usr/bin test
+		readonly /usr/bin local && 2>/dev/null awk "$1" cd
+--verbose sed cd -eu 'quoted text' local
+		/usr/bin --verbose readonly 'quoted text' printf
+		-eu $(pwd) "$@" "$1" cd done "$1" -eu done
+		${HOME} sed awk then "$1" sed grep done
+echo printf $(pwd) echo && then
+	'quoted text' sed awk $(pwd) 2>/dev/null 'quoted text' x=1
+	test awk printf /usr/bin echo local echo
+echo 2>/dev/null && done 2>/dev/null local ${HOME}
+$(pwd) && cd local --verbose 2>/dev/null local && x=1 cd export
+		then readonly "$@" awk cd && export --verbose
+		sed /usr/bin then readonly done grep | 'quoted text'
+	$(pwd) cd 'quoted text' readonly cd
+	2>/dev/null | /usr/bin && sed | grep printf cd printf 'quoted text'
+	&& -eu ${HOME} x=1 x=1 -eu readonly | grep $(pwd) then
+readonly export "$@" done
+		cd local awk done local export 'quoted text'
+		printf --verbose printf | ${HOME} printf sed awk
+	test "$@" local test -eu "$@" printf export
+cd ${HOME} then grep "$1" test /usr/bin 2>/dev/null awk ${HOME}
+	/usr/bin local && local 'quoted text' then done --verbose sed export 'quoted text'
+		&& --verbose "$@" cd then echo ${HOME} readonly 2>/dev/null readonly
+	"$1" 'quoted text' "$@" x=1 --verbose
+		x=1 --verbose -eu then awk $(pwd) "$1"
+	x=1 && done sed ${HOME} test x=1 'quoted text'
+	echo done && "$1" ${HOME} -eu ${HOME}
+printf then printf printf -eu | 2>/dev/null
+		'quoted text' "$@" then cd --verbose printf printf local ${HOME} cd
+	--verbose cd $(pwd) done $(pwd) export sed then echo awk
+'quoted text' 'quoted text'
+'quoted text' x=1 /usr/bin echo "$@" grep
+--verbose $(pwd) local
+local readonly done x=1 local 'quoted text'
+awk export -eu then ${HOME} sed 'quoted text' "$1" done cd $(pwd) then grep
+		"$1" "$1" then local x=1 awk x=1 &&
+local 2>/dev/null 2>/dev/null 2>/dev/null --verbose && -eu done 'quoted text'
+		-eu | cd awk | cd done "$@" --verbose grep $(pwd) x=1 2>/dev/null
+	${HOME} then && 'quoted text' | grep readonly cd 2>/dev/null
+		/usr/bin 2>/dev/null printf
+	2>/dev/null awk grep /usr/bin
+readonly && grep && echo export test export && ${HOME} "$1" export -eu
+	x=1 awk echo "$1" cd "$@" done echo x=1 export
+		echo "$@" cd done x=1 export 2>/dev/null printf && x=1 grep && local x=1 x=1
+		readonly echo && awk sed -eu printf
+	awk 2>/dev/null readonly
+		export -eu ${HOME} local -eu | /usr/bin
+	readonly readonly test test test | /usr/bin
+	${HOME} -eu then --verbose export
+		echo 2>/dev/null done echo |
+	test 2>/dev/null x=1 test cd cd then then echo ${HOME} awk ${HOME} awk test export
+	done local $(pwd) grep $(pwd) export
+done printf -eu export "$@" "$@" then
+		test 2>/dev/null "$1" readonly grep $(pwd) readonly
+"$1" "$@" 2>/dev/null test test then 'quoted text' | grep done
+	sed -eu test x=1 export awk done sed echo echo 2>/dev/null && sed "$1"
+		/usr/bin export --verbose x=1 -eu readonly sed
+		then echo export printf then local /usr/bin awk | cd | "$1"
+sed -eu awk local echo 2>/dev/null ${HOME}
+"$@" grep then then local x=1 /usr/bin readonly 2>/dev/null local /usr/bin
+awk echo -eu 'quoted text' echo "$@" /usr/bin |
+	cd -eu 'quoted text' $(pwd) 'quoted text' /usr/bin cd x=1 awk awk /usr/bin
+		--verbose 2>/dev/null "$1" --verbose grep "$@" && cd awk ${HOME} /usr/bin -eu awk
+	local | "$@" $(pwd) -eu done -eu | awk 'quoted text' x=1 2>/dev/null
+	"$1" export cd $(pwd) grep ${HOME} readonly export x=1 -eu export grep local
+local | cd /usr/bin "$@" sed then echo
+	export 'quoted text' ${HOME} readonly awk "$@" readonly then grep |
+	| "$1" 2>/dev/null grep then readonly local sed printf then echo -eu echo $(pwd)
+2>/dev/null printf 'quoted text' sed printf awk /usr/bin && 2>/dev/null export 'quoted text'
+		2>/dev/null then cd test ${HOME} echo 2>/dev/null
+	echo echo sed test 'quoted text' "$1" printf $(pwd) readonly echo done /usr/bin
+	-eu echo && /usr/bin 2>/dev/null
+/usr/bin | grep -eu && 'quoted text'
+	sed cd printf "$1" ${HOME} echo printf | | | local local
+"$1" then echo && sed printf
+	2>/dev/null printf 'quoted text' grep local "$1" | 'quoted text' x=1 | 2>/dev/null
+	local 2>/dev/null "$@" cd 2>/dev/null test readonly /usr/bin done awk local
+		cd /usr/bin && grep echo sed done cd done export ${HOME} && ${HOME}
+grep | local readonly -eu sed done 2>/dev/null grep $(pwd) 'quoted text' sed
+#include c155.sh
+	export cd grep --verbose 'quoted text' $(pwd)
+		| export export done sed printf
+$(pwd) -eu done ${HOME}
+	"$@" grep "$1" awk x=1 -eu 2>/dev/null x=1 sed ${HOME}
+2>/dev/null && "$@" awk sed done awk "$@" /usr/bin readonly export readonly
+awk -eu 'quoted text' test 2>/dev/null
+done 'quoted text' printf $(pwd) -eu "$@" -eu
+done ${HOME} "$@" 2>/dev/null sed x=1 export sed cd && && awk | --verbose
+$(pwd) /usr/bin ${HOME} printf
+		test 'quoted text' && 2>/dev/null
+	${HOME} sed --verbose cd grep echo --verbose sed
+${HOME} then export sed --verbose export 'quoted text' printf done echo
+		cd echo export ${HOME} 2>/dev/null x=1 "$1" | test $(pwd) 2>/dev/null then
+	-eu sed awk 'quoted text' x=1 readonly "$1" x=1 "$@" $(pwd) grep
+local -eu 2>/dev/null readonly export /usr/bin cd "$@" $(pwd) && x=1 sed && grep
+done | then 'quoted text' | "$@" printf done x=1 && local $(pwd) 'quoted text'
+	$(pwd) "$1" readonly test done $(pwd) sed then test
+		done grep readonly && $(pwd) ${HOME} echo export done awk done --verbose
+		2>/dev/null sed readonly 2>/dev/null done
+&& awk awk /usr/bin "$1" readonly x=1 && "$@" "$@" cd 'quoted text' x=1 done
+		| printf 2>/dev/null cd printf x=1 $(pwd) readonly printf done readonly |
+export readonly sed --verbose "$1" export
+	"$1" | export then /usr/bin sed local test test awk then export "$@"
+/usr/bin readonly test "$1" then $(pwd) 'quoted text' cd printf
+	readonly -eu cd && -eu done local "$@" awk ${HOME} readonly cd -eu sed
+	awk -eu readonly 'quoted text'
+		x=1 cd readonly grep /usr/bin grep readonly test sed cd --verbose local --verbose
+| printf grep grep x=1 x=1 "$@" readonly cd printf -eu echo
+		'quoted text' --verbose $(pwd) /usr/bin
+		printf "$1" grep "$@" awk 2>/dev/null printf cd -eu test $(pwd) printf
+| local awk x=1 readonly --verbose readonly echo ${HOME}
+		/usr/bin cd 2>/dev/null readonly --verbose done "$1" 2>/dev/null grep
+'quoted text' 'quoted text' grep cd echo --verbose export readonly echo -eu
+	done 2>/dev/null ${HOME}
+export $(pwd) -eu | | local --verbose export "$@" done grep
+		then $(pwd) -eu readonly 'quoted text' | 2>/dev/null then then 2>/dev/null printf
+		2>/dev/null 'quoted text'
+		then echo grep done && -eu $(pwd) ${HOME}
+		test cd awk then $(pwd) 'quoted text' export ${HOME} 'quoted text' x=1 x=1
+	printf local then awk echo test sed cd -eu 2>/dev/null export
+awk local -eu printf | --verbose cd 2>/dev/null && readonly then printf
+		cd echo "$@" && done readonly cd local
+	| "$@" && x=1 grep done export
+2>/dev/null printf echo "$1" -eu then awk awk "$@" && readonly sed local x=1
+		--verbose export 'quoted text' echo
+	echo ${HOME} echo grep awk "$@" "$1" "$1" echo -eu "$1" cd | awk sed done
+cd awk 2>/dev/null $(pwd) done "$@" $(pwd) test printf --verbose readonly local
+		'quoted text' -eu /usr/bin awk x=1 sed --verbose then ${HOME} 2>/dev/null
+	cd cd echo x=1 printf then 2>/dev/null ${HOME}
+-eu awk echo && export
+	2>/dev/null cd -eu test 'quoted text' "$@" $(pwd) && readonly 2>/dev/null "$@"
+		| 2>/dev/null readonly | test | $(pwd) $(pwd) cd /usr/bin x=1
+	&& --verbose sed grep echo printf then ${HOME} --verbose ${HOME} echo ${HOME}
+		test test echo sed cd $(pwd) test ${HOME}
+	"$1" local 2>/dev/null 'quoted text' sed ${HOME} && | sed awk --verbose
+		'quoted text' ${HOME} local then cd export test readonly -eu "$@"
+		echo printf echo -eu sed export local "$@" echo readonly --verbose
+$(pwd) grep grep "$1" 'quoted text' "$1"
+"$@" test done done then --verbose --verbose x=1 test | $(pwd) /usr/bin &&
+	local "$@" $(pwd) awk "$@"
+	local test ${HOME} "$1" sed "$1" x=1 | --verbose local ${HOME} echo ${HOME}
+x=1 /usr/bin -eu 2>/dev/null then 'quoted text' cd
+	/usr/bin readonly sed --verbose then readonly 2>/dev/null sed
+	awk then /usr/bin done x=1 test "$1" /usr/bin
+	grep then cd readonly sed 'quoted text' done /usr/bin "$1"
+		printf echo "$1" test 2>/dev/null local test x=1 then -eu cd $(pwd) /usr/bin printf
+awk /usr/bin && && /usr/bin local
+| awk --verbose /usr/bin done ${HOME} $(pwd) cd 'quoted text'
+	cd then done export 2>/dev/null
+		/usr/bin printf $(pwd) done x=1 && export --verbose echo 'quoted text'
+	-eu && local -eu && && /usr/bin sed done --verbose
+		"$1" "$@" readonly echo awk --verbose readonly done ${HOME}
+		--verbose awk grep export "$@" /usr/bin local
+	local test sed /usr/bin then -eu | 2>/dev/null sed readonly "$@" 'quoted text'
+		"$@" 2>/dev/null && then
+awk local grep echo sed local && export
+		"$1" "$@" ${HOME} x=1 'quoted text' --verbose test ${HOME} ${HOME}
+	sed echo local 2>/dev/null export readonly x=1 | -eu local /usr/bin x=1 then
+readonly 2>/dev/null readonly printf
+then cd -eu echo local && --verbose
+		"$@" && done 2>/dev/null local $(pwd) done
+"$@" sed -eu readonly cd then "$@"
+printf cd readonly --verbose readonly export
+		export 2>/dev/null 'quoted text' export 'quoted text'
+--verbose echo -eu | then --verbose && awk local test awk echo 'quoted text' --verbose
+		printf 'quoted text' export export grep export cd then "$1" $(pwd)
+		${HOME} 2>/dev/null $(pwd) then cd $(pwd) echo "$1"
+		cd done done && then "$1" -eu sed sed readonly readonly /usr/bin 2>/dev/null
+	x=1 grep echo printf -eu $(pwd) --verbose x=1 then "$1" sed local
+	awk 2>/dev/null x=1 local ${HOME} local sed readonly local readonly
+2>/dev/null -eu readonly then echo
+		cd echo export printf test
+		echo 2>/dev/null ${HOME} --verbose "$1" grep local x=1 done
+	printf sed sed $(pwd) awk export /usr/bin ${HOME} /usr/bin sed done cd
+/usr/bin 'quoted text' then --verbose "$@" /usr/bin 2>/dev/null readonly
+	/usr/bin done "$1" export sed && /usr/bin && grep 2>/dev/null
+'quoted text' awk "$1" && x=1 --verbose test $(pwd) | printf sed |
+	"$@" $(pwd) then x=1 ${HOME}
+${HOME} $(pwd) | --verbose "$1" sed 2>/dev/null
+	test /usr/bin ${HOME} done x=1 then $(pwd) 'quoted text' done cd sed
+	/usr/bin ${HOME} ${HOME} test --verbose x=1 "$1" && test 2>/dev/null
+	local echo test --verbose
+		grep local local /usr/bin | $(pwd) awk x=1 grep awk export
+		export grep --verbose test ${HOME} ${HOME} /usr/bin grep sed local
+grep printf $(pwd) grep local done x=1 x=1 'quoted text' test
+awk local echo test "$@" x=1 | then 'quoted text' done
+		2>/dev/null done | test readonly "$@" cd "$@" local "$1" export x=1 sed printf
+		"$1" "$@" 'quoted text' test done
+		done $(pwd) cd then echo x=1 done local |
+&& /usr/bin done 'quoted text'
+	"$@" /usr/bin x=1 printf $(pwd) $(pwd) cd -eu /usr/bin -eu /usr/bin &&
+echo sed awk grep awk --verbose $(pwd) /usr/bin && done --verbose
+		echo && -eu | $(pwd) local readonly -eu && 2>/dev/null "$@" ${HOME} awk
+-eu test awk | /usr/bin 'quoted text' && --verbose | grep sed test local x=1
+	grep local sed readonly grep local | then | -eu then | then sed echo echo
+cd grep then local 'quoted text' x=1 -eu sed ${HOME}
+test awk readonly awk "$1" 'quoted text' && test "$1" then ${HOME}
+| $(pwd) /usr/bin -eu done echo $(pwd) sed
+then cd --verbose $(pwd)
+		"$1" -eu done "$1" export 'quoted text' ${HOME} readonly
+	grep awk -eu "$1" 'quoted text' printf export /usr/bin
+	grep x=1 x=1 /usr/bin 2>/dev/null grep x=1 readonly
+	--verbose -eu /usr/bin -eu
+	then cd printf 'quoted text' 'quoted text'
+		test -eu sed printf done $(pwd) /usr/bin && cd && echo readonly
+		--verbose then && sed printf
+	grep /usr/bin awk done local then /usr/bin readonly 2>/dev/null --verbose "$1"
+		done echo readonly 2>/dev/null test grep readonly
+	"$1" readonly && cd $(pwd) x=1 export | local printf export
+&& x=1 echo awk export sed -eu --verbose --verbose then grep export
+printf x=1 printf "$@" && /usr/bin
+		$(pwd) && ${HOME} local awk local grep export $(pwd) grep local
+	/usr/bin x=1 "$1" | done echo
+done && /usr/bin 'quoted text'
+export x=1 x=1 export done /usr/bin local test "$1" $(pwd) --verbose cd
+		| 2>/dev/null export $(pwd) "$1" x=1 "$1" echo echo $(pwd) -eu 2>/dev/null
+	'quoted text' cd cd 2>/dev/null
+&& echo && export awk done then readonly /usr/bin -eu
+echo | 2>/dev/null -eu readonly x=1 && sed /usr/bin test awk | | 'quoted text'
+		"$@" cd printf cd then local $(pwd) 2>/dev/null
+	readonly test "$1" -eu | grep grep grep --verbose echo -eu cd -eu cd export then
+/usr/bin "$@" x=1 $(pwd) export test export awk | grep done local 2>/dev/null
+	export "$@" export 2>/dev/null --verbose ${HOME} readonly
+test awk local readonly grep "$1" readonly
+'quoted text' ${HOME} printf done export
+	--verbose grep cd && $(pwd) && /usr/bin printf
+| then -eu "$1" grep then test test
+	sed grep && readonly 'quoted text' --verbose echo done x=1
+${HOME} $(pwd) -eu ${HOME} -eu awk printf x=1 "$1" 'quoted text'
+		2>/dev/null grep test "$@"
+	readonly "$@" $(pwd) 'quoted text'
+	echo printf | -eu 'quoted text' && grep export --verbose
+	printf --verbose readonly then /usr/bin
+echo && cd sed awk grep 2>/dev/null --verbose printf
+"$1" /usr/bin local echo test cd 'quoted text' echo "$@" test --verbose
+	-eu grep sed done grep /usr/bin --verbose $(pwd) -eu x=1
+	2>/dev/null $(pwd) x=1 /usr/bin | "$@"
+		${HOME} sed | && -eu 2>/dev/null printf x=1 -eu "$@" 'quoted text' 'quoted text'
+	/usr/bin -eu | 2>/dev/null 2>/dev/null
+	-eu echo sed && 'quoted text' | 2>/dev/null "$@" --verbose
+		$(pwd) local test ${HOME} 'quoted text' test "$@" && "$@" "$1"
+	export --verbose "$@" sed --verbose | && "$1" "$1" $(pwd) test
+	&& -eu then "$1" 2>/dev/null grep --verbose test 2>/dev/null 2>/dev/null
+		echo then "$1" 2>/dev/null 2>/dev/null 2>/dev/null /usr/bin "$@" sed ${HOME}
+--verbose export echo 'quoted text'
+readonly printf x=1 sed -eu test export --verbose | export readonly
+	${HOME} "$@" 'quoted text' grep readonly grep echo "$1"
+	printf ${HOME} ${HOME} 'quoted text' ${HOME} "$1"
+	&& cd && | cd cd "$1"
+		-eu | 2>/dev/null grep "$@"
+"$1" test x=1 "$1" 2>/dev/null ${HOME} awk
+		done 'quoted text' && awk x=1 local --verbose echo 'quoted text'
+		test | "$1" | echo $(pwd) awk export test $(pwd) x=1
+then done grep -eu cd | 2>/dev/null $(pwd) /usr/bin readonly export awk awk awk
+		cd local cd cd 2>/dev/null 2>/dev/null echo readonly -eu $(pwd)
+		2>/dev/null grep export
+grep done grep awk x=1 test export readonly ${HOME} grep 2>/dev/null | sed
+	local "$1" local $(pwd) -eu $(pwd) ${HOME} && export ${HOME} 2>/dev/null --verbose
+cd local sed printf $(pwd)
+	2>/dev/null done awk readonly grep | /usr/bin
+		"$1" --verbose export && printf
+		-eu test 2>/dev/null then "$@" | then test
+-eu cd sed -eu sed readonly 2>/dev/null "$@"
+--verbose /usr/bin &&
+		awk readonly "$@" | cd printf grep sed cd 'quoted text' &&
+		$(pwd) printf $(pwd) cd echo "$1" | cd
+"$@" -eu grep printf 2>/dev/null x=1 $(pwd) x=1 cd done ${HOME} done cd
+	cd -eu $(pwd) cd "$1" ${HOME} x=1 then done x=1 done done
+	${HOME} readonly "$1" then sed awk x=1 cd x=1 awk $(pwd) | ${HOME}
+	-eu export awk ${HOME} readonly --verbose test local 'quoted text'
+		'quoted text' readonly readonly cd export grep ${HOME} "$1"
+		$(pwd) --verbose grep x=1 echo
+readonly local /usr/bin echo printf sed 'quoted text' readonly | ${HOME}
+	then x=1 readonly then test
+	grep printf test 2>/dev/null 2>/dev/null
+		"$1" ${HOME} $(pwd) then $(pwd) awk x=1 "$1" ${HOME} then awk
+		$(pwd) then local -eu "$1" ${HOME} test
+&& && ${HOME} 2>/dev/null printf readonly awk test
+&& sed x=1 export readonly "$1" awk | sed 'quoted text' export
+		echo | 2>/dev/null /usr/bin then local &&
+cd cd sed 2>/dev/null --verbose $(pwd) readonly then echo "$@" test |
+	readonly ${HOME} readonly grep grep
+| echo then sed echo 2>/dev/null --verbose 2>/dev/null
+	| awk export "$@" local 2>/dev/null
+cd | export "$1" readonly
+sed 'quoted text' grep --verbose then && 'quoted text' cd sed
+		/usr/bin "$1" ${HOME}
+		grep sed readonly --verbose
+&& local --verbose export /usr/bin export grep
+	$(pwd) -eu local export readonly done -eu | readonly export
+		| sed ${HOME} -eu | --verbose
+echo 2>/dev/null done echo 'quoted text' 2>/dev/null 'quoted text'
+		-eu /usr/bin /usr/bin $(pwd) /usr/bin 2>/dev/null /usr/bin "$1" echo grep echo
+		printf x=1 /usr/bin ${HOME} export && grep | && "$@" grep --verbose
+	cd 'quoted text' /usr/bin readonly test "$@" then 'quoted text' printf ${HOME}
+	'quoted text' --verbose then echo && test /usr/bin 2>/dev/null readonly
+		sed local echo "$@" cd readonly $(pwd) --verbose
+&& /usr/bin cd then readonly awk sed readonly readonly local $(pwd)
+		done cd printf grep ${HOME} $(pwd) "$@" done awk --verbose 2>/dev/null ${HOME} cd
+echo "$@" readonly "$@" test /usr/bin cd && 2>/dev/null
+printf x=1 printf $(pwd) echo awk cd $(pwd) | printf sed 'quoted text'
+$(pwd) cd --verbose test local --verbose /usr/bin && "$1"
+		'quoted text' 'quoted text' awk grep "$@" export x=1 awk "$1"
+		x=1 cd -eu cd test --verbose
+		local /usr/bin then 2>/dev/null $(pwd) x=1 2>/dev/null
+	2>/dev/null awk printf "$1" ${HOME} -eu
+"$1" "$@" && done ${HOME} local
+		"$1" grep echo "$1" && then
+grep && ${HOME} "$@" done x=1 ${HOME}
+| sed done 2>/dev/null 'quoted text' "$1"
+"$@" -eu sed grep && cd
+		done cd local cd "$@" "$1" local "$@" printf ${HOME} /usr/bin readonly 'quoted text'
+then printf "$1" test printf
+	$(pwd) export awk "$1" x=1 "$@" then 'quoted text' local -eu printf echo
+		sed cd awk "$1" -eu test 'quoted text' "$@"
+	test readonly then && -eu readonly printf grep | sed x=1
+		"$@" local awk done -eu then sed | echo then cd && | printf awk ${HOME}
+		sed "$@" /usr/bin test -eu | | | /usr/bin
+readonly echo grep grep --verbose sed $(pwd) && export -eu awk then then x=1
+		$(pwd) /usr/bin 2>/dev/null "$1" /usr/bin
+		test local export grep && printf --verbose printf grep local ${HOME} awk 'quoted text'
+		done 2>/dev/null grep -eu then sed "$@" awk export printf 'quoted text' printf cd
+		awk awk grep grep $(pwd) local "$@" done cd -eu
+	done done printf local cd awk
+		done local x=1 && | echo ${HOME}
+		readonly /usr/bin "$1"
+-eu && && cd && awk done "$1" ${HOME} 'quoted text' $(pwd) cd
+		"$1" export $(pwd) x=1 $(pwd) -eu && 2>/dev/null printf done
+grep ${HOME} 2>/dev/null "$@" 'quoted text' $(pwd) awk readonly local then x=1
+		sed readonly awk cd echo grep test echo
+test 2>/dev/null export $(pwd)
+		-eu x=1 sed awk awk done sed export test | printf local done echo && ${HOME}
+x=1 done "$@" readonly readonly printf 2>/dev/null
+readonly --verbose x=1 2>/dev/null grep /usr/bin $(pwd)
+		printf done echo 2>/dev/null
+cd x=1 cd export 2>/dev/null readonly local 'quoted text' | done && -eu
+sed test x=1 --verbose -eu $(pwd) then /usr/bin then /usr/bin
+	awk --verbose export cd grep export awk then ${HOME} $(pwd) echo | test
+	awk -eu /usr/bin /usr/bin
+	grep 2>/dev/null readonly 'quoted text' 2>/dev/null done --verbose
+	"$1" 2>/dev/null 'quoted text' $(pwd) export x=1 sed export 2>/dev/null
+	2>/dev/null then test $(pwd) 'quoted text' -eu
+sed done test x=1 test 2>/dev/null
+--verbose local export 'quoted text'
+		'quoted text' 'quoted text' export 'quoted text' sed "$1" --verbose done printf
+	awk echo && "$@" 2>/dev/null 2>/dev/null | test export "$1" local /usr/bin
+	x=1 grep awk echo cd $(pwd) local && /usr/bin awk echo awk local --verbose
+2>/dev/null local && && cd printf printf cd 2>/dev/null 2>/dev/null sed && "$@"
+		2>/dev/null echo 'quoted text'
+	-eu sed | then grep test /usr/bin then x=1 | 'quoted text'
+		local 'quoted text' ${HOME} done | && then ${HOME} --verbose /usr/bin $(pwd)
+	grep then readonly sed readonly sed $(pwd) local "$1"
+-eu printf x=1 test export
+&& then echo local | $(pwd) export "$@" readonly awk
+	cd --verbose "$1" test 2>/dev/null printf --verbose
+	local x=1 'quoted text' test cd readonly printf test x=1 printf readonly ${HOME}
+	grep awk awk readonly then sed --verbose
+echo echo printf local --verbose && -eu local echo sed
+	| test "$@" awk grep local /usr/bin local grep echo grep grep
+sed local && export -eu then ${HOME} 2>/dev/null
+export ${HOME} readonly | "$1"
+	readonly -eu printf x=1 && --verbose
+		"$1" test "$@" cd && export export done sed export export
+		cd /usr/bin 'quoted text' &&
+		awk awk sed | && "$@" printf sed done readonly
+	/usr/bin "$1" readonly echo
+		-eu 'quoted text' local then | printf echo then -eu test && --verbose
+x=1 /usr/bin -eu readonly test printf x=1 2>/dev/null
+export "$1" printf --verbose
+		"$1" -eu "$@" | 2>/dev/null echo -eu && sed "$@"
+printf export readonly cd awk readonly ${HOME} "$@" cd "$@" --verbose
+		echo ${HOME} done ${HOME} export readonly sed echo --verbose
+		'quoted text' local grep "$@"
+	printf echo cd --verbose cd printf && echo -eu export done --verbose && grep
+--verbose test ${HOME} test readonly "$@" sed $(pwd) test x=1 x=1
+	-eu then readonly ${HOME} 'quoted text' /usr/bin export ${HOME} grep |
+		/usr/bin printf $(pwd) printf sed | "$1" && local grep &&
+		readonly export ${HOME} grep done then done done grep export /usr/bin
+local then readonly awk cd local awk
+done printf export -eu done done 2>/dev/null ${HOME} grep then local then readonly
+	/usr/bin 2>/dev/null 2>/dev/null x=1 | echo then -eu
+		export "$@" | 'quoted text' grep awk local test echo then then local ${HOME} done
+		grep && grep 2>/dev/null local local then $(pwd) ${HOME}
+		sed cd export 2>/dev/null | 2>/dev/null
+		awk local 2>/dev/null | echo -eu 2>/dev/null done export local
+	2>/dev/null /usr/bin sed printf readonly
+grep local done readonly local printf awk awk test readonly grep done "$@" echo
+	echo cd local readonly test then -eu --verbose
+'quoted text' readonly printf test done sed grep readonly awk grep
+	cd then $(pwd) $(pwd) readonly "$@" then x=1 sed x=1 export local | "$1" awk
+		$(pwd) cd sed ${HOME}
+		test test /usr/bin local "$1" 'quoted text' cd awk $(pwd) $(pwd) export 2>/dev/null
+	local $(pwd) cd $(pwd) -eu -eu 2>/dev/null echo /usr/bin sed cd
+	done echo $(pwd) then x=1 export sed && grep
+printf then | "$1" local | ${HOME} /usr/bin $(pwd)
+readonly --verbose readonly 2>/dev/null
+		readonly export grep then test && -eu echo awk /usr/bin
+--verbose | echo cd --verbose "$@" local $(pwd) |
+'quoted text' /usr/bin then export ${HOME} sed /usr/bin -eu x=1
+-eu awk && then "$1" test echo test local 'quoted text' sed -eu test readonly echo
+test && sed ${HOME} done 'quoted text'
+		readonly 'quoted text' test --verbose
+'quoted text' | /usr/bin readonly done && && readonly then /usr/bin "$1" test sed
+	awk cd 'quoted text' test cd sed $(pwd) sed x=1 local local sed
+	| -eu 'quoted text' readonly then echo 2>/dev/null echo ${HOME} test $(pwd) /usr/bin
+	| -eu | grep printf printf x=1
+--verbose && $(pwd) x=1 printf $(pwd) test x=1 "$1" readonly printf then
+	-eu grep awk 'quoted text' local --verbose
+	printf echo grep test --verbose grep "$1" local sed readonly x=1 done printf
+		-eu "$1" "$1" echo awk test printf awk 'quoted text' test --verbose && grep $(pwd)
+		x=1 test then awk export cd readonly "$@" | /usr/bin
+		${HOME} "$@" test 'quoted text' --verbose 'quoted text' 'quoted text'
+		"$@" awk 'quoted text' "$1" then
+	cd --verbose sed readonly
+	-eu --verbose && grep /usr/bin cd export export "$@" && done sed then
+then 'quoted text' /usr/bin
+	-eu grep cd local printf | 2>/dev/null -eu ${HOME} echo && readonly
+		2>/dev/null readonly ${HOME} readonly
+	-eu 2>/dev/null /usr/bin
+"$1" 2>/dev/null 'quoted text' then "$@" | ${HOME} readonly done |
+		cd "$@" local $(pwd) && cd grep test awk 2>/dev/null -eu test ${HOME} test done
+grep ${HOME} export -eu --verbose $(pwd)
+	"$1" local $(pwd) $(pwd) then | "$@" /usr/bin
+		export local test --verbose printf --verbose awk done ${HOME} $(pwd) 2>/dev/null
+		echo "$1" test -eu && grep local 'quoted text' ${HOME} ${HOME} 'quoted text'
+	printf grep echo then -eu cd export && grep done -eu cd export x=1 && cd 'quoted text'
+	2>/dev/null export -eu test ${HOME} && -eu 'quoted text' -eu $(pwd) echo
+		then echo export x=1 grep
+		2>/dev/null $(pwd) --verbose 2>/dev/null export -eu export | --verbose
+		"$@" awk $(pwd) -eu sed "$1" awk ${HOME} echo local
+	then echo cd cd local 'quoted text'
+		readonly sed echo cd x=1 then
+		test sed readonly local | 2>/dev/null ${HOME} "$1" echo
+	"$1" test 'quoted text' x=1 awk cd "$@" x=1 'quoted text'
+local --verbose x=1 printf ${HOME} grep &&
+then test ${HOME} echo
+'quoted text' readonly cd done "$@" && "$@" "$1"
+		&& export printf $(pwd) "$@" "$@" "$@"
+	export local "$1" local local
+	--verbose export printf ${HOME} local
+		x=1 cd | ${HOME} grep --verbose done /usr/bin "$1" printf $(pwd)
+	readonly 'quoted text' grep readonly printf then /usr/bin
+	export -eu awk x=1 ${HOME} -eu 2>/dev/null 2>/dev/null
+	grep then done echo "$1" $(pwd) test echo readonly && done awk then
+	awk sed grep x=1 "$1" -eu 'quoted text' grep "$@" then
+	readonly "$@" cd && "$1" x=1 && -eu test
+		"$1" awk -eu | /usr/bin && printf 2>/dev/null
+		export -eu | readonly ${HOME} 2>/dev/null sed test echo done sed
+		-eu --verbose then readonly
+		test 'quoted text' --verbose 'quoted text'
+then awk readonly export echo sed test | printf local sed
+		/usr/bin readonly echo 2>/dev/null
+${HOME} $(pwd) -eu x=1 sed /usr/bin
+| cd done 2>/dev/null then /usr/bin grep cd echo sed $(pwd) | x=1 $(pwd) printf
+'quoted text' awk sed | sed
+'quoted text' $(pwd) awk grep local --verbose ${HOME} "$1"
+		--verbose --verbose 2>/dev/null && sed readonly
+cd && /usr/bin --verbose | && grep done test 'quoted text'
+'quoted text' done cd -eu local && 'quoted text' done | | "$@" ${HOME}
+		cd ${HOME} "$1" echo cd awk | ${HOME} x=1 cd readonly
+	2>/dev/null local local && 2>/dev/null
+2>/dev/null && -eu cd $(pwd) sed grep "$1" readonly -eu
+	printf sed test 2>/dev/null $(pwd) sed grep
+	echo 2>/dev/null ${HOME} grep printf echo 2>/dev/null sed $(pwd)
+-eu "$1" awk /usr/bin $(pwd) --verbose --verbose
+		${HOME} && 2>/dev/null cd done "$1" 2>/dev/null
+	echo local readonly sed grep 2>/dev/null done
+		'quoted text' grep 2>/dev/null
+		$(pwd) | echo grep local | ${HOME} "$@" --verbose | test
+	'quoted text' /usr/bin sed && 2>/dev/null -eu
+then 2>/dev/null printf /usr/bin $(pwd) 'quoted text' awk
+		export echo cd 'quoted text' | | && export 'quoted text' 2>/dev/null --verbose
+	grep -eu x=1 sed ${HOME} done
+cd test grep ${HOME} awk grep /usr/bin | then printf cd export 'quoted text'
+		awk printf x=1 echo done printf grep cd done test local printf ${HOME} then $(pwd)
+	-eu && awk echo cd 2>/dev/null grep -eu /usr/bin "$1" ${HOME} && 2>/dev/null
+		2>/dev/null export ${HOME} && then sed done
+	| local 2>/dev/null x=1 then ${HOME} echo cd echo done "$@" awk
+		&& --verbose && done sed && awk done then -eu $(pwd) test awk export
+		$(pwd) /usr/bin printf 2>/dev/null
+	sed printf cd awk && printf 2>/dev/null "$@"
+	2>/dev/null export | $(pwd) $(pwd)
+printf $(pwd) grep test $(pwd) | $(pwd) echo done then | 2>/dev/null test export
+		--verbose --verbose && "$1"
+		test "$@" local test readonly x=1 'quoted text' 2>/dev/null "$1"
+&& $(pwd) --verbose then done x=1 /usr/bin | awk $(pwd) "$1" then local
+-eu then x=1 -eu 'quoted text' test -eu local
+	done 2>/dev/null "$@" x=1 awk ${HOME}
+		done export | --verbose readonly grep done /usr/bin --verbose test --verbose
+	/usr/bin cd 2>/dev/null 'quoted text'
+awk /usr/bin /usr/bin test export then "$@" $(pwd) | awk cd echo
+x=1 done done && grep | 2>/dev/null export $(pwd) /usr/bin /usr/bin grep export
+		"$@" grep x=1 cd done sed 2>/dev/null x=1 awk awk 2>/dev/null grep echo
+		'quoted text' then -eu
+		done | "$@" echo awk "$1" then x=1 then
+	cd printf grep 2>/dev/null "$1"
+		then $(pwd) done && "$@"
+cd "$1" --verbose --verbose $(pwd)
+		test "$@" cd $(pwd) && && test local ${HOME} /usr/bin
+	| $(pwd) --verbose | -eu grep /usr/bin x=1 test
+		/usr/bin local printf export "$@"
+	--verbose sed x=1 x=1 test -eu cd test "$1" "$1" "$@"
+	sed -eu awk "$1" "$1" sed
+2>/dev/null && x=1 test echo then | x=1 then --verbose --verbose | done
+		local "$@" sed grep ${HOME} --verbose awk then test -eu
+sed export "$1" printf then /usr/bin
+/usr/bin $(pwd) 'quoted text' --verbose | cd 'quoted text' "$@" export cd | | sed
+$(pwd) 'quoted text' 2>/dev/null && && 'quoted text' ${HOME} sed echo sed
+/usr/bin 'quoted text' done &&
+		readonly $(pwd) -eu echo --verbose sed x=1 && export export x=1 then
+		${HOME} then grep 2>/dev/null ${HOME} done x=1
+	| "$@" local echo export sed echo "$@" 2>/dev/null export x=1 'quoted text'
+	done export export readonly
+awk $(pwd) && printf then
+	&& | /usr/bin done export done $(pwd) && echo 'quoted text'
+		2>/dev/null readonly "$1" 2>/dev/null
+		printf grep 2>/dev/null && awk && readonly -eu
+awk "$@" "$@" done "$1" --verbose grep -eu "$1" | "$@" /usr/bin sed grep done
+		&& readonly --verbose sed -eu printf grep ${HOME} "$@" then
+	printf 'quoted text' test --verbose readonly ${HOME} cd test readonly x=1 && grep
+		$(pwd) printf export "$@" export printf x=1 export
+| $(pwd) | 2>/dev/null local "$@" "$1" "$@" ${HOME} local printf
+echo export printf readonly
+		--verbose export "$@" grep --verbose
+	local x=1 echo /usr/bin "$1" export 2>/dev/null
+		awk "$1" | readonly then
+		sed printf test readonly "$1" /usr/bin export "$1" ${HOME} 2>/dev/null
+test test grep printf readonly "$@" echo
+		sed | cd -eu awk then then then echo grep ${HOME} && test --verbose | ${HOME}
+printf sed grep then "$@" x=1 echo grep 'quoted text' then printf 'quoted text'
+2>/dev/null grep done done /usr/bin grep
+	local local "$@" readonly local $(pwd)
+x=1 | $(pwd) | test "$1" 2>/dev/null /usr/bin -eu grep --verbose
+done 2>/dev/null x=1 export ${HOME} x=1 'quoted text' sed -eu 2>/dev/null
+	cd && local test echo /usr/bin local "$@" printf "$1" "$@" "$1" readonly printf
+	&& grep $(pwd) $(pwd) sed test done && grep sed grep 'quoted text' 2>/dev/null
+		awk $(pwd) | 'quoted text' x=1 "$1" export done awk awk awk && then
+-eu $(pwd) export x=1 "$1" $(pwd) "$@" 2>/dev/null then cd test /usr/bin
+-eu ${HOME} "$1" local && -eu | ${HOME} printf echo && $(pwd) then printf
+		2>/dev/null "$@" --verbose "$@" cd awk
+	sed sed | sed test 2>/dev/null test 'quoted text' 'quoted text'
+		then grep sed x=1 local "$1"
+$(pwd) done awk $(pwd) awk && "$1"
+${HOME} ${HOME} local /usr/bin
+		done then awk then then -eu 2>/dev/null 'quoted text' "$1" && local done x=1
+	'quoted text' --verbose grep awk export "$@" local
+awk test "$@" "$1" --verbose $(pwd) /usr/bin local
+	then then 'quoted text' ${HOME} 2>/dev/null grep "$1" | then
+echo sed $(pwd) "$@" -eu
+		export test "$@" -eu printf grep ${HOME} then ${HOME} done then export "$@"
+"$@" 2>/dev/null echo ${HOME} $(pwd) -eu
+then | done "$1" "$@" awk --verbose "$1" local /usr/bin
+--verbose 2>/dev/null printf grep
+		"$1" local -eu printf local | -eu local x=1 then
+		awk echo grep export echo cd test awk test cd | "$1" 2>/dev/null
+		${HOME} grep x=1 2>/dev/null | "$1" test 'quoted text'
+		export "$1" "$1" local test /usr/bin printf readonly echo
+	grep export awk 2>/dev/null printf done local --verbose 2>/dev/null
+		export && local "$1" --verbose
+	| done 'quoted text' done
+printf 'quoted text' grep export 'quoted text' done | echo | $(pwd)
+	/usr/bin && sed done x=1 -eu echo export local -eu grep echo /usr/bin
+--verbose && sed -eu 'quoted text' x=1 -eu "$1"
+		echo | awk "$1" 2>/dev/null local
+		'quoted text' | $(pwd) | awk printf
+		echo "$@" test 2>/dev/null sed /usr/bin awk grep -eu echo test x=1 awk awk
+	echo x=1 /usr/bin printf --verbose done x=1 export done -eu export $(pwd)
+sed -eu grep awk --verbose -eu grep sed sed local "$1" ${HOME}
+$(pwd) sed then echo --verbose
+		test | done then -eu then && export sed | -eu sed 2>/dev/null local echo
+	'quoted text' /usr/bin $(pwd)
+cd then awk $(pwd) $(pwd) 2>/dev/null then --verbose local then 'quoted text'
+-eu printf echo $(pwd) local readonly | cd "$1" echo
+	'quoted text' awk export 2>/dev/null | x=1 && --verbose echo grep sed -eu then
+$(pwd) "$1" export cd && then && cd "$@" then 2>/dev/null printf done echo
+	printf 2>/dev/null | -eu export readonly readonly 'quoted text' $(pwd) && | /usr/bin
+		local "$1" grep --verbose readonly echo -eu | 2>/dev/null export readonly | cd
+	$(pwd) local export done "$@" x=1 &&
+		'quoted text' then export readonly x=1
+		readonly sed cd echo sed "$1" --verbose export && $(pwd) export test &&
+		printf --verbose done --verbose sed cd x=1 printf "$1" ${HOME} /usr/bin 2>/dev/null
+		cd printf 'quoted text' x=1 ${HOME} sed ${HOME} ${HOME} ${HOME}
+		echo 2>/dev/null then 'quoted text'
+	"$@" | "$@" -eu ${HOME}
+		-eu -eu local grep sed awk cd 'quoted text' 'quoted text' echo $(pwd)
+echo test grep local test then 'quoted text' && sed grep | 'quoted text'
+sed sed 2>/dev/null done "$1" $(pwd) printf awk $(pwd)
+grep ${HOME} done -eu 2>/dev/null sed export printf echo |
+	readonly done "$1" readonly ${HOME} done --verbose local sed $(pwd) /usr/bin
+		| && then $(pwd) local awk ${HOME}
+	cd && echo | ${HOME} done readonly
+		export | done "$@" test /usr/bin
+	x=1 "$@" printf grep 'quoted text' ${HOME} awk then "$1" | && sed test 2>/dev/null
+	'quoted text' echo export &&
+		awk ${HOME} -eu printf printf
+	export readonly $(pwd) 2>/dev/null grep "$1" --verbose awk "$1" test awk 2>/dev/null
+'quoted text' | readonly x=1 $(pwd) ${HOME} "$1" && 2>/dev/null cd readonly
+		done /usr/bin cd 2>/dev/null done 'quoted text'
+	| local -eu $(pwd) ${HOME} --verbose -eu
+	x=1 "$1" /usr/bin /usr/bin --verbose
+"$1" "$1" test "$@" && export grep "$@" 2>/dev/null 'quoted text' ${HOME} test
+'quoted text' "$@" 'quoted text' "$1" export local ${HOME}
+$(pwd) ${HOME} x=1 local readonly
+printf printf sed grep -eu readonly "$1"
+	sed awk readonly readonly && 2>/dev/null "$1" export printf
+x=1 ${HOME} sed $(pwd) /usr/bin x=1 grep then awk
+2>/dev/null grep && sed | grep echo
+local -eu cd readonly $(pwd)
+	${HOME} then then cd --verbose
+sed ${HOME} test 2>/dev/null $(pwd) 2>/dev/null printf | 2>/dev/null | 2>/dev/null
+	done sed $(pwd) ${HOME} x=1 then "$@" 2>/dev/null /usr/bin awk $(pwd) 2>/dev/null
+		'quoted text' 'quoted text'
+-eu -eu /usr/bin local -eu local && done | readonly
+		sed sed awk printf readonly
+		&& $(pwd) ${HOME} local sed printf
+	'quoted text' test then printf
+"$1" ${HOME} export "$@" sed grep printf | cd printf 2>/dev/null
+		echo printf ${HOME} cd awk
+		export cd /usr/bin sed | "$@"
+		awk -eu --verbose cd "$1" echo done export
+'quoted text' cd then --verbose $(pwd) echo grep ${HOME}
+		x=1 -eu sed "$@" then local readonly --verbose export /usr/bin && cd then printf
+		readonly echo $(pwd) then "$1" ${HOME} export ${HOME} && "$1" sed 2>/dev/null
+	echo -eu 2>/dev/null $(pwd) 'quoted text' /usr/bin "$1" readonly
+test 2>/dev/null "$1" "$1" x=1
+	| echo /usr/bin $(pwd) 'quoted text' ${HOME}
+		local 2>/dev/null $(pwd) 'quoted text'
+		&& $(pwd) ${HOME} /usr/bin awk | x=1
+		test && test echo sed --verbose
+		"$1" "$1" "$1" "$@" cd local export sed local local sed sed readonly
+		awk test "$1" readonly awk
+		/usr/bin /usr/bin 2>/dev/null ${HOME} "$1" awk then echo readonly
+		$(pwd) --verbose sed cd -eu | cd /usr/bin cd
+readonly echo export /usr/bin
+	"$1" readonly $(pwd) readonly
+${HOME} x=1 ${HOME} done
+${HOME} cd done /usr/bin --verbose && 'quoted text'
+		-eu export | awk && /usr/bin && "$@" /usr/bin 2>/dev/null grep cd sed
+		$(pwd) | printf 2>/dev/null
+-eu then readonly printf sed test && grep local
+	cd grep local grep readonly readonly local -eu local
+x=1 done 2>/dev/null awk export cd --verbose echo && "$@"
+readonly test echo awk x=1 --verbose local $(pwd)
+	test 2>/dev/null ${HOME} echo done
+		x=1 then | /usr/bin echo && --verbose echo 2>/dev/null then $(pwd) --verbose then
+		then | "$1" $(pwd) then ${HOME} --verbose 'quoted text' test done cd --verbose -eu
+		$(pwd) grep ${HOME} cd cd cd 2>/dev/null export "$@" readonly
+	&& | 'quoted text' grep 'quoted text'
+		2>/dev/null --verbose -eu sed 2>/dev/null && | grep
+/usr/bin grep --verbose /usr/bin -eu 'quoted text' "$@"
+		export readonly local sed
+export export "$1" then && done "$@" awk export && echo $(pwd) $(pwd) printf
+		printf x=1 printf 'quoted text'
+	/usr/bin readonly cd cd -eu then test | 2>/dev/null | "$@" then | then
+	cd test echo grep export x=1 then export echo "$@" export readonly
+		done printf then /usr/bin grep
+	&& sed grep ${HOME} 'quoted text' echo && local 2>/dev/null $(pwd) echo echo
+		'quoted text' local sed /usr/bin echo -eu sed readonly
+	&& then test ${HOME} grep done readonly grep readonly x=1 x=1 /usr/bin
+		sed awk x=1 "$1" sed export grep grep echo $(pwd)
+grep | printf 2>/dev/null cd "$@" -eu cd readonly
+	echo "$1" "$1" $(pwd) --verbose "$1"
+		local ${HOME} test --verbose readonly
+		"$@" test then readonly | printf
+printf then | printf /usr/bin
+awk done grep printf cd 'quoted text' readonly sed export && cd grep done
+		printf export | ${HOME} "$@" printf grep printf 2>/dev/null 2>/dev/null "$@"
+	x=1 2>/dev/null /usr/bin cd 2>/dev/null
+"$@" "$@" awk local cd echo sed export $(pwd) export cd then
+	cd 'quoted text' local "$1" sed /usr/bin then cd awk x=1 awk
+		-eu 'quoted text' printf -eu "$1" export -eu then printf done then awk then then
+	printf sed done printf awk cd -eu echo 2>/dev/null /usr/bin export
+	x=1 local readonly ${HOME} readonly local
+		&& 2>/dev/null "$@" local x=1 grep $(pwd) 'quoted text' sed -eu grep
+	${HOME} x=1 2>/dev/null then local 2>/dev/null grep export awk readonly echo
+		done cd grep printf sed x=1 sed readonly /usr/bin $(pwd)
+	then /usr/bin then x=1 grep /usr/bin then "$@" awk /usr/bin && test awk test
+	awk then grep -eu printf
+	/usr/bin done /usr/bin printf test local x=1 &&
+| | cd grep cd sed ${HOME} grep awk -eu echo local
+		"$1" -eu then cd grep -eu test 2>/dev/null
+	/usr/bin ${HOME} --verbose $(pwd)
+		echo x=1 $(pwd) "$1" local && | then awk
+then test test /usr/bin then 2>/dev/null "$1"
+| then /usr/bin cd printf export grep $(pwd) done -eu export | printf done
+		"$@" 'quoted text' x=1 -eu echo echo --verbose ${HOME} 2>/dev/null 2>/dev/null
+	done readonly local | echo 'quoted text' echo printf grep 2>/dev/null
+		then && then | --verbose export echo "$@"
+2>/dev/null printf ${HOME} "$@" export local sed -eu cd "$1"
+	test test echo readonly ${HOME} awk --verbose
+		export export done "$1" ${HOME} awk --verbose 'quoted text' "$@" local
+test cd printf printf ${HOME} awk x=1 x=1 done -eu -eu then
+/usr/bin echo | ${HOME} then 2>/dev/null
+then echo cd awk done x=1
+		--verbose grep "$@" "$1" 2>/dev/null then sed -eu /usr/bin echo echo done sed
+2>/dev/null local test then local --verbose done printf test awk
+		'quoted text' printf "$1" --verbose --verbose | local
+		/usr/bin x=1 awk --verbose --verbose $(pwd) readonly sed x=1 done readonly
+		sed 2>/dev/null local export sed test readonly 2>/dev/null then readonly then
+	local local sed grep -eu
+&& sed echo "$1" done sed printf | ${HOME}
+	awk local "$@" local echo readonly "$@" grep done "$@" done
+grep 2>/dev/null x=1 done awk && grep /usr/bin
+	done "$@" echo then --verbose done "$@" printf "$@" $(pwd)
+		"$@" awk local 2>/dev/null then export && sed x=1 x=1 "$@" test
+test $(pwd) printf | 2>/dev/null
+	x=1 | cd 2>/dev/null "$@" 2>/dev/null
+"$1" export cd cd 'quoted text' -eu 'quoted text' -eu -eu printf readonly test
+		--verbose local "$1" $(pwd)
+printf $(pwd) 'quoted text'
+	$(pwd) sed 'quoted text' "$@" awk $(pwd) local awk
+| cd && test printf ${HOME} -eu then grep --verbose
+		cd ${HOME} then | /usr/bin x=1 cd then
+	export awk ${HOME} readonly /usr/bin then --verbose x=1
+	| cd done test ${HOME} "$1" --verbose echo local echo /usr/bin --verbose | then
+echo cd grep 2>/dev/null printf test | ${HOME} local local
+	export export printf awk awk test | --verbose export /usr/bin /usr/bin
+	printf echo $(pwd) echo sed printf
+readonly && ${HOME} local
+	local /usr/bin --verbose grep echo x=1 $(pwd) then readonly "$1" then readonly
+		/usr/bin | "$@" $(pwd) cd done export
+grep /usr/bin echo 2>/dev/null grep cd export test ${HOME}
+	&& cd printf local done 'quoted text' "$1" cd 'quoted text' echo
+2>/dev/null "$1" test local readonly then /usr/bin echo $(pwd) local grep printf
+	readonly 'quoted text' readonly /usr/bin 'quoted text' echo
+		'quoted text' | --verbose export "$1" local -eu echo | printf --verbose test
+		echo 2>/dev/null 2>/dev/null
+	&& 'quoted text' grep 2>/dev/null printf local $(pwd) cd then && then
+-eu grep "$1" /usr/bin "$@"
+		export | x=1 done | x=1 "$@" grep sed echo 2>/dev/null sed
+		$(pwd) test /usr/bin cd x=1 done $(pwd) grep --verbose awk sed export
+		readonly awk readonly awk "$@" --verbose $(pwd) done --verbose then
+		readonly "$1" 'quoted text' sed && /usr/bin done ${HOME} readonly
+		grep "$1" /usr/bin $(pwd) 2>/dev/null x=1
+	export "$@" -eu then echo then done "$@" x=1 test echo test $(pwd) export readonly
+	export "$@" /usr/bin export && done cd && echo done 2>/dev/null
+		cd --verbose cd then && export "$@" export echo printf "$1" test ${HOME}
+		sed echo printf export then "$1" grep export x=1 /usr/bin local export cd 'quoted text'
+		| 'quoted text' "$@" 2>/dev/null
+"$@" sed -eu /usr/bin test 'quoted text' printf 'quoted text' grep grep
+	printf x=1 && 'quoted text' awk then sed
+	readonly && echo then echo && cd $(pwd) x=1 | -eu x=1 -eu then sed
+	sed then awk $(pwd) local | done local $(pwd) /usr/bin
+"$1" awk export /usr/bin export x=1 ${HOME} export && $(pwd) test local
+	export --verbose export done ${HOME}
+	echo -eu $(pwd) readonly done "$@" cd x=1 sed 'quoted text'
+		export then sed 'quoted text'
+		2>/dev/null 2>/dev/null 2>/dev/null sed /usr/bin echo sed $(pwd) | "$@"
+| sed printf x=1 sed done printf cd 2>/dev/null
+	export readonly awk export
+"$@" printf ${HOME} then export done readonly ${HOME}
+	2>/dev/null done /usr/bin done cd /usr/bin &&
+	done $(pwd) cd "$@" test cd grep 'quoted text'
+	"$1" then grep /usr/bin grep "$@" echo then printf |
+echo printf awk local local 'quoted text' "$1"
+		2>/dev/null printf local then cd 2>/dev/null "$1" x=1 cd test
+		${HOME} | --verbose -eu x=1 2>/dev/null $(pwd) export --verbose "$1" readonly
+		sed | 2>/dev/null "$@"
+		"$@" readonly $(pwd) readonly echo && /usr/bin 2>/dev/null "$@" && echo
+	awk cd $(pwd) 2>/dev/null
+		&& "$1" cd $(pwd) test echo /usr/bin 2>/dev/null cd
+| test echo awk done -eu
+		then x=1 "$1" /usr/bin 2>/dev/null then local 'quoted text'
+cd done $(pwd) /usr/bin 2>/dev/null 2>/dev/null /usr/bin x=1 "$@" "$1" $(pwd)
+"$@" 'quoted text' | awk done cd | sed readonly sed sed grep printf
+	"$1" local $(pwd) | "$@" ${HOME} --verbose --verbose --verbose
+	--verbose done cd "$@" 2>/dev/null
+/usr/bin test echo ${HOME} local
+x=1 'quoted text' local readonly sed /usr/bin readonly then test then
+		"$1" printf "$1" cd /usr/bin done /usr/bin cd $(pwd) x=1
+-eu awk readonly | x=1 2>/dev/null readonly x=1 export grep
+		cd && && --verbose ${HOME} sed 'quoted text' test
+printf readonly sed export awk cd export "$1" 2>/dev/null
+		readonly printf grep /usr/bin test printf -eu done -eu then /usr/bin local cd
+awk export readonly then && echo then /usr/bin test 2>/dev/null
+	local "$@" printf local x=1 x=1 then
+	'quoted text' "$@" /usr/bin readonly export awk && $(pwd)
+	grep test && grep sed printf && 2>/dev/null grep
+	done then printf ${HOME} 2>/dev/null
+		"$1" readonly echo sed --verbose readonly
+		sed printf awk | grep sed "$1" -eu test test /usr/bin ${HOME}
+		grep 2>/dev/null $(pwd) "$1" 2>/dev/null "$@"
+		local x=1 /usr/bin echo 'quoted text' $(pwd)
+		then 'quoted text' /usr/bin /usr/bin cd ${HOME} | printf done
+		$(pwd) 'quoted text' then 2>/dev/null && test 'quoted text'
+	"$1" $(pwd) done export x=1 grep test sed local grep readonly
+		${HOME} echo then export sed | export
+		test sed sed printf && -eu echo --verbose printf | printf export
+	cd 'quoted text' 2>/dev/null 2>/dev/null awk /usr/bin -eu
+'quoted text' printf printf /usr/bin
+${HOME} ${HOME} then "$1" /usr/bin done cd 'quoted text' done && test 2>/dev/null
+		/usr/bin done sed ${HOME} ${HOME} $(pwd) "$@" export x=1 cd 'quoted text'
+printf readonly echo done sed printf grep | done $(pwd) ${HOME} "$1"
+		echo test ${HOME} printf ${HOME} local sed | 'quoted text'
+	sed sed awk && 2>/dev/null 2>/dev/null 'quoted text' "$1"
+		awk ${HOME} printf awk local cd -eu cd then "$1"
+readonly "$@" done printf $(pwd) echo test -eu
+x=1 x=1 test awk /usr/bin cd x=1 readonly $(pwd) /usr/bin
+	-eu -eu printf x=1 ${HOME}
+then 2>/dev/null cd awk 2>/dev/null done --verbose
+	| export /usr/bin "$@" printf
+2>/dev/null x=1 printf sed "$1" export cd
+		-eu /usr/bin grep readonly
+--verbose then && then grep printf
+done ${HOME} $(pwd) awk sed --verbose ${HOME} printf
+		test readonly | cd 'quoted text' 2>/dev/null awk $(pwd) readonly cd local $(pwd)
+	echo readonly $(pwd) ${HOME}
+		cd local awk x=1 local && 'quoted text' test
+${HOME} 2>/dev/null cd /usr/bin /usr/bin ${HOME} 'quoted text' cd echo readonly
+sed echo cd echo echo done awk export ${HOME} printf
+-eu grep $(pwd) | then -eu $(pwd) echo x=1 awk sed echo awk -eu printf | 'quoted text'
+		test 'quoted text' "$@" $(pwd)
+		-eu export test cd "$1" ${HOME}
+	test && cd test readonly awk then export grep $(pwd) -eu 'quoted text'
+		&& | printf 2>/dev/null "$1" $(pwd) "$1" cd
+		| then /usr/bin then test ${HOME} done | $(pwd) ${HOME}
+then cd --verbose 2>/dev/null -eu /usr/bin local readonly /usr/bin
+local "$@" $(pwd) printf 2>/dev/null --verbose export
+${HOME} 2>/dev/null 'quoted text'
+	$(pwd) echo echo --verbose |
+		${HOME} test "$@" printf 2>/dev/null readonly
+		export echo --verbose x=1 ${HOME} --verbose awk local -eu $(pwd)
+	${HOME} test --verbose awk "$@" grep cd 2>/dev/null
+	"$1" 2>/dev/null echo sed awk done readonly readonly
+	| ${HOME} local sed then awk readonly ${HOME}
+	x=1 readonly cd x=1 2>/dev/null test 2>/dev/null --verbose
+		printf readonly --verbose printf --verbose
+	then done test $(pwd) "$1" /usr/bin done | then
+	$(pwd) 2>/dev/null export ${HOME} $(pwd) done cd | $(pwd) awk
+		printf x=1 export echo done -eu 'quoted text'
+	&& 'quoted text' then $(pwd) 2>/dev/null printf awk echo awk --verbose grep
+'quoted text' "$1" then -eu
+		local x=1 echo $(pwd) sed ${HOME} local
+'quoted text' awk && awk "$@" echo echo -eu awk cd grep $(pwd) test readonly
+	awk local "$1" readonly then -eu done test --verbose
+	export sed cd grep 'quoted text' 'quoted text' /usr/bin "$1" readonly
+echo readonly cd echo echo awk readonly
+		2>/dev/null local done readonly 'quoted text' 2>/dev/null
+		-eu $(pwd) | printf export awk x=1 /usr/bin grep /usr/bin done test
+	then /usr/bin echo then grep done x=1 2>/dev/null
+	local cd export local | export "$1" x=1 cd "$@" "$@" readonly
+		awk -eu -eu awk done --verbose cd echo cd ${HOME} readonly | local
+		sed done grep -eu --verbose cd | $(pwd) /usr/bin --verbose awk echo
+	2>/dev/null awk test /usr/bin
+		local printf "$@" --verbose done ${HOME}
+	-eu grep export cd "$@" --verbose 'quoted text'
+test done --verbose export grep
+		'quoted text' grep sed sed test "$1" | printf --verbose /usr/bin 2>/dev/null
+		'quoted text' $(pwd) "$@" readonly echo
+	$(pwd) /usr/bin /usr/bin sed done 2>/dev/null 'quoted text'
+		local awk "$@" test grep export echo done | readonly grep 2>/dev/null printf grep
+		local "$@" echo /usr/bin "$1" export -eu -eu
+		--verbose sed awk cd 'quoted text'
+	/usr/bin grep export sed grep export
+	--verbose export readonly
+	cd ${HOME} awk sed ${HOME} -eu then $(pwd) "$1" then | awk
+2>/dev/null /usr/bin 2>/dev/null local --verbose
+	then $(pwd) grep printf done --verbose && "$@" x=1 2>/dev/null
+	2>/dev/null test grep -eu cd echo "$1" -eu then -eu test printf cd
+done sed test echo readonly echo 'quoted text' readonly
+	done local test 2>/dev/null sed 2>/dev/null 'quoted text'
+	export 'quoted text' export readonly -eu 2>/dev/null
+		&& | grep printf && awk done
+grep sed -eu /usr/bin -eu local
+		test && export readonly 'quoted text' 2>/dev/null
+	&& printf "$1" done | printf sed --verbose
+		then readonly /usr/bin | | grep x=1 $(pwd) $(pwd) | --verbose
+	readonly --verbose | /usr/bin 2>/dev/null
+		readonly | export printf "$1" cd printf 2>/dev/null
+		cd 'quoted text' then export ${HOME} done echo cd done 'quoted text'
+		sed grep | --verbose printf export | -eu
+		awk ${HOME} && x=1 echo -eu local /usr/bin awk then | && 'quoted text'
+'quoted text' "$1" | readonly awk done
+	| grep grep 'quoted text' grep printf && 'quoted text' export test local
+	export echo cd --verbose
+		printf "$1" then export 2>/dev/null grep sed /usr/bin
+printf --verbose local cd /usr/bin
+printf 'quoted text' 2>/dev/null ${HOME} /usr/bin cd awk |
+--verbose grep "$1" export "$1" -eu echo -eu "$1" /usr/bin && "$1" printf 2>/dev/null
+		done echo readonly && 'quoted text' /usr/bin cd local awk | grep
+	echo awk "$1" | printf then readonly ${HOME} | /usr/bin local x=1 cd 2>/dev/null
+		grep then $(pwd) -eu export test export -eu cd printf --verbose
+readonly "$@" sed && "$1" --verbose | | && test sed then export
+	x=1 "$1" 'quoted text' --verbose -eu
+		/usr/bin /usr/bin echo export done x=1 cd printf
+	"$1" cd awk printf then 'quoted text' readonly printf
+echo then done cd cd ${HOME} sed cd test done
+		${HOME} sed 2>/dev/null local $(pwd) awk /usr/bin
+		-eu printf --verbose --verbose done done test printf readonly sed then
+	then x=1 "$1" done test awk test ${HOME} | $(pwd) export
+	--verbose printf export export 2>/dev/null && "$1" cd --verbose then echo readonly
+	awk readonly /usr/bin test awk export "$1" "$@" ${HOME} "$@"
+--verbose --verbose | awk x=1 -eu printf export 2>/dev/null test 'quoted text'
+readonly test "$1" sed awk
+		test "$@" | export then --verbose done sed export
+	"$1" readonly then cd ${HOME} 'quoted text' /usr/bin | test printf "$1" echo
+	grep ${HOME} sed $(pwd) grep export export
+${HOME} ${HOME} "$@" ${HOME} export "$1" | local awk
+export /usr/bin echo done done x=1
+printf cd | local x=1 echo 'quoted text'
+/usr/bin -eu -eu | export done $(pwd) -eu -eu local sed awk
+		&& 'quoted text' --verbose | ${HOME} local then awk
+	2>/dev/null sed --verbose ${HOME} /usr/bin
+	echo grep awk | | printf
+		printf printf export then printf "$@" "$@" | test | printf
+		sed then cd then --verbose export printf
+		grep /usr/bin "$@" x=1 /usr/bin /usr/bin local ${HOME} 2>/dev/null
+printf "$1" then "$@" -eu printf /usr/bin test grep | && done
+--verbose export sed cd | grep cd sed 'quoted text'
+	-eu done | /usr/bin $(pwd) local -eu $(pwd)
+local --verbose "$1" local then echo grep 'quoted text' "$1" printf sed done 'quoted text'
+		printf x=1 cd echo 2>/dev/null grep sed x=1 x=1 "$1" sed printf
+cd awk /usr/bin --verbose
+${HOME} then local test "$@" | grep test $(pwd) export readonly "$@" cd x=1 &&
+local test /usr/bin local awk --verbose $(pwd) /usr/bin
+2>/dev/null 'quoted text'
+		done export printf $(pwd) | done --verbose done done $(pwd) -eu && "$1" cd awk
+test test done readonly $(pwd)
+	"$@" local export 'quoted text' then cd ${HOME} done awk -eu 2>/dev/null
+"$@" "$@" 2>/dev/null sed
+then --verbose 'quoted text' printf then
+	test sed $(pwd) sed done test x=1
+		"$1" grep --verbose printf --verbose ${HOME}
+	"$1" awk -eu && 'quoted text' ${HOME}
+		x=1 | test sed sed | 2>/dev/null
+awk "$1" $(pwd) then test --verbose printf "$1"
+"$1" "$@" /usr/bin echo sed export
+&& then cd export $(pwd)
+x=1 grep then local "$@" -eu /usr/bin -eu grep awk sed "$1" --verbose ${HOME}
+&& sed | export awk -eu /usr/bin -eu cd printf x=1 "$1" local sed x=1
+		printf x=1 | echo done /usr/bin awk && then echo
+	readonly then "$@" sed cd ${HOME} $(pwd)
+	done export awk local
+		export done awk readonly export export /usr/bin | done $(pwd) then test
+sed "$@" && test | 2>/dev/null echo
+${HOME} 'quoted text' && -eu && test "$@" sed readonly x=1
+then x=1 printf 2>/dev/null "$@" printf readonly printf grep | echo
+"$@" done awk 2>/dev/null /usr/bin $(pwd) then awk test --verbose --verbose
+	${HOME} sed grep readonly awk local
+	cd 2>/dev/null then --verbose
+/usr/bin $(pwd) ${HOME} | sed grep "$1" then cd | "$1"
+	'quoted text' /usr/bin echo "$@" "$1"
+then -eu printf echo export done 2>/dev/null /usr/bin 'quoted text' sed printf
+		"$1" awk export /usr/bin then grep test &&
+export $(pwd) echo ${HOME} "$1" /usr/bin 'quoted text'
+/usr/bin sed test "$1" && -eu 'quoted text' /usr/bin
+2>/dev/null 2>/dev/null "$1" printf 2>/dev/null readonly
+		done | x=1 test 2>/dev/null
+		2>/dev/null printf awk ${HOME} /usr/bin
+		awk | 'quoted text' echo -eu
+		then grep $(pwd) /usr/bin
+		$(pwd) | awk 2>/dev/null printf "$@" && -eu && export
+		--verbose ${HOME} then
+done test "$1" local -eu | $(pwd) $(pwd) printf
+"$@" export $(pwd) | "$1" && -eu x=1 export "$@" test
+	awk 2>/dev/null x=1 && done
+	--verbose /usr/bin echo printf local "$@" ${HOME} ${HOME}
+		readonly x=1 export printf
+		readonly export -eu && readonly done then grep then 'quoted text' readonly 'quoted text'
+| cd "$1" done -eu test "$1" sed grep test cd 2>/dev/null
+		export readonly $(pwd) done then export local test awk printf | cd sed done awk
+		echo 2>/dev/null -eu x=1 cd printf | /usr/bin 'quoted text' then printf
+	export echo done && 2>/dev/null
+		&& -eu done "$@" done readonly "$@" awk "$1" printf
+	&& echo "$@" test 2>/dev/null grep x=1 then printf grep -eu 2>/dev/null
+	grep $(pwd) x=1 test cd local | local "$@" readonly awk done echo awk 'quoted text'
+	-eu test done $(pwd) echo
+	"$1" cd ${HOME} awk cd -eu -eu /usr/bin "$1" x=1 done printf cd test cd
+	cd && export "$1" "$1"
+cd cd 'quoted text' x=1 "$@"
+		2>/dev/null /usr/bin /usr/bin /usr/bin then export awk |
+--verbose awk "$1" "$1" readonly "$@"
+$(pwd) --verbose 'quoted text' 2>/dev/null 'quoted text' ${HOME} &&
+	'quoted text' echo $(pwd) "$1" printf local ${HOME} readonly $(pwd) "$@"
+		test export | readonly done done $(pwd)
+		readonly readonly readonly && "$1" then --verbose grep 2>/dev/null
+	&& ${HOME} done awk $(pwd) x=1 'quoted text' "$@" $(pwd)
+	echo "$@" $(pwd) cd cd readonly "$@" /usr/bin "$1" "$@" sed grep
+		printf readonly awk --verbose --verbose
+	grep -eu test then cd "$1"
+		'quoted text' /usr/bin | $(pwd) --verbose export awk awk /usr/bin
+	&& x=1 && "$@" printf echo
+2>/dev/null cd ${HOME}
+done /usr/bin | | x=1 then && $(pwd)
+		then && cd $(pwd) export
+	readonly export 2>/dev/null done local done | $(pwd)
+x=1 printf then 2>/dev/null --verbose "$1"
+		export echo cd -eu $(pwd) "$1" readonly echo awk x=1 -eu "$1" "$1" --verbose
+x=1 printf "$@" -eu 2>/dev/null
+	sed readonly 'quoted text' readonly "$1"
+	cd ${HOME} export && x=1 "$@" "$1" x=1 sed x=1 x=1 printf "$@"
+	readonly 'quoted text' "$@" printf ${HOME} "$1" "$@" then cd sed
+	-eu /usr/bin --verbose "$@" cd --verbose
+	sed grep readonly "$@" grep
+		-eu 2>/dev/null cd done then local "$1" ${HOME} -eu "$1" printf ${HOME}
+test local --verbose "$@" "$1" x=1 "$@" export cd awk sed "$@" sed
+awk --verbose | --verbose test 2>/dev/null --verbose | awk x=1 "$1" echo
+	export && 'quoted text'
+&& cd 'quoted text' $(pwd) 'quoted text'
+cd then echo 'quoted text' printf local && export 2>/dev/null
+done cd test test grep ${HOME} readonly --verbose $(pwd) 2>/dev/null
+	x=1 export "$1" 2>/dev/null /usr/bin --verbose
+		${HOME} --verbose export ${HOME} "$@"
+/usr/bin 2>/dev/null grep done echo x=1 export $(pwd) x=1 x=1 &&
+		-eu 'quoted text' -eu ${HOME} printf cd "$1" echo printf export $(pwd)
+export grep cd $(pwd) readonly done
+	grep readonly $(pwd) grep $(pwd) --verbose echo
+-eu -eu readonly x=1 export grep test
+		--verbose local cd awk "$1" cd readonly awk then && export printf done
+	-eu && export --verbose
+cd $(pwd) --verbose then "$1" -eu "$@" -eu "$1" cd awk cd 'quoted text' sed 2>/dev/null
+		grep 2>/dev/null test test ${HOME} then
+2>/dev/null 2>/dev/null then export && done cd local awk "$@" /usr/bin
+		/usr/bin && "$1" && done
+	2>/dev/null done /usr/bin local /usr/bin ${HOME} /usr/bin
+	"$@" readonly sed --verbose x=1 sed done local awk && echo 'quoted text'
+		awk awk --verbose && | local | x=1 --verbose done printf
+		'quoted text' printf sed cd -eu local done
+	'quoted text' /usr/bin "$@" awk test
+'quoted text' sed printf awk 'quoted text' "$1" ${HOME} "$1" export
+--verbose /usr/bin awk
+	awk sed test cd 2>/dev/null && awk printf test done
+		test test done "$@" then export
+"$1" awk "$@" "$1" sed export "$@" 'quoted text' readonly local export
+2>/dev/null done | local -eu "$@" && cd awk $(pwd) "$@" $(pwd)
+	then test && -eu test grep
+		local done -eu ${HOME} export | $(pwd) sed | done 2>/dev/null
+	awk export $(pwd) "$@" ${HOME} && echo readonly ${HOME} $(pwd) x=1 | then local
+	export | cd awk | | --verbose sed then readonly echo then awk --verbose | local
+	grep /usr/bin printf
+		sed done test readonly ${HOME} --verbose then | -eu $(pwd) echo 2>/dev/null
+	| grep --verbose x=1 "$@" $(pwd) x=1 cd -eu grep
+	done "$1" test sed echo 2>/dev/null awk "$1" "$@" x=1
+awk "$@" && && 'quoted text' -eu x=1 && | ${HOME} &&
+		sed 2>/dev/null sed test 2>/dev/null grep
+done | cd "$1" $(pwd)
+| $(pwd) x=1 done test echo $(pwd) grep sed "$@"
+		"$@" awk "$@" "$1" sed | "$1" /usr/bin x=1 test readonly | local then 2>/dev/null
+	grep then cd readonly && x=1 2>/dev/null && readonly $(pwd)
+grep export local readonly test
+	/usr/bin 'quoted text' "$1"
+sed | cd awk echo "$1" | printf printf then "$1" | test then
+x=1 "$@" "$1" readonly x=1 then test
+--verbose 'quoted text' $(pwd) && local
+		printf then && 2>/dev/null 2>/dev/null
+	"$@" sed x=1 -eu test echo export readonly
+	test export | 2>/dev/null 'quoted text'
+		done && $(pwd) $(pwd) 2>/dev/null grep &&
+	$(pwd) cd | | 'quoted text' export
+	&& && grep printf local local readonly 2>/dev/null |
+		$(pwd) printf cd -eu local grep then $(pwd) ${HOME} "$@" /usr/bin x=1
+	readonly sed x=1 cd test "$@"
+	&& "$1" readonly local printf --verbose
+	/usr/bin awk 'quoted text' cd test 2>/dev/null printf awk sed printf
+		done awk sed local cd ${HOME} local awk readonly && && cd 'quoted text' 2>/dev/null
+test /usr/bin readonly sed then printf
+		$(pwd) && sed grep echo readonly done done
+	grep sed $(pwd) "$1" 2>/dev/null
+"$1" "$1" $(pwd) echo grep 'quoted text' $(pwd) local
+	sed grep -eu --verbose printf && then /usr/bin export
+	local -eu -eu x=1 ${HOME} $(pwd) | --verbose --verbose
+		/usr/bin awk /usr/bin then
+/usr/bin $(pwd) --verbose |
+		'quoted text' sed 2>/dev/null "$@" sed -eu
+	echo --verbose && test ${HOME} "$@" x=1 'quoted text' readonly
+	--verbose echo && local /usr/bin then ${HOME} awk x=1 "$1" echo sed sed
+	| x=1 -eu export "$@" 'quoted text'
+		readonly && x=1 awk test --verbose | "$1" done -eu
+	echo local "$@" grep x=1 "$@" /usr/bin ${HOME} awk "$@" 2>/dev/null
+	sed 'quoted text' && readonly test 2>/dev/null readonly /usr/bin
+		$(pwd) printf | done grep sed test 2>/dev/null export
+	2>/dev/null ${HOME} "$1" 2>/dev/null $(pwd) $(pwd)
+test "$1" readonly $(pwd) $(pwd) export 2>/dev/null local ${HOME}
+	$(pwd) export "$1" "$@" ${HOME} done /usr/bin && sed test /usr/bin
+	sed -eu echo 2>/dev/null local 2>/dev/null printf
+test -eu x=1 2>/dev/null /usr/bin then x=1 && -eu && "$@" 'quoted text'
+		--verbose sed done ${HOME} cd ${HOME} export test x=1 /usr/bin local export
+cd sed test -eu test /usr/bin "$@" printf cd readonly
+	test test grep $(pwd) cd local 2>/dev/null local "$@"
+	printf && x=1 grep grep ${HOME} "$@" test -eu 2>/dev/null then then 'quoted text'
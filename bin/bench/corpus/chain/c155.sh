@@ -0,0 +1,2001 @@
+cd $(pwd) readonly readonly --verbose "$@" awk --verbose sed grep
+test sed x=1 -eu && "$1"
+&& -eu 2>/dev/null -eu --verbose
+	-eu readonly cd "$@" $(pwd)
+		${HOME} "$@" done 'quoted text' && printf
+done cd awk printf then 2>/dev/null
+local test -eu sed sed "$@" x=1 sed awk then 2>/dev/null -eu printf printf
+	echo 'quoted text' done readonly /usr/bin /usr/bin done local test
+	x=1 /usr/bin x=1 2>/dev/null | 'quoted text' then grep "$1" 2>/dev/null
+test | $(pwd) sed sed readonly x=1 x=1 && printf done readonly
+	then 'quoted text' test 'quoted text' | grep grep --verbose /usr/bin
+		awk printf grep local awk printf x=1 grep --verbose --verbose x=1
+printf test 'quoted text'
+	"$@" then "$@" $(pwd) grep sed test cd local ${HOME} done "$@"
+	${HOME} "$1" readonly "$1" export
+	x=1 sed export sed -eu export
+		then echo local cd /usr/bin x=1 sed awk /usr/bin && awk export printf
+	2>/dev/null --verbose 'quoted text'
+	"$1" x=1 echo --verbose export
+x=1 cd echo echo grep export readonly test "$@"
+then done "$@" && x=1 then ${HOME}
+	${HOME} grep then echo /usr/bin readonly done awk 2>/dev/null
+-eu 'quoted text' /usr/bin awk grep /usr/bin local done printf
+readonly readonly readonly --verbose test done sed echo 'quoted text'
+	x=1 awk 2>/dev/null done awk
+	/usr/bin | "$@" cd grep && printf "$@" 2>/dev/null
+		sed printf done | grep "$1" local readonly
+done 'quoted text' sed cd then awk "$1" | export done awk
+readonly "$1" readonly 'quoted text' readonly export
+printf 2>/dev/null local 2>/dev/null export printf printf
+	"$1" printf --verbose awk x=1
+&& test 2>/dev/null printf -eu
+$(pwd) cd --verbose printf local
+	x=1 'quoted text' --verbose
+		--verbose echo cd grep awk && 2>/dev/null
+		local test export ${HOME} then echo printf && $(pwd) then "$@"
+		"$@" "$@" "$@" awk sed x=1 local awk done $(pwd) --verbose /usr/bin &&
+	test awk printf local readonly "$@" printf test ${HOME}
+		x=1 cd "$@" 2>/dev/null "$1" local
+&& sed then export sed grep -eu && ${HOME}
+		sed printf printf echo && cd "$@" local $(pwd) 2>/dev/null
+cd 'quoted text' test local -eu ${HOME} ${HOME} $(pwd) ${HOME} export 'quoted text'
+		grep grep export "$@" done
+x=1 test && -eu awk -eu -eu echo readonly then x=1 local printf
+awk done local 'quoted text' printf
+	-eu 2>/dev/null "$@" && |
+		"$1" ${HOME} sed cd done echo echo cd
+	&& cd echo grep x=1 awk export /usr/bin
+		x=1 sed grep "$@" done echo 2>/dev/null "$@" cd x=1 printf then ${HOME} done
+	cd ${HOME} --verbose "$@"
+	$(pwd) export local done 2>/dev/null awk done test --verbose
+		echo sed 'quoted text' readonly | 2>/dev/null -eu printf cd export sed printf
+	done --verbose test $(pwd) 2>/dev/null awk 'quoted text'
+		printf "$@" then $(pwd) | sed "$@" echo then
+--verbose /usr/bin grep "$1" /usr/bin then printf x=1 sed "$@" /usr/bin
+		"$@" awk local local && echo -eu ${HOME} 2>/dev/null && --verbose
+		export test ${HOME} /usr/bin /usr/bin
+grep -eu "$1" 'quoted text' cd | local
+2>/dev/null x=1 /usr/bin printf then grep --verbose local cd grep grep
+readonly done x=1 --verbose printf awk local /usr/bin --verbose grep then "$@"
+	${HOME} local cd grep export && readonly -eu "$@" | awk
+		${HOME} "$@" "$1" sed -eu grep
+	/usr/bin "$@" sed "$1" /usr/bin "$1" x=1 printf $(pwd) export 'quoted text'
+test cd awk 'quoted text' /usr/bin x=1 readonly sed /usr/bin
+		done && $(pwd) ${HOME} export --verbose local awk -eu test "$1" x=1
+		readonly local export awk $(pwd) | 'quoted text' --verbose -eu
+	awk --verbose "$@" "$1" local $(pwd) awk && "$@"
+local export x=1 /usr/bin done grep
+export $(pwd) /usr/bin /usr/bin /usr/bin
+echo readonly /usr/bin ${HOME} awk "$@" --verbose --verbose x=1 x=1 $(pwd)
+	awk --verbose 2>/dev/null -eu awk
+	done sed test export then printf grep "$@" local local "$@" grep printf
+		2>/dev/null cd echo then then "$@" done export
+	local && local ${HOME} awk local
+		test awk -eu cd grep -eu -eu readonly 2>/dev/null ${HOME} --verbose --verbose
+	--verbose | local test done --verbose
+'quoted text' 2>/dev/null 'quoted text'
+x=1 then && $(pwd) export printf awk echo sed cd "$@" sed grep
+	done --verbose /usr/bin 2>/dev/null 2>/dev/null cd && then -eu echo -eu
+readonly done "$1" grep export done readonly 2>/dev/null
+--verbose sed x=1 && export "$@" "$@" then
+		"$@" grep && test printf local echo awk done 2>/dev/null
+	test "$1" x=1 local "$@" -eu test awk | printf 2>/dev/null
+	${HOME} grep "$1" test export x=1 && printf done awk grep test
+	echo && 'quoted text' grep
+x=1 x=1 echo -eu export 2>/dev/null
+	/usr/bin then printf && printf local cd x=1 -eu -eu awk 'quoted text'
+		readonly $(pwd) x=1 2>/dev/null "$1" -eu -eu cd && sed
+		printf local done done -eu $(pwd) --verbose export 'quoted text'
+	grep "$@" cd "$1" 'quoted text'
+${HOME} $(pwd) && then done &&
+	"$@" 2>/dev/null done test local 'quoted text' awk printf ${HOME} awk /usr/bin
+		cd printf done readonly 2>/dev/null
+	export x=1 export x=1 -eu
+--verbose $(pwd) | --verbose done "$1" x=1 $(pwd) export
+	"$@" --verbose "$1" $(pwd) -eu "$@"
+	2>/dev/null awk | | echo
+		export --verbose 'quoted text'
+		printf 2>/dev/null "$1" grep --verbose && && 'quoted text' /usr/bin
+		sed local awk -eu cd printf x=1 "$@"
+${HOME} "$@" export 2>/dev/null ${HOME} -eu $(pwd)
+&& echo "$1" echo $(pwd)
+		awk then ${HOME} export printf "$@" ${HOME} ${HOME} export cd echo local
+'quoted text' /usr/bin 'quoted text'
+		-eu export cd -eu done then 2>/dev/null -eu -eu 'quoted text'
+	/usr/bin -eu test local then local grep done
+printf x=1 echo grep 'quoted text'
+	"$1" cd 2>/dev/null test echo $(pwd) $(pwd) /usr/bin export
+	2>/dev/null sed 'quoted text' 2>/dev/null awk
+	export printf export test 'quoted text' awk --verbose test printf readonly -eu
+		'quoted text' 'quoted text' printf --verbose cd awk echo done 'quoted text'
+"$@" 'quoted text' --verbose
+	sed readonly "$1" 'quoted text' $(pwd)
+awk x=1 && 2>/dev/null readonly local awk then printf 'quoted text'
+		"$1" x=1 readonly | awk 2>/dev/null
+		${HOME} printf then 'quoted text' && awk local $(pwd) sed readonly
+		then grep printf --verbose "$@" grep /usr/bin "$@" readonly x=1 sed /usr/bin |
+${HOME} grep grep test | "$1" awk readonly 2>/dev/null
+	printf cd $(pwd) 2>/dev/null export $(pwd)
+		local export printf --verbose
+		cd cd $(pwd) grep export ${HOME} readonly awk then readonly
+cd "$@" --verbose x=1
+		| then 2>/dev/null test x=1 local local done -eu awk -eu test "$@"
+${HOME} 2>/dev/null readonly export "$@" echo ${HOME} readonly
+	2>/dev/null local && $(pwd) export local && local /usr/bin /usr/bin
+		done echo echo /usr/bin done 2>/dev/null
+		'quoted text' readonly
+echo $(pwd) | --verbose "$1" /usr/bin $(pwd) -eu done 'quoted text' 'quoted text'
+/usr/bin 'quoted text' then 2>/dev/null 'quoted text' 'quoted text'
+	printf -eu /usr/bin ${HOME} then /usr/bin echo export cd x=1 "$1" 2>/dev/null
+		"$1" "$1" ${HOME} -eu grep printf echo ${HOME} sed then awk cd
+	2>/dev/null --verbose sed ${HOME} ${HOME} -eu test
+		then 'quoted text' "$@" readonly $(pwd) printf
+grep $(pwd) readonly cd --verbose echo sed cd
+	awk local /usr/bin awk --verbose then export then grep done x=1 -eu
+	export "$@" --verbose $(pwd) grep local local --verbose
+&& done sed $(pwd) 'quoted text' | done | export "$@" 2>/dev/null --verbose
+		| /usr/bin /usr/bin 2>/dev/null 2>/dev/null "$@" -eu
+		readonly test local 2>/dev/null && done sed -eu --verbose 2>/dev/null readonly
+	grep ${HOME} export /usr/bin done 2>/dev/null
+then readonly then done "$@" /usr/bin /usr/bin then x=1 --verbose
+	${HOME} test | $(pwd) | $(pwd) printf -eu printf
+&& then readonly 'quoted text' awk echo awk ${HOME}
+		x=1 done -eu cd 'quoted text' --verbose echo | export echo ${HOME} printf
+	grep /usr/bin /usr/bin
+		-eu export sed sed done $(pwd) sed cd test printf
+echo then test --verbose local awk 2>/dev/null cd
+${HOME} export "$@" /usr/bin export
+		done done x=1 "$@" test "$1" x=1 -eu --verbose x=1 | local readonly
+	then printf x=1 then 2>/dev/null && export awk echo sed test then done -eu "$@"
+		echo printf export done local cd "$@" readonly /usr/bin 'quoted text' /usr/bin
+	awk sed cd awk 'quoted text' readonly --verbose -eu 2>/dev/null $(pwd) done
+	x=1 printf "$@" 'quoted text' cd && done echo
+	${HOME} -eu 'quoted text' awk
+	test test "$1" x=1 2>/dev/null |
+	done grep grep && ${HOME} | --verbose sed cd --verbose
+		$(pwd) 'quoted text' grep ${HOME}
+cd $(pwd) readonly readonly | done -eu -eu "$1" then
+$(pwd) "$1" done /usr/bin | ${HOME}
+	$(pwd) "$1" grep 'quoted text' readonly $(pwd) grep local | then
+	${HOME} sed && "$1" sed $(pwd) done awk "$@" done
+	sed awk | echo -eu awk test awk "$@" printf
+	| $(pwd) --verbose done printf awk 2>/dev/null done done "$@" test
+		"$1" local sed test x=1 grep 'quoted text' $(pwd) | local 'quoted text'
+	readonly local echo /usr/bin test printf --verbose cd
+	done export --verbose test x=1 local
+sed readonly grep "$1"
+	awk ${HOME} && -eu echo then
+		echo "$1" "$1" ${HOME} "$@" | cd x=1 $(pwd)
+	'quoted text' grep | /usr/bin $(pwd) done "$@" | export -eu /usr/bin
+local && export -eu readonly $(pwd) 2>/dev/null test
+	--verbose 2>/dev/null sed grep printf "$1" cd then 2>/dev/null grep local $(pwd)
+	cd x=1 then cd test --verbose test /usr/bin --verbose local 2>/dev/null
+	grep -eu readonly local ${HOME} then printf && local $(pwd) printf 'quoted text'
+	then sed | local | cd echo -eu cd | printf --verbose echo done echo
+		then awk grep cd then readonly ${HOME} then | export echo export /usr/bin 2>/dev/null
+		then 2>/dev/null --verbose readonly "$1" 'quoted text' /usr/bin "$1"
+| test grep "$1" -eu done "$@" export then --verbose ${HOME}
+		| ${HOME} cd test cd grep | then "$1" export awk sed 2>/dev/null 'quoted text'
+	grep printf local -eu && --verbose 'quoted text'
+| $(pwd) done then ${HOME} | && && x=1 echo x=1 $(pwd) sed grep
+		&& x=1 "$@" export --verbose then grep /usr/bin x=1
+		test then && $(pwd) 'quoted text'
+| $(pwd) "$1" then x=1 sed 'quoted text' cd --verbose /usr/bin readonly
+	'quoted text' grep "$@" done export echo done
+		grep export then --verbose then --verbose awk 2>/dev/null printf readonly awk test
+		&& | $(pwd) sed export done printf 'quoted text' local echo $(pwd)
+	--verbose printf "$@" test ${HOME} local sed "$1" export
+	${HOME} local printf echo printf grep --verbose $(pwd) done export
+-eu 2>/dev/null $(pwd) readonly readonly done "$1" sed grep $(pwd)
+	"$1" $(pwd) awk x=1 done test then
+	export then done | cd 'quoted text' "$1"
+	awk --verbose export grep cd
+		cd | sed export done export
+"$@" ${HOME} grep test then $(pwd) "$1" readonly ${HOME} ${HOME} grep
+x=1 echo x=1 awk then then done awk "$@"
+echo test "$1" 2>/dev/null && "$@" x=1 "$1" x=1 done $(pwd) -eu
+	"$1" "$@" sed "$@" echo
+	${HOME} awk printf -eu local ${HOME} readonly
+then | echo test && 2>/dev/null /usr/bin x=1 sed done
+/usr/bin echo local 'quoted text' awk --verbose
+test x=1 readonly 'quoted text' "$1"
+		local awk sed export --verbose -eu 2>/dev/null sed grep "$@" grep 'quoted text'
+2>/dev/null -eu 'quoted text' --verbose cd "$@" sed x=1 echo "$@" && --verbose
+	| readonly printf --verbose && then test "$1" 'quoted text' then
+		x=1 'quoted text' local cd local "$1" "$1" /usr/bin 2>/dev/null done &&
+	$(pwd) local -eu readonly "$1" grep echo echo echo 2>/dev/null ${HOME} ${HOME}
+	done --verbose -eu x=1 grep x=1 echo | | echo local
+	'quoted text' && readonly cd 2>/dev/null
+	$(pwd) local cd 2>/dev/null readonly local awk cd echo echo --verbose 2>/dev/null
+readonly 'quoted text' --verbose readonly then grep && then
+	done export -eu then grep
+awk "$@" cd $(pwd) printf test /usr/bin 2>/dev/null done && then
+local sed grep 2>/dev/null | export cd awk x=1 | done /usr/bin "$@"
+	done -eu "$1" cd printf awk grep
+		&& x=1 printf x=1 --verbose
+		then echo -eu sed x=1 && | sed "$@" sed 'quoted text'
+printf local export echo printf
+		then awk 2>/dev/null -eu cd "$@" test then | cd
+| && test -eu local ${HOME} -eu -eu echo 'quoted text'
+/usr/bin readonly echo -eu 2>/dev/null && /usr/bin "$1"
+		then local $(pwd) --verbose then && | awk /usr/bin test ${HOME}
+cd "$@" "$1" $(pwd) printf
+	export "$@" --verbose && echo -eu | awk 2>/dev/null
+--verbose local local grep 2>/dev/null then 'quoted text' printf
+x=1 printf then 2>/dev/null export cd "$@" export /usr/bin "$@" awk
+done cd done "$1" done "$1" x=1 /usr/bin
+		$(pwd) x=1 readonly 'quoted text' 2>/dev/null "$1"
+readonly 'quoted text' x=1 x=1 "$1" $(pwd) grep
+	export awk 'quoted text' readonly
+		readonly "$1" "$1" 2>/dev/null awk "$1" "$@" sed | done
+"$@" 2>/dev/null awk test test -eu && --verbose local 'quoted text'
+		2>/dev/null local export 2>/dev/null sed --verbose
+		--verbose /usr/bin sed && awk then | grep then
+		done export export "$1" x=1 awk -eu echo ${HOME} grep x=1 export 'quoted text'
+	| sed -eu | "$@" printf x=1 "$@" 'quoted text' -eu local $(pwd)
+printf then 'quoted text' awk export awk x=1 'quoted text' done readonly
+		$(pwd) cd /usr/bin sed ${HOME} 2>/dev/null
+		&& done test "$@" awk cd echo | then && grep then "$@" "$@" done && "$1"
+	echo then x=1 --verbose local | echo sed 2>/dev/null
+	"$1" done --verbose sed /usr/bin echo 'quoted text' $(pwd)
+		2>/dev/null | | grep local sed 2>/dev/null &&
+		awk then then then 'quoted text' test --verbose --verbose --verbose printf
+done export -eu grep "$1" -eu -eu local
+	awk ${HOME} sed grep && cd printf readonly
+	-eu cd sed /usr/bin readonly $(pwd)
+		--verbose $(pwd) awk printf | && "$@" grep export cd
+		test x=1 && test 2>/dev/null -eu 2>/dev/null then --verbose --verbose 'quoted text'
+	printf 'quoted text' echo
+	/usr/bin local cd $(pwd) awk | grep then
+	| sed awk ${HOME} test cd
+2>/dev/null export | ${HOME} test 'quoted text' test printf 2>/dev/null 'quoted text'
+		grep printf "$1" then -eu /usr/bin cd local /usr/bin
+	printf test done ${HOME} -eu echo 'quoted text' local ${HOME} "$@" test &&
+/usr/bin && 'quoted text' -eu --verbose done x=1 --verbose
+awk local local $(pwd) readonly | ${HOME} printf local printf readonly 'quoted text'
+'quoted text' 'quoted text' printf x=1 /usr/bin
+then "$1" readonly awk "$1" 2>/dev/null && 'quoted text' then
+	local sed readonly $(pwd) | --verbose -eu 'quoted text' x=1 awk /usr/bin test
+${HOME} local grep | ${HOME} sed cd then readonly
+readonly && then test ${HOME} export readonly 2>/dev/null
+2>/dev/null 2>/dev/null -eu awk
+	test "$1" | echo 2>/dev/null then echo grep | "$1" "$1" ${HOME} awk test --verbose
+	--verbose export export /usr/bin /usr/bin x=1
+		"$1" 'quoted text' 2>/dev/null "$1" printf echo then | sed 'quoted text' export
+	echo --verbose $(pwd) "$@" done echo cd sed | "$@" grep export test then
+	local export cd | x=1 "$1" ${HOME}
+		local sed $(pwd) /usr/bin --verbose done then | printf /usr/bin
+	then -eu cd ${HOME} export 2>/dev/null awk readonly grep export readonly 2>/dev/null
+		readonly -eu -eu cd $(pwd) grep then 'quoted text' done cd "$1"
+	$(pwd) "$1" "$1" -eu test "$@" cd
+	"$@" sed -eu sed --verbose 'quoted text' 2>/dev/null
+	x=1 readonly readonly cd awk "$@" --verbose
+| | 'quoted text' cd "$@" echo test "$@" /usr/bin | done done
+	2>/dev/null grep /usr/bin "$@" && export local && done "$1" readonly
+	done "$1" then echo $(pwd)
+	done cd grep $(pwd) readonly printf -eu ${HOME} export cd done export
+-eu 'quoted text' local local "$1" 'quoted text' 2>/dev/null "$@" | local
+cd local echo done grep
+&& --verbose 'quoted text' | awk && /usr/bin
+		export printf 2>/dev/null grep ${HOME} printf x=1 cd export local $(pwd) test
+		-eu x=1 local 'quoted text' && done -eu then | --verbose 'quoted text'
+		2>/dev/null "$1" | 'quoted text' "$@" echo
+/usr/bin 2>/dev/null awk /usr/bin --verbose grep awk "$@" 'quoted text'
+"$1" /usr/bin grep sed 'quoted text' /usr/bin
+	| done then test $(pwd) "$1"
+	&& then awk sed test cd grep x=1 "$@" readonly grep printf test "$@" echo
+		done | then done cd local ${HOME} echo
+	-eu $(pwd) done | done grep awk x=1 local "$1" x=1 "$1" cd test
+printf 2>/dev/null local sed
+		--verbose -eu done readonly
+${HOME} done 2>/dev/null /usr/bin done readonly printf --verbose local grep
+		$(pwd) done | printf test 'quoted text' && /usr/bin "$1" && "$1" "$1" -eu awk
+"$1" export grep local --verbose 2>/dev/null
+		2>/dev/null ${HOME} grep awk local 'quoted text' --verbose -eu /usr/bin
+		test awk && ${HOME} 2>/dev/null x=1 test ${HOME}
+		${HOME} 2>/dev/null --verbose awk $(pwd) echo 'quoted text'
+	export 'quoted text' cd | 2>/dev/null "$@" "$@" sed "$1" "$@" echo then
+		local x=1 $(pwd) echo done printf awk sed --verbose | printf | | cd "$@"
+	--verbose cd local echo x=1 | 2>/dev/null "$@" echo printf $(pwd) x=1 export done
+	echo test /usr/bin test "$1" && readonly cd sed | /usr/bin "$@"
+		/usr/bin echo grep && "$@" "$1" echo /usr/bin "$@" then
+		done cd 'quoted text' ${HOME} && ${HOME} $(pwd) /usr/bin
+--verbose awk --verbose | 2>/dev/null
+$(pwd) grep readonly -eu awk printf --verbose x=1 then done echo &&
+	local printf sed | "$@" --verbose "$1" /usr/bin "$1" "$@" ${HOME}
+	2>/dev/null "$1" sed sed local awk
+readonly printf grep sed 2>/dev/null grep /usr/bin grep $(pwd) local export --verbose
+		"$1" ${HOME} export 'quoted text' local test && ${HOME}
+	sed cd && 'quoted text' awk echo export cd | 'quoted text'
+done test sed "$1" ${HOME} printf x=1 && --verbose
+	-eu --verbose -eu --verbose "$1" test done 2>/dev/null
+x=1 -eu ${HOME} $(pwd) sed test printf
+		-eu readonly --verbose /usr/bin readonly
+/usr/bin --verbose export awk then ${HOME} | export 2>/dev/null cd
+		then /usr/bin 'quoted text' local cd
+	/usr/bin x=1 2>/dev/null $(pwd) awk readonly -eu local /usr/bin 'quoted text'
+test /usr/bin | && x=1 awk readonly "$1" "$@" cd "$@" done done
+		$(pwd) /usr/bin sed readonly --verbose -eu
+--verbose | $(pwd) printf "$1"
+$(pwd) cd local printf /usr/bin $(pwd) readonly /usr/bin readonly cd
+local readonly | -eu 2>/dev/null
+		'quoted text' then "$@" |
+		local && && echo 'quoted text' echo --verbose
+	readonly ${HOME} "$@" && local ${HOME} grep echo "$@" sed test
+	local --verbose sed awk ${HOME} --verbose readonly ${HOME} ${HOME}
+		${HOME} 2>/dev/null readonly && export | local x=1 --verbose 'quoted text'
+&& cd readonly "$1" $(pwd)
+		"$@" readonly 2>/dev/null
+		2>/dev/null cd cd /usr/bin -eu ${HOME} test grep 'quoted text' sed $(pwd) done
+-eu ${HOME} cd export x=1 awk then -eu
+		grep printf grep -eu cd
+	${HOME} ${HOME} -eu "$1" "$1" /usr/bin printf "$@"
+		export ${HOME} -eu sed 2>/dev/null export
+		sed "$@" done readonly $(pwd) done then "$@" then readonly "$@" printf
+		awk /usr/bin --verbose awk grep "$@" ${HOME} sed && && local
+		"$@" --verbose sed readonly | printf then grep local 2>/dev/null -eu test then
+	$(pwd) done readonly -eu "$1"
+readonly | local readonly
+local then then | -eu 'quoted text'
+	grep $(pwd) --verbose --verbose --verbose /usr/bin
+x=1 -eu sed /usr/bin then printf echo | local 2>/dev/null $(pwd) sed ${HOME}
+grep readonly && grep readonly
+readonly 2>/dev/null test
+	'quoted text' cd --verbose && | && readonly -eu test grep export cd test --verbose
+	echo | -eu | "$1" ${HOME} -eu done test cd printf
+	&& then sed | printf cd echo readonly echo
+		'quoted text' done local /usr/bin
+"$@" --verbose awk "$@" | -eu echo "$@" done "$1"
+	printf ${HOME} /usr/bin cd $(pwd) grep local -eu
+test local 'quoted text' awk /usr/bin local
+	test && "$@" test 'quoted text'
+		done grep grep test $(pwd) | export
+	$(pwd) /usr/bin --verbose echo local
+		-eu local then /usr/bin
+	printf && echo | $(pwd) export
+	x=1 ${HOME} readonly /usr/bin 'quoted text' --verbose echo echo done done x=1
+/usr/bin readonly echo readonly 2>/dev/null $(pwd) "$1"
+	-eu export done && sed readonly
+	printf readonly ${HOME} test cd
+	/usr/bin 2>/dev/null awk | echo 2>/dev/null ${HOME} 'quoted text'
+		awk readonly "$1" $(pwd)
+	echo && 'quoted text' x=1 readonly 'quoted text' 'quoted text' readonly
+	--verbose test printf then echo sed grep |
+	done ${HOME} then then awk awk "$@" | | 2>/dev/null 2>/dev/null echo
+	grep grep grep printf --verbose /usr/bin test 2>/dev/null cd x=1 "$1" cd && &&
+	then --verbose --verbose /usr/bin /usr/bin local echo /usr/bin x=1 grep echo
+		x=1 echo 2>/dev/null x=1 "$@" -eu /usr/bin | echo "$1" readonly ${HOME} x=1
+| then awk ${HOME} 'quoted text' cd 'quoted text' "$@" |
+	${HOME} echo 'quoted text' test "$@" then x=1 grep sed 2>/dev/null
+	"$1" 2>/dev/null readonly echo -eu $(pwd) -eu x=1
+'quoted text' grep cd /usr/bin readonly grep 'quoted text'
+		awk 'quoted text' -eu | then
+local 'quoted text' readonly --verbose
+	| x=1 sed done cd readonly -eu awk && grep grep "$@"
+readonly test && 2>/dev/null ${HOME} done done sed readonly
+	"$1" echo $(pwd) export grep -eu &&
+printf x=1 x=1 done 2>/dev/null local readonly sed
+done "$@" && cd "$1" | sed /usr/bin "$1" 'quoted text'
+	"$@" ${HOME} /usr/bin done 2>/dev/null sed | -eu local
+		export sed local cd test "$@"
+--verbose test echo | grep done x=1 done -eu
+2>/dev/null x=1 cd readonly readonly
+		printf done sed 2>/dev/null 'quoted text'
+done && sed local /usr/bin ${HOME} $(pwd) 'quoted text' && |
+'quoted text' $(pwd) grep 2>/dev/null && "$@" | -eu done --verbose && x=1 "$1"
+		echo $(pwd) cd sed && printf export --verbose
+		readonly grep | x=1 --verbose printf x=1 /usr/bin x=1 | readonly then test
+	${HOME} && local --verbose test test
+test "$@" --verbose ${HOME}
+"$1" cd local $(pwd) local 'quoted text' ${HOME}
+/usr/bin "$@" && && then | then grep
+	$(pwd) $(pwd) "$1" 'quoted text'
+		grep 'quoted text' ${HOME} cd "$@" done awk then ${HOME}
+	| $(pwd) readonly $(pwd)
+	"$@" && readonly /usr/bin awk local echo export printf
+grep | 'quoted text' test local echo echo
+	-eu ${HOME} export printf /usr/bin "$1" 2>/dev/null printf done readonly
+| /usr/bin -eu grep "$@" awk 'quoted text'
+		x=1 /usr/bin awk ${HOME} ${HOME}
+	cd grep then sed printf echo -eu && x=1 awk printf local /usr/bin && printf grep
+	awk test readonly x=1 | sed -eu "$@"
+	readonly "$1" 2>/dev/null test grep
+then printf 2>/dev/null done
+	local $(pwd) 'quoted text' | export | export export
+	x=1 2>/dev/null "$1" awk ${HOME} x=1 $(pwd)
+	done test awk readonly sed | -eu then grep $(pwd) echo sed
+	test /usr/bin export "$@" && "$1" local then -eu "$1" 'quoted text'
+grep done test "$1" readonly 2>/dev/null
+	echo $(pwd) --verbose -eu then "$@" 'quoted text' -eu "$@" 'quoted text' 'quoted text'
+		echo "$1" && $(pwd) then 2>/dev/null 2>/dev/null
+		'quoted text' x=1 sed 2>/dev/null x=1 'quoted text' "$@" ${HOME}
+	grep done -eu export --verbose
+then /usr/bin -eu $(pwd) test 'quoted text' echo && 'quoted text' export
+printf "$1" cd | $(pwd) grep cd test --verbose export 'quoted text'
+&& local 2>/dev/null /usr/bin ${HOME}
+	2>/dev/null test "$@" then then "$@" cd readonly ${HOME} cd $(pwd)
+	2>/dev/null 'quoted text' -eu $(pwd) awk echo
+-eu awk grep /usr/bin 'quoted text' "$@" local 2>/dev/null
+echo "$1" sed test && printf printf grep 2>/dev/null echo test "$1"
+		grep 'quoted text' sed
+	2>/dev/null awk /usr/bin then echo done awk done -eu
+	awk 'quoted text' "$1" cd "$@" | test then
+${HOME} /usr/bin awk "$1" ${HOME} grep && /usr/bin echo ${HOME} $(pwd) ${HOME}
+printf | x=1 export --verbose local test echo local cd -eu done done
+| | test local grep 'quoted text' readonly cd
+echo done "$@" 2>/dev/null
+		"$@" 2>/dev/null grep test /usr/bin
+		${HOME} printf then grep echo echo "$1" sed printf local export
+${HOME} grep export then sed 'quoted text'
+-eu awk awk then local cd printf export /usr/bin then "$@" | ${HOME}
+/usr/bin cd cd x=1 test
+		"$1" "$1" ${HOME} 'quoted text' "$1" local readonly readonly sed && grep $(pwd)
+		awk echo && local test export printf x=1 readonly sed cd
+test local -eu -eu 'quoted text'
+		printf export sed sed &&
+	export | -eu test 2>/dev/null export grep then then 'quoted text'
+	sed printf && local --verbose
+	cd readonly --verbose done
+		"$1" cd /usr/bin done ${HOME} 2>/dev/null /usr/bin
+		"$@" grep done cd sed done then | cd $(pwd) "$@" awk "$@"
+--verbose ${HOME} sed export
+${HOME} export grep ${HOME} done $(pwd) "$@" readonly
+		readonly local export -eu sed readonly awk --verbose printf ${HOME} grep |
+	&& readonly awk cd "$1" "$1" then sed ${HOME} x=1 grep /usr/bin /usr/bin echo grep
+printf cd 2>/dev/null cd local && x=1 "$1" /usr/bin $(pwd) sed 'quoted text'
+	grep && printf readonly
+cd then && cd export ${HOME} awk awk | --verbose /usr/bin 'quoted text'
+local --verbose cd sed readonly /usr/bin cd &&
+		"$@" export sed 'quoted text' 'quoted text' readonly "$@" /usr/bin readonly printf
+		done done | "$@" | cd | "$1" $(pwd) /usr/bin
+		&& grep test export grep --verbose $(pwd) | local "$1" export done /usr/bin echo
+		cd | /usr/bin cd awk test | export cd ${HOME} -eu /usr/bin
+		sed readonly "$@" awk && local x=1 "$1" && done | readonly &&
+	local then -eu -eu ${HOME} grep printf
+--verbose test printf -eu
+done echo printf echo then "$@" | $(pwd) | echo ${HOME} printf -eu echo | 2>/dev/null
+	export readonly ${HOME} local --verbose 2>/dev/null
+		&& readonly | cd local readonly grep cd test sed cd done test echo
+--verbose 2>/dev/null -eu awk done && grep 2>/dev/null export local x=1 $(pwd)
+		then test local printf ${HOME} export x=1
+		export export readonly | readonly
+		sed "$1" && /usr/bin grep $(pwd) awk
+		&& then "$@" echo 'quoted text' echo readonly cd 2>/dev/null grep cd 'quoted text'
+		-eu echo -eu awk ${HOME} sed grep printf sed readonly local sed
+		--verbose | printf sed --verbose test $(pwd) | x=1 && ${HOME} local
+		--verbose --verbose printf
+	${HOME} -eu "$@" readonly done ${HOME} cd cd $(pwd)
+	&& "$1" 'quoted text' local done echo --verbose
+	| export printf "$@" echo "$@" test done awk awk then readonly
+		--verbose done 2>/dev/null done
+--verbose grep local test readonly test -eu printf printf $(pwd) |
+	$(pwd) local ${HOME} echo ${HOME} x=1 test done
+		done done "$1" grep done | --verbose test 'quoted text'
+--verbose | printf 2>/dev/null sed -eu echo readonly | grep
+	readonly /usr/bin 2>/dev/null done /usr/bin | sed 2>/dev/null
+	local "$@" ${HOME} 2>/dev/null sed ${HOME} 'quoted text' 'quoted text'
+	printf then awk ${HOME} grep readonly
+	done done echo readonly | ${HOME} printf export grep --verbose then awk "$@"
+	/usr/bin done 'quoted text'
+echo x=1 awk done echo local sed --verbose awk && export done ${HOME} printf
+&& ${HOME} 'quoted text' x=1 local --verbose
+&& local "$@" 'quoted text' "$@" 'quoted text' 'quoted text' local
+		$(pwd) grep sed -eu awk readonly test sed done
+	awk "$@" printf echo awk test
+		cd cd grep ${HOME} "$1"
+		cd "$1" then "$1" "$@" sed "$1" 2>/dev/null | "$1" $(pwd) 'quoted text'
+done done $(pwd) "$@" then then export local grep && sed /usr/bin -eu readonly
+		"$@" cd x=1 $(pwd) ${HOME} x=1 test -eu $(pwd) && done "$1" printf readonly printf
+--verbose ${HOME} | then then
+		awk | grep test x=1 x=1 /usr/bin ${HOME} ${HOME} test
+then readonly x=1 $(pwd) awk cd
+		local then export done $(pwd) export test export test 'quoted text'
+		export && then "$@" | $(pwd) sed local | && local local echo
+		awk x=1 test "$1" | 2>/dev/null /usr/bin printf
+		$(pwd) sed then awk grep grep
+		&& then 'quoted text' --verbose sed done grep printf export echo export
+readonly -eu echo -eu ${HOME} && local -eu grep readonly
+2>/dev/null done export | "$@" 'quoted text' printf 2>/dev/null grep cd
+	/usr/bin readonly export &&
+| export awk test test
+test awk done "$@" "$@"
+sed grep "$@" export $(pwd) | 'quoted text' | | then
+		&& done 2>/dev/null "$1" /usr/bin
+printf awk test -eu printf sed sed 2>/dev/null /usr/bin
+	2>/dev/null $(pwd) echo readonly grep | echo echo
+	then x=1 test 'quoted text' then done
+		&& x=1 then "$@" $(pwd) -eu /usr/bin done echo cd echo local awk
+'quoted text' 'quoted text'
+		--verbose --verbose 'quoted text' | 'quoted text' echo export ${HOME} test
+	then awk sed readonly 'quoted text' 2>/dev/null awk /usr/bin
+	local -eu "$1" done /usr/bin echo done "$@" readonly /usr/bin
+	cd printf done /usr/bin
+then awk "$1" readonly cd awk -eu local "$@" export -eu
+		--verbose readonly export printf printf then echo
+printf 'quoted text' ${HOME} then
+		$(pwd) | done x=1 | then printf echo
+	${HOME} --verbose local export $(pwd) done
+	2>/dev/null "$@" readonly && -eu "$1" 'quoted text' "$1" export
+printf cd then --verbose && 2>/dev/null
+	x=1 awk | $(pwd) ${HOME} | sed --verbose $(pwd)
+	export awk /usr/bin echo then cd 'quoted text' export
+local awk printf echo printf "$@" readonly --verbose export -eu cd 'quoted text'
+		local then /usr/bin grep x=1 echo $(pwd)
+/usr/bin "$1" ${HOME} 'quoted text' x=1 grep /usr/bin export | then
+		sed 2>/dev/null test && /usr/bin /usr/bin echo readonly printf $(pwd)
+readonly local | printf && readonly then && grep
+		| test /usr/bin test "$@" /usr/bin /usr/bin
+	then then --verbose x=1 grep && printf local grep cd cd
+/usr/bin export 'quoted text' "$@"
+	"$@" test cd --verbose 2>/dev/null local test
+	-eu awk "$@" ${HOME} "$1" readonly ${HOME} sed /usr/bin
+awk grep then done $(pwd) "$1" -eu 2>/dev/null /usr/bin
+awk ${HOME} done && /usr/bin grep test grep && ${HOME} then "$1" sed 'quoted text'
+-eu readonly | sed "$@" --verbose
+	&& "$1" grep -eu sed export 'quoted text' && grep 'quoted text'
+	echo readonly sed cd test export --verbose
+	then $(pwd) | "$@" sed sed local --verbose readonly readonly then
+		printf grep readonly $(pwd) then $(pwd) | done --verbose /usr/bin
+"$@" then -eu "$1" test echo printf --verbose 'quoted text' x=1 echo | "$@"
+2>/dev/null --verbose --verbose cd ${HOME} &&
+done grep -eu test then | "$1" then "$@" export $(pwd)
+cd 'quoted text' local local grep -eu grep
+test 2>/dev/null x=1 test | export sed 2>/dev/null 2>/dev/null echo
+	then printf export ${HOME} readonly sed sed --verbose | cd $(pwd)
+	-eu "$1" --verbose 2>/dev/null export echo
+	cd readonly -eu printf "$@" test printf readonly $(pwd) awk /usr/bin
+"$1" readonly && $(pwd)
+	"$@" 'quoted text' test && sed sed local /usr/bin
+		2>/dev/null done cd test awk x=1 "$1" "$@" "$@" 'quoted text' echo 2>/dev/null
+	sed done done printf -eu
+	export export /usr/bin 'quoted text' 'quoted text' then sed awk && test && sed
+		-eu export "$@" x=1 | test readonly /usr/bin
+		&& then readonly 'quoted text'
+cd export cd x=1 $(pwd) echo 2>/dev/null
+	cd sed grep x=1 export ${HOME} | awk grep export readonly echo 'quoted text'
+local "$@" then awk echo sed cd | sed 2>/dev/null
+		/usr/bin --verbose export x=1 /usr/bin echo local -eu grep --verbose
+	$(pwd) cd -eu | $(pwd) cd && export local
+local then done local awk 'quoted text'
+		'quoted text' cd echo "$1" x=1 echo "$1" x=1 test "$@" test grep && 2>/dev/null
+cd "$@" then export /usr/bin
+readonly then /usr/bin
+		/usr/bin done then "$1" echo ${HOME} $(pwd) done
+-eu && readonly export sed $(pwd) /usr/bin done readonly
+	printf awk | grep --verbose "$@" readonly cd --verbose $(pwd) printf done
+"$1" ${HOME} cd test 2>/dev/null 2>/dev/null
+&& awk echo "$@" "$1" sed -eu
+	"$1" 'quoted text' $(pwd) sed /usr/bin grep 'quoted text' /usr/bin then
+'quoted text' export export -eu /usr/bin grep sed $(pwd) test "$@" then | &&
+		| 'quoted text' test | "$@" "$1" ${HOME} --verbose
+		sed 2>/dev/null "$1" test echo then /usr/bin --verbose grep grep grep
+	--verbose "$@" ${HOME} && x=1
+		| $(pwd) echo awk printf ${HOME} cd --verbose cd sed "$@" "$@" readonly
+readonly --verbose export /usr/bin sed printf printf awk
+	"$@" readonly done 'quoted text' awk cd export then -eu /usr/bin "$@" x=1
+		echo 'quoted text' x=1 "$@" x=1 ${HOME} --verbose ${HOME} awk x=1 /usr/bin then
+2>/dev/null -eu "$@" -eu ${HOME} readonly sed done done sed then &&
+		awk /usr/bin echo /usr/bin x=1 'quoted text'
+		${HOME} printf "$@" x=1 2>/dev/null echo /usr/bin --verbose
+	--verbose then ${HOME} then && "$1" readonly x=1 sed printf 'quoted text'
+		--verbose $(pwd) $(pwd) cd | readonly export
+	'quoted text' "$@" "$@"
+grep "$1" | printf export then then printf sed "$1"
+		"$@" cd export cd $(pwd) "$1" grep readonly cd --verbose
+		"$1" -eu sed && x=1 /usr/bin ${HOME}
+		test readonly && --verbose "$@" ${HOME}
+then x=1 $(pwd) echo /usr/bin sed --verbose local printf done
+readonly 2>/dev/null ${HOME} export && -eu
+		printf 2>/dev/null --verbose /usr/bin
+		done cd local echo -eu -eu 2>/dev/null done $(pwd) -eu | awk local
+&& export printf then --verbose test | -eu ${HOME} cd echo $(pwd) echo awk printf
+x=1 echo ${HOME} then -eu grep test then grep local 'quoted text' 'quoted text'
+		'quoted text' echo test local $(pwd) 'quoted text' "$1" awk
+cd && -eu | done export done grep grep | export && readonly
+	/usr/bin readonly x=1 local
+	test x=1 cd $(pwd) readonly printf grep printf
+		-eu export grep 2>/dev/null x=1 --verbose -eu test sed grep --verbose
+	export test then readonly
+		local echo sed local 'quoted text' sed
+		--verbose /usr/bin $(pwd) "$@" ${HOME} local -eu -eu
+		-eu then awk cd ${HOME} export 2>/dev/null $(pwd) 'quoted text'
+	'quoted text' cd local cd
+printf cd then | --verbose sed grep printf
+	| sed export --verbose -eu awk | grep | local then
+	echo printf 2>/dev/null readonly -eu
+sed then ${HOME} "$@" --verbose local readonly printf "$1" "$@"
+awk cd && $(pwd) export local | 'quoted text' readonly "$1" ${HOME}
+		'quoted text' awk cd test "$1" ${HOME} $(pwd) ${HOME} 2>/dev/null
+	2>/dev/null local 'quoted text' test sed test "$1" "$1" x=1
+	'quoted text' printf export export
+printf ${HOME} 'quoted text' /usr/bin "$1" -eu
+export local readonly sed 2>/dev/null cd x=1 done && --verbose
+		echo 'quoted text' /usr/bin then "$1" --verbose export "$1" export
+"$@" done echo readonly /usr/bin grep x=1 export x=1 | 2>/dev/null readonly
+	"$@" test 'quoted text' export 'quoted text'
+	${HOME} local export "$@" sed local done "$@" cd done "$@" then 2>/dev/null
+	"$1" x=1 --verbose echo && sed 2>/dev/null --verbose awk
+	| done readonly grep echo local printf
+		readonly cd cd --verbose "$@" "$@"
+		$(pwd) export --verbose --verbose 2>/dev/null $(pwd) cd --verbose local | $(pwd)
+	echo cd export "$1" echo sed | local local ${HOME} printf grep --verbose
+		grep $(pwd) done && local && local "$@" cd "$@" readonly local
+local x=1 x=1 done printf local sed "$@" -eu then -eu -eu --verbose /usr/bin
+	readonly test x=1 test /usr/bin
+		local "$@" 2>/dev/null export 'quoted text'
+		2>/dev/null x=1 export ${HOME}
+	&& export test --verbose x=1 cd local /usr/bin cd /usr/bin then -eu grep export
+sed sed export readonly test readonly grep cd -eu "$@" printf done then
+		grep done awk awk $(pwd) test then export | "$1" ${HOME} test && cd /usr/bin
+		${HOME} $(pwd) echo then echo test grep ${HOME} | export awk -eu readonly
+		then echo ${HOME} test $(pwd)
+		printf cd -eu ${HOME} && 2>/dev/null test x=1 sed 2>/dev/null $(pwd) cd echo printf
+	"$@" printf && | ${HOME} 2>/dev/null "$1" | echo echo
+| export readonly $(pwd) export "$@" grep | cd 2>/dev/null --verbose $(pwd)
+	$(pwd) -eu $(pwd) "$@" 'quoted text' grep local --verbose local sed then local
+x=1 awk $(pwd) cd --verbose ${HOME}
+	'quoted text' export printf /usr/bin 2>/dev/null --verbose
+	echo export sed --verbose sed 'quoted text' 2>/dev/null
+	&& | -eu grep && sed awk readonly --verbose cd then export local
+		'quoted text' grep ${HOME} then && done x=1 printf grep 'quoted text'
+	export $(pwd) -eu x=1 export --verbose sed
+| echo "$1" cd awk 2>/dev/null readonly readonly
+grep $(pwd) echo readonly
+awk 2>/dev/null && 'quoted text' awk
+x=1 local grep 2>/dev/null 2>/dev/null grep test | 'quoted text' awk | grep &&
+		/usr/bin test test local -eu local "$1" "$@" "$@" readonly done
+export && local -eu ${HOME} && test $(pwd) "$1" test done
+		-eu --verbose test 'quoted text' && readonly $(pwd)
+&& ${HOME} test local then
+	local x=1 $(pwd) sed readonly grep $(pwd) grep cd -eu test awk printf $(pwd) then
+	cd test readonly readonly echo readonly
+		test awk echo printf /usr/bin $(pwd) printf --verbose | "$1" readonly
+	export x=1 $(pwd) export local /usr/bin | "$1" export $(pwd) $(pwd) "$1"
+	test --verbose export ${HOME} x=1 echo done $(pwd) "$@"
+	printf /usr/bin readonly | awk ${HOME} 'quoted text'
+		printf "$@" $(pwd) $(pwd) ${HOME}
+	"$@" grep 'quoted text' test sed export | 'quoted text' | -eu 2>/dev/null ${HOME}
+		readonly 'quoted text' 2>/dev/null done 'quoted text' --verbose
+		&& "$@" local "$1" 'quoted text' && ${HOME} ${HOME} readonly then
+		x=1 done test readonly && 'quoted text' sed "$@" -eu awk /usr/bin x=1 'quoted text'
+readonly local awk "$@" printf ${HOME} 2>/dev/null ${HOME} sed 2>/dev/null &&
+		| export done /usr/bin done local 'quoted text' echo $(pwd) && echo awk
+-eu then --verbose $(pwd) ${HOME} printf "$@" $(pwd) 'quoted text'
+${HOME} readonly /usr/bin && x=1 | ${HOME} echo printf export 2>/dev/null
+done sed test x=1 grep 2>/dev/null /usr/bin test test "$1"
+	&& "$@" then 'quoted text' --verbose awk done && 2>/dev/null
+		export 'quoted text' "$@" "$1" echo ${HOME}
+		awk cd local cd "$1" | x=1 /usr/bin echo test done test /usr/bin cd local
+sed 'quoted text' echo
+done done --verbose grep ${HOME} done 'quoted text' cd
+		2>/dev/null sed && grep && printf awk
+		'quoted text' | test export
+	local export 'quoted text' /usr/bin $(pwd) ${HOME} awk ${HOME} grep
+then --verbose printf test $(pwd)
+	&& $(pwd) sed /usr/bin --verbose -eu awk | echo sed grep readonly sed "$@" "$1"
+	&& x=1 ${HOME} | done --verbose then /usr/bin /usr/bin
+export echo grep "$@" awk
+"$1" --verbose cd /usr/bin && "$1"
+&& -eu -eu "$1" x=1 /usr/bin awk 'quoted text'
+&& sed && then export cd echo local echo echo readonly -eu ${HOME} printf 2>/dev/null
+	done --verbose local $(pwd) "$@" printf export | export readonly -eu
+x=1 grep "$@" 2>/dev/null -eu | grep x=1
+local $(pwd) export done x=1 awk | 2>/dev/null
+	printf | test $(pwd) --verbose grep awk grep && awk
+		&& -eu grep done /usr/bin done then awk /usr/bin echo 2>/dev/null done
+		'quoted text' && sed awk test 2>/dev/null
+		local | echo awk echo
+		done echo 'quoted text' readonly cd "$@"
+		x=1 echo ${HOME} -eu "$@" 2>/dev/null local printf "$@" $(pwd) ${HOME}
+${HOME} 'quoted text' awk -eu sed readonly readonly then cd "$@" "$@" $(pwd)
+	$(pwd) cd x=1 /usr/bin | /usr/bin awk | echo x=1 cd echo grep x=1 "$@" 2>/dev/null
+		echo -eu && 2>/dev/null x=1 test | sed
+	test grep && export --verbose awk local | /usr/bin local sed x=1 && "$@" 'quoted text'
+	x=1 2>/dev/null --verbose awk 'quoted text' 'quoted text' then
+test "$1" readonly | printf sed grep $(pwd)
+	local printf then local echo --verbose $(pwd) then printf -eu "$@"
+	readonly -eu cd /usr/bin x=1
+		echo test --verbose -eu /usr/bin /usr/bin test sed x=1 then -eu
+--verbose printf printf && "$@" && sed export ${HOME} && --verbose grep test
+		readonly printf cd -eu && 2>/dev/null echo 'quoted text'
+		/usr/bin $(pwd) local readonly
+	'quoted text' "$@" x=1 ${HOME} grep
+		readonly then 'quoted text' --verbose "$@" 'quoted text' readonly
+	&& export sed sed sed grep printf export export && done ${HOME}
+then test cd test -eu /usr/bin done readonly echo export
+		-eu then export echo echo --verbose
+/usr/bin | printf echo /usr/bin grep echo test -eu printf 'quoted text'
+		'quoted text' 'quoted text' -eu 'quoted text' 2>/dev/null echo
+	readonly export 2>/dev/null done x=1 "$@" printf echo readonly
+readonly readonly grep
+	2>/dev/null | test grep sed "$1" | export
+	test 2>/dev/null export /usr/bin && readonly "$@" $(pwd) x=1 "$1" export
+readonly ${HOME} x=1 done
+	printf cd readonly | sed /usr/bin ${HOME}
+printf grep -eu cd 2>/dev/null cd sed then
+	test cd then then test
+printf sed cd local printf sed "$1" -eu "$1" 'quoted text'
+	2>/dev/null -eu export $(pwd) cd readonly awk "$1" sed
+		done --verbose -eu then readonly export "$1" /usr/bin ${HOME} ${HOME} printf 2>/dev/null
+"$1" | /usr/bin done 2>/dev/null ${HOME} && | x=1 local "$1" printf | -eu
+export export 'quoted text' x=1 sed cd readonly && | $(pwd) done
+"$@" local grep readonly "$1" "$1" readonly cd 2>/dev/null
+		'quoted text' cd test echo local "$@" 'quoted text' --verbose echo $(pwd) test
+		--verbose 2>/dev/null printf
+	"$1" done local local then grep && /usr/bin export grep "$1" printf /usr/bin
+	test --verbose then then sed done $(pwd) 'quoted text' --verbose then
+	${HOME} "$@" printf -eu x=1 | /usr/bin | local | sed && --verbose grep $(pwd) "$@"
+sed && done /usr/bin "$1"
+	then && $(pwd) done sed local printf
+"$@" echo "$@" export sed
+$(pwd) export 'quoted text' printf cd export cd
+	grep --verbose awk local ${HOME}
+		x=1 "$1" -eu ${HOME} 2>/dev/null | awk | && then | && export
+	| sed test export echo && awk --verbose 'quoted text' ${HOME} "$@" $(pwd) $(pwd)
+	local echo "$@" "$1" grep sed
+test "$@" cd done 2>/dev/null awk local done export -eu readonly
+		"$1" echo x=1 --verbose --verbose --verbose | sed local printf /usr/bin ${HOME}
+		| cd cd cd awk /usr/bin x=1 readonly echo awk grep /usr/bin
+		echo 2>/dev/null local then test awk /usr/bin x=1 $(pwd) /usr/bin
+	echo "$1" local then printf
+	2>/dev/null echo then grep readonly readonly sed --verbose "$1"
+		${HOME} | -eu export
+local readonly --verbose awk done readonly cd 2>/dev/null -eu $(pwd) "$1"
+	grep awk readonly 2>/dev/null "$@" --verbose 'quoted text'
+echo grep "$@" --verbose then ${HOME} | ${HOME} x=1 "$@"
+	--verbose grep awk "$@" ${HOME} -eu $(pwd) then ${HOME} grep
+		"$@" $(pwd) export && printf test
+	x=1 'quoted text' "$1" cd "$1" | 2>/dev/null 2>/dev/null
+	done --verbose awk sed test $(pwd) test cd ${HOME} awk readonly awk done echo grep
+	"$@" echo "$@" grep export then ${HOME} local 2>/dev/null grep
+awk export $(pwd) "$1" awk 'quoted text' cd | "$@" $(pwd)
+		then awk "$@" ${HOME} sed export
+		cd cd && echo 'quoted text' | echo
+		--verbose export awk 2>/dev/null done "$1" readonly ${HOME} | printf
+		'quoted text' | sed awk 'quoted text' printf x=1 export
+		&& local -eu | && sed awk x=1 $(pwd) -eu test printf printf 2>/dev/null
+${HOME} echo sed export "$@" 2>/dev/null cd -eu
+	--verbose "$@" echo /usr/bin 'quoted text' $(pwd) then "$1" "$@" --verbose
+		&& /usr/bin $(pwd) -eu then 'quoted text'
+export /usr/bin local 2>/dev/null /usr/bin x=1 && && $(pwd) ${HOME}
+		done -eu sed echo readonly --verbose echo 'quoted text'
+		export /usr/bin done -eu 'quoted text' ${HOME} cd /usr/bin $(pwd)
+	cd x=1 --verbose -eu readonly
+		/usr/bin local sed | "$@"
+		test /usr/bin && 2>/dev/null --verbose /usr/bin awk 'quoted text' printf -eu
+	| "$@" 2>/dev/null -eu echo -eu export cd then local
+		x=1 local sed | echo grep awk then "$1" cd 'quoted text' $(pwd)
+/usr/bin then sed 'quoted text' cd readonly --verbose
+$(pwd) sed then local then "$@" /usr/bin --verbose
+then 'quoted text' /usr/bin export
+	'quoted text' ${HOME} export
+		"$1" ${HOME} printf x=1 | && 2>/dev/null | test 2>/dev/null printf grep test done
+	--verbose -eu test done grep export "$@" 'quoted text' echo
+local $(pwd) then --verbose 'quoted text'
+echo local "$@" 'quoted text' grep 2>/dev/null printf $(pwd) sed 2>/dev/null
+		"$1" ${HOME} local 'quoted text'
+--verbose | readonly
+done local then readonly x=1 printf
+		&& echo then 2>/dev/null x=1 test then ${HOME} cd -eu test $(pwd) -eu printf
+local cd && && -eu "$@" sed
+		&& awk local printf done export awk local
+x=1 2>/dev/null && && grep "$1" sed --verbose /usr/bin printf /usr/bin "$1"
+2>/dev/null $(pwd) "$1"
+	done /usr/bin && done sed readonly ${HOME}
+"$@" test cd local 'quoted text' readonly done awk test --verbose
+	"$@" --verbose readonly cd
+done /usr/bin local $(pwd) grep $(pwd) /usr/bin test export readonly test
+		test -eu cd done 'quoted text' then "$1" && export $(pwd)
+		then --verbose 2>/dev/null --verbose printf readonly /usr/bin readonly | readonly
+	&& export local readonly "$1" grep export done printf test then 'quoted text'
+readonly 'quoted text' && grep "$@"
+		"$1" export sed echo "$1" 'quoted text' && readonly readonly export
+	sed echo done "$1" done test
+	${HOME} awk done echo readonly test x=1 readonly 2>/dev/null
+&& test printf | "$1" cd x=1 'quoted text' 'quoted text' sed ${HOME} "$1" readonly
+		test 'quoted text' x=1 cd $(pwd) x=1 $(pwd) 2>/dev/null /usr/bin 'quoted text'
+	'quoted text' && then done && && export && 2>/dev/null cd /usr/bin "$@"
+grep done local sed printf --verbose "$1" printf export --verbose export
+	readonly 'quoted text' then ${HOME} done cd 2>/dev/null grep cd "$1" test $(pwd)
+echo --verbose readonly cd test && grep --verbose ${HOME} grep --verbose
+	sed grep ${HOME} "$@" -eu test 2>/dev/null
+readonly && then | printf then
+	2>/dev/null sed test 'quoted text'
+		readonly x=1 readonly sed "$@" --verbose "$@" $(pwd) $(pwd) /usr/bin
+	then /usr/bin awk "$@" readonly local 'quoted text' awk sed grep local awk grep
+		/usr/bin | echo -eu $(pwd) | 2>/dev/null "$@" then -eu awk awk "$1" test ${HOME}
+		/usr/bin done --verbose
+		"$1" $(pwd) x=1 readonly "$@" "$1"
+'quoted text' 2>/dev/null printf 'quoted text'
+done | test -eu x=1 --verbose 'quoted text' printf done && x=1
+x=1 "$1" test ${HOME}
+	echo cd test $(pwd) done grep --verbose sed
+	then export 2>/dev/null x=1 && ${HOME} 'quoted text'
+test 2>/dev/null "$@" readonly "$@" $(pwd)
+--verbose 'quoted text' 'quoted text'
+		local $(pwd) -eu echo -eu readonly 'quoted text' /usr/bin
+		cd x=1 ${HOME} x=1 | --verbose
+readonly "$@" cd grep "$@" /usr/bin --verbose
+		-eu "$1" | sed printf "$@" x=1 --verbose "$@" printf echo
+	"$1" printf 2>/dev/null awk $(pwd) then ${HOME} test $(pwd) && grep --verbose
+export "$1" awk awk echo $(pwd) cd 2>/dev/null
+'quoted text' && ${HOME} echo | export 'quoted text' 2>/dev/null && "$@" ${HOME}
+	--verbose test then sed cd grep "$@" printf
+	&& && ${HOME} --verbose readonly readonly | test -eu readonly
+	2>/dev/null sed cd $(pwd) && /usr/bin -eu printf -eu $(pwd) ${HOME} cd then &&
+		-eu -eu local | && -eu echo 2>/dev/null
+		"$1" printf printf local | 2>/dev/null 2>/dev/null --verbose
+		test "$1" --verbose /usr/bin /usr/bin -eu local sed | printf
+grep cd awk cd && local readonly
+		--verbose local x=1 ${HOME} sed ${HOME} /usr/bin test printf
+		test "$1" export then grep sed 'quoted text' printf
+cd 'quoted text' 'quoted text' echo local cd --verbose readonly done readonly
+		readonly done -eu export done sed ${HOME} 'quoted text' readonly grep 'quoted text'
+2>/dev/null 2>/dev/null test
+	| 'quoted text' ${HOME} --verbose | printf export ${HOME} "$@" | done "$@"
+local /usr/bin cd ${HOME} $(pwd) cd grep "$1"
+$(pwd) grep export ${HOME} "$1" done && 'quoted text' 2>/dev/null "$1" 2>/dev/null
+readonly x=1 'quoted text' then "$1" local
+	awk $(pwd) 'quoted text' then
+		awk -eu && --verbose "$@" -eu x=1 local
+readonly -eu -eu readonly "$@" test && awk 2>/dev/null x=1 echo cd
+		"$1" $(pwd) local cd sed "$1"
+	done awk --verbose test test awk --verbose
+		| | ${HOME} ${HOME} then sed local readonly
+echo 2>/dev/null $(pwd) readonly echo readonly test test $(pwd) ${HOME} |
+	cd 2>/dev/null 'quoted text' then awk echo echo readonly "$1" then 2>/dev/null
+		$(pwd) 'quoted text' "$1" | x=1 done then done "$1" 'quoted text' "$1"
+test /usr/bin $(pwd) "$@" done x=1 grep
+		awk $(pwd) "$1" awk ${HOME} --verbose then |
+		"$1" echo 'quoted text' export then x=1 export | grep sed grep x=1
+	"$@" awk awk export local grep 2>/dev/null ${HOME} cd 2>/dev/null export
+"$@" "$@" local 'quoted text' x=1 && -eu
+		export "$1" readonly printf awk | echo awk local grep
+	--verbose 2>/dev/null 2>/dev/null -eu echo ${HOME} grep -eu 2>/dev/null ${HOME}
+	${HOME} && readonly x=1 printf cd done grep readonly then local
+local ${HOME} | && local
+printf done ${HOME} /usr/bin $(pwd) echo then
+&& /usr/bin readonly export
+echo /usr/bin sed x=1 awk cd cd 2>/dev/null $(pwd) sed 'quoted text' x=1 echo
+	&& test cd && "$1" export local export ${HOME} test readonly 2>/dev/null
+--verbose --verbose -eu 2>/dev/null $(pwd) awk readonly "$@" awk
+	grep "$@" sed readonly done cd test --verbose 'quoted text'
+	then done ${HOME} ${HOME} export test --verbose -eu echo | ${HOME}
+| cd test x=1 ${HOME} &&
+	local 2>/dev/null export
+done ${HOME} ${HOME} echo 'quoted text'
+	| /usr/bin ${HOME} done cd
+cd "$1" printf echo awk 'quoted text' readonly | && grep test
+--verbose test 'quoted text' grep test x=1 2>/dev/null
+		/usr/bin "$@" then ${HOME} /usr/bin export
+		local x=1 'quoted text' awk | /usr/bin && echo
+local x=1 /usr/bin /usr/bin
+'quoted text' $(pwd) readonly
+-eu "$@" "$@" export local
+		readonly export done 'quoted text' printf $(pwd) echo "$@" readonly done 2>/dev/null
+		"$@" readonly export 'quoted text' cd --verbose sed awk --verbose --verbose
+		awk done -eu | test ${HOME} 2>/dev/null echo && cd test local |
+awk then /usr/bin 'quoted text' --verbose then awk then x=1 'quoted text'
+	then -eu "$1" done export echo "$1" "$1"
+	--verbose export done -eu $(pwd) && echo export
+	sed | awk done "$@" /usr/bin sed sed printf echo sed export "$1" grep
+	"$1" export ${HOME} export /usr/bin echo --verbose readonly ${HOME} test grep
+		x=1 "$1" awk export 2>/dev/null
+	x=1 awk echo test x=1 "$1" local test "$1" /usr/bin 2>/dev/null printf
+	echo readonly --verbose echo local sed export "$@" 'quoted text'
+	x=1 grep 'quoted text' && local "$1" local && grep cd printf
+	x=1 echo x=1 printf cd --verbose /usr/bin done export
+	sed readonly | printf $(pwd) awk
+awk --verbose sed grep printf grep 2>/dev/null done $(pwd)
+readonly then done "$1"
+local test done x=1 then -eu cd cd printf --verbose
+		printf test x=1 grep /usr/bin 2>/dev/null ${HOME} "$@" -eu sed && "$1" sed
+$(pwd) 2>/dev/null awk $(pwd) export x=1 cd test sed
+$(pwd) done then local awk
+	readonly ${HOME} printf then awk | printf &&
+export 'quoted text' export test echo sed | readonly |
+		sed 'quoted text' --verbose readonly ${HOME} sed cd cd readonly
+		echo $(pwd) 2>/dev/null /usr/bin sed sed 2>/dev/null sed $(pwd) $(pwd) /usr/bin
+	sed echo ${HOME} ${HOME} x=1 && | | x=1 -eu $(pwd)
+	echo then "$1" cd grep 2>/dev/null $(pwd) awk grep 'quoted text' | export
+	"$@" grep printf cd local
+grep "$@" "$1" "$1" /usr/bin $(pwd) && "$1" then -eu
+	"$1" x=1 "$1" 2>/dev/null |
+		-eu | test cd awk readonly
+		export | 'quoted text' 'quoted text' | --verbose -eu x=1 done --verbose | 'quoted text'
+test done "$1" | x=1 $(pwd) export "$@" /usr/bin awk cd "$@" grep | $(pwd)
+	--verbose printf printf done printf
+	"$1" x=1 /usr/bin "$@" printf --verbose
+		export cd sed printf awk grep 'quoted text' "$@" ${HOME} awk "$@" export sed export
+	readonly test sed readonly export
+export export printf | sed | -eu done | local 'quoted text' cd -eu ${HOME}
+		| readonly cd "$@" | awk grep | x=1 "$@" $(pwd)
+		/usr/bin "$@" --verbose "$1" 2>/dev/null test | done readonly 2>/dev/null
+--verbose awk --verbose "$@" local export -eu 'quoted text' awk then ${HOME}
+	/usr/bin readonly done x=1 export -eu $(pwd) /usr/bin cd 2>/dev/null export
+		&& readonly 'quoted text' echo local && -eu /usr/bin $(pwd)
+	cd test 'quoted text' grep cd readonly 2>/dev/null 'quoted text'
+	"$1" sed ${HOME} -eu test ${HOME} $(pwd) grep -eu ${HOME} "$1"
+then && then echo echo local && export | printf 2>/dev/null cd 2>/dev/null
+	"$@" ${HOME} | 'quoted text' grep awk grep printf test 'quoted text' 2>/dev/null
+	local | -eu ${HOME} printf
+	x=1 cd /usr/bin readonly
+$(pwd) export test sed export x=1 $(pwd) --verbose echo ${HOME}
+-eu sed --verbose ${HOME} $(pwd) test x=1 local
+		| local grep 'quoted text' 'quoted text' 2>/dev/null echo sed grep grep
+	printf && && $(pwd) --verbose export "$1" 'quoted text' sed ${HOME} "$1" --verbose
+	"$@" ${HOME} /usr/bin
+	/usr/bin echo awk cd | "$@" && local
+'quoted text' export 2>/dev/null
+		"$1" /usr/bin "$1" 'quoted text' "$@" 2>/dev/null awk /usr/bin then sed 'quoted text'
+		printf echo echo export awk
+readonly "$1" /usr/bin echo 2>/dev/null test echo
+	$(pwd) test /usr/bin local grep --verbose export test echo grep
+	x=1 -eu test "$1" x=1 readonly 2>/dev/null awk x=1 sed "$@"
+	export "$1" 'quoted text' awk 'quoted text' "$1" $(pwd) "$1" ${HOME}
+readonly done awk $(pwd) $(pwd)
+	readonly "$@" local /usr/bin -eu grep then
+		cd echo x=1 'quoted text' x=1
+"$1" 'quoted text' test export x=1 echo ${HOME} --verbose done cd -eu 2>/dev/null
+		cd && export sed 2>/dev/null local | printf "$@" local done $(pwd)
+		echo readonly && done test $(pwd) && ${HOME} $(pwd) $(pwd)
+		-eu ${HOME} printf && 'quoted text'
+	'quoted text' x=1 then --verbose /usr/bin done
+		'quoted text' -eu && 2>/dev/null --verbose then
+	2>/dev/null test printf "$@"
+	done && | cd && export then 2>/dev/null 'quoted text' 2>/dev/null
+grep $(pwd) && && --verbose awk test $(pwd) done && export
+cd 'quoted text' "$1" cd local export readonly "$1" x=1 printf readonly
+		then "$@" "$@" | "$@" | awk |
+		cd export --verbose 2>/dev/null 2>/dev/null
+		readonly local test done awk local && echo && "$@" -eu then
+		x=1 /usr/bin awk then grep grep done then $(pwd) "$1" sed export
+test done awk test $(pwd) local
+	echo -eu then -eu && ${HOME} export "$1" test printf -eu
+x=1 echo then -eu && x=1 done local "$@" 'quoted text' --verbose ${HOME}
+		awk local /usr/bin x=1 cd echo
+-eu "$1" --verbose 2>/dev/null echo "$1" | $(pwd) --verbose sed awk
+		2>/dev/null cd 'quoted text' printf && /usr/bin --verbose
+	test export "$1" && /usr/bin /usr/bin
+		-eu x=1 $(pwd) x=1 2>/dev/null grep $(pwd) echo "$@" printf 2>/dev/null
+		sed echo --verbose -eu cd
+	x=1 -eu "$@" -eu "$1" 2>/dev/null $(pwd) cd then then "$@" && 2>/dev/null
+sed && /usr/bin awk && && then "$@" --verbose -eu grep ${HOME}
+		'quoted text' export /usr/bin
+		$(pwd) 2>/dev/null /usr/bin echo $(pwd)
+	-eu grep test grep 2>/dev/null
+-eu echo local /usr/bin then "$@" done
+	readonly x=1 test readonly echo
+		cd readonly "$1" done 2>/dev/null readonly "$1" printf /usr/bin echo
+		$(pwd) | printf /usr/bin test local 2>/dev/null 2>/dev/null
+	done -eu /usr/bin "$1" "$@"
+"$@" "$@" then done 2>/dev/null ${HOME} $(pwd)
+&& "$@" x=1 printf -eu grep 'quoted text' ${HOME} x=1 readonly then then awk echo
+	echo "$1" x=1 | awk awk readonly done local | ${HOME} | "$@" test printf
+readonly export done --verbose "$@"
+	x=1 -eu $(pwd) 2>/dev/null ${HOME} "$@" done echo
+		sed 'quoted text' awk export
+		export | x=1 then -eu sed echo cd -eu cd && | test
+		export ${HOME} "$1" |
+	| echo sed -eu | ${HOME} printf
+	| && | ${HOME} --verbose local echo -eu "$@" printf
+		cd --verbose cd echo awk x=1 echo echo "$@" 'quoted text'
+		"$1" printf done sed x=1 /usr/bin | readonly readonly 2>/dev/null
+	"$1" && "$1" sed sed printf sed awk "$1" grep then -eu
+2>/dev/null export /usr/bin
+	'quoted text' printf export | "$1" export readonly grep /usr/bin
+then -eu then readonly done 2>/dev/null echo ${HOME} local sed echo test export
+	sed cd ${HOME} printf readonly echo
+awk -eu 2>/dev/null /usr/bin
+		'quoted text' local x=1 export "$@" 2>/dev/null "$1" echo 2>/dev/null
+		then done /usr/bin readonly cd done sed
+$(pwd) /usr/bin 'quoted text' 2>/dev/null awk "$1" "$@" | /usr/bin /usr/bin | sed
+	--verbose local $(pwd) && then ${HOME} then --verbose echo 'quoted text'
+	export && test $(pwd) grep 'quoted text' local done "$@" local awk local sed
+		$(pwd) printf printf cd grep done /usr/bin cd /usr/bin ${HOME} awk
+x=1 grep then ${HOME} /usr/bin export "$1" echo export
+	--verbose readonly -eu
+	done --verbose 'quoted text' local printf printf 'quoted text'
+export cd x=1 | $(pwd) $(pwd) local -eu printf
+#include c156.sh
+	| awk cd sed "$@" | /usr/bin export grep 2>/dev/null readonly readonly
+		"$1" ${HOME} && 'quoted text' --verbose /usr/bin | readonly grep
+	"$@" printf done && test export /usr/bin x=1 2>/dev/null && ${HOME}
+export sed | 2>/dev/null export /usr/bin 'quoted text'
+		readonly $(pwd) -eu ${HOME} cd cd $(pwd) "$1"
+		&& test --verbose x=1 $(pwd) 'quoted text'
+	"$1" 2>/dev/null "$@" -eu ${HOME} 2>/dev/null
+		sed "$@" local && local cd local ${HOME} $(pwd) cd
+"$@" "$@" done echo readonly sed 2>/dev/null grep 'quoted text'
+	grep --verbose $(pwd) test then export readonly then awk test local then 2>/dev/null
+export $(pwd) export done x=1 'quoted text' export -eu "$@" done
+awk 2>/dev/null -eu test "$1" $(pwd)
+		sed awk | sed readonly export -eu ${HOME} "$1" --verbose "$1" /usr/bin
+x=1 -eu readonly "$1" cd echo awk ${HOME} 2>/dev/null printf
+	${HOME} then x=1 | x=1 "$@" printf 2>/dev/null done
+-eu ${HOME} readonly readonly printf
+	2>/dev/null $(pwd) sed printf && $(pwd) echo
+	'quoted text' then echo --verbose echo grep awk && grep sed ${HOME}
+&& 'quoted text' awk printf echo export "$@" local printf
+	echo x=1 awk x=1 /usr/bin "$1" sed -eu awk ${HOME}
+"$1" -eu $(pwd) echo "$1" readonly -eu
+	$(pwd) echo 2>/dev/null | awk 2>/dev/null test 'quoted text'
+test -eu done "$1" ${HOME} then printf
+	/usr/bin ${HOME} --verbose printf cd ${HOME} "$1" local printf test x=1 ${HOME}
+'quoted text' done "$@" -eu sed
+	| ${HOME} "$1" then printf 2>/dev/null readonly then readonly
+	echo 'quoted text' grep 'quoted text' "$@" echo export ${HOME} &&
+		"$1" ${HOME} sed echo x=1 local local ${HOME} "$1" x=1 printf grep && local grep
+	sed "$@" test | ${HOME} grep
+		cd export readonly awk && sed echo export && && /usr/bin echo sed -eu
+$(pwd) -eu test && | --verbose echo test | export "$1" sed
+		${HOME} done ${HOME} export awk $(pwd) awk x=1 'quoted text' test "$1"
+	local cd done done $(pwd) done then export 2>/dev/null
+		--verbose cd /usr/bin 2>/dev/null 'quoted text' then 2>/dev/null
+		test sed | then /usr/bin local --verbose local
+	"$@" sed --verbose -eu --verbose "$@" && /usr/bin $(pwd) "$1" grep
+test cd ${HOME} $(pwd) 2>/dev/null "$@" -eu && cd awk readonly sed local |
+readonly x=1 done then test "$1" test /usr/bin
+	--verbose grep "$1" /usr/bin "$1"
+"$1" printf /usr/bin x=1 grep -eu
+	grep && test "$@" then then sed test then printf /usr/bin
+&& cd readonly "$@" ${HOME} "$@" awk && printf $(pwd) sed 2>/dev/null ${HOME}
+	2>/dev/null cd ${HOME} | x=1 local ${HOME} then export cd then /usr/bin "$1"
+awk ${HOME} 'quoted text' ${HOME} cd cd && cd x=1 readonly awk
+cd done "$1" --verbose | --verbose -eu | && ${HOME} 'quoted text' | $(pwd) "$1"
+		done x=1 sed x=1 echo --verbose
+		sed "$1" x=1 | -eu 2>/dev/null test --verbose /usr/bin
+	&& echo /usr/bin /usr/bin ${HOME} $(pwd)
+	readonly local x=1 'quoted text' "$@" echo local && echo "$1" cd
+		-eu readonly done ${HOME} test export x=1 echo 2>/dev/null readonly export
+	sed 2>/dev/null echo x=1 awk grep sed readonly && 'quoted text'
+sed echo ${HOME} "$@" awk sed
+export done 'quoted text' sed echo then done cd "$1" x=1 /usr/bin /usr/bin
+	printf && export local |
+cd export awk | test readonly /usr/bin "$@" --verbose
+		"$1" -eu readonly awk 'quoted text' 2>/dev/null readonly grep /usr/bin
+	test readonly readonly 'quoted text'
+	${HOME} local done | $(pwd) then "$1" 2>/dev/null
+	/usr/bin 2>/dev/null
+local $(pwd) sed local test 2>/dev/null
+echo /usr/bin awk "$@" sed grep readonly && $(pwd) | && | "$1" | $(pwd) | then
+	then -eu 2>/dev/null 'quoted text' grep ${HOME} "$1" 'quoted text'
+export ${HOME} 'quoted text' echo | x=1 cd
+		| "$1" done 2>/dev/null printf
+--verbose test sed local "$1" "$1" awk -eu
+	--verbose done "$@" "$1" grep done sed test printf
+	| test readonly echo done export $(pwd) sed grep && "$1" echo done local sed
+	awk -eu test readonly local
+		test 2>/dev/null x=1 /usr/bin
+cd cd then then ${HOME} && awk && cd echo printf test
+	awk awk export grep test echo then 'quoted text'
+		export then export "$@" $(pwd)
+"$@" | test test local x=1 grep "$@" done printf printf local
+		grep && local readonly
+	/usr/bin ${HOME} done export local | local | grep test x=1 cd local grep
+		x=1 $(pwd) "$1" 2>/dev/null readonly readonly -eu |
+	| "$@" export sed export done test export 2>/dev/null printf $(pwd)
+"$@" && && $(pwd) x=1 echo "$@" -eu
+'quoted text' ${HOME} echo /usr/bin "$@" && cd $(pwd)
+	-eu export local | awk
+then -eu 2>/dev/null echo echo then local then sed "$@" 'quoted text' "$@" $(pwd)
+"$@" awk 'quoted text' cd awk done | done
+	-eu "$1" && cd 2>/dev/null x=1 then /usr/bin 2>/dev/null
+	readonly export 'quoted text' "$@" awk then $(pwd) printf export 'quoted text'
+	2>/dev/null /usr/bin ${HOME} grep "$1" readonly 2>/dev/null
+		local test 2>/dev/null x=1 -eu done -eu 'quoted text' 2>/dev/null
+		${HOME} 'quoted text' test $(pwd) done ${HOME} "$@" ${HOME} "$1" &&
+	echo then cd && test then printf grep
+		/usr/bin test awk ${HOME} readonly export
+'quoted text' "$1" ${HOME} sed echo printf
+		x=1 ${HOME} x=1 sed | done "$1" | && export ${HOME} sed printf
+export export readonly -eu --verbose
+		'quoted text' done | "$@" awk local grep test cd done then $(pwd) then awk
+$(pwd) then sed grep --verbose /usr/bin done | local echo awk
+	then 'quoted text' cd 'quoted text'
+		local done && "$@" 'quoted text' echo readonly $(pwd) then && 2>/dev/null awk
+2>/dev/null then local "$@" /usr/bin awk --verbose test cd $(pwd) | readonly
+2>/dev/null "$1" | -eu -eu echo readonly $(pwd) grep sed then $(pwd)
+		grep ${HOME} "$1" readonly
+	${HOME} sed done /usr/bin printf printf | $(pwd) printf sed awk
+		printf | awk "$@" test test && "$1" /usr/bin x=1 --verbose
+/usr/bin local $(pwd) && printf then $(pwd) 'quoted text'
+--verbose done done awk | echo -eu --verbose $(pwd) export
+cd /usr/bin grep $(pwd) echo echo local done
+		then 2>/dev/null sed $(pwd) && then | ${HOME} 2>/dev/null then test echo
+	export "$@" printf readonly x=1 2>/dev/null |
+grep | $(pwd) printf readonly awk ${HOME} grep "$@" $(pwd) 'quoted text'
+	test sed $(pwd) readonly local grep export awk ${HOME} --verbose
+	cd test export then awk echo $(pwd) awk "$1" grep
+		&& sed test grep $(pwd) 2>/dev/null done
+awk && 'quoted text' echo printf awk x=1 && cd done test "$@"
+	&& /usr/bin sed readonly
+	grep "$@" echo 'quoted text' | local "$@"
+	sed done awk grep local then -eu $(pwd) "$1" then then echo then sed
+		$(pwd) then 2>/dev/null
+	"$1" "$1" then 2>/dev/null printf grep
+	echo readonly printf /usr/bin
+	"$1" ${HOME} echo export local && "$1" -eu test test $(pwd) /usr/bin $(pwd)
+		2>/dev/null 2>/dev/null 'quoted text' export grep 2>/dev/null ${HOME}
+		$(pwd) export "$1" test 2>/dev/null
+		${HOME} /usr/bin x=1 local /usr/bin 'quoted text'
+then grep sed readonly "$1" "$1" -eu && --verbose "$@" export cd && awk export
+-eu cd cd cd grep $(pwd) printf printf echo /usr/bin ${HOME} --verbose
+'quoted text' --verbose $(pwd) "$@" | echo awk cd grep echo "$1"
+"$@" readonly awk awk $(pwd) cd x=1
+	-eu local -eu echo --verbose "$@" test | printf echo "$@" local echo | grep "$@"
+		done then ${HOME} done x=1 $(pwd) --verbose
+| "$1" ${HOME} 'quoted text' /usr/bin
+	$(pwd) --verbose cd 'quoted text' cd -eu cd $(pwd) x=1 /usr/bin |
+		&& test $(pwd) && done ${HOME} test
+local readonly done ${HOME} readonly 'quoted text'
+		${HOME} grep export $(pwd) export export
+	--verbose && echo done $(pwd) sed /usr/bin export then readonly
+	-eu done && $(pwd) && $(pwd) printf
+done ${HOME} "$@" x=1 "$@" $(pwd) | "$@" /usr/bin
+	| test /usr/bin 2>/dev/null readonly echo 'quoted text' awk $(pwd) && then
+x=1 test sed $(pwd) "$@" x=1 cd test then done
+		export 'quoted text' then then
+&& "$1" sed 'quoted text' readonly echo grep done "$@"
+then && ${HOME} 'quoted text' "$1" test -eu --verbose awk 2>/dev/null 2>/dev/null
+	export local $(pwd) && echo 'quoted text' readonly
+| /usr/bin 'quoted text' -eu export $(pwd) export export | -eu -eu --verbose x=1
+	local --verbose -eu local "$@" "$1" /usr/bin printf done 'quoted text'
+	test $(pwd) ${HOME} grep readonly sed x=1 readonly awk then --verbose "$@" test
+then done echo --verbose done then printf export
+export /usr/bin then 2>/dev/null
+	x=1 2>/dev/null 'quoted text' "$1" awk /usr/bin test export then "$1" export
+		| -eu x=1 cd --verbose grep "$1"
+		test readonly test test
+	'quoted text' "$@" -eu sed awk ${HOME} ${HOME} -eu test /usr/bin | $(pwd)
+	-eu awk local | sed sed readonly && /usr/bin $(pwd)
+		readonly test cd echo done export echo 2>/dev/null "$1"
+		x=1 2>/dev/null echo local ${HOME} ${HOME} then done grep echo | awk /usr/bin
+		"$@" printf printf readonly readonly /usr/bin done "$1" /usr/bin local
+then x=1 && /usr/bin done --verbose 'quoted text' test 2>/dev/null
+	echo "$1" --verbose && "$@" $(pwd) local | | 2>/dev/null
+	printf awk cd readonly 'quoted text' readonly printf then test export sed then
+readonly grep | /usr/bin --verbose "$@" "$1" /usr/bin echo -eu awk cd | x=1 2>/dev/null
+$(pwd) -eu then $(pwd)
+		test cd printf local cd "$1" ${HOME} grep sed sed "$1" x=1 "$@"
+	local then | /usr/bin cd readonly -eu readonly cd grep test --verbose then
+		sed echo readonly "$1" sed readonly
+		-eu --verbose | done && "$1" echo sed -eu --verbose
+grep grep 'quoted text' -eu x=1 done 'quoted text'
+		then echo echo test then grep | sed x=1 readonly
+local 2>/dev/null && x=1 done && -eu export x=1
+readonly | local sed /usr/bin
+	2>/dev/null x=1 test printf --verbose
+	| /usr/bin x=1 ${HOME} awk done "$@" local | -eu test awk test "$1" x=1
+then ${HOME} then awk grep then --verbose --verbose
+2>/dev/null awk done echo $(pwd) cd /usr/bin "$@" --verbose "$@" sed | 'quoted text'
+	$(pwd) sed local /usr/bin awk --verbose sed awk
+'quoted text' readonly readonly
+		&& "$1" sed "$1" cd 'quoted text' 2>/dev/null then awk | sed export
+	"$1" local && $(pwd) $(pwd) --verbose readonly
+		x=1 grep grep ${HOME} 'quoted text' && grep ${HOME} readonly
+"$1" ${HOME} then local "$@" "$1" "$@"
+	/usr/bin sed -eu | $(pwd) | ${HOME} export echo && grep --verbose awk -eu /usr/bin
+	cd readonly then awk then done $(pwd)
+		| sed ${HOME} "$@" awk awk readonly done "$@" awk
+		"$@" "$1" sed done done export /usr/bin "$@" echo export $(pwd) $(pwd) 2>/dev/null
+		local then done | /usr/bin
+$(pwd) then cd then sed -eu ${HOME} "$@" readonly $(pwd)
+		grep "$1" awk export -eu 'quoted text' readonly x=1 echo
+test done $(pwd) -eu test echo readonly test x=1 test test export
+		grep x=1 && done 2>/dev/null 2>/dev/null
+		awk then readonly --verbose x=1 sed done
+		$(pwd) -eu ${HOME} $(pwd) 'quoted text' --verbose "$1" then test
+	x=1 echo 2>/dev/null test sed /usr/bin
+		cd sed "$1" 2>/dev/null $(pwd)
+		cd grep local "$@" printf && $(pwd) grep local then test echo sed
+		cd done sed readonly 'quoted text'
+2>/dev/null x=1 "$1" local "$1" then 2>/dev/null x=1
+		"$@" x=1 sed --verbose export 'quoted text'
+		${HOME} then echo -eu done local awk export echo 'quoted text'
+--verbose sed /usr/bin ${HOME} readonly
+	local readonly cd sed echo cd && readonly grep /usr/bin done &&
+then ${HOME} test && cd printf
+| test ${HOME} "$1" grep --verbose done &&
+	2>/dev/null "$@" done -eu
+		"$1" 2>/dev/null -eu done -eu 'quoted text' printf
+	then 'quoted text' test "$@" | "$1" $(pwd) sed awk readonly
+		awk 2>/dev/null -eu then
+	/usr/bin readonly x=1 2>/dev/null printf grep
+		-eu $(pwd) printf done "$1" ${HOME} 2>/dev/null
+readonly && x=1 grep export printf echo 'quoted text' done printf
+x=1 test 2>/dev/null 'quoted text' -eu 'quoted text' && "$@" | /usr/bin done
+| $(pwd) local export awk --verbose 'quoted text' x=1 sed printf then
+	test cd "$@" cd awk | $(pwd)
+x=1 grep local echo x=1 x=1 done test && readonly "$1" local $(pwd) -eu
+echo local readonly sed
+'quoted text' 2>/dev/null
+local 2>/dev/null done
+	test --verbose grep "$1"
+		printf echo echo echo -eu printf | grep --verbose 'quoted text'
+$(pwd) then echo done echo /usr/bin readonly awk $(pwd) cd printf
+	x=1 awk && "$1" local export
+		-eu | readonly 2>/dev/null
+&& grep test then | && cd printf --verbose awk
+	2>/dev/null -eu done test local printf sed
+then x=1 && export -eu test sed printf
+		cd local sed --verbose grep x=1 awk echo $(pwd) cd
+	export $(pwd) | done -eu local sed && 2>/dev/null | cd cd $(pwd) -eu && awk /usr/bin
+	-eu "$1" x=1 test local "$1" awk 'quoted text' sed local sed
+$(pwd) cd --verbose $(pwd) -eu --verbose "$@" ${HOME} "$@"
+		then 'quoted text' printf export && cd "$1" printf && local
+	2>/dev/null --verbose cd echo /usr/bin local awk export && 'quoted text' export
+		2>/dev/null --verbose printf cd --verbose awk && "$@" "$1" done && $(pwd) ${HOME}
+		then "$1" x=1 printf --verbose then grep printf export ${HOME} -eu 'quoted text'
+		'quoted text' -eu done "$@" && grep
+		grep 'quoted text' x=1 readonly /usr/bin grep
+readonly -eu "$@" then && test grep ${HOME} | cd grep cd
+	sed "$@" local test sed echo
+	'quoted text' "$@" --verbose grep echo sed local
+	"$1" cd 2>/dev/null $(pwd)
+		$(pwd) sed done "$@" /usr/bin awk then done
+		&& cd | $(pwd) ${HOME} test -eu sed cd awk x=1 -eu ${HOME} 'quoted text' "$1"
+		awk "$@" readonly ${HOME} printf
+	cd $(pwd) /usr/bin ${HOME} 2>/dev/null --verbose && ${HOME} sed x=1
+		export && readonly "$1" awk local then local printf grep then
+	'quoted text' printf grep $(pwd) then
+$(pwd) local ${HOME} "$@" echo --verbose --verbose export 2>/dev/null
+		'quoted text' -eu && awk printf local echo done --verbose
+done 'quoted text' && echo readonly awk then grep $(pwd) awk
+	x=1 2>/dev/null "$1" | && $(pwd) grep "$@" ${HOME} -eu /usr/bin cd | /usr/bin &&
+printf --verbose 'quoted text' 'quoted text' then "$@" $(pwd) grep local 2>/dev/null
+echo ${HOME} cd | readonly "$@" cd 'quoted text' 2>/dev/null done $(pwd)
+then export readonly $(pwd) -eu grep local $(pwd) test $(pwd) --verbose 2>/dev/null
+/usr/bin x=1 grep then
+/usr/bin | grep --verbose
+		cd test -eu --verbose -eu $(pwd) then "$1" && x=1 x=1 $(pwd) sed
+		$(pwd) done x=1 x=1 readonly sed | "$1"
+readonly sed $(pwd) echo local local /usr/bin "$@"
+	sed printf local $(pwd) ${HOME} readonly && cd -eu grep $(pwd) x=1
+	sed "$@" readonly printf done | local "$@"
+	2>/dev/null echo cd &&
+	/usr/bin local sed printf && test readonly
+	${HOME} -eu x=1 ${HOME} done
+2>/dev/null ${HOME} "$@" cd x=1 -eu done then && --verbose readonly printf ${HOME}
+	grep echo "$1" 2>/dev/null echo cd local awk
+		local /usr/bin 'quoted text' export --verbose awk local grep printf
+		echo test local then "$@" then printf "$1" readonly
+	readonly | local 'quoted text' 2>/dev/null printf "$1" then test
+$(pwd) "$@" | && cd done export 'quoted text' -eu sed ${HOME}
+	awk readonly echo --verbose 2>/dev/null && --verbose --verbose --verbose local
+x=1 local echo awk 'quoted text'
+	readonly x=1 then sed done awk --verbose --verbose -eu printf --verbose export
+&& awk local done local 'quoted text'
+		&& local sed cd "$1" test "$1" export "$@" && sed export
+local 'quoted text' 2>/dev/null
+	"$1" /usr/bin local x=1 | "$@" local local /usr/bin /usr/bin
+		$(pwd) 2>/dev/null grep "$@"
+	"$@" 2>/dev/null sed cd printf $(pwd) readonly then done then $(pwd) export printf
+then | sed /usr/bin "$1" awk && sed grep test "$1" test 'quoted text'
+		$(pwd) echo x=1 awk awk "$@" /usr/bin local -eu local /usr/bin /usr/bin local
+		$(pwd) /usr/bin && $(pwd) local /usr/bin 2>/dev/null
+	--verbose "$@" "$1" readonly 'quoted text'
+	export /usr/bin "$@" 'quoted text' "$1" readonly export grep $(pwd) echo grep cd
+	-eu then | local /usr/bin echo grep export test then /usr/bin
+	test printf done export grep sed done then awk "$1" x=1 "$@" && -eu /usr/bin
+${HOME} local "$@" grep ${HOME}
+	"$@" x=1 sed then echo 2>/dev/null
+		cd -eu test export x=1 done
+		export ${HOME} 'quoted text'
+	/usr/bin test sed ${HOME} cd /usr/bin done 2>/dev/null grep $(pwd) x=1 then then
+		${HOME} then ${HOME} grep cd echo x=1 /usr/bin 'quoted text' "$1" grep
+cd && 2>/dev/null && "$1" local $(pwd) test export 2>/dev/null "$1"
+--verbose cd awk grep --verbose --verbose test grep --verbose cd export
+	${HOME} export $(pwd) cd grep echo
+		2>/dev/null x=1 -eu echo local cd grep /usr/bin | readonly /usr/bin
+		awk 2>/dev/null $(pwd) printf
+"$1" awk -eu local printf
+		| "$1" export x=1 sed test ${HOME}
+		/usr/bin local 'quoted text' && sed 'quoted text' printf local
+	done "$1" $(pwd) 'quoted text'
+		&& 'quoted text' sed then "$@" 'quoted text'
+printf 'quoted text' awk test 'quoted text'
+export x=1 test $(pwd) 2>/dev/null readonly --verbose 2>/dev/null then sed
+"$@" $(pwd) readonly
+	${HOME} x=1 then 'quoted text' x=1 $(pwd) local $(pwd) "$1" done done sed
+'quoted text' printf printf
+	local x=1 -eu "$@" && cd test $(pwd) | 2>/dev/null x=1 cd printf &&
+	${HOME} cd | readonly /usr/bin grep
+-eu echo cd printf x=1 /usr/bin
+	test then echo "$1" $(pwd) ${HOME} test readonly test export
+		export printf done readonly --verbose "$1"
+	2>/dev/null /usr/bin echo export
+$(pwd) | /usr/bin /usr/bin
+'quoted text' export grep readonly
+		2>/dev/null -eu 2>/dev/null awk "$@" grep $(pwd)
+cd "$1" -eu 'quoted text' sed done ${HOME} grep
+cd local readonly /usr/bin
+then grep sed test test --verbose x=1 readonly sed cd "$1"
+	x=1 cd -eu -eu ${HOME} x=1 local "$@" test $(pwd) x=1 | x=1 echo echo
+	--verbose cd done awk test | grep sed grep 2>/dev/null
+	x=1 'quoted text' $(pwd) 'quoted text'
+done then local ${HOME} test export ${HOME} $(pwd) --verbose test awk
+readonly /usr/bin | "$@" "$1" sed then readonly echo sed x=1 grep local done |
+local | && $(pwd) sed /usr/bin
+		export /usr/bin done /usr/bin echo
+	"$@" x=1 ${HOME} done | -eu | sed done -eu done readonly | then
+local readonly | "$1"
+		| | -eu test "$@" test ${HOME} --verbose x=1 "$1" cd done
+		| printf done then done printf x=1 $(pwd) && && export test printf
+x=1 test echo grep cd printf $(pwd) $(pwd) export "$1"
+	echo export $(pwd) ${HOME} sed
+sed test sed cd done | --verbose ${HOME} echo sed test -eu 'quoted text'
+	-eu 'quoted text' "$@" local readonly readonly
+	x=1 "$@" "$1" test x=1 printf /usr/bin awk 'quoted text'
+		2>/dev/null ${HOME} done export sed -eu test "$@" "$1" 2>/dev/null "$1" -eu
+	echo echo sed x=1 then | readonly sed -eu awk then -eu x=1 -eu
+printf /usr/bin | cd sed export local 'quoted text' /usr/bin "$@" | "$1"
+'quoted text' printf $(pwd) local echo x=1 local local "$1" awk "$1" sed export
+	echo --verbose done "$@" ${HOME} ${HOME}
+		done readonly test /usr/bin then | then local
+		export cd | export then x=1 done -eu echo
+	readonly && export export $(pwd)
+	-eu ${HOME} x=1 local && cd export "$@" sed "$@" /usr/bin $(pwd)
+		/usr/bin 'quoted text' /usr/bin
+	| && printf 'quoted text' echo $(pwd)
+--verbose 2>/dev/null readonly
+test then | then export cd --verbose && ${HOME}
+		test x=1 then test 2>/dev/null
+	readonly done cd cd --verbose
+	export test $(pwd) grep "$1" && local cd -eu local grep done done done x=1
+	export | "$1" -eu cd $(pwd) cd done x=1 -eu local export -eu "$1" x=1
+printf | cd 'quoted text'
+		echo grep then then /usr/bin /usr/bin readonly
+'quoted text' x=1 echo $(pwd) done | $(pwd) cd cd "$1"
+		sed awk grep 'quoted text' "$@" awk test then --verbose
+		$(pwd) 2>/dev/null cd 'quoted text'
+	sed cd export "$1" readonly -eu test
+printf local printf -eu 'quoted text' "$1" cd done | ${HOME} readonly
+		"$1" 'quoted text' && $(pwd) | then printf ${HOME} --verbose
+-eu done 2>/dev/null awk 2>/dev/null
+	"$@" awk && $(pwd) --verbose awk
+		sed done test local readonly x=1
+	test echo "$1" /usr/bin $(pwd) local cd local test sed $(pwd) /usr/bin
+awk $(pwd) then x=1 sed 'quoted text' x=1
+	${HOME} $(pwd) export x=1 x=1 -eu
+		2>/dev/null "$@" -eu 2>/dev/null sed echo 'quoted text'
+sed | --verbose && grep | done "$@" export sed sed then done x=1
+--verbose cd "$1" -eu sed done 2>/dev/null $(pwd) then $(pwd)
+readonly test 'quoted text' echo test 'quoted text'
+| sed then -eu && sed ${HOME} grep grep -eu
+		test grep $(pwd) awk /usr/bin 'quoted text' readonly echo sed
+2>/dev/null ${HOME} export "$@" -eu awk echo /usr/bin
+	--verbose "$1" /usr/bin grep --verbose --verbose /usr/bin
+'quoted text' cd /usr/bin
+grep /usr/bin && grep test ${HOME} --verbose 'quoted text' echo printf done done
+		2>/dev/null --verbose --verbose then test "$@"
+		awk | readonly local 2>/dev/null readonly $(pwd) readonly "$@"
+		then ${HOME} ${HOME} echo sed then grep
+		sed x=1 'quoted text' --verbose local
+		2>/dev/null 2>/dev/null local "$1" echo 'quoted text' ${HOME} | printf test
+	echo /usr/bin "$1" test && x=1 x=1
+	--verbose grep ${HOME} sed | sed 'quoted text' cd | $(pwd) then export done
+		2>/dev/null --verbose cd | 2>/dev/null
+	2>/dev/null /usr/bin x=1 export x=1 x=1 ${HOME} awk
+		| done && sed x=1 x=1 sed "$1" 2>/dev/null
+$(pwd) -eu awk grep -eu grep then readonly sed grep then
+then awk export sed ${HOME} done grep x=1 awk readonly
+		printf $(pwd) then local -eu "$1" "$1" export local
+	"$1" x=1 cd done done then export
+		x=1 2>/dev/null x=1 | | --verbose "$1" test cd export 2>/dev/null
+	$(pwd) 2>/dev/null sed
+		2>/dev/null -eu "$@" /usr/bin && x=1 cd --verbose -eu 'quoted text' test
+	cd then test && then 2>/dev/null then
+	--verbose --verbose awk cd
+echo awk cd sed && | done local awk 2>/dev/null && "$1" /usr/bin "$@" --verbose
+done 'quoted text' && "$@" /usr/bin cd echo 2>/dev/null
+-eu export printf x=1 -eu "$@" export local printf | "$@" awk grep "$1" readonly
+printf done 2>/dev/null done done echo export
+		-eu test "$1" readonly /usr/bin done done awk export sed export export
+	awk then then 'quoted text' printf grep printf echo
+--verbose sed --verbose $(pwd) "$1" readonly "$@" cd
+		| "$@" "$@" "$@" awk ${HOME} "$1" x=1
+2>/dev/null readonly export sed export done echo 2>/dev/null done
+local awk grep | sed sed then "$1" grep "$1"
+	$(pwd) grep && then ${HOME} export |
+-eu /usr/bin x=1 "$@" local 2>/dev/null --verbose 'quoted text' then done
+2>/dev/null -eu echo awk -eu grep cd then
+/usr/bin echo && "$@" && done grep cd printf test
+sed sed export "$@" grep | "$1" export
+x=1 cd $(pwd) -eu /usr/bin grep "$@" grep
+	sed "$1" "$@" "$1" sed test sed x=1 -eu then
+done "$@" /usr/bin then "$1" sed 2>/dev/null
+	local --verbose awk echo --verbose "$1"
+		echo 'quoted text' export ${HOME} "$1" 2>/dev/null done "$1"
+	2>/dev/null grep ${HOME} export && "$1"
+${HOME} -eu --verbose 2>/dev/null | echo && test grep grep readonly
+sed then ${HOME} /usr/bin | | "$@" local $(pwd) cd readonly x=1 "$1"
+	echo awk "$1" done "$1" sed /usr/bin
+	x=1 printf readonly && grep "$1" sed sed grep sed --verbose
+readonly | test awk -eu 'quoted text'
+		done local awk 2>/dev/null test "$@" export echo echo | | export
+	${HOME} printf export x=1 grep --verbose ${HOME} readonly --verbose -eu
+		awk export 'quoted text' printf /usr/bin "$1" x=1 2>/dev/null grep && then
+sed ${HOME} 'quoted text' readonly done local x=1 export
+		x=1 awk printf then echo && grep export printf echo --verbose printf
+local "$@" cd readonly readonly awk
+		--verbose then --verbose | printf
+	/usr/bin x=1 && done x=1 2>/dev/null readonly 'quoted text' awk x=1 -eu "$@"
+		done ${HOME} export done $(pwd)
+readonly "$@" --verbose grep echo local
+	--verbose export cd --verbose sed then readonly x=1
+$(pwd) then 2>/dev/null -eu awk && ${HOME} 2>/dev/null
+		echo $(pwd) grep sed 2>/dev/null $(pwd)
+&& cd && "$@" $(pwd) "$@" local ${HOME} -eu readonly echo awk 'quoted text'
+	cd 2>/dev/null -eu "$1" export awk | 2>/dev/null
+		grep done done test local
+		readonly awk $(pwd) then x=1 readonly printf export test
+		| sed $(pwd) 2>/dev/null
+2>/dev/null printf -eu 'quoted text'
+done readonly printf --verbose "$@" ${HOME} echo sed $(pwd)
+/usr/bin -eu cd "$1" awk "$@" grep export "$1" "$1" done /usr/bin
+		-eu export grep | printf done grep echo sed x=1 x=1 readonly
+awk grep -eu "$1" echo awk ${HOME} && readonly
+		echo echo done $(pwd) "$1" cd && test readonly "$@" sed
+		cd awk /usr/bin printf /usr/bin $(pwd) export awk | local done
+		sed done sed -eu 'quoted text' printf export "$@" -eu -eu
+	"$@" x=1 printf 'quoted text' readonly 2>/dev/null local
+readonly && echo "$@" echo && --verbose
+	/usr/bin sed awk awk echo then /usr/bin cd readonly
+	"$@" --verbose export readonly 'quoted text' local $(pwd) && done
+	cd 'quoted text' $(pwd) grep printf
+		then awk "$@" export printf -eu local readonly cd grep
+	'quoted text' "$1" test
+		cd export sed x=1 cd test awk --verbose 'quoted text'
+	then ${HOME} ${HOME} /usr/bin 2>/dev/null test
+	readonly --verbose cd cd ${HOME}
+		local grep readonly local export printf $(pwd) /usr/bin
+	--verbose readonly test -eu sed "$@" -eu then printf awk readonly 'quoted text'
+| 'quoted text' $(pwd) "$@" x=1 test /usr/bin
+done --verbose 'quoted text'
+"$@" printf $(pwd) local export cd x=1 then 2>/dev/null test "$1" $(pwd)
+'quoted text' then $(pwd) sed echo export readonly 2>/dev/null x=1 | local done
+"$@" 'quoted text' local echo
+test $(pwd) 'quoted text' readonly $(pwd) awk $(pwd) printf
+	printf $(pwd) sed 2>/dev/null awk cd cd "$1" test -eu
+	readonly sed --verbose cd -eu readonly
+		| grep readonly 'quoted text' test readonly test "$@"
+	$(pwd) local /usr/bin "$@" ${HOME} local done | 2>/dev/null
+| --verbose && -eu $(pwd) grep done grep printf 'quoted text' readonly test
+		test awk test --verbose local echo grep printf
+		"$1" echo | local $(pwd) printf grep x=1 cd x=1 awk ${HOME} printf
+export /usr/bin grep "$@" "$1" test done $(pwd) /usr/bin
+		&& $(pwd) -eu ${HOME} done ${HOME} local x=1 then /usr/bin
+		2>/dev/null | "$@" printf --verbose grep sed local done $(pwd) printf
+		printf && local "$@"
+		2>/dev/null printf printf cd done
+"$@" readonly 2>/dev/null -eu sed --verbose 'quoted text' ${HOME}
+		${HOME} 2>/dev/null echo $(pwd) /usr/bin
+readonly readonly x=1 "$@" test readonly readonly ${HOME} awk cd local
+	| done $(pwd) --verbose --verbose
+		| awk local test echo $(pwd) grep /usr/bin sed printf cd cd
+export -eu 2>/dev/null
+	awk echo local -eu 2>/dev/null done --verbose
+	"$1" 2>/dev/null x=1 export "$@" --verbose local x=1 readonly done x=1 x=1 readonly
+printf 2>/dev/null /usr/bin && sed --verbose "$@" export awk "$@" local
+		grep test --verbose 'quoted text' --verbose sed done /usr/bin $(pwd) sed
+printf $(pwd) then done test x=1 -eu "$1" $(pwd) x=1 && test "$@" "$1" test
+	export test --verbose --verbose test then
+readonly -eu local "$@" export
+		readonly "$@" /usr/bin printf
+&& then x=1 x=1 $(pwd) done "$@" && /usr/bin then done
+		readonly --verbose /usr/bin 2>/dev/null readonly
+"$@" && --verbose cd done readonly "$@" &&
+	"$@" 2>/dev/null awk echo sed 2>/dev/null x=1 -eu x=1 grep printf
+/usr/bin printf /usr/bin --verbose $(pwd) | test 'quoted text' echo
+test export $(pwd) 'quoted text' done && "$1" sed "$@" export
+"$@" echo ${HOME} echo export /usr/bin "$1" --verbose done
+sed grep readonly ${HOME} test done cd -eu -eu ${HOME}
+	cd --verbose --verbose awk
+2>/dev/null "$@" awk --verbose x=1 'quoted text' /usr/bin
+		&& ${HOME} awk sed --verbose 'quoted text' awk sed then done -eu
+		-eu "$@" printf cd ${HOME} 'quoted text' sed | --verbose
+grep -eu then --verbose printf local && export
+test done done /usr/bin "$1" | sed echo then awk 2>/dev/null
+/usr/bin done "$@" 'quoted text' x=1 test && "$@" local ${HOME}
+		cd 2>/dev/null -eu then x=1 -eu "$@" x=1 | 2>/dev/null printf local "$@"
+		${HOME} done /usr/bin echo --verbose cd grep
+		readonly readonly $(pwd) printf | && readonly local echo 'quoted text' && && done
+	test readonly then 'quoted text' done "$@" sed /usr/bin local ${HOME}
+		then test export ${HOME} awk ${HOME} --verbose "$@" done sed printf
+	2>/dev/null done local printf "$1" then
+	cd printf sed $(pwd) printf --verbose local awk cd readonly echo test sed
+-eu "$@" readonly /usr/bin -eu test "$@" printf "$1" -eu x=1 ${HOME}
+		local /usr/bin readonly ${HOME}
+		then -eu readonly readonly "$@" ${HOME} "$1"
+	awk | $(pwd) test 2>/dev/null $(pwd) local | test $(pwd) 2>/dev/null
+		x=1 cd --verbose awk --verbose grep
+$(pwd) && "$@" ${HOME} readonly grep local
+test local 'quoted text' $(pwd) grep sed --verbose
+	'quoted text' ${HOME} -eu -eu | --verbose printf | grep export $(pwd) -eu printf
+		cd -eu 'quoted text' $(pwd) ${HOME} test | -eu grep
+grep awk ${HOME} -eu readonly 'quoted text' 'quoted text' x=1
+"$1" && "$1" sed && sed
+		'quoted text' grep cd grep --verbose export echo
+awk readonly echo "$1" 2>/dev/null | awk && readonly
+	"$@" 2>/dev/null cd --verbose
+| sed echo ${HOME} printf --verbose
+	--verbose test $(pwd) awk test printf readonly grep local export readonly
+	${HOME} readonly then readonly 2>/dev/null echo export cd "$@"
+done $(pwd) && -eu $(pwd) readonly "$@" $(pwd) sed export /usr/bin
+	readonly awk done $(pwd) done -eu then 'quoted text' "$1" then grep grep "$1" $(pwd)
+	echo && done -eu local
+	then echo 2>/dev/null export /usr/bin 'quoted text' local $(pwd) test
+grep local readonly then "$1" /usr/bin 'quoted text' printf && $(pwd) /usr/bin
+then ${HOME} /usr/bin && "$@" readonly done printf sed echo "$@"
+sed awk x=1 $(pwd) | 2>/dev/null cd 'quoted text' 'quoted text' echo "$1"
+	awk $(pwd) ${HOME} -eu local
+		local printf && readonly echo
+		"$@" ${HOME} done x=1 done 2>/dev/null echo readonly test "$1" | printf && local
+"$1" readonly $(pwd) /usr/bin sed /usr/bin "$1" grep done /usr/bin grep cd
+	then test printf awk test --verbose && $(pwd)
+printf x=1 $(pwd) -eu done ${HOME} echo 'quoted text'
+	"$1" cd "$@" then printf && readonly && 2>/dev/null
+'quoted text' ${HOME} "$1" && /usr/bin then echo && | cd
+		${HOME} "$@" 2>/dev/null test $(pwd) then --verbose then | grep && 'quoted text'
+echo x=1 awk printf grep awk export /usr/bin
+	grep && then cd export grep cd local awk /usr/bin done $(pwd) done
+	"$1" awk local cd export 'quoted text' readonly
+sed 2>/dev/null ${HOME} awk grep export /usr/bin
+		printf then 'quoted text' echo export "$1" "$1" readonly echo export -eu 2>/dev/null
+done export --verbose local local --verbose
+	"$1" "$@" done readonly $(pwd) ${HOME}
+	'quoted text' /usr/bin ${HOME} test x=1 echo done 2>/dev/null cd then
+	x=1 ${HOME} --verbose export --verbose "$1" 'quoted text' grep --verbose | readonly
+done 2>/dev/null --verbose && $(pwd) awk ${HOME} && readonly cd --verbose
+sed export | -eu "$1" echo then cd test $(pwd) readonly export export
+		-eu readonly 'quoted text' 2>/dev/null local $(pwd) "$1" then local printf /usr/bin
+	x=1 --verbose x=1 --verbose $(pwd) done
+sed /usr/bin then 'quoted text' x=1 "$@"
+	x=1 | printf ${HOME} local ${HOME} echo | awk -eu sed grep "$1"
+		${HOME} "$1" 'quoted text' ${HOME} /usr/bin ${HOME} sed done sed export
+		"$@" done export cd local test done echo printf test
+		awk readonly echo cd export ${HOME} done
+awk awk "$@" echo local sed done done sed test then 2>/dev/null $(pwd)
+"$1" && export echo "$@" grep "$@" sed 'quoted text' echo done "$1"
+&& echo "$@" cd then 2>/dev/null cd /usr/bin readonly 'quoted text' -eu --verbose
+		$(pwd) && local test "$@" echo
+done -eu test awk cd 2>/dev/null grep grep "$@"
+	grep $(pwd) done test /usr/bin /usr/bin
+		printf echo -eu done sed -eu "$1" "$1" "$1" && cd
+	local "$@" x=1 printf | printf "$@" "$@" /usr/bin sed ${HOME} "$@" --verbose
+-eu awk --verbose then $(pwd) "$1" && --verbose "$1"
+		export then $(pwd) test then awk
+		"$@" local -eu test sed printf awk
+	echo sed 'quoted text' readonly
+/usr/bin && then test local | readonly 'quoted text' --verbose local | x=1 'quoted text'
+/usr/bin grep printf sed cd 2>/dev/null x=1 test done local 2>/dev/null 2>/dev/null
+&& 'quoted text' "$1" local cd $(pwd) 2>/dev/null "$@" sed 2>/dev/null test
+		--verbose "$1" awk x=1 | --verbose x=1 x=1 $(pwd) cd "$1" | cd test printf | sed
+&& then printf -eu export done test /usr/bin echo printf echo cd | "$@"
+	$(pwd) cd /usr/bin local && sed cd done local "$@" $(pwd) done "$1"
+		echo test x=1 export grep done
+	done --verbose readonly "$1" 2>/dev/null 2>/dev/null sed 2>/dev/null
+	| grep 'quoted text' done echo $(pwd) printf x=1 test then "$@" then
+	"$1" ${HOME} x=1 test "$1" readonly
+then cd 2>/dev/null "$@" cd printf sed done --verbose -eu 'quoted text'
+	&& echo grep sed then readonly --verbose "$1" local done /usr/bin
+		${HOME} then "$@" "$1" --verbose sed x=1 && | local -eu
+	done && test 'quoted text' then export ${HOME} then cd export && 'quoted text'
+		'quoted text' cd readonly x=1 printf ${HOME} "$1" echo test readonly "$1"
+		readonly local grep printf printf $(pwd) ${HOME}
+	&& grep 2>/dev/null then test x=1
+	sed $(pwd) sed then /usr/bin 'quoted text' printf awk sed
+		awk local readonly local then local sed "$@" --verbose "$1"
+readonly -eu "$@" cd awk "$@" && test "$@" -eu x=1 -eu x=1 sed
+2>/dev/null && /usr/bin 'quoted text' "$@"
+		echo grep printf sed sed
+		readonly printf printf 2>/dev/null --verbose test
+	awk done --verbose printf sed $(pwd) test readonly echo x=1 printf local 'quoted text'
+2>/dev/null printf 2>/dev/null
+		${HOME} x=1 ${HOME} grep && 2>/dev/null $(pwd) && ${HOME} printf -eu test
+		"$@" --verbose -eu readonly | 2>/dev/null && sed local then echo test readonly
+	awk echo then done | then
+		awk | ${HOME} echo $(pwd) --verbose
+	readonly "$@" readonly sed export | grep "$1" echo x=1 2>/dev/null
+	then /usr/bin 2>/dev/null export
+		'quoted text' /usr/bin printf done
+export $(pwd) -eu local "$1" "$1" 'quoted text' echo 'quoted text' then cd
+		| readonly 'quoted text' then "$1" readonly awk --verbose printf
+	local x=1 x=1 export ${HOME}
+	-eu test /usr/bin readonly 2>/dev/null --verbose | local echo ${HOME} "$@" echo
+	export 'quoted text' echo echo echo 2>/dev/null echo 'quoted text' x=1 printf 2>/dev/null
+export | 2>/dev/null export
+sed cd echo cd then printf local
+x=1 --verbose && done then && test local then grep
+"$@" awk printf cd echo ${HOME} /usr/bin readonly $(pwd)
+x=1 grep done 2>/dev/null export
+		-eu -eu | $(pwd) cd && && "$@" 'quoted text' echo "$1"
+"$1" echo printf export ${HOME} readonly printf
+		&& $(pwd) ${HOME} cd | 'quoted text' "$@" 2>/dev/null -eu
+awk test $(pwd) local ${HOME} test test echo sed 'quoted text' --verbose --verbose
+	cd test x=1 "$1" "$1" test cd done
+	| printf printf then --verbose export grep sed 'quoted text' echo export 'quoted text'
+	&& /usr/bin local /usr/bin --verbose x=1 awk
+		2>/dev/null 'quoted text' export 'quoted text' x=1 readonly | && awk
+/usr/bin $(pwd) awk awk --verbose | cd sed --verbose
+		&& --verbose | && 'quoted text' then 'quoted text' printf grep ${HOME} "$@" cd awk
+	/usr/bin | cd echo then readonly
+grep --verbose then --verbose x=1 sed test "$1" export cd x=1
+${HOME} export local export
+	x=1 "$@" then export grep "$@" 2>/dev/null readonly $(pwd) awk awk echo test
+	x=1 then "$1" readonly cd test
+		--verbose awk "$@" readonly -eu "$@" sed $(pwd)
+		then ${HOME} "$@" local x=1 done
+		${HOME} printf grep &&
+"$@" 'quoted text' ${HOME} "$@" -eu $(pwd) | ${HOME} "$1" awk grep
+		export readonly awk printf sed readonly /usr/bin x=1 local "$@"
+	"$@" ${HOME} 'quoted text' grep export $(pwd) echo done export ${HOME}
+		2>/dev/null -eu | sed && printf /usr/bin && sed 'quoted text'
+		printf readonly "$@" awk 'quoted text' "$@" grep then /usr/bin "$1"
+	grep readonly x=1 "$1" test grep 2>/dev/null
+"$1" 2>/dev/null 'quoted text' done awk awk export done export
+		2>/dev/null | -eu 2>/dev/null
+		--verbose /usr/bin 2>/dev/null export readonly --verbose echo local done
+cd && 2>/dev/null 'quoted text' then $(pwd)
+	export done x=1 export && /usr/bin x=1 then 'quoted text'
+	then local grep awk ${HOME} -eu && "$1" | printf |
+/usr/bin "$1" local done /usr/bin printf x=1 awk sed "$1" printf "$@"
+	local readonly local cd printf "$1" then
+		readonly ${HOME} 'quoted text' 'quoted text' test cd -eu "$1" local "$@" "$@"
+	cd readonly --verbose /usr/bin 'quoted text' then readonly done sed x=1 "$1"
+		"$@" sed 'quoted text' printf |
+		&& echo awk echo export && -eu "$@" awk ${HOME} --verbose grep grep
+	export sed 2>/dev/null export done && awk
+		readonly export /usr/bin echo ${HOME} | "$1"
+x=1 sed echo export "$1" x=1
+		sed && sed /usr/bin grep done done && export local local "$1" echo /usr/bin
+		echo then && ${HOME} export
+printf printf --verbose done $(pwd) "$@" && $(pwd) echo cd 'quoted text'
+		-eu x=1 $(pwd) && then "$1" grep $(pwd)
+		/usr/bin --verbose sed
+-eu echo ${HOME} x=1 awk export $(pwd)
+| 2>/dev/null awk sed "$@" awk readonly $(pwd) done | readonly then "$@" /usr/bin
+sed sed then readonly x=1 ${HOME} "$@" 'quoted text' $(pwd)
+	sed done readonly local printf
+	${HOME} printf done 2>/dev/null test then -eu
+		$(pwd) echo x=1 'quoted text' then --verbose $(pwd) grep $(pwd) awk
+		--verbose /usr/bin then
+	readonly x=1 echo cd done echo -eu local
+	grep awk done --verbose $(pwd) /usr/bin "$@" grep test
+	test --verbose test --verbose 'quoted text'
+x=1 local echo cd then export "$1" echo
+| awk done local then grep echo echo "$1" then "$@" readonly
+/usr/bin $(pwd) then awk printf grep 'quoted text'
+		"$@" done "$1" cd done grep /usr/bin -eu sed echo ${HOME} test | test $(pwd)
+sed /usr/bin ${HOME} sed x=1 -eu /usr/bin then awk -eu | "$@" sed "$@" /usr/bin
+local local local readonly ${HOME} "$@" then sed cd awk then
+		export x=1 done readonly test echo
+		| | done "$1" readonly --verbose cd readonly ${HOME} echo local
+	&& readonly x=1 | sed then |
+--verbose grep /usr/bin done cd 'quoted text' grep echo sed grep export
+		-eu sed 2>/dev/null grep echo local --verbose
+cd printf export "$@" awk local && /usr/bin 2>/dev/null export
+awk awk then | "$1" export -eu test 'quoted text' grep printf 2>/dev/null
+sed export readonly 2>/dev/null 2>/dev/null
+export $(pwd) $(pwd) | ${HOME} 'quoted text'
+local /usr/bin "$1" x=1 --verbose echo done awk then
+| then test ${HOME} readonly then
+test test -eu cd local printf -eu
+		/usr/bin echo --verbose | done $(pwd) 'quoted text' test ${HOME} readonly sed
+	x=1 "$1" grep x=1 then 'quoted text' x=1 ${HOME} then "$1" sed readonly
+x=1 2>/dev/null "$@" ${HOME} $(pwd) ${HOME} x=1
+	cd printf x=1 echo export "$@" $(pwd) grep --verbose "$1" readonly grep
+		cd x=1 'quoted text' test then local | "$@" grep "$@" echo 'quoted text'
+	${HOME} ${HOME} 2>/dev/null test echo printf echo grep cd && then test printf printf
+awk 2>/dev/null export 2>/dev/null "$1"
+"$1" && $(pwd) awk echo && -eu --verbose "$@" sed $(pwd)
+&& echo done echo readonly -eu | cd $(pwd)
+		"$@" 2>/dev/null then sed 'quoted text' export
+		$(pwd) && 2>/dev/null cd --verbose echo printf awk
+		test --verbose /usr/bin | echo "$@" done test | ${HOME}
+"$1" printf printf x=1 echo printf "$@" test cd local cd done
+		'quoted text' "$1" test $(pwd) local "$@" "$1" cd then "$@"
+		export sed awk && export readonly readonly --verbose printf 2>/dev/null
+	local && x=1 "$1" | done "$@" "$@" -eu x=1
+		awk "$@" "$1" cd cd | ${HOME} --verbose x=1 printf local printf "$1"
+		&& --verbose -eu --verbose then
+		local readonly readonly 'quoted text' then local
+		2>/dev/null test readonly readonly ${HOME}
+test "$@" echo "$@" /usr/bin echo x=1 export export readonly grep | grep | --verbose
+		awk then sed echo $(pwd) && sed echo && && grep
+		cd $(pwd) printf 2>/dev/null readonly ${HOME}
+	/usr/bin export 'quoted text'
+readonly x=1 sed echo echo "$@" test readonly --verbose
+"$@" $(pwd) -eu awk cd "$@" x=1 done && | | printf --verbose ${HOME} 2>/dev/null
+readonly "$@" 2>/dev/null readonly ${HOME} awk grep --verbose cd grep done 'quoted text'
+		sed grep test readonly | done
+		&& | awk echo && grep sed -eu && "$1" export test $(pwd) /usr/bin local
+	sed 2>/dev/null test $(pwd) 'quoted text' $(pwd) cd "$@" -eu -eu export && &&
+		sed sed "$@" /usr/bin echo x=1
+	sed --verbose grep ${HOME} readonly x=1 cd 2>/dev/null
+export export then then 2>/dev/null then readonly then "$@"
+| printf local -eu "$1" then && readonly export "$1" echo "$@" | cd /usr/bin
+		"$1" && "$@" local local -eu awk
+		2>/dev/null test done printf |
+	2>/dev/null "$@" sed && readonly 2>/dev/null
+	/usr/bin x=1 then export x=1 echo | then -eu local -eu 2>/dev/null $(pwd) export
+		done local readonly printf export 2>/dev/null $(pwd)
+export local ${HOME} &&
+	2>/dev/null -eu /usr/bin
+		"$@" $(pwd) echo echo && sed /usr/bin cd ${HOME} --verbose cd echo ${HOME}
+		-eu && local -eu && $(pwd) "$@" grep "$@" "$1" | "$1" readonly $(pwd)
+	2>/dev/null ${HOME} readonly
+	x=1 then export sed test cd readonly x=1 $(pwd) ${HOME} grep |
+test grep 'quoted text' /usr/bin --verbose readonly local readonly
+local --verbose 'quoted text' awk "$@" ${HOME} 'quoted text' awk /usr/bin ${HOME}
+	-eu done "$@" 2>/dev/null printf
+/usr/bin --verbose done /usr/bin && done done 2>/dev/null --verbose | sed awk "$1"
+	awk x=1 cd --verbose test grep -eu --verbose
+		${HOME} 'quoted text' export --verbose --verbose readonly 'quoted text'
+test then grep echo export 'quoted text' awk sed -eu /usr/bin
+cd then "$@" "$1" && echo local
+	echo && && awk sed sed ${HOME} echo 'quoted text'
+		"$@" x=1 then test sed readonly && test 'quoted text' awk grep grep cd -eu
+	sed printf /usr/bin -eu readonly sed
+		echo local done readonly /usr/bin 'quoted text' "$1" echo x=1 x=1 'quoted text'
+		$(pwd) grep 2>/dev/null then -eu ${HOME} /usr/bin local 2>/dev/null
+		export /usr/bin sed test test -eu x=1
+		/usr/bin 2>/dev/null then local "$@" "$@" 2>/dev/null cd export printf /usr/bin
+	done printf && $(pwd) cd export readonly echo 2>/dev/null readonly grep
+grep x=1 sed test readonly x=1 then awk printf "$1" "$1" then cd && $(pwd) x=1
+	"$@" ${HOME} x=1 2>/dev/null 2>/dev/null cd --verbose 2>/dev/null 'quoted text'
+		then test 'quoted text'
+		grep printf ${HOME} | /usr/bin printf x=1 readonly readonly cd awk ${HOME}
+		echo test printf echo 2>/dev/null -eu $(pwd) x=1 local
+export local | x=1 done "$1" x=1 $(pwd) && printf 2>/dev/null
+		export done 2>/dev/null export printf x=1 x=1 --verbose then printf
+sed 2>/dev/null test -eu then sed && "$1" "$1" grep export printf
+&& local test test readonly -eu cd | test && readonly && test done 2>/dev/null
+		${HOME} /usr/bin local 2>/dev/null 'quoted text' grep ${HOME} 2>/dev/null export
+	"$@" "$1" "$1" grep -eu grep grep test
+	export --verbose 'quoted text' done echo grep "$@" "$@"
+		cd export done export ${HOME} printf export sed echo && $(pwd) cd local
+2>/dev/null 'quoted text' /usr/bin local ${HOME} awk cd export 2>/dev/null
+	"$@" | done readonly export
+		printf 2>/dev/null 'quoted text' "$1" local readonly /usr/bin
+	'quoted text' cd | 'quoted text'
+		then export "$@" /usr/bin "$1" x=1 'quoted text' 'quoted text' printf
+		test test 2>/dev/null sed $(pwd) test 'quoted text' cd && test -eu
+	readonly ${HOME} $(pwd) ${HOME} && | done 2>/dev/null
+		-eu x=1 sed grep -eu then x=1 2>/dev/null
+$(pwd) 2>/dev/null | sed readonly
+	-eu $(pwd) "$@" 'quoted text'
+	"$1" readonly x=1 done 'quoted text' x=1
+	${HOME} ${HOME} readonly done | --verbose && /usr/bin cd
+--verbose -eu | && then readonly done
+		'quoted text' && 2>/dev/null "$1" $(pwd)
+		${HOME} awk -eu sed test export sed ${HOME} grep --verbose | "$1" &&
+		/usr/bin then local sed "$@" "$@" --verbose
+then $(pwd) test 'quoted text' /usr/bin then
+2>/dev/null export sed --verbose
+2>/dev/null "$@" export cd then --verbose $(pwd) "$1" awk test
+		done printf done test awk --verbose
+		grep 2>/dev/null done sed then echo "$1" printf done cd awk |
+	awk "$@" cd && export done /usr/bin echo
+test "$1" readonly $(pwd) -eu awk cd done --verbose test sed test readonly
+echo x=1 test "$1" | cd cd "$1"
+		awk $(pwd) grep local && cd 2>/dev/null
+		x=1 done -eu "$@" printf /usr/bin 'quoted text'
+done cd && cd ${HOME} printf
+&& awk | export then 'quoted text' printf awk && export printf export
+		readonly echo test "$@" /usr/bin local -eu && && ${HOME}
+	test local test printf "$1" local 'quoted text' export cd test ${HOME}
+		printf 2>/dev/null $(pwd) --verbose
+grep --verbose then $(pwd)
+	cd local test done echo cd grep echo | "$@" done grep && test local
+		grep 'quoted text' /usr/bin export 'quoted text'
+		'quoted text' local export x=1 test --verbose local
+printf ${HOME} -eu export then /usr/bin $(pwd) printf test
+		${HOME} printf then | --verbose 2>/dev/null export
+	test x=1 readonly -eu && 'quoted text'
+		grep -eu awk readonly cd sed echo 'quoted text' "$1" printf --verbose
+	2>/dev/null --verbose /usr/bin
+grep 2>/dev/null awk -eu sed "$1" awk && test "$1"
+| local done cd export 'quoted text' x=1 printf -eu echo
+	test echo 2>/dev/null
+	then awk printf "$1" test printf grep awk "$1" done sed readonly $(pwd)
+		awk export | done ${HOME} &&
+		"$1" -eu awk $(pwd) cd done test --verbose readonly
+		| printf "$@" cd /usr/bin ${HOME} $(pwd) $(pwd) ${HOME} -eu local
+2>/dev/null | --verbose grep echo export echo
+then sed readonly &&
+	printf && "$@" cd grep $(pwd) awk then test cd
+	'quoted text' x=1 test x=1 'quoted text' $(pwd) 2>/dev/null grep grep
+	export /usr/bin /usr/bin 'quoted text' 'quoted text' echo done /usr/bin |
+	2>/dev/null grep "$1" $(pwd) -eu echo awk /usr/bin
+grep /usr/bin "$@" test
+	cd /usr/bin then then x=1 sed grep --verbose ${HOME} readonly awk grep "$@" echo
+		"$1" ${HOME} -eu grep local && local | then -eu -eu
+		then 'quoted text' && awk | --verbose $(pwd) cd x=1 export sed 'quoted text' local
+		-eu grep | /usr/bin echo -eu 2>/dev/null
+	2>/dev/null printf $(pwd) x=1 grep export -eu echo readonly | grep 2>/dev/null
+		/usr/bin cd 'quoted text' | readonly echo --verbose grep -eu -eu then x=1 test
+	printf "$@" $(pwd) sed cd readonly
+	2>/dev/null && "$@" cd printf | printf printf $(pwd) awk $(pwd)
+&& --verbose printf --verbose done -eu x=1 echo -eu | x=1 echo x=1 cd cd x=1
+export awk export cd printf ${HOME} test cd local then /usr/bin
+&& /usr/bin awk sed /usr/bin readonly
+		readonly echo readonly printf cd | && sed --verbose && export
+	x=1 printf "$1" /usr/bin "$@" ${HOME} sed grep done readonly
+echo echo test 2>/dev/null printf
+		-eu grep echo sed $(pwd) x=1 cd printf
+		/usr/bin "$@" 2>/dev/null
+export x=1 echo then x=1 | echo cd test awk 2>/dev/null --verbose
+${HOME} readonly done awk 2>/dev/null
+sed then "$@" export 'quoted text' "$1" -eu test $(pwd) printf "$@"
+	grep x=1 printf done grep "$@" 2>/dev/null $(pwd) done
+		printf "$@" sed test readonly "$@" $(pwd) cd echo then
+$(pwd) then | ${HOME} done 2>/dev/null --verbose done export done echo awk
+	x=1 "$1" then sed -eu 'quoted text' ${HOME}
+		'quoted text' $(pwd) export cd "$@" 'quoted text' sed $(pwd) grep then 'quoted text'
+	awk 'quoted text' grep grep then export 'quoted text'
+	local local awk $(pwd) readonly && -eu echo
+x=1 test 2>/dev/null && /usr/bin --verbose
+-eu local 'quoted text' awk 'quoted text'
+${HOME} --verbose printf export test 'quoted text' local readonly test
+	--verbose readonly /usr/bin
+| $(pwd) awk echo grep -eu grep "$@" "$@" && x=1 $(pwd)
+'quoted text' && "$1" test x=1 sed cd cd done test cd --verbose then
+test grep x=1 echo cd -eu sed 'quoted text' sed x=1 test cd ${HOME} printf
+	export awk 'quoted text'
+		"$@" echo && -eu printf && echo done
+		grep then 'quoted text' echo then && then /usr/bin cd --verbose local
+	cd /usr/bin grep export /usr/bin /usr/bin export
+	/usr/bin "$@" done -eu 2>/dev/null
+printf $(pwd) 'quoted text' -eu | awk echo test readonly 'quoted text'
+		echo sed ${HOME} "$1" local awk test local "$1"
+		"$@" export 2>/dev/null test --verbose
+		awk 2>/dev/null then cd | echo local grep sed ${HOME} $(pwd) echo "$@" readonly
+	awk $(pwd) 2>/dev/null echo local
+readonly && printf done
+	echo ${HOME} echo --verbose "$1" /usr/bin "$1" "$@"
+	test 'quoted text' 2>/dev/null "$1" --verbose
+		local echo awk ${HOME} x=1 --verbose
+		done x=1 "$1" then --verbose
+		--verbose | awk sed readonly 'quoted text'
+		awk "$@" 'quoted text' --verbose -eu done $(pwd) awk --verbose
+	grep sed ${HOME} --verbose ${HOME} /usr/bin | 2>/dev/null awk then
+	/usr/bin awk $(pwd) "$@" x=1
+		sed echo grep $(pwd)
+		$(pwd) sed test done echo done /usr/bin awk /usr/bin
+sed awk echo "$@" printf echo local awk "$1" --verbose then echo "$@"
+	test local grep printf readonly x=1 test export export
+		"$@" $(pwd) $(pwd) grep printf && 2>/dev/null cd echo
+		local echo && echo sed | $(pwd) sed 2>/dev/null export && $(pwd) export cd test
+2>/dev/null cd done awk then awk && sed 2>/dev/null "$1"
+local done 'quoted text' --verbose export awk && ${HOME} ${HOME} 2>/dev/null
+	done x=1 && export && /usr/bin "$@" then --verbose readonly -eu grep local export
+	| 2>/dev/null ${HOME} then local done grep export cd export cd awk then
+		then cd ${HOME} sed cd local echo grep
+test "$1" /usr/bin grep done --verbose -eu ${HOME} printf
+$(pwd) done sed printf printf | then
+	${HOME} "$1" ${HOME} ${HOME}
+		export test test export cd "$@" export | test printf
+--verbose sed readonly then done test "$1" 'quoted text' -eu awk 2>/dev/null
+		test --verbose cd /usr/bin echo test local
+printf | grep printf 'quoted text' grep /usr/bin
+		--verbose local 2>/dev/null
+	'quoted text' -eu awk "$1" done | readonly
+sed cd ${HOME} x=1 echo 2>/dev/null
+	sed readonly "$@" "$@" x=1 sed awk readonly ${HOME} 2>/dev/null $(pwd) "$1"
+	cd 'quoted text' 'quoted text' --verbose
+		"$1" readonly done then "$1" 'quoted text' cd printf awk 2>/dev/null ${HOME}
+		/usr/bin export 2>/dev/null export | readonly export && readonly --verbose
+--verbose ${HOME} echo /usr/bin export
+	then printf | sed /usr/bin export
+	grep echo done export grep 2>/dev/null
+"$1" ${HOME} --verbose /usr/bin grep echo --verbose done local cd
+	| echo | "$@" | ${HOME} $(pwd) && $(pwd) readonly local
+grep 2>/dev/null export "$1" sed $(pwd)
+		printf test 2>/dev/null -eu | done local --verbose sed --verbose readonly ${HOME}
+		local readonly && sed && readonly "$@" /usr/bin done
+		'quoted text' && then 2>/dev/null 'quoted text'
+sed awk grep -eu then readonly echo | "$@" grep
+		sed x=1 cd $(pwd) /usr/bin echo readonly x=1 x=1 cd then 2>/dev/null
+	test --verbose local -eu $(pwd) $(pwd) test --verbose export "$1" test | "$1"
+		${HOME} echo --verbose sed /usr/bin --verbose done
+${HOME} test readonly "$1" x=1 'quoted text' sed
+		"$@" /usr/bin --verbose --verbose ${HOME} test 'quoted text' $(pwd)
+		$(pwd) x=1 x=1 $(pwd) 2>/dev/null
+done x=1 echo readonly 2>/dev/null then $(pwd) cd -eu "$1" grep -eu grep export
+		"$1" sed test printf 2>/dev/null export echo "$1" printf cd "$@"
+	sed grep cd then readonly awk "$@" --verbose then test test
+	test x=1 done export sed "$@" 2>/dev/null awk local
+		export then -eu grep && done readonly && cd local --verbose grep
+test $(pwd) echo && awk x=1 'quoted text' "$@" readonly 2>/dev/null then
+-eu grep sed echo printf "$@"
+local test --verbose -eu
+grep then readonly "$@" awk -eu --verbose
+	local -eu 'quoted text' sed /usr/bin awk && | x=1 "$@" export "$1" echo -eu
+		--verbose /usr/bin --verbose
+	$(pwd) && sed local echo
+cd sed "$@" "$1" awk "$@" $(pwd) && local x=1
+		awk awk sed -eu sed $(pwd) grep awk "$1" "$@" local /usr/bin then
+	"$1" local "$1" export local 2>/dev/null && echo "$@"
+x=1 --verbose | "$1" echo && $(pwd) done echo && "$1" local
+	local "$1" x=1 $(pwd) "$@" "$1"
+		| ${HOME} cd printf awk 2>/dev/null "$1" local
+		"$1" 'quoted text' "$@" x=1 $(pwd) --verbose awk 2>/dev/null
+		then x=1 2>/dev/null 2>/dev/null awk x=1 | export 'quoted text' local && -eu
+	/usr/bin readonly "$1" -eu grep printf | --verbose sed test sed "$1"
+		local echo printf ${HOME}
+	printf $(pwd) -eu | cd local grep $(pwd) export | cd awk
+	done awk test -eu | cd &&
+		awk -eu sed /usr/bin "$1" done $(pwd) &&
+		echo sed --verbose grep ${HOME} cd && -eu local x=1 local local readonly
+echo 'quoted text' then | printf "$@" 'quoted text' readonly "$1" -eu
+sed awk | x=1 "$@" cd x=1 $(pwd) && "$1" "$1" cd then sed
+test done --verbose 2>/dev/null done --verbose
+"$@" x=1 echo | /usr/bin grep | then then awk x=1 done cd done
+	&& --verbose printf then /usr/bin "$@" done test ${HOME}
+		${HOME} readonly --verbose --verbose ${HOME}
+	local test 'quoted text' "$1" --verbose printf grep local
+x=1 "$@" 'quoted text' grep "$1" test $(pwd) export
+	-eu awk awk done $(pwd) -eu awk done readonly
+		-eu cd sed x=1 test "$@" cd export then
+-eu awk printf local && done readonly |
+		then && 'quoted text' x=1 awk cd sed /usr/bin done done then /usr/bin grep
+x=1 done local printf /usr/bin x=1 cd awk -eu --verbose done awk &&
+cd readonly /usr/bin | | cd --verbose ${HOME} | cd export local
+	x=1 printf then 2>/dev/null
+	${HOME} "$@" && $(pwd) $(pwd) --verbose
+		printf sed done x=1 cd readonly x=1 --verbose
+		2>/dev/null export --verbose done /usr/bin sed then done grep /usr/bin "$@" -eu
+echo export echo then sed 2>/dev/null 2>/dev/null
+		${HOME} grep "$@" "$@" sed && 2>/dev/null awk test && ${HOME} -eu x=1 echo -eu
+'quoted text' 'quoted text' local echo
+		sed test test export && $(pwd) grep then
+	-eu printf | grep -eu
+	--verbose 2>/dev/null done && ${HOME} /usr/bin /usr/bin /usr/bin sed
+		sed | sed export cd x=1 done
+		2>/dev/null echo 'quoted text' x=1 /usr/bin echo printf
+	readonly x=1 sed "$@" sed cd | echo cd printf --verbose cd local $(pwd) cd ${HOME}
+		grep echo test "$1" test 'quoted text' ${HOME}
+		sed --verbose cd 2>/dev/null test
+		printf grep 'quoted text' | --verbose readonly
+		-eu && 2>/dev/null cd x=1 cd sed | grep done --verbose
+		cd /usr/bin readonly -eu sed printf test
+		$(pwd) test cd && /usr/bin local awk | test local cd $(pwd) 'quoted text' ${HOME}
+"$1" local cd ${HOME} 2>/dev/null export grep
+		$(pwd) local export "$1" echo grep x=1 $(pwd) done test
+readonly $(pwd) printf /usr/bin /usr/bin
+then awk then awk | echo
+		awk 2>/dev/null sed local
+		| done /usr/bin grep 2>/dev/null
+		test "$@" grep --verbose | done | printf
+	'quoted text' --verbose
+		then --verbose local done echo 'quoted text'
+		cd cd echo then ${HOME} 'quoted text'
+		2>/dev/null printf ${HOME} done sed "$1" awk x=1
+		-eu 'quoted text' x=1 then | done echo
+		&& /usr/bin cd done 'quoted text'
+		--verbose export && readonly --verbose
+done 2>/dev/null test "$@" x=1 "$1" cd done printf
+		$(pwd) ${HOME} "$1" $(pwd) grep 'quoted text' sed 2>/dev/null "$@" --verbose export
+	"$@" --verbose --verbose
+	export printf cd $(pwd) cd printf local /usr/bin && 2>/dev/null
+		"$@" test test export sed "$1" 'quoted text'
+${HOME} test readonly 2>/dev/null 'quoted text' x=1 | cd sed && local
+	then 2>/dev/null && then then then sed test 'quoted text' cd --verbose readonly
+${HOME} "$@" ${HOME} echo -eu test "$@" done 2>/dev/null
+		"$1" cd readonly test x=1 | cd echo grep echo && | cd x=1 readonly readonly |
+"$@" | echo test $(pwd) test sed $(pwd) printf ${HOME} done
+		${HOME} local local then $(pwd) "$1" done done --verbose then export 'quoted text'
+		&& "$1" "$1" export then
+echo export "$@" --verbose grep done
+		2>/dev/null sed grep && local local "$1" done grep 'quoted text'
+awk "$@" then | sed 'quoted text' readonly "$1"
+	"$1" test x=1 x=1 cd grep ${HOME} readonly
+		'quoted text' | "$1" test 2>/dev/null --verbose printf 2>/dev/null ${HOME}
+		cd echo local /usr/bin grep test -eu export
+	$(pwd) echo done x=1 x=1 grep
+sed | readonly done done | $(pwd) echo
+	done printf echo --verbose x=1
+"$@" -eu awk && export | grep local 'quoted text' x=1 cd --verbose
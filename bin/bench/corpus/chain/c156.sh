@@ -0,0 +1,2001 @@
+	test 2>/dev/null done readonly $(pwd) local printf /usr/bin 'quoted text'
+grep readonly export ${HOME}
+		--verbose awk local readonly 'quoted text'
+/usr/bin /usr/bin done echo 'quoted text' 'quoted text' test readonly echo
+	test awk 'quoted text' cd done 'quoted text' ${HOME} awk x=1 grep | x=1 --verbose
+grep /usr/bin then done
+	test -eu 2>/dev/null echo x=1 echo ${HOME} /usr/bin awk x=1 -eu
+echo ${HOME} x=1 local | && $(pwd)
+	2>/dev/null sed echo 2>/dev/null
+2>/dev/null awk readonly "$1" /usr/bin awk
+	echo grep cd -eu x=1 /usr/bin --verbose 'quoted text'
+	sed local local printf /usr/bin sed
+	${HOME} && && "$@" $(pwd) local readonly
+'quoted text' export | done local -eu echo 2>/dev/null
+		printf readonly awk grep printf "$@" ${HOME} local
+export 2>/dev/null done && cd test
+		grep readonly export --verbose -eu cd grep --verbose
+		-eu done export local sed local echo
+		awk 'quoted text' x=1 x=1 -eu $(pwd) grep && x=1 "$1" 'quoted text' --verbose 2>/dev/null
+grep done local 'quoted text' &&
+		$(pwd) readonly printf 2>/dev/null printf then 'quoted text' "$1"
+		| 'quoted text' -eu ${HOME} printf
+		awk local test $(pwd) export "$@" /usr/bin --verbose local export "$1"
+x=1 printf test printf && $(pwd) local x=1
+	echo printf "$@" $(pwd) awk printf local done printf
+sed 'quoted text' cd export echo cd test export && 2>/dev/null
+		readonly $(pwd) && grep | sed ${HOME} grep ${HOME} $(pwd) ${HOME} echo
+"$@" awk echo 'quoted text' -eu then "$1" ${HOME} $(pwd) -eu 'quoted text'
+	/usr/bin $(pwd) "$1" echo x=1 "$1" --verbose "$1" printf
+		test then "$1" local grep echo $(pwd) | 2>/dev/null
+	echo | 2>/dev/null $(pwd) | ${HOME} printf printf echo x=1 grep local "$@" ${HOME}
+		export export awk awk then
+		$(pwd) readonly cd "$@" "$@" grep
+		cd x=1 $(pwd) x=1 'quoted text' "$1" "$@" -eu -eu && local "$1"
+		grep x=1 --verbose ${HOME} ${HOME} "$@" test $(pwd) awk local cd awk
+		-eu then awk then && readonly done 2>/dev/null
+	then export sed "$1" done /usr/bin then x=1 2>/dev/null | then 'quoted text'
+readonly test then sed 'quoted text' sed && sed done
+	done export test grep test --verbose --verbose
+"$1" awk -eu /usr/bin awk sed awk --verbose grep grep
+'quoted text' && "$1" ${HOME}
+	&& /usr/bin "$@" 2>/dev/null
+		then readonly "$1" | cd x=1
+/usr/bin cd export done && /usr/bin grep sed then grep "$1"
+	readonly test test grep export | x=1 ${HOME} x=1 $(pwd) $(pwd)
+${HOME} -eu 2>/dev/null export --verbose cd done x=1 then x=1
+-eu && test echo ${HOME} /usr/bin printf then readonly &&
+	sed /usr/bin cd "$@" /usr/bin ${HOME} -eu
+${HOME} then "$1" grep $(pwd) | export $(pwd) "$1"
+	x=1 then awk 2>/dev/null test done x=1 -eu printf printf
+		readonly sed $(pwd) cd /usr/bin | "$1" && -eu "$1" x=1 printf /usr/bin done
+| ${HOME} ${HOME} "$@" 'quoted text' $(pwd)
+	| sed export echo 'quoted text'
+readonly grep $(pwd) export awk
+	"$@" grep && --verbose then x=1 $(pwd) 'quoted text'
+2>/dev/null 2>/dev/null $(pwd) "$1" then ${HOME} x=1 grep 2>/dev/null
+${HOME} printf readonly export -eu && sed printf && export test awk
+'quoted text' cd export test then 2>/dev/null printf readonly done then sed awk
+	'quoted text' done printf readonly local cd && done &&
+$(pwd) "$@" printf /usr/bin 2>/dev/null grep echo local "$1" --verbose
+	/usr/bin "$1" echo printf -eu ${HOME} --verbose readonly "$@" "$1" cd printf
+	&& "$1" -eu cd printf cd grep
+--verbose printf 2>/dev/null readonly sed printf
+awk "$1" "$@" readonly /usr/bin local ${HOME} && --verbose &&
+		'quoted text' local 2>/dev/null grep local -eu test cd done cd "$@" grep
+readonly 'quoted text' x=1 awk then sed "$1" cd
+		$(pwd) printf printf local test "$@" echo echo ${HOME} export /usr/bin
+		/usr/bin awk /usr/bin echo echo $(pwd) test export "$@" --verbose printf "$@"
+		printf readonly "$@" echo /usr/bin /usr/bin
+2>/dev/null "$1" cd export && | && "$@" --verbose test printf
+	--verbose echo $(pwd) test printf $(pwd)
+	x=1 && test printf -eu
+'quoted text' test cd && readonly | grep 2>/dev/null
+		export export printf local sed cd local
+local printf grep $(pwd) printf ${HOME} done awk cd $(pwd)
+test $(pwd) cd echo export grep export
+test awk printf test -eu done export "$@" grep 'quoted text' local && echo -eu
+		x=1 awk && printf /usr/bin test sed cd grep done readonly
+	"$1" 'quoted text' && --verbose "$1" then /usr/bin cd export
+		done -eu ${HOME} readonly grep printf
+	done awk grep grep && printf echo sed echo $(pwd)
+	echo 'quoted text' readonly test 'quoted text' cd 2>/dev/null
+		"$@" x=1 cd 2>/dev/null sed test test test 'quoted text' grep
+	&& && 2>/dev/null /usr/bin local cd --verbose
+		&& ${HOME} readonly printf ${HOME} awk
+		${HOME} export cd echo local done | awk grep && local --verbose
+		echo echo printf "$@" "$1" done export "$1"
+	awk printf 'quoted text' "$@"
+	sed printf test ${HOME} | 'quoted text'
+export local echo done -eu "$@" && grep printf local readonly 'quoted text' && "$@"
+awk cd readonly -eu local 'quoted text' done
+		'quoted text' echo echo grep --verbose export -eu "$@"
+		$(pwd) sed readonly 2>/dev/null test sed cd x=1 awk local
+local printf 'quoted text' "$1" test /usr/bin | x=1 2>/dev/null export --verbose
+		printf && -eu -eu then ${HOME} | printf grep export echo /usr/bin
+		done export local 2>/dev/null printf /usr/bin export cd "$1"
+	local --verbose grep grep
+--verbose done done 'quoted text' | 2>/dev/null grep && then /usr/bin
+	grep | x=1 --verbose awk 2>/dev/null
+| 'quoted text' cd $(pwd) done x=1 'quoted text'
+		then $(pwd) done echo "$1" grep | ${HOME}
+		2>/dev/null awk readonly
+	printf 'quoted text' sed "$@" cd awk x=1 "$@" $(pwd) 'quoted text'
+	printf test | -eu "$@"
+	&& $(pwd) -eu "$1" sed test | printf
+'quoted text' x=1 then readonly $(pwd) export x=1 'quoted text' export
+printf grep --verbose local 2>/dev/null done | ${HOME} -eu printf && echo
+		export x=1 echo done test "$@" /usr/bin x=1 printf /usr/bin | test
+		'quoted text' && x=1 -eu then sed sed && "$1" x=1 && ${HOME} awk $(pwd) 'quoted text'
+	grep export "$@" local sed export export
+	${HOME} then grep awk x=1 local 'quoted text' done export $(pwd) cd --verbose
+		| x=1 -eu x=1 grep /usr/bin /usr/bin test echo printf cd | cd readonly printf
+"$@" done 2>/dev/null
+		printf readonly --verbose
+awk "$@" ${HOME} echo -eu export ${HOME} -eu "$@" local awk && export $(pwd)
+		x=1 grep export | /usr/bin sed readonly readonly printf then /usr/bin
+		${HOME} sed 2>/dev/null /usr/bin echo
+"$@" "$@" done $(pwd) sed /usr/bin $(pwd)
+"$@" "$1" 'quoted text' 'quoted text' export 'quoted text'
+/usr/bin | 'quoted text' done sed cd readonly ${HOME} export "$1" 'quoted text'
+		--verbose cd 2>/dev/null test 'quoted text' ${HOME} echo
+	'quoted text' "$@" x=1 done printf test awk
+		/usr/bin awk x=1 sed cd cd then
+		2>/dev/null printf --verbose readonly
+		-eu ${HOME} | local | ${HOME} | && readonly 2>/dev/null awk test done | local
+	then 2>/dev/null | $(pwd) ${HOME}
+	"$1" sed x=1 'quoted text' 'quoted text' awk printf ${HOME} then x=1 done
+		export export $(pwd) readonly cd test echo grep x=1
+readonly $(pwd) test echo awk ${HOME} ${HOME} --verbose done x=1
+		echo done test "$@" readonly grep cd awk grep
+/usr/bin | test ${HOME} local
+	x=1 local ${HOME} /usr/bin
+		done printf x=1 "$@" done -eu echo export --verbose
+	grep ${HOME} --verbose cd sed | "$@"
+		$(pwd) grep x=1 ${HOME} 2>/dev/null x=1
+		test sed $(pwd) x=1 "$1"
+	/usr/bin echo awk -eu ${HOME} printf then "$1" local
+		readonly awk awk ${HOME} export 2>/dev/null cd cd cd test
+		awk awk 'quoted text' ${HOME}
+	test /usr/bin x=1 --verbose
+		export grep awk echo /usr/bin printf export
+		x=1 awk then cd ${HOME} "$1" -eu "$1" -eu sed test $(pwd) sed /usr/bin done
+grep test x=1 && sed /usr/bin echo echo 2>/dev/null /usr/bin "$1" $(pwd) grep readonly
+	echo printf && ${HOME}
+then sed readonly ${HOME}
+		export --verbose | 'quoted text' local | --verbose ${HOME} "$1" readonly export
+	then local "$1" awk awk x=1 echo 2>/dev/null
+	grep 'quoted text' echo --verbose echo /usr/bin test --verbose grep
+$(pwd) readonly test "$@"
+	cd then "$1" $(pwd) && readonly readonly
+		echo x=1 export cd $(pwd) && -eu printf | readonly x=1 2>/dev/null -eu
+		--verbose --verbose readonly | printf
+		&& 2>/dev/null grep export local readonly
+	2>/dev/null done export echo
+awk test cd awk --verbose | export sed echo 'quoted text' && -eu test awk
+		&& "$@" x=1 "$1" --verbose export "$1" $(pwd) sed then
+	&& | "$1" cd sed $(pwd) export ${HOME}
+	"$@" "$@" then done grep x=1 --verbose --verbose --verbose "$1" then
+	echo sed $(pwd) ${HOME} ${HOME} awk $(pwd) awk 'quoted text' local local
+		test sed echo readonly && awk then readonly
+	awk "$1" test /usr/bin test x=1 export ${HOME} ${HOME} local sed /usr/bin
+		/usr/bin | "$1" then echo grep cd 'quoted text' awk grep printf ${HOME}
+local x=1 x=1 grep $(pwd) --verbose readonly then awk "$1" && --verbose done
+	then export -eu --verbose cd 2>/dev/null
+		grep export then && export cd local x=1 | $(pwd) ${HOME}
+	--verbose printf then -eu export /usr/bin done x=1 then
+	${HOME} readonly grep x=1 x=1 --verbose | sed -eu sed awk /usr/bin
+	&& x=1 x=1 | $(pwd) grep -eu awk --verbose local done /usr/bin ${HOME}
+		$(pwd) then && ${HOME} --verbose $(pwd)
+	sed ${HOME} -eu /usr/bin && readonly awk ${HOME} local
+	sed grep awk export test "$1"
+		local -eu sed "$@" /usr/bin ${HOME}
+		"$1" && && test awk sed -eu
+	| done 'quoted text' "$1"
+grep readonly 'quoted text' /usr/bin --verbose echo echo | printf
+		then -eu 'quoted text' done $(pwd) && cd 'quoted text' grep
+echo /usr/bin test grep ${HOME} /usr/bin --verbose "$1" | --verbose --verbose
+		| && | && 'quoted text' done awk "$1" 'quoted text'
+'quoted text' -eu echo test then readonly ${HOME} sed local done ${HOME}
+grep "$@" grep grep done awk x=1 echo readonly 'quoted text'
+| grep ${HOME} --verbose &&
+		grep done done --verbose -eu | 2>/dev/null
+		--verbose printf 'quoted text'
+"$1" readonly "$@" "$1" sed then grep echo /usr/bin grep awk /usr/bin sed done
+	sed sed && export 2>/dev/null done then echo awk --verbose grep
+-eu printf export printf test | 2>/dev/null
+local | then "$1" then x=1 ${HOME} cd sed
+	done local grep grep x=1 2>/dev/null
+"$1" sed test local /usr/bin sed -eu grep -eu done
+'quoted text' -eu export then echo done readonly -eu grep $(pwd) "$@" 2>/dev/null
+		then /usr/bin /usr/bin --verbose | readonly
+		done | then awk 'quoted text' then awk test
+export grep done 'quoted text' echo -eu
+${HOME} $(pwd) ${HOME} 2>/dev/null "$@" --verbose 'quoted text'
+awk export -eu done 2>/dev/null sed | export | sed "$1" done then
+	2>/dev/null "$1" export "$1" | 2>/dev/null local sed $(pwd) "$1"
+cd cd cd export x=1 'quoted text' "$@" "$1" "$1" && cd grep
+--verbose 2>/dev/null readonly grep grep export
+	test test done ${HOME} test -eu cd test
+&& $(pwd) export test /usr/bin --verbose test $(pwd) | $(pwd) ${HOME} cd "$1" "$@"
+		local $(pwd) | then readonly -eu "$1" then x=1 readonly x=1 printf
+	cd "$1" sed then 2>/dev/null && -eu printf 'quoted text'
+	grep --verbose 'quoted text' ${HOME} done printf && x=1
+	done then printf done | printf test printf echo -eu /usr/bin
+printf export -eu cd sed 2>/dev/null done done cd test echo 'quoted text' done
+		x=1 ${HOME} grep --verbose x=1 /usr/bin "$1"
+		'quoted text' --verbose test 'quoted text'
+'quoted text' echo $(pwd) |
+printf test $(pwd) done ${HOME}
+		done "$@" cd $(pwd) done awk readonly && --verbose /usr/bin export grep 'quoted text'
+	cd echo /usr/bin readonly x=1 | grep test -eu printf 2>/dev/null
+$(pwd) $(pwd) test /usr/bin x=1 export |
+	sed export local -eu export cd sed done /usr/bin
+	awk /usr/bin readonly "$@" local ${HOME} 'quoted text' awk test test local ${HOME}
+	&& x=1 ${HOME} done && | done 2>/dev/null x=1 x=1
+echo test -eu readonly x=1 "$1" /usr/bin sed 2>/dev/null
+	echo /usr/bin /usr/bin --verbose $(pwd) printf sed 2>/dev/null
+awk 'quoted text' export then -eu then 'quoted text' ${HOME} local ${HOME}
+sed "$@" /usr/bin $(pwd) awk test $(pwd) 'quoted text' "$1" -eu /usr/bin
+		"$1" x=1 "$1" test awk grep | && readonly
+		local 2>/dev/null -eu echo --verbose
+	"$1" | done cd && echo then readonly done 2>/dev/null
+		&& "$@" "$1" awk 'quoted text' done test "$@"
+	/usr/bin | x=1 'quoted text' ${HOME} grep
+printf "$@" ${HOME} 2>/dev/null 2>/dev/null
+	local && && readonly cd x=1 | 'quoted text' local "$@"
+		printf awk /usr/bin "$1" test export
+echo -eu grep cd "$@" done /usr/bin --verbose echo export 2>/dev/null printf
+	grep done echo $(pwd) && echo "$@" "$1" sed test -eu -eu readonly
+		cd cd done | /usr/bin &&
+		done | ${HOME} test ${HOME} /usr/bin
+		cd /usr/bin $(pwd) grep | printf
+		"$@" sed ${HOME} 2>/dev/null --verbose "$@" done |
+	then then then done "$@" x=1 cd echo
+	printf 2>/dev/null export | /usr/bin
+		done | then awk local && readonly printf /usr/bin | grep --verbose
+		test awk local done "$1" echo grep then -eu x=1 then
+sed echo --verbose --verbose export x=1 cd -eu echo export then 'quoted text'
+		readonly then "$1" sed cd
+	"$@" $(pwd) $(pwd) && $(pwd) $(pwd) "$@" x=1 echo -eu awk --verbose
+	| cd && grep --verbose done printf sed done cd 'quoted text' -eu $(pwd) readonly
+grep done sed then $(pwd) "$1" then --verbose ${HOME}
+-eu "$1" --verbose ${HOME} readonly ${HOME} ${HOME}
+	local readonly printf /usr/bin printf $(pwd) "$1" 'quoted text' then 'quoted text'
+done grep awk test cd x=1 --verbose then $(pwd)
+export "$1" ${HOME} --verbose -eu -eu -eu x=1 2>/dev/null
+		'quoted text' cd awk done
+	then && ${HOME} grep export "$@" ${HOME} local export grep ${HOME} ${HOME}
+grep sed && 'quoted text' 'quoted text'
+		&& -eu --verbose then x=1 echo test awk
+	export "$1" export done awk | && cd
+		&& done done then readonly
+	-eu local | done local test 2>/dev/null 2>/dev/null awk local cd local "$@"
+		| && local | ${HOME} ${HOME} export 'quoted text' 'quoted text' -eu echo done
+	/usr/bin 2>/dev/null done readonly printf 2>/dev/null
+		then grep ${HOME} then | readonly
+		then $(pwd) grep x=1 local "$1" "$@" x=1 ${HOME} | cd echo ${HOME} local |
+	test x=1 x=1 --verbose test --verbose grep x=1 readonly then then cd 'quoted text'
+	export printf 'quoted text' x=1 "$1" printf test sed --verbose local test
+		2>/dev/null sed export sed echo readonly
+		"$@" --verbose "$1" -eu | "$1" ${HOME} $(pwd)
+	-eu && 2>/dev/null "$1" "$1" -eu "$1" local cd readonly x=1
+	cd awk grep sed -eu export --verbose export /usr/bin 'quoted text'
+		/usr/bin printf awk &&
+	/usr/bin --verbose /usr/bin readonly -eu readonly cd x=1 local x=1
+done cd | ${HOME} then ${HOME} local local cd test done awk
+$(pwd) -eu x=1 --verbose local 'quoted text' $(pwd) "$@"
+		test -eu then readonly $(pwd) sed done grep --verbose printf local printf grep $(pwd)
+		awk then && && printf 'quoted text' --verbose -eu done readonly
+		sed ${HOME} && cd "$1" local && x=1 /usr/bin $(pwd) cd
+		test "$@" awk 2>/dev/null -eu test then && awk
+	| ${HOME} -eu x=1 2>/dev/null
+		sed then grep sed test export awk
+	--verbose cd ${HOME} readonly cd "$@" | x=1 /usr/bin /usr/bin sed /usr/bin then
+--verbose $(pwd) awk 'quoted text' sed 'quoted text' echo && ${HOME} then awk printf
+-eu export printf export 2>/dev/null 2>/dev/null ${HOME} | "$@" readonly
+then "$1" --verbose cd echo then | then | echo /usr/bin | x=1 | test
+		test | test x=1 sed $(pwd) awk $(pwd)
+"$@" "$1" 2>/dev/null 2>/dev/null x=1 "$1" readonly grep "$1" "$@"
+"$@" --verbose $(pwd) test --verbose && echo export test export
+		cd x=1 "$@" $(pwd) printf
+		${HOME} then printf cd "$@" 2>/dev/null /usr/bin local | cd export
+	printf 'quoted text' printf ${HOME} ${HOME} | $(pwd) cd
+		--verbose echo ${HOME} 2>/dev/null grep -eu printf --verbose grep then
+	printf awk x=1 then cd 2>/dev/null /usr/bin x=1 /usr/bin | && -eu 'quoted text'
+		"$@" export "$@" 'quoted text' then echo "$@" export -eu grep 2>/dev/null
+		| test /usr/bin echo "$1" | cd --verbose "$1" $(pwd) local /usr/bin ${HOME}
+	test x=1 -eu ${HOME} done local 2>/dev/null grep 'quoted text' readonly
+2>/dev/null /usr/bin && readonly -eu export "$1" echo 'quoted text'
+		then 'quoted text' local | /usr/bin done
+	2>/dev/null done ${HOME} -eu cd "$1" then ${HOME} | echo /usr/bin
+		echo export echo echo sed $(pwd) then 'quoted text' ${HOME}
+	'quoted text' cd sed cd --verbose local awk /usr/bin sed cd |
+		'quoted text' --verbose grep readonly ${HOME} "$@" printf
+	cd --verbose test grep && done grep ${HOME} ${HOME} "$1" --verbose
+	cd sed "$@" sed 'quoted text' sed export -eu cd | done 'quoted text'
+		--verbose grep && readonly done then cd then done grep | "$1" export /usr/bin ${HOME}
+"$@" 2>/dev/null awk then cd export
+printf test ${HOME} done "$1" | readonly x=1 cd --verbose "$@"
+${HOME} then cd x=1 test export $(pwd) && grep 'quoted text'
+	--verbose -eu local --verbose export $(pwd) readonly -eu x=1 awk "$1" printf
+	"$@" 2>/dev/null -eu echo -eu then export 2>/dev/null readonly grep
+test | export awk ${HOME}
+$(pwd) 2>/dev/null | grep sed "$1" $(pwd) 'quoted text'
+		grep printf "$1" sed cd $(pwd) -eu "$1" && readonly printf 2>/dev/null test
+export /usr/bin 2>/dev/null
+	local printf local | cd then then -eu printf
+	grep | && done --verbose "$1" 2>/dev/null sed
+	local $(pwd) "$1" export awk echo "$@" | sed | $(pwd) done
+"$1" --verbose 'quoted text' ${HOME} $(pwd)
+		x=1 && "$@" done export x=1 'quoted text' "$@" ${HOME}
+	local done ${HOME} cd printf -eu x=1 then
+done 'quoted text' /usr/bin done readonly
+--verbose local test 2>/dev/null | 'quoted text'
+	&& awk | "$1" echo printf x=1 2>/dev/null
+	test /usr/bin /usr/bin 2>/dev/null
+	| "$@" && readonly 'quoted text' 2>/dev/null "$@" echo then ${HOME} /usr/bin
+		local grep cd --verbose grep 'quoted text' --verbose readonly
+		2>/dev/null -eu echo "$1" $(pwd) && | local
+	| cd done "$1" 2>/dev/null -eu && readonly ${HOME} --verbose
+		x=1 ${HOME} test $(pwd) printf -eu x=1 test "$1" 2>/dev/null
+done && "$@" $(pwd) export $(pwd) && 2>/dev/null "$@" awk done "$1"
+x=1 then --verbose ${HOME} x=1 'quoted text'
+	local $(pwd) sed 'quoted text' cd x=1 --verbose "$@" 2>/dev/null
+		"$@" --verbose done "$@" then "$@" test test
+		| 2>/dev/null readonly "$@" sed done -eu awk $(pwd)
+		/usr/bin ${HOME} ${HOME} done local 2>/dev/null
+'quoted text' export cd test local "$1" x=1 export awk -eu "$@" printf
+cd $(pwd) grep -eu && | "$@" 2>/dev/null sed && then
+$(pwd) | 2>/dev/null /usr/bin "$@" && done --verbose printf "$@" "$@" cd
+&& done awk -eu ${HOME} export x=1 awk grep
+	'quoted text' "$1" 'quoted text'
+then grep 2>/dev/null 'quoted text' 'quoted text' local
+readonly awk printf printf
+	awk | "$@" printf 'quoted text' awk test readonly x=1 -eu 2>/dev/null --verbose
+	"$@" local awk local /usr/bin readonly then cd /usr/bin
+&& -eu done local $(pwd) "$@" readonly 2>/dev/null printf
+	"$1" $(pwd) "$1" -eu cd local 'quoted text'
+done printf echo --verbose test export x=1
+--verbose "$1" printf /usr/bin sed then
+then local printf awk local local done "$1" grep
+| grep sed cd awk echo && local ${HOME} /usr/bin export
+done ${HOME} sed sed x=1 cd readonly sed test grep x=1 'quoted text'
+2>/dev/null "$@" local "$1" | && /usr/bin then readonly
+		"$@" | /usr/bin $(pwd) grep sed local sed | export printf echo
+echo 2>/dev/null export
+	&& --verbose done /usr/bin -eu done |
+	local export "$1" cd grep ${HOME} readonly |
+2>/dev/null export readonly $(pwd) awk grep
+		'quoted text' awk awk grep grep -eu grep x=1 grep
+${HOME} sed x=1 grep awk local --verbose
+test x=1 x=1 | "$@" 'quoted text' x=1 sed sed done done x=1 ${HOME} x=1
+	cd export && grep 'quoted text'
+		${HOME} test --verbose
+cd printf readonly -eu echo then | echo ${HOME}
+		2>/dev/null && local readonly x=1 'quoted text'
+"$@" ${HOME} local 2>/dev/null export 'quoted text' -eu cd 2>/dev/null
+	readonly cd echo echo test ${HOME} sed --verbose grep 2>/dev/null done && /usr/bin
+"$@" 2>/dev/null grep -eu printf $(pwd) export x=1 grep grep
+	echo done 2>/dev/null "$1" then
+	test /usr/bin cd /usr/bin --verbose
+test then -eu --verbose | export "$1" printf local -eu /usr/bin
+	sed export local cd then ${HOME} sed 'quoted text' cd ${HOME} test "$@"
+export 'quoted text' | "$1" sed grep "$1" 2>/dev/null 'quoted text'
+		done local local grep test export
+	test readonly x=1 export "$@" --verbose
+	'quoted text' $(pwd) x=1 awk | "$1" "$1" && && x=1 -eu printf local
+| readonly /usr/bin /usr/bin cd x=1 x=1 export awk "$1"
+"$@" 'quoted text' /usr/bin --verbose ${HOME}
+	$(pwd) cd readonly | $(pwd) $(pwd) sed printf cd local
+printf then x=1 | "$@" test /usr/bin
+		export --verbose && "$@" test echo test readonly echo 'quoted text'
+	printf x=1 echo "$@" export printf /usr/bin
+	readonly printf && "$1" awk echo && local x=1 /usr/bin sed /usr/bin awk awk --verbose
+	sed then printf /usr/bin "$@" -eu | --verbose | sed test 2>/dev/null
+		cd "$1" awk $(pwd) 'quoted text'
+then -eu echo && local done $(pwd)
+		export $(pwd) awk 2>/dev/null
+	-eu echo local $(pwd) && x=1 'quoted text' x=1 && ${HOME} $(pwd) readonly
+sed sed /usr/bin echo grep "$1" cd 2>/dev/null test readonly | sed grep local
+x=1 && /usr/bin printf $(pwd)
+	export readonly export local x=1 test && awk x=1 printf
+awk sed /usr/bin readonly
+	"$1" readonly 2>/dev/null done && "$@" $(pwd)
+/usr/bin $(pwd) /usr/bin then export $(pwd) echo grep -eu | x=1 "$@" readonly
+		2>/dev/null printf local local x=1 awk
+| "$@" --verbose done export /usr/bin
+	grep echo x=1 | | echo grep printf grep ${HOME} grep grep
+	done -eu awk ${HOME} local
+	local -eu cd test -eu && test /usr/bin
+/usr/bin grep echo "$@" x=1 && export cd /usr/bin
+readonly /usr/bin readonly | done
+	echo local --verbose /usr/bin sed 'quoted text' 2>/dev/null
+test test printf | "$@" grep done printf
+&& 2>/dev/null 2>/dev/null sed /usr/bin 2>/dev/null
+		local printf grep -eu grep export -eu local
+	&& awk test printf test then -eu
+		${HOME} awk awk | -eu 2>/dev/null
+		'quoted text' /usr/bin readonly "$@" $(pwd) && awk
+awk sed 2>/dev/null "$1" /usr/bin done printf grep $(pwd) echo
+"$1" | 2>/dev/null printf test && 'quoted text' ${HOME} 2>/dev/null ${HOME} done
+	awk export awk && -eu echo /usr/bin test export cd --verbose
+		awk echo ${HOME} -eu done printf 'quoted text' then readonly awk readonly
+	x=1 printf echo export echo local --verbose
+		'quoted text' /usr/bin && | cd -eu ${HOME} readonly
+	$(pwd) --verbose x=1 awk $(pwd) $(pwd) --verbose cd echo
+	| ${HOME} /usr/bin "$1" 'quoted text'
+		grep | grep export /usr/bin cd x=1 test -eu grep sed
+	local 2>/dev/null test sed sed sed 2>/dev/null echo readonly sed test local
+	'quoted text' readonly test -eu
+	x=1 echo 2>/dev/null grep 2>/dev/null
+	"$@" export then grep --verbose
+		sed "$@" grep x=1 local done $(pwd) done "$1" "$@"
+		/usr/bin local cd 'quoted text' -eu
+done x=1 ${HOME} sed
+		x=1 export 'quoted text'
+	"$@" awk readonly printf 2>/dev/null echo awk
+	x=1 | awk ${HOME} "$1" | | && awk && printf 'quoted text' local $(pwd)
+	2>/dev/null done "$@" 'quoted text' test "$1" ${HOME} done --verbose
+awk readonly export $(pwd) --verbose && -eu "$1" --verbose | x=1 ${HOME}
+&& then && export cd | -eu 'quoted text'
+		done cd awk grep grep --verbose awk echo readonly /usr/bin "$@"
+	readonly then -eu | "$@" "$@" && echo local sed sed "$@" /usr/bin
+		"$@" --verbose then local readonly then export
+-eu local local done awk echo --verbose done grep readonly 2>/dev/null
+	readonly test $(pwd) 'quoted text'
+	sed echo test echo awk
+		export done /usr/bin "$@" printf "$1" local
+		then printf local $(pwd) sed
+		x=1 "$@" sed grep readonly --verbose awk /usr/bin export -eu 'quoted text'
+	--verbose "$1" test -eu --verbose && test then export "$@" then
+$(pwd) done 'quoted text' grep echo
+		2>/dev/null 2>/dev/null then done cd "$1"
+--verbose | -eu $(pwd) done export 2>/dev/null
+	printf sed -eu /usr/bin grep grep awk
+local done awk export printf 2>/dev/null local 'quoted text'
+		$(pwd) readonly ${HOME} "$1" local $(pwd)
+	printf awk "$1" done -eu 'quoted text' printf local
+/usr/bin --verbose 'quoted text' ${HOME}
+		done "$@" $(pwd) grep export ${HOME}
+		$(pwd) test "$1" x=1 test sed awk sed readonly
+	cd printf readonly export cd $(pwd)
+		awk test x=1 2>/dev/null 2>/dev/null sed | ${HOME}
+	cd grep --verbose cd x=1 && echo awk 'quoted text'
+-eu "$@" | 2>/dev/null readonly done "$1" export /usr/bin printf test then --verbose
+		readonly | x=1 'quoted text' readonly "$1" 'quoted text' && $(pwd) cd "$1"
+	sed sed local --verbose done &&
+2>/dev/null && ${HOME} 2>/dev/null readonly local awk /usr/bin then | grep grep
+| 'quoted text' test local --verbose --verbose echo "$@"
+		${HOME} 'quoted text' "$1" done done done cd done /usr/bin
+readonly "$@" echo ${HOME} readonly | $(pwd) $(pwd) "$1" echo then
+	2>/dev/null cd 2>/dev/null printf sed test local /usr/bin /usr/bin | /usr/bin
+	cd "$1" awk readonly grep $(pwd) sed export 2>/dev/null 2>/dev/null
+cd $(pwd) /usr/bin printf x=1 export done grep cd $(pwd)
+	x=1 "$1" echo && | --verbose local "$@" | 2>/dev/null sed
+	grep then local sed cd 2>/dev/null
+		grep done 'quoted text' 2>/dev/null --verbose then cd 2>/dev/null done "$1"
+awk --verbose grep grep -eu printf /usr/bin
+printf -eu 'quoted text' done --verbose printf -eu /usr/bin readonly
+	cd printf test test awk /usr/bin "$1" sed echo x=1 then && | x=1
+		'quoted text' awk | sed "$@" local done
+	echo export && awk -eu cd readonly /usr/bin sed | grep printf 2>/dev/null
+	/usr/bin | "$@" -eu x=1 && $(pwd) /usr/bin
+		| awk printf export echo x=1 echo cd "$1" sed awk export local /usr/bin test
+export printf -eu test export awk readonly local 'quoted text'
+		--verbose echo "$@" | | done /usr/bin "$1"
+/usr/bin export "$@" then "$1" ${HOME} done
+		awk grep echo printf x=1 -eu 'quoted text' then
+	local && && done ${HOME} sed | local 'quoted text'
+then --verbose | 'quoted text'
+| -eu "$1" --verbose -eu done sed grep
+	done cd test done && -eu -eu 2>/dev/null sed printf then 'quoted text'
+	then 'quoted text' /usr/bin 'quoted text' awk x=1 then "$@" readonly
+		&& $(pwd) ${HOME} /usr/bin
+then export readonly done x=1 done local local "$@" then 2>/dev/null
+readonly "$1" sed | ${HOME} 2>/dev/null
+	echo --verbose "$1" done x=1 test done sed sed && export readonly 2>/dev/null
+	awk "$1" printf ${HOME} 2>/dev/null
+		'quoted text' $(pwd) | "$@"
+	/usr/bin x=1 awk awk sed -eu grep $(pwd)
+		export 'quoted text' echo printf
+		"$@" "$@" then test cd
+	--verbose x=1 2>/dev/null test 2>/dev/null
+/usr/bin cd | 2>/dev/null then -eu echo done /usr/bin local
+'quoted text' readonly test awk | grep sed cd readonly "$1"
+		2>/dev/null awk --verbose grep test x=1 awk | x=1 -eu
+	"$1" /usr/bin $(pwd) --verbose /usr/bin awk awk | --verbose
+	test done x=1 -eu export
+		&& /usr/bin --verbose local printf /usr/bin --verbose cd printf ${HOME} ${HOME}
+/usr/bin readonly $(pwd)
+&& printf $(pwd) | -eu x=1 $(pwd) readonly grep printf 'quoted text'
+		awk -eu done cd grep -eu --verbose
+	grep cd 2>/dev/null then
+		$(pwd) && sed $(pwd) "$@" then /usr/bin $(pwd) test sed cd printf
+	awk sed export awk "$1" printf readonly
+done echo done done && grep cd cd sed grep "$1" | /usr/bin echo sed --verbose
+		"$1" && echo /usr/bin done x=1 cd export ${HOME} /usr/bin 2>/dev/null
+		readonly $(pwd) && sed readonly &&
+		export echo done | printf readonly
+then awk then 2>/dev/null "$@" then done 2>/dev/null $(pwd) 'quoted text'
+		"$1" "$@" 'quoted text' sed grep ${HOME} grep done test --verbose
+		2>/dev/null 2>/dev/null x=1 export local then && "$1" 2>/dev/null
+/usr/bin | /usr/bin local 'quoted text' grep readonly test ${HOME} cd --verbose
+/usr/bin cd sed ${HOME} export done
+echo 'quoted text' echo local test && local /usr/bin printf done
+	"$@" 2>/dev/null ${HOME} /usr/bin $(pwd) | echo echo sed -eu echo | $(pwd)
+		cd | /usr/bin local "$@" done readonly printf then
+		-eu local $(pwd) 2>/dev/null local 'quoted text'
+readonly "$1" "$1" local ${HOME} echo 2>/dev/null ${HOME}
+grep readonly && export then 'quoted text' --verbose "$@" ${HOME}
+	| export ${HOME} "$@" 2>/dev/null test sed
+'quoted text' echo echo sed 'quoted text' $(pwd) local /usr/bin
+	$(pwd) echo x=1 done && --verbose
+		cd awk && x=1 x=1 awk awk sed ${HOME}
+	$(pwd) --verbose printf echo x=1 awk 'quoted text' && echo "$1"
+2>/dev/null test printf x=1 readonly x=1 echo then local readonly
+	echo local 2>/dev/null readonly "$1" && awk
+readonly echo done $(pwd)
+	'quoted text' "$1" ${HOME} done 2>/dev/null cd printf x=1
+${HOME} x=1 'quoted text' --verbose echo x=1 /usr/bin
+	-eu local "$1" grep "$@" "$1" printf
+	-eu && readonly -eu /usr/bin sed grep
+	${HOME} ${HOME} sed then done "$1" done | 2>/dev/null $(pwd)
+"$1" then cd local && echo ${HOME} 2>/dev/null
+	/usr/bin 2>/dev/null readonly printf "$@"
+	"$1" test -eu && x=1 cd export sed
+readonly -eu && /usr/bin done /usr/bin | then /usr/bin
+		echo done awk 2>/dev/null --verbose
+		&& echo printf $(pwd) 'quoted text' printf -eu done && readonly local $(pwd) 2>/dev/null
+		sed "$1" ${HOME} 2>/dev/null printf awk cd printf "$1" | readonly readonly
+	2>/dev/null printf "$@" x=1 --verbose
+		--verbose printf test 'quoted text' x=1 -eu ${HOME} export
+	readonly sed && echo && "$1" x=1 printf
+	'quoted text' "$1" readonly && x=1 /usr/bin readonly printf 2>/dev/null test
+2>/dev/null readonly "$1" "$1" export done
+	/usr/bin && awk 'quoted text' "$@" then
+echo test test "$1" local awk cd done
+	"$@" done x=1 -eu test
+"$@" 'quoted text' -eu printf awk then ${HOME}
+&& readonly cd test | "$1" x=1 sed x=1 readonly && echo
+	local x=1 export --verbose $(pwd) /usr/bin then 'quoted text'
+	| awk /usr/bin done "$1" awk grep test 'quoted text' &&
+		/usr/bin -eu 2>/dev/null readonly 'quoted text'
+x=1 awk 'quoted text' echo 2>/dev/null
+cd done sed /usr/bin sed sed sed /usr/bin cd grep awk $(pwd)
+		then -eu echo -eu "$1" readonly readonly | --verbose 'quoted text'
+	&& "$1" && sed -eu printf 2>/dev/null cd echo ${HOME} 2>/dev/null readonly local
+local 2>/dev/null readonly | && "$1"
+'quoted text' 'quoted text' x=1 done ${HOME}
+	&& printf export $(pwd) -eu --verbose readonly
+	| /usr/bin "$1" && printf
+	grep x=1 export sed test "$@" done "$@" && --verbose
+	2>/dev/null x=1 local $(pwd) test local "$1" "$1" | x=1 -eu
+	"$@" 2>/dev/null /usr/bin --verbose
+		awk echo done 'quoted text'
+		$(pwd) sed 'quoted text' && awk
+	grep "$@" printf 2>/dev/null | "$@" $(pwd) readonly --verbose -eu then readonly
+		then printf ${HOME} export printf cd | test && ${HOME} "$@" test | readonly
+export /usr/bin /usr/bin test 'quoted text' sed readonly
+then test readonly readonly "$@" then 'quoted text'
+then x=1 "$1" done /usr/bin sed
+	-eu readonly test && /usr/bin |
+		local test 'quoted text' awk sed 'quoted text' "$1" awk /usr/bin
+| | x=1 printf cd --verbose done "$1" 'quoted text' -eu && "$1" && ${HOME} /usr/bin
+/usr/bin /usr/bin --verbose sed printf sed awk -eu && cd
+		"$@" awk "$1" readonly done "$1" printf 'quoted text' --verbose
+		2>/dev/null grep sed $(pwd) printf then 2>/dev/null echo $(pwd)
+	readonly x=1 $(pwd) -eu 2>/dev/null done && "$@" && /usr/bin done |
+		/usr/bin test export 2>/dev/null --verbose --verbose /usr/bin test test |
+		local done sed echo "$1" then $(pwd)
+test $(pwd) | printf grep
+		&& "$@" "$1" test export printf grep && printf /usr/bin "$1" local &&
+		/usr/bin readonly export 'quoted text' 2>/dev/null
+test 2>/dev/null done /usr/bin
+	${HOME} export sed sed x=1 grep /usr/bin test --verbose $(pwd) readonly export local
+		'quoted text' readonly test local /usr/bin local then --verbose
+	2>/dev/null printf 2>/dev/null 'quoted text' local 2>/dev/null -eu 2>/dev/null
+		2>/dev/null 'quoted text' test export "$1" printf -eu --verbose readonly
+	awk done printf echo sed local sed awk test
+then then && done local awk /usr/bin
+&& 2>/dev/null x=1 grep then test /usr/bin && sed $(pwd) | ${HOME}
+$(pwd) export readonly echo /usr/bin printf ${HOME} $(pwd) &&
+	"$@" local $(pwd) readonly | local export then && ${HOME} cd then
+	-eu then done 2>/dev/null /usr/bin done
+| readonly "$@" done "$@" "$1" x=1 "$1" -eu printf
+		printf grep 2>/dev/null then "$@" done $(pwd) sed readonly 'quoted text'
+	| awk grep --verbose sed && sed /usr/bin
+		2>/dev/null echo --verbose --verbose "$1" ${HOME} printf "$@" echo 2>/dev/null
+		then export cd export
+&& test $(pwd) 'quoted text' -eu "$@" $(pwd) local grep && 2>/dev/null readonly
+	test test echo awk "$1" 2>/dev/null local | &&
+		then printf /usr/bin echo $(pwd) printf echo readonly /usr/bin
+		then awk done | export 'quoted text' done local
+		"$1" awk --verbose 'quoted text' 'quoted text' awk $(pwd) 'quoted text'
+		"$@" export 2>/dev/null export $(pwd) 2>/dev/null test readonly
+readonly done test 2>/dev/null cd
+		--verbose done then $(pwd) --verbose sed 'quoted text'
+'quoted text' export /usr/bin awk sed ${HOME} awk /usr/bin
+		grep "$1" cd x=1 grep printf
+	local local $(pwd) "$1" test
+	cd 'quoted text' test grep x=1 'quoted text' sed sed 2>/dev/null
+	local export 'quoted text' x=1
+	&& --verbose awk -eu echo readonly readonly ${HOME} readonly -eu readonly 'quoted text'
+	grep then awk test then then done 2>/dev/null
+"$@" /usr/bin test grep && awk echo /usr/bin 'quoted text' "$1"
+		awk x=1 "$1" sed echo echo awk "$1" awk 2>/dev/null /usr/bin
+	cd local /usr/bin 'quoted text'
+		$(pwd) then -eu echo "$@" cd
+	awk cd 2>/dev/null "$@" x=1 x=1
+	then printf grep grep "$@" /usr/bin "$1" $(pwd) x=1 "$1" ${HOME} cd done
+test && echo awk 2>/dev/null "$1" test grep export /usr/bin "$@" then /usr/bin
+echo | readonly | done
+		"$1" -eu then $(pwd) echo x=1 2>/dev/null done echo -eu local awk echo printf
+		export | echo && | 2>/dev/null ${HOME} | /usr/bin /usr/bin export readonly grep
+	/usr/bin ${HOME} awk export /usr/bin |
+export --verbose ${HOME} && | test "$@" export -eu readonly
+		readonly export local /usr/bin awk &&
+		${HOME} readonly | -eu "$1" 'quoted text' -eu cd export ${HOME} 2>/dev/null /usr/bin
+$(pwd) "$1" test awk x=1 local | done "$@" readonly sed --verbose --verbose local
+		&& 2>/dev/null -eu 2>/dev/null -eu x=1 "$1" && printf -eu
+local printf 2>/dev/null echo echo export export cd x=1 --verbose then
+		sed done -eu /usr/bin
+	| export 2>/dev/null ${HOME} then x=1 -eu "$1" "$1" test export cd awk ${HOME}
+		2>/dev/null -eu 2>/dev/null local
+		sed | grep sed cd $(pwd) cd then "$@" 2>/dev/null 2>/dev/null
+		${HOME} then export -eu readonly grep ${HOME} x=1
+	awk echo -eu readonly awk then sed printf "$@" ${HOME} then export printf then
+x=1 -eu test -eu test local "$@" 2>/dev/null -eu -eu "$@" cd && grep "$@" then "$1"
+	'quoted text' echo /usr/bin ${HOME}
+		local awk sed sed grep ${HOME} $(pwd) "$1" | readonly
+x=1 x=1 2>/dev/null echo /usr/bin echo done x=1 grep ${HOME} awk
+	| done test printf && grep local
+sed done $(pwd) $(pwd) cd "$1" 'quoted text' done 2>/dev/null /usr/bin awk local
+		then local printf test test echo 2>/dev/null
+awk export awk done test printf cd
+	local local grep done ${HOME}
+	"$@" cd $(pwd) grep sed "$1" printf /usr/bin readonly awk echo done
+	test then 2>/dev/null readonly sed
+		then x=1 then 'quoted text' | "$1"
+echo test x=1 printf export x=1 && $(pwd) readonly
+		readonly export sed then x=1 test "$1" grep cd /usr/bin x=1 2>/dev/null
+grep done --verbose --verbose
+		sed ${HOME} local local grep ${HOME} local sed "$@" test sed test -eu | | printf
+	printf export 2>/dev/null grep export && test done export ${HOME}
+		echo x=1 --verbose printf 2>/dev/null
+		"$1" then sed --verbose
+		then printf grep then grep --verbose sed 2>/dev/null
+	readonly | readonly printf /usr/bin export
+		"$@" /usr/bin "$@" printf --verbose export
+readonly cd grep -eu echo
+	export 2>/dev/null && cd done --verbose
+		| local sed | done && 2>/dev/null printf --verbose test "$@" 'quoted text'
+		/usr/bin awk export $(pwd) test grep readonly done ${HOME} x=1
+	$(pwd) export ${HOME} local test
+	--verbose done "$1" 'quoted text' /usr/bin awk done export readonly -eu -eu
+		"$@" test ${HOME} "$1" $(pwd) /usr/bin
+grep grep readonly echo export && grep done --verbose printf "$1"
+	| then "$@" ${HOME} done ${HOME} sed cd sed --verbose -eu
+	'quoted text' $(pwd) | ${HOME} 2>/dev/null cd | awk awk 'quoted text'
+		sed -eu awk "$@" grep readonly local done echo
+		${HOME} "$1" ${HOME} test -eu
+local "$1" printf && grep && /usr/bin && -eu "$@" /usr/bin readonly x=1 awk
+	grep ${HOME} x=1 grep --verbose sed ${HOME} 'quoted text' readonly 2>/dev/null
+	test "$1" ${HOME} sed "$@" "$1" export /usr/bin
+	readonly --verbose readonly sed grep 2>/dev/null -eu test | readonly "$1" cd "$1"
+awk test | /usr/bin sed done test awk $(pwd) && readonly 'quoted text'
+	/usr/bin -eu 2>/dev/null "$@"
+| "$@" /usr/bin $(pwd) | cd export local
+		'quoted text' "$@" test grep local && x=1 awk export export && printf x=1 export
+cd echo -eu -eu "$@" done ${HOME} $(pwd)
+		then ${HOME} x=1 | 'quoted text' grep sed readonly
+	printf x=1 && echo test 2>/dev/null "$@" |
+	test done --verbose test local /usr/bin -eu x=1 local awk local "$@" -eu $(pwd)
+		printf export local /usr/bin -eu
+		2>/dev/null cd echo | $(pwd) readonly sed
+$(pwd) ${HOME} local grep
+	readonly x=1 awk sed 2>/dev/null done /usr/bin done | export
+		sed 'quoted text' export 2>/dev/null printf && awk /usr/bin /usr/bin test
+local | 'quoted text' local export grep | then ${HOME}
+		export done ${HOME} then -eu grep grep
+$(pwd) "$@" | $(pwd) "$@" "$@"
+echo readonly done local | -eu done -eu | $(pwd) then export
+	2>/dev/null done local readonly then $(pwd) export
+		$(pwd) then export awk done local
+	sed /usr/bin echo awk echo readonly $(pwd) $(pwd) /usr/bin printf $(pwd)
+	local --verbose --verbose | x=1 sed export && awk printf 2>/dev/null printf
+	| "$@" cd grep then sed /usr/bin "$@" test --verbose && test then && grep
+	test cd $(pwd) 'quoted text' "$1" export
+grep | | && "$@" 'quoted text' -eu done test
+	| cd local then ${HOME} ${HOME}
+test cd ${HOME} awk printf local x=1 2>/dev/null echo &&
+		"$1" x=1 'quoted text' printf |
+	grep awk readonly readonly
+	export && test && x=1 export /usr/bin cd export
+		printf ${HOME} -eu grep done -eu --verbose done x=1 readonly | "$1" grep
+	2>/dev/null --verbose printf $(pwd)
+	2>/dev/null --verbose echo
+test grep "$@" test local &&
+	printf then local -eu --verbose ${HOME} "$1"
+	export grep grep x=1 "$@" ${HOME} awk && "$1" awk echo readonly then then local
+	2>/dev/null done /usr/bin x=1 sed | sed | test
+/usr/bin ${HOME} cd | x=1 $(pwd) "$1" sed readonly $(pwd) awk "$@"
+		grep local 2>/dev/null then /usr/bin test grep printf grep grep grep $(pwd)
+		test sed test done local export cd export | --verbose $(pwd) done sed
+'quoted text' "$@" && && /usr/bin local /usr/bin
+		2>/dev/null | /usr/bin cd test export
+2>/dev/null "$1" --verbose
+2>/dev/null local local local test test "$1" then "$1" ${HOME} grep
+readonly sed 2>/dev/null echo readonly -eu x=1 done then local x=1 | then
+		awk && then /usr/bin -eu local $(pwd)
+awk awk 'quoted text' x=1 /usr/bin readonly "$@" /usr/bin
+${HOME} && sed done 'quoted text' 'quoted text' awk "$@" 2>/dev/null
+		readonly grep test 'quoted text' -eu "$1" "$@" x=1 grep done
+		local readonly 'quoted text' echo echo x=1 2>/dev/null test export
+	"$1" --verbose test printf -eu export printf done -eu
+-eu readonly test awk then ${HOME} readonly cd printf && 'quoted text'
+echo $(pwd) export "$1" --verbose 2>/dev/null "$1" printf
+		"$1" sed done awk then then readonly
+"$1" | then x=1 local readonly $(pwd) "$@" test /usr/bin -eu then grep readonly
+	export x=1 grep cd local done | awk /usr/bin ${HOME} echo $(pwd) -eu export
+${HOME} x=1 then test then done readonly
+&& local x=1 | local x=1 &&
+&& sed local sed export
+| /usr/bin printf readonly x=1 readonly echo
+	export then echo 2>/dev/null && "$@" export test "$@" && test local cd readonly
+local "$1" ${HOME} then ${HOME} 2>/dev/null
+	-eu --verbose then | grep sed && "$@"
+		| | $(pwd) grep test sed cd echo /usr/bin 2>/dev/null export test ${HOME} grep
+printf local 2>/dev/null 2>/dev/null then readonly
+	cd done && local && test $(pwd) -eu "$1"
+		sed 2>/dev/null done echo /usr/bin then $(pwd) awk && "$@" sed $(pwd) "$1" -eu
+		x=1 -eu -eu | printf echo "$@" sed local ${HOME}
+	test done sed echo export then | sed done --verbose cd local x=1 --verbose
+	x=1 sed readonly "$@" readonly cd done printf && local
+echo /usr/bin export 'quoted text' $(pwd) -eu
+	$(pwd) done && done echo 'quoted text'
+		'quoted text' /usr/bin "$@" ${HOME} awk
+'quoted text' done readonly done | export "$1" then echo sed awk awk && -eu 2>/dev/null
+| cd 'quoted text' ${HOME} echo then awk printf
+x=1 'quoted text' "$1" grep x=1 awk export --verbose cd ${HOME} x=1 sed export
+	echo "$1" sed 'quoted text' sed --verbose 'quoted text'
+sed cd printf $(pwd) printf
+x=1 printf awk $(pwd) "$1" test export
+2>/dev/null test "$1" "$@" x=1
+	export local export sed "$1" $(pwd) 'quoted text'
+		x=1 echo 'quoted text' grep $(pwd)
+	printf -eu && done | export done | $(pwd) | test printf sed 2>/dev/null sed
+		$(pwd) cd readonly then $(pwd) -eu readonly local --verbose
+| then 2>/dev/null awk local grep /usr/bin -eu
+		"$@" test 'quoted text' echo --verbose
+		&& export "$1" /usr/bin
+		"$@" echo --verbose readonly printf export local "$@" cd readonly --verbose
+	grep | "$@" grep cd done && ${HOME} done local
+	export printf sed echo cd 2>/dev/null /usr/bin ${HOME} "$@" then
+		local awk --verbose awk local export "$1" printf grep
+	&& "$@" echo /usr/bin cd ${HOME}
+		| ${HOME} awk x=1 -eu 2>/dev/null --verbose
+	sed /usr/bin readonly done --verbose local local x=1 x=1 "$@" ${HOME} "$1"
+		cd $(pwd) test export grep grep export
+	grep awk 'quoted text' /usr/bin readonly /usr/bin cd echo done 'quoted text'
+/usr/bin export awk grep cd sed cd $(pwd)
+	/usr/bin test test "$@" printf export then && 2>/dev/null export 'quoted text'
+	$(pwd) --verbose grep --verbose then
+-eu sed ${HOME} | printf && -eu "$1" local "$1" --verbose export
+	--verbose then /usr/bin --verbose then then $(pwd) grep readonly
+		sed ${HOME} 2>/dev/null sed $(pwd) export
+		readonly --verbose awk printf -eu readonly done /usr/bin
+		"$1" x=1 $(pwd) 'quoted text' done grep && "$@" cd cd export x=1 export
+	echo "$1" -eu | echo cd --verbose
+then 'quoted text' 'quoted text' --verbose
+	"$1" echo grep readonly then
+	/usr/bin done -eu -eu test && readonly 2>/dev/null ${HOME} ${HOME} sed
+	/usr/bin /usr/bin grep local export 2>/dev/null then -eu export -eu printf "$@"
+--verbose --verbose /usr/bin "$@" sed 'quoted text' test printf
+		&& ${HOME} --verbose --verbose grep readonly $(pwd) 2>/dev/null
+		done test 'quoted text' && && -eu echo /usr/bin 'quoted text' readonly
+printf $(pwd) local sed local
+	local /usr/bin test x=1 sed export 'quoted text' 'quoted text'
+	readonly /usr/bin grep cd "$@" --verbose then | local echo 'quoted text'
+	echo --verbose --verbose /usr/bin
+		/usr/bin | -eu echo printf export x=1 cd --verbose
+&& 'quoted text' -eu | done readonly cd 'quoted text' echo cd "$1" export
+	x=1 echo x=1 && 2>/dev/null echo | | readonly then printf readonly
+		done local 'quoted text' | readonly
+awk then done x=1 "$@"
+done /usr/bin local echo
+	x=1 ${HOME} test x=1 2>/dev/null
+done echo local $(pwd) x=1 printf then
+		-eu x=1 done sed | echo && awk x=1 sed | cd sed /usr/bin then test grep done
+		local -eu --verbose export
+'quoted text' -eu && ${HOME} x=1 sed "$1" done 2>/dev/null then x=1 $(pwd)
+--verbose --verbose then ${HOME}
+"$1" readonly cd && 'quoted text' grep --verbose -eu grep
+	readonly "$1" x=1 x=1 awk then then
+	cd echo grep ${HOME} local echo ${HOME} grep "$@"
+	echo "$1" sed 'quoted text'
+printf "$1" ${HOME} echo test /usr/bin | && test 2>/dev/null | echo x=1 --verbose
+		test echo 'quoted text' "$1"
+		readonly 2>/dev/null x=1 -eu ${HOME} 'quoted text'
+&& && --verbose --verbose "$@" | cd awk -eu "$@" "$1" "$1" --verbose | 2>/dev/null
+	readonly sed awk test /usr/bin done $(pwd) -eu echo
+	${HOME} local ${HOME} grep grep local readonly 'quoted text' $(pwd)
+		sed "$1" readonly test --verbose /usr/bin
+&& done --verbose "$1"
+	x=1 done "$1" cd readonly "$1" local 'quoted text' awk readonly
+		$(pwd) grep && echo $(pwd) $(pwd) && echo cd done 'quoted text' sed printf
+local then sed /usr/bin awk sed | readonly awk
+then | /usr/bin x=1 done 2>/dev/null -eu done $(pwd) sed cd "$@" done /usr/bin
+		printf --verbose printf 2>/dev/null grep readonly 2>/dev/null 'quoted text'
+	"$@" --verbose cd 2>/dev/null $(pwd) echo --verbose printf 'quoted text'
+		then && awk export ${HOME} 'quoted text'
+		2>/dev/null /usr/bin $(pwd) sed cd | ${HOME} ${HOME}
+test test then $(pwd) test sed readonly && 2>/dev/null
+echo x=1 $(pwd) ${HOME} grep 2>/dev/null x=1 | --verbose 2>/dev/null
+2>/dev/null && cd | grep test -eu readonly "$1" grep
+		$(pwd) export local /usr/bin local
+x=1 /usr/bin readonly grep x=1 -eu $(pwd) sed cd | export cd echo $(pwd)
+		then done -eu local x=1 printf local && 2>/dev/null echo echo x=1 -eu "$1"
+	2>/dev/null ${HOME} readonly then cd sed readonly "$@" "$@" cd test --verbose
+	-eu "$@" ${HOME} && test && then test /usr/bin grep
+	echo export readonly export "$@" ${HOME} "$@" 'quoted text' cd ${HOME}
+		export && "$1" echo then /usr/bin awk done
+	$(pwd) "$1" readonly -eu | 'quoted text' | echo "$1" local local "$@" awk 2>/dev/null
+		x=1 grep awk awk 'quoted text' test done $(pwd)
+-eu then /usr/bin 2>/dev/null "$@" done sed -eu
+	$(pwd) /usr/bin $(pwd) grep "$1" cd && done | echo echo
+test grep && export --verbose export printf
+sed readonly x=1 export $(pwd) /usr/bin readonly --verbose $(pwd)
+printf 'quoted text' 2>/dev/null 2>/dev/null cd done $(pwd) && done done
+	--verbose && && /usr/bin cd
+	"$@" x=1 sed ${HOME} done | "$@" grep awk grep cd --verbose
+		"$@" local ${HOME} local "$@" awk grep -eu export printf
+		done -eu 'quoted text' $(pwd) export x=1 2>/dev/null
+		/usr/bin then "$1" 'quoted text'
+		test echo x=1 | -eu echo "$1"
+	'quoted text' ${HOME} awk -eu /usr/bin printf sed readonly "$1" test "$@" local
+		$(pwd) && printf 'quoted text'
+$(pwd) export 'quoted text' then
+		"$1" && && ${HOME} readonly then test ${HOME} done && echo local grep "$1"
+awk awk && done test --verbose x=1 x=1 readonly done readonly --verbose
+	&& then --verbose "$@" done
+		&& local 2>/dev/null echo && /usr/bin | awk
+		echo awk ${HOME} done $(pwd) -eu | printf grep |
+		test "$@" awk printf readonly grep $(pwd) /usr/bin printf cd cd | 2>/dev/null
+	cd | awk ${HOME} "$@" | export --verbose -eu grep grep /usr/bin awk printf awk
+		&& x=1 grep printf cd done "$@" 'quoted text' 2>/dev/null
+x=1 done | 2>/dev/null
+"$@" test -eu awk --verbose echo /usr/bin
+	test readonly x=1 ${HOME} /usr/bin grep "$@" export
+	2>/dev/null export |
+test ${HOME} && "$@" && "$@" echo cd /usr/bin "$1" --verbose awk -eu test sed
+		export echo sed then /usr/bin && cd awk ${HOME} test ${HOME} /usr/bin printf
+echo 2>/dev/null sed grep "$1" awk
+		awk readonly $(pwd) test /usr/bin /usr/bin --verbose
+then then then | export readonly
+	local grep cd /usr/bin "$@" "$@" grep 2>/dev/null "$@" $(pwd)
+		printf --verbose 'quoted text' && "$1"
+grep grep | printf export /usr/bin echo
+	/usr/bin /usr/bin 'quoted text' ${HOME} 'quoted text' && local test awk
+2>/dev/null export then --verbose export then -eu readonly awk grep grep
+	| grep test x=1 'quoted text' /usr/bin
+	$(pwd) | && $(pwd) done echo sed cd echo sed test test awk
+	$(pwd) x=1 echo | readonly x=1 export
+	-eu -eu cd /usr/bin -eu "$@"
+	test awk awk done printf 2>/dev/null --verbose done grep 2>/dev/null $(pwd)
+	sed x=1 export echo -eu "$@"
+		-eu readonly echo ${HOME} /usr/bin export echo 'quoted text' /usr/bin done -eu --verbose
+readonly /usr/bin done awk sed x=1
+		| export && "$@" cd && /usr/bin sed x=1 printf 'quoted text' "$@"
+-eu | printf 2>/dev/null cd
+	"$1" cd "$@" "$@" export awk /usr/bin printf "$@" -eu x=1 test | export "$1"
+	echo -eu $(pwd) ${HOME} --verbose
+then "$1" | --verbose -eu awk &&
+	x=1 && /usr/bin printf && grep done x=1 local export $(pwd) /usr/bin --verbose
+		export -eu printf | 2>/dev/null export 'quoted text' && sed && --verbose
+	"$@" sed awk echo done 'quoted text' awk test "$1" grep
+	then "$@" $(pwd) --verbose 'quoted text' cd grep --verbose awk echo x=1 /usr/bin
+	sed x=1 "$1" local then grep done cd printf test printf readonly then printf test
+awk awk export awk ${HOME} /usr/bin awk export sed ${HOME} readonly
+$(pwd) readonly | echo --verbose grep done "$1"
+	sed x=1 printf /usr/bin /usr/bin
+	"$1" x=1 awk 2>/dev/null grep awk
+		sed | x=1 awk /usr/bin -eu awk
+	2>/dev/null x=1 "$1" export readonly readonly
+	$(pwd) awk sed $(pwd) | then local readonly /usr/bin readonly sed export /usr/bin
+		done | then 'quoted text'
+${HOME} && | | x=1 --verbose "$1" /usr/bin grep printf then cd --verbose
+	sed awk x=1 2>/dev/null | local echo /usr/bin
+	/usr/bin echo cd -eu "$@" | && 'quoted text' x=1 local 'quoted text' local
+		&& cd test "$1" --verbose
+	awk then readonly --verbose sed awk "$1" 'quoted text' x=1 | readonly "$@" /usr/bin
+awk "$@" readonly done | sed awk -eu --verbose "$1" x=1 cd done
+echo "$1" export 2>/dev/null $(pwd) grep export
+	2>/dev/null then cd 2>/dev/null
+		grep awk test "$1" cd awk "$@" x=1 local /usr/bin | grep "$1" then
+	awk done awk | | 'quoted text' -eu test sed 2>/dev/null awk "$@"
+readonly 'quoted text'
+echo /usr/bin awk --verbose cd export /usr/bin x=1 "$1" grep
+	--verbose x=1 2>/dev/null local export ${HOME} "$1" done "$1"
+${HOME} "$@" -eu then test -eu --verbose sed test export printf grep echo done |
+		export ${HOME} export local "$1" 'quoted text' "$1"
+		'quoted text' x=1 done x=1 2>/dev/null echo grep local
+-eu readonly x=1 -eu printf
+$(pwd) -eu ${HOME} | && && | sed grep /usr/bin grep export "$@"
+-eu printf $(pwd) --verbose
+		done $(pwd) test && $(pwd) /usr/bin 2>/dev/null
+-eu 2>/dev/null "$1" test cd x=1 "$@" cd readonly then | awk 'quoted text' 2>/dev/null
+$(pwd) local --verbose && local --verbose
+		sed ${HOME} grep local $(pwd) cd then "$@" "$1" && "$@" grep ${HOME}
+		echo --verbose && awk
+	grep printf awk x=1 test then
+		$(pwd) ${HOME} ${HOME} echo /usr/bin
+readonly echo done x=1 "$@" echo test echo ${HOME} 2>/dev/null
+echo readonly echo readonly 'quoted text' echo sed grep
+		readonly test ${HOME} -eu -eu
+	export && export grep then "$1" "$@" readonly grep grep grep cd -eu test
+printf --verbose ${HOME} test /usr/bin /usr/bin cd grep
+		awk cd ${HOME} "$@" cd grep
+		2>/dev/null 'quoted text' x=1 &&
+printf export awk then cd --verbose | awk grep "$@" x=1
+		-eu ${HOME} grep --verbose echo
+	done && then sed readonly echo /usr/bin "$@" 2>/dev/null
+| then local x=1 awk "$1" echo "$@" grep grep "$@"
+		"$1" "$1" -eu x=1 /usr/bin then /usr/bin done echo
+	done --verbose -eu cd | test readonly -eu "$1" "$@" x=1
+	&& x=1 "$@" echo cd 2>/dev/null sed echo /usr/bin | && grep /usr/bin grep printf
+		test 2>/dev/null "$@" x=1 | printf sed --verbose | --verbose grep | 'quoted text'
+		"$@" test 2>/dev/null /usr/bin $(pwd)
+--verbose sed -eu readonly
+	-eu cd $(pwd) "$1" 2>/dev/null
+export cd /usr/bin test
+export 2>/dev/null "$@" export then
+readonly -eu then 'quoted text'
+export /usr/bin test $(pwd) $(pwd) x=1 then 'quoted text' sed
+	cd ${HOME} $(pwd) local sed cd grep -eu 2>/dev/null
+done readonly export then --verbose grep grep done cd then readonly local
+	&& /usr/bin local --verbose x=1 printf -eu 2>/dev/null readonly
+		x=1 done test sed sed awk export
+awk 'quoted text' "$1" export
+${HOME} /usr/bin test cd cd 'quoted text'
+&& && | readonly done -eu echo export "$@" awk $(pwd) 2>/dev/null
+| ${HOME} ${HOME} "$@" sed "$@"
+readonly readonly cd printf && done export echo
+	readonly sed local then printf grep sed sed then
+2>/dev/null --verbose && readonly grep 2>/dev/null
+		awk ${HOME} $(pwd) sed then echo ${HOME} 'quoted text'
+"$1" "$@" ${HOME} grep local | 2>/dev/null
+		readonly done --verbose "$1" && printf cd -eu ${HOME} test -eu done "$1" "$1"
+	"$@" | -eu --verbose "$1" -eu -eu $(pwd)
+sed ${HOME} "$@" then readonly test | "$1" $(pwd) export
+test cd local -eu 2>/dev/null x=1 "$1" export
+		2>/dev/null "$@" done x=1 test && printf local x=1 "$1" awk then
+		"$@" 2>/dev/null "$@" grep cd awk then cd echo then sed then done
+		"$@" local grep --verbose sed | export readonly export printf
+	| test x=1 --verbose -eu ${HOME}
+	| 'quoted text' then "$@"
+done | --verbose && -eu && -eu
+	awk done && && $(pwd) $(pwd)
+awk then "$@" test test grep printf test
+		grep awk 'quoted text' export awk sed echo grep
+	echo done /usr/bin $(pwd) test readonly 2>/dev/null /usr/bin
+		grep local test ${HOME} awk "$@" cd local "$1" | ${HOME} -eu 'quoted text'
+	${HOME} test done echo 'quoted text' printf export awk "$1" then
+| 'quoted text' readonly cd 'quoted text' x=1
+		&& grep cd ${HOME} | local
+	&& /usr/bin done x=1 done grep test printf test
+	'quoted text' export grep /usr/bin "$1" "$1" sed done
+${HOME} --verbose && ${HOME} | 2>/dev/null $(pwd) local
+readonly test readonly printf local
+		readonly printf $(pwd) sed echo echo local "$1" 'quoted text' awk
+		"$@" --verbose cd "$@" "$1" 'quoted text' /usr/bin -eu --verbose
+		awk "$@" "$@" | echo ${HOME} sed --verbose 2>/dev/null "$1"
+| 2>/dev/null local sed sed export grep
+x=1 awk "$1" printf done awk /usr/bin -eu awk cd export
+then ${HOME} awk "$@" echo | $(pwd) | awk cd awk printf | 2>/dev/null "$1" "$1"
+2>/dev/null done readonly $(pwd) readonly && printf /usr/bin local
+		"$1" cd grep then export ${HOME} printf printf 'quoted text'
+		$(pwd) "$1" sed /usr/bin echo test --verbose /usr/bin echo ${HOME}
+		echo ${HOME} local | cd && "$1" printf echo test "$1" | readonly
+then /usr/bin printf echo -eu done echo export -eu -eu -eu awk grep then awk
+"$1" -eu awk grep readonly 'quoted text' -eu
+-eu -eu echo /usr/bin -eu "$1" sed | export x=1
+	awk export awk cd 'quoted text' then then | "$@" 'quoted text' local
+		| && "$1" | /usr/bin /usr/bin local
+2>/dev/null done $(pwd) then --verbose 2>/dev/null $(pwd) done
+echo "$1" $(pwd) -eu local $(pwd) -eu $(pwd) grep && local grep awk x=1 "$1" then
+		readonly x=1 ${HOME} --verbose && awk export echo
+	local awk sed cd "$@" -eu done done ${HOME} --verbose
+		done printf ${HOME} cd then local awk printf awk done 2>/dev/null echo done export
+export ${HOME} printf local done --verbose test
+	--verbose local then "$@" local then | grep export x=1 echo echo | done
+	&& readonly sed grep echo /usr/bin $(pwd) ${HOME}
+	cd echo 'quoted text' | x=1 readonly 2>/dev/null export /usr/bin
+'quoted text' echo readonly | "$1" "$1" grep printf 'quoted text'
+	test "$1" then -eu then awk printf sed local sed "$@" printf done awk
+		-eu test local 2>/dev/null 2>/dev/null printf cd done echo printf
+sed readonly export 'quoted text'
+		done export 2>/dev/null $(pwd)
+		| /usr/bin grep --verbose | x=1 "$1" printf x=1 --verbose
+		grep cd done awk x=1 then echo awk readonly export 2>/dev/null
+#include c157.sh
+	printf "$1" x=1 done done local ${HOME} readonly -eu
+${HOME} printf printf
+		${HOME} && -eu | awk /usr/bin -eu 'quoted text' && "$1" grep
+		| echo echo && test done local export --verbose && export local
+		&& | export x=1 readonly "$1" readonly done sed sed
+local x=1 x=1 "$@" "$@" export 'quoted text'
+| printf ${HOME} $(pwd) then sed x=1 sed test done -eu
+/usr/bin --verbose && awk x=1 done sed 2>/dev/null 'quoted text'
+readonly -eu done awk awk
+		"$@" "$@" local --verbose readonly grep
+	test export -eu && echo ${HOME} /usr/bin | readonly
+		"$@" $(pwd) ${HOME} x=1 local test then /usr/bin $(pwd) $(pwd) | && export
+		printf done ${HOME} 'quoted text'
+done 'quoted text' test then ${HOME}
+--verbose then 2>/dev/null sed local readonly echo
+		readonly then "$@" 'quoted text'
+		grep local x=1 export -eu local 'quoted text' cd --verbose export
+2>/dev/null $(pwd) printf local awk && readonly -eu -eu cd
+		export --verbose -eu sed echo cd
+then local export | ${HOME} $(pwd) sed && "$1" $(pwd)
+		$(pwd) /usr/bin export /usr/bin
+done 'quoted text' local then awk x=1 -eu test then x=1 --verbose 'quoted text'
+	awk echo "$@" /usr/bin 2>/dev/null 2>/dev/null cd | sed -eu
+		readonly readonly | sed echo local --verbose 2>/dev/null sed --verbose
+$(pwd) test x=1 cd x=1 "$1"
+/usr/bin 2>/dev/null 2>/dev/null then /usr/bin "$@" test | grep echo printf awk
+		awk $(pwd) readonly echo done printf
+&& sed echo test x=1 'quoted text' 'quoted text' x=1 $(pwd) grep local ${HOME}
+	--verbose -eu done printf printf echo
+	x=1 "$1" sed "$1" then test grep
+	--verbose "$@" test printf 'quoted text'
+		awk export sed -eu x=1 2>/dev/null
+	sed readonly "$1" grep --verbose "$@" test
+		then /usr/bin cd readonly | -eu then x=1 --verbose awk
+	done && export sed $(pwd) awk cd /usr/bin printf grep
+	printf readonly sed "$1" 2>/dev/null test awk done
+	--verbose $(pwd) 'quoted text' grep /usr/bin echo -eu ${HOME} done && grep local
+	"$@" --verbose | -eu "$1"
+	2>/dev/null 'quoted text' --verbose awk
+	then cd 2>/dev/null awk done then echo && --verbose -eu
+	2>/dev/null sed 'quoted text' done export echo
+--verbose -eu sed /usr/bin done -eu then /usr/bin readonly
+done awk echo --verbose
+&& x=1 x=1 'quoted text' 'quoted text' local
+test printf echo grep local "$@" local ${HOME} readonly sed echo
+| /usr/bin /usr/bin 'quoted text' cd 'quoted text' "$1" echo readonly --verbose
+		awk readonly grep -eu grep -eu cd ${HOME} && | "$@" export
+	echo test "$1" test && 2>/dev/null
+		export local /usr/bin local local test printf then /usr/bin
+	sed | cd 2>/dev/null -eu $(pwd) -eu cd $(pwd) 'quoted text' "$1" awk x=1
+	| ${HOME} 'quoted text' local $(pwd) | sed | ${HOME} "$@" export --verbose
+	readonly then --verbose
+then /usr/bin test -eu awk $(pwd) then sed | done sed -eu grep "$@"
+		2>/dev/null sed cd "$1" | printf /usr/bin cd -eu -eu ${HOME} && done
+--verbose then -eu printf && && ${HOME} cd | 2>/dev/null 'quoted text'
+printf ${HOME} 2>/dev/null
+	readonly /usr/bin cd
+		sed "$@" printf 'quoted text' printf readonly
+	grep 'quoted text' | test test echo -eu -eu export | 'quoted text'
+		${HOME} echo "$@" done awk "$1" | 2>/dev/null /usr/bin
+	local then --verbose echo cd echo local local then
+		cd "$1" $(pwd) sed local /usr/bin export "$@" "$1" 'quoted text'
+local printf then printf
+	then cd ${HOME} readonly x=1 ${HOME} then x=1 "$@" test then && echo
+		2>/dev/null 'quoted text' local -eu -eu -eu sed then x=1 &&
+$(pwd) export sed "$@" awk echo awk "$@"
+2>/dev/null local "$1" -eu --verbose x=1 printf
+readonly export echo ${HOME} sed $(pwd) --verbose "$@"
+	grep --verbose readonly -eu readonly export sed ${HOME}
+done done then test | && "$@"
+x=1 sed $(pwd) then ${HOME} cd /usr/bin $(pwd)
+		"$@" -eu echo /usr/bin done grep $(pwd) cd test
+		readonly /usr/bin | test --verbose --verbose test printf then printf
+| 'quoted text' $(pwd) echo awk echo cd awk x=1 -eu "$1" test 'quoted text'
+		then --verbose && test --verbose echo $(pwd)
+	awk export 2>/dev/null echo
+		x=1 | grep --verbose awk export readonly --verbose
+awk done 'quoted text' && --verbose
+	--verbose /usr/bin "$1" cd "$@" cd $(pwd) ${HOME} echo cd 'quoted text' printf
+	printf done "$@" printf && | then "$1" test grep /usr/bin done done
+grep readonly x=1 echo local test cd "$1" done /usr/bin done $(pwd)
+2>/dev/null done awk "$1" "$@" -eu echo
+		grep | && echo echo /usr/bin local x=1 ${HOME} -eu
+	local ${HOME} printf $(pwd)
+	readonly ${HOME} awk $(pwd) test /usr/bin done
+printf test printf export export --verbose x=1 sed --verbose $(pwd) export
+	"$@" 2>/dev/null export printf local /usr/bin test awk "$@" done "$1" printf
+	done && | test done then export 'quoted text'
+	/usr/bin && x=1 | /usr/bin
+printf ${HOME} grep 2>/dev/null awk x=1 then
+done cd then test --verbose /usr/bin | grep grep 2>/dev/null && $(pwd) grep
+$(pwd) "$1" -eu 'quoted text' 'quoted text'
+	cd ${HOME} ${HOME} test "$@" done export
+readonly $(pwd) $(pwd) --verbose $(pwd) -eu 'quoted text' awk /usr/bin awk sed
+local sed x=1 sed awk 2>/dev/null local "$@" /usr/bin $(pwd) -eu --verbose
+		sed printf awk $(pwd) local -eu 2>/dev/null x=1 echo then done cd
+	test --verbose 2>/dev/null 2>/dev/null printf $(pwd) echo
+		cd printf readonly 'quoted text' cd test printf done export 'quoted text'
+	test cd export awk $(pwd) local /usr/bin awk -eu | --verbose 'quoted text' x=1
+	done printf echo test 2>/dev/null awk -eu printf $(pwd) grep readonly | export
+	local --verbose -eu awk "$@" && --verbose cd local local sed $(pwd)
+		printf awk readonly sed cd grep "$1" printf test -eu -eu x=1
+		"$@" x=1 done test --verbose test export awk
+	"$1" "$@" "$@" "$1" export -eu export local -eu x=1 --verbose printf
+cd grep --verbose x=1 printf grep /usr/bin printf cd 'quoted text' test 'quoted text'
+'quoted text' ${HOME} echo -eu 'quoted text' sed 2>/dev/null && awk
+local local --verbose
+		echo --verbose 2>/dev/null readonly "$1" "$@"
+	-eu then "$1" $(pwd) local sed
+		grep 'quoted text' grep test /usr/bin test 'quoted text'
+	local ${HOME} x=1 x=1
+	local --verbose --verbose sed "$@" ${HOME} -eu $(pwd) ${HOME}
+		local export export "$1" echo export
+test test sed printf x=1 ${HOME} readonly $(pwd) "$@" then local
+&& then grep -eu grep printf awk | export local local cd "$@" local
+local sed 2>/dev/null x=1 "$1" grep 2>/dev/null
+		cd "$1" local export --verbose ${HOME} cd -eu /usr/bin done test
+--verbose && awk -eu && x=1 done $(pwd)
+		grep $(pwd) grep sed test echo done 2>/dev/null /usr/bin
+		${HOME} done awk /usr/bin 'quoted text' |
+	done --verbose grep printf printf awk echo
+		echo && /usr/bin sed echo -eu export "$1" grep
+	printf "$@" grep cd test ${HOME} x=1 -eu then 'quoted text'
+		grep local echo sed && ${HOME} sed then grep 'quoted text' readonly x=1 printf
+	--verbose ${HOME} 2>/dev/null
+| readonly 2>/dev/null && --verbose
+	export && --verbose export | && 'quoted text' grep ${HOME}
+	"$1" printf | 'quoted text' $(pwd) cd "$1" --verbose "$1" $(pwd) local && "$@"
+		x=1 export done then -eu then
+	-eu test sed x=1 'quoted text'
+	test | sed --verbose readonly export test awk 'quoted text' awk "$1" export
+/usr/bin sed echo -eu | --verbose /usr/bin
+test printf "$1" | grep sed 2>/dev/null
+test /usr/bin echo cd 2>/dev/null
+	sed export 2>/dev/null awk
+x=1 readonly echo -eu && done export "$1" /usr/bin $(pwd) local -eu
+echo test "$1" awk export x=1 "$@" readonly "$@" readonly grep $(pwd) 'quoted text'
+		awk 2>/dev/null done /usr/bin printf
+	&& sed && $(pwd) | test "$@" sed export /usr/bin x=1
+	/usr/bin sed ${HOME} test --verbose "$1" "$@" | cd sed
+/usr/bin readonly printf /usr/bin -eu "$@" awk --verbose
+readonly /usr/bin grep readonly | sed ${HOME} "$@" sed --verbose 2>/dev/null
+	/usr/bin grep --verbose /usr/bin | export done sed grep
+	grep then printf done local "$1" --verbose local test sed echo printf /usr/bin
+cd echo local grep "$@" 'quoted text'
+local readonly 'quoted text'
+	| done local echo echo && echo echo export 'quoted text'
+	"$@" local "$@" sed "$@"
+		${HOME} printf 2>/dev/null then $(pwd) "$@" export done && "$@" sed sed /usr/bin
+		-eu local local $(pwd) "$1" --verbose
+echo sed 'quoted text' readonly sed
+then grep export x=1 "$1" test readonly cd grep echo
+	${HOME} -eu export "$@" "$1" printf "$1" "$@" "$1"
+		done grep $(pwd) x=1
+	done test cd echo cd /usr/bin --verbose 2>/dev/null then test | done
+		'quoted text' sed export printf local "$1" readonly /usr/bin sed awk readonly printf
+	echo && "$1" local readonly printf | ${HOME} "$@" readonly
+		awk done x=1 awk && done sed $(pwd) test --verbose $(pwd) cd
+	test readonly done local then cd | ${HOME} --verbose echo then readonly ${HOME}
+	echo | x=1 "$@" -eu | awk echo --verbose done awk local
+	x=1 ${HOME} then 2>/dev/null
+-eu grep awk 2>/dev/null 2>/dev/null grep local grep
+	then done cd "$@" x=1 readonly local test readonly
+x=1 awk ${HOME} "$1" echo echo readonly /usr/bin "$@" echo grep awk export
+		test done -eu x=1 test && "$@" local /usr/bin ${HOME}
+readonly --verbose --verbose done
+done readonly test -eu && 2>/dev/null
+cd readonly done local export | grep done awk x=1 local
+'quoted text' echo grep printf awk echo -eu 'quoted text' grep ${HOME}
+then --verbose echo readonly grep test /usr/bin "$@" 'quoted text'
+--verbose --verbose $(pwd) "$@" test | sed
+awk cd 'quoted text' x=1 ${HOME} test ${HOME} grep "$@" "$1" --verbose printf
+sed "$@" ${HOME} awk "$1"
+	2>/dev/null export awk | "$@" sed sed /usr/bin && awk cd awk cd export readonly
+&& -eu printf test readonly grep printf grep
+/usr/bin echo printf cd echo -eu local readonly
+awk --verbose cd export -eu local awk then ${HOME} 'quoted text'
+		"$1" cd awk printf | "$@" x=1 echo /usr/bin
+		cd printf printf | done $(pwd) /usr/bin
+x=1 /usr/bin /usr/bin 2>/dev/null | 'quoted text' /usr/bin printf then
+	export cd 2>/dev/null
+		| 2>/dev/null echo --verbose export ${HOME} && x=1
+		x=1 "$@" -eu --verbose cd -eu local test "$1" test
+		x=1 done test echo local
+	export x=1 export && 2>/dev/null "$1" "$1" readonly readonly 2>/dev/null
+echo sed readonly x=1 echo sed 'quoted text' awk "$@"
+		| echo awk && ${HOME} export $(pwd) readonly 2>/dev/null
+		done cd "$@" | | "$1" ${HOME}
+	local printf readonly export grep | $(pwd) export then export ${HOME} sed readonly
+		grep local 'quoted text' sed printf local done x=1 $(pwd) ${HOME}
+then x=1 sed -eu /usr/bin 2>/dev/null then export --verbose then
+	--verbose readonly "$@" ${HOME}
+		then awk export x=1 | /usr/bin cd
+		readonly "$1" echo 2>/dev/null sed done | "$1" x=1 | cd ${HOME} "$@" x=1 -eu x=1
+grep sed then "$@" echo "$1" readonly ${HOME} /usr/bin done printf
+grep && local 'quoted text' ${HOME}
+test 2>/dev/null -eu test
+	x=1 "$1" "$1" -eu 'quoted text'
+		$(pwd) then 'quoted text' echo printf | awk -eu ${HOME} --verbose grep && echo
+		-eu echo "$1" 'quoted text' grep
+	done "$1" /usr/bin -eu printf
+local $(pwd) -eu x=1 sed test
+	grep "$1" printf ${HOME} test echo $(pwd) export "$1"
+x=1 x=1 printf awk done readonly test awk grep grep cd cd | --verbose local
+printf 2>/dev/null export --verbose test cd awk 'quoted text' awk | readonly test
+	"$1" export && && /usr/bin -eu /usr/bin
+cd cd ${HOME} -eu then 2>/dev/null ${HOME}
+		$(pwd) export local cd "$@" /usr/bin echo grep "$1" cd "$1" 2>/dev/null x=1 sed
+| ${HOME} readonly --verbose 'quoted text'
+		$(pwd) 'quoted text' awk ${HOME}
+-eu local && local && echo sed | grep done
+x=1 readonly grep ${HOME}
+	--verbose "$1" | && then awk --verbose test
+test $(pwd) local printf && printf /usr/bin sed sed cd "$1" /usr/bin
+	printf "$@" --verbose echo /usr/bin sed readonly
+		"$@" "$@" && "$@" grep test | printf "$1" | export then x=1
+		$(pwd) "$1" "$@" -eu sed done --verbose printf printf x=1 &&
+		"$@" "$1" export -eu then test && then --verbose /usr/bin
+		readonly done && grep echo printf -eu --verbose
+		grep 2>/dev/null -eu cd
+&& done grep x=1 printf cd test --verbose export printf sed "$1" x=1 awk "$@" done
+	readonly 'quoted text' readonly
+	-eu cd -eu --verbose 2>/dev/null printf ${HOME} "$@" x=1 printf
+local && grep | then $(pwd) && --verbose local && printf
+awk ${HOME} "$@" ${HOME} then readonly --verbose export cd | readonly readonly
+| test "$1" 'quoted text' --verbose 2>/dev/null cd --verbose
+	sed $(pwd) /usr/bin 'quoted text' 2>/dev/null x=1 --verbose then 2>/dev/null
+	then | cd awk printf cd $(pwd) printf "$1" ${HOME} -eu
+		"$1" test --verbose && printf x=1 test -eu && cd 'quoted text' sed
+	/usr/bin test then grep "$@" 2>/dev/null
+		then 2>/dev/null --verbose export readonly printf "$1" then /usr/bin 'quoted text'
+	local --verbose -eu sed $(pwd) ${HOME} printf printf grep && export
+	$(pwd) ${HOME} then "$1" /usr/bin grep 2>/dev/null awk sed | local x=1 "$@"
+	local "$1" /usr/bin 2>/dev/null test done local readonly 'quoted text' x=1 |
+	printf && "$@" /usr/bin 2>/dev/null $(pwd) x=1 readonly "$1" local /usr/bin
+	--verbose ${HOME} ${HOME} -eu
+	sed x=1 grep printf ${HOME} 'quoted text' sed --verbose then
+	printf local 2>/dev/null "$1"
+export echo ${HOME} "$1" printf
+	grep done ${HOME} grep /usr/bin -eu 'quoted text'
+	'quoted text' grep "$1" | /usr/bin
+	grep /usr/bin then 2>/dev/null sed awk "$@" 2>/dev/null grep
+		echo -eu awk "$@" 2>/dev/null 'quoted text' -eu ${HOME} then test 'quoted text'
+	-eu && cd | test "$1" test
+		grep then printf test grep | | done /usr/bin
+		cd test 'quoted text' done readonly cd local echo awk | sed ${HOME} export done
+-eu | done && /usr/bin cd cd grep echo $(pwd) printf cd done awk ${HOME} printf
+	done local readonly echo export 2>/dev/null $(pwd) echo local
+test grep $(pwd) /usr/bin 'quoted text'
+grep 2>/dev/null 'quoted text' awk sed cd /usr/bin done 2>/dev/null local
+	/usr/bin test x=1 $(pwd) echo 'quoted text'
+'quoted text' export echo 'quoted text' printf grep | 'quoted text'
+	"$1" --verbose $(pwd) export sed --verbose then && | sed
+	2>/dev/null $(pwd) done readonly done ${HOME} grep
+	&& sed -eu 'quoted text' then grep sed export
+awk printf 2>/dev/null &&
+	readonly | -eu local 2>/dev/null x=1
+printf -eu echo awk 'quoted text'
+printf $(pwd) 2>/dev/null
+		readonly sed x=1 done test awk done -eu awk then grep --verbose
+"$1" awk readonly && cd grep ${HOME} then 'quoted text'
+grep printf test awk -eu done then readonly export export readonly --verbose
+		"$1" "$1" /usr/bin 2>/dev/null grep grep
+then "$1" x=1 -eu echo "$@" --verbose "$@"
+	${HOME} $(pwd) done ${HOME} -eu $(pwd) grep
+	&& then test /usr/bin awk awk then
+'quoted text' local 2>/dev/null && test then --verbose /usr/bin 2>/dev/null
+	then "$1" done then local test echo --verbose done export cd 2>/dev/null local
+		test awk 'quoted text' echo printf then "$@" echo then
+	--verbose 'quoted text' 'quoted text' 'quoted text'
+		/usr/bin "$@" 'quoted text' x=1 sed printf ${HOME}
+		then echo -eu grep awk sed ${HOME} done export cd x=1 /usr/bin && export
+	"$1" grep -eu $(pwd) -eu $(pwd)
+		${HOME} "$1" x=1 printf readonly echo
+	grep && "$1" then "$1"
+		"$1" $(pwd) 'quoted text' then x=1 "$1" | readonly then ${HOME} done
+then awk test sed /usr/bin test cd $(pwd)
+	"$@" 'quoted text' grep cd "$@" test grep export ${HOME} done
+	$(pwd) "$1" test $(pwd) grep 2>/dev/null
+	printf done 2>/dev/null 'quoted text' -eu ${HOME}
+&& then --verbose 'quoted text' "$@" --verbose 'quoted text'
+2>/dev/null awk test x=1 done readonly readonly --verbose
+then printf | -eu printf -eu "$@" sed sed export && readonly
+		done test readonly /usr/bin "$1"
+	"$@" awk cd 2>/dev/null then then -eu readonly
+then && readonly "$1" --verbose sed
+sed 'quoted text' /usr/bin x=1 echo | -eu sed cd awk export sed then readonly
+	$(pwd) printf cd -eu awk &&
+		printf $(pwd) readonly x=1 echo done 'quoted text' 'quoted text'
+	${HOME} test grep readonly test awk readonly done cd
+		$(pwd) local $(pwd) ${HOME}
+	sed local test $(pwd) test cd export readonly sed
+	${HOME} $(pwd) -eu x=1 /usr/bin 'quoted text' echo 'quoted text' done grep /usr/bin
+	sed export printf ${HOME} /usr/bin x=1 "$@" echo $(pwd) --verbose cd echo awk
+		local test ${HOME} then echo "$1" echo grep --verbose
+		then then awk done export -eu printf 'quoted text'
+readonly grep grep && 'quoted text' awk | sed "$1" then | /usr/bin $(pwd)
+	| && cd grep export -eu ${HOME} grep -eu local local printf
+		local $(pwd) local /usr/bin ${HOME} x=1 readonly awk local awk
+	readonly then then $(pwd) then
+		${HOME} x=1 /usr/bin "$1" && && export
+	done echo echo /usr/bin /usr/bin /usr/bin local && x=1 then awk /usr/bin local
+grep export done echo grep test "$@" --verbose awk done /usr/bin x=1 grep x=1
+		-eu "$@" "$@" readonly grep readonly "$@" 2>/dev/null
+	$(pwd) x=1 then /usr/bin export 'quoted text' "$@" --verbose cd "$@"
+		-eu local 'quoted text' ${HOME}
+		'quoted text' ${HOME} | "$1" 2>/dev/null -eu
+		awk grep sed -eu $(pwd) export export then echo test
+	cd "$1" awk echo cd then "$1" "$1" grep done echo readonly $(pwd) && grep ${HOME}
+test "$@" "$@" awk | done "$@" /usr/bin
+	echo local local 2>/dev/null -eu then test printf done
+readonly awk export /usr/bin printf $(pwd) $(pwd) then "$@" ${HOME}
+x=1 "$1" x=1 cd sed awk awk grep
+test printf x=1 "$1" $(pwd) && x=1 --verbose echo -eu 'quoted text'
+local && 2>/dev/null "$1"
+	"$@" grep readonly then export -eu | echo sed then grep x=1
+		awk sed printf awk awk "$1" export
+	$(pwd) --verbose 'quoted text' echo
+	then 'quoted text' cd cd | --verbose "$@" grep awk "$@"
+	'quoted text' local /usr/bin /usr/bin printf grep awk readonly 2>/dev/null | grep
+/usr/bin cd done x=1 | 2>/dev/null && --verbose test done test echo
+	${HOME} sed && done && sed 2>/dev/null /usr/bin 2>/dev/null | awk 2>/dev/null
+readonly 2>/dev/null cd local sed awk "$@" test
+		test then /usr/bin ${HOME} then ${HOME} ${HOME} readonly export
+		echo cd /usr/bin && "$@" sed 2>/dev/null
+		then | done $(pwd) echo readonly "$@" sed "$@" cd test --verbose done
+"$1" $(pwd) "$1" sed grep readonly cd readonly export then
+"$1" x=1 | echo readonly then printf export
+	/usr/bin 'quoted text' $(pwd) 2>/dev/null 'quoted text' /usr/bin
+		export awk awk echo /usr/bin cd then readonly test printf sed --verbose grep echo
+	| $(pwd) $(pwd) ${HOME} printf cd
+	test $(pwd) -eu grep --verbose -eu local 'quoted text' -eu -eu then
+		&& then grep echo then | ${HOME} x=1 cd
+test "$@" test readonly x=1 sed readonly
+		2>/dev/null | $(pwd) -eu grep "$@" awk $(pwd) "$1" echo | ${HOME} $(pwd)
+	x=1 local export test readonly printf | | "$1" /usr/bin
+	grep then sed readonly -eu x=1 awk printf then
+-eu done echo then test -eu x=1 | $(pwd) printf "$1" cd -eu x=1 cd
+	--verbose printf /usr/bin readonly
+		test echo $(pwd) then sed printf
+		"$1" x=1 && then x=1 "$@" $(pwd) ${HOME} --verbose
+export grep && done 'quoted text' awk sed cd --verbose
+		/usr/bin grep test "$1" test printf
+	/usr/bin printf sed cd grep cd export --verbose grep grep
+sed test sed awk --verbose /usr/bin 2>/dev/null
+		&& awk then awk x=1 local 'quoted text' x=1 then /usr/bin awk readonly
+		"$1" "$1" readonly && "$@" 'quoted text' /usr/bin test then cd export /usr/bin
+echo echo "$@" /usr/bin ${HOME} sed | echo readonly
+'quoted text' --verbose "$1" then ${HOME}
+	echo && | echo sed && grep readonly
+${HOME} -eu done && $(pwd) 2>/dev/null
+		x=1 'quoted text' 2>/dev/null "$@" /usr/bin echo && --verbose then 'quoted text'
+	'quoted text' done export
+		$(pwd) && --verbose done export x=1 sed $(pwd) 'quoted text' awk | sed "$1" &&
+		export "$1" export readonly $(pwd) done &&
+		'quoted text' export grep 2>/dev/null
+	| done awk then then && 'quoted text'
+	then $(pwd) | && 2>/dev/null
+	-eu local -eu local && echo local sed 2>/dev/null "$1" | grep local export awk
+printf awk grep --verbose awk ${HOME}
+		$(pwd) | "$@" ${HOME} /usr/bin | echo x=1 cd "$1" && ${HOME}
+cd 'quoted text' ${HOME} | -eu printf
+	done printf export 2>/dev/null
+		then sed $(pwd) -eu export grep readonly && | done
+	grep echo readonly awk -eu readonly cd && local sed
+	2>/dev/null | cd $(pwd) cd cd /usr/bin sed export export 'quoted text' grep 'quoted text'
+local "$@" export "$1" sed ${HOME} x=1 $(pwd) x=1 x=1 'quoted text' test
+	printf | done 2>/dev/null x=1 awk done ${HOME}
+		awk 'quoted text' sed sed cd /usr/bin readonly readonly
+	${HOME} done then --verbose readonly cd --verbose /usr/bin
+		readonly -eu local /usr/bin
+		sed 2>/dev/null 'quoted text'
+	/usr/bin 'quoted text' printf test
+	-eu printf /usr/bin $(pwd)
+	cd -eu grep -eu 2>/dev/null --verbose ${HOME} sed grep awk 'quoted text'
+'quoted text' readonly awk -eu
+		readonly cd "$@" -eu grep echo printf awk test
+	grep 2>/dev/null done ${HOME} $(pwd) -eu 'quoted text'
+done 2>/dev/null done -eu 'quoted text' 2>/dev/null grep -eu test &&
+		/usr/bin "$@" ${HOME} readonly local ${HOME} && awk
+	export test /usr/bin grep grep readonly
+		--verbose && x=1 x=1 test |
+"$@" "$@" -eu ${HOME} "$1" echo 'quoted text' done
+done grep printf ${HOME} | awk sed printf
+		2>/dev/null $(pwd) | 'quoted text' echo local $(pwd) | cd -eu export
+		x=1 'quoted text' export grep echo $(pwd) cd test ${HOME} sed local
+		$(pwd) sed done ${HOME} local test /usr/bin -eu awk --verbose
+		awk && grep ${HOME} -eu export
+		| awk printf local local
+		cd sed sed "$@" then cd grep echo then printf | export 'quoted text' grep awk awk
+	sed export echo | | "$1"
+		| "$@" | printf awk then readonly then -eu printf x=1 test
+echo --verbose local ${HOME} printf "$@" 'quoted text' /usr/bin export 2>/dev/null
+-eu sed "$1" /usr/bin $(pwd) "$@" cd sed grep done cd && x=1 "$@" sed ${HOME}
+	then -eu 'quoted text' ${HOME} echo "$1"
+		&& local | ${HOME} export x=1 'quoted text'
+		sed echo readonly readonly cd 'quoted text'
+	done "$1" /usr/bin -eu /usr/bin
+	${HOME} readonly ${HOME} "$@" --verbose echo $(pwd) x=1 echo -eu x=1
+		printf -eu test awk "$1" awk -eu /usr/bin $(pwd) | test $(pwd) awk readonly
+		test cd -eu x=1 --verbose "$1" then printf
+	| cd local cd sed $(pwd) 'quoted text' $(pwd) $(pwd) 2>/dev/null "$1" readonly
+sed cd printf x=1 -eu awk ${HOME} local printf echo test test --verbose echo
+	--verbose --verbose 'quoted text' export --verbose
+	"$1" export $(pwd) /usr/bin cd local x=1 'quoted text'
+&& "$1" ${HOME} -eu readonly x=1 printf --verbose 'quoted text' && printf
+	sed awk grep /usr/bin ${HOME}
+	'quoted text' grep x=1 x=1
+grep printf --verbose test 2>/dev/null x=1
+| grep test export test && export grep $(pwd) ${HOME}
+		"$1" grep grep awk 'quoted text' test /usr/bin -eu export export echo
+	"$@" x=1 --verbose && export cd -eu local local | 2>/dev/null "$@" -eu printf
+	| -eu $(pwd) /usr/bin test "$@" export grep
+		done cd --verbose done $(pwd) done /usr/bin -eu then export sed then
+/usr/bin readonly ${HOME} --verbose /usr/bin
+		2>/dev/null printf && "$@" readonly /usr/bin
+	2>/dev/null then export local readonly x=1 grep printf readonly
+	-eu "$1" && $(pwd) printf grep x=1 readonly -eu cd 2>/dev/null echo local
+	then awk test export grep done test test /usr/bin 2>/dev/null
+	readonly done grep --verbose printf
+${HOME} local cd "$@" local "$1" x=1 $(pwd) done ${HOME}
+		awk /usr/bin test done -eu ${HOME} printf 2>/dev/null awk
+echo then export done ${HOME} export readonly test awk echo grep
+	"$@" readonly --verbose "$@" echo /usr/bin printf echo -eu readonly
+	x=1 local 'quoted text' printf | printf grep grep && -eu $(pwd)
+"$@" readonly done /usr/bin grep
+	echo $(pwd) -eu echo printf grep
+done printf then 'quoted text' sed awk |
+		done ${HOME} echo "$@" x=1 "$1" -eu done /usr/bin ${HOME} 2>/dev/null
+	export then /usr/bin --verbose test /usr/bin
+test "$1" echo --verbose /usr/bin then echo sed done /usr/bin then "$@"
+/usr/bin ${HOME} test "$@" "$@" local $(pwd) 2>/dev/null
+/usr/bin grep 2>/dev/null printf ${HOME}
+export awk grep local --verbose
+awk 'quoted text' local grep echo "$@" awk x=1 readonly "$1" cd test --verbose
+		awk then sed grep ${HOME} cd x=1 | 'quoted text'
+		/usr/bin readonly cd
+readonly done "$1" grep awk
+	"$1" "$@" x=1 awk x=1 && sed then -eu printf export readonly local /usr/bin
+	grep sed "$1" /usr/bin $(pwd) 2>/dev/null
+export echo echo 'quoted text' local printf | "$@" --verbose &&
+echo "$@" done && then ${HOME} | printf 2>/dev/null "$1" sed printf
+then ${HOME} grep awk sed then awk readonly
+		then /usr/bin "$@" readonly sed 'quoted text' local &&
+done && ${HOME} -eu $(pwd) cd cd
+		readonly $(pwd) && local printf
+	/usr/bin local local "$@"
+cd printf $(pwd) local printf printf
+x=1 "$@" then export ${HOME} "$1" &&
+		test x=1 --verbose cd 2>/dev/null "$@" $(pwd)
+	awk awk local done && "$@" /usr/bin done printf readonly
+		${HOME} "$@" then /usr/bin readonly printf ${HOME}
+	done 2>/dev/null && /usr/bin test cd /usr/bin -eu /usr/bin && x=1 test
+		/usr/bin "$@" awk cd -eu --verbose
+		&& printf | ${HOME} then && readonly printf grep x=1 x=1 -eu 'quoted text'
+	x=1 test 2>/dev/null $(pwd) test $(pwd) && | local ${HOME} cd && && export
+x=1 export --verbose /usr/bin readonly
+	awk then sed | -eu test --verbose $(pwd) "$@" readonly
+		"$@" 2>/dev/null | "$@" 2>/dev/null
+readonly then local cd awk 2>/dev/null then | export && export local
+--verbose echo 2>/dev/null
+--verbose awk grep --verbose sed test echo /usr/bin local -eu cd 2>/dev/null
+	awk $(pwd) then echo local
+		echo grep local test test
+test cd 2>/dev/null -eu x=1 'quoted text'
+	-eu sed sed printf test --verbose $(pwd) -eu ${HOME}
+	| $(pwd) export awk ${HOME} ${HOME} grep
+		&& readonly && /usr/bin | then -eu then
+	sed printf /usr/bin printf 'quoted text' printf x=1 'quoted text'
+printf 2>/dev/null --verbose grep printf local done grep
+sed /usr/bin then ${HOME}
+-eu x=1 sed echo cd sed 'quoted text'
+| sed ${HOME} /usr/bin x=1 awk /usr/bin
+		"$1" -eu x=1 done "$1" export printf 2>/dev/null
+echo "$1" ${HOME} 'quoted text' "$1" done
+		export $(pwd) sed x=1
+		then ${HOME} cd x=1 test && echo readonly "$1" "$@"
+	awk | ${HOME} ${HOME} /usr/bin done echo sed
+		--verbose /usr/bin | -eu then | done /usr/bin done then sed local $(pwd)
+	local printf -eu sed grep
+echo local grep local | cd x=1 then export awk
+		$(pwd) cd /usr/bin "$@" -eu /usr/bin 2>/dev/null
+		'quoted text' && test 'quoted text' "$@" "$1" && sed
+x=1 grep ${HOME} echo test ${HOME} awk sed awk -eu && -eu "$1" cd --verbose
+awk printf then && "$1" 2>/dev/null then -eu export "$@"
+	sed | cd 2>/dev/null done 2>/dev/null
+		then "$1" | local 'quoted text'
+	awk export && 2>/dev/null 'quoted text' "$@" local $(pwd) "$@" done grep done
+cd awk 'quoted text' local | readonly then
+'quoted text' $(pwd) printf
+/usr/bin grep --verbose $(pwd) readonly export sed awk 'quoted text' export local
+		&& export && 'quoted text' /usr/bin
+	awk export 2>/dev/null awk ${HOME} printf local --verbose
+echo grep "$@" | echo printf $(pwd) test then awk local -eu export
+		/usr/bin --verbose ${HOME} "$@" then 'quoted text'
+		printf --verbose && 2>/dev/null echo /usr/bin
+		grep local "$@" --verbose awk grep $(pwd)
+		printf "$1" | 'quoted text' test test "$1" then && test
+		--verbose then grep export readonly "$@" x=1 awk echo awk printf |
+		&& echo grep $(pwd) -eu | "$@" && done test sed readonly /usr/bin
+		local local test printf done sed -eu ${HOME} readonly
+	/usr/bin readonly then --verbose 2>/dev/null
+	"$@" test grep export test then cd "$@"
+		${HOME} grep export cd "$@" export --verbose "$1" "$@" test
+test "$@" && "$1" $(pwd) then 2>/dev/null $(pwd) then cd "$1" done
+	2>/dev/null grep local awk x=1 then x=1 grep --verbose | export awk test -eu
+		"$1" awk awk grep export cd /usr/bin
+	export $(pwd) ${HOME} export -eu x=1 -eu
+grep "$@" | cd sed sed "$@" -eu
+	readonly /usr/bin sed 'quoted text' 2>/dev/null
+2>/dev/null x=1 x=1 2>/dev/null local
+	export printf awk grep test readonly | "$@" 'quoted text'
+	done 2>/dev/null then test echo | echo grep 'quoted text'
+echo && cd printf x=1 export printf --verbose --verbose
+		x=1 test done sed cd $(pwd) 2>/dev/null "$@" -eu printf --verbose
+grep ${HOME} awk sed --verbose ${HOME} awk $(pwd) x=1 &&
+done 2>/dev/null --verbose $(pwd) readonly grep 2>/dev/null && --verbose
+readonly x=1 readonly --verbose sed 2>/dev/null sed readonly local
+done grep -eu test -eu printf then
+"$1" awk sed readonly ${HOME}
+	| -eu printf export 'quoted text' test done cd
+	--verbose ${HOME} done grep awk -eu test
+		printf cd echo sed local awk awk test
+	grep ${HOME} test "$@" export cd grep cd grep 'quoted text'
+		cd ${HOME} awk "$1" cd 'quoted text' grep printf && printf && local $(pwd)
+	/usr/bin 2>/dev/null x=1 ${HOME}
+	readonly | -eu --verbose 'quoted text'
+		echo "$@" $(pwd) readonly "$@" test 'quoted text'
+		'quoted text' then cd cd && then "$1" /usr/bin x=1 printf /usr/bin cd x=1 ${HOME}
+		-eu local "$1" readonly 'quoted text' ${HOME}
+	echo && --verbose ${HOME} --verbose printf local awk --verbose
+		&& local local "$1" then
+	cd -eu sed 'quoted text' 'quoted text' test done
+	&& "$1" x=1 | local --verbose "$@" "$1" grep 'quoted text' done --verbose |
+"$@" then local done awk | readonly export -eu done
+| /usr/bin | test test --verbose export
+		${HOME} 'quoted text' test readonly local then "$1" x=1 ${HOME} 2>/dev/null
+	| 2>/dev/null printf && done "$1" local "$1" cd echo
+cd --verbose grep "$@" | && | "$1" x=1 -eu sed /usr/bin /usr/bin awk |
+	grep $(pwd) 'quoted text' test /usr/bin awk
+readonly --verbose -eu readonly --verbose
+		| export cd grep /usr/bin -eu grep x=1 cd -eu then test --verbose --verbose
+		'quoted text' echo 'quoted text' then local 2>/dev/null
+'quoted text' --verbose sed 'quoted text' 2>/dev/null /usr/bin
+		cd -eu -eu grep 'quoted text' local echo echo
+$(pwd) 'quoted text' printf test cd printf echo done readonly
+'quoted text' sed 2>/dev/null local local 'quoted text'
+	sed "$1" test --verbose /usr/bin readonly 'quoted text'
+	"$1" then then echo cd sed | export /usr/bin /usr/bin "$@" grep | cd awk awk ${HOME}
+		-eu -eu readonly 2>/dev/null done awk local then cd
+		then 2>/dev/null done
+	readonly --verbose | && done local "$@" && "$@" && &&
+	grep 2>/dev/null awk 2>/dev/null
+test local cd "$@" readonly
+export test ${HOME} x=1 test grep "$1" "$1"
+	then --verbose grep ${HOME} echo --verbose echo test awk awk | cd
+done grep local sed "$@" printf /usr/bin then local grep --verbose local
+&& ${HOME} 'quoted text' export
+$(pwd) readonly printf | ${HOME} local local "$@"
+	test && /usr/bin "$@" export grep /usr/bin
+cd 'quoted text' --verbose then grep then awk 2>/dev/null printf "$1" export awk
+		"$@" sed ${HOME} printf grep local test readonly
+x=1 /usr/bin | printf local | "$1" 'quoted text' "$1" --verbose $(pwd) "$@"
+then readonly printf 'quoted text' ${HOME} then
+		test echo $(pwd) 'quoted text' 'quoted text' && -eu ${HOME} /usr/bin ${HOME}
+${HOME} done readonly 'quoted text'
+	readonly "$1" awk printf cd readonly "$@" test "$1"
+		local local 2>/dev/null -eu && --verbose readonly then
+	${HOME} "$1" then awk done grep done
+	"$@" awk export "$1" x=1 cd readonly x=1 echo readonly then test /usr/bin |
+		/usr/bin ${HOME} "$1" test
+test /usr/bin readonly "$1" --verbose echo -eu ${HOME} cd -eu
+	printf cd $(pwd) /usr/bin $(pwd) local cd 2>/dev/null && --verbose
+readonly x=1 "$1" ${HOME} 2>/dev/null "$1"
+	2>/dev/null "$@" done test |
+	echo cd awk awk "$@" local done && done local readonly printf export cd local x=1
+		| --verbose && echo && readonly then
+&& export -eu local export && done 'quoted text' "$@" printf grep x=1
+	local done --verbose grep test then test $(pwd) test
+	--verbose --verbose grep export export 2>/dev/null
+		"$@" cd awk | 'quoted text' done "$@" grep grep grep
+		"$@" export 'quoted text' readonly grep "$1" 'quoted text'
+		readonly 2>/dev/null test --verbose "$@" echo
+		/usr/bin && readonly sed done ${HOME} local /usr/bin export | --verbose
+		| test cd /usr/bin readonly ${HOME} "$1" cd readonly 'quoted text' sed echo
+	"$@" -eu sed cd done --verbose && --verbose 'quoted text'
+		'quoted text' "$@" "$1" $(pwd) | grep sed 'quoted text' x=1
+	printf | "$1" export "$@" local export && echo
+"$1" awk awk ${HOME} x=1 awk --verbose
+	grep | /usr/bin $(pwd) |
+	printf readonly export readonly "$1" x=1 $(pwd) x=1 2>/dev/null $(pwd) sed
+		grep $(pwd) | "$1" printf | local "$1" --verbose export then x=1 2>/dev/null
+2>/dev/null ${HOME} test | echo
+		test test /usr/bin grep $(pwd)
+		cd --verbose grep --verbose then $(pwd) then test 2>/dev/null "$1"
+		-eu printf && test test "$1" "$1" 2>/dev/null printf
+	then done readonly printf "$@" printf grep done x=1 test $(pwd)
+awk readonly -eu "$1" then echo local then local /usr/bin then ${HOME}
+	then $(pwd) local --verbose "$1" | done cd done grep grep
+		local export "$@" export | done ${HOME} "$1"
+/usr/bin readonly x=1 echo test "$1"
+		$(pwd) | then 2>/dev/null awk 2>/dev/null | done done
+local $(pwd) -eu /usr/bin local 'quoted text' ${HOME}
+done $(pwd) echo echo echo 'quoted text' "$@" awk readonly
+	'quoted text' "$@" readonly
+cd $(pwd) cd "$@" -eu /usr/bin --verbose sed awk grep --verbose 'quoted text'
+		| ${HOME} --verbose grep
+		awk 'quoted text' /usr/bin && "$1" grep
+		local done done "$1" local ${HOME} printf "$1" 2>/dev/null $(pwd) export "$1"
+awk cd local 'quoted text' echo /usr/bin $(pwd)
+export local | "$1" x=1 sed
+		readonly export awk printf then printf test "$@"
+		export -eu grep 'quoted text' ${HOME} done export readonly x=1
+		test printf -eu cd readonly export -eu local x=1 printf
+test 2>/dev/null test printf sed $(pwd) 'quoted text' | sed 2>/dev/null
+		cd grep local awk /usr/bin test /usr/bin "$1" local --verbose
+'quoted text' 2>/dev/null 'quoted text' done 2>/dev/null
+printf local 'quoted text' then "$1"
+		sed && 'quoted text' "$@" "$1" awk --verbose cd cd test "$@"
+	'quoted text' --verbose ${HOME}
+		x=1 --verbose export printf "$1" /usr/bin -eu "$1" awk awk
+printf 'quoted text' ${HOME} -eu /usr/bin then --verbose
+		&& && export readonly
+		x=1 local "$1" sed done test && 'quoted text' export
+	x=1 --verbose /usr/bin readonly awk done -eu x=1
+x=1 then 2>/dev/null 2>/dev/null
+$(pwd) 'quoted text' --verbose readonly echo |
+then $(pwd) | readonly
+readonly grep test --verbose grep printf -eu
+		&& cd export done grep then "$@" $(pwd) x=1 awk -eu local
+		x=1 sed | then && cd 'quoted text' ${HOME} sed
+		x=1 export x=1 2>/dev/null "$1" $(pwd)
+	${HOME} grep done 2>/dev/null readonly grep $(pwd) "$1" ${HOME} "$@" ${HOME}
+export local x=1 'quoted text' && "$1" ${HOME} /usr/bin
+"$@" /usr/bin awk && 'quoted text' -eu export "$@" test then 'quoted text'
+test | then echo x=1 && readonly
+	2>/dev/null x=1 $(pwd) /usr/bin cd cd sed && /usr/bin then
+grep "$@" printf printf
+	awk ${HOME} then done printf ${HOME} test
+	'quoted text' | | x=1 sed readonly 2>/dev/null && echo
+	readonly "$@" sed 2>/dev/null echo cd then /usr/bin then -eu && && awk 2>/dev/null
+		x=1 $(pwd) awk ${HOME} 2>/dev/null "$1" x=1 export then test local 2>/dev/null
+local then "$1" local 2>/dev/null --verbose ${HOME}
+	/usr/bin 'quoted text' x=1 -eu "$1" test 2>/dev/null 2>/dev/null
+export export then "$@" --verbose grep -eu readonly cd then awk /usr/bin
+x=1 export 2>/dev/null done
+		sed export done $(pwd) && 'quoted text' ${HOME} cd test awk && echo "$1" &&
+		2>/dev/null echo --verbose test
+	done done done -eu readonly echo "$1" local ${HOME} echo test /usr/bin
+	printf /usr/bin 2>/dev/null sed grep grep grep /usr/bin
+&& && $(pwd) /usr/bin local | | ${HOME} grep echo --verbose readonly done
+awk 'quoted text' awk echo cd grep -eu sed awk ${HOME} grep printf
+--verbose test $(pwd) x=1 readonly | "$@" | done local
+cd 'quoted text' --verbose x=1 2>/dev/null
+'quoted text' sed /usr/bin readonly test
+done --verbose $(pwd) "$@" "$1" | -eu echo cd x=1 awk done awk $(pwd) readonly
+awk ${HOME} test ${HOME} -eu awk && sed && 'quoted text'
+test ${HOME} && ${HOME} | "$@" && /usr/bin 'quoted text' 'quoted text'
+	'quoted text' 2>/dev/null cd -eu echo cd awk done sed "$1" --verbose -eu 'quoted text'
+	'quoted text' "$@" cd test
+grep export --verbose test awk 2>/dev/null --verbose done readonly
+2>/dev/null awk export echo cd $(pwd)
+	| --verbose | $(pwd) then test
+echo && ${HOME} sed "$1"
+--verbose $(pwd) printf cd local 2>/dev/null "$@"
+	grep | --verbose -eu "$1" grep sed
+	test -eu cd local grep export x=1
+export readonly cd ${HOME} -eu sed x=1 2>/dev/null cd then printf
+		awk test --verbose "$@"
+'quoted text' cd 'quoted text' echo printf awk echo
+-eu $(pwd) && readonly ${HOME} done echo cd readonly cd ${HOME} $(pwd) &&
+		export --verbose echo then export readonly
+cd --verbose cd test printf ${HOME}
+	export $(pwd) "$1" echo $(pwd) /usr/bin ${HOME} sed
+		sed -eu grep done then |
+	readonly done --verbose sed "$1" --verbose "$1"
+&& -eu $(pwd) --verbose -eu local /usr/bin test 'quoted text'
+		'quoted text' && then sed $(pwd) done cd /usr/bin
+	2>/dev/null -eu $(pwd) "$1" -eu ${HOME} then cd grep printf --verbose /usr/bin
+grep "$1" export sed awk local export -eu readonly
+		echo test grep awk -eu 2>/dev/null && -eu
+2>/dev/null "$1" awk sed sed then local x=1 x=1 /usr/bin grep cd ${HOME} x=1 'quoted text'
+	${HOME} awk awk readonly --verbose grep x=1 echo -eu
+		echo "$1" done echo 'quoted text' readonly printf test 2>/dev/null
+		test /usr/bin readonly $(pwd) local then local
+		readonly x=1 done cd 2>/dev/null "$@" -eu awk readonly local -eu grep
+	| then done done done $(pwd) /usr/bin echo readonly 2>/dev/null && then
+		2>/dev/null -eu grep then cd awk | echo export
+		${HOME} --verbose 'quoted text' echo $(pwd)
+&& awk awk echo 'quoted text' $(pwd) local "$@"
+		printf 2>/dev/null export 'quoted text'
+	test && done export printf 'quoted text' awk "$@"
+	"$1" then printf 2>/dev/null done then export 'quoted text' export readonly 2>/dev/null
+	${HOME} --verbose | 'quoted text' /usr/bin test sed
+&& && x=1 cd "$@" /usr/bin done sed -eu -eu
+		grep x=1 echo then 'quoted text' cd 'quoted text' --verbose "$@" 'quoted text'
+	printf then /usr/bin grep grep $(pwd) -eu local local
+		export grep printf readonly 2>/dev/null grep $(pwd)
+		$(pwd) printf done "$1" ${HOME} printf readonly done
+	awk && printf /usr/bin readonly awk sed awk echo cd /usr/bin "$@" ${HOME} $(pwd)
+	${HOME} "$1" --verbose then "$@" $(pwd) printf then
+		export x=1 /usr/bin -eu 2>/dev/null --verbose ${HOME} "$1" x=1 'quoted text'
+		test grep sed test 'quoted text' $(pwd) --verbose x=1 printf local printf 'quoted text'
+	test && 2>/dev/null -eu echo "$@" export sed
+echo test ${HOME} done ${HOME} "$1" ${HOME} readonly | $(pwd) cd readonly
+'quoted text' 'quoted text' -eu export --verbose readonly export
+		-eu 2>/dev/null 2>/dev/null
+		"$@" ${HOME} 2>/dev/null ${HOME} "$@" local $(pwd) readonly 2>/dev/null
+		x=1 then /usr/bin "$1" "$1" ${HOME} done readonly test test export | test done
+		done $(pwd) x=1 $(pwd) "$1" sed sed
+	then $(pwd) x=1 ${HOME} --verbose | -eu -eu 2>/dev/null ${HOME} echo
+	&& export grep done $(pwd) ${HOME} grep && grep
+		sed done echo x=1 local export "$@" echo $(pwd) 'quoted text'
+		"$@" awk done && then awk echo done x=1 cd readonly --verbose -eu cd /usr/bin
+grep --verbose /usr/bin
+readonly 'quoted text' $(pwd)
+	printf test -eu sed sed grep ${HOME} echo "$1" "$@" readonly -eu
+		x=1 2>/dev/null awk --verbose ${HOME}
+awk -eu readonly $(pwd) x=1 x=1 $(pwd) |
+		x=1 && test "$@" cd local export -eu then x=1 cd echo ${HOME} --verbose echo
+		/usr/bin "$@" export /usr/bin cd x=1 cd test "$@" && ${HOME} awk awk local
+done /usr/bin awk $(pwd) printf done && printf export then "$1" ${HOME} "$1"
+	&& local --verbose --verbose "$1" x=1 /usr/bin done
+		export /usr/bin awk /usr/bin export $(pwd) printf
+-eu cd -eu echo cd &&
+	echo /usr/bin -eu "$1" && printf grep "$@" | grep awk
+		| readonly awk 2>/dev/null then printf
+x=1 -eu 'quoted text' export
+export --verbose --verbose
+	awk export --verbose && export readonly 2>/dev/null 2>/dev/null awk then && export
+	"$1" grep printf readonly then $(pwd) awk x=1 printf local $(pwd)
+	sed sed test -eu | -eu test 'quoted text' echo && x=1 x=1 then "$1"
+	&& cd printf /usr/bin "$@" echo done && sed x=1 cd 2>/dev/null x=1 echo local
+		local local done -eu -eu --verbose | /usr/bin $(pwd) then
+printf | ${HOME} sed /usr/bin && | && | -eu -eu then /usr/bin 'quoted text' $(pwd)
+local && | echo sed sed && "$1" x=1 done
+		--verbose 'quoted text' 2>/dev/null 2>/dev/null sed 2>/dev/null
+	/usr/bin test test $(pwd) sed
+		awk 2>/dev/null then ${HOME}
+awk --verbose then $(pwd)
+	"$1" && "$@" done test
+/usr/bin -eu printf --verbose /usr/bin readonly
+	echo "$1" --verbose $(pwd)
+	${HOME} then "$@" printf awk
+"$@" --verbose echo | test cd && ${HOME} -eu 2>/dev/null -eu
+		then "$@" --verbose export sed awk printf $(pwd) "$@" echo cd ${HOME} grep printf
+	$(pwd) --verbose echo echo $(pwd) sed
+	echo ${HOME} printf grep cd export awk | ${HOME}
+| 'quoted text' "$1" -eu readonly 'quoted text' then --verbose
+		| grep test export cd local then "$1"
+	sed awk "$1" sed -eu export sed readonly -eu 'quoted text' && ${HOME}
+		| -eu && 2>/dev/null $(pwd) "$@" echo local ${HOME} sed local
+--verbose ${HOME} local done /usr/bin echo
+		export readonly | | grep test
+		then 'quoted text' --verbose ${HOME} ${HOME} grep then "$@" && echo
+	cd readonly /usr/bin then cd then 'quoted text' /usr/bin grep readonly
+		2>/dev/null local /usr/bin "$1" sed
+	-eu | 'quoted text' "$1" local printf ${HOME}
+done "$@" 'quoted text' grep 'quoted text' -eu export && "$@" x=1 done -eu
+	&& && grep then readonly "$1" && "$1" awk &&
+	test --verbose "$1" printf test 2>/dev/null then cd then sed
+		| printf test cd "$@" -eu readonly done awk "$@" "$@"
+printf readonly $(pwd) && readonly -eu
+$(pwd) local then "$1" /usr/bin sed grep -eu done ${HOME}
+		$(pwd) "$1" readonly done --verbose test done sed
+		cd test test ${HOME} cd sed
+	&& "$@" --verbose export | grep -eu 2>/dev/null grep awk --verbose
+2>/dev/null printf /usr/bin
+		"$@" done sed done test
+x=1 export "$@" | awk sed local done awk 2>/dev/null local readonly
+		printf ${HOME} readonly -eu $(pwd) x=1 ${HOME} ${HOME} echo && &&
+		x=1 grep | export "$@" local | ${HOME} -eu "$1" &&
+/usr/bin 'quoted text' | && done --verbose
+		x=1 /usr/bin echo | "$1" export readonly --verbose cd x=1 | cd readonly x=1
+&& ${HOME} ${HOME} /usr/bin /usr/bin cd local readonly
+'quoted text' 2>/dev/null grep ${HOME} readonly echo | cd -eu && -eu x=1 cd test
+sed 2>/dev/null "$1" readonly local /usr/bin "$1" /usr/bin | /usr/bin
+		&& then $(pwd) local /usr/bin readonly then readonly | printf ${HOME} grep --verbose
+printf printf awk ${HOME} $(pwd) sed readonly
+		${HOME} export echo local "$1" -eu x=1 x=1 2>/dev/null ${HOME} "$@" x=1
+sed --verbose 'quoted text' grep echo printf export cd x=1 test awk
+	sed $(pwd) done then then | | 'quoted text' "$1" | export && awk "$1" echo
+	grep x=1 'quoted text' "$@" cd export
+local "$@" $(pwd) local 2>/dev/null cd awk export test sed
+		grep then test then | "$1" echo "$@" cd echo printf export
+awk export test "$1" grep x=1 done "$@" readonly cd 2>/dev/null
+echo done cd && && readonly ${HOME} x=1 then grep echo x=1 test $(pwd) -eu grep
+export /usr/bin done echo "$1" "$1" 'quoted text' done "$1" grep printf
+		readonly sed readonly -eu awk -eu x=1 printf && -eu export cd ${HOME} test 2>/dev/null
+$(pwd) "$1" "$1" -eu then "$1" --verbose | "$@" $(pwd)
+-eu export x=1 'quoted text' && readonly
+	"$1" $(pwd) sed then $(pwd) export x=1 /usr/bin
+		echo test done "$1" --verbose sed readonly && grep 2>/dev/null && "$1"
+sed x=1 grep | then test x=1 test 'quoted text' x=1 2>/dev/null
+	awk && 2>/dev/null | "$1" ${HOME}
+	grep x=1 cd done test cd local ${HOME}
+		readonly 2>/dev/null x=1 test readonly ${HOME}
+	cd printf $(pwd) readonly
+		${HOME} ${HOME} 'quoted text'
+	"$1" sed 'quoted text'
+		-eu 'quoted text' printf cd "$@" then $(pwd) x=1 cd -eu grep "$1" 'quoted text'
+		"$@" x=1 readonly x=1 x=1 /usr/bin grep grep "$@" "$1"
+	export cd ${HOME} -eu | done
+		export export --verbose test cd
+--verbose sed cd done $(pwd) echo readonly sed grep x=1 echo $(pwd) then
+		test -eu x=1 --verbose -eu ${HOME} sed | sed -eu x=1 "$@" cd local printf local
+x=1 --verbose x=1 "$1" | printf sed -eu x=1 readonly awk readonly awk $(pwd) printf
+		cd grep test cd $(pwd) grep readonly grep readonly
+		/usr/bin -eu --verbose &&
+	export 'quoted text' "$1" then awk printf
+		--verbose done ${HOME} | x=1
+		readonly sed test 2>/dev/null
+	| local readonly --verbose cd && 2>/dev/null printf /usr/bin cd 2>/dev/null
+$(pwd) $(pwd) | awk done then grep cd /usr/bin --verbose ${HOME} 'quoted text'
+&& --verbose cd grep awk awk awk /usr/bin $(pwd) --verbose awk -eu "$@"
+	-eu done printf cd x=1 2>/dev/null ${HOME}
+		-eu 2>/dev/null printf | 2>/dev/null -eu | --verbose ${HOME} done 'quoted text'
+	readonly 'quoted text' x=1 x=1 sed | sed 2>/dev/null readonly /usr/bin
+	export test "$@" -eu "$1"
+2>/dev/null echo test ${HOME} test "$@" -eu sed 'quoted text'
+done "$@" then x=1 readonly $(pwd) /usr/bin readonly 2>/dev/null 'quoted text'
+		echo && then && sed awk --verbose then test then test 'quoted text'
+sed /usr/bin 2>/dev/null --verbose && 'quoted text' then -eu awk local export
+		"$@" done && printf local done "$1" | "$@" test --verbose "$1"
+	${HOME} sed "$@" | x=1 "$1" then readonly grep x=1 sed 'quoted text'
+echo grep grep done /usr/bin -eu
+awk export local printf grep grep $(pwd) cd sed sed x=1 local -eu "$@" printf
+	grep ${HOME} /usr/bin 'quoted text'
+--verbose printf echo ${HOME}
+2>/dev/null "$@" printf echo "$@" | readonly 2>/dev/null 'quoted text' "$1" ${HOME}
+		grep ${HOME} --verbose export then test | | then cd "$1" echo then
+grep grep then export 2>/dev/null x=1 ${HOME}
+	2>/dev/null && -eu echo 'quoted text' 'quoted text' awk grep
+awk -eu test "$1" ${HOME} echo test cd local /usr/bin
+x=1 grep x=1 echo -eu --verbose && awk test
+	echo | readonly "$1" -eu "$1" readonly
+		&& sed -eu x=1 readonly "$1" cd echo test -eu
+		"$@" sed then then $(pwd) cd cd cd readonly "$1" cd readonly
+test ${HOME} "$1" printf readonly --verbose local
+		"$@" /usr/bin export export x=1 test && /usr/bin sed export --verbose x=1 x=1
+		export | sed && done awk local "$1" test -eu done export readonly
+		local export -eu ${HOME}
+	readonly awk /usr/bin cd then --verbose then 'quoted text'
+"$@" ${HOME} readonly "$1" done | --verbose $(pwd) export
+	export readonly grep grep sed 2>/dev/null grep 2>/dev/null echo "$@" done
+local $(pwd) && cd done -eu grep done 'quoted text' | 2>/dev/null
+'quoted text' export done --verbose cd --verbose /usr/bin
+		-eu /usr/bin printf done awk && awk "$@"
+'quoted text' local awk
+	cd | export then done 2>/dev/null sed cd -eu printf grep readonly then local
+		awk $(pwd) done printf | --verbose --verbose |
+| readonly "$1" echo "$@" local
+grep $(pwd) 'quoted text' 'quoted text' $(pwd) done
+		done local -eu "$1" export x=1 awk grep printf
+		"$@" sed | cd readonly grep 'quoted text' --verbose
+	sed then grep "$1" cd awk && 'quoted text'
+-eu --verbose && && test "$1" -eu export 'quoted text' done /usr/bin "$1" 'quoted text'
+export | | 2>/dev/null done 2>/dev/null cd --verbose 'quoted text'
+		then ${HOME} -eu /usr/bin cd
+"$1" $(pwd) -eu "$@" -eu printf done ${HOME} "$1" sed
+		2>/dev/null grep cd x=1 "$1" echo 2>/dev/null readonly
+	test "$1" /usr/bin readonly readonly done done "$@" && $(pwd)
+--verbose 'quoted text' readonly |
+awk && sed --verbose $(pwd) done cd test echo done 2>/dev/null export grep grep
+	"$@" "$1" done x=1 -eu export
+&& x=1 printf cd readonly $(pwd) local
+$(pwd) -eu $(pwd) && $(pwd)
+/usr/bin 2>/dev/null cd grep
+		--verbose ${HOME} --verbose
+	"$@" test local $(pwd) grep ${HOME} local sed && cd 'quoted text' local x=1
+	done "$@" "$@" echo && awk /usr/bin export x=1 ${HOME} printf 'quoted text' then
+	&& ${HOME} grep 2>/dev/null && echo readonly local grep readonly echo sed
+	| done test readonly readonly sed
+	then && | 2>/dev/null 2>/dev/null
+	export 'quoted text' 2>/dev/null "$@"
+"$@" printf "$@" printf "$1" done 2>/dev/null cd | x=1 /usr/bin
+		awk "$1" awk test test | local ${HOME} && --verbose
+		done awk grep --verbose -eu then /usr/bin /usr/bin | then && 2>/dev/null sed $(pwd)
+	/usr/bin awk printf x=1 ${HOME} echo
+| -eu && done --verbose | "$@" --verbose x=1
+	grep -eu done 'quoted text' "$1" $(pwd) -eu grep done $(pwd) "$@" awk $(pwd)
+x=1 test awk /usr/bin export
+--verbose --verbose then --verbose test test 2>/dev/null --verbose local local readonly
+	echo && --verbose "$1" local test -eu 'quoted text'
+	$(pwd) readonly --verbose -eu then test then 2>/dev/null
+		'quoted text' 'quoted text' "$1"
+	done ${HOME} export done sed | "$@" $(pwd) printf 'quoted text'
+	printf /usr/bin 'quoted text' | ${HOME} grep x=1 awk && cd | $(pwd) printf $(pwd)
+	export $(pwd) export "$1" done x=1 export
+/usr/bin $(pwd) --verbose "$@" cd test readonly cd ${HOME} $(pwd) test test 'quoted text'
+		$(pwd) echo 2>/dev/null 2>/dev/null
+	&& done grep export $(pwd)
+	local | cd export printf local /usr/bin | local awk export 'quoted text'
+		/usr/bin done /usr/bin ${HOME} done export && then x=1 && x=1 x=1 ${HOME}
+readonly ${HOME} 'quoted text' then done export readonly sed 2>/dev/null
+	export awk && test 'quoted text' 2>/dev/null export printf 2>/dev/null
+	"$@" $(pwd) awk readonly sed local awk -eu &&
+	-eu export local echo echo "$@" sed 2>/dev/null cd 'quoted text' readonly
+	${HOME} && printf echo && $(pwd) readonly && test test awk 2>/dev/null 'quoted text'
+	readonly "$1" ${HOME} ${HOME}
+"$@" export && then readonly
+	local x=1 "$1" && "$@" done test "$@" test echo "$1"
+	done && test x=1 then sed printf
+		"$@" local export "$1" export export 'quoted text' grep x=1 'quoted text'
+		--verbose readonly sed
+| cd -eu cd done readonly local
+	grep local | ${HOME} export 2>/dev/null | echo /usr/bin sed && echo "$1"
+		"$1" readonly $(pwd) 'quoted text' x=1 && --verbose 2>/dev/null | /usr/bin
+	cd ${HOME} $(pwd) sed then $(pwd) | /usr/bin readonly -eu then | $(pwd) ${HOME}
+		sed awk readonly "$1" $(pwd) echo $(pwd) -eu 2>/dev/null
+	${HOME} && -eu grep cd sed | export grep done -eu awk readonly
+awk done local then printf local | "$@" |
+	${HOME} done | | "$@" local --verbose
+local "$@" | local && cd sed
+'quoted text' x=1 then | then cd test --verbose test cd && $(pwd)
+grep echo --verbose grep x=1 then grep --verbose -eu 'quoted text' readonly
+		echo awk "$1" -eu /usr/bin | /usr/bin 2>/dev/null test --verbose
+local $(pwd) 'quoted text' done ${HOME} printf
+	sed "$@" --verbose export
+		then /usr/bin && then x=1 export "$@" "$1" echo -eu /usr/bin
+echo $(pwd) --verbose grep then readonly 'quoted text' $(pwd)
+	readonly -eu printf 2>/dev/null ${HOME} echo printf
+	done printf echo -eu done -eu local readonly
+printf /usr/bin then sed
+		grep 'quoted text' grep test && sed printf /usr/bin "$@" printf grep awk
+	--verbose "$@" /usr/bin readonly then
+	'quoted text' printf -eu sed -eu
+| cd 2>/dev/null local --verbose
+		sed 'quoted text' --verbose echo readonly ${HOME} "$@" "$@" printf
+		2>/dev/null then 2>/dev/null --verbose
+x=1 $(pwd) sed sed x=1
+		'quoted text' readonly export test $(pwd) && ${HOME} then
+then echo ${HOME} "$1" --verbose grep sed awk grep
+		awk 2>/dev/null grep then grep | -eu awk ${HOME}
+	$(pwd) grep x=1 done && test 2>/dev/null x=1 | readonly awk
+	test grep then "$@" 2>/dev/null $(pwd) readonly "$@" done cd local sed test
+	--verbose x=1 "$@" "$1" awk -eu readonly echo -eu /usr/bin sed
+cd /usr/bin "$1" 'quoted text' | then printf $(pwd)
+cd grep 'quoted text' echo readonly
+${HOME} 2>/dev/null $(pwd) x=1 ${HOME} 'quoted text' cd -eu $(pwd) local
+	sed 'quoted text' done done awk cd
+	awk done ${HOME} grep test
+grep x=1 2>/dev/null then printf /usr/bin then sed "$1" | then "$1" grep "$@"
+		--verbose awk done && && grep
+/usr/bin "$@" test printf sed grep readonly x=1 sed cd
+2>/dev/null 'quoted text'
+	done --verbose && "$@" sed readonly grep awk
+-eu echo printf then && test $(pwd) test
+sed test test grep && then export printf /usr/bin
+	-eu 'quoted text' && -eu --verbose awk "$1" --verbose then
+	export /usr/bin readonly export then printf | awk sed echo ${HOME} x=1 "$@"
+		done -eu grep ${HOME} /usr/bin $(pwd) grep echo export "$1" awk --verbose
+	done | | "$@" sed $(pwd) 'quoted text' /usr/bin 'quoted text'
+		x=1 "$1" "$1" $(pwd) test readonly | "$1" echo printf
+	x=1 cd echo test grep /usr/bin "$@" done && /usr/bin && echo
+		awk sed printf --verbose $(pwd) awk ${HOME}
+printf --verbose awk $(pwd) x=1 readonly then export
+cd grep $(pwd) 2>/dev/null export 'quoted text' $(pwd) && export echo "$1"
+		-eu /usr/bin x=1 echo $(pwd) &&
+readonly "$1" | "$@" $(pwd) 2>/dev/null done sed test && /usr/bin local -eu grep
+	readonly grep ${HOME} -eu 2>/dev/null awk | sed export export
+	local "$1" /usr/bin readonly sed test sed && &&
+	awk cd test export echo then x=1 $(pwd)
+		readonly cd export "$@" export
+done 2>/dev/null awk x=1 cd grep then "$1" readonly 2>/dev/null
+test printf local readonly echo then then | printf ${HOME}
+	test "$@" x=1 -eu | "$@" -eu ${HOME} x=1 test && 'quoted text' readonly
+/usr/bin sed ${HOME} done printf then /usr/bin | then 2>/dev/null
+	${HOME} $(pwd) "$@" | "$@" echo awk "$1" export
+		--verbose $(pwd) ${HOME} -eu local $(pwd) $(pwd) cd
+	printf printf readonly --verbose
+sed 2>/dev/null "$1" --verbose local 2>/dev/null 2>/dev/null /usr/bin
+	--verbose "$@" | && x=1 awk $(pwd) $(pwd) 'quoted text'
+	sed echo /usr/bin grep printf
+	awk then echo && local --verbose
+2>/dev/null readonly "$1" cd --verbose readonly $(pwd) | /usr/bin
+test x=1 $(pwd) ${HOME} 'quoted text' "$@" --verbose
+$(pwd) sed && done | /usr/bin ${HOME} && -eu
+	then 'quoted text' local printf readonly echo ${HOME} 'quoted text'
+		$(pwd) 'quoted text' 2>/dev/null test done
+		${HOME} test /usr/bin grep echo readonly printf ${HOME}
+	awk && done ${HOME} cd -eu $(pwd) export
+sed "$1" export sed then | 'quoted text' export $(pwd)
+		| sed export local awk x=1 | 2>/dev/null printf test test awk
+	"$1" 2>/dev/null grep "$@" grep -eu 'quoted text' sed 2>/dev/null
+	test /usr/bin test then -eu done x=1 | "$1" -eu cd && printf done printf
+	grep "$@" 'quoted text' /usr/bin then x=1 readonly 'quoted text'
+${HOME} local --verbose local local 'quoted text' 2>/dev/null
+cd echo export export "$@" && x=1 cd echo
+		test grep $(pwd) $(pwd) echo awk printf then | --verbose "$@" ${HOME} -eu &&
+	readonly x=1 "$@" test -eu test | readonly -eu test echo -eu | sed /usr/bin
+	2>/dev/null echo 2>/dev/null grep readonly x=1
+2>/dev/null x=1 readonly awk cd 2>/dev/null -eu | 2>/dev/null
+		-eu then /usr/bin cd -eu readonly readonly
+-eu echo readonly /usr/bin then -eu echo -eu ${HOME}
+		awk "$@" printf readonly 'quoted text'
+'quoted text' sed awk /usr/bin
+	x=1 "$1" x=1 local printf sed 2>/dev/null test | sed readonly -eu x=1 && awk "$@"
+${HOME} grep cd export /usr/bin readonly readonly done
+		awk done echo x=1 && ${HOME} printf export ${HOME} 'quoted text' done
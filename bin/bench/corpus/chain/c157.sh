@@ -0,0 +1,2001 @@
+		grep export /usr/bin 'quoted text' /usr/bin | awk
+	awk && awk x=1 sed /usr/bin local && --verbose x=1 -eu ${HOME} test
+grep 'quoted text' printf --verbose
+grep export test "$1" x=1 | test ${HOME} grep ${HOME} then -eu --verbose x=1 readonly
+		--verbose sed then done "$1"
+		cd grep test "$@" && export then
+		test cd awk "$@" "$1" readonly $(pwd) --verbose "$1" "$1" readonly -eu test
+	sed then "$@" test x=1 readonly
+| -eu x=1 local awk export export -eu --verbose
+		${HOME} x=1 'quoted text' test x=1 2>/dev/null then
+		done | cd export | export then printf -eu /usr/bin done "$1" test "$@" readonly
+	'quoted text' sed cd && && x=1 cd --verbose echo awk ${HOME}
+	readonly printf export done then x=1 2>/dev/null x=1 readonly $(pwd) -eu /usr/bin
+	printf && sed awk $(pwd)
+	local awk cd /usr/bin x=1 ${HOME} printf awk $(pwd) then
+		readonly done done && 2>/dev/null sed local sed 'quoted text' x=1 && && /usr/bin
+	/usr/bin readonly test 2>/dev/null
+grep && $(pwd) 'quoted text'
+		2>/dev/null -eu "$@" "$@" $(pwd) local ${HOME} cd
+		echo printf /usr/bin 'quoted text' "$@" && | 'quoted text' done local
+	echo | 'quoted text' sed
+echo then cd /usr/bin
+	2>/dev/null readonly sed printf then && 2>/dev/null
+	&& && then echo test awk "$1" | ${HOME}
+	echo sed echo cd grep echo |
+printf -eu -eu $(pwd) 2>/dev/null $(pwd) $(pwd)
+		then -eu $(pwd) then --verbose
+	| export test /usr/bin export $(pwd) then --verbose export -eu cd echo /usr/bin
+		"$1" done grep -eu --verbose
+echo && ${HOME} sed local readonly -eu awk
+test grep local readonly 2>/dev/null grep sed --verbose
+		export cd ${HOME} readonly
+	printf awk export echo --verbose export local export awk cd $(pwd) done x=1
+		| done | done 'quoted text' cd -eu "$1" done /usr/bin local
+		"$1" "$@" --verbose local $(pwd) $(pwd) cd 'quoted text'
+	-eu 2>/dev/null awk 2>/dev/null &&
+	cd grep 'quoted text' awk /usr/bin sed test
+	sed 'quoted text' --verbose echo awk x=1 local --verbose
+		x=1 readonly readonly 2>/dev/null
+--verbose "$1" $(pwd) -eu printf | && printf && done awk "$@"
+	grep 2>/dev/null readonly /usr/bin $(pwd) 'quoted text' x=1 echo
+2>/dev/null --verbose && --verbose done 2>/dev/null x=1 && cd cd grep cd ${HOME}
+| export x=1 ${HOME} && printf --verbose printf "$1" done cd "$1" printf
+		printf test && | cd local grep 'quoted text' | readonly cd printf
+-eu export awk sed --verbose then printf cd -eu -eu
+		'quoted text' -eu test 2>/dev/null readonly 2>/dev/null readonly
+		${HOME} printf | printf readonly export cd done
+	&& cd awk && 2>/dev/null echo local then cd x=1 -eu echo sed ${HOME} then x=1 "$1"
+		export "$@" ${HOME} && export awk 2>/dev/null echo
+/usr/bin "$@" echo ${HOME} then awk then x=1 --verbose grep
+		test x=1 && && echo $(pwd) 'quoted text' local
+	readonly then done 2>/dev/null ${HOME} /usr/bin
+		export local cd grep 2>/dev/null
+		export awk "$@" /usr/bin -eu ${HOME} readonly
+		$(pwd) done $(pwd) -eu --verbose
+	done then $(pwd) 2>/dev/null awk sed ${HOME} echo echo && readonly
+		echo 2>/dev/null x=1 ${HOME} | cd $(pwd) test "$1"
+		then local awk then test -eu sed export readonly | readonly
+	$(pwd) cd printf && "$@" "$@" readonly export grep $(pwd) ${HOME} local "$@"
+	2>/dev/null "$1" test ${HOME} printf -eu
+	x=1 grep readonly done test -eu /usr/bin test export
+		-eu local readonly | awk 2>/dev/null
+		| cd then sed export export awk "$1" /usr/bin printf --verbose
+	2>/dev/null -eu export "$1" $(pwd) 'quoted text' readonly --verbose
+		printf && then x=1 | "$1"
+	--verbose sed awk 'quoted text' "$@" echo sed 2>/dev/null /usr/bin $(pwd) /usr/bin
+	&& 2>/dev/null x=1 x=1 --verbose
+		readonly "$1" "$1" | awk then export ${HOME} $(pwd) cd test
+		'quoted text' readonly /usr/bin x=1 --verbose printf
+	/usr/bin cd $(pwd) $(pwd) then --verbose then 2>/dev/null "$1" $(pwd)
+	x=1 export ${HOME} readonly
+		--verbose local | 'quoted text' export readonly done printf /usr/bin 2>/dev/null
+	test /usr/bin grep && sed -eu ${HOME} grep awk done cd x=1 2>/dev/null /usr/bin
+"$1" 'quoted text' local --verbose grep readonly $(pwd) /usr/bin $(pwd) 'quoted text'
+		2>/dev/null test -eu cd x=1 done ${HOME} local
+then $(pwd) grep $(pwd) | cd $(pwd) test --verbose
+	"$1" grep && 'quoted text' ${HOME} test "$1" awk
+	"$1" done ${HOME} printf | sed | "$@" sed grep sed | local
+local | echo "$@" readonly then test local local --verbose && awk
+2>/dev/null "$@" "$@" cd export
+local --verbose readonly --verbose readonly "$@" printf
+	done sed && test test then $(pwd)
+&& 2>/dev/null "$1" readonly
+		cd 'quoted text' x=1 'quoted text'
+		x=1 echo then x=1 2>/dev/null cd cd "$1" 'quoted text' | sed 'quoted text'
+		'quoted text' 2>/dev/null done sed test then 2>/dev/null x=1
+		echo $(pwd) $(pwd) --verbose ${HOME} && && /usr/bin $(pwd)
+grep export --verbose /usr/bin
+		&& /usr/bin ${HOME} done awk test | 'quoted text' 'quoted text'
+		| local --verbose awk 2>/dev/null "$@" export
+	/usr/bin /usr/bin | && then cd done
+x=1 printf && | "$@" echo then $(pwd)
+		'quoted text' 2>/dev/null grep ${HOME} "$1" test done export --verbose
+	2>/dev/null cd "$@" sed grep -eu local
+local cd echo local && awk echo echo
+		then && $(pwd) sed "$@" 2>/dev/null cd local
+	x=1 && cd /usr/bin readonly test awk $(pwd) --verbose --verbose local local
+readonly | printf $(pwd) x=1 local test
+		test awk done readonly local -eu -eu | then done done printf
+		--verbose done test local sed then --verbose
+	'quoted text' "$@" readonly cd 2>/dev/null 'quoted text' printf done ${HOME}
+sed | 2>/dev/null awk sed readonly echo /usr/bin
+grep export --verbose "$@" 2>/dev/null "$@" && &&
+		then 'quoted text' --verbose
+		'quoted text' local "$1"
+		x=1 $(pwd) | && printf /usr/bin "$1" | readonly
+		done readonly --verbose then "$1" done | x=1 cd 'quoted text'
+		-eu printf 2>/dev/null grep ${HOME} 'quoted text' echo echo then --verbose
+echo "$1" $(pwd) 'quoted text'
+		printf 2>/dev/null && done awk printf cd $(pwd) 2>/dev/null readonly
+		export --verbose then echo awk "$@" | /usr/bin
+test test sed ${HOME} export awk cd done "$1" local then
+	awk ${HOME} export && $(pwd) test x=1 local ${HOME}
+&& | then local && test printf x=1 2>/dev/null 2>/dev/null
+readonly "$1" "$1" x=1 "$1"
+	&& ${HOME} export "$@" printf $(pwd) local printf printf cd
+	sed export && ${HOME} sed echo readonly /usr/bin
+		export "$1" readonly $(pwd) $(pwd) done
+		"$@" /usr/bin | "$@" echo test
+		sed -eu echo awk "$@" cd then
+		${HOME} "$1" | local then x=1 sed --verbose then "$@" local "$1"
+		"$@" "$1" awk "$1" 2>/dev/null
+		grep local "$1" local && --verbose readonly -eu 'quoted text' "$@" cd "$@" /usr/bin
+	test readonly export export printf ${HOME} -eu -eu "$1" ${HOME}
+	x=1 ${HOME} export ${HOME} x=1 cd | local -eu
+		then echo 'quoted text' awk awk sed printf /usr/bin 'quoted text'
+local --verbose test sed sed 'quoted text'
+	done 2>/dev/null /usr/bin --verbose sed --verbose then export cd echo echo ${HOME}
+x=1 x=1 ${HOME} && 'quoted text' then test test
+		export && printf printf 'quoted text' "$1" "$@" $(pwd) awk "$1" local
+		done 2>/dev/null grep 'quoted text'
+	-eu "$@" export echo x=1 done -eu -eu local 'quoted text' export then $(pwd)
+		/usr/bin grep printf ${HOME} awk -eu
+		'quoted text' && local test /usr/bin readonly local
+	${HOME} readonly printf test /usr/bin && test 2>/dev/null sed "$@"
+done --verbose test cd -eu && sed | readonly && sed 2>/dev/null $(pwd)
+		awk export "$1" -eu ${HOME} "$@" done ${HOME} /usr/bin export local local
+cd then /usr/bin 2>/dev/null awk then
+		echo 2>/dev/null grep 'quoted text'
+		2>/dev/null --verbose then
+"$1" | grep export "$@" -eu done "$@"
+		'quoted text' sed printf | && awk test x=1 done
+		"$1" x=1 ${HOME} x=1 grep then && | local local awk then awk
+	"$@" then awk 2>/dev/null
+printf sed test printf ${HOME} 'quoted text'
+test ${HOME} echo "$1" "$@" && grep 'quoted text' x=1 done sed ${HOME}
+	then x=1 x=1 awk printf then --verbose awk test
+	echo local 2>/dev/null "$1" export then "$1" cd 'quoted text' ${HOME} $(pwd) export
+		echo 'quoted text' && "$@" | export test 2>/dev/null export $(pwd)
+		then /usr/bin ${HOME} test "$1" "$@" readonly
+grep awk sed export sed | $(pwd) echo | test 2>/dev/null
+	-eu awk printf done done sed grep cd awk cd "$@" export 2>/dev/null "$1" awk
+	| readonly done ${HOME} "$@" /usr/bin done "$1" grep 2>/dev/null
+		grep awk "$@" export readonly
+	"$1" local export -eu | "$1" then | readonly -eu sed --verbose
+		grep --verbose --verbose ${HOME} --verbose "$@"
+		echo ${HOME} x=1 && test printf /usr/bin awk | test readonly 'quoted text'
+	grep ${HOME} && printf readonly ${HOME} cd test | "$1" echo done test $(pwd) 2>/dev/null
+	--verbose 2>/dev/null x=1 "$1" printf | awk
+readonly readonly --verbose
+$(pwd) /usr/bin readonly 'quoted text' done
+		sed ${HOME} printf | 2>/dev/null readonly ${HOME} "$@" --verbose grep
+| | grep test echo export cd local
+		"$@" cd 2>/dev/null export grep "$1" cd export | "$@" --verbose
+'quoted text' /usr/bin then 'quoted text' done /usr/bin x=1 then
+local && cd "$@" --verbose "$@" export
+awk --verbose "$@" ${HOME} --verbose readonly sed done -eu awk
+$(pwd) ${HOME} /usr/bin && x=1 | awk && printf 'quoted text' done $(pwd)
+2>/dev/null --verbose x=1 -eu grep cd $(pwd) echo echo awk awk && &&
+${HOME} "$1" grep 2>/dev/null ${HOME} sed local 'quoted text'
+	cd echo awk cd sed echo cd /usr/bin "$1" x=1 grep done sed && "$@" grep cd done
+	-eu cd awk cd "$@" -eu /usr/bin "$1" sed
+		local printf echo /usr/bin x=1 echo | "$@"
+test printf local -eu $(pwd) echo --verbose /usr/bin "$1"
+		$(pwd) $(pwd) | export test awk local ${HOME}
+	local $(pwd) readonly cd then
+sed /usr/bin | && readonly printf echo $(pwd) --verbose | 2>/dev/null
+		local grep cd grep && echo cd -eu echo
+'quoted text' -eu 'quoted text' then x=1 grep printf done ${HOME}
+		readonly echo /usr/bin done done then $(pwd) && cd export printf --verbose
+	local -eu export then done 2>/dev/null echo 2>/dev/null
+grep "$@" cd && && readonly --verbose awk | "$@" local
+	cd 'quoted text' test 2>/dev/null printf awk test $(pwd) ${HOME} printf --verbose
+		/usr/bin awk -eu -eu ${HOME} grep $(pwd) grep test /usr/bin printf grep
+	export 'quoted text' $(pwd) grep && local export
+done printf 'quoted text' printf echo grep "$@" awk |
+-eu 'quoted text' /usr/bin 2>/dev/null 2>/dev/null
+	echo --verbose local $(pwd) 2>/dev/null "$@" && -eu 2>/dev/null "$1"
+	then awk then export test | printf done -eu echo
+	'quoted text' "$1" | printf
+	-eu echo ${HOME} 2>/dev/null test then && 2>/dev/null test "$1" ${HOME}
+-eu | "$1" done then test 'quoted text' printf echo --verbose "$1" test --verbose
+		--verbose | cd | --verbose && echo
+	readonly "$@" "$1" "$@" readonly local x=1 sed --verbose
+printf awk done | export echo readonly --verbose
+local then then --verbose "$1" then 2>/dev/null
+grep -eu 2>/dev/null ${HOME} /usr/bin printf test | && --verbose printf cd --verbose
+		test local && export /usr/bin "$1"
+		x=1 "$@" --verbose cd export awk /usr/bin &&
+	test local done /usr/bin done -eu awk "$1" test 2>/dev/null ${HOME} /usr/bin
+		export readonly "$@"
+awk x=1 sed cd "$1" awk export
+		echo $(pwd) "$1" x=1 x=1 printf -eu "$@" done
+awk awk -eu sed 'quoted text' printf test 'quoted text' $(pwd) done export local
+	2>/dev/null then && -eu sed cd -eu then cd grep local printf
+	$(pwd) done && --verbose echo sed then x=1 done --verbose readonly
+'quoted text' 'quoted text' ${HOME} $(pwd)
+'quoted text' "$@" /usr/bin printf readonly ${HOME}
+		readonly /usr/bin printf cd grep x=1 cd echo 2>/dev/null 'quoted text'
+	local sed ${HOME} | cd -eu printf grep "$1" "$1" $(pwd) readonly export
+-eu export "$@" grep export $(pwd) local | readonly cd ${HOME} readonly then then
+		local $(pwd) then 'quoted text' /usr/bin printf --verbose export grep "$1" "$@"
+		echo awk /usr/bin readonly x=1 sed printf awk then echo export ${HOME} sed printf
+/usr/bin x=1 $(pwd) cd grep export
+	| local && && export done then --verbose
+	--verbose done echo sed
+/usr/bin then --verbose ${HOME} "$@" 2>/dev/null test ${HOME}
+	sed --verbose cd local awk --verbose ${HOME} 2>/dev/null "$1" echo then awk
+	test -eu && readonly | 'quoted text' 2>/dev/null readonly
+		local cd /usr/bin cd /usr/bin /usr/bin readonly
+--verbose $(pwd) ${HOME} printf
+		--verbose sed local "$1" printf 'quoted text'
+then done | then cd grep "$@" -eu sed 2>/dev/null ${HOME}
+${HOME} ${HOME} awk sed local cd /usr/bin
+done 'quoted text' export sed ${HOME} awk local
+awk --verbose "$@" awk cd local done sed
+export awk 'quoted text' export
+		$(pwd) 2>/dev/null x=1 echo sed printf
+awk test printf done /usr/bin 'quoted text'
+		printf && -eu $(pwd) local 2>/dev/null grep 'quoted text' $(pwd) readonly
+	$(pwd) "$@" /usr/bin printf
+	/usr/bin local x=1 "$1" awk local /usr/bin && 2>/dev/null readonly
+'quoted text' then local awk --verbose | then --verbose $(pwd) 'quoted text'
+	grep local x=1 test echo ${HOME}
+${HOME} && done export ${HOME} sed
+x=1 "$@" sed local grep
+$(pwd) | /usr/bin test --verbose
+		cd /usr/bin done cd test | | readonly export
+		echo test 2>/dev/null x=1 'quoted text' readonly readonly /usr/bin "$@" && echo
+		$(pwd) -eu $(pwd) | x=1 --verbose 'quoted text' "$@" echo
+/usr/bin cd ${HOME} echo then x=1 'quoted text' cd $(pwd) cd | ${HOME}
+	/usr/bin sed 2>/dev/null printf /usr/bin "$1" /usr/bin "$1"
+/usr/bin printf -eu "$@" /usr/bin printf && --verbose cd --verbose
+	-eu /usr/bin "$@" local "$@" echo then | "$1" && -eu $(pwd) "$1" test done
+--verbose 2>/dev/null $(pwd) echo readonly
+		2>/dev/null /usr/bin printf sed /usr/bin | ${HOME}
+sed grep "$1" x=1 printf test echo "$@" readonly
+		printf cd ${HOME} /usr/bin done | then
+-eu 'quoted text' 'quoted text' && ${HOME} && local
+-eu readonly then local ${HOME} | ${HOME} --verbose
+	| "$@" local printf "$1" | export "$@" /usr/bin -eu $(pwd) sed then
+	export 'quoted text' cd x=1 awk
+	&& echo "$@" test echo && sed awk 'quoted text' x=1 cd 2>/dev/null
+		x=1 "$@" printf -eu 'quoted text'
+local "$@" local sed printf printf awk /usr/bin then x=1 -eu
+	cd grep -eu sed test 2>/dev/null $(pwd) printf awk grep && printf
+		cd cd $(pwd) "$@" /usr/bin -eu printf
+		test --verbose then done test printf -eu local readonly then "$1"
+		"$1" echo && awk --verbose sed done && $(pwd) grep test test then
+	printf /usr/bin export -eu then test "$1" 2>/dev/null "$1" && ${HOME} export
+		/usr/bin --verbose "$1" 'quoted text' x=1 sed local grep awk -eu readonly
+	'quoted text' 'quoted text' cd
+| x=1 -eu 'quoted text' local
+cd echo done "$@" grep "$@" 'quoted text' 2>/dev/null
+cd sed done && | -eu readonly sed ${HOME} echo local --verbose sed sed grep
+	readonly 2>/dev/null awk
+		local -eu --verbose | awk export printf --verbose
+		then "$1" then /usr/bin "$@" "$@" then grep $(pwd) /usr/bin test /usr/bin
+	"$@" readonly x=1 then 'quoted text'
+	--verbose 'quoted text' awk /usr/bin
+		done | x=1 printf test 'quoted text' then local "$1" echo awk export cd 2>/dev/null
+	$(pwd) grep "$@" /usr/bin && --verbose
+export grep export -eu && test cd 2>/dev/null
+	export export 2>/dev/null echo printf 2>/dev/null done $(pwd) done
+/usr/bin 2>/dev/null /usr/bin export $(pwd) printf | then export
+		'quoted text' export cd then $(pwd) sed && then /usr/bin local
+		$(pwd) && then then readonly printf -eu ${HOME}
+		echo "$1" cd cd echo -eu $(pwd) | | -eu -eu 'quoted text' /usr/bin "$1"
+		awk then /usr/bin x=1 printf /usr/bin
+readonly local -eu printf awk grep
+	--verbose sed 2>/dev/null "$1" echo 2>/dev/null then grep -eu printf sed
+		"$@" --verbose /usr/bin
+grep | 2>/dev/null grep cd printf sed -eu $(pwd) 'quoted text'
+	&& | test done 'quoted text' cd export grep 'quoted text' echo $(pwd) awk
+printf 2>/dev/null "$@" | $(pwd) local | -eu grep grep awk && test $(pwd)
+		sed sed readonly "$@" --verbose
+done $(pwd) -eu printf x=1 /usr/bin /usr/bin export awk then --verbose
+	done local printf readonly echo
+		-eu sed awk ${HOME} test cd && "$@" awk 'quoted text'
+		-eu awk echo 'quoted text' then then 2>/dev/null done --verbose x=1
+x=1 awk ${HOME} awk --verbose export 'quoted text'
+	awk test cd 'quoted text' printf then then ${HOME} ${HOME}
+printf && 'quoted text' --verbose "$@" 'quoted text' local -eu sed --verbose --verbose
+	test cd "$@" -eu /usr/bin
+	export --verbose local 2>/dev/null
+| done "$@" --verbose test /usr/bin local local
+		test test && 2>/dev/null then x=1 test local test "$1" readonly "$@"
+2>/dev/null export $(pwd) 'quoted text'
+	cd grep local export 'quoted text' && 2>/dev/null
+		-eu x=1 && ${HOME} /usr/bin then export echo "$@" "$@" /usr/bin export
+"$@" cd | readonly ${HOME} ${HOME} 'quoted text' --verbose
+	sed cd local $(pwd) 'quoted text' awk local --verbose ${HOME}
+printf "$@" local done | echo
+		| done 'quoted text' "$@" --verbose
+"$1" --verbose done "$@" --verbose x=1 test
+| export printf && readonly awk readonly
+		"$1" cd sed $(pwd) readonly printf && | ${HOME} ${HOME}
+readonly x=1 "$1" $(pwd) x=1 | printf ${HOME} sed 'quoted text' --verbose
+test 'quoted text' cd readonly && test printf
+		grep | && x=1 done | local done sed x=1 "$1" 2>/dev/null
+	sed "$@" -eu --verbose 'quoted text' x=1 echo grep 'quoted text'
+	then "$@" grep $(pwd) cd x=1 && --verbose "$1" grep
+		echo "$1" then -eu grep "$@" then x=1 export
+2>/dev/null $(pwd) "$@" then "$@" grep awk ${HOME}
+/usr/bin cd awk sed 'quoted text' test $(pwd) -eu done awk 2>/dev/null
+cd $(pwd) "$1" then && test awk printf && "$1" printf readonly awk
+		then echo test sed ${HOME} -eu 'quoted text' test export awk "$@" -eu
+&& then readonly test 'quoted text' echo 2>/dev/null
+	readonly /usr/bin -eu x=1 'quoted text'
+		sed "$1" $(pwd) $(pwd) then grep ${HOME} done awk test
+		done awk "$1" "$1" echo done 'quoted text'
+	"$@" | grep | readonly readonly
+		test echo done && --verbose done
+awk x=1 | 'quoted text' "$1"
+	test echo then | | -eu /usr/bin
+	2>/dev/null done "$@" grep printf printf
+		-eu sed -eu 'quoted text' x=1 sed -eu test printf echo
+	&& done test | test cd 2>/dev/null -eu 2>/dev/null echo x=1
+done done test && test && cd done readonly cd $(pwd)
+	--verbose | "$@" test x=1 printf
+--verbose 2>/dev/null export then test
+		echo ${HOME} printf 'quoted text' &&
+sed echo echo --verbose --verbose done awk printf "$@" done 'quoted text'
+test x=1 /usr/bin ${HOME} test
+		$(pwd) readonly "$1" ${HOME} "$1" cd "$@"
+		readonly | $(pwd) test test sed grep | done
+	$(pwd) export sed printf test 2>/dev/null $(pwd) test printf echo ${HOME}
+	local done 'quoted text' $(pwd)
+readonly --verbose | $(pwd) cd "$1" ${HOME} readonly cd
+		-eu echo export 'quoted text' --verbose "$1" then grep x=1 sed then
+	sed cd printf echo 'quoted text' echo sed --verbose done grep
+		${HOME} | readonly cd -eu done "$1" printf /usr/bin grep printf
+	awk 2>/dev/null "$1" test then awk readonly --verbose test readonly sed
+	awk readonly "$@" && x=1 'quoted text' --verbose readonly "$@" $(pwd) cd echo "$@"
+	x=1 $(pwd) cd $(pwd) export printf
+cd then echo cd readonly sed &&
+		'quoted text' done $(pwd) sed "$1"
+| sed | sed local test printf done export local test then local $(pwd)
+		${HOME} test sed $(pwd) 2>/dev/null awk export printf | --verbose --verbose
+		grep && && then "$@" $(pwd) then $(pwd) test 'quoted text'
+	"$@" ${HOME} && x=1 "$1" "$1" | grep ${HOME} printf printf awk echo "$@" done
+	&& --verbose test /usr/bin 2>/dev/null echo -eu
+done | /usr/bin $(pwd) echo test printf echo "$@"
+	done echo cd cd sed local printf
+	test then -eu 2>/dev/null -eu 2>/dev/null
+		test cd ${HOME} grep && --verbose 'quoted text'
+	sed | x=1 printf export "$1"
+		printf test | x=1 test awk 'quoted text' | echo
+	done "$@" export readonly "$@" sed done export test $(pwd) "$@" sed "$1"
+"$@" awk "$@" export readonly export printf
+		x=1 readonly grep test readonly then echo export grep sed cd local "$1"
+2>/dev/null test printf x=1 readonly echo done sed printf
+		echo echo readonly -eu awk awk 2>/dev/null
+		x=1 grep local cd awk echo export /usr/bin awk sed test && 2>/dev/null
+		cd 2>/dev/null "$@" --verbose && $(pwd) test x=1 grep sed /usr/bin
+&& sed $(pwd) local /usr/bin export echo test sed echo sed awk
+	echo 2>/dev/null done 'quoted text'
+		echo sed | export x=1 'quoted text' -eu && $(pwd)
+		readonly /usr/bin printf sed "$1" "$1" local
+awk sed "$@" echo export "$@" printf local ${HOME} ${HOME} "$@" done
+cd x=1 | "$@" readonly $(pwd) x=1 x=1 then --verbose cd x=1 -eu -eu grep x=1 awk
+| awk /usr/bin done --verbose then then 2>/dev/null local
+	sed done awk local 'quoted text' test /usr/bin
+sed then readonly -eu "$@" "$@" x=1
+		"$1" sed /usr/bin grep cd x=1 then echo sed $(pwd)
+	local | echo echo --verbose test --verbose | 'quoted text'
+		x=1 grep ${HOME} && test
+	then cd cd "$@" then $(pwd) x=1 'quoted text' cd printf
+printf && $(pwd) readonly ${HOME} 'quoted text' done --verbose then
+	cd cd echo x=1 ${HOME} echo "$@" $(pwd) 2>/dev/null awk -eu
+/usr/bin export printf test
+		export sed 2>/dev/null x=1 then awk grep "$1" /usr/bin echo && printf
+echo export "$1" x=1 'quoted text' $(pwd) "$@" awk
+		test 2>/dev/null /usr/bin cd cd local ${HOME} $(pwd) cd then "$1"
+/usr/bin --verbose readonly
+	"$@" "$1" test cd printf 'quoted text' && sed
+${HOME} done echo 'quoted text' &&
+		x=1 --verbose ${HOME} 2>/dev/null x=1 x=1
+		grep /usr/bin -eu sed grep cd
+		done readonly ${HOME} cd grep readonly "$@" done grep test x=1 /usr/bin sed
+/usr/bin export "$@" "$1" ${HOME}
+		x=1 test echo x=1 "$@" $(pwd)
+"$@" ${HOME} 2>/dev/null ${HOME} local local ${HOME} local | echo
+		sed -eu -eu -eu | awk printf awk --verbose readonly
+		export grep readonly 'quoted text' echo cd 'quoted text' 2>/dev/null
+/usr/bin | && ${HOME} done
+$(pwd) done $(pwd) done grep test x=1 -eu cd
+printf ${HOME} export x=1 $(pwd) done readonly
+x=1 done cd printf 2>/dev/null then export -eu
+	printf "$1" grep local --verbose "$1" ${HOME} cd --verbose readonly
+	done local test "$1" 2>/dev/null export
+sed 2>/dev/null then | cd && 2>/dev/null export export
+awk done /usr/bin "$1" awk done test grep then local sed
+sed grep "$1" test grep -eu
+		"$@" local sed 2>/dev/null done then test then local && --verbose grep
+2>/dev/null grep sed readonly
+	cd printf ${HOME} "$1"
+/usr/bin --verbose ${HOME}
+then done --verbose printf sed ${HOME} cd ${HOME}
+"$@" cd --verbose local echo
+	readonly | /usr/bin && x=1 awk printf done /usr/bin
+	2>/dev/null | echo --verbose &&
+		2>/dev/null ${HOME} local
+/usr/bin cd "$@" "$1" sed
+cd x=1 "$1" sed cd done $(pwd) ${HOME} sed ${HOME}
+local done | export export printf | done local -eu printf | export export export
+		-eu x=1 && $(pwd) done export "$1" done /usr/bin grep cd local
+"$1" readonly 2>/dev/null x=1 | ${HOME} echo
+${HOME} --verbose printf grep "$1" 2>/dev/null sed local
+		grep 2>/dev/null echo /usr/bin then "$@" --verbose ${HOME} --verbose readonly
+/usr/bin done grep awk x=1
+		readonly 2>/dev/null local cd "$@" test test cd awk --verbose awk
+		grep awk local cd "$@" "$@" then | local
+test local test "$1" cd echo done grep 2>/dev/null -eu ${HOME} 'quoted text'
+then 'quoted text' $(pwd) $(pwd) then 2>/dev/null echo x=1 --verbose echo
+/usr/bin grep awk printf awk
+local printf --verbose done readonly printf && | "$@"
+2>/dev/null x=1 readonly -eu 'quoted text'
+	done local $(pwd) 2>/dev/null cd done $(pwd) /usr/bin --verbose 2>/dev/null
+		export -eu | test printf local -eu /usr/bin ${HOME} readonly |
+awk grep --verbose -eu 2>/dev/null ${HOME} done awk && grep done
+		"$1" | | then /usr/bin grep done
+echo printf $(pwd) | | grep "$@" test -eu cd x=1 printf
+	/usr/bin export 2>/dev/null "$@" ${HOME} test /usr/bin $(pwd) echo 2>/dev/null
+		"$1" 2>/dev/null "$@" x=1 "$1" printf done && && && "$@" x=1 awk
+/usr/bin && --verbose 'quoted text' echo 'quoted text'
+	${HOME} cd 2>/dev/null 2>/dev/null sed ${HOME} printf 'quoted text'
+${HOME} awk "$@" /usr/bin 2>/dev/null
+"$1" then local | test awk && "$1" $(pwd) then | /usr/bin $(pwd)
+	printf test $(pwd) cd /usr/bin echo x=1 printf --verbose export echo
+-eu sed readonly x=1 x=1 && "$@" cd then ${HOME}
+| local done 'quoted text' "$1"
+	"$1" /usr/bin && echo /usr/bin 'quoted text' --verbose test then
+		export "$1" printf grep readonly sed echo echo "$@" x=1 printf awk "$@"
+	echo --verbose 2>/dev/null awk local
+	2>/dev/null 2>/dev/null "$@" then cd
+		2>/dev/null then /usr/bin local "$@" echo -eu
+		| 2>/dev/null -eu cd -eu /usr/bin $(pwd) 2>/dev/null awk printf
+		/usr/bin -eu 2>/dev/null ${HOME} readonly printf -eu "$@" readonly test 2>/dev/null
+${HOME} test echo then -eu
+		2>/dev/null cd ${HOME} 'quoted text' "$1" -eu
+readonly /usr/bin -eu export test -eu grep echo -eu /usr/bin grep done
+	'quoted text' readonly done sed readonly 2>/dev/null cd done /usr/bin
+"$1" | | local ${HOME} "$@" grep
+	export /usr/bin 'quoted text' done 2>/dev/null then export sed done
+	-eu 'quoted text' ${HOME} done --verbose
+grep x=1 x=1 "$1" cd done
+		'quoted text' x=1 /usr/bin echo printf test test export done cd printf 'quoted text'
+		cd 2>/dev/null 2>/dev/null 2>/dev/null $(pwd) sed done 2>/dev/null 'quoted text'
+readonly sed cd done then export x=1 $(pwd) echo export -eu export "$1" ${HOME}
+		test echo echo /usr/bin ${HOME} 'quoted text' 'quoted text' then $(pwd)
+		echo export echo 'quoted text' "$1" -eu "$@" test x=1 "$1"
+"$@" -eu 2>/dev/null grep -eu ${HOME} export grep sed readonly --verbose
+"$1" export echo local --verbose 2>/dev/null
+$(pwd) echo echo 'quoted text' done -eu "$@" cd --verbose awk x=1 cd
+		awk 'quoted text' grep $(pwd) export ${HOME} printf
+		/usr/bin awk awk grep echo awk readonly /usr/bin
+		readonly local done test "$@" readonly sed ${HOME} | then echo /usr/bin
+cd done sed ${HOME} sed cd | "$@" x=1 export sed ${HOME} local cd grep export
+	grep sed /usr/bin echo /usr/bin sed ${HOME} && ${HOME}
+export done /usr/bin echo ${HOME} readonly "$1" /usr/bin
+		'quoted text' sed "$1" 'quoted text'
+	/usr/bin local printf local ${HOME} /usr/bin echo
+	| readonly echo ${HOME} readonly local "$@"
+test sed | cd test test
+		"$@" awk then --verbose | "$@" printf | -eu
+		then done printf printf export 'quoted text' 2>/dev/null
+		cd export $(pwd) export grep /usr/bin echo done --verbose
+		printf "$@" awk test test ${HOME} 2>/dev/null
+$(pwd) /usr/bin sed sed
+	grep | 2>/dev/null x=1 readonly $(pwd) sed
+	echo export -eu /usr/bin ${HOME} export 'quoted text' "$@"
+echo sed printf && -eu 'quoted text'
+		cd readonly /usr/bin then /usr/bin 2>/dev/null 'quoted text'
+grep local grep sed --verbose ${HOME} local readonly printf --verbose
+&& -eu test grep grep && awk cd 'quoted text' then then local "$1"
+	local awk test cd local && x=1 'quoted text' readonly x=1 sed
+		local --verbose cd sed 2>/dev/null test done "$@" printf grep
+	/usr/bin printf 'quoted text' readonly sed "$1" --verbose | /usr/bin
+		awk test then -eu printf "$1" "$1" test $(pwd) echo "$@" /usr/bin echo then test
+		&& 'quoted text' --verbose
+x=1 'quoted text' "$@" x=1 && sed sed grep
+x=1 && $(pwd) -eu "$1" local ${HOME} awk -eu
+-eu /usr/bin ${HOME} awk
+		printf ${HOME} test /usr/bin awk &&
+		"$1" /usr/bin $(pwd) readonly x=1 && grep export "$@" x=1 then cd sed sed 2>/dev/null
+printf cd 2>/dev/null x=1 printf readonly 2>/dev/null awk
+		2>/dev/null 2>/dev/null $(pwd) /usr/bin echo printf
+		"$1" done awk --verbose sed x=1 grep 'quoted text'
+readonly /usr/bin -eu -eu --verbose $(pwd)
+test --verbose x=1 readonly
+	| "$@" x=1 | cd | &&
+export sed then --verbose 2>/dev/null readonly cd grep $(pwd)
+cd done 'quoted text' /usr/bin "$@" done 'quoted text' | && readonly
+	grep local "$@" 'quoted text' awk 2>/dev/null export --verbose x=1 grep "$@"
+readonly 'quoted text' --verbose printf grep 2>/dev/null done export | /usr/bin
+	done /usr/bin "$1" grep test grep grep printf cd cd printf "$1" done
+	/usr/bin $(pwd) readonly awk export awk done
+	local ${HOME} ${HOME} | export 2>/dev/null
+		awk 'quoted text' --verbose export /usr/bin grep export /usr/bin
+		/usr/bin grep export echo sed echo then
+	-eu && x=1 x=1 echo export done awk test "$1" printf export readonly "$@" 'quoted text'
+	sed "$@" && && --verbose readonly printf
+	local printf grep 2>/dev/null done local echo then awk
+-eu cd /usr/bin test awk grep 'quoted text' 'quoted text'
+done $(pwd) "$@" export
+printf -eu x=1 $(pwd) printf local printf
+-eu "$@" -eu echo x=1
+	grep /usr/bin && printf then x=1 local -eu 'quoted text' then cd awk 2>/dev/null
+	awk | export -eu then 'quoted text' --verbose "$1" /usr/bin done && 'quoted text'
+		echo "$@" done --verbose && then printf then 2>/dev/null local
+		test && printf && sed "$@" | -eu
+	local --verbose sed --verbose cd cd test "$1" 'quoted text' ${HOME} echo
+		"$@" x=1 $(pwd) cd awk 2>/dev/null cd
+grep sed x=1 x=1 cd done printf readonly
+	2>/dev/null export export 'quoted text' | $(pwd) export
+	$(pwd) 'quoted text' --verbose local done local "$1" printf test then
+	cd local --verbose /usr/bin printf grep /usr/bin grep ${HOME}
+		grep cd && x=1 --verbose "$@" export done then | --verbose test local ${HOME}
+test /usr/bin $(pwd) | echo
+		export local /usr/bin --verbose local ${HOME}
+	test then $(pwd) printf "$@" then done cd | local done
+		${HOME} "$1" local 2>/dev/null test ${HOME} export x=1 && test 2>/dev/null
+		/usr/bin x=1 /usr/bin 'quoted text' local "$@" local cd awk echo grep ${HOME}
+		test | $(pwd) --verbose awk "$@" printf ${HOME} echo test x=1 then test
+	| "$1" readonly --verbose
+2>/dev/null readonly 2>/dev/null
+	cd "$1" x=1 "$1" | "$1" echo
+		sed 2>/dev/null then cd
+	cd && readonly | then done "$@" ${HOME} export export test
+	x=1 readonly then | export grep grep test /usr/bin
+	"$@" local done test sed grep
+	local done test "$1" grep grep "$1" ${HOME}
+	local grep then sed 2>/dev/null
+		grep ${HOME} done 2>/dev/null export echo $(pwd) -eu export test test
+-eu x=1 --verbose printf echo | -eu readonly
+	"$1" "$1" ${HOME} export readonly ${HOME} echo "$@" export readonly
+	awk "$1" --verbose --verbose -eu -eu "$1" done "$@" sed
+'quoted text' -eu test 2>/dev/null &&
+'quoted text' then "$@" $(pwd) test awk test readonly x=1 grep 2>/dev/null "$1"
+		echo then echo && 'quoted text' | sed $(pwd) printf echo 'quoted text'
+	"$@" | printf "$@" echo --verbose --verbose
+grep echo printf "$1" readonly echo sed awk 2>/dev/null && sed grep "$@" cd
+	readonly "$@" test "$1" 2>/dev/null sed -eu $(pwd)
+	| ${HOME} --verbose "$1" printf cd $(pwd) $(pwd) sed test "$1" sed
+	${HOME} 2>/dev/null x=1 'quoted text' /usr/bin grep "$1" local "$1"
+	local -eu grep export echo 'quoted text' 'quoted text' awk sed export
+		x=1 | export printf --verbose local $(pwd) /usr/bin readonly
+echo readonly ${HOME} --verbose ${HOME} then sed
+	2>/dev/null then grep
+		"$1" | awk test "$@" && "$1" local "$1"
+then awk $(pwd) 2>/dev/null --verbose ${HOME} printf echo 'quoted text'
+"$1" "$@" "$1" ${HOME} x=1 "$@" $(pwd) local 'quoted text'
+		${HOME} cd test --verbose | readonly grep /usr/bin grep | /usr/bin
+cd echo sed echo test export
+	test awk | /usr/bin local ${HOME}
+	readonly done ${HOME} 'quoted text' $(pwd) /usr/bin echo "$@" 2>/dev/null |
+export | cd "$@" && export
+/usr/bin awk "$1" sed test 'quoted text' awk x=1 readonly sed grep /usr/bin
+		echo --verbose "$@" -eu cd x=1
+-eu sed test $(pwd) x=1
+--verbose && test readonly
+readonly -eu $(pwd) --verbose x=1 -eu echo done readonly
+export awk done printf 2>/dev/null $(pwd) readonly done done | 'quoted text' done
+	$(pwd) export printf cd /usr/bin 2>/dev/null
+awk -eu readonly 2>/dev/null grep "$@" ${HOME} then
+	--verbose ${HOME} -eu --verbose $(pwd) -eu printf --verbose -eu done test /usr/bin
+	local /usr/bin x=1 export done 2>/dev/null test printf then printf "$1"
+	&& $(pwd) $(pwd) $(pwd) export 2>/dev/null cd --verbose
+	cd echo | --verbose $(pwd) --verbose printf $(pwd) sed
+	-eu -eu then 'quoted text' | 'quoted text' echo /usr/bin ${HOME}
+	then export /usr/bin "$1"
+done -eu printf x=1 /usr/bin cd grep cd cd awk 'quoted text'
+	/usr/bin 2>/dev/null readonly test x=1 done /usr/bin x=1
+		export | export /usr/bin $(pwd) printf /usr/bin /usr/bin echo printf
+sed readonly --verbose cd && ${HOME} "$@" 'quoted text' /usr/bin
+| ${HOME} echo then | local
+test test -eu done printf --verbose
+		done "$@" -eu "$1" grep printf "$1" done "$1" export
+echo grep -eu 'quoted text' | 'quoted text' sed && $(pwd)
+$(pwd) /usr/bin 2>/dev/null && $(pwd) sed done
+		'quoted text' | ${HOME} then | $(pwd) awk export $(pwd) -eu readonly
+		--verbose -eu "$@" done /usr/bin ${HOME}
+/usr/bin | -eu /usr/bin local /usr/bin awk awk "$@" "$@" 'quoted text' /usr/bin
+	x=1 2>/dev/null cd /usr/bin local sed --verbose
+local local printf 2>/dev/null "$@" test then $(pwd) then
+	&& 'quoted text' awk 2>/dev/null 2>/dev/null $(pwd) /usr/bin "$1" export then
+echo sed && --verbose export sed
+		| cd local export --verbose $(pwd) test printf "$1" printf x=1 && "$1"
+		grep && ${HOME} done export grep awk printf $(pwd) && awk awk $(pwd)
+		&& "$@" && "$1" sed printf x=1 | 2>/dev/null
+		local "$1" "$@" x=1 "$@" local 2>/dev/null then printf echo $(pwd) x=1 done
+		$(pwd) local x=1 grep local echo readonly done then && printf done grep 'quoted text'
+&& test done awk cd grep "$@" cd grep cd test
+		grep done export x=1 export printf --verbose sed done
+local export export done "$1" "$@" "$@" | 2>/dev/null awk /usr/bin done readonly
+		cd | && --verbose printf $(pwd) local
+		/usr/bin "$1" done done awk ${HOME} "$1"
+	done export awk export | sed /usr/bin
+2>/dev/null /usr/bin | /usr/bin --verbose x=1 ${HOME} ${HOME} cd $(pwd) "$@" x=1
+test sed --verbose 2>/dev/null 2>/dev/null test grep done 'quoted text'
+	then 'quoted text' cd 'quoted text'
+	echo ${HOME} export grep done "$@" export 'quoted text' sed
+		$(pwd) $(pwd) sed awk local done ${HOME}
+	2>/dev/null echo | test sed
+--verbose cd cd && ${HOME} test
+		awk cd cd "$1" -eu then --verbose
+then cd | && "$1" echo
+		'quoted text' printf $(pwd) then 'quoted text' | x=1 local echo -eu 2>/dev/null
+		awk printf grep awk $(pwd)
+done awk 2>/dev/null sed "$1" local "$1" x=1 sed && then | | cd $(pwd) export
+		echo cd && "$@" awk --verbose awk local -eu
+done local cd grep done done grep && grep --verbose readonly -eu cd x=1 then
+		printf then /usr/bin "$1" done 2>/dev/null $(pwd) 2>/dev/null sed &&
+		${HOME} | echo x=1 --verbose test /usr/bin cd 2>/dev/null "$@" export
+test "$1" echo awk awk done "$1" | && readonly awk x=1 | done done
+	echo "$@" "$@" "$1" /usr/bin -eu export awk 'quoted text' then --verbose
+	&& "$@" --verbose --verbose | ${HOME} printf readonly sed cd grep
+		local 2>/dev/null awk "$1"
+	/usr/bin "$@" awk "$1" --verbose && 2>/dev/null
+		&& printf grep export --verbose --verbose local
+	2>/dev/null $(pwd) && then "$@" echo local sed
+	"$@" sed sed test && readonly local printf && | "$1" 2>/dev/null 'quoted text'
+		--verbose awk /usr/bin printf "$@"
+	awk 'quoted text' 2>/dev/null local local "$1" echo 'quoted text' local && grep
+		sed -eu 'quoted text' -eu then test 2>/dev/null readonly
+		-eu "$1" ${HOME} echo 2>/dev/null "$1"
+--verbose -eu ${HOME} awk readonly 'quoted text'
+	printf echo x=1 printf printf
+		printf echo done grep -eu awk 'quoted text'
+		awk printf local grep grep && done done local --verbose
+echo printf --verbose 'quoted text' "$@" test ${HOME} test
+	${HOME} 'quoted text' local /usr/bin 'quoted text' cd $(pwd) then
+		-eu echo --verbose 'quoted text' /usr/bin ${HOME} awk
+	--verbose "$@" done echo "$1" $(pwd) x=1 ${HOME} then ${HOME}
+	echo grep export done readonly --verbose
+awk "$1" export && $(pwd) grep export done $(pwd) ${HOME} "$1" -eu grep
+		test grep 'quoted text' --verbose
+	export export cd $(pwd) | done /usr/bin 'quoted text' echo ${HOME}
+printf -eu done | local && | "$1" then && grep export done 2>/dev/null test
+		${HOME} readonly && awk export x=1 readonly 'quoted text' "$@" "$1"
+	then awk && then awk /usr/bin "$1" printf /usr/bin && 'quoted text'
+	"$@" echo local 2>/dev/null sed
+sed /usr/bin readonly printf $(pwd) | ${HOME}
+cd grep /usr/bin 'quoted text'
+		${HOME} echo then printf then -eu "$1" "$1" sed "$1" x=1 then sed local readonly
+	$(pwd) readonly grep &&
+		export printf then export $(pwd) cd echo local then "$@" "$@"
+x=1 && /usr/bin | grep "$1" -eu | printf echo local | $(pwd)
+		| -eu then readonly export
+		then "$@" test awk export --verbose printf
+-eu && 'quoted text' done readonly 'quoted text' "$1"
+		-eu 2>/dev/null $(pwd) -eu && awk 2>/dev/null test /usr/bin /usr/bin awk done
+	then && 'quoted text' "$1" awk /usr/bin
+		test 'quoted text' printf
+		2>/dev/null | readonly printf x=1 awk | "$@" export cd readonly | "$1" $(pwd) "$1"
+		"$@" | test 'quoted text' $(pwd) cd $(pwd) 'quoted text'
+		&& export -eu x=1 local export echo sed
+		sed export --verbose readonly cd 2>/dev/null done | local --verbose printf
+		"$1" "$1" 'quoted text' grep then
+		export 'quoted text' awk x=1 'quoted text'
+	cd && local grep $(pwd) echo
+| ${HOME} 'quoted text' awk -eu "$1" "$1"
+	test export export awk done $(pwd) awk -eu
+		x=1 echo echo printf test ${HOME} /usr/bin "$@" cd --verbose | then readonly
+	echo --verbose test $(pwd) "$@" ${HOME} "$1" export export
+		--verbose /usr/bin grep sed $(pwd) local --verbose
+&& | then echo then "$@"
+echo echo sed "$@" sed
+		done --verbose readonly sed sed ${HOME}
+	${HOME} export grep cd echo ${HOME} local grep sed 2>/dev/null
+		local 'quoted text' /usr/bin && -eu
+	export cd then echo ${HOME}
+cd export x=1 2>/dev/null 'quoted text' "$@" 'quoted text' --verbose
+	&& local 2>/dev/null && -eu && grep ${HOME} /usr/bin /usr/bin 'quoted text'
+done /usr/bin "$1" "$1" awk done -eu
+echo sed readonly $(pwd) local printf printf -eu "$@" printf 'quoted text'
+		"$@" sed ${HOME} local $(pwd)
+grep local readonly 'quoted text' printf echo export then test &&
+| x=1 export ${HOME} printf export /usr/bin local awk $(pwd) && readonly sed
+'quoted text' 'quoted text' 2>/dev/null then export printf ${HOME} "$@"
+	$(pwd) 2>/dev/null test 2>/dev/null -eu 'quoted text' --verbose readonly
+	grep sed --verbose done && test
+readonly cd export test done | && && -eu printf export test "$@"
+	'quoted text' readonly 'quoted text'
+	then readonly 2>/dev/null then 'quoted text' readonly $(pwd) done printf -eu
+	local 'quoted text' && "$@" local local
+awk done readonly grep $(pwd) "$@" 2>/dev/null then awk done
+$(pwd) "$@" --verbose $(pwd)
+/usr/bin ${HOME} | "$@" grep | $(pwd) test x=1 --verbose cd test done 'quoted text'
+	then /usr/bin cd 'quoted text'
+'quoted text' -eu /usr/bin | | awk then
+	echo readonly local "$@" awk /usr/bin readonly readonly test grep $(pwd)
+	--verbose 2>/dev/null | local "$@" ${HOME} echo cd -eu local local
+	x=1 then 2>/dev/null
+cd sed printf grep -eu cd 2>/dev/null
+	test ${HOME} -eu $(pwd) --verbose awk 2>/dev/null x=1 grep 'quoted text'
+printf 2>/dev/null /usr/bin cd local $(pwd) ${HOME} test then echo
+		"$1" ${HOME} sed 2>/dev/null
+		readonly done test local
+	"$@" test "$1" sed 2>/dev/null | "$@" sed echo /usr/bin "$1" done
+2>/dev/null | 'quoted text' printf ${HOME} export grep -eu ${HOME} x=1 done readonly
+sed "$@" "$@" /usr/bin readonly --verbose
+done export grep 2>/dev/null echo cd && sed export -eu --verbose $(pwd)
+		test x=1 local | 'quoted text' done sed local printf
+		/usr/bin /usr/bin echo x=1 grep $(pwd) "$1" readonly grep awk done sed 2>/dev/null
+		2>/dev/null grep then
+	sed --verbose /usr/bin "$@" test test x=1 && echo /usr/bin 2>/dev/null cd | "$@"
+		echo grep then test x=1 local "$1" 2>/dev/null cd done
+	readonly $(pwd) -eu cd awk printf sed --verbose /usr/bin done export
+printf sed "$@" "$@" sed 'quoted text' x=1 done
+	printf && ${HOME} cd -eu 2>/dev/null then local 'quoted text' echo
+	| x=1 | && /usr/bin awk $(pwd) grep done "$@" 'quoted text'
+		done 'quoted text' x=1 -eu local readonly cd --verbose "$@" echo test done awk
+		$(pwd) local x=1 grep $(pwd) "$1" then grep &&
+x=1 readonly cd --verbose ${HOME} awk awk done export --verbose local
+	"$@" | -eu local export /usr/bin "$1" sed ${HOME} /usr/bin
+	/usr/bin cd $(pwd) echo awk printf 2>/dev/null test
+		readonly "$@" "$1" "$@" ${HOME} "$1" 'quoted text' $(pwd)
+	readonly then "$1" /usr/bin
+		/usr/bin $(pwd) x=1 ${HOME} sed ${HOME} --verbose test grep
+awk grep x=1 x=1 readonly printf export echo /usr/bin grep local --verbose
+		test 'quoted text' --verbose printf "$1"
+		"$1" cd local x=1 local test done "$@"
+	printf "$1" test x=1 --verbose
+	test 2>/dev/null 'quoted text' export cd "$@" then "$1"
+	'quoted text' 'quoted text'
+		test test | "$1" "$@" local
+		"$@" -eu "$1" grep -eu 'quoted text' --verbose
+		export cd x=1 done awk awk "$@" readonly x=1 local export
+		2>/dev/null grep "$@" done
+printf "$1" test grep /usr/bin x=1 done
+		2>/dev/null test readonly | printf | "$1"
+	done printf cd readonly grep --verbose x=1 test $(pwd) grep 2>/dev/null
+	printf cd export --verbose cd export
+awk cd "$1" export cd
+"$@" | | local printf | grep | && --verbose sed printf x=1 --verbose then "$1"
+	then --verbose export | | local then grep 'quoted text' /usr/bin export then export
+	"$@" cd "$@" 2>/dev/null echo then x=1
+	$(pwd) | sed awk "$@" echo readonly -eu echo -eu echo | sed cd x=1 local "$1"
+${HOME} -eu printf /usr/bin x=1 sed local readonly | test /usr/bin /usr/bin
+2>/dev/null | 2>/dev/null sed --verbose cd echo && printf then ${HOME} | |
+	export awk cd --verbose /usr/bin grep $(pwd) done grep echo sed && printf ${HOME}
+		${HOME} echo -eu "$@" readonly
+	echo --verbose cd ${HOME} /usr/bin
+		sed done sed $(pwd) local $(pwd) /usr/bin cd
+local $(pwd) -eu awk awk echo test readonly awk grep --verbose x=1 echo "$@" &&
+		grep | export grep "$@" readonly
+	readonly awk x=1 | echo -eu local grep --verbose ${HOME} /usr/bin
+	local 2>/dev/null 'quoted text' test && "$1" | local
+	cd "$1" $(pwd) --verbose ${HOME} --verbose
+		local && printf $(pwd) 'quoted text' test x=1 -eu awk
+	done /usr/bin | cd -eu -eu awk | /usr/bin "$@" -eu printf grep
+		grep "$1" export && "$@" then echo "$@" test test then test $(pwd)
+	&& "$@" printf 2>/dev/null export x=1 export $(pwd) then -eu 2>/dev/null
+	'quoted text' sed test awk "$1" then export "$@" cd printf && done
+		x=1 x=1 local ${HOME} grep done awk $(pwd)
+	export export ${HOME} sed
+printf "$@" && --verbose export x=1
+		test 2>/dev/null awk done then cd "$1" 2>/dev/null
+	"$1" test /usr/bin printf ${HOME} --verbose test $(pwd) local sed echo cd local
+		export /usr/bin sed done grep | cd
+readonly ${HOME} echo $(pwd)
+	x=1 done then x=1 /usr/bin x=1 $(pwd)
+/usr/bin awk -eu "$@" 2>/dev/null x=1 export x=1 readonly "$@" | readonly
+		export -eu then 2>/dev/null sed awk -eu | awk echo 2>/dev/null
+	readonly x=1 then x=1 done
+${HOME} -eu | "$@" --verbose echo "$1" 2>/dev/null --verbose
+/usr/bin cd grep -eu export 2>/dev/null echo "$1" grep sed export
+grep $(pwd) local printf "$1" $(pwd) echo local | echo 2>/dev/null
+	local awk cd x=1 x=1 'quoted text' "$1" printf -eu "$@" local then
+	"$@" cd echo then readonly x=1 sed | done
+/usr/bin | export readonly cd
+	--verbose "$1" $(pwd) grep printf 2>/dev/null
+	x=1 x=1 /usr/bin 2>/dev/null && grep x=1 grep readonly /usr/bin
+	2>/dev/null test 2>/dev/null 'quoted text' local -eu && printf "$1" printf
+echo && then 2>/dev/null | "$1" cd --verbose "$@" -eu
+x=1 test awk 2>/dev/null /usr/bin readonly export ${HOME}
+	"$1" && grep test done grep sed "$@"
+printf cd "$1" && grep /usr/bin "$@" | test --verbose
+	grep test awk awk ${HOME}
+	x=1 grep export "$1" done /usr/bin local 'quoted text' readonly echo
+sed echo $(pwd) x=1 local
+	| sed printf awk $(pwd) echo test --verbose -eu $(pwd) cd cd 'quoted text' 2>/dev/null
+		readonly ${HOME} echo --verbose readonly 2>/dev/null --verbose ${HOME} local grep
+"$1" sed awk | local cd readonly test local echo /usr/bin local then "$@"
+		local readonly 'quoted text' "$@" test local
+		export "$1" "$1" export 'quoted text' local export
+		sed x=1 /usr/bin 'quoted text'
+	then --verbose export grep /usr/bin
+	awk readonly local sed --verbose
+| | echo export echo test -eu "$1" "$1"
+awk grep /usr/bin && $(pwd) "$@" | echo echo sed 2>/dev/null -eu done "$@" 'quoted text'
+		'quoted text' /usr/bin done then "$1" /usr/bin
+awk --verbose printf awk --verbose echo local 2>/dev/null ${HOME} local --verbose
+		"$1" 'quoted text' printf echo x=1 x=1 printf grep --verbose grep export
+| printf grep "$@" 2>/dev/null /usr/bin
+"$1" test | export -eu grep ${HOME} echo export --verbose ${HOME} 2>/dev/null
+	sed --verbose x=1 "$@" grep /usr/bin ${HOME} ${HOME} export
+		local echo echo /usr/bin printf sed
+grep then then --verbose done "$1" awk ${HOME}
+		"$@" echo printf | printf -eu x=1 && then /usr/bin
+	printf ${HOME} export -eu awk test local /usr/bin |
+	test then sed grep 'quoted text' x=1 local "$@" printf ${HOME} x=1 x=1 $(pwd)
+		readonly readonly -eu done -eu test done $(pwd) "$@" test
+		'quoted text' export 'quoted text' local "$1" $(pwd) local -eu
+		printf then /usr/bin $(pwd) $(pwd) done "$@" awk -eu $(pwd) 'quoted text' grep "$@"
+"$1" 'quoted text' --verbose
+		/usr/bin /usr/bin -eu /usr/bin /usr/bin /usr/bin 2>/dev/null
+		then printf "$@" grep 2>/dev/null readonly 2>/dev/null grep
+	grep ${HOME} done awk grep export
+${HOME} export local then && --verbose export grep
+		cd /usr/bin readonly && /usr/bin 'quoted text' grep /usr/bin
+		${HOME} ${HOME} ${HOME} $(pwd) echo x=1 printf 2>/dev/null
+awk done && --verbose printf 2>/dev/null local 2>/dev/null cd "$1" printf
+	export export -eu done done x=1 echo printf local ${HOME} readonly
+| test ${HOME} echo "$1" readonly x=1 /usr/bin test "$1"
+export local -eu awk sed awk x=1 test cd $(pwd) -eu x=1 "$1"
+		${HOME} 'quoted text' /usr/bin local echo "$@" test x=1 x=1 -eu test local 'quoted text'
+		| x=1 readonly cd cd test readonly -eu export local "$1" 2>/dev/null readonly
+${HOME} /usr/bin done grep
+	/usr/bin test $(pwd) "$@" awk "$@" $(pwd) $(pwd) printf
+		2>/dev/null 2>/dev/null --verbose $(pwd) $(pwd) | $(pwd)
+		--verbose export local test --verbose awk readonly ${HOME} grep
+-eu grep grep -eu "$@" test then echo
+"$1" cd printf -eu /usr/bin "$@" x=1
+		/usr/bin echo echo "$1" -eu sed cd /usr/bin
+		test /usr/bin && --verbose x=1 cd sed
+| $(pwd) ${HOME} export 2>/dev/null then cd 'quoted text' &&
+		readonly x=1 ${HOME} grep echo --verbose "$@" local
+		cd done "$@" "$@" && 'quoted text' grep --verbose printf sed printf
+then done --verbose 'quoted text'
+	"$@" 2>/dev/null sed 'quoted text' grep export $(pwd) cd cd
+2>/dev/null 'quoted text' 'quoted text' "$@" then grep "$@" | readonly echo then
+		printf printf 2>/dev/null /usr/bin awk
+export && done readonly done then done done test printf grep export readonly readonly
+		readonly x=1 echo && 2>/dev/null -eu && test cd ${HOME} local $(pwd) awk grep "$@"
+-eu done && grep x=1 done local | ${HOME} 'quoted text' x=1 done awk sed x=1
+test x=1 cd /usr/bin $(pwd)
+	done test 'quoted text' local 'quoted text' -eu then then test -eu done
+done then ${HOME} cd --verbose | && ${HOME}
+	'quoted text' x=1 /usr/bin then ${HOME}
+	'quoted text' ${HOME} -eu ${HOME} /usr/bin awk sed readonly
+		"$1" echo echo $(pwd)
+		"$1" x=1 readonly --verbose cd then printf done export "$1" ${HOME} awk sed |
+	&& grep $(pwd) ${HOME} sed "$@" echo $(pwd) -eu
+	sed readonly --verbose
+2>/dev/null $(pwd) 2>/dev/null export
+cd local /usr/bin cd echo sed 'quoted text' x=1 "$1" awk
+	printf x=1 /usr/bin -eu $(pwd) "$@" grep done
+		-eu -eu x=1 "$1" 2>/dev/null
+| -eu echo -eu ${HOME} cd readonly grep 2>/dev/null
+	'quoted text' /usr/bin printf sed sed -eu /usr/bin x=1 echo -eu sed && 'quoted text'
+export 'quoted text' x=1 printf awk printf && ${HOME}
+		sed 'quoted text' done "$1" "$1" printf
+printf printf test cd
+		"$@" printf export awk
+"$1" && -eu readonly then -eu -eu cd /usr/bin test x=1 2>/dev/null
+		awk | readonly 2>/dev/null echo test echo x=1 "$@" sed export
+	grep && cd export echo done cd 'quoted text'
+local "$1" -eu 'quoted text' echo then ${HOME}
+$(pwd) 2>/dev/null done $(pwd) --verbose done test | /usr/bin /usr/bin x=1 2>/dev/null
+done test | $(pwd) sed done
+done local printf "$@" printf "$1" ${HOME} "$@" printf 'quoted text' awk printf
+grep | grep "$@" && "$1" readonly | 2>/dev/null $(pwd)
+		done "$1" readonly "$1" test "$@" readonly export
+local export test grep $(pwd) done
+done "$1" && done cd && awk
+"$@" /usr/bin local | sed readonly done done
+	readonly grep 'quoted text' --verbose ${HOME}
+	sed readonly "$@" test printf awk "$1" ${HOME} | ${HOME} $(pwd) local | sed
+		awk -eu | 2>/dev/null | cd ${HOME} grep /usr/bin x=1 $(pwd)
+local local test then --verbose awk cd readonly
+		x=1 && ${HOME} done 'quoted text' $(pwd) 'quoted text'
+	sed awk readonly && test printf | local test printf printf
+	printf then && readonly export ${HOME} $(pwd) printf echo 'quoted text'
+readonly "$1" export test 2>/dev/null --verbose
+grep --verbose /usr/bin -eu ${HOME} 2>/dev/null
+	/usr/bin $(pwd) test ${HOME}
+'quoted text' printf printf
+$(pwd) x=1 'quoted text' /usr/bin /usr/bin awk then "$1" echo -eu
+-eu readonly awk -eu done /usr/bin echo printf x=1 done cd ${HOME} grep
+grep then grep /usr/bin | local printf echo echo
+$(pwd) echo cd $(pwd) echo -eu --verbose local readonly
+	done --verbose x=1 done printf "$1" --verbose && echo "$1" test /usr/bin printf
+"$@" 2>/dev/null awk sed | export local x=1 test "$@" local /usr/bin
+	done printf --verbose then awk test awk cd "$@" cd local --verbose
+	-eu test then export grep --verbose cd export -eu
+2>/dev/null "$1" 2>/dev/null -eu readonly | | test &&
+	echo && 'quoted text' echo sed sed "$1" "$@" echo done && | test ${HOME} awk cd
+${HOME} cd cd printf 'quoted text' 2>/dev/null "$1" readonly
+x=1 readonly && grep sed local printf
+		&& printf x=1 && local cd | readonly --verbose local test "$1" ${HOME} readonly
+	--verbose test --verbose
+local printf && $(pwd) --verbose echo -eu awk x=1 then && test grep --verbose
+--verbose sed readonly "$@" done readonly export -eu "$1" grep | done then test
+		echo 'quoted text' test -eu "$1" 'quoted text' awk $(pwd)
+	2>/dev/null "$1" && && "$1" echo grep --verbose 'quoted text' sed
+${HOME} /usr/bin /usr/bin readonly done cd | 2>/dev/null sed readonly "$@" ${HOME}
+	/usr/bin export then test && /usr/bin test -eu | printf ${HOME} --verbose
+		-eu echo awk local 2>/dev/null --verbose printf --verbose
+	--verbose /usr/bin | done cd --verbose
+local /usr/bin && printf awk cd 2>/dev/null echo 'quoted text'
+| test grep -eu cd then awk test echo | readonly "$1" awk export readonly
+local then "$1" /usr/bin 'quoted text' && ${HOME} $(pwd) export /usr/bin
+		cd --verbose awk test 'quoted text'
+	then echo printf && printf "$@" printf x=1 test
+		$(pwd) export x=1 x=1 -eu ${HOME} local --verbose local $(pwd)
+2>/dev/null local sed x=1 cd -eu test "$1" x=1 2>/dev/null
+		&& echo done 2>/dev/null local
+${HOME} | "$@" $(pwd) echo | ${HOME} echo readonly test export
+		&& grep x=1 --verbose done done grep 'quoted text' x=1 sed grep awk 'quoted text'
+		"$1" test "$@" 2>/dev/null x=1 test
+--verbose echo export cd readonly export "$@" test export "$@" 'quoted text' then
+	/usr/bin && then printf done
+	${HOME} then "$1" && awk
+		sed awk echo x=1 x=1 | echo /usr/bin $(pwd)
+	/usr/bin test printf | readonly printf
+		"$@" "$1" sed "$@" export
+	/usr/bin --verbose sed cd grep ${HOME}
+		echo $(pwd) cd --verbose export && grep echo echo
+		awk x=1 then readonly printf local echo printf $(pwd)
+	${HOME} /usr/bin grep echo readonly then readonly export local export then
+	/usr/bin readonly "$1"
+awk done x=1 /usr/bin && 2>/dev/null && --verbose then printf 'quoted text'
+	$(pwd) cd test echo /usr/bin awk ${HOME} $(pwd) ${HOME}
+	readonly 2>/dev/null -eu "$@"
+	"$@" ${HOME} cd /usr/bin echo sed echo $(pwd) ${HOME} ${HOME}
+	x=1 awk 2>/dev/null done 2>/dev/null sed "$1" local | ${HOME}
+	x=1 awk && 2>/dev/null | /usr/bin 'quoted text'
+		echo grep printf x=1 awk ${HOME}
+	readonly | --verbose then grep test 'quoted text' ${HOME} echo "$@" local ${HOME}
+--verbose | "$@" -eu "$1" -eu done sed export
+		&& awk -eu awk | awk /usr/bin export /usr/bin cd "$@" | --verbose "$1" $(pwd)
+		cd ${HOME} done local cd done grep
+--verbose x=1 /usr/bin sed 'quoted text'
+	| -eu --verbose done grep 'quoted text'
+sed awk sed /usr/bin export ${HOME} "$1" done sed 'quoted text'
+${HOME} local x=1 ${HOME} cd export
+| local echo 'quoted text' && x=1 echo export
+"$@" && ${HOME} awk "$1" test | echo "$@" done test
+grep x=1 2>/dev/null test $(pwd) test done cd
+	then local && x=1 sed printf done
+	"$1" "$1" --verbose ${HOME} done "$1"
+	cd grep printf echo | && export
+		export /usr/bin && then cd x=1 "$1" --verbose cd grep $(pwd) ${HOME} awk 'quoted text'
+x=1 grep done && cd | grep 'quoted text'
+export && sed done cd cd then
+awk export sed test 'quoted text' --verbose test && then && printf --verbose
+	done && "$1" $(pwd) local cd
+		local $(pwd) printf awk awk test
+	export "$@" -eu ${HOME} $(pwd) ${HOME} $(pwd)
+		grep done --verbose done echo "$@" cd x=1 export then
+	printf -eu 'quoted text' sed -eu readonly ${HOME} ${HOME} printf
+		x=1 "$@" 'quoted text' done "$1" | | done
+	$(pwd) printf /usr/bin test test "$@" "$1" grep /usr/bin
+		printf export cd done -eu grep && -eu sed 'quoted text'
+	'quoted text' readonly cd /usr/bin done "$1"
+	awk "$@" 'quoted text' local
+		"$@" -eu | $(pwd) awk 'quoted text' local printf cd x=1 -eu then 'quoted text'
+test 2>/dev/null $(pwd) $(pwd)
+sed sed ${HOME} "$1" grep "$@" cd x=1 readonly 'quoted text'
+		${HOME} /usr/bin "$@" grep | "$@" cd "$@" $(pwd) done then echo
+		test "$1" grep /usr/bin test readonly 2>/dev/null 'quoted text' local cd grep grep
+	$(pwd) /usr/bin /usr/bin local awk export
+	/usr/bin printf "$1" test awk ${HOME} sed done 2>/dev/null grep 2>/dev/null /usr/bin
+$(pwd) "$@" done readonly 2>/dev/null readonly local echo grep sed $(pwd)
+	test cd | awk | $(pwd) 'quoted text'
+		"$1" /usr/bin local echo echo grep echo then 2>/dev/null
+x=1 | done cd 'quoted text' printf readonly
+	awk local test grep /usr/bin local sed 2>/dev/null local x=1 local && --verbose
+		"$@" readonly | readonly done cd "$@" printf done && | export
+	${HOME} "$@" x=1 "$1" $(pwd)
+	local test grep echo 'quoted text'
+	export && ${HOME} ${HOME} -eu printf done
+	sed 2>/dev/null "$1" local readonly $(pwd) echo x=1 awk && readonly export
+		cd -eu readonly test readonly 2>/dev/null awk test $(pwd) export local ${HOME} awk
+		readonly sed x=1 x=1 ${HOME} 2>/dev/null local
+		"$@" export $(pwd) x=1 x=1 test echo grep -eu export 'quoted text' local x=1 &&
+	printf x=1 $(pwd) then
+		--verbose then cd awk echo -eu
+export grep done ${HOME}
+		then 2>/dev/null readonly
+	"$1" cd done --verbose grep "$@" /usr/bin grep export $(pwd) local "$@" "$@"
+		awk | export grep x=1 -eu sed local
+	grep echo readonly then ${HOME} done then echo grep echo
+export "$@" /usr/bin "$@" $(pwd) --verbose x=1 done $(pwd) then readonly
+--verbose done /usr/bin then sed grep then echo grep -eu 2>/dev/null
+	local echo sed local &&
+	test done 2>/dev/null "$1" printf | cd 2>/dev/null "$@" | test sed
+#include c158.sh
+		"$1" 'quoted text' sed | grep "$@" echo local then "$1" export sed local
+		test $(pwd) ${HOME} readonly
+	test export | awk "$@" "$1" cd 2>/dev/null export "$@" /usr/bin x=1 export
+		local "$1" sed --verbose "$@" awk echo 2>/dev/null 'quoted text' readonly
+	-eu cd 2>/dev/null $(pwd) /usr/bin
+	$(pwd) cd && awk | done cd echo -eu readonly
+&& -eu -eu then grep done 2>/dev/null cd
+	'quoted text' --verbose | then 'quoted text' /usr/bin
+	test cd 'quoted text' | grep done readonly
+done "$1" then && then "$@"
+	${HOME} printf 'quoted text'
+		export grep local "$@" | /usr/bin test --verbose
+		2>/dev/null grep --verbose echo "$1" printf -eu
+	"$1" done --verbose $(pwd) "$@" test | readonly "$@" cd
+printf local echo echo cd ${HOME} "$@" done ${HOME} 2>/dev/null echo
+	awk then grep --verbose $(pwd) 2>/dev/null cd 2>/dev/null
+	local --verbose readonly --verbose ${HOME} "$@" cd echo && -eu cd 2>/dev/null
+grep sed local printf --verbose printf test local | echo ${HOME} 2>/dev/null
+		| x=1 ${HOME} -eu -eu grep test then test awk
+	cd ${HOME} && 2>/dev/null -eu -eu | readonly | awk cd readonly
+"$1" cd readonly printf &&
+	2>/dev/null ${HOME} | sed printf "$1" -eu sed 'quoted text'
+grep echo cd test | -eu awk ${HOME} /usr/bin done "$1"
+${HOME} sed | "$1" test readonly
+"$1" export $(pwd) local printf ${HOME} ${HOME} export printf
+2>/dev/null export echo && | echo "$@"
+		"$1" 2>/dev/null done $(pwd) -eu echo && sed $(pwd)
+		done grep "$@" export echo test cd test
+	"$@" local | ${HOME} awk "$1" 2>/dev/null then -eu readonly "$@"
+	done "$@" then grep --verbose printf cd grep sed -eu awk
+	2>/dev/null test $(pwd) -eu sed && grep ${HOME}
+		export done "$@" /usr/bin "$1" test x=1 export
+export readonly -eu echo 'quoted text' echo 'quoted text' ${HOME}
+		sed --verbose printf local --verbose ${HOME} "$1" ${HOME} && done -eu
+		2>/dev/null x=1 ${HOME} && cd | x=1 cd "$1" --verbose
+x=1 "$@" x=1 awk && readonly -eu "$1" --verbose
+		grep echo export echo done readonly
+	/usr/bin grep local readonly local
+"$1" local export sed cd local
+readonly 2>/dev/null local readonly --verbose readonly
+	&& | --verbose x=1 done echo | printf test local "$1" ${HOME} "$1"
+		readonly sed -eu awk cd awk printf
+${HOME} export readonly && export -eu grep
+	printf 2>/dev/null && then cd /usr/bin readonly
+		/usr/bin x=1 x=1 $(pwd) test awk x=1
+2>/dev/null grep -eu cd "$1" then x=1 printf local local 'quoted text'
+	echo x=1 readonly done && test cd test 2>/dev/null awk grep
+		test && "$1" echo "$1" /usr/bin x=1 cd sed cd local 2>/dev/null
+		then --verbose && echo awk x=1 readonly local | awk "$@"
+	sed local grep --verbose awk readonly "$@"
+sed test export | --verbose grep printf "$@" local x=1 -eu readonly "$@" ${HOME}
+		printf $(pwd) /usr/bin awk --verbose "$@" readonly test printf --verbose
+	awk echo export printf /usr/bin 'quoted text' readonly
+		--verbose cd 2>/dev/null /usr/bin -eu $(pwd) 'quoted text' ${HOME} echo
+	2>/dev/null | $(pwd) done test echo local readonly 'quoted text' "$@" sed ${HOME}
+| 'quoted text' readonly echo done
+		"$1" | sed "$1" printf -eu | printf awk export --verbose done grep
+	sed export x=1 x=1 2>/dev/null
+then sed echo then 'quoted text' printf --verbose export
+	'quoted text' local "$@" cd test
+	done /usr/bin ${HOME} 2>/dev/null 'quoted text' grep local
+"$1" export test awk &&
+	2>/dev/null "$1" "$1" 2>/dev/null awk 'quoted text' grep
+	${HOME} then done done /usr/bin echo test echo 'quoted text' then && readonly
+then 'quoted text' echo test $(pwd) && printf -eu printf local
+		printf 'quoted text' x=1 'quoted text' && "$1"
+		export readonly -eu export | | 2>/dev/null 'quoted text'
+		"$@" 'quoted text' readonly test done && cd then printf "$@" local
+	export grep -eu && readonly "$@" --verbose && export
+		grep then ${HOME} -eu /usr/bin cd ${HOME}
+	local cd awk export done echo 'quoted text' "$1" export "$@" awk export x=1
+--verbose sed "$@" export
+		readonly "$1" export "$@" echo export sed -eu done
+		then printf grep grep awk "$@" /usr/bin echo /usr/bin cd local echo grep x=1
+	2>/dev/null local awk ${HOME} echo "$1" "$1" done printf
+	${HOME} test ${HOME} printf then -eu sed
+	2>/dev/null awk then cd --verbose
+/usr/bin done 2>/dev/null done && x=1 then local $(pwd)
+	printf awk "$1" $(pwd)
+		readonly /usr/bin 'quoted text' local ${HOME} 'quoted text'
+		then sed test && echo printf
+		--verbose --verbose /usr/bin
+		&& ${HOME} $(pwd) "$1" local "$1" x=1 readonly 'quoted text' x=1 local ${HOME}
+	readonly done $(pwd) 2>/dev/null readonly grep | cd x=1 'quoted text'
+		awk "$1" -eu echo /usr/bin sed && sed done
+test && x=1 | --verbose "$1" readonly && && awk -eu "$1" echo
+	cd sed x=1 "$1" printf 2>/dev/null && awk test awk "$@" sed sed
+--verbose "$1" awk then cd local export 'quoted text' /usr/bin
+"$1" "$1" x=1 'quoted text' printf cd cd /usr/bin
+--verbose | printf echo printf "$1" $(pwd) test awk
+	printf sed 2>/dev/null awk grep -eu | 'quoted text'
+x=1 "$1" -eu && && then "$1" export readonly "$1" export "$@"
+	local cd 2>/dev/null "$1" "$@" $(pwd) 'quoted text' then echo && test x=1 export
+		cd "$@" && echo then $(pwd) readonly 2>/dev/null
+| done echo 'quoted text' "$1"
+		2>/dev/null -eu then awk then then | -eu
+--verbose ${HOME} grep ${HOME} test local test 'quoted text' /usr/bin
+	| "$@" x=1 awk | 'quoted text' sed grep x=1 cd && /usr/bin ${HOME} grep
+| --verbose ${HOME} printf
+	'quoted text' export $(pwd) export
+readonly /usr/bin ${HOME} 2>/dev/null
+"$1" printf x=1 done awk readonly
+		local | "$1" "$1" awk -eu && cd cd 2>/dev/null 2>/dev/null local -eu grep
+	sed local echo then grep done $(pwd) done local printf test 'quoted text'
+		echo sed 'quoted text' | done /usr/bin && test $(pwd) grep 2>/dev/null export
+		$(pwd) ${HOME} test printf x=1 cd && echo test "$@" test printf readonly
+		2>/dev/null local "$1" awk $(pwd) | --verbose | echo cd test 'quoted text'
+awk printf -eu printf readonly 2>/dev/null 2>/dev/null
+		readonly && cd grep $(pwd)
+		"$@" --verbose -eu sed -eu x=1 test "$@" --verbose done echo 'quoted text'
+grep | local cd cd test --verbose
+${HOME} $(pwd) readonly x=1 /usr/bin --verbose then
+--verbose x=1 printf "$1" test
+	"$1" then awk -eu ${HOME}
+	grep sed ${HOME} sed && export | "$@" 2>/dev/null
+$(pwd) cd -eu && && cd awk local grep
+&& | then cd $(pwd) --verbose x=1
+	readonly export 'quoted text' awk
+then readonly && grep | | echo then $(pwd) echo
+local export | && grep grep -eu readonly export
+	grep echo awk local "$1" "$@" awk "$1" /usr/bin x=1 2>/dev/null
+	then && "$@" "$@" ${HOME} x=1 cd awk
+		"$1" cd "$@" 2>/dev/null local echo cd readonly printf && $(pwd) /usr/bin 2>/dev/null
+		"$1" -eu 2>/dev/null -eu 'quoted text' /usr/bin -eu --verbose && $(pwd) echo /usr/bin
+	$(pwd) -eu 'quoted text' "$1" done --verbose "$1"
+	readonly | readonly echo then then
+	2>/dev/null cd awk export 2>/dev/null done done 2>/dev/null
+test ${HOME} done && "$1" done "$@" /usr/bin sed local
+		2>/dev/null sed sed then
+		then readonly then awk readonly readonly "$@" "$1" export test done $(pwd)
+		echo local ${HOME} then /usr/bin grep
+		grep cd grep test printf then done -eu && done echo printf "$@" export sed --verbose
+		"$1" && -eu | 'quoted text' "$@" echo x=1 ${HOME} echo |
+		printf done then && "$1" grep local awk sed readonly
+readonly sed done readonly readonly /usr/bin readonly echo "$@" -eu awk -eu 'quoted text'
+&& | -eu "$1" /usr/bin cd ${HOME} -eu $(pwd) ${HOME}
+		"$1" echo readonly readonly
+	"$1" $(pwd) x=1 2>/dev/null /usr/bin
+	printf -eu -eu "$1" then echo
+	$(pwd) x=1 "$1" local readonly printf
+		readonly --verbose |
+"$@" cd test grep x=1 echo x=1 echo 'quoted text' readonly 2>/dev/null $(pwd)
+	-eu x=1 test export sed ${HOME} "$1" /usr/bin export done done | printf test
+	${HOME} readonly awk 'quoted text' sed 2>/dev/null test cd x=1 $(pwd) export
+/usr/bin local awk printf "$1" -eu ${HOME} 2>/dev/null echo && echo x=1
+		2>/dev/null printf echo -eu "$@" $(pwd) done awk
+sed --verbose cd x=1 2>/dev/null echo 'quoted text' $(pwd)
+		&& && then --verbose /usr/bin "$@" export && /usr/bin local 2>/dev/null awk 'quoted text'
+		-eu printf export sed x=1
+	then "$@" then 2>/dev/null "$1" local --verbose grep ${HOME}
+	${HOME} then "$@" -eu -eu ${HOME} x=1 printf
+&& x=1 "$@" printf cd /usr/bin --verbose
+		-eu "$1" local --verbose ${HOME} x=1 cd printf
+&& readonly "$@" test local "$1" test cd -eu 'quoted text' ${HOME} $(pwd)
+	then test ${HOME} awk 2>/dev/null then $(pwd) x=1 && "$@" cd "$@" ${HOME} readonly
+&& test sed readonly "$@" then local x=1 cd 'quoted text' "$@" export -eu
+	"$1" && && test export test grep "$1" 2>/dev/null
+	/usr/bin grep -eu ${HOME}
+		export readonly | cd
+	'quoted text' x=1 awk 'quoted text' /usr/bin
+	done export grep "$@" -eu local local
+	x=1 readonly && x=1 grep cd awk then printf awk "$@" awk 'quoted text' 'quoted text'
+${HOME} | printf local "$1" $(pwd) awk $(pwd) 'quoted text'
+		sed "$@" /usr/bin --verbose done -eu 'quoted text' x=1
+sed printf "$@" "$1" 2>/dev/null | ${HOME} then echo done done ${HOME}
+		$(pwd) /usr/bin echo 'quoted text' 2>/dev/null /usr/bin test
+'quoted text' /usr/bin 'quoted text' local grep /usr/bin
+		x=1 echo $(pwd) && 'quoted text'
+	done --verbose readonly 'quoted text' /usr/bin printf | echo
+${HOME} readonly awk local /usr/bin
+		readonly local 'quoted text' 2>/dev/null | "$@" /usr/bin /usr/bin cd && sed
+		${HOME} test ${HOME} 2>/dev/null 2>/dev/null cd
+test | "$@" /usr/bin && 2>/dev/null ${HOME} then cd readonly --verbose awk /usr/bin
+"$@" x=1 printf "$1" "$@" ${HOME} x=1 'quoted text'
+	cd cd /usr/bin done /usr/bin export printf -eu export printf
+	printf ${HOME} export grep test | sed | "$1" "$1"
+	done && --verbose cd && cd local
+	readonly ${HOME} 'quoted text' -eu done | export "$@" export "$1" 2>/dev/null
+	awk then $(pwd) printf awk "$1" then local -eu grep awk awk sed -eu "$@" sed sed
+		/usr/bin grep "$@" cd $(pwd)
+		'quoted text' "$1" x=1 | readonly "$@" "$1" x=1 echo sed "$1" local echo
+| cd done export $(pwd) grep export test grep
+	printf test "$1" awk export export | x=1 && --verbose grep
+	/usr/bin echo ${HOME} 2>/dev/null
+		test grep done test -eu test |
+x=1 | test sed 2>/dev/null grep $(pwd) ${HOME} "$@" "$1" sed
+	"$1" x=1 "$@" "$1" cd 'quoted text' export |
+		then grep "$@" "$1" && 2>/dev/null 2>/dev/null test "$@" printf -eu echo
+echo 'quoted text' "$1"
+	'quoted text' --verbose cd && sed | ${HOME} | done sed "$@" grep then
+then | -eu -eu /usr/bin done printf &&
+		grep "$1" ${HOME} "$@" test echo && echo 'quoted text' export
+sed /usr/bin -eu | && readonly ${HOME}
+	'quoted text' --verbose sed
+	cd 'quoted text' done -eu done 'quoted text'
+	cd export cd echo export grep local 'quoted text'
+		| "$@" $(pwd) then -eu -eu
+		cd ${HOME} --verbose --verbose grep x=1 sed printf ${HOME}
+		readonly done $(pwd) | /usr/bin "$1" "$1" printf sed awk | test
+		x=1 test then "$1" /usr/bin sed export
+		| /usr/bin /usr/bin readonly
+then | -eu | local $(pwd) cd -eu then export cd "$@" && sed grep $(pwd) sed
+		readonly ${HOME} -eu cd echo printf
+	cd /usr/bin cd cd cd -eu -eu --verbose done cd ${HOME}
+--verbose $(pwd) 'quoted text' /usr/bin /usr/bin
+		$(pwd) cd "$1" then 2>/dev/null "$1" test
+	printf 2>/dev/null "$1" printf echo && "$@" 2>/dev/null "$@" 'quoted text'
+x=1 grep 'quoted text' export -eu local x=1 test
+${HOME} readonly printf | done && /usr/bin local done | sed echo local
+$(pwd) 2>/dev/null -eu test -eu readonly local
+${HOME} 'quoted text' export awk --verbose local grep readonly 2>/dev/null "$1"
+x=1 test /usr/bin then | --verbose -eu echo $(pwd) $(pwd) done grep
+x=1 --verbose --verbose 'quoted text' | "$1" ${HOME} x=1 echo sed 'quoted text'
+	echo readonly export 2>/dev/null ${HOME} 2>/dev/null done
+printf ${HOME} echo then ${HOME} | /usr/bin
+	/usr/bin export then --verbose "$@" export 2>/dev/null -eu x=1 && /usr/bin
+	/usr/bin 'quoted text' "$1" readonly | $(pwd) "$1" printf x=1 "$@" export test
+	${HOME} "$@" awk done && ${HOME} $(pwd) done 'quoted text' x=1 grep test
+sed "$1" $(pwd) awk --verbose test then export awk /usr/bin ${HOME} test
+readonly --verbose awk ${HOME} ${HOME}
+	export readonly 'quoted text' $(pwd) done
+		printf printf local export "$1" test cd echo | && ${HOME} grep --verbose
+		"$@" echo readonly x=1 done
+	x=1 echo 'quoted text' && echo -eu | then 2>/dev/null echo
+		--verbose done 2>/dev/null printf --verbose | cd test | awk
+cd "$@" test x=1 ${HOME} | local done cd echo $(pwd) --verbose && "$@" 2>/dev/null
+		done $(pwd) test "$@" test cd grep $(pwd) "$@" 'quoted text' 'quoted text' "$@"
+/usr/bin -eu awk local 'quoted text' x=1 cd x=1 -eu printf
+test done | grep printf "$@"
+2>/dev/null printf ${HOME} && 2>/dev/null printf then ${HOME} "$@" 2>/dev/null
+		/usr/bin sed 2>/dev/null x=1 ${HOME} ${HOME}
+readonly cd readonly 2>/dev/null then test "$@" echo /usr/bin /usr/bin
+	echo "$1" | then /usr/bin -eu echo echo --verbose echo --verbose
+	$(pwd) then local "$@" /usr/bin awk $(pwd) ${HOME} 'quoted text'
+		${HOME} echo 2>/dev/null
+"$1" | ${HOME} sed "$1" cd then sed
+		'quoted text' /usr/bin export export | cd "$@" export "$@"
+awk ${HOME} 2>/dev/null ${HOME} awk test
+test ${HOME} --verbose grep test 'quoted text'
+	x=1 printf x=1 test "$@" ${HOME} x=1 x=1 then --verbose awk printf
+/usr/bin printf awk cd done done readonly done
+		readonly && "$1" && "$1" $(pwd) -eu | --verbose
+		-eu && grep done readonly "$1" sed
+	sed test export --verbose local sed test done awk readonly
+	then grep then && x=1 /usr/bin --verbose x=1 printf
+--verbose /usr/bin readonly "$1" | -eu test cd ${HOME}
+| "$1" test grep | echo done "$1" readonly printf
+		x=1 local grep then x=1 printf | "$@" cd readonly grep
+	export $(pwd) readonly /usr/bin cd /usr/bin awk -eu && done $(pwd) done
+	&& printf awk x=1 2>/dev/null $(pwd) -eu printf -eu
+	cd local readonly | then printf --verbose awk cd "$1" done
+echo local test 'quoted text' | ${HOME}
+	echo echo "$1" /usr/bin echo awk && x=1 local 2>/dev/null ${HOME} |
+		test /usr/bin then test test then 2>/dev/null ${HOME} printf awk cd done
+		local export echo local ${HOME}
+		&& /usr/bin test && then -eu -eu "$@"
+		done then test "$@" 'quoted text' --verbose then sed
+| ${HOME} -eu 2>/dev/null sed 'quoted text' /usr/bin
+	grep sed cd echo export
+export then /usr/bin then then printf test export
+		'quoted text' 2>/dev/null sed /usr/bin grep /usr/bin
+	'quoted text' | "$1" done echo cd /usr/bin export sed readonly -eu then
+		then cd "$@" cd x=1 /usr/bin | ${HOME} sed readonly test /usr/bin
+		printf then readonly $(pwd) /usr/bin echo "$1" done
+		2>/dev/null echo cd then
+export "$1" sed printf && 'quoted text' 'quoted text' sed printf printf
+-eu x=1 /usr/bin x=1 'quoted text' awk
+	grep local --verbose readonly && grep
+		| --verbose | -eu echo | echo readonly | done readonly 'quoted text' --verbose
+${HOME} x=1 x=1 done && --verbose $(pwd) test x=1 /usr/bin then grep
+		readonly "$1" test "$1" local sed printf cd && /usr/bin | export ${HOME} readonly
+	sed sed "$@" -eu sed printf export
+| done echo local grep then readonly
+cd readonly sed $(pwd) "$@" printf local 'quoted text' "$1" echo /usr/bin awk
+	&& sed $(pwd) done x=1 -eu | sed 'quoted text' printf
+	awk test x=1 && && awk $(pwd) local | x=1 readonly printf
+		cd echo echo && 'quoted text'
+		done ${HOME} awk "$@" "$@"
+	${HOME} | ${HOME} test then "$@" ${HOME} done && -eu /usr/bin "$1"
+	readonly printf export 2>/dev/null export
+		-eu | 2>/dev/null | awk | -eu done local -eu /usr/bin
+	$(pwd) awk --verbose sed export x=1 /usr/bin local readonly test
+		echo awk local done ${HOME} then x=1 grep --verbose | readonly export
+	echo awk then | done then $(pwd) echo -eu grep grep 'quoted text' /usr/bin ${HOME}
+	'quoted text' -eu sed echo readonly $(pwd) |
+sed -eu x=1 echo test then "$@" --verbose cd echo
+${HOME} export ${HOME} local printf then readonly
+	readonly | | "$1" sed export --verbose "$@" export -eu grep export local then
+-eu echo export printf "$1" then grep echo $(pwd)
+		'quoted text' awk then test export local
+x=1 printf ${HOME} "$@" grep | 2>/dev/null ${HOME}
+	-eu awk cd /usr/bin sed export export "$@" 2>/dev/null 'quoted text' 2>/dev/null
+	/usr/bin awk -eu readonly
+		${HOME} printf 'quoted text' x=1 local test /usr/bin cd "$@" 'quoted text' "$@"
+$(pwd) $(pwd) x=1 awk test
+${HOME} $(pwd) --verbose | | cd then sed && printf 'quoted text'
+		$(pwd) test readonly export echo -eu awk
+	--verbose ${HOME} 2>/dev/null | "$@" 'quoted text'
+		${HOME} done x=1 sed readonly sed x=1 2>/dev/null sed x=1 test awk x=1
+	x=1 echo export -eu then $(pwd) local test printf grep readonly local | | x=1
+		&& -eu done && sed printf cd && | "$1"
+		cd cd ${HOME} "$1" $(pwd) x=1
+	export then test then 'quoted text' x=1 grep | cd ${HOME} grep
+		x=1 done | printf then echo local && x=1 && test &&
+	test | cd export awk -eu cd 2>/dev/null &&
+grep /usr/bin $(pwd) test
+"$@" awk ${HOME} "$@" $(pwd) local readonly
+		awk 2>/dev/null grep /usr/bin && /usr/bin printf then -eu printf "$1"
+then "$@" && printf done "$1" sed done 2>/dev/null x=1 printf x=1 "$@" ${HOME} test
+"$@" then readonly && $(pwd) | | awk sed grep done readonly $(pwd) /usr/bin --verbose
+	awk "$@" "$1" then echo local local
+		readonly $(pwd) /usr/bin cd x=1 --verbose cd &&
+		| export x=1 export readonly x=1 test $(pwd)
+	readonly x=1 awk --verbose test 2>/dev/null done export
+	done -eu cd | grep then echo sed x=1 | cd then ${HOME} 2>/dev/null
+		test --verbose | 'quoted text' | echo $(pwd) -eu $(pwd) awk 2>/dev/null
+	echo "$@" export | export cd export awk x=1
+printf && echo 'quoted text'
+		readonly sed then cd local
+	readonly grep "$@" $(pwd) 2>/dev/null cd --verbose ${HOME}
+--verbose $(pwd) | awk /usr/bin "$@" --verbose -eu awk 2>/dev/null ${HOME}
+"$@" -eu "$1" export | -eu local readonly -eu readonly --verbose test | "$1" echo
+		readonly 'quoted text' 2>/dev/null
+	test printf awk && grep /usr/bin export echo
+	done 'quoted text' awk 'quoted text' printf
+export readonly test && then -eu 'quoted text' 'quoted text' readonly
+	echo -eu -eu test /usr/bin && echo && grep -eu grep "$1" /usr/bin
+-eu -eu "$@" sed then cd sed ${HOME} export test ${HOME} 'quoted text'
+	export "$@" | -eu --verbose
+${HOME} cd done then "$@" /usr/bin test
+		"$1" 'quoted text' done && then readonly $(pwd) done sed x=1 --verbose "$1" grep
+readonly local "$@" test $(pwd) x=1 2>/dev/null --verbose
+2>/dev/null x=1 --verbose sed | export "$1" --verbose printf local
+	awk local 'quoted text' ${HOME} && "$@" local sed && "$1" x=1 then readonly
+"$@" "$1" | | readonly -eu x=1 x=1 cd printf done 'quoted text' test test grep
+	| -eu | "$1" "$@" echo ${HOME} then
+		"$1" 2>/dev/null cd ${HOME} grep
+echo export --verbose && cd readonly -eu -eu printf
+		cd then export local | awk 'quoted text' cd --verbose /usr/bin ${HOME}
+	grep sed local --verbose export && 2>/dev/null -eu "$@"
+		$(pwd) --verbose $(pwd) done
+		| export "$1" grep awk sed readonly /usr/bin
+readonly then printf | /usr/bin --verbose then "$@" test sed
+		awk /usr/bin | test sed 2>/dev/null && awk export -eu printf done
+grep cd grep local "$1" | "$1" ${HOME} then $(pwd) printf printf
+	readonly "$@" then cd echo "$@" sed awk done sed 'quoted text'
+done done readonly then local
+	sed done awk --verbose done cd | export "$@" echo export printf local /usr/bin
+"$1" awk awk 'quoted text' ${HOME} done then ${HOME} 'quoted text'
+sed done export readonly done echo "$1" /usr/bin
+	printf /usr/bin printf "$1" echo readonly
+		/usr/bin "$1" printf $(pwd) 'quoted text'
+then --verbose local sed then local | sed $(pwd) local --verbose
+readonly ${HOME} export /usr/bin "$@" "$@" -eu --verbose sed x=1 | | export
+	/usr/bin "$@" echo -eu sed /usr/bin 2>/dev/null x=1 --verbose test $(pwd) then
+/usr/bin test /usr/bin done --verbose "$1" then printf
+	printf done /usr/bin cd $(pwd) echo 'quoted text' cd test -eu 'quoted text'
+		done grep awk printf ${HOME} grep
+awk 'quoted text' 'quoted text' && done
+"$@" test then test -eu echo printf --verbose awk sed ${HOME} awk echo echo
+$(pwd) | "$1" $(pwd) -eu grep then "$1" /usr/bin
+		| && -eu sed "$1" local | --verbose | 'quoted text' sed sed "$@" grep readonly
+		test x=1 echo export echo test printf 'quoted text'
+cd test && sed printf $(pwd) local ${HOME} $(pwd)
+--verbose 'quoted text'
+	cd echo | cd $(pwd) 2>/dev/null
+	local $(pwd) -eu test done /usr/bin
+		| $(pwd) grep cd grep sed
+export done -eu --verbose "$1" && x=1 sed grep 'quoted text' done
+		$(pwd) "$1" awk cd then && cd
+readonly readonly cd grep printf readonly
+		x=1 --verbose x=1 /usr/bin
+		"$1" "$1" then export --verbose export cd &&
+	--verbose echo ${HOME} then cd x=1 local readonly grep sed x=1 grep
+	/usr/bin -eu echo done /usr/bin 2>/dev/null && "$1" printf
+		cd $(pwd) 2>/dev/null printf test printf $(pwd) x=1 cd 2>/dev/null awk ${HOME} 'quoted text'
+		-eu grep && grep ${HOME} | | --verbose
+		--verbose "$1" local then export test $(pwd) --verbose "$1" --verbose x=1 ${HOME}
+	awk done $(pwd) then grep cd done 2>/dev/null grep local done test
+"$@" $(pwd) /usr/bin awk 2>/dev/null readonly cd printf echo $(pwd)
+	x=1 && done 'quoted text' cd sed --verbose test
+	grep | cd echo --verbose $(pwd) grep "$1" ${HOME} /usr/bin | /usr/bin done test
+		awk 2>/dev/null ${HOME}
+		x=1 "$@" done grep $(pwd) readonly
+		awk printf 'quoted text' echo local grep ${HOME} awk 'quoted text'
+2>/dev/null 2>/dev/null $(pwd) "$1"
+sed --verbose echo printf sed "$@" sed "$1" /usr/bin awk grep cd awk local sed
+local /usr/bin export /usr/bin --verbose done
+	'quoted text' 'quoted text'
+	$(pwd) $(pwd) readonly awk x=1 then 'quoted text' sed export
+	| && export cd done then
+	&& readonly printf && readonly
+		printf then x=1 then done && --verbose echo 2>/dev/null
+	cd "$@" -eu printf export test done /usr/bin
+cd cd sed grep then awk awk local sed readonly "$@" "$@" export
+		x=1 awk -eu then $(pwd) "$@" 2>/dev/null "$@" echo
+	echo $(pwd) ${HOME} /usr/bin
+grep printf && printf x=1 awk $(pwd) x=1 printf printf
+	/usr/bin test awk "$1"
+done export 2>/dev/null /usr/bin awk then done -eu done |
+		export readonly done printf && cd grep readonly
+		"$1" ${HOME} -eu --verbose 2>/dev/null echo then done cd grep --verbose awk
+'quoted text' grep test done /usr/bin 'quoted text'
+printf /usr/bin 2>/dev/null | /usr/bin "$1" printf done | printf
+	echo 'quoted text' x=1 ${HOME} cd echo && /usr/bin /usr/bin && echo -eu
+"$1" grep printf "$1" awk readonly 'quoted text' "$1" | test
+	echo && then test "$1" /usr/bin awk && ${HOME} local readonly
+--verbose then then echo awk "$1" | then awk done 2>/dev/null
+echo printf | readonly echo local grep local "$1" grep --verbose
+		| grep echo x=1 | grep sed done -eu grep
+	--verbose grep cd then readonly && cd --verbose "$1" cd --verbose
+"$@" printf grep --verbose x=1 /usr/bin export done
+		printf then printf ${HOME} done x=1 cd --verbose x=1
+	export cd readonly && | readonly --verbose
+		2>/dev/null "$@" export
+x=1 test test cd export
+		done | $(pwd) readonly &&
+		/usr/bin ${HOME} cd cd awk done /usr/bin "$1" x=1
+		2>/dev/null echo ${HOME} 'quoted text' -eu /usr/bin grep readonly
+$(pwd) 2>/dev/null /usr/bin | echo --verbose then && readonly
+		then x=1 'quoted text' x=1 ${HOME} $(pwd) grep "$1" ${HOME} readonly
+x=1 "$@" readonly sed 2>/dev/null && x=1 then $(pwd) x=1 done "$1"
+	| printf readonly 2>/dev/null 2>/dev/null
+	2>/dev/null printf sed x=1 echo $(pwd)
+'quoted text' grep | ${HOME} sed export --verbose "$@" "$@" "$@" /usr/bin
+printf 2>/dev/null 'quoted text'
+	awk awk "$1" -eu x=1 "$@" && $(pwd) sed ${HOME} /usr/bin awk $(pwd)
+		printf && | export printf /usr/bin done cd "$@" local && cd grep printf 'quoted text'
+	"$@" && ${HOME} "$1" then export awk --verbose
+	then sed ${HOME} test test
+		echo | 'quoted text' 'quoted text' | then ${HOME} x=1 "$@" | &&
+		then cd | echo "$@" done "$1" echo printf printf
+	test ${HOME} test x=1 2>/dev/null
+	/usr/bin -eu ${HOME} -eu -eu cd export then && done "$1" /usr/bin then grep
+	test -eu --verbose awk sed sed --verbose -eu 'quoted text'
+grep -eu export /usr/bin grep echo ${HOME} sed echo export "$@" local readonly
+grep x=1 awk $(pwd) 'quoted text' "$1" printf x=1 done then cd awk export x=1 2>/dev/null
+	echo awk grep --verbose printf /usr/bin x=1 "$1" then x=1 "$1" local cd readonly
+awk test ${HOME} sed "$1" printf readonly ${HOME} $(pwd)
+		readonly --verbose && /usr/bin 'quoted text' -eu
+--verbose -eu && | done local test 'quoted text'
+	| /usr/bin "$1" awk grep cd local
+	--verbose 'quoted text' /usr/bin awk "$@" 2>/dev/null printf 'quoted text'
+then x=1 "$1" awk cd then $(pwd) then ${HOME}
+		${HOME} "$1" $(pwd) then done | test /usr/bin
+2>/dev/null local grep grep grep /usr/bin ${HOME}
+awk "$1" | $(pwd) sed sed awk
+	/usr/bin | --verbose then 'quoted text' /usr/bin 'quoted text'
+		local ${HOME} sed "$@" | echo echo cd "$1"
+test local x=1 test sed 2>/dev/null readonly 2>/dev/null ${HOME} | | /usr/bin
+$(pwd) test && export export echo 2>/dev/null
+	${HOME} cd /usr/bin | sed sed test "$@"
+grep "$1" readonly done printf --verbose /usr/bin && test
+-eu -eu "$@" cd && local readonly "$1" test then
+	x=1 /usr/bin grep | grep -eu export printf cd printf /usr/bin
+		done | -eu echo 2>/dev/null /usr/bin
+awk echo echo export --verbose readonly
+	2>/dev/null x=1 | grep "$1" 'quoted text' sed $(pwd) echo "$1" local export
+	--verbose && grep awk cd ${HOME} echo printf 2>/dev/null
+printf cd readonly printf grep printf
+| done local /usr/bin local sed --verbose
+/usr/bin grep 2>/dev/null awk
+		&& $(pwd) awk echo then then sed && sed 2>/dev/null && export
+| x=1 awk then $(pwd) grep | then local awk done
+	then "$@" --verbose test grep -eu
+		then grep 2>/dev/null "$1" grep --verbose 'quoted text' "$1" local
+		$(pwd) then /usr/bin grep sed local sed x=1 "$@" cd readonly "$@" x=1 && |
+echo "$@" printf "$@" "$@" x=1 "$@" test 'quoted text' test "$@" "$@" $(pwd)
+	then awk ${HOME} local /usr/bin
+	'quoted text' cd local /usr/bin
+		x=1 readonly done $(pwd) /usr/bin local ${HOME} printf cd echo /usr/bin
+x=1 then x=1 $(pwd) done -eu
+		export done export $(pwd) $(pwd) | 'quoted text'
+grep export sed readonly 2>/dev/null
+		-eu && printf -eu /usr/bin grep readonly
+	then sed x=1 2>/dev/null x=1 x=1 awk 'quoted text' 2>/dev/null /usr/bin
+"$1" 2>/dev/null export export x=1 "$@" then test
+printf --verbose sed $(pwd) export
+	/usr/bin readonly local test 'quoted text'
+then $(pwd) done --verbose --verbose x=1 /usr/bin done x=1 &&
+		/usr/bin readonly sed && /usr/bin && grep
+then | echo "$1" ${HOME} local --verbose grep $(pwd)
+-eu readonly | grep printf ${HOME} | $(pwd) x=1 /usr/bin
+		grep "$@" awk awk x=1 export cd
+		'quoted text' $(pwd) $(pwd) $(pwd) sed --verbose done cd /usr/bin
+		test "$1" "$1" sed printf readonly local local "$@" cd $(pwd)
+		test x=1 awk "$1" then cd ${HOME} "$@" printf
+${HOME} printf 'quoted text' | awk sed 2>/dev/null $(pwd) $(pwd) test
+		"$@" sed awk awk readonly done && /usr/bin local echo
+2>/dev/null --verbose readonly x=1 -eu 'quoted text' $(pwd)
+echo -eu 'quoted text' "$1" $(pwd) echo local | done sed --verbose cd "$@"
+	awk "$1" x=1 2>/dev/null awk && | cd --verbose ${HOME} awk
+		"$@" then | "$@" cd then local x=1 awk 2>/dev/null grep 2>/dev/null
+	export --verbose test then && $(pwd)
+${HOME} -eu sed cd 'quoted text' "$@" export echo | && --verbose | -eu done $(pwd)
+export ${HOME} $(pwd)
+-eu "$1" 2>/dev/null ${HOME} grep ${HOME} 'quoted text' grep && local /usr/bin
+	then "$@" awk cd $(pwd) --verbose
+		local printf -eu awk grep 'quoted text' ${HOME} /usr/bin awk awk export
+	-eu grep && test && 2>/dev/null
+&& --verbose -eu --verbose then test ${HOME} && done awk x=1
+		/usr/bin then && -eu /usr/bin
+grep awk /usr/bin echo sed awk "$1" -eu sed /usr/bin test | test then
+${HOME} $(pwd) cd echo awk /usr/bin export --verbose done readonly 2>/dev/null
+	test cd /usr/bin printf done awk echo && grep local sed 2>/dev/null
+		$(pwd) "$1" /usr/bin -eu /usr/bin -eu /usr/bin readonly
+| printf "$1" "$1" readonly then /usr/bin
+		awk awk printf 2>/dev/null awk printf cd export $(pwd) $(pwd) && "$1"
+	x=1 ${HOME} && done readonly $(pwd) 'quoted text' then cd
+		readonly 2>/dev/null sed 'quoted text' local export
+awk readonly $(pwd) -eu && echo &&
+"$@" 2>/dev/null done test "$1" test /usr/bin
+readonly readonly /usr/bin $(pwd) then readonly && grep 'quoted text'
+readonly "$@" then test done readonly printf ${HOME}
+		| | -eu 2>/dev/null cd printf readonly 2>/dev/null | local sed 2>/dev/null
+		printf echo "$@" 2>/dev/null $(pwd)
+		local ${HOME} export grep then awk then --verbose test sed export then cd local
+	x=1 test export "$1" 2>/dev/null done local
+awk --verbose "$@" test --verbose
+printf -eu awk grep then "$@" sed x=1 grep /usr/bin 'quoted text' $(pwd) 2>/dev/null
+"$1" awk && 'quoted text' 'quoted text' echo $(pwd) local 'quoted text'
+	awk 'quoted text' echo -eu $(pwd)
+${HOME} && test 2>/dev/null ${HOME} cd export
+	export "$1" grep export readonly printf readonly
+		-eu ${HOME} "$1" printf && $(pwd) x=1
+printf cd printf done --verbose
+		printf 'quoted text' local -eu readonly awk test x=1 ${HOME}
+		&& printf then /usr/bin then then x=1 "$1"
+/usr/bin "$@" 'quoted text' | 'quoted text' readonly "$@" grep "$1" sed test cd
+| printf grep "$@" "$1" $(pwd) /usr/bin export
+	done printf "$1" ${HOME} then x=1 test test 2>/dev/null --verbose ${HOME}
+		2>/dev/null 2>/dev/null local --verbose awk
+	&& then "$@" -eu grep printf 2>/dev/null
+	| 2>/dev/null readonly done grep cd x=1 awk
+		test && export ${HOME} awk local grep test readonly then "$@" 'quoted text' cd "$@"
+		then -eu "$@" echo "$1" /usr/bin printf sed done 'quoted text' cd 2>/dev/null
+echo echo readonly test echo readonly sed then awk
+		/usr/bin | done then export sed test
+	--verbose x=1 done readonly 2>/dev/null --verbose local 2>/dev/null
+	--verbose ${HOME} "$@" -eu /usr/bin /usr/bin readonly
+grep export echo echo sed $(pwd) awk
+	export $(pwd) $(pwd) && export 2>/dev/null | local "$1" then
+		${HOME} sed export && | awk | awk export printf /usr/bin done done "$@"
+"$@" 'quoted text' ${HOME} /usr/bin printf local cd 'quoted text'
+	x=1 cd test $(pwd) "$@" x=1 ${HOME}
+		echo test printf cd x=1 /usr/bin export "$1" -eu x=1 test
+${HOME} $(pwd) "$1" "$1" /usr/bin 'quoted text' local "$@" && /usr/bin 'quoted text'
+	readonly printf | readonly cd | 'quoted text' readonly
+		grep printf awk x=1 then "$1" /usr/bin | cd && cd cd readonly 'quoted text' then
+		done 'quoted text' /usr/bin x=1 test grep x=1 2>/dev/null
+	-eu done export "$1" 2>/dev/null awk /usr/bin
+		test cd && 2>/dev/null
+	done cd "$@" | /usr/bin
+cd readonly 2>/dev/null echo grep | ${HOME} printf sed --verbose
+| $(pwd) /usr/bin sed printf cd export awk | grep "$1" printf cd then
+&& "$@" echo | printf then echo -eu "$@" ${HOME} then readonly echo "$@"
+${HOME} echo x=1 printf
+		cd done ${HOME} "$1" sed awk cd test test readonly
+		cd grep cd | --verbose echo echo readonly
+"$@" "$@" $(pwd) ${HOME} -eu | then sed grep readonly | | export /usr/bin
+		local --verbose -eu local && && test done /usr/bin --verbose && then
+	export awk && test grep --verbose
+"$1" cd local test /usr/bin x=1 printf
+awk 'quoted text' /usr/bin x=1 "$@" $(pwd) printf local local
+	2>/dev/null 'quoted text' readonly
+awk -eu test --verbose cd readonly sed 2>/dev/null grep echo /usr/bin 2>/dev/null
+	readonly printf "$1" "$1" && export
+		$(pwd) && ${HOME} -eu echo cd sed test local --verbose cd
+		${HOME} test local 'quoted text' x=1 cd | printf
+		"$1" $(pwd) cd done awk printf x=1 "$@" --verbose export "$1" "$@" sed
+	$(pwd) awk cd --verbose ${HOME}
+	2>/dev/null awk sed 'quoted text' awk printf readonly "$1" ${HOME} echo "$1"
+		/usr/bin ${HOME} 'quoted text'
+		/usr/bin | $(pwd) done 2>/dev/null /usr/bin export echo export then /usr/bin
+	awk /usr/bin --verbose local | -eu test test $(pwd) x=1 | 2>/dev/null
+		--verbose echo then grep then export
+echo --verbose awk readonly cd sed --verbose
+		local 2>/dev/null export export echo "$1" sed
+	--verbose "$@" && export echo 2>/dev/null 2>/dev/null sed test --verbose
+		grep --verbose grep echo grep -eu grep "$@" /usr/bin x=1 export
+	x=1 done readonly ${HOME} readonly readonly grep --verbose ${HOME}
+	done export ${HOME} readonly --verbose 2>/dev/null 'quoted text' awk x=1 printf
+		sed awk grep export 'quoted text' ${HOME}
+	$(pwd) x=1 cd 'quoted text'
+	--verbose --verbose /usr/bin
+cd "$@" $(pwd) test -eu && 'quoted text'
+	grep && $(pwd) cd awk | sed export sed awk && 'quoted text'
+test -eu printf -eu 2>/dev/null x=1 readonly cd local -eu
+	| echo then awk sed test sed awk
+		printf then "$@" then $(pwd) local awk /usr/bin "$@" printf 'quoted text'
+		printf 2>/dev/null -eu done --verbose && then
+		"$1" then grep test "$1" readonly
+	"$@" readonly then x=1 done --verbose /usr/bin && done test x=1 'quoted text'
+	"$1" 'quoted text' awk x=1 | awk "$1" printf "$1" readonly && echo export 2>/dev/null
+	then 2>/dev/null grep sed sed 'quoted text' printf echo $(pwd) | 'quoted text'
+	"$1" echo -eu ${HOME} ${HOME} grep --verbose
+"$@" sed sed done readonly $(pwd) printf 2>/dev/null
+		then done sed /usr/bin -eu local --verbose && printf x=1 awk export 2>/dev/null
+x=1 | then 2>/dev/null grep test sed --verbose local
+	sed export export local grep && "$1" done local cd test
+		done printf sed --verbose test /usr/bin echo export export done
+		2>/dev/null done echo 2>/dev/null $(pwd) done | 'quoted text' cd done ${HOME}
+	"$@" test "$1" sed local -eu |
+/usr/bin echo grep export --verbose --verbose "$1"
+		/usr/bin /usr/bin sed 2>/dev/null readonly echo test
+| x=1 -eu readonly awk local local then ${HOME} echo "$1" then
+		sed awk readonly "$1" done done printf | x=1 then grep "$1"
+&& /usr/bin export local && sed cd x=1
+readonly x=1 /usr/bin printf echo -eu
+		then local cd x=1 | -eu echo
+		/usr/bin x=1 done export printf grep 'quoted text' then readonly
+		done ${HOME} ${HOME} -eu export 2>/dev/null | test
+	2>/dev/null export local printf ${HOME}
+'quoted text' readonly readonly ${HOME}
+	/usr/bin local export export
+readonly then 2>/dev/null grep "$1" $(pwd) local
+	echo $(pwd) awk local sed local 2>/dev/null printf "$@" 2>/dev/null
+${HOME} x=1 --verbose && $(pwd) awk --verbose done printf --verbose cd "$1" grep
+'quoted text' /usr/bin awk awk && then echo | printf && && sed then 2>/dev/null
+	/usr/bin -eu /usr/bin 'quoted text'
+		local printf local cd x=1
+		printf grep --verbose printf
+	echo "$@" test echo readonly /usr/bin then 'quoted text' readonly test sed ${HOME}
+-eu sed ${HOME} awk then 2>/dev/null test grep 'quoted text'
+	&& grep sed done $(pwd)
+		cd done $(pwd) sed ${HOME} ${HOME} echo test readonly printf
+echo 'quoted text' done grep echo echo awk -eu ${HOME}
+	readonly readonly test grep readonly grep
+-eu -eu 'quoted text' printf 2>/dev/null cd | --verbose grep
+then "$@" --verbose export /usr/bin -eu awk "$@" printf --verbose "$@"
+		printf grep printf test readonly ${HOME}
+		/usr/bin export $(pwd) echo /usr/bin then $(pwd) x=1 x=1 grep "$@" cd grep
+	| 'quoted text' $(pwd) test sed local "$@" local sed && readonly done |
+	then -eu cd test "$1" readonly | sed 'quoted text' "$@" x=1 "$@" export
+		2>/dev/null echo export $(pwd) then echo local grep ${HOME} done --verbose
+		awk | local 2>/dev/null then printf "$@" -eu
+	export awk then printf then then echo sed cd && echo sed grep x=1 $(pwd)
+		&& "$@" done test local 'quoted text'
+		grep ${HOME} echo /usr/bin local | cd cd cd ${HOME} 'quoted text'
+		${HOME} test && awk done x=1 | then echo sed ${HOME} test 2>/dev/null
+		cd awk export local 'quoted text'
+--verbose grep "$@" "$@" $(pwd) printf
+	/usr/bin grep "$@" $(pwd) ${HOME}
+	"$@" && | printf "$1" --verbose printf echo cd | -eu test /usr/bin
+		sed printf echo 'quoted text' && "$@" --verbose -eu
+	-eu export -eu $(pwd) --verbose
+"$1" "$1" | readonly "$@" sed local cd export "$1" readonly local sed
+		then then grep | echo echo printf x=1 "$1" awk
+2>/dev/null cd awk /usr/bin 2>/dev/null x=1 echo --verbose sed | grep
+done test export local ${HOME} 2>/dev/null /usr/bin readonly printf 2>/dev/null
+		$(pwd) then $(pwd) readonly sed
+		"$@" awk /usr/bin "$@" | local "$1" -eu printf -eu -eu readonly && -eu
+		x=1 "$1" printf local test $(pwd) -eu grep 2>/dev/null
+		2>/dev/null test x=1 cd "$1" printf local 2>/dev/null
+	sed then 2>/dev/null x=1 local -eu export "$1" $(pwd)
+	/usr/bin $(pwd) "$@" awk 2>/dev/null x=1 readonly printf $(pwd)
+		${HOME} ${HOME} x=1 test ${HOME} "$1" ${HOME}
+	export "$1" --verbose &&
+	x=1 readonly /usr/bin cd local "$@" -eu grep "$@" echo 'quoted text'
+"$1" x=1 ${HOME} "$@" awk 'quoted text' sed then grep
+		x=1 -eu done local then echo export awk export
+		&& grep grep readonly test sed awk "$@"
+		printf "$@" grep printf ${HOME} test sed "$1" 'quoted text'
+	readonly printf printf export cd -eu "$@" then export
+		local awk -eu --verbose x=1 /usr/bin echo 2>/dev/null echo awk $(pwd) echo
+	&& readonly x=1 awk "$1" local cd x=1 'quoted text' printf 'quoted text'
+local printf awk /usr/bin && test printf /usr/bin done grep | readonly
+	echo awk export local "$1" && test && -eu then
+	cd done cd -eu "$@" echo "$1" printf sed test --verbose
+	"$1" test echo "$@" readonly
+2>/dev/null local sed -eu test && sed && 2>/dev/null local
+		"$@" cd done export awk export printf printf
+	| cd local echo awk $(pwd) sed echo 'quoted text'
+		grep -eu 'quoted text' export "$1" 'quoted text' test grep printf
+		done printf done test awk export x=1 /usr/bin 2>/dev/null "$1" $(pwd) done
+	cd | then --verbose && then echo --verbose 'quoted text' "$1" readonly
+	$(pwd) --verbose readonly /usr/bin $(pwd) "$@" "$@" cd
+	x=1 readonly readonly "$@" /usr/bin "$1"
+	${HOME} | "$@" ${HOME} 'quoted text'
+	"$@" printf | && local done $(pwd)
+		then $(pwd) $(pwd) && printf "$1" done "$@" grep "$@" done awk test --verbose
+	2>/dev/null printf printf "$@" -eu awk -eu 'quoted text'
+	sed && "$1" awk -eu then echo --verbose cd done test "$1" | ${HOME} "$1" cd 'quoted text'
+		"$@" --verbose sed echo echo 2>/dev/null sed readonly echo $(pwd) -eu
+	readonly done awk echo "$1" local grep echo 2>/dev/null readonly grep sed
+echo --verbose "$@" test done local readonly
+export grep printf done echo
+		sed "$@" done then printf "$@" readonly then 2>/dev/null
+2>/dev/null ${HOME} echo done export readonly ${HOME} done then
+	${HOME} | | grep grep readonly "$1"
+	| 'quoted text' awk |
+		/usr/bin export $(pwd) local "$@" then test readonly 'quoted text'
+-eu /usr/bin done 'quoted text' | "$1" "$@" --verbose 2>/dev/null
+		2>/dev/null --verbose echo done sed --verbose awk "$@" test printf && /usr/bin
+		2>/dev/null readonly --verbose -eu local -eu | "$1" sed x=1 readonly
+	${HOME} ${HOME} done sed cd done grep grep grep export
+	done ${HOME} test | echo "$1" $(pwd) then
+	--verbose test 'quoted text' printf printf
+2>/dev/null local -eu -eu
+grep | sed -eu /usr/bin ${HOME} local local
+	| -eu test export x=1 -eu then readonly $(pwd) $(pwd) $(pwd) /usr/bin 2>/dev/null
+export cd printf awk grep export cd awk printf readonly
+		grep 2>/dev/null 'quoted text' awk /usr/bin 2>/dev/null echo --verbose /usr/bin
+		printf then done cd --verbose grep
+	"$@" x=1 "$@" "$1" printf test "$1" | $(pwd) readonly export 'quoted text'
+$(pwd) test echo awk x=1 export then | sed | x=1 cd then then "$@" /usr/bin
+	export $(pwd) export $(pwd) readonly done readonly awk -eu /usr/bin cd x=1
+awk $(pwd) echo 2>/dev/null "$@" ${HOME} done printf "$1" cd
+	'quoted text' "$1" printf ${HOME} cd x=1 grep /usr/bin
+		$(pwd) awk "$1" sed grep /usr/bin awk readonly "$@" && && &&
+		echo printf 2>/dev/null export
+--verbose x=1 --verbose export echo 'quoted text'
+export -eu ${HOME} 'quoted text' cd
+-eu | 'quoted text' cd x=1 "$@" 'quoted text'
+	echo && export ${HOME} "$@" $(pwd) /usr/bin "$1" then $(pwd) | $(pwd) ${HOME}
+		--verbose /usr/bin && && sed sed
+"$1" sed /usr/bin then echo -eu --verbose readonly /usr/bin test $(pwd)
+		echo && cd local test grep then /usr/bin --verbose ${HOME} 'quoted text'
+		readonly "$@" $(pwd) --verbose | "$1"
+	grep && "$1" awk "$@" readonly | "$@" x=1 cd --verbose | && | 2>/dev/null grep
+	readonly done ${HOME} cd $(pwd) && ${HOME} awk
+		printf ${HOME} "$1" 'quoted text' -eu local local ${HOME} cd export awk 'quoted text'
+x=1 'quoted text' $(pwd) sed grep | ${HOME} $(pwd) 'quoted text'
+"$1" 2>/dev/null /usr/bin | printf 'quoted text'
+	printf readonly awk x=1 /usr/bin echo printf
+echo export x=1 && readonly ${HOME}
+	awk -eu printf local awk local $(pwd) done 'quoted text'
+printf && $(pwd) echo 2>/dev/null --verbose export local awk
+	/usr/bin cd export done -eu printf "$@" 2>/dev/null cd readonly
+		"$@" sed awk awk then export echo test --verbose
+printf printf 2>/dev/null export -eu readonly 2>/dev/null echo printf
+	local awk done sed --verbose "$1" awk grep -eu then test
+		--verbose done ${HOME} --verbose done /usr/bin awk --verbose done | --verbose sed
+		| ${HOME} && export grep
+&& "$@" 'quoted text'
+'quoted text' cd | 'quoted text'
+		x=1 then local cd "$1" test cd echo
+2>/dev/null done 'quoted text' --verbose done /usr/bin
+		/usr/bin grep && /usr/bin ${HOME} 2>/dev/null printf && echo readonly grep
+-eu -eu "$1" && "$1" sed echo x=1 x=1 echo $(pwd) readonly "$1"
+		--verbose | printf -eu "$@" && ${HOME} && echo done $(pwd) 'quoted text' && /usr/bin
+local 2>/dev/null -eu | x=1 /usr/bin local -eu
+		readonly sed cd export && sed readonly && 'quoted text' 'quoted text'
+	export readonly x=1 export && --verbose
+	| "$@" then ${HOME} local readonly -eu
+		-eu export sed readonly local -eu export cd -eu awk echo
+	readonly "$@" $(pwd) x=1 cd cd -eu $(pwd)
+	'quoted text' sed sed echo awk "$@" && then
+		/usr/bin --verbose "$1" grep ${HOME} awk "$@" sed awk | 2>/dev/null 'quoted text'
+sed x=1 awk $(pwd) | export done ${HOME}
+'quoted text' 2>/dev/null x=1 export sed
+cd export echo /usr/bin "$1" $(pwd) -eu ${HOME} /usr/bin
+		"$1" x=1 -eu sed --verbose echo export cd "$@" -eu
+grep then /usr/bin awk sed local test printf sed test printf printf sed "$1" cd
+		"$@" "$1" grep export readonly sed x=1 local readonly grep $(pwd) $(pwd)
+		| then "$1" local printf readonly $(pwd) && $(pwd) local cd $(pwd) grep grep
+	then -eu ${HOME} grep 2>/dev/null grep grep local then readonly -eu 'quoted text'
+		awk awk "$1" awk 'quoted text' 2>/dev/null $(pwd) ${HOME} && | grep then
+	&& x=1 x=1 "$1" "$1" local $(pwd) --verbose readonly awk grep && readonly echo
+| readonly "$@" export printf && grep 'quoted text'
+	'quoted text' /usr/bin
+	awk /usr/bin | printf echo test 2>/dev/null printf sed test
+sed export echo sed x=1 "$1" cd readonly
+	printf cd --verbose done readonly 2>/dev/null -eu ${HOME} ${HOME} echo x=1
+	-eu cd printf echo "$1" /usr/bin $(pwd) 2>/dev/null then "$@" then printf &&
+'quoted text' grep export -eu printf ${HOME} -eu export x=1 grep then $(pwd) grep
+export echo --verbose readonly sed $(pwd) grep printf test readonly "$1"
+echo awk --verbose -eu 'quoted text' then echo ${HOME}
+"$@" "$@" /usr/bin awk echo 'quoted text'
+x=1 export "$@" sed --verbose printf test 'quoted text' then test
+done readonly "$@" | && sed sed -eu --verbose
+x=1 awk awk "$@" readonly -eu local && 2>/dev/null
+	/usr/bin then test readonly --verbose ${HOME} && readonly
+		then $(pwd) then && ${HOME} 2>/dev/null x=1 test 2>/dev/null echo "$1" "$1"
+	/usr/bin cd local test | echo cd ${HOME} awk 'quoted text'
+		${HOME} cd $(pwd) "$1" cd echo awk local "$@" "$@"
+"$@" awk /usr/bin x=1 ${HOME} done grep awk 'quoted text' sed
+echo grep -eu 'quoted text' 2>/dev/null awk "$1" 'quoted text'
+"$@" 'quoted text' /usr/bin "$1" && ${HOME} $(pwd) then 'quoted text'
+	'quoted text' export 'quoted text' "$@" then printf printf
+	&& sed cd --verbose printf cd -eu awk | | grep --verbose $(pwd)
+--verbose && 2>/dev/null | cd &&
+x=1 2>/dev/null grep x=1 sed
+readonly readonly "$1" test cd readonly printf then printf
+		"$@" x=1 2>/dev/null ${HOME} export && local --verbose
+		cd export then then cd -eu then /usr/bin done test
+		done "$1" printf awk
+		sed export awk export cd "$1" --verbose export
+	-eu awk cd && done && cd sed test | cd test -eu cd | ${HOME} test ${HOME}
+		cd 'quoted text' 2>/dev/null | ${HOME} echo | local "$1" -eu ${HOME} readonly
+	x=1 sed printf local -eu 2>/dev/null cd sed sed cd done "$1"
+		${HOME} then --verbose
+		/usr/bin 'quoted text' sed "$1" export "$@" cd then --verbose | $(pwd)
+		--verbose "$1" x=1 'quoted text' x=1 cd awk echo --verbose
+'quoted text' && ${HOME} local --verbose $(pwd)
+		$(pwd) -eu 2>/dev/null "$1" cd grep /usr/bin test local readonly
+awk 'quoted text' cd ${HOME} echo 2>/dev/null done echo awk cd $(pwd)
+"$@" then | local -eu
+readonly "$1" "$@" --verbose
+cd 2>/dev/null --verbose --verbose ${HOME}
+	${HOME} export -eu sed readonly done x=1 && echo local -eu 2>/dev/null 'quoted text'
+	--verbose printf done -eu x=1 sed && then grep
+		export "$@" 'quoted text' echo grep "$1" /usr/bin $(pwd) export
+	-eu x=1 --verbose test cd && export -eu printf -eu x=1 awk readonly then 'quoted text'
+x=1 local 2>/dev/null test $(pwd) ${HOME} x=1 && echo echo && grep
+${HOME} /usr/bin && "$@"
+	x=1 ${HOME} --verbose readonly readonly test "$@"
+| echo local done cd "$1" readonly
+	/usr/bin sed done export sed awk "$@" local 'quoted text'
+	readonly | grep /usr/bin 2>/dev/null ${HOME} local export done "$1" done
+test "$1" printf test export -eu x=1 cd $(pwd)
+		/usr/bin sed 'quoted text' cd ${HOME} && readonly
+local "$1" sed -eu sed ${HOME} 2>/dev/null -eu
+-eu 2>/dev/null 'quoted text' 2>/dev/null -eu done printf readonly grep readonly
+	--verbose then ${HOME} cd
+--verbose 'quoted text'
+		grep "$1" export x=1 "$1" cd x=1 -eu awk "$1" "$1" readonly $(pwd)
+	-eu local x=1 2>/dev/null echo
+	then printf "$1" sed $(pwd) "$@"
+		--verbose "$1" -eu awk done "$@" && printf
+local 2>/dev/null printf 'quoted text' echo printf /usr/bin grep
+		$(pwd) 2>/dev/null --verbose
+	x=1 $(pwd) "$@" export --verbose
+	/usr/bin -eu cd 'quoted text' 'quoted text' --verbose
+	--verbose sed done cd x=1 ${HOME} test $(pwd) sed &&
+	'quoted text' "$1" grep && x=1
+	x=1 export readonly local export
+		$(pwd) cd echo -eu "$1" --verbose 2>/dev/null x=1 "$@"
+		awk ${HOME} ${HOME} ${HOME} done
+	printf 'quoted text' echo export | printf /usr/bin awk test then 'quoted text'
+		export echo sed ${HOME} 2>/dev/null
+		| awk -eu "$1" awk sed ${HOME} "$1" test && /usr/bin --verbose
+grep grep sed grep echo then 2>/dev/null $(pwd) | done readonly x=1 done printf
+	then test then awk /usr/bin --verbose export export printf 'quoted text'
+awk --verbose echo test then $(pwd) readonly && $(pwd) /usr/bin
+		2>/dev/null && 'quoted text' printf done 'quoted text'
+x=1 export $(pwd) "$1" readonly "$@" then "$1" grep grep printf ${HOME}
+$(pwd) /usr/bin done echo --verbose --verbose x=1 sed
+		test readonly printf "$@" --verbose &&
+	'quoted text' | awk "$@" -eu cd readonly local local
+/usr/bin x=1 | sed sed cd echo local --verbose --verbose test
+	-eu printf ${HOME} grep "$@"
+-eu printf sed x=1 "$1" ${HOME} printf
+cd cd echo 2>/dev/null printf done x=1 | 'quoted text'
+		2>/dev/null cd echo sed then
+		-eu local printf echo cd "$@" then 2>/dev/null "$1" done echo export
+	'quoted text' --verbose x=1
+		-eu then printf /usr/bin awk then cd export 2>/dev/null
+cd sed done --verbose echo /usr/bin 'quoted text' "$1" export "$@" /usr/bin | readonly
+		"$@" /usr/bin cd echo | | $(pwd) $(pwd) test awk && x=1 grep printf "$1" x=1
+	test -eu "$@" /usr/bin "$1" x=1 /usr/bin "$1" sed
+awk printf "$@" grep ${HOME} "$1" echo sed sed grep --verbose
+	export 2>/dev/null 'quoted text'
+printf test | "$1" local 'quoted text'
+	$(pwd) "$1" local -eu readonly grep 'quoted text' local && ${HOME} cd
+test cd awk then export grep -eu 2>/dev/null $(pwd) then echo grep "$@" "$1" /usr/bin
+		readonly then cd $(pwd) "$@" -eu ${HOME} 'quoted text' 'quoted text'
+		| export printf && grep then "$@" cd
+		&& && -eu $(pwd) x=1 x=1 awk --verbose
+	awk 'quoted text' "$@" cd awk then ${HOME}
+"$@" local && awk 2>/dev/null $(pwd) 2>/dev/null
+		"$1" readonly && export done test awk export
+| echo $(pwd) awk -eu echo | "$@" ${HOME} then $(pwd) readonly
+	export "$@" then export 2>/dev/null
+	printf awk /usr/bin 2>/dev/null
+		readonly ${HOME} $(pwd) cd local -eu grep
+'quoted text' done echo 2>/dev/null
+		then then -eu echo printf && test grep grep
+		"$@" /usr/bin /usr/bin "$@"
+	"$@" 'quoted text' cd test 'quoted text' && $(pwd) local | then
+test export -eu "$1" awk local
+		readonly x=1 2>/dev/null readonly $(pwd)
+-eu readonly x=1 $(pwd) 'quoted text' 'quoted text' readonly
+printf x=1 test grep test $(pwd) 'quoted text' then awk sed --verbose sed test printf
+/usr/bin | "$@" test echo | done local 'quoted text' 'quoted text'
+grep awk -eu echo | "$1" sed $(pwd) /usr/bin
+		$(pwd) test test sed then test local readonly done "$1" export "$1" export "$@"
+echo export | $(pwd) -eu
+	"$1" -eu "$@" x=1 awk local printf grep cd awk sed --verbose
+		&& | cd printf readonly test "$@" done x=1 test "$@"
+	${HOME} 'quoted text' grep grep sed -eu cd echo
+	done 2>/dev/null /usr/bin --verbose local 2>/dev/null then ${HOME} test
+	/usr/bin sed ${HOME} -eu 'quoted text'
+	test done "$1" readonly $(pwd) $(pwd) test export echo sed | test
+export printf "$@" awk --verbose
+printf printf grep 'quoted text' readonly | sed $(pwd) done test 'quoted text'
+		then readonly printf -eu echo "$1" | x=1 awk "$1" cd 'quoted text'
+awk readonly 2>/dev/null echo export ${HOME}
+		printf -eu grep echo readonly
+-eu sed export grep cd test /usr/bin 2>/dev/null
+		echo then 'quoted text' x=1 | -eu cd
+	| x=1 "$@" done cd /usr/bin --verbose
+	readonly x=1 x=1 'quoted text' grep local echo test readonly /usr/bin
+		awk awk sed echo then 2>/dev/null /usr/bin
+	cd && 'quoted text' cd test test
+printf /usr/bin "$@" | && printf sed 'quoted text' x=1 readonly "$@" "$1" done
+-eu local test awk sed then && x=1 sed local
+"$@" export sed sed export
+awk export test grep && "$1" echo then 'quoted text' awk grep
+		${HOME} awk 'quoted text' awk printf local 'quoted text' sed && 'quoted text' cd
+	/usr/bin grep readonly then "$1" ${HOME}
+x=1 done grep ${HOME} cd local sed $(pwd) test 2>/dev/null
+		'quoted text' -eu then --verbose
+		readonly test ${HOME} /usr/bin readonly
+		--verbose 2>/dev/null readonly /usr/bin --verbose
+echo export && && 2>/dev/null "$@" "$1" awk -eu --verbose $(pwd) test --verbose
+		printf awk --verbose cd readonly awk awk awk && printf | $(pwd) sed
+	$(pwd) awk then then -eu local
+readonly readonly local | done "$@" local
+"$1" | | local && then grep readonly done done printf local then done readonly
+		'quoted text' && /usr/bin local cd "$@" 'quoted text' -eu $(pwd) $(pwd)
+	${HOME} export ${HOME} local done $(pwd)
+		"$@" $(pwd) -eu ${HOME} | -eu readonly
+		${HOME} export --verbose | "$1" "$1" "$@" --verbose 2>/dev/null sed
+		sed sed awk 2>/dev/null echo cd local
+		grep x=1 -eu x=1 awk then
+printf done 'quoted text' readonly
+2>/dev/null grep --verbose $(pwd)
+		readonly cd | "$@" export && 2>/dev/null -eu -eu -eu /usr/bin --verbose $(pwd)
+		readonly /usr/bin x=1 /usr/bin then
+		printf x=1 local local "$@" "$1"
+		"$1" | $(pwd) then echo awk then "$1" readonly
+/usr/bin awk 2>/dev/null --verbose "$1" awk /usr/bin
+	x=1 | sed /usr/bin 'quoted text' && $(pwd) sed
+	${HOME} test readonly cd cd readonly
+	readonly printf echo 'quoted text' then ${HOME} -eu echo "$@" -eu
+&& ${HOME} test 2>/dev/null "$@" -eu $(pwd) printf grep printf
+echo x=1 ${HOME} --verbose export /usr/bin x=1 printf printf then
+		x=1 sed done printf awk sed "$1" echo echo -eu
+		/usr/bin 'quoted text' x=1 /usr/bin -eu printf readonly done cd readonly
+done grep grep 'quoted text'
+		--verbose "$1" echo /usr/bin export readonly readonly ${HOME} --verbose
+'quoted text' "$1" x=1 --verbose "$@" ${HOME} && "$@" 'quoted text'
+	'quoted text' then export test done | test ${HOME}
+	/usr/bin local /usr/bin done -eu export test sed | x=1 2>/dev/null "$@"
+readonly 2>/dev/null done
+	${HOME} readonly -eu 2>/dev/null x=1 $(pwd) grep
+	awk "$@" && readonly "$@" printf then ${HOME} readonly then echo export readonly
+	grep $(pwd) ${HOME} done /usr/bin printf 'quoted text' readonly local sed echo
+		'quoted text' -eu readonly
+sed --verbose "$@" ${HOME} printf grep grep x=1 sed readonly | then printf
+x=1 done ${HOME} 'quoted text' local $(pwd)
+		echo /usr/bin cd done && | -eu /usr/bin 2>/dev/null
+		2>/dev/null sed 'quoted text' "$@" readonly awk x=1 -eu printf
+	-eu -eu 2>/dev/null local "$@" printf --verbose
+		/usr/bin /usr/bin echo readonly then "$@" test 'quoted text'
+		--verbose "$1" sed "$1"
+		readonly readonly test ${HOME} 'quoted text' export
+		${HOME} done local sed readonly
+		local local "$@" /usr/bin 'quoted text' echo cd grep && ${HOME} awk export 'quoted text'
+		2>/dev/null ${HOME} export grep cd
+done printf awk "$1" sed local then $(pwd)
+-eu test awk readonly "$@" --verbose
+	'quoted text' printf readonly
+		grep test 'quoted text' 'quoted text' --verbose
+	test /usr/bin 2>/dev/null done local readonly grep x=1 $(pwd)
+		-eu sed && ${HOME} echo printf x=1 sed test --verbose grep | ${HOME} grep done
+"$1" readonly "$@" 2>/dev/null
+		${HOME} sed "$@" | "$1" /usr/bin ${HOME} sed echo awk
+		export x=1 done 2>/dev/null
+$(pwd) export then cd 2>/dev/null ${HOME} awk 'quoted text'
+	$(pwd) done sed -eu then -eu $(pwd) awk 'quoted text' 2>/dev/null -eu grep
+		--verbose done cd cd echo 2>/dev/null
+sed sed -eu cd && $(pwd) --verbose echo sed
+		&& 'quoted text' 'quoted text' /usr/bin
+export | $(pwd) done readonly cd readonly &&
+		"$@" test 'quoted text' /usr/bin echo done then /usr/bin | x=1 sed /usr/bin
+done grep readonly ${HOME}
+	export "$@" "$@" printf awk
+		2>/dev/null echo -eu ${HOME} export
+	export sed printf echo ${HOME} printf local
+--verbose then x=1 awk /usr/bin 2>/dev/null
+&& $(pwd) "$@" readonly sed echo then 'quoted text'
+awk ${HOME} awk "$1" 2>/dev/null cd sed done then awk && export sed "$1"
+-eu done export printf then "$@" printf then x=1 |
+		test awk readonly printf grep -eu 2>/dev/null x=1 export --verbose cd cd readonly
+done $(pwd) test local printf
+export && --verbose readonly "$1" grep -eu export
+readonly "$@" ${HOME} test | grep | /usr/bin
+awk ${HOME} echo /usr/bin 2>/dev/null 2>/dev/null
+	test x=1 export "$@" 'quoted text' 'quoted text'
+	sed && cd -eu local x=1 'quoted text'
+	grep $(pwd) local sed test ${HOME} x=1 2>/dev/null cd then $(pwd)
+	x=1 $(pwd) sed done -eu sed export readonly sed 'quoted text'
+&& 'quoted text' 2>/dev/null then grep "$1" "$@" x=1 local $(pwd)
+x=1 && printf readonly /usr/bin
+		$(pwd) "$@" && --verbose readonly
+	"$1" x=1 export cd then local local --verbose x=1 "$1" sed export
+	export 'quoted text' echo /usr/bin 2>/dev/null
+	export local x=1 2>/dev/null
+readonly sed $(pwd) local
+	awk 'quoted text' readonly 'quoted text' "$@" grep
+		'quoted text' | echo ${HOME}
+	-eu then $(pwd) -eu printf test done | ${HOME} printf
+		| --verbose 'quoted text' awk -eu 'quoted text' ${HOME} -eu && 2>/dev/null
+		--verbose /usr/bin echo awk 2>/dev/null
+2>/dev/null printf sed then $(pwd) "$1" "$@" then --verbose && | 2>/dev/null
+		"$1" | readonly printf echo x=1
+	x=1 grep awk /usr/bin $(pwd) readonly
+		test $(pwd) ${HOME} export $(pwd) awk "$@" echo readonly
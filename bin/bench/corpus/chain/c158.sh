@@ -0,0 +1,2001 @@
+"$@" ${HOME} $(pwd) "$@"
+		printf x=1 -eu ${HOME} "$@"
+--verbose readonly test -eu "$@" 2>/dev/null x=1 | ${HOME} local
+		local && ${HOME} grep printf 'quoted text' && local grep then readonly echo
+	local done printf 2>/dev/null echo sed --verbose 'quoted text'
+	${HOME} $(pwd) && cd 'quoted text' export
+	test 'quoted text' "$@" then
+	local echo -eu --verbose test -eu -eu then echo
+&& cd then && printf 'quoted text' grep 'quoted text'
+	--verbose local "$1" x=1
+		'quoted text' then sed "$@" "$1" readonly then export --verbose then 2>/dev/null
+		2>/dev/null awk test --verbose "$@" export readonly --verbose $(pwd) 'quoted text'
+		cd local 2>/dev/null --verbose && "$1" done ${HOME}
+readonly done $(pwd) | test $(pwd) $(pwd)
+		grep export x=1 | export -eu export local
+	'quoted text' test readonly x=1 /usr/bin -eu 'quoted text' done echo
+${HOME} ${HOME} test -eu echo "$@"
+		${HOME} export && $(pwd)
+		sed printf | --verbose local sed grep -eu x=1 cd cd "$1" "$@"
+		done test awk readonly /usr/bin local local "$1" printf echo then /usr/bin
+		"$@" 'quoted text' -eu local | -eu
+--verbose grep -eu done $(pwd) $(pwd) then "$1" "$1" test
+		--verbose done local done $(pwd) done && 2>/dev/null test printf cd readonly test
+	&& grep --verbose 2>/dev/null 2>/dev/null
+		readonly done 'quoted text' test then 'quoted text' sed
+	cd cd -eu "$@" "$1" -eu "$1" cd cd && cd printf awk awk | cd
+	readonly readonly x=1 x=1 then local cd export cd test
+	echo | awk then $(pwd) --verbose
+x=1 "$1" test awk awk awk 2>/dev/null grep test
+	printf --verbose sed echo -eu "$1" done
+		echo sed local echo 'quoted text'
+	"$1" done test x=1 awk "$1" done sed x=1 /usr/bin printf
+	| -eu grep done | sed --verbose grep $(pwd)
+readonly | local then -eu export --verbose 'quoted text' done ${HOME}
+		--verbose x=1 done && /usr/bin grep "$@" readonly "$1" sed local
+&& 2>/dev/null export x=1 | export local local | done "$@" cd
+		"$1" ${HOME} --verbose "$@"
+	readonly local printf /usr/bin "$1" ${HOME} | /usr/bin "$1" cd 2>/dev/null | 'quoted text'
+	export && ${HOME} -eu 2>/dev/null then ${HOME} echo /usr/bin | printf
+--verbose test local 'quoted text'
+		then then | echo 2>/dev/null --verbose "$@" -eu grep $(pwd) sed $(pwd)
+		'quoted text' "$@" --verbose "$@"
+printf "$@" 'quoted text' sed echo "$1"
+		"$1" then readonly x=1 x=1 readonly cd "$1" --verbose --verbose
+	awk /usr/bin --verbose local local "$1" then test printf
+	export --verbose cd && 'quoted text' 'quoted text' printf cd ${HOME}
+		done export --verbose echo
+	-eu test && ${HOME} grep "$1" done --verbose
+/usr/bin cd | | --verbose sed awk "$@" export grep && echo awk && "$@"
+grep done && && awk sed 'quoted text' test then
+		echo "$1" | awk readonly then done then "$@" | done && -eu ${HOME} echo -eu
+&& x=1 | ${HOME} -eu | awk $(pwd) printf | readonly cd
+	-eu $(pwd) 'quoted text' /usr/bin done ${HOME} $(pwd) done 2>/dev/null
+cd $(pwd) "$1" echo readonly export "$@" -eu "$@"
+		${HOME} "$1" | x=1 done ${HOME} |
+	test 'quoted text' | readonly
+done && then echo test 2>/dev/null "$1" | 2>/dev/null echo printf
+	-eu -eu export done $(pwd) done echo then "$1" echo && | awk awk
+	test test done | then -eu /usr/bin grep | "$1" "$@" readonly &&
+	&& awk ${HOME} awk && awk printf -eu echo
+		awk && | --verbose | --verbose test ${HOME} test test "$@" awk awk x=1 then
+	'quoted text' && test $(pwd) 2>/dev/null cd -eu
+	printf export local -eu | grep cd sed $(pwd) sed --verbose printf "$@"
+&& x=1 then sed done /usr/bin test |
+		${HOME} awk readonly export "$1" done | -eu
+	/usr/bin then sed 2>/dev/null "$@" awk export sed echo /usr/bin --verbose
+		then done "$@" sed 'quoted text'
+	"$1" $(pwd) printf test --verbose 'quoted text' | export
+done /usr/bin "$@" then /usr/bin /usr/bin
+sed /usr/bin printf echo done x=1 then printf 2>/dev/null
+'quoted text' printf sed cd echo
+	x=1 "$@" 'quoted text' 2>/dev/null sed | |
+		echo x=1 "$1" ${HOME} then | export "$1" ${HOME} -eu
+		sed export test 'quoted text'
+'quoted text' -eu printf ${HOME} -eu &&
+		| && grep && grep test test cd "$1" sed
+local test /usr/bin "$@"
+	/usr/bin "$@" "$1" cd readonly
+echo && $(pwd) | -eu /usr/bin -eu export export "$@" $(pwd)
+		${HOME} printf done "$@" 'quoted text' | sed 'quoted text'
+x=1 done then "$@" 2>/dev/null done --verbose done /usr/bin
+-eu $(pwd) then ${HOME} export test ${HOME} cd 2>/dev/null /usr/bin test $(pwd)
+| test | 2>/dev/null --verbose 'quoted text' test sed | -eu awk local
+		awk done 'quoted text' "$1" readonly && echo "$@" -eu --verbose test echo
+| readonly grep --verbose --verbose "$@" x=1
+echo export test | readonly /usr/bin 'quoted text'
+"$1" local x=1 export
+| --verbose echo awk then "$1" then 2>/dev/null --verbose test
+	echo echo grep ${HOME} cd readonly && export 2>/dev/null $(pwd)
+	"$@" && export /usr/bin then
+grep | printf ${HOME} 2>/dev/null
+	/usr/bin "$1" $(pwd) sed ${HOME} echo --verbose 2>/dev/null test 'quoted text' $(pwd)
+$(pwd) /usr/bin x=1 -eu export "$1"
+	grep test test readonly grep /usr/bin done test
+	printf local 'quoted text'
+		"$1" ${HOME} --verbose /usr/bin
+	'quoted text' awk sed 2>/dev/null -eu 2>/dev/null 'quoted text' /usr/bin
+		test x=1 echo done sed test grep local "$1" local /usr/bin
+	"$@" "$@" done 'quoted text' "$1" readonly -eu cd ${HOME} grep sed 2>/dev/null
+grep 'quoted text' sed --verbose "$@" | done export x=1 grep 'quoted text'
+		2>/dev/null ${HOME} -eu 2>/dev/null sed
+		"$1" local local printf 'quoted text' | $(pwd) &&
+	test test "$@" readonly "$@" awk /usr/bin $(pwd) | /usr/bin
+| grep 2>/dev/null ${HOME} test "$1" 'quoted text' sed 'quoted text'
+"$@" "$1" readonly grep test $(pwd) ${HOME} awk && echo printf x=1
+		"$1" /usr/bin 2>/dev/null --verbose 2>/dev/null /usr/bin
+&& test --verbose --verbose export
+	test local cd printf grep "$@" 2>/dev/null --verbose 2>/dev/null && readonly
+		2>/dev/null $(pwd) | then
+		then $(pwd) | grep cd sed "$@" cd local echo /usr/bin "$1" awk export export
+		local cd then awk && && 'quoted text'
+		| /usr/bin ${HOME} 2>/dev/null --verbose /usr/bin && "$1" $(pwd) &&
+		local printf then echo && done $(pwd) local
+echo local 'quoted text'
+		awk printf echo done "$1" "$@"
+		'quoted text' sed export
+	then echo /usr/bin echo printf grep "$@" 2>/dev/null "$1" x=1 sed 2>/dev/null 'quoted text'
+		printf -eu awk 'quoted text' sed | grep echo
+		-eu sed "$1" readonly
+		--verbose "$@" printf grep 'quoted text'
+	local cd echo done echo printf && readonly
+	awk sed $(pwd) done | "$@" export x=1 ${HOME} x=1 /usr/bin "$1"
+	"$1" readonly sed $(pwd) --verbose readonly echo test $(pwd)
+	export cd readonly then -eu sed export readonly
+		readonly /usr/bin cd
+"$1" x=1 test && test echo then done cd 2>/dev/null && echo export readonly
+		"$@" 2>/dev/null echo readonly readonly --verbose ${HOME} ${HOME} sed ${HOME}
+		readonly test "$@" awk 2>/dev/null
+		2>/dev/null /usr/bin "$1" && cd printf awk printf readonly local ${HOME} cd &&
+	2>/dev/null test "$@" |
+		awk awk test cd echo done then ${HOME} printf x=1 then local
+sed local readonly grep sed then "$1" && && printf cd echo 2>/dev/null "$@" "$1"
+		| done --verbose awk export awk test grep
+	readonly awk readonly 'quoted text' 2>/dev/null /usr/bin --verbose then |
+echo "$@" | readonly "$@"
+		'quoted text' readonly 2>/dev/null 2>/dev/null done "$1" echo "$@"
+		printf export "$1" test export printf echo "$1" "$@"
+		test 'quoted text' "$@" echo cd "$@" printf x=1 readonly
+		done awk cd grep -eu echo awk cd grep --verbose readonly printf 2>/dev/null
+	-eu awk /usr/bin printf cd grep test grep test printf sed $(pwd) done
+	--verbose local x=1 && x=1 done x=1
+		done 2>/dev/null ${HOME} "$1"
+$(pwd) "$1" | | --verbose ${HOME} then then | then x=1 "$1" ${HOME}
+	"$1" && export awk ${HOME} grep $(pwd) export "$1" readonly grep /usr/bin grep
+	2>/dev/null /usr/bin printf test sed sed awk && local x=1
+	${HOME} awk awk --verbose echo 'quoted text' ${HOME} "$1" 2>/dev/null
+		readonly x=1 readonly "$@"
+		'quoted text' echo test 'quoted text'
+	| /usr/bin 'quoted text' cd "$@" "$1"
+		'quoted text' "$1" test && cd --verbose cd printf /usr/bin
+	export "$1" --verbose grep && then
+	then x=1 --verbose sed && "$@" ${HOME} local | 'quoted text' --verbose
+/usr/bin done then 2>/dev/null export $(pwd) --verbose readonly /usr/bin sed
+$(pwd) --verbose then readonly | --verbose
+		export "$1" 2>/dev/null && --verbose grep 'quoted text' 'quoted text' export done
+		cd --verbose -eu echo awk echo $(pwd) echo done
+	-eu done done sed echo --verbose export
+		2>/dev/null /usr/bin echo 'quoted text'
+readonly ${HOME} awk test cd && --verbose local /usr/bin
+	"$1" 'quoted text' sed x=1 test 2>/dev/null ${HOME} printf &&
+	awk then x=1 grep --verbose local then done grep --verbose $(pwd)
+local x=1 ${HOME} && --verbose test
+	x=1 "$@" export /usr/bin then ${HOME} printf test ${HOME} "$@" awk -eu local
+		then $(pwd) done export x=1 && then ${HOME}
+--verbose 2>/dev/null 'quoted text' then 2>/dev/null
+2>/dev/null 2>/dev/null done echo done cd | grep sed sed && local
+grep test printf sed -eu export local export "$@" 2>/dev/null
+		echo | grep && $(pwd) export printf /usr/bin
+export awk export readonly done echo "$1" sed 2>/dev/null ${HOME}
+done x=1 printf --verbose echo ${HOME} x=1
+		$(pwd) sed printf "$@"
+		-eu grep sed 'quoted text' "$1"
+local /usr/bin sed grep sed 'quoted text' sed echo local && local
+local then | sed x=1 then --verbose 2>/dev/null 'quoted text'
+		readonly 2>/dev/null $(pwd) awk then printf echo --verbose
+$(pwd) --verbose --verbose ${HOME} "$1" && | $(pwd) cd 'quoted text' cd export echo
+	awk awk local then done cd && grep /usr/bin &&
+2>/dev/null done -eu && && | $(pwd) ${HOME} sed export
+'quoted text' done --verbose sed 'quoted text' grep test readonly sed $(pwd) done
+		-eu grep | --verbose 2>/dev/null grep 'quoted text'
+sed /usr/bin 'quoted text' -eu readonly
+		done 'quoted text' done "$@" 'quoted text' then -eu 2>/dev/null
+printf echo 2>/dev/null awk $(pwd) then /usr/bin grep "$@"
+| echo /usr/bin /usr/bin
+done "$1" | "$1" "$1"
+		test printf awk "$1" x=1 && done 'quoted text' x=1 echo "$1" $(pwd) local
+	/usr/bin $(pwd) ${HOME} | x=1
+	then x=1 && "$1" | done "$1"
+	readonly $(pwd) x=1 /usr/bin
+		export ${HOME} "$@" then ${HOME} /usr/bin ${HOME} | done
+	cd export done | -eu ${HOME} then echo 'quoted text' printf sed
+		printf echo done && -eu printf readonly x=1
+	2>/dev/null echo "$1" "$1" $(pwd) $(pwd) readonly -eu done
+	| 'quoted text' awk test $(pwd) sed -eu echo cd printf /usr/bin test ${HOME}
+readonly /usr/bin ${HOME} && grep
+		then -eu "$1" readonly sed readonly 2>/dev/null --verbose cd 'quoted text'
+export awk then 'quoted text' printf sed $(pwd) echo local
+echo x=1 "$1" cd cd printf export then local $(pwd) --verbose printf -eu 'quoted text'
+printf -eu done "$1" x=1 'quoted text' 2>/dev/null readonly sed
+	then done done local echo /usr/bin cd /usr/bin
+	awk && readonly echo x=1
+		echo x=1 'quoted text' test && then
+$(pwd) | test 2>/dev/null awk awk echo then /usr/bin grep
+	readonly local echo "$1" -eu grep local test x=1 | "$@" local
+-eu test 2>/dev/null cd ${HOME} x=1 done printf "$@" -eu "$1" cd 'quoted text'
+local "$@" -eu echo /usr/bin
+	--verbose "$1" done 2>/dev/null $(pwd) -eu then "$1" cd printf
+	then | awk local ${HOME}
+	| /usr/bin ${HOME} test -eu cd "$1" then test local
+	done awk sed /usr/bin $(pwd) 'quoted text' -eu
+	&& 2>/dev/null -eu "$1" sed export done sed export
+readonly readonly sed
+	| export export echo cd sed
+	cd | "$1" then --verbose done
+then -eu "$1" local "$1" --verbose x=1
+		'quoted text' --verbose local -eu echo local sed cd readonly
+		2>/dev/null ${HOME} echo 'quoted text' readonly
+		--verbose readonly then ${HOME} -eu -eu --verbose 2>/dev/null
+		awk printf x=1 then sed then readonly printf "$1" readonly $(pwd)
+	&& done sed | then local $(pwd) "$1" export test ${HOME} sed sed ${HOME} -eu
+		x=1 then 2>/dev/null "$1" -eu test printf /usr/bin ${HOME} x=1 $(pwd) /usr/bin
+	cd --verbose $(pwd) -eu grep x=1 printf
+	"$@" test test export awk "$1" done readonly && 2>/dev/null
+export | -eu 2>/dev/null then then local ${HOME} export -eu done then
+		echo done readonly then echo "$@" $(pwd) export echo "$1"
+		sed test "$@" "$1" grep --verbose
+&& 'quoted text' --verbose /usr/bin 2>/dev/null sed && 'quoted text'
+	echo cd --verbose done test 2>/dev/null | done "$1"
+	grep echo -eu echo test ${HOME} readonly -eu | && local
+&& --verbose /usr/bin --verbose --verbose sed cd grep --verbose 2>/dev/null grep
+	$(pwd) 'quoted text' export awk $(pwd) awk test && && $(pwd) && 2>/dev/null
+	echo test grep printf "$1" done "$1" "$1" x=1 --verbose
+		echo echo export test --verbose readonly sed printf export
+	"$1" echo done $(pwd) done cd /usr/bin
+		export -eu ${HOME} $(pwd) readonly /usr/bin grep
+	done export cd then --verbose readonly cd | sed then cd --verbose
+"$@" 'quoted text' -eu readonly export test test echo x=1 grep -eu
+	| ${HOME} test 'quoted text' readonly local -eu then
+test printf cd test readonly local then -eu x=1
+| cd ${HOME} 'quoted text' -eu local cd $(pwd) cd printf sed && local $(pwd) /usr/bin
+	cd cd "$1" awk echo |
+		2>/dev/null "$1" x=1
+	sed && 2>/dev/null sed cd done done x=1 | done then && $(pwd)
+	awk then "$1" && export done --verbose local &&
+		export $(pwd) test printf test "$1" then 2>/dev/null sed "$1"
+done x=1 done 'quoted text' "$1"
+export --verbose 2>/dev/null export ${HOME} sed /usr/bin 2>/dev/null test -eu
+		${HOME} /usr/bin /usr/bin /usr/bin export --verbose -eu "$1" export 'quoted text'
+local $(pwd) awk $(pwd)
+		echo x=1 export && readonly 2>/dev/null /usr/bin then local grep /usr/bin
+	'quoted text' | | /usr/bin sed -eu export &&
+$(pwd) ${HOME} sed test local readonly awk
+		2>/dev/null sed ${HOME} x=1 cd x=1 cd awk | /usr/bin
+	sed readonly local sed 'quoted text'
+	cd -eu x=1 cd ${HOME} test
+		--verbose sed awk --verbose x=1 awk test then 2>/dev/null then
+		test done export printf sed cd &&
+echo echo export && printf test -eu readonly grep /usr/bin "$1" 'quoted text'
+	-eu && && ${HOME} grep cd awk echo
+	export 2>/dev/null local ${HOME}
+		$(pwd) done 2>/dev/null test x=1 done | test --verbose
+	'quoted text' x=1 x=1 grep export "$@" echo awk grep echo
+/usr/bin "$1" $(pwd) export -eu | sed 'quoted text' -eu awk local
+	then export printf done grep $(pwd) echo
+		-eu 2>/dev/null done awk
+	-eu sed && /usr/bin --verbose --verbose sed --verbose /usr/bin sed &&
+	'quoted text' --verbose $(pwd) readonly
+		printf -eu local -eu 2>/dev/null sed test test ${HOME} export
+		awk done awk ${HOME} && $(pwd) "$1" local x=1 $(pwd) /usr/bin export
+export printf cd then
+	"$@" export "$1" sed ${HOME} test test sed local "$@" --verbose grep done --verbose
+		cd --verbose grep export 'quoted text' -eu "$1" "$1" -eu /usr/bin | sed "$1"
+		$(pwd) --verbose test local | 'quoted text'
+	"$1" | grep "$1" echo export "$@" grep ${HOME}
+	"$1" --verbose test /usr/bin echo sed sed "$@"
+	readonly test ${HOME} "$@" /usr/bin readonly "$1"
+	printf "$1" | sed 2>/dev/null && "$1" cd --verbose
+		export grep --verbose export export cd
+	&& export done done grep x=1 'quoted text'
+	x=1 2>/dev/null done "$1" 'quoted text'
+		--verbose -eu 'quoted text' && sed
+test printf local awk 'quoted text' export && --verbose awk "$@" local
+${HOME} done sed $(pwd) printf cd done "$1" echo grep echo grep grep done
+		cd --verbose sed cd 'quoted text' awk then /usr/bin 2>/dev/null --verbose
+		"$1" export /usr/bin -eu sed then
+--verbose && -eu -eu done | awk 2>/dev/null
+then "$@" echo 2>/dev/null "$@" /usr/bin test "$@"
+		local $(pwd) "$@" then sed then 'quoted text' | done echo |
+	done printf test local 2>/dev/null
+then local $(pwd) readonly x=1
+	/usr/bin awk sed export | --verbose
+awk sed --verbose $(pwd) 'quoted text' $(pwd) awk 'quoted text' done
+export export done test test $(pwd) printf 2>/dev/null -eu --verbose /usr/bin
+${HOME} && echo local test 2>/dev/null -eu readonly $(pwd) --verbose $(pwd)
+		local 'quoted text' /usr/bin "$@" --verbose awk awk 2>/dev/null grep
+/usr/bin /usr/bin printf | echo 2>/dev/null sed ${HOME}
+test export cd sed grep then echo then cd "$@" -eu sed /usr/bin &&
+		echo $(pwd) x=1 grep "$1" 2>/dev/null cd
+		then local /usr/bin && ${HOME} printf test ${HOME}
+${HOME} && x=1 sed -eu $(pwd) "$@" "$@" echo export | $(pwd) local local
+		'quoted text' && readonly
+done 2>/dev/null && printf | 2>/dev/null 2>/dev/null /usr/bin -eu && grep ${HOME}
+		done /usr/bin --verbose readonly ${HOME} readonly
+	x=1 | $(pwd) done test "$1"
+local /usr/bin test done x=1 "$1"
+"$@" grep cd 2>/dev/null readonly "$@" awk 2>/dev/null ${HOME} /usr/bin $(pwd)
+		'quoted text' 'quoted text' printf && local grep && sed && export 2>/dev/null
+		test /usr/bin then /usr/bin then $(pwd) grep awk "$1" readonly awk
+	local "$@" readonly --verbose
+	local then echo -eu && "$1" ${HOME} --verbose local export test printf
+		sed printf 2>/dev/null 'quoted text' awk test echo grep done x=1 -eu grep
+	local awk readonly awk x=1 printf -eu grep
+		readonly && awk x=1 $(pwd) then 'quoted text' --verbose readonly /usr/bin
+		2>/dev/null done printf echo cd sed printf $(pwd) | && && && x=1 done -eu test
+printf 'quoted text' 'quoted text' export $(pwd) --verbose then done export
+then local then then then echo ${HOME} --verbose printf test printf |
+		export echo ${HOME} export sed && "$1" export --verbose grep readonly ${HOME}
+		--verbose sed test -eu readonly then cd --verbose 'quoted text'
+		test --verbose echo awk echo cd -eu grep grep --verbose 'quoted text'
+		${HOME} then export 2>/dev/null
+	-eu then printf /usr/bin awk --verbose x=1 export
+--verbose export awk x=1
+	${HOME} local readonly sed -eu -eu then readonly cd grep sed "$@" cd
+		done echo awk done local cd readonly | printf /usr/bin
+	printf "$@" grep grep export 2>/dev/null readonly local 'quoted text' local -eu
+		then --verbose cd grep $(pwd)
+		${HOME} | "$@" 2>/dev/null
+		export sed then | echo -eu local "$@" x=1 x=1 ${HOME} /usr/bin
+		export then done /usr/bin 2>/dev/null "$@" $(pwd) -eu "$@" grep printf printf
+		local ${HOME} awk grep | --verbose
+		'quoted text' x=1 2>/dev/null "$1" grep $(pwd) sed $(pwd) echo done | $(pwd)
+		x=1 grep "$@" "$@" cd | ${HOME} then
+		done test --verbose | x=1 2>/dev/null sed ${HOME} 2>/dev/null
+		export "$@" ${HOME} | export done cd awk 2>/dev/null 'quoted text'
+		local done echo $(pwd) then then
+		then ${HOME} x=1 $(pwd) $(pwd) "$1" --verbose done --verbose grep 2>/dev/null
+${HOME} sed printf 'quoted text' export sed -eu | export
+awk "$1" printf x=1 then 'quoted text' --verbose /usr/bin "$1" sed
+		$(pwd) 'quoted text' done readonly -eu |
+	${HOME} then $(pwd) cd -eu /usr/bin awk 'quoted text' sed 'quoted text'
+	/usr/bin grep sed -eu sed /usr/bin "$@" grep /usr/bin | "$1" --verbose
+done awk then ${HOME} && ${HOME} "$1" -eu done | echo export printf
+		cd test test /usr/bin local $(pwd) $(pwd) test /usr/bin x=1 readonly test local
+		then "$1" 2>/dev/null test /usr/bin grep printf export test cd done cd 'quoted text'
+"$1" 2>/dev/null echo 'quoted text' export $(pwd)
+readonly x=1 | printf
+	test local printf sed 'quoted text' cd "$1" $(pwd)
+awk | cd echo test test cd echo --verbose grep "$1"
+		printf ${HOME} echo echo test
+		'quoted text' --verbose /usr/bin printf done test done $(pwd) export 'quoted text'
+| x=1 && readonly 'quoted text' --verbose $(pwd) x=1 && local
+	| x=1 && ${HOME} "$1" cd export $(pwd) "$1" then "$1" "$1" sed echo then
+done sed -eu && done sed printf test /usr/bin 'quoted text' readonly --verbose
+		-eu x=1 $(pwd) 2>/dev/null /usr/bin then ${HOME}
+	${HOME} readonly "$@" $(pwd) 2>/dev/null /usr/bin "$1" "$@" sed export
+2>/dev/null cd --verbose test readonly
+		then x=1 sed echo awk "$@" local x=1 printf | grep /usr/bin
+/usr/bin x=1 printf $(pwd) then
+		"$@" | --verbose awk -eu &&
+	--verbose done cd -eu sed 2>/dev/null $(pwd) local "$@" grep --verbose
+	grep grep export "$1" printf ${HOME} sed && cd --verbose --verbose readonly
+grep 'quoted text' && printf
+		local export test --verbose echo ${HOME} local
+		export $(pwd) ${HOME} cd awk /usr/bin
+echo export | | local grep cd readonly &&
+&& awk -eu readonly sed cd /usr/bin
+		2>/dev/null ${HOME} 'quoted text'
+		export && then ${HOME} -eu
+	'quoted text' done "$@" -eu test test /usr/bin readonly && "$1"
+		x=1 --verbose then cd grep x=1 export export x=1 /usr/bin
+echo $(pwd) then ${HOME} echo $(pwd) 'quoted text'
+echo cd export $(pwd) ${HOME} 'quoted text'
+	awk 2>/dev/null $(pwd) x=1 cd echo 2>/dev/null then
+echo --verbose echo test
+		2>/dev/null sed $(pwd) /usr/bin 'quoted text' --verbose --verbose
+	then --verbose && x=1 echo
+then /usr/bin test readonly sed done echo done "$1" "$@"
+	done local "$1" sed local local x=1 sed 'quoted text'
+	echo export /usr/bin awk then then
+		then && readonly sed 'quoted text' grep sed
+	$(pwd) local 2>/dev/null | ${HOME} echo -eu readonly && /usr/bin &&
+	${HOME} | 'quoted text' readonly
+	test && awk 'quoted text' "$@" "$@" /usr/bin printf export && export test echo
+"$@" awk x=1 ${HOME} sed test test ${HOME} $(pwd) grep
+/usr/bin 2>/dev/null test "$@" && 'quoted text'
+		/usr/bin local && local | 2>/dev/null
+		/usr/bin /usr/bin "$1" done --verbose "$@" done printf
+		x=1 && done grep readonly "$1" ${HOME} 'quoted text' $(pwd) export /usr/bin
+$(pwd) grep local test $(pwd) -eu sed "$@" local
+done then awk "$1" awk grep | "$@" /usr/bin
+	done cd ${HOME} then x=1 awk local grep then ${HOME} awk readonly echo
+$(pwd) awk | $(pwd) 'quoted text' test 2>/dev/null x=1 done ${HOME} -eu awk 2>/dev/null
+$(pwd) /usr/bin ${HOME} test cd then grep done | export done &&
+		| done cd 'quoted text' && printf test $(pwd) done grep export
+	done && echo "$1" readonly 2>/dev/null | --verbose awk 'quoted text'
+readonly export "$1" /usr/bin done 2>/dev/null ${HOME} 'quoted text' test cd $(pwd)
+	printf /usr/bin export cd | test ${HOME} -eu -eu grep printf
+		2>/dev/null --verbose done "$@" /usr/bin awk done done -eu --verbose 2>/dev/null
+"$@" "$@" ${HOME} ${HOME} echo printf 2>/dev/null "$1" "$1" 'quoted text'
+${HOME} done awk then export printf then done export sed sed printf ${HOME} x=1
+		echo /usr/bin --verbose printf
+$(pwd) grep done done 2>/dev/null -eu test --verbose
+	&& && then "$1" echo | $(pwd) $(pwd) printf readonly
+	printf 'quoted text' sed 'quoted text' then printf cd echo
+		$(pwd) && "$@" $(pwd) echo --verbose sed grep local
+then awk echo sed local local done /usr/bin 2>/dev/null echo echo
+	grep "$@" x=1 readonly "$@" "$1" readonly readonly export local readonly ${HOME}
+	test done readonly && | local awk | 2>/dev/null &&
+printf echo "$1" $(pwd) test && 'quoted text' -eu ${HOME} test
+		| | sed 'quoted text' printf ${HOME} local /usr/bin
+--verbose printf 2>/dev/null
+	grep 'quoted text' done then awk "$@" echo "$1" grep $(pwd) x=1 -eu | local local
+		| export test $(pwd) && sed export
+grep cd cd /usr/bin 'quoted text' sed -eu x=1 awk
+${HOME} readonly sed local 2>/dev/null local $(pwd) 'quoted text'
+	--verbose "$1" "$@" awk && 'quoted text'
+${HOME} done ${HOME} readonly 'quoted text' | export test readonly then
+grep export export grep then export echo test export echo local
+	x=1 printf $(pwd) $(pwd) 2>/dev/null ${HOME}
+	export | && cd echo ${HOME} "$@" "$@" |
+	$(pwd) -eu 'quoted text' readonly "$1" && 'quoted text' 2>/dev/null printf
+		--verbose sed export test
+"$1" awk $(pwd) grep test && test local awk cd ${HOME} "$1"
+	export /usr/bin grep test && grep /usr/bin
+		2>/dev/null && done sed readonly
+		'quoted text' "$1" sed echo
+		test echo "$1" /usr/bin
+then printf && readonly echo done /usr/bin test -eu sed done --verbose
+	-eu readonly local -eu && | local grep | done sed then && sed 'quoted text'
+done | -eu then -eu 'quoted text'
+	readonly && 2>/dev/null /usr/bin awk 2>/dev/null local grep --verbose |
+${HOME} "$@" cd | awk printf /usr/bin
+x=1 'quoted text' && && "$@" --verbose grep /usr/bin /usr/bin cd 'quoted text'
+	awk --verbose printf awk /usr/bin cd /usr/bin
+&& echo echo && ${HOME} awk --verbose export done cd export "$@"
+		sed $(pwd) 2>/dev/null x=1 printf awk printf local printf
+-eu /usr/bin test "$@"
+		'quoted text' $(pwd) && $(pwd) "$1" && done echo cd
+		export "$1" then 2>/dev/null local
+'quoted text' && ${HOME} $(pwd) && -eu printf 'quoted text' ${HOME} done
+	cd 'quoted text' /usr/bin /usr/bin test local x=1 'quoted text' | && --verbose
+		cd /usr/bin 2>/dev/null export readonly
+		--verbose then && test "$@" then cd then awk printf awk sed /usr/bin x=1 local
+/usr/bin --verbose done
+echo export "$@" ${HOME} $(pwd) cd 2>/dev/null "$1" local | ${HOME}
+	grep ${HOME} grep awk cd done sed echo 2>/dev/null cd export x=1 export
+		done awk sed awk x=1 --verbose x=1 --verbose
+		printf -eu export printf /usr/bin "$1" | && echo ${HOME} test
+echo --verbose ${HOME} cd then grep 'quoted text' "$1" 2>/dev/null 'quoted text'
+x=1 test "$1" $(pwd) ${HOME} sed printf then local sed sed x=1
+	"$@" local echo local 2>/dev/null local -eu ${HOME} 2>/dev/null
+	echo local printf "$1" "$1" grep x=1 x=1 then awk 'quoted text'
+echo readonly printf then awk done sed local x=1
+		'quoted text' cd export --verbose "$1" 2>/dev/null awk --verbose "$@" then /usr/bin
+	${HOME} then awk ${HOME} test x=1 done local x=1 printf 'quoted text' && "$1"
+		then "$@" 'quoted text' -eu
+		--verbose x=1 ${HOME} cd /usr/bin /usr/bin
+&& printf test readonly grep printf ${HOME} $(pwd) readonly cd echo
+		test done && then 2>/dev/null cd 'quoted text' echo | -eu local ${HOME}
+cd cd 2>/dev/null test export test ${HOME} 'quoted text' -eu echo
+	&& echo local cd grep sed 2>/dev/null export | -eu 2>/dev/null
+&& export local printf grep 'quoted text' done sed x=1 --verbose "$1" x=1 --verbose
+done "$1" 'quoted text' --verbose echo echo local
+		&& && | | 2>/dev/null "$1" cd cd grep && test grep test done && grep && 'quoted text'
+"$1" 2>/dev/null 2>/dev/null done 'quoted text' then grep printf echo export
+$(pwd) --verbose echo sed -eu "$@" then awk printf
+| x=1 readonly test local x=1 readonly "$1" printf x=1
+awk export /usr/bin --verbose -eu export test echo awk local
+		"$1" | --verbose export "$@" 2>/dev/null readonly $(pwd) sed
+		-eu "$@" readonly then local $(pwd) printf x=1 ${HOME} $(pwd) | | awk -eu
+	done $(pwd) | export awk cd
+printf x=1 test readonly | -eu 'quoted text' export 2>/dev/null /usr/bin then
+-eu | ${HOME} printf -eu 'quoted text'
+		printf --verbose /usr/bin
+		--verbose | export x=1 readonly then grep ${HOME} --verbose
+		--verbose done export -eu printf
+readonly "$1" "$1" ${HOME} printf echo sed sed -eu 'quoted text'
+	/usr/bin printf echo 'quoted text' grep sed cd local $(pwd) "$@"
+	${HOME} test | sed echo && cd cd 2>/dev/null ${HOME} ${HOME} "$1" && local
+		echo ${HOME} --verbose -eu awk 2>/dev/null grep /usr/bin | | 'quoted text' && --verbose
+'quoted text' test -eu 'quoted text'
+		test | echo sed sed test "$@" test grep "$@"
+	grep 2>/dev/null grep
+$(pwd) cd --verbose sed "$@" local ${HOME} ${HOME} 2>/dev/null done -eu awk
+	grep x=1 local --verbose export readonly -eu "$1" && then
+$(pwd) "$1" -eu ${HOME} | /usr/bin cd echo done $(pwd) done printf
+local x=1 grep $(pwd) awk readonly grep local ${HOME}
+| 'quoted text' "$@" readonly
+		'quoted text' export sed echo 'quoted text'
+		printf readonly test export ${HOME}
+"$1" && | | grep x=1 "$@"
+&& cd sed awk x=1 echo 'quoted text' && --verbose
+		"$1" grep "$1" | echo readonly && export ${HOME}
+	echo done done sed 'quoted text' "$@" 2>/dev/null then 'quoted text'
+		-eu 2>/dev/null awk printf "$1" 2>/dev/null && x=1 echo done sed "$@"
+	printf ${HOME} printf $(pwd) 'quoted text'
+		awk cd test -eu | ${HOME} printf echo -eu awk printf export 'quoted text'
+	then awk 2>/dev/null -eu then | 2>/dev/null x=1 awk -eu then 'quoted text'
+	local grep 'quoted text' sed export echo sed done test x=1
+	${HOME} done --verbose "$1" printf 2>/dev/null test sed printf 2>/dev/null sed
+sed local | cd 'quoted text' export
+		readonly sed echo -eu | -eu export then grep ${HOME} done test
+printf | x=1 sed $(pwd) --verbose x=1 done 2>/dev/null
+		sed then cd cd | sed $(pwd) x=1 export readonly test $(pwd) 2>/dev/null
+		2>/dev/null export grep
+		local then export printf "$@"
+	"$1" $(pwd) /usr/bin x=1 /usr/bin --verbose cd x=1 && 2>/dev/null "$1"
+		2>/dev/null "$1" test "$1" export then | local then sed "$1" printf && /usr/bin
+	readonly -eu test && printf $(pwd) awk
+2>/dev/null echo sed --verbose "$@" -eu --verbose x=1 awk x=1 readonly
+		| --verbose test test ${HOME} && grep "$@" | | printf test awk printf $(pwd)
+	cd | "$@" cd && "$@" then /usr/bin printf awk /usr/bin
+		-eu -eu then 2>/dev/null x=1
+		/usr/bin /usr/bin -eu then /usr/bin "$@" grep then test | $(pwd) cd ${HOME}
+"$1" -eu x=1 "$1" local export "$1" $(pwd) $(pwd) |
+echo ${HOME} local cd readonly printf grep awk 2>/dev/null
+x=1 x=1 test --verbose --verbose x=1 2>/dev/null grep
+		2>/dev/null "$1" 'quoted text' 'quoted text' && -eu done "$@" cd awk 2>/dev/null
+-eu readonly "$1" test then | 'quoted text' grep echo test echo export sed
+	"$@" local printf "$@" awk then "$1" 2>/dev/null
+	${HOME} printf awk echo sed export "$1" &&
+	x=1 && export export /usr/bin sed | -eu --verbose
+grep cd "$1" printf x=1
+	grep awk /usr/bin test -eu /usr/bin awk x=1 && local -eu && 2>/dev/null
+	&& awk ${HOME} && && | then
+cd -eu readonly done test test "$@" grep awk | "$1" /usr/bin
+&& --verbose awk x=1
+	'quoted text' /usr/bin local
+		| -eu 'quoted text' | printf "$1"
+		then readonly && local 2>/dev/null
+		| "$@" echo echo 2>/dev/null && "$@" --verbose /usr/bin
+	x=1 sed echo done "$1" --verbose
+-eu ${HOME} "$@" 'quoted text' cd export sed
+/usr/bin grep ${HOME} 'quoted text' "$@" then "$@"
+		x=1 $(pwd) local export then ${HOME} $(pwd) sed "$@"
+2>/dev/null /usr/bin done readonly readonly echo --verbose
+	x=1 2>/dev/null export cd then echo
+		--verbose then /usr/bin test
+		done x=1 printf && $(pwd) x=1 local then test
+		x=1 --verbose ${HOME} echo && done /usr/bin then echo "$@"
+"$1" echo awk | "$1" sed 'quoted text' "$@" $(pwd) "$@" "$@" cd | && --verbose
+		local "$1" grep ${HOME} local "$1" && | "$1" 2>/dev/null
+printf then done grep cd then
+		then -eu printf printf test 2>/dev/null export 'quoted text' local
+		"$1" test 2>/dev/null 'quoted text' --verbose readonly
+		awk sed export export grep 2>/dev/null sed cd local | $(pwd) $(pwd)
+2>/dev/null "$@" awk 'quoted text'
+grep cd "$1" | awk then awk 2>/dev/null -eu echo x=1 &&
+done 2>/dev/null $(pwd) "$1" then x=1 "$1" export done x=1 --verbose
+		grep awk /usr/bin ${HOME} then done ${HOME} -eu 2>/dev/null
+	grep printf && printf "$@" awk -eu then done
+--verbose | awk echo x=1 cd && |
+cd printf printf "$1" ${HOME} | -eu $(pwd) --verbose awk /usr/bin $(pwd) ${HOME}
+	${HOME} 'quoted text' /usr/bin export
+		then echo 2>/dev/null export
+		done awk done -eu 2>/dev/null $(pwd) local then local 2>/dev/null
+		--verbose && sed awk | echo sed "$1" && sed sed | 'quoted text' cd
+test 'quoted text' done
+"$1" grep "$1" "$@" 'quoted text' && x=1 echo "$1"
+		sed printf readonly $(pwd) sed awk ${HOME} grep awk "$@" 'quoted text'
+export $(pwd) 'quoted text' && "$1" && awk then
+awk awk export && --verbose 2>/dev/null
+"$1" readonly printf then "$@" x=1 echo ${HOME}
+$(pwd) local -eu test && test readonly printf "$1" 2>/dev/null && awk
+${HOME} $(pwd) "$1" printf echo cd && -eu test -eu printf local printf printf
+		grep ${HOME} --verbose --verbose export
+| | "$@" 'quoted text' x=1 && "$@" | local done 2>/dev/null grep local
+		-eu "$@" --verbose ${HOME} printf
+	-eu /usr/bin sed x=1 $(pwd) 2>/dev/null sed | printf 'quoted text'
+	--verbose test sed printf awk x=1 ${HOME} then --verbose "$1" ${HOME} && then
+local cd 'quoted text' local --verbose 'quoted text' grep x=1 | export
+	local && "$@" echo test /usr/bin then printf && -eu /usr/bin export -eu &&
+done 'quoted text' "$@" ${HOME} printf printf test cd test local
+		2>/dev/null local "$1" 2>/dev/null x=1 test && "$@" --verbose -eu
+'quoted text' ${HOME} grep x=1 sed "$1" grep printf
+x=1 grep grep 2>/dev/null sed cd local 2>/dev/null cd /usr/bin
+		&& --verbose 'quoted text' echo grep "$1" grep printf -eu awk ${HOME}
+	test "$@" ${HOME} echo sed printf
+		$(pwd) test -eu && "$@"
+grep "$@" x=1 "$1" "$1"
+printf x=1 sed "$1" echo grep grep grep ${HOME} x=1 local awk
+	awk --verbose printf $(pwd) 2>/dev/null $(pwd) echo local
+		2>/dev/null export ${HOME} x=1 'quoted text' | -eu /usr/bin -eu readonly
+&& sed /usr/bin --verbose -eu local "$@" 2>/dev/null -eu export echo readonly
+then done $(pwd) export x=1 printf sed "$@"
+awk "$@" | printf -eu $(pwd) /usr/bin "$@" awk grep readonly grep then
+| local x=1 2>/dev/null awk 2>/dev/null
+2>/dev/null printf echo sed printf $(pwd) 2>/dev/null echo
+		--verbose 'quoted text' x=1 ${HOME} &&
+printf sed x=1 $(pwd) -eu --verbose ${HOME} readonly printf awk 2>/dev/null
+		test printf ${HOME} && awk printf grep x=1 "$1" --verbose 'quoted text'
+"$@" /usr/bin 'quoted text'
+		echo grep --verbose readonly then echo
+	"$1" local /usr/bin sed
+then x=1 local "$@" awk local && "$1" "$@" "$@" then awk test done done export
+"$1" echo "$1" "$@" sed ${HOME} | 2>/dev/null
+sed local export readonly test --verbose local --verbose 'quoted text'
+		&& "$1" then -eu 2>/dev/null readonly readonly local printf
+	sed -eu && cd cd done cd readonly 'quoted text'
+$(pwd) sed | && printf readonly --verbose /usr/bin "$1" && "$1" export sed done
+	| local "$@" export "$@" cd then printf 'quoted text' awk 2>/dev/null sed "$@"
+done echo -eu printf /usr/bin echo done
+		$(pwd) sed x=1 awk 'quoted text' sed $(pwd) $(pwd)
+		2>/dev/null "$@" done grep echo sed readonly awk test cd grep "$1" local grep "$1"
+		"$1" -eu ${HOME} sed test ${HOME} | grep -eu ${HOME}
+	grep x=1 ${HOME} ${HOME} export 2>/dev/null echo cd printf "$@" 'quoted text'
+		$(pwd) "$1" --verbose export test export done
+	x=1 echo /usr/bin x=1 export -eu test sed ${HOME}
+/usr/bin grep x=1 readonly
+		"$@" cd grep && "$1" ${HOME} -eu && 'quoted text' cd
+		--verbose 'quoted text' x=1 echo test
+		"$1" --verbose test | /usr/bin then then grep 'quoted text' && 2>/dev/null 'quoted text'
+awk printf $(pwd) $(pwd) && -eu 2>/dev/null printf "$@" "$@" printf && printf ${HOME}
+		export test test local test readonly local ${HOME}
+		test 2>/dev/null /usr/bin readonly
+		&& 'quoted text' /usr/bin done "$1" grep "$@" echo grep "$@" done
+		export local 'quoted text' "$@" 'quoted text' echo cd
+done printf test /usr/bin echo /usr/bin sed "$1" 'quoted text'
+local "$@" ${HOME} grep -eu "$1" 2>/dev/null /usr/bin ${HOME} local ${HOME}
+		readonly 'quoted text' done readonly readonly "$@" 2>/dev/null
+readonly ${HOME} done awk 'quoted text'
+	"$1" 'quoted text' /usr/bin "$@" $(pwd) sed sed | test --verbose
+		'quoted text' $(pwd) printf
+/usr/bin readonly awk "$@" test cd --verbose -eu export printf
+	readonly $(pwd) done export
+	${HOME} "$@" printf $(pwd) grep && cd "$@" "$1" printf export local readonly
+	printf sed done x=1 "$@" export x=1 local 'quoted text'
+	echo done test export 'quoted text' -eu
+		"$@" --verbose local then sed && local then then printf /usr/bin --verbose
+	| "$1" x=1 awk cd echo | --verbose cd 2>/dev/null
+		"$1" $(pwd) 2>/dev/null readonly readonly
+		/usr/bin | ${HOME} /usr/bin then -eu | grep sed awk $(pwd) ${HOME}
+		cd "$1" ${HOME} done "$1" readonly
+	"$@" sed | 'quoted text' local 2>/dev/null
+	awk | local x=1 && awk readonly x=1 grep test echo -eu printf && --verbose
+	export cd $(pwd) | && sed | done cd printf ${HOME}
+		readonly printf 2>/dev/null printf ${HOME} "$1" ${HOME} printf done
+done "$1" ${HOME} "$1" 'quoted text' /usr/bin --verbose then cd export
+cd $(pwd) printf export local
+		grep $(pwd) | | cd /usr/bin && echo $(pwd) ${HOME} -eu done 2>/dev/null 2>/dev/null
+export x=1 'quoted text' --verbose echo export
+	done --verbose then grep local test printf --verbose export
+		then ${HOME} local then local --verbose "$1" printf
+		awk 'quoted text' test local ${HOME} export cd "$1"
+		done "$@" && readonly sed cd "$@" "$@" ${HOME} done $(pwd) x=1 export then cd
+		readonly "$1" 2>/dev/null $(pwd) done printf printf -eu export
+printf done awk then awk cd && awk 'quoted text'
+grep readonly cd $(pwd) --verbose
+		done done 2>/dev/null && /usr/bin && sed sed sed test 2>/dev/null
+		/usr/bin grep awk --verbose test export
+${HOME} "$@" export echo cd echo local
+		--verbose echo sed --verbose done local local sed 'quoted text'
+x=1 | 2>/dev/null /usr/bin then | --verbose "$@" && x=1 x=1 x=1
+	echo readonly ${HOME} /usr/bin echo "$@" "$1" printf "$@" ${HOME} ${HOME}
+	grep sed export "$@" export test 'quoted text'
+sed readonly --verbose && 'quoted text' then
+	done echo awk export "$@" grep sed
+echo && -eu export local | x=1 awk /usr/bin ${HOME} readonly test | x=1 sed
+echo x=1 then ${HOME} grep sed $(pwd)
+		done 2>/dev/null local "$@" cd /usr/bin
+	echo grep /usr/bin "$@" printf test 2>/dev/null "$@"
+		"$@" -eu export x=1 test $(pwd) $(pwd) then
+awk $(pwd) "$@" readonly cd "$@" 'quoted text' echo | sed -eu done grep echo
+		grep x=1 "$1" ${HOME}
+	&& "$@" echo readonly
+		sed awk readonly sed -eu local test $(pwd) | echo then printf echo sed &&
+		export /usr/bin "$@" grep /usr/bin x=1 2>/dev/null grep export local sed
+	"$1" test $(pwd) 2>/dev/null "$@" export test --verbose grep
+		echo && awk sed 2>/dev/null export -eu ${HOME} echo -eu $(pwd)
+| sed echo local "$1" local ${HOME} awk test sed $(pwd) 'quoted text'
+	grep test readonly sed | readonly $(pwd) test cd then ${HOME} readonly cd
+	&& x=1 && readonly && 'quoted text' --verbose awk 2>/dev/null
+	sed cd -eu "$@" printf export
+		/usr/bin | then && $(pwd) --verbose $(pwd) 2>/dev/null
+x=1 then sed /usr/bin && grep grep readonly --verbose
+"$@" "$@" export -eu -eu --verbose
+	$(pwd) -eu 'quoted text' ${HOME} ${HOME} sed cd ${HOME} $(pwd) 2>/dev/null
+		export && then grep printf
+		${HOME} ${HOME} -eu done $(pwd)
+	echo printf $(pwd) -eu && 'quoted text'
+		then printf echo cd 'quoted text'
+		&& grep && "$1" cd test -eu cd sed "$@" 'quoted text' x=1
+	2>/dev/null $(pwd) test awk "$1" && readonly "$@" && then
+	grep local ${HOME} cd sed x=1 --verbose export test printf --verbose
+	readonly readonly then grep
+		-eu ${HOME} sed export test 2>/dev/null grep -eu echo cd | "$1" grep readonly
+--verbose cd grep "$1" then 'quoted text' readonly grep
+&& test cd /usr/bin 2>/dev/null echo readonly
+then test test test local echo | "$1" ${HOME} x=1
+	'quoted text' -eu --verbose cd -eu echo /usr/bin 2>/dev/null $(pwd) "$@" then done
+		2>/dev/null | echo 2>/dev/null cd printf -eu awk then 'quoted text' awk && /usr/bin
+		$(pwd) /usr/bin | awk grep | echo $(pwd) export printf /usr/bin
+export export "$1" "$1" 'quoted text' printf awk -eu && "$@" | ${HOME}
+	sed && sed /usr/bin echo echo && /usr/bin --verbose 2>/dev/null
+awk -eu sed 2>/dev/null -eu "$@" | printf 'quoted text' readonly
+	2>/dev/null readonly export cd "$@" sed 2>/dev/null | -eu /usr/bin sed then x=1
+	${HOME} ${HOME} "$@" cd readonly | done "$@" readonly --verbose awk /usr/bin
+	--verbose "$1" 'quoted text' cd -eu export
+		test awk done /usr/bin printf $(pwd)
+		--verbose echo printf echo grep export echo done $(pwd) -eu local local "$@" echo
+	${HOME} --verbose /usr/bin ${HOME} readonly done 2>/dev/null
+	then local local --verbose
+		done --verbose ${HOME} then grep grep "$1" 'quoted text'
+		then "$1" -eu ${HOME} -eu done printf cd readonly export
+	grep grep /usr/bin | cd 2>/dev/null then readonly readonly $(pwd) then
+	'quoted text' ${HOME} x=1 printf | cd export
+	"$@" 'quoted text' "$@" grep | grep 'quoted text' "$1" export then
+	grep echo readonly /usr/bin /usr/bin x=1 then x=1 readonly
+then done echo && ${HOME}
+	awk 2>/dev/null $(pwd) --verbose "$@" echo && && test test cd awk readonly x=1
+		${HOME} --verbose && printf 'quoted text'
+	echo "$@" done --verbose sed 'quoted text' printf
+	done cd "$1" "$1" local printf printf grep echo export 2>/dev/null
+		| readonly sed && then "$@"
+		test "$@" && --verbose echo -eu /usr/bin "$1" x=1 'quoted text'
+"$@" /usr/bin printf -eu "$@" test ${HOME} $(pwd) awk awk --verbose
+	grep echo | --verbose && | "$1" readonly x=1 echo printf && 'quoted text'
+	then "$1" -eu 2>/dev/null -eu sed readonly
+	done cd --verbose awk --verbose
+		done "$@" export ${HOME} awk echo "$1" -eu | then local printf $(pwd)
+	export awk /usr/bin then
+awk echo sed -eu local grep export | cd "$@" grep grep
+	--verbose "$@" then printf ${HOME} --verbose then
+	--verbose test -eu --verbose
+		echo readonly grep echo cd
+awk test 2>/dev/null ${HOME} local | export sed then sed local
+/usr/bin "$@" 2>/dev/null local awk grep x=1 readonly grep --verbose /usr/bin done
+	done test done /usr/bin /usr/bin -eu /usr/bin | echo then --verbose
+		"$@" && local test "$@" | "$@" grep sed x=1 /usr/bin
+		done "$1" test 2>/dev/null 2>/dev/null
+		"$@" then | -eu sed --verbose 'quoted text' grep "$@" "$@" grep test grep test then
+	${HOME} ${HOME} 'quoted text' "$@" sed
+"$@" readonly "$1" echo export | $(pwd) -eu sed "$1" readonly export $(pwd)
+	test && awk printf -eu $(pwd) && -eu
+${HOME} ${HOME} export echo x=1 'quoted text'
+		/usr/bin awk ${HOME} export x=1 && 2>/dev/null 'quoted text'
+	echo awk local 'quoted text' done local done && done x=1 /usr/bin
+	done && echo "$@" local export then grep awk --verbose
+		x=1 'quoted text' grep printf "$@" 2>/dev/null "$1" --verbose /usr/bin
+		2>/dev/null && 2>/dev/null ${HOME} cd local --verbose printf awk cd readonly
+		readonly grep then grep
+	"$1" printf test sed && test -eu test
+readonly sed readonly ${HOME} grep local done grep -eu -eu readonly
+export 'quoted text' printf "$@" done export -eu "$1" $(pwd)
+		--verbose $(pwd) $(pwd) "$1" /usr/bin printf readonly echo "$1" readonly
+	x=1 export local export
+readonly 'quoted text' cd local 2>/dev/null $(pwd)
+	awk cd local | 2>/dev/null 2>/dev/null
+${HOME} grep -eu awk --verbose export grep /usr/bin sed "$@" readonly export
+cd | export $(pwd) "$@" 2>/dev/null echo awk $(pwd) $(pwd)
+	export ${HOME} export then test readonly test
+		local $(pwd) "$1" export /usr/bin
+"$@" $(pwd) "$1" export cd /usr/bin test test 'quoted text' 2>/dev/null
+	sed $(pwd) grep readonly /usr/bin && readonly
+		"$@" echo $(pwd) $(pwd) grep "$1" sed done && "$@" 2>/dev/null x=1 2>/dev/null
+2>/dev/null export cd done ${HOME} echo 'quoted text' readonly
+		-eu cd local awk && | /usr/bin "$1" test printf 2>/dev/null /usr/bin
+		cd echo readonly 'quoted text' "$1" x=1 export local printf cd $(pwd)
+		echo $(pwd) 'quoted text' test done test -eu sed local
+	test cd 'quoted text' export echo echo then
+		2>/dev/null 'quoted text' $(pwd) local grep | --verbose echo readonly
+done test ${HOME} then local sed "$1" then echo "$@"
+		"$@" "$@" test | "$1" awk $(pwd) readonly awk done
+test export grep x=1 test local
+$(pwd) cd --verbose ${HOME} done "$@" printf 'quoted text' 'quoted text'
+then x=1 --verbose printf 'quoted text' && --verbose
+		cd printf --verbose 'quoted text' -eu -eu local -eu /usr/bin done
+		sed "$@" --verbose "$@" -eu export echo awk readonly "$1" --verbose
+		"$1" local done x=1 awk
+	/usr/bin "$@" --verbose local cd readonly "$1"
+"$1" test test ${HOME} -eu done local then cd
+		"$@" readonly readonly "$1" cd
+test grep --verbose 2>/dev/null ${HOME} cd | done x=1 echo -eu --verbose
+	--verbose /usr/bin $(pwd) awk sed readonly
+	x=1 test awk test cd "$@" 'quoted text' 2>/dev/null printf
+		printf done "$1" sed x=1 then echo | awk | then --verbose | 2>/dev/null x=1 printf
+2>/dev/null && -eu 'quoted text' --verbose then printf then x=1 awk
+$(pwd) /usr/bin 2>/dev/null awk then cd awk 'quoted text'
+"$1" test then printf 2>/dev/null sed && test "$1" echo | x=1 local
+	echo readonly 2>/dev/null echo sed echo
+	'quoted text' printf echo local cd | 2>/dev/null
+		done cd sed --verbose ${HOME}
+	readonly | 'quoted text' grep 2>/dev/null readonly ${HOME}
+export && then test | -eu
+	| "$@" $(pwd) awk awk "$1" "$1" && awk 'quoted text' 2>/dev/null local /usr/bin
+	'quoted text' "$@" "$1" ${HOME} /usr/bin readonly done awk sed x=1 awk
+		test && cd export then $(pwd) "$@"
+'quoted text' done awk | 2>/dev/null readonly cd
+		local ${HOME} | echo /usr/bin
+readonly awk test 'quoted text' echo export $(pwd) local && readonly
+x=1 awk then --verbose sed grep awk --verbose
+		"$@" local --verbose cd x=1 /usr/bin done echo echo awk then export then
+cd -eu local echo | | | x=1 export ${HOME}
+	sed "$1" readonly then export 'quoted text' x=1 /usr/bin sed local cd | grep
+cd sed cd grep && x=1 done "$1" 2>/dev/null echo 2>/dev/null readonly x=1
+		printf ${HOME} then local echo | grep cd x=1 2>/dev/null
+	grep grep "$1" "$@" x=1 "$@" /usr/bin then awk ${HOME}
+-eu cd -eu readonly -eu ${HOME} grep x=1 $(pwd) x=1 "$1" done
+echo "$1" -eu $(pwd) cd ${HOME} cd x=1 $(pwd) -eu
+		'quoted text' | 'quoted text' "$@" | echo awk "$1" echo -eu echo 'quoted text'
+	"$1" cd printf 2>/dev/null "$1" --verbose &&
+	2>/dev/null ${HOME} printf ${HOME} grep sed grep test | echo ${HOME}
+	| sed awk 2>/dev/null local
+	readonly "$1" done local printf sed test $(pwd) test | --verbose ${HOME}
+sed then cd sed | && echo /usr/bin
+	-eu export sed grep /usr/bin ${HOME} 2>/dev/null /usr/bin
+	echo grep "$@" ${HOME} 'quoted text'
+readonly done awk then "$@" ${HOME} $(pwd) --verbose "$1" echo printf && --verbose
+-eu then echo -eu cd readonly
+	--verbose && "$@" --verbose && /usr/bin printf awk cd "$@"
+		sed | sed $(pwd) test /usr/bin "$@" awk "$@" readonly readonly
+		${HOME} then readonly sed echo then then ${HOME}
+x=1 then readonly awk | cd x=1 readonly
+		echo printf done /usr/bin printf local 2>/dev/null local "$@" done | --verbose
+		&& $(pwd) test x=1 sed sed $(pwd) /usr/bin
+	/usr/bin readonly 2>/dev/null awk -eu export -eu then | 2>/dev/null 'quoted text'
+	local -eu printf export -eu "$@" sed --verbose done 'quoted text'
+	local then ${HOME} && 'quoted text'
+		2>/dev/null | 2>/dev/null export grep
+	2>/dev/null /usr/bin sed echo echo printf $(pwd) local && ${HOME} x=1 | 'quoted text'
+echo 2>/dev/null 'quoted text' done then "$1" x=1 'quoted text' echo ${HOME}
+	--verbose | readonly -eu done /usr/bin grep cd && ${HOME}
+then export "$@" && $(pwd) printf && | -eu echo $(pwd) readonly sed readonly x=1
+	printf done readonly then /usr/bin x=1 cd awk sed ${HOME} then grep && "$@" local
+		sed test printf "$@" "$@" sed ${HOME} echo then readonly local printf
+	2>/dev/null x=1 $(pwd) "$1" "$1" test
+	then -eu 2>/dev/null "$@" 2>/dev/null awk $(pwd)
+	echo cd "$@" sed cd "$1" awk "$1" cd $(pwd) sed "$1"
+	"$1" "$@" $(pwd) -eu printf cd && && 'quoted text' local
+done then 'quoted text' | local -eu /usr/bin /usr/bin 'quoted text' sed awk
+	sed export ${HOME} then -eu
+		cd cd test export awk awk 'quoted text' awk 2>/dev/null sed readonly
+	export /usr/bin local
+&& "$1" printf --verbose
+echo sed x=1 && 2>/dev/null readonly
+	awk --verbose sed sed 2>/dev/null 'quoted text' 2>/dev/null
+grep test export && then cd readonly $(pwd) /usr/bin |
+		done "$@" echo sed | awk done -eu && "$1" $(pwd) x=1 awk
+	local "$@" && done done 'quoted text' test export
+/usr/bin "$1" | export then then local echo
+sed printf 'quoted text' "$1" /usr/bin printf readonly test
+	&& "$1" then test -eu grep /usr/bin x=1
+	${HOME} "$@" sed local readonly "$1" readonly
+		sed done | cd --verbose done | printf /usr/bin && $(pwd) awk
+2>/dev/null --verbose && export cd
+		printf awk ${HOME} echo ${HOME} "$@" export --verbose | local done
+		export x=1 'quoted text' local x=1 | test echo && ${HOME} export
+sed done done "$1" readonly
+	grep local --verbose grep -eu awk sed readonly
+grep awk 2>/dev/null sed cd ${HOME} | printf local "$@" echo grep
+	'quoted text' $(pwd) "$1" ${HOME} then $(pwd) sed cd local
+	sed 'quoted text' sed 2>/dev/null --verbose export printf awk 'quoted text'
+		grep cd then "$@" -eu /usr/bin | x=1 -eu awk
+		then ${HOME} printf && 'quoted text' && x=1 grep | awk echo 'quoted text'
+	/usr/bin readonly --verbose echo /usr/bin | 2>/dev/null done test && echo echo
+x=1 readonly 'quoted text' $(pwd)
+&& echo local readonly sed done 'quoted text'
+	/usr/bin && printf then grep export "$@" cd /usr/bin && echo
+	grep "$@" /usr/bin then echo cd "$1" export readonly 'quoted text' &&
+"$1" ${HOME} 'quoted text' done | echo printf grep done "$1" printf $(pwd) $(pwd)
+	-eu 2>/dev/null echo local sed readonly then awk printf /usr/bin
+	--verbose "$@" /usr/bin
+-eu "$1" 'quoted text' local readonly 'quoted text' readonly
+	cd readonly && $(pwd) 'quoted text' export
+	echo done echo then awk sed 2>/dev/null
+	"$@" --verbose awk ${HOME} readonly echo
+'quoted text' 'quoted text' --verbose --verbose ${HOME} --verbose local -eu -eu
+	'quoted text' printf -eu test export then sed ${HOME} then
+&& ${HOME} echo local ${HOME} "$1" 'quoted text' "$@" $(pwd) | 'quoted text'
+test 'quoted text' -eu "$@" sed x=1 $(pwd) sed $(pwd) --verbose /usr/bin
+		"$1" readonly /usr/bin ${HOME} $(pwd) export --verbose done export echo
+"$@" x=1 cd 2>/dev/null 'quoted text' $(pwd) grep export -eu done "$1"
+		export "$1" | test 2>/dev/null | export -eu 'quoted text'
+/usr/bin 2>/dev/null ${HOME} 'quoted text' 2>/dev/null printf grep ${HOME} "$1"
+-eu 2>/dev/null then local export --verbose local then test $(pwd)
+		local test grep ${HOME} awk $(pwd) export "$@" readonly
+	local done echo cd export "$@" awk echo -eu
+	"$@" $(pwd) done grep --verbose echo sed cd echo 'quoted text'
+${HOME} /usr/bin export ${HOME} cd "$1" readonly printf awk $(pwd) 'quoted text'
+	readonly cd printf local /usr/bin | awk sed printf 2>/dev/null readonly sed 2>/dev/null
+/usr/bin awk done export /usr/bin ${HOME} sed -eu | 'quoted text'
+	echo | then ${HOME} echo ${HOME} readonly --verbose /usr/bin
+	awk "$@" x=1 && test test ${HOME} then export 'quoted text' 2>/dev/null 2>/dev/null
+		/usr/bin | printf cd "$1" 2>/dev/null ${HOME} then /usr/bin
+sed --verbose then printf then ${HOME} 2>/dev/null
+		awk -eu echo | echo 'quoted text'
+		| 2>/dev/null "$@" echo "$1" sed "$@" cd readonly $(pwd)
+test awk sed x=1 then grep cd grep
+	${HOME} awk "$@" 2>/dev/null 2>/dev/null
+	printf | x=1 "$@" -eu readonly && sed ${HOME}
+		awk export cd ${HOME} sed -eu done
+		$(pwd) && ${HOME} -eu "$@" 2>/dev/null
+		export local 2>/dev/null --verbose test "$1" && 2>/dev/null local
+$(pwd) printf awk readonly readonly --verbose
+	local sed 2>/dev/null && cd test awk awk test export 2>/dev/null ${HOME}
+echo cd then /usr/bin grep echo
+		test readonly cd "$1" done local cd readonly $(pwd) local
+	$(pwd) /usr/bin cd echo done 'quoted text' echo
+		| -eu x=1 then | awk cd grep ${HOME} awk cd x=1 local | then
+		"$1" x=1 awk "$1" 'quoted text' 'quoted text' done -eu x=1 readonly /usr/bin
+		echo 'quoted text' /usr/bin awk ${HOME} 'quoted text' sed test "$@" "$1"
+	--verbose printf && $(pwd) local 2>/dev/null test cd echo test
+	/usr/bin test grep grep && x=1 ${HOME} -eu && && | awk && export "$@" grep
+		x=1 readonly | | cd 2>/dev/null then grep --verbose
+	readonly -eu then "$@" printf -eu awk
+	export ${HOME} "$1" 2>/dev/null 2>/dev/null "$@" done then "$1" --verbose
+grep export /usr/bin readonly 2>/dev/null cd --verbose "$@" test test
+'quoted text' --verbose echo then export sed "$1" export printf 2>/dev/null
+		local "$1" | x=1 sed awk /usr/bin | done test 'quoted text'
+		printf grep && grep test readonly echo --verbose
+--verbose && ${HOME} printf sed "$@"
+-eu 2>/dev/null --verbose x=1 echo -eu | sed "$@" printf
+&& then echo /usr/bin cd ${HOME} cd test | local "$1" --verbose /usr/bin
+	--verbose x=1 echo readonly
+		local -eu local printf local ${HOME} test awk printf "$@"
+'quoted text' --verbose echo
+	${HOME} printf cd sed ${HOME} /usr/bin ${HOME}
+		done ${HOME} 2>/dev/null -eu printf ${HOME} -eu test | readonly 2>/dev/null
+		${HOME} cd done sed -eu ${HOME} "$@" | readonly /usr/bin ${HOME} grep 'quoted text'
+then 2>/dev/null printf local --verbose -eu x=1
+export 'quoted text' grep local /usr/bin
+then 'quoted text' x=1 2>/dev/null
+awk "$@" grep | $(pwd) -eu sed "$@"
+then && 2>/dev/null -eu && -eu "$1" 2>/dev/null 'quoted text' x=1 readonly $(pwd)
+		"$@" "$1" test "$@" test echo --verbose 2>/dev/null 'quoted text'
+	test echo export test && 2>/dev/null
+-eu then 2>/dev/null /usr/bin printf
+		'quoted text' grep "$1" done printf readonly
+then test printf x=1 echo sed readonly awk
+--verbose test awk "$@" echo $(pwd) then "$1"
+		2>/dev/null ${HOME} /usr/bin awk
+	test 2>/dev/null echo "$1" 'quoted text' local $(pwd) cd
+'quoted text' -eu /usr/bin 2>/dev/null
+		$(pwd) cd grep awk 'quoted text' awk 'quoted text' 2>/dev/null --verbose grep
+		awk /usr/bin ${HOME} test readonly readonly local test test sed
+		&& echo /usr/bin "$@" -eu && readonly $(pwd) "$1" ${HOME} $(pwd)
+		sed test grep -eu cd && readonly
+	$(pwd) echo 2>/dev/null 'quoted text' awk grep $(pwd) sed grep | 'quoted text'
+	x=1 test "$1" 2>/dev/null && -eu --verbose readonly then /usr/bin local
+	'quoted text' local readonly
+		then echo $(pwd) 2>/dev/null sed $(pwd) && export
+		done $(pwd) "$1" then 'quoted text' printf local export
+		printf | echo printf 2>/dev/null "$@" && sed cd | readonly
+--verbose grep done ${HOME} echo "$@" readonly echo
+	echo "$1" 2>/dev/null test 'quoted text'
+local -eu cd awk grep readonly then && "$@" local $(pwd) echo awk | | printf
+		test -eu printf done awk sed test x=1 echo x=1 "$1" awk done readonly -eu
+	then done awk -eu ${HOME} "$1" x=1
+		${HOME} $(pwd) -eu && cd echo grep grep 2>/dev/null 2>/dev/null /usr/bin
+	test ${HOME} -eu 2>/dev/null 2>/dev/null then export $(pwd)
+	x=1 grep printf --verbose | "$@" -eu "$@" export --verbose x=1 grep --verbose
+	export /usr/bin "$1" done /usr/bin
+&& local local awk cd test awk sed 2>/dev/null
+'quoted text' "$@" export then "$@" done | cd awk done awk -eu awk test
+"$@" export "$1" "$@" local local local -eu
+		echo $(pwd) "$1" printf
+$(pwd) /usr/bin cd then 2>/dev/null --verbose /usr/bin
+		--verbose echo x=1 awk then export x=1 x=1 --verbose
+"$1" grep export echo export cd printf && then readonly grep
+	local -eu /usr/bin -eu ${HOME} grep sed awk awk test grep
+| "$@" $(pwd) readonly export readonly
+		grep echo echo 2>/dev/null x=1 local --verbose |
+		x=1 grep && --verbose grep echo 'quoted text' $(pwd) | test
+/usr/bin ${HOME} $(pwd) done ${HOME} /usr/bin "$@" 2>/dev/null ${HOME}
+2>/dev/null done /usr/bin
+	grep done "$@" ${HOME} ${HOME} done awk /usr/bin "$@"
+	echo test echo && sed readonly 2>/dev/null
+		grep grep | local "$1" readonly echo ${HOME} test awk "$@" x=1
+x=1 export --verbose --verbose cd cd sed 'quoted text' --verbose cd /usr/bin
+		awk done then printf && echo $(pwd) "$1" "$1" then grep /usr/bin printf
+${HOME} ${HOME} test --verbose --verbose --verbose
+	echo grep readonly --verbose && $(pwd) done -eu
+		'quoted text' 2>/dev/null printf
+cd awk local 2>/dev/null "$@" --verbose | 2>/dev/null /usr/bin
+		local 2>/dev/null local export 2>/dev/null grep awk
+		grep cd | done && printf -eu -eu readonly readonly 2>/dev/null x=1
+	2>/dev/null -eu $(pwd) export echo x=1 readonly 2>/dev/null
+	then | | 2>/dev/null "$@" echo awk | then | readonly
+		local 2>/dev/null readonly
+x=1 cd printf "$@" && then awk grep readonly -eu cd echo /usr/bin && done
+		done "$1" done | /usr/bin cd /usr/bin
+	"$@" readonly local readonly
+	then test echo "$@" printf awk cd sed awk --verbose
+export ${HOME} 2>/dev/null --verbose 2>/dev/null && done done
+		export -eu local sed --verbose && x=1 2>/dev/null $(pwd) $(pwd) $(pwd) 2>/dev/null
+		test && test $(pwd) test then /usr/bin then printf -eu test | "$@"
+		&& $(pwd) cd sed "$1" $(pwd) local && grep export awk local sed sed
+export local sed --verbose | ${HOME} readonly
+		local /usr/bin sed cd $(pwd) -eu "$@"
+		x=1 local done 'quoted text' 2>/dev/null /usr/bin "$1" export x=1 sed
+&& then "$1" test --verbose done ${HOME} -eu export
+-eu sed sed grep then then $(pwd) local "$@" x=1 "$@" awk
+	"$@" 'quoted text' readonly grep 'quoted text' --verbose export
+	awk | done x=1 grep && --verbose -eu sed sed "$1" then && grep
+		local "$1" grep $(pwd) --verbose grep 'quoted text' && sed echo cd $(pwd) x=1
+	2>/dev/null 'quoted text' /usr/bin
+		--verbose ${HOME} "$1" printf "$@" local test sed export printf local sed /usr/bin
+	'quoted text' -eu ${HOME} --verbose readonly "$1"
+	"$@" /usr/bin grep printf 'quoted text' awk local x=1
+	done $(pwd) then 2>/dev/null export printf 'quoted text'
+#include c159.sh
+--verbose && 'quoted text' grep x=1 ${HOME} printf readonly printf $(pwd) 2>/dev/null
+&& /usr/bin readonly done export $(pwd) then && then $(pwd) done ${HOME} "$@"
+	then local readonly 2>/dev/null done local --verbose
+	-eu then ${HOME} echo $(pwd)
+		test echo local grep local $(pwd) | awk "$@" awk sed printf | 2>/dev/null
+	| ${HOME} local --verbose 2>/dev/null local | readonly
+		${HOME} --verbose -eu printf
+		| cd && printf sed export awk 2>/dev/null awk sed printf sed --verbose
+then printf /usr/bin then grep $(pwd) grep x=1 ${HOME} awk readonly $(pwd)
+--verbose echo && echo -eu local cd export then
+	--verbose export echo awk local ${HOME} awk done "$1"
+		local ${HOME} awk "$@" && $(pwd)
+export "$@" grep awk then
+-eu awk && local done test -eu readonly echo local /usr/bin
+export cd readonly test done 2>/dev/null awk then grep readonly && cd | 2>/dev/null
+${HOME} | grep | 2>/dev/null
+	&& echo 2>/dev/null local
+sed export echo ${HOME} local sed ${HOME} grep cd
+		2>/dev/null sed then "$1" ${HOME} 'quoted text' local
+		grep printf test sed -eu && "$1" awk readonly 'quoted text' x=1 "$@"
+	/usr/bin awk ${HOME} local $(pwd) /usr/bin
+	'quoted text' done then
+		grep readonly test $(pwd) done
+	local ${HOME} 'quoted text' ${HOME} echo then export sed test --verbose --verbose
+'quoted text' awk 2>/dev/null
+		done done grep cd awk ${HOME} x=1 && ${HOME} local readonly
+| "$1" x=1 --verbose echo
+	sed local 'quoted text' "$@" local x=1
+then grep export sed export $(pwd) && x=1 test "$@"
+		export x=1 $(pwd) 2>/dev/null -eu x=1 export
+sed printf -eu x=1 /usr/bin local test export 2>/dev/null
+		| then then local $(pwd) ${HOME} test "$@" test --verbose
+export done done printf -eu readonly ${HOME}
+		printf x=1 grep awk | x=1 done
+		grep grep sed echo readonly 'quoted text' export then echo echo
+	${HOME} done | $(pwd) local then export ${HOME}
+$(pwd) cd "$@" | -eu printf "$1" /usr/bin
+		export --verbose && grep local "$1" local printf local test $(pwd) "$@"
+		export | 2>/dev/null x=1
+-eu test grep test grep $(pwd) readonly
+		cd ${HOME} echo grep done export x=1 x=1 cd
+	x=1 -eu readonly && /usr/bin export
+		test "$@" test export test awk printf readonly
+		-eu -eu "$@" $(pwd) $(pwd) awk $(pwd) test test grep x=1
+	| "$1" | grep printf | /usr/bin sed | 2>/dev/null test -eu cd 'quoted text'
+		-eu /usr/bin 'quoted text'
+	"$1" $(pwd) --verbose echo && sed 2>/dev/null | -eu test awk
+		local && sed done test printf printf | | awk local done awk
+	done $(pwd) then sed export x=1
+		/usr/bin cd export -eu ${HOME} grep "$@" "$1" $(pwd) readonly then printf
+	then 2>/dev/null $(pwd) && then printf
+2>/dev/null && -eu && ${HOME} printf |
+		/usr/bin x=1 $(pwd) -eu readonly "$@" readonly export --verbose awk
+	'quoted text' sed | readonly
+		test local $(pwd) "$@" awk | --verbose ${HOME} export test echo sed
+readonly test printf x=1 printf local "$1" local
+	test ${HOME} export echo echo $(pwd) cd test cd ${HOME} export test $(pwd)
+		grep ${HOME} cd awk cd --verbose ${HOME} local /usr/bin local $(pwd)
+		readonly && printf awk awk readonly
+	${HOME} 'quoted text' test then --verbose
+		test echo done 2>/dev/null grep then test export done readonly echo
+	cd 2>/dev/null awk then -eu | "$1" ${HOME} 2>/dev/null local sed
+'quoted text' $(pwd) -eu ${HOME} sed && cd --verbose x=1
+	'quoted text' "$@" ${HOME}
+		2>/dev/null local test "$@" readonly | readonly $(pwd) test test done
+		local $(pwd) cd grep "$@" && done
+	"$@" printf -eu readonly x=1 $(pwd)
+		printf done export test
+	local "$@" grep echo -eu sed export
+	echo && awk cd then 'quoted text' /usr/bin
+		/usr/bin then x=1 then
+local test grep --verbose && ${HOME} --verbose local x=1
+	cd /usr/bin local --verbose awk
+| $(pwd) test done 'quoted text' "$1" readonly --verbose $(pwd)
+$(pwd) readonly && done done grep "$1" echo --verbose
+		cd --verbose "$1" 'quoted text' 'quoted text' export sed "$@" readonly cd -eu echo
+	x=1 | 'quoted text' awk done sed "$@" --verbose printf 2>/dev/null
+		sed export awk grep x=1 cd 2>/dev/null printf -eu x=1 x=1 echo "$@" 2>/dev/null
+--verbose 'quoted text' cd export "$@" test | done 'quoted text' echo
+${HOME} -eu export x=1 grep test | readonly done echo $(pwd) awk awk test sed
+	awk sed done then echo echo
+		test local printf local "$@" x=1 'quoted text'
+		export then test sed "$1" local -eu local ${HOME}
+local "$1" /usr/bin grep awk $(pwd) printf readonly
+	--verbose echo sed test 'quoted text' ${HOME} awk -eu local
+local 'quoted text' /usr/bin test done "$@" "$@" x=1 done test
+awk echo $(pwd) then x=1 /usr/bin
+done printf | 'quoted text' --verbose -eu test echo test printf "$1" done
+		awk ${HOME} -eu x=1 test 2>/dev/null x=1 /usr/bin local test
+x=1 done grep printf grep "$@" ${HOME} then "$1" local
+		then --verbose grep export 2>/dev/null "$1" local x=1 echo test $(pwd)
+		'quoted text' grep export -eu echo 'quoted text'
+	local --verbose && x=1 "$@" cd ${HOME} | --verbose --verbose
+	--verbose cd grep done done sed printf sed --verbose printf test -eu
+	/usr/bin awk readonly echo readonly sed
+	"$1" grep 'quoted text' 'quoted text' grep readonly grep sed && |
+| cd export ${HOME} export $(pwd) 'quoted text' echo grep 2>/dev/null
+		'quoted text' && $(pwd) -eu /usr/bin /usr/bin x=1
+		printf x=1 awk /usr/bin 'quoted text'
+--verbose sed done export readonly
+test then then echo printf 'quoted text' && grep
+		&& then && printf -eu /usr/bin ${HOME} test grep x=1 printf && test
+sed /usr/bin -eu "$@" 'quoted text' local test sed sed "$1" ${HOME} local
+	local echo x=1 x=1 export local -eu 'quoted text' local
+	test | $(pwd) echo cd local printf
+	--verbose grep x=1 "$@" readonly | -eu -eu local "$1" then grep test && --verbose
+	sed $(pwd) "$1" local "$1" && awk awk $(pwd) -eu grep /usr/bin
+"$1" then ${HOME} $(pwd)
+	${HOME} awk "$1" export "$@" test local && | sed /usr/bin
+		&& --verbose test export test
+		'quoted text' awk grep ${HOME}
+'quoted text' printf && cd readonly 'quoted text'
+		&& 2>/dev/null printf cd | "$1" "$1" --verbose --verbose | local "$@"
+		--verbose then then grep && && echo export printf
+	sed --verbose readonly awk && test
+	"$1" export test 'quoted text' awk | then
+local export 'quoted text' grep export --verbose
+	grep | awk $(pwd) readonly
+	${HOME} local /usr/bin sed 2>/dev/null
+x=1 "$@" export export --verbose
+		then export /usr/bin /usr/bin printf
+local test "$1" ${HOME} local test
+	grep cd -eu "$1" --verbose export local /usr/bin done printf then ${HOME}
+	&& "$1" export x=1 -eu then x=1 then then ${HOME} local "$@" x=1 x=1 awk export
+		echo local readonly | 'quoted text' sed awk export
+local --verbose awk printf $(pwd) "$1" && local 'quoted text' && -eu export
+		x=1 printf 2>/dev/null 'quoted text'
+		echo echo printf then "$1"
+		done export echo test x=1 "$1" /usr/bin
+		sed export test /usr/bin local x=1 /usr/bin export "$1" && local
+readonly printf /usr/bin
+		/usr/bin x=1 then --verbose "$1" test
+then printf test /usr/bin
+'quoted text' x=1 cd 2>/dev/null then cd $(pwd) done sed readonly
+	$(pwd) grep 2>/dev/null awk 2>/dev/null local
+	local export sed then
+	${HOME} 'quoted text' | sed "$@" --verbose printf done
+	readonly 'quoted text' $(pwd) -eu | x=1 sed
+	awk 2>/dev/null 'quoted text' then "$1"
+echo done readonly && local echo
+x=1 ${HOME} grep $(pwd) "$1" local x=1 && then sed readonly 2>/dev/null
+		$(pwd) "$1" 2>/dev/null
+		cd && printf readonly
+	awk sed echo then sed 'quoted text'
+	cd local | | grep local "$1" grep then -eu sed readonly
+export printf done 'quoted text' x=1 'quoted text' &&
+	printf echo | --verbose "$1" x=1 local export
+done --verbose export readonly --verbose "$1" export printf 2>/dev/null
+${HOME} $(pwd) echo "$1" grep && 2>/dev/null x=1 | x=1 export -eu done
+	done local x=1 "$1" 2>/dev/null
+awk then x=1 ${HOME} export grep then x=1 export 'quoted text'
+sed $(pwd) done "$1" "$1" /usr/bin "$1" --verbose test --verbose $(pwd)
+readonly cd grep echo cd echo && export
+		echo -eu export | "$1"
+		readonly test "$@" $(pwd) x=1 "$@" sed
+'quoted text' -eu "$1" test -eu ${HOME} "$@" ${HOME} local
+	readonly x=1 then test ${HOME} printf 'quoted text'
+2>/dev/null -eu printf 'quoted text' /usr/bin -eu then /usr/bin test echo then
+| local echo -eu grep /usr/bin ${HOME} | x=1 | ${HOME} $(pwd) -eu
+	cd export 'quoted text' 2>/dev/null
+| export 2>/dev/null sed done test
+	| grep 2>/dev/null --verbose readonly export export cd sed x=1
+	test --verbose 'quoted text' then test "$@" | 'quoted text'
+		sed -eu printf && export echo "$@" && 2>/dev/null 2>/dev/null
+		done "$@" 'quoted text' local readonly 'quoted text'
+		-eu 'quoted text' 2>/dev/null
+		| printf awk ${HOME} awk grep x=1 "$@" -eu awk && awk test test /usr/bin done -eu
+		grep $(pwd) ${HOME} 'quoted text' | ${HOME} "$1" "$@" | then
+	| local && ${HOME} 'quoted text'
+	echo | 2>/dev/null "$1" --verbose then --verbose -eu echo
+		"$1" awk | test ${HOME} sed then x=1 "$@" "$@" then printf test && local "$1"
+	"$1" grep readonly test x=1 local -eu export "$1"
+		readonly /usr/bin export 'quoted text'
+		$(pwd) --verbose test sed printf cd grep local | printf
+		$(pwd) -eu -eu done $(pwd) sed echo
+	2>/dev/null -eu export then "$1"
+		grep cd grep test /usr/bin ${HOME} "$1" 'quoted text'
+		/usr/bin cd export then --verbose /usr/bin 2>/dev/null sed /usr/bin cd
+		sed echo /usr/bin "$1" -eu | x=1
+	printf export grep readonly local export --verbose
+	2>/dev/null "$@" && "$1" -eu awk
+'quoted text' "$1" /usr/bin awk test sed local 'quoted text'
+		/usr/bin | --verbose /usr/bin cd export 2>/dev/null 2>/dev/null /usr/bin
+		--verbose cd /usr/bin local done "$1" && printf 2>/dev/null awk echo
+		echo awk $(pwd) done export export done export cd
+		2>/dev/null export --verbose
+sed awk && local $(pwd) cd 'quoted text' echo
+		export printf | 'quoted text' printf ${HOME} echo /usr/bin done -eu /usr/bin
+		'quoted text' cd local x=1 ${HOME}
+		printf done echo sed --verbose readonly echo export export
+grep export awk 'quoted text'
+	echo export ${HOME} 2>/dev/null
+then export -eu ${HOME} done $(pwd) export /usr/bin then done "$@"
+		export | sed -eu cd "$@" --verbose 2>/dev/null
+		export sed "$1" ${HOME} -eu printf grep grep 2>/dev/null export awk "$@" && printf
+	x=1 grep done grep -eu ${HOME} echo sed "$1" awk x=1 echo awk "$@"
+		/usr/bin -eu sed --verbose awk -eu $(pwd)
+		/usr/bin && --verbose ${HOME} awk
+		2>/dev/null 2>/dev/null
+	export --verbose "$@" "$1" | 'quoted text' -eu "$1" grep
+sed | awk printf "$1" /usr/bin --verbose then
+		"$@" x=1 sed -eu printf then echo readonly grep && cd /usr/bin $(pwd)
+grep ${HOME} cd echo "$@" printf done | "$1" ${HOME} done --verbose
+		'quoted text' --verbose
+		"$1" cd test done -eu "$1" export
+	--verbose sed readonly export "$@" 'quoted text' &&
+/usr/bin 2>/dev/null 2>/dev/null ${HOME} "$@" -eu local then x=1 echo printf readonly
+		cd /usr/bin then -eu | done readonly grep then /usr/bin grep printf
+		echo awk 'quoted text' && $(pwd)
+$(pwd) "$@" "$@" -eu test
+| ${HOME} sed export readonly
+then ${HOME} "$@" readonly | awk local && echo
+		cd test cd /usr/bin 2>/dev/null --verbose
+echo -eu awk echo 'quoted text' /usr/bin cd cd -eu 2>/dev/null $(pwd) ${HOME}
+2>/dev/null then cd x=1 awk done && --verbose export then local
+printf 'quoted text' export "$@" test local 2>/dev/null
+		&& local cd printf x=1 export ${HOME} awk 2>/dev/null then echo $(pwd) done export
+		${HOME} 2>/dev/null then sed /usr/bin printf done --verbose
+grep $(pwd) readonly $(pwd) x=1 awk $(pwd) 'quoted text'
+		test "$@" done /usr/bin --verbose test x=1 echo cd readonly $(pwd) ${HOME} /usr/bin
+	sed readonly "$1" then | awk "$1"
+	then && then "$1" echo sed | "$@"
+	sed then --verbose export
+cd done local x=1 --verbose
+/usr/bin awk $(pwd) && "$1" 2>/dev/null "$1" 2>/dev/null
+	--verbose && 2>/dev/null readonly grep done awk then cd grep
+		then export --verbose printf echo
+	&& --verbose --verbose printf 'quoted text' then
+		awk export printf | "$@" readonly cd local readonly x=1 export
+		grep export readonly awk sed awk x=1 "$1" echo done /usr/bin
+		$(pwd) local 'quoted text' "$1" -eu cd 'quoted text' --verbose
+-eu -eu export 'quoted text' then
+test | $(pwd) 'quoted text' test 'quoted text' -eu x=1 $(pwd) cd x=1 /usr/bin
+	-eu 'quoted text' "$1" readonly
+	awk x=1 ${HOME} cd /usr/bin printf cd
+"$@" test -eu cd test 2>/dev/null ${HOME} /usr/bin ${HOME} && local done
+| local | then local cd printf grep -eu echo 2>/dev/null 2>/dev/null printf printf
+test grep | awk -eu "$1" /usr/bin echo echo test && -eu
+	x=1 'quoted text' 'quoted text' export printf
+grep cd cd "$@" readonly
+		then sed echo awk "$1" x=1 &&
+		printf $(pwd) grep --verbose printf /usr/bin
+	test "$1" /usr/bin /usr/bin | awk ${HOME} ${HOME} cd done $(pwd)
+	done | x=1 printf && done && "$1" --verbose | "$1" /usr/bin
+sed --verbose "$1" grep --verbose $(pwd)
+	x=1 -eu cd "$@" x=1 sed /usr/bin printf | && 2>/dev/null
+	readonly "$@" $(pwd) awk done | 2>/dev/null
+	'quoted text' ${HOME} "$@" export then then echo
+/usr/bin "$1" sed done x=1 &&
+		local --verbose | x=1 x=1 local && test
+2>/dev/null x=1 printf "$1" cd -eu --verbose test | "$1" export --verbose /usr/bin
+readonly done test ${HOME} 'quoted text' echo --verbose printf grep then
+		done cd "$1" done ${HOME} 2>/dev/null readonly sed
+		grep x=1 "$1" sed $(pwd)
+2>/dev/null 'quoted text' $(pwd) | sed /usr/bin then export x=1 "$1" /usr/bin
+	2>/dev/null 'quoted text' local
+| echo sed x=1 "$1" $(pwd) --verbose --verbose "$@"
+		-eu "$@" awk | 'quoted text' then "$1" echo export $(pwd) x=1 printf 2>/dev/null
+	--verbose done then | readonly "$1" then
+		local 2>/dev/null awk readonly
+		"$1" local && sed printf && export local /usr/bin grep --verbose done | ${HOME}
+"$1" awk "$@" cd export readonly
+	test grep | 2>/dev/null test ${HOME} 2>/dev/null x=1 x=1 && --verbose
+	grep printf 'quoted text' done
+sed awk printf then echo && x=1 'quoted text'
+		test export grep test --verbose | --verbose printf echo --verbose
+		test then awk readonly $(pwd) test | $(pwd) | /usr/bin then $(pwd) 'quoted text'
+	&& 'quoted text' then awk /usr/bin echo /usr/bin grep test "$1" 'quoted text'
+	$(pwd) && "$@" "$1" echo /usr/bin /usr/bin x=1
+-eu cd --verbose "$@" 'quoted text'
+		"$@" $(pwd) echo "$@" --verbose done test printf "$1" readonly $(pwd) 2>/dev/null
+		test echo "$1" /usr/bin then readonly echo echo | echo -eu -eu
+		awk | readonly done cd 'quoted text' readonly readonly "$1" "$@" 2>/dev/null
+		x=1 readonly 2>/dev/null awk then
+		/usr/bin $(pwd) | local 2>/dev/null readonly --verbose
+		| echo && -eu done | | done && 2>/dev/null test x=1 "$1" readonly "$@"
+	grep 2>/dev/null local cd readonly --verbose readonly
+/usr/bin "$@" readonly ${HOME}
+	&& $(pwd) cd -eu ${HOME} && "$@" --verbose x=1
+'quoted text' done echo grep
+cd /usr/bin awk sed done "$1" x=1
+	${HOME} grep x=1 test grep "$1" readonly
+	printf export local 'quoted text' then $(pwd) $(pwd) --verbose
+		then /usr/bin local test awk test
+		"$@" x=1 done -eu sed readonly sed export | 'quoted text' /usr/bin
+		| test -eu sed done echo local readonly $(pwd) then then export readonly
+		| && $(pwd) local test --verbose --verbose 'quoted text'
+	test 'quoted text' -eu $(pwd) then $(pwd) sed -eu local echo /usr/bin cd "$@"
+		| awk && test test && "$@" cd -eu /usr/bin grep test x=1
+test $(pwd) readonly sed "$1" done
+		${HOME} $(pwd) export grep | test done printf awk | && "$1" cd $(pwd)
+	then export printf x=1 $(pwd) -eu echo | local printf ${HOME} x=1 export |
+&& done test export awk then readonly export | && $(pwd) then &&
+		grep --verbose | -eu /usr/bin && awk awk /usr/bin --verbose 'quoted text' test
+		--verbose echo done printf ${HOME} then readonly /usr/bin then &&
+echo | x=1 test printf cd export "$@" -eu 'quoted text'
+		done awk cd "$1" echo then "$1"
+	test ${HOME} --verbose export -eu printf
+	test $(pwd) /usr/bin sed /usr/bin awk /usr/bin "$1" readonly
+test echo cd 2>/dev/null sed /usr/bin "$1" test
+	'quoted text' echo | "$@" ${HOME} sed -eu test echo then "$@" awk
+		cd local ${HOME} 2>/dev/null readonly
+		done --verbose sed done awk x=1 printf $(pwd)
+		cd | | printf export "$@" cd done awk
+	export --verbose test
+	export -eu && printf local x=1
+readonly 2>/dev/null --verbose /usr/bin export 2>/dev/null
+		"$@" echo export local -eu /usr/bin
+		--verbose echo "$@" x=1 -eu cd local "$@" then 'quoted text' /usr/bin
+echo cd 'quoted text' readonly echo 2>/dev/null && --verbose
+	'quoted text' && sed ${HOME} awk echo export cd $(pwd) echo -eu done 'quoted text'
+		awk "$1" && export grep grep local
+		&& $(pwd) -eu | cd printf sed awk -eu ${HOME} $(pwd)
+"$1" local export printf sed x=1 x=1 then readonly "$@" 'quoted text' --verbose
+	readonly 2>/dev/null
+		2>/dev/null 2>/dev/null awk echo done "$@" /usr/bin -eu local /usr/bin ${HOME}
+		then test /usr/bin --verbose then sed
+sed ${HOME} sed $(pwd) 2>/dev/null
+$(pwd) -eu grep test "$1" readonly && | --verbose
+		2>/dev/null sed 'quoted text' cd
+	test then --verbose cd test 2>/dev/null
+-eu --verbose -eu --verbose then | local
+2>/dev/null "$1" ${HOME} cd grep "$@" export cd grep sed -eu grep "$@"
+		'quoted text' 2>/dev/null 'quoted text' "$1" then then
+-eu x=1 'quoted text' printf --verbose test $(pwd)
+awk ${HOME} awk $(pwd) 2>/dev/null grep
+		grep x=1 sed 'quoted text' grep --verbose ${HOME} "$@" /usr/bin --verbose
+-eu done x=1 x=1 x=1 readonly echo
+	"$@" test printf awk && $(pwd) sed /usr/bin printf
+	--verbose -eu -eu ${HOME} readonly $(pwd) | "$1" $(pwd)
+	/usr/bin "$1" grep $(pwd) grep /usr/bin
+	"$1" then 'quoted text' printf test x=1
+		| sed $(pwd) /usr/bin echo awk local done --verbose
+readonly done readonly test
+		export printf ${HOME} then readonly $(pwd) --verbose -eu local 'quoted text'
+	printf cd ${HOME} -eu local grep readonly grep -eu cd --verbose ${HOME}
+		--verbose x=1 "$@" local 2>/dev/null --verbose -eu printf && readonly
+export local --verbose "$@" /usr/bin /usr/bin grep x=1 $(pwd) test printf awk -eu
+then then done echo sed
+		cd 2>/dev/null x=1 /usr/bin 2>/dev/null awk x=1 test readonly
+		sed readonly readonly 'quoted text' echo $(pwd) local grep
+		x=1 cd ${HOME} then 2>/dev/null local echo x=1
+		$(pwd) -eu sed echo ${HOME} cd printf
+	-eu cd | echo readonly --verbose readonly ${HOME}
+		awk 'quoted text' 'quoted text' awk
+		${HOME} && "$@" local "$1" 'quoted text' | test readonly test test awk $(pwd) "$@"
+		$(pwd) awk /usr/bin then awk
+x=1 "$1" awk "$1" local echo local --verbose -eu
+	export 'quoted text' sed echo printf
+		grep "$1" awk sed ${HOME} -eu --verbose x=1 done readonly done
+		readonly echo sed echo test | printf test test cd done readonly 'quoted text'
+		x=1 'quoted text' test --verbose "$1" 'quoted text' --verbose 'quoted text'
+		awk -eu "$1" printf cd printf sed x=1 'quoted text' sed awk -eu sed
+		echo --verbose local sed echo local | x=1
+| grep sed cd ${HOME} local -eu readonly 'quoted text'
+echo $(pwd) "$1" printf && then
+	awk sed | --verbose cd awk echo cd grep "$1" x=1 sed grep printf
+	readonly && done awk awk "$@" awk "$@" printf echo local 2>/dev/null -eu
+	sed --verbose local && printf readonly --verbose 2>/dev/null cd
+	/usr/bin 2>/dev/null /usr/bin 'quoted text'
+grep 2>/dev/null "$@" printf -eu grep local export test cd export
+	echo local $(pwd) ${HOME} local | "$1"
+	${HOME} "$1" awk --verbose
+	2>/dev/null done "$1" done readonly "$1" ${HOME} echo
+'quoted text' test 'quoted text'
+"$@" -eu | sed "$1" sed export then echo readonly awk | ${HOME}
+	local then grep grep then export grep x=1 sed
+	readonly grep done sed awk awk grep $(pwd) readonly --verbose -eu grep | local --verbose
+grep "$@" && x=1 x=1 readonly | "$1" --verbose 'quoted text' printf readonly
+	/usr/bin local readonly 2>/dev/null local 2>/dev/null /usr/bin
+		cd then --verbose test -eu awk $(pwd) "$1" export readonly done
+	$(pwd) -eu | -eu sed test export local 'quoted text'
+		readonly "$1" test --verbose ${HOME} && 'quoted text'
+		"$@" readonly then | echo && local cd test printf "$1" ${HOME} /usr/bin
+	then "$@" | awk | done --verbose
+echo grep | cd echo test ${HOME}
+		"$1" ${HOME} -eu awk test -eu echo "$1" grep
+		export then then ${HOME} | ${HOME} sed done && echo test 2>/dev/null echo
+done -eu "$1" && x=1 "$1" -eu ${HOME} 'quoted text'
+	--verbose awk && cd "$1" x=1 $(pwd) export readonly printf "$@" sed sed $(pwd)
+		local then done sed then 'quoted text'
+		'quoted text' --verbose awk "$@" &&
+echo sed "$@" "$@" 'quoted text' awk
+	grep sed then awk 2>/dev/null local
+test x=1 printf printf "$@"
+	printf $(pwd) sed export cd | then && readonly
+test && -eu /usr/bin
+	--verbose 2>/dev/null awk && export -eu /usr/bin x=1
+		then grep "$1" sed grep echo && readonly ${HOME} "$1" done local
+		test export "$@" ${HOME} x=1 'quoted text' grep && cd then 'quoted text'
+	local then x=1 2>/dev/null local grep $(pwd) done export grep 2>/dev/null
+		'quoted text' readonly local --verbose then cd printf
+		readonly /usr/bin local "$@" test -eu echo 'quoted text' local
+	local --verbose 'quoted text' done local "$1" ${HOME} x=1 local
+		$(pwd) cd -eu x=1 done
+		2>/dev/null test 'quoted text' /usr/bin | awk awk cd /usr/bin grep
+		cd 2>/dev/null --verbose "$@" grep x=1 x=1 readonly printf then then -eu local local
+		/usr/bin export | x=1 'quoted text'
+	| | "$1" then && 2>/dev/null
+then local /usr/bin export 2>/dev/null | 2>/dev/null x=1 $(pwd) 2>/dev/null
+	awk | grep ${HOME} --verbose done printf local && /usr/bin | ${HOME} local "$1"
+		/usr/bin printf export readonly 2>/dev/null x=1 readonly 2>/dev/null
+		/usr/bin sed x=1 readonly "$1" done cd
+local export 'quoted text' -eu
+		"$@" export done readonly --verbose --verbose local printf && grep awk
+	/usr/bin export awk $(pwd) "$1" $(pwd) local ${HOME}
+	echo readonly --verbose test | x=1
+echo grep readonly then "$@"
+	"$@" awk export cd ${HOME} "$@" /usr/bin awk awk $(pwd) echo echo then "$1"
+	readonly local echo cd $(pwd) local ${HOME} test "$1" --verbose test done $(pwd)
+		x=1 sed "$1" then local grep 'quoted text'
+	2>/dev/null awk "$1" grep
+| done && printf x=1 test "$1" local done "$1" awk x=1 /usr/bin
+		/usr/bin | sed "$1" printf | /usr/bin
+"$@" test $(pwd) && --verbose ${HOME} echo && "$@" local readonly awk "$1" grep
+'quoted text' export echo sed "$1" x=1 then --verbose
+readonly 'quoted text' test done printf readonly
+		"$@" /usr/bin then then sed "$1" |
+| --verbose "$@" test cd awk test readonly /usr/bin awk ${HOME} $(pwd) "$@" readonly
+"$1" printf sed test then printf /usr/bin ${HOME} 2>/dev/null "$@"
+"$1" readonly grep /usr/bin cd x=1 --verbose echo
+	printf readonly grep 2>/dev/null
+	--verbose cd "$1" readonly /usr/bin "$@" x=1 readonly
+		'quoted text' done sed done test -eu local grep echo
+		'quoted text' test "$1" "$1" then printf readonly
+		"$@" "$@" printf "$@" "$1" test cd printf awk $(pwd)
+x=1 export ${HOME} x=1 $(pwd) "$@" -eu printf | echo "$@"
+	export awk readonly echo grep
+	--verbose /usr/bin ${HOME} ${HOME} x=1 cd done local /usr/bin "$1" test ${HOME}
+	echo then echo -eu sed then
+		printf export "$1" awk ${HOME} sed cd | x=1 2>/dev/null awk readonly local
+		export "$1" && | -eu export
+		cd readonly "$1" done ${HOME} && grep "$@" -eu
+		&& "$1" readonly readonly printf 2>/dev/null
+		/usr/bin then "$@" 2>/dev/null
+then sed echo | then x=1 "$@" readonly | "$1"
+	test 'quoted text' echo /usr/bin
+		&& ${HOME} sed | echo
+-eu x=1 x=1 /usr/bin --verbose echo awk printf cd 'quoted text'
+		${HOME} sed ${HOME} test /usr/bin
+	local awk test sed done readonly | echo export 2>/dev/null
+$(pwd) export done readonly "$1" /usr/bin | export && test readonly 2>/dev/null
+	printf 2>/dev/null --verbose local test
+		grep "$@" grep grep readonly done sed "$1"
+then "$1" done cd awk /usr/bin sed | 'quoted text'
+	-eu "$@" printf grep /usr/bin x=1 | test 'quoted text' "$@" -eu --verbose ${HOME}
+--verbose --verbose test test local "$@" then
+readonly "$1" x=1 echo "$@" local ${HOME} x=1 'quoted text'
+		readonly grep 'quoted text' awk "$@" sed readonly $(pwd) awk --verbose sed
+echo done awk sed $(pwd) then 2>/dev/null "$1" --verbose done cd readonly test
+$(pwd) echo "$1" local | export ${HOME} && done local $(pwd) "$1" grep
+		local done -eu "$1" awk export
+grep "$1" echo grep printf
+	grep sed test cd cd echo $(pwd) sed then
+		echo --verbose cd done 2>/dev/null readonly $(pwd) printf export grep echo echo
+		&& printf then -eu && local grep | /usr/bin "$1" 2>/dev/null
+	x=1 $(pwd) 'quoted text' readonly | printf
+printf printf /usr/bin ${HOME}
+	--verbose 'quoted text' readonly x=1 test $(pwd) local
+		-eu "$1" grep export grep export grep grep grep "$@" ${HOME}
+		2>/dev/null done 2>/dev/null 'quoted text' test ${HOME} export cd
+&& test done then x=1 sed "$1" "$1" done
+		| printf test "$@" $(pwd)
+	-eu x=1 "$@" 'quoted text' 'quoted text' export | export
+	"$1" test $(pwd) $(pwd) "$1"
+sed test "$1" --verbose 'quoted text' 2>/dev/null
+test done then test && 'quoted text' printf 2>/dev/null awk
+		${HOME} x=1 ${HOME} printf grep cd export then
+		grep then | 2>/dev/null awk
+	sed awk -eu awk 'quoted text' awk $(pwd) printf grep --verbose
+	'quoted text' awk cd 2>/dev/null printf -eu 'quoted text'
+	printf export readonly "$1" printf test cd local 2>/dev/null test --verbose
+"$@" done --verbose awk cd local
+	printf export 2>/dev/null 2>/dev/null --verbose test | 2>/dev/null |
+$(pwd) | done 2>/dev/null "$@" sed grep sed 2>/dev/null -eu "$1" 'quoted text'
+$(pwd) readonly $(pwd) test echo 2>/dev/null 'quoted text'
+	&& 2>/dev/null awk local && cd 'quoted text'
+${HOME} sed local 2>/dev/null x=1 then "$@" export x=1 -eu /usr/bin -eu
+		&& 'quoted text' readonly echo "$1" --verbose 2>/dev/null | $(pwd)
+		'quoted text' $(pwd) | export "$1" grep "$1" readonly x=1 export
+		/usr/bin printf | ${HOME} done readonly x=1 printf awk export sed /usr/bin grep
+2>/dev/null local /usr/bin 2>/dev/null cd /usr/bin --verbose 'quoted text'
+		then sed cd -eu "$1" done
+		done awk 'quoted text'
+--verbose cd 2>/dev/null then readonly
+		/usr/bin 2>/dev/null ${HOME} cd | done local grep | printf --verbose "$@"
+	done echo then local -eu -eu
+	test local printf local readonly local /usr/bin
+	sed awk grep local export printf awk 'quoted text'
+	${HOME} cd 2>/dev/null printf readonly && local 'quoted text' grep
+/usr/bin ${HOME} "$1" test 2>/dev/null echo "$@" -eu awk awk test x=1
+	printf /usr/bin /usr/bin local x=1 'quoted text' "$@" cd ${HOME} then ${HOME}
+	'quoted text' --verbose export cd ${HOME} /usr/bin 2>/dev/null then 2>/dev/null
+		done then then /usr/bin 2>/dev/null test -eu -eu done
+		"$@" local "$@" ${HOME} && "$@" readonly
+		$(pwd) $(pwd) "$1" /usr/bin export | cd
+	$(pwd) x=1 awk "$@" $(pwd) done -eu
+	&& printf ${HOME} done test printf --verbose done | 2>/dev/null
+		local --verbose grep test then $(pwd) $(pwd) --verbose --verbose then export
+	grep x=1 test grep --verbose --verbose sed local export ${HOME} grep grep
+	/usr/bin grep --verbose readonly readonly "$@" printf 'quoted text'
+	done printf --verbose
+done "$1" ${HOME} done 2>/dev/null echo cd printf | local cd
+		2>/dev/null cd "$1" local readonly readonly
+	done /usr/bin 2>/dev/null sed && $(pwd) $(pwd) "$1" cd local -eu sed awk
+	test local readonly grep 'quoted text'
+${HOME} | 2>/dev/null grep awk grep printf readonly grep
+test /usr/bin printf echo /usr/bin awk x=1 "$1" readonly
+	2>/dev/null /usr/bin readonly test x=1 x=1 ${HOME} ${HOME} cd test
+	cd ${HOME} 'quoted text' grep ${HOME} && cd -eu test
+&& --verbose cd readonly ${HOME} readonly echo export --verbose
+	&& then x=1 then 'quoted text' 'quoted text' 2>/dev/null | local $(pwd) --verbose
+echo $(pwd) 'quoted text' awk printf local grep "$1" cd done awk awk && ${HOME}
+	test /usr/bin echo then export cd -eu 2>/dev/null echo ${HOME} grep ${HOME} $(pwd)
+	printf sed 2>/dev/null then && /usr/bin
+	$(pwd) then then -eu ${HOME} local $(pwd) export awk -eu -eu && $(pwd) cd $(pwd)
+echo --verbose then 2>/dev/null cd | /usr/bin grep && --verbose then &&
+		-eu /usr/bin x=1 echo grep ${HOME} 2>/dev/null printf x=1 /usr/bin
+	test grep ${HOME} printf awk readonly export x=1 printf -eu
+x=1 local printf && && 'quoted text' printf
+$(pwd) ${HOME} "$1" test done awk then grep && ${HOME}
+		'quoted text' --verbose cd export sed "$1"
+		$(pwd) $(pwd) sed "$1" $(pwd) x=1 printf "$1" export x=1 then
+	export 2>/dev/null "$@" printf --verbose "$1" readonly -eu done | then
+	local export "$@" echo 2>/dev/null printf --verbose $(pwd) "$@" "$1"
+		-eu && "$1" cd ${HOME} sed then export "$@" -eu /usr/bin printf cd $(pwd)
+test test ${HOME} && x=1 then --verbose "$1" echo
+test printf ${HOME} x=1 printf
+'quoted text' 2>/dev/null done x=1 2>/dev/null done test && local
+printf && && 'quoted text' echo export /usr/bin test
+	--verbose grep printf
+		done readonly "$1" "$@" done sed 2>/dev/null | 'quoted text' readonly x=1
+test local $(pwd) "$1" $(pwd) "$1" then
+	2>/dev/null sed | | awk export awk | 2>/dev/null awk readonly
+		2>/dev/null test "$@" 'quoted text'
+done echo printf sed --verbose 2>/dev/null | $(pwd)
+		'quoted text' echo test echo | printf readonly readonly x=1 sed
+		${HOME} --verbose x=1 && sed local awk x=1 "$1" test "$1" cd printf && -eu -eu
+		| cd | -eu awk 2>/dev/null grep export "$@" sed 'quoted text' export
+	export "$1" && && local "$@" sed -eu awk test readonly done | ${HOME} export test
+echo -eu readonly "$@" /usr/bin local
+		"$@" grep ${HOME} echo export 2>/dev/null | 'quoted text' export
+test /usr/bin $(pwd) export then printf readonly 2>/dev/null printf
+		sed then readonly "$1" grep /usr/bin awk --verbose /usr/bin ${HOME}
+		then cd cd test export x=1 -eu $(pwd) then test $(pwd) "$@" cd && grep
+		$(pwd) 'quoted text' && sed sed
+	--verbose ${HOME} | done $(pwd) cd local 2>/dev/null
+	printf /usr/bin | "$1" sed 'quoted text' readonly
+		/usr/bin readonly "$@" && grep --verbose sed echo "$1" echo "$1" 2>/dev/null
+echo test --verbose x=1 ${HOME} then "$@" awk readonly
+		x=1 2>/dev/null sed && export
+	then $(pwd) echo printf $(pwd) local then x=1 ${HOME} x=1 && | ${HOME} $(pwd)
+		test echo x=1 2>/dev/null 2>/dev/null then && ${HOME} cd -eu printf then && local
+"$1" export test $(pwd) test
+	/usr/bin x=1 && -eu "$1" --verbose echo 2>/dev/null
+	grep test -eu printf --verbose | 'quoted text' readonly
+		'quoted text' grep $(pwd) "$1" 2>/dev/null
+echo --verbose test | && export $(pwd) readonly && 2>/dev/null test
+		&& export 2>/dev/null "$1" test test
+test | $(pwd) 2>/dev/null ${HOME} "$@" then "$1" /usr/bin
+	awk then 'quoted text' done local 2>/dev/null readonly
+		grep "$1" printf 'quoted text' awk
+		'quoted text' /usr/bin then test --verbose 'quoted text' | /usr/bin
+${HOME} readonly "$1" x=1 readonly printf grep then
+2>/dev/null echo grep $(pwd) grep 'quoted text' sed x=1 "$1" then
+sed 'quoted text' && test 'quoted text' 2>/dev/null test
+		awk $(pwd) grep ${HOME} 'quoted text'
+cd ${HOME} /usr/bin $(pwd) 'quoted text' done "$1" "$@"
+"$1" $(pwd) ${HOME} test export && ${HOME} "$1" "$1" done cd grep
+	$(pwd) "$@" readonly then grep 'quoted text' x=1 | "$@" | sed
+		sed cd export awk local | "$@" export export awk awk -eu cd cd | /usr/bin
+		printf export "$@" /usr/bin "$@" export x=1 test --verbose
+--verbose 'quoted text' grep 2>/dev/null 2>/dev/null
+		export test awk printf && cd 2>/dev/null && sed /usr/bin cd ${HOME}
+		| awk echo local -eu done 'quoted text' --verbose
+	${HOME} ${HOME} x=1 /usr/bin cd awk 'quoted text' 'quoted text'
+then ${HOME} echo printf awk "$@" ${HOME} --verbose
+		printf $(pwd) export | "$1" 2>/dev/null -eu ${HOME}
+"$1" sed cd | "$@" 'quoted text'
+	$(pwd) printf echo test echo grep "$@" "$1"
+grep echo printf done $(pwd) readonly echo export done && readonly 'quoted text'
+	awk readonly awk sed -eu grep --verbose printf awk readonly
+		local awk then awk ${HOME} /usr/bin "$@"
+	$(pwd) export | cd x=1 test
+	| done | echo "$@" | readonly
+		2>/dev/null done $(pwd)
+		x=1 echo awk local ${HOME} && --verbose printf cd | then
+x=1 ${HOME} "$1" readonly ${HOME} /usr/bin "$1"
+${HOME} ${HOME} x=1 done export cd then && --verbose
+echo grep export --verbose export x=1 printf readonly cd readonly awk
+	done cd | && test done x=1 -eu printf readonly x=1 'quoted text'
+		/usr/bin sed /usr/bin echo grep awk readonly
+		export awk awk local --verbose "$@" local "$1" readonly
+echo ${HOME} 'quoted text' "$1" "$1" 2>/dev/null sed cd awk "$@"
+	local 'quoted text' cd $(pwd) awk x=1
+		-eu printf cd && --verbose && | test awk test /usr/bin $(pwd) printf
+		2>/dev/null 2>/dev/null | ${HOME} cd
+	echo "$@" local export awk && $(pwd) ${HOME} local 2>/dev/null readonly
+local printf printf test local local
+	--verbose export x=1 && ${HOME} then echo cd local
+	cd ${HOME} test "$@" ${HOME} export awk "$@"
+	| 2>/dev/null readonly 2>/dev/null -eu local
+	local && local local printf x=1 ${HOME} local ${HOME} local 2>/dev/null export
+	"$@" 2>/dev/null readonly /usr/bin $(pwd) && printf
+		--verbose /usr/bin then && local -eu cd 'quoted text'
+		--verbose "$@" && printf export export test grep test &&
+	| "$@" x=1 done "$1" sed printf awk cd 'quoted text'
+	| -eu 2>/dev/null sed local && readonly
+done && -eu $(pwd) local --verbose /usr/bin "$@" local echo
+	export printf grep ${HOME} done then 'quoted text' ${HOME} local
+"$1" printf readonly export
+	$(pwd) test ${HOME} /usr/bin x=1 sed export
+	"$1" $(pwd) x=1 'quoted text'
+		| "$1" export 2>/dev/null -eu --verbose
+${HOME} done echo test export 'quoted text' $(pwd) printf cd echo
+	/usr/bin -eu | "$@" "$@" then
+		'quoted text' printf /usr/bin then /usr/bin cd $(pwd) printf && test
+local | sed $(pwd) "$@" grep "$@" local printf
+	grep printf awk cd echo /usr/bin then grep | "$@" "$@" printf --verbose
+done cd sed 'quoted text' done cd local done
+readonly && && | /usr/bin x=1 test -eu "$@" export
+		'quoted text' cd "$1" -eu x=1
+		&& "$1" 'quoted text' readonly
+	"$@" cd && sed -eu printf 'quoted text' readonly done -eu x=1
+		awk $(pwd) local x=1 | --verbose x=1 "$1" awk test grep 'quoted text'
+		x=1 x=1 cd grep echo test grep 2>/dev/null grep
+		awk 2>/dev/null test readonly echo "$@" -eu test $(pwd) --verbose then awk
+local && $(pwd) | then 2>/dev/null
+	export printf printf local --verbose cd local -eu done /usr/bin
+'quoted text' export done export local local cd grep readonly "$1"
+	&& echo export awk --verbose
+	'quoted text' ${HOME} readonly 'quoted text'
+	cd "$1" echo -eu -eu cd readonly ${HOME} local awk "$1"
+	-eu -eu done ${HOME} $(pwd) /usr/bin --verbose | x=1 --verbose ${HOME}
+&& done done ${HOME} awk $(pwd) sed x=1 x=1 "$1" "$1" awk export "$@" "$1" done
+	printf echo test --verbose sed 'quoted text' /usr/bin done | && ${HOME}
+| local awk sed /usr/bin
+	${HOME} printf done && echo /usr/bin
+	awk && $(pwd) awk local echo cd -eu /usr/bin $(pwd) $(pwd) done
+	$(pwd) test export 'quoted text' | sed then echo "$1" $(pwd) echo local
+	"$@" ${HOME} 2>/dev/null export --verbose 2>/dev/null
+		test /usr/bin && sed "$@" "$1" grep done && -eu test
+		"$1" ${HOME} x=1 | /usr/bin ${HOME} 'quoted text' -eu grep --verbose
+&& | /usr/bin done test /usr/bin export 2>/dev/null local sed "$1" done
+		/usr/bin cd grep x=1
+then ${HOME} ${HOME} 2>/dev/null readonly
+		export "$1" awk 2>/dev/null "$1" 'quoted text' local test "$1" --verbose
+	${HOME} awk export cd "$@" printf | cd && test done then cd -eu echo 'quoted text'
+	'quoted text' grep $(pwd) awk echo "$1" local local grep "$@"
+	done test /usr/bin test $(pwd) grep ${HOME} 2>/dev/null 2>/dev/null local echo
+	--verbose --verbose readonly awk |
+cd "$1" /usr/bin awk echo awk readonly
+x=1 && --verbose done done then "$1" && then echo printf then /usr/bin "$1" echo
+grep && test cd export export --verbose x=1 sed local
+export test 'quoted text' export local grep "$@" cd grep $(pwd) "$1" /usr/bin 'quoted text'
+		${HOME} sed --verbose grep x=1 awk printf $(pwd) export 'quoted text' -eu "$1"
+	2>/dev/null ${HOME} sed /usr/bin 'quoted text'
+echo printf then --verbose 2>/dev/null /usr/bin test
+/usr/bin local test | done printf | test 2>/dev/null && x=1
+		'quoted text' then "$@"
+		-eu echo && grep export /usr/bin printf sed /usr/bin export /usr/bin awk
+test /usr/bin awk -eu -eu sed
+local "$@" cd awk | awk grep
+	cd --verbose x=1 test cd -eu readonly x=1 --verbose sed printf echo sed
+		readonly ${HOME} printf x=1 | -eu 'quoted text' awk "$1" echo
+		"$@" export readonly ${HOME} --verbose
+		/usr/bin grep export "$1" local cd export
+		done export export awk echo /usr/bin
+		2>/dev/null $(pwd) --verbose 'quoted text' local /usr/bin readonly
+		grep /usr/bin -eu && then cd --verbose echo sed test local echo $(pwd) ${HOME}
+		--verbose printf "$1" && | "$1" export cd -eu "$1" cd grep done
+$(pwd) ${HOME} --verbose $(pwd) sed -eu printf --verbose then /usr/bin --verbose
+		sed && sed --verbose echo printf readonly
+export /usr/bin $(pwd) then awk export ${HOME} &&
+		done export x=1 | --verbose
+/usr/bin ${HOME} then done ${HOME} | echo
+	then sed "$@" | /usr/bin | $(pwd) local printf grep && export "$@" 'quoted text'
+| $(pwd) grep readonly $(pwd) readonly sed export ${HOME} && 'quoted text'
+echo cd /usr/bin | export printf ${HOME} | readonly "$@"
+printf "$1" x=1 -eu $(pwd) grep ${HOME} 2>/dev/null "$1" | "$@"
+		awk readonly grep sed x=1 test ${HOME} local
+"$@" 'quoted text' test then grep readonly local --verbose
+		"$1" export 'quoted text' cd "$1" -eu
+	"$1" awk 2>/dev/null | echo grep export | && awk readonly |
+echo printf grep done echo -eu --verbose
+	test -eu "$1" printf sed "$@" sed echo $(pwd)
+		printf x=1 then cd $(pwd) awk ${HOME} && local
+then printf ${HOME} echo
+		"$@" export grep "$@" -eu "$@" printf export grep done cd then
+cd echo readonly then printf -eu
+		"$@" sed && ${HOME} "$@" "$@" cd x=1 export then export ${HOME} awk ${HOME}
+		/usr/bin "$@" done echo $(pwd) "$@" export grep local
+	| 'quoted text' x=1 'quoted text' | "$1" | cd $(pwd) "$@" -eu cd
+test | -eu 2>/dev/null grep && --verbose local cd readonly sed
+then local -eu grep /usr/bin x=1 2>/dev/null readonly export awk -eu local then
+	${HOME} sed 'quoted text' grep
+		readonly "$@" $(pwd) -eu $(pwd)
+&& 2>/dev/null 2>/dev/null && | test grep echo
+export awk local awk 2>/dev/null /usr/bin printf grep ${HOME} done test test
+printf sed -eu 2>/dev/null 2>/dev/null
+	'quoted text' local 'quoted text' && local export export 'quoted text' printf
+2>/dev/null && && 2>/dev/null -eu /usr/bin test --verbose
+	cd then && "$@" local "$@" x=1 then readonly
+		grep readonly local ${HOME} cd /usr/bin | export export export
+	$(pwd) --verbose $(pwd) local printf test -eu -eu "$@"
+	| then grep awk "$1" then --verbose 'quoted text'
+--verbose | sed ${HOME} x=1 done sed printf readonly
+readonly awk awk | -eu "$@" -eu | echo local | && --verbose
+		sed export done 2>/dev/null done grep x=1 readonly test x=1 awk grep readonly
+	"$1" x=1 "$1" && local /usr/bin
+	--verbose 'quoted text' export
+| -eu /usr/bin export -eu 'quoted text' awk ${HOME} grep printf echo echo
+		readonly ${HOME} echo && -eu
+	x=1 "$@" sed printf 'quoted text' "$@" printf "$@"
+		-eu sed -eu "$1" "$1" /usr/bin 2>/dev/null local ${HOME} grep export
+	--verbose then 2>/dev/null /usr/bin "$1"
+		$(pwd) test cd grep 'quoted text'
+		sed $(pwd) | test /usr/bin "$1" /usr/bin export grep readonly -eu
+	grep -eu "$@" export 2>/dev/null 2>/dev/null test echo "$1" && sed cd awk grep
+		--verbose x=1 x=1 awk ${HOME} cd "$1" printf awk
+	cd $(pwd) export | readonly
+-eu readonly awk done test 2>/dev/null
+cd readonly 2>/dev/null done x=1 "$1" 'quoted text' --verbose
+	&& sed 'quoted text' grep sed | echo
+	export x=1 --verbose then printf && && | echo done grep echo awk
+2>/dev/null done awk && readonly test $(pwd) ${HOME} "$@" "$1"
+	"$@" --verbose "$@" "$1"
+&& cd ${HOME} local /usr/bin
+	awk echo --verbose cd -eu sed x=1 /usr/bin -eu
+	cd /usr/bin ${HOME} readonly sed cd "$@" cd
+		&& && test 2>/dev/null export
+	x=1 --verbose done /usr/bin sed
+		grep cd --verbose local && | | /usr/bin "$@" 'quoted text' x=1 sed --verbose local
+	'quoted text' -eu sed --verbose "$1" x=1 echo --verbose ${HOME}
+		cd ${HOME} /usr/bin 'quoted text' 'quoted text' $(pwd)
+	"$1" /usr/bin ${HOME} test printf | grep $(pwd) then test local echo
+grep grep cd 'quoted text' echo | sed /usr/bin /usr/bin "$@" | test --verbose
+	echo test -eu 'quoted text' local
+awk grep x=1 done grep "$@" 'quoted text' export echo cd x=1 2>/dev/null
+2>/dev/null --verbose local
+	$(pwd) $(pwd) | "$1" 2>/dev/null --verbose cd done readonly
+		test ${HOME} /usr/bin ${HOME} /usr/bin echo grep $(pwd) x=1 "$@" then
+"$1" readonly "$@" awk $(pwd) test 'quoted text' sed cd readonly awk grep
+then 'quoted text' printf 2>/dev/null
+		awk 'quoted text' ${HOME} 'quoted text' test | test ${HOME}
+readonly && --verbose echo "$@" | export then 2>/dev/null local $(pwd)
+	&& && then printf --verbose cd "$@" done readonly test ${HOME} local "$1"
+"$1" /usr/bin test printf x=1 $(pwd) local
+readonly local $(pwd) printf
+	'quoted text' awk export awk ${HOME} 'quoted text' "$@" --verbose printf export
+		/usr/bin $(pwd) | echo x=1 grep grep /usr/bin 2>/dev/null -eu
+	$(pwd) 2>/dev/null export readonly -eu readonly | awk -eu sed printf
+$(pwd) "$@" awk /usr/bin 2>/dev/null "$@" printf then sed --verbose
+		cd ${HOME} then export 2>/dev/null && && x=1 cd
+readonly grep test grep
+	&& test "$@" sed && /usr/bin printf --verbose export test "$1" cd /usr/bin sed
+		--verbose cd cd test sed -eu 'quoted text' grep ${HOME} | "$1" grep awk
+	x=1 x=1 export && --verbose sed printf "$@" "$@" x=1 "$1" then "$@" /usr/bin &&
+grep readonly awk /usr/bin -eu echo 'quoted text' 'quoted text'
+/usr/bin awk grep ${HOME} awk test cd local $(pwd) awk ${HOME}
+		x=1 export test --verbose "$@" -eu done sed "$@"
+$(pwd) then sed readonly "$1" /usr/bin grep 'quoted text'
+--verbose test 'quoted text' --verbose grep "$1" --verbose
+		then then export /usr/bin /usr/bin 2>/dev/null | x=1 2>/dev/null x=1 --verbose grep
+	"$1" && -eu 2>/dev/null 'quoted text' sed $(pwd) then local && /usr/bin readonly
+	| printf /usr/bin 2>/dev/null 2>/dev/null -eu grep awk done
+		"$@" $(pwd) -eu "$@" done test then | printf local
+	test sed sed "$1" readonly cd /usr/bin echo printf "$1" readonly x=1
+-eu awk local ${HOME} | 2>/dev/null /usr/bin grep ${HOME} && ${HOME}
+		done grep export done |
+	test && ${HOME} $(pwd) export $(pwd) -eu 2>/dev/null awk cd 'quoted text'
+		done export printf 'quoted text'
+x=1 'quoted text' printf --verbose
+		local echo 'quoted text' local sed
+		-eu grep printf "$1" echo $(pwd) "$@"
+	grep x=1 -eu test readonly -eu "$@" x=1 export awk | test && export
+		then "$1" export /usr/bin local printf
+"$1" 2>/dev/null export grep | 'quoted text' readonly cd --verbose
+		2>/dev/null done printf /usr/bin test 'quoted text'
+	'quoted text' | | "$1" awk sed
+		${HOME} && "$1" 'quoted text' then x=1 local /usr/bin
+&& /usr/bin local grep && "$@" test
+${HOME} cd 2>/dev/null --verbose done --verbose
+	export "$1" && $(pwd) echo then export && local export then --verbose
+	"$@" printf "$@" printf ${HOME} "$@" test then readonly
+&& -eu && grep then printf grep local then printf test echo grep 'quoted text'
+	then test -eu local grep sed done cd export grep ${HOME} | done -eu && test --verbose
+	/usr/bin local printf && /usr/bin "$1" cd 'quoted text' sed && echo sed $(pwd)
+"$@" --verbose grep cd "$@" sed 2>/dev/null -eu local -eu --verbose done
+		cd $(pwd) --verbose printf x=1 export ${HOME} done x=1 sed -eu grep local
+| cd && --verbose ${HOME} x=1 $(pwd) readonly && sed --verbose awk 'quoted text'
+	-eu && then grep --verbose && then && 2>/dev/null -eu grep sed then awk "$1" done
+"$@" readonly cd awk cd test printf -eu cd export
+sed x=1 export 2>/dev/null && cd 2>/dev/null x=1 --verbose
+	--verbose local awk done ${HOME} readonly test ${HOME}
+	sed -eu && export "$1" sed --verbose
+| | x=1 "$1" grep 2>/dev/null x=1 grep awk test done readonly x=1 ${HOME}
+	readonly -eu x=1 readonly "$@" "$1" then "$1" printf cd local --verbose
+	then awk "$1" cd /usr/bin local readonly $(pwd)
+x=1 'quoted text' "$@" --verbose ${HOME} local /usr/bin 2>/dev/null
+		--verbose test echo awk "$1" | 2>/dev/null test
+	-eu sed && local -eu /usr/bin ${HOME} ${HOME} then done test && ${HOME}
+${HOME} --verbose local "$1" -eu printf readonly
+		printf /usr/bin ${HOME} test "$1"
+		grep readonly local then sed $(pwd) 'quoted text' printf --verbose
+${HOME} echo "$@" done x=1 awk cd
+| "$@" ${HOME} sed then printf local
+	grep --verbose awk 'quoted text' done -eu 2>/dev/null
+		then then export "$1" 2>/dev/null "$@" done $(pwd) test cd grep ${HOME}
+		&& test 'quoted text' test "$@" 'quoted text' $(pwd) | 'quoted text' |
+	$(pwd) awk done export &&
+		--verbose test | $(pwd) sed /usr/bin awk && -eu readonly x=1 --verbose then
+	| local grep awk $(pwd)
+	"$@" echo --verbose cd cd cd then printf
+		export "$@" export x=1 x=1 done 2>/dev/null
+	then $(pwd) && sed test "$@" done sed awk "$@" local | echo 'quoted text'
+		/usr/bin printf awk | local done readonly echo done 2>/dev/null
+echo && export grep test 2>/dev/null
+then done --verbose && readonly x=1 test "$1" --verbose
+	test awk sed -eu printf 'quoted text' then && "$@" awk awk awk "$@" && then
+"$1" test grep local ${HOME} test 'quoted text' 2>/dev/null ${HOME} export cd "$1"
+	readonly /usr/bin sed
+		| | && then ${HOME} x=1 sed
+--verbose "$1" "$@" 2>/dev/null
+	--verbose done export "$1" "$1" 2>/dev/null $(pwd)
+		printf --verbose printf done cd cd then cd "$1"
+cd $(pwd) "$@" 'quoted text'
+-eu echo --verbose printf 'quoted text' | readonly readonly
+		$(pwd) echo grep && readonly $(pwd) done then && && "$1" --verbose
+then 2>/dev/null "$@" "$@" test $(pwd) | readonly
+		${HOME} echo done 'quoted text' awk local $(pwd) readonly --verbose x=1
+	readonly cd x=1 2>/dev/null "$1" --verbose done cd 2>/dev/null x=1 'quoted text'
+--verbose /usr/bin export done sed test awk then ${HOME}
+	readonly cd ${HOME} "$1" "$1"
+	--verbose echo local done -eu echo "$1" 'quoted text' sed grep --verbose
+	$(pwd) 'quoted text' && done sed "$1" "$1" --verbose
+		sed -eu then 'quoted text' sed awk printf
+-eu x=1 2>/dev/null | 2>/dev/null /usr/bin export
+	x=1 local /usr/bin local readonly "$1" --verbose echo x=1 && ${HOME} "$1" grep
+	--verbose export /usr/bin local local test sed
+sed local 2>/dev/null $(pwd) cd done 'quoted text' /usr/bin
+	cd && "$1" sed x=1 -eu cd "$1" | /usr/bin -eu test | && $(pwd) |
+		readonly sed "$1" | | --verbose echo 'quoted text' "$@" $(pwd) awk 'quoted text'
+	test "$1" -eu done 2>/dev/null -eu
+		-eu 'quoted text' 'quoted text' "$1" -eu cd && local ${HOME} "$1" 'quoted text'
+	"$@" sed --verbose "$@" "$1" 2>/dev/null ${HOME} ${HOME} --verbose awk done 2>/dev/null
+/usr/bin -eu test local export -eu echo /usr/bin export
+	2>/dev/null awk then sed awk 2>/dev/null
+"$1" | test | sed sed
+	export sed export x=1 /usr/bin then local grep 'quoted text'
+'quoted text' export 2>/dev/null -eu echo -eu
+sed 2>/dev/null | done -eu "$@" x=1
+	/usr/bin $(pwd) cd export x=1 "$@"
+$(pwd) local awk -eu export
+	${HOME} printf 2>/dev/null then "$@" ${HOME} export $(pwd) 2>/dev/null ${HOME} 2>/dev/null
+		export --verbose --verbose export grep
+/usr/bin then "$1" x=1 sed && awk $(pwd) then
+/usr/bin 2>/dev/null readonly local grep sed /usr/bin |
+		local 2>/dev/null echo echo then then "$1" x=1 'quoted text' echo
+test $(pwd) test test /usr/bin
+${HOME} --verbose echo && done | /usr/bin sed printf $(pwd) $(pwd) /usr/bin sed
+done readonly done test readonly --verbose echo cd then test 'quoted text' done
+	2>/dev/null "$1" "$1" printf --verbose local
+	/usr/bin awk test cd local --verbose awk export "$@" && "$1" --verbose
+done 'quoted text' /usr/bin -eu
+	sed x=1 sed echo then test && printf x=1 && done
+	${HOME} | ${HOME} done /usr/bin x=1 readonly
+		"$1" 2>/dev/null -eu grep printf then 'quoted text' then readonly
+		'quoted text' done | --verbose local printf 2>/dev/null
+	cd -eu --verbose 2>/dev/null sed
+	test test | 'quoted text' /usr/bin "$@"
+		"$1" | ${HOME} cd done local && 2>/dev/null && echo "$@" x=1 --verbose test
+		"$1" -eu awk sed printf grep echo ${HOME} "$@" grep $(pwd) printf grep "$1" 2>/dev/null
+	then 2>/dev/null 'quoted text' 'quoted text' awk -eu $(pwd) && printf
+$(pwd) readonly readonly
+	readonly /usr/bin cd ${HOME} "$1" printf "$@" test /usr/bin
+2>/dev/null --verbose grep x=1 grep /usr/bin
+test export local 'quoted text' -eu 'quoted text' echo
+		echo local 'quoted text' readonly && local grep then --verbose readonly --verbose
+test && export /usr/bin && "$1" export
+		echo x=1 cd && local "$@" done 'quoted text' "$1" export "$1" 'quoted text' -eu
+	${HOME} 'quoted text' "$@"
+		export 2>/dev/null done sed -eu
+cd x=1 && x=1 test ${HOME} test ${HOME} 2>/dev/null 'quoted text' printf
+		| export -eu | printf cd $(pwd) grep readonly | /usr/bin "$@" done
+	| 'quoted text' | awk "$@" "$1" 2>/dev/null $(pwd) then x=1 test sed
+	awk | printf 'quoted text' | export "$@" grep --verbose --verbose
+test printf && && done printf done done echo ${HOME} 2>/dev/null | 2>/dev/null
+x=1 local awk && grep "$1" 'quoted text' /usr/bin readonly
+	awk readonly "$@" | "$1" | cd sed 'quoted text' awk $(pwd)
+printf "$@" then ${HOME} sed done --verbose
+		printf echo && "$1" ${HOME} $(pwd)
+	${HOME} | "$@" "$@" 2>/dev/null then ${HOME} readonly "$@" cd ${HOME} x=1
+		grep grep local grep printf readonly --verbose 2>/dev/null then "$@" readonly --verbose
+		2>/dev/null 'quoted text' cd --verbose
+then awk export done x=1 "$1" ${HOME} | export grep cd grep "$1"
+'quoted text' | readonly echo | "$@" export /usr/bin then local
+$(pwd) "$1" grep cd 'quoted text'
+		awk test -eu --verbose grep $(pwd) sed "$1" printf /usr/bin ${HOME}
+		local printf /usr/bin test --verbose x=1 export grep "$@" |
+	test -eu cd && x=1 --verbose
+	'quoted text' | awk -eu /usr/bin x=1
+		2>/dev/null | sed | 2>/dev/null export test && 'quoted text' && local
+	then 2>/dev/null $(pwd) done printf
+		&& done awk 'quoted text' printf 2>/dev/null
+		then ${HOME} done local | sed cd ${HOME}
+-eu done | 2>/dev/null "$@" /usr/bin | test x=1
+sed 'quoted text' -eu local
+x=1 sed export sed 'quoted text' printf export ${HOME} then
+	awk -eu | $(pwd) --verbose "$@" then done echo local done $(pwd) cd -eu
+	"$@" "$1" local awk "$@" cd --verbose 'quoted text'
+"$@" printf 'quoted text' echo | $(pwd) $(pwd) /usr/bin
+--verbose cd /usr/bin local test echo local "$@" $(pwd)
+	--verbose "$1" readonly --verbose readonly
+	"$1" $(pwd) printf 2>/dev/null -eu "$1" cd
+	then -eu | "$1" $(pwd) local --verbose
+sed done printf sed grep 2>/dev/null
+--verbose grep grep awk
+	${HOME} --verbose | echo then awk "$@" | cd grep -eu done | --verbose x=1 "$@"
+x=1 local && 'quoted text'
+${HOME} grep done $(pwd) echo "$1" /usr/bin local
+	echo local grep $(pwd) $(pwd) -eu -eu echo echo && ${HOME} /usr/bin /usr/bin
+	2>/dev/null -eu && then "$1" done $(pwd) awk export 'quoted text'
+--verbose && printf 'quoted text' export
+		-eu readonly && done --verbose && /usr/bin printf done test &&
+		$(pwd) echo && 'quoted text' echo ${HOME}
+	$(pwd) done && echo awk --verbose | grep
+local /usr/bin readonly 'quoted text' then ${HOME} awk
+grep && export grep sed "$@" && test 2>/dev/null grep && local local $(pwd)
+	2>/dev/null | /usr/bin --verbose
+		&& && "$1" echo 'quoted text' local
+		"$1" grep test grep grep echo && "$1" --verbose grep 2>/dev/null 2>/dev/null
+	&& 'quoted text' 'quoted text' then readonly local printf $(pwd) && -eu
+"$@" && grep echo sed /usr/bin "$1" 2>/dev/null "$1" && readonly
+	2>/dev/null readonly readonly sed $(pwd) cd cd 'quoted text'
+	| && /usr/bin | export done readonly echo awk
+		"$1" then && sed sed export 'quoted text'
+		echo then --verbose "$1" then
+		sed sed /usr/bin test local then --verbose readonly echo /usr/bin sed x=1
+cd 2>/dev/null awk --verbose "$1" $(pwd) local "$@" awk -eu
+		sed then done | 2>/dev/null echo 2>/dev/null &&
+	awk echo && readonly readonly && grep then ${HOME} && ${HOME}
+"$@" "$1" -eu sed cd -eu 'quoted text' echo awk then 'quoted text'
+	/usr/bin printf sed local ${HOME} && then local
+		$(pwd) "$1" 2>/dev/null
+test "$@" readonly 'quoted text'
+/usr/bin printf echo 'quoted text'
+| 2>/dev/null "$1" x=1 "$1" "$@" 2>/dev/null "$@" readonly
+		export ${HOME} export $(pwd) test | 'quoted text' export grep --verbose
+		printf -eu x=1 "$@" test $(pwd) printf x=1 done echo 2>/dev/null x=1
+	'quoted text' && export local x=1 sed
+| && x=1 then $(pwd) export awk done awk
+"$@" cd x=1 "$1" ${HOME} /usr/bin -eu "$1" 'quoted text' /usr/bin -eu "$1" ${HOME}
+	"$1" | echo printf local then done echo
+		| --verbose $(pwd) 2>/dev/null export
+	awk x=1 printf 2>/dev/null && test && "$1" && echo then
+		then printf done grep export /usr/bin then awk printf ${HOME} done test
+		| --verbose $(pwd) /usr/bin local test local $(pwd) --verbose
+	awk local | done readonly
+		export $(pwd) x=1 printf "$1" --verbose /usr/bin cd && 2>/dev/null readonly readonly
+		awk && $(pwd) -eu x=1 then sed printf ${HOME} ${HOME} sed 'quoted text'
+		'quoted text' sed $(pwd) && x=1 | cd /usr/bin cd done | -eu awk export echo
+		awk cd printf -eu printf sed sed export && -eu
+		--verbose "$@" "$@" 'quoted text' -eu $(pwd)
+x=1 /usr/bin /usr/bin /usr/bin ${HOME} && ${HOME}
+		sed "$1" then grep then -eu awk "$@"
+	test echo ${HOME} done && grep 'quoted text'
+	--verbose test cd done | -eu local 2>/dev/null
+sed grep readonly ${HOME} grep $(pwd) "$@" cd awk ${HOME}
+	"$@" x=1 awk -eu awk -eu 'quoted text'
+echo readonly "$1" echo $(pwd) "$@" --verbose printf --verbose ${HOME}
+		"$1" test sed awk | then /usr/bin
+	local -eu "$@" && cd --verbose then
+readonly && printf test "$1" 'quoted text' | /usr/bin
+grep readonly grep 'quoted text' | x=1 echo readonly sed --verbose
+		test && local export done cd sed grep && awk cd cd
+awk -eu local --verbose --verbose printf echo
+		echo local | export cd awk done sed grep $(pwd)
+	sed | | -eu echo --verbose 2>/dev/null 'quoted text'
+	x=1 grep echo done "$@" 'quoted text' --verbose
+		"$@" readonly export awk "$1" sed $(pwd) 2>/dev/null 2>/dev/null
+	"$1" grep -eu "$1" printf --verbose then grep && test
+		"$@" /usr/bin echo done sed && sed sed "$@" ${HOME} | then awk | then ${HOME}
+&& grep "$1" && 2>/dev/null x=1 then awk awk ${HOME} awk then ${HOME} ${HOME}
+test | /usr/bin $(pwd) test 2>/dev/null --verbose && then local
+	x=1 printf 'quoted text' | 2>/dev/null 2>/dev/null
+		| readonly readonly echo $(pwd) x=1 grep "$1"
+	| cd grep printf local $(pwd) 2>/dev/null "$1" local 'quoted text'
+		'quoted text' grep test 2>/dev/null "$@" then 'quoted text' "$1"
+	/usr/bin /usr/bin --verbose -eu
+cd "$@" $(pwd) "$1" -eu -eu 'quoted text' $(pwd) printf
+	done ${HOME} /usr/bin "$@" 2>/dev/null
+		${HOME} && cd grep echo sed && done $(pwd) -eu
+printf test $(pwd) test cd ${HOME} 2>/dev/null ${HOME} printf
+		awk printf export ${HOME} -eu printf x=1 x=1
+		cd cd x=1 'quoted text' sed awk ${HOME}
+		${HOME} then -eu | 2>/dev/null 'quoted text' 'quoted text' &&
+		grep | --verbose awk 2>/dev/null --verbose then /usr/bin local
+	test && | test 'quoted text' echo 'quoted text'
+		sed then && && && printf "$@" readonly
@@ -0,0 +1,2001 @@
+&& "$@" "$1" --verbose grep x=1 done export grep then grep
+	--verbose export "$1" x=1 'quoted text' "$1" "$@" ${HOME} x=1 --verbose "$@" test
+		cd local cd test readonly awk "$1" cd /usr/bin
+	echo ${HOME} local && --verbose sed "$1" && awk 'quoted text'
+sed then x=1 sed readonly && cd readonly 'quoted text' echo cd cd sed -eu "$@"
+		printf $(pwd) "$1" $(pwd) export
+	awk "$@" -eu ${HOME} awk x=1 grep
+		"$1" done readonly "$@" $(pwd) x=1 ${HOME} && "$1" done ${HOME} 'quoted text'
+		echo 2>/dev/null test echo
+local echo -eu | $(pwd) $(pwd) ${HOME} echo
+		--verbose echo $(pwd) && sed
+		printf awk 2>/dev/null "$@" sed -eu printf local
+	awk local "$1" | 'quoted text' -eu
+		echo | | awk -eu ${HOME}
+	--verbose done /usr/bin export 2>/dev/null -eu x=1 ${HOME}
+		readonly local local test x=1 done x=1
+		sed /usr/bin local cd readonly 'quoted text'
+"$1" cd "$1" echo -eu && $(pwd) then done 2>/dev/null
+		'quoted text' /usr/bin test 'quoted text' x=1 x=1
+--verbose printf printf done grep test "$@" --verbose then export done
+	readonly then ${HOME} export x=1 echo local awk && x=1 local local
+	grep readonly then awk sed test printf ${HOME} "$1" && 'quoted text'
+-eu ${HOME} -eu test readonly $(pwd) done -eu export /usr/bin then sed
+		/usr/bin 2>/dev/null local --verbose
+	echo readonly local done -eu awk
+	sed export "$1" test local /usr/bin
+	| echo 'quoted text' ${HOME} sed
+	2>/dev/null then "$@" --verbose then x=1 test -eu done done x=1 grep
+-eu $(pwd) | -eu "$@" readonly sed awk
+		echo sed --verbose -eu then printf export then local
+		export && export export echo -eu --verbose "$1"
+export echo sed echo test done then "$1" readonly printf ${HOME}
+	local /usr/bin | 'quoted text' readonly grep
+		export x=1 ${HOME} x=1 printf done && -eu | readonly ${HOME} 2>/dev/null local &&
+		&& $(pwd) /usr/bin ${HOME} | 'quoted text' done &&
+		2>/dev/null sed sed ${HOME} "$@" /usr/bin awk "$@" awk ${HOME}
+export "$@" $(pwd) grep local cd then awk x=1
+	&& x=1 sed $(pwd) done export $(pwd) ${HOME} test printf 2>/dev/null
+		$(pwd) ${HOME} $(pwd) awk
+		then -eu sed done /usr/bin
+		/usr/bin test local then awk ${HOME} test /usr/bin readonly $(pwd)
+/usr/bin 2>/dev/null ${HOME} readonly local awk 2>/dev/null | done
+		'quoted text' $(pwd) /usr/bin done -eu awk /usr/bin "$1"
+		then cd grep local 'quoted text' && done then cd "$1" /usr/bin $(pwd) "$1"
+${HOME} ${HOME} "$1" test echo
+2>/dev/null printf readonly
+		done /usr/bin "$1" && done "$1"
+	printf printf 2>/dev/null grep "$1" done -eu sed readonly
+/usr/bin $(pwd) grep $(pwd) readonly | sed
+		2>/dev/null "$1" /usr/bin echo printf echo /usr/bin "$@" "$@" cd grep $(pwd) grep
+	| x=1 echo printf readonly &&
+		2>/dev/null -eu && sed
+	printf 'quoted text' $(pwd) $(pwd) "$1"
+local $(pwd) "$@" printf export test printf test then x=1 'quoted text' readonly
+	done "$@" local test awk printf sed "$1" test
+${HOME} export then x=1
+		printf done grep test 2>/dev/null printf "$@" awk awk | export readonly x=1 cd
+local "$1" sed $(pwd) /usr/bin
+	readonly -eu grep ${HOME} printf /usr/bin local
+		printf sed 'quoted text' "$1" grep x=1 -eu x=1 'quoted text' printf && cd
+		${HOME} then done --verbose done -eu echo
+readonly 'quoted text' export "$1" "$@" -eu && echo grep $(pwd) -eu test
+'quoted text' ${HOME} printf grep 2>/dev/null export echo
+$(pwd) local readonly
+	/usr/bin --verbose test && x=1 readonly /usr/bin
+2>/dev/null | && "$1" |
+		"$1" echo 2>/dev/null $(pwd) | "$1" /usr/bin $(pwd) sed $(pwd) /usr/bin
+	export then printf echo | cd "$1" /usr/bin /usr/bin "$@" /usr/bin
+&& 'quoted text' --verbose
+		test /usr/bin then "$@" sed echo /usr/bin grep --verbose echo printf
+sed "$@" "$1" && "$1" 2>/dev/null -eu then grep readonly cd --verbose -eu
+		x=1 -eu grep -eu cd $(pwd) sed export
+	done grep export x=1 ${HOME} $(pwd) "$@"
+		echo && ${HOME} done export && awk ${HOME} | done readonly
+		"$1" cd test readonly "$@" 'quoted text'
+	readonly && | then ${HOME} local export x=1 sed grep
+export then done && done | /usr/bin -eu x=1 then && "$1" export $(pwd)
+		/usr/bin $(pwd) grep ${HOME} && $(pwd) 2>/dev/null done
+		$(pwd) -eu grep "$1" then $(pwd) sed local printf
+	export echo echo | | echo readonly readonly echo 2>/dev/null export
+	'quoted text' sed -eu
+/usr/bin --verbose readonly /usr/bin
+echo local && && cd test "$@" awk /usr/bin
+printf sed -eu grep done $(pwd) echo
+	done | "$@" "$1" "$@" then | export ${HOME} local x=1 ${HOME}
+		"$1" 'quoted text' echo test x=1 "$1" then test "$1" x=1 export x=1
+&& x=1 && /usr/bin | readonly 2>/dev/null 2>/dev/null done "$@" awk
+	2>/dev/null done 'quoted text' grep -eu sed -eu export
+	awk x=1 -eu done readonly $(pwd) then $(pwd) awk echo ${HOME} printf
+	printf echo cd then && test "$@" test readonly awk printf echo
+"$1" echo $(pwd) awk x=1 readonly awk | local -eu echo done "$@"
+awk echo x=1 --verbose
+		echo awk 2>/dev/null | test $(pwd) && echo
+cd --verbose cd 'quoted text' printf "$@" | "$1"
+export --verbose awk awk x=1 && readonly
+		awk --verbose 'quoted text' printf cd
+		grep then cd --verbose
+		local then grep cd test awk awk sed
+${HOME} && grep x=1 /usr/bin sed done ${HOME} test cd echo cd done
+		readonly -eu awk "$1" sed done awk grep then 'quoted text'
+| -eu x=1 sed sed "$@" done ${HOME}
+	"$1" printf /usr/bin x=1 "$1" done sed $(pwd) 2>/dev/null 'quoted text' grep
+"$@" --verbose $(pwd) -eu /usr/bin $(pwd)
+	${HOME} $(pwd) awk 'quoted text' printf cd done "$@" sed ${HOME} --verbose
+		local && test 'quoted text' sed awk && | local
+printf export readonly
+	printf then echo $(pwd) local
+sed | "$1" echo ${HOME} --verbose local awk cd done
+$(pwd) echo cd local -eu export
+		"$1" --verbose 2>/dev/null
+readonly sed then awk &&
+		test | local grep $(pwd) echo readonly cd local readonly x=1 then done grep
+	sed $(pwd) local sed --verbose cd 2>/dev/null $(pwd) 'quoted text' grep
+		then $(pwd) --verbose then readonly && "$@" done export done && 'quoted text'
+		'quoted text' readonly $(pwd)
+printf sed test 2>/dev/null readonly /usr/bin && | --verbose test x=1
+		"$@" cd 'quoted text'
+		"$@" export x=1 /usr/bin awk test 'quoted text'
+	2>/dev/null "$1" export &&
+		"$1" sed readonly grep x=1
+		--verbose printf "$1" sed ${HOME} test -eu awk cd
+		export 'quoted text' readonly $(pwd) $(pwd)
+		local cd -eu echo test 'quoted text' ${HOME} "$1" 2>/dev/null cd $(pwd) ${HOME}
+		then export test readonly --verbose &&
+	export "$1" 'quoted text' then readonly
+		local done 'quoted text' then
+		-eu "$@" awk x=1 export readonly
+	${HOME} ${HOME} done done
+		cd done 'quoted text' export 2>/dev/null --verbose $(pwd) export
+		printf /usr/bin x=1 "$@" ${HOME}
+	| printf "$@" echo x=1 awk 'quoted text'
+then && echo export printf awk awk printf "$1" export
+| echo test grep && printf | readonly printf /usr/bin
+	awk --verbose grep $(pwd) awk readonly readonly done "$1" x=1
+		2>/dev/null export awk done local ${HOME} export test /usr/bin
+-eu ${HOME} --verbose x=1
+test x=1 test -eu grep sed --verbose cd "$1" local export
+		&& local test echo echo x=1 ${HOME} done done
+grep cd export grep then /usr/bin test x=1 /usr/bin done 'quoted text' local
+&& readonly | readonly "$@" printf
+	'quoted text' | export "$1" test
+x=1 ${HOME} && cd x=1
+		sed test local 'quoted text' test sed export --verbose --verbose 2>/dev/null
+	local /usr/bin readonly grep readonly then
+	export -eu grep 2>/dev/null printf printf 'quoted text' "$@" &&
+echo --verbose sed then readonly cd echo $(pwd)
+2>/dev/null echo grep sed --verbose printf local cd 'quoted text'
+	"$@" test export "$@" | echo "$1" test test && done sed "$@" cd x=1 'quoted text'
+"$1" awk local /usr/bin cd /usr/bin 2>/dev/null
+	test -eu -eu done cd /usr/bin
+	export $(pwd) ${HOME} "$1" 'quoted text' && export
+echo test 'quoted text' "$@" "$1" --verbose done echo
+	export $(pwd) test done done local done "$1" "$@" echo
+awk echo $(pwd) readonly /usr/bin 2>/dev/null done cd echo && | grep "$@" -eu
+	cd local $(pwd) | local export ${HOME} $(pwd)
+		--verbose | | | "$1" "$@" "$@" local x=1 readonly export $(pwd) /usr/bin
+${HOME} "$@" 2>/dev/null
+		cd "$1" then -eu 2>/dev/null --verbose 2>/dev/null
+${HOME} && awk $(pwd) local ${HOME} "$@" "$1" $(pwd)
+| && "$1" "$@" 'quoted text' printf test x=1
+	/usr/bin ${HOME} awk done grep /usr/bin && local test --verbose local echo
+		awk 'quoted text' test cd -eu done readonly readonly -eu 2>/dev/null
+	echo $(pwd) echo grep grep "$@" x=1 /usr/bin
+cd test test ${HOME} printf
+$(pwd) awk -eu cd printf done -eu -eu echo echo sed awk then "$1" $(pwd)
+	printf awk cd "$@" test echo export
+'quoted text' --verbose $(pwd) printf -eu then local sed 'quoted text'
+$(pwd) "$1" 'quoted text' test local
+		"$1" "$@" ${HOME} 2>/dev/null
+	echo ${HOME} "$1" -eu $(pwd) 2>/dev/null local export 'quoted text'
+	then | "$1" done sed "$1" echo 'quoted text' sed /usr/bin
+		${HOME} then "$1" "$1" test done local | printf --verbose
+x=1 'quoted text' | cd cd cd 'quoted text' readonly cd
+		printf done echo 2>/dev/null done "$@" export x=1 && grep
+"$1" && echo -eu local then echo x=1 then -eu export /usr/bin awk export
+	"$@" 2>/dev/null /usr/bin test sed local then
+"$1" "$@" awk grep --verbose 2>/dev/null
+	2>/dev/null 2>/dev/null x=1 "$@" "$1"
+sed --verbose $(pwd) grep cd ${HOME} 2>/dev/null x=1
+		test awk "$1" | "$@" printf export "$@" x=1 && echo printf echo 2>/dev/null
+	| printf then sed "$1" "$@" --verbose grep 2>/dev/null
+	2>/dev/null "$1" && ${HOME} $(pwd) readonly /usr/bin /usr/bin
+		"$1" test -eu printf $(pwd) awk grep $(pwd) --verbose "$@" cd local
+		then --verbose x=1 "$@" cd "$1" done then cd -eu echo awk grep
+	echo "$@" "$1" --verbose "$1" x=1 echo && then --verbose $(pwd)
+readonly then 'quoted text' done 'quoted text' -eu
+		echo done printf -eu 2>/dev/null test -eu grep export 'quoted text'
+		-eu export | echo printf then 2>/dev/null --verbose x=1 "$1" && echo && && -eu
+readonly echo done grep done readonly ${HOME} x=1 $(pwd) then /usr/bin awk &&
+	grep awk printf $(pwd) readonly done $(pwd) ${HOME} -eu 2>/dev/null
+		"$1" 'quoted text' -eu -eu ${HOME} awk printf then | "$1" test sed /usr/bin sed
+"$@" x=1 -eu --verbose echo awk
+		${HOME} 2>/dev/null sed then 2>/dev/null cd "$@" done printf test 'quoted text'
+		&& | 'quoted text' "$@" printf "$1" cd readonly readonly
+		printf readonly export cd awk grep | sed test
+		echo cd "$@" $(pwd) "$@" | then echo
+	grep 'quoted text' $(pwd) | ${HOME}
+		2>/dev/null ${HOME} local ${HOME} x=1
+	test printf test 2>/dev/null
+		2>/dev/null --verbose then /usr/bin printf readonly "$@" then "$@" && done
+	sed test | -eu $(pwd) done --verbose test done ${HOME}
+	export test awk && awk printf
+	export local printf test "$@" 2>/dev/null
+grep -eu readonly echo 2>/dev/null sed
+local echo done 2>/dev/null awk local done "$1"
+	'quoted text' done -eu then && printf
+		echo readonly export test x=1 $(pwd) sed done local test grep 2>/dev/null
+		"$1" 'quoted text' readonly 'quoted text'
+		echo $(pwd) "$1" echo echo echo
+		done "$1" grep 'quoted text' awk "$@" then
+		$(pwd) grep test "$@" "$1" then --verbose ${HOME} x=1 grep test export grep
+	grep --verbose 2>/dev/null
+		x=1 readonly local "$1" | then 2>/dev/null "$1" local $(pwd) "$1" $(pwd) echo done
+x=1 grep cd --verbose | awk echo grep x=1 $(pwd) then sed "$1" export done printf
+		--verbose "$@" done |
+		-eu | "$1" "$1" /usr/bin printf |
+printf grep && test done done echo printf export /usr/bin
+sed /usr/bin && test "$@" test awk | awk 2>/dev/null "$@" echo echo 2>/dev/null
+/usr/bin local echo sed test grep grep awk /usr/bin
+	x=1 cd sed --verbose printf echo | then local done echo grep readonly awk
+	readonly export done $(pwd) done 2>/dev/null sed echo printf
+grep --verbose then | sed $(pwd) done echo "$1" cd echo grep --verbose
+	cd "$1" -eu ${HOME} readonly awk $(pwd)
+		export then done sed then awk "$@" $(pwd) printf echo export sed x=1 done test cd
+then 'quoted text' 'quoted text'
+		test cd printf && export $(pwd) ${HOME} awk then readonly -eu done "$@" --verbose
+		sed "$1" export "$@" cd export sed local | test
+	${HOME} ${HOME} export && printf done
+		--verbose test grep sed 'quoted text'
+		printf cd echo readonly 2>/dev/null "$1" cd 2>/dev/null
+| local cd echo ${HOME} readonly -eu ${HOME} printf
+test done sed done 2>/dev/null
+		"$1" "$1" done done 'quoted text' "$1"
+	-eu && printf printf x=1 cd then $(pwd) 2>/dev/null x=1 --verbose && |
+&& echo export "$@" x=1 && /usr/bin
+--verbose sed && ${HOME} export ${HOME} 2>/dev/null cd "$@" "$@" test export
+		"$1" cd "$1" "$1" | 'quoted text' --verbose
+--verbose 2>/dev/null 'quoted text' sed local cd readonly
+	printf --verbose 2>/dev/null "$@" --verbose "$1" && echo /usr/bin
+/usr/bin /usr/bin 2>/dev/null x=1 "$1" local then grep
+		/usr/bin echo x=1 export "$1" 'quoted text' readonly readonly done cd &&
+&& local local 'quoted text'
+		$(pwd) awk ${HOME} x=1
+x=1 test "$@" -eu $(pwd) grep 2>/dev/null ${HOME} cd grep 'quoted text'
+	printf export x=1 sed "$@" $(pwd)
+test cd awk cd $(pwd) done x=1
+	awk 'quoted text' export then export awk -eu readonly
+		&& 'quoted text' grep echo "$1"
+		test "$1" test && then "$@" 2>/dev/null readonly
+	export local "$1" echo x=1 sed grep local 2>/dev/null && 2>/dev/null
+'quoted text' grep readonly
+		'quoted text' test | readonly /usr/bin done ${HOME} --verbose |
+	'quoted text' then test printf cd then grep echo readonly
+sed printf "$1" 2>/dev/null export
+		'quoted text' readonly ${HOME} x=1 2>/dev/null ${HOME} "$1" done | 'quoted text'
+	test cd && "$1" "$1" done -eu 'quoted text' "$1"
+then --verbose -eu 2>/dev/null /usr/bin "$1" ${HOME} | local then
+	${HOME} && export awk sed printf | then
+	--verbose --verbose 'quoted text' "$@" && export ${HOME}
+	-eu printf cd sed test && "$1" | 2>/dev/null
+		sed cd x=1 sed 'quoted text' awk && local | then
+		--verbose grep /usr/bin export test 2>/dev/null cd x=1 local "$@"
+		--verbose sed x=1 ${HOME} --verbose --verbose && "$1" 2>/dev/null && sed awk
+'quoted text' | $(pwd) --verbose test $(pwd)
+	sed && ${HOME} 2>/dev/null awk /usr/bin export "$1" | | printf sed
+	'quoted text' "$1" --verbose local then awk "$1"
+then export | 'quoted text' 'quoted text' --verbose export
+	test local sed "$1" cd export test
+	${HOME} x=1 "$@" 'quoted text' then test x=1 | test ${HOME} readonly sed done then
+		then x=1 local done && /usr/bin 2>/dev/null then 2>/dev/null
+		then 2>/dev/null && 2>/dev/null 'quoted text' then -eu && done /usr/bin -eu
+	"$1" /usr/bin 'quoted text' cd --verbose "$@" done readonly
+readonly grep done | "$@" && "$@" grep | ${HOME} --verbose
+&& "$@" done echo /usr/bin
+		$(pwd) | -eu readonly grep cd
+	test /usr/bin local done echo $(pwd) $(pwd) awk $(pwd) ${HOME}
+		test 'quoted text' cd local x=1 --verbose grep readonly echo echo local "$1"
+	'quoted text' $(pwd) cd cd 'quoted text'
+		cd -eu grep 'quoted text' --verbose
+export echo --verbose "$@" awk
+	"$1" export x=1 /usr/bin x=1 sed local
+		local sed "$@" 'quoted text' test -eu test printf
+		2>/dev/null ${HOME} local
+		printf sed grep local cd grep
+	sed printf /usr/bin | then
+		then then ${HOME} x=1 grep
+	${HOME} 'quoted text' "$@" local --verbose export then
+		"$@" test /usr/bin --verbose --verbose grep $(pwd) 'quoted text'
+	then awk test -eu && /usr/bin
+	local done && | readonly test "$@" local sed 2>/dev/null ${HOME} -eu $(pwd)
+	then --verbose echo test | awk done grep then 2>/dev/null 2>/dev/null ${HOME} awk
+		"$@" $(pwd) then sed local 'quoted text' "$@"
+		echo $(pwd) cd ${HOME} "$@" grep 'quoted text' && 'quoted text'
+	-eu test && awk then --verbose done | -eu --verbose /usr/bin "$1" export
+done ${HOME} test readonly "$@" then | | 'quoted text' sed | grep
+	readonly sed /usr/bin echo local "$@" --verbose
+x=1 grep grep x=1 test
+		/usr/bin | -eu echo ${HOME} then local grep printf echo | export export
+done -eu export done /usr/bin grep "$1" x=1 'quoted text' test
+$(pwd) export cd "$1" 'quoted text' 'quoted text'
+	2>/dev/null test grep sed then
+		"$@" local 'quoted text' /usr/bin 2>/dev/null
+	export grep cd export then export 'quoted text'
+	printf $(pwd) export --verbose
+readonly awk -eu 2>/dev/null local readonly /usr/bin --verbose 2>/dev/null
+		cd done -eu export test readonly && then ${HOME} readonly
+sed readonly ${HOME} echo echo -eu $(pwd) test -eu 'quoted text'
+		${HOME} ${HOME} --verbose |
+	/usr/bin sed test sed echo | export ${HOME} -eu && "$@" awk cd export
+sed 'quoted text' done 2>/dev/null readonly local done test "$@"
+	export test then 2>/dev/null export
+sed printf && cd cd x=1 printf cd 2>/dev/null /usr/bin done "$@"
+		local grep $(pwd) done ${HOME} ${HOME} test export cd echo export && ${HOME}
+local sed readonly && sed --verbose
+		--verbose x=1 cd test 2>/dev/null
+	"$@" readonly | grep cd x=1 'quoted text'
+${HOME} then echo && sed -eu printf 'quoted text'
+		"$1" awk -eu -eu "$@" && /usr/bin readonly cd awk grep "$@" 2>/dev/null
+${HOME} --verbose && 2>/dev/null
+		'quoted text' local -eu done done done done $(pwd) 2>/dev/null
+done local printf echo /usr/bin awk
+		local printf "$1" printf awk echo "$@" && "$1" echo readonly
+sed echo then export local readonly 'quoted text' x=1 echo sed --verbose $(pwd)
+	/usr/bin grep test -eu grep -eu "$1" --verbose cd 'quoted text'
+		-eu export /usr/bin cd && "$@" echo
+	local 2>/dev/null readonly x=1 export /usr/bin && printf "$1"
+		${HOME} test test echo | 'quoted text' "$1" && local awk
+		done done 'quoted text' x=1 grep export
+		&& sed 'quoted text' test | printf "$1" grep x=1 then sed $(pwd) then printf
+	-eu x=1 export printf && x=1 test then && "$1" echo $(pwd) --verbose "$1"
+		awk printf sed test awk -eu "$@" 2>/dev/null
+done readonly x=1 x=1 ${HOME} "$1" $(pwd) && | echo readonly "$@"
+'quoted text' cd 'quoted text' then | && | test then done $(pwd) && local
+		x=1 then export ${HOME} then grep --verbose done
+	-eu "$@" $(pwd) | cd awk echo
+readonly x=1 | sed grep local ${HOME} "$@" readonly grep --verbose
+readonly readonly then local ${HOME} 2>/dev/null x=1 local 2>/dev/null
+		/usr/bin local -eu --verbose awk then x=1 ${HOME} 2>/dev/null -eu sed
+		"$1" sed x=1 cd readonly cd
+	/usr/bin test /usr/bin export $(pwd) test 'quoted text' 2>/dev/null
+"$@" cd $(pwd) printf readonly ${HOME} local
+	cd && 'quoted text' 2>/dev/null echo | readonly x=1
+	| 2>/dev/null readonly ${HOME} $(pwd) grep 'quoted text' echo
+		${HOME} grep && x=1 "$1" done printf
+		printf local -eu ${HOME} local printf
+		${HOME} "$@" grep then test ${HOME} "$@"
+		/usr/bin local readonly awk -eu local cd grep
+-eu local test awk /usr/bin done x=1 --verbose readonly printf
+	&& done test /usr/bin cd awk cd --verbose "$@"
+printf -eu -eu "$@" 2>/dev/null
+		"$1" 2>/dev/null readonly readonly ${HOME}
+	echo "$1" && then grep /usr/bin cd cd 'quoted text'
+	| awk grep done 2>/dev/null echo
+		/usr/bin "$1" then $(pwd) $(pwd) readonly grep readonly
+	$(pwd) $(pwd) then $(pwd) && && 2>/dev/null "$1" printf &&
+		grep $(pwd) sed export x=1
+		test local local grep awk | echo readonly "$1" echo readonly $(pwd) "$@" local
+		done sed && && --verbose then ${HOME} $(pwd)
+		| done 2>/dev/null 'quoted text' && done printf
+		grep /usr/bin && then done echo -eu printf grep then --verbose
+	test export echo 'quoted text' 'quoted text' grep -eu export
+		echo then done | "$1" /usr/bin 2>/dev/null sed echo --verbose done
+		echo --verbose readonly printf grep && -eu export x=1 --verbose
+| && --verbose printf "$1" /usr/bin 2>/dev/null awk "$@" ${HOME}
+		then | "$1" then done 'quoted text' x=1 awk $(pwd) "$@" echo
+${HOME} then cd $(pwd) && 'quoted text'
+		${HOME} readonly awk sed x=1
+		test "$1" test test x=1 printf done export
+	/usr/bin export grep 'quoted text' ${HOME} $(pwd)
+"$@" "$1" printf grep 'quoted text' echo
+		$(pwd) done readonly then done 'quoted text' 'quoted text' /usr/bin
+	2>/dev/null "$@" 2>/dev/null x=1 --verbose grep "$1" "$@" readonly
+test export awk cd /usr/bin /usr/bin
+readonly | $(pwd) then done
+awk export | && then sed x=1 | x=1 -eu && printf 2>/dev/null x=1 sed test
+		"$1" --verbose test grep ${HOME} sed x=1 awk cd
+readonly done printf | sed 'quoted text'
+		"$1" 'quoted text' ${HOME} -eu | test readonly
+		printf done 'quoted text' awk "$@" echo echo done grep grep -eu awk -eu --verbose
+		--verbose done then x=1 x=1 echo done
+	awk -eu cd test | then cd /usr/bin --verbose
+--verbose echo --verbose 'quoted text' | printf sed
+	&& 2>/dev/null 2>/dev/null
+&& 2>/dev/null done grep $(pwd) test $(pwd) then readonly /usr/bin
+	done readonly x=1 export
+	export && export ${HOME} local then then grep local /usr/bin
+		grep && export awk then echo cd awk echo printf done --verbose
+"$1" then 2>/dev/null x=1 2>/dev/null done x=1 readonly
+	echo echo ${HOME} awk "$1" | grep | 2>/dev/null --verbose
+"$1" awk sed -eu sed $(pwd) 2>/dev/null /usr/bin --verbose
+printf | 'quoted text' readonly sed done 2>/dev/null /usr/bin
+	echo awk /usr/bin test "$@" 'quoted text' export ${HOME} echo $(pwd)
+--verbose export $(pwd) test echo --verbose
+echo && then --verbose grep cd --verbose -eu 2>/dev/null -eu |
+	"$@" $(pwd) | readonly 'quoted text' "$1" /usr/bin awk "$@" && /usr/bin /usr/bin
+		awk local 'quoted text'
+readonly --verbose /usr/bin done "$@" awk local 2>/dev/null cd printf
+	export x=1 --verbose printf done cd | sed &&
+		2>/dev/null then "$@" $(pwd) && -eu && /usr/bin $(pwd) --verbose -eu echo then
+	awk $(pwd) sed sed export test x=1
+	| cd local ${HOME} 2>/dev/null | grep awk
+	echo readonly 2>/dev/null
+		printf sed "$@" 2>/dev/null 2>/dev/null sed grep | && export
+		${HOME} "$1" awk /usr/bin $(pwd) -eu /usr/bin test -eu ${HOME} "$1" --verbose
+		local x=1 "$@" /usr/bin --verbose ${HOME} echo && && sed echo
+		readonly export grep grep local test --verbose then 'quoted text' --verbose
+		"$1" local sed 2>/dev/null export export printf
+		echo done then $(pwd) 'quoted text' then test x=1
+done && "$@" local -eu local /usr/bin test --verbose readonly | printf
+	&& --verbose && ${HOME} awk | done sed "$@" -eu "$@" cd echo printf ${HOME}
+	${HOME} done 'quoted text' $(pwd) test &&
+${HOME} sed grep local 'quoted text' sed printf sed x=1 $(pwd) "$1"
+	sed -eu /usr/bin 2>/dev/null
+local --verbose "$@" done echo | readonly
+		cd $(pwd) -eu done "$@" export
+	sed printf /usr/bin local awk sed printf /usr/bin 2>/dev/null
+		--verbose test "$1" --verbose -eu -eu test grep sed test test $(pwd) echo "$1"
+		"$1" done && 'quoted text' done local | printf readonly readonly "$1" | export
+	"$@" && grep | x=1 $(pwd) ${HOME}
+		$(pwd) cd ${HOME} test test 2>/dev/null --verbose printf echo "$1" -eu readonly
+export done --verbose readonly &&
+		&& sed readonly then ${HOME}
+		then grep 2>/dev/null export done && "$1" $(pwd) 'quoted text' test "$1"
+		printf x=1 sed then export "$@" x=1 echo echo test
+	readonly cd /usr/bin printf x=1 x=1 /usr/bin done && /usr/bin "$@" 'quoted text'
+	grep cd x=1 then grep $(pwd) $(pwd) 2>/dev/null awk
+	sed then export local --verbose --verbose
+	/usr/bin x=1 ${HOME} done echo test $(pwd)
+		echo -eu grep --verbose 'quoted text' export
+readonly | grep local
+	| readonly && awk then cd && export local readonly /usr/bin then 2>/dev/null
+&& test | readonly local && echo /usr/bin
+		| --verbose -eu $(pwd) then | readonly test export
+grep x=1 awk local 2>/dev/null 2>/dev/null && 2>/dev/null
+	${HOME} "$@" ${HOME} local done 2>/dev/null local
+		-eu awk "$1" ${HOME} "$1" 2>/dev/null 2>/dev/null
+		export $(pwd) local && then
+		echo 2>/dev/null x=1 --verbose readonly echo | echo
+	local --verbose "$1" && local done readonly awk /usr/bin "$1" 2>/dev/null
+		export grep "$@" -eu -eu done done --verbose /usr/bin export local /usr/bin
+	"$1" --verbose test cd awk then | cd "$@" cd 'quoted text' grep export |
+	export awk awk 2>/dev/null 'quoted text'
+	done awk 'quoted text' | then 2>/dev/null test 'quoted text' export
+export && test --verbose readonly
+test awk 2>/dev/null test /usr/bin local readonly
+	${HOME} then test cd && done 'quoted text'
+	'quoted text' test grep export | printf local printf
+		&& done ${HOME} 'quoted text' local 'quoted text' awk 'quoted text'
+printf test 'quoted text' /usr/bin test readonly
+"$@" "$1" local "$@" | grep local ${HOME} 2>/dev/null
+	-eu cd sed export grep grep 2>/dev/null echo x=1 2>/dev/null
+	2>/dev/null ${HOME} grep cd cd sed 2>/dev/null ${HOME} awk $(pwd) test "$1" done
+	grep cd /usr/bin "$1" export --verbose | cd x=1 2>/dev/null
+		&& -eu done grep local printf "$1"
+export local --verbose export "$@" -eu $(pwd) awk
+	done echo readonly 'quoted text' awk awk | ${HOME} && then test && x=1 then done
+printf test "$@" then readonly $(pwd)
+	-eu x=1 ${HOME} x=1 /usr/bin
+done "$1" readonly done export 2>/dev/null
+	&& x=1 x=1 ${HOME} echo printf |
+printf test then "$@" ${HOME} readonly -eu then then /usr/bin
+		${HOME} && local readonly && --verbose ${HOME} | /usr/bin readonly
+	echo test $(pwd) sed awk grep --verbose -eu done ${HOME} local
+	x=1 done printf | readonly local
+$(pwd) grep "$1" "$@" done printf export test export
+		/usr/bin echo 2>/dev/null
+--verbose awk /usr/bin ${HOME}
+printf | grep x=1 awk /usr/bin done "$@"
+/usr/bin cd && 2>/dev/null /usr/bin /usr/bin
+		grep "$@" export local -eu ${HOME}
+2>/dev/null grep 2>/dev/null --verbose
+	x=1 "$1" x=1 sed "$@" echo "$@" 2>/dev/null done "$@" awk awk export
+	2>/dev/null && /usr/bin printf ${HOME} echo ${HOME} ${HOME} ${HOME}
+	-eu echo test sed readonly
+x=1 -eu && x=1 done -eu -eu done readonly
+		| -eu echo grep "$@" --verbose grep
+printf x=1 readonly printf
+		--verbose sed "$1" test readonly && test "$1"
+		x=1 cd grep local 2>/dev/null test x=1 /usr/bin && -eu grep test 'quoted text'
+readonly "$1" local printf printf && awk readonly
+		x=1 cd x=1 | && ${HOME} ${HOME} local
+		"$1" x=1 export local
+--verbose ${HOME} 2>/dev/null "$1" cd test then test
+	${HOME} sed readonly readonly then awk ${HOME} 'quoted text'
+	done awk x=1 && export sed 2>/dev/null printf echo
+-eu echo test awk export local "$@" -eu | test sed && export --verbose sed
+awk then /usr/bin $(pwd) &&
+		done local awk ${HOME} | && --verbose awk grep
+	${HOME} done grep --verbose awk echo printf sed done awk
+--verbose x=1 -eu --verbose echo awk 'quoted text' "$@" cd
+	'quoted text' test done 'quoted text'
+		/usr/bin -eu local --verbose grep test test echo printf sed && test
+	local 2>/dev/null echo -eu
+$(pwd) 'quoted text' done cd sed ${HOME} 'quoted text' | readonly $(pwd)
+${HOME} -eu | && sed awk sed 'quoted text' $(pwd) test 2>/dev/null && $(pwd) cd
+	| $(pwd) 'quoted text' done
+	"$1" cd 2>/dev/null local test readonly
+	test && 'quoted text' -eu test x=1 cd 'quoted text'
+		-eu echo printf readonly export grep
+		x=1 printf sed -eu readonly 'quoted text'
+		export "$@" readonly && grep 2>/dev/null local echo x=1 awk "$1" export grep local
+	&& | sed sed sed x=1 --verbose 2>/dev/null grep sed readonly /usr/bin "$@"
+	grep && printf --verbose "$1" printf then grep 2>/dev/null
+		--verbose "$@" ${HOME} sed readonly | "$@" local
+	done done --verbose echo grep
+cd -eu ${HOME} then local 2>/dev/null awk --verbose $(pwd) 'quoted text' test
+		grep then 2>/dev/null $(pwd) | awk echo
+$(pwd) | printf && --verbose grep &&
+$(pwd) local -eu readonly
+	export cd echo test sed -eu
+--verbose grep ${HOME} x=1 export "$1" local test -eu
+cd | done cd then sed
+-eu echo 'quoted text' printf 'quoted text'
+"$1" 'quoted text' "$1" local grep awk done "$1" test --verbose then -eu
+		"$1" 2>/dev/null readonly local echo "$@"
+		awk awk x=1 'quoted text' printf 'quoted text' "$@" && echo 2>/dev/null "$@"
+		-eu sed 'quoted text' -eu "$1" grep sed x=1 -eu local then "$@" "$1" cd $(pwd)
+echo $(pwd) export -eu
+		grep echo /usr/bin awk ${HOME}
+readonly x=1 export --verbose
+	x=1 x=1 2>/dev/null 2>/dev/null
+	x=1 done /usr/bin | export then
+export 2>/dev/null echo readonly -eu cd cd sed $(pwd) done $(pwd) | sed
+local done ${HOME} printf | && $(pwd) export awk --verbose $(pwd) sed cd
+		$(pwd) export ${HOME} printf
+		awk x=1 local | -eu 2>/dev/null local export x=1 printf export &&
+	2>/dev/null readonly cd ${HOME} cd done sed test readonly
+		awk "$@" /usr/bin echo x=1 done "$@" grep echo then | sed cd awk printf
+		'quoted text' | "$1" ${HOME} "$@" sed then done ${HOME}
+	'quoted text' printf readonly done $(pwd) "$1" printf then
+		-eu && $(pwd) test -eu then x=1 | local awk && --verbose 2>/dev/null -eu
+/usr/bin cd printf grep grep local -eu $(pwd) 'quoted text' &&
+	cd test echo local grep then $(pwd) echo 'quoted text' 2>/dev/null grep && ${HOME}
+		$(pwd) done printf 2>/dev/null test | echo printf
+then local echo then local 'quoted text' "$1" $(pwd) --verbose | --verbose cd then
+		2>/dev/null | "$@" "$1" then printf | x=1 readonly export && /usr/bin
+	| -eu readonly ${HOME} printf printf cd sed
+then x=1 cd 'quoted text' awk | awk
+then local "$1" 'quoted text' "$1" awk readonly
+	| export | readonly /usr/bin 'quoted text'
+local "$@" "$1" then "$1"
+		'quoted text' cd done
+local grep -eu then | done | printf --verbose done done sed x=1 | then
+local | $(pwd) local sed 2>/dev/null /usr/bin awk
+		| "$@" /usr/bin local awk sed awk /usr/bin
+	-eu $(pwd) awk && x=1 "$1" done 2>/dev/null
+	'quoted text' printf ${HOME}
+		cd grep awk cd printf | 'quoted text' sed echo && readonly 'quoted text' 2>/dev/null
+$(pwd) cd cd test done cd sed x=1 && ${HOME} cd && ${HOME} export sed awk
+		printf "$@" x=1 awk -eu ${HOME} export ${HOME} -eu && sed sed cd
+	local echo printf 'quoted text' | printf /usr/bin then | x=1 cd test readonly
+readonly "$@" -eu cd echo
+		"$@" readonly 2>/dev/null 'quoted text' ${HOME} local sed
+awk && awk $(pwd) grep done cd local
+		--verbose -eu test $(pwd) "$1" ${HOME} awk
+	&& local && -eu | $(pwd) ${HOME} test echo | && printf
+		awk -eu readonly cd done 'quoted text' grep test "$1"
+		"$1" cd awk echo cd cd done
+	'quoted text' --verbose echo cd /usr/bin printf
+	printf cd -eu "$@" 2>/dev/null /usr/bin 2>/dev/null
+		echo printf x=1 done "$@" then "$@"
+		2>/dev/null -eu awk /usr/bin echo x=1
+		$(pwd) readonly sed | grep cd /usr/bin /usr/bin
+		"$@" --verbose cd | readonly
+export 2>/dev/null readonly printf test awk done grep /usr/bin readonly export
+	"$1" "$1" awk && then 'quoted text'
+		then | --verbose | sed -eu | | /usr/bin 2>/dev/null
+test ${HOME} local x=1 awk awk x=1 echo echo
+$(pwd) "$@" then -eu test && export done -eu grep
+	| cd && done export $(pwd) x=1 awk $(pwd) readonly
+		cd ${HOME} printf ${HOME} printf readonly printf
+"$1" test sed then test "$@" /usr/bin cd | x=1 'quoted text' readonly export
+	cd /usr/bin | test 'quoted text' x=1 awk ${HOME} awk "$@" export --verbose
+"$1" 'quoted text' "$@" sed $(pwd) /usr/bin --verbose x=1
+cd | grep readonly 'quoted text'
+-eu /usr/bin ${HOME} ${HOME} 2>/dev/null readonly
+		"$1" 2>/dev/null then export x=1 -eu test echo done test cd "$1" done $(pwd)
+		export | then local done /usr/bin "$@" /usr/bin test test cd "$1" sed "$1"
+/usr/bin local export cd /usr/bin x=1 --verbose ${HOME} echo | readonly
+		readonly readonly awk --verbose cd sed "$1" then readonly /usr/bin readonly 'quoted text'
+	2>/dev/null sed $(pwd) echo 2>/dev/null test x=1
+	cd then | 'quoted text' awk readonly 'quoted text' printf export $(pwd)
+"$@" done export done cd "$1" -eu "$1" "$1" done $(pwd)
+/usr/bin test ${HOME} done /usr/bin $(pwd) "$1" awk /usr/bin export
+-eu "$1" 'quoted text' then --verbose "$@" test 'quoted text' done echo
+grep 'quoted text' $(pwd) done
+		cd echo "$@" --verbose test sed sed -eu readonly $(pwd) 2>/dev/null
+	cd printf "$@" x=1 "$1" readonly export printf "$@" 2>/dev/null grep export
+	local cd grep --verbose readonly $(pwd) export
+		printf test awk /usr/bin | 2>/dev/null
+| ${HOME} x=1 local local /usr/bin /usr/bin x=1 'quoted text' then --verbose
+		'quoted text' sed "$1"
+	done cd --verbose export done sed --verbose
+		export cd --verbose echo | | sed 'quoted text' sed "$@" x=1 $(pwd) local printf
+	2>/dev/null x=1 && grep sed
+		awk 2>/dev/null -eu -eu -eu test done awk 'quoted text' readonly
+	'quoted text' echo 'quoted text' grep then printf $(pwd) echo printf x=1
+	test 'quoted text' ${HOME}
+		readonly done x=1 sed x=1 test printf 'quoted text'
+	test --verbose ${HOME} export 'quoted text'
+awk /usr/bin | && x=1 local test
+		grep local done ${HOME} "$@" done $(pwd) /usr/bin "$@" sed local sed
+2>/dev/null "$1" $(pwd) && -eu | cd && /usr/bin ${HOME} x=1 local /usr/bin
+${HOME} && $(pwd) then printf grep /usr/bin done local local printf then 2>/dev/null
+		then awk cd echo "$1" /usr/bin awk local local grep 'quoted text'
+	local /usr/bin export local echo readonly printf 2>/dev/null export
+sed "$1" 'quoted text' "$@" | cd "$1" printf done
+x=1 "$1" cd done | grep test grep
+| x=1 local $(pwd) | awk -eu && $(pwd)
+	${HOME} awk done ${HOME}
+	--verbose -eu | 2>/dev/null local echo ${HOME} printf
+		$(pwd) && --verbose ${HOME} -eu ${HOME} /usr/bin
+		export readonly local local --verbose echo test awk awk x=1 ${HOME} readonly
+cd done x=1 --verbose test 'quoted text'
+	grep export sed | /usr/bin --verbose echo
+	test then 'quoted text' cd cd 2>/dev/null grep 'quoted text' printf
+	sed done cd $(pwd) done echo readonly done "$1" sed /usr/bin 'quoted text'
+"$1" ${HOME} done cd done cd
+	'quoted text' ${HOME} 'quoted text'
+	printf 2>/dev/null echo then export local /usr/bin "$1" grep x=1
+	export then 'quoted text' "$@" /usr/bin $(pwd) ${HOME} ${HOME}
+export /usr/bin 2>/dev/null readonly 'quoted text' grep 'quoted text'
+/usr/bin local ${HOME} then -eu printf cd x=1 then "$1" x=1 echo
+		2>/dev/null local cd
+	2>/dev/null 'quoted text' local local | awk readonly awk
+	--verbose "$1" | test x=1 -eu echo /usr/bin 2>/dev/null x=1 awk printf
+awk awk local x=1 test awk --verbose
+'quoted text' test $(pwd) then readonly grep export 'quoted text' cd 2>/dev/null
+2>/dev/null readonly "$1" echo | grep printf
+	&& awk printf awk | then awk test readonly echo printf && x=1 awk | sed 2>/dev/null
+		&& -eu -eu $(pwd) 'quoted text' test awk done x=1 --verbose test ${HOME} export
+	cd sed cd done && awk grep cd x=1 2>/dev/null local test | --verbose $(pwd)
+	"$@" -eu 2>/dev/null "$@" && done grep --verbose grep 2>/dev/null $(pwd)
+	"$@" test awk grep export x=1 "$1"
+		"$1" x=1 printf "$1" --verbose ${HOME} grep --verbose | awk -eu |
+		cd sed cd awk 2>/dev/null ${HOME} sed | --verbose
+awk $(pwd) readonly "$1" cd x=1 awk $(pwd)
+		printf /usr/bin echo grep "$1" $(pwd) grep
+$(pwd) done $(pwd) export printf awk local
+2>/dev/null export && /usr/bin
+		${HOME} "$@" local grep --verbose printf 'quoted text'
+		$(pwd) cd /usr/bin x=1 $(pwd) then
+	--verbose local readonly sed x=1 readonly "$1" awk grep $(pwd)
+	&& awk printf awk x=1 2>/dev/null $(pwd) sed $(pwd) readonly
+	'quoted text' | sed $(pwd) test export x=1 done ${HOME} 'quoted text'
+"$@" then 'quoted text' readonly printf /usr/bin done -eu
+	grep 'quoted text' cd "$@" -eu readonly
+		readonly done done 2>/dev/null
+		test "$1" echo /usr/bin && ${HOME} then | ${HOME} grep done
+	local /usr/bin echo sed --verbose readonly done
+sed awk export sed local awk awk | then awk "$@" local local 'quoted text'
+	awk local && export --verbose 2>/dev/null
+	readonly 2>/dev/null export export grep && ${HOME}
+-eu test && && sed | ${HOME} 'quoted text' readonly && echo ${HOME}
+		test $(pwd) readonly 'quoted text'
+cd then && $(pwd) --verbose
+	readonly export && | && && sed grep cd
+		export then cd sed ${HOME}
+test then export "$@" export && 'quoted text' --verbose done
+${HOME} done 'quoted text' && readonly export 'quoted text' && -eu --verbose
+--verbose echo "$@" | -eu local x=1 x=1 2>/dev/null awk | &&
+	then echo --verbose /usr/bin $(pwd) -eu x=1 printf ${HOME} printf /usr/bin cd
+		done | awk export 2>/dev/null -eu /usr/bin
+		"$1" grep cd ${HOME} sed sed x=1 /usr/bin 2>/dev/null 'quoted text' grep then
+sed x=1 2>/dev/null sed
+	2>/dev/null readonly ${HOME}
+		2>/dev/null --verbose then
+cd readonly ${HOME} done echo done | export
+	"$@" 2>/dev/null "$@" cd export && awk
+		"$@" done && 'quoted text' sed
+		test && echo cd "$@" 2>/dev/null
+		test done done echo export && then "$1"
+	$(pwd) echo awk export && 2>/dev/null -eu export test 'quoted text' /usr/bin
+grep 2>/dev/null 'quoted text' -eu ${HOME} 'quoted text' /usr/bin printf /usr/bin
+done awk -eu export ${HOME} readonly then grep
+		${HOME} && "$@" /usr/bin printf 'quoted text' export export | local
+		-eu "$@" "$1" then echo 2>/dev/null local && ${HOME}
+		done local printf done echo 2>/dev/null done readonly "$@" --verbose ${HOME}
+		"$@" $(pwd) printf /usr/bin printf $(pwd)
+		awk printf ${HOME} $(pwd) done "$1"
+		readonly sed awk ${HOME} "$@" | | "$1" test -eu then &&
+x=1 "$@" ${HOME} 2>/dev/null readonly export
+	/usr/bin --verbose cd echo export x=1 "$@" 2>/dev/null 2>/dev/null grep awk
+	echo cd -eu readonly 2>/dev/null
+| -eu test export x=1 x=1 x=1 echo readonly echo "$1" export 'quoted text'
+grep done done readonly then x=1 2>/dev/null
+$(pwd) sed 'quoted text' export
+	done sed | sed export "$@" && 2>/dev/null grep readonly echo printf
+	cd done x=1 cd awk 2>/dev/null "$@" readonly export && && export -eu "$@"
+"$1" "$1" grep ${HOME} export
+	then x=1 test awk cd x=1 && done local local awk then cd grep local 2>/dev/null
+"$1" done 'quoted text' grep local
+	$(pwd) sed "$1" --verbose ${HOME} readonly
+	"$1" /usr/bin 'quoted text' awk then sed then sed export awk 2>/dev/null
+		x=1 -eu done export local local grep $(pwd)
+		test $(pwd) cd ${HOME} | printf
+		test | printf $(pwd) echo cd export readonly
+		export 'quoted text' done && && sed "$@" && --verbose
+sed printf --verbose then "$1" done 'quoted text'
+	echo x=1 $(pwd) 'quoted text' grep done "$@" echo -eu
+test && readonly $(pwd) local ${HOME} "$@" local -eu then 2>/dev/null "$@" grep
+		/usr/bin --verbose export then "$1" sed 'quoted text'
+	echo done "$1" export echo local x=1 "$@" cd $(pwd) then readonly 2>/dev/null
+		then "$@" 2>/dev/null x=1 x=1 awk export && then "$@" /usr/bin
+	$(pwd) "$@" 'quoted text' test grep | 'quoted text'
+readonly awk 2>/dev/null --verbose "$1" "$@"
+		${HOME} done cd ${HOME} 2>/dev/null sed grep 2>/dev/null $(pwd) x=1
+grep ${HOME} x=1 sed $(pwd) --verbose cd test /usr/bin $(pwd) $(pwd) ${HOME} --verbose
+		--verbose $(pwd) test --verbose
+	$(pwd) echo grep "$1" readonly && readonly "$@" x=1 grep then awk "$1" x=1
+		x=1 --verbose grep test export done grep
+done echo x=1 $(pwd) ${HOME} --verbose 2>/dev/null grep -eu
+		"$@" echo printf -eu &&
+	then done "$1" && awk && 'quoted text'
+	| -eu test x=1 x=1 awk echo "$@" -eu
+done test $(pwd) 2>/dev/null "$@" 'quoted text' --verbose
+&& $(pwd) awk cd ${HOME}
+		awk done | -eu | /usr/bin ${HOME} ${HOME} --verbose cd then "$@" "$@" printf
+awk done "$1" export 2>/dev/null cd then "$1" | 'quoted text' ${HOME}
+	readonly --verbose awk then local grep --verbose ${HOME} done ${HOME} then $(pwd)
+		export test | then $(pwd)
+echo /usr/bin readonly test -eu | "$@"
+		$(pwd) x=1 -eu ${HOME} then local ${HOME} readonly cd echo readonly
+		$(pwd) then then -eu ${HOME} then 'quoted text' "$@"
+	echo /usr/bin "$1" printf ${HOME} readonly echo done ${HOME} printf cd --verbose
+	then ${HOME} | && cd awk 'quoted text' x=1
+	printf "$@" | export grep "$@" echo local ${HOME} readonly awk 'quoted text'
+| echo "$@" | --verbose --verbose "$@" /usr/bin awk echo grep local
+	sed then then local grep $(pwd) x=1 "$@" -eu
+	readonly "$@" && $(pwd) "$1" "$@" $(pwd) printf
+		printf awk then 'quoted text' export "$@" cd 2>/dev/null
+	"$1" readonly && done local "$1"
+		--verbose "$@" readonly x=1 x=1 -eu --verbose printf readonly
+/usr/bin $(pwd) cd export x=1 $(pwd) sed readonly
+	${HOME} printf done grep "$@" -eu sed -eu printf printf 'quoted text' local
+-eu 2>/dev/null done done "$@" ${HOME} "$1" --verbose ${HOME} "$@" /usr/bin
+/usr/bin 2>/dev/null ${HOME} "$@" awk export
+		then --verbose "$1" test x=1 2>/dev/null ${HOME} -eu cd "$1" "$@" "$@" done
+${HOME} x=1 grep then 'quoted text'
+		local local test done cd --verbose readonly
+	then && x=1 export "$1" ${HOME} 'quoted text'
+${HOME} printf | cd cd ${HOME} "$@" printf test && awk echo echo test
+	| sed awk done local printf 2>/dev/null /usr/bin &&
+x=1 | "$1" readonly "$@" echo /usr/bin "$@" 'quoted text' $(pwd) test test
+	local sed export x=1 local 'quoted text' sed --verbose |
+--verbose 2>/dev/null $(pwd) grep $(pwd) sed printf readonly sed "$1"
+printf x=1 | cd export echo 'quoted text' then local awk 2>/dev/null
+		| && && -eu --verbose sed | $(pwd)
+$(pwd) $(pwd) | --verbose cd cd grep /usr/bin | export
+	cd ${HOME} then "$@" test printf
+	--verbose export -eu "$@" "$1" | | /usr/bin -eu cd 'quoted text' awk
+	cd then printf --verbose
+	"$1" echo cd -eu $(pwd) readonly done |
+		export /usr/bin test "$1" 'quoted text'
+printf export echo --verbose | done $(pwd) ${HOME} readonly "$1"
+		${HOME} /usr/bin test --verbose --verbose -eu ${HOME} printf
+--verbose export readonly && echo ${HOME} readonly cd printf
+	local export /usr/bin sed test "$1"
+	export "$@" grep /usr/bin "$@" ${HOME} "$@" done grep 2>/dev/null sed --verbose
+	local /usr/bin "$1" awk awk /usr/bin && $(pwd) "$@" export
+	"$1" 2>/dev/null local awk $(pwd) done
+	export test 2>/dev/null export cd ${HOME} sed "$1" | ${HOME}
+		${HOME} awk done x=1 export && printf readonly ${HOME} then readonly
+	--verbose /usr/bin printf done export echo echo ${HOME} echo
+	readonly --verbose && ${HOME} --verbose 'quoted text' "$@" grep
+		echo printf readonly 'quoted text'
+2>/dev/null -eu readonly | readonly
+	local --verbose "$1"
+	readonly && export export cd sed readonly test export ${HOME}
+&& test grep 2>/dev/null 'quoted text' sed printf echo
+echo -eu | cd --verbose grep readonly then x=1 /usr/bin 2>/dev/null
+		x=1 && /usr/bin sed echo grep && echo
+"$1" -eu -eu -eu && --verbose x=1 --verbose --verbose $(pwd) test "$@"
+		cd done "$@" grep -eu cd awk printf export x=1 readonly
+	"$@" $(pwd) ${HOME} 'quoted text' cd "$1" readonly sed $(pwd) printf printf
+readonly done /usr/bin $(pwd) -eu 'quoted text' | /usr/bin awk awk
+	| cd -eu "$@" "$1" cd sed awk 2>/dev/null 'quoted text' sed x=1 && echo done
+		awk -eu echo -eu grep then readonly
+		printf readonly done awk 'quoted text' local $(pwd)
+		test printf "$@" cd && done "$@" -eu readonly
+local && export && x=1 "$1" sed ${HOME}
+	${HOME} echo && --verbose --verbose
+	awk done cd export x=1 && --verbose grep then
+	--verbose 2>/dev/null printf $(pwd)
+	-eu ${HOME} | -eu export readonly then printf
+2>/dev/null && "$@" "$@" --verbose x=1 "$@" then local && x=1
+readonly printf 2>/dev/null
+		export x=1 --verbose | export
+		/usr/bin awk ${HOME} local printf
+		"$@" done --verbose 'quoted text' export --verbose
+test && && x=1 cd readonly 'quoted text'
+		${HOME} cd readonly ${HOME}
+	x=1 "$@" 2>/dev/null x=1 $(pwd) /usr/bin /usr/bin
+	$(pwd) awk sed --verbose /usr/bin echo -eu /usr/bin readonly x=1 $(pwd) /usr/bin
+	2>/dev/null "$1" -eu $(pwd) | $(pwd) ${HOME} --verbose 2>/dev/null $(pwd)
+		-eu printf && cd 2>/dev/null printf /usr/bin local grep 2>/dev/null &&
+	awk readonly sed then echo printf
+	grep grep local export x=1 echo local echo local -eu
+		${HOME} test test "$1" ${HOME} && printf export cd 2>/dev/null
+	2>/dev/null printf done cd &&
+$(pwd) 'quoted text' $(pwd) cd then
+echo ${HOME} then --verbose 2>/dev/null printf 'quoted text' test awk 2>/dev/null
+echo awk $(pwd) "$1" "$@" x=1 | export --verbose export sed /usr/bin grep
+		"$@" "$1" sed 2>/dev/null
+	/usr/bin readonly test then | done -eu awk done x=1 /usr/bin -eu --verbose
+export export readonly echo $(pwd) echo
+		done cd "$1" printf ${HOME} "$1" printf "$1"
+	${HOME} readonly echo "$@" local 'quoted text'
+	&& $(pwd) 2>/dev/null
+sed done /usr/bin 'quoted text'
+		export x=1 $(pwd) done cd export
+		/usr/bin grep cd readonly /usr/bin cd -eu awk cd -eu local && done "$1" --verbose
+		| cd ${HOME} ${HOME} /usr/bin
+	then ${HOME} awk 'quoted text' "$@" done local awk then then grep
+	done export awk local grep "$1" 2>/dev/null echo cd "$@" local --verbose
+	--verbose | 'quoted text' 2>/dev/null --verbose
+		"$@" "$1" test 2>/dev/null test then cd $(pwd)
+		then /usr/bin awk echo export 'quoted text' printf && printf
+	'quoted text' 'quoted text' test printf awk done test | cd readonly
+		done 2>/dev/null /usr/bin done x=1 done 2>/dev/null "$@" export
+		-eu --verbose -eu then /usr/bin -eu export export readonly | 2>/dev/null
+	--verbose "$1" printf 2>/dev/null export ${HOME} | export "$1" -eu $(pwd)
+		$(pwd) done readonly grep /usr/bin cd ${HOME} test $(pwd) local sed test sed
+	&& test --verbose 2>/dev/null "$@" -eu local
+		x=1 | 'quoted text' 'quoted text'
+	&& done printf done 2>/dev/null export done
+		${HOME} 2>/dev/null && "$@" $(pwd) grep
+		test --verbose echo echo -eu awk --verbose
+	local export grep printf x=1 | cd sed && --verbose -eu x=1 printf
+	done cd sed 2>/dev/null sed --verbose | then 2>/dev/null /usr/bin
+		"$1" 'quoted text' 2>/dev/null
+	&& echo readonly /usr/bin $(pwd) x=1 "$1" readonly x=1
+	printf 2>/dev/null echo -eu sed x=1 readonly
+2>/dev/null --verbose echo --verbose
+	x=1 -eu x=1 done cd awk echo 2>/dev/null "$1" -eu awk "$@" awk
+'quoted text' then /usr/bin echo
+	--verbose 2>/dev/null /usr/bin local -eu then "$1" "$1" --verbose -eu
+		/usr/bin local then | | echo then 2>/dev/null
+	| printf echo echo sed echo printf && $(pwd) done ${HOME}
+	--verbose readonly awk -eu --verbose
+	local printf then export ${HOME} --verbose cd --verbose local "$@" then 'quoted text'
+		$(pwd) then then cd printf printf "$1"
+	local $(pwd) 2>/dev/null cd done x=1 then cd "$1"
+--verbose local readonly "$1" local sed sed test 'quoted text'
+	-eu "$1" ${HOME} | -eu
+test "$@" -eu | then "$1" sed printf awk cd grep then 2>/dev/null
+printf cd export "$1" printf done export | then awk cd done then export sed
+printf --verbose done export x=1
+&& sed grep x=1 'quoted text' awk && 'quoted text' local
+	${HOME} -eu ${HOME} cd done -eu --verbose done ${HOME} grep
+	2>/dev/null done 'quoted text' readonly -eu then /usr/bin
+cd local 'quoted text' 2>/dev/null x=1
+	&& "$@" test "$1" awk x=1 readonly "$1" /usr/bin printf
+done x=1 done 2>/dev/null grep --verbose
+/usr/bin 'quoted text' x=1 export "$@" /usr/bin
+		| export readonly sed grep "$1" "$1" printf -eu
+'quoted text' sed x=1 && printf "$@" export test
+grep then 'quoted text' readonly && 'quoted text' sed x=1 grep readonly 'quoted text'
+		test grep /usr/bin && $(pwd) "$@"
+		test && && 'quoted text' -eu "$1" && awk done sed test 'quoted text'
+		test "$@" 2>/dev/null sed printf -eu ${HOME} 2>/dev/null sed printf 'quoted text'
+	-eu $(pwd) sed $(pwd) cd grep --verbose /usr/bin "$1" && -eu $(pwd) local
+cd awk --verbose grep "$@" | awk ${HOME} grep then |
+export 2>/dev/null -eu done done local 2>/dev/null && "$1" cd readonly cd $(pwd)
+	"$@" x=1 printf x=1 awk local test 'quoted text'
+"$@" ${HOME} /usr/bin export --verbose --verbose echo "$1"
+		readonly awk test printf echo then $(pwd) &&
+	| export grep 'quoted text' $(pwd) | done
+	readonly --verbose | echo local ${HOME}
+		/usr/bin done $(pwd) readonly done x=1 2>/dev/null export done grep /usr/bin
+$(pwd) $(pwd) && local /usr/bin 2>/dev/null test awk then 2>/dev/null
+sed printf echo x=1 | printf /usr/bin "$1" sed /usr/bin
+		done cd echo grep --verbose $(pwd)
+	then done /usr/bin "$1" ${HOME} "$@" "$@" 'quoted text'
+		awk -eu test readonly then grep -eu && grep local sed "$@" "$1" local --verbose
+2>/dev/null done $(pwd) readonly then "$@"
+		x=1 sed && 'quoted text' then test && 2>/dev/null echo ${HOME} /usr/bin
+		awk awk -eu sed done -eu then "$@" grep done then
+		grep done local then then cd 2>/dev/null --verbose | done $(pwd) local echo export
+printf cd readonly grep --verbose echo "$1" 'quoted text' printf "$1" | "$1" export
+	echo grep /usr/bin "$@" readonly x=1 ${HOME} export echo x=1 readonly
+		sed -eu done $(pwd) grep awk | grep test --verbose
+export "$1" grep --verbose ${HOME} /usr/bin grep echo
+	echo readonly x=1 x=1 printf --verbose then printf local printf
+done grep --verbose test awk "$1" awk /usr/bin | done
+x=1 awk printf printf -eu 2>/dev/null 'quoted text' --verbose
+	local ${HOME} $(pwd) /usr/bin readonly | | done then
+	cd echo 'quoted text' done
+	then sed x=1 'quoted text' "$@" awk test $(pwd) --verbose ${HOME} printf
+	x=1 2>/dev/null printf "$1" ${HOME} echo 2>/dev/null
+		echo ${HOME} "$@" && | -eu /usr/bin cd echo --verbose 'quoted text' ${HOME} -eu
+	done done printf test /usr/bin
+	then "$@" "$@" x=1 ${HOME}
+awk "$1" done -eu 'quoted text' test done -eu ${HOME} export grep then -eu test
+$(pwd) 2>/dev/null $(pwd) "$@" $(pwd) --verbose
+	then done | printf $(pwd) "$@" done 'quoted text' 2>/dev/null --verbose
+grep x=1 'quoted text' -eu grep && sed && "$1"
+	$(pwd) && /usr/bin printf 2>/dev/null -eu
+	export export export cd awk echo -eu grep awk ${HOME} then awk awk cd echo then
+then echo $(pwd) -eu cd 2>/dev/null
+		readonly "$@" export grep echo then
+--verbose x=1 'quoted text' then /usr/bin printf 'quoted text' --verbose awk
+x=1 test /usr/bin 2>/dev/null local 2>/dev/null "$1" printf && -eu "$1" sed
+		&& printf 'quoted text' done
+cd "$1" -eu | && ${HOME} awk awk x=1 printf "$1" test grep "$@" readonly
+echo sed && cd awk ${HOME} -eu "$@" readonly
+echo -eu done -eu -eu $(pwd)
+		local x=1 | test "$@" printf
+	${HOME} export printf 'quoted text' ${HOME} $(pwd) echo test
+grep ${HOME} 'quoted text' awk 2>/dev/null
+		"$1" readonly echo 'quoted text' sed sed --verbose
+		"$@" cd grep -eu echo grep printf readonly cd "$@" | x=1 'quoted text' awk &&
+	local -eu test | readonly local done "$1" echo echo | && && "$1" $(pwd)
+	-eu x=1 export readonly awk
+		| $(pwd) test /usr/bin /usr/bin --verbose
+'quoted text' $(pwd) local
+		grep && "$@" --verbose
+${HOME} ${HOME} then export $(pwd)
+--verbose echo export
+done "$@" /usr/bin 'quoted text' $(pwd) ${HOME} export
+		/usr/bin readonly "$@" printf then
+'quoted text' 2>/dev/null awk 2>/dev/null cd x=1 then && grep
+sed --verbose 2>/dev/null readonly --verbose 2>/dev/null
+	grep awk then 'quoted text' --verbose
+		/usr/bin "$1" then cd grep 2>/dev/null --verbose readonly
+	test readonly "$1" export && && printf done $(pwd) -eu echo "$1"
+2>/dev/null printf "$1" "$@" readonly local readonly x=1 -eu
+		export test done ${HOME} printf "$1" readonly --verbose
+		awk awk --verbose cd printf 2>/dev/null 'quoted text' && export sed then done --verbose
+		"$1" test sed ${HOME} sed done -eu x=1 -eu /usr/bin cd
+		local /usr/bin then done sed
+	grep 'quoted text' cd "$@" test
+		echo $(pwd) ${HOME} sed 2>/dev/null
+grep sed export local export | -eu
+$(pwd) then "$1" then && $(pwd) printf done awk
+	sed cd echo --verbose cd -eu cd "$1" printf --verbose
+		sed | -eu awk readonly
+		"$@" --verbose -eu "$@" 2>/dev/null 'quoted text' -eu then "$1"
+	--verbose ${HOME} 2>/dev/null 'quoted text'
+${HOME} then sed export "$@" awk echo -eu readonly test 2>/dev/null
+	test test 2>/dev/null ${HOME} -eu
+		${HOME} /usr/bin readonly $(pwd)
+	-eu && $(pwd) -eu sed test $(pwd) done local then test && local cd 2>/dev/null
+	cd x=1 /usr/bin -eu --verbose | test cd export | export
+&& -eu sed "$@" "$1" 'quoted text' -eu "$@" then -eu cd --verbose | "$1" &&
+		"$1" $(pwd) test 2>/dev/null ${HOME} done cd $(pwd) test printf x=1 readonly
+		"$@" echo grep local printf "$@" 'quoted text' | grep
+readonly export then awk $(pwd) printf echo
+	$(pwd) echo $(pwd) test $(pwd) $(pwd) $(pwd) done "$1" -eu -eu local readonly echo
+test && readonly && echo local | 'quoted text' | printf /usr/bin
+| echo local grep -eu -eu
+export local test printf --verbose 2>/dev/null -eu "$1" done export 2>/dev/null
+local readonly x=1 export local
+sed test $(pwd) -eu readonly
+printf && ${HOME} cd -eu --verbose done /usr/bin test readonly ${HOME} 'quoted text'
+	--verbose 'quoted text' done -eu local
+	&& /usr/bin cd -eu --verbose echo 2>/dev/null echo then echo
+		${HOME} --verbose 2>/dev/null echo local test | && awk "$1" --verbose
+		printf echo 'quoted text' printf "$1"
+	"$@" ${HOME} x=1 readonly readonly x=1 -eu ${HOME} export
+	"$@" ${HOME} "$@" grep "$1" 2>/dev/null
+done | ${HOME} && -eu --verbose | 2>/dev/null grep "$@" local
+		${HOME} printf 2>/dev/null "$@" "$@" 'quoted text' then printf &&
+	/usr/bin && test /usr/bin awk /usr/bin
+	awk -eu -eu ${HOME} echo -eu -eu printf done ${HOME} "$@" 'quoted text'
+		export awk grep && $(pwd)
+&& 'quoted text' | ${HOME} readonly export | ${HOME} then "$@" cd "$@" then
+local 'quoted text' cd $(pwd) sed readonly test
+		| readonly done -eu "$@" /usr/bin "$@" done /usr/bin
+	printf printf -eu && done --verbose /usr/bin
+	"$@" export -eu grep sed ${HOME} echo
+	readonly "$@" export 'quoted text' && then then 2>/dev/null grep printf "$1"
+readonly --verbose -eu 2>/dev/null ${HOME} --verbose $(pwd) --verbose echo
+'quoted text' ${HOME} $(pwd) | done $(pwd) /usr/bin "$@" test "$1" -eu
+	| printf test 'quoted text' &&
+	$(pwd) "$@" 2>/dev/null
+	cd -eu done "$@" test x=1 local then ${HOME} grep cd test local
+printf "$@" x=1 | ${HOME} sed cd awk export readonly 2>/dev/null
+	then sed local x=1 local ${HOME} "$@" printf test
+	echo && x=1 2>/dev/null "$1"
+	--verbose printf --verbose
+	cd test sed awk "$@" ${HOME} done echo
+--verbose | local awk x=1 /usr/bin export grep ${HOME} x=1
+	${HOME} | echo 'quoted text'
+x=1 test 2>/dev/null readonly local test then cd sed echo export
+/usr/bin awk readonly /usr/bin /usr/bin $(pwd) done
+/usr/bin --verbose printf echo sed test
+cd cd 'quoted text' ${HOME} "$@" printf
+readonly cd local local readonly | ${HOME}
+		export --verbose 'quoted text' printf 2>/dev/null echo ${HOME} 2>/dev/null
+		/usr/bin printf $(pwd) readonly 'quoted text' 2>/dev/null
+		/usr/bin -eu /usr/bin local grep awk
+echo awk 2>/dev/null && "$1" readonly echo && local test $(pwd) --verbose
+	cd /usr/bin -eu 2>/dev/null cd test 2>/dev/null
+		awk "$@" awk export local 2>/dev/null
+		echo "$@" sed 'quoted text' -eu printf 'quoted text' -eu "$@" done --verbose
+	test sed test then done -eu awk /usr/bin printf
+then done | x=1 x=1 local "$@" test readonly $(pwd)
+		grep | ${HOME} grep readonly grep readonly then 'quoted text' x=1 echo
+	"$1" "$1" cd ${HOME} && local test /usr/bin 2>/dev/null export sed /usr/bin
+#include c160.sh
+	"$1" test "$@" then done echo && | | done export export
+		&& test | cd $(pwd) "$1"
+cd "$@" 2>/dev/null 'quoted text' | $(pwd) local cd local --verbose
+	then echo -eu awk ${HOME} 'quoted text'
+		$(pwd) | ${HOME} /usr/bin export cd grep sed test ${HOME} x=1 export x=1
+		-eu export $(pwd) 2>/dev/null /usr/bin --verbose -eu 'quoted text' then /usr/bin
+-eu echo then x=1 2>/dev/null done | grep && /usr/bin
+		then test done "$@" cd "$1" "$@"
+sed printf | /usr/bin local "$1" cd awk
+test cd && then grep sed then grep readonly awk sed sed 2>/dev/null echo done
+		'quoted text' 2>/dev/null --verbose sed $(pwd) test --verbose ${HOME} $(pwd)
+		"$@" then sed x=1 cd test 'quoted text' 'quoted text' 2>/dev/null ${HOME}
+-eu 'quoted text' printf sed
+$(pwd) --verbose -eu | x=1 printf /usr/bin cd x=1 grep local --verbose
+done export local done && sed "$@" printf 2>/dev/null "$@" ${HOME} 'quoted text'
+printf /usr/bin readonly grep "$@" /usr/bin readonly then $(pwd) --verbose
+		done readonly 2>/dev/null local -eu printf printf 2>/dev/null $(pwd) readonly
+	${HOME} local cd grep --verbose | -eu x=1 printf then /usr/bin
+	export 'quoted text' echo echo -eu x=1 awk then
+	2>/dev/null sed 'quoted text'
+	| then 2>/dev/null test cd local $(pwd) cd 2>/dev/null /usr/bin
+		cd done && | | ${HOME} "$@" "$@" "$1"
+		/usr/bin x=1 then readonly --verbose
+	/usr/bin export | test test sed && "$1" sed local cd local sed 2>/dev/null
+then /usr/bin echo printf 'quoted text' -eu "$1" printf local
+export | awk "$@" 2>/dev/null $(pwd)
+		2>/dev/null 'quoted text' sed --verbose printf | ${HOME} then then
+	2>/dev/null cd printf echo test echo "$@" awk echo $(pwd) 'quoted text'
+		'quoted text' --verbose 2>/dev/null 2>/dev/null | --verbose export | x=1
+		export test readonly echo echo x=1 cd && "$1"
+-eu "$1" "$@" --verbose done awk --verbose "$@" then --verbose --verbose
+	/usr/bin x=1 ${HOME} x=1 printf test test then sed
+printf awk then readonly -eu 2>/dev/null --verbose export sed
+2>/dev/null printf awk -eu readonly done | "$1" && cd ${HOME} done
+	$(pwd) $(pwd) ${HOME} done printf then --verbose 'quoted text'
+"$@" printf "$1" local readonly sed awk --verbose
+	test && /usr/bin echo echo 'quoted text' ${HOME}
+"$@" echo awk "$@" readonly |
+	export $(pwd) export 'quoted text' /usr/bin "$1" $(pwd) --verbose
+test echo cd -eu 2>/dev/null $(pwd) printf printf ${HOME}
+	&& 'quoted text' done "$@" 'quoted text' /usr/bin grep "$1" export
+		test printf ${HOME} -eu -eu awk done 'quoted text' /usr/bin done "$@" 2>/dev/null
+	export test -eu 'quoted text'
+		test $(pwd) 'quoted text' echo local $(pwd) -eu -eu 2>/dev/null printf
+		grep export done | "$1" sed ${HOME} && -eu export "$1" "$1" "$@" awk "$@"
+printf sed -eu cd x=1 -eu grep $(pwd) $(pwd)
+		2>/dev/null $(pwd) printf 2>/dev/null awk -eu 'quoted text' then awk
+	'quoted text' then x=1 then "$@" | printf
+	x=1 --verbose test "$@"
+'quoted text' awk "$@"
+2>/dev/null | sed sed 'quoted text' echo 'quoted text' "$1" /usr/bin
+"$1" ${HOME} sed cd && -eu "$1" | /usr/bin grep -eu local then $(pwd)
+	sed readonly sed 'quoted text' printf readonly done "$@" then
+	echo local "$@" $(pwd) local | ${HOME} echo
+		| grep /usr/bin export
+	awk export 'quoted text' grep local local done x=1 ${HOME}
+	'quoted text' local sed /usr/bin grep "$@"
+test $(pwd) grep then readonly export done then
+		"$@" printf /usr/bin $(pwd) 'quoted text' "$1" export 'quoted text'
+	test local ${HOME} && readonly && done "$1" | ${HOME} readonly done
+	then done /usr/bin "$@" echo && $(pwd) echo export
+	&& cd /usr/bin x=1 done "$1" cd awk | | "$@" export
+	awk export printf 2>/dev/null --verbose && 2>/dev/null then ${HOME} readonly
+grep printf local "$1" -eu echo grep
+$(pwd) ${HOME} printf local ${HOME}
+		'quoted text' && echo | printf
+	readonly echo local -eu /usr/bin -eu $(pwd) printf
+	$(pwd) printf ${HOME} export sed grep "$1" "$@" awk 'quoted text' -eu
+export printf sed --verbose
+		echo "$@" /usr/bin readonly printf "$@" $(pwd) "$1" 'quoted text'
+	&& printf ${HOME} 2>/dev/null "$1" done cd $(pwd) "$1" x=1 awk cd
+		/usr/bin | awk $(pwd) && /usr/bin grep $(pwd) done
+printf echo printf awk test | ${HOME}
+"$1" --verbose cd $(pwd) readonly $(pwd) then -eu echo x=1 cd 'quoted text'
+	'quoted text' ${HOME} 'quoted text' --verbose 2>/dev/null
+	printf && grep echo 'quoted text' 2>/dev/null --verbose printf && && sed export
+	x=1 && readonly local done "$1" "$1" "$1" $(pwd) x=1 2>/dev/null -eu export &&
+		local export --verbose 2>/dev/null awk 2>/dev/null "$1" -eu grep ${HOME} local
+		sed awk done "$1" test local done echo 'quoted text' cd "$@" /usr/bin
+then && awk "$@" "$@" grep 'quoted text' cd cd "$1" readonly awk "$1"
+		/usr/bin /usr/bin sed export export awk done printf && "$1" printf -eu echo
+		sed -eu /usr/bin 2>/dev/null 'quoted text'
+	$(pwd) -eu then done 2>/dev/null sed && 'quoted text' done then && sed && grep
+	&& /usr/bin sed awk awk echo ${HOME} x=1 x=1 grep printf |
+		2>/dev/null x=1 --verbose "$1" done
+	2>/dev/null test "$1" /usr/bin && "$1" local /usr/bin 2>/dev/null
+		test $(pwd) $(pwd) && export cd --verbose "$@" $(pwd) local && /usr/bin
+printf /usr/bin | sed | "$@" --verbose
+"$@" done export "$1" -eu test "$1" test
+	"$1" test /usr/bin -eu /usr/bin /usr/bin
+		done then -eu printf -eu --verbose x=1 done then
+grep | grep 2>/dev/null ${HOME} printf && then
+/usr/bin && && grep export export 'quoted text' 'quoted text'
+	then 2>/dev/null $(pwd) 'quoted text' readonly local
+		readonly ${HOME} ${HOME} | export
+	/usr/bin | 'quoted text' /usr/bin then 'quoted text' /usr/bin && export
+	sed test -eu awk printf "$@" x=1 local -eu ${HOME} ${HOME} 'quoted text'
+		test local "$@" "$1" "$1" /usr/bin echo --verbose
+	| 2>/dev/null --verbose sed 2>/dev/null
+	"$@" export then | --verbose cd grep export grep readonly
+$(pwd) 'quoted text' "$@" --verbose ${HOME} $(pwd)
+${HOME} local awk x=1 done
+	readonly test "$@" grep x=1 export echo ${HOME} then 'quoted text'
+	done awk "$@" sed /usr/bin --verbose local -eu readonly local awk local
+		printf $(pwd) "$@" printf --verbose done $(pwd) local --verbose
+2>/dev/null export /usr/bin grep "$1" "$1" -eu then "$1" "$@" 2>/dev/null awk
+		then readonly | 2>/dev/null && echo printf | echo && awk echo -eu 'quoted text'
+		readonly 'quoted text' x=1 echo "$1" done export "$1" "$@" /usr/bin cd /usr/bin
+	awk "$1" /usr/bin cd x=1 cd test awk grep
+	"$@" done "$1" $(pwd) then && ${HOME}
+		done then local ${HOME} && "$1" -eu && $(pwd)
+cd done printf x=1 | local export
+test done "$@" grep printf sed test
+		-eu sed x=1 $(pwd) printf
+-eu local x=1 readonly local done echo "$@" awk grep sed readonly
+	--verbose local awk -eu grep cd cd
+		test x=1 --verbose x=1 'quoted text' x=1 --verbose test
+	done sed -eu 'quoted text' done 'quoted text' | echo
+		sed 'quoted text' export grep "$@" "$1" $(pwd) awk printf
+echo grep sed ${HOME} "$1" x=1 --verbose --verbose grep printf local 'quoted text'
+	'quoted text' printf $(pwd) then done "$@" done readonly grep then export
+	"$@" x=1 done "$1" awk then local ${HOME}
+		-eu readonly && $(pwd) $(pwd) test "$@" sed 2>/dev/null 'quoted text'
+		"$1" grep readonly x=1 then -eu 'quoted text'
+	test echo x=1 -eu sed awk awk local test
+	grep then ${HOME} echo test export printf printf
+&& "$@" -eu "$1" sed && sed /usr/bin test sed
+	/usr/bin 'quoted text' awk ${HOME} 'quoted text' local
+	printf export "$1" ${HOME}
+| && 'quoted text' /usr/bin export export "$@"
+&& grep -eu grep cd /usr/bin readonly 2>/dev/null export export "$1" readonly
+		readonly $(pwd) x=1 awk grep -eu "$@" test local printf printf
+		cd cd -eu --verbose done --verbose readonly 'quoted text'
+		$(pwd) echo --verbose && "$@"
+		grep --verbose $(pwd) x=1
+	readonly grep readonly test --verbose readonly cd $(pwd)
+/usr/bin | "$@" echo cd then && ${HOME} $(pwd)
+		2>/dev/null grep --verbose export local -eu sed awk /usr/bin test 'quoted text'
+	'quoted text' test sed echo printf awk | test cd readonly readonly
+		cd export 2>/dev/null | readonly sed --verbose
+	-eu readonly 2>/dev/null done $(pwd) echo test 'quoted text'
+| echo test "$@" cd 2>/dev/null -eu
+sed awk grep printf -eu --verbose echo 'quoted text' cd
+		printf printf $(pwd) ${HOME} 2>/dev/null 2>/dev/null
+"$1" done "$@" echo "$1" x=1 2>/dev/null 2>/dev/null printf sed
+'quoted text' "$1" export printf awk grep x=1 /usr/bin
+		export && x=1 ${HOME} 'quoted text'
+		x=1 "$@" then printf then cd grep printf grep
+		echo "$@" sed | 2>/dev/null $(pwd) grep done $(pwd)
+&& "$1" 2>/dev/null "$1" "$1" /usr/bin printf grep sed printf
+	"$@" awk awk export /usr/bin
+x=1 grep sed export export /usr/bin echo "$@" 'quoted text' $(pwd) &&
+| -eu printf x=1 local && then local local -eu echo "$1" "$1" && printf "$@"
+	2>/dev/null done x=1 -eu --verbose $(pwd)
+	local awk awk test --verbose then then "$1" local | -eu awk awk
+grep /usr/bin 2>/dev/null ${HOME}
+printf grep "$@" cd -eu local $(pwd)
+-eu ${HOME} $(pwd) 'quoted text' ${HOME} then && | ${HOME} readonly
+	grep grep printf cd grep awk test "$1" "$1" cd readonly
+		"$@" sed grep --verbose
+	local x=1 local export grep $(pwd)
+	| "$@" then | ${HOME} sed printf printf then then sed
+		echo /usr/bin sed export -eu "$1" -eu readonly cd | cd "$@"
+	echo -eu export && cd x=1
+		test --verbose -eu | printf done && /usr/bin
+		-eu done local test 'quoted text'
+	local 'quoted text' | echo $(pwd) | 'quoted text'
+	then 'quoted text' printf "$@" /usr/bin
+	awk && printf printf sed && x=1 'quoted text' "$@" "$1" 2>/dev/null printf
+		'quoted text' test /usr/bin readonly -eu "$@" && 'quoted text'
+	done 'quoted text' $(pwd)
+		${HOME} 2>/dev/null -eu done /usr/bin echo $(pwd) && "$1" sed cd export
+$(pwd) grep | test local export && awk &&
+	"$1" test sed cd awk then x=1 "$@" printf awk 2>/dev/null
+echo -eu local | done test 2>/dev/null $(pwd) sed --verbose
+		echo echo test -eu then done 2>/dev/null printf test cd | printf && awk "$1" "$@"
+	done echo local test cd ${HOME} 'quoted text'
+		"$1" ${HOME} | readonly | done awk "$@"
+	"$@" 'quoted text' /usr/bin
+		x=1 test sed "$@" echo 'quoted text' test "$@"
+local "$1" sed /usr/bin --verbose | "$@" /usr/bin "$@"
+done readonly -eu readonly awk
+test done awk echo /usr/bin
+	'quoted text' /usr/bin printf x=1 done x=1 echo printf
+		awk cd test "$1" ${HOME} readonly grep awk | awk local
+	/usr/bin "$@" awk $(pwd) done local then
+'quoted text' local test sed ${HOME} --verbose awk --verbose
+-eu export "$1" sed done $(pwd) cd -eu -eu export --verbose "$@"
+	/usr/bin --verbose && 'quoted text' echo --verbose grep
+		readonly ${HOME} /usr/bin done cd done test done readonly
+	"$1" -eu | printf 2>/dev/null ${HOME} | test x=1 sed local "$1"
+awk readonly --verbose done sed
+		then local test readonly "$@" echo export x=1 test -eu x=1
+		readonly "$@" ${HOME} test cd "$@" echo readonly awk ${HOME} --verbose sed
+		sed cd -eu -eu readonly readonly 'quoted text' x=1 /usr/bin then && grep then
+		then "$@" test | then --verbose printf cd printf printf
+		'quoted text' /usr/bin 2>/dev/null 2>/dev/null x=1 then x=1 'quoted text'
+cd $(pwd) done done awk 2>/dev/null
+	done ${HOME} grep done && cd local echo "$1"
+"$@" && done -eu done $(pwd) printf
+"$@" readonly 2>/dev/null --verbose
+"$1" echo readonly awk cd ${HOME} grep --verbose local
+&& $(pwd) x=1 test /usr/bin
+"$@" x=1 cd | echo --verbose ${HOME} then
+--verbose -eu local -eu $(pwd) $(pwd) "$@" x=1 grep
+	readonly x=1 echo sed ${HOME} printf "$1" x=1 --verbose test
+x=1 then --verbose grep sed "$@"
+		2>/dev/null local grep 2>/dev/null local
+	"$1" echo x=1 2>/dev/null test -eu | --verbose ${HOME} /usr/bin
+grep printf ${HOME} --verbose
+${HOME} readonly --verbose export local test then "$1" export export
+		/usr/bin /usr/bin x=1 $(pwd) $(pwd) printf ${HOME} ${HOME} $(pwd) $(pwd)
+		| grep $(pwd) local done local x=1
+		-eu | "$@" "$@" 2>/dev/null grep && |
+		| 2>/dev/null /usr/bin sed x=1 'quoted text' export 2>/dev/null export
+		awk "$@" then ${HOME} sed cd cd cd awk local | | export readonly
+	| cd test && $(pwd) ${HOME}
+		${HOME} "$@" && then $(pwd) 'quoted text'
+	awk grep awk $(pwd) 2>/dev/null export cd 'quoted text'
+		readonly done done export /usr/bin x=1 grep /usr/bin
+		local x=1 2>/dev/null x=1 /usr/bin x=1 x=1 awk 'quoted text'
+"$1" done cd x=1 then --verbose printf ${HOME} $(pwd) sed 2>/dev/null
+	"$1" cd 2>/dev/null | ${HOME} awk export -eu | sed x=1 "$@" x=1 echo cd
+	local awk --verbose cd x=1 test local x=1 /usr/bin awk cd grep | $(pwd)
+		-eu /usr/bin -eu sed cd then ${HOME} awk "$1" "$1" printf "$@"
+then /usr/bin 'quoted text' export grep "$1" &&
+	test local cd $(pwd) 'quoted text' cd test grep /usr/bin awk
+		cd readonly --verbose x=1 export test
+--verbose awk 2>/dev/null cd export "$1" echo cd awk cd /usr/bin ${HOME} done grep
+		'quoted text' local --verbose && grep readonly then
+		awk "$@" echo -eu cd sed printf ${HOME}
+export then readonly --verbose grep
+	echo echo "$1" "$@" done "$1" -eu 'quoted text'
+	"$@" grep readonly local readonly cd export /usr/bin done
+| 'quoted text' -eu --verbose
+local && "$1" | 'quoted text' cd readonly x=1 "$@" /usr/bin printf
+printf $(pwd) awk -eu export ${HOME}
+export echo done printf test grep "$1" &&
+	&& export printf && 2>/dev/null ${HOME} | local $(pwd) grep awk export
+		x=1 sed readonly x=1 && x=1 awk $(pwd) x=1 local --verbose ${HOME} awk
+	2>/dev/null "$@" | && "$@" then cd && --verbose sed -eu echo && -eu
+	cd done grep $(pwd) && 'quoted text' export echo
+	"$1" grep --verbose /usr/bin sed /usr/bin $(pwd) "$1" sed | sed local
+		then sed $(pwd) export then
+		local printf --verbose export local local /usr/bin -eu 2>/dev/null && test test
+	awk export x=1 x=1 "$@" /usr/bin 2>/dev/null /usr/bin readonly
+		grep 2>/dev/null --verbose sed test local
+readonly echo 2>/dev/null $(pwd)
+awk ${HOME} readonly && export cd -eu done local "$@" x=1 $(pwd) done
+/usr/bin "$@" echo test ${HOME} "$1" $(pwd) -eu 2>/dev/null
+sed "$@" $(pwd) export |
+		done ${HOME} local -eu test done then
+		local x=1 test "$@" $(pwd) "$1" test test grep | echo test then grep sed &&
+	printf "$1" echo local && sed
+	local awk cd x=1 grep 2>/dev/null x=1 ${HOME} then $(pwd) x=1
+		'quoted text' | 2>/dev/null $(pwd) local cd awk printf
+		&& awk readonly | "$@" /usr/bin
+"$@" echo ${HOME} then test -eu awk echo readonly -eu 2>/dev/null echo
+printf export sed "$1" then grep x=1 readonly && cd x=1 printf --verbose
+		${HOME} 'quoted text' local done test
+		| 2>/dev/null | && sed "$1" printf "$1" x=1
+	local then then grep grep 'quoted text' x=1
+		$(pwd) 2>/dev/null then $(pwd) echo sed echo $(pwd) -eu printf
+	export readonly grep $(pwd) printf then sed ${HOME} then
+		export && $(pwd) printf done
+		/usr/bin ${HOME} && -eu 2>/dev/null
+		| awk cd $(pwd) readonly
+		"$1" -eu $(pwd) sed -eu done 2>/dev/null 'quoted text'
+		cd ${HOME} 'quoted text'
+	echo x=1 'quoted text' | sed echo local /usr/bin local
+	-eu | ${HOME} echo && then "$1"
+local local test awk "$@" --verbose --verbose $(pwd)
+		printf && x=1 sed awk -eu ${HOME} 2>/dev/null
+		"$@" grep 'quoted text'
+| && x=1 'quoted text' $(pwd) echo then /usr/bin
+'quoted text' then /usr/bin 2>/dev/null cd && done awk then
+		readonly cd local 'quoted text' grep awk | sed readonly && then
+	cd awk -eu $(pwd) | cd ${HOME} cd awk printf sed test && printf
+		2>/dev/null && "$@" test awk done $(pwd) then readonly
+		-eu test cd sed done cd x=1 2>/dev/null grep awk cd $(pwd)
+	readonly export done 2>/dev/null $(pwd) awk x=1 -eu done "$@"
+printf /usr/bin sed 'quoted text' local test echo export "$1" echo
+export sed echo | x=1 ${HOME} 'quoted text' "$1" /usr/bin && sed "$1" "$1" local
+	x=1 /usr/bin grep local sed 'quoted text' local grep 2>/dev/null /usr/bin --verbose
+	$(pwd) ${HOME} grep printf x=1 grep
+		x=1 /usr/bin 2>/dev/null sed export
+x=1 -eu -eu /usr/bin export /usr/bin ${HOME} x=1 2>/dev/null x=1 --verbose "$@"
+		x=1 sed echo printf /usr/bin printf "$@" ${HOME} "$1" "$1" export
+	&& cd "$1" | sed sed test | /usr/bin 2>/dev/null export
+-eu echo && /usr/bin /usr/bin
+		| /usr/bin --verbose x=1 sed 'quoted text' 2>/dev/null local $(pwd) /usr/bin
+		${HOME} | | done 'quoted text' then echo 'quoted text' --verbose
+	"$@" test 'quoted text' 'quoted text'
+	x=1 local 'quoted text' readonly local 'quoted text' | ${HOME}
+	"$1" x=1 test 'quoted text'
+echo then "$1" ${HOME} && then
+	grep 'quoted text' export x=1 readonly 'quoted text'
+	export printf | x=1 printf then && sed && | 2>/dev/null export
+		export --verbose cd sed cd test $(pwd) $(pwd) sed /usr/bin && | test x=1 test
+		export 2>/dev/null "$1" local && "$@" $(pwd) test printf done
+		"$1" test local then readonly awk test printf | $(pwd)
+'quoted text' -eu --verbose $(pwd) 2>/dev/null $(pwd) -eu $(pwd)
+	"$@" echo sed done x=1 grep grep printf "$1" cd sed done /usr/bin then
+		grep | -eu printf done done "$@" local grep readonly done export then
+-eu "$@" done "$1" /usr/bin ${HOME} &&
+		export "$@" printf then test | then test
+		readonly export cd cd
+	"$@" | 2>/dev/null x=1 sed done "$@" export "$@" readonly local local
+'quoted text' export 2>/dev/null grep /usr/bin -eu awk printf /usr/bin "$@" test
+	-eu cd then test /usr/bin "$1" $(pwd) ${HOME} | /usr/bin ${HOME}
+	test then "$@" /usr/bin done local --verbose test 2>/dev/null
+		&& x=1 $(pwd) local local && x=1 printf $(pwd) printf
+	${HOME} export 'quoted text' cd local ${HOME}
+"$@" $(pwd) cd --verbose && && readonly -eu && cd 2>/dev/null /usr/bin "$@"
+x=1 echo readonly export 2>/dev/null 2>/dev/null --verbose
+		then test then export | sed done echo
+		cd /usr/bin "$1" -eu cd grep test printf /usr/bin
+then --verbose export
+		readonly $(pwd) readonly --verbose && done then
+	--verbose /usr/bin ${HOME} cd -eu $(pwd) 2>/dev/null awk 'quoted text'
+		$(pwd) printf readonly 'quoted text' "$@" sed local && x=1 x=1 cd then then
+	test sed -eu 2>/dev/null /usr/bin
+	grep grep test ${HOME} done export done 2>/dev/null done 'quoted text'
+		grep -eu then then grep | sed --verbose
+		${HOME} awk export readonly
+	awk 'quoted text' --verbose -eu done 'quoted text'
+		2>/dev/null grep -eu local local && export
+then printf "$1" 2>/dev/null ${HOME} cd | x=1 "$1" then cd "$1" "$1" ${HOME} $(pwd)
+		/usr/bin | local /usr/bin readonly
+	-eu /usr/bin 'quoted text' export "$@" readonly x=1 ${HOME} | done
+	local /usr/bin 'quoted text'
+	sed ${HOME} test | -eu 'quoted text' x=1 then
+		export local export -eu done && grep --verbose local /usr/bin export 2>/dev/null
+	&& echo /usr/bin cd then grep /usr/bin 'quoted text' test test readonly
+cd -eu sed test grep done | local --verbose | ${HOME}
+	readonly awk then test $(pwd) 'quoted text'
+		sed -eu echo x=1 printf && && && $(pwd)
+	/usr/bin printf sed x=1 x=1 x=1
+	x=1 --verbose $(pwd) 2>/dev/null
+		sed /usr/bin then x=1 --verbose export 'quoted text' $(pwd) export
+	"$1" then | && sed export readonly 2>/dev/null
+readonly echo printf /usr/bin | "$@" readonly
+	then grep x=1 --verbose --verbose export ${HOME} test
+	printf -eu cd $(pwd) | x=1 export 'quoted text' $(pwd) sed echo -eu export
+		'quoted text' "$@" ${HOME} export --verbose x=1
+		echo 'quoted text' printf local awk test
+		${HOME} /usr/bin sed echo done "$@" "$1" then "$@" local --verbose
+		local 'quoted text' "$@" sed 'quoted text' printf local && 'quoted text' echo grep
+		done 'quoted text' ${HOME} readonly sed export -eu -eu export
+	${HOME} /usr/bin local /usr/bin | /usr/bin "$@" | done
+	${HOME} sed "$1" test 'quoted text' x=1 echo local local export test
+		readonly echo readonly awk -eu grep local export --verbose
+cd x=1 local | && readonly ${HOME} echo 2>/dev/null export printf
+		'quoted text' local && grep echo | "$1" 'quoted text' x=1 -eu
+--verbose 'quoted text' /usr/bin
+echo "$1" then "$1" x=1 echo && echo x=1 $(pwd) local 2>/dev/null grep 'quoted text'
+x=1 cd local local "$1" 'quoted text' "$1" done 2>/dev/null done then sed "$@"
+&& 2>/dev/null 'quoted text'
+	awk echo local cd awk done ${HOME} grep
+		"$1" sed local 2>/dev/null | 2>/dev/null
+	done ${HOME} local local grep grep export
+cd export export | "$1" grep
+/usr/bin --verbose cd x=1 $(pwd) 'quoted text' sed grep done "$@" "$@"
+		sed awk sed sed x=1 ${HOME} echo 2>/dev/null
+local $(pwd) ${HOME} cd x=1 then ${HOME} x=1 local $(pwd) |
+awk sed test && "$1" 'quoted text' done local /usr/bin | /usr/bin awk grep then
+	echo echo --verbose /usr/bin
+	grep | && "$@" 'quoted text' 2>/dev/null
+		readonly /usr/bin local $(pwd) "$@" test "$1" "$1" 2>/dev/null
+test | $(pwd) grep 'quoted text' "$@" then sed cd
+cd then && then | $(pwd) $(pwd) test
+2>/dev/null done $(pwd) ${HOME}
+	local sed export 2>/dev/null grep "$@" 'quoted text' --verbose done grep
+		${HOME} test export readonly sed then awk "$@"
+	$(pwd) | && 'quoted text'
+		test --verbose "$@" sed -eu grep printf 'quoted text'
+		readonly $(pwd) cd echo then awk -eu printf export local 'quoted text'
+2>/dev/null "$@" && test | && cd $(pwd)
+"$@" awk test export sed $(pwd) readonly ${HOME} local "$1" readonly &&
+		test ${HOME} sed awk cd then $(pwd) readonly echo local grep printf then grep
+	done | ${HOME} cd | /usr/bin --verbose
+echo echo grep /usr/bin | sed ${HOME} x=1 $(pwd) -eu readonly export
+--verbose test cd ${HOME} grep awk | grep
+"$1" /usr/bin awk $(pwd) /usr/bin x=1 "$1" test ${HOME} cd "$@" grep
+	"$1" then ${HOME} done
+	cd /usr/bin ${HOME} 'quoted text' echo /usr/bin "$1"
+	&& x=1 /usr/bin --verbose "$@" && printf then
+	&& echo | | sed echo /usr/bin x=1 readonly
+'quoted text' --verbose "$@" cd | && cd $(pwd) awk /usr/bin /usr/bin then
+	'quoted text' then readonly cd grep | sed $(pwd) -eu -eu 2>/dev/null
+echo "$1" $(pwd) 2>/dev/null "$@" local readonly
+	awk cd done ${HOME} && --verbose
+	${HOME} echo cd local then ${HOME}
+	$(pwd) ${HOME} "$@" 2>/dev/null
+done sed && "$1" | cd "$1" export awk --verbose
+--verbose 'quoted text' cd sed -eu printf cd 2>/dev/null -eu awk readonly
+cd /usr/bin "$1" test cd 'quoted text'
+	${HOME} --verbose && 'quoted text' local sed 2>/dev/null 2>/dev/null
+sed /usr/bin done done printf then readonly "$1" ${HOME} "$@" x=1 readonly &&
+	sed then done x=1 done echo "$1" && -eu x=1 /usr/bin --verbose sed --verbose
+		${HOME} 'quoted text' echo done readonly awk awk "$@" -eu ${HOME} done
+	export $(pwd) /usr/bin x=1 && then
+done /usr/bin test ${HOME} --verbose
+	echo x=1 awk $(pwd) -eu -eu ${HOME} $(pwd) grep | sed 'quoted text' test
+	/usr/bin local $(pwd) "$1" /usr/bin test ${HOME}
+$(pwd) readonly -eu local test sed -eu readonly
+local 'quoted text' --verbose
+	'quoted text' x=1 "$@" --verbose -eu local | 2>/dev/null grep then 2>/dev/null
+	test | test -eu 2>/dev/null x=1 x=1
+		'quoted text' && local test
+		awk -eu sed test 2>/dev/null echo printf
+	done cd ${HOME} $(pwd) echo
+	2>/dev/null sed sed test /usr/bin test /usr/bin export done "$1"
+cd test 2>/dev/null cd printf sed then -eu | $(pwd)
+${HOME} ${HOME} "$1" "$1"
+| && local --verbose $(pwd) printf
+2>/dev/null sed -eu --verbose -eu awk sed export export sed /usr/bin --verbose
+done printf echo x=1 grep && test awk then | x=1 echo readonly "$@" -eu cd
+		--verbose 'quoted text' -eu 'quoted text' "$@" && readonly
+		2>/dev/null $(pwd) done local -eu
+		test ${HOME} cd /usr/bin awk done && /usr/bin $(pwd) done | 2>/dev/null x=1
+	printf test --verbose x=1 ${HOME} && $(pwd) -eu awk printf
+		readonly printf $(pwd) cd then then "$1" done sed /usr/bin then 'quoted text'
+		$(pwd) readonly export "$1" export "$1" x=1
+	${HOME} "$1" /usr/bin "$@"
+sed x=1 local --verbose local 2>/dev/null $(pwd)
+		cd test echo $(pwd) -eu local cd done export -eu test &&
+	cd --verbose 'quoted text' && echo test
+test done && 'quoted text' printf | local
+grep done "$1" readonly echo export ${HOME}
+		done readonly 'quoted text' printf
+		awk 'quoted text' test awk $(pwd) ${HOME} 2>/dev/null done export done awk -eu
+	-eu x=1 'quoted text' export echo printf "$1" x=1 'quoted text' --verbose | echo
+	test echo echo 'quoted text' done echo "$@" sed readonly "$1"
+	"$1" export grep printf echo ${HOME}
+x=1 "$@" grep 2>/dev/null readonly 2>/dev/null 'quoted text' 2>/dev/null
+echo "$@" --verbose --verbose x=1 printf sed cd then
+grep cd then -eu -eu "$@" 2>/dev/null
+		awk cd cd x=1 printf $(pwd) readonly ${HOME} then readonly
+		2>/dev/null awk export 'quoted text' then grep test "$@" cd
+cd | ${HOME} "$1" export ${HOME} echo local "$1" grep printf 2>/dev/null
+	$(pwd) $(pwd) 'quoted text' sed
+	then x=1 local /usr/bin printf then then printf /usr/bin
+export cd cd cd awk grep $(pwd) /usr/bin test ${HOME} export
+	done printf --verbose awk "$@" readonly x=1 "$@"
+$(pwd) | done --verbose --verbose then x=1 "$1" sed ${HOME}
+then /usr/bin /usr/bin "$1" export 'quoted text' "$@" | 'quoted text'
+		readonly "$1" then 'quoted text' test sed x=1 readonly awk | x=1 &&
+	local readonly --verbose then | 2>/dev/null grep
+	export x=1 local 'quoted text' -eu -eu local
+		sed export echo 'quoted text'
+		-eu $(pwd) -eu ${HOME} $(pwd) export
+		then --verbose sed | 2>/dev/null
+echo x=1 echo 2>/dev/null
+export -eu sed done -eu cd export && 2>/dev/null
+done --verbose -eu ${HOME} | awk /usr/bin "$@" then
+	sed ${HOME} grep --verbose && echo then done readonly awk printf
+	done readonly 'quoted text' test /usr/bin ${HOME} grep readonly "$1" -eu then "$1"
+	x=1 done sed && readonly -eu x=1 readonly ${HOME} $(pwd) 'quoted text'
+--verbose && echo $(pwd) printf | printf 2>/dev/null --verbose printf 2>/dev/null
+grep $(pwd) cd 2>/dev/null 2>/dev/null
+		readonly 'quoted text' "$@" grep x=1 -eu --verbose sed test
+	done $(pwd) echo /usr/bin && --verbose printf awk sed 'quoted text' cd cd export
+	/usr/bin test "$1" &&
+| test "$1" x=1 "$@" local echo test echo test 2>/dev/null
+	grep /usr/bin -eu ${HOME} "$1" test ${HOME} export $(pwd) local --verbose
+		'quoted text' then sed
+echo 'quoted text' 'quoted text' "$@"
+		cd local echo $(pwd) "$@"
+	&& awk "$1" 2>/dev/null echo
+'quoted text' -eu | x=1 local printf | sed test printf then
+"$1" x=1 -eu test readonly readonly printf x=1 && echo ${HOME} -eu $(pwd)
+	/usr/bin 'quoted text' grep grep printf test
+	--verbose cd awk --verbose
+	done 'quoted text' 2>/dev/null "$1" 2>/dev/null cd x=1 done
+		2>/dev/null local sed
+		done $(pwd) "$@" awk ${HOME} && x=1 sed test printf readonly local
+	sed | --verbose "$@" grep local && done grep | printf | |
+then readonly local echo sed 2>/dev/null --verbose "$1" printf $(pwd) $(pwd)
+		$(pwd) echo awk | /usr/bin export ${HOME} awk sed
+		sed /usr/bin sed --verbose 2>/dev/null 'quoted text' echo "$@" done
+x=1 && grep ${HOME} echo && then ${HOME} local
+		&& printf readonly printf awk sed -eu cd then /usr/bin
+| test local 2>/dev/null local done echo ${HOME}
+test x=1 export "$1" $(pwd) x=1 sed cd "$@" /usr/bin "$1" --verbose readonly
+	grep "$1" printf readonly && echo | awk sed 2>/dev/null
+		"$1" awk readonly done local ${HOME} grep then readonly 'quoted text'
+		sed 'quoted text' $(pwd) --verbose
+		awk "$1" --verbose sed local /usr/bin cd local
+		$(pwd) "$1" done 2>/dev/null 2>/dev/null
+	$(pwd) x=1 sed $(pwd) then -eu x=1 ${HOME} "$1"
+2>/dev/null "$@" | -eu -eu grep
+		cd 2>/dev/null echo echo grep | printf test | /usr/bin cd
+		"$@" -eu ${HOME} readonly awk grep
+	awk printf then then $(pwd) local "$@" cd sed awk $(pwd) echo printf
+		awk 'quoted text' sed /usr/bin export | ${HOME}
+		awk 'quoted text' sed && readonly ${HOME} then printf then
+awk "$@" readonly grep awk "$@" -eu | | then --verbose $(pwd) /usr/bin done x=1
+		grep -eu grep 'quoted text' sed 2>/dev/null local printf done
+-eu "$1" awk done --verbose awk
+sed && printf sed && 'quoted text' "$@" $(pwd) && "$1" $(pwd)
+	then readonly x=1 test
+sed /usr/bin $(pwd) export awk --verbose "$@" "$1" /usr/bin test echo readonly
+| $(pwd) && printf readonly $(pwd) && grep 'quoted text' && done awk done
+	local "$@" readonly readonly 'quoted text' 2>/dev/null
+		"$@" $(pwd) cd echo x=1 test -eu sed done local -eu echo ${HOME} printf printf
+		--verbose awk echo "$1" readonly x=1 then
+	test awk local /usr/bin /usr/bin
+		2>/dev/null /usr/bin local local
+| then x=1 done grep then export "$1"
+2>/dev/null echo echo
+2>/dev/null printf test 'quoted text' ${HOME} 'quoted text'
+	local 'quoted text' 'quoted text' done && cd /usr/bin 'quoted text' awk echo
+	&& $(pwd) && 'quoted text' cd then echo "$1" && $(pwd) --verbose
+test -eu $(pwd) done "$@" x=1 /usr/bin grep 'quoted text'
+| awk awk 2>/dev/null test 2>/dev/null
+done "$@" 2>/dev/null readonly grep 2>/dev/null -eu
+		"$1" "$@" && && "$@" awk then printf
+		-eu sed echo --verbose grep printf export echo "$1" export "$@"
+	2>/dev/null "$1" /usr/bin -eu | ${HOME} 'quoted text'
+2>/dev/null local readonly echo x=1 then
+	done /usr/bin done x=1 echo done 2>/dev/null 'quoted text' readonly done local
+		${HOME} printf "$1" test done done "$@" ${HOME} $(pwd) cd done sed "$1"
+"$@" 'quoted text' export 'quoted text'
+		awk 2>/dev/null export local $(pwd) && then printf printf
+	grep --verbose $(pwd) && x=1 'quoted text'
+		"$1" && $(pwd) local $(pwd) export x=1 done
+	--verbose export 2>/dev/null -eu echo "$1" sed $(pwd) "$1" --verbose -eu
+	local grep export $(pwd)
+		--verbose awk printf x=1 done test "$1" test
+		'quoted text' 'quoted text' && "$1" $(pwd) && --verbose readonly export
+	'quoted text' /usr/bin "$@" x=1 | --verbose readonly printf 'quoted text'
+	${HOME} done 'quoted text' local && echo readonly then 2>/dev/null
+export 2>/dev/null done grep "$@" | && local | test --verbose -eu && then
+		done x=1 && sed printf then sed $(pwd) echo 'quoted text'
+		| ${HOME} echo test grep export sed awk /usr/bin grep 2>/dev/null awk && | "$@"
+		echo sed export -eu "$@" local grep local
+done sed done awk 2>/dev/null printf ${HOME} then
+		${HOME} printf printf ${HOME} readonly 'quoted text' cd --verbose ${HOME} 'quoted text'
+		x=1 'quoted text' echo test ${HOME} then echo && grep readonly
+	awk grep test local awk then "$@" | done 'quoted text' cd done printf
+"$@" sed /usr/bin export done sed echo $(pwd) 2>/dev/null 'quoted text' awk
+grep | --verbose sed 'quoted text' 'quoted text'
+	cd grep ${HOME} x=1 2>/dev/null echo $(pwd) -eu $(pwd) local grep x=1 printf local
+		"$@" echo | -eu -eu /usr/bin local && test echo awk && 'quoted text'
+'quoted text' local && 2>/dev/null test grep x=1 | $(pwd)
+		--verbose x=1 test && readonly
+	&& $(pwd) | printf then echo "$1" "$1" | grep | 'quoted text' "$@" grep done
+	echo echo test printf done | ${HOME} "$1" ${HOME} 2>/dev/null "$1" $(pwd) grep
+--verbose x=1 export cd 2>/dev/null
+	export export test 2>/dev/null x=1 local "$@" --verbose /usr/bin cd echo echo
+"$@" printf test printf /usr/bin cd export
+		printf 'quoted text' export printf | && export sed /usr/bin ${HOME} "$@"
+	echo then 2>/dev/null done cd | | 2>/dev/null echo local
+		echo printf readonly /usr/bin echo -eu /usr/bin
+	printf awk --verbose /usr/bin done readonly sed x=1
+		test "$1" done | 'quoted text' -eu awk "$1" $(pwd) "$1" grep
+done x=1 x=1 -eu "$1" echo awk "$@" 'quoted text'
+done --verbose -eu && local
+		| readonly echo --verbose -eu grep x=1 cd x=1 "$1" export readonly
+		$(pwd) local --verbose awk then "$@" 2>/dev/null local 2>/dev/null $(pwd)
+	test $(pwd) | awk cd "$1" local "$1" 2>/dev/null "$1" grep local printf $(pwd)
+sed awk && /usr/bin echo done ${HOME}
+		awk 'quoted text' 2>/dev/null 2>/dev/null -eu done -eu echo 'quoted text'
+	-eu $(pwd) export x=1 $(pwd) 2>/dev/null grep ${HOME} done -eu | printf
+test done $(pwd) cd /usr/bin export && && readonly
+printf done && | echo local printf | ${HOME}
+	--verbose local --verbose done export "$@"
+2>/dev/null local echo /usr/bin
+test readonly -eu --verbose
+cd local "$@" grep -eu then x=1 cd "$@"
+	"$1" grep "$@" && $(pwd) cd then printf 'quoted text'
+"$1" "$@" ${HOME} 2>/dev/null -eu test readonly grep
+	printf echo grep cd $(pwd) "$@" | echo $(pwd) cd $(pwd) local
+		done then x=1 export test && "$1" then && grep 2>/dev/null echo then
+done local --verbose test done 2>/dev/null
+local $(pwd) 2>/dev/null
+		sed export readonly cd
+x=1 echo readonly && printf && 2>/dev/null x=1 local
+	cd then "$@" sed cd && readonly $(pwd)
+	x=1 local -eu done "$@" test test /usr/bin
+	x=1 | && "$@" | readonly local $(pwd) | | ${HOME}
+		echo test 2>/dev/null sed
+sed 'quoted text' test done x=1 | -eu -eu /usr/bin sed grep /usr/bin
+'quoted text' echo /usr/bin awk awk cd printf done
+		readonly cd -eu /usr/bin awk test test grep "$1" then done test printf ${HOME}
+		--verbose x=1 sed -eu $(pwd) grep done awk export
+		local "$@" && "$@" test awk readonly "$1" "$@" local 'quoted text'
+	x=1 | | ${HOME} --verbose echo
+	readonly cd $(pwd) | echo sed cd && /usr/bin -eu
+	2>/dev/null /usr/bin readonly
+cd awk sed 'quoted text' printf echo ${HOME} && cd test local 'quoted text'
+	'quoted text' then grep | readonly sed grep printf /usr/bin "$1" $(pwd)
+	2>/dev/null cd export $(pwd) test /usr/bin "$1"
+	grep && local echo "$1" -eu x=1 "$@" export then 2>/dev/null sed
+		printf "$1" | sed sed printf && echo && test cd awk "$1"
+		/usr/bin sed test --verbose "$@" printf 'quoted text' -eu $(pwd) done printf
+	--verbose cd ${HOME} 2>/dev/null -eu "$1" printf done -eu printf -eu 'quoted text'
+	done x=1 "$@" readonly then /usr/bin done
+	&& then readonly test awk | /usr/bin printf test && --verbose grep
+-eu "$@" ${HOME} | export then /usr/bin ${HOME} grep
+		'quoted text' echo $(pwd) 'quoted text' echo $(pwd) sed
+x=1 x=1 ${HOME} "$@" "$1" test && && --verbose local
+		'quoted text' && done ${HOME} 'quoted text' 'quoted text' sed 2>/dev/null
+		echo --verbose sed sed readonly cd done awk $(pwd)
+'quoted text' echo "$1" readonly then $(pwd) 'quoted text'
+		"$@" sed "$1" x=1 grep x=1 done readonly &&
+		cd | "$@" -eu then | --verbose
+		$(pwd) && && sed printf --verbose test awk $(pwd)
+"$1" sed export export --verbose /usr/bin 'quoted text' ${HOME} |
+	echo "$1" cd /usr/bin done awk export local ${HOME}
+done local -eu 2>/dev/null
+"$@" then awk "$@" | awk -eu x=1 -eu test local && x=1 printf $(pwd) sed local done
+	x=1 $(pwd) sed $(pwd) awk $(pwd) 2>/dev/null --verbose /usr/bin /usr/bin done
+		'quoted text' x=1 ${HOME} 'quoted text' --verbose 2>/dev/null done sed 'quoted text'
+| cd "$@" "$@" grep test $(pwd)
+	'quoted text' -eu "$@" grep printf then grep $(pwd)
+$(pwd) printf /usr/bin readonly 2>/dev/null /usr/bin
+	"$1" done test && /usr/bin local done readonly && grep "$@" sed sed "$@" cd |
+		"$1" -eu grep x=1 'quoted text' 2>/dev/null $(pwd)
+"$@" --verbose then sed
+	2>/dev/null echo "$@" done then sed /usr/bin grep | export awk cd readonly
+		grep 'quoted text' local $(pwd) | 2>/dev/null printf awk grep then done echo
+		x=1 x=1 ${HOME} cd "$1" 'quoted text' then local export
+	done sed sed $(pwd) sed "$1" 'quoted text' 'quoted text' grep $(pwd)
+	readonly ${HOME} echo grep 2>/dev/null awk /usr/bin
+		readonly --verbose | echo printf /usr/bin done && /usr/bin
+then "$1" done grep readonly readonly x=1 cd echo /usr/bin echo done
+/usr/bin done "$@" grep ${HOME} sed
+'quoted text' | awk | 'quoted text' -eu test then "$@" 'quoted text' $(pwd)
+	then echo x=1 "$1" readonly "$@" x=1
+		sed export readonly cd export &&
+test -eu grep ${HOME} done x=1 grep printf "$@" grep
+	| 'quoted text' cd printf printf
+	export grep ${HOME} --verbose awk | export "$1" ${HOME} grep -eu printf --verbose
+	&& export local /usr/bin 2>/dev/null then echo 2>/dev/null readonly && export 2>/dev/null
+	--verbose sed --verbose echo grep && test cd local 'quoted text' 'quoted text'
+	sed export "$1" 2>/dev/null test &&
+	cd && printf cd printf x=1 sed awk ${HOME} then $(pwd)
+awk 2>/dev/null 2>/dev/null done done awk then /usr/bin && && --verbose awk
+	printf sed sed -eu sed ${HOME} awk sed "$@" done 'quoted text' 'quoted text'
+		echo awk local 2>/dev/null grep printf local x=1 awk local $(pwd) sed done
+cd && --verbose && ${HOME} $(pwd) test done then grep awk "$@" | echo ${HOME}
+2>/dev/null cd 'quoted text'
+		done "$1" $(pwd) cd --verbose | "$@" export sed then then -eu test export
+	export grep x=1 then then echo
+	x=1 && printf 2>/dev/null && readonly
+cd grep export done -eu "$1" cd
+printf cd echo $(pwd)
+		echo | test readonly "$1"
+	echo test "$1" 2>/dev/null echo printf then $(pwd) && ${HOME} export printf
+	&& -eu printf then printf x=1 | test local
+	--verbose $(pwd) ${HOME} export awk 2>/dev/null 2>/dev/null
+		'quoted text' cd then local
+		printf 'quoted text' /usr/bin test $(pwd) grep ${HOME} x=1 "$@" && awk
+	/usr/bin && -eu grep ${HOME} /usr/bin
+		2>/dev/null ${HOME} sed ${HOME}
+		export echo | export then -eu
+echo ${HOME} done 'quoted text' local then cd grep readonly --verbose
+"$@" --verbose sed "$@" -eu $(pwd) 'quoted text' then
+		echo $(pwd) export | -eu "$1" "$1" test --verbose && test
+		export local local done /usr/bin printf printf "$@" then
+readonly && export 'quoted text' /usr/bin then | grep x=1 cd x=1 done
+		awk "$@" 2>/dev/null grep awk grep export
+	readonly cd /usr/bin test 2>/dev/null grep ${HOME} sed readonly ${HOME}
+printf local export then 2>/dev/null
+-eu -eu readonly echo grep sed
+echo --verbose "$@" local awk 'quoted text' "$1" ${HOME} "$1" awk sed ${HOME}
+	--verbose x=1 readonly readonly grep cd awk awk echo
+	/usr/bin | /usr/bin --verbose
+x=1 readonly | echo then "$1" 2>/dev/null then printf printf
+	"$@" grep "$@" ${HOME} 2>/dev/null && then export $(pwd) x=1 ${HOME}
+	export export -eu awk | echo local printf echo local echo x=1 --verbose readonly
+		grep then /usr/bin awk sed 'quoted text' $(pwd) | echo | "$@"
+then local export && local $(pwd) then 'quoted text' 2>/dev/null ${HOME} export
+	/usr/bin 'quoted text' sed "$1" "$@" x=1 echo test readonly export && echo
+	&& local printf cd 'quoted text' test 'quoted text' test x=1
+		done test readonly sed then "$1" printf -eu test done printf x=1
+		echo "$1" export 'quoted text'
+--verbose grep && export then test | done cd && --verbose
+		then readonly 2>/dev/null test then awk $(pwd) "$1" then export readonly
+	test test awk --verbose readonly cd then test $(pwd) /usr/bin x=1 readonly local
+		${HOME} grep export then done cd printf
+'quoted text' --verbose export /usr/bin sed /usr/bin readonly
+		test | readonly 2>/dev/null 'quoted text' ${HOME} export 'quoted text' && sed
+	"$@" awk "$@" $(pwd) then 2>/dev/null
+		grep "$@" sed 'quoted text' test 'quoted text'
+	/usr/bin 2>/dev/null ${HOME} done grep $(pwd) ${HOME} ${HOME} sed x=1 then echo
+"$1" ${HOME} --verbose echo grep /usr/bin local
+printf done export x=1 export
+echo --verbose "$@" cd "$1" readonly cd local |
+		then "$@" | 2>/dev/null grep cd local && awk local
+2>/dev/null 'quoted text'
+cd | test /usr/bin local --verbose && test && -eu x=1
+	readonly echo done then done cd grep /usr/bin
+then readonly $(pwd) "$@" done | then "$@" echo "$@" x=1 x=1 | readonly
+	local | /usr/bin cd && cd echo ${HOME}
+then grep cd $(pwd) $(pwd) 'quoted text' test done "$1" sed then export
+		/usr/bin local grep done local /usr/bin sed 2>/dev/null
+		awk $(pwd) -eu --verbose 2>/dev/null
+cd grep awk grep awk "$@" 'quoted text' local sed
+-eu grep grep done local x=1 cd --verbose sed grep "$1" then x=1 cd "$@" ${HOME}
+	${HOME} sed --verbose sed cd x=1 then then local /usr/bin readonly 2>/dev/null
+		--verbose "$1" sed --verbose export --verbose
+	$(pwd) test grep /usr/bin grep | test awk cd sed "$1" awk cd -eu
+		x=1 ${HOME} 'quoted text'
+awk "$@" /usr/bin "$1" /usr/bin grep then
+	"$1" /usr/bin sed awk export /usr/bin 2>/dev/null done readonly "$@" test grep
+	printf "$@" 2>/dev/null "$1" $(pwd) "$@" printf awk test local ${HOME}
+		readonly export readonly "$@" printf export sed 2>/dev/null
+local grep awk export /usr/bin grep
+then && "$1" local local 'quoted text' local | x=1 local ${HOME} -eu |
+done $(pwd) /usr/bin sed awk printf | grep awk 'quoted text'
+		x=1 ${HOME} 'quoted text' "$1" x=1 'quoted text'
+/usr/bin local /usr/bin sed -eu --verbose test export "$@" test cd
+	| x=1 sed 'quoted text'
+		"$@" local "$1" local
+	echo cd awk test -eu cd export
+		"$@" local printf readonly && x=1 done
+		readonly "$@" /usr/bin 'quoted text' sed done awk /usr/bin grep --verbose
+		printf /usr/bin then
+then 'quoted text' test sed
+${HOME} && "$@" cd sed 'quoted text'
+then then ${HOME} ${HOME}
+		$(pwd) 2>/dev/null export grep cd local grep printf readonly /usr/bin
+-eu 2>/dev/null export done x=1 --verbose 2>/dev/null $(pwd)
+		cd done cd grep test done -eu "$1" done
+		awk | && test echo export readonly ${HOME} "$@" echo /usr/bin done
+		/usr/bin awk 2>/dev/null readonly 'quoted text'
+		grep sed export readonly cd
+		local ${HOME} echo 'quoted text'
+		local awk echo 'quoted text' echo done && | $(pwd) grep && then export "$1"
+	"$1" readonly -eu done && && sed then echo then
+	-eu "$1" -eu --verbose 2>/dev/null x=1
+readonly -eu x=1 cd -eu local "$@" sed readonly done done && | | -eu /usr/bin echo
+test echo /usr/bin readonly local x=1 2>/dev/null && | -eu grep 'quoted text'
+2>/dev/null export | local printf printf printf awk x=1 test "$1" --verbose printf
+	/usr/bin export && --verbose readonly
+awk printf "$1" "$1" printf --verbose | done 'quoted text'
+	| ${HOME} readonly -eu printf x=1 $(pwd) done
+	x=1 2>/dev/null 2>/dev/null
+	grep -eu awk sed -eu "$@" sed
+		local | grep cd --verbose x=1
+"$1" echo x=1 awk local "$1" "$@" /usr/bin ${HOME} x=1 readonly
+local "$@" awk awk test sed local -eu -eu
+	printf grep --verbose "$@" -eu test grep then sed ${HOME} && | "$1" ${HOME} 2>/dev/null
+echo awk readonly awk "$@" test "$1" export cd printf -eu ${HOME} 'quoted text'
+local 2>/dev/null 'quoted text'
+| echo echo local done 'quoted text' "$1" $(pwd)
+x=1 "$1" "$@" && "$@" -eu then --verbose
+	export printf && grep grep
+		2>/dev/null test grep
+printf ${HOME} 2>/dev/null
+		sed && ${HOME} "$@" then test sed printf test
+	"$@" | echo $(pwd) "$@" awk ${HOME} -eu ${HOME}
+		sed ${HOME} ${HOME} done 2>/dev/null
+		${HOME} "$@" /usr/bin --verbose cd ${HOME}
+		grep ${HOME} printf readonly
+2>/dev/null | "$1" grep && echo readonly -eu sed readonly -eu cd grep
+	"$1" /usr/bin sed --verbose
+		export grep x=1 export test /usr/bin
+		$(pwd) sed "$@" | local local awk "$1" then | printf readonly
+x=1 -eu export -eu 'quoted text' "$@" x=1 echo ${HOME}
+$(pwd) --verbose --verbose then 'quoted text' test --verbose awk 2>/dev/null
+&& "$@" "$@" test ${HOME} done "$1"
+"$1" readonly x=1 'quoted text' "$1" /usr/bin sed sed 'quoted text'
+${HOME} local cd local awk 'quoted text' local
+	"$1" printf x=1 export -eu test /usr/bin echo grep ${HOME} local /usr/bin
+	then $(pwd) grep test local -eu -eu then 2>/dev/null test ${HOME} $(pwd) echo
+		then test 'quoted text' 'quoted text' 'quoted text' echo --verbose echo
+	&& "$1" --verbose 'quoted text' "$@" local readonly grep /usr/bin
+	x=1 --verbose "$@" 'quoted text' $(pwd) then $(pwd) sed
+"$@" 2>/dev/null -eu then --verbose
+	-eu 'quoted text' --verbose printf /usr/bin $(pwd) echo awk && grep awk
+printf cd $(pwd) -eu local sed
+cd cd "$@" cd -eu "$1" sed
+	2>/dev/null && 'quoted text' done x=1 ${HOME} export && export && local sed && sed
+	x=1 then done /usr/bin --verbose sed readonly /usr/bin
+$(pwd) echo /usr/bin test test && then -eu x=1
+&& ${HOME} sed readonly 'quoted text' "$1"
+		$(pwd) printf /usr/bin 2>/dev/null sed cd readonly 2>/dev/null
+&& $(pwd) readonly && | --verbose
+	echo grep sed && then "$1" | export "$@" grep
+	cd done $(pwd) && | ${HOME}
+		export $(pwd) echo export export awk printf 'quoted text'
+/usr/bin ${HOME} export export test awk export ${HOME} echo ${HOME} "$@" sed echo
+		x=1 && export /usr/bin awk sed | local grep test
+	'quoted text' echo "$@" done done -eu awk done "$1" /usr/bin done 'quoted text'
+		x=1 "$@" x=1 ${HOME} readonly then | cd -eu export "$@" | local && /usr/bin grep
+"$1" 'quoted text' echo
+	printf /usr/bin "$1" 'quoted text' && -eu done
+		export 2>/dev/null test grep grep $(pwd) export test /usr/bin test printf
+"$1" sed awk -eu test test x=1 -eu printf local 2>/dev/null test sed "$@" x=1 --verbose
+	then local grep local test "$@"
+		done "$@" awk cd 'quoted text' then grep cd export 2>/dev/null
+	'quoted text' grep then export echo
+		export -eu --verbose x=1 local printf local $(pwd) readonly
+		| "$@" export export grep grep readonly "$@" /usr/bin grep "$@"
+	sed printf export $(pwd) local echo readonly awk
+		${HOME} "$@" done export local 'quoted text' && "$1" export x=1 ${HOME} $(pwd)
+		sed "$@" "$1" printf local --verbose printf local readonly 2>/dev/null
+	readonly -eu | grep then local 'quoted text' test export echo 'quoted text'
+		"$1" && local /usr/bin -eu $(pwd) readonly
+then /usr/bin done /usr/bin local done --verbose export
+$(pwd) cd && -eu sed printf grep echo sed test &&
+	2>/dev/null then x=1 x=1 && x=1 done /usr/bin awk /usr/bin awk
+	/usr/bin 'quoted text' 2>/dev/null /usr/bin x=1 | 'quoted text'
+	cd /usr/bin -eu export cd 2>/dev/null $(pwd) local
+	${HOME} --verbose readonly printf printf done printf
+cd grep ${HOME} /usr/bin ${HOME} "$@" grep 2>/dev/null grep readonly
+	&& 'quoted text' cd grep "$1" test
+$(pwd) grep $(pwd) echo local --verbose $(pwd) ${HOME} x=1
+	"$1" test 'quoted text' -eu done x=1 then | printf ${HOME} "$1"
+then printf test $(pwd) printf
+		"$@" && $(pwd) "$@" echo $(pwd) 'quoted text'
+		readonly --verbose grep | export local 2>/dev/null test x=1 local
+		'quoted text' /usr/bin readonly
+	readonly && sed x=1 x=1 2>/dev/null cd $(pwd) echo --verbose "$@" && /usr/bin
+printf && done export echo grep && 2>/dev/null
+readonly 2>/dev/null "$1" --verbose | then sed "$1" printf /usr/bin
+		then done export | --verbose x=1 readonly readonly 'quoted text' grep | then
+		'quoted text' "$@" && cd x=1 /usr/bin test | -eu 2>/dev/null
+		x=1 export echo "$1" 'quoted text' test readonly /usr/bin export
+| ${HOME} then "$@" test done $(pwd) local ${HOME} then
+		grep /usr/bin --verbose
+		local x=1 | | | $(pwd) awk x=1 export printf test --verbose /usr/bin local | then
+		done grep awk --verbose cd -eu export printf sed | | grep done
+"$1" -eu grep readonly 2>/dev/null
+		readonly $(pwd) /usr/bin echo /usr/bin /usr/bin printf test -eu
+	echo readonly 'quoted text' | --verbose printf "$@" done /usr/bin grep | test
+		-eu readonly "$@" $(pwd) --verbose $(pwd) test local readonly sed
+	&& -eu then then --verbose 'quoted text' --verbose &&
+	'quoted text' printf 2>/dev/null export
+	| awk export && test 'quoted text'
+	done 2>/dev/null 2>/dev/null
+	readonly printf --verbose echo done
+	test ${HOME} done --verbose -eu "$@"
+$(pwd) local "$1" --verbose grep /usr/bin readonly cd && export
+	$(pwd) cd 2>/dev/null done --verbose ${HOME} sed | local sed && cd 'quoted text'
+		grep grep | grep export "$1"
+done -eu ${HOME} cd done -eu test awk "$@" $(pwd) sed printf readonly
+		-eu | x=1 then "$@" then export -eu readonly sed export sed echo
+2>/dev/null "$1" 2>/dev/null awk $(pwd) sed awk "$@" | export
+	then --verbose 'quoted text'
+		"$@" && 'quoted text' readonly 'quoted text' sed x=1 cd --verbose
+	/usr/bin "$1" then $(pwd)
+		&& printf printf done printf $(pwd) sed cd
+	local then /usr/bin $(pwd) $(pwd) printf | export 'quoted text' "$1" test "$@"
+	/usr/bin -eu 'quoted text' echo
+	&& $(pwd) --verbose printf /usr/bin --verbose sed grep grep awk echo done readonly
+cd | "$@" readonly 2>/dev/null /usr/bin printf ${HOME} 2>/dev/null
+	"$1" then echo test /usr/bin readonly printf 'quoted text'
+		--verbose echo export "$1" export 'quoted text'
+		$(pwd) local -eu $(pwd) sed && "$1" test done grep "$@" sed
+-eu -eu export grep /usr/bin export "$1" | ${HOME} 2>/dev/null export done readonly
+	/usr/bin printf awk 2>/dev/null readonly 'quoted text'
+		/usr/bin test && ${HOME} -eu
+| cd "$1" /usr/bin x=1 readonly grep x=1 $(pwd) /usr/bin readonly cd printf sed
+		sed echo --verbose x=1 x=1 readonly --verbose ${HOME}
+done x=1 printf --verbose test local "$@" printf awk 'quoted text' sed cd printf
+		cd readonly test done awk 2>/dev/null grep ${HOME} "$1"
+	x=1 $(pwd) then local "$@" $(pwd) done grep ${HOME}
+cd ${HOME} local readonly done $(pwd) echo printf -eu
+echo local cd "$1" local cd test -eu local readonly /usr/bin 2>/dev/null 'quoted text'
+	printf 'quoted text' /usr/bin grep cd
+		sed /usr/bin /usr/bin --verbose x=1 && 2>/dev/null
+		sed awk $(pwd) -eu cd test grep -eu echo sed grep awk && &&
+grep printf | echo local readonly ${HOME} ${HOME} grep grep cd "$1" --verbose
+cd 'quoted text' "$@" 2>/dev/null grep then
+		local awk 2>/dev/null grep
+	local -eu 'quoted text' local $(pwd) awk x=1 --verbose grep
+	export --verbose export done done readonly awk awk "$1"
+		printf && $(pwd) local | readonly --verbose
+	cd export test /usr/bin 'quoted text' printf echo test "$@" echo x=1
+		&& | awk ${HOME} /usr/bin
+		done | "$1" test grep readonly local --verbose ${HOME} done 2>/dev/null printf
+		"$1" x=1 done /usr/bin | && 2>/dev/null awk "$@" "$1"
+		cd awk local then sed grep sed local
+/usr/bin cd then -eu
+export --verbose test $(pwd) -eu && ${HOME}
+test sed -eu printf local
+--verbose awk "$@" /usr/bin -eu printf export
+		2>/dev/null export --verbose test -eu awk
+cd -eu sed test | /usr/bin
+export "$@" /usr/bin then $(pwd) grep "$1" ${HOME}
+	/usr/bin x=1 | awk export $(pwd) 2>/dev/null | $(pwd) --verbose
+	2>/dev/null then /usr/bin ${HOME} | awk 'quoted text' grep
+"$1" test done "$1" readonly then
+	export 2>/dev/null sed test awk x=1 awk -eu ${HOME} --verbose
+done x=1 readonly done done grep $(pwd) then && cd cd test x=1 "$@" readonly sed
+	/usr/bin cd "$1" 2>/dev/null ${HOME} && done then "$@" sed export /usr/bin
+		x=1 2>/dev/null printf readonly -eu echo
+'quoted text' 2>/dev/null done sed x=1
+	&& test readonly awk --verbose
+	awk awk grep cd -eu -eu && x=1 ${HOME} --verbose $(pwd)
+		"$@" cd x=1 $(pwd) $(pwd)
+		| ${HOME} awk /usr/bin
+		-eu | 2>/dev/null && 'quoted text' local then readonly 'quoted text'
+local /usr/bin /usr/bin 'quoted text' 'quoted text' --verbose printf
+export export printf printf readonly /usr/bin local export --verbose /usr/bin
+	--verbose readonly ${HOME} | sed --verbose cd --verbose --verbose sed local "$1"
+awk /usr/bin 2>/dev/null then echo && done -eu local grep cd
+-eu awk readonly 'quoted text' -eu grep done then cd grep /usr/bin done
+grep 2>/dev/null -eu local echo ${HOME} done
+then 2>/dev/null cd printf "$@" && done
+$(pwd) awk test local readonly done export
+	cd printf cd | export local -eu | --verbose ${HOME} readonly --verbose -eu
+echo sed printf export awk local 'quoted text' --verbose printf
+		awk export --verbose readonly readonly
+cd ${HOME} test test "$1" 'quoted text' done grep "$1" x=1 export
+grep grep readonly printf | then -eu x=1 "$@"
+/usr/bin printf --verbose awk "$1" "$1" awk --verbose awk printf
+sed local 'quoted text' grep local awk x=1 printf printf
+	"$1" echo sed test $(pwd) 2>/dev/null cd done then awk x=1 $(pwd) grep
+readonly printf export printf awk test x=1 printf /usr/bin -eu
+		local printf $(pwd) test
+-eu --verbose export /usr/bin grep "$@" $(pwd) --verbose export local $(pwd)
+	cd $(pwd) echo x=1 -eu cd ${HOME} then done /usr/bin test $(pwd) --verbose
+		--verbose readonly local "$@" done
+		sed -eu echo echo "$@" $(pwd)
+	$(pwd) -eu 2>/dev/null /usr/bin readonly | printf
+	echo cd awk | export local cd "$@" done awk
+		done | done x=1 done grep then $(pwd) done test cd 'quoted text'
+		"$@" test /usr/bin cd "$1" "$1" -eu /usr/bin
+"$@" /usr/bin --verbose | done
+		${HOME} then --verbose local grep "$@" --verbose
+		"$@" 'quoted text' then -eu readonly 'quoted text' /usr/bin
+		-eu test -eu ${HOME} echo
+'quoted text' export --verbose -eu -eu test ${HOME} | export test | -eu $(pwd) sed
+--verbose /usr/bin test echo --verbose echo
+		cd "$@" grep "$1" test /usr/bin readonly 2>/dev/null printf /usr/bin
+--verbose 2>/dev/null /usr/bin ${HOME} "$1" sed then 2>/dev/null awk ${HOME}
+	/usr/bin && | 2>/dev/null ${HOME} grep 2>/dev/null
+--verbose && awk -eu 'quoted text' cd printf /usr/bin $(pwd) "$@" readonly "$1"
+awk sed | cd && | grep x=1 ${HOME} then cd done grep "$1" then | then $(pwd)
+--verbose printf /usr/bin x=1 | x=1 /usr/bin | then local then
+		test 2>/dev/null 2>/dev/null x=1 2>/dev/null grep echo
+grep 'quoted text' "$@" sed "$1" cd x=1 ${HOME} /usr/bin ${HOME}
+		sed $(pwd) | --verbose echo export echo "$@" done "$@" "$1"
+		${HOME} -eu | local local grep
+		awk then awk export x=1 test cd x=1 local /usr/bin | sed cd
+		${HOME} then ${HOME} test done cd export grep "$1"
+		sed "$1" --verbose --verbose printf cd | $(pwd) && "$1" done
+	printf "$@" cd $(pwd) done grep /usr/bin done /usr/bin
+printf then -eu ${HOME} sed readonly -eu "$@" sed -eu done
+	--verbose test $(pwd) 2>/dev/null $(pwd) 2>/dev/null
+then printf x=1 && ${HOME} done grep printf $(pwd) done 'quoted text'
+export printf ${HOME} 2>/dev/null test ${HOME}
+		"$1" done grep "$@" awk 'quoted text'
+${HOME} then test export readonly ${HOME} "$@" --verbose then
+	$(pwd) ${HOME} $(pwd) --verbose echo /usr/bin grep | printf awk done
+	echo export printf sed test echo x=1 ${HOME} printf "$1" printf "$1" cd echo awk
+	awk 2>/dev/null x=1 "$1" x=1 awk test echo sed
+-eu sed "$1" echo && done cd done awk --verbose
+		--verbose local printf
+-eu "$@" done $(pwd) sed ${HOME} sed grep
+		/usr/bin --verbose then --verbose sed cd | x=1 ${HOME}
+	cd /usr/bin "$1" "$1" awk grep -eu cd 'quoted text' then --verbose
+"$1" then test "$1" cd local grep awk local /usr/bin "$1" sed cd printf
+echo --verbose readonly
+	readonly echo sed test printf
+	-eu && echo "$@" printf
+	--verbose $(pwd) "$@" "$1" grep readonly && awk 2>/dev/null x=1 test done
+	/usr/bin /usr/bin echo readonly grep ${HOME}
+readonly $(pwd) x=1 "$1" test | && cd /usr/bin printf
+"$@" sed && local -eu x=1 /usr/bin cd |
+local grep "$@" -eu && "$1" --verbose sed
+echo 2>/dev/null export then cd && readonly
+	$(pwd) done export $(pwd) then grep /usr/bin $(pwd)
+		cd ${HOME} sed readonly local ${HOME} test --verbose 2>/dev/null --verbose
+		$(pwd) test ${HOME} --verbose "$1" ${HOME} test test sed
+	awk 'quoted text' printf 2>/dev/null done --verbose readonly
+	| --verbose 2>/dev/null export /usr/bin
+		readonly | readonly echo export readonly x=1 then readonly 'quoted text' then awk
+	local local grep --verbose local -eu 2>/dev/null
+	readonly 'quoted text' && /usr/bin test local
+		--verbose --verbose 2>/dev/null ${HOME} echo --verbose "$1"
+		/usr/bin done "$@" -eu && printf "$@" 'quoted text' 2>/dev/null "$@" x=1 'quoted text'
+&& --verbose x=1 awk "$@" then
+		test readonly then then awk then x=1 then -eu | sed echo awk
+export "$@" /usr/bin ${HOME} test "$1" && cd && "$@" local ${HOME}
+	cd done done $(pwd) export ${HOME} 2>/dev/null cd echo test
+		"$@" readonly export then local grep
+	grep ${HOME} && && 2>/dev/null echo --verbose sed x=1 export
+-eu -eu ${HOME} -eu export readonly then grep readonly awk
+		then test "$1" readonly "$1" echo echo 2>/dev/null "$1" 2>/dev/null
+		printf cd 'quoted text' -eu "$@" test printf sed sed && | echo
+$(pwd) "$@" "$1" local export $(pwd) echo $(pwd) $(pwd) ${HOME} /usr/bin sed --verbose
+	export done then export
+	grep "$@" export 'quoted text' sed /usr/bin sed | awk 'quoted text'
+	echo test readonly -eu test then && echo x=1 sed test sed -eu echo local -eu
+	printf | cd grep && grep export test
+	"$@" /usr/bin $(pwd) 2>/dev/null | 2>/dev/null
+	local local x=1 /usr/bin sed awk awk printf done
+done && readonly && 'quoted text'
+	$(pwd) | /usr/bin awk $(pwd) printf --verbose
+		local awk && "$1" grep printf $(pwd) test echo awk awk then "$1"
+| then 'quoted text' cd test cd sed 'quoted text'
+cd "$1" cd 'quoted text' --verbose x=1 --verbose cd cd local echo 2>/dev/null
+done 'quoted text' "$1"
@@ -0,0 +1,2001 @@
+	sed "$@" | cd "$@" test /usr/bin --verbose test then readonly "$@" "$@" then
+echo echo then sed /usr/bin
+		done echo "$1" "$@" --verbose cd x=1 $(pwd) && 'quoted text'
+--verbose "$@" "$@" | done then --verbose
+cd test cd "$1" export x=1 | awk awk -eu cd
+	then done ${HOME} /usr/bin "$@"
+		--verbose "$1" export cd echo /usr/bin 2>/dev/null "$@" x=1 test
+test && test test local "$@" | -eu cd | cd printf readonly sed && then 'quoted text'
+cd $(pwd) local x=1 then printf ${HOME} echo then done then echo printf | sed 'quoted text'
+| echo local grep cd && x=1 -eu ${HOME} cd /usr/bin
+		grep x=1 sed grep readonly $(pwd) grep /usr/bin "$@" $(pwd)
+	-eu 2>/dev/null --verbose sed "$@" -eu done then 2>/dev/null -eu cd export
+	echo echo 2>/dev/null sed cd done echo
+	-eu -eu done 2>/dev/null --verbose $(pwd) test
+		then printf local echo 'quoted text' printf cd awk test awk sed
+		test --verbose ${HOME} sed awk local 'quoted text' test sed
+		&& 'quoted text' test $(pwd) echo
+x=1 -eu -eu /usr/bin test "$@" awk "$@" -eu -eu /usr/bin
+&& ${HOME} done then test -eu export $(pwd) && 'quoted text'
+$(pwd) awk echo -eu readonly
+		grep ${HOME} | sed x=1 local -eu done && done test
+		test | export export "$@" echo readonly
+	-eu -eu && export x=1 export
+	grep ${HOME} | done sed $(pwd) "$@" /usr/bin /usr/bin | "$1" then printf sed x=1
+	sed $(pwd) done then --verbose && $(pwd) echo
+	2>/dev/null printf sed test
+	x=1 sed test "$@" sed ${HOME} "$@" "$1" echo 'quoted text' printf --verbose
+echo -eu ${HOME} --verbose
+--verbose $(pwd) cd local ${HOME} local
+	&& awk -eu sed $(pwd) sed --verbose
+	readonly -eu && cd x=1 readonly readonly
+		printf grep awk --verbose --verbose grep /usr/bin done local
+		readonly done 2>/dev/null $(pwd) --verbose
+local echo echo export
+	printf cd awk "$@" /usr/bin then "$1" ${HOME} sed $(pwd) ${HOME} | $(pwd) 2>/dev/null
+$(pwd) 'quoted text' 'quoted text'
+		then grep sed then echo readonly $(pwd) "$1" 'quoted text'
+		grep ${HOME} -eu x=1 "$1" then then --verbose --verbose test then
+		&& printf ${HOME} sed /usr/bin x=1 && sed 2>/dev/null done printf "$@" && awk
+		"$@" ${HOME} 'quoted text' ${HOME} --verbose readonly printf export done
+--verbose grep ${HOME} ${HOME} echo
+	-eu test "$1" ${HOME} "$1" echo local local /usr/bin local x=1
+grep export local local test x=1 cd 2>/dev/null /usr/bin 'quoted text'
+		${HOME} ${HOME} test 2>/dev/null printf
+		printf printf then grep done --verbose awk awk && $(pwd) sed -eu cd
+		"$1" local local "$@" grep /usr/bin
+		"$@" | ${HOME} x=1 printf local echo awk export cd readonly done
+&& "$@" x=1 echo 2>/dev/null
+		done && done then ${HOME} sed
+	2>/dev/null grep x=1 "$@" then 'quoted text' sed local --verbose | printf
+		"$@" --verbose awk x=1 then
+		| export grep --verbose cd done 2>/dev/null
+	--verbose printf export x=1 "$1" readonly grep "$1" 2>/dev/null
+		'quoted text' /usr/bin
+	printf local x=1 "$@"
+		"$1" export echo -eu done
+x=1 && 2>/dev/null && /usr/bin export local awk ${HOME} /usr/bin done sed
+		awk 'quoted text' && local "$1" sed echo
+		printf printf awk 'quoted text' local
+-eu "$@" printf sed test awk echo 'quoted text'
+printf /usr/bin 2>/dev/null then /usr/bin
+/usr/bin test | $(pwd) grep
+awk grep local awk && export ${HOME} awk $(pwd) $(pwd) then
+	"$1" export sed /usr/bin
+		grep awk done 2>/dev/null ${HOME} --verbose ${HOME} echo
+$(pwd) | 2>/dev/null readonly then x=1 echo grep -eu 'quoted text'
+		echo ${HOME} --verbose && -eu export sed --verbose done awk 'quoted text'
+		export /usr/bin readonly then awk echo sed 'quoted text' grep 'quoted text'
+	export awk then printf -eu /usr/bin
+	awk awk "$@" 2>/dev/null
+	/usr/bin | awk awk && echo echo | -eu cd awk
+grep awk echo then cd cd test 'quoted text' grep done printf "$1" /usr/bin done
+		/usr/bin export $(pwd) /usr/bin awk sed 2>/dev/null
+		printf "$@" -eu 2>/dev/null
+		cd export echo | done then echo readonly local
+sed | 'quoted text' sed "$1" --verbose
+grep x=1 ${HOME} 'quoted text' export readonly 2>/dev/null awk $(pwd) then && local
+grep -eu x=1 'quoted text' awk 2>/dev/null
+		${HOME} /usr/bin -eu ${HOME} && printf "$@" readonly printf cd /usr/bin
+	/usr/bin | $(pwd) && 'quoted text' $(pwd) ${HOME} "$@" -eu
+		done local 'quoted text' local cd $(pwd) --verbose
+	sed test printf test test | sed --verbose awk x=1
+	| grep /usr/bin echo cd $(pwd) test readonly x=1 export export --verbose local
+--verbose export /usr/bin -eu grep echo --verbose "$1" --verbose
+	&& /usr/bin /usr/bin --verbose
+		| test grep readonly sed /usr/bin local "$@" /usr/bin -eu
+export printf --verbose local done cd "$@" /usr/bin
+		done echo test grep $(pwd) export cd export printf $(pwd) --verbose
+	done 2>/dev/null readonly 2>/dev/null | "$@"
+-eu 2>/dev/null && export "$1" ${HOME} export
+		echo 2>/dev/null "$1" --verbose grep grep local test cd -eu export
+	export | 'quoted text' readonly
+sed then readonly printf && awk /usr/bin
+printf test "$@" then && "$1" export
+		sed --verbose | readonly "$1" x=1 test | 2>/dev/null -eu then
+		cd | test sed cd readonly awk "$@" /usr/bin
+	--verbose -eu /usr/bin | | grep then "$@" "$1" done x=1 $(pwd) x=1 cd
+	x=1 test /usr/bin /usr/bin ${HOME} local
+	echo $(pwd) awk ${HOME} | 'quoted text' then
+		done /usr/bin local 2>/dev/null "$1" $(pwd)
+		/usr/bin x=1 awk --verbose awk then 2>/dev/null local -eu && local $(pwd) $(pwd)
+		echo readonly | 2>/dev/null grep export $(pwd) 'quoted text' -eu --verbose then
+2>/dev/null "$1" done 2>/dev/null cd local "$@" 2>/dev/null then 'quoted text'
+		done /usr/bin && $(pwd) -eu --verbose 2>/dev/null $(pwd)
+'quoted text' export awk printf awk 2>/dev/null 'quoted text'
+	$(pwd) test echo x=1 printf awk
+	printf grep readonly "$1" && grep sed
+		local "$1" export echo -eu sed | cd "$@" sed export local
+--verbose test then 2>/dev/null local
+		"$@" 'quoted text' done echo sed 'quoted text'
+	2>/dev/null /usr/bin | export export 2>/dev/null
+-eu "$@" $(pwd) local x=1 | "$1" awk readonly export grep --verbose
+	/usr/bin $(pwd) $(pwd) ${HOME}
+then 'quoted text' export sed 'quoted text' x=1 $(pwd) readonly -eu export
+	2>/dev/null grep "$@" cd $(pwd) done --verbose then then
+	$(pwd) printf "$@" && cd grep
+		then ${HOME} local $(pwd) | readonly x=1 | ${HOME} sed awk
+		'quoted text' -eu $(pwd)
+	$(pwd) grep export export local sed awk
+	export readonly local
+then --verbose | cd test printf -eu sed ${HOME} cd 'quoted text' cd
+	echo export ${HOME} then x=1 sed 2>/dev/null grep
+sed --verbose | "$1" grep --verbose x=1 awk
+"$1" | local local sed 'quoted text'
+/usr/bin 2>/dev/null | printf readonly "$1" | export printf awk then
+	echo local export test $(pwd)
+done 2>/dev/null ${HOME} $(pwd)
+	awk done --verbose "$@" ${HOME}
+awk echo "$@" 2>/dev/null
+test awk test && ${HOME}
+test readonly cd done "$1" echo "$@" /usr/bin 2>/dev/null
+readonly "$@" then 'quoted text' 2>/dev/null readonly sed readonly 2>/dev/null
+sed test $(pwd) $(pwd) awk
+	echo -eu /usr/bin $(pwd) cd sed 'quoted text'
+x=1 /usr/bin 2>/dev/null ${HOME} --verbose
+$(pwd) test then export && /usr/bin export local echo
+2>/dev/null readonly then grep echo 'quoted text'
+		cd /usr/bin export test echo printf -eu -eu 'quoted text' done
+		"$@" echo ${HOME} export $(pwd)
+		-eu "$1" && sed local export --verbose -eu 2>/dev/null --verbose | local
+	| test $(pwd) ${HOME} "$@" printf /usr/bin -eu
+sed $(pwd) /usr/bin "$@" 2>/dev/null sed local &&
+	grep "$@" local readonly --verbose
+	awk | 2>/dev/null echo 'quoted text'
+		test done then $(pwd) done test readonly 2>/dev/null
+'quoted text' | $(pwd) echo then then /usr/bin
+export | then sed x=1 "$1" then | --verbose done /usr/bin sed 'quoted text'
+| 2>/dev/null 2>/dev/null
+		&& export sed test ${HOME} test | done && readonly $(pwd) then /usr/bin
+	| --verbose local export /usr/bin test
+		'quoted text' awk sed awk 'quoted text' x=1 --verbose
+	${HOME} x=1 "$@" | cd export 'quoted text'
+		echo printf --verbose cd -eu printf readonly echo printf --verbose 'quoted text'
+	test grep $(pwd) then && export echo test awk ${HOME} echo --verbose
+/usr/bin "$@" $(pwd) export
+		local x=1 sed readonly $(pwd) 2>/dev/null printf 2>/dev/null
+export cd --verbose "$1" -eu --verbose /usr/bin done /usr/bin test grep awk
+		done cd test | cd "$1" -eu echo printf
+	cd test 'quoted text' done --verbose
+	-eu readonly ${HOME} sed sed grep sed sed
+	-eu "$1" local printf grep "$@" "$@" sed 'quoted text' echo -eu readonly
+x=1 test x=1 | grep export printf /usr/bin
+		test echo ${HOME} awk grep done 2>/dev/null | && /usr/bin grep then -eu
+		sed sed grep -eu "$@" 'quoted text' && awk printf cd echo grep --verbose
+	&& done printf && done x=1 printf 2>/dev/null $(pwd) cd echo printf cd
+"$@" export $(pwd) x=1 && readonly awk 'quoted text' $(pwd) --verbose | local
+	grep 2>/dev/null "$@" 'quoted text' | then x=1 then test x=1 then ${HOME} --verbose
+	2>/dev/null x=1 cd echo cd test && cd
+	local readonly "$@" 2>/dev/null "$@" then
+test | $(pwd) $(pwd) 2>/dev/null && sed $(pwd) export echo readonly
+		sed /usr/bin && sed | 'quoted text'
+		cd done -eu ${HOME} x=1
+local 'quoted text' readonly done ${HOME} "$@" cd sed local
+'quoted text' | $(pwd) ${HOME} "$@"
+	&& done ${HOME} "$1" /usr/bin printf 'quoted text' echo "$1" local cd 'quoted text'
+done && --verbose export cd readonly then "$1" printf
+&& local -eu sed /usr/bin 2>/dev/null then --verbose done | local --verbose
+		| --verbose printf "$@" "$@" export $(pwd) sed export done 'quoted text' | 2>/dev/null
+awk "$@" | | then printf done
+	sed 2>/dev/null grep 2>/dev/null 2>/dev/null x=1 2>/dev/null && "$1" --verbose
+		/usr/bin $(pwd) | $(pwd)
+		$(pwd) && 2>/dev/null cd grep
+'quoted text' 'quoted text' cd sed done --verbose $(pwd) | x=1 2>/dev/null
+	&& echo grep "$@" local --verbose
+		${HOME} 2>/dev/null $(pwd) -eu --verbose
+		"$1" && sed readonly sed printf local cd echo local awk ${HOME} echo
+	grep test awk 2>/dev/null readonly |
+		done 'quoted text' | printf then readonly -eu ${HOME}
+	then --verbose x=1 local -eu readonly -eu $(pwd)
+		test /usr/bin "$1" -eu && -eu test echo && "$1" --verbose grep cd 2>/dev/null
+	readonly 2>/dev/null $(pwd) && awk "$1"
+awk "$@" 2>/dev/null -eu awk echo readonly
+	awk done "$1" done then && $(pwd) ${HOME} | awk --verbose "$1" sed /usr/bin echo
+'quoted text' 2>/dev/null | awk grep 'quoted text' local $(pwd) | sed 'quoted text'
+		${HOME} && /usr/bin --verbose "$@" readonly "$1" grep readonly done ${HOME}
+2>/dev/null export /usr/bin --verbose
+-eu --verbose /usr/bin echo
+	printf readonly 2>/dev/null
+	x=1 local 'quoted text' then ${HOME} cd awk local 'quoted text'
+	readonly printf echo done x=1 /usr/bin readonly readonly --verbose
+	-eu /usr/bin done --verbose --verbose
+	/usr/bin echo --verbose 'quoted text' readonly sed && /usr/bin
+x=1 && -eu 2>/dev/null done sed x=1 2>/dev/null /usr/bin $(pwd) && "$@"
+grep grep x=1 echo printf 2>/dev/null then awk done export
+	"$@" readonly x=1 echo local --verbose
+then | grep /usr/bin && readonly "$@" /usr/bin $(pwd) awk "$@" "$@" awk
+cd test export x=1 2>/dev/null then
+'quoted text' x=1 cd local | local local "$@" "$1" done $(pwd)
+	echo /usr/bin sed "$@" "$1"
+		'quoted text' && --verbose && 'quoted text'
+echo then cd done --verbose | test test awk x=1 local 'quoted text' cd --verbose
+	echo x=1 'quoted text' local then test
+2>/dev/null "$1" -eu echo test ${HOME} -eu -eu ${HOME} echo local grep
+	| grep 'quoted text' sed "$1" grep done
+		&& && printf readonly printf
+	"$1" "$1" "$@" done 2>/dev/null printf "$1" echo grep sed readonly
+		| x=1 2>/dev/null readonly "$1" | --verbose -eu readonly test export $(pwd)
+	local x=1 /usr/bin test 'quoted text' printf grep
+"$@" then --verbose printf /usr/bin
+--verbose cd test /usr/bin readonly
+sed "$@" grep done && x=1 done | readonly
+		/usr/bin export 2>/dev/null && printf
+		test grep 2>/dev/null grep printf ${HOME} test done grep $(pwd)
+		/usr/bin sed printf 'quoted text' then -eu grep ${HOME}
+		echo readonly -eu "$@" x=1 'quoted text'
+		-eu awk echo echo then awk 'quoted text' awk 2>/dev/null
+	export export readonly "$1" readonly
+echo local /usr/bin -eu then test
+cd -eu local && readonly done /usr/bin /usr/bin /usr/bin
+$(pwd) "$1" ${HOME} export then test | --verbose
+		/usr/bin /usr/bin /usr/bin 2>/dev/null "$1" local
+	sed readonly test awk "$@" awk $(pwd)
+	cd sed /usr/bin then done done test test -eu | printf echo
+readonly grep && echo "$1" | echo --verbose | x=1 grep --verbose cd
+		--verbose then awk --verbose --verbose
+	&& sed sed sed done 2>/dev/null && grep export sed /usr/bin
+		grep /usr/bin cd "$1" awk export readonly
+		grep x=1 $(pwd) awk x=1 --verbose
+-eu test $(pwd) then done "$1" readonly /usr/bin
+	-eu local test "$@" -eu test
+	"$1" echo 'quoted text' "$@" export x=1 --verbose /usr/bin
+		echo done $(pwd) local "$@" $(pwd) "$1" ${HOME} -eu cd 2>/dev/null && -eu test
+		then export "$@" ${HOME} test grep /usr/bin 'quoted text' && grep ${HOME}
+		2>/dev/null $(pwd) cd grep sed then -eu awk
+		"$1" "$1" then | 2>/dev/null done then then export done
+		${HOME} export export && done printf "$@"
+awk "$1" test $(pwd) printf $(pwd)
+cd $(pwd) /usr/bin done printf local cd && --verbose $(pwd) local "$@" cd
+		test export echo readonly ${HOME} x=1 done export && && awk $(pwd) awk 2>/dev/null
+$(pwd) 2>/dev/null | grep -eu &&
+	2>/dev/null | then "$@" done --verbose printf sed
+/usr/bin grep x=1 --verbose awk then
+--verbose then x=1 $(pwd) then then | cd 'quoted text'
+/usr/bin test printf cd export
+sed "$1" "$1" 2>/dev/null
+"$1" printf /usr/bin grep then done && then x=1 local $(pwd)
+	readonly ${HOME} $(pwd) 'quoted text' test 2>/dev/null /usr/bin echo x=1 awk
+		2>/dev/null $(pwd) --verbose /usr/bin awk "$1" echo test "$1"
+printf echo cd x=1 'quoted text' "$1"
+echo "$1" 'quoted text'
+	echo done /usr/bin && printf "$1" cd "$@" 'quoted text' $(pwd)
+"$@" then test grep -eu
+		local echo "$@" then | test 'quoted text' | cd 'quoted text' done
+		cd ${HOME} printf x=1 readonly x=1 echo
+	${HOME} 'quoted text' && sed "$1" cd && /usr/bin | local echo export
+		sed 2>/dev/null done grep | && $(pwd) readonly grep $(pwd)
+		"$1" sed local "$@" x=1 done
+"$1" /usr/bin $(pwd) && "$@" then $(pwd) grep $(pwd) cd
+export x=1 local $(pwd) ${HOME}
+	-eu sed cd 2>/dev/null ${HOME} x=1 x=1 | echo /usr/bin echo 2>/dev/null
+	local && | done readonly ${HOME} done /usr/bin
+		&& 'quoted text' export "$@" "$@"
+	grep done sed x=1 'quoted text'
+	'quoted text' 2>/dev/null cd echo "$1"
+		'quoted text' "$@" sed test local 'quoted text' printf readonly cd readonly
+		/usr/bin "$1" --verbose local -eu sed "$1" grep /usr/bin /usr/bin
+	-eu /usr/bin awk test $(pwd) cd | "$@" sed local sed export
+	readonly awk then x=1 2>/dev/null cd readonly
+		echo sed x=1 echo | 'quoted text' done "$@" then done echo -eu
+	"$1" /usr/bin --verbose
+test "$1" awk then then /usr/bin awk grep "$@" awk
+		$(pwd) cd x=1 echo -eu cd export | then ${HOME} sed "$1" printf
+	"$1" local readonly "$@"
+		/usr/bin -eu echo | sed | && x=1 && grep echo export x=1 echo -eu grep ${HOME}
+"$@" --verbose -eu printf sed x=1 x=1 done
+		printf grep ${HOME} sed echo && -eu | -eu --verbose then echo grep test
+	printf --verbose then --verbose 'quoted text' --verbose
+		printf printf 2>/dev/null x=1 then ${HOME}
+		&& $(pwd) && "$1" grep awk awk "$1" && &&
+| then "$1" test /usr/bin ${HOME} x=1 | 'quoted text'
+&& && grep "$@" echo awk local 2>/dev/null
+		local -eu echo sed echo $(pwd) local 2>/dev/null
+		done echo sed "$@" 'quoted text' grep $(pwd) /usr/bin grep ${HOME} done 'quoted text'
+		x=1 2>/dev/null readonly | echo echo | ${HOME} -eu /usr/bin grep local
+	${HOME} ${HOME} cd -eu echo export
+		-eu ${HOME} | "$@" printf /usr/bin /usr/bin
+then awk | "$@" test "$@" export awk 2>/dev/null
+2>/dev/null 2>/dev/null readonly printf printf x=1
+		awk then $(pwd) printf ${HOME} sed -eu
+		| "$@" 2>/dev/null printf
+		&& "$@" "$@" -eu | readonly test -eu ${HOME} readonly local
+'quoted text' echo local 'quoted text' $(pwd) done x=1 sed then /usr/bin
+		'quoted text' /usr/bin 2>/dev/null local x=1 x=1 /usr/bin --verbose $(pwd)
+		awk printf readonly awk echo 2>/dev/null
+"$1" echo grep export | awk local done "$@" readonly grep ${HOME} echo sed
+		export && export awk echo echo 'quoted text' awk then sed printf
+readonly printf | test 'quoted text' x=1 echo sed sed printf --verbose local
+awk export export 2>/dev/null x=1 | done
+"$1" printf --verbose then $(pwd)
+	${HOME} local ${HOME} | $(pwd) /usr/bin $(pwd) ${HOME}
+	&& | && local export && "$1" cd 'quoted text' 2>/dev/null
+	grep test ${HOME} sed cd --verbose ${HOME}
+	awk cd -eu "$@" "$@" && --verbose awk $(pwd) sed cd then ${HOME} -eu
+"$1" 'quoted text' "$1" grep awk printf
+	cd "$@" then local then cd cd --verbose 2>/dev/null done
+sed /usr/bin 'quoted text' readonly 2>/dev/null grep local cd test x=1 | 'quoted text'
+${HOME} --verbose printf "$@" "$@" 'quoted text'
+	| echo /usr/bin export ${HOME} awk ${HOME} cd awk "$@"
+		cd sed && grep sed | grep
+		awk 'quoted text' grep "$@"
+		x=1 2>/dev/null $(pwd) local then done sed 2>/dev/null printf --verbose /usr/bin
+done ${HOME} awk ${HOME} local 2>/dev/null "$@" awk grep echo
+	export x=1 awk readonly 2>/dev/null sed test done printf 2>/dev/null local
+printf done 'quoted text' $(pwd) 'quoted text'
+then -eu 'quoted text' && 2>/dev/null awk test -eu done ${HOME} test
+	--verbose $(pwd) "$@" grep done && local && ${HOME} cd "$1" ${HOME} printf printf
+	done x=1 test ${HOME} local local export done -eu |
+	--verbose && 2>/dev/null
+		"$1" done 2>/dev/null --verbose x=1 -eu x=1
+		done x=1 $(pwd) export test export 2>/dev/null grep sed -eu local "$@" $(pwd)
+test printf -eu echo done | | /usr/bin export cd && && /usr/bin
+then $(pwd) export local export 'quoted text' $(pwd) then
+		then "$1" $(pwd) "$1" then awk | "$1" 'quoted text' readonly grep awk
+		cd --verbose && 2>/dev/null 2>/dev/null --verbose cd -eu cd
+		local -eu ${HOME} /usr/bin export local
+	"$@" export test && readonly -eu $(pwd)
+local && sed export echo -eu printf ${HOME} local x=1 x=1 && printf --verbose
+$(pwd) "$1" cd export /usr/bin | sed "$@"
+--verbose then $(pwd) "$1" local "$@" grep sed x=1
+"$@" /usr/bin x=1 /usr/bin "$@"
+$(pwd) local export $(pwd) cd grep $(pwd)
+${HOME} cd -eu x=1 /usr/bin --verbose ${HOME}
+		awk x=1 ${HOME} | local
+		readonly printf -eu 2>/dev/null export
+		--verbose cd local done 'quoted text' done done --verbose $(pwd) 'quoted text'
+	"$1" printf /usr/bin grep printf then 'quoted text' "$@" 'quoted text' "$1" --verbose
+	--verbose x=1 | ${HOME} done
+-eu export echo test echo
+	/usr/bin /usr/bin cd ${HOME} && $(pwd)
+		export echo printf printf /usr/bin awk local /usr/bin
+| "$1" -eu local $(pwd) cd export grep 2>/dev/null
+	| "$@" 'quoted text' printf $(pwd) done 'quoted text' sed
+export && sed --verbose "$1" awk &&
+readonly 2>/dev/null sed /usr/bin
+		| --verbose cd awk | $(pwd) --verbose
+		then x=1 $(pwd) cd cd done "$@"
+		-eu readonly test export echo /usr/bin local | "$1" "$1"
+	done grep test 'quoted text' 'quoted text' "$1"
+	-eu ${HOME} --verbose $(pwd) grep 2>/dev/null
+2>/dev/null "$@" cd local done
+	--verbose echo --verbose readonly grep "$@" 2>/dev/null --verbose "$1" local
+	2>/dev/null $(pwd) 'quoted text' ${HOME} x=1 cd awk
+	$(pwd) $(pwd) cd grep && "$@" "$1" readonly 'quoted text' awk
+"$1" | printf -eu "$@" printf 2>/dev/null
+	'quoted text' ${HOME} "$1" done 2>/dev/null -eu echo cd grep 2>/dev/null
+		printf test awk /usr/bin then /usr/bin sed export && 2>/dev/null awk
+	$(pwd) echo $(pwd) "$@" local then x=1 local sed && /usr/bin -eu test echo 'quoted text'
+		awk /usr/bin "$1" printf 'quoted text' then "$@" ${HOME} -eu sed /usr/bin "$@" sed
+	printf echo --verbose ${HOME} done cd then -eu
+	awk --verbose echo export export --verbose local
+		2>/dev/null ${HOME} printf sed readonly /usr/bin
+echo /usr/bin && "$@" readonly ${HOME} $(pwd) grep "$@" /usr/bin x=1
+		"$1" 2>/dev/null cd awk local
+	then echo | && readonly grep $(pwd) local $(pwd) "$1" test sed && done
+	awk readonly sed /usr/bin $(pwd) $(pwd)
+	then ${HOME} && 'quoted text' "$@"
+done /usr/bin -eu | echo echo $(pwd) echo /usr/bin 2>/dev/null
+		"$1" local --verbose /usr/bin awk | test local x=1 | readonly $(pwd) -eu
+		x=1 2>/dev/null "$@" ${HOME} /usr/bin x=1 awk grep
+	-eu && -eu && printf awk readonly 2>/dev/null
+		done echo $(pwd) done x=1 then
+&& x=1 echo && x=1 grep done && -eu
+"$1" printf && cd echo cd $(pwd) grep --verbose && -eu && awk test
+	2>/dev/null echo then local x=1 -eu grep done --verbose readonly
+		grep -eu | ${HOME} echo "$@" local
+&& "$@" then then --verbose x=1 done x=1
+		--verbose done | local x=1 $(pwd) 'quoted text'
+	sed x=1 $(pwd) then --verbose &&
+		2>/dev/null "$1" cd $(pwd) | --verbose $(pwd) sed echo 'quoted text'
+	--verbose 'quoted text' cd x=1 $(pwd) sed printf
+	${HOME} | "$1" | -eu -eu ${HOME} --verbose then "$1"
+		"$@" $(pwd) then readonly cd cd done echo sed | 'quoted text' "$@" "$1"
+	printf x=1 "$1" export x=1 export readonly /usr/bin --verbose
+done readonly | "$1" "$@" && ${HOME} "$1" "$1" awk
+-eu ${HOME} 'quoted text' --verbose && cd printf ${HOME}
+		--verbose sed "$1" awk && readonly --verbose printf test printf -eu --verbose
+	--verbose 2>/dev/null printf
+		export "$1" -eu $(pwd) $(pwd) /usr/bin
+	printf then ${HOME} done awk sed export echo local awk
+--verbose --verbose export echo 2>/dev/null "$@" awk cd $(pwd)
+	sed ${HOME} "$1" --verbose 2>/dev/null done x=1 then then
+		&& cd done x=1 awk readonly echo echo 'quoted text' | ${HOME} sed x=1 printf readonly
+		--verbose echo "$@" |
+grep printf awk | echo local "$1"
+	"$1" sed grep sed export
+	2>/dev/null export && awk grep sed local $(pwd) readonly /usr/bin ${HOME}
+	export ${HOME} cd $(pwd) -eu --verbose x=1 "$1" printf && 2>/dev/null "$@" 'quoted text'
+test cd ${HOME} grep && cd "$@" x=1 && cd --verbose && printf && ${HOME} -eu
+		printf awk cd 2>/dev/null && readonly
+awk ${HOME} echo echo echo export 2>/dev/null readonly | 2>/dev/null done $(pwd)
+	$(pwd) grep /usr/bin cd $(pwd) grep test 'quoted text' then /usr/bin
+		export -eu echo /usr/bin grep echo export test local then local echo cd done --verbose
+		cd cd "$1" /usr/bin test export
+		"$1" echo | && 2>/dev/null /usr/bin echo awk | --verbose awk /usr/bin
+${HOME} 2>/dev/null then "$1" /usr/bin /usr/bin then "$@" "$1" local
+${HOME} "$1" $(pwd) done
+-eu readonly cd readonly | && echo /usr/bin
+		local && /usr/bin cd && local test then ${HOME} 'quoted text' echo "$1"
+readonly 2>/dev/null | printf x=1 echo readonly awk local 'quoted text'
+x=1 grep grep "$@" done "$@" "$1" 'quoted text'
+	$(pwd) sed grep local "$@" $(pwd) sed /usr/bin 2>/dev/null
+	done /usr/bin cd grep 'quoted text' printf
+		awk 2>/dev/null then printf
+	cd grep x=1 then $(pwd) cd x=1 sed 'quoted text' "$@" "$1" echo echo local /usr/bin
+		grep ${HOME} then $(pwd) 2>/dev/null sed 'quoted text' "$1" echo
+done cd x=1 -eu /usr/bin --verbose
+| done echo -eu -eu test $(pwd) && | && test sed 'quoted text' "$@" export "$1"
+		"$1" export echo $(pwd) test local $(pwd) --verbose $(pwd) awk ${HOME}
+	"$1" ${HOME} /usr/bin local && "$@" grep test sed done ${HOME}
+		export $(pwd) "$@" ${HOME} 2>/dev/null awk export
+	--verbose then 2>/dev/null /usr/bin -eu grep
+	sed awk printf -eu 2>/dev/null ${HOME} ${HOME} export done /usr/bin
+		awk "$1" grep /usr/bin cd
+	| cd "$@" readonly then -eu sed export && x=1 printf done | echo --verbose -eu
+	awk "$@" local printf "$1" test x=1 echo --verbose echo "$1" local
+	x=1 test echo -eu then $(pwd) export /usr/bin && sed --verbose readonly
+&& readonly sed "$@" test done local
+--verbose ${HOME} ${HOME} --verbose
+		'quoted text' echo sed local ${HOME} x=1 cd 2>/dev/null
+&& "$@" "$1" "$1" "$1" echo 'quoted text'
+$(pwd) sed export local && "$1" -eu readonly && /usr/bin
+	'quoted text' ${HOME} awk cd echo then /usr/bin echo grep sed 'quoted text' $(pwd)
+	"$1" ${HOME} awk | 'quoted text' ${HOME} export ${HOME}
+-eu cd x=1 test 'quoted text' cd local sed /usr/bin echo export
+		test $(pwd) "$1" export 'quoted text' test export -eu x=1
+	test -eu then "$@" $(pwd) x=1 grep readonly awk "$@" /usr/bin
+grep "$1" /usr/bin awk sed awk 'quoted text'
+		'quoted text' "$@" $(pwd) 2>/dev/null printf awk awk && echo cd
+x=1 2>/dev/null -eu sed && ${HOME}
+"$@" /usr/bin --verbose | echo grep then echo /usr/bin
+x=1 --verbose readonly grep test then --verbose -eu readonly
+-eu ${HOME} sed "$1" sed test readonly
+awk done echo local /usr/bin sed /usr/bin && -eu sed &&
+		-eu "$1" printf then printf readonly --verbose
+		$(pwd) then | /usr/bin && export sed echo test "$1" 'quoted text' 'quoted text'
+	/usr/bin x=1 then "$@" echo done printf ${HOME} cd --verbose export echo
+		-eu then readonly test local test --verbose done
+		grep ${HOME} grep test then "$@" x=1 readonly local 2>/dev/null
+/usr/bin printf | sed echo ${HOME} done 'quoted text' /usr/bin awk grep done ${HOME}
+"$@" then readonly "$@" export ${HOME} cd /usr/bin && awk
+	awk printf 2>/dev/null -eu grep x=1
+	echo test export local ${HOME}
+		"$@" --verbose --verbose x=1 x=1 "$@" x=1 printf
+	local cd done ${HOME} readonly awk grep cd readonly readonly
+		then && echo $(pwd) | local x=1 grep $(pwd) /usr/bin done $(pwd) printf $(pwd)
+	| 2>/dev/null grep | x=1 'quoted text' $(pwd) -eu echo readonly
+sed grep | $(pwd) --verbose printf x=1 $(pwd) 2>/dev/null
+	cd "$@" && /usr/bin && "$1" sed 'quoted text'
+"$@" "$@" echo export ${HOME} -eu cd sed export $(pwd) "$1" ${HOME} "$@" printf
+	echo x=1 awk && 'quoted text' -eu then local local cd -eu done sed grep sed -eu
+		/usr/bin && -eu local cd printf
+2>/dev/null --verbose /usr/bin then --verbose --verbose "$1" echo && then
+	$(pwd) readonly printf then echo awk 'quoted text' --verbose grep awk
+		done then x=1 grep $(pwd) done cd done local
+	echo then echo "$@" 2>/dev/null
+		-eu $(pwd) echo --verbose ${HOME} x=1
+	/usr/bin sed 'quoted text' done printf then readonly awk "$@" sed sed
+	printf local grep --verbose
+/usr/bin done grep | --verbose 2>/dev/null
+	then grep test readonly test && | test x=1 2>/dev/null
+	--verbose printf $(pwd) awk --verbose test ${HOME}
+		local | export awk x=1 -eu --verbose
+"$1" done cd 2>/dev/null sed test
+	"$@" 2>/dev/null 'quoted text'
+	sed readonly then done awk then echo /usr/bin
+		--verbose x=1 echo echo awk "$1" done 2>/dev/null local printf /usr/bin done
+	"$1" -eu export && then readonly 2>/dev/null && "$@" x=1 local -eu printf export
+		| awk /usr/bin $(pwd) readonly "$1" printf "$@" cd -eu printf -eu --verbose
+	x=1 $(pwd) -eu 'quoted text' -eu sed | x=1 done echo |
+	x=1 printf done && ${HOME}
+		--verbose --verbose && local ${HOME}
+	$(pwd) 2>/dev/null 2>/dev/null done /usr/bin --verbose test "$@" cd ${HOME}
+	test export && 'quoted text' "$1" /usr/bin
+readonly test done "$@" readonly /usr/bin
+	$(pwd) echo readonly -eu /usr/bin x=1 -eu done x=1 sed "$@" --verbose "$@"
+then then 'quoted text' echo local echo "$@"
+		/usr/bin awk ${HOME} local -eu readonly test grep 2>/dev/null echo
+${HOME} --verbose "$1" 2>/dev/null --verbose
+	done then cd readonly test $(pwd) grep 2>/dev/null awk export awk done test
+	--verbose | x=1 done sed grep printf x=1 --verbose $(pwd) cd --verbose
+		local ${HOME} -eu -eu ${HOME} test grep echo
+		${HOME} "$1" done -eu "$@"
+local cd ${HOME} readonly "$@" && $(pwd) 'quoted text'
+/usr/bin sed printf printf && --verbose readonly 'quoted text'
+		sed then done --verbose --verbose "$1" 2>/dev/null
+		'quoted text' local cd grep /usr/bin cd cd ${HOME}
+sed | sed echo $(pwd) export $(pwd) cd 'quoted text'
+done -eu readonly /usr/bin readonly readonly local $(pwd) done "$1" "$@" "$@"
+		'quoted text' 2>/dev/null printf | "$@" done "$@"
+		then /usr/bin test "$@" local -eu printf 2>/dev/null printf sed then echo
+grep grep /usr/bin && printf local sed "$1" $(pwd) "$@" 2>/dev/null
+printf -eu $(pwd) grep | 2>/dev/null test test then x=1 && 2>/dev/null
+	test 'quoted text' then export sed | ${HOME} 2>/dev/null "$1"
+		$(pwd) test "$1" done "$1" 2>/dev/null export && awk
+		test then 'quoted text' grep 2>/dev/null ${HOME} --verbose awk && local readonly
+readonly local test echo ${HOME}
+	/usr/bin -eu then | /usr/bin cd test test &&
+	$(pwd) cd test 2>/dev/null "$1" $(pwd) test echo sed export
+| "$1" test && $(pwd) sed 'quoted text' local sed done local
+echo local "$1" test sed $(pwd) cd sed
+printf sed done -eu $(pwd) /usr/bin then awk printf sed 2>/dev/null local ${HOME}
+		then && ${HOME} "$@" local cd $(pwd) -eu local readonly
+	echo then done cd --verbose x=1 echo --verbose 'quoted text' -eu /usr/bin
+		"$1" local | readonly | && 2>/dev/null
+	x=1 echo ${HOME} then $(pwd) -eu
+		awk 2>/dev/null ${HOME} 'quoted text' "$1" ${HOME} x=1
+	sed x=1 sed printf then sed done grep "$1" sed readonly printf
+	${HOME} echo grep grep
+		"$1" readonly export echo 2>/dev/null
+export echo awk ${HOME} && cd awk readonly
+	x=1 -eu test -eu 2>/dev/null "$1" x=1
+	/usr/bin done cd local test sed -eu test sed | test local test /usr/bin echo awk
+	sed /usr/bin "$1" -eu test awk $(pwd) /usr/bin done export test
+2>/dev/null 2>/dev/null export
+'quoted text' $(pwd) awk printf
+	grep -eu "$@" "$@" cd 2>/dev/null $(pwd) 'quoted text' "$@" --verbose
+	"$@" --verbose "$1" test
+		done 'quoted text' cd cd done echo then --verbose
+		cd -eu "$@" ${HOME} test awk "$@" | | grep awk x=1 'quoted text'
+		'quoted text' local cd sed printf "$1" readonly && --verbose &&
+	$(pwd) x=1 ${HOME} then --verbose then && then x=1 awk 2>/dev/null
+	cd echo local echo 2>/dev/null x=1 -eu printf cd -eu done --verbose --verbose
+		--verbose export echo export export ${HOME} x=1 /usr/bin x=1 "$@" cd ${HOME} x=1
+| x=1 sed done done | $(pwd) done /usr/bin x=1 ${HOME} sed printf
+| | done grep ${HOME} echo | | export -eu
+printf export echo -eu
+		${HOME} $(pwd) x=1 readonly export && echo $(pwd) grep
+sed "$1" cd | awk 'quoted text' 'quoted text' "$@" local export
+		test && echo x=1 --verbose |
+	awk local 'quoted text' | readonly 2>/dev/null local "$@" --verbose
+test | 'quoted text' local readonly cd export printf &&
+		"$@" | /usr/bin test export echo 2>/dev/null readonly
+	--verbose $(pwd) ${HOME} grep printf export -eu readonly --verbose
+		awk echo /usr/bin ${HOME} test && ${HOME} --verbose ${HOME} local
+awk printf local local printf 2>/dev/null readonly "$@"
+		2>/dev/null export "$1"
+		--verbose then "$1" export done local
+	-eu $(pwd) x=1 /usr/bin
+	then 2>/dev/null -eu | then | "$@"
+cd grep $(pwd) --verbose | local | 'quoted text' --verbose ${HOME} && /usr/bin
+		printf "$1" ${HOME} readonly
+printf sed 'quoted text' -eu && cd awk $(pwd) "$@" test then "$@"
+sed done printf "$@" awk -eu 2>/dev/null 'quoted text'
+	&& -eu awk local grep sed echo -eu $(pwd) -eu done $(pwd) done x=1 printf echo
+		local echo && test --verbose printf ${HOME} grep x=1 test --verbose
+		"$@" && echo /usr/bin x=1 "$@" printf printf --verbose | "$@" readonly grep local
+		| export export x=1 echo test cd grep $(pwd)
+x=1 2>/dev/null -eu echo
+"$1" x=1 --verbose printf export
+		export echo 'quoted text' "$@" local x=1 $(pwd)
+		readonly ${HOME} awk | then --verbose done /usr/bin ${HOME} $(pwd) -eu
+"$@" test sed then printf x=1 echo
+/usr/bin && then then awk local awk 2>/dev/null
+-eu then ${HOME} local local local $(pwd) x=1 $(pwd) cd sed 2>/dev/null
+'quoted text' $(pwd) x=1 2>/dev/null --verbose then
+grep | export echo 'quoted text' echo "$@" done awk x=1 done export
+	printf local $(pwd) then sed $(pwd) readonly then --verbose --verbose
+		export cd echo done test "$1" printf --verbose x=1 local -eu local "$1" 'quoted text'
+$(pwd) --verbose local test test ${HOME} grep
+/usr/bin done done 'quoted text' ${HOME}
+	export grep done 2>/dev/null
+	awk "$@" 'quoted text' $(pwd) "$@"
+		"$@" "$1" --verbose "$@" echo
+		"$1" done sed then grep -eu then sed echo then "$@"
+$(pwd) echo readonly -eu local --verbose cd export test "$1" echo
+sed done grep test grep x=1 test test -eu grep
+		test test $(pwd) -eu grep cd "$@" cd 'quoted text'
+	sed --verbose && "$1" &&
+-eu $(pwd) echo ${HOME} -eu -eu --verbose 2>/dev/null --verbose "$@"
+		x=1 then readonly -eu local test test local echo x=1 | 'quoted text'
+		echo 'quoted text' readonly 2>/dev/null cd cd done then /usr/bin
+		"$1" grep export grep 2>/dev/null
+		${HOME} local echo 'quoted text'
+	${HOME} && printf echo test sed done "$@" ${HOME} grep --verbose
+then /usr/bin then --verbose awk
+		readonly "$@" export local readonly
+	x=1 "$@" 'quoted text' then cd cd export export grep cd local | export
+${HOME} grep "$@" test $(pwd) /usr/bin $(pwd) --verbose awk | x=1 export echo
+	/usr/bin 2>/dev/null --verbose printf 'quoted text' cd -eu ${HOME} $(pwd)
+		test "$1" $(pwd) done $(pwd) printf then export /usr/bin
+		cd test cd "$1" grep "$1" echo then -eu cd then -eu readonly 'quoted text' test
+then local $(pwd) cd
+		echo cd local cd awk $(pwd) &&
+		grep | readonly -eu x=1 ${HOME} x=1 'quoted text'
+		awk x=1 "$@" local && awk /usr/bin 'quoted text' done "$@" then done local test
+		sed test grep local printf -eu -eu $(pwd) local
+"$@" 2>/dev/null test awk -eu sed x=1 then
+	$(pwd) /usr/bin test export -eu echo test echo --verbose | readonly "$@" done
+		x=1 sed done echo --verbose 2>/dev/null test done $(pwd)
+	grep cd export cd $(pwd)
+		echo "$1" sed $(pwd) done export
+		readonly local | 'quoted text'
+2>/dev/null "$@" readonly echo --verbose -eu grep "$1" test awk /usr/bin --verbose
+		${HOME} /usr/bin /usr/bin test test test x=1 sed export grep test grep
+"$1" grep sed awk "$1" && export "$1" then /usr/bin -eu --verbose
+readonly /usr/bin echo readonly test -eu sed awk
+	readonly $(pwd) cd x=1 "$1" 'quoted text'
+		local && export export /usr/bin done export ${HOME} cd
+		awk -eu grep grep && cd && |
+		-eu --verbose grep sed export | -eu local 2>/dev/null
+grep /usr/bin /usr/bin readonly | /usr/bin /usr/bin
+	| --verbose grep printf $(pwd) ${HOME} 2>/dev/null awk readonly export
+	"$1" -eu $(pwd) local 2>/dev/null x=1 printf readonly test -eu
+	echo x=1 awk cd $(pwd) && printf then
+test cd sed "$1" x=1 2>/dev/null --verbose cd /usr/bin 2>/dev/null
+		awk echo printf "$1" test && local $(pwd) then test done
+	-eu done && ${HOME} done
+		&& then ${HOME} 2>/dev/null /usr/bin done
+	readonly then 2>/dev/null /usr/bin awk && awk
+	sed echo awk $(pwd) export x=1 sed $(pwd) cd -eu /usr/bin "$1" cd printf
+	grep test cd awk /usr/bin local
+--verbose test grep x=1 && x=1 2>/dev/null
+		export then export -eu printf local awk export
+		"$@" readonly "$@" x=1 done export /usr/bin 'quoted text' export
+		2>/dev/null -eu $(pwd) awk
+	printf $(pwd) x=1 && local export 'quoted text'
+	${HOME} 2>/dev/null grep $(pwd) echo echo
+	grep grep | /usr/bin done 2>/dev/null ${HOME} awk -eu cd local x=1
+		printf test cd -eu x=1 x=1 cd "$@" x=1 test /usr/bin
+	| 'quoted text' 2>/dev/null 'quoted text' 2>/dev/null &&
+echo x=1 "$@" done export -eu "$1" -eu
+	--verbose -eu readonly -eu $(pwd) | && export printf test
+local $(pwd) /usr/bin grep readonly export done
+		x=1 test ${HOME} grep test
+"$@" local "$1" echo echo printf ${HOME}
+		local done -eu readonly then x=1 2>/dev/null -eu "$1" readonly ${HOME} readonly
+		done awk && --verbose readonly $(pwd) awk ${HOME} done && done grep sed cd ${HOME}
+		local /usr/bin 2>/dev/null printf echo 'quoted text' | done "$@" | "$1"
+		grep awk && -eu done /usr/bin local 'quoted text' readonly cd && ${HOME} then
+		&& sed "$@" done $(pwd) -eu done echo sed sed
+		2>/dev/null "$1" 2>/dev/null then test --verbose -eu 2>/dev/null
+		-eu sed /usr/bin && export $(pwd) local local
+"$1" ${HOME} | x=1 then cd sed
+		--verbose cd "$1" 2>/dev/null "$@" --verbose sed && grep
+		x=1 "$@" printf grep --verbose sed grep
+x=1 then | "$@" "$@" 'quoted text' 'quoted text' export local then 'quoted text'
+grep awk && x=1 then 'quoted text' local grep -eu | 'quoted text'
+	$(pwd) done test "$@" $(pwd)
+		'quoted text' $(pwd) test test printf --verbose sed -eu x=1
+awk | cd awk awk 'quoted text' "$1"
+	2>/dev/null cd sed awk done test
+	"$1" awk readonly grep sed done "$@" | echo
+		"$1" 'quoted text' test echo x=1 sed
+/usr/bin 'quoted text' | test | 'quoted text' done local -eu -eu
+${HOME} x=1 'quoted text'
+		grep x=1 /usr/bin readonly grep
+		printf x=1 "$@" x=1 ${HOME} --verbose ${HOME}
+		-eu local cd "$@" export && grep export --verbose printf done readonly "$@" test
+	sed x=1 -eu export /usr/bin "$1" grep grep 2>/dev/null x=1 grep --verbose
+	2>/dev/null | echo export awk 'quoted text'
+	2>/dev/null 'quoted text'
+	x=1 x=1 printf done printf $(pwd) printf
+awk cd then ${HOME} test /usr/bin test local export
+	cd sed /usr/bin awk $(pwd) 'quoted text' && ${HOME} local local
+/usr/bin x=1 done cd export && printf sed done "$1" 2>/dev/null local
+echo cd local grep $(pwd) then local done test grep
+	echo grep 2>/dev/null export readonly "$1"
+		--verbose done sed "$1" readonly
+		2>/dev/null ${HOME} /usr/bin grep -eu sed 'quoted text'
+"$@" test 'quoted text' x=1 cd echo
+	grep export readonly "$@" /usr/bin then $(pwd) then export 2>/dev/null
+	readonly readonly "$@" ${HOME} then "$1" | cd | export export done
+&& && && readonly export --verbose "$@" awk printf | cd
+$(pwd) then $(pwd) "$1" --verbose awk readonly ${HOME} cd
+		'quoted text' done echo ${HOME} test
+		sed 'quoted text' "$1" readonly --verbose
+		"$1" cd local -eu echo 2>/dev/null printf done --verbose readonly
+test -eu -eu /usr/bin test -eu grep export readonly readonly awk
+"$1" ${HOME} printf /usr/bin 2>/dev/null | grep 2>/dev/null | && awk grep
+	x=1 test echo grep done -eu test sed cd sed
+		then "$1" done sed local -eu cd local && ${HOME} --verbose "$1" 2>/dev/null awk
+		&& && -eu "$@" -eu $(pwd) 'quoted text' x=1 /usr/bin -eu /usr/bin
+	${HOME} "$@" awk ${HOME} done 2>/dev/null done export echo
+		readonly ${HOME} cd then --verbose readonly && printf cd printf printf cd sed
+		grep sed readonly test then test sed 2>/dev/null echo 2>/dev/null && grep x=1
+	awk sed | -eu && "$1" then done echo ${HOME} local grep local
+	-eu export local 'quoted text' sed done
+	grep --verbose "$@" test 'quoted text' sed --verbose
+	2>/dev/null export && $(pwd) printf "$@" -eu test printf printf export "$@" awk
+		&& cd sed $(pwd) awk /usr/bin --verbose
+		/usr/bin $(pwd) test && grep cd /usr/bin echo test | grep local
+	"$1" "$1" done && grep printf awk /usr/bin sed "$@" |
+		readonly awk test cd --verbose x=1 'quoted text'
+then && && --verbose sed "$@" x=1 'quoted text'
+		&& grep ${HOME} sed test "$1" /usr/bin 2>/dev/null awk printf && sed readonly
+		"$1" && && export printf echo --verbose ${HOME} -eu echo readonly
+2>/dev/null -eu /usr/bin && --verbose --verbose printf export && x=1 awk
+$(pwd) sed "$@" then |
+	readonly -eu ${HOME} "$1" ${HOME}
+	printf ${HOME} ${HOME} export /usr/bin grep test echo | grep
+	&& awk "$@" $(pwd) readonly sed /usr/bin $(pwd) && export echo
+	x=1 echo "$@" echo "$@" /usr/bin
+	cd 'quoted text' printf test done 'quoted text' -eu cd "$1" grep --verbose grep
+		"$@" readonly printf cd local
+		$(pwd) sed cd 'quoted text' && --verbose grep local 2>/dev/null
+awk printf local test cd x=1 /usr/bin sed "$1" awk --verbose
+awk x=1 grep | grep readonly "$1"
+	echo x=1 readonly && grep --verbose done
+	cd cd readonly 'quoted text' then -eu echo 'quoted text'
+then echo cd --verbose export export -eu --verbose x=1 -eu
+	then test done printf /usr/bin | sed printf -eu
+"$@" printf then printf $(pwd) 2>/dev/null 'quoted text' printf
+		"$1" awk printf done export ${HOME} then test -eu -eu local ${HOME} /usr/bin
+	2>/dev/null cd | 'quoted text' $(pwd) ${HOME} printf
+then $(pwd) && --verbose cd readonly
+	done done echo && done --verbose && readonly grep readonly then /usr/bin
+	'quoted text' grep cd --verbose 'quoted text' sed
+	'quoted text' /usr/bin readonly -eu export
+		cd --verbose then grep 'quoted text' printf awk
+cd x=1 awk 2>/dev/null grep 2>/dev/null ${HOME}
+| readonly 'quoted text'
+		local export then x=1 local -eu then then 'quoted text'
+local grep x=1 $(pwd) --verbose echo ${HOME}
+	export test "$@" 2>/dev/null --verbose $(pwd) |
+	/usr/bin ${HOME} done x=1 | awk printf export 'quoted text' /usr/bin readonly
+	then 2>/dev/null sed | --verbose 'quoted text'
+then /usr/bin 'quoted text' export cd x=1 done cd printf export export printf 2>/dev/null
+		x=1 -eu test "$@" --verbose sed | then "$@" -eu grep echo test "$1" $(pwd)
+"$1" sed test -eu ${HOME} done x=1
+	export echo 2>/dev/null 'quoted text' -eu echo cd done sed awk
+		local grep "$@" echo printf
+		/usr/bin | grep 'quoted text' then "$@" done /usr/bin then --verbose
+"$@" $(pwd) && | export printf --verbose
+'quoted text' ${HOME} sed sed readonly printf
+		printf 2>/dev/null 'quoted text'
+	"$@" then then cd /usr/bin ${HOME}
+	test printf local cd "$@" --verbose awk "$@"
+	echo awk ${HOME} then /usr/bin test sed "$1" export
+	&& test printf "$1" cd printf -eu
+		then | /usr/bin 'quoted text' "$@" sed awk $(pwd) cd grep awk
+		2>/dev/null done then awk awk echo echo awk /usr/bin 'quoted text' export
+		test "$@" "$1" printf printf "$1" "$@"
+	echo readonly printf done | -eu readonly
+printf ${HOME} 'quoted text' --verbose x=1 printf --verbose grep
+	echo awk x=1 cd printf cd readonly local ${HOME} -eu
+	$(pwd) echo readonly test 2>/dev/null test then && /usr/bin x=1 grep export 'quoted text'
+$(pwd) ${HOME} test local "$@" 2>/dev/null "$1" | 'quoted text'
+	"$1" then && ${HOME} $(pwd) echo grep 'quoted text'
+		export -eu $(pwd) "$@" "$@" /usr/bin test grep local | && readonly "$1"
+		"$@" printf readonly echo x=1 $(pwd)
+	-eu then grep "$1" --verbose printf cd /usr/bin then export 2>/dev/null 2>/dev/null
+		'quoted text' test 'quoted text' 'quoted text'
+		| 'quoted text' "$1" "$@"
+	cd 2>/dev/null local readonly export export
+		2>/dev/null test then x=1 echo $(pwd) 2>/dev/null
+	done export awk cd cd $(pwd) echo -eu | /usr/bin
+printf sed sed "$1" /usr/bin local x=1 $(pwd) awk |
+	test && "$1" readonly awk "$1" && -eu echo then printf $(pwd) "$@"
+	done $(pwd) 2>/dev/null && ${HOME} export "$1" $(pwd) sed /usr/bin "$@" readonly
+		export -eu echo cd 'quoted text' x=1 /usr/bin -eu echo /usr/bin
+		${HOME} ${HOME} x=1 export local | | grep then 'quoted text'
+		$(pwd) sed cd done awk export 2>/dev/null grep 2>/dev/null
+done done grep export | ${HOME} local "$1" sed
+	grep ${HOME} /usr/bin --verbose readonly
+	awk --verbose | | 2>/dev/null 2>/dev/null test readonly
+		cd test sed echo -eu "$1" grep "$@" cd local readonly
+	cd cd done "$1" 2>/dev/null --verbose sed test then sed printf /usr/bin
+		| printf then | /usr/bin readonly | echo done export $(pwd) cd printf
+2>/dev/null && cd test && export | echo --verbose test --verbose
+"$1" --verbose sed 'quoted text' awk
+	${HOME} 2>/dev/null export export -eu --verbose && done
+		echo 'quoted text' readonly ${HOME}
+${HOME} test && $(pwd) printf printf | printf | /usr/bin readonly
+		${HOME} 'quoted text' -eu | "$1" local x=1 local printf x=1 'quoted text'
+'quoted text' printf -eu readonly local x=1 then
+		echo /usr/bin /usr/bin x=1 readonly /usr/bin /usr/bin awk echo 'quoted text'
+| printf local --verbose awk |
+x=1 printf sed export | 2>/dev/null
+	sed "$@" cd readonly readonly readonly
+	"$1" /usr/bin cd /usr/bin test | test --verbose sed cd "$1" then test
+$(pwd) $(pwd) cd sed then x=1 "$@" && then $(pwd) grep export test printf
+/usr/bin awk test /usr/bin then --verbose cd "$@" "$1" | cd done
+		local grep 2>/dev/null local /usr/bin test
+	2>/dev/null && && ${HOME} | export "$1" x=1 ${HOME} &&
+		awk sed | -eu awk --verbose done "$1" -eu sed "$@" | | awk x=1 --verbose | cd
+		local then then done sed ${HOME} | | test /usr/bin
+"$1" 2>/dev/null awk "$1" awk export | --verbose grep printf | -eu "$@" cd echo
+	| local 2>/dev/null --verbose && local $(pwd) $(pwd) ${HOME} "$1" readonly
+	/usr/bin done -eu then -eu done $(pwd) done sed /usr/bin test echo &&
+	done --verbose local export cd sed readonly && printf
+	&& "$1" then printf | test
+cd echo readonly $(pwd) readonly test x=1 "$1" 2>/dev/null echo --verbose
+		'quoted text' awk echo -eu --verbose 'quoted text'
+then --verbose cd | 'quoted text' "$1" sed local $(pwd) | "$1" ${HOME}
+	done grep "$@" local local "$1" && cd /usr/bin
+		done grep | 2>/dev/null "$@"
+readonly 2>/dev/null grep awk done echo /usr/bin
+	"$@" -eu export x=1 ${HOME} "$1" && done | printf
+	echo done 'quoted text' 2>/dev/null printf | 'quoted text' test | sed then
+	cd local export readonly printf cd "$@" readonly
+	${HOME} done --verbose test $(pwd) awk && 2>/dev/null
+		then export --verbose export $(pwd)
+local -eu | grep "$@" 2>/dev/null echo
+	grep printf sed && done cd 'quoted text' done
+		grep "$@" sed && "$@" export && readonly local test echo "$1"
+	-eu "$@" $(pwd) printf
+		cd | test local ${HOME} 2>/dev/null
+	echo sed done | /usr/bin | /usr/bin
+		done then "$@" test then /usr/bin
+"$1" && ${HOME} awk grep test /usr/bin printf export ${HOME} awk ${HOME}
+	awk ${HOME} readonly x=1 grep printf && readonly readonly -eu local /usr/bin
+2>/dev/null && readonly -eu --verbose -eu local -eu "$1" "$@"
+		2>/dev/null "$@" printf printf x=1 2>/dev/null 2>/dev/null echo 2>/dev/null
+then then "$1" x=1 export "$1"
+&& export sed 'quoted text' then sed --verbose ${HOME} printf done
+x=1 cd printf sed "$1" readonly
+		&& sed readonly && then x=1 -eu 2>/dev/null done awk sed
+	export test sed cd export -eu echo /usr/bin -eu --verbose $(pwd) done
+	done echo && cd readonly test "$1" --verbose && /usr/bin printf local printf
+		-eu sed awk -eu cd 'quoted text' local test readonly
+-eu local "$@" "$1" && grep --verbose awk echo grep | 2>/dev/null
+&& done -eu $(pwd) awk readonly readonly printf printf ${HOME} test
+	'quoted text' export echo
+	then ${HOME} ${HOME} -eu --verbose 2>/dev/null
+		$(pwd) printf awk $(pwd) local | ${HOME} "$1" 'quoted text'
+cd $(pwd) printf --verbose && done sed done $(pwd)
+	done readonly 2>/dev/null --verbose | export readonly && | printf && printf
+		--verbose cd local --verbose -eu grep cd 'quoted text'
+		2>/dev/null 'quoted text' x=1 2>/dev/null "$1" --verbose --verbose
+	x=1 ${HOME} -eu | printf 'quoted text'
+	2>/dev/null 'quoted text' grep test readonly
+		cd $(pwd) local sed && cd "$@" echo /usr/bin
+grep export "$1" "$1" echo done "$1" 'quoted text' /usr/bin
+		grep $(pwd) test grep local cd test 2>/dev/null
+	$(pwd) echo export | export x=1 "$@"
+		'quoted text' printf awk "$1" --verbose printf $(pwd) echo
+		/usr/bin export then --verbose && && grep grep done
+'quoted text' printf echo
+		2>/dev/null printf "$@" "$@" test
+grep | echo readonly x=1 echo awk awk
+	&& --verbose readonly printf | echo 'quoted text'
+	sed export "$@" cd local | ${HOME} sed /usr/bin sed "$@" cd local then 2>/dev/null
+		/usr/bin /usr/bin 2>/dev/null test test sed local /usr/bin 'quoted text'
+	grep "$@" printf && $(pwd) x=1 "$1" grep echo -eu then awk && awk "$1"
+		awk local "$@" 2>/dev/null grep 'quoted text'
+		local ${HOME} awk cd export awk 2>/dev/null --verbose
+	--verbose "$@" 'quoted text' sed 2>/dev/null
+		export export sed x=1 cd local local "$@" then local grep sed awk $(pwd) "$1"
+sed awk then cd /usr/bin "$@" && grep
+awk -eu 'quoted text' --verbose && echo x=1 awk sed
+	${HOME} local sed ${HOME}
+	'quoted text' cd x=1 && "$1" done -eu printf
+	"$1" "$@" done --verbose ${HOME} echo export sed
+2>/dev/null x=1 ${HOME} --verbose -eu cd echo "$@" grep
+	cd readonly printf awk local
+		"$@" 'quoted text' "$1" readonly 2>/dev/null | 2>/dev/null grep
+	--verbose grep export test "$1" then
+sed 'quoted text' done ${HOME} grep ${HOME} 'quoted text' "$@"
+		awk printf export "$1" x=1 /usr/bin sed "$1"
+done $(pwd) "$1" then -eu /usr/bin ${HOME} echo 'quoted text' local | grep
+		readonly $(pwd) printf -eu test
+		test 'quoted text' awk $(pwd) "$@" /usr/bin x=1 --verbose done
+| sed printf test cd then export 2>/dev/null local sed readonly sed 2>/dev/null
+		-eu then && /usr/bin 2>/dev/null readonly echo printf /usr/bin
+	-eu grep export echo export 'quoted text'
+	"$@" grep "$1" 'quoted text'
+		2>/dev/null grep awk done printf /usr/bin "$1" "$@" sed
+	awk local --verbose awk ${HOME} --verbose --verbose /usr/bin -eu done
+		"$@" 'quoted text' x=1 cd /usr/bin echo && export "$1" printf test
+	"$@" readonly readonly --verbose --verbose && then cd 2>/dev/null cd local
+printf /usr/bin done $(pwd) x=1 2>/dev/null awk
+		export awk -eu readonly
+	then printf readonly readonly cd --verbose && $(pwd) then 'quoted text'
+	"$1" "$@" echo readonly 2>/dev/null
+	cd readonly done awk -eu awk done x=1 "$1" grep | awk sed printf test
+	$(pwd) awk && done test "$1"
+	&& export /usr/bin $(pwd) /usr/bin grep /usr/bin x=1
+$(pwd) readonly printf grep "$@" && 2>/dev/null 2>/dev/null done "$@" then
+	done $(pwd) local --verbose
+	x=1 --verbose "$1" sed -eu cd cd export test local | then && readonly awk test grep
+	sed "$@" echo && "$@" $(pwd) 'quoted text' /usr/bin --verbose local
+printf $(pwd) sed then ${HOME} ${HOME} grep --verbose /usr/bin x=1 'quoted text'
+awk sed awk 'quoted text' test grep /usr/bin grep local "$@" echo export 2>/dev/null
+	-eu x=1 --verbose readonly test "$1" echo ${HOME} x=1
+		echo /usr/bin done $(pwd) -eu test /usr/bin sed awk --verbose
+		| awk awk test $(pwd) "$1" "$@"
+	cd grep && 2>/dev/null 'quoted text' cd
+		x=1 export cd local test test echo
+		printf 'quoted text' && $(pwd) | "$1" "$1" --verbose -eu printf done
+	--verbose echo -eu 'quoted text'
+-eu export grep 'quoted text' grep then /usr/bin /usr/bin awk awk sed
+"$1" local done && 2>/dev/null "$@" printf x=1 'quoted text' /usr/bin 'quoted text'
+	"$@" /usr/bin "$1" /usr/bin -eu 2>/dev/null
+	${HOME} sed 2>/dev/null export $(pwd) | --verbose
+	sed printf readonly -eu printf cd | echo then "$1" -eu ${HOME}
+		2>/dev/null done echo 'quoted text' $(pwd) cd x=1 done then
+		$(pwd) x=1 grep "$1" "$1" 'quoted text' printf -eu x=1 x=1 awk printf export
+x=1 | ${HOME} grep -eu done echo printf sed 2>/dev/null "$@" && && --verbose
+	"$@" && "$1" /usr/bin | sed
+${HOME} printf 2>/dev/null --verbose -eu | 2>/dev/null
+'quoted text' export awk sed --verbose $(pwd) $(pwd) cd sed done x=1 then "$@"
+	| printf done "$1" -eu sed local test --verbose test
+then "$@" readonly --verbose --verbose printf
+	awk readonly test local then sed sed test "$1"
+		printf awk test printf readonly grep export
+		grep export export x=1 2>/dev/null done local 2>/dev/null /usr/bin
+		grep done 'quoted text' local export $(pwd) test sed readonly
+	x=1 -eu 'quoted text' x=1 && sed awk echo then then cd $(pwd) export local
+awk ${HOME} done printf readonly
+-eu && | grep export printf
+		printf echo test printf sed
+local readonly export echo readonly printf sed then --verbose
+	grep sed 2>/dev/null cd awk test then
+		export | /usr/bin "$1" local local
+	export printf then awk test --verbose -eu
+sed "$@" local ${HOME} grep 'quoted text' && sed
+--verbose ${HOME} $(pwd) export test 2>/dev/null export $(pwd)
+test export "$@" /usr/bin "$@" awk "$@" 2>/dev/null --verbose 'quoted text'
+then -eu "$1" export "$@" | --verbose awk test test /usr/bin local "$@"
+	| then done "$1" sed export
+'quoted text' echo x=1 "$@" cd $(pwd) then cd && test /usr/bin
+${HOME} "$@" "$1" --verbose
+		/usr/bin | export --verbose /usr/bin 'quoted text' done 2>/dev/null awk x=1 ${HOME}
+		| && grep ${HOME} ${HOME} ${HOME} printf then echo sed done cd done
+	'quoted text' 'quoted text' echo done --verbose printf | $(pwd) echo $(pwd)
+		--verbose x=1 | ${HOME} 'quoted text'
+	done awk grep printf readonly then readonly --verbose "$@" echo "$@" then awk
+	${HOME} test printf test export readonly x=1 then 2>/dev/null
+	2>/dev/null && then $(pwd) "$1" $(pwd) echo
+	readonly && ${HOME} export
+		sed echo "$@" x=1 ${HOME} "$@" done
+local 'quoted text' readonly
+	done --verbose | done test done then /usr/bin -eu && x=1 "$@" |
+	printf test then grep echo $(pwd) export
+		grep echo then x=1 $(pwd) readonly
+test $(pwd) "$1" "$1" printf /usr/bin printf cd --verbose cd grep test $(pwd)
+		export cd grep grep local printf --verbose printf sed
+	readonly awk local grep $(pwd) "$@" ${HOME} cd cd --verbose echo echo test local
+	readonly done sed sed --verbose 'quoted text' printf grep local
+"$@" && done cd local grep echo && local done
+echo /usr/bin /usr/bin $(pwd) local test && --verbose
+		x=1 grep /usr/bin readonly cd readonly
+		printf echo export && "$1" /usr/bin x=1 cd then local echo export readonly
+	printf local then 2>/dev/null
+&& ${HOME} done --verbose awk /usr/bin --verbose export test | /usr/bin
+	--verbose ${HOME} local && -eu "$1" 2>/dev/null
+grep 'quoted text' done printf
+export awk export 'quoted text' --verbose
+	test | ${HOME} awk local x=1 then done test --verbose | export | local echo
+x=1 ${HOME} x=1 2>/dev/null | printf -eu "$1" "$@" cd "$@" $(pwd)
+		${HOME} 'quoted text' "$@" test
+		$(pwd) 2>/dev/null /usr/bin
+	-eu test readonly export sed printf printf
+	awk readonly -eu cd x=1 grep grep sed ${HOME} echo --verbose sed
+		${HOME} ${HOME} then grep | -eu cd cd --verbose /usr/bin ${HOME}
+'quoted text' "$1" test 2>/dev/null | export sed "$@"
+	'quoted text' | echo local grep --verbose printf test
+		${HOME} /usr/bin 2>/dev/null "$@" 2>/dev/null "$1" $(pwd) 'quoted text' sed
+printf done done --verbose -eu x=1 local "$1" grep
+		${HOME} $(pwd) done 'quoted text' readonly && && $(pwd)
+	/usr/bin 2>/dev/null awk 2>/dev/null
+		cd echo done && grep && done
+	/usr/bin cd awk $(pwd) --verbose test --verbose ${HOME}
+grep "$1" echo readonly export awk cd -eu sed echo
+	2>/dev/null /usr/bin echo "$1" /usr/bin --verbose grep test cd -eu 'quoted text'
+	2>/dev/null "$@" sed grep awk sed /usr/bin awk awk 'quoted text' test x=1 $(pwd)
+		&& ${HOME} printf $(pwd) 'quoted text' x=1 $(pwd) "$@" && --verbose
+echo /usr/bin local echo grep local then 2>/dev/null done
+cd echo echo test 2>/dev/null grep --verbose "$@" test sed printf /usr/bin "$@"
+	printf test printf done /usr/bin "$@"
+		done readonly /usr/bin && cd echo done printf printf export "$1" sed ${HOME} awk
+test then ${HOME} "$@" grep sed cd 'quoted text' && grep $(pwd)
+| readonly echo "$@" done | x=1 x=1 awk grep cd readonly 2>/dev/null
+	"$@" cd "$1" export printf grep echo --verbose $(pwd) 2>/dev/null printf
+	sed -eu && printf awk | grep then ${HOME} $(pwd)
+test test test 2>/dev/null
+-eu grep local && echo awk "$@" echo && $(pwd)
+	printf -eu /usr/bin cd $(pwd) /usr/bin test grep
+	| local export ${HOME} printf printf test 2>/dev/null export
+		cd then "$@" --verbose done
+grep then then x=1 grep readonly -eu && --verbose grep --verbose
+		export then test test cd x=1 "$1" "$@" | -eu -eu | ${HOME} then done grep
+sed local grep awk cd readonly
+		readonly test echo printf ${HOME} test && ${HOME} then
+		then then /usr/bin | x=1 $(pwd) then -eu 'quoted text' export "$1" grep "$1" -eu
+		/usr/bin awk done 2>/dev/null x=1 test && ${HOME} grep local 2>/dev/null 'quoted text'
+export $(pwd) readonly test $(pwd) cd cd done | awk --verbose test x=1
+	$(pwd) "$@" export awk $(pwd) -eu $(pwd) cd local 2>/dev/null
+cd | -eu cd $(pwd) printf 'quoted text' "$1"
+	| x=1 | "$1" sed -eu readonly
+#include c17.sh
+${HOME} 'quoted text' | grep 'quoted text' "$1" grep
+		done 2>/dev/null | cd awk ${HOME} $(pwd)
+'quoted text' $(pwd) 2>/dev/null -eu then
+		cd && done done test grep
+export awk x=1 "$@" export
+	echo "$1" grep x=1 awk
+		$(pwd) ${HOME} grep -eu && export | printf
+-eu grep 2>/dev/null cd --verbose printf readonly
+/usr/bin x=1 $(pwd) local -eu 'quoted text' -eu $(pwd) x=1 -eu grep && then
+		grep | export then 2>/dev/null --verbose ${HOME} /usr/bin readonly ${HOME} grep
+	${HOME} 2>/dev/null ${HOME} 'quoted text' done /usr/bin local test "$@"
+		&& export x=1 then ${HOME} 'quoted text' cd &&
+	x=1 cd awk export && && ${HOME}
+&& awk 'quoted text' "$@" && cd
+	"$@" $(pwd) 'quoted text' && --verbose done x=1 then "$1" &&
+	x=1 grep $(pwd) cd -eu local | 2>/dev/null | done 'quoted text'
+	grep grep -eu grep export /usr/bin then test export /usr/bin | awk then -eu
+		| "$1" ${HOME} 'quoted text'
+	x=1 "$@" readonly local
+		-eu $(pwd) 2>/dev/null 'quoted text'
+	'quoted text' && --verbose $(pwd) echo 2>/dev/null
+		${HOME} x=1 cd -eu x=1 "$@"
+	printf grep $(pwd) done /usr/bin awk ${HOME} "$@" | done export export -eu
+		x=1 then printf --verbose test /usr/bin sed | x=1 local $(pwd) "$@"
+		| --verbose local 2>/dev/null "$1" 2>/dev/null readonly then x=1 grep readonly
+		awk local done /usr/bin then $(pwd) local done && local -eu awk awk grep awk
+		then ${HOME} /usr/bin && echo then sed 2>/dev/null $(pwd) x=1 -eu "$1"
+printf 'quoted text' /usr/bin echo 2>/dev/null | /usr/bin | -eu test done echo test
+		export readonly printf test echo printf sed
+		echo ${HOME} /usr/bin echo readonly --verbose
+	printf sed test "$@" $(pwd) "$@" then then printf
+export | && && | x=1 readonly && "$1"
+	then "$1" done echo | | awk 2>/dev/null 'quoted text' printf /usr/bin /usr/bin
+grep ${HOME} export then ${HOME} --verbose &&
+		"$1" "$@" /usr/bin && echo x=1 done x=1 x=1 export
+export --verbose -eu local done export /usr/bin grep cd -eu done awk
+2>/dev/null done /usr/bin local && printf --verbose
+&& x=1 then x=1 "$1" && "$@"
+	"$1" "$@" /usr/bin ${HOME} && grep -eu printf
+	grep awk "$@" echo ${HOME} echo echo /usr/bin printf
+		'quoted text' | "$@" --verbose awk then -eu && local x=1 local echo export
+local test "$1" 'quoted text' echo test
+	"$1" "$1" echo export && printf ${HOME}
+x=1 readonly "$@" test then --verbose -eu
+	$(pwd) 2>/dev/null --verbose "$1" cd local grep local
+	x=1 done export printf -eu export grep readonly echo local ${HOME} /usr/bin then
+		${HOME} && done 'quoted text' grep $(pwd) test "$@" "$@" readonly
+		awk cd ${HOME} local "$@" done 'quoted text' export "$1" $(pwd)
+	"$1" local ${HOME} awk test "$@" sed 2>/dev/null
+"$1" /usr/bin cd export printf "$@" readonly then cd awk 'quoted text'
+		done local awk /usr/bin "$@" && "$1"
+	test done readonly then ${HOME} x=1 $(pwd) "$@"
+${HOME} --verbose -eu ${HOME} readonly ${HOME} /usr/bin ${HOME} $(pwd)
+		$(pwd) done "$1" 2>/dev/null -eu
+		| 2>/dev/null local "$1" printf export "$1" ${HOME} &&
+		${HOME} awk awk 'quoted text' ${HOME} $(pwd) done --verbose test
+		export local printf cd "$@" 'quoted text' "$@" 2>/dev/null "$1" ${HOME}
+	&& 'quoted text' 2>/dev/null
+		${HOME} ${HOME} | test 'quoted text' | 'quoted text' 'quoted text' && -eu "$@"
+echo "$@" -eu test echo x=1 x=1 "$1" "$@" local "$@" | $(pwd)
+echo && echo "$1" awk readonly readonly
+test | -eu | awk $(pwd) cd 'quoted text'
+printf --verbose -eu local export /usr/bin
+		--verbose -eu printf local "$@" 'quoted text' | "$1" sed sed test /usr/bin
+	$(pwd) then --verbose printf
+		'quoted text' done test ${HOME} --verbose 2>/dev/null echo "$@"
+'quoted text' /usr/bin echo
+grep local -eu sed ${HOME} printf test
+		2>/dev/null then 'quoted text' printf 'quoted text' | sed --verbose
+	'quoted text' local x=1 sed 'quoted text'
+	awk $(pwd) echo printf printf "$@" "$1" echo "$1" --verbose cd --verbose x=1 cd
+		2>/dev/null readonly sed "$@" local echo done "$1" grep echo done test test $(pwd)
+awk /usr/bin grep then test 'quoted text' && | 2>/dev/null awk echo sed
+done then -eu | export cd x=1 cd $(pwd) /usr/bin ${HOME} test echo /usr/bin
+		2>/dev/null $(pwd) done ${HOME} printf done done printf awk --verbose ${HOME}
+		echo done sed awk echo x=1
+sed | $(pwd) test --verbose grep then 'quoted text'
+		done sed export readonly sed sed grep 'quoted text'
+readonly x=1 test "$@" sed --verbose && export
+		x=1 --verbose /usr/bin ${HOME} test
+done export export readonly cd $(pwd) awk echo /usr/bin 2>/dev/null
+		'quoted text' | printf | "$@" awk 2>/dev/null
+		"$@" 2>/dev/null echo done
+	readonly local printf /usr/bin x=1 local
+then cd --verbose "$1" then $(pwd) "$@" grep awk -eu grep
+-eu export export done echo then done printf then test ${HOME}
+		sed ${HOME} export then 'quoted text' done test ${HOME}
+awk 2>/dev/null printf /usr/bin
+		then $(pwd) done awk 2>/dev/null local export
+	| cd printf /usr/bin ${HOME}
+"$1" x=1 done local awk -eu done
+		/usr/bin 'quoted text' test test | $(pwd) x=1 local /usr/bin
+		2>/dev/null -eu $(pwd) sed printf printf readonly echo --verbose | "$1"
+		then | -eu "$1" --verbose export grep
+		-eu ${HOME} sed 2>/dev/null export echo then echo echo local
+		readonly awk sed && sed | cd local local test
+		/usr/bin echo --verbose "$@"
+		--verbose test test test x=1 --verbose
+	awk grep export x=1 x=1 echo "$1" --verbose --verbose ${HOME} awk "$1" awk grep
+grep readonly awk grep readonly awk && sed | then export ${HOME}
+		'quoted text' cd $(pwd) /usr/bin ${HOME} && 2>/dev/null
+		grep x=1 then | grep "$1" --verbose x=1 sed readonly
+printf awk /usr/bin printf 2>/dev/null 'quoted text' | $(pwd) "$1" export
+sed printf awk awk sed echo local awk cd "$@"
+sed "$1" "$@" 'quoted text' --verbose 2>/dev/null ${HOME} test "$1" ${HOME}
+		awk sed "$@" 'quoted text'
+		| 2>/dev/null | local /usr/bin ${HOME} readonly -eu then done
+--verbose grep "$1" sed ${HOME} ${HOME}
+	-eu printf ${HOME} /usr/bin -eu local awk x=1
+cd && done export then -eu local 2>/dev/null printf grep --verbose
+	awk 2>/dev/null cd test export printf | $(pwd) | &&
+	"$1" echo export --verbose cd local grep readonly | awk /usr/bin
+		test echo --verbose awk /usr/bin $(pwd)
+	done export test $(pwd) -eu done local -eu "$@" /usr/bin
+	--verbose ${HOME} sed grep x=1 done
+	'quoted text' export x=1 && "$1" then then local grep
+		${HOME} -eu x=1 test && && printf
+	${HOME} readonly then export "$@" then export && cd "$@" | -eu done ${HOME} sed
+done local 2>/dev/null -eu /usr/bin && -eu printf
+	echo export "$@" echo local x=1 cd $(pwd) echo "$@" --verbose /usr/bin cd test
+export "$1" done cd -eu $(pwd) /usr/bin 2>/dev/null sed && awk --verbose
+		readonly "$1" 2>/dev/null ${HOME} grep grep /usr/bin "$@" --verbose echo /usr/bin
+	$(pwd) -eu /usr/bin x=1 sed done
+		awk then 2>/dev/null | local && --verbose done "$@" x=1 "$@" export test
+		awk done ${HOME} ${HOME} local then test local grep cd
+		grep export 2>/dev/null done local x=1 local --verbose 'quoted text' test local
+printf /usr/bin "$1" $(pwd) test cd then echo ${HOME} awk echo done export --verbose
+-eu | awk && /usr/bin awk local $(pwd) --verbose test then | cd
+	done grep 'quoted text' grep
+"$@" -eu /usr/bin 'quoted text'
+${HOME} cd echo && then cd test echo local grep /usr/bin 'quoted text' &&
+| local local --verbose sed printf awk
+	${HOME} awk printf && | cd awk sed cd test "$@" --verbose done
+		--verbose | /usr/bin awk && x=1 'quoted text' export --verbose export awk 'quoted text'
+		done awk export /usr/bin echo export echo local
+done readonly cd printf ${HOME} ${HOME} cd /usr/bin export x=1 test cd "$@" done
+		${HOME} sed 2>/dev/null 2>/dev/null
+$(pwd) sed printf "$@" local "$1" -eu /usr/bin local
+		-eu --verbose ${HOME} done printf test grep export
+		${HOME} ${HOME} export awk ${HOME} 2>/dev/null && --verbose then echo awk
+		| ${HOME} printf echo ${HOME} -eu --verbose test
+	cd awk grep sed "$1" local -eu grep readonly --verbose 'quoted text' "$@" "$1"
+		printf -eu "$1" ${HOME} ${HOME} readonly
+	awk echo x=1 cd x=1 export export sed local "$@" && test -eu sed readonly
+	"$@" awk -eu echo ${HOME} x=1 -eu readonly 2>/dev/null echo
+	test ${HOME} done && | sed awk export test | | test printf && /usr/bin
+readonly awk printf "$1" cd /usr/bin local awk 2>/dev/null
+		/usr/bin | | then 2>/dev/null 'quoted text' "$1" x=1 && printf
+"$@" printf printf "$@" ${HOME} "$1" readonly "$1" awk
+	echo cd --verbose grep grep "$@" local "$1"
+readonly ${HOME} grep ${HOME} x=1 then 2>/dev/null readonly
+local | cd ${HOME} /usr/bin | ${HOME}
+		| /usr/bin sed then grep then
+		awk 2>/dev/null "$1" then 2>/dev/null "$1" then printf
+		'quoted text' x=1 sed 'quoted text' awk
+then 'quoted text' grep printf export x=1 cd grep 2>/dev/null
+-eu readonly local test cd cd sed sed $(pwd) test printf
+	readonly 2>/dev/null "$@" export "$@" "$1" "$@"
+	echo local --verbose $(pwd) grep 'quoted text' && readonly awk
+then echo 2>/dev/null | 'quoted text' $(pwd) $(pwd)
+awk /usr/bin "$@" awk then 2>/dev/null
+		--verbose | cd 2>/dev/null cd done ${HOME} x=1 done | cd grep
+		"$1" --verbose | readonly echo 'quoted text'
+	--verbose printf --verbose cd cd | 'quoted text' x=1 awk
+		awk awk printf echo grep grep 'quoted text' && grep | /usr/bin
+	sed cd "$1" local local 'quoted text' grep local
+2>/dev/null 'quoted text' done readonly
+--verbose test then /usr/bin then grep echo /usr/bin
+--verbose local "$1" test grep
+	grep 2>/dev/null && then | done $(pwd) /usr/bin sed local
+	| echo printf awk -eu 2>/dev/null
+	--verbose then awk awk
+-eu echo && 'quoted text' then "$@" export ${HOME} 'quoted text' test grep 'quoted text'
+		local readonly local
+	| --verbose && 2>/dev/null test "$1" $(pwd) sed $(pwd) "$@" /usr/bin 2>/dev/null
+2>/dev/null "$1" readonly
+		"$@" "$1" echo && && readonly
+		-eu readonly echo -eu x=1 then -eu local readonly local
+echo && printf export export 'quoted text' "$1" test sed -eu
+	then export awk echo --verbose export "$@" "$1" echo
+	/usr/bin cd ${HOME} awk && sed printf test
+	x=1 echo x=1 -eu awk --verbose
+		test sed printf --verbose sed /usr/bin --verbose | printf then then 2>/dev/null
+echo readonly "$@" then 2>/dev/null then then sed 2>/dev/null "$@" export
+		grep sed cd 2>/dev/null /usr/bin then "$@" -eu ${HOME} export --verbose /usr/bin
+'quoted text' --verbose -eu sed 2>/dev/null --verbose awk /usr/bin
+	cd && $(pwd) sed /usr/bin ${HOME} done
+		'quoted text' sed /usr/bin export $(pwd) test done readonly
+&& x=1 -eu printf test printf grep echo readonly readonly ${HOME} grep cd
+	then then done test then echo echo sed echo done --verbose && 2>/dev/null then
+	export -eu 2>/dev/null "$@" | 2>/dev/null done
+		sed -eu grep done "$1" -eu readonly test awk -eu export
+	'quoted text' done && sed
+${HOME} done grep echo local "$@" readonly && --verbose
+		test $(pwd) && export awk test 2>/dev/null -eu /usr/bin
+		--verbose 'quoted text' 'quoted text' grep
+	test $(pwd) export grep done
+grep printf $(pwd) 2>/dev/null $(pwd) cd sed x=1 sed then sed --verbose "$@"
+	printf grep sed echo 'quoted text' test && 'quoted text' printf cd
+		readonly -eu --verbose
+then "$1" awk "$1" readonly
+awk 2>/dev/null test "$1" echo
+	"$1" done 'quoted text' awk 2>/dev/null
+| cd echo x=1 echo 'quoted text' printf export local x=1
+readonly done 'quoted text'
+		awk && test ${HOME} echo 2>/dev/null printf export "$@" "$1" 'quoted text' local
+		export printf readonly readonly ${HOME} then grep cd printf /usr/bin --verbose
+		| test | -eu 2>/dev/null ${HOME} -eu | $(pwd) cd sed
+	-eu echo test test x=1 echo awk ${HOME} /usr/bin && "$@" cd awk x=1 ${HOME}
+	done x=1 "$@" -eu cd grep x=1 --verbose && && sed grep awk printf
+"$1" cd test test local
+	"$@" --verbose awk then
+sed | sed echo readonly printf printf
+	done 'quoted text' 2>/dev/null printf grep /usr/bin echo local printf -eu
+&& 'quoted text' grep ${HOME} local "$@" 'quoted text'
+		cd --verbose | -eu done --verbose readonly
+		then 'quoted text' 'quoted text'
+printf | x=1 then ${HOME} x=1 readonly "$1" && done cd 'quoted text'
+		awk echo grep | local local -eu x=1 echo /usr/bin local x=1 -eu cd
+2>/dev/null && export test echo x=1 && cd ${HOME}
+		"$@" $(pwd) export x=1 /usr/bin 2>/dev/null /usr/bin 'quoted text'
+		printf "$1" 'quoted text' ${HOME} /usr/bin
+	sed readonly ${HOME} ${HOME}
+	"$@" $(pwd) awk 'quoted text'
+-eu local && export && awk grep grep
+| printf done 'quoted text'
+"$1" "$@" done then ${HOME}
+		test cd awk grep awk awk $(pwd) && x=1 echo readonly
+	x=1 | grep done grep /usr/bin echo local "$@"
+	export echo -eu echo sed /usr/bin x=1 readonly grep then readonly then
+		| -eu export --verbose --verbose grep 2>/dev/null
+		--verbose "$@" readonly sed $(pwd) | ${HOME} local ${HOME} local
+'quoted text' && cd --verbose
+		"$@" export awk && -eu then --verbose done x=1 local done ${HOME}
+sed local "$1" readonly local
+	readonly $(pwd) printf done $(pwd) then /usr/bin
+done -eu $(pwd) readonly "$1" echo awk echo "$@" 'quoted text' done
+echo /usr/bin $(pwd) printf /usr/bin export printf ${HOME} readonly export
+	readonly printf /usr/bin sed 'quoted text'
+printf awk done 2>/dev/null -eu test ${HOME} x=1 then export | ${HOME}
+${HOME} "$@" && export "$@" --verbose "$@" /usr/bin
+	then local ${HOME} done then -eu | 'quoted text' sed export
+echo awk && printf && $(pwd) cd | awk 'quoted text' readonly
+cd 2>/dev/null test ${HOME} 2>/dev/null -eu -eu && awk $(pwd) --verbose /usr/bin
+		cd grep cd 2>/dev/null | $(pwd) readonly 'quoted text' echo
+		then test $(pwd) then then export local && && "$@" sed ${HOME} "$1" | && --verbose
+	sed -eu cd cd "$@" --verbose &&
+	${HOME} export readonly "$1" echo
+	&& cd printf $(pwd) printf 2>/dev/null awk awk printf -eu --verbose local
+		sed -eu $(pwd) /usr/bin echo export $(pwd) then echo && done then done printf
+echo echo awk "$1" ${HOME} "$1" && 2>/dev/null printf cd |
+		x=1 x=1 --verbose printf -eu
+	cd echo grep printf "$@" "$1" sed "$1" | x=1 && sed "$@" --verbose
+	sed 2>/dev/null awk test
+		${HOME} -eu export local x=1 local /usr/bin
+		printf && x=1 test cd readonly
+	grep grep sed 2>/dev/null ${HOME} x=1 sed "$@" $(pwd) 2>/dev/null
+		'quoted text' sed test
+	local 'quoted text' printf "$1" ${HOME} --verbose
+	$(pwd) test export sed echo
+echo 2>/dev/null && cd | then local |
+"$@" $(pwd) echo --verbose && echo readonly
+		x=1 --verbose ${HOME} grep local awk "$1"
+"$@" "$@" echo ${HOME} | "$1" "$1" /usr/bin
+	'quoted text' then done test "$1" echo 2>/dev/null
+sed /usr/bin --verbose "$@" test --verbose
+local then && "$@" test /usr/bin "$1" &&
+	echo echo $(pwd) | echo --verbose ${HOME}
+	'quoted text' local done sed 'quoted text' /usr/bin export
+		| x=1 'quoted text' && cd sed 'quoted text' done && readonly grep done then x=1
+		awk -eu grep $(pwd) /usr/bin "$@" 2>/dev/null $(pwd) printf 2>/dev/null
+		--verbose done && local sed $(pwd) export | sed then readonly sed awk readonly
+--verbose then export ${HOME}
+		${HOME} | "$1" export 'quoted text' echo local /usr/bin awk "$1"
+	"$1" then awk export sed echo "$1" echo sed "$@" done x=1
+	/usr/bin cd awk printf printf 'quoted text' $(pwd) $(pwd) awk 2>/dev/null
+		$(pwd) | x=1 2>/dev/null | done cd done && $(pwd) "$@" ${HOME}
+		'quoted text' $(pwd) export -eu grep awk echo then readonly echo
+		2>/dev/null cd && export echo | $(pwd) cd 'quoted text'
+		x=1 local x=1 test sed x=1 "$@" --verbose
+local cd $(pwd) && printf "$1" local cd | printf
+		x=1 "$1" export echo done printf | export done then -eu cd
+		| cd -eu sed "$@" --verbose cd done 2>/dev/null 'quoted text' x=1
+		&& --verbose echo "$@" && awk 2>/dev/null readonly
+	| /usr/bin readonly --verbose test
+		2>/dev/null "$1" grep done /usr/bin
+cd then | done cd export "$@" local x=1 $(pwd)
+		done then sed sed "$1" then /usr/bin
+test x=1 local printf grep printf 2>/dev/null
+cd test grep awk /usr/bin grep done $(pwd) -eu ${HOME}
+	printf /usr/bin export printf sed "$@" x=1 local /usr/bin $(pwd) sed --verbose
+		--verbose done readonly x=1
+--verbose $(pwd) -eu test grep x=1 test $(pwd)
+	sed --verbose -eu "$1" /usr/bin awk awk $(pwd)
+		printf --verbose -eu test local /usr/bin export sed local then
+	--verbose x=1 cd -eu cd --verbose test printf
+	sed done && 2>/dev/null sed sed then export --verbose -eu --verbose
+'quoted text' --verbose "$@" && x=1 --verbose sed 2>/dev/null ${HOME} /usr/bin
+/usr/bin && | awk $(pwd) ${HOME} /usr/bin /usr/bin export
+	/usr/bin echo ${HOME} printf /usr/bin cd ${HOME} readonly && "$1" cd
+		sed export && done $(pwd) awk done
+grep cd $(pwd) $(pwd) -eu
+"$@" then grep printf -eu
+	-eu awk printf echo export /usr/bin
+x=1 "$@" ${HOME} export test /usr/bin $(pwd) --verbose
+	cd grep "$@" "$1" done readonly then "$@" local done "$1"
+	"$1" 2>/dev/null then $(pwd) 'quoted text' grep test "$1" "$1" printf
+		&& "$@" "$@" $(pwd) && echo readonly x=1 | |
+	echo $(pwd) 2>/dev/null ${HOME} echo cd
+		'quoted text' && echo "$@" sed 'quoted text' && readonly "$1" "$@" awk grep
+	local 'quoted text' 2>/dev/null
+	2>/dev/null -eu "$1" --verbose ${HOME} 'quoted text'
+	--verbose export echo x=1 cd /usr/bin
+	/usr/bin awk -eu local cd ${HOME}
+		$(pwd) export -eu awk test echo
+		export then 'quoted text' x=1 done --verbose export
+	then && ${HOME} /usr/bin printf grep ${HOME} "$@"
+grep && "$@" cd | $(pwd) cd test echo test printf then sed local
+cd && local local && cd | awk | x=1 readonly cd printf x=1 -eu
+	--verbose 2>/dev/null --verbose && 'quoted text'
+		'quoted text' "$@" 'quoted text' awk done
+readonly export export | sed --verbose printf awk $(pwd) && "$@" awk local
+	test cd printf grep printf test grep 2>/dev/null "$1" grep
+printf then local $(pwd)
+	export awk awk 'quoted text' 'quoted text' --verbose "$1" done done
+		export "$@" -eu test x=1 then 'quoted text' /usr/bin
+	cd local local | test done 'quoted text' test "$1" grep then then echo
+	x=1 local "$1" && local
+	echo ${HOME} grep then readonly | local && && test -eu echo then x=1
+	sed cd /usr/bin x=1 "$@" printf -eu "$1" export 2>/dev/null && printf "$@" readonly
+	then "$1" x=1 /usr/bin ${HOME} local "$@"
+readonly local echo done local sed "$1" "$@"
+	/usr/bin /usr/bin && then test sed -eu
+		${HOME} 'quoted text' readonly | local | /usr/bin
+	2>/dev/null "$@" echo 2>/dev/null local
+grep && -eu $(pwd) test --verbose grep export cd "$1" 'quoted text'
+	export ${HOME} 2>/dev/null cd 2>/dev/null 'quoted text' --verbose echo echo
+		cd export readonly printf readonly export x=1 --verbose x=1
+		local awk echo x=1 awk local ${HOME} /usr/bin 2>/dev/null
+		sed done test cd | 'quoted text' export grep then
+"$1" printf echo printf x=1 'quoted text' "$@"
+echo && ${HOME} export $(pwd) printf x=1 local awk
+	done done cd x=1 readonly done export 'quoted text' ${HOME} echo
+"$@" --verbose test /usr/bin echo -eu done x=1 export -eu 2>/dev/null
+	| $(pwd) printf sed then test
+"$1" grep x=1 "$@" grep printf | local 2>/dev/null
+		then | echo export sed readonly local && /usr/bin "$1"
+		readonly --verbose awk ${HOME}
+		printf test done "$@" cd grep ${HOME} test printf x=1 | 'quoted text'
+	"$@" --verbose grep && "$@"
+'quoted text' sed 'quoted text' done "$1" local grep
+		${HOME} "$@" grep then test | /usr/bin done | export
+		awk cd ${HOME} $(pwd) "$@" awk sed cd then echo
+		local "$@" $(pwd) then cd readonly && x=1 readonly sed 2>/dev/null local
+	printf 'quoted text' ${HOME} && "$1" $(pwd) export "$1"
+local echo done /usr/bin cd ${HOME} awk "$@" | "$@" test 'quoted text' awk
+	$(pwd) $(pwd) printf "$1" echo awk ${HOME} grep sed done cd echo printf
+		| --verbose then -eu grep
+		'quoted text' "$1" printf --verbose done export test ${HOME} 2>/dev/null sed
+	"$1" /usr/bin readonly 'quoted text'
+	export 'quoted text' grep test ${HOME} ${HOME} | --verbose sed
+	--verbose 2>/dev/null "$1" -eu then done printf "$1" grep -eu awk
+	-eu 'quoted text' && awk && x=1 "$@" --verbose readonly -eu "$@" echo then
+$(pwd) 2>/dev/null $(pwd) test -eu /usr/bin ${HOME} cd "$@" export ${HOME}
+	then then | x=1 test local /usr/bin export then ${HOME} /usr/bin "$@"
+	'quoted text' awk -eu x=1 echo export
+	done sed grep "$@" echo sed ${HOME} done $(pwd) ${HOME}
+	x=1 cd echo echo test /usr/bin then echo && "$1" then
+sed -eu $(pwd) test /usr/bin 2>/dev/null echo -eu export /usr/bin
+	"$1" 2>/dev/null local | cd -eu $(pwd) && done
+	${HOME} 2>/dev/null grep ${HOME} x=1 printf
+		local echo "$@" "$@" /usr/bin sed "$1" test "$@" 'quoted text' awk --verbose 'quoted text'
+	--verbose && x=1 --verbose sed /usr/bin $(pwd) echo ${HOME} /usr/bin export
+2>/dev/null "$1" export then
+	readonly readonly | -eu echo ${HOME} ${HOME} -eu local cd export ${HOME}
+grep --verbose && printf done
+		done "$@" local export --verbose "$1" $(pwd) "$@" -eu awk readonly
+		x=1 2>/dev/null && done
+readonly echo printf && -eu
+$(pwd) $(pwd) cd ${HOME} awk done x=1 2>/dev/null local cd --verbose "$1" | grep
+awk "$@" 'quoted text' cd sed ${HOME} "$1" "$@"
+local 'quoted text' ${HOME} /usr/bin 2>/dev/null /usr/bin "$1" "$1" $(pwd) export
+	2>/dev/null 2>/dev/null "$1" "$1" $(pwd) test
+	local export 'quoted text' "$@" x=1 x=1 done grep test export test cd --verbose
+		-eu $(pwd) done echo x=1 2>/dev/null then
+	'quoted text' 2>/dev/null grep test awk /usr/bin --verbose
+	test grep awk done local local sed test "$@"
+		then export && readonly | sed printf 2>/dev/null printf
+	/usr/bin local 2>/dev/null grep echo then sed /usr/bin "$1" sed printf grep
+		cd 2>/dev/null test x=1 echo --verbose x=1 awk local done
+	then cd echo ${HOME} "$@"
+x=1 test awk x=1 ${HOME} readonly sed cd local
+		"$1" "$1" && $(pwd) --verbose
+echo x=1 && test awk test "$1" "$@" sed | readonly local then
+sed export /usr/bin $(pwd) $(pwd) printf echo
+&& local --verbose "$@" /usr/bin -eu done /usr/bin /usr/bin
+awk ${HOME} test sed export local local local then test --verbose
+echo test "$@" $(pwd) "$1" readonly "$1" echo -eu printf test echo test 2>/dev/null
+		&& printf export | ${HOME} "$@" --verbose
+${HOME} local export printf 2>/dev/null | "$@" $(pwd)
+	then then local && | test --verbose export --verbose sed echo test $(pwd)
+	2>/dev/null && | cd | 2>/dev/null 'quoted text' | then
+		test x=1 cd echo local 2>/dev/null local local /usr/bin && awk $(pwd) printf
+export test cd readonly printf printf cd cd cd printf grep | export
+	&& ${HOME} && grep ${HOME} cd export awk ${HOME}
+		local local export ${HOME} local $(pwd) export
+	printf --verbose -eu readonly "$1" local && | 'quoted text'
+	cd 2>/dev/null 'quoted text' readonly && x=1 "$1" $(pwd)
+	awk && && && test test then /usr/bin sed grep /usr/bin ${HOME} 2>/dev/null
+	local cd echo then "$1" printf /usr/bin local -eu
+	${HOME} "$@" done 2>/dev/null
+		export local echo --verbose readonly readonly /usr/bin --verbose
+'quoted text' ${HOME} 2>/dev/null then
+export readonly && grep x=1 $(pwd)
+grep sed local --verbose --verbose cd export export test
+		-eu cd grep export grep test /usr/bin | printf ${HOME}
+	&& readonly -eu printf
+'quoted text' grep /usr/bin -eu test "$1" grep $(pwd) ${HOME} "$@"
+	done 2>/dev/null 'quoted text' 'quoted text' | 'quoted text'
+	| local cd local test done
+	grep then "$1" $(pwd) awk "$@" readonly
+		done test sed "$@" -eu "$@" export "$1" -eu x=1
+	awk "$@" x=1 -eu ${HOME} printf /usr/bin local 2>/dev/null sed export
+	export test cd done x=1 ${HOME} printf x=1 && 2>/dev/null awk
+	'quoted text' 2>/dev/null 'quoted text' export 2>/dev/null $(pwd) then readonly
+echo echo cd --verbose then "$@" 'quoted text' ${HOME} x=1 | test $(pwd) /usr/bin
+		"$1" && --verbose echo | | grep && then awk grep 2>/dev/null cd && export "$1"
+readonly /usr/bin $(pwd) "$1"
+$(pwd) $(pwd) test test sed $(pwd)
+then grep 2>/dev/null -eu sed "$@" --verbose && -eu -eu readonly $(pwd)
+	printf && export $(pwd) sed /usr/bin sed "$@"
+	| test "$1" grep /usr/bin --verbose
+		test test 2>/dev/null readonly
+		grep ${HOME} | done "$@" /usr/bin && ${HOME}
+		"$@" x=1 grep done readonly then readonly
+	printf echo sed test grep --verbose grep printf grep 'quoted text'
+"$@" "$@" test "$@" 2>/dev/null
+		'quoted text' printf "$@" && && ${HOME} local sed
+		${HOME} done x=1 awk export grep "$@" then then | 'quoted text' grep echo
+	done export local then | then x=1 ${HOME} then $(pwd) $(pwd) sed
+		export local -eu "$1"
+	2>/dev/null | done && $(pwd) 'quoted text'
+	done && echo grep cd | echo "$1" -eu x=1 test test && awk printf ${HOME} "$@"
+	-eu | /usr/bin grep 'quoted text' 'quoted text' cd -eu "$@" 2>/dev/null
+		--verbose test printf x=1 && "$@" && cd readonly "$1"
+	export local sed "$@" -eu done readonly $(pwd) cd && sed && && ${HOME}
+		"$@" sed local "$@" 'quoted text' cd then
+	| readonly cd readonly printf 2>/dev/null printf | --verbose readonly "$@" x=1
+local -eu local x=1 "$@" cd --verbose awk done /usr/bin cd "$@"
+	export export "$1" printf sed printf /usr/bin /usr/bin then export
+printf $(pwd) -eu local --verbose printf export 'quoted text'
+		&& $(pwd) then test awk then -eu && x=1 /usr/bin && grep "$@" sed readonly
+"$@" sed | x=1 | | test -eu 2>/dev/null test export
+printf | "$@" awk 'quoted text' then test
+		done /usr/bin "$1" x=1 'quoted text' echo 2>/dev/null
+cd done local export sed cd awk 'quoted text' local "$@" /usr/bin grep then
+local grep cd "$@" printf sed /usr/bin then done grep 2>/dev/null $(pwd) 'quoted text'
+		printf 2>/dev/null 'quoted text' x=1
+		2>/dev/null awk 'quoted text' | /usr/bin | done /usr/bin cd "$@"
+	awk local | awk echo && readonly sed test test test && x=1 2>/dev/null
+	local --verbose export export && test local grep --verbose grep &&
+$(pwd) done done 2>/dev/null then printf readonly awk x=1 cd awk --verbose done
+		sed readonly 'quoted text'
+		2>/dev/null done | x=1 -eu grep
+	&& sed local awk sed -eu done test ${HOME} awk done test "$@"
+		test cd -eu -eu "$@" echo 2>/dev/null | local readonly local
+2>/dev/null local export local sed "$@" grep --verbose awk
+		sed sed grep test printf --verbose && printf awk 2>/dev/null ${HOME}
+	printf cd readonly 'quoted text' export -eu cd --verbose
+		export awk 2>/dev/null && printf "$1" cd grep cd x=1 printf sed "$1"
+		/usr/bin printf -eu sed && cd "$1" "$@" printf "$@" then then export
+done -eu test 2>/dev/null | "$1" -eu then 'quoted text' grep then /usr/bin
+'quoted text' echo "$@" sed ${HOME}
+		awk && $(pwd) cd sed $(pwd)
+		-eu local then -eu 2>/dev/null | "$1" /usr/bin local 'quoted text' -eu grep
+		test echo "$1" $(pwd) echo export local 'quoted text' $(pwd) test sed 2>/dev/null
+		export readonly x=1 -eu sed sed
+grep readonly /usr/bin "$@" -eu x=1 --verbose then /usr/bin
+test ${HOME} awk sed local readonly
+"$1" ${HOME} printf "$@" x=1 readonly
+	/usr/bin then grep then test then
+	cd grep "$@" export "$1" $(pwd) | -eu export -eu --verbose
+$(pwd) $(pwd) done sed /usr/bin awk local "$1" "$1"
+		'quoted text' 2>/dev/null export printf printf printf $(pwd)
+-eu awk ${HOME} "$@" "$@" local ${HOME} -eu local done --verbose
+		then "$@" /usr/bin "$1" export printf printf echo ${HOME} export
+	"$1" echo awk done x=1 cd
+		printf x=1 "$1" sed -eu then
+		printf sed printf $(pwd) x=1 --verbose 2>/dev/null
+${HOME} printf 'quoted text' /usr/bin grep 2>/dev/null && 'quoted text' 2>/dev/null
+"$1" /usr/bin x=1 test /usr/bin ${HOME} "$@"
+&& && cd sed local && export done then -eu | --verbose then --verbose && | -eu
+	${HOME} /usr/bin echo readonly
+2>/dev/null local $(pwd) "$@" export /usr/bin echo 'quoted text'
+		"$@" x=1 printf $(pwd) --verbose readonly
+		"$@" "$@" ${HOME} local local done ${HOME} then cd awk awk | awk
+done | "$@" 'quoted text' grep
+x=1 'quoted text' "$1"
+	sed echo printf cd -eu local grep test test export
+	| sed then readonly 'quoted text' -eu cd local /usr/bin readonly
+		printf | printf cd then /usr/bin
+	-eu printf && printf printf 2>/dev/null 2>/dev/null grep echo $(pwd)
+2>/dev/null test export --verbose && ${HOME} cd "$@"
+		${HOME} "$1" grep $(pwd) | /usr/bin "$1" awk -eu | "$@" cd
+	printf echo && export 'quoted text' grep readonly
+"$@" printf && sed echo export done then | | --verbose /usr/bin test
+		awk then then "$@" 2>/dev/null grep x=1 local x=1 x=1
+	x=1 printf cd grep cd then
+done sed awk then grep cd done && readonly test "$@" done
+	printf && printf "$1" /usr/bin && 2>/dev/null echo echo cd | sed
+echo local cd test | "$1" readonly cd local echo
+test --verbose awk done "$@" | readonly local export
+x=1 echo 2>/dev/null 2>/dev/null "$@" then
+	sed cd 2>/dev/null 'quoted text' done | ${HOME}
+test "$@" grep test --verbose -eu
+	$(pwd) | export then && local local
+sed awk test x=1 then grep then echo awk 'quoted text' x=1
+		cd readonly cd x=1 x=1 $(pwd) done cd ${HOME} cd
+	&& awk 2>/dev/null export 'quoted text' sed
+	readonly grep --verbose then
+readonly 2>/dev/null "$@" awk echo $(pwd)
+-eu grep -eu ${HOME} printf local /usr/bin ${HOME} local done && done
+2>/dev/null test local "$1" local
+	sed readonly readonly x=1 && | printf test 'quoted text'
+	readonly $(pwd) printf readonly &&
+then then export ${HOME} cd echo awk grep export readonly
+		&& --verbose "$@" test --verbose 2>/dev/null
+cd readonly /usr/bin test 'quoted text' -eu
+export $(pwd) | 2>/dev/null
+		-eu done -eu x=1 printf printf awk && "$1" sed /usr/bin
+sed | echo 2>/dev/null cd "$1" x=1 awk /usr/bin readonly then 2>/dev/null
+		/usr/bin 2>/dev/null /usr/bin echo test test
+		"$1" local awk export local
+		"$1" | x=1 /usr/bin done echo done && then done | awk --verbose readonly ${HOME}
+	--verbose "$1" readonly -eu "$@"
+	${HOME} && | "$1" sed && && grep
+	-eu test printf readonly local test "$1" 2>/dev/null x=1 echo export "$@" x=1
+| "$@" "$1" local -eu echo test sed export "$1" "$1" 'quoted text'
+$(pwd) x=1 sed | 'quoted text' | cd $(pwd) awk
+	grep awk test "$@" /usr/bin
+test grep export 'quoted text' --verbose x=1 "$@" awk then
+		x=1 awk | 'quoted text' awk 'quoted text'
+		printf --verbose x=1 sed printf | grep local grep echo grep 2>/dev/null
+		done done cd 'quoted text' /usr/bin $(pwd) awk printf grep | x=1 $(pwd) | "$1"
+		-eu awk x=1 "$1" test 'quoted text' ${HOME} -eu readonly grep echo local
+		local awk awk printf /usr/bin grep 2>/dev/null cd done "$@" test /usr/bin then
+then readonly sed "$@" 2>/dev/null local awk -eu "$1" readonly awk
+		readonly | 'quoted text' && ${HOME}
+	sed cd --verbose test export sed -eu then | cd 'quoted text'
+		--verbose "$@" then ${HOME} sed grep cd awk /usr/bin "$1" /usr/bin test done /usr/bin
+		sed done "$@" cd done x=1 | export /usr/bin 2>/dev/null
+$(pwd) sed test -eu grep "$1" 2>/dev/null done
+		grep /usr/bin export $(pwd) readonly
+	"$1" $(pwd) $(pwd) cd done sed grep echo echo echo printf
+	-eu then printf | -eu echo
+		grep then then printf 2>/dev/null readonly sed export "$1" then --verbose
+then --verbose 2>/dev/null "$1" /usr/bin
+"$1" "$1" && $(pwd) sed export $(pwd) done --verbose
+	"$1" test | test -eu test x=1 /usr/bin --verbose "$1"
+local -eu local export awk "$@"
+	export sed echo ${HOME} readonly --verbose test grep "$1" readonly 'quoted text'
+	readonly --verbose printf | $(pwd) grep then | test $(pwd) x=1 -eu
+		done --verbose awk 2>/dev/null
+		x=1 2>/dev/null readonly awk "$@" test x=1 -eu done | 2>/dev/null
+| x=1 | awk echo /usr/bin ${HOME} | "$1" printf $(pwd) test
+	sed $(pwd) | then | "$@" && "$1" | echo cd sed "$1" awk $(pwd) x=1 export && x=1
+cd awk export echo ${HOME} export "$1" | sed sed $(pwd) && 2>/dev/null
+		&& 2>/dev/null | --verbose -eu printf readonly
+	-eu readonly cd echo $(pwd) -eu ${HOME} local && grep 'quoted text'
+	2>/dev/null 2>/dev/null then && local 'quoted text'
+	awk -eu awk cd awk printf sed x=1
+	/usr/bin "$@" done local && export ${HOME}
+	then awk grep grep 2>/dev/null cd 2>/dev/null awk "$1"
+"$@" /usr/bin && local 2>/dev/null 2>/dev/null then awk x=1 done export x=1 -eu
+cd sed echo readonly grep printf /usr/bin
+test then cd test ${HOME} awk x=1
+		printf local readonly printf local then sed test ${HOME} printf $(pwd) --verbose
+&& export /usr/bin 2>/dev/null 2>/dev/null printf grep /usr/bin &&
+	grep $(pwd) grep done ${HOME} ${HOME} printf awk x=1 "$1" sed
+	local grep sed export awk x=1 && -eu 2>/dev/null /usr/bin
+		then printf readonly && 2>/dev/null "$1" then 'quoted text' && export
+		2>/dev/null test x=1 sed /usr/bin echo "$@" 'quoted text' local
+	then cd ${HOME} printf x=1 -eu "$@" 2>/dev/null printf printf x=1 'quoted text'
+		local "$@" x=1 then x=1 2>/dev/null readonly --verbose grep | sed
+		echo | --verbose 'quoted text' $(pwd) 2>/dev/null
+		x=1 readonly cd && grep 2>/dev/null
+&& test echo export 2>/dev/null
+| --verbose echo cd && ${HOME} -eu awk done grep test local awk ${HOME}
+		local grep printf ${HOME} && sed
+readonly local ${HOME} 2>/dev/null
+	grep $(pwd) done 2>/dev/null printf && done 2>/dev/null grep export
+	then $(pwd) -eu awk readonly export awk awk --verbose
+	test && -eu echo readonly local /usr/bin echo printf echo awk "$@"
+2>/dev/null echo grep /usr/bin "$1" && /usr/bin -eu then "$@" echo echo test
+	x=1 cd x=1 'quoted text' test readonly "$@" done 2>/dev/null
+	"$@" export done && x=1 cd ${HOME} printf "$1" && | "$1"
+	'quoted text' ${HOME} printf awk 2>/dev/null
+		grep && test sed test -eu | printf echo -eu done "$@"
+	/usr/bin ${HOME} test printf test x=1 printf grep && local | sed $(pwd)
+--verbose "$1" ${HOME} then
+		${HOME} then awk sed | done "$1"
+		${HOME} local test printf
+	--verbose export ${HOME} -eu done /usr/bin ${HOME} $(pwd) test --verbose -eu "$@"
+	cd grep --verbose -eu | done "$@" /usr/bin
+		then "$1" echo done "$@" echo grep /usr/bin
+		2>/dev/null | test 2>/dev/null
+export printf /usr/bin grep export local /usr/bin 2>/dev/null
+done readonly 'quoted text' awk test -eu x=1 --verbose
+	"$1" "$1" test x=1 /usr/bin awk 'quoted text' export
+		--verbose export printf export | then -eu local -eu /usr/bin echo | $(pwd)
+	export "$1" awk 'quoted text' 'quoted text' | | $(pwd) export grep --verbose
+echo 'quoted text' local done /usr/bin "$@" --verbose
+		2>/dev/null "$@" then echo ${HOME} $(pwd) test echo "$1" 'quoted text'
+	"$@" 'quoted text' local ${HOME} export awk | "$1" sed /usr/bin
+	printf test grep printf export -eu ${HOME} grep then
+		'quoted text' 'quoted text' $(pwd)
+/usr/bin --verbose "$@" awk done | | cd --verbose then $(pwd) sed cd sed readonly
+export "$@" && x=1 done printf -eu $(pwd)
+	"$1" printf -eu "$1" local cd test -eu 'quoted text'
+	| ${HOME} | /usr/bin local | then then readonly echo 'quoted text'
+	&& x=1 printf "$1" local readonly -eu x=1
+		$(pwd) ${HOME} echo cd export "$@" "$1" $(pwd)
+sed "$@" echo "$@" export "$@" done 'quoted text' echo cd export
+/usr/bin local x=1 printf printf 'quoted text' "$1" done 'quoted text'
+local 2>/dev/null sed "$1" && export cd $(pwd) && 'quoted text'
+	export grep export grep local sed x=1 done -eu 2>/dev/null $(pwd) local echo
+	'quoted text' echo ${HOME} ${HOME} then /usr/bin | | /usr/bin grep local
+	| sed x=1 cd printf ${HOME} 'quoted text' $(pwd) 'quoted text'
+awk 2>/dev/null local printf
+local --verbose --verbose
+"$@" grep && --verbose grep printf done --verbose
+	2>/dev/null ${HOME} cd && | export 'quoted text' && ${HOME} cd grep
+	"$1" then "$1" readonly "$@" ${HOME} && test && readonly ${HOME} export
+		readonly | --verbose readonly | readonly echo then echo readonly x=1
+	test --verbose 'quoted text'
+export cd cd 2>/dev/null printf 'quoted text' echo grep
+$(pwd) echo then --verbose grep
+	done sed echo 'quoted text' ${HOME} cd test local cd cd
+	cd 2>/dev/null "$@" ${HOME} x=1
+readonly then --verbose "$@"
+	test local export awk test x=1 export | 2>/dev/null echo done
+	&& export grep --verbose sed awk "$1" 2>/dev/null local /usr/bin 'quoted text'
+2>/dev/null /usr/bin
+-eu cd 2>/dev/null cd echo
+	test -eu export "$@" readonly sed local --verbose printf "$@" ${HOME}
+		grep sed -eu "$1" "$@" awk && echo "$@" $(pwd) && $(pwd) test --verbose
+"$1" --verbose --verbose awk $(pwd) /usr/bin ${HOME} export ${HOME}
+	sed printf --verbose ${HOME} local --verbose sed "$@" $(pwd) "$@"
+/usr/bin cd test 2>/dev/null
+	x=1 then $(pwd) && awk && /usr/bin -eu "$1" done grep ${HOME}
+	/usr/bin echo sed 2>/dev/null -eu && 'quoted text'
+	grep /usr/bin && echo echo 'quoted text' grep ${HOME} x=1 x=1 2>/dev/null "$@"
+"$1" /usr/bin --verbose printf $(pwd) printf
+		grep local "$@" done "$@" "$1" then awk export echo ${HOME}
+		"$1" && printf export awk then cd ${HOME} 2>/dev/null cd sed --verbose $(pwd)
+		'quoted text' -eu sed readonly 2>/dev/null then cd && --verbose
+| then 'quoted text' cd done done
+	$(pwd) readonly | grep test -eu test cd local --verbose printf
+		grep -eu test done grep
+	then ${HOME} printf awk -eu x=1 2>/dev/null "$@" echo echo | 'quoted text'
+grep "$1" "$1" "$1" | x=1 then printf
+		--verbose "$1" test sed "$1" /usr/bin awk awk test $(pwd)
+	test && sed 2>/dev/null ${HOME} export ${HOME} grep grep awk
+	x=1 echo printf $(pwd) ${HOME} cd then $(pwd)
+	2>/dev/null grep grep -eu && ${HOME} awk -eu readonly sed
+		/usr/bin --verbose /usr/bin "$1"
+		| printf x=1 local local "$@" --verbose /usr/bin readonly ${HOME} 2>/dev/null
+grep && cd export x=1 cd $(pwd) "$@" | test readonly
+	| sed --verbose $(pwd) x=1 'quoted text' readonly cd 2>/dev/null
+	echo test grep printf awk 'quoted text' x=1 x=1 readonly
+	sed grep export done sed export | cd | && awk -eu cd sed "$@" test
+		--verbose 2>/dev/null done export local 'quoted text' cd /usr/bin 'quoted text'
+2>/dev/null "$@" grep grep x=1 echo 'quoted text' --verbose
+x=1 sed /usr/bin awk local ${HOME} printf | grep awk
+		x=1 -eu && && x=1 test | awk test test $(pwd) -eu
+readonly --verbose $(pwd) local 'quoted text' printf echo ${HOME} $(pwd) --verbose
+	cd awk test done 2>/dev/null then test
+done printf grep /usr/bin readonly
+	then done /usr/bin then sed then -eu test "$@" -eu $(pwd) local grep
+		echo -eu | export /usr/bin echo readonly export
+| printf printf | -eu
+	then echo "$@" ${HOME} grep
+	echo grep "$@" 'quoted text'
+${HOME} export $(pwd) grep && grep
+awk -eu 'quoted text' --verbose ${HOME} then cd "$@" && echo | readonly
+		/usr/bin 'quoted text' grep ${HOME} 'quoted text' /usr/bin
+awk sed 2>/dev/null local "$@" printf
+		/usr/bin -eu echo printf awk && $(pwd) printf /usr/bin |
+then "$@" readonly printf ${HOME}
+| x=1 export ${HOME} export export x=1 2>/dev/null "$1" ${HOME} echo &&
+	echo grep sed ${HOME} 2>/dev/null "$@" local
+	/usr/bin then ${HOME} awk -eu export echo
+done awk readonly 'quoted text'
+		| 2>/dev/null && $(pwd) then | export sed sed
+		sed 2>/dev/null grep "$@" awk local $(pwd) cd --verbose "$@" | printf readonly
+done ${HOME} grep "$@" local export echo sed local export
+--verbose | --verbose then "$@" echo $(pwd)
+		then && local done done /usr/bin readonly
+printf 'quoted text' grep readonly awk /usr/bin && ${HOME} | echo 2>/dev/null
+		test /usr/bin local printf
+		test cd --verbose local x=1 awk echo export
+	sed $(pwd) awk 2>/dev/null 'quoted text' 'quoted text' export | &&
+	done ${HOME} echo x=1 ${HOME} && "$1" x=1 -eu done "$1" local printf
+		$(pwd) 2>/dev/null grep export
+	"$@" sed cd awk && --verbose cd /usr/bin
+	printf 2>/dev/null 2>/dev/null grep | ${HOME} $(pwd) | ${HOME} echo
+	&& "$@" /usr/bin sed --verbose -eu then sed sed sed done
+	grep readonly awk sed grep "$@" --verbose local
+$(pwd) "$1" && 2>/dev/null awk awk then "$1" 2>/dev/null printf readonly
+test then cd done awk "$1" -eu awk cd local $(pwd) grep ${HOME} then x=1
+done -eu awk "$@" 'quoted text' test -eu export sed cd test readonly
+		| "$1" $(pwd) ${HOME} test /usr/bin &&
+local done readonly 'quoted text' ${HOME} && test | x=1 done awk /usr/bin $(pwd)
+--verbose && export "$@" export awk local "$1"
+		x=1 test test ${HOME} export -eu awk sed $(pwd) $(pwd) export
+	sed echo 'quoted text' ${HOME} done readonly $(pwd) cd
+	$(pwd) x=1 /usr/bin $(pwd) -eu $(pwd) $(pwd) test -eu $(pwd) then x=1 readonly
+	"$@" ${HOME} test then grep ${HOME} echo sed echo readonly /usr/bin
+		local readonly --verbose x=1 awk --verbose 2>/dev/null x=1 && then "$@"
+then -eu && printf x=1 sed 'quoted text' awk export
+	awk test "$1" echo grep
+		$(pwd) && "$@" then && "$1" $(pwd) test readonly 'quoted text' export local
+	$(pwd) grep echo export export | -eu $(pwd)
+		| export "$@" printf ${HOME}
+printf echo printf | local export --verbose ${HOME} && $(pwd)
+	echo -eu && then export cd cd --verbose 2>/dev/null -eu export
+	then ${HOME} $(pwd) test local 'quoted text' sed 2>/dev/null
+		-eu $(pwd) ${HOME} awk /usr/bin
+'quoted text' "$1" then local then /usr/bin awk "$1" then 'quoted text'
+test awk then readonly awk cd then
+	"$1" x=1 echo 'quoted text'
+&& $(pwd) --verbose export $(pwd) done
+	| && --verbose sed $(pwd) && cd "$1" "$@" -eu
+		sed echo awk $(pwd) echo /usr/bin "$1" export
+	cd /usr/bin local cd | 2>/dev/null "$@" done
+	2>/dev/null cd awk 'quoted text' local then echo "$@" && cd printf "$@" grep /usr/bin
+		test readonly 2>/dev/null readonly local cd echo grep echo then printf
+	${HOME} grep 2>/dev/null readonly local local sed then ${HOME}
+awk ${HOME} "$1" then then grep cd | /usr/bin "$1" then cd -eu
+	&& echo then $(pwd) test test --verbose echo -eu sed "$@" $(pwd) -eu then 2>/dev/null
+-eu -eu 2>/dev/null x=1 "$1" test echo x=1 'quoted text'
+		"$@" /usr/bin 2>/dev/null cd &&
+x=1 2>/dev/null then 2>/dev/null --verbose x=1 "$1" cd export 'quoted text'
+		then cd echo ${HOME} sed "$1" grep ${HOME} echo then awk $(pwd) $(pwd)
+	awk -eu readonly -eu --verbose local done 2>/dev/null printf x=1 readonly
+		sed -eu printf -eu local grep x=1 x=1 $(pwd) echo echo readonly 2>/dev/null
+done then test local /usr/bin 2>/dev/null -eu grep sed grep grep $(pwd)
+	echo cd && 2>/dev/null x=1 x=1 test cd awk
+		cd awk printf printf readonly
+		&& ${HOME} "$1" ${HOME} --verbose | 'quoted text' local
+		local sed grep "$1" x=1 'quoted text'
+		${HOME} && --verbose awk x=1 sed
+		'quoted text' && "$1" -eu cd printf /usr/bin /usr/bin sed ${HOME}
+	export then $(pwd) printf --verbose -eu "$@" | $(pwd) readonly
+		echo "$1" -eu readonly grep export --verbose "$1" export sed $(pwd) readonly
+"$@" printf && | && -eu && local && x=1 awk
+		"$@" 2>/dev/null && printf readonly awk x=1
+${HOME} readonly grep | test && cd x=1
+	echo "$@" --verbose cd awk 2>/dev/null "$@" test "$1" then then | && "$@" 'quoted text'
+	sed /usr/bin ${HOME} then
+then && /usr/bin $(pwd) | sed 'quoted text'
+		done "$@" && x=1 && export local echo 2>/dev/null ${HOME}
+	$(pwd) "$@" -eu awk echo
+		echo "$1" | cd /usr/bin "$1" /usr/bin 2>/dev/null
+		printf then x=1 test 2>/dev/null then echo "$1" -eu then grep 2>/dev/null
+cd 'quoted text' "$1" -eu grep
+	&& /usr/bin awk ${HOME}
+then grep done local local local "$1" | x=1 export | export
+	"$@" cd grep echo cd 'quoted text'
+		readonly export $(pwd) $(pwd) && export --verbose && ${HOME} && | --verbose 2>/dev/null
+		export /usr/bin | 2>/dev/null "$@"
+readonly "$1" sed ${HOME} test echo test
+		2>/dev/null /usr/bin ${HOME} && done cd test export
+		export ${HOME} && grep | echo --verbose ${HOME} && && 'quoted text'
+		then --verbose grep x=1 -eu then cd cd 'quoted text' grep --verbose --verbose
+	-eu "$@" awk x=1 echo /usr/bin 2>/dev/null readonly -eu -eu
+	&& "$1" "$1" echo grep 2>/dev/null "$1" --verbose
+		export 2>/dev/null "$1" x=1 x=1 ${HOME} export cd -eu grep echo printf $(pwd)
+		grep readonly then -eu
+	"$1" export awk "$1" 'quoted text' cd grep | -eu 'quoted text'
+--verbose readonly "$1" readonly --verbose done --verbose
+"$@" done -eu local cd export --verbose echo done done readonly
+export | -eu then /usr/bin done printf test x=1 | "$1" export
+	then done -eu export && cd grep
+	sed echo readonly && x=1 export readonly "$1" local $(pwd) -eu export
+	cd echo -eu | | cd --verbose | ${HOME} | /usr/bin readonly local
+&& awk echo 'quoted text' printf && 'quoted text'
+/usr/bin printf readonly
+	--verbose test "$1" export "$1" | sed --verbose
+sed $(pwd) "$@" --verbose "$@"
+test sed 2>/dev/null /usr/bin ${HOME} sed 'quoted text' done sed &&
+		sed 2>/dev/null printf
+cd 2>/dev/null /usr/bin --verbose printf local x=1 "$1" export readonly test test
+	grep cd printf 'quoted text' export then cd awk /usr/bin cd x=1 "$@" ${HOME}
+	--verbose awk --verbose && printf
+--verbose printf --verbose 2>/dev/null -eu ${HOME} test
+	export echo printf cd | done -eu sed "$1" "$1" test export
+		awk x=1 local x=1 local done 2>/dev/null
+		cd 'quoted text' 2>/dev/null sed -eu 'quoted text' cd test $(pwd) test | /usr/bin
+local 'quoted text' --verbose
+readonly /usr/bin echo
+"$@" /usr/bin printf sed readonly
+${HOME} cd done done echo $(pwd) grep /usr/bin done | && export
+cd $(pwd) echo "$1" 'quoted text' readonly | echo && printf --verbose readonly
+test done grep then && "$1" 'quoted text' --verbose x=1 readonly
+sed && sed /usr/bin sed /usr/bin && awk readonly
+test x=1 cd ${HOME} "$1" "$1" $(pwd) x=1 readonly 2>/dev/null
+	2>/dev/null 'quoted text' printf
+		2>/dev/null $(pwd) x=1 grep | ${HOME} "$@" grep $(pwd) "$@" grep && cd
+		--verbose --verbose cd --verbose | then "$1"
+local -eu -eu /usr/bin 2>/dev/null
+		/usr/bin cd then x=1 then "$1" /usr/bin then done
+grep sed "$@" -eu --verbose $(pwd) | 2>/dev/null then then done
+	--verbose "$1" 2>/dev/null readonly -eu then --verbose cd cd /usr/bin
+then 2>/dev/null $(pwd) | $(pwd) x=1 "$@" test done /usr/bin test -eu && local
+		sed 'quoted text' printf --verbose x=1 --verbose
+		'quoted text' export then 2>/dev/null awk sed cd x=1 printf export test /usr/bin
+	cd --verbose readonly ${HOME}
+	${HOME} 'quoted text' ${HOME} cd
+awk printf cd printf export test $(pwd)
+| awk grep test sed grep &&
+readonly && /usr/bin "$@" 2>/dev/null done local /usr/bin grep local export test
+grep local "$@" sed local "$@" ${HOME} 2>/dev/null /usr/bin /usr/bin sed
+	${HOME} done "$@" "$1" local grep cd printf $(pwd) x=1 sed
+		echo printf readonly x=1 && ${HOME} 2>/dev/null -eu | echo --verbose test
+done && sed 'quoted text' export x=1 2>/dev/null /usr/bin test sed
+"$@" ${HOME} sed printf -eu cd $(pwd) done export sed sed local then
+-eu grep -eu awk done
+	export done /usr/bin local $(pwd)
+	--verbose x=1 2>/dev/null echo printf printf ${HOME} --verbose
+		export -eu "$1" then 2>/dev/null -eu ${HOME} echo cd sed
+/usr/bin 2>/dev/null | grep echo awk test
+		then ${HOME} then && "$@" grep -eu export /usr/bin -eu /usr/bin --verbose
+readonly awk readonly done --verbose "$@" ${HOME} then test
+		&& then ${HOME} then readonly /usr/bin export
+export printf cd readonly test
+x=1 export done $(pwd) readonly done done x=1 ${HOME} ${HOME} $(pwd)
+sed grep cd then "$@"
+		'quoted text' then echo test
+		$(pwd) cd "$@" local
+	&& readonly "$1" grep "$@"
+2>/dev/null sed 2>/dev/null | 2>/dev/null sed $(pwd) "$@" 'quoted text' | ${HOME}
+	--verbose done readonly | cd $(pwd) 'quoted text' sed 'quoted text'
+	"$@" ${HOME} -eu --verbose printf readonly /usr/bin | sed printf
+		awk echo | "$1" grep "$1" grep echo test
+	then x=1 2>/dev/null test /usr/bin then readonly export && readonly sed "$@" 'quoted text'
+grep done ${HOME} -eu echo cd test echo "$1" test printf && | export
+		then printf test printf 2>/dev/null sed "$@" done "$@" sed /usr/bin
+	readonly local echo local echo /usr/bin grep ${HOME} "$@"
+		export /usr/bin x=1 ${HOME} done readonly 'quoted text' x=1 ${HOME} | echo awk
+	grep /usr/bin /usr/bin local $(pwd)
+	$(pwd) | export $(pwd) done awk "$1" && awk 2>/dev/null
+		sed export test then local grep "$1" 'quoted text' readonly 2>/dev/null
+-eu grep local local "$@" then 'quoted text' x=1 echo /usr/bin
+	/usr/bin 'quoted text' 2>/dev/null sed
+$(pwd) echo cd -eu | $(pwd) local /usr/bin 2>/dev/null "$@" && awk
+printf cd readonly sed /usr/bin $(pwd) local /usr/bin sed | 2>/dev/null x=1
+	sed 'quoted text' grep "$@" echo grep readonly cd export local echo echo "$@"
+		-eu 2>/dev/null /usr/bin awk cd local 'quoted text'
+	&& test readonly cd ${HOME} 'quoted text' "$1" "$1" "$@"
+		$(pwd) test --verbose test awk | grep /usr/bin sed "$@" cd local && -eu ${HOME}
+	readonly /usr/bin /usr/bin $(pwd) | x=1 $(pwd) test done
+x=1 'quoted text' done | printf
+	'quoted text' printf cd echo ${HOME} echo --verbose x=1 test local "$@"
+printf local ${HOME} export
+	then export $(pwd) grep /usr/bin awk && /usr/bin
+then grep && then echo "$@" 'quoted text' printf export done
+		sed export "$@" 'quoted text' printf local "$1" | x=1 2>/dev/null
+	printf "$@" -eu sed 'quoted text' -eu sed "$1" test "$@" "$1" --verbose
+	test ${HOME} cd "$@" ${HOME}
+--verbose 'quoted text'
+	grep ${HOME} sed readonly /usr/bin local | /usr/bin cd then
+readonly x=1 --verbose local /usr/bin export
+test local /usr/bin printf | $(pwd) echo /usr/bin cd && sed -eu
+		readonly then readonly sed
+	"$@" test readonly ${HOME} awk then 'quoted text' 2>/dev/null /usr/bin
+		| && x=1 && then ${HOME} awk $(pwd) 2>/dev/null "$@" x=1 awk | printf /usr/bin "$1"
+		grep ${HOME} sed readonly local awk /usr/bin "$@" grep $(pwd) -eu done
+"$@" readonly printf awk test export --verbose awk cd sed local cd "$@" /usr/bin
+sed readonly --verbose | "$1" --verbose awk printf
+	export 'quoted text' printf then printf then echo readonly printf /usr/bin
+		$(pwd) ${HOME} printf x=1 /usr/bin printf
+		--verbose x=1 local readonly ${HOME}
+	/usr/bin sed 'quoted text' ${HOME} -eu
+	grep x=1 test 2>/dev/null "$@" sed echo sed echo
+| /usr/bin sed local "$1" sed
+		local && printf done x=1 readonly --verbose export local
+test done echo readonly ${HOME} | --verbose /usr/bin readonly
+	"$1" local grep "$1" "$@" $(pwd) ${HOME}
+test /usr/bin local ${HOME}
+	$(pwd) 'quoted text' sed -eu sed printf
+test $(pwd) echo echo && &&
+&& printf export 'quoted text' -eu then then sed cd "$1"
+		local ${HOME} /usr/bin
+"$@" echo ${HOME} test ${HOME} sed export 2>/dev/null ${HOME} printf cd /usr/bin
+		x=1 --verbose x=1 test "$@"
+	cd readonly --verbose | x=1 /usr/bin
+	printf | readonly echo $(pwd) export
+readonly echo printf then readonly && awk test -eu
+-eu sed && export "$1" x=1 then grep
+	x=1 | echo readonly /usr/bin test test
+		2>/dev/null 'quoted text'
+	$(pwd) ${HOME} | ${HOME} cd --verbose | "$@" test local export
+$(pwd) printf "$1" test readonly && 2>/dev/null done
+		"$@" echo -eu grep then "$1" echo test cd x=1 ${HOME} $(pwd) local local export
+	readonly --verbose readonly x=1 --verbose 'quoted text'
+		&& "$@" $(pwd) local $(pwd) && grep echo 'quoted text'
+	&& 2>/dev/null x=1 "$@" printf readonly | printf local
+		export awk "$@" then local /usr/bin "$1" printf ${HOME} 2>/dev/null
+	-eu --verbose "$@" local sed export "$@"
+	awk "$1" awk cd ${HOME} "$1" done x=1 readonly | 2>/dev/null 'quoted text'
+	echo readonly readonly then sed x=1 ${HOME} 'quoted text' awk
+	test local awk && echo x=1 then | $(pwd)
+	local ${HOME} 'quoted text' 'quoted text'
+grep export x=1 awk 2>/dev/null cd grep export printf
+2>/dev/null /usr/bin sed ${HOME}
+	| local 'quoted text' export 2>/dev/null
+	"$1" --verbose x=1 test cd grep --verbose 2>/dev/null sed local echo test readonly
+	"$1" | local 'quoted text' export $(pwd)
+		${HOME} --verbose $(pwd) "$@" 'quoted text' cd then export |
+x=1 readonly test printf $(pwd) awk /usr/bin test "$1" "$@" export | x=1 -eu
+	readonly done test ${HOME} printf $(pwd) cd
+		| local $(pwd) test x=1 test readonly --verbose
+		-eu export readonly echo export
+	printf done 'quoted text' sed cd
+done cd done x=1 ${HOME} printf cd /usr/bin "$1" cd 2>/dev/null
+		/usr/bin grep export 2>/dev/null
+awk 'quoted text' && cd "$@" 'quoted text' 2>/dev/null -eu readonly then then
+done $(pwd) export x=1 "$1" x=1 ${HOME} sed cd 2>/dev/null /usr/bin echo echo x=1
+	sed --verbose cd export $(pwd) | export readonly local
+		test grep echo $(pwd) -eu -eu --verbose 2>/dev/null $(pwd) cd then -eu grep
+		readonly test 2>/dev/null x=1 "$1" test /usr/bin test test "$1" printf sed then
+	/usr/bin "$1" --verbose cd then cd export sed awk
+	test "$1" ${HOME} ${HOME} x=1 "$1" local
+		awk echo awk "$@" /usr/bin $(pwd) x=1 -eu /usr/bin 2>/dev/null
+		then && "$@" -eu printf | 'quoted text' |
+	echo grep test cd | 'quoted text' ${HOME} cd $(pwd) "$@" | done 2>/dev/null
+	awk && ${HOME} /usr/bin export then test
+"$1" export done printf grep
+	grep cd echo done 'quoted text' readonly local readonly
+		'quoted text' | $(pwd) local sed echo
+	$(pwd) then | 'quoted text' x=1 "$@" grep --verbose -eu "$1" && /usr/bin 'quoted text'
+	${HOME} export grep done -eu "$@" echo ${HOME}
+readonly printf then local sed echo x=1 2>/dev/null
+		then readonly ${HOME} done $(pwd) --verbose 2>/dev/null $(pwd) /usr/bin
+		x=1 grep ${HOME} | 'quoted text' "$@" | test --verbose
+"$@" ${HOME} /usr/bin export --verbose grep test readonly 'quoted text' | /usr/bin
+| 2>/dev/null test local cd grep awk "$1" local x=1 --verbose
+cd export printf readonly $(pwd) grep /usr/bin --verbose
+	echo done && export echo "$1"
+2>/dev/null echo --verbose awk done $(pwd) | sed printf then --verbose && cd echo
+'quoted text' /usr/bin printf ${HOME} sed && ${HOME} grep export export
+	test /usr/bin ${HOME} printf then
+echo /usr/bin ${HOME} /usr/bin
+		| --verbose "$@" cd awk readonly local grep printf 'quoted text'
+sed then | cd /usr/bin awk "$1" /usr/bin "$@" | awk readonly
+	'quoted text' /usr/bin
+		"$1" && 2>/dev/null 2>/dev/null echo "$1" -eu -eu ${HOME} test local export
+	"$@" 2>/dev/null "$1" awk x=1 cd awk -eu echo awk grep
+		export export echo 2>/dev/null
+sed --verbose cd awk --verbose export
+		${HOME} 2>/dev/null /usr/bin test
+local /usr/bin | test 2>/dev/null
+		| export echo test -eu grep echo ${HOME} sed && export
+	grep readonly awk sed local grep
+	/usr/bin -eu sed then 2>/dev/null "$@" export local local
+		'quoted text' export done printf "$@" cd grep test "$@" awk test ${HOME} $(pwd)
+	"$1" --verbose printf done cd then local
+		| done 'quoted text' | -eu done done
+		awk "$1" /usr/bin sed x=1 $(pwd) --verbose readonly then readonly export
+	local sed test x=1 printf $(pwd) printf x=1 done sed 'quoted text'
+	done -eu 'quoted text' /usr/bin printf $(pwd) cd
+	local $(pwd) awk cd grep 'quoted text' sed "$1" $(pwd) local sed --verbose
+	-eu && 2>/dev/null cd | printf x=1 | $(pwd) echo sed echo
+		-eu test test 'quoted text' done local done cd 2>/dev/null && grep local test $(pwd)
+	2>/dev/null 'quoted text' x=1 test export cd local export 'quoted text' local
+-eu printf grep 2>/dev/null /usr/bin
+--verbose | sed echo export 2>/dev/null --verbose test then $(pwd) echo
+		test --verbose ${HOME} ${HOME} /usr/bin printf printf echo "$@" then printf
+local readonly && readonly && sed then sed grep
+| sed local "$1" --verbose 'quoted text'
+	${HOME} printf printf readonly "$1" "$@" "$@" -eu 'quoted text' cd sed x=1
+	echo /usr/bin | 2>/dev/null local grep export
+		echo $(pwd) 2>/dev/null printf test local
+		grep local then "$1" printf readonly -eu then "$1" -eu x=1 grep -eu | readonly
+/usr/bin awk local && then
+		| awk grep "$1" cd | && test grep "$1"
+	x=1 local done cd 'quoted text' /usr/bin readonly -eu
+"$1" -eu done readonly test echo echo done test grep ${HOME} awk 'quoted text'
+		'quoted text' export test grep
+		&& 2>/dev/null --verbose awk x=1
+"$1" "$@" then cd echo grep 'quoted text' 2>/dev/null
+	grep grep then -eu $(pwd) /usr/bin "$@" "$1" $(pwd)
+2>/dev/null done local -eu 'quoted text'
+	grep readonly $(pwd) --verbose grep --verbose x=1 local done test readonly
+		grep test -eu readonly
+		done cd done "$@" "$1" 'quoted text' done export /usr/bin printf readonly test
+grep then awk 'quoted text'
+	export local && --verbose -eu "$@" | readonly 2>/dev/null 2>/dev/null
+x=1 cd readonly ${HOME} 'quoted text' export echo 'quoted text'
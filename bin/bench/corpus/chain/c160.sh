@@ -0,0 +1,2001 @@
+	local echo "$@" $(pwd) && | 'quoted text' $(pwd) "$1" done --verbose
+		x=1 done $(pwd) $(pwd) && cd export 2>/dev/null grep local done
+| done test grep $(pwd) $(pwd) printf
+		readonly then x=1 done ${HOME} "$@" && cd test then echo x=1 readonly awk 2>/dev/null
+	'quoted text' 2>/dev/null
+		${HOME} 'quoted text' /usr/bin export -eu x=1 echo sed | --verbose then
+	grep 2>/dev/null awk | export "$@" readonly cd printf done -eu
+	sed ${HOME} sed echo --verbose /usr/bin grep
+done $(pwd) printf 2>/dev/null && "$1"
+		echo "$@" "$@" test cd /usr/bin /usr/bin awk echo sed then echo -eu
+		echo $(pwd) --verbose --verbose && "$1" ${HOME} /usr/bin -eu export
+	/usr/bin cd | local cd --verbose readonly
+	export 'quoted text' then x=1 x=1 test -eu && -eu echo export "$1" | readonly
+readonly grep then sed done
+	"$@" /usr/bin cd && cd sed grep done awk sed done then $(pwd) then printf sed
+		'quoted text' /usr/bin 2>/dev/null
+	echo export done | 'quoted text'
+	grep test /usr/bin export echo --verbose done 2>/dev/null
+	"$1" printf /usr/bin awk cd then awk "$1" x=1 export printf "$1" test
+		${HOME} done echo awk /usr/bin /usr/bin
+		then -eu 'quoted text' sed --verbose grep local awk echo cd
+echo "$1" readonly local
+sed done && sed /usr/bin awk --verbose "$@" $(pwd) printf
+	done done --verbose && /usr/bin printf "$@" printf sed echo $(pwd) && "$1"
+	2>/dev/null local $(pwd) "$1" && echo $(pwd)
+		local && | export sed $(pwd) -eu --verbose printf
+	$(pwd) then cd test sed printf test test echo then echo test printf test
+--verbose 'quoted text' 'quoted text'
+	grep sed printf 2>/dev/null /usr/bin && cd --verbose test test
+	'quoted text' 'quoted text' ${HOME} done
+	2>/dev/null printf 2>/dev/null | --verbose && echo done done $(pwd)
+-eu printf export local test grep
+"$@" -eu readonly -eu readonly && "$@"
+		printf /usr/bin test echo awk $(pwd) 'quoted text' ${HOME}
+	then done 'quoted text' --verbose done echo $(pwd)
+		"$@" printf && && export 'quoted text' x=1 export --verbose -eu --verbose -eu
+		readonly --verbose local /usr/bin sed grep cd "$@" cd "$1" sed
+echo -eu cd grep sed done readonly 2>/dev/null | /usr/bin
+		sed test test 2>/dev/null readonly ${HOME} test 'quoted text' done awk --verbose
+		readonly $(pwd) printf 'quoted text' x=1
+	grep sed /usr/bin then --verbose && cd grep 2>/dev/null /usr/bin
+		-eu echo -eu then sed --verbose x=1 "$@" | sed export x=1 | test "$@"
+cd printf local 'quoted text' sed sed test /usr/bin test local
+"$@" "$@" test 'quoted text'
+	export awk /usr/bin grep 'quoted text' cd then x=1 done 2>/dev/null
+	printf done export | local -eu "$1" 'quoted text'
+	local grep local && done awk grep cd
+	2>/dev/null x=1 readonly "$@" $(pwd) "$1" $(pwd) $(pwd) sed printf "$1" 'quoted text'
+		${HOME} printf awk then -eu printf
+	${HOME} cd grep cd export -eu "$@" "$1" "$@"
+| test $(pwd) cd grep cd awk 'quoted text' && test test ${HOME}
+	printf x=1 awk readonly printf done echo local awk done test "$@" ${HOME}
+	test 'quoted text' readonly cd grep "$1" "$1" "$1" | readonly grep 'quoted text'
+		-eu "$1" && awk test
+test $(pwd) echo $(pwd) grep /usr/bin x=1 ${HOME} ${HOME} grep done then
+		"$1" then awk readonly -eu export "$1"
+test "$@" grep 2>/dev/null
+		$(pwd) local local x=1 "$@" grep cd cd | sed "$1" "$@" 2>/dev/null
+	--verbose | x=1 "$@" x=1 test 'quoted text' then $(pwd) 2>/dev/null
+cd --verbose | -eu | "$@" --verbose awk -eu grep
+	${HOME} $(pwd) /usr/bin &&
+	| 'quoted text' 2>/dev/null 2>/dev/null && grep |
+		&& 'quoted text' "$@" "$@" "$@" /usr/bin printf then ${HOME} 'quoted text'
+	test 'quoted text' done
+${HOME} readonly then local printf /usr/bin export | grep -eu
+	readonly local printf awk | 2>/dev/null -eu export | 2>/dev/null sed done
+	"$@" | local export test && sed /usr/bin local readonly export
+		2>/dev/null sed | 'quoted text' grep && ${HOME} -eu grep done export "$1"
+local printf 2>/dev/null --verbose test 2>/dev/null
+		/usr/bin echo -eu x=1 awk /usr/bin test then
+local 2>/dev/null | x=1 readonly sed -eu x=1 readonly --verbose
+	readonly x=1 export echo $(pwd)
+	-eu "$@" --verbose cd awk | "$@" /usr/bin "$@" local -eu 'quoted text'
+	export /usr/bin then readonly local
+		--verbose "$@" echo cd readonly 'quoted text'
+--verbose echo x=1 grep "$@" grep cd $(pwd) cd awk ${HOME} printf
+	${HOME} "$1" printf |
+	/usr/bin -eu then then --verbose
+	--verbose x=1 printf done cd local
+awk 'quoted text' x=1
+	"$1" ${HOME} grep /usr/bin awk done 2>/dev/null 'quoted text' -eu then
+		done awk grep test -eu export export export
+	sed printf done 'quoted text'
+		grep && sed | readonly "$1" ${HOME} $(pwd) cd && grep then $(pwd)
+		sed sed readonly 'quoted text'
+	"$@" ${HOME} sed | export grep then && cd 2>/dev/null
+	cd --verbose local grep echo test $(pwd) printf sed -eu $(pwd) printf awk done
+&& cd cd printf done echo
+	grep -eu printf ${HOME} "$1" printf $(pwd) --verbose test
+		'quoted text' /usr/bin | local test cd /usr/bin $(pwd) done
+local | 'quoted text' readonly && $(pwd)
+then local local export awk x=1 awk ${HOME}
+		| /usr/bin /usr/bin sed 'quoted text'
+x=1 ${HOME} cd readonly x=1
+	"$1" --verbose readonly 'quoted text' -eu --verbose ${HOME} readonly awk cd
+		sed readonly ${HOME} local echo
+	| done | test "$1" $(pwd) export
+	${HOME} -eu then x=1 test "$1" 'quoted text'
+readonly $(pwd) ${HOME} done | && ${HOME} local && ${HOME}
+		printf grep cd "$1" 'quoted text' "$1" 2>/dev/null printf echo
+	--verbose test 'quoted text' readonly then then done
+local ${HOME} "$1" cd x=1 then 2>/dev/null $(pwd) -eu "$@" 2>/dev/null
+		done $(pwd) done x=1 2>/dev/null awk export "$@" cd 2>/dev/null
+"$1" sed echo export /usr/bin
+	cd readonly 'quoted text'
+"$1" "$@" ${HOME} $(pwd) grep awk readonly
+		&& && then 2>/dev/null -eu /usr/bin
+	test printf grep then done "$@" /usr/bin grep cd 2>/dev/null /usr/bin
+printf awk then grep done "$1" grep sed 'quoted text' | 'quoted text'
+	"$@" then -eu /usr/bin x=1 awk echo | then done --verbose done sed /usr/bin
+	--verbose "$@" cd | local && sed readonly test 'quoted text'
+		done $(pwd) -eu echo x=1 2>/dev/null
+	grep then printf 2>/dev/null | export "$1" $(pwd) then awk export -eu then cd
+echo /usr/bin export echo && 2>/dev/null
+		$(pwd) /usr/bin $(pwd) then export local "$@" && echo ${HOME}
+		local readonly printf printf -eu echo "$1"
+	x=1 $(pwd) awk | && "$1" | -eu 2>/dev/null
+local -eu local "$@" | awk test sed export cd "$@" cd --verbose echo | --verbose
+		| x=1 test "$1" grep && "$@"
+		2>/dev/null "$1" && 2>/dev/null && --verbose grep
+	2>/dev/null x=1 export -eu && export && grep done -eu done
+	cd -eu -eu | "$@" export --verbose readonly && -eu sed awk awk 2>/dev/null
+		awk && /usr/bin --verbose done readonly printf | printf -eu 'quoted text' test
+cd ${HOME} /usr/bin 2>/dev/null done
+	| ${HOME} awk awk cd printf x=1 echo printf local local
+		| 2>/dev/null export done printf readonly sed readonly local
+	--verbose grep | -eu echo "$1" /usr/bin --verbose done grep
+		-eu grep done printf 2>/dev/null export && x=1 echo export then 'quoted text'
+		cd -eu "$@" "$1" cd local export cd && | | grep
+	| && local done "$1" awk x=1 && "$@" --verbose cd grep cd grep && |
+	x=1 then done "$1" /usr/bin sed
+		--verbose grep then test then sed grep echo x=1 export
+$(pwd) --verbose -eu export done -eu echo 'quoted text' grep
+	readonly "$@" --verbose -eu
+		test "$1" cd local awk sed &&
+--verbose 2>/dev/null "$@" then awk local cd awk awk awk grep ${HOME}
+grep cd --verbose && printf ${HOME} then
+	test then -eu | | /usr/bin ${HOME} "$@" 'quoted text' done
+	cd x=1 x=1 test && awk 2>/dev/null -eu
+sed ${HOME} readonly grep ${HOME}
+		| -eu | "$@" /usr/bin /usr/bin -eu "$1" "$@" --verbose "$@" ${HOME} 2>/dev/null
+printf grep cd $(pwd) 'quoted text' test "$@" grep $(pwd) && ${HOME}
+	${HOME} && export ${HOME} | grep
+x=1 sed x=1 | sed -eu "$1" export test "$1" "$@" -eu $(pwd) 'quoted text'
+		| local --verbose 'quoted text' 'quoted text' test /usr/bin --verbose
+awk -eu echo | "$1" local printf done "$@" export |
+"$1" cd done "$1" echo 2>/dev/null ${HOME} ${HOME} | readonly awk 2>/dev/null
+&& "$@" 'quoted text' && export | ${HOME} export | local ${HOME} echo
+readonly readonly && -eu sed printf local then
+		-eu --verbose --verbose "$1" "$@"
+		done export && /usr/bin done grep
+		then x=1 "$1" awk cd test readonly 'quoted text' sed sed $(pwd) readonly
+	done printf readonly --verbose
+		2>/dev/null --verbose 2>/dev/null export sed sed grep echo -eu printf
+	"$1" done && printf && $(pwd) /usr/bin awk printf local
+&& "$1" echo export printf | grep && then && && test test
+	-eu "$@" sed awk grep cd "$1" 2>/dev/null
+sed done done export 'quoted text' $(pwd) printf $(pwd) "$@" | ${HOME} printf
+$(pwd) 2>/dev/null /usr/bin && ${HOME} x=1 export | printf test done test
+		x=1 echo test done ${HOME} awk awk 2>/dev/null $(pwd)
+	export awk test x=1 awk ${HOME} then grep "$1" cd awk "$@" /usr/bin
+	awk done then "$@" then awk cd test readonly
+	local -eu local readonly awk
+	readonly sed cd test "$@" 2>/dev/null echo then grep grep /usr/bin
+export -eu echo export printf -eu "$1" export printf
+'quoted text' /usr/bin done && 2>/dev/null
+local local --verbose export $(pwd) /usr/bin
+grep test done | && printf sed grep export x=1 printf
+		/usr/bin readonly awk | "$@" grep then 2>/dev/null sed
+	| cd then --verbose grep echo printf printf
+		2>/dev/null cd $(pwd) | cd 2>/dev/null "$1" done then grep -eu grep && ${HOME}
+	grep 2>/dev/null done echo $(pwd) && sed readonly
+		grep | readonly | $(pwd) /usr/bin export && ${HOME} done "$@" "$@" done
+	sed | export | cd then
+x=1 then then readonly export "$@"
+	${HOME} 'quoted text' done
+		export export 'quoted text' ${HOME}
+	printf readonly "$@" 'quoted text' $(pwd) && echo
+readonly 'quoted text' $(pwd) export grep echo awk
+readonly export cd "$1" export && echo test echo 'quoted text'
+	--verbose done export $(pwd) then
+	echo --verbose $(pwd) export awk -eu local printf x=1 -eu $(pwd)
+	grep /usr/bin --verbose |
+	awk echo export $(pwd) $(pwd) local ${HOME}
+		echo | cd $(pwd) --verbose readonly "$@" "$1" then
+		test done -eu grep cd && then done cd then
+printf ${HOME} 2>/dev/null ${HOME}
+	-eu x=1 $(pwd) "$1" -eu 'quoted text' test cd then "$1" export test 'quoted text'
+	awk "$@" then "$@" then done cd awk cd sed 2>/dev/null export "$1" ${HOME}
+	printf $(pwd) then readonly "$@" done then
+	local printf 2>/dev/null
+		"$1" local export echo test 2>/dev/null done 2>/dev/null test then grep $(pwd) $(pwd)
+sed | "$1" x=1 && ${HOME} $(pwd) /usr/bin "$1" 'quoted text'
+	then grep 2>/dev/null sed "$@" echo test
+		&& | -eu /usr/bin export "$1" | 2>/dev/null ${HOME} then then
+		/usr/bin test grep readonly echo cd printf export $(pwd) /usr/bin then
+	local -eu /usr/bin x=1
+		-eu --verbose grep 2>/dev/null /usr/bin x=1 /usr/bin awk local then 'quoted text'
+'quoted text' | x=1 "$1" "$@" readonly printf /usr/bin
+/usr/bin done printf ${HOME}
+		$(pwd) echo 'quoted text' test -eu $(pwd) /usr/bin
+"$1" export /usr/bin cd local "$1"
+x=1 printf 'quoted text' echo $(pwd) | | 'quoted text'
+$(pwd) /usr/bin sed echo "$@" local | local "$1"
+	done cd printf then test $(pwd) && "$1" && /usr/bin printf local
+	printf awk printf --verbose done sed 'quoted text' readonly | cd printf &&
+		'quoted text' local | /usr/bin awk readonly -eu echo export done $(pwd) ${HOME}
+		'quoted text' "$1" done
+		x=1 ${HOME} grep readonly | printf done
+	then echo && --verbose local
+	echo printf local export local "$@"
+		/usr/bin awk sed x=1 x=1
+	x=1 printf -eu /usr/bin cd "$@" x=1 cd "$1" readonly
+		readonly echo local cd awk --verbose --verbose 'quoted text' $(pwd) done test
+		x=1 awk x=1 test readonly
+		awk test ${HOME} 2>/dev/null --verbose echo
+		sed "$1" ${HOME} test
+		| then -eu 'quoted text' /usr/bin awk && printf x=1 --verbose x=1
+	-eu sed sed $(pwd) readonly | -eu then
+--verbose x=1 readonly grep export readonly
+		then local 2>/dev/null printf cd
+test sed test --verbose sed sed grep x=1 ${HOME} --verbose awk
+		awk printf && --verbose $(pwd) local "$@" 2>/dev/null 'quoted text' then readonly
+	test done /usr/bin awk awk echo awk cd printf $(pwd)
+	'quoted text' "$@" x=1
+	export test "$1" awk test printf
+&& done local "$1" test done -eu sed --verbose
+	"$1" 2>/dev/null export local ${HOME} then
+	then local sed && echo /usr/bin sed
+&& readonly x=1 'quoted text' x=1 ${HOME} cd $(pwd)
+test -eu /usr/bin ${HOME} /usr/bin cd done /usr/bin export | cd 'quoted text'
+		2>/dev/null x=1 grep /usr/bin --verbose printf cd
+	export cd | 'quoted text' done test readonly x=1 && then --verbose 2>/dev/null
+		echo "$@" --verbose sed printf sed | grep local $(pwd)
+	sed grep /usr/bin 'quoted text' /usr/bin "$@" then
+		done cd "$1" grep cd sed awk grep sed --verbose local 'quoted text'
+	"$1" "$@" ${HOME} then /usr/bin sed awk "$1" awk echo done
+cd "$1" | export ${HOME} export sed $(pwd) x=1 awk x=1 "$1"
+	"$@" readonly && && && awk -eu "$@" echo
+	${HOME} done echo 2>/dev/null && echo 'quoted text' sed -eu test "$1" $(pwd)
+	| readonly echo cd --verbose printf local sed cd echo $(pwd) readonly grep
+		| grep cd | cd | && grep
+export then 2>/dev/null /usr/bin printf awk ${HOME} done ${HOME}
+-eu | -eu 'quoted text' x=1 sed grep grep awk $(pwd) grep sed test
+		--verbose then grep then | --verbose
+		--verbose grep "$1" grep
+		${HOME} "$1" test 'quoted text' -eu -eu ${HOME}
+		| 'quoted text' done done sed local grep cd | x=1 test $(pwd)
+		--verbose readonly | printf test done done x=1 test cd
+		cd printf 'quoted text' readonly
+	&& grep sed local --verbose export "$@" "$@" grep echo |
+	'quoted text' -eu && && 'quoted text' awk cd test cd $(pwd) sed echo readonly local
+echo "$1" cd echo | test local 2>/dev/null
+	test done then 2>/dev/null grep done --verbose done --verbose x=1
+	sed "$@" export cd echo done 2>/dev/null
+echo ${HOME} /usr/bin local x=1 grep -eu done 2>/dev/null ${HOME} then cd awk
+		printf | export export -eu awk $(pwd) 'quoted text' --verbose
+		grep sed cd printf -eu
+2>/dev/null echo | "$1" 'quoted text'
+		sed local x=1 && readonly /usr/bin then
+${HOME} -eu printf /usr/bin grep then printf local
+${HOME} "$1" done awk $(pwd) printf printf awk ${HOME} --verbose test
+	export --verbose --verbose
+		2>/dev/null awk export 2>/dev/null
+/usr/bin done ${HOME} | readonly x=1 2>/dev/null "$1"
+		'quoted text' local &&
+"$1" -eu -eu grep echo sed /usr/bin test readonly x=1 "$@" sed
+	${HOME} --verbose -eu echo 2>/dev/null readonly ${HOME}
+		sed /usr/bin $(pwd) grep -eu printf
+		printf && x=1 'quoted text'
+	test cd readonly readonly done export ${HOME}
+"$1" $(pwd) printf awk "$1" | test -eu "$1" grep cd x=1 'quoted text'
+cd cd then -eu ${HOME} local && -eu | && && then
+		-eu 'quoted text' sed sed "$1" printf cd done --verbose local 2>/dev/null
+cd awk readonly local export 2>/dev/null $(pwd) echo
+		x=1 awk echo sed sed grep local | then x=1
+	echo ${HOME} readonly && x=1
+&& done "$@" x=1 --verbose local --verbose then done
+	--verbose -eu awk "$1" x=1
+		x=1 2>/dev/null $(pwd) test sed "$@"
+	"$1" /usr/bin $(pwd) then export 'quoted text' sed local 2>/dev/null
+	$(pwd) cd cd sed awk local
+		| local export x=1 export readonly |
+	${HOME} --verbose echo cd readonly "$@"
+		printf export readonly 'quoted text' done printf
+		sed local x=1 2>/dev/null export "$1" 'quoted text'
+	then readonly && cd test awk readonly done awk sed x=1 | cd readonly
+export test awk grep 2>/dev/null sed sed /usr/bin readonly
+	&& --verbose awk export sed |
+		grep "$@" $(pwd) $(pwd) readonly -eu && && 'quoted text' test -eu "$1"
+2>/dev/null "$@" -eu echo "$1" "$1" --verbose done sed grep awk
+		--verbose echo awk export echo echo sed printf "$@" ${HOME}
+	-eu readonly local 'quoted text'
+		grep test | local test grep printf cd printf ${HOME}
+		2>/dev/null x=1 cd --verbose ${HOME} "$@" local export
+sed grep echo export ${HOME} "$@" -eu
+&& x=1 2>/dev/null test "$@" grep cd "$@"
+export done export -eu "$1" echo grep local && && && grep "$@" --verbose cd sed
+	| local /usr/bin sed /usr/bin
+		-eu /usr/bin --verbose x=1 then ${HOME} "$@" test
+	sed local awk --verbose done "$1" x=1 local export grep && && | test "$1" && printf
+	${HOME} awk readonly && done && awk ${HOME} "$1" /usr/bin export && $(pwd)
+2>/dev/null ${HOME} $(pwd) test /usr/bin -eu -eu "$@" $(pwd) awk && ${HOME} ${HOME}
+	echo echo 'quoted text' /usr/bin grep readonly echo readonly cd local x=1 -eu
+${HOME} -eu export cd && $(pwd) then echo && local
+		${HOME} test -eu awk x=1 && awk $(pwd) /usr/bin sed awk
+		"$1" grep && -eu then export printf readonly "$1" readonly
+	${HOME} | $(pwd) && | x=1 local done 2>/dev/null -eu sed ${HOME}
+	${HOME} | echo grep ${HOME} && 'quoted text'
+		done && $(pwd) readonly -eu x=1 x=1 | x=1 x=1 done test sed done
+	then --verbose sed local echo "$1" cd awk export && "$1" done && test | test "$1"
+	readonly "$@" done "$@" sed cd echo /usr/bin printf echo --verbose
+	$(pwd) && $(pwd) "$1" -eu 2>/dev/null "$1" printf
+		test export /usr/bin echo done --verbose | printf done x=1
+		then --verbose 'quoted text' echo printf 'quoted text' echo sed export
+	cd && echo then && awk readonly grep echo readonly echo done grep && $(pwd) "$1"
+	x=1 2>/dev/null 2>/dev/null done awk "$@" printf | $(pwd)
+		'quoted text' echo /usr/bin "$1" -eu readonly readonly /usr/bin
+	echo | x=1 'quoted text' | "$1"
+-eu 2>/dev/null ${HOME} done x=1 | readonly echo printf x=1 done | grep
+	grep x=1 -eu then printf --verbose awk done awk done x=1 grep -eu ${HOME}
+	x=1 | echo x=1 2>/dev/null sed done then printf "$1" "$@"
+	"$1" readonly export &&
+2>/dev/null cd "$1" printf cd awk local printf awk awk then cd ${HOME} printf
+	readonly awk ${HOME} && | 'quoted text'
+cd && x=1 local ${HOME} awk 'quoted text' && sed printf then echo readonly -eu readonly
+		'quoted text' awk /usr/bin "$1" && $(pwd) export grep && /usr/bin echo
+2>/dev/null 2>/dev/null 2>/dev/null export x=1 awk $(pwd)
+$(pwd) "$1" local sed done awk | then "$@" x=1 'quoted text' 2>/dev/null
+readonly echo test local printf local && grep grep 'quoted text'
+test --verbose echo local
+		printf local && && grep test $(pwd) readonly readonly "$1" cd awk echo local
+	export | done cd | cd export then "$@" then then "$1" readonly grep ${HOME} "$@"
+cd "$1" ${HOME} --verbose --verbose
+grep printf -eu ${HOME} then test then awk echo $(pwd) && 2>/dev/null test ${HOME}
+		done then local | grep readonly x=1 --verbose
+		export cd 'quoted text'
+${HOME} && 'quoted text'
+		x=1 cd readonly cd ${HOME} test
+$(pwd) "$@" ${HOME} grep done grep 'quoted text'
+grep && "$@" printf x=1 cd "$1" "$@" export x=1 | 2>/dev/null --verbose
+		2>/dev/null test 2>/dev/null
+		then local /usr/bin x=1 readonly echo done
+"$@" "$1" export -eu printf local
+		grep printf grep x=1 then local grep
+		-eu 'quoted text' local export "$@" /usr/bin local sed /usr/bin /usr/bin && -eu
+		test local done cd cd /usr/bin done /usr/bin readonly
+sed echo | "$@" printf then done && then then printf then done done x=1 export
+		test grep grep echo then 'quoted text'
+	'quoted text' ${HOME} -eu -eu 2>/dev/null x=1 grep -eu 2>/dev/null "$@" 'quoted text'
+	local 'quoted text' then --verbose
+readonly printf echo cd "$@" x=1 ${HOME} awk ${HOME} sed
+		awk 2>/dev/null --verbose printf --verbose
+sed 2>/dev/null "$1" done && printf /usr/bin
+/usr/bin test /usr/bin | "$@" && done echo
+	2>/dev/null then "$@" echo printf sed ${HOME} 2>/dev/null --verbose ${HOME}
+	-eu echo grep local --verbose done "$@" echo printf
+'quoted text' done | done 2>/dev/null 2>/dev/null
+		awk "$1" printf $(pwd) readonly grep grep "$@" x=1 export then $(pwd) awk /usr/bin
+		readonly -eu && echo export done test sed done
+cd 2>/dev/null local "$@" $(pwd) grep /usr/bin ${HOME} ${HOME}
+readonly ${HOME} "$1" awk "$1" x=1 awk grep printf 'quoted text'
+test "$1" echo awk local then awk cd ${HOME} -eu
+	-eu readonly ${HOME} awk -eu ${HOME}
+	| && && then -eu ${HOME} cd -eu printf
+&& printf then | | done "$@" printf $(pwd) then echo test readonly x=1 | sed /usr/bin
+	readonly ${HOME} printf x=1 $(pwd) sed grep $(pwd) $(pwd) x=1
+	--verbose $(pwd) export && test
+${HOME} | readonly local sed export $(pwd) printf
+		local grep | printf local /usr/bin -eu 2>/dev/null then grep printf
+	printf sed && export x=1 | | "$1" "$@" local echo /usr/bin $(pwd)
+	local done x=1 sed && done
+/usr/bin readonly printf local -eu printf /usr/bin x=1 then
+		then local && ${HOME} local
+"$@" echo x=1 -eu -eu printf ${HOME} --verbose then export grep /usr/bin x=1
+		-eu cd printf ${HOME} then | sed -eu 2>/dev/null "$@" done
+'quoted text' sed done echo test x=1 | "$@"
+	2>/dev/null echo | then /usr/bin /usr/bin
+	printf 'quoted text' "$@" cd grep ${HOME} 'quoted text'
+grep x=1 2>/dev/null "$1"
+		&& ${HOME} -eu awk readonly sed "$1" test && test -eu cd then -eu awk /usr/bin
+		awk grep sed /usr/bin "$1" readonly 'quoted text'
+/usr/bin awk readonly x=1 then 'quoted text' x=1 done
+readonly readonly readonly
+printf readonly -eu grep ${HOME} /usr/bin /usr/bin local then x=1
+'quoted text' test done | x=1 'quoted text' /usr/bin
+		--verbose printf 'quoted text' -eu local x=1
+/usr/bin local 2>/dev/null awk readonly awk cd --verbose
+	x=1 | test | sed /usr/bin "$1" export sed /usr/bin readonly echo -eu x=1 -eu
+grep echo "$@" -eu printf "$1" | ${HOME} --verbose 'quoted text' ${HOME}
+		'quoted text' /usr/bin grep && local "$1" export 'quoted text' sed
+		done printf then printf -eu local export cd echo
+	/usr/bin && $(pwd) && --verbose -eu x=1 "$1" 'quoted text' 2>/dev/null "$1"
+local done done printf /usr/bin
+		&& ${HOME} x=1 then ${HOME}
+awk $(pwd) export /usr/bin grep
+	--verbose x=1 | "$1" x=1
+	test --verbose local readonly /usr/bin readonly ${HOME} "$@" sed cd 'quoted text'
+cd readonly ${HOME} export "$1" 'quoted text' local -eu local "$@" "$@" 'quoted text'
+		2>/dev/null "$1" sed printf cd local
+${HOME} echo then "$@" cd 2>/dev/null
+		2>/dev/null --verbose grep --verbose 'quoted text' | printf
+	local done $(pwd) readonly x=1 local
+		test grep local awk readonly 2>/dev/null /usr/bin
+	--verbose 2>/dev/null "$@" done sed
+--verbose 2>/dev/null && grep echo ${HOME} 2>/dev/null
+&& awk 2>/dev/null export "$@" 2>/dev/null 2>/dev/null grep test test test
+	printf 2>/dev/null grep local /usr/bin echo ${HOME} && /usr/bin
+grep echo printf sed then grep x=1 local -eu "$@" awk 'quoted text'
+		sed printf echo 2>/dev/null local -eu done -eu $(pwd) /usr/bin
+	local -eu test echo readonly awk -eu sed export
+export 'quoted text' readonly cd grep test "$@" "$@" then test /usr/bin
+		local | sed "$1" test echo awk local 'quoted text' ${HOME} grep
+		&& local then --verbose sed x=1 -eu ${HOME} x=1 export $(pwd) 2>/dev/null awk
+awk | "$1" readonly $(pwd)
+	awk && grep readonly --verbose awk readonly printf cd -eu x=1 echo printf
+	&& | 'quoted text' then then sed echo printf && --verbose
+	x=1 | x=1 && ${HOME} "$1" "$1" test /usr/bin readonly ${HOME}
+		-eu && awk $(pwd) -eu export && then grep /usr/bin then ${HOME} x=1
+	"$@" grep sed printf && sed test cd printf 2>/dev/null echo $(pwd) echo grep
+	echo cd -eu -eu done /usr/bin "$@" --verbose grep "$@" awk "$@" |
+		&& x=1 echo --verbose --verbose echo $(pwd) sed
+	2>/dev/null grep readonly local $(pwd)
+	"$1" $(pwd) | printf ${HOME}
+		'quoted text' "$1" "$@" echo echo 'quoted text' test done
+	-eu local printf printf x=1 echo sed | awk then "$1" then 'quoted text' then
+&& local /usr/bin -eu cd /usr/bin sed
+		readonly local done then printf && echo "$1" $(pwd) sed export 'quoted text'
+		"$@" $(pwd) done cd 'quoted text' printf test local -eu ${HOME} done --verbose sed
+	--verbose ${HOME} test grep done | | $(pwd)
+		printf printf $(pwd) printf
+		export local grep test "$1" grep awk x=1 cd "$1" test
+		&& awk awk "$@" cd "$@" echo
+	/usr/bin sed sed local "$@" grep
+	"$@" printf echo export awk local 2>/dev/null
+then 'quoted text' readonly --verbose readonly
+		then echo readonly export grep /usr/bin cd -eu --verbose local
+		$(pwd) | export /usr/bin /usr/bin 2>/dev/null 'quoted text' done
+	| awk echo 'quoted text' local -eu grep | cd sed local export ${HOME}
+		$(pwd) done echo cd readonly -eu | cd then --verbose
+&& awk $(pwd) export local cd echo
+		grep then -eu export -eu awk /usr/bin "$@" grep readonly grep grep 2>/dev/null
+	$(pwd) done echo && test ${HOME} "$@" readonly
+	sed /usr/bin "$@" local /usr/bin | awk echo --verbose
+grep awk --verbose grep done "$1" /usr/bin 2>/dev/null
+'quoted text' 2>/dev/null grep printf local && printf test --verbose
+local 'quoted text' readonly "$@" "$1" done export sed then
+		test ${HOME} printf ${HOME} ${HOME} test local /usr/bin test
+&& grep ${HOME} local done --verbose
+cd printf | export printf awk "$@"
+echo x=1 -eu 2>/dev/null /usr/bin && --verbose "$@" done
+-eu awk "$1" awk $(pwd) echo then then export sed "$@" --verbose local "$@"
+		${HOME} ${HOME} $(pwd) /usr/bin grep echo 'quoted text' readonly local
+	readonly ${HOME} x=1 | "$1" local --verbose
+	/usr/bin test local then printf echo cd ${HOME} sed test grep
+export "$@" done test --verbose done printf ${HOME} --verbose readonly
+cd test done readonly "$1" grep grep cd "$@" --verbose
+echo "$@" --verbose then export x=1 echo sed | ${HOME} grep --verbose
+grep 2>/dev/null grep local /usr/bin
+${HOME} "$1" "$@" grep ${HOME}
+	cd --verbose sed -eu test "$1" sed | $(pwd) echo $(pwd) $(pwd)
+	awk "$@" | sed "$1" /usr/bin sed x=1 2>/dev/null done "$@" $(pwd)
+	'quoted text' /usr/bin export awk 'quoted text' && --verbose 2>/dev/null
+	then printf && 2>/dev/null -eu sed "$1" local
+	echo local --verbose &&
+	x=1 local then && && "$@" $(pwd)
+	readonly x=1 "$1" echo sed /usr/bin -eu cd 'quoted text' /usr/bin
+	/usr/bin /usr/bin /usr/bin printf 2>/dev/null && local | readonly
+	'quoted text' awk && "$1" --verbose
+		| "$@" then then -eu "$@" /usr/bin sed 2>/dev/null echo ${HOME}
+/usr/bin "$1" "$@" && "$@" "$1" "$1" sed && | done local export printf x=1 "$1"
+		awk "$@" "$@" echo && | ${HOME} 'quoted text'
+	x=1 echo then --verbose 'quoted text' sed then export --verbose echo
+--verbose ${HOME} && cd readonly $(pwd)
+	then echo echo 'quoted text' awk 2>/dev/null -eu
+		"$@" done 2>/dev/null ${HOME} export $(pwd)
+	test && grep then 'quoted text' && done
+		'quoted text' "$@" && sed ${HOME} test readonly
+done printf $(pwd) then then "$@" x=1 printf local | awk "$@" && export
+	--verbose -eu awk "$1" cd test "$1" awk
+	--verbose "$@" sed done test printf ${HOME} cd --verbose
+		done "$@" /usr/bin done printf grep cd --verbose "$1"
+	${HOME} --verbose printf 'quoted text' local /usr/bin
+	"$@" -eu printf printf $(pwd)
+		cd /usr/bin --verbose
+		-eu printf 'quoted text' local --verbose
+--verbose local test sed sed
+	cd "$1" "$@" $(pwd) readonly local
+	x=1 test /usr/bin grep | && readonly "$1" printf
+"$@" grep && "$1" | /usr/bin | && grep --verbose
+		awk readonly x=1 --verbose && |
+| --verbose "$1" x=1 grep test ${HOME} awk export 'quoted text'
+		sed "$@" | $(pwd) sed cd export test export | grep test
+$(pwd) 2>/dev/null then grep sed "$@" export then
+		${HOME} then /usr/bin printf readonly x=1 export printf done echo | cd
+		"$1" sed /usr/bin $(pwd) cd export done 'quoted text'
+	"$@" awk && local printf done "$1" done
+		then x=1 readonly done grep --verbose
+		grep cd && ${HOME} x=1 test cd "$1" export test
+cd 'quoted text' done cd readonly
+2>/dev/null echo then "$1"
+	sed /usr/bin printf -eu sed echo && x=1
+	${HOME} done ${HOME} cd echo then
+	echo sed cd /usr/bin sed cd 2>/dev/null
+sed readonly 2>/dev/null echo test cd readonly | sed export
+sed export "$1" sed grep readonly then export
+done done ${HOME} sed -eu /usr/bin x=1 $(pwd)
+-eu then && | grep $(pwd) && | ${HOME} then | && export grep && x=1 x=1
+"$@" echo readonly echo | local done done
+	"$@" -eu awk export -eu awk sed x=1 "$@" done printf --verbose readonly
+		sed -eu -eu $(pwd) export 'quoted text' local readonly
+$(pwd) test "$@" -eu awk done echo | ${HOME} "$@" readonly
+then | 'quoted text' | test
+		echo test sed grep | then && "$@" /usr/bin printf done | x=1 grep | then done
+		local -eu --verbose x=1 x=1 grep test $(pwd) printf && test sed x=1
+export /usr/bin | 2>/dev/null awk test && printf printf "$1" ${HOME}
+export cd x=1 sed echo awk grep export -eu -eu grep local
+		"$1" test export export "$1" done | printf readonly
+	-eu test test export "$1"
+	-eu sed $(pwd) 'quoted text' && $(pwd) printf
+"$1" printf "$1" | sed printf then local awk sed printf
+		${HOME} "$1" done 2>/dev/null ${HOME}
+&& ${HOME} test -eu $(pwd) cd $(pwd)
+grep printf 2>/dev/null cd readonly test then -eu /usr/bin
+		test export readonly printf echo done export
+		echo readonly done --verbose
+		/usr/bin then | cd 'quoted text' /usr/bin awk $(pwd) x=1 /usr/bin echo "$@"
+		$(pwd) --verbose local x=1 2>/dev/null x=1 test
+printf x=1 then local sed ${HOME} && export export echo grep
+	"$1" then 'quoted text' awk "$@" 2>/dev/null
+	grep cd --verbose awk then sed done $(pwd) grep sed done
+		2>/dev/null grep cd local --verbose "$@" awk ${HOME} done sed ${HOME}
+		&& $(pwd) printf awk done export
+		${HOME} test 'quoted text' 'quoted text' --verbose | readonly 2>/dev/null
+	-eu | readonly | --verbose test $(pwd) echo 'quoted text' /usr/bin then $(pwd)
+| local done -eu sed awk -eu sed grep && "$1" echo grep | "$1" readonly
+-eu x=1 2>/dev/null |
+x=1 'quoted text' printf 'quoted text' printf "$@" then echo
+	x=1 --verbose && "$1" $(pwd) grep echo "$1"
+"$1" sed --verbose && --verbose
+export "$1" "$1" "$@" "$1"
+	-eu export cd "$@" readonly | "$@" export 2>/dev/null
+grep "$1" export "$1" done done --verbose echo && $(pwd) -eu
+		| 'quoted text' echo sed | ${HOME} printf then x=1 | printf
+| ${HOME} -eu $(pwd) /usr/bin then readonly 2>/dev/null readonly x=1 awk 'quoted text'
+${HOME} "$@" $(pwd) done awk cd local done cd
+		"$@" $(pwd) /usr/bin grep 'quoted text' --verbose "$1" printf grep
+	-eu -eu printf 2>/dev/null | "$1" | then 'quoted text' done
+	done grep /usr/bin done $(pwd) then && readonly "$@"
+		then cd local printf | export readonly test echo done 2>/dev/null ${HOME}
+		cd sed /usr/bin | && sed test "$@" $(pwd) awk | && awk --verbose
+&& readonly && readonly sed local awk /usr/bin /usr/bin test $(pwd)
+		local then && printf readonly | "$1" 2>/dev/null awk /usr/bin 2>/dev/null 2>/dev/null
+		echo "$1" --verbose | then 2>/dev/null test
+		readonly sed export done local awk done readonly
+--verbose done readonly &&
+grep done "$1" /usr/bin local
+awk ${HOME} cd grep sed x=1 test | readonly && $(pwd) cd "$@" test test
+${HOME} "$1" echo $(pwd) && printf -eu test ${HOME} && -eu then local ${HOME}
+/usr/bin sed cd local /usr/bin
+	-eu awk grep readonly 'quoted text' export
+	done | | sed "$1" && --verbose 'quoted text' 2>/dev/null
+| x=1 && local grep readonly | printf awk local
+2>/dev/null awk $(pwd) "$1" grep echo local && 'quoted text'
+printf sed cd /usr/bin "$@" readonly x=1 sed "$1" cd && 'quoted text' 2>/dev/null
+	sed "$1" cd test then "$@" /usr/bin
+local done echo | sed
+		local "$@" "$1" grep /usr/bin echo local "$@" then cd then sed cd
+	grep "$@" cd && grep x=1 "$@" x=1 x=1 && "$@" awk
+	awk --verbose -eu /usr/bin local echo
+		grep then printf /usr/bin &&
+	-eu 2>/dev/null 2>/dev/null
+--verbose 'quoted text'
+		'quoted text' readonly grep -eu export ${HOME}
+		-eu test 2>/dev/null --verbose && echo test /usr/bin grep /usr/bin
+grep && ${HOME} readonly
+	echo then | x=1 "$@" | x=1 2>/dev/null then readonly ${HOME}
+"$1" x=1 "$1" readonly "$@" sed readonly /usr/bin then
+		then sed printf awk local 'quoted text'
+	| 2>/dev/null 'quoted text' --verbose
+2>/dev/null grep awk printf $(pwd) -eu ${HOME} x=1 cd --verbose "$1" done sed
+		then x=1 sed readonly "$@" done && done $(pwd) | x=1 "$1" "$@" 2>/dev/null 'quoted text'
+		--verbose -eu "$@" "$1" ${HOME} export -eu then sed -eu local 2>/dev/null
+		-eu awk readonly grep test $(pwd) | then test then /usr/bin sed $(pwd)
+	export grep then --verbose
+readonly --verbose 2>/dev/null x=1 grep 2>/dev/null done printf done export
+		"$@" ${HOME} /usr/bin && -eu sed "$1" grep printf x=1 then "$@" -eu "$@"
+-eu x=1 --verbose ${HOME} 2>/dev/null --verbose awk 'quoted text' x=1 sed ${HOME}
+"$@" done cd local && cd awk ${HOME} readonly 'quoted text' then
+&& test awk 'quoted text' awk
+		local | /usr/bin 'quoted text' readonly then 2>/dev/null ${HOME} $(pwd) test
+--verbose $(pwd) && export test test /usr/bin echo "$@" && grep
+		cd /usr/bin ${HOME} | 2>/dev/null | /usr/bin done ${HOME}
+	awk echo grep test x=1 sed -eu export ${HOME} "$1" local "$1" | sed printf
+--verbose test ${HOME} | local --verbose "$1"
+&& 'quoted text' grep /usr/bin sed export awk sed -eu export && awk
+	local printf printf test
+		/usr/bin "$1" ${HOME} printf && 'quoted text' cd printf awk &&
+	'quoted text' && "$1" $(pwd) && printf $(pwd) echo ${HOME}
+		echo --verbose /usr/bin local echo -eu 'quoted text' | 2>/dev/null
+awk "$1" printf && "$@" local
+		readonly local echo printf "$1" echo printf local -eu
+		test x=1 local grep | -eu test
+--verbose printf && sed printf sed echo x=1 "$@"
+'quoted text' done echo export --verbose "$1" && -eu test echo x=1
+	${HOME} echo "$1" test /usr/bin
+	local test cd local local "$@" && printf grep x=1 --verbose "$1"
+		'quoted text' awk 2>/dev/null
+	${HOME} sed "$@" 'quoted text' --verbose $(pwd) export
+then cd echo then printf -eu cd cd echo done awk awk done export test
+		readonly printf echo /usr/bin "$@" done "$1" x=1 readonly
+${HOME} printf "$1" 'quoted text' then ${HOME} "$1" -eu -eu ${HOME}
+		$(pwd) ${HOME} $(pwd) ${HOME}
+	grep awk -eu ${HOME} cd test printf
+		test printf -eu cd 2>/dev/null printf awk ${HOME} 'quoted text'
+2>/dev/null 2>/dev/null sed printf $(pwd)
+		then then local | ${HOME} printf
+${HOME} && /usr/bin sed local
+	-eu local $(pwd) -eu | cd awk
+		| && echo awk readonly readonly test echo --verbose "$@" export -eu
+	local ${HOME} printf x=1 'quoted text'
+		printf 2>/dev/null "$@" then test | echo "$@" then $(pwd) echo $(pwd)
+		cd "$1" --verbose | && test | x=1 export printf
+"$1" --verbose && $(pwd) ${HOME} $(pwd)
+	echo $(pwd) /usr/bin then $(pwd) x=1 sed --verbose then 'quoted text' &&
+	$(pwd) 'quoted text' printf "$@" $(pwd) ${HOME} x=1 cd done
+		"$1" "$@" -eu "$@" 2>/dev/null
+		/usr/bin 2>/dev/null printf | x=1
+	test echo 2>/dev/null 'quoted text' printf "$@" -eu test cd done
+export ${HOME} && grep
+		2>/dev/null $(pwd) done readonly $(pwd) done x=1 export
+	&& --verbose x=1 "$@" 2>/dev/null "$1"
+	${HOME} printf then test then x=1 cd $(pwd) &&
+awk 'quoted text' "$1" 'quoted text' done | ${HOME} --verbose | echo "$1" cd -eu
+		2>/dev/null 'quoted text' done "$1" $(pwd) local && local
+printf done $(pwd) cd -eu export
+	grep --verbose cd printf /usr/bin then && 'quoted text'
+$(pwd) $(pwd) cd $(pwd) cd --verbose sed && && done "$1"
+cd printf /usr/bin export ${HOME} 2>/dev/null
+	"$1" ${HOME} echo test --verbose echo
+	echo /usr/bin test grep sed 2>/dev/null local echo "$1" -eu cd 'quoted text'
+	&& ${HOME} -eu printf 2>/dev/null "$1" x=1 x=1 local ${HOME} awk | awk
+		grep grep local then "$@" 'quoted text' test cd --verbose --verbose
+		"$@" awk -eu "$@" test | local $(pwd) local
+		2>/dev/null echo printf local --verbose export sed x=1 grep echo x=1
+	&& /usr/bin then export 'quoted text' $(pwd) x=1
+		2>/dev/null ${HOME} then test printf 2>/dev/null -eu grep 'quoted text'
+then 2>/dev/null 2>/dev/null $(pwd) grep
+		readonly local awk awk echo test | then
+		&& local 2>/dev/null then
+test awk x=1 printf then -eu && printf
+	$(pwd) awk export -eu /usr/bin cd readonly grep then
+	"$@" ${HOME} "$1" x=1 export /usr/bin -eu
+		cd 'quoted text' && echo "$1"
+export --verbose local /usr/bin | awk
+		x=1 awk && -eu /usr/bin cd cd -eu sed $(pwd) &&
+	echo done then readonly
+/usr/bin printf && "$@" printf $(pwd) /usr/bin 'quoted text'
+	cd then cd x=1 grep sed $(pwd) then then --verbose
+		--verbose test --verbose awk awk --verbose
+	done x=1 'quoted text' 'quoted text'
+"$1" sed printf --verbose
+$(pwd) echo sed "$1" done done && $(pwd) done done -eu sed -eu x=1
+		"$@" local done sed done
+	printf done awk test echo test readonly "$@" x=1 /usr/bin -eu printf
+		echo "$1" echo /usr/bin 'quoted text' test printf
+	${HOME} done sed local && /usr/bin
+		2>/dev/null ${HOME} 'quoted text' "$1" --verbose
+		export "$@" awk then $(pwd)
+	| /usr/bin && ${HOME} 2>/dev/null "$@" then x=1 readonly sed echo x=1 awk awk
+		then test 2>/dev/null $(pwd) && awk cd local cd done cd "$1" --verbose
+then cd "$@" "$@" echo test grep awk "$@" -eu ${HOME} done readonly
+sed echo local 'quoted text' | printf /usr/bin sed done
+		$(pwd) test 'quoted text' ${HOME} readonly | ${HOME} 'quoted text' ${HOME} cd 'quoted text'
+	"$1" export 'quoted text' --verbose $(pwd) x=1 $(pwd) "$1" 'quoted text'
+-eu ${HOME} then local sed readonly
+readonly ${HOME} printf "$1" -eu ${HOME} && 2>/dev/null local then test
+		$(pwd) "$1" sed | local export 'quoted text' grep "$1"
+		"$@" $(pwd) "$1" printf echo then /usr/bin test grep -eu x=1 local grep sed ${HOME}
+		$(pwd) /usr/bin sed awk awk sed -eu test printf && | export then 'quoted text'
+		sed local --verbose grep "$@" echo && grep export 'quoted text'
+	2>/dev/null && local echo awk echo sed sed "$1"
+	"$1" ${HOME} -eu && ${HOME} 2>/dev/null "$@" "$1" 'quoted text' readonly echo
+cd printf then 2>/dev/null 'quoted text' cd "$@" &&
+		then /usr/bin local cd 'quoted text' ${HOME} test --verbose && "$@" awk
+	--verbose --verbose ${HOME}
+	done sed done | /usr/bin echo cd printf 'quoted text' 2>/dev/null
+	--verbose 'quoted text' "$1" ${HOME} /usr/bin sed /usr/bin 'quoted text'
+2>/dev/null export --verbose
+		grep done test ${HOME} $(pwd) cd --verbose awk
+done cd 2>/dev/null export $(pwd) readonly printf /usr/bin cd printf export
+cd | 2>/dev/null 2>/dev/null -eu sed && ${HOME}
+	readonly printf -eu --verbose
+		-eu --verbose 'quoted text' printf awk 'quoted text'
+		readonly then "$@" "$@" 'quoted text'
+		$(pwd) sed echo ${HOME} test
+grep -eu /usr/bin "$@" export 2>/dev/null grep
+	cd /usr/bin x=1 ${HOME} grep
+local ${HOME} grep x=1 "$@" ${HOME} && sed /usr/bin local grep sed
+		done echo echo -eu 'quoted text'
+	export x=1 printf $(pwd) sed "$@" sed cd 2>/dev/null --verbose
+&& readonly cd sed && grep sed readonly --verbose export
+	2>/dev/null readonly -eu test -eu 2>/dev/null
+x=1 echo then /usr/bin export test printf x=1 'quoted text' -eu
+export cd printf $(pwd)
+| ${HOME} ${HOME} && sed | printf --verbose "$1" then
+		/usr/bin local readonly --verbose echo echo printf readonly "$1" 2>/dev/null
+	| 2>/dev/null cd printf done done then then done sed $(pwd) sed echo /usr/bin
+printf awk sed then then --verbose echo then $(pwd) "$@" echo /usr/bin export
+-eu 'quoted text' -eu readonly test 'quoted text' x=1 ${HOME} $(pwd) /usr/bin local
+		2>/dev/null awk readonly && cd local
+readonly x=1 printf awk then local ${HOME}
+		then ${HOME} readonly then export grep grep /usr/bin then -eu x=1 export
+		then "$1" done awk "$1" 2>/dev/null local export awk $(pwd) | 2>/dev/null
+2>/dev/null grep 'quoted text' sed -eu test test ${HOME}
+	/usr/bin 2>/dev/null local then sed "$@" "$@" -eu $(pwd) /usr/bin "$@" x=1
+		cd --verbose local export $(pwd) | readonly "$1" | --verbose
+	local 'quoted text' readonly | printf echo done $(pwd) echo ${HOME}
+x=1 echo && $(pwd) printf $(pwd)
+		grep "$1" --verbose local 2>/dev/null test printf -eu -eu
+		then "$1" readonly -eu echo ${HOME} echo printf done | 'quoted text'
+		| --verbose grep then done export cd 'quoted text' readonly
+		/usr/bin local 2>/dev/null sed printf
+		&& readonly && printf -eu 'quoted text'
+		sed test printf sed cd $(pwd)
+readonly $(pwd) export echo "$1" done /usr/bin | "$@"
+		'quoted text' ${HOME} 'quoted text' local
+test "$1" x=1 local then $(pwd) printf printf $(pwd) /usr/bin then
+	cd /usr/bin export ${HOME} local done "$@" test
+	export /usr/bin --verbose test printf cd sed ${HOME} then printf cd
+local && test 'quoted text' -eu
+echo ${HOME} /usr/bin && 2>/dev/null
+/usr/bin -eu && $(pwd) awk readonly readonly 2>/dev/null ${HOME}
+		then grep echo readonly $(pwd) --verbose
+		/usr/bin --verbose x=1 "$@"
+		grep -eu --verbose export && 2>/dev/null awk printf "$@" echo 'quoted text'
+'quoted text' "$@" /usr/bin grep --verbose
+then ${HOME} sed && && -eu --verbose local 'quoted text'
+	2>/dev/null then printf | "$1" 'quoted text' "$1" /usr/bin local readonly then
+	cd awk echo | ${HOME} readonly done "$1"
+readonly printf awk echo "$1"
+		x=1 export sed 2>/dev/null --verbose --verbose | "$@" awk local x=1
+-eu 'quoted text' -eu && grep $(pwd) "$@" test -eu grep done
+		grep sed -eu test "$1" test test awk cd done readonly grep
+		$(pwd) grep && printf $(pwd) --verbose
+		readonly awk "$1" sed ${HOME} sed --verbose
+sed 2>/dev/null grep awk -eu export --verbose export done then ${HOME} readonly
+	export --verbose -eu ${HOME}
+	done export | sed readonly awk readonly -eu then then
+	x=1 readonly echo readonly
+		echo local done ${HOME} /usr/bin
+2>/dev/null "$@" test 2>/dev/null 'quoted text'
+local --verbose "$1"
+	awk | then $(pwd) cd test echo 'quoted text' -eu && "$@" export x=1 /usr/bin 2>/dev/null
+${HOME} local sed then then test done | export echo /usr/bin
+		test export echo export $(pwd) 'quoted text' printf && -eu grep
+	'quoted text' awk "$1" ${HOME} "$@" done "$@" x=1 then cd $(pwd)
+	grep awk 'quoted text' then done sed 2>/dev/null awk "$@"
+	/usr/bin && 'quoted text' awk && printf | | test
+export awk && export -eu "$@" then "$@" local 2>/dev/null "$@" --verbose sed
+	awk awk then 'quoted text' && x=1
+		readonly 'quoted text' 2>/dev/null
+2>/dev/null && sed echo done then readonly local local export 'quoted text'
+cd x=1 'quoted text' export local /usr/bin awk awk done readonly /usr/bin
+	"$1" export readonly grep then && /usr/bin done export export 'quoted text'
+$(pwd) echo done $(pwd) done local done local done
+"$1" echo $(pwd) && done echo x=1 local
+	echo -eu "$1" echo echo echo echo test then export -eu cd test | then 2>/dev/null
+		grep 2>/dev/null local then sed test
+	--verbose echo grep awk then ${HOME}
+		$(pwd) done 2>/dev/null echo --verbose awk "$@" printf x=1 --verbose grep
+/usr/bin local awk cd /usr/bin -eu then | then ${HOME}
+	test cd test x=1 then -eu x=1 $(pwd) 2>/dev/null 'quoted text'
+	'quoted text' printf done test echo 'quoted text' local ${HOME} && "$@"
+'quoted text' export echo local 2>/dev/null
+&& /usr/bin printf 'quoted text' --verbose && test | "$1" ${HOME}
+	awk export "$@" -eu readonly awk printf --verbose readonly test x=1
+/usr/bin readonly echo $(pwd) done "$1"
+x=1 sed done "$@" ${HOME} "$@"
+$(pwd) x=1 done ${HOME} && cd x=1 "$@"
+		--verbose sed x=1 local $(pwd) readonly ${HOME} --verbose readonly ${HOME}
+	/usr/bin /usr/bin "$@" then 2>/dev/null printf 'quoted text' export -eu
+	$(pwd) ${HOME} export export test /usr/bin | && ${HOME} printf
+		&& "$@" $(pwd) /usr/bin && test --verbose printf && "$1" export readonly
+	2>/dev/null then export ${HOME} 'quoted text' done local awk then x=1 ${HOME}
+then local done grep x=1 local
+"$@" 'quoted text' cd grep --verbose sed
+	'quoted text' grep grep $(pwd) sed --verbose export 2>/dev/null
+| ${HOME} --verbose cd local sed
+	$(pwd) sed printf 2>/dev/null export
+		2>/dev/null printf 2>/dev/null printf ${HOME}
+export /usr/bin then ${HOME} local | ${HOME} grep test 2>/dev/null
+		readonly echo printf 2>/dev/null export /usr/bin echo
+		"$@" readonly 2>/dev/null done grep "$1" --verbose --verbose sed sed cd export
+		test 'quoted text' /usr/bin ${HOME}
+printf x=1 $(pwd) $(pwd) printf x=1
+		$(pwd) "$@" export /usr/bin done readonly printf
+echo local $(pwd) /usr/bin
+	sed 2>/dev/null export x=1 grep 'quoted text' && then
+	grep done "$@" printf awk then "$@" sed readonly
+	test && echo printf | sed ${HOME} echo done export && x=1 test && 2>/dev/null
+		test $(pwd) && "$@" local $(pwd) /usr/bin /usr/bin cd
+-eu "$@" sed local grep printf ${HOME} test
+	readonly echo && export test awk /usr/bin local done "$@" --verbose export
+	x=1 readonly cd -eu local printf x=1 x=1 local 2>/dev/null awk grep
+awk printf "$1" 2>/dev/null awk --verbose export sed
+export && done --verbose 2>/dev/null 'quoted text'
+	${HOME} /usr/bin "$@" /usr/bin cd --verbose
+echo $(pwd) "$@" --verbose 2>/dev/null
+	local /usr/bin printf --verbose then then readonly awk "$@" -eu awk
+| $(pwd) export grep $(pwd) local 'quoted text'
+		echo ${HOME} test "$@" sed --verbose readonly
+| awk test $(pwd) --verbose
+	x=1 grep awk /usr/bin | readonly local -eu --verbose
+2>/dev/null printf then && /usr/bin 2>/dev/null
+grep then export cd x=1 sed echo x=1
+readonly done sed echo cd 'quoted text' 'quoted text'
+		2>/dev/null grep --verbose test --verbose
+		export | ${HOME} grep --verbose echo $(pwd) -eu local echo readonly grep ${HOME}
+	cd local | echo awk test ${HOME} then local cd --verbose awk then
+2>/dev/null sed x=1 export ${HOME}
+readonly cd 'quoted text' awk --verbose grep local
+		"$@" awk 2>/dev/null |
+	export grep -eu echo export x=1 echo | local
+		"$@" grep ${HOME} sed ${HOME} --verbose export &&
+| awk grep readonly local --verbose --verbose
+		awk $(pwd) "$1" /usr/bin done export cd "$1" x=1 x=1 /usr/bin echo test
+		local 2>/dev/null 'quoted text' cd sed export /usr/bin
+'quoted text' 2>/dev/null 'quoted text' ${HOME} ${HOME} "$1" x=1 export -eu 'quoted text'
+&& $(pwd) cd done export 'quoted text'
+/usr/bin | /usr/bin awk echo 'quoted text' x=1 grep 'quoted text' /usr/bin grep
+grep "$@" test "$1" local grep
+	"$1" awk export test sed sed 2>/dev/null "$@" x=1 /usr/bin 'quoted text'
+	/usr/bin export && "$@" done --verbose then export
+		grep 'quoted text' printf local ${HOME}
+cd $(pwd) readonly 'quoted text' grep awk local "$@" "$@"
+		--verbose --verbose /usr/bin
+	${HOME} local echo done "$@"
+		grep 'quoted text' --verbose
+	2>/dev/null readonly /usr/bin ${HOME} --verbose cd
+		x=1 sed "$1" x=1 export sed "$@" 'quoted text' --verbose 'quoted text' test
+		/usr/bin --verbose 'quoted text' test grep awk -eu printf 'quoted text'
+&& 'quoted text' then && | "$@" "$@" echo
+$(pwd) "$1" -eu x=1 done readonly awk local readonly cd x=1 grep "$@" /usr/bin
+done "$1" then grep echo "$1"
+export readonly --verbose then | local
+		printf awk echo sed "$1" echo "$@" then export export
+"$1" /usr/bin done 'quoted text' 2>/dev/null
+	echo ${HOME} --verbose echo ${HOME} "$@" $(pwd)
+		2>/dev/null cd x=1 | 'quoted text' | done $(pwd) | x=1 ${HOME} then
+sed && -eu x=1 grep $(pwd)
+'quoted text' test readonly
+		export 'quoted text' grep awk --verbose &&
+		readonly -eu | --verbose
+		$(pwd) readonly export $(pwd) readonly local $(pwd)
+	sed readonly --verbose printf done
+	export $(pwd) $(pwd) $(pwd) sed sed ${HOME} 'quoted text' $(pwd) cd 2>/dev/null
+	x=1 x=1 done test readonly "$1" export x=1 printf ${HOME} 'quoted text'
+"$@" 2>/dev/null printf local --verbose "$@" awk $(pwd) 'quoted text' /usr/bin
+	export local 2>/dev/null "$@"
+done awk x=1 | cd sed 2>/dev/null cd -eu awk && test local printf
+printf sed grep 'quoted text' 2>/dev/null 2>/dev/null done 2>/dev/null --verbose
+		'quoted text' local && done -eu | -eu local /usr/bin "$@"
+		grep ${HOME} 2>/dev/null export && 2>/dev/null 2>/dev/null 'quoted text'
+sed | then readonly && local
+grep --verbose then /usr/bin grep done local
+	"$1" then "$@" export /usr/bin
+/usr/bin printf local 2>/dev/null grep then "$@" done $(pwd) sed
+echo echo cd awk cd "$@" && awk export sed
+		test | $(pwd) readonly ${HOME} | cd --verbose cd | done
+	| echo && test "$@" 'quoted text' sed && then ${HOME} $(pwd) readonly $(pwd)
+		done | readonly echo | export && -eu "$1" 'quoted text'
+		| cd 2>/dev/null --verbose ${HOME} $(pwd) "$@" |
+	/usr/bin sed $(pwd) cd sed $(pwd) awk sed x=1 export "$@" readonly /usr/bin readonly
+	x=1 2>/dev/null grep ${HOME} && sed grep x=1 echo && readonly grep echo
+	cd printf test 'quoted text' test
+x=1 printf readonly --verbose
+	awk $(pwd) done echo --verbose echo ${HOME} awk readonly --verbose
+	&& /usr/bin readonly "$1" local cd ${HOME} x=1 readonly
+		--verbose -eu --verbose cd local
+	export | ${HOME} $(pwd) cd readonly -eu echo "$@" "$@" -eu /usr/bin $(pwd)
+/usr/bin 'quoted text' "$@" ${HOME} && "$1" then grep grep then 'quoted text'
+	"$1" | | /usr/bin "$1" "$1" 'quoted text' printf
+	cd 'quoted text' "$@" test awk cd
+2>/dev/null --verbose /usr/bin -eu local ${HOME} 2>/dev/null
+		printf local -eu readonly 2>/dev/null 'quoted text' grep done cd 2>/dev/null
+then --verbose "$1" done | awk 'quoted text' x=1 "$@" test printf "$@" awk
+"$@" && readonly $(pwd) "$@" printf -eu readonly test x=1 echo awk -eu then
+awk --verbose awk printf 'quoted text'
+		$(pwd) readonly test export echo ${HOME} --verbose
+local | 'quoted text' -eu printf echo export readonly
+		awk $(pwd) ${HOME} local
+grep grep x=1 2>/dev/null test export local $(pwd) cd
+	sed export echo local $(pwd)
+/usr/bin readonly done $(pwd) --verbose --verbose -eu
+		${HOME} awk /usr/bin --verbose cd --verbose && -eu grep
+printf cd --verbose && && $(pwd) grep -eu printf
+		&& --verbose then 'quoted text' echo | local
+then cd grep ${HOME} x=1 export export
+	sed grep | local /usr/bin export ${HOME}
+		-eu /usr/bin 2>/dev/null x=1 echo /usr/bin test && 2>/dev/null export | sed grep
+2>/dev/null "$@" "$@" --verbose --verbose grep grep
+"$1" "$@" local local $(pwd) $(pwd) sed done
+	--verbose 'quoted text' readonly $(pwd) "$1"
+	cd export cd -eu $(pwd) --verbose 'quoted text'
+		-eu echo export x=1 $(pwd) awk awk "$@" sed sed ${HOME} echo readonly export
+/usr/bin ${HOME} /usr/bin done cd 2>/dev/null x=1 && 2>/dev/null $(pwd) --verbose
+echo && local x=1 /usr/bin ${HOME} awk awk && --verbose awk
+then /usr/bin local sed && awk "$@" ${HOME}
+local cd sed then then
+		x=1 local && 'quoted text' 'quoted text'
+		$(pwd) 2>/dev/null 'quoted text' echo sed
+		done done sed cd "$1" test done -eu test ${HOME} --verbose
+	$(pwd) sed sed ${HOME} test
+| $(pwd) x=1 echo then
+		-eu ${HOME} local cd --verbose cd cd export export --verbose $(pwd) "$@" printf
+"$1" | ${HOME} sed grep "$1" "$@" grep 2>/dev/null sed local grep then
+		"$1" readonly export "$1" export sed export ${HOME}
+printf printf && -eu /usr/bin readonly readonly x=1 test printf done
+		x=1 echo ${HOME} "$@" local | "$@" && $(pwd) echo && -eu "$1" readonly
+		--verbose "$@" ${HOME} /usr/bin
+		awk "$1" && echo awk printf "$1"
+	export done done 2>/dev/null readonly awk
+	/usr/bin done sed && cd export
+	test "$@" x=1 'quoted text' && sed
+| awk && printf 2>/dev/null readonly /usr/bin sed
+		$(pwd) export cd "$1" export grep 2>/dev/null
+/usr/bin test export "$1" --verbose echo local printf readonly x=1 printf
+		grep --verbose test then printf | test printf -eu export "$@"
+		echo printf "$@" 'quoted text' sed -eu test local | "$1"
+| then done export ${HOME} "$1" readonly
+| -eu echo 2>/dev/null $(pwd) 'quoted text' "$@" sed /usr/bin
+2>/dev/null ${HOME} -eu
+x=1 x=1 && test 2>/dev/null
+		$(pwd) done echo sed "$1" printf cd awk --verbose
+		grep ${HOME} then grep
+	/usr/bin $(pwd) $(pwd) ${HOME} -eu -eu ${HOME} && /usr/bin
+		local sed test printf ${HOME} $(pwd)
+${HOME} echo export -eu cd readonly
+		$(pwd) export cd "$@" then x=1 cd awk export --verbose && "$@" local && --verbose
+	readonly -eu sed sed
+		grep && test $(pwd) "$1" $(pwd) | sed test grep 2>/dev/null
+$(pwd) cd printf echo && x=1 /usr/bin sed echo local echo x=1
+grep ${HOME} x=1 printf echo echo $(pwd) --verbose /usr/bin && awk "$1" --verbose
+		echo grep sed x=1 echo /usr/bin
+	then x=1 grep cd x=1 then | "$1" /usr/bin 2>/dev/null && $(pwd)
+		--verbose cd then -eu "$1" x=1 -eu ${HOME} && grep --verbose "$@" readonly |
+	local echo ${HOME} echo done sed && echo -eu done 2>/dev/null local --verbose
+		echo --verbose echo $(pwd) $(pwd) | "$@" then
+then | echo echo "$1" $(pwd) 'quoted text' --verbose -eu
+export awk "$@" "$1" "$@" readonly
+		2>/dev/null then && x=1 grep grep sed
+	sed echo /usr/bin 2>/dev/null grep x=1 && $(pwd) done sed then local printf
+	'quoted text' done -eu && && | 2>/dev/null sed test awk printf awk
+sed readonly test --verbose sed "$1" ${HOME}
+		--verbose "$1" test done x=1 /usr/bin ${HOME} /usr/bin
+	"$1" ${HOME} grep printf then x=1 -eu grep "$@" export printf
+	grep done "$1" local printf $(pwd) "$1" $(pwd) "$@" 2>/dev/null "$1" | echo
+		$(pwd) then $(pwd) "$1" export then cd printf $(pwd) "$1" printf
+	$(pwd) $(pwd) x=1 grep 'quoted text' 'quoted text' done cd cd ${HOME}
+	x=1 "$@" 'quoted text' done readonly
+		local 'quoted text' echo 'quoted text' -eu then grep cd cd printf /usr/bin 'quoted text'
+	2>/dev/null x=1 then -eu cd 2>/dev/null $(pwd)
+	'quoted text' x=1 echo printf echo echo -eu "$1"
+cd local cd 2>/dev/null then "$@" x=1 test test 2>/dev/null
+		then then printf sed export awk ${HOME} --verbose $(pwd) test done && x=1
+		local 2>/dev/null export
+"$1" printf | --verbose readonly sed
+'quoted text' --verbose then printf && printf local
+		x=1 test $(pwd) | cd $(pwd) 2>/dev/null readonly test "$@" grep
+-eu $(pwd) echo readonly cd then printf 'quoted text'
+awk /usr/bin "$@" x=1 $(pwd)
+x=1 readonly 'quoted text' "$1" 'quoted text' echo
+		sed /usr/bin | x=1 echo ${HOME} 2>/dev/null
+		-eu /usr/bin /usr/bin cd && local ${HOME} x=1 x=1 x=1 awk echo "$1"
+		export readonly | /usr/bin
+		"$@" x=1 awk && test sed printf | x=1 $(pwd) ${HOME} awk
+	grep awk printf -eu && export
+'quoted text' then 2>/dev/null 2>/dev/null
+		sed "$1" 2>/dev/null local -eu export $(pwd) "$1" then
+-eu $(pwd) x=1 test then printf | sed export --verbose --verbose
+	grep cd ${HOME} sed -eu --verbose grep |
+		"$1" | readonly "$1"
+		cd readonly "$1" ${HOME} sed printf
+	echo /usr/bin 2>/dev/null local --verbose "$1" && "$@" ${HOME} done $(pwd)
+	2>/dev/null then | --verbose
+	awk | | "$@" /usr/bin done test grep 2>/dev/null
+${HOME} "$1" readonly "$@" "$1"
+	"$1" echo ${HOME} export echo export 'quoted text' then /usr/bin ${HOME} sed ${HOME}
+	$(pwd) readonly cd cd test ${HOME} awk 2>/dev/null
+/usr/bin printf printf sed then --verbose done grep 'quoted text' /usr/bin $(pwd)
+-eu sed | printf export "$1" printf grep | test cd readonly cd x=1
+&& /usr/bin local ${HOME} done -eu echo $(pwd) -eu grep local $(pwd) done
+		sed readonly export cd then awk && awk 'quoted text' then ${HOME} test done /usr/bin
+	printf 'quoted text' done ${HOME} | done export
+"$@" sed export export ${HOME} export
+export x=1 awk export test 2>/dev/null 2>/dev/null
+	2>/dev/null done && x=1 test cd done readonly test test "$@" --verbose 'quoted text'
+	done -eu x=1 --verbose "$1" && x=1 then awk then cd --verbose grep sed -eu
+		echo echo 'quoted text' then done cd $(pwd) | && x=1 && done &&
+#include c161.sh
+--verbose 2>/dev/null export -eu /usr/bin awk printf --verbose cd awk
+		${HOME} echo sed echo -eu ${HOME} export ${HOME} "$1" /usr/bin
+		'quoted text' 2>/dev/null 2>/dev/null -eu x=1 cd --verbose --verbose awk export
+	$(pwd) x=1 | "$@" then sed | "$@" printf
+	grep | awk echo echo --verbose
+	printf x=1 "$1" printf done test readonly readonly 2>/dev/null
+	${HOME} cd done -eu sed -eu |
+--verbose done then | echo then test done done -eu then test ${HOME} "$1" done
+/usr/bin --verbose sed awk ${HOME} test
+	readonly /usr/bin $(pwd) 'quoted text'
+2>/dev/null grep cd -eu "$1" --verbose test --verbose
+		"$@" test | cd grep cd done 2>/dev/null printf
+		readonly local awk test ${HOME} readonly
+		/usr/bin then 2>/dev/null then sed --verbose then
+cd 2>/dev/null -eu local readonly sed done && echo sed then
+		grep grep then export
+		x=1 2>/dev/null then printf
+	grep 'quoted text' printf
+		test awk printf cd "$@" --verbose cd /usr/bin ${HOME}
+then cd $(pwd) echo | $(pwd) |
+2>/dev/null test awk export "$@" cd ${HOME} test then "$@" awk printf
+	then echo test 2>/dev/null test printf x=1 2>/dev/null then && done
+	| test sed local cd cd test export ${HOME} 2>/dev/null
+'quoted text' -eu sed awk local grep 2>/dev/null x=1 readonly
+	/usr/bin ${HOME} 'quoted text' ${HOME} cd x=1 2>/dev/null
+		${HOME} test awk awk 'quoted text' cd awk
+	| "$@" $(pwd) local test
+	readonly -eu -eu sed test done x=1 done cd ${HOME} awk export grep "$@" ${HOME}
+		"$@" 'quoted text' done printf $(pwd) 'quoted text' 2>/dev/null --verbose
+| grep -eu x=1 --verbose awk test "$@" "$@" awk sed
+		cd x=1 printf test grep x=1 2>/dev/null x=1 $(pwd)
+		echo "$1" ${HOME} test $(pwd) $(pwd) local $(pwd) --verbose
+grep awk readonly ${HOME} $(pwd) awk -eu "$1" -eu --verbose awk grep sed && 'quoted text'
+		echo && grep cd export "$@" test && test "$1" -eu test local /usr/bin
+		printf /usr/bin --verbose 'quoted text' export awk | -eu 2>/dev/null
+		"$@" then ${HOME} grep export ${HOME} done
+		${HOME} printf 'quoted text' done test awk --verbose $(pwd) readonly "$@" local
+--verbose /usr/bin "$1" && export "$@" 'quoted text' awk local
+		grep printf | "$@" ${HOME} x=1 /usr/bin readonly
+		export sed | --verbose awk | printf --verbose readonly
+	done printf | && grep && ${HOME} grep ${HOME} printf
+test done cd && echo | grep ${HOME} grep sed printf then
+x=1 local cd printf --verbose -eu "$1" readonly "$1"
+		&& local && done export cd echo /usr/bin
+| /usr/bin grep done export 2>/dev/null ${HOME}
+echo -eu && && /usr/bin
+| done local done $(pwd) echo awk --verbose && cd
+"$1" done && cd | cd $(pwd) readonly /usr/bin cd "$1" printf
+	cd test awk sed printf | echo export 'quoted text' echo local | echo test "$@"
+		echo -eu /usr/bin done | test readonly 'quoted text' sed test test cd
+		then test && 'quoted text' | local
+2>/dev/null 2>/dev/null sed --verbose test ${HOME}
+	${HOME} local local /usr/bin x=1 |
+		grep "$1" then export export 'quoted text' $(pwd) 'quoted text'
+		readonly -eu readonly readonly | local $(pwd)
+		test "$1" grep awk 'quoted text' "$@" 'quoted text' && --verbose
+	local ${HOME} | test then local
+		/usr/bin then "$@" 'quoted text' -eu
+		x=1 && 'quoted text' x=1 "$1" awk grep test /usr/bin readonly -eu -eu && $(pwd)
+		readonly $(pwd) printf x=1 sed "$1" test x=1 'quoted text' awk grep $(pwd)
+"$@" cd && grep && -eu "$1" cd echo --verbose ${HOME} ${HOME} | awk --verbose
+		readonly echo "$@" x=1 done /usr/bin $(pwd) cd cd $(pwd) cd | test
+| readonly /usr/bin then sed --verbose "$1" done && cd "$@" ${HOME}
+	/usr/bin echo --verbose grep -eu -eu ${HOME} 2>/dev/null
+		printf 2>/dev/null ${HOME} --verbose sed | sed -eu
+	--verbose x=1 "$@" 'quoted text' && -eu test readonly done "$1" test
+		then $(pwd) test printf 'quoted text' --verbose | export 'quoted text' done cd
+printf awk | 2>/dev/null local && done local && readonly cd then 'quoted text'
+x=1 cd test grep done sed
+	"$@" local test awk "$@" printf
+/usr/bin -eu grep echo x=1 'quoted text' | --verbose done printf awk &&
+	echo $(pwd) export awk 'quoted text' readonly | readonly readonly test ${HOME}
+cd echo /usr/bin | export 2>/dev/null then cd && test local
+		x=1 /usr/bin printf | readonly 2>/dev/null
+printf cd printf test "$1" done awk export awk printf
+		| test /usr/bin readonly | "$1" cd cd x=1 echo cd cd sed /usr/bin "$@" "$@"
+		--verbose x=1 done "$1" test printf ${HOME}
+		readonly cd printf sed | | echo cd --verbose "$1" x=1 then
+		-eu --verbose awk ${HOME} awk sed printf grep printf printf sed echo
+		then | "$1" ${HOME} && 'quoted text' x=1 export then ${HOME} "$1" /usr/bin | printf
+		local -eu x=1 | 'quoted text' printf echo /usr/bin
+		test $(pwd) test && then --verbose "$1" readonly cd then export then export
+	-eu 'quoted text' "$@" /usr/bin echo cd echo 'quoted text'
+		awk /usr/bin $(pwd) ${HOME} done --verbose cd grep
+then echo && ${HOME} x=1 "$@" 'quoted text' export --verbose
+grep 'quoted text' echo "$@" $(pwd) local
+2>/dev/null -eu /usr/bin /usr/bin 'quoted text' local echo awk |
+		readonly $(pwd) grep /usr/bin /usr/bin local 2>/dev/null done "$1" | ${HOME} -eu
+done $(pwd) | awk ${HOME} cd "$1" /usr/bin -eu | readonly grep "$1" --verbose
+		'quoted text' --verbose x=1 --verbose | then
+	then awk printf ${HOME}
+| test grep "$1" echo sed "$@" then printf $(pwd) ${HOME} printf $(pwd) --verbose
+		'quoted text' done sed done | -eu echo awk && 'quoted text' x=1 sed -eu cd
+		cd sed awk -eu echo /usr/bin
+		/usr/bin sed local "$@" local --verbose
+	&& "$@" then $(pwd) local then $(pwd) local /usr/bin done test export readonly
+--verbose 2>/dev/null "$1" test x=1 awk --verbose "$@" readonly readonly test
+	readonly "$@" echo && x=1 "$1" "$@" readonly
+		&& done ${HOME} "$1" "$1" then "$@" "$1" sed && 2>/dev/null grep
+-eu echo "$1" local 2>/dev/null
+export --verbose printf $(pwd) && | ${HOME} $(pwd) /usr/bin
+		sed 2>/dev/null echo 2>/dev/null done awk sed local 'quoted text' awk readonly ${HOME}
+	readonly awk -eu readonly test | x=1 echo | printf export
+local ${HOME} awk 2>/dev/null x=1 && local done 2>/dev/null then --verbose
+		printf sed local 'quoted text' ${HOME} 'quoted text'
+	$(pwd) && printf awk --verbose
+		grep && test then printf ${HOME} awk local
+done grep readonly "$1" 'quoted text' awk awk cd /usr/bin sed 2>/dev/null
+	export "$@" awk cd /usr/bin then x=1 sed "$@" /usr/bin cd /usr/bin
+/usr/bin && -eu export echo sed done
+	$(pwd) printf test test "$1" done sed readonly --verbose
+	sed /usr/bin cd && 'quoted text' ${HOME} --verbose test
+		sed "$1" printf grep awk
+		x=1 printf | --verbose then sed export "$@" grep 2>/dev/null
+		/usr/bin test cd grep then ${HOME} echo /usr/bin echo | then && /usr/bin
+		${HOME} x=1 ${HOME} grep then sed 'quoted text' readonly
+| | /usr/bin done ${HOME} "$1" 'quoted text' then
+	readonly x=1 echo x=1 export --verbose && /usr/bin
+		"$@" readonly export
+		$(pwd) 2>/dev/null ${HOME} then done
+	local awk echo "$@" $(pwd) --verbose grep export -eu
+"$1" x=1 | | --verbose $(pwd) | local then --verbose 'quoted text'
+cd local readonly done "$1" local
+		"$@" "$1" ${HOME} -eu /usr/bin grep
+	export 2>/dev/null grep 'quoted text' x=1 grep awk $(pwd) 2>/dev/null
+'quoted text' -eu test x=1 | cd "$1" grep 2>/dev/null readonly /usr/bin
+	2>/dev/null $(pwd) /usr/bin sed 2>/dev/null ${HOME}
+		${HOME} "$1" test done $(pwd)
+		readonly x=1 && /usr/bin --verbose $(pwd) x=1 "$1" sed ${HOME} | "$@" cd $(pwd)
+	then "$@" test "$1" && local export
+sed test $(pwd) x=1 -eu | done | --verbose | cd "$1" awk "$1"
+then echo ${HOME} "$@" && grep /usr/bin -eu $(pwd) && local 'quoted text'
+grep done -eu done --verbose | grep && echo
+		"$1" test echo && readonly done printf grep --verbose grep echo ${HOME} grep
+	local x=1 export local sed "$1" echo --verbose "$1" sed && ${HOME} export then
+2>/dev/null x=1 /usr/bin "$@" "$@" | awk $(pwd) test local
+	-eu cd cd $(pwd) "$@" local -eu
+2>/dev/null test sed then echo
+	then x=1 -eu --verbose 2>/dev/null awk done
+		-eu /usr/bin /usr/bin then $(pwd) x=1 done done | "$1" -eu 'quoted text' &&
+	--verbose "$@" cd readonly local readonly grep "$1" 'quoted text' local
+		| grep ${HOME} export local "$@" printf $(pwd) $(pwd) --verbose
+x=1 && test local grep cd printf local 2>/dev/null --verbose
+	local $(pwd) "$@" -eu awk done local -eu readonly
+	&& test done readonly sed test done $(pwd)
+test sed readonly | printf -eu test local export printf cd awk printf 2>/dev/null
+	&& -eu grep then 'quoted text' "$1" "$@" && done
+awk awk && -eu sed readonly test done ${HOME} then
+/usr/bin echo done awk "$1"
+		echo "$1" "$1" 2>/dev/null printf readonly 'quoted text'
+	grep /usr/bin echo test "$1" echo done
+	then done test -eu 2>/dev/null /usr/bin
+--verbose "$1" printf 'quoted text' -eu echo --verbose
+	printf /usr/bin ${HOME} readonly ${HOME} "$@" cd printf 'quoted text'
+		${HOME} -eu 'quoted text' awk cd grep x=1 printf 'quoted text' && ${HOME} sed
+&& /usr/bin && "$1" sed sed
+		export done local x=1 awk echo $(pwd) printf "$@" readonly /usr/bin
+		&& then | local | "$1" --verbose echo printf
+		sed done done | x=1 awk printf
+		then cd "$@" export "$1" cd "$1"
+&& export echo awk --verbose test $(pwd) ${HOME} 2>/dev/null
+		${HOME} && "$@" 2>/dev/null --verbose "$@" then printf 2>/dev/null printf
+		| $(pwd) done ${HOME} printf readonly "$@" cd then awk test && 2>/dev/null -eu
+x=1 x=1 $(pwd) local done echo $(pwd) | /usr/bin /usr/bin
+"$@" sed grep "$1" --verbose && "$1" printf
+	grep --verbose sed local "$@"
+grep test echo done && sed && then 'quoted text'
+	export --verbose awk "$1" -eu "$@"
+		${HOME} done && "$1" echo
+'quoted text' readonly echo cd "$@" "$1" ${HOME}
+	sed cd | && $(pwd) local 2>/dev/null local local then cd --verbose
+	cd test grep "$1" /usr/bin | readonly local export awk
+		2>/dev/null printf --verbose -eu | done 'quoted text' /usr/bin test ${HOME}
+	--verbose | "$1" 'quoted text' ${HOME} printf && grep
+		x=1 then echo 'quoted text' --verbose
+	| $(pwd) ${HOME} local local local test ${HOME} cd "$1" "$@"
+	local "$@" x=1 2>/dev/null --verbose
+-eu x=1 grep --verbose "$@" /usr/bin grep ${HOME} done test local $(pwd) grep cd
+then 2>/dev/null 'quoted text' test | | $(pwd) printf echo "$@" && awk
+cd "$@" sed done awk "$1" 'quoted text'
+		x=1 awk /usr/bin done local
+	$(pwd) cd $(pwd) x=1 | x=1 then local -eu grep sed cd printf | /usr/bin
+	/usr/bin --verbose printf 'quoted text' 2>/dev/null x=1
+	2>/dev/null local done x=1 sed test export cd && "$1" export cd -eu printf ${HOME}
+then $(pwd) test "$@" x=1 then "$@"
+		"$@" printf $(pwd) awk test -eu x=1 printf local
+"$1" /usr/bin sed /usr/bin
+cd readonly --verbose -eu cd done 'quoted text' "$1" cd grep /usr/bin && awk printf
+		awk 'quoted text' local cd && grep ${HOME}
+	"$@" x=1 done local awk readonly --verbose --verbose grep 'quoted text' /usr/bin
+		sed /usr/bin cd "$1" done export
+		2>/dev/null local && "$@" printf cd test
+		&& ${HOME} awk done grep test /usr/bin echo echo ${HOME}
+'quoted text' 'quoted text' ${HOME}
+printf $(pwd) done /usr/bin export cd local x=1
+	then awk export test | | --verbose
+		-eu grep 2>/dev/null export then --verbose /usr/bin printf cd -eu grep printf
+		'quoted text' | 'quoted text' "$@" | export
+		then 'quoted text' 'quoted text' 'quoted text'
+		grep "$1" ${HOME} readonly --verbose 2>/dev/null echo 'quoted text' && "$@"
+		echo --verbose export printf 'quoted text' --verbose
+		2>/dev/null && printf awk done && && sed readonly $(pwd) &&
+	export $(pwd) && printf
+		x=1 test $(pwd) readonly readonly printf cd local $(pwd) ${HOME} ${HOME} ${HOME}
+	2>/dev/null export printf readonly 'quoted text'
+awk $(pwd) sed test grep
+-eu "$@" local /usr/bin | cd test -eu "$1" printf awk readonly x=1 x=1
+$(pwd) 2>/dev/null ${HOME} awk x=1 local test
+	"$@" export --verbose readonly done
+	"$@" echo printf awk 2>/dev/null test cd export x=1 echo -eu local "$1"
+		readonly awk awk 2>/dev/null
+	"$@" 2>/dev/null x=1 export x=1 test cd awk "$1"
+grep echo done local test --verbose test local x=1
+grep && test $(pwd) printf done x=1 done sed echo awk cd then -eu x=1
+	readonly $(pwd) readonly sed readonly
+	'quoted text' printf awk $(pwd) | local done $(pwd) local
+-eu export -eu /usr/bin export 'quoted text' /usr/bin test 'quoted text'
+		--verbose ${HOME} -eu -eu export && 2>/dev/null | --verbose "$1" local
+--verbose $(pwd) ${HOME}
+echo awk printf printf echo readonly then done
+		grep export x=1 awk readonly
+export cd test | echo x=1
+		sed /usr/bin awk export awk x=1 grep && 'quoted text'
+then -eu test "$1" sed x=1 2>/dev/null -eu grep
+	2>/dev/null -eu sed -eu test printf
+	printf test ${HOME} cd && 2>/dev/null test awk /usr/bin
+		/usr/bin done /usr/bin then "$1" $(pwd) /usr/bin test ${HOME}
+x=1 cd grep $(pwd) -eu grep test && /usr/bin
+	$(pwd) ${HOME} grep echo export x=1 done echo | x=1 ${HOME} /usr/bin ${HOME} cd
+	${HOME} ${HOME} x=1 local done 'quoted text' grep $(pwd) x=1
+x=1 /usr/bin awk --verbose | sed sed cd export 2>/dev/null
+		/usr/bin printf $(pwd) printf then $(pwd) local test
+done cd x=1 ${HOME} x=1 echo "$@" grep export echo grep
+	local ${HOME} /usr/bin | echo 2>/dev/null
+'quoted text' ${HOME} | sed cd
+	2>/dev/null grep then /usr/bin echo echo test echo 'quoted text' export && 2>/dev/null
+then $(pwd) "$1" done done done ${HOME} grep echo
+--verbose then echo ${HOME} done
+	export --verbose 'quoted text' cd export
+		readonly $(pwd) 2>/dev/null && readonly && x=1 2>/dev/null
+done "$1" -eu awk then printf export /usr/bin grep "$@" "$1" done 'quoted text'
+	done printf && done sed printf && --verbose echo x=1 export -eu | ${HOME} awk
+		readonly then ${HOME} && -eu ${HOME} 2>/dev/null | ${HOME} -eu
+	"$1" cd awk && && printf ${HOME} "$@" | /usr/bin
+2>/dev/null done /usr/bin ${HOME} readonly --verbose 2>/dev/null awk local
+		| /usr/bin && | $(pwd) /usr/bin test local local readonly -eu 2>/dev/null grep
+	--verbose "$1" | printf
+| 2>/dev/null cd printf 'quoted text' then export export --verbose $(pwd)
+&& readonly "$@" 2>/dev/null done -eu 'quoted text' | cd awk
+| readonly readonly done $(pwd) $(pwd) ${HOME} 'quoted text'
+		local --verbose "$1" sed "$1" grep then done export grep
+cd "$1" "$1" | && local local 'quoted text' export "$1" --verbose
+		grep | readonly /usr/bin | 2>/dev/null && x=1 done -eu $(pwd)
+		'quoted text' printf x=1 printf awk $(pwd)
+sed ${HOME} readonly readonly then 2>/dev/null 2>/dev/null x=1 local awk
+sed done cd local && grep readonly done && echo readonly test local
+		x=1 test test /usr/bin "$@" local $(pwd) "$@" cd sed -eu cd
+		x=1 test grep printf done
+		printf "$1" /usr/bin local readonly grep -eu
+	-eu $(pwd) cd test cd | export 2>/dev/null awk
+	readonly | grep cd -eu --verbose done x=1 grep && then then
+		echo printf export sed 'quoted text' "$@"
+'quoted text' echo printf "$@"
+2>/dev/null $(pwd) awk awk grep && x=1
+		readonly x=1 echo sed | && 'quoted text' sed | printf
+printf local && -eu done
+		"$@" --verbose readonly then x=1
+grep $(pwd) cd $(pwd) local
+sed grep "$@" 'quoted text'
+	x=1 echo printf --verbose "$1" 2>/dev/null awk 2>/dev/null 'quoted text'
+then readonly 'quoted text' cd sed 2>/dev/null local done
+	sed echo local /usr/bin x=1
+		sed --verbose --verbose /usr/bin then --verbose $(pwd) test sed 2>/dev/null done
+		'quoted text' | | 2>/dev/null readonly
+test done printf "$@" -eu awk test x=1 printf printf printf --verbose
+	x=1 grep | test ${HOME} | --verbose readonly grep printf cd 2>/dev/null
+x=1 "$1" ${HOME} && cd export done /usr/bin echo printf
+		--verbose readonly printf done cd test && /usr/bin grep printf
+"$1" sed && then export x=1
+		| done 2>/dev/null 2>/dev/null 'quoted text' x=1 $(pwd) done sed
+"$@" sed echo /usr/bin readonly 2>/dev/null /usr/bin local cd
+		echo cd /usr/bin -eu -eu ${HOME} -eu /usr/bin && "$@" ${HOME} --verbose
+	awk done $(pwd) grep -eu "$1"
+sed "$@" "$@" -eu test x=1 /usr/bin done x=1 | then then export
+	| "$1" then sed && 'quoted text' x=1 2>/dev/null 'quoted text' /usr/bin 'quoted text'
+		awk --verbose done x=1 grep 2>/dev/null
+	local $(pwd) ${HOME} && sed ${HOME} test export ${HOME} done grep
+2>/dev/null 'quoted text' $(pwd) 2>/dev/null readonly cd $(pwd)
+	test local | cd sed done grep done local awk ${HOME}
+	echo x=1 cd | done export --verbose
+		test readonly sed 'quoted text' /usr/bin ${HOME} --verbose && 2>/dev/null
+		x=1 | echo 'quoted text' test
+		printf grep awk /usr/bin ${HOME} grep "$1" $(pwd) printf then done
+		x=1 $(pwd) awk ${HOME} -eu
+| test "$@" && "$1" test 'quoted text'
+		&& then -eu cd 2>/dev/null echo awk cd awk sed x=1 $(pwd) $(pwd)
+echo && test grep -eu /usr/bin cd $(pwd) --verbose readonly grep "$1" x=1
+-eu grep readonly 2>/dev/null "$@" sed echo printf then export
+| ${HOME} done x=1 "$@" grep echo && then
+	"$1" --verbose /usr/bin printf "$@" sed readonly sed awk local
+then /usr/bin ${HOME} awk
+/usr/bin sed "$1" x=1 grep
+		x=1 readonly "$@" grep && 'quoted text' $(pwd) grep -eu ${HOME} then "$@" sed printf
+awk ${HOME} ${HOME} $(pwd) export
+awk 'quoted text' done ${HOME} echo then -eu "$@" ${HOME} local local 'quoted text'
+		${HOME} readonly && echo -eu done -eu test grep
+x=1 echo "$1" 2>/dev/null readonly "$@" |
+		readonly 2>/dev/null --verbose export export sed $(pwd) -eu
+		"$@" $(pwd) $(pwd) done awk
+		done printf ${HOME} "$@"
+		x=1 /usr/bin x=1 --verbose 'quoted text'
+	$(pwd) test test ${HOME} local /usr/bin x=1 export
+grep | "$1" x=1 done
+		test local /usr/bin test 2>/dev/null done
+	-eu "$1" sed /usr/bin readonly 2>/dev/null ${HOME} readonly "$@" awk -eu echo
+then then --verbose sed local sed cd /usr/bin grep echo export awk 2>/dev/null
+export /usr/bin readonly awk awk
+readonly -eu | sed done grep ${HOME} && $(pwd) awk
+&& sed -eu sed "$@" readonly x=1 local
+		--verbose grep then readonly "$1" 2>/dev/null
+	${HOME} then ${HOME} x=1 -eu | x=1 readonly -eu local $(pwd) ${HOME}
+		export readonly sed grep readonly grep
+		test sed ${HOME} cd x=1 echo local echo echo $(pwd) ${HOME} && local
+readonly cd $(pwd) ${HOME} local done --verbose ${HOME} --verbose printf echo sed
+local | test echo printf printf x=1 /usr/bin --verbose grep readonly
+'quoted text' echo --verbose export grep grep
+		"$@" local x=1 done "$1" readonly awk then export sed | done awk $(pwd)
+grep 'quoted text' then local echo ${HOME} awk /usr/bin
+		then --verbose printf x=1
+readonly sed test $(pwd) sed printf "$@" local --verbose printf "$1" ${HOME}
+cd printf grep echo && -eu readonly /usr/bin
+		awk grep test echo echo
+		awk 'quoted text' test
+	cd grep done /usr/bin then readonly local x=1 ${HOME} readonly grep then /usr/bin
+		x=1 "$@" done printf readonly
+		awk 2>/dev/null then | cd
+export awk local x=1 then /usr/bin | readonly $(pwd)
+then readonly readonly "$1" printf test
+	done -eu x=1 test -eu x=1 awk "$@"
+		printf readonly && grep then | echo
+	-eu ${HOME} then x=1 'quoted text' sed local --verbose
+	local awk awk -eu -eu && echo --verbose
+printf && local ${HOME} cd x=1
+		done ${HOME} $(pwd) 2>/dev/null 2>/dev/null /usr/bin sed 2>/dev/null | ${HOME} done
+		readonly grep local && 'quoted text'
+"$@" /usr/bin 'quoted text' $(pwd) sed ${HOME} ${HOME} grep
+"$1" /usr/bin /usr/bin -eu readonly
+	2>/dev/null test 2>/dev/null && test "$@"
+x=1 readonly printf awk grep then export echo grep
+	export /usr/bin awk 'quoted text' done | 'quoted text' local then ${HOME}
+test echo printf echo $(pwd) printf
+	local printf "$@" x=1 sed grep && then sed 'quoted text' grep export ${HOME}
+	x=1 "$@" x=1 && -eu awk -eu sed ${HOME} printf ${HOME}
+	| $(pwd) printf export test
+| x=1 awk $(pwd) then grep readonly local
+		awk | ${HOME} "$@" grep then $(pwd) && "$@" && sed "$@"
+2>/dev/null $(pwd) ${HOME}
+	local export -eu "$@" | cd 'quoted text' readonly && $(pwd) echo sed -eu &&
+		| /usr/bin "$@" sed test /usr/bin echo ${HOME}
+then $(pwd) printf awk export "$1" echo --verbose --verbose &&
+	test readonly local printf awk 2>/dev/null
+	awk done -eu | $(pwd) grep x=1 -eu 2>/dev/null --verbose
+	sed $(pwd) done local then 'quoted text'
+		/usr/bin export test "$1"
+	"$1" test test printf cd $(pwd) "$@" readonly local
+		then x=1 grep --verbose ${HOME} -eu sed sed "$1" && local test $(pwd) /usr/bin
+	$(pwd) local export && "$1" local "$@" | then test cd x=1 sed cd "$@"
+-eu x=1 'quoted text' -eu sed x=1 done export sed "$@" printf
+| test then "$1" --verbose --verbose $(pwd) | "$1" readonly readonly
+		x=1 then 'quoted text' 2>/dev/null readonly
+${HOME} 2>/dev/null x=1 printf local readonly
+	x=1 "$@" then echo /usr/bin /usr/bin sed grep x=1 test &&
+		$(pwd) readonly done sed awk $(pwd) "$1" 2>/dev/null echo
+		local test $(pwd) 2>/dev/null export done 2>/dev/null printf cd $(pwd)
+	-eu | awk "$1" --verbose local export grep awk local --verbose
+${HOME} then "$@" echo "$1" then 2>/dev/null
+'quoted text' export export then "$@" cd then "$@" awk
+		/usr/bin readonly /usr/bin grep "$1" then && echo cd grep
+		$(pwd) 2>/dev/null grep sed local 'quoted text' awk awk local "$@"
+local local $(pwd) sed 2>/dev/null
+	"$@" test 'quoted text' printf x=1 local readonly
+then test local --verbose 'quoted text'
+	2>/dev/null then local /usr/bin
+$(pwd) --verbose cd /usr/bin printf "$@" then
+		x=1 "$@" "$@" ${HOME} echo echo $(pwd) | /usr/bin -eu done grep echo "$@" | $(pwd)
+	done sed && --verbose done printf sed awk x=1 2>/dev/null
+	"$@" | 'quoted text' 2>/dev/null -eu then export
+	/usr/bin grep awk printf export && $(pwd) cd echo readonly "$1" local "$@" export
+	printf then sed export --verbose done echo export readonly grep && --verbose
+then -eu $(pwd) "$@" x=1 awk sed $(pwd) /usr/bin x=1 /usr/bin echo printf test
+	"$@" /usr/bin /usr/bin "$1" local readonly 'quoted text'
+		2>/dev/null readonly "$@" && printf grep
+	--verbose then awk test $(pwd) && x=1 "$@" grep done done then echo cd x=1 sed
+		awk sed && /usr/bin 'quoted text' 2>/dev/null 'quoted text'
+		readonly local /usr/bin echo 2>/dev/null "$@"
+	grep grep $(pwd) done 2>/dev/null "$1" awk
+	local local export then printf | |
+	--verbose -eu "$@" printf then -eu
+	"$@" readonly "$@" sed "$1" "$1" && ${HOME} readonly ${HOME} printf
+		x=1 sed export export && ${HOME} export $(pwd) local test ${HOME} then && printf
+	"$1" test $(pwd) export "$@" --verbose "$1" readonly
+		echo done ${HOME} "$1" grep local export then then readonly cd $(pwd) echo 'quoted text'
+$(pwd) awk grep 2>/dev/null $(pwd) ${HOME} cd test done
+	grep test cd cd then test local
+"$1" --verbose --verbose grep "$1" --verbose
+	x=1 echo done cd export test then awk
+	${HOME} then test --verbose $(pwd) 'quoted text'
+	local sed sed sed cd "$1" /usr/bin done printf | export 'quoted text'
+	printf "$1" export cd 'quoted text'
+	2>/dev/null echo /usr/bin $(pwd) echo -eu export x=1 printf cd "$@" sed
+then sed done grep x=1 -eu readonly done echo then $(pwd) /usr/bin "$@" 'quoted text'
+| "$1" ${HOME} "$1" export then
+		test "$@" done export --verbose | ${HOME} export
+		$(pwd) $(pwd) cd | done
+	--verbose readonly "$1" --verbose "$1"
+	2>/dev/null && readonly "$1" then 'quoted text' "$1" && printf
+		local "$@" done then -eu then done | sed && test readonly grep /usr/bin
+	-eu $(pwd) ${HOME} 'quoted text'
+		then cd && /usr/bin && 2>/dev/null grep grep 'quoted text' -eu grep cd
+local /usr/bin readonly ${HOME} readonly test | --verbose -eu 2>/dev/null
+		done awk grep grep && x=1 sed grep 'quoted text' done
+	| x=1 then then done
+		/usr/bin | 'quoted text' x=1 | local ${HOME} cd done done
+	'quoted text' -eu export readonly grep $(pwd) done x=1
+2>/dev/null 'quoted text' readonly printf "$1"
+local local $(pwd) done 'quoted text' "$@" readonly
+	readonly /usr/bin printf echo export grep export cd ${HOME} x=1 --verbose
+	x=1 readonly test test done x=1 /usr/bin test readonly && local printf
+		cd done local $(pwd) 'quoted text' 2>/dev/null readonly then readonly done
+		| "$1" grep test grep -eu printf 'quoted text'
+	&& sed && grep awk /usr/bin awk && "$1" x=1 /usr/bin
+		$(pwd) ${HOME} x=1 'quoted text' --verbose test export ${HOME}
+/usr/bin /usr/bin export "$1" 2>/dev/null printf 'quoted text'
+test -eu printf "$1" export "$1" readonly /usr/bin readonly | 'quoted text'
+test local test local --verbose
+-eu done local test local readonly $(pwd) done
+		cd --verbose export "$1" printf --verbose cd &&
+		done echo --verbose ${HOME} 2>/dev/null
+		readonly -eu /usr/bin printf 2>/dev/null
+	x=1 done x=1 awk && x=1 test local test ${HOME}
+	then | local local | "$@" $(pwd) readonly 2>/dev/null echo echo --verbose cd
+		${HOME} | | echo ${HOME} cd && --verbose
+		sed awk export --verbose "$1" /usr/bin printf --verbose done printf $(pwd) grep
+	2>/dev/null then --verbose /usr/bin $(pwd) 'quoted text' && "$@" echo awk export
+	| "$@" 2>/dev/null $(pwd) awk
+	/usr/bin grep echo && awk awk x=1 export readonly
+	export /usr/bin test echo "$@" --verbose export $(pwd) done 'quoted text'
+		awk $(pwd) "$@" sed $(pwd) then then test
+	export "$1" echo 'quoted text' done
+export 'quoted text' echo done done echo x=1 echo /usr/bin 'quoted text'
+	| -eu then --verbose readonly --verbose done local ${HOME} done |
+	${HOME} 2>/dev/null test then && -eu
+	$(pwd) x=1 printf cd x=1 printf then sed --verbose export && "$@" -eu
+		cd local $(pwd) sed -eu -eu readonly && echo cd cd -eu
+	printf done test awk echo -eu sed && $(pwd) 'quoted text' sed 2>/dev/null
+		printf && grep x=1 | "$@" && awk --verbose sed -eu ${HOME}
+		export sed x=1 $(pwd) "$@" ${HOME} 'quoted text'
+done | $(pwd) echo readonly -eu
+		printf 2>/dev/null export "$@" && grep /usr/bin "$1"
+		-eu local printf x=1 'quoted text' 'quoted text'
+"$@" --verbose -eu done grep
+echo export "$@" local sed $(pwd) ${HOME} local -eu 2>/dev/null readonly printf
+	${HOME} /usr/bin done test 'quoted text'
+	${HOME} test awk 'quoted text' -eu done sed x=1 printf $(pwd) 'quoted text'
+readonly readonly export /usr/bin ${HOME} then printf $(pwd) then local grep
+		2>/dev/null "$1" $(pwd) sed && grep grep done export export
+	local cd test /usr/bin local /usr/bin then "$1" 2>/dev/null x=1
+	$(pwd) grep export cd "$1" test /usr/bin --verbose "$@" 2>/dev/null local
+		then | -eu export $(pwd) sed ${HOME} echo --verbose echo printf "$@"
+	then test -eu readonly grep echo /usr/bin cd test then | cd echo
+/usr/bin local 2>/dev/null
+test sed printf 2>/dev/null then grep awk sed x=1 sed echo
+done x=1 cd local printf awk local "$1" ${HOME} 2>/dev/null | 2>/dev/null readonly
+		done then 'quoted text' printf done 2>/dev/null printf
+		local | x=1 test "$@" printf /usr/bin local printf "$1" $(pwd) | $(pwd) printf
+export test "$@" 'quoted text' readonly | ${HOME} local test printf sed
+		printf awk printf /usr/bin printf grep cd echo export
+	then readonly local "$1" echo sed done /usr/bin local
+	sed x=1 x=1 | export export /usr/bin
+	-eu grep export export cd printf ${HOME} test awk grep grep echo "$1"
+	x=1 export -eu | $(pwd) printf
+		printf export 'quoted text' ${HOME} local x=1 readonly
+	sed /usr/bin then --verbose done
+		| sed then 2>/dev/null then /usr/bin echo -eu test
+		-eu x=1 test then x=1 -eu
+| readonly sed done cd ${HOME} sed | sed awk x=1 && $(pwd) x=1 local ${HOME}
+	/usr/bin cd local /usr/bin "$1" -eu &&
+	&& "$1" local | awk /usr/bin then "$@" /usr/bin 2>/dev/null
+		'quoted text' then x=1 awk 2>/dev/null local 'quoted text' awk then
+		2>/dev/null | "$1" 2>/dev/null --verbose "$@" grep printf
+	grep printf && sed printf then echo --verbose cd /usr/bin ${HOME}
+		export test test "$@" "$1" "$1" grep "$1" local grep /usr/bin printf echo
+	cd export 2>/dev/null ${HOME} local echo cd
+		"$@" grep cd local sed --verbose
+	| readonly done && "$@" then
+		sed 'quoted text' readonly cd sed "$@"
+done sed cd x=1 -eu ${HOME} cd -eu "$@" test done awk echo awk awk 2>/dev/null
+		sed && ${HOME} printf 2>/dev/null cd printf done sed "$1" sed $(pwd) --verbose
+		grep 2>/dev/null x=1 $(pwd) "$@" export
+'quoted text' --verbose readonly cd export ${HOME}
+	2>/dev/null $(pwd) sed --verbose awk awk echo x=1 sed "$1" test awk
+	test ${HOME} echo echo grep readonly && echo readonly ${HOME} ${HOME} x=1
+then readonly /usr/bin echo && grep test 2>/dev/null
+	--verbose && test export sed --verbose "$1" | --verbose export done
+		"$@" echo sed --verbose done then done 'quoted text' then --verbose then
+	awk export -eu -eu printf | grep cd /usr/bin sed ${HOME}
+2>/dev/null && 'quoted text' x=1 -eu -eu 2>/dev/null -eu && "$1" readonly ${HOME}
+	awk local awk test then done /usr/bin
+"$@" /usr/bin then printf export $(pwd)
+awk $(pwd) "$@" done test ${HOME}
+		awk -eu printf local awk grep sed sed "$@"
+x=1 'quoted text' grep "$@" && x=1 -eu 'quoted text'
+printf --verbose --verbose -eu test ${HOME} readonly 'quoted text'
+	then sed done export 2>/dev/null
+		awk awk done /usr/bin printf local then sed done && grep
+		awk x=1 "$1" && export test ${HOME} | 2>/dev/null
+		awk "$1" readonly local "$1" $(pwd) export "$@" --verbose printf then done grep
+	&& x=1 --verbose -eu "$1" && grep done "$1" awk printf "$@" "$@" --verbose "$@"
+"$1" test sed echo --verbose
+		--verbose readonly -eu | 2>/dev/null -eu
+	/usr/bin test 'quoted text' --verbose "$1" done -eu /usr/bin
+| cd cd $(pwd) printf printf && | && test "$@" readonly "$1"
+		'quoted text' export "$1" cd
+	-eu -eu test local 'quoted text' sed then export 2>/dev/null | | --verbose "$@"
+	printf sed test $(pwd) $(pwd) done 2>/dev/null "$@" grep grep
+		sed --verbose x=1 readonly |
+		| test && test $(pwd) then "$1" "$@" export sed 'quoted text'
+	&& test | local printf sed
+		export cd test test grep printf export
+		&& grep /usr/bin printf awk grep grep && $(pwd) export | x=1
+	--verbose local grep 'quoted text' x=1 $(pwd)
+grep echo done 2>/dev/null | then /usr/bin
+		readonly --verbose --verbose awk ${HOME} grep echo printf readonly $(pwd)
+	"$1" then /usr/bin cd ${HOME} 2>/dev/null export local printf --verbose
+export done sed then | 2>/dev/null readonly export "$@"
+	x=1 printf /usr/bin /usr/bin && --verbose --verbose
+--verbose "$1" readonly | then
+		export /usr/bin sed readonly && /usr/bin
+'quoted text' readonly echo 2>/dev/null test "$1"
+		test --verbose local done readonly 2>/dev/null grep $(pwd) test "$@" printf "$@"
+--verbose | 'quoted text'
+$(pwd) awk && awk && printf $(pwd)
+	then cd sed | sed then -eu echo cd --verbose then readonly
+		--verbose export export test awk 2>/dev/null done echo
+	cd export "$1" 'quoted text' -eu test test "$1" echo /usr/bin 2>/dev/null -eu awk
+	| grep "$@" ${HOME} printf
+		--verbose test local /usr/bin
+"$1" local x=1 ${HOME} x=1 test sed test cd ${HOME} 2>/dev/null | 2>/dev/null
+| 2>/dev/null cd done -eu x=1 'quoted text' then 2>/dev/null x=1 --verbose
+/usr/bin x=1 ${HOME} then
+	"$1" "$1" then ${HOME} test --verbose
+&& test awk local printf ${HOME} && cd && done sed /usr/bin ${HOME} awk "$1"
+'quoted text' --verbose | "$1" then printf 2>/dev/null
+-eu readonly grep "$@" "$@" ${HOME} sed -eu ${HOME} sed
+'quoted text' $(pwd) sed 'quoted text'
+		-eu printf -eu readonly echo x=1 $(pwd)
+		echo /usr/bin 'quoted text' printf awk sed 2>/dev/null done 'quoted text' awk awk
+	printf 2>/dev/null sed && local
+		cd grep cd cd then done grep 2>/dev/null
+		awk sed -eu done test cd /usr/bin
+	$(pwd) ${HOME} test "$1" cd sed printf
+		sed | awk local -eu local
+done echo sed --verbose x=1 export readonly export $(pwd) && "$@" sed
+		${HOME} && awk ${HOME} | test sed then
+	export readonly readonly printf /usr/bin -eu ${HOME} readonly
+	2>/dev/null echo done "$@" 2>/dev/null echo sed ${HOME} $(pwd) 2>/dev/null
+grep awk readonly export | 2>/dev/null
+		done then 2>/dev/null readonly 'quoted text' 'quoted text' done readonly "$1" done
+x=1 ${HOME} sed x=1 echo then && printf then sed
+	${HOME} 2>/dev/null 'quoted text' test 'quoted text' local test local $(pwd) sed
+local sed | done printf echo test
+"$@" test /usr/bin test
+	done export readonly then ${HOME} ${HOME} "$@" --verbose x=1 x=1 grep awk &&
+		then $(pwd) local printf x=1
+	done -eu done printf x=1 grep && then
+		"$1" export "$1" 2>/dev/null readonly
+	grep x=1 local export awk 'quoted text'
+	cd 2>/dev/null done cd then done |
+--verbose 2>/dev/null done awk printf -eu 2>/dev/null
+echo echo then local awk
+		cd local local cd ${HOME} grep -eu x=1 sed /usr/bin readonly | done --verbose cd
+"$1" /usr/bin cd /usr/bin
+	--verbose x=1 cd x=1 awk --verbose local
+		'quoted text' /usr/bin -eu then -eu awk export ${HOME} -eu done printf
+	export $(pwd) done sed ${HOME} awk readonly /usr/bin then 2>/dev/null /usr/bin
+	"$1" awk readonly cd "$1" test
+	&& local local export test export | local /usr/bin
+		"$@" grep | grep done 'quoted text' then $(pwd) --verbose
+		awk x=1 /usr/bin cd "$1" | -eu -eu sed x=1 export
+printf readonly then 2>/dev/null export printf printf test 'quoted text'
+		then export export x=1 | cd "$1" awk 2>/dev/null "$@" test
+$(pwd) grep -eu "$@" "$@" --verbose ${HOME}
+local grep done then && "$@" && cd ${HOME} | echo
+	readonly then 'quoted text' cd awk awk
+		sed echo echo printf local echo
+	test 'quoted text' 'quoted text' | && cd test $(pwd) && cd && "$@" local
+/usr/bin printf export
+	"$@" readonly $(pwd) 2>/dev/null grep
+		&& grep 'quoted text' | -eu test --verbose
+awk test awk readonly $(pwd)
+		readonly /usr/bin $(pwd) -eu -eu printf awk test $(pwd) $(pwd) awk && | readonly
+		/usr/bin --verbose /usr/bin
+		cd && sed -eu export echo | $(pwd) ${HOME}
+		2>/dev/null -eu awk then x=1 'quoted text' "$@" local -eu done
+	printf done then awk 'quoted text' done sed x=1 x=1 ${HOME} --verbose then && -eu
+${HOME} ${HOME} "$1" "$1" && export "$1"
+sed 2>/dev/null "$1"
+	"$1" x=1 x=1 printf cd ${HOME}
+	'quoted text' "$@" ${HOME} done cd printf --verbose "$1" then
+	grep ${HOME} readonly x=1 then --verbose printf awk local readonly
+		-eu 'quoted text' && readonly 2>/dev/null
+awk test ${HOME} sed local 'quoted text' local "$1" "$@" --verbose
+	'quoted text' done 'quoted text'
+--verbose && test "$@" -eu --verbose echo x=1 'quoted text'
+export local then x=1 then && /usr/bin && x=1 --verbose
+	cd 'quoted text' sed $(pwd) local "$@" awk "$1"
+	export 'quoted text' export printf $(pwd) then /usr/bin $(pwd) test sed "$@"
+	echo grep --verbose printf "$@" -eu $(pwd) test printf 'quoted text'
+2>/dev/null echo "$@" done ${HOME} && ${HOME} $(pwd)
+$(pwd) readonly 'quoted text' 'quoted text' sed
+grep 'quoted text' --verbose test grep export awk ${HOME} done test
+		awk ${HOME} done "$1" --verbose /usr/bin | readonly -eu --verbose "$@" printf
+$(pwd) done /usr/bin sed -eu x=1
+	/usr/bin ${HOME} ${HOME} "$1" echo grep && local
+		2>/dev/null && done 'quoted text' "$@" readonly -eu local ${HOME} $(pwd) |
+		readonly sed $(pwd) --verbose "$@" | "$@" --verbose echo local -eu grep
+		${HOME} && x=1 export 'quoted text' 'quoted text'
+sed ${HOME} /usr/bin local local test echo "$@" test
+2>/dev/null ${HOME} done | printf $(pwd) echo
+		-eu done local -eu | ${HOME} readonly 'quoted text' printf && cd ${HOME} && done
+sed -eu sed $(pwd) local --verbose
+	printf "$1" then x=1 local then
+	&& awk && export ${HOME}
+		cd -eu "$@" "$1" sed then /usr/bin 'quoted text'
+printf | test done x=1 printf | local then grep --verbose --verbose
+echo then --verbose export done done /usr/bin export grep then
+export -eu ${HOME} echo printf awk && local && /usr/bin ${HOME}
+"$1" | awk readonly ${HOME} test | | done --verbose done printf && "$@"
+	-eu --verbose then local /usr/bin printf done | awk -eu sed
+2>/dev/null sed readonly 'quoted text'
+		grep grep printf test awk grep test local "$@" | sed
+		echo ${HOME} echo /usr/bin --verbose done 'quoted text' $(pwd) | awk
+awk sed awk && local | local "$1" readonly local local awk -eu grep 2>/dev/null
+	--verbose && readonly readonly done then local 2>/dev/null
+	grep -eu -eu /usr/bin export printf
+${HOME} ${HOME} 'quoted text'
+		&& "$@" echo /usr/bin ${HOME} then
+		test export export --verbose done x=1
+	export x=1 -eu grep x=1 /usr/bin x=1 "$1" --verbose | $(pwd) printf ${HOME}
+	-eu awk "$1" test printf 2>/dev/null
+grep && $(pwd) --verbose 'quoted text' "$1" ${HOME} grep cd then local "$1" /usr/bin
+		echo x=1 export readonly "$1" --verbose
+	export && "$1" | export printf | "$@" --verbose
+		${HOME} local 2>/dev/null |
+	/usr/bin export x=1 'quoted text' "$@" --verbose
+	"$@" 'quoted text' local /usr/bin 'quoted text'
+		readonly && then /usr/bin export 'quoted text' 2>/dev/null printf
+		then readonly test readonly x=1 x=1 "$1" readonly $(pwd) echo "$1" local then done
+export /usr/bin sed then cd ${HOME} awk test echo then ${HOME}
+/usr/bin done awk test test then -eu readonly /usr/bin
+2>/dev/null then local done --verbose
+		$(pwd) printf export && $(pwd)
+		2>/dev/null --verbose awk /usr/bin "$@" cd "$1" $(pwd)
+then printf grep --verbose
+		echo awk export 2>/dev/null && awk local export then done test
+	awk "$@" done printf then 2>/dev/null /usr/bin sed "$1" done grep --verbose
+awk 2>/dev/null local && ${HOME}
+	"$@" echo printf "$1" cd test && sed
+	x=1 2>/dev/null readonly awk | grep x=1 export ${HOME}
+	${HOME} test done then "$@" test
+	test done echo /usr/bin test echo local export printf local export local /usr/bin
+		&& export export cd 2>/dev/null && echo x=1 ${HOME} "$1" | echo "$1" | printf
+cd printf printf && 2>/dev/null
+awk awk ${HOME} printf -eu -eu export printf echo -eu test
+"$1" awk 'quoted text' export echo printf /usr/bin done && cd done
+	"$1" awk x=1 printf /usr/bin test
+	sed "$@" printf | cd test | 'quoted text' ${HOME}
+		then readonly && ${HOME} "$1" 2>/dev/null then x=1 grep --verbose 'quoted text'
+	2>/dev/null ${HOME} "$@" x=1 awk sed printf 2>/dev/null export
+	test --verbose printf && test ${HOME} /usr/bin -eu test 2>/dev/null done $(pwd)
+/usr/bin done grep 2>/dev/null grep && 2>/dev/null sed
+		test 'quoted text' export local echo "$1" awk | 2>/dev/null readonly
+		echo printf then done 'quoted text' grep "$1" "$@" cd ${HOME}
+2>/dev/null awk cd && $(pwd) "$@"
+		"$1" ${HOME} "$1" 2>/dev/null
+	local export /usr/bin --verbose test test 'quoted text' x=1 local -eu --verbose
+test done x=1 then printf -eu --verbose /usr/bin readonly done
+grep test && 2>/dev/null test grep -eu | && "$1"
+		sed readonly x=1 && --verbose then then readonly
+		then local | grep -eu "$1" awk 'quoted text' grep readonly
+local readonly 2>/dev/null
+"$1" "$@" test echo x=1 cd printf | $(pwd) 'quoted text'
+grep "$@" "$@" test && -eu "$1" x=1 | | "$1"
+	/usr/bin printf && "$@" "$@" && export done
+awk awk x=1 then grep readonly ${HOME} cd 'quoted text'
+		"$@" | ${HOME} 'quoted text' cd 2>/dev/null export test ${HOME} grep
+		${HOME} && local sed readonly ${HOME} local then echo sed
+		-eu done local && /usr/bin /usr/bin printf -eu echo grep grep sed cd export grep
+	/usr/bin grep --verbose -eu printf 2>/dev/null
+	"$1" printf ${HOME} && cd test readonly
+		'quoted text' 2>/dev/null cd test export export 'quoted text'
+then readonly local x=1 test -eu ${HOME} printf "$@" 'quoted text' "$@"
+		awk echo "$1" export echo local 'quoted text' 2>/dev/null awk -eu
+	grep -eu x=1 echo $(pwd) x=1 done grep -eu grep $(pwd) readonly "$@" 'quoted text'
+/usr/bin readonly local cd echo
+${HOME} printf done export "$1" --verbose then local readonly
+		echo --verbose && "$1" echo --verbose "$@" grep
+		cd test 'quoted text' ${HOME} then local sed done --verbose
+--verbose 'quoted text' done -eu $(pwd) x=1 local
+	grep awk "$@" /usr/bin done "$1" 'quoted text'
+		--verbose --verbose /usr/bin 'quoted text' cd test done | done x=1 sed local
+		test -eu cd local && readonly readonly | --verbose export readonly cd then -eu
+$(pwd) 2>/dev/null --verbose then ${HOME} then && -eu -eu -eu done x=1
+		printf test test --verbose cd | --verbose "$1" grep "$@" cd echo grep awk && "$@"
+grep awk export | sed done then local ${HOME} $(pwd) "$@" &&
+'quoted text' 2>/dev/null
+/usr/bin sed /usr/bin then local then
+	then | $(pwd) 'quoted text' --verbose then then ${HOME} 2>/dev/null
+		x=1 test awk readonly grep | 'quoted text'
+	'quoted text' local ${HOME} "$1" --verbose
+/usr/bin grep --verbose printf export && cd /usr/bin /usr/bin "$1" done test
+		cd $(pwd) "$1" cd local /usr/bin then readonly
+	local 2>/dev/null | then -eu -eu -eu cd | $(pwd) /usr/bin then grep readonly
+	&& awk readonly -eu ${HOME} echo
+		echo $(pwd) test 'quoted text' x=1 -eu ${HOME} "$@" done
+	/usr/bin "$1" sed "$1" && $(pwd) "$@" grep x=1 readonly $(pwd) ${HOME} export
+	"$1" && -eu grep $(pwd) x=1 "$@" -eu -eu | "$1" --verbose sed then
+		'quoted text' echo && | sed && /usr/bin export "$1" printf 'quoted text' | ${HOME}
+	printf "$1" then | awk cd export ${HOME} 2>/dev/null readonly export
+		sed --verbose done printf sed grep | "$1" | && x=1 $(pwd) x=1 cd ${HOME} test
+	grep grep --verbose test && done
+		"$1" awk done --verbose sed | "$@" --verbose "$@" printf --verbose test cd
+		2>/dev/null test printf "$@" /usr/bin
+		&& then printf grep | x=1 export
+grep 2>/dev/null 'quoted text'
+		&& sed 2>/dev/null export local readonly then "$1" printf
+| then /usr/bin awk local sed echo cd ${HOME} --verbose
+		echo --verbose printf printf $(pwd)
+"$@" 'quoted text' grep echo cd printf
+		then cd -eu "$1" sed export done readonly x=1 readonly then &&
+	readonly --verbose cd echo printf "$@" done
+grep && done 'quoted text' grep grep 2>/dev/null local
+x=1 sed readonly /usr/bin x=1 cd | awk awk "$@"
+		/usr/bin readonly then /usr/bin -eu | /usr/bin echo "$1"
+2>/dev/null 'quoted text' export cd
+cd ${HOME} echo readonly "$1" cd cd | /usr/bin 2>/dev/null done
+"$@" x=1 -eu cd "$1" "$1" && local cd ${HOME} $(pwd) readonly awk
+${HOME} "$1" /usr/bin "$1" then /usr/bin test
+	cd grep && test | test printf 2>/dev/null $(pwd) -eu /usr/bin
+printf -eu local $(pwd) sed ${HOME} ${HOME} --verbose awk sed
+	| sed sed awk $(pwd) awk printf
+test x=1 printf cd grep $(pwd) echo echo export echo
+		test | local --verbose export printf local -eu grep
+		&& grep x=1 readonly printf "$@" grep
+sed 'quoted text' readonly readonly 2>/dev/null 'quoted text' "$1" sed
+sed local cd printf 2>/dev/null && grep printf echo 'quoted text'
+test echo "$1" local $(pwd) then test 2>/dev/null | local
+/usr/bin -eu -eu then awk awk test grep cd cd
+x=1 export $(pwd) grep "$1" local --verbose 2>/dev/null && --verbose done
+		${HOME} --verbose 'quoted text' 'quoted text'
+local && local local local grep
+	test && echo -eu readonly sed && sed
+"$@" x=1 /usr/bin $(pwd) 2>/dev/null sed && /usr/bin grep then 'quoted text'
+--verbose then 2>/dev/null ${HOME} local echo then
+		/usr/bin grep echo done then sed --verbose -eu x=1 export done
+	--verbose cd test export 'quoted text' "$1" -eu "$1" printf done --verbose
+-eu --verbose | echo awk
+test cd "$@" "$1" local done "$1" local "$1" -eu
+	cd && cd /usr/bin x=1 "$1" 2>/dev/null x=1 printf --verbose then "$1"
+printf -eu readonly printf printf cd awk
+		-eu -eu cd printf sed local grep "$@"
+	-eu 2>/dev/null "$@" "$@" awk printf $(pwd)
+		2>/dev/null --verbose /usr/bin then echo
+		$(pwd) local "$1" x=1 -eu ${HOME} ${HOME} cd /usr/bin
+readonly test | "$1" echo --verbose -eu printf echo done ${HOME} printf
+	&& && test sed 2>/dev/null local sed && readonly
+		${HOME} 'quoted text' printf 2>/dev/null
+	--verbose test export then 2>/dev/null done 2>/dev/null
+	cd 2>/dev/null $(pwd) && readonly "$1" then "$@" /usr/bin echo /usr/bin 'quoted text'
+		&& "$@" 'quoted text' x=1 cd 2>/dev/null "$1" done x=1 'quoted text'
+		--verbose export local /usr/bin grep
+	'quoted text' --verbose | readonly sed 'quoted text' echo printf
+		--verbose cd then /usr/bin $(pwd) export /usr/bin $(pwd)
+		test "$1" local /usr/bin -eu ${HOME} --verbose ${HOME} --verbose local && $(pwd)
+/usr/bin "$1" | done --verbose 'quoted text' echo cd | sed readonly printf
+		"$@" 2>/dev/null $(pwd) grep cd readonly
+		local | x=1 $(pwd) --verbose | 2>/dev/null x=1 ${HOME} awk printf readonly
+"$1" cd done | 2>/dev/null | done printf awk awk export /usr/bin --verbose done
+		echo grep local readonly test ${HOME} then test cd | local "$1" printf && $(pwd)
+&& "$1" sed $(pwd) echo --verbose 2>/dev/null local
+	/usr/bin 2>/dev/null then grep readonly
+		/usr/bin sed echo printf test --verbose
+		printf ${HOME} --verbose "$@" then ${HOME} sed "$1" "$@" test grep
+		'quoted text' sed 'quoted text' sed $(pwd) done && "$1" x=1 readonly | cd cd export
+	${HOME} done ${HOME} export -eu local 2>/dev/null then local
+		then done readonly | awk cd local done -eu --verbose grep "$1"
+		then echo /usr/bin x=1 local
+cd readonly /usr/bin && 'quoted text' done x=1 echo ${HOME}
+sed then then then && test --verbose --verbose
+		local | 2>/dev/null "$@"
+		grep printf "$1" "$@" x=1 'quoted text'
+	| $(pwd) --verbose sed then 'quoted text' done export done && && awk /usr/bin
+		| cd 2>/dev/null "$@" -eu
+"$1" test awk ${HOME} export sed local -eu
+local 2>/dev/null export
+		export readonly printf x=1
+		'quoted text' "$1" readonly echo -eu /usr/bin -eu
+	"$1" ${HOME} $(pwd) local x=1 echo test done awk "$1" $(pwd)
+&& && x=1 echo "$1" then
+$(pwd) test 2>/dev/null readonly local then x=1 local awk /usr/bin cd 'quoted text'
+	echo "$@" done export $(pwd) x=1 --verbose -eu 2>/dev/null
+	local printf awk "$@" --verbose
+		grep "$@" then then cd readonly awk cd then grep export
+awk && export then $(pwd) 'quoted text' done awk readonly readonly -eu readonly
+		"$@" | ${HOME} readonly awk | "$1" cd local $(pwd) --verbose echo local
+x=1 test readonly local ${HOME} done
+test done done sed 2>/dev/null
+	grep 2>/dev/null then "$@" x=1 'quoted text'
+--verbose $(pwd) cd local echo $(pwd) 2>/dev/null ${HOME} local |
+	| -eu && -eu awk done grep "$1" $(pwd) done test echo printf echo &&
+	'quoted text' 'quoted text' awk local test $(pwd) $(pwd) "$@" cd
+		| echo awk printf | echo "$@" test done printf | $(pwd) 2>/dev/null
+	awk local grep awk --verbose local test printf --verbose test awk --verbose
+	cd awk test x=1 ${HOME} done /usr/bin awk
+		$(pwd) test sed | 2>/dev/null awk /usr/bin
+&& echo /usr/bin local done $(pwd) 2>/dev/null --verbose then 'quoted text'
+		local done grep "$1" printf cd printf
+		x=1 echo "$1" | then grep --verbose --verbose && cd cd echo
+	${HOME} x=1 grep 2>/dev/null sed printf 'quoted text' readonly
+	&& ${HOME} ${HOME} test cd --verbose grep
+		$(pwd) x=1 && grep test 2>/dev/null grep then export 'quoted text'
+		then 'quoted text' "$1" sed cd awk grep /usr/bin -eu awk local "$1" done
+	"$1" sed -eu done echo 2>/dev/null sed awk && grep then local --verbose ${HOME}
+readonly echo awk readonly echo "$1" cd done ${HOME} | readonly done
+	cd ${HOME} readonly x=1 && sed -eu printf ${HOME} awk awk sed readonly
+		printf readonly export 2>/dev/null 'quoted text'
+		local x=1 2>/dev/null printf local && x=1 'quoted text' export && x=1 done x=1
+	done | export awk sed grep sed 2>/dev/null local "$1"
+	readonly awk | sed done grep --verbose 2>/dev/null sed test --verbose ${HOME} grep
+	2>/dev/null cd && grep "$1" --verbose -eu "$@" "$@" /usr/bin
+x=1 2>/dev/null test then x=1 /usr/bin printf local printf cd --verbose
+test echo printf grep && "$1" grep sed then echo $(pwd) && ${HOME}
+	| "$1" done local export local done /usr/bin
+		cd sed echo ${HOME} $(pwd) grep export 'quoted text' cd printf then
+		cd export | grep echo --verbose readonly -eu cd export done "$@" grep
+	| "$@" local sed awk grep cd "$1" -eu cd "$1" sed local | printf | then
+		"$1" $(pwd) ${HOME} /usr/bin "$1" echo 'quoted text'
+	test grep "$@" && ${HOME} local printf /usr/bin
+		printf export && 2>/dev/null readonly
+	| 2>/dev/null && cd export $(pwd) -eu
+then grep grep $(pwd) ${HOME} -eu export then x=1
+	readonly 2>/dev/null test sed grep export sed x=1
+	$(pwd) sed cd ${HOME} /usr/bin ${HOME} export "$1" && awk 'quoted text' then
+/usr/bin local && --verbose 'quoted text' then 'quoted text' 'quoted text'
+"$1" -eu x=1 | --verbose printf ${HOME}
+		x=1 x=1 then 2>/dev/null -eu readonly awk done readonly x=1 sed local 2>/dev/null
+		| --verbose -eu "$@" grep 2>/dev/null echo sed $(pwd)
+local echo sed then local 2>/dev/null
+	| | x=1 "$1" echo -eu 2>/dev/null
+		echo 'quoted text' "$1" echo sed x=1 echo awk | "$@" 2>/dev/null done "$1" &&
+	"$@" | grep && local printf x=1 -eu done printf printf export printf ${HOME}
+		/usr/bin ${HOME} | test -eu export $(pwd) x=1 $(pwd) /usr/bin --verbose 'quoted text'
+		-eu then echo echo cd local "$@" export export "$@" | cd "$1" test readonly
+		printf done then | | | sed | 2>/dev/null then | readonly done export ${HOME}
+		'quoted text' done echo /usr/bin
+		cd local /usr/bin "$@" -eu ${HOME} test
+/usr/bin then sed local && readonly awk /usr/bin done awk test -eu "$@" $(pwd)
+		'quoted text' awk grep readonly -eu printf
+		-eu printf /usr/bin | | -eu done grep x=1 echo && readonly sed readonly "$1"
+local --verbose --verbose readonly then readonly $(pwd) done /usr/bin
+		awk printf ${HOME} export printf --verbose echo grep ${HOME} x=1
+| then $(pwd) echo ${HOME}
+then awk done export sed 'quoted text' cd
+	| local test --verbose echo ${HOME}
+		| local then ${HOME} done -eu cd cd test "$1" 2>/dev/null printf "$@" "$@"
+		local readonly ${HOME} done then 2>/dev/null
+export --verbose "$1" echo 2>/dev/null awk
+		printf --verbose --verbose x=1 test sed local --verbose
+		$(pwd) export 2>/dev/null awk
+	echo printf /usr/bin 'quoted text'
+		'quoted text' echo "$1" --verbose 2>/dev/null -eu /usr/bin ${HOME} then
+		local /usr/bin -eu && awk then printf 2>/dev/null done
+	local grep grep $(pwd) 'quoted text' x=1 "$@" 2>/dev/null
+	done export "$@" printf "$@" x=1 grep x=1 --verbose done
+		/usr/bin --verbose | 'quoted text' grep
+		readonly --verbose | "$1" printf readonly ${HOME} grep awk awk x=1 awk then
+		${HOME} cd ${HOME} grep -eu printf test ${HOME} "$1" $(pwd) &&
+${HOME} awk $(pwd) export | | "$@" "$@"
+	${HOME} export && then cd local /usr/bin cd | awk then
+'quoted text' && then "$1" "$@" awk done sed "$@" --verbose ${HOME} && &&
+awk $(pwd) export x=1 echo cd then cd | done $(pwd) $(pwd) local
+$(pwd) 'quoted text' "$@"
+	local echo -eu && ${HOME} --verbose sed local --verbose && cd 2>/dev/null -eu
+local /usr/bin 'quoted text' 2>/dev/null $(pwd) |
+	${HOME} --verbose 2>/dev/null then
+done readonly cd "$@" /usr/bin "$@" awk --verbose then
+	echo x=1 export 2>/dev/null 'quoted text'
+readonly 2>/dev/null
+printf && /usr/bin | && x=1 local
+	| grep /usr/bin "$@" awk && printf sed "$@" $(pwd) "$1" "$@" test test echo /usr/bin
+		cd printf --verbose local then "$1" -eu -eu readonly awk done awk
+| test done local export 2>/dev/null "$@" local
+	2>/dev/null "$@" && /usr/bin sed "$@" /usr/bin test printf 2>/dev/null
+		awk 2>/dev/null 'quoted text' echo
+		2>/dev/null done --verbose cd | x=1 sed $(pwd) sed "$@"
+		/usr/bin readonly local done 2>/dev/null x=1 echo local $(pwd) -eu /usr/bin then
+	test grep grep local -eu /usr/bin -eu cd echo local grep "$1" printf 2>/dev/null
+		readonly cd awk && export sed $(pwd) awk ${HOME}
+		${HOME} echo 'quoted text' printf
+	grep 'quoted text' local "$@" $(pwd)
+sed then sed then test readonly $(pwd)
+x=1 "$1" x=1 'quoted text' "$@" -eu printf /usr/bin -eu echo -eu
+	2>/dev/null printf 'quoted text'
+	"$1" printf sed /usr/bin 'quoted text' test x=1 "$@"
+"$@" 'quoted text' ${HOME} "$1" 2>/dev/null "$1" test readonly --verbose test sed
+		&& sed sed printf test grep then echo 2>/dev/null
+echo ${HOME} --verbose grep done 'quoted text'
+		echo readonly 'quoted text' x=1 $(pwd) /usr/bin readonly && sed x=1 ${HOME}
+		awk export awk "$@" export done test 'quoted text'
+		--verbose cd && 2>/dev/null 2>/dev/null done then
+awk test 2>/dev/null local awk
+		x=1 ${HOME} local grep grep $(pwd) --verbose local "$1"
+readonly | test cd test | && then local && local && $(pwd) 'quoted text'
+		'quoted text' local 2>/dev/null readonly export $(pwd)
+'quoted text' /usr/bin --verbose | export
+echo cd "$1" && "$1" export 2>/dev/null sed local "$@" local x=1
+		sed x=1 | /usr/bin /usr/bin grep test ${HOME} 2>/dev/null
+	printf "$@" echo --verbose "$@" printf test "$1" --verbose /usr/bin grep then
+		/usr/bin 2>/dev/null test echo --verbose | 2>/dev/null awk 2>/dev/null sed grep
+		x=1 local && awk 'quoted text' local | printf
+2>/dev/null 2>/dev/null sed ${HOME} "$@" sed | done /usr/bin
+		"$1" "$@" printf done ${HOME} && 2>/dev/null then done echo
+		cd readonly export | awk
+		echo -eu echo export 'quoted text' --verbose "$@" sed
+awk --verbose sed --verbose
+		"$1" readonly local readonly cd sed && readonly ${HOME} $(pwd) ${HOME} then "$1"
+	${HOME} && awk readonly cd && | 'quoted text' done ${HOME} grep awk "$@" cd --verbose
+		"$@" 'quoted text' printf "$1"
+$(pwd) | /usr/bin readonly then -eu x=1 done local $(pwd) local 'quoted text'
+	printf export then echo $(pwd) local local --verbose
+		then echo printf printf awk then grep 2>/dev/null test "$1" echo test "$@" grep
+		$(pwd) "$@" cd local -eu local export 'quoted text' test "$1" then grep
+	then | | | 'quoted text' sed sed "$1" --verbose ${HOME} "$@" grep
+	"$1" /usr/bin /usr/bin "$1" awk && $(pwd) export printf printf "$1" sed readonly
+	/usr/bin grep then "$@" test 2>/dev/null grep
+	/usr/bin | | | then awk --verbose
+		'quoted text' sed then local printf export grep sed
+printf | done test ${HOME} printf
+		cd "$1" readonly 2>/dev/null ${HOME} x=1 echo | test ${HOME} awk -eu
+awk | test sed "$1" test awk 'quoted text' local done
+		sed ${HOME} | | then test test
+	test /usr/bin local done --verbose
+	readonly 'quoted text' 2>/dev/null x=1 sed && echo readonly
+| readonly ${HOME} $(pwd) then echo sed cd && $(pwd) ${HOME}
+2>/dev/null | && readonly -eu test done cd readonly
+		done cd then printf printf printf readonly x=1 2>/dev/null ${HOME}
+	'quoted text' grep sed 2>/dev/null -eu
+cd awk x=1 grep awk -eu export local ${HOME} export
+"$@" readonly && "$1" readonly "$@" done 2>/dev/null awk export
+		printf export local sed local "$@" 'quoted text' export /usr/bin $(pwd) $(pwd)
+		${HOME} x=1 ${HOME} readonly echo export awk cd printf
+	test $(pwd) x=1 local ${HOME} test --verbose ${HOME} cd printf
+		--verbose export grep test printf
+"$1" sed then 'quoted text' --verbose
+then 2>/dev/null ${HOME} "$1" echo
+		| "$1" local echo $(pwd)
+		/usr/bin local export "$1" | "$@" readonly awk echo | awk local -eu
+${HOME} $(pwd) --verbose echo --verbose && --verbose done 2>/dev/null
+		cd printf -eu -eu test awk 2>/dev/null cd
+		readonly && export test done -eu then && done export -eu ${HOME} --verbose "$1"
+		printf /usr/bin done $(pwd) echo export ${HOME}
+/usr/bin readonly grep --verbose then local grep "$1" --verbose
+		${HOME} "$1" local then "$@" echo "$1" 'quoted text' && cd
+2>/dev/null $(pwd) then test "$@" awk readonly export "$1" -eu 2>/dev/null
+	done --verbose 'quoted text' export grep then done | | readonly &&
+	&& then printf 2>/dev/null export
+	printf grep && grep cd printf x=1 then | x=1 grep
+		echo done done echo "$@" then 'quoted text' done readonly && | echo export 2>/dev/null
+local test awk cd grep readonly awk sed && export done "$@" /usr/bin /usr/bin
+	export --verbose printf 2>/dev/null -eu cd test 2>/dev/null --verbose
+		readonly "$1" awk 'quoted text' 2>/dev/null "$@" test ${HOME} /usr/bin
+	grep done export test readonly printf /usr/bin local
+	&& export grep grep && | /usr/bin cd 2>/dev/null then | 2>/dev/null
+		done 2>/dev/null "$@" sed
+		| ${HOME} | x=1 grep | x=1 readonly "$1"
+		&& readonly export "$@" echo ${HOME}
+cd sed grep sed cd -eu
+echo | | then ${HOME} export export readonly sed test "$1" "$1"
+	${HOME} 'quoted text' && sed readonly /usr/bin --verbose 2>/dev/null ${HOME}
+	export local done "$@" ${HOME} ${HOME} then cd done
+	sed -eu done then | "$@" 'quoted text' grep "$1" "$1" export
+'quoted text' cd $(pwd) grep local then echo 'quoted text'
+/usr/bin printf -eu awk
+		${HOME} done 'quoted text' $(pwd) ${HOME}
+		done sed 2>/dev/null x=1 $(pwd) grep $(pwd) --verbose echo printf then awk
+${HOME} 'quoted text' printf printf
+export 2>/dev/null /usr/bin /usr/bin grep x=1 'quoted text' readonly
+	grep grep ${HOME} 2>/dev/null /usr/bin export local -eu
+	awk cd printf printf /usr/bin cd done done local ${HOME}
+cd 'quoted text' "$@" 'quoted text' readonly printf /usr/bin | 'quoted text'
@@ -0,0 +1,2001 @@
+		/usr/bin readonly sed 'quoted text' 'quoted text' sed done -eu
+		sed export 2>/dev/null $(pwd) $(pwd) $(pwd) --verbose -eu && readonly
+| /usr/bin done test export $(pwd) done cd x=1 printf echo $(pwd)
+"$@" 'quoted text' test && awk && -eu && sed export
+	x=1 test done test 2>/dev/null
+-eu sed cd test echo && && --verbose test ${HOME} --verbose 'quoted text' then done
+cd awk done --verbose | && then readonly x=1 awk /usr/bin --verbose && awk printf
+		-eu --verbose /usr/bin sed 'quoted text' local $(pwd) x=1 readonly
+		awk printf 'quoted text' export | test /usr/bin printf
+	$(pwd) echo local done 2>/dev/null readonly
+	--verbose test && | then &&
+	-eu readonly grep "$@" done cd local /usr/bin done "$@" done local "$1"
+	grep && sed then "$1" then -eu test --verbose 2>/dev/null
+test grep readonly ${HOME} "$1" --verbose "$@" then | -eu && local 'quoted text'
+		| /usr/bin "$@" local x=1 printf x=1 readonly printf "$1" awk grep grep
+2>/dev/null && test "$1" export
+		printf local done done ${HOME} | | local "$1" 2>/dev/null /usr/bin --verbose
+		"$1" | cd ${HOME} 'quoted text' && test grep --verbose $(pwd) && /usr/bin
+		test printf --verbose
+		cd readonly test $(pwd) export
+/usr/bin awk local printf cd "$@" echo | --verbose echo -eu done local
+		'quoted text' cd 2>/dev/null test test 2>/dev/null printf export 2>/dev/null
+		then 'quoted text' done 2>/dev/null then then export cd -eu awk
+		"$@" ${HOME} echo ${HOME} done ${HOME}
+local ${HOME} done sed $(pwd) export
+	| -eu cd echo cd x=1 export echo $(pwd) x=1 -eu --verbose -eu export awk "$@"
+		-eu test "$1" 2>/dev/null grep test sed readonly
+export printf 2>/dev/null $(pwd) echo then /usr/bin
+	done x=1 local "$1" ${HOME} then then cd printf test -eu then awk sed
+		| "$1" ${HOME} awk -eu done 'quoted text'
+test ${HOME} grep done
+	&& awk test 'quoted text' x=1 $(pwd) 2>/dev/null done test | cd sed
+	readonly export done test -eu local
+	export cd then "$@" "$@" --verbose echo printf
+		$(pwd) ${HOME} sed "$1" x=1 --verbose printf
+local 2>/dev/null | printf --verbose "$@" -eu "$1" 'quoted text' "$@"
+		test export test cd "$1" awk "$1" "$1" -eu cd "$1" export sed
+'quoted text' export /usr/bin -eu "$1"
+		2>/dev/null test echo "$@" local then echo "$1" awk -eu done && ${HOME}
+		readonly $(pwd) done ${HOME} then sed /usr/bin /usr/bin cd "$@"
+${HOME} | echo /usr/bin 2>/dev/null --verbose then
+export "$@" "$1" 'quoted text' | then
+		$(pwd) && 'quoted text' grep ${HOME} cd then ${HOME} printf && | $(pwd) awk cd 2>/dev/null
+${HOME} awk echo $(pwd) sed "$@" "$1" readonly /usr/bin
+	${HOME} | test ${HOME} cd printf 'quoted text'
+2>/dev/null awk readonly | $(pwd) ${HOME} test test
+		-eu ${HOME} --verbose export
+		grep done --verbose test test | local x=1 x=1 x=1 "$@"
+	done $(pwd) test echo x=1 $(pwd) /usr/bin readonly 'quoted text'
+		then readonly export local "$1" local "$1"
+		--verbose grep --verbose cd "$1" "$@" cd $(pwd) then
+		"$1" sed 2>/dev/null export readonly then export local "$1"
+	printf local sed printf test /usr/bin printf x=1 then awk "$@" then | 2>/dev/null
+	then "$1" test awk done readonly
+/usr/bin awk "$1" 'quoted text' -eu --verbose grep "$1" grep done then
+	grep export 'quoted text' "$@" && echo awk "$@" --verbose
+		local readonly $(pwd) 2>/dev/null 2>/dev/null grep
+	| --verbose echo local
+		done --verbose echo $(pwd) -eu ${HOME} /usr/bin printf grep grep |
+--verbose awk sed -eu 2>/dev/null readonly "$1" export
+		&& then cd $(pwd) readonly awk echo local 2>/dev/null
+	2>/dev/null test -eu /usr/bin --verbose done cd && /usr/bin x=1 ${HOME} grep test
+	sed 2>/dev/null readonly x=1 done ${HOME}
+readonly /usr/bin ${HOME} && && 'quoted text' local readonly /usr/bin
+		readonly echo -eu printf export test 2>/dev/null "$1" "$1" readonly
+grep sed sed done "$1" ${HOME} --verbose done
+	sed awk then "$1" done 2>/dev/null
+		x=1 done "$1" --verbose export 'quoted text' awk --verbose
+readonly done sed "$1" cd printf grep export
+		readonly ${HOME} done 'quoted text' 2>/dev/null done
+x=1 "$1" "$1" printf 2>/dev/null printf && 'quoted text'
+export "$@" --verbose local $(pwd) local 'quoted text'
+	$(pwd) sed | 'quoted text' 'quoted text' readonly
+	echo 2>/dev/null ${HOME} -eu test 2>/dev/null
+	--verbose "$@" 'quoted text' grep awk
+		awk awk readonly done echo export echo -eu --verbose "$@" test export && ${HOME}
+		"$@" test printf readonly awk test ${HOME} x=1 sed $(pwd) printf && | echo
+	awk echo ${HOME} done done ${HOME} grep printf awk && test echo && ${HOME}
+export done --verbose then test "$1" --verbose "$1" && $(pwd) ${HOME}
+		${HOME} /usr/bin | readonly test "$1" awk "$@" | $(pwd) ${HOME} $(pwd) 2>/dev/null
+		$(pwd) sed test awk readonly
+	done --verbose -eu done awk 2>/dev/null awk test "$1" done 'quoted text' 2>/dev/null
+		export done /usr/bin /usr/bin ${HOME} "$1" "$1" --verbose /usr/bin
+	x=1 readonly "$@" sed grep "$1" | x=1 $(pwd) | test
+sed printf 'quoted text' ${HOME} -eu 2>/dev/null
+		echo grep local sed x=1 awk
+local --verbose 'quoted text' 'quoted text' export test export
+	x=1 "$1" /usr/bin then
+	2>/dev/null cd echo 'quoted text' export x=1 sed test
+| ${HOME} awk --verbose test done echo
+	echo export ${HOME} | /usr/bin sed awk
+	printf export /usr/bin --verbose echo printf /usr/bin
+		echo printf printf test 2>/dev/null -eu $(pwd) awk
+	2>/dev/null 'quoted text' local 2>/dev/null cd | cd
+local export local local --verbose cd sed 'quoted text' && sed
+		export readonly test then then 'quoted text' "$@" grep then ${HOME}
+		grep awk readonly echo readonly $(pwd) sed sed
+		export "$1" sed readonly $(pwd) ${HOME}
+		-eu test /usr/bin $(pwd)
+/usr/bin echo local printf ${HOME} "$@" then readonly awk | ${HOME}
+	"$1" 2>/dev/null /usr/bin cd awk 2>/dev/null 2>/dev/null
+	grep 'quoted text' done sed --verbose -eu done | $(pwd)
+		awk | grep test -eu grep "$@" $(pwd) ${HOME} grep /usr/bin
+&& test awk x=1 readonly local -eu
+		grep --verbose export 'quoted text' | echo
+done && -eu printf && 2>/dev/null export grep printf x=1 cd 2>/dev/null
+	export export printf 'quoted text' done printf
+x=1 cd --verbose readonly
+	2>/dev/null "$@" grep sed grep done 'quoted text' -eu --verbose /usr/bin
+		2>/dev/null $(pwd) test -eu &&
+	local /usr/bin && sed echo | done /usr/bin then -eu /usr/bin "$1" 'quoted text'
+sed --verbose sed 2>/dev/null "$1" 'quoted text' 'quoted text'
+readonly local ${HOME} $(pwd) $(pwd) -eu
+echo export /usr/bin -eu x=1 sed
+	readonly done $(pwd) awk grep cd echo -eu test readonly
+	$(pwd) export ${HOME} printf -eu /usr/bin cd cd /usr/bin cd echo cd $(pwd)
+		grep export --verbose $(pwd) "$1" echo 'quoted text' cd done --verbose printf
+awk "$@" 2>/dev/null awk "$1" sed export $(pwd) "$@" "$1" 'quoted text'
+	printf echo cd local 'quoted text' local cd then printf "$1" "$@"
+grep --verbose done | printf
+&& readonly "$@" readonly test local printf /usr/bin export
+"$1" ${HOME} 2>/dev/null then
+&& $(pwd) && ${HOME} done 'quoted text' echo 'quoted text' test grep
+/usr/bin "$1" 2>/dev/null grep | 'quoted text' local awk ${HOME} printf
+		grep local grep test && 2>/dev/null awk export local cd -eu printf
+		"$1" local export awk then "$1" awk ${HOME} sed ${HOME} $(pwd) readonly then
+then | $(pwd) done ${HOME} && cd grep test awk | awk -eu test
+	readonly | grep sed printf /usr/bin
+	&& 'quoted text' x=1 | then | echo 2>/dev/null grep
+	--verbose | echo $(pwd) ${HOME} grep $(pwd) export
+	sed export then printf 'quoted text' local 'quoted text' sed then /usr/bin 'quoted text'
+	--verbose echo --verbose grep
+	then awk cd --verbose ${HOME} export -eu ${HOME} printf test readonly $(pwd)
+echo test | -eu readonly cd awk readonly
+	${HOME} grep export x=1 sed -eu cd echo "$@" "$1" done sed x=1 "$1" cd readonly
+sed && 'quoted text' sed | cd sed grep /usr/bin --verbose
+&& "$@" done --verbose export | sed then "$1" then then grep
+	"$@" -eu sed 2>/dev/null test --verbose
+cd --verbose 'quoted text'
+&& printf test ${HOME} | then $(pwd) "$@" awk --verbose --verbose 'quoted text'
+export 'quoted text' $(pwd) --verbose x=1 'quoted text'
+		"$@" echo && test | 2>/dev/null sed
+	${HOME} "$@" done cd 'quoted text' printf $(pwd) awk $(pwd)
+export --verbose local cd export | "$@" echo --verbose
+		${HOME} "$1" cd | ${HOME}
+		&& && test -eu && x=1 $(pwd) x=1 x=1 awk "$1" readonly
+	grep local readonly --verbose ${HOME}
+${HOME} -eu awk -eu "$1" "$@" && --verbose ${HOME} done && printf "$@" -eu
+-eu sed echo echo 2>/dev/null sed echo x=1 "$1" "$@" done grep readonly
+	"$1" "$@" local sed grep
+		readonly local then done -eu $(pwd) local then sed test $(pwd)
+readonly export echo -eu $(pwd) awk export /usr/bin $(pwd) awk
+"$@" sed printf then grep -eu && export x=1 --verbose local $(pwd) awk cd ${HOME}
+readonly ${HOME} "$1" && 2>/dev/null export
+	awk then ${HOME} printf then export
+readonly echo "$1" readonly $(pwd) | 'quoted text' --verbose
+--verbose 2>/dev/null then export $(pwd) |
+test ${HOME} then export 2>/dev/null 'quoted text' awk readonly && --verbose
+	x=1 'quoted text' 'quoted text' "$1" printf export
+	readonly /usr/bin awk printf | x=1 grep export grep cd grep readonly
+local local 'quoted text' ${HOME} echo done
+		--verbose ${HOME} export echo && --verbose local awk
+"$@" local 'quoted text' && x=1 grep then then 2>/dev/null x=1
+"$1" done -eu "$@" done --verbose 2>/dev/null sed local
+	printf test readonly 'quoted text' export
+		printf --verbose ${HOME} && grep
+		'quoted text' 'quoted text' x=1 x=1 | "$@"
+		grep && readonly "$@" $(pwd)
+	--verbose done /usr/bin done echo cd --verbose readonly "$1" $(pwd) cd ${HOME}
+sed test && printf awk ${HOME} readonly "$1" grep readonly x=1
+	2>/dev/null | cd sed printf
+	$(pwd) printf && --verbose grep -eu /usr/bin done "$@" printf sed cd $(pwd) -eu
+		readonly x=1 export cd | echo --verbose done && export cd
+| /usr/bin -eu printf grep sed | readonly grep "$@" && /usr/bin
+| export printf then readonly done grep /usr/bin
+sed 'quoted text' ${HOME} $(pwd) export "$1" export readonly -eu local $(pwd) "$@"
+printf /usr/bin $(pwd) cd test grep 2>/dev/null grep done cd printf
+		local "$@" sed && $(pwd) readonly
+	grep cd printf | 2>/dev/null cd test awk /usr/bin && done done "$1" cd |
+	'quoted text' 'quoted text' done export export /usr/bin $(pwd) /usr/bin
+x=1 | grep readonly done ${HOME}
+		x=1 then test grep "$@" then readonly ${HOME} grep grep /usr/bin
+-eu grep awk test grep awk | awk
+	export grep grep -eu done $(pwd) x=1 "$@" printf
+'quoted text' echo printf awk cd echo 'quoted text' "$1" -eu /usr/bin export
+		local x=1 sed --verbose echo
+'quoted text' 'quoted text' done 'quoted text' x=1 'quoted text' awk 'quoted text'
+	-eu echo done 2>/dev/null test 'quoted text'
+	"$1" /usr/bin 'quoted text' cd then then readonly
+		--verbose printf test sed -eu awk awk $(pwd) grep awk
+	&& echo ${HOME} | local "$1"
+	test 'quoted text' test ${HOME}
+		local sed 'quoted text'
+		cd then x=1 test --verbose 'quoted text'
+	done --verbose | readonly && local sed done x=1 printf
+	cd --verbose readonly cd 'quoted text' "$1" /usr/bin 2>/dev/null
+		| "$1" grep $(pwd) 'quoted text' x=1
+	--verbose --verbose then 2>/dev/null -eu sed --verbose export $(pwd)
+	-eu readonly awk test grep /usr/bin "$@" -eu
+	echo grep echo /usr/bin $(pwd)
+	$(pwd) ${HOME} x=1 cd x=1 cd sed
+--verbose done x=1 sed $(pwd) done
+	test done sed | sed test sed echo x=1 grep local 'quoted text' grep $(pwd)
+	"$@" x=1 -eu echo -eu awk "$@" awk awk "$1" readonly
+$(pwd) 'quoted text' test test done &&
+	$(pwd) -eu echo awk ${HOME}
+| echo $(pwd) readonly export -eu readonly test export awk
+		"$1" cd cd 2>/dev/null done printf "$@" --verbose && echo /usr/bin
+local --verbose ${HOME} sed 2>/dev/null
+/usr/bin -eu sed awk && $(pwd) "$@" $(pwd) $(pwd) "$@" awk
+		sed 2>/dev/null local grep test x=1 local readonly cd printf
+		/usr/bin 'quoted text' done done /usr/bin awk readonly cd 'quoted text' -eu export
+| cd "$@" export local local awk 'quoted text' export 2>/dev/null then /usr/bin
+$(pwd) then test 'quoted text'
+	"$@" ${HOME} | printf awk local local -eu /usr/bin
+	$(pwd) --verbose done printf printf | "$1" export sed sed | 2>/dev/null
+	&& echo sed sed cd x=1
+	cd "$@" sed "$1" local grep export then $(pwd) 'quoted text' sed 2>/dev/null
+	test 2>/dev/null awk printf then export x=1
+		test readonly --verbose printf /usr/bin
+	"$@" printf grep "$@" export cd && ${HOME}
+	grep /usr/bin && ${HOME} 2>/dev/null 2>/dev/null done
+&& readonly readonly then x=1 echo printf $(pwd)
+test done x=1 echo then printf "$1"
+		"$@" && done | printf local -eu cd then done local cd "$1" export done export
+grep printf export echo ${HOME} "$1" 'quoted text' 'quoted text' "$@"
+		/usr/bin printf ${HOME} grep
+	/usr/bin grep export x=1 echo printf | "$@" ${HOME} "$1" | cd readonly export
+test $(pwd) echo "$1" /usr/bin then printf then /usr/bin
+	readonly printf --verbose "$@" 2>/dev/null awk x=1 local
+sed -eu "$1" "$1" test test /usr/bin then | 'quoted text' && then then
+		cd --verbose awk 'quoted text' --verbose 'quoted text'
+	export grep printf done
+		done export | cd "$@" 'quoted text'
+	awk "$@" cd then export local local -eu "$1" -eu $(pwd)
+	/usr/bin -eu /usr/bin readonly echo $(pwd) awk --verbose
+		echo cd "$@" readonly "$1" test sed sed then local "$1" | ${HOME} local $(pwd)
+	"$@" -eu "$@" && local grep readonly 'quoted text' 2>/dev/null
+	2>/dev/null echo | "$@" "$@" local done 2>/dev/null --verbose
+		"$@" "$1" done printf awk grep ${HOME} "$@" && 'quoted text'
+done done echo local 2>/dev/null && 2>/dev/null
+sed local $(pwd) && local echo /usr/bin x=1 then --verbose --verbose 2>/dev/null
+${HOME} --verbose cd cd x=1 --verbose $(pwd)
+x=1 --verbose ${HOME} "$@" sed
+	$(pwd) -eu "$@" $(pwd) grep && local ${HOME} "$@" | sed x=1
+	--verbose sed then ${HOME} 'quoted text' local local awk cd ${HOME} done
+export test && "$1" $(pwd)
+	| ${HOME} done grep /usr/bin $(pwd) cd readonly
+	echo -eu "$@" "$@" readonly test $(pwd) x=1
+		${HOME} echo ${HOME} --verbose sed -eu then "$@" grep then
+${HOME} test cd "$@" |
+-eu local test --verbose printf sed sed cd $(pwd) echo grep then && local echo
+export "$1" done local test ${HOME} 2>/dev/null
+		sed echo test cd sed cd cd ${HOME}
+--verbose awk -eu 2>/dev/null && /usr/bin test local | && 'quoted text' grep
+then awk grep "$1" readonly readonly printf cd echo echo
+		test x=1 "$1" test grep "$1" local ${HOME} echo --verbose export
+		'quoted text' /usr/bin then readonly echo | sed /usr/bin $(pwd) $(pwd)
+		"$@" awk "$@" 'quoted text' readonly | grep
+		-eu /usr/bin awk export 'quoted text' 'quoted text' sed 'quoted text' cd cd
+		-eu then local 2>/dev/null printf done printf printf x=1 && done -eu $(pwd)
+then | | grep 'quoted text' printf sed | awk
+	&& echo 2>/dev/null x=1 readonly
+	readonly | --verbose -eu --verbose
+then x=1 2>/dev/null printf awk && export && 'quoted text'
+${HOME} printf 2>/dev/null x=1 && x=1 grep readonly
+--verbose printf | local "$@" echo test export | echo "$@" awk grep readonly
+echo sed echo echo /usr/bin sed
+		${HOME} ${HOME} /usr/bin x=1 sed $(pwd) "$@"
+"$1" --verbose x=1 awk x=1 $(pwd)
+		"$1" test then grep --verbose && done cd test
+		printf "$@" echo done 2>/dev/null $(pwd)
+	"$@" done "$@" awk grep 2>/dev/null
+	then printf then --verbose grep
+		${HOME} readonly cd x=1 --verbose sed done awk awk ${HOME} && cd $(pwd)
+	&& "$@" echo && export 'quoted text'
+		done "$1" local grep sed -eu ${HOME} | -eu grep /usr/bin
+x=1 done done 'quoted text' && ${HOME} echo echo /usr/bin
+local echo echo ${HOME} sed -eu export
+	/usr/bin export 2>/dev/null done x=1 then --verbose -eu
+	/usr/bin x=1 echo export echo && echo grep && | 'quoted text' readonly
+${HOME} "$@" printf test export
+		sed x=1 export done local --verbose /usr/bin echo
+		$(pwd) then "$@" --verbose printf | 2>/dev/null
+export x=1 local "$@" then export done $(pwd) && -eu readonly export readonly --verbose
+		'quoted text' done sed then export grep "$1" 2>/dev/null
+		local then test export -eu cd cd x=1 awk echo "$1" done cd /usr/bin cd |
+	--verbose export /usr/bin readonly
+	"$@" sed -eu /usr/bin export readonly grep 2>/dev/null --verbose x=1 | && "$1"
+	2>/dev/null -eu printf cd
+"$1" then echo export
+		"$1" ${HOME} sed then awk
+		sed --verbose grep awk done sed
+test grep echo then ${HOME} 'quoted text'
+printf /usr/bin $(pwd) done && --verbose --verbose
+--verbose printf cd readonly "$@" && -eu 'quoted text'
+		&& echo $(pwd) local test local | grep
+-eu cd && /usr/bin echo done awk "$@" test
+		awk cd x=1 grep sed done | then export grep ${HOME}
+		"$1" sed "$1" -eu "$@" /usr/bin "$1" printf then cd echo awk "$1"
+-eu "$1" grep cd awk /usr/bin x=1 "$@" grep then cd ${HOME}
+&& ${HOME} test -eu local readonly x=1 then then sed test /usr/bin grep --verbose
+		test echo $(pwd) "$1" 2>/dev/null grep sed 2>/dev/null echo "$1" -eu then
+		local printf "$1" /usr/bin export
+$(pwd) && "$@" --verbose && printf && ${HOME} done printf /usr/bin then cd test
+	echo then ${HOME} grep "$@" then echo --verbose "$1" grep -eu $(pwd) | 2>/dev/null
+		export 'quoted text' "$@" ${HOME} grep | then grep x=1 sed
+2>/dev/null done && echo export readonly cd test /usr/bin export readonly /usr/bin
+printf sed "$1" "$@" readonly readonly /usr/bin ${HOME}
+		$(pwd) 'quoted text' /usr/bin 2>/dev/null sed sed awk ${HOME} -eu echo --verbose
+	cd done test ${HOME} readonly 'quoted text' x=1 --verbose "$@" x=1 export
+		sed ${HOME} ${HOME} ${HOME} 'quoted text' then test readonly
+/usr/bin printf printf
+		x=1 cd then export test
+		sed sed | | | 'quoted text' "$@" 2>/dev/null
+| sed | && test grep 2>/dev/null echo 2>/dev/null --verbose "$1" |
+	echo $(pwd) -eu printf readonly readonly
+		readonly ${HOME} $(pwd) $(pwd) 2>/dev/null grep "$1" 2>/dev/null
+		test "$1" local && && echo done cd /usr/bin && sed --verbose then echo --verbose
+		echo awk export "$@" printf 2>/dev/null local grep $(pwd) then then | local
+	2>/dev/null --verbose export cd
+"$@" test | awk x=1 $(pwd) then local x=1 /usr/bin
+		export readonly ${HOME} 'quoted text'
+done 'quoted text' -eu local test echo sed test then printf export 'quoted text'
+	export test done --verbose then done awk printf
+	grep 'quoted text' 2>/dev/null | "$1" "$1" ${HOME} export
+done 'quoted text' && awk 2>/dev/null cd export cd grep then echo
+/usr/bin printf done local printf /usr/bin "$1" -eu && | --verbose local
+		export /usr/bin "$@" -eu 2>/dev/null then grep /usr/bin done
+		$(pwd) -eu /usr/bin x=1 'quoted text' 2>/dev/null awk -eu 'quoted text'
+		${HOME} then test local 'quoted text' echo ${HOME}
+"$@" local | grep readonly printf test /usr/bin /usr/bin
+x=1 "$@" "$1" awk /usr/bin export $(pwd) /usr/bin
+"$@" local | "$1" && "$1" echo awk test "$@" export --verbose
+	"$@" "$1" echo x=1 test done export printf readonly
+		cd export readonly readonly
+'quoted text' done ${HOME} printf test test && $(pwd) "$@" x=1
+	echo $(pwd) export && awk /usr/bin sed x=1 done x=1 readonly
+		"$@" cd test echo ${HOME}
+local cd $(pwd) grep x=1 readonly 2>/dev/null local sed /usr/bin
+--verbose x=1 printf done
+${HOME} done --verbose sed export x=1 "$1" /usr/bin "$@" -eu 2>/dev/null 2>/dev/null
+$(pwd) grep -eu grep done /usr/bin 2>/dev/null readonly
+test awk -eu /usr/bin echo 'quoted text'
+		"$1" then /usr/bin "$1" 'quoted text' /usr/bin ${HOME} test sed
+	"$@" awk 'quoted text' $(pwd) awk /usr/bin /usr/bin && ${HOME}
+		grep sed $(pwd) "$@" /usr/bin "$1" readonly
+echo export | "$1" /usr/bin sed sed test done /usr/bin local test printf "$1" /usr/bin
+		/usr/bin "$@" -eu /usr/bin -eu 'quoted text' 'quoted text' /usr/bin grep
+${HOME} -eu $(pwd) test cd grep && export done readonly test
+readonly readonly | echo readonly ${HOME}
+$(pwd) local "$@" then local local sed awk
+	done --verbose grep sed
+		export echo $(pwd) "$@" readonly readonly sed echo $(pwd) export
+$(pwd) grep --verbose test | cd grep
+	printf then echo "$@" then local export /usr/bin | then
+	--verbose $(pwd) | /usr/bin done printf | awk "$@" ${HOME}
+		&& /usr/bin grep done printf sed local done
+		then $(pwd) sed ${HOME} 'quoted text' done "$@" -eu
+		printf "$1" $(pwd) local 2>/dev/null && grep
+"$1" 2>/dev/null sed 2>/dev/null 'quoted text'
+&& test grep cd && "$1" --verbose 'quoted text' printf 'quoted text' && awk
+		${HOME} /usr/bin 'quoted text' "$@" test echo
+		done && test readonly 2>/dev/null
+		x=1 printf then 2>/dev/null echo
+	grep cd then then awk grep "$@" 'quoted text' /usr/bin && grep then && grep ${HOME}
+		printf then printf printf x=1 export sed && test local x=1
+		-eu /usr/bin /usr/bin export readonly
+	"$1" -eu && /usr/bin $(pwd)
+	echo local printf local 'quoted text' 2>/dev/null x=1 printf
+--verbose "$1" sed "$@" echo -eu
+		--verbose 2>/dev/null readonly 2>/dev/null done then awk test test
+then /usr/bin then "$1" /usr/bin
+readonly cd grep /usr/bin test 'quoted text' printf
+-eu cd sed x=1 local $(pwd) ${HOME} x=1 test --verbose
+	export then then echo grep
+		/usr/bin readonly readonly $(pwd) echo grep -eu grep sed sed local local --verbose
+	-eu | "$1" "$@" -eu echo readonly echo printf
+local | sed test && --verbose sed &&
+then x=1 echo | cd echo export "$@" readonly 'quoted text' x=1 sed
+	-eu x=1 local "$@" grep export grep echo done
+	awk -eu -eu /usr/bin sed x=1 && grep test
+done "$1" ${HOME} cd sed | done x=1 printf "$1" sed cd local
+	"$1" x=1 $(pwd) readonly then --verbose printf "$1" "$1" grep
+	test sed sed cd printf echo then
+--verbose printf x=1 'quoted text' grep -eu done | x=1
+	grep 'quoted text' $(pwd) | 2>/dev/null 2>/dev/null $(pwd) cd export
+done && x=1 'quoted text' cd grep && ${HOME} ${HOME} | grep test
+awk export 2>/dev/null | export
+cd "$1" done readonly && awk x=1 echo sed -eu $(pwd) -eu then /usr/bin
+	done test 2>/dev/null then 'quoted text' grep x=1 export $(pwd) x=1 2>/dev/null
+	"$1" cd "$1" | sed then "$1" ${HOME}
+sed echo -eu -eu 'quoted text' sed readonly $(pwd) printf
+		local test $(pwd) sed sed x=1 ${HOME} done "$1" sed 'quoted text' ${HOME} awk -eu
+&& echo 2>/dev/null "$@" grep sed done $(pwd)
+		"$1" x=1 echo then test | awk
+	"$@" grep ${HOME} done
+	local x=1 $(pwd) local "$@" x=1 ${HOME} readonly
+		sed | sed export echo "$1" x=1 done done grep test
+	grep -eu echo done printf | /usr/bin readonly export echo done export export
+	| sed echo done done && | && local | x=1 echo export "$1" --verbose test "$1" -eu
+awk local "$@" then 2>/dev/null
+'quoted text' export | 2>/dev/null
+		sed 2>/dev/null 'quoted text' "$@" $(pwd) 2>/dev/null
+	grep local 'quoted text' /usr/bin -eu ${HOME} --verbose
+		cd cd 'quoted text' "$@" done export export grep readonly
+cd ${HOME} readonly "$1" printf awk done
+$(pwd) x=1 readonly -eu ${HOME} awk && export awk readonly printf --verbose
+| x=1 --verbose ${HOME} echo awk grep
+	then cd "$@" $(pwd) ${HOME} "$1" awk |
+then /usr/bin export ${HOME} test test -eu
+	$(pwd) --verbose 2>/dev/null "$@" awk 'quoted text' "$1" "$@" ${HOME}
+${HOME} grep sed then 2>/dev/null grep
+		echo cd echo test awk -eu readonly local cd $(pwd) local awk --verbose
+2>/dev/null 'quoted text' then local cd
+	sed /usr/bin 2>/dev/null readonly export 2>/dev/null | -eu "$@" --verbose
+	grep ${HOME} test printf $(pwd) --verbose /usr/bin done done $(pwd) sed
+	local readonly done 'quoted text' cd "$@" readonly
+${HOME} awk local awk /usr/bin "$1" ${HOME} && "$@" ${HOME}
+		awk -eu cd done "$@" "$1" | -eu test $(pwd) export export --verbose 'quoted text'
+export grep cd sed 'quoted text' test && done awk cd --verbose awk
+${HOME} test "$1" $(pwd) x=1 "$@" x=1 sed 2>/dev/null ${HOME} export
+		sed ${HOME} "$@" sed -eu readonly grep
+		cd ${HOME} "$1" printf then && ${HOME} x=1 printf /usr/bin done printf
+		awk | done 2>/dev/null readonly readonly $(pwd)
+		--verbose sed -eu ${HOME} $(pwd) --verbose awk x=1 export
+sed export /usr/bin grep -eu $(pwd) | done cd x=1 done echo readonly
+-eu readonly echo test export -eu test
+	local --verbose ${HOME}
+		then 'quoted text' -eu /usr/bin "$1"
+		2>/dev/null readonly "$1"
+/usr/bin "$@" sed "$@" 2>/dev/null --verbose
+/usr/bin 'quoted text' then sed done test printf echo x=1 ${HOME} export
+'quoted text' sed 2>/dev/null --verbose local --verbose cd awk then 2>/dev/null
+| ${HOME} 2>/dev/null -eu "$@" local done x=1 awk export grep awk /usr/bin
+cd --verbose ${HOME} ${HOME} echo /usr/bin then awk
+$(pwd) grep grep && done $(pwd) export test done "$1" -eu done
+		$(pwd) /usr/bin awk && x=1 "$1" test
+--verbose grep test grep $(pwd) printf readonly done -eu && readonly
+		readonly readonly test ${HOME} sed x=1 ${HOME} done then x=1 echo "$@" then 2>/dev/null
+	printf echo awk awk cd local
+	done | then 'quoted text' 'quoted text' readonly --verbose
+		| "$@" awk x=1 ${HOME} printf local grep grep "$@" ${HOME}
+	grep 'quoted text' printf then | "$@" 'quoted text' readonly
+	-eu -eu $(pwd) "$1" | grep
+		"$@" printf readonly $(pwd) "$@" grep /usr/bin ${HOME} printf local &&
+export "$@" "$1" | local /usr/bin --verbose cd echo 'quoted text'
+	cd local $(pwd) ${HOME} test
+		${HOME} ${HOME} export ${HOME} | done done cd "$1" then awk /usr/bin
+printf "$@" /usr/bin cd echo 'quoted text'
+	&& && && export "$1" then echo readonly awk | $(pwd) echo
+printf test then $(pwd) --verbose done $(pwd) --verbose
+x=1 'quoted text' local done echo
+	then local x=1 /usr/bin
+&& | test "$@" then --verbose /usr/bin x=1 $(pwd) "$@" local -eu 'quoted text'
+	local printf 'quoted text' echo 'quoted text' done test test | awk "$@" sed 2>/dev/null
+	test "$1" sed $(pwd) -eu | /usr/bin printf grep export 2>/dev/null 2>/dev/null
+	test 'quoted text' /usr/bin awk done cd "$1" ${HOME} -eu "$@" "$1" /usr/bin
+cd && "$1" awk grep 'quoted text' cd "$1" awk "$1" ${HOME} -eu
+	printf $(pwd) test export printf -eu awk readonly --verbose $(pwd) --verbose
+		--verbose /usr/bin $(pwd) then then local 2>/dev/null $(pwd) $(pwd) $(pwd)
+	$(pwd) printf awk local x=1 export && grep -eu done
+		${HOME} sed "$1" done | 'quoted text' --verbose
+'quoted text' | readonly 2>/dev/null
+test ${HOME} sed /usr/bin ${HOME}
+	-eu done $(pwd) /usr/bin then sed "$1" grep export
+	echo done printf export printf readonly readonly "$@" --verbose
+	--verbose cd x=1 sed "$@" $(pwd) 'quoted text' 2>/dev/null -eu -eu done
+	printf test 'quoted text' echo
+	${HOME} sed echo done test 2>/dev/null "$1" --verbose "$1" && local
+	cd awk 2>/dev/null awk -eu && echo $(pwd) "$1" test export
+	/usr/bin 2>/dev/null --verbose $(pwd) ${HOME} $(pwd)
+	"$@" local -eu 2>/dev/null
+		$(pwd) $(pwd) 2>/dev/null x=1 x=1 --verbose /usr/bin && --verbose
+	"$1" $(pwd) | ${HOME} x=1 test done x=1 grep
+&& sed $(pwd) cd local 'quoted text' -eu sed local cd x=1 printf
+		printf $(pwd) $(pwd) "$@" sed
+	local local $(pwd) 2>/dev/null sed test | printf $(pwd) "$@"
+	| printf $(pwd) | test printf echo
+		test | 2>/dev/null 2>/dev/null "$1" -eu echo
+	export grep $(pwd) cd readonly -eu then local then "$1" 'quoted text'
+2>/dev/null --verbose 'quoted text' | printf |
+	"$1" local --verbose grep && && grep readonly
+--verbose cd /usr/bin local done then 2>/dev/null
+		printf done printf x=1 "$1" cd
+x=1 grep local x=1 ${HOME} echo sed
+	&& 2>/dev/null test printf "$@" test "$1" "$1" awk |
+	then /usr/bin /usr/bin then echo test "$@" "$1"
+		'quoted text' /usr/bin then then echo
+		--verbose printf | printf $(pwd) cd grep local "$1" echo "$1"
+	'quoted text' echo done /usr/bin
+$(pwd) readonly done done sed sed sed printf && && local local local -eu
+		x=1 && done x=1 export x=1 done -eu ${HOME} "$@" && "$1"
+		export 2>/dev/null local local local x=1 then export echo 'quoted text'
+		/usr/bin cd local && /usr/bin 2>/dev/null cd -eu then printf &&
+		echo test echo grep then printf
+		then -eu "$@" -eu awk done "$1" test grep /usr/bin echo printf
+		grep x=1 'quoted text' ${HOME} test /usr/bin sed -eu grep
+		2>/dev/null -eu "$@" export then grep "$1"
+		awk /usr/bin && test echo awk echo export grep done $(pwd) grep
+	then "$@" printf && ${HOME} -eu
+	then awk then awk "$1" printf x=1 "$@" 'quoted text'
+		test sed "$1" cd export awk sed "$1" awk
+	export printf sed then | then local awk then && /usr/bin x=1 x=1 local local
+		2>/dev/null local readonly sed echo export
+	/usr/bin done "$1" then awk printf cd /usr/bin
+		awk /usr/bin && then printf printf x=1 readonly test x=1 awk echo local
+--verbose grep export -eu cd cd test
+	x=1 test $(pwd) then awk && test 2>/dev/null grep echo grep done && "$1" 2>/dev/null
+		cd sed "$@" -eu then cd
+	test /usr/bin then export | export readonly cd x=1 echo --verbose
+	| --verbose "$@" awk echo | | export |
+	then x=1 "$@" printf -eu readonly export awk
+	"$1" grep 'quoted text' $(pwd) then grep $(pwd) 2>/dev/null done ${HOME} readonly
+	echo "$@" "$@" done --verbose cd then ${HOME} 2>/dev/null
+		"$@" ${HOME} cd | -eu -eu done --verbose readonly && readonly /usr/bin 2>/dev/null
+		&& printf grep cd x=1 2>/dev/null ${HOME} $(pwd) grep ${HOME} $(pwd) readonly
+/usr/bin && /usr/bin "$1" $(pwd) readonly echo
+	test then /usr/bin awk --verbose done cd
+		printf export && test echo cd x=1 local readonly "$1" awk
+	cd "$1" then done && $(pwd) readonly awk sed 'quoted text' $(pwd) awk printf grep
+	echo then grep done grep $(pwd) --verbose readonly "$1" done cd && --verbose
+sed "$1" 'quoted text' /usr/bin x=1 awk | printf then 'quoted text' export
+	x=1 done test 'quoted text' 2>/dev/null sed awk "$@" 'quoted text'
+awk grep | /usr/bin echo
+	x=1 local "$1" ${HOME} 'quoted text' readonly local --verbose --verbose $(pwd)
+		grep "$@" done 'quoted text' done "$@" done awk ${HOME}
+	$(pwd) --verbose sed printf ${HOME} test cd awk
+		then then --verbose local export ${HOME} grep printf x=1 export
+	done done sed 'quoted text' x=1 /usr/bin echo export
+		| $(pwd) && $(pwd) awk | test
+	export cd 'quoted text' cd then /usr/bin $(pwd) 'quoted text'
+	test && sed "$1" test done /usr/bin readonly $(pwd) printf x=1 cd 'quoted text'
+	awk local done | -eu local then sed awk "$@" 2>/dev/null
+	x=1 done 'quoted text' readonly awk
+export 2>/dev/null x=1 -eu awk $(pwd) awk
+"$@" ${HOME} then test "$1" ${HOME} done /usr/bin $(pwd)
+test echo 2>/dev/null | sed awk x=1 "$1" then then "$1" export 2>/dev/null
+/usr/bin && $(pwd) | 'quoted text' 2>/dev/null grep | echo ${HOME}
+test echo -eu /usr/bin cd x=1 && grep readonly sed x=1
+		sed readonly && /usr/bin "$@" done echo | echo 'quoted text' done local 2>/dev/null
+--verbose grep readonly 2>/dev/null "$@"
+printf sed -eu printf && sed $(pwd) sed
+	echo x=1 test /usr/bin 2>/dev/null 'quoted text' done test --verbose echo
+		-eu then then local done awk 2>/dev/null --verbose
+		'quoted text' awk local --verbose
+		2>/dev/null /usr/bin done
+		test printf local awk grep test -eu | sed --verbose --verbose local test |
+export sed export local
+	'quoted text' readonly cd echo then awk printf $(pwd) "$1"
+2>/dev/null sed && readonly
+		test test then readonly local grep then printf
+		'quoted text' done --verbose
+	${HOME} grep $(pwd) readonly x=1 /usr/bin test --verbose /usr/bin
+		export readonly grep $(pwd)
+"$@" sed cd cd x=1 2>/dev/null printf export --verbose
+		awk grep 'quoted text' then x=1 'quoted text' echo 2>/dev/null
+		then cd "$1" printf 'quoted text' 'quoted text'
+	echo --verbose then -eu echo
+$(pwd) | x=1 && 2>/dev/null
+	echo | then "$1" sed $(pwd)
+		"$1" "$@" ${HOME} echo readonly && /usr/bin then $(pwd) $(pwd) printf 'quoted text'
+		local printf sed ${HOME} done ${HOME}
+	done sed done grep echo local cd "$1" --verbose 'quoted text'
+	x=1 /usr/bin readonly done "$1" cd -eu 2>/dev/null test "$@" export "$1" sed /usr/bin
+	printf --verbose "$1" -eu 'quoted text'
+2>/dev/null "$@" ${HOME} --verbose x=1 ${HOME} /usr/bin cd export echo "$1"
+	-eu awk local test && --verbose
+		$(pwd) && then cd /usr/bin then "$1" && cd "$@" printf grep 2>/dev/null echo then
+		awk /usr/bin --verbose 'quoted text' sed cd -eu cd $(pwd)
+export grep "$@" 2>/dev/null "$@" cd $(pwd) sed cd cd export -eu export
+	export 'quoted text' printf printf
+		${HOME} done awk echo
+$(pwd) ${HOME} sed printf --verbose then x=1 --verbose 'quoted text' 2>/dev/null
+	test 2>/dev/null --verbose 'quoted text' | echo "$1" test | grep export local done
+$(pwd) 2>/dev/null export cd -eu done x=1 printf done ${HOME}
+		grep done readonly /usr/bin | ${HOME} test "$1" $(pwd) ${HOME}
+	printf --verbose --verbose cd | grep printf then export "$1" $(pwd) local
+&& done --verbose ${HOME} x=1 | 2>/dev/null awk /usr/bin then readonly x=1
+x=1 && x=1 grep grep --verbose done "$1"
+	x=1 export 2>/dev/null local cd "$1" ${HOME} echo ${HOME} |
+/usr/bin "$1" echo cd "$@" local "$@"
+		printf "$@" readonly sed | test printf -eu then printf -eu
+		'quoted text' readonly awk test
+	readonly 'quoted text' export export local printf sed $(pwd) readonly
+	x=1 "$@" grep export | | 2>/dev/null | awk | x=1 echo -eu sed sed --verbose
+		-eu printf done $(pwd) --verbose printf 'quoted text'
+		then printf test "$1" cd -eu
+		&& ${HOME} printf grep /usr/bin ${HOME} | -eu -eu | local ${HOME}
+&& "$@" "$1" readonly "$@" test -eu grep ${HOME} readonly test
+		then done "$1" --verbose x=1 then awk export echo
+		sed sed && then | && printf readonly
+		'quoted text' 2>/dev/null grep "$@" cd readonly /usr/bin awk 'quoted text'
+		cd grep | export local && 'quoted text' "$1" awk 'quoted text' "$@" "$@"
+		then export --verbose cd -eu
+		| done /usr/bin x=1 /usr/bin
+	$(pwd) -eu awk cd echo grep test then
+		test ${HOME} cd readonly $(pwd) "$1" readonly 'quoted text' 2>/dev/null --verbose
+	/usr/bin printf 2>/dev/null local -eu --verbose done awk awk
+	/usr/bin test ${HOME} cd -eu export local $(pwd)
+		echo 2>/dev/null x=1 && /usr/bin
+		cd echo && /usr/bin cd ${HOME} -eu "$1" "$@" "$1" "$@" | test
+	export awk $(pwd) $(pwd) printf x=1
+cd $(pwd) "$@" ${HOME} --verbose echo printf 2>/dev/null --verbose --verbose local
+	local cd ${HOME} then --verbose printf
+		echo && "$@" "$@" cd ${HOME} 'quoted text'
+	cd && x=1 export | ${HOME} sed -eu
+		'quoted text' local grep 'quoted text' sed "$@" local x=1 | echo awk ${HOME}
+readonly 2>/dev/null x=1 /usr/bin x=1 export then 2>/dev/null cd 'quoted text'
+	&& $(pwd) && x=1 x=1 printf
+readonly cd --verbose test local export cd 'quoted text' local x=1
+${HOME} | local ${HOME} readonly local -eu done readonly readonly 2>/dev/null
+	readonly awk done --verbose /usr/bin -eu ${HOME} x=1 test "$1" grep /usr/bin
+	-eu -eu 'quoted text' done echo && awk 'quoted text' then x=1 cd sed awk
+		-eu $(pwd) | done "$1" awk awk ${HOME} -eu sed "$@" 2>/dev/null
+		'quoted text' "$@" readonly then then
+	| "$1" "$1" readonly cd | ${HOME} printf | | export $(pwd) --verbose 'quoted text'
+	printf cd 2>/dev/null --verbose --verbose awk x=1 test grep x=1 echo echo 'quoted text'
+done 2>/dev/null "$1" cd awk sed cd awk grep ${HOME} /usr/bin 'quoted text'
+readonly awk 2>/dev/null | "$1"
+	'quoted text' printf local | --verbose
+		then 2>/dev/null echo
+	cd sed ${HOME} printf x=1 ${HOME} printf --verbose echo readonly
+	done printf ${HOME} -eu --verbose
+"$1" export printf "$@" readonly test && sed awk 2>/dev/null "$@" export grep
+		/usr/bin export 'quoted text' --verbose then done /usr/bin $(pwd)
+cd local then /usr/bin readonly
+	/usr/bin $(pwd) readonly /usr/bin cd $(pwd)
+	x=1 'quoted text' local grep readonly $(pwd) done echo echo local done done &&
+	local x=1 'quoted text' && sed 2>/dev/null readonly
+	x=1 "$@" local --verbose ${HOME} -eu -eu
+sed x=1 x=1 --verbose $(pwd) $(pwd) && local
+		awk local grep | -eu readonly sed -eu then then && awk
+	${HOME} grep && local echo cd x=1 "$1" --verbose
+grep /usr/bin ${HOME} then printf export
+--verbose -eu echo | $(pwd) 2>/dev/null
+$(pwd) then cd printf done
+		then $(pwd) | --verbose cd "$@" --verbose x=1
+		printf grep export local "$@" then && cd x=1 echo echo
+		awk "$1" && x=1 ${HOME} local && --verbose done 2>/dev/null
+&& grep sed export "$@" "$@" 'quoted text' grep echo 'quoted text'
+| local x=1 readonly -eu readonly
+sed echo export | sed
+then --verbose /usr/bin cd sed
+	"$@" grep readonly "$1" 'quoted text' $(pwd)
+		grep cd test && 'quoted text' "$@" x=1 test done 2>/dev/null
+		${HOME} awk -eu export x=1
+		-eu --verbose 2>/dev/null -eu $(pwd) readonly sed 'quoted text' 2>/dev/null
+		sed cd awk echo -eu 'quoted text' done /usr/bin && 'quoted text'
+		then $(pwd) done "$1" 'quoted text' then then printf &&
+	x=1 'quoted text' 2>/dev/null test ${HOME}
+		cd "$1" printf sed grep readonly "$1"
+echo cd grep export 'quoted text' local --verbose
+printf echo $(pwd) printf test test local local -eu awk ${HOME} | x=1 export
+		-eu --verbose $(pwd)
+	echo -eu "$@" ${HOME}
+grep -eu /usr/bin then cd --verbose --verbose awk | "$@"
+		readonly readonly 'quoted text' printf ${HOME} x=1 "$1" then grep
+		"$1" --verbose local grep /usr/bin printf "$1" awk x=1 then $(pwd)
+		export local -eu 2>/dev/null ${HOME} 2>/dev/null grep
+done awk $(pwd) /usr/bin cd "$@" done 'quoted text' -eu export --verbose local "$1"
+	sed readonly 'quoted text' $(pwd)
+	2>/dev/null export --verbose ${HOME} | then 2>/dev/null
+done x=1 export awk echo "$1" readonly "$@" | printf && |
+	$(pwd) grep export done local $(pwd) done export
+${HOME} 'quoted text' grep then sed 2>/dev/null
+x=1 printf local readonly grep done 2>/dev/null local
+	local -eu awk | local done | x=1 cd
+then "$1" export export | cd x=1 x=1 --verbose "$@" grep "$1" then
+		sed -eu /usr/bin done -eu done | sed local
+	sed readonly cd "$@" then $(pwd) "$@" grep --verbose
+		grep /usr/bin ${HOME} && "$1" echo grep ${HOME} done echo --verbose 2>/dev/null
+	done echo ${HOME} grep 'quoted text' printf grep --verbose cd
+| printf ${HOME} /usr/bin sed ${HOME} && printf --verbose "$@" echo sed "$1"
+	test awk 2>/dev/null && echo grep local -eu x=1 && 'quoted text' readonly sed
+"$1" awk -eu $(pwd) export
+	--verbose 2>/dev/null cd | test done "$@" x=1 readonly 2>/dev/null
+		echo grep | then readonly cd --verbose echo
+	test done printf done export "$1" test 2>/dev/null | grep 2>/dev/null 'quoted text'
+	done --verbose local then "$@" 'quoted text'
+then sed then then "$1" "$1" then $(pwd) ${HOME} "$@" local readonly cd
+		| local "$@" test done "$@" then sed
+	echo sed -eu --verbose | 2>/dev/null 2>/dev/null
+		${HOME} then sed "$@" cd readonly
+x=1 $(pwd) x=1 then grep test test "$@" 'quoted text'
+		${HOME} readonly printf readonly echo -eu test
+		-eu x=1 readonly --verbose test "$1" 2>/dev/null cd 2>/dev/null --verbose
+	local local /usr/bin && /usr/bin "$1" -eu && cd cd sed echo 'quoted text'
+		/usr/bin test | && echo 2>/dev/null printf grep local "$@" -eu then
+		cd ${HOME} 2>/dev/null local ${HOME} readonly
+x=1 awk local readonly grep export 2>/dev/null cd --verbose local
+		grep echo "$1" "$1" 'quoted text'
+then done x=1 /usr/bin && | awk &&
+	echo ${HOME} done && --verbose
+		done grep && && && x=1 $(pwd) /usr/bin printf $(pwd) awk echo 2>/dev/null
+--verbose printf export
+then done --verbose done cd 2>/dev/null
+readonly ${HOME} "$@" cd "$1" test readonly grep ${HOME} readonly done
+cd awk ${HOME} cd --verbose awk "$@" then done printf test "$1" $(pwd) readonly
+	readonly ${HOME} x=1 $(pwd) ${HOME} $(pwd) 2>/dev/null && awk
+"$1" | cd local test 2>/dev/null
+		echo printf "$1" 2>/dev/null 2>/dev/null ${HOME} cd
+	test -eu cd --verbose test
+		then "$1" awk "$1" local test readonly echo done
+/usr/bin export sed $(pwd) echo 2>/dev/null grep $(pwd) ${HOME} echo && $(pwd)
+	grep && export cd -eu cd $(pwd) done local
+	2>/dev/null export 2>/dev/null 2>/dev/null done export 2>/dev/null "$1" cd
+	cd grep cd cd then -eu then ${HOME} $(pwd) ${HOME} awk grep done ${HOME} local
+		grep 'quoted text' | "$1" $(pwd) --verbose | -eu
+		cd test $(pwd) printf local && cd echo done && awk 2>/dev/null
+		| /usr/bin | -eu -eu export 'quoted text'
+		-eu ${HOME} --verbose
+	echo then "$@" x=1 local $(pwd) /usr/bin
+	awk ${HOME} $(pwd) 'quoted text' test echo 2>/dev/null "$@" 'quoted text'
+		"$1" printf /usr/bin 2>/dev/null
+		done | && $(pwd) x=1 x=1 readonly /usr/bin awk then $(pwd) awk readonly local
+printf $(pwd) | readonly -eu grep 2>/dev/null "$@" echo export awk printf "$1"
+		local 'quoted text' "$@" /usr/bin $(pwd) local --verbose
+local -eu /usr/bin test "$1" readonly echo then export -eu --verbose x=1
+	export -eu "$@" awk sed cd x=1 awk
+		cd && sed echo cd $(pwd) test cd && $(pwd) then --verbose awk export /usr/bin
+		x=1 "$@" awk x=1 done test test grep then test --verbose
+	test 2>/dev/null 'quoted text' done /usr/bin echo "$@" cd
+	${HOME} x=1 export x=1 ${HOME} sed printf test awk echo 'quoted text' -eu local
+	test ${HOME} local export printf
+	test $(pwd) | x=1 x=1 'quoted text' && awk echo
+		/usr/bin grep sed --verbose && ${HOME} /usr/bin test
+		printf printf /usr/bin | && cd ${HOME} readonly awk then | readonly
+		grep x=1 | --verbose | sed --verbose echo x=1 export
+"$@" | ${HOME} awk /usr/bin -eu then ${HOME} awk
+		x=1 done readonly export local awk printf
+		then then export awk "$1" "$@" | awk sed done --verbose done echo --verbose test
+"$1" readonly x=1 local then "$@" -eu 'quoted text'
+x=1 -eu --verbose local x=1 awk cd done 'quoted text' && export echo "$1"
+	| printf /usr/bin --verbose "$1" cd then test local --verbose /usr/bin
+		done | -eu && /usr/bin | echo sed export local 'quoted text' 'quoted text'
+		| echo -eu ${HOME} "$@" then -eu /usr/bin echo x=1 then | done ${HOME} grep
+2>/dev/null --verbose ${HOME} echo done 2>/dev/null &&
+		cd 2>/dev/null readonly -eu 'quoted text' ${HOME}
+| | done export sed grep grep awk
+then "$@" "$@" test cd echo "$@" then readonly test local readonly
+	cd | echo readonly "$@" then --verbose | "$1" -eu export 'quoted text'
+	printf export export --verbose | $(pwd) test awk export readonly
+	readonly ${HOME} printf awk x=1 printf 2>/dev/null
+	&& x=1 export $(pwd) sed --verbose ${HOME}
+		echo local 'quoted text' then 2>/dev/null "$1" /usr/bin && sed printf && export
+	${HOME} "$1" /usr/bin awk | /usr/bin
+	sed "$1" -eu readonly $(pwd) --verbose "$@" grep awk readonly
+		--verbose test "$@" local printf 'quoted text' awk && && echo test 'quoted text'
+		--verbose "$@" "$@" 'quoted text' && --verbose "$1" cd 2>/dev/null readonly
+		/usr/bin "$@" "$1" && 2>/dev/null
+	sed $(pwd) sed printf && done sed --verbose
+	then sed readonly echo x=1 done "$@" readonly
+		"$1" x=1 cd then printf | echo | -eu 2>/dev/null "$1" 'quoted text' cd grep && x=1
+| printf -eu "$1" 'quoted text'
+		echo done && | done /usr/bin
+		then then cd "$@" "$@" -eu done grep echo sed 2>/dev/null echo then
+	x=1 done test "$1" awk test local export -eu grep $(pwd) 2>/dev/null 2>/dev/null
+		'quoted text' local "$1" "$1" $(pwd) $(pwd) $(pwd)
+"$@" sed ${HOME} test $(pwd) $(pwd)
+		x=1 printf | /usr/bin export x=1 x=1 sed ${HOME} echo 2>/dev/null
+	echo test -eu x=1 sed
+awk | awk 'quoted text' printf sed -eu cd | export then "$@"
+grep sed local "$1" echo /usr/bin local export /usr/bin then export 2>/dev/null
+	done then x=1 done then awk "$1" $(pwd)
+	2>/dev/null && grep cd -eu echo "$@" echo | test readonly export "$@" awk local
+	done printf | ${HOME} && && sed "$@" grep
+local local local then cd 'quoted text' | echo
+	sed done cd x=1 | "$@"
+${HOME} done printf local test export
+		${HOME} test grep sed test readonly test awk "$1" /usr/bin "$@" cd "$@"
+		2>/dev/null awk 'quoted text' --verbose cd test | &&
+-eu printf echo sed ${HOME} $(pwd) local &&
+	'quoted text' printf local --verbose ${HOME} sed local
+| "$@" "$1" echo --verbose readonly 2>/dev/null
+	2>/dev/null --verbose echo
+	-eu | grep | /usr/bin awk test x=1 cd "$@"
+		grep /usr/bin x=1 2>/dev/null ${HOME} readonly echo sed "$@" | done local "$1"
+	/usr/bin 2>/dev/null sed test 'quoted text' cd -eu cd awk sed
+echo then -eu | 2>/dev/null test sed $(pwd) cd echo
+	echo awk $(pwd) sed x=1 /usr/bin "$1" -eu x=1 printf 'quoted text' x=1 | grep
+		$(pwd) readonly awk echo --verbose
+x=1 echo grep export awk then ${HOME}
+echo -eu then then done ${HOME} export readonly readonly
+		$(pwd) | 2>/dev/null 2>/dev/null 'quoted text'
+export then $(pwd) --verbose echo
+		local awk readonly done done readonly ${HOME} cd 2>/dev/null done test
+		export grep cd | local cd /usr/bin printf test awk 2>/dev/null printf
+x=1 ${HOME} --verbose x=1 --verbose && grep sed 'quoted text'
+	readonly ${HOME} echo done sed "$@" cd ${HOME} awk ${HOME}
+"$1" "$1" awk x=1 x=1 --verbose local done printf
+		/usr/bin echo x=1 ${HOME} /usr/bin && readonly cd grep "$@" $(pwd)
+		"$@" 'quoted text' "$@" $(pwd) grep sed done printf --verbose
+		awk done -eu sed done grep local
+${HOME} cd printf readonly "$@" "$@" "$@" /usr/bin -eu grep printf "$@"
+		-eu awk grep "$@" && "$@"
+${HOME} then 2>/dev/null local
+	local && echo printf local "$1" /usr/bin readonly done
+		${HOME} ${HOME} awk printf && ${HOME}
+	echo $(pwd) --verbose 'quoted text' $(pwd) then |
+		--verbose 'quoted text' && /usr/bin then | && readonly
+	export && printf local "$@" printf echo
+	${HOME} | grep local ${HOME} ${HOME} ${HOME} printf $(pwd)
+		-eu done printf x=1 cd -eu readonly done /usr/bin printf
+echo grep sed --verbose
+		test "$1" 2>/dev/null export x=1 then test awk
+export export readonly printf readonly 'quoted text' && grep grep
+	test cd done local "$@" 2>/dev/null
+'quoted text' local readonly done /usr/bin then grep x=1 ${HOME} grep
+	then local printf echo done "$@" awk "$1" 'quoted text' -eu local "$@"
+		${HOME} --verbose local local
+"$1" /usr/bin && $(pwd) /usr/bin -eu
+		'quoted text' && ${HOME}
+		&& then awk then 2>/dev/null test cd
+	2>/dev/null cd printf 'quoted text' export $(pwd) local export
+		-eu test local 'quoted text' readonly readonly grep && "$1" awk -eu
+readonly "$@" --verbose "$1" $(pwd) echo --verbose readonly -eu test done
+		${HOME} -eu | done done | test /usr/bin test /usr/bin
+		readonly | export export 2>/dev/null
+export sed "$1" --verbose readonly 2>/dev/null printf awk 'quoted text'
+		sed local "$@" && --verbose $(pwd)
+"$1" readonly echo -eu --verbose 2>/dev/null
+| sed sed export | cd $(pwd) "$1" && ${HOME} 'quoted text'
+	--verbose printf echo cd "$@" done sed printf test | --verbose done local
+awk x=1 printf /usr/bin awk
+	readonly export && awk readonly | printf | | test "$@" --verbose
+	$(pwd) $(pwd) export readonly /usr/bin "$@" printf $(pwd) 2>/dev/null
+	&& sed && awk sed awk local sed then $(pwd) then "$1" export
+		then then "$1" export && echo /usr/bin test $(pwd)
+echo | sed "$1" awk -eu
+x=1 "$1" printf 2>/dev/null awk -eu cd
+awk cd cd && ${HOME} --verbose done /usr/bin
+		| printf readonly "$@" | --verbose /usr/bin export then
+$(pwd) /usr/bin sed local -eu
+	--verbose grep 'quoted text' ${HOME}
+		sed --verbose done awk /usr/bin
+x=1 sed 2>/dev/null echo ${HOME} grep ${HOME}
+local --verbose done /usr/bin 2>/dev/null
+		'quoted text' done 'quoted text' cd then sed
+&& /usr/bin sed awk 2>/dev/null cd printf cd printf export sed | awk printf
+	/usr/bin ${HOME} "$@" /usr/bin 'quoted text' cd awk test done /usr/bin
+		grep done readonly $(pwd) awk --verbose "$1" done awk cd -eu /usr/bin
+	/usr/bin printf local local ${HOME} test grep readonly cd -eu awk $(pwd)
+awk 2>/dev/null test $(pwd) x=1 cd | "$@" then "$@" | x=1 --verbose
+	/usr/bin "$@" echo then
+	local grep "$1" ${HOME} --verbose awk x=1 | then
+cd test sed local done 'quoted text' done awk "$1" cd
+	2>/dev/null sed grep x=1
+cd readonly export $(pwd) 2>/dev/null 'quoted text'
+		echo export -eu $(pwd) x=1
+"$1" awk export grep test test awk echo readonly readonly
+	then "$@" printf && export cd sed ${HOME} grep done done awk echo echo export &&
+		done "$1" test printf /usr/bin "$1" awk sed echo then echo $(pwd)
+	awk $(pwd) 'quoted text' "$@" echo -eu | echo "$@"
+readonly "$1" export cd done sed ${HOME} /usr/bin x=1 ${HOME} | "$1"
+		sed export "$@" awk echo /usr/bin $(pwd)
+	echo -eu cd done 'quoted text' sed local "$@"
+export sed done "$1" local local /usr/bin test | local x=1 test "$@"
+awk 2>/dev/null grep -eu readonly | && done --verbose 'quoted text' then grep
+"$1" sed --verbose test "$@" 'quoted text' /usr/bin test "$@"
+		"$1" /usr/bin /usr/bin done "$@" sed 2>/dev/null
+		readonly x=1 /usr/bin sed echo && awk cd | grep
+		$(pwd) "$1" test -eu awk cd
+	done echo -eu $(pwd) grep then "$@" test $(pwd) export x=1 echo
+sed done printf && | /usr/bin printf -eu /usr/bin echo done
+	2>/dev/null printf printf 2>/dev/null readonly cd &&
+x=1 grep x=1 echo $(pwd) x=1 export grep done readonly
+		$(pwd) readonly sed readonly readonly
+	test then 2>/dev/null | local test done local /usr/bin local | -eu
+	done 'quoted text' then readonly && 'quoted text' $(pwd) printf
+		readonly -eu then $(pwd) done x=1 export | sed test "$@" 2>/dev/null 'quoted text'
+	test && x=1 ${HOME} /usr/bin readonly test then printf -eu ${HOME} echo
+	printf done ${HOME} export then test "$@" printf --verbose | "$@" printf
+	sed /usr/bin readonly /usr/bin echo 'quoted text' $(pwd) echo
+cd 2>/dev/null ${HOME} x=1 2>/dev/null export done export -eu "$1" --verbose
+	| then then --verbose export 2>/dev/null grep sed export readonly && then
+done | then test ${HOME} /usr/bin
+		"$1" && cd test $(pwd) $(pwd) readonly 2>/dev/null readonly test printf
+awk --verbose then test export | | "$1" 2>/dev/null awk /usr/bin
+	| test grep echo done ${HOME} echo x=1 sed awk | $(pwd) echo x=1 test 'quoted text'
+test then && --verbose local && --verbose
+	&& 2>/dev/null | echo $(pwd) $(pwd) 2>/dev/null
+local && echo 'quoted text' | -eu
+		-eu ${HOME} done readonly awk echo grep then printf
+		${HOME} 2>/dev/null then x=1 grep &&
+&& 2>/dev/null 2>/dev/null local grep && then local readonly
+		/usr/bin sed | $(pwd) $(pwd) --verbose | -eu "$1" cd local
+		${HOME} 'quoted text' 'quoted text' sed grep && "$@" --verbose
+awk printf local -eu local "$@" -eu /usr/bin
+echo $(pwd) then awk echo readonly
+		sed awk export | --verbose sed then echo sed ${HOME} 2>/dev/null then && 'quoted text'
+then && 'quoted text' && "$@" 'quoted text'
+	done && -eu done -eu readonly "$@" done 2>/dev/null
+2>/dev/null done then x=1 echo 2>/dev/null sed local
+		2>/dev/null then "$1" cd -eu && && --verbose
+readonly -eu then done printf readonly cd export
+sed x=1 sed 'quoted text' 2>/dev/null ${HOME}
+&& $(pwd) export done /usr/bin cd echo then export ${HOME}
+	"$1" grep local awk | 'quoted text' test /usr/bin sed cd export
+readonly sed test awk grep grep 2>/dev/null
+	/usr/bin grep --verbose
+"$1" "$@" "$1" | grep | && /usr/bin x=1 "$1" export |
+		2>/dev/null ${HOME} cd -eu local grep echo
+	printf --verbose ${HOME} awk printf done ${HOME} ${HOME} && done sed 'quoted text'
+-eu readonly "$1" readonly x=1 -eu grep done "$1" sed x=1 --verbose 'quoted text'
+		'quoted text' x=1 --verbose | export test done -eu test $(pwd) cd
+awk $(pwd) done ${HOME} $(pwd) grep
+		--verbose $(pwd) x=1 local 2>/dev/null x=1 x=1 grep ${HOME} -eu
+		grep ${HOME} printf ${HOME} -eu --verbose "$1" | test
+		--verbose 'quoted text' "$@" x=1
+	readonly grep awk printf sed -eu 2>/dev/null "$@" then 2>/dev/null
+		/usr/bin $(pwd) cd test awk
+		readonly x=1 echo "$@"
+	/usr/bin grep cd grep cd then "$1" then done
+	grep 'quoted text' readonly 'quoted text' ${HOME} done test sed
+		-eu local done test cd && then 2>/dev/null
+	sed --verbose printf local -eu local |
+cd test 2>/dev/null -eu x=1 $(pwd) ${HOME} done
+'quoted text' grep "$@" 'quoted text'
+'quoted text' done sed awk printf readonly
+	done 'quoted text' $(pwd) $(pwd) x=1 "$@" then readonly printf done
+${HOME} | x=1 test "$1" 'quoted text' --verbose readonly
+"$@" test sed /usr/bin "$1"
+		echo test echo "$@" then
+	'quoted text' && export
+awk test readonly readonly grep $(pwd) 'quoted text' x=1 "$1" printf sed local printf
+		local && sed 2>/dev/null readonly 2>/dev/null printf readonly readonly && cd |
+		grep then printf $(pwd) --verbose test /usr/bin printf
+		sed $(pwd) "$1" | done local then $(pwd) 'quoted text' 'quoted text' grep local
+	&& awk ${HOME} awk sed cd sed &&
+then | printf sed --verbose echo printf
+'quoted text' test ${HOME} 2>/dev/null
+$(pwd) then x=1 echo $(pwd) done ${HOME} | | && echo local readonly test
+		export "$1" local awk cd awk 'quoted text'
+		grep done printf echo /usr/bin done "$@" readonly test "$1" readonly
+| | 2>/dev/null && cd -eu export test export
+readonly $(pwd) /usr/bin echo
+cd cd x=1 2>/dev/null then awk local "$@" export
+		x=1 local readonly grep test readonly "$1" -eu
+	| && 'quoted text' test export /usr/bin local --verbose export -eu "$1"
+echo "$@" 'quoted text' then
+	x=1 'quoted text' then 'quoted text'
+	"$@" "$@" cd test /usr/bin 2>/dev/null sed test x=1
+		then ${HOME} export awk local $(pwd) local 2>/dev/null
+	test done export -eu local /usr/bin grep 2>/dev/null
+test sed export printf -eu
+		cd then readonly x=1 x=1 -eu $(pwd) x=1 readonly local then
+grep export 2>/dev/null printf
+		-eu $(pwd) x=1 test ${HOME} grep 2>/dev/null sed test
+	test $(pwd) $(pwd) done then && x=1 awk x=1
+		$(pwd) local | /usr/bin grep printf awk 'quoted text' |
+sed awk local | && $(pwd)
+/usr/bin "$@" "$1" "$1" cd $(pwd) && readonly "$1" export -eu readonly x=1
+		| awk x=1 "$1" ${HOME} -eu $(pwd) ${HOME} ${HOME} | x=1
+		sed test "$1" && | awk done awk sed cd x=1 printf x=1 /usr/bin
+	then ${HOME} then && x=1 -eu grep --verbose
+		"$1" awk done 2>/dev/null && $(pwd) awk 2>/dev/null local x=1 test && done
+"$1" x=1 'quoted text' 2>/dev/null
+	readonly grep echo sed 'quoted text' cd then done awk test "$1"
+| /usr/bin readonly 2>/dev/null "$1" | ${HOME} then readonly
+grep | export readonly awk test cd
+echo test readonly grep && done
+&& done printf printf done test && | ${HOME} readonly /usr/bin
+	--verbose done /usr/bin awk readonly && cd printf "$@"
+	$(pwd) test -eu && 'quoted text' grep cd | "$1" echo "$1" test local
+awk local 'quoted text' sed
+x=1 test cd cd echo 2>/dev/null export
+	cd then export then ${HOME} ${HOME} grep "$@" 2>/dev/null --verbose printf
+	'quoted text' "$@" printf --verbose then -eu x=1 echo --verbose awk printf $(pwd)
+2>/dev/null && /usr/bin /usr/bin test awk "$@" 2>/dev/null
+'quoted text' grep grep ${HOME}
+		done -eu && cd awk | sed "$@" sed readonly 2>/dev/null export sed echo
+-eu grep printf printf export --verbose 'quoted text' --verbose
+	export awk ${HOME} "$1" then --verbose
+&& && --verbose -eu ${HOME} sed $(pwd) x=1 sed readonly x=1 export --verbose
+		test local awk printf /usr/bin | then cd -eu readonly 2>/dev/null 'quoted text'
+-eu "$1" "$@" printf "$1" --verbose
+		done | readonly grep then test echo
+export | x=1 --verbose echo grep sed test cd test "$@"
+	printf export test $(pwd) test
+		done local "$1" grep
+		| local printf cd printf 'quoted text' | $(pwd) test test "$@" | echo -eu local
+printf local test $(pwd) "$1" sed done
+sed echo done printf 'quoted text'
+		grep done printf then grep cd /usr/bin local echo echo -eu sed readonly
+'quoted text' echo "$1" && | 'quoted text' echo grep
+	sed /usr/bin --verbose "$1" && 2>/dev/null awk local test |
+		echo printf ${HOME} test grep local awk "$1" ${HOME}
+		"$@" x=1 /usr/bin then awk cd printf -eu readonly 'quoted text'
+		local awk echo "$@" $(pwd)
+grep done "$1" grep echo $(pwd) cd export | | 'quoted text'
+	"$1" grep ${HOME} cd printf -eu test then printf ${HOME}
+$(pwd) 'quoted text' test "$@" ${HOME} ${HOME}
+		then export && awk && --verbose grep grep --verbose sed local
+		| ${HOME} done then echo done grep --verbose $(pwd) -eu export
+&& echo cd cd export grep sed local /usr/bin awk -eu "$1"
+		x=1 2>/dev/null 'quoted text' done --verbose
+	x=1 printf export grep "$@" cd cd grep cd grep ${HOME} ${HOME} | 2>/dev/null export
+	printf "$@" test "$1" export awk export "$@" test
+	cd grep sed sed | then grep readonly --verbose
+#include c162.sh
+"$@" printf /usr/bin
+echo 2>/dev/null cd "$@" local cd | /usr/bin "$@" /usr/bin awk
+	"$1" test "$1" --verbose awk $(pwd) 2>/dev/null | readonly local echo /usr/bin
+	printf 2>/dev/null cd local local | "$@" export -eu --verbose readonly
+	printf x=1 cd done then 2>/dev/null 'quoted text' ${HOME} --verbose
+	-eu sed ${HOME} x=1 echo 'quoted text' awk -eu
+	export done sed "$1" local echo ${HOME}
+awk ${HOME} readonly | done && echo cd echo "$@"
+		| echo local cd 'quoted text'
+	${HOME} "$@" /usr/bin "$@" --verbose
+/usr/bin test --verbose "$1" printf then printf -eu printf /usr/bin "$@" grep
+		local export echo readonly 2>/dev/null test echo | printf --verbose
+	then 'quoted text' /usr/bin
+	cd ${HOME} grep && readonly
+	cd -eu /usr/bin readonly awk 2>/dev/null -eu echo echo sed test
+--verbose $(pwd) awk ${HOME} awk "$1" readonly test 'quoted text' done $(pwd)
+grep printf done ${HOME} readonly export then -eu printf done x=1 awk
+	"$1" then sed && x=1 grep -eu && done awk readonly
+		2>/dev/null echo "$1" && printf sed
+	'quoted text' test ${HOME} && | printf readonly local /usr/bin printf
+		| /usr/bin awk --verbose ${HOME} 'quoted text' printf test grep
+test "$@" echo ${HOME} "$@" export echo readonly readonly && printf echo
+		&& export --verbose | echo then "$@" awk cd 'quoted text' -eu awk
+$(pwd) then test 2>/dev/null then $(pwd) --verbose local readonly
+	'quoted text' echo "$@" done sed
+		${HOME} cd ${HOME} grep | | --verbose sed awk readonly
+-eu /usr/bin printf grep x=1 "$@" "$1" grep local -eu x=1 sed "$1"
+"$1" x=1 test local "$1" -eu
+sed sed --verbose awk readonly grep export local "$@"
+		"$1" && -eu | -eu awk then --verbose grep cd
+	readonly readonly x=1 printf
+printf test 2>/dev/null 'quoted text' 2>/dev/null
+${HOME} /usr/bin then printf
+done $(pwd) export x=1 "$@" awk $(pwd) cd 2>/dev/null
+then awk "$1" sed test echo /usr/bin --verbose "$1" /usr/bin then 'quoted text'
+		$(pwd) cd done local ${HOME} sed $(pwd) -eu /usr/bin --verbose then export cd export
+		awk local grep echo --verbose /usr/bin
+'quoted text' cd 2>/dev/null export | grep sed export
+		--verbose then ${HOME} --verbose test $(pwd)
+	done -eu "$1" -eu --verbose
+test -eu && printf --verbose test -eu x=1 "$1" local -eu "$1" cd 2>/dev/null
+		'quoted text' local local done printf sed cd "$@" /usr/bin x=1 | local x=1
+		local $(pwd) "$1" && awk then -eu readonly sed x=1 $(pwd) &&
+		printf ${HOME} local 'quoted text' local then readonly readonly
+		cd ${HOME} readonly readonly
+local readonly awk done | 'quoted text' done 'quoted text' awk
+		-eu 2>/dev/null done export local grep 'quoted text' /usr/bin grep x=1 | grep
+		--verbose then /usr/bin ${HOME} 2>/dev/null grep -eu echo
+	grep export awk export /usr/bin local -eu 'quoted text'
+	grep $(pwd) printf $(pwd) "$@" cd printf printf printf "$@"
+		test | -eu export "$@" $(pwd) sed local export test "$@" ${HOME} echo export
+readonly $(pwd) grep grep /usr/bin "$1" /usr/bin $(pwd) "$1"
+	sed printf $(pwd) | 'quoted text' readonly awk test $(pwd) export 2>/dev/null
+	/usr/bin 2>/dev/null awk awk printf --verbose
+--verbose ${HOME} export done echo && cd
+	"$@" echo local echo printf test then /usr/bin
+${HOME} sed test then test readonly readonly ${HOME} test 2>/dev/null x=1 "$@"
+	$(pwd) cd "$@" then -eu
+2>/dev/null then sed "$1" readonly --verbose 'quoted text'
+		export readonly cd local $(pwd) --verbose sed x=1 "$1" local
+	then cd -eu "$@" local && done "$@" /usr/bin
+then x=1 $(pwd) then 'quoted text' 2>/dev/null grep | ${HOME} && 'quoted text'
+then x=1 ${HOME} export /usr/bin
+"$1" cd --verbose | 'quoted text'
+		then "$1" $(pwd) 'quoted text'
+		printf -eu export x=1 $(pwd) 'quoted text' export x=1
+	--verbose "$1" test readonly test echo "$@" -eu -eu ${HOME} x=1 local -eu echo
+		'quoted text' echo x=1 printf grep "$@" x=1 cd done cd | 2>/dev/null test
+	/usr/bin /usr/bin test -eu grep echo
+		grep then 2>/dev/null printf
+then "$@" done export -eu sed --verbose
+	local grep $(pwd) done --verbose test x=1 $(pwd) $(pwd) then x=1 $(pwd)
+	-eu "$1" /usr/bin 2>/dev/null then 'quoted text'
+export --verbose sed then $(pwd) awk done grep echo "$1" awk $(pwd) && /usr/bin
+	--verbose 'quoted text' -eu --verbose
+		then export -eu "$@" -eu cd && ${HOME} printf 2>/dev/null
+$(pwd) ${HOME} | then then | 'quoted text'
+	export 2>/dev/null export export awk &&
+	cd -eu readonly printf $(pwd) && printf /usr/bin ${HOME} printf x=1
+		-eu awk done 'quoted text' then done x=1 -eu ${HOME}
+		export sed local sed 'quoted text' /usr/bin ${HOME} sed cd local echo sed
+	"$1" cd sed x=1 done 'quoted text' ${HOME} --verbose
+| readonly awk && /usr/bin ${HOME}
+test sed /usr/bin "$@" awk cd local x=1 awk && -eu
+		echo cd echo then then /usr/bin 2>/dev/null "$1" 'quoted text' then "$@" local
+	local grep readonly "$1" export x=1 readonly done awk 'quoted text'
+	--verbose /usr/bin 'quoted text'
+test -eu printf $(pwd) x=1 | local 'quoted text'
+awk -eu test x=1 grep x=1 readonly "$@" 2>/dev/null then
+		2>/dev/null sed -eu 'quoted text' && cd test
+	export done then echo "$@" awk done awk "$@" then sed
+	x=1 test $(pwd) test awk grep echo echo done /usr/bin "$1" readonly
+		grep 2>/dev/null "$@" awk 2>/dev/null then cd cd echo
+		export local 2>/dev/null readonly x=1 local sed
+	&& 'quoted text' && sed -eu 'quoted text' test echo x=1 cd --verbose
+	printf 2>/dev/null && /usr/bin "$1" "$1"
+		export /usr/bin $(pwd) cd --verbose $(pwd)
+	-eu x=1 ${HOME} grep 'quoted text' export then then readonly test /usr/bin 'quoted text'
+	readonly ${HOME} cd test | /usr/bin --verbose
+done test --verbose export grep -eu 2>/dev/null then
+		--verbose done then printf cd grep -eu echo 2>/dev/null local
+		'quoted text' readonly export grep | ${HOME} | printf
+	"$@" -eu 'quoted text' cd echo
+	/usr/bin --verbose "$1" "$@" cd --verbose &&
+local cd "$@" grep done echo echo readonly
+| "$@" "$@" grep local grep 'quoted text'
+		sed done then "$@" done
+		"$1" echo local sed --verbose
+	/usr/bin grep $(pwd) local "$@"
+${HOME} awk sed && echo
+	export "$@" $(pwd) -eu echo $(pwd)
+		test $(pwd) sed grep --verbose cd echo done --verbose printf x=1 readonly echo
+${HOME} --verbose local awk && | done ${HOME} /usr/bin $(pwd) 2>/dev/null
+	&& then "$@" done ${HOME} grep --verbose cd
+	2>/dev/null grep $(pwd) /usr/bin local -eu --verbose 2>/dev/null
+test echo $(pwd) | echo /usr/bin echo ${HOME} x=1
+	export 'quoted text' "$1" printf && 2>/dev/null -eu x=1 "$@" x=1 cd test
+	--verbose /usr/bin grep 'quoted text' "$@" && readonly $(pwd) readonly --verbose
+grep export readonly x=1 | printf cd /usr/bin
+test awk echo done echo test done local cd && /usr/bin
+		awk && | sed then awk export -eu cd /usr/bin
+grep cd 2>/dev/null then sed sed && $(pwd)
+/usr/bin "$1" grep 'quoted text' then 2>/dev/null sed echo done cd cd "$1" printf
+		-eu && "$1" awk -eu grep sed x=1
+	x=1 sed --verbose $(pwd) then -eu "$1" export local test 'quoted text'
+then "$1" | "$1" $(pwd) 2>/dev/null
+		--verbose done ${HOME} -eu done $(pwd) sed local 'quoted text'
+	cd 'quoted text' "$1" echo readonly export then echo grep grep test printf
+	"$@" "$1" then --verbose local ${HOME} x=1
+test local done /usr/bin echo /usr/bin | $(pwd) && local cd grep done cd
+		sed ${HOME} --verbose grep cd cd export /usr/bin | echo x=1
+		"$@" ${HOME} local 'quoted text' --verbose | awk -eu printf
+		test cd --verbose "$1" sed cd sed $(pwd) done "$1"
+printf -eu awk 'quoted text'
+	| $(pwd) awk cd done printf done
+${HOME} 2>/dev/null && printf then "$@" /usr/bin && echo ${HOME}
+done test $(pwd) export test
+	test printf $(pwd) sed awk done done awk awk $(pwd) cd
+		&& export x=1 sed | sed awk sed grep ${HOME} -eu -eu
+		2>/dev/null -eu 2>/dev/null $(pwd) printf
+-eu && && test echo local $(pwd) then ${HOME}
+	cd 2>/dev/null /usr/bin "$@" then "$@" --verbose ${HOME} test x=1 "$@" test
+$(pwd) then awk 2>/dev/null awk --verbose $(pwd) $(pwd) cd 'quoted text'
+		printf && "$@" "$@" && $(pwd) /usr/bin
+		then sed sed echo readonly export readonly export then /usr/bin printf -eu readonly
+		done then test /usr/bin echo -eu local "$1" "$1"
+	cd test --verbose /usr/bin x=1
+	sed --verbose "$1" echo -eu test cd echo sed "$@" --verbose -eu
+x=1 && test "$1" /usr/bin test awk "$@" test 'quoted text'
+		cd export test && -eu test "$@" done done printf awk ${HOME} -eu $(pwd)
+		local awk cd -eu && && export done && sed /usr/bin "$1" printf 'quoted text'
+		local /usr/bin printf printf "$@" awk --verbose ${HOME} 'quoted text'
+export "$@" "$1" grep "$1" $(pwd) -eu -eu test cd sed --verbose
+	local then "$@" && -eu done cd | readonly "$1" --verbose local local grep ${HOME}
+	echo && "$@" export ${HOME} "$1" cd && awk x=1 done export then local
+	readonly x=1 | x=1 echo $(pwd) local grep "$@" printf "$1" 'quoted text'
+	&& /usr/bin awk done sed sed cd cd sed --verbose /usr/bin
+	${HOME} printf "$@" ${HOME} && sed "$1"
+echo 2>/dev/null "$1" readonly then grep awk export
+readonly $(pwd) cd then ${HOME} cd grep printf ${HOME} then "$1" then
+		printf done 'quoted text' /usr/bin local
+	--verbose && test "$@"
+echo && "$1" sed done readonly --verbose cd echo local | "$@" sed
+		x=1 'quoted text' cd x=1 awk /usr/bin x=1 local "$1"
+&& "$@" /usr/bin "$1" sed
+	| local cd grep 2>/dev/null local
+--verbose && local test --verbose 2>/dev/null cd test 2>/dev/null
+		"$1" readonly printf then | 2>/dev/null 2>/dev/null 2>/dev/null local "$1"
+		printf then --verbose then $(pwd) "$@" "$@" ${HOME} 2>/dev/null
+		$(pwd) done test then export "$@" grep export
+	then --verbose 2>/dev/null then readonly
+		grep then && awk 'quoted text'
+readonly awk readonly | | | export printf then done "$@" echo
+		then "$@" printf 'quoted text' test export then printf --verbose
+export /usr/bin cd "$@" sed $(pwd)
+	readonly && "$1" -eu | then $(pwd) -eu echo && "$1" then local
+	readonly cd then grep printf test --verbose 'quoted text' then 'quoted text'
+sed local 'quoted text' readonly /usr/bin "$@"
+	"$1" printf cd local test $(pwd) local readonly | local "$1" "$@" printf export
+	-eu echo /usr/bin export 2>/dev/null && then | "$@"
+echo then printf readonly | 'quoted text'
+-eu 2>/dev/null then local readonly -eu test
+		readonly --verbose printf cd then x=1 -eu ${HOME} $(pwd)
+	'quoted text' export ${HOME} "$@" && | /usr/bin
+2>/dev/null 'quoted text' 'quoted text' -eu 'quoted text' && 2>/dev/null
+"$@" local "$@" "$@" /usr/bin then "$1" "$@" 'quoted text' done awk test
+local test x=1 "$@" x=1 "$@" ${HOME} 2>/dev/null | x=1
+		test && local && -eu printf /usr/bin | ${HOME} local readonly
+	local done echo --verbose sed --verbose -eu x=1 "$@" 'quoted text'
+		cd readonly | sed 'quoted text' 'quoted text' export /usr/bin $(pwd) "$@" 'quoted text'
+	local x=1 2>/dev/null ${HOME} ${HOME} "$1" test done cd export
+$(pwd) x=1 grep sed sed $(pwd) printf "$1" export sed 'quoted text'
+	-eu 2>/dev/null then grep grep grep x=1 grep 2>/dev/null x=1
+	awk export test $(pwd)
+		x=1 x=1 then printf && 2>/dev/null readonly readonly --verbose echo ${HOME} $(pwd)
+'quoted text' cd printf 2>/dev/null echo 'quoted text' 'quoted text' awk 2>/dev/null
+	/usr/bin printf local /usr/bin "$@" "$1" export -eu printf sed
+	grep "$@" grep then -eu 'quoted text' "$@"
+$(pwd) ${HOME} grep sed grep -eu done -eu 'quoted text'
+		2>/dev/null readonly $(pwd) 2>/dev/null
+		echo x=1 'quoted text' readonly done export
+	awk readonly sed grep test
+		then "$1" done "$1" cd 'quoted text' | x=1 -eu --verbose | ${HOME}
+'quoted text' x=1 local grep echo ${HOME} done x=1 $(pwd)
+		done local x=1 local
+	grep && "$1" sed export 'quoted text' | x=1 --verbose x=1 cd cd
+readonly $(pwd) 2>/dev/null 'quoted text'
+x=1 done "$@" readonly
+	then --verbose sed && done local ${HOME} done $(pwd) printf cd 2>/dev/null "$1"
+&& cd "$1" 'quoted text' | export ${HOME}
+2>/dev/null printf x=1 2>/dev/null awk awk && 2>/dev/null local
+	sed test cd -eu && done printf export test awk "$@" readonly then
+		| | printf x=1 "$1" /usr/bin
+		echo awk printf ${HOME} "$@" awk test -eu $(pwd) 'quoted text' x=1
+		awk test done ${HOME} grep 2>/dev/null echo 'quoted text'
+"$1" done export grep cd "$@"
+test cd printf export && --verbose local
+	2>/dev/null /usr/bin local x=1 export done &&
+${HOME} test x=1 local /usr/bin 'quoted text' 2>/dev/null ${HOME}
+		readonly readonly --verbose export export awk 2>/dev/null
+-eu echo done then test grep 'quoted text' $(pwd) $(pwd) "$1" grep "$@" echo
+	grep test | --verbose --verbose
+	x=1 grep sed -eu x=1 x=1 --verbose && test done x=1
+		cd grep printf readonly $(pwd) -eu echo $(pwd) 'quoted text' sed $(pwd) then printf
+		awk --verbose ${HOME} x=1 | x=1 echo --verbose |
+	grep grep local -eu sed
+		readonly cd /usr/bin readonly printf printf ${HOME} awk
+"$@" grep x=1 $(pwd) $(pwd) local export
+	local ${HOME} cd awk local then export cd x=1 readonly then ${HOME}
+		"$@" && done local && echo cd
+	readonly -eu 'quoted text' -eu readonly local export done x=1
+		grep then printf ${HOME} 'quoted text' grep awk export 2>/dev/null
+	-eu test "$1" local 2>/dev/null printf sed "$@" ${HOME} done test done
+"$@" "$@" -eu x=1 awk local then | cd grep
+	${HOME} readonly x=1 &&
+		"$@" echo grep grep | grep local $(pwd) && readonly
+	${HOME} ${HOME} cd local ${HOME} echo test readonly
+test /usr/bin && 2>/dev/null printf 2>/dev/null readonly
+		x=1 && --verbose grep ${HOME} -eu --verbose | printf export
+	awk --verbose 2>/dev/null sed
+		sed && $(pwd) 2>/dev/null && -eu "$@" && readonly $(pwd) $(pwd) && ${HOME}
+	&& | then awk --verbose sed
+	local && done export readonly 2>/dev/null && 2>/dev/null "$1" sed /usr/bin echo
+		${HOME} && "$1" echo awk grep ${HOME} sed readonly
+		2>/dev/null 'quoted text'
+readonly "$@" /usr/bin awk 2>/dev/null -eu
+done readonly "$1" -eu /usr/bin done
+		x=1 echo "$@" 2>/dev/null awk awk
+test sed $(pwd) ${HOME} then grep $(pwd) x=1 cd x=1 x=1 --verbose
+		cd /usr/bin && | sed --verbose test local && local done
+		"$1" local then printf cd $(pwd) printf echo | --verbose
+	echo "$@" awk "$1" && "$@" grep then | --verbose
+sed export readonly $(pwd) readonly cd then then export --verbose -eu x=1 sed
+&& $(pwd) "$@" export cd export cd then
+		test cd -eu done x=1 printf | printf "$1" grep x=1 awk printf
+		-eu test test 2>/dev/null sed 2>/dev/null export sed local sed cd ${HOME}
+	2>/dev/null then done local awk then then x=1 export 2>/dev/null
+local "$1" "$@" "$1" sed test echo ${HOME} x=1 2>/dev/null then cd done ${HOME}
+	printf echo local ${HOME} local 2>/dev/null done readonly
+readonly then $(pwd) then
+		&& awk "$@" grep | | && x=1 $(pwd) -eu | done done local x=1
+		/usr/bin readonly 2>/dev/null test cd awk echo "$1" $(pwd) --verbose
+		"$1" ${HOME} then $(pwd) sed test 2>/dev/null "$@" 2>/dev/null ${HOME}
+'quoted text' x=1 local "$1" $(pwd) | "$1" printf then ${HOME} | /usr/bin
+grep cd cd 2>/dev/null 'quoted text'
+2>/dev/null "$@" cd printf readonly test && then x=1
+| /usr/bin $(pwd) "$1" done x=1 done 'quoted text' 2>/dev/null printf readonly
+		/usr/bin cd local x=1 2>/dev/null
+	-eu $(pwd) grep /usr/bin sed cd done sed x=1 "$@"
+then && test grep export grep awk local awk x=1 -eu -eu printf then
+&& | cd && 'quoted text' x=1 sed --verbose
+	echo "$@" readonly sed
+		--verbose 'quoted text'
+cd "$@" $(pwd) test -eu awk cd then
+	then "$1" | 'quoted text' awk echo 2>/dev/null sed cd done
+	sed | readonly awk | 'quoted text' printf grep then printf local --verbose
+-eu cd export 2>/dev/null | then "$1" "$@" readonly export echo | $(pwd)
+		awk awk /usr/bin x=1 x=1 sed ${HOME} $(pwd) x=1 --verbose && x=1 $(pwd)
+	echo $(pwd) $(pwd) printf 'quoted text' export printf
+sed -eu | 'quoted text' | export grep local 'quoted text'
+	then -eu sed then export test cd && printf -eu export
+	2>/dev/null cd $(pwd) awk
+		"$@" grep 2>/dev/null grep --verbose /usr/bin 'quoted text'
+local then grep done 'quoted text' "$1"
+--verbose "$@" readonly test 'quoted text' readonly test grep cd test x=1 readonly
+	awk printf local $(pwd) then done
+		"$1" /usr/bin $(pwd) | then grep -eu 'quoted text'
+		grep 2>/dev/null cd echo readonly 'quoted text' export 2>/dev/null "$1" printf awk
+x=1 $(pwd) -eu /usr/bin /usr/bin sed printf export
+	grep | | export sed "$@"
+		x=1 'quoted text' "$@" /usr/bin x=1 then cd 'quoted text' x=1 done 'quoted text'
+		/usr/bin grep test done
+	${HOME} | export 'quoted text' /usr/bin done ${HOME} "$1"
+&& done cd --verbose 'quoted text' 2>/dev/null --verbose
+		printf local export /usr/bin &&
+	"$@" --verbose | echo 2>/dev/null local export --verbose && done x=1
+	${HOME} printf 2>/dev/null ${HOME} printf export done cd -eu awk ${HOME} /usr/bin
+then && local | | && ${HOME} test
+	echo --verbose x=1 test cd "$1" test grep && "$@" printf
+		--verbose "$@" cd printf grep then /usr/bin x=1 /usr/bin readonly
+sed sed sed x=1 && local 'quoted text' grep printf ${HOME}
+	x=1 $(pwd) sed then readonly $(pwd) 'quoted text' local "$1" echo "$1"
+	| 2>/dev/null --verbose --verbose ${HOME} grep | cd readonly test x=1
+'quoted text' x=1 $(pwd) local -eu awk $(pwd) readonly
+test "$1" done local test
+$(pwd) --verbose test then 2>/dev/null done export "$1" then export export
+| echo echo /usr/bin echo echo
+		'quoted text' sed then $(pwd) printf local x=1 grep 2>/dev/null "$@" --verbose
+	printf "$1" "$@" grep local done -eu /usr/bin awk 'quoted text' done test
+	&& x=1 2>/dev/null | "$1" x=1 | cd && | export readonly test
+		echo "$1" "$1" --verbose && -eu x=1 && 2>/dev/null "$1" local
+		x=1 -eu local /usr/bin echo done echo
+		readonly /usr/bin && done done --verbose "$@" sed | then local /usr/bin awk -eu
+	local /usr/bin "$1" 'quoted text'
+		-eu test 2>/dev/null readonly awk $(pwd) --verbose done awk done && /usr/bin
+&& export -eu done 'quoted text' "$1" /usr/bin done
+		then 'quoted text' /usr/bin then /usr/bin 'quoted text' --verbose
+export grep test grep echo then export local
+local $(pwd) /usr/bin readonly done readonly cd 'quoted text' -eu -eu "$1" /usr/bin
+	sed awk "$1" | grep echo grep local test readonly awk export
+-eu $(pwd) && awk echo -eu export grep "$1" | --verbose
+		cd sed 'quoted text' export awk /usr/bin awk $(pwd) | --verbose grep test "$@" grep
+		printf "$@" "$@" printf $(pwd) then /usr/bin
+export done x=1 -eu && echo export && /usr/bin test x=1 grep /usr/bin test readonly
+grep export | -eu "$@" grep ${HOME} /usr/bin cd printf
+		echo x=1 printf local then sed printf echo then x=1 x=1 sed
+		echo export then 'quoted text' readonly
+		printf local test readonly printf cd export ${HOME} awk
+"$@" "$@" ${HOME} -eu --verbose 2>/dev/null
+		2>/dev/null cd done -eu 2>/dev/null test $(pwd) echo "$1" grep grep /usr/bin
+test 'quoted text' /usr/bin &&
+		/usr/bin done done && ${HOME} /usr/bin local && cd printf
+		$(pwd) && "$1" grep then cd | echo readonly 2>/dev/null
+awk ${HOME} --verbose 2>/dev/null
+-eu export | test -eu readonly then 'quoted text' then $(pwd) $(pwd) export
+		"$@" x=1 'quoted text' ${HOME} local x=1 then test "$1" "$1" /usr/bin /usr/bin
+readonly ${HOME} printf && then | | "$@" "$@" ${HOME} x=1 --verbose
+grep readonly awk "$1" test cd test then "$@" ${HOME} printf ${HOME} grep
+	awk awk echo "$@" --verbose done readonly --verbose echo
+	readonly readonly awk test 2>/dev/null -eu
+readonly echo echo | ${HOME}
+		${HOME} sed local echo echo grep grep printf export /usr/bin | then cd
+"$@" then "$1" /usr/bin ${HOME} then --verbose ${HOME} -eu /usr/bin
+		test printf --verbose $(pwd) /usr/bin
+/usr/bin 2>/dev/null readonly
+test then readonly printf local cd && $(pwd) done grep grep --verbose
+	grep sed 2>/dev/null $(pwd) sed $(pwd)
+&& -eu 2>/dev/null local x=1 done test | && "$1" && awk $(pwd)
+	2>/dev/null echo sed /usr/bin awk export then cd | && done awk $(pwd) "$@" 2>/dev/null
+sed --verbose ${HOME} local
+	&& readonly -eu && cd "$1" sed
+2>/dev/null $(pwd) printf local "$@" ${HOME} ${HOME} printf
+${HOME} local -eu 2>/dev/null x=1 /usr/bin
+		$(pwd) test test | echo
+	--verbose 2>/dev/null
+cd "$1" awk --verbose test awk -eu awk x=1 /usr/bin $(pwd) x=1
+	'quoted text' ${HOME} ${HOME}
+		awk echo && grep awk ${HOME}
+		-eu x=1 test cd 2>/dev/null sed | echo "$@" ${HOME}
+$(pwd) local 'quoted text' local && readonly ${HOME} cd sed then
+		$(pwd) test grep x=1 done readonly | $(pwd) | done | readonly
+readonly sed readonly 'quoted text' done | cd "$@" |
+		-eu export ${HOME} 'quoted text'
+"$1" $(pwd) done readonly --verbose sed 'quoted text' test
+		-eu 2>/dev/null readonly export 2>/dev/null "$@" echo -eu 2>/dev/null
+		then awk /usr/bin done 'quoted text' test cd 2>/dev/null 2>/dev/null --verbose export
+"$1" printf test 2>/dev/null echo printf awk
+x=1 ${HOME} 'quoted text' export && sed ${HOME} "$@" 2>/dev/null
+		--verbose test echo echo x=1 ${HOME}
+		export echo done -eu | ${HOME} test 'quoted text' awk "$1" "$1" readonly 'quoted text'
+		$(pwd) sed | "$1" printf x=1 then $(pwd) printf 'quoted text'
+&& sed printf --verbose then ${HOME}
+		readonly /usr/bin "$1" $(pwd)
+		"$@" && grep awk && 'quoted text' then cd awk && "$@"
+		'quoted text' cd done printf && --verbose
+done export printf 2>/dev/null
+local "$1" cd awk --verbose
+	printf "$1" /usr/bin then x=1 echo --verbose 'quoted text' local
+'quoted text' done 2>/dev/null
+x=1 export awk ${HOME} 'quoted text' test /usr/bin
+		awk local cd x=1 | /usr/bin ${HOME} $(pwd)
+	x=1 $(pwd) "$1" test x=1 ${HOME}
+grep x=1 local awk sed printf then | local --verbose export printf 'quoted text'
+		readonly grep printf grep local -eu local "$@" /usr/bin && readonly && /usr/bin
+		local awk | export grep /usr/bin then then x=1 "$@"
+export printf export export sed $(pwd) /usr/bin then done cd /usr/bin
+		x=1 && 2>/dev/null export
+		cd && export && "$@" | export sed -eu echo
+		cd ${HOME} then then local | cd done echo 'quoted text'
+2>/dev/null done --verbose 2>/dev/null readonly
+local 2>/dev/null "$@" printf readonly 'quoted text'
+printf | export done awk
+printf cd "$@" sed x=1 "$1" -eu $(pwd) local 'quoted text'
+printf local ${HOME} cd local && -eu local awk $(pwd)
+&& /usr/bin "$@" local echo printf done
+-eu $(pwd) $(pwd) readonly 2>/dev/null
+	&& /usr/bin --verbose done cd export test 'quoted text' "$1"
+	echo x=1 | ${HOME} && then ${HOME} export readonly awk printf /usr/bin
+-eu printf awk printf ${HOME} && echo awk /usr/bin ${HOME} test readonly
+local cd /usr/bin sed echo awk ${HOME} $(pwd) /usr/bin
+	"$@" local then export -eu cd "$@" 'quoted text' then done cd 2>/dev/null local
+		| "$1" export "$@" x=1 2>/dev/null done && "$1" readonly
+${HOME} /usr/bin "$1" ${HOME} echo | | "$@" $(pwd) printf then "$1"
+2>/dev/null 'quoted text' "$1"
+	"$@" "$@" readonly cd && readonly export done then ${HOME}
+/usr/bin test local readonly "$1" "$@" then "$1" readonly 2>/dev/null | awk
+	sed sed sed /usr/bin awk sed local $(pwd) local ${HOME} /usr/bin readonly
+test 2>/dev/null local done 2>/dev/null echo
+--verbose /usr/bin export
+	then --verbose "$@" 2>/dev/null done test sed "$@" --verbose 2>/dev/null
+echo | done 'quoted text' sed --verbose /usr/bin "$@" echo export
+&& done echo done $(pwd) "$@" echo sed
+		-eu done grep export ${HOME} awk printf /usr/bin
+printf "$1" $(pwd) done
+echo echo echo 2>/dev/null test -eu x=1 export
+	test then sed export | --verbose then done
+	"$1" && ${HOME} grep -eu export --verbose readonly grep
+cd test | printf readonly 2>/dev/null then done printf cd ${HOME}
+		sed sed done sed | x=1 2>/dev/null "$@" cd &&
+	"$@" /usr/bin | ${HOME} 2>/dev/null printf readonly local x=1 then x=1 /usr/bin
+	cd $(pwd) -eu sed --verbose
+		'quoted text' -eu local /usr/bin --verbose 'quoted text'
+'quoted text' && readonly 2>/dev/null 2>/dev/null x=1 "$1" grep
+awk -eu 2>/dev/null x=1 then x=1 2>/dev/null echo echo && then -eu ${HOME} local
+	"$@" | -eu then -eu sed /usr/bin readonly -eu && awk done | $(pwd) x=1 printf
+	'quoted text' printf done then echo /usr/bin export
+	-eu grep done awk awk /usr/bin /usr/bin
+echo cd then done --verbose export then local awk $(pwd) ${HOME} "$1" -eu
+		${HOME} readonly 'quoted text' /usr/bin done printf -eu 2>/dev/null test
+"$@" awk export cd x=1
+	printf "$@" ${HOME} test | "$1" grep "$1" && /usr/bin && local done && cd 'quoted text'
+/usr/bin -eu readonly grep done
+	printf grep sed $(pwd) && awk $(pwd)
+${HOME} x=1 $(pwd) export
+		readonly sed | local awk awk sed readonly cd grep /usr/bin
+		echo export | "$@" "$1" awk local grep done export
+	test 2>/dev/null readonly export $(pwd) then -eu 2>/dev/null then ${HOME}
+	| readonly local "$1" $(pwd) grep grep then | printf
+	grep done done done export | cd "$@" x=1 --verbose echo
+then 'quoted text' && | 'quoted text' -eu local sed
+	cd printf && export then ${HOME} printf | --verbose test x=1 x=1 cd /usr/bin
+		--verbose local 'quoted text' sed done echo cd done 2>/dev/null
+		2>/dev/null export ${HOME} grep ${HOME}
+	--verbose test "$@" then ${HOME} readonly then test -eu test
+$(pwd) grep ${HOME} --verbose
+	2>/dev/null 2>/dev/null printf
+	$(pwd) echo then local $(pwd) export
+		readonly 2>/dev/null "$@" /usr/bin sed echo export
+	--verbose readonly x=1 'quoted text' grep export $(pwd) && | -eu done --verbose
+	export cd sed && awk x=1 --verbose
+		-eu && test awk local local
+	then awk readonly sed cd
+-eu awk local -eu --verbose
+$(pwd) test then "$@" local /usr/bin sed && cd -eu ${HOME} -eu export
+printf && then printf cd
+readonly printf 'quoted text' -eu 2>/dev/null -eu --verbose
+	/usr/bin $(pwd) $(pwd) && then --verbose
+	$(pwd) 2>/dev/null "$@" && 2>/dev/null
+		"$1" x=1 | /usr/bin cd -eu done 2>/dev/null awk | -eu 2>/dev/null grep 2>/dev/null
+echo 'quoted text' done | export "$1"
+	grep then ${HOME} /usr/bin "$1" "$@" -eu done local printf echo "$@"
+	export ${HOME} cd && /usr/bin local | /usr/bin "$1" printf "$@" -eu && test
+	local local -eu awk echo x=1 'quoted text' echo readonly then | grep "$@"
+		sed "$1" $(pwd) echo "$1" local
+${HOME} --verbose echo && 'quoted text' "$@" "$1" -eu "$1" cd 2>/dev/null $(pwd)
+	local printf | | --verbose 2>/dev/null
+		"$1" ${HOME} test 2>/dev/null 2>/dev/null grep -eu -eu
+	&& $(pwd) test ${HOME} local echo test echo $(pwd) cd grep readonly
+		x=1 test echo cd readonly | 'quoted text' cd cd
+	then ${HOME} x=1 then test "$1" "$@" then test then grep awk sed 2>/dev/null
+		readonly /usr/bin /usr/bin test "$1" cd "$@" done 2>/dev/null sed
+	awk && $(pwd) test grep 'quoted text' printf -eu test readonly "$@" "$1" "$1" /usr/bin
+		$(pwd) 2>/dev/null 'quoted text' readonly "$1" "$1" then
+		export printf -eu sed 2>/dev/null readonly awk | | done cd $(pwd) readonly
+export | readonly awk done export
+		--verbose /usr/bin readonly
+	awk -eu 'quoted text' test "$@" readonly --verbose 2>/dev/null 2>/dev/null
+awk "$1" "$1" --verbose 2>/dev/null
+printf --verbose then && |
+	--verbose --verbose then --verbose x=1 -eu readonly cd ${HOME}
+		sed 2>/dev/null && sed /usr/bin echo export grep | then
+		grep --verbose x=1 local
+$(pwd) "$@" then test printf && 2>/dev/null
+		$(pwd) --verbose -eu x=1 x=1 ${HOME} echo local | printf
+	done x=1 then $(pwd) /usr/bin
+		export -eu grep test 'quoted text'
+&& -eu printf then echo readonly echo
+readonly printf sed export
+cd sed cd --verbose --verbose echo 2>/dev/null /usr/bin
+		then sed | export test /usr/bin readonly
+	then 2>/dev/null awk done readonly 2>/dev/null printf then $(pwd)
+printf grep local | cd /usr/bin sed && "$1" cd test
+		$(pwd) 2>/dev/null ${HOME} "$@" 2>/dev/null printf
+"$@" 2>/dev/null sed echo then
+		local export then x=1 local "$@" 2>/dev/null export
+	grep test export | x=1 "$1" cd 2>/dev/null
+then done && test 'quoted text' echo sed awk awk echo local 2>/dev/null
+		${HOME} printf ${HOME} ${HOME}
+	'quoted text' readonly &&
+	"$1" done -eu "$1" grep "$@" "$1" /usr/bin 2>/dev/null
+	-eu && $(pwd) && then -eu 'quoted text'
+	$(pwd) x=1 'quoted text' cd then 2>/dev/null 'quoted text' printf
+echo cd printf awk | -eu 'quoted text' grep /usr/bin
+		"$1" then /usr/bin done grep "$1" ${HOME}
+		awk "$@" | | && "$1" local
+"$1" printf -eu $(pwd) | 2>/dev/null grep
+		"$@" export readonly printf grep test 2>/dev/null --verbose readonly sed grep
+		export export sed sed $(pwd) | $(pwd) x=1 export
+		cd "$@" readonly local /usr/bin | done printf export
+	done printf /usr/bin /usr/bin local local "$1" then | echo readonly
+		awk $(pwd) sed cd echo test | cd sed "$1" /usr/bin cd --verbose 2>/dev/null
+		2>/dev/null test awk readonly --verbose done printf "$1" &&
+		'quoted text' cd test done then 2>/dev/null | done
+--verbose $(pwd) 2>/dev/null $(pwd) echo 'quoted text' -eu && echo && readonly
+		echo local && -eu 'quoted text' x=1
+		2>/dev/null export x=1 grep echo --verbose printf readonly | export printf
+local x=1 readonly test cd 2>/dev/null "$1" sed printf cd sed done grep done awk
+printf cd printf --verbose -eu ${HOME} then readonly && readonly |
+		--verbose -eu "$@" grep /usr/bin "$1" && "$@" "$1" -eu cd sed -eu printf
+cd grep $(pwd) "$1" 2>/dev/null
+		'quoted text' printf echo x=1 readonly readonly cd
+	2>/dev/null grep && readonly 2>/dev/null $(pwd) && "$@" && 'quoted text'
+	"$@" export /usr/bin echo echo readonly
+	${HOME} --verbose readonly "$1" done $(pwd) test test
+	awk echo x=1 -eu local
+	"$@" export readonly done | then sed
+	-eu local done grep printf done -eu ${HOME} | printf ${HOME} readonly && local
+		local awk grep 2>/dev/null export echo
+"$1" sed --verbose | cd echo then awk cd /usr/bin x=1 grep
+		| awk printf then done grep --verbose -eu --verbose && cd --verbose sed awk
+		done export local ${HOME} awk
+readonly /usr/bin | then -eu && ${HOME}
+	"$@" /usr/bin cd printf cd && "$1" readonly test cd readonly "$1"
+| --verbose awk export 'quoted text' | done grep echo 2>/dev/null
+		-eu echo local 'quoted text' printf test "$1" done
+	echo export done "$1" 2>/dev/null && /usr/bin
+	2>/dev/null cd test "$1"
+| grep $(pwd) --verbose | then 'quoted text' grep readonly
+		--verbose sed && sed printf readonly 2>/dev/null awk local export printf
+	x=1 awk 'quoted text' "$@" printf
+	/usr/bin 2>/dev/null /usr/bin ${HOME} "$@" grep export $(pwd) 'quoted text'
+		2>/dev/null grep echo x=1 printf
+--verbose readonly printf cd -eu /usr/bin awk grep "$1" echo -eu echo
+		sed export sed export /usr/bin "$1" echo | | && /usr/bin && readonly
+	2>/dev/null awk --verbose readonly -eu readonly
+		export && | "$@" -eu awk echo grep 2>/dev/null --verbose
+		readonly ${HOME} "$@" local done done printf
+		grep x=1 "$1" grep -eu cd
+	grep "$@" "$1" printf x=1 /usr/bin readonly ${HOME}
+export export grep ${HOME} grep test awk export $(pwd) export
+	-eu --verbose printf -eu "$@"
+		2>/dev/null && 'quoted text' cd printf local | readonly
+export readonly then | | awk /usr/bin && "$1" awk && "$1"
+	awk | x=1 && ${HOME} readonly
+"$1" done cd 2>/dev/null
+		"$1" 'quoted text' readonly $(pwd) "$1" 2>/dev/null $(pwd) "$@" printf test
+sed local --verbose /usr/bin $(pwd) echo -eu then printf x=1 "$1" sed sed x=1
+	x=1 cd 'quoted text' readonly "$1" export then sed awk then export
+	-eu | then awk cd cd done /usr/bin
+		test done "$1" test local x=1 x=1 "$@"
+x=1 $(pwd) export ${HOME}
+	echo $(pwd) grep test test x=1 --verbose /usr/bin local awk
+	echo x=1 grep local x=1 sed export --verbose
+export 2>/dev/null grep grep "$@" 'quoted text' &&
+&& 'quoted text' --verbose /usr/bin sed local local sed
+		grep && printf sed x=1 "$@" readonly -eu
+		done local $(pwd) | /usr/bin -eu 2>/dev/null
+	${HOME} && ${HOME} && local
+-eu grep | then then done && && x=1 --verbose "$1" readonly printf
+	printf $(pwd) "$@" 2>/dev/null ${HOME} ${HOME} printf cd then
+	printf export echo x=1 --verbose local --verbose grep 'quoted text' local
+local printf /usr/bin /usr/bin -eu then local 2>/dev/null $(pwd)
+&& -eu "$@" -eu export export
+local /usr/bin && ${HOME} /usr/bin done
+		${HOME} x=1 -eu cd then ${HOME} && | awk grep ${HOME} readonly
+test 2>/dev/null readonly
+		sed awk done test --verbose echo test "$1" "$1" /usr/bin
+	/usr/bin awk && then printf echo cd 2>/dev/null
+done | local "$1" ${HOME}
+	2>/dev/null 'quoted text' x=1 2>/dev/null
+test export --verbose printf /usr/bin echo readonly awk test ${HOME} printf
+	$(pwd) printf export then | -eu x=1 2>/dev/null awk then /usr/bin &&
+| $(pwd) ${HOME} 2>/dev/null sed local
+		readonly then readonly echo 2>/dev/null
+	sed echo 2>/dev/null /usr/bin local "$1"
+	then test "$@" then 2>/dev/null readonly | ${HOME} --verbose | export
+	"$1" ${HOME} x=1 "$1" awk printf done
+test | local $(pwd) x=1 done $(pwd) --verbose x=1 ${HOME}
+	then && local -eu grep "$1" 'quoted text' $(pwd) && grep grep
+		export printf then grep
+	| cd printf then awk 2>/dev/null /usr/bin local | test done sed ${HOME}
+		${HOME} "$@" grep printf cd awk ${HOME} 'quoted text' export
+		-eu -eu echo echo -eu /usr/bin 'quoted text' awk ${HOME} ${HOME} then cd test
+	echo "$@" export --verbose "$1" $(pwd) echo sed test | --verbose
+	cd then cd $(pwd) $(pwd) grep 2>/dev/null "$@" printf printf /usr/bin done
+$(pwd) readonly "$1" /usr/bin
+	x=1 /usr/bin echo echo
+	'quoted text' then && $(pwd) /usr/bin echo
+	"$@" && /usr/bin awk 2>/dev/null
+		awk x=1 sed "$@" done --verbose grep
+		sed echo "$@" 'quoted text' sed done export 'quoted text'
+cd && awk export x=1 $(pwd) printf echo /usr/bin
+		echo local export readonly $(pwd) printf
+	grep sed --verbose 'quoted text' then --verbose && -eu --verbose && /usr/bin export
+"$1" grep 'quoted text' local -eu sed test sed $(pwd)
+		/usr/bin awk sed -eu awk "$@" done sed sed --verbose then -eu then -eu --verbose
+		x=1 test 'quoted text' done 2>/dev/null then 2>/dev/null printf
+	"$@" printf sed "$1" then test 2>/dev/null cd "$1" -eu --verbose printf
+cd done x=1 echo then 2>/dev/null then awk sed 'quoted text'
+-eu --verbose 2>/dev/null /usr/bin
+	"$1" | $(pwd) && done ${HOME} grep test local -eu --verbose
+--verbose local /usr/bin printf -eu
+-eu --verbose export 2>/dev/null
+		${HOME} "$@" echo --verbose printf sed grep local grep x=1 --verbose done -eu /usr/bin
+'quoted text' | then x=1
+	'quoted text' x=1 export 2>/dev/null readonly -eu x=1 then readonly
+		sed readonly "$@" cd echo printf --verbose awk export
+done then "$1" /usr/bin $(pwd)
+	then "$@" export ${HOME} done ${HOME}
+	2>/dev/null ${HOME} "$@" "$@" | then 2>/dev/null test $(pwd) x=1
+		x=1 sed ${HOME} "$1" sed "$@" readonly echo
+cd cd "$1" -eu "$@" grep --verbose
+	readonly readonly x=1 -eu -eu then ${HOME} x=1 local local
+${HOME} 'quoted text' export -eu | ${HOME} echo ${HOME} ${HOME} x=1 echo
+x=1 --verbose grep --verbose
+		"$@" sed echo readonly ${HOME} awk 'quoted text' /usr/bin
+		done x=1 'quoted text' awk awk test && cd echo && ${HOME} 2>/dev/null
+	-eu local --verbose done -eu echo -eu
+	"$1" export done test readonly
+		local echo cd done grep x=1 $(pwd) "$1" "$1" local awk -eu
+		"$1" ${HOME} then test | | "$1" /usr/bin export test ${HOME} done local
+		--verbose 2>/dev/null sed awk printf "$1" echo echo
+	x=1 ${HOME} "$1" "$@" sed test x=1 printf 2>/dev/null
+		2>/dev/null echo 'quoted text' printf 2>/dev/null done | printf local --verbose
+		sed | local --verbose -eu x=1 done echo x=1
+	| local then sed /usr/bin "$@" x=1 -eu 'quoted text'
+		printf sed sed then done --verbose sed echo
+		/usr/bin -eu --verbose && readonly awk printf | export
+		test test ${HOME} x=1
+	echo grep 2>/dev/null printf -eu | 2>/dev/null -eu 2>/dev/null printf -eu && 'quoted text'
+		&& 2>/dev/null printf awk sed
+x=1 2>/dev/null test && &&
+--verbose x=1 cd | awk local echo
+	'quoted text' && 'quoted text' readonly | x=1 then "$@" export
+		printf /usr/bin printf grep 2>/dev/null "$1" test export $(pwd) grep
+	&& printf then grep 2>/dev/null printf
+	test $(pwd) && 2>/dev/null then | printf
+cd && | "$@" "$@" printf then "$1" ${HOME} x=1 awk $(pwd) readonly
+		--verbose "$1" echo sed awk
+	done then cd awk export readonly "$1" 2>/dev/null "$1" readonly
+	then "$1" $(pwd) grep sed readonly
+| sed printf 2>/dev/null readonly
+readonly done && "$1" grep test export | && -eu grep local then
+done -eu export 2>/dev/null
+		awk "$@" echo sed export --verbose $(pwd) "$1"
+		export echo test local printf awk | /usr/bin test | 2>/dev/null
+		/usr/bin x=1 -eu "$@" | awk sed --verbose cd
+	"$1" test export printf --verbose
+grep grep readonly $(pwd) /usr/bin then x=1 x=1 2>/dev/null --verbose
+	${HOME} 2>/dev/null "$1" && /usr/bin awk 2>/dev/null --verbose test ${HOME}
+	--verbose 'quoted text' echo
+&& done "$@" && cd --verbose ${HOME}
+	done "$1" done /usr/bin $(pwd) "$1" sed awk x=1 x=1
+		printf -eu then then sed --verbose
+	readonly && export grep done cd 'quoted text' local /usr/bin "$1"
+	x=1 'quoted text' 'quoted text' cd printf echo
+		local printf readonly
+		export "$@" test $(pwd) printf | | | /usr/bin "$@" ${HOME} grep /usr/bin
+printf && export done then x=1 grep x=1 then awk done export --verbose echo
+	'quoted text' cd done && -eu local local /usr/bin cd awk
+		local | printf sed | test | /usr/bin local "$1" -eu export
+		"$@" "$@" 'quoted text' --verbose | 'quoted text' sed $(pwd) "$1" && 2>/dev/null
+x=1 'quoted text' grep "$1" local awk --verbose
+	--verbose "$1" export -eu
+	/usr/bin awk && && && sed 2>/dev/null done cd && awk $(pwd)
+&& "$1" test -eu 'quoted text' ${HOME} $(pwd) grep echo done /usr/bin
+	sed x=1 x=1 readonly ${HOME} 'quoted text' $(pwd) x=1 sed test cd | $(pwd) then
+then /usr/bin 'quoted text' x=1 "$1" echo
+'quoted text' grep /usr/bin test test cd /usr/bin $(pwd) awk ${HOME} test cd awk
+		printf done echo 'quoted text' 2>/dev/null
+		cd 'quoted text' --verbose
+then "$@" | "$@" --verbose
+	grep "$@" readonly -eu --verbose awk local local ${HOME}
+printf -eu 2>/dev/null test $(pwd) "$1" ${HOME} echo grep echo then readonly
+		$(pwd) then && ${HOME} ${HOME} | done readonly 'quoted text'
+awk then "$1" local done $(pwd) &&
+		2>/dev/null "$@" then sed readonly echo -eu 2>/dev/null
+	--verbose x=1 awk awk "$1" x=1 awk printf export | x=1 test "$1" --verbose
+		cd $(pwd) | test ${HOME} | 2>/dev/null
+	test | cd "$1" printf ${HOME} --verbose | sed
+'quoted text' grep /usr/bin
+	${HOME} x=1 local export echo "$1" $(pwd)
+		${HOME} awk local readonly 'quoted text' echo
+	test -eu done export test then printf 2>/dev/null done done cd | echo
+		printf sed grep x=1 echo /usr/bin
+		done && grep ${HOME} sed -eu && && 2>/dev/null
+	test ${HOME} grep awk echo ${HOME} | then | cd readonly cd local --verbose
+done 2>/dev/null test x=1 sed x=1 export done printf awk "$1" -eu
+		'quoted text' /usr/bin grep readonly && readonly echo "$1"
+"$1" --verbose readonly 2>/dev/null sed -eu readonly
+		${HOME} 2>/dev/null "$1" -eu x=1 && x=1 $(pwd) "$1" export && sed awk
+	test ${HOME} /usr/bin 'quoted text' && --verbose 2>/dev/null export 2>/dev/null
+readonly sed done readonly export test ${HOME} 'quoted text'
+	echo x=1 grep test -eu -eu cd awk
+echo "$1" local $(pwd) then awk then printf awk awk export echo done awk -eu
+	grep printf "$1" --verbose | "$1"
+$(pwd) --verbose -eu && awk grep x=1 | "$1"
+		test 2>/dev/null awk 'quoted text' "$1" --verbose 'quoted text' --verbose done
+	--verbose awk sed | grep export cd printf readonly done readonly awk
+		x=1 test then awk $(pwd) "$@" 2>/dev/null grep "$1" awk
+| x=1 done | "$@" echo
+x=1 done --verbose --verbose printf grep $(pwd)
+	cd test awk ${HOME} "$@" printf 2>/dev/null sed x=1 "$@" -eu && $(pwd) grep --verbose
+		"$1" && 2>/dev/null local "$@" 2>/dev/null readonly "$1"
+		grep && | local -eu -eu printf --verbose test sed $(pwd) --verbose
+	echo printf 2>/dev/null | grep awk && readonly ${HOME} readonly 'quoted text'
+"$@" awk grep sed test
+	x=1 'quoted text' "$1" --verbose test --verbose sed -eu awk export test then then
+	&& --verbose | $(pwd) "$@"
+		${HOME} x=1 --verbose 2>/dev/null export | "$1"
+		--verbose export -eu && ${HOME} /usr/bin done test printf "$1" ${HOME}
+"$@" export then x=1 printf grep && cd 'quoted text'
+2>/dev/null cd done "$@" /usr/bin export -eu sed ${HOME} --verbose
+		cd /usr/bin local printf "$@" 2>/dev/null
+test awk grep echo then $(pwd) echo | test $(pwd) local awk
+--verbose $(pwd) local cd grep done echo x=1 'quoted text' 'quoted text' sed
+echo cd test done local 'quoted text' /usr/bin export
+	-eu local 'quoted text'
+	"$1" done then $(pwd) x=1 "$1" sed done 2>/dev/null
+		"$1" ${HOME} grep 'quoted text' echo -eu --verbose
+	grep | readonly 2>/dev/null 2>/dev/null ${HOME} --verbose 'quoted text'
+	sed local then local | then "$@" | done
+	export $(pwd) cd local cd x=1 awk 'quoted text' export 2>/dev/null done
+"$1" echo export -eu "$@" grep
+done | --verbose $(pwd) cd readonly sed $(pwd)
+$(pwd) /usr/bin x=1 $(pwd) local "$1" ${HOME} local "$1" readonly
+/usr/bin 'quoted text' x=1 -eu "$1"
+	x=1 | ${HOME} --verbose && awk 'quoted text' "$1" --verbose $(pwd)
+	local "$@" grep test
+	then cd $(pwd) readonly awk awk --verbose "$1" --verbose cd
+awk local "$@" echo sed | --verbose echo grep cd --verbose
+		sed cd "$@" awk --verbose | echo /usr/bin
+		| | | cd && readonly readonly echo |
+	"$1" 'quoted text' cd $(pwd) test cd then
+	local readonly test grep echo done done done printf
+		export printf | done && local then ${HOME} "$1" x=1 local
+awk 'quoted text' test | 'quoted text' 2>/dev/null ${HOME} "$1"
+	x=1 printf ${HOME} 2>/dev/null
+		awk cd 'quoted text' grep grep export $(pwd)
+cd sed "$1" done --verbose 'quoted text' /usr/bin printf test printf done
+		$(pwd) && printf local "$1" then readonly /usr/bin local "$1" done /usr/bin $(pwd)
+		| sed grep /usr/bin readonly 'quoted text'
+	test awk sed cd x=1 then export "$1" export 'quoted text'
+		cd sed 2>/dev/null local then | test x=1 grep cd sed export
+		'quoted text' x=1 | 2>/dev/null
+	x=1 test "$1" local ${HOME} -eu ${HOME} /usr/bin export cd $(pwd) awk
+		done cd local cd && && then --verbose 'quoted text'
+printf 'quoted text' $(pwd) done -eu && awk echo 2>/dev/null "$1"
+awk ${HOME} | "$1" echo echo sed test local x=1
+$(pwd) test -eu cd awk "$1" x=1
+	echo printf test "$@" test grep awk
+	'quoted text' $(pwd) readonly cd done "$@" $(pwd)
+		grep 2>/dev/null done "$@" | sed 'quoted text' awk 'quoted text' --verbose
+${HOME} /usr/bin cd "$1" | grep readonly echo local x=1
+	echo then cd 'quoted text' /usr/bin local printf awk /usr/bin
+	grep printf $(pwd) export 'quoted text' --verbose 2>/dev/null
+		then "$1" -eu x=1 readonly awk grep "$1" -eu printf test
+grep cd test test echo --verbose sed local
+	| readonly x=1 then /usr/bin "$1" grep $(pwd) sed awk $(pwd) printf
+done printf "$@" -eu $(pwd) awk x=1 "$1" awk echo 2>/dev/null /usr/bin
+	then --verbose | done "$1" cd sed done
+	sed "$@" /usr/bin ${HOME} /usr/bin done cd $(pwd) done printf &&
+&& then sed printf $(pwd) echo
+		&& grep then 2>/dev/null grep 2>/dev/null grep test && grep echo
+done && echo printf 2>/dev/null awk ${HOME} 2>/dev/null
+		cd test && local "$@" awk sed then then 2>/dev/null sed echo
+	printf done "$@" x=1 printf -eu /usr/bin --verbose grep ${HOME} "$1" test
+	-eu sed readonly done grep echo x=1 test export awk && x=1 done sed readonly
+	&& /usr/bin cd cd export awk cd test printf | readonly grep 2>/dev/null
+		export then ${HOME} /usr/bin awk
+		awk -eu --verbose ${HOME} readonly
+	readonly local "$@" then readonly test then "$1" sed -eu then sed
+	sed ${HOME} test local -eu /usr/bin x=1 --verbose local /usr/bin
+	awk && 'quoted text' done 'quoted text' test cd x=1 export
+		${HOME} grep done 2>/dev/null echo $(pwd) "$@"
+		then awk "$1" awk local printf
+"$1" local $(pwd) $(pwd)
+	test done sed x=1 && 2>/dev/null | --verbose export export && readonly
+		then export $(pwd) echo awk &&
+		export then --verbose then cd && /usr/bin export export
+		x=1 echo awk -eu echo readonly test "$@" awk grep
+/usr/bin printf echo | --verbose $(pwd) cd cd $(pwd) test cd ${HOME} "$1" test ${HOME}
+		| echo printf x=1 "$1" 2>/dev/null "$@" 'quoted text' | echo awk awk -eu cd
+then ${HOME} done test 'quoted text' | then cd $(pwd) echo "$1" sed $(pwd) export
+	done then "$1" local 2>/dev/null grep local local test | && ${HOME} then done
+		grep ${HOME} printf /usr/bin readonly done grep local export "$@" awk
+local grep "$@" 2>/dev/null export
+	2>/dev/null awk awk | local readonly
+		sed $(pwd) printf "$1" 2>/dev/null
+		'quoted text' done export | $(pwd)
+		readonly local test --verbose grep
+	export grep readonly then x=1 readonly ${HOME} -eu 2>/dev/null
+printf "$@" "$1" 'quoted text'
+	| ${HOME} readonly then export
+	'quoted text' cd -eu local
+		&& --verbose grep export | /usr/bin
+"$1" awk --verbose /usr/bin "$1" test grep echo cd printf
+		$(pwd) | sed done --verbose local readonly 2>/dev/null
+export readonly sed printf readonly echo grep | ${HOME} local sed local ${HOME}
+	"$1" local printf $(pwd) local /usr/bin
+		--verbose /usr/bin && /usr/bin ${HOME} /usr/bin ${HOME} awk sed
+/usr/bin awk 2>/dev/null cd /usr/bin /usr/bin cd readonly cd readonly local
+"$1" ${HOME} ${HOME} | grep echo
+	export test readonly cd grep "$1"
+sed echo sed | 'quoted text' echo && sed 2>/dev/null local sed /usr/bin
+		--verbose test $(pwd) "$1" export
+		"$@" | done readonly | done ${HOME} -eu /usr/bin local sed cd ${HOME}
+		test cd readonly local done && | export 2>/dev/null then
+		/usr/bin "$@" $(pwd) grep | export then 'quoted text'
+	done sed printf local done
+--verbose grep test | done $(pwd) done awk && |
+		local "$@" readonly --verbose ${HOME} test
+export echo "$1" ${HOME}
+		"$@" $(pwd) printf | --verbose awk then echo
+	$(pwd) ${HOME} "$@" --verbose
+		${HOME} awk done local 2>/dev/null awk
+	/usr/bin sed -eu cd "$1"
+		sed -eu done 2>/dev/null "$1" "$1" -eu echo printf export 'quoted text'
+export sed --verbose "$@" test -eu then $(pwd)
+test then export echo grep readonly local $(pwd) grep /usr/bin -eu grep readonly
+--verbose x=1 'quoted text' x=1 "$1" readonly $(pwd) test done
+	-eu then cd 'quoted text' 2>/dev/null "$@" x=1 "$1" then
+local local grep 'quoted text'
+		local then && done done printf | --verbose | | 'quoted text' | -eu
+local ${HOME} grep "$@" echo $(pwd) awk ${HOME} local
+grep "$@" then 'quoted text' done test && local x=1 2>/dev/null test ${HOME}
+		export "$@" x=1 2>/dev/null x=1 $(pwd)
+		export --verbose ${HOME} x=1 2>/dev/null -eu 2>/dev/null then local $(pwd)
+		2>/dev/null grep "$1" readonly local $(pwd)
+		&& 2>/dev/null x=1 awk 'quoted text' "$@" test /usr/bin "$@" ${HOME} "$@" "$@"
+	"$1" echo 2>/dev/null "$@" readonly x=1 x=1 2>/dev/null
+local cd grep test "$@" grep
+		done "$1" export 2>/dev/null printf grep 'quoted text' "$1" 2>/dev/null
+	export | printf ${HOME} 'quoted text'
+export grep | "$@" && test done --verbose export then /usr/bin 'quoted text'
+	$(pwd) --verbose printf "$@" && /usr/bin
+/usr/bin echo ${HOME} && 2>/dev/null --verbose then awk readonly
+		cd 'quoted text' --verbose cd "$1"
+	then cd readonly local "$1" | local test then cd
+grep --verbose echo cd "$@" echo
+awk grep sed test "$@" cd local readonly
+		export echo "$1" x=1 done cd $(pwd) echo cd "$1" "$1"
+	then | 'quoted text' | echo test ${HOME} export echo && echo awk test
+	x=1 readonly 2>/dev/null local "$@" && printf cd && local test awk grep then
+"$1" "$1" sed ${HOME} echo grep && && -eu echo "$1" export echo
+&& echo ${HOME} "$@" done
+$(pwd) "$1" x=1 'quoted text' test sed ${HOME} grep
+		done test $(pwd) local "$1"
+| x=1 cd ${HOME} done 'quoted text' export export export /usr/bin
+| echo -eu && -eu 2>/dev/null grep sed readonly 'quoted text'
+	printf $(pwd) 2>/dev/null "$@" 2>/dev/null done awk && /usr/bin
+		--verbose x=1 then x=1 local printf $(pwd)
+| readonly export test printf
+	done test printf sed readonly "$1" awk $(pwd)
+	/usr/bin -eu printf -eu && local local
+/usr/bin printf echo printf -eu 2>/dev/null export "$@" done
+"$@" local 2>/dev/null 'quoted text' sed grep grep test echo "$@" local
+		grep printf /usr/bin sed 'quoted text' -eu -eu sed awk 2>/dev/null 'quoted text'
+"$@" "$@" /usr/bin "$@" then cd -eu export done 2>/dev/null
+		readonly && awk test $(pwd) "$@"
+local ${HOME} awk readonly 2>/dev/null "$1" x=1 ${HOME} then cd /usr/bin $(pwd)
+		grep ${HOME} done 2>/dev/null /usr/bin
+		sed echo grep done printf /usr/bin x=1 --verbose local done export
+	test readonly done done export cd cd cd $(pwd) test
+	'quoted text' x=1 x=1 'quoted text' test 'quoted text' echo sed cd 2>/dev/null
+	${HOME} local then ${HOME}
+	then awk echo local ${HOME} printf then 'quoted text' ${HOME} -eu && echo done
+		${HOME} x=1 /usr/bin --verbose --verbose
+	'quoted text' done printf readonly sed sed -eu
+		printf | "$1" | echo x=1 $(pwd) 2>/dev/null then
+	| && then printf "$1" /usr/bin grep -eu grep echo --verbose -eu --verbose
+	cd | test --verbose grep local /usr/bin export "$1" test
+${HOME} local awk sed export export
+		sed sed then export local $(pwd) $(pwd) "$@" cd /usr/bin
+		"$@" ${HOME} grep "$@" x=1 done /usr/bin -eu --verbose /usr/bin
+		| sed $(pwd) -eu "$1" printf ${HOME} ${HOME} --verbose
+2>/dev/null -eu | $(pwd)
+	echo $(pwd) x=1 -eu 2>/dev/null | done
+		then x=1 printf cd printf
+		x=1 /usr/bin awk then readonly | done
+	done echo export awk ${HOME} awk x=1 2>/dev/null then x=1 test printf
+echo awk export --verbose
+	--verbose x=1 local /usr/bin cd $(pwd)
+		"$@" printf && "$1" awk
+	-eu local 2>/dev/null $(pwd) "$1" "$@"
+		-eu 'quoted text' readonly then $(pwd) $(pwd) "$1" done
+		export readonly "$1" local x=1 -eu export && | test
+		${HOME} local 'quoted text' && "$1" 'quoted text'
+		| done awk $(pwd) && then 2>/dev/null done test done sed awk awk /usr/bin
+	printf && $(pwd) then 'quoted text'
+export sed export 2>/dev/null && cd readonly
+		local export 'quoted text' "$1" "$@" /usr/bin
+		| done "$1" 'quoted text' then
+	grep "$1" "$1" printf cd local /usr/bin ${HOME} then
+x=1 printf grep && | printf then echo "$1" 'quoted text'
+		| ${HOME} && cd --verbose $(pwd) "$@" && ${HOME}
+		"$@" "$1" export ${HOME} then then readonly local then
+	2>/dev/null test x=1 printf && -eu cd local export grep printf then awk && then
+cd done test done ${HOME} x=1 2>/dev/null 'quoted text' test && printf
+$(pwd) echo -eu export 'quoted text' x=1 sed
+$(pwd) ${HOME} test awk sed
+2>/dev/null "$1" cd cd done awk -eu
+cd --verbose | echo "$@" x=1 x=1 done $(pwd) "$1" 'quoted text' | ${HOME} "$1" test
+readonly 'quoted text' && --verbose printf 'quoted text' export export export readonly
+		x=1 test test printf echo "$1" sed 'quoted text' /usr/bin
+| echo && ${HOME} local "$1" "$@" 'quoted text' done
+-eu ${HOME} && 2>/dev/null 2>/dev/null &&
+"$@" "$@" 'quoted text' && cd $(pwd) && then done
+	"$@" 2>/dev/null 2>/dev/null --verbose --verbose --verbose
+x=1 awk test cd 2>/dev/null --verbose ${HOME} ${HOME}
+'quoted text' awk readonly x=1 -eu 2>/dev/null
+		&& --verbose "$@" && test then test 'quoted text'
+	export export awk export "$1" printf awk echo echo awk test
+2>/dev/null -eu | /usr/bin /usr/bin -eu 'quoted text' "$1"
+printf then then x=1 && awk x=1 cd export 2>/dev/null
+"$@" x=1 echo done test 'quoted text' then grep "$@"
+		-eu 'quoted text' $(pwd) --verbose cd grep ${HOME} sed
+readonly "$1" then x=1 /usr/bin &&
+		readonly && cd -eu sed grep | sed sed test export | "$@"
+readonly /usr/bin && "$@" | then $(pwd)
+echo x=1 "$1" --verbose
+	x=1 | ${HOME} printf 'quoted text' grep | x=1 cd grep then && | -eu
+		then "$@" -eu done grep ${HOME} --verbose --verbose && $(pwd) test
+	'quoted text' sed --verbose $(pwd) 'quoted text' /usr/bin test ${HOME}
+	&& ${HOME} "$1" awk "$1" $(pwd) && | then "$1"
+	test && -eu "$1" echo "$1" ${HOME} "$@" done /usr/bin done then sed
+${HOME} echo 2>/dev/null x=1 printf
+	x=1 $(pwd) x=1 printf done test export
+	readonly readonly readonly && x=1 /usr/bin test
+	/usr/bin readonly cd grep printf export
+		printf then 'quoted text' cd ${HOME} 'quoted text'
+x=1 --verbose $(pwd) ${HOME} /usr/bin --verbose "$@" "$@" awk "$@" $(pwd)
+	test $(pwd) 2>/dev/null -eu grep | "$@" x=1
+-eu printf | local /usr/bin x=1 export test /usr/bin "$1" -eu
+grep test | awk && test then $(pwd) done test sed x=1
+$(pwd) ${HOME} -eu --verbose then grep readonly printf test 2>/dev/null "$@" local
+	"$@" grep sed 'quoted text' 'quoted text'
+		echo then | sed "$1" 2>/dev/null readonly awk && /usr/bin
+	--verbose | awk "$1" done $(pwd) "$@" $(pwd)
+	echo | grep /usr/bin && cd /usr/bin "$@"
+grep done --verbose ${HOME} | 2>/dev/null "$@" x=1 'quoted text'
+/usr/bin cd 2>/dev/null 'quoted text' local readonly test | done
+	printf | then -eu -eu test $(pwd) | x=1
+		printf --verbose -eu 'quoted text'
+	"$1" x=1 echo $(pwd) x=1 "$1" export cd echo && readonly && readonly printf -eu
+		&& test --verbose x=1 $(pwd) then grep echo $(pwd) 2>/dev/null
+x=1 export "$@" local grep
+	test readonly $(pwd) "$1" done sed export ${HOME} | "$@" | sed x=1 done | /usr/bin
+	2>/dev/null /usr/bin then && x=1 $(pwd)
+done grep /usr/bin export printf $(pwd) -eu /usr/bin grep "$@"
+"$1" x=1 printf /usr/bin x=1 /usr/bin cd awk --verbose -eu 2>/dev/null
+	--verbose echo done x=1 then x=1 $(pwd) 'quoted text' done /usr/bin
+		-eu $(pwd) export ${HOME} /usr/bin test printf test x=1 2>/dev/null
+		test sed --verbose --verbose done ${HOME} /usr/bin grep awk "$1" done
+	echo /usr/bin then cd
+		${HOME} $(pwd) 2>/dev/null "$@" --verbose $(pwd) sed printf
+		/usr/bin local 2>/dev/null local
+		export ${HOME} "$@" echo done ${HOME} "$@" x=1 'quoted text' readonly
+		${HOME} "$1" x=1 sed $(pwd) | then "$1" /usr/bin echo grep
+		local printf && readonly -eu sed sed $(pwd)
+	x=1 test | grep then 2>/dev/null
+		'quoted text' "$@" sed $(pwd)
+-eu 'quoted text' printf --verbose echo ${HOME}
+		-eu export /usr/bin then echo readonly 2>/dev/null done ${HOME}
+sed "$1" cd local grep export export --verbose awk
+	cd local "$1" export sed echo test echo && $(pwd) ${HOME} then
+		| sed grep /usr/bin printf ${HOME} ${HOME} "$@" then $(pwd) grep local
+		| printf $(pwd) 2>/dev/null x=1 x=1 /usr/bin
+		then ${HOME} local "$1" sed "$@"
+	then awk done | /usr/bin "$1" ${HOME} 2>/dev/null export awk export readonly
+${HOME} test done local readonly x=1 /usr/bin cd ${HOME} && ${HOME} local --verbose
+then grep -eu -eu export /usr/bin
+	echo done $(pwd) $(pwd) local ${HOME} local
+	"$1" --verbose "$1" "$1" export done x=1 "$1" cd then $(pwd) awk --verbose &&
+	cd 'quoted text' then grep 2>/dev/null
+	printf cd /usr/bin "$@" x=1 'quoted text' sed "$@" awk
+	then awk ${HOME} | 'quoted text' 'quoted text' 2>/dev/null
+	'quoted text' "$1" "$@" then done grep | | echo --verbose done
+"$@" cd awk --verbose grep 'quoted text' $(pwd) ${HOME}
+export 2>/dev/null awk sed --verbose --verbose test export
+		"$1" sed cd --verbose 2>/dev/null awk then readonly sed 'quoted text'
+		readonly | /usr/bin --verbose 'quoted text' 'quoted text' x=1 echo test
+echo 2>/dev/null awk "$@" $(pwd)
+	| $(pwd) local local /usr/bin | --verbose
+cd echo grep | /usr/bin $(pwd) local -eu local test && sed done -eu
+awk "$@" grep x=1 test -eu x=1
+grep cd "$1" cd | done --verbose -eu then local
+	"$1" sed sed test export 'quoted text' $(pwd) 'quoted text' local
+		&& | local /usr/bin 2>/dev/null export | printf
+done 'quoted text' sed awk export readonly local 2>/dev/null "$@" export grep /usr/bin
@@ -0,0 +1,2001 @@
+	then awk cd test "$@" /usr/bin -eu /usr/bin --verbose "$1"
+		test grep export ${HOME} printf "$@" awk
+	2>/dev/null then x=1 2>/dev/null test echo grep
+		/usr/bin && $(pwd) grep local x=1 2>/dev/null cd $(pwd) $(pwd)
+	printf echo export -eu "$@" 'quoted text'
+		local 2>/dev/null ${HOME} grep $(pwd) echo | && /usr/bin | sed printf printf
+cd test 'quoted text' local -eu printf awk readonly test /usr/bin
+	awk readonly x=1 "$@" --verbose cd x=1 "$1"
+		readonly "$@" awk $(pwd) 'quoted text' -eu cd 'quoted text' "$1" -eu readonly export
+	grep /usr/bin --verbose 2>/dev/null
+		"$1" | "$@" --verbose "$@" 'quoted text' |
+	test ${HOME} "$@" echo export ${HOME} sed test "$1"
+test 'quoted text' /usr/bin local x=1 2>/dev/null x=1 done -eu grep test | /usr/bin
+echo test 'quoted text' awk test "$1" done then /usr/bin done test
+"$1" done test local "$1" /usr/bin 'quoted text' echo 2>/dev/null "$@" then
+	"$@" echo then local sed then /usr/bin 2>/dev/null
+		printf readonly done 2>/dev/null local awk 'quoted text'
+		then | readonly && -eu printf then test sed
+	$(pwd) 2>/dev/null "$1" /usr/bin | grep then then grep /usr/bin cd "$1"
+		| cd | printf printf then 2>/dev/null
+	readonly sed | $(pwd)
+		export awk export /usr/bin test x=1 printf local
+		done 'quoted text' export 'quoted text'
+		"$1" grep echo local --verbose
+		--verbose -eu --verbose
+$(pwd) awk 2>/dev/null echo readonly ${HOME} readonly
+		readonly "$1" cd | done $(pwd) | sed && awk $(pwd) done then ${HOME} 'quoted text'
+export 'quoted text' done 'quoted text' grep
+	/usr/bin --verbose /usr/bin 'quoted text'
+	then "$@" done $(pwd) test "$1" "$1" test cd 2>/dev/null 2>/dev/null
+	export 'quoted text' /usr/bin done done export /usr/bin echo grep done
+	done && done /usr/bin echo --verbose
+		&& readonly grep then sed sed local then
+${HOME} sed grep x=1 sed "$1" sed ${HOME} readonly ${HOME} "$@" grep x=1 grep
+		$(pwd) readonly ${HOME} ${HOME} echo && "$@" --verbose
+--verbose /usr/bin then export "$@" printf && -eu "$1" printf
+local $(pwd) printf done cd ${HOME} 'quoted text'
+	awk then x=1 sed readonly | local printf test grep $(pwd) sed
+		2>/dev/null "$@" printf $(pwd) | export local grep cd
+	awk echo awk 2>/dev/null "$1" --verbose cd x=1
+		| local "$@" local -eu $(pwd) sed --verbose
+		x=1 cd 'quoted text' printf sed "$@" x=1 ${HOME} | 'quoted text'
+${HOME} 2>/dev/null /usr/bin grep grep awk 'quoted text' local && --verbose
+		/usr/bin sed x=1 2>/dev/null cd cd
+--verbose 'quoted text'
+	awk "$1" then printf export
+	"$1" grep && x=1 "$@" then cd printf /usr/bin then echo readonly export
+		cd 2>/dev/null local "$@"
+		/usr/bin 2>/dev/null 'quoted text' x=1 printf
+/usr/bin -eu test -eu
+	${HOME} local test ${HOME} awk -eu awk 2>/dev/null
+then && /usr/bin ${HOME}
+	$(pwd) sed && cd && test
+	then done ${HOME} cd /usr/bin | then
+then 2>/dev/null sed then x=1
+	| "$1" done awk /usr/bin done cd sed && $(pwd)
+		/usr/bin cd /usr/bin "$1" 2>/dev/null --verbose
+		&& echo && -eu grep && local |
+		"$@" test awk x=1 "$@" sed export test sed $(pwd) printf /usr/bin
+x=1 "$1" $(pwd) echo then /usr/bin "$1" 'quoted text' readonly
+	then done cd --verbose awk && $(pwd) $(pwd) 'quoted text' && ${HOME} 'quoted text'
+| "$@" done /usr/bin then export
+	2>/dev/null | printf grep local then
+local && "$@" echo && awk readonly done then export
+$(pwd) ${HOME} readonly x=1 && --verbose 2>/dev/null echo ${HOME}
+	done awk export test export export x=1 echo && "$@"
+x=1 x=1 done printf "$1" sed printf
+	readonly readonly grep ${HOME} echo printf 'quoted text' 2>/dev/null printf
+	sed sed done printf "$@" export x=1 "$@" grep x=1 | printf $(pwd)
+		local echo sed "$@" local
+	&& export done printf
+		readonly readonly -eu x=1 && export done then printf /usr/bin "$@"
+	x=1 ${HOME} local awk awk $(pwd) | "$@"
+		awk export grep test | 2>/dev/null test grep printf ${HOME} awk echo
+grep 'quoted text' echo "$1" -eu awk
+		readonly awk export ${HOME} $(pwd) -eu then awk echo echo
+		| cd ${HOME} done printf --verbose readonly done test --verbose printf
+x=1 && readonly done $(pwd) test | "$@" export | | $(pwd) cd sed
+	done grep 2>/dev/null | 2>/dev/null done
+		$(pwd) $(pwd) awk /usr/bin x=1 --verbose awk "$1" export readonly done printf
+		local "$1" | done echo x=1 grep cd 'quoted text' 'quoted text'
+		${HOME} done local ${HOME} local cd readonly "$1" $(pwd) -eu --verbose
+		echo 2>/dev/null export cd | readonly printf -eu 2>/dev/null
+| 2>/dev/null "$@" export echo cd awk x=1
+		then ${HOME} | --verbose printf $(pwd) /usr/bin "$1" grep "$@" export "$1" $(pwd)
+2>/dev/null "$1" sed --verbose "$@" && x=1 $(pwd) grep x=1 done test
+	x=1 printf echo "$1" | | ${HOME} export echo echo done "$1" printf readonly
+		| /usr/bin -eu --verbose && cd --verbose grep
+	"$@" grep ${HOME} done readonly /usr/bin then
+${HOME} printf 2>/dev/null | grep
+		grep /usr/bin local --verbose x=1 awk /usr/bin 'quoted text' export
+${HOME} "$@" printf 2>/dev/null readonly
+sed "$@" x=1 readonly $(pwd)
+readonly 2>/dev/null "$@"
+then awk "$@" "$1" 'quoted text' "$@" "$@" awk --verbose cd echo
+	echo test "$@" && $(pwd) 'quoted text' test then cd $(pwd)
+		export sed ${HOME} awk /usr/bin
+		/usr/bin 2>/dev/null $(pwd) && printf sed sed cd export
+	done | sed sed echo x=1
+cd grep 2>/dev/null ${HOME} -eu done 2>/dev/null
+${HOME} local "$@" x=1 ${HOME}
+-eu awk $(pwd) "$@" "$1" $(pwd) sed "$1" export
+2>/dev/null echo grep x=1 printf local | 'quoted text' then grep
+"$@" awk local ${HOME} "$@" ${HOME} ${HOME} 'quoted text' ${HOME} cd
+sed printf x=1 --verbose printf awk test "$1" 'quoted text'
+	| cd $(pwd) "$@" done x=1 && && cd | echo sed printf awk awk
+		readonly then | x=1 "$1" cd 2>/dev/null export
+		then then | && 'quoted text' test x=1 done cd && grep x=1 ${HOME} /usr/bin done
+cd sed && readonly readonly printf test
+then "$1" $(pwd) | x=1 grep x=1 test printf printf then readonly
+grep && local 2>/dev/null 2>/dev/null 'quoted text' -eu 2>/dev/null x=1
+		echo /usr/bin test sed readonly test cd
+		cd $(pwd) grep grep printf awk
+	/usr/bin awk 2>/dev/null 2>/dev/null && test 2>/dev/null | awk | x=1
+		export readonly x=1 -eu then test x=1 -eu sed
+x=1 test --verbose --verbose -eu test
+--verbose 2>/dev/null grep "$@" test && cd -eu
+		then "$1" --verbose /usr/bin -eu export
+	readonly "$@" ${HOME} 'quoted text' "$1" local --verbose
+${HOME} echo local "$@" done sed | local awk $(pwd)
+	sed local sed readonly -eu local local ${HOME} local printf "$1" awk printf
+	test "$@" -eu "$@" sed --verbose
+	${HOME} x=1 test /usr/bin done
+echo 2>/dev/null then 'quoted text' 2>/dev/null -eu export "$1" echo && awk readonly
+	echo 2>/dev/null /usr/bin
+		local | readonly "$1" /usr/bin "$@" test && test awk 2>/dev/null 2>/dev/null
+	grep grep readonly awk readonly printf && "$1" local 'quoted text'
+echo -eu echo export
+	"$1" cd -eu x=1 done then && local --verbose echo awk
+2>/dev/null cd cd && 'quoted text' 2>/dev/null
+	test ${HOME} $(pwd) | test /usr/bin --verbose test | $(pwd) ${HOME}
+-eu readonly ${HOME} echo
+	| "$@" local readonly readonly 2>/dev/null "$@" readonly
+cd done && 2>/dev/null test "$@" cd ${HOME} 2>/dev/null
+		2>/dev/null | then awk $(pwd) x=1 -eu -eu readonly grep grep
+		sed 'quoted text' 'quoted text'
+echo echo awk local /usr/bin awk cd --verbose ${HOME}
+${HOME} readonly x=1 && x=1 x=1 --verbose
+		${HOME} local cd awk ${HOME} -eu printf ${HOME} grep
+		x=1 && 2>/dev/null x=1 ${HOME} test printf
+		/usr/bin $(pwd) 2>/dev/null cd --verbose 2>/dev/null cd --verbose
+--verbose export grep x=1 sed && x=1 $(pwd) "$1" sed
+	&& sed "$@" echo echo export "$1" sed sed readonly
+	grep export 'quoted text' then && --verbose echo
+	&& sed /usr/bin "$@" | export export x=1 then --verbose x=1 && 2>/dev/null printf
+		sed printf --verbose -eu "$1"
+		then 2>/dev/null $(pwd) "$1" sed then | readonly then grep cd printf sed
+| sed "$1" && $(pwd) done | export
+awk /usr/bin test --verbose awk 2>/dev/null test x=1 test sed $(pwd) --verbose
+	--verbose -eu cd "$@" echo printf grep
+test awk ${HOME} x=1 2>/dev/null export sed --verbose done && export awk sed
+		2>/dev/null && "$1" 2>/dev/null "$@" && awk test -eu printf test done "$1" echo
+	&& cd -eu awk printf "$@" /usr/bin grep ${HOME} grep
+		sed done grep && printf done grep
+readonly | /usr/bin 2>/dev/null export printf printf printf x=1 cd
+| -eu test x=1 ${HOME} export grep local then
+		cd echo ${HOME} printf && 2>/dev/null
+	export test export | grep sed cd | test
+		'quoted text' cd "$1" /usr/bin test cd done --verbose && sed cd 2>/dev/null printf
+	--verbose /usr/bin then && export
+then -eu | $(pwd) local "$@" then local echo "$1" -eu
+	"$@" "$1" cd done /usr/bin export $(pwd) done echo
+	printf -eu x=1 2>/dev/null test -eu cd done grep ${HOME} cd export
+	echo awk grep test $(pwd) export 2>/dev/null -eu 2>/dev/null
+	cd readonly export sed $(pwd) echo
+2>/dev/null "$@" -eu cd "$1" | then sed then x=1 readonly 'quoted text' echo x=1
+	${HOME} ${HOME} grep test done cd done export 'quoted text' -eu 2>/dev/null
+	then 'quoted text' 'quoted text' awk then && test
+	awk 'quoted text' "$1"
+		-eu echo -eu x=1 done | printf x=1 local done then && awk then "$1" done
+	cd $(pwd) "$@" && export && awk "$1" printf printf
+sed sed test x=1 'quoted text' cd "$@" | 2>/dev/null export awk grep
+	"$1" sed -eu | 'quoted text' 2>/dev/null echo cd export 'quoted text'
+cd done --verbose x=1 "$1" awk 'quoted text' awk local "$@" sed then
+	x=1 cd grep 'quoted text' echo done 2>/dev/null "$1" && readonly
+echo 'quoted text' export grep printf ${HOME} test awk
+then export cd /usr/bin "$@" done printf /usr/bin ${HOME}
+"$1" grep | -eu /usr/bin readonly
+	sed 'quoted text' ${HOME} test 2>/dev/null then cd 'quoted text'
+"$@" sed --verbose awk "$1" $(pwd) 'quoted text'
+readonly -eu echo 2>/dev/null x=1
+"$1" export /usr/bin echo 'quoted text' test $(pwd) "$@" ${HOME}
+grep ${HOME} cd ${HOME} export grep
+'quoted text' -eu --verbose ${HOME}
+"$1" done awk $(pwd) | test grep ${HOME} &&
+	"$1" local "$@" 2>/dev/null /usr/bin local "$1"
+	echo /usr/bin | local 2>/dev/null cd
+	"$1" --verbose local x=1 sed "$1" readonly printf local "$1"
+		export /usr/bin --verbose local 'quoted text' /usr/bin printf && grep
+	'quoted text' cd then awk 'quoted text' $(pwd) readonly awk test test echo
+grep cd 'quoted text' cd awk done 'quoted text' sed local && then
+		grep $(pwd) x=1 "$@" awk $(pwd) | /usr/bin /usr/bin then | grep /usr/bin printf
+		readonly -eu "$@" printf cd export $(pwd)
+	2>/dev/null echo grep readonly $(pwd)
+sed && awk | "$1" echo local ${HOME}
+printf -eu ${HOME} done sed | | readonly "$1" -eu sed local | readonly
+	x=1 awk | && done echo $(pwd) -eu | && x=1
+--verbose then 'quoted text' -eu readonly
+	then "$1" grep readonly && local cd grep |
+	${HOME} ${HOME} $(pwd) local x=1 sed local readonly 2>/dev/null
+	then cd /usr/bin local 2>/dev/null
+		-eu -eu x=1 /usr/bin printf test readonly test export grep
+		readonly local "$@" grep grep grep printf test
+	x=1 && sed /usr/bin $(pwd)
+$(pwd) && then 2>/dev/null sed 'quoted text'
+2>/dev/null done then printf done printf
+		local done readonly /usr/bin
+	echo --verbose then local $(pwd) /usr/bin test cd -eu && --verbose
+${HOME} "$1" && printf $(pwd)
+	"$@" ${HOME} | sed 2>/dev/null $(pwd) export echo 'quoted text' && x=1 awk readonly
+	-eu printf "$@" printf "$1" 'quoted text' $(pwd) | "$1" $(pwd)
+readonly 'quoted text'
+		x=1 printf | -eu x=1 echo --verbose test sed grep | local
+	test -eu cd "$@" 'quoted text'
+	export x=1 2>/dev/null sed sed --verbose && 2>/dev/null
+&& export 2>/dev/null "$@" -eu | | -eu test "$@" local --verbose
+		| "$1" test test x=1 | && "$@" sed export done local cd | test /usr/bin
+sed | sed "$@" | awk echo local grep /usr/bin done grep grep
+	-eu x=1 -eu 2>/dev/null done 'quoted text' | | | test then sed | -eu
+	cd --verbose export awk x=1 $(pwd) grep cd local $(pwd) readonly
+	"$@" 2>/dev/null printf /usr/bin 'quoted text' done sed export printf &&
+	"$@" echo cd && done -eu "$1" "$@"
+$(pwd) 2>/dev/null 2>/dev/null cd $(pwd) grep test
+	sed 'quoted text' ${HOME} local test --verbose 2>/dev/null
+-eu ${HOME} local test local | grep readonly
+		awk x=1 readonly "$@" test /usr/bin --verbose
+		echo awk | 'quoted text' readonly /usr/bin 'quoted text' printf --verbose
+-eu --verbose && "$@" export ${HOME} cd | 2>/dev/null readonly awk echo awk
+| 2>/dev/null readonly | readonly $(pwd) -eu test done done cd --verbose
+grep -eu local done /usr/bin ${HOME} awk
+local $(pwd) --verbose then printf && | 'quoted text'
+local "$@" awk --verbose echo x=1 test && "$1" ${HOME} 2>/dev/null readonly
+test grep cd done x=1 x=1 && grep /usr/bin cd export -eu $(pwd) test test /usr/bin
+		done cd | grep printf 2>/dev/null then done
+local awk -eu test -eu $(pwd) -eu echo x=1 'quoted text' sed sed
+	${HOME} grep readonly | awk | ${HOME}
+awk 2>/dev/null x=1 ${HOME} ${HOME} | x=1 && -eu local | 2>/dev/null
+/usr/bin awk grep awk done "$@" "$@" -eu then ${HOME} "$@" "$@" "$@" done
+$(pwd) then grep x=1 grep /usr/bin grep local export /usr/bin x=1 x=1
+	| sed 2>/dev/null cd then printf
+		'quoted text' then printf ${HOME} /usr/bin
+		test -eu local sed test 'quoted text' printf export local 'quoted text' test ${HOME}
+	done 2>/dev/null /usr/bin -eu awk
+then "$1" ${HOME} awk then
+done grep "$1" $(pwd) "$@" && export cd done sed printf test 2>/dev/null
+	x=1 x=1 2>/dev/null -eu done -eu local
+		-eu echo readonly 2>/dev/null
+	then $(pwd) done done | --verbose readonly 'quoted text' awk
+	--verbose echo grep 'quoted text'
+		sed "$@" local readonly
+		cd $(pwd) awk "$1" /usr/bin grep /usr/bin
+sed readonly echo && --verbose 'quoted text'
+'quoted text' && awk test readonly done --verbose cd export
+	then "$@" sed echo "$@" 2>/dev/null
+test local --verbose && test readonly && export
+cd ${HOME} 2>/dev/null /usr/bin test 'quoted text'
+		done test cd "$1" done then ${HOME}
+		${HOME} grep && --verbose export local echo test sed "$1" awk && echo done
+sed 'quoted text' echo --verbose test
+2>/dev/null 'quoted text' echo awk export
+	2>/dev/null export -eu /usr/bin export local printf export && cd sed &&
+	&& "$@" && export export export -eu x=1 readonly done && cd | local --verbose
+2>/dev/null readonly && | sed | --verbose local readonly 'quoted text'
+sed done x=1 && then /usr/bin "$@" 'quoted text' /usr/bin
+	x=1 'quoted text' && "$1" awk $(pwd)
+		cd done test awk cd readonly grep sed grep $(pwd) echo export awk printf echo
+export grep sed ${HOME} 'quoted text'
+x=1 /usr/bin readonly && local | "$1" $(pwd) 2>/dev/null echo
+		/usr/bin local /usr/bin readonly echo local grep -eu && awk
+	"$@" export x=1 local --verbose | && readonly 2>/dev/null x=1 test awk readonly
+${HOME} && "$@" ${HOME} sed cd 'quoted text' done awk echo
+	sed grep awk x=1 sed awk then --verbose "$@" $(pwd)
+	-eu sed done done "$@" then test export /usr/bin cd /usr/bin then
+		awk echo test "$1" grep grep done "$1" 'quoted text' -eu grep echo
+	| && /usr/bin -eu /usr/bin
+		"$1" sed "$@" -eu x=1 &&
+		awk x=1 'quoted text' $(pwd)
+	echo then local --verbose test $(pwd) awk ${HOME} /usr/bin ${HOME} 2>/dev/null
+		cd sed sed $(pwd) sed ${HOME}
+	readonly "$1" test export -eu $(pwd)
+	${HOME} grep /usr/bin -eu
+		sed printf grep echo echo sed 'quoted text' then && /usr/bin --verbose
+		$(pwd) echo readonly $(pwd) readonly $(pwd)
+done sed --verbose cd readonly $(pwd) grep grep | --verbose echo x=1 | sed
+readonly echo sed && --verbose done
+cd local done | --verbose "$1" | "$1" readonly test test -eu && cd readonly
+	export -eu "$@" ${HOME} local "$1" echo
+	x=1 readonly | printf --verbose done sed awk --verbose -eu
+	grep test $(pwd) --verbose local "$1" echo -eu "$1" export
+	--verbose 2>/dev/null
+	--verbose "$@" && awk x=1 cd ${HOME}
+	sed --verbose -eu -eu "$1" local export test sed grep test "$@" export 'quoted text'
+	"$1" 2>/dev/null && 'quoted text' -eu grep
+export -eu local 'quoted text' $(pwd) then
+printf --verbose then then grep "$1"
+		&& $(pwd) $(pwd) $(pwd) awk sed && export 'quoted text' grep "$1"
+		'quoted text' local done test done echo --verbose awk x=1 "$@"
+		test export && 'quoted text' ${HOME} test then readonly done test $(pwd)
+		awk x=1 /usr/bin /usr/bin $(pwd) test sed readonly -eu $(pwd) 'quoted text'
+'quoted text' awk --verbose local done ${HOME} && cd "$1" | readonly && "$1"
+		x=1 done test $(pwd) done $(pwd) awk echo
+		${HOME} export local "$@" test 'quoted text' "$1"
+	x=1 x=1 -eu echo awk export $(pwd) grep
+		-eu 2>/dev/null ${HOME} awk
+	export readonly x=1 "$@" $(pwd) printf 'quoted text' grep $(pwd) export
+"$1" 2>/dev/null /usr/bin "$@" printf 2>/dev/null awk -eu
+		export then 2>/dev/null done export "$1"
+awk $(pwd) 'quoted text'
+		'quoted text' test awk local 'quoted text' | cd echo "$1" sed 'quoted text' then
+		${HOME} 'quoted text' local done
+	sed test x=1 done awk --verbose
+		2>/dev/null /usr/bin $(pwd) printf 'quoted text'
+	sed cd ${HOME} grep sed
+		cd readonly $(pwd) --verbose |
+		'quoted text' 'quoted text' then printf
+		x=1 "$@" awk done printf "$@" "$@" awk | "$1" done -eu printf "$@" ${HOME}
+${HOME} grep printf 2>/dev/null local 'quoted text' $(pwd) awk sed
+-eu 2>/dev/null readonly cd ${HOME}
+x=1 2>/dev/null ${HOME} cd readonly "$1" "$@" 'quoted text'
+readonly ${HOME} local x=1 && "$1" "$1" 'quoted text' awk $(pwd) sed |
+		/usr/bin cd cd awk grep cd grep test 2>/dev/null $(pwd)
+printf "$1" cd --verbose grep done | echo echo
+		printf export printf local 2>/dev/null then grep --verbose
+		sed | | cd awk | /usr/bin readonly test export echo
+	"$@" test x=1 printf /usr/bin && grep
+		then then --verbose "$@" "$1" && && --verbose
+	then -eu x=1 sed "$1" then
+	local sed $(pwd) grep
+| sed then "$@" ${HOME} 'quoted text'
+&& -eu cd /usr/bin x=1 cd | ${HOME}
+local "$1" "$1" "$1" | --verbose x=1
+		awk /usr/bin --verbose $(pwd) 'quoted text' -eu ${HOME} 2>/dev/null cd
+test grep grep -eu "$1" ${HOME} && sed -eu /usr/bin
+$(pwd) $(pwd) ${HOME} cd local readonly
+grep then sed /usr/bin
+		printf cd $(pwd) echo echo ${HOME} 2>/dev/null
+test grep "$1" printf 2>/dev/null export grep
+then 'quoted text' then then sed 2>/dev/null 2>/dev/null done x=1 sed 'quoted text'
+	| "$1" cd grep x=1 cd
+	${HOME} printf "$@" /usr/bin ${HOME}
+"$@" /usr/bin grep export | then -eu "$1" done cd local -eu 'quoted text'
+	&& sed | printf "$@" grep -eu cd
+done && grep test --verbose 2>/dev/null printf x=1 echo export /usr/bin
+		$(pwd) --verbose "$@" local sed x=1 'quoted text' 'quoted text' "$1" local --verbose
+		echo "$@" awk then readonly x=1 /usr/bin && export ${HOME} local sed -eu $(pwd)
+		grep 'quoted text' "$@"
+| 'quoted text' 'quoted text' local printf cd printf x=1 &&
+test ${HOME} printf echo readonly $(pwd)
+		echo 'quoted text' "$1" export | test /usr/bin done
+'quoted text' && && sed awk 'quoted text'
+		then -eu sed printf "$@" export export awk 2>/dev/null
+readonly cd /usr/bin && 2>/dev/null
+	'quoted text' export readonly echo test
+	then 2>/dev/null cd local
+	awk test sed ${HOME} export then -eu then
+		2>/dev/null sed "$1" local 'quoted text'
+--verbose 2>/dev/null sed export
+		&& readonly awk sed /usr/bin | done cd /usr/bin printf
+x=1 export | echo -eu $(pwd) done
+		| done x=1 ${HOME} /usr/bin awk
+	2>/dev/null 2>/dev/null
+	sed x=1 sed readonly x=1 done
+		then | printf "$@" readonly grep ${HOME} awk local
+		sed && then cd && done echo printf | sed test sed echo
+2>/dev/null --verbose /usr/bin /usr/bin echo test export 'quoted text'
+grep -eu --verbose grep $(pwd) printf -eu /usr/bin sed then "$1" 2>/dev/null
+		done ${HOME} 2>/dev/null && $(pwd) awk -eu test -eu
+	--verbose readonly 'quoted text' 'quoted text' done /usr/bin 2>/dev/null
+	"$1" && $(pwd) x=1 cd awk "$@" 2>/dev/null && -eu local $(pwd) echo sed /usr/bin
+		done 'quoted text' cd awk cd 2>/dev/null done test
+2>/dev/null 2>/dev/null printf
+		echo && echo --verbose readonly "$@" x=1 then ${HOME} test sed readonly
+		echo test ${HOME} awk echo printf
+		&& x=1 /usr/bin grep $(pwd) /usr/bin awk -eu && cd
+	2>/dev/null awk $(pwd) sed --verbose local done 'quoted text'
+	awk ${HOME} echo echo $(pwd) done "$@" /usr/bin && "$@" /usr/bin x=1 test 'quoted text'
+		/usr/bin && 2>/dev/null
+		done cd x=1 export x=1 sed | readonly
+	&& then readonly cd done x=1 then "$@" --verbose
+		'quoted text' && $(pwd) printf local done "$1" local grep cd | awk
+	done -eu test x=1 2>/dev/null x=1 awk local | ${HOME}
+		readonly readonly printf 2>/dev/null
+x=1 done then printf readonly test -eu awk 'quoted text' export
+-eu "$1" 'quoted text' local $(pwd) printf
+	$(pwd) sed --verbose $(pwd) export awk $(pwd) echo local -eu printf x=1 --verbose
+printf readonly x=1 2>/dev/null
+	-eu export && $(pwd) printf echo
+	"$@" export echo 2>/dev/null --verbose
+"$@" /usr/bin $(pwd) 'quoted text' test done
+		echo -eu -eu $(pwd) /usr/bin | x=1
+	| cd 'quoted text' --verbose $(pwd) 'quoted text' -eu &&
+	${HOME} 'quoted text' | then echo $(pwd) echo readonly
+	echo test local done cd sed readonly x=1 local
+	awk 'quoted text' "$@" 2>/dev/null /usr/bin then grep $(pwd) local ${HOME}
+	"$1" readonly printf printf "$1" local
+	readonly local --verbose
+	echo grep done | local readonly awk && done "$1" 2>/dev/null x=1 export
+	done $(pwd) export done local readonly 2>/dev/null $(pwd) "$@"
+		test export local local readonly sed 2>/dev/null
+		cd /usr/bin --verbose "$@" test && --verbose $(pwd) | printf x=1 done $(pwd)
+	/usr/bin done sed /usr/bin sed done 2>/dev/null ${HOME}
+| awk "$@" "$1" local | awk awk | ${HOME} && "$@" 2>/dev/null export
+	readonly export done && | x=1 -eu
+$(pwd) cd && "$@" $(pwd)
+		done printf -eu grep printf printf && sed | echo grep $(pwd) |
+		$(pwd) readonly cd x=1 x=1 readonly printf
+		$(pwd) /usr/bin printf | echo 2>/dev/null /usr/bin grep
+	test "$@" printf ${HOME} cd 2>/dev/null
+"$@" echo 'quoted text' cd local | awk echo | printf 'quoted text'
+| then test awk ${HOME} grep echo ${HOME} 'quoted text'
+		"$@" $(pwd) grep printf grep "$1" printf
+	| test echo "$1" ${HOME} x=1 && export printf cd grep | 'quoted text' echo
+$(pwd) 'quoted text' ${HOME} test readonly local
+		test grep 2>/dev/null local --verbose -eu then && local echo
+		done local "$1" sed sed && ${HOME} && test 2>/dev/null | $(pwd) --verbose done
+| cd test x=1 grep x=1 awk sed local /usr/bin grep readonly
+printf "$@" echo && done test then "$@" && | export "$1" echo printf printf
+2>/dev/null local sed -eu echo 'quoted text' "$1" test /usr/bin && && $(pwd)
+		--verbose /usr/bin readonly 'quoted text' cd grep /usr/bin
+	"$@" test test printf $(pwd) /usr/bin /usr/bin printf grep
+	sed ${HOME} sed done readonly && $(pwd) ${HOME} && done cd 2>/dev/null
+	cd "$@" --verbose $(pwd) | cd local test echo | /usr/bin "$@" export
+grep done "$@" echo $(pwd) readonly echo "$@" | cd ${HOME} 2>/dev/null
+2>/dev/null -eu "$1" then && echo "$1" printf 'quoted text'
+cd | local printf 2>/dev/null
+readonly "$@" "$@" 'quoted text'
+		--verbose "$@" $(pwd) "$1" | x=1 test x=1 awk | $(pwd)
+	2>/dev/null echo local readonly
+	${HOME} && --verbose sed export "$@"
+echo "$@" "$@" ${HOME} grep
+grep then "$@" /usr/bin
+	grep then "$@" cd ${HOME} x=1 cd then $(pwd) 'quoted text' echo
+		printf test 'quoted text' 'quoted text' x=1 then readonly | -eu readonly
+&& $(pwd) sed $(pwd) echo cd grep done export done $(pwd) "$1" cd 2>/dev/null
+		-eu export "$@" grep $(pwd)
+		--verbose test x=1 $(pwd) | cd --verbose printf
+'quoted text' "$1" printf cd echo then "$@" printf done export && x=1 |
+-eu "$@" export 'quoted text'
+	then && export "$@" $(pwd) readonly /usr/bin /usr/bin "$1" $(pwd) "$1" "$1"
+		'quoted text' x=1 done local --verbose awk grep
+cd local /usr/bin -eu test 'quoted text' ${HOME} --verbose local cd "$@" "$@" export
+		| grep && --verbose echo "$@" test awk | 'quoted text' awk then
+export sed "$1" "$@" sed test 'quoted text' ${HOME} 'quoted text'
+	$(pwd) echo then awk $(pwd) "$@"
+'quoted text' "$@" cd test export then ${HOME} "$1"
+		readonly readonly local readonly readonly grep echo ${HOME} sed
+		2>/dev/null awk --verbose local
+		echo export -eu sed awk local test echo x=1 --verbose done 2>/dev/null /usr/bin
+	then "$@" ${HOME} | && echo then && ${HOME}
+		$(pwd) local export 2>/dev/null x=1 test export "$@" "$1" | 2>/dev/null then 2>/dev/null
+	done ${HOME} test 2>/dev/null grep cd --verbose "$1" awk "$@" cd awk /usr/bin
+	x=1 2>/dev/null 2>/dev/null grep && "$1" && cd grep test
+	echo export "$1" $(pwd) local --verbose 2>/dev/null
+		x=1 --verbose /usr/bin cd then && $(pwd) "$1" ${HOME}
+	"$@" 2>/dev/null local sed | grep --verbose --verbose
+	then x=1 sed && | grep x=1 export readonly
+sed test export cd test then 'quoted text' 2>/dev/null sed grep
+		x=1 -eu 2>/dev/null 'quoted text' sed
+readonly cd awk done $(pwd) ${HOME} $(pwd) x=1 -eu grep "$@" sed printf "$1" --verbose
+		2>/dev/null readonly && ${HOME} && readonly local cd printf 'quoted text' 2>/dev/null
+	| 'quoted text' cd --verbose --verbose
+test test $(pwd) /usr/bin test echo ${HOME} /usr/bin
+local echo echo grep done
+		export echo | export 2>/dev/null
+		sed awk cd grep readonly 2>/dev/null && $(pwd) grep -eu
+	test awk done 'quoted text' test readonly "$1" ${HOME} $(pwd) /usr/bin
+echo sed grep echo test "$@" readonly done ${HOME}
+	local "$1" x=1 printf grep echo
+		printf "$1" | | test "$@" "$1" cd export then local "$1" 'quoted text' readonly
+	"$@" --verbose /usr/bin 2>/dev/null local 2>/dev/null
+/usr/bin | x=1 cd sed ${HOME} local local "$@"
+		readonly then then 2>/dev/null | && && | /usr/bin /usr/bin 'quoted text'
+		$(pwd) --verbose done
+awk "$1" ${HOME} "$@" printf /usr/bin cd 2>/dev/null ${HOME} | export x=1 2>/dev/null
+done "$1" local grep /usr/bin sed
+-eu 2>/dev/null sed printf local export
+		cd grep | export && -eu --verbose "$@" echo echo cd
+grep grep readonly "$@" done && grep --verbose 2>/dev/null 'quoted text' | awk "$@"
+readonly /usr/bin then $(pwd) -eu grep 'quoted text' then -eu test then 2>/dev/null
+$(pwd) local echo test local "$1" /usr/bin --verbose printf
+		'quoted text' test printf "$1" --verbose
+	&& printf /usr/bin cd &&
+awk && x=1 /usr/bin readonly echo test readonly
+awk done /usr/bin ${HOME} "$1" done sed ${HOME} 2>/dev/null /usr/bin
+		echo test | | done then export x=1 sed cd -eu ${HOME} --verbose export 'quoted text'
+2>/dev/null local $(pwd) then ${HOME}
+	awk x=1 sed local "$1" export local
+		test ${HOME} awk 'quoted text'
+&& -eu readonly export test /usr/bin --verbose printf sed |
+		$(pwd) cd awk x=1 grep local grep done
+	${HOME} cd test "$@" printf 'quoted text' /usr/bin 'quoted text'
+done sed test printf readonly x=1 'quoted text' 'quoted text' local sed ${HOME}
+x=1 then sed x=1 -eu echo
+		readonly ${HOME} "$1" printf $(pwd)
+	'quoted text' 'quoted text' | cd grep test export | 'quoted text'
+		${HOME} local test | awk test /usr/bin done then awk 'quoted text' -eu
+	then $(pwd) "$1" cd cd 'quoted text' readonly awk | local "$1" 'quoted text' then
+readonly sed 'quoted text' x=1
+local then x=1 "$@" 'quoted text'
+then test "$1" test echo x=1 | 'quoted text' "$@" test | && awk "$@"
+		/usr/bin export -eu printf "$1" x=1 done 2>/dev/null done readonly | | /usr/bin
+echo "$@" 2>/dev/null grep /usr/bin export x=1 | 2>/dev/null x=1
+		grep local export printf
+	sed printf local | "$@" "$1" readonly
+	"$@" "$1" printf 2>/dev/null done grep 2>/dev/null
+"$@" "$1" x=1 /usr/bin then cd $(pwd) --verbose printf grep
+sed --verbose sed test awk x=1 printf done then 2>/dev/null
+	readonly ${HOME} awk 2>/dev/null then "$@" /usr/bin
+		grep | -eu local grep "$@" printf "$@" awk "$@" local local grep 'quoted text'
+		&& 'quoted text' 2>/dev/null /usr/bin echo echo printf | echo echo
+	${HOME} awk then | /usr/bin local 2>/dev/null sed grep done 'quoted text'
+		grep local then printf "$1" "$1"
+awk 'quoted text' test sed echo readonly sed then awk done $(pwd) "$@" sed echo
+grep done readonly grep cd "$@" x=1 then
+| readonly grep && export done 2>/dev/null
+		sed $(pwd) grep echo 2>/dev/null 'quoted text'
+	sed && local 'quoted text' local printf export awk export
+"$@" local printf local --verbose printf cd $(pwd) 'quoted text' then echo
+		test then sed echo sed echo sed printf grep
+	2>/dev/null x=1 && grep
+x=1 echo x=1 && | test then $(pwd) 2>/dev/null cd cd test /usr/bin -eu test
+done | --verbose $(pwd) ${HOME} test done $(pwd)
+	local grep 2>/dev/null echo /usr/bin done | readonly awk "$1" x=1 --verbose test
+		then grep sed ${HOME} ${HOME} sed printf echo | test 2>/dev/null && -eu cd grep
+		echo ${HOME} local printf 2>/dev/null local "$@" $(pwd) printf
+		local cd grep --verbose ${HOME} then "$@" "$@" readonly 2>/dev/null done "$1" awk
+		/usr/bin awk grep /usr/bin "$1" readonly grep echo x=1 printf && printf && 'quoted text'
+export 2>/dev/null then | --verbose export local awk
+	sed -eu 'quoted text' readonly "$1" cd test
+		&& "$@" then local awk /usr/bin 2>/dev/null printf
+cd "$1" sed "$@" -eu 'quoted text'
+	done sed sed awk && test echo "$1" export ${HOME} && done local export
+&& echo export grep | && export test cd done cd -eu export then
+		&& "$1" 2>/dev/null $(pwd) && export sed export awk local && then | then x=1 echo
+		local readonly && 2>/dev/null cd
+		/usr/bin $(pwd) $(pwd)
+	'quoted text' sed /usr/bin test ${HOME} "$@" echo && $(pwd) $(pwd) "$@" x=1 && "$@"
+cd -eu readonly | --verbose printf local 'quoted text' printf x=1 awk printf readonly
+		cd && && && test && "$@" ${HOME} --verbose awk printf
+	/usr/bin local then export | echo then test ${HOME} $(pwd) cd echo printf
+	"$@" awk export | "$@" "$@" | /usr/bin "$@" $(pwd)
+	-eu && test | 'quoted text'
+	cd "$@" "$@" "$@" sed x=1 x=1 echo ${HOME} $(pwd) awk $(pwd) readonly local 'quoted text'
+| echo test --verbose /usr/bin
+		test export export sed "$1" 2>/dev/null $(pwd) -eu then "$1" && done $(pwd)
+	--verbose test export && then x=1 /usr/bin echo x=1
+	test cd | x=1 echo && 'quoted text' readonly local
+local cd --verbose sed x=1 export $(pwd) grep
+		&& then /usr/bin then 2>/dev/null --verbose awk ${HOME} grep readonly
+done done sed export sed local
+then $(pwd) local readonly cd sed
+/usr/bin test echo --verbose 2>/dev/null "$1" x=1 | cd $(pwd)
+--verbose /usr/bin 'quoted text' echo
+then then sed test 2>/dev/null then
+		done --verbose -eu grep then 'quoted text' done | local
+	2>/dev/null printf && 'quoted text' 2>/dev/null --verbose
+--verbose $(pwd) "$1" grep printf then 2>/dev/null --verbose "$@" test 'quoted text'
+export "$1" x=1 'quoted text' --verbose x=1 test sed then awk readonly
+-eu printf 2>/dev/null x=1
+	done && cd /usr/bin /usr/bin | ${HOME}
+printf --verbose --verbose awk 'quoted text'
+--verbose 2>/dev/null local done done $(pwd)
+	local awk export ${HOME} cd then local --verbose done && -eu readonly
+		-eu then done --verbose /usr/bin
+		/usr/bin printf $(pwd)
+grep --verbose readonly 'quoted text'
+		local --verbose readonly export ${HOME} --verbose
+		"$1" grep "$@" && echo -eu "$@" then local "$@" printf export
+-eu --verbose --verbose /usr/bin
+echo cd echo 2>/dev/null "$1" x=1 /usr/bin then local printf grep "$1" grep
+		export test $(pwd) ${HOME} cd sed | 'quoted text'
+		awk "$@" x=1 printf done 2>/dev/null awk
+	then ${HOME} -eu --verbose
+		echo printf export echo printf && $(pwd) "$1" | done awk 2>/dev/null $(pwd) printf
+	then && local echo "$1" printf -eu | export readonly echo "$1"
+		"$@" sed readonly 'quoted text' ${HOME} grep /usr/bin && done ${HOME}
+		"$1" local 2>/dev/null then && "$@" readonly "$@" "$1" done readonly 'quoted text'
+	local export local test sed | awk "$@" -eu readonly 2>/dev/null
+readonly ${HOME} "$@" done x=1 'quoted text'
+	2>/dev/null grep printf -eu sed /usr/bin
+		| done local cd grep test "$1" && x=1 printf done | grep 'quoted text'
+"$@" /usr/bin local "$1" --verbose cd printf -eu x=1 grep sed export
+		printf export local export export done --verbose $(pwd) "$1"
+	$(pwd) ${HOME} --verbose
+	echo echo && $(pwd) echo x=1 $(pwd) sed ${HOME} -eu /usr/bin printf
+/usr/bin && | local ${HOME} printf
+	export "$@" export cd | local "$@" done
+		sed x=1 export test "$@"
+		/usr/bin cd | "$@" "$@" then done 2>/dev/null local export /usr/bin printf
+	test "$@" $(pwd) "$@" ${HOME}
+	"$@" export "$@" export cd cd
+	/usr/bin awk then grep done $(pwd)
+	2>/dev/null 'quoted text' test --verbose
+test /usr/bin grep -eu then then -eu readonly printf printf local /usr/bin
+		/usr/bin | test done test cd 'quoted text' grep then 2>/dev/null
+		${HOME} cd "$@" then /usr/bin export 2>/dev/null
+		| /usr/bin awk -eu | local | local "$1" printf grep -eu grep
+		/usr/bin local 2>/dev/null --verbose
+	"$1" test printf local readonly cd echo sed printf then local
+2>/dev/null then && local x=1 export local echo then export export ${HOME}
+	"$1" export | echo grep cd "$@" then -eu
+	local -eu export "$1" cd x=1 grep ${HOME} ${HOME} "$1" cd && ${HOME} readonly
+awk "$1" "$@" ${HOME} test | ${HOME} export && awk local "$1" /usr/bin grep echo
+sed sed printf $(pwd) export test awk x=1 grep | awk --verbose --verbose
+		awk test echo local cd --verbose done test then /usr/bin
+	| readonly printf -eu ${HOME}
+	'quoted text' --verbose ${HOME} readonly | x=1 /usr/bin export printf
+--verbose readonly 2>/dev/null $(pwd) "$1" "$1" grep export -eu cd export
+$(pwd) ${HOME} then $(pwd) --verbose && -eu test -eu
+printf readonly --verbose -eu export awk grep
+	readonly 2>/dev/null test grep 'quoted text' local "$@"
+		"$1" test x=1 readonly echo done readonly
+	"$@" sed | && export test done printf then test local ${HOME} x=1 grep &&
+		${HOME} local $(pwd) && local "$@" "$@"
+		printf awk 'quoted text' grep -eu
+		"$1" 'quoted text' "$@" echo
+		--verbose "$1" grep readonly then
+'quoted text' awk awk sed echo x=1 cd ${HOME}
+	${HOME} grep && grep sed && --verbose printf test /usr/bin done "$1" ${HOME}
+	--verbose ${HOME} -eu sed then grep readonly --verbose "$1" ${HOME}
+grep grep echo awk "$@" sed 'quoted text' grep done 'quoted text'
+/usr/bin x=1 done "$1" test | 2>/dev/null
+local | "$1" -eu then test x=1
+	--verbose | then ${HOME} "$@" printf done "$1" --verbose -eu readonly test test
+		'quoted text' 2>/dev/null then readonly
+test done test "$1" cd ${HOME} grep sed test "$@" local local "$@" echo awk export
+	local then then "$1" "$1" then export $(pwd) "$@" echo 'quoted text'
+		${HOME} local --verbose --verbose "$1" done 2>/dev/null then &&
+sed | readonly | cd --verbose echo ${HOME} | grep cd $(pwd) awk test
+		test 2>/dev/null 'quoted text' local local done | /usr/bin echo then local
+${HOME} 'quoted text' sed done grep test done done grep /usr/bin
+export export -eu x=1 $(pwd) test | cd 'quoted text' &&
+local 'quoted text' test && 2>/dev/null 'quoted text'
+export ${HOME} sed 'quoted text' |
+'quoted text' /usr/bin
+	echo done then local 2>/dev/null -eu x=1 then | --verbose
+		-eu done local | then "$1" test then "$@" then
+		sed done readonly printf 'quoted text' "$1" $(pwd) local
+	printf /usr/bin -eu 2>/dev/null -eu --verbose sed ${HOME}
+${HOME} cd /usr/bin 2>/dev/null echo --verbose local awk export echo
+awk /usr/bin 'quoted text' $(pwd) printf | && test $(pwd)
+	--verbose test --verbose printf "$@" ${HOME} "$@" echo ${HOME} then local ${HOME}
+	"$@" printf printf local /usr/bin && "$@" ${HOME} $(pwd)
+readonly -eu "$1" export x=1 ${HOME} ${HOME} "$1" awk then cd done then test
+	export printf grep --verbose 'quoted text' 2>/dev/null
+		"$1" "$1" ${HOME} -eu && "$@" then | 'quoted text' "$@" export readonly
+		2>/dev/null done printf test 2>/dev/null
+	2>/dev/null export $(pwd) done | cd -eu $(pwd) /usr/bin sed
+		/usr/bin cd x=1 -eu readonly
+		local "$1" grep printf -eu $(pwd) --verbose
+		x=1 && test export "$1" export 2>/dev/null x=1 /usr/bin
+		printf awk cd echo "$@" echo readonly done echo "$@" done sed cd -eu 'quoted text'
+test echo awk echo /usr/bin 2>/dev/null
+	"$@" 'quoted text' --verbose | "$@"
+	grep cd --verbose grep "$1" "$@" $(pwd) --verbose --verbose export
+x=1 --verbose then export grep
+		local sed local 2>/dev/null readonly local cd "$1" readonly x=1
+	--verbose echo ${HOME} "$@" local 'quoted text'
+| | sed local test "$@" echo
+	export sed && ${HOME} && | grep /usr/bin --verbose test grep grep done ${HOME} --verbose
+		awk export done ${HOME} then grep 'quoted text' awk
+'quoted text' printf local 'quoted text' done test then 'quoted text'
+		-eu && done 2>/dev/null /usr/bin cd awk && | export
+	${HOME} "$1" /usr/bin readonly printf "$1" 'quoted text'
+/usr/bin export $(pwd) 2>/dev/null cd "$1" printf test "$1" ${HOME}
+		"$@" /usr/bin printf done readonly echo /usr/bin && 'quoted text'
+echo echo && ${HOME} -eu && "$@" grep | 2>/dev/null "$@"
+2>/dev/null local sed && cd local "$@" | /usr/bin readonly then
+--verbose -eu printf x=1 x=1 x=1
+		awk && 'quoted text' 2>/dev/null 2>/dev/null 'quoted text'
+	--verbose /usr/bin then
+--verbose local && ${HOME} done sed readonly $(pwd) export
+awk done --verbose cd x=1 /usr/bin
+echo && && x=1 -eu test readonly local -eu printf "$1" ${HOME} cd
+		printf sed grep -eu echo && grep sed done -eu /usr/bin
+		--verbose awk grep 2>/dev/null readonly
+done && local readonly local sed done && printf -eu export
+		test $(pwd) grep then 2>/dev/null readonly test "$@" cd awk
+	"$1" done x=1 -eu ${HOME} && echo
+echo "$1" echo cd 'quoted text' | ${HOME}
+	then readonly test sed then echo readonly echo test
+	local "$@" /usr/bin export readonly
+echo echo done "$@" grep sed echo /usr/bin test cd "$1" "$1" 2>/dev/null
+		printf local 'quoted text' cd /usr/bin printf 2>/dev/null
+grep $(pwd) cd | -eu test "$@" done done echo "$1"
+local grep x=1 /usr/bin readonly then then $(pwd) then local /usr/bin --verbose
+	'quoted text' awk && echo printf ${HOME} 2>/dev/null
+		"$1" && -eu local readonly
+		echo then echo 'quoted text'
+grep -eu printf x=1 cd readonly readonly
+x=1 printf sed $(pwd) | then readonly then sed awk export local printf $(pwd)
+		${HOME} then then "$1" $(pwd) grep grep awk
+		awk sed 2>/dev/null -eu done ${HOME} printf
+		| x=1 "$1" 'quoted text' 'quoted text' local
+	cd "$@" local x=1 --verbose 2>/dev/null test
+	local sed -eu --verbose cd sed done --verbose "$@"
+	export then sed -eu -eu export 'quoted text'
+		awk printf printf $(pwd) local --verbose --verbose local "$1" -eu /usr/bin 2>/dev/null
+	done --verbose x=1 -eu --verbose local &&
+sed && /usr/bin awk 'quoted text' | sed --verbose
+		test readonly cd sed --verbose "$1" done grep "$@" echo then -eu $(pwd) grep
+test printf echo readonly 2>/dev/null
+"$1" 'quoted text' ${HOME} && awk
+	2>/dev/null -eu local "$1" "$1" awk ${HOME} done
+	"$1" export ${HOME} --verbose -eu --verbose sed $(pwd) grep grep 'quoted text'
+		local then --verbose 'quoted text' echo /usr/bin printf "$1" x=1 ${HOME} 'quoted text'
+x=1 export sed 2>/dev/null
+-eu printf local --verbose then printf readonly
+	/usr/bin --verbose awk local
+	local ${HOME} readonly done sed 2>/dev/null
+	local ${HOME} echo local export x=1 printf readonly "$@" /usr/bin
+	cd 2>/dev/null then printf export x=1 /usr/bin export
+		$(pwd) cd 'quoted text' $(pwd) local sed export
+	"$1" | printf | then | "$@" export awk sed done 2>/dev/null /usr/bin
+awk | local grep echo 'quoted text' ${HOME} ${HOME} x=1 test awk export 'quoted text'
+	| echo sed printf && "$1" 2>/dev/null 2>/dev/null local x=1 awk done "$1"
+		x=1 awk export ${HOME} done printf echo grep x=1
+export readonly awk x=1 printf $(pwd) "$@" && then awk
+		local cd local export readonly
+		done -eu 'quoted text' local /usr/bin "$1" done grep ${HOME}
+	${HOME} ${HOME} sed "$@" then readonly echo && -eu x=1 "$1" "$1"
+test printf $(pwd) 2>/dev/null --verbose && done
+printf $(pwd) awk export 2>/dev/null $(pwd) "$1"
+		&& /usr/bin readonly echo then "$@"
+	echo done done sed "$@" x=1 | && -eu done export sed then x=1 printf
+export x=1 cd cd grep -eu -eu cd awk $(pwd) /usr/bin -eu echo sed readonly &&
+	then "$1" && done sed ${HOME} sed -eu x=1 echo echo readonly && grep done local
+grep && /usr/bin printf | $(pwd) $(pwd) --verbose awk sed -eu local
+		then cd ${HOME} export x=1 echo then "$1" ${HOME}
+'quoted text' done && sed printf local done -eu ${HOME} export sed sed
+$(pwd) awk "$@" printf cd sed cd printf
+		cd -eu awk && "$1" echo readonly 'quoted text' sed $(pwd) && "$@"
+local then 2>/dev/null grep
+test 'quoted text' ${HOME} $(pwd) export
+&& /usr/bin export echo "$1" ${HOME} && export
+--verbose | 2>/dev/null then "$@" cd test sed echo
+sed -eu "$1" && local readonly readonly export done x=1 echo export
+&& sed grep "$1" $(pwd) && "$@" sed printf then
+		sed 'quoted text' -eu local ${HOME} /usr/bin
+cd local printf /usr/bin test test
+	cd -eu readonly | test 'quoted text'
+echo 2>/dev/null echo | awk awk && x=1 readonly /usr/bin
+echo test x=1 then sed done echo test printf &&
+	| then $(pwd) export awk "$@" x=1 2>/dev/null grep test then ${HOME}
+echo "$1" "$1" echo "$1" done /usr/bin $(pwd) awk printf "$@" test | x=1 --verbose
+2>/dev/null echo echo "$@" readonly x=1 done | -eu cd grep
+		| $(pwd) "$@" 'quoted text' 'quoted text' ${HOME} "$1" x=1
+		local -eu $(pwd) $(pwd) grep x=1 && test 'quoted text'
+		"$1" $(pwd) 'quoted text' readonly ${HOME} printf -eu grep awk sed --verbose
+local --verbose x=1 | export
+	/usr/bin export printf then cd then "$@" ${HOME} && $(pwd) | && readonly
+		cd "$@" done readonly awk /usr/bin /usr/bin grep grep $(pwd) printf test $(pwd)
+	"$1" export sed test echo
+	-eu && "$1" x=1 "$1" awk /usr/bin echo && ${HOME} | grep x=1
+		--verbose local /usr/bin 2>/dev/null cd grep export echo readonly
+	printf -eu readonly | grep sed | echo "$1" ${HOME} awk printf printf /usr/bin
+	readonly awk export awk printf sed 2>/dev/null
+	echo | echo cd awk grep awk then echo test && export sed export
+cd x=1 echo ${HOME} test sed cd "$1" awk readonly && sed
+	&& printf --verbose && ${HOME} $(pwd)
+x=1 cd ${HOME} "$@" "$1" grep echo 'quoted text' grep cd grep
+		done --verbose -eu sed "$@" ${HOME} cd -eu &&
+readonly done | -eu ${HOME} x=1 cd 2>/dev/null readonly 'quoted text'
+x=1 then && 'quoted text' awk export 'quoted text' then cd x=1 cd grep x=1 |
+	x=1 test && cd sed echo echo | &&
+		x=1 echo then | printf printf ${HOME} echo printf done /usr/bin -eu
+done "$1" done "$@" --verbose x=1 readonly then local 2>/dev/null /usr/bin
+	readonly test echo readonly 2>/dev/null
+$(pwd) cd grep grep 'quoted text' $(pwd) ${HOME}
+		export grep test $(pwd) 'quoted text' && "$@" export /usr/bin
+sed test -eu x=1 printf "$@" echo /usr/bin /usr/bin 'quoted text'
+		local 'quoted text' 'quoted text' 2>/dev/null "$@" 2>/dev/null "$1" "$@" "$1" echo
+		x=1 "$@" -eu /usr/bin awk $(pwd) $(pwd) readonly 'quoted text' grep done
+done x=1 test cd "$1" -eu -eu awk $(pwd)
+/usr/bin awk 2>/dev/null ${HOME} 'quoted text' then done local local 2>/dev/null
+		/usr/bin sed export x=1 -eu /usr/bin then --verbose
+awk $(pwd) local sed local then readonly 'quoted text' && && 'quoted text'
+		echo x=1 -eu --verbose 2>/dev/null 2>/dev/null done
+then 'quoted text' 2>/dev/null test ${HOME} local then local | printf &&
+done "$1" sed --verbose
+${HOME} printf --verbose $(pwd) test
+		&& --verbose 2>/dev/null ${HOME} x=1 grep test then --verbose $(pwd)
+		test "$1" grep export done /usr/bin
+		&& "$1" readonly then "$@"
+	-eu "$1" /usr/bin "$@" && printf &&
+	sed test "$@" then 2>/dev/null grep echo ${HOME} "$@" "$1" local "$@" readonly test
+readonly | local then 'quoted text' export && printf 'quoted text'
+	'quoted text' awk "$1" $(pwd) x=1 && | test readonly sed "$@" "$1" echo | export
+	done readonly ${HOME} echo /usr/bin
+		"$1" 'quoted text' "$@" | done
+		echo -eu 2>/dev/null 2>/dev/null awk 'quoted text' then grep printf
+		/usr/bin local "$@" /usr/bin && 'quoted text'
+		/usr/bin test /usr/bin echo local ${HOME} grep then -eu sed && local
+$(pwd) "$1" $(pwd) cd $(pwd) echo test grep readonly then
+	test export export "$1" cd test cd 'quoted text' ${HOME}
+	2>/dev/null export x=1 2>/dev/null
+local -eu awk $(pwd) x=1 x=1 awk
+	done "$@" 2>/dev/null /usr/bin grep | $(pwd) x=1 done x=1 && export
+	printf test printf -eu awk "$@" && &&
+	x=1 cd x=1 printf -eu "$1" 'quoted text' grep ${HOME} echo export local "$1" test
+		-eu --verbose 'quoted text' --verbose printf grep then cd awk readonly
+	then 'quoted text' export awk "$@" -eu printf 2>/dev/null --verbose
+&& sed 2>/dev/null "$1" printf
+	readonly then | /usr/bin export sed then test $(pwd) cd export ${HOME} "$1" /usr/bin
+		test | export readonly /usr/bin "$1" -eu $(pwd) then && done sed readonly
+	x=1 local cd awk sed /usr/bin $(pwd) echo
+		-eu sed printf 'quoted text' readonly sed ${HOME} sed && awk then | $(pwd) export
+		-eu done /usr/bin /usr/bin x=1 test && awk /usr/bin sed awk -eu done 'quoted text'
+		readonly "$@" done printf local --verbose | cd --verbose then
+"$@" ${HOME} test "$@" 'quoted text' "$1" cd | cd
+readonly /usr/bin printf --verbose "$1" --verbose "$@" /usr/bin -eu 'quoted text'
+	| done readonly --verbose "$1" /usr/bin "$1" && then "$@" $(pwd) awk done "$@"
+		sed then export "$1" --verbose export awk x=1 ${HOME} --verbose && printf then --verbose
+	$(pwd) | ${HOME} 2>/dev/null export local cd awk awk cd done 'quoted text'
+	&& -eu "$1" | "$@" cd 2>/dev/null "$1" echo grep
+		"$@" 2>/dev/null awk echo awk cd
+	cd /usr/bin awk x=1 grep
+done -eu 'quoted text' awk --verbose awk test "$1" ${HOME}
+	2>/dev/null "$@" test x=1 --verbose 2>/dev/null
+done echo ${HOME} ${HOME} grep printf done awk --verbose export
+export export then grep export
+printf echo export awk | "$1" export 'quoted text'
+	then done -eu awk ${HOME} "$@" | | /usr/bin
+		done echo grep export sed then "$@" readonly awk local x=1 awk then local
+awk grep ${HOME} --verbose ${HOME} grep
+	'quoted text' x=1 --verbose "$1"
+	readonly then printf echo && cd 'quoted text' && /usr/bin "$1" printf "$1" | export
+&& local printf && 2>/dev/null && done then
+		awk | -eu then 2>/dev/null
+		x=1 | sed local export
+		sed done "$@" 'quoted text'
+		sed test then sed cd ${HOME} "$@"
+		--verbose test x=1 "$@" awk --verbose ${HOME} x=1
+	cd printf awk awk 2>/dev/null echo /usr/bin $(pwd) -eu grep --verbose export
+		printf sed -eu 'quoted text' | awk 'quoted text' readonly grep | /usr/bin
+		$(pwd) ${HOME} | grep "$1" export printf sed
+		cd 'quoted text' --verbose
+done -eu --verbose /usr/bin ${HOME} $(pwd) "$@" $(pwd) "$@"
+		2>/dev/null then x=1 export | "$@" local done x=1 ${HOME} | done
+		echo cd done sed sed && test 2>/dev/null -eu ${HOME} test then --verbose
+then ${HOME} sed grep readonly "$1" readonly | echo "$1"
+		sed --verbose sed sed test printf
+		readonly 'quoted text' "$@" ${HOME}
+printf 'quoted text' "$1" local done done /usr/bin --verbose local awk x=1
+		cd --verbose local grep printf export
+sed cd done ${HOME} grep 2>/dev/null -eu ${HOME}
+'quoted text' test 'quoted text' "$1" cd awk then awk test readonly -eu readonly
+		test sed x=1 2>/dev/null $(pwd) sed x=1 "$@" /usr/bin x=1 "$@"
+	awk echo "$1" -eu --verbose
+	sed | 'quoted text' test export x=1 /usr/bin | test echo
+		test 'quoted text' x=1 "$@" then grep &&
+		| "$1" local done "$@" sed then done done echo readonly 'quoted text'
+awk cd -eu readonly export -eu sed
+"$@" printf ${HOME} -eu $(pwd) grep "$1" sed grep awk readonly "$@" grep then test
+-eu ${HOME} "$@" done && 'quoted text' -eu export "$@"
+done | export awk -eu 2>/dev/null && $(pwd) x=1 readonly ${HOME}
+	then then printf awk export | done export 'quoted text' x=1 "$@" $(pwd)
+	2>/dev/null echo test 2>/dev/null $(pwd) | "$1" "$@" $(pwd) | test readonly done
+	"$1" && --verbose test then
+	"$@" export echo cd then test done $(pwd)
+		readonly && readonly | awk done && ${HOME} 2>/dev/null
+2>/dev/null export printf awk grep then x=1 /usr/bin x=1 test done "$@" --verbose
+readonly --verbose --verbose echo then awk --verbose
+		cd done sed grep "$1" --verbose $(pwd) && grep
+		local --verbose export cd readonly local | -eu /usr/bin /usr/bin
+		then | 'quoted text' -eu $(pwd) echo echo awk cd readonly then | "$1"
+	--verbose test && /usr/bin
+then cd /usr/bin /usr/bin x=1 x=1 done
+		2>/dev/null test cd cd printf $(pwd)
+readonly then "$@" 'quoted text'
+		test awk grep local && "$1" x=1 readonly export done 2>/dev/null grep
+	x=1 ${HOME} grep cd readonly /usr/bin cd export
+2>/dev/null readonly printf "$1" echo 'quoted text'
+-eu "$@" grep --verbose "$@" export | readonly
+readonly -eu sed "$1" awk -eu
+test cd "$@" ${HOME} --verbose
+	export cd 2>/dev/null "$1" echo "$@"
+		grep -eu awk done grep ${HOME} $(pwd) sed && ${HOME} x=1 'quoted text' sed
+	2>/dev/null "$1" test readonly echo cd done && export "$@" "$1" export $(pwd)
+then printf -eu "$@" 'quoted text'
+then then && sed -eu readonly "$1" then done x=1 x=1
+	-eu x=1 --verbose 'quoted text' 'quoted text'
+	"$1" 2>/dev/null printf "$1"
+	printf then test local readonly
+printf then && sed then export ${HOME} "$1" --verbose x=1 sed --verbose
+	-eu grep test cd x=1 x=1 test local
+		printf readonly --verbose "$1" awk export readonly export 'quoted text'
+printf "$@" echo printf | "$1" && 'quoted text'
+-eu x=1 --verbose 'quoted text' grep x=1 "$1" printf cd "$@" grep /usr/bin
+	printf done grep $(pwd) | && sed then printf "$1" sed export 'quoted text' |
+done export cd local && echo && "$@" /usr/bin 'quoted text'
+		&& -eu | 'quoted text' $(pwd) /usr/bin done grep done -eu /usr/bin "$1"
+		export printf "$1" 2>/dev/null
+		/usr/bin cd test printf test then && | --verbose
+		--verbose readonly --verbose 'quoted text'
+export ${HOME} "$@" test | $(pwd) local ${HOME} cd local
+2>/dev/null echo "$1" grep "$1" test 'quoted text'
+readonly awk --verbose grep test
+export cd x=1 local test local x=1 --verbose then
+	export | ${HOME} $(pwd) local then 2>/dev/null test /usr/bin awk 'quoted text'
+	export && | "$1" test 'quoted text'
+		x=1 grep readonly --verbose | $(pwd) /usr/bin
+export local 2>/dev/null printf grep done export then test /usr/bin printf local
+		2>/dev/null && "$1" $(pwd) x=1 -eu echo "$@" cd export printf test export $(pwd)
+	| --verbose "$1" "$1" --verbose -eu export cd export export --verbose
+	done awk awk sed grep "$@" sed --verbose grep local export awk && test local
+${HOME} export $(pwd) echo awk export then test grep grep $(pwd) | then ${HOME}
+	test awk 'quoted text' ${HOME} awk echo /usr/bin echo | "$1" 2>/dev/null
+test ${HOME} && grep test "$@" /usr/bin /usr/bin grep grep test local readonly
+		| cd awk export local | test x=1 done
+grep --verbose "$1" echo grep ${HOME} 'quoted text' 'quoted text' "$@" 'quoted text'
+awk awk "$1" sed cd grep readonly x=1 x=1 -eu grep local
+		${HOME} test test sed x=1 2>/dev/null x=1 $(pwd) done
+	then x=1 awk then echo test done $(pwd) printf printf 'quoted text'
+done sed 'quoted text' then test 2>/dev/null
+		cd local $(pwd) && sed && cd export --verbose && "$@" x=1 local done grep awk
+grep export 'quoted text' "$@" printf 2>/dev/null then | export -eu
+	'quoted text' "$1" done sed cd ${HOME} ${HOME} echo -eu then local done readonly
+printf readonly grep export 'quoted text' -eu export ${HOME}
+x=1 "$1" 2>/dev/null then export printf -eu local
+	local export x=1 test grep printf
+		grep test grep awk readonly printf && | then /usr/bin x=1 echo printf
+	test awk 'quoted text' awk && echo
+		"$1" 2>/dev/null -eu && export test | ${HOME} echo /usr/bin
+${HOME} awk cd grep 'quoted text'
+	then cd awk | then ${HOME} done export && export
+'quoted text' cd grep "$@"
+		"$@" cd awk /usr/bin "$1" $(pwd) sed -eu readonly
+x=1 | readonly $(pwd) -eu /usr/bin sed awk "$@" x=1 --verbose /usr/bin
+	local readonly /usr/bin awk sed | --verbose -eu 2>/dev/null --verbose
+		cd export /usr/bin done
+	/usr/bin && ${HOME} awk --verbose export
+		local local cd | ${HOME} echo export x=1 grep
+then then readonly 2>/dev/null
+	test sed cd grep done ${HOME} "$@" grep
+printf /usr/bin done | --verbose test awk /usr/bin /usr/bin
+	"$1" export cd 'quoted text'
+'quoted text' --verbose echo
+cd done sed readonly awk 'quoted text'
+		x=1 sed test 'quoted text' local 'quoted text' 2>/dev/null echo "$1" && -eu export
+		"$1" then grep /usr/bin then ${HOME} ${HOME} sed then && sed awk
+		readonly ${HOME} grep export echo then |
+	then then echo export x=1 sed ${HOME} readonly cd awk export "$@" --verbose
+cd 'quoted text' then "$1" local readonly readonly "$@" then
+${HOME} cd export cd awk grep printf sed export
+	'quoted text' "$@" local "$@" /usr/bin grep x=1 ${HOME}
+| 2>/dev/null local printf readonly sed done then echo | 'quoted text'
+		printf local $(pwd) grep $(pwd) -eu grep 2>/dev/null
+	echo readonly /usr/bin && 'quoted text' then -eu readonly
+	| printf 2>/dev/null && | echo echo
+	| -eu sed --verbose x=1 readonly then | grep done
+		echo 2>/dev/null 2>/dev/null awk --verbose export cd done -eu 'quoted text'
+		sed 'quoted text' $(pwd) && $(pwd) printf --verbose
+	/usr/bin "$1" x=1 && printf
+		/usr/bin /usr/bin grep awk test echo
+${HOME} sed awk printf readonly sed export export "$@" -eu sed
+	/usr/bin ${HOME} --verbose printf "$1" ${HOME} awk awk awk -eu then --verbose
+	'quoted text' 'quoted text' readonly
+	-eu /usr/bin 2>/dev/null x=1 printf
+	echo ${HOME} test then 'quoted text'
+	test cd cd ${HOME} local grep grep x=1 "$@" grep
+		$(pwd) -eu grep readonly
+	-eu ${HOME} /usr/bin
+/usr/bin && then $(pwd) awk test export done done sed local
+		x=1 test x=1 test echo readonly --verbose --verbose sed -eu ${HOME}
+		grep -eu test x=1 local 'quoted text' "$@" export local
+2>/dev/null export 2>/dev/null then x=1 export grep 2>/dev/null
+		printf --verbose done grep --verbose readonly x=1 sed
+	--verbose $(pwd) then readonly $(pwd) 2>/dev/null $(pwd) ${HOME} grep printf
+		echo -eu grep sed x=1 x=1 export /usr/bin readonly export test then ${HOME} export
+	--verbose | $(pwd) 2>/dev/null
+		&& local sed "$1" then --verbose test /usr/bin echo "$@" /usr/bin
+		sed --verbose export $(pwd) readonly
+export readonly readonly -eu "$@" printf "$@"
+		"$1" 'quoted text' echo && 'quoted text' 2>/dev/null
+		awk sed 'quoted text' echo done export
+		-eu echo | then $(pwd) local x=1 then awk ${HOME} sed
+		sed /usr/bin awk then -eu && x=1
+		2>/dev/null awk export grep awk && grep cd cd $(pwd)
+awk done test 2>/dev/null test x=1 awk 2>/dev/null x=1 | local "$1" local
+	'quoted text' printf test then printf ${HOME}
+		printf "$1" -eu grep then x=1 local ${HOME} "$@"
+		readonly cd test done awk export readonly awk readonly local grep ${HOME}
+	&& && "$1" -eu local then echo --verbose
+	| awk 'quoted text' done sed -eu test
+		done done ${HOME} | 2>/dev/null readonly cd --verbose && "$@" readonly
+		2>/dev/null done awk cd --verbose 2>/dev/null
+		-eu echo cd 'quoted text' --verbose echo grep
+	test cd done $(pwd) $(pwd) -eu done --verbose sed test ${HOME}
+	local "$1" 'quoted text'
+		"$1" $(pwd) grep test local echo sed && --verbose | test | -eu
+| printf x=1 test 'quoted text' "$1" -eu --verbose
+local sed then printf x=1 grep && echo 2>/dev/null cd then echo 'quoted text'
+		"$@" x=1 /usr/bin "$@" x=1 sed 'quoted text'
+	printf local grep "$@" && /usr/bin echo readonly test
+	-eu local cd -eu ${HOME} awk readonly awk done awk "$1" 'quoted text'
+sed --verbose -eu export
+	x=1 sed echo --verbose export printf | "$@" 'quoted text' --verbose
+"$@" cd x=1 grep x=1
+		sed | x=1 -eu sed cd then grep && &&
+#include c163.sh
+local x=1 test local readonly sed | "$1" awk $(pwd) "$1"
+--verbose cd done x=1 ${HOME} x=1 2>/dev/null
+	then readonly readonly 2>/dev/null | --verbose "$@" sed cd -eu "$1"
+--verbose x=1 "$@" local echo ${HOME} then 2>/dev/null /usr/bin && --verbose "$@"
+		/usr/bin then && && && && then 'quoted text'
+printf && 'quoted text' echo sed export awk export
+--verbose export grep done then done grep test awk && "$@" --verbose
+		export --verbose x=1 export | 'quoted text' cd 'quoted text' $(pwd)
+		--verbose readonly echo x=1 $(pwd)
+&& local && 'quoted text' | --verbose
+--verbose -eu readonly test /usr/bin "$@" awk --verbose done export
+	test ${HOME} test local local sed readonly done cd
+		grep --verbose then done local
+then && export test 'quoted text' cd "$@" | 'quoted text' sed x=1
+		${HOME} grep "$1" | test echo
+	-eu $(pwd) 'quoted text' sed && && $(pwd) done
+cd local 2>/dev/null printf test ${HOME} printf $(pwd) 2>/dev/null sed then done
+done printf -eu local done readonly $(pwd) x=1 echo | ${HOME} sed
+		local x=1 grep echo && echo $(pwd) done $(pwd) echo --verbose --verbose /usr/bin
+		x=1 local awk && local "$1" "$1" -eu 'quoted text'
+	$(pwd) --verbose | 2>/dev/null local 'quoted text' --verbose
+	readonly awk done grep awk
+${HOME} sed test echo $(pwd) local &&
+2>/dev/null then $(pwd) readonly 2>/dev/null
+-eu && done | -eu sed echo x=1 $(pwd) 2>/dev/null local "$1" | "$@"
+printf -eu "$1" ${HOME} awk $(pwd) 2>/dev/null $(pwd) local test $(pwd)
+--verbose && 2>/dev/null sed
+	test awk awk export local "$@" $(pwd) && --verbose
+		$(pwd) grep | 'quoted text'
+cd "$1" export cd awk "$@" "$@" grep -eu test local echo "$1" $(pwd) /usr/bin
+	local "$1" /usr/bin export
+		sed grep $(pwd) sed awk "$1" echo awk ${HOME} sed && -eu sed export sed test 'quoted text'
+		-eu "$@" && local local "$@" 'quoted text' awk test /usr/bin cd /usr/bin
+	'quoted text' cd --verbose --verbose printf --verbose
+	/usr/bin echo "$@" --verbose -eu test done "$1" --verbose
+cd awk local /usr/bin done -eu readonly 'quoted text' echo -eu "$1" 2>/dev/null
+	x=1 'quoted text' && && readonly "$1" x=1 readonly then
+	'quoted text' "$1" export local && export x=1 export -eu -eu then done
+		${HOME} 2>/dev/null "$@"
+		${HOME} printf done ${HOME} readonly /usr/bin
+	then ${HOME} printf ${HOME} /usr/bin local
+		done && export -eu x=1 -eu sed then $(pwd)
+	then 'quoted text' awk local "$@" export local cd printf ${HOME} -eu x=1
+	"$1" then x=1 grep test done &&
+readonly awk test readonly sed -eu -eu export
+local readonly $(pwd) 'quoted text'
+		export test && then --verbose
+		local $(pwd) x=1 $(pwd) cd --verbose test grep | && printf sed then cd
+		awk export export cd /usr/bin printf local /usr/bin done echo
+${HOME} test local local
+	then 2>/dev/null sed "$1" awk done x=1 grep cd | readonly
+		awk awk echo cd -eu printf awk
+		x=1 awk grep grep printf sed readonly local cd cd && x=1 && -eu "$@" awk export
+		export | -eu then --verbose sed 'quoted text' grep echo ${HOME}
+	export then awk cd && awk ${HOME} --verbose "$@" echo then
+	cd printf readonly ${HOME} "$@" "$1"
+	done done then readonly done
+		"$@" done ${HOME} local test "$@" echo awk test ${HOME} ${HOME} -eu /usr/bin
+	"$@" echo 2>/dev/null 2>/dev/null /usr/bin 2>/dev/null
+		x=1 grep printf echo
+readonly "$@" echo | done -eu printf ${HOME} /usr/bin export
+then 'quoted text' grep
+2>/dev/null "$@" export export cd 'quoted text' x=1 x=1 printf -eu
+printf local done echo 'quoted text' -eu
+		awk 'quoted text' && --verbose --verbose readonly
+		"$1" echo sed readonly /usr/bin then
+2>/dev/null readonly awk test grep grep then export readonly 'quoted text' sed then
+	awk sed ${HOME} x=1 $(pwd) local grep echo 'quoted text'
+	| local --verbose echo grep sed grep echo -eu "$1" "$1" && 2>/dev/null
+		readonly local "$@" 2>/dev/null echo readonly x=1 echo && ${HOME}
+export cd 'quoted text' "$1" sed printf cd
+2>/dev/null "$@" ${HOME} export grep "$@" | && readonly echo
+	awk && echo echo 'quoted text' ${HOME} x=1
+	$(pwd) printf echo readonly ${HOME}
+cd 2>/dev/null awk | x=1 2>/dev/null sed cd printf cd "$@" grep && 2>/dev/null
+		done "$@" "$@" echo done
+	printf --verbose export then 'quoted text'
+	local "$1" test export cd awk awk cd export -eu test grep "$@"
+	| sed readonly awk -eu 'quoted text' $(pwd) --verbose 2>/dev/null x=1
+	| readonly local local 'quoted text'
+		readonly sed "$@" | sed 2>/dev/null awk cd done printf x=1
+readonly then | then -eu 'quoted text' -eu $(pwd) export | echo local
+		2>/dev/null --verbose echo sed printf | echo ${HOME} echo --verbose -eu $(pwd)
+	| x=1 'quoted text' && done /usr/bin "$1" export $(pwd)
+		"$1" done $(pwd) test local cd printf grep
+$(pwd) && | /usr/bin "$@"
+echo $(pwd) "$@" "$1" 2>/dev/null
+${HOME} /usr/bin printf ${HOME} echo
+&& $(pwd) awk "$@" readonly cd readonly sed ${HOME} readonly cd | -eu
+2>/dev/null sed then cd -eu --verbose "$1" $(pwd) echo readonly
+	"$@" | --verbose grep | "$@" ${HOME}
+	"$1" ${HOME} export 2>/dev/null 'quoted text' export "$@" ${HOME}
+		--verbose /usr/bin then | && printf echo $(pwd) | cd then ${HOME} 2>/dev/null
+	printf local --verbose ${HOME}
+	readonly ${HOME} 'quoted text' /usr/bin x=1 echo $(pwd) test test cd printf done
+/usr/bin local | awk grep ${HOME} "$1" --verbose | echo cd done &&
+	grep --verbose 'quoted text'
+2>/dev/null readonly $(pwd) | --verbose | $(pwd) | awk readonly cd ${HOME} 'quoted text'
+	/usr/bin echo x=1 sed /usr/bin test "$@"
+	"$1" -eu /usr/bin sed "$@"
+	printf echo echo "$@" done -eu ${HOME}
+		"$1" -eu $(pwd) then "$1" -eu readonly test sed echo awk /usr/bin readonly
+/usr/bin | printf 2>/dev/null
+	'quoted text' 2>/dev/null printf -eu 'quoted text' 'quoted text'
+		awk 'quoted text' | $(pwd) | x=1 then 2>/dev/null
+	local && done awk then && x=1 awk export -eu test echo sed /usr/bin readonly
+	&& && -eu echo "$@" 2>/dev/null
+		x=1 | local x=1 ${HOME} awk "$@" awk test echo grep export grep export "$@"
+$(pwd) /usr/bin | -eu then export
+	then awk "$1" readonly x=1 2>/dev/null sed
+		done --verbose && printf --verbose echo cd "$@" /usr/bin printf
+		grep 'quoted text' 'quoted text' 2>/dev/null echo ${HOME} && done export
+		$(pwd) "$@" 2>/dev/null $(pwd)
+	'quoted text' ${HOME} /usr/bin ${HOME} 'quoted text'
+	${HOME} --verbose "$1" awk x=1 && "$@" $(pwd) test
+	test $(pwd) readonly export x=1 local $(pwd) local grep test && printf local
+	$(pwd) readonly ${HOME} && sed local done ${HOME} && | --verbose then /usr/bin 'quoted text'
+		export --verbose 2>/dev/null echo 2>/dev/null grep 'quoted text' 2>/dev/null
+		"$@" $(pwd) && readonly grep && done ${HOME} done -eu /usr/bin
+		$(pwd) cd -eu /usr/bin "$1" sed "$@" cd
+	${HOME} ${HOME} -eu $(pwd) -eu
+awk test "$1" && && && 'quoted text'
+	"$1" then 2>/dev/null test 2>/dev/null -eu then echo
+echo 'quoted text' grep ${HOME} then
+		| "$@" 2>/dev/null 'quoted text' sed "$@" ${HOME}
+	test test | local 'quoted text' export && --verbose /usr/bin sed "$1"
+export 2>/dev/null --verbose "$1" &&
+		sed && export /usr/bin x=1 "$@" readonly echo 'quoted text'
+		/usr/bin x=1 --verbose 'quoted text' test
+-eu export grep ${HOME} 2>/dev/null x=1 -eu echo
+	"$1" cd done sed readonly test && "$1" | x=1 then $(pwd) test echo printf
+	grep done ${HOME} ${HOME} "$1" "$@" "$@" -eu echo
+-eu done $(pwd) then grep done "$@" sed
+	awk ${HOME} done awk grep 2>/dev/null readonly awk | ${HOME} 2>/dev/null
+		cd test && /usr/bin | x=1 done test printf printf
+	$(pwd) local /usr/bin &&
+		local readonly "$@" readonly && /usr/bin grep then "$@" $(pwd)
+	printf export $(pwd) cd
+		local sed -eu --verbose printf then ${HOME} 2>/dev/null test
+${HOME} done sed --verbose --verbose "$1" 2>/dev/null ${HOME} && "$1"
+&& then 2>/dev/null then awk grep then cd && awk
+		-eu && $(pwd) grep printf local echo export test $(pwd)
+		done 'quoted text' /usr/bin export then $(pwd) --verbose -eu -eu | done 'quoted text'
+	x=1 "$@" $(pwd) "$@" local
+	2>/dev/null local -eu -eu "$1" printf readonly test
+	${HOME} sed awk echo /usr/bin 2>/dev/null
+awk && awk "$@" 'quoted text' readonly && grep done ${HOME} printf 2>/dev/null
+		${HOME} x=1 sed then 'quoted text' readonly test cd --verbose test
+	echo echo /usr/bin -eu local sed
+	"$1" done && cd readonly --verbose ${HOME} | $(pwd) cd readonly
+		'quoted text' "$1" echo done
+	readonly cd echo sed export readonly cd then
+$(pwd) "$1" 2>/dev/null test
+	/usr/bin && sed cd cd "$1" then grep
+	printf && $(pwd) export "$@" done $(pwd)
+	cd local /usr/bin 2>/dev/null done done -eu
+	done then | "$1" 2>/dev/null "$1"
+	2>/dev/null then 'quoted text' awk export printf
+sed "$1" test x=1 "$@" export
+		done echo 2>/dev/null export --verbose awk grep cd export
+'quoted text' 2>/dev/null -eu echo done sed readonly ${HOME} --verbose export 'quoted text'
+awk cd printf 2>/dev/null x=1 test ${HOME} /usr/bin done --verbose printf
+		sed grep readonly && then
+	2>/dev/null cd $(pwd) done cd 2>/dev/null echo printf 2>/dev/null done ${HOME}
+	export echo ${HOME} printf ${HOME}
+awk 2>/dev/null ${HOME} readonly done 'quoted text'
+		/usr/bin --verbose x=1 "$@" readonly test 2>/dev/null
+export local export printf
+		cd cd ${HOME} printf --verbose 'quoted text' then "$@"
+&& export $(pwd) | grep sed sed
+-eu ${HOME} sed grep "$1" "$@" "$1" "$@" cd | x=1 readonly ${HOME} "$@" cd
+--verbose -eu readonly |
+sed 2>/dev/null /usr/bin
+	--verbose test | $(pwd) done /usr/bin "$@" test $(pwd)
+		/usr/bin 2>/dev/null readonly | echo | | awk x=1 export then printf then sed printf
+"$@" sed "$@" ${HOME} --verbose
+| then test "$1" x=1 then | then
+&& $(pwd) | export done readonly then
+		printf x=1 grep done test /usr/bin local
+		'quoted text' test ${HOME} test "$@" done
+	echo "$1" done x=1 grep 'quoted text' printf printf x=1 x=1 ${HOME} test ${HOME}
+		"$@" /usr/bin -eu then && readonly
+awk test && --verbose readonly 'quoted text' then
+	&& && echo local readonly
+	echo 'quoted text' done cd $(pwd) 2>/dev/null ${HOME} --verbose "$@"
+		"$1" && awk grep done --verbose
+	grep | ${HOME} && | "$1" done $(pwd)
+"$1" 2>/dev/null && | /usr/bin
+	readonly "$@" -eu sed -eu local "$1" then | test cd x=1
+cd ${HOME} --verbose echo printf x=1 done printf | /usr/bin readonly grep
+| export | local sed readonly export grep "$1" "$1" $(pwd) "$@"
+awk "$1" && sed then echo test cd --verbose -eu echo x=1 /usr/bin sed test
+		"$1" export sed $(pwd) /usr/bin "$@" -eu local local 2>/dev/null
+		2>/dev/null grep | 'quoted text' export | 'quoted text'
+		"$1" 2>/dev/null /usr/bin x=1 cd printf | /usr/bin grep done awk test
+	cd "$1" | grep 2>/dev/null grep local then --verbose x=1
+${HOME} echo export sed | test "$1" local printf && | x=1 -eu && "$1" echo &&
+readonly "$1" cd /usr/bin readonly
+	local printf ${HOME} test echo | sed
+	local 'quoted text' && "$@" printf local echo cd export -eu awk
+x=1 printf -eu -eu ${HOME}
+grep then readonly /usr/bin then printf export -eu done ${HOME} local
+	2>/dev/null sed grep local sed echo echo grep export
+export && export grep $(pwd) grep -eu && --verbose 'quoted text'
+		'quoted text' 2>/dev/null
+$(pwd) 2>/dev/null printf sed | "$@" sed cd grep readonly | printf echo grep
+	done --verbose "$1" cd readonly awk echo "$@"
+	then export grep 'quoted text' cd sed awk printf $(pwd) ${HOME} | 'quoted text'
+	| /usr/bin grep $(pwd) /usr/bin ${HOME} done
+--verbose --verbose 'quoted text' -eu awk /usr/bin -eu grep grep
+		$(pwd) 2>/dev/null then cd cd
+		'quoted text' test x=1 x=1 'quoted text' $(pwd) "$1" echo
+	x=1 cd "$@" done then /usr/bin readonly && 'quoted text' "$1"
+		"$@" cd $(pwd) 'quoted text' | && cd awk echo -eu sed export export cd export
+x=1 /usr/bin /usr/bin local |
+		export -eu awk "$@" cd done
+		'quoted text' && $(pwd) readonly x=1 cd 2>/dev/null &&
+		2>/dev/null done --verbose
+--verbose x=1 test sed 2>/dev/null "$@" test -eu done echo sed then
+		$(pwd) then ${HOME} test done ${HOME} local export done grep awk
+		echo --verbose 2>/dev/null "$1" grep | grep test ${HOME} then printf
+		then printf ${HOME} | then | then readonly grep "$@"
+export "$@" 2>/dev/null done 2>/dev/null ${HOME}
+		cd readonly awk ${HOME} export | ${HOME}
+"$1" test 2>/dev/null |
+	grep printf 'quoted text' then /usr/bin "$@" export local done
+$(pwd) $(pwd) echo $(pwd) x=1 $(pwd) echo x=1 cd 'quoted text'
+		/usr/bin $(pwd) local then 'quoted text' "$@"
+"$@" done test echo done "$1" --verbose /usr/bin grep ${HOME} echo --verbose
+x=1 | 'quoted text' then grep
+--verbose awk awk 'quoted text' done grep test readonly done export
+	x=1 test printf printf done -eu -eu export local readonly
+export readonly ${HOME} "$1" x=1 'quoted text' ${HOME} sed awk
+'quoted text' && 2>/dev/null /usr/bin | cd export readonly sed && sed
+local sed done sed && cd "$@" -eu --verbose
+echo 'quoted text' then -eu sed readonly -eu 'quoted text'
+done 2>/dev/null local echo printf test then x=1 then readonly
+		-eu ${HOME} && /usr/bin "$@" "$@" printf printf printf
+	2>/dev/null done cd | | | done && ${HOME} test grep
+$(pwd) "$@" x=1 done readonly
+	grep x=1 echo 'quoted text' test ${HOME} "$1" sed 'quoted text'
+	awk export && -eu && 2>/dev/null | && 'quoted text'
+		awk readonly echo cd $(pwd) readonly ${HOME} readonly x=1 "$1" grep
+&& local x=1 awk /usr/bin readonly -eu test cd ${HOME} local /usr/bin test done
+		printf x=1 grep | | cd $(pwd) |
+		/usr/bin 'quoted text' cd echo | --verbose $(pwd)
+		local ${HOME} cd "$1" | done export &&
+		$(pwd) /usr/bin local sed sed then awk
+	| -eu printf --verbose ${HOME} grep x=1 echo done && readonly
+export export then "$1"
+		&& grep awk ${HOME} done
+cd ${HOME} echo local
+	printf --verbose done echo 2>/dev/null printf /usr/bin /usr/bin
+		grep then test --verbose "$@" $(pwd) && 2>/dev/null $(pwd) x=1 export local
+	test local sed echo cd 2>/dev/null x=1 2>/dev/null "$1" 'quoted text' "$1"
+		| x=1 printf grep 'quoted text' /usr/bin -eu
+		-eu readonly && x=1 $(pwd) test x=1 readonly "$@" $(pwd) 2>/dev/null --verbose
+		readonly echo | $(pwd) $(pwd) --verbose -eu && test echo export grep export
+printf | 2>/dev/null test test grep echo
+	x=1 ${HOME} printf 'quoted text' | grep --verbose cd done
+	done readonly then --verbose
+		"$1" then printf $(pwd) readonly
+	awk then -eu 'quoted text' awk
+readonly "$@" then 2>/dev/null echo $(pwd) export && grep
+		local "$1" "$@" then -eu awk | then "$@" cd
+	${HOME} grep -eu "$1" /usr/bin
+	2>/dev/null cd grep 2>/dev/null sed x=1 --verbose "$1" awk --verbose
+		export 2>/dev/null then "$@" local then 'quoted text' | cd /usr/bin grep test
+-eu grep $(pwd) -eu grep echo awk 'quoted text' "$@" | echo
+	local awk printf "$@" readonly "$@" 2>/dev/null && --verbose sed
+	| sed && "$1" /usr/bin "$1" | export --verbose | | && "$1" $(pwd)
+		test grep && then printf 2>/dev/null $(pwd) x=1 x=1 'quoted text'
+${HOME} x=1 sed then test | --verbose "$1" && --verbose $(pwd)
+		'quoted text' --verbose 2>/dev/null readonly local grep then $(pwd) "$1" printf
+		$(pwd) local $(pwd) --verbose $(pwd) 'quoted text' /usr/bin && "$1"
+		cd local && x=1 'quoted text' local ${HOME} $(pwd) local sed "$1"
+readonly $(pwd) -eu /usr/bin -eu ${HOME} -eu ${HOME} | readonly
+	/usr/bin --verbose && done grep
+/usr/bin export && x=1 then cd grep 'quoted text' done 2>/dev/null echo
+	$(pwd) $(pwd) | --verbose then readonly 2>/dev/null
+export cd x=1 "$1" cd --verbose local sed done then && 'quoted text' then
+--verbose done --verbose -eu local 2>/dev/null sed /usr/bin
+		grep printf | grep "$@" printf "$@" then awk local --verbose
+		test ${HOME} x=1 test cd ${HOME} | "$@" -eu then "$1" export 2>/dev/null "$@"
+then grep && test cd x=1 "$@" ${HOME} | export 2>/dev/null
+&& then 2>/dev/null awk printf && x=1 cd test
+&& export done echo --verbose
+	2>/dev/null x=1 cd "$1" ${HOME} cd echo $(pwd) readonly
+test local ${HOME} $(pwd)
+		"$1" | test "$@" readonly --verbose done $(pwd) x=1 /usr/bin
+		${HOME} sed readonly --verbose
+	| && printf echo "$@" readonly
+		x=1 2>/dev/null ${HOME} "$@" && grep sed ${HOME}
+		"$1" export -eu awk export "$@" && | "$@" -eu awk
+		export --verbose cd done grep && grep x=1 "$@" 'quoted text' then
+	2>/dev/null readonly local && printf "$@" ${HOME} | local ${HOME}
+	$(pwd) grep export printf | awk readonly
+	$(pwd) local done "$@" $(pwd) awk "$1" "$1" test x=1 sed echo awk
+		$(pwd) export --verbose done echo
+awk -eu -eu | local ${HOME} --verbose echo "$1" "$1"
+local 'quoted text' export ${HOME} -eu /usr/bin 2>/dev/null export --verbose
+		done | readonly printf then printf -eu "$1" printf 'quoted text' -eu | readonly
+		printf echo 2>/dev/null 'quoted text' readonly
+		local 'quoted text' | /usr/bin --verbose
+		"$1" "$@" done 'quoted text' --verbose -eu && && 2>/dev/null done
+	grep echo "$@" sed 'quoted text' 2>/dev/null
+export /usr/bin printf then then done 2>/dev/null
+--verbose export ${HOME} cd ${HOME} --verbose echo /usr/bin 'quoted text'
+test echo "$1" sed "$1" /usr/bin
+	then 'quoted text' | x=1 printf done --verbose sed test "$1"
+| $(pwd) test $(pwd) 'quoted text' grep --verbose
+		readonly sed && /usr/bin
+		"$1" "$@" ${HOME} "$@" -eu echo
+		awk --verbose "$@" done "$@" --verbose "$1" done printf echo | local echo
+	test --verbose done cd "$@" done cd awk echo
+		/usr/bin ${HOME} "$@" 'quoted text' grep && sed sed local -eu test x=1 sed "$@"
+		test "$@" sed then ${HOME} then "$@" test cd sed done printf
+		/usr/bin done --verbose local
+	test $(pwd) export then awk readonly
+awk export local sed printf printf
+		-eu printf cd 2>/dev/null export
+	export 2>/dev/null then test cd awk printf
+	local readonly printf then --verbose echo then cd
+	| export /usr/bin sed export echo "$@" -eu 2>/dev/null | printf sed local "$@"
+		done ${HOME} test ${HOME} $(pwd) cd sed cd ${HOME} /usr/bin
+		x=1 awk | test 2>/dev/null done "$1" grep ${HOME} 2>/dev/null --verbose x=1 2>/dev/null
+printf grep sed "$@" awk 2>/dev/null export printf -eu export
+'quoted text' printf grep export printf sed
+		--verbose echo sed ${HOME} -eu sed "$1"
+| "$1" 'quoted text' done 2>/dev/null awk --verbose
+	grep "$1" | export grep echo readonly x=1 then && then | echo 2>/dev/null
+		--verbose $(pwd) x=1 printf echo x=1 printf readonly x=1 cd $(pwd) sed "$1" | &&
+		echo $(pwd) ${HOME} echo done x=1 printf $(pwd) cd grep /usr/bin
+	printf readonly then awk && 2>/dev/null
+		-eu ${HOME} awk /usr/bin grep $(pwd) -eu "$@" grep awk cd printf sed ${HOME}
+		done 'quoted text' 'quoted text' printf test "$1" test local "$1" awk export
+	local | -eu readonly local && $(pwd) done /usr/bin 2>/dev/null
+	| /usr/bin $(pwd) -eu /usr/bin && then 'quoted text'
+		printf done ${HOME} 'quoted text' cd -eu
+export 2>/dev/null readonly awk ${HOME} ${HOME} printf export echo done
+	export | "$1" && test $(pwd) $(pwd) "$@" sed export -eu 'quoted text'
+		${HOME} done /usr/bin "$@" readonly
+cd local export done test
+	sed test cd | | $(pwd) awk grep export
+		grep sed sed $(pwd) && && && then ${HOME}
+		/usr/bin 2>/dev/null grep done --verbose x=1 printf 2>/dev/null
+		echo x=1 x=1 'quoted text' then
+--verbose "$1" echo /usr/bin echo export x=1 cd 2>/dev/null
+	-eu awk echo local && awk -eu
+		grep x=1 then readonly readonly /usr/bin $(pwd)
+		$(pwd) done readonly $(pwd) --verbose readonly "$1" awk && done x=1 ${HOME}
+		echo -eu awk sed /usr/bin local grep x=1 grep
+	export readonly echo echo cd -eu | grep cd export -eu
+grep --verbose "$1" local echo "$1" |
+		done awk readonly 2>/dev/null && then awk "$1" --verbose then 2>/dev/null &&
+		cd x=1 sed 2>/dev/null && "$1"
+	&& local test done x=1 printf "$1" $(pwd) --verbose
+	grep export 'quoted text' printf && cd awk test test echo 2>/dev/null --verbose
+"$1" export /usr/bin export echo "$@" grep echo "$1" && x=1 "$1"
+printf -eu awk echo export test printf x=1 && && local
+$(pwd) "$1" echo --verbose done export then sed ${HOME} then x=1 && -eu
+		awk grep ${HOME} ${HOME} ${HOME} local printf then 2>/dev/null cd export
+test ${HOME} printf done "$1" export sed echo grep $(pwd) echo && $(pwd) 2>/dev/null
+		${HOME} | x=1 && -eu test sed test x=1 sed local export
+		$(pwd) -eu ${HOME} /usr/bin done $(pwd) "$1" "$@"
+	"$@" readonly grep test $(pwd) sed cd | test printf printf -eu "$1" grep "$1"
+	grep printf export cd grep
+printf $(pwd) $(pwd) export then ${HOME}
+test --verbose 2>/dev/null
+then -eu $(pwd) "$@" export $(pwd) "$1" ${HOME} done echo "$1" sed
+	-eu sed readonly x=1 local $(pwd) ${HOME} echo -eu ${HOME}
+test grep && "$1" "$@" && cd grep "$1" | x=1 "$1" test export
+	2>/dev/null 2>/dev/null
+		local local cd export cd then awk printf && x=1 sed echo 'quoted text'
+		readonly ${HOME} done
+"$@" x=1 /usr/bin -eu cd --verbose --verbose grep x=1
+	"$1" printf x=1 printf printf test
+	local 2>/dev/null | test
+export "$@" 2>/dev/null "$@" test && sed echo --verbose then | done grep && test
+	/usr/bin local export test "$@" -eu && x=1 "$@" $(pwd) "$@" then echo
+| "$1" export "$1" "$@" printf export /usr/bin "$1" export -eu grep &&
+grep $(pwd) --verbose 'quoted text' sed
+		readonly /usr/bin printf /usr/bin x=1 /usr/bin
+| grep grep /usr/bin && &&
+cd ${HOME} "$@" grep x=1 x=1 "$@" echo test awk test
+grep --verbose done | "$1" && echo "$1"
+&& && ${HOME} export x=1 && grep cd printf x=1 done | ${HOME} "$1" awk
+'quoted text' sed printf && ${HOME} local done done x=1 && grep grep done cd
+		/usr/bin local "$@" sed x=1 cd "$@" 2>/dev/null grep echo then echo
+	grep awk 'quoted text' then then "$@" awk "$1" -eu && echo --verbose
+	x=1 ${HOME} awk "$@" printf $(pwd) x=1
+	2>/dev/null sed export /usr/bin sed local --verbose
+		sed 2>/dev/null export export && | /usr/bin awk 2>/dev/null echo "$@"
+		| $(pwd) export --verbose 'quoted text'
+		awk printf 2>/dev/null then /usr/bin echo "$1" grep local done export cd
+	grep x=1 grep done readonly
+		${HOME} readonly x=1 export readonly sed
+		"$@" 2>/dev/null export ${HOME} --verbose done sed x=1 readonly
+	${HOME} /usr/bin x=1 ${HOME} "$1" awk "$@" export "$@" ${HOME} x=1 "$@"
+	export && echo local then
+		test /usr/bin 2>/dev/null grep $(pwd) echo "$@" grep 2>/dev/null local export
+		printf sed x=1 /usr/bin printf readonly "$@" awk
+/usr/bin sed echo sed printf grep awk awk then
+$(pwd) "$@" grep "$@" 2>/dev/null done ${HOME} 2>/dev/null -eu $(pwd)
+	x=1 $(pwd) ${HOME} cd cd readonly
+		grep done /usr/bin "$@" -eu /usr/bin | echo --verbose /usr/bin printf
+		${HOME} test printf $(pwd) /usr/bin x=1 'quoted text' grep 'quoted text'
+	readonly x=1 $(pwd) done
+"$1" 2>/dev/null test /usr/bin printf "$1" /usr/bin x=1 /usr/bin done
+		-eu cd 2>/dev/null | readonly 2>/dev/null "$@" x=1
+done cd | && export x=1 | echo readonly echo
+		readonly -eu local then grep 2>/dev/null
+sed test echo | --verbose "$1" grep /usr/bin export 'quoted text' readonly
+	export "$@" 2>/dev/null test x=1 "$@" -eu --verbose
+"$@" awk export sed then &&
+		x=1 ${HOME} && printf cd "$1" export export done 2>/dev/null ${HOME} /usr/bin
+	2>/dev/null 'quoted text' "$@" cd grep
+	--verbose && done 'quoted text' echo grep
+		readonly local then x=1 done test awk | grep local readonly echo | cd --verbose
+	readonly local cd local
+	$(pwd) 'quoted text' cd grep x=1 test $(pwd) -eu
+	-eu | "$@" printf then "$@" awk awk test sed then printf
+	-eu printf awk 'quoted text' readonly | ${HOME} grep sed
+		echo 2>/dev/null "$1" local --verbose
+		test "$@" echo then test
+	printf 'quoted text' cd readonly && ${HOME} 2>/dev/null
+export "$1" 2>/dev/null "$@" /usr/bin 'quoted text' $(pwd)
+	| ${HOME} "$@" -eu "$@" | cd "$@" echo sed then |
+awk | -eu $(pwd) export ${HOME} test
+	"$1" printf "$@" printf echo "$@" readonly | --verbose cd test $(pwd)
+		/usr/bin "$@" "$@" sed then ${HOME} export 'quoted text' awk --verbose
+test --verbose && export && $(pwd) done
+	--verbose --verbose && cd local "$@" grep "$@" done local
+	2>/dev/null "$1" && test grep awk x=1 export grep 'quoted text'
+	&& x=1 done && 'quoted text' grep local 2>/dev/null /usr/bin
+cd --verbose $(pwd) awk -eu && done readonly x=1 done "$@"
+"$1" --verbose 'quoted text' x=1 && sed
+then -eu sed "$@" local --verbose awk 'quoted text' ${HOME} readonly
+${HOME} local && echo -eu "$@" -eu /usr/bin cd
+/usr/bin --verbose 2>/dev/null 'quoted text' test printf echo /usr/bin
+	then x=1 export then "$1" done
+	${HOME} test ${HOME} "$@" awk local echo grep -eu cd -eu readonly
+| cd ${HOME} | done && grep ${HOME}
+		then "$1" sed 'quoted text' awk awk $(pwd)
+sed 2>/dev/null then echo done export /usr/bin "$@" done
+	| 2>/dev/null grep "$1" echo x=1 "$@" -eu awk -eu readonly
+	"$1" test /usr/bin awk "$@" cd /usr/bin echo readonly export
+		"$1" cd test export |
+		2>/dev/null awk grep readonly sed test /usr/bin
+		cd 'quoted text' echo "$@" grep $(pwd) local cd $(pwd)
+	export export readonly x=1 --verbose "$1" ${HOME} /usr/bin done printf --verbose
+		${HOME} 'quoted text' "$@" test 2>/dev/null cd --verbose | cd export ${HOME}
+local --verbose echo x=1 test 'quoted text'
+	"$1" && sed | "$1" x=1 then /usr/bin
+	readonly "$1" --verbose printf /usr/bin cd export 2>/dev/null
+2>/dev/null 'quoted text'
+local awk -eu "$1" --verbose export then test cd /usr/bin 'quoted text'
+-eu | local 'quoted text' then echo test -eu &&
+	grep 'quoted text' cd x=1 cd && && awk grep && awk
+		then readonly x=1 done grep | grep printf --verbose
+		sed local echo awk "$@"
+readonly --verbose "$1" "$1" local echo awk x=1 ${HOME} awk ${HOME} 'quoted text'
+	--verbose "$1" "$@" readonly "$@" "$@" /usr/bin 2>/dev/null readonly "$@"
+	grep "$1" "$@" export echo cd echo "$@" grep -eu x=1 sed x=1 ${HOME} 2>/dev/null
+		awk x=1 ${HOME} 2>/dev/null | awk export readonly cd /usr/bin
+		-eu $(pwd) cd printf export awk &&
+local "$@" echo "$@" && echo export | grep ${HOME} grep "$@" 2>/dev/null
+	&& "$@" cd "$@" /usr/bin echo -eu 'quoted text' /usr/bin done
+		| --verbose /usr/bin printf x=1 --verbose --verbose readonly
+&& "$1" ${HOME} echo "$1" x=1 grep awk -eu -eu sed
+	then export export --verbose $(pwd) then x=1 &&
+	then printf && && awk local local then $(pwd) 'quoted text'
+	grep x=1 -eu /usr/bin --verbose
+	$(pwd) | ${HOME} sed x=1 /usr/bin sed | printf then printf grep /usr/bin
+-eu ${HOME} cd /usr/bin done && grep
+		local export -eu cd cd 2>/dev/null | awk
+done then "$@" ${HOME} awk "$1" test sed --verbose test -eu awk | sed echo
+sed 'quoted text' cd printf grep awk -eu cd sed cd done "$@"
+-eu test readonly 'quoted text' grep 2>/dev/null 'quoted text'
+		readonly export grep "$@" local then test
+		grep sed 'quoted text' readonly awk "$@" -eu -eu sed test "$1" "$1" | && ${HOME}
+"$@" awk -eu ${HOME} local $(pwd) readonly
+	$(pwd) 'quoted text' awk $(pwd) /usr/bin export 2>/dev/null
+		${HOME} export printf printf /usr/bin "$1" /usr/bin grep 2>/dev/null
+readonly awk done done printf done $(pwd) 'quoted text' printf export 'quoted text'
+		"$@" echo sed then done awk test "$1" --verbose done | printf x=1
+		awk printf test /usr/bin printf ${HOME} x=1 /usr/bin cd readonly x=1 grep printf
+&& local --verbose then
+	x=1 test 2>/dev/null 2>/dev/null sed -eu
+		then /usr/bin --verbose grep export echo "$@"
+	&& then echo done | $(pwd) grep export readonly test local cd grep 2>/dev/null
+'quoted text' awk | then && "$1" export "$@" && cd --verbose
+		echo x=1 echo sed cd x=1 x=1 done local $(pwd) printf readonly
+--verbose then | 'quoted text' printf then --verbose grep
+	export x=1 test export --verbose cd printf /usr/bin && 2>/dev/null ${HOME} --verbose
+sed /usr/bin echo printf
+		x=1 echo done sed | -eu | local 'quoted text' $(pwd) cd --verbose
+		cd export done echo 2>/dev/null echo 'quoted text'
+		cd awk "$@" local ${HOME} $(pwd) readonly awk x=1 'quoted text' export
+"$1" then readonly printf -eu -eu done readonly
+		&& readonly readonly -eu export --verbose grep 'quoted text'
+export export ${HOME} 'quoted text'
+export && | echo --verbose grep grep "$@" && -eu export
+	echo | -eu $(pwd) --verbose 'quoted text' x=1 "$1" awk done &&
+		$(pwd) cd awk "$@" done sed $(pwd) sed | --verbose
+test grep grep /usr/bin sed -eu
+		x=1 then ${HOME} "$1" x=1 x=1 export --verbose grep "$@"
+		then /usr/bin echo x=1 sed /usr/bin 'quoted text' "$@" sed $(pwd)
+		done $(pwd) "$1" && | cd done
+	$(pwd) $(pwd) x=1 done awk
+	echo then awk readonly local grep ${HOME} awk -eu local --verbose
+$(pwd) readonly grep "$@" echo x=1 sed
+then x=1 export $(pwd) grep ${HOME} echo -eu --verbose ${HOME} "$@"
+sed echo $(pwd) x=1 ${HOME} && then -eu $(pwd) && && $(pwd)
+/usr/bin --verbose sed test sed /usr/bin grep
+	'quoted text' $(pwd) "$1" printf 2>/dev/null echo
+-eu && then -eu $(pwd) /usr/bin local "$1" /usr/bin done
+${HOME} sed test /usr/bin ${HOME}
+		awk /usr/bin -eu echo && export --verbose cd awk 2>/dev/null
+	| && local ${HOME} $(pwd) local
+	&& ${HOME} local | && --verbose "$@" -eu done awk -eu && && sed
+	local | /usr/bin "$1" 'quoted text' then local printf ${HOME} && echo
+$(pwd) awk grep 2>/dev/null
+--verbose then echo /usr/bin cd printf echo grep ${HOME} printf 'quoted text'
+		cd "$@" 'quoted text' grep done then
+		awk "$1" test cd x=1 then cd printf 'quoted text' ${HOME}
+		local sed 2>/dev/null -eu local cd done ${HOME} echo x=1 'quoted text' "$@" 2>/dev/null
+	then test x=1 2>/dev/null /usr/bin "$@"
+x=1 -eu printf test "$@" -eu awk $(pwd) local readonly
+done export echo ${HOME} -eu ${HOME} ${HOME} grep -eu
+	2>/dev/null "$@" "$@" awk -eu ${HOME} $(pwd) test 'quoted text' $(pwd) "$@"
+| -eu grep 'quoted text' 'quoted text' "$@" ${HOME} echo awk then x=1 export
+	"$1" echo export "$1" printf | readonly test awk 'quoted text' "$@" $(pwd) 2>/dev/null
+	-eu /usr/bin awk readonly && "$@" && echo export "$@" "$1" cd readonly
+	then "$@" x=1 printf readonly
+	sed 2>/dev/null "$@" x=1 --verbose
+	done x=1 grep ${HOME} "$1" printf sed test local cd -eu $(pwd)
+&& ${HOME} -eu done done cd 2>/dev/null readonly /usr/bin
+&& printf sed test grep $(pwd) && -eu $(pwd) readonly && x=1
+echo awk "$@" done "$1" readonly awk done 2>/dev/null awk "$1" echo && $(pwd) &&
+$(pwd) cd 2>/dev/null export $(pwd) test test $(pwd)
+	--verbose echo -eu $(pwd) test echo "$@" x=1 readonly
+	| 2>/dev/null $(pwd) 'quoted text'
+	${HOME} && cd sed printf printf x=1 sed | /usr/bin && readonly
+	sed grep export "$1" /usr/bin
+		/usr/bin cd then sed x=1 done
+echo grep | readonly awk readonly local awk readonly
+echo cd /usr/bin then export done local $(pwd) export -eu
+awk x=1 'quoted text'
+		cd $(pwd) $(pwd) printf readonly awk "$@" && sed ${HOME} && then
+	$(pwd) sed readonly -eu | sed printf -eu awk
+		"$1" echo | --verbose
+awk | printf $(pwd) then
+local --verbose export && readonly 2>/dev/null --verbose
+cd then --verbose readonly printf "$@" cd done $(pwd) | $(pwd)
+then echo /usr/bin grep
+done printf -eu cd printf done grep && cd ${HOME} printf
+	${HOME} readonly done ${HOME} local 2>/dev/null ${HOME} test "$1" x=1 readonly
+	test ${HOME} local then readonly ${HOME} echo grep 2>/dev/null 2>/dev/null
+	'quoted text' test local && x=1 2>/dev/null "$@" printf printf
+		test -eu "$@" $(pwd) -eu --verbose | done done cd sed x=1 done $(pwd) "$@"
+		local readonly export done
+cd | x=1 local printf
+		| $(pwd) 'quoted text' 2>/dev/null
+	grep cd echo export 'quoted text'
+		test test /usr/bin "$@" && printf ${HOME} test then
+	cd x=1 export $(pwd) $(pwd) x=1 then export
+-eu test printf "$@" printf done "$@" cd export $(pwd) 2>/dev/null
+readonly done | awk "$@" sed "$@" grep "$@"
+${HOME} printf -eu readonly
+		printf "$@" "$@" then ${HOME} then sed awk "$@"
+		"$@" cd "$1" export /usr/bin "$@" echo printf
+	${HOME} echo sed echo grep grep export then
+done grep test -eu grep cd test "$@" $(pwd)
+		sed local sed local readonly sed "$1" done readonly
+test "$@" readonly sed ${HOME} ${HOME} && -eu --verbose -eu -eu $(pwd)
+		| echo -eu /usr/bin done 'quoted text' 2>/dev/null local grep
+	printf && done done "$@" "$1" /usr/bin
+done sed 2>/dev/null "$1" sed then | local readonly "$1"
+grep 2>/dev/null sed "$@" | /usr/bin local grep
+done local && export x=1 && x=1 ${HOME} x=1 && --verbose
+test 2>/dev/null cd "$@" sed ${HOME} then "$1" done test
+		/usr/bin awk test readonly awk readonly --verbose
+		"$1" ${HOME} cd readonly 'quoted text' printf 'quoted text' /usr/bin
+	export $(pwd) /usr/bin -eu
+export -eu echo test cd && sed x=1 local
+	test ${HOME} done local sed ${HOME} --verbose test --verbose
+	sed cd | echo echo "$1" "$1" "$@" 2>/dev/null x=1 --verbose
+		sed then done printf /usr/bin 2>/dev/null then readonly "$@" $(pwd) ${HOME}
+	"$1" grep cd "$@" then "$@" 'quoted text' cd local 2>/dev/null
+		awk done then cd 2>/dev/null test | x=1 test export
+printf done cd printf x=1 printf --verbose
+--verbose awk --verbose
+test printf readonly export local then --verbose cd grep export then
+		x=1 -eu --verbose local
+	awk sed ${HOME} export x=1 "$1" grep grep 'quoted text'
+	-eu awk x=1 $(pwd) grep sed echo then done 'quoted text' cd 2>/dev/null test 'quoted text'
+--verbose test readonly | printf
+	done done export printf && && "$@" export
+printf 2>/dev/null echo
+x=1 grep 2>/dev/null -eu awk grep
+echo 2>/dev/null done awk printf sed readonly
+then "$1" && awk --verbose $(pwd) cd --verbose export export
+cd printf printf ${HOME} then sed grep "$@" cd awk "$@" | $(pwd)
+	$(pwd) then $(pwd) sed 'quoted text'
+		echo sed $(pwd) done --verbose
+-eu "$@" grep x=1 local local
+&& -eu 2>/dev/null && then "$1" test done local grep --verbose 'quoted text'
+$(pwd) done --verbose done done sed && awk test "$1"
+		"$@" cd printf readonly cd ${HOME} local ${HOME}
+awk cd export $(pwd) $(pwd) awk --verbose export
+		printf test "$1" grep done printf 2>/dev/null local done echo awk printf done /usr/bin
+then cd | printf 2>/dev/null test grep printf x=1 && && grep done
+"$@" sed done sed test printf
+	$(pwd) grep -eu awk 'quoted text' printf grep 'quoted text' 'quoted text'
+test readonly grep /usr/bin grep readonly echo
+	2>/dev/null echo 2>/dev/null local 2>/dev/null ${HOME} "$1"
+	export && && grep awk 2>/dev/null export grep "$1" readonly
+	local done ${HOME} 'quoted text' 2>/dev/null
+		x=1 ${HOME} /usr/bin &&
+readonly local local 'quoted text' -eu cd awk $(pwd) "$@" -eu /usr/bin
+		&& -eu test export printf awk x=1 echo then |
+"$1" local && --verbose x=1 export echo printf | "$1"
+		-eu grep | grep echo sed printf | done export local "$1"
+		2>/dev/null awk done export ${HOME} 'quoted text' sed export printf
+	sed --verbose "$@" test 2>/dev/null grep x=1 ${HOME}
+	'quoted text' 2>/dev/null test printf 'quoted text' ${HOME} echo cd
+	local export export 2>/dev/null
+		"$1" -eu 2>/dev/null export sed -eu 2>/dev/null cd readonly
+done readonly test echo grep test -eu done test ${HOME} printf grep
+	x=1 local test "$1" x=1 /usr/bin printf then /usr/bin printf && cd export cd
+'quoted text' $(pwd) --verbose
+	test awk then --verbose 'quoted text'
+	${HOME} readonly echo 2>/dev/null | && awk then /usr/bin $(pwd)
+		then readonly done local $(pwd) 2>/dev/null -eu x=1 "$@" 'quoted text'
+		2>/dev/null "$1" printf /usr/bin awk local /usr/bin
+		"$@" readonly test 2>/dev/null done "$@" ${HOME} 'quoted text' awk printf -eu echo
+	awk test readonly done done | then then readonly awk export test
+${HOME} echo echo local echo -eu --verbose export done x=1 then && "$1" /usr/bin
+		--verbose ${HOME} local done sed "$@" "$1" -eu awk awk "$1" | 'quoted text'
+		2>/dev/null echo -eu export | "$1" readonly sed 2>/dev/null --verbose
+'quoted text' test $(pwd) local -eu
+	cd readonly x=1 test 'quoted text' ${HOME} --verbose done echo /usr/bin && printf
+then grep | -eu --verbose /usr/bin && sed ${HOME}
+		then done cd awk local x=1 test
+	then echo $(pwd) local
+	${HOME} x=1 x=1 && $(pwd) $(pwd) "$1" -eu $(pwd) --verbose -eu $(pwd) -eu export
+	${HOME} awk readonly | && ${HOME}
+		test grep "$1" cd echo 2>/dev/null grep readonly
+"$@" printf -eu readonly | grep local 2>/dev/null printf awk x=1
+	$(pwd) printf "$1" readonly test -eu "$1" && cd printf grep && | 2>/dev/null done
+$(pwd) awk "$@" $(pwd) | 'quoted text' then $(pwd) $(pwd) test "$@" x=1 'quoted text'
+		then -eu | printf ${HOME} readonly then local
+	| | 'quoted text' -eu export ${HOME}
+-eu && sed -eu sed local "$@" $(pwd) grep "$1" then test $(pwd)
+grep 'quoted text' | "$1" | /usr/bin
+		--verbose ${HOME} test sed awk "$@" "$@"
+awk grep done && sed awk "$1" sed
+"$1" "$1" $(pwd) readonly 2>/dev/null
+then x=1 grep ${HOME} ${HOME} readonly ${HOME} awk local test done test
+then awk printf then ${HOME}
+		sed 'quoted text' cd readonly
+	test 2>/dev/null && readonly $(pwd) then then export
+"$1" && echo /usr/bin 2>/dev/null
+-eu printf $(pwd) echo awk done | | "$@" --verbose cd x=1 && /usr/bin
+	x=1 -eu sed local "$@"
+x=1 "$1" done -eu /usr/bin $(pwd) echo sed
+	"$@" && local 'quoted text' done 2>/dev/null test | x=1 echo readonly
+		'quoted text' -eu grep "$1" done "$1" cd $(pwd) done
+	'quoted text' echo | /usr/bin x=1 cd -eu 2>/dev/null x=1 "$1" test | readonly
+		export -eu echo x=1 "$@" sed "$1" cd local "$@" $(pwd)
+	--verbose 'quoted text' echo printf grep "$@" printf sed
+	"$1" local readonly export echo printf ${HOME} | "$@" --verbose then
+	| --verbose readonly local --verbose && /usr/bin /usr/bin local cd -eu printf
+		$(pwd) readonly -eu --verbose awk /usr/bin "$@" then readonly 'quoted text' cd
+	"$1" $(pwd) /usr/bin --verbose
+		cd x=1 export test 2>/dev/null $(pwd) sed | --verbose
+		sed "$1" export done "$@"
+sed --verbose cd readonly
+sed /usr/bin "$@" local
+	${HOME} printf test | 2>/dev/null grep 2>/dev/null
+-eu echo grep then 2>/dev/null
+		2>/dev/null grep printf echo "$@" readonly readonly "$@" then printf | export
+		2>/dev/null && "$1" | done printf 'quoted text' "$1"
+	-eu 2>/dev/null echo 'quoted text' cd sed -eu done grep export
+		export echo 2>/dev/null /usr/bin awk sed -eu then echo
+	local -eu done done test
+then x=1 awk --verbose /usr/bin
+-eu "$1" 2>/dev/null | -eu grep local printf done x=1 $(pwd) "$1"
+2>/dev/null /usr/bin --verbose echo --verbose "$1" ${HOME} ${HOME} sed
+2>/dev/null test /usr/bin 'quoted text'
+	2>/dev/null 'quoted text' -eu export |
+printf $(pwd) "$@" cd --verbose readonly && ${HOME} printf cd "$1"
+'quoted text' ${HOME} 2>/dev/null --verbose echo readonly
+'quoted text' x=1 printf cd then cd readonly printf ${HOME} grep grep
+		export /usr/bin echo $(pwd) --verbose echo ${HOME} --verbose | /usr/bin "$@"
+	test | | echo export export
+	-eu export x=1 export awk test local echo /usr/bin grep awk "$1" | awk
+	readonly "$@" export test local readonly cd grep -eu
+awk $(pwd) | ${HOME} 2>/dev/null test
+	--verbose | | printf ${HOME} grep && | grep x=1 "$1" then /usr/bin
+readonly 2>/dev/null readonly echo
+	"$1" /usr/bin local readonly $(pwd) done echo x=1
+	echo grep export test 2>/dev/null cd grep /usr/bin 'quoted text' awk local
+awk printf export x=1
+$(pwd) awk echo "$1" $(pwd) 'quoted text'
+		"$@" sed "$1" /usr/bin && then test "$@"
+		"$@" echo ${HOME} 2>/dev/null "$@" echo --verbose done echo && done -eu awk "$@"
+	local | 2>/dev/null echo then sed test readonly sed then awk 'quoted text' ${HOME}
+then awk grep printf $(pwd) ${HOME} awk echo cd x=1 awk then
+		readonly 'quoted text' 2>/dev/null -eu readonly grep readonly printf local
+2>/dev/null sed printf then echo printf
+		$(pwd) 'quoted text' --verbose export "$1" done printf --verbose
+		$(pwd) && grep 2>/dev/null && "$@" export -eu printf ${HOME} printf
+		export readonly $(pwd) 2>/dev/null done grep awk x=1 export $(pwd)
+		"$1" && test readonly ${HOME} $(pwd) cd export echo x=1 then done -eu
+	readonly awk ${HOME} "$@" readonly then | --verbose printf &&
+		readonly done "$1" 'quoted text'
+		awk 'quoted text' echo export
+'quoted text' 2>/dev/null echo export
+grep ${HOME} "$@" printf "$@" export -eu x=1 --verbose "$@" test
+		awk local && sed && 'quoted text' x=1 $(pwd) test 2>/dev/null $(pwd) then done
+		--verbose test --verbose test readonly
+	test readonly readonly $(pwd) 2>/dev/null
+		--verbose done -eu local x=1 printf then awk
+	'quoted text' && printf echo
+	test x=1 x=1 done "$@" && $(pwd) 2>/dev/null then then grep local && | then
+	echo ${HOME} $(pwd) "$@" $(pwd) printf "$@" | then cd readonly cd
+	--verbose $(pwd) x=1 test grep
+&& test --verbose -eu --verbose 'quoted text' local "$1"
+/usr/bin readonly test --verbose local && $(pwd) sed export $(pwd)
+		"$1" then | awk awk readonly /usr/bin awk | /usr/bin local
+grep && local ${HOME} --verbose x=1 "$@"
+		x=1 -eu local awk | local | "$1" test 'quoted text'
+'quoted text' export | awk cd ${HOME} $(pwd)
+		x=1 $(pwd) test readonly
+	-eu -eu ${HOME} echo export
+	echo --verbose printf printf
+sed -eu awk && --verbose done
+printf -eu test --verbose done awk printf $(pwd)
+		export --verbose /usr/bin done readonly -eu local printf
+sed /usr/bin $(pwd) echo 'quoted text' grep echo then 2>/dev/null "$@"
+	&& cd x=1 awk done then cd --verbose
+grep | -eu --verbose /usr/bin | "$@" |
+	x=1 /usr/bin -eu 2>/dev/null 'quoted text' echo done --verbose
+		2>/dev/null sed echo done "$1"
+	readonly printf -eu && printf sed test /usr/bin &&
+sed export -eu ${HOME} 'quoted text' ${HOME} "$1" export echo --verbose
+		sed echo --verbose 'quoted text' | done 'quoted text'
+		then "$1" cd x=1 "$1" 2>/dev/null "$1" readonly then 'quoted text' grep awk
+done x=1 && local export 'quoted text' done --verbose export
+	$(pwd) "$1" x=1 then local local $(pwd) --verbose then printf
+--verbose done echo /usr/bin then grep
+		export ${HOME} /usr/bin done /usr/bin done
+	2>/dev/null local 'quoted text'
+		cd done --verbose grep -eu grep -eu &&
+	"$1" x=1 done echo sed x=1 test --verbose "$@" test "$@" then
+	--verbose $(pwd) sed export "$@" cd readonly "$@" 2>/dev/null x=1 local export
+		readonly done ${HOME} local -eu "$1" $(pwd) ${HOME} awk
+	x=1 --verbose test ${HOME} cd 'quoted text' then "$@" then | "$1" /usr/bin then
+x=1 'quoted text' awk $(pwd) ${HOME} sed /usr/bin
+	awk sed 'quoted text' awk then | printf x=1 'quoted text' echo export awk awk test
+	-eu 'quoted text' 'quoted text' "$@" "$@" cd 2>/dev/null echo ${HOME} test
+		done local echo -eu "$1" printf && local "$1" grep && grep awk "$1"
+| test | $(pwd) | && && ${HOME}
+export sed local --verbose 2>/dev/null done "$@" grep | ${HOME} x=1 "$@" "$@"
+	echo cd $(pwd) 2>/dev/null $(pwd) printf ${HOME} x=1
+		&& /usr/bin 'quoted text' -eu -eu ${HOME} "$@" --verbose 'quoted text' $(pwd)
+&& | | -eu export $(pwd) export sed readonly
+'quoted text' grep "$@" $(pwd) -eu
+		export sed cd | export $(pwd)
+local readonly cd && then x=1 export x=1 test 2>/dev/null
+	"$@" "$@" echo awk 'quoted text' awk export awk 2>/dev/null
+	echo x=1 | echo local printf 2>/dev/null
+	cd cd echo echo && $(pwd) --verbose cd --verbose awk then
+done ${HOME} echo | cd && readonly test 2>/dev/null /usr/bin
+	test /usr/bin x=1 "$1" echo --verbose
+	then --verbose 'quoted text' $(pwd) x=1 export grep --verbose 'quoted text' /usr/bin
+		2>/dev/null --verbose x=1
+x=1 /usr/bin local grep && 'quoted text' test readonly
+	$(pwd) then ${HOME} x=1 grep "$1" 2>/dev/null
+		${HOME} --verbose echo 2>/dev/null
+export test done "$1" x=1 done local "$1" /usr/bin && x=1 --verbose
+&& local awk grep test $(pwd) "$@" sed grep grep 'quoted text'
+cd test then cd 2>/dev/null x=1 export grep |
+		printf "$1" then x=1 | sed
+	${HOME} echo cd sed x=1
+'quoted text' $(pwd) $(pwd) "$@" then sed 2>/dev/null test /usr/bin
+	x=1 grep $(pwd) | sed 2>/dev/null --verbose $(pwd)
+		${HOME} $(pwd) local then && readonly /usr/bin done printf
+	done readonly test 2>/dev/null "$@" cd /usr/bin
+		done && then sed local grep printf
+		"$@" then sed "$1" $(pwd) "$1" printf
+		sed then "$@" | $(pwd) /usr/bin /usr/bin /usr/bin
+2>/dev/null && && test then "$@" -eu readonly cd local
+test cd export then && printf export echo sed
+	&& "$@" done /usr/bin sed $(pwd) 'quoted text'
+		local "$@" ${HOME} sed "$1" export sed
+		printf cd /usr/bin printf done "$1" /usr/bin $(pwd) cd done ${HOME}
+	export grep awk local printf done test local printf ${HOME} local --verbose
+		$(pwd) $(pwd) sed -eu $(pwd) awk && --verbose -eu cd ${HOME} done $(pwd)
+		then x=1 export grep x=1 local x=1 cd
+"$@" 'quoted text' && --verbose
+sed ${HOME} readonly /usr/bin $(pwd) | ${HOME} 'quoted text'
+	awk sed && $(pwd) ${HOME} -eu
+	${HOME} --verbose | | local awk done printf grep && printf test
+		export then -eu "$1" ${HOME} local 'quoted text'
+		"$@" --verbose then then --verbose export printf printf test -eu /usr/bin
+		-eu ${HOME} awk test -eu readonly sed ${HOME} ${HOME}
+		cd 2>/dev/null ${HOME} 'quoted text' --verbose ${HOME} awk --verbose --verbose
+"$@" "$1" --verbose cd x=1 cd 2>/dev/null x=1 export echo cd
+		"$@" 2>/dev/null x=1 echo cd --verbose | cd sed done sed readonly
+		cd export 'quoted text' echo printf cd sed 'quoted text' -eu | 'quoted text'
+&& --verbose sed grep x=1 | ${HOME} sed cd "$1" grep
+		"$1" $(pwd) then $(pwd) 2>/dev/null "$@" awk ${HOME} done grep cd awk sed echo awk
+&& $(pwd) 'quoted text' local 'quoted text' | "$1" /usr/bin
+		&& /usr/bin local ${HOME} then cd export && done -eu export | --verbose
+		grep grep grep --verbose /usr/bin
+	sed local && --verbose then | | 'quoted text' 'quoted text' awk x=1 then
+		printf --verbose sed 2>/dev/null sed | cd local done printf
+		2>/dev/null -eu local done echo 2>/dev/null
+awk x=1 then echo /usr/bin echo "$@" && -eu 'quoted text' echo cd | 'quoted text'
+	then --verbose readonly ${HOME} awk 2>/dev/null -eu 2>/dev/null
+	done export $(pwd) "$@"
+"$1" 'quoted text' "$1" test local echo $(pwd) /usr/bin "$1"
+sed then awk "$1" local "$1" --verbose grep 2>/dev/null awk done test readonly readonly
+		awk | awk && then 'quoted text' readonly sed cd export -eu
+	'quoted text' cd | then | -eu && cd /usr/bin then sed cd printf --verbose $(pwd)
+	-eu ${HOME} readonly export test awk
+		-eu echo export | test awk printf && export
+		readonly && then test "$1" done test x=1 2>/dev/null --verbose readonly
+	awk "$1" test "$1" && echo cd export ${HOME} && echo 'quoted text'
+	local ${HOME} awk 2>/dev/null x=1 | "$1" x=1 export | test readonly
+	'quoted text' readonly /usr/bin
+cd readonly | readonly 'quoted text' test printf ${HOME}
+	--verbose export export test local
+		'quoted text' 'quoted text' grep done x=1 then echo awk export
+	export ${HOME} $(pwd) cd sed
+	'quoted text' "$1" sed x=1 "$@" $(pwd) && && local export "$@" /usr/bin
+	2>/dev/null 2>/dev/null --verbose /usr/bin sed "$@"
+		2>/dev/null test done cd 'quoted text' export 2>/dev/null then
+	echo printf | then 'quoted text' sed readonly done
+export done && | "$@" then
+readonly export sed --verbose ${HOME} ${HOME} 'quoted text' "$@" grep /usr/bin
+		x=1 local printf && $(pwd) export $(pwd) x=1 then local && --verbose ${HOME}
+		| | cd grep 'quoted text' 2>/dev/null
+	"$@" x=1 -eu "$@" done 2>/dev/null done | readonly ${HOME} awk /usr/bin awk printf
+		| grep /usr/bin test grep printf "$@" -eu done
+then printf cd "$1" awk
+	then ${HOME} echo printf sed ${HOME} printf 2>/dev/null --verbose && $(pwd) x=1
+echo ${HOME} $(pwd) 'quoted text' then readonly
+	&& local test --verbose && export 'quoted text' x=1
+local awk 'quoted text' grep && -eu | "$1" && grep printf
+		&& -eu ${HOME} awk then grep "$1" ${HOME} $(pwd) cd awk -eu "$@" readonly
+--verbose "$1" grep grep 2>/dev/null then export cd "$@" 2>/dev/null
+readonly 2>/dev/null export --verbose cd /usr/bin "$@" grep x=1 export && /usr/bin
+	| "$@" "$@" cd | -eu ${HOME}
+		| local "$@" --verbose 2>/dev/null "$@" ${HOME}
+	echo printf echo awk then export /usr/bin |
+sed -eu x=1 | $(pwd) ${HOME} sed && then
+"$1" 2>/dev/null "$@" echo "$@" then --verbose
+done 'quoted text' 2>/dev/null printf $(pwd) 'quoted text'
+	${HOME} --verbose then 2>/dev/null
+-eu export then --verbose then $(pwd) /usr/bin cd 2>/dev/null
+	export -eu /usr/bin "$@" done ${HOME} done x=1 ${HOME} then 'quoted text' then
+	| x=1 "$1" $(pwd) test ${HOME} local | sed /usr/bin | grep awk 2>/dev/null grep
+	--verbose 2>/dev/null then sed $(pwd) 'quoted text'
+${HOME} && $(pwd) printf grep sed sed grep "$@" x=1 cd cd /usr/bin
+		sed test 'quoted text' local -eu "$1" "$@"
+printf "$@" test "$@" /usr/bin && done $(pwd) "$@" awk done 2>/dev/null
+	2>/dev/null test then 'quoted text' $(pwd) && $(pwd) local then local
+	"$1" grep /usr/bin | local
+		"$1" --verbose then && echo x=1 then ${HOME} --verbose sed echo
+		'quoted text' echo awk --verbose echo echo 2>/dev/null $(pwd) echo grep $(pwd)
+		sed x=1 | x=1 grep ${HOME} 'quoted text' then sed x=1 ${HOME} /usr/bin
+sed done /usr/bin local "$1" 2>/dev/null --verbose grep "$1" ${HOME} test
+		done cd --verbose echo "$1" sed x=1 done awk local x=1
+		2>/dev/null printf export ${HOME} -eu echo grep
+&& "$1" done sed 2>/dev/null
+		grep printf 'quoted text' local test --verbose readonly grep && && "$@" --verbose
+	export export ${HOME} then
+	local done $(pwd) test x=1 $(pwd) "$1" -eu cd "$1" x=1 then "$@" "$1" readonly
+		'quoted text' 2>/dev/null export local "$1" $(pwd) grep awk test then export
+	/usr/bin "$@" printf sed grep grep && readonly 'quoted text' "$1" &&
+		grep | $(pwd) x=1 awk printf grep "$1" local cd done local
+echo 'quoted text' $(pwd) x=1
+	"$1" | sed local ${HOME} -eu $(pwd) "$1"
+$(pwd) "$@" /usr/bin grep /usr/bin $(pwd) grep "$1" then --verbose
+	cd "$@" cd -eu local test /usr/bin grep 'quoted text' "$1" --verbose printf sed
+		echo test then printf echo export grep then
+"$@" export /usr/bin cd "$@" cd printf 2>/dev/null "$1" && test
+cd export --verbose "$1" awk 2>/dev/null echo x=1 local
+	test sed then awk local awk printf
+		x=1 | 2>/dev/null "$@" export "$@" awk /usr/bin then 2>/dev/null | -eu local
+		'quoted text' /usr/bin && test printf $(pwd)
+		-eu x=1 x=1 "$@" readonly readonly test echo sed cd sed 2>/dev/null x=1 2>/dev/null
+	done 2>/dev/null cd export "$@" grep
+	| test ${HOME} sed 2>/dev/null
+		sed "$@" 'quoted text' cd grep readonly x=1 awk --verbose grep
+	printf done cd 'quoted text' echo
+		x=1 test x=1 export 2>/dev/null -eu cd | x=1 test export
+		$(pwd) 'quoted text' printf
+	| && readonly "$1" then printf export -eu
+--verbose test && /usr/bin readonly "$@" sed then -eu
+	x=1 printf test then && test && readonly printf local printf
+awk export "$@" 'quoted text' cd grep local 2>/dev/null test grep
+	then | x=1 ${HOME} local test /usr/bin
+		--verbose "$@" && readonly
+		/usr/bin $(pwd) --verbose test x=1 printf 'quoted text' test awk 2>/dev/null
+${HOME} printf | ${HOME} printf export
+	/usr/bin $(pwd) grep grep /usr/bin
+	readonly $(pwd) test -eu local /usr/bin
+	awk | cd test -eu echo grep then then | "$@"
+		sed && printf && export sed awk awk | readonly -eu | done
+	then 'quoted text' /usr/bin cd --verbose local sed export
+then cd | sed 2>/dev/null local 'quoted text' x=1 --verbose
+	sed awk export -eu grep ${HOME} printf awk echo | readonly
+		'quoted text' readonly /usr/bin then then && | x=1 test then -eu echo readonly
+awk then && export printf -eu "$@" echo
+/usr/bin local -eu grep export 'quoted text' cd
+awk $(pwd) done awk $(pwd) echo "$@" && 2>/dev/null local /usr/bin
+local "$@" --verbose test && export then export "$1" x=1 grep "$@" sed
+	test "$1" cd export grep local test printf
+		-eu local echo 'quoted text' ${HOME}
+		x=1 2>/dev/null | awk sed cd echo done | "$@" readonly $(pwd) "$1"
+		-eu -eu 2>/dev/null 'quoted text' x=1 && 'quoted text'
+cd readonly awk awk cd printf sed /usr/bin ${HOME} $(pwd) 'quoted text'
+	/usr/bin export -eu readonly -eu $(pwd)
+		--verbose "$@" cd | -eu --verbose && $(pwd) "$@" readonly | x=1 'quoted text' sed
+	done echo sed "$@" then cd readonly awk cd -eu local && -eu | 'quoted text' /usr/bin
+		"$1" && x=1 then | $(pwd) "$1" grep local x=1 "$@" echo export "$@"
+"$@" --verbose x=1 --verbose x=1 'quoted text'
+	&& then ${HOME} awk awk "$1"
+	printf cd done grep | sed x=1
+		grep local /usr/bin awk ${HOME} readonly /usr/bin export readonly then
+test printf /usr/bin awk then awk local x=1 then 'quoted text' cd x=1 $(pwd)
+printf printf local sed 'quoted text'
+awk test && -eu --verbose --verbose
+		x=1 2>/dev/null "$1" ${HOME} cd test | awk | "$1" &&
+	-eu readonly x=1 "$1" x=1 /usr/bin -eu grep
+		${HOME} then 'quoted text' x=1 sed ${HOME}
+		printf readonly -eu readonly |
+	awk && x=1 --verbose 'quoted text' $(pwd) $(pwd) export
+then /usr/bin $(pwd) echo 2>/dev/null
+readonly /usr/bin "$1" "$1"
+	"$@" readonly then readonly
+	"$@" awk -eu test --verbose ${HOME} done printf export --verbose
+		-eu awk $(pwd) 'quoted text' printf echo --verbose x=1 cd && grep printf x=1
+	printf --verbose "$@" export $(pwd) readonly done "$@" grep echo export
+		cd readonly cd x=1 local "$@" echo 'quoted text'
+	'quoted text' cd 2>/dev/null 2>/dev/null
+		${HOME} readonly 'quoted text'
+		| -eu test /usr/bin --verbose 2>/dev/null local "$1"
+then -eu test && cd printf test export
+	local cd printf $(pwd) sed x=1 ${HOME}
+		local 'quoted text' printf
+--verbose 2>/dev/null | --verbose
+	'quoted text' "$@" then export --verbose export
+	printf echo x=1 2>/dev/null | printf $(pwd) done local 2>/dev/null
+	'quoted text' x=1 readonly done awk cd cd echo local ${HOME} 'quoted text'
+awk then test awk ${HOME} test
+${HOME} local -eu done grep cd readonly ${HOME} && local
+	sed then awk cd /usr/bin printf then done -eu then | sed 2>/dev/null "$1"
+/usr/bin export awk readonly
+cd --verbose x=1 done export
+'quoted text' /usr/bin test awk readonly $(pwd)
+	printf -eu then "$1" local grep test awk readonly 2>/dev/null
+		export x=1 echo local && readonly export --verbose $(pwd)
+	local sed sed -eu --verbose ${HOME} export grep export
+cd --verbose | done awk test done done x=1 $(pwd) -eu local
+	printf "$@" && local readonly /usr/bin -eu test && "$@" "$1" $(pwd)
+"$@" "$@" cd export 2>/dev/null ${HOME} printf export --verbose
+		'quoted text' done printf export readonly
+x=1 | -eu 2>/dev/null | then | && 'quoted text' grep && echo x=1 'quoted text' echo
+		sed "$@" && --verbose && then test
+printf 2>/dev/null 2>/dev/null echo grep grep test && ${HOME} && | ${HOME} awk
+		"$1" then | $(pwd) test then cd printf then then echo done /usr/bin
+	sed grep --verbose -eu 2>/dev/null "$@" /usr/bin | readonly
+	"$1" grep --verbose $(pwd) printf awk readonly export ${HOME}
+printf test && grep sed
+-eu 'quoted text' && grep local
+test awk 'quoted text' 'quoted text' done
+		"$1" --verbose /usr/bin $(pwd)
+		awk echo x=1 done 2>/dev/null /usr/bin grep 'quoted text' 2>/dev/null
+		readonly grep -eu readonly -eu
+		| printf printf 2>/dev/null test awk
+		sed local /usr/bin local sed readonly
+x=1 x=1 $(pwd) test sed | -eu printf
+cd && grep local 'quoted text' 'quoted text' x=1 --verbose $(pwd) done -eu 2>/dev/null
+		| cd export 'quoted text' sed then grep cd done 'quoted text'
+	x=1 -eu local x=1 readonly done | "$1" test local local 2>/dev/null
+		local x=1 /usr/bin x=1 && 'quoted text' /usr/bin "$@" -eu /usr/bin
+	"$@" export /usr/bin $(pwd)
+--verbose readonly done --verbose export echo readonly sed x=1 && done /usr/bin
+		sed $(pwd) sed sed readonly /usr/bin
+		"$1" echo --verbose done --verbose then | "$@" ${HOME} readonly done readonly
+		readonly 'quoted text' --verbose
+		done done printf -eu && "$1" grep test local readonly --verbose
+	awk | sed | grep test echo | awk printf grep export sed printf
+	'quoted text' --verbose 2>/dev/null readonly --verbose export --verbose
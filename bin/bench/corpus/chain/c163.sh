@@ -0,0 +1,2001 @@
+x=1 awk test local $(pwd) test
+readonly local /usr/bin $(pwd) 'quoted text' | -eu
+		--verbose | "$@" readonly then 2>/dev/null
+	2>/dev/null sed awk sed local --verbose /usr/bin
+		| | "$1" export --verbose then "$1" $(pwd) local x=1 -eu $(pwd) readonly readonly
+	test 'quoted text' local "$@" $(pwd) && awk | grep local
+		test /usr/bin | 'quoted text' --verbose sed | echo 2>/dev/null
+		awk echo 'quoted text' cd 2>/dev/null 'quoted text'
+	x=1 ${HOME} awk readonly printf $(pwd) printf -eu
+	awk export echo -eu cd printf printf readonly done 'quoted text'
+		export x=1 sed then $(pwd) awk "$1" "$1" export 'quoted text' awk
+		test echo "$@" sed $(pwd) 'quoted text' "$@" &&
+2>/dev/null 2>/dev/null "$1" "$1" x=1 --verbose
+	"$1" x=1 ${HOME} grep 2>/dev/null x=1 local local -eu --verbose grep
+		grep $(pwd) --verbose x=1 x=1 "$1" $(pwd) "$@" sed test awk "$1" ${HOME}
+x=1 sed ${HOME} | --verbose echo grep
+	&& "$1" | local "$@" done
+cd -eu --verbose then printf "$1" 'quoted text'
+		sed then echo sed && awk -eu 'quoted text' grep sed 'quoted text' printf &&
+"$1" -eu printf then test grep cd test /usr/bin $(pwd) x=1
+		--verbose echo "$1" 2>/dev/null
+	--verbose $(pwd) --verbose 'quoted text' | sed "$1" local
+		| local local "$1" "$1" readonly && ${HOME} && | sed ${HOME}
+printf readonly test test
+	cd 'quoted text' readonly
+export local x=1 | --verbose x=1 then ${HOME} cd export sed test x=1 sed done
+	x=1 && | x=1 /usr/bin export 2>/dev/null done ${HOME} echo | local done grep x=1
+	export printf sed 'quoted text' 'quoted text' readonly --verbose
+		grep ${HOME} -eu "$1" done printf
+printf 'quoted text' --verbose 'quoted text' 2>/dev/null ${HOME} echo -eu local
+		--verbose /usr/bin done done test export cd ${HOME} sed grep cd &&
+readonly test --verbose "$@" /usr/bin done awk sed 2>/dev/null
+		test --verbose export -eu readonly "$1" then echo local
+		$(pwd) $(pwd) && 'quoted text' 2>/dev/null x=1
+	done awk grep export echo local 'quoted text'
+	grep --verbose then awk local local --verbose
+	&& awk "$1" then --verbose ${HOME} "$@" awk sed "$1" then |
+		--verbose 'quoted text'
+	--verbose 'quoted text' then
+	printf export sed readonly 2>/dev/null readonly 'quoted text' done
+sed /usr/bin $(pwd) done cd --verbose $(pwd) && awk "$1"
+		"$1" done sed 'quoted text' /usr/bin "$@"
+local printf printf $(pwd) readonly -eu
+		$(pwd) && test $(pwd) "$1" "$@" sed grep then && local
+	x=1 -eu $(pwd) $(pwd) printf x=1 local printf --verbose x=1 "$1"
+grep $(pwd) && sed grep x=1 ${HOME} $(pwd) | "$1" echo
+	--verbose readonly readonly printf sed readonly export
+sed x=1 local --verbose test ${HOME} -eu then cd
+		-eu x=1 printf x=1 "$1" "$@" && --verbose "$@"
+$(pwd) --verbose && awk 'quoted text' 'quoted text' ${HOME} -eu -eu export | done
+	grep echo && -eu 2>/dev/null
+"$1" done grep ${HOME} awk 'quoted text' && then -eu grep
+/usr/bin "$@" 'quoted text' $(pwd) awk then
+	echo done "$1" x=1 "$1" printf
+		${HOME} --verbose --verbose local
+		"$@" | done 2>/dev/null readonly then 'quoted text' |
+cd test grep grep x=1 && 2>/dev/null sed
+"$@" cd x=1 printf && $(pwd) -eu
+$(pwd) local awk sed printf 'quoted text' && "$@" done
+-eu --verbose && 2>/dev/null
+awk "$@" "$1" "$@" x=1 /usr/bin sed
+	'quoted text' readonly "$@" -eu $(pwd)
+	sed then export --verbose $(pwd)
+	awk | done 'quoted text' test then "$@" 'quoted text'
+	export x=1 && | then echo grep done grep awk ${HOME} then --verbose "$@" then sed
+'quoted text' --verbose sed grep ${HOME} test done printf
+"$1" ${HOME} x=1 /usr/bin | /usr/bin
+2>/dev/null cd printf readonly printf
+echo readonly test -eu echo "$1" x=1 2>/dev/null test -eu 2>/dev/null sed
+${HOME} printf export
+	cd ${HOME} /usr/bin --verbose /usr/bin sed
+	then done /usr/bin grep awk sed 2>/dev/null && 'quoted text'
+&& /usr/bin then -eu 2>/dev/null cd awk -eu
+-eu printf "$1" printf awk "$1" cd -eu awk
+readonly echo export "$1" echo 2>/dev/null then grep then done && done | x=1 $(pwd)
+	x=1 "$1" && export awk test grep
+		"$1" "$1" && | grep x=1
+'quoted text' awk printf
+	test sed && readonly --verbose cd export ${HOME} && awk | test
+		readonly --verbose -eu done ${HOME} "$1" cd "$1"
+		test 'quoted text' --verbose grep
+local | "$@" ${HOME} grep printf then x=1
+		-eu cd sed sed then printf printf then --verbose
+/usr/bin printf then 2>/dev/null cd echo
+	"$@" readonly /usr/bin 'quoted text' printf
+	"$1" printf grep sed -eu cd ${HOME} done printf /usr/bin && "$1" | export test
+	done "$1" "$1" 'quoted text' ${HOME} "$1" 2>/dev/null awk
+echo --verbose readonly then done | "$1" --verbose echo export | && test
+		cd x=1 readonly awk export export && | 'quoted text' echo "$1" printf x=1 sed
+		$(pwd) /usr/bin "$@" 'quoted text'
+		2>/dev/null /usr/bin done | && done "$1" "$1" /usr/bin
+	2>/dev/null readonly --verbose export x=1 /usr/bin test
+		awk then && awk export 'quoted text' x=1 echo then then /usr/bin cd awk
+		sed x=1 then awk printf echo $(pwd) 'quoted text' $(pwd) test /usr/bin printf
+	cd 'quoted text' awk /usr/bin | /usr/bin
+	--verbose awk then export $(pwd) export test cd awk 'quoted text'
+		${HOME} printf /usr/bin && && grep --verbose
+		done x=1 && test x=1 x=1
+done export ${HOME} ${HOME}
+		"$@" done "$@" | "$1" printf "$1" then
+		cd awk /usr/bin "$1" sed "$1" done && awk sed && | ${HOME} 'quoted text'
+'quoted text' && $(pwd)
+--verbose --verbose x=1 test | "$@" --verbose grep
+then -eu export cd 2>/dev/null x=1 ${HOME} export printf
+-eu x=1 sed printf awk "$1" cd grep sed sed "$@" 2>/dev/null
+	then echo --verbose && $(pwd) cd done 'quoted text' test local 2>/dev/null
+-eu /usr/bin done then && local 'quoted text' |
+	| "$1" export x=1 x=1 "$@" test ${HOME} awk readonly
+${HOME} test then sed local echo $(pwd)
+	"$@" $(pwd) "$1" 'quoted text' /usr/bin
+	"$@" grep sed 2>/dev/null done readonly grep &&
+awk export printf 'quoted text' done | export x=1 -eu "$@" sed $(pwd) echo
+		then awk export cd echo local export /usr/bin 2>/dev/null --verbose "$1" sed
+	test grep /usr/bin | grep readonly echo "$@" sed test readonly cd export
+	${HOME} done local 'quoted text' sed | local 2>/dev/null cd x=1 readonly
+awk -eu sed then "$1" x=1 test 2>/dev/null test 'quoted text' 'quoted text'
+'quoted text' | "$1" ${HOME} cd $(pwd)
+		&& /usr/bin 'quoted text' | x=1
+"$1" "$@" -eu done 2>/dev/null /usr/bin --verbose awk x=1
+local done 2>/dev/null "$@" | echo /usr/bin awk --verbose
+	echo $(pwd) then "$1" $(pwd) then echo export
+--verbose 2>/dev/null readonly /usr/bin then local done &&
+		readonly $(pwd) /usr/bin export "$@" awk cd 'quoted text' export -eu test
+"$@" -eu -eu printf test
+done -eu test --verbose sed 'quoted text' grep local "$@"
+printf done echo then "$@" echo
+printf sed $(pwd) $(pwd)
+		done ${HOME} && | readonly ${HOME} $(pwd) x=1 "$1"
+		test awk then | awk 2>/dev/null "$@" "$1"
+	test printf sed 'quoted text' grep
+	${HOME} -eu -eu readonly "$1" 'quoted text' awk
+		export -eu readonly export ${HOME} $(pwd) done sed /usr/bin
+		awk x=1 --verbose then cd then
+		"$1" "$@" 2>/dev/null done printf readonly test echo
+x=1 echo 2>/dev/null "$1" printf "$@" x=1 --verbose grep /usr/bin local && done
+		grep ${HOME} grep -eu local then
+echo then sed test readonly awk echo
+x=1 test readonly | readonly done awk export
+then | grep printf ${HOME} printf cd sed 'quoted text' readonly $(pwd) echo
+then sed local -eu | test
+	"$@" "$1" && readonly x=1 export local awk "$1" then "$1" local local
+2>/dev/null "$1" cd 2>/dev/null printf echo x=1 && export ${HOME}
+		| && readonly echo test local grep ${HOME} sed export then awk local /usr/bin
+then -eu 'quoted text' awk
+		readonly local && /usr/bin
+	-eu x=1 --verbose printf awk then readonly
+		cd && done "$@" grep -eu echo "$@" "$1" cd /usr/bin "$@" "$@" then
+		$(pwd) --verbose awk | x=1 export /usr/bin
+--verbose ${HOME} 2>/dev/null test ${HOME} ${HOME} awk awk
+readonly export $(pwd) grep -eu "$1"
+	done done echo cd $(pwd) | "$@" | done | 2>/dev/null readonly
+		&& $(pwd) "$1" | "$@" awk $(pwd) test test awk then
+	&& ${HOME} grep x=1 cd
+		local 2>/dev/null local -eu echo then "$1" 'quoted text'
+cd echo awk sed x=1 echo && "$@" echo
+	"$1" /usr/bin && && local -eu /usr/bin "$1"
+	$(pwd) sed | $(pwd) --verbose x=1 $(pwd) awk awk && done ${HOME}
+x=1 local export then
+	-eu ${HOME} | 'quoted text' awk x=1 | 'quoted text' readonly "$@" 2>/dev/null
+		printf "$@" 'quoted text' printf | "$1" "$@" | readonly -eu 'quoted text'
+	"$1" export local test ${HOME} done echo "$@" 2>/dev/null echo done readonly
+2>/dev/null grep echo echo 'quoted text'
+	| done sed && awk ${HOME} readonly
+		export readonly readonly x=1 cd then grep then
+"$@" /usr/bin /usr/bin then echo cd cd ${HOME} &&
+then $(pwd) readonly $(pwd) /usr/bin
+		then test local awk test --verbose ${HOME} export
+		'quoted text' test local 'quoted text' | $(pwd) /usr/bin
+		$(pwd) -eu done "$@" grep export
+--verbose $(pwd) -eu | local /usr/bin
+		test then --verbose && x=1 2>/dev/null cd ${HOME} "$1"
+printf printf -eu printf grep sed
+readonly | "$@" x=1 then 'quoted text' --verbose
+		export echo -eu grep -eu sed test echo done done local
+x=1 local x=1 'quoted text' /usr/bin grep ${HOME} printf done grep
+		test test export "$@" echo x=1 export cd /usr/bin readonly
+	local $(pwd) -eu printf sed | "$1" | done printf test export /usr/bin
+		local -eu && "$1" test awk 2>/dev/null awk cd | | 'quoted text' then printf
+	/usr/bin cd echo printf then --verbose
+echo grep echo | -eu /usr/bin ${HOME}
+| x=1 | | readonly -eu local grep grep
+/usr/bin local && printf -eu x=1 "$1" echo local export
+		local "$@" awk then then $(pwd) "$@" && && -eu -eu grep --verbose -eu /usr/bin local
+		then | sed -eu done then printf "$@"
+	awk /usr/bin $(pwd) "$@" cd --verbose test /usr/bin 2>/dev/null
+	--verbose export "$1" awk grep | ${HOME}
+	/usr/bin -eu 'quoted text' export export && && grep printf && awk 2>/dev/null
+'quoted text' grep sed cd "$1" $(pwd)
+	x=1 awk "$1" grep readonly local -eu ${HOME}
+	cd ${HOME} --verbose readonly
+		echo --verbose x=1 test -eu echo --verbose
+	export cd && readonly grep "$@" cd
+		test printf readonly test 2>/dev/null sed grep test export then sed test readonly
+	done x=1 'quoted text' then
+| echo x=1 echo grep ${HOME} --verbose then local /usr/bin /usr/bin 2>/dev/null
+		'quoted text' /usr/bin ${HOME}
+"$@" --verbose then test readonly test $(pwd) |
+	export sed done local sed $(pwd) $(pwd) readonly
+	readonly awk readonly 2>/dev/null
+		sed export 2>/dev/null then echo export /usr/bin 2>/dev/null
+		"$@" "$@" test /usr/bin echo local test grep echo x=1
+--verbose done readonly "$1" then echo echo -eu grep awk -eu sed /usr/bin | "$1"
+${HOME} "$@" awk cd 2>/dev/null echo local
+"$@" done sed local done printf $(pwd) sed && /usr/bin
+then && export then x=1 cd /usr/bin grep printf cd grep | "$1" /usr/bin awk
+"$1" 'quoted text' awk "$1" --verbose | x=1
+"$@" done | "$@" done -eu awk local && ${HOME} then | "$1" 'quoted text'
+	done then && && -eu && readonly sed readonly export
+		"$@" "$@" grep | awk "$@" printf $(pwd) | cd
+local 2>/dev/null 2>/dev/null then cd |
+		echo ${HOME} sed printf && echo | readonly export --verbose awk export
+		awk readonly $(pwd) "$@" --verbose sed x=1 export
+cd readonly x=1 $(pwd) --verbose readonly printf x=1
+&& then ${HOME} sed x=1 x=1 "$@" -eu "$1" done ${HOME}
+$(pwd) $(pwd) && ${HOME} local
+		test --verbose sed --verbose export readonly /usr/bin
+		done x=1 local readonly done
+		sed "$@" && sed x=1 && x=1 --verbose /usr/bin /usr/bin
+		printf --verbose ${HOME} -eu echo ${HOME} local "$@" export --verbose
+	--verbose ${HOME} "$@" | then sed cd && printf 2>/dev/null
+--verbose export -eu && test test && test -eu x=1 test grep echo -eu 'quoted text'
+		cd awk export then grep /usr/bin 2>/dev/null export
+	--verbose "$@" "$@" grep "$@" /usr/bin 2>/dev/null
+/usr/bin awk /usr/bin 2>/dev/null sed -eu | $(pwd) -eu cd -eu echo awk
+	grep ${HOME} awk printf | "$1" && printf -eu /usr/bin echo 2>/dev/null cd
+		-eu readonly export printf $(pwd) 'quoted text' export done
+	sed grep cd cd cd && x=1 cd test printf ${HOME} /usr/bin
+		done awk | ${HOME} "$1" && -eu sed && test --verbose
+	-eu ${HOME} cd "$@" readonly x=1 readonly --verbose --verbose export x=1
+	done test cd done sed echo grep 2>/dev/null
+	x=1 ${HOME} cd -eu echo grep 2>/dev/null cd local $(pwd)
+	done done "$@" 2>/dev/null echo cd ${HOME} $(pwd) grep ${HOME}
+	then "$@" grep then done --verbose then | cd local test | "$1" sed done cd grep
+	test "$@" 'quoted text' awk $(pwd) export readonly x=1 readonly
+	'quoted text' echo 2>/dev/null readonly cd done $(pwd) cd
+		local awk sed "$1" x=1 test "$1" sed echo local then sed "$1"
+		x=1 && local "$1" export grep done
+		then test | grep awk done /usr/bin
+sed /usr/bin x=1 printf
+printf export echo sed "$1" cd cd "$@" test then "$@" grep 'quoted text'
+	sed done && done sed --verbose --verbose "$1" export
+| readonly --verbose done
+-eu sed 'quoted text' done "$1"
+		export $(pwd) cd -eu done x=1 2>/dev/null readonly "$@" printf done $(pwd)
+grep 2>/dev/null "$@" | 2>/dev/null ${HOME} ${HOME} && grep export --verbose
+	&& done "$1" cd then 2>/dev/null
+grep | 2>/dev/null readonly 2>/dev/null local 'quoted text'
+--verbose && "$1" local | 2>/dev/null sed
+		printf readonly "$@" x=1 sed -eu local test && sed
+		sed printf awk then && sed awk grep cd | test sed $(pwd) then echo awk sed --verbose
+	cd awk && local export readonly
+	export --verbose sed grep sed printf ${HOME}
+		then cd && && "$@" | 'quoted text' -eu cd readonly
+	done sed cd --verbose ${HOME} then export test
+x=1 then /usr/bin awk readonly local test
+| x=1 "$@" sed export --verbose cd then ${HOME} sed --verbose 2>/dev/null && /usr/bin
+	echo -eu printf printf echo echo local 'quoted text'
+	test echo awk /usr/bin -eu then | x=1 readonly /usr/bin cd && test awk $(pwd)
+local $(pwd) cd export then awk | $(pwd) done /usr/bin x=1
+		readonly 2>/dev/null "$@" echo "$1" /usr/bin "$@"
+		local -eu sed 'quoted text' 2>/dev/null
+	'quoted text' 'quoted text'
+	printf -eu ${HOME} sed
+	cd local grep then export printf export 2>/dev/null
+	echo "$1" echo sed x=1 local echo 2>/dev/null --verbose 2>/dev/null -eu --verbose
+		printf readonly export ${HOME} done export
+"$@" ${HOME} sed printf echo test local
+	${HOME} | local printf then /usr/bin readonly
+2>/dev/null "$@" sed grep ${HOME} printf x=1 'quoted text'
+	cd export awk --verbose 2>/dev/null --verbose
+		| --verbose echo x=1 local && -eu ${HOME} "$1" sed then
+2>/dev/null printf cd then grep readonly /usr/bin readonly "$1" local | /usr/bin
+	then $(pwd) --verbose printf export
+	printf "$@" echo export "$@"
+	test readonly echo --verbose && then cd test then grep export -eu
+--verbose test grep done test test test /usr/bin
+echo printf sed sed done awk 'quoted text' sed $(pwd) sed
+		--verbose done then "$1" readonly $(pwd) 'quoted text'
+		local test done grep ${HOME} -eu $(pwd) 'quoted text'
+-eu export "$@" done export x=1 readonly echo test 'quoted text' echo
+	${HOME} 'quoted text' --verbose ${HOME} export -eu $(pwd) done
+	$(pwd) x=1 --verbose "$1" cd 'quoted text'
+	&& /usr/bin cd && -eu printf sed export
+done ${HOME} /usr/bin cd printf done then sed echo "$1" then grep then sed
+		cd done cd ${HOME} done sed 2>/dev/null 2>/dev/null
+-eu $(pwd) "$@" awk echo readonly sed then | $(pwd) $(pwd) | cd local 2>/dev/null
+		echo export sed ${HOME} echo /usr/bin 'quoted text'
+		done export x=1 cd -eu "$1" 2>/dev/null
+cd -eu local printf grep && /usr/bin
+$(pwd) | "$1" printf then $(pwd) --verbose
+$(pwd) grep grep | cd "$1" 2>/dev/null $(pwd) cd --verbose "$1" -eu x=1 local
+	test 'quoted text' 'quoted text' $(pwd) "$@" test sed -eu -eu done test
+$(pwd) test awk --verbose echo 'quoted text' local "$@" printf && "$1" printf
+	then && done "$1" sed printf "$@" done local --verbose
+		-eu export -eu sed export sed readonly $(pwd) printf awk sed echo
+	$(pwd) done grep 2>/dev/null test readonly 2>/dev/null export
+${HOME} && export then grep
+		"$1" awk grep printf then printf done then export
+	$(pwd) $(pwd) -eu then grep | test ${HOME} readonly
+	| local "$1" "$1" -eu test && ${HOME} printf grep awk --verbose
+	2>/dev/null local 'quoted text' grep "$1" "$1" readonly ${HOME} && -eu --verbose
+$(pwd) | "$1" sed 'quoted text' -eu grep grep && readonly | /usr/bin
+then test /usr/bin ${HOME} /usr/bin | export test && -eu "$1" x=1 test
+awk /usr/bin readonly --verbose test export grep grep -eu local sed
+done export 2>/dev/null local /usr/bin grep 'quoted text'
+printf | then local cd sed && -eu grep test 2>/dev/null
+	--verbose "$1" --verbose "$@" then
+	'quoted text' grep | "$1" readonly |
+		"$1" grep sed cd -eu done x=1 test printf $(pwd) 2>/dev/null sed | /usr/bin 2>/dev/null
+2>/dev/null done local 2>/dev/null
+cd done --verbose test readonly grep sed 2>/dev/null grep then export
+		&& readonly sed "$@" printf /usr/bin sed then
+/usr/bin 2>/dev/null 2>/dev/null export | 'quoted text' sed 'quoted text'
+then && && --verbose x=1 echo --verbose | 2>/dev/null && readonly && && ${HOME}
+		readonly 'quoted text' $(pwd) then awk echo "$@" cd then -eu grep local grep
+	then --verbose $(pwd) readonly && "$1" awk local /usr/bin "$@" done cd
+	2>/dev/null --verbose awk then ${HOME} echo printf done
+		'quoted text' x=1 /usr/bin export cd 'quoted text' readonly test
+	"$@" $(pwd) done local "$1" x=1 local "$@" local sed "$@" test done -eu
+| 'quoted text' local x=1 "$1" awk local --verbose
+printf printf "$1" "$@" readonly
+	x=1 then && export done cd grep "$@" -eu readonly then export | grep x=1
+		grep export $(pwd) printf
+awk x=1 "$@" "$@" x=1 && then awk /usr/bin --verbose $(pwd)
+		grep grep grep --verbose 2>/dev/null
+	-eu && x=1 -eu awk test then then "$1" 2>/dev/null
+		cd test 'quoted text' grep 2>/dev/null test sed 2>/dev/null
+		local /usr/bin test 'quoted text'
+		then x=1 local then && 'quoted text' test --verbose done $(pwd) --verbose cd
+		x=1 sed awk readonly "$@"
+		done sed test && cd 'quoted text' awk x=1
+${HOME} | then cd $(pwd) local
+done x=1 cd readonly grep && --verbose then awk sed sed 'quoted text'
+then then /usr/bin ${HOME} local export local echo 2>/dev/null grep --verbose
+		test "$1" readonly local done done x=1 cd "$@"
+		sed then printf | grep export --verbose && | x=1 /usr/bin 2>/dev/null
+"$@" $(pwd) /usr/bin cd readonly awk 2>/dev/null grep cd echo
+		'quoted text' 'quoted text' grep 2>/dev/null
+| /usr/bin 'quoted text' sed ${HOME} test grep done 'quoted text'
+	x=1 "$@" -eu sed --verbose printf --verbose x=1 "$@" then sed | grep readonly
+	"$@" local grep /usr/bin export "$1"
+| "$1" 'quoted text' export "$@" local | -eu 2>/dev/null /usr/bin &&
+	"$1" then | grep && echo printf test done "$1" cd 'quoted text' readonly && 2>/dev/null
+	export grep test printf printf
+		done cd | done done "$1" test "$@" && readonly ${HOME} --verbose x=1
+	readonly readonly "$1" && && printf
+		| "$@" echo ${HOME} |
+printf "$@" printf grep 2>/dev/null 'quoted text' test local
+		echo 2>/dev/null local sed test test --verbose && x=1 'quoted text'
+	"$@" test export export | test cd export test local printf
+--verbose cd printf 'quoted text' "$@" awk && && echo export "$@" sed $(pwd)
+-eu echo --verbose done "$@"
+	/usr/bin x=1 "$1" "$1" --verbose sed /usr/bin -eu --verbose
+		2>/dev/null echo printf then readonly readonly
+sed | && echo test awk -eu awk 'quoted text' "$1"
+		&& x=1 test ${HOME} awk sed then | readonly | printf readonly "$@" x=1 "$1"
+	readonly $(pwd) 2>/dev/null cd grep
+		/usr/bin --verbose /usr/bin cd "$1" ${HOME} echo
+"$@" then export done done local echo x=1 grep $(pwd) && "$@" x=1
+	/usr/bin ${HOME} ${HOME} x=1 then printf -eu | sed "$1"
+		then "$@" readonly -eu /usr/bin 2>/dev/null then x=1 local --verbose test
+		local export $(pwd) grep export printf --verbose echo "$@"
+	sed export awk grep export --verbose && printf "$@" cd
+test sed awk grep 2>/dev/null export done 'quoted text' | grep
+		| local "$@" "$@" 2>/dev/null local readonly local $(pwd) --verbose sed
+	test sed x=1 cd cd 2>/dev/null
+	awk --verbose done awk readonly sed cd --verbose done readonly --verbose
+	printf cd cd ${HOME} done done readonly awk "$1" cd /usr/bin sed
+		/usr/bin /usr/bin "$@" ${HOME} "$@"
+		sed | cd then cd -eu 2>/dev/null echo && local readonly "$1" "$1" sed "$1"
+		then cd grep done echo printf readonly then export printf local
+readonly awk awk 'quoted text' sed $(pwd) cd x=1 grep 2>/dev/null
+		2>/dev/null local sed grep "$@" cd && readonly readonly local done -eu
+		"$1" export grep 2>/dev/null cd sed && "$1"
+readonly cd ${HOME} echo 2>/dev/null test then local | "$1" ${HOME}
+	local --verbose cd export && readonly local readonly export then 'quoted text'
+	x=1 awk /usr/bin local "$@" 2>/dev/null printf grep done
+	done grep "$1" 2>/dev/null readonly
+	$(pwd) readonly cd $(pwd) $(pwd) echo
+		local test ${HOME} then -eu --verbose /usr/bin readonly done cd grep readonly
+x=1 2>/dev/null cd "$1" test
+readonly grep echo x=1 export export grep 'quoted text'
+	2>/dev/null cd echo --verbose done export -eu awk | | | printf
+		x=1 readonly $(pwd) then then printf readonly "$@" test echo
+		-eu "$1" awk && export "$@" cd -eu ${HOME} "$1" 2>/dev/null export
+	awk | /usr/bin | done ${HOME} x=1 | then "$@" 'quoted text' export ${HOME} grep
+		cd test ${HOME} "$1" awk 'quoted text' "$1" readonly
+	cd done cd then printf then 2>/dev/null export awk "$1" printf
+${HOME} printf cd && $(pwd) awk ${HOME} readonly $(pwd) x=1 test cd
+	"$@" awk "$1" ${HOME} sed sed done test printf ${HOME} | printf printf
+readonly "$@" readonly "$1" local 'quoted text'
+		then then awk $(pwd) readonly && awk x=1 --verbose "$1"
+	printf /usr/bin test sed done 2>/dev/null
+cd | local --verbose grep 'quoted text' sed
+	"$1" | export x=1 grep test /usr/bin
+${HOME} cd printf x=1
+-eu local -eu local x=1 "$@" readonly export 'quoted text'
+		&& "$1" /usr/bin 2>/dev/null readonly cd printf
+		grep echo x=1 then printf awk "$1" readonly awk done "$1" awk cd ${HOME}
+	x=1 && then done /usr/bin done &&
+		sed readonly awk /usr/bin test ${HOME} done
+"$@" x=1 readonly | /usr/bin "$@" 'quoted text' "$@"
+then "$1" ${HOME} done grep
+--verbose "$1" "$@" echo done ${HOME} --verbose echo
+awk grep done test test readonly 2>/dev/null
+		readonly sed readonly cd -eu /usr/bin 2>/dev/null x=1 then | "$@"
+	local --verbose $(pwd) printf -eu && export sed "$@" printf
+done $(pwd) $(pwd) then "$1" then done printf
+	export then -eu x=1 export 'quoted text'
+	grep then test awk grep readonly echo $(pwd) "$@" | local ${HOME} $(pwd)
+		$(pwd) -eu done 'quoted text'
+		readonly && ${HOME} -eu 'quoted text' --verbose cd printf sed printf echo "$@"
+		grep ${HOME} printf export export echo && grep echo grep -eu ${HOME} readonly &&
+	printf sed then printf awk cd awk 'quoted text'
+$(pwd) done readonly cd 'quoted text' 2>/dev/null export local cd printf readonly
+	/usr/bin test readonly awk /usr/bin 'quoted text' "$@" && readonly
+	sed cd $(pwd) -eu local | then && /usr/bin
+	cd && "$1" -eu 2>/dev/null local sed test cd x=1 'quoted text' 2>/dev/null
+	'quoted text' "$1" | -eu export /usr/bin done then grep $(pwd) export
+		printf cd 'quoted text' printf && 'quoted text'
+		cd readonly /usr/bin $(pwd) x=1
+/usr/bin "$1" cd printf 2>/dev/null
+	x=1 2>/dev/null $(pwd) | cd ${HOME}
+	&& cd grep export then --verbose && printf ${HOME} done test echo printf /usr/bin
+	echo | && "$@" x=1 'quoted text' grep | "$@" echo --verbose awk $(pwd) readonly
+/usr/bin printf done then
+	printf 'quoted text' 'quoted text'
+'quoted text' grep readonly &&
+$(pwd) printf printf awk && export
+		"$@" echo /usr/bin printf $(pwd) echo echo x=1 test -eu x=1 readonly /usr/bin readonly
+readonly readonly --verbose then $(pwd) printf printf 2>/dev/null "$@"
+readonly printf 'quoted text' grep readonly local && ${HOME} "$1" ${HOME} sed
+		| test grep $(pwd) sed printf /usr/bin
+		then -eu awk printf 2>/dev/null x=1 cd /usr/bin echo sed then && test
+		cd /usr/bin | done test /usr/bin done grep export --verbose && cd export sed
+		printf awk export grep echo then test --verbose
+	2>/dev/null awk then 'quoted text' export --verbose
+sed 'quoted text' sed readonly echo printf
+		awk cd export /usr/bin ${HOME}
+${HOME} local $(pwd) 'quoted text'
+$(pwd) "$@" grep x=1 $(pwd) 2>/dev/null done
+	-eu "$1" "$1" awk --verbose /usr/bin "$1" --verbose readonly 2>/dev/null
+		"$1" then echo awk 2>/dev/null $(pwd) 'quoted text' "$1"
+then cd ${HOME} awk sed sed 'quoted text'
+	${HOME} /usr/bin $(pwd)
+		| --verbose printf sed -eu readonly
+	then sed cd export "$@" sed
+		export "$@" $(pwd) --verbose && grep done grep
+	grep cd | export printf | ${HOME} && "$@" $(pwd) "$@" echo
+	/usr/bin "$@" /usr/bin grep test 2>/dev/null
+printf /usr/bin printf --verbose cd | x=1 test ${HOME}
+-eu printf export x=1 -eu export 2>/dev/null
+	x=1 | sed "$1" test export
+grep local local ${HOME} --verbose -eu ${HOME} /usr/bin
+		sed awk then test then "$1"
+${HOME} /usr/bin x=1 "$1" cd && "$@" awk 'quoted text' cd "$@" /usr/bin
+	echo | done "$1" --verbose export -eu done
+grep printf -eu local 'quoted text' sed awk $(pwd) "$@" sed sed grep "$1"
+		&& readonly -eu "$1" test
+"$1" done cd export /usr/bin 2>/dev/null 2>/dev/null | done -eu grep
+		test /usr/bin ${HOME} cd test
+		| then | done readonly export "$@" export sed echo "$@" then
+	"$1" readonly && then sed ${HOME} --verbose 'quoted text' -eu
+${HOME} test grep echo x=1 $(pwd) ${HOME} test then awk printf -eu
+readonly awk /usr/bin -eu export
+then readonly readonly test local $(pwd)
+		done echo 'quoted text' sed local "$1" readonly then
+	grep 2>/dev/null awk export sed cd -eu -eu -eu cd readonly
+		printf test test /usr/bin
+-eu readonly "$@" printf 'quoted text' readonly 2>/dev/null
+"$1" --verbose done awk
+		"$@" awk sed echo awk ${HOME} ${HOME} grep
+echo x=1 export /usr/bin 2>/dev/null x=1
+sed test 'quoted text' /usr/bin local "$1" --verbose x=1
+test local "$@" /usr/bin test $(pwd) | export echo
+echo && test "$@" && export then test printf test readonly
+	"$1" "$1" then /usr/bin
+&& 'quoted text' /usr/bin
+	&& "$1" awk export && local ${HOME}
+		/usr/bin | --verbose | test grep "$1" then sed
+sed 'quoted text' ${HOME} | awk echo && -eu then cd x=1 sed local local readonly
+	"$@" "$1" 2>/dev/null ${HOME} then -eu 'quoted text' x=1 test awk
+		printf --verbose echo sed "$1" && "$1" awk cd sed cd test awk readonly export
+		| readonly test -eu "$@" /usr/bin printf "$@" "$1" ${HOME} $(pwd) | 2>/dev/null
+		then ${HOME} /usr/bin cd readonly x=1 -eu $(pwd) test --verbose
+		then done awk done readonly -eu cd cd test -eu 2>/dev/null x=1
+	printf "$1" grep grep echo x=1 --verbose
+	"$@" test x=1 --verbose grep grep -eu | export
+	then "$1" --verbose awk -eu 2>/dev/null "$1" "$@"
+	done --verbose then x=1 -eu -eu export grep export $(pwd)
+	&& x=1 $(pwd) grep cd 'quoted text' awk "$1" test echo "$1" x=1 grep
+"$1" echo x=1 'quoted text'
+		| cd 2>/dev/null grep $(pwd) 'quoted text' echo done "$@" cd "$1" export
+local "$1" x=1 echo readonly readonly
+awk -eu -eu awk x=1 $(pwd) -eu
+		-eu export && readonly x=1 'quoted text' done
+		-eu "$1" $(pwd) --verbose grep awk /usr/bin grep
+	printf local --verbose grep "$1" "$@" printf ${HOME} then test 2>/dev/null x=1
+	printf ${HOME} "$1" "$@" export sed export "$@" 'quoted text'
+readonly $(pwd) local /usr/bin "$@"
+test cd | ${HOME} x=1 -eu test && && grep done
+	--verbose cd echo x=1 "$1" 'quoted text' readonly then local done
+		test echo local ${HOME} awk test done local ${HOME} readonly /usr/bin "$@" readonly
+	-eu -eu $(pwd) echo "$1" readonly --verbose "$1" | cd --verbose
+2>/dev/null sed "$1" && --verbose done
+	awk ${HOME} done cd cd /usr/bin --verbose "$1" x=1 /usr/bin
+	| 2>/dev/null 'quoted text'
+		--verbose echo then 2>/dev/null "$1" then sed export 'quoted text' -eu x=1 'quoted text'
+		printf local grep 2>/dev/null cd -eu echo && export
+		"$@" export done $(pwd) 2>/dev/null "$1" "$1" -eu x=1 local
+		then -eu local 'quoted text' "$@" | sed 'quoted text'
+		-eu cd test ${HOME} x=1 x=1 2>/dev/null -eu 2>/dev/null test 'quoted text'
+		--verbose printf cd -eu ${HOME} export && export cd
+		--verbose 2>/dev/null grep "$@" $(pwd) | printf -eu echo 'quoted text' readonly
+&& "$@" 'quoted text' /usr/bin
+&& cd 'quoted text' -eu | export x=1 "$1"
+	sed then readonly then readonly done printf 'quoted text' $(pwd) cd | cd $(pwd)
+	--verbose sed cd done 'quoted text'
+	&& printf "$1" --verbose then
+	local | 2>/dev/null done && printf
+	local awk test /usr/bin readonly awk /usr/bin local grep
+"$1" --verbose test "$@" $(pwd) ${HOME} && -eu
+	test done "$@" $(pwd) ${HOME} printf local sed 'quoted text'
+		-eu "$@" then echo awk printf readonly awk --verbose
+	printf grep /usr/bin 2>/dev/null export
+	sed export local ${HOME} cd printf | 'quoted text' /usr/bin
+		"$1" "$@" -eu then $(pwd) sed | local
+	2>/dev/null then cd 'quoted text' cd cd
+awk grep local $(pwd) 2>/dev/null local local test readonly test
+		then && cd /usr/bin export readonly awk sed /usr/bin awk
+		awk 2>/dev/null "$@" awk /usr/bin -eu "$1" --verbose
+	| x=1 | echo ${HOME} $(pwd) grep
+x=1 $(pwd) && ${HOME} | test 'quoted text'
+		'quoted text' awk awk 'quoted text' cd cd --verbose printf echo /usr/bin 'quoted text'
+		-eu export -eu "$1" "$@" local printf done local
+		/usr/bin awk local /usr/bin local local && -eu
+sed /usr/bin x=1 cd ${HOME} "$@"
+		'quoted text' test 'quoted text' awk /usr/bin ${HOME} $(pwd) ${HOME}
+	x=1 -eu "$1" done grep test "$1" && then | cd export cd 'quoted text' && test
+	${HOME} echo /usr/bin ${HOME}
+grep ${HOME} 2>/dev/null printf
+2>/dev/null --verbose -eu export printf echo
+"$1" awk ${HOME} readonly readonly -eu | test 2>/dev/null
+		cd echo -eu && "$1" 2>/dev/null --verbose test awk $(pwd) --verbose
+	test "$1" 2>/dev/null --verbose readonly
+grep printf -eu cd /usr/bin
+echo readonly $(pwd) 2>/dev/null && 2>/dev/null grep
+		echo grep cd x=1 | then /usr/bin -eu && cd -eu cd && -eu done awk 'quoted text'
+		2>/dev/null cd "$1" 'quoted text'
+		2>/dev/null "$1" then "$@" /usr/bin
+		echo ${HOME} awk printf local then local grep sed
+awk 'quoted text' /usr/bin printf
+"$1" --verbose | /usr/bin export local $(pwd)
+	then /usr/bin "$1" 2>/dev/null done local --verbose
+	2>/dev/null | printf | test readonly printf sed local | $(pwd)
+	"$1" cd test export | readonly $(pwd) test export cd done
+	test echo x=1 | echo "$1" "$@" $(pwd) cd $(pwd) "$1" x=1 /usr/bin export 'quoted text'
+	grep "$@" test readonly x=1 grep then "$1" echo ${HOME}
+		--verbose echo 'quoted text' sed 2>/dev/null
+		awk sed grep -eu then 2>/dev/null export
+	local $(pwd) "$1" test done -eu awk 'quoted text' && $(pwd)
+	echo -eu printf readonly printf 2>/dev/null
+| printf echo readonly echo
+	--verbose ${HOME} x=1 done then then cd awk "$1" awk x=1 awk grep
+	then awk -eu | cd grep export
+test echo done ${HOME} "$1" x=1
+--verbose "$@" $(pwd) 2>/dev/null --verbose
+	2>/dev/null --verbose printf printf export "$1" ${HOME} 2>/dev/null awk "$1"
+	readonly readonly 'quoted text' echo readonly ${HOME} ${HOME} /usr/bin
+		echo "$1" readonly --verbose awk done /usr/bin then | 'quoted text' 'quoted text'
+"$@" sed export -eu "$@" grep export
+	2>/dev/null then ${HOME} --verbose echo ${HOME}
+-eu grep export "$1" export ${HOME} && $(pwd)
+$(pwd) | --verbose printf grep export "$@" "$1"
+		2>/dev/null cd export echo "$@" then readonly
+		/usr/bin then 2>/dev/null then $(pwd)
+"$1" | "$1" export "$@" printf cd $(pwd) && awk printf echo $(pwd)
+"$@" printf readonly "$@" echo echo sed -eu --verbose | done $(pwd) | --verbose
+done then grep /usr/bin "$@" && done export && then
+		export "$1" sed && printf --verbose 2>/dev/null
+	"$@" local then local done sed cd 2>/dev/null -eu "$1" sed 'quoted text'
+	grep ${HOME} /usr/bin
+		"$1" awk -eu local && cd test local then "$@" done grep 2>/dev/null
+		| -eu && --verbose readonly
+	sed 'quoted text' local "$@" $(pwd) 'quoted text' local /usr/bin
+	'quoted text' awk "$@" "$@" x=1 x=1 -eu local readonly --verbose -eu
+	| | "$1" done sed export 'quoted text' && --verbose 2>/dev/null x=1 cd
+awk && $(pwd) sed grep 'quoted text'
+		grep then ${HOME} "$1" echo ${HOME} ${HOME}
+		&& 2>/dev/null local sed /usr/bin | "$@" --verbose | x=1
+	sed ${HOME} x=1 --verbose cd printf test "$@" awk
+	/usr/bin -eu && printf /usr/bin "$1" "$@" 'quoted text' $(pwd) done && -eu
+	$(pwd) export then ${HOME} printf readonly printf
+grep /usr/bin "$@" readonly then sed ${HOME} printf local readonly
+	sed --verbose readonly echo done printf "$@" grep
+2>/dev/null echo x=1 then
+		${HOME} && -eu then --verbose echo cd -eu x=1 export
+		"$1" "$1" "$1" -eu cd readonly /usr/bin /usr/bin readonly export grep 'quoted text'
+$(pwd) --verbose 'quoted text' ${HOME}
+	"$@" --verbose $(pwd) awk ${HOME} -eu cd export test then x=1 readonly
+	2>/dev/null 2>/dev/null | $(pwd) readonly | local "$@" "$@" printf done
+/usr/bin "$@" then && readonly "$1" awk grep readonly
+	local "$1" && readonly printf export -eu local printf export cd --verbose
+cd 2>/dev/null "$@" $(pwd)
+readonly local cd done x=1 printf readonly --verbose ${HOME} export test
+		echo -eu grep readonly export
+2>/dev/null cd ${HOME} && printf export test local x=1 $(pwd) /usr/bin
+test test echo export --verbose -eu test 'quoted text'
+	'quoted text' readonly -eu && --verbose echo ${HOME} "$1" cd local
+	export x=1 | awk grep readonly | echo cd $(pwd) then grep
+		export /usr/bin export local
+		local 2>/dev/null | "$1" $(pwd) then "$1" cd "$1" sed grep x=1
+| /usr/bin 2>/dev/null 2>/dev/null $(pwd) 'quoted text' | "$@"
+sed /usr/bin 2>/dev/null echo echo readonly /usr/bin x=1 then cd -eu /usr/bin |
+-eu "$@" local readonly printf --verbose "$@" x=1 readonly echo test awk $(pwd)
+sed x=1 test 2>/dev/null --verbose echo export "$1"
+$(pwd) 'quoted text' 2>/dev/null test echo /usr/bin export grep cd readonly
+	"$1" "$@" awk x=1 then && 2>/dev/null $(pwd) 'quoted text' test $(pwd) /usr/bin
+		printf readonly echo awk echo x=1 printf
+		local awk x=1 /usr/bin x=1 "$1" ${HOME} sed sed echo | && && cd done /usr/bin
+--verbose "$1" echo sed $(pwd) 'quoted text' 'quoted text'
+		| awk readonly 'quoted text' cd local
+		${HOME} echo x=1 local "$@" $(pwd) sed && then cd then "$@" | x=1 -eu
+	-eu && done /usr/bin $(pwd)
+	test done x=1 printf test 'quoted text' local grep cd grep awk && awk test then
+${HOME} 2>/dev/null sed --verbose awk "$1" export
+--verbose $(pwd) $(pwd) "$1" local && && 'quoted text'
+local readonly "$1" x=1 test && awk x=1 test then local | "$@" x=1 done cd -eu
+readonly ${HOME} 2>/dev/null
+x=1 readonly awk then readonly --verbose
+cd "$@" then printf awk | grep "$@" local grep printf --verbose /usr/bin "$@"
+awk && then then x=1 printf $(pwd) ${HOME}
+	| printf $(pwd) grep $(pwd) /usr/bin done 'quoted text' readonly
+		| "$@" 'quoted text' ${HOME} awk
+		"$1" test | cd /usr/bin sed done $(pwd) "$@" "$@" 2>/dev/null
+		"$1" --verbose printf test | | ${HOME} ${HOME} readonly -eu awk readonly
+	| grep "$@" && 2>/dev/null cd x=1 awk 2>/dev/null && grep grep
+test /usr/bin awk local
+		"$1" --verbose "$@" 'quoted text' $(pwd) "$1"
+		done echo export sed sed printf | readonly && ${HOME} x=1 'quoted text'
+printf test "$@" 2>/dev/null readonly
+then sed cd 2>/dev/null export && 2>/dev/null | export && printf cd test local
+	-eu export done -eu done --verbose sed "$1" cd
+	then readonly local /usr/bin grep sed awk
+	sed && echo && 'quoted text'
+	echo 2>/dev/null 2>/dev/null $(pwd)
+cd cd x=1 then echo readonly test 2>/dev/null 'quoted text'
+	cd $(pwd) readonly local done
+		"$@" ${HOME} && then done && 'quoted text' grep $(pwd) 'quoted text' | cd readonly
+		then && sed "$1" --verbose "$@" cd then /usr/bin test "$1" export 'quoted text'
+	export grep -eu local --verbose "$1" /usr/bin "$@" --verbose
+		test -eu "$@" "$1" readonly export && readonly "$1" grep --verbose /usr/bin --verbose
+	grep -eu ${HOME} $(pwd) echo sed export -eu sed 'quoted text' local
+		-eu "$@" awk grep ${HOME} readonly 'quoted text'
+cd local readonly grep x=1 sed export -eu && $(pwd) | sed printf readonly
+grep then 'quoted text'
+	local /usr/bin grep x=1 done local echo
+		test 2>/dev/null grep && echo done -eu test x=1 && "$1" then readonly
+then /usr/bin printf test printf 'quoted text' | 'quoted text' export then local
+--verbose $(pwd) | echo awk
+-eu --verbose "$@" sed test 'quoted text'
+		| "$@" then 'quoted text' readonly /usr/bin 'quoted text'
+	sed --verbose --verbose test
+grep awk 2>/dev/null printf
+	'quoted text' /usr/bin
+	-eu printf cd export local "$1" local local cd x=1 done cd echo
+	export 'quoted text' done 2>/dev/null echo sed | sed awk ${HOME} "$@" -eu sed sed
+		--verbose ${HOME} export test x=1
+		sed cd echo sed cd | ${HOME} -eu done 'quoted text'
+awk done export export sed --verbose && echo sed awk -eu | $(pwd)
+-eu readonly --verbose sed readonly
+x=1 'quoted text' -eu local printf 'quoted text' readonly local
+"$1" --verbose ${HOME} x=1 local printf
+		&& awk "$@" export echo && printf readonly awk && 'quoted text'
+		-eu done x=1 export local awk && /usr/bin test
+		$(pwd) sed local readonly awk 'quoted text' | printf local export /usr/bin "$@"
+		$(pwd) -eu 2>/dev/null test export "$@"
+/usr/bin 'quoted text' sed export x=1
+'quoted text' /usr/bin "$@" 2>/dev/null awk 2>/dev/null
+export then -eu test local --verbose export "$1" $(pwd) ${HOME} ${HOME} readonly
+$(pwd) --verbose readonly 'quoted text' printf test echo grep done test cd 'quoted text'
+	"$@" x=1 export -eu "$1" then "$1" printf 2>/dev/null cd grep printf
+		awk 'quoted text' grep printf echo "$1" 'quoted text' local local "$@"
+	x=1 'quoted text' cd | test done local --verbose
+		sed then ${HOME} --verbose awk
+		"$@" $(pwd) printf test x=1 echo readonly readonly sed $(pwd)
+		2>/dev/null 2>/dev/null
+x=1 readonly /usr/bin && export
+$(pwd) "$1" "$1" $(pwd) grep
+readonly awk --verbose 'quoted text' --verbose
+local ${HOME} "$1" --verbose cd export
+	/usr/bin --verbose export test done 2>/dev/null
+		cd echo ${HOME} --verbose | | readonly
+	echo $(pwd) test "$@" local then x=1 local sed printf "$@" printf 'quoted text'
+local 'quoted text' "$1"
+	readonly printf ${HOME} done readonly | "$@" $(pwd) "$@" "$1" printf
+	&& export $(pwd) echo cd awk echo | | cd local 2>/dev/null
+	${HOME} $(pwd) awk echo ${HOME} test sed /usr/bin -eu x=1 grep
+		2>/dev/null test ${HOME} awk sed ${HOME} /usr/bin
+	/usr/bin grep /usr/bin test then 'quoted text'
+	-eu "$@" readonly 'quoted text'
+	${HOME} test sed ${HOME}
+${HOME} cd && awk readonly test echo local test
+		then 2>/dev/null grep ${HOME} "$1" x=1 && local 'quoted text' 'quoted text'
+$(pwd) cd ${HOME} sed "$@" | | -eu test /usr/bin awk local
+		$(pwd) -eu readonly --verbose echo echo test done $(pwd) test 2>/dev/null
+| 'quoted text' && "$1"
+	$(pwd) $(pwd) test "$@" ${HOME} test
+cd -eu done | readonly | readonly $(pwd) "$@" "$@" readonly
+		$(pwd) echo then cd /usr/bin readonly
+		/usr/bin printf sed /usr/bin
+	then 'quoted text' -eu &&
+	local cd echo && x=1 -eu
+		cd test local cd then local | 'quoted text' -eu echo
+	| awk 'quoted text' export && 'quoted text' echo cd local &&
+		test cd --verbose export readonly
+	"$1" ${HOME} grep ${HOME}
+		x=1 echo "$1" "$1" grep -eu "$@" test readonly
+		awk echo "$1" export --verbose 2>/dev/null --verbose /usr/bin
+		| then x=1 export local | | sed done 2>/dev/null &&
+x=1 "$1" /usr/bin sed $(pwd) awk grep readonly done /usr/bin then
+grep 'quoted text' local | --verbose printf -eu test /usr/bin sed then x=1
+	2>/dev/null ${HOME} sed
+	sed sed "$@" -eu ${HOME} -eu
+		&& $(pwd) 2>/dev/null "$@" echo awk local
+		x=1 done awk -eu | cd -eu ${HOME} awk x=1 grep -eu
+	/usr/bin sed -eu $(pwd) | readonly done sed test | printf
+		local --verbose | readonly sed
+test local printf "$@" cd sed cd echo ${HOME}
+	"$1" && cd | /usr/bin 2>/dev/null local printf -eu test
+		done awk 'quoted text' grep sed --verbose /usr/bin printf cd
+	/usr/bin test sed sed grep local awk export awk 2>/dev/null "$@" export
+	&& x=1 -eu grep /usr/bin 'quoted text'
+	cd then 'quoted text' | cd -eu
+	'quoted text' export -eu && test test -eu /usr/bin 2>/dev/null
+		${HOME} 'quoted text' -eu 2>/dev/null
+		-eu then test x=1 -eu printf && test grep x=1
+		cd "$1" cd x=1 && printf && --verbose | 'quoted text' local local
+	export -eu ${HOME} readonly awk then echo x=1 echo x=1 /usr/bin
+		${HOME} 'quoted text' /usr/bin done $(pwd) "$@"
+readonly | 2>/dev/null awk && | $(pwd) 'quoted text'
+		done | ${HOME} 'quoted text' done cd && cd --verbose cd 'quoted text'
+2>/dev/null 2>/dev/null --verbose cd ${HOME} grep test --verbose printf
+		printf sed ${HOME} done readonly
+	local /usr/bin done && 2>/dev/null then && echo cd --verbose -eu
+&& done readonly export echo awk /usr/bin then done 2>/dev/null && $(pwd)
+		${HOME} export cd test then x=1 done
+2>/dev/null && "$1" | export awk done --verbose && /usr/bin
+sed local export -eu test 2>/dev/null readonly "$@" test cd x=1 awk
+		'quoted text' ${HOME} x=1 echo 2>/dev/null | 'quoted text' "$1" ${HOME} grep
+	done && awk "$@" -eu x=1 then /usr/bin export && --verbose
+test printf test --verbose readonly | export done
+		echo echo -eu --verbose x=1 done "$@" "$@" && "$1" grep
+	awk awk readonly "$1" && then -eu /usr/bin
+	readonly 2>/dev/null --verbose -eu --verbose test "$@" x=1
+		readonly sed cd "$@" echo $(pwd)
+		printf ${HOME} done x=1 'quoted text'
+&& done ${HOME} awk done ${HOME} | then printf ${HOME} local readonly
+awk readonly -eu cd local then "$@" cd "$1" 'quoted text'
+"$@" export test printf readonly x=1 'quoted text' readonly "$@"
+test readonly x=1 $(pwd) grep export sed "$@" readonly --verbose
+"$1" 'quoted text' "$@" export test then
+	/usr/bin awk cd "$@" then -eu 2>/dev/null 'quoted text'
+		| echo readonly 'quoted text' then then cd --verbose then export
+"$@" "$1" 2>/dev/null && && cd && --verbose
+	2>/dev/null 'quoted text' sed export then awk $(pwd) awk then awk readonly echo
+&& --verbose local x=1 cd test /usr/bin awk then printf "$1" export
+	$(pwd) sed -eu $(pwd) readonly readonly export
+		then ${HOME} readonly done x=1 x=1 "$@" readonly readonly
+-eu -eu /usr/bin -eu x=1 echo | printf
+local x=1 -eu cd ${HOME} 'quoted text' /usr/bin -eu "$1" readonly --verbose
+		-eu /usr/bin done test -eu then ${HOME}
+		export sed -eu printf local "$1" done
+		"$@" sed readonly && sed readonly x=1 ${HOME} | grep 'quoted text' export
+		printf x=1 2>/dev/null | cd export ${HOME} grep
+	| x=1 ${HOME} && -eu sed
+"$@" awk cd grep awk /usr/bin
+		done awk -eu grep local ${HOME} test x=1
+	&& echo ${HOME} 'quoted text' grep readonly local test "$1"
+		x=1 export echo 2>/dev/null awk $(pwd) readonly
+	"$@" "$@" echo && /usr/bin $(pwd)
+$(pwd) echo then "$1" sed printf /usr/bin done
+/usr/bin x=1 "$1" "$@" -eu printf grep
+	local readonly echo 2>/dev/null sed test done "$@" "$1"
+	local then 2>/dev/null ${HOME} --verbose "$@" export x=1 && /usr/bin
+	cd then "$@" /usr/bin export
+--verbose cd $(pwd) test
+-eu 'quoted text' $(pwd) printf cd echo /usr/bin 2>/dev/null cd x=1 then
+		-eu sed local "$1" sed grep 2>/dev/null
+	grep printf printf 'quoted text' "$1"
+		${HOME} --verbose local local done
+		&& /usr/bin ${HOME} --verbose readonly &&
+		readonly cd test x=1
+grep local grep printf "$1" 2>/dev/null
+&& -eu printf local /usr/bin readonly && ${HOME} "$@" echo local grep /usr/bin
+		echo readonly | 2>/dev/null export done $(pwd) 'quoted text' "$@"
+	printf "$1" sed && readonly
+readonly export x=1 $(pwd) -eu x=1 sed &&
+	cd $(pwd) test awk "$@"
+		local grep $(pwd) --verbose then
+	done $(pwd) "$@" test x=1 echo echo cd ${HOME} /usr/bin
+	echo ${HOME} /usr/bin 'quoted text'
+&& && --verbose 2>/dev/null grep
+		export --verbose $(pwd) | && ${HOME}
+	/usr/bin export then x=1 export "$@" grep then -eu echo echo
+		&& echo "$1" export ${HOME}
+		--verbose cd printf "$1" x=1 done -eu sed ${HOME} test
+		-eu cd $(pwd) "$1" && "$1" printf /usr/bin
+	sed test /usr/bin --verbose
+		$(pwd) ${HOME} -eu $(pwd) test ${HOME} grep done then x=1 echo test readonly sed
+	then && echo --verbose readonly grep test grep readonly local local 'quoted text'
+/usr/bin -eu $(pwd) local echo /usr/bin x=1 sed export ${HOME} | readonly
+2>/dev/null done $(pwd) grep done $(pwd) ${HOME}
+	sed 2>/dev/null sed sed ${HOME} sed && -eu ${HOME} cd test $(pwd) export $(pwd)
+		${HOME} sed && /usr/bin echo --verbose sed local
+	test $(pwd) 'quoted text' /usr/bin awk
+done && "$@" then export awk grep printf local export
+export /usr/bin echo local sed printf awk x=1 local x=1
+		x=1 -eu /usr/bin cd cd -eu $(pwd) "$1" /usr/bin
+		"$1" printf /usr/bin -eu then $(pwd) "$1" grep &&
+	then local export cd local local ${HOME}
+	grep ${HOME} "$1" | sed done
+	--verbose sed "$1" printf then then sed --verbose local readonly test then readonly
+		$(pwd) local local local | $(pwd) then grep
+	'quoted text' printf readonly x=1 grep --verbose $(pwd)
+done local && -eu | -eu 'quoted text' grep printf && printf "$1" awk -eu
+	echo --verbose cd then local 2>/dev/null
+&& 2>/dev/null done /usr/bin test test done grep sed --verbose
+echo $(pwd) "$@" printf then cd && readonly
+echo x=1 $(pwd) -eu awk awk && --verbose awk &&
+then "$@" local 2>/dev/null grep local 2>/dev/null then export
+'quoted text' 'quoted text' ${HOME}
+$(pwd) readonly cd "$@" then ${HOME}
+	sed --verbose sed | echo then cd -eu && readonly local -eu readonly
+/usr/bin export readonly export readonly
+local | -eu | 2>/dev/null x=1 'quoted text' &&
+-eu local | ${HOME} -eu grep && --verbose
+	/usr/bin x=1 local done cd echo | --verbose 2>/dev/null 2>/dev/null
+		done sed awk grep ${HOME} "$1" ${HOME} sed test local "$1"
+		done x=1 --verbose -eu test export cd done export printf "$@" sed 2>/dev/null then
+	| printf 'quoted text' local
+-eu awk printf 2>/dev/null ${HOME} local ${HOME} done echo 2>/dev/null
+readonly "$@" && then $(pwd) "$@" 'quoted text'
+2>/dev/null readonly --verbose test sed readonly grep "$@"
+	done | /usr/bin 'quoted text' then "$@" x=1 'quoted text'
+		echo | $(pwd) 2>/dev/null test readonly export "$@" "$@"
+--verbose -eu printf test printf 'quoted text' export local | local awk sed test
+	x=1 /usr/bin x=1 cd export test
+		| /usr/bin | echo /usr/bin readonly && x=1 /usr/bin sed "$@" awk ${HOME}
+	done test "$1" $(pwd) 'quoted text' 2>/dev/null && readonly then /usr/bin test
+	done $(pwd) 'quoted text' local $(pwd)
+		${HOME} sed x=1 /usr/bin sed && "$@" export test done test test
+	"$1" done 'quoted text' done export
+	awk "$1" export ${HOME} -eu -eu then done sed done echo then &&
+		done awk test local 'quoted text' done && ${HOME} local $(pwd)
+awk $(pwd) cd x=1 -eu local --verbose -eu awk 'quoted text' ${HOME} | grep "$1"
+		$(pwd) readonly printf cd test test done export export "$1" /usr/bin
+| /usr/bin 'quoted text' readonly --verbose
+-eu awk awk printf $(pwd) ${HOME} -eu sed $(pwd) 2>/dev/null echo -eu
+done "$@" grep | /usr/bin awk "$@" done printf test then export
+local sed $(pwd) readonly readonly
+		x=1 --verbose test local printf readonly readonly local cd && && sed grep
+--verbose then x=1 2>/dev/null x=1
+		${HOME} sed export sed done --verbose sed export done local -eu
+		"$@" ${HOME} 'quoted text' printf grep echo cd -eu "$@"
+		export cd awk -eu awk /usr/bin ${HOME} readonly 'quoted text'
+		sed readonly sed test readonly then export test
+	cd sed readonly "$1" printf ${HOME} local printf
+2>/dev/null test --verbose /usr/bin && "$@" export "$1" printf echo "$@" --verbose
+${HOME} | "$@" x=1 x=1 'quoted text' 2>/dev/null 2>/dev/null then
+export then then export test ${HOME} echo echo printf done 2>/dev/null
+test then /usr/bin /usr/bin done x=1 sed | export --verbose
+	awk printf awk printf cd && $(pwd) "$1" sed local local printf sed test 'quoted text'
+cd 2>/dev/null test export ${HOME} grep awk cd printf "$@" $(pwd) /usr/bin printf
+		x=1 "$1" --verbose done x=1 "$@" -eu then
+	echo && sed done awk 'quoted text' grep printf "$1" cd -eu x=1 test
+export && x=1 grep $(pwd) done echo echo x=1 "$1"
+readonly "$1" printf sed /usr/bin ${HOME} echo done readonly
+	cd cd 2>/dev/null readonly
+"$1" echo test cd ${HOME} --verbose -eu readonly && done 2>/dev/null
+	| --verbose /usr/bin sed then "$@" readonly test readonly local
+		/usr/bin cd test readonly done | then /usr/bin /usr/bin test local test --verbose
+${HOME} -eu local sed "$@" readonly local then x=1 cd 'quoted text'
+sed --verbose grep "$@" ${HOME} done
+		test && --verbose -eu | printf readonly | awk printf ${HOME} "$1"
+	local printf grep x=1 then printf --verbose $(pwd) ${HOME}
+	&& done local export sed done export sed awk x=1 cd echo done test "$@" && cd
+cd readonly printf /usr/bin grep x=1 echo "$@" -eu x=1 local
+		done local x=1 -eu x=1 printf
+x=1 done ${HOME} "$@" 2>/dev/null
+cd test then 'quoted text'
+sed -eu 2>/dev/null -eu then local x=1 -eu x=1 grep $(pwd) test local 2>/dev/null
+"$@" readonly awk && 2>/dev/null ${HOME} readonly "$@" sed then export
+		"$1" -eu 2>/dev/null && awk export
+		${HOME} done export $(pwd) "$1" awk then local printf
+		grep "$1" $(pwd) awk /usr/bin -eu "$1" printf
+		$(pwd) "$1" /usr/bin ${HOME}
+	echo echo sed done x=1 then | --verbose echo sed | && ${HOME} then
+		2>/dev/null echo local test x=1 grep then printf cd test 2>/dev/null awk done
+	'quoted text' grep test sed && test x=1 "$@" cd && printf 2>/dev/null local
+		sed 2>/dev/null printf "$@" "$@" --verbose x=1 cd grep sed awk then
+export "$1" done | grep /usr/bin 'quoted text' "$@" -eu done readonly -eu | local
+		'quoted text' export 'quoted text' | test done x=1 echo /usr/bin
+		x=1 ${HOME} awk export 2>/dev/null 'quoted text'
+&& cd awk 2>/dev/null grep printf local done "$@" cd "$@" ${HOME} printf done
+	/usr/bin sed done sed --verbose printf then 2>/dev/null then /usr/bin
+test done | 2>/dev/null local 2>/dev/null test readonly 'quoted text' x=1 'quoted text'
+	--verbose export "$1" done /usr/bin --verbose "$@" local --verbose
+	2>/dev/null cd "$1" readonly &&
+	'quoted text' printf ${HOME} /usr/bin export /usr/bin
+		awk printf printf --verbose test sed done export /usr/bin 2>/dev/null awk "$1" echo
+	--verbose "$1" done "$@" -eu x=1 | && "$@" "$1"
+	echo -eu readonly then $(pwd) grep echo | 2>/dev/null done local
+		done --verbose "$1" sed && sed 'quoted text' sed && && && done grep $(pwd) |
+	then $(pwd) "$1" printf | /usr/bin $(pwd)
+	-eu "$1" printf export -eu
+	grep "$@" cd x=1 test /usr/bin "$@" -eu
+	2>/dev/null cd $(pwd)
+test sed local && "$@" | "$1" $(pwd) ${HOME} sed &&
+/usr/bin export echo /usr/bin --verbose echo 2>/dev/null
+		"$@" test 'quoted text' 'quoted text' --verbose x=1 2>/dev/null sed 'quoted text'
+		readonly x=1 "$1" x=1 cd | ${HOME} 2>/dev/null "$1" 2>/dev/null export "$@"
+	&& | local 'quoted text'
+readonly "$1" then 'quoted text' 'quoted text' done 'quoted text'
+	echo local awk ${HOME} then readonly
+	then && "$@" "$1" printf | readonly printf 'quoted text' "$@"
+		--verbose then -eu local 2>/dev/null
+		echo awk local 2>/dev/null "$1" x=1 export test local x=1 sed echo
+	done --verbose sed grep then | ${HOME} && "$@"
+		grep sed x=1 /usr/bin cd /usr/bin
+		2>/dev/null "$1" x=1 --verbose | echo
+--verbose --verbose ${HOME} local printf cd $(pwd)
+		test 'quoted text' 2>/dev/null "$1"
+		x=1 'quoted text' "$@" $(pwd) local echo local 2>/dev/null | done readonly
+		sed done then && "$1" 'quoted text' $(pwd) "$@" "$@" $(pwd) printf
+/usr/bin $(pwd) /usr/bin echo $(pwd) done printf x=1 cd
+test awk && | $(pwd) && awk $(pwd) 2>/dev/null awk then export printf "$1"
+	x=1 2>/dev/null "$1" ${HOME} readonly $(pwd) test && test x=1 | readonly echo &&
+		echo then ${HOME} done readonly --verbose
+export 2>/dev/null test 'quoted text'
+echo test printf -eu -eu 'quoted text' 'quoted text'
+		--verbose cd 2>/dev/null printf | "$1" printf readonly test "$@" 2>/dev/null
+		then export --verbose --verbose -eu | $(pwd) echo awk export 'quoted text' echo
+		$(pwd) grep local 2>/dev/null -eu | | 2>/dev/null
+/usr/bin -eu test awk export cd awk "$@" --verbose grep && /usr/bin
+		printf test $(pwd) awk cd 'quoted text' --verbose "$@" then 2>/dev/null
+	"$1" echo "$1" -eu awk export sed | "$1" then --verbose --verbose
+		$(pwd) "$@" cd awk printf "$1" 'quoted text'
+	export "$@" echo local x=1 /usr/bin 'quoted text' done export --verbose sed sed
+	'quoted text' --verbose ${HOME} test sed "$@"
+	readonly then echo 'quoted text' x=1 | -eu printf then printf
+	| --verbose $(pwd) --verbose 'quoted text' echo
+	| | printf awk then local then done 2>/dev/null x=1 printf then cd "$@" readonly
+	cd awk && $(pwd) x=1 "$1" sed echo /usr/bin grep ${HOME}
+	-eu then | done sed grep grep "$1" "$1" printf
+test sed $(pwd) --verbose "$1" sed
+		$(pwd) test sed "$1" $(pwd) printf | local --verbose
+		printf && local readonly awk readonly sed done done ${HOME} 'quoted text'
+		--verbose ${HOME} cd -eu "$@" "$1" "$1" echo readonly readonly done then
+	done -eu then done readonly sed
+		sed readonly grep export ${HOME}
+	$(pwd) test sed $(pwd)
+		-eu x=1 printf --verbose 2>/dev/null -eu ${HOME} then done 'quoted text' x=1
+		/usr/bin cd sed cd /usr/bin echo done 2>/dev/null echo then ${HOME}
+		"$1" 2>/dev/null $(pwd) 'quoted text'
+2>/dev/null then "$1" --verbose sed ${HOME} grep printf printf
+		"$@" echo /usr/bin local | printf local -eu export /usr/bin "$@" sed
+		&& | echo then local "$@" printf test "$1" &&
+printf cd "$1" "$@" awk export local 'quoted text' awk then readonly done
+	readonly $(pwd) /usr/bin 'quoted text' -eu x=1 "$1" sed && && --verbose "$1" cd
+	/usr/bin sed x=1 test grep
+local echo test awk export
+		grep "$@" ${HOME} local x=1 ${HOME}
+test readonly test x=1 done readonly export ${HOME}
+		| awk $(pwd) printf printf && printf 'quoted text' local
+test then $(pwd) printf readonly test $(pwd) x=1 readonly
+	"$@" done && echo | "$1" echo export /usr/bin
+| local grep $(pwd) echo awk -eu && test
+&& ${HOME} && done 'quoted text' sed local sed echo
+then $(pwd) -eu grep grep then
+--verbose printf 2>/dev/null grep && && then echo grep echo 'quoted text'
+2>/dev/null sed awk cd 'quoted text' readonly grep 'quoted text' local 2>/dev/null
+		-eu "$1" ${HOME} local $(pwd) 'quoted text' printf awk 2>/dev/null
+	/usr/bin x=1 2>/dev/null "$1" 'quoted text' "$@" /usr/bin /usr/bin
+		test printf local ${HOME} -eu
+$(pwd) test /usr/bin --verbose readonly ${HOME} printf
+	test grep "$@" ${HOME} done | grep readonly | export echo 2>/dev/null
+	readonly ${HOME} /usr/bin sed | then test "$1" /usr/bin 2>/dev/null sed
+	${HOME} awk sed 2>/dev/null x=1 | echo then 'quoted text' awk x=1 cd $(pwd)
+	'quoted text' ${HOME} cd sed /usr/bin "$1" readonly readonly cd && $(pwd) "$@"
+| 'quoted text' cd "$1" readonly && export test 2>/dev/null
+"$1" export then cd -eu
+		grep cd ${HOME} grep | awk sed echo --verbose 2>/dev/null
+	'quoted text' awk -eu -eu 'quoted text' && --verbose
+	2>/dev/null x=1 | done export $(pwd) printf ${HOME} "$1" -eu
+grep 2>/dev/null /usr/bin awk done --verbose
+		$(pwd) readonly ${HOME} local then "$@" x=1 2>/dev/null then sed && grep readonly
+		-eu "$1" /usr/bin readonly
+	readonly printf grep 'quoted text'
+		readonly echo then 'quoted text' test 2>/dev/null 2>/dev/null
+#include c164.sh
+x=1 then done then 'quoted text' "$1" awk && sed test && "$1" export
+		/usr/bin 2>/dev/null | | echo echo printf sed
+--verbose 2>/dev/null awk "$1" done "$1" readonly cd "$@" 'quoted text'
+sed done then && export sed sed awk 2>/dev/null ${HOME}
+	done /usr/bin cd x=1 "$1" "$@" awk $(pwd) 2>/dev/null /usr/bin
+	done 2>/dev/null awk 2>/dev/null
+		done printf | 'quoted text' "$@" awk sed $(pwd) cd sed && --verbose
+done local "$@" done printf | done 2>/dev/null 2>/dev/null cd 'quoted text'
+		"$1" "$@" readonly -eu
+		/usr/bin 'quoted text' && ${HOME}
+	local readonly && cd done /usr/bin local awk readonly "$1"
+	| export test ${HOME} 2>/dev/null "$@"
+local 2>/dev/null /usr/bin then | printf
+	local grep export awk x=1 'quoted text' printf export x=1 "$@" | cd "$1" ${HOME}
+		-eu done && test "$@" $(pwd) cd sed /usr/bin grep test $(pwd)
+		done local printf --verbose
+		readonly && local cd --verbose --verbose grep
+	'quoted text' ${HOME} cd sed test --verbose -eu export printf cd 'quoted text'
+sed printf 'quoted text' sed export export printf "$@" export && readonly sed sed
+	'quoted text' done | $(pwd) awk
+		"$@" export -eu cd && | && $(pwd) awk export grep "$1" "$1" grep local done $(pwd)
+	--verbose "$1" $(pwd) /usr/bin echo readonly $(pwd) 'quoted text' export
+		echo awk done "$1" "$1" && x=1 sed 'quoted text'
+		2>/dev/null ${HOME} awk awk cd | printf local export then 2>/dev/null
+	awk -eu awk echo /usr/bin local grep done printf sed export -eu | then "$1" $(pwd)
+done && "$1" | grep done export "$1" printf cd awk
+printf local 'quoted text' 'quoted text' -eu printf
+		export /usr/bin awk grep -eu export then
+	-eu awk then echo x=1 export $(pwd) /usr/bin x=1 'quoted text' then echo &&
+	"$1" --verbose readonly -eu echo echo x=1 x=1 done /usr/bin
+		printf 2>/dev/null then grep awk
+		export -eu grep --verbose && $(pwd) x=1 then 2>/dev/null 'quoted text'
+done cd -eu done local 'quoted text' printf
+		printf 'quoted text' done /usr/bin awk | && $(pwd) sed printf --verbose -eu printf
+		done local awk 2>/dev/null --verbose
+	--verbose sed cd printf --verbose cd cd printf readonly
+	"$@" test -eu --verbose cd -eu --verbose cd
+done x=1 sed 2>/dev/null 2>/dev/null
+		| cd done 2>/dev/null awk 2>/dev/null then 'quoted text' ${HOME}
+	-eu echo x=1 --verbose $(pwd) sed ${HOME} export cd && x=1 grep ${HOME}
+		&& local done "$1" 2>/dev/null readonly awk /usr/bin 2>/dev/null
+	done && echo /usr/bin && echo 'quoted text' printf && x=1 ${HOME} readonly sed
+-eu 'quoted text' done done -eu export sed ${HOME}
+2>/dev/null ${HOME} local $(pwd) awk "$@" -eu
+$(pwd) cd 2>/dev/null readonly sed done "$@" export "$@" echo
+		&& 2>/dev/null printf then | x=1 ${HOME} sed /usr/bin "$1" readonly printf done
+$(pwd) export sed ${HOME} $(pwd) sed
+		export sed test 'quoted text' export $(pwd) $(pwd) grep grep sed grep /usr/bin
+printf "$1" x=1 export ${HOME} /usr/bin export "$1" sed /usr/bin && | ${HOME}
+		x=1 x=1 export ${HOME} /usr/bin
+	awk awk echo test "$1" -eu sed
+local | export 'quoted text'
+	2>/dev/null "$1" local ${HOME}
+grep printf local ${HOME}
+local 'quoted text' awk -eu --verbose sed /usr/bin cd printf
+		&& && test --verbose readonly done cd 2>/dev/null export "$1" sed /usr/bin $(pwd)
+		readonly $(pwd) /usr/bin cd grep grep export awk done -eu echo
+		echo then $(pwd) 'quoted text'
+	readonly 2>/dev/null "$@" x=1 && local
+'quoted text' export readonly x=1
+echo 'quoted text' --verbose --verbose then x=1 cd awk && test 2>/dev/null readonly
+	sed readonly --verbose 2>/dev/null "$1" /usr/bin
+	test -eu && grep cd x=1 --verbose "$1" /usr/bin awk ${HOME} 2>/dev/null $(pwd)
+		| done "$1" /usr/bin "$1" then echo printf && --verbose /usr/bin echo "$1" 2>/dev/null
+		"$@" cd printf | $(pwd) printf printf "$@" | "$1" $(pwd) readonly
+	"$@" "$1" sed awk 2>/dev/null
+	local readonly export x=1 awk local cd -eu
+	printf $(pwd) local 2>/dev/null 'quoted text'
+	&& ${HOME} then ${HOME} | done /usr/bin -eu --verbose export 2>/dev/null /usr/bin
+$(pwd) "$1" then "$@" | local && awk --verbose export
+	| -eu 'quoted text' export cd $(pwd) x=1 export
+-eu readonly ${HOME} "$1" sed test local ${HOME}
+	$(pwd) grep echo then | 'quoted text' "$@" export printf x=1
+		export then 2>/dev/null awk local grep test x=1
+	grep done sed cd "$1" | done echo | 'quoted text'
+		| "$1" echo echo export $(pwd) | && 2>/dev/null x=1 -eu grep 'quoted text'
+&& ${HOME} then "$1" then done 2>/dev/null readonly ${HOME} done
+${HOME} awk export printf "$1" | echo printf readonly
+done "$@" cd export 2>/dev/null --verbose "$@" && && 2>/dev/null
+done echo -eu /usr/bin && test $(pwd) echo awk
+		grep "$@" echo test grep 'quoted text' test echo cd
+		$(pwd) test export printf --verbose done export awk --verbose
+	test 2>/dev/null 2>/dev/null 2>/dev/null "$@"
+		printf local /usr/bin printf
+	"$1" -eu x=1 | -eu x=1 echo 2>/dev/null local export "$1" echo
+		'quoted text' --verbose test grep readonly | echo $(pwd) readonly export echo
+	'quoted text' 'quoted text' export
+/usr/bin cd cd 'quoted text' "$@" -eu echo ${HOME} | echo "$@" readonly readonly
+grep /usr/bin printf done --verbose --verbose 'quoted text' sed printf 2>/dev/null
+	"$@" awk --verbose ${HOME} grep then --verbose printf echo test && 2>/dev/null
+		then 'quoted text' && -eu -eu
+sed 2>/dev/null -eu then local -eu export /usr/bin 2>/dev/null /usr/bin /usr/bin
+		local done $(pwd) test x=1 awk local printf && "$@"
+export | --verbose 2>/dev/null then echo /usr/bin 2>/dev/null
+		export local $(pwd) --verbose awk echo $(pwd)
+		then 2>/dev/null 'quoted text' && export grep printf "$1" x=1 "$1"
+	$(pwd) "$@" awk export export /usr/bin then echo ${HOME} -eu | 2>/dev/null
+		sed -eu local awk printf grep 'quoted text'
+	/usr/bin 2>/dev/null done 2>/dev/null ${HOME} && "$@" sed test cd readonly
+then && done local 'quoted text' --verbose /usr/bin cd 2>/dev/null
+sed "$1" 2>/dev/null export 'quoted text'
+printf --verbose test -eu -eu x=1 then echo "$1" cd then "$@"
+		${HOME} "$@" sed $(pwd) then awk done "$1" | export ${HOME} x=1 -eu
+		/usr/bin "$@" readonly echo cd | local grep $(pwd) cd --verbose export
+		&& "$1" ${HOME} grep readonly 2>/dev/null
+		x=1 export ${HOME} "$1" export $(pwd) 2>/dev/null echo test
+grep ${HOME} "$@" -eu
+	&& /usr/bin && ${HOME} /usr/bin sed 2>/dev/null grep $(pwd) echo | 2>/dev/null
+2>/dev/null /usr/bin test -eu
+"$@" $(pwd) ${HOME} 'quoted text' done && printf done grep then sed grep |
+		readonly x=1 done "$@" readonly done export | /usr/bin export | 2>/dev/null
+	--verbose grep export "$1" sed 'quoted text' ${HOME}
+	"$1" grep "$1" cd test awk cd then -eu
+local $(pwd) awk -eu local "$1" x=1 local echo
+		| awk "$@" local grep awk then |
+		done /usr/bin "$@" cd 'quoted text' grep local export
+		echo test readonly | /usr/bin "$1" ${HOME} sed && awk --verbose
+	-eu --verbose then export done printf printf sed printf cd
+		test cd grep sed | && readonly local 'quoted text' $(pwd)
+		printf then export "$1" "$@" ${HOME} | --verbose
+		sed grep awk --verbose && printf | echo cd "$1" /usr/bin done done 'quoted text'
+&& local "$@" 2>/dev/null --verbose "$@"
+		printf grep "$@" done ${HOME} $(pwd) printf test readonly grep x=1
+sed cd test export then --verbose
+	test -eu grep local grep
+cd sed done cd && awk local grep sed /usr/bin sed x=1 sed then x=1 sed done readonly
+	cd then $(pwd) sed -eu
+		readonly ${HOME} "$@" export readonly --verbose
+		grep 'quoted text' 2>/dev/null printf printf
+		then --verbose printf /usr/bin x=1 sed ${HOME}
+	"$@" printf local cd ${HOME} readonly --verbose cd x=1 /usr/bin 2>/dev/null
+export | local test cd local readonly done
+	cd | ${HOME} $(pwd) "$1" | readonly test sed done "$@" grep ${HOME} 'quoted text'
+	awk grep echo x=1 'quoted text' echo cd cd x=1
+		sed | grep local export local 'quoted text'
+echo 'quoted text' test 2>/dev/null local cd then
+done printf -eu grep local $(pwd) done grep
+	-eu cd 'quoted text' then local "$@" -eu /usr/bin /usr/bin "$1"
+		test echo /usr/bin /usr/bin -eu | /usr/bin awk local awk cd "$1" sed
+	x=1 test done "$@" test | -eu
+		/usr/bin | sed awk --verbose | readonly $(pwd) done ${HOME} grep
+&& export -eu /usr/bin sed cd then "$1" grep | x=1 printf test
+	echo readonly && readonly awk done | printf
+		then readonly x=1 test cd --verbose then
+	export echo sed && --verbose "$1"
+		x=1 test /usr/bin export x=1 test $(pwd) ${HOME} printf -eu sed then
+&& $(pwd) --verbose -eu printf
+	| 'quoted text' && test
+	$(pwd) then $(pwd) x=1 -eu
+		'quoted text' --verbose /usr/bin export done
+		then then local then grep grep 2>/dev/null
+	2>/dev/null done && --verbose
+	local done "$1" 2>/dev/null
+	'quoted text' sed "$@" then readonly test ${HOME} sed "$@" "$1"
+		printf local "$@" test local then printf readonly
+	done sed 2>/dev/null 'quoted text'
+		local --verbose 'quoted text' local | export done awk test
+then readonly local export /usr/bin "$1" readonly 'quoted text'
+		/usr/bin 'quoted text' awk echo ${HOME} awk done /usr/bin grep
+${HOME} -eu sed 'quoted text'
+	done --verbose printf done done $(pwd)
+'quoted text' -eu 2>/dev/null then | --verbose 2>/dev/null test "$1" "$@"
+$(pwd) && cd /usr/bin $(pwd) --verbose 2>/dev/null
+		readonly --verbose && test cd awk "$1"
+	export done then awk cd x=1 sed | grep $(pwd)
+		export && /usr/bin 'quoted text' cd sed cd 'quoted text' $(pwd)
+		/usr/bin | 'quoted text' 'quoted text' printf
+"$1" && "$@" /usr/bin $(pwd) 'quoted text'
+	| done "$1" | "$@" 'quoted text' sed printf && | x=1 /usr/bin printf sed test
+cd && readonly x=1 awk done export
+	then sed local local then "$1"
+	/usr/bin ${HOME} local 'quoted text' 'quoted text'
+		&& test && export $(pwd) awk
+	2>/dev/null test ${HOME} "$@"
+	${HOME} -eu && ${HOME}
+		printf cd cd ${HOME} done 'quoted text' 'quoted text' 2>/dev/null
+		2>/dev/null x=1 printf | 2>/dev/null /usr/bin
+done grep "$1" /usr/bin /usr/bin -eu "$1" done |
+	test printf -eu 2>/dev/null export printf local --verbose printf
+	printf export /usr/bin | echo
+		printf $(pwd) --verbose "$@" -eu 2>/dev/null awk echo ${HOME} local 2>/dev/null
+export cd sed -eu grep /usr/bin --verbose 2>/dev/null echo "$1" 'quoted text'
+	export sed x=1 printf then $(pwd)
+		awk echo --verbose ${HOME} grep x=1 cd local readonly echo cd
+		readonly /usr/bin grep then awk printf test done export printf
+		readonly done test && readonly sed x=1 readonly readonly 'quoted text'
+--verbose 2>/dev/null done awk | ${HOME} grep | $(pwd) /usr/bin export
+		x=1 local done | 'quoted text' x=1
+| "$1" x=1 --verbose | local export echo export "$1" grep
+	$(pwd) $(pwd) test done ${HOME} grep 2>/dev/null cd 'quoted text' -eu cd
+		test --verbose export readonly grep echo readonly grep done
+		sed grep x=1 $(pwd) "$@" done test | "$@" sed done
+		sed 'quoted text' readonly -eu x=1
+	done then awk readonly 2>/dev/null && -eu readonly awk cd
+		awk then then --verbose awk --verbose && --verbose local then $(pwd)
+"$@" echo local && test ${HOME} grep export "$@" $(pwd) sed ${HOME} ${HOME}
+	export echo x=1 sed local "$1" && printf test x=1 echo grep local
+local "$@" && test echo done --verbose
+${HOME} x=1 "$1" export -eu
+'quoted text' local then x=1 done -eu --verbose awk 2>/dev/null
+		"$@" printf | $(pwd) -eu $(pwd) 'quoted text'
+&& done awk x=1 grep -eu --verbose local /usr/bin echo "$1"
+sed cd cd "$1" "$1" --verbose x=1 ${HOME} && 'quoted text' test test test
+		-eu --verbose cd readonly grep "$@" readonly --verbose
+--verbose | done 'quoted text' sed --verbose cd | awk local "$@" /usr/bin ${HOME}
+		printf test export --verbose /usr/bin | "$@" sed printf export printf
+then $(pwd) cd && 'quoted text' test printf awk "$1" ${HOME} "$1" then "$@" grep
+	awk then echo x=1 cd "$@" test 2>/dev/null && --verbose sed
+		printf 'quoted text' "$1" printf ${HOME} echo --verbose local -eu x=1 test awk "$1"
+2>/dev/null cd -eu local | cd then | | ${HOME} /usr/bin
+--verbose ${HOME} $(pwd) test grep 'quoted text' $(pwd)
+	| done x=1 'quoted text' export $(pwd) readonly export | --verbose -eu awk
+	'quoted text' $(pwd) --verbose echo 2>/dev/null 2>/dev/null
+		"$1" local && echo x=1 "$1" "$1" local ${HOME}
+$(pwd) $(pwd) readonly 'quoted text' && | $(pwd)
+		awk readonly done 'quoted text' done --verbose printf test export then -eu
+--verbose x=1 2>/dev/null x=1 then cd ${HOME}
+	readonly grep grep awk cd local -eu grep ${HOME} ${HOME} /usr/bin -eu 'quoted text'
+&& x=1 /usr/bin grep $(pwd)
+test export test printf "$1"
+then "$@" cd readonly echo test awk done -eu then echo local 'quoted text'
+		$(pwd) awk local cd export export grep && echo then echo then | x=1 --verbose
+	done test $(pwd) cd printf 'quoted text' && sed 'quoted text'
+	x=1 x=1 readonly | --verbose
+		readonly "$@" | sed 2>/dev/null awk 'quoted text' $(pwd) done | sed printf
+		-eu "$@" 2>/dev/null -eu test sed --verbose test grep
+		"$1" && /usr/bin 2>/dev/null
+	test "$1" x=1 ${HOME} sed done cd "$@" echo
+	awk awk "$1" local --verbose
+	echo ${HOME} awk readonly | $(pwd)
+	echo echo awk echo printf --verbose "$@" /usr/bin export
+	${HOME} sed echo "$@" export -eu then
+		local readonly $(pwd) cd local 2>/dev/null readonly local readonly
+2>/dev/null then export printf "$1" then awk cd done readonly
+	--verbose && "$1" --verbose readonly done printf readonly
+	&& export printf 'quoted text' 2>/dev/null ${HOME} awk readonly $(pwd)
+	2>/dev/null 2>/dev/null && awk test x=1 then awk sed 2>/dev/null cd "$1"
+"$1" /usr/bin awk /usr/bin x=1 ${HOME} 'quoted text' local test
+--verbose local -eu ${HOME} 'quoted text' echo "$1" readonly sed readonly then
+		&& && ${HOME} sed awk "$@" local test "$@" printf grep done &&
+		grep readonly /usr/bin export readonly export
+	export cd x=1 test "$1" done 2>/dev/null && "$@" echo awk export
+		x=1 test echo awk 2>/dev/null export
+	done -eu cd "$1" local awk "$@" printf printf ${HOME} | awk
+		test sed 2>/dev/null "$1" readonly
+		done cd awk "$1" ${HOME} 2>/dev/null sed test then grep | "$1" /usr/bin
+then test ${HOME} "$@" sed && then 2>/dev/null sed $(pwd) $(pwd)
+echo "$@" $(pwd) export printf
+$(pwd) 'quoted text' readonly
+		| cd -eu /usr/bin /usr/bin -eu -eu | echo printf -eu x=1 echo readonly
+"$1" | && readonly -eu 2>/dev/null done sed local /usr/bin done done $(pwd) then
+	'quoted text' $(pwd) ${HOME} grep
+awk done awk ${HOME} printf "$1" local printf done printf
+	then $(pwd) -eu x=1 export then ${HOME} && -eu && export
+test $(pwd) awk ${HOME} /usr/bin readonly readonly 'quoted text'
+	--verbose readonly -eu $(pwd)
+	2>/dev/null printf readonly "$1" done "$1" cd awk 2>/dev/null
+		local cd | export --verbose echo
+	/usr/bin "$1" 2>/dev/null && "$1" ${HOME} cd 2>/dev/null
+x=1 readonly grep 'quoted text' --verbose cd sed printf |
+done 2>/dev/null printf then cd | local "$1" x=1 then cd then /usr/bin
+	done then 2>/dev/null sed export export grep awk export cd | 2>/dev/null printf
+		x=1 export test "$1" -eu x=1 $(pwd)
+		readonly test && test && 'quoted text' readonly /usr/bin sed
+	grep then /usr/bin test 2>/dev/null
+then cd "$@" /usr/bin 2>/dev/null "$@" ${HOME} "$1" $(pwd) "$1" readonly x=1 --verbose
+	${HOME} test sed awk grep $(pwd) echo export grep printf | printf x=1
+then export sed | printf --verbose cd | local
+sed && printf $(pwd) $(pwd) 2>/dev/null
+${HOME} $(pwd) awk printf && ${HOME}
+		'quoted text' -eu cd --verbose
+	local local sed -eu $(pwd) done local export 'quoted text' /usr/bin then 2>/dev/null
+		'quoted text' ${HOME} sed printf --verbose
+		echo | $(pwd) readonly ${HOME} awk
+		cd | --verbose ${HOME} cd cd -eu awk test x=1 |
+grep && then x=1 grep "$1"
+done -eu printf test export $(pwd) awk
+		"$1" --verbose local "$@" cd cd 'quoted text' /usr/bin 2>/dev/null 2>/dev/null
+		grep printf then cd 2>/dev/null sed echo && ${HOME} "$@" test export sed
+		| done x=1 readonly | readonly done test "$1" echo awk readonly
+awk awk | "$@" ${HOME} local grep x=1 sed readonly readonly awk awk
+/usr/bin 2>/dev/null cd export 'quoted text' done
+	awk 'quoted text' "$@" echo --verbose printf awk "$@" then | local then
+	printf 'quoted text' x=1 |
+sed 'quoted text' -eu cd -eu export -eu
+	"$@" test x=1 printf printf test done done sed /usr/bin x=1 $(pwd) grep done
+		cd sed then $(pwd) printf awk --verbose -eu sed 2>/dev/null
+		awk 2>/dev/null $(pwd) --verbose done sed $(pwd)
+	cd sed test x=1 "$@" test then "$1" "$1" test export ${HOME} "$@" printf ${HOME}
+x=1 done /usr/bin | 'quoted text' /usr/bin
+		${HOME} then /usr/bin $(pwd) printf awk /usr/bin cd x=1 --verbose then
+		sed && x=1 2>/dev/null /usr/bin awk
+test $(pwd) awk "$@" printf 'quoted text' && printf local cd -eu awk ${HOME} 'quoted text'
+| x=1 cd && 2>/dev/null 'quoted text' grep awk printf 2>/dev/null && done
+		${HOME} 2>/dev/null "$@" ${HOME} "$@" x=1
+		cd test "$1" /usr/bin /usr/bin "$@" "$@"
+	readonly sed sed 'quoted text' "$1" readonly ${HOME} 'quoted text' -eu
+grep ${HOME} readonly test 2>/dev/null | printf cd | 'quoted text'
+	"$@" test --verbose | | && /usr/bin readonly
+		export done && test /usr/bin --verbose
+		readonly test ${HOME} readonly test "$@"
+		local export sed export
+"$@" "$1" /usr/bin /usr/bin cd -eu awk then then x=1 && echo -eu done echo
+	"$1" "$1" x=1 --verbose sed cd --verbose export 2>/dev/null then && | 'quoted text'
+	awk --verbose then && "$@" ${HOME} "$@" /usr/bin export && -eu 'quoted text'
+	/usr/bin | $(pwd) $(pwd) cd 2>/dev/null
+	"$@" done done sed && then printf echo local $(pwd) $(pwd) readonly
+readonly "$1" done sed $(pwd) ${HOME} "$1" --verbose
+	"$@" cd 2>/dev/null "$@" printf printf -eu --verbose cd grep && cd 'quoted text'
+		sed cd sed cd 2>/dev/null cd 'quoted text' "$@" printf
+	$(pwd) ${HOME} cd x=1 --verbose | && /usr/bin "$@" "$@" 2>/dev/null x=1 | -eu done
+		'quoted text' local cd done /usr/bin "$@" ${HOME}
+		&& done -eu local test -eu && awk --verbose 'quoted text'
+then "$1" /usr/bin sed /usr/bin done --verbose ${HOME} export $(pwd) /usr/bin
+		readonly local export printf "$1" 'quoted text' cd sed readonly echo
+	export grep awk $(pwd) /usr/bin /usr/bin --verbose -eu export "$@" export
+		readonly awk then --verbose /usr/bin "$1" | awk
+		sed printf export ${HOME} readonly
+		'quoted text' "$1" readonly readonly sed && "$@" 2>/dev/null
+		${HOME} local printf 'quoted text'
+		--verbose --verbose && "$1" "$@" echo x=1
+	awk done done 2>/dev/null ${HOME} x=1 sed done test 'quoted text'
+2>/dev/null echo sed "$1" -eu done 'quoted text' | export /usr/bin
+${HOME} "$@" sed echo 2>/dev/null $(pwd) $(pwd) 'quoted text' && echo then
+done sed cd export test 'quoted text' ${HOME} awk done printf printf echo
+awk && --verbose sed then $(pwd) awk export ${HOME}
+		$(pwd) $(pwd) "$1" echo -eu readonly $(pwd) export then export
+		$(pwd) /usr/bin test $(pwd)
+		/usr/bin "$@" $(pwd) 'quoted text' $(pwd)
+readonly | cd export then printf
+		done test printf awk export local "$@" test grep echo --verbose "$1" ${HOME} "$@"
+		readonly then then awk "$1" printf test 'quoted text' export /usr/bin grep echo
+	-eu "$1" 'quoted text' printf 'quoted text' done then "$1" | then && local
+'quoted text' "$1" then && $(pwd) echo echo 2>/dev/null cd sed
+	-eu && awk 'quoted text' && readonly echo awk sed export
+		done export grep "$@" printf | | 2>/dev/null grep 'quoted text' && export
+	"$@" local $(pwd) sed 'quoted text' --verbose && readonly grep local
+2>/dev/null awk 'quoted text' "$@" $(pwd) done $(pwd) awk local -eu readonly
+		printf awk export --verbose readonly then ${HOME} cd 'quoted text'
+sed 2>/dev/null x=1 readonly cd "$1" echo ${HOME} "$@" done ${HOME}
+		| export printf readonly
+	2>/dev/null $(pwd) -eu 'quoted text' 2>/dev/null awk echo awk
+	then "$@" then printf echo
+echo echo x=1 $(pwd) test readonly 'quoted text' sed -eu /usr/bin
+done local && echo local 2>/dev/null --verbose "$1" ${HOME} awk export
+		awk | --verbose ${HOME} printf 2>/dev/null -eu export "$1" && grep local
+	&& sed awk ${HOME} test
+		readonly cd echo --verbose printf grep -eu && readonly cd echo 'quoted text' grep
+	2>/dev/null "$1" awk done ${HOME} --verbose printf readonly --verbose &&
+	| export 'quoted text' done ${HOME} | -eu awk local test grep --verbose
+	echo awk local ${HOME} printf test "$1" --verbose
+	test 'quoted text' local
+"$1" "$@" 'quoted text' grep local printf
+awk | ${HOME} grep && | x=1 "$@" && | && sed local
+then done /usr/bin | done "$1" cd
+		"$1" /usr/bin $(pwd) echo
+		echo -eu && --verbose "$@" -eu export sed "$@" grep echo x=1
+		$(pwd) x=1 sed | ${HOME} "$@" "$1" | export awk printf && --verbose
+		--verbose printf 'quoted text' $(pwd)
+awk sed /usr/bin 2>/dev/null --verbose --verbose ${HOME} sed local -eu -eu awk
+	$(pwd) done "$@" | x=1 "$@" /usr/bin
+local | cd done /usr/bin export printf test 2>/dev/null
+	test export sed readonly
+done "$@" cd && readonly -eu echo --verbose
+		${HOME} awk -eu && awk export -eu "$1" 'quoted text'
+		/usr/bin grep grep 'quoted text' -eu /usr/bin
+	-eu 2>/dev/null ${HOME} ${HOME} "$@" | export echo grep sed "$1" echo echo
+		2>/dev/null cd "$@" $(pwd) export
+		cd grep printf "$@" local then && --verbose cd &&
+	| sed x=1 grep $(pwd) echo --verbose readonly | ${HOME} cd -eu "$1" -eu
+	'quoted text' echo echo --verbose
+	echo ${HOME} "$1" export /usr/bin x=1 -eu ${HOME} local | local $(pwd)
+export readonly export grep
+2>/dev/null && -eu echo local $(pwd) echo printf $(pwd) x=1 --verbose
+		cd local sed done done awk echo awk --verbose
+awk then echo then readonly -eu
+		cd cd sed echo && grep "$1" $(pwd) sed cd done
+echo | | test printf $(pwd) test "$@" 2>/dev/null printf
+		${HOME} then && "$1" $(pwd) -eu --verbose ${HOME} && x=1 'quoted text' readonly
+-eu sed export export cd 2>/dev/null awk
+		'quoted text' printf "$@" echo sed -eu local
+		$(pwd) then "$1" 2>/dev/null 2>/dev/null 'quoted text' sed $(pwd) sed awk "$1"
+		'quoted text' | /usr/bin 'quoted text' echo 'quoted text'
+printf x=1 "$@" awk printf x=1 "$@" "$@" then "$@" /usr/bin awk 2>/dev/null
+		sed grep x=1 && && then cd "$1" printf printf readonly done --verbose
+		local /usr/bin test done
+		${HOME} printf x=1 x=1 "$@"
+local x=1 'quoted text' then printf then export export readonly $(pwd) test
+printf "$@" test && test --verbose awk /usr/bin
+		sed $(pwd) --verbose sed cd done && export 'quoted text' ${HOME} $(pwd)
+	echo cd 'quoted text' test -eu cd && readonly ${HOME}
+	${HOME} done awk echo "$1" ${HOME} /usr/bin
+	export "$1" | printf "$1" "$@" echo "$1" 2>/dev/null sed 2>/dev/null $(pwd) "$@"
+sed && 'quoted text' /usr/bin
+		${HOME} cd echo awk "$1" | x=1 test echo
+	awk --verbose 'quoted text' cd then
+	x=1 -eu local done awk x=1 -eu /usr/bin cd readonly test
+	done sed ${HOME} export -eu "$@" cd readonly && test
+grep 2>/dev/null awk x=1 grep
+done 'quoted text' $(pwd) echo printf 2>/dev/null done export && done printf
+		&& 2>/dev/null export 'quoted text' grep grep
+		&& sed | 'quoted text' awk --verbose
+		export done cd grep done
+export /usr/bin done "$@" 2>/dev/null
+	$(pwd) | sed /usr/bin && sed sed test then grep local echo 2>/dev/null
+	$(pwd) 2>/dev/null local test 2>/dev/null
+"$@" grep then /usr/bin cd readonly 2>/dev/null 'quoted text' grep echo -eu
+${HOME} --verbose sed /usr/bin && then 'quoted text'
+${HOME} /usr/bin "$@" export
+&& done export -eu ${HOME} "$1"
+&& && /usr/bin cd cd && "$1"
+		cd 2>/dev/null awk then export grep "$1" $(pwd)
+		| "$@" /usr/bin awk echo local 2>/dev/null
+| awk grep "$@" cd awk "$@" export cd grep x=1 cd awk --verbose export readonly
+		echo 2>/dev/null then && && | cd sed test x=1 awk printf
+		"$@" 2>/dev/null awk then readonly done | done grep local
+local && /usr/bin local x=1 test echo --verbose "$@" awk test grep
+		-eu cd 2>/dev/null x=1 ${HOME} 2>/dev/null export local ${HOME} local /usr/bin test
+		${HOME} --verbose sed /usr/bin test export echo sed
+		$(pwd) && 'quoted text' 2>/dev/null "$@"
+grep sed /usr/bin sed echo --verbose
+echo | "$@" grep "$@" x=1 -eu then
+$(pwd) local /usr/bin cd
+	sed grep readonly readonly
+	readonly readonly awk grep 2>/dev/null x=1 echo -eu done echo
+	$(pwd) -eu export "$@" readonly echo --verbose
+	'quoted text' local grep x=1 $(pwd)
+	grep echo printf ${HOME} echo 'quoted text' | 2>/dev/null
+test sed then readonly "$1" x=1 'quoted text'
+-eu "$@" "$@" test then then ${HOME}
+-eu readonly local ${HOME} -eu test $(pwd) cd export sed 2>/dev/null local
+		export --verbose 2>/dev/null cd
+		2>/dev/null awk printf | cd && then printf x=1 echo -eu cd /usr/bin
+	export --verbose export test cd sed "$@"
+awk -eu x=1 export -eu ${HOME} export
+&& $(pwd) | -eu 'quoted text' export
+	2>/dev/null $(pwd) grep
+		-eu "$1" echo echo echo x=1 'quoted text' readonly cd ${HOME} 2>/dev/null
+then awk awk printf $(pwd) sed
+	printf readonly readonly readonly awk | "$@" test readonly grep test awk
+		grep "$1" x=1 | /usr/bin "$1" readonly printf local awk "$1" x=1 "$1" test
+--verbose ${HOME} local cd -eu export 2>/dev/null "$1" "$1" readonly grep
+	local echo grep awk done local awk local -eu local && then cd sed | -eu
+'quoted text' $(pwd) "$@" "$@" printf export test
+	--verbose readonly echo 'quoted text'
+export && cd 2>/dev/null local done $(pwd) x=1 then
+"$@" printf "$1" | /usr/bin $(pwd)
+		--verbose ${HOME} "$1" printf "$1" x=1 | "$1" echo 2>/dev/null && cd && 'quoted text'
+	export then printf && 2>/dev/null && "$1" grep awk "$1" awk test | x=1 -eu echo
+		echo echo 2>/dev/null
+readonly printf echo 2>/dev/null
+local echo readonly local 2>/dev/null export --verbose && | readonly "$@"
+		/usr/bin grep | "$1" &&
+	${HOME} echo 'quoted text' awk sed -eu x=1 readonly
+		local then $(pwd) $(pwd) echo printf grep && ${HOME}
+x=1 2>/dev/null --verbose export -eu
+	"$@" cd printf 'quoted text'
+		x=1 grep then awk readonly done ${HOME} /usr/bin export
+--verbose then --verbose $(pwd) x=1 readonly 2>/dev/null | 2>/dev/null "$1"
+| test grep "$@" "$1" test sed
+	${HOME} 'quoted text' printf
+	test "$1" test x=1 printf sed -eu
+		echo 'quoted text' 2>/dev/null 'quoted text'
+		'quoted text' local && then
+	&& test then printf grep test grep ${HOME} awk $(pwd) readonly
+		${HOME} x=1 printf test export
+	$(pwd) readonly /usr/bin -eu printf
+		"$@" echo done x=1 x=1 'quoted text' /usr/bin test "$1" then export awk | "$1" echo
+		done grep export "$1" sed awk -eu 2>/dev/null | export awk 'quoted text' printf
+grep -eu x=1 done 'quoted text' echo echo
+	| then printf && then test 2>/dev/null local ${HOME} | echo export 2>/dev/null
+		done grep sed then echo then printf cd done --verbose cd export x=1
+grep 'quoted text' "$@" /usr/bin | awk -eu && test --verbose test
+--verbose -eu 2>/dev/null "$1" | 'quoted text' printf 'quoted text' ${HOME} done
+		'quoted text' grep "$1" test
+--verbose | "$@" done echo grep /usr/bin printf 2>/dev/null
+local printf readonly ${HOME} x=1 awk -eu 2>/dev/null
+$(pwd) x=1 test ${HOME} done local 'quoted text'
+	local local "$1" export /usr/bin
+sed done /usr/bin awk printf 2>/dev/null
+local && cd done awk /usr/bin "$1" sed readonly readonly test cd "$@" "$1" local
+	'quoted text' readonly $(pwd) -eu grep | cd export -eu /usr/bin
+	$(pwd) local cd && sed 2>/dev/null grep $(pwd) && test --verbose
+local ${HOME} printf "$1" 2>/dev/null 'quoted text'
+echo grep "$1" /usr/bin | local done grep then export
+	&& test printf cd -eu awk grep | 2>/dev/null ${HOME} local test awk export local
+	sed readonly test test local $(pwd) | export grep awk sed grep
+	$(pwd) echo -eu then && done test awk "$1" export local cd "$@" 2>/dev/null
+	then printf | cd --verbose done done test test "$1" | ${HOME} && ${HOME}
+		/usr/bin readonly 2>/dev/null test done grep local cd | /usr/bin then "$@"
+	sed "$@" local 'quoted text'
+local 'quoted text' cd export 2>/dev/null cd test -eu done test $(pwd)
+	x=1 local /usr/bin "$@" then sed sed sed printf &&
+		cd grep cd "$@" 'quoted text' printf x=1 test readonly
+		local export 'quoted text' readonly "$@"
+$(pwd) export done sed "$1" echo 'quoted text' --verbose echo -eu
+		echo export "$@" then |
+	2>/dev/null $(pwd) && printf "$1"
+	echo printf then && printf ${HOME}
+| 2>/dev/null x=1 cd echo /usr/bin test
+export "$1" 2>/dev/null done "$@" | $(pwd) awk x=1 "$1" awk | sed 'quoted text'
+		x=1 /usr/bin cd /usr/bin x=1
+	-eu && test "$1" local
+	${HOME} echo "$1" export ${HOME}
+export sed then -eu awk printf "$@" 2>/dev/null
+		cd printf awk cd done -eu echo cd /usr/bin cd --verbose echo cd echo
+	cd --verbose 2>/dev/null test --verbose grep | --verbose ${HOME} sed local done
+		--verbose sed printf "$1" printf "$@" printf
+		printf test cd 'quoted text' readonly export --verbose grep local -eu
+${HOME} ${HOME} local readonly && local readonly done sed local then
+x=1 export && echo awk -eu awk 2>/dev/null
+	-eu "$1" export local | &&
+export done 'quoted text' awk "$@" x=1 "$1" readonly test --verbose
+-eu "$1" --verbose x=1 printf echo 2>/dev/null
+	--verbose "$@" --verbose awk "$1" "$1" cd done x=1 ${HOME} then local
+		readonly printf local "$@" "$1" 2>/dev/null && $(pwd) cd printf $(pwd) then local
+		done x=1 x=1 echo && &&
+		| /usr/bin $(pwd) local "$@" --verbose
+	local cd 'quoted text' "$1" 'quoted text'
+		export cd "$1" test echo | | x=1 'quoted text' grep done
+		| ${HOME} sed echo awk done readonly x=1
+printf printf done /usr/bin
+	'quoted text' printf && then sed test printf printf
+	test "$1" awk x=1 export 2>/dev/null x=1 grep printf
+	"$@" && -eu -eu /usr/bin $(pwd) export -eu --verbose
+		"$@" local 'quoted text' cd ${HOME} echo "$@" done test
+		done 2>/dev/null test echo --verbose cd x=1 x=1 local test done cd --verbose
+	done cd cd test awk awk --verbose | --verbose
+		then then awk && test cd grep /usr/bin test --verbose
+test && then -eu local --verbose --verbose then printf && x=1 test
+	grep 2>/dev/null $(pwd) export 2>/dev/null
+		test export sed -eu ${HOME}
+	2>/dev/null /usr/bin test test 2>/dev/null 'quoted text' "$1" "$1" | cd x=1
+| local --verbose ${HOME} 2>/dev/null cd done cd | echo export "$@"
+| local printf | --verbose ${HOME} "$1" 2>/dev/null
+	-eu done sed test "$@" cd ${HOME} then local echo ${HOME} "$@"
+&& "$1" 'quoted text' awk | echo /usr/bin awk export -eu 'quoted text'
+		then /usr/bin grep 2>/dev/null export echo export
+| readonly sed -eu echo sed test export then -eu
+	&& | export "$1" echo /usr/bin | 2>/dev/null -eu "$1"
+/usr/bin grep ${HOME} test cd -eu printf $(pwd) awk grep then $(pwd)
+	${HOME} /usr/bin "$@" sed x=1 done 2>/dev/null 'quoted text' --verbose "$1" "$1"
+		cd grep "$1" 'quoted text' printf cd x=1 'quoted text' grep then ${HOME}
+	-eu grep test awk "$1" readonly --verbose test x=1 "$1" "$1" readonly
+&& printf awk awk done done grep -eu echo local | local ${HOME} cd 'quoted text'
+		'quoted text' x=1 export "$@" done "$1" | 2>/dev/null echo test "$1"
+	"$@" then "$@" done then sed test sed printf | && echo readonly 2>/dev/null
+		echo cd then echo "$@"
+		| then --verbose --verbose | local awk then "$1" $(pwd) ${HOME} 'quoted text'
+	${HOME} 'quoted text' $(pwd)
+	then test 'quoted text' test 'quoted text' 2>/dev/null && "$1" ${HOME} cd
+	| "$1" readonly 2>/dev/null echo echo
+		local echo awk printf | | grep printf 'quoted text' sed printf
+		test grep -eu -eu x=1 printf "$@" "$@" 'quoted text' -eu grep x=1 x=1 -eu "$@"
+		export echo $(pwd) then x=1 /usr/bin ${HOME}
+grep echo "$1" 'quoted text' --verbose done test 2>/dev/null x=1 | $(pwd) grep
+local readonly 'quoted text' && then | local echo -eu --verbose x=1 "$1" ${HOME}
+		sed echo "$1" grep $(pwd) ${HOME} 2>/dev/null echo sed export | $(pwd) /usr/bin
+		test /usr/bin local | $(pwd) grep awk /usr/bin --verbose /usr/bin /usr/bin ${HOME}
+		echo export 2>/dev/null x=1 echo | test ${HOME}
+local sed 2>/dev/null test "$1" 'quoted text' test
+echo readonly local x=1 2>/dev/null export --verbose local
+		echo 'quoted text' 'quoted text' echo grep ${HOME} x=1 echo && test
+		2>/dev/null cd x=1 echo grep &&
+	2>/dev/null 'quoted text'
+	"$@" x=1 'quoted text' cd readonly export grep && 'quoted text' x=1
+--verbose test export -eu | --verbose readonly test $(pwd) awk awk
+	export ${HOME} printf awk $(pwd) -eu /usr/bin done --verbose
+	&& x=1 --verbose readonly grep local
+"$1" done x=1 done local printf
+		$(pwd) grep --verbose grep awk "$@" local
+		readonly 'quoted text' cd local done readonly
+export awk grep /usr/bin
+export /usr/bin ${HOME} sed awk "$1" grep local cd sed local "$@"
+		x=1 && $(pwd) "$@" printf done echo && | -eu printf sed echo | /usr/bin
+		then -eu $(pwd) awk echo printf printf && | printf cd
+		x=1 cd printf "$@" cd 2>/dev/null local awk 2>/dev/null printf ${HOME} then
+	test echo printf x=1 $(pwd) echo printf local done grep && 2>/dev/null ${HOME}
+done then awk local 2>/dev/null sed "$1" | && -eu awk grep
+	done && done "$1" cd then cd 2>/dev/null sed "$1"
+'quoted text' --verbose awk awk x=1 'quoted text' $(pwd)
+then && "$1" "$@" --verbose grep printf printf sed ${HOME} ${HOME} "$1"
+		$(pwd) 'quoted text' -eu echo
+	&& readonly /usr/bin x=1 readonly && grep | test local $(pwd) printf
+	local $(pwd) "$@" && -eu --verbose x=1 ${HOME}
+	'quoted text' cd 2>/dev/null done local "$1" /usr/bin then "$@"
+		2>/dev/null x=1 "$@" printf sed | "$@" --verbose /usr/bin
+'quoted text' /usr/bin "$@" --verbose -eu printf 'quoted text' then
+	'quoted text' "$1" test export then --verbose -eu export x=1 ${HOME} /usr/bin
+--verbose 'quoted text' | echo && $(pwd) echo x=1 cd printf test x=1
+-eu awk done | $(pwd) /usr/bin ${HOME}
+		then | local test sed | |
+then sed local awk | printf ${HOME} awk export local grep --verbose $(pwd)
+export 'quoted text' printf test grep
+		export x=1 readonly --verbose done
+$(pwd) then grep /usr/bin $(pwd) --verbose readonly export
+		"$@" 'quoted text' sed cd local $(pwd) done | ${HOME} |
+		"$@" "$1" "$1" printf cd echo "$1" local readonly test
+		then -eu | "$1" 'quoted text' --verbose "$@"
+	then -eu grep then local then done | test awk readonly
+	test done printf "$@" local
+| ${HOME} cd && $(pwd) ${HOME} /usr/bin done grep cd 2>/dev/null local
+then readonly /usr/bin then "$@" | ${HOME} grep done cd grep test echo x=1 printf
+		"$@" ${HOME} $(pwd) printf $(pwd) readonly
+		test 2>/dev/null -eu "$@" test then --verbose
+'quoted text' --verbose "$@" then readonly cd | 'quoted text' | &&
+readonly echo ${HOME} grep cd -eu /usr/bin x=1
+test /usr/bin cd "$1" && readonly
+	test cd $(pwd) sed -eu -eu | awk test $(pwd) $(pwd) then cd cd printf sed
+	sed readonly | 2>/dev/null readonly | test --verbose --verbose
+		test && echo 2>/dev/null readonly 'quoted text'
+		sed echo $(pwd) test $(pwd) sed "$@" /usr/bin awk sed
+	echo echo /usr/bin export | -eu
+awk /usr/bin printf test $(pwd) | export
+	| done /usr/bin && x=1 $(pwd) 'quoted text' then
+"$1" echo 'quoted text' --verbose "$@" grep
+		local echo printf 'quoted text' then grep echo | sed -eu test | "$1" "$@" $(pwd)
+&& && $(pwd) done 'quoted text'
+	local cd then 'quoted text' 'quoted text' export 2>/dev/null "$@" 'quoted text'
+	cd x=1 printf /usr/bin test $(pwd) &&
+awk 'quoted text' awk export awk done
+	grep /usr/bin && 'quoted text'
+local x=1 grep -eu echo cd "$1"
+"$@" /usr/bin | 'quoted text'
+		test printf "$1" x=1 done done $(pwd) "$@" sed /usr/bin awk
+		readonly && readonly --verbose
+echo $(pwd) x=1 grep /usr/bin $(pwd)
+	export | sed readonly then echo local /usr/bin local printf done "$@" printf
+	printf sed x=1 grep 'quoted text' |
+"$1" -eu x=1 test awk readonly grep
+printf 'quoted text' --verbose
+		x=1 grep awk export done echo sed then export /usr/bin
+		2>/dev/null ${HOME} "$@" -eu ${HOME} | "$@" sed awk --verbose | readonly /usr/bin
+	${HOME} ${HOME} && then printf done 2>/dev/null cd $(pwd)
+	echo test export local $(pwd) /usr/bin && && /usr/bin /usr/bin export
+	test 'quoted text' printf readonly cd x=1
+	cd --verbose grep then "$@" && cd ${HOME} --verbose awk -eu done -eu /usr/bin
+	sed then /usr/bin 2>/dev/null -eu /usr/bin 2>/dev/null readonly x=1 && echo test
+-eu echo 2>/dev/null printf 'quoted text' 'quoted text'
+	/usr/bin done $(pwd) "$1" && local printf printf
+	awk -eu && && awk local $(pwd) cd
+	2>/dev/null --verbose grep
+	readonly -eu "$@" 2>/dev/null local 2>/dev/null -eu
+$(pwd) -eu export sed
+sed grep printf 2>/dev/null x=1 'quoted text' cd --verbose then printf 'quoted text'
+-eu 'quoted text' "$@" | /usr/bin $(pwd) sed
+	echo && && 'quoted text' done 'quoted text'
+$(pwd) x=1 ${HOME} printf && 2>/dev/null test 2>/dev/null
+		export $(pwd) ${HOME} sed /usr/bin 2>/dev/null sed test done then
+	printf $(pwd) done -eu $(pwd) grep export -eu local done cd x=1 -eu export
+--verbose && printf awk grep
+export sed 'quoted text' cd printf "$1"
+--verbose done then "$@" test -eu test "$@" printf echo /usr/bin
+		/usr/bin done then printf --verbose
+		&& -eu -eu awk readonly then x=1 /usr/bin
+		then grep printf -eu then -eu export x=1 2>/dev/null readonly grep then then done
+done local done | awk && sed grep test
+then -eu 'quoted text' export echo x=1 2>/dev/null readonly
+	export done done $(pwd) ${HOME} echo done cd export readonly then then 'quoted text'
+grep export readonly awk sed sed local
+		&& ${HOME} done test x=1 echo printf
+awk sed -eu then sed then
+grep -eu local && local readonly | ${HOME} printf 2>/dev/null echo
+		awk && test "$@" && grep -eu sed "$1" $(pwd) ${HOME} "$@" --verbose
+	awk && && cd cd | then test grep awk x=1 'quoted text'
+		test done -eu sed 'quoted text'
+then 2>/dev/null awk x=1 test grep 2>/dev/null
+		/usr/bin sed 2>/dev/null test -eu ${HOME} 2>/dev/null -eu export done
+test 2>/dev/null then done "$@" ${HOME} -eu
+${HOME} "$1" | --verbose
+		export test grep && export
+		export | done "$@" "$@" export echo then /usr/bin readonly 'quoted text' ${HOME}
+cd x=1 then grep "$1" --verbose 'quoted text'
+		-eu done 2>/dev/null export | "$@" cd /usr/bin
+grep test && cd sed x=1 /usr/bin
+then $(pwd) readonly readonly -eu /usr/bin
+		/usr/bin echo done $(pwd) export readonly
+-eu sed -eu awk | | local
+		/usr/bin x=1 ${HOME} --verbose && && export ${HOME} grep cd -eu echo ${HOME} export
+		sed local test grep echo x=1 -eu $(pwd) echo 2>/dev/null grep
+printf | cd 2>/dev/null readonly ${HOME} echo --verbose cd grep readonly && x=1
+	| export done "$1" test test x=1 readonly --verbose --verbose echo $(pwd) ${HOME}
+		"$@" --verbose --verbose test --verbose readonly
+	then "$@" | -eu done --verbose 'quoted text' done
+		readonly -eu && && "$1" ${HOME} "$1" | done /usr/bin
+		test ${HOME} cd echo --verbose done $(pwd) cd done 'quoted text' readonly
+	'quoted text' -eu then sed echo echo
+		awk "$@" 'quoted text' local "$@" export done | /usr/bin 2>/dev/null
+	-eu awk $(pwd) then grep |
+$(pwd) cd ${HOME} "$1" --verbose echo awk then | /usr/bin done -eu ${HOME} 2>/dev/null
+		&& ${HOME} "$@" /usr/bin 'quoted text' | "$@"
+	2>/dev/null sed awk test -eu local
+		test 2>/dev/null awk then
+		$(pwd) export $(pwd) readonly grep /usr/bin | /usr/bin "$@" --verbose test
+cd ${HOME} done grep ${HOME} then ${HOME} cd grep cd
+	| export then --verbose
+		${HOME} export test $(pwd) awk 'quoted text'
+		readonly awk /usr/bin test
+		${HOME} $(pwd) ${HOME} cd sed -eu done
+"$@" then $(pwd) grep done -eu && /usr/bin
+"$@" readonly --verbose "$@"
+"$@" done -eu export local
+	$(pwd) readonly sed && 'quoted text'
+		awk | "$1" awk test awk cd
+		'quoted text' $(pwd) "$1" readonly
+done 2>/dev/null "$1" 2>/dev/null x=1 then cd export
+		grep /usr/bin -eu 'quoted text' && "$@" grep x=1
+awk ${HOME} -eu -eu readonly 'quoted text'
+export "$1" done then ${HOME} export --verbose && readonly
+		/usr/bin done done readonly | "$1"
+		| readonly | done && 'quoted text' &&
+	"$1" ${HOME} $(pwd) local -eu x=1 test | | printf
+		grep done then test local && grep readonly export sed done echo "$@" $(pwd)
+test export -eu && local && 'quoted text' sed done local /usr/bin printf
+		grep 2>/dev/null export -eu --verbose then $(pwd) "$@"
+--verbose local readonly 2>/dev/null "$1" "$1" --verbose $(pwd) && readonly
+x=1 readonly && grep test "$1" x=1 awk && awk $(pwd) 'quoted text' --verbose
+	grep 'quoted text' "$@" sed then test 2>/dev/null 'quoted text' "$1"
+		| readonly $(pwd) test then x=1 |
+	echo then ${HOME} 2>/dev/null
+	x=1 cd && readonly then "$1" -eu --verbose test grep ${HOME} &&
+		export test export export ${HOME} readonly test cd sed grep | x=1 then "$1"
+		/usr/bin "$@" test "$1" x=1 local
+		$(pwd) echo readonly -eu
+	sed x=1 "$@" printf "$1" 'quoted text'
+		2>/dev/null then --verbose done cd -eu $(pwd) $(pwd) $(pwd) && then local done
+$(pwd) 'quoted text' "$1" grep --verbose echo "$1" x=1 done
+	local done then awk --verbose readonly | export "$1" cd 2>/dev/null
+		$(pwd) --verbose && 2>/dev/null test 'quoted text' readonly then
+"$1" 2>/dev/null /usr/bin "$1" ${HOME} readonly 2>/dev/null test | --verbose
+		/usr/bin then | x=1 "$@" && cd local local done --verbose
+x=1 /usr/bin export "$@" $(pwd) export local ${HOME} printf
+		readonly cd local awk x=1 done test && x=1 "$1" readonly ${HOME} awk "$1"
+	-eu --verbose printf test then && local awk /usr/bin
+		done test 'quoted text' export ${HOME} x=1
+	"$1" -eu -eu "$@" 2>/dev/null awk echo test "$@" cd $(pwd) && --verbose
+		grep -eu readonly awk 2>/dev/null test ${HOME} export $(pwd)
+	printf awk | test readonly "$1" done readonly readonly done "$@" grep "$@" ${HOME}
+export awk cd awk readonly $(pwd) grep test 'quoted text'
+"$1" $(pwd) awk 2>/dev/null
+sed local "$@" export "$1" "$@" printf 'quoted text'
+"$@" grep grep -eu ${HOME} $(pwd)
+	/usr/bin x=1 then -eu test | x=1 "$1" 2>/dev/null 'quoted text'
+export $(pwd) ${HOME} x=1 $(pwd) echo -eu
+		then /usr/bin -eu -eu 2>/dev/null printf x=1 readonly --verbose
+	--verbose grep done && --verbose readonly && "$@" sed 'quoted text'
+"$1" | sed /usr/bin export 2>/dev/null test grep /usr/bin /usr/bin
+		'quoted text' 'quoted text'
+		grep export /usr/bin cd $(pwd) "$1" awk $(pwd) readonly
+	2>/dev/null 2>/dev/null -eu awk 'quoted text' ${HOME} printf 2>/dev/null
+	/usr/bin grep /usr/bin awk "$@" /usr/bin ${HOME} "$1" sed grep
+&& "$@" done $(pwd) 2>/dev/null awk 'quoted text' then
+test "$@" 2>/dev/null then awk 'quoted text'
+		then "$@" local --verbose local 'quoted text'
+	${HOME} grep done --verbose sed
+		${HOME} $(pwd) done x=1 test x=1 ${HOME} sed /usr/bin ${HOME} | x=1
+sed 2>/dev/null /usr/bin test x=1 local test sed echo readonly grep done | x=1
+		'quoted text' /usr/bin -eu cd | "$1" ${HOME} printf echo x=1 2>/dev/null
+		local readonly "$@" cd 'quoted text' -eu cd $(pwd) cd readonly x=1 sed
+	sed done local x=1 grep $(pwd)
+		| test readonly "$1" $(pwd) -eu sed done ${HOME} test test echo test grep echo
+awk -eu 2>/dev/null printf /usr/bin $(pwd) cd /usr/bin
+$(pwd) -eu then awk cd ${HOME} done | local 2>/dev/null -eu
+		export 2>/dev/null local --verbose grep printf ${HOME} | "$1" x=1 local $(pwd)
+		x=1 && "$@" then grep "$@"
+	'quoted text' && cd grep "$@" readonly awk done export awk -eu "$@" then
+		&& then $(pwd) "$1" printf
+printf 2>/dev/null test ${HOME}
+	local -eu done $(pwd) | 'quoted text' readonly sed test then local
+	'quoted text' done -eu
+	printf local | sed | | local x=1 sed test grep echo sed done
+2>/dev/null $(pwd) export $(pwd) /usr/bin done cd ${HOME} -eu ${HOME} --verbose
+awk /usr/bin -eu grep test | done /usr/bin echo sed --verbose
+		"$@" echo readonly sed grep 2>/dev/null test echo readonly cd /usr/bin "$@"
+	grep awk awk $(pwd) 'quoted text' "$1"
+${HOME} /usr/bin echo /usr/bin /usr/bin | 2>/dev/null awk
+	--verbose test cd grep local -eu | grep grep sed echo
+	--verbose $(pwd) awk && export export
+"$1" local grep "$@" 'quoted text' then
+		$(pwd) done readonly cd -eu done awk then
+${HOME} test ${HOME} --verbose x=1 echo "$1" then export done sed 'quoted text'
+x=1 done x=1 awk /usr/bin export && 'quoted text' then grep
+		"$@" then test | -eu cd cd -eu sed && sed test |
+	echo x=1 ${HOME} "$@" printf cd | echo $(pwd) && awk grep
+		done cd done sed export /usr/bin 2>/dev/null export -eu x=1 -eu sed
+"$@" readonly grep 2>/dev/null | | | && &&
+	2>/dev/null 'quoted text' awk grep done sed echo then export local $(pwd) echo
+	${HOME} -eu export ${HOME} grep printf grep echo echo printf printf test sed --verbose
+		local | && 'quoted text' readonly local $(pwd) ${HOME} printf local
+-eu "$1" done ${HOME} "$1" export "$@" readonly readonly && then cd "$1" "$@"
+	echo x=1 printf sed local
+	export then printf grep test | export local local then cd 'quoted text'
+		cd -eu awk grep readonly local cd grep "$1" awk echo $(pwd) && sed echo readonly
+		2>/dev/null done 'quoted text'
+test 2>/dev/null "$1" /usr/bin "$@"
+	printf "$@" $(pwd) local /usr/bin echo --verbose
+then x=1 grep printf --verbose test | readonly
+x=1 echo sed 2>/dev/null then --verbose local x=1 /usr/bin export done
+	grep cd then "$1" then local "$1" $(pwd) echo
+		&& done ${HOME} local $(pwd) "$@"
+"$1" then | "$@" x=1 $(pwd) awk local printf export test echo "$1" x=1 | readonly
+&& done readonly awk echo then done done && | 2>/dev/null
+		echo local cd awk readonly sed 'quoted text' "$1"
+"$@" echo | /usr/bin $(pwd) cd && /usr/bin then echo ${HOME}
+	cd "$1" $(pwd) done then --verbose
+| export done 'quoted text' $(pwd) | then done -eu cd --verbose
+	'quoted text' -eu printf test -eu --verbose 2>/dev/null x=1 -eu local "$1" test
+		echo echo x=1 -eu x=1 'quoted text' local cd | /usr/bin readonly
+		'quoted text' done 'quoted text'
+	local export && then export awk
+		done grep awk export 'quoted text' |
+	then printf readonly ${HOME} test "$1" local -eu x=1
+| && sed -eu $(pwd) then ${HOME} "$@"
+test export echo test -eu 2>/dev/null
+/usr/bin awk | $(pwd)
+${HOME} sed "$@" done cd test | 'quoted text' done 'quoted text' --verbose
+		&& -eu printf readonly echo --verbose | sed 'quoted text' awk printf
+		readonly "$@" done grep "$1" ${HOME} "$@" sed grep export 2>/dev/null x=1 cd
+	printf awk sed local test
+		then printf && && $(pwd)
+awk -eu cd "$1" sed echo printf test printf awk 2>/dev/null x=1 $(pwd) export
+		| local --verbose x=1 "$@" && && -eu local grep grep then
+-eu grep sed export "$@" $(pwd) then -eu ${HOME}
+		"$1" awk printf awk /usr/bin 2>/dev/null /usr/bin sed --verbose
+	-eu echo $(pwd) x=1 ${HOME} --verbose x=1
+/usr/bin cd --verbose 'quoted text'
+	${HOME} "$@" export grep 2>/dev/null sed /usr/bin echo
+		-eu x=1 readonly done "$1" printf ${HOME} 2>/dev/null
+local 2>/dev/null awk --verbose sed 'quoted text' then "$@" printf
+	export 2>/dev/null x=1 readonly | readonly --verbose x=1 cd -eu
+	${HOME} awk cd ${HOME} awk "$@" | -eu awk -eu readonly readonly done
+	"$@" echo "$1" | readonly echo test export
+'quoted text' "$1" "$1"
+		2>/dev/null | then /usr/bin echo --verbose 'quoted text'
+&& readonly then grep $(pwd) 2>/dev/null printf --verbose -eu echo
+		-eu -eu $(pwd) done 'quoted text'
+x=1 readonly echo awk grep 2>/dev/null
+	-eu "$1" then cd x=1 'quoted text' "$1" -eu sed local echo then | | $(pwd)
+	&& $(pwd) readonly | /usr/bin ${HOME} then local $(pwd)
+local echo local test echo /usr/bin $(pwd) export export "$@" local ${HOME}
+printf | "$@" --verbose "$@" grep "$@" echo ${HOME}
+		readonly grep awk echo x=1 awk echo echo 2>/dev/null echo sed /usr/bin awk
+	then printf 2>/dev/null ${HOME} ${HOME} ${HOME} printf test awk 2>/dev/null
+	| "$@" echo readonly test --verbose "$@" && cd cd /usr/bin
+2>/dev/null printf 'quoted text' | readonly 2>/dev/null x=1 awk export
+		echo grep echo sed "$@" -eu cd local -eu "$1" 'quoted text'
+$(pwd) readonly "$@" --verbose
+	echo then x=1 echo then local 'quoted text' grep 'quoted text' /usr/bin local
+	then echo then "$@" /usr/bin local echo -eu ${HOME} sed /usr/bin 'quoted text'
+	done /usr/bin "$1" 2>/dev/null awk done done "$@" 'quoted text' /usr/bin 'quoted text'
+		x=1 export local 'quoted text' /usr/bin "$@" awk | "$1" then
+	printf sed awk printf test readonly readonly "$1" readonly ${HOME} awk $(pwd)
+	"$1" export "$1" grep printf export cd sed 2>/dev/null 'quoted text'
+		&& then "$@" 2>/dev/null printf $(pwd) export --verbose | "$@" then done
+	sed /usr/bin | "$@" -eu 'quoted text' export /usr/bin -eu then "$@" printf x=1
+		&& ${HOME} export "$@" printf
+	sed "$@" 2>/dev/null && printf cd test ${HOME} awk test
+	export printf sed --verbose "$@" echo cd $(pwd) && | sed $(pwd) grep 'quoted text'
+		$(pwd) sed $(pwd) ${HOME} local ${HOME}
+then -eu 'quoted text' 'quoted text' sed printf test test "$1"
+then 2>/dev/null | printf
+	export ${HOME} | grep sed local
+local cd then x=1 done done -eu
+	x=1 cd $(pwd) 2>/dev/null done "$1"
+| ${HOME} "$1" | export cd grep sed 2>/dev/null
+	readonly && $(pwd) sed export printf done printf | --verbose
+	awk ${HOME} then test grep x=1 done done "$@" local
+	grep echo -eu $(pwd) printf awk export "$@" ${HOME}
+printf "$@" "$@" echo && cd done export x=1 2>/dev/null "$1" export
+	"$@" -eu /usr/bin $(pwd) local -eu x=1 grep "$1"
+&& echo ${HOME} done x=1 then
+grep 'quoted text' | local echo --verbose
+	"$1" "$@" grep --verbose $(pwd) "$@" -eu sed then awk printf
+	sed $(pwd) "$@" "$@" grep x=1 -eu | echo then test
+grep -eu export --verbose printf cd awk
+${HOME} "$1" $(pwd) | --verbose local
+	then "$@" -eu $(pwd) printf | awk --verbose
+	-eu 'quoted text' /usr/bin test "$@" /usr/bin /usr/bin awk local x=1 cd
+awk /usr/bin cd awk | test | x=1 -eu
+printf /usr/bin /usr/bin done
+grep /usr/bin printf export done
+		${HOME} local done 2>/dev/null done test grep -eu local | && -eu
+		'quoted text' "$1" printf
+	-eu /usr/bin local grep grep echo readonly
+printf ${HOME} 2>/dev/null
+		"$1" -eu then sed done /usr/bin test then 'quoted text'
+	"$1" && 'quoted text' ${HOME} --verbose
+grep done grep -eu 2>/dev/null awk -eu export then done printf 'quoted text' echo
+		local local local 2>/dev/null then grep | ${HOME} export "$@" export sed echo
+| done "$1" printf export then awk sed | test done printf
+		'quoted text' ${HOME} printf done --verbose
+		${HOME} x=1 then 'quoted text' "$1" "$1"
+	--verbose printf /usr/bin $(pwd) awk $(pwd) printf 2>/dev/null
+	printf 'quoted text' -eu local --verbose
+		echo -eu awk "$@" -eu ${HOME} "$@" 2>/dev/null | grep x=1 "$@" cd 2>/dev/null readonly
+		awk sed echo 2>/dev/null export echo
+		export --verbose sed printf /usr/bin /usr/bin
+		sed 2>/dev/null sed echo grep "$@" "$1" local "$1" ${HOME} sed
+--verbose -eu echo | --verbose
+		then | ${HOME} sed export $(pwd) sed readonly done
+		--verbose "$@" 2>/dev/null
+		| --verbose sed $(pwd) grep local sed 2>/dev/null echo
+	echo local grep local sed local 'quoted text' 'quoted text' export test 2>/dev/null
+	printf && "$@" --verbose 2>/dev/null grep grep ${HOME} "$@"
+-eu sed test grep grep ${HOME} then cd $(pwd) ${HOME} x=1 && printf
+		test | awk test export test "$1" grep | $(pwd) then
+	x=1 grep done && grep awk grep awk local
+	local then echo && sed $(pwd) cd printf "$@" echo /usr/bin
+		x=1 local && sed then
+&& test x=1 --verbose export
+$(pwd) grep readonly ${HOME} readonly echo /usr/bin
+	done sed echo done | then x=1 export
+awk /usr/bin echo grep && awk printf cd local sed "$1" 'quoted text'
+$(pwd) sed 2>/dev/null local x=1 -eu ${HOME} readonly
+		awk --verbose && test | | echo local
+	awk awk done done 2>/dev/null sed /usr/bin --verbose
+		done $(pwd) printf done "$1" 'quoted text' --verbose echo 2>/dev/null
+		test export 'quoted text' export grep grep
+-eu local readonly local echo --verbose awk x=1 && 'quoted text'
+done export then x=1 local sed --verbose readonly then
+"$@" printf local done "$1" |
+		'quoted text' local then readonly export -eu $(pwd) local
+		printf local export cd "$@" -eu | ${HOME} $(pwd) done
+	cd sed echo && cd 2>/dev/null
+		--verbose done x=1 export cd ${HOME}
+test readonly | /usr/bin && readonly x=1 2>/dev/null sed
+test awk cd readonly ${HOME} --verbose $(pwd) test
+grep awk /usr/bin --verbose | -eu local export --verbose
+awk echo printf "$1" 2>/dev/null done
+	2>/dev/null && "$@" cd --verbose cd awk && x=1 ${HOME} grep grep sed x=1 sed
+	grep awk echo "$@" grep "$@" /usr/bin then export --verbose
+	sed test --verbose done ${HOME} local
+$(pwd) sed 2>/dev/null awk x=1 echo
+		grep awk done grep grep printf cd sed
+--verbose readonly echo cd grep then && && export sed 2>/dev/null then printf
+		${HOME} readonly test x=1 local -eu $(pwd) test "$1" awk 'quoted text'
+x=1 'quoted text' x=1 /usr/bin grep 2>/dev/null test | "$@" then
+	&& awk && --verbose "$@" --verbose
+	sed grep export -eu "$1" $(pwd) | $(pwd) printf 'quoted text' x=1 test x=1 test
+${HOME} --verbose cd cd test ${HOME} 'quoted text'
+		cd "$1" cd | "$1" printf test
+		test --verbose then export sed "$1" local 'quoted text' local sed grep sed 2>/dev/null
+	2>/dev/null && printf echo | /usr/bin
+		| 'quoted text' printf --verbose ${HOME} sed printf printf cd grep && && 2>/dev/null
+		"$@" 'quoted text' awk --verbose cd $(pwd) grep /usr/bin 'quoted text'
+	-eu "$1" local | local then then readonly done awk | local sed readonly
+	sed printf sed /usr/bin "$1" x=1
+	sed | sed $(pwd) 'quoted text'
+		&& --verbose x=1 grep echo export done grep export &&
+	"$1" x=1 cd -eu | | awk "$1" && 'quoted text' readonly $(pwd) "$1"
+/usr/bin 'quoted text' --verbose cd --verbose -eu /usr/bin 2>/dev/null
+		| grep --verbose 'quoted text' "$@" | done echo "$@" --verbose 'quoted text' 'quoted text'
+		export "$@" 'quoted text' local grep 'quoted text' cd ${HOME}
+	--verbose echo sed x=1
+	--verbose test readonly ${HOME} awk x=1 echo ${HOME} /usr/bin test local
+${HOME} echo 2>/dev/null test local | | done awk $(pwd)
+		sed then -eu "$@" $(pwd) readonly && 'quoted text' local awk done "$1" -eu
+readonly awk x=1 "$1"
+	export -eu export printf echo $(pwd) x=1 export $(pwd)
+then ${HOME} local --verbose 'quoted text' grep
+	awk awk "$@" 2>/dev/null echo
+cd export ${HOME} && "$1" 'quoted text' "$@"
+		echo && cd 'quoted text' readonly /usr/bin local "$1" && $(pwd)
+		then "$1" readonly awk sed "$@" /usr/bin $(pwd)
+		| && export sed -eu -eu grep 2>/dev/null
+	/usr/bin export cd "$1" $(pwd) x=1 then printf done readonly echo --verbose
+printf cd test grep grep local 'quoted text'
+&& readonly then cd local
+	cd "$1" readonly grep printf 'quoted text' readonly readonly sed
+		readonly sed readonly --verbose ${HOME} ${HOME}
+	readonly | done readonly printf
+		2>/dev/null $(pwd) sed export | $(pwd)
+		"$1" printf x=1 | "$1" && ${HOME} x=1 $(pwd) readonly
+		--verbose then printf $(pwd) /usr/bin grep x=1 readonly x=1 'quoted text'
+		/usr/bin printf 'quoted text' -eu | done cd then local ${HOME}
+export sed -eu cd readonly test local 'quoted text' "$@" cd readonly x=1
+		${HOME} test 'quoted text' test "$1" test then --verbose 'quoted text' awk
+	"$1" "$@" x=1 | grep $(pwd) 2>/dev/null 'quoted text' awk
+		"$@" local sed -eu local export /usr/bin --verbose x=1 2>/dev/null local
+	--verbose --verbose 'quoted text'
+		then | "$@" grep && --verbose
+	-eu then readonly grep
+	printf then readonly readonly cd then
+		cd 'quoted text' done then sed "$@" ${HOME} 'quoted text' local done echo echo grep
+		then test && grep awk
+		printf ${HOME} --verbose
+		grep x=1 grep ${HOME} | "$@" awk "$1" sed printf "$1" done 2>/dev/null printf
+	'quoted text' cd $(pwd)
+		${HOME} --verbose printf 'quoted text' export local export "$@" "$1" then
+	-eu test grep awk /usr/bin $(pwd) --verbose
+	grep sed x=1 "$@" x=1 echo --verbose $(pwd) awk then printf
+'quoted text' 2>/dev/null awk && grep readonly -eu grep
+	printf | echo $(pwd) 2>/dev/null
+		echo "$1" printf 'quoted text'
+		grep awk grep "$1" test /usr/bin
+sed echo ${HOME} echo "$1" printf x=1
+		done && export x=1 test cd "$@" then
+	"$@" && cd ${HOME} echo ${HOME} readonly then /usr/bin "$1" 2>/dev/null awk export
+		then cd ${HOME} "$1" $(pwd) /usr/bin
+	export done sed cd "$1"
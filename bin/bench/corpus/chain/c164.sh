@@ -0,0 +1,2001 @@
+echo readonly grep grep && ${HOME} /usr/bin
+	awk sed && cd test -eu export --verbose x=1 "$@" grep 'quoted text' && test printf
+export printf "$1" test $(pwd) x=1 cd cd readonly cd "$1" /usr/bin
+		readonly x=1 awk export $(pwd) done x=1 printf awk sed --verbose grep local done
+x=1 /usr/bin "$1" local |
+	$(pwd) sed sed awk local readonly "$@" printf export local --verbose
+		readonly $(pwd) local echo "$@" 'quoted text' done "$@" "$@" 'quoted text' ${HOME}
+readonly printf 2>/dev/null "$1" then export |
+2>/dev/null echo printf "$@" x=1 x=1 awk readonly 'quoted text' sed readonly
+	readonly /usr/bin then $(pwd) echo test ${HOME} "$1" 'quoted text' "$@" done
+	| && "$@" sed "$1" ${HOME} 2>/dev/null cd export "$@" cd awk ${HOME} &&
+	sed grep && -eu "$1" export printf
+		test cd local 'quoted text' $(pwd) done local x=1 printf -eu sed "$1" 'quoted text'
+"$@" /usr/bin --verbose 'quoted text' cd grep "$@"
+	x=1 -eu -eu printf | /usr/bin echo "$1"
+		"$@" 'quoted text' awk sed 2>/dev/null ${HOME} sed
+	"$@" done printf export 'quoted text'
+		test "$@" 'quoted text' readonly done 2>/dev/null -eu
+	export sed --verbose "$1" done ${HOME} export
+		readonly && printf local && && awk /usr/bin
+export && -eu "$@" printf --verbose
+	"$@" export done -eu done readonly test 2>/dev/null
+/usr/bin "$1" && grep "$1" 2>/dev/null /usr/bin
+readonly export then 2>/dev/null x=1 "$@" export -eu
+	local $(pwd) readonly
+		printf printf 2>/dev/null sed --verbose "$@" -eu --verbose 2>/dev/null printf ${HOME}
+test ${HOME} readonly then | | done test readonly $(pwd) then "$1" readonly grep
+		echo -eu "$@" 2>/dev/null x=1 'quoted text' printf ${HOME} local &&
+		done export local echo "$1" done 2>/dev/null
+		"$1" cd export grep cd
+	-eu ${HOME} readonly then local readonly
+		local grep /usr/bin grep
+2>/dev/null x=1 sed $(pwd) export sed && 'quoted text'
+		grep echo echo "$@" export cd ${HOME} /usr/bin grep then 2>/dev/null
+		&& done grep export --verbose done sed x=1 $(pwd)
+2>/dev/null echo && 'quoted text' then 2>/dev/null test 2>/dev/null
+	$(pwd) && "$@" "$1" grep test /usr/bin /usr/bin "$@" --verbose printf grep && &&
+test sed $(pwd) 2>/dev/null awk && -eu then export && then 2>/dev/null "$@"
+&& done readonly export cd 2>/dev/null
+	2>/dev/null export ${HOME} local then | x=1 awk "$1" sed grep awk local done
+| --verbose 2>/dev/null readonly readonly cd echo sed --verbose readonly 2>/dev/null
+		&& "$1" grep --verbose -eu cd --verbose
+	"$@" ${HOME} x=1 printf local
+	2>/dev/null sed /usr/bin /usr/bin -eu export 2>/dev/null ${HOME}
+	local export && 2>/dev/null && echo export ${HOME} && grep 2>/dev/null
+		export test && | done x=1 "$@" echo printf ${HOME}
+	sed x=1 x=1 readonly test export x=1 'quoted text'
+		local 2>/dev/null readonly done export && "$1" x=1 $(pwd) export
+		grep test 2>/dev/null echo ${HOME} grep && | -eu /usr/bin x=1 | export
+		&& "$1" test ${HOME} 'quoted text' -eu local sed && /usr/bin "$1" "$1" readonly
+export --verbose x=1 2>/dev/null "$1" 2>/dev/null cd printf 2>/dev/null
+	$(pwd) 2>/dev/null sed /usr/bin --verbose | $(pwd) 2>/dev/null /usr/bin $(pwd)
+	done cd awk "$@" "$1" 'quoted text' then 2>/dev/null readonly cd 2>/dev/null
+	-eu $(pwd) ${HOME} echo
+	--verbose x=1 && echo $(pwd) && x=1 echo awk echo
+		grep --verbose && local done ${HOME} 2>/dev/null awk awk
+	grep -eu ${HOME} /usr/bin then
+"$1" 2>/dev/null x=1 && export && echo
+readonly test printf 'quoted text'
+		2>/dev/null /usr/bin then grep printf local done sed test -eu
+		echo "$@" done 'quoted text' then "$@" 2>/dev/null | echo ${HOME}
+&& | $(pwd) then /usr/bin test ${HOME} /usr/bin
+local cd readonly | printf
+	readonly local cd | done -eu 'quoted text' --verbose
+		done "$1" echo /usr/bin
+	$(pwd) 'quoted text' test then printf 'quoted text' then 2>/dev/null
+-eu local | export --verbose | | | ${HOME} printf 2>/dev/null
+	printf -eu sed grep "$@" "$@" -eu "$@" awk cd --verbose then echo "$@" echo
+export "$1" grep "$1" "$1" ${HOME} "$@"
+$(pwd) printf "$1" test 2>/dev/null
+test 2>/dev/null export export "$@" cd grep "$1" test "$@" grep $(pwd) x=1 printf
+	echo $(pwd) test local $(pwd) done readonly test test
+		awk 2>/dev/null | 'quoted text'
+$(pwd) cd then x=1 -eu
+export printf ${HOME} cd awk x=1 --verbose echo 'quoted text' cd sed grep
+	then | ${HOME} awk 'quoted text' test done
+	then printf then 'quoted text' && ${HOME} cd then
+sed && readonly awk 2>/dev/null done | sed 2>/dev/null 2>/dev/null
+	$(pwd) export /usr/bin "$1"
+		then awk grep 2>/dev/null done readonly then sed $(pwd) then "$@" 'quoted text'
+		cd 'quoted text' done sed x=1 |
+	${HOME} awk "$1" printf printf
+echo printf done then
+	$(pwd) ${HOME} local echo done done echo local $(pwd) readonly "$1"
+	readonly awk readonly awk && 'quoted text'
+echo sed export --verbose local "$@" --verbose 'quoted text'
+	"$1" then printf printf /usr/bin local ${HOME}
+		then "$@" /usr/bin grep -eu printf cd sed
+		/usr/bin $(pwd) $(pwd) "$@" export cd 2>/dev/null
+/usr/bin $(pwd) | 2>/dev/null && 'quoted text' $(pwd) done | --verbose
+		grep then then --verbose x=1 -eu $(pwd) awk --verbose x=1 then
+2>/dev/null -eu echo "$@" && -eu export
+${HOME} --verbose $(pwd) 2>/dev/null --verbose readonly
+		| "$@" awk test then export x=1 "$1" /usr/bin echo 'quoted text' 2>/dev/null
+	cd && readonly ${HOME} printf -eu grep echo readonly
+		export /usr/bin echo then local
+		done && test | -eu done test then grep local done readonly printf /usr/bin |
+		test grep "$1" ${HOME} sed echo $(pwd) 'quoted text' done printf
+		&& && echo cd | $(pwd) cd -eu local 2>/dev/null ${HOME} grep
+		2>/dev/null local local 2>/dev/null "$1" ${HOME} /usr/bin
+"$1" echo test "$1" grep grep awk --verbose --verbose /usr/bin export
+	'quoted text' -eu x=1 readonly export test local ${HOME} 'quoted text' echo
+export x=1 grep /usr/bin export "$1" done
+readonly cd then | | 'quoted text' ${HOME} --verbose
+		"$1" --verbose export test x=1 awk --verbose "$@" readonly sed "$1" grep
+		-eu local 2>/dev/null $(pwd) x=1 export "$1" printf then sed --verbose grep
+		$(pwd) sed "$1" ${HOME} | done --verbose done grep local awk "$@" ${HOME} done
+	/usr/bin "$@" then | 'quoted text' 'quoted text' grep -eu grep local
+		/usr/bin "$@" done | "$1" 2>/dev/null
+		| sed ${HOME} 'quoted text' then grep && grep sed
+	export then $(pwd) done -eu
+done then x=1 sed ${HOME} test
+		local ${HOME} x=1 | $(pwd) echo $(pwd) done $(pwd)
+	cd | x=1 'quoted text' $(pwd) ${HOME} 'quoted text' -eu -eu readonly readonly
+	"$1" "$1" export done local "$1" test
+	readonly 2>/dev/null --verbose sed readonly echo local -eu done &&
+/usr/bin $(pwd) readonly printf readonly
+'quoted text' -eu x=1 test $(pwd) then echo echo echo then -eu test 2>/dev/null
+local done readonly sed
+		$(pwd) && --verbose readonly "$1"
+		cd | readonly echo "$@" printf $(pwd)
+		awk grep ${HOME} && local
+		sed "$@" cd local done "$@" cd /usr/bin 'quoted text' awk
+		x=1 'quoted text' x=1 x=1 export
+	${HOME} cd printf echo 2>/dev/null export
+		| $(pwd) | awk ${HOME} printf /usr/bin "$1" cd export grep
+printf x=1 'quoted text' && x=1 cd awk 2>/dev/null
+local "$1" awk 'quoted text' grep echo x=1
+	/usr/bin /usr/bin "$1" x=1 echo local export readonly test 2>/dev/null |
+	readonly printf /usr/bin export sed
+	$(pwd) readonly test $(pwd) readonly cd then /usr/bin
+		local 2>/dev/null export --verbose /usr/bin sed awk export sed
+	"$@" printf readonly readonly echo readonly 2>/dev/null export 2>/dev/null "$@"
+		$(pwd) --verbose readonly ${HOME}
+		2>/dev/null export sed grep cd echo cd ${HOME} | $(pwd)
+	echo ${HOME} printf "$1" && ${HOME} echo readonly && "$1" "$@" test
+		"$1" local $(pwd) /usr/bin awk 2>/dev/null
+	readonly "$@" -eu x=1 test 2>/dev/null $(pwd) 2>/dev/null /usr/bin x=1 then
+then 'quoted text' $(pwd) then grep then
+	&& test --verbose test --verbose -eu --verbose test --verbose | 'quoted text'
+$(pwd) -eu --verbose -eu && | grep 2>/dev/null sed
+--verbose $(pwd) readonly /usr/bin export --verbose export awk then /usr/bin
+	grep 'quoted text' -eu
+| --verbose $(pwd) "$1" 2>/dev/null && printf 2>/dev/null local "$@" cd "$@"
+'quoted text' -eu test done ${HOME} done 'quoted text' cd done $(pwd) | &&
+grep $(pwd) --verbose printf
+| done "$1" "$1" "$1" local done
+		cd x=1 /usr/bin 'quoted text'
+2>/dev/null | "$1" printf local
+		then local export printf $(pwd)
+	$(pwd) /usr/bin -eu done test test -eu ${HOME} local
+	${HOME} export $(pwd) done printf && $(pwd) printf then cd /usr/bin then $(pwd)
+	--verbose x=1 x=1 test done $(pwd) $(pwd)
+-eu export readonly export grep grep local /usr/bin 'quoted text'
+-eu then done | local test readonly
+cd ${HOME} sed then test -eu "$@" x=1 'quoted text'
+		| 'quoted text' then x=1 --verbose
+	x=1 export && readonly /usr/bin local
+then | $(pwd) done "$1" ${HOME} && -eu export export awk $(pwd) sed 'quoted text'
+	--verbose "$@" grep /usr/bin sed awk printf printf "$1" -eu --verbose
+export awk grep printf | $(pwd) test printf
+echo x=1 2>/dev/null local "$1" 'quoted text'
+		--verbose grep | --verbose | 'quoted text'
+	sed 2>/dev/null "$1" printf
+x=1 cd --verbose -eu done
+		local echo awk sed && printf test test grep "$1" | $(pwd)
+x=1 "$1" -eu 2>/dev/null /usr/bin && | done --verbose export then
+	--verbose grep /usr/bin 2>/dev/null
+	export -eu export 'quoted text' "$@" local echo export "$@" readonly then printf
+	| -eu && cd grep local then test cd export ${HOME} awk && then
+$(pwd) then x=1 2>/dev/null --verbose then x=1 grep export
+$(pwd) awk 'quoted text' grep sed -eu sed
+	$(pwd) readonly then awk $(pwd) then && x=1 "$1"
+-eu grep --verbose "$@" echo grep grep --verbose
+/usr/bin --verbose | grep "$1" ${HOME} x=1 printf -eu sed 2>/dev/null 'quoted text'
+		cd && printf sed printf --verbose
+		"$1" echo done readonly 2>/dev/null echo x=1 echo sed local then printf
+local then sed sed test test ${HOME} "$1" $(pwd) readonly "$1" x=1 echo
+		/usr/bin $(pwd) done echo && cd x=1 "$@" ${HOME}
+		x=1 sed "$@" echo "$1" grep "$1" x=1 'quoted text' echo local "$@" awk "$@" 'quoted text'
+		'quoted text' && awk "$@" 'quoted text' -eu $(pwd)
+	'quoted text' test test grep
+		awk grep "$1" --verbose done | awk "$@" done awk export $(pwd) && then "$1" 2>/dev/null
+	test | 2>/dev/null "$@" cd && --verbose
+	"$@" /usr/bin printf --verbose
+cd /usr/bin sed 2>/dev/null export sed export grep
+	$(pwd) /usr/bin && echo "$1" export
+		test grep cd ${HOME} grep
+'quoted text' ${HOME} done grep
+		/usr/bin then "$1" echo --verbose printf 'quoted text' echo done | sed awk echo
+		/usr/bin /usr/bin ${HOME} "$1" ${HOME} then -eu sed test ${HOME} grep
+$(pwd) then sed && --verbose then 2>/dev/null "$@"
+		$(pwd) 'quoted text' local -eu grep echo 2>/dev/null then done $(pwd)
+grep -eu done sed "$@" | -eu "$@" done
+	"$@" x=1 awk 'quoted text' export && "$1" && 2>/dev/null test sed /usr/bin -eu
+"$@" awk grep then $(pwd)
+	-eu printf x=1 cd export done sed x=1 then then printf awk /usr/bin
+	/usr/bin sed export /usr/bin test done local cd x=1 done /usr/bin local "$1"
+	x=1 awk ${HOME} ${HOME}
+		--verbose -eu "$@" $(pwd) local /usr/bin then --verbose
+		x=1 sed readonly echo -eu
+	&& printf echo /usr/bin local
+		export "$@" && test echo test
+x=1 test --verbose printf printf
+printf /usr/bin local $(pwd) /usr/bin
+	x=1 "$@" echo then && -eu printf
+	local grep grep ${HOME} -eu 'quoted text'
+echo | --verbose ${HOME} /usr/bin $(pwd) sed x=1 2>/dev/null
+		$(pwd) export --verbose
+	done /usr/bin /usr/bin 2>/dev/null | -eu cd ${HOME} --verbose && "$1"
+	/usr/bin "$@" && --verbose x=1 local --verbose
+		local printf | grep && x=1 done export 2>/dev/null local "$@" local
+		/usr/bin readonly awk x=1 --verbose ${HOME} echo printf readonly
+	local cd 2>/dev/null $(pwd) cd done done
+	cd 2>/dev/null awk "$1" local sed && grep cd readonly --verbose 2>/dev/null
+2>/dev/null export done cd sed echo echo
+		done && local $(pwd) local awk
+	done export && test export
+	readonly --verbose readonly local awk export done "$1" sed $(pwd)
+	--verbose x=1 grep printf x=1 test "$@" "$@" grep awk test "$@" | readonly 2>/dev/null
+	'quoted text' then awk grep --verbose done -eu export ${HOME}
+	x=1 ${HOME} done test test sed awk "$1" test 2>/dev/null && -eu readonly "$1"
+2>/dev/null | /usr/bin /usr/bin "$1" cd grep -eu local
+	sed then then echo readonly
+		2>/dev/null sed ${HOME} ${HOME} export "$@" done awk grep
+"$@" "$1" /usr/bin export then readonly test 2>/dev/null 2>/dev/null cd
+	echo printf local $(pwd)
+readonly | cd x=1 test x=1 then local
+readonly echo export ${HOME} | readonly grep
+	local $(pwd) done "$1" grep done "$1" sed && readonly
+'quoted text' done "$@" readonly sed 2>/dev/null
+	2>/dev/null "$1" 'quoted text'
+	printf /usr/bin x=1 | 2>/dev/null &&
+	"$1" then "$1" then | test x=1 $(pwd) 'quoted text' -eu --verbose
+		--verbose readonly 2>/dev/null echo
+	--verbose 'quoted text' cd 2>/dev/null readonly
+	export grep /usr/bin test
+		&& test local $(pwd) test | $(pwd) readonly
+'quoted text' | 2>/dev/null test test test /usr/bin test $(pwd) $(pwd)
+	--verbose --verbose cd ${HOME} readonly sed "$@" export export | "$@"
+	done readonly | && printf grep echo readonly
+		cd then --verbose ${HOME} /usr/bin ${HOME} readonly "$1" sed ${HOME} -eu
+&& x=1 2>/dev/null awk "$@" echo --verbose 'quoted text' printf $(pwd) sed /usr/bin
+sed $(pwd) readonly -eu export sed "$1" cd 2>/dev/null
+		done 2>/dev/null done
+	readonly echo /usr/bin local test then ${HOME} x=1 "$@"
+&& | && printf readonly "$1" done && && export 'quoted text' /usr/bin /usr/bin done
+export ${HOME} $(pwd) cd |
+	test printf --verbose "$1" sed --verbose -eu sed cd done grep --verbose --verbose
+	2>/dev/null then ${HOME} 'quoted text' && "$@" test
+	readonly cd 2>/dev/null | awk "$@" --verbose grep printf local
+		-eu 'quoted text' grep echo ${HOME} x=1 grep then && $(pwd) export $(pwd) 2>/dev/null
+		/usr/bin "$@" "$1" readonly x=1 ${HOME} "$@" | x=1 2>/dev/null
+echo ${HOME} --verbose ${HOME}
+		&& test sed 'quoted text' awk echo awk sed export then
+		'quoted text' export -eu x=1 && export printf then sed x=1 sed test | ${HOME} |
+		grep cd && "$@" 2>/dev/null && | -eu export ${HOME} grep then /usr/bin
+	readonly 'quoted text' printf /usr/bin grep echo local echo awk "$@" | export
+	'quoted text' ${HOME} "$1" x=1 sed --verbose
+	${HOME} export local "$1" export export $(pwd)
+	| /usr/bin cd echo done | && "$@" sed then
+		"$@" && 'quoted text' x=1
+	$(pwd) -eu && /usr/bin cd done printf then |
+		echo ${HOME} "$1" "$1" "$1" 2>/dev/null "$1" -eu cd && "$@" --verbose
+		$(pwd) printf 'quoted text' 2>/dev/null -eu ${HOME} $(pwd) --verbose
+		"$1" "$@" cd local /usr/bin printf "$1" | 'quoted text' grep
+		test local ${HOME} /usr/bin && cd cd export x=1 --verbose && grep test local
+	echo sed x=1 export then
+'quoted text' echo sed && && 'quoted text' export echo cd
+		&& x=1 test 'quoted text' export "$1" export -eu
+"$@" echo test cd local $(pwd) printf && printf &&
+		"$@" "$1" x=1 export /usr/bin echo 'quoted text' | local test
+		--verbose -eu 'quoted text' done awk grep
+	local && | test sed readonly test $(pwd) | done
+		$(pwd) ${HOME} sed local readonly x=1 x=1 local $(pwd) local -eu "$1" $(pwd)
+		2>/dev/null done ${HOME} --verbose
+	--verbose -eu then 'quoted text'
+x=1 'quoted text' -eu $(pwd) /usr/bin x=1 export export
+2>/dev/null export local grep | "$1" /usr/bin local done x=1 /usr/bin
+readonly | "$@" --verbose cd sed 'quoted text' $(pwd) sed "$1" && "$1"
+		echo ${HOME} $(pwd) test sed 'quoted text'
+	then -eu x=1 2>/dev/null awk 'quoted text' done sed
+		| --verbose grep then 'quoted text'
+	then test --verbose echo readonly grep then cd cd | && printf
+		echo printf x=1 2>/dev/null cd
+$(pwd) /usr/bin $(pwd) $(pwd) "$@" test "$1"
+echo test /usr/bin grep local grep echo awk
+		printf echo x=1 test then x=1 sed --verbose
+		"$1" && --verbose done "$1" ${HOME} && "$1" /usr/bin printf
+		cd | sed printf ${HOME} done echo done done 'quoted text' done
+	${HOME} sed "$@" test done local $(pwd)
+		| test | grep test "$@" sed | echo 2>/dev/null
+		readonly printf awk cd export readonly
+awk x=1 export export x=1
+done x=1 done "$@" export export x=1 $(pwd) cd && ${HOME} x=1 echo sed
+done "$@" awk then printf echo && $(pwd) "$1" readonly grep
+| sed awk cd x=1 test 'quoted text' test -eu awk | /usr/bin | test "$1"
+	then grep export awk ${HOME} cd export ${HOME}
+		&& done export awk "$@" grep then grep done x=1 echo x=1 echo | && export echo
+	echo local && $(pwd) 2>/dev/null /usr/bin grep echo grep "$1" 'quoted text'
+awk x=1 export -eu test printf
+	2>/dev/null echo export -eu then
+		$(pwd) echo echo echo export local
+	echo cd 2>/dev/null --verbose "$1" -eu && test
+	grep then export echo ${HOME} "$1" "$1" /usr/bin x=1 | /usr/bin grep then ${HOME}
+		"$@" && ${HOME} --verbose readonly
+		printf local sed "$1" $(pwd) ${HOME} | then $(pwd) | && ${HOME} "$@" awk
+	echo 'quoted text' test && | x=1 then export --verbose -eu
+		"$1" sed | -eu export ${HOME} readonly x=1 export then -eu
+echo ${HOME} ${HOME} printf cd grep
+done awk "$1" $(pwd) then
+	done 2>/dev/null | "$1" sed awk -eu --verbose echo ${HOME}
+		'quoted text' readonly printf --verbose &&
+		local "$1" local echo 2>/dev/null readonly | --verbose "$@" printf |
+&& awk 2>/dev/null 'quoted text' export -eu local "$1" -eu "$@" 2>/dev/null
+	/usr/bin export -eu then export local && readonly $(pwd) x=1 cd /usr/bin
+	${HOME} awk 2>/dev/null cd test test then ${HOME} "$@" $(pwd)
+"$1" then done export --verbose
+	| cd test readonly "$1" | "$@" -eu "$1" --verbose echo awk done printf readonly
+	echo -eu then awk && awk grep "$@" "$1" 2>/dev/null awk grep then cd 2>/dev/null
+		x=1 sed local ${HOME} echo 'quoted text'
+	printf then cd -eu test | cd readonly
+		${HOME} export 2>/dev/null | export grep /usr/bin grep $(pwd)
+		${HOME} sed awk $(pwd) --verbose ${HOME} "$1" readonly "$1" printf
+		local cd | "$@" /usr/bin "$@" local && then readonly test readonly 'quoted text'
+grep --verbose then | | awk x=1 && --verbose then ${HOME}
+cd x=1 2>/dev/null test $(pwd) awk x=1 --verbose
+	done -eu --verbose x=1 -eu readonly
+		export awk | ${HOME} awk ${HOME} /usr/bin awk --verbose
+		2>/dev/null readonly /usr/bin sed ${HOME} local echo | | grep
+sed $(pwd) done test then && grep 2>/dev/null
+		"$@" done grep done done -eu /usr/bin "$1" awk |
+		awk then "$1" echo local test 2>/dev/null -eu x=1 $(pwd) 'quoted text' ${HOME} local
+		/usr/bin 'quoted text' test export cd then
+"$1" readonly $(pwd) "$@"
+x=1 cd 2>/dev/null x=1 ${HOME} readonly done 2>/dev/null sed readonly export cd
+--verbose echo "$@" ${HOME} echo sed x=1 cd /usr/bin && 2>/dev/null
+printf export $(pwd) test "$1" grep readonly
+x=1 2>/dev/null test cd 2>/dev/null && local
+done 'quoted text' 2>/dev/null && export grep cd readonly grep
+		-eu /usr/bin ${HOME} 2>/dev/null
+	'quoted text' done 2>/dev/null -eu awk test x=1
+		| test -eu done echo &&
+done | test && | x=1 cd --verbose export
+		/usr/bin --verbose /usr/bin readonly cd --verbose echo
+		| /usr/bin 'quoted text' && /usr/bin
+"$@" test then awk "$1" export /usr/bin 2>/dev/null 'quoted text'
+		grep 2>/dev/null "$@" local local cd
+| --verbose echo then "$1" && export printf | echo test x=1
+	echo test | awk /usr/bin then done awk
+-eu "$1" x=1 echo --verbose | echo
+		${HOME} ${HOME} /usr/bin x=1 printf "$@" | | $(pwd) "$1" readonly |
+	local --verbose grep -eu | ${HOME} done export echo $(pwd) x=1 'quoted text'
+		-eu grep --verbose | sed printf echo
+	| test awk && 2>/dev/null "$@"
+		echo /usr/bin grep local --verbose
+		| /usr/bin printf done $(pwd) -eu -eu
+		${HOME} then printf export done cd 'quoted text'
+	local printf -eu x=1 awk grep then -eu export local | then
+	--verbose readonly x=1 test readonly x=1 printf printf sed
+		2>/dev/null grep /usr/bin && grep then
+		--verbose readonly done $(pwd)
+	local "$1" then $(pwd)
+		-eu -eu printf | local readonly "$@" sed
+	/usr/bin local --verbose "$@" done 2>/dev/null export ${HOME} grep export local
+	grep && done --verbose |
+		2>/dev/null "$@" local | grep "$1" cd 2>/dev/null
+	2>/dev/null grep awk && done then "$@" $(pwd) 'quoted text' done |
+"$@" && /usr/bin done done done test test && | "$@" awk "$1" ${HOME}
+then echo 'quoted text' && grep cd cd -eu 'quoted text' $(pwd) x=1 'quoted text'
+		"$@" && done 2>/dev/null readonly /usr/bin ${HOME} done grep &&
+		done $(pwd) local export -eu ${HOME} echo "$1" x=1 'quoted text' export
+	done x=1 grep 'quoted text' x=1 printf --verbose
+	awk grep test 'quoted text' x=1 $(pwd) export readonly
+	'quoted text' 'quoted text' --verbose 'quoted text' grep x=1 printf done done
+		sed 2>/dev/null | then done sed printf test && readonly $(pwd)
+&& readonly local x=1 test "$@" test x=1 ${HOME} sed printf local
+	x=1 "$1" cd ${HOME} cd awk awk sed echo export "$1" grep /usr/bin cd test
+	cd && export readonly cd readonly ${HOME} awk
+grep "$@" sed done printf /usr/bin
+		sed $(pwd) 'quoted text' sed 2>/dev/null
+		| awk printf && test done sed sed | done
+'quoted text' awk cd $(pwd) grep ${HOME} readonly 'quoted text'
+	echo done echo --verbose sed test local then export done -eu
+	$(pwd) grep sed 'quoted text' awk
+		done ${HOME} test grep test && sed -eu test sed done echo x=1 'quoted text'
+--verbose 'quoted text' cd export printf awk test sed && echo "$1"
+	export echo printf "$@" export 'quoted text' grep echo -eu &&
+readonly readonly cd test /usr/bin $(pwd) 2>/dev/null printf "$@"
+		--verbose -eu | grep export done $(pwd) readonly -eu
+		then grep "$1" then readonly sed && awk done && 2>/dev/null readonly readonly
+		/usr/bin grep awk --verbose done test printf printf /usr/bin printf echo awk
+	x=1 export awk 2>/dev/null grep "$1" export test
+	printf | --verbose $(pwd) && --verbose export /usr/bin echo awk 'quoted text' |
+		${HOME} printf && readonly ${HOME} printf | | ${HOME} -eu
+		| --verbose done test | x=1 local
+		-eu printf printf test echo ${HOME} awk -eu 'quoted text'
+sed printf 'quoted text' "$1" ${HOME} then $(pwd)
+grep cd && echo then sed --verbose export | | awk 'quoted text'
+	&& local "$1" "$1" 'quoted text' awk $(pwd) done | 'quoted text' && ${HOME}
+--verbose test cd echo | grep "$1" export ${HOME} 'quoted text'
+$(pwd) ${HOME} | ${HOME} "$1" then printf | sed $(pwd) echo $(pwd) printf -eu
+cd done | "$@" -eu /usr/bin 'quoted text' -eu x=1 local sed printf test "$1"
+	awk cd export ${HOME} --verbose &&
+		done | /usr/bin $(pwd) then x=1 done sed --verbose x=1
+	cd awk awk export -eu "$@" printf done local
+"$@" && /usr/bin then export x=1 cd /usr/bin export cd 2>/dev/null grep | --verbose
+${HOME} | sed grep then -eu | | then test && ${HOME}
+-eu export printf "$@" "$1" | /usr/bin $(pwd) "$@" export echo "$1" readonly
+		echo --verbose 2>/dev/null printf && done |
+		printf && awk -eu "$@"
+printf grep awk done awk printf x=1 cd done "$@" -eu done "$1" /usr/bin
+	then sed local test ${HOME} 'quoted text' /usr/bin x=1 /usr/bin
+"$1" local awk 2>/dev/null test ${HOME}
+		| test | echo x=1 $(pwd) cd printf | --verbose | grep "$@" "$1" && $(pwd) then
+		-eu sed printf export local then -eu awk
+		| "$1" 'quoted text' --verbose $(pwd)
+	echo grep 'quoted text' ${HOME} done printf grep
+		/usr/bin && local ${HOME}
+	/usr/bin done echo sed "$@" 2>/dev/null 'quoted text' 'quoted text' echo
+then local echo && "$1" sed export ${HOME} ${HOME} | sed "$1" -eu done --verbose
+	test ${HOME} -eu local echo && "$1" then test
+		"$@" readonly "$@" sed /usr/bin -eu test 'quoted text' "$@" "$@"
+echo ${HOME} sed x=1 x=1 -eu --verbose --verbose local ${HOME}
+-eu echo awk "$1" printf && && 'quoted text' then echo export cd then
+--verbose --verbose then printf
+	readonly export && cd /usr/bin x=1 sed 'quoted text' then cd | printf test
+	x=1 printf 2>/dev/null test grep grep 'quoted text' grep
+/usr/bin echo "$@" | 2>/dev/null
+	done done printf local "$@" readonly grep then echo | test grep printf
+	awk test 'quoted text' export && grep 2>/dev/null test grep --verbose grep 'quoted text'
+	done && sed awk sed grep cd test "$@" grep test cd local printf 'quoted text'
+	"$1" printf export 'quoted text' $(pwd) echo awk
+		"$1" /usr/bin sed "$1" local
+		&& printf readonly echo ${HOME} test awk
+		test export local ${HOME} --verbose cd "$1" "$1" x=1 --verbose
+	"$@" printf awk awk cd -eu local "$@" sed done awk "$1"
+	awk echo readonly local /usr/bin readonly "$@"
+cd $(pwd) x=1 test done "$1" local done then sed 2>/dev/null "$1"
+	$(pwd) -eu then then "$1" cd
+		'quoted text' echo /usr/bin echo $(pwd) --verbose --verbose sed sed awk cd echo
+sed /usr/bin done then $(pwd) grep ${HOME} ${HOME} readonly
+	--verbose "$@" && x=1 2>/dev/null
+		$(pwd) printf -eu 'quoted text' awk /usr/bin 'quoted text' printf 2>/dev/null
+		$(pwd) test && grep "$@" ${HOME} test printf export "$@" export echo && then done
+	-eu && 'quoted text' then done cd echo "$@" sed "$@" "$@"
+	$(pwd) local sed export readonly ${HOME} x=1 grep done sed awk | x=1 ${HOME} awk
+sed "$1" readonly "$@" printf grep x=1
+--verbose printf -eu x=1 cd printf "$@" done then done $(pwd)
+		done awk --verbose awk 'quoted text' -eu /usr/bin echo then awk
+	local sed export 2>/dev/null && then "$@" --verbose ${HOME} "$@" | then
+	local done ${HOME} $(pwd) printf awk -eu readonly grep
+	| readonly --verbose then then --verbose --verbose export -eu ${HOME}
+$(pwd) 'quoted text' 'quoted text' test -eu awk && export
+echo export printf x=1 ${HOME} export "$@" cd printf "$@" cd local --verbose
+/usr/bin x=1 export echo awk && then | local grep && ${HOME} done $(pwd)
+		printf -eu grep done /usr/bin cd "$1" export -eu 'quoted text' cd awk | -eu
+	${HOME} "$1" | then local sed && echo && cd && ${HOME} local && cd 2>/dev/null
+		2>/dev/null readonly readonly awk test sed
+sed printf "$@" export && 'quoted text' cd
+		done export x=1 --verbose
+		$(pwd) readonly done 'quoted text' test 2>/dev/null -eu
+		printf awk then awk x=1 done x=1 echo
+		2>/dev/null 'quoted text' | export "$1" -eu $(pwd) && /usr/bin | done --verbose
+awk -eu "$@" "$1" ${HOME} cd grep |
+printf printf sed readonly -eu cd "$1" grep cd done echo
+	done local readonly then x=1 grep
+/usr/bin x=1 $(pwd) "$@" --verbose
+export echo "$@" export --verbose -eu -eu 2>/dev/null
+	$(pwd) grep $(pwd) then grep | $(pwd) /usr/bin export
+	"$1" /usr/bin && export /usr/bin -eu "$1" done printf x=1 done "$1" readonly
+		"$1" "$1" 'quoted text' --verbose
+		'quoted text' local printf printf "$1" ${HOME}
+cd cd cd -eu && "$1" done 2>/dev/null
+	done $(pwd) 2>/dev/null "$@" x=1 cd | x=1 ${HOME}
+		export /usr/bin "$1" "$@" 2>/dev/null
+		grep ${HOME} sed "$@" --verbose | export printf test readonly 'quoted text'
+		test test "$1" ${HOME} cd "$1" "$@" test
+		x=1 "$@" 2>/dev/null && $(pwd) then ${HOME}
+	$(pwd) 'quoted text' ${HOME} awk ${HOME} x=1 -eu --verbose
+x=1 'quoted text' x=1 then test -eu x=1 then test "$1"
+2>/dev/null sed 2>/dev/null 2>/dev/null "$1" && grep export
+	grep grep /usr/bin ${HOME} --verbose -eu "$@" cd test $(pwd)
+	echo echo echo local printf ${HOME} && echo && sed
+	awk cd test export "$1" "$1" then cd grep readonly printf $(pwd)
+		readonly "$@" x=1 readonly 'quoted text'
+		echo printf 'quoted text' ${HOME} 2>/dev/null printf
+	then grep /usr/bin printf awk grep export export
+	| $(pwd) -eu local local
+		'quoted text' done $(pwd) ${HOME} 'quoted text' awk --verbose /usr/bin echo
+	done 'quoted text' echo $(pwd) printf
+${HOME} 'quoted text' | /usr/bin test local local x=1 $(pwd) x=1 ${HOME} /usr/bin
+	printf 2>/dev/null grep test --verbose done printf | printf &&
+	x=1 grep grep echo | 'quoted text' "$1" | then cd cd done -eu x=1 readonly
+echo echo test grep "$@" "$@" "$1"
+	--verbose ${HOME} printf cd "$1" $(pwd) printf
+	grep 2>/dev/null "$1" grep ${HOME}
+sed && && export done -eu
+"$1" test | 'quoted text' 'quoted text'
+	"$@" --verbose export ${HOME} readonly x=1
+local sed "$1" 2>/dev/null test "$@" ${HOME} local --verbose echo test then sed
+	2>/dev/null test sed /usr/bin echo --verbose
+		"$@" "$1" test /usr/bin "$1" printf && | grep ${HOME} /usr/bin sed export
+	echo 'quoted text' /usr/bin && then
+		| $(pwd) local grep 2>/dev/null ${HOME} "$1" --verbose awk
+'quoted text' /usr/bin 2>/dev/null 'quoted text' grep printf
+		${HOME} -eu export x=1 $(pwd) printf "$1" then export grep
+	echo ${HOME} "$1" test sed x=1 ${HOME} && cd sed && "$@"
+	awk test 2>/dev/null grep readonly done 'quoted text'
+local awk | -eu /usr/bin -eu x=1
+	test -eu printf echo 2>/dev/null
+x=1 "$1" readonly && 'quoted text' printf printf -eu export "$@"
+		echo --verbose printf printf ${HOME} | awk
+export -eu done local printf 2>/dev/null local export x=1
+echo ${HOME} sed ${HOME} -eu readonly done then "$1" "$1" then
+"$@" done echo echo cd $(pwd) 'quoted text' -eu echo then readonly
+		&& -eu sed cd "$1" printf "$1" echo /usr/bin /usr/bin done -eu echo sed
+| printf test x=1 then && 'quoted text' echo export
+	"$1" 'quoted text' then ${HOME} 'quoted text' /usr/bin
+		-eu "$1" grep cd echo 'quoted text'
+| --verbose cd local "$@" && --verbose && "$@" export cd test grep -eu
+	local ${HOME} then 2>/dev/null local
+	local /usr/bin sed readonly 'quoted text'
+readonly readonly then 2>/dev/null sed
+awk "$@" then ${HOME} export local | --verbose then "$@" cd ${HOME} readonly
+		done awk local --verbose printf "$@" --verbose
+		done /usr/bin x=1 'quoted text' $(pwd) done x=1 cd sed grep
+then echo awk | local printf | -eu export
+	/usr/bin cd -eu 2>/dev/null | /usr/bin x=1 /usr/bin && echo printf cd | printf done
+	awk done | export done cd sed cd echo grep done -eu -eu --verbose
+readonly "$@" | awk /usr/bin && 2>/dev/null $(pwd) awk cd
+	-eu && 2>/dev/null $(pwd) awk $(pwd) done
+	echo ${HOME} "$1" cd then 2>/dev/null local
+	grep | ${HOME} export "$1" sed -eu 'quoted text'
+	done echo "$1" sed 2>/dev/null ${HOME} "$1"
+	export -eu && sed | awk x=1 "$@" awk --verbose sed sed export $(pwd)
+	"$1" done test --verbose $(pwd) ${HOME} export ${HOME} echo --verbose ${HOME}
+		grep echo "$@" export 'quoted text' sed echo test --verbose ${HOME} x=1 "$1"
+$(pwd) 'quoted text' local sed "$1" awk
+--verbose export then
+		x=1 cd local local /usr/bin test ${HOME} sed printf "$1" 'quoted text'
+	"$1" "$1" test readonly ${HOME}
+awk 2>/dev/null "$1" cd local grep echo "$1" done
+	'quoted text' printf | "$@"
+"$1" /usr/bin local "$@" cd && 'quoted text'
+		/usr/bin awk export echo grep /usr/bin export && --verbose "$@" && then /usr/bin
+		local /usr/bin cd --verbose readonly awk "$1" && ${HOME} $(pwd)
+		grep x=1 /usr/bin sed grep --verbose readonly "$@" grep
+		/usr/bin --verbose then && cd 'quoted text'
+	'quoted text' --verbose "$1" awk grep
+x=1 -eu readonly local x=1 awk --verbose done local
+		printf /usr/bin printf x=1 $(pwd) test
+		awk readonly "$@" "$@" done done /usr/bin $(pwd) cd then
+	printf "$@" && 2>/dev/null cd /usr/bin "$@" $(pwd) readonly
+	then local x=1 grep local
+	then then awk "$1" export 'quoted text' --verbose sed --verbose "$1" sed
+		grep "$@" test test ${HOME} export --verbose 'quoted text'
+	| $(pwd) ${HOME} grep 2>/dev/null
+		sed readonly done 'quoted text' /usr/bin echo
+		${HOME} test echo 'quoted text' grep local then ${HOME}
+		test ${HOME} 'quoted text' readonly ${HOME} test sed readonly
+	sed --verbose -eu ${HOME} x=1 local sed
+${HOME} test awk awk /usr/bin
+		x=1 'quoted text' $(pwd) --verbose ${HOME} $(pwd) && 2>/dev/null
+		sed printf done "$@" ${HOME} "$@" awk readonly echo /usr/bin cd 2>/dev/null
+	sed sed sed $(pwd) sed --verbose
+		&& 'quoted text' test awk | printf then "$1" cd echo sed
+	"$@" | grep printf echo $(pwd) echo sed printf printf
+	$(pwd) 2>/dev/null ${HOME} | cd cd done
+		$(pwd) | | then ${HOME} 2>/dev/null | then local grep grep sed echo /usr/bin then
+	"$@" | test --verbose export x=1 echo then && /usr/bin "$1" && --verbose
+	cd "$1" "$1" printf | awk readonly && printf
+		$(pwd) $(pwd) --verbose cd sed
+&& export ${HOME} sed "$@" awk done 'quoted text'
+	&& local "$@" cd echo grep $(pwd) cd --verbose 2>/dev/null "$@"
+echo /usr/bin local test export --verbose then cd printf
+	sed --verbose export
+&& cd $(pwd) awk readonly && readonly 2>/dev/null
+		$(pwd) "$@" local "$1" cd then --verbose x=1
+	&& cd 2>/dev/null x=1 echo "$@"
+		| awk then ${HOME} && export readonly ${HOME} x=1 "$@" $(pwd) ${HOME}
+	$(pwd) echo x=1 done 2>/dev/null -eu readonly
+then "$@" | sed awk readonly grep $(pwd) printf --verbose
+		local readonly done awk -eu echo printf printf 'quoted text'
+		${HOME} awk export --verbose done sed done
+		x=1 grep "$1" echo done test readonly | printf then -eu readonly readonly
+cd "$@" readonly then "$1" x=1 /usr/bin
+"$@" cd grep sed echo -eu grep $(pwd) local 2>/dev/null x=1
+'quoted text' "$1" readonly export echo | 'quoted text'
+		$(pwd) grep ${HOME} /usr/bin /usr/bin "$1" /usr/bin -eu
+	export awk | done $(pwd) "$@" "$1" then grep test awk 'quoted text'
+		"$1" awk test readonly then --verbose $(pwd) | test --verbose export
+grep echo done awk grep readonly
+	"$@" $(pwd) done sed | grep awk grep readonly sed done readonly 'quoted text'
+		echo --verbose awk "$1" grep local "$@" echo awk
+		cd /usr/bin ${HOME} printf awk 2>/dev/null
+		grep -eu -eu grep | $(pwd) "$1" test | cd grep grep grep 'quoted text'
+awk grep done ${HOME} done "$1" "$@" ${HOME}
+sed "$1" export "$1" -eu 'quoted text' test then "$1" --verbose /usr/bin
+	--verbose && "$1" cd local | echo awk "$@" readonly $(pwd) && printf
+		readonly -eu local | sed done readonly "$1" sed
+		| /usr/bin done /usr/bin 'quoted text' ${HOME} then awk local sed 'quoted text'
+		test | awk --verbose sed x=1 ${HOME} $(pwd) "$1" "$@" printf
+		x=1 x=1 $(pwd) 2>/dev/null && grep cd && grep 'quoted text'
+x=1 printf ${HOME} -eu
+	cd /usr/bin test awk "$@" echo done local x=1 awk then done grep
+--verbose local | $(pwd) 'quoted text' then done echo cd --verbose 2>/dev/null
+printf sed && done printf "$1"
+grep echo sed "$1" grep printf export awk "$@" export | "$@" echo printf readonly
+	done "$@" "$1" "$@" cd then
+		2>/dev/null test awk $(pwd) -eu | 'quoted text' --verbose /usr/bin awk printf
+		awk | "$1" echo ${HOME} echo "$1" ${HOME}
+	'quoted text' | cd grep /usr/bin
+sed printf cd /usr/bin -eu echo local readonly "$1" readonly
+	/usr/bin done | readonly awk && ${HOME} "$@" 'quoted text' sed grep
+readonly $(pwd) --verbose /usr/bin | echo "$1" local
+		printf -eu --verbose "$1" "$@" printf 'quoted text' 2>/dev/null
+		$(pwd) awk done done sed --verbose -eu sed x=1 | --verbose --verbose
+	export sed 2>/dev/null
+		local export grep 2>/dev/null test &&
+	cd "$1" grep grep done readonly 2>/dev/null local /usr/bin local $(pwd)
+		--verbose 'quoted text' "$@" printf 2>/dev/null 'quoted text'
+		sed | -eu then | 'quoted text' x=1 ${HOME} local printf
+		sed test $(pwd) test done
+	grep export echo $(pwd) echo --verbose
+	/usr/bin printf "$1" grep ${HOME} "$@" "$1" then cd
+sed x=1 local echo --verbose "$1" printf grep awk $(pwd) --verbose echo -eu /usr/bin
+		&& 'quoted text' ${HOME} $(pwd) echo 2>/dev/null local "$@" --verbose
+		awk echo --verbose then then
+		2>/dev/null --verbose then test grep | "$1" ${HOME} grep test readonly
+x=1 ${HOME} awk "$1" awk then test printf "$1" local done "$@" x=1 grep
+		--verbose "$@" readonly --verbose awk sed | readonly
+cd 2>/dev/null printf "$@" local x=1 -eu /usr/bin x=1 ${HOME}
+echo echo --verbose then ${HOME} | then -eu
+	printf test then awk awk "$1" -eu awk export "$1" printf -eu done done grep
+		done --verbose x=1 x=1 awk -eu "$@" done done
+		-eu "$1" readonly $(pwd) local 'quoted text'
+| 2>/dev/null --verbose sed readonly 'quoted text' | printf
+'quoted text' done done --verbose awk | then | cd -eu
+"$@" grep --verbose 2>/dev/null x=1 /usr/bin
+	test "$@" | sed -eu --verbose 'quoted text'
+		"$1" /usr/bin 2>/dev/null 'quoted text' x=1 export && "$@" cd 2>/dev/null done
+local local echo cd then sed | local ${HOME} && 2>/dev/null | test printf
+"$@" done export --verbose echo
+awk readonly -eu | echo && x=1 export
+		grep x=1 'quoted text' awk export test | done export "$1"
+		export awk -eu 2>/dev/null readonly --verbose
+	'quoted text' 'quoted text' --verbose readonly --verbose export readonly
+	export then cd 'quoted text' -eu x=1 $(pwd) "$1" "$@" done awk
+"$1" local printf 2>/dev/null echo ${HOME} grep local
+| --verbose && sed && "$1" "$1" awk test ${HOME} 2>/dev/null && /usr/bin grep
+		test export "$1" awk 2>/dev/null printf local $(pwd)
+		then sed 'quoted text'
+	$(pwd) x=1 -eu "$@" ${HOME} x=1 test printf 2>/dev/null "$@" done -eu
+export local test -eu printf "$1"
+		| local then 'quoted text' --verbose echo awk printf echo
+		sed done "$1" done printf "$1" echo then export grep && local
+		-eu && "$@" then awk sed then readonly
+		x=1 awk ${HOME} export $(pwd) "$1" && test 2>/dev/null
+local 2>/dev/null then
+	sed -eu then 2>/dev/null printf
+2>/dev/null echo && echo readonly
+		${HOME} "$1" && && echo test -eu then echo echo test 2>/dev/null
+		printf $(pwd) grep /usr/bin
+		local printf printf 2>/dev/null -eu 2>/dev/null 'quoted text'
+export awk sed awk "$1" grep && --verbose --verbose sed echo done /usr/bin
+		then printf | ${HOME} && test grep local
+	readonly $(pwd) local local grep export test printf 2>/dev/null local --verbose
+	then local readonly readonly "$1" ${HOME}
+	-eu export && 2>/dev/null sed grep printf readonly 'quoted text'
+		$(pwd) && echo awk | x=1 x=1 && 2>/dev/null test sed -eu local "$1" --verbose
+		/usr/bin sed grep export && done done
+		x=1 x=1 ${HOME} 2>/dev/null ${HOME} export sed test
+2>/dev/null x=1 x=1 && 'quoted text' | | test 2>/dev/null readonly echo |
+		test echo "$1" local printf 'quoted text' export && grep --verbose --verbose test
+$(pwd) done test -eu 2>/dev/null
+	--verbose echo printf -eu && --verbose grep echo ${HOME} test x=1 -eu
+then 'quoted text' echo | awk 2>/dev/null then 2>/dev/null
+	"$1" ${HOME} done awk test then $(pwd) test cd
+		${HOME} readonly 'quoted text' printf done -eu "$1" done
+done echo echo awk printf "$1" printf ${HOME} awk $(pwd) && awk echo /usr/bin
+		cd --verbose "$1" readonly --verbose
+local -eu --verbose cd $(pwd) "$1"
+	'quoted text' ${HOME} "$@" awk 2>/dev/null --verbose 'quoted text'
+readonly done $(pwd) && then export printf
+	/usr/bin echo grep --verbose printf grep then ${HOME} ${HOME} ${HOME}
+		sed $(pwd) done then -eu && x=1 cd grep
+2>/dev/null 'quoted text' 'quoted text' export
+local sed | printf printf printf local && sed ${HOME} sed | -eu
+	x=1 test ${HOME} | "$@" 'quoted text' cd echo $(pwd) done sed --verbose awk
+done "$1" grep test "$1" $(pwd) readonly | x=1 'quoted text' sed
+		awk done "$@" printf ${HOME} ${HOME} /usr/bin 'quoted text' sed
+2>/dev/null /usr/bin awk test sed | sed export then test && then /usr/bin "$1"
+		x=1 "$1" 2>/dev/null "$1" cd $(pwd) local "$1" && 'quoted text'
+	echo sed "$@" "$@" | -eu test cd printf sed printf cd | --verbose readonly
+	-eu x=1 grep --verbose "$1" done export awk grep awk local cd export done done
+		/usr/bin $(pwd) 2>/dev/null -eu /usr/bin
+	${HOME} awk readonly readonly printf
+		${HOME} "$1" awk "$@" grep printf readonly test printf
+x=1 && grep "$@" | | ${HOME}
+	x=1 test echo awk ${HOME}
+		test | readonly "$1" cd grep ${HOME} 'quoted text'
+	cd 2>/dev/null done $(pwd) readonly awk export /usr/bin done "$1"
+	grep echo "$@" test --verbose test "$@" 'quoted text'
+		${HOME} printf done --verbose "$1"
+		2>/dev/null sed readonly
+	${HOME} "$@" /usr/bin printf "$@" done "$@" 2>/dev/null "$@" awk
+	| cd grep awk 2>/dev/null sed $(pwd) readonly export 'quoted text' echo -eu x=1
+done local awk x=1 $(pwd) "$1" cd 2>/dev/null 2>/dev/null test
+${HOME} | "$@" && --verbose | $(pwd) cd grep cd -eu $(pwd)
+		awk /usr/bin readonly -eu export awk sed 2>/dev/null awk -eu 2>/dev/null
+		| && /usr/bin grep export
+	done cd printf && 'quoted text'
+		2>/dev/null x=1 ${HOME} /usr/bin "$@" --verbose ${HOME} /usr/bin
+2>/dev/null && readonly && test cd done awk sed "$@" sed
+--verbose -eu ${HOME} done printf
+	done && awk echo $(pwd) "$@" $(pwd)
+	cd "$1" 'quoted text' -eu --verbose echo $(pwd)
+| export -eu "$@" $(pwd) ${HOME} cd x=1 2>/dev/null
+	'quoted text' test echo printf awk --verbose x=1 local export && 'quoted text'
+		"$@" /usr/bin echo x=1 cd ${HOME} ${HOME} "$@" "$@" echo local && then test
+x=1 $(pwd) readonly /usr/bin cd grep readonly -eu sed
+	--verbose then readonly
+	readonly "$@" -eu "$1" ${HOME} && ${HOME}
+		sed test awk export then -eu /usr/bin | export
+	/usr/bin 2>/dev/null && readonly ${HOME} awk /usr/bin "$@"
+2>/dev/null test "$1" printf awk readonly && awk echo
+		x=1 test /usr/bin then $(pwd)
+	-eu export $(pwd) then --verbose
+	local && test test export "$1" sed | -eu x=1
+	| printf && && sed 2>/dev/null local awk $(pwd) export done sed local --verbose
+		grep echo 2>/dev/null 2>/dev/null sed "$1" x=1 'quoted text'
+| $(pwd) | done /usr/bin x=1 "$1" 'quoted text' "$@" cd sed local
+$(pwd) sed --verbose printf 'quoted text' then ${HOME} -eu readonly "$@" echo
+cd readonly cd 2>/dev/null
+&& 2>/dev/null local 'quoted text' done done "$@" 2>/dev/null
+		'quoted text' 'quoted text' --verbose --verbose
+${HOME} /usr/bin done /usr/bin done
+		local readonly echo cd local x=1 local
+		sed 'quoted text' "$@" export -eu
+		test local awk ${HOME} echo export 2>/dev/null
+	grep grep export printf "$@" -eu echo && x=1 -eu
+"$@" && then local readonly cd done /usr/bin 2>/dev/null ${HOME}
+$(pwd) cd "$@" $(pwd) echo printf 'quoted text'
+	${HOME} then ${HOME} test cd x=1 x=1 then echo sed x=1 sed printf /usr/bin
+x=1 x=1 -eu 'quoted text' ${HOME} -eu -eu cd 2>/dev/null -eu 'quoted text' done
+		local "$1" 'quoted text' local printf
+	"$1" readonly "$1" "$@" "$@" "$1" printf export x=1 /usr/bin x=1 echo
+grep then "$1" -eu awk /usr/bin
+		"$1" then printf awk && cd "$1" 'quoted text' readonly 'quoted text'
+		awk sed x=1 echo "$1" 'quoted text' done sed awk && printf
+		sed sed "$@" x=1 local -eu sed | /usr/bin
+		done echo "$1" "$@" grep 'quoted text' 2>/dev/null 'quoted text' x=1 echo
+$(pwd) done sed "$@" | && -eu 2>/dev/null
+	"$@" x=1 readonly $(pwd) grep
+	2>/dev/null export awk done export printf local printf -eu test export
+	printf echo echo sed 'quoted text'
+	&& "$@" $(pwd) | local awk x=1 printf
+	sed 'quoted text' printf ${HOME} |
+		test done readonly "$1" -eu && | export export
+	awk local cd grep printf --verbose
+		then local local awk /usr/bin 2>/dev/null test readonly sed /usr/bin --verbose
+export ${HOME} /usr/bin 'quoted text' test | then echo /usr/bin --verbose
+		grep test 'quoted text' -eu --verbose "$@" readonly then
+	cd "$@" | && 'quoted text' done "$@" awk x=1 printf cd --verbose | |
+| | /usr/bin "$@" /usr/bin x=1 | then grep "$1" ${HOME} sed echo test grep -eu echo
+echo 2>/dev/null | echo sed printf "$1"
+export ${HOME} printf --verbose && sed "$1" export sed 'quoted text'
+export $(pwd) /usr/bin "$1" export
+--verbose cd local export cd /usr/bin "$1" sed -eu local
+cd ${HOME} "$@" && | "$@"
+	${HOME} "$@" | | done sed 2>/dev/null then $(pwd)
+	| "$@" echo && cd export sed readonly "$1" x=1 2>/dev/null
+	echo --verbose ${HOME} printf test "$@" "$1"
+		-eu cd x=1 cd echo grep /usr/bin
+awk local /usr/bin grep echo export /usr/bin
+readonly && then 'quoted text' "$1" 2>/dev/null 'quoted text' local "$1"
+		sed then sed $(pwd) x=1 'quoted text' grep /usr/bin
+sed then readonly printf grep test test grep 2>/dev/null printf
+local then then "$1" -eu 2>/dev/null grep printf printf done printf $(pwd)
+--verbose "$1" done test export test ${HOME} "$1" echo readonly
+&& readonly cd cd done done --verbose 'quoted text' -eu ${HOME}
+| test cd printf sed "$1" echo /usr/bin test sed export &&
+	&& local /usr/bin then
+	-eu x=1 -eu 'quoted text' test awk "$@" 2>/dev/null
+2>/dev/null grep printf && x=1
+	/usr/bin /usr/bin "$@" && awk then x=1 2>/dev/null export
+		$(pwd) echo -eu local local -eu "$1" $(pwd) ${HOME} 2>/dev/null readonly ${HOME}
+"$1" | local test 'quoted text' echo readonly 2>/dev/null
+	local --verbose sed test x=1 x=1 done cd "$@" $(pwd)
+done $(pwd) done echo 2>/dev/null $(pwd) sed grep local | $(pwd) printf
+"$1" 2>/dev/null local printf && "$@" grep /usr/bin x=1 "$1" --verbose test
+echo /usr/bin then && test "$1" sed && -eu printf local $(pwd) ${HOME} $(pwd) ${HOME}
+		sed cd awk 2>/dev/null --verbose test --verbose "$@"
+		readonly printf awk ${HOME}
+		2>/dev/null | 'quoted text' 'quoted text'
+	&& && cd x=1 "$1" readonly -eu 2>/dev/null
+	echo printf printf 'quoted text' printf then "$@" 'quoted text'
+	done && awk grep echo printf 'quoted text' awk x=1 $(pwd) --verbose
+x=1 2>/dev/null 'quoted text' readonly test --verbose
+export test then cd $(pwd) && -eu
+		local --verbose /usr/bin awk "$1" 'quoted text'
+	test sed 2>/dev/null /usr/bin
+printf $(pwd) local | 2>/dev/null grep printf | then sed | -eu ${HOME} sed "$1"
+	printf $(pwd) 'quoted text' 'quoted text'
+		${HOME} done | sed printf then cd "$@" readonly $(pwd) &&
+	2>/dev/null export | export cd "$@" grep "$1"
+	/usr/bin --verbose then -eu printf sed awk then awk
+cd readonly && local && grep 2>/dev/null grep export -eu awk 2>/dev/null
+	x=1 export sed ${HOME} 2>/dev/null then sed 2>/dev/null
+/usr/bin --verbose x=1 ${HOME} cd "$@" awk
+	printf | ${HOME} echo local printf local test
+sed /usr/bin cd sed cd && && test $(pwd) "$1" --verbose
+		test export "$1" /usr/bin then test
+readonly printf printf
+	-eu && && local local "$@"
+awk "$@" done ${HOME} 'quoted text' echo done $(pwd) sed
+		$(pwd) export readonly ${HOME} local | export export "$1" $(pwd) -eu done
+		cd readonly x=1 'quoted text' && "$1" $(pwd) 2>/dev/null awk
+x=1 echo test x=1 test 2>/dev/null "$1"
+		test 'quoted text' "$1"
+grep cd 2>/dev/null ${HOME} test -eu export readonly
+		$(pwd) /usr/bin done echo -eu --verbose --verbose ${HOME} 'quoted text'
+	x=1 echo | echo | /usr/bin cd /usr/bin x=1 awk && $(pwd) /usr/bin $(pwd)
+	"$@" done grep cd | local export echo printf
+	${HOME} && local readonly /usr/bin local printf | ${HOME}
+		/usr/bin export local test awk ${HOME} | --verbose
+export printf x=1 printf | "$1" 2>/dev/null export awk --verbose "$1"
+		--verbose | printf printf $(pwd) echo 2>/dev/null && printf cd
+grep --verbose /usr/bin printf 2>/dev/null /usr/bin
+		test then "$@" cd 2>/dev/null && printf ${HOME} echo -eu $(pwd) test echo
+		-eu cd ${HOME} x=1 --verbose "$1"
+	${HOME} ${HOME} | "$@" $(pwd) "$1" $(pwd) test "$1" done "$@" then grep done
+	export x=1 cd test "$@" $(pwd) 'quoted text' --verbose
+		echo grep local test --verbose
+	export then readonly awk | done export $(pwd) 2>/dev/null export grep done && echo
+	x=1 then then test export | 'quoted text' $(pwd) --verbose x=1
+done test sed ${HOME}
+		--verbose sed --verbose && echo 'quoted text' $(pwd) $(pwd) done readonly done
+		printf /usr/bin 2>/dev/null done grep
+	| awk test sed grep -eu test echo $(pwd) awk grep 'quoted text'
+readonly && /usr/bin test ${HOME}
+	&& echo | then "$1" 2>/dev/null $(pwd) x=1 x=1 --verbose x=1 test readonly
+		echo -eu cd export "$1" $(pwd) x=1 readonly sed -eu sed 2>/dev/null
+		2>/dev/null && grep ${HOME}
+		local awk -eu grep echo "$@"
+&& cd grep test export && sed
+		then printf ${HOME} 2>/dev/null "$1"
+echo grep "$@" 2>/dev/null sed local readonly export 'quoted text' readonly
+	sed printf && && 'quoted text' echo ${HOME} cd "$1" local
+printf 2>/dev/null | "$@" awk
+		awk grep ${HOME} readonly 'quoted text'
+done --verbose readonly "$@" sed -eu echo --verbose cd $(pwd)
+		local echo 2>/dev/null ${HOME} 2>/dev/null -eu done x=1 'quoted text'
+		done done sed ${HOME} cd | export -eu sed && -eu 2>/dev/null
+	echo 'quoted text' --verbose 2>/dev/null cd && "$1" "$1" /usr/bin
+	2>/dev/null grep "$@" 'quoted text'
+		test readonly printf readonly "$1" --verbose export --verbose sed cd echo
+	awk --verbose export cd | awk && x=1 done readonly /usr/bin -eu "$@" echo then
+	awk --verbose grep $(pwd) --verbose printf then &&
+	$(pwd) -eu "$1" $(pwd) printf
+	"$@" printf ${HOME} readonly && readonly "$1" grep sed
+		$(pwd) sed | && -eu | ${HOME} printf echo sed test grep local --verbose done
+		grep | --verbose 2>/dev/null readonly ${HOME} | echo local /usr/bin readonly
+	${HOME} grep export readonly | grep export && then | local
+		then export "$1" 2>/dev/null 2>/dev/null export
+		$(pwd) "$1" done /usr/bin $(pwd) echo "$@" then "$1" local
+		cd local /usr/bin grep
+printf printf cd done readonly local awk local --verbose printf --verbose test
+		&& $(pwd) ${HOME} ${HOME} | then readonly sed printf && sed
+	export ${HOME} printf --verbose grep 2>/dev/null "$1" cd $(pwd) grep readonly
+$(pwd) && | --verbose grep /usr/bin
+		cd export $(pwd) printf --verbose test "$1"
+		then ${HOME} awk printf printf
+	"$@" local readonly cd then echo export local --verbose
+	2>/dev/null done ${HOME} ${HOME} echo --verbose
+"$@" -eu cd /usr/bin --verbose readonly
+	export x=1 'quoted text' "$1" printf sed test local | then
+		--verbose printf done && echo ${HOME}
+"$1" local cd export local test sed printf
+	--verbose 'quoted text' ${HOME} $(pwd) cd done --verbose local grep -eu
+	2>/dev/null local local then test then -eu /usr/bin readonly
+readonly | "$@" local --verbose awk | printf --verbose /usr/bin
+	$(pwd) then then 'quoted text'
+	x=1 awk /usr/bin echo 'quoted text' -eu ${HOME}
+		${HOME} local $(pwd) 2>/dev/null 2>/dev/null $(pwd) test readonly local 'quoted text'
+		2>/dev/null grep /usr/bin done sed 'quoted text'
+		| ${HOME} -eu -eu && $(pwd)
+		"$1" 'quoted text' local && "$1" sed echo "$1" echo
+	x=1 local "$@" 2>/dev/null local test printf done $(pwd) 2>/dev/null
+		echo /usr/bin | then /usr/bin export -eu x=1 local -eu readonly
+	done grep printf awk ${HOME} cd ${HOME} readonly
+		"$@" ${HOME} cd readonly readonly echo 2>/dev/null
+		'quoted text' 2>/dev/null 2>/dev/null awk test awk cd "$@" then && ${HOME}
+	cd -eu export && -eu && test sed --verbose
+export cd "$@" "$1" && && echo test cd then export done "$1" x=1 $(pwd)
+x=1 /usr/bin export -eu sed export
+		awk then 'quoted text' then -eu /usr/bin grep then awk then
+${HOME} -eu 2>/dev/null awk printf -eu
+export sed then test test && awk export
+		'quoted text' "$@" $(pwd) 2>/dev/null readonly 2>/dev/null
+cd done "$@" readonly 'quoted text' awk
+${HOME} cd | ${HOME} 'quoted text' echo local awk && -eu ${HOME}
+		printf -eu done -eu then echo
+x=1 readonly sed grep test $(pwd) ${HOME} awk cd echo
+done test local test echo readonly -eu -eu x=1 awk -eu readonly
+	readonly /usr/bin -eu echo && 'quoted text'
+	2>/dev/null readonly 2>/dev/null done | | cd then --verbose export &&
+		export cd 2>/dev/null sed awk -eu ${HOME} cd then --verbose -eu
+${HOME} done done done
+		2>/dev/null sed -eu then awk then readonly sed 2>/dev/null
+	-eu ${HOME} /usr/bin x=1 echo | export | local "$1" test readonly "$1"
+${HOME} done test ${HOME} grep ${HOME} echo readonly
+	readonly echo "$@" printf echo printf
+		x=1 | | -eu "$1" x=1 && && 'quoted text'
+	local sed | && 'quoted text' awk
+	echo sed x=1 cd ${HOME} awk export cd test | local ${HOME}
+x=1 2>/dev/null ${HOME} "$1" 2>/dev/null /usr/bin -eu local
+$(pwd) ${HOME} printf -eu x=1 sed local $(pwd) export 2>/dev/null ${HOME}
+		"$1" && sed sed -eu x=1 test 'quoted text' ${HOME} done -eu /usr/bin then
+	/usr/bin /usr/bin | && && awk echo local
+		done sed 'quoted text' then done /usr/bin
+		printf ${HOME} done x=1 export done sed then x=1 sed ${HOME} cd 2>/dev/null
+		| -eu "$@" x=1 then "$1"
+local 2>/dev/null then local export 'quoted text' "$@"
+	local test /usr/bin local done ${HOME} && awk test -eu | -eu
+		${HOME} ${HOME} $(pwd) "$1" awk export "$@" ${HOME}
+		"$@" echo 'quoted text' printf sed
+		sed grep 'quoted text' awk $(pwd) "$1" readonly then test
+awk sed local $(pwd) | printf grep
+sed $(pwd) | $(pwd) done sed --verbose 2>/dev/null
+		cd readonly local /usr/bin && cd sed test && x=1 done /usr/bin /usr/bin &&
+		cd $(pwd) done | cd echo "$@" export ${HOME}
+	awk echo 2>/dev/null --verbose cd "$@" printf
+		"$@" test $(pwd) x=1 -eu ${HOME} | awk /usr/bin x=1 "$1" 'quoted text' "$@"
+| cd "$1" 2>/dev/null --verbose "$1" echo cd 'quoted text' sed echo &&
+		sed -eu -eu --verbose
+		${HOME} grep | "$1" 2>/dev/null "$1" done
+/usr/bin grep 'quoted text' done test then /usr/bin readonly printf $(pwd) "$@"
+&& echo && sed | printf local export x=1 echo echo /usr/bin echo 'quoted text'
+	grep /usr/bin test grep export /usr/bin
+	2>/dev/null sed echo awk echo --verbose readonly grep echo printf 'quoted text'
+"$1" x=1 awk -eu done test ${HOME} done grep export then
+"$1" local "$1" sed --verbose
+		local ${HOME} "$@" x=1 $(pwd)
+	awk echo awk 'quoted text' cd -eu then local 'quoted text' -eu
+	-eu local done then readonly 2>/dev/null echo test $(pwd) awk local cd -eu
+	--verbose | /usr/bin sed export 2>/dev/null
+	cd test "$1" test done x=1 echo x=1 export
+	echo | awk ${HOME} awk "$1" done | $(pwd) then -eu readonly cd
+		x=1 awk printf x=1 /usr/bin
+	awk readonly "$1" x=1 done
+--verbose "$@" /usr/bin
+${HOME} readonly echo export ${HOME} /usr/bin -eu export -eu export
+then then $(pwd) --verbose then readonly ${HOME} cd && /usr/bin
+test 'quoted text' 'quoted text' --verbose
+	2>/dev/null /usr/bin then "$@" ${HOME} /usr/bin
+		--verbose -eu && cd then "$@" && readonly "$@" "$@" readonly then $(pwd) then
+		2>/dev/null | && 2>/dev/null awk | "$@"
+		cd && x=1 && && 2>/dev/null printf echo ${HOME} test /usr/bin
+	&& "$@" --verbose echo awk local local export 'quoted text' "$1" export printf
+	sed x=1 grep --verbose $(pwd) readonly echo cd readonly
+	$(pwd) export echo --verbose | test --verbose cd readonly
+	printf sed --verbose export "$@" local echo done test test then export
+"$@" done local x=1 printf x=1 printf
+		sed done -eu cd ${HOME} test && ${HOME} $(pwd) 'quoted text' ${HOME} awk ${HOME}
+sed then then awk /usr/bin "$@" local done printf local -eu then echo done printf
+| 'quoted text' printf echo x=1 sed && && 2>/dev/null done local local $(pwd)
+	local then sed 2>/dev/null then grep "$1" 'quoted text' local ${HOME}
+	"$1" cd awk 'quoted text'
+&& /usr/bin printf echo 'quoted text' grep | then grep "$1" grep $(pwd) 2>/dev/null
+"$@" sed 'quoted text' awk x=1 printf local echo echo awk awk
+readonly x=1 x=1 x=1 local x=1 x=1 | test grep done --verbose
+		'quoted text' grep "$1" readonly 2>/dev/null ${HOME}
+	x=1 $(pwd) grep 'quoted text' "$1" $(pwd) then export
+	"$@" /usr/bin ${HOME} grep
+export cd ${HOME} export && 'quoted text'
+	grep readonly readonly readonly "$1" $(pwd) "$@" grep grep "$1" "$@" test
+2>/dev/null 2>/dev/null --verbose
+		-eu "$@" readonly "$1" echo printf printf sed export $(pwd) 2>/dev/null
+		readonly "$@" $(pwd) /usr/bin x=1 export done echo x=1 "$1" cd cd grep
+x=1 sed /usr/bin printf local 2>/dev/null
+${HOME} done printf done x=1 "$1" then done done awk "$@" | 'quoted text' /usr/bin
+	done -eu "$1" && then sed && local ${HOME} awk "$@" x=1 /usr/bin then 'quoted text'
+	done --verbose local sed test local 'quoted text' awk
+	--verbose done $(pwd) && | | ${HOME} grep && x=1 cd --verbose export
+local ${HOME} x=1 export cd test | done export echo -eu 2>/dev/null
+		local "$1" cd export local printf
+echo && sed "$1" test ${HOME} --verbose && printf | -eu
+'quoted text' cd test export -eu
+printf awk 2>/dev/null local -eu x=1 | echo
+	then local grep done "$@" grep readonly export printf
+	--verbose readonly echo local | | sed
+		| "$@" awk x=1 -eu && -eu local cd then awk awk x=1
+	/usr/bin /usr/bin --verbose echo 2>/dev/null | local done "$1" export "$1" grep
+	awk cd echo 'quoted text' export | ${HOME} printf
+	cd --verbose grep 'quoted text'
+		grep sed --verbose 'quoted text' export
+x=1 x=1 readonly ${HOME} cd
+		&& done test && cd 'quoted text' 2>/dev/null readonly $(pwd) $(pwd) printf test
+#include c165.sh
+	cd sed done /usr/bin sed 2>/dev/null export /usr/bin test echo then "$1"
+	x=1 "$@" "$@" ${HOME} x=1 awk cd then $(pwd)
+		cd 2>/dev/null | export
+		grep awk && then local done /usr/bin && --verbose
+	cd cd awk 'quoted text' && done then then /usr/bin
+		x=1 "$@" done /usr/bin 2>/dev/null -eu --verbose
+		$(pwd) then 'quoted text' /usr/bin /usr/bin export done x=1 x=1 $(pwd)
+	| x=1 readonly awk local
+		/usr/bin awk ${HOME} "$@" ${HOME} local cd x=1 'quoted text' cd printf
+	test 'quoted text' done && echo export
+		${HOME} -eu --verbose cd -eu echo export then test "$@" done /usr/bin
+	-eu grep -eu test /usr/bin
+	2>/dev/null printf cd $(pwd) sed readonly
+&& test export ${HOME} test
+x=1 local cd /usr/bin $(pwd) grep "$@" "$1"
+	--verbose /usr/bin export -eu export 'quoted text' ${HOME} test -eu
+		$(pwd) | local sed ${HOME} -eu test "$1" test awk then -eu --verbose
+grep 'quoted text' cd grep -eu 2>/dev/null
+	--verbose $(pwd) -eu export && export export x=1 test
+	cd 'quoted text' grep echo local local && "$1" x=1 grep | then &&
+		'quoted text' then readonly printf
+		"$1" sed sed | export | then 'quoted text' awk x=1 --verbose
+sed awk grep cd cd "$1" local /usr/bin 2>/dev/null
+'quoted text' "$1" printf
+	2>/dev/null "$1" --verbose sed x=1 export grep "$1" -eu 'quoted text'
+"$1" export 'quoted text' x=1
+-eu grep test then && -eu "$@" ${HOME} awk awk readonly
+sed --verbose x=1 echo printf
+		printf local 2>/dev/null && 'quoted text'
+	x=1 awk export && local -eu && printf "$1"
+| cd awk cd ${HOME} cd awk sed -eu
+		grep readonly && echo && export "$1" 2>/dev/null sed
+export 2>/dev/null printf test grep cd
+	awk printf 'quoted text' test -eu grep ${HOME} -eu awk
+echo /usr/bin grep sed echo echo readonly /usr/bin -eu --verbose 2>/dev/null
+		2>/dev/null "$@" export local
+	&& done cd readonly readonly echo
+	2>/dev/null awk | x=1 /usr/bin then sed ${HOME} $(pwd)
+	printf "$@" $(pwd) awk "$@" then grep awk echo "$@" printf echo -eu
+	echo echo cd $(pwd) --verbose
+		readonly then export then ${HOME} done $(pwd) "$@"
+		echo test cd "$@" readonly "$1" --verbose
+	2>/dev/null "$1" && 'quoted text' export ${HOME} ${HOME} readonly --verbose
+local -eu done x=1 then grep local | /usr/bin --verbose export -eu readonly
+	${HOME} 2>/dev/null | sed x=1 readonly
+	sed --verbose /usr/bin sed -eu
+test export "$@" then 'quoted text' test 'quoted text' export
+local --verbose awk printf ${HOME} $(pwd) done grep done
+	then done echo done /usr/bin echo echo export $(pwd) /usr/bin 'quoted text'
+		--verbose export readonly /usr/bin && cd x=1 local test
+printf $(pwd) | 2>/dev/null
+printf "$1" sed x=1 cd then x=1 export export 2>/dev/null | 'quoted text'
+		x=1 readonly grep x=1 echo awk 'quoted text' --verbose "$@"
+		/usr/bin awk sed -eu --verbose 'quoted text' && "$@" /usr/bin test
+		readonly "$@" cd done test x=1 test printf 'quoted text'
+		awk $(pwd) printf grep echo
+/usr/bin cd cd test local cd test awk echo test printf "$1"
+	echo | readonly $(pwd) sed ${HOME} printf ${HOME} test -eu local "$@"
+		printf local awk test | 'quoted text'
+		| cd 'quoted text' test sed "$@" local cd 'quoted text' 2>/dev/null
+then echo "$1" 'quoted text' done
+		"$1" done "$1" sed export echo cd /usr/bin test sed "$@"
+		awk export cd -eu test test -eu cd
+local -eu printf readonly done --verbose readonly $(pwd) "$1" /usr/bin --verbose
+	${HOME} sed cd then $(pwd) | cd "$@" local then echo sed
+test 2>/dev/null $(pwd) 2>/dev/null $(pwd) "$@" /usr/bin then /usr/bin
+echo $(pwd) done cd local awk "$1" then then --verbose
+export "$1" cd export 2>/dev/null -eu "$1" echo
+	done --verbose echo export x=1 done local --verbose
+		sed grep -eu && grep $(pwd) x=1 then test then | local test && cd | ${HOME}
+--verbose x=1 "$@" export $(pwd) done && "$@" --verbose awk awk echo
+		done | export x=1 x=1 && done local done 2>/dev/null
+		printf sed readonly $(pwd) printf sed echo local 'quoted text' "$1"
+${HOME} awk done | readonly 2>/dev/null done && grep ${HOME} then "$1" local echo
+then test cd export | awk grep done x=1 &&
+	test ${HOME} x=1 local test -eu echo then done ${HOME} && then local done "$@"
+x=1 "$1" grep --verbose $(pwd) test export awk test "$1" 2>/dev/null
+done -eu --verbose -eu --verbose echo /usr/bin echo
+$(pwd) readonly export ${HOME} | cd then readonly
+		| | --verbose readonly $(pwd) --verbose
+	export then 'quoted text' awk $(pwd) --verbose | x=1 sed printf 2>/dev/null
+		sed local --verbose 2>/dev/null 'quoted text' /usr/bin sed
+	| 'quoted text' sed x=1
+		$(pwd) export sed echo --verbose 'quoted text' then export ${HOME} $(pwd) test
+	test grep awk cd "$@" 'quoted text'
+	local /usr/bin local "$@"
+	test "$1" awk $(pwd) 'quoted text' ${HOME}
+	sed readonly 2>/dev/null grep awk done 2>/dev/null
+/usr/bin --verbose export awk grep /usr/bin grep readonly echo ${HOME} grep
+export awk printf sed $(pwd) cd 'quoted text' 2>/dev/null | echo
+		$(pwd) grep sed 'quoted text' done then then
+x=1 --verbose then && then sed | 'quoted text' grep
+		test awk done grep grep then 2>/dev/null printf
+		cd "$@" "$1" x=1 'quoted text'
+		test test export -eu printf | ${HOME} grep 2>/dev/null
+	done 'quoted text' -eu ${HOME} $(pwd)
+	'quoted text' "$1" $(pwd) awk 'quoted text'
+		"$@" ${HOME} grep && local "$@" done sed 'quoted text' cd "$1" cd | $(pwd) /usr/bin
+&& 'quoted text' readonly
+		--verbose $(pwd) done grep --verbose
+	export | "$1" awk printf export
+export sed "$1" | -eu "$@" test readonly awk "$1"
+		local printf "$1" --verbose cd awk -eu
+		printf "$@" local /usr/bin awk
+	x=1 ${HOME} export | then "$1" ${HOME} x=1 done 2>/dev/null done /usr/bin "$@"
+printf sed done /usr/bin then 2>/dev/null
+		then --verbose readonly local
+		$(pwd) --verbose grep test "$1"
+${HOME} awk cd -eu awk "$1"
+		local --verbose --verbose
+		export 2>/dev/null then ${HOME} done cd sed 'quoted text' cd -eu
+done 'quoted text' then readonly -eu echo /usr/bin x=1 x=1 local then
+		| export done 'quoted text' --verbose 'quoted text'
+	/usr/bin "$@" readonly export --verbose printf "$1" ${HOME} printf then ${HOME}
+	-eu local awk | | | ${HOME} export readonly printf echo "$1" -eu sed awk cd local
+	sed sed x=1 export grep && printf export "$1"
+printf sed readonly echo awk
+	| grep 'quoted text' 'quoted text' test 'quoted text' awk cd
+	grep -eu export "$1" then 'quoted text' --verbose 'quoted text' --verbose
+		2>/dev/null 2>/dev/null | &&
+	-eu then && echo && done echo --verbose --verbose cd sed -eu x=1 echo
+export test readonly printf grep
+	x=1 readonly grep 2>/dev/null then "$@" && && grep awk printf
+printf local grep awk awk x=1 sed "$1" /usr/bin 2>/dev/null
+		$(pwd) printf grep sed 2>/dev/null awk x=1 cd grep sed printf
+	'quoted text' sed grep $(pwd) local export | /usr/bin local then x=1 readonly
+	x=1 "$@" sed readonly 'quoted text'
+test done readonly "$@" /usr/bin local printf && printf
+local done ${HOME} x=1 awk ${HOME} ${HOME} | ${HOME}
+$(pwd) -eu "$1" sed echo --verbose
+export "$1" -eu done then --verbose grep
+		then local local ${HOME} echo "$1"
+		x=1 --verbose --verbose
+${HOME} readonly export echo export | test 2>/dev/null 2>/dev/null
+	done readonly then /usr/bin grep | then local 'quoted text'
+		"$@" && --verbose "$1" | awk local then then test sed then
+		test 2>/dev/null export ${HOME} 2>/dev/null export && "$@" then sed
+	${HOME} /usr/bin cd grep done sed readonly /usr/bin local
+		${HOME} test && --verbose "$1" local then
+		then && "$@" ${HOME} grep ${HOME}
+		awk test printf readonly /usr/bin export printf 'quoted text' x=1 /usr/bin
+readonly $(pwd) "$1" done /usr/bin --verbose local ${HOME} 'quoted text' awk readonly
+		"$@" -eu awk -eu x=1 "$1" | awk printf 2>/dev/null test printf awk
+		$(pwd) ${HOME} "$@" --verbose /usr/bin x=1
+	done test && awk readonly sed
+		"$1" export 'quoted text' printf $(pwd) 2>/dev/null
+export && /usr/bin | printf
+		&& export "$1" -eu cd awk 'quoted text' --verbose printf "$1" cd sed sed
+		export -eu 2>/dev/null -eu
+	x=1 --verbose -eu && /usr/bin "$@" export
+&& 2>/dev/null printf $(pwd) test x=1 "$@" x=1 export done grep
+		2>/dev/null -eu $(pwd) "$@" grep export sed
+printf readonly sed 2>/dev/null $(pwd) "$1" /usr/bin x=1 printf
+		$(pwd) | && --verbose done echo 2>/dev/null grep local
+	&& done $(pwd) -eu | local cd $(pwd) "$@" done then local echo
+	done --verbose export done 'quoted text' /usr/bin && "$@"
+		then -eu then awk "$@" -eu sed cd test x=1 $(pwd) cd x=1 grep
+		"$1" cd sed "$1" cd && 2>/dev/null
+	2>/dev/null awk ${HOME} 'quoted text' && echo sed "$1"
+	export ${HOME} awk $(pwd) local | awk grep -eu echo printf export
+		echo test awk -eu "$1"
+| x=1 'quoted text' 2>/dev/null
+		&& local /usr/bin test "$1" local && ${HOME} printf --verbose
+		echo done ${HOME} local local -eu local
+cd done x=1 awk export cd /usr/bin --verbose
+echo readonly then /usr/bin grep sed cd /usr/bin
+'quoted text' done export export x=1 /usr/bin
+grep readonly export printf awk done
+"$1" sed readonly printf x=1 test
+		'quoted text' && "$1" awk test local ${HOME}
+		&& "$1" echo done echo "$@" export readonly
+		printf cd $(pwd) -eu ${HOME} /usr/bin local
+		'quoted text' $(pwd) ${HOME} "$1" ${HOME}
+local 'quoted text' export ${HOME} done | 2>/dev/null awk "$1" then test
+	test "$1" awk "$@" then export test printf cd grep | echo
+		/usr/bin export cd 'quoted text' "$@" export echo && --verbose cd then
+then 'quoted text' echo export local grep "$1" --verbose done local
+		awk done grep --verbose cd readonly readonly 'quoted text' printf | export echo
+		test grep "$1" export $(pwd) "$1"
+	-eu 2>/dev/null done grep awk -eu done local "$@"
+printf x=1 export local echo export
+readonly -eu cd readonly --verbose --verbose 2>/dev/null
+		export cd /usr/bin --verbose 2>/dev/null
+	--verbose x=1 "$1" 'quoted text'
+		| ${HOME} ${HOME} local x=1 "$@" then $(pwd) $(pwd)
+	2>/dev/null done -eu --verbose
+		-eu | sed export grep printf done test
+		'quoted text' cd echo 2>/dev/null 'quoted text' printf printf
+"$@" "$1" && --verbose "$1"
+then "$1" 2>/dev/null ${HOME}
+	${HOME} grep local x=1 export
+'quoted text' sed export done &&
+		&& /usr/bin /usr/bin readonly test echo $(pwd)
+--verbose local /usr/bin --verbose | export "$@" 'quoted text' then -eu
+	$(pwd) "$@" then $(pwd) then printf "$@" "$@" x=1 done ${HOME} x=1 done
+	sed awk awk awk | --verbose
+sed echo grep echo echo "$1" done /usr/bin -eu test "$1" echo awk sed $(pwd)
+sed cd x=1 "$1" ${HOME} then | "$1" test sed sed | awk grep x=1
+		/usr/bin grep local done sed x=1 local /usr/bin 'quoted text' readonly ${HOME}
+then $(pwd) readonly export export test then local 2>/dev/null 'quoted text'
+	sed $(pwd) echo /usr/bin --verbose /usr/bin local x=1 test echo &&
+		/usr/bin printf --verbose
+		'quoted text' --verbose then readonly printf 'quoted text' 2>/dev/null
+x=1 /usr/bin awk then /usr/bin 'quoted text'
+readonly done "$@" "$@" -eu $(pwd) done $(pwd) export sed done && -eu "$@" local
+/usr/bin export && x=1 cd test /usr/bin --verbose $(pwd) 2>/dev/null echo
+done "$@" "$1" 2>/dev/null then | --verbose && "$@" 2>/dev/null
+"$@" cd echo 2>/dev/null && --verbose "$@" --verbose | "$1" x=1 "$@"
+		$(pwd) "$1" readonly "$1"
+	&& done cd local $(pwd) awk awk test done readonly
+		sed test ${HOME} test "$1" "$1" test grep | done grep export local $(pwd)
+	2>/dev/null printf done | cd readonly readonly &&
+		grep 'quoted text' cd then sed sed then | -eu done
+	x=1 readonly "$@" test readonly awk /usr/bin
+	readonly sed then /usr/bin cd awk awk 'quoted text'
+		/usr/bin "$@" done x=1 "$@" cd -eu echo done "$1" $(pwd) awk x=1 x=1 test
+	$(pwd) 'quoted text' export readonly awk echo export sed 2>/dev/null -eu
+		x=1 "$1" ${HOME} "$@" 2>/dev/null local 'quoted text' local readonly
+$(pwd) grep $(pwd) --verbose $(pwd) $(pwd) awk 2>/dev/null | echo ${HOME} printf
+	2>/dev/null 2>/dev/null && sed printf sed readonly printf awk && 2>/dev/null
+	$(pwd) 2>/dev/null && "$@" cd
+	${HOME} x=1 | grep local "$1" done printf
+then 'quoted text' && --verbose /usr/bin 2>/dev/null sed local grep
+'quoted text' && /usr/bin 'quoted text'
+	-eu then then | -eu /usr/bin --verbose sed && export
+	${HOME} "$@" local sed cd echo $(pwd) ${HOME} | ${HOME} test x=1 printf
+sed && $(pwd) -eu x=1 /usr/bin readonly /usr/bin "$1" "$1" --verbose /usr/bin
+	/usr/bin "$@" readonly && 'quoted text' --verbose then done printf
+| 2>/dev/null 'quoted text' test 'quoted text' grep export export --verbose
+	grep grep && then export "$@" x=1 -eu sed 2>/dev/null
+		"$@" test grep $(pwd) "$1" grep readonly "$@" export
+		'quoted text' local printf
+		awk && "$@" awk x=1 2>/dev/null echo
+$(pwd) test done 2>/dev/null readonly done && | printf
+		awk "$1" readonly sed done echo local cd /usr/bin echo $(pwd)
+	-eu echo "$1" sed then then done --verbose test /usr/bin | $(pwd) awk
+	$(pwd) printf && ${HOME} awk 2>/dev/null
+cd then local 2>/dev/null awk local sed -eu | $(pwd) then 2>/dev/null $(pwd)
+		&& sed export done local test 2>/dev/null cd awk --verbose && grep
+	echo echo && done export then
+"$@" readonly echo /usr/bin readonly "$1" "$@" echo "$@"
+"$1" x=1 done then x=1 "$1" "$@" --verbose test "$1" && --verbose /usr/bin
+	&& test cd cd grep $(pwd) then
+echo "$1" ${HOME} sed | sed
+&& "$@" sed $(pwd) x=1 export | 'quoted text'
+	&& "$1" 2>/dev/null test &&
+	${HOME} export test --verbose | echo awk "$@" 2>/dev/null export
+		local sed "$1" "$@" "$@" "$1" sed ${HOME} readonly awk
+	grep printf "$@" 'quoted text' local then grep export readonly
+printf $(pwd) && -eu ${HOME} grep echo "$1" -eu $(pwd)
+		test export printf done test printf sed printf
+		2>/dev/null grep grep sed test 2>/dev/null
+test echo --verbose done test test echo cd $(pwd) cd "$@"
+then ${HOME} --verbose x=1 -eu echo "$1" then sed x=1 awk "$@" echo /usr/bin
+		echo local $(pwd) echo echo x=1 local 2>/dev/null
+done awk echo sed /usr/bin export local cd then /usr/bin $(pwd) test | readonly
+		echo export awk 'quoted text' $(pwd) /usr/bin && 'quoted text'
+test --verbose 'quoted text'
+		2>/dev/null "$1" --verbose 'quoted text' printf test awk --verbose 2>/dev/null
+		sed -eu $(pwd) test -eu awk readonly local
+		&& --verbose awk "$1" ${HOME} readonly | --verbose | grep
+	| -eu then ${HOME} --verbose test local && export grep
+		| readonly --verbose readonly x=1 ${HOME} printf awk ${HOME}
+test ${HOME} export export "$@" test $(pwd) | $(pwd) x=1 x=1 printf printf --verbose
+	test sed local $(pwd) ${HOME} local printf 2>/dev/null
+		&& printf sed /usr/bin awk then --verbose
+printf "$@" cd done grep grep x=1 local "$1" export local
+	'quoted text' export printf /usr/bin --verbose -eu grep 'quoted text'
+		/usr/bin done && then && echo
+cd /usr/bin readonly export local 2>/dev/null awk readonly local cd --verbose readonly
+"$@" then && 'quoted text' $(pwd) -eu "$1" -eu 2>/dev/null then readonly "$1" "$1"
+		echo 2>/dev/null 'quoted text' --verbose 'quoted text'
+		"$@" echo then test readonly
+	then /usr/bin ${HOME} "$1" 'quoted text' ${HOME} cd $(pwd) ${HOME} done awk
+	sed ${HOME} printf echo 'quoted text' /usr/bin
+		awk readonly printf $(pwd) "$1" sed test | export 2>/dev/null
+		"$1" sed "$1" /usr/bin
+x=1 sed then -eu export ${HOME} -eu x=1 printf && then --verbose | printf
+	"$1" export cd $(pwd) 'quoted text'
+	done readonly ${HOME}
+local --verbose x=1 $(pwd) printf --verbose readonly ${HOME} readonly x=1
+2>/dev/null local && "$1" ${HOME} cd --verbose grep /usr/bin
+export x=1 ${HOME} 'quoted text' readonly then awk ${HOME} 'quoted text'
+		then local "$@" | 2>/dev/null done then "$@" && sed $(pwd) "$@"
+		awk x=1 x=1 then printf ${HOME} /usr/bin then test sed "$1" 2>/dev/null
+	test grep readonly | 'quoted text' 'quoted text' "$@" --verbose readonly awk
+		"$1" "$@" readonly "$@" local export && then sed cd
+"$@" done export "$1" done readonly /usr/bin awk grep x=1 echo /usr/bin
+--verbose && local echo "$@" cd test x=1 echo done
+		| $(pwd) --verbose /usr/bin printf 2>/dev/null
+echo done grep echo 'quoted text' then printf -eu printf grep 2>/dev/null
+		export $(pwd) "$@" sed "$@" --verbose x=1 && printf local readonly then done --verbose
+	"$1" export printf printf local printf "$1" 'quoted text' awk export $(pwd) "$@"
+then done | done local "$@" --verbose "$@" then "$@" then done sed ${HOME}
+		x=1 $(pwd) printf cd grep export echo 'quoted text' x=1
+		$(pwd) ${HOME} ${HOME}
+		/usr/bin && ${HOME} 'quoted text' sed 'quoted text' && sed /usr/bin
+	-eu x=1 printf --verbose "$1" then cd "$1" export /usr/bin ${HOME}
+	echo done /usr/bin export "$@" grep awk cd done readonly then -eu
+	&& readonly 'quoted text'
+done grep x=1 then /usr/bin
+	awk grep --verbose "$@" awk echo done
+then $(pwd) echo $(pwd) "$@" | "$@" export --verbose
+/usr/bin echo 'quoted text' test | | 2>/dev/null then
+		| export $(pwd) ${HOME} --verbose --verbose
+	x=1 x=1 cd 'quoted text' && then --verbose export "$1" 'quoted text' "$1" 2>/dev/null
+x=1 -eu 'quoted text' export -eu then $(pwd)
+x=1 then sed readonly | ${HOME}
+	'quoted text' echo done grep --verbose cd
+	export | sed 2>/dev/null
+	readonly printf test printf export | export cd --verbose && cd export "$1" test
+		grep printf $(pwd) echo ${HOME} local x=1 local x=1 grep export
+/usr/bin printf awk "$1" done && x=1 ${HOME} && "$@" "$1" done readonly -eu printf
+$(pwd) cd 'quoted text' grep export done
+		2>/dev/null | && x=1 sed && test printf 2>/dev/null readonly
+awk --verbose ${HOME} ${HOME} test 2>/dev/null
+	&& grep local grep /usr/bin /usr/bin readonly | 2>/dev/null
+2>/dev/null 2>/dev/null printf ${HOME} $(pwd) | done ${HOME}
+then echo test -eu "$@" 2>/dev/null -eu x=1 local test grep grep -eu export $(pwd)
+${HOME} grep 2>/dev/null cd 2>/dev/null then cd done | /usr/bin readonly /usr/bin
+export cd export | export sed -eu $(pwd) local x=1 export $(pwd) ${HOME} 'quoted text'
+awk 2>/dev/null $(pwd) $(pwd) --verbose -eu
+	done cd grep grep $(pwd) local 2>/dev/null done ${HOME} "$@"
+	printf "$1" printf 2>/dev/null
+		sed readonly 2>/dev/null cd cd /usr/bin readonly
+		test done grep | then echo export | cd grep printf
+"$@" export | echo awk "$@"
+	${HOME} echo then echo test
+cd readonly sed grep done test
+		done grep local --verbose | readonly | "$1" x=1 done done awk
+	printf && readonly && /usr/bin
+		readonly | "$@" | --verbose && "$@" cd readonly /usr/bin
+	-eu readonly x=1 echo test /usr/bin 2>/dev/null
+		then "$1" | "$1" printf export && x=1 export export
+	--verbose grep printf 2>/dev/null printf $(pwd) then 2>/dev/null awk --verbose
+		$(pwd) echo local "$@" --verbose "$1" echo done test /usr/bin
+		${HOME} readonly "$1" 2>/dev/null awk
+	export "$@" 'quoted text' "$@" readonly
+	2>/dev/null readonly cd export then x=1
+		echo readonly printf x=1 'quoted text' -eu 'quoted text' export then -eu
+		x=1 export grep "$@" 'quoted text' sed /usr/bin ${HOME}
+		| x=1 x=1 test && && awk awk $(pwd)
+-eu && ${HOME} /usr/bin && 'quoted text' readonly --verbose -eu $(pwd) 2>/dev/null
+2>/dev/null sed local x=1 sed sed awk /usr/bin awk sed printf
+		/usr/bin --verbose echo export /usr/bin
+$(pwd) export --verbose done 2>/dev/null
+		test -eu ${HOME} test sed $(pwd) sed -eu done
+		grep 'quoted text' then "$1" x=1 -eu && done echo readonly then local then
+	2>/dev/null readonly awk echo done
+&& "$1" -eu 'quoted text' | printf 2>/dev/null
+		"$@" echo /usr/bin cd -eu cd readonly $(pwd) | 2>/dev/null sed
+		--verbose x=1 printf --verbose -eu /usr/bin --verbose -eu
+/usr/bin | echo ${HOME} test ${HOME} local export sed
+$(pwd) echo x=1 $(pwd) done sed 2>/dev/null local && echo
+		'quoted text' test x=1 done $(pwd) x=1 'quoted text' -eu -eu grep
+	--verbose awk 'quoted text'
+--verbose 'quoted text' cd && 'quoted text' sed "$1" sed grep ${HOME}
+	--verbose 'quoted text' printf "$1" ${HOME}
+	printf 'quoted text'
+		/usr/bin done | done 'quoted text'
+$(pwd) then "$1" --verbose && export
+/usr/bin readonly grep done
+$(pwd) "$1" x=1 test done $(pwd) $(pwd) 'quoted text'
+"$1" 2>/dev/null 'quoted text' local | local 'quoted text' done done
+		'quoted text' && && | 2>/dev/null x=1 readonly | x=1 --verbose then x=1
+	-eu x=1 export -eu local /usr/bin export
+"$1" echo 'quoted text' test
+		cd export echo export export done ${HOME} /usr/bin x=1 -eu local cd
+		2>/dev/null printf "$@" "$@" export export --verbose "$@"
+&& awk ${HOME} done -eu && test awk
+	printf done readonly export test echo then done 2>/dev/null readonly printf awk
+	-eu echo -eu 2>/dev/null x=1 then 'quoted text'
+		awk "$1" export test grep then sed --verbose -eu export
+echo grep sed | sed then export grep test x=1 local test printf
+		test cd | x=1 2>/dev/null cd echo /usr/bin
+		"$@" printf printf && local done
+		2>/dev/null sed x=1 export local done readonly awk
+readonly done $(pwd) then x=1
+export local | echo $(pwd) -eu echo local local grep
+		&& test x=1 sed local test --verbose | x=1 then
+&& $(pwd) 2>/dev/null readonly awk $(pwd) $(pwd) "$@" test
+	--verbose 'quoted text' export export "$@" -eu then 'quoted text' -eu test
+		2>/dev/null | 'quoted text' /usr/bin then
+		local ${HOME} /usr/bin /usr/bin local ${HOME} 'quoted text'
+awk local then test awk then ${HOME}
+		export | awk awk test local echo && $(pwd) export && ${HOME}
+		done | done "$1" local $(pwd) -eu local /usr/bin /usr/bin
+		echo sed awk | echo -eu then sed $(pwd) then test
+grep then --verbose done sed then $(pwd) 'quoted text' grep readonly
+		readonly /usr/bin 'quoted text' grep | /usr/bin 'quoted text'
+		${HOME} printf x=1 awk "$1" test "$@" --verbose ${HOME} "$1" &&
+		export "$@" /usr/bin -eu "$@" cd 'quoted text' x=1 --verbose test local
+	${HOME} 'quoted text' export
+sed /usr/bin sed done /usr/bin export
+	$(pwd) 2>/dev/null | "$1" printf "$1"
+		x=1 local -eu readonly printf echo sed $(pwd) awk then readonly then $(pwd)
+		printf -eu test done ${HOME} echo export awk echo test | -eu /usr/bin
+	cd $(pwd) cd ${HOME} cd --verbose -eu export echo test | cd awk -eu --verbose
+"$@" readonly awk | local -eu readonly
+readonly awk then 2>/dev/null grep && "$1" then $(pwd) /usr/bin ${HOME} cd
+2>/dev/null --verbose "$@" x=1 | awk awk $(pwd) echo "$1" grep &&
+		x=1 --verbose awk "$@" | /usr/bin
+		-eu readonly | $(pwd) --verbose local $(pwd) 2>/dev/null grep echo
+	sed $(pwd) /usr/bin export
+		echo sed local 2>/dev/null done local x=1 test then /usr/bin
+2>/dev/null test then cd "$1" done test | then -eu printf readonly sed --verbose
+		readonly ${HOME} cd x=1 -eu export
+	'quoted text' | export --verbose $(pwd)
+	readonly printf 2>/dev/null echo grep grep 'quoted text'
+	| 2>/dev/null | sed readonly && && x=1 x=1 "$@"
+		done -eu x=1 && && 'quoted text' echo x=1
+	printf x=1 grep 2>/dev/null local -eu x=1 2>/dev/null printf printf
+		done then then local 'quoted text'
+		| local "$@" | 2>/dev/null "$@" -eu grep readonly test then
+	'quoted text' local done /usr/bin
+		awk 'quoted text' && awk | done done -eu --verbose -eu | done echo readonly
+		then sed 'quoted text' then 'quoted text' /usr/bin
+		awk ${HOME} ${HOME} 'quoted text' /usr/bin ${HOME} done test 'quoted text'
+		2>/dev/null x=1 'quoted text' cd x=1 printf "$@" -eu
+		local | "$@" $(pwd) x=1 2>/dev/null $(pwd) grep -eu x=1 printf $(pwd) then
+		x=1 ${HOME} "$1" 2>/dev/null echo && --verbose -eu
+	"$1" local done done sed /usr/bin readonly echo sed x=1 export 2>/dev/null
+"$1" | --verbose "$1" done "$1" --verbose --verbose echo cd sed echo echo local
+		| "$1" ${HOME} --verbose $(pwd) sed -eu -eu --verbose
+		--verbose $(pwd) readonly grep x=1 local sed test /usr/bin test cd
+	$(pwd) -eu local -eu cd -eu test
+	x=1 && local 2>/dev/null then then ${HOME} done
+local sed /usr/bin done export ${HOME} --verbose
+	then 2>/dev/null test ${HOME} printf local 2>/dev/null test | x=1 grep echo
+	printf echo $(pwd) local "$1" awk -eu "$@" test
+sed 'quoted text' --verbose test readonly x=1 then done done x=1 x=1
+	&& printf sed /usr/bin readonly grep
+	"$@" -eu ${HOME} printf --verbose
+	local "$@" readonly local then then export ${HOME} done
+		'quoted text' 'quoted text' echo --verbose readonly
+	"$1" | 2>/dev/null -eu export test /usr/bin -eu echo test /usr/bin
+${HOME} readonly sed 'quoted text' awk ${HOME} printf --verbose cd $(pwd)
+		"$1" -eu sed echo echo && test local awk printf cd 2>/dev/null "$@"
+		'quoted text' done sed grep sed echo export "$@"
+	x=1 grep sed /usr/bin
+	| printf echo grep --verbose
+grep printf printf && && 2>/dev/null sed test readonly | then 2>/dev/null
+	test then done local "$1" "$1" && x=1 "$1" echo
+		/usr/bin export sed -eu 'quoted text' 'quoted text' printf
+sed grep readonly && /usr/bin awk && /usr/bin cd ${HOME} x=1 --verbose
+/usr/bin /usr/bin local && readonly
+		&& && done printf --verbose "$1" sed done 'quoted text'
+readonly $(pwd) grep printf cd &&
+-eu x=1 cd grep "$@" "$@" x=1 sed echo done printf
+/usr/bin export "$@" echo grep 2>/dev/null
+	x=1 printf x=1 | $(pwd) 'quoted text' local printf export "$@"
+/usr/bin cd done test -eu local
+	then --verbose -eu export $(pwd)
+		--verbose "$1" | ${HOME} ${HOME} x=1 -eu echo printf | --verbose --verbose
+echo --verbose sed $(pwd) 2>/dev/null awk local && && -eu
+		$(pwd) -eu x=1 "$@" local "$@"
+"$1" && | cd cd /usr/bin done | grep && test $(pwd) done
+	awk cd sed 2>/dev/null printf /usr/bin 'quoted text' grep done
+		'quoted text' ${HOME} 2>/dev/null then cd echo $(pwd) x=1 | printf cd export
+		done "$@" --verbose "$@" test grep grep done grep x=1 2>/dev/null
+	${HOME} awk then local test x=1 'quoted text'
+		"$@" awk && --verbose ${HOME} /usr/bin printf && -eu 'quoted text' done x=1
+grep then -eu echo done local
+		${HOME} /usr/bin x=1 export echo "$1" awk sed printf echo "$1" --verbose
+		grep then echo grep cd "$@" /usr/bin /usr/bin "$@" done
+		export $(pwd) cd --verbose export readonly local sed -eu && test printf echo
+		local then echo local grep
+printf cd ${HOME} test 2>/dev/null && "$@" printf readonly
+	$(pwd) test then 'quoted text' sed
+grep /usr/bin sed /usr/bin cd -eu $(pwd) export sed "$@" | $(pwd)
+${HOME} grep "$1" printf -eu
+local readonly local then printf --verbose sed grep --verbose
+	readonly local -eu awk | printf "$@" export "$@" 2>/dev/null
+sed /usr/bin "$1" test local $(pwd) |
+		local --verbose then && "$1"
+local export grep awk -eu done 2>/dev/null
+	export | grep awk x=1 local "$1"
+x=1 awk 'quoted text' done --verbose local /usr/bin cd printf 'quoted text'
+		&& grep test x=1 "$@" printf echo cd printf cd /usr/bin done
+		'quoted text' export 'quoted text' "$@" done printf
+--verbose awk cd grep then done then
+		echo "$1" readonly "$1" --verbose test | && $(pwd) cd export
+		done grep 2>/dev/null $(pwd) /usr/bin printf echo grep --verbose sed then ${HOME}
+"$1" 'quoted text' /usr/bin 2>/dev/null $(pwd) then 'quoted text'
+		-eu done x=1 && -eu x=1 /usr/bin grep 2>/dev/null $(pwd) awk --verbose printf
+		2>/dev/null cd /usr/bin readonly 'quoted text' "$@" printf
+${HOME} readonly $(pwd)
+local ${HOME} "$@" x=1 cd &&
+awk ${HOME} --verbose 'quoted text' cd | test 2>/dev/null /usr/bin
+echo $(pwd) local --verbose 2>/dev/null "$1" echo --verbose
+	/usr/bin echo then x=1 && "$1" printf cd -eu --verbose
+		$(pwd) 'quoted text' x=1 /usr/bin grep x=1 | --verbose "$@" -eu echo && /usr/bin
+	/usr/bin --verbose sed cd $(pwd) "$1" -eu done echo ${HOME} && ${HOME} readonly
+		2>/dev/null -eu local awk awk readonly | test "$@" export ${HOME}
+export 2>/dev/null "$1" | -eu $(pwd) "$1" then
+test echo --verbose -eu test printf && awk ${HOME} "$1"
+test x=1 awk 2>/dev/null readonly x=1 --verbose --verbose printf ${HOME}
+		| 'quoted text' --verbose local 2>/dev/null done then grep x=1 readonly
+2>/dev/null x=1 readonly sed $(pwd) grep done --verbose done awk && -eu "$@" echo
+grep x=1 sed then printf ${HOME} echo 2>/dev/null
+		$(pwd) 2>/dev/null sed readonly readonly then test
+	then export readonly | -eu && -eu
+	"$1" awk 2>/dev/null echo ${HOME} --verbose export local "$@" /usr/bin ${HOME}
+		echo /usr/bin ${HOME} x=1 done cd sed | test /usr/bin readonly | readonly
+&& && grep grep cd echo echo printf
+	sed echo echo 'quoted text' 2>/dev/null then export test echo awk --verbose
+| test echo cd /usr/bin printf --verbose ${HOME} /usr/bin $(pwd) done ${HOME}
+		echo test "$@" 2>/dev/null 'quoted text' 'quoted text' && echo cd export 'quoted text'
+x=1 2>/dev/null $(pwd) --verbose -eu $(pwd) export 2>/dev/null 'quoted text'
+x=1 done && ${HOME} echo awk then awk 2>/dev/null "$1" cd sed cd cd
+	sed sed then grep local printf export -eu local awk sed "$@" 2>/dev/null
+readonly 2>/dev/null --verbose x=1 x=1 then cd 2>/dev/null
+done echo 'quoted text' "$1" -eu grep cd local "$1" --verbose cd echo /usr/bin
+	"$@" "$@" --verbose "$@" awk $(pwd) "$1" export awk local
+		printf echo $(pwd) readonly ${HOME} "$1" x=1 cd -eu echo $(pwd) local
+		"$1" readonly /usr/bin readonly 2>/dev/null /usr/bin
+	/usr/bin | -eu /usr/bin test
+&& | awk export cd 'quoted text' printf awk 'quoted text'
+	"$@" test "$1" 'quoted text' test echo grep test 2>/dev/null
+	$(pwd) && awk readonly 2>/dev/null | $(pwd)
+&& 2>/dev/null awk /usr/bin
+echo --verbose "$@" && export printf 2>/dev/null
+		2>/dev/null /usr/bin
+		| /usr/bin test 2>/dev/null then | && x=1 grep && ${HOME} | "$@" ${HOME}
+		readonly export cd /usr/bin awk then
+		&& /usr/bin grep $(pwd) ${HOME} grep local --verbose -eu ${HOME} printf
+		cd then sed -eu done $(pwd) | readonly echo "$1" done grep x=1 /usr/bin local
+		${HOME} $(pwd) $(pwd) printf | readonly $(pwd) cd cd sed 2>/dev/null
+		printf echo 2>/dev/null grep && export then done ${HOME} "$@" 2>/dev/null
+		2>/dev/null export -eu done -eu --verbose sed printf && then done export
+grep ${HOME} echo 2>/dev/null
+x=1 then then /usr/bin sed --verbose
+then export ${HOME} done done grep echo echo export "$1" 2>/dev/null export
+	printf sed sed $(pwd) cd -eu /usr/bin
+	| 2>/dev/null 2>/dev/null 'quoted text' awk test
+$(pwd) export -eu | x=1 | --verbose
+		sed sed | export | $(pwd) x=1 export x=1
+test test printf $(pwd) /usr/bin sed "$1" awk awk readonly
+readonly $(pwd) $(pwd) x=1 "$@" local | sed
+--verbose "$@" 'quoted text' && 2>/dev/null x=1 cd "$@" ${HOME} echo done readonly
+	sed --verbose "$@" local | 'quoted text' 2>/dev/null
+$(pwd) test -eu echo awk ${HOME}
+		grep export --verbose --verbose
+		/usr/bin "$@" x=1 printf "$1" done
+"$@" 'quoted text' cd printf /usr/bin /usr/bin local test "$1" && awk echo
+&& local ${HOME} "$@" "$1" printf echo 2>/dev/null && /usr/bin
+local then 'quoted text' "$1" ${HOME} printf x=1 $(pwd) local
+		"$1" cd --verbose echo $(pwd) 'quoted text' printf local cd
+	"$1" "$1" sed done local 2>/dev/null
+	echo ${HOME} 2>/dev/null
+"$1" "$1" x=1 $(pwd) --verbose
+	test done -eu x=1 2>/dev/null export export printf && sed done awk && echo &&
+		export export sed grep && --verbose awk -eu && echo cd done test
+	test cd echo | awk readonly "$@" awk awk readonly x=1
+	${HOME} export $(pwd) cd "$@" readonly readonly "$1" cd
+	then $(pwd) cd grep ${HOME}
+	&& --verbose $(pwd) readonly grep sed
+printf done ${HOME} export "$1"
+	"$1" readonly printf done
+		"$1" printf -eu echo "$@" 2>/dev/null readonly
+	then 'quoted text' test printf cd
+		2>/dev/null | test 2>/dev/null done
+readonly | readonly | local done export 2>/dev/null 'quoted text'
+	sed 2>/dev/null "$1" readonly awk && cd $(pwd) ${HOME} | awk
+	| grep awk | done $(pwd) awk printf
+	$(pwd) test test cd x=1 awk && "$1" printf grep
+	export readonly grep $(pwd) test /usr/bin /usr/bin -eu grep awk printf
+$(pwd) x=1 test then ${HOME} cd done echo
+echo $(pwd) x=1 "$@" 2>/dev/null /usr/bin then test readonly
+	cd 'quoted text' 'quoted text' sed test readonly -eu --verbose
+		awk done $(pwd) awk 2>/dev/null
+	readonly test 'quoted text'
+		test 2>/dev/null 2>/dev/null "$@" 'quoted text' done
+2>/dev/null "$@" -eu $(pwd) sed --verbose $(pwd) 2>/dev/null
+&& ${HOME} "$1" test -eu awk printf "$@" cd /usr/bin "$@" /usr/bin readonly | "$1"
+/usr/bin echo cd printf | "$@" /usr/bin "$@" test
+	| x=1 -eu "$@" && grep ${HOME} ${HOME} echo
+		printf done --verbose echo /usr/bin test
+cd grep grep readonly local $(pwd) local --verbose
+	grep && "$1" 2>/dev/null then
+		then ${HOME} test test sed x=1 "$1" "$@" 2>/dev/null "$@"
+"$1" $(pwd) sed echo local 'quoted text'
+	printf printf awk printf readonly export | /usr/bin grep
+test $(pwd) readonly x=1 && readonly readonly done 'quoted text' export
+test x=1 grep -eu readonly readonly then sed ${HOME}
+		echo then export | cd "$@" --verbose then done sed done -eu test $(pwd) cd $(pwd)
+		-eu echo echo grep export -eu /usr/bin grep
+		readonly export ${HOME} | then 2>/dev/null
+	readonly echo export "$@" grep | "$1" && echo test --verbose ${HOME}
+printf grep x=1 x=1 /usr/bin "$@" x=1 "$@" then 2>/dev/null
+$(pwd) cd ${HOME} cd local printf --verbose
+test --verbose /usr/bin awk
+grep -eu x=1 --verbose then 2>/dev/null
+	printf sed $(pwd) grep $(pwd) grep
+	'quoted text' printf grep awk sed echo readonly 'quoted text' "$1" echo test
+		$(pwd) readonly local ${HOME} --verbose
+printf /usr/bin printf x=1 then awk "$1" awk then grep cd |
+-eu export export done -eu "$@" done x=1 'quoted text' x=1
+		printf && test --verbose -eu 2>/dev/null $(pwd) grep
+| sed printf test then local readonly sed test export sed -eu printf $(pwd) done
+test test "$1" readonly /usr/bin
+		awk | "$1" done export && then x=1
+		cd $(pwd) grep ${HOME} /usr/bin grep | readonly 2>/dev/null | -eu readonly cd
+	cd ${HOME} /usr/bin && done ${HOME} x=1 /usr/bin "$@" 'quoted text' $(pwd) export
+		echo $(pwd) | cd "$1" test grep readonly
+	'quoted text' "$1" awk export /usr/bin
+awk x=1 -eu 2>/dev/null x=1 echo 'quoted text' ${HOME} local x=1 done | 2>/dev/null
+		test 'quoted text' && $(pwd) local cd /usr/bin x=1 cd -eu
+		done echo --verbose --verbose awk --verbose sed
+		"$@" done "$@" awk --verbose && "$@" && awk then cd awk test test test && echo
+then sed 'quoted text' ${HOME} "$1" 'quoted text' test done export
+$(pwd) then sed then echo then sed "$1" then printf 'quoted text' awk then -eu
+		x=1 cd --verbose /usr/bin --verbose grep $(pwd) then awk
+	/usr/bin test echo awk "$@" -eu export done then /usr/bin then
+		printf test then printf | &&
+		export && printf readonly "$@" awk | --verbose
+sed | grep readonly /usr/bin -eu && x=1
+		readonly "$@" done "$1" test
+	/usr/bin echo export 2>/dev/null done
+/usr/bin readonly ${HOME} 'quoted text' test -eu readonly
+		/usr/bin grep 2>/dev/null test x=1 test grep cd grep "$1" grep awk export
+test printf printf "$@" readonly done "$1" 'quoted text' grep awk x=1
+	2>/dev/null then cd ${HOME} ${HOME}
+--verbose echo "$1" && "$@" x=1
+		| readonly /usr/bin readonly && test printf -eu
+	| --verbose test x=1 test grep local "$1" printf "$@" awk 2>/dev/null
+	readonly $(pwd) 'quoted text' readonly "$@" then sed -eu cd
+awk 'quoted text' ${HOME} local
+	readonly grep grep 2>/dev/null local grep done export "$1" --verbose
+'quoted text' 2>/dev/null /usr/bin local | awk then test
+awk && local /usr/bin 2>/dev/null $(pwd) local | printf "$@" && 'quoted text'
+	$(pwd) awk $(pwd) local echo 2>/dev/null && /usr/bin x=1
+${HOME} && /usr/bin "$@" then 'quoted text' "$1" /usr/bin readonly
+	awk ${HOME} /usr/bin /usr/bin sed | done
+	$(pwd) printf "$@" then && cd export grep ${HOME} printf grep local
+	printf readonly grep echo && sed awk | --verbose -eu sed -eu | 'quoted text'
+	done local grep x=1 'quoted text'
+		test --verbose awk x=1 done
+	$(pwd) readonly awk grep sed echo | $(pwd)
+		readonly test && test && x=1 readonly cd sed 'quoted text'
+	export --verbose | then cd
+	then | sed ${HOME} local 2>/dev/null --verbose local
+	test cd readonly awk export "$@" 'quoted text' x=1 printf
+/usr/bin x=1 && readonly test
+	awk test | /usr/bin $(pwd) test "$@" ${HOME} echo export ${HOME} local /usr/bin
+		export "$1" local then
+	test awk sed x=1 2>/dev/null /usr/bin
+readonly grep $(pwd) && && ${HOME} -eu printf ${HOME} $(pwd) 'quoted text'
+printf export readonly "$@" 2>/dev/null
+	grep sed readonly printf echo | /usr/bin export x=1 sed --verbose
+echo cd then grep /usr/bin
+		then 'quoted text' --verbose && $(pwd) | sed readonly printf -eu --verbose
+--verbose "$@" && sed -eu --verbose local
+	export -eu awk awk && cd cd -eu done awk test | cd
+		readonly ${HOME} readonly cd grep awk /usr/bin grep 'quoted text' /usr/bin readonly
+		'quoted text' printf test export echo /usr/bin
+	local sed | "$1" printf 'quoted text' "$1" cd /usr/bin
+	awk readonly cd && export "$@" --verbose local sed echo "$@"
+	--verbose grep readonly -eu | -eu grep awk "$@" ${HOME}
+	&& ${HOME} echo | | local --verbose export /usr/bin x=1 local local cd then
+then then printf test /usr/bin 'quoted text' test /usr/bin ${HOME}
+		grep cd "$@" local echo "$@"
+	--verbose awk "$1" --verbose $(pwd) cd readonly
+'quoted text' then -eu
+		2>/dev/null printf printf echo ${HOME} $(pwd) -eu awk done
+		${HOME} -eu readonly echo echo awk --verbose cd --verbose ${HOME} -eu local ${HOME}
+then echo readonly | export readonly "$@" done
+		"$@" ${HOME} done test "$1" sed "$1" x=1 2>/dev/null export then sed sed grep
+		--verbose "$@" ${HOME} x=1 export x=1 && --verbose ${HOME} done grep cd printf
+		--verbose export --verbose echo ${HOME} awk --verbose export
+	test export 2>/dev/null test cd | grep && export $(pwd) "$@" grep readonly
+		-eu "$@" -eu echo grep cd /usr/bin x=1 -eu done 'quoted text' "$1" cd "$@" 2>/dev/null
+-eu 2>/dev/null sed $(pwd) && -eu "$@" echo 'quoted text' 'quoted text' 2>/dev/null
+		readonly awk "$1" grep awk "$1" local printf /usr/bin local awk
+${HOME} awk local /usr/bin
+done cd -eu test | sed x=1 | done local $(pwd) | 'quoted text' $(pwd) 2>/dev/null
+	| $(pwd) grep echo --verbose && /usr/bin
+	"$@" grep $(pwd) readonly done sed printf awk export readonly readonly
+		export /usr/bin | export awk done export
+		readonly echo /usr/bin done awk x=1 export echo local cd readonly sed
+	sed "$1" x=1 test echo | readonly
+	| local | local printf printf local 'quoted text'
+		&& -eu local 'quoted text' done | grep then grep echo awk
+/usr/bin x=1 "$1" $(pwd) readonly printf local --verbose "$@" x=1
+	/usr/bin | awk --verbose ${HOME} "$@" "$1" "$@" "$@" done
+		${HOME} then /usr/bin local awk | /usr/bin 'quoted text'
+--verbose | "$@" export echo readonly "$1" x=1 awk "$@"
+	-eu local x=1 ${HOME} local "$@" "$1" test | ${HOME}
+	readonly grep -eu 'quoted text'
+/usr/bin printf ${HOME} --verbose sed cd "$1" "$1" -eu
+		readonly --verbose awk readonly 2>/dev/null "$1" x=1 grep -eu then /usr/bin
+		readonly test "$1" printf then
+	echo ${HOME} test -eu --verbose local
+		"$@" 'quoted text' test
+		readonly ${HOME} echo awk test grep "$1" /usr/bin echo
+/usr/bin echo "$@" "$1" then then local "$1"
+"$@" grep $(pwd) cd "$1" grep 'quoted text' 'quoted text' -eu done awk
+readonly printf ${HOME} echo "$1" "$1" x=1 sed sed $(pwd)
+	&& grep export sed printf "$@" local /usr/bin printf /usr/bin then test
+		test grep readonly && /usr/bin -eu $(pwd) 'quoted text'
+	2>/dev/null 'quoted text' "$1" /usr/bin grep && echo /usr/bin done /usr/bin
+	${HOME} /usr/bin export --verbose
+	echo done test ${HOME} && cd done | ${HOME}
+readonly printf && cd x=1
+test cd /usr/bin export /usr/bin readonly | export test $(pwd)
+/usr/bin | 'quoted text' readonly 2>/dev/null $(pwd) && cd $(pwd) /usr/bin
+		printf /usr/bin awk ${HOME} 2>/dev/null -eu ${HOME} done
+		done x=1 $(pwd) grep && 'quoted text' cd local
+	--verbose /usr/bin sed /usr/bin grep $(pwd) 'quoted text' $(pwd)
+	local "$@" echo | ${HOME} && x=1 /usr/bin 2>/dev/null --verbose "$@" && test
+2>/dev/null && grep | "$@" readonly --verbose test test /usr/bin
+	printf 2>/dev/null 2>/dev/null echo && sed
+		grep $(pwd) printf export "$@" 'quoted text' printf then x=1 awk
+grep 'quoted text' 'quoted text' | local ${HOME} ${HOME}
+		"$@" local echo local printf 'quoted text' --verbose grep printf done 2>/dev/null
+'quoted text' --verbose export
+		awk $(pwd) 2>/dev/null cd readonly && awk
+--verbose "$1" /usr/bin --verbose && "$@" $(pwd) local printf
+export printf sed cd local "$1" "$1" $(pwd) awk | local 'quoted text'
+	--verbose /usr/bin "$1" done test
+	2>/dev/null export export ${HOME}
+	x=1 test | cd cd printf 2>/dev/null 'quoted text' echo -eu 2>/dev/null x=1
+	then ${HOME} | 'quoted text' awk echo export "$@" grep local
+		2>/dev/null | echo x=1
+		x=1 awk grep --verbose "$@" echo x=1 awk export echo export 2>/dev/null $(pwd) 2>/dev/null
+	'quoted text' 'quoted text' && 2>/dev/null "$@" -eu local
+	grep -eu $(pwd) then && export && $(pwd)
+		2>/dev/null sed && | x=1 ${HOME} export 'quoted text'
+		done local && 2>/dev/null && grep | x=1 --verbose
+		${HOME} 'quoted text' readonly sed ${HOME}
+-eu "$@" printf 2>/dev/null
+then --verbose export /usr/bin readonly 'quoted text' readonly 'quoted text'
+		test awk -eu 'quoted text' && sed && cd "$1"
+		then readonly sed 'quoted text' && 'quoted text' echo "$1" && "$@" sed awk
+	echo echo printf test 'quoted text' awk /usr/bin /usr/bin sed
+then | export $(pwd) then local awk
+	${HOME} sed ${HOME} cd 2>/dev/null then echo
+printf export done x=1 $(pwd) 'quoted text' 2>/dev/null ${HOME} printf sed 2>/dev/null
+echo 2>/dev/null export 'quoted text'
+		| "$1" ${HOME} grep 2>/dev/null && /usr/bin then "$@" done
+	-eu && --verbose sed cd printf cd export -eu grep grep echo | "$@"
+awk then /usr/bin $(pwd) cd 'quoted text' readonly
+	2>/dev/null 'quoted text' /usr/bin -eu
+		export x=1 test test | echo
+		/usr/bin | test && "$@"
+/usr/bin && export $(pwd) echo && sed -eu && /usr/bin
+		done | $(pwd) awk test 2>/dev/null sed x=1 "$@" && echo grep
+grep "$@" --verbose readonly 2>/dev/null
+	"$1" /usr/bin sed "$@" printf grep local done awk 2>/dev/null
+	x=1 awk echo /usr/bin echo done x=1 "$1" local -eu $(pwd) test "$@" grep
+	awk done sed sed awk "$@" cd -eu
+x=1 ${HOME} local then grep && x=1 readonly cd cd $(pwd) cd
+	"$1" awk cd ${HOME} echo | printf "$@" && printf -eu echo /usr/bin 2>/dev/null
+export && 2>/dev/null $(pwd) test /usr/bin
+done "$1" && awk printf echo
+		then -eu /usr/bin /usr/bin $(pwd)
+	echo "$1" && awk 2>/dev/null echo 'quoted text'
+	then readonly export cd --verbose /usr/bin | 2>/dev/null export local test
+sed /usr/bin echo export export
+2>/dev/null grep awk grep then -eu echo
+	cd export sed echo printf 'quoted text' local 2>/dev/null
+/usr/bin local local grep echo awk 'quoted text'
+	then echo x=1 printf ${HOME} cd printf awk
+	/usr/bin test then export done grep 2>/dev/null grep grep sed 'quoted text'
+2>/dev/null /usr/bin 'quoted text' test /usr/bin
+${HOME} printf -eu test --verbose then "$1" 2>/dev/null
+		readonly | 'quoted text' --verbose
+		&& test x=1 | -eu cd done | && x=1 echo -eu then done done sed then x=1 export
+local printf readonly sed export $(pwd) done local awk 'quoted text' x=1 printf
+	awk printf then && -eu $(pwd) awk cd awk awk 'quoted text'
+	2>/dev/null x=1 ${HOME}
+	awk test --verbose printf grep $(pwd) then export local $(pwd) $(pwd)
+then export awk && "$@" grep readonly
+--verbose test "$1" awk awk --verbose --verbose done /usr/bin
+		${HOME} && local echo export 'quoted text' $(pwd) --verbose grep ${HOME}
+	2>/dev/null then sed "$@" "$@" 2>/dev/null sed test "$@" | /usr/bin --verbose
+${HOME} -eu cd then 2>/dev/null
+$(pwd) | printf 2>/dev/null test | 2>/dev/null awk --verbose
+		readonly --verbose test cd 2>/dev/null cd --verbose x=1 then then --verbose
+		done cd 'quoted text' | awk --verbose sed 2>/dev/null ${HOME} /usr/bin
+		"$1" -eu | printf awk then &&
+printf grep then awk 2>/dev/null | awk x=1 awk sed "$@" ${HOME} "$@" awk -eu
+	2>/dev/null | -eu sed readonly test echo --verbose x=1
+--verbose awk /usr/bin 'quoted text' readonly test
+		sed test --verbose 'quoted text' cd local sed done /usr/bin 2>/dev/null
+${HOME} done then echo /usr/bin 'quoted text'
+		printf --verbose $(pwd) -eu 'quoted text'
+	echo export 2>/dev/null cd awk awk printf "$1"
+export $(pwd) local sed printf export
+	test export $(pwd) -eu cd $(pwd) export local done 'quoted text' printf
+	x=1 ${HOME} test -eu local 2>/dev/null export printf test
+		grep printf 2>/dev/null sed grep "$@" --verbose cd "$1" -eu
+	awk && | 'quoted text' cd echo sed echo ${HOME}
+'quoted text' test "$@" "$1" -eu "$@" | local /usr/bin x=1 export x=1 'quoted text'
+	"$@" grep cd then grep cd
+		then $(pwd) then x=1 cd ${HOME} /usr/bin
+cd grep /usr/bin x=1 sed grep grep
+	--verbose 2>/dev/null "$1" && cd -eu $(pwd) /usr/bin
+		x=1 x=1 --verbose cd -eu readonly
+--verbose local awk then ${HOME} awk awk -eu
+		done then export test "$@" printf 'quoted text' ${HOME} local 'quoted text'
+--verbose grep local ${HOME} "$1" awk && $(pwd) test --verbose local sed |
+	export done done x=1 --verbose then "$1" readonly "$1" then 'quoted text' cd "$@"
+	echo cd /usr/bin "$1" awk $(pwd) awk 2>/dev/null test -eu test
+		&& awk --verbose --verbose local
+	'quoted text' printf -eu "$1"
+	awk printf awk done /usr/bin
+	--verbose && /usr/bin $(pwd) && printf
+"$@" --verbose x=1 readonly "$@" readonly sed test readonly
+&& 2>/dev/null awk local | "$@" cd "$1" x=1
+echo test readonly 2>/dev/null --verbose
+		"$1" | /usr/bin sed cd "$@" | printf -eu printf && -eu --verbose
+"$1" awk /usr/bin /usr/bin "$1" $(pwd) local then grep export
+	echo export echo then -eu printf sed x=1
+	cd local local && then test x=1 then grep done | cd ${HOME}
+	echo "$1" printf local grep "$@" | readonly --verbose
+		${HOME} grep printf /usr/bin ${HOME} && 2>/dev/null $(pwd) then
+	$(pwd) -eu ${HOME} printf ${HOME} sed && x=1
+/usr/bin sed ${HOME} ${HOME} 2>/dev/null export awk ${HOME} | --verbose
+--verbose 'quoted text' 'quoted text'
+		-eu 2>/dev/null printf /usr/bin $(pwd) awk echo
+grep local -eu done awk "$1" -eu 'quoted text'
+--verbose 'quoted text' /usr/bin ${HOME} /usr/bin export ${HOME} export
+	-eu -eu readonly x=1 test 'quoted text' | --verbose x=1 readonly export x=1
+	cd 'quoted text' echo sed "$@" test x=1 cd printf awk "$1" &&
+-eu "$1" readonly -eu test
+local -eu then cd local sed export sed && "$1" x=1 export cd
+		"$1" $(pwd) readonly echo sed test "$@" "$1" grep x=1 awk --verbose
+'quoted text' 'quoted text' local
+	--verbose ${HOME} done 2>/dev/null grep
+		x=1 --verbose export 'quoted text' printf $(pwd) "$1" printf
+export local x=1 -eu grep --verbose test done grep ${HOME} sed /usr/bin
+	sed grep sed x=1 --verbose 'quoted text'
+		done done export --verbose
+		-eu "$1" $(pwd) 2>/dev/null | /usr/bin
+	"$1" --verbose cd --verbose grep
+grep cd awk --verbose sed echo readonly
+awk local awk local x=1 x=1 awk --verbose "$@" /usr/bin grep $(pwd) $(pwd)
+test sed "$1" grep ${HOME} /usr/bin test awk | test --verbose
+"$1" printf | | done $(pwd) readonly ${HOME}
+printf | x=1 done -eu local sed test test ${HOME} 2>/dev/null -eu export --verbose
+		-eu -eu echo /usr/bin -eu then cd "$1" export | awk grep | --verbose grep /usr/bin
+	&& done "$1" export cd local echo "$@" x=1 test test printf readonly
+		local $(pwd) sed then cd "$1" x=1
+		${HOME} printf then ${HOME} $(pwd) -eu then --verbose
+test local awk | local test 'quoted text'
+		| "$1" && export export $(pwd) done local echo export readonly done printf
+done && awk -eu x=1 then done awk "$1" 'quoted text' echo --verbose 'quoted text'
+&& done sed 'quoted text' "$1" "$1" cd cd -eu && x=1 --verbose then local &&
+cd cd export then "$@" then /usr/bin sed 2>/dev/null
+	readonly && readonly -eu awk /usr/bin $(pwd) x=1 /usr/bin "$1"
+	awk | sed 2>/dev/null --verbose
+	--verbose test 'quoted text' local | "$1" x=1 test echo /usr/bin 2>/dev/null
+		test done -eu echo grep
+	awk printf "$@" awk then
+sed export readonly echo 2>/dev/null && local
+		--verbose cd then /usr/bin | then | sed grep "$1" test "$1" $(pwd) cd cd local
+	grep ${HOME} 2>/dev/null grep then &&
+$(pwd) 2>/dev/null cd -eu grep readonly done export then grep --verbose -eu
+		-eu x=1 'quoted text' 2>/dev/null
+"$1" -eu printf sed 'quoted text'
+	grep $(pwd) done x=1 readonly && "$1"
+	readonly sed && /usr/bin sed /usr/bin then ${HOME} echo readonly local awk
+${HOME} $(pwd) local test /usr/bin awk grep test test readonly
+export /usr/bin -eu local done 'quoted text' done printf
+	printf export ${HOME} export awk 'quoted text' --verbose --verbose
+	printf local done ${HOME}
+		printf -eu -eu awk grep echo -eu echo cd done $(pwd)
+		${HOME} cd x=1 2>/dev/null $(pwd)
+then test "$@" $(pwd) 'quoted text' $(pwd) printf cd cd echo "$@"
+export cd awk readonly grep test
+	--verbose grep grep "$1" "$1" | ${HOME} && 2>/dev/null
+		test cd && ${HOME} readonly "$1" x=1 x=1 done readonly grep "$@" && local 'quoted text'
+		printf "$@" awk x=1 then &&
+		sed export test readonly "$1" grep export x=1 x=1 printf
+		"$@" local local 2>/dev/null 'quoted text'
+	$(pwd) echo 2>/dev/null awk --verbose x=1 -eu test ${HOME} ${HOME} "$1" awk
+		-eu local 'quoted text' && 'quoted text' x=1
+	| test /usr/bin export
+	| "$@" grep && -eu "$@" /usr/bin done ${HOME} && readonly 'quoted text'
+		awk $(pwd) readonly /usr/bin grep /usr/bin
+printf | cd 2>/dev/null | printf export sed readonly export ${HOME} | cd
+	local readonly local readonly awk test $(pwd)
+	then done export sed | echo /usr/bin cd ${HOME} sed sed --verbose done cd printf
+		-eu $(pwd) readonly done local ${HOME}
+		--verbose ${HOME} --verbose
+"$1" readonly --verbose
+		--verbose grep -eu 'quoted text' grep echo printf && --verbose
+	readonly | && local cd grep /usr/bin 'quoted text' "$1" "$1" echo $(pwd)
+	then "$1" cd cd grep done "$@" then then ${HOME} echo export "$1"
+	sed then sed awk | done local echo cd ${HOME} 'quoted text' x=1 cd printf
+	2>/dev/null "$@" "$@" --verbose
+echo test awk x=1 "$1" /usr/bin x=1 cd "$@" -eu -eu
+awk && | --verbose cd printf
+		sed cd $(pwd) x=1 test -eu --verbose echo "$1" local --verbose
+sed "$1" grep awk echo --verbose ${HOME} "$@"
+		local /usr/bin && export done $(pwd) sed local awk --verbose | echo "$1" "$1" export
+		local echo printf done 'quoted text' $(pwd) printf $(pwd) done export test
+	printf 'quoted text' $(pwd) "$@" grep "$1" 2>/dev/null test export sed done local
+--verbose ${HOME} then
+	"$1" echo | /usr/bin | printf
+		/usr/bin readonly printf x=1 cd readonly test -eu
+		readonly grep test done "$1" 2>/dev/null "$1" "$@"
+	local then echo -eu $(pwd)
+	2>/dev/null | /usr/bin local test local test && echo "$@" then
+sed sed test /usr/bin 2>/dev/null ${HOME} "$@" export test 2>/dev/null
+		printf --verbose && printf grep local "$1" $(pwd) && $(pwd) echo
+	readonly | --verbose printf echo done export "$@" /usr/bin
+		'quoted text' cd && "$@" 'quoted text' local | /usr/bin printf "$1"
+	grep awk cd export -eu test "$1" 2>/dev/null then "$1" $(pwd) local
+	readonly $(pwd) done echo sed echo | "$1" | grep /usr/bin local /usr/bin
+		cd 'quoted text' | echo "$@" sed /usr/bin then test | awk 2>/dev/null
+		done awk "$1" sed cd printf -eu echo
+	"$1" $(pwd) grep "$1" "$@" test grep printf x=1 local && echo 'quoted text'
+		echo grep --verbose sed x=1 /usr/bin 'quoted text' cd awk cd
+	printf x=1 -eu export
+'quoted text' "$@" && ${HOME} "$@" test "$@" test 2>/dev/null
+	done echo x=1 done export printf sed 'quoted text' export ${HOME} /usr/bin
+readonly 2>/dev/null 'quoted text' export && && readonly awk ${HOME} cd
+$(pwd) ${HOME} then echo "$1" --verbose awk
+	awk then 'quoted text' $(pwd) /usr/bin
+-eu sed "$1" $(pwd) awk "$1" done
+	&& readonly done awk test export cd 'quoted text' "$1" cd awk -eu $(pwd) |
+	export printf -eu cd --verbose sed | readonly then done
+	$(pwd) x=1 | -eu /usr/bin local printf "$1" 2>/dev/null
+	-eu export export then then readonly && ${HOME} sed readonly 2>/dev/null test
+	cd 2>/dev/null cd x=1 --verbose
+	"$@" local x=1 -eu test /usr/bin x=1 local
+"$@" echo readonly awk cd cd local
+echo -eu ${HOME} printf && export &&
+		done echo 'quoted text' ${HOME} -eu sed "$1"
+readonly -eu | readonly cd then x=1 sed cd 2>/dev/null cd readonly ${HOME}
+	sed then -eu x=1 --verbose 2>/dev/null test /usr/bin test
+	x=1 x=1 -eu echo echo export cd x=1 /usr/bin then "$1" -eu cd ${HOME}
+	grep 'quoted text' test
+	local x=1 && export && x=1 sed ${HOME} readonly x=1 done test 2>/dev/null x=1 then
+	${HOME} --verbose sed grep done "$@" done ${HOME}
+-eu readonly export && readonly "$1" /usr/bin ${HOME}
+	cd x=1 --verbose local then 'quoted text' export cd -eu cd export awk local
+awk cd 'quoted text' cd && "$1" /usr/bin export grep printf
+		then ${HOME} cd && 2>/dev/null -eu printf "$1" -eu readonly
+2>/dev/null awk then sed awk /usr/bin local sed
+		/usr/bin 'quoted text' -eu grep 'quoted text' 2>/dev/null grep "$1" -eu 2>/dev/null
+	export 'quoted text' echo
+then export awk echo then x=1 'quoted text' 'quoted text'
+	test /usr/bin 'quoted text'
+test test cd "$1" grep 'quoted text'
+		--verbose sed export $(pwd) "$1" | printf grep
+echo | && then --verbose -eu "$@" local local readonly ${HOME}
+/usr/bin sed test "$1" local --verbose export "$1" awk 2>/dev/null readonly x=1
+-eu "$@" 'quoted text' --verbose readonly sed
+		-eu -eu done /usr/bin |
+${HOME} awk then | sed cd echo $(pwd)
+		done --verbose readonly local then
+		-eu local local test "$@" "$@" readonly then echo test awk echo && "$1" done
+	printf grep echo /usr/bin then done "$@" --verbose --verbose
+	local && echo "$1" "$1" test --verbose ${HOME} grep $(pwd) export
+		cd "$@" ${HOME} awk -eu grep printf local echo -eu -eu $(pwd) 2>/dev/null
+$(pwd) done x=1 sed awk grep x=1 sed 2>/dev/null
+local | awk cd ${HOME} done $(pwd) -eu "$1" export printf awk grep "$@"
+	test export then local test 2>/dev/null
+	done local | /usr/bin --verbose printf 'quoted text' sed -eu -eu echo echo
+	$(pwd) then sed echo ${HOME} echo echo "$1" then export
+printf cd cd sed then ${HOME} 2>/dev/null ${HOME}
+		cd grep cd 2>/dev/null -eu export ${HOME}
+		sed sed awk sed | $(pwd) test
+		-eu "$@" grep printf awk sed then && && test "$@"
+then sed "$@" then "$1" awk | x=1
+	cd && /usr/bin "$1" readonly $(pwd) grep && done sed readonly
+		then then cd echo awk readonly ${HOME} -eu test ${HOME}
+		'quoted text' local then --verbose
+	/usr/bin awk x=1 /usr/bin
+	sed test -eu "$@" "$@" printf 2>/dev/null printf cd cd -eu readonly --verbose
+	"$1" readonly cd awk | then
+	$(pwd) && export test sed --verbose -eu done 2>/dev/null cd 2>/dev/null
+	printf 2>/dev/null export 2>/dev/null 'quoted text' cd /usr/bin export
+		-eu awk awk test "$@" export test x=1 awk cd 'quoted text'
+		&& 2>/dev/null local done "$1" $(pwd) grep "$@" done -eu -eu "$@"
+	/usr/bin export then then echo ${HOME} ${HOME} 'quoted text' /usr/bin cd echo
+	echo awk -eu sed test readonly test ${HOME}
+		grep && /usr/bin readonly readonly -eu cd "$@" &&
+sed done cd ${HOME} --verbose grep printf
+		then grep ${HOME} -eu grep test readonly "$@" 2>/dev/null
+	x=1 && test readonly "$@" | test "$1" --verbose -eu /usr/bin export
+	then x=1 echo grep local echo printf
+	x=1 sed $(pwd) local sed -eu "$@" then 'quoted text' then
+done /usr/bin && echo 'quoted text'
+		"$@" /usr/bin "$@" $(pwd) --verbose done awk "$@" "$1" | /usr/bin
+		&& done awk export && readonly readonly
+sed export done "$@" printf x=1 then | grep readonly
+	done readonly printf /usr/bin local sed 'quoted text' x=1
+	'quoted text' ${HOME} done $(pwd) "$1" | ${HOME}
+		'quoted text' export -eu "$1" local awk 2>/dev/null
+	$(pwd) "$@" | 2>/dev/null test 2>/dev/null -eu
+		$(pwd) awk --verbose | 'quoted text' && sed --verbose /usr/bin "$@" x=1 "$@"
+		test test cd -eu -eu then
+'quoted text' | /usr/bin sed /usr/bin x=1 ${HOME} 2>/dev/null
+		--verbose grep printf /usr/bin -eu -eu | /usr/bin done 2>/dev/null 2>/dev/null
+	"$@" 'quoted text' | "$@" /usr/bin -eu && awk cd 2>/dev/null && local "$1" /usr/bin
+'quoted text' && --verbose awk x=1 local sed && readonly cd
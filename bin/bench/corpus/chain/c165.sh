@@ -0,0 +1,2001 @@
+		grep local awk printf $(pwd)
+	${HOME} $(pwd) sed "$@" grep
+awk sed then 2>/dev/null --verbose 2>/dev/null readonly awk done readonly && readonly
+"$@" x=1 echo "$@" 2>/dev/null --verbose done readonly done --verbose | "$@"
+		then then readonly awk 2>/dev/null
+sed awk readonly test then 'quoted text' sed printf local $(pwd)
+	${HOME} -eu echo export awk echo done readonly "$@" echo readonly
+echo 'quoted text' --verbose
+		-eu x=1 done export test done grep && "$@" && /usr/bin test test | then
+		&& $(pwd) grep 'quoted text' printf | grep ${HOME}
+	'quoted text' local $(pwd) /usr/bin "$@"
+	awk ${HOME} $(pwd) local echo readonly ${HOME} test |
+	$(pwd) readonly done x=1 sed local 2>/dev/null
+		--verbose local /usr/bin && "$@" "$@" done awk "$@" ${HOME}
+	then "$@" sed then | "$@" grep
+		&& local "$1" cd 2>/dev/null then cd 'quoted text'
+		--verbose | printf 'quoted text'
+		then "$@" awk echo | grep -eu "$@" readonly 2>/dev/null printf $(pwd)
+		'quoted text' then 'quoted text' ${HOME}
+done /usr/bin x=1 local -eu echo "$1" && test test ${HOME} test
+	grep ${HOME} $(pwd) printf | test done echo sed printf export local awk
+		/usr/bin echo 2>/dev/null 2>/dev/null
+	then && echo 'quoted text' && then export $(pwd) && readonly
+		test --verbose 2>/dev/null x=1 local local -eu local awk 'quoted text'
+-eu ${HOME} test --verbose
+&& x=1 | readonly export local done 'quoted text' printf "$1" echo
+	grep --verbose test test "$1" $(pwd) echo done export echo grep echo readonly
+		x=1 ${HOME} x=1 local 2>/dev/null echo echo local x=1 "$1" ${HOME} /usr/bin printf
+	$(pwd) /usr/bin -eu then readonly && grep echo
+		readonly 2>/dev/null 2>/dev/null && test
+/usr/bin printf echo ${HOME}
+	test test printf sed ${HOME} sed "$@" sed
+		awk local 'quoted text' $(pwd) ${HOME} ${HOME} readonly
+${HOME} /usr/bin local printf && local $(pwd) local export
+	cd export cd test echo echo | sed | export sed --verbose "$@" echo
+2>/dev/null && 2>/dev/null then test local echo 2>/dev/null
+	awk x=1 -eu local 2>/dev/null done then cd cd /usr/bin
+		$(pwd) sed "$1" local printf readonly
+	/usr/bin 'quoted text' grep $(pwd)
+	'quoted text' then local
+		test cd ${HOME} test readonly done
+'quoted text' then 'quoted text' "$1" printf local cd echo
+awk | grep ${HOME} x=1 | grep | printf | 'quoted text' x=1 grep x=1 printf sed
+"$1" done 2>/dev/null -eu 2>/dev/null "$1"
+	printf sed then readonly && local ${HOME} cd echo then x=1 2>/dev/null
+		-eu --verbose awk ${HOME} awk /usr/bin export sed echo && "$1"
+	| | test test awk echo "$1" test ${HOME} export export 2>/dev/null
+		done export then -eu 'quoted text' cd
+awk echo && local local sed cd "$1" $(pwd) local cd 2>/dev/null
+sed x=1 then grep printf --verbose grep then cd $(pwd) 'quoted text' echo
+	x=1 local echo readonly awk then && awk awk grep 2>/dev/null cd readonly
+x=1 "$@" | 'quoted text' grep --verbose done $(pwd) test export sed 'quoted text'
+x=1 printf readonly then done | -eu readonly --verbose
+		"$@" && awk ${HOME} /usr/bin cd cd "$@" "$1" awk export ${HOME} "$@" grep
+	awk export awk sed then /usr/bin "$1" -eu grep /usr/bin export local
+		test -eu grep readonly x=1 grep --verbose 'quoted text' /usr/bin awk -eu ${HOME}
+		sed "$1" grep sed --verbose local "$1" --verbose local $(pwd) --verbose
+	local "$@" "$1" /usr/bin export ${HOME}
+	"$@" awk /usr/bin --verbose
+	${HOME} done 'quoted text' grep
+	${HOME} /usr/bin sed --verbose --verbose "$1" ${HOME} && 2>/dev/null $(pwd)
+		"$1" 2>/dev/null ${HOME} && | sed
+		readonly export echo x=1 grep | awk printf export && echo 2>/dev/null
+	local awk 2>/dev/null readonly x=1 awk ${HOME} grep echo export /usr/bin --verbose
+		printf grep sed printf | 2>/dev/null ${HOME} awk -eu export cd x=1 | /usr/bin
+		"$@" --verbose export -eu cd /usr/bin awk printf cd /usr/bin export
+		grep /usr/bin local | | then
+		2>/dev/null done grep -eu local "$@" grep | ${HOME} x=1 local 2>/dev/null
+		local export then && $(pwd) | test
+	awk cd x=1 --verbose --verbose test readonly
+		printf grep -eu x=1 grep 'quoted text' "$1" /usr/bin
+		echo readonly 2>/dev/null test awk ${HOME} readonly printf readonly export
+		${HOME} grep "$1" /usr/bin x=1 awk awk 2>/dev/null
+export -eu grep 2>/dev/null cd --verbose
+$(pwd) ${HOME} awk && test /usr/bin export local grep awk && 'quoted text'
+	done "$1" && "$@" -eu sed readonly --verbose then --verbose export ${HOME}
+done | | printf 2>/dev/null
+	sed printf -eu --verbose cd done && echo echo && -eu done export
+	sed readonly printf -eu grep $(pwd) printf grep local 2>/dev/null
+		${HOME} cd sed x=1 /usr/bin readonly test "$1" export export
+		cd /usr/bin | done -eu x=1 /usr/bin x=1 && && -eu
+-eu 2>/dev/null cd /usr/bin x=1 test done export export cd test "$1" "$@" -eu |
+		echo cd 'quoted text' x=1 |
+		local test local cd export export test grep -eu test export
+	echo done ${HOME} --verbose test export
+		'quoted text' sed | printf then ${HOME}
+$(pwd) && echo | export ${HOME} x=1 && "$1" grep -eu "$@" local /usr/bin test
+"$1" ${HOME} echo -eu local done test then export readonly printf | "$1" echo
+		then x=1 then --verbose awk "$1" then $(pwd) readonly x=1 /usr/bin readonly
+		sed printf then $(pwd) export sed awk
+	then export 'quoted text' awk
+	echo && | "$@" echo export /usr/bin test sed awk readonly local then "$1"
+2>/dev/null export local 'quoted text' readonly readonly | $(pwd)
+		2>/dev/null readonly && | grep
+printf "$@" local 'quoted text' --verbose
+		then $(pwd) x=1 "$@" x=1 "$@" -eu $(pwd) echo sed export $(pwd)
+"$@" | $(pwd) "$1" echo -eu export awk printf test "$@" local ${HOME}
+	${HOME} x=1 ${HOME} 'quoted text' export done -eu 2>/dev/null 2>/dev/null && 'quoted text'
+local awk -eu sed --verbose echo then $(pwd) export
+'quoted text' test sed
+	local -eu && ${HOME} sed x=1 "$1" | --verbose $(pwd) "$@" ${HOME} "$@"
+		then --verbose printf grep then 'quoted text'
+	$(pwd) "$1" echo sed "$@" then test local grep -eu printf echo sed 2>/dev/null
+	done 'quoted text' ${HOME} sed grep -eu cd -eu cd "$@" | local "$@"
+		$(pwd) "$1" readonly local ${HOME} printf done awk awk $(pwd) "$@" | "$1"
+		done local | --verbose "$@" | 2>/dev/null && &&
+test echo then x=1 local && /usr/bin 2>/dev/null sed
+'quoted text' "$@" $(pwd) test done | echo export awk cd ${HOME} readonly
+	done "$1" "$@" done then
+		echo awk $(pwd) then echo printf done
+		| then 'quoted text' sed | --verbose --verbose
+		"$1" ${HOME} /usr/bin "$@" printf 'quoted text' printf
+		'quoted text' printf cd 2>/dev/null
+readonly 'quoted text' $(pwd) then sed awk
+		/usr/bin ${HOME} 2>/dev/null awk cd | && $(pwd) awk printf
+		/usr/bin then then test test printf | | 2>/dev/null
+		readonly echo done grep export
+		sed | 'quoted text' grep then "$@" sed 'quoted text'
+'quoted text' printf -eu echo | printf printf sed sed printf --verbose
+	$(pwd) 'quoted text' 'quoted text' test test ${HOME}
+	$(pwd) local echo awk readonly 'quoted text' "$1" "$1" 'quoted text' awk 'quoted text'
+| readonly done awk then && "$@" && cd /usr/bin sed
+		$(pwd) ${HOME} "$@" $(pwd) printf && export ${HOME} 2>/dev/null $(pwd) grep
+	${HOME} 'quoted text' local then 2>/dev/null "$1" awk 2>/dev/null sed awk readonly
+		awk printf "$1" && sed -eu 2>/dev/null
+local local -eu cd echo done grep awk cd export $(pwd) done | export sed x=1 -eu
+	-eu --verbose 'quoted text' local && | echo sed cd grep --verbose && 'quoted text'
+test then then 2>/dev/null
+	sed ${HOME} ${HOME} printf "$1" grep cd
+2>/dev/null readonly $(pwd) done 'quoted text' export x=1 echo
+export "$@" x=1 "$@" /usr/bin --verbose
+	| export ${HOME} --verbose cd x=1 readonly $(pwd) "$@" printf x=1 ${HOME} echo
+--verbose 'quoted text' x=1 readonly readonly done awk ${HOME} --verbose
+		'quoted text' done local cd done x=1
+	"$@" cd ${HOME} echo export $(pwd) test echo export x=1 2>/dev/null
+	$(pwd) $(pwd) export sed sed export done then sed /usr/bin 'quoted text'
+		test echo --verbose local then test grep test printf 2>/dev/null $(pwd) cd "$1"
+awk "$1" then echo printf export 'quoted text' local
+echo test sed ${HOME} x=1 ${HOME} -eu -eu test done 'quoted text'
+	&& "$1" echo then "$1" "$1" && grep --verbose
+cd "$1" readonly grep $(pwd) printf 2>/dev/null -eu $(pwd) export then
+	local sed x=1 test "$1" sed $(pwd) awk -eu test 2>/dev/null -eu | "$1" done
+		grep then ${HOME} 2>/dev/null x=1 && readonly
+	grep "$1" $(pwd) -eu echo printf printf ${HOME} /usr/bin
+--verbose ${HOME} $(pwd) readonly 'quoted text' x=1 && sed x=1 'quoted text'
+		awk $(pwd) done 'quoted text' done test --verbose test done readonly
+	"$@" | x=1 echo ${HOME}
+	readonly 'quoted text' printf -eu 2>/dev/null done awk 2>/dev/null
+		'quoted text' /usr/bin export "$1" cd done test "$@" cd export 2>/dev/null
+		sed /usr/bin /usr/bin awk then export /usr/bin then cd && awk
+		local printf -eu | -eu done grep "$@" awk then printf cd ${HOME}
+$(pwd) cd "$@" printf grep
+		export then 'quoted text'
+		/usr/bin done 2>/dev/null done 'quoted text'
+		done x=1 awk $(pwd) sed | ${HOME} ${HOME} readonly echo grep
+		done awk x=1 "$@" grep sed done
+		done export cd local
+	$(pwd) /usr/bin 'quoted text' --verbose readonly
+-eu local "$@" test readonly
+		x=1 'quoted text' export
+		"$@" awk printf ${HOME}
+		then $(pwd) then "$@" grep done "$@" echo test &&
+awk local grep readonly && export export /usr/bin --verbose --verbose
+	printf cd echo export && cd echo -eu ${HOME} /usr/bin printf ${HOME}
+	export done "$1" sed sed then printf
+"$@" cd echo readonly echo x=1 "$1" /usr/bin $(pwd) export test awk
+| ${HOME} $(pwd) printf
+export cd ${HOME} -eu 'quoted text' export printf test readonly "$@" "$@"
+		cd awk sed | grep test test ${HOME}
+	--verbose $(pwd) echo test local sed $(pwd) export then | 'quoted text'
+	&& then echo 'quoted text' sed ${HOME} && x=1
+	&& export --verbose "$@"
+		| grep echo 2>/dev/null /usr/bin -eu then cd 2>/dev/null local readonly grep
+grep | cd test readonly 'quoted text' --verbose
+"$1" awk -eu export grep sed 2>/dev/null echo printf test 2>/dev/null
+-eu local "$1" ${HOME} "$@" ${HOME} readonly
+		echo "$1" ${HOME} awk echo x=1 done printf echo | local then -eu
+	cd x=1 echo "$@" | $(pwd) awk sed then local
+	printf awk "$@" readonly -eu ${HOME} cd export cd "$1" 2>/dev/null
+local ${HOME} printf done && x=1 echo && x=1 printf $(pwd) --verbose
+		${HOME} awk test 'quoted text' 'quoted text' grep $(pwd) cd -eu ${HOME} -eu
+done done readonly readonly readonly grep -eu then --verbose
+	&& | 'quoted text' cd -eu local printf $(pwd)
+		x=1 x=1 /usr/bin cd cd done
+cd cd x=1 "$@" 'quoted text' test x=1 --verbose local "$1"
+		--verbose test "$@" && grep local awk
+grep && done -eu sed $(pwd) && echo $(pwd) --verbose | "$@" grep
+		/usr/bin sed x=1 $(pwd) /usr/bin local sed /usr/bin ${HOME} -eu "$1"
+	export "$@" done cd && printf then x=1 "$@"
+	${HOME} 2>/dev/null x=1 && $(pwd) $(pwd) echo printf
+		2>/dev/null readonly $(pwd) awk grep grep
+		done 'quoted text' done $(pwd) echo x=1 /usr/bin test
+		| "$1" "$1" 2>/dev/null readonly then done
+$(pwd) cd "$1" export local done grep printf "$1"
+| | grep test && "$1" awk local
+		"$1" | -eu "$1" /usr/bin cd $(pwd)
+		readonly --verbose awk --verbose export then $(pwd) cd $(pwd)
+		sed 2>/dev/null awk done --verbose --verbose
+	&& grep then -eu "$@" readonly 2>/dev/null
+--verbose grep --verbose then sed sed grep done done cd $(pwd)
+		done "$1" then done then
+	readonly | printf x=1 | printf
+		cd sed /usr/bin -eu -eu && sed then | /usr/bin /usr/bin
+	grep 'quoted text' -eu x=1 done echo 2>/dev/null ${HOME} cd 2>/dev/null
+done done -eu local 2>/dev/null then readonly "$1" $(pwd) -eu | -eu | echo
+	done sed x=1 /usr/bin -eu echo $(pwd)
+"$@" echo printf awk sed 'quoted text' done "$@" done $(pwd) readonly
+		"$1" echo sed echo cd readonly test /usr/bin
+	sed local grep "$1" 'quoted text' awk /usr/bin | x=1 &&
+	printf then printf --verbose $(pwd) awk "$1" cd then sed cd test -eu "$1"
+x=1 | done -eu "$@" then export printf printf readonly echo
+	'quoted text' | "$1" test 'quoted text' x=1 'quoted text' $(pwd)
+		"$@" /usr/bin awk done sed /usr/bin "$@" readonly local then test
+	cd sed then "$@" done $(pwd)
+2>/dev/null /usr/bin echo readonly echo then cd /usr/bin echo echo ${HOME}
+	'quoted text' --verbose done sed cd $(pwd) echo x=1 echo grep /usr/bin ${HOME}
+"$@" x=1 cd then readonly $(pwd) then printf --verbose
+		cd 'quoted text' done $(pwd) test local cd "$1" readonly awk 'quoted text' |
+local | ${HOME} grep awk && | 'quoted text' -eu ${HOME} then
+	then awk /usr/bin "$1" | && -eu local cd -eu "$@" sed "$1" test export
+&& then echo 'quoted text' | sed test readonly --verbose cd cd awk
+		awk $(pwd) && awk 'quoted text'
+&& "$1" printf $(pwd) grep export cd grep
+x=1 --verbose 'quoted text' ${HOME} "$@" "$1" local echo --verbose
+		"$1" | grep -eu 'quoted text' done echo 'quoted text' 2>/dev/null
+$(pwd) done echo then 'quoted text'
+	x=1 ${HOME} x=1 cd test 'quoted text' grep readonly
+then | 2>/dev/null readonly
+	--verbose then readonly | "$@" ${HOME} && &&
+cd $(pwd) printf echo cd readonly | 'quoted text' grep
+		sed 2>/dev/null readonly 2>/dev/null | && printf cd export readonly
+grep $(pwd) --verbose printf -eu printf awk export
+	done | | readonly 'quoted text' /usr/bin 2>/dev/null echo done "$@"
+		sed x=1 2>/dev/null local ${HOME} done | grep x=1 local
+	x=1 then x=1 grep x=1
+sed 'quoted text' x=1 export grep done cd "$1" x=1 sed /usr/bin then /usr/bin
+${HOME} x=1 | sed "$1" && sed cd | sed | 2>/dev/null sed -eu test test printf
+		"$@" x=1 -eu 'quoted text' 2>/dev/null readonly | local -eu x=1 test
+	2>/dev/null "$@" awk echo 'quoted text' test 'quoted text' export awk sed test
+| $(pwd) "$@" | done sed && cd "$@" 'quoted text'
+export grep $(pwd) awk /usr/bin export then cd
+		cd --verbose done | "$1" && --verbose
+		readonly "$@" $(pwd) export echo --verbose | "$1" then --verbose 'quoted text'
+	--verbose cd "$@" test local
+	${HOME} done $(pwd) "$@" -eu printf
+		&& $(pwd) sed printf -eu test awk printf "$1" x=1
+	readonly | --verbose sed echo "$@" grep grep $(pwd) done done "$@" awk then $(pwd)
+	sed grep echo awk /usr/bin ${HOME} "$@" x=1 -eu
+"$@" echo awk ${HOME} && local --verbose --verbose --verbose
+		printf cd sed -eu done $(pwd)
+		'quoted text' test awk awk "$1" "$@"
+		2>/dev/null done then then then cd cd export test local $(pwd) test
+test done test 2>/dev/null done awk then readonly 2>/dev/null export done
+		"$@" local done export "$1" $(pwd) export
+		"$@" --verbose echo "$@" --verbose local done | then echo
+		$(pwd) "$1" grep ${HOME} cd
+grep "$1" export sed "$1" && local cd echo printf then && | awk printf
+		/usr/bin -eu | 2>/dev/null $(pwd) test cd -eu --verbose ${HOME}
+-eu | printf local | done -eu echo "$@" printf && echo x=1 awk local x=1 awk export
+		then export -eu printf ${HOME} grep x=1
+		test -eu | 2>/dev/null echo test 'quoted text' | -eu 'quoted text' done cd
+	echo x=1 done test && ${HOME}
+		sed awk "$1" sed -eu export printf awk readonly cd ${HOME}
+then /usr/bin ${HOME} "$@" readonly then echo test ${HOME} $(pwd)
+	sed x=1 sed $(pwd) $(pwd) test echo 'quoted text' "$@" ${HOME}
+	${HOME} done export /usr/bin 'quoted text'
+		$(pwd) /usr/bin "$@" "$1" local 'quoted text' done awk ${HOME} -eu --verbose
+	$(pwd) 'quoted text' then sed grep sed test 2>/dev/null export local
+		export --verbose local export /usr/bin awk
+		cd readonly then readonly ${HOME} 'quoted text' sed /usr/bin readonly
+		cd && $(pwd) done 2>/dev/null 'quoted text' "$@" && printf --verbose 2>/dev/null
+$(pwd) "$@" -eu sed grep export
+| -eu printf --verbose echo echo grep "$@" test then $(pwd) local
+	done done /usr/bin echo printf x=1 -eu /usr/bin sed then /usr/bin x=1
+grep export grep --verbose readonly printf export $(pwd) cd
+		$(pwd) grep test readonly then && test 2>/dev/null
+&& export readonly done && x=1 'quoted text'
+	grep "$@" $(pwd) -eu x=1 2>/dev/null sed -eu echo awk "$1"
+$(pwd) x=1 readonly printf 2>/dev/null
+	x=1 && --verbose echo readonly "$1" x=1 readonly readonly "$@"
+then && x=1 cd x=1 done $(pwd) then local 'quoted text'
+-eu "$@" 2>/dev/null sed cd $(pwd) 'quoted text' printf printf "$@" printf
+then ${HOME} awk readonly "$1" echo 'quoted text'
+	local test "$@" | cd grep "$1" 2>/dev/null
+	export $(pwd) x=1 export 2>/dev/null
+	then then local 2>/dev/null --verbose
+x=1 "$1" $(pwd) awk 'quoted text' then "$@"
+		$(pwd) 2>/dev/null /usr/bin && && $(pwd) awk export $(pwd) && done 'quoted text'
+2>/dev/null x=1 "$@" ${HOME} 2>/dev/null grep -eu ${HOME}
+		${HOME} "$1" | "$1" local export | "$@" echo local "$@"
+		${HOME} local 2>/dev/null | then echo
+local awk 2>/dev/null -eu -eu printf x=1 then
+	-eu readonly x=1 done 2>/dev/null 2>/dev/null
+		&& "$@" echo echo local sed readonly
+		${HOME} cd grep && x=1 export echo -eu && "$@" | local $(pwd)
+local printf test && cd awk $(pwd) sed echo test test -eu --verbose ${HOME}
+'quoted text' grep "$@"
+	-eu | ${HOME} grep readonly printf && $(pwd) awk -eu -eu x=1 printf
+		/usr/bin sed then /usr/bin printf grep awk x=1 x=1 --verbose
+${HOME} 'quoted text' printf -eu local -eu | export echo -eu -eu local test awk
+test 'quoted text' --verbose local 2>/dev/null awk 2>/dev/null
+-eu done local grep export "$1" sed
+		| 2>/dev/null grep 'quoted text'
+"$@" grep done readonly && cd | 2>/dev/null
+	then export $(pwd) grep |
+		cd awk readonly "$1" awk local --verbose readonly
+	then 'quoted text' readonly export local export x=1 test
+		export && --verbose 2>/dev/null
+'quoted text' x=1 2>/dev/null cd local | "$1" printf --verbose
+		local --verbose local
+done echo awk done $(pwd) echo 2>/dev/null cd && ${HOME}
+		"$@" test $(pwd) done --verbose -eu | then x=1 | --verbose sed /usr/bin
+		/usr/bin ${HOME} sed printf echo /usr/bin local readonly $(pwd) && then
+		| test echo && grep local
+test "$@" && test /usr/bin x=1 "$@" && 2>/dev/null
+	$(pwd) export x=1 then grep
+		--verbose done awk -eu then then && "$1" ${HOME} done
+-eu x=1 $(pwd) printf local --verbose "$1" | ${HOME} readonly done
+	echo then then local done done export -eu export
+	printf export grep sed test $(pwd)
+sed "$1" x=1 "$1" echo "$@" done done printf test printf
+'quoted text' --verbose done
+readonly 2>/dev/null && sed awk && printf /usr/bin grep printf
+		echo "$@" "$@" && echo echo "$1" "$1" export
+test readonly 'quoted text' grep grep $(pwd) ${HOME} export then grep -eu
+/usr/bin done then grep export readonly cd printf "$1"
+		--verbose done -eu awk && awk export -eu /usr/bin 'quoted text'
+	done readonly readonly x=1 printf 2>/dev/null echo local export sed grep | "$@"
+${HOME} | export awk printf readonly /usr/bin -eu x=1 /usr/bin /usr/bin 'quoted text'
+2>/dev/null 2>/dev/null | local local test && x=1 'quoted text' test
+	x=1 'quoted text' && "$@" x=1 && 2>/dev/null test
+"$1" test printf 2>/dev/null
+	${HOME} | then sed x=1 ${HOME} x=1 then local awk "$1" local local $(pwd) 2>/dev/null
+		"$1" grep cd 'quoted text' sed x=1 -eu echo cd "$@" x=1 test
+done echo x=1 | /usr/bin | --verbose
+	readonly "$1" printf 2>/dev/null 'quoted text' --verbose /usr/bin
+then awk readonly sed $(pwd) | --verbose then cd "$1"
+	readonly sed done test
+x=1 test done then readonly grep "$@"
+		echo && awk cd ${HOME} ${HOME} grep cd /usr/bin
+		cd ${HOME} | /usr/bin && 2>/dev/null
+	2>/dev/null readonly sed | ${HOME}
+/usr/bin cd "$@" then sed readonly sed test /usr/bin printf cd printf /usr/bin
+		${HOME} /usr/bin then --verbose
+	export echo 'quoted text' 2>/dev/null | awk x=1 sed 2>/dev/null
+/usr/bin 'quoted text' export
+	--verbose sed x=1 cd echo export local 'quoted text' local
+		&& | 2>/dev/null test | readonly sed ${HOME}
+"$1" readonly | local
+	cd test /usr/bin 'quoted text' && sed -eu | local done grep
+		$(pwd) --verbose readonly --verbose test "$@" $(pwd) --verbose
+	cd printf echo echo ${HOME}
+export 2>/dev/null grep echo -eu --verbose x=1 && done export |
+${HOME} $(pwd) awk local "$1" | then 'quoted text'
+sed 'quoted text' "$1" && --verbose /usr/bin sed && sed sed 'quoted text' ${HOME}
+		awk done x=1 sed test "$@" /usr/bin then x=1 2>/dev/null
+	&& --verbose sed sed cd export echo then
+awk readonly export x=1 "$@" sed
+-eu awk then echo printf cd export cd cd -eu 2>/dev/null
+	"$1" local readonly local "$@" "$@" 2>/dev/null
+		readonly cd cd printf | "$@" ${HOME} -eu printf /usr/bin awk
+		${HOME} sed -eu 'quoted text' x=1 --verbose x=1 local done test awk
+	sed /usr/bin 'quoted text' $(pwd) readonly cd --verbose
+		awk 2>/dev/null $(pwd) /usr/bin printf && ${HOME} "$1" sed awk 2>/dev/null
+	local then sed && grep $(pwd) 2>/dev/null --verbose --verbose printf
+	'quoted text' test ${HOME} /usr/bin -eu awk $(pwd) done /usr/bin awk 'quoted text'
+grep /usr/bin readonly test cd echo --verbose
+	$(pwd) then then printf echo 2>/dev/null "$@" readonly
+awk "$@" then $(pwd) test | x=1 x=1 -eu done
+		then --verbose && ${HOME} /usr/bin /usr/bin |
+"$@" /usr/bin done local test --verbose -eu
+		-eu export ${HOME} -eu test ${HOME} "$@" | && then 'quoted text'
+"$@" done x=1 grep test awk awk grep local echo awk x=1 cd 2>/dev/null done
+sed grep && | x=1 awk 2>/dev/null 2>/dev/null local cd | x=1 done && awk 'quoted text'
+		--verbose then | -eu $(pwd) echo sed
+	cd | | sed awk export done sed echo
+	done done export && sed awk
+	2>/dev/null ${HOME} test readonly $(pwd) local cd 'quoted text' 'quoted text'
+		-eu grep ${HOME} 2>/dev/null --verbose readonly "$@" ${HOME} test grep
+	x=1 -eu x=1 --verbose grep cd $(pwd) printf --verbose -eu test 'quoted text'
+	local ${HOME} export local /usr/bin
+		$(pwd) then 'quoted text' sed printf "$1" readonly export sed done x=1 printf
+		--verbose ${HOME} | printf test x=1 --verbose | echo
+	test test "$1" --verbose 'quoted text'
+	printf printf ${HOME} grep cd $(pwd) test sed && /usr/bin "$@"
+then && sed ${HOME} printf && | "$1" cd done
+	x=1 -eu echo printf printf 'quoted text' "$@" test 'quoted text' then
+		| then -eu $(pwd) && test x=1 then cd && /usr/bin && "$1" test x=1
+&& export done echo && echo
+	test 'quoted text' -eu /usr/bin ${HOME} cd sed done grep && sed export -eu echo
+	then export 2>/dev/null 'quoted text'
+	&& echo $(pwd) cd "$1" readonly echo readonly /usr/bin -eu
+		'quoted text' --verbose /usr/bin local 2>/dev/null
+x=1 printf "$@" 2>/dev/null &&
+local $(pwd) | --verbose 2>/dev/null grep sed --verbose
+		$(pwd) $(pwd) "$@" readonly | ${HOME}
+		/usr/bin sed readonly awk
+sed "$1" --verbose test
+		x=1 done "$@" x=1 /usr/bin "$@" x=1 export then 2>/dev/null cd -eu echo
+	local echo done printf cd then ${HOME} -eu export -eu
+$(pwd) export readonly /usr/bin
+		${HOME} then done awk export --verbose 'quoted text'
+export then export -eu --verbose readonly awk
+	printf $(pwd) echo done export && printf && then done 'quoted text' local --verbose
+		$(pwd) export then -eu "$@" 2>/dev/null ${HOME} cd | then
+"$@" 'quoted text' test printf cd sed 2>/dev/null
+"$@" "$@" && --verbose
+		"$1" done grep cd && echo cd cd printf then readonly && 2>/dev/null sed "$@" ${HOME}
+		cd 'quoted text' ${HOME} grep --verbose x=1 'quoted text'
+		export "$@" ${HOME} && done printf cd "$1" | $(pwd) && "$1"
+		'quoted text' "$@" 'quoted text' 'quoted text'
+2>/dev/null printf /usr/bin -eu done
+	awk readonly echo -eu printf done | "$@"
+sed ${HOME} | awk x=1 x=1 'quoted text'
+'quoted text' cd test grep
+sed awk done | ${HOME} 2>/dev/null
+		-eu then sed echo --verbose /usr/bin then test 2>/dev/null 'quoted text'
+--verbose sed $(pwd) readonly "$1" test -eu export ${HOME} && -eu 2>/dev/null
+grep -eu readonly export | awk "$@"
+local --verbose grep test done readonly
+	${HOME} echo export done grep && 2>/dev/null readonly $(pwd)
+		-eu 2>/dev/null printf /usr/bin export 'quoted text'
+	"$@" x=1 test done /usr/bin | && export --verbose "$1" printf |
+	echo export awk test && readonly 'quoted text'
+"$1" --verbose awk sed ${HOME} 2>/dev/null
+	2>/dev/null -eu --verbose | 'quoted text' x=1 readonly readonly x=1 grep $(pwd)
+	then x=1 && && sed -eu readonly
+	grep "$@" then grep printf export 2>/dev/null $(pwd) -eu
+		$(pwd) /usr/bin "$1" 2>/dev/null local | local && -eu
+&& awk ${HOME} grep 2>/dev/null -eu local export readonly
+/usr/bin | /usr/bin then printf grep 2>/dev/null "$1" x=1 test ${HOME} --verbose
+	sed then && cd then /usr/bin local --verbose awk local
+done $(pwd) $(pwd) && cd
+x=1 then /usr/bin | | echo echo --verbose awk
+		grep | then cd | /usr/bin grep export "$1" awk readonly x=1
+		$(pwd) --verbose printf awk --verbose grep x=1 then test 'quoted text' | ${HOME}
+2>/dev/null x=1 grep grep local -eu grep --verbose
+then /usr/bin sed export
+		cd --verbose "$1" ${HOME} sed cd done grep done | "$@" 'quoted text' 2>/dev/null
+$(pwd) echo -eu readonly local done $(pwd) cd "$@"
+		--verbose done /usr/bin printf test ${HOME}
+2>/dev/null sed sed | | x=1 x=1 grep 'quoted text'
+x=1 grep && then | test printf 'quoted text'
+/usr/bin then echo && export 'quoted text' 'quoted text' -eu $(pwd) &&
+	/usr/bin "$@" "$1" printf export echo "$1" 'quoted text' sed
+	x=1 grep test readonly local
+export | /usr/bin && 'quoted text' && | readonly export export export | echo
+	test cd export -eu grep 2>/dev/null -eu echo done sed awk export /usr/bin
+'quoted text' -eu readonly local readonly then | sed local then cd "$@"
+		export ${HOME} awk /usr/bin "$1" 2>/dev/null grep
+$(pwd) ${HOME} $(pwd) x=1 && x=1 "$1" printf awk local --verbose
+-eu cd x=1 'quoted text' awk 2>/dev/null
+	grep grep x=1 grep cd /usr/bin
+	cd readonly export "$1" x=1 /usr/bin 2>/dev/null
+		cd readonly test x=1 awk cd awk test ${HOME} echo
+| | printf --verbose && /usr/bin 2>/dev/null
+printf sed --verbose -eu --verbose sed "$@" readonly grep
+		&& grep readonly | x=1 cd 'quoted text' -eu && test local cd ${HOME} --verbose
+	$(pwd) --verbose awk
+then && 'quoted text' 2>/dev/null test readonly printf
+"$1" ${HOME} sed awk "$@" --verbose then
+	grep --verbose --verbose $(pwd) | --verbose /usr/bin $(pwd)
+printf echo echo 2>/dev/null then readonly
+export && grep ${HOME} 'quoted text' local awk grep export
+	--verbose ${HOME} "$@" ${HOME}
+readonly grep echo $(pwd) echo && readonly echo done ${HOME} "$@" 2>/dev/null
+	-eu local cd $(pwd) printf $(pwd) 2>/dev/null local "$@" 'quoted text'
+'quoted text' -eu | awk --verbose
+		export "$1" ${HOME} sed --verbose ${HOME}
+	-eu then -eu "$@" && readonly
+	-eu echo done $(pwd) -eu --verbose export $(pwd)
+		cd test $(pwd) done local grep echo awk awk 'quoted text'
+	awk grep /usr/bin cd sed export
+	2>/dev/null local awk then -eu $(pwd) done "$1" 'quoted text'
+done local "$@" export readonly
+	local "$1" readonly "$1" --verbose grep echo /usr/bin 2>/dev/null 'quoted text'
+	--verbose grep readonly "$@" $(pwd) cd awk local done local "$1" then -eu $(pwd)
+sed echo done grep sed $(pwd) | "$1" test /usr/bin done 2>/dev/null test awk grep
+| export printf then printf x=1 "$@" echo "$@" "$@" test done test -eu "$@"
+test 2>/dev/null $(pwd)
+		printf /usr/bin then sed 'quoted text' then cd | echo
+grep printf cd test sed ${HOME} sed "$@" then awk 2>/dev/null then -eu
+	$(pwd) test "$1" awk | export sed /usr/bin done 2>/dev/null
+		x=1 "$1" -eu | export 'quoted text' x=1 grep ${HOME} cd
+		echo then then readonly /usr/bin awk ${HOME}
+export export $(pwd) printf
+		$(pwd) grep echo cd "$1" done echo readonly "$@" -eu sed cd
+	2>/dev/null readonly awk /usr/bin sed "$1" grep grep /usr/bin echo export
+x=1 | test test awk ${HOME} grep
+export local sed -eu then
+cd cd then echo done x=1 2>/dev/null "$1" "$@" awk then "$@" "$@"
+| "$@" test && ${HOME} local --verbose ${HOME}
+		awk 2>/dev/null grep sed -eu test 2>/dev/null grep
+	awk $(pwd) cd /usr/bin echo cd grep export then echo readonly
+		/usr/bin done done echo $(pwd) test /usr/bin awk readonly echo sed 2>/dev/null
+		local --verbose grep 'quoted text' $(pwd) then cd && "$@"
+awk cd /usr/bin "$@" grep "$1" x=1 -eu readonly
+	readonly x=1 sed "$1" "$@" done && && "$1" test "$@" cd export ${HOME} $(pwd)
+		--verbose grep echo x=1
+done readonly printf && --verbose printf sed echo readonly
+		printf sed awk grep --verbose export done | local readonly ${HOME} /usr/bin
+| grep printf echo && readonly && | $(pwd)
+	grep -eu "$@" sed grep then | 2>/dev/null --verbose | ${HOME} awk grep export
+"$1" -eu then | && export awk test
+	sed done echo then grep && export echo local x=1 "$@"
+/usr/bin "$@" export --verbose
+	cd then export "$1" x=1 awk test printf done && "$1" | readonly export grep
+$(pwd) "$@" then $(pwd) printf grep readonly echo $(pwd) cd && awk local -eu
+	local $(pwd) echo ${HOME} cd printf
+	test local "$1" cd grep sed sed && done test ${HOME} 'quoted text' grep
+		export && awk ${HOME} /usr/bin export
+&& then && -eu 2>/dev/null x=1 $(pwd) x=1 2>/dev/null
+$(pwd) && done done x=1
+		-eu $(pwd) export 'quoted text' then then -eu local readonly local
+	${HOME} /usr/bin && awk test printf /usr/bin --verbose && grep awk
+		done | x=1 /usr/bin ${HOME} then | "$1" | $(pwd) x=1 /usr/bin ${HOME}
+		"$1" --verbose done $(pwd)
+	-eu export $(pwd) cd /usr/bin -eu | ${HOME} "$@"
+		awk /usr/bin --verbose 'quoted text' /usr/bin test test | $(pwd)
+$(pwd) x=1 test awk "$1" test "$@" ${HOME} && --verbose cd $(pwd) cd
+	-eu ${HOME} 'quoted text' "$1" sed
+	-eu -eu ${HOME} && $(pwd)
+local printf -eu "$1"
+		printf export echo "$@" awk $(pwd) done ${HOME} cd $(pwd) ${HOME} awk readonly printf
+	-eu printf sed local ${HOME} 'quoted text' -eu grep x=1 "$@"
+		$(pwd) $(pwd) /usr/bin $(pwd)
+done "$1" ${HOME} sed
+sed export /usr/bin sed x=1 ${HOME} /usr/bin "$@"
+${HOME} && cd test echo -eu awk local test done export --verbose "$1"
+		&& awk 'quoted text' 2>/dev/null export sed
+	--verbose --verbose -eu 'quoted text' ${HOME} test local --verbose ${HOME}
+printf export "$1" $(pwd) | awk "$@" x=1
+	"$@" echo readonly then /usr/bin
+		local "$1" then test $(pwd) export cd
+echo /usr/bin -eu -eu cd --verbose readonly
+		grep "$1" echo awk awk awk printf then "$@" grep local --verbose
+	grep -eu test grep cd printf
+&& | $(pwd) x=1 "$@" | "$1" $(pwd) local --verbose local
+	sed printf "$@" test --verbose then
+"$1" -eu readonly 'quoted text' $(pwd) x=1 export grep x=1 "$@" $(pwd)
+x=1 x=1 ${HOME} ${HOME} | test x=1 sed echo -eu cd export
+then then then readonly export "$1" --verbose cd echo done printf echo done
+	local export && 'quoted text' local ${HOME}
+	echo ${HOME} cd -eu then "$1" --verbose grep cd done 'quoted text' 'quoted text'
+		"$1" grep sed cd ${HOME}
+		${HOME} "$@" ${HOME} "$@" /usr/bin printf
+	echo && | "$1" --verbose test local awk awk readonly $(pwd) | ${HOME} $(pwd) | awk
+		x=1 --verbose test $(pwd)
+		echo sed sed printf 'quoted text' "$1"
+	grep awk local 2>/dev/null printf echo test then sed --verbose x=1 $(pwd) awk
+		printf export ${HOME} -eu readonly 2>/dev/null then echo "$@" | echo done export
+	local --verbose then -eu "$1" readonly done done
+		-eu cd local --verbose 2>/dev/null
+"$1" && --verbose x=1 'quoted text' -eu readonly 2>/dev/null
+	done "$1" 2>/dev/null cd && -eu "$@" x=1 2>/dev/null $(pwd) cd printf
+	then export sed -eu |
+		awk && sed readonly printf x=1 ${HOME} test sed
+	"$@" echo /usr/bin then $(pwd) 2>/dev/null printf x=1 done
+--verbose grep 2>/dev/null -eu x=1 -eu then sed 'quoted text' awk -eu awk
+printf -eu done grep "$1" cd "$1" local
+	$(pwd) export local cd 'quoted text' readonly /usr/bin | /usr/bin | readonly
+		echo "$1" x=1 | "$1" echo $(pwd) | done && 'quoted text' && sed
+		'quoted text' /usr/bin 2>/dev/null
+		done 'quoted text' readonly
+printf 'quoted text' /usr/bin
+	grep awk && -eu export -eu awk cd /usr/bin --verbose done readonly /usr/bin
+x=1 cd then -eu local export $(pwd)
+local | /usr/bin done awk /usr/bin local 'quoted text' | | printf cd "$1" "$1"
+	| | -eu "$1" sed awk printf "$@"
+		-eu export printf "$@" && then cd sed 2>/dev/null
+"$@" echo sed | /usr/bin cd echo && cd -eu
+"$@" -eu 2>/dev/null 2>/dev/null readonly
+-eu --verbose awk awk done echo readonly local 2>/dev/null
+then then awk export cd readonly | cd $(pwd) --verbose sed then | printf grep
+		printf done done export /usr/bin grep && awk
+		cd --verbose && sed grep local
+		awk then awk ${HOME} test printf "$1" printf echo cd local
+		$(pwd) /usr/bin $(pwd) cd grep ${HOME} --verbose grep done
+	$(pwd) "$@" echo awk ${HOME} /usr/bin echo export export | 'quoted text' echo
+sed $(pwd) cd /usr/bin then done sed grep sed
+printf "$1" test --verbose x=1
+		$(pwd) done export 2>/dev/null $(pwd) sed $(pwd) ${HOME} x=1 'quoted text'
+"$1" "$@" "$1" grep 2>/dev/null $(pwd) "$1"
+	x=1 echo echo "$1" grep x=1 $(pwd) /usr/bin -eu export
+		$(pwd) sed echo --verbose x=1 /usr/bin grep cd --verbose -eu 2>/dev/null
+		"$@" printf --verbose local export test --verbose 2>/dev/null sed -eu | /usr/bin
+		printf "$1" $(pwd) readonly /usr/bin done
+echo "$1" echo readonly "$@" cd awk && x=1 "$@" 'quoted text' export
+		${HOME} echo printf 'quoted text' then readonly ${HOME} grep &&
+	/usr/bin sed grep -eu -eu local $(pwd) then export printf ${HOME} local $(pwd)
+cd --verbose cd "$1" "$1" sed --verbose
+	printf "$@" local then test readonly grep "$1" test | local
+	grep 2>/dev/null done /usr/bin sed sed printf
+done 2>/dev/null sed 'quoted text' sed readonly /usr/bin test awk readonly test
+done awk && echo ${HOME} /usr/bin cd readonly awk | echo
+	printf local && x=1 && cd printf 2>/dev/null printf
+		export 'quoted text' ${HOME} export test "$@" /usr/bin awk grep printf echo
+	then export printf then "$@" done
+sed /usr/bin done /usr/bin 2>/dev/null test readonly
+test test local "$@" --verbose | printf
+local /usr/bin /usr/bin sed sed cd cd echo readonly echo
+test grep /usr/bin "$@" x=1 2>/dev/null test ${HOME} ${HOME} local then $(pwd)
+printf "$@" done awk readonly
+	echo | | local -eu export -eu awk test readonly $(pwd) ${HOME} -eu
+		done grep x=1 x=1 cd ${HOME}
+	awk export 2>/dev/null printf /usr/bin
+		&& "$1" then "$1" echo grep
+		"$1" cd $(pwd) test --verbose
+awk x=1 readonly /usr/bin echo sed "$@" test
+	&& $(pwd) | echo /usr/bin test && 'quoted text'
+		${HOME} local grep x=1 sed x=1 ${HOME} grep export x=1 export sed && echo readonly
+	2>/dev/null | then grep then
+		export awk "$@" done x=1 'quoted text' x=1 test cd -eu test x=1 readonly
+		test export local /usr/bin /usr/bin export grep printf
+	export export printf cd grep cd export -eu ${HOME} sed && $(pwd) x=1 &&
+-eu export 'quoted text' 'quoted text'
+		printf echo "$1" | test ${HOME} x=1 ${HOME}
+		| x=1 | -eu awk echo -eu | "$@"
+	grep sed ${HOME} $(pwd) 2>/dev/null && printf 'quoted text' export
+		grep /usr/bin cd cd -eu local
+	--verbose 2>/dev/null export export --verbose then sed readonly "$@"
+		&& $(pwd) then -eu /usr/bin
+	printf printf "$@" sed 2>/dev/null done export /usr/bin "$@" echo
+		grep export "$@" test -eu 'quoted text' grep 'quoted text' echo
+sed export ${HOME} -eu local -eu 2>/dev/null x=1 echo
+	'quoted text' readonly then "$@" cd echo local cd readonly sed local 2>/dev/null
+	--verbose then local x=1 done "$1" cd echo
+then "$@" && $(pwd) readonly 'quoted text' readonly
+		done readonly "$1" awk then x=1 -eu grep ${HOME} $(pwd) test done local readonly
+grep 'quoted text' x=1 then
+		readonly "$@" ${HOME} local readonly awk 'quoted text'
+	local test done printf | then
+grep "$1" echo ${HOME} cd --verbose test echo ${HOME}
+$(pwd) done export then "$1" "$@" /usr/bin
+sed readonly "$1" "$@" 'quoted text' printf ${HOME} readonly echo sed $(pwd)
+test printf $(pwd) 2>/dev/null readonly then export /usr/bin
+	&& 'quoted text' local local local then
+	readonly grep export done test awk ${HOME} export echo readonly $(pwd)
+	then test readonly sed local export local "$1" -eu printf then x=1 export x=1
+	/usr/bin 'quoted text' --verbose readonly
+	export echo "$@" echo sed
+		-eu "$@" grep "$1" | echo cd local export -eu readonly
+	grep sed --verbose $(pwd) -eu ${HOME} done "$@" "$1"
+	then export ${HOME} ${HOME} $(pwd) 2>/dev/null x=1 x=1 && test readonly &&
+	echo /usr/bin && "$1" sed "$@" "$1" --verbose
+	echo done "$1" sed /usr/bin test grep
+	&& 2>/dev/null "$1" && printf /usr/bin ${HOME} then test
+	--verbose test export then | readonly printf 2>/dev/null ${HOME} $(pwd)
+grep echo "$@" $(pwd)
+	cd echo | sed test $(pwd) 'quoted text' "$@" "$@" ${HOME} --verbose 'quoted text'
+	awk "$1" done "$1" grep ${HOME}
+	$(pwd) x=1 test then $(pwd) ${HOME} -eu "$1" printf printf 2>/dev/null -eu grep
+		&& $(pwd) -eu echo /usr/bin --verbose export cd -eu /usr/bin
+		cd cd test 'quoted text' then
+	$(pwd) awk awk done echo local export x=1 $(pwd)
+	cd ${HOME} | grep "$@" echo sed ${HOME}
+readonly ${HOME} then sed then x=1 sed -eu "$1" local "$@"
+test awk /usr/bin grep test done ${HOME} printf --verbose sed x=1 export /usr/bin
+		done export /usr/bin --verbose cd x=1 printf done local
+	readonly /usr/bin printf 'quoted text' /usr/bin && --verbose -eu then sed 'quoted text'
+		local awk readonly cd ${HOME} printf | | x=1 "$1" "$1"
+export "$1" 2>/dev/null local cd && $(pwd) echo sed
+awk && 'quoted text' then then ${HOME}
+		$(pwd) "$1" echo "$1" local readonly -eu /usr/bin awk awk /usr/bin && x=1
+	--verbose $(pwd) echo 'quoted text' cd $(pwd) local --verbose "$@" x=1 done
+	"$1" test cd printf 2>/dev/null readonly grep $(pwd) sed readonly grep export
+cd awk 2>/dev/null export export cd grep "$@" | readonly "$1" cd && 2>/dev/null
+		-eu --verbose 'quoted text' x=1 "$@"
+		x=1 sed export echo && awk local && -eu "$1" export then /usr/bin awk then sed printf
+	readonly && "$1" ${HOME} 'quoted text' 2>/dev/null export
+	printf readonly cd -eu sed -eu --verbose cd grep 'quoted text'
+		${HOME} ${HOME} | awk
+	export -eu export ${HOME} awk 'quoted text'
+	test -eu -eu export 'quoted text'
+	$(pwd) && -eu 'quoted text' 2>/dev/null
+	test ${HOME} | export && | test 2>/dev/null
+		printf /usr/bin local grep printf
+		${HOME} grep awk then done
+	-eu /usr/bin --verbose done sed awk awk then cd $(pwd)
+	done -eu awk done cd "$1"
+	"$1" --verbose sed done x=1 sed "$1" printf readonly "$1" -eu
+'quoted text' && /usr/bin x=1 local done 2>/dev/null | sed export
+		awk test sed /usr/bin echo 'quoted text'
+		printf awk | done export readonly
+"$1" readonly "$1" done "$@" -eu $(pwd) done cd
+		echo printf --verbose && grep | grep "$1" awk $(pwd) "$@"
+	${HOME} --verbose cd | | x=1 2>/dev/null /usr/bin
+test 'quoted text' local "$@" x=1 --verbose -eu awk awk
+		'quoted text' "$1" | awk sed --verbose $(pwd) then echo $(pwd) && x=1
+	/usr/bin && cd local awk grep
+&& ${HOME} cd $(pwd) 2>/dev/null /usr/bin "$@" -eu local sed sed -eu ${HOME}
+		grep done export 2>/dev/null grep -eu ${HOME} grep grep 2>/dev/null
+		x=1 then cd sed export 2>/dev/null x=1 printf export
+readonly export x=1 --verbose test local readonly -eu cd -eu $(pwd) test
+		&& grep 'quoted text' done done "$1" echo /usr/bin 2>/dev/null grep done
+		2>/dev/null 'quoted text' -eu printf 2>/dev/null "$1" then readonly export
+	x=1 echo grep ${HOME} --verbose export /usr/bin
+	grep cd local printf | $(pwd) 'quoted text' sed -eu $(pwd) grep sed
+	$(pwd) 2>/dev/null -eu printf test ${HOME}
+	"$1" ${HOME} | export then grep -eu awk /usr/bin readonly readonly sed grep
+		"$@" cd sed done --verbose printf $(pwd) x=1 sed | grep x=1 --verbose | "$@"
+	--verbose awk echo test readonly grep /usr/bin
+readonly readonly "$@" readonly sed "$1" "$1" 2>/dev/null awk
+		test --verbose readonly readonly
+		printf 'quoted text' test awk sed
+		cd x=1 -eu done && sed grep "$1" test && cd -eu
+readonly --verbose cd -eu 2>/dev/null
+grep /usr/bin grep printf 2>/dev/null -eu
+test 'quoted text' export 2>/dev/null sed 2>/dev/null echo local cd awk --verbose
+	cd cd -eu test echo done "$@" x=1 x=1 echo
+	test -eu 2>/dev/null local echo grep $(pwd) ${HOME}
+cd /usr/bin local x=1 /usr/bin export readonly 'quoted text'
+	then then local grep then x=1 x=1 $(pwd) 2>/dev/null
+	$(pwd) echo ${HOME} && 2>/dev/null
+done /usr/bin --verbose 2>/dev/null && 2>/dev/null | awk awk "$1" && awk grep
+&& "$@" readonly x=1 export test | test $(pwd) $(pwd) /usr/bin
+		--verbose test | test done x=1 done x=1 local sed grep
+		${HOME} 'quoted text' 2>/dev/null $(pwd) 2>/dev/null cd x=1 ${HOME} "$1"
+		"$@" && done ${HOME} printf export 'quoted text' local local local | 'quoted text'
+/usr/bin 'quoted text' test x=1 readonly grep grep |
+	/usr/bin $(pwd) /usr/bin /usr/bin && && local grep 'quoted text'
+	cd awk sed x=1 "$@" then
+		&& 'quoted text' local -eu "$@" printf -eu printf | done then "$1" printf
+awk awk then grep readonly 'quoted text' $(pwd)
+		'quoted text' ${HOME} awk awk ${HOME}
+	local 2>/dev/null && test printf test sed | awk -eu &&
+	"$@" export printf ${HOME}
+	&& done then && export local | printf
+		test 'quoted text' /usr/bin test local
+		then /usr/bin local -eu 'quoted text' export echo 2>/dev/null export
+cd "$@" /usr/bin "$1" sed cd echo ${HOME} test grep
+	cd && awk | export "$1" 'quoted text'
+	awk -eu -eu sed ${HOME} cd grep
+| printf grep "$@" test | $(pwd) test
+	sed && --verbose awk | done test printf x=1 2>/dev/null export test sed
+| sed --verbose echo echo "$@" test
+	/usr/bin then $(pwd) test grep local
+$(pwd) cd 'quoted text' |
+		sed 'quoted text' "$1" x=1
+	"$1" echo printf && x=1 awk x=1 sed done then printf 2>/dev/null 2>/dev/null
+	$(pwd) test $(pwd) | local printf
+export cd "$@" && --verbose readonly | 'quoted text' done "$1" x=1
+--verbose 2>/dev/null sed echo -eu readonly sed -eu echo awk printf
+	echo 'quoted text' -eu 2>/dev/null test grep --verbose echo
+		${HOME} /usr/bin ${HOME}
+	export "$@" awk && x=1 grep | local x=1 readonly
+		cd "$1" cd "$@" then printf &&
+		export cd ${HOME} --verbose --verbose
+		readonly then "$1" x=1 readonly
+		| cd $(pwd) $(pwd) export echo readonly grep &&
+export ${HOME} export $(pwd) /usr/bin -eu sed ${HOME} 2>/dev/null grep
+	test -eu /usr/bin /usr/bin echo export awk
+		'quoted text' sed ${HOME}
+export /usr/bin test 2>/dev/null then ${HOME} grep
+grep && && sed grep echo printf && ${HOME} "$1" awk /usr/bin printf
+		'quoted text' cd ${HOME} && &&
+	2>/dev/null 2>/dev/null $(pwd)
+		awk 'quoted text' awk local -eu -eu readonly grep then | readonly
+	local 2>/dev/null && $(pwd)
+"$1" awk done sed 'quoted text' --verbose 'quoted text' &&
+	printf --verbose "$1" printf then then local cd test 'quoted text' test --verbose
+"$@" printf then "$1" && "$@" test readonly 2>/dev/null && grep test
+2>/dev/null grep "$1" && -eu printf export
+	done 'quoted text' done cd 'quoted text' printf x=1 readonly
+		sed readonly sed readonly export && $(pwd) readonly printf cd x=1
+	$(pwd) | ${HOME} $(pwd) local "$@" test "$1"
+	test --verbose done then done ${HOME} ${HOME} awk local /usr/bin printf x=1
+		printf $(pwd) 2>/dev/null /usr/bin --verbose sed "$@" sed echo && readonly
+| --verbose echo && /usr/bin then echo readonly readonly x=1 export
+then test awk then grep "$@" then
+	&& ${HOME} && echo done 2>/dev/null grep "$1" then --verbose sed awk 2>/dev/null
+	| printf then $(pwd) | | then echo done then x=1 2>/dev/null done cd --verbose
+	&& $(pwd) sed x=1 -eu x=1 then then
+	awk ${HOME} readonly awk test /usr/bin readonly then
+| x=1 grep 'quoted text' test 2>/dev/null ${HOME}
+		--verbose printf done awk cd cd -eu x=1 x=1 sed
+	${HOME} /usr/bin readonly
+		readonly /usr/bin cd "$1"
+export 'quoted text' $(pwd) x=1 -eu $(pwd) awk echo /usr/bin -eu 2>/dev/null
+readonly ${HOME} "$1" export | "$1" cd grep export awk "$@" then printf local
+	echo done local sed | 2>/dev/null grep cd then
+-eu && "$@" --verbose cd /usr/bin printf --verbose /usr/bin
+	"$1" $(pwd) readonly x=1 $(pwd) test | | grep x=1 echo 'quoted text' "$@"
+	| cd printf -eu 2>/dev/null && sed cd echo -eu "$1" printf /usr/bin grep /usr/bin
+	| printf readonly echo local
+	${HOME} && awk local readonly test /usr/bin export local 2>/dev/null
+export --verbose -eu grep 2>/dev/null
+		2>/dev/null "$1" -eu local local test /usr/bin 'quoted text'
+		done "$1" --verbose --verbose then test export /usr/bin --verbose local -eu
+	--verbose 2>/dev/null | 'quoted text'
+${HOME} test 2>/dev/null /usr/bin sed test printf ${HOME} export ${HOME}
+		'quoted text' sed --verbose | echo grep 2>/dev/null
+		2>/dev/null "$@" /usr/bin $(pwd)
+		| ${HOME} ${HOME} cd $(pwd) "$@" 'quoted text' export
+| x=1 "$1" --verbose $(pwd) printf sed readonly then ${HOME} local 'quoted text'
+	local && done $(pwd) cd 'quoted text'
+| | then 2>/dev/null "$@" /usr/bin && sed test local -eu
+then awk done local done 'quoted text' x=1 2>/dev/null --verbose
+	echo done | 'quoted text'
+"$@" -eu /usr/bin grep local readonly $(pwd)
+	"$@" x=1 $(pwd) --verbose "$@" local
+		x=1 local $(pwd) "$@" --verbose sed
+echo test grep cd /usr/bin then | awk && test local --verbose x=1 printf
+awk x=1 /usr/bin local cd cd $(pwd) done grep x=1 2>/dev/null
+		awk | test 2>/dev/null awk awk printf test local /usr/bin
+		sed local | then local ${HOME} printf /usr/bin "$1"
+then export "$1" cd | --verbose cd cd sed 2>/dev/null export | 2>/dev/null
+		cd 'quoted text' | $(pwd) ${HOME} /usr/bin --verbose printf
+		done export local && x=1
+-eu /usr/bin "$@" readonly
+	local "$1" export echo
+		echo cd grep 'quoted text' sed "$@" -eu
+		awk export 2>/dev/null export cd export "$1"
+	printf "$@" x=1 "$1" 'quoted text' test then awk sed printf echo
+	2>/dev/null export ${HOME} "$1" 'quoted text'
+"$1" ${HOME} done 'quoted text' "$@" export local
+sed done test 'quoted text' && sed 'quoted text' --verbose 2>/dev/null
+		local $(pwd) done export x=1 then 'quoted text'
+		"$1" echo 2>/dev/null "$@" /usr/bin "$@" 'quoted text' sed -eu test test test
+	grep done ${HOME} $(pwd) done 2>/dev/null
+	local 2>/dev/null export then printf ${HOME} 'quoted text'
+"$@" echo done ${HOME} printf
+	grep $(pwd) --verbose
+echo --verbose /usr/bin "$1"
+test x=1 printf sed export
+		cd then "$1" local 2>/dev/null
+	-eu readonly && 'quoted text' test printf export | export export 'quoted text'
+	x=1 then readonly -eu done local done "$@" sed -eu $(pwd) x=1 test
+'quoted text' && | readonly local ${HOME} printf -eu
+'quoted text' /usr/bin x=1 /usr/bin | then readonly awk ${HOME} x=1 /usr/bin
+	'quoted text' export ${HOME}
+		-eu local --verbose grep --verbose x=1 x=1 ${HOME} local | -eu ${HOME}
+	x=1 cd cd printf $(pwd) -eu local 2>/dev/null export
+$(pwd) test done readonly
+| sed then /usr/bin echo
+		readonly && printf readonly grep
+	'quoted text' sed && 'quoted text' grep
+		test readonly echo cd "$1" 2>/dev/null && grep done done readonly "$1" "$@"
+		x=1 export -eu && grep && -eu awk awk
+printf printf printf done -eu sed "$@" echo then export grep
+	&& 'quoted text' | done test --verbose $(pwd) grep && "$@"
+"$1" && readonly "$1" export
+/usr/bin test done 'quoted text' -eu 2>/dev/null
+		-eu x=1 $(pwd) printf 'quoted text' then echo -eu -eu awk done "$@"
+	grep local export | readonly local /usr/bin
+		readonly done ${HOME} ${HOME} done "$@" cd awk test awk local awk printf
+		-eu | "$@" && local | local local readonly grep 'quoted text' printf
+2>/dev/null /usr/bin -eu awk && "$@" echo | x=1 'quoted text' ${HOME}
+		&& && "$@" grep test -eu -eu && then then 'quoted text' printf readonly &&
+	${HOME} done sed ${HOME} echo cd $(pwd) ${HOME} "$1"
+x=1 awk x=1 export 'quoted text' awk then --verbose
+-eu cd 'quoted text' 2>/dev/null -eu grep /usr/bin 'quoted text'
+		--verbose printf ${HOME} done 2>/dev/null 'quoted text'
+	/usr/bin printf $(pwd) "$@"
+	local test grep grep 'quoted text' done "$1" 'quoted text' readonly "$1" ${HOME}
+		readonly $(pwd) grep --verbose /usr/bin cd /usr/bin export cd $(pwd)
+	done -eu "$@" cd && --verbose --verbose grep x=1 -eu | && 2>/dev/null
+	done grep x=1 -eu 'quoted text' "$1" cd | /usr/bin awk ${HOME}
+		sed -eu cd "$@" --verbose export --verbose local sed
+	${HOME} export local -eu 2>/dev/null $(pwd) /usr/bin --verbose
+printf cd 'quoted text'
+		test --verbose x=1 'quoted text' -eu -eu x=1 export
+		&& local $(pwd) test readonly done
+		awk | /usr/bin | local
+"$1" ${HOME} "$1" echo local 2>/dev/null done && cd export sed 'quoted text'
+		"$1" then /usr/bin export export done
+	--verbose | sed $(pwd) local 2>/dev/null grep
+		/usr/bin 2>/dev/null x=1 && local printf printf
+	test cd && test | "$1" /usr/bin export x=1 'quoted text'
+		x=1 ${HOME} | grep | test cd | cd local $(pwd) "$@" && | 'quoted text' | --verbose
+export local test | | test echo sed sed readonly 'quoted text'
+	2>/dev/null grep printf && 2>/dev/null done cd $(pwd) -eu done --verbose
+| | export then readonly done "$@" -eu | test
+"$1" cd /usr/bin done /usr/bin ${HOME}
+		cd export done export awk done $(pwd)
+		${HOME} 'quoted text' done "$1" then -eu readonly 'quoted text'
+	--verbose printf cd 'quoted text' local done
+	export ${HOME} $(pwd) --verbose printf x=1 grep /usr/bin x=1 echo grep
+		echo | cd -eu then "$@" "$1" "$@" awk cd 'quoted text' "$1" local grep
+	done then x=1 printf readonly sed echo --verbose --verbose
+/usr/bin 2>/dev/null "$1" x=1 ${HOME}
+	echo $(pwd) | readonly then "$1"
+	&& | 2>/dev/null done $(pwd) echo test &&
+		printf -eu local done "$@" sed "$1" 'quoted text'
+	'quoted text' done "$@"
+		'quoted text' test "$@" local "$@" | "$1" done test local
+		"$@" ${HOME} local "$@" done echo "$1"
+		cd done then --verbose -eu export
+		done grep awk /usr/bin 2>/dev/null cd printf x=1 -eu cd ${HOME} $(pwd) grep
+		test then x=1 then local sed done then
+		export local /usr/bin done local then local
+	awk x=1 local local -eu "$1" --verbose test "$1" sed local
+		test 'quoted text' cd printf
+		readonly "$1" /usr/bin printf
+		done --verbose x=1 "$@" && -eu printf test 'quoted text'
+	--verbose readonly 2>/dev/null then export readonly cd
+-eu echo echo local printf x=1 --verbose cd $(pwd) printf printf readonly cd
+readonly readonly awk | sed && --verbose echo | && echo export readonly grep
+then done /usr/bin --verbose
+${HOME} test awk echo -eu $(pwd) test --verbose "$@" awk sed 2>/dev/null
+		readonly local awk --verbose
+	${HOME} ${HOME} 'quoted text' ${HOME} x=1 x=1 awk then --verbose /usr/bin
+	-eu 2>/dev/null x=1 ${HOME} echo /usr/bin readonly | export done
+test /usr/bin grep /usr/bin printf awk "$@"
+'quoted text' then local && /usr/bin local
+	echo printf && readonly | printf ${HOME} "$@"
+		echo local "$1" /usr/bin "$1" grep 2>/dev/null 2>/dev/null &&
+/usr/bin echo export /usr/bin
+		export done local "$@" -eu local 2>/dev/null export cd then -eu cd
+	$(pwd) x=1 2>/dev/null grep echo | "$1" printf export then
+printf export 'quoted text'
+echo readonly test export "$1" sed && printf local x=1 echo cd 'quoted text' -eu
+		'quoted text' -eu 'quoted text' done 2>/dev/null done printf printf /usr/bin
+-eu readonly ${HOME} -eu echo ${HOME} | local readonly local x=1 2>/dev/null
+	--verbose /usr/bin | "$@" "$1" export 'quoted text' then echo -eu ${HOME}
+	local export ${HOME} then sed cd "$@" "$1" sed x=1 cd ${HOME} --verbose echo ${HOME}
+		cd "$@" echo printf ${HOME} sed export readonly export awk
+	awk ${HOME} "$1" sed --verbose
+	grep -eu grep printf test "$1" export export test sed then
+	cd awk readonly export grep printf awk && grep "$1"
+		&& 2>/dev/null && | | --verbose | then grep
+		grep -eu sed ${HOME} awk x=1 "$1" $(pwd) sed test
+--verbose test test sed 'quoted text'
+	readonly readonly 2>/dev/null
+	echo done printf export && export "$1" 2>/dev/null $(pwd) $(pwd) local
+sed awk | echo then awk done
+		local && readonly --verbose echo then readonly sed echo echo
+	-eu sed export printf local ${HOME} awk /usr/bin
+	sed local readonly /usr/bin grep echo
+"$@" -eu local cd cd x=1 printf done cd echo 2>/dev/null | readonly
+		sed test "$@" local test --verbose grep
+	then ${HOME} awk | cd $(pwd) 2>/dev/null cd readonly export local ${HOME}
+		| grep "$1" "$1" /usr/bin -eu cd awk echo export /usr/bin
+		&& "$1" grep done ${HOME} && sed ${HOME} x=1 sed "$1" sed test echo
+	awk 'quoted text' 2>/dev/null sed test ${HOME} 2>/dev/null
+-eu "$@" && --verbose | done done /usr/bin echo test echo /usr/bin echo sed x=1
+sed 2>/dev/null local x=1 then x=1 readonly && "$1" grep
+		--verbose export --verbose local readonly grep | echo
+2>/dev/null cd | readonly then | then && && x=1 test
+		printf done x=1 awk grep echo grep x=1 cd | readonly readonly
+	readonly awk /usr/bin grep /usr/bin grep export 2>/dev/null $(pwd) cd "$1"
+	| | test then cd 'quoted text' done && | local sed x=1 done /usr/bin "$@"
+		cd readonly export | test then then /usr/bin 'quoted text'
+--verbose 2>/dev/null echo /usr/bin && done readonly printf done $(pwd) local
+	/usr/bin sed "$@" "$@" done "$@" /usr/bin
+done ${HOME} local 'quoted text' -eu
+		awk done echo done cd
+		cd $(pwd) && | awk then "$1" "$1" export cd cd
+	"$@" && "$1" export /usr/bin export local
+then awk grep | export cd --verbose "$1" echo export echo echo cd /usr/bin
+| 2>/dev/null $(pwd) --verbose grep awk
+| readonly && grep then export grep then "$1"
+$(pwd) export x=1 --verbose $(pwd) $(pwd) printf echo done export grep
+x=1 awk test then export
+		done 2>/dev/null cd 2>/dev/null /usr/bin export
+awk /usr/bin test -eu local export printf
+		grep -eu cd /usr/bin 2>/dev/null $(pwd) echo "$1" sed "$1"
+		awk | "$@" | 'quoted text' printf && 2>/dev/null
+		| -eu x=1 --verbose export "$@" $(pwd) cd
+	/usr/bin 2>/dev/null then grep 'quoted text' export -eu awk grep export
+export then test export echo | ${HOME} x=1 &&
+$(pwd) echo printf printf 2>/dev/null | /usr/bin grep 'quoted text'
+		--verbose test 'quoted text'
+	--verbose printf done $(pwd) 2>/dev/null done awk export local 2>/dev/null
+		grep awk "$@" sed $(pwd) --verbose
+readonly 2>/dev/null printf printf readonly done --verbose -eu export printf printf
+		then 2>/dev/null "$1" | export test $(pwd) --verbose
+export readonly 'quoted text' then
+grep sed 2>/dev/null ${HOME} 'quoted text' grep && --verbose
+readonly | 'quoted text' then /usr/bin export echo
+	x=1 "$1" "$1" | --verbose
+	export export test "$@" readonly local 'quoted text' 2>/dev/null 2>/dev/null
+	x=1 sed && cd 'quoted text' awk done sed export readonly
+-eu awk $(pwd) grep x=1 local readonly $(pwd) | test /usr/bin "$1" --verbose
+		--verbose local cd | local export
+		"$1" ${HOME} printf && grep awk | test grep sed "$1" |
+"$@" "$1" sed -eu | local -eu x=1 "$@" echo ${HOME} -eu | local 2>/dev/null
+export 2>/dev/null awk -eu readonly
+"$1" "$1" "$1" printf $(pwd)
+	export test done "$@" "$1" test "$@"
+	| | sed export -eu /usr/bin test $(pwd) && 'quoted text' |
+	-eu export "$@" $(pwd) | echo --verbose ${HOME} /usr/bin done
+	"$1" readonly | readonly echo awk cd awk -eu
+	'quoted text' | 'quoted text'
+		then && sed then awk ${HOME} awk test "$@" grep echo /usr/bin
+	printf 'quoted text' --verbose 2>/dev/null
+	| test test x=1 "$@" -eu then sed x=1 -eu done 'quoted text' printf
+2>/dev/null sed test 2>/dev/null done grep x=1 --verbose
+	sed test sed x=1 "$1" grep local
+		done cd ${HOME} local then "$@" "$1" cd done &&
+		awk /usr/bin ${HOME} test test -eu x=1 then --verbose --verbose readonly
+	echo $(pwd) local sed -eu test echo /usr/bin "$@" $(pwd)
+$(pwd) echo echo export
+		-eu $(pwd) printf echo /usr/bin grep 'quoted text' then 2>/dev/null -eu &&
+	done && awk local x=1 2>/dev/null "$1" local awk then "$@" && local
+$(pwd) && printf 'quoted text' sed 'quoted text' awk "$1" export | --verbose
+	readonly x=1 local ${HOME} "$1" | 'quoted text'
+	--verbose && export $(pwd) "$@" -eu test then --verbose local
+awk "$@" 'quoted text' cd 'quoted text' done done && sed x=1 /usr/bin
+		readonly -eu then --verbose $(pwd) /usr/bin 'quoted text'
+#include c166.sh
+	cd export -eu && awk then && then then test printf /usr/bin "$@" local
+		export readonly 'quoted text' sed /usr/bin
+		$(pwd) printf grep grep | readonly "$@" && echo test && local local 'quoted text'
+2>/dev/null echo && printf test echo export 2>/dev/null 2>/dev/null
+		/usr/bin cd x=1 -eu "$1" 'quoted text'
+		/usr/bin awk x=1 2>/dev/null && export "$@" export /usr/bin
+"$1" cd && -eu awk export echo "$@" 2>/dev/null done export 2>/dev/null /usr/bin
+test && --verbose /usr/bin -eu test --verbose echo "$@" then --verbose then
+		x=1 -eu printf readonly $(pwd) readonly --verbose printf cd local sed
+		"$@" then sed readonly 'quoted text'
+	printf awk | awk "$@" $(pwd) ${HOME} export --verbose local |
+		${HOME} $(pwd) readonly 'quoted text' "$@" --verbose "$1"
+	local cd "$1" "$1" test then sed 2>/dev/null then $(pwd) sed -eu |
+		"$1" $(pwd) ${HOME} test $(pwd) x=1 readonly grep export done
+	$(pwd) then ${HOME} echo $(pwd)
+		sed $(pwd) export grep cd local sed 2>/dev/null grep
+		/usr/bin 'quoted text' awk local cd echo ${HOME} done local
+| grep echo printf local "$1" then x=1 "$@"
+		local -eu export 'quoted text' export x=1 export echo export /usr/bin
+grep sed awk sed 'quoted text'
+	/usr/bin /usr/bin 2>/dev/null
+		| done grep printf test done
+export cd && echo cd readonly
+		"$1" sed && awk $(pwd) done awk cd && --verbose
+done $(pwd) | echo cd --verbose /usr/bin readonly /usr/bin echo readonly
+	awk "$1" "$1" 'quoted text' && cd grep /usr/bin 'quoted text'
+"$1" --verbose sed 2>/dev/null done --verbose test
+		"$1" done test grep ${HOME}
+	awk | --verbose awk printf local "$@" $(pwd)
+	then local "$1" $(pwd) awk test | && printf
+		local --verbose "$1" done done
+then $(pwd) "$@" ${HOME}
+		| ${HOME} local then x=1
+	sed && "$1" export local ${HOME} && then $(pwd)
+| cd test test awk 'quoted text' printf 2>/dev/null then && "$1"
+		printf echo grep /usr/bin x=1 readonly export && $(pwd) /usr/bin ${HOME}
+		x=1 sed printf done done $(pwd) done printf echo local export
+-eu then grep --verbose local
+	readonly cd $(pwd) --verbose grep "$@" printf local awk ${HOME} /usr/bin "$1"
+	"$1" && grep | echo awk awk grep test
+	x=1 && && echo /usr/bin
+readonly awk | grep echo | printf cd "$1" sed --verbose ${HOME} printf "$@" awk
+	2>/dev/null sed -eu done
+		--verbose local $(pwd)
+		awk -eu cd "$1" 'quoted text' $(pwd) 'quoted text' | readonly /usr/bin
+		test export printf sed
+&& --verbose echo 'quoted text' | && then sed then x=1 echo readonly
+	done "$1" test test -eu ${HOME} export readonly 'quoted text' 'quoted text'
+-eu done test ${HOME} "$1" then x=1 echo /usr/bin "$@"
+"$1" export printf awk 2>/dev/null sed ${HOME} $(pwd) 2>/dev/null
+		readonly && ${HOME} export
+&& | readonly cd "$@" cd ${HOME} x=1 ${HOME} printf |
+	&& 'quoted text' $(pwd)
+readonly | && export /usr/bin
+		test | grep awk export 'quoted text'
+		export /usr/bin /usr/bin "$1" 2>/dev/null /usr/bin
+	readonly | done $(pwd) -eu then x=1 && cd then cd ${HOME}
+2>/dev/null 2>/dev/null --verbose
+	| | $(pwd) ${HOME} then ${HOME} 2>/dev/null | cd echo then sed cd /usr/bin then
+		"$1" sed local grep --verbose 2>/dev/null
+		-eu | echo echo $(pwd) "$@" && done local grep -eu | grep "$1" readonly
+		'quoted text' && -eu --verbose "$1" /usr/bin cd && awk local awk
+x=1 | readonly test grep sed "$@" grep
+		grep export sed -eu grep echo $(pwd) $(pwd) printf --verbose
+	cd && 'quoted text' /usr/bin then echo /usr/bin $(pwd) then test |
+		--verbose cd 2>/dev/null 2>/dev/null &&
+		grep /usr/bin x=1 x=1 x=1 echo local export 2>/dev/null
+	'quoted text' $(pwd) "$@" "$1" 'quoted text' local |
+-eu -eu 'quoted text' 2>/dev/null
+/usr/bin 'quoted text' ${HOME} readonly sed awk "$1"
+cd x=1 done grep grep readonly 'quoted text'
+	"$1" --verbose grep 2>/dev/null cd "$@" && && --verbose "$@"
+-eu --verbose && /usr/bin $(pwd)
+		'quoted text' readonly /usr/bin 2>/dev/null echo echo | readonly printf -eu
+		sed local export test ${HOME} printf -eu grep echo readonly "$1" $(pwd) local
+printf export test "$@" grep "$1"
+		printf 'quoted text' && export "$@" grep done 'quoted text' 2>/dev/null
+		x=1 'quoted text' export x=1 test grep | /usr/bin done sed $(pwd) grep
+		then /usr/bin x=1 test awk awk readonly then && /usr/bin -eu sed cd readonly "$1"
+		2>/dev/null cd /usr/bin
+| sed $(pwd) awk local readonly &&
+		${HOME} "$@" $(pwd) /usr/bin /usr/bin then local readonly && --verbose 2>/dev/null
+		test "$1" echo | printf 2>/dev/null x=1 "$@" cd local
+	done export readonly 'quoted text' 'quoted text' awk grep echo "$@"
+cd /usr/bin readonly echo
+readonly done test && cd test test && grep -eu "$1"
+	--verbose sed x=1 $(pwd) echo then printf cd | 2>/dev/null
+then --verbose local local ${HOME} | /usr/bin | && $(pwd) 2>/dev/null
+		awk && x=1 grep readonly && -eu | grep test
+$(pwd) awk ${HOME} "$@" "$@"
+		"$@" && && "$@" echo then "$@" ${HOME} /usr/bin | readonly 2>/dev/null "$1"
+"$1" export test ${HOME} awk local export sed 2>/dev/null x=1
+	--verbose export then then $(pwd) export
+printf && x=1 test $(pwd)
+then x=1 "$1" readonly then $(pwd) $(pwd) --verbose
+grep /usr/bin --verbose grep test
+	cd then /usr/bin then "$1" done ${HOME} awk sed test test export done grep -eu
+		awk sed ${HOME} done local echo export export /usr/bin /usr/bin readonly
+	| local ${HOME} cd grep done
+		sed && $(pwd) local echo x=1 ${HOME} cd 'quoted text'
+	"$1" "$@" "$@" --verbose && /usr/bin -eu then ${HOME} then
+		--verbose test x=1 | x=1 2>/dev/null
+readonly "$@" /usr/bin --verbose && export test x=1
+	sed 2>/dev/null done /usr/bin cd echo "$1" 'quoted text' local 2>/dev/null printf
+	then then ${HOME} export "$1" && export -eu | ${HOME} -eu ${HOME} "$@"
+export 2>/dev/null 'quoted text'
+/usr/bin 2>/dev/null --verbose ${HOME} $(pwd) printf echo printf /usr/bin
+		${HOME} done /usr/bin then test
+	${HOME} 2>/dev/null then grep 'quoted text' awk ${HOME} | echo sed test grep sed
+grep echo --verbose sed x=1 then test ${HOME} awk sed then grep 2>/dev/null
+printf sed grep printf test echo -eu && --verbose 2>/dev/null sed ${HOME}
+	export export local echo $(pwd) -eu 'quoted text' "$1" "$@" --verbose
+	&& $(pwd) "$1" printf readonly cd "$@" -eu x=1
+	$(pwd) "$1" 'quoted text' test printf
+echo echo cd readonly 2>/dev/null printf export printf "$1"
+		${HOME} ${HOME} local grep $(pwd) /usr/bin x=1 awk awk && local ${HOME} sed then
+test 'quoted text' test echo test echo
+"$1" grep ${HOME} then 2>/dev/null
+		then sed cd then export -eu cd /usr/bin | awk echo ${HOME}
+sed export local local "$@" $(pwd) printf 'quoted text' ${HOME} local awk -eu "$1"
+		cd -eu $(pwd) "$@" sed test $(pwd) "$@" /usr/bin
+	/usr/bin ${HOME} awk export then ${HOME} sed grep local
+	"$@" 2>/dev/null printf --verbose --verbose 'quoted text'
+		done printf awk export 'quoted text' then local local
+	"$@" readonly local "$@" | "$@" done grep && | x=1 && 2>/dev/null
+		local then | readonly --verbose awk | echo export echo --verbose
+	'quoted text' && "$1" local "$@" grep sed ${HOME} grep done --verbose local printf
+2>/dev/null --verbose done
+| done /usr/bin /usr/bin -eu
+	cd test sed --verbose && then cd | /usr/bin --verbose export then | ${HOME}
+then done grep printf done --verbose export | then
+	'quoted text' awk export test export grep --verbose && "$@" -eu readonly
+done sed then /usr/bin
+		readonly "$@" grep echo cd local 2>/dev/null printf /usr/bin
+local sed x=1 $(pwd) --verbose 2>/dev/null 'quoted text' -eu /usr/bin
+		"$@" awk local echo awk done printf -eu ${HOME} --verbose 'quoted text'
+	--verbose 'quoted text' done 2>/dev/null
+cd awk local test $(pwd) && cd echo done echo cd
+	"$@" then ${HOME} printf awk && "$@" echo /usr/bin then sed done awk 2>/dev/null
+		export echo -eu "$@" && | test readonly |
+		&& echo && /usr/bin /usr/bin
+	-eu -eu 2>/dev/null ${HOME} --verbose "$@" then export readonly x=1 echo
+	-eu 'quoted text' sed "$@" | cd -eu local local "$@"
+	$(pwd) sed grep awk | 2>/dev/null sed local echo $(pwd) | "$@" | test test
+x=1 | cd test 2>/dev/null readonly done readonly && ${HOME} ${HOME} then
+		local awk 'quoted text' printf printf 'quoted text'
+readonly echo cd grep /usr/bin $(pwd) test echo x=1 /usr/bin sed
+| --verbose x=1 done awk local grep sed export
+	$(pwd) "$1" sed then cd printf 2>/dev/null
+		2>/dev/null | cd ${HOME} readonly cd export echo echo x=1 "$@" | local
+	"$@" export cd 2>/dev/null readonly cd local --verbose
+		export cd 'quoted text' sed /usr/bin printf "$1"
+		"$1" printf then $(pwd) cd cd 2>/dev/null | grep
+		local readonly then test && readonly echo ${HOME} printf local
+'quoted text' "$1" awk export ${HOME} test done 2>/dev/null
+		"$1" -eu | export ${HOME} sed && printf
+	local "$@" 2>/dev/null "$1" 2>/dev/null $(pwd)
+	then | test x=1 $(pwd) export readonly ${HOME} local "$@" sed
+		echo test "$1" $(pwd) -eu
+then 'quoted text' export
+		'quoted text' x=1 cd done
+	echo /usr/bin 2>/dev/null test && test /usr/bin && $(pwd)
+done awk grep --verbose export | grep x=1 cd export |
+		awk test printf x=1 "$@" -eu "$@" sed
+	| --verbose then $(pwd) "$@" $(pwd) -eu | x=1 x=1
+	awk "$@" test 'quoted text' readonly awk local 'quoted text' "$@"
+	/usr/bin /usr/bin local local ${HOME} $(pwd) "$@" test
+		'quoted text' "$@" -eu "$1" test local x=1 "$1" $(pwd) $(pwd)
+	sed then && echo sed ${HOME} "$@" 2>/dev/null export 'quoted text'
+		export then grep && "$1" -eu "$@" readonly test export 'quoted text' sed "$@"
+2>/dev/null local ${HOME} then --verbose readonly printf sed x=1 | 'quoted text'
+done "$1" $(pwd) local test "$@" grep 'quoted text'
+		&& cd 2>/dev/null && printf printf /usr/bin export export x=1 local
+		printf x=1 export -eu 2>/dev/null --verbose local 'quoted text' 'quoted text' local
+printf export readonly printf /usr/bin $(pwd) x=1 $(pwd) local
+export test && "$@" -eu grep --verbose -eu ${HOME}
+	"$@" "$@" | /usr/bin "$@" 'quoted text' grep test readonly readonly
+		-eu awk 2>/dev/null ${HOME} cd ${HOME} local then ${HOME}
+/usr/bin -eu $(pwd) -eu grep readonly then /usr/bin readonly "$1"
+	"$@" ${HOME} "$@" printf
+		$(pwd) | 'quoted text' local done cd cd /usr/bin 'quoted text' && "$1" grep
+		${HOME} grep awk --verbose -eu cd /usr/bin -eu test
+	${HOME} /usr/bin | echo /usr/bin /usr/bin && x=1 local --verbose readonly "$1"
+	&& x=1 "$1" grep sed awk --verbose 'quoted text' export
+		cd x=1 sed then echo echo --verbose ${HOME}
+	2>/dev/null -eu 2>/dev/null test test local --verbose local cd printf
+sed sed "$@" "$@" cd then cd then grep ${HOME} local /usr/bin -eu "$1"
+	'quoted text' x=1 'quoted text' readonly -eu "$@" then grep printf 2>/dev/null
+readonly $(pwd) then | grep cd then sed echo | x=1 local -eu $(pwd) /usr/bin
+	"$@" local "$@" 2>/dev/null awk "$@" then x=1 2>/dev/null cd then --verbose | export
+| "$@" grep /usr/bin grep
+		"$1" cd local sed then done export --verbose grep printf
+"$@" cd local sed && | --verbose "$1" awk echo x=1 cd test export |
+		/usr/bin $(pwd) -eu ${HOME} 'quoted text' local /usr/bin 'quoted text'
+		test x=1 /usr/bin grep x=1 echo
+	$(pwd) sed readonly "$@" /usr/bin /usr/bin then sed "$1" | test | sed && test
+	-eu /usr/bin local 2>/dev/null local export readonly grep cd
+		then grep awk 'quoted text' readonly
+local echo -eu export x=1 readonly readonly 'quoted text'
+		local awk test local awk
+		local --verbose done | | x=1 -eu sed export local x=1 x=1 then | "$@" &&
+		local --verbose echo sed export export && /usr/bin sed "$@" then
+		-eu "$@" --verbose -eu -eu readonly x=1 echo cd /usr/bin --verbose
+		--verbose printf grep awk
+	echo x=1 && -eu local awk "$@" /usr/bin
+| | readonly | then done cd "$1" 'quoted text' ${HOME}
+		readonly $(pwd) sed grep 'quoted text'
+		&& echo /usr/bin ${HOME}
+test readonly test --verbose && readonly readonly | local cd $(pwd)
+	local | then awk awk printf test "$@" sed export then /usr/bin
+	export readonly local "$@" echo readonly printf export -eu 'quoted text' $(pwd)
+		${HOME} grep readonly awk local /usr/bin -eu done cd ${HOME}
+	readonly --verbose grep sed $(pwd) "$1" -eu cd -eu --verbose echo ${HOME}
+local x=1 | $(pwd) local $(pwd) | /usr/bin ${HOME}
+		test ${HOME} $(pwd) "$1" grep cd "$1" echo ${HOME} -eu | readonly sed "$1" export
+		--verbose grep sed | "$1" export x=1 'quoted text' "$1" echo x=1 printf
+		grep -eu done sed -eu printf then export done "$@" then printf 2>/dev/null --verbose
+	export --verbose $(pwd) $(pwd) then && "$@" x=1 'quoted text'
+		echo awk | $(pwd) then grep printf cd printf "$1" | printf
+	&& 'quoted text' $(pwd) sed $(pwd)
+	2>/dev/null "$1" "$1" done local awk $(pwd) grep export done | 'quoted text'
+	${HOME} "$1" && /usr/bin export
+"$1" x=1 "$1" -eu readonly grep cd test ${HOME} readonly local sed
+	done cd awk 2>/dev/null test
+'quoted text' cd readonly awk readonly printf x=1 && then readonly
+	'quoted text' done 'quoted text' "$@" test
+	export awk test export printf sed grep -eu readonly
+	--verbose $(pwd) printf test
+	sed -eu /usr/bin | /usr/bin readonly
+${HOME} ${HOME} then 'quoted text' then cd readonly $(pwd) ${HOME}
+	grep grep done --verbose local | printf -eu cd cd cd "$1" | awk && cd |
+		${HOME} test grep && /usr/bin done "$1" awk
+	test local x=1 -eu -eu "$@" then readonly grep export export awk && 'quoted text'
+		2>/dev/null /usr/bin export cd | awk grep --verbose grep ${HOME}
+'quoted text' x=1 | | local "$@" sed then "$@" "$@" printf /usr/bin awk
+$(pwd) $(pwd) echo && awk "$1" test then
+2>/dev/null sed cd printf echo --verbose -eu "$1" echo cd then &&
+echo then | cd ${HOME} then "$1" ${HOME} -eu
+$(pwd) then readonly --verbose
+	/usr/bin "$1" -eu ${HOME} done readonly --verbose -eu local "$1" 'quoted text'
+	/usr/bin /usr/bin export grep cd then
+	${HOME} "$1" "$@" && x=1 && printf /usr/bin | local "$1"
+	awk awk --verbose ${HOME} x=1
+	awk awk ${HOME} export
+	local "$1" cd --verbose | "$@" &&
+	awk done 'quoted text' readonly "$1" local awk "$1" grep echo then x=1 echo readonly
+	readonly ${HOME} 'quoted text'
+		awk grep /usr/bin $(pwd) 2>/dev/null
+		"$@" local 2>/dev/null 'quoted text' ${HOME} printf sed "$@"
+	local /usr/bin export local x=1
+		x=1 "$1" $(pwd) 2>/dev/null
+printf local grep readonly x=1 test $(pwd) sed grep test x=1 'quoted text' /usr/bin
+	done x=1 "$@" cd 'quoted text' export test "$@" -eu
+	"$@" echo --verbose ${HOME} --verbose | cd cd 'quoted text' /usr/bin 2>/dev/null
+${HOME} "$@" $(pwd) done && && && readonly readonly "$@" sed test sed printf "$1"
+		echo --verbose done readonly ${HOME} 'quoted text' | 2>/dev/null
+readonly export awk 2>/dev/null
+		export "$@" awk --verbose "$@" 2>/dev/null
+		awk --verbose $(pwd) printf --verbose then grep local --verbose
+		${HOME} --verbose $(pwd) cd 2>/dev/null 'quoted text' ${HOME}
+	awk test grep printf 2>/dev/null
+	$(pwd) 2>/dev/null local done x=1 grep /usr/bin test local
+export 2>/dev/null grep "$@" then awk done /usr/bin sed
+awk "$@" echo --verbose then 'quoted text' --verbose test
+	/usr/bin test then readonly --verbose
+sed --verbose $(pwd) -eu "$1" 'quoted text' 'quoted text' 2>/dev/null readonly
+$(pwd) 2>/dev/null done export readonly | export && sed grep
+	test cd ${HOME} sed test sed
+-eu local x=1 --verbose cd local echo "$@" grep && $(pwd) x=1 printf export
+		readonly 'quoted text' "$1" readonly printf -eu ${HOME} done readonly -eu
+		grep -eu cd 'quoted text' echo /usr/bin grep
+		$(pwd) grep "$1" "$@" && /usr/bin -eu done
+		2>/dev/null ${HOME} && && "$1" -eu "$@" 'quoted text' /usr/bin printf
+--verbose "$1" grep local export 2>/dev/null x=1 "$1" then
+export "$1" readonly | printf sed
+echo x=1 grep -eu done printf "$1" test test printf ${HOME} printf cd -eu |
+awk /usr/bin -eu test "$1" sed printf 'quoted text' local "$1"
+		cd "$1" then cd cd 'quoted text' x=1 echo && grep
+		grep "$@" local ${HOME} "$@" ${HOME} readonly awk local --verbose
+| sed then echo 2>/dev/null ${HOME} -eu readonly awk awk
+	then grep /usr/bin | readonly export grep
+echo /usr/bin export "$@" 'quoted text' /usr/bin echo
+| 'quoted text' "$@" ${HOME}
+| x=1 'quoted text' done awk $(pwd)
+sed local ${HOME} "$@" readonly
+	export -eu echo export then awk "$@"
+	'quoted text' printf echo awk test /usr/bin test
+		'quoted text' readonly sed ${HOME} then done then echo done grep 2>/dev/null
+'quoted text' done printf local local printf
+--verbose 'quoted text' | | readonly "$@" cd export | sed "$@" grep
+--verbose 'quoted text' /usr/bin readonly done | cd test grep sed awk awk 2>/dev/null
+	--verbose | $(pwd) && "$1" readonly
+	awk && echo $(pwd) awk x=1 echo then -eu | done readonly
+		2>/dev/null /usr/bin local
+test $(pwd) /usr/bin x=1
+	printf test "$@" $(pwd) && echo local | readonly echo && done
+		"$@" then && && $(pwd) local "$@" awk sed 'quoted text' readonly /usr/bin $(pwd)
+printf ${HOME} "$1" 'quoted text' printf "$@" "$@" -eu readonly
+		'quoted text' local /usr/bin echo $(pwd) && && export
+test 2>/dev/null awk grep test export local test echo 2>/dev/null sed 2>/dev/null
+	done printf export "$@" $(pwd)
+	${HOME} /usr/bin 'quoted text' "$@" -eu sed sed printf && && ${HOME}
+	-eu awk printf $(pwd) local /usr/bin 2>/dev/null sed --verbose readonly $(pwd)
+	test cd readonly && "$1" 2>/dev/null export "$@" $(pwd)
+		&& readonly "$@" 'quoted text' ${HOME} then
+	sed test "$@" ${HOME} echo done awk "$@" cd | | 2>/dev/null echo
+grep 2>/dev/null done "$1" --verbose 'quoted text' 'quoted text' 2>/dev/null
+		--verbose sed echo echo ${HOME}
+export then --verbose | "$@"
+	${HOME} $(pwd) 2>/dev/null echo test cd x=1 2>/dev/null readonly readonly then
+	/usr/bin echo -eu --verbose | echo && readonly export awk 2>/dev/null ${HOME}
+	--verbose cd 'quoted text' 2>/dev/null local ${HOME} ${HOME} local
+	$(pwd) -eu ${HOME} export $(pwd)
+		"$@" then 2>/dev/null 'quoted text' sed 2>/dev/null
+'quoted text' test export printf sed --verbose printf
+	| --verbose done /usr/bin echo
+		then local grep "$1" ${HOME} /usr/bin -eu local grep export 'quoted text'
+	'quoted text' $(pwd) awk 2>/dev/null 'quoted text' --verbose
+	echo x=1 'quoted text' readonly test ${HOME} 2>/dev/null
+		"$1" printf printf export awk grep readonly readonly sed | then -eu 'quoted text'
+		cd grep "$1" printf local test 'quoted text' done grep $(pwd)
+&& --verbose && 2>/dev/null echo grep "$@" cd export grep grep echo "$@"
+		then 'quoted text' && "$@" && then 'quoted text' && 2>/dev/null printf x=1
+	/usr/bin printf then printf $(pwd) cd && done export
+	"$1" -eu $(pwd) done printf /usr/bin "$@" 'quoted text' ${HOME} ${HOME} readonly
+| | --verbose --verbose && export --verbose sed local $(pwd) && local
+-eu --verbose $(pwd) then $(pwd) | && done done cd sed /usr/bin
+	$(pwd) && export | awk printf "$1" "$@" && cd done
+	test -eu grep ${HOME} awk
+2>/dev/null readonly done $(pwd) x=1 test "$@" -eu $(pwd) export
+	'quoted text' grep ${HOME} awk "$@" done -eu /usr/bin
+		x=1 readonly "$@" local
+	test readonly "$1" done test awk 2>/dev/null
+		| ${HOME} export test x=1 'quoted text' --verbose && then export
+	echo echo cd sed done x=1
+		-eu --verbose printf done test --verbose && grep $(pwd) -eu
+		2>/dev/null printf awk --verbose readonly /usr/bin -eu grep done sed x=1
+"$@" $(pwd) awk "$@" 2>/dev/null echo done "$@" readonly && test export "$1"
+	readonly x=1 -eu awk "$1"
+	-eu done /usr/bin /usr/bin | "$@" export && | sed &&
+		--verbose readonly x=1 -eu awk sed then
+--verbose x=1 local && "$1" sed
+sed $(pwd) then "$1" then cd grep "$1" | test ${HOME} echo then then 'quoted text'
+done then sed printf printf echo $(pwd) -eu export "$@"
+${HOME} awk /usr/bin ${HOME} printf "$1" grep done /usr/bin "$@" --verbose
+	printf --verbose -eu 2>/dev/null
+&& /usr/bin awk --verbose echo $(pwd)
+		readonly then $(pwd) readonly printf local && -eu | x=1 sed then | x=1 export
+	/usr/bin printf 2>/dev/null test $(pwd)
+--verbose grep 'quoted text' sed readonly 'quoted text' then $(pwd) 'quoted text'
+		| && test echo --verbose /usr/bin ${HOME} done && && ${HOME} --verbose export
+	done "$1" done then --verbose
+x=1 -eu export echo readonly cd sed printf grep export printf printf readonly
+then 2>/dev/null then $(pwd) local printf awk "$@" then printf
+	2>/dev/null /usr/bin awk awk export ${HOME}
+		| then /usr/bin --verbose cd "$1" echo printf 2>/dev/null then test ${HOME} |
+	-eu done sed x=1 readonly
+	&& 'quoted text' 2>/dev/null local then test "$1"
+	--verbose readonly | test 'quoted text' then
+echo local sed export test awk readonly "$@"
+		--verbose ${HOME} 2>/dev/null $(pwd)
+		grep x=1 sed $(pwd) then awk x=1 "$@" "$@"
+/usr/bin awk $(pwd) /usr/bin x=1 | -eu
+		echo test grep then /usr/bin /usr/bin --verbose 2>/dev/null sed 'quoted text'
+		readonly $(pwd) && local readonly 2>/dev/null
+		done done x=1 export grep 'quoted text' x=1 -eu && readonly x=1 /usr/bin /usr/bin
+		2>/dev/null -eu printf cd
+		printf 2>/dev/null then x=1
+	x=1 sed x=1 awk 'quoted text' 2>/dev/null echo 2>/dev/null
+then printf "$1" grep -eu echo done
+	"$@" | | /usr/bin then echo grep --verbose "$@" export
+grep /usr/bin --verbose readonly ${HOME} cd then sed
+	&& local -eu 2>/dev/null
+-eu 2>/dev/null "$1" grep ${HOME} $(pwd) sed 2>/dev/null cd "$1" 'quoted text'
+		export -eu && "$1" 'quoted text' -eu printf test awk
+test ${HOME} x=1 "$1" "$@" then 'quoted text' 'quoted text' echo
+readonly x=1 'quoted text'
+	| sed "$@" --verbose awk readonly /usr/bin
+local --verbose then sed readonly 'quoted text' test /usr/bin 'quoted text'
+		done "$@" echo awk cd "$@" test /usr/bin done then 2>/dev/null
+		grep --verbose "$@" echo && export "$1" test --verbose
+		&& ${HOME} /usr/bin && readonly local then local "$@" printf grep echo test
+'quoted text' export /usr/bin x=1 printf readonly ${HOME}
+		test cd sed sed awk awk readonly --verbose |
+--verbose echo export --verbose &&
+	2>/dev/null printf test && local export then test test readonly 2>/dev/null test
+	cd -eu local 2>/dev/null /usr/bin 'quoted text'
+$(pwd) export --verbose awk --verbose cd 'quoted text'
+		test x=1 local 2>/dev/null then --verbose cd readonly local cd -eu then
+		readonly 2>/dev/null ${HOME} grep x=1 --verbose
+		cd then x=1 printf awk --verbose /usr/bin 'quoted text'
+		printf echo 2>/dev/null sed ${HOME} 'quoted text' echo export readonly
+&& x=1 grep test "$1" ${HOME} printf --verbose test "$@" 2>/dev/null
+		$(pwd) then done test grep local
+		-eu export && && sed cd printf -eu
+cd | -eu local awk "$1"
+		"$@" /usr/bin "$1" /usr/bin readonly
+		awk /usr/bin 2>/dev/null 'quoted text' test export done
+	done readonly $(pwd) export then cd -eu done then 'quoted text' cd
+		2>/dev/null export printf cd 'quoted text' sed export /usr/bin -eu $(pwd) &&
+-eu cd && 2>/dev/null -eu test done sed
+&& $(pwd) ${HOME} "$@" awk then cd echo test echo readonly && && then echo
+	"$1" sed printf "$1" x=1 2>/dev/null 2>/dev/null awk local | readonly then $(pwd)
+	--verbose sed x=1 /usr/bin x=1 'quoted text' -eu awk cd awk "$@" --verbose
+	echo x=1 'quoted text' | -eu $(pwd) grep awk grep 'quoted text' --verbose "$@" &&
+	printf ${HOME} cd 2>/dev/null
+	'quoted text' export 2>/dev/null cd | test
+"$@" cd printf | then "$@" 'quoted text' awk 2>/dev/null --verbose 2>/dev/null |
+sed test readonly x=1 awk -eu grep printf "$1" x=1
+		grep sed readonly 2>/dev/null grep -eu test -eu 2>/dev/null awk
+		"$1" /usr/bin local export 'quoted text' x=1 "$1" grep grep ${HOME}
+	"$1" then done ${HOME} x=1 | "$1" ${HOME} "$@" done && export export sed -eu sed
+		grep grep 'quoted text' 2>/dev/null ${HOME}
+$(pwd) --verbose grep readonly printf
+sed | $(pwd) x=1 | awk 'quoted text' echo --verbose $(pwd) -eu
+${HOME} test --verbose cd -eu then readonly
+		x=1 then && cd && test awk $(pwd) grep echo done test && readonly
+-eu grep export "$1" done x=1 test | grep awk && ${HOME}
+-eu readonly -eu awk "$1"
+		$(pwd) awk 2>/dev/null x=1 then "$@" sed readonly done
+then awk cd --verbose ${HOME}
+		"$@" | 2>/dev/null echo && x=1 2>/dev/null echo awk sed 'quoted text' --verbose
+	sed local sed awk readonly 'quoted text' 'quoted text' 2>/dev/null
+	-eu ${HOME} cd local readonly then 2>/dev/null
+		--verbose $(pwd) echo then $(pwd) done $(pwd) 'quoted text' done printf | echo
+cd /usr/bin "$1" --verbose readonly grep
+	-eu --verbose --verbose && sed then then -eu "$@" --verbose
+$(pwd) | sed x=1 sed | "$@" | --verbose 'quoted text' printf "$@"
+	--verbose ${HOME} 2>/dev/null "$@" local 2>/dev/null grep cd local
+sed x=1 then $(pwd) -eu /usr/bin -eu
+"$@" test echo echo && echo $(pwd) $(pwd)
+		-eu readonly 2>/dev/null local x=1 then 'quoted text'
+		readonly cd done -eu printf local
+		readonly done -eu "$@" $(pwd)
+	cd "$1" grep x=1 local "$@" /usr/bin then && "$@" awk export
+		printf awk x=1 | "$@" && local 'quoted text'
+--verbose x=1 && done ${HOME} "$1" sed "$1" then
+sed ${HOME} local done awk
+2>/dev/null readonly cd printf sed /usr/bin "$1"
+${HOME} $(pwd) && && awk --verbose grep readonly
+cd echo 'quoted text' $(pwd) /usr/bin export then 'quoted text' /usr/bin x=1
+	done 'quoted text' cd -eu then readonly && done printf awk | |
+"$1" sed "$@" done && printf awk test local --verbose
+	readonly x=1 printf "$1" awk grep
+then test sed export test -eu readonly
+	${HOME} $(pwd) readonly
+x=1 local awk cd awk local sed
+	awk "$1" x=1 test local 2>/dev/null x=1 cd "$1" test
+cd && echo then "$@" --verbose printf | sed x=1 $(pwd) && $(pwd) then export
+	&& -eu $(pwd) -eu $(pwd) -eu
+		-eu printf local -eu $(pwd) && &&
+		'quoted text' /usr/bin && printf sed "$@"
+local printf done printf grep local done x=1 local printf sed grep local export
+	done "$1" x=1 done printf test cd printf printf test
+	done done echo | cd && export echo --verbose 'quoted text'
+		&& -eu printf export /usr/bin local
+	"$1" printf x=1 "$@" sed --verbose echo x=1 awk -eu ${HOME} "$@" then cd && echo
+	--verbose export && awk then && && 2>/dev/null "$1" test "$@" cd local
+		echo awk --verbose 2>/dev/null export
+	printf cd 'quoted text' test readonly $(pwd) done && "$@" --verbose
+		-eu | grep && readonly awk -eu sed ${HOME} /usr/bin 2>/dev/null awk local
+		/usr/bin export -eu sed -eu
+		-eu "$1" "$1" sed printf
+awk sed "$@" "$1" printf
+		2>/dev/null ${HOME} grep cd test echo cd sed then
+&& 2>/dev/null sed export export local
+cd sed export awk -eu echo cd /usr/bin awk done
+		awk then local ${HOME} cd
+echo x=1 x=1 awk sed local sed
+		/usr/bin 'quoted text' -eu readonly printf cd
+		$(pwd) grep test | --verbose
+		${HOME} "$@" -eu -eu done grep grep grep
+		$(pwd) local export ${HOME} 'quoted text' | "$@" 'quoted text' && "$1" echo
+		'quoted text' cd printf printf
+		done readonly local | ${HOME}
+		grep test 'quoted text' -eu then test "$1" -eu 2>/dev/null cd echo 2>/dev/null ${HOME}
+then --verbose cd cd 2>/dev/null local
+		export "$@" sed readonly printf echo
+	echo grep "$@" cd grep "$@" cd 'quoted text' grep
+'quoted text' done -eu test
+${HOME} /usr/bin echo echo 2>/dev/null export --verbose
+cd export done grep | $(pwd) -eu && -eu echo -eu ${HOME} "$1" readonly sed export
+"$1" awk $(pwd) cd $(pwd) readonly export
+	&& "$1" ${HOME} sed echo test readonly echo && --verbose
+	/usr/bin local x=1 echo | x=1 -eu echo awk done grep | && 2>/dev/null
+-eu done x=1 awk $(pwd) test 2>/dev/null x=1 printf "$@" ${HOME} readonly
+'quoted text' sed 2>/dev/null test sed printf readonly readonly x=1 done echo
+	/usr/bin cd awk echo -eu "$@" x=1 "$1" "$1" ${HOME} "$1" test export
+"$1" echo | test cd && echo local -eu awk /usr/bin grep 'quoted text' 2>/dev/null
+	echo 2>/dev/null sed --verbose | 'quoted text'
+		"$@" echo -eu grep done sed ${HOME} echo sed && then | readonly && &&
+$(pwd) sed echo -eu "$@" sed x=1 --verbose 'quoted text' test sed
+		done "$@" $(pwd) export printf $(pwd) --verbose
+cd export printf readonly "$1"
+grep "$1" grep awk "$1" | x=1 sed sed && printf then && ${HOME} done /usr/bin
+		${HOME} "$1" cd local --verbose
+'quoted text' then echo 2>/dev/null $(pwd) cd grep --verbose readonly
+		--verbose echo 'quoted text' "$1" export "$@" echo $(pwd) printf
+	2>/dev/null done "$@" | sed x=1 test grep /usr/bin x=1 printf /usr/bin |
+		sed sed $(pwd) ${HOME} 2>/dev/null "$1" x=1
+'quoted text' "$@" "$1" x=1 --verbose "$@" local export grep "$@" readonly
+		done ${HOME} "$@" test "$1" ${HOME} | 'quoted text'
+&& | $(pwd) "$@" 'quoted text' "$1" done "$1" sed
+	then awk "$@" "$@" awk export $(pwd) sed 'quoted text'
+		${HOME} local | export -eu --verbose 2>/dev/null
+	then && x=1 2>/dev/null 'quoted text'
+printf export sed 2>/dev/null printf 2>/dev/null
+test then test /usr/bin echo "$@" ${HOME}
+	cd -eu echo done done grep echo 'quoted text'
+printf x=1 $(pwd) x=1 "$@" awk --verbose
+		printf readonly x=1 then
+		x=1 then 'quoted text' echo export local 2>/dev/null
+	grep awk sed grep then ${HOME} sed /usr/bin 'quoted text'
+	echo 2>/dev/null echo printf local
+done printf -eu then test grep sed readonly $(pwd) awk && echo grep $(pwd)
+		test "$1" --verbose awk readonly export cd test awk then echo | readonly
+		local ${HOME} local /usr/bin && && readonly local "$@" --verbose
+	export printf sed then sed "$1" x=1 -eu /usr/bin test -eu | $(pwd) ${HOME} $(pwd)
+"$@" | "$@" echo 'quoted text' /usr/bin export grep
+	printf && && ${HOME} 2>/dev/null echo
+		"$@" echo echo export | "$1" echo
+-eu "$@" readonly "$@" readonly cd test "$@"
+	x=1 /usr/bin local printf && 2>/dev/null
+test done test ${HOME} grep 'quoted text' x=1 printf 2>/dev/null sed "$@"
+		'quoted text' "$@" x=1 $(pwd) done grep done
+		printf cd $(pwd) x=1 "$1" ${HOME} 2>/dev/null && && $(pwd) && "$1"
+		--verbose test readonly 2>/dev/null export export -eu $(pwd) 'quoted text'
+$(pwd) 'quoted text' 2>/dev/null
+local "$1" | ${HOME} ${HOME} "$1" export test $(pwd) --verbose readonly printf
+		| grep $(pwd) | done grep local "$@" $(pwd) $(pwd) echo --verbose /usr/bin
+awk local "$@" test done -eu done then --verbose readonly awk 2>/dev/null
+${HOME} done "$@" done ${HOME} cd awk grep export "$1" test $(pwd)
+		"$@" "$@" sed cd && sed done export sed /usr/bin
+		"$@" sed ${HOME} local printf grep cd grep && $(pwd)
+	export readonly echo awk 2>/dev/null printf printf local 2>/dev/null
+	local -eu "$@" then awk
+"$1" --verbose 'quoted text'
+		readonly printf 2>/dev/null "$@" done grep
+then ${HOME} ${HOME} awk export x=1 /usr/bin "$@"
+	readonly ${HOME} /usr/bin local "$@"
+	"$@" x=1 /usr/bin export echo readonly awk -eu then 'quoted text'
+		test && readonly export "$1" awk then test --verbose x=1
+test /usr/bin 2>/dev/null printf &&
+		printf printf x=1 local done export $(pwd) 'quoted text' | done readonly cd readonly
+	readonly printf 2>/dev/null then "$@" cd readonly grep
+	echo echo cd 'quoted text'
+"$1" -eu cd && 2>/dev/null 'quoted text' $(pwd)
+	&& cd | then "$@" export then export --verbose echo export cd && $(pwd) then
+readonly | export local export 'quoted text' local sed test
+		readonly "$@" printf sed x=1
+&& 'quoted text' 2>/dev/null $(pwd) 'quoted text' && then printf printf test
+		"$1" local readonly printf
+${HOME} x=1 && 'quoted text' && printf /usr/bin awk echo $(pwd)
+		${HOME} awk cd grep ${HOME} local "$@" "$1" printf "$1" "$1" awk -eu local test
+	2>/dev/null && awk -eu readonly /usr/bin export test
+"$1" sed local "$@" cd test -eu printf "$1" 'quoted text' echo --verbose
+	test | grep printf -eu /usr/bin -eu 'quoted text'
+'quoted text' $(pwd) sed export
+	printf && echo ${HOME} test
+	&& "$1" -eu done | awk sed awk printf 'quoted text' 2>/dev/null export
+printf $(pwd) 'quoted text' echo sed 'quoted text' then local echo x=1 --verbose
+		sed test --verbose "$@" echo x=1 cd "$@" readonly
+		printf "$@" test "$1" "$1" cd -eu "$1" && echo
+	&& echo grep done local "$1" -eu --verbose
+readonly awk awk ${HOME} sed done cd 2>/dev/null
+done -eu done -eu x=1 2>/dev/null /usr/bin local test
+sed ${HOME} "$@" 2>/dev/null | 'quoted text' $(pwd) ${HOME} local
+	--verbose echo local --verbose 2>/dev/null 'quoted text'
+	test local && 'quoted text' awk "$@" 'quoted text'
+done readonly 'quoted text' awk
+	test cd readonly --verbose --verbose
+		'quoted text' 2>/dev/null export local cd grep --verbose done
+	export | grep 2>/dev/null
+	"$1" export "$@" 'quoted text' cd echo "$@" done -eu awk ${HOME}
+--verbose "$@" /usr/bin
+'quoted text' x=1 "$1" sed $(pwd) $(pwd) echo && echo
+		${HOME} export local -eu
+'quoted text' 2>/dev/null local sed "$@" 2>/dev/null x=1 local export x=1 printf
+/usr/bin sed test export --verbose done sed $(pwd) local "$@"
+	&& echo ${HOME} | echo
+		local cd export && sed awk readonly local --verbose && && "$1" | /usr/bin readonly
+		x=1 && 'quoted text' -eu | "$1" && $(pwd) printf done && ${HOME} done readonly
+	'quoted text' awk test then $(pwd) sed --verbose readonly readonly readonly
+		"$1" -eu awk -eu ${HOME} "$@" "$1" export $(pwd) awk
+-eu export 2>/dev/null awk echo /usr/bin 2>/dev/null test "$1" --verbose local
+		test | 2>/dev/null ${HOME} done echo -eu && -eu --verbose
+	test "$@" echo test echo test done $(pwd) grep grep echo done local local export
+		2>/dev/null printf 'quoted text' && /usr/bin done grep /usr/bin
+		x=1 ${HOME} -eu then readonly
+		"$@" x=1 $(pwd) -eu grep cd readonly
+'quoted text' cd awk printf && "$1" then test readonly
+	readonly 2>/dev/null awk 2>/dev/null test x=1 export local
+	| /usr/bin readonly awk 'quoted text' printf cd "$1" 2>/dev/null grep then sed --verbose
+		--verbose && /usr/bin 'quoted text' done
+--verbose "$@" readonly 2>/dev/null
+		done awk readonly /usr/bin && $(pwd) cd "$@" "$@" sed x=1 --verbose grep
+		${HOME} export grep -eu readonly /usr/bin
+	&& sed 'quoted text' cd readonly grep sed then echo | && echo printf
+	"$1" done | then --verbose && test awk then x=1 grep local done
+	echo export 2>/dev/null cd sed then && done 2>/dev/null ${HOME} grep "$1" readonly
+	| --verbose then local printf
+		local x=1 | local /usr/bin awk export printf awk "$1"
+		/usr/bin 2>/dev/null awk
+	then readonly test x=1 readonly -eu /usr/bin
+	printf grep sed sed echo | cd awk test ${HOME} sed 2>/dev/null echo
+	&& awk echo 'quoted text' x=1 export --verbose
+		then test -eu | && --verbose
+awk cd 'quoted text' && printf readonly
+&& x=1 -eu done | x=1 "$1" 2>/dev/null --verbose
+"$@" readonly /usr/bin sed "$@"
+		-eu "$1" test x=1 sed then --verbose
+	&& | x=1 awk test 2>/dev/null grep
+		$(pwd) cd readonly "$1" echo 'quoted text' cd 'quoted text'
+	$(pwd) /usr/bin --verbose | && x=1 printf printf $(pwd) "$@" ${HOME} $(pwd) then
+	'quoted text' grep export /usr/bin /usr/bin done "$@"
+		grep then grep cd local sed then printf "$@" readonly /usr/bin | printf grep
+readonly -eu readonly
+	awk "$@" printf | x=1 readonly && "$1" cd echo && sed && then x=1 /usr/bin -eu readonly
+		-eu $(pwd) ${HOME} --verbose /usr/bin $(pwd) | 2>/dev/null
+cd test grep -eu /usr/bin
+		--verbose echo -eu readonly 'quoted text'
+	done awk /usr/bin /usr/bin x=1 test awk "$@" test $(pwd)
+		grep sed readonly /usr/bin 'quoted text' | --verbose
+test 'quoted text' test done cd --verbose
+		awk "$1" 'quoted text' ${HOME} test awk echo cd echo export printf "$@"
+		&& export --verbose x=1 cd 'quoted text' "$@"
+		x=1 ${HOME} export /usr/bin then /usr/bin "$@" | /usr/bin | "$@" cd
+	-eu then ${HOME} local readonly echo
+	'quoted text' cd cd printf
+"$1" echo /usr/bin 2>/dev/null
+cd /usr/bin ${HOME} printf test cd --verbose
+	awk "$@" test test | grep cd
+printf echo --verbose test /usr/bin
+	-eu printf && /usr/bin done /usr/bin readonly "$1" echo /usr/bin
+	/usr/bin test && x=1 test export $(pwd) -eu local ${HOME} echo local
+test x=1 | "$@" sed --verbose export grep --verbose --verbose
+		"$@" echo test echo x=1
+		export local awk --verbose cd test export export ${HOME} readonly ${HOME}
+		-eu 'quoted text' $(pwd) $(pwd) "$1" grep
+	"$@" export echo /usr/bin ${HOME}
+local /usr/bin && cd awk done grep x=1 grep printf
+	test -eu ${HOME} awk "$1" readonly sed echo awk
+		test cd --verbose 'quoted text'
+test "$1" --verbose 'quoted text' --verbose ${HOME} | printf readonly -eu
+	then sed readonly -eu awk readonly && x=1 cd echo cd
+"$@" /usr/bin printf --verbose local export
+		| --verbose grep $(pwd) 'quoted text' -eu then awk --verbose echo &&
+	printf awk --verbose awk sed
+		--verbose 'quoted text' cd ${HOME} export "$1" /usr/bin -eu
+	echo then && readonly 2>/dev/null && local sed done $(pwd) | local test "$1" sed
+"$@" test "$1" sed -eu ${HOME} | local local
+		export local done "$1" "$1" test test readonly grep cd grep test readonly
+	"$1" export test "$1" "$1"
+readonly grep ${HOME} test export --verbose then x=1 -eu cd "$@"
+		local printf awk "$1" ${HOME} local grep local awk awk
+		done local && export x=1 /usr/bin $(pwd) 2>/dev/null
+	echo export printf $(pwd) -eu x=1 | echo export --verbose cd echo
+	| /usr/bin $(pwd) x=1 export $(pwd) 2>/dev/null export | /usr/bin x=1 sed test
+	2>/dev/null "$1" printf
+done echo readonly ${HOME} | awk x=1 test "$1" && done "$1" x=1
+		sed sed /usr/bin awk test cd
+	2>/dev/null test "$@" awk -eu $(pwd) "$1" done ${HOME}
+&& sed "$@" export readonly local
+sed $(pwd) 'quoted text' 'quoted text' --verbose then --verbose
+		cd local 2>/dev/null echo && -eu export
+	sed grep && | "$@" x=1 && test sed --verbose readonly
+then "$1" --verbose && -eu local && readonly 'quoted text'
+		sed echo 2>/dev/null readonly awk done x=1 'quoted text' "$@"
+	2>/dev/null $(pwd) "$1" export && done sed ${HOME} /usr/bin sed then
+&& cd cd sed cd "$1" readonly
+'quoted text' | then
+	&& printf grep 2>/dev/null printf printf x=1 2>/dev/null
+'quoted text' done $(pwd) "$1" "$1" local then -eu
+		printf "$1" echo 'quoted text' "$1" echo ${HOME} local local
+		'quoted text' readonly --verbose
+	${HOME} /usr/bin local -eu test done done "$1" 'quoted text' echo test | echo
+		readonly -eu 2>/dev/null /usr/bin
+		$(pwd) readonly export printf sed --verbose
+	test then --verbose --verbose -eu "$@" | && sed 'quoted text' test
+	sed echo 2>/dev/null && printf
+printf 'quoted text' 2>/dev/null sed test test && grep then readonly "$@" echo
+	awk readonly awk test $(pwd) awk done then awk cd grep && echo 2>/dev/null
+	printf "$@" -eu grep cd --verbose
+		local awk grep 2>/dev/null | readonly grep && awk && echo -eu echo export export
+then echo 'quoted text' echo then printf then x=1 -eu 2>/dev/null printf
+		echo 2>/dev/null test /usr/bin
+done printf -eu ${HOME} --verbose 2>/dev/null
+		done export 'quoted text' x=1 awk -eu | $(pwd) sed grep 2>/dev/null --verbose "$@"
+	readonly awk awk "$1" "$@"
+	done x=1 then $(pwd) awk done x=1 done then | 2>/dev/null 'quoted text'
+	${HOME} grep ${HOME} export "$1" $(pwd) /usr/bin
+export export 2>/dev/null
+	-eu local local sed --verbose "$@" --verbose
+	&& | && 'quoted text' ${HOME}
+		"$@" echo export $(pwd)
+x=1 | done awk /usr/bin --verbose test done local -eu $(pwd)
+		/usr/bin then awk echo "$@" && "$@" -eu ${HOME} x=1 -eu grep
+	then awk 2>/dev/null "$1" 'quoted text'
+		cd awk /usr/bin test "$@" export x=1 2>/dev/null export /usr/bin grep && sed
+	--verbose awk && /usr/bin x=1 sed then
+		| grep readonly && grep $(pwd) awk local readonly
+sed "$@" test readonly -eu
+		"$1" | test && readonly && -eu printf "$1" then -eu
+	--verbose "$@" cd 2>/dev/null
+	export ${HOME} ${HOME} local test printf awk && $(pwd) "$1" -eu -eu ${HOME} cd
+sed awk done && $(pwd)
+/usr/bin local | local "$@" local export then --verbose && done ${HOME} 'quoted text'
+export grep 2>/dev/null -eu cd x=1 printf
+		--verbose ${HOME} /usr/bin readonly "$@" -eu 2>/dev/null
+	then && cd && --verbose "$@" 'quoted text' grep -eu 2>/dev/null
+		readonly 'quoted text' | done
+	/usr/bin local cd awk printf && test cd printf done readonly
+'quoted text' sed grep local "$1" then then -eu x=1 then /usr/bin
+printf printf echo readonly
+		awk "$1" "$1" awk readonly $(pwd) x=1 printf echo local 2>/dev/null --verbose
+		2>/dev/null -eu $(pwd) ${HOME} echo 2>/dev/null grep echo
+done printf readonly /usr/bin test local sed readonly 2>/dev/null
+		export echo "$@" sed awk sed then ${HOME} cd
+--verbose -eu "$1" $(pwd) --verbose local "$1" then
+		--verbose x=1 'quoted text' ${HOME} grep /usr/bin cd export
+--verbose 'quoted text' --verbose local | x=1 echo printf test x=1 "$1"
+		printf printf /usr/bin sed -eu | --verbose
+	${HOME} "$1" -eu --verbose
+"$1" grep sed | 2>/dev/null /usr/bin done && 'quoted text' printf "$1" "$1"
+		readonly 'quoted text' local
+then -eu sed /usr/bin | /usr/bin test x=1 cd -eu 2>/dev/null --verbose
+readonly grep readonly readonly "$1" cd awk export --verbose
+		"$1" && 'quoted text' "$1" grep sed echo printf cd awk grep "$@" ${HOME} then
+--verbose "$@" cd awk readonly readonly
+		$(pwd) /usr/bin test test grep sed sed grep sed local /usr/bin export $(pwd)
+	--verbose then awk grep done test printf
+cd done readonly -eu ${HOME} | then echo "$@" "$@" done
+	test then export export sed
+	2>/dev/null x=1 $(pwd) local printf && /usr/bin awk --verbose done test
+		test export done sed readonly -eu && awk sed then
+		${HOME} --verbose "$@"
+		2>/dev/null test export && x=1 "$@"
+		readonly 'quoted text' export $(pwd) local export && cd export then x=1 'quoted text'
+	sed local grep ${HOME} grep ${HOME} 'quoted text' grep /usr/bin --verbose | 'quoted text'
+	$(pwd) 'quoted text' readonly then && then --verbose $(pwd)
+awk -eu && done ${HOME} --verbose && x=1 | done x=1 "$@" local cd -eu test
+		readonly x=1 local readonly echo "$@" sed $(pwd)
+		test done -eu export export ${HOME}
+		--verbose readonly "$1" /usr/bin "$1" "$1" x=1 "$@" grep $(pwd)
+	awk && sed cd printf &&
+	"$1" export cd echo && grep test --verbose
+	export "$1" | -eu done echo readonly "$@" cd cd test awk
+		x=1 readonly --verbose /usr/bin
+/usr/bin sed && readonly && cd 2>/dev/null then ${HOME} echo x=1 && then
+"$1" test 2>/dev/null | echo awk --verbose x=1 then done
+export "$1" test "$@" "$@" echo local ${HOME} && 'quoted text' echo
+		sed test x=1 x=1 test x=1 $(pwd) | local cd readonly
+		printf | echo -eu 2>/dev/null sed
+x=1 x=1 $(pwd) done ${HOME} awk cd 2>/dev/null echo "$1"
+	"$@" echo done ${HOME} "$1" then done --verbose sed grep
+		done $(pwd) "$@" export 'quoted text' printf --verbose 2>/dev/null
+	x=1 echo echo "$1" test sed --verbose 'quoted text' -eu /usr/bin | then /usr/bin
+'quoted text' "$@" "$1" --verbose "$1" ${HOME} awk done sed 'quoted text'
+		$(pwd) sed then printf /usr/bin -eu ${HOME}
+		2>/dev/null $(pwd) done printf /usr/bin | cd 'quoted text' cd &&
+"$1" export /usr/bin printf
+then cd "$@" 'quoted text'
+	readonly export 2>/dev/null
+		$(pwd) local test ${HOME} ${HOME}
+	sed printf then grep readonly "$1" x=1 -eu done -eu --verbose ${HOME}
+	--verbose /usr/bin "$@" 'quoted text'
+		"$1" export grep export -eu local readonly
+		"$@" local done sed cd local export sed 2>/dev/null x=1
+x=1 x=1 then done ${HOME} x=1 && && test export
+	| x=1 -eu export $(pwd) 2>/dev/null echo /usr/bin 2>/dev/null
+${HOME} 'quoted text' grep "$1" sed echo x=1 x=1 -eu
+done export cd awk test "$@"
+		grep --verbose --verbose
+		'quoted text' grep "$@" --verbose cd printf /usr/bin
+	export cd sed | printf && "$1" "$1" local grep printf
+	x=1 -eu done then --verbose /usr/bin then "$1" done echo done /usr/bin
+	printf $(pwd) grep -eu readonly /usr/bin /usr/bin then x=1 $(pwd)
+${HOME} | "$1" /usr/bin sed --verbose ${HOME} | 2>/dev/null then printf
+	export "$@" grep export readonly then awk x=1 ${HOME} "$@" echo
+		"$@" test -eu then sed $(pwd) then grep --verbose printf export
+	done readonly 2>/dev/null
+${HOME} && 'quoted text' -eu grep local x=1 test 'quoted text' test | local ${HOME}
+		| sed grep | "$@" printf | x=1 local && echo "$@" done $(pwd)
+sed local echo && /usr/bin | "$@"
+	&& done ${HOME} -eu -eu readonly echo local -eu && "$1" grep "$1"
+	test export local "$1" -eu 2>/dev/null echo export
+	grep /usr/bin ${HOME} cd cd grep | readonly 2>/dev/null 2>/dev/null echo done
+		2>/dev/null done && -eu done readonly 'quoted text' then grep grep /usr/bin grep
+printf test | then done export test export export
+		$(pwd) "$@" 2>/dev/null export 'quoted text' ${HOME}
+		"$1" test --verbose ${HOME} && $(pwd)
+2>/dev/null -eu && "$@" readonly | | printf x=1 readonly
+	| printf done x=1 "$@" sed echo | | x=1
+sed -eu "$1" done cd | "$@" --verbose 2>/dev/null export sed | "$1" 2>/dev/null
+		grep sed && then 'quoted text' test export
+	--verbose x=1 readonly export 'quoted text' local export 2>/dev/null export
+	"$1" printf -eu 'quoted text' $(pwd) then echo local export grep --verbose
+	'quoted text' export -eu "$@" cd 2>/dev/null 2>/dev/null -eu awk /usr/bin
+		sed local /usr/bin echo grep "$1" -eu "$@" 'quoted text'
+		test export done readonly then /usr/bin local
+grep awk /usr/bin | ${HOME} | 'quoted text'
+${HOME} "$1" done sed | | sed then grep test -eu export
+readonly sed awk 2>/dev/null 'quoted text' $(pwd) /usr/bin printf sed test "$1"
+test grep test sed echo ${HOME} cd --verbose
+sed --verbose "$@" 'quoted text' test cd sed printf $(pwd) test export --verbose
+grep /usr/bin sed readonly $(pwd)
+&& done /usr/bin local "$1" test && sed "$1"
+"$@" test && done 2>/dev/null | awk /usr/bin test then --verbose "$1"
+	export grep "$1" $(pwd) grep 2>/dev/null local $(pwd) "$@" ${HOME} awk "$1"
+${HOME} -eu | readonly local cd
+	cd 'quoted text' then --verbose "$@" && then "$@" cd printf
+		grep awk | -eu awk x=1 test
+		cd readonly $(pwd) /usr/bin
+| "$@" printf test echo readonly grep $(pwd) "$1" awk printf
+		echo x=1 "$@" cd "$@" | /usr/bin 2>/dev/null "$1" export $(pwd) ${HOME}
+		${HOME} echo "$1" 2>/dev/null x=1 -eu grep -eu --verbose readonly x=1 ${HOME}
+		| | -eu x=1 then 'quoted text' awk cd "$@"
+	export && done 2>/dev/null
+	-eu done local | 2>/dev/null local 2>/dev/null x=1 /usr/bin local /usr/bin
+	grep x=1 done -eu grep && readonly
+		-eu grep cd x=1 ${HOME} local ${HOME}
+		--verbose "$1" then export readonly
+	-eu "$@" printf "$1" cd /usr/bin printf export 2>/dev/null sed -eu export
+--verbose local 2>/dev/null | echo printf test --verbose $(pwd) done printf
+readonly "$1" readonly then readonly "$1" | grep
+	cd /usr/bin cd 'quoted text' --verbose echo export --verbose readonly export
+	printf --verbose x=1 readonly $(pwd) "$@" cd then printf export $(pwd)
+/usr/bin test -eu && | done then $(pwd) x=1 then 'quoted text'
+	then sed && then $(pwd) awk 2>/dev/null -eu readonly | test "$@" echo
+		printf x=1 "$@" ${HOME} test
+	test --verbose then | readonly test | cd
+		echo 2>/dev/null test ${HOME} echo --verbose
+	grep --verbose ${HOME} export 'quoted text' test awk local x=1 local
+| && test --verbose $(pwd) done then /usr/bin "$@"
+		"$@" "$1" printf readonly x=1 'quoted text' ${HOME} "$1" /usr/bin -eu
+		awk 'quoted text' --verbose 2>/dev/null x=1 printf
+	echo sed local | printf x=1
+	printf then | test 2>/dev/null | sed
+	sed "$1" echo echo awk sed export -eu && readonly
+		export local export cd | /usr/bin printf sed -eu "$1" -eu done /usr/bin local
+		$(pwd) printf "$1" awk 2>/dev/null readonly
+	"$@" x=1 $(pwd) ${HOME} && /usr/bin then awk ${HOME} "$1" && test readonly done
+"$1" awk then "$1" echo done awk sed ${HOME} /usr/bin echo local done then
+	export sed then 'quoted text' && ${HOME} readonly --verbose export x=1 local --verbose
+printf echo echo 'quoted text' ${HOME} sed grep sed /usr/bin then
+		"$1" x=1 && $(pwd) x=1 then
+		done $(pwd) /usr/bin export
+	x=1 test test 2>/dev/null
+		-eu grep --verbose echo 'quoted text' local
+-eu local --verbose then readonly | 2>/dev/null
+export && -eu --verbose && awk "$1" ${HOME} && test cd cd cd "$1" /usr/bin $(pwd)
+$(pwd) export test "$@" 2>/dev/null cd done cd "$1" && echo "$@" echo then
+	x=1 local sed cd sed 'quoted text' 'quoted text' printf done "$@" 'quoted text'
+	x=1 grep 'quoted text' /usr/bin printf
+		done --verbose echo 2>/dev/null /usr/bin $(pwd)
+	-eu $(pwd) done /usr/bin
+grep --verbose "$@" test awk
+	then | then --verbose cd done 2>/dev/null | ${HOME} && "$1" --verbose
+		'quoted text' 2>/dev/null then export -eu "$1" | cd "$@" && cd | local
+	done readonly test "$@" "$@" 'quoted text' sed cd test then export $(pwd) x=1
+	export $(pwd) "$@" "$@" cd export | x=1 grep | /usr/bin
+then 2>/dev/null 'quoted text' -eu local cd |
+	cd "$1" | sed readonly printf awk cd 'quoted text'
+	$(pwd) sed cd readonly test /usr/bin export
+		2>/dev/null test awk | readonly $(pwd) sed 'quoted text' | export then
+	awk echo "$1" 2>/dev/null sed grep $(pwd) printf && then sed 'quoted text'
+then -eu local cd -eu grep
+	$(pwd) echo ${HOME} | sed then "$1" "$@" grep 'quoted text'
+--verbose readonly echo ${HOME} --verbose /usr/bin
+	x=1 "$@" export sed | "$@" local | x=1 awk --verbose && "$@"
+${HOME} ${HOME} readonly readonly -eu x=1 2>/dev/null --verbose sed /usr/bin
+"$1" $(pwd) grep echo local --verbose cd echo
+&& "$@" /usr/bin --verbose printf --verbose "$1" x=1 2>/dev/null
+	then 2>/dev/null grep "$1" echo --verbose | 'quoted text' -eu "$1"
+	| readonly printf 'quoted text' | x=1 "$1" test done 2>/dev/null
+		test awk | cd printf grep x=1
+		"$1" awk && --verbose x=1 -eu ${HOME} x=1 && echo
+	test -eu echo --verbose 2>/dev/null && "$1" sed --verbose echo /usr/bin
+		then done ${HOME} readonly -eu
+'quoted text' awk grep 2>/dev/null echo grep export | cd $(pwd) /usr/bin echo echo
+		sed "$@" readonly sed grep cd $(pwd) "$1" -eu "$1" 'quoted text'
+echo sed "$1" "$@" "$1" test --verbose then grep done --verbose printf
+		| then grep export printf local done -eu cd echo grep
+	&& ${HOME} x=1 then cd /usr/bin local
+echo $(pwd) test "$1" cd ${HOME} 2>/dev/null grep && x=1 sed
+		export sed "$1" $(pwd) -eu $(pwd) ${HOME} export cd --verbose export 2>/dev/null
+	| cd "$@" -eu readonly export
+	test readonly test local test x=1 ${HOME} local /usr/bin x=1 /usr/bin
+		then $(pwd) --verbose -eu awk "$@" cd
+		${HOME} echo readonly $(pwd) -eu grep x=1 "$@" ${HOME} 2>/dev/null
+&& export --verbose readonly echo --verbose echo "$@" --verbose
+	2>/dev/null sed then -eu "$1" | "$@" ${HOME} /usr/bin cd grep &&
+	printf test --verbose --verbose 'quoted text' 2>/dev/null export "$1" test /usr/bin
+		"$1" x=1 | awk done grep echo
+	&& 2>/dev/null grep readonly "$1" 2>/dev/null awk && $(pwd) ${HOME}
+	-eu "$@" export "$1" export 2>/dev/null $(pwd) -eu readonly "$@" printf --verbose
+	&& --verbose "$1" ${HOME} | test export grep
+	printf export ${HOME} sed -eu $(pwd) echo sed 'quoted text'
+	| echo | local export --verbose readonly
+		/usr/bin export done "$1" 2>/dev/null "$1" 2>/dev/null "$1" 2>/dev/null sed
+test then done printf /usr/bin test --verbose printf
+then local export cd "$1" --verbose local 2>/dev/null | "$1" test sed -eu
+		$(pwd) -eu export | /usr/bin echo x=1 -eu -eu
+2>/dev/null && 2>/dev/null
+		sed printf grep export "$1" | "$1" printf
+	${HOME} awk cd --verbose ${HOME} && -eu "$1"
+		"$@" /usr/bin readonly 2>/dev/null printf && printf | | export
+	x=1 ${HOME} "$1" sed 'quoted text'
+--verbose 'quoted text' then local &&
+then awk local -eu echo test echo 2>/dev/null awk
+	test awk grep test -eu ${HOME} export export -eu "$@" "$@"
+	done "$@" done done -eu x=1 printf --verbose
+$(pwd) 'quoted text' export export local
+	done awk && local 2>/dev/null echo x=1 awk -eu awk then x=1 $(pwd)
+echo local printf x=1 done echo
+readonly cd x=1 test /usr/bin ${HOME} 2>/dev/null ${HOME}
+		-eu $(pwd) "$1" x=1 awk | printf
+	local ${HOME} sed /usr/bin | "$1" local cd /usr/bin --verbose test
+		readonly "$@" 'quoted text' done done printf /usr/bin cd && local export
+		$(pwd) readonly "$1" "$@" | cd awk --verbose export $(pwd) awk "$1" test
+		"$1" awk then done "$1" 'quoted text'
+--verbose 2>/dev/null
+	echo grep 'quoted text' 2>/dev/null awk test
+readonly 2>/dev/null done done x=1 2>/dev/null printf grep local x=1
+		'quoted text' echo sed -eu then
+${HOME} cd then $(pwd)
+	then cd test "$@" | echo echo done 2>/dev/null
+		"$@" ${HOME} cd awk printf x=1 -eu grep export then "$1" 'quoted text' local
+	--verbose printf /usr/bin done local
+&& --verbose then done
+	| done sed grep && cd && $(pwd) grep local && grep && $(pwd)
+		sed awk sed echo sed ${HOME} ${HOME} x=1 export "$@" printf then test local awk
+${HOME} --verbose cd "$@" x=1 --verbose
+grep then 'quoted text' sed "$1" awk --verbose done "$1" echo
+echo export test /usr/bin readonly 2>/dev/null cd test 'quoted text'
+		2>/dev/null "$1" then done 2>/dev/null 2>/dev/null
+		$(pwd) echo /usr/bin ${HOME} done -eu done 'quoted text' readonly
+	${HOME} /usr/bin "$@" "$1" | x=1 x=1 cd
+	&& local done export local --verbose
+		grep cd sed | grep echo cd "$1" test -eu 'quoted text' done
+local && then "$1" -eu local
+${HOME} done -eu ${HOME} x=1 | /usr/bin printf "$@" test x=1 x=1
+--verbose 'quoted text' "$@" 2>/dev/null export
+--verbose /usr/bin | --verbose grep
+	printf $(pwd) test --verbose && 'quoted text' "$@"
+export done --verbose | local then ${HOME} $(pwd) printf
+		sed /usr/bin done sed grep ${HOME} ${HOME} 2>/dev/null |
+	awk echo "$1" $(pwd) /usr/bin printf export /usr/bin then ${HOME} grep /usr/bin
+| "$1" sed 'quoted text' awk sed -eu
+		-eu test done sed export local ${HOME} test export ${HOME} 2>/dev/null
+awk /usr/bin grep printf ${HOME} ${HOME} test sed then "$@" 'quoted text' readonly
+		${HOME} printf | export x=1 | 'quoted text' /usr/bin "$1" /usr/bin -eu printf "$@"
+		export grep | 'quoted text' test 'quoted text' then
+"$@" -eu x=1 cd readonly ${HOME}
+	done && local 2>/dev/null "$1" ${HOME} export -eu 2>/dev/null /usr/bin echo
+	export export && then -eu printf sed && printf 'quoted text' &&
+	printf then sed grep awk awk printf export
+		test echo "$1" /usr/bin $(pwd) grep 2>/dev/null |
+awk printf /usr/bin cd $(pwd) echo | export -eu -eu --verbose export readonly
+		/usr/bin cd && "$@" 2>/dev/null /usr/bin grep sed | local readonly "$1" ${HOME}
+	local echo -eu printf sed test test then
+done /usr/bin awk 'quoted text' 2>/dev/null | printf sed echo $(pwd)
+		echo export export printf export
+'quoted text' $(pwd) test 2>/dev/null --verbose
+		"$1" $(pwd) "$1" test 2>/dev/null cd done sed -eu --verbose then done
+	readonly sed sed readonly then | | /usr/bin export --verbose
+	2>/dev/null readonly echo | x=1 x=1 | cd 2>/dev/null printf
+"$@" cd sed cd printf /usr/bin done
+--verbose grep grep "$@" 2>/dev/null
+	-eu 'quoted text' local ${HOME} -eu ${HOME}
+test x=1 2>/dev/null ${HOME} readonly awk "$@"
+		x=1 test then then export readonly
+		local cd -eu done local --verbose done 2>/dev/null
+	cd | readonly readonly "$@"
+		-eu awk $(pwd) "$1" $(pwd) x=1 $(pwd)
+		&& /usr/bin && grep export /usr/bin sed export --verbose sed export
+	local x=1 done "$@" | test test x=1 ${HOME} local "$1" --verbose
+	x=1 done awk ${HOME} printf 'quoted text' done then cd printf -eu | -eu
+	cd sed done && | 'quoted text' grep 'quoted text'
+echo awk echo --verbose
+	printf | $(pwd) done readonly sed readonly grep then ${HOME}
+sed cd --verbose sed 2>/dev/null "$1" grep local 'quoted text'
+		echo "$1" echo awk "$1" readonly test sed
+	'quoted text' /usr/bin /usr/bin ${HOME} $(pwd) printf ${HOME} local done readonly
+		| test -eu local 'quoted text' 'quoted text' sed && | ${HOME}
+		$(pwd) "$@" cd printf && 'quoted text'
+	test "$1" readonly 2>/dev/null test local --verbose then echo readonly test
+echo readonly "$@" done ${HOME} ${HOME}
+	local "$1" "$@" $(pwd) --verbose test sed export -eu
+		| -eu cd printf printf 'quoted text' -eu readonly
+	/usr/bin sed done -eu "$1"
+printf 2>/dev/null then
+2>/dev/null "$@" --verbose readonly local awk cd then then
+	2>/dev/null cd --verbose readonly --verbose grep
+		${HOME} test readonly && local && then && 'quoted text'
+	${HOME} 'quoted text' test export 'quoted text' 2>/dev/null
+		sed echo sed "$1" --verbose local grep ${HOME} local --verbose /usr/bin
+		echo 2>/dev/null test echo done sed x=1 printf x=1 "$@" then
+test 'quoted text' 'quoted text' echo x=1 | cd /usr/bin 2>/dev/null
+	readonly local /usr/bin local awk /usr/bin x=1 awk &&
@@ -0,0 +1,2001 @@
+	/usr/bin --verbose export /usr/bin --verbose | done awk "$@" "$@"
+| $(pwd) x=1 'quoted text' ${HOME} --verbose
+	2>/dev/null --verbose "$@" "$1" -eu ${HOME}
+	/usr/bin awk readonly
+		| sed sed -eu --verbose x=1 printf $(pwd) test sed grep --verbose grep
+		done x=1 then && awk 'quoted text' /usr/bin "$1" x=1 grep readonly export 'quoted text'
+grep readonly --verbose /usr/bin $(pwd) local -eu cd readonly local --verbose
+		$(pwd) /usr/bin ${HOME} awk echo
+	awk ${HOME} x=1 'quoted text'
+/usr/bin | echo /usr/bin -eu "$@" test --verbose
+		| $(pwd) awk --verbose "$@" 2>/dev/null 2>/dev/null && $(pwd)
+&& done /usr/bin echo sed /usr/bin awk ${HOME}
+		cd /usr/bin && ${HOME} then | "$1" 'quoted text'
+		x=1 export printf ${HOME} test /usr/bin
+	test $(pwd) echo "$1" 'quoted text' --verbose "$@" -eu cd 'quoted text'
+grep awk done $(pwd) && awk sed "$@" 2>/dev/null "$@"
+		cd -eu grep 2>/dev/null awk awk | "$@" /usr/bin done $(pwd) cd awk x=1 "$@" 'quoted text'
+cd | sed cd && cd 2>/dev/null "$@" 'quoted text' readonly
+		| --verbose x=1 | && && "$@" "$1" test test 2>/dev/null
+printf 'quoted text' | then -eu --verbose --verbose 'quoted text'
+awk then "$@" readonly "$1" export
+	2>/dev/null $(pwd) cd -eu echo 'quoted text' test x=1 readonly
+	'quoted text' /usr/bin 'quoted text'
+done 'quoted text' echo 'quoted text' | echo done sed grep $(pwd)
+		"$1" --verbose 'quoted text' x=1 done sed printf --verbose $(pwd)
+'quoted text' cd test awk readonly
+	"$@" && 2>/dev/null export 'quoted text' /usr/bin then grep "$1" grep export
+	local test export done | export
+		done test then test local done x=1 sed ${HOME} local cd -eu 2>/dev/null
+local 'quoted text' sed then printf
+		&& local x=1 2>/dev/null && 'quoted text' echo | ${HOME}
+echo "$@" export "$1" local
+	awk test "$1" | "$@" done readonly
+		| printf test grep grep "$@" export -eu printf grep local "$1" sed readonly /usr/bin
+&& done readonly readonly then ${HOME}
+	sed 2>/dev/null && -eu --verbose
+		/usr/bin /usr/bin | /usr/bin
+	export grep && -eu test then sed sed "$1" done awk
+then ${HOME} readonly cd x=1 "$1"
+	export --verbose -eu /usr/bin && 2>/dev/null sed sed done $(pwd) ${HOME} x=1
+		/usr/bin /usr/bin readonly
+	2>/dev/null awk export ${HOME}
+	test /usr/bin test local -eu && done local 'quoted text' sed
+	${HOME} awk && && /usr/bin echo -eu
+	--verbose -eu $(pwd) readonly
+	awk done x=1 test ${HOME} $(pwd) then /usr/bin
+	sed printf "$1" 2>/dev/null export -eu sed awk ${HOME} "$@" readonly | |
+'quoted text' grep ${HOME} cd local sed local -eu export
+		/usr/bin /usr/bin | -eu awk
+		"$@" "$1" "$@" done x=1
+test | -eu 'quoted text' $(pwd) then "$@" "$@" $(pwd) test
+2>/dev/null grep then -eu ${HOME} /usr/bin /usr/bin ${HOME} echo /usr/bin
+	--verbose 'quoted text' export "$1" then && sed awk printf && /usr/bin cd printf
+${HOME} printf sed test "$1" $(pwd)
+	'quoted text' readonly done "$1" cd -eu
+	${HOME} "$@" $(pwd) printf test 2>/dev/null sed readonly echo /usr/bin then echo
+readonly awk cd -eu printf /usr/bin -eu 'quoted text' export --verbose /usr/bin
+	2>/dev/null --verbose readonly | echo | && "$1" sed --verbose awk --verbose
+	"$@" sed /usr/bin test x=1 "$@" echo echo cd 2>/dev/null ${HOME} readonly
+test done then "$1" | 'quoted text' -eu -eu test
+		--verbose && x=1 cd cd "$@" echo printf -eu local "$@" readonly local cd test
+		&& && grep test x=1 awk local $(pwd) -eu test cd grep local
+	test 'quoted text' 'quoted text'
+	2>/dev/null x=1 'quoted text' grep ${HOME} 2>/dev/null echo export
+		sed printf $(pwd) -eu awk
+		local readonly && cd ${HOME} x=1 test 2>/dev/null
+	"$1" test sed echo --verbose -eu /usr/bin grep done /usr/bin 2>/dev/null && cd
+	2>/dev/null done 'quoted text' /usr/bin && -eu local echo x=1 && sed $(pwd)
+done cd printf 'quoted text' done export export 2>/dev/null printf
+	"$1" local test then awk echo done local "$@" local $(pwd) /usr/bin grep $(pwd)
+	sed sed awk 'quoted text' "$@" sed then /usr/bin
+		"$1" readonly ${HOME} -eu | ${HOME} test 'quoted text' 2>/dev/null ${HOME} -eu sed
+	done sed 'quoted text' 2>/dev/null grep grep | "$1" | 'quoted text'
+	awk | 'quoted text' local cd sed 'quoted text' $(pwd)
+export "$1" ${HOME} 2>/dev/null "$1" local ${HOME} 'quoted text' --verbose "$1"
+		'quoted text' 2>/dev/null -eu && echo && awk test "$@" done echo "$1"
+	| | cd 'quoted text' /usr/bin printf then
+sed | done cd readonly "$@" -eu "$1" test |
+	${HOME} /usr/bin sed "$@" grep grep --verbose test export 'quoted text' | then
+	echo "$@" && done "$1" grep $(pwd) sed echo ${HOME} 2>/dev/null | export $(pwd)
+	$(pwd) readonly -eu local grep 2>/dev/null
+export then ${HOME} readonly local
+		local -eu test grep done then export echo readonly
+		test "$1" 'quoted text' | done readonly x=1 cd "$@" /usr/bin $(pwd)
+$(pwd) -eu then cd "$@" -eu && && $(pwd) 2>/dev/null 'quoted text'
+	local $(pwd) "$@" "$1" --verbose
+	${HOME} printf done ${HOME} --verbose
+sed 'quoted text' echo "$@" /usr/bin export awk ${HOME}
+		2>/dev/null local echo readonly
+	printf echo $(pwd) && cd local grep /usr/bin awk sed
+		grep "$1" x=1 export
+		| grep printf awk sed export "$@" ${HOME} --verbose
+	&& done printf | $(pwd) --verbose done "$1" readonly 'quoted text'
+		echo test readonly && awk test "$@" cd cd -eu test awk grep | local $(pwd) cd grep
+		export 2>/dev/null x=1 sed sed sed sed 'quoted text' 2>/dev/null
+		done printf "$1" $(pwd) 2>/dev/null echo local
+		export readonly $(pwd) then "$@" x=1 /usr/bin | readonly
+	"$1" echo ${HOME} cd $(pwd) local --verbose
+	$(pwd) then grep local grep 'quoted text' local
+		then echo printf "$1" && && done export then
+	/usr/bin export "$1" echo local
+x=1 readonly readonly echo $(pwd) --verbose export test sed $(pwd)
+	local 'quoted text' "$@" test 'quoted text' then -eu -eu grep test --verbose
+	"$1" x=1 | then 'quoted text' "$@" then sed
+	awk && local /usr/bin export -eu done
+	grep then readonly printf local $(pwd) readonly ${HOME} done &&
+$(pwd) awk | -eu --verbose
+x=1 ${HOME} cd 2>/dev/null "$1" export "$1" ${HOME}
+printf -eu | "$1" -eu echo -eu | --verbose
+	readonly echo done -eu readonly cd printf export echo
+		cd $(pwd) local && -eu readonly 'quoted text' 'quoted text'
+	test sed "$1" --verbose ${HOME} && cd echo "$@"
+	2>/dev/null grep printf 'quoted text' 'quoted text'
+"$@" -eu then awk -eu test "$@" echo grep "$@" printf done echo
+	cd export ${HOME} echo "$@" | "$@" 'quoted text' export | -eu 'quoted text'
+	sed --verbose export /usr/bin readonly grep export 'quoted text' sed /usr/bin
+		'quoted text' sed cd local
+	grep 2>/dev/null test
+		local | test -eu -eu cd export then /usr/bin --verbose --verbose "$1" export
+		local test | 'quoted text' grep 'quoted text' "$1"
+		then /usr/bin 2>/dev/null local "$@" readonly grep grep x=1 "$1" awk
+"$@" printf awk echo 'quoted text' /usr/bin test test export
+		| --verbose local -eu | printf ${HOME} readonly "$@" local grep
+		readonly | sed grep local local | && then echo $(pwd)
+		awk echo cd echo then export cd "$1" grep "$1"
+-eu done x=1 printf echo ${HOME}
+		test 2>/dev/null | test export done x=1 echo
+		then test /usr/bin x=1 'quoted text' x=1 sed -eu 'quoted text' x=1 -eu
+		$(pwd) 'quoted text' "$@" readonly echo
+export readonly $(pwd) 'quoted text' sed $(pwd) cd | 'quoted text' test -eu ${HOME}
+${HOME} done awk readonly -eu printf local "$@" export
+x=1 readonly sed ${HOME} -eu export grep 'quoted text' echo cd | "$1" "$@" "$1"
+	readonly | cd $(pwd) 'quoted text' cd ${HOME} --verbose grep ${HOME} test
+	"$@" readonly sed x=1 echo cd x=1 grep ${HOME} $(pwd) echo
+&& export printf awk
+/usr/bin local local x=1 'quoted text' $(pwd) -eu "$@" grep cd 2>/dev/null -eu printf
+sed -eu cd "$1" test | x=1 && -eu cd /usr/bin export | | "$1" --verbose
+	$(pwd) ${HOME} | sed then
+	x=1 local "$1" -eu export export done sed cd $(pwd) 2>/dev/null
+local test "$@" $(pwd) $(pwd) ${HOME}
+&& readonly local cd cd "$1" awk echo $(pwd) --verbose -eu
+	x=1 -eu done --verbose grep
+local 'quoted text' -eu awk $(pwd) x=1 awk done local 'quoted text' ${HOME}
+		x=1 readonly awk export printf 2>/dev/null 'quoted text' export x=1 "$@" 'quoted text'
+		grep ${HOME} sed awk --verbose printf grep -eu "$1" --verbose echo
+	"$1" | then -eu "$1" test
+	export then test test 'quoted text' readonly sed awk | --verbose
+	${HOME} 2>/dev/null x=1 &&
+printf printf /usr/bin grep /usr/bin export |
+	done done --verbose grep "$1"
+	cd "$1" echo "$1" 'quoted text' grep grep awk | --verbose
+| x=1 && x=1 --verbose 2>/dev/null printf cd then sed -eu sed 2>/dev/null
+cd 'quoted text' sed && | -eu && awk
+awk | 'quoted text' awk -eu | /usr/bin 'quoted text'
+	local then 2>/dev/null then printf printf awk cd x=1 export
+	"$@" then done cd echo done sed export
+		local test -eu --verbose then sed
+		printf export printf awk /usr/bin
+grep ${HOME} 'quoted text'
+		cd done echo "$@" sed 2>/dev/null --verbose $(pwd)
+done ${HOME} && | done -eu test readonly /usr/bin echo printf
+	"$1" $(pwd) /usr/bin && export
+	grep --verbose printf $(pwd) awk done && | 2>/dev/null /usr/bin
+	2>/dev/null readonly ${HOME} awk export test readonly --verbose
+		'quoted text' printf test
+		cd done | "$1" --verbose --verbose cd ${HOME} done
+	$(pwd) "$@" x=1 test "$@" 2>/dev/null local grep "$@" | 'quoted text' echo
+	| readonly ${HOME} printf 2>/dev/null done
+		local printf local "$1" --verbose /usr/bin && |
+	x=1 readonly grep test /usr/bin /usr/bin
+	test ${HOME} export printf grep
+		cd printf then --verbose done 'quoted text' awk "$1" 'quoted text' export
+		$(pwd) awk x=1 test 2>/dev/null export awk sed "$1" echo sed sed 'quoted text'
+-eu grep cd test readonly done done "$1"
+		-eu && readonly ${HOME} printf /usr/bin echo grep
+-eu ${HOME} $(pwd) awk
+	| awk ${HOME} -eu sed then ${HOME} local done 2>/dev/null x=1 &&
+	readonly x=1 awk echo /usr/bin export "$@" echo printf
+	x=1 -eu x=1 2>/dev/null 2>/dev/null 2>/dev/null "$1" ${HOME} "$1" printf
+-eu grep readonly --verbose x=1 local test -eu 'quoted text' $(pwd) grep
+	grep echo test printf -eu awk
+		${HOME} local test "$1" ${HOME} ${HOME} "$@" then "$@" -eu
+		-eu && grep grep echo grep export then grep export 'quoted text'
+	readonly printf export echo printf -eu | 'quoted text' printf local
+'quoted text' local && | grep test -eu sed echo readonly x=1 $(pwd)
+		readonly ${HOME} && export 2>/dev/null 2>/dev/null cd readonly
+	export printf --verbose cd grep && readonly readonly
+		-eu $(pwd) grep test 2>/dev/null "$@" printf
+local 2>/dev/null | local test "$1" done test x=1 done sed grep "$@" sed
+cd readonly sed awk $(pwd) printf cd cd readonly local
+printf local "$1" && cd && local sed awk then export
+	sed /usr/bin grep sed 'quoted text' $(pwd) --verbose export done
+	test sed /usr/bin grep
+	| && readonly then done 'quoted text' done x=1 then
+	awk && local 'quoted text' --verbose ${HOME}
+	2>/dev/null readonly test done ${HOME} x=1 done test readonly
+	local "$1" awk grep "$1" cd test x=1
+	--verbose /usr/bin cd echo echo
+	"$1" /usr/bin awk | x=1 x=1 done awk /usr/bin x=1 cd readonly | x=1 | 2>/dev/null
+		then done printf | -eu echo "$1" done "$1" | $(pwd) ${HOME} test
+"$@" -eu test then "$1" 'quoted text' x=1 --verbose
+	export 'quoted text' --verbose
+		/usr/bin 'quoted text' x=1 /usr/bin export
+| /usr/bin "$@" awk "$1" "$@" echo --verbose | 'quoted text' export
+	'quoted text' grep | grep
+		echo | "$1" sed cd /usr/bin printf --verbose
+	export then && export test ${HOME} sed test awk printf "$1" /usr/bin test printf
+&& "$1" --verbose | "$1" -eu test "$@" --verbose
+		2>/dev/null export -eu echo x=1 --verbose sed
+2>/dev/null x=1 | "$1"
+readonly | grep done local sed ${HOME} -eu done -eu 'quoted text' then 2>/dev/null
+		echo 'quoted text' x=1 --verbose $(pwd) && ${HOME} local
+	local then grep sed printf $(pwd)
+	awk awk cd echo local export -eu done
+grep | $(pwd) local echo cd echo
+	done sed | "$@" sed x=1 sed "$1" echo && done local --verbose
+2>/dev/null "$1" done then echo then | | export ${HOME}
+echo /usr/bin sed cd grep && done done cd 'quoted text'
+cd "$@" awk awk "$1" "$@"
+then $(pwd) done export $(pwd) export
+		${HOME} x=1 -eu printf export $(pwd) awk local printf
+		grep readonly "$1" -eu "$@" --verbose ${HOME} export sed
+"$1" /usr/bin /usr/bin ${HOME}
+	test echo "$@" test done --verbose && awk grep 2>/dev/null
+	-eu echo 2>/dev/null "$1" "$1" printf x=1 done readonly echo --verbose $(pwd) awk
+	-eu "$1" 2>/dev/null done echo && printf test "$@"
+		'quoted text' $(pwd) x=1 sed echo
+		&& done x=1 test printf export
+		-eu --verbose ${HOME} "$@" "$1" readonly readonly x=1 $(pwd) test test
+		echo echo readonly readonly $(pwd) done readonly |
+		x=1 printf "$1" sed && x=1 && x=1 test "$1" 'quoted text'
+	--verbose | 'quoted text' awk sed /usr/bin then
+		2>/dev/null test x=1 test 2>/dev/null
+	echo grep ${HOME} -eu local ${HOME} test $(pwd) --verbose
+| -eu && "$@" "$@" | | | "$1" awk readonly
+		sed awk $(pwd) readonly -eu cd x=1 export --verbose
+		"$1" && done printf readonly "$1" export -eu | /usr/bin
+	-eu grep -eu local test cd $(pwd)
+		test echo ${HOME} local ${HOME} x=1 2>/dev/null
+		awk x=1 -eu ${HOME} 2>/dev/null
+	"$1" printf readonly "$@"
+	'quoted text' x=1 'quoted text' awk grep local
+		readonly sed test "$1" sed
+		'quoted text' && export && ${HOME}
+then sed printf && --verbose grep printf awk 2>/dev/null x=1 grep -eu echo
+--verbose --verbose awk cd --verbose done "$1" export awk done | printf "$1" cd
+	export && && && -eu 2>/dev/null done 'quoted text'
+		x=1 ${HOME} ${HOME} && then ${HOME} cd local "$1" /usr/bin echo sed "$1" "$@" |
+printf 2>/dev/null printf "$@" export | /usr/bin
+/usr/bin done then 'quoted text'
+	'quoted text' 'quoted text' export | x=1 done awk ${HOME}
+		-eu sed then x=1 grep done printf local 'quoted text' local sed then cd
+		--verbose local echo local "$@"
+export local then 2>/dev/null readonly test
+	$(pwd) --verbose grep local export
+		grep | -eu test printf export local -eu export test &&
+	${HOME} cd awk -eu local
+		then | && x=1 ${HOME} "$@" 2>/dev/null awk readonly /usr/bin "$1" "$@" done
+	readonly x=1 --verbose cd x=1 'quoted text' readonly
+		grep export && -eu sed test x=1 done 2>/dev/null cd then done "$@"
+local && ${HOME} 'quoted text' "$@" local $(pwd) echo export echo "$@" readonly
+		export --verbose sed x=1 x=1 test && done 'quoted text' grep -eu
+	printf 2>/dev/null echo test | ${HOME} ${HOME} x=1 local
+		sed done 'quoted text' printf printf cd echo
+	then 2>/dev/null local grep | export cd sed cd awk sed done grep && "$1"
+		echo --verbose readonly --verbose
+sed then 2>/dev/null done ${HOME} "$@" test local 2>/dev/null
+--verbose cd done -eu grep -eu 'quoted text' --verbose /usr/bin cd test
+		$(pwd) "$1" 2>/dev/null
+		'quoted text' readonly -eu && local sed 2>/dev/null "$1" export /usr/bin test
+		'quoted text' 2>/dev/null --verbose grep && /usr/bin "$@" test && local done
+"$@" grep then /usr/bin then "$@" /usr/bin echo $(pwd)
+		local "$@" /usr/bin then sed ${HOME} /usr/bin x=1 then local echo test $(pwd)
+		test printf x=1 $(pwd) 2>/dev/null local ${HOME}
+		2>/dev/null /usr/bin x=1 $(pwd) readonly sed "$1" --verbose 2>/dev/null
+	echo cd cd readonly x=1 x=1 test -eu /usr/bin && readonly x=1
+	test /usr/bin readonly 'quoted text' awk test export 2>/dev/null grep && then
+${HOME} cd local | /usr/bin ${HOME} -eu && /usr/bin ${HOME} --verbose $(pwd) echo
+	local local export echo && awk --verbose export 'quoted text'
+	awk then ${HOME} && local sed | | 2>/dev/null "$1" -eu
+${HOME} then printf && && done export "$@" sed -eu sed
+		done && $(pwd) local -eu --verbose --verbose
+readonly --verbose && awk "$@" "$1" sed export export local cd test readonly
+	then local $(pwd) "$1"
+sed readonly ${HOME} readonly sed local
+/usr/bin awk test | -eu
+		| awk ${HOME} awk sed "$@" $(pwd) printf 2>/dev/null -eu 2>/dev/null
+		readonly | && then ${HOME} cd echo --verbose 2>/dev/null
+	| done x=1 sed readonly && 'quoted text' 2>/dev/null
+	done x=1 /usr/bin --verbose done then 2>/dev/null test grep test awk done
+	| grep 'quoted text' sed 'quoted text' && 'quoted text'
+	echo /usr/bin cd printf cd x=1 echo printf | cd ${HOME}
+done test sed 2>/dev/null | export readonly
+		grep echo done test 'quoted text' --verbose | "$@" "$1"
+		--verbose --verbose && | ${HOME} -eu
+		readonly --verbose x=1 --verbose
+		/usr/bin --verbose test sed echo printf done grep echo done done --verbose |
+	-eu echo /usr/bin ${HOME} grep awk
+		local | printf cd readonly readonly "$@" sed export local test
+cd 2>/dev/null awk ${HOME} grep ${HOME} export ${HOME} echo echo ${HOME} -eu
+		export echo awk -eu export && sed -eu export
+	/usr/bin awk test export sed
+	--verbose 'quoted text' grep "$@" ${HOME}
+	"$@" awk export readonly export
+		| local /usr/bin readonly test
+	cd done --verbose 2>/dev/null "$@" readonly
+	test -eu | printf test $(pwd) $(pwd) && --verbose done grep
+cd done sed ${HOME} x=1 2>/dev/null grep $(pwd) x=1 echo test export "$1" printf
+2>/dev/null echo sed then readonly
+		done sed -eu sed && cd
+	done x=1 --verbose grep ${HOME} grep readonly ${HOME} x=1 cd
+	2>/dev/null grep "$@" readonly grep done "$1" 2>/dev/null x=1 ${HOME} readonly
+grep local done then done && $(pwd) /usr/bin printf /usr/bin then -eu --verbose
+		2>/dev/null export echo ${HOME} $(pwd) "$@" && then
+	grep x=1 "$@" echo awk "$@" done x=1
+sed export | grep local $(pwd) local 2>/dev/null "$1" done
+		| grep "$@" -eu ${HOME} | x=1 sed then done cd then -eu --verbose ${HOME}
+then printf /usr/bin done test sed --verbose "$@"
+	awk x=1 local then x=1 "$1" then $(pwd) --verbose
+		'quoted text' "$@" 'quoted text' local local ${HOME} done sed
+	'quoted text' /usr/bin export awk echo -eu -eu 2>/dev/null local export x=1
+		cd && sed "$@" awk --verbose
+grep -eu 2>/dev/null && test | --verbose cd local awk grep "$1" x=1
+| readonly | sed --verbose $(pwd) /usr/bin x=1 printf x=1 done "$1" sed x=1
+	then printf "$1" done printf sed printf | grep "$1" -eu then echo
+		$(pwd) && done awk | && readonly "$1" /usr/bin done 2>/dev/null
+'quoted text' "$1" readonly awk echo awk test then printf
+	-eu sed awk && --verbose local
+		"$@" 2>/dev/null awk
+		'quoted text' printf export
+2>/dev/null cd -eu cd cd export "$1" && readonly "$@" cd local
+echo "$@" echo "$1" -eu grep --verbose
+		cd export test | local readonly sed awk test local 2>/dev/null /usr/bin
+	'quoted text' --verbose export grep export export local
+		printf cd done $(pwd) /usr/bin
+		"$@" x=1 local 2>/dev/null local grep
+		"$@" export 2>/dev/null 2>/dev/null
+	| ${HOME} done x=1 local cd test test sed $(pwd) awk test ${HOME} -eu export awk
+export "$@" x=1 'quoted text' grep ${HOME} sed echo | && cd
+cd --verbose readonly echo grep --verbose && && ${HOME} -eu grep printf "$1"
+sed printf sed local "$@" grep echo then && export --verbose
+	-eu "$@" $(pwd) grep cd 'quoted text'
+	printf -eu && then local /usr/bin test
+		'quoted text' export echo awk &&
+		test $(pwd) /usr/bin && export x=1
+		done sed | cd 'quoted text' 2>/dev/null 2>/dev/null then
+		readonly "$@" && "$1" echo $(pwd) -eu done ${HOME} done test
+	"$1" echo -eu sed then && done echo
+sed "$1" readonly cd --verbose awk echo readonly awk
+		-eu $(pwd) local sed then export
+done "$@" 2>/dev/null export x=1 "$1"
+$(pwd) 2>/dev/null local "$@" grep 2>/dev/null
+		then ${HOME} && awk done sed "$@" grep test && ${HOME} grep grep test
+	export awk 2>/dev/null grep 2>/dev/null /usr/bin /usr/bin
+	cd test sed -eu x=1 awk cd sed -eu x=1 awk -eu local
+	'quoted text' "$1" | | --verbose
+export awk $(pwd) cd printf test && ${HOME}
+	$(pwd) "$@" -eu "$1" then | done x=1 && 'quoted text'
+	"$1" ${HOME} awk "$@" test --verbose awk awk done && local | --verbose cd
+grep awk done $(pwd) "$@" cd 2>/dev/null
+	$(pwd) 'quoted text' done x=1 test printf done awk readonly
+		'quoted text' "$@" "$1" -eu then --verbose printf /usr/bin "$1"
+		sed 'quoted text' test "$1" /usr/bin grep -eu "$@" 'quoted text' awk | awk
+sed cd export readonly -eu grep grep | "$@" export readonly test ${HOME} local
+	cd /usr/bin awk && -eu && then
+		test "$@" -eu "$1" | local cd $(pwd) then test export export
+		echo done readonly then sed awk ${HOME} -eu 'quoted text' echo && && export /usr/bin
+		'quoted text' awk -eu done readonly then awk "$@" readonly 'quoted text'
+	local then done printf test 2>/dev/null cd done ${HOME}
+	'quoted text' -eu export grep echo
+		done && done printf sed -eu
+	--verbose && "$1" | readonly awk awk local 'quoted text' && export
+x=1 | | 2>/dev/null awk /usr/bin done | test local
+	| local && 2>/dev/null | export && awk export printf $(pwd) -eu sed |
+	cd awk 'quoted text' "$@" x=1 /usr/bin
+		--verbose && cd awk $(pwd) test test
+		| --verbose then sed cd done then test then
+test cd local --verbose test awk test
+		export sed "$@" /usr/bin 'quoted text' "$1" -eu echo x=1 local echo ${HOME}
+	grep awk ${HOME} -eu readonly done then echo export test 'quoted text' x=1 x=1 cd
+--verbose x=1 /usr/bin "$1" --verbose 'quoted text' grep && grep /usr/bin readonly
+		printf $(pwd) readonly test && | echo echo "$@"
+	x=1 && done local --verbose /usr/bin cd x=1
+	sed "$1" sed done echo grep echo printf test test "$@" awk x=1 echo | ${HOME} "$1"
+		readonly echo awk test /usr/bin local x=1 test sed 2>/dev/null sed $(pwd)
+	"$1" test local x=1 local test cd -eu | "$1" then sed ${HOME} grep readonly
+	'quoted text' --verbose x=1 echo test "$1" -eu 2>/dev/null echo test ${HOME} echo
+export | ${HOME} readonly sed -eu sed 'quoted text' readonly
+echo readonly && done /usr/bin
+		2>/dev/null --verbose && then ${HOME}
+echo | cd "$@" export "$@" | cd "$1" --verbose
+		--verbose | && done | "$@" 2>/dev/null -eu | | "$@" cd readonly 2>/dev/null
+	local done then "$@" x=1 2>/dev/null echo grep $(pwd)
+	sed x=1 local | test local test x=1 readonly /usr/bin
+		readonly $(pwd) "$1" ${HOME} then done sed && local x=1 awk test
+| readonly grep cd 'quoted text' export awk x=1 local
+'quoted text' readonly "$1" export && test /usr/bin done /usr/bin "$1"
+	--verbose export x=1 printf "$@" $(pwd) local then grep $(pwd) test
+	'quoted text' -eu printf grep "$1" x=1 "$1" export
+		test -eu "$@" ${HOME} printf then done | export test 2>/dev/null printf export done
+sed cd done local test readonly test 'quoted text' && sed grep done local | |
+		| /usr/bin done readonly x=1 $(pwd) awk 'quoted text'
+		done /usr/bin cd 2>/dev/null && -eu ${HOME} export grep then "$1" done local 'quoted text'
+	sed 2>/dev/null grep readonly done test $(pwd) --verbose
+	awk $(pwd) $(pwd) sed --verbose ${HOME} grep done printf ${HOME} && "$@"
+		awk 2>/dev/null 'quoted text' 2>/dev/null
+	grep test x=1 then cd | printf && | then done 2>/dev/null sed readonly readonly
+$(pwd) test | ${HOME} cd echo $(pwd) && awk 2>/dev/null readonly
+${HOME} "$@" echo 'quoted text' local export --verbose export
+	${HOME} ${HOME} -eu $(pwd) done -eu "$1" -eu -eu
+echo echo export done 2>/dev/null readonly readonly 'quoted text'
+grep then --verbose awk local export
+'quoted text' -eu "$@" sed cd
+grep "$1" readonly sed ${HOME} && grep /usr/bin local 2>/dev/null
+sed printf && local export awk ${HOME} readonly --verbose
+2>/dev/null "$1" done 'quoted text' 2>/dev/null cd test "$@" grep awk printf
+	then x=1 /usr/bin local ${HOME} /usr/bin -eu local -eu
+	| "$@" /usr/bin readonly readonly 2>/dev/null done printf sed
+		'quoted text' done | grep test ${HOME} 'quoted text'
+		export | cd 2>/dev/null cd ${HOME} readonly then printf test "$1" test
+		/usr/bin && echo local test printf $(pwd) printf 2>/dev/null "$1" 'quoted text'
+		readonly local test awk ${HOME} local /usr/bin "$1" awk -eu local | printf
+		-eu local awk 2>/dev/null readonly | "$1" readonly done "$@" 'quoted text'
+		&& sed 2>/dev/null awk && -eu && "$1"
+		then export x=1 then done grep cd /usr/bin x=1 "$@" export done test
+&& then "$1" awk $(pwd) done x=1 readonly
+-eu "$1" awk cd test cd done
+		export cd /usr/bin then cd "$1" sed then
+	2>/dev/null /usr/bin ${HOME} sed /usr/bin then readonly
+printf readonly | printf
+		export grep sed done printf --verbose "$1"
+		&& echo readonly printf ${HOME} grep readonly sed readonly
+	/usr/bin && grep export printf | $(pwd) echo
+		| done && test done test 'quoted text' && x=1 $(pwd) 'quoted text' test -eu grep
+		2>/dev/null $(pwd) done
+"$@" awk sed x=1 grep printf
+		local echo printf /usr/bin && sed export "$@" readonly echo
+		2>/dev/null 2>/dev/null done printf local x=1 awk
+	cd echo -eu local "$1" x=1 local then then done 'quoted text'
+		grep local x=1 $(pwd) sed | /usr/bin echo
+x=1 then printf "$1" export $(pwd) then /usr/bin echo /usr/bin
+	--verbose 2>/dev/null -eu
+	test done test /usr/bin
+	-eu readonly | awk "$@" grep |
+readonly printf ${HOME} "$1" export printf --verbose --verbose readonly
+/usr/bin done --verbose readonly 2>/dev/null done readonly ${HOME} ${HOME}
+		$(pwd) printf awk export awk
+	done export printf local awk | 'quoted text'
+sed x=1 done local grep test
+2>/dev/null 'quoted text'
+		"$1" local ${HOME} sed "$1" grep 'quoted text' done export then 'quoted text'
+	"$1" x=1 local ${HOME}
+		"$@" ${HOME} "$@" done sed sed local -eu | x=1 readonly export
+	done ${HOME} then sed "$@" 2>/dev/null printf 'quoted text' readonly awk $(pwd)
+		then test cd cd "$1" 'quoted text' | cd awk done "$1" printf x=1 /usr/bin awk
+readonly then && -eu done export --verbose ${HOME} 'quoted text'
+	readonly printf /usr/bin printf "$1" printf cd grep grep then test "$1"
+2>/dev/null awk -eu cd cd echo ${HOME} awk | $(pwd) export
+		awk test "$1" && local && export awk ${HOME} x=1 x=1 printf
+readonly && export | done $(pwd)
+		grep readonly ${HOME} then done echo
+-eu | $(pwd) --verbose && 'quoted text' -eu sed "$1" printf
+	test "$@" 2>/dev/null $(pwd)
+done sed then x=1 $(pwd) test x=1 sed
+'quoted text' done ${HOME} $(pwd) local export 2>/dev/null readonly
+		echo 'quoted text' done ${HOME}
+$(pwd) -eu x=1 2>/dev/null then awk $(pwd)
+	cd --verbose 2>/dev/null /usr/bin $(pwd) 'quoted text'
+		export | export 2>/dev/null
+2>/dev/null /usr/bin local
+grep ${HOME} export /usr/bin | 'quoted text' && awk awk && readonly readonly /usr/bin
+	x=1 sed 'quoted text' x=1 -eu readonly ${HOME} done
+	-eu && && -eu awk local readonly awk sed grep echo readonly | test ${HOME} x=1
+		readonly "$1" 2>/dev/null
+/usr/bin | readonly $(pwd) | 'quoted text'
+2>/dev/null then grep export "$1" /usr/bin /usr/bin
+	grep 2>/dev/null printf 2>/dev/null ${HOME} done x=1 | sed
+"$1" -eu readonly -eu 2>/dev/null sed 'quoted text' "$@" --verbose
+		echo --verbose --verbose test ${HOME} 'quoted text' | $(pwd) done 2>/dev/null
+	sed | $(pwd) "$@" 'quoted text' echo "$@" test
+awk sed local /usr/bin
+		"$1" x=1 local /usr/bin && x=1
+readonly "$@" test /usr/bin export
+local readonly x=1 'quoted text' then && printf
+echo | then | echo && ${HOME} printf sed awk sed --verbose
+	'quoted text' sed | /usr/bin sed | &&
+echo echo then then then readonly readonly --verbose
+		grep readonly done grep
+then cd /usr/bin --verbose && readonly echo
+export sed echo test && 2>/dev/null grep && readonly export grep | then &&
+	-eu echo $(pwd) $(pwd) 2>/dev/null
+'quoted text' | cd printf cd 'quoted text' test && x=1
+awk sed echo test "$1" "$1" && 'quoted text' printf awk && cd printf
+	${HOME} awk done x=1 'quoted text' --verbose
+	grep test printf then /usr/bin /usr/bin /usr/bin done echo done x=1 "$@" &&
+local 2>/dev/null printf ${HOME} awk
+-eu ${HOME} -eu printf 2>/dev/null
+x=1 -eu done readonly
+	x=1 && export 2>/dev/null && && test -eu readonly test test
+		printf then && awk 2>/dev/null "$@" test
+	| --verbose test awk readonly cd export cd echo awk /usr/bin 'quoted text' x=1
+'quoted text' "$1" export "$@" $(pwd)
+		/usr/bin && sed then grep then grep | x=1 sed export ${HOME}
+-eu cd -eu /usr/bin awk echo printf
+	2>/dev/null cd export $(pwd) then readonly echo test "$1" | awk then awk
+		awk -eu export echo cd done $(pwd)
+	"$@" 'quoted text' --verbose local -eu
+		"$@" test | sed awk -eu cd /usr/bin export "$1" x=1 sed
+	grep readonly echo $(pwd) -eu ${HOME} ${HOME} readonly local
+		then printf readonly -eu awk /usr/bin local --verbose sed echo "$@"
+		"$@" awk sed readonly --verbose "$@" 'quoted text' export
+grep readonly test readonly cd /usr/bin x=1 grep && --verbose test
+	local && then done "$@" ${HOME} -eu ${HOME} "$1" test export
+	"$1" sed sed "$1" grep done grep 2>/dev/null
+	then 'quoted text' export -eu then "$@" 'quoted text'
+then readonly "$@" grep export readonly && then test | | test printf readonly export
+	&& "$1" && "$1" -eu cd sed readonly
+	--verbose 2>/dev/null sed done echo 2>/dev/null "$1" echo
+	'quoted text' --verbose local readonly "$@"
+echo -eu "$@" awk export then sed --verbose readonly test export
+		cd --verbose 2>/dev/null ${HOME} --verbose | -eu "$@" ${HOME} echo && cd readonly
+awk export cd printf test &&
+	"$1" "$@" "$@" -eu readonly awk x=1
+		echo "$@" | x=1 'quoted text' -eu grep grep printf export test readonly -eu "$1"
+	2>/dev/null $(pwd) && test printf "$@" test
+	$(pwd) sed --verbose awk local grep x=1 then echo printf export x=1 then grep $(pwd)
+cd ${HOME} awk ${HOME} /usr/bin 2>/dev/null
+		${HOME} 2>/dev/null sed "$1" "$@" "$1" sed "$1" "$1" /usr/bin x=1 echo
+		export | grep --verbose 'quoted text' export
+cd -eu /usr/bin echo | local then
+		test 'quoted text' 2>/dev/null cd printf
+	done then -eu test x=1
+	grep /usr/bin echo x=1 local -eu 2>/dev/null "$@" test awk 2>/dev/null ${HOME}
+	/usr/bin awk local readonly awk "$@" export /usr/bin -eu
+		sed local printf echo done 'quoted text' test test ${HOME}
+	2>/dev/null | -eu awk done x=1 2>/dev/null --verbose
+&& ${HOME} -eu awk then ${HOME} then cd "$1" "$1" /usr/bin grep awk printf
+	'quoted text' $(pwd) done cd x=1 export sed printf export sed test 'quoted text'
+| echo "$1" /usr/bin sed sed done /usr/bin
+		grep "$1" "$1" sed 2>/dev/null test /usr/bin $(pwd) export then x=1 -eu
+	awk cd test x=1 grep grep x=1 ${HOME} "$@" x=1 echo test then && x=1
+	test --verbose 'quoted text' readonly "$@" "$1" ${HOME} test 2>/dev/null
+		&& -eu grep cd local "$@" | /usr/bin "$@" export local done then
+		x=1 -eu | && -eu readonly printf 'quoted text' awk
+	echo export $(pwd) cd $(pwd) 2>/dev/null echo 2>/dev/null
+	-eu /usr/bin done ${HOME} |
+		cd cd 'quoted text' cd ${HOME} $(pwd) --verbose
+local readonly grep echo local x=1
+	"$@" | "$1" export --verbose
+		x=1 echo test 2>/dev/null sed test readonly 'quoted text'
+--verbose $(pwd) ${HOME} awk echo export echo $(pwd)
+	test readonly /usr/bin -eu export export grep
+		| cd then | grep sed export 'quoted text'
+		$(pwd) done local cd cd done x=1 'quoted text' "$@" -eu grep $(pwd) done test $(pwd)
+--verbose "$1" && awk then sed ${HOME}
+| -eu echo echo cd then "$1" then 2>/dev/null
+		2>/dev/null $(pwd) "$@" grep -eu done local /usr/bin readonly | ${HOME}
+	grep local && awk "$1" x=1 x=1 grep
+		cd $(pwd) "$@" done /usr/bin --verbose
+x=1 export 'quoted text' -eu then cd done --verbose && printf
+-eu | sed | test sed done $(pwd) export $(pwd) x=1 grep local 'quoted text' printf
+/usr/bin x=1 -eu ${HOME} then -eu test 'quoted text'
+awk test test $(pwd) 'quoted text' local grep $(pwd) export
+		awk "$1" cd export x=1
+		sed 2>/dev/null printf | 'quoted text' cd | ${HOME}
+	printf -eu 2>/dev/null x=1 $(pwd) done -eu printf | cd then readonly cd
+		test test export "$1" | --verbose
+"$1" sed echo grep 2>/dev/null grep
+	echo grep x=1 "$@" echo x=1 | | then -eu sed && readonly $(pwd)
+done 2>/dev/null printf cd 'quoted text' ${HOME}
+	test echo readonly cd then "$@"
+	grep 'quoted text' x=1 $(pwd) then echo readonly
+	done export export $(pwd) 'quoted text' sed "$@" $(pwd)
+cd cd export readonly grep $(pwd) awk grep 'quoted text'
+export then && grep && sed && 2>/dev/null export cd "$1" printf /usr/bin "$1" export
+	sed -eu --verbose done $(pwd) sed 'quoted text'
+		printf local /usr/bin 2>/dev/null local 'quoted text' "$1" test awk readonly
+-eu then cd readonly local grep 2>/dev/null grep awk done local 2>/dev/null
+		done export readonly printf
+	'quoted text' done && awk echo "$1" -eu echo readonly echo x=1 --verbose cd readonly
+	echo printf readonly then 'quoted text' sed awk
+readonly then x=1 x=1 awk x=1 cd && /usr/bin && readonly && awk
+	grep echo grep 'quoted text'
+		$(pwd) -eu done awk awk "$1" "$@" echo "$1" echo --verbose 2>/dev/null
+export sed ${HOME} x=1 2>/dev/null echo done --verbose sed
+export /usr/bin 2>/dev/null -eu then
+	| printf ${HOME} "$1" sed && printf 2>/dev/null test
+		"$1" grep ${HOME} --verbose --verbose -eu 'quoted text'
+	awk then cd --verbose readonly && printf readonly /usr/bin
+	local "$1" && x=1 readonly && | awk "$@" test export | -eu readonly 'quoted text'
+		"$@" export readonly 'quoted text'
+	then then x=1 echo done | then awk 2>/dev/null
+then local -eu export 'quoted text' done -eu x=1 'quoted text'
+	x=1 readonly && | 2>/dev/null test local readonly -eu printf awk
+		| grep cd sed then && && then
+readonly then "$@" && sed awk test && awk grep "$@" "$@" $(pwd) readonly
+	x=1 -eu && --verbose x=1 | sed local && grep awk then grep test x=1
+		cd grep && x=1 printf printf -eu awk echo
+		awk cd awk printf $(pwd) readonly x=1 sed x=1 ${HOME} local && readonly
+		'quoted text' && ${HOME} --verbose sed readonly printf export export awk 2>/dev/null
+test awk awk x=1 /usr/bin "$1" cd /usr/bin cd -eu sed
+	$(pwd) cd && then cd 'quoted text' 2>/dev/null "$1" local grep
+	"$1" printf 2>/dev/null readonly && done --verbose sed ${HOME}
+		printf done then then && grep then
+echo awk awk test echo grep --verbose grep
+	2>/dev/null readonly printf cd echo export echo && awk sed awk local
+		done done 2>/dev/null cd "$1" ${HOME}
+	/usr/bin test cd 2>/dev/null 'quoted text' test then readonly local
+		x=1 --verbose "$@" then export grep -eu ${HOME} $(pwd) grep --verbose
+	/usr/bin printf test then x=1
+		${HOME} 'quoted text' export test readonly awk local ${HOME} then "$1"
+"$1" /usr/bin printf done cd x=1 -eu | --verbose
+'quoted text' echo done local local cd readonly awk
+		"$1" printf cd sed --verbose then awk done readonly ${HOME}
+	/usr/bin && done ${HOME} readonly ${HOME} x=1
+	readonly ${HOME} -eu test awk echo "$1" export "$1" then "$1"
+		| cd sed | sed 'quoted text' | done done 2>/dev/null then cd
+		cd 2>/dev/null ${HOME} |
+		then done echo $(pwd) printf $(pwd) 2>/dev/null
+	printf readonly then awk
+		"$@" "$1" grep /usr/bin
+		&& then | $(pwd) 'quoted text'
+		done $(pwd) | export echo cd $(pwd) | local 'quoted text' && test
+2>/dev/null printf "$1" echo cd readonly readonly export echo cd grep 2>/dev/null
+		${HOME} readonly grep awk /usr/bin "$@" grep printf
+&& local printf done cd "$1" echo cd readonly local -eu 'quoted text'
+--verbose 'quoted text' export printf then x=1 cd export $(pwd) local
+sed local /usr/bin test $(pwd) test printf
+	export cd printf --verbose awk cd sed 'quoted text' echo "$1"
+	| local cd echo grep 2>/dev/null echo done | x=1 then cd test /usr/bin
+		done export local && grep "$1" | "$1" 'quoted text' local "$@" | test cd
+${HOME} | "$@" cd export sed "$1" --verbose ${HOME} printf done sed ${HOME}
+	| $(pwd) done "$@" local && --verbose ${HOME}
+awk export "$@" sed awk -eu "$1" sed 'quoted text' -eu done "$1" test --verbose
+awk $(pwd) ${HOME} readonly export "$@" /usr/bin -eu sed grep grep done
+readonly awk -eu 'quoted text' printf x=1 "$1" grep
+	sed sed grep test test "$@" local 'quoted text' readonly ${HOME} $(pwd) -eu
+	cd --verbose cd ${HOME} echo export --verbose readonly
+2>/dev/null sed grep 2>/dev/null x=1 --verbose
+'quoted text' echo readonly x=1 done && cd awk 2>/dev/null
+printf sed && "$1" echo cd grep "$@" 'quoted text' cd awk
+then echo "$1" $(pwd) "$1" $(pwd) export readonly
+'quoted text' export awk
+&& ${HOME} x=1 x=1 echo
+export ${HOME} local -eu grep test cd printf
+		--verbose test sed then test printf
+	readonly test sed test ${HOME} /usr/bin readonly 2>/dev/null
+	local | readonly done awk 2>/dev/null local $(pwd)
+		cd x=1 grep grep test printf /usr/bin sed cd awk "$@" "$@" echo readonly "$1"
+&& ${HOME} -eu | "$@" ${HOME} "$@" 2>/dev/null "$@" 2>/dev/null cd
+	"$@" $(pwd) $(pwd) 'quoted text' readonly /usr/bin
+		export cd $(pwd) test ${HOME} awk ${HOME} export 'quoted text'
+	local --verbose export /usr/bin local -eu "$1"
+		'quoted text' --verbose x=1 sed
+--verbose then "$@" then awk /usr/bin printf
+		"$1" | | done /usr/bin local
+	sed echo ${HOME} x=1 | | "$1" x=1 "$@" ${HOME} sed cd
+		"$1" 2>/dev/null /usr/bin local x=1 | grep --verbose echo --verbose export |
+		'quoted text' "$1" cd
+		done x=1 echo "$@" echo done $(pwd) x=1 then "$@" test export done done
+	then local /usr/bin x=1 printf
+then local ${HOME} "$@" export "$1" ${HOME} "$1" cd ${HOME}
+		printf /usr/bin && test && --verbose "$@" then -eu -eu grep awk
+	done sed awk 2>/dev/null echo | ${HOME} -eu
+test /usr/bin export ${HOME} "$@" printf export /usr/bin
+	&& && --verbose --verbose x=1
+	2>/dev/null grep | echo sed export export local 'quoted text'
+cd echo sed --verbose 'quoted text' --verbose
+	"$1" grep 'quoted text' && export ${HOME}
+${HOME} done | readonly "$@" $(pwd) $(pwd) echo grep awk echo grep ${HOME}
+test grep awk done ${HOME} export local --verbose x=1 && sed
+		echo 2>/dev/null -eu then sed --verbose && x=1 cd printf
+	test 'quoted text' 'quoted text' local x=1 echo
+		&& | cd 'quoted text' && 'quoted text' ${HOME} | && awk readonly "$1" 2>/dev/null
+		2>/dev/null awk test done grep &&
+		"$@" /usr/bin sed "$@" -eu export -eu done
+		${HOME} readonly && awk --verbose "$@" --verbose
+	local ${HOME} $(pwd) test done printf export $(pwd) then &&
+	done grep sed | readonly local
+		x=1 then printf | grep "$@" -eu | && $(pwd) && awk
+	-eu 2>/dev/null $(pwd) then
+export printf grep $(pwd) test test $(pwd) grep --verbose grep grep /usr/bin
+	"$@" "$1" test export sed awk readonly $(pwd)
+	"$1" ${HOME} sed export "$1" && grep export 'quoted text' 'quoted text' /usr/bin
+	$(pwd) then awk "$1" && 'quoted text' echo "$@" $(pwd) ${HOME} then
+	'quoted text' export cd readonly done grep sed
+	local 'quoted text' echo 2>/dev/null then 2>/dev/null && done then printf
+$(pwd) 'quoted text' test export test readonly 2>/dev/null && test
+	test export -eu awk && local sed readonly
+&& && /usr/bin then sed printf ${HOME}
+	echo grep /usr/bin | cd /usr/bin $(pwd)
+awk x=1 && awk --verbose "$1" | --verbose done then test
+-eu | test test sed cd 'quoted text' | export "$@" export x=1 "$@" $(pwd)
+	test 'quoted text' test export -eu test | then
+export -eu 2>/dev/null
+		'quoted text' 'quoted text' sed && test 'quoted text' 'quoted text'
+	awk awk done | 'quoted text'
+	&& readonly -eu /usr/bin --verbose $(pwd) /usr/bin echo "$1" 2>/dev/null
+		--verbose x=1 awk x=1 echo
+	cd test | printf ${HOME} cd | cd x=1 local printf $(pwd) ${HOME} local local grep
+		export then readonly 'quoted text' done "$@" export
+		-eu local cd grep cd then $(pwd) "$1" test local
+	then -eu x=1 --verbose "$@" printf && "$1" cd "$1" "$1" then awk &&
+	test then 2>/dev/null /usr/bin /usr/bin 2>/dev/null x=1 $(pwd) --verbose
+	local x=1 grep sed && --verbose
+sed && -eu $(pwd) $(pwd) $(pwd) -eu ${HOME} $(pwd) test awk then
+		cd awk cd && && sed local && && sed then cd -eu readonly
+	| $(pwd) done ${HOME} grep then --verbose "$1" --verbose sed
+		"$1" --verbose /usr/bin readonly printf x=1 -eu printf
+	awk 2>/dev/null local export x=1 "$1" 'quoted text' --verbose
+export -eu awk awk echo x=1 done
+	| && "$@" printf done $(pwd) 'quoted text' test readonly
+"$@" /usr/bin local $(pwd)
+	'quoted text' test ${HOME} ${HOME} x=1 cd "$@" ${HOME}
+'quoted text' $(pwd) readonly local printf test
+		printf --verbose x=1 printf /usr/bin awk echo && $(pwd)
+x=1 sed then export --verbose test grep -eu echo cd $(pwd)
+"$@" cd -eu readonly done readonly | grep cd local 'quoted text' 2>/dev/null
+	cd sed | awk awk sed && x=1 "$@" export
+		cd && -eu then "$@" 2>/dev/null cd readonly
+	sed /usr/bin then done cd --verbose
+"$@" local sed sed 2>/dev/null /usr/bin cd test test cd "$@" /usr/bin
+	test && "$1" x=1 --verbose printf && awk grep -eu grep
+| test "$1" printf --verbose readonly --verbose awk $(pwd) --verbose
+echo --verbose awk x=1 -eu awk "$1" readonly --verbose
+	test local | test test sed /usr/bin && echo echo echo echo -eu readonly "$1"
+-eu then /usr/bin readonly | 'quoted text' -eu echo
+| "$1" grep ${HOME} cd then | printf awk 2>/dev/null
+		export awk | /usr/bin sed done /usr/bin then then grep readonly
+	echo echo export $(pwd) -eu | ${HOME}
+"$1" export sed ${HOME} /usr/bin then
+	| cd /usr/bin --verbose |
+&& -eu | export 2>/dev/null 'quoted text' x=1 readonly
+	$(pwd) $(pwd) "$@" printf -eu /usr/bin
+		-eu test ${HOME} test then test echo cd sed "$@" local 'quoted text'
+| x=1 "$1" ${HOME} $(pwd) "$@" readonly awk ${HOME} ${HOME} "$1" 2>/dev/null
+	| grep grep $(pwd) "$@" grep 2>/dev/null
+-eu done export "$1" "$@" cd --verbose && -eu echo | && 2>/dev/null
+	"$@" 2>/dev/null 'quoted text' printf
+		local 'quoted text' ${HOME} echo echo x=1 'quoted text'
+	export readonly sed grep
+${HOME} then then cd echo readonly ${HOME} done grep cd -eu
+cd export "$1" ${HOME} "$1" awk
+'quoted text' && sed cd sed
+awk --verbose 2>/dev/null -eu printf
+$(pwd) x=1 local local readonly readonly
+	echo "$@" 'quoted text' "$@" done ${HOME} printf local | "$@"
+	printf ${HOME} then $(pwd)
+awk -eu grep test export x=1 cd readonly -eu -eu x=1 ${HOME} "$@"
+	grep cd echo -eu then $(pwd) | echo && x=1 grep /usr/bin local grep printf
+then | 2>/dev/null echo $(pwd) awk 2>/dev/null echo
+		2>/dev/null /usr/bin 2>/dev/null grep cd sed 2>/dev/null
+&& 2>/dev/null /usr/bin | grep "$@" && echo echo /usr/bin x=1 $(pwd)
+	"$@" 'quoted text' "$@" | printf local local 'quoted text' local
+"$@" "$1" grep --verbose 'quoted text' -eu cd --verbose x=1 /usr/bin
+local /usr/bin | "$1" ${HOME}
+"$@" then | export export grep echo x=1 "$@" "$@"
+		sed readonly "$1" 'quoted text' $(pwd) 'quoted text'
+	&& local sed && ${HOME} printf then grep done
+-eu grep 'quoted text' /usr/bin
+		then test 'quoted text' | done --verbose ${HOME} readonly
+cd --verbose test /usr/bin && grep readonly "$1" cd x=1 x=1 --verbose
+	readonly test readonly export test test | -eu | 2>/dev/null done
+	then sed "$@" && -eu echo -eu then local &&
+	&& "$1" $(pwd) sed echo grep && x=1 -eu "$1"
+--verbose | /usr/bin awk $(pwd) -eu 2>/dev/null
+grep readonly readonly | | echo readonly $(pwd) cd then
+		sed && /usr/bin printf --verbose 2>/dev/null
+	| 2>/dev/null "$@" "$@" test readonly then done export -eu | awk then
+	| | printf --verbose /usr/bin
+-eu grep printf then --verbose
+grep --verbose test printf 'quoted text'
+"$1" ${HOME} "$1" -eu echo echo | && sed
+	cd test sed awk cd readonly -eu
+	"$@" 2>/dev/null test /usr/bin then --verbose printf local grep grep grep
+${HOME} 'quoted text' export x=1 done /usr/bin $(pwd) then local $(pwd) $(pwd)
+		done /usr/bin "$@" $(pwd) sed awk x=1 test done --verbose x=1 cd /usr/bin "$1" /usr/bin
+		done "$1" awk printf then grep grep done "$1"
+	/usr/bin | echo -eu -eu x=1 --verbose local $(pwd) then 'quoted text' echo
+		&& sed printf /usr/bin -eu grep
+printf readonly printf grep sed /usr/bin sed && done
+&& x=1 /usr/bin grep && awk test then readonly
+	--verbose echo echo test 2>/dev/null 'quoted text' awk -eu $(pwd)
+		grep local "$1" awk "$1" echo then "$1" grep
+sed x=1 cd readonly export echo /usr/bin printf echo "$1" |
+		$(pwd) then printf && test x=1 then test "$1" "$1" $(pwd) --verbose ${HOME} |
+	2>/dev/null grep x=1 then $(pwd) "$1" local --verbose -eu grep "$@" cd
+		cd readonly 2>/dev/null echo "$@" "$1" done 2>/dev/null | readonly "$@" sed sed
+	awk "$@" -eu test $(pwd) --verbose sed
+	grep ${HOME} x=1 test "$1" "$@" ${HOME} printf ${HOME} local local echo
+	&& test then --verbose cd printf
+		/usr/bin done readonly test echo echo 2>/dev/null ${HOME} | cd 2>/dev/null
+		${HOME} echo "$1" -eu cd printf
+	sed cd then 2>/dev/null | export sed readonly sed 'quoted text'
+"$1" export 'quoted text' sed
+awk 2>/dev/null then -eu 2>/dev/null sed x=1 x=1 printf readonly
+then cd $(pwd) | /usr/bin export test awk grep readonly
+-eu printf -eu awk 'quoted text' local
+-eu "$1" ${HOME} test test
+	"$1" local && 2>/dev/null --verbose --verbose
+grep && --verbose printf
+	cd cd --verbose $(pwd) sed "$1" ${HOME} ${HOME} | then then x=1 export
+		${HOME} awk "$1" local local "$1" grep "$@"
+		printf | local local awk "$1" ${HOME} cd done sed 'quoted text' $(pwd) then
+	local awk --verbose --verbose 'quoted text' | ${HOME} $(pwd)
+		"$1" echo awk -eu echo echo grep awk export done "$1"
+	x=1 2>/dev/null grep export x=1 done grep readonly 2>/dev/null
+		-eu cd cd -eu echo $(pwd) echo ${HOME} | sed && x=1 export sed then --verbose
+"$@" echo ${HOME} "$1" local ${HOME} readonly
+		-eu 'quoted text' 'quoted text'
+x=1 "$@" -eu readonly --verbose done ${HOME} /usr/bin
+done test printf cd 'quoted text' $(pwd)
+		printf export -eu "$1" 'quoted text' $(pwd) 'quoted text' "$@" sed &&
+		"$@" x=1 readonly grep x=1 awk readonly
+grep sed 'quoted text' cd 'quoted text' cd sed sed local then 'quoted text'
+export /usr/bin 'quoted text' 'quoted text' --verbose echo
+		| cd 2>/dev/null then 'quoted text'
+/usr/bin readonly printf ${HOME} then ${HOME}
+"$1" done test 'quoted text' done 'quoted text' 2>/dev/null && local -eu "$@"
+x=1 --verbose /usr/bin printf
+		"$@" done 'quoted text' "$@" --verbose -eu "$@" cd grep
+		done grep /usr/bin test test ${HOME} test /usr/bin
+		printf && export awk && -eu readonly 'quoted text' test x=1 cd | awk -eu
+	"$@" 'quoted text' local "$@" cd printf /usr/bin "$@"
+	"$@" grep -eu test test x=1 printf echo -eu done | 'quoted text' 'quoted text'
+	| cd "$1" && then printf && ${HOME} $(pwd) |
+	&& awk -eu echo grep 'quoted text' printf -eu
+		awk printf then 'quoted text' --verbose 2>/dev/null
+		then grep && sed 'quoted text' | $(pwd) 'quoted text'
+	$(pwd) echo 2>/dev/null readonly test grep "$@" done -eu local
+	-eu ${HOME} grep cd readonly
+	-eu | printf echo && awk | 2>/dev/null awk awk sed
+	local cd done 2>/dev/null local awk cd $(pwd) local done echo
+"$@" readonly 'quoted text' printf done
+		'quoted text' 2>/dev/null export && grep
+echo then /usr/bin x=1 then x=1 | ${HOME} awk done grep "$@" -eu then then
+		$(pwd) cd "$@" "$1" && "$@" $(pwd) readonly cd
+awk x=1 -eu 'quoted text' $(pwd)
+'quoted text' done then local ${HOME} $(pwd) "$@" grep
+		'quoted text' | ${HOME} grep -eu
+		test 'quoted text' echo
+	$(pwd) local test /usr/bin
+		grep then export test ${HOME} $(pwd) awk echo
+echo cd readonly test echo sed done 2>/dev/null printf then /usr/bin
+	"$@" $(pwd) "$1" && echo "$@"
+	"$@" && local local x=1 export && cd
+	local ${HOME} readonly test readonly $(pwd) done | awk | --verbose export
+	cd readonly "$1" "$@" 'quoted text'
+2>/dev/null --verbose 2>/dev/null ${HOME} -eu sed echo --verbose awk awk
+	/usr/bin --verbose awk /usr/bin --verbose 2>/dev/null readonly --verbose cd --verbose
+		/usr/bin x=1 test then echo echo done test 'quoted text'
+"$1" /usr/bin $(pwd) x=1 grep cd printf sed echo "$@" cd | export
+	'quoted text' done export done $(pwd) 'quoted text'
+		$(pwd) 2>/dev/null then 'quoted text'
+		-eu echo grep done | /usr/bin local "$@" awk x=1 /usr/bin
+		printf printf /usr/bin "$@" awk "$1" local awk grep
+sed awk grep grep "$@" "$1" /usr/bin sed "$1" awk done && "$1" local
+	"$1" readonly $(pwd) echo && && --verbose grep "$1"
+	x=1 cd grep | $(pwd) export local printf --verbose "$1" 2>/dev/null
+"$@" $(pwd) "$1" cd --verbose then ${HOME} x=1 ${HOME} awk ${HOME}
+	printf export awk | 2>/dev/null --verbose readonly
+		sed ${HOME} printf printf "$@" printf sed export
+		"$@" && local 'quoted text' ${HOME} x=1 printf -eu readonly x=1 export
+	${HOME} "$@" readonly $(pwd) printf $(pwd) ${HOME} ${HOME}
+sed local cd readonly --verbose sed awk ${HOME} cd $(pwd)
+		-eu done "$@" ${HOME} "$1" | printf local | "$@"
+		export 'quoted text' ${HOME} "$@"
+		"$@" -eu awk $(pwd) cd $(pwd) echo cd awk && 2>/dev/null -eu x=1
+	&& 'quoted text' awk 2>/dev/null 'quoted text'
+export x=1 && cd -eu export then /usr/bin "$1" cd export 'quoted text' x=1
+	| echo "$1" cd echo /usr/bin
+	${HOME} x=1 | readonly "$@" then /usr/bin cd
+	| --verbose awk 'quoted text' test 'quoted text' 'quoted text' && test
+2>/dev/null export awk readonly then | x=1 echo
+	grep test local $(pwd) awk
+	export --verbose done x=1 | local
+-eu done | "$1" --verbose done ${HOME} cd --verbose
+		readonly test then export
+		"$1" local -eu test /usr/bin sed printf sed 2>/dev/null
+'quoted text' test && --verbose local export
+		/usr/bin -eu 'quoted text'
+$(pwd) | "$@" $(pwd) /usr/bin printf
+		printf echo $(pwd) readonly cd export then ${HOME} --verbose
+	cd ${HOME} cd ${HOME} test && ${HOME} done 2>/dev/null ${HOME}
+		sed | printf /usr/bin -eu && 2>/dev/null
+		${HOME} 'quoted text' --verbose cd -eu --verbose local test done x=1
+		cd local /usr/bin local /usr/bin test cd export
+readonly "$@" /usr/bin "$@" 'quoted text' ${HOME} readonly echo $(pwd) x=1
+		echo /usr/bin | readonly awk x=1
+		done $(pwd) | then && cd echo 'quoted text' sed 'quoted text' echo "$1" "$1"
+		grep ${HOME} ${HOME} /usr/bin /usr/bin | test printf sed | readonly awk
+test ${HOME} awk export done test readonly echo awk readonly local
+	| ${HOME} sed echo --verbose
+	$(pwd) awk $(pwd) then $(pwd) -eu readonly export
+		awk cd 2>/dev/null awk printf printf "$@" 2>/dev/null /usr/bin grep 'quoted text'
+| sed grep done | awk cd --verbose local export
+		done "$@" "$@" "$@" --verbose cd sed 2>/dev/null
+${HOME} local grep then echo "$@" "$1" "$1"
+		export ${HOME} readonly awk awk "$1" cd readonly test
+	then --verbose export done
+test ${HOME} local readonly | local test
+echo then echo $(pwd) $(pwd) --verbose | grep export done &&
+then readonly && 2>/dev/null -eu printf cd then awk readonly
+$(pwd) then printf /usr/bin ${HOME} echo && done echo
+		$(pwd) "$@" $(pwd) awk awk
+| 'quoted text' awk done "$@" echo
+	cd cd local --verbose
+	awk --verbose | | 'quoted text' 2>/dev/null
+		local ${HOME} x=1 local export echo export sed
+	test printf x=1 | echo x=1 && test done /usr/bin | export done then 'quoted text'
+	sed test then printf then "$@" sed echo && $(pwd) printf
+	'quoted text' then "$1" then ${HOME}
+	-eu "$1" sed -eu printf then 'quoted text' "$@" 2>/dev/null && awk export
+${HOME} 'quoted text' ${HOME}
+	2>/dev/null "$@" && done sed then $(pwd)
+	$(pwd) printf grep grep /usr/bin test "$@" "$@" sed awk then 'quoted text' grep
+	awk ${HOME} 2>/dev/null then --verbose grep test readonly test 2>/dev/null "$1"
+	then /usr/bin && /usr/bin && test printf sed "$1" test "$1" 'quoted text'
+		--verbose --verbose 2>/dev/null
+		"$@" awk && 'quoted text' local awk -eu 2>/dev/null
+	x=1 "$1" awk && done cd sed
+printf grep "$1" "$1" local 2>/dev/null $(pwd)
+	local && 2>/dev/null awk echo then /usr/bin sed 'quoted text'
+${HOME} echo 2>/dev/null readonly ${HOME} "$@" readonly awk
+		grep awk readonly 'quoted text' ${HOME} ${HOME} x=1 | local done cd --verbose
+printf test test printf test $(pwd) /usr/bin 2>/dev/null grep
+sed cd printf 'quoted text' cd local 2>/dev/null grep printf /usr/bin $(pwd)
+		grep -eu grep grep then "$@" readonly awk && export grep grep
+		then ${HOME} 2>/dev/null "$@" test "$@" done x=1 -eu | /usr/bin test $(pwd) grep
+		&& readonly cd then printf 'quoted text' $(pwd) ${HOME} "$@" then -eu grep
+	readonly awk 'quoted text' echo "$1"
+grep cd readonly $(pwd) sed export --verbose grep -eu done awk cd
+		awk $(pwd) local --verbose test && --verbose
+	cd -eu x=1 --verbose x=1 --verbose | 'quoted text' readonly
+	awk echo 2>/dev/null | printf 'quoted text' 2>/dev/null
+	2>/dev/null export done $(pwd)
+	local | readonly $(pwd) 'quoted text' -eu 2>/dev/null printf printf
+		readonly 2>/dev/null 'quoted text' ${HOME}
+	"$@" done printf "$@" cd export $(pwd) -eu 2>/dev/null
+	sed 2>/dev/null export grep "$1" readonly echo | 'quoted text'
+	-eu 2>/dev/null x=1 cd readonly | && cd 'quoted text' readonly -eu
+echo cd 2>/dev/null local x=1 --verbose 2>/dev/null export --verbose local ${HOME}
+	test ${HOME} -eu test "$1" printf
+	/usr/bin sed done then /usr/bin grep
+		echo "$1" /usr/bin /usr/bin printf -eu ${HOME} cd -eu "$@" echo 'quoted text'
+		test "$1" cd cd $(pwd) -eu then 'quoted text' done echo cd /usr/bin
+		readonly local | done "$1" $(pwd) && 'quoted text' x=1 echo -eu done
+		readonly sed echo 2>/dev/null && x=1 readonly $(pwd) awk $(pwd) "$@" done
+printf done echo && cd -eu $(pwd) && x=1 -eu "$1" test sed then
+then cd done printf "$1" cd sed 'quoted text'
+sed | readonly $(pwd) /usr/bin 'quoted text' export
+done export cd -eu test ${HOME} /usr/bin | && $(pwd)
+		"$1" "$1" readonly echo cd -eu "$1"
+	cd | printf done ${HOME} /usr/bin then grep
+		printf test grep done
+x=1 printf 'quoted text' $(pwd) --verbose | -eu 'quoted text' readonly echo ${HOME}
+	"$1" | | $(pwd) export --verbose x=1 "$@" /usr/bin test
+	| local && echo | grep awk then
+		| sed echo grep | export && done local "$1" /usr/bin awk awk
+	then && awk grep awk | awk awk
+		cd ${HOME} ${HOME} grep
+awk "$@" "$1" "$1" $(pwd) && "$1" local 'quoted text' sed --verbose 'quoted text'
+		2>/dev/null 2>/dev/null grep -eu --verbose
+		$(pwd) /usr/bin --verbose local --verbose readonly "$@" "$1" && sed --verbose
+${HOME} echo sed done grep /usr/bin export export
+	2>/dev/null 2>/dev/null test
+cd local local x=1 awk export 2>/dev/null 2>/dev/null /usr/bin -eu done grep
+-eu ${HOME} x=1 ${HOME} | --verbose ${HOME} --verbose
+$(pwd) -eu ${HOME} local then
+	-eu | 'quoted text' local | sed export then readonly 'quoted text' local readonly
+${HOME} cd -eu && printf 2>/dev/null readonly 2>/dev/null
+$(pwd) && x=1 printf ${HOME} && test
+	$(pwd) && 'quoted text' grep
+		test sed then printf export 'quoted text' "$@" echo && test 2>/dev/null
+	readonly -eu local sed done "$1" && test readonly export
+"$@" x=1 "$@" done sed echo awk printf $(pwd) $(pwd) 2>/dev/null
+echo echo then then then cd readonly printf printf local /usr/bin then --verbose
+	| 'quoted text' awk x=1 grep && "$@" 'quoted text' "$@" grep x=1 $(pwd) 2>/dev/null
+	awk echo $(pwd) readonly printf echo --verbose done 2>/dev/null done x=1
+		awk --verbose -eu 2>/dev/null awk 2>/dev/null grep sed x=1 x=1 echo
+	x=1 /usr/bin test readonly --verbose
+--verbose then test sed | cd /usr/bin done sed 2>/dev/null
+readonly --verbose done -eu --verbose cd 2>/dev/null "$@"
+-eu | && 'quoted text' --verbose /usr/bin sed cd sed readonly 'quoted text'
+	cd done cd 'quoted text'
+then readonly ${HOME} grep "$@" "$1" | | ${HOME} "$1"
+then && x=1 readonly test ${HOME} "$1" local -eu 'quoted text' "$1" 'quoted text'
+	local 'quoted text' "$@" 2>/dev/null cd -eu
+		local | local "$1" echo done -eu 'quoted text' grep printf 2>/dev/null
+		| --verbose "$@" cd -eu then
+test | then then "$1" -eu local ${HOME}
+		${HOME} printf readonly --verbose then
+grep $(pwd) "$1" readonly 2>/dev/null
+		cd awk --verbose printf ${HOME} export export
+&& /usr/bin x=1 local /usr/bin done | done sed printf done
+printf | | awk echo export $(pwd) grep cd done ${HOME} ${HOME}
+/usr/bin && sed awk awk sed done -eu
+	| --verbose test --verbose echo export "$1" export -eu local local &&
+	&& awk awk export local done sed
+	printf local printf 'quoted text'
+#include c167.sh
+	awk "$1" x=1 ${HOME} -eu 'quoted text' ${HOME} "$@" done cd x=1 cd |
+--verbose done /usr/bin $(pwd) sed
+	| $(pwd) -eu done /usr/bin -eu "$@" -eu
+	grep awk readonly --verbose printf $(pwd) x=1 ${HOME} grep cd test 2>/dev/null
+then && sed printf echo 'quoted text' printf | 2>/dev/null --verbose
+sed && grep 2>/dev/null -eu "$@" sed --verbose && done 2>/dev/null && printf
+$(pwd) cd | export | then test sed export
+		2>/dev/null | then export 'quoted text'
+		then "$1" | /usr/bin test -eu export sed export && export | $(pwd) "$@" done
+	export then echo && 2>/dev/null grep awk $(pwd) "$@" 'quoted text' $(pwd)
+	echo test --verbose local ${HOME} export
+		grep test 2>/dev/null /usr/bin export x=1 done awk readonly
+	--verbose awk awk $(pwd) cd --verbose | 'quoted text' grep
+done done done export printf done local grep sed 2>/dev/null "$1" cd printf then
+	test grep "$@" sed 'quoted text' echo x=1 $(pwd) "$@" then sed sed
+	$(pwd) readonly cd "$1" cd "$@" readonly
+		awk "$1" --verbose $(pwd) 'quoted text'
+export done "$@" x=1 grep local
+printf then "$@" -eu grep "$1" $(pwd) local --verbose && awk --verbose
+	done sed 2>/dev/null echo awk local local
+		"$@" export 2>/dev/null
+	'quoted text' $(pwd) readonly
+$(pwd) /usr/bin 2>/dev/null x=1 ${HOME} printf
+then && export export cd grep
+local printf x=1 local && $(pwd) then "$@"
+		local $(pwd) "$@" --verbose --verbose local grep then
+'quoted text' echo --verbose grep
+/usr/bin "$@" 2>/dev/null printf
+&& export done test cd awk /usr/bin "$@" echo ${HOME} echo cd | 2>/dev/null then
+		${HOME} grep done sed /usr/bin
+		/usr/bin printf "$1" cd grep printf test awk $(pwd) && local cd
+'quoted text' ${HOME} ${HOME} $(pwd) "$1" && done done echo 'quoted text' readonly
+	cd export grep --verbose 2>/dev/null readonly
+/usr/bin local echo -eu done sed "$@"
+	&& done printf local $(pwd) done $(pwd) awk
+'quoted text' awk local x=1 x=1 2>/dev/null done sed 'quoted text' export
+	"$@" printf grep $(pwd)
+$(pwd) | 2>/dev/null printf --verbose
+export local 'quoted text' "$@" printf
+sed --verbose $(pwd) -eu cd printf test done printf grep
+${HOME} cd export grep local /usr/bin local 'quoted text'
+	2>/dev/null 'quoted text' awk "$@" cd "$@" x=1 && /usr/bin
+		sed cd grep cd --verbose then sed -eu export echo
+		printf && test printf /usr/bin
+readonly then | printf 'quoted text' grep /usr/bin export
+	readonly && local readonly "$@" x=1 awk 2>/dev/null ${HOME} readonly
+	printf && 'quoted text' 2>/dev/null sed grep export cd readonly export
+readonly /usr/bin echo sed cd x=1 x=1 test echo -eu "$@"
+	--verbose --verbose -eu -eu /usr/bin then 'quoted text'
+		$(pwd) grep sed -eu cd grep test $(pwd) grep test && $(pwd)
+awk "$1" $(pwd) test test readonly test /usr/bin then
+		${HOME} done 2>/dev/null 'quoted text' sed
+		sed grep $(pwd) echo awk done 2>/dev/null x=1 readonly $(pwd)
+x=1 /usr/bin export 2>/dev/null x=1 readonly "$@" grep done "$1" | awk sed
+awk done export "$1" "$1" readonly
+		&& $(pwd) printf "$@" then -eu "$@" "$@" echo
+	'quoted text' local $(pwd) awk "$1" grep --verbose "$@" done cd -eu "$@" sed
+&& x=1 /usr/bin ${HOME} then /usr/bin cd /usr/bin then test
+x=1 export | test awk readonly echo local awk --verbose
+		&& export export "$@" ${HOME} "$@" done done then
+		done x=1 grep local then $(pwd) done export cd test done done echo
+test "$@" "$1" x=1 grep grep
+		x=1 2>/dev/null 2>/dev/null /usr/bin
+		--verbose x=1 && ${HOME} cd 'quoted text' && x=1 2>/dev/null --verbose
+	grep && sed test cd 2>/dev/null awk grep export sed $(pwd) -eu
+	export readonly echo local ${HOME} -eu && ${HOME}
+export 'quoted text' export $(pwd) sed --verbose "$1" cd local 'quoted text'
+then 'quoted text' test then local local grep ${HOME} $(pwd) --verbose readonly
+done -eu && --verbose x=1 'quoted text' grep ${HOME}
+		done x=1 "$1" "$@" cd then 2>/dev/null cd echo
+		then test sed 2>/dev/null x=1 readonly 2>/dev/null
+		-eu test readonly echo -eu --verbose | local 'quoted text'
+test printf | then ${HOME} ${HOME}
+| export grep cd sed echo x=1
+echo "$@" x=1 then local
+test "$@" cd export -eu | sed export
+		grep test test awk x=1 then grep -eu sed ${HOME} "$@" "$1"
+${HOME} grep then $(pwd) export done $(pwd) -eu test
+&& printf x=1 done readonly
+	awk printf && grep ${HOME} done
+	'quoted text' 2>/dev/null $(pwd)
+cd 2>/dev/null cd then echo sed readonly -eu | export
+cd --verbose 2>/dev/null
+	| | local -eu --verbose ${HOME} /usr/bin x=1 echo then export cd printf | 2>/dev/null
+	| | grep -eu --verbose grep /usr/bin 2>/dev/null grep printf done echo
+		echo | 2>/dev/null 2>/dev/null
+then "$1" ${HOME} "$@" 2>/dev/null --verbose then echo
+	| then readonly $(pwd) ${HOME} "$1" "$1" test x=1 awk | && cd readonly
+		test done export local local ${HOME} ${HOME} sed x=1 x=1 echo
+		--verbose --verbose ${HOME} sed "$1" cd | export /usr/bin
+/usr/bin awk "$@" ${HOME} && | test && export echo local && done 'quoted text'
+	${HOME} "$1" --verbose | ${HOME} grep then "$@" --verbose grep readonly
+2>/dev/null grep /usr/bin local then test 2>/dev/null
+		&& test printf awk printf test /usr/bin
+	then && done grep test export
+done local 'quoted text' "$1" cd grep readonly
+local x=1 sed | ${HOME} sed sed cd x=1 test /usr/bin | -eu &&
+/usr/bin && echo cd awk readonly test ${HOME}
+	| $(pwd) --verbose awk sed | 2>/dev/null
+| -eu && "$@" awk | -eu ${HOME} x=1 done cd
+then local -eu | sed --verbose "$@" "$@" cd cd $(pwd) /usr/bin
+"$@" -eu /usr/bin export test printf 'quoted text' done "$@" cd && echo -eu local
+echo printf done 'quoted text' "$1" "$1" readonly -eu $(pwd)
+		awk grep $(pwd) printf --verbose export readonly -eu 2>/dev/null echo -eu
+readonly 2>/dev/null "$1" 'quoted text' printf export | local
+	readonly "$@" $(pwd) local
+'quoted text' /usr/bin ${HOME} --verbose "$@" /usr/bin --verbose -eu sed
+		| && export local 'quoted text'
+		"$1" sed sed 2>/dev/null ${HOME}
+		'quoted text' then cd done && $(pwd) readonly test then
+'quoted text' x=1 2>/dev/null ${HOME} | export grep 2>/dev/null "$1"
+local grep 'quoted text' local echo "$1" local "$@"
+	readonly /usr/bin -eu /usr/bin $(pwd) 'quoted text' --verbose
+	"$@" --verbose cd ${HOME} --verbose echo test | $(pwd) /usr/bin -eu readonly
+sed $(pwd) cd echo export -eu grep
+then done sed | --verbose --verbose && $(pwd) ${HOME}
+	sed readonly sed grep sed -eu 'quoted text' --verbose echo cd local echo /usr/bin
+		/usr/bin grep then export export /usr/bin
+	grep done awk printf
+		echo | echo "$@" /usr/bin
+	${HOME} done grep 2>/dev/null ${HOME} 2>/dev/null
+	2>/dev/null done test grep /usr/bin
+	${HOME} sed test grep "$@" /usr/bin
+	then ${HOME} x=1 readonly --verbose $(pwd) grep $(pwd) export &&
+	printf then sed | test -eu "$1" awk export grep readonly /usr/bin "$1" grep readonly
+		awk printf 'quoted text'
+2>/dev/null 'quoted text' readonly local "$1" 'quoted text' | grep awk x=1
+		"$1" 2>/dev/null "$1" echo x=1 "$1" readonly --verbose
+		--verbose cd done 'quoted text'
+		2>/dev/null 'quoted text' sed x=1 cd 'quoted text' then 'quoted text'
+local ${HOME} sed | sed "$1" local echo --verbose
+	${HOME} && done test /usr/bin
+2>/dev/null x=1 then 'quoted text'
+	| --verbose ${HOME} done test --verbose 'quoted text' 'quoted text'
+	"$1" "$1" ${HOME} echo done
+	grep 2>/dev/null echo 2>/dev/null test export export cd echo
+		$(pwd) grep echo 'quoted text' sed 'quoted text' ${HOME} "$1" then
+		local grep awk 'quoted text' $(pwd) /usr/bin
+/usr/bin -eu /usr/bin echo echo | test cd echo --verbose "$1" local sed
+		then ${HOME} /usr/bin awk -eu "$@" 2>/dev/null
+	then -eu cd $(pwd) done export echo --verbose
+--verbose -eu export sed -eu
+		'quoted text' grep --verbose
+	test "$1" test sed awk "$1" $(pwd)
+	export 'quoted text' --verbose local ${HOME} 'quoted text'
+	x=1 "$1" test x=1 2>/dev/null "$1"
+	-eu awk "$1" "$@" grep sed "$1" done "$@" test then "$1" printf ${HOME} export
+"$1" "$1" printf 'quoted text' printf
+	'quoted text' --verbose then /usr/bin grep "$@" x=1 ${HOME}
+		sed /usr/bin 2>/dev/null --verbose | -eu $(pwd) sed readonly cd sed x=1
+awk x=1 sed local | printf done readonly
+done "$@" | $(pwd) awk ${HOME} | printf local | done
+		-eu -eu ${HOME} 'quoted text' printf x=1 | /usr/bin
+	$(pwd) -eu local /usr/bin test
+		'quoted text' then --verbose printf ${HOME} printf grep ${HOME} awk
+	printf echo /usr/bin awk /usr/bin && sed
+echo | /usr/bin x=1 readonly done x=1 then 'quoted text' done grep test local
+	2>/dev/null cd && ${HOME} x=1 -eu cd
+		local ${HOME} /usr/bin test --verbose
+	&& 2>/dev/null test 'quoted text' printf sed $(pwd) -eu
+	then 2>/dev/null /usr/bin "$1" done readonly grep x=1
+		&& ${HOME} echo | x=1 --verbose $(pwd) x=1 "$@" $(pwd) && awk
+	echo "$1" grep 'quoted text' echo readonly --verbose sed && "$@" then export
+	"$1" test /usr/bin sed readonly
+${HOME} -eu grep $(pwd) test "$1" 'quoted text'
+		${HOME} "$1" x=1 readonly echo awk echo printf local test x=1 sed $(pwd)
+		grep 2>/dev/null --verbose test && sed "$1" $(pwd) awk cd awk -eu echo
+| 2>/dev/null awk export ${HOME} local 'quoted text' grep
+	done "$@" echo 2>/dev/null awk 2>/dev/null sed x=1 ${HOME} then $(pwd) 'quoted text'
+--verbose then local 2>/dev/null $(pwd) awk
+	local x=1 awk "$1" cd grep sed "$1" "$1" $(pwd)
+	/usr/bin "$@" awk local test cd x=1 awk grep ${HOME} cd cd echo export ${HOME}
+		| -eu grep export x=1 export $(pwd) 2>/dev/null "$1" 'quoted text'
+-eu done then 2>/dev/null test && echo 'quoted text' 2>/dev/null
+test 2>/dev/null "$@" 'quoted text' --verbose cd grep export
+	then awk ${HOME} x=1 x=1 cd $(pwd) sed "$1" -eu 'quoted text'
+&& --verbose cd printf --verbose
+	/usr/bin local /usr/bin $(pwd) -eu done "$@" readonly then test grep ${HOME}
+	export 2>/dev/null --verbose "$1" | "$@" printf && -eu
+then /usr/bin 'quoted text'
+echo --verbose echo then test sed "$1" export grep grep readonly
+	"$1" then /usr/bin awk export echo $(pwd) grep local
+&& && ${HOME} then done x=1 awk $(pwd) x=1 then 'quoted text' awk local
+	test 'quoted text' awk readonly x=1 --verbose "$1" x=1 x=1 printf test done
+	"$1" "$1" /usr/bin /usr/bin export printf local /usr/bin
+	-eu readonly test $(pwd) sed /usr/bin
+	grep -eu test 'quoted text'
+grep readonly /usr/bin test 'quoted text'
+	x=1 export x=1 readonly | then ${HOME} /usr/bin done $(pwd)
+		"$@" test done local readonly
+	echo -eu "$@" grep | grep $(pwd) /usr/bin
+	| readonly grep sed done then && cd then sed /usr/bin "$@" grep --verbose ${HOME}
+		readonly /usr/bin 'quoted text' sed then 'quoted text' "$@" /usr/bin
+	${HOME} x=1 printf 2>/dev/null export "$1"
+		-eu awk sed 2>/dev/null export /usr/bin export 2>/dev/null 'quoted text'
+		"$@" local printf && ${HOME} readonly local done
+		$(pwd) x=1 awk local then grep -eu then awk 'quoted text' sed export x=1
+	readonly local "$@" local
+		/usr/bin --verbose $(pwd) $(pwd) /usr/bin local done grep
+	cd printf $(pwd) 2>/dev/null
+test x=1 sed echo "$1" test grep cd 2>/dev/null "$@" echo done 2>/dev/null "$@"
+	export 2>/dev/null && test x=1 "$@" && --verbose | echo then $(pwd) | x=1
+		/usr/bin grep -eu x=1 -eu x=1 awk | x=1 ${HOME} grep "$@"
+	2>/dev/null cd /usr/bin 'quoted text' x=1 x=1 done
+		| ${HOME} x=1 /usr/bin grep local "$@" test $(pwd) echo done | done
+x=1 grep echo done awk /usr/bin -eu
+| "$1" && 'quoted text' 'quoted text' 'quoted text'
+		local export readonly /usr/bin "$1" "$1" "$1" test
+	&& test /usr/bin && 2>/dev/null /usr/bin
+		$(pwd) x=1 /usr/bin &&
+		readonly 'quoted text' 'quoted text' export sed awk $(pwd) --verbose
+	-eu && ${HOME} sed then then export
+done local 2>/dev/null "$1" -eu 2>/dev/null "$@" printf
+-eu test export /usr/bin
+		"$1" -eu "$@" then $(pwd) /usr/bin export grep
+	x=1 "$@" --verbose 2>/dev/null x=1 awk /usr/bin 2>/dev/null
+	&& x=1 printf | "$@" $(pwd) export printf
+echo readonly echo "$1" $(pwd) printf printf && then echo readonly sed done
+	grep --verbose readonly && $(pwd) local 2>/dev/null --verbose
+		export printf 2>/dev/null /usr/bin
+readonly "$@" export 2>/dev/null
+		test cd local /usr/bin test "$1" && test && sed x=1
+/usr/bin 'quoted text' 'quoted text' x=1 export
+	2>/dev/null x=1 cd done && awk ${HOME}
+		x=1 --verbose "$@" -eu awk "$1" then readonly export --verbose ${HOME}
+	echo then printf | --verbose -eu readonly && printf $(pwd)
+export readonly local | local /usr/bin export grep then "$1" local &&
+-eu --verbose "$1" cd readonly -eu sed ${HOME} export &&
+	--verbose printf "$@" --verbose x=1 ${HOME} -eu "$@" 2>/dev/null readonly
+		"$1" 'quoted text' readonly &&
+$(pwd) readonly readonly 2>/dev/null export done ${HOME} "$@" export "$1" done
+		then && local export --verbose /usr/bin export
+		local readonly export "$@" 'quoted text' "$1" --verbose sed "$1" grep | test &&
+readonly 'quoted text' -eu ${HOME} export cd export | printf $(pwd)
+'quoted text' "$@" $(pwd) test && ${HOME} printf echo grep
+	printf $(pwd) /usr/bin grep export then test grep
+| then then export cd printf done local test grep then test -eu "$@" test
+	'quoted text' then done $(pwd) then x=1 local test $(pwd) --verbose 'quoted text'
+	x=1 sed then cd x=1 printf $(pwd) awk grep local
+2>/dev/null ${HOME} | export local "$@"
+readonly x=1 echo printf --verbose export x=1 /usr/bin -eu awk cd 'quoted text'
+		/usr/bin -eu cd /usr/bin /usr/bin -eu $(pwd) ${HOME} && 'quoted text'
+		"$1" "$1" cd | 2>/dev/null
+		grep grep test export awk cd printf local 'quoted text'
+2>/dev/null "$@" "$1" "$1" 'quoted text' then awk local
+	${HOME} x=1 x=1 --verbose x=1 echo "$1" sed "$1" test done cd done
+sed ${HOME} && printf export printf grep "$1" "$1" -eu "$@" awk sed
+	x=1 export grep "$1" && && $(pwd)
+	sed grep x=1 "$1" --verbose echo | done local && then
+	--verbose done | 'quoted text' 'quoted text' "$1" echo /usr/bin readonly 'quoted text'
+	then --verbose "$@" /usr/bin $(pwd) $(pwd) 2>/dev/null grep
+		x=1 'quoted text' 2>/dev/null then | readonly "$1" echo $(pwd) then
+export grep export grep x=1 x=1 cd readonly "$1" --verbose
+	'quoted text' sed test grep sed "$1" "$1" "$@" local ${HOME}
+	/usr/bin echo test "$@" cd export then --verbose grep ${HOME}
+		cd x=1 -eu test && awk x=1 sed test echo printf x=1 && /usr/bin echo -eu 'quoted text'
+cd "$1" | --verbose $(pwd) $(pwd) "$1" grep
+"$@" 'quoted text' 'quoted text' grep x=1 awk then
+		| -eu grep awk && x=1 done export
+then $(pwd) echo "$1" readonly readonly test readonly grep ${HOME} 'quoted text'
+	cd x=1 "$1" awk --verbose local | 'quoted text' awk ${HOME} printf cd
+	awk echo "$@" "$@" | --verbose 2>/dev/null
+&& printf local && readonly
+	test -eu "$@" -eu -eu "$@" 'quoted text' then ${HOME} /usr/bin export grep
+		&& printf readonly 'quoted text' "$1" 2>/dev/null
+"$1" $(pwd) done cd test grep sed x=1 $(pwd)
+		2>/dev/null local test 'quoted text' echo $(pwd) "$1" 'quoted text'
+	'quoted text' -eu --verbose "$1" && local
+test grep printf "$1" | local then export grep
+		| x=1 readonly test /usr/bin
+		--verbose awk grep cd printf grep export "$1" 2>/dev/null $(pwd) -eu export
+&& 2>/dev/null cd | 'quoted text' x=1 awk | export
+	test && test readonly then printf "$1" local sed
+	export sed && local echo readonly 'quoted text' $(pwd) sed && echo grep
+export "$@" awk -eu | sed grep cd --verbose 'quoted text'
+		| printf echo export grep | done local printf $(pwd) readonly && done --verbose
+	test grep echo test | -eu
+		&& test --verbose "$@" grep /usr/bin "$1"
+	"$1" then "$@" local done -eu sed awk && then -eu
+	-eu grep ${HOME} $(pwd) ${HOME} grep ${HOME}
+done echo ${HOME} -eu awk grep 2>/dev/null 2>/dev/null
+		"$1" | sed done printf cd export printf "$1" 2>/dev/null
+--verbose sed local sed && --verbose awk
+/usr/bin $(pwd) --verbose ${HOME} $(pwd) grep --verbose -eu 2>/dev/null
+	--verbose 2>/dev/null sed /usr/bin
+&& local ${HOME} grep grep ${HOME}
+	&& readonly && -eu && 2>/dev/null local --verbose "$1" 2>/dev/null
+	awk cd then "$@" /usr/bin local test awk awk
+		/usr/bin --verbose ${HOME} cd -eu printf test "$1" 'quoted text' local echo
+	cd local "$1" readonly /usr/bin
+	export 'quoted text' done local "$@"
+'quoted text' ${HOME} /usr/bin 2>/dev/null x=1 $(pwd) $(pwd) /usr/bin done
+	"$1" /usr/bin "$1" --verbose
+"$@" test grep ${HOME} 2>/dev/null $(pwd) -eu cd test cd printf 'quoted text'
+		--verbose test x=1 sed grep sed "$@" echo echo 2>/dev/null
+	/usr/bin | /usr/bin && export readonly then then export echo 2>/dev/null readonly
+		then $(pwd) --verbose | /usr/bin ${HOME} readonly "$@" $(pwd) $(pwd)
+2>/dev/null export $(pwd)
+export x=1 printf printf $(pwd)
+		$(pwd) 'quoted text' cd 'quoted text'
+		grep printf grep && awk grep then test then sed ${HOME} done -eu printf sed -eu
+	| "$@" /usr/bin done then /usr/bin ${HOME} $(pwd) export
+		export -eu "$1" awk awk then echo awk done --verbose local readonly 'quoted text'
+	&& printf 2>/dev/null 2>/dev/null 'quoted text' /usr/bin
+	&& readonly test sed cd export
+	$(pwd) "$@" x=1 && | /usr/bin readonly && grep
+grep cd local then "$@" "$@" | $(pwd) test "$@" && 2>/dev/null export /usr/bin
+	"$1" --verbose done awk sed done awk 'quoted text' grep printf "$@" --verbose done
+	'quoted text' test cd /usr/bin test --verbose awk 2>/dev/null test
+"$@" 2>/dev/null | --verbose cd "$1"
+	x=1 sed -eu /usr/bin grep x=1
+		readonly done readonly printf "$1" readonly 2>/dev/null "$@" readonly export
+	--verbose awk && --verbose test sed --verbose "$1"
+	&& cd then awk ${HOME} test 'quoted text' test then $(pwd) grep
+sed 'quoted text' readonly test x=1 x=1 then x=1 /usr/bin export
+	grep readonly sed "$@" 2>/dev/null ${HOME} && "$@" local 2>/dev/null export
+	readonly /usr/bin then && ${HOME} "$1" $(pwd) /usr/bin grep cd readonly
+grep then local && awk sed ${HOME} awk --verbose
+	readonly -eu printf sed cd printf readonly readonly
+	&& done printf -eu --verbose cd echo cd | --verbose 2>/dev/null $(pwd)
+	x=1 | then 'quoted text' awk echo && --verbose x=1 "$1"
+		x=1 test -eu awk --verbose printf cd /usr/bin 2>/dev/null && /usr/bin
+-eu "$1" x=1 cd grep && done && cd $(pwd) echo
+	sed --verbose printf awk then done "$@" done -eu done "$1" readonly --verbose
+sed /usr/bin 2>/dev/null $(pwd) echo ${HOME} grep then grep
+	x=1 "$@" awk done x=1 local printf "$1"
+sed 'quoted text' "$1" done --verbose --verbose && ${HOME} "$@"
+&& done -eu readonly --verbose done export --verbose sed | awk
+		${HOME} echo 2>/dev/null ${HOME} ${HOME} "$1" awk -eu && local x=1 -eu /usr/bin
+	grep "$1" echo cd sed "$1" x=1 cd /usr/bin 2>/dev/null grep printf local "$1"
+"$1" cd --verbose then test grep echo echo
+	"$@" sed export $(pwd) then x=1 cd "$@" ${HOME} done awk sed test "$@"
+		2>/dev/null then printf 2>/dev/null echo $(pwd) then "$1"
+	--verbose -eu cd done $(pwd) sed 2>/dev/null sed x=1 $(pwd) /usr/bin
+readonly test --verbose /usr/bin done | cd export
+		echo echo /usr/bin sed sed grep -eu awk | printf export readonly cd awk ${HOME}
+'quoted text' cd awk then echo
+	test 'quoted text' cd x=1 readonly ${HOME}
+	echo $(pwd) sed sed cd -eu echo cd 'quoted text' x=1 -eu
+		"$@" printf 'quoted text' --verbose readonly ${HOME} echo
+"$1" echo x=1 'quoted text' done -eu done readonly "$1" cd grep echo cd sed
+	/usr/bin ${HOME} grep test | export cd "$1" ${HOME} awk
+		--verbose /usr/bin "$1" echo grep done printf
+	"$1" awk awk --verbose grep then
+		done readonly echo x=1 done sed local
+		cd test awk sed "$@" awk | readonly done --verbose local $(pwd) &&
+	done then echo -eu awk echo awk ${HOME} awk /usr/bin x=1
+readonly printf readonly then x=1 $(pwd) echo $(pwd) awk local "$@" echo
+	export then | test printf 2>/dev/null echo 2>/dev/null
+		-eu grep -eu | $(pwd) grep awk | readonly test $(pwd) done done "$1"
+	test test awk export "$@" 2>/dev/null && printf cd -eu local local export
+		/usr/bin 2>/dev/null grep
+--verbose awk | awk $(pwd) awk | awk then
+		readonly readonly "$@" cd | printf 'quoted text'
+readonly test && export grep sed
+		awk "$@" done awk local done cd 2>/dev/null
+printf ${HOME} done $(pwd) ${HOME} 'quoted text' | 2>/dev/null
+test sed x=1 export readonly echo
+	awk awk readonly 2>/dev/null test awk printf awk
+$(pwd) $(pwd) readonly "$1"
+		x=1 $(pwd) local /usr/bin
+		${HOME} "$1" then echo printf local 2>/dev/null readonly sed printf $(pwd) done
+		x=1 local && 2>/dev/null "$1" $(pwd) export
+		test | cd local export /usr/bin readonly
+printf "$1" cd 'quoted text'
+readonly awk echo $(pwd) grep printf --verbose
+		readonly echo cd $(pwd) then grep x=1 sed
+		cd grep sed grep x=1 "$1" $(pwd) printf local printf 'quoted text'
+${HOME} grep 'quoted text' ${HOME} 'quoted text' 2>/dev/null "$1" echo 2>/dev/null
+		local "$1" sed && printf ${HOME} done --verbose
+	'quoted text' && sed grep
+	printf | -eu printf $(pwd) export
+awk -eu -eu ${HOME} grep /usr/bin && 'quoted text'
+	/usr/bin local 'quoted text' echo | 2>/dev/null
+	done then "$1" echo then x=1 "$@" printf ${HOME}
+	export 'quoted text' 2>/dev/null grep then sed
+		sed --verbose echo sed | grep awk grep echo cd then
+		${HOME} done local -eu printf -eu export printf x=1 -eu echo grep local
+	"$1" /usr/bin x=1 "$@" export "$1" sed then
+	-eu export /usr/bin export --verbose readonly
+		| export local "$1" $(pwd) then && export readonly && test
+awk $(pwd) "$1" ${HOME} grep echo "$1"
+	printf | then local local && awk local -eu "$1" /usr/bin cd 'quoted text'
+		test 'quoted text' -eu x=1 test
+x=1 2>/dev/null sed --verbose cd && --verbose -eu done printf 2>/dev/null awk
+		awk printf 'quoted text' export
+	'quoted text' then 'quoted text' sed -eu printf
+		sed "$1" echo "$1" then grep printf -eu "$1" awk done printf
+		2>/dev/null awk 2>/dev/null ${HOME} --verbose printf grep 2>/dev/null
+		&& /usr/bin sed ${HOME} done && cd $(pwd)
+		--verbose echo | "$1" --verbose -eu sed --verbose
+	export && x=1 cd printf 'quoted text' /usr/bin local
+		--verbose x=1 /usr/bin export "$@" echo
+	-eu local $(pwd) $(pwd) 2>/dev/null | ${HOME}
+	local x=1 awk grep --verbose awk awk --verbose
+	${HOME} | | local local $(pwd) then 2>/dev/null
+	printf 'quoted text' 2>/dev/null local -eu echo then
+	export readonly readonly readonly "$@" $(pwd) 2>/dev/null readonly ${HOME} echo
+echo $(pwd) sed export $(pwd) $(pwd) 2>/dev/null
+	| 'quoted text' grep $(pwd)
+awk "$1" export printf ${HOME} done readonly
+test -eu $(pwd) awk readonly /usr/bin "$1" readonly "$@" | cd sed | echo ${HOME}
+	sed export -eu test /usr/bin
+		${HOME} export done && -eu ${HOME}
+	x=1 | awk | x=1 test --verbose "$1"
+	'quoted text' x=1 2>/dev/null
+	&& test awk | | echo "$@" awk 2>/dev/null x=1 -eu export sed
+	cd echo "$@" awk export awk cd "$1" export --verbose
+grep 2>/dev/null cd grep then echo then && /usr/bin $(pwd) /usr/bin && 'quoted text'
+		grep && awk && ${HOME} export && "$@" ${HOME} 2>/dev/null
+	awk 'quoted text' cd readonly
+readonly && cd "$1" echo export printf then 2>/dev/null export ${HOME} cd
+	done readonly "$@" -eu test sed x=1 'quoted text'
+	done "$@" "$@" cd 2>/dev/null | echo 'quoted text' | x=1 "$@" "$1" export
+		$(pwd) then "$1" echo "$1" "$@" x=1 local "$@" printf $(pwd) 2>/dev/null
+		-eu test sed ${HOME} "$1" cd 2>/dev/null echo grep
+	done && | sed 2>/dev/null
+${HOME} cd 2>/dev/null export
+&& grep "$1" --verbose 'quoted text' sed export ${HOME}
+		${HOME} "$1" echo echo awk
+	then 2>/dev/null awk && sed --verbose local test "$@" && grep
+		2>/dev/null $(pwd) -eu export then
+		${HOME} cd test "$@" echo sed "$@" $(pwd) 'quoted text'
+grep done test grep 2>/dev/null grep $(pwd) /usr/bin local | readonly 'quoted text'
+	'quoted text' local 2>/dev/null
+	2>/dev/null local --verbose export awk cd done printf export 'quoted text'
+	grep cd "$1" done cd then && /usr/bin "$1" /usr/bin readonly x=1 /usr/bin test
+export readonly ${HOME} "$1" local export test x=1 /usr/bin 2>/dev/null
+	echo cd --verbose done cd awk 'quoted text' printf x=1
+then ${HOME} sed cd --verbose awk awk printf 2>/dev/null
+	| test then ${HOME} /usr/bin readonly $(pwd) $(pwd) sed printf 2>/dev/null
+	readonly cd cd then sed echo x=1 'quoted text' test echo "$@" grep
+		then $(pwd) /usr/bin $(pwd) then printf 2>/dev/null cd -eu echo && readonly
+		x=1 printf awk && "$@" awk 'quoted text' /usr/bin done 2>/dev/null sed
+		sed 'quoted text' 2>/dev/null ${HOME}
+	done 'quoted text' printf export echo | /usr/bin --verbose
+	&& awk echo cd awk "$@" cd printf "$1" sed cd test echo "$1" printf $(pwd)
+		echo ${HOME} test | sed ${HOME}
+| printf "$@" cd export | sed 'quoted text' 'quoted text'
+		printf $(pwd) local 2>/dev/null --verbose done
+	grep test local done echo x=1 test export test
+		sed -eu local /usr/bin echo --verbose
+	&& "$@" --verbose done ${HOME}
+		grep $(pwd) awk 2>/dev/null "$@" --verbose "$1" printf -eu
+		-eu "$1" done local cd sed then awk /usr/bin 2>/dev/null
+	cd 2>/dev/null grep echo /usr/bin ${HOME} local done | test
+	awk | echo awk --verbose local readonly --verbose sed awk 2>/dev/null ${HOME}
+2>/dev/null --verbose sed x=1 local x=1
+		echo local | grep done $(pwd) ${HOME} printf x=1 done "$1" $(pwd) local
+cd cd && awk local | readonly &&
+	&& printf export /usr/bin &&
+	--verbose x=1 "$@" grep export ${HOME} awk local test printf local /usr/bin
+		$(pwd) awk awk then /usr/bin $(pwd) printf awk export awk export 2>/dev/null
+	echo printf && test ${HOME} echo
+	"$@" done "$1" export 'quoted text' x=1 printf x=1 awk
+		2>/dev/null 2>/dev/null
+		grep --verbose /usr/bin /usr/bin local local done "$1" 2>/dev/null /usr/bin sed
+readonly && readonly $(pwd) 'quoted text' echo -eu 'quoted text' --verbose done
+'quoted text' then grep -eu local export printf
+		${HOME} --verbose && "$1" -eu sed done 2>/dev/null &&
+"$@" "$1" readonly "$@" -eu local grep /usr/bin cd cd then -eu then ${HOME}
+	'quoted text' -eu | 2>/dev/null readonly x=1 readonly cd readonly
+"$@" awk 2>/dev/null && awk 2>/dev/null grep 2>/dev/null "$@" awk
+		-eu printf local test 2>/dev/null $(pwd)
+printf -eu ${HOME} readonly
+2>/dev/null cd x=1 --verbose then test export
+		echo -eu "$@" printf "$1" x=1 'quoted text'
+	"$1" | "$@" test done done --verbose 2>/dev/null
+		'quoted text' done echo export --verbose -eu echo /usr/bin /usr/bin done "$@" ${HOME}
+		x=1 export cd && x=1 echo /usr/bin readonly
+	2>/dev/null sed printf export readonly then readonly readonly done "$@" printf
+	'quoted text' | $(pwd) 2>/dev/null readonly 'quoted text' /usr/bin
+		2>/dev/null sed "$1" && "$@" cd
+	--verbose export cd printf export x=1 printf done
+		'quoted text' sed /usr/bin 'quoted text' --verbose
+awk test cd x=1 export readonly
+	readonly 'quoted text' 'quoted text' sed | local
+	'quoted text' then sed --verbose ${HOME} "$1" -eu sed 2>/dev/null ${HOME} 2>/dev/null
+	'quoted text' --verbose printf done $(pwd) "$@" grep "$@" "$@"
+	$(pwd) 'quoted text' x=1 && then x=1 readonly "$1"
+	--verbose 2>/dev/null 2>/dev/null awk "$1"
+echo done awk grep printf --verbose test 2>/dev/null printf local echo
+${HOME} && echo test test export && local 'quoted text'
+	/usr/bin /usr/bin export test grep "$1" done ${HOME} --verbose $(pwd) done sed
+	then sed "$@" cd sed readonly "$1" export && sed -eu 'quoted text'
+	local | awk --verbose local then local && --verbose echo /usr/bin && 'quoted text'
+grep echo grep done readonly | ${HOME} awk grep 'quoted text' 2>/dev/null printf
+		echo "$@" /usr/bin awk -eu readonly "$@"
+test ${HOME} local --verbose --verbose
+local 2>/dev/null && test readonly
+		export echo "$1" cd --verbose -eu 'quoted text'
+x=1 sed local printf readonly done $(pwd) readonly
+	sed done -eu then -eu then echo && echo | ${HOME} test --verbose $(pwd)
+	"$1" local export cd "$@" && -eu ${HOME} -eu done export echo --verbose ${HOME}
+	2>/dev/null "$1" "$1" sed local test export "$@"
+		"$@" "$@" && cd readonly "$1" echo x=1 ${HOME} x=1
+	export grep awk $(pwd) cd /usr/bin 'quoted text' "$1" test
+		done export ${HOME} done
+	awk ${HOME} then export local
+		echo then grep 2>/dev/null --verbose --verbose /usr/bin | 2>/dev/null
+		$(pwd) --verbose "$@" then then /usr/bin "$1" | && "$@" --verbose -eu readonly
+		"$@" x=1 -eu ${HOME} x=1 export test then
+| done && "$1" "$@" -eu sed "$@" cd awk done then /usr/bin 'quoted text'
+done 2>/dev/null && ${HOME} && done "$@"
+$(pwd) local sed $(pwd) x=1 "$@" | done 2>/dev/null then
+	then "$@" 'quoted text' cd then ${HOME} "$@" then done "$1"
+	local /usr/bin sed test
+export x=1 "$1" cd then printf grep awk test export local
+	$(pwd) $(pwd) grep sed local cd --verbose /usr/bin
+	printf x=1 'quoted text' awk local
+	awk 'quoted text' 2>/dev/null
+	2>/dev/null "$1" | && "$@" --verbose 'quoted text'
+then | done 'quoted text' /usr/bin /usr/bin printf done 'quoted text'
+	"$@" grep printf /usr/bin
+		test printf /usr/bin x=1 -eu awk echo "$1" -eu
+	"$@" then echo awk 'quoted text' 'quoted text' /usr/bin readonly
+		/usr/bin sed export --verbose then grep -eu local && echo sed $(pwd)
+		test -eu printf 2>/dev/null 2>/dev/null
+| local awk 'quoted text' "$1" awk 2>/dev/null
+		'quoted text' 'quoted text' test x=1 export
+cd printf x=1 && --verbose echo then echo grep
+		| /usr/bin export "$@" grep --verbose printf
+		printf ${HOME} "$1" && awk local echo $(pwd) $(pwd) x=1 $(pwd)
+"$1" readonly $(pwd) $(pwd) done
+	printf 2>/dev/null 'quoted text' && test $(pwd)
+	/usr/bin test x=1 --verbose | then
+cd | --verbose x=1 echo local --verbose
+cd local ${HOME} 2>/dev/null printf cd 'quoted text'
+		$(pwd) x=1 echo --verbose x=1 $(pwd)
+		$(pwd) export 2>/dev/null 'quoted text' -eu echo | $(pwd) local awk
+	x=1 x=1 cd sed readonly sed awk printf cd "$1"
+"$@" readonly | echo awk 'quoted text' local sed
+	&& 'quoted text' -eu --verbose 2>/dev/null $(pwd) awk then
+		${HOME} then ${HOME} "$@" grep test printf
+	awk export echo --verbose $(pwd)
+	-eu x=1 done -eu x=1 x=1 /usr/bin /usr/bin local sed then | sed echo x=1 -eu then
+sed "$@" export x=1 "$@"
+	echo --verbose "$@" 2>/dev/null 'quoted text' -eu export /usr/bin export awk
+	done sed test "$1" ${HOME} x=1 done echo x=1 -eu cd sed awk "$1" cd -eu grep 'quoted text'
+		'quoted text' && "$1" ${HOME} then "$1" export "$@" readonly
+		"$@" printf ${HOME} -eu /usr/bin sed echo && done sed then "$@" awk ${HOME}
+		| awk x=1 local grep
+	| ${HOME} sed | grep readonly printf grep "$@" local readonly readonly
+		-eu export awk readonly grep | "$1" sed export
+printf then $(pwd) readonly
+	cd echo ${HOME} "$@" 2>/dev/null x=1 local /usr/bin printf sed sed x=1 --verbose
+	&& readonly | "$1" -eu "$1" local 2>/dev/null readonly test test grep sed
+sed local 2>/dev/null sed readonly && export "$@" x=1 ${HOME} local sed $(pwd)
+		grep "$@" then "$@" grep local "$1" $(pwd) cd local
+2>/dev/null 2>/dev/null done done
+		| && then -eu $(pwd) --verbose | readonly
+'quoted text' $(pwd) test && printf -eu "$1" /usr/bin
+awk printf | 2>/dev/null
+	| done $(pwd) /usr/bin done x=1
+		local echo echo 'quoted text' grep cd cd local sed ${HOME}
+		"$@" cd -eu 2>/dev/null && cd && /usr/bin then awk $(pwd) echo
+"$1" /usr/bin 'quoted text' readonly "$1"
+cd readonly local test && /usr/bin then readonly done 'quoted text'
+		${HOME} then local readonly | grep then -eu test | cd ${HOME} 2>/dev/null
+	local "$1" /usr/bin "$@" local
+	'quoted text' echo grep
+	x=1 grep echo cd 2>/dev/null cd done -eu --verbose | awk $(pwd) echo done then
+	readonly cd export printf export export $(pwd)
+awk -eu printf awk "$1"
+	awk local done printf | x=1
+	cd then && -eu x=1 then "$1" --verbose "$@" "$@" echo test export
+readonly test cd "$@" /usr/bin --verbose /usr/bin done test cd "$@" | --verbose
+		-eu "$1" printf sed 'quoted text' 2>/dev/null --verbose
+"$@" | export 'quoted text' "$@"
+		readonly printf -eu awk cd "$@" echo /usr/bin cd awk printf grep done 'quoted text'
+		"$@" cd awk "$@" echo 'quoted text' -eu cd | awk cd -eu cd cd x=1
+		readonly export | /usr/bin /usr/bin done
+&& 2>/dev/null 'quoted text' "$@" "$1" local printf $(pwd)
+		2>/dev/null sed awk done echo awk "$1" cd
+local local done -eu test 'quoted text' cd | cd
+then $(pwd) 2>/dev/null ${HOME} --verbose local x=1 "$@" $(pwd) echo
+	done ${HOME} readonly echo /usr/bin 'quoted text'
+sed ${HOME} && printf 2>/dev/null printf
+	echo export readonly awk grep && printf awk $(pwd)
+test | test $(pwd) $(pwd) readonly printf readonly "$@" printf /usr/bin done
+	| then $(pwd) done printf -eu 2>/dev/null --verbose 'quoted text' && --verbose
+	awk cd x=1 2>/dev/null cd sed x=1 --verbose readonly
+	awk grep | -eu grep | 'quoted text'
+		export grep local export "$1" && && ${HOME} test x=1 grep export cd x=1 export
+	| $(pwd) ${HOME} x=1 cd sed
+${HOME} x=1 printf | "$@" && sed | &&
+		/usr/bin && $(pwd) --verbose done done && -eu /usr/bin
+		done printf test "$1" done then local export
+-eu "$1" done 2>/dev/null && "$@" 'quoted text' awk
+sed done test done | | grep readonly x=1 test readonly done local
+	sed awk && && echo awk $(pwd) -eu test cd readonly x=1 --verbose
+grep local test echo "$@" readonly | --verbose | -eu grep ${HOME} /usr/bin "$@"
+	printf -eu "$1" test
+cd ${HOME} ${HOME} local
+	2>/dev/null -eu awk awk cd "$1" export then && sed
+&& readonly | && "$1" local test 'quoted text'
+		cd echo -eu sed done sed
+/usr/bin -eu --verbose "$@"
+--verbose $(pwd) x=1 $(pwd)
+	echo 'quoted text' done sed | export echo
+	"$1" /usr/bin && cd awk &&
+	${HOME} ${HOME} x=1 grep "$1" export | echo test x=1 "$@" export 'quoted text'
+local $(pwd) $(pwd) $(pwd) grep "$@"
+		--verbose 2>/dev/null /usr/bin 'quoted text'
+	done test --verbose cd local local
+		'quoted text' export printf local x=1 cd export readonly $(pwd)
+		&& && readonly 2>/dev/null /usr/bin ${HOME} awk readonly
+echo export local -eu sed test cd && -eu
+	'quoted text' -eu && echo cd 'quoted text' --verbose printf
+		then done then cd done awk x=1 readonly x=1 done
+	grep done -eu x=1 then awk --verbose "$1" $(pwd) test
+		done readonly ${HOME} ${HOME} x=1 x=1 grep then "$1" 'quoted text'
+	| 'quoted text' ${HOME}
+x=1 sed sed | echo cd cd -eu grep awk
+		x=1 'quoted text' "$@" local local x=1 export x=1 then readonly
+local readonly | && readonly cd then "$@" ${HOME} | -eu sed export
+	--verbose echo | then echo
+	printf test 'quoted text' awk test
+	&& then $(pwd) export local awk echo ${HOME} then /usr/bin
+	--verbose done "$@" echo 2>/dev/null "$1" x=1
+	&& sed "$1" && test cd done 'quoted text' done
+	done done printf done test cd | | test sed grep local
+		awk | awk --verbose readonly 'quoted text' printf grep -eu test 'quoted text'
+echo awk test local | local
+	--verbose | -eu local then -eu then "$1" -eu -eu 'quoted text' local ${HOME}
+		$(pwd) awk grep awk export printf sed 'quoted text' $(pwd)
+	-eu 'quoted text' local readonly x=1 --verbose 'quoted text' | 'quoted text'
+	${HOME} test x=1 --verbose awk && grep $(pwd) 'quoted text' $(pwd)
+$(pwd) done $(pwd) echo export local
+| grep | export printf sed sed awk 2>/dev/null test
+done "$1" readonly --verbose --verbose
+		cd readonly grep sed sed 2>/dev/null
+		export 'quoted text'
+		then echo export /usr/bin 'quoted text' &&
+	/usr/bin "$1" -eu "$1" echo
+${HOME} awk "$@" done ${HOME}
+	${HOME} x=1 "$1" | && --verbose printf ${HOME} ${HOME}
+then export 2>/dev/null export && "$@" echo /usr/bin x=1 readonly
+| /usr/bin $(pwd) grep x=1 export grep then then cd && cd done then
+	--verbose done done readonly awk cd /usr/bin
+'quoted text' | /usr/bin ${HOME}
+	2>/dev/null | "$1" x=1 /usr/bin "$@" export echo echo export readonly "$1" test
+		2>/dev/null grep -eu 'quoted text' | done echo awk printf export test readonly
+${HOME} | 'quoted text' export grep readonly awk export awk ${HOME} /usr/bin
+		export x=1 x=1 readonly "$1" cd 2>/dev/null grep
+done /usr/bin 'quoted text'
+	sed $(pwd) $(pwd) test x=1 test --verbose printf
+	"$1" grep | printf ${HOME} then sed echo
+		--verbose /usr/bin test then done
+		"$@" readonly /usr/bin then
+printf printf x=1 cd local | 'quoted text' echo $(pwd) test done then
+	"$1" -eu local grep && test 2>/dev/null sed && test && done --verbose grep
+	$(pwd) ${HOME} | 2>/dev/null "$@" then export printf --verbose export
+		$(pwd) readonly 'quoted text' done then
+	printf 2>/dev/null done then done x=1 'quoted text' 'quoted text'
+${HOME} 2>/dev/null --verbose
+		"$1" | 'quoted text' export
+	${HOME} && && awk "$1" cd "$@" && test /usr/bin
+		&& test | && grep /usr/bin 2>/dev/null done "$@" printf
+readonly "$@" "$@" cd readonly grep
+printf -eu done echo awk test 'quoted text'
+"$1" x=1 | x=1 x=1 -eu $(pwd) /usr/bin grep grep && test $(pwd) | "$@" printf printf
+${HOME} ${HOME} sed echo awk 'quoted text' then grep "$1" printf
+		then test cd x=1 cd test sed 'quoted text' export
+		"$1" "$@" --verbose /usr/bin then
+export then printf echo
+	local local "$@" -eu awk && ${HOME} "$@"
+"$1" then --verbose -eu | -eu cd readonly "$1" --verbose printf ${HOME}
+		&& --verbose test --verbose
+"$@" x=1 ${HOME} readonly /usr/bin x=1 cd awk $(pwd)
+--verbose readonly local awk sed test "$1" 2>/dev/null
+	readonly done | printf
+	sed $(pwd) then -eu printf then grep
+2>/dev/null && -eu --verbose /usr/bin export test echo /usr/bin "$1" grep done
+	echo done -eu x=1 /usr/bin x=1 grep /usr/bin readonly -eu --verbose -eu done
+		"$1" "$1" then readonly 'quoted text' then
+	readonly awk /usr/bin $(pwd) | grep x=1 cd $(pwd) | export /usr/bin
+		local /usr/bin | done -eu
+sed "$1" done "$1" sed "$@" --verbose && $(pwd) |
+"$@" ${HOME} --verbose local export
+		${HOME} printf ${HOME} -eu -eu local export sed 2>/dev/null
+	x=1 export cd awk printf | done cd readonly readonly
+		--verbose sed cd && "$@" /usr/bin
+		local "$@" 2>/dev/null done readonly grep sed test $(pwd) printf && echo
+		'quoted text' 2>/dev/null 2>/dev/null test
+		readonly 2>/dev/null "$@" ${HOME} cd 'quoted text'
+	"$@" "$@" $(pwd) test awk sed ${HOME} cd awk | grep local echo && $(pwd)
+cd x=1 printf then 2>/dev/null done | ${HOME} /usr/bin readonly
+		/usr/bin local awk test -eu x=1 "$@" readonly 'quoted text'
+cd echo local ${HOME} cd /usr/bin readonly
+		${HOME} && sed $(pwd) readonly && echo export "$1" | then done cd then echo
+	done | | done -eu grep && printf
+export cd 2>/dev/null --verbose | cd sed "$@" awk local | readonly echo
+&& $(pwd) "$@" $(pwd) 2>/dev/null printf test $(pwd) -eu
+then && x=1 printf && done printf -eu $(pwd) then awk && "$@"
+		local "$1" readonly cd "$@" awk "$@"
+		sed 2>/dev/null test --verbose
+		awk $(pwd) grep awk "$1" "$1" --verbose
+	export then && | 2>/dev/null
+		sed grep awk && done cd done ${HOME} test x=1 | | ${HOME} grep sed --verbose
+		grep ${HOME} readonly sed awk --verbose echo /usr/bin cd $(pwd) done && x=1 echo
+	"$@" x=1 done /usr/bin && awk cd awk && && --verbose ${HOME} done "$1" export "$1"
+		x=1 then test awk awk sed "$@" x=1 test "$1" test /usr/bin 2>/dev/null
+&& 2>/dev/null printf export "$1" ${HOME} echo
+awk printf --verbose 'quoted text'
+/usr/bin -eu awk /usr/bin
+	2>/dev/null && sed 'quoted text' -eu local local
+echo then ${HOME} cd -eu 2>/dev/null ${HOME} then | grep | && 2>/dev/null
+	2>/dev/null cd | 2>/dev/null printf && "$@" echo -eu
+cd ${HOME} 'quoted text' test -eu export 2>/dev/null --verbose
+	awk | echo cd done awk awk export "$1" /usr/bin
+	export readonly local ${HOME} && local ${HOME} 2>/dev/null ${HOME} "$1" export
+&& 'quoted text' echo then then
+		"$1" then -eu grep awk
+		x=1 grep export grep
+		awk -eu awk grep readonly x=1
+echo echo echo cd done sed export 'quoted text' readonly
+		echo && printf -eu -eu test ${HOME} ${HOME}
+		readonly $(pwd) 2>/dev/null cd cd cd test
+	'quoted text' test readonly then then local cd 2>/dev/null 'quoted text'
+	readonly | 2>/dev/null 'quoted text'
+		/usr/bin x=1 x=1 awk "$@" --verbose
+		'quoted text' 'quoted text' 'quoted text' done 2>/dev/null
+x=1 export readonly && $(pwd) test "$@" 'quoted text'
+		x=1 'quoted text' "$@"
+	done 'quoted text' sed ${HOME} printf
+'quoted text' && && &&
+sed awk export done ${HOME}
+	x=1 'quoted text' then /usr/bin x=1 grep readonly /usr/bin
+	"$1" | awk 2>/dev/null x=1 local cd echo local test 2>/dev/null grep
+	&& 2>/dev/null awk local export test 2>/dev/null done readonly
+	$(pwd) done -eu -eu /usr/bin test x=1
+'quoted text' && export then export
+	cd then cd test /usr/bin then echo sed echo -eu 'quoted text' $(pwd)
+then awk 'quoted text' $(pwd) done export | ${HOME} x=1 x=1
+"$@" export /usr/bin 'quoted text' readonly sed && && done then "$1" grep
+awk /usr/bin cd --verbose
+		then cd test local "$1"
+	cd && export /usr/bin sed cd done --verbose done "$1" printf
+printf --verbose | 'quoted text' ${HOME}
+echo -eu "$1" then | | readonly 'quoted text' then "$1" export export
+	$(pwd) done then echo done test "$@" cd cd awk
+	${HOME} local readonly echo "$1" export done x=1 grep
+	done --verbose echo echo
+	local test x=1 awk $(pwd) | ${HOME} readonly then | export then
+${HOME} 2>/dev/null test awk "$@" "$@" readonly readonly "$@" export
+	done x=1 awk "$@" --verbose ${HOME} echo awk -eu printf --verbose
+	${HOME} done local 2>/dev/null && done x=1 sed local local && "$@"
+	local --verbose && readonly "$@" "$@" then $(pwd)
+-eu local sed 'quoted text' | &&
+| done echo local ${HOME} readonly $(pwd)
+		"$1" "$@" awk echo ${HOME}
+		| done ${HOME} cd awk cd printf export test
+		'quoted text' --verbose printf test $(pwd) done && "$1" ${HOME} printf 'quoted text'
+		${HOME} export awk readonly --verbose
+		readonly x=1 sed "$1" export printf "$1" awk ${HOME} ${HOME}
+	done /usr/bin "$@" local done printf
+	"$1" x=1 test done x=1 &&
+	-eu "$1" | done test then local "$@"
+	cd awk 2>/dev/null -eu cd cd done /usr/bin test test export awk grep $(pwd) readonly
+	x=1 local echo ${HOME} cd readonly done x=1 "$1" 2>/dev/null 'quoted text'
+		grep "$1" 'quoted text' grep
+	cd ${HOME} done /usr/bin echo
+		"$1" echo then $(pwd) x=1 awk "$@" local export
+grep grep && done /usr/bin
+		readonly done readonly "$1"
+		local 2>/dev/null test 2>/dev/null
+	$(pwd) /usr/bin ${HOME} -eu -eu echo "$@" printf
+		echo local 'quoted text' | awk sed "$@" ${HOME} echo
+	--verbose ${HOME} $(pwd) grep ${HOME} 2>/dev/null awk
+x=1 then awk /usr/bin echo awk cd readonly /usr/bin
+'quoted text' local && then x=1 /usr/bin "$@" then /usr/bin
+		then printf x=1 sed "$1" grep awk /usr/bin
+		&& cd printf ${HOME} -eu $(pwd) sed readonly "$@" cd 'quoted text'
+	grep 'quoted text' cd | cd grep printf "$@" cd --verbose
+	then printf sed /usr/bin then | 2>/dev/null test local done ${HOME}
+		cd printf ${HOME} && printf -eu echo 'quoted text'
+	readonly && "$1" export --verbose $(pwd) ${HOME} export cd printf
+$(pwd) -eu printf printf cd readonly awk $(pwd)
+		| $(pwd) awk printf $(pwd) export
+$(pwd) cd ${HOME} grep "$@" ${HOME} x=1 awk done && done ${HOME} export
+	| done cd test "$@" readonly -eu
+		echo then echo --verbose test export grep printf awk export
+printf && then export cd awk | printf
+"$@" 2>/dev/null export "$1" "$@"
+		readonly sed && export "$@" /usr/bin 2>/dev/null -eu export /usr/bin
+	test "$@" readonly 'quoted text' 'quoted text'
+		grep sed "$1" echo done readonly echo 'quoted text' then done ${HOME}
+		"$1" local | cd "$@" 'quoted text' printf $(pwd) done cd --verbose
+sed test "$1" echo awk x=1 $(pwd) done cd echo && "$@"
+cd then export -eu 'quoted text' awk ${HOME} cd $(pwd) echo "$@" echo test done
+	"$@" printf then grep --verbose export "$1" x=1 --verbose
+	awk awk printf "$@" "$1" done "$@" export test readonly test 2>/dev/null
+		readonly x=1 | awk test 2>/dev/null && done | && ${HOME}
+		"$@" sed local ${HOME} -eu awk readonly $(pwd)
+		${HOME} $(pwd) export then cd export awk 2>/dev/null local
+2>/dev/null /usr/bin 'quoted text' export "$1" | test cd readonly export test
+	--verbose readonly printf
+x=1 readonly 2>/dev/null -eu done echo
+sed sed cd "$@" then awk | sed awk 'quoted text'
+		test 2>/dev/null sed && cd local 'quoted text' 'quoted text' 'quoted text' grep
+		readonly x=1 2>/dev/null test | sed test $(pwd) "$@" && $(pwd) export
+&& sed then done sed -eu | cd readonly
+		${HOME} ${HOME} awk export x=1 ${HOME} test echo 'quoted text' cd && done
+	test | cd cd /usr/bin "$@" x=1 | test && awk echo -eu printf "$1" $(pwd)
+		"$@" test echo printf | local export export "$1" done /usr/bin
+		/usr/bin awk grep local 'quoted text' ${HOME} 'quoted text'
+	| grep -eu printf awk awk then grep
+	export export readonly sed local then 2>/dev/null awk awk printf readonly && printf
+${HOME} 2>/dev/null echo export export local done -eu grep
+		/usr/bin export "$@" test x=1 readonly grep test sed cd /usr/bin
+		local sed readonly && test sed then sed
+		${HOME} 'quoted text' then done "$@"
+		readonly export 2>/dev/null readonly done | readonly
+		printf 2>/dev/null export /usr/bin -eu 2>/dev/null readonly
+	/usr/bin -eu 'quoted text' export done grep $(pwd) export
+		'quoted text' $(pwd) -eu printf test readonly $(pwd) awk
+		grep grep ${HOME} readonly x=1 echo $(pwd) /usr/bin | local echo $(pwd)
+readonly readonly grep grep awk x=1 $(pwd) export echo test printf cd 'quoted text'
+		export -eu | local "$@" readonly /usr/bin ${HOME} --verbose &&
+		'quoted text' test grep echo $(pwd)
+	&& test grep "$@" echo sed "$@" echo x=1 local cd sed $(pwd) sed
+		printf done -eu $(pwd) "$@" test | |
+		2>/dev/null test sed 2>/dev/null $(pwd) --verbose
+awk /usr/bin --verbose --verbose
+		echo local cd done -eu 2>/dev/null done awk echo -eu /usr/bin
+-eu 2>/dev/null && then cd awk 'quoted text' "$@" readonly
+	local awk local "$1" "$@" 'quoted text' | local sed
+		x=1 /usr/bin ${HOME} then done ${HOME} &&
+	2>/dev/null test awk grep -eu grep export local && ${HOME} "$1" x=1 $(pwd) &&
+"$1" readonly echo local printf grep | done readonly
+	$(pwd) "$1" "$1" && cd grep sed --verbose
+	test awk awk 2>/dev/null then
+		sed -eu "$1" local ${HOME} done done && local awk --verbose echo x=1 test done
+	$(pwd) echo x=1 test readonly sed
+	export export cd "$@" awk echo
+	${HOME} --verbose | echo readonly
+test echo -eu 2>/dev/null 2>/dev/null
+&& export && grep sed "$@" --verbose grep x=1 "$@" --verbose readonly && && --verbose
+		printf --verbose printf 2>/dev/null local
+	"$1" cd 'quoted text' 'quoted text' awk then local test local test
+	2>/dev/null awk printf /usr/bin cd /usr/bin && "$1" done grep
+$(pwd) then 'quoted text' | $(pwd) x=1 x=1 | printf
+		$(pwd) sed 'quoted text' grep sed x=1 grep -eu readonly -eu cd /usr/bin 2>/dev/null
+		| 'quoted text' x=1 | local then test /usr/bin sed $(pwd) cd ${HOME} 'quoted text'
+		"$1" | echo done local ${HOME} readonly
+${HOME} && x=1 "$@" grep $(pwd)
+	| grep $(pwd) x=1 done -eu ${HOME} --verbose awk "$@" awk -eu "$@" 2>/dev/null
+'quoted text' printf | && && 2>/dev/null /usr/bin
+	x=1 "$@" "$1" && echo cd readonly x=1 done
+	| x=1 $(pwd) 'quoted text' echo
+	export 2>/dev/null | cd sed
+	"$1" cd -eu local | echo 'quoted text' "$@"
+"$@" sed "$1" "$@" 2>/dev/null | 2>/dev/null
+$(pwd) $(pwd) done test -eu then readonly ${HOME} readonly x=1 echo grep --verbose
+		-eu --verbose printf | ${HOME} "$1" "$@" local "$@" local
+	printf local x=1 local -eu echo x=1 readonly
+cd --verbose cd -eu 'quoted text' cd local grep grep done awk ${HOME}
+		'quoted text' local 'quoted text'
+	export done -eu /usr/bin
+		/usr/bin cd x=1 sed /usr/bin readonly "$1" printf readonly
+		done local --verbose $(pwd) "$@" --verbose local
+	done grep x=1 cd awk test readonly echo local cd "$@" | $(pwd) done
+		--verbose 2>/dev/null grep "$@" awk $(pwd) then cd x=1 awk
+sed awk echo 'quoted text' $(pwd)
+printf 'quoted text' -eu /usr/bin "$1" $(pwd) then then export "$1" export ${HOME}
+cd "$@" ${HOME} cd then then ${HOME} readonly /usr/bin "$@"
+		"$@" --verbose printf readonly done cd echo | readonly | "$1" "$@" 'quoted text'
+test | awk 'quoted text' echo ${HOME} echo cd x=1 readonly $(pwd)
+then cd then && 'quoted text' export readonly printf sed done -eu printf
+		"$1" cd sed ${HOME} --verbose "$1" local | printf done export
+		awk --verbose echo -eu $(pwd) && export
+| awk done | then sed grep && local export
+		awk cd x=1 done x=1 printf awk done local &&
+		"$@" && awk "$1" sed x=1 -eu 'quoted text' echo | && ${HOME} grep grep 'quoted text'
+		&& 'quoted text' /usr/bin sed --verbose | cd local readonly "$@" -eu sed awk awk
+--verbose grep --verbose cd export "$1" "$@" | --verbose cd 'quoted text'
+		awk awk printf awk done --verbose cd "$@" --verbose ${HOME} "$@" test | 'quoted text'
+	${HOME} | "$1" echo echo $(pwd)
+		'quoted text' && sed 'quoted text' local x=1 $(pwd) "$@" echo $(pwd) then sed
+	cd $(pwd) 'quoted text' -eu 2>/dev/null awk && then
+	export x=1 -eu /usr/bin then /usr/bin local --verbose
+x=1 2>/dev/null "$1" "$1" --verbose then "$1" x=1 'quoted text' --verbose
+	done awk test "$1" x=1 2>/dev/null cd echo sed local printf 'quoted text'
+	readonly cd $(pwd) printf --verbose echo 2>/dev/null printf "$1" grep then done
+local test | echo cd sed
+2>/dev/null "$1" --verbose export
+grep grep grep && local x=1 grep awk echo then "$1" done export
+${HOME} then done | readonly readonly sed "$@" grep -eu
+	test echo $(pwd) echo awk
+		readonly done test done 2>/dev/null "$@" -eu "$1" x=1 local /usr/bin --verbose cd
+printf readonly /usr/bin
+		-eu $(pwd) x=1 ${HOME} $(pwd) --verbose
+"$1" done printf "$@" 2>/dev/null
+		/usr/bin $(pwd) -eu printf --verbose sed then awk sed /usr/bin readonly
+		local | then && readonly export grep 'quoted text'
+local x=1 awk readonly | -eu test test awk "$@" ${HOME}
+		-eu cd readonly export export readonly $(pwd) "$1" "$@" -eu readonly
+x=1 local --verbose $(pwd) "$1" 'quoted text' x=1 "$1" "$@" local readonly
+		local --verbose "$1" -eu awk then echo -eu done 2>/dev/null --verbose printf grep
+	${HOME} 'quoted text' -eu grep "$@" ${HOME} local export grep | ${HOME}
+-eu echo readonly printf --verbose
+		awk x=1 && test && "$1" -eu "$@" cd export local
+	&& && "$1" done echo | then 2>/dev/null -eu cd local --verbose
+&& /usr/bin -eu --verbose $(pwd)
+		cd readonly 2>/dev/null then export readonly "$1" && --verbose $(pwd)
+	"$1" --verbose cd 2>/dev/null && awk
+x=1 cd done sed then $(pwd) cd grep
+	"$1" done "$@" echo awk awk done $(pwd) && x=1 x=1 "$@" |
+local echo /usr/bin | echo 2>/dev/null awk done ${HOME} | "$@" echo
+		local test 2>/dev/null 2>/dev/null echo cd grep 2>/dev/null local $(pwd)
+	done "$1" grep | 2>/dev/null readonly ${HOME} grep readonly
+	grep /usr/bin cd -eu readonly local cd test && -eu printf 'quoted text'
+		2>/dev/null 2>/dev/null 'quoted text' && 2>/dev/null "$1"
+	&& export cd then cd grep
+	test printf readonly
+	'quoted text' && -eu echo local | test printf
+export && 2>/dev/null
+--verbose x=1 then ${HOME} "$@" then printf "$1" printf "$@" |
+	$(pwd) ${HOME} export test sed $(pwd) grep echo $(pwd) -eu
+	printf local 'quoted text' done $(pwd) "$1" printf export 'quoted text'
+		printf "$@" --verbose cd "$1" $(pwd) "$1" x=1 | x=1 --verbose
+	cd | export sed $(pwd) x=1 | grep cd | && --verbose $(pwd)
+		$(pwd) export grep --verbose export sed test 2>/dev/null
+		printf && && "$1" x=1 "$1" sed
+--verbose 'quoted text' "$@" readonly grep $(pwd)
+	awk then 2>/dev/null local awk | -eu echo readonly sed "$@" grep && grep printf
+grep x=1 echo /usr/bin && /usr/bin export ${HOME} x=1 cd local --verbose
+grep ${HOME} | && test sed "$1" x=1 export
+	${HOME} awk ${HOME} printf --verbose
+| export $(pwd) --verbose printf $(pwd) local test
+&& printf "$1" "$@" readonly echo --verbose grep sed
+		${HOME} | ${HOME} | | echo local "$1" -eu printf local $(pwd) "$@"
+awk $(pwd) awk "$@" sed "$1" x=1 awk "$@"
+	--verbose /usr/bin printf
+--verbose --verbose "$@" x=1 printf "$@" then 2>/dev/null
+		echo | cd awk test awk grep && done 2>/dev/null sed -eu grep sed done cd |
+awk export readonly /usr/bin ${HOME} then 2>/dev/null printf $(pwd) ${HOME} ${HOME}
+	'quoted text' then "$@" "$@"
+test --verbose export sed --verbose --verbose
+		-eu -eu readonly | local echo
+	2>/dev/null done "$@"
+		"$1" ${HOME} test -eu sed printf test test local export
+echo cd "$@" x=1 readonly --verbose awk 'quoted text' "$1" readonly awk
+	local readonly printf -eu
+	2>/dev/null export sed "$@" readonly local awk then
+	/usr/bin done $(pwd) -eu then -eu x=1 cd local cd
+	sed && ${HOME} && ${HOME} awk 2>/dev/null "$1" then 2>/dev/null
+	awk $(pwd) test then --verbose $(pwd) test && "$1" --verbose awk
+$(pwd) grep && --verbose sed
+	done export export 'quoted text' /usr/bin grep sed readonly 'quoted text'
+	${HOME} export local test printf test test
+	&& readonly readonly sed --verbose cd cd 'quoted text'
+	&& awk x=1 readonly /usr/bin ${HOME} printf x=1 awk "$1" "$@" /usr/bin
+	export ${HOME} sed done 'quoted text' grep -eu grep
+	"$@" printf local done then "$1" && -eu grep $(pwd) /usr/bin test
+readonly sed awk 'quoted text' $(pwd) readonly readonly x=1 cd "$@" grep x=1 "$@"
+	${HOME} sed x=1 /usr/bin && | 2>/dev/null
+		| --verbose sed readonly echo /usr/bin
+	"$@" && readonly "$1" then echo 2>/dev/null grep "$@" -eu
+		"$1" | ${HOME} sed awk | done then echo awk echo 'quoted text' then /usr/bin | local
+test local 2>/dev/null "$@" readonly /usr/bin "$@" cd "$@" export local test
+	sed | 'quoted text' /usr/bin "$@" |
+	echo "$@" --verbose -eu then x=1 printf ${HOME} sed ${HOME} /usr/bin $(pwd)
+		sed $(pwd) -eu && && ${HOME} cd then ${HOME} ${HOME}
+"$1" /usr/bin cd && /usr/bin --verbose x=1 -eu local -eu awk ${HOME}
+	echo 2>/dev/null grep -eu $(pwd) "$@" --verbose 'quoted text' grep | "$1" $(pwd)
+	"$@" then "$1" -eu sed && awk readonly ${HOME}
+	awk sed awk local test "$@"
+	x=1 printf -eu x=1 -eu 2>/dev/null 'quoted text' $(pwd) ${HOME} ${HOME}
+2>/dev/null ${HOME} "$@" grep "$@" 2>/dev/null x=1 $(pwd)
+		&& then 2>/dev/null ${HOME} test printf ${HOME} printf local /usr/bin
+	/usr/bin 2>/dev/null ${HOME}
+		sed --verbose test local $(pwd) "$@" ${HOME} readonly ${HOME} export then "$1"
+		awk cd /usr/bin export awk
+awk 'quoted text' local "$@" --verbose
+done /usr/bin | --verbose
+-eu 'quoted text' cd /usr/bin -eu 2>/dev/null /usr/bin echo
+readonly test && | readonly 2>/dev/null $(pwd) $(pwd) | x=1
+&& local done then export "$1"
+	cd then awk grep printf "$1" 2>/dev/null /usr/bin test local
+	2>/dev/null 'quoted text' readonly printf grep $(pwd) grep printf
+		${HOME} test -eu printf "$1"
+${HOME} "$1" then local $(pwd) then printf 2>/dev/null "$@"
+	done 'quoted text' sed && export echo then -eu printf printf sed 2>/dev/null
+	done local 2>/dev/null echo "$@" sed 'quoted text' | x=1 cd 2>/dev/null
+		sed test test | $(pwd) grep done ${HOME}
+export 2>/dev/null readonly
+	$(pwd) sed 'quoted text'
+--verbose echo then ${HOME} "$@" local grep echo done -eu --verbose "$1" 'quoted text'
+export grep -eu test && grep -eu ${HOME} --verbose
+		&& done readonly echo printf && cd 2>/dev/null 'quoted text' then cd readonly printf
+		export readonly --verbose then export x=1 ${HOME} grep
+		awk && /usr/bin "$@" printf -eu cd
+		sed /usr/bin echo readonly then
+		"$1" local 2>/dev/null ${HOME} awk cd cd "$@" /usr/bin
+		| sed local test sed "$1" awk
+	cd /usr/bin -eu done cd test sed done
+awk test | x=1 | 'quoted text' | x=1 sed x=1 x=1 sed $(pwd)
+&& && then && cd awk grep
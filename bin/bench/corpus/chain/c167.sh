@@ -0,0 +1,2001 @@
+'quoted text' local ${HOME} readonly -eu "$@" grep export /usr/bin sed done &&
+	done local x=1 grep "$@"
+	echo test /usr/bin 2>/dev/null
+	/usr/bin -eu export --verbose
+	test export ${HOME} then done then ${HOME} export 2>/dev/null cd
+		-eu readonly "$@" sed 'quoted text' export 2>/dev/null --verbose ${HOME} |
+x=1 --verbose test sed /usr/bin cd x=1 printf --verbose -eu "$@"
+2>/dev/null grep 'quoted text' -eu readonly 'quoted text' sed ${HOME}
+| readonly done "$1" && --verbose awk /usr/bin "$@"
+	${HOME} 'quoted text' sed $(pwd) test 2>/dev/null echo done 'quoted text'
+"$1" awk && /usr/bin "$@" "$1" 2>/dev/null done 'quoted text' 2>/dev/null
+	${HOME} printf readonly "$@" sed readonly | | then grep test done
+2>/dev/null export echo grep echo $(pwd) --verbose sed && $(pwd) "$@" $(pwd)
+	| echo ${HOME} cd x=1 'quoted text'
+		"$1" awk x=1 printf local ${HOME} grep $(pwd) | | ${HOME} --verbose done printf
+	local local done && done /usr/bin | echo readonly -eu cd
+&& cd 2>/dev/null export sed |
+"$1" x=1 done readonly printf
+		2>/dev/null x=1 && "$@"
+		local /usr/bin /usr/bin $(pwd) x=1 local 2>/dev/null -eu 'quoted text'
+		test 'quoted text' test grep | echo awk readonly awk cd 2>/dev/null readonly
+		--verbose awk x=1 | "$1"
+		cd x=1 'quoted text' export /usr/bin test ${HOME}
+		sed echo local local printf --verbose x=1 x=1 $(pwd) --verbose x=1 | readonly
+"$1" ${HOME} && cd then 2>/dev/null $(pwd) done sed export
+&& ${HOME} then grep -eu ${HOME} x=1 "$1" done printf ${HOME} awk test export local
+		grep cd echo && readonly /usr/bin ${HOME} then awk test done awk ${HOME} printf
+	/usr/bin ${HOME} x=1 "$1"
+	/usr/bin done printf 2>/dev/null ${HOME}
+		2>/dev/null 'quoted text' -eu echo /usr/bin readonly -eu local export cd ${HOME}
+	export done sed export then export /usr/bin 'quoted text'
+printf printf test 2>/dev/null $(pwd) printf "$@" test --verbose "$1" sed readonly
+		then cd | 2>/dev/null /usr/bin local export readonly
+		| local -eu && ${HOME} 'quoted text'
+	$(pwd) $(pwd) --verbose $(pwd) /usr/bin cd /usr/bin /usr/bin && -eu 2>/dev/null
+grep -eu grep echo readonly $(pwd) x=1 sed 'quoted text' cd "$1" 'quoted text'
+readonly readonly export grep echo x=1 --verbose -eu cd /usr/bin done -eu awk
+		test test $(pwd) "$1" awk x=1 'quoted text'
+		awk sed then sed ${HOME} $(pwd) export
+	| x=1 $(pwd) /usr/bin grep "$1" /usr/bin
+&& "$@" sed sed "$1" echo sed --verbose "$1" ${HOME} 'quoted text'
+	"$@" sed -eu then | cd grep | cd -eu "$1" 'quoted text'
+	2>/dev/null $(pwd) "$1" ${HOME}
+	"$1" local awk cd 2>/dev/null grep readonly local echo "$1"
+		readonly printf local done x=1
+then then test grep echo "$1" && && $(pwd) sed /usr/bin $(pwd) x=1 'quoted text'
+	printf done local echo sed readonly 2>/dev/null |
+export awk /usr/bin grep && "$@" awk done --verbose ${HOME}
+"$@" x=1 test "$@" printf "$@"
+		x=1 then export 2>/dev/null test awk then && x=1 $(pwd)
+		2>/dev/null 'quoted text' "$@" cd /usr/bin /usr/bin
+		'quoted text' grep -eu
+	'quoted text' done export $(pwd) test "$@"
+test x=1 sed then --verbose printf -eu 2>/dev/null
+	-eu && --verbose grep -eu done $(pwd) 'quoted text' "$@" readonly 'quoted text'
+		"$1" awk "$@" 2>/dev/null then x=1 --verbose
+local -eu cd x=1 && x=1 ${HOME} grep
+		done done readonly && "$@" local readonly 'quoted text'
+${HOME} x=1 $(pwd) cd cd $(pwd) -eu awk then readonly
+	done /usr/bin "$1" then $(pwd) sed local done sed | export 'quoted text'
+		-eu 2>/dev/null then cd sed && ${HOME} cd ${HOME} cd grep done readonly
+		--verbose | printf test $(pwd)
+		'quoted text' /usr/bin
+| /usr/bin readonly /usr/bin ${HOME} echo then then
+		$(pwd) ${HOME} ${HOME} 'quoted text'
+		sed then 2>/dev/null done $(pwd) test | done export "$@" | echo 'quoted text'
+	echo printf cd test && awk awk && | ${HOME} /usr/bin $(pwd)
+2>/dev/null | printf printf echo "$@" readonly 2>/dev/null export cd test export
+		'quoted text' 'quoted text' echo x=1 awk
+	cd "$1" 2>/dev/null echo awk done printf && local "$@" awk cd $(pwd) export
+	| /usr/bin $(pwd) && 'quoted text' /usr/bin cd then then x=1 sed export
+	done "$1" -eu awk 'quoted text' cd test /usr/bin | /usr/bin printf "$@" "$@"
+	awk readonly ${HOME} --verbose readonly $(pwd) 2>/dev/null
+-eu "$1" ${HOME} ${HOME} cd "$@" "$1"
+x=1 $(pwd) /usr/bin "$1" awk "$1" "$@" sed readonly ${HOME} grep $(pwd) -eu ${HOME}
+		&& cd "$@" 'quoted text' echo --verbose export
+"$1" printf ${HOME} --verbose 2>/dev/null $(pwd)
+${HOME} local awk printf readonly "$@" awk then --verbose x=1 grep -eu -eu
+		grep export export /usr/bin | cd 'quoted text' | --verbose | | readonly echo
+		printf && /usr/bin cd -eu readonly readonly 2>/dev/null --verbose grep
+	then then "$@" cd grep printf local local grep -eu export
+	printf readonly readonly sed "$@" test x=1 x=1
+		-eu then 'quoted text' "$1"
+		printf "$1" echo x=1 readonly "$1" local then
+awk echo -eu export | -eu $(pwd) -eu 2>/dev/null 'quoted text'
+	echo test awk done local 'quoted text' x=1 /usr/bin
+--verbose export && && x=1 | "$@" 'quoted text' "$@" 'quoted text'
+		&& done ${HOME} cd printf then export readonly "$@" -eu printf
+"$@" test test printf ${HOME} "$1" then /usr/bin export /usr/bin x=1 "$@" &&
+		$(pwd) /usr/bin printf | "$@" export sed printf
+		grep x=1 sed /usr/bin ${HOME} "$@" echo sed readonly
+	awk cd then echo echo /usr/bin cd 2>/dev/null awk 2>/dev/null export x=1 "$1" cd
+	test awk x=1 ${HOME} readonly echo
+	echo export done /usr/bin && -eu readonly $(pwd) | local sed echo
+		/usr/bin local grep printf -eu local | cd x=1 /usr/bin && ${HOME} readonly
+cd 2>/dev/null x=1 then "$1" printf
+local awk "$@" "$1" 'quoted text' local
+test ${HOME} readonly --verbose done && 2>/dev/null
+		"$@" $(pwd) ${HOME} awk
+		2>/dev/null --verbose sed | printf
+		--verbose sed | "$1" 2>/dev/null
+		x=1 "$1" then then awk x=1 readonly
+then "$@" /usr/bin /usr/bin readonly local "$@" 'quoted text' cd printf then
+"$@" export "$@" /usr/bin "$1" 2>/dev/null
+	"$1" sed export test test done "$@" grep "$@"
+		| "$@" $(pwd) then sed test then readonly /usr/bin 2>/dev/null
+		$(pwd) readonly | --verbose echo export awk
+		-eu printf 'quoted text' readonly /usr/bin "$@" 'quoted text'
+	--verbose /usr/bin export printf printf
+		x=1 printf && done then
+'quoted text' done x=1 grep done ${HOME} done
+		'quoted text' cd && awk --verbose
+		awk | sed "$1" | "$@" done test done readonly -eu echo printf x=1 "$@" readonly
+export echo then $(pwd) cd echo
+"$@" export -eu export x=1 && && && then "$@" sed
+	then cd -eu /usr/bin awk readonly &&
+	"$@" echo printf $(pwd) $(pwd) | --verbose "$@" readonly
+| awk $(pwd) x=1 test test readonly && | |
+	&& readonly printf readonly $(pwd) $(pwd) $(pwd) "$@" x=1 2>/dev/null
+done export "$1" local local test &&
+test /usr/bin cd | | 'quoted text' /usr/bin export
+2>/dev/null readonly readonly && printf then x=1 local
+		cd $(pwd) --verbose sed "$1" ${HOME} printf export -eu
+--verbose 2>/dev/null done --verbose $(pwd)
+	$(pwd) && then cd cd readonly test /usr/bin echo --verbose -eu test
+	grep /usr/bin "$@" done ${HOME} then x=1 grep export
+		&& readonly -eu test -eu done grep "$1" echo
+| -eu local /usr/bin done test local && echo
+	/usr/bin echo test grep test then test
+		| sed "$1" readonly sed local
+		readonly awk awk test /usr/bin cd awk sed x=1 $(pwd) "$1" ${HOME}
+		local /usr/bin $(pwd) /usr/bin export cd export | cd 'quoted text'
+	grep awk then -eu x=1 cd -eu && local -eu 'quoted text' readonly sed done
+		test awk local export grep done "$1" ${HOME} grep | echo awk -eu
+then awk ${HOME} 'quoted text' sed readonly sed /usr/bin local grep
+	"$@" echo readonly && then | && test
+2>/dev/null x=1 'quoted text' x=1 "$@"
+		printf readonly grep grep 'quoted text' -eu done awk $(pwd)
+--verbose test "$@" export $(pwd) && awk sed $(pwd) 'quoted text' $(pwd) x=1 &&
+		| "$1" readonly "$@" echo printf -eu sed 2>/dev/null sed -eu test test
+		export $(pwd) then 'quoted text' grep $(pwd) echo
+/usr/bin test /usr/bin printf readonly 'quoted text' x=1
+		echo test test export done test grep x=1
+		x=1 grep && 2>/dev/null
+	sed "$@" grep echo echo awk 'quoted text'
+then test && printf 'quoted text' $(pwd) export awk test sed |
+"$1" printf done local
+	awk ${HOME} sed done export "$@" -eu test /usr/bin then
+		cd cd x=1 readonly then then test then sed local test "$@" "$@" printf /usr/bin
+		/usr/bin readonly $(pwd) awk export then "$1" readonly x=1 awk
+	"$@" awk "$1" 2>/dev/null sed | && grep "$1" cd "$1" -eu -eu readonly sed grep
+		"$1" ${HOME} test sed cd local export awk export 2>/dev/null grep
+		&& local x=1 sed awk "$@" sed
+	| echo grep && echo then $(pwd)
+		grep readonly 'quoted text' awk cd awk done 2>/dev/null export 2>/dev/null
+readonly readonly printf && awk readonly export awk grep printf
+		$(pwd) awk readonly | 2>/dev/null
+	export local local done cd 2>/dev/null --verbose "$@" sed cd "$1" --verbose
+	then sed local | "$@" grep
+	$(pwd) printf readonly export grep && then sed
+&& && | readonly 'quoted text' test x=1 then /usr/bin "$@" "$@"
+		--verbose | 2>/dev/null awk local readonly
+"$@" then && x=1 $(pwd) 2>/dev/null "$@" export awk grep then
+export test 'quoted text' awk 2>/dev/null $(pwd) /usr/bin
+	-eu -eu && grep x=1 --verbose "$1" readonly grep sed done $(pwd) then
+| export sed $(pwd) -eu "$1" done | cd
+		-eu cd ${HOME} export local --verbose "$1" printf 'quoted text'
+	${HOME} grep export ${HOME} export sed ${HOME}
+printf awk "$1" $(pwd) --verbose
+	"$@" test && --verbose "$1" && echo x=1 | readonly 2>/dev/null
+| 'quoted text' export awk && 2>/dev/null $(pwd) "$@" --verbose | printf
+		readonly "$@" readonly printf "$@" --verbose readonly cd done printf readonly
+| "$@" ${HOME} "$1" | "$@" local x=1 awk grep
+		readonly x=1 -eu then 2>/dev/null 2>/dev/null local readonly
+cd /usr/bin grep test local "$1" test --verbose
+	grep done local --verbose 2>/dev/null cd 'quoted text' readonly
+		echo export "$@" done readonly awk "$1" echo echo
+	$(pwd) readonly -eu export ${HOME} sed 'quoted text' 2>/dev/null
+	printf | printf done && readonly 'quoted text' test cd x=1 --verbose local "$1"
+		done echo done | && awk then ${HOME}
+	2>/dev/null readonly | 2>/dev/null readonly | | --verbose && 'quoted text'
+then && 2>/dev/null local readonly
+	| then sed 2>/dev/null test test $(pwd) readonly $(pwd) "$1"
+	test grep | grep echo $(pwd) | echo then local "$1" &&
+		2>/dev/null export done
+| /usr/bin ${HOME} /usr/bin /usr/bin export awk "$@" awk
+-eu x=1 grep /usr/bin 2>/dev/null "$@" printf echo echo grep
+| /usr/bin 'quoted text' "$1" 'quoted text'
+--verbose "$@" sed export "$1"
+	2>/dev/null echo "$1" awk grep export local -eu awk 2>/dev/null test && "$1" &&
+		${HOME} sed | x=1 cd test ${HOME} awk cd awk -eu /usr/bin awk /usr/bin
+		'quoted text' 2>/dev/null printf
+	/usr/bin "$@" $(pwd) 'quoted text'
+printf done awk done sed printf 2>/dev/null local && "$1"
+awk grep grep cd 'quoted text' x=1 then done /usr/bin 2>/dev/null
+test done 2>/dev/null -eu x=1
+	test local | awk readonly local
+| sed $(pwd) --verbose printf then local "$1" local $(pwd) &&
+	${HOME} local test echo 2>/dev/null x=1 sed test --verbose readonly
+	sed test "$1" 'quoted text' && /usr/bin && "$1" grep 2>/dev/null | sed
+		local && x=1 then x=1 -eu done --verbose | 'quoted text'
+"$@" 2>/dev/null x=1 2>/dev/null done
+	export echo 'quoted text'
+	done --verbose done grep "$1" done export $(pwd) sed readonly echo "$@"
+	test /usr/bin export /usr/bin 'quoted text' then then ${HOME}
+		cd && test | | cd --verbose 'quoted text'
+		&& /usr/bin printf done -eu done echo grep
+		'quoted text' ${HOME} ${HOME} done export done
+		'quoted text' local sed
+	sed awk local grep -eu export
+	"$1" 'quoted text' "$@" export sed printf printf --verbose --verbose
+		done x=1 cd "$@" $(pwd) | | /usr/bin -eu /usr/bin /usr/bin -eu /usr/bin
+	/usr/bin 2>/dev/null sed echo /usr/bin printf 2>/dev/null $(pwd) test
+		cd | x=1 local export grep "$1" | cd $(pwd) export local readonly 'quoted text'
+printf test --verbose -eu /usr/bin export sed $(pwd)
+/usr/bin sed done $(pwd) export grep "$@" x=1
+	local cd export -eu && -eu readonly readonly
+	x=1 test ${HOME} 'quoted text' done sed local grep cd
+		sed then done done printf
+readonly /usr/bin ${HOME} ${HOME} local local
+		readonly "$@" test printf
+	&& cd "$1" | -eu test | then ${HOME} ${HOME}
+		-eu sed "$@" readonly "$1" && --verbose "$@" |
+cd readonly /usr/bin sed test local printf "$@" readonly done readonly
+printf export export $(pwd) echo sed "$@" && grep printf "$1" "$@" echo $(pwd)
+echo sed test /usr/bin --verbose done local 2>/dev/null
+		awk --verbose done /usr/bin
+&& && ${HOME} readonly "$1" awk cd
+		test local "$1" --verbose awk grep readonly done ${HOME} export sed
+| -eu "$1" echo grep "$1" 'quoted text' readonly done grep "$1"
+	$(pwd) echo awk readonly "$1" readonly | x=1 readonly x=1 export
+		"$1" done sed awk x=1 then | cd echo "$@" "$@" 'quoted text' 'quoted text'
+| local | sed -eu printf echo readonly grep
+"$@" cd | export sed then -eu echo | cd test 2>/dev/null export test echo
+	awk | "$1" local --verbose /usr/bin done x=1 2>/dev/null "$1" /usr/bin
+sed $(pwd) then x=1 | sed then ${HOME} grep test | ${HOME} "$1" echo then x=1
+"$1" echo | /usr/bin --verbose
+	2>/dev/null $(pwd) done 'quoted text' "$@" x=1 export grep export
+		$(pwd) local x=1 "$1" x=1 -eu sed x=1 | grep | grep
+		printf "$1" sed x=1 ${HOME} ${HOME} printf done printf
+	export && printf | done export -eu -eu | ${HOME}
+	$(pwd) test --verbose $(pwd) cd | | readonly -eu $(pwd) readonly awk 2>/dev/null
+	${HOME} export | cd --verbose "$1" readonly
+		2>/dev/null printf ${HOME} "$1" readonly awk | sed 2>/dev/null
+		$(pwd) $(pwd) grep x=1 awk "$1" test $(pwd) 'quoted text' test
+		awk | x=1 readonly x=1 "$1" "$@" | --verbose echo readonly printf awk ${HOME}
+grep --verbose && ${HOME} | x=1 "$1"
+export | && ${HOME} /usr/bin sed awk --verbose sed 'quoted text'
+'quoted text' "$@" 'quoted text' x=1 "$1" "$1" printf awk 2>/dev/null
+		sed -eu /usr/bin printf $(pwd) ${HOME} then /usr/bin && x=1 --verbose
+	awk test "$@" x=1 x=1 grep -eu | done grep "$1" x=1 sed cd x=1 --verbose readonly
+-eu 'quoted text' 2>/dev/null | | 2>/dev/null && -eu x=1 cd "$@" "$@"
+		2>/dev/null test done -eu -eu readonly 2>/dev/null 2>/dev/null export
+		"$1" 2>/dev/null && 2>/dev/null test "$1" 'quoted text' local ${HOME} 'quoted text'
+		grep echo done $(pwd) echo
+		'quoted text' ${HOME}
+	then | 2>/dev/null test sed "$@" x=1 "$1" grep $(pwd) then "$1" done --verbose
+	then x=1 x=1 -eu sed grep sed then test -eu /usr/bin
+-eu awk | sed /usr/bin | /usr/bin sed echo test && ${HOME}
+		${HOME} 2>/dev/null /usr/bin && 'quoted text' -eu
+	--verbose echo "$@" test test done readonly 'quoted text' done "$@" | export
+readonly "$1" then $(pwd) readonly sed test "$1" x=1 $(pwd) grep sed |
+		&& then -eu 2>/dev/null "$@" sed cd 'quoted text' /usr/bin --verbose &&
+2>/dev/null "$1" $(pwd) cd "$@" readonly
+printf 2>/dev/null cd
+done echo then then test 2>/dev/null
+	| x=1 ${HOME} export test "$@" "$@" done && "$1" readonly printf 2>/dev/null echo
+$(pwd) awk done "$1" "$@" | $(pwd) echo then
+		-eu sed 'quoted text' --verbose | && printf cd "$1"
+		export printf awk 'quoted text' $(pwd) sed cd local | -eu 'quoted text' "$@"
+cd && && sed ${HOME} grep sed cd && echo && /usr/bin echo "$@" | /usr/bin
+x=1 ${HOME} then echo export cd x=1 x=1 cd
+	cd printf && "$@" sed ${HOME} export | 2>/dev/null /usr/bin
+	test "$@" $(pwd) then "$@" && sed cd 2>/dev/null "$1" then
+	cd "$@" /usr/bin test && | echo -eu cd --verbose ${HOME} grep /usr/bin 'quoted text'
+test x=1 && cd awk && 2>/dev/null printf echo ${HOME} local 'quoted text'
+cd local echo "$@" 'quoted text'
+		x=1 export done test 2>/dev/null x=1 then printf 'quoted text'
+		readonly grep "$1" "$@" &&
+	test $(pwd) "$1" "$@" printf 2>/dev/null --verbose echo
+		${HOME} cd "$@" 2>/dev/null readonly readonly x=1 test 'quoted text'
+		/usr/bin | && -eu -eu 'quoted text'
+	printf test "$@" | readonly readonly /usr/bin $(pwd)
+	2>/dev/null x=1 && $(pwd) /usr/bin ${HOME} sed echo ${HOME} x=1
+	local export echo 'quoted text' x=1 x=1 done
+	/usr/bin printf x=1 echo -eu grep "$1" "$@" 'quoted text' && $(pwd) /usr/bin
+	sed x=1 printf export x=1 "$@" --verbose sed printf "$1" cd grep
+		awk grep local readonly echo done && local sed --verbose | cd cd cd "$1" done
+		echo | && done then grep local export printf done grep x=1 $(pwd) test | /usr/bin
+		cd sed | && echo local then ${HOME} | && ${HOME} /usr/bin test echo 'quoted text'
+	sed x=1 /usr/bin ${HOME} -eu "$@" echo | "$1" -eu grep awk local
+	printf 2>/dev/null 'quoted text' cd
+	x=1 --verbose sed test grep printf
+readonly sed 2>/dev/null /usr/bin
+awk grep 'quoted text'
+	"$1" --verbose local 'quoted text' done printf && cd local grep $(pwd) ${HOME}
+	"$1" cd sed printf test --verbose then then local
+	sed done x=1 export grep /usr/bin cd export 2>/dev/null
+	local sed printf then ${HOME} test printf 2>/dev/null --verbose x=1 echo 2>/dev/null
+		grep x=1 x=1 2>/dev/null /usr/bin grep -eu then test readonly export
+		-eu ${HOME} sed grep -eu $(pwd) $(pwd) cd "$@" -eu test cd cd local
+readonly "$@" echo grep ${HOME}
+	&& export $(pwd) local 'quoted text' | echo awk | then --verbose
+	2>/dev/null local echo --verbose /usr/bin echo && echo readonly
+		then awk sed --verbose grep echo printf cd sed
+&& 'quoted text' x=1 test echo && test
+	--verbose ${HOME} local grep ${HOME}
+$(pwd) "$1" readonly
+		test && $(pwd) then local /usr/bin test done 2>/dev/null
+	readonly then ${HOME} $(pwd) 'quoted text' local echo /usr/bin | printf cd && echo
+		sed export export "$@"
+$(pwd) readonly ${HOME} cd done x=1 -eu | echo
+		grep /usr/bin "$1" cd "$@" && cd x=1 x=1 readonly && printf | cd /usr/bin
+		cd | --verbose echo ${HOME} local test "$1"
+	| printf local "$@" $(pwd) ${HOME} done x=1 echo local 2>/dev/null ${HOME}
+cd done 'quoted text' $(pwd) x=1
+	&& awk 'quoted text' "$@" cd | "$1" readonly
+-eu test /usr/bin cd grep local awk
+		printf --verbose echo test "$1" --verbose
+printf $(pwd) x=1 readonly echo then printf --verbose awk readonly done
+	${HOME} -eu local /usr/bin
+		&& -eu test | awk sed local readonly grep then done /usr/bin -eu "$@" done
+2>/dev/null "$1" grep "$1" --verbose readonly local | $(pwd) | $(pwd)
+		-eu "$1" sed $(pwd) echo cd sed then local test readonly
+$(pwd) done printf 'quoted text' "$@" | -eu export awk
+		x=1 2>/dev/null sed "$1" test --verbose 2>/dev/null export
+	'quoted text' | test | awk --verbose
+		then ${HOME} grep readonly /usr/bin readonly
+	done export 'quoted text'
+		done "$@" test then then -eu "$@" local x=1 --verbose x=1 then awk done cd ${HOME}
+readonly | test done && -eu | sed -eu local /usr/bin local sed cd readonly
+2>/dev/null awk 2>/dev/null /usr/bin
+test printf echo sed "$1" "$1" -eu grep -eu 'quoted text'
+readonly readonly -eu local printf ${HOME} /usr/bin -eu | ${HOME} cd "$1" | local
+	done && && 'quoted text' | printf && test "$@"
+"$@" done printf x=1 'quoted text' $(pwd) ${HOME} 2>/dev/null $(pwd) awk 2>/dev/null
+	--verbose then 'quoted text' "$1" && cd $(pwd) $(pwd)
+	x=1 | $(pwd) 'quoted text'
+	&& echo awk readonly | grep /usr/bin
+'quoted text' /usr/bin && | 2>/dev/null
+	printf cd --verbose awk done x=1 then -eu then "$1" test
+export -eu echo sed echo "$1" ${HOME} 'quoted text' &&
+awk done done done "$1" grep "$@" echo cd -eu --verbose grep printf -eu export
+		export --verbose cd ${HOME} "$@" ${HOME}
+		sed 2>/dev/null ${HOME} awk then /usr/bin
+local 2>/dev/null grep echo echo 'quoted text'
+		x=1 "$1" done x=1 sed && $(pwd) "$@" cd
+		local 2>/dev/null /usr/bin "$@" echo local
+	grep "$@" sed local 'quoted text'
+	'quoted text' readonly $(pwd) "$1" | | printf /usr/bin export
+	sed sed grep cd | printf /usr/bin 2>/dev/null readonly "$@" cd
+		done sed grep $(pwd) 'quoted text'
+	'quoted text' --verbose grep --verbose printf
+		export x=1 echo cd cd --verbose 'quoted text'
+awk x=1 readonly readonly && | done && awk && readonly echo
+| echo ${HOME} local echo cd --verbose
+		&& "$1" done sed export sed 2>/dev/null done
+	readonly done --verbose 2>/dev/null printf readonly printf "$@" | "$1"
+$(pwd) awk && ${HOME} 2>/dev/null cd done export x=1 --verbose | then
+2>/dev/null --verbose awk "$@" ${HOME} readonly
+	then echo && 'quoted text' x=1 printf ${HOME} test --verbose then
+2>/dev/null printf local
+		readonly && then sed readonly then done -eu /usr/bin awk test "$1" cd printf
+		2>/dev/null done sed printf x=1 -eu test done readonly && cd grep grep
+| x=1 cd export echo grep ${HOME} awk local &&
+"$@" "$@" ${HOME} cd && then "$@" 2>/dev/null
+		readonly "$@" readonly export 'quoted text' /usr/bin cd
+	| awk /usr/bin 2>/dev/null /usr/bin awk ${HOME} /usr/bin readonly test done
+	done $(pwd) x=1 done done 2>/dev/null "$1" ${HOME} done 'quoted text'
+local done echo sed && done "$1" x=1 cd ${HOME} "$1" then --verbose $(pwd) sed
+	done done local 2>/dev/null printf 'quoted text' /usr/bin --verbose echo
+		--verbose /usr/bin done 'quoted text' |
+	awk --verbose 'quoted text' --verbose $(pwd) "$1"
+${HOME} echo printf test 'quoted text' /usr/bin export done
+	test test --verbose echo 2>/dev/null | grep /usr/bin
+		echo test cd "$@" readonly
+		&& awk readonly /usr/bin
+		"$@" --verbose export then $(pwd) sed 2>/dev/null
+		&& sed cd cd x=1 local $(pwd) "$1" 'quoted text'
+done local -eu grep "$1" printf awk x=1 test echo echo then awk echo $(pwd)
+	sed ${HOME} echo /usr/bin --verbose local readonly $(pwd) done sed export local
+	&& /usr/bin grep 'quoted text' ${HOME}
+grep readonly $(pwd) sed cd /usr/bin awk awk test test 'quoted text'
+	"$1" && | x=1 --verbose 2>/dev/null echo sed $(pwd) echo grep "$@" test 'quoted text'
+done -eu cd /usr/bin "$@" -eu x=1 readonly grep /usr/bin cd echo 2>/dev/null
+		| "$@" sed readonly 2>/dev/null local cd printf echo "$@" --verbose
+	done echo /usr/bin echo printf grep ${HOME} printf done
+	test cd x=1 && | cd 'quoted text'
+then test x=1 2>/dev/null local -eu grep 2>/dev/null
+&& grep ${HOME} grep cd /usr/bin readonly "$1" x=1 then
+		x=1 then local export sed
+		printf sed "$@" then --verbose local
+	"$@" 2>/dev/null export then
+		cd | x=1 "$1" echo sed 2>/dev/null readonly ${HOME} echo
+	$(pwd) local ${HOME} --verbose echo
+"$@" 2>/dev/null readonly sed 2>/dev/null test
+		readonly cd "$1" x=1 "$1" --verbose 2>/dev/null
+	readonly then $(pwd) cd | /usr/bin test done 2>/dev/null
+		&& test -eu export echo local sed sed export /usr/bin
+	"$@" $(pwd) && 2>/dev/null sed && then sed 'quoted text' 'quoted text'
+	'quoted text' $(pwd) readonly test "$1" && cd export -eu readonly
+	-eu | test x=1 'quoted text'
+		/usr/bin then cd x=1 printf sed printf
+		printf test /usr/bin && | echo x=1 awk sed done export $(pwd) export sed cd
+	cd test sed "$@" --verbose ${HOME} echo test echo done
+		awk && then && local /usr/bin 'quoted text'
+		-eu x=1 printf grep $(pwd) test --verbose
+| then -eu 2>/dev/null "$1" printf x=1 2>/dev/null -eu readonly sed
+		"$@" grep x=1 /usr/bin echo "$1" "$1"
+		export sed export sed then echo ${HOME} | local
+	/usr/bin grep -eu cd cd grep "$@" readonly cd | readonly readonly
+		--verbose 'quoted text' awk | awk "$1" "$1" export sed sed "$1" test
+	awk $(pwd) grep "$1" awk x=1 cd local $(pwd) sed && printf readonly local
+	x=1 'quoted text' sed export done local 2>/dev/null 2>/dev/null $(pwd) |
+		&& "$@" done && /usr/bin echo done export
+--verbose echo -eu 2>/dev/null -eu /usr/bin x=1 x=1 local && echo
+	| local awk local awk "$@" /usr/bin echo awk | ${HOME} export
+cd | sed cd export ${HOME}
+		"$1" x=1 echo "$@" awk ${HOME} sed printf grep x=1 'quoted text' export then
+| 2>/dev/null --verbose local 2>/dev/null awk test local export echo cd "$@"
+	export readonly /usr/bin ${HOME}
+	test 2>/dev/null | x=1 'quoted text' 2>/dev/null done "$1" --verbose
+		export | grep -eu sed export -eu "$1" && 2>/dev/null then | test -eu export
+	'quoted text' echo readonly
+"$1" | done readonly 2>/dev/null
+		test | ${HOME} /usr/bin "$@" $(pwd) | | 2>/dev/null
+		${HOME} ${HOME} "$@"
+	export "$1" echo --verbose x=1 "$1" local 2>/dev/null
+	"$1" -eu sed printf printf "$1" printf
+"$@" --verbose 2>/dev/null echo -eu ${HOME} export --verbose 2>/dev/null
+		export x=1 export 'quoted text' export "$@" /usr/bin cd readonly
+printf "$@" sed printf $(pwd) x=1 done local
+	| /usr/bin grep "$@"
+	| export local echo $(pwd) export
+test | --verbose readonly done sed echo printf printf x=1 2>/dev/null
+		grep 'quoted text' --verbose 2>/dev/null | ${HOME} local readonly $(pwd) 'quoted text'
+export test then export | sed /usr/bin 2>/dev/null readonly done awk
+	awk 2>/dev/null ${HOME} -eu then "$1" test
+	export then "$1" 2>/dev/null cd 2>/dev/null x=1 "$1" awk readonly x=1
+printf test ${HOME} 2>/dev/null done | 2>/dev/null grep test
+	/usr/bin sed /usr/bin cd | --verbose then && export && "$@" cd | echo awk ${HOME}
+	local then readonly /usr/bin cd local "$@" 'quoted text'
+done grep "$1" "$@" local "$@" "$@" 2>/dev/null 'quoted text'
+		'quoted text' | grep 2>/dev/null $(pwd) awk
+	awk 2>/dev/null grep | sed -eu readonly export $(pwd) echo cd ${HOME}
+| 2>/dev/null cd awk --verbose 'quoted text' sed
+test -eu cd grep export then done -eu -eu grep cd 'quoted text' local /usr/bin
+/usr/bin x=1 x=1 echo ${HOME} /usr/bin grep grep /usr/bin readonly grep grep echo
+then grep "$1" --verbose 'quoted text' 'quoted text' $(pwd) sed "$@" 2>/dev/null
+	x=1 "$@" printf readonly && /usr/bin --verbose ${HOME} export -eu | sed
+	${HOME} 2>/dev/null readonly | grep awk export awk $(pwd) sed
+	export 2>/dev/null test sed
+echo 'quoted text' local readonly && --verbose
+--verbose -eu sed | --verbose "$@" x=1 test then "$@" printf
+	readonly "$1" "$1" x=1 done "$@" then readonly echo ${HOME} awk "$1" printf printf
+	grep local 2>/dev/null $(pwd) cd /usr/bin cd /usr/bin "$@" export 2>/dev/null
+	then /usr/bin $(pwd) "$@" awk "$@" printf /usr/bin done 2>/dev/null
+	then 'quoted text' readonly "$1" /usr/bin printf && $(pwd)
+${HOME} /usr/bin && cd
+$(pwd) echo sed "$1" -eu -eu "$1" export local x=1 $(pwd) "$@" x=1
+		local x=1 test then printf then awk readonly $(pwd) export export sed awk local
+	awk -eu | local grep export 2>/dev/null
+/usr/bin printf "$1" grep ${HOME} echo /usr/bin local test export printf printf
+test export readonly test $(pwd)
+	printf export && readonly
+	readonly ${HOME} "$@" "$@" done then printf then /usr/bin readonly export
+	cd -eu cd 'quoted text' test export "$@" export
+		done "$@" 2>/dev/null ${HOME} awk local ${HOME} sed --verbose "$1" "$@"
+	test awk grep then && --verbose export awk -eu /usr/bin test "$@" awk test
+	${HOME} export "$1" ${HOME} local x=1 --verbose 2>/dev/null --verbose awk 2>/dev/null
+	sed sed cd -eu grep readonly echo --verbose grep readonly grep && | && /usr/bin
+		test | && x=1 local 'quoted text' awk echo cd export /usr/bin
+		export echo readonly /usr/bin
+	/usr/bin sed grep awk | -eu && -eu /usr/bin sed x=1 2>/dev/null
+local then grep sed /usr/bin "$@" readonly awk printf --verbose
+cd grep /usr/bin done then test && 'quoted text' | test
+	cd printf --verbose ${HOME} test 'quoted text' local
+awk $(pwd) done test printf "$@" --verbose 2>/dev/null && "$1" test
+		awk x=1 sed echo "$@" ${HOME} && 'quoted text' cd export echo 2>/dev/null readonly
+		--verbose | 'quoted text' /usr/bin done /usr/bin echo
+"$1" "$@" grep x=1 -eu
+	${HOME} "$1" test "$1" 'quoted text' "$@" "$@" export awk test
+		printf readonly --verbose then "$1" ${HOME}
+		$(pwd) sed $(pwd) cd printf "$1" --verbose
+	/usr/bin cd 'quoted text' printf
+	then 'quoted text' cd printf
+	done 2>/dev/null echo | "$1" "$1" /usr/bin && $(pwd) awk grep cd test ${HOME} done
+	test grep $(pwd) sed --verbose readonly
+	cd printf "$1" $(pwd) "$1" -eu then echo && --verbose then readonly awk
+		local | awk -eu cd local x=1 printf
+-eu "$1" echo local && awk cd ${HOME} -eu /usr/bin "$1" /usr/bin
+	readonly printf readonly then then done printf
+	done "$1" test printf /usr/bin 2>/dev/null done x=1 -eu ${HOME}
+		test "$1" -eu printf x=1 /usr/bin then x=1 echo /usr/bin local echo "$@" grep
+	&& 2>/dev/null -eu awk &&
+"$1" local cd | done echo grep x=1 $(pwd) sed --verbose -eu then
+	"$1" ${HOME} $(pwd) sed "$@" sed export 2>/dev/null $(pwd) local grep
+		&& --verbose /usr/bin x=1 --verbose
+	test printf echo printf local then x=1 echo sed ${HOME} && /usr/bin
+	grep cd readonly then
+	printf done local && "$@" x=1 sed "$@" cd
+		/usr/bin 2>/dev/null 2>/dev/null local $(pwd) readonly
+	$(pwd) grep local --verbose && --verbose && grep done $(pwd) echo echo -eu -eu
+	${HOME} test "$@" grep && "$1" "$1" echo export
+grep x=1 $(pwd) test 'quoted text' readonly |
+	sed $(pwd) "$@" local cd readonly local grep /usr/bin test
+	printf -eu /usr/bin sed -eu readonly echo cd $(pwd) && export --verbose ${HOME}
+		sed test then 'quoted text' grep export readonly cd 2>/dev/null
+--verbose 2>/dev/null 'quoted text'
+		&& | x=1 2>/dev/null 'quoted text' $(pwd) local 2>/dev/null
+	"$@" local 'quoted text' export readonly
+		export awk test awk && printf printf --verbose
+'quoted text' grep then -eu then ${HOME}
+	/usr/bin ${HOME} echo grep "$1" export cd printf
+		--verbose x=1 $(pwd) | cd sed --verbose awk $(pwd) grep readonly 2>/dev/null
+--verbose echo && local --verbose ${HOME} | x=1 local
+-eu then -eu 'quoted text'
+	grep 2>/dev/null /usr/bin export 2>/dev/null
+x=1 printf | x=1 "$@" $(pwd) readonly readonly "$@" local echo x=1 "$1" "$@"
+| $(pwd) /usr/bin readonly
+		test "$@" cd $(pwd) then
+then readonly cd awk && export echo grep grep then printf echo printf export
+readonly export export $(pwd) 'quoted text'
+		$(pwd) then "$@" x=1 printf "$@" --verbose
+	readonly | ${HOME} grep 2>/dev/null ${HOME}
+		/usr/bin | 'quoted text' "$@" test
+printf readonly done sed
+done then "$1" /usr/bin sed && "$@" cd awk $(pwd) 2>/dev/null
+--verbose -eu | grep -eu done echo test test 'quoted text' done readonly test ${HOME}
+	echo then local test /usr/bin
+local test x=1 printf grep "$1"
+	-eu sed "$@" then printf then 'quoted text' cd
+	x=1 then echo /usr/bin --verbose ${HOME} awk "$@" x=1 awk then then
+		| sed 2>/dev/null $(pwd) awk printf 2>/dev/null printf grep awk && 2>/dev/null
+		"$@" sed cd sed "$1" "$1" | $(pwd) 'quoted text'
+		printf -eu --verbose -eu
+	/usr/bin | /usr/bin export 'quoted text' 2>/dev/null | test
+	awk ${HOME} 'quoted text' export 'quoted text'
+	sed awk test printf --verbose && "$@" done ${HOME} && ${HOME}
+	$(pwd) /usr/bin printf test "$1" "$1" grep --verbose echo then $(pwd) /usr/bin
+	cd printf ${HOME} 2>/dev/null grep x=1 $(pwd) awk "$1" | "$@" 2>/dev/null awk
+	awk 2>/dev/null "$1" awk x=1 'quoted text' test
+	--verbose then then done
+		cd $(pwd) x=1 'quoted text' && ${HOME} local echo "$@" awk
+		$(pwd) | printf done cd
+		/usr/bin echo readonly export && | && "$1" /usr/bin then echo "$1" $(pwd)
+	"$@" done local then then grep grep
+	"$@" x=1 2>/dev/null grep | awk readonly && printf echo 2>/dev/null
+echo --verbose $(pwd) test awk
+		x=1 x=1 | "$@" awk grep 2>/dev/null awk
+printf $(pwd) export "$1" && -eu $(pwd) /usr/bin 2>/dev/null "$1" printf
+		2>/dev/null "$@" echo | test ${HOME} ${HOME} ${HOME} export readonly export
+--verbose local grep && awk $(pwd) test readonly test
+		awk && readonly -eu cd -eu then --verbose /usr/bin printf
+	"$@" grep && x=1 grep "$1" && "$@" "$@" "$@" test awk readonly 'quoted text'
+test x=1 printf $(pwd) awk local x=1 printf then local echo then
+		-eu local "$1" -eu then cd /usr/bin test | echo readonly $(pwd) grep done
+	${HOME} -eu cd sed x=1 readonly -eu "$@"
+awk echo x=1 "$1" awk --verbose
+${HOME} then done "$1" 'quoted text' "$@" x=1 cd | x=1 ${HOME} done $(pwd)
+	grep -eu | 2>/dev/null sed x=1 $(pwd) | awk awk export
+		printf $(pwd) sed local -eu && done -eu /usr/bin /usr/bin then awk "$@" 'quoted text'
+	cd && sed && $(pwd) x=1 grep x=1 echo echo export $(pwd) 'quoted text'
+&& awk ${HOME} "$@" test local local 'quoted text'
+		"$@" cd local awk ${HOME} "$@" /usr/bin 'quoted text' export /usr/bin
+	readonly "$1" sed "$@" test x=1 cd | --verbose
+	grep $(pwd) --verbose --verbose 2>/dev/null readonly
+	done -eu /usr/bin -eu "$@" $(pwd) $(pwd)
+grep done 2>/dev/null "$1" -eu x=1 readonly
+echo local awk awk --verbose && readonly echo 'quoted text'
+	readonly x=1 test 'quoted text' test $(pwd) cd export 2>/dev/null | local 'quoted text'
+readonly ${HOME} /usr/bin --verbose "$@" awk
+	export "$1" /usr/bin echo 2>/dev/null
+	| cd export grep then 'quoted text' then test | "$@" --verbose
+	readonly x=1 "$@" x=1 && test echo ${HOME} readonly && test
+		done echo grep 2>/dev/null -eu 2>/dev/null cd cd 2>/dev/null
+	2>/dev/null test x=1 -eu sed 'quoted text' readonly
+		--verbose --verbose then local "$1" sed x=1 local export readonly 2>/dev/null
+		awk && && then readonly local | --verbose $(pwd) readonly export
+$(pwd) printf cd -eu grep echo /usr/bin test --verbose
+	-eu 'quoted text' /usr/bin printf x=1 | 'quoted text' sed 'quoted text'
+	&& | ${HOME} test test x=1 "$1" --verbose
+/usr/bin ${HOME} printf then grep then awk readonly then /usr/bin
+		cd readonly awk /usr/bin ${HOME} && export awk x=1
+sed 2>/dev/null $(pwd) cd then echo awk
+"$1" printf "$@" readonly awk | export | echo "$@" "$@" printf sed 2>/dev/null
+		grep | export local ${HOME} done
+		sed cd 'quoted text' ${HOME} echo
+		2>/dev/null then readonly echo done $(pwd) export awk "$@"
+"$1" cd $(pwd) grep --verbose cd | "$1" echo x=1 then done 'quoted text'
+	local cd "$1" sed sed "$@" echo sed 'quoted text' ${HOME} ${HOME} --verbose
+	--verbose | /usr/bin "$1"
+${HOME} --verbose test awk 'quoted text'
+	-eu && "$@" x=1 'quoted text' "$@" printf readonly | | x=1 done 'quoted text'
+grep $(pwd) export export echo /usr/bin readonly done
+		"$1" grep then done local test 2>/dev/null cd 'quoted text' readonly "$1" x=1
+2>/dev/null local "$1" "$@"
+	grep printf /usr/bin test 'quoted text' -eu cd "$@"
+	-eu ${HOME} 'quoted text' $(pwd)
+		sed grep test printf cd "$@" && -eu "$1"
+		'quoted text' "$@" /usr/bin cd -eu
+	-eu ${HOME} cd 2>/dev/null ${HOME} "$@" | | --verbose "$@" -eu
+printf && /usr/bin -eu local readonly ${HOME} local
+		/usr/bin grep echo printf awk done readonly
+		${HOME} then "$@" && -eu $(pwd) cd cd done && -eu printf | done readonly
+'quoted text' export x=1 $(pwd)
+"$1" sed cd && sed export
+		awk && sed then test "$@" readonly grep printf grep 2>/dev/null 2>/dev/null
+		local -eu $(pwd) then sed
+	sed /usr/bin ${HOME} printf ${HOME} "$1" 'quoted text' "$1" test --verbose
+	$(pwd) grep 2>/dev/null --verbose
+then 2>/dev/null test awk done readonly --verbose
+	$(pwd) echo printf /usr/bin "$@" "$1" $(pwd) | cd ${HOME} export 2>/dev/null
+	readonly export then grep cd export
+		/usr/bin "$1" /usr/bin awk then done readonly ${HOME} "$1" ${HOME} sed sed export
+	test ${HOME} && then | then awk -eu ${HOME} --verbose grep && "$@" /usr/bin
+		cd awk cd then local
+"$1" done 2>/dev/null done printf "$@"
+	"$@" x=1 sed export "$@" 'quoted text' export x=1 "$@" --verbose awk
+		grep "$1" && 'quoted text'
+${HOME} then printf --verbose && && readonly 'quoted text' printf /usr/bin
+"$1" $(pwd) -eu grep -eu readonly then | test
+		export 2>/dev/null export && /usr/bin /usr/bin 2>/dev/null $(pwd) --verbose
+		$(pwd) local --verbose
+	&& test $(pwd) -eu awk 'quoted text' awk export
+		awk printf test done /usr/bin
+		"$1" local 2>/dev/null local | sed test awk
+	"$1" grep 2>/dev/null done x=1 "$@" 2>/dev/null done -eu done 2>/dev/null /usr/bin
+	-eu -eu test test export done 2>/dev/null cd sed cd "$@" && grep 2>/dev/null $(pwd)
+	sed 2>/dev/null x=1 local 2>/dev/null test x=1 'quoted text'
+		'quoted text' sed /usr/bin | printf | 2>/dev/null $(pwd) -eu echo export && | --verbose
+"$1" && local then sed x=1 export then 2>/dev/null $(pwd) "$@" local
+grep 2>/dev/null then ${HOME} local
+readonly export | readonly cd -eu cd export ${HOME}
+		done "$@" $(pwd) 2>/dev/null export local -eu
+		${HOME} printf awk grep printf /usr/bin then
+sed local ${HOME} export && "$1" printf echo then awk
+	--verbose grep then sed 2>/dev/null readonly
+echo -eu export awk test | cd printf
+cd "$1" x=1 test | done --verbose /usr/bin 'quoted text' test awk
+		then && printf done $(pwd) -eu readonly
+printf 'quoted text' $(pwd) grep x=1 sed readonly export ${HOME} -eu sed 2>/dev/null
+	'quoted text' done "$1" -eu then
+		$(pwd) | x=1 printf local local -eu
+	-eu -eu --verbose && 'quoted text'
+		readonly --verbose local 'quoted text'
+	$(pwd) /usr/bin -eu 'quoted text' --verbose /usr/bin cd x=1 then cd ${HOME} awk
+	cd cd test /usr/bin "$1" test "$@" | "$@" x=1 /usr/bin $(pwd) export -eu
+		2>/dev/null sed then x=1 && done sed test -eu x=1 "$@" readonly
+		--verbose /usr/bin && export
+then && | echo readonly --verbose
+	cd sed done grep local x=1 -eu ${HOME}
+	$(pwd) /usr/bin 2>/dev/null echo awk 2>/dev/null export local | --verbose
+	2>/dev/null echo /usr/bin done local cd x=1 "$@"
+	2>/dev/null | export echo $(pwd) cd then test
+		done done --verbose -eu 2>/dev/null "$1" 2>/dev/null
+echo "$@" test ${HOME} readonly 2>/dev/null
+		done local | export -eu ${HOME} "$1"
+${HOME} /usr/bin test cd "$1" 'quoted text' $(pwd) echo $(pwd) grep test grep
+awk -eu readonly "$1" 'quoted text'
+		test ${HOME} awk echo readonly --verbose done
+then cd readonly done local cd "$@" echo $(pwd)
+	local echo grep sed "$1" printf echo ${HOME}
+local readonly local echo | test local -eu | &&
+	test cd -eu awk export echo awk "$1" 'quoted text' 'quoted text'
+		--verbose $(pwd) done local readonly readonly $(pwd) sed | -eu then test
+		cd local local echo test then 'quoted text' --verbose
+		'quoted text' 2>/dev/null echo /usr/bin done x=1 $(pwd) --verbose printf
+| | printf "$1" export echo /usr/bin local then 2>/dev/null cd
+		"$1" export echo test "$1" grep ${HOME} --verbose local
+	x=1 --verbose | awk test sed /usr/bin x=1 then awk $(pwd) $(pwd) readonly
+awk done | /usr/bin done 'quoted text' --verbose
+| echo cd "$1" readonly ${HOME} test $(pwd) "$1" x=1 grep cd 2>/dev/null
+	/usr/bin awk && test awk 'quoted text' export | test
+		"$1" cd then then && --verbose then local echo awk echo then &&
+grep -eu $(pwd) -eu /usr/bin ${HOME}
+		then export | "$1" 2>/dev/null 'quoted text' ${HOME} export
+cd x=1 grep ${HOME} cd awk | grep awk
+	then "$@" printf printf --verbose
+	readonly 'quoted text' | cd | --verbose
+	| awk echo sed awk && | done $(pwd) | export readonly awk | /usr/bin
+	/usr/bin ${HOME} "$@" grep &&
+--verbose done printf then $(pwd) /usr/bin local grep
+		${HOME} -eu "$@" && $(pwd)
+	then sed done then 2>/dev/null printf printf printf printf
+		readonly echo export --verbose done grep echo readonly then
+		export sed cd /usr/bin printf export export
+	done grep $(pwd) grep cd $(pwd) export $(pwd) local 2>/dev/null 'quoted text'
+export "$@" cd 2>/dev/null
+		local test awk "$@" grep
+		cd done done /usr/bin /usr/bin
+		readonly /usr/bin 'quoted text' /usr/bin /usr/bin 'quoted text'
+${HOME} && "$1" done printf cd && | readonly cd done 2>/dev/null
+&& x=1 awk test "$@" 2>/dev/null
+	--verbose done ${HOME} "$@" ${HOME}
+export x=1 test readonly $(pwd) | sed
+	2>/dev/null awk cd && export echo grep
+	test /usr/bin test "$1" done
+	2>/dev/null local ${HOME} test awk "$@" x=1 test && echo
+'quoted text' then 'quoted text' -eu "$1" echo 2>/dev/null readonly x=1 grep
+	${HOME} x=1 | $(pwd) cd ${HOME}
+		x=1 -eu 'quoted text' awk x=1 $(pwd) /usr/bin then "$1" &&
+	awk $(pwd) then "$@" x=1 echo
+done awk echo grep /usr/bin local "$1" local
+		--verbose 2>/dev/null x=1 | --verbose
+	awk printf done grep
+	then | export then x=1 x=1 --verbose
+	test x=1 "$@" 'quoted text' ${HOME} "$@"
+cd 2>/dev/null --verbose sed 2>/dev/null sed /usr/bin readonly "$@" export
+		-eu printf test cd cd "$1" cd $(pwd) --verbose done x=1
+	'quoted text' x=1 "$1" $(pwd) local cd done readonly /usr/bin echo grep
+	&& cd echo grep then --verbose && done sed export && "$@" readonly 2>/dev/null
+	sed awk export --verbose grep
+		2>/dev/null done then done | readonly
+-eu local $(pwd) 2>/dev/null 2>/dev/null cd --verbose
+'quoted text' cd /usr/bin --verbose local echo done local ${HOME} ${HOME} printf
+--verbose readonly -eu | --verbose -eu grep /usr/bin awk ${HOME}
+		/usr/bin x=1 "$1" export grep local -eu | /usr/bin /usr/bin
+	-eu --verbose printf && 2>/dev/null
+	local 2>/dev/null test "$@" && done && printf &&
+	'quoted text' -eu --verbose "$@" --verbose
+		readonly export && "$@" readonly &&
+		2>/dev/null "$1" then --verbose
+	then $(pwd) printf test awk && -eu /usr/bin "$1" readonly $(pwd)
+export --verbose -eu x=1 $(pwd) "$@" cd 'quoted text'
+		$(pwd) | && printf && "$@" -eu x=1
+		printf "$@" echo | readonly /usr/bin -eu | cd done -eu test grep
+	printf $(pwd) --verbose sed sed | printf local sed ${HOME}
+sed 2>/dev/null export sed -eu
+	2>/dev/null done test
+$(pwd) then grep printf "$1" printf cd export "$@" -eu | ${HOME}
+		awk readonly "$@" && readonly "$1" /usr/bin printf | test done test done
+cd grep local local $(pwd) /usr/bin awk then "$@" sed readonly
+echo sed echo /usr/bin $(pwd) | -eu --verbose x=1 awk readonly then
+	2>/dev/null done done "$@" sed 2>/dev/null readonly 'quoted text' cd sed sed local
+/usr/bin grep sed "$1" 'quoted text' --verbose local cd
+		${HOME} readonly done "$@" cd "$1" 'quoted text' cd cd grep test
+	grep -eu export printf export -eu && echo 'quoted text' /usr/bin
+$(pwd) 'quoted text' local |
+	"$1" awk printf | 'quoted text' readonly local "$1"
+	cd cd test && 'quoted text' $(pwd) "$1"
+	awk printf cd /usr/bin then cd then done grep test "$1" | "$1" -eu 2>/dev/null
+awk ${HOME} /usr/bin x=1 done "$1"
+		--verbose | $(pwd) test ${HOME}
+"$1" 'quoted text' printf "$@" ${HOME}
+cd then test local done && ${HOME}
+--verbose $(pwd) 2>/dev/null | --verbose
+	done $(pwd) | export 2>/dev/null readonly grep printf |
+		sed "$@" /usr/bin $(pwd) $(pwd) ${HOME} awk --verbose
+		2>/dev/null done sed $(pwd) $(pwd) && 'quoted text' printf
+		/usr/bin readonly then 2>/dev/null echo
+		awk -eu cd && sed cd $(pwd) export ${HOME} sed export grep | test local ${HOME}
+echo sed 2>/dev/null $(pwd) 'quoted text'
+		readonly | done 'quoted text' "$@" cd x=1 'quoted text'
+2>/dev/null && local -eu done grep $(pwd)
+x=1 then test export printf cd readonly /usr/bin 2>/dev/null "$1" | $(pwd)
+	printf $(pwd) $(pwd) 'quoted text' 'quoted text'
+	| echo && readonly && grep cd export grep export /usr/bin
+		2>/dev/null sed --verbose 2>/dev/null
+		"$@" then then local done x=1 grep "$1" /usr/bin $(pwd) grep
+"$@" -eu "$@" --verbose grep export && $(pwd) test /usr/bin echo sed && readonly
+		local 2>/dev/null then cd grep printf sed readonly echo $(pwd) x=1 x=1 then
+readonly export --verbose && export
+| test echo x=1 sed export printf
+-eu local 2>/dev/null echo printf /usr/bin
+&& --verbose echo /usr/bin
+		then "$@" cd -eu local x=1 --verbose grep printf
+export cd export sed --verbose test grep /usr/bin grep printf x=1 x=1
+	local sed 'quoted text' 2>/dev/null && then export grep &&
+	local && test sed sed test test export sed awk $(pwd) cd 'quoted text' cd
+	export x=1 grep test local $(pwd) sed "$@"
+&& "$1" sed $(pwd) readonly sed "$1" "$@" readonly --verbose printf "$@"
+		2>/dev/null | "$1" 'quoted text' grep "$@" test --verbose
+	grep "$1" sed /usr/bin awk printf awk --verbose x=1 --verbose | readonly /usr/bin
+	$(pwd) local test sed 2>/dev/null ${HOME} --verbose echo /usr/bin
+	"$1" echo cd | ${HOME} $(pwd) -eu "$@" awk 'quoted text'
+		'quoted text' ${HOME} readonly "$@" then cd echo --verbose
+	x=1 local then cd "$@" test echo 'quoted text'
+	${HOME} cd export echo ${HOME} sed sed printf -eu x=1 local
+$(pwd) local printf && echo "$1" $(pwd) -eu local ${HOME} local readonly
+		local | $(pwd) "$@" cd x=1 echo readonly
+		local done /usr/bin $(pwd) /usr/bin awk 2>/dev/null 2>/dev/null
+	done -eu -eu /usr/bin -eu export 2>/dev/null
+		/usr/bin then | && --verbose "$1"
+export | /usr/bin 2>/dev/null printf done -eu done then $(pwd) | local "$1" sed
+		'quoted text' sed ${HOME}
+	sed "$1" 'quoted text' 2>/dev/null "$1" cd grep
+		${HOME} then "$1" export printf awk done echo cd
+		${HOME} "$1" cd "$@" awk "$1" $(pwd) --verbose ${HOME} 2>/dev/null sed test
+		"$1" local "$@" awk grep -eu $(pwd) local
+awk x=1 awk && x=1 --verbose then && "$@" -eu "$@"
+		${HOME} x=1 echo done grep x=1 test readonly 'quoted text' done grep grep
+	then awk cd $(pwd) readonly echo 'quoted text'
+	then -eu -eu --verbose --verbose sed test x=1 sed /usr/bin readonly
+	x=1 && export local test local grep | grep --verbose && printf 'quoted text' test
+	echo 2>/dev/null x=1 export /usr/bin $(pwd) /usr/bin echo
+	then readonly export grep 2>/dev/null awk local awk $(pwd) x=1 export then
+&& 'quoted text' "$1" /usr/bin 'quoted text' printf | 2>/dev/null
+sed $(pwd) -eu echo done | done && $(pwd) local
+		then local awk ${HOME} echo ${HOME} && local 'quoted text' x=1 grep
+		"$1" && | ${HOME} local awk $(pwd) done | x=1 then
+	echo x=1 'quoted text' then
+	sed -eu 'quoted text' 'quoted text'
+		${HOME} awk test echo readonly $(pwd)
+&& 2>/dev/null -eu then readonly | sed
+--verbose grep /usr/bin then cd sed $(pwd) export --verbose ${HOME}
+local | $(pwd) sed $(pwd) then then awk readonly cd local --verbose | readonly
+	/usr/bin x=1 && echo then echo -eu -eu "$@" done -eu && ${HOME}
+	| readonly | | && $(pwd) printf x=1 --verbose test test $(pwd)
+		'quoted text' 2>/dev/null test -eu /usr/bin /usr/bin awk
+		echo then printf then readonly && --verbose 'quoted text' then done "$1"
+	sed cd -eu 2>/dev/null sed cd --verbose
+	${HOME} local 2>/dev/null $(pwd) local $(pwd) x=1
+2>/dev/null ${HOME} readonly sed readonly "$1" && 'quoted text'
+		2>/dev/null test export 'quoted text'
+	&& test /usr/bin awk echo printf
+	sed cd && sed then --verbose ${HOME} 2>/dev/null
+local /usr/bin "$@" ${HOME} readonly
+	--verbose && x=1 ${HOME} --verbose test printf done readonly
+		"$@" /usr/bin /usr/bin sed printf && local &&
+		printf | "$1" 2>/dev/null
+done grep 'quoted text' "$@" x=1 readonly
+		| local 2>/dev/null then done then && x=1 then echo sed $(pwd) x=1 | readonly awk
+'quoted text' local ${HOME} cd sed 'quoted text' readonly local sed
+readonly then printf export 'quoted text' cd export then
+	test grep && 'quoted text' grep readonly -eu -eu 2>/dev/null then printf echo
+	test test grep $(pwd) x=1 local 'quoted text' cd ${HOME} grep echo export
+		$(pwd) grep | echo | $(pwd) && readonly && $(pwd) test readonly
+	awk --verbose cd $(pwd) | "$1" sed $(pwd) cd --verbose sed cd sed
+		${HOME} readonly "$1" readonly
+export printf test grep ${HOME} test
+		cd 2>/dev/null 2>/dev/null
+		--verbose done "$@" sed readonly 'quoted text'
+	--verbose -eu local -eu -eu readonly then local
+	sed --verbose echo "$1" | --verbose awk "$1" "$1" $(pwd) done sed 'quoted text'
+		2>/dev/null 2>/dev/null && local export done echo 2>/dev/null
+-eu export ${HOME} ${HOME} $(pwd) && done x=1 echo
+	test then x=1 awk readonly local then local 2>/dev/null x=1 done ${HOME} done grep
+	export $(pwd) export $(pwd) sed test -eu x=1 $(pwd) x=1 export "$@"
+export /usr/bin 'quoted text' cd "$@" 'quoted text' "$1" -eu then awk test
+-eu cd | 2>/dev/null awk --verbose printf echo --verbose awk then export /usr/bin
+		local "$@" local "$1" $(pwd) then -eu echo printf && 2>/dev/null
+	-eu $(pwd) local grep 2>/dev/null "$@" cd x=1 awk
+		"$1" printf && "$@" local local grep then
+$(pwd) $(pwd) -eu -eu x=1 "$1" /usr/bin grep && awk x=1 "$@"
+		awk 2>/dev/null -eu cd 2>/dev/null echo
+local export printf local then export
+'quoted text' && | export readonly -eu local 'quoted text'
+${HOME} /usr/bin printf 'quoted text' ${HOME}
+	-eu $(pwd) "$1" --verbose printf | grep then /usr/bin printf sed /usr/bin
+	echo 2>/dev/null ${HOME} grep ${HOME} test sed sed
+		local 'quoted text' -eu grep && "$1" x=1 test
+		cd 'quoted text' | export done && printf $(pwd) --verbose
+2>/dev/null printf grep ${HOME} test readonly /usr/bin $(pwd) readonly ${HOME}
+$(pwd) grep export grep done test test ${HOME} cd local
+		&& echo "$@" export && -eu readonly
+		${HOME} export awk cd | ${HOME} x=1 readonly cd "$@"
+grep | local sed test x=1 cd /usr/bin grep done printf cd export "$@" echo
+		x=1 "$@" "$@" echo -eu awk --verbose ${HOME}
+printf sed then "$1" "$@" echo "$@"
+		x=1 local | test test sed --verbose then then 2>/dev/null awk local done
+		awk -eu /usr/bin "$1" "$@" && cd readonly local "$@"
+	--verbose grep && 2>/dev/null
+cd sed readonly ${HOME} ${HOME} --verbose
+		grep printf then test | "$1" printf awk "$@" --verbose "$@" "$@" | readonly
+"$1" x=1 cd done /usr/bin "$@" awk local | cd printf
+	awk export "$1" echo printf
+		grep local then grep cd cd -eu test /usr/bin -eu "$1" | && /usr/bin local
+-eu "$@" x=1 grep "$@" test awk -eu "$1" cd --verbose /usr/bin /usr/bin
+/usr/bin done $(pwd) 2>/dev/null | -eu && cd -eu
+		x=1 readonly readonly ${HOME} awk
+		--verbose printf x=1 /usr/bin then done
+		${HOME} grep sed --verbose -eu ${HOME} local cd sed 'quoted text' local printf
+		x=1 done printf local "$1" export readonly
+'quoted text' x=1 printf | /usr/bin "$@" ${HOME} /usr/bin export
+| sed 'quoted text' export
+		x=1 -eu cd done test && done | "$@" | then printf cd x=1
+2>/dev/null echo -eu "$1" "$@" readonly then printf local readonly &&
+test export cd done test local then local
+$(pwd) readonly test awk readonly && && readonly grep local cd "$@" grep readonly
+		test echo | readonly printf | cd cd sed sed /usr/bin 'quoted text'
+		test "$@" awk export cd --verbose x=1
+export cd x=1 $(pwd) export /usr/bin
+	| test "$1" --verbose 2>/dev/null
+		-eu 'quoted text' echo cd ${HOME}
+		readonly grep 'quoted text' echo -eu ${HOME} -eu readonly
+		local local export done ${HOME} printf
+echo /usr/bin readonly grep "$1" 'quoted text'
+	/usr/bin test cd grep export echo echo
+printf "$@" echo readonly grep -eu 'quoted text' grep done readonly
+	&& done then readonly --verbose -eu | then |
+		--verbose grep done echo x=1 && 2>/dev/null
+		grep /usr/bin -eu 'quoted text' x=1 local "$1" echo readonly then echo /usr/bin
+		--verbose $(pwd) -eu | grep --verbose && done "$@" --verbose
+		2>/dev/null ${HOME} export
+--verbose "$1" test echo 'quoted text' "$1" sed printf $(pwd) then readonly
+"$1" printf -eu ${HOME} done |
+'quoted text' printf x=1 test "$1" grep cd export local test 'quoted text' x=1
+	readonly local cd x=1 local done sed /usr/bin | $(pwd) "$@" grep
+${HOME} $(pwd) readonly "$@" then cd awk then sed --verbose
+done | printf 2>/dev/null test echo ${HOME} | echo 2>/dev/null
+		| awk $(pwd) echo grep local x=1 $(pwd)
+x=1 "$1" "$1" test /usr/bin && 2>/dev/null 'quoted text'
+	readonly --verbose x=1 "$@" printf $(pwd) readonly grep sed done /usr/bin 2>/dev/null
+	x=1 ${HOME} /usr/bin readonly printf ${HOME} 'quoted text' then
+--verbose local && | test test
+		${HOME} $(pwd) awk --verbose 2>/dev/null | | "$1" "$1" test
+	local printf printf echo $(pwd) grep export done -eu test $(pwd) sed echo
+	sed "$1" ${HOME} "$1" | /usr/bin $(pwd) "$1" readonly && sed /usr/bin grep grep
+	printf grep readonly then cd -eu ${HOME} && 2>/dev/null /usr/bin
+	/usr/bin x=1 /usr/bin "$@"
+	-eu x=1 2>/dev/null grep awk | done readonly then
+	"$1" local test --verbose | ${HOME} --verbose local
+		echo x=1 -eu x=1 test grep done | -eu local export
+		cd readonly --verbose export awk "$@" --verbose
+	| awk echo ${HOME} then cd x=1
+		then "$@" $(pwd) awk echo x=1 ${HOME}
+		then --verbose cd test --verbose done /usr/bin ${HOME} /usr/bin 2>/dev/null
+	grep -eu local then 2>/dev/null local -eu readonly 'quoted text'
+2>/dev/null && grep -eu export export $(pwd) -eu 2>/dev/null
+		local readonly then --verbose 2>/dev/null "$1" -eu readonly
+		2>/dev/null grep $(pwd) printf
+		"$@" "$@" 'quoted text'
+x=1 "$1" test ${HOME} "$1" done $(pwd) readonly 2>/dev/null
+		'quoted text' -eu 'quoted text' echo ${HOME} readonly then grep 2>/dev/null
+done awk sed "$@" awk 'quoted text'
+	$(pwd) readonly /usr/bin printf --verbose local
+	cd "$1" export --verbose --verbose x=1 /usr/bin
+		printf 2>/dev/null -eu cd "$1" "$@" $(pwd) -eu cd "$@" then | && -eu
+		"$@" test x=1 sed && | && printf && grep done $(pwd)
+	test cd 'quoted text' -eu awk then
+&& awk x=1 echo && local "$1" 'quoted text'
+		"$@" local grep readonly readonly readonly "$1" done
+	then x=1 && grep "$1" | then local x=1 sed done | /usr/bin
+	--verbose test /usr/bin test 'quoted text' | done
+		"$1" "$1" export && cd cd x=1
+	$(pwd) -eu grep awk && -eu echo /usr/bin export
+printf local "$@" echo grep x=1 then "$1"
+grep export then /usr/bin export -eu -eu x=1
+"$@" | $(pwd) 'quoted text'
+	readonly "$1" -eu /usr/bin 2>/dev/null | readonly done "$@"
+		&& "$@" $(pwd) then test && /usr/bin
+/usr/bin 'quoted text' export x=1 then cd 2>/dev/null done cd
+"$@" awk export local printf local then
+	done sed cd grep sed echo --verbose local "$@" "$1" /usr/bin
+readonly && && cd awk sed grep cd printf
+	grep export printf | ${HOME} sed cd $(pwd) local 'quoted text' /usr/bin
+	${HOME} done cd x=1 | && readonly /usr/bin export /usr/bin done
+	echo then "$@" echo cd ${HOME} --verbose local "$@" | /usr/bin then printf &&
+	awk grep local cd $(pwd) test -eu $(pwd) "$@" $(pwd) -eu sed x=1 /usr/bin
+then 'quoted text' export printf x=1 /usr/bin
+export -eu && $(pwd) cd grep sed "$@" "$1" && "$@"
+	-eu done /usr/bin | awk test grep printf awk | /usr/bin
+	"$1" ${HOME} cd --verbose | printf
+		readonly && test "$1" "$@" "$1" awk && echo "$1" local "$1" && $(pwd) 2>/dev/null
+	local ${HOME} 2>/dev/null local "$@" grep --verbose "$1" ${HOME} printf awk
+	$(pwd) test awk "$1" 'quoted text'
+	-eu echo --verbose grep /usr/bin awk
+	cd 2>/dev/null "$1" done ${HOME} 2>/dev/null local grep "$1" then
+awk 2>/dev/null local echo "$@" x=1
+		| x=1 --verbose 2>/dev/null echo x=1
+$(pwd) local $(pwd) 'quoted text' echo --verbose done
+	local --verbose ${HOME} --verbose printf done
+-eu then 'quoted text' | export cd printf sed 'quoted text'
+		x=1 local awk cd | 2>/dev/null echo | 'quoted text' grep x=1 sed $(pwd)
+x=1 2>/dev/null printf "$1" cd x=1 | done -eu "$@" sed echo cd local
+sed readonly /usr/bin grep x=1 grep "$@" 2>/dev/null 2>/dev/null --verbose
+then then cd -eu $(pwd) awk ${HOME} | awk local /usr/bin cd "$@" done then
+printf local test then local $(pwd) printf "$@" printf
+	$(pwd) done then && | awk "$1" awk ${HOME} awk grep --verbose echo
+		awk readonly test local grep cd "$1" 'quoted text' -eu local local awk grep "$1"
+done readonly local then ${HOME} -eu grep && -eu then x=1 "$@" ${HOME}
+		-eu "$@" x=1 "$@" "$@" && /usr/bin "$@" -eu readonly x=1 grep
+		"$1" echo local cd /usr/bin && local x=1
+2>/dev/null local then then
+		awk "$1" $(pwd) done -eu 2>/dev/null
+printf export --verbose $(pwd) | ${HOME} && sed local ${HOME} -eu --verbose
+test && grep sed /usr/bin 2>/dev/null done ${HOME} | then 'quoted text' x=1 &&
+	2>/dev/null /usr/bin 2>/dev/null /usr/bin $(pwd) cd x=1
+x=1 --verbose "$1" export then test
+		export && export | echo echo sed done
+	--verbose --verbose local 'quoted text'
+	echo 2>/dev/null | awk test grep "$@" grep && echo readonly
+	cd 2>/dev/null local echo echo "$@" 'quoted text'
+		test && grep export local $(pwd) sed
+		grep && -eu readonly readonly
+	/usr/bin && awk ${HOME} local grep 'quoted text' test $(pwd) grep -eu 2>/dev/null
+	&& | cd "$1" readonly x=1 local readonly $(pwd) sed --verbose $(pwd)
+		local /usr/bin test export grep 'quoted text'
+${HOME} -eu /usr/bin /usr/bin "$1" test
+	local readonly "$@" local /usr/bin
+	'quoted text' --verbose --verbose
+test 'quoted text' "$1"
+&& then /usr/bin 2>/dev/null done echo test test
+test grep 'quoted text' cd && x=1 readonly ${HOME} x=1
+		'quoted text' awk --verbose ${HOME} /usr/bin
+${HOME} echo done done local
+		test --verbose export /usr/bin ${HOME}
+	readonly grep export $(pwd) ${HOME} && -eu test awk | 2>/dev/null
+	"$@" printf 'quoted text' then 'quoted text'
+#include c168.sh
+		'quoted text' local done "$1" | printf $(pwd) echo awk 'quoted text' "$@"
+		$(pwd) grep local export ${HOME} | /usr/bin done grep sed "$@" x=1 readonly
+x=1 'quoted text' then awk | 'quoted text' $(pwd) | | grep test && "$@" 'quoted text'
+	x=1 sed export echo ${HOME} "$1" grep echo
+		awk x=1 printf ${HOME} export $(pwd) ${HOME} ${HOME} sed echo
+"$1" x=1 test "$1" local "$@" test /usr/bin
+		x=1 ${HOME} ${HOME} awk
+2>/dev/null 2>/dev/null done ${HOME} grep
+	"$1" 2>/dev/null 2>/dev/null x=1 test done cd $(pwd) sed local
+done readonly readonly $(pwd) | awk ${HOME}
+		echo awk printf test awk grep | printf | 2>/dev/null sed readonly
+	/usr/bin ${HOME} grep test local ${HOME} 'quoted text' -eu && "$1" x=1 -eu
+	x=1 grep 'quoted text' 'quoted text'
+		--verbose echo "$@" --verbose
+		$(pwd) && x=1 "$1" printf ${HOME} sed local x=1 sed printf sed "$@" export export
+		&& "$1" export --verbose 2>/dev/null
+'quoted text' --verbose printf
+		"$@" echo test "$@" export
+		sed test "$1" | sed readonly export | local grep then /usr/bin awk && && | --verbose
+	"$@" && ${HOME} x=1 local "$1"
+then cd -eu awk sed sed done done
+export "$@" --verbose echo export echo readonly | export done ${HOME} test
+		cd | grep readonly awk "$1" /usr/bin awk printf --verbose readonly
+	then "$1" local printf -eu /usr/bin x=1 local 'quoted text' export
+		sed /usr/bin done readonly
+		'quoted text' grep /usr/bin test done readonly x=1 grep export export
+	-eu "$@" test | $(pwd) awk done test echo "$@" | printf test printf
+then export echo test cd --verbose sed done x=1 x=1 awk done
+	"$@" && --verbose export /usr/bin | local test && done -eu | grep /usr/bin
+	local -eu 2>/dev/null 'quoted text' done sed export && -eu done
+		grep local --verbose cd printf printf export sed --verbose test sed local
+		readonly /usr/bin /usr/bin "$1" 'quoted text' x=1 $(pwd) readonly awk
+| export && $(pwd) --verbose test $(pwd) local x=1 printf test test
+		export x=1 cd && then test then readonly awk then 2>/dev/null test
+"$@" done export x=1 "$@" echo cd x=1 'quoted text' -eu
+		2>/dev/null sed "$@" cd cd export sed -eu awk cd --verbose /usr/bin 2>/dev/null
+	$(pwd) export 'quoted text' && sed && local
+		sed sed printf x=1 $(pwd) test readonly x=1 sed 2>/dev/null ${HOME} "$@" -eu 'quoted text'
+	| $(pwd) grep $(pwd) ${HOME} ${HOME} grep test x=1
+		-eu "$1" cd /usr/bin done test export 'quoted text' ${HOME}
+		--verbose x=1 && readonly 'quoted text'
+	"$1" test "$@" local "$1" --verbose 2>/dev/null printf
+	$(pwd) readonly readonly 'quoted text' readonly readonly awk 'quoted text'
+		readonly awk sed awk done cd printf awk "$@" local printf "$@"
+	awk local 'quoted text' echo | 2>/dev/null grep 'quoted text'
+		$(pwd) test grep | echo x=1 local "$@" 'quoted text' echo | test "$1"
+	then sed grep 2>/dev/null | -eu && readonly test x=1
+	'quoted text' local && "$1" |
+	$(pwd) printf -eu local sed /usr/bin awk readonly echo then /usr/bin &&
+	cd readonly /usr/bin local cd awk test --verbose
+export then printf $(pwd) export echo local
+grep awk /usr/bin 2>/dev/null readonly awk --verbose then echo 2>/dev/null
+	cd x=1 $(pwd) --verbose printf | done "$1" "$1" readonly $(pwd)
+2>/dev/null /usr/bin && ${HOME} -eu grep test export x=1 awk
+	${HOME} echo 'quoted text' | sed local then cd printf local
+		2>/dev/null export -eu && -eu $(pwd)
+	x=1 then printf printf | | then 2>/dev/null "$1"
+test && x=1 readonly "$@" $(pwd)
+-eu 'quoted text' done local cd echo cd ${HOME} | done 2>/dev/null --verbose x=1
+		local ${HOME} awk printf --verbose --verbose && ${HOME} "$@" | --verbose 2>/dev/null
+		-eu 'quoted text' | export local echo awk /usr/bin | x=1 x=1
+		'quoted text' test -eu x=1 printf x=1 /usr/bin test test echo readonly "$@"
+	'quoted text' awk --verbose
+-eu 2>/dev/null cd grep "$1" done x=1 then "$1"
+cd grep x=1 "$1" 'quoted text' | local test readonly "$1" 2>/dev/null readonly
+awk test $(pwd) awk awk
+local awk sed --verbose --verbose echo $(pwd)
+		"$@" cd printf export 'quoted text' && then export done local
+		"$1" export 'quoted text' x=1 "$@"
+echo "$@" printf export local 'quoted text'
+	&& cd grep test awk "$1" "$@" | readonly readonly -eu 'quoted text'
+		"$1" x=1 2>/dev/null ${HOME} then x=1 ${HOME} printf local
+	"$1" /usr/bin readonly --verbose
+		echo test | local $(pwd) "$1" sed echo /usr/bin -eu then cd sed printf local --verbose
+done x=1 --verbose printf echo "$@" test ${HOME} 'quoted text'
+		readonly 2>/dev/null 2>/dev/null printf ${HOME} awk test "$1" done ${HOME} $(pwd)
+	cd test export cd awk grep local 'quoted text'
+$(pwd) done "$1" ${HOME} | printf "$@" readonly local export /usr/bin
+		echo "$1" awk local $(pwd) && x=1 'quoted text' test ${HOME} local export cd
+		done sed "$1" "$@" readonly then | test -eu done printf echo test cd
+	sed cd 2>/dev/null "$1" cd readonly "$1"
+		then grep /usr/bin 'quoted text' "$1" 2>/dev/null export echo awk &&
+	grep --verbose grep done cd cd done 'quoted text' export test
+		done 'quoted text' | test echo printf local $(pwd) /usr/bin 2>/dev/null "$1"
+	grep | local && 'quoted text' export
+		then "$@" ${HOME} 'quoted text' ${HOME} | awk 2>/dev/null 2>/dev/null
+	2>/dev/null done $(pwd) $(pwd) local test done 2>/dev/null
+		sed readonly x=1 cd "$1" cd done sed done
+	x=1 then "$1" grep "$1" | done -eu "$@"
+${HOME} grep 'quoted text' | /usr/bin "$@" then && cd 2>/dev/null
+		| local test cd test printf ${HOME} -eu echo /usr/bin test
+	"$1" --verbose "$1" "$@" "$1" sed cd "$@" /usr/bin cd x=1 export
+		/usr/bin --verbose $(pwd) $(pwd) cd sed
+printf ${HOME} grep echo grep x=1 /usr/bin /usr/bin
+	awk export 'quoted text' $(pwd) && | then "$@" test "$@" 'quoted text' local cd
+readonly 2>/dev/null -eu /usr/bin printf "$@" cd 2>/dev/null | --verbose cd
+		done done local echo "$@" local cd readonly /usr/bin
+		sed 'quoted text' local -eu export | then cd ${HOME} 'quoted text'
+	'quoted text' "$@" 'quoted text' /usr/bin cd test awk awk done
+	--verbose /usr/bin awk echo -eu test echo printf echo | /usr/bin |
+		readonly 'quoted text' done grep test done && readonly
+${HOME} export done && x=1 done sed -eu &&
+${HOME} $(pwd) grep readonly sed echo 2>/dev/null
+		'quoted text' "$1" grep awk --verbose
+		--verbose "$@" export export -eu
+		done readonly readonly
+		awk -eu readonly grep awk done --verbose $(pwd) cd && ${HOME} "$1"
+		$(pwd) "$1" echo "$@" 'quoted text' 2>/dev/null
+	local readonly printf local $(pwd)
+	readonly && readonly --verbose | done printf sed && echo grep && | awk
+	"$@" "$@" && then $(pwd) readonly sed
+		done x=1 test x=1 test && "$1"
+	'quoted text' then cd cd then readonly
+		$(pwd) -eu test export "$@" grep grep 'quoted text' export "$@" printf
+		"$@" $(pwd) | then test && test printf 'quoted text' $(pwd) x=1 local awk x=1
+		local done 'quoted text' 'quoted text'
+	x=1 test ${HOME} && local /usr/bin 2>/dev/null then
+	'quoted text' sed cd | 'quoted text' then 'quoted text'
+		cd export export export | then local ${HOME} "$@" test local $(pwd) --verbose
+	"$@" /usr/bin printf $(pwd) echo /usr/bin ${HOME} sed $(pwd)
+	'quoted text' cd printf "$@"
+done --verbose done sed readonly cd cd /usr/bin
+	$(pwd) then readonly $(pwd)
+awk then sed "$1" export | "$@" sed grep "$@" "$1" then readonly x=1 readonly
+	2>/dev/null awk $(pwd) readonly | 'quoted text'
+	local && printf 2>/dev/null
+	${HOME} | done then "$@" /usr/bin && x=1 | echo sed /usr/bin sed printf awk "$1"
+sed -eu -eu --verbose "$1" --verbose -eu | $(pwd) awk 2>/dev/null "$1" readonly
+		printf -eu $(pwd) cd echo ${HOME} local x=1 done && /usr/bin readonly readonly
+	-eu -eu then cd $(pwd) test 'quoted text' $(pwd)
+"$@" ${HOME} awk then $(pwd) grep "$@" $(pwd) echo cd 2>/dev/null
+	-eu grep && /usr/bin export cd $(pwd)
+		cd 2>/dev/null $(pwd) 2>/dev/null readonly
+--verbose printf cd /usr/bin /usr/bin export | cd local ${HOME}
+		-eu export ${HOME} /usr/bin grep
+		readonly printf cd 'quoted text'
+		"$1" done 'quoted text' cd then printf x=1
+		| test --verbose /usr/bin x=1 ${HOME} --verbose --verbose export sed printf
+	/usr/bin "$@" done export local export awk grep
+	x=1 -eu /usr/bin test done local sed readonly then test -eu awk --verbose
+	$(pwd) x=1 awk -eu | cd
+"$1" readonly -eu ${HOME} ${HOME}
+		2>/dev/null export x=1 $(pwd) /usr/bin
+	2>/dev/null --verbose -eu x=1 x=1 $(pwd) $(pwd) /usr/bin cd
+	then /usr/bin sed "$1" 2>/dev/null "$1" | echo ${HOME} cd
+done then 'quoted text' "$1" 2>/dev/null
+		done $(pwd) "$1" 2>/dev/null --verbose 'quoted text' --verbose && x=1 sed -eu /usr/bin
+	| 'quoted text' echo --verbose -eu awk done /usr/bin done local sed "$@" /usr/bin
+		cd ${HOME} && | | && export x=1 /usr/bin x=1 sed 'quoted text' grep ${HOME} /usr/bin
+		export ${HOME} grep readonly sed awk test
+		2>/dev/null grep then
+		'quoted text' awk && printf /usr/bin grep sed x=1 echo 'quoted text'
+		cd -eu $(pwd) grep local ${HOME} echo local 'quoted text' 2>/dev/null
+echo test export export 2>/dev/null then "$@" grep local
+awk awk 'quoted text' readonly 2>/dev/null --verbose
+		$(pwd) grep sed sed awk --verbose && "$@" readonly
+		local done "$@" grep "$1" then | local then local ${HOME} cd done
+x=1 grep done done then "$@" done then test /usr/bin $(pwd) -eu x=1
+		echo /usr/bin echo x=1 awk readonly "$1" &&
+		"$1" x=1 then 'quoted text' local test awk
+	then sed | "$1" cd cd cd local awk "$@"
+test export $(pwd) | printf | echo grep test printf 'quoted text' /usr/bin
+		$(pwd) printf ${HOME} x=1 then printf test readonly printf | "$@" then
+		| sed "$1" printf awk 2>/dev/null ${HOME} readonly "$@" sed echo
+		local && awk 'quoted text' printf sed test done done sed cd printf then
+$(pwd) "$@" -eu then printf 2>/dev/null
+| x=1 2>/dev/null printf echo 'quoted text' cd /usr/bin printf done
+cd awk 2>/dev/null then --verbose echo local grep local x=1 local | awk
+/usr/bin echo "$@" done cd 'quoted text' printf "$1"
+		test | "$@" $(pwd) -eu | printf awk sed | "$1" local local then cd local
+echo $(pwd) echo local --verbose export 'quoted text' ${HOME} -eu -eu /usr/bin
+		-eu | readonly ${HOME} echo "$@" x=1 x=1 "$1"
+		x=1 | "$1" ${HOME} readonly
+export awk awk "$@" "$1" "$1" "$@"
+		done --verbose && ${HOME} test 2>/dev/null then test echo 'quoted text'
+	x=1 'quoted text' local test 'quoted text' grep
+		--verbose x=1 -eu local | /usr/bin
+'quoted text' x=1 x=1 sed ${HOME} --verbose export
+		${HOME} export --verbose
+	&& --verbose 'quoted text' then | sed done echo readonly | done "$1" -eu --verbose
+	test cd $(pwd) printf 2>/dev/null -eu ${HOME} |
+	sed sed local "$@" | --verbose "$@" printf ${HOME} local "$@" grep x=1
+	/usr/bin /usr/bin 'quoted text' awk printf
+-eu /usr/bin echo "$@" awk ${HOME} printf
+"$1" test && | grep echo export readonly /usr/bin done
+		'quoted text' | ${HOME}
+$(pwd) "$1" grep | 'quoted text' $(pwd) echo test awk 2>/dev/null grep export
+	export x=1 printf /usr/bin echo | export export awk /usr/bin "$1" && /usr/bin
+		readonly cd x=1 then then awk | ${HOME} | 'quoted text' "$@" -eu -eu -eu | sed
+then local /usr/bin -eu ${HOME} ${HOME} cd cd $(pwd) test x=1 echo
+	sed && "$1" -eu | 2>/dev/null test awk -eu --verbose export -eu -eu 2>/dev/null
+grep "$@" "$1" 2>/dev/null 2>/dev/null
+	"$1" --verbose test then | printf sed readonly 2>/dev/null && --verbose
+		readonly | /usr/bin 2>/dev/null "$@" 'quoted text' grep /usr/bin
+	then then cd $(pwd) --verbose |
+	printf $(pwd) readonly --verbose cd grep echo "$@" export grep
+awk test done "$1" export readonly test printf
+		grep local x=1 printf | 'quoted text'
+done cd echo awk local | 'quoted text' $(pwd)
+	--verbose | sed echo 'quoted text' /usr/bin
+		sed printf "$@" test sed /usr/bin 2>/dev/null printf grep awk echo sed then
+		echo then --verbose $(pwd) grep "$1" --verbose awk "$1"
+	2>/dev/null done 'quoted text' 2>/dev/null grep x=1 && printf awk $(pwd) cd 2>/dev/null
+printf done "$@" $(pwd) $(pwd)
+	test local "$1" local && awk printf test
+	&& "$@" grep && /usr/bin grep printf grep 'quoted text' x=1 /usr/bin "$@" $(pwd)
+| /usr/bin test $(pwd) test local local grep 'quoted text' 2>/dev/null
+	sed grep "$@" echo local x=1 x=1 test $(pwd)
+		cd | local echo | test readonly 2>/dev/null
+$(pwd) readonly x=1 export
+	&& echo "$@" export x=1
+	&& /usr/bin readonly -eu | --verbose 2>/dev/null
+	readonly test "$1" ${HOME} /usr/bin --verbose 'quoted text' "$@" ${HOME}
+	export x=1 then readonly then 'quoted text' x=1 --verbose
+$(pwd) 2>/dev/null printf
+	x=1 export -eu | export /usr/bin awk test | "$1" readonly -eu test
+	2>/dev/null then $(pwd)
+	"$@" -eu /usr/bin 2>/dev/null done test awk "$@" && 2>/dev/null
+		grep x=1 cd | done --verbose
+"$@" export && x=1 export | readonly
+		2>/dev/null "$1" -eu x=1 sed /usr/bin $(pwd) /usr/bin
+		-eu "$@" sed echo | "$1" --verbose sed "$@" sed 'quoted text' | test
+"$1" done "$1" then | --verbose "$@" export sed 2>/dev/null "$@" $(pwd)
+	/usr/bin --verbose x=1 "$1" --verbose $(pwd) /usr/bin "$@" ${HOME} 2>/dev/null
+cd local /usr/bin grep 'quoted text' $(pwd) grep && grep -eu && cd printf
+grep "$@" --verbose "$1" $(pwd) 'quoted text' printf awk --verbose
+then "$@" --verbose "$1" $(pwd) | echo "$1"
+		x=1 -eu 'quoted text' echo printf export $(pwd)
+	&& ${HOME} export readonly 2>/dev/null | echo && ${HOME} printf x=1 "$1"
+done ${HOME} readonly x=1 x=1 $(pwd)
+awk 'quoted text' /usr/bin then sed grep local x=1 test then grep && 2>/dev/null
+	"$1" ${HOME} local cd 2>/dev/null printf sed sed then
+		$(pwd) "$@" /usr/bin test | local
+	$(pwd) "$@" --verbose --verbose
+grep readonly then | test /usr/bin "$1"
+export | $(pwd) 2>/dev/null then && awk "$@" printf
+	&& 'quoted text' | && | echo ${HOME}
+	--verbose awk 2>/dev/null local "$1" "$@" --verbose cd
+	export $(pwd) awk 'quoted text' x=1 /usr/bin /usr/bin 'quoted text'
+		export "$1" $(pwd) cd 'quoted text' "$1" "$@" sed done
+x=1 sed x=1 "$1" 2>/dev/null echo -eu "$@" ${HOME} -eu sed then $(pwd)
+		local readonly echo printf $(pwd) 'quoted text' "$@" /usr/bin
+	2>/dev/null "$1" -eu ${HOME} --verbose "$1" 'quoted text' &&
+	&& printf export cd local 'quoted text' "$@" 'quoted text'
+	&& 2>/dev/null cd done && grep grep x=1 'quoted text' "$@" ${HOME}
+	sed 2>/dev/null $(pwd) grep "$@" "$1" x=1 /usr/bin "$1" then local | printf "$@"
+&& echo -eu $(pwd) printf cd
+		cd printf echo /usr/bin ${HOME} cd /usr/bin local && then awk | /usr/bin awk grep
+then local ${HOME} "$1" $(pwd) printf --verbose "$@" awk then
+	echo then done awk cd "$@" "$@" && "$@" export then
+"$1" 'quoted text' "$@" echo printf
+2>/dev/null done sed cd --verbose
+	-eu 2>/dev/null test "$@" /usr/bin && "$@" done echo test 'quoted text' done "$1"
+		local && printf sed sed /usr/bin $(pwd) --verbose awk sed local printf $(pwd)
+	local readonly printf && -eu -eu grep
+	then awk export awk sed readonly export /usr/bin $(pwd) cd done readonly /usr/bin
+awk local echo $(pwd) done printf then then
+	done -eu grep ${HOME} export --verbose cd cd 2>/dev/null export
+	grep -eu --verbose cd 2>/dev/null "$@" "$1" --verbose awk echo
+test then local readonly awk sed awk /usr/bin
+	sed 2>/dev/null printf readonly ${HOME} && readonly readonly printf
+	'quoted text' --verbose done echo export && $(pwd) export "$1"
+test readonly cd x=1 --verbose x=1 awk printf /usr/bin "$@"
+		cd test --verbose grep ${HOME} local then "$1" grep "$@" awk
+		echo done readonly "$@" echo ${HOME} export readonly x=1 "$@" --verbose
+"$@" x=1 done awk "$1" x=1 grep /usr/bin && then 2>/dev/null test $(pwd) echo local
+&& "$@" local /usr/bin 'quoted text'
+		echo -eu readonly done | export "$1" -eu awk export readonly
+		${HOME} $(pwd) test $(pwd) $(pwd) 'quoted text' printf 2>/dev/null --verbose
+		sed x=1 done cd 2>/dev/null /usr/bin
+	export printf && | "$@" then
+		export x=1 ${HOME} /usr/bin test 'quoted text' sed x=1 x=1
+	done ${HOME} then printf -eu printf grep -eu | test cd export
+grep cd ${HOME} 2>/dev/null local readonly 'quoted text'
+	x=1 --verbose test local awk
+		test then local grep /usr/bin cd cd printf "$1" $(pwd) -eu && 2>/dev/null cd
+	export printf && -eu local 2>/dev/null echo done
+	done x=1 echo cd cd test local grep --verbose grep x=1 readonly
+	printf grep grep /usr/bin awk echo 'quoted text' "$@"
+2>/dev/null export -eu | --verbose
+	grep printf -eu awk -eu -eu | done "$@" readonly
+		/usr/bin "$@" ${HOME} "$@" /usr/bin awk export --verbose $(pwd) x=1 printf
+	cd 'quoted text' done then readonly
+--verbose --verbose done local /usr/bin 'quoted text'
+	test done "$@" printf | echo | --verbose 2>/dev/null grep --verbose test &&
+printf /usr/bin export --verbose local
+	grep done | sed | 2>/dev/null ${HOME} done
+readonly 'quoted text' -eu /usr/bin
+		--verbose awk /usr/bin done
+readonly --verbose x=1 cd readonly 2>/dev/null
+		/usr/bin --verbose x=1
+local ${HOME} && /usr/bin
+		&& --verbose | sed ${HOME} /usr/bin
+	${HOME} ${HOME} "$1" readonly
+		'quoted text' export | printf sed echo then
+| 'quoted text' "$@" 'quoted text'
+	-eu awk 2>/dev/null 'quoted text' then 'quoted text' awk ${HOME}
+	local export awk sed printf grep
+"$@" | --verbose printf --verbose readonly readonly
+--verbose "$1" echo awk 'quoted text' local grep
+		2>/dev/null printf -eu sed
+	cd local grep && then x=1 "$@" test printf echo grep /usr/bin && export
+"$1" -eu -eu then export then test ${HOME} ${HOME} 2>/dev/null
+		grep local readonly readonly readonly --verbose echo 'quoted text' ${HOME}
+	"$1" local export "$@"
+done 'quoted text' 2>/dev/null test sed | export --verbose /usr/bin grep
+	| export /usr/bin then 'quoted text' readonly echo $(pwd) --verbose grep x=1
+		x=1 printf awk echo sed /usr/bin printf $(pwd) ${HOME} 'quoted text'
+/usr/bin 2>/dev/null export
+	&& test printf test /usr/bin | test -eu sed | "$@" readonly local sed /usr/bin
+${HOME} sed done 'quoted text' then readonly echo local then && ${HOME} test |
+	cd /usr/bin echo test
+		then echo "$@" export "$1" printf test && sed "$1" then -eu $(pwd)
+&& then && awk sed printf readonly x=1 'quoted text' test readonly grep -eu
+	'quoted text' done 'quoted text' 'quoted text'
+	export "$1" ${HOME} ${HOME} "$1"
+/usr/bin 'quoted text' ${HOME} awk cd awk done
+local printf 2>/dev/null sed ${HOME} ${HOME} sed "$@" 2>/dev/null x=1 readonly
+sed awk cd grep sed "$1"
+	-eu grep printf $(pwd) cd | test sed -eu local printf done | 'quoted text'
+		export awk 'quoted text' echo --verbose 'quoted text' awk $(pwd) --verbose &&
+"$@" echo && echo export grep "$1" x=1 | done "$1" 2>/dev/null local cd
+readonly 2>/dev/null "$@" grep printf ${HOME} && export done
+	sed local echo export $(pwd) -eu local then done 'quoted text'
+	grep /usr/bin "$1" /usr/bin
+test export test test x=1 | echo | export test local cd
+	done ${HOME} "$@" sed && 2>/dev/null cd test
+		| /usr/bin x=1 readonly "$1" --verbose then test ${HOME}
+	test | "$@" export done "$1" test 'quoted text' 2>/dev/null
+	printf --verbose "$@" 2>/dev/null
+		2>/dev/null export | ${HOME}
+	printf && then then echo export 'quoted text' local
+		cd --verbose $(pwd) local export $(pwd) echo
+	printf export "$1" sed ${HOME} export sed
+done cd local 2>/dev/null --verbose /usr/bin echo $(pwd) then ${HOME} 'quoted text'
+		cd 'quoted text' sed | --verbose && $(pwd) x=1 export readonly 'quoted text'
+grep test echo local 'quoted text' local
+	$(pwd) /usr/bin done --verbose && | ${HOME} local printf export /usr/bin
+&& --verbose export then 'quoted text' /usr/bin
+then $(pwd) "$1" export done readonly 'quoted text' echo --verbose
+	readonly x=1 x=1 "$1" "$@" -eu readonly && echo test $(pwd) x=1 2>/dev/null --verbose
+echo sed $(pwd) && -eu "$1" export 2>/dev/null then
+	done export ${HOME} done --verbose 2>/dev/null done && --verbose -eu test readonly
+$(pwd) cd "$1" ${HOME} then grep 2>/dev/null
+		grep readonly $(pwd) cd export | "$1" -eu -eu local 2>/dev/null $(pwd) x=1
+		then test | echo 'quoted text' readonly printf
+	then sed sed then done
+readonly awk export awk awk && /usr/bin then printf echo | readonly | sed
+grep readonly 'quoted text' 2>/dev/null ${HOME} then --verbose --verbose -eu
+		x=1 "$@" 'quoted text' local export x=1 && done "$@" |
+	2>/dev/null "$@" | test --verbose awk cd
+&& && x=1 echo test sed then --verbose
+awk echo 2>/dev/null /usr/bin -eu "$@" && | /usr/bin
+	echo 2>/dev/null test ${HOME}
+	done echo sed export "$@" printf then | awk "$1" 'quoted text'
+	local cd x=1 test 'quoted text' done done && readonly echo -eu | cd -eu --verbose
+"$@" readonly echo $(pwd) -eu | sed x=1 x=1 grep x=1 test then --verbose then
+then grep "$1" awk /usr/bin printf 2>/dev/null then cd "$1" echo grep readonly
+&& -eu && done --verbose -eu 'quoted text' sed --verbose 'quoted text'
+		cd test readonly $(pwd) awk then 'quoted text' x=1 local -eu | "$1" sed $(pwd) "$1"
+		&& done grep "$1" ${HOME} readonly && grep x=1 sed grep echo 'quoted text'
+	grep local --verbose | 'quoted text' sed sed | printf x=1 echo --verbose x=1
+	export export | echo local "$1" "$1" echo awk x=1 ${HOME}
+	${HOME} local 2>/dev/null && 'quoted text'
+		done --verbose 'quoted text' then "$@" --verbose printf echo $(pwd)
+--verbose /usr/bin "$1" $(pwd) echo ${HOME} then then test readonly x=1 done echo
+		--verbose | x=1 printf 2>/dev/null 2>/dev/null
+	| done -eu local && --verbose -eu export "$@" then cd readonly cd | export local
+readonly grep readonly -eu test
+test -eu ${HOME} --verbose --verbose test ${HOME} test local awk "$1"
+	"$@" x=1 x=1 export local then "$@" cd local done 'quoted text'
+then x=1 /usr/bin "$@" then "$@" cd x=1
+-eu cd && | grep /usr/bin | local 2>/dev/null -eu local
+		$(pwd) "$@" cd | $(pwd) --verbose sed readonly cd cd 2>/dev/null cd echo $(pwd)
+	x=1 local grep printf then ${HOME} printf then ${HOME} | 'quoted text'
+-eu | done 2>/dev/null test export
+'quoted text' 'quoted text'
+"$1" | then -eu done sed /usr/bin && "$@" -eu
+		export "$@" then export 'quoted text'
+		printf awk then readonly "$@" -eu cd "$1" cd printf "$@" && "$1" sed readonly
+	local cd echo grep "$@" export then cd -eu 2>/dev/null
+		'quoted text' sed 2>/dev/null "$@" grep sed awk | local 'quoted text' local grep
+		"$1" 2>/dev/null "$@" ${HOME} "$@" awk
+then "$@" sed done "$@" --verbose /usr/bin grep 2>/dev/null --verbose
+x=1 cd x=1 readonly sed ${HOME} 2>/dev/null printf printf
+	x=1 cd printf local grep x=1 "$1" /usr/bin "$@" export readonly
+	cd test "$1" readonly awk test
+	&& readonly $(pwd) x=1 grep grep 'quoted text'
+"$1" 'quoted text' printf
+	export printf ${HOME} /usr/bin readonly $(pwd) 'quoted text' then "$1"
+	/usr/bin "$@" readonly ${HOME} 2>/dev/null readonly cd sed awk /usr/bin
+	test echo then cd | test
+		grep cd done "$@" echo echo readonly test
+"$1" test cd /usr/bin $(pwd) && readonly then echo then then "$1"
+	printf 2>/dev/null $(pwd) "$1" sed grep test grep printf cd sed local done
+| local --verbose grep "$@" /usr/bin sed readonly grep local
+	-eu echo -eu ${HOME} grep 2>/dev/null "$@" --verbose --verbose readonly "$1"
+		x=1 | -eu test -eu readonly x=1 x=1 printf ${HOME} 2>/dev/null x=1
+	&& ${HOME} && readonly $(pwd) -eu cd
+		/usr/bin then 2>/dev/null sed 'quoted text' && -eu | echo awk printf printf
+sed sed "$@" "$@" readonly
+readonly local echo echo then "$@" then sed done test
+		&& "$@" x=1 local $(pwd) -eu /usr/bin "$@" "$1" test local 'quoted text'
+	"$@" ${HOME} x=1 | ${HOME} --verbose 2>/dev/null
+readonly /usr/bin awk | test -eu ${HOME} --verbose
+		/usr/bin awk 2>/dev/null readonly grep then 'quoted text'
+		$(pwd) && local readonly "$1" --verbose /usr/bin | then 'quoted text'
+	done grep then cd printf done 2>/dev/null ${HOME} ${HOME}
+	2>/dev/null 'quoted text' 'quoted text' --verbose
+	-eu | cd local readonly echo --verbose x=1 sed done readonly
+export "$@" -eu done ${HOME} cd ${HOME} -eu ${HOME} "$1" x=1
+export x=1 /usr/bin then | awk x=1 --verbose
+	--verbose export --verbose && --verbose done echo local sed grep sed 'quoted text'
+	$(pwd) local x=1 local sed | "$1" sed | grep "$@" done --verbose grep local then
+$(pwd) readonly echo cd sed echo $(pwd) cd "$1" export export
+		sed test "$1" test printf | ${HOME} sed
+		readonly echo | export 2>/dev/null && cd | $(pwd) "$@" sed
+	cd grep && echo --verbose export grep local "$@" grep -eu x=1
+		awk /usr/bin echo sed "$1" done
+		x=1 && sed awk x=1 "$@" echo && test grep $(pwd) readonly -eu echo /usr/bin
+2>/dev/null test cd awk cd awk awk x=1 'quoted text' ${HOME}
+		test grep local cd 'quoted text' 'quoted text'
+'quoted text' /usr/bin test /usr/bin then test sed export export --verbose
+	| test | && local local test
+	--verbose local export "$1" 'quoted text' grep --verbose && readonly ${HOME}
+	2>/dev/null cd && local then /usr/bin export
+--verbose printf cd test echo "$1" echo "$1" 2>/dev/null sed export export
+readonly | then ${HOME} ${HOME} then "$1" export grep awk $(pwd)
+		2>/dev/null readonly --verbose then cd
+	--verbose 'quoted text' /usr/bin then /usr/bin 'quoted text' x=1
+		awk $(pwd) | 'quoted text' local
+	grep done cd "$1" ${HOME} then $(pwd) done
+		readonly printf echo echo cd export readonly | x=1 "$@" grep export
+cd readonly | ${HOME} x=1 -eu /usr/bin awk x=1
+		sed cd /usr/bin test cd -eu test $(pwd) test
+"$@" grep ${HOME} | -eu sed done awk ${HOME} cd test printf x=1 then
+-eu awk && printf "$1" ${HOME} export readonly printf "$1" then printf cd printf
+awk done ${HOME} 2>/dev/null
+	cd /usr/bin "$1" readonly x=1
+		grep x=1 cd 2>/dev/null readonly echo echo grep "$1" $(pwd) "$@" "$1" printf 'quoted text'
+	readonly echo -eu 2>/dev/null /usr/bin local --verbose x=1 && "$@" /usr/bin
+		done readonly test /usr/bin /usr/bin
+	sed -eu ${HOME} ${HOME} -eu done local "$@" 'quoted text' /usr/bin && $(pwd)
+	/usr/bin test $(pwd) then | -eu test local test -eu /usr/bin /usr/bin
+&& printf x=1 printf readonly
+	then printf /usr/bin echo -eu then echo echo printf readonly
+		'quoted text' "$1" && | | cd $(pwd) x=1 sed printf sed printf cd 'quoted text'
+		$(pwd) | x=1 awk awk local /usr/bin awk done echo local
+export 2>/dev/null ${HOME} test readonly
+	grep then grep --verbose && | --verbose grep --verbose sed export cd "$@" "$@"
+grep awk sed x=1 local "$@" 2>/dev/null readonly
+		done export grep /usr/bin "$1" --verbose -eu awk "$@"
+'quoted text' test cd grep "$@" readonly "$@" ${HOME} sed --verbose echo cd
+		--verbose "$@" grep "$@" local | $(pwd) test ${HOME} cd done done ${HOME} export
+&& export export awk && local
+	${HOME} then && "$1" printf export
+		x=1 then 'quoted text' awk -eu cd then sed awk echo x=1 && grep
+		&& 'quoted text' x=1
+	| test echo readonly "$@" "$1" x=1 'quoted text' 'quoted text' 2>/dev/null --verbose
+		"$1" grep | | test /usr/bin ${HOME} cd awk done x=1 echo sed export
+export -eu --verbose "$@" done then done readonly && --verbose 2>/dev/null
+		test echo && -eu local done
+-eu test local sed printf 2>/dev/null 2>/dev/null
+		-eu "$@" --verbose local $(pwd)
+	test echo export ${HOME} -eu then grep ${HOME}
+	x=1 cd 'quoted text' 2>/dev/null local printf 2>/dev/null export grep
+${HOME} local test printf export sed local | readonly "$@"
+	2>/dev/null 'quoted text' then cd -eu local export
+--verbose sed test -eu --verbose | grep ${HOME} readonly
+		"$@" | --verbose | && -eu readonly then $(pwd)
+${HOME} local done done test cd /usr/bin then echo readonly export 'quoted text'
+done $(pwd) && echo | | --verbose awk grep 'quoted text'
+		'quoted text' "$@" ${HOME} readonly
+	-eu done sed test export
+	done "$@" sed echo echo readonly export sed done cd echo cd then /usr/bin
+/usr/bin | grep cd "$@" /usr/bin &&
+		awk && --verbose 2>/dev/null /usr/bin readonly grep cd export echo export readonly
+	2>/dev/null "$@" readonly export local sed grep ${HOME} done
+	local printf readonly awk | 'quoted text' cd && "$@" grep printf then
+$(pwd) "$@" 'quoted text' && 2>/dev/null x=1 $(pwd) && readonly $(pwd)
+done "$@" printf echo | awk printf "$@" then -eu printf --verbose $(pwd) grep
+	'quoted text' sed awk && -eu then -eu export then 'quoted text' x=1
+		${HOME} awk x=1 awk awk echo --verbose --verbose x=1 -eu -eu ${HOME}
+		"$@" echo readonly x=1 awk awk sed sed echo "$1" | printf ${HOME}
+		awk /usr/bin awk readonly test then echo readonly
+		--verbose export echo export done grep x=1 then x=1 2>/dev/null 2>/dev/null
+export x=1 cd && x=1 "$@"
+&& | "$@" readonly -eu done cd local --verbose then cd x=1 test | 2>/dev/null
+		echo awk sed "$1" | --verbose awk then /usr/bin
+test | x=1 done grep sed
+	sed && /usr/bin | -eu printf -eu local
+		cd "$@" done "$1" x=1 $(pwd)
+		readonly && "$@" --verbose && then 'quoted text' -eu local export
+	| | printf grep $(pwd) "$@"
+export then export cd --verbose
+	done grep | 'quoted text' 'quoted text'
+"$1" export readonly done cd echo
+		${HOME} then && printf $(pwd) done grep ${HOME} --verbose 2>/dev/null
+	export x=1 awk 2>/dev/null echo export done -eu
+		export 2>/dev/null -eu $(pwd) awk ${HOME} && x=1 done | export printf
+readonly "$@" "$@" --verbose
+-eu $(pwd) 'quoted text' 2>/dev/null local readonly printf && grep awk export
+echo && awk awk -eu x=1 -eu | --verbose echo "$@" $(pwd) /usr/bin
+done grep ${HOME} --verbose test 2>/dev/null 'quoted text' printf
+2>/dev/null export grep readonly "$1" local 'quoted text'
+		$(pwd) test ${HOME} echo
+		sed awk ${HOME} awk test echo "$1" && echo echo printf readonly
+	| | echo cd done printf 'quoted text' cd awk export
+	'quoted text' test awk readonly test grep test
+	$(pwd) awk readonly $(pwd) echo "$@" printf printf
+		test test awk sed local "$1" grep /usr/bin
+"$@" --verbose --verbose local then export done
+		-eu x=1 local --verbose sed test export
+local -eu 'quoted text' sed | | echo
+	"$@" echo export then $(pwd) grep /usr/bin sed printf echo export --verbose -eu
+	"$1" printf cd printf awk "$1" grep 2>/dev/null | done
+	sed $(pwd) && "$@" grep done grep $(pwd) done /usr/bin grep done echo
+&& echo echo "$@" readonly then |
+local echo test export "$1" sed $(pwd) awk x=1 "$1" sed awk "$1" $(pwd)
+		2>/dev/null local done grep
+		printf /usr/bin then "$@" cd 'quoted text' sed && ${HOME} sed
+$(pwd) test /usr/bin done local /usr/bin $(pwd) ${HOME}
+$(pwd) sed x=1 test local "$1" echo 'quoted text' ${HOME} awk x=1
+	local | -eu readonly local ${HOME} 2>/dev/null
+then --verbose awk cd "$@" --verbose
+	then "$1" cd echo "$1" done cd test
+		cd grep test grep sed sed local ${HOME} sed
+		2>/dev/null readonly then -eu
+	&& -eu -eu && 'quoted text' sed awk 'quoted text' readonly local "$@" "$@" awk
+		2>/dev/null grep && printf
+		done /usr/bin "$1" 2>/dev/null x=1 awk cd test -eu
+"$1" ${HOME} /usr/bin awk grep done sed -eu cd printf then awk test echo
+		readonly 2>/dev/null "$1" awk done $(pwd) export | sed -eu "$1" --verbose
+"$1" $(pwd) awk /usr/bin 2>/dev/null export && readonly "$@" sed -eu /usr/bin readonly
+then grep --verbose --verbose test /usr/bin cd printf "$1" then done 'quoted text'
+	"$@" | cd grep -eu printf ${HOME} test -eu then
+	readonly export && done && sed cd x=1 local /usr/bin export x=1
+		export local 'quoted text' x=1 echo then /usr/bin awk --verbose
+	cd readonly sed --verbose awk /usr/bin --verbose x=1 2>/dev/null
+	--verbose "$1" printf done awk export local grep sed
+x=1 export | cd $(pwd) --verbose
+		export readonly "$1" printf --verbose "$1" sed echo && local
+done /usr/bin test local awk -eu |
+grep cd "$1" echo done "$1" cd then ${HOME} /usr/bin export --verbose cd
+done /usr/bin -eu export sed cd then | x=1 && export && awk sed ${HOME} |
+		local "$1" test /usr/bin sed echo cd x=1 printf -eu
+grep && "$1" /usr/bin
+	grep --verbose | /usr/bin awk ${HOME}
+	"$1" "$1" grep && && --verbose --verbose echo x=1 printf -eu
+	&& | $(pwd) then done 2>/dev/null $(pwd) then --verbose local printf echo
+$(pwd) && $(pwd) $(pwd) awk "$@" ${HOME} "$@" "$1" sed $(pwd) awk $(pwd) export
+	export local echo cd test done x=1 ${HOME}
+cd ${HOME} ${HOME} 2>/dev/null then readonly 2>/dev/null
+sed sed ${HOME} grep --verbose
+	done printf cd --verbose 2>/dev/null cd && ${HOME} x=1 then 2>/dev/null
+	${HOME} test export cd export 'quoted text' --verbose /usr/bin ${HOME} done
+	&& x=1 sed sed local
+	$(pwd) $(pwd) "$@" && test
+		"$1" ${HOME} 'quoted text' 2>/dev/null grep then local test "$1"
+		'quoted text' done export ${HOME} "$@" done | 'quoted text'
+		"$@" | 'quoted text' local sed
+	--verbose grep 'quoted text' grep printf readonly | "$1" "$@" | echo
+		cd /usr/bin printf printf awk awk echo "$1"
+	local "$@" ${HOME} $(pwd) printf then "$@" printf
+		2>/dev/null sed readonly --verbose x=1 | grep ${HOME} awk /usr/bin local -eu "$@"
+| export sed && /usr/bin 2>/dev/null echo "$@" local readonly grep grep echo
+	| export done grep | && test test printf then echo "$@" grep
+2>/dev/null && printf 2>/dev/null ${HOME} x=1 --verbose 2>/dev/null
+${HOME} test grep readonly $(pwd) 2>/dev/null /usr/bin 2>/dev/null
+		cd export done cd && done local export echo done 'quoted text'
+&& /usr/bin grep local then printf /usr/bin test sed readonly x=1 'quoted text'
+		export export export "$@" $(pwd) sed 2>/dev/null awk sed echo echo awk &&
+/usr/bin 2>/dev/null --verbose && && local grep /usr/bin x=1 grep x=1 then 'quoted text'
+		cd echo /usr/bin -eu test test
+| /usr/bin done $(pwd) $(pwd) done printf test
+	"$@" echo "$1" "$@" | echo x=1 ${HOME} then
+	echo $(pwd) ${HOME} "$@" -eu local cd local
+cd cd test && && 'quoted text'
+'quoted text' done then then echo $(pwd) local -eu
+	echo export "$1" -eu then cd ${HOME} grep cd $(pwd) | | --verbose awk awk x=1 printf
+	echo | "$@" export 2>/dev/null
+"$@" $(pwd) | ${HOME} "$@" /usr/bin
+readonly sed export grep export /usr/bin ${HOME} printf
+${HOME} -eu $(pwd) -eu sed --verbose 2>/dev/null
+x=1 "$@" done done --verbose then "$@"
+	--verbose "$@" /usr/bin readonly
+echo -eu sed -eu 2>/dev/null --verbose
+		2>/dev/null /usr/bin done ${HOME} x=1 "$@" cd
+	readonly --verbose printf | x=1 "$@" 'quoted text' printf local
+	printf $(pwd) "$@" export 'quoted text' awk done && sed then grep
+printf local 2>/dev/null /usr/bin echo
+	&& x=1 | x=1 grep readonly
+	echo --verbose readonly export awk && "$1" -eu then ${HOME} awk test --verbose
+		readonly grep readonly export test local "$1" awk -eu local 2>/dev/null
+	sed local echo "$@" sed
+	'quoted text' x=1 grep local --verbose cd 'quoted text' 'quoted text'
+		readonly echo x=1 ${HOME} 'quoted text'
+		&& local /usr/bin done 'quoted text' awk readonly awk --verbose "$1" sed
+cd local x=1 ${HOME} "$@" -eu 2>/dev/null
+awk test --verbose echo
+	x=1 local test awk test export echo 'quoted text' "$@" export -eu printf
+sed "$@" readonly "$@" then
+then | echo echo -eu && grep local /usr/bin
+&& done then echo -eu export "$@" | "$@" cd grep | -eu 2>/dev/null
+	-eu "$1" readonly | | ${HOME} --verbose | echo grep --verbose ${HOME}
+	export then printf x=1 sed ${HOME} cd 'quoted text' printf 2>/dev/null
+cd 2>/dev/null $(pwd) local readonly sed x=1 cd test cd $(pwd) /usr/bin done
+	local local | cd awk /usr/bin
+local cd ${HOME} | --verbose x=1 -eu | | export $(pwd) --verbose local 'quoted text'
+	echo export && ${HOME} -eu then grep done && echo x=1 export echo x=1
+test ${HOME} 'quoted text' --verbose
+	--verbose awk then cd sed $(pwd) awk "$@"
+2>/dev/null cd sed echo /usr/bin ${HOME} printf x=1 "$1" test
+		test echo && local sed 'quoted text' done -eu "$@" "$@" "$1" awk awk
+	then done x=1 | | x=1 test grep done ${HOME} echo "$1" x=1
+	$(pwd) test "$1" done ${HOME} export && 'quoted text' sed |
+		"$@" ${HOME} test | printf sed local && test printf ${HOME} then then
+	readonly --verbose ${HOME} "$1" echo /usr/bin local then "$1" 2>/dev/null echo
+test $(pwd) then "$@" readonly echo x=1 echo 'quoted text'
+		${HOME} "$1" && 'quoted text' "$1"
+| local export "$1" "$1" "$@" awk
+	${HOME} echo ${HOME} cd $(pwd)
+${HOME} -eu 'quoted text' /usr/bin sed readonly local 2>/dev/null readonly /usr/bin
+cd export x=1 then $(pwd) local --verbose then readonly
+		cd 2>/dev/null --verbose export local done export
+		/usr/bin local ${HOME} $(pwd) $(pwd) -eu
+grep -eu $(pwd) $(pwd) 2>/dev/null
+	"$1" local /usr/bin readonly local --verbose ${HOME} printf
+		${HOME} test test cd /usr/bin "$1" "$@" x=1 export
+local && -eu | 'quoted text' then readonly --verbose
+	printf cd done ${HOME}
+cd sed readonly printf printf /usr/bin
+	"$1" | sed && printf && awk --verbose
+awk "$1" printf /usr/bin local done cd 'quoted text' 2>/dev/null grep printf
+	awk printf readonly done grep awk local
+		local $(pwd) && | readonly test && "$@" "$@"
+-eu grep grep grep export "$1" "$@" test export
+		--verbose "$@" local "$1" $(pwd) "$1" awk grep grep -eu awk
+$(pwd) export done awk $(pwd) ${HOME} readonly
+		grep x=1 awk then x=1 ${HOME} cd ${HOME} ${HOME} ${HOME}
+$(pwd) grep local test
+awk cd ${HOME} -eu readonly printf export printf
+		test /usr/bin echo awk | $(pwd) cd grep && readonly "$1" echo readonly
+	&& test done && readonly
+printf export && -eu 2>/dev/null "$1" -eu then readonly | /usr/bin
+	x=1 x=1 cd $(pwd) then 'quoted text' x=1 "$@"
+local "$1" sed "$@" 'quoted text' cd then test then "$@" done /usr/bin
+		&& grep awk $(pwd) $(pwd) && ${HOME}
+		export local /usr/bin awk && printf
+	export test done && "$1" "$1" x=1 printf then echo test ${HOME} export
+echo && /usr/bin x=1 "$@" test -eu grep 'quoted text' 2>/dev/null
+		done echo export done awk /usr/bin && export
+	${HOME} ${HOME} | then && | ${HOME} x=1 test
+	/usr/bin | awk /usr/bin echo grep readonly && "$1" grep
+		echo readonly local sed /usr/bin x=1 && && 2>/dev/null
+export 2>/dev/null echo "$@" 'quoted text'
+		awk ${HOME} echo --verbose
+	printf "$1" && cd done then $(pwd) grep && "$1" then | cd
+x=1 --verbose then x=1
+	2>/dev/null then grep $(pwd) x=1 test echo -eu $(pwd) "$1" | sed echo $(pwd) export
+	&& readonly ${HOME} done local grep
+awk sed grep then echo awk then readonly grep ${HOME}
+readonly $(pwd) "$1" ${HOME} /usr/bin grep
+	&& /usr/bin $(pwd) awk grep $(pwd) -eu awk awk -eu && $(pwd)
+		export printf sed cd done echo echo
+		${HOME} 'quoted text' -eu "$1" x=1 ${HOME}
+then && then printf test local then -eu $(pwd) printf sed echo --verbose
+		readonly grep --verbose then 'quoted text' $(pwd) "$1" then
+$(pwd) "$1" cd readonly ${HOME} printf | $(pwd) done echo
+sed export then readonly /usr/bin grep "$@" awk done x=1 done
+		${HOME} cd "$@" readonly && cd x=1 "$1" -eu local grep printf sed -eu local
+cd $(pwd) --verbose x=1 grep readonly echo readonly 'quoted text' grep readonly
+	awk awk cd x=1 $(pwd) --verbose done readonly /usr/bin | $(pwd)
+	cd readonly x=1 echo done $(pwd) export /usr/bin test readonly local
+	printf export "$1" "$@" test test export
+		x=1 printf 2>/dev/null then $(pwd) cd test then readonly 'quoted text'
+		"$@" "$1" "$@" "$@" "$@" readonly "$1" done x=1 ${HOME}
+	x=1 then "$1" -eu "$@" export readonly 2>/dev/null | then /usr/bin
+'quoted text' awk export printf 2>/dev/null
+awk awk | test export "$1" local && && /usr/bin -eu sed
+		sed awk done echo sed "$1" test readonly
+	then x=1 local ${HOME} then -eu | local && x=1 grep readonly
+		printf echo grep 'quoted text' ${HOME} 'quoted text' printf "$1" x=1 sed
+		cd "$1" /usr/bin 2>/dev/null grep "$@"
+${HOME} ${HOME} | done export
+		readonly "$1" then then
+		grep $(pwd) ${HOME} export then "$1" 2>/dev/null
+		awk --verbose --verbose -eu cd ${HOME} && -eu 'quoted text' cd printf awk sed
+	"$@" /usr/bin /usr/bin /usr/bin && && x=1 "$@" test && done
+then then test test "$@" x=1 ${HOME}
+	readonly test cd grep test ${HOME} -eu echo echo
+		x=1 2>/dev/null x=1 x=1 "$@" readonly "$1" --verbose -eu export done local
+		-eu grep 2>/dev/null grep test awk $(pwd)
+		then --verbose --verbose echo printf cd sed export 2>/dev/null
+${HOME} sed "$1" x=1 awk then ${HOME} 'quoted text' ${HOME} $(pwd) awk
+		grep --verbose 'quoted text' then
+$(pwd) export /usr/bin ${HOME} then
+	export printf local done "$@" test test -eu && x=1 x=1 | sed grep $(pwd) 2>/dev/null
+done -eu && echo sed cd 'quoted text'
+then $(pwd) && test "$1" | readonly | x=1 | done ${HOME} test grep
+		awk readonly /usr/bin echo grep printf
+		then | printf sed /usr/bin 'quoted text' sed $(pwd) x=1 done "$1" | done
+		done printf x=1 cd awk grep cd then /usr/bin
+	x=1 test then printf grep test done
+&& 'quoted text' "$@" x=1 ${HOME} awk echo
+		export | -eu test test "$@" done x=1 awk --verbose 2>/dev/null grep 'quoted text'
+	export echo 2>/dev/null export cd grep && test cd "$1" 'quoted text'
+$(pwd) && test printf -eu 2>/dev/null then "$@" /usr/bin
+		/usr/bin then $(pwd) readonly grep && --verbose
+	printf 2>/dev/null | printf readonly $(pwd) | export
+local readonly 2>/dev/null --verbose && x=1 test && x=1 2>/dev/null /usr/bin
+export | x=1 readonly ${HOME} "$@" $(pwd) readonly
+${HOME} local /usr/bin awk cd && local printf $(pwd) -eu
+	done cd grep done 2>/dev/null
+		| cd && echo local "$1" ${HOME} grep "$1" printf
+		then local --verbose printf | x=1 --verbose local | --verbose
+	"$1" export readonly sed test -eu 'quoted text' ${HOME} readonly
+	${HOME} awk export awk printf -eu /usr/bin
+	'quoted text' cd grep -eu printf /usr/bin printf "$1" echo printf ${HOME}
+		cd x=1 echo ${HOME} printf sed
+		grep ${HOME} cd echo 2>/dev/null
+		test "$@" x=1 "$@" "$@" local -eu cd export && cd
+x=1 -eu local test sed "$1" awk export test -eu grep test sed "$1" && ${HOME} |
+sed awk awk /usr/bin then x=1 'quoted text' 'quoted text' | grep ${HOME}
+	"$@" ${HOME} --verbose && --verbose --verbose echo then
+		then ${HOME} done "$1" cd grep awk ${HOME} /usr/bin
+		sed readonly done sed test --verbose
+	'quoted text' -eu echo "$1" test
+	x=1 sed x=1 /usr/bin $(pwd) x=1 2>/dev/null
+		-eu --verbose printf 'quoted text' local x=1 $(pwd) cd test 2>/dev/null -eu grep
+	awk $(pwd) cd | test cd -eu readonly -eu
+&& | | done grep x=1 grep test then grep ${HOME} awk ${HOME} done printf
+	/usr/bin export cd 2>/dev/null --verbose
+	echo test echo echo then 'quoted text' 'quoted text'
+	$(pwd) --verbose then "$@" && -eu -eu done echo done "$@"
+		cd sed sed /usr/bin done | readonly 2>/dev/null
+		/usr/bin test $(pwd) "$1"
+	| awk done export --verbose then -eu /usr/bin $(pwd) local 2>/dev/null done
+	| | && --verbose sed /usr/bin /usr/bin cd
+done /usr/bin test export x=1 -eu x=1 --verbose printf sed export -eu
+-eu 2>/dev/null cd sed awk export /usr/bin readonly
+		readonly printf grep echo
+	${HOME} then readonly "$@" $(pwd) | sed
+		done awk sed | $(pwd) export | grep "$1" -eu
+	"$@" | x=1 cd echo x=1 local printf && done $(pwd) printf
+	"$@" x=1 export echo -eu "$1" ${HOME}
+| 2>/dev/null x=1 --verbose local --verbose | 2>/dev/null grep x=1 readonly
+		$(pwd) test /usr/bin then
+		sed cd "$@" "$@" $(pwd) test --verbose
+local grep && -eu ${HOME} export awk
+$(pwd) "$1" --verbose grep sed $(pwd) ${HOME} done 2>/dev/null readonly 'quoted text'
+	export grep printf ${HOME} readonly "$1" export --verbose $(pwd) 2>/dev/null 'quoted text'
+cd "$@" && cd /usr/bin "$1" ${HOME} readonly printf readonly
+	x=1 cd printf cd $(pwd) /usr/bin
+	local && cd done local | ${HOME} cd printf --verbose test --verbose 2>/dev/null
+	awk echo --verbose 'quoted text' then then export
+test "$@" test --verbose
+/usr/bin test local grep /usr/bin /usr/bin readonly -eu export
+		&& then cd 2>/dev/null grep "$1" grep grep export then -eu done $(pwd) 2>/dev/null
+	| export x=1 --verbose awk
+echo 2>/dev/null awk 2>/dev/null 2>/dev/null -eu x=1 /usr/bin ${HOME}
+	grep /usr/bin export test local then ${HOME}
+	echo -eu "$@" /usr/bin $(pwd) /usr/bin then printf 2>/dev/null then && test
+	| | $(pwd) local 'quoted text'
+	"$1" -eu grep "$@" ${HOME} readonly -eu "$1" awk printf -eu
+	test $(pwd) export "$@" -eu
+		readonly grep printf cd then cd local ${HOME}
+		/usr/bin $(pwd) 'quoted text' printf | x=1 local
+		--verbose awk --verbose 2>/dev/null 2>/dev/null cd | echo --verbose 'quoted text'
+		-eu echo "$1" -eu ${HOME} x=1 --verbose
+sed -eu x=1 readonly x=1 2>/dev/null local "$1" ${HOME} --verbose 'quoted text'
+	'quoted text' sed && echo export export "$1" grep
+	&& ${HOME} test "$@" $(pwd) done printf then -eu readonly done 2>/dev/null
+		"$1" grep /usr/bin done -eu && /usr/bin --verbose ${HOME}
+	then cd | readonly | local echo
+readonly grep $(pwd) /usr/bin /usr/bin && "$@" done 'quoted text' printf 'quoted text'
+	awk sed done done grep "$1" 2>/dev/null
+		/usr/bin done echo "$@" /usr/bin /usr/bin readonly awk awk grep
+		cd ${HOME} 'quoted text' sed local awk done echo
+	"$1" awk cd cd "$@" test ${HOME} cd | cd $(pwd)
+	&& sed grep export done ${HOME} "$1" --verbose export local --verbose
+	done sed echo x=1 export then
+		local -eu grep printf cd then "$1" && $(pwd)
+		sed x=1 export 'quoted text' printf
+-eu grep -eu export grep /usr/bin
+		$(pwd) --verbose $(pwd) 2>/dev/null cd echo |
+	cd x=1 "$1" cd local done && cd "$1" ${HOME} 'quoted text' local
+		'quoted text' 2>/dev/null $(pwd) cd "$1"
+	awk -eu 'quoted text' x=1 /usr/bin /usr/bin 2>/dev/null cd && -eu grep local
+"$@" grep ${HOME} ${HOME} sed local
+	${HOME} done -eu x=1 done /usr/bin grep x=1 2>/dev/null x=1 export grep
+test -eu --verbose test "$@" export ${HOME} -eu sed -eu then then done printf
+		x=1 | ${HOME} cd sed awk /usr/bin /usr/bin "$@" test export && done
+	readonly | 2>/dev/null
+		$(pwd) test | readonly /usr/bin x=1 'quoted text' grep && "$@" x=1 then
+awk $(pwd) /usr/bin -eu
+		'quoted text' then --verbose x=1 cd 2>/dev/null
+	awk awk printf ${HOME}
+	--verbose && test done readonly
+2>/dev/null ${HOME} then done cd -eu local awk "$1" 2>/dev/null awk 2>/dev/null
+	awk sed local readonly ${HOME} 'quoted text' && printf
+export /usr/bin "$1" "$@" "$@" ${HOME} readonly |
+sed 'quoted text' local -eu ${HOME} /usr/bin readonly x=1 printf
+x=1 2>/dev/null readonly test "$1" && x=1
+	awk printf 'quoted text' done $(pwd) x=1 printf awk -eu --verbose "$@" grep
+/usr/bin 2>/dev/null $(pwd) echo then -eu cd
+		'quoted text' sed $(pwd) sed local 'quoted text'
+	x=1 grep --verbose test printf && /usr/bin "$@" "$1" cd -eu ${HOME} readonly
+		echo && | ${HOME} grep | -eu 'quoted text' test awk /usr/bin | x=1 test printf
+-eu done "$@" | grep --verbose
+		"$1" awk --verbose ${HOME} /usr/bin
+		printf then "$1" x=1 awk printf done then x=1 $(pwd)
+	${HOME} cd 2>/dev/null ${HOME} 2>/dev/null local readonly
+"$@" printf awk done then test echo test
+awk export then local ${HOME}
+	echo then | sed /usr/bin echo
+	local readonly awk 2>/dev/null && readonly grep 'quoted text'
+then test sed grep awk done /usr/bin
+-eu && cd "$@" readonly x=1 --verbose awk
+-eu ${HOME} awk 'quoted text' sed echo x=1 /usr/bin awk awk then
+		$(pwd) export awk local local $(pwd) readonly 2>/dev/null sed grep test
+&& ${HOME} && -eu --verbose x=1 --verbose cd "$1" --verbose awk -eu
+	done x=1 grep sed /usr/bin done x=1 "$1" done local cd then -eu cd then "$1"
+		local ${HOME} echo x=1 ${HOME} $(pwd) "$1" "$@" "$1" | awk export "$@"
+		sed local "$@" x=1 "$1" -eu 2>/dev/null export sed "$1" -eu printf -eu then test
+	export readonly "$@" && -eu --verbose
+		done $(pwd) export /usr/bin local
+echo 2>/dev/null ${HOME} x=1 echo test
+local --verbose then cd grep local "$1" $(pwd) grep $(pwd) cd
+'quoted text' ${HOME} echo printf sed 2>/dev/null
+		-eu done /usr/bin 2>/dev/null cd | readonly local
+awk -eu && $(pwd) $(pwd) -eu ${HOME} export echo done
+	sed grep && test "$@" awk test then cd local awk cd readonly sed cd export printf
+${HOME} then awk -eu test test 2>/dev/null export && | --verbose ${HOME}
+	"$@" cd 'quoted text' export sed "$1" /usr/bin
+awk local "$1" printf cd x=1 && local export export then grep
+		printf | 2>/dev/null x=1 -eu export done test local
+cd /usr/bin test ${HOME} test
+		awk ${HOME} | grep done 'quoted text' ${HOME} | "$@" local
+echo readonly cd 2>/dev/null "$@" sed sed && | --verbose
+awk then then test local local test x=1 printf sed done "$1" /usr/bin sed
+	local export 'quoted text'
+		| readonly echo 'quoted text' grep
+	/usr/bin "$@" /usr/bin "$@" sed x=1 "$@" sed --verbose "$1" 2>/dev/null
+		-eu | export 2>/dev/null test -eu readonly awk local -eu
+		-eu "$1" -eu then then -eu readonly --verbose printf /usr/bin echo
+export then && sed sed sed -eu 'quoted text' sed awk local readonly
+	local x=1 awk ${HOME} grep /usr/bin 2>/dev/null echo /usr/bin
+		grep test awk && && export && $(pwd) printf done local sed 2>/dev/null
+&& printf "$@" export local 2>/dev/null
+readonly | local x=1 $(pwd) | -eu done done
+test readonly -eu then /usr/bin sed export 'quoted text'
+	awk sed then /usr/bin x=1 then "$@" x=1 done 'quoted text' $(pwd) grep
+		then x=1 x=1 2>/dev/null cd test then "$1" then x=1 test x=1 export cd ${HOME}
+		"$1" echo /usr/bin test "$@" "$1" -eu | local $(pwd) 2>/dev/null
+		| --verbose "$1" 2>/dev/null x=1 done awk cd then awk 'quoted text' local cd grep
+		printf -eu | "$1" echo x=1 test export test && ${HOME} ${HOME} echo | ${HOME}
+		test $(pwd) echo cd cd export --verbose readonly cd then awk printf "$@"
+		awk test sed ${HOME} done && readonly $(pwd)
+2>/dev/null x=1 local --verbose test -eu
+	/usr/bin grep x=1 | 2>/dev/null
+	printf | | $(pwd) sed sed echo -eu awk 'quoted text' then "$1" x=1 export 2>/dev/null
+		'quoted text' /usr/bin awk then
+	/usr/bin 'quoted text' local readonly /usr/bin "$@" local
+x=1 local | export x=1 done
+		printf done --verbose "$1" /usr/bin
+	local grep cd ${HOME} "$1" 'quoted text' $(pwd) echo "$@" then
+&& 2>/dev/null && /usr/bin grep sed "$1" --verbose
+| then awk awk "$1" --verbose readonly -eu grep |
+	sed readonly x=1 local 2>/dev/null cd export && local 2>/dev/null
+	$(pwd) /usr/bin readonly --verbose awk
+		--verbose readonly then test && && | done grep echo test echo echo | then
+		2>/dev/null 'quoted text' test
+awk awk grep local then /usr/bin --verbose
+| && "$1" 2>/dev/null local then done 'quoted text' readonly done
+export -eu "$1" awk awk then cd 'quoted text'
+test export done echo x=1 'quoted text'
+	cd "$1" /usr/bin awk | && -eu export "$@" -eu grep x=1 done cd x=1 cd printf sed
+		awk cd readonly 'quoted text' cd && local printf sed
+	/usr/bin && $(pwd) $(pwd) $(pwd) | test
+	'quoted text' sed /usr/bin --verbose sed "$1" && &&
+		/usr/bin readonly /usr/bin echo 'quoted text' 2>/dev/null
+		x=1 echo local 2>/dev/null cd local test then "$@"
+	&& "$1" x=1 printf 2>/dev/null 2>/dev/null /usr/bin
+test x=1 printf then printf && x=1 /usr/bin test printf 'quoted text'
+"$1" "$1" printf "$@" $(pwd)
+		x=1 $(pwd) test /usr/bin awk --verbose --verbose test readonly awk /usr/bin
+echo readonly 'quoted text' done 'quoted text'
+then grep 'quoted text' $(pwd) echo x=1 local done
+	readonly export 'quoted text' 'quoted text'
+	${HOME} test ${HOME} done 2>/dev/null $(pwd) -eu local
+	"$@" printf export | --verbose awk "$@" 2>/dev/null
+export 2>/dev/null grep done sed "$1"
+	"$1" awk printf then then ${HOME} "$1" /usr/bin
+	echo "$1" ${HOME} export && 2>/dev/null
+2>/dev/null && && done sed "$1" 'quoted text'
+		readonly readonly x=1 echo | readonly 2>/dev/null
+"$@" awk cd 'quoted text' --verbose
+printf grep -eu | echo -eu echo --verbose
+	/usr/bin /usr/bin $(pwd) grep ${HOME} ${HOME} cd ${HOME} sed cd awk
+	readonly 2>/dev/null done "$@" 'quoted text' then
+	$(pwd) x=1 then readonly $(pwd) done ${HOME} | | ${HOME} | sed printf local
+		readonly sed "$1" -eu then
+		grep cd export echo && done
+	$(pwd) /usr/bin printf export printf local ${HOME}
+/usr/bin x=1 "$@" sed | then ${HOME} then /usr/bin /usr/bin
+then /usr/bin readonly test printf readonly /usr/bin test 2>/dev/null "$@"
+		sed /usr/bin | && $(pwd) 'quoted text' --verbose
+		done test cd --verbose then export grep echo then cd 'quoted text' $(pwd) $(pwd)
+	test && echo ${HOME}
+	printf --verbose printf then 2>/dev/null "$@" /usr/bin
+		then test 2>/dev/null local && done /usr/bin | export
+	printf /usr/bin then /usr/bin
+		awk "$@" export && 'quoted text'
+		done ${HOME} -eu export && echo then local && done grep
+		'quoted text' | "$1" /usr/bin 2>/dev/null
+readonly echo ${HOME} done
+		| done && && "$1" awk grep 2>/dev/null $(pwd)
+done ${HOME} x=1 then readonly | 2>/dev/null
+&& printf done grep readonly local
+	"$@" readonly test 'quoted text' export
+	echo && sed -eu "$@"
+test readonly awk /usr/bin readonly then
+	$(pwd) done /usr/bin | sed | sed
+	2>/dev/null echo sed --verbose | --verbose
+test --verbose --verbose
+	export then 2>/dev/null printf done /usr/bin
+	then echo done --verbose done grep printf cd 2>/dev/null -eu awk sed done $(pwd)
+	| && grep printf 'quoted text'
+	printf test | && x=1 'quoted text' grep export then | |
+		&& test grep 'quoted text' grep /usr/bin -eu awk test test done export
+		awk ${HOME} awk then export test
+awk echo printf | export local local test cd test
+2>/dev/null $(pwd) --verbose export grep cd $(pwd) cd done
+printf && echo done $(pwd) && awk echo sed | export | readonly printf cd
+	test ${HOME} sed readonly 2>/dev/null printf awk $(pwd) 2>/dev/null
+&& x=1 --verbose sed echo "$@" done
+		$(pwd) "$@" printf sed test export && $(pwd) then
+	--verbose test $(pwd) then $(pwd) ${HOME}
+'quoted text' test export then printf grep 2>/dev/null | readonly printf
+	grep printf export ${HOME} test && /usr/bin $(pwd) done done
+--verbose "$@" --verbose printf 2>/dev/null | 2>/dev/null printf
+export cd test done 'quoted text'
+	awk grep done local -eu sed grep --verbose $(pwd) $(pwd)
+	"$1" export --verbose "$1" export
+	then "$@" echo readonly awk printf printf && then cd printf "$1" printf --verbose
+	'quoted text' done | awk echo
+local test done awk ${HOME}
+		readonly && readonly ${HOME} grep echo cd echo "$1" echo done
+	awk "$1" then cd done 'quoted text' ${HOME}
+		&& cd cd printf printf 2>/dev/null sed awk then $(pwd) "$1" export
+done "$1" sed awk && | $(pwd) 2>/dev/null
+-eu grep grep awk echo local /usr/bin --verbose ${HOME}
+		local --verbose local local done grep -eu 2>/dev/null
+export grep echo /usr/bin test x=1 then
+echo export readonly "$1" 2>/dev/null
+		test --verbose ${HOME} export 'quoted text' echo 2>/dev/null 'quoted text'
+readonly sed && grep awk "$@" "$1" |
+${HOME} readonly test ${HOME} "$@" ${HOME} /usr/bin echo
+'quoted text' grep $(pwd) printf --verbose
+	--verbose "$1" x=1 -eu done | 2>/dev/null awk "$1" 'quoted text'
+${HOME} | sed then ${HOME}
+	local then | readonly export readonly -eu grep /usr/bin grep cd then
+		/usr/bin sed cd printf then readonly readonly
+local -eu -eu | | x=1 /usr/bin &&
+-eu | -eu readonly /usr/bin
+		local printf export "$1" echo 2>/dev/null && echo x=1 echo $(pwd) /usr/bin readonly
+2>/dev/null readonly grep | 2>/dev/null printf grep
+sed sed && echo then test printf | export "$1" -eu 2>/dev/null
+	&& "$1" export -eu echo awk -eu echo grep && then | "$1" local
+		printf cd x=1 echo export grep done | x=1 -eu
+	"$@" "$@" echo ${HOME} && $(pwd) test echo && export local --verbose sed 'quoted text'
+readonly "$1" cd echo export readonly
+	-eu cd sed ${HOME} grep x=1 ${HOME} local readonly echo readonly export &&
+| 2>/dev/null echo --verbose local --verbose "$1" -eu /usr/bin awk
+		done --verbose "$@" "$@" /usr/bin $(pwd) sed printf -eu
+		--verbose 'quoted text' -eu | --verbose -eu /usr/bin -eu printf test
+printf echo awk 'quoted text'
+| 'quoted text' test readonly
+		test local then export sed test cd /usr/bin
+		x=1 test && "$@" 2>/dev/null x=1 'quoted text'
+	'quoted text' test 'quoted text' printf x=1 grep local -eu 2>/dev/null
+		echo grep done local export ${HOME} "$1" && cd export readonly "$@" grep $(pwd)
+	then test /usr/bin x=1 printf export
+	then done export grep
+		x=1 "$@" test /usr/bin done done awk cd test | x=1 echo
+		export /usr/bin $(pwd) 'quoted text'
+		--verbose printf /usr/bin readonly "$@" printf "$@"
+	| local $(pwd) /usr/bin grep printf local
+	then 2>/dev/null echo 2>/dev/null | echo cd readonly then /usr/bin $(pwd) done
+	-eu ${HOME} done grep x=1 readonly test /usr/bin
+$(pwd) grep then export cd ${HOME} 'quoted text'
+	/usr/bin 2>/dev/null "$1" 'quoted text'
+'quoted text' grep export echo
+		local export sed && printf "$1" ${HOME} --verbose grep
+printf /usr/bin --verbose cd awk echo 2>/dev/null
+	awk done | | -eu awk 2>/dev/null $(pwd)
+		local "$@" done then $(pwd) grep "$@" "$1" | awk test then x=1 sed
+		"$@" ${HOME} -eu then sed grep local ${HOME} x=1 | export x=1 && echo "$1"
+		2>/dev/null && x=1 $(pwd) local then sed
@@ -0,0 +1,2001 @@
+printf echo local 'quoted text' grep
+	--verbose grep 'quoted text' then awk grep
+	local sed echo awk | && -eu printf 2>/dev/null echo /usr/bin
+		echo test 'quoted text' printf echo local
+grep "$@" cd && | 2>/dev/null
+		readonly "$1" awk printf sed test test readonly echo printf
+	awk ${HOME} cd grep -eu ${HOME} sed | "$@" --verbose readonly local
+		"$1" --verbose -eu --verbose "$1"
+		-eu then x=1 /usr/bin "$1" test test
+		test "$1" $(pwd) awk then $(pwd) x=1 awk "$@" "$@" $(pwd) 'quoted text'
+	readonly x=1 $(pwd) && then --verbose
+		| done awk done --verbose /usr/bin "$@" | -eu --verbose /usr/bin
+	sed | && grep --verbose test echo local export "$1" -eu
+then test printf printf then "$@" done local
+${HOME} x=1 -eu awk 2>/dev/null "$1" export
+		echo /usr/bin echo awk then
+		export --verbose ${HOME}
+	-eu done awk "$1" ${HOME} echo local
+	'quoted text' -eu 'quoted text' ${HOME} -eu readonly
+		cd -eu grep done 'quoted text' | x=1 && then "$1" /usr/bin x=1 2>/dev/null
+	done sed "$@" cd echo then test $(pwd) | $(pwd) ${HOME} export
+		then --verbose | /usr/bin 2>/dev/null 2>/dev/null sed
+	local 'quoted text' ${HOME} ${HOME} "$@" ${HOME} local sed
+		awk awk printf done echo "$@" x=1 sed && cd
+		/usr/bin && export printf | /usr/bin $(pwd) ${HOME} x=1 "$@" /usr/bin
+	printf | then grep "$1" cd export cd | -eu then echo 2>/dev/null
+	export echo -eu /usr/bin /usr/bin ${HOME} local 2>/dev/null
+		test local readonly 2>/dev/null ${HOME} sed printf readonly done test
+	"$1" done awk local $(pwd) "$@"
+		"$1" ${HOME} echo local awk -eu
+		-eu 'quoted text' "$1" cd 2>/dev/null readonly printf echo 2>/dev/null
+	printf awk grep $(pwd) "$1" local readonly export local x=1 test 'quoted text'
+2>/dev/null sed cd printf
+		-eu "$1" --verbose ${HOME} then 'quoted text' done x=1 2>/dev/null export
+		${HOME} 'quoted text' ${HOME} "$@" && grep
+		| export | done "$@" -eu printf && export && $(pwd) readonly
+		sed /usr/bin $(pwd) $(pwd) | | awk "$1" $(pwd) ${HOME} local awk done && test
+	$(pwd) --verbose echo cd --verbose
+grep printf -eu "$@" export
+sed done done then grep export test -eu then awk done $(pwd)
+local test export "$1" local
+	echo "$@" readonly --verbose export "$@" test /usr/bin printf "$@" 'quoted text'
+'quoted text' then readonly grep x=1 -eu
+	"$1" | ${HOME} 2>/dev/null x=1 | /usr/bin
+printf 'quoted text' "$@" sed local local -eu 2>/dev/null ${HOME} ${HOME}
+		grep "$@" | ${HOME} --verbose | x=1 then done printf $(pwd)
+readonly echo $(pwd) 'quoted text' &&
+| $(pwd) local grep /usr/bin printf /usr/bin /usr/bin
+	"$@" /usr/bin 'quoted text' "$1" "$1" done done "$@" grep test ${HOME}
+'quoted text' | test /usr/bin echo grep export cd done --verbose ${HOME}
+		cd local local -eu |
+		echo then /usr/bin test 2>/dev/null grep && cd x=1 readonly $(pwd)
+		&& --verbose 'quoted text' sed grep "$1"
+		export "$1" "$@" echo done grep
+		--verbose x=1 sed ${HOME} x=1 then cd cd export
+		awk sed sed local && && --verbose then test export sed cd printf ${HOME} | --verbose
+	$(pwd) then grep done -eu /usr/bin export
+		"$@" --verbose cd echo 2>/dev/null
+export -eu 'quoted text' x=1 | --verbose 2>/dev/null
+readonly done "$1" "$1" "$@" done ${HOME} then 'quoted text' && grep export 2>/dev/null
+/usr/bin && $(pwd) awk "$1" -eu "$@" echo readonly
+	/usr/bin 2>/dev/null $(pwd) awk local readonly ${HOME} then cd done &&
+&& then echo cd -eu cd ${HOME} 2>/dev/null
+	--verbose local $(pwd) x=1 ${HOME} echo $(pwd)
+grep then test then /usr/bin
+	echo sed sed 2>/dev/null ${HOME} sed local readonly | readonly
+		echo printf /usr/bin done && test awk cd | 2>/dev/null
+		--verbose "$@" "$@" --verbose cd readonly echo "$1" ${HOME} ${HOME} /usr/bin $(pwd)
+	grep && /usr/bin 2>/dev/null done awk export
+	2>/dev/null awk awk 'quoted text'
+	&& local /usr/bin "$@" --verbose ${HOME} 2>/dev/null
+	2>/dev/null ${HOME} ${HOME} done "$@" grep cd /usr/bin
+/usr/bin $(pwd) grep sed test "$1" "$@" export "$@" -eu "$@" "$@" readonly
+${HOME} $(pwd) printf sed "$1" test | --verbose 'quoted text'
+	readonly export grep x=1 printf export cd 'quoted text' x=1 test
+cd /usr/bin echo ${HOME} then sed x=1 -eu /usr/bin
+		readonly "$@" then export ${HOME} echo readonly && "$1" 2>/dev/null
+		x=1 awk awk x=1 readonly "$@" cd 'quoted text' export x=1
+&& && readonly -eu printf
+		-eu grep cd -eu test then then grep "$1" 2>/dev/null | echo
+x=1 done /usr/bin ${HOME} echo echo local local
+then 2>/dev/null sed x=1 sed 'quoted text' printf
+export cd && "$@" $(pwd) $(pwd) test
+| | echo local echo && 'quoted text' $(pwd) | cd
+		2>/dev/null -eu $(pwd) 2>/dev/null sed "$@" 'quoted text'
+		'quoted text' -eu echo then then done echo /usr/bin --verbose --verbose "$1"
+test /usr/bin $(pwd) test "$@" readonly "$@" && printf
+readonly /usr/bin printf done done | grep | readonly local "$@" grep then
+	$(pwd) printf then && printf awk "$1" | then readonly
+	then x=1 x=1 x=1 sed $(pwd) export ${HOME} local cd local
+	test --verbose x=1 'quoted text' local /usr/bin --verbose export 'quoted text'
+done x=1 printf | x=1 | grep && local
+/usr/bin 2>/dev/null x=1 export
+	local echo cd x=1 x=1 2>/dev/null --verbose
+		local export 2>/dev/null | printf
+	done awk readonly test "$1" | && sed awk then awk grep export "$@" --verbose
+export echo local export | sed test /usr/bin
+	--verbose "$1" done ${HOME} awk sed
+sed done --verbose --verbose "$1" then --verbose
+		'quoted text' echo $(pwd) grep export && echo export done
+sed $(pwd) /usr/bin sed "$@" ${HOME} /usr/bin 2>/dev/null 'quoted text'
+		${HOME} | sed && cd 'quoted text' readonly 2>/dev/null "$@" grep -eu local echo
+grep readonly readonly sed --verbose sed -eu readonly
+	"$@" "$1" readonly --verbose printf cd x=1 readonly /usr/bin done test echo ${HOME}
+printf | sed 'quoted text' test 'quoted text' "$@" awk $(pwd) $(pwd) | done
+"$1" sed test readonly | --verbose x=1 printf readonly
+x=1 && -eu awk --verbose && test test then ${HOME} ${HOME} && ${HOME} test x=1
+&& echo sed then && "$1" x=1 cd /usr/bin --verbose ${HOME} $(pwd) export
+	test $(pwd) grep cd printf local -eu /usr/bin
+2>/dev/null $(pwd) "$@" printf x=1 $(pwd) ${HOME} then
+"$@" local readonly sed /usr/bin done echo then then then
+cd x=1 echo --verbose 'quoted text' 2>/dev/null | "$@" -eu /usr/bin
+		x=1 2>/dev/null then export
+	${HOME} test done -eu done test 'quoted text'
+	${HOME} cd export awk export readonly sed x=1 "$@" -eu "$@" export echo export
+	${HOME} x=1 | --verbose "$1" ${HOME} awk echo echo /usr/bin test -eu
+export awk export grep cd --verbose awk ${HOME}
+		awk ${HOME} then grep "$@" --verbose export /usr/bin 'quoted text' readonly $(pwd)
+	/usr/bin then $(pwd) && 'quoted text'
+		awk test x=1 echo grep /usr/bin 2>/dev/null
+		local export test local "$1" echo then local -eu cd "$1"
+	awk $(pwd) then sed $(pwd) local $(pwd) sed 2>/dev/null
+	test local "$@" sed ${HOME}
+$(pwd) export readonly 2>/dev/null --verbose -eu 'quoted text'
+		grep test readonly -eu x=1 cd local printf "$@" | grep then awk grep printf test
+		&& cd done readonly 'quoted text' 2>/dev/null
+local sed export 'quoted text' local 'quoted text' "$@" readonly echo printf
+	x=1 | 'quoted text' | && "$@" awk echo
+	then done --verbose test /usr/bin /usr/bin && grep then
+	| 2>/dev/null "$1" test x=1 grep "$1"
+cd "$@" $(pwd) then 'quoted text' sed $(pwd) sed cd
+export local 'quoted text' sed export /usr/bin "$@" x=1 awk 2>/dev/null
+		$(pwd) "$1" grep cd cd ${HOME} | x=1 readonly && /usr/bin readonly
+$(pwd) 'quoted text' then -eu test sed sed 'quoted text' | 'quoted text' test
+	cd ${HOME} cd done cd grep grep cd echo echo 'quoted text' && --verbose
+	$(pwd) && echo -eu cd --verbose "$@" sed && /usr/bin printf sed 2>/dev/null readonly
+		then done echo 2>/dev/null -eu ${HOME} echo 2>/dev/null export |
+	x=1 echo --verbose $(pwd)
+	then --verbose done printf "$1" 'quoted text' 2>/dev/null --verbose grep
+	grep ${HOME} done $(pwd) | ${HOME} export test test "$@" echo x=1 --verbose
+	"$1" echo cd done printf sed $(pwd) --verbose $(pwd) printf readonly
+		$(pwd) $(pwd) 'quoted text' sed awk
+		/usr/bin export readonly grep | x=1 $(pwd)
+cd readonly && /usr/bin done
+		sed grep $(pwd) "$1" --verbose
+	readonly export $(pwd) | done readonly /usr/bin | x=1 /usr/bin
+| grep readonly --verbose --verbose
+	--verbose printf sed cd && "$1" 2>/dev/null
+		awk && grep grep done $(pwd) x=1 done 2>/dev/null --verbose awk /usr/bin done
+${HOME} "$@" $(pwd) export $(pwd) sed "$1" cd $(pwd) sed $(pwd) sed
+${HOME} | /usr/bin "$1" local then grep
+$(pwd) done printf "$@" 2>/dev/null echo printf readonly awk | 'quoted text' done
+		&& | cd grep --verbose test $(pwd) -eu && $(pwd) readonly --verbose
+		awk cd 2>/dev/null -eu test "$@" awk done 2>/dev/null "$1" 'quoted text' export
+		test ${HOME} 'quoted text' printf 2>/dev/null /usr/bin printf
+		done "$@" readonly readonly 2>/dev/null local "$1" 2>/dev/null cd printf
+2>/dev/null 2>/dev/null export sed
+	/usr/bin sed cd 2>/dev/null
+		2>/dev/null ${HOME} grep ${HOME} x=1 test test awk done x=1 -eu grep done awk
+local printf x=1 /usr/bin
+		${HOME} done then 2>/dev/null readonly sed && local ${HOME} then
+	test ${HOME} $(pwd) /usr/bin
+		test x=1 "$1" readonly ${HOME} -eu 2>/dev/null "$@"
+	done test && test &&
+printf cd | cd $(pwd) printf ${HOME} 2>/dev/null export
+		"$@" export /usr/bin
+| export 'quoted text' "$1" echo --verbose | test sed && test local
+	&& readonly $(pwd) && "$1" then then 'quoted text' awk "$@" | $(pwd)
+	printf sed $(pwd) export readonly
+		/usr/bin /usr/bin /usr/bin
+/usr/bin done 'quoted text' printf && ${HOME}
+"$@" $(pwd) 'quoted text' x=1 then cd done "$1" sed $(pwd)
+printf grep | done x=1 export awk sed grep awk cd done local 'quoted text'
+		printf export --verbose then echo "$1" "$@" export grep "$1" grep echo local
+	export sed export 'quoted text' then "$1" readonly
+		local x=1 test "$@" "$1" ${HOME}
+		done 'quoted text' x=1 local
+		-eu --verbose "$@" | | grep sed
+| && ${HOME} then local printf sed printf grep "$@" "$1" readonly
+	-eu sed then && 2>/dev/null && | --verbose
+"$@" ${HOME} /usr/bin "$1" --verbose
+-eu $(pwd) -eu test 'quoted text' 2>/dev/null "$@" test | && 2>/dev/null
+--verbose "$1" export ${HOME}
+		printf export /usr/bin grep awk done "$1" echo export -eu ${HOME} done cd
+	local echo local "$@" local /usr/bin | "$@" done --verbose test echo "$@"
+	sed test --verbose grep | 2>/dev/null "$1" printf cd local "$1" "$@"
+		&& -eu -eu test ${HOME} export sed done awk "$1" export
+local && cd --verbose echo && 'quoted text' "$@"
+	done printf | sed "$1" echo x=1 'quoted text' printf "$@" printf --verbose ${HOME}
+$(pwd) printf then 'quoted text'
+		test x=1 "$1" --verbose sed $(pwd) | done export
+	readonly readonly 2>/dev/null ${HOME} ${HOME} sed export readonly printf
+		local | sed -eu ${HOME} echo local "$@" $(pwd) then -eu export grep
+'quoted text' echo /usr/bin awk awk --verbose
+	2>/dev/null printf sed -eu export then export | export cd --verbose x=1
+| grep done /usr/bin -eu "$1" grep done awk then grep
+		done --verbose x=1 --verbose grep 'quoted text' 'quoted text'
+	&& sed done then "$1" echo --verbose cd -eu
+	2>/dev/null && test 'quoted text' && ${HOME} x=1 local $(pwd) sed
+		/usr/bin printf done x=1
+--verbose ${HOME} && "$1"
+"$1" 2>/dev/null local x=1 -eu grep /usr/bin
+	$(pwd) done test --verbose 'quoted text' 'quoted text'
+then && "$@" "$@" done cd ${HOME}
+		export "$1" local done export local local /usr/bin
+		"$@" sed /usr/bin -eu export 'quoted text'
+	"$1" "$@" readonly export --verbose cd -eu cd
+	x=1 test ${HOME} done x=1 grep then x=1
+		&& 2>/dev/null echo awk local awk sed && readonly
+	$(pwd) done 2>/dev/null local printf sed
+	x=1 printf -eu grep x=1 done then -eu | test ${HOME} "$1" echo x=1 "$1"
+		grep readonly /usr/bin -eu then test "$@" cd grep
+		${HOME} cd readonly $(pwd) cd awk && $(pwd) x=1 sed printf
+'quoted text' $(pwd) readonly "$1" /usr/bin /usr/bin
+${HOME} && export printf awk ${HOME} && && /usr/bin -eu
+	readonly /usr/bin x=1 export $(pwd) "$@"
+		export awk test x=1 grep /usr/bin $(pwd) export
+		done awk printf printf --verbose awk sed
+		/usr/bin 'quoted text' cd local grep $(pwd) "$@" done $(pwd) x=1 echo 2>/dev/null
+		$(pwd) $(pwd) done /usr/bin -eu 'quoted text' test then
+printf "$1" printf "$1" awk then $(pwd) printf cd echo done
+		/usr/bin export 2>/dev/null $(pwd) /usr/bin local local readonly readonly
+&& "$@" readonly grep readonly grep --verbose local awk
+	awk "$@" ${HOME} done ${HOME} && echo 2>/dev/null done
+printf -eu cd "$@" x=1 echo /usr/bin local | test 2>/dev/null sed test test
+		readonly /usr/bin $(pwd) awk test ${HOME}
+	-eu echo local readonly /usr/bin /usr/bin
+echo x=1 cd ${HOME} local --verbose ${HOME} $(pwd)
+		done printf /usr/bin grep awk echo 2>/dev/null readonly "$@" sed && --verbose
+	"$@" "$@" $(pwd) export echo x=1 | 2>/dev/null
+		/usr/bin test test "$@" then --verbose
+	2>/dev/null test | readonly readonly cd printf 'quoted text' cd local /usr/bin
+		sed echo ${HOME} export "$@" 'quoted text'
+	| "$@" $(pwd) cd grep awk | 2>/dev/null 2>/dev/null readonly
+done done export "$@" "$1" sed --verbose then | sed --verbose printf grep "$@"
+'quoted text' --verbose --verbose x=1 echo ${HOME}
+	"$1" grep then printf echo x=1 printf --verbose --verbose
+	printf x=1 echo sed readonly
+&& readonly /usr/bin "$1" 2>/dev/null
+	-eu | done -eu printf /usr/bin && x=1 /usr/bin local | --verbose ${HOME} &&
+	test grep "$@" x=1 local readonly readonly grep local "$1" "$1" then
+'quoted text' --verbose -eu 'quoted text' 2>/dev/null &&
+		test | "$1" printf local && local then && export
+--verbose local /usr/bin | grep cd echo && 2>/dev/null
+grep $(pwd) done readonly 2>/dev/null grep then then /usr/bin export
+awk -eu "$1" sed grep grep cd test -eu
+	2>/dev/null awk test readonly then $(pwd) "$@" /usr/bin
+		sed local local "$@" $(pwd) 2>/dev/null printf export cd $(pwd) printf
+	grep 'quoted text' --verbose cd -eu 2>/dev/null awk | done $(pwd) "$1"
+grep grep readonly readonly local test -eu
+	then grep printf readonly x=1 export local $(pwd) export x=1 sed 2>/dev/null
+echo "$1" 2>/dev/null grep grep test 2>/dev/null ${HOME} "$@" grep grep cd awk
+		"$1" then $(pwd) | local
+| -eu x=1 test /usr/bin export --verbose grep grep
+	| done grep echo done readonly printf /usr/bin readonly sed printf $(pwd)
+then test | export local done /usr/bin
+	"$1" ${HOME} printf echo export awk -eu done test sed x=1 -eu
+	"$@" "$@" test local printf 'quoted text' export x=1 echo
+		&& awk awk printf then x=1 "$@" | $(pwd) | sed && cd | echo printf done "$1" then
+	--verbose $(pwd) x=1 readonly test test export grep done echo test
+$(pwd) done readonly 'quoted text' echo export && test "$@" test export "$@"
+done "$@" | --verbose && test && sed grep
+	2>/dev/null export -eu | export readonly done awk 'quoted text' ${HOME}
+		| 'quoted text' printf awk awk readonly sed local sed | &&
+--verbose --verbose --verbose
+--verbose grep 2>/dev/null "$@" ${HOME}
+printf printf /usr/bin
+		2>/dev/null done "$1" export | printf done sed "$@" && x=1
+		test && sed printf local -eu awk | cd echo $(pwd)
+		then printf export -eu
+		'quoted text' export grep done readonly printf 'quoted text'
+	local /usr/bin local sed local awk 2>/dev/null test && cd done ${HOME} test
+		${HOME} -eu ${HOME} printf ${HOME}
+	grep /usr/bin && local 2>/dev/null /usr/bin
+		sed -eu | done grep echo test | local
+	cd printf local 2>/dev/null "$@"
+'quoted text' && x=1 echo
+local 2>/dev/null x=1 'quoted text' grep then "$@" -eu "$@" grep /usr/bin
+	sed x=1 test --verbose readonly local then sed done x=1
+/usr/bin grep grep export /usr/bin printf
+		"$@" sed printf x=1 printf x=1 --verbose "$@" then export
+	"$@" && echo $(pwd) test sed | grep
+	$(pwd) 2>/dev/null awk printf awk 2>/dev/null
+printf ${HOME} 2>/dev/null readonly export
+		${HOME} $(pwd) "$@" 'quoted text' x=1 awk
+	then --verbose $(pwd) -eu readonly $(pwd) echo
+		"$1" done x=1 printf grep $(pwd) 2>/dev/null
+&& local cd | "$1" awk echo 2>/dev/null readonly "$@" echo 'quoted text'
+	done | printf echo --verbose done
+/usr/bin done then sed 'quoted text' grep "$1" awk /usr/bin printf readonly
+		readonly 2>/dev/null printf
+	${HOME} "$@" grep $(pwd) test sed printf printf export 2>/dev/null
+		awk readonly awk then && echo x=1 "$1" ${HOME} x=1 test $(pwd) | 'quoted text'
+	awk awk $(pwd) awk local
+--verbose ${HOME} ${HOME} test $(pwd) /usr/bin 2>/dev/null cd x=1 awk then
+	export done --verbose awk "$@"
+test "$@" --verbose printf "$@" then cd
+		cd "$1" echo "$1" /usr/bin echo && 2>/dev/null grep cd readonly echo
+"$@" $(pwd) test cd cd
+done export printf "$1" awk && sed "$1" 2>/dev/null x=1 printf
+		"$@" && "$1" | "$1" readonly echo done sed | ${HOME} -eu awk sed echo x=1 local
+done 'quoted text' --verbose x=1 "$1" && $(pwd)
+$(pwd) sed cd 'quoted text' --verbose
+	grep -eu local && readonly done ${HOME} ${HOME} $(pwd) readonly /usr/bin
+done x=1 && done -eu /usr/bin /usr/bin printf && "$1" grep
+x=1 cd --verbose && local
+		printf && "$1" printf then sed printf local x=1 then echo -eu export
+	awk /usr/bin printf "$1" 2>/dev/null
+awk awk awk ${HOME} 'quoted text' "$@"
+	"$1" local test "$1" | printf then | 2>/dev/null local readonly printf "$1"
+"$@" echo readonly 'quoted text'
+then 'quoted text' sed x=1 /usr/bin awk done | then grep "$1" "$1" awk -eu cd done
+echo "$@" local awk && ${HOME}
+	then /usr/bin /usr/bin 'quoted text' sed ${HOME} 'quoted text' --verbose
+local sed -eu 'quoted text'
+grep 2>/dev/null local $(pwd) ${HOME} then test && $(pwd) done echo -eu
+	export local done "$@" sed done $(pwd) 'quoted text'
+		sed "$1" --verbose local "$@" grep --verbose 2>/dev/null local grep
+| --verbose "$@" awk 'quoted text'
+grep 'quoted text' x=1 /usr/bin local
+		"$@" && sed --verbose $(pwd) /usr/bin test
+	echo awk done then --verbose test readonly export "$1" done
+		&& export x=1 /usr/bin
+	sed "$@" readonly done
+	-eu printf 'quoted text' awk grep && 2>/dev/null awk $(pwd) -eu cd /usr/bin
+	'quoted text' | printf readonly
+readonly ${HOME} test test readonly "$@" local readonly echo awk
+	-eu 'quoted text' "$@" && grep | cd done local "$1" readonly /usr/bin
+test printf done && /usr/bin readonly done ${HOME} export then done "$@" printf
+		"$@" cd done sed echo test done --verbose readonly
+		"$1" 2>/dev/null /usr/bin cd local done "$1" | /usr/bin 2>/dev/null
+| && | test test "$@"
+		echo test export readonly --verbose "$1" grep readonly
+		awk $(pwd) grep "$@" done test $(pwd)
+		cd echo -eu then 2>/dev/null
+		/usr/bin | 'quoted text' x=1 && grep -eu awk test "$@" done sed readonly "$@"
+cd "$@" printf ${HOME} -eu local done --verbose
+	done export ${HOME} then -eu --verbose export readonly | ${HOME} $(pwd)
+test && local export cd $(pwd) readonly "$1" then printf | echo $(pwd)
+	'quoted text' local | sed grep 2>/dev/null "$1" readonly export cd
+		&& $(pwd) | export local sed awk 2>/dev/null printf "$1" echo awk "$@" "$1"
+&& | readonly /usr/bin "$@" test
+echo sed | grep cd cd readonly "$@" cd test && 'quoted text' readonly
+		printf x=1 $(pwd) -eu done --verbose 2>/dev/null echo $(pwd) x=1 done -eu
+printf local printf cd cd /usr/bin local "$@" $(pwd) --verbose
+		'quoted text' /usr/bin 'quoted text'
+	echo echo /usr/bin awk grep sed sed $(pwd) then /usr/bin 'quoted text' awk
+'quoted text' test --verbose "$1" "$@" 'quoted text' cd printf export 2>/dev/null
+	local -eu /usr/bin $(pwd) printf echo cd "$@" awk sed
+		echo 'quoted text' "$1" "$@"
+		${HOME} "$1" done /usr/bin
+		| cd --verbose grep | test x=1 $(pwd) export export | export "$@"
+-eu $(pwd) | $(pwd) grep export $(pwd) 'quoted text' ${HOME}
+		'quoted text' done -eu "$1" x=1 readonly test local 2>/dev/null sed
+	done done | echo awk test 2>/dev/null then
+	readonly ${HOME} | && && 2>/dev/null awk 'quoted text' "$@" printf
+	then awk cd done -eu ${HOME} then
+"$1" local 'quoted text'
+	| test -eu readonly printf && 2>/dev/null test
+	awk sed 2>/dev/null x=1 'quoted text'
+export printf readonly cd test 2>/dev/null then readonly printf
+export x=1 test export -eu | && "$1" x=1 cd | done 'quoted text' /usr/bin | ${HOME}
+test ${HOME} && --verbose && && "$@" x=1 | 2>/dev/null
+-eu local done "$@" "$1" sed
+local ${HOME} test export readonly test "$@" awk "$1" done done then
+	-eu /usr/bin 2>/dev/null export x=1 && awk test /usr/bin 'quoted text' test
+"$1" printf $(pwd) echo awk printf then awk -eu
+		awk awk 2>/dev/null "$1" printf 'quoted text' done "$@" grep
+readonly cd sed grep "$@" cd export grep readonly
+sed 2>/dev/null test sed local 2>/dev/null printf x=1 test local -eu done
+echo test --verbose | then "$@" x=1 grep /usr/bin ${HOME} test "$1" echo --verbose
+x=1 grep --verbose | then 2>/dev/null && $(pwd) ${HOME}
+&& readonly 2>/dev/null export 'quoted text'
+		test then --verbose printf export
+		echo cd then cd done x=1 test echo then 'quoted text'
+2>/dev/null sed $(pwd) --verbose echo &&
+x=1 | && --verbose | local 2>/dev/null
+2>/dev/null 2>/dev/null done &&
+cd | then local "$1" 2>/dev/null
+		| ${HOME} done awk | && ${HOME} --verbose
+	2>/dev/null /usr/bin done readonly | "$1" readonly
+	| "$1" printf 2>/dev/null x=1 printf --verbose test x=1 awk local "$@"
+	"$@" done && && echo --verbose x=1 $(pwd) readonly awk export ${HOME} printf
+		local /usr/bin ${HOME} awk cd && "$@" $(pwd) printf printf local export
+x=1 "$1" echo local grep sed sed
+	export "$1" 'quoted text' sed then local ${HOME} && export readonly cd test
+export -eu ${HOME} export readonly sed local echo $(pwd) x=1 2>/dev/null
+		printf readonly && local local $(pwd) then
+		${HOME} cd --verbose printf sed readonly /usr/bin echo "$@" &&
+	readonly ${HOME} awk echo done readonly printf | 'quoted text' local "$1" awk
+		cd then 'quoted text' ${HOME} --verbose /usr/bin
+		2>/dev/null && 2>/dev/null | export ${HOME}
+grep then awk printf cd "$@" "$1" "$@"
+	${HOME} "$@" sed local test
+	$(pwd) --verbose export -eu ${HOME} awk done 2>/dev/null "$@" done then awk "$@"
+		local local -eu readonly local ${HOME}
+	local --verbose done export printf x=1 export "$1" ${HOME} test
+		&& export -eu "$@" then then echo
+	$(pwd) echo export sed cd test 2>/dev/null test
+	x=1 2>/dev/null sed | then local cd ${HOME}
+	&& 'quoted text' echo done readonly "$@" $(pwd)
+		-eu ${HOME} x=1 export readonly ${HOME} export
+	$(pwd) printf $(pwd) grep local "$@" | -eu cd | then | test
+		echo && export -eu 'quoted text' | -eu local | echo export 2>/dev/null $(pwd)
+awk "$1" test ${HOME} /usr/bin awk 2>/dev/null "$@" local -eu /usr/bin --verbose
+		echo grep local export /usr/bin "$@" echo
+	cd done cd done awk readonly --verbose
+"$@" sed -eu ${HOME} "$@" "$1" -eu /usr/bin export
+	-eu test --verbose /usr/bin -eu --verbose $(pwd) awk sed local printf
+grep awk test local local -eu test
+		'quoted text' test awk /usr/bin echo
+	'quoted text' echo awk local -eu cd test echo then ${HOME}
+cd -eu export sed then echo local /usr/bin $(pwd) printf readonly /usr/bin
+export awk --verbose x=1 test then
+grep -eu then cd cd readonly --verbose | "$1" && && printf
+	then grep echo done --verbose test grep && local
+		export 'quoted text' export awk then | $(pwd) printf
+		--verbose && 2>/dev/null && then
+		sed -eu awk local | "$1" /usr/bin
+		"$@" | grep echo export 2>/dev/null done "$1"
+	$(pwd) readonly export | awk 'quoted text' "$@" local
+| then awk sed /usr/bin ${HOME} done done -eu sed test ${HOME}
+		readonly --verbose awk export sed 'quoted text' "$@" awk ${HOME}
+/usr/bin cd then "$@" | -eu echo
+	${HOME} 'quoted text' awk test 'quoted text'
+		local | $(pwd) /usr/bin cd test sed 2>/dev/null awk 2>/dev/null "$@" test test
+&& printf grep printf $(pwd)
+	done | /usr/bin x=1 'quoted text' grep readonly
+	awk | | && x=1 x=1 $(pwd) test 2>/dev/null
+	done ${HOME} printf "$@" done
+		awk ${HOME} "$@" awk local 'quoted text' -eu x=1 then then | $(pwd)
+		--verbose --verbose cd grep -eu && /usr/bin printf cd done
+		sed done ${HOME} local 2>/dev/null export echo | then ${HOME}
+		export grep test printf $(pwd) echo sed && -eu done cd $(pwd) done
+	-eu $(pwd) cd sed export sed cd -eu readonly -eu grep "$1" grep readonly
+		awk -eu $(pwd) export
+		"$1" --verbose then test readonly local --verbose then
+	"$1" grep local -eu 2>/dev/null echo
+	--verbose cd "$@" /usr/bin ${HOME} sed && && then printf
+${HOME} test readonly ${HOME} ${HOME} "$1" sed -eu
+	x=1 local sed readonly 2>/dev/null /usr/bin && | then "$1" cd --verbose
+	--verbose sed "$@" 'quoted text' awk awk grep sed ${HOME} printf echo
+done test echo done -eu local "$1" done sed done done /usr/bin "$@"
+	export $(pwd) test printf test local --verbose done "$@" grep --verbose test "$1"
+	done -eu 'quoted text' "$1" 2>/dev/null test done cd test printf sed then "$1"
+printf then | done done sed 2>/dev/null
+2>/dev/null "$@" x=1 "$@" echo printf test printf export -eu "$@" ${HOME} -eu
+'quoted text' local | | awk ${HOME} sed local "$@" cd $(pwd) cd -eu test
+		readonly ${HOME} 'quoted text' -eu cd sed x=1
+awk test -eu "$@" "$1" -eu echo /usr/bin grep "$1" 'quoted text' -eu "$1" grep
+sed -eu local x=1 /usr/bin "$@" printf ${HOME}
+	"$1" $(pwd) echo test then
+		${HOME} grep 'quoted text' x=1 done 'quoted text'
+	-eu cd echo 2>/dev/null local then 'quoted text' -eu | $(pwd) 2>/dev/null
+		test 2>/dev/null | x=1 done sed then -eu cd --verbose
+cd | local done | sed done $(pwd) /usr/bin
+-eu readonly "$@" done | cd "$1" echo test test then ${HOME} ${HOME}
+${HOME} ${HOME} && done printf local | sed $(pwd) printf cd export "$1"
+readonly "$@" awk grep awk "$@" readonly $(pwd) cd sed then --verbose
+	cd 'quoted text' 2>/dev/null printf -eu
+	'quoted text' done sed done $(pwd) readonly $(pwd) cd
+		sed sed awk then && 'quoted text' ${HOME} grep 'quoted text'
+		readonly --verbose grep && test cd 'quoted text' 'quoted text' $(pwd) test
+		echo $(pwd) 'quoted text' --verbose local $(pwd) printf sed local
+printf printf x=1 "$1" | "$@" done readonly /usr/bin
+export -eu readonly 'quoted text'
+	export ${HOME} && 2>/dev/null readonly /usr/bin done /usr/bin test export -eu readonly
+		${HOME} $(pwd) 2>/dev/null $(pwd) export printf && sed printf
+		/usr/bin | $(pwd) | test x=1 ${HOME}
+"$1" awk awk 2>/dev/null readonly && printf echo then done grep test 'quoted text'
+2>/dev/null cd test /usr/bin && test 'quoted text' local export
+x=1 echo -eu "$1" ${HOME} -eu "$1" echo --verbose
+		2>/dev/null done /usr/bin export
+	echo local readonly printf sed "$1" $(pwd) "$1" && test "$1" x=1 && done then
+	local 2>/dev/null | 2>/dev/null 'quoted text'
+	local cd x=1 local local && /usr/bin -eu readonly cd echo $(pwd) && 2>/dev/null
+	'quoted text' cd printf | test readonly printf done ${HOME}
+		local echo /usr/bin "$1" "$@" "$@" grep echo local printf -eu test grep 'quoted text'
+sed $(pwd) "$1" grep cd --verbose printf sed "$@" /usr/bin grep awk
+		-eu "$1" cd --verbose readonly
+	${HOME} then awk $(pwd) -eu "$@" echo && export done test
+		-eu 'quoted text' readonly | x=1 -eu readonly cd "$@" local readonly
+	-eu awk $(pwd) 2>/dev/null /usr/bin
+	readonly done $(pwd) then $(pwd) --verbose /usr/bin then printf export /usr/bin
+sed x=1 local sed grep "$1" done | && x=1 && done echo 'quoted text'
+'quoted text' --verbose "$1" 'quoted text' x=1 readonly -eu echo printf
+| && grep export export ${HOME} local grep "$1" awk
+		&& "$@" && cd /usr/bin
+"$@" cd readonly -eu cd ${HOME} 'quoted text'
+		sed readonly grep readonly
+	'quoted text' && ${HOME} sed | cd grep --verbose | test -eu done x=1
+	/usr/bin x=1 "$@" && --verbose readonly 'quoted text' /usr/bin export test grep
+${HOME} export local | done grep done | "$@" /usr/bin x=1 | && "$@" readonly
+	| cd && grep local echo
+'quoted text' then | $(pwd) "$1" then cd
+	"$1" sed x=1 --verbose readonly printf 'quoted text' readonly
+	2>/dev/null printf | grep done then | 'quoted text' echo awk then sed | done
+	echo test sed printf "$@" "$@"
+	| then echo $(pwd) local && readonly 'quoted text' readonly
+	readonly -eu -eu --verbose 'quoted text'
+		sed && | then sed /usr/bin sed ${HOME} | export then 2>/dev/null readonly
+"$1" test "$@" | sed local
+		x=1 awk grep | "$1" awk test "$@" -eu then --verbose
+	&& ${HOME} --verbose awk readonly $(pwd) x=1 /usr/bin echo then printf
+&& echo 2>/dev/null export /usr/bin sed awk | x=1 export
+"$1" awk | x=1 awk "$@" then /usr/bin readonly ${HOME} cd 2>/dev/null
+echo printf done --verbose readonly $(pwd) grep "$1" test readonly grep
+		cd local then 'quoted text'
+	/usr/bin done sed local local "$@" export -eu ${HOME}
+done readonly | | && then readonly | /usr/bin x=1 $(pwd)
+		$(pwd) awk sed sed sed awk ${HOME}
+	-eu $(pwd) printf cd /usr/bin -eu "$@" cd 'quoted text' |
+	&& sed "$@" ${HOME} echo local | 'quoted text'
+	&& done x=1 "$1" grep /usr/bin ${HOME}
+	readonly $(pwd) awk readonly readonly
+		local -eu sed export "$1" "$@" $(pwd) test printf cd ${HOME} -eu "$1" ${HOME} then
+		"$@" done $(pwd) -eu -eu
+	x=1 grep awk && | printf 'quoted text' $(pwd) echo echo sed 'quoted text'
+		| sed $(pwd) "$@" $(pwd) | done test test "$1" echo done -eu "$1"
+done local | local local
+	printf x=1 readonly | $(pwd)
+	done "$1" awk x=1 -eu grep "$1" && echo | x=1 sed $(pwd) printf
+		"$1" && "$@" | 'quoted text' sed
+	done ${HOME} awk readonly
+	-eu 'quoted text' ${HOME} x=1 done $(pwd)
+	--verbose --verbose | echo "$@" $(pwd) sed 2>/dev/null x=1
+		-eu then x=1 "$@" export export export -eu -eu 2>/dev/null done /usr/bin
+	$(pwd) 2>/dev/null export && test readonly 2>/dev/null && sed then local
+readonly -eu export | x=1 test
+-eu x=1 local 'quoted text' x=1 sed awk 'quoted text'
+echo x=1 x=1 'quoted text'
+		&& awk && test export test 'quoted text'
+	awk export 2>/dev/null "$@" && readonly awk export -eu
+	local local "$@" echo readonly "$@"
+'quoted text' export echo "$1" -eu "$1" ${HOME}
+then grep echo then cd awk printf awk 'quoted text' sed echo
+cd grep readonly then
+	${HOME} x=1 --verbose local 2>/dev/null "$1" 'quoted text' --verbose $(pwd)
+| awk 2>/dev/null grep 2>/dev/null
+--verbose readonly && 2>/dev/null then local then x=1
+		"$1" | && "$@" /usr/bin echo
+		${HOME} "$@" local awk
+echo test test export x=1 /usr/bin 2>/dev/null ${HOME} $(pwd)
+awk sed /usr/bin && awk done
+	| "$@" test printf echo x=1 then x=1 sed
+-eu | test x=1 then printf
+		export -eu cd ${HOME} local 'quoted text'
+	local -eu 2>/dev/null grep ${HOME} 'quoted text' printf $(pwd) echo -eu
+done $(pwd) x=1 "$@" export local /usr/bin "$@" 2>/dev/null "$1" "$1"
+	'quoted text' x=1 /usr/bin | "$1" sed sed done $(pwd) cd -eu test
+/usr/bin $(pwd) test | 2>/dev/null
+	'quoted text' then printf echo x=1 awk printf readonly
+test --verbose "$1" sed sed readonly "$1" grep sed readonly -eu cd 2>/dev/null
+		export x=1 -eu then awk awk ${HOME} && && awk "$@" awk
+		test "$1" then test && /usr/bin cd | local "$1"
+	| /usr/bin export test 'quoted text' 'quoted text'
+	test awk --verbose done readonly && export --verbose
+		2>/dev/null awk export
+	&& printf echo -eu $(pwd) x=1 echo -eu "$1"
+/usr/bin done grep x=1 --verbose x=1 awk local cd
+x=1 "$@" && | 2>/dev/null -eu x=1 test | test awk test /usr/bin
+		cd sed cd awk then grep awk x=1 -eu cd printf
+local cd printf echo then cd printf grep
+		printf -eu -eu 'quoted text' readonly
+	test "$@" 2>/dev/null
+		test local x=1 /usr/bin /usr/bin /usr/bin
+	-eu 2>/dev/null ${HOME} test /usr/bin printf awk readonly /usr/bin x=1
+${HOME} | done && "$1" then printf 'quoted text' printf
+	"$1" | test test /usr/bin 'quoted text' | 2>/dev/null
+		| && 'quoted text' then 2>/dev/null sed then grep
+export 'quoted text' x=1 done "$1" 2>/dev/null
+local x=1 test | readonly | 2>/dev/null
+		echo printf 'quoted text' /usr/bin --verbose
+test ${HOME} 2>/dev/null test test -eu /usr/bin "$1"
+export -eu && awk ${HOME} readonly grep awk test
+		done sed export cd $(pwd) test test && grep grep "$1" done readonly
+--verbose printf && awk sed test -eu --verbose awk "$@"
+		sed 'quoted text' "$@" "$@" then done | 'quoted text' /usr/bin echo && 2>/dev/null
+--verbose /usr/bin then --verbose
+	awk -eu /usr/bin x=1 echo test 'quoted text' 2>/dev/null printf /usr/bin
+		cd "$1" -eu "$1" then ${HOME} sed echo echo grep export 2>/dev/null
+	printf --verbose 2>/dev/null "$@" ${HOME} "$1" done "$@"
+	'quoted text' then test --verbose awk then awk $(pwd)
+	x=1 -eu grep done echo 2>/dev/null local cd echo "$1" 2>/dev/null test x=1
+		sed -eu && /usr/bin echo awk printf grep && $(pwd) sed && | &&
+		readonly $(pwd) cd x=1 printf ${HOME} export done "$1" printf
+		-eu awk "$@" awk sed | sed
+		echo 2>/dev/null ${HOME} ${HOME} $(pwd)
+	&& grep | $(pwd) "$@" printf "$@" 2>/dev/null awk cd local done then export
+		"$1" -eu cd ${HOME} awk awk /usr/bin -eu 'quoted text' /usr/bin
+		awk export x=1 | cd 2>/dev/null "$1" local 'quoted text' --verbose -eu export
+		cd -eu local sed $(pwd) awk cd awk test
+		cd printf grep then 2>/dev/null x=1 "$@" awk ${HOME} && readonly
+	${HOME} export awk /usr/bin test | -eu local awk /usr/bin "$@" done "$@" "$1"
+done awk export done /usr/bin 'quoted text' --verbose printf 'quoted text'
+		${HOME} ${HOME} 'quoted text' | x=1 -eu | done cd x=1 printf ${HOME} /usr/bin
+		export grep test /usr/bin local
+		cd ${HOME} /usr/bin then printf ${HOME} 2>/dev/null
+grep grep export echo awk $(pwd) sed 2>/dev/null "$1" "$1" "$@"
+'quoted text' then printf test grep "$1" awk 'quoted text' printf test --verbose
+		local $(pwd) /usr/bin printf export printf grep readonly ${HOME} then echo
+		x=1 echo printf local grep local local
+	"$1" awk -eu $(pwd) grep "$1" -eu printf awk
+	cd /usr/bin && "$1" sed
+	'quoted text' awk sed 'quoted text' x=1 test cd grep && "$1"
+cd 2>/dev/null done then readonly
+		printf done done local awk 'quoted text' 'quoted text' awk readonly 'quoted text'
+-eu ${HOME} done && && $(pwd) test sed 'quoted text'
+/usr/bin ${HOME} | test cd grep
+	&& cd 'quoted text' test ${HOME}
+${HOME} $(pwd) printf x=1 --verbose test
+		${HOME} export echo x=1 printf then readonly then awk grep local sed awk cd "$@"
+	sed echo && "$@" awk &&
+		export /usr/bin 2>/dev/null
+		cd -eu "$1" export printf local 'quoted text' grep echo
+echo done /usr/bin x=1 -eu -eu
+	grep -eu $(pwd) --verbose grep then $(pwd) $(pwd) 'quoted text'
+	'quoted text' test grep local echo awk then
+-eu ${HOME} then ${HOME} x=1 readonly readonly
+${HOME} /usr/bin ${HOME} /usr/bin 2>/dev/null
+test "$1" x=1 done | export "$1" --verbose "$@"
+	echo export cd "$1" 2>/dev/null readonly local awk readonly
+done -eu && "$1" then /usr/bin $(pwd) awk | "$@" $(pwd) test readonly
+	printf | grep ${HOME} cd export grep /usr/bin printf cd done ${HOME} && --verbose
+	echo test -eu ${HOME} sed cd 2>/dev/null
+	$(pwd) -eu done ${HOME} /usr/bin /usr/bin
+		| then "$1" ${HOME} 'quoted text' 2>/dev/null x=1 awk echo $(pwd) done
+/usr/bin x=1 "$@" $(pwd) echo |
+		"$1" x=1 'quoted text' done | -eu ${HOME} && cd awk done | ${HOME} cd -eu
+		local sed awk --verbose readonly done "$@" x=1 awk "$@" printf done export
+	then "$@" cd --verbose ${HOME} export
+sed test cd "$@" sed sed /usr/bin $(pwd) cd
+	-eu "$1" then -eu ${HOME} echo 2>/dev/null
+	cd awk -eu && grep 'quoted text' --verbose x=1 awk test then printf
+sed --verbose --verbose x=1 --verbose test 'quoted text' done export
+	/usr/bin --verbose x=1 printf "$1" x=1 echo test readonly
+		then ${HOME} "$1" ${HOME} /usr/bin
+	printf local test test | 'quoted text' 'quoted text'
+"$@" $(pwd) export && then sed && local -eu then local echo --verbose
+	'quoted text' export | "$@" && "$1" export x=1 awk 2>/dev/null
+	awk "$1" 'quoted text' && 2>/dev/null sed x=1 export "$1" readonly $(pwd) ${HOME}
+local ${HOME} | ${HOME} && grep -eu sed test sed test then
+	/usr/bin test done && readonly echo "$@"
+	'quoted text' local "$1" /usr/bin done 2>/dev/null echo /usr/bin /usr/bin
+	grep sed --verbose printf grep 2>/dev/null x=1
+	${HOME} awk readonly then cd test
+		test "$1" x=1 x=1 ${HOME} -eu && done -eu cd printf "$1" /usr/bin 'quoted text'
+"$1" test "$1" --verbose then x=1
+export then $(pwd) echo "$1" sed then | 'quoted text'
+		grep 2>/dev/null 2>/dev/null then sed done readonly ${HOME}
+export test export printf grep /usr/bin 'quoted text' $(pwd)
+		test cd test test && test printf --verbose
+		sed && printf grep x=1
+	-eu x=1 'quoted text' echo echo readonly test local /usr/bin --verbose
+		sed cd "$@" "$@" done -eu echo cd | printf x=1 echo
+--verbose | cd /usr/bin x=1 | local 'quoted text' | export test
+/usr/bin --verbose |
+	awk ${HOME} grep $(pwd) 2>/dev/null
+	printf "$@" /usr/bin cd -eu export "$1" done && 'quoted text'
+local x=1 && test --verbose cd cd "$1" awk | echo 'quoted text'
+	cd "$@" local -eu --verbose x=1 cd --verbose local
+echo echo sed export awk
+		"$1" sed 2>/dev/null local 'quoted text' done --verbose "$1" sed awk 2>/dev/null
+		"$@" "$1" local x=1 sed cd readonly grep && printf done
+echo $(pwd) echo "$@" | 'quoted text' printf grep 2>/dev/null "$1"
+		test done printf done "$1" /usr/bin done "$1"
+/usr/bin x=1 "$@" --verbose
+		grep readonly awk && x=1 "$@" 'quoted text'
+	/usr/bin x=1 'quoted text' "$1" sed /usr/bin ${HOME} 'quoted text' "$@" x=1
+		echo -eu && -eu done ${HOME} test awk 'quoted text' $(pwd) echo "$1"
+		-eu | | local test ${HOME} "$1" local local done
+'quoted text' $(pwd) && test printf ${HOME} 2>/dev/null 2>/dev/null
+	sed | --verbose 2>/dev/null grep $(pwd)
+	"$@" echo --verbose x=1 export /usr/bin then echo grep --verbose /usr/bin
+	echo test sed local | "$@" grep done -eu grep then ${HOME}
+readonly ${HOME} "$1" export awk export
+	sed readonly 'quoted text' sed --verbose $(pwd)
+	done --verbose "$@" | sed echo then sed 'quoted text'
+		local done 'quoted text'
+	2>/dev/null ${HOME} -eu
+	$(pwd) | $(pwd) --verbose export --verbose local ${HOME} test "$@" grep
+		"$1" echo ${HOME} then readonly ${HOME} ${HOME}
+	cd --verbose ${HOME} awk printf "$@" && && then 2>/dev/null done
+	printf echo 2>/dev/null awk then x=1 "$@" "$@" /usr/bin
+cd x=1 readonly printf x=1 'quoted text' "$@" 2>/dev/null --verbose grep done
+	awk && "$@" | && | sed sed 'quoted text' grep 2>/dev/null
+--verbose 'quoted text' export "$1" sed 2>/dev/null done echo sed 'quoted text'
+&& -eu $(pwd) ${HOME} "$1" printf $(pwd) --verbose readonly test
+	readonly grep grep ${HOME}
+	awk then cd x=1 -eu /usr/bin && grep -eu -eu 'quoted text' && done printf printf
+		x=1 ${HOME} export sed awk 2>/dev/null &&
+	$(pwd) -eu awk ${HOME} sed awk done export 2>/dev/null --verbose -eu
+&& grep "$@" x=1 grep x=1 |
+		/usr/bin local && /usr/bin 2>/dev/null $(pwd) && then printf 2>/dev/null -eu local
+	awk cd /usr/bin echo 2>/dev/null awk ${HOME}
+2>/dev/null "$1" 'quoted text' cd --verbose
+${HOME} | done test export sed ${HOME} sed 'quoted text' --verbose
+export ${HOME} "$@" awk 'quoted text' x=1 export grep x=1 && $(pwd) then -eu $(pwd)
+readonly && 'quoted text' | readonly
+/usr/bin ${HOME} readonly readonly awk
+		2>/dev/null --verbose sed "$@" | grep &&
+	-eu && "$1" --verbose 2>/dev/null
+	/usr/bin done "$@" then "$1" sed | -eu grep "$@" && ${HOME}
+	local readonly then then 'quoted text'
+	'quoted text' /usr/bin cd echo echo awk x=1 then &&
+${HOME} --verbose 'quoted text' "$1" "$@" readonly echo
+		/usr/bin x=1 && export --verbose awk grep readonly
+	/usr/bin -eu cd test "$@" grep then export ${HOME} $(pwd) test
+2>/dev/null -eu "$1" --verbose done cd printf test $(pwd)
+${HOME} "$@" -eu export /usr/bin -eu local 2>/dev/null printf then && "$@" awk
+		-eu grep 'quoted text' test /usr/bin
+		"$1" test --verbose ${HOME} then "$1" echo ${HOME} /usr/bin printf export
+	cd x=1 readonly sed awk |
+2>/dev/null grep export done printf | "$@" readonly x=1 x=1 test
+		readonly && grep then grep /usr/bin cd 'quoted text' echo
+	"$1" done | -eu /usr/bin cd "$@" readonly done export
+	${HOME} "$@" "$@" echo 2>/dev/null then /usr/bin printf x=1
+		then echo then done sed $(pwd) sed readonly --verbose && 2>/dev/null awk local
+		"$1" readonly ${HOME} /usr/bin local /usr/bin 2>/dev/null
+		2>/dev/null && 'quoted text' && done done $(pwd) -eu --verbose 2>/dev/null
+		readonly export 2>/dev/null ${HOME}
+	done grep sed x=1 2>/dev/null 'quoted text' x=1 cd
+	awk test $(pwd) local done | sed cd export sed test | test
+		${HOME} | -eu x=1 then --verbose grep
+grep readonly test cd grep printf
+	x=1 awk | sed --verbose
+	awk x=1 test -eu $(pwd) "$1" cd then 2>/dev/null $(pwd) && echo $(pwd) ${HOME}
+	done 2>/dev/null echo export grep -eu export
+	2>/dev/null local $(pwd) | ${HOME} grep | | --verbose export readonly | "$1"
+--verbose "$1" /usr/bin && | && /usr/bin readonly
+	test "$1" done awk sed export "$1" x=1 test | awk && | --verbose then
+	x=1 awk grep sed printf | export --verbose --verbose echo --verbose
+	/usr/bin then local test 2>/dev/null "$@" export readonly $(pwd) printf
+export "$@" "$@" 2>/dev/null awk test ${HOME}
+'quoted text' x=1 test cd printf awk 2>/dev/null done /usr/bin
+"$1" test test then && echo
+done echo && "$@" echo done export /usr/bin awk --verbose sed printf printf
+echo 2>/dev/null readonly ${HOME} test local done 'quoted text'
+	'quoted text' /usr/bin "$@" --verbose -eu done 2>/dev/null sed 2>/dev/null
+	awk | x=1 ${HOME} $(pwd) grep ${HOME} "$@" "$@" grep local "$1"
+$(pwd) --verbose awk sed echo $(pwd) /usr/bin echo 'quoted text'
+${HOME} && readonly | x=1 echo ${HOME} cd ${HOME} grep echo /usr/bin
+| awk local $(pwd) /usr/bin grep export export awk then test | $(pwd) --verbose
+		done cd --verbose grep ${HOME} then echo test readonly $(pwd)
+	grep test $(pwd) 'quoted text' done export local export cd /usr/bin readonly
+/usr/bin ${HOME} readonly 2>/dev/null x=1 cd --verbose grep | "$@"
+sed ${HOME} /usr/bin local
+	x=1 cd -eu --verbose | done $(pwd)
+		-eu 2>/dev/null 'quoted text' ${HOME} test export
+	export sed local export export
+$(pwd) cd readonly x=1 export | "$1"
+	&& sed 'quoted text' cd echo "$1" sed sed 'quoted text'
+&& x=1 echo done ${HOME} &&
+		test ${HOME} readonly local
+	local /usr/bin cd ${HOME} printf printf "$1" sed $(pwd) readonly "$@"
+| sed awk readonly then /usr/bin
+	export local --verbose "$@" printf test readonly done "$1" printf 2>/dev/null
+done export 2>/dev/null sed -eu x=1 "$@" grep 2>/dev/null
+&& && 2>/dev/null x=1 then awk local 2>/dev/null $(pwd) local cd
+		awk export | /usr/bin /usr/bin ${HOME} sed
+	| sed "$@" "$@" cd done cd
+cd "$@" local x=1 readonly && "$1" test -eu
+	grep then awk local test then cd "$1" sed
+	'quoted text' && done local
+cd "$1" -eu "$@" cd ${HOME} readonly export sed then x=1 test printf
+		--verbose sed 'quoted text' ${HOME} "$@" export
+		echo | export echo test cd cd "$@" grep
+		sed 2>/dev/null done && | sed awk done
+		--verbose readonly && "$@" export local
+		export sed export "$1" grep --verbose sed | grep x=1 awk 2>/dev/null ${HOME}
+		sed $(pwd) test local sed export awk cd local /usr/bin done echo "$1" 'quoted text'
+awk ${HOME} x=1 | | readonly 'quoted text' then echo --verbose
+		$(pwd) done --verbose readonly then x=1 export
+'quoted text' ${HOME} local && export --verbose
+	local $(pwd) echo cd sed 'quoted text' export grep readonly readonly
+	sed --verbose "$@" test grep export "$@" done $(pwd) local test echo sed
+awk "$1" x=1 "$@" "$1" test grep
+readonly export --verbose -eu -eu 'quoted text' && grep
+	-eu && done readonly "$@" then test x=1 echo -eu cd cd
+/usr/bin cd awk 2>/dev/null
+	/usr/bin readonly ${HOME} --verbose
+		readonly readonly export -eu /usr/bin
+&& ${HOME} readonly /usr/bin sed /usr/bin
+		then 'quoted text' "$@" --verbose awk && "$1" readonly x=1 'quoted text'
+		'quoted text' && | printf -eu /usr/bin cd printf | 'quoted text' -eu done -eu
+		"$1" ${HOME} sed /usr/bin
+	--verbose ${HOME} $(pwd) done 'quoted text'
+	| | sed printf readonly
+		then then -eu test grep test $(pwd) then | $(pwd) printf --verbose |
+2>/dev/null && sed -eu /usr/bin readonly readonly
+		-eu /usr/bin && 'quoted text' printf test |
+		${HOME} sed grep | printf "$@" $(pwd) $(pwd) /usr/bin
+		'quoted text' done 2>/dev/null "$1" sed awk awk sed
+then awk done local /usr/bin x=1 test sed awk done
+cd local done sed readonly awk /usr/bin && "$@" sed -eu -eu
+	2>/dev/null test local x=1 done
+	${HOME} done awk 2>/dev/null ${HOME}
+-eu $(pwd) | /usr/bin export done then 2>/dev/null -eu cd awk grep "$@" done
+	"$1" export 'quoted text' "$@" then
+2>/dev/null export awk
+	sed ${HOME} test printf echo 'quoted text'
+readonly local "$@" | "$1" grep
+${HOME} printf echo && -eu done sed && grep | test
+		"$1" --verbose sed readonly
+	${HOME} | printf done && cd 2>/dev/null readonly local local x=1 x=1
+sed ${HOME} "$1" /usr/bin awk cd 2>/dev/null 'quoted text'
+		${HOME} export printf done && $(pwd)
+"$@" readonly done done
+		2>/dev/null awk && export printf cd readonly cd local done test sed
+	awk sed echo then awk sed printf -eu -eu sed readonly -eu echo grep awk 'quoted text'
+	done x=1 && 2>/dev/null echo 2>/dev/null
+readonly && export test | cd echo 'quoted text' grep ${HOME} 'quoted text' cd
+	test $(pwd) sed readonly && cd /usr/bin && echo "$@" done test && "$@"
+	grep "$1" then $(pwd) && "$@" && printf $(pwd) readonly test cd ${HOME} test
+		2>/dev/null | cd /usr/bin echo
+		--verbose then x=1 printf done --verbose
+	| /usr/bin | awk sed printf sed
+		cd -eu sed readonly $(pwd) printf 2>/dev/null "$@"
+-eu "$1" then ${HOME} "$@" ${HOME} grep printf test | 'quoted text'
+export export local ${HOME} x=1 && done local /usr/bin
+	export -eu | /usr/bin
+		export 2>/dev/null 'quoted text' export awk done -eu --verbose x=1 sed
+	&& sed cd cd 'quoted text' $(pwd) then | "$1" echo readonly -eu && ${HOME}
+		awk $(pwd) && ${HOME} export && "$@" test
+grep readonly cd sed printf "$@"
+/usr/bin printf ${HOME} export 2>/dev/null sed && 'quoted text' done 'quoted text'
+		x=1 "$@" ${HOME} readonly
+	export grep -eu 2>/dev/null /usr/bin && /usr/bin export grep
+		readonly $(pwd) /usr/bin sed
+export grep -eu ${HOME} awk | "$1" "$@" 'quoted text' /usr/bin /usr/bin cd &&
+&& test "$@" 2>/dev/null done printf printf export ${HOME} -eu --verbose
+2>/dev/null echo 'quoted text'
+| awk | && done 'quoted text'
+--verbose awk cd $(pwd) "$@" -eu "$1" then grep awk echo --verbose
+		sed export awk local -eu ${HOME} cd "$1" | "$1" printf
+${HOME} awk readonly | export sed sed 2>/dev/null sed
+	"$@" | printf 2>/dev/null sed cd 'quoted text'
+		$(pwd) then printf grep ${HOME} grep --verbose test printf
+		-eu done "$1" sed then $(pwd) printf x=1 cd | /usr/bin awk
+readonly | $(pwd) printf
+| /usr/bin echo x=1 grep test cd 2>/dev/null cd done ${HOME} -eu cd printf
+	'quoted text' echo done readonly x=1 2>/dev/null x=1 grep
+cd printf x=1 -eu echo test 2>/dev/null /usr/bin && | cd | -eu
+"$1" grep printf "$@" sed 2>/dev/null && readonly then cd sed then ${HOME}
+grep echo echo readonly && local ${HOME} -eu test /usr/bin
+		x=1 sed export done 2>/dev/null done test x=1 'quoted text'
+	readonly "$1" done awk cd /usr/bin cd echo then grep echo local "$1"
+	echo --verbose --verbose readonly $(pwd) 2>/dev/null /usr/bin export sed "$1"
+then 'quoted text' test "$1" $(pwd) "$@" test
+	"$1" ${HOME} local /usr/bin test "$1" sed x=1 && x=1 grep
+		export --verbose sed sed echo 'quoted text' | sed ${HOME} echo $(pwd) ${HOME} -eu
+	| | done -eu readonly && printf -eu local then "$1" grep ${HOME} | && $(pwd)
+		'quoted text' awk cd sed test
+		-eu done echo test -eu echo cd "$1" | ${HOME} then --verbose then /usr/bin
+2>/dev/null 2>/dev/null cd
+	local awk -eu ${HOME} "$1" "$1" -eu
+	export readonly readonly sed done --verbose $(pwd) cd && awk
+		export $(pwd) done 'quoted text'
+sed cd | local /usr/bin 2>/dev/null |
+readonly sed $(pwd) &&
+		-eu test readonly done -eu --verbose && cd "$1" ${HOME} readonly "$@"
+		test 2>/dev/null local awk grep -eu "$@" ${HOME} x=1 readonly "$1" "$@" /usr/bin
+	awk export -eu readonly readonly export 'quoted text' x=1 grep done printf $(pwd)
+local sed cd "$@" printf ${HOME} done "$@" export --verbose
+		| 'quoted text' grep -eu printf && sed done $(pwd) printf --verbose cd 'quoted text'
+awk 2>/dev/null 2>/dev/null 'quoted text' ${HOME} awk x=1 awk readonly
+	printf x=1 --verbose echo then then 'quoted text' printf
+echo && 'quoted text' awk cd 2>/dev/null x=1 2>/dev/null | ${HOME}
+done /usr/bin "$@" local "$1" sed -eu 2>/dev/null export && 'quoted text'
+grep grep 'quoted text' --verbose readonly | grep -eu $(pwd) done done cd
+$(pwd) x=1 $(pwd) $(pwd) echo $(pwd) local
+		$(pwd) -eu printf "$@" /usr/bin -eu done 2>/dev/null printf && ${HOME} 2>/dev/null
+	awk readonly | done -eu "$@" "$@" echo -eu echo $(pwd)
+2>/dev/null printf && grep
+| 'quoted text' sed sed done readonly -eu -eu export
+	awk awk sed printf local
+	printf test x=1 sed "$@" test && grep echo 2>/dev/null |
+readonly local sed /usr/bin 'quoted text' x=1
+		export sed | export -eu readonly
+	test export -eu test done /usr/bin 'quoted text' cd printf "$1" 'quoted text'
+	&& awk x=1 printf echo 2>/dev/null $(pwd) -eu /usr/bin x=1
+	/usr/bin -eu echo | | --verbose test /usr/bin echo /usr/bin
+done /usr/bin local x=1 sed test then 'quoted text' cd printf grep
+	done --verbose $(pwd) -eu sed readonly
+	x=1 readonly x=1 then export
+	sed "$@" export done printf
+	local grep readonly "$@" ${HOME} && /usr/bin --verbose test
+		x=1 test -eu "$@" 2>/dev/null printf awk $(pwd) 2>/dev/null "$1" export export
+-eu done "$1" readonly readonly 2>/dev/null
+	${HOME} awk $(pwd) -eu "$1" 'quoted text' "$@" sed /usr/bin
+		x=1 && sed && && "$1" -eu x=1 local -eu
+--verbose "$1" local export && awk echo readonly grep x=1
+done -eu -eu -eu local printf
+--verbose test /usr/bin "$@" ${HOME} awk grep
+		'quoted text' "$@" /usr/bin
+	export 2>/dev/null sed export grep echo
+local grep awk sed then grep local
+--verbose sed test cd --verbose cd then /usr/bin
+		$(pwd) local -eu export printf test
+		"$@" echo ${HOME} -eu then --verbose --verbose awk grep
+	echo sed done then 'quoted text' export sed 'quoted text' printf
+	$(pwd) $(pwd) awk $(pwd)
+then grep "$1" /usr/bin done done readonly export echo cd awk $(pwd) cd
+		then test ${HOME} 2>/dev/null printf /usr/bin /usr/bin local -eu cd
+		grep --verbose "$1" printf 2>/dev/null --verbose
+&& local 2>/dev/null awk 'quoted text' cd "$@"
+&& x=1 done export 'quoted text' ${HOME} -eu && cd done
+		--verbose $(pwd) printf ${HOME} echo && $(pwd) x=1 $(pwd) 2>/dev/null 'quoted text'
+$(pwd) cd cd -eu test local /usr/bin --verbose "$1" cd export
+"$@" local local grep 2>/dev/null x=1 -eu sed /usr/bin cd |
+		| printf $(pwd) sed | done && then x=1 'quoted text' && printf
+x=1 --verbose 'quoted text'
+	-eu 2>/dev/null sed --verbose $(pwd) x=1 "$@" ${HOME} 'quoted text' "$@" test
+/usr/bin /usr/bin then x=1 | | x=1 | | x=1 $(pwd) -eu 2>/dev/null
+	'quoted text' "$@" --verbose "$1"
+		test readonly awk local sed grep export
+	2>/dev/null echo printf done $(pwd) | sed 'quoted text' 'quoted text'
+		-eu && export 'quoted text' ${HOME}
+	$(pwd) sed 'quoted text' | --verbose ${HOME} then "$@" printf "$1" -eu local
+		export ${HOME} then grep export test x=1 | $(pwd)
+	"$@" awk && printf -eu ${HOME} ${HOME} 2>/dev/null
+	&& echo readonly grep export -eu $(pwd) -eu awk 'quoted text'
+		$(pwd) test cd awk printf
+		| sed "$@" x=1 then "$@" /usr/bin grep
+	$(pwd) "$@" done printf "$1" readonly "$1" "$1" --verbose --verbose
+		&& then && "$@" ${HOME} local
+	2>/dev/null "$1" x=1 -eu x=1 local && cd -eu | "$@"
+		${HOME} && 'quoted text' done -eu x=1 ${HOME}
+sed sed echo then readonly sed 2>/dev/null sed grep x=1 export
+	"$@" readonly awk | echo x=1 | 2>/dev/null
+	echo then x=1 sed 'quoted text' "$1" done readonly done x=1 local
+		readonly $(pwd) done | "$1" sed "$1" then | | /usr/bin "$@" test --verbose
+done $(pwd) echo 'quoted text' $(pwd) readonly
+		sed 2>/dev/null done grep printf x=1 x=1 cd cd printf echo $(pwd)
+		${HOME} sed echo done "$@"
+	export sed -eu x=1 -eu awk grep grep readonly grep readonly 'quoted text'
+		'quoted text' --verbose awk
+test echo done local grep ${HOME} done export
+	2>/dev/null grep && "$@" echo awk
+local $(pwd) -eu awk cd --verbose test awk
+		export && --verbose -eu /usr/bin cd
+	export "$@" "$1" x=1 | | $(pwd) done awk ${HOME} -eu
+		${HOME} sed $(pwd) --verbose 'quoted text' --verbose awk local echo -eu
+	printf sed $(pwd) done 2>/dev/null cd local
+	sed local test awk awk | -eu -eu test then | readonly echo then 2>/dev/null echo
+		printf test -eu done local
+		"$1" /usr/bin readonly -eu ${HOME} | 2>/dev/null local
+		| -eu "$1" test "$@" "$@" cd grep
+echo printf "$1" ${HOME}
+	"$@" x=1 readonly export "$@" 2>/dev/null && echo readonly
+	-eu then local --verbose 'quoted text' | ${HOME} 'quoted text'
+grep && cd then x=1 test 2>/dev/null $(pwd) ${HOME} then printf --verbose
+2>/dev/null --verbose x=1 echo cd cd local --verbose 'quoted text' cd
+		sed x=1 cd sed echo echo 2>/dev/null /usr/bin done printf
+	x=1 cd "$1" | cd && --verbose test 2>/dev/null && "$@" readonly ${HOME} then "$@"
+	$(pwd) 'quoted text' echo /usr/bin 2>/dev/null | grep
+		grep /usr/bin printf /usr/bin awk "$@" local export /usr/bin grep ${HOME}
+	&& $(pwd) export local 2>/dev/null -eu && echo --verbose
+local local x=1 awk test $(pwd) readonly readonly printf then grep "$@" readonly
+	"$1" --verbose 2>/dev/null "$1" test done "$@" export "$@" 2>/dev/null
+export 'quoted text' | /usr/bin export readonly $(pwd) then done "$1" 2>/dev/null
+printf ${HOME} && 2>/dev/null
+	done export 'quoted text' $(pwd)
+$(pwd) "$1" && done sed sed sed then $(pwd) sed ${HOME} readonly
+		"$@" readonly test "$1" printf 2>/dev/null
+	export export -eu -eu grep $(pwd)
+		test "$@" readonly done 2>/dev/null
+	grep sed 2>/dev/null $(pwd)
+"$1" && local $(pwd) $(pwd) echo sed test | printf
+	readonly --verbose printf local && cd
+'quoted text' cd /usr/bin ${HOME} awk test
+	$(pwd) x=1 "$@" grep -eu cd sed done sed | sed
+	cd && cd echo sed then | x=1 "$@"
+"$1" ${HOME} x=1 $(pwd) local readonly --verbose 'quoted text' | $(pwd) --verbose
+	sed --verbose grep "$1" done x=1 awk "$1" &&
+	grep awk readonly readonly test printf readonly
+	local $(pwd) ${HOME} sed echo then then /usr/bin --verbose echo local printf
+	-eu then 'quoted text' --verbose && sed "$1" awk echo done
+${HOME} x=1 test local |
+	echo sed sed $(pwd) "$1" ${HOME} $(pwd) printf 2>/dev/null
+	export printf $(pwd) 2>/dev/null grep ${HOME} export 2>/dev/null
+	-eu 'quoted text' export local && ${HOME} | ${HOME} && 2>/dev/null
+	--verbose awk && cd local && test "$1" sed | echo export sed "$1" export 2>/dev/null
+	/usr/bin ${HOME} awk export | 'quoted text' /usr/bin "$1" 'quoted text' awk
+	x=1 printf awk sed cd x=1 done done export "$1" | awk sed echo awk cd echo
+cd /usr/bin cd test local grep 2>/dev/null export
+	2>/dev/null awk done cd grep sed export printf awk test ${HOME} | ${HOME}
+${HOME} sed -eu export
+export "$1" 2>/dev/null printf done ${HOME} ${HOME} ${HOME}
+		'quoted text' "$1" sed $(pwd) "$1" && test ${HOME} && "$@" cd ${HOME} "$@" test
+sed ${HOME} | awk x=1 printf
+	echo local $(pwd) sed $(pwd) then && readonly "$@" readonly --verbose
+-eu cd test then export /usr/bin "$@" grep | grep local sed "$@" /usr/bin
+done "$@" readonly && $(pwd) local grep printf
+"$1" grep --verbose && readonly awk x=1 readonly 'quoted text' cd
+"$@" ${HOME} echo | /usr/bin readonly
+		printf $(pwd) printf grep "$@" done export 2>/dev/null 'quoted text'
+		printf | $(pwd) local awk local cd && grep awk local echo cd | grep echo
+"$1" readonly -eu && test ${HOME} "$@" readonly readonly "$1" then sed ${HOME}
+		export --verbose "$@" cd sed test 'quoted text'
+#include c169.sh
+	${HOME} x=1 -eu export "$1" printf test printf then /usr/bin && && | done
+	grep -eu cd echo export x=1 export && readonly && then 2>/dev/null
+--verbose --verbose | 'quoted text' test done export done 'quoted text'
+	readonly ${HOME} done cd 'quoted text' awk local $(pwd) ${HOME} -eu "$@"
+	then "$@" "$@" -eu $(pwd) $(pwd)
+		done ${HOME} && readonly awk readonly $(pwd) test sed "$@"
+		then --verbose 'quoted text' 2>/dev/null sed "$1" done echo test |
+2>/dev/null printf 'quoted text' && 'quoted text' local awk echo
+		grep --verbose x=1 "$@" /usr/bin -eu then ${HOME} echo -eu $(pwd) -eu awk x=1 $(pwd)
+	printf | ${HOME} --verbose 2>/dev/null grep "$@" /usr/bin
+		grep 'quoted text' test | | test | readonly printf readonly && -eu x=1 --verbose
+		printf --verbose awk grep sed local then printf export x=1 2>/dev/null 'quoted text'
+		x=1 done --verbose --verbose ${HOME} $(pwd) && awk done -eu awk done export
+		-eu readonly --verbose 'quoted text' "$@" echo ${HOME} sed -eu 2>/dev/null export
+		-eu sed 2>/dev/null ${HOME}
+"$@" --verbose | && --verbose
+'quoted text' /usr/bin -eu
+"$1" /usr/bin -eu sed cd awk
+test awk | export readonly --verbose 'quoted text'
+	$(pwd) then $(pwd) awk local -eu && 'quoted text' test x=1 'quoted text'
+	'quoted text' awk test && $(pwd)
+	export 2>/dev/null test export
+		$(pwd) echo export -eu readonly sed done "$1"
+	-eu readonly --verbose
+	sed then done export echo "$@" $(pwd) local "$1" | printf readonly -eu 'quoted text'
+		"$@" test $(pwd) local 2>/dev/null then "$@" echo printf printf --verbose
+'quoted text' export 2>/dev/null | && export local x=1 readonly
+	cd then then "$1" -eu echo echo | sed "$@" grep export
+${HOME} "$1" | done ${HOME} cd
+		export awk /usr/bin test 2>/dev/null 'quoted text' test readonly
+	"$1" awk ${HOME} done grep && awk | x=1 | | && | test echo
+--verbose | "$1" printf then 2>/dev/null
+	awk then done then echo ${HOME} grep | "$1" sed $(pwd) /usr/bin
+	"$1" grep x=1 -eu 2>/dev/null
+		&& test awk "$@" cd readonly
+		--verbose done 2>/dev/null readonly -eu then test "$@" local 2>/dev/null
+${HOME} readonly | "$1" 2>/dev/null $(pwd)
+	grep test test && --verbose export
+printf "$1" awk "$1" --verbose echo 'quoted text' test
+$(pwd) awk export | awk done -eu cd | --verbose
+	${HOME} "$1" printf printf && "$@" readonly
+"$1" && "$1" --verbose printf -eu "$@" then "$@"
+/usr/bin cd | && grep x=1 && -eu $(pwd)
+		test grep && "$1" done export readonly -eu | awk --verbose -eu export done readonly
+then sed echo 'quoted text' | awk readonly grep then local
+		/usr/bin 2>/dev/null readonly awk local /usr/bin
+	sed --verbose /usr/bin local && /usr/bin 2>/dev/null
+&& -eu "$1" 2>/dev/null printf grep
+printf printf export awk cd 2>/dev/null
+	export done grep readonly --verbose
+	then echo | x=1 grep
+		export /usr/bin cd "$1" 'quoted text' 'quoted text' done
+-eu awk local "$1" test
+		export printf 2>/dev/null -eu local export 'quoted text' && grep "$@" $(pwd) local
+	cd -eu cd awk local "$@" test then echo $(pwd) "$@" grep ${HOME}
+echo && local then $(pwd) && x=1 $(pwd) ${HOME} sed && | x=1 $(pwd) &&
+		awk 2>/dev/null && test readonly "$@"
+		then echo done /usr/bin --verbose /usr/bin done | printf grep ${HOME} "$@" done
+$(pwd) echo ${HOME} "$1" grep done printf grep
+		export ${HOME} -eu -eu cd local printf 'quoted text'
+		"$@" "$1" "$@" sed | export then sed sed /usr/bin echo
+	/usr/bin cd 'quoted text' $(pwd) readonly echo x=1 sed printf --verbose local "$1"
+&& test local 'quoted text' --verbose $(pwd) readonly
+		cd && && --verbose $(pwd) readonly done done "$@" 2>/dev/null
+		printf -eu done local ${HOME} export
+"$1" awk local /usr/bin then readonly export
+&& echo --verbose --verbose done printf export printf done 2>/dev/null
+	cd ${HOME} 'quoted text' x=1 cd local "$@" cd echo sed
+printf x=1 printf sed "$@" "$1"
+		cd awk && x=1 && grep then test sed
+	2>/dev/null awk "$1" ${HOME} readonly cd 'quoted text'
+/usr/bin local done grep | awk -eu && printf export echo export echo awk local
+	-eu /usr/bin done then --verbose
+	x=1 echo cd printf then 'quoted text'
+		grep cd grep "$1" readonly readonly
+x=1 local sed x=1 "$1" x=1 --verbose test
+		export && "$1" -eu echo && /usr/bin done x=1 done 'quoted text'
+		export done x=1 export 2>/dev/null then "$1" 'quoted text' awk 'quoted text'
+	x=1 export sed echo -eu printf then
+	export "$1" local x=1 && 'quoted text' ${HOME} cd && done | --verbose local
+	local cd "$@" "$@" local
+&& 'quoted text' echo -eu "$1" test -eu then | export sed -eu
+		&& && grep local printf "$1" $(pwd) | --verbose x=1 "$1" $(pwd)
+	&& 'quoted text' --verbose ${HOME} done
+local awk readonly cd sed readonly 2>/dev/null "$@" | printf
+	"$1" | echo echo $(pwd) | $(pwd)
+2>/dev/null | "$@" awk awk grep export x=1
+readonly grep test then /usr/bin sed grep "$@" "$@"
+		'quoted text' export 2>/dev/null ${HOME} ${HOME} readonly then "$1" "$1" cd awk
+		-eu done export --verbose && x=1
+	cd --verbose then 2>/dev/null echo $(pwd) readonly
+grep echo "$@" 2>/dev/null done "$@" x=1 | /usr/bin
+		done 2>/dev/null "$1" then x=1 'quoted text' echo echo readonly
+echo 2>/dev/null 2>/dev/null 'quoted text'
+	--verbose && --verbose
+		${HOME} test ${HOME} -eu then $(pwd) x=1
+		x=1 then local printf then test "$1" | readonly ${HOME} "$1" /usr/bin
+	awk cd /usr/bin "$@" x=1 awk "$1"
+	sed sed test sed then -eu export
+/usr/bin $(pwd) cd readonly sed 2>/dev/null 'quoted text' "$1" ${HOME} --verbose
+/usr/bin printf export | test export sed export -eu
+then awk awk -eu 2>/dev/null awk -eu grep sed x=1 cd test --verbose
+	| sed export awk 'quoted text' local | local 'quoted text' echo
+		"$@" $(pwd) test test then 'quoted text' "$1" $(pwd) export && cd
+export grep readonly then
+	x=1 ${HOME} then | done done && readonly local x=1
+	'quoted text' ${HOME} done export $(pwd) cd test readonly 2>/dev/null -eu
+awk local awk readonly "$@" --verbose && /usr/bin sed printf export
+test $(pwd) grep -eu | "$1" && -eu /usr/bin "$1" $(pwd) printf done export
+| then cd export then 'quoted text' x=1 -eu sed grep grep
+		"$1" then 'quoted text' "$@" echo export readonly
+	printf -eu then && --verbose && "$@" awk "$@"
+		${HOME} -eu export sed $(pwd)
+		then 'quoted text' echo 2>/dev/null 'quoted text' ${HOME}
+printf $(pwd) done "$1" 'quoted text' "$1" printf then printf
+		&& printf sed cd "$1" test grep local | done 2>/dev/null grep sed grep
+	"$@" then sed test sed && grep
+x=1 x=1 awk | 2>/dev/null awk && echo $(pwd) sed 'quoted text'
+	-eu done done then 2>/dev/null /usr/bin ${HOME} $(pwd)
+'quoted text' printf x=1 | echo
+		cd sed && then "$@" "$@" -eu
+done cd ${HOME} --verbose ${HOME} 'quoted text' $(pwd) "$@" | done local
+	x=1 cd --verbose | "$@" sed 'quoted text' $(pwd) -eu
+	-eu && sed | 'quoted text' | -eu ${HOME}
+	"$@" $(pwd) readonly && 'quoted text'
+	test --verbose 2>/dev/null
+		'quoted text' printf export
+	grep "$1" -eu ${HOME} && cd x=1 && | x=1 --verbose grep
+2>/dev/null printf done ${HOME}
+		&& printf /usr/bin -eu sed --verbose readonly | -eu &&
+done "$@" done export x=1 2>/dev/null && printf x=1 -eu
+		"$1" | awk ${HOME} "$1" --verbose ${HOME} x=1 "$1" printf
+	2>/dev/null && "$@" "$@" --verbose $(pwd) $(pwd) echo
+	export $(pwd) "$1" export local "$1" --verbose awk "$1"
+		x=1 local $(pwd) | --verbose echo --verbose /usr/bin printf 2>/dev/null
+-eu /usr/bin done 2>/dev/null
+		'quoted text' "$1" x=1 test --verbose ${HOME}
+		grep cd x=1 "$@" local grep readonly -eu done 'quoted text'
+		local echo then 2>/dev/null test 2>/dev/null | "$1" cd then test cd
+		&& done readonly $(pwd) -eu then 'quoted text'
+	readonly ${HOME} readonly x=1 2>/dev/null cd printf cd
+		x=1 $(pwd) cd ${HOME} readonly x=1 test x=1 'quoted text' /usr/bin echo
+	-eu then --verbose test -eu echo /usr/bin /usr/bin "$1" "$1" then "$@" grep export
+	| && then -eu export readonly readonly readonly
+	2>/dev/null | local x=1 'quoted text' ${HOME} test | cd grep then 2>/dev/null
+grep --verbose | local
+echo x=1 sed ${HOME} -eu test 2>/dev/null cd --verbose
+"$@" /usr/bin test done
+		"$1" printf local sed sed 'quoted text' | readonly awk awk done ${HOME}
+		&& -eu cd grep awk $(pwd) && done --verbose done --verbose
+	grep x=1 2>/dev/null readonly cd && test echo -eu "$1" grep test local cd x=1
+$(pwd) done && local /usr/bin | "$1" ${HOME}
+"$1" echo export awk && $(pwd) sed test 'quoted text' x=1 ${HOME} grep "$1"
+echo "$1" 2>/dev/null echo $(pwd) readonly printf /usr/bin cd
+	printf awk | | export echo 'quoted text' "$1" | 2>/dev/null awk echo test
+x=1 x=1 echo sed done then
+	x=1 done ${HOME} local test /usr/bin awk cd 2>/dev/null export | grep --verbose
+		test printf then x=1 printf ${HOME} "$@"
+		test x=1 && echo 'quoted text' done sed local && 2>/dev/null "$@" $(pwd) &&
+	| /usr/bin && echo then export then printf local done "$@" | 2>/dev/null
+'quoted text' readonly ${HOME}
+		test /usr/bin then echo sed export
+	printf && --verbose printf
+local && -eu $(pwd) /usr/bin grep 'quoted text' printf done
+	readonly test grep $(pwd)
+--verbose local $(pwd) awk awk "$1" /usr/bin local
+		"$1" grep test /usr/bin "$1" | "$@" grep 2>/dev/null --verbose
+echo test --verbose printf -eu done 2>/dev/null test export local
+	${HOME} && test export printf
+		x=1 'quoted text' cd export local
+	sed "$1" -eu ${HOME} awk
+	readonly -eu readonly
+/usr/bin ${HOME} readonly cd
+echo grep && local && export --verbose
+x=1 2>/dev/null sed ${HOME} printf 'quoted text'
+	readonly then -eu ${HOME} $(pwd) -eu awk
+		sed sed sed | then -eu && then --verbose awk
+		sed cd readonly local awk "$1" -eu "$@" readonly ${HOME} echo
+sed x=1 then grep awk local -eu test
+sed 2>/dev/null printf local -eu 2>/dev/null
+echo /usr/bin /usr/bin cd "$@" && 2>/dev/null grep sed
+		local --verbose --verbose 2>/dev/null grep test 'quoted text'
+"$@" 2>/dev/null printf readonly $(pwd) "$@" export done | test printf
+		local "$@" && sed echo
+x=1 && /usr/bin ${HOME} "$1" local &&
+$(pwd) "$1" export 'quoted text' 2>/dev/null "$@" grep 'quoted text'
+		"$@" $(pwd) /usr/bin printf grep 'quoted text' printf 2>/dev/null
+		test done 'quoted text' echo --verbose /usr/bin then sed then 2>/dev/null "$1" then
+	-eu 2>/dev/null x=1 readonly 'quoted text' 2>/dev/null readonly | echo awk
+	grep sed "$1" then -eu awk then
+		then then done echo cd x=1 done x=1 --verbose 'quoted text' && cd
+	$(pwd) local done && cd 'quoted text' && awk cd local grep 'quoted text' sed ${HOME}
+		2>/dev/null grep cd 'quoted text' 'quoted text' export grep done && printf
+		grep sed ${HOME} x=1 ${HOME} && 2>/dev/null /usr/bin grep
+sed --verbose readonly "$@" | test then done done cd
+	done local --verbose 'quoted text' /usr/bin test cd "$1" cd
+		&& 'quoted text' done sed $(pwd) 2>/dev/null
+	cd printf awk printf && echo local --verbose sed test readonly local echo 2>/dev/null
+		printf done 'quoted text'
+"$@" then export printf $(pwd) then
+		cd export cd printf echo grep /usr/bin --verbose /usr/bin /usr/bin test 'quoted text'
+/usr/bin ${HOME} then done |
+		echo x=1 done printf sed export "$1" 2>/dev/null done --verbose cd | | && /usr/bin
+grep 'quoted text' && cd test printf "$1" 'quoted text'
+		echo done "$@" printf export awk cd echo readonly grep ${HOME}
+		readonly $(pwd) local sed "$1" 'quoted text' grep --verbose 2>/dev/null /usr/bin
+then test 'quoted text' 2>/dev/null | $(pwd) && sed ${HOME} 'quoted text' sed --verbose
+		-eu 2>/dev/null printf cd ${HOME} -eu -eu grep grep
+		-eu "$@" "$@" 2>/dev/null export | /usr/bin 'quoted text'
+$(pwd) "$1" echo awk x=1 x=1
+	test export awk 'quoted text' $(pwd)
+-eu test /usr/bin grep printf cd readonly then sed export "$1" test
+		grep -eu grep /usr/bin cd readonly "$1" local then sed x=1 $(pwd) "$@" then
+2>/dev/null | /usr/bin readonly 'quoted text' /usr/bin -eu then --verbose
+		/usr/bin then echo "$@" local then readonly "$@" export echo | cd sed local
+		test | 2>/dev/null "$@" sed awk -eu local echo
+	sed 'quoted text' local grep | "$@" /usr/bin local test | x=1 'quoted text' -eu
+${HOME} ${HOME} 2>/dev/null cd cd readonly grep $(pwd)
+	"$1" 2>/dev/null then grep cd done --verbose
+		sed /usr/bin awk sed /usr/bin 'quoted text' awk && "$1" | awk --verbose
+		local -eu printf 'quoted text' 'quoted text'
+| $(pwd) printf readonly --verbose printf 2>/dev/null
+grep /usr/bin "$@" printf export 'quoted text' --verbose printf sed -eu "$1" done
+		'quoted text' | awk -eu ${HOME} | -eu local printf "$@" then
+		-eu awk 2>/dev/null $(pwd) export test grep test done --verbose
+		'quoted text' sed /usr/bin grep -eu -eu && x=1 printf export readonly
+sed "$@" ${HOME} then awk $(pwd) grep grep local $(pwd) readonly
+	$(pwd) awk printf printf | -eu ${HOME} local 2>/dev/null
+	"$@" awk cd test export sed /usr/bin && cd $(pwd) sed 'quoted text' $(pwd)
+	/usr/bin | echo export && then echo --verbose sed "$@" --verbose
+	"$@" local cd "$@" export test echo local cd 2>/dev/null
+then grep readonly && sed "$@" done echo grep export "$1" then test cd grep -eu
+	echo test "$@" x=1 test /usr/bin /usr/bin test
+		"$@" "$1" -eu /usr/bin
+	'quoted text' "$@" then cd done local echo export grep printf /usr/bin 'quoted text'
+/usr/bin local then && /usr/bin then --verbose echo test
+		grep then ${HOME} printf 2>/dev/null --verbose --verbose
+x=1 grep echo "$@" cd local --verbose then grep echo -eu sed "$@" echo
+'quoted text' x=1 && --verbose sed 'quoted text' local /usr/bin sed
+	$(pwd) 2>/dev/null --verbose echo done
+	export export && ${HOME}
+		echo sed awk sed then x=1 /usr/bin local "$@" sed printf
+$(pwd) x=1 | 2>/dev/null sed 2>/dev/null
+export /usr/bin export then "$@" sed printf
+grep 2>/dev/null done && local sed ${HOME} export sed readonly printf ${HOME}
+grep ${HOME} done awk then grep echo awk /usr/bin export printf | awk &&
+		grep test echo /usr/bin | "$1" x=1 2>/dev/null --verbose $(pwd) "$@" && done printf
+'quoted text' -eu then "$1"
+local | && printf test "$1" printf /usr/bin "$@" $(pwd)
+done cd grep "$@" x=1 then "$1" -eu && readonly then then 2>/dev/null
+cd export $(pwd) done --verbose ${HOME} test -eu 'quoted text' $(pwd)
+2>/dev/null printf "$1"
+cd 2>/dev/null 2>/dev/null 'quoted text' -eu cd local
+/usr/bin local /usr/bin -eu | | grep | awk --verbose local cd -eu echo test echo
+	grep $(pwd) done grep | $(pwd) printf -eu printf export echo readonly
+		cd $(pwd) test grep cd export --verbose done
+done "$@" then test sed && && then grep echo x=1 x=1 awk echo && then
+--verbose /usr/bin local $(pwd) -eu awk grep sed readonly -eu ${HOME} then
+'quoted text' 2>/dev/null awk --verbose local done cd --verbose printf
+--verbose && ${HOME} "$@" | -eu then ${HOME} local | $(pwd) x=1 "$1"
+	local x=1 cd | /usr/bin --verbose sed done then && "$@" /usr/bin
+		readonly then -eu 2>/dev/null
+		cd local -eu "$@" "$@" done echo "$@"
+		cd printf ${HOME} && cd x=1 x=1 ${HOME}
+awk 2>/dev/null 2>/dev/null then $(pwd) "$@" ${HOME} x=1 local ${HOME}
+"$1" | sed ${HOME} sed grep
+	| /usr/bin --verbose sed awk -eu $(pwd) ${HOME} test "$@"
+		printf export echo done -eu then awk 2>/dev/null x=1
+sed x=1 && | -eu 2>/dev/null grep /usr/bin $(pwd) --verbose "$1" &&
+	${HOME} test -eu local "$@" readonly --verbose then printf test | --verbose
+	"$@" test test test export -eu $(pwd) test /usr/bin local | export grep readonly
+		"$1" ${HOME} 'quoted text' grep --verbose sed readonly
+	2>/dev/null local sed $(pwd)
+		--verbose local local x=1 local grep /usr/bin done
+2>/dev/null x=1 test 2>/dev/null export printf "$1" printf readonly
+	cd && test --verbose printf cd | && "$@"
+	x=1 cd /usr/bin cd echo done local readonly then x=1 "$@" done -eu -eu cd
+local echo sed 2>/dev/null /usr/bin printf
+	x=1 "$1" sed $(pwd) | printf x=1 && done "$1" local local cd echo sed x=1
+test "$@" printf /usr/bin
+	&& done cd local local readonly "$@" "$@" then sed cd printf echo -eu export
+		--verbose "$1" --verbose && cd awk done sed readonly then --verbose
+-eu grep then /usr/bin printf /usr/bin --verbose export local --verbose
+--verbose x=1 "$@" done local "$1" local echo ${HOME}
+	'quoted text' "$@" x=1 ${HOME} printf | ${HOME} local
+	"$1" && "$1" awk $(pwd) && "$1"
+		| -eu then | test 2>/dev/null
+		cd "$1" test ${HOME} test "$1" -eu "$1" ${HOME} /usr/bin
+	&& --verbose cd local && done ${HOME} ${HOME}
+"$@" sed echo 'quoted text' sed $(pwd) readonly
+		export echo $(pwd) x=1 local $(pwd) $(pwd) done printf
+	"$@" readonly -eu ${HOME} "$@" local test
+	x=1 export 2>/dev/null 'quoted text' 'quoted text' printf | 'quoted text'
+		$(pwd) readonly test export grep 2>/dev/null then cd awk "$@" grep | "$@" 'quoted text'
+	-eu | x=1 'quoted text' readonly -eu readonly then ${HOME} grep awk echo
+| 'quoted text' && local grep /usr/bin awk sed local | 'quoted text' ${HOME}
+then local done local done grep "$1" ${HOME} $(pwd) sed && grep sed /usr/bin
+done local 'quoted text' then grep readonly readonly
+	done done 'quoted text' ${HOME} printf x=1 x=1 done /usr/bin 2>/dev/null
+		${HOME} 'quoted text' local -eu printf sed && x=1 cd "$@" && echo && sed done
+	export "$1" then local 'quoted text' $(pwd) echo awk 2>/dev/null test export "$@"
+'quoted text' && -eu "$@" | 'quoted text' 2>/dev/null /usr/bin
+		export ${HOME} --verbose cd "$@" "$@"
+	/usr/bin done && "$@" then "$@" export -eu
+		'quoted text' cd -eu -eu then local "$1" test done
+x=1 done /usr/bin "$1" readonly
+	local $(pwd) cd 'quoted text' echo sed cd grep cd export
+	"$1" echo sed x=1 cd awk export && cd printf "$@" ${HOME} "$1" $(pwd)
+		${HOME} x=1 then printf export export x=1 test grep "$1" grep x=1
+	| test | export 2>/dev/null export test grep
+	then export export 2>/dev/null | awk export
+"$@" --verbose x=1 /usr/bin export test && then export $(pwd) "$@" export
+--verbose local readonly ${HOME} "$1" sed export echo export
+		awk awk "$1" grep $(pwd)
+		"$@" sed --verbose readonly local "$1" /usr/bin printf -eu /usr/bin done
+		&& export 2>/dev/null awk $(pwd) echo "$@" -eu -eu done /usr/bin cd 2>/dev/null
+	2>/dev/null "$1" then --verbose then printf awk && done 2>/dev/null test local "$1"
+	export | ${HOME} -eu awk 2>/dev/null awk then then test awk
+then --verbose $(pwd)
+	readonly grep | local | x=1 | test test export ${HOME}
+	then done grep cd "$1" /usr/bin sed | grep test awk /usr/bin
+	cd readonly local -eu local ${HOME} local then local done cd grep "$1"
+		--verbose x=1 local "$1" awk 2>/dev/null 'quoted text'
+		readonly export ${HOME} done "$@" "$1" ${HOME} ${HOME}
+		awk "$@" /usr/bin ${HOME} done echo readonly
+		awk 'quoted text' test local grep
+	grep local local sed then --verbose
+&& $(pwd) export awk /usr/bin
+		'quoted text' cd ${HOME} local | --verbose done x=1 "$1" printf
+done "$@" local readonly 'quoted text'
+		done printf 2>/dev/null awk "$@" local x=1 --verbose /usr/bin $(pwd) export
+cd printf ${HOME} --verbose -eu local then done 'quoted text' printf /usr/bin
+	/usr/bin && "$@" echo readonly "$1" awk $(pwd) 2>/dev/null echo
+	awk local "$@" echo cd && done printf
+export && then ${HOME} cd -eu local 'quoted text' readonly ${HOME} ${HOME}
+		sed /usr/bin cd readonly | --verbose "$@" printf "$@" export
+		then sed export grep 2>/dev/null printf ${HOME} $(pwd) $(pwd) 2>/dev/null
+export cd x=1 awk | --verbose
+	cd $(pwd) | done "$@" && --verbose grep then ${HOME} echo test "$@"
+"$@" ${HOME} local 'quoted text' local grep then then awk
+		test | "$@" $(pwd) "$1" printf x=1 2>/dev/null echo /usr/bin grep echo
+| -eu "$1" x=1 "$1" then ${HOME} grep -eu export x=1 $(pwd) 2>/dev/null
+&& /usr/bin $(pwd) 'quoted text' local
+		echo --verbose export -eu -eu --verbose printf
+		'quoted text' done 'quoted text' awk && cd 'quoted text' grep 'quoted text' $(pwd)
+	--verbose echo awk ${HOME} -eu local x=1 /usr/bin export 'quoted text'
+done | sed done /usr/bin 2>/dev/null --verbose grep "$1"
+		/usr/bin 'quoted text' "$1" "$1" 'quoted text'
+		local sed awk grep $(pwd) then printf && -eu --verbose printf -eu
+done --verbose export grep printf ${HOME} /usr/bin
+		printf "$1" --verbose -eu x=1 x=1 "$@" export -eu -eu readonly echo "$@"
+	export test readonly "$@" "$@" sed "$@" local $(pwd) readonly
+	"$@" export | 2>/dev/null cd then | 2>/dev/null
+		"$@" printf 'quoted text' /usr/bin grep
+sed --verbose ${HOME} echo 2>/dev/null "$1" /usr/bin $(pwd) && "$1" echo then
+	grep && echo "$@" ${HOME} printf printf done "$@" $(pwd) sed "$1" then printf |
+	--verbose -eu -eu echo $(pwd) then awk local && cd "$@" "$1" --verbose test
+"$1" test export --verbose printf readonly echo export grep test
+		cd export grep $(pwd) then then --verbose local cd 'quoted text' x=1
+		export && echo cd --verbose ${HOME} 2>/dev/null
+		${HOME} test $(pwd) local
+awk local -eu cd $(pwd) | local 2>/dev/null
+		2>/dev/null export export 2>/dev/null awk -eu
+'quoted text' x=1 -eu sed
+| --verbose cd 2>/dev/null
+		-eu -eu then cd local readonly
+| | awk cd x=1 cd ${HOME} | done echo "$@" "$@" then ${HOME}
+	sed done then cd 2>/dev/null ${HOME} grep x=1 "$1" cd 2>/dev/null ${HOME}
+done done test --verbose local | export
+export && --verbose $(pwd) 2>/dev/null
+	x=1 x=1 local cd sed awk | grep
+		awk then echo $(pwd) x=1 printf "$1" $(pwd)
+		| printf 'quoted text' awk readonly export
+"$1" local cd && -eu done grep 'quoted text'
+		awk "$1" cd grep && cd echo "$1" grep /usr/bin
+		local awk grep done --verbose "$1" "$1" then export done && "$@" $(pwd)
+		"$@" "$1" x=1 2>/dev/null 'quoted text' printf && local && 'quoted text'
+printf "$@" cd awk awk printf sed 2>/dev/null
+		$(pwd) then echo done grep cd readonly
+		local sed --verbose export -eu 'quoted text' echo done && && x=1
+		done printf export awk ${HOME} cd /usr/bin export cd 'quoted text' done $(pwd)
+cd "$@" --verbose then 2>/dev/null $(pwd) ${HOME}
+${HOME} sed /usr/bin /usr/bin
+--verbose export "$1" sed | grep done export | printf
+${HOME} && awk then $(pwd) cd export grep test "$@"
+		/usr/bin readonly && awk 2>/dev/null --verbose done sed cd 2>/dev/null done
+		grep /usr/bin x=1 /usr/bin --verbose cd 'quoted text' awk "$1" test
+		"$1" local "$@" -eu local export test echo "$1" "$1" awk
+	&& -eu then printf && "$1"
+| 2>/dev/null | then local cd printf
+| x=1 sed --verbose -eu cd then awk then
+		&& "$@" readonly cd grep
+	cd done "$@" printf 2>/dev/null awk ${HOME}
+	grep sed local awk --verbose "$@" echo x=1 | && 2>/dev/null
+"$@" && then test cd ${HOME} x=1 test /usr/bin -eu grep export 'quoted text'
+echo cd printf "$@" sed done readonly local done then "$1" "$@" | test
+-eu "$@" x=1 2>/dev/null local "$1" 2>/dev/null 'quoted text'
+	--verbose --verbose echo test local --verbose then /usr/bin local
+sed x=1 cd sed "$@" readonly $(pwd) "$@" | && sed x=1 export printf echo echo
+	grep && local sed local "$1" test
+		"$@" /usr/bin "$@" export && --verbose awk x=1 cd $(pwd)
+		/usr/bin --verbose test export
+cd | --verbose done printf x=1 readonly x=1
+		x=1 'quoted text' $(pwd) 2>/dev/null && x=1 ${HOME} test
+		2>/dev/null then 'quoted text' --verbose
+	| awk local --verbose --verbose --verbose --verbose -eu
+	then then local 2>/dev/null | awk 2>/dev/null -eu grep grep grep export
+		$(pwd) grep sed $(pwd) test printf local 'quoted text'
+&& printf | | export sed export "$1" x=1 && awk
+grep sed export cd printf ${HOME}
+	--verbose done | | /usr/bin
+		echo | awk readonly 2>/dev/null 2>/dev/null
+cd echo sed readonly done && ${HOME} cd test 'quoted text'
+export test | awk export test local export x=1 readonly /usr/bin --verbose
+		printf echo "$@" test $(pwd) 'quoted text'
+		readonly ${HOME} "$@" sed x=1 awk x=1 ${HOME} 'quoted text' sed test
+		local x=1 sed "$@" cd /usr/bin local sed
+	then grep cd "$@" /usr/bin --verbose && $(pwd) grep export awk
+	awk && test grep "$@"
+	echo then then /usr/bin grep cd x=1 readonly --verbose cd && sed test
+	$(pwd) echo then printf sed readonly
+grep /usr/bin done x=1 ${HOME} --verbose
+	cd awk readonly --verbose echo | done x=1
+export | 'quoted text' ${HOME} readonly grep awk --verbose printf
+		readonly "$1" done /usr/bin grep readonly -eu awk test 2>/dev/null
+echo test /usr/bin 'quoted text' echo local export sed 'quoted text'
+	$(pwd) && /usr/bin export
+	&& /usr/bin readonly printf "$1"
+	local && done printf printf
+		export export | 2>/dev/null awk /usr/bin "$1" cd grep
+	&& readonly && "$@" grep cd sed "$1" export test /usr/bin -eu
+		/usr/bin sed sed export 'quoted text' test && readonly
+-eu "$@" 2>/dev/null
+${HOME} $(pwd) $(pwd)
+$(pwd) test x=1 cd 2>/dev/null x=1 /usr/bin "$1" readonly
+		-eu done $(pwd) local grep --verbose then /usr/bin $(pwd) then
+	awk 2>/dev/null readonly x=1 --verbose echo echo grep $(pwd)
+		awk done "$1" echo $(pwd) x=1 sed printf $(pwd)
+		x=1 echo $(pwd) then --verbose $(pwd)
+		$(pwd) then echo && cd --verbose local readonly echo then grep readonly
+		${HOME} 'quoted text' export
+"$1" 2>/dev/null then local done ${HOME}
+$(pwd) cd | $(pwd) cd cd then "$@" grep
+grep "$1" -eu done 2>/dev/null done x=1 awk $(pwd) ${HOME} "$1" printf
+		grep cd then | readonly grep sed sed test echo sed echo 2>/dev/null printf
+then ${HOME} ${HOME} --verbose 2>/dev/null sed
+2>/dev/null readonly x=1 --verbose
+		local $(pwd) x=1 -eu --verbose "$@" printf $(pwd) grep readonly --verbose /usr/bin
+	readonly awk "$@" "$1" --verbose $(pwd) readonly 2>/dev/null
+done | awk local -eu /usr/bin cd ${HOME}
+		/usr/bin x=1 then echo ${HOME} test /usr/bin cd
+"$@" test /usr/bin /usr/bin export -eu grep local
+	--verbose then cd printf "$1" test "$@"
+		"$@" /usr/bin echo "$@" sed then awk grep -eu
+	2>/dev/null --verbose then
+		cd 2>/dev/null test readonly
+		-eu -eu ${HOME} readonly local && readonly sed 2>/dev/null export x=1 |
+		awk grep grep done awk sed grep && 'quoted text' $(pwd) then
+		cd grep --verbose /usr/bin ${HOME} "$1" ${HOME} echo test
+		| grep awk then --verbose "$1" local 'quoted text' export
+		cd 2>/dev/null /usr/bin x=1 cd 'quoted text' && --verbose
+| -eu done printf readonly sed $(pwd) awk done local export 2>/dev/null echo cd
+		readonly $(pwd) && printf readonly --verbose done test "$1" export x=1 && $(pwd)
+	local $(pwd) awk test /usr/bin grep | "$@" -eu $(pwd) 'quoted text'
+	--verbose | then awk /usr/bin echo 'quoted text' readonly ${HOME}
+grep awk then x=1 awk "$1" grep then x=1 echo | grep
+	echo then ${HOME} "$1" x=1 "$1"
+		readonly | -eu ${HOME} test -eu grep readonly "$1"
+		/usr/bin local test --verbose
+	cd $(pwd) ${HOME} cd test "$1" "$@" test 'quoted text' $(pwd)
+		readonly "$1" readonly printf "$@" printf -eu awk sed test ${HOME} grep -eu
+		echo 'quoted text' awk | grep $(pwd) printf
+local 'quoted text' test then && awk awk 2>/dev/null readonly
+	/usr/bin printf export sed grep && "$@" awk done --verbose
+export printf ${HOME} grep -eu local export && grep 2>/dev/null x=1
+awk printf test /usr/bin "$1" "$1" "$1" export $(pwd) printf awk echo done export
+x=1 -eu then export ${HOME} grep local ${HOME} local
+	printf "$@" then grep printf -eu printf "$@" local printf printf
+		local "$1" cd local x=1 export
+	test echo "$@" /usr/bin ${HOME} cd
+	done 2>/dev/null readonly sed echo test awk
+		readonly "$1" "$@" "$1" export "$1" cd done done cd
+		${HOME} test $(pwd) grep x=1 then local
+export /usr/bin local "$1" awk grep export
+		cd $(pwd) | grep "$1" export sed 2>/dev/null /usr/bin cd grep -eu /usr/bin
+		done /usr/bin x=1 export /usr/bin "$@" echo local cd ${HOME}
+	&& then | echo x=1 sed "$1" "$1" done "$1" $(pwd) x=1
+cd "$1" $(pwd) export | && ${HOME} --verbose
+| export x=1 'quoted text' printf
+		2>/dev/null && ${HOME} 2>/dev/null test test awk export
+awk echo && printf $(pwd) "$@" -eu --verbose printf done $(pwd) ${HOME}
+echo then x=1 x=1 /usr/bin cd "$@" && local then export cd export
+		--verbose ${HOME} echo "$@" readonly cd x=1 then "$1" printf
+	printf -eu done x=1 x=1 test
+		| "$@" -eu $(pwd) done /usr/bin 'quoted text' && && -eu ${HOME}
+	done --verbose grep "$1" ${HOME} readonly
+	2>/dev/null export export cd $(pwd) echo echo --verbose
+		x=1 awk && "$1" -eu "$@" $(pwd) x=1 printf
+		sed $(pwd) echo grep test test "$@" readonly ${HOME} grep local --verbose
+		x=1 ${HOME} printf sed | /usr/bin "$1" --verbose
+	'quoted text' then /usr/bin echo x=1 | && $(pwd) echo printf /usr/bin
+	local echo awk "$1" 'quoted text' 2>/dev/null "$@" export grep ${HOME}
+echo grep 'quoted text' readonly grep &&
+	export "$1" && test then sed grep then -eu readonly x=1 printf
+		&& then ${HOME} 2>/dev/null then -eu sed "$@" local cd echo echo done
+sed echo --verbose x=1 done echo echo --verbose
+		&& export readonly && && $(pwd)
+readonly "$1" && /usr/bin sed && --verbose && test grep -eu x=1
+		--verbose $(pwd) 'quoted text' grep $(pwd) $(pwd)
+		-eu | cd ${HOME} readonly echo done "$1"
+		${HOME} 'quoted text' "$1" then 'quoted text' 2>/dev/null
+	-eu done && $(pwd) awk readonly && then x=1 --verbose ${HOME} test echo
+	grep sed then local done
+		awk test local sed export ${HOME} printf "$@" --verbose $(pwd) printf cd | readonly
+	&& ${HOME} grep $(pwd) "$@" then | /usr/bin
+'quoted text' then awk "$@" --verbose ${HOME} 'quoted text'
+		echo then test | echo readonly
+"$@" grep then readonly readonly awk readonly echo "$@"
+	/usr/bin 2>/dev/null 'quoted text'
+"$@" export x=1 export cd "$@" ${HOME} -eu x=1 awk --verbose --verbose
+	done /usr/bin 'quoted text' "$@" 2>/dev/null cd 'quoted text' export
+		2>/dev/null $(pwd) then
+	"$1" done -eu local x=1 cd cd "$@" "$@" --verbose /usr/bin test ${HOME}
+2>/dev/null && && done awk | cd test readonly
+${HOME} local x=1 awk local --verbose cd echo 'quoted text' x=1 /usr/bin 2>/dev/null
+'quoted text' then local then $(pwd) then readonly test $(pwd)
+		--verbose "$1" $(pwd) -eu sed && --verbose --verbose ${HOME}
+		readonly "$@" test x=1 2>/dev/null grep 2>/dev/null "$@" then sed -eu 2>/dev/null
+	2>/dev/null echo /usr/bin /usr/bin 2>/dev/null
+	x=1 /usr/bin test "$@" 'quoted text' grep
+awk x=1 "$@" 2>/dev/null ${HOME} echo echo /usr/bin local
+	/usr/bin export 2>/dev/null awk && 'quoted text'
+$(pwd) x=1 export local ${HOME} then $(pwd) && "$1" | $(pwd) -eu cd
+	${HOME} | local export --verbose | | test
+	printf "$1" x=1 "$@" && x=1 grep cd ${HOME} | printf export ${HOME} sed | printf
+		test "$1" && grep cd && readonly echo 'quoted text'
+	readonly "$@" test test export /usr/bin echo /usr/bin sed readonly
+test | sed "$1" done sed sed 2>/dev/null
+		grep "$@" cd echo --verbose test done echo cd echo done local
+	awk readonly awk sed sed "$1" printf 2>/dev/null 'quoted text'
+	then local sed then x=1 then grep printf
+		| -eu readonly /usr/bin
+		done ${HOME} awk test sed
+${HOME} "$@" printf --verbose
+	"$1" echo grep awk test && echo cd readonly /usr/bin echo --verbose then
+cd x=1 test local awk | printf grep x=1 | cd sed done readonly cd /usr/bin
+	"$1" local /usr/bin --verbose readonly export
+then grep "$@" | 'quoted text'
+	done x=1 then export "$@" done grep /usr/bin 2>/dev/null printf then
+done "$1" echo && "$1" 'quoted text' echo $(pwd) 'quoted text'
+		sed | test --verbose done
+		printf ${HOME} $(pwd) then echo 2>/dev/null printf "$1" x=1 echo readonly -eu
+		2>/dev/null export sed ${HOME} --verbose readonly
+		| sed && x=1 then then x=1 "$@" && "$1" | sed cd "$@" test ${HOME} x=1 | "$@"
+	2>/dev/null ${HOME} sed cd done ${HOME} "$1"
+local test done printf readonly local | done done
+cd export done then /usr/bin x=1 awk 2>/dev/null cd 2>/dev/null
+x=1 grep sed && x=1 && grep cd "$1" /usr/bin ${HOME}
+		&& awk -eu 2>/dev/null && local then
+'quoted text' 'quoted text' && awk /usr/bin
+/usr/bin 'quoted text' cd 2>/dev/null test echo ${HOME}
+		printf sed | then done --verbose awk done grep 2>/dev/null &&
+		local | then /usr/bin readonly local printf then echo
+	printf awk readonly awk 2>/dev/null x=1 awk /usr/bin $(pwd) &&
+		done --verbose 'quoted text'
+echo sed x=1 awk | "$1" 2>/dev/null
+		cd | test readonly local echo cd
+cd ${HOME} -eu 2>/dev/null test | then ${HOME} x=1 printf echo test echo && x=1
+sed sed export cd $(pwd) local --verbose "$@" && local --verbose
+-eu printf && sed printf cd
+	cd test cd $(pwd) "$@" ${HOME} sed awk | test done -eu $(pwd) 2>/dev/null --verbose
+cd 'quoted text' sed "$1" cd grep "$1" grep /usr/bin
+	"$1" --verbose grep awk awk "$@" readonly
+		awk $(pwd) local $(pwd) 2>/dev/null && then
+	printf 2>/dev/null printf "$@"
+		then ${HOME} sed echo local $(pwd) 'quoted text' | /usr/bin "$1"
+sed echo 'quoted text' "$1" test 2>/dev/null --verbose 2>/dev/null "$1" cd local
+	2>/dev/null cd then test export grep awk -eu ${HOME}
+		"$1" --verbose local -eu then -eu export export local readonly test
+then cd cd -eu done printf grep ${HOME} local local "$1" printf readonly printf
+&& "$@" 2>/dev/null done --verbose then
+	sed readonly done 2>/dev/null
+	awk --verbose done echo
+		x=1 sed -eu done sed cd -eu export
+		grep grep ${HOME} | | test done test
+		readonly sed ${HOME} echo $(pwd) |
+	then ${HOME} done -eu grep ${HOME} $(pwd) 2>/dev/null /usr/bin printf grep && -eu
+printf sed 'quoted text' && "$1" grep then cd test
+	-eu && sed --verbose x=1 awk 2>/dev/null readonly "$1" $(pwd) then local
+grep test then "$1" ${HOME} readonly ${HOME}
+test | done "$1" -eu test /usr/bin
+printf grep 'quoted text' && $(pwd) echo done 'quoted text'
+	test && ${HOME} awk --verbose "$@" "$@" /usr/bin $(pwd) "$@"
+	cd echo /usr/bin 'quoted text' "$@" test 2>/dev/null
+		"$@" /usr/bin local $(pwd) grep
+printf grep 'quoted text' 2>/dev/null test
+readonly -eu grep local grep local 'quoted text'
+	-eu export -eu | awk export readonly | local
+${HOME} readonly grep /usr/bin local readonly "$@" $(pwd) &&
+		/usr/bin grep | sed ${HOME} local sed awk -eu && local
+then $(pwd) then test done /usr/bin /usr/bin done grep readonly -eu
+/usr/bin ${HOME} "$@" --verbose awk sed "$1" $(pwd) cd export
+"$1" 'quoted text' printf "$@" then
+"$1" echo sed export "$@" && $(pwd)
+	readonly 2>/dev/null $(pwd) grep sed &&
+	echo done ${HOME} && cd && x=1
+		grep readonly x=1 export
+awk sed test test then 2>/dev/null x=1 grep sed "$@" "$1" sed "$@" "$@"
+cd readonly ${HOME} done x=1 /usr/bin export
+	echo export local then then readonly 'quoted text' test /usr/bin
+	--verbose --verbose --verbose
+		/usr/bin "$1" | local export test printf
+	done 2>/dev/null readonly readonly "$@" then ${HOME} 2>/dev/null
+		| ${HOME} 2>/dev/null -eu then
+readonly done echo readonly /usr/bin printf "$1" readonly "$@" x=1
+	cd awk then x=1 $(pwd)
+		$(pwd) | sed | /usr/bin export ${HOME}
+		test 'quoted text' then x=1 | export --verbose local /usr/bin
+	x=1 "$1" sed 'quoted text' export 2>/dev/null
+		done | echo /usr/bin sed printf then export echo export echo cd
+		cd readonly done grep test then "$@" --verbose cd "$@" "$@" echo 2>/dev/null
+x=1 echo local test echo awk "$1" echo $(pwd) grep x=1 'quoted text'
+		'quoted text' "$1" export grep /usr/bin echo sed awk done
+		then printf grep awk -eu printf | 'quoted text' && printf
+		export 'quoted text' | "$1" $(pwd)
+		echo local $(pwd) "$@"
+done sed -eu cd --verbose "$@" grep $(pwd) export $(pwd) | "$@" "$1"
+	grep done /usr/bin $(pwd) "$@" local readonly --verbose
+	cd done -eu | export printf $(pwd) $(pwd) | $(pwd) && export
+printf ${HOME} ${HOME} test awk awk 'quoted text' awk "$1" "$@"
+x=1 cd -eu local local ${HOME} x=1 | echo grep
+	done done done x=1 readonly -eu sed 2>/dev/null
+	awk test /usr/bin sed "$@" && echo -eu -eu --verbose && grep -eu grep
+		test $(pwd) && x=1 cd --verbose test done
+	2>/dev/null readonly /usr/bin cd "$@" grep then "$@" export
+	${HOME} done echo x=1 done && then cd --verbose local 'quoted text' readonly 2>/dev/null
+		export -eu echo test export
+"$@" export "$@" sed "$1" printf | then "$1" cd then printf ${HOME}
+	"$@" then x=1 | x=1 test --verbose then x=1 2>/dev/null | --verbose
+		readonly /usr/bin /usr/bin
+grep grep ${HOME} -eu "$1" test awk export 'quoted text' "$1" echo $(pwd)
+cd ${HOME} done && 'quoted text' 'quoted text'
+	x=1 x=1 --verbose then grep readonly local
+		readonly then awk then export readonly sed local
+--verbose awk readonly local $(pwd) |
+	test | done sed cd --verbose then sed -eu "$@" $(pwd) done ${HOME} local | test
+${HOME} local printf | local 2>/dev/null ${HOME}
+	"$1" then local "$1" ${HOME} local printf "$1" /usr/bin printf 2>/dev/null
+		done readonly sed test 2>/dev/null sed --verbose done ${HOME} | local done
+then x=1 sed grep | /usr/bin printf test export done then "$@" && local printf -eu
+	$(pwd) readonly awk then /usr/bin printf --verbose then $(pwd) done readonly
+		&& test grep done | |
+	cd 2>/dev/null && $(pwd)
+	then then ${HOME} grep $(pwd)
+		readonly x=1 "$@" && sed cd | "$1" test ${HOME} --verbose local
+		local x=1 echo --verbose ${HOME} then && | -eu
+/usr/bin 'quoted text' done --verbose -eu readonly printf x=1 sed --verbose &&
+		readonly $(pwd) export -eu printf 'quoted text' cd test grep
+--verbose | readonly "$@" 2>/dev/null local grep local echo printf echo done grep
+		| cd awk ${HOME} 'quoted text' $(pwd) "$1"
+2>/dev/null cd echo awk /usr/bin
+local x=1 | readonly local -eu export
+	--verbose | readonly printf readonly && local
+	awk -eu sed | -eu awk | export then local then done awk test
+	export "$@" "$@" then x=1 then cd sed -eu export
+"$1" ${HOME} echo printf awk printf cd test cd
+	export 'quoted text' local printf readonly awk x=1 sed echo 'quoted text'
+	printf $(pwd) | awk export sed test awk $(pwd)
+"$1" | readonly echo 'quoted text' -eu done
+		export --verbose $(pwd) 'quoted text'
+	printf x=1 awk --verbose /usr/bin cd awk --verbose echo -eu --verbose 'quoted text'
+		readonly "$@" awk grep awk done
+	/usr/bin "$@" export x=1 done x=1 2>/dev/null done "$1" /usr/bin $(pwd) grep
+	x=1 test 2>/dev/null -eu local echo && printf $(pwd) && grep then test
+		sed /usr/bin --verbose
+cd printf 2>/dev/null test
+		then x=1 printf echo local local printf /usr/bin -eu awk
+	2>/dev/null | sed ${HOME} $(pwd) --verbose "$@" then grep
+	cd | && | ${HOME} export cd 2>/dev/null sed awk ${HOME} "$@"
+		readonly 'quoted text' grep -eu test ${HOME} printf --verbose sed
+x=1 -eu awk readonly "$1" 'quoted text' test test "$@" done 2>/dev/null
+		$(pwd) && $(pwd) /usr/bin grep cd awk awk 'quoted text' ${HOME}
+		local sed -eu x=1 done ${HOME} 2>/dev/null then readonly ${HOME}
+	| | --verbose ${HOME} export --verbose "$@" cd ${HOME} --verbose &&
+	done echo local "$@" -eu awk 'quoted text' 'quoted text'
+	"$@" test "$1" | echo test grep test export echo /usr/bin test $(pwd) x=1 --verbose
+		grep readonly 'quoted text' "$@" -eu ${HOME} test
+		awk --verbose && $(pwd)
+| grep x=1 test 2>/dev/null readonly 2>/dev/null readonly /usr/bin "$1" printf
+"$@" "$1" test ${HOME} "$1" export sed
+		test readonly cd "$@" readonly "$1" -eu 2>/dev/null
+	'quoted text' 2>/dev/null grep cd && echo readonly 'quoted text' done
+	then local ${HOME} 'quoted text' readonly "$1" /usr/bin
+		echo cd "$1" test /usr/bin
+		--verbose printf local --verbose awk
+		done --verbose "$@" cd ${HOME}
+"$1" done printf | $(pwd) cd 2>/dev/null echo --verbose
+$(pwd) local printf "$@" $(pwd) then echo then
+	&& cd 2>/dev/null then done then --verbose
+	2>/dev/null --verbose test echo
+		$(pwd) printf sed 'quoted text' grep readonly test | -eu printf
+	readonly x=1 printf echo cd ${HOME} /usr/bin awk echo
+	2>/dev/null -eu ${HOME} && echo ${HOME} readonly local
+		-eu "$@" -eu -eu 'quoted text' 2>/dev/null $(pwd) local 2>/dev/null x=1 --verbose
+2>/dev/null && test && sed cd local export /usr/bin echo $(pwd) --verbose
+		$(pwd) local local awk done cd ${HOME} && done export grep awk
+-eu printf echo ${HOME} sed awk export then done "$@" then "$1" echo
+		| awk && && | | 2>/dev/null then grep "$@" x=1 then "$@" local sed --verbose
+		sed awk && /usr/bin export -eu printf cd cd --verbose done "$1"
+		grep x=1 ${HOME} printf then test awk "$@" --verbose cd
+		echo sed echo then "$@" done /usr/bin sed echo
+	export ${HOME} done readonly
+-eu echo then then grep && 2>/dev/null
+		printf 2>/dev/null x=1 2>/dev/null && export test
+		echo done sed done local x=1 'quoted text' "$1" sed echo "$1"
+	-eu 'quoted text' cd && -eu then
+	grep "$@" test local echo then done grep x=1 test cd local then 'quoted text'
+$(pwd) readonly -eu local local then "$1" ${HOME} printf sed 2>/dev/null done
+		grep 'quoted text' readonly
+	export $(pwd) /usr/bin export grep $(pwd)
+		&& awk 2>/dev/null ${HOME} | cd sed "$1" ${HOME} $(pwd) printf 2>/dev/null awk local
+"$1" echo && sed --verbose -eu ${HOME} echo "$@" readonly | "$1" cd
+		--verbose test export "$@" then export sed x=1 $(pwd) echo -eu readonly
+awk --verbose printf echo
+awk "$1" "$1" ${HOME} 2>/dev/null
+	x=1 test "$@" x=1 done /usr/bin 2>/dev/null -eu -eu cd "$@"
+grep then sed awk "$@"
+	-eu /usr/bin sed | awk $(pwd) ${HOME} export 'quoted text'
+		-eu $(pwd) then /usr/bin && sed "$@" export readonly sed -eu 2>/dev/null
+| echo done "$@" awk awk -eu | "$@" --verbose --verbose
+	then grep sed 2>/dev/null then $(pwd) sed && awk awk "$1" awk /usr/bin grep readonly
+	-eu readonly printf done 2>/dev/null $(pwd) 'quoted text' done printf -eu
+		cd then export "$1" sed awk | $(pwd) $(pwd) cd done 'quoted text'
+echo $(pwd) --verbose sed local then sed | -eu ${HOME}
+	"$1" cd test -eu --verbose x=1
+		awk | test | then && /usr/bin ${HOME}
+		--verbose /usr/bin grep
+	x=1 --verbose | ${HOME} "$1" readonly
+done then /usr/bin --verbose | "$@" 2>/dev/null ${HOME} "$@" awk done sed readonly
+	"$@" export ${HOME} sed cd --verbose printf echo | cd /usr/bin -eu sed && sed
+done readonly 2>/dev/null export echo echo
+	--verbose $(pwd) cd | "$1" readonly $(pwd) export local /usr/bin sed readonly
+--verbose export | | export readonly "$1"
+	test --verbose --verbose x=1 done readonly "$1" grep --verbose
+readonly printf local 2>/dev/null cd x=1 'quoted text'
+then -eu --verbose x=1 "$1" && echo ${HOME} then | -eu awk | done $(pwd)
+		"$@" cd done test awk done 'quoted text' printf
+	printf readonly && | printf --verbose
+	&& ${HOME} "$@" "$@" 'quoted text' grep
+"$1" | echo $(pwd) echo "$1" "$@" x=1 2>/dev/null x=1 -eu sed | "$1"
+		2>/dev/null awk then test "$1"
+local test printf x=1 "$@" then grep awk && "$1" &&
+		2>/dev/null echo local cd awk
+		| cd 'quoted text' awk
+		readonly "$1" x=1 export printf cd --verbose
+		$(pwd) local -eu /usr/bin --verbose
+	cd test then $(pwd) readonly
+$(pwd) readonly done && $(pwd) -eu $(pwd) "$1" echo --verbose
+		sed local printf /usr/bin then sed grep grep $(pwd) awk 'quoted text' &&
+	grep 2>/dev/null export $(pwd) x=1 echo |
+	&& printf sed sed test grep x=1 awk grep grep cd "$@" export
+then && x=1 sed test 'quoted text' 2>/dev/null local | 'quoted text'
+	export readonly --verbose && ${HOME}
+		awk cd grep "$@" done -eu $(pwd)
+	| echo 'quoted text' "$1" "$@" readonly echo
+	grep then x=1 'quoted text' "$1" 2>/dev/null ${HOME}
+		2>/dev/null /usr/bin && 2>/dev/null test "$1" done
+'quoted text' test 2>/dev/null printf done test --verbose
+x=1 2>/dev/null test printf "$1" test x=1 cd | test 'quoted text'
+sed test x=1 ${HOME} /usr/bin ${HOME} 2>/dev/null
+'quoted text' then 'quoted text' --verbose local "$@" readonly cd && done
+		done then grep test 2>/dev/null /usr/bin
+		| --verbose readonly echo grep "$@" echo /usr/bin local export
+| | awk local printf local -eu ${HOME} export
+"$@" --verbose 2>/dev/null local $(pwd) printf done "$@"
+	echo printf printf done && test ${HOME} -eu sed 'quoted text'
+		${HOME} 'quoted text' readonly done /usr/bin x=1 && $(pwd) 'quoted text'
+		grep | && -eu test && echo local x=1 printf sed printf local $(pwd) $(pwd)
+2>/dev/null awk $(pwd) grep then
+		printf export test test "$1" 'quoted text' sed 2>/dev/null x=1
+	done readonly printf /usr/bin awk done
+	x=1 && --verbose $(pwd)
+/usr/bin then $(pwd) 2>/dev/null ${HOME} 2>/dev/null 'quoted text'
+sed "$1" sed export cd 2>/dev/null
+	cd done grep grep sed 2>/dev/null --verbose
+"$@" "$@" --verbose && grep test sed awk printf
+cd && export awk "$1" "$1" 'quoted text' x=1
+	echo awk then --verbose local export ${HOME} export ${HOME}
+		&& && x=1 cd awk 'quoted text' done test local
+	"$@" echo then -eu local done done sed $(pwd) /usr/bin sed sed &&
+export 2>/dev/null /usr/bin echo /usr/bin -eu "$@" | grep 'quoted text'
+		sed ${HOME} export x=1 then x=1 /usr/bin
+local $(pwd) grep awk test x=1
+sed /usr/bin awk x=1
+test readonly awk done 'quoted text' local export && readonly
+| export x=1 test "$1" -eu ${HOME} export && 'quoted text' awk
+	-eu sed printf grep $(pwd) sed "$1" | echo 'quoted text' test -eu 'quoted text'
+	/usr/bin -eu test && /usr/bin cd export
+	readonly then printf x=1 local readonly printf x=1 test $(pwd)
+	-eu sed test x=1 --verbose $(pwd) /usr/bin --verbose
+$(pwd) x=1 printf cd /usr/bin x=1
+		readonly readonly grep echo --verbose printf printf export
+	then then x=1 $(pwd) ${HOME} awk printf then cd ${HOME} -eu && "$1" readonly "$@"
+	$(pwd) ${HOME} x=1 "$1" readonly echo "$1" cd 2>/dev/null then
+		"$@" echo export && /usr/bin 'quoted text' cd echo x=1 done
+	/usr/bin printf "$1" printf "$@" cd test --verbose -eu && | grep "$@" ${HOME}
+	--verbose 2>/dev/null sed
+		${HOME} sed then && 2>/dev/null 2>/dev/null
+	$(pwd) echo && "$@" sed cd readonly sed sed export | then grep
+$(pwd) $(pwd) test | -eu && "$1" sed ${HOME} sed local /usr/bin readonly
+		test /usr/bin echo done /usr/bin ${HOME} /usr/bin sed 2>/dev/null
+then grep x=1 sed printf /usr/bin /usr/bin
+	"$@" --verbose test && cd readonly
+		awk "$@" "$1" local $(pwd)
+	&& "$1" 2>/dev/null then cd grep printf
+		sed test "$@" "$1" && printf export
+echo "$1" test done 2>/dev/null cd "$@" -eu done local
+sed local 2>/dev/null $(pwd) ${HOME} awk "$@" printf then then
+cd | grep echo echo local printf x=1 local echo | /usr/bin export
+done ${HOME} then test && --verbose "$1" echo "$1" $(pwd) | --verbose printf &&
+		2>/dev/null --verbose readonly "$@" x=1 cd -eu then echo 'quoted text' cd local
+		echo "$1" /usr/bin "$1" && 'quoted text' && 'quoted text' x=1 x=1 x=1 "$@"
+	sed $(pwd) /usr/bin sed local grep
+		export "$1" local grep export -eu readonly "$@" grep | then
+	| awk "$@" export awk 2>/dev/null $(pwd) /usr/bin ${HOME} /usr/bin
+	x=1 "$1" readonly sed sed
+echo --verbose 'quoted text' | 2>/dev/null $(pwd)
+		sed "$1" 'quoted text' cd echo -eu test grep "$@" 'quoted text' "$@" cd 'quoted text'
+	-eu grep /usr/bin x=1 $(pwd)
+	test "$@" "$1" -eu -eu x=1 echo $(pwd) cd 2>/dev/null grep --verbose
+		sed done | test 2>/dev/null && printf
+	-eu $(pwd) $(pwd) ${HOME} grep printf "$@" 'quoted text'
+		sed sed --verbose done local export then -eu 'quoted text' --verbose printf
+	x=1 sed echo then local -eu cd awk test | --verbose x=1 -eu done ${HOME}
+	local 'quoted text' "$@" && grep $(pwd) sed "$1" cd -eu local export cd 2>/dev/null
+		local export then printf readonly export
+		2>/dev/null printf grep awk | cd -eu 2>/dev/null "$1"
+	printf test then $(pwd)
+	awk cd --verbose cd cd local printf | "$@" --verbose --verbose printf
+		local | sed awk $(pwd) --verbose x=1 $(pwd) "$1"
+	"$1" local ${HOME} printf echo | awk /usr/bin export x=1 echo export
+	export cd readonly 2>/dev/null cd /usr/bin printf local 'quoted text'
+awk -eu echo test "$@" /usr/bin test then x=1 $(pwd)
+	'quoted text' ${HOME} local export test
+		then awk | -eu local echo
+	echo local printf readonly 2>/dev/null && 2>/dev/null then export echo "$1"
+awk "$@" -eu ${HOME} test printf
+	/usr/bin echo "$1" cd sed /usr/bin /usr/bin /usr/bin printf test -eu 'quoted text'
+&& --verbose -eu local printf echo -eu 2>/dev/null printf grep $(pwd) --verbose
+		-eu "$@" awk --verbose done 2>/dev/null
+	x=1 grep test cd test echo printf | cd export echo cd then readonly
+cd ${HOME} echo local 2>/dev/null && printf local done $(pwd) $(pwd) test
+awk awk 2>/dev/null echo && 2>/dev/null x=1
+		readonly 2>/dev/null readonly readonly printf && $(pwd) "$@"
+		test && done "$1" && -eu sed "$@" x=1 -eu 'quoted text' /usr/bin ${HOME}
+		awk echo && grep grep test grep --verbose
+cd local grep 'quoted text' sed x=1 test "$@" /usr/bin
+	grep awk -eu | --verbose "$@" local grep /usr/bin
+		"$@" 'quoted text' ${HOME} export readonly "$@"
+/usr/bin -eu awk sed test local | 2>/dev/null then grep awk "$1"
+		/usr/bin then && echo 'quoted text' --verbose
+	done grep /usr/bin grep -eu export local /usr/bin
+local x=1 done "$1" "$@" printf then cd "$1" cd x=1 -eu x=1 $(pwd) printf grep
+--verbose test 'quoted text' ${HOME}
+	local x=1 && "$1" "$@" echo cd "$@"
+		test sed printf -eu done "$1" $(pwd) --verbose "$1" x=1
+/usr/bin readonly local echo readonly $(pwd) printf
+		--verbose grep 'quoted text' x=1 test ${HOME} sed ${HOME} then -eu "$1" "$@"
+	/usr/bin --verbose -eu --verbose
+--verbose x=1 printf grep x=1 sed /usr/bin /usr/bin echo done && cd /usr/bin
+	-eu test sed grep readonly cd 'quoted text'
+printf -eu 'quoted text' awk grep && "$1" awk export 'quoted text'
+	$(pwd) 2>/dev/null printf "$1" /usr/bin local "$1" sed then
+echo awk && readonly "$1" | | export cd then cd -eu sed ${HOME}
+		${HOME} 'quoted text' sed readonly | /usr/bin 'quoted text' --verbose
+	then --verbose && echo 'quoted text' local readonly x=1 echo | cd | export /usr/bin
+	/usr/bin then local test --verbose sed -eu printf then --verbose then echo
+	"$1" | | 2>/dev/null -eu "$1" --verbose
+echo local done /usr/bin -eu
+$(pwd) $(pwd) grep | export "$1" test ${HOME} local awk --verbose local
+		sed local sed echo 2>/dev/null grep then sed awk 2>/dev/null -eu
+		printf awk x=1 /usr/bin 2>/dev/null --verbose --verbose
+	-eu test sed awk 2>/dev/null awk grep 'quoted text' && done done test then printf
+	"$@" cd local -eu ${HOME} "$@" then done
+		then test "$@" ${HOME} --verbose local $(pwd) printf
+		done "$1" printf local "$1" "$1"
+	2>/dev/null ${HOME} $(pwd) "$1" $(pwd) | 2>/dev/null "$@" $(pwd) local
+"$@" --verbose awk 2>/dev/null ${HOME}
+local printf "$@" echo "$@" --verbose ${HOME} "$@" "$1"
+		x=1 | test grep 2>/dev/null then test
+	"$@" $(pwd) 'quoted text' -eu ${HOME} -eu $(pwd) "$@" sed awk then ${HOME}
+readonly && --verbose readonly x=1 awk x=1 cd -eu ${HOME} echo echo
+	--verbose then grep 2>/dev/null "$1" awk printf
+	x=1 "$@" grep "$@" echo /usr/bin local /usr/bin 2>/dev/null cd cd /usr/bin 'quoted text'
+		done | 'quoted text' local then then $(pwd) "$1" then then && -eu local awk 2>/dev/null
+		sed local ${HOME} "$1" readonly /usr/bin
+	printf done && $(pwd) readonly export
+	--verbose then | done -eu "$@" grep grep 'quoted text'
+	--verbose done readonly --verbose "$@" awk -eu 'quoted text' then readonly
+		readonly sed then x=1 | export $(pwd)
+		test sed "$@" | "$1" -eu 'quoted text' | |
+		local export "$1" then cd readonly export
+then echo ${HOME} 'quoted text' ${HOME} && done cd
+/usr/bin readonly cd readonly /usr/bin done echo awk
+	-eu test x=1 readonly ${HOME} local && awk 'quoted text' ${HOME} local echo
+local awk --verbose && cd ${HOME} done
+| awk -eu --verbose /usr/bin
+	"$@" awk "$@" test -eu test readonly test ${HOME} printf --verbose
+		printf --verbose 2>/dev/null x=1 grep then ${HOME} --verbose
+		awk -eu 'quoted text' 'quoted text' sed grep grep
+then x=1 export then test 2>/dev/null && && /usr/bin
+	test printf echo -eu 2>/dev/null grep
+		sed local "$1" readonly ${HOME} /usr/bin /usr/bin --verbose 'quoted text' -eu
+	sed then /usr/bin cd /usr/bin
+sed 2>/dev/null local 2>/dev/null cd /usr/bin then $(pwd) "$1" 2>/dev/null
+		readonly --verbose 'quoted text' export ${HOME} x=1 "$1" /usr/bin --verbose
+"$@" /usr/bin grep $(pwd) test printf cd
+	"$1" /usr/bin $(pwd) local -eu test then -eu sed awk
+x=1 x=1 'quoted text' done
+	--verbose awk x=1 -eu sed local && -eu
+		echo echo printf cd grep x=1 "$@" --verbose /usr/bin | done awk 2>/dev/null
+		"$1" export ${HOME} ${HOME} printf export | | | printf then 2>/dev/null
+x=1 then grep grep then --verbose
+		$(pwd) --verbose echo echo
+grep $(pwd) /usr/bin grep ${HOME} awk test cd && ${HOME} export x=1 x=1
+		then 2>/dev/null "$1" /usr/bin ${HOME} echo done grep 'quoted text' echo echo
+		printf $(pwd) export "$@" test 'quoted text' && sed "$1" $(pwd)
+	export --verbose local sed then "$1" grep
+		"$@" then -eu grep then /usr/bin ${HOME} 'quoted text' local && x=1
+		"$@" && | awk then then && 2>/dev/null export /usr/bin 2>/dev/null 'quoted text'
+--verbose ${HOME} "$1" cd sed 'quoted text' cd | done ${HOME} 'quoted text'
+local --verbose awk -eu "$1" $(pwd) 2>/dev/null readonly && x=1 /usr/bin sed echo
+		awk cd /usr/bin local 2>/dev/null 'quoted text' | x=1
+	then x=1 2>/dev/null $(pwd) --verbose /usr/bin --verbose test sed "$@"
+local ${HOME} 'quoted text' echo test printf export "$1" && readonly "$@" grep
+test -eu readonly ${HOME} -eu "$1" printf awk
+	printf readonly export sed -eu --verbose ${HOME} awk 2>/dev/null ${HOME} 'quoted text'
+	grep /usr/bin echo local sed readonly sed /usr/bin
+		export test 2>/dev/null "$1" $(pwd) --verbose ${HOME} $(pwd)
+	export ${HOME} printf export /usr/bin echo grep -eu | grep done --verbose $(pwd)
+| grep | -eu readonly /usr/bin readonly readonly 'quoted text' x=1 awk
+-eu printf readonly -eu /usr/bin
+	| ${HOME} x=1 done -eu "$1" cd ${HOME} /usr/bin
+	printf echo readonly cd cd $(pwd) "$@" && sed printf && "$1" ${HOME} awk 'quoted text'
+awk 'quoted text' "$@" done $(pwd)
+| 2>/dev/null grep sed sed sed sed x=1 sed
+	grep export sed echo ${HOME} grep echo "$1" $(pwd)
+/usr/bin && 2>/dev/null | && sed echo "$@" sed
+printf awk | echo then x=1 'quoted text'
+	printf awk 'quoted text' readonly x=1 "$@" ${HOME} 'quoted text' grep "$@" ${HOME}
+	2>/dev/null cd awk test && ${HOME}
+readonly then -eu --verbose readonly printf
+		-eu $(pwd) | sed readonly export
+		awk done grep printf test test 'quoted text' readonly /usr/bin sed
+awk x=1 'quoted text' export 2>/dev/null echo x=1 test printf
+	'quoted text' 2>/dev/null "$1" done 'quoted text'
+		export -eu x=1 "$@" printf | test grep
+then /usr/bin 2>/dev/null -eu x=1 test | local 'quoted text' readonly
+"$@" 2>/dev/null /usr/bin test x=1 -eu | 2>/dev/null | 'quoted text'
+	done grep cd test readonly "$@" -eu sed x=1 $(pwd) printf done
+"$1" ${HOME} export | export "$1" --verbose sed test awk | ${HOME} grep 2>/dev/null
+		test test done sed && grep local printf
+		"$@" "$1" 2>/dev/null test "$1" ${HOME} && local cd printf
+		&& cd ${HOME} echo then export local 'quoted text' /usr/bin
+	"$@" printf $(pwd) x=1 then cd x=1
+then "$@" && $(pwd) "$@" cd printf | cd "$@" "$1"
+		grep | then cd 'quoted text' export $(pwd) awk
+		--verbose export "$@" --verbose
+	local grep readonly export && ${HOME} ${HOME} echo 'quoted text'
+awk "$1" 'quoted text' done ${HOME}
+		then 2>/dev/null echo printf echo test | x=1 /usr/bin x=1
+		${HOME} export done "$@" "$1" echo "$1" /usr/bin echo -eu x=1 /usr/bin
+		grep awk readonly --verbose -eu -eu local "$@" grep /usr/bin
+2>/dev/null ${HOME} 'quoted text' done done /usr/bin ${HOME} 'quoted text'
+	-eu done grep x=1 cd cd x=1 readonly "$1" export $(pwd) done | done test
+cd export grep printf grep /usr/bin readonly
+	echo done grep | "$1" sed readonly | $(pwd) cd then
+	done export -eu awk echo export | "$@" done cd --verbose x=1 local /usr/bin
+		cd 2>/dev/null && sed x=1 local grep $(pwd)
+	-eu && done | sed x=1 --verbose --verbose ${HOME} /usr/bin
+	readonly cd export 'quoted text' local --verbose readonly then then readonly
+sed -eu ${HOME} awk export &&
+	/usr/bin "$1" test "$@" test 'quoted text' local awk ${HOME} | $(pwd)
+| ${HOME} grep sed export --verbose awk /usr/bin 'quoted text'
+		awk done then /usr/bin 2>/dev/null "$1" "$@" echo echo then "$1" && --verbose
+		'quoted text' test test "$@" echo grep --verbose --verbose test
+	&& $(pwd) awk "$@" then "$1" local ${HOME} 'quoted text' done sed
+	export /usr/bin then $(pwd) ${HOME} export printf printf -eu
+	&& 'quoted text' 'quoted text'
+		2>/dev/null grep ${HOME} readonly | awk ${HOME} ${HOME} cd ${HOME} echo awk echo
+	test && readonly printf $(pwd) -eu
+		2>/dev/null ${HOME} export readonly | local -eu "$1" /usr/bin local local test done
+		awk "$1" --verbose && | done 'quoted text' ${HOME} echo printf "$1"
+	sed test --verbose printf | local sed --verbose done test $(pwd) test readonly
+		-eu export 2>/dev/null ${HOME} printf &&
+'quoted text' x=1 then sed done sed done | ${HOME} $(pwd) x=1 'quoted text'
+awk echo export -eu | /usr/bin readonly 2>/dev/null
+	2>/dev/null cd sed export --verbose $(pwd) x=1 /usr/bin
+		x=1 local cd awk x=1 x=1 done grep ${HOME} --verbose grep printf $(pwd) 2>/dev/null
+$(pwd) && awk done && test $(pwd)
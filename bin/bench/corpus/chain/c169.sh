@@ -0,0 +1,2001 @@
+	grep /usr/bin -eu && grep cd printf
+	&& ${HOME} "$@" /usr/bin printf done
+	$(pwd) local test "$@" awk cd readonly x=1 export test readonly ${HOME}
+		printf $(pwd) --verbose $(pwd) x=1 && grep export
+	done cd printf awk | "$@" x=1 cd export done 'quoted text' $(pwd)
+		test -eu /usr/bin "$1" sed | then "$@" test done awk echo 2>/dev/null
+		&& --verbose readonly awk cd then "$@" $(pwd) && grep ${HOME} && printf
+		local x=1 ${HOME} then
+		echo test x=1 grep awk printf /usr/bin
+	cd $(pwd) done echo --verbose then "$1" echo x=1 cd -eu test -eu 2>/dev/null
+		${HOME} export ${HOME} $(pwd) -eu $(pwd) 2>/dev/null test "$1"
+	local --verbose -eu "$@" local done then 'quoted text'
+		${HOME} grep cd export readonly echo done test /usr/bin export
+--verbose /usr/bin awk grep "$@" then x=1 printf 'quoted text' --verbose
+	cd -eu local local 2>/dev/null | grep | $(pwd)
+$(pwd) 2>/dev/null | -eu awk printf $(pwd) then "$@" done sed
+		x=1 echo x=1 /usr/bin echo "$1" export -eu test x=1 then && echo "$1" awk echo
+done test export | /usr/bin echo test printf 2>/dev/null "$1" "$1"
+	&& printf cd --verbose awk x=1
+test x=1 "$@" && x=1 then awk then --verbose ${HOME}
+		awk "$@" "$@" readonly $(pwd) printf
+	-eu --verbose ${HOME} done
+	grep 'quoted text' "$1" | echo "$1" echo /usr/bin
+awk awk 2>/dev/null local sed export x=1 --verbose "$@" then cd done && 'quoted text'
+	/usr/bin | x=1 && "$@" cd
+		--verbose test awk then 2>/dev/null ${HOME} "$@" x=1 "$1"
+export done grep $(pwd) test test $(pwd) readonly
+&& done then x=1 local sed ${HOME} -eu $(pwd) x=1 awk sed
+	&& 2>/dev/null local 'quoted text' test done grep "$1" readonly local
+"$1" echo cd done awk readonly ${HOME} sed x=1
+| 2>/dev/null sed test local -eu /usr/bin
+sed cd /usr/bin | awk /usr/bin
+	${HOME} then done cd "$@" local ${HOME} awk cd "$1" x=1
+${HOME} ${HOME} -eu 'quoted text' && --verbose 2>/dev/null ${HOME}
+	export awk test sed ${HOME}
+	"$1" awk then local sed
+printf local | ${HOME} done cd then ${HOME} 2>/dev/null cd $(pwd) local
+		| local done cd done echo
+/usr/bin /usr/bin -eu -eu | "$1" readonly local cd readonly 2>/dev/null
+		-eu -eu 2>/dev/null $(pwd)
+	readonly | /usr/bin -eu x=1 x=1 $(pwd) ${HOME} $(pwd) "$1" echo test --verbose
+		readonly local "$1" echo $(pwd)
+	--verbose grep && echo 'quoted text' $(pwd) --verbose grep
+		echo done sed --verbose "$1" | local sed x=1 -eu readonly "$1" -eu |
+		'quoted text' x=1 "$@" && readonly "$1" cd "$@" grep test && 'quoted text'
+		'quoted text' $(pwd) 2>/dev/null awk /usr/bin
+	grep export export readonly x=1 echo "$1" printf $(pwd) ${HOME} sed local
+test awk -eu "$@" /usr/bin 'quoted text' test x=1 awk printf x=1 then x=1 -eu
+		readonly 2>/dev/null export printf ${HOME} grep -eu local sed
+		&& x=1 printf x=1 grep && awk 'quoted text' printf export ${HOME}
+		| "$1" echo --verbose | $(pwd) readonly done printf 'quoted text'
+"$@" ${HOME} ${HOME} grep x=1 | local test sed test cd then printf printf
+	awk --verbose "$@" $(pwd) then "$@" then
+		x=1 echo export $(pwd) "$1" sed test $(pwd)
+${HOME} && sed cd && done -eu "$1" && then cd awk readonly readonly echo
+local echo ${HOME} readonly then local ${HOME} readonly test
+cd awk ${HOME} awk readonly then /usr/bin
+then cd 2>/dev/null cd "$@" $(pwd)
+	| /usr/bin local $(pwd) done then awk "$@" sed sed
+	grep echo && readonly grep
+export test sed echo done 'quoted text' "$1" printf local
+		&& then --verbose sed $(pwd) sed sed && cd sed then
+awk sed "$1" | "$1" 'quoted text' $(pwd)
+	sed printf then "$1" | && local echo && && test && echo done && x=1
+	printf echo then export "$@" grep
+		'quoted text' printf -eu 2>/dev/null "$@" echo "$@" && && /usr/bin printf && test
+export | sed then x=1 awk awk "$1" && local printf cd "$@" local done printf |
+	/usr/bin x=1 test $(pwd) awk export "$@" test awk $(pwd) printf 'quoted text'
+	"$1" test ${HOME} ${HOME} cd
+		"$1" readonly $(pwd) 2>/dev/null local -eu 'quoted text'
+${HOME} local export cd /usr/bin $(pwd)
+	"$1" sed $(pwd) | ${HOME} "$1" readonly
+printf awk echo sed local local ${HOME} local export awk export cd local
+		2>/dev/null local --verbose 2>/dev/null
+then readonly awk --verbose /usr/bin test $(pwd) x=1 printf
+	2>/dev/null 'quoted text' test && | ${HOME} then "$@" "$@" echo 'quoted text' echo
+local x=1 /usr/bin printf grep then readonly -eu test $(pwd)
+echo printf printf then 2>/dev/null
+"$@" ${HOME} export 2>/dev/null readonly awk sed /usr/bin readonly printf
+	local cd printf "$1" 2>/dev/null test export 2>/dev/null then && 'quoted text' echo
+	grep | x=1 ${HOME} grep echo
+	2>/dev/null then --verbose
+		| 2>/dev/null done --verbose $(pwd) awk printf sed done 'quoted text'
+		test grep 'quoted text' printf -eu
+	cd "$1" $(pwd) done "$@" /usr/bin "$@" cd 2>/dev/null readonly local
+readonly echo /usr/bin "$1" sed cd ${HOME} done $(pwd) 'quoted text'
+done export x=1 -eu $(pwd) x=1 | done sed
+| done printf local done echo "$@" -eu --verbose
+		sed /usr/bin cd /usr/bin /usr/bin && ${HOME} && cd $(pwd) | then &&
+'quoted text' ${HOME} && grep
+printf ${HOME} $(pwd) then sed test --verbose -eu -eu printf x=1 local /usr/bin
+		sed done local readonly $(pwd) $(pwd) 'quoted text' grep && awk $(pwd) done
+then export 2>/dev/null
+		then local --verbose /usr/bin cd awk cd && 'quoted text'
+		"$1" -eu grep && done x=1 sed echo echo cd done test export grep
+		grep awk export ${HOME} "$@" sed then echo /usr/bin printf 2>/dev/null /usr/bin
+		${HOME} -eu --verbose sed 'quoted text' local
+		printf export grep done /usr/bin 2>/dev/null -eu echo
+	done "$@" echo ${HOME} --verbose
+	grep $(pwd) 2>/dev/null grep test sed done done -eu 2>/dev/null "$1" 2>/dev/null
+	x=1 local 'quoted text'
+		printf ${HOME} awk 'quoted text' && -eu "$1" 2>/dev/null grep grep grep -eu
+		grep 'quoted text' sed "$1" sed grep test
+--verbose cd x=1 && | x=1 local echo
+		2>/dev/null done $(pwd) | 2>/dev/null "$1"
+grep ${HOME} echo printf $(pwd) test export /usr/bin
+cd && && /usr/bin 2>/dev/null echo /usr/bin $(pwd) /usr/bin
+	printf "$1" | /usr/bin --verbose /usr/bin
+echo 2>/dev/null awk && | 2>/dev/null export && | echo test
+grep local local printf 2>/dev/null "$@" | cd | "$1" export export
+	cd test /usr/bin && | export export $(pwd) then --verbose | 'quoted text'
+awk --verbose done /usr/bin
+		done | test test $(pwd) $(pwd) grep cd $(pwd) x=1 local $(pwd) && "$1" test
+	'quoted text' ${HOME} cd -eu /usr/bin then test test grep sed cd cd readonly
+/usr/bin local printf local
+	'quoted text' && /usr/bin then "$@" ${HOME} x=1 done awk echo && sed echo
+		2>/dev/null --verbose then printf export "$@" 2>/dev/null
+'quoted text' 'quoted text' printf readonly
+-eu readonly echo -eu export readonly done "$@" grep
+		test then $(pwd) readonly x=1 | /usr/bin awk readonly sed printf awk x=1
+${HOME} 2>/dev/null "$@" readonly test echo | 'quoted text' "$1" cd echo 2>/dev/null
+	local ${HOME} "$1" done done 2>/dev/null export
+		-eu then x=1 export sed cd "$@" "$@" 'quoted text'
+		2>/dev/null "$@" "$@" local && $(pwd) $(pwd) grep $(pwd)
+then done "$1" export test -eu local "$1" sed then grep grep
+local 2>/dev/null local /usr/bin printf test grep
+	awk 'quoted text' "$@" sed -eu -eu -eu x=1 |
+awk export test local test echo sed local "$@" /usr/bin
+"$@" $(pwd) awk && $(pwd)
+echo --verbose printf --verbose test ${HOME} awk "$@" done x=1 --verbose --verbose
+	/usr/bin 'quoted text' x=1 "$@" 'quoted text' -eu 'quoted text'
+	sed printf --verbose $(pwd) x=1 printf ${HOME} done echo local cd grep
+		$(pwd) readonly | grep /usr/bin --verbose
+		done local printf then
+	awk "$@" && done | && ${HOME} --verbose ${HOME} then --verbose ${HOME} then
+x=1 "$@" local && test then cd /usr/bin && "$1" then awk x=1
+		sed 2>/dev/null grep x=1 export cd echo && $(pwd) "$@" export then
+	"$1" | cd 'quoted text' "$1" awk $(pwd) test done echo test $(pwd) test 2>/dev/null
+		cd awk sed sed /usr/bin readonly done
+| awk "$@" test --verbose "$@" awk && && cd awk done ${HOME}
+test echo "$@" x=1 done ${HOME} sed ${HOME} | awk echo readonly 2>/dev/null
+		${HOME} echo && ${HOME} sed "$1" --verbose "$@" cd local export ${HOME}
+	export printf export -eu echo ${HOME}
+	x=1 done sed done cd -eu --verbose
+		--verbose sed $(pwd) | x=1 then ${HOME} --verbose test -eu x=1 && grep test $(pwd)
+export "$@" 'quoted text' printf $(pwd) echo readonly readonly done export export
+	test 2>/dev/null | printf printf "$@" "$1" local | /usr/bin echo
+	/usr/bin -eu done sed && export local "$@"
+		printf grep | printf ${HOME} then cd printf "$1" local "$@" /usr/bin
+		2>/dev/null 'quoted text' "$@" 2>/dev/null $(pwd)
+sed then x=1 ${HOME} then "$@" grep --verbose "$@" awk printf "$1" 'quoted text'
+	-eu echo export export $(pwd)
+-eu then 'quoted text' echo sed local x=1
+-eu printf export x=1 && awk test sed | -eu export --verbose $(pwd) awk test local
+		local echo readonly /usr/bin done echo printf echo readonly /usr/bin ${HOME}
+'quoted text' x=1 2>/dev/null
+--verbose /usr/bin "$@" then /usr/bin grep x=1 x=1
+	--verbose sed "$@" then x=1 done readonly "$1" done local done
+		x=1 2>/dev/null 'quoted text' x=1 "$@" cd 'quoted text' done
+then | echo 2>/dev/null --verbose grep 2>/dev/null
+	cd ${HOME} "$@" echo test
+then $(pwd) cd grep -eu "$@" readonly done then /usr/bin -eu
+		/usr/bin sed && --verbose "$1" cd local ${HOME} --verbose local --verbose
+		test $(pwd) export awk x=1
+	done awk awk export | --verbose printf "$1" readonly && "$@"
+		export export x=1 --verbose then export | local
+	"$@" grep "$@" local export done $(pwd) | export
+	-eu test 2>/dev/null cd test && x=1 'quoted text' -eu export "$1" ${HOME} 'quoted text'
+		cd export sed awk | 2>/dev/null --verbose export 'quoted text' sed
+local readonly then done then 2>/dev/null sed local "$1" /usr/bin
+	grep ${HOME} grep local
+		grep "$1" printf local grep readonly local "$1" x=1 && readonly "$1" done
+2>/dev/null test echo --verbose $(pwd) --verbose
+	readonly sed "$@" export | then "$@" echo test
+/usr/bin 2>/dev/null then sed && "$@" --verbose /usr/bin 2>/dev/null
+		then test echo awk x=1 x=1 ${HOME} 'quoted text' done awk | sed
+"$1" grep export 2>/dev/null cd
+${HOME} -eu then cd 2>/dev/null ${HOME}
+	/usr/bin done | "$@" 2>/dev/null --verbose sed local "$@" sed awk local export
+$(pwd) echo "$1" then --verbose "$@"
+	-eu "$@" cd -eu done awk "$1" /usr/bin test test grep $(pwd)
+sed "$@" awk "$@" local awk export "$@" printf $(pwd) /usr/bin test test
+		x=1 grep --verbose $(pwd) grep echo echo x=1
+'quoted text' echo grep awk "$1" /usr/bin --verbose sed
+&& -eu printf then 2>/dev/null
+echo local cd 'quoted text' local -eu printf done
+	printf test echo cd test cd "$1" 'quoted text'
+		"$@" readonly --verbose $(pwd) echo then /usr/bin $(pwd)
+		then x=1 grep | 'quoted text' -eu local sed
+		test | && /usr/bin $(pwd)
+	${HOME} | cd | export readonly --verbose $(pwd) local
+	awk 'quoted text' 2>/dev/null readonly export ${HOME} echo
+	echo awk /usr/bin echo grep echo local local local then awk -eu echo
+	"$@" done ${HOME} test local printf $(pwd) 2>/dev/null
+	"$1" echo cd readonly test awk -eu $(pwd)
+	local x=1 then printf local export
+	readonly then ${HOME} && cd 'quoted text' grep
+		readonly sed printf "$1"
+		x=1 2>/dev/null done then
+	readonly awk /usr/bin $(pwd) ${HOME} grep 2>/dev/null local && export local local
+		grep && | 'quoted text' grep "$1" local sed && then
+		cd "$@" "$@" grep done done test --verbose 'quoted text'
+	/usr/bin test grep awk "$1" "$@"
+	awk readonly 'quoted text' echo then
+		x=1 | -eu "$@" grep ${HOME} | sed
+awk /usr/bin echo then readonly /usr/bin
+echo readonly "$@" local /usr/bin
+		awk sed local 'quoted text' | sed 'quoted text' readonly echo ${HOME} local "$1"
+awk && then $(pwd) awk done "$@"
+echo test ${HOME} readonly awk /usr/bin ${HOME} local | grep
+	${HOME} test awk --verbose "$1" 2>/dev/null 'quoted text'
+	then -eu "$@" 'quoted text' && --verbose x=1 /usr/bin --verbose && -eu 2>/dev/null
+local readonly --verbose
+${HOME} grep test $(pwd) 2>/dev/null grep /usr/bin
+${HOME} /usr/bin then && ${HOME} done then grep awk && "$@" 2>/dev/null x=1
+test && echo && "$@" ${HOME} local --verbose ${HOME}
+		&& echo $(pwd) local /usr/bin ${HOME} -eu && | | --verbose
+	--verbose done local test 'quoted text' -eu done awk "$1" | echo printf --verbose
+	done cd done "$@" ${HOME} printf x=1 awk 2>/dev/null $(pwd) grep printf
+	then grep echo local -eu then "$@" then echo echo
+		-eu export && /usr/bin | readonly
+	"$@" "$@" /usr/bin grep echo 2>/dev/null -eu ${HOME} cd export
+printf echo | "$@" "$@" && export --verbose then export
+sed grep local /usr/bin --verbose cd ${HOME} local x=1 grep grep -eu $(pwd)
+	&& ${HOME} -eu export 'quoted text' export | export local printf "$1"
+printf --verbose then x=1
+		2>/dev/null | echo export 2>/dev/null awk "$@" cd --verbose
+	echo echo /usr/bin local $(pwd) readonly awk x=1 -eu 2>/dev/null |
+	$(pwd) echo awk $(pwd) ${HOME} && awk echo && test -eu awk
+		export then grep | export
+	/usr/bin "$1" sed ${HOME}
+2>/dev/null x=1 /usr/bin printf
+		cd | ${HOME} 'quoted text' awk --verbose local awk done awk readonly 'quoted text'
+grep readonly /usr/bin "$@" echo cd | sed
+cd | done ${HOME} ${HOME} 'quoted text'
+test $(pwd) $(pwd) /usr/bin -eu 2>/dev/null --verbose awk
+x=1 "$1" done printf -eu then export
+	grep | local 2>/dev/null $(pwd) then x=1 then && grep && local done |
+	sed -eu 'quoted text' printf grep awk $(pwd) ${HOME} $(pwd) local local
+-eu cd local readonly readonly "$1" && -eu export grep cd -eu
+	&& -eu readonly sed test | printf $(pwd) 'quoted text' echo x=1 && printf
+	x=1 --verbose --verbose /usr/bin && echo printf 2>/dev/null
+	--verbose x=1 --verbose export grep /usr/bin sed done
+awk export local cd | cd awk --verbose "$1" grep /usr/bin
+		'quoted text' x=1 then --verbose 'quoted text' "$@" 2>/dev/null $(pwd) --verbose
+	&& then then grep cd printf export readonly printf printf
+awk --verbose x=1 cd grep ${HOME} "$1" 2>/dev/null
+		--verbose -eu grep export then -eu "$@" ${HOME}
+		"$@" ${HOME} awk local
+		grep local sed x=1 awk &&
+	| printf awk sed 2>/dev/null local printf
+2>/dev/null -eu grep 2>/dev/null
+		grep export printf "$1" 'quoted text' local -eu -eu "$@" /usr/bin echo
+		cd --verbose local $(pwd) /usr/bin
+	/usr/bin cd $(pwd) readonly -eu x=1 awk /usr/bin
+		/usr/bin echo -eu test 'quoted text'
+	export sed -eu $(pwd) cd awk "$@" ${HOME} x=1 2>/dev/null -eu local
+	$(pwd) local 'quoted text' x=1 done
+	x=1 'quoted text' then export sed 'quoted text'
+	local -eu && echo readonly
+	--verbose printf done
+"$@" --verbose export done
+		--verbose "$@" "$1" then 2>/dev/null
+		printf && 2>/dev/null readonly -eu /usr/bin done
+	"$@" x=1 readonly 2>/dev/null local local --verbose $(pwd) && readonly sed then
+	2>/dev/null 'quoted text'
+x=1 test local cd -eu local printf
+--verbose awk ${HOME} "$1" --verbose
+-eu readonly readonly | export | --verbose
+sed x=1 printf export ${HOME} test /usr/bin
+	${HOME} local 2>/dev/null 2>/dev/null --verbose then done x=1 2>/dev/null
+	-eu done sed test test "$1"
+		grep "$1" local grep "$@" echo sed "$@"
+	x=1 "$1" local echo readonly awk
+	export x=1 --verbose local grep --verbose
+done | then --verbose 2>/dev/null
+	x=1 local 2>/dev/null printf cd grep /usr/bin | cd 2>/dev/null then $(pwd)
+"$1" | 2>/dev/null awk "$@" -eu readonly grep done --verbose printf "$1"
+	--verbose 'quoted text' "$@" readonly local grep sed local
+"$1" "$1" export /usr/bin
+		--verbose printf --verbose printf ${HOME} "$1" && sed sed /usr/bin
+		"$1" 'quoted text' grep
+	local "$1" x=1 local ${HOME} "$@" --verbose
+${HOME} readonly cd "$@" local "$1" /usr/bin readonly 2>/dev/null 'quoted text'
+	--verbose 'quoted text' then && "$1" 'quoted text' then /usr/bin
+	cd && readonly done 'quoted text' && test cd done -eu 2>/dev/null $(pwd) "$@"
+		2>/dev/null --verbose ${HOME} 'quoted text' cd awk $(pwd) export "$1" $(pwd)
+		"$1" 2>/dev/null /usr/bin done && local echo ${HOME}
+cd echo -eu local sed done done ${HOME} export test "$@" then grep
+	&& done "$@" /usr/bin awk x=1 $(pwd) then | awk test sed
+		done sed "$1" printf 2>/dev/null /usr/bin grep -eu printf
+		grep sed export local /usr/bin
+sed cd | local /usr/bin export
+	/usr/bin awk "$1" -eu /usr/bin done && done -eu /usr/bin then
+sed sed ${HOME} then $(pwd) 2>/dev/null
+	--verbose /usr/bin cd /usr/bin 'quoted text' echo ${HOME} awk readonly
+	/usr/bin then then x=1 test awk printf cd "$1" /usr/bin
+awk done ${HOME} -eu ${HOME}
+		| --verbose grep grep done grep echo $(pwd) ${HOME} then
+	grep "$1" 2>/dev/null echo "$1"
+	${HOME} ${HOME} $(pwd)
+		x=1 ${HOME} echo grep printf export ${HOME}
+		${HOME} ${HOME} | awk printf readonly
+		local test x=1 x=1 ${HOME} printf ${HOME} "$1" "$@" x=1 ${HOME} cd
+	"$@" x=1 cd && 2>/dev/null sed printf done /usr/bin
+	done then printf && cd done echo sed -eu 'quoted text' 2>/dev/null --verbose &&
+		${HOME} | x=1 cd --verbose x=1 -eu printf x=1
+		&& cd export -eu printf
+		then test "$@" export echo grep
+	cd | "$@" test local | "$@" ${HOME} x=1 $(pwd)
+| /usr/bin "$@" sed readonly "$1" awk | $(pwd) | sed grep
+&& -eu echo sed local sed |
+	${HOME} "$@" "$@" readonly 'quoted text' printf | -eu &&
+		cd ${HOME} $(pwd) "$@" $(pwd) done printf readonly cd $(pwd)
+		-eu grep echo cd | echo | --verbose -eu x=1 export done printf && awk "$@"
+local 2>/dev/null ${HOME}
+	-eu done then 'quoted text'
+/usr/bin "$@" 'quoted text' /usr/bin 2>/dev/null --verbose 'quoted text'
+		printf local 2>/dev/null /usr/bin
+	test "$1" --verbose | done 'quoted text'
+	--verbose --verbose && -eu printf 'quoted text'
+	x=1 then 2>/dev/null sed "$@"
+${HOME} x=1 sed then 'quoted text' "$@" --verbose -eu awk test --verbose
+		"$@" $(pwd) "$@" printf cd x=1 export
+'quoted text' "$@" printf ${HOME} printf 2>/dev/null local printf "$1" echo
+		/usr/bin awk awk /usr/bin "$1" awk ${HOME} grep local
+		/usr/bin grep cd 2>/dev/null
+		printf then | awk test ${HOME} then test
+		"$1" done 2>/dev/null $(pwd) --verbose x=1 -eu && export $(pwd)
+		awk ${HOME} awk grep sed test grep "$@" && local local then sed echo
+	/usr/bin | x=1 grep "$1" 'quoted text' "$@" x=1 --verbose readonly local awk
+	x=1 test test awk ${HOME} then "$@" readonly
+	&& export 2>/dev/null readonly
+	| ${HOME} test /usr/bin /usr/bin readonly then local printf then /usr/bin ${HOME}
+		then test -eu local sed --verbose
+"$@" echo $(pwd) done ${HOME} echo -eu done export cd grep export sed
+"$1" -eu then "$@" then -eu printf "$@" done "$@" sed readonly cd local "$1" &&
+		readonly awk then done && awk ${HOME}
+		${HOME} grep "$@" 2>/dev/null --verbose awk ${HOME} 'quoted text' grep $(pwd)
+awk printf x=1 | sed x=1 grep echo export then --verbose
+test 2>/dev/null 'quoted text' awk cd
+		'quoted text' 'quoted text' 2>/dev/null done $(pwd)
+	printf local echo x=1 ${HOME} sed --verbose
+2>/dev/null ${HOME} awk readonly awk
+		grep /usr/bin awk cd "$@" sed awk
+		done printf --verbose "$@" local /usr/bin
+	local cd --verbose -eu $(pwd) x=1 /usr/bin printf ${HOME} export
+	done --verbose 'quoted text' printf
+		$(pwd) sed $(pwd) | 2>/dev/null --verbose echo
+	'quoted text' printf $(pwd)
+	test | 2>/dev/null --verbose done "$1"
+local x=1 /usr/bin && printf local printf grep ${HOME}
+		"$1" "$@" -eu echo "$@" $(pwd) echo x=1 ${HOME} && x=1 local -eu ${HOME}
+	grep done readonly then
+| printf grep 'quoted text'
+$(pwd) sed $(pwd) /usr/bin sed 2>/dev/null echo printf -eu && --verbose -eu 'quoted text'
+		| "$@" "$1" echo local export
+	printf cd "$1" && test ${HOME} -eu echo
+	-eu local | "$@" "$1" echo grep sed
+&& | /usr/bin then echo "$@" ${HOME} export echo
+cd awk done cd printf done "$1" cd awk --verbose
+		-eu sed export awk | ${HOME} export
+	"$@" --verbose | $(pwd)
+	local | 'quoted text' | 'quoted text'
+		--verbose ${HOME} "$1" export -eu
+	-eu -eu -eu export local --verbose
+		printf done --verbose cd $(pwd) 'quoted text' 'quoted text' test echo /usr/bin
+cd ${HOME} printf && "$1" readonly 2>/dev/null local
+		"$1" ${HOME} test x=1 /usr/bin local
+"$@" grep then then | readonly export /usr/bin x=1 sed sed
+		export then --verbose local && -eu $(pwd) echo printf
+	| "$@" sed readonly cd --verbose 'quoted text' x=1 "$@"
+	echo && grep --verbose awk sed /usr/bin
+then cd --verbose then --verbose && grep
+	test grep local --verbose | readonly
+	&& local 'quoted text' readonly x=1 echo awk 'quoted text'
+	test && 'quoted text' sed ${HOME} && "$@" | printf 'quoted text' /usr/bin
+	2>/dev/null "$@" printf $(pwd) export
+		echo 'quoted text' 2>/dev/null
+		echo then done 2>/dev/null echo --verbose
+	${HOME} $(pwd) sed && && done --verbose "$1"
+	sed cd then -eu "$@" -eu "$1" cd
+cd then 2>/dev/null 'quoted text'
+		sed readonly awk grep | local 'quoted text' x=1 export
+	echo echo then sed test 2>/dev/null
+"$@" 2>/dev/null x=1 done ${HOME} 2>/dev/null grep $(pwd) -eu $(pwd) local
+'quoted text' grep done -eu test ${HOME}
+"$@" x=1 grep sed | /usr/bin 'quoted text'
+		| 'quoted text' "$1" echo export cd "$@" echo 'quoted text'
+| | 'quoted text' ${HOME} local then test
+		awk 2>/dev/null "$1" $(pwd) /usr/bin
+		$(pwd) 'quoted text'
+		sed test done done "$@" echo grep "$1" cd readonly
+--verbose readonly export | local cd
+	/usr/bin ${HOME} --verbose
+		$(pwd) x=1 --verbose echo -eu 2>/dev/null &&
+	/usr/bin echo x=1 -eu printf echo local printf
+		&& x=1 ${HOME} "$1" printf
+	x=1 cd && /usr/bin | grep
+'quoted text' $(pwd) cd /usr/bin export /usr/bin local test -eu
+	-eu "$1" echo then done
+		grep | && then cd test
+		2>/dev/null export then && /usr/bin
+cd x=1 "$@" ${HOME} echo printf then cd then 'quoted text' awk local
+	2>/dev/null awk 2>/dev/null "$@" test export ${HOME} then
+		"$@" cd "$@" x=1 2>/dev/null test x=1 grep
+test local 'quoted text' "$@" ${HOME} ${HOME} local "$1" -eu
+	x=1 then readonly $(pwd)
+	$(pwd) $(pwd) "$1" echo ${HOME}
+	'quoted text' x=1 /usr/bin "$@" ${HOME} grep printf && $(pwd) /usr/bin 'quoted text'
+cd awk "$1" /usr/bin x=1 2>/dev/null 2>/dev/null | then
+	local printf local echo then 2>/dev/null done test "$1" readonly 2>/dev/null
+	&& test 2>/dev/null echo /usr/bin cd done printf --verbose
+	$(pwd) test /usr/bin awk sed x=1 x=1 export echo done done -eu
+		grep echo 'quoted text' "$@" awk --verbose echo test 'quoted text'
+	then && -eu x=1 local printf
+	$(pwd) printf | then /usr/bin x=1 ${HOME} 'quoted text' "$1" export "$@" -eu x=1
+		then echo printf grep local --verbose readonly
+	| grep echo awk -eu $(pwd) done "$@" /usr/bin $(pwd) echo "$@"
+		export $(pwd) "$@" cd export && 'quoted text'
+		| 2>/dev/null done cd "$1" echo cd -eu /usr/bin sed
+	sed then readonly "$1" local ${HOME} done awk
+	x=1 && && "$1" 2>/dev/null export then export awk
+--verbose export test "$@" printf /usr/bin 'quoted text' && && 2>/dev/null
+	"$1" test --verbose --verbose done ${HOME} then 'quoted text' echo then
+		"$1" cd echo awk done cd 'quoted text' x=1 | 'quoted text'
+local x=1 "$@" -eu then
+	--verbose echo cd x=1 --verbose "$1" cd "$@" /usr/bin &&
+		printf sed cd 'quoted text' sed x=1 then && export
+		$(pwd) 2>/dev/null --verbose awk -eu local export readonly export x=1 | /usr/bin
+	readonly export readonly done done sed export export echo
+awk cd sed test export /usr/bin && ${HOME}
+	${HOME} | ${HOME} /usr/bin $(pwd) "$@" --verbose export --verbose
+		awk /usr/bin /usr/bin then local printf test
+"$@" echo echo printf
+	${HOME} local echo $(pwd) done -eu ${HOME}
+		x=1 awk && printf grep 'quoted text' 'quoted text'
+done $(pwd) 2>/dev/null | && && 'quoted text' printf && "$1" /usr/bin $(pwd)
+		done 'quoted text' then | $(pwd) export echo readonly
+then $(pwd) $(pwd) local ${HOME} done then --verbose "$1"
+	${HOME} 'quoted text' && local -eu printf printf printf x=1 $(pwd)
+local && --verbose export | echo "$1" 2>/dev/null /usr/bin grep sed 'quoted text'
+export cd $(pwd) echo x=1 export
+		$(pwd) readonly test then "$@" /usr/bin /usr/bin "$@" x=1 ${HOME}
+	"$@" export "$1" cd sed local 'quoted text'
+		| 'quoted text' | -eu "$1" readonly "$@" done "$1" awk printf "$@"
+		awk sed export test local /usr/bin
+		/usr/bin && ${HOME} awk grep grep && && printf sed cd | sed
+	cd export readonly "$1" test test && /usr/bin echo 'quoted text' sed
+	done -eu grep x=1 ${HOME} --verbose -eu echo ${HOME} awk grep -eu
+/usr/bin printf 'quoted text' $(pwd) ${HOME} "$1" $(pwd) sed
+		sed done $(pwd) 'quoted text' then cd 2>/dev/null
+	/usr/bin x=1 echo readonly readonly
+	echo ${HOME} echo "$@" readonly then awk | 'quoted text' printf printf grep -eu
+		"$1" export $(pwd) sed $(pwd) -eu echo then && export $(pwd) 'quoted text'
+	"$@" cd 2>/dev/null --verbose --verbose --verbose --verbose readonly sed "$@"
+$(pwd) ${HOME} local then
+	printf 2>/dev/null readonly x=1 local $(pwd)
+	echo x=1 echo test -eu printf test
+		then "$1" /usr/bin /usr/bin 'quoted text'
+	--verbose export "$@" ${HOME} local
+	local ${HOME} test /usr/bin cd | &&
+		$(pwd) --verbose ${HOME} awk done done readonly 'quoted text' awk grep | test
+		export --verbose $(pwd) sed cd && sed test export
+	/usr/bin echo grep --verbose printf -eu ${HOME}
+	readonly printf --verbose | local && | "$@" printf
+		echo --verbose -eu grep /usr/bin && test export then sed grep export /usr/bin
+sed 'quoted text' readonly /usr/bin 'quoted text' local cd test
+	| export x=1 then $(pwd) && local echo x=1 /usr/bin /usr/bin cd awk
+2>/dev/null "$@" 2>/dev/null 2>/dev/null test
+	"$@" local | local "$1" "$@" "$@" &&
+		'quoted text' "$1" 2>/dev/null awk --verbose ${HOME}
+| /usr/bin printf test sed 'quoted text'
+	done readonly ${HOME} export readonly
+	x=1 && done awk readonly /usr/bin export done "$1" "$@"
+	local $(pwd) sed local "$1" test ${HOME} done echo "$@"
+printf local ${HOME} done
+	printf 2>/dev/null $(pwd) ${HOME} $(pwd)
+echo x=1 && done readonly local cd $(pwd)
+		export --verbose -eu awk test export 'quoted text'
+		echo ${HOME} awk --verbose printf 2>/dev/null 2>/dev/null | $(pwd) ${HOME}
+cd printf printf printf
+		test /usr/bin $(pwd) x=1 | echo -eu 2>/dev/null $(pwd) "$1" ${HOME} test
+cd echo && x=1 ${HOME} printf /usr/bin ${HOME} -eu --verbose echo export x=1
+		local 'quoted text' | grep sed readonly cd x=1 'quoted text' test "$@" && then
+	--verbose readonly x=1
+export 2>/dev/null "$1" sed
+		2>/dev/null 'quoted text' test grep ${HOME}
+-eu then local printf x=1 2>/dev/null 'quoted text'
+		${HOME} readonly export /usr/bin -eu 2>/dev/null |
+		${HOME} $(pwd) ${HOME} /usr/bin $(pwd) ${HOME} then
+grep then readonly -eu export grep -eu ${HOME} && local
+grep 'quoted text' x=1 'quoted text' printf -eu 2>/dev/null local
+		awk "$1" --verbose readonly x=1 && printf
+	test export "$1" 'quoted text'
+		-eu x=1 -eu | cd x=1 echo test x=1 x=1 test cd awk
+export readonly then local 'quoted text' && printf local done
+printf && "$1" -eu --verbose /usr/bin /usr/bin grep --verbose ${HOME} done
+		"$@" test printf done x=1 grep ${HOME} grep "$@" -eu local printf ${HOME} test
+local done echo "$@" 2>/dev/null 'quoted text' then test readonly
+	test "$@" awk -eu echo | printf /usr/bin done printf $(pwd) /usr/bin grep
+x=1 -eu 2>/dev/null printf test $(pwd) readonly "$1" local cd cd awk sed
+'quoted text' awk readonly sed ${HOME} -eu test
+	$(pwd) -eu --verbose awk echo "$@" ${HOME} grep echo --verbose
+		printf --verbose && 'quoted text' ${HOME} 'quoted text'
+		2>/dev/null x=1 printf /usr/bin ${HOME} 2>/dev/null printf done | readonly "$1"
+	test done --verbose sed printf x=1 "$1" x=1 $(pwd) cd grep export then
+	local echo && $(pwd) export test test && "$1" readonly --verbose "$@" printf
+printf | x=1 sed "$1" x=1 export ${HOME} 'quoted text' awk sed | /usr/bin
+| cd | done local local -eu "$1" readonly
+	sed export && grep 'quoted text' sed cd echo x=1
+	cd "$@" /usr/bin --verbose --verbose
+then sed -eu /usr/bin cd "$1" sed | --verbose ${HOME} /usr/bin
+/usr/bin "$1" ${HOME}
+	$(pwd) then sed x=1 sed local
+		echo ${HOME} ${HOME} 2>/dev/null ${HOME}
+		printf then "$1" then echo | test readonly grep grep
+	readonly && | done && done | test /usr/bin "$1" |
+		&& printf grep sed local $(pwd) sed grep $(pwd) 'quoted text' "$1" cd local
+	awk awk cd 2>/dev/null export "$1" then "$1" 'quoted text'
+		sed test test 2>/dev/null sed "$@" x=1 done /usr/bin
+		echo ${HOME} sed 2>/dev/null test local ${HOME}
+	x=1 echo grep "$@" -eu export "$1" done x=1 export | grep awk local ${HOME}
+2>/dev/null export | | && ${HOME} && awk done test done | grep grep "$1" -eu
+	done "$@" --verbose --verbose cd "$1" 'quoted text' test sed x=1
+	echo awk --verbose done sed $(pwd) done cd -eu then -eu && x=1 export 'quoted text'
+	$(pwd) 2>/dev/null --verbose grep --verbose readonly x=1 cd
+	printf 'quoted text' then
+	${HOME} /usr/bin /usr/bin awk 2>/dev/null cd ${HOME}
+--verbose 2>/dev/null | 2>/dev/null 2>/dev/null
+		readonly echo readonly 2>/dev/null -eu | | 'quoted text'
+		done sed export printf then readonly export
+		local -eu echo --verbose -eu awk 2>/dev/null printf | ${HOME} "$1" then x=1
+	grep awk test export $(pwd) sed grep done -eu --verbose && "$@" && grep
+cd /usr/bin cd "$@" ${HOME} 'quoted text' then test x=1 ${HOME}
+		x=1 "$1" test ${HOME} awk $(pwd) export done ${HOME} readonly "$1" "$1" test
+		grep /usr/bin "$@" "$@" done local "$1" test "$@" ${HOME} && -eu
+	x=1 --verbose "$@" --verbose x=1 'quoted text' done
+		echo 'quoted text' done | ${HOME} $(pwd) && test printf grep export done awk
+	--verbose x=1 "$@" ${HOME} test "$@" grep
+	done test local test -eu | /usr/bin readonly ${HOME} 'quoted text' 2>/dev/null
+readonly then grep 2>/dev/null grep ${HOME} local local then && x=1 cd &&
+"$1" then -eu export cd echo test --verbose echo -eu grep x=1 "$@" grep
+printf --verbose "$1" && |
+local then x=1 $(pwd) "$1" --verbose export
+		then test "$@" done echo 2>/dev/null
+		2>/dev/null /usr/bin awk x=1 readonly
+x=1 | echo export then | && -eu echo readonly cd then
+		"$@" awk -eu readonly
+		cd --verbose export /usr/bin x=1 x=1 test
+--verbose grep $(pwd) then export grep x=1 "$1" grep x=1 --verbose x=1 ${HOME}
+test readonly sed 2>/dev/null
+		'quoted text' --verbose then done "$@" local local awk
+		readonly then | printf "$@" && local &&
+	"$@" awk x=1 -eu sed
+	sed export sed test test "$@" awk -eu 'quoted text' test cd "$1" x=1 awk "$1"
+"$@" awk /usr/bin | test test 'quoted text' readonly "$1" grep then
+		readonly awk awk | grep then grep | ${HOME}
+		'quoted text' && test printf --verbose -eu done then then ${HOME}
+		awk echo cd ${HOME} ${HOME} x=1 | awk "$1" readonly test
+		test printf test 'quoted text' cd sed --verbose ${HOME} then "$1" 2>/dev/null
+awk 2>/dev/null awk /usr/bin ${HOME} | ${HOME} done echo awk "$@" grep
+then test x=1 then printf local
+readonly 2>/dev/null local local ${HOME} --verbose x=1 &&
+	readonly printf done done | printf then grep grep echo local "$@" echo --verbose
+	/usr/bin && 2>/dev/null | export echo x=1 /usr/bin done echo echo export
+		echo /usr/bin then --verbose local ${HOME}
+		| done --verbose && ${HOME} "$@" sed then then export local grep --verbose
+grep export --verbose $(pwd) /usr/bin printf
+grep local && then grep
+sed x=1 then x=1 sed "$1"
+$(pwd) echo "$1" sed x=1 sed cd 2>/dev/null cd "$1" readonly
+		"$1" && cd $(pwd) test local 'quoted text' echo 2>/dev/null
+	grep export export /usr/bin -eu readonly ${HOME} && readonly | local
+		cd && export echo /usr/bin 'quoted text' local cd -eu | && then x=1
+		x=1 test export /usr/bin 'quoted text' cd
+		awk readonly "$@" && test export -eu awk $(pwd) "$@"
+/usr/bin $(pwd) && "$@" cd awk "$1" awk then "$1"
+--verbose ${HOME} && readonly $(pwd) "$1" | "$@" --verbose 'quoted text'
+awk ${HOME} ${HOME} sed echo local printf cd readonly
+	then cd readonly test ${HOME} ${HOME} test
+	grep ${HOME} readonly "$1" echo local | x=1 readonly printf
+	local echo test local then grep ${HOME} local
+		readonly echo ${HOME} $(pwd) printf "$@" readonly --verbose /usr/bin
+		&& local 2>/dev/null && 'quoted text' sed printf readonly printf
+	-eu --verbose ${HOME} /usr/bin
+		sed echo 2>/dev/null then 2>/dev/null /usr/bin readonly
+		'quoted text' then cd 'quoted text' | -eu $(pwd) test echo ${HOME} export
+	grep /usr/bin x=1 sed "$1" echo test cd | awk
+test ${HOME} grep printf && local export echo readonly -eu 'quoted text'
+test then cd awk $(pwd) -eu local test printf &&
+-eu "$1" readonly grep | test cd "$@"
+"$1" cd --verbose printf --verbose | echo | && echo then test test
+export then | x=1 test then -eu $(pwd) awk x=1 x=1 local -eu x=1 sed 'quoted text'
+		x=1 readonly $(pwd) done echo
+	"$@" x=1 x=1 'quoted text' /usr/bin
+export --verbose /usr/bin "$@" --verbose 'quoted text'
+		--verbose && cd $(pwd) $(pwd) printf ${HOME}
+${HOME} awk cd readonly cd --verbose local 'quoted text'
+		$(pwd) sed local then local cd grep $(pwd)
+&& export /usr/bin && "$1" -eu | readonly
+	sed sed x=1 local sed cd printf && x=1 local awk awk then local 'quoted text'
+awk $(pwd) 'quoted text' then local done --verbose /usr/bin $(pwd) readonly
+	sed done --verbose grep /usr/bin awk sed ${HOME} "$@" /usr/bin
+	printf 'quoted text' echo cd --verbose grep && && 'quoted text' then -eu &&
+		cd done echo 2>/dev/null test "$@" -eu $(pwd) cd cd -eu
+	${HOME} "$1" /usr/bin
+${HOME} ${HOME} awk -eu
+export x=1 echo printf -eu readonly
+local echo 'quoted text' awk echo $(pwd) sed local
+"$1" sed printf $(pwd) x=1 $(pwd) | then 2>/dev/null
+	cd "$1" 2>/dev/null echo "$1"
+		$(pwd) then "$1" local "$1" /usr/bin -eu
+x=1 /usr/bin test ${HOME} $(pwd) $(pwd) | export
+		'quoted text' 2>/dev/null test 'quoted text' /usr/bin
+		--verbose test /usr/bin $(pwd) -eu x=1
+		readonly ${HOME} printf ${HOME} then readonly
+echo | cd sed test x=1 printf 2>/dev/null echo export "$@" export local -eu echo
+		| | echo 'quoted text' grep
+		grep local cd $(pwd) awk then done awk grep "$@" cd export readonly
+		${HOME} done sed /usr/bin -eu test done ${HOME} then grep 'quoted text'
+'quoted text' done -eu test awk cd cd $(pwd) cd $(pwd) then grep
+-eu && --verbose "$@" x=1 "$1" then done /usr/bin
+/usr/bin then then && /usr/bin
+		| awk "$@" 'quoted text' done awk readonly -eu
+sed done | cd --verbose sed | then grep echo | grep "$1" && grep 'quoted text'
+		readonly awk then 2>/dev/null $(pwd) ${HOME} export --verbose 2>/dev/null /usr/bin
+	'quoted text' && --verbose "$1" done local -eu -eu --verbose | test
+	| export 'quoted text' $(pwd) sed 'quoted text' 'quoted text' cd /usr/bin
+local done cd 'quoted text' /usr/bin ${HOME}
+	done 'quoted text' sed local
+export printf x=1 export cd printf 2>/dev/null "$1" test
+${HOME} -eu /usr/bin $(pwd) ${HOME} | | then $(pwd) cd awk
+	test echo echo ${HOME} local echo awk -eu
+sed /usr/bin "$@" then "$@" 2>/dev/null export
+done sed local "$@" then -eu && x=1 local | "$1" echo | ${HOME} sed
+	"$@" then x=1 local $(pwd) 'quoted text'
+		readonly -eu cd grep sed test
+		2>/dev/null sed -eu -eu -eu test ${HOME} echo grep echo done 2>/dev/null
+	-eu "$1" "$@" local x=1 sed readonly && ${HOME} 2>/dev/null /usr/bin ${HOME}
+	-eu cd $(pwd) awk test -eu x=1 printf 2>/dev/null --verbose
+local sed | "$@" x=1 export test then cd "$1" readonly echo test
+"$@" 'quoted text' cd | readonly 2>/dev/null then 2>/dev/null
+	${HOME} readonly local 'quoted text' printf 'quoted text'
+		then "$@" 'quoted text' printf done x=1 | test
+		"$@" readonly cd $(pwd) 2>/dev/null printf "$@" "$@"
+${HOME} echo then && ${HOME} echo | -eu grep done cd | awk export sed then
+-eu /usr/bin "$1" then awk then grep readonly readonly grep
+	echo printf "$@" cd grep
+		--verbose readonly "$1" "$@" /usr/bin echo export x=1 "$@" local -eu awk then
+	local $(pwd) ${HOME} "$1" awk 2>/dev/null grep ${HOME}
+		'quoted text' ${HOME} -eu x=1 /usr/bin 'quoted text' done "$1" -eu $(pwd) sed awk
+&& -eu 'quoted text' cd x=1 $(pwd) readonly sed x=1 -eu "$@" --verbose
+"$1" grep -eu 'quoted text' x=1 awk
+	-eu | readonly "$@" --verbose -eu ${HOME} export
+		| "$1" printf export readonly
+	'quoted text' grep export x=1 | then $(pwd)
+		'quoted text' 2>/dev/null readonly $(pwd) "$1" test awk ${HOME} then "$1" 'quoted text'
+		printf cd "$1" local $(pwd) 2>/dev/null 2>/dev/null x=1 $(pwd) --verbose readonly
+	'quoted text' x=1 $(pwd) readonly awk --verbose cd done 2>/dev/null | printf
+test sed /usr/bin local awk 'quoted text' "$1" printf readonly local && export
+		"$@" echo test local done "$@" $(pwd) done "$1" test echo
+		readonly then --verbose test ${HOME} printf export "$1"
+	| then -eu sed x=1 2>/dev/null && readonly readonly 2>/dev/null -eu sed 'quoted text'
+awk | awk then done "$1" 'quoted text' $(pwd) --verbose then ${HOME}
+2>/dev/null echo sed then export awk export -eu
+&& && export x=1 ${HOME}
+	then grep local $(pwd) readonly 2>/dev/null /usr/bin "$@" x=1 then local
+then --verbose printf sed local export awk printf
+/usr/bin grep printf | | awk | echo
+x=1 cd && then 'quoted text' printf sed cd then
+		/usr/bin cd "$1" /usr/bin then "$1" /usr/bin cd "$1" --verbose "$1" "$@"
+	| --verbose awk test printf | && |
+		x=1 /usr/bin | -eu local readonly -eu local
+	| sed 2>/dev/null cd $(pwd) 'quoted text' awk "$@"
+		local echo "$@" sed 2>/dev/null
+		"$1" 'quoted text' $(pwd) 2>/dev/null local --verbose grep | cd
+2>/dev/null && export
+	| -eu local x=1 export test cd /usr/bin test --verbose $(pwd) awk
+	| && "$1" 'quoted text' x=1 2>/dev/null
+printf awk $(pwd) -eu 2>/dev/null && "$@" ${HOME} test | "$@" ${HOME} "$1" readonly
+		'quoted text' awk cd && $(pwd) sed done | 2>/dev/null sed /usr/bin "$@" test &&
+		x=1 grep 'quoted text' cd && echo done --verbose
+"$@" then cd echo test sed /usr/bin
+export local printf /usr/bin echo
+x=1 ${HOME} -eu sed then | |
+--verbose export -eu export --verbose then "$@" "$1" local grep
+test | /usr/bin "$1" 'quoted text' "$@" local ${HOME} grep 'quoted text' ${HOME}
+	--verbose ${HOME} cd echo cd cd printf 2>/dev/null local
+echo | export 'quoted text' export export
+	export readonly grep $(pwd) export echo
+&& local done && "$1" readonly export readonly awk awk /usr/bin -eu cd $(pwd) readonly
+done --verbose $(pwd) export
+	local export local "$@" | readonly /usr/bin && printf && export then
+		2>/dev/null done printf x=1 awk echo awk /usr/bin "$@"
+		awk -eu printf grep grep export cd --verbose awk local grep readonly
+	"$1" test grep && local $(pwd) sed printf then echo --verbose
+		printf $(pwd) 2>/dev/null then printf
+		&& 2>/dev/null $(pwd) $(pwd) then then readonly &&
+	then readonly awk cd grep
+grep local | cd 2>/dev/null local | /usr/bin echo local
+	$(pwd) $(pwd) cd grep -eu local | ${HOME} 'quoted text' -eu grep &&
+	sed local | --verbose test test
+"$1" $(pwd) /usr/bin ${HOME} local readonly echo 2>/dev/null grep -eu echo
+'quoted text' | && ${HOME}
+local 2>/dev/null $(pwd) sed
+	test readonly echo grep local /usr/bin x=1 grep then awk --verbose
+		| x=1 readonly printf local done export "$@" done ${HOME} test
+		x=1 "$@" /usr/bin -eu x=1 export ${HOME}
+	echo 2>/dev/null 2>/dev/null && 2>/dev/null 'quoted text'
+	$(pwd) 2>/dev/null 'quoted text' $(pwd) /usr/bin local | | done
+	sed echo "$@" printf export then 'quoted text'
+$(pwd) readonly /usr/bin awk export 2>/dev/null
+		"$1" 'quoted text' then
+	x=1 && -eu && /usr/bin
+	test "$@" printf printf grep then x=1 echo "$1"
+		/usr/bin readonly "$1" x=1 echo printf then sed then local awk awk "$1" sed
+grep printf ${HOME} 2>/dev/null awk 'quoted text'
+	readonly x=1 readonly grep "$1"
+		echo grep readonly export x=1 /usr/bin cd cd done readonly
+	| 'quoted text' then 2>/dev/null
+	echo done echo 2>/dev/null cd awk sed awk done cd export echo
+echo && sed x=1 awk "$@" echo readonly
+		2>/dev/null then 'quoted text'
+		then test 'quoted text' test sed
+	/usr/bin readonly then ${HOME} "$1" --verbose
+	2>/dev/null $(pwd) $(pwd) x=1 local readonly awk "$1" $(pwd) awk export
+		local done -eu echo local then "$1" echo readonly export
+	then 'quoted text' ${HOME}
+		$(pwd) 'quoted text' test readonly sed sed && done export ${HOME} | ${HOME}
+		"$@" readonly --verbose export grep ${HOME} local "$@" | test
+$(pwd) test test && /usr/bin grep cd test ${HOME} done grep && local local
+		${HOME} "$@" done x=1 then && grep grep "$1" readonly grep 2>/dev/null
+		"$@" -eu x=1 then readonly cd
+	| awk --verbose --verbose export readonly then then cd export readonly 2>/dev/null
+		-eu test export && readonly "$1" "$1" 2>/dev/null awk awk x=1 echo -eu
+		| "$1" x=1 cd readonly grep | done
+printf 'quoted text' --verbose -eu 2>/dev/null "$@" "$@" readonly
+		echo /usr/bin && export -eu printf "$@" /usr/bin 2>/dev/null
+cd "$1" sed -eu local awk 'quoted text' $(pwd) readonly
+readonly x=1 echo 'quoted text' x=1 x=1 echo then
+local x=1 done $(pwd) /usr/bin then
+		/usr/bin readonly -eu /usr/bin && | printf --verbose
+	test --verbose echo cd && awk &&
+	echo "$@" printf "$1" ${HOME} awk grep cd ${HOME} done | "$@" ${HOME}
+		-eu 2>/dev/null awk grep
+"$1" "$1" sed "$1" $(pwd) "$@" sed awk -eu test && -eu 2>/dev/null "$@" "$1" 'quoted text'
+	then echo cd $(pwd) --verbose /usr/bin -eu printf x=1 export
+		${HOME} echo local x=1 'quoted text' 'quoted text' x=1 grep /usr/bin
+	printf printf then done 2>/dev/null "$@" readonly && /usr/bin
+	test ${HOME} sed done awk "$1" "$@" awk test --verbose --verbose "$@"
+local grep && /usr/bin sed cd x=1 grep grep awk printf done
+	2>/dev/null --verbose export grep | /usr/bin cd "$@" /usr/bin readonly sed local
+	export test $(pwd) && export ${HOME} -eu ${HOME} | printf test "$@"
+	--verbose test 'quoted text' awk -eu then "$@" /usr/bin
+printf awk export -eu /usr/bin test done
+"$@" grep local --verbose x=1 grep -eu
+		$(pwd) then done local --verbose 2>/dev/null
+		&& echo sed --verbose grep 'quoted text' ${HOME} test test sed -eu 2>/dev/null
+$(pwd) ${HOME} --verbose "$@" x=1 --verbose printf
+	echo x=1 /usr/bin export $(pwd) awk local export 2>/dev/null x=1 $(pwd)
+		awk /usr/bin cd export 2>/dev/null sed
+		then /usr/bin test grep local
+test then echo test -eu && x=1 /usr/bin test grep ${HOME}
+	cd test cd && -eu grep --verbose 2>/dev/null 'quoted text' echo grep | |
+		-eu echo "$@" printf /usr/bin /usr/bin "$@" export sed echo
+	awk printf then /usr/bin "$@" $(pwd) $(pwd) grep grep $(pwd) sed echo
+	"$@" printf sed | --verbose 'quoted text' --verbose cd &&
+&& $(pwd) -eu sed ${HOME} "$@" grep sed
+		grep | readonly ${HOME} echo test done "$1" /usr/bin then 2>/dev/null
+&& /usr/bin grep && echo test && | -eu ${HOME} ${HOME}
+		'quoted text' "$@" | export --verbose sed $(pwd) && "$1" 2>/dev/null
+		export echo -eu cd --verbose then sed x=1 then 'quoted text'
+&& $(pwd) 'quoted text' /usr/bin local sed $(pwd) cd "$1" readonly done
+"$@" --verbose export local
+		local grep "$@" | 'quoted text' sed --verbose readonly /usr/bin sed ${HOME}
+&& --verbose --verbose sed x=1 | awk "$1"
+--verbose readonly $(pwd) printf "$@"
+	local test grep "$1" "$@" local 2>/dev/null --verbose -eu
+		/usr/bin cd cd cd echo --verbose --verbose -eu ${HOME} local | cd $(pwd) &&
+	--verbose echo --verbose && && | 2>/dev/null echo grep sed
+"$@" -eu 'quoted text'
+export done readonly sed && then /usr/bin local $(pwd) && "$1" "$@" &&
+${HOME} 2>/dev/null awk
+awk x=1 local local sed awk export ${HOME} /usr/bin $(pwd) printf printf printf
+		$(pwd) test awk && && $(pwd) -eu "$@" echo
+		done export export 2>/dev/null "$1" then
+--verbose ${HOME} "$1" "$@"
+"$@" export echo awk local --verbose && readonly -eu cd ${HOME}
+		test $(pwd) readonly awk /usr/bin
+	-eu export sed then then | export x=1 | readonly x=1 2>/dev/null
+		done "$@" export "$@" "$1" grep x=1 ${HOME} awk done
+	$(pwd) "$1" cd $(pwd) printf && /usr/bin
+	x=1 2>/dev/null grep "$@" test
+		cd done | ${HOME} grep && sed cd $(pwd) test local local "$1" "$1" readonly
+		"$1" grep --verbose readonly
+test echo awk $(pwd) "$@" ${HOME} ${HOME} ${HOME} then
+		--verbose "$@" "$@" awk "$1" readonly /usr/bin
+	| x=1 readonly cd /usr/bin readonly
+local "$@" 'quoted text' ${HOME} local 'quoted text'
+	"$@" "$@" $(pwd) readonly $(pwd) echo -eu local -eu -eu cd export
+		echo local grep x=1 --verbose sed export --verbose "$1" echo --verbose
+	x=1 && "$@" && | local "$@" awk -eu sed x=1 x=1 test "$@"
+	cd local 'quoted text' cd sed
+		cd /usr/bin done local ${HOME}
+	'quoted text' --verbose && && "$@" sed ${HOME} x=1 echo
+		sed $(pwd) grep /usr/bin
+-eu --verbose -eu grep cd 'quoted text' ${HOME} printf printf && -eu
+${HOME} sed $(pwd) readonly
+		grep cd ${HOME} done export "$@" printf printf
+local cd $(pwd) grep "$@" -eu | sed done /usr/bin
+		'quoted text' x=1 "$1" 'quoted text' /usr/bin "$1" --verbose export 2>/dev/null
+then 'quoted text' 'quoted text'
+readonly | "$1" test "$1" test test sed echo awk then
+local done "$@" -eu | echo then test local printf
+	${HOME} readonly then grep 'quoted text'
+		local done export then --verbose sed | test test ${HOME} 2>/dev/null
+	2>/dev/null cd cd printf grep printf grep test printf /usr/bin readonly "$@" &&
+		test cd sed done ${HOME} awk awk -eu local
+$(pwd) sed "$1" 'quoted text' ${HOME} --verbose ${HOME} x=1 grep | --verbose
+	cd sed readonly x=1 grep sed echo echo then test -eu grep --verbose
+		readonly readonly test 2>/dev/null | grep test x=1 sed --verbose grep
+then 'quoted text' 'quoted text' awk awk printf then | done "$1" export sed then
+		done "$1" printf --verbose awk sed grep sed $(pwd) 2>/dev/null
+readonly "$@" "$1" readonly x=1 echo
+	test 'quoted text' sed local 2>/dev/null ${HOME} printf cd /usr/bin
+| cd cd then grep local then cd --verbose local awk printf then export
+	grep then ${HOME} 2>/dev/null echo 2>/dev/null "$@" readonly x=1 echo local
+awk printf 'quoted text' "$@" x=1 grep then grep grep -eu awk 'quoted text' local
+		"$@" /usr/bin cd test awk
+		grep && 2>/dev/null 'quoted text'
+		"$1" 2>/dev/null x=1 done | 2>/dev/null && -eu grep printf sed /usr/bin then
+grep "$1" --verbose && ${HOME} export | cd
+	grep -eu 2>/dev/null done ${HOME} local && 2>/dev/null local ${HOME}
+		then "$1" 'quoted text' ${HOME} && -eu
+echo awk x=1 done /usr/bin -eu local
+"$1" printf && printf printf 'quoted text' -eu printf
+		then echo && 2>/dev/null x=1 x=1 cd echo awk readonly "$@"
+		readonly export /usr/bin cd ${HOME} "$1" cd $(pwd) local then sed awk
+		--verbose x=1 cd export 2>/dev/null | done
+	2>/dev/null $(pwd) $(pwd) 'quoted text' done
+--verbose --verbose 2>/dev/null test export 2>/dev/null --verbose readonly
+		/usr/bin /usr/bin x=1 | x=1 local printf grep cd readonly --verbose
+	done export printf "$@" grep done -eu && printf grep $(pwd)
+		test "$1" readonly --verbose
+local test local grep -eu export local
+	${HOME} grep export then then $(pwd) ${HOME} | "$@" 2>/dev/null then
+| local echo then "$@" readonly awk local export 2>/dev/null export awk readonly
+	export "$1" export grep done printf ${HOME} printf
+		/usr/bin export --verbose
+then grep cd && x=1 x=1 export cd awk awk ${HOME} /usr/bin
+-eu printf x=1 done $(pwd) x=1 "$1" readonly /usr/bin grep | $(pwd) "$@"
+test | /usr/bin --verbose 'quoted text' echo x=1 "$1" | /usr/bin
+export 2>/dev/null echo sed /usr/bin && sed -eu | ${HOME}
+	--verbose sed export x=1 -eu done grep done done && x=1 awk done x=1 echo grep
+		echo then export cd 'quoted text'
+		echo 2>/dev/null test printf grep printf "$1" export ${HOME} --verbose
+	/usr/bin "$@" 'quoted text' && x=1 then local cd printf 2>/dev/null
+cd readonly x=1 cd then && "$@" | awk && cd "$1" readonly sed 'quoted text'
+		-eu then "$1" awk "$1" then --verbose test
+	x=1 "$@" 2>/dev/null ${HOME}
+2>/dev/null awk done x=1 2>/dev/null x=1 -eu ${HOME} readonly $(pwd) -eu
+cd sed printf local awk && printf
+awk local then test -eu local $(pwd) echo --verbose printf $(pwd) "$@" readonly
+"$@" printf cd "$@" printf $(pwd) printf
+		then -eu readonly $(pwd) --verbose 2>/dev/null --verbose 2>/dev/null x=1 local
+	export grep done printf "$@" then "$@" x=1 'quoted text' -eu awk cd /usr/bin
+	"$@" "$1" ${HOME} printf -eu 'quoted text' -eu done "$1" --verbose "$1" cd grep
+		done | sed cd test --verbose export --verbose
+		printf awk cd | 2>/dev/null 2>/dev/null ${HOME} test test
+"$@" sed done sed then printf --verbose && && awk 'quoted text' |
+${HOME} ${HOME} then | echo "$@" local grep
+sed local local sed printf readonly 'quoted text' readonly cd -eu then x=1 2>/dev/null
+| --verbose "$@" test x=1 "$1"
+	then sed test -eu test "$1" local awk done /usr/bin "$@" /usr/bin awk grep cd 'quoted text'
+		"$@" local ${HOME} then readonly printf sed
+	echo printf ${HOME} x=1 test cd x=1 readonly ${HOME} test local
+	x=1 sed | /usr/bin echo cd "$@" grep "$@" x=1
+		x=1 test "$1" sed awk export | export 2>/dev/null readonly test && echo x=1 grep
+	then local readonly /usr/bin && | export x=1 | printf test -eu "$@" readonly /usr/bin
+		$(pwd) $(pwd) 2>/dev/null -eu | "$@" readonly x=1 test export 'quoted text'
+	2>/dev/null printf readonly awk --verbose printf awk -eu echo sed x=1
+x=1 grep local x=1 readonly 2>/dev/null local -eu local /usr/bin
+		sed x=1 grep $(pwd) sed awk 'quoted text' -eu
+	then "$1" ${HOME} 2>/dev/null 2>/dev/null
+	printf --verbose 2>/dev/null echo
+sed /usr/bin grep export &&
+"$1" --verbose export ${HOME} test && local /usr/bin test
+awk "$@" ${HOME} $(pwd) awk --verbose grep awk local && "$@" -eu
+--verbose readonly done awk test
+printf sed local done readonly echo ${HOME} test --verbose awk $(pwd) 2>/dev/null
+	local --verbose export readonly
+		done | echo -eu cd ${HOME} $(pwd) x=1 2>/dev/null 'quoted text'
+	"$1" ${HOME} then --verbose sed printf printf
+${HOME} awk grep readonly --verbose readonly
+	| 2>/dev/null "$1" grep 'quoted text' grep then awk && "$1"
+	"$1" "$1" $(pwd) sed ${HOME} ${HOME} "$@" 'quoted text'
+2>/dev/null grep test then test | readonly
+2>/dev/null 2>/dev/null "$1"
+		${HOME} sed printf done
+		readonly /usr/bin printf x=1 | --verbose
+awk && -eu export 'quoted text'
+		echo 'quoted text' 2>/dev/null test readonly 'quoted text' $(pwd) x=1 "$1" -eu &&
+		--verbose 2>/dev/null x=1 "$1" then
+	-eu "$@" "$1" "$1" 2>/dev/null awk done "$@" --verbose ${HOME} $(pwd) | |
+	x=1 local 'quoted text' then 'quoted text' awk 2>/dev/null
+	echo grep 2>/dev/null sed && test done then grep "$1" sed --verbose cd grep
+		sed x=1 -eu 'quoted text' grep readonly "$@" awk awk | done
+	&& local then then && local echo test readonly x=1 export "$1"
+		-eu x=1 awk "$@" "$1" test ${HOME} && && done local local ${HOME} -eu /usr/bin
+readonly "$1" test printf awk then sed readonly readonly "$@"
+	sed cd x=1 2>/dev/null ${HOME} && 2>/dev/null readonly 'quoted text' &&
+		echo then echo done 'quoted text' 'quoted text' ${HOME} cd grep && sed test
+awk test export x=1 ${HOME} readonly "$1" $(pwd) --verbose | 2>/dev/null ${HOME}
+/usr/bin local test export echo printf done | && | test 2>/dev/null
+		then done echo /usr/bin
+	-eu "$1" 2>/dev/null cd && | export
+awk x=1 $(pwd) x=1 grep grep x=1 'quoted text' done then done x=1
+	${HOME} local sed && printf export readonly /usr/bin
+		| --verbose cd printf then && $(pwd) $(pwd) awk awk awk
+	printf printf ${HOME} 'quoted text' then
+test printf export echo done awk cd ${HOME}
+	"$@" $(pwd) $(pwd) sed "$1" done echo sed -eu -eu /usr/bin "$@" "$@" test then
+/usr/bin $(pwd) -eu printf then "$1"
+'quoted text' -eu then $(pwd) readonly "$@" --verbose done local echo x=1 |
+	${HOME} | "$@" 'quoted text'
+| $(pwd) --verbose --verbose $(pwd) && readonly 2>/dev/null export "$@"
+	'quoted text' 'quoted text' -eu local sed -eu x=1 echo "$@"
+	2>/dev/null | readonly && done
+'quoted text' 'quoted text' 2>/dev/null "$1" 'quoted text' done ${HOME}
+2>/dev/null test | readonly $(pwd)
+		awk done ${HOME} done "$1" export
+echo done x=1 echo --verbose
+	--verbose export --verbose x=1 ${HOME} ${HOME} /usr/bin
+	then sed done echo --verbose
+"$@" "$@" done grep cd /usr/bin cd 'quoted text'
+done $(pwd) echo $(pwd) grep export local local test | done printf 2>/dev/null
+	test 'quoted text' grep test sed ${HOME} 2>/dev/null printf
+	2>/dev/null --verbose sed 'quoted text' sed local ${HOME}
+${HOME} then 'quoted text' local /usr/bin readonly
+	"$1" "$@" printf | --verbose printf 2>/dev/null done 'quoted text' $(pwd)
+	awk export x=1 && readonly cd
+	done 'quoted text' | | ${HOME} --verbose
+	--verbose echo done "$1" grep sed sed cd sed && printf done | awk ${HOME}
+		grep -eu | $(pwd) /usr/bin "$1" $(pwd) export
+		readonly | 2>/dev/null | $(pwd) local
+	${HOME} 2>/dev/null -eu awk $(pwd) && "$1" export cd | then test --verbose
+	"$1" "$1" 'quoted text' && "$@" 'quoted text'
+	awk --verbose printf printf $(pwd) grep sed readonly export
+	"$@" export 2>/dev/null echo readonly awk echo | --verbose done && "$@"
+		"$1" sed done "$1" printf "$@" echo -eu cd 'quoted text'
+"$@" x=1 then ${HOME} x=1 --verbose readonly -eu export ${HOME}
+		"$@" echo done test ${HOME} awk cd ${HOME} echo readonly
+		${HOME} test x=1 ${HOME} echo --verbose
+	readonly 'quoted text' done --verbose echo echo echo printf
+-eu | printf $(pwd) "$1" $(pwd) echo awk "$@" export
+--verbose x=1 ${HOME} x=1 local
+		printf /usr/bin "$@" printf $(pwd) then printf x=1
+		then printf awk cd grep | -eu $(pwd)
+2>/dev/null done test &&
+		cd cd sed 'quoted text' && then grep echo printf -eu awk $(pwd) $(pwd) | then
+test cd "$@" echo --verbose --verbose awk | "$1"
+		local 'quoted text' then "$1" echo 'quoted text' $(pwd) /usr/bin 2>/dev/null
+	local /usr/bin 2>/dev/null 'quoted text' cd /usr/bin
+export test awk local export | 'quoted text' 2>/dev/null x=1 x=1
+	grep && /usr/bin readonly echo $(pwd) then awk | test grep awk
+		awk done printf cd echo 'quoted text'
+		| ${HOME} 2>/dev/null then local
+&& --verbose $(pwd) ${HOME} test readonly -eu "$1" 2>/dev/null
+local cd cd 2>/dev/null local then
+| /usr/bin then local | "$1" done x=1 export readonly sed grep
+		'quoted text' local 'quoted text' --verbose done && x=1 export test
+--verbose test "$@" | awk test local grep grep 'quoted text'
+then echo x=1 export "$1" sed x=1 /usr/bin echo 'quoted text' ${HOME} echo
+grep -eu -eu printf printf
+done x=1 echo 2>/dev/null printf
+	-eu export printf done done test ${HOME} && cd echo ${HOME}
+	2>/dev/null printf -eu then | | /usr/bin | /usr/bin "$1" $(pwd) "$1" -eu | grep
+		local awk 2>/dev/null awk printf 2>/dev/null local
+	readonly done then /usr/bin
+	then 2>/dev/null awk -eu ${HOME} cd local cd sed ${HOME} 2>/dev/null echo readonly
+		printf /usr/bin -eu local /usr/bin && /usr/bin 'quoted text' awk $(pwd) test
+--verbose /usr/bin ${HOME} x=1 "$@"
+		test readonly test readonly export --verbose "$@" /usr/bin 'quoted text' echo readonly
+'quoted text' local echo --verbose && sed sed /usr/bin "$@" awk grep 2>/dev/null
+export && && cd && "$@" $(pwd) awk && echo && readonly printf
+"$@" local 2>/dev/null /usr/bin
+	readonly && sed "$@" --verbose && 2>/dev/null cd 2>/dev/null printf &&
+		${HOME} cd ${HOME} test $(pwd) test x=1
+		echo local test "$1" /usr/bin echo cd readonly ${HOME}
+	$(pwd) cd export && echo | ${HOME} -eu printf export
+	'quoted text' done 2>/dev/null echo --verbose /usr/bin
+		printf local test && $(pwd) 2>/dev/null "$@" grep
+	/usr/bin readonly export ${HOME} x=1 done local export -eu
+sed then local x=1 --verbose test export "$1"
+	/usr/bin ${HOME} && x=1
+		done 'quoted text' grep sed
+-eu readonly done export test awk --verbose ${HOME} printf /usr/bin
+	| && "$@" 2>/dev/null readonly -eu export sed -eu "$@" echo then grep
+'quoted text' cd x=1 -eu printf cd test "$@" then | ${HOME} | "$@" sed
+#include c170.sh
+/usr/bin local echo grep $(pwd) 'quoted text' test done readonly
+		grep --verbose printf awk echo export "$1" done printf test printf "$1"
+		x=1 /usr/bin local export printf $(pwd) then sed readonly
+	echo cd "$1" printf | --verbose done /usr/bin --verbose -eu awk x=1 echo
+--verbose && echo export "$@" sed "$@" test printf
+printf 2>/dev/null 'quoted text' echo && readonly
+| "$1" echo sed awk then cd readonly
+		| $(pwd) && 'quoted text' grep readonly
+2>/dev/null cd 'quoted text' x=1 "$1" && x=1
+test | ${HOME} grep cd "$1" done then "$@" echo done
+		'quoted text' echo "$@" readonly grep 'quoted text' x=1 done
+		/usr/bin x=1 then -eu cd
+		then | --verbose 'quoted text' readonly done 2>/dev/null then $(pwd) ${HOME}
+/usr/bin echo export done local "$@" readonly "$1" export
+'quoted text' cd "$1" 'quoted text' echo then 2>/dev/null
+'quoted text' done "$1" 2>/dev/null "$1" sed --verbose local
+x=1 "$1" grep x=1 readonly
+grep | | then ${HOME} "$1" echo | awk then echo echo ${HOME} awk local "$1"
+${HOME} 2>/dev/null printf "$1" --verbose awk "$1" awk $(pwd) echo &&
+		cd x=1 test echo readonly -eu sed awk export 'quoted text'
+-eu && local --verbose export "$@" --verbose done --verbose x=1 | test
+	then done 'quoted text' then sed $(pwd) --verbose grep then done printf
+local awk $(pwd) printf echo export sed && x=1 test grep
+&& awk $(pwd) ${HOME}
+		awk ${HOME} sed grep export && -eu "$@" then "$1"
+	sed "$@" -eu readonly export $(pwd) local
+	awk awk grep printf readonly 'quoted text' readonly local test awk
+export readonly 'quoted text' -eu -eu && ${HOME}
+x=1 | export /usr/bin
+local ${HOME} done test x=1 grep local
+		/usr/bin then awk cd test grep -eu echo then cd sed test
+$(pwd) /usr/bin readonly cd --verbose x=1 cd -eu export local --verbose
+readonly export $(pwd) --verbose -eu && "$1" grep -eu ${HOME} && $(pwd) $(pwd)
+		"$1" cd ${HOME} local echo 'quoted text'
+	sed "$@" && cd test 2>/dev/null ${HOME} "$@"
+	"$1" /usr/bin done -eu "$@" then echo local 2>/dev/null sed awk ${HOME} -eu
+		test ${HOME} x=1 "$@" sed -eu printf 2>/dev/null
+	'quoted text' sed local done x=1 grep
+awk printf export | $(pwd) done "$@" | local
+then grep x=1 $(pwd) -eu sed $(pwd)
+		cd export --verbose --verbose sed x=1 grep awk then
+	2>/dev/null | -eu "$1" ${HOME}
+echo awk done then readonly local -eu test && sed printf
+x=1 echo done 2>/dev/null "$1" -eu 'quoted text'
+	'quoted text' test /usr/bin
+		done export cd x=1 "$1"
+	"$1" sed x=1 readonly /usr/bin sed x=1 "$@" cd "$@" readonly awk 2>/dev/null
+test echo awk --verbose export 'quoted text'
+		| grep && readonly test 2>/dev/null echo export local echo
+	cd test local echo 2>/dev/null
+		grep "$@" sed sed echo ${HOME} readonly local 2>/dev/null
+test | "$1" grep cd 2>/dev/null
+	2>/dev/null then "$@" /usr/bin export
+		awk done && | grep local printf ${HOME} $(pwd) 2>/dev/null
+		/usr/bin done echo && && awk --verbose sed
+		done export && grep done then sed local
+	test test | /usr/bin done cd echo echo 'quoted text'
+/usr/bin $(pwd) readonly export | done local printf readonly
+		&& cd done test ${HOME} export cd cd 2>/dev/null printf $(pwd)
+	--verbose /usr/bin readonly "$1" ${HOME} awk
+		"$1" local -eu echo && | echo local /usr/bin awk $(pwd) then test done | &&
+		$(pwd) /usr/bin -eu grep cd --verbose x=1 echo | readonly
+		/usr/bin local ${HOME} grep test ${HOME} done "$@" | then --verbose /usr/bin
+	x=1 local then grep ${HOME} test
+		--verbose --verbose | ${HOME} ${HOME} -eu "$@" /usr/bin then printf $(pwd)
+		--verbose grep --verbose x=1 test && x=1 "$1"
+	test then -eu ${HOME} grep test awk
+	test then sed test cd | printf --verbose readonly
+/usr/bin grep && && 2>/dev/null
+	awk ${HOME} local readonly "$1" && sed done && /usr/bin then done echo
+	"$1" && && x=1 done "$@" ${HOME} 2>/dev/null "$1" -eu ${HOME}
+sed grep awk 2>/dev/null test
+2>/dev/null "$@" sed printf done local cd local $(pwd) readonly x=1
+grep cd sed $(pwd) cd --verbose cd sed 2>/dev/null
+	--verbose --verbose && echo test $(pwd) test then awk cd readonly grep grep
+	local --verbose "$@"
+${HOME} awk --verbose "$@" local local awk printf
+-eu 2>/dev/null test grep echo $(pwd) cd ${HOME} 'quoted text'
+	/usr/bin sed done test awk --verbose sed
+readonly cd && done $(pwd) local then done cd -eu test cd "$@" awk
+cd --verbose local echo cd
+		"$@" then awk local cd export ${HOME} | -eu done 'quoted text' 2>/dev/null
+		--verbose done /usr/bin readonly "$@" then -eu ${HOME} cd
+echo --verbose done -eu /usr/bin "$@" | done -eu -eu && test $(pwd)
+--verbose x=1 x=1 'quoted text'
+export local "$@" 2>/dev/null $(pwd) && /usr/bin cd done
+	printf printf "$@" 'quoted text'
+	x=1 x=1 then sed $(pwd)
+	| printf cd --verbose test grep "$1" sed | done -eu
+printf x=1 | x=1 local 2>/dev/null sed x=1 /usr/bin grep
+"$1" then grep 2>/dev/null then done then --verbose /usr/bin
+	echo --verbose cd cd && "$@" /usr/bin
+		then sed ${HOME} -eu local -eu -eu echo then
+"$@" printf | $(pwd) local export | readonly 'quoted text' sed ${HOME} --verbose
+		| echo echo "$1" 2>/dev/null done then "$1" test
+grep awk done $(pwd) --verbose /usr/bin then cd "$1" grep local echo test sed
+	&& sed && test sed grep
+	readonly && -eu x=1 x=1 done then export 'quoted text'
+then test done /usr/bin local --verbose /usr/bin --verbose 'quoted text'
+		| awk grep printf $(pwd) local 'quoted text' /usr/bin x=1 ${HOME} --verbose
+	awk -eu x=1 -eu /usr/bin export export && test sed awk
+	grep sed then sed 2>/dev/null | local cd ${HOME} done /usr/bin | cd x=1 2>/dev/null
+done "$1" export "$@" --verbose
+then ${HOME} grep then cd printf
+then $(pwd) sed ${HOME} x=1 $(pwd) 'quoted text' test
+$(pwd) grep /usr/bin local export
+		grep -eu | readonly awk sed x=1 then then awk
+done x=1 'quoted text' $(pwd) &&
+--verbose 2>/dev/null --verbose 'quoted text' grep
+then grep ${HOME} 'quoted text' cd $(pwd) sed ${HOME} ${HOME} x=1 sed readonly
+awk ${HOME} && grep $(pwd) --verbose local x=1 'quoted text' readonly
+grep readonly --verbose local readonly
+	| "$1" 'quoted text' printf $(pwd) 'quoted text' 2>/dev/null 'quoted text'
+	&& grep --verbose sed grep -eu cd export && sed sed sed grep
+		awk ${HOME} $(pwd) done then ${HOME}
+		readonly "$@" | awk readonly && printf printf --verbose
+		2>/dev/null && grep 2>/dev/null export cd && "$1" printf echo readonly
+		--verbose ${HOME} done then "$@" awk
+	2>/dev/null then awk readonly "$1"
+	| 'quoted text' export export
+		x=1 export readonly | local awk -eu "$@" then test cd awk 2>/dev/null then
+		done --verbose | echo done echo
+	printf local 2>/dev/null -eu
+	cd && -eu sed && local done "$@" --verbose grep grep done 'quoted text' echo
+2>/dev/null export export "$@" x=1 ${HOME} --verbose
+		--verbose printf $(pwd) && grep sed done done test
+	echo 'quoted text' test --verbose
+2>/dev/null printf done |
+	| "$1" ${HOME} readonly -eu $(pwd) $(pwd) 2>/dev/null cd
+	--verbose cd echo "$1" -eu 'quoted text' echo sed | done
+		--verbose && readonly awk ${HOME} then $(pwd) local --verbose
+x=1 --verbose test sed x=1 --verbose $(pwd)
+sed --verbose && cd 2>/dev/null export then | ${HOME}
+x=1 "$@" 2>/dev/null /usr/bin
+then $(pwd) $(pwd) $(pwd) | awk local done x=1 export printf && 2>/dev/null
+readonly 2>/dev/null | readonly && "$@"
+		readonly $(pwd) sed done awk -eu cd export ${HOME} grep $(pwd)
+then -eu $(pwd) --verbose && $(pwd) $(pwd) 2>/dev/null
+	$(pwd) "$1" export "$1" $(pwd) local printf --verbose | then cd then ${HOME} done
+		grep $(pwd) cd export 'quoted text'
+/usr/bin ${HOME} 2>/dev/null local echo --verbose "$@" readonly ${HOME} test ${HOME}
+${HOME} cd export "$1" 2>/dev/null
+--verbose "$1" grep && then "$1" cd "$@" "$@" echo done done "$@" ${HOME}
+cd $(pwd) readonly ${HOME} test /usr/bin echo export export local
+		$(pwd) /usr/bin sed | 'quoted text' 'quoted text'
+done $(pwd) grep && then export test /usr/bin echo printf "$1" "$@" $(pwd)
+readonly cd then && | "$1" export "$@" test "$@"
+then 'quoted text' | --verbose awk
+	local grep awk then then grep done local --verbose "$1" cd && $(pwd) readonly /usr/bin
+		-eu sed done -eu readonly && "$@" sed then printf grep x=1 cd then
+	'quoted text' local "$1" /usr/bin printf 'quoted text' 2>/dev/null /usr/bin 'quoted text'
+		x=1 x=1 'quoted text' && printf ${HOME}
+2>/dev/null grep 2>/dev/null 'quoted text'
+	&& echo export /usr/bin
+		--verbose && then grep readonly x=1 -eu &&
+"$@" 'quoted text' done cd "$@" /usr/bin
+local 'quoted text' local /usr/bin
+cd local $(pwd) grep 'quoted text' echo
+		awk sed --verbose /usr/bin | ${HOME} $(pwd)
+	"$@" "$@" test | && printf
+awk ${HOME} grep "$@" test
+		then && 2>/dev/null /usr/bin 'quoted text' readonly 'quoted text'
+2>/dev/null done cd 'quoted text' cd "$1" sed printf export --verbose
+		test export awk done "$1" awk sed 2>/dev/null | --verbose
+		$(pwd) && printf test sed && x=1 -eu echo x=1 'quoted text' 'quoted text'
+		2>/dev/null export /usr/bin
+	then awk grep awk ${HOME} && "$1" --verbose done "$@"
+		cd "$@" x=1 echo /usr/bin
+readonly sed sed printf 'quoted text' $(pwd)
+		printf "$1" && 2>/dev/null 2>/dev/null export
+		--verbose then 'quoted text' sed
+	${HOME} 'quoted text' cd "$1" local cd printf echo
+	printf awk x=1 'quoted text' 'quoted text'
+-eu --verbose ${HOME} export awk x=1 /usr/bin local --verbose && 2>/dev/null
+	x=1 -eu && 2>/dev/null printf x=1 sed ${HOME} then x=1 echo
+	printf echo && -eu --verbose grep "$@" printf 2>/dev/null ${HOME} awk /usr/bin
+/usr/bin sed 'quoted text' grep sed
+&& ${HOME} -eu /usr/bin
+		2>/dev/null 2>/dev/null
+	awk | 2>/dev/null -eu 2>/dev/null
+/usr/bin --verbose done test $(pwd) | readonly readonly $(pwd) --verbose
+sed --verbose | cd --verbose sed "$@" awk 2>/dev/null 'quoted text' && sed
+	done 'quoted text' "$@" awk ${HOME}
+		$(pwd) --verbose "$@" awk $(pwd) local
+		echo printf test printf then --verbose && "$@" -eu $(pwd) then
+		"$1" "$1" echo -eu local "$@" x=1
+cd local "$1" done readonly x=1 printf awk | grep "$@" $(pwd) done
+--verbose x=1 $(pwd) local
+	grep "$@" grep local /usr/bin $(pwd) --verbose && --verbose
+local test && 2>/dev/null ${HOME} cd readonly x=1 x=1 cd sed export
+	x=1 x=1 ${HOME} --verbose echo export test sed --verbose
+		'quoted text' test 'quoted text' && awk x=1 echo ${HOME} 'quoted text' -eu "$@"
+--verbose readonly ${HOME} printf grep | | "$1" awk ${HOME} -eu
+	printf sed done "$1" /usr/bin
+		-eu readonly 'quoted text' sed echo "$@" $(pwd) 'quoted text'
+	--verbose "$@" grep printf printf readonly /usr/bin
+		test done && $(pwd) local x=1 | | "$1" echo sed grep x=1
+	readonly x=1 awk awk then echo "$1" 2>/dev/null ${HOME}
+"$@" export local local "$@" readonly 'quoted text' | done sed 'quoted text'
+-eu grep | $(pwd) ${HOME} export && x=1 "$1" readonly grep "$@" /usr/bin
+		$(pwd) ${HOME} x=1 printf
+		echo export local --verbose | printf
+		export | ${HOME} done awk $(pwd) awk x=1 echo cd grep printf "$1" readonly
+		awk awk then echo x=1 "$1" local done "$1"
+	readonly $(pwd) && cd -eu 2>/dev/null
+'quoted text' 'quoted text' local local "$1"
+${HOME} 'quoted text' -eu cd $(pwd) 2>/dev/null "$@" --verbose
+sed $(pwd) readonly local printf sed cd printf /usr/bin
+		"$@" $(pwd) test 2>/dev/null sed
+		sed x=1 "$@" --verbose awk && ${HOME} grep | | $(pwd)
+-eu echo local $(pwd) && --verbose
+		-eu cd readonly "$1" 'quoted text' sed sed "$@" sed x=1 x=1 awk grep readonly
+		-eu awk echo grep x=1 done $(pwd) then --verbose awk && x=1 /usr/bin /usr/bin
+	&& /usr/bin grep x=1 readonly readonly
+"$1" && then export --verbose ${HOME} x=1 x=1 then $(pwd) 'quoted text'
+| done x=1 local local "$@" 2>/dev/null done done -eu local "$@" echo --verbose
+		test "$@" done | "$@" ${HOME} 2>/dev/null
+2>/dev/null "$@" 'quoted text' export "$@" sed ${HOME} && "$1" grep done echo
+	/usr/bin 'quoted text' | then /usr/bin then done
+	$(pwd) x=1 "$1" "$@" cd 'quoted text'
+echo done printf done | readonly x=1 "$@" local -eu ${HOME}
+	${HOME} test done cd "$1" -eu sed ${HOME} ${HOME}
+	"$1" --verbose printf 'quoted text' local $(pwd) readonly
+cd cd readonly echo local readonly awk awk ${HOME} /usr/bin --verbose
+test awk export awk readonly "$@" "$1" readonly && then
+$(pwd) done then local x=1 local $(pwd) local
+	${HOME} grep sed echo /usr/bin | echo ${HOME} done export export
+	printf /usr/bin --verbose done echo /usr/bin done "$@" /usr/bin && x=1
+		cd printf test done --verbose
+		then readonly -eu "$@" 'quoted text' then done && $(pwd)
+&& "$@" "$1" | ${HOME} | x=1 /usr/bin
+		done awk x=1 sed -eu /usr/bin done 2>/dev/null test "$1" 'quoted text' 2>/dev/null
+		printf local $(pwd) then
+printf --verbose cd "$1" "$@" "$1" /usr/bin x=1 cd then test
+	printf awk ${HOME} -eu readonly ${HOME} | && then -eu 'quoted text'
+readonly echo then echo test x=1 echo export readonly && done /usr/bin readonly
+| $(pwd) && local /usr/bin
+		| local --verbose $(pwd) "$1" local -eu "$@" local
+sed export 'quoted text' | awk 2>/dev/null awk export /usr/bin /usr/bin 2>/dev/null
+awk --verbose && "$1" readonly cd 'quoted text'
+sed readonly 2>/dev/null /usr/bin echo sed
+local x=1 printf readonly && done echo
+	| printf 'quoted text' 2>/dev/null "$@"
+		${HOME} test cd "$1" done done done grep x=1 'quoted text' 'quoted text' cd -eu
+		--verbose done awk printf
+"$1" sed export cd /usr/bin /usr/bin /usr/bin
+		/usr/bin readonly $(pwd)
+--verbose | awk echo /usr/bin "$1" && readonly x=1
+	cd | "$1" cd --verbose
+		test && "$1" awk 2>/dev/null
+	&& | local echo grep cd local x=1 test x=1 test
+	sed test then printf ${HOME}
+-eu -eu printf test -eu --verbose export
+	local ${HOME} printf echo export sed cd $(pwd)
+cd then x=1 2>/dev/null /usr/bin 2>/dev/null then
+"$@" export ${HOME} "$@" export awk $(pwd) printf echo echo printf echo sed
+done ${HOME} cd ${HOME}
+local --verbose | cd echo done x=1 $(pwd) $(pwd) then
+2>/dev/null --verbose sed "$1" readonly "$@" echo awk printf 2>/dev/null echo
+		-eu $(pwd) awk then done test 2>/dev/null x=1 sed --verbose "$1" "$@"
+	sed echo grep && grep "$@" ${HOME} export | "$@" test export ${HOME} cd 2>/dev/null
+	printf readonly awk export done readonly then 'quoted text' | 2>/dev/null
+		export | /usr/bin "$1" readonly awk "$1" export | echo 2>/dev/null
+	"$@" -eu /usr/bin local 'quoted text'
+	echo sed awk 2>/dev/null $(pwd) ${HOME} test local $(pwd) export
+	then -eu local awk sed sed x=1 2>/dev/null | readonly
+		x=1 printf done then cd echo test | "$1" done then grep export grep local
+${HOME} 'quoted text'
+readonly && && awk x=1 x=1 then 2>/dev/null "$@" then test
+		"$@" "$@" echo "$1" echo ${HOME} 'quoted text' echo && cd "$1" cd readonly
+$(pwd) ${HOME} --verbose $(pwd) | cd /usr/bin
+	| cd ${HOME} 2>/dev/null ${HOME} 2>/dev/null /usr/bin 'quoted text' then
+"$@" then awk "$@" && 2>/dev/null then
+		--verbose /usr/bin sed "$@" $(pwd) then 'quoted text'
+	"$1" local | cd "$@" -eu
+"$1" test "$@" -eu ${HOME} local /usr/bin --verbose
+echo grep && -eu x=1 x=1 local echo cd echo
+	${HOME} x=1 ${HOME} 'quoted text' --verbose grep --verbose grep
+		printf done ${HOME} "$@" sed | "$@" $(pwd) | "$1" printf
+	x=1 export 2>/dev/null done 2>/dev/null grep "$1" done readonly
+		test --verbose sed --verbose -eu | export awk -eu echo 2>/dev/null "$1"
+sed "$1" 'quoted text' | 2>/dev/null then x=1 -eu grep 'quoted text'
+export --verbose echo x=1 echo export
+		awk printf grep | then && 2>/dev/null ${HOME} sed export
+-eu $(pwd) export done "$@" && "$@" cd local | test echo x=1 sed readonly readonly
+2>/dev/null grep printf x=1 /usr/bin && | echo /usr/bin then sed x=1 test "$@"
+		echo cd test cd 2>/dev/null grep readonly sed 'quoted text'
+/usr/bin "$@" | local cd awk | export -eu | awk /usr/bin 2>/dev/null x=1
+sed local grep readonly x=1 local && | export
+		grep readonly "$@" test x=1 readonly cd ${HOME}
+done $(pwd) echo $(pwd) "$1" | &&
+then test test test --verbose grep local --verbose -eu
+	/usr/bin 'quoted text' printf test ${HOME}
+		test test sed ${HOME} readonly local "$1"
+2>/dev/null export --verbose
+	done printf then -eu sed "$@" --verbose /usr/bin | test sed local --verbose
+cd local done test ${HOME} echo
+	sed /usr/bin -eu "$1" done test cd export /usr/bin grep
+	echo local then cd grep | /usr/bin done grep then then done
+grep 'quoted text' | cd printf /usr/bin
+	$(pwd) "$@" /usr/bin 'quoted text' ${HOME} printf && echo "$@" then
+&& && echo local then 'quoted text' export awk 'quoted text'
+then --verbose done --verbose 'quoted text' test then grep x=1 --verbose
+	cd ${HOME} /usr/bin x=1 $(pwd) printf awk 2>/dev/null
+sed sed echo export /usr/bin grep test | test done local
+		printf 2>/dev/null grep
+	readonly export -eu "$1" sed grep grep printf done /usr/bin echo 'quoted text'
+	printf grep $(pwd) test /usr/bin sed
+	$(pwd) --verbose echo && awk cd sed -eu x=1 | grep echo --verbose done local
+x=1 $(pwd) then 2>/dev/null $(pwd) && readonly
+	"$1" $(pwd) grep ${HOME} readonly /usr/bin
+		-eu cd printf | export | ${HOME} printf && -eu $(pwd) grep test printf
+		2>/dev/null $(pwd) "$@" cd local "$1" /usr/bin grep ${HOME} printf readonly "$1"
+	test done && then "$1" export 'quoted text' local awk readonly |
+| 2>/dev/null ${HOME} ${HOME} 2>/dev/null sed x=1 --verbose && readonly "$@"
+$(pwd) echo grep x=1 'quoted text' echo "$1" $(pwd)
+		awk test -eu readonly 'quoted text' ${HOME} ${HOME} 'quoted text' export
+	readonly x=1 ${HOME} printf /usr/bin | "$1" printf
+'quoted text' export "$@" then 'quoted text' then done cd && 'quoted text'
+		"$@" sed done ${HOME} grep sed | awk 2>/dev/null --verbose sed | test --verbose
+	"$@" 'quoted text' printf --verbose done 2>/dev/null x=1
+test x=1 local echo | test 2>/dev/null local grep "$1" then printf
+		sed printf cd grep echo grep
+		done then local sed x=1 "$1" "$1" ${HOME} printf then local then 'quoted text'
+$(pwd) --verbose sed
+		--verbose done /usr/bin 2>/dev/null test "$@" sed ${HOME} /usr/bin local
+		then x=1 "$1" then "$@" 2>/dev/null -eu printf done echo 'quoted text' ${HOME}
+2>/dev/null awk 'quoted text' test $(pwd)
+		test 'quoted text' ${HOME} cd && -eu -eu sed /usr/bin test ${HOME}
+		local $(pwd) then "$1" echo export readonly done test
+		done --verbose echo grep --verbose
+		sed 'quoted text' then printf
+		readonly /usr/bin --verbose x=1 'quoted text' && $(pwd) && cd && then
+		--verbose 2>/dev/null echo "$1" 2>/dev/null echo echo sed "$1" -eu | "$1" done
+	done x=1 -eu cd printf x=1 echo x=1 | $(pwd) export local | ${HOME} local --verbose
+	test done && echo x=1 x=1 sed "$@" "$1" "$@" export printf "$1" ${HOME}
+printf --verbose ${HOME} 'quoted text' 2>/dev/null then
+	sed done awk "$1" grep readonly
+test && | done then "$1" ${HOME} test | awk ${HOME} -eu printf | export /usr/bin
+&& local ${HOME} sed awk grep echo 2>/dev/null
+		echo echo -eu export local 'quoted text' then &&
+2>/dev/null | | -eu -eu $(pwd)
+x=1 2>/dev/null printf echo cd | echo --verbose awk grep awk local grep && then
+printf readonly sed && done 'quoted text' $(pwd) ${HOME} then x=1 "$@" awk 'quoted text'
+		$(pwd) echo 'quoted text' 'quoted text' "$@"
+readonly x=1 test | test printf
+		test 2>/dev/null "$1" | grep cd echo
+local 2>/dev/null echo echo
+		&& export $(pwd) && "$@" --verbose grep sed
+done done cd && | $(pwd) 'quoted text' readonly awk then export x=1 local test
+--verbose grep readonly echo "$@" $(pwd) $(pwd) "$1" ${HOME}
+		printf grep then export readonly printf | "$@"
+cd done && done local awk --verbose awk 'quoted text' cd
+--verbose x=1 done $(pwd) export -eu local echo
+	/usr/bin export $(pwd) 'quoted text' "$1" printf ${HOME} $(pwd)
+printf export $(pwd) | --verbose "$@" grep -eu then printf printf
+		then "$1" $(pwd) /usr/bin printf grep "$@"
+'quoted text' $(pwd) "$@" cd echo && | export && readonly cd 2>/dev/null
+	then 'quoted text' echo test | "$1" readonly
+		${HOME} local grep test 'quoted text' /usr/bin printf
+	/usr/bin -eu grep x=1 ${HOME}
+$(pwd) --verbose sed /usr/bin && export awk local
+export grep x=1 --verbose
+	"$@" /usr/bin awk | grep printf
+	then 'quoted text' awk local done grep export done "$1" sed test /usr/bin
+readonly -eu /usr/bin "$@" awk done x=1 readonly $(pwd) printf
+	done test $(pwd) test /usr/bin
+echo 2>/dev/null && sed /usr/bin grep ${HOME} grep "$@" awk x=1 cd 2>/dev/null
+	export grep && then cd 'quoted text' then done
+done "$1" "$@" && grep && -eu echo grep then test
+${HOME} echo echo 'quoted text' test local printf printf
+		awk awk x=1 -eu x=1 test cd awk
+sed "$@" $(pwd) done printf test "$@" &&
+| && printf x=1 | 'quoted text'
+		&& "$@" grep "$@" sed ${HOME} grep export done &&
+--verbose echo awk awk
+		then | ${HOME} $(pwd) -eu "$1" | cd $(pwd)
+	&& grep $(pwd) export "$@" x=1 && readonly awk
+	export 2>/dev/null 2>/dev/null 'quoted text'
+cd "$1" cd awk local then /usr/bin "$1" done
+	$(pwd) then test -eu printf export local /usr/bin
+		'quoted text' awk 'quoted text' local "$@"
+test done x=1 /usr/bin 2>/dev/null | /usr/bin $(pwd) cd $(pwd) 2>/dev/null
+readonly grep 2>/dev/null -eu --verbose readonly sed -eu printf then
+x=1 /usr/bin 'quoted text' printf
+2>/dev/null $(pwd) $(pwd) 2>/dev/null ${HOME} "$@"
+	echo readonly | ${HOME} then 'quoted text'
+	printf | | echo 2>/dev/null local $(pwd) | /usr/bin &&
+		done /usr/bin done --verbose "$1" x=1 test
+	--verbose cd then export readonly echo export
+	local readonly && && x=1 -eu export
+test echo "$@" "$1" 'quoted text'
+		readonly x=1 sed x=1 "$1" "$@" 2>/dev/null then 'quoted text' test
+	/usr/bin awk 'quoted text'
+		$(pwd) then echo ${HOME} 'quoted text'
+	"$@" done done done printf | test awk echo sed test 'quoted text' && cd printf
+local /usr/bin echo | cd readonly --verbose done && "$1" ${HOME}
+readonly done $(pwd) x=1 echo $(pwd) echo done echo test 'quoted text'
+x=1 sed 2>/dev/null /usr/bin ${HOME} "$@" echo --verbose x=1 && x=1
+		grep /usr/bin printf ${HOME}
+cd echo 2>/dev/null test "$1" readonly "$@"
+		--verbose cd $(pwd) sed && printf x=1 printf cd | sed sed "$1" 2>/dev/null
+	readonly sed awk done && cd $(pwd)
+	--verbose --verbose | grep export echo done then 2>/dev/null /usr/bin
+		cd sed cd done local done grep
+		test --verbose "$@" done local ${HOME} $(pwd) -eu | export /usr/bin $(pwd)
+| printf "$1" done printf ${HOME} readonly "$1" local printf then
+$(pwd) 2>/dev/null /usr/bin ${HOME} | -eu echo cd cd grep -eu "$@"
+"$@" && test local ${HOME}
+	--verbose | 2>/dev/null cd --verbose
+	--verbose $(pwd) ${HOME} /usr/bin
+	grep readonly printf "$@" cd && && readonly export x=1 -eu grep
+sed local --verbose printf $(pwd) grep | "$1" ${HOME} export 2>/dev/null 'quoted text'
+	export sed done cd x=1 2>/dev/null printf local | /usr/bin then | awk echo
+export 'quoted text' 'quoted text' | done echo --verbose | -eu x=1 2>/dev/null
+		printf ${HOME} x=1 && export /usr/bin
+export "$1" grep done echo ${HOME} sed then | echo
+		$(pwd) grep grep echo 2>/dev/null test | x=1 grep
+/usr/bin cd x=1 grep --verbose done x=1 ${HOME}
+	printf export /usr/bin sed grep grep done 2>/dev/null 2>/dev/null
+		echo -eu && then readonly | then cd "$1" cd /usr/bin
+		readonly "$1" $(pwd) grep -eu test x=1 grep echo cd grep $(pwd) printf
+	$(pwd) then -eu x=1 /usr/bin done then $(pwd) --verbose
+		test $(pwd) -eu done $(pwd) && ${HOME} echo done
+/usr/bin /usr/bin export grep local 'quoted text' | /usr/bin printf -eu /usr/bin
+	$(pwd) sed --verbose -eu x=1 2>/dev/null echo "$1" printf echo readonly grep &&
+export echo then 2>/dev/null echo | | $(pwd) 'quoted text' "$1" && "$1"
+	'quoted text' 'quoted text' /usr/bin | x=1 sed awk printf "$1" x=1 then then echo
+cd 'quoted text' then sed /usr/bin 'quoted text' done "$@"
+	then sed awk then 'quoted text'
+		--verbose readonly 'quoted text' 2>/dev/null 'quoted text' local &&
+		export 'quoted text' /usr/bin export awk $(pwd) local "$1" 2>/dev/null
+		"$@" 'quoted text' --verbose 2>/dev/null grep --verbose then /usr/bin | x=1
+2>/dev/null test cd 2>/dev/null -eu test x=1 |
+	--verbose sed ${HOME} ${HOME} | /usr/bin 2>/dev/null cd printf printf
+	echo --verbose local && "$1" then x=1 readonly
+sed --verbose && $(pwd) "$1" $(pwd) 'quoted text'
+	awk "$@" done "$@" cd --verbose --verbose
+echo 'quoted text' local then "$@" printf local then echo /usr/bin awk x=1 2>/dev/null
+		&& /usr/bin echo ${HOME} awk echo /usr/bin done cd --verbose done readonly
+readonly echo readonly done grep local 2>/dev/null ${HOME} ${HOME} -eu cd echo
+awk x=1 done "$@" awk $(pwd) ${HOME} then awk local
+	then 2>/dev/null readonly | && printf 'quoted text' done -eu done && test $(pwd)
+${HOME} test $(pwd) x=1 cd $(pwd) local
+	test awk cd printf cd grep sed awk sed "$1" printf "$1" x=1
+		${HOME} -eu then 'quoted text' grep sed 'quoted text' ${HOME}
+cd x=1 --verbose local local then printf sed printf --verbose 2>/dev/null
+"$1" sed local /usr/bin sed --verbose -eu done "$1" cd | export cd awk grep readonly
+| 2>/dev/null printf | "$1" done cd 'quoted text' 'quoted text' test
+		| "$@" "$1" readonly x=1 | cd readonly sed test "$@" cd
+sed --verbose x=1 test x=1 sed 2>/dev/null
+readonly then ${HOME} -eu readonly printf
+	done sed local $(pwd) /usr/bin grep 'quoted text'
+printf x=1 $(pwd) "$1" grep export export local grep local
+	--verbose /usr/bin grep "$@" $(pwd)
+		done -eu local test local local 2>/dev/null && | x=1 local echo sed done
+awk && | test 2>/dev/null readonly
+		--verbose local --verbose test test x=1 2>/dev/null /usr/bin echo
+	cd awk --verbose done export readonly done
+printf printf printf | export echo awk -eu local /usr/bin "$1" export
+$(pwd) echo | test 'quoted text'
+		-eu readonly test echo awk
+	awk ${HOME} /usr/bin done $(pwd)
+		echo && echo $(pwd) /usr/bin
+		-eu local test | "$1" export "$@" sed echo export
+		x=1 cd ${HOME} done local readonly awk done readonly grep then grep sed
+	printf 2>/dev/null /usr/bin cd readonly 'quoted text' readonly
+		local ${HOME} done x=1 --verbose /usr/bin
+	readonly ${HOME} test ${HOME} done
+	/usr/bin "$@" printf done local
+	/usr/bin | then sed export -eu | sed sed | local && -eu --verbose
+	grep --verbose export test local 2>/dev/null then readonly awk
+	grep grep echo "$1" export
+		--verbose readonly "$@" sed test ${HOME} "$1" export
+		"$1" export cd -eu echo then sed awk x=1 "$@" awk "$1" --verbose && x=1 -eu &&
+		"$@" local && echo $(pwd) sed local "$1" ${HOME} 'quoted text'
+		cd then sed awk 'quoted text' $(pwd)
+-eu then sed "$@" done | /usr/bin printf 'quoted text'
+sed cd "$1" --verbose export $(pwd) "$1" --verbose grep grep sed printf
+	local cd then x=1 cd | then awk
+readonly cd ${HOME} then awk -eu grep 2>/dev/null
+		sed 2>/dev/null /usr/bin $(pwd) --verbose "$1" && echo $(pwd) 2>/dev/null done
+		| echo -eu && "$1" export "$1" /usr/bin printf
+		awk cd | export && local test 2>/dev/null sed cd 'quoted text'
+	"$1" -eu awk awk cd && ${HOME} local
+	export x=1 /usr/bin "$@" 'quoted text'
+		$(pwd) cd grep ${HOME} x=1 awk 'quoted text' test x=1 cd grep sed
+		export 'quoted text' -eu echo printf
+	'quoted text' then readonly done then
+		$(pwd) x=1 grep printf --verbose then "$1" --verbose --verbose export printf ${HOME}
+		sed export local local export x=1 done grep -eu && "$1" 'quoted text'
+	"$@" export --verbose -eu | test ${HOME} printf printf /usr/bin readonly echo done
+	"$1" "$1" 2>/dev/null printf sed -eu
+done "$1" /usr/bin && "$@" cd /usr/bin
+	| echo done test /usr/bin printf local cd done grep 2>/dev/null sed readonly
+	2>/dev/null echo 2>/dev/null
+x=1 "$@" awk --verbose cd --verbose
+	$(pwd) "$1" x=1 "$@" && x=1 ${HOME} -eu x=1
+test ${HOME} then -eu export && -eu printf export cd --verbose export && 2>/dev/null
+"$@" ${HOME} readonly grep /usr/bin 2>/dev/null
+	done 2>/dev/null 'quoted text' 2>/dev/null -eu
+		&& 2>/dev/null then then
+	-eu | $(pwd) echo 2>/dev/null grep
+	echo "$@" "$@" x=1 'quoted text' grep "$1" echo && -eu then ${HOME} sed echo
+readonly 'quoted text' "$1" -eu test /usr/bin sed test "$1" "$1" | x=1 cd
+	test /usr/bin $(pwd) x=1 /usr/bin 'quoted text' x=1 ${HOME} done export "$1"
+		grep done readonly grep | export sed --verbose export then 2>/dev/null "$@"
+		$(pwd) -eu export /usr/bin cd ${HOME} export 2>/dev/null
+	--verbose readonly echo | /usr/bin readonly
+/usr/bin --verbose | done test cd && then "$@" awk printf
+/usr/bin export test /usr/bin ${HOME} $(pwd) 'quoted text' test 'quoted text'
+awk sed readonly local --verbose
+'quoted text' sed $(pwd) x=1 sed | $(pwd) readonly $(pwd) x=1 local grep
+		export "$1" grep printf test $(pwd) -eu
+		sed readonly 2>/dev/null printf done ${HOME}
+	cd then | then export -eu
+		test "$@" "$1" readonly test && then sed --verbose then
+		awk grep x=1 local /usr/bin
+		sed --verbose 2>/dev/null "$@" done 2>/dev/null
+	export -eu test 'quoted text' grep "$1" sed sed sed && &&
+	local cd "$1" grep test local then then
+	cd grep /usr/bin grep /usr/bin 2>/dev/null sed local test
+	then echo then ${HOME} then test echo -eu sed /usr/bin
+		grep 2>/dev/null -eu then echo cd x=1 awk
+	echo export $(pwd) awk | export then $(pwd) "$1" sed 'quoted text' done sed $(pwd)
+		| export done readonly then
+	&& 2>/dev/null x=1 "$@" 2>/dev/null echo echo "$1" /usr/bin cd printf ${HOME}
+	awk cd local then x=1 2>/dev/null local 'quoted text' test $(pwd) && local
+		done echo | "$1" local then grep && printf
+	done printf ${HOME} local done "$@" export ${HOME} grep
+	"$@" done done grep then awk cd readonly -eu ${HOME}
+	"$1" awk | test done grep ${HOME} x=1 local 'quoted text' test ${HOME} then
+&& sed --verbose local printf sed ${HOME} 2>/dev/null
+	printf x=1 echo && "$@" cd printf /usr/bin test x=1
+local test cd "$@" "$1" ${HOME} $(pwd)
+test /usr/bin done 'quoted text' -eu x=1 local grep && | 2>/dev/null test done
+"$@" | test sed | grep awk printf printf -eu grep sed "$1" /usr/bin awk
+	"$@" awk grep local && x=1 && grep grep done local echo /usr/bin "$@"
+		2>/dev/null grep grep $(pwd) $(pwd) 'quoted text' grep test export "$@" -eu test
+		grep readonly ${HOME} printf 2>/dev/null
+		printf printf | sed printf then cd grep local && readonly /usr/bin | 'quoted text'
+	| grep sed export printf test grep --verbose cd printf export grep
+		cd /usr/bin ${HOME} ${HOME} 'quoted text' x=1 'quoted text'
+done --verbose awk echo "$@" 2>/dev/null
+${HOME} cd /usr/bin --verbose | export ${HOME}
+"$@" cd grep 2>/dev/null echo | x=1 awk && local $(pwd) printf
+2>/dev/null | readonly 2>/dev/null -eu ${HOME} x=1 | test x=1 'quoted text'
+	'quoted text' && /usr/bin | | echo printf
+cd | export -eu echo cd 2>/dev/null
+	"$@" 'quoted text' local 'quoted text' cd --verbose
+x=1 printf $(pwd) ${HOME} awk "$@" then cd | "$@"
+/usr/bin -eu && printf grep
+		-eu $(pwd) then local readonly
+	done && "$1" -eu echo /usr/bin cd done echo && x=1 -eu ${HOME} then $(pwd) awk
+		then readonly then 2>/dev/null $(pwd) sed
+&& readonly 'quoted text' 'quoted text'
+	'quoted text' readonly --verbose && -eu then
+		grep 'quoted text' echo | sed
+		| awk test x=1 "$1" "$@" grep
+	/usr/bin "$1" --verbose /usr/bin 'quoted text' -eu
+	'quoted text' cd && $(pwd) x=1 cd echo "$1"
+		/usr/bin sed export ${HOME}
+&& $(pwd) readonly 'quoted text'
+	done --verbose $(pwd) grep x=1 local "$@" cd export grep test local
+-eu ${HOME} sed "$@" --verbose -eu readonly 'quoted text'
+		--verbose printf then cd x=1 $(pwd)
+test readonly cd --verbose 2>/dev/null -eu local grep "$1" test readonly
+		"$@" 2>/dev/null x=1 $(pwd) local then "$@"
+--verbose $(pwd) ${HOME} export sed "$1" echo && | | done export done | awk
+		&& && done /usr/bin printf then
+	sed 'quoted text' sed -eu done local awk done 2>/dev/null grep grep --verbose
+	$(pwd) 'quoted text' x=1 $(pwd) done grep cd /usr/bin
+		awk 2>/dev/null printf local echo echo sed then then grep export "$@" printf
+		export printf x=1 'quoted text' 'quoted text'
+--verbose 2>/dev/null printf "$@"
+		done "$@" cd done 'quoted text'
+&& $(pwd) done test --verbose --verbose &&
+		| done $(pwd) | "$1" sed local
+		echo printf x=1 "$@" /usr/bin && $(pwd) /usr/bin 'quoted text' grep --verbose
+		${HOME} 2>/dev/null done $(pwd) x=1
+	-eu x=1 cd then done 'quoted text' x=1 "$1" x=1
+	"$1" sed --verbose sed "$@" test printf awk printf /usr/bin local -eu cd
+	sed "$@" 'quoted text' | --verbose awk readonly then "$@" | sed && ${HOME}
+	-eu x=1 $(pwd) -eu 2>/dev/null "$1"
+	printf --verbose "$@" readonly -eu
+	2>/dev/null /usr/bin export sed && cd grep x=1
+awk sed -eu cd sed x=1 then x=1 --verbose export ${HOME} export $(pwd) test
+		awk readonly $(pwd) echo grep
+		--verbose local && sed --verbose done readonly
+		${HOME} cd awk readonly echo readonly awk
+		cd x=1 && sed -eu && awk printf export grep --verbose /usr/bin 'quoted text'
+	test test export "$@" done && 2>/dev/null
+		"$@" awk "$@" export 'quoted text' ${HOME}
+		done awk 2>/dev/null awk grep sed awk /usr/bin
+printf /usr/bin /usr/bin export x=1 cd test "$@" | test echo grep then grep
+		awk | printf x=1 cd && /usr/bin ${HOME} echo && done 'quoted text' /usr/bin
+		/usr/bin local export sed export | 'quoted text' awk && then
+		grep ${HOME} --verbose then && echo sed awk 'quoted text' then awk "$1" |
+		/usr/bin done awk | export then grep then local local echo awk done | --verbose
+		printf "$@" ${HOME} then echo x=1
+	awk local -eu export x=1 'quoted text' echo | sed
+cd test export 'quoted text' readonly
+done export printf readonly x=1 local x=1 && readonly --verbose ${HOME}
+"$@" 2>/dev/null export awk ${HOME} readonly "$1" then export readonly
+		cd 2>/dev/null cd 2>/dev/null -eu
+		2>/dev/null local "$1"
+done -eu then "$1" export | "$@" awk "$@" local 'quoted text' sed
+2>/dev/null readonly readonly $(pwd) export /usr/bin
+awk /usr/bin ${HOME} 'quoted text' "$1" echo -eu "$1" readonly
+		2>/dev/null readonly done printf 'quoted text' test printf -eu
+"$@" test "$1" local "$@" grep then sed grep echo &&
+grep awk -eu x=1 | test test printf sed readonly readonly -eu x=1 -eu --verbose
+	&& echo export export -eu -eu test -eu --verbose x=1
+2>/dev/null "$1" done sed "$@" printf printf "$1" local /usr/bin && -eu
+	"$@" test grep readonly x=1 readonly echo printf
+"$1" local sed 'quoted text'
+	| test /usr/bin ${HOME} done "$@" && export
+		${HOME} $(pwd) $(pwd) then readonly ${HOME} ${HOME} ${HOME}
+		sed $(pwd) test | -eu echo done echo ${HOME}
+2>/dev/null printf sed sed export test "$@" printf grep /usr/bin
+local test local echo "$1" | && local readonly
+local "$1" "$@" "$@" "$@"
+	awk test done --verbose echo cd 2>/dev/null $(pwd)
+		local 'quoted text' "$1" awk echo $(pwd) local awk awk 2>/dev/null | printf
+	cd test x=1 x=1 && awk sed printf /usr/bin local done
+	&& readonly "$@" --verbose --verbose echo printf "$@" -eu
+	/usr/bin $(pwd) --verbose local | echo test local local --verbose
+then awk grep local then cd test -eu cd done $(pwd) --verbose ${HOME} done local
+		printf printf cd sed "$@" "$1" local cd | 'quoted text' readonly &&
+	&& 'quoted text' 'quoted text' echo ${HOME}
+		--verbose export $(pwd) | $(pwd)
+	$(pwd) readonly export x=1 "$1"
+	done 2>/dev/null "$@" ${HOME} then 'quoted text' --verbose | done sed /usr/bin
+		echo printf local cd cd echo -eu then export -eu local printf
+		echo x=1 echo 2>/dev/null ${HOME} test
+	&& readonly local sed test /usr/bin
+	--verbose echo grep printf --verbose &&
+	"$1" grep 2>/dev/null then $(pwd) /usr/bin
+local local 'quoted text' local
+	echo echo readonly awk
+		done printf grep test 2>/dev/null -eu "$1" | ${HOME} export
+	2>/dev/null grep local --verbose test export -eu --verbose 'quoted text'
+		${HOME} export grep sed ${HOME} echo --verbose 2>/dev/null 2>/dev/null
+		awk -eu echo printf done awk printf
+		done "$@" | -eu then then readonly awk 'quoted text' readonly 2>/dev/null
+	readonly test "$@" done grep /usr/bin $(pwd) ${HOME} then done
+"$1" echo grep $(pwd) | done cd grep
+		--verbose ${HOME} "$1" readonly cd ${HOME} x=1 then
+export export echo x=1 "$1" printf sed sed -eu sed local readonly x=1 "$1"
+	--verbose -eu 2>/dev/null grep
+${HOME} --verbose /usr/bin
+local --verbose then
+		'quoted text' sed local done echo
+done then grep cd export | "$@" /usr/bin "$@" 2>/dev/null
+echo "$@" --verbose -eu "$@" 'quoted text' cd && local x=1 test
+	| -eu 2>/dev/null cd grep readonly then awk x=1 -eu then --verbose
+	$(pwd) then "$@" "$@" echo x=1 grep then $(pwd) local sed
+		$(pwd) --verbose echo grep printf 2>/dev/null
+		-eu x=1 'quoted text' "$@" readonly 'quoted text'
+| grep x=1 -eu local awk echo printf grep echo sed "$1" test
+${HOME} awk /usr/bin done printf
+		cd ${HOME} 2>/dev/null $(pwd) sed sed
+$(pwd) $(pwd) then "$@" printf x=1 $(pwd) export ${HOME} "$1" 2>/dev/null
+done then then cd readonly --verbose then 'quoted text' printf
+	--verbose 'quoted text' 2>/dev/null then test
+		done /usr/bin 2>/dev/null
+	&& 'quoted text' "$1" test x=1 ${HOME} &&
+local echo test done printf then /usr/bin
+/usr/bin echo awk then --verbose
+	$(pwd) test test grep then done /usr/bin 2>/dev/null
+	sed "$1" local local 2>/dev/null cd sed x=1 sed ${HOME}
+test echo && x=1 sed "$1" | export export /usr/bin ${HOME} grep
+$(pwd) sed && -eu 2>/dev/null $(pwd) readonly
+		'quoted text' "$1" sed --verbose "$1" awk grep && x=1 ${HOME} -eu
+'quoted text' echo cd grep "$1" printf test "$@" 2>/dev/null export
+		local printf grep then printf --verbose | | done local local readonly
+readonly && -eu "$@" grep test 2>/dev/null /usr/bin
+		test 2>/dev/null readonly x=1 export sed --verbose grep grep test
+		2>/dev/null then /usr/bin ${HOME} $(pwd) done x=1
+x=1 then sed awk x=1 sed then grep test local awk 2>/dev/null grep | cd
+		| local done echo cd "$1" /usr/bin cd -eu local awk local awk | && grep readonly
+cd awk readonly local "$@" --verbose
+-eu /usr/bin | readonly done 2>/dev/null 'quoted text' "$1"
+echo sed readonly test "$@" sed echo /usr/bin ${HOME} grep awk
+		export 2>/dev/null sed && test printf then readonly awk 'quoted text' printf
+	&& sed test --verbose ${HOME} export |
+"$@" ${HOME} ${HOME} sed printf
+		--verbose $(pwd) --verbose local grep ${HOME}
+		2>/dev/null cd awk then && | sed 'quoted text' awk && printf 2>/dev/null
+		sed -eu export 2>/dev/null "$1" "$1" test
+		cd readonly "$@" --verbose $(pwd) /usr/bin "$1" "$1" cd ${HOME}
+		--verbose --verbose /usr/bin 2>/dev/null local
+local x=1 sed "$1" $(pwd) local done /usr/bin
+		cd local $(pwd) test $(pwd) "$@" &&
+	$(pwd) ${HOME} 2>/dev/null echo 'quoted text' awk --verbose test printf test
+export cd "$1" /usr/bin readonly && 'quoted text' x=1 export -eu ${HOME}
+awk echo && test echo echo x=1 && cd grep "$1" awk
+--verbose "$1" readonly local test "$@" export local 2>/dev/null export
+&& readonly awk sed done
+		$(pwd) /usr/bin printf
+		"$1" awk "$@" "$1" --verbose
+	test cd readonly && sed ${HOME} --verbose echo test "$1" 2>/dev/null
+readonly echo 2>/dev/null ${HOME} "$@" done 'quoted text'
+		'quoted text' sed readonly echo $(pwd)
+	"$1" readonly done /usr/bin grep echo then printf
+	then x=1 $(pwd) grep && export 'quoted text' echo
+	${HOME} "$1" then -eu --verbose awk then done readonly readonly && /usr/bin
+awk $(pwd) cd cd export printf printf -eu test
+		done test | 'quoted text' done $(pwd) export
+	sed readonly | cd "$@" -eu x=1 done
+done echo cd "$@" done | local 'quoted text' "$1" $(pwd) -eu
+	$(pwd) --verbose "$1" && export 'quoted text' 2>/dev/null printf 2>/dev/null 'quoted text'
+${HOME} --verbose x=1 $(pwd) /usr/bin awk "$@"
+	test printf x=1 /usr/bin "$1" sed "$1"
+	then | readonly readonly ${HOME} ${HOME}
+		$(pwd) x=1 --verbose then grep sed grep
+		-eu ${HOME} ${HOME} 'quoted text' -eu ${HOME} x=1 cd 2>/dev/null
+		'quoted text' echo done $(pwd) "$@" "$@"
+		sed "$1" --verbose 2>/dev/null "$@" local then "$1" export readonly export
+	then echo then 'quoted text' 'quoted text' export
+	$(pwd) -eu readonly awk echo &&
+	then export | /usr/bin test then sed "$@" 'quoted text' "$@" "$@" 2>/dev/null sed
+awk && "$1" 2>/dev/null export -eu ${HOME} x=1 printf export x=1 "$@" sed
+then && | | /usr/bin cd --verbose
+sed awk test ${HOME} awk
+		"$1" 'quoted text' grep then $(pwd) --verbose 'quoted text'
+	"$1" 2>/dev/null /usr/bin $(pwd) test local
+2>/dev/null printf /usr/bin "$@" ${HOME} "$1" test echo
+	local awk ${HOME} x=1 awk /usr/bin --verbose export echo x=1 cd
+"$@" export done | export grep 2>/dev/null 2>/dev/null test x=1 sed test
+	2>/dev/null echo awk local test then 2>/dev/null readonly
+		printf grep -eu && x=1 x=1 export printf ${HOME} readonly then ${HOME}
+local && "$@" test x=1 $(pwd) grep printf "$1" local
+		grep 2>/dev/null export sed -eu && "$@" | echo awk awk
+	cd printf "$1" cd | test x=1 done
+echo "$@" --verbose readonly test done then ${HOME}
+		2>/dev/null -eu --verbose export
+		| sed 2>/dev/null readonly export then | printf | readonly 2>/dev/null local
+		export 'quoted text' "$1" -eu echo 2>/dev/null readonly awk done
+	then | local export cd local --verbose x=1 sed -eu $(pwd)
+		| && 'quoted text' "$@" printf x=1 then -eu export printf && "$1"
+2>/dev/null -eu -eu -eu $(pwd) test sed $(pwd) sed test "$@"
+&& printf done 2>/dev/null
+	2>/dev/null 'quoted text'
+	grep "$1" | --verbose --verbose awk --verbose cd
+cd awk grep sed $(pwd) ${HOME} | done -eu local
+	echo test export x=1 "$1" done cd | export
+		sed /usr/bin awk done /usr/bin
+"$@" -eu local x=1 test 2>/dev/null x=1 done "$@" "$1" ${HOME} x=1
+	"$1" 2>/dev/null printf -eu -eu /usr/bin export grep export "$1" awk --verbose local
+	export echo x=1 printf x=1 export | done local done $(pwd) sed readonly
+	/usr/bin "$1" | printf "$1" cd "$@" ${HOME}
+"$@" $(pwd) --verbose export && awk x=1 'quoted text' grep local "$1" x=1
+sed readonly awk awk awk done && sed echo $(pwd)
+	local test readonly test printf x=1 'quoted text'
+		export done done export ${HOME} x=1 local $(pwd) export "$1" cd sed $(pwd) 2>/dev/null
+	$(pwd) local ${HOME} export $(pwd) --verbose ${HOME} ${HOME}
+-eu 'quoted text' local test ${HOME} $(pwd) awk /usr/bin --verbose
+done && ${HOME} printf /usr/bin readonly --verbose sed --verbose --verbose
+		awk x=1 -eu echo $(pwd) export echo ${HOME} printf echo x=1 ${HOME} --verbose
+	$(pwd) /usr/bin -eu "$1" $(pwd) test echo sed
+		readonly 2>/dev/null then "$@" sed grep echo printf test
+		printf 'quoted text' test
+sed ${HOME} done "$1" "$@" && printf sed | -eu x=1 local
+		cd /usr/bin test 'quoted text' 'quoted text' cd 'quoted text' /usr/bin
+		x=1 "$@" --verbose /usr/bin && cd echo --verbose printf cd test -eu
+printf 2>/dev/null readonly done awk cd sed 'quoted text' done export sed
+	$(pwd) test "$1" sed done echo done | readonly local
+printf --verbose grep
+		echo 2>/dev/null x=1 sed printf local printf local
+-eu printf sed awk export then
+		echo sed && "$@" 'quoted text' sed echo
+		cd 2>/dev/null && awk printf ${HOME} grep "$@" done "$1" test done -eu test
+then then local $(pwd) && test cd "$@" "$@" /usr/bin | export local
+		export test x=1 echo test readonly $(pwd) then sed grep readonly /usr/bin
+cd local 2>/dev/null printf
+	2>/dev/null test awk --verbose export
+	$(pwd) export done cd x=1 2>/dev/null /usr/bin | cd "$@" ${HOME} ${HOME}
+		&& | "$@" 2>/dev/null echo && test "$@" && local /usr/bin && -eu export
+sed test cd && | export /usr/bin printf grep printf echo | grep readonly
+		printf "$@" | done awk awk done
+		/usr/bin && x=1 sed "$@" awk 'quoted text' ${HOME} $(pwd) local | "$1"
+		awk --verbose printf 2>/dev/null readonly && export 2>/dev/null
+		&& echo test export "$1" sed 2>/dev/null awk 2>/dev/null sed /usr/bin ${HOME}
+printf $(pwd) printf export echo
+2>/dev/null test sed x=1
+test sed && awk "$1" /usr/bin ${HOME} awk
+cd sed printf $(pwd) printf echo --verbose 2>/dev/null /usr/bin
+		sed 2>/dev/null 'quoted text' grep
+		cd -eu export && 2>/dev/null readonly done -eu test export 2>/dev/null /usr/bin
+${HOME} grep 'quoted text' 2>/dev/null $(pwd)
+'quoted text' then done x=1 x=1 export | x=1 echo
+		test readonly grep readonly
+	grep awk /usr/bin "$@" /usr/bin --verbose grep echo printf "$1" readonly
+		'quoted text' test 'quoted text' x=1 awk awk cd awk then $(pwd)
+	"$@" "$1" echo x=1 x=1 grep cd export $(pwd) $(pwd) printf "$@" test ${HOME} $(pwd)
+	readonly ${HOME} awk test done x=1 -eu --verbose x=1 "$1" --verbose | sed "$1"
+	&& /usr/bin | sed "$1" /usr/bin printf | echo ${HOME} cd local $(pwd)
+		"$1" $(pwd) local readonly x=1 local
+		&& done 2>/dev/null $(pwd) ${HOME} ${HOME} export grep 2>/dev/null
+--verbose done printf then printf sed awk 2>/dev/null 2>/dev/null
+		test echo readonly export grep then readonly
+	x=1 ${HOME} --verbose cd ${HOME} /usr/bin printf sed
+2>/dev/null grep cd readonly echo "$1"
+	local "$@" local 2>/dev/null done then printf $(pwd) && awk --verbose
+		/usr/bin awk /usr/bin "$1" readonly /usr/bin 2>/dev/null
+-eu "$1" && then 2>/dev/null /usr/bin "$@" ${HOME}
+cd 'quoted text' sed done ${HOME} awk local
+	printf | | 2>/dev/null then then awk done $(pwd) 'quoted text' sed
+then "$@" printf readonly -eu printf $(pwd) 2>/dev/null ${HOME} export done
+		export grep printf x=1 cd done cd local
+	"$1" readonly test && echo test 'quoted text'
+	done sed x=1 | 'quoted text' local "$1" $(pwd) $(pwd) printf 'quoted text'
+		done done x=1 | $(pwd) sed then local "$1" "$1" sed | $(pwd) 2>/dev/null ${HOME}
+	export test x=1 $(pwd) /usr/bin readonly -eu printf 2>/dev/null
+	-eu awk cd ${HOME} "$1"
+		then /usr/bin 'quoted text'
+		local && sed --verbose -eu "$1" export $(pwd) export grep
+"$@" 2>/dev/null ${HOME} --verbose $(pwd) sed awk x=1 local readonly grep 'quoted text'
+	grep echo 2>/dev/null local x=1 local cd -eu
+		/usr/bin ${HOME} printf export then
+	awk echo echo grep done |
+local readonly printf
+export echo then echo export
+	cd /usr/bin echo | x=1 $(pwd) export 'quoted text' local
+		"$1" printf "$1" test sed $(pwd) export local then export
+	cd sed x=1 'quoted text' "$@" local awk
+	test "$@" /usr/bin && export echo --verbose then cd
+&& x=1 'quoted text' readonly 'quoted text' x=1 "$1" echo
+		printf "$@" grep echo && printf && test then $(pwd)
+		echo readonly x=1 local | local awk $(pwd) grep readonly x=1 ${HOME} done 'quoted text'
+cd | | x=1 grep "$1" ${HOME} done sed ${HOME}
+		'quoted text' "$1" awk 'quoted text' 2>/dev/null
+		echo --verbose 'quoted text' "$@" export awk ${HOME}
+'quoted text' "$1" echo 2>/dev/null export printf then
+		&& x=1 sed done 2>/dev/null "$1"
+	done 'quoted text' -eu awk local | | --verbose "$1" 2>/dev/null grep sed
+	$(pwd) --verbose $(pwd) done
+		| | "$1" | cd cd done grep awk grep | export
+grep | done -eu x=1 awk cd local local "$1"
+	awk 2>/dev/null done awk local && echo
+		| 2>/dev/null /usr/bin export -eu
+		cd x=1 test readonly "$@" awk -eu test "$@"
+echo done 2>/dev/null done grep sed ${HOME} readonly export | | awk export
+		| 2>/dev/null readonly 'quoted text' 2>/dev/null cd
+		| test --verbose -eu printf 2>/dev/null sed export 2>/dev/null
+done done then grep printf readonly 2>/dev/null readonly export
+		export "$1" local printf cd -eu
+	2>/dev/null x=1 /usr/bin 2>/dev/null "$1" grep
+test done printf awk then --verbose readonly "$1" ${HOME} awk x=1
+	"$1" ${HOME} echo $(pwd) cd grep 'quoted text'
+		--verbose --verbose grep "$@" $(pwd) 'quoted text'
+		"$@" cd -eu local $(pwd) export then | grep 'quoted text' 2>/dev/null
+		"$1" /usr/bin local $(pwd) done
+		"$1" | "$@" 2>/dev/null "$@" local "$1" sed "$1" done --verbose
+	/usr/bin "$@" ${HOME} local test $(pwd) --verbose export x=1 2>/dev/null &&
+		then | grep $(pwd) readonly "$@" x=1 grep
+		${HOME} -eu test export $(pwd) echo then 2>/dev/null
+	/usr/bin $(pwd) grep sed x=1 x=1 sed
+$(pwd) then "$1" $(pwd) local grep
+test && then | cd --verbose local x=1 x=1 local
+	"$@" then then grep -eu export /usr/bin $(pwd) 2>/dev/null $(pwd)
+readonly && echo then awk sed ${HOME}
+		/usr/bin x=1 sed local printf sed $(pwd) printf
+${HOME} -eu x=1 readonly sed then |
+		printf cd cd sed $(pwd) $(pwd)
+/usr/bin && -eu 'quoted text' grep
+&& -eu -eu x=1 2>/dev/null printf "$@" && $(pwd) "$1" export
+		--verbose done echo "$@" cd echo echo cd awk "$@" "$1" "$1" test awk local
+"$1" "$@" grep awk ${HOME} "$1" echo echo $(pwd) $(pwd) 2>/dev/null 'quoted text'
+	grep echo x=1 then "$@" sed $(pwd)
+		local done ${HOME} && -eu "$1" sed $(pwd) "$@" test then done
+		cd $(pwd) export ${HOME} ${HOME} echo done readonly export test --verbose
+		test ${HOME} 2>/dev/null awk test "$1" && $(pwd) $(pwd) printf && --verbose
+	done && 'quoted text' "$1" /usr/bin
+test 'quoted text' $(pwd) ${HOME} --verbose 2>/dev/null test
+		x=1 done /usr/bin local done -eu grep local then
+		-eu then done done 2>/dev/null
+		2>/dev/null -eu done cd local test 'quoted text'
+	"$@" -eu && 'quoted text' grep then then test echo sed
+	printf -eu export then -eu && x=1 printf ${HOME} export
+${HOME} $(pwd) ${HOME} 'quoted text' /usr/bin local /usr/bin
+	x=1 cd && readonly export
+		grep && cd | grep x=1 x=1 grep /usr/bin export test test
+	sed 2>/dev/null printf export export /usr/bin readonly local echo cd
+done "$@" /usr/bin -eu grep --verbose echo x=1
+	sed x=1 --verbose test awk /usr/bin readonly local grep
+&& $(pwd) "$1" local
+then export then --verbose awk
+$(pwd) done "$1" "$1" test readonly printf done $(pwd) x=1 readonly
+		sed 2>/dev/null x=1 && "$@" local printf grep
+		$(pwd) local && awk echo /usr/bin done 2>/dev/null ${HOME} sed /usr/bin cd sed
+	awk -eu sed sed 2>/dev/null -eu 2>/dev/null
+		"$@" 2>/dev/null ${HOME} test | cd done
+	--verbose $(pwd) /usr/bin echo then ${HOME} ${HOME} readonly grep then
+		2>/dev/null && cd x=1 printf "$@" && echo "$@" then --verbose
+		test x=1 x=1 test ${HOME} "$@" grep | grep cd /usr/bin export 2>/dev/null
+	/usr/bin 'quoted text' 2>/dev/null test 2>/dev/null
+	test "$1" "$@" done sed echo cd local 'quoted text' "$1" ${HOME}
+${HOME} awk grep echo && local x=1 export --verbose
+"$1" sed grep echo readonly echo ${HOME} then done && "$1" echo "$@" printf
+		| /usr/bin local test -eu -eu $(pwd) awk $(pwd)
+		-eu readonly done $(pwd) test
+local --verbose grep sed readonly x=1 "$@" done && cd echo -eu awk /usr/bin
+	local $(pwd) 2>/dev/null printf &&
+	readonly --verbose printf 2>/dev/null && awk cd grep
+	sed --verbose --verbose $(pwd) export "$1" | "$@" local | awk ${HOME}
+		2>/dev/null && printf x=1 echo /usr/bin && 2>/dev/null export readonly
+	then 2>/dev/null done awk $(pwd) echo $(pwd) test export
+		"$1" $(pwd) ${HOME} ${HOME} /usr/bin cd 2>/dev/null printf
+	"$1" x=1 done 'quoted text' test 2>/dev/null $(pwd) then export
+		cd echo sed grep then /usr/bin then done "$@" && sed export -eu echo awk printf
+		grep --verbose 'quoted text' --verbose printf
+&& && awk && test cd /usr/bin -eu
+		test && -eu echo grep ${HOME} echo "$@"
+	"$@" grep /usr/bin readonly $(pwd) "$@" local
+/usr/bin /usr/bin grep | "$1" && test -eu then && --verbose
+	/usr/bin local "$@" | -eu --verbose 2>/dev/null 2>/dev/null |
+		--verbose /usr/bin export /usr/bin printf 'quoted text'
+		x=1 /usr/bin test && awk -eu && -eu
+	export printf "$@" && "$1" echo cd then sed grep 'quoted text' cd printf
+	x=1 echo "$@" "$1" ${HOME} x=1 test 2>/dev/null
+	export "$@" && echo awk export
+		cd 'quoted text' ${HOME}
+	&& 2>/dev/null $(pwd) awk export local then then printf
+	done 'quoted text' local local sed
+'quoted text' $(pwd) && printf "$1" "$1" -eu echo && /usr/bin readonly
+	--verbose ${HOME} sed printf --verbose "$@" x=1 2>/dev/null
+--verbose --verbose awk 'quoted text' "$@"
+cd "$@" "$@" readonly echo
+		done | -eu cd "$@" cd "$@" awk local cd cd | local printf printf
+	-eu grep ${HOME} "$1" done awk "$1" local sed /usr/bin "$1" x=1 export readonly
+		"$1" -eu test then local
+readonly -eu /usr/bin
+	${HOME} "$1" 2>/dev/null $(pwd) readonly sed local printf
+	--verbose $(pwd) readonly then export readonly grep ${HOME}
+		export grep grep 2>/dev/null
+		grep ${HOME} awk printf grep -eu echo grep printf 2>/dev/null "$@" ${HOME} sed
+	done | 2>/dev/null test done printf readonly local $(pwd)
+	$(pwd) echo $(pwd) --verbose "$@" printf done local $(pwd)
+		"$@" printf readonly sed then --verbose export ${HOME}
+		test then cd echo | | && cd "$1" && awk test done readonly "$@" local ${HOME}
+echo 2>/dev/null 'quoted text' then 2>/dev/null export
+done export ${HOME} 'quoted text'
+	cd cd && readonly test --verbose local test cd printf
+	${HOME} echo 2>/dev/null "$1"
+	cd 'quoted text' cd sed test done cd grep 'quoted text'
+		2>/dev/null echo echo "$@" -eu cd grep 2>/dev/null /usr/bin
+	/usr/bin echo awk && x=1 then x=1
+		$(pwd) /usr/bin done "$@" grep sed -eu export done 2>/dev/null
+$(pwd) test -eu done | grep awk
+		grep /usr/bin grep -eu 2>/dev/null && ${HOME} "$@" then
+awk | $(pwd) readonly /usr/bin $(pwd) done -eu
+		--verbose ${HOME} | sed x=1 local echo done cd echo
+		'quoted text' 2>/dev/null "$1" /usr/bin export /usr/bin printf "$@" --verbose
+cd -eu x=1 export cd test readonly $(pwd) cd --verbose then
+test ${HOME} "$1" local && echo $(pwd)
+		"$@" 2>/dev/null grep grep | sed done x=1 test $(pwd) readonly cd cd
+echo 'quoted text' cd "$1" done grep export readonly awk then printf
+2>/dev/null 'quoted text' echo cd && | cd
+	| cd then grep /usr/bin && local x=1 sed $(pwd) printf $(pwd) sed sed printf
+$(pwd) sed --verbose && 2>/dev/null done && echo done --verbose /usr/bin
+	then 2>/dev/null | "$@" printf local cd --verbose "$1" done /usr/bin readonly
+export local printf awk cd export test 2>/dev/null
+	&& grep cd sed done grep 'quoted text' local
+${HOME} && 2>/dev/null
+printf echo test "$1" "$@" "$@" x=1 &&
+	done sed export cd test sed printf 'quoted text'
+export awk /usr/bin x=1 $(pwd) test | ${HOME} 2>/dev/null
+	readonly readonly awk export
+		${HOME} | 'quoted text' $(pwd) | 'quoted text' |
+awk $(pwd) echo grep then export awk grep x=1 done -eu
+	2>/dev/null $(pwd) sed --verbose then
+done grep done && sed then
+/usr/bin -eu export then grep echo "$1" awk -eu done
+		"$1" ${HOME} | | && x=1 readonly
+&& local done "$@" && $(pwd) 'quoted text'
+		--verbose "$@" sed grep sed $(pwd) |
+test "$1" echo /usr/bin 2>/dev/null
+		sed $(pwd) then x=1 | then grep "$1" then /usr/bin awk printf 'quoted text'
+printf -eu echo local echo
+	/usr/bin -eu ${HOME} /usr/bin "$1"
+export $(pwd) ${HOME} awk
+	"$1" readonly ${HOME} local && echo "$@" readonly /usr/bin sed
+	echo -eu echo && 2>/dev/null awk test /usr/bin printf x=1 x=1 | ${HOME} /usr/bin
+		"$1" 2>/dev/null | done
+		-eu then $(pwd) printf done done echo && printf export echo export
+"$@" ${HOME} cd echo readonly x=1 grep | grep "$1" $(pwd) cd -eu "$1"
+		-eu awk printf "$1" printf then done
+		printf local printf "$@" cd /usr/bin x=1 local sed done -eu
+		"$1" done && 2>/dev/null "$@" done local
+--verbose --verbose -eu export done echo "$@" ${HOME} | readonly -eu $(pwd)
+done grep 'quoted text' sed printf 2>/dev/null --verbose
+		export grep && | /usr/bin ${HOME} awk 'quoted text' 'quoted text' 2>/dev/null
+	sed grep $(pwd) 2>/dev/null
+		awk local 'quoted text' test readonly printf -eu local | sed sed local echo "$1"
+	-eu local echo 'quoted text' local x=1
+	--verbose --verbose awk
+	export local "$@" printf 2>/dev/null local then export
+	/usr/bin done --verbose "$1" local grep
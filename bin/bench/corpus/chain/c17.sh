@@ -0,0 +1,2001 @@
+| && local awk 2>/dev/null local "$1" -eu done -eu /usr/bin
+	export export 2>/dev/null --verbose -eu done $(pwd) test 2>/dev/null then then test
+	"$@" echo x=1 export printf | "$@" -eu ${HOME} done | && cd 2>/dev/null
+"$@" printf grep 'quoted text' readonly "$@" && $(pwd) echo readonly "$@" sed printf
+		export "$@" /usr/bin test --verbose readonly test
+grep | sed then "$@" cd printf | export /usr/bin
+		"$1" 'quoted text' "$1" | --verbose readonly 2>/dev/null |
+	done grep x=1 sed then local printf
+		--verbose echo local test ${HOME} --verbose --verbose
+		"$@" 'quoted text' "$1" export 2>/dev/null grep ${HOME} done grep
+	printf -eu sed local local 'quoted text'
+${HOME} | cd test sed local 'quoted text' printf 2>/dev/null "$@" then 'quoted text'
+		awk ${HOME} && /usr/bin /usr/bin then echo export printf grep -eu echo
+/usr/bin x=1 done local /usr/bin
+"$@" awk awk grep 'quoted text' sed x=1
+	sed | --verbose 2>/dev/null cd | x=1 x=1 $(pwd) x=1
+printf --verbose sed | readonly
+		cd done x=1 sed export
+readonly | echo $(pwd) x=1 $(pwd) cd /usr/bin | --verbose
+		then /usr/bin sed | $(pwd) "$@" ${HOME} sed && ${HOME} "$@" printf readonly
+	$(pwd) && && done /usr/bin --verbose
+grep sed readonly --verbose "$1" cd $(pwd) 'quoted text'
+printf | echo test && echo 'quoted text' local echo |
+done readonly then awk 2>/dev/null
+	"$1" awk -eu ${HOME} --verbose && x=1 readonly awk then /usr/bin grep x=1
+	then awk sed -eu "$1" "$@" awk
+	readonly -eu printf printf
+	"$@" awk x=1 | done printf $(pwd) "$@"
+	done readonly -eu ${HOME} readonly test grep echo
+	sed "$1" /usr/bin export echo grep done "$@" then done
+readonly grep -eu -eu --verbose "$@" test
+		echo test && cd && ${HOME} readonly printf cd --verbose | $(pwd)
+	grep && printf then echo --verbose echo "$@" echo readonly awk echo
+	&& "$@" --verbose -eu ${HOME} then --verbose --verbose --verbose $(pwd) -eu /usr/bin
+"$@" test | 2>/dev/null cd /usr/bin /usr/bin test 'quoted text'
+		&& /usr/bin done x=1 2>/dev/null && && test export --verbose
+-eu | grep test sed awk -eu sed && x=1 "$@" | --verbose
+printf 2>/dev/null export export "$@" "$1" "$@" done printf test
+		2>/dev/null --verbose --verbose
+		$(pwd) --verbose done x=1 readonly
+	-eu "$@" local local done "$@" printf printf
+echo | 'quoted text' | 'quoted text'
+local x=1 | "$@" done local | export && local $(pwd) then
+grep 2>/dev/null x=1 ${HOME} echo ${HOME} && printf
+"$1" cd ${HOME} done "$1" printf | local
+	"$1" /usr/bin $(pwd) cd -eu test readonly
+/usr/bin -eu "$@" test then
+		then 'quoted text' && export ${HOME} printf done sed sed
+		"$1" 'quoted text' grep && $(pwd) && -eu local readonly
+&& /usr/bin then cd 'quoted text' sed x=1 /usr/bin cd ${HOME} $(pwd) -eu "$1" echo
+		| done export then -eu ${HOME} done awk printf
+cd $(pwd) then $(pwd) && "$1" test
+		done then readonly echo done readonly
+printf local local grep then 'quoted text' sed $(pwd) cd && printf then $(pwd)
+		| ${HOME} -eu sed cd | done --verbose "$@" then awk cd
+	"$@" x=1 test --verbose echo 2>/dev/null cd cd readonly done | && echo /usr/bin
+/usr/bin local export --verbose
+grep 2>/dev/null --verbose x=1 sed local -eu awk sed "$@" 'quoted text' 'quoted text'
+test 2>/dev/null -eu test $(pwd) local --verbose
+done sed x=1 "$@" echo cd && | --verbose --verbose
+		2>/dev/null $(pwd) then "$1" sed export readonly -eu 2>/dev/null test test -eu
+x=1 $(pwd) x=1 --verbose /usr/bin done "$@" printf export cd echo
+		/usr/bin x=1 cd 2>/dev/null
+--verbose test readonly
+echo grep then 'quoted text' awk
+	-eu ${HOME} && grep -eu "$@" "$@" -eu | ${HOME} local "$@" done
+readonly 2>/dev/null cd ${HOME} --verbose awk cd && echo "$1" printf then
+export printf awk then sed echo "$1" ${HOME} 2>/dev/null
+${HOME} grep 'quoted text' readonly readonly printf
+		local awk "$@" --verbose 2>/dev/null test echo "$1" export
+readonly --verbose 'quoted text'
+		printf sed -eu echo readonly $(pwd) "$1" 2>/dev/null
+		readonly echo grep readonly local
+'quoted text' echo ${HOME} cd awk "$@" test && /usr/bin --verbose
+	grep 'quoted text' test echo
+		then done && cd readonly --verbose "$@" -eu local x=1 x=1
+		-eu local /usr/bin "$1" 'quoted text'
+$(pwd) x=1 grep test "$1" readonly 2>/dev/null | /usr/bin readonly
+	export cd awk awk printf && 'quoted text' "$1" printf awk then sed
+| echo && /usr/bin cd local cd --verbose && export "$1" -eu readonly
+		-eu "$1" --verbose /usr/bin "$1" --verbose -eu
+		2>/dev/null awk test -eu && then local then readonly 'quoted text'
+	${HOME} 2>/dev/null test 2>/dev/null local cd test awk && "$1"
+	'quoted text' test "$@" 2>/dev/null printf
+		then done printf -eu sed "$1" awk then echo awk x=1 && then ${HOME} "$1"
+2>/dev/null 2>/dev/null ${HOME} readonly "$@"
+		"$1" "$1" cd 2>/dev/null 2>/dev/null sed awk export | 2>/dev/null
+$(pwd) ${HOME} test printf awk export test export grep readonly cd | $(pwd)
+		grep /usr/bin $(pwd)
+	x=1 export awk readonly
+awk -eu -eu | "$1" -eu readonly | "$@" echo test -eu 'quoted text'
+local done /usr/bin cd cd export $(pwd) 'quoted text' done readonly awk
+	2>/dev/null sed x=1 sed local /usr/bin
+awk /usr/bin x=1 2>/dev/null | /usr/bin 2>/dev/null /usr/bin grep /usr/bin
+	awk echo then | test -eu 'quoted text' $(pwd) -eu $(pwd)
+readonly local done grep 2>/dev/null
+	"$@" -eu echo sed awk export
+		test readonly --verbose --verbose
+	x=1 local done readonly 'quoted text' /usr/bin x=1 done readonly
+export grep awk then ${HOME} done "$@" echo | cd grep awk ${HOME}
+-eu done sed | printf "$@" grep local local sed local -eu test --verbose grep
+		2>/dev/null done -eu $(pwd) test cd --verbose
+	local test x=1 ${HOME} printf readonly -eu "$@" sed done echo $(pwd)
+		'quoted text' local -eu cd | "$@" printf /usr/bin cd grep cd /usr/bin
+	awk local && printf $(pwd) sed /usr/bin
+/usr/bin local && $(pwd) && 'quoted text' --verbose readonly | /usr/bin
+		grep "$@" grep | grep local echo 'quoted text' done
+done --verbose test grep grep local local cd x=1
+	echo echo 'quoted text' "$@" "$@" cd 2>/dev/null
+	| $(pwd) local export awk --verbose x=1 done readonly
+		readonly export readonly cd "$@"
+printf --verbose && local && grep x=1 awk
+printf 2>/dev/null printf -eu
+		test --verbose awk 'quoted text' cd 2>/dev/null 2>/dev/null
+		export grep ${HOME} echo /usr/bin && local local then ${HOME} $(pwd)
+	then cd printf export test 'quoted text' 'quoted text' local
+	/usr/bin grep ${HOME} export cd sed test
+"$1" -eu | echo local awk awk -eu 'quoted text' && 'quoted text' cd 2>/dev/null
+	$(pwd) && --verbose done sed "$1" test $(pwd) ${HOME} "$@" awk sed "$1"
+		cd /usr/bin then then test ${HOME} sed && -eu test /usr/bin grep "$@" local "$1"
+		grep then -eu 'quoted text' 2>/dev/null grep -eu sed ${HOME} "$1" grep 'quoted text'
+		2>/dev/null --verbose printf $(pwd) -eu readonly
+		done then then "$1" cd done awk 'quoted text' sed
+		sed then x=1 2>/dev/null then && "$1" printf sed && awk local /usr/bin
+	x=1 readonly export "$1" /usr/bin 'quoted text' "$@" /usr/bin
+	grep x=1 2>/dev/null ${HOME} export x=1 "$@" -eu awk awk
+	echo grep "$@" printf readonly echo echo ${HOME}
+&& then | export 'quoted text' export x=1 export done $(pwd) echo sed "$1" export
+		export | awk && x=1 --verbose "$1" printf export export $(pwd) $(pwd)
+readonly export printf | --verbose
+		2>/dev/null echo awk /usr/bin
+awk local /usr/bin "$1" x=1 | "$@" printf printf /usr/bin ${HOME} "$1"
+		local grep | 'quoted text'
+awk /usr/bin echo export
+	grep $(pwd) done export done awk "$@" awk cd x=1
+	-eu sed echo local "$1" -eu ${HOME} readonly
+		awk 2>/dev/null printf then /usr/bin local printf && x=1 /usr/bin
+${HOME} cd /usr/bin 'quoted text'
+		grep echo done 'quoted text' then | printf awk cd -eu readonly x=1 sed && 'quoted text'
+		local x=1 done done "$1" export /usr/bin
+		then x=1 cd "$@" readonly x=1 test 2>/dev/null grep printf 'quoted text' local local
+	done grep | export 2>/dev/null done
+test echo 'quoted text' local ${HOME} test "$1" && done ${HOME}
+		printf printf awk && test readonly printf
+&& ${HOME} | then | 'quoted text' grep awk readonly
+	$(pwd) cd "$@" test && done "$@" $(pwd) done ${HOME} $(pwd)
+cd 2>/dev/null sed printf test -eu readonly
+		awk $(pwd) awk ${HOME}
+		readonly ${HOME} /usr/bin ${HOME}
+$(pwd) printf /usr/bin export cd | readonly export cd -eu x=1 awk printf sed
+| "$1" | | 2>/dev/null "$@" && 'quoted text'
+	$(pwd) then cd grep cd grep export "$1" "$@" awk test
+test done -eu local then ${HOME} readonly local $(pwd) local
+		done export /usr/bin && cd
+		then && grep /usr/bin cd readonly
+"$@" awk ${HOME} done "$@" sed test readonly "$@" -eu
+done $(pwd) printf local echo | $(pwd) awk grep echo
+		local then 2>/dev/null "$@" done printf cd "$1"
+&& && --verbose $(pwd) && local
+export done -eu && | 'quoted text'
+--verbose -eu then cd printf
+		/usr/bin -eu grep "$1" echo readonly sed -eu x=1
+	test cd then | | then "$@" 'quoted text'
+		grep "$1" test 'quoted text' | cd local "$@" /usr/bin "$1"
+	awk "$1" "$1" /usr/bin /usr/bin done && | test
+		x=1 printf ${HOME} -eu /usr/bin sed readonly $(pwd) local
+	then "$1" then "$@" --verbose done /usr/bin | "$@" test && $(pwd)
+		/usr/bin export "$@" local printf done
+	'quoted text' "$1" "$1" /usr/bin printf /usr/bin then local grep x=1 grep done
+local test cd $(pwd) -eu && "$@" cd then ${HOME} /usr/bin
+		export | test /usr/bin printf ${HOME} done done &&
+sed sed 'quoted text' "$1" local "$1" awk local sed
+2>/dev/null /usr/bin then local $(pwd) ${HOME} printf
+	sed "$1" x=1 export test -eu ${HOME} grep readonly grep -eu | grep 2>/dev/null
+	printf --verbose -eu test x=1
+	-eu | --verbose -eu /usr/bin local sed then "$1" -eu
+-eu 2>/dev/null done "$1" local "$@" "$1"
+	${HOME} done test then 2>/dev/null 'quoted text'
+done /usr/bin done --verbose then /usr/bin /usr/bin $(pwd) "$1" /usr/bin
+	"$@" -eu | && | awk local echo -eu done
+	cd 'quoted text' "$@" && local
+	x=1 'quoted text' $(pwd) -eu 'quoted text' grep
+	"$@" cd "$@" ${HOME} readonly "$1" --verbose
+readonly && && "$1" 2>/dev/null --verbose sed test 'quoted text' /usr/bin then
+	readonly echo readonly /usr/bin done then grep local awk 'quoted text'
+printf 'quoted text' "$@" --verbose printf readonly 'quoted text'
+		$(pwd) 2>/dev/null | --verbose "$1" --verbose "$1" local x=1 -eu /usr/bin
+'quoted text' ${HOME} "$1" -eu --verbose grep 2>/dev/null
+grep readonly sed test ${HOME} test cd grep
+	${HOME} echo test then | then /usr/bin local sed
+echo "$1" "$@" printf
+	| "$@" 'quoted text' test "$@" x=1 awk export
+	"$1" /usr/bin printf /usr/bin
+	printf 'quoted text' -eu grep local -eu "$@" 2>/dev/null
+$(pwd) /usr/bin test local ${HOME} test
+	then grep grep 2>/dev/null --verbose /usr/bin
+		x=1 export --verbose "$1" --verbose && "$1" then 2>/dev/null -eu
+/usr/bin export grep export --verbose 2>/dev/null local
+		readonly && "$@" grep test readonly echo /usr/bin cd local
+$(pwd) "$@" then grep && --verbose -eu 'quoted text' then /usr/bin
+	2>/dev/null x=1 && cd -eu export "$@"
+		-eu 2>/dev/null $(pwd) /usr/bin then sed && sed printf
+		local grep test awk "$@" -eu "$@" awk export local grep $(pwd) "$1" done cd
+${HOME} && cd grep /usr/bin printf 2>/dev/null $(pwd)
+| && sed ${HOME} --verbose awk
+	export $(pwd) "$@" /usr/bin
+printf && sed "$@" /usr/bin "$@" printf test local && 2>/dev/null
+	&& test echo -eu readonly ${HOME} then $(pwd) x=1
+&& 2>/dev/null readonly ${HOME} ${HOME} local && x=1
+readonly readonly | echo grep | sed 'quoted text' | $(pwd) $(pwd) -eu
+--verbose sed $(pwd) printf ${HOME} 'quoted text' $(pwd) sed -eu grep printf
+		cd echo | 2>/dev/null --verbose export then grep
+		'quoted text' cd echo cd --verbose
+	| readonly grep local grep export -eu --verbose
+	export | awk /usr/bin sed cd test /usr/bin sed 2>/dev/null echo sed awk
+		"$1" | test "$@" local /usr/bin echo local printf sed printf
+		local "$@" awk readonly /usr/bin
+		$(pwd) $(pwd) export -eu -eu $(pwd) && ${HOME} test /usr/bin x=1
+	&& $(pwd) --verbose -eu printf "$1" 2>/dev/null x=1
+		done awk ${HOME} x=1 then x=1 printf grep then test local awk sed && test
+	readonly readonly echo test grep x=1 done then 'quoted text'
+x=1 "$@" grep -eu --verbose | export then "$1" --verbose
+	done 'quoted text' export awk | $(pwd) "$@" grep $(pwd) 2>/dev/null
+awk -eu readonly echo echo 2>/dev/null then --verbose cd
+		awk "$1" printf test grep
+export readonly readonly
+		local $(pwd) --verbose -eu local $(pwd) cd | readonly x=1 "$1" &&
+	cd "$1" 'quoted text' x=1 test awk $(pwd)
+		test export printf grep $(pwd)
+grep --verbose -eu ${HOME}
+	| && && cd readonly grep grep && export x=1 --verbose && $(pwd) 'quoted text'
+		grep "$1" printf done export export && x=1 local sed --verbose
+'quoted text' local "$@" done "$1" done
+x=1 then awk x=1 && $(pwd) x=1 | export grep printf export cd awk
+	$(pwd) local "$1" done $(pwd)
+--verbose "$1" then readonly then then readonly printf then x=1 then
+	"$@" export then echo sed
+/usr/bin && && --verbose echo cd "$@"
+		| ${HOME} cd readonly local cd ${HOME} 2>/dev/null test
+	'quoted text' local cd -eu done awk /usr/bin /usr/bin local
+		grep local sed export test
+	readonly && $(pwd) x=1 $(pwd) 'quoted text'
+x=1 -eu 'quoted text' "$@" 2>/dev/null printf
+sed /usr/bin x=1 readonly local echo cd
+	'quoted text' | 'quoted text' test
+then echo ${HOME} ${HOME} 2>/dev/null "$@" echo && 2>/dev/null echo | echo
+readonly && -eu 'quoted text' printf "$@" ${HOME} 'quoted text'
+	grep local sed /usr/bin done $(pwd) sed $(pwd)
+		awk done --verbose ${HOME} then echo done done
+	local -eu cd -eu "$1" readonly
+	cd "$@" awk echo test && /usr/bin | then ${HOME} 2>/dev/null local then "$@"
+		cd -eu grep -eu 'quoted text' x=1 awk --verbose local 2>/dev/null
+		done test -eu printf echo &&
+		cd x=1 x=1 awk /usr/bin $(pwd) done then cd grep /usr/bin cd export
+then cd grep sed echo done grep --verbose readonly cd x=1 printf grep
+		-eu then && grep ${HOME} done grep grep $(pwd) done
+		$(pwd) sed echo local x=1 x=1 "$1" sed 2>/dev/null $(pwd) echo -eu
+	readonly echo 2>/dev/null grep sed --verbose "$1" done
+		sed echo sed --verbose ${HOME} readonly sed /usr/bin
+	test done sed echo awk echo 'quoted text' x=1 && cd grep local test echo
+		| sed --verbose /usr/bin --verbose ${HOME} printf | x=1 echo
+		--verbose grep local sed ${HOME} readonly readonly cd done awk |
+export printf echo /usr/bin local then sed 'quoted text' "$@" sed
+/usr/bin 2>/dev/null x=1 test local awk then 2>/dev/null
+	sed local "$1" readonly | awk then grep x=1 done done -eu x=1
+&& 2>/dev/null then "$1" awk "$1" | awk /usr/bin
+$(pwd) then 'quoted text' x=1 ${HOME}
+	x=1 then && done 'quoted text' x=1 sed
+	test printf 2>/dev/null
+	export --verbose | "$1" "$1" then -eu "$@" --verbose then local readonly export
+		readonly cd echo cd printf 'quoted text' done printf && 2>/dev/null echo
+		done -eu awk "$1" /usr/bin /usr/bin awk 2>/dev/null
+	readonly && export /usr/bin sed echo
+	awk local ${HOME} done readonly sed readonly "$1" test done "$@" | |
+		$(pwd) printf grep && 2>/dev/null export
+	2>/dev/null "$@" $(pwd)
+	awk /usr/bin x=1 --verbose sed done &&
+		local readonly local echo
+--verbose -eu readonly export
+		&& awk 'quoted text' done && done test readonly
+	sed test cd local | "$@" then 2>/dev/null -eu test
+echo --verbose "$@" readonly sed "$1" awk
+	done | | readonly sed /usr/bin 2>/dev/null 2>/dev/null | readonly
+		printf awk done 'quoted text' readonly x=1 -eu "$1"
+		awk done --verbose /usr/bin /usr/bin
+		"$1" 2>/dev/null then -eu then $(pwd) awk test test readonly
+	&& -eu ${HOME} 'quoted text' test printf 'quoted text'
+	$(pwd) done /usr/bin export export /usr/bin then
+		awk echo awk cd "$1" 2>/dev/null /usr/bin
+&& 2>/dev/null echo done && x=1 export awk 'quoted text' 2>/dev/null readonly
+		x=1 'quoted text' then echo export && local x=1 awk x=1
+"$@" local local && /usr/bin printf awk sed /usr/bin
+	'quoted text' -eu --verbose printf grep && ${HOME} ${HOME} then && readonly &&
+test -eu done grep export | export x=1 export sed "$@" done "$@"
+	| | 'quoted text' local then ${HOME} ${HOME} printf 2>/dev/null
+	echo x=1 printf /usr/bin | awk $(pwd) -eu grep
+	grep sed export "$1" printf
+printf /usr/bin x=1 grep awk
+	| then cd awk readonly | grep /usr/bin x=1 $(pwd)
+		| ${HOME} x=1 /usr/bin /usr/bin readonly "$@" 2>/dev/null
+		readonly sed grep 2>/dev/null 'quoted text' then ${HOME} echo
+test then 'quoted text' done | done awk
+	"$1" -eu echo done echo /usr/bin grep cd && then | readonly
+	${HOME} awk test $(pwd) && && cd printf && 2>/dev/null
+	export local then readonly echo x=1 "$@" cd awk done /usr/bin done | cd
+2>/dev/null x=1 cd "$1" 'quoted text' done
+'quoted text' x=1 "$1" /usr/bin
+awk done 2>/dev/null local readonly "$1"
+then echo done $(pwd) 'quoted text' local
+		/usr/bin printf "$1" | done local 'quoted text'
+		test echo awk awk ${HOME} x=1
+"$@" test && done awk readonly test ${HOME} local --verbose
+		awk ${HOME} && ${HOME} | readonly test awk
+/usr/bin printf readonly "$@" readonly local -eu
+x=1 "$1" | echo then test
+	$(pwd) /usr/bin "$@" local -eu | sed 'quoted text' "$@" cd -eu $(pwd)
+done "$@" "$@" sed cd x=1 && done $(pwd) export grep ${HOME} export 'quoted text'
+		$(pwd) test -eu echo readonly | | "$1" | | test sed | done 'quoted text'
+		done && echo local "$@" x=1 && -eu export export
+/usr/bin test --verbose 2>/dev/null 'quoted text' | echo done
+		| sed printf $(pwd) done -eu local cd $(pwd) readonly grep done "$1" && | test
+	x=1 cd "$@" /usr/bin local && then done /usr/bin
+	sed sed | --verbose done $(pwd) echo --verbose x=1 grep -eu
+	echo "$@" sed x=1 ${HOME} local "$@" ${HOME} export
+${HOME} awk --verbose "$1"
+--verbose $(pwd) ${HOME} readonly grep export $(pwd) 2>/dev/null
+	$(pwd) /usr/bin awk test done local export
+	done "$@" "$@" printf | local 'quoted text' 'quoted text' grep printf
+	then 'quoted text' echo export && /usr/bin echo echo -eu "$1"
+2>/dev/null grep local 2>/dev/null grep grep done cd /usr/bin
+		cd printf /usr/bin /usr/bin -eu 'quoted text' export done then ${HOME} $(pwd)
+${HOME} ${HOME} awk --verbose test done -eu && -eu ${HOME} | ${HOME} sed "$@"
+local 2>/dev/null printf
+awk "$@" 'quoted text' -eu ${HOME} grep && then awk printf sed then
+		x=1 printf --verbose $(pwd) 2>/dev/null 'quoted text'
+printf 'quoted text' 2>/dev/null && 'quoted text' cd readonly
+		then $(pwd) awk "$@" &&
+	x=1 done -eu cd ${HOME} grep then test --verbose "$1" then then
+		/usr/bin echo /usr/bin $(pwd) ${HOME} printf export test echo test readonly
+	test cd echo "$1" test test /usr/bin grep then x=1
+	${HOME} --verbose --verbose echo awk done x=1 "$@" "$@" awk readonly readonly awk
+	echo "$@" test test test test -eu printf test then then
+	"$@" "$@" --verbose export | ${HOME} /usr/bin cd -eu awk export local test
+		-eu cd "$@" $(pwd) grep 2>/dev/null
+	echo -eu export test && local /usr/bin
+	&& export "$1" export x=1 local -eu printf --verbose echo
+	export sed awk x=1 echo
+	then grep export x=1 test $(pwd) -eu done $(pwd) readonly /usr/bin x=1
+test cd done 'quoted text' export $(pwd) echo
+		cd 'quoted text' done "$@" $(pwd)
+		&& "$1" then "$@" /usr/bin done cd done awk | && 2>/dev/null local readonly
+		$(pwd) cd printf "$1" awk --verbose awk "$1" $(pwd)
+	/usr/bin /usr/bin test $(pwd) 'quoted text' echo readonly 2>/dev/null
+/usr/bin grep $(pwd) then
+done then sed ${HOME} | grep | done -eu
+sed x=1 -eu ${HOME} readonly ${HOME} sed echo then awk local export /usr/bin
+	test 'quoted text' echo export "$@" | -eu &&
+${HOME} echo local grep then awk readonly x=1 echo
+	printf $(pwd) x=1 $(pwd) ${HOME}
+	/usr/bin 'quoted text' sed /usr/bin /usr/bin ${HOME} "$1" readonly "$@" "$1" test
+	echo 2>/dev/null ${HOME} readonly
+	export 'quoted text' -eu printf echo x=1 'quoted text' |
+	-eu readonly export /usr/bin 'quoted text' readonly "$@" 2>/dev/null | local
+	grep sed x=1 cd $(pwd)
+readonly /usr/bin done local ${HOME}
+		done echo /usr/bin test $(pwd) --verbose | $(pwd)
+		/usr/bin awk export cd done 'quoted text' readonly | x=1
+test sed --verbose then | "$1" then ${HOME} test then test 2>/dev/null
+	-eu | 2>/dev/null "$1" "$@" done "$@" done awk test /usr/bin
+	printf sed ${HOME} readonly 2>/dev/null
+test x=1 grep $(pwd) && awk /usr/bin cd $(pwd)
+	${HOME} 'quoted text' done $(pwd) /usr/bin $(pwd) x=1 --verbose 'quoted text'
+		echo test export /usr/bin test && 'quoted text'
+/usr/bin $(pwd) --verbose
+awk -eu && sed echo && test "$1" && test done local export
+'quoted text' -eu export x=1 test then 'quoted text'
+	test test ${HOME} sed echo | export ${HOME} printf "$@" $(pwd) /usr/bin done
+		printf "$@" then readonly readonly -eu echo $(pwd) --verbose --verbose |
+	-eu done printf | readonly x=1 $(pwd) awk && cd export ${HOME}
+	test local 'quoted text' export sed x=1 awk /usr/bin && "$1" awk
+	readonly $(pwd) 'quoted text'
+2>/dev/null /usr/bin done cd test test printf
+then $(pwd) test 2>/dev/null local "$@" done then
+		"$1" cd awk done ${HOME} /usr/bin
+export printf /usr/bin test done test export
+	readonly "$1" 'quoted text' printf $(pwd) && echo
+	export awk $(pwd) echo ${HOME} cd "$1" local cd "$1" echo
+"$@" printf sed "$1" "$@" cd $(pwd) cd
+		awk x=1 "$1" test --verbose readonly echo "$1" && printf readonly 'quoted text'
+"$1" x=1 echo && printf readonly "$1" sed local ${HOME}
+2>/dev/null cd done cd awk done
+awk 2>/dev/null export test 'quoted text' grep x=1 'quoted text' test
+	"$1" awk | $(pwd) "$@" then ${HOME} cd ${HOME}
+	/usr/bin grep done test done --verbose $(pwd)
+	&& awk local --verbose 'quoted text' -eu local then sed
+then cd | local ${HOME} done done
+	-eu --verbose awk "$1" --verbose &&
+	'quoted text' x=1 -eu then sed readonly
+&& sed "$@" test echo grep x=1 && "$@" grep test sed
+	then cd "$@" local done -eu grep test test awk then && 'quoted text' "$@"
+		| $(pwd) grep local readonly "$1" "$1" && printf echo done $(pwd)
+	-eu then readonly "$1" readonly --verbose
+then printf 2>/dev/null ${HOME} grep done then
+	done "$1" grep && -eu export
+echo ${HOME} cd "$1" --verbose awk readonly "$1" "$@"
+"$1" printf ${HOME} /usr/bin ${HOME} then 'quoted text'
+'quoted text' done sed
+sed export 'quoted text' 2>/dev/null --verbose then x=1 export
+		x=1 local ${HOME} awk --verbose awk readonly "$1" readonly 2>/dev/null "$1"
+		"$@" then cd cd /usr/bin test done
+		local ${HOME} sed x=1
+		${HOME} readonly done then export /usr/bin $(pwd) /usr/bin readonly 'quoted text'
+2>/dev/null && then echo test
+	printf test sed 'quoted text' readonly | -eu "$@" -eu then -eu -eu local test
+		printf $(pwd) done export test
+--verbose --verbose echo then sed sed echo
+		&& | export cd && | && 2>/dev/null $(pwd) test local | && echo readonly
+&& $(pwd) 'quoted text' ${HOME} | "$1" --verbose then
+		&& ${HOME} export "$1"
+		--verbose "$1" awk | printf then printf
+	printf /usr/bin printf ${HOME} local
+test cd cd echo "$@" 'quoted text' readonly
+2>/dev/null echo export ${HOME} echo grep -eu | -eu x=1 readonly &&
+	| ${HOME} 2>/dev/null echo echo export sed sed "$1" --verbose 'quoted text'
+		--verbose "$1" ${HOME} $(pwd) /usr/bin awk
+--verbose -eu export && /usr/bin then && export cd | 'quoted text' export | |
+/usr/bin ${HOME} /usr/bin grep "$@" grep $(pwd) -eu printf && test x=1
+		&& 2>/dev/null x=1 done "$1"
+	${HOME} --verbose 2>/dev/null x=1 x=1 && then 'quoted text' /usr/bin sed
+	"$@" --verbose && local readonly readonly 2>/dev/null
+		2>/dev/null 2>/dev/null "$1" echo x=1 grep readonly printf |
+$(pwd) --verbose && test done "$@" -eu sed readonly then cd 'quoted text' readonly
+	echo x=1 ${HOME} echo
+		| $(pwd) $(pwd) | && 2>/dev/null
+	echo 'quoted text' local export test $(pwd)
+$(pwd) local 'quoted text' | test 'quoted text'
+-eu /usr/bin awk export export local echo echo sed 'quoted text' export readonly
+		grep local test "$1" echo echo then cd && x=1 $(pwd) then sed
+		sed awk --verbose | -eu 2>/dev/null test export echo
+	local printf x=1 printf ${HOME} 2>/dev/null
+'quoted text' awk grep --verbose grep x=1 done x=1 "$1" x=1 readonly "$@" 2>/dev/null
+	2>/dev/null done then local 2>/dev/null readonly 2>/dev/null
+	done 2>/dev/null test $(pwd) /usr/bin /usr/bin --verbose
+"$@" "$1" | done readonly
+grep done && readonly "$1" | | ${HOME}
+echo local sed "$@" export local "$@" then test printf
+		'quoted text' then x=1 local /usr/bin 2>/dev/null "$1"
+local x=1 x=1 local cd 'quoted text'
+	readonly 'quoted text' export
+		&& 2>/dev/null grep | done x=1 | $(pwd) printf printf readonly grep local
+	grep awk /usr/bin 2>/dev/null 2>/dev/null local grep -eu cd awk echo echo export
+		-eu 2>/dev/null readonly -eu "$@" then $(pwd) 'quoted text' "$@" then --verbose
+${HOME} --verbose cd test sed | | cd done --verbose | sed
+	| local awk test echo cd "$@" | awk grep "$@" "$@" echo "$@" local
+		--verbose done then 'quoted text' "$1" test printf awk ${HOME}
+		x=1 && 2>/dev/null && 'quoted text' local | local awk x=1 sed awk ${HOME}
+then readonly 2>/dev/null && then | ${HOME} local printf
+	2>/dev/null echo test cd
+		grep readonly 'quoted text' /usr/bin x=1 echo
+		grep awk $(pwd) grep then awk
+	-eu "$1" done "$@" awk cd && printf printf $(pwd) awk "$1" local -eu 2>/dev/null
+		local ${HOME} /usr/bin ${HOME} done readonly
+		"$@" --verbose 'quoted text' export echo grep
+${HOME} local "$@" -eu /usr/bin /usr/bin -eu 2>/dev/null then local -eu
+		grep 2>/dev/null x=1 readonly /usr/bin /usr/bin local
+x=1 grep done echo /usr/bin /usr/bin
+'quoted text' && test -eu sed
+	printf "$1" printf | awk ${HOME} awk ${HOME} && export
+	local "$1" --verbose --verbose
+	&& ${HOME} 'quoted text' readonly
+awk local grep readonly awk $(pwd) x=1 cd 2>/dev/null ${HOME} local test done awk
+		then -eu -eu awk x=1 echo export 2>/dev/null sed awk -eu grep
+		cd --verbose readonly "$@" "$@" local
+&& printf sed && local echo
+	&& | sed test && 'quoted text' cd readonly && ${HOME} "$1" sed printf
+$(pwd) "$1" ${HOME} x=1 --verbose sed printf 'quoted text'
+awk then grep | ${HOME} --verbose sed
+-eu then sed | done 2>/dev/null | readonly $(pwd) local
+readonly "$@" | echo done then
+		"$@" awk readonly awk $(pwd) printf $(pwd) echo --verbose printf readonly
+	printf ${HOME} grep export sed awk export /usr/bin 'quoted text' sed
+test $(pwd) then done sed | -eu grep --verbose 2>/dev/null
+sed 'quoted text' cd "$1" && readonly
+	&& && done | local $(pwd)
+	test | readonly awk "$1" "$1"
+	--verbose /usr/bin awk test x=1 export test | then ${HOME} "$@" done 2>/dev/null
+	--verbose /usr/bin $(pwd) then -eu && | 'quoted text'
+test awk done local done x=1 "$1" readonly local "$@" "$1" then export grep
+"$@" echo /usr/bin x=1 'quoted text' local
+'quoted text' export export awk "$@" then && 'quoted text'
+"$@" local local local $(pwd) $(pwd) awk cd x=1 echo readonly test 'quoted text'
+$(pwd) /usr/bin x=1 "$1" readonly test $(pwd)
+$(pwd) cd /usr/bin -eu 'quoted text'
+	&& echo | then /usr/bin $(pwd) test local --verbose
+2>/dev/null cd ${HOME} test && /usr/bin | ${HOME} --verbose
+awk awk /usr/bin grep /usr/bin readonly x=1 readonly 2>/dev/null x=1 --verbose
+	/usr/bin 'quoted text' awk awk export test sed x=1 test cd $(pwd) ${HOME}
+		awk "$@" /usr/bin --verbose grep /usr/bin "$1"
+'quoted text' printf x=1 test && test $(pwd) && "$1" | --verbose awk | local
+-eu /usr/bin test ${HOME} x=1 then
+		&& "$1" ${HOME} echo done readonly readonly
+-eu /usr/bin 2>/dev/null done awk -eu "$1" /usr/bin
+		'quoted text' echo grep export done -eu test echo ${HOME} cd done awk && "$1" local
+		$(pwd) awk readonly local x=1
+export awk /usr/bin cd awk export "$@" | local then echo readonly ${HOME}
+x=1 export done then ${HOME}
+		$(pwd) -eu -eu "$@" -eu
+		printf && sed "$1" 'quoted text' && ${HOME} readonly && $(pwd) readonly readonly
+	'quoted text' local done done awk echo then readonly -eu
+	${HOME} cd -eu export export
+	x=1 'quoted text' $(pwd) "$@" | awk readonly then /usr/bin test && sed 'quoted text'
+	grep local cd grep $(pwd) -eu ${HOME} cd local --verbose readonly
+		2>/dev/null printf x=1 test --verbose printf /usr/bin $(pwd) "$@"
+		awk ${HOME} cd printf | --verbose $(pwd) readonly cd
+	| | && sed --verbose /usr/bin -eu -eu /usr/bin --verbose ${HOME} local 2>/dev/null
+local --verbose local | ${HOME} printf cd export grep export
+test /usr/bin readonly test
+		${HOME} "$@" done done "$1" -eu | 'quoted text'
+		sed cd test /usr/bin x=1 done x=1 /usr/bin x=1 'quoted text'
+	| -eu printf sed done 2>/dev/null
+		&& --verbose $(pwd) "$1" test && "$1" export 2>/dev/null local local then &&
+$(pwd) then sed /usr/bin $(pwd) x=1 export &&
+	printf "$1" local "$@" local grep 2>/dev/null export printf 'quoted text'
+	test cd | local /usr/bin ${HOME}
+"$@" cd "$1" awk $(pwd) local grep | /usr/bin then 2>/dev/null
+	--verbose then export 2>/dev/null printf
+'quoted text' local | --verbose grep
+	/usr/bin grep sed awk --verbose
+	2>/dev/null -eu 2>/dev/null | cd 'quoted text' sed 'quoted text'
+		$(pwd) echo 'quoted text' 2>/dev/null then 2>/dev/null printf
+		printf local local awk cd -eu x=1 ${HOME} test awk then readonly echo
+	/usr/bin test readonly --verbose readonly sed done 2>/dev/null ${HOME} sed
+	test done echo sed grep "$@" awk local "$1" $(pwd) && ${HOME}
+sed 'quoted text' $(pwd) $(pwd) | /usr/bin awk grep 'quoted text' then printf
+	2>/dev/null cd "$1" 2>/dev/null ${HOME} 2>/dev/null
+		done printf -eu echo printf && readonly local
+	readonly printf 2>/dev/null awk cd test 'quoted text' x=1 then export
+"$@" then printf cd grep $(pwd) 2>/dev/null ${HOME}
+	x=1 2>/dev/null then echo done echo done export awk /usr/bin local
+${HOME} done readonly done local /usr/bin grep export "$1" printf x=1
+		"$@" --verbose | test local /usr/bin
+		awk awk export | export done printf /usr/bin "$1"
+		then -eu printf 2>/dev/null local
+		'quoted text' -eu && readonly && test x=1
+		'quoted text' test readonly readonly "$1" then sed test cd
+$(pwd) 'quoted text' &&
+	| /usr/bin sed --verbose ${HOME} awk test test | &&
+		readonly --verbose readonly
+2>/dev/null done "$1" then export done grep --verbose local
+	export -eu readonly && x=1 echo readonly --verbose ${HOME} 2>/dev/null export
+		readonly "$1" 'quoted text' grep local grep 2>/dev/null printf echo |
+local cd awk x=1 $(pwd)
+	--verbose then 2>/dev/null $(pwd) local | cd && | 'quoted text' done 'quoted text'
+	printf done "$1" "$@" sed grep 2>/dev/null | sed x=1 grep "$1" printf printf echo
+		local grep grep echo ${HOME}
+	test echo x=1 | done grep --verbose 'quoted text' readonly
+	x=1 && then cd done printf --verbose export test | "$1" sed ${HOME}
+sed awk then cd /usr/bin -eu /usr/bin
+		x=1 test "$@" x=1 test | cd | export "$@" x=1 'quoted text'
+		sed test sed 2>/dev/null 'quoted text' -eu printf x=1 grep 2>/dev/null
+	&& 'quoted text' printf $(pwd) test && awk 'quoted text' 2>/dev/null
+	&& 2>/dev/null export "$1" then 2>/dev/null 'quoted text'
+		--verbose ${HOME} --verbose
+x=1 then /usr/bin test test && sed grep
+		local x=1 'quoted text' "$1" $(pwd) $(pwd) --verbose cd $(pwd)
+then sed x=1 test 2>/dev/null 2>/dev/null && && /usr/bin $(pwd) local awk
+		readonly && "$@" awk local cd then then then
+test | export echo then && echo
+	x=1 'quoted text' export 2>/dev/null | -eu ${HOME}
+${HOME} grep "$1" && --verbose $(pwd)
+	export | "$1" /usr/bin grep local
+	printf printf grep done then awk ${HOME} readonly readonly "$1"
+	local sed 'quoted text' $(pwd)
+	cd $(pwd) readonly readonly awk | /usr/bin
+		'quoted text' sed echo test 'quoted text' | export
+		awk 2>/dev/null "$1" $(pwd) 2>/dev/null echo awk done $(pwd) sed echo
+echo local "$@" readonly -eu 2>/dev/null "$1" sed -eu sed
+		test done | test /usr/bin /usr/bin echo printf grep cd
+		local readonly then ${HOME} echo done && grep export | ${HOME} done
+/usr/bin 'quoted text' ${HOME} export local readonly sed ${HOME} grep export
+	"$1" 'quoted text' printf 2>/dev/null
+	awk --verbose echo echo 'quoted text'
+2>/dev/null awk ${HOME} echo "$@" --verbose echo echo
+echo sed x=1 printf done export export done readonly
+		2>/dev/null /usr/bin awk echo -eu x=1 'quoted text' -eu
+		"$@" awk 'quoted text' echo local cd | sed "$@" export cd
+x=1 "$@" done --verbose readonly sed done -eu then "$@"
+		readonly 2>/dev/null test export
+--verbose "$@" printf "$1" 2>/dev/null
+	"$1" cd cd && grep /usr/bin export awk 2>/dev/null | local
+x=1 "$@" ${HOME} /usr/bin 2>/dev/null local
+	x=1 "$@" sed cd then test ${HOME} 'quoted text' done 'quoted text' x=1
+	printf && echo local done awk && cd -eu grep 2>/dev/null local sed awk printf
+"$@" local awk grep $(pwd) awk "$@"
+readonly 'quoted text' | ${HOME} awk "$1" "$1" echo "$1" export local test
+		cd "$1" awk -eu then export $(pwd) local --verbose sed awk awk 'quoted text'
+	'quoted text' | 'quoted text' 2>/dev/null 2>/dev/null export -eu 2>/dev/null readonly
+		printf ${HOME} 'quoted text' "$@" local export local echo && "$@" --verbose
+		export ${HOME} --verbose readonly ${HOME} local test export "$1" --verbose
+	test echo echo done | 'quoted text' $(pwd) x=1 2>/dev/null
+	'quoted text' "$1" && --verbose --verbose -eu local test /usr/bin
+	/usr/bin x=1 local --verbose x=1 test printf "$@" done done ${HOME}
+"$1" grep echo export readonly
+	${HOME} echo ${HOME} ${HOME} $(pwd) -eu -eu grep "$1" sed "$1" then sed then
+		echo echo local ${HOME} -eu export /usr/bin printf then
+		echo printf ${HOME} $(pwd) export
+	${HOME} test awk done 2>/dev/null
+	grep test ${HOME} 2>/dev/null | -eu cd export "$@" echo then test 2>/dev/null
+readonly done cd --verbose x=1 cd "$@" echo then grep ${HOME} ${HOME}
+		echo "$@" awk awk "$1" /usr/bin sed
+		local echo then | awk cd "$@" --verbose done
+	cd grep cd local 'quoted text' "$1" cd ${HOME} -eu $(pwd)
+	"$@" local -eu echo | local export sed
+printf | done echo done grep --verbose x=1 then
+"$1" --verbose -eu cd && ${HOME}
+	-eu test | readonly 'quoted text' test then | echo grep /usr/bin | x=1 sed
+		then done echo echo awk export
+		-eu x=1 'quoted text' $(pwd) "$@" done "$1" test $(pwd) awk ${HOME} --verbose
+	--verbose | "$1" $(pwd) done grep then ${HOME} readonly 'quoted text'
+local export done awk then sed 'quoted text'
+'quoted text' $(pwd) echo test cd readonly readonly ${HOME}
+	--verbose cd ${HOME} awk --verbose -eu && test printf 2>/dev/null "$1"
+	&& ${HOME} x=1 test x=1 x=1 && echo grep readonly 'quoted text' && export --verbose
+	"$1" grep $(pwd) && -eu && -eu ${HOME} $(pwd) printf | test grep
+	awk done echo 'quoted text' $(pwd) readonly cd --verbose printf readonly sed
+		"$@" /usr/bin x=1 "$1" awk && then
+		"$1" echo printf ${HOME} test --verbose readonly "$1" then grep ${HOME} sed
+		${HOME} "$@" && awk done grep
+		2>/dev/null test done grep
+		/usr/bin grep grep "$1"
+		/usr/bin then echo awk 2>/dev/null | echo echo echo
+		grep 'quoted text' awk then "$1"
+export -eu sed "$@" && 2>/dev/null awk
+$(pwd) $(pwd) cd export readonly done "$@" "$1" $(pwd) grep
+-eu 2>/dev/null ${HOME} -eu awk 'quoted text'
+"$@" | cd -eu local 2>/dev/null --verbose 2>/dev/null echo && cd --verbose
+		sed local 'quoted text' 'quoted text' $(pwd) -eu printf done then "$@" done
+done done readonly export "$@" readonly ${HOME} sed test 2>/dev/null then ${HOME}
+		test echo ${HOME} | grep x=1 cd | --verbose
+$(pwd) "$@" sed readonly cd "$1" --verbose done x=1 /usr/bin ${HOME}
+"$@" awk then grep -eu --verbose /usr/bin awk -eu test 2>/dev/null 2>/dev/null
+	done printf x=1 'quoted text' local test && /usr/bin
+	sed export /usr/bin done sed && 2>/dev/null "$1" "$@" && 2>/dev/null
+		$(pwd) /usr/bin x=1 sed --verbose -eu
+	echo x=1 cd "$@" $(pwd) | grep then 'quoted text'
+	x=1 && then grep local echo
+x=1 && --verbose -eu export
+		done grep awk test printf local
+sed echo "$1" done | local readonly printf done grep 'quoted text'
+		"$1" awk | -eu && readonly local 'quoted text' echo
+	sed export 'quoted text' x=1 | 'quoted text' /usr/bin |
+		awk echo | ${HOME} sed cd export 'quoted text'
+	--verbose export grep -eu sed 2>/dev/null cd --verbose echo 'quoted text'
+grep "$1" x=1 "$1" done test done export -eu done grep
+		readonly cd $(pwd) local /usr/bin sed echo | echo test grep /usr/bin /usr/bin
+		local && then x=1 x=1 readonly readonly x=1 echo then 2>/dev/null
+"$1" "$1" "$1" cd "$1" then grep -eu export
+grep ${HOME} "$@" /usr/bin 2>/dev/null then awk
+	${HOME} echo done 2>/dev/null ${HOME} 'quoted text' awk readonly
+	&& "$@" export cd local grep /usr/bin
+awk cd grep echo printf && readonly printf "$@" "$1" printf
+		done | sed export local --verbose
+/usr/bin x=1 cd export ${HOME}
+	local /usr/bin /usr/bin printf cd local sed $(pwd)
+done readonly -eu | 'quoted text' cd awk "$@" sed "$1" cd "$@" "$1" then /usr/bin
+2>/dev/null "$1" "$@" cd cd 2>/dev/null ${HOME} "$@" printf
+		${HOME} sed /usr/bin sed -eu local /usr/bin
+	then cd local test sed
+printf cd printf "$@" export export 2>/dev/null
+	--verbose test export grep /usr/bin x=1 export x=1
+	'quoted text' x=1 cd /usr/bin
+echo x=1 x=1 cd 2>/dev/null
+		export cd awk 'quoted text'
+	local && x=1 ${HOME} export cd cd && then awk
+local cd sed sed -eu readonly grep awk readonly -eu $(pwd)
+	cd cd --verbose then local && -eu --verbose test
+	/usr/bin -eu then export echo x=1
+	"$1" grep "$1" -eu /usr/bin grep "$@"
+then --verbose 'quoted text' export | export printf ${HOME} sed "$@" | "$1" && cd
+readonly && cd "$@" /usr/bin --verbose
+	${HOME} awk then 2>/dev/null done grep "$@" echo local local export printf
+	printf sed awk test /usr/bin done
+cd local awk sed cd test
+		/usr/bin x=1 $(pwd) export &&
+		| && local "$@" "$1" readonly /usr/bin export /usr/bin --verbose /usr/bin
+		then /usr/bin sed && && local 2>/dev/null cd
+	'quoted text' "$1" then printf "$@" done test "$@" grep local "$@" export readonly
+&& export done $(pwd) --verbose "$1" grep -eu then readonly x=1 2>/dev/null
+| echo x=1 echo awk 'quoted text'
+2>/dev/null ${HOME} printf 'quoted text'
+		-eu 'quoted text' echo && echo 2>/dev/null $(pwd) --verbose 2>/dev/null
+		/usr/bin printf printf /usr/bin "$1" then && && | readonly
+	'quoted text' local -eu readonly awk local
+		readonly grep cd $(pwd) readonly -eu readonly printf && "$@"
+	export sed "$1" done ${HOME}
+	&& grep 'quoted text' echo ${HOME} then $(pwd) --verbose
+	local test 'quoted text' readonly local done
+		"$@" 'quoted text' export 2>/dev/null -eu $(pwd) printf echo test readonly
+		${HOME} "$1" then test -eu local readonly test "$1" "$1" echo 2>/dev/null sed readonly
+		test "$@" $(pwd) "$@" local ${HOME} ${HOME} --verbose
+	"$1" | ${HOME} -eu test $(pwd) then /usr/bin awk export 'quoted text'
+	test -eu -eu awk done x=1 export --verbose 'quoted text'
+test grep 2>/dev/null then local && echo then local | $(pwd) sed -eu $(pwd)
+export --verbose export /usr/bin echo /usr/bin
+	-eu "$1" ${HOME} then ${HOME} /usr/bin --verbose readonly | &&
+-eu && "$@" cd 'quoted text' -eu done printf
+		-eu export $(pwd) cd test && local && -eu done grep ${HOME}
+		export $(pwd) $(pwd) --verbose -eu done readonly | grep /usr/bin x=1 x=1 2>/dev/null
+		$(pwd) cd --verbose export --verbose export
+		$(pwd) $(pwd) $(pwd) -eu x=1 $(pwd) && --verbose ${HOME} local
+		"$@" local then "$1" cd cd grep | --verbose printf cd sed 2>/dev/null export |
+printf && export awk export "$@" local -eu sed cd && local /usr/bin
+		test "$@" 2>/dev/null 2>/dev/null printf done "$@" local /usr/bin
+"$@" /usr/bin && cd local ${HOME} test "$@" "$@" grep && 2>/dev/null
+/usr/bin 2>/dev/null -eu cd test printf --verbose ${HOME} x=1 $(pwd) ${HOME}
+		"$1" 2>/dev/null $(pwd) 'quoted text'
+	| 2>/dev/null /usr/bin "$@" ${HOME} test
+	echo /usr/bin x=1 "$@" ${HOME} local 2>/dev/null $(pwd)
+		local $(pwd) printf echo awk export /usr/bin ${HOME} sed 'quoted text'
+		export local "$@" "$1" readonly
+	test awk ${HOME} /usr/bin $(pwd) "$1" then readonly
+		-eu -eu /usr/bin ${HOME} export
+		| $(pwd) x=1 "$1" /usr/bin grep 'quoted text' done awk $(pwd)
+	test then sed awk 2>/dev/null "$@" | -eu
+cd local --verbose /usr/bin x=1
+		sed then printf sed printf --verbose test 'quoted text' test readonly &&
+		awk test ${HOME} done test /usr/bin export
+		test done awk echo readonly 2>/dev/null 'quoted text' -eu cd cd "$1" 'quoted text'
+test export 2>/dev/null awk readonly && --verbose 'quoted text' readonly
+grep "$@" local -eu local
+"$1" && sed sed cd sed awk test x=1 "$1" && "$@" -eu readonly local grep && "$1"
+		'quoted text' -eu /usr/bin --verbose | && readonly 'quoted text' && readonly
+	"$1" local /usr/bin sed grep grep export $(pwd) "$@" 2>/dev/null export
+		/usr/bin echo --verbose readonly test cd export cd sed grep
+grep export printf sed export printf readonly 2>/dev/null
+sed /usr/bin x=1 'quoted text' 'quoted text' x=1 export grep --verbose printf
+	sed readonly echo && then echo "$@" readonly 'quoted text' "$@" 2>/dev/null
+$(pwd) --verbose $(pwd) ${HOME} | $(pwd) then test
+	cd -eu -eu "$@" ${HOME} $(pwd)
+	export then sed grep export awk -eu echo echo -eu
+	export local && $(pwd)
+	echo --verbose then test $(pwd)
+		export export 'quoted text' "$@" -eu
+	&& "$@" awk export $(pwd) local export "$1" 2>/dev/null
+		done printf done "$1" awk done then "$1" awk echo ${HOME}
+	awk awk readonly test ${HOME} "$1" awk "$1" echo && local test local "$1" readonly
+echo --verbose awk && readonly "$@" then x=1 'quoted text'
+	sed /usr/bin 'quoted text' /usr/bin
+	2>/dev/null 2>/dev/null echo test grep awk
+	"$1" done && && done done /usr/bin sed cd -eu
+	readonly readonly 'quoted text' printf echo | printf
+	"$@" done $(pwd) sed --verbose
+	'quoted text' $(pwd) then sed /usr/bin "$1" readonly
+	local x=1 /usr/bin sed printf | ${HOME}
+		'quoted text' x=1 'quoted text' |
+		grep "$@" export printf printf
+awk test echo 2>/dev/null 2>/dev/null test export
+	-eu "$1" sed printf readonly cd $(pwd) awk then sed local 'quoted text'
+$(pwd) 'quoted text' /usr/bin 2>/dev/null local test then "$@" sed cd sed | 'quoted text'
+	--verbose 2>/dev/null 2>/dev/null readonly
+readonly --verbose test -eu readonly /usr/bin
+		echo ${HOME} grep echo cd local test echo x=1 test
+2>/dev/null | && cd done $(pwd)
+	${HOME} $(pwd) done local $(pwd) | x=1 2>/dev/null "$1"
+	/usr/bin $(pwd) $(pwd) /usr/bin echo done grep local && x=1
+	printf 'quoted text' ${HOME} test ${HOME} "$@" then
+		cd --verbose printf --verbose
+readonly && readonly | /usr/bin && && 2>/dev/null cd test awk echo
+		export test cd then x=1
+/usr/bin -eu readonly x=1 then ${HOME} | done 2>/dev/null x=1 $(pwd) export
+"$@" "$@" "$@" cd -eu grep test readonly
+	echo /usr/bin && ${HOME} export /usr/bin local test readonly cd grep
+		readonly readonly sed grep $(pwd) done echo && export
+$(pwd) "$1" grep "$@" | 'quoted text' awk test sed x=1 local
+awk "$@" echo printf --verbose cd -eu printf awk readonly
+		| "$1" $(pwd) && echo done grep ${HOME} 2>/dev/null /usr/bin
+	export "$@" | x=1 "$@" test --verbose
+		2>/dev/null readonly printf then test printf readonly
+	local export grep /usr/bin 2>/dev/null sed ${HOME}
+	"$@" test awk cd -eu && 2>/dev/null readonly export awk /usr/bin
+done "$1" "$1" cd grep printf local printf --verbose x=1 printf cd x=1 | x=1
+	cd "$1" | -eu -eu "$1" -eu "$1" && echo sed -eu test sed 'quoted text'
+	then /usr/bin x=1 x=1 grep ${HOME} | echo echo
+'quoted text' -eu export grep export awk 2>/dev/null | printf local grep | |
+| "$@" export grep x=1 'quoted text' awk ${HOME} "$1" local
+	local sed "$1" export readonly "$@" done --verbose | then
+		-eu ${HOME} cd --verbose test
+		test && x=1 cd -eu /usr/bin | test && "$1" echo readonly readonly
+		local awk cd -eu && sed test export 2>/dev/null export done local | done sed
+	$(pwd) local grep done ${HOME} && x=1 "$@" $(pwd) readonly ${HOME}
+		test "$@" /usr/bin | done export && test test echo | "$1" --verbose x=1
+--verbose -eu cd -eu 'quoted text' echo echo --verbose
+	cd ${HOME} "$@" /usr/bin then awk cd x=1
+		x=1 'quoted text' test local 'quoted text' --verbose awk /usr/bin
+	-eu test | /usr/bin x=1 && cd x=1 then sed export "$1"
+readonly "$1" 2>/dev/null && ${HOME}
+	'quoted text' grep readonly awk printf 2>/dev/null
+echo ${HOME} export "$@" done echo
+	cd && && echo printf | local
+	sed /usr/bin "$@" local -eu sed "$1" cd ${HOME} x=1 grep $(pwd) /usr/bin local
+		test sed cd $(pwd) test readonly | test then
+		/usr/bin && grep test readonly grep --verbose "$@" "$1" local export cd cd
+		${HOME} | cd awk -eu "$1" then $(pwd) "$@"
+	grep done done -eu -eu ${HOME} cd
+		&& ${HOME} 'quoted text' export && readonly then export readonly echo
+		-eu test | local /usr/bin
+	&& x=1 grep "$1" echo $(pwd) cd grep echo export
+	$(pwd) | readonly sed 2>/dev/null -eu "$@" "$1" -eu "$1" awk readonly grep
+	printf $(pwd) x=1 | ${HOME} cd export 'quoted text'
+	local export sed local 2>/dev/null "$@" printf
+/usr/bin echo ${HOME} printf done /usr/bin | "$1" done "$1" readonly
+done /usr/bin | readonly -eu cd awk -eu -eu readonly "$@" grep 2>/dev/null
+	/usr/bin $(pwd) export then /usr/bin | | && x=1
+	awk $(pwd) ${HOME} /usr/bin printf readonly done test -eu then 2>/dev/null sed
+	"$1" cd "$1" sed $(pwd) echo ${HOME} test "$@" "$@" && printf $(pwd)
+test sed done awk -eu "$@" printf $(pwd) awk readonly /usr/bin awk
+readonly /usr/bin -eu && "$1" grep --verbose && cd | | "$@" x=1 && done
+"$@" sed | sed echo grep /usr/bin local $(pwd) -eu readonly
+	echo --verbose sed 'quoted text' cd
+'quoted text' ${HOME} sed
+		cd --verbose $(pwd) 2>/dev/null local printf export echo done grep cd
+export sed echo $(pwd) test local
+/usr/bin awk 'quoted text' --verbose cd local $(pwd) ${HOME} "$1"
+$(pwd) awk "$1" && x=1 $(pwd) $(pwd) sed test grep "$@" -eu grep then test ${HOME}
+readonly 'quoted text' test 2>/dev/null test local "$@" export x=1 local "$@"
+	-eu 2>/dev/null 'quoted text' then "$@" test test 2>/dev/null -eu grep
+		printf grep && test "$1"
+| x=1 export | local 'quoted text'
+		grep ${HOME} echo "$@" 'quoted text' "$1"
+awk awk -eu cd grep --verbose test $(pwd) ${HOME} printf echo
+	x=1 /usr/bin && 2>/dev/null 'quoted text' then
+		'quoted text' | -eu $(pwd)
+	sed --verbose test then grep local -eu readonly local printf $(pwd)
+	local -eu grep /usr/bin 'quoted text'
+		x=1 x=1 test --verbose ${HOME} done
+		then /usr/bin $(pwd) sed then
+$(pwd) export "$1" x=1 x=1 2>/dev/null
+	/usr/bin x=1 2>/dev/null local "$1" echo export done
+then echo ${HOME} "$@" "$@" cd test
+	2>/dev/null "$@" -eu then
+echo ${HOME} && awk "$1" grep grep
+		test 'quoted text' then sed then -eu
+"$@" | "$@" cd -eu test echo awk grep printf cd sed grep 'quoted text'
+		"$@" then 'quoted text' export $(pwd) printf 2>/dev/null
+grep printf | then local sed && readonly
+	local readonly awk awk sed then ${HOME} done awk | sed sed --verbose
+	export done -eu ${HOME} sed test --verbose then "$1" 'quoted text' -eu awk local
+		export sed printf ${HOME} x=1 cd done -eu awk &&
+		"$@" export echo grep "$@" $(pwd) | $(pwd) -eu ${HOME} | 2>/dev/null
+	then done /usr/bin x=1 printf "$1"
+$(pwd) readonly $(pwd)
+	"$@" sed $(pwd) cd | $(pwd) | -eu
+		2>/dev/null $(pwd) export local | cd "$@" 'quoted text'
+	local readonly /usr/bin echo
+	/usr/bin printf local --verbose -eu $(pwd) x=1 local cd x=1
+test -eu sed && echo $(pwd) 'quoted text' --verbose $(pwd) && grep 'quoted text'
+$(pwd) "$1" "$@" local | local | x=1 echo
+		'quoted text' local printf local /usr/bin /usr/bin "$@" "$1" "$1" printf
+	awk x=1 export ${HOME} sed
+awk test sed test echo done cd readonly then then "$1" cd printf
+/usr/bin local then && test local ${HOME}
+readonly grep /usr/bin done "$1" x=1 echo 'quoted text' grep readonly
+/usr/bin ${HOME} cd local $(pwd) "$1"
+		--verbose --verbose /usr/bin
+	grep -eu 'quoted text' "$@" cd ${HOME}
+	-eu "$1" local ${HOME} echo
+		awk grep --verbose then then "$1" sed --verbose
+2>/dev/null cd cd export -eu
+		/usr/bin awk done "$@" export sed /usr/bin
+		x=1 "$1" --verbose --verbose
+		2>/dev/null "$@" | cd /usr/bin done x=1 "$@" "$1" 2>/dev/null local
+	"$@" /usr/bin cd export
+	done done awk ${HOME} test awk cd --verbose "$1" $(pwd) "$@" 2>/dev/null
+		grep cd ${HOME} && export sed done readonly then echo | --verbose
+grep /usr/bin ${HOME}
+printf -eu 2>/dev/null "$@" "$@" awk &&
+${HOME} grep x=1 done local readonly 'quoted text'
+		awk printf cd -eu echo x=1 then done export sed /usr/bin
+awk -eu -eu ${HOME} 'quoted text'
+	&& done echo cd "$1" 'quoted text' && printf echo awk ${HOME} "$1"
+		grep awk echo export grep "$@" printf --verbose && then done echo /usr/bin x=1
+		cd -eu 'quoted text' readonly "$@" -eu /usr/bin 2>/dev/null -eu x=1 awk
+		&& readonly done 2>/dev/null
+	printf -eu | test ${HOME} --verbose grep echo printf
+readonly then test --verbose done sed echo readonly sed
+		&& | grep cd grep && "$1" 'quoted text' 'quoted text' -eu
+done 2>/dev/null && cd local "$1" cd awk -eu grep 'quoted text'
+echo export /usr/bin x=1 2>/dev/null && echo 2>/dev/null 2>/dev/null
+		grep awk then then cd "$1" readonly sed grep 2>/dev/null /usr/bin /usr/bin x=1
+		"$1" awk "$@" 'quoted text' local test --verbose -eu 'quoted text'
+		&& echo local then grep --verbose
+2>/dev/null "$@" ${HOME} --verbose
+	x=1 $(pwd) cd | local 'quoted text' $(pwd) "$@" done sed $(pwd)
+	2>/dev/null cd test grep -eu
+| printf done | && /usr/bin local /usr/bin
+		echo -eu test printf 2>/dev/null
+local "$1" cd cd local &&
+		cd | then grep echo $(pwd)
+		export | echo $(pwd) grep echo sed
+	done sed readonly export /usr/bin echo /usr/bin
+"$1" 2>/dev/null printf 'quoted text' printf
+		local awk x=1 --verbose && /usr/bin
+"$@" "$1" --verbose echo 2>/dev/null
+&& "$1" -eu -eu local sed -eu then $(pwd) export printf
+	| printf echo && test
+		"$1" ${HOME} export 'quoted text' test test 2>/dev/null ${HOME} 2>/dev/null 'quoted text'
+x=1 -eu awk "$1" | -eu | /usr/bin grep /usr/bin sed $(pwd) awk done export | &&
+	-eu done sed then x=1 ${HOME} cd then x=1 'quoted text' /usr/bin "$@"
+		${HOME} grep && test x=1 echo && x=1
+echo cd "$@" ${HOME} printf local export ${HOME}
+	"$@" export done 2>/dev/null export grep /usr/bin sed -eu cd && grep echo /usr/bin
+	--verbose "$1" readonly printf 'quoted text' export
+"$@" && printf echo ${HOME} /usr/bin | "$1" -eu -eu 'quoted text' printf
+	awk 2>/dev/null done test done then printf awk test $(pwd)
+2>/dev/null test cd done echo local then grep done local done ${HOME}
+	test then "$@" "$@" --verbose && && "$@" local cd done
+export readonly then printf 'quoted text'
+		awk echo "$1" x=1 && echo "$1" x=1 done | 2>/dev/null awk -eu -eu x=1 then $(pwd)
+2>/dev/null local sed 'quoted text' printf test x=1 "$@" printf
+	test | $(pwd) ${HOME} sed grep readonly
+	-eu local local printf 2>/dev/null
+		echo echo -eu echo | -eu "$@" grep $(pwd) /usr/bin $(pwd) sed
+		--verbose test -eu export awk local grep local then -eu "$@" $(pwd) $(pwd)
+local -eu | 'quoted text' done $(pwd) -eu x=1 --verbose && /usr/bin
+	local echo ${HOME} --verbose
+| done sed --verbose | x=1 awk ${HOME} "$1" local awk && awk awk awk | readonly
+${HOME} /usr/bin grep 'quoted text' readonly export
+	cd /usr/bin done echo $(pwd) export awk done /usr/bin /usr/bin | awk done then
+awk export ${HOME} ${HOME} $(pwd) grep readonly test "$@" $(pwd) printf
+		$(pwd) "$1" local ${HOME} "$@" | 'quoted text'
+		then 2>/dev/null cd | sed
+readonly printf grep "$@" --verbose
+	sed -eu && "$1" /usr/bin ${HOME} 'quoted text' | --verbose export -eu
+2>/dev/null local readonly --verbose export
+'quoted text' ${HOME} 2>/dev/null printf |
+		'quoted text' done cd readonly
+export 2>/dev/null $(pwd) "$1" -eu readonly local
+--verbose sed | readonly done
+	echo 2>/dev/null export | awk "$1" ${HOME} /usr/bin printf
+	--verbose "$1" 'quoted text' x=1 readonly test readonly 2>/dev/null
+&& cd && x=1 "$1" x=1 && -eu x=1 "$1" cd $(pwd) --verbose readonly $(pwd)
+		echo "$@" sed test echo
+	sed --verbose printf ${HOME} x=1 grep test echo "$1" local local
+x=1 "$@" echo done ${HOME} x=1 export printf
+| done -eu && /usr/bin local "$1" | test -eu | $(pwd) "$1" awk local test -eu
+		echo "$@" echo $(pwd) | 'quoted text' grep "$@"
+	x=1 cd export printf then then done && "$1" readonly awk $(pwd)
+	echo then sed done local echo cd 2>/dev/null grep "$@" test | export
+		printf printf && export 'quoted text'
+"$@" 2>/dev/null local -eu export sed --verbose export export -eu $(pwd) 'quoted text'
+-eu grep test 'quoted text' $(pwd) test "$@" export "$@" echo
+/usr/bin "$1" x=1 printf test /usr/bin then test readonly "$@" then grep awk
+	readonly test "$@" "$1" local x=1 -eu done "$@" 'quoted text' | $(pwd) readonly
+		printf printf printf && "$1" 2>/dev/null ${HOME} cd x=1 /usr/bin
+	export && x=1 grep x=1 local done $(pwd)
+"$1" ${HOME} "$@" test 'quoted text' readonly done then /usr/bin
+		grep grep export "$1" export $(pwd) 2>/dev/null -eu && export
+done ${HOME} "$@" cd /usr/bin ${HOME} 'quoted text'
+		echo x=1 --verbose echo $(pwd) test test "$1"
+		-eu cd local "$1" "$@" 2>/dev/null ${HOME} grep grep
+		readonly $(pwd) --verbose awk 'quoted text'
+${HOME} echo /usr/bin x=1 'quoted text' test -eu
+$(pwd) "$1" readonly done readonly cd -eu readonly -eu export /usr/bin
+	&& sed -eu printf printf
+	${HOME} local readonly "$@"
+	| ${HOME} printf /usr/bin
+sed 'quoted text' "$1" printf 2>/dev/null
+		export printf | grep echo echo readonly --verbose local /usr/bin test local
+	/usr/bin -eu local --verbose "$1" done --verbose sed -eu cd done echo
+		'quoted text' -eu awk -eu awk cd --verbose && test /usr/bin $(pwd) grep
+		awk cd grep --verbose sed
+		--verbose "$@" | done && echo | sed export /usr/bin -eu cd sed then | local printf
+		| -eu -eu "$@" 2>/dev/null grep sed 'quoted text'
+		| awk awk "$@" "$1" test awk -eu awk $(pwd)
+	x=1 $(pwd) readonly "$1" x=1 printf printf
+		-eu $(pwd) readonly echo export local
+	then ${HOME} done x=1 printf echo
+	&& 2>/dev/null grep cd && 'quoted text' grep cd --verbose | grep "$1" && cd "$@"
+${HOME} 2>/dev/null 'quoted text' then | -eu done
+	&& done grep /usr/bin 'quoted text' grep ${HOME} grep /usr/bin echo
+		export --verbose --verbose echo ${HOME} ${HOME} echo echo | /usr/bin /usr/bin
+	$(pwd) 'quoted text' local 'quoted text' | "$@" "$1" -eu
+	&& 2>/dev/null --verbose "$@" grep | printf then sed
+		/usr/bin "$@" --verbose | test echo 2>/dev/null
+	sed "$@" local printf | 'quoted text' awk --verbose ${HOME}
+$(pwd) -eu 'quoted text' /usr/bin "$@" sed local ${HOME}
+		done ${HOME} | | test "$@"
+	2>/dev/null printf --verbose sed grep --verbose
+done 2>/dev/null --verbose x=1 awk done test /usr/bin
+awk local 'quoted text' 'quoted text' "$1"
+	awk awk sed sed /usr/bin ${HOME} ${HOME} x=1 --verbose cd ${HOME} printf
+x=1 -eu grep printf awk test | | 'quoted text' 2>/dev/null
+		local then cd test x=1 /usr/bin "$@" cd /usr/bin
+		sed readonly printf | $(pwd)
+	then && 2>/dev/null then local $(pwd) export echo --verbose test echo && |
+sed 'quoted text' then "$@"
+	cd "$@" -eu --verbose export echo cd done echo
+echo /usr/bin "$@" /usr/bin x=1 2>/dev/null
+	local cd local --verbose local cd x=1 then then && cd | ${HOME} done readonly
+	"$@" "$@" local "$@" "$1" && grep printf -eu export --verbose then 'quoted text'
+#include c18.sh
+		${HOME} && ${HOME} export readonly $(pwd)
+	$(pwd) readonly 2>/dev/null 2>/dev/null cd --verbose "$@" done cd awk /usr/bin
+	test readonly cd printf $(pwd)
+		printf --verbose grep local grep -eu test $(pwd) printf
+| readonly then export && readonly 2>/dev/null grep cd 2>/dev/null
+		export 2>/dev/null echo /usr/bin
+		export echo x=1 local readonly && "$1" sed --verbose cd "$1" awk then cd 'quoted text'
+		"$1" $(pwd) awk --verbose done printf readonly
+		'quoted text' grep export local ${HOME} /usr/bin "$@" -eu then awk printf &&
+	grep cd local | "$1" printf
+sed test cd /usr/bin 2>/dev/null 2>/dev/null
+		&& done x=1 local readonly done --verbose test && then $(pwd)
+x=1 ${HOME} /usr/bin /usr/bin cd printf grep export then done export cd -eu
+/usr/bin x=1 | then 2>/dev/null awk
+	-eu /usr/bin && ${HOME} --verbose -eu echo -eu
+		"$1" x=1 then -eu --verbose cd then -eu 2>/dev/null "$1" -eu
+local awk /usr/bin cd export
+	x=1 sed /usr/bin --verbose ${HOME} $(pwd) readonly readonly
+	2>/dev/null local 2>/dev/null 'quoted text'
+${HOME} then | "$1" -eu -eu ${HOME} x=1 done x=1 readonly test "$@" cd printf
+		done x=1 --verbose readonly 'quoted text'
+'quoted text' 'quoted text' printf 'quoted text' --verbose grep | -eu -eu awk
+	cd 2>/dev/null x=1 && done awk 'quoted text' local readonly && 2>/dev/null test
+	echo then 2>/dev/null x=1 $(pwd) export x=1 done cd
+$(pwd) cd "$@" local then cd cd "$@"
+	then then then readonly readonly "$@" cd grep export export grep grep "$@" ${HOME}
+		"$1" sed "$@" $(pwd) readonly
+	sed && export | | test "$1" export
+	sed grep 2>/dev/null cd test then "$@" $(pwd) cd /usr/bin done test ${HOME}
+${HOME} done export sed "$@" done "$@" test $(pwd) 2>/dev/null
+	"$1" "$1" x=1 test 'quoted text' test export
+"$@" cd printf export done readonly --verbose then test
+	2>/dev/null export | awk sed then awk "$1" /usr/bin cd cd printf test
+		sed 2>/dev/null printf | test -eu /usr/bin local export
+	'quoted text' test awk then
+-eu 'quoted text' cd cd
+		cd $(pwd) grep sed "$1" sed
+2>/dev/null ${HOME} | $(pwd) --verbose && 2>/dev/null
+	local && grep echo then sed $(pwd) -eu cd 2>/dev/null ${HOME} test
+	done | /usr/bin | "$1" "$1" then $(pwd) x=1 --verbose $(pwd) x=1 local && printf
+-eu | "$@" awk -eu ${HOME} done grep sed cd ${HOME} test | 2>/dev/null $(pwd)
+	| $(pwd) x=1 awk sed "$@" readonly
+		&& awk readonly $(pwd) readonly readonly readonly
+		$(pwd) local test -eu --verbose printf export $(pwd) && local
+		echo $(pwd) "$@" export grep "$1" export export $(pwd) -eu grep done awk && test
+	$(pwd) x=1 sed 2>/dev/null "$1" 2>/dev/null sed readonly $(pwd)
+	awk && readonly ${HOME} $(pwd) "$@" readonly 'quoted text'
+$(pwd) local then ${HOME} && printf readonly
+grep grep export --verbose x=1
+	awk test "$@" x=1 export 'quoted text'
+	2>/dev/null done && sed ${HOME} readonly local | local -eu
+local --verbose && | sed -eu |
+	2>/dev/null echo --verbose -eu export $(pwd)
+"$1" printf sed export local
+		grep ${HOME} local sed readonly
+		x=1 test x=1 | then $(pwd) "$@" sed test 2>/dev/null export ${HOME}
+		${HOME} local ${HOME} awk x=1 readonly awk /usr/bin then /usr/bin "$1"
+		printf 2>/dev/null /usr/bin test local --verbose done readonly | printf "$@"
+"$@" printf readonly /usr/bin then sed 2>/dev/null 'quoted text' echo echo
+	/usr/bin x=1 cd printf /usr/bin 2>/dev/null cd
+"$1" awk 2>/dev/null "$1"
+		printf -eu ${HOME} readonly export x=1 awk then
+		grep export --verbose -eu x=1 2>/dev/null readonly /usr/bin
+"$@" readonly -eu awk then readonly "$1"
+/usr/bin -eu 2>/dev/null cd sed export ${HOME} "$@" ${HOME} 2>/dev/null "$@"
+		/usr/bin done /usr/bin then sed |
+	"$1" awk x=1 local export
+done echo test --verbose awk sed ${HOME} grep
+	local export "$1" sed then echo 2>/dev/null
+		"$@" awk 'quoted text' test printf done printf $(pwd) /usr/bin grep
+	&& awk --verbose ${HOME} ${HOME} then "$1" | export test export sed "$1" | printf
+x=1 | local test "$1" && /usr/bin "$@" $(pwd) readonly -eu readonly cd
+$(pwd) $(pwd) export --verbose then awk sed readonly /usr/bin
+		${HOME} cd | /usr/bin $(pwd)
+	grep readonly test awk "$@" then done x=1 local
+		readonly local export --verbose /usr/bin x=1 awk grep printf cd awk test
+		echo local done -eu -eu $(pwd)
+done -eu | local then /usr/bin 2>/dev/null
+	test cd x=1 readonly $(pwd) echo | /usr/bin awk grep printf
+	echo grep | cd done && then 'quoted text' && then ${HOME}
+		&& awk readonly /usr/bin export "$@" awk $(pwd)
+	done export local && "$@" sed $(pwd) -eu awk -eu grep x=1 2>/dev/null export
+'quoted text' --verbose 'quoted text' sed readonly 2>/dev/null
+	'quoted text' local ${HOME} grep ${HOME}
+cd test 'quoted text'
+readonly awk echo sed readonly
+		$(pwd) --verbose $(pwd) then sed local
+x=1 awk export | /usr/bin cd --verbose | |
+"$1" $(pwd) printf 2>/dev/null readonly x=1
+	x=1 done "$@" -eu readonly sed 2>/dev/null /usr/bin
+printf && "$1" x=1 && awk done ${HOME}
+echo then x=1 awk x=1 echo then cd echo "$@" --verbose cd "$1"
+		${HOME} x=1 cd done sed awk 'quoted text' local x=1 && 2>/dev/null awk
+		'quoted text' test "$1" /usr/bin done --verbose
+--verbose then $(pwd) then "$1" export test readonly sed ${HOME} done readonly
+	test "$1" then "$1" |
+		"$1" x=1 grep | x=1 "$@" then "$@" "$1" "$@" 'quoted text' readonly
+	printf awk grep "$@" awk printf x=1 grep readonly local awk
+		&& && readonly "$@" done $(pwd) then echo sed 'quoted text'
+test --verbose "$1" --verbose -eu local $(pwd) export awk readonly "$1" --verbose
+done readonly local 'quoted text' echo ${HOME}
+		--verbose printf test printf
+local && awk $(pwd) | readonly
+		"$1" local local local export /usr/bin
+		--verbose printf then sed sed "$@"
+		x=1 readonly && $(pwd) ${HOME}
+		grep test echo local printf export cd 'quoted text'
+	$(pwd) cd "$@" 2>/dev/null 'quoted text' -eu
+local "$1" cd "$1" echo test -eu sed "$@" echo cd --verbose ${HOME} ${HOME}
+| | 'quoted text' --verbose done
+export cd sed x=1 --verbose local export "$@" /usr/bin 'quoted text' awk
+		${HOME} then && export done local -eu -eu sed done sed
+	awk local awk test echo then "$1" export readonly -eu x=1 readonly
+	2>/dev/null && awk local echo 2>/dev/null awk done --verbose readonly
+		$(pwd) grep 'quoted text' | | | awk readonly readonly x=1 $(pwd) then done "$@"
+readonly test | cd done "$@" printf done
+		2>/dev/null awk grep --verbose
+$(pwd) --verbose --verbose "$@"
+export "$@" done /usr/bin && local x=1 printf readonly then -eu then grep echo
+	sed done -eu readonly --verbose
+		grep -eu awk echo $(pwd) test 2>/dev/null
+	--verbose "$1" cd -eu "$1" "$1" 2>/dev/null
+--verbose $(pwd) sed sed
+		echo ${HOME} | export && 2>/dev/null && -eu done "$1" 'quoted text' readonly
+		readonly --verbose "$@" && printf 2>/dev/null grep | sed $(pwd)
+	cd "$1" grep export $(pwd) /usr/bin
+		${HOME} --verbose done "$1" ${HOME} "$@" ${HOME} cd $(pwd) sed awk echo
+		printf $(pwd) ${HOME} "$1" awk && readonly grep done echo readonly
+&& --verbose x=1 --verbose
+	export "$@" cd x=1 /usr/bin -eu echo $(pwd) readonly printf
+	then local /usr/bin sed ${HOME} test "$1"
+		done x=1 printf --verbose 2>/dev/null export
+	${HOME} | x=1 /usr/bin x=1 printf awk awk && echo local --verbose
+	-eu grep /usr/bin $(pwd) $(pwd) 'quoted text' export -eu | grep printf echo
+		local 2>/dev/null export ${HOME} sed then readonly ${HOME} -eu /usr/bin
+		'quoted text' -eu --verbose test "$@" done test ${HOME}
+		| 2>/dev/null && echo "$1" 'quoted text' test echo export
+		&& done 'quoted text' local 2>/dev/null test sed /usr/bin "$@" export "$@"
+export echo x=1 --verbose x=1 sed 'quoted text' /usr/bin then
+	then awk 'quoted text' sed then && 2>/dev/null | echo
+		cd 2>/dev/null grep grep cd -eu ${HOME} awk test printf /usr/bin cd echo
+		2>/dev/null ${HOME} done 2>/dev/null
+	printf --verbose 2>/dev/null done done grep /usr/bin
+	done then && 2>/dev/null "$1" | sed printf readonly "$1" echo
+awk cd 'quoted text' then $(pwd)
+		"$1" && local -eu -eu local
+then && -eu grep "$1" -eu -eu
+	grep && export export export "$@" && 'quoted text'
+		grep test 2>/dev/null then test 2>/dev/null
+--verbose export ${HOME} /usr/bin 'quoted text' 2>/dev/null sed -eu local sed
+cd done 'quoted text' x=1 'quoted text' cd "$@" grep "$1"
+		awk 2>/dev/null -eu x=1 readonly
+	export readonly | $(pwd) printf
+${HOME} -eu cd grep local "$1" awk grep awk 2>/dev/null ${HOME} x=1 && && readonly
+	/usr/bin -eu --verbose done cd
+		"$1" /usr/bin then local && ${HOME} done readonly awk ${HOME} readonly
+		--verbose && /usr/bin test export printf "$@" done
+"$@" && grep awk 2>/dev/null then echo grep grep grep readonly
+'quoted text' -eu --verbose "$1" printf ${HOME} then echo test test |
+	2>/dev/null $(pwd) local awk grep echo
+	then export /usr/bin export echo printf && readonly /usr/bin
+local export readonly echo 'quoted text'
+	2>/dev/null grep then grep export done then printf $(pwd) done
+then "$1" printf && 2>/dev/null && echo
+$(pwd) x=1 local /usr/bin done && "$@"
+	| $(pwd) ${HOME} -eu echo && then local $(pwd) cd cd -eu $(pwd) 'quoted text' &&
+done done export grep awk cd export | /usr/bin readonly /usr/bin -eu
+then printf x=1 export
+| done cd readonly 'quoted text' grep
+		done | | echo --verbose grep cd
+		grep sed readonly x=1 local
+		/usr/bin $(pwd) | echo && printf readonly x=1 2>/dev/null
+		${HOME} local echo "$1"
+	sed readonly /usr/bin done 2>/dev/null -eu cd x=1
+	test test printf done /usr/bin awk /usr/bin local && echo
+	&& printf echo test -eu cd "$@" $(pwd) "$@" sed printf export "$@" x=1
+		printf done && echo export export
+done then $(pwd) export "$@" then
+	${HOME} /usr/bin -eu done printf
+sed 2>/dev/null export x=1 -eu /usr/bin 2>/dev/null done | awk && sed && then
+		cd && ${HOME} local --verbose sed "$1"
+		"$1" local echo "$@" -eu grep then && awk export
+		grep then /usr/bin && printf
+		${HOME} ${HOME} ${HOME} local readonly | sed echo && ${HOME}
+	echo "$1" readonly echo /usr/bin
+	&& -eu awk && --verbose awk --verbose && local awk $(pwd) echo "$@" test &&
+	sed export && done printf export done /usr/bin | readonly --verbose
+-eu local | awk && done "$1" 2>/dev/null
+	local --verbose $(pwd) "$1" local "$1" grep
+	${HOME} test -eu local done 2>/dev/null ${HOME} $(pwd)
+sed export $(pwd) -eu test &&
+echo grep ${HOME} $(pwd) "$1"
+echo 2>/dev/null readonly "$@" | readonly $(pwd) export
+		export export --verbose then 2>/dev/null
+	2>/dev/null /usr/bin grep awk test "$1" grep local
+cd test grep echo grep x=1 readonly -eu x=1
+	'quoted text' done grep /usr/bin x=1 "$1" awk
+grep readonly --verbose grep /usr/bin readonly sed | /usr/bin
+	-eu readonly export printf "$@" && && |
+echo x=1 $(pwd) sed cd /usr/bin 2>/dev/null
+		sed "$@" echo grep --verbose
+cd local local cd export -eu $(pwd) 2>/dev/null
+		done -eu && 2>/dev/null sed cd grep export --verbose $(pwd) | awk
+		'quoted text' test 2>/dev/null sed 2>/dev/null
+	export readonly --verbose | printf awk export cd 'quoted text'
+	&& done done done /usr/bin "$1" grep && --verbose grep $(pwd)
+grep export sed "$@" 'quoted text' /usr/bin 'quoted text' |
+sed x=1 echo | sed /usr/bin x=1 local
+	2>/dev/null "$@" printf export $(pwd) export
+	x=1 then && --verbose 2>/dev/null 2>/dev/null test printf "$@" printf
+		x=1 2>/dev/null && x=1 awk x=1 export ${HOME}
+	echo --verbose local $(pwd) sed readonly readonly sed
+readonly --verbose "$@" cd -eu /usr/bin readonly $(pwd)
+	readonly cd "$@" -eu printf then ${HOME} x=1 $(pwd) cd
+		grep test readonly printf "$@" $(pwd) --verbose test done x=1
+		then /usr/bin 2>/dev/null cd | /usr/bin "$@" printf sed echo "$@" -eu awk 2>/dev/null
+sed /usr/bin done | ${HOME} export
+		awk "$@" test echo --verbose $(pwd) grep local echo local /usr/bin $(pwd)
+	'quoted text' cd x=1 ${HOME} grep printf awk printf
+export grep readonly export && "$1" awk export printf readonly
+	cd sed 'quoted text' $(pwd) awk grep
+		/usr/bin /usr/bin && "$1" done cd sed then done printf
+test cd sed local then 'quoted text' $(pwd) grep awk
+	printf printf echo grep done
+cd printf local readonly
+sed then --verbose x=1 2>/dev/null | /usr/bin ${HOME}
+-eu local cd grep echo grep echo "$@" test ${HOME} && export "$1" readonly ${HOME}
+		test "$1" ${HOME} printf 2>/dev/null readonly export then test -eu
+		${HOME} /usr/bin $(pwd)
+${HOME} grep -eu $(pwd) then $(pwd) $(pwd) --verbose then then
+then printf 'quoted text'
+| awk 'quoted text' $(pwd) readonly
+test --verbose echo "$@" test "$@" export test test printf
+	x=1 --verbose then then readonly 'quoted text' export grep | /usr/bin
+&& sed "$@" "$@" 'quoted text' echo
+	grep 'quoted text' | readonly then 'quoted text'
+	-eu done /usr/bin then -eu --verbose echo test
+		$(pwd) | then export "$@" sed
+	/usr/bin | $(pwd) && cd "$@"
+	readonly local ${HOME} cd awk $(pwd) "$@" --verbose test
+		$(pwd) && printf done | $(pwd) awk echo --verbose && x=1 "$1" | | x=1 export
+printf "$@" -eu 'quoted text' "$@" done grep "$@" ${HOME}
+export "$@" awk test grep -eu sed then grep echo
+	grep grep sed $(pwd) grep local
+	/usr/bin awk && "$@" awk cd -eu -eu
+"$@" printf awk "$@" 2>/dev/null printf ${HOME} then 2>/dev/null export
+		"$@" test -eu export -eu grep echo $(pwd) test --verbose test 2>/dev/null
+		readonly test "$@" export 2>/dev/null printf done sed 2>/dev/null awk echo x=1
+cd local 'quoted text' 2>/dev/null sed /usr/bin 'quoted text'
+		&& cd grep && readonly test readonly "$@" grep sed test
+		&& "$1" $(pwd) echo && --verbose ${HOME} 'quoted text' sed printf |
+| --verbose echo -eu local sed /usr/bin "$1" test | local
+sed readonly -eu test sed
+&& then | awk local /usr/bin -eu done echo --verbose grep | 'quoted text'
+		"$@" "$1" "$@" ${HOME} -eu && awk "$@" cd -eu grep "$1" 'quoted text'
+	${HOME} 'quoted text' | printf readonly printf then readonly test then
+	cd "$1" sed -eu -eu "$@" done awk ${HOME} x=1 'quoted text'
+sed local && export 2>/dev/null done $(pwd) | test
+		sed 2>/dev/null awk done 'quoted text' done | | | test -eu done printf grep
+		then --verbose grep 2>/dev/null cd export done printf local /usr/bin "$1"
+-eu -eu 'quoted text' x=1 /usr/bin && /usr/bin test printf --verbose
+$(pwd) | done test "$1" then awk awk 'quoted text'
+		echo "$1" | "$@" "$@" && x=1 ${HOME} done done local test export
+	awk awk cd -eu awk test "$@" "$@" -eu export
+${HOME} echo export ${HOME} x=1 test export && echo awk local then then
+	--verbose 'quoted text'
+	x=1 printf && then done $(pwd) | -eu grep readonly
+| ${HOME} "$1" local test
+${HOME} printf awk done readonly local
+		then x=1 && ${HOME} "$1" 'quoted text' --verbose export printf
+	sed -eu x=1 /usr/bin | cd printf ${HOME} cd export awk $(pwd) "$@" awk
+	"$@" export /usr/bin x=1 echo --verbose grep "$@" grep
+"$1" test done sed awk done --verbose test done awk ${HOME} readonly
+	done readonly cd echo awk /usr/bin
+awk cd done "$@" test "$1" "$@" -eu "$@" | readonly awk "$@" done $(pwd)
+		2>/dev/null awk && printf printf
+awk 2>/dev/null /usr/bin awk grep
+	"$@" export x=1 awk /usr/bin readonly ${HOME}
+	/usr/bin printf ${HOME} echo echo | && echo
+2>/dev/null echo grep readonly test then --verbose --verbose
+	awk grep /usr/bin then local && /usr/bin then ${HOME}
+x=1 awk cd local /usr/bin 2>/dev/null ${HOME} "$1" local sed test
+		awk && 2>/dev/null echo "$@" local && "$@" --verbose
+		'quoted text' "$@" export /usr/bin test "$1" | ${HOME}
+done grep && && 'quoted text'
+		test $(pwd) sed /usr/bin sed printf ${HOME} ${HOME} then test
+printf local $(pwd) readonly 'quoted text' "$1" sed done export 'quoted text'
+		/usr/bin --verbose then
+	2>/dev/null test readonly cd then grep then
+awk "$1" 'quoted text' && echo 2>/dev/null
+	local printf ${HOME} then ${HOME} 'quoted text' --verbose export
+		"$@" then echo printf
+sed export local && sed
+		local sed done echo readonly test "$1" --verbose test && done echo
+readonly 2>/dev/null export done echo $(pwd) sed
+x=1 "$@" x=1 grep --verbose /usr/bin && 'quoted text' readonly test
+sed x=1 export then x=1
+	'quoted text' printf 2>/dev/null printf "$@" done --verbose done awk then cd |
+x=1 "$@" readonly grep cd printf ${HOME} sed printf
+done awk ${HOME} 2>/dev/null
+		| grep then printf "$@" echo && --verbose "$@" | echo --verbose
+	/usr/bin echo grep export echo sed awk -eu
+		sed -eu "$1" then "$@" ${HOME} then test done done echo test ${HOME}
+printf 2>/dev/null then grep
+&& ${HOME} awk echo then "$@" && /usr/bin x=1 && local ${HOME} awk 2>/dev/null
+	--verbose readonly echo cd
+sed local export /usr/bin 'quoted text' readonly ${HOME} 'quoted text'
+		sed -eu printf x=1 --verbose echo | readonly --verbose awk "$@" 'quoted text'
+awk "$@" printf 'quoted text' sed "$1"
+	local cd awk awk x=1 'quoted text' sed ${HOME} awk sed "$@"
+	-eu "$@" | done awk then ${HOME} sed printf | then --verbose echo export printf
+		printf && x=1 test readonly printf /usr/bin 2>/dev/null
+		awk grep $(pwd) 'quoted text' done local
+		export /usr/bin && -eu | readonly x=1 test done "$1" done test echo then
+		/usr/bin 'quoted text' "$@" printf x=1 --verbose | /usr/bin
+	&& cd printf "$@" done export done && sed && printf export grep then grep &&
+--verbose printf sed | /usr/bin 2>/dev/null done awk cd
+| grep ${HOME} done local printf cd --verbose -eu x=1
+		2>/dev/null && && grep && /usr/bin "$@" sed 2>/dev/null awk printf
+	"$1" done grep -eu echo
+"$@" | awk export awk awk ${HOME}
+		'quoted text' readonly ${HOME} grep grep done test test local --verbose "$@"
+2>/dev/null "$1" 'quoted text' export
+		sed /usr/bin /usr/bin x=1 x=1 ${HOME} ${HOME} x=1 local | export
+	x=1 | /usr/bin then | && awk export "$@" awk cd echo $(pwd) grep -eu
+	export test | readonly 2>/dev/null | readonly
+	export echo sed "$@" 2>/dev/null then -eu "$@"
+/usr/bin && 2>/dev/null 2>/dev/null ${HOME} grep sed test | done &&
+readonly $(pwd) echo test $(pwd) printf local && --verbose
+		"$1" then printf --verbose
+		"$1" $(pwd) $(pwd) sed done |
+x=1 "$1" echo echo cd | -eu cd x=1 'quoted text'
+"$@" | export "$1" readonly | local local
+	sed then sed && --verbose &&
+"$@" echo -eu $(pwd) 'quoted text' $(pwd) -eu "$1" x=1 cd --verbose sed $(pwd)
+	grep readonly | then export
+${HOME} "$@" sed local 'quoted text' then printf printf 'quoted text'
+done $(pwd) export readonly then echo export x=1 && && "$@" && ${HOME}
+'quoted text' done -eu
+		-eu then then local then awk "$@" x=1 printf | | awk awk printf | local
+	readonly 2>/dev/null sed local printf && "$1" /usr/bin sed && $(pwd) /usr/bin
+	&& printf awk test export grep 2>/dev/null x=1 sed sed x=1
+	test printf ${HOME} then done 2>/dev/null local -eu | --verbose
+		| x=1 | $(pwd) grep awk /usr/bin
+	'quoted text' -eu "$1" awk && then cd 2>/dev/null export
+		'quoted text' export ${HOME}
+		| 2>/dev/null local x=1 2>/dev/null echo | ${HOME} | sed | export $(pwd)
+		"$@" export sed test -eu $(pwd) awk test grep "$1" sed -eu x=1 then
+&& x=1 ${HOME} /usr/bin |
+readonly $(pwd) /usr/bin /usr/bin /usr/bin echo ${HOME}
+		done echo $(pwd) grep test printf echo printf echo printf then local
+		grep echo /usr/bin test ${HOME} /usr/bin export x=1 'quoted text'
+		${HOME} x=1 2>/dev/null $(pwd) --verbose test
+		echo --verbose ${HOME} "$@" "$1" done local echo cd grep | then done 2>/dev/null
+cd readonly grep $(pwd) "$@" sed sed && x=1 --verbose ${HOME} $(pwd)
+	| export grep /usr/bin 2>/dev/null cd /usr/bin | cd sed
+then readonly echo ${HOME}
+		then done 'quoted text' --verbose printf echo
+	/usr/bin done /usr/bin echo readonly
+		test then x=1 2>/dev/null $(pwd) cd | && | "$1" --verbose /usr/bin
+/usr/bin /usr/bin 2>/dev/null awk $(pwd) readonly export then "$1" echo awk
+	sed /usr/bin "$@" ${HOME} then x=1 ${HOME} && test printf readonly local "$@"
+		/usr/bin && done -eu "$@" && then
+	-eu --verbose ${HOME} done "$@" cd grep printf --verbose then
+$(pwd) echo | -eu readonly echo && sed
+		&& /usr/bin done sed ${HOME} -eu
+		$(pwd) echo then --verbose $(pwd) sed sed local
+		${HOME} export done then x=1 "$@" -eu && 2>/dev/null readonly readonly
+test then echo | /usr/bin --verbose then -eu 'quoted text' | | awk
+cd printf readonly && ${HOME} done
+	/usr/bin && ${HOME} export awk /usr/bin -eu 'quoted text' sed done "$1" --verbose
+		&& readonly 'quoted text' /usr/bin
+		| x=1 export readonly ${HOME} grep export grep
+	&& sed readonly test grep local
+${HOME} 2>/dev/null local readonly test awk echo done $(pwd) | cd 2>/dev/null
+x=1 $(pwd) echo --verbose | "$1" readonly "$@"
+	done "$1" readonly then sed printf -eu "$@" awk "$1" awk 2>/dev/null done
+sed printf test 2>/dev/null $(pwd) /usr/bin done printf
+	sed "$@" /usr/bin "$@" x=1 then
+	'quoted text' "$1" -eu sed test awk echo ${HOME} --verbose test done x=1
+test 'quoted text' | ${HOME} | --verbose printf /usr/bin ${HOME}
+		x=1 -eu | ${HOME} 2>/dev/null printf
+		2>/dev/null awk echo echo "$1" --verbose $(pwd) --verbose
+	$(pwd) 2>/dev/null done --verbose echo readonly readonly
+		awk --verbose echo grep "$@" then
+		"$1" printf local -eu printf grep && awk ${HOME}
+grep 'quoted text' then cd export -eu "$@" then sed
+		-eu awk done echo --verbose 2>/dev/null $(pwd) ${HOME} then "$1"
+"$@" done $(pwd) | -eu grep readonly
+	echo awk export /usr/bin 'quoted text' --verbose /usr/bin ${HOME}
+		"$@" cd echo local echo readonly
+| done $(pwd) ${HOME} then -eu && test --verbose $(pwd) test
+${HOME} ${HOME} $(pwd) export "$@" local done ${HOME} cd | 2>/dev/null
+	local done | done local grep readonly 'quoted text'
+	cd | | "$@" --verbose done /usr/bin
+cd done readonly "$@"
+cd "$1" 2>/dev/null local x=1 --verbose cd --verbose done /usr/bin
+	then sed readonly "$1" 2>/dev/null test
+		awk local 2>/dev/null cd -eu printf --verbose
+--verbose /usr/bin export 'quoted text'
+	/usr/bin -eu test /usr/bin done
+		local -eu export 'quoted text' awk -eu ${HOME} test cd | 'quoted text'
+awk | /usr/bin cd --verbose
+	"$@" grep local x=1 "$@" sed printf "$1" -eu
+readonly then done && --verbose local --verbose done | |
+done echo x=1 export done 'quoted text' awk "$1" $(pwd)
+readonly "$@" /usr/bin then x=1 printf "$@" | awk sed
+	echo --verbose && grep then -eu done $(pwd) printf then then echo
+then /usr/bin cd awk then /usr/bin local
+	-eu ${HOME} grep sed readonly --verbose | done readonly local done
+	readonly grep ${HOME} ${HOME} cd grep ${HOME} cd $(pwd) x=1 ${HOME} then
+		2>/dev/null ${HOME} printf "$@" 2>/dev/null cd "$1" && echo -eu && export $(pwd)
+export "$1" $(pwd) --verbose -eu awk readonly
+echo export local awk $(pwd) then 'quoted text' -eu
+	2>/dev/null grep local awk $(pwd) done awk | ${HOME} cd
+		--verbose && local then cd printf grep then echo && local
+		printf export printf | $(pwd) readonly /usr/bin
+printf "$1" done awk -eu done sed ${HOME}
+"$@" echo -eu && cd readonly
+	sed printf $(pwd) then 'quoted text' cd printf --verbose $(pwd)
+	2>/dev/null done && sed --verbose local export
+	-eu "$@" && 2>/dev/null "$@" && export x=1 2>/dev/null
+		printf /usr/bin printf && 2>/dev/null grep $(pwd) 2>/dev/null | cd grep
+	echo 'quoted text' test cd && | then grep grep grep x=1 --verbose x=1
+		grep x=1 && && 'quoted text' 2>/dev/null "$@" $(pwd) x=1 | "$1" done && --verbose
+	"$1" readonly cd then "$1" awk done
+-eu sed -eu 2>/dev/null 'quoted text' "$@" export 2>/dev/null
+		| ${HOME} /usr/bin printf ${HOME} then -eu local echo printf $(pwd) --verbose
+	awk 'quoted text' -eu $(pwd) cd readonly local awk
+		"$@" grep /usr/bin | &&
+		readonly export test --verbose echo done "$@" readonly printf | 'quoted text'
+	then 2>/dev/null sed awk ${HOME} test then 2>/dev/null
+printf sed $(pwd) cd printf x=1 sed test | "$@" awk done printf
+&& "$1" then cd && cd |
+	then then 'quoted text' /usr/bin --verbose sed && 2>/dev/null test 2>/dev/null
+	cd && awk | echo /usr/bin
+		export then readonly 'quoted text'
+	cd sed -eu export "$1" test 'quoted text' |
+then 'quoted text' cd && local 2>/dev/null then $(pwd) grep cd printf -eu
+		2>/dev/null /usr/bin export sed
+'quoted text' done "$@" then "$1" x=1
+sed done "$1" test 2>/dev/null
+		export /usr/bin ${HOME} grep export readonly "$@" $(pwd) printf "$1" 'quoted text'
+	cd printf readonly 2>/dev/null x=1 export printf echo
+readonly cd -eu 2>/dev/null -eu -eu --verbose sed sed local -eu cd && 2>/dev/null
+		2>/dev/null | sed local
+		/usr/bin -eu sed $(pwd) "$1" /usr/bin "$1" grep awk awk "$1"
+		${HOME} -eu 'quoted text' sed awk done "$@" 2>/dev/null then "$1"
+"$1" ${HOME} $(pwd) /usr/bin "$1" awk /usr/bin -eu done x=1
+'quoted text' done "$@" grep 'quoted text' test "$@" printf 2>/dev/null
+		echo ${HOME} echo done export sed 2>/dev/null done x=1 local
+printf printf | 2>/dev/null cd grep "$@" "$@" local 2>/dev/null
+		/usr/bin echo | 2>/dev/null "$1"
+		'quoted text' "$1" "$1" ${HOME} cd ${HOME} 2>/dev/null 'quoted text' cd ${HOME}
+grep grep cd awk test "$1"
+	test "$@" echo ${HOME} local readonly done
+local "$@" "$1" 2>/dev/null readonly local | /usr/bin awk awk "$1" export
+		echo "$@" 'quoted text'
+		x=1 --verbose && -eu | x=1 then ${HOME} grep export export export /usr/bin
+	done ${HOME} 'quoted text' $(pwd) -eu cd "$@" | ${HOME} then then
+	echo $(pwd) done --verbose grep echo printf -eu --verbose grep x=1 $(pwd)
+cd awk cd readonly 'quoted text' test
+		export --verbose /usr/bin ${HOME} local echo
+		then test && awk && then done 2>/dev/null
+&& 'quoted text' then 'quoted text' ${HOME}
+	sed local && 2>/dev/null ${HOME} "$@" /usr/bin
+		--verbose cd then x=1 done | then -eu ${HOME} test ${HOME}
+		"$1" | --verbose then cd readonly sed done $(pwd) 'quoted text'
+		echo local printf awk sed "$@" ${HOME} awk printf && export && test
+done local "$1" 'quoted text' $(pwd) 'quoted text' ${HOME} test
+		-eu $(pwd) printf x=1 printf
+		2>/dev/null | echo && then test 'quoted text' && sed local /usr/bin
+	'quoted text' -eu "$1" | $(pwd) $(pwd) test
+done -eu export cd && /usr/bin cd --verbose /usr/bin
+	awk echo $(pwd) 'quoted text' | local "$1" --verbose done printf && &&
+		test "$1" echo "$@" export sed --verbose
+		grep awk "$1" local | export printf cd | x=1 'quoted text'
+		done sed --verbose ${HOME} readonly 2>/dev/null -eu awk awk 'quoted text'
+		done /usr/bin cd export 2>/dev/null
+	local "$1" export | 'quoted text' | echo 'quoted text' then -eu done
+		grep "$@" --verbose "$1" sed done echo
+sed then local test -eu 'quoted text' -eu 'quoted text' ${HOME}
+	printf cd then then export then "$@"
+		grep ${HOME} export export printf sed printf then "$1" grep echo &&
+		/usr/bin cd local export | grep x=1 sed 'quoted text' --verbose done
+	x=1 -eu "$1" echo | 'quoted text' "$1" 'quoted text'
+	"$@" readonly done /usr/bin sed
+	local local local grep | | 2>/dev/null $(pwd) 2>/dev/null /usr/bin
+		| 'quoted text' then export awk 'quoted text'
+${HOME} -eu "$1" awk --verbose $(pwd) sed echo
+'quoted text' awk awk /usr/bin "$1" local $(pwd) test /usr/bin "$@" x=1 x=1
+test 'quoted text' ${HOME} x=1 'quoted text'
+		cd local then echo $(pwd) "$@" grep "$@"
+		--verbose printf && local | then $(pwd) export sed cd readonly
+	awk test sed then export "$@" local | echo 'quoted text' $(pwd) /usr/bin x=1
+		$(pwd) echo "$@" then
+	local -eu -eu $(pwd) grep && 2>/dev/null
+grep x=1 echo export awk local cd "$1" printf "$@" awk echo sed -eu echo --verbose
+export cd echo then ${HOME} echo awk --verbose readonly
+awk grep --verbose $(pwd) | done grep /usr/bin -eu 2>/dev/null --verbose cd ${HOME}
+		2>/dev/null cd echo --verbose
+sed cd && done && "$1" $(pwd) printf "$@" "$1" 'quoted text'
+	cd grep $(pwd) echo echo printf "$@" 'quoted text' export ${HOME} readonly
+		-eu done awk && --verbose grep grep done awk | 2>/dev/null readonly then "$1"
+	| | readonly sed done printf /usr/bin && "$1" 'quoted text'
+--verbose cd readonly
+	then printf printf then -eu cd 2>/dev/null
+		--verbose 'quoted text' 'quoted text' | --verbose 'quoted text'
+		"$@" awk awk ${HOME} sed ${HOME} cd echo "$1" sed | --verbose ${HOME}
+		'quoted text' cd && cd export --verbose
+		${HOME} 'quoted text' readonly "$@"
+then sed echo grep done "$@" readonly ${HOME} grep && | sed cd
+test then -eu "$1" 2>/dev/null 'quoted text' --verbose test "$@" && | /usr/bin
+	/usr/bin $(pwd) /usr/bin then printf grep printf
+	sed then done ${HOME} sed ${HOME} /usr/bin echo | "$@" --verbose done
+		2>/dev/null "$1" test x=1 echo "$@" local then sed --verbose
+	sed echo awk 2>/dev/null awk printf awk x=1 /usr/bin echo local "$1" readonly
+	"$@" local -eu echo local | --verbose /usr/bin | $(pwd)
+		done printf printf sed local echo echo "$@" $(pwd) local $(pwd)
+	--verbose export "$1" $(pwd) && 'quoted text' --verbose local done done
+	&& ${HOME} ${HOME} export x=1 "$@" ${HOME} printf 'quoted text' awk echo
+	readonly "$1" printf printf local /usr/bin readonly "$@" "$@" readonly 2>/dev/null
+then then local readonly grep grep
+/usr/bin echo | test awk then x=1 then then echo ${HOME}
+	grep /usr/bin sed echo && cd x=1 local | | test grep awk
+		'quoted text' export cd test "$1" && $(pwd) then | grep "$@" sed
+	-eu sed cd grep local
+-eu test export echo | 2>/dev/null "$@" awk echo
+		'quoted text' "$1" printf 'quoted text' $(pwd) sed then | local x=1
+	$(pwd) local test -eu export done echo test "$@" 'quoted text' 2>/dev/null
+readonly ${HOME} 2>/dev/null "$1" done cd sed
+	--verbose awk sed then 'quoted text' done cd "$@" "$@" 'quoted text'
+		awk x=1 "$@" $(pwd) $(pwd)
+	awk cd $(pwd) --verbose sed 'quoted text' readonly echo then 2>/dev/null
+	$(pwd) | 2>/dev/null x=1 | -eu | then echo "$1" $(pwd) test cd --verbose
+	--verbose 'quoted text' done done awk 'quoted text' 'quoted text'
+		then export x=1 --verbose local $(pwd) printf export "$@" && test ${HOME}
+	"$@" x=1 -eu "$1" grep /usr/bin test "$@" awk local test
+		awk sed | /usr/bin echo readonly "$@" readonly
+"$1" --verbose --verbose --verbose sed awk printf
+	x=1 'quoted text' test cd awk then local $(pwd) readonly export echo export
+		echo "$1" ${HOME} test x=1 grep && local $(pwd) echo --verbose ${HOME}
+		done awk && printf awk printf 2>/dev/null --verbose -eu && "$1" local
+		&& local 2>/dev/null -eu "$@" --verbose x=1 -eu | --verbose printf
+echo sed | x=1 cd "$1" && cd cd ${HOME} x=1 | "$@" test -eu $(pwd) "$1"
+readonly local cd cd "$@" cd "$1" ${HOME} readonly "$1" --verbose done
+	printf 'quoted text' sed 'quoted text' printf local cd
+		then x=1 sed awk /usr/bin readonly -eu "$1" --verbose | 2>/dev/null then /usr/bin
+&& echo | 2>/dev/null "$1" sed ${HOME}
+	x=1 echo /usr/bin readonly && 2>/dev/null printf readonly done awk
+		"$1" test done && test ${HOME} test
+		"$@" "$@" x=1 printf "$@" grep 'quoted text' "$@" --verbose test /usr/bin
+-eu x=1 "$1" "$1" ${HOME} | 'quoted text' cd 'quoted text' sed |
+cd --verbose "$1" $(pwd) test done awk cd grep awk | && echo then "$@"
+export 2>/dev/null grep --verbose ${HOME} ${HOME} 2>/dev/null
+$(pwd) | then grep local 'quoted text' cd sed local readonly | printf
+		then $(pwd) ${HOME} export local x=1 $(pwd) ${HOME} sed -eu grep local
+echo test "$@" readonly cd grep echo && test | 2>/dev/null 'quoted text' then
+/usr/bin "$1" ${HOME} echo "$@" 'quoted text'
+	/usr/bin local "$1" "$1" "$@" local test test cd done /usr/bin
+	"$@" test $(pwd) 'quoted text' printf printf "$@" echo
+	export "$@" test x=1 "$1" 2>/dev/null
+		'quoted text' test done $(pwd)
+	${HOME} 2>/dev/null cd printf echo | 2>/dev/null echo echo "$1" | grep
+2>/dev/null local /usr/bin export -eu sed --verbose ${HOME}
+		x=1 x=1 "$@" 2>/dev/null | /usr/bin then awk 'quoted text' done -eu echo
+		awk $(pwd) | grep --verbose --verbose local then && local "$1" local "$@" test
+		&& done echo then && | printf local ${HOME} /usr/bin /usr/bin sed /usr/bin
+$(pwd) "$@" ${HOME} export
+test -eu ${HOME} sed readonly then ${HOME}
+-eu /usr/bin then x=1 --verbose awk && test -eu done ${HOME} cd grep test cd
+		&& x=1 && test 2>/dev/null | 2>/dev/null echo && awk export --verbose
+grep sed | 2>/dev/null | readonly readonly printf readonly && --verbose
+then -eu readonly | && test then --verbose
+	x=1 'quoted text' -eu /usr/bin "$@" --verbose -eu done
+		echo test --verbose | -eu sed /usr/bin awk && -eu done "$@" cd test sed
+x=1 sed /usr/bin done "$@"
+| "$1" echo && cd "$1" done awk && local printf | grep $(pwd) /usr/bin local
+		"$@" 2>/dev/null test x=1 "$1" -eu test done $(pwd) export
+'quoted text' 2>/dev/null awk -eu export "$@" grep local | export && echo
+$(pwd) 'quoted text' then sed local 'quoted text' test && grep echo "$1"
+	"$1" awk grep --verbose $(pwd) awk --verbose local &&
+		2>/dev/null -eu -eu cd /usr/bin 'quoted text' done x=1
+echo ${HOME} echo 2>/dev/null /usr/bin $(pwd) &&
+		awk ${HOME} echo -eu 2>/dev/null "$1" | cd "$@" "$@"
+	readonly "$@" x=1 ${HOME} cd printf -eu -eu
+	-eu 2>/dev/null --verbose 2>/dev/null printf /usr/bin local 2>/dev/null
+		-eu -eu then 2>/dev/null && | printf /usr/bin /usr/bin export awk awk sed export
+		"$@" then 2>/dev/null done echo "$@" /usr/bin sed printf $(pwd) "$@" awk
+	| sed "$1" $(pwd) echo -eu test $(pwd) -eu
+grep export export test | echo cd sed test then
+	local echo test test $(pwd) 'quoted text' awk awk test sed -eu local
+	sed test grep $(pwd) then ${HOME} export --verbose done | awk
+		&& 'quoted text' && printf awk $(pwd) x=1 | && local local x=1 sed "$1"
+	-eu "$@" local x=1 local sed /usr/bin "$1" grep "$@" ${HOME} export
+2>/dev/null 2>/dev/null sed ${HOME} && /usr/bin export && cd awk export
+${HOME} sed echo "$1" awk echo --verbose --verbose
+	&& awk -eu printf sed 2>/dev/null && ${HOME} ${HOME}
+readonly awk 'quoted text' 2>/dev/null -eu printf /usr/bin echo printf cd then
+		awk x=1 printf "$1" then echo echo local -eu 'quoted text' --verbose
+	cd -eu echo grep done "$1" 'quoted text' test x=1 ${HOME} | "$1" readonly
+	export echo local done "$1" grep awk grep
+-eu then awk "$1" /usr/bin 2>/dev/null /usr/bin $(pwd) cd then readonly "$@"
+	done cd printf ${HOME} test | "$1" echo
+	test awk ${HOME} --verbose ${HOME} grep
+		"$1" 2>/dev/null export cd ${HOME} /usr/bin grep
+	printf x=1 local 2>/dev/null grep cd printf -eu --verbose grep
+	then readonly then done grep x=1 echo test /usr/bin
+	/usr/bin | printf grep local && /usr/bin 'quoted text' ${HOME} awk --verbose
+		cd "$@" /usr/bin export "$1"
+		"$@" $(pwd) "$1" local -eu cd "$1" echo then awk echo
+		/usr/bin local ${HOME} test "$@" ${HOME} done $(pwd) printf $(pwd)
+-eu 2>/dev/null "$@" then awk printf 2>/dev/null "$@"
+		"$@" printf then $(pwd) "$@" 'quoted text' x=1 test done "$@" printf awk sed then
+	grep $(pwd) grep "$@" test sed test $(pwd) done export
+		export x=1 export readonly "$1"
+local grep --verbose |
+	local readonly printf "$1" export then "$@"
+		cd done awk grep | sed && printf | | local &&
+awk cd /usr/bin ${HOME} grep ${HOME} $(pwd) /usr/bin 2>/dev/null readonly
+	then "$1" test --verbose grep ${HOME} 'quoted text'
+| then printf readonly test "$1" awk 'quoted text' /usr/bin "$@" then x=1
+	$(pwd) grep local /usr/bin done local
+	done printf readonly then awk echo sed $(pwd) $(pwd) --verbose |
+cd test 'quoted text' ${HOME} 2>/dev/null /usr/bin $(pwd)
+		test "$1" 2>/dev/null sed | --verbose x=1 done && cd
+	printf grep printf -eu --verbose grep local then grep "$1" readonly
+"$@" readonly 2>/dev/null && awk
+		done | /usr/bin sed ${HOME} test sed "$@" ${HOME} test
+	/usr/bin && sed cd grep ${HOME} cd grep cd cd sed ${HOME} 'quoted text' "$1" ${HOME}
+		local --verbose "$@" cd 'quoted text'
+	cd && then echo "$@" && x=1 readonly "$@" -eu cd done readonly echo local
+	awk && echo "$1" export
+printf readonly "$@" cd -eu local
+--verbose test sed awk "$@" $(pwd)
+		printf /usr/bin $(pwd) | then grep --verbose "$@" done /usr/bin
+-eu 'quoted text' readonly grep test | done then echo $(pwd) --verbose
+		'quoted text' test /usr/bin then sed awk local | echo test then printf
+| 2>/dev/null grep awk 2>/dev/null ${HOME} 2>/dev/null "$1" "$@"
+local $(pwd) $(pwd) readonly /usr/bin
+$(pwd) printf && && ${HOME} export sed cd readonly -eu $(pwd) | cd awk then
+		done printf readonly export
+local 'quoted text' cd ${HOME} printf ${HOME} /usr/bin x=1 export local /usr/bin
+		${HOME} printf test echo test
+		$(pwd) && done awk awk test
+	export --verbose "$@" awk sed awk
+	| awk && awk export ${HOME} -eu then 2>/dev/null "$@" 2>/dev/null sed
+		local $(pwd) -eu cd echo /usr/bin then ${HOME} 'quoted text'
+		"$1" && echo x=1 'quoted text'
+printf -eu then $(pwd) export && --verbose readonly /usr/bin
+	sed -eu awk ${HOME} 'quoted text'
+-eu sed /usr/bin "$@" 2>/dev/null grep printf | $(pwd) export /usr/bin
+		${HOME} "$@" -eu then done done
+		${HOME} --verbose local printf $(pwd)
+		test /usr/bin x=1 --verbose local -eu 2>/dev/null
+grep --verbose export 'quoted text' && done
+"$1" done sed test echo "$@" grep 2>/dev/null /usr/bin awk readonly sed -eu
+/usr/bin readonly sed
+printf | sed | then "$@" export printf
+printf awk "$@" echo cd readonly
+	test sed printf cd -eu /usr/bin "$@" x=1 export ${HOME} 'quoted text'
+${HOME} $(pwd) && "$@" ${HOME} done done /usr/bin
+		readonly then $(pwd) printf done --verbose
+	test x=1 test ${HOME} cd
+		| test awk | 2>/dev/null sed test echo sed test export
+	| done | | --verbose | 2>/dev/null local done
+	x=1 /usr/bin | $(pwd) local printf grep then 2>/dev/null
+/usr/bin && 2>/dev/null local "$1" "$1" then | awk 'quoted text' ${HOME}
+	sed awk 'quoted text' awk $(pwd) test printf echo export awk
+	/usr/bin printf 'quoted text' "$@" ${HOME} "$1" 2>/dev/null sed
+	/usr/bin x=1 /usr/bin echo 2>/dev/null
+awk printf test done done x=1 2>/dev/null then local export grep readonly
+sed then --verbose ${HOME} awk printf grep 2>/dev/null sed sed "$@"
+	"$@" "$@" echo 2>/dev/null && printf --verbose "$@"
+	'quoted text' /usr/bin && readonly
+		sed "$1" local test grep /usr/bin
+-eu printf readonly /usr/bin echo
+awk awk done | /usr/bin sed then
+local && "$1" -eu -eu $(pwd) then -eu 'quoted text'
+		-eu && grep -eu $(pwd) awk awk 2>/dev/null awk 2>/dev/null 2>/dev/null readonly
+	/usr/bin && echo "$@" "$1" --verbose then awk readonly readonly then
+		grep awk awk 'quoted text'
+	/usr/bin "$@" 'quoted text' --verbose 2>/dev/null sed cd cd | awk
+	"$@" 'quoted text' ${HOME} done export
+	done x=1 readonly 2>/dev/null x=1 awk awk x=1 /usr/bin
+		&& awk echo $(pwd) local local -eu | grep done cd done
+		echo ${HOME} && && readonly
+		--verbose | awk local local then $(pwd) printf test awk
+-eu 2>/dev/null --verbose
+	&& /usr/bin | | 'quoted text' x=1 /usr/bin sed "$@" ${HOME}
+printf readonly grep x=1 then ${HOME} printf x=1 test --verbose sed && done && &&
+		/usr/bin && && | printf sed printf then test | grep ${HOME} export ${HOME}
+	readonly -eu readonly grep && x=1
+awk 2>/dev/null ${HOME}
+grep --verbose grep | printf then ${HOME} readonly /usr/bin "$1"
+	printf export then local readonly grep x=1 2>/dev/null
+grep ${HOME} -eu /usr/bin
+	| printf local local ${HOME} /usr/bin readonly
+	"$1" && grep test "$1" && "$@" | -eu test | test 2>/dev/null ${HOME}
+		done $(pwd) "$@" readonly local
+	printf $(pwd) awk 2>/dev/null $(pwd) then && echo
+	$(pwd) x=1 && x=1 readonly local done readonly echo --verbose ${HOME} -eu echo
+		"$1" local readonly grep $(pwd) local
+'quoted text' echo printf && readonly 2>/dev/null echo local cd cd && && printf
+	done $(pwd) sed echo printf x=1 test
+	&& export grep && && "$@" grep &&
+echo awk echo awk | | /usr/bin $(pwd) --verbose export
+		-eu -eu | export readonly /usr/bin then printf
+/usr/bin test done 2>/dev/null
+		sed "$1" "$1" echo export local x=1 -eu local cd $(pwd) 2>/dev/null -eu
+cd then local grep 'quoted text'
+'quoted text' grep 2>/dev/null "$1" test
+	test then done ${HOME} done cd "$@" --verbose
+		--verbose && local printf export && export readonly
+		grep ${HOME} done x=1 awk x=1 "$@" test $(pwd) x=1 2>/dev/null
+readonly readonly "$@" --verbose awk /usr/bin export 'quoted text'
+		export then --verbose echo echo | readonly ${HOME} | "$1"
+		2>/dev/null grep sed readonly done awk printf --verbose export printf
+	$(pwd) && export cd grep awk -eu awk -eu 'quoted text'
+		awk 'quoted text' sed grep cd ${HOME} --verbose sed
+	${HOME} -eu /usr/bin then /usr/bin done printf
+		sed test $(pwd) echo && x=1 readonly test awk
+		"$@" echo && echo done "$1" awk ${HOME} /usr/bin sed && grep
+		/usr/bin sed grep grep "$@" "$1" -eu /usr/bin cd "$@"
+		x=1 printf echo /usr/bin x=1 then awk cd 'quoted text' "$@" then /usr/bin
+| echo done 'quoted text' local | awk
+--verbose readonly test |
+	&& awk $(pwd) 'quoted text'
+	echo x=1 cd 'quoted text'
+	--verbose echo done x=1 -eu then x=1 && local echo grep printf $(pwd) test
+		${HOME} x=1 | ${HOME} | /usr/bin -eu grep
+		local printf && test && &&
+		$(pwd) done --verbose --verbose grep
+-eu && ${HOME} test readonly echo done "$1" echo readonly
+		| echo then $(pwd) local
+		| "$@" grep grep sed grep
+	export 2>/dev/null echo /usr/bin sed "$1" | then export -eu -eu $(pwd) /usr/bin
+		&& | printf | 2>/dev/null x=1 cd
+local "$@" printf 2>/dev/null then local export -eu grep local "$@" /usr/bin
+		test then echo | --verbose "$@" 2>/dev/null
+	x=1 && | cd 2>/dev/null local /usr/bin echo awk
+		"$@" sed -eu printf test && $(pwd) --verbose | x=1 done
+		'quoted text' sed printf local printf echo printf 'quoted text' $(pwd)
+	readonly -eu echo export echo --verbose readonly
+		"$1" grep | 2>/dev/null readonly 2>/dev/null
+awk -eu echo && x=1 /usr/bin | && --verbose awk grep && /usr/bin
+2>/dev/null awk x=1 | 'quoted text' "$1"
+	done cd "$@" "$1" then grep readonly
+-eu awk 'quoted text' "$1" 'quoted text' $(pwd) local 2>/dev/null
+		printf echo $(pwd) "$@"
+| then --verbose grep
+		local test done export export && sed "$@" -eu && -eu grep readonly then cd
+		"$@" | readonly /usr/bin -eu grep && -eu
+export -eu && --verbose done 2>/dev/null "$1" cd
+awk awk x=1 local readonly ${HOME} grep -eu printf
+		readonly then && done cd done && $(pwd) ${HOME} $(pwd) echo ${HOME}
+'quoted text' awk -eu "$@" cd
+| readonly -eu "$@" | "$@"
+	x=1 2>/dev/null --verbose readonly test --verbose printf | 'quoted text'
+	test | -eu local && done then awk test 'quoted text'
+	done printf -eu ${HOME} 2>/dev/null cd printf
+--verbose 'quoted text' | | sed --verbose then grep
+		test /usr/bin then "$1" sed readonly 'quoted text' 2>/dev/null
+	| then ${HOME} local $(pwd) grep 'quoted text'
+printf readonly x=1 2>/dev/null
+done 'quoted text' export readonly ${HOME} echo -eu ${HOME} 'quoted text'
+		sed echo readonly 2>/dev/null done /usr/bin
+		-eu then 'quoted text' "$@" --verbose
+	| x=1 ${HOME} done | "$1" -eu $(pwd) grep ${HOME} "$1"
+		--verbose awk --verbose && echo cd && then done readonly grep
+'quoted text' printf && export test --verbose "$@"
+echo x=1 test "$@" export sed --verbose echo --verbose
+cd $(pwd) $(pwd) $(pwd) export echo awk grep cd then done
+	2>/dev/null --verbose 2>/dev/null ${HOME} | awk sed printf /usr/bin readonly
+${HOME} awk $(pwd) echo local done printf readonly cd ${HOME}
+printf test | "$1" $(pwd) done 2>/dev/null
+		"$1" readonly local readonly printf | -eu 2>/dev/null 2>/dev/null x=1 done |
+$(pwd) export printf echo echo grep 2>/dev/null "$@" "$1" cd done
+		cd -eu -eu echo && then | 2>/dev/null 2>/dev/null "$1" $(pwd) local 2>/dev/null
+	local /usr/bin awk local
+	&& cd local printf done echo local printf printf readonly then printf $(pwd) | sed
+printf 'quoted text' readonly test | test | echo awk "$@" x=1 "$@" 2>/dev/null
+cd 2>/dev/null echo x=1 done then done cd readonly readonly
+		then printf sed "$1" echo printf "$1" printf grep -eu echo 'quoted text' grep
+"$1" readonly /usr/bin -eu x=1 'quoted text'
+	export $(pwd) cd "$1" cd "$@"
+	done echo x=1 "$@" "$@" -eu printf grep 2>/dev/null
+-eu "$@" echo grep --verbose local $(pwd) local echo "$@"
+		x=1 x=1 2>/dev/null export cd test && local x=1 x=1 --verbose awk x=1 x=1 --verbose
+		'quoted text' echo export && ${HOME} 2>/dev/null local | test x=1 x=1 'quoted text'
+	local 'quoted text' "$@" | printf 2>/dev/null 2>/dev/null grep then $(pwd)
+	readonly | && 'quoted text'
+${HOME} grep done test done | done
+| export 'quoted text' grep 'quoted text'
+"$@" local done readonly printf "$@" 2>/dev/null
+		grep echo $(pwd) ${HOME} printf test --verbose
+	sed awk done sed $(pwd) 2>/dev/null
+		${HOME} then -eu cd ${HOME} && sed $(pwd) && ${HOME}
+sed cd ${HOME} --verbose printf "$1" printf 'quoted text'
+	x=1 "$@" done "$@" readonly
+		done | test ${HOME} done echo export && "$1" then "$@" echo $(pwd) ${HOME} echo
+		$(pwd) "$1" grep --verbose then | --verbose sed awk x=1 export grep --verbose
+printf awk | sed cd ${HOME} awk "$@" $(pwd) local
+		| cd "$1" "$@" x=1 echo then $(pwd) "$1" echo sed 'quoted text'
+"$1" awk grep && --verbose -eu $(pwd) "$1" x=1 then grep && sed test "$1" "$@"
+then readonly readonly ${HOME} "$1" cd echo awk && sed
+	cd "$1" sed 2>/dev/null export x=1 local "$1" test grep ${HOME} --verbose
+"$@" export sed test printf
+		2>/dev/null $(pwd) echo awk export test 2>/dev/null local | | readonly &&
+		cd | | && -eu x=1 export 'quoted text' export
+		-eu done /usr/bin test
+${HOME} awk done --verbose --verbose printf awk
+	readonly grep "$@" cd /usr/bin x=1 grep printf echo && -eu test readonly 'quoted text'
+done done cd && grep x=1 && done $(pwd) -eu "$1" grep readonly cd 'quoted text'
+	2>/dev/null "$@" printf printf sed then cd
+	sed done awk done then "$@" "$@" $(pwd) ${HOME} printf "$1" "$1" x=1 "$@" cd
+readonly ${HOME} printf
+then x=1 2>/dev/null sed 2>/dev/null
+awk 2>/dev/null 2>/dev/null x=1 grep test x=1 --verbose cd awk --verbose /usr/bin
+cd --verbose done local ${HOME} echo then test export --verbose -eu
+		"$1" awk then done test 2>/dev/null cd
+	readonly echo grep ${HOME} -eu "$@"
+	x=1 "$1" local export "$@" ${HOME} awk "$1" x=1 && && awk x=1 -eu && export sed
+2>/dev/null readonly local local echo /usr/bin -eu awk export $(pwd)
+-eu -eu ${HOME} "$@" export -eu --verbose echo test "$@"
+		$(pwd) -eu ${HOME} done readonly /usr/bin
+		${HOME} test | done sed 'quoted text'
+	$(pwd) $(pwd) test awk echo $(pwd) -eu printf done "$1" -eu
+test local "$@" "$1" done local done then | 'quoted text' 'quoted text'
+x=1 -eu "$@" then 'quoted text' && -eu awk x=1 "$@" export printf done --verbose
+		'quoted text' --verbose "$1" 2>/dev/null
+	done then 'quoted text' grep $(pwd) -eu done echo 2>/dev/null
+		printf grep && printf cd "$@" cd
+echo sed --verbose local && printf echo sed --verbose done then local "$@"
+x=1 -eu readonly test | sed awk then /usr/bin 'quoted text' readonly && echo
+		cd x=1 /usr/bin -eu export "$1" cd awk 2>/dev/null --verbose printf "$1"
+		printf done | "$@" local $(pwd) echo "$1" /usr/bin then then
+-eu 'quoted text' local ${HOME}
+| done --verbose 'quoted text' readonly
+	readonly -eu grep printf --verbose echo 2>/dev/null -eu cd
+	"$1" 2>/dev/null /usr/bin && printf 'quoted text' "$1" 2>/dev/null export
+	grep cd printf local /usr/bin sed 2>/dev/null sed done
+		cd $(pwd) /usr/bin "$@" && | printf "$@" 'quoted text' 2>/dev/null grep
+		awk "$@" readonly grep export
+	export --verbose local -eu | --verbose done grep export | --verbose done
+		2>/dev/null sed "$1" test | awk --verbose local
+	awk sed | /usr/bin echo awk printf grep ${HOME} local local | printf --verbose
+		done local cd then ${HOME} x=1
+cd /usr/bin $(pwd) echo x=1 grep
+		echo echo export $(pwd) readonly echo
+		"$@" printf grep /usr/bin 2>/dev/null /usr/bin --verbose | grep then -eu awk
+-eu done "$@" -eu | echo done
+	2>/dev/null | && ${HOME} sed "$1" 2>/dev/null grep printf done
+		-eu 2>/dev/null --verbose test cd then --verbose
+local "$@" grep "$@" "$1" readonly "$@" /usr/bin -eu | --verbose cd --verbose
+	| printf grep done 2>/dev/null x=1 test echo test "$@"
+		$(pwd) 'quoted text' readonly awk sed
+		"$1" export test -eu 'quoted text'
+		grep readonly /usr/bin ${HOME} ${HOME} && -eu local 2>/dev/null
+		"$1" ${HOME} local awk done test "$1" | /usr/bin then export $(pwd)
+	'quoted text' $(pwd) 2>/dev/null -eu && sed printf x=1 2>/dev/null -eu 'quoted text'
+sed ${HOME} --verbose "$@" grep
+${HOME} -eu $(pwd) ${HOME}
+2>/dev/null --verbose -eu done ${HOME} then awk test | 'quoted text'
+'quoted text' x=1 grep then readonly then -eu "$@" printf awk 'quoted text'
+grep 'quoted text' export export readonly x=1 done then --verbose test /usr/bin
+		cd "$1" grep | x=1 sed --verbose sed printf x=1
+	/usr/bin done cd x=1 /usr/bin --verbose
+	then $(pwd) -eu 'quoted text' printf ${HOME}
+		${HOME} readonly done && then export grep ${HOME} done grep
+	&& echo done done ${HOME}
+		done export awk printf local -eu && export -eu sed done ${HOME} 2>/dev/null
+		then export grep sed "$1" /usr/bin "$@" 2>/dev/null test "$@" cd
+	then local local -eu "$1" && -eu export sed local
+	/usr/bin grep $(pwd) test printf | "$@" cd $(pwd) done local --verbose ${HOME}
+'quoted text' 2>/dev/null && --verbose
+	2>/dev/null sed && "$1" 2>/dev/null ${HOME}
+	'quoted text' sed 'quoted text' x=1 | "$1"
+		$(pwd) echo x=1 done -eu x=1 then x=1 cd cd 2>/dev/null
+		sed x=1 done readonly && printf 2>/dev/null
+	awk export /usr/bin readonly x=1
+readonly "$1" sed then -eu cd export readonly x=1 /usr/bin 2>/dev/null &&
+	'quoted text' test 2>/dev/null "$@" --verbose
+		x=1 -eu $(pwd) awk /usr/bin && awk $(pwd) echo
+done ${HOME} awk ${HOME}
+		"$1" ${HOME} cd "$@" ${HOME} sed readonly then ${HOME} cd echo then /usr/bin
+	--verbose readonly x=1 readonly export
+		echo printf "$@" grep && grep $(pwd) awk sed 2>/dev/null
+	printf awk $(pwd) local $(pwd) $(pwd) test readonly -eu $(pwd)
+	-eu test x=1 && && $(pwd) printf ${HOME}
+readonly | grep -eu 2>/dev/null echo 'quoted text' export echo cd && /usr/bin 2>/dev/null
+		readonly x=1 x=1 readonly awk grep ${HOME} 'quoted text' "$1"
+-eu done x=1 "$@" 'quoted text' local -eu $(pwd)
+cd sed 2>/dev/null test --verbose 'quoted text' cd local test && ${HOME} done 'quoted text'
+test echo awk ${HOME} grep /usr/bin sed echo 2>/dev/null echo
+then printf -eu done grep ${HOME} "$1" readonly -eu then
+x=1 $(pwd) $(pwd) 'quoted text' grep $(pwd) export cd 'quoted text'
+	awk awk readonly done $(pwd) test grep readonly
+grep 'quoted text' 2>/dev/null "$1" && local grep --verbose && local readonly
+		'quoted text' test ${HOME} "$@" 'quoted text'
+	done local && awk "$1" /usr/bin readonly | awk
+	/usr/bin "$1" --verbose local /usr/bin grep awk awk
+		"$@" $(pwd) grep grep echo sed ${HOME} printf local
+local | x=1 grep ${HOME} done export /usr/bin readonly printf done --verbose --verbose
+	readonly test && readonly -eu done readonly && test local -eu awk
+	-eu done 2>/dev/null
+		"$@" sed done readonly 'quoted text'
+sed grep 'quoted text' sed -eu export printf
+grep | x=1 sed && test done $(pwd) grep 2>/dev/null
+		&& ${HOME} 'quoted text' --verbose "$@"
+grep 2>/dev/null awk test readonly done && -eu --verbose
+		| 2>/dev/null -eu 'quoted text' readonly printf
+	"$@" 2>/dev/null 2>/dev/null
+"$1" && awk echo export -eu -eu echo /usr/bin
+	--verbose --verbose "$1" done 'quoted text'
+	/usr/bin awk "$1" && sed && test && local printf cd done x=1 export
+		2>/dev/null test "$@" /usr/bin /usr/bin $(pwd)
+		--verbose then printf x=1 | "$@" readonly then grep $(pwd) local "$@"
+grep | echo $(pwd) $(pwd) ${HOME} $(pwd)
+	/usr/bin 'quoted text' x=1 local done && echo -eu sed grep
+echo /usr/bin cd x=1 ${HOME} && | $(pwd) 'quoted text' 2>/dev/null grep
+		test 2>/dev/null 'quoted text' readonly then done echo export --verbose --verbose
+		local 2>/dev/null /usr/bin awk | | echo cd | "$1"
+done x=1 export x=1 -eu awk && test cd readonly 'quoted text'
+test cd 2>/dev/null printf cd sed test x=1 && done 2>/dev/null echo
+	done | then test echo --verbose x=1 $(pwd) readonly grep readonly then "$1"
+		printf /usr/bin echo /usr/bin echo /usr/bin
+	test readonly then sed 2>/dev/null "$1" "$1" "$1"
+		--verbose "$@" "$@" "$@" 2>/dev/null 'quoted text' -eu printf grep "$1" "$1" printf
+	test test --verbose test |
+		/usr/bin printf x=1 done done "$1"
+	grep grep /usr/bin "$1" ${HOME} printf $(pwd) readonly $(pwd) /usr/bin done 'quoted text'
+awk export "$@" && "$1" x=1 echo 'quoted text' /usr/bin
+		grep readonly awk | 2>/dev/null printf echo then test | local readonly ${HOME}
+	export cd 'quoted text' cd cd test -eu $(pwd) cd done
+		2>/dev/null readonly "$@" x=1 printf x=1 test echo $(pwd) printf sed grep
+	grep && "$@" export done x=1 grep "$1"
+	"$@" grep "$@" 'quoted text' && export
+local export done done local printf grep $(pwd) && ${HOME} awk
+echo grep "$@" done "$@" && | "$@" done /usr/bin export grep readonly test echo
+		done awk readonly -eu /usr/bin sed echo
+printf awk | $(pwd) 'quoted text' /usr/bin && 2>/dev/null
+		grep export | done done grep "$@" then | |
+		$(pwd) 'quoted text' echo -eu --verbose
+		echo && ${HOME} x=1 grep "$1" export cd 'quoted text' 2>/dev/null
+then ${HOME} echo -eu grep "$1" echo
+/usr/bin "$1" --verbose /usr/bin echo "$1" | sed $(pwd) sed "$@" 'quoted text'
+	&& ${HOME} -eu --verbose /usr/bin
+	readonly echo ${HOME} -eu "$@" -eu echo grep awk | export
+	printf sed 2>/dev/null echo
+"$1" $(pwd) "$1" awk export --verbose $(pwd) --verbose
+		--verbose awk x=1 then local "$1" 'quoted text'
+-eu grep done x=1 echo
+		2>/dev/null /usr/bin 2>/dev/null local cd export test cd | export
+		done local --verbose awk awk
+	x=1 cd test --verbose test ${HOME} local done --verbose
+	cd --verbose && local test | sed $(pwd) | printf done awk | "$1" --verbose
+		"$@" readonly grep $(pwd) /usr/bin printf 2>/dev/null 2>/dev/null echo /usr/bin
+	-eu local echo sed local local
+	test local sed test x=1 && x=1 cd | grep && "$1" readonly -eu then x=1 "$@"
+x=1 "$@" 2>/dev/null grep echo local readonly 'quoted text' echo done "$1"
+		awk local awk local 'quoted text' echo ${HOME} done 'quoted text' then ${HOME}
+sed ${HOME} test grep cd awk ${HOME} then "$1" -eu 2>/dev/null export
+		| | then && awk 'quoted text' "$@" 'quoted text' cd echo done readonly
+		local ${HOME} 2>/dev/null
+	| 2>/dev/null export x=1 printf 2>/dev/null local readonly $(pwd) export sed
+local | awk echo 'quoted text' awk 2>/dev/null then 2>/dev/null
+		then "$@" echo sed "$@" | export local done ${HOME}
+"$@" printf 'quoted text' 'quoted text' $(pwd) then
+	| | /usr/bin readonly "$1" awk && cd export then test &&
+		done echo printf test export grep /usr/bin --verbose sed --verbose -eu --verbose
+		then then local cd awk x=1 --verbose done && ${HOME} x=1 sed
+		echo awk --verbose -eu done printf
+	export readonly "$1" awk printf then
+	${HOME} readonly then "$1" && test printf $(pwd) "$1" cd sed 2>/dev/null
+		x=1 awk done -eu --verbose then awk | done then
+		"$1" sed $(pwd) 'quoted text' -eu --verbose
+		2>/dev/null sed done done --verbose grep -eu /usr/bin export "$@"
+		"$1" /usr/bin "$@" ${HOME}
+	$(pwd) grep echo cd test echo echo &&
+		done 2>/dev/null "$1"
+	&& "$@" 'quoted text' x=1 "$@" printf readonly readonly
+	grep printf /usr/bin readonly x=1 awk -eu sed "$1" 2>/dev/null
+	then /usr/bin "$@" ${HOME} "$@" cd "$@" x=1 --verbose test 2>/dev/null
+		awk grep ${HOME} 2>/dev/null then local local test $(pwd) cd local "$@" readonly
+grep then done printf grep printf && -eu -eu $(pwd) export sed
+		$(pwd) grep && $(pwd) -eu 'quoted text' -eu export export && "$1" x=1
+2>/dev/null && ${HOME} printf echo export -eu 'quoted text'
+test cd && grep export printf $(pwd)
+	grep --verbose ${HOME} /usr/bin test x=1 grep readonly -eu test "$1" export
+		${HOME} -eu $(pwd) local printf done sed 2>/dev/null
+'quoted text' && 2>/dev/null cd --verbose grep
+		"$@" then cd echo grep
+	| && grep local "$@" x=1 && "$1" --verbose "$1"
+printf x=1 printf sed /usr/bin export | | 2>/dev/null 2>/dev/null test
+awk echo x=1 done grep /usr/bin "$@" | $(pwd) awk
+		2>/dev/null grep ${HOME} readonly /usr/bin && local printf echo
+x=1 then 2>/dev/null then -eu export awk then
+		2>/dev/null echo readonly local ${HOME} readonly "$@" cd -eu -eu sed export
+	"$1" test printf | | printf ${HOME} sed "$@" local sed /usr/bin
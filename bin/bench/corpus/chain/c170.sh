@@ -0,0 +1,2001 @@
+--verbose --verbose "$1" local 2>/dev/null printf
+		printf local "$@" test x=1 'quoted text' 'quoted text'
+		test "$1" "$@" $(pwd) $(pwd) sed ${HOME} | sed "$@" printf then
+		test ${HOME} && --verbose "$1" awk -eu test && test
+	sed -eu 'quoted text' /usr/bin grep echo
+	sed then && -eu cd grep test ${HOME}
+${HOME} && && "$@" then 'quoted text' done test readonly awk
+		| x=1 && awk "$1" 2>/dev/null | /usr/bin readonly grep $(pwd) --verbose local
+cd $(pwd) x=1 && 'quoted text' awk awk export -eu
+awk echo $(pwd) "$1" x=1 echo && x=1 export "$@" x=1 sed readonly
+echo cd -eu grep echo 2>/dev/null local sed "$1" &&
+		"$1" sed 2>/dev/null "$@" awk local
+		test local x=1 grep then x=1 'quoted text'
+	&& then $(pwd) --verbose "$@" "$@" done
+sed cd ${HOME} local -eu local 2>/dev/null then && test ${HOME} 'quoted text'
+	--verbose then printf then export test test -eu sed "$1"
+-eu "$@" /usr/bin 2>/dev/null | sed export -eu "$1" /usr/bin
+	2>/dev/null "$1" /usr/bin grep then then readonly && echo sed grep | -eu
+		done "$1" ${HOME} 2>/dev/null "$@" $(pwd) awk test --verbose -eu echo
+"$1" then x=1 "$@" && && done grep awk 2>/dev/null /usr/bin
+		$(pwd) export x=1 | grep awk /usr/bin
+		then readonly "$@" then grep --verbose cd grep "$@" 2>/dev/null done
+	sed --verbose $(pwd) local local 'quoted text' local $(pwd) "$@" && x=1
+	x=1 && && export export $(pwd) test printf sed --verbose echo x=1 done printf
+2>/dev/null 2>/dev/null | 'quoted text' printf
+		echo done local echo | cd "$@" cd grep "$@" local "$1"
+grep -eu -eu grep $(pwd)
+		readonly -eu --verbose ${HOME} -eu awk echo local grep echo
+	${HOME} printf $(pwd) "$@" export cd grep 2>/dev/null test cd then test
+		sed printf "$1" local awk local done x=1 | && ${HOME} ${HOME} && "$@" -eu export
+		--verbose sed -eu test | echo
+	echo /usr/bin ${HOME} ${HOME} local
+| readonly "$@" "$@" $(pwd)
+/usr/bin cd 'quoted text' -eu local cd grep done
+	echo /usr/bin && $(pwd) | grep printf
+/usr/bin && 'quoted text' sed echo -eu
+export sed echo 2>/dev/null && && sed ${HOME} local x=1 cd awk | --verbose
+/usr/bin 2>/dev/null /usr/bin | echo /usr/bin && awk x=1 x=1 --verbose "$1"
+	"$@" cd --verbose ${HOME} "$@" then cd --verbose |
+"$@" test $(pwd) -eu --verbose export && local
+		readonly grep "$@" printf sed ${HOME} readonly
+		printf /usr/bin "$@" awk "$@" cd ${HOME} --verbose "$1"
+	/usr/bin x=1 test cd
+		x=1 'quoted text' cd printf
+	&& sed --verbose test "$@" export --verbose local printf "$@"
+		sed local local test sed /usr/bin $(pwd) readonly
+		"$@" && -eu 2>/dev/null printf
+	&& 2>/dev/null printf && sed echo echo echo then "$1" 'quoted text' $(pwd)
+	"$@" then --verbose | printf "$1"
+x=1 'quoted text' ${HOME} --verbose 2>/dev/null then "$1" "$1" printf 'quoted text'
+		export then && $(pwd) export "$@" readonly
+		2>/dev/null done sed && "$@" grep export | test &&
+		echo "$@" done echo printf readonly 'quoted text'
+	sed awk ${HOME} cd export then local sed readonly x=1 then cd "$@" echo readonly
+-eu done 2>/dev/null done "$1" done readonly readonly
+		&& test x=1 local readonly printf cd export local && ${HOME}
+	local -eu then echo && cd ${HOME} sed done /usr/bin printf --verbose grep /usr/bin
+		export export /usr/bin -eu
+		awk echo export "$@" --verbose printf export
+	readonly export -eu /usr/bin x=1 x=1 "$1" /usr/bin
+'quoted text' && then readonly x=1 'quoted text'
+	| echo printf test cd echo /usr/bin 'quoted text' grep 'quoted text'
+cd echo --verbose sed echo
+	sed echo export ${HOME} |
+	--verbose 2>/dev/null && x=1
+&& done echo awk $(pwd) 'quoted text' cd 2>/dev/null cd -eu local done echo
+then /usr/bin "$1" 'quoted text' echo $(pwd) ${HOME} x=1 awk --verbose
+	echo -eu && x=1 echo then | --verbose "$@" $(pwd) test "$1"
+	echo --verbose done | "$1" /usr/bin echo printf export 2>/dev/null
+local export done && /usr/bin 2>/dev/null $(pwd) test 2>/dev/null awk /usr/bin
+		sed test echo local ${HOME} 'quoted text' then "$@"
+		awk && sed readonly -eu done &&
+"$@" && readonly --verbose "$1" -eu /usr/bin readonly --verbose then -eu
+	x=1 "$@" then ${HOME} 2>/dev/null -eu "$1"
+cd then --verbose "$1" &&
+echo "$@" --verbose then
+	sed ${HOME} | 'quoted text'
+echo printf sed -eu ${HOME} then -eu awk done --verbose local
+	done done local local "$1" readonly local awk readonly local awk 'quoted text'
+| 'quoted text' test ${HOME} && -eu 2>/dev/null test grep $(pwd)
+'quoted text' ${HOME} "$@" /usr/bin sed done 'quoted text'
+		sed then && "$1" done && sed then test x=1 x=1 then done x=1 readonly
+export ${HOME} awk done | /usr/bin | grep printf local awk done cd grep printf
+then 'quoted text' awk "$@" $(pwd) local export
+	'quoted text' | cd | grep 2>/dev/null
+/usr/bin done x=1 && /usr/bin
+	"$@" readonly --verbose cd "$1" "$1" && 'quoted text'
+	local 'quoted text' "$1"
+		done done x=1 sed --verbose && then readonly $(pwd) done /usr/bin awk
+local "$@" export then 'quoted text'
+x=1 /usr/bin -eu --verbose --verbose
+		cd ${HOME} /usr/bin grep grep --verbose grep 2>/dev/null
+	printf cd x=1 grep echo cd readonly 'quoted text' --verbose "$1" readonly
+		grep grep echo $(pwd) 'quoted text' test done done --verbose "$1" &&
+		then awk sed done 'quoted text' --verbose /usr/bin
+		2>/dev/null /usr/bin && awk "$1" $(pwd) x=1 test
+	'quoted text' grep | local done local cd printf $(pwd)
+		-eu readonly sed local cd x=1 echo
+export done printf grep test "$@"
+	| export export local | /usr/bin sed --verbose --verbose | echo then
+	/usr/bin then export readonly ${HOME} local test local test readonly
+sed -eu cd echo then "$@" test ${HOME} /usr/bin printf export "$@" "$@" 'quoted text'
+		echo --verbose cd x=1 "$1" | --verbose &&
+		awk cd export sed 2>/dev/null -eu printf readonly printf then readonly sed
+		"$1" "$@" 2>/dev/null sed && "$1" "$1" "$@" "$1" local
+		/usr/bin /usr/bin ${HOME} test readonly ${HOME} ${HOME} readonly "$@"
+| --verbose grep readonly done "$@" x=1
+		--verbose --verbose then /usr/bin grep --verbose readonly done && --verbose
+		'quoted text' printf && cd
+	$(pwd) x=1 $(pwd) "$@" sed export local done
+		sed echo 'quoted text' 'quoted text' "$@" test awk "$1" "$@" ${HOME} local printf
+&& --verbose grep cd local cd sed /usr/bin sed
+	"$1" test --verbose printf ${HOME} awk printf $(pwd) done local
+	local cd 2>/dev/null x=1 local
+	done test /usr/bin && 'quoted text' echo printf | "$@"
+	export 2>/dev/null grep 2>/dev/null local --verbose then
+test | --verbose done /usr/bin "$1" $(pwd) test awk ${HOME} sed
+then grep then x=1 $(pwd) | && sed done sed export grep test test echo
+	readonly echo "$1" | "$1" /usr/bin -eu then
+		2>/dev/null /usr/bin sed then 'quoted text'
+-eu ${HOME} -eu grep "$@" "$1" ${HOME} sed | /usr/bin then 'quoted text'
+		&& grep 'quoted text' | printf $(pwd) test 2>/dev/null "$@" sed -eu /usr/bin
+		cd echo | "$1" test --verbose sed local $(pwd) printf "$1" sed --verbose
+${HOME} $(pwd) done printf
+		readonly export && echo "$@" export test sed x=1 "$@" cd x=1 cd ${HOME} awk awk
+--verbose "$@" && then -eu
+	echo ${HOME} $(pwd) local echo awk x=1 awk --verbose
+	then awk echo 'quoted text'
+		'quoted text' && 'quoted text' 'quoted text'
+	readonly "$1" 'quoted text' sed $(pwd) grep grep
+		cd -eu export grep cd /usr/bin 2>/dev/null
+	done then sed "$1" grep printf then export
+	grep then "$@" x=1 ${HOME} test -eu 'quoted text' readonly x=1 "$@"
+	awk readonly | | 'quoted text' readonly | 2>/dev/null
+	cd test cd ${HOME} x=1 echo local then 'quoted text' cd && x=1 sed x=1 && grep -eu
+$(pwd) 2>/dev/null sed then x=1 echo | && ${HOME} |
+		-eu 'quoted text' $(pwd) printf x=1 export 'quoted text' "$1" then
+	"$1" -eu then echo awk awk echo
+		sed local -eu awk grep ${HOME}
+printf -eu export 'quoted text' sed cd cd --verbose cd cd
+		then readonly awk 2>/dev/null
+		done x=1 grep local done local
+	grep echo | x=1 -eu --verbose sed "$1" export
+	| test sed && printf test echo ${HOME}
+| ${HOME} --verbose test sed --verbose
+	awk export test "$@" --verbose printf readonly ${HOME} 2>/dev/null
+	echo --verbose export -eu
+grep printf grep ${HOME} && 'quoted text' $(pwd) local local $(pwd) x=1 && local
+2>/dev/null sed sed 'quoted text'
+readonly awk awk cd test && test cd $(pwd) done export then -eu printf
+	awk /usr/bin cd done sed test -eu --verbose local then /usr/bin cd cd "$1" sed
+| 'quoted text' export done sed --verbose
+		export export ${HOME} grep && local $(pwd)
+${HOME} ${HOME} export done
+x=1 printf $(pwd) "$1" -eu printf grep
+	test 2>/dev/null $(pwd) && 'quoted text' && awk local ${HOME} "$@"
+	--verbose awk ${HOME} | && --verbose | $(pwd) 2>/dev/null
+		then --verbose x=1 test "$@" "$@" 'quoted text' "$1" then -eu ${HOME} test done
+/usr/bin --verbose readonly ${HOME}
+		| ${HOME} readonly readonly test
+	local && | echo readonly local --verbose cd printf printf awk 'quoted text' done
+		x=1 cd test local ${HOME} local /usr/bin 'quoted text' cd done
+"$1" -eu echo | grep --verbose x=1 x=1 sed awk |
+		$(pwd) /usr/bin awk /usr/bin done grep cd sed 2>/dev/null test &&
+		sed echo printf ${HOME}
+	awk local "$@" test /usr/bin
+	printf 2>/dev/null done
+		grep ${HOME} -eu done && echo readonly 'quoted text'
+&& echo ${HOME} $(pwd) test 2>/dev/null
+		cd readonly test --verbose --verbose $(pwd) 2>/dev/null --verbose export
+done sed ${HOME} "$@" cd 'quoted text' echo 2>/dev/null && grep
+		sed grep x=1 grep /usr/bin --verbose
+		"$@" done "$1" $(pwd) test x=1 x=1 "$1" local 2>/dev/null 'quoted text'
+	-eu "$@" echo 'quoted text' ${HOME} readonly cd printf grep export | x=1
+sed | "$@" export -eu then
+then && echo "$1" && && && export "$@" /usr/bin then echo done cd
+		export awk readonly "$1" /usr/bin sed done --verbose "$1" /usr/bin export readonly
+		"$1" test echo "$1" "$@" "$1" export readonly 'quoted text'
+		cd 2>/dev/null done awk && export $(pwd)
+	cd grep && ${HOME} awk -eu -eu grep
+export "$1" 2>/dev/null export /usr/bin
+"$1" printf echo ${HOME}
+	${HOME} 2>/dev/null then
+	"$1" x=1 && --verbose then && $(pwd) awk "$1" test -eu test x=1
+		printf echo 'quoted text' readonly |
+		x=1 then --verbose readonly
+		"$1" ${HOME} readonly printf done sed -eu "$1" grep
+x=1 && then $(pwd) "$@" export 'quoted text' printf
+		x=1 --verbose test export readonly /usr/bin ${HOME}
+$(pwd) test "$1" awk --verbose local -eu "$1" test && then awk echo $(pwd) "$1"
+	printf && --verbose printf readonly awk printf &&
+&& 'quoted text' x=1 sed x=1 | then 'quoted text' | && echo export
+		done then 2>/dev/null "$@" 2>/dev/null test
+		-eu --verbose local --verbose printf done 'quoted text'
+		${HOME} /usr/bin /usr/bin
+then /usr/bin readonly x=1
+	test export "$@" cd done test && cd ${HOME} readonly
+		-eu printf x=1 cd && && "$@" export "$@" done $(pwd)
+	then printf sed && grep /usr/bin grep "$@"
+		"$@" x=1 printf done "$1" cd
+"$1" /usr/bin echo done x=1 "$@" local done ${HOME} $(pwd) $(pwd)
+	grep && | ${HOME} && printf 'quoted text' readonly awk 2>/dev/null
+	/usr/bin | "$1" && | export -eu
+readonly local printf $(pwd) sed done printf 'quoted text' export 'quoted text'
+test "$@" grep 'quoted text' 'quoted text' x=1 "$@"
+$(pwd) local /usr/bin sed /usr/bin cd | $(pwd) /usr/bin 'quoted text'
+		readonly readonly local 'quoted text'
+		/usr/bin ${HOME} export &&
+	$(pwd) readonly echo done $(pwd) echo printf printf && readonly export sed
+	awk cd ${HOME} local 'quoted text' printf | | readonly x=1 'quoted text'
+	2>/dev/null export cd then 'quoted text'
+		-eu readonly done 'quoted text'
+x=1 cd $(pwd) cd then then | done readonly readonly | | ${HOME} 2>/dev/null
+cd then cd x=1 /usr/bin sed cd awk --verbose x=1 "$1"
+| cd cd -eu echo 2>/dev/null 'quoted text' /usr/bin "$@" local "$1"
+2>/dev/null "$1" 2>/dev/null ${HOME}
+| $(pwd) test cd awk sed then x=1 'quoted text' awk $(pwd) grep readonly
+		local done && readonly 'quoted text' | export local 'quoted text' cd done
+	"$@" x=1 -eu sed done /usr/bin
+		"$@" -eu readonly local ${HOME}
+sed cd export awk "$1" ${HOME} x=1 "$@" --verbose /usr/bin
+grep $(pwd) -eu local printf echo "$1" cd
+		"$@" 'quoted text' /usr/bin test && sed done test
+		&& local | readonly $(pwd) 'quoted text' $(pwd) 'quoted text' "$@" 'quoted text'
+		| --verbose --verbose $(pwd) echo 'quoted text' sed printf done $(pwd)
+	'quoted text' /usr/bin then -eu
+		grep /usr/bin | "$@" | export echo && done export test
+--verbose grep export "$1"
+		'quoted text' readonly /usr/bin "$@"
+	| then x=1 ${HOME} && readonly done echo grep test export
+	cd -eu echo awk echo 'quoted text' local /usr/bin
+	"$@" grep | && | awk grep $(pwd) grep $(pwd) "$@" $(pwd)
+	x=1 export local | ${HOME} $(pwd) 2>/dev/null readonly
+	| x=1 printf 2>/dev/null printf 2>/dev/null x=1 sed
+echo | grep echo /usr/bin "$1" grep "$@" test awk "$1" test
+	"$1" 'quoted text' ${HOME} -eu $(pwd)
+grep /usr/bin && grep test grep "$@" 2>/dev/null
+cd test cd /usr/bin "$1" echo ${HOME}
+		done 'quoted text' && x=1 readonly ${HOME} && && grep then 'quoted text'
+	$(pwd) --verbose done -eu grep 'quoted text' test export
+	x=1 test grep done then 'quoted text' done
+	${HOME} x=1 sed 2>/dev/null local
+		then grep then /usr/bin ${HOME} test test test sed
+	-eu ${HOME} export local 'quoted text' grep /usr/bin export "$1" --verbose
+done 2>/dev/null $(pwd) test ${HOME} x=1 sed ${HOME} grep
+		x=1 awk grep sed readonly then done | done $(pwd)
+	cd done cd done && | grep echo awk done local
+		&& sed | | echo && ${HOME} echo ${HOME}
+		${HOME} done printf /usr/bin sed grep awk 2>/dev/null "$@" done x=1 --verbose
+echo /usr/bin export test test then
+2>/dev/null 2>/dev/null grep 2>/dev/null local cd test $(pwd) local --verbose
+		export awk ${HOME} ${HOME} printf "$@" printf 2>/dev/null
+2>/dev/null readonly grep "$1"
+		'quoted text' test && awk ${HOME} then sed && test export grep | awk | "$@" awk
+printf export grep then | awk printf grep /usr/bin readonly
+	done cd printf grep x=1 done export test sed then 2>/dev/null
+local readonly test "$@" cd
+	$(pwd) echo awk | --verbose printf
+		grep ${HOME} /usr/bin done "$1" awk then awk "$@" 2>/dev/null
+cd test cd test | sed | cd 2>/dev/null
+	| "$@" then sed 2>/dev/null x=1 cd sed echo test "$1" "$@" | "$@"
+		-eu -eu test -eu -eu x=1 awk 'quoted text' test test readonly 'quoted text'
+	$(pwd) "$@" export && test grep /usr/bin awk && echo test done grep cd
+		x=1 awk readonly -eu printf awk "$1" grep
+		echo 'quoted text' done echo grep -eu 2>/dev/null sed
+		-eu then test export test x=1
+	-eu -eu export echo && ${HOME} ${HOME} then
+sed x=1 export printf then --verbose
+		'quoted text' x=1 cd printf "$1" local printf
+	grep echo export -eu 2>/dev/null
+	local --verbose local $(pwd) sed readonly export readonly grep then awk readonly
+-eu -eu echo awk --verbose done 'quoted text' awk echo --verbose test "$@" "$@"
+		'quoted text' readonly --verbose echo export echo then ${HOME}
+	then -eu "$1" printf 2>/dev/null
+		/usr/bin echo "$@" then grep ${HOME} cd "$@" /usr/bin awk 2>/dev/null x=1 'quoted text'
+then /usr/bin printf /usr/bin awk $(pwd)
+		grep 'quoted text' awk "$@" /usr/bin cd then -eu awk --verbose echo
+	"$@" x=1 /usr/bin sed test "$@" ${HOME} printf grep readonly
+		printf | 'quoted text'
+	"$1" "$1" "$@" 'quoted text' ${HOME} -eu "$1" /usr/bin printf then && export printf
+	sed sed --verbose $(pwd) $(pwd) /usr/bin
+--verbose local $(pwd) "$@" -eu then x=1 printf 'quoted text' 'quoted text'
+	export cd echo local readonly test cd /usr/bin x=1 awk export x=1 2>/dev/null ${HOME}
+	"$@" --verbose $(pwd) export readonly local done done printf "$@" 'quoted text'
+echo 2>/dev/null $(pwd) local | $(pwd) /usr/bin export
+		${HOME} 2>/dev/null export ${HOME} 2>/dev/null then ${HOME} sed
+	"$1" -eu x=1 --verbose then test $(pwd) readonly
+	"$@" grep $(pwd) printf awk $(pwd)
+		"$1" | export /usr/bin && test
+		grep sed then 2>/dev/null -eu then export
+$(pwd) grep cd cd sed cd | --verbose 2>/dev/null "$@"
+	"$@" printf "$1" ${HOME} 'quoted text'
+		echo awk printf -eu cd export --verbose local grep && --verbose cd echo
+		then x=1 $(pwd) -eu |
+		export local -eu awk local /usr/bin test awk $(pwd) -eu /usr/bin
+&& $(pwd) sed echo done --verbose echo && /usr/bin &&
+	2>/dev/null done -eu export cd then echo -eu "$1" 2>/dev/null
+		printf -eu ${HOME} /usr/bin awk 2>/dev/null
+	then echo -eu /usr/bin --verbose
+		then readonly $(pwd) readonly ${HOME} "$@" printf done /usr/bin grep export
+x=1 test then done readonly ${HOME} echo awk --verbose
+		local grep $(pwd) printf printf | done done awk x=1 "$1" readonly
+		readonly 2>/dev/null done 2>/dev/null cd export
+		--verbose awk cd cd -eu local | printf "$@" $(pwd) test | test done
+		-eu ${HOME} done echo test --verbose readonly "$@" $(pwd) echo sed grep "$@" echo
+	${HOME} then ${HOME} grep ${HOME} local grep test && "$@" test sed
+	x=1 grep "$@" x=1 'quoted text' 2>/dev/null 'quoted text' /usr/bin "$@"
+		${HOME} && /usr/bin awk then && x=1 readonly x=1 -eu done && 'quoted text'
+		"$1" x=1 x=1 printf awk readonly
+		cd test --verbose /usr/bin x=1 done export cd $(pwd) && grep done
+cd /usr/bin awk sed "$@" "$@" "$@" grep grep /usr/bin 2>/dev/null $(pwd) test
+done 2>/dev/null sed /usr/bin printf
+&& then /usr/bin && test "$1" echo grep | && | printf cd
+	then readonly 2>/dev/null echo | -eu -eu readonly cd sed -eu test "$@" "$1" done
+		x=1 2>/dev/null x=1 sed && grep 2>/dev/null /usr/bin ${HOME} 'quoted text'
+done -eu export done sed sed && done grep | -eu
+--verbose readonly sed sed
+	sed 2>/dev/null --verbose done export "$1"
+	"$@" export local test awk readonly
+		"$1" --verbose --verbose | sed echo sed x=1 local
+		-eu grep cd -eu local 'quoted text' ${HOME} $(pwd) export -eu readonly
+	${HOME} $(pwd) "$1" "$1" 2>/dev/null echo /usr/bin "$@" $(pwd)
+		&& test "$1" && printf printf grep grep grep -eu ${HOME} sed
+		${HOME} grep printf done then sed && readonly echo 2>/dev/null printf -eu
+		grep $(pwd) then cd grep /usr/bin export
+		printf local test --verbose sed test local -eu cd export awk cd x=1 &&
+	done echo 'quoted text' && done /usr/bin sed --verbose -eu done
+	test $(pwd) echo | ${HOME} ${HOME} $(pwd)
+		/usr/bin 2>/dev/null -eu ${HOME} 2>/dev/null
+		"$1" --verbose x=1 --verbose sed | done echo readonly awk /usr/bin 'quoted text'
+	x=1 2>/dev/null test && --verbose printf "$@" --verbose
+export "$1" -eu $(pwd) | awk --verbose then | then x=1 awk grep test
+		printf sed awk grep /usr/bin
+	$(pwd) export sed local awk sed $(pwd) echo sed /usr/bin
+	test "$1" | sed $(pwd) -eu "$@" 2>/dev/null 2>/dev/null awk
+awk | "$@" --verbose /usr/bin
+2>/dev/null grep --verbose "$@" echo grep
+		'quoted text' "$1" "$@" "$1" 2>/dev/null
+	x=1 cd ${HOME} --verbose x=1 cd ${HOME} -eu echo local done
+		"$1" done 2>/dev/null cd
+		x=1 2>/dev/null test local -eu -eu
+		-eu "$1" --verbose $(pwd) "$@" cd
+"$@" export "$@" echo test grep --verbose local | "$1"
+		/usr/bin local 'quoted text' sed x=1 | | "$1" | cd done /usr/bin sed
+--verbose awk grep awk then 2>/dev/null
+		grep 2>/dev/null --verbose "$@" /usr/bin $(pwd) echo cd grep sed |
+	&& then -eu printf x=1 -eu --verbose && local echo 2>/dev/null 'quoted text'
+&& printf done && "$1" -eu
+	x=1 printf export export
+readonly ${HOME} grep then /usr/bin printf | then
+	cd cd export && sed && | grep | readonly
+		then echo local echo $(pwd) done then then 2>/dev/null &&
+	/usr/bin sed local grep printf cd printf
+"$@" | readonly readonly x=1 ${HOME}
+/usr/bin local done ${HOME} -eu | local done
+		done | test done 'quoted text' $(pwd) --verbose export
+		&& "$1" echo done && | "$@" awk "$@" test
+		export x=1 printf $(pwd)
+	-eu grep --verbose /usr/bin test ${HOME} ${HOME} "$@" sed 'quoted text'
+		"$1" readonly && awk grep test | ${HOME}
+	--verbose readonly printf | "$1" local x=1 "$@" awk then 'quoted text'
+	"$1" 2>/dev/null then cd
+		then ${HOME} local done "$@" test done done 'quoted text' sed done
+	done export && done "$1" awk && grep | printf cd export
+	-eu ${HOME} then ${HOME} grep test "$@" "$@" readonly cd 'quoted text'
+		'quoted text' awk echo readonly
+	then then x=1 then readonly
+	readonly cd local readonly cd grep "$1" ${HOME} printf then
+		awk cd "$1" /usr/bin local done $(pwd) "$@" test x=1 grep export
+	"$@" cd 2>/dev/null readonly | | echo then cd $(pwd) x=1 | grep --verbose
+-eu "$@" local export readonly 'quoted text'
+	| | x=1 test grep x=1 grep cd | --verbose "$1" 2>/dev/null /usr/bin
+	local export ${HOME} export 'quoted text'
+		"$@" local sed /usr/bin $(pwd)
+		echo readonly test "$@" --verbose local 'quoted text'
+		sed grep export echo cd export 2>/dev/null
+	local 2>/dev/null then $(pwd) done "$1" $(pwd) echo cd --verbose "$1"
+local echo test $(pwd) "$1" done | export 'quoted text'
+		sed awk cd /usr/bin "$@"
+	printf local grep readonly printf "$@" /usr/bin "$@" test test
+	grep -eu local | --verbose echo echo | done printf 'quoted text'
+echo done grep --verbose x=1 $(pwd)
+--verbose done -eu $(pwd) "$1" test local done local awk done "$1" x=1 export
+	&& -eu 2>/dev/null sed | --verbose --verbose --verbose ${HOME}
+export readonly 'quoted text'
+		-eu local then | then /usr/bin grep
+		"$1" 'quoted text' cd 2>/dev/null && then "$1" grep cd
+		export /usr/bin -eu local local then readonly && awk export && echo export awk
+	export readonly 2>/dev/null
+		grep printf readonly "$1" --verbose $(pwd)
+-eu "$@" ${HOME} "$1" then then local awk 2>/dev/null
+${HOME} /usr/bin grep sed 2>/dev/null "$1" test 2>/dev/null x=1 sed
+	done --verbose test /usr/bin local -eu --verbose 2>/dev/null
+	$(pwd) done test printf sed echo local grep
+		${HOME} cd test export && printf cd echo then sed
+	test local cd test 'quoted text' && grep $(pwd) -eu /usr/bin
+printf $(pwd) | | 'quoted text' printf export printf printf export -eu
+then 'quoted text' | export
+		"$@" grep test then 'quoted text' test -eu cd ${HOME} readonly
+	$(pwd) /usr/bin /usr/bin sed local 'quoted text' ${HOME}
+		cd ${HOME} --verbose printf --verbose 2>/dev/null x=1
+		cd | readonly readonly then 'quoted text' awk && grep
+	'quoted text' $(pwd) grep grep printf grep sed cd then then export |
+	printf echo 2>/dev/null local $(pwd) cd x=1 done then local awk /usr/bin done readonly
+	2>/dev/null readonly echo printf ${HOME} ${HOME} ${HOME} -eu 2>/dev/null awk cd
+grep done export ${HOME} 'quoted text' $(pwd) grep local
+	&& done grep x=1 sed "$1" grep readonly $(pwd) --verbose x=1 && sed awk
+	${HOME} readonly local $(pwd) printf cd awk cd "$1" echo readonly test local readonly
+sed printf printf printf 2>/dev/null
+done | 'quoted text' awk test ${HOME} $(pwd) export grep readonly test grep
+printf 'quoted text' sed && 'quoted text'
+	-eu x=1 && x=1 readonly /usr/bin | awk printf "$@" "$1" x=1 | done readonly
+/usr/bin test echo --verbose
+		/usr/bin $(pwd) echo x=1 awk sed export grep 2>/dev/null
+		cd echo x=1 "$@" echo awk local then 'quoted text' then
+export $(pwd) && --verbose awk printf readonly
+x=1 | ${HOME} cd awk --verbose
+$(pwd) ${HOME} x=1 'quoted text'
+--verbose local | test && 2>/dev/null
+	cd 'quoted text' x=1 --verbose local printf echo
+		awk "$1" cd done -eu 2>/dev/null
+	test done -eu "$@" readonly | 'quoted text' "$@" | 2>/dev/null then echo grep
+	then --verbose export x=1 ${HOME} ${HOME} | 'quoted text' done "$@"
+	cd test 2>/dev/null && | x=1
+${HOME} local 2>/dev/null "$@" 2>/dev/null /usr/bin test ${HOME}
+	$(pwd) readonly echo echo readonly ${HOME}
+		-eu 'quoted text' 'quoted text' echo /usr/bin $(pwd) awk cd printf local awk
+	echo -eu | local then local test | ${HOME}
+	-eu awk --verbose export
+/usr/bin --verbose done "$1" test "$1" grep
+	'quoted text' readonly export /usr/bin echo sed test cd --verbose then
+cd -eu 'quoted text' then test cd "$@" sed echo | cd $(pwd)
+	2>/dev/null cd -eu | /usr/bin
+awk local test printf | awk printf "$@" x=1 readonly 2>/dev/null
+		x=1 x=1 "$1" done $(pwd) test done
+	&& ${HOME} --verbose && export "$@" echo
+		&& 2>/dev/null printf 2>/dev/null test
+	/usr/bin $(pwd) cd awk ${HOME} cd grep grep test 2>/dev/null grep /usr/bin "$@"
+	'quoted text' -eu "$1" "$@" $(pwd) done && 2>/dev/null export local sed
+	2>/dev/null done "$1" x=1 && 2>/dev/null sed && local $(pwd) done /usr/bin export
+		$(pwd) ${HOME} then "$@" done awk done readonly "$@" --verbose printf "$1" &&
+/usr/bin export export /usr/bin "$@" ${HOME}
+done cd done test test then test then x=1 $(pwd) "$@" 2>/dev/null x=1 /usr/bin
+	'quoted text' awk printf
+	test test awk -eu && --verbose then echo awk local
+2>/dev/null | 'quoted text' readonly sed grep export
+--verbose ${HOME} local echo readonly $(pwd) echo sed export
+		2>/dev/null --verbose test "$1"
+2>/dev/null readonly echo
+	done /usr/bin cd grep done "$@" /usr/bin 2>/dev/null
+	test cd ${HOME} done x=1 --verbose readonly
+	/usr/bin | /usr/bin done awk printf
+awk local "$1" -eu 2>/dev/null cd awk
+	--verbose x=1 && done grep done --verbose
+"$@" cd --verbose | /usr/bin ${HOME} sed -eu done 2>/dev/null
+	done printf echo | printf
+grep done 'quoted text' readonly 'quoted text'
+	/usr/bin readonly --verbose local 2>/dev/null x=1 test then test 2>/dev/null
+	readonly export cd | sed grep local
+		"$1" echo then echo x=1 "$1" cd readonly awk awk export sed ${HOME} awk
+	local awk sed -eu local done ${HOME} 2>/dev/null printf then ${HOME} awk printf
+		| then --verbose x=1 grep "$1" test awk x=1 --verbose sed "$1" /usr/bin
+	&& -eu printf 2>/dev/null 'quoted text'
+awk printf local readonly
+	2>/dev/null readonly /usr/bin sed then x=1 awk printf awk
+printf x=1 local sed /usr/bin awk "$@" x=1
+	"$1" "$@" echo printf 'quoted text' cd && readonly --verbose sed readonly sed export
+		readonly x=1 'quoted text' /usr/bin awk "$@" local 'quoted text'
+		echo "$@" -eu done printf readonly && --verbose
+		local local grep readonly
+	test done && test then sed awk --verbose grep sed "$1" export
+	export -eu echo x=1 then /usr/bin grep grep x=1 "$@" 'quoted text'
+echo x=1 x=1 sed $(pwd) test test -eu sed cd cd grep local "$1" $(pwd) -eu done
+		${HOME} /usr/bin ${HOME} 2>/dev/null -eu "$1" "$@" ${HOME}
+	/usr/bin export && export done "$1" | sed done
+		$(pwd) local | x=1 && printf
+		done x=1 cd printf cd sed export awk "$@" "$@" done then 'quoted text' x=1 done
+	/usr/bin -eu sed /usr/bin --verbose sed grep
+	printf "$@" 2>/dev/null echo 'quoted text' readonly
+	"$@" export grep export /usr/bin && test | $(pwd) "$@" --verbose
+	| /usr/bin 2>/dev/null readonly 2>/dev/null cd then done done ${HOME} test
+	&& cd done cd /usr/bin test 2>/dev/null export --verbose 2>/dev/null done local
+		awk --verbose x=1 /usr/bin grep
+echo -eu --verbose awk echo | export
+		${HOME} "$@" readonly readonly x=1 test
+	cd | | && printf "$@" 2>/dev/null $(pwd) local cd
+		sed readonly "$@" awk sed "$@" cd $(pwd) then
+grep local awk $(pwd) local grep grep 'quoted text'
+test grep awk sed readonly 2>/dev/null -eu -eu echo sed 2>/dev/null printf
+	&& && | readonly done sed | ${HOME} awk /usr/bin | done
+	2>/dev/null 'quoted text' x=1 sed /usr/bin && x=1 test
+	&& done sed -eu "$@" | grep "$1" export awk /usr/bin echo /usr/bin
+"$@" local test awk export
+echo $(pwd) --verbose | x=1 'quoted text' --verbose echo awk -eu x=1 grep 'quoted text'
+	awk readonly ${HOME} 'quoted text' "$1" 2>/dev/null then sed cd x=1
+	--verbose ${HOME} done "$1"
+	2>/dev/null | 'quoted text' $(pwd) local echo printf test 'quoted text' printf
+x=1 done grep && printf ${HOME} 2>/dev/null |
+cd x=1 $(pwd) awk awk | test test "$@" export
+		"$@" printf grep local export test x=1 echo echo "$1" export
+	$(pwd) done cd export readonly
+		local /usr/bin --verbose -eu | echo ${HOME} local x=1 x=1 then /usr/bin readonly
+x=1 "$@" 'quoted text' "$@" 2>/dev/null | export
+		done local 'quoted text' awk
+		x=1 export sed 2>/dev/null | -eu echo cd x=1
+2>/dev/null done readonly echo /usr/bin test grep --verbose x=1 "$@" --verbose
+	| readonly local printf
+	${HOME} "$@" && "$1" grep $(pwd) sed /usr/bin /usr/bin sed echo
+	-eu x=1 -eu readonly export
+	-eu $(pwd) awk -eu sed done export
+x=1 x=1 x=1 && && 2>/dev/null $(pwd) ${HOME} echo 2>/dev/null
+then ${HOME} grep grep cd "$@" awk
+		export local /usr/bin readonly 'quoted text'
+printf echo export "$@" "$1" --verbose awk 'quoted text'
+		--verbose then /usr/bin $(pwd) then ${HOME}
+		done /usr/bin readonly test test done done
+	export 'quoted text' awk awk done
+		2>/dev/null awk cd printf "$1" --verbose
+	2>/dev/null "$1" local --verbose sed export
+		"$@" test cd readonly export awk "$@" $(pwd) -eu then "$1" x=1 'quoted text' echo
+	&& && && --verbose $(pwd) --verbose
+	awk test && "$1" | readonly --verbose 2>/dev/null
+	readonly ${HOME} then then --verbose
+	export 2>/dev/null "$@" sed
+		'quoted text' | echo -eu test --verbose ${HOME}
+		"$1" cd then | ${HOME} then export readonly 2>/dev/null test --verbose
+		done awk ${HOME} ${HOME} x=1 "$@" -eu test | "$1" done readonly
+then test grep 2>/dev/null cd echo grep 'quoted text' cd "$@" "$1" -eu && 2>/dev/null
+printf ${HOME} echo export
+	"$1" x=1 "$1" local done local 'quoted text' ${HOME} x=1 grep
+sed /usr/bin -eu --verbose "$@" /usr/bin then | export | -eu then local
+awk ${HOME} cd 2>/dev/null $(pwd) cd sed -eu echo done && | readonly && -eu ${HOME}
+		--verbose sed 2>/dev/null 'quoted text' $(pwd)
+		readonly done --verbose /usr/bin --verbose readonly local $(pwd) sed echo grep
+	awk test ${HOME} -eu /usr/bin 2>/dev/null --verbose export
+	$(pwd) "$@" readonly /usr/bin
+		"$1" readonly "$@" /usr/bin cd "$1" echo 2>/dev/null 2>/dev/null
+		${HOME} /usr/bin echo cd printf printf "$@" cd sed --verbose -eu x=1
+	readonly /usr/bin -eu --verbose x=1 export 'quoted text' /usr/bin
+"$1" sed /usr/bin --verbose
+local | echo test 'quoted text' printf --verbose $(pwd)
+	2>/dev/null sed done cd && readonly /usr/bin
+	&& done $(pwd) ${HOME}
+		/usr/bin && readonly test cd export
+	echo cd 'quoted text' "$@" echo && x=1 | awk | $(pwd)
+		then && test | local done "$1"
+-eu | ${HOME} then | 'quoted text'
+	x=1 readonly readonly awk echo awk test 2>/dev/null
+	&& local "$1" test "$1" readonly local echo "$@" && done
+	done "$@" 2>/dev/null "$@" --verbose
+	&& grep -eu printf --verbose 2>/dev/null done && $(pwd)
+done local x=1 done test sed /usr/bin
+		grep export then test sed && done then /usr/bin done "$1" then "$1" x=1 x=1
+		$(pwd) local printf ${HOME} test readonly
+&& test awk x=1 sed readonly grep test printf
+$(pwd) echo local printf /usr/bin cd
+		done "$@" -eu ${HOME} grep x=1 "$1" ${HOME} /usr/bin ${HOME}
+	readonly sed readonly
+'quoted text' x=1 local
+		/usr/bin cd local grep --verbose done && test ${HOME} grep
+		awk awk ${HOME} local then grep test sed then 2>/dev/null printf echo
+readonly awk && "$1" "$1" x=1 x=1 grep cd -eu export printf
+		test | printf --verbose x=1 cd then --verbose awk test "$1" echo /usr/bin ${HOME}
+$(pwd) done grep echo "$@" test export done x=1 /usr/bin
+	export /usr/bin export export sed | $(pwd) 2>/dev/null x=1 2>/dev/null
+	echo echo test "$1" 'quoted text' 2>/dev/null
+	${HOME} export done grep x=1 local -eu && x=1 awk printf done 2>/dev/null
+	cd | $(pwd) x=1 x=1 $(pwd) "$@" then test echo awk readonly awk
+export local /usr/bin test "$1"
+"$1" done "$1" && cd grep /usr/bin
+		cd echo printf /usr/bin awk awk && sed | ${HOME} 2>/dev/null awk then local
+	cd --verbose | local 'quoted text' "$@" cd then
+		'quoted text' export 2>/dev/null done
+		-eu then printf -eu then local ${HOME} && 'quoted text' 2>/dev/null
+	x=1 sed && "$1" && done readonly 'quoted text' readonly printf export
+printf awk "$1" readonly "$1" done -eu
+then readonly sed awk echo local | test sed | --verbose /usr/bin
+		2>/dev/null export export ${HOME} readonly local
+	${HOME} sed --verbose /usr/bin awk awk && awk $(pwd)
+	then --verbose then 2>/dev/null "$@" local
+	$(pwd) && "$@" grep cd test cd | | --verbose readonly ${HOME} grep
+then then $(pwd) sed && x=1 "$@"
+export -eu $(pwd) awk -eu $(pwd) readonly local cd $(pwd)
+	| x=1 'quoted text' $(pwd) "$1" $(pwd) sed sed |
+	then && $(pwd) | ${HOME}
+		${HOME} "$@" 'quoted text' --verbose awk grep then awk sed "$@" 'quoted text' -eu
+"$@" "$1" ${HOME} "$1" 'quoted text' x=1 && printf
+	sed 'quoted text' $(pwd)
+	test readonly 2>/dev/null -eu grep | -eu test | awk
+		awk "$1" cd readonly cd --verbose
+	"$@" && ${HOME} "$1" then | $(pwd)
+sed $(pwd) /usr/bin x=1 $(pwd) then ${HOME} readonly
+	-eu x=1 ${HOME} 2>/dev/null x=1 readonly "$@"
+	test x=1 x=1 'quoted text' awk test $(pwd) | "$1" | -eu done
+| /usr/bin awk readonly x=1 export "$1" awk "$@" test done |
+	cd readonly "$@" local x=1 2>/dev/null "$@" printf x=1 $(pwd) --verbose
+awk sed test ${HOME} $(pwd) --verbose
+	export readonly export export --verbose 2>/dev/null test awk ${HOME} grep
+	test awk grep ${HOME} export echo
+		local /usr/bin "$@" /usr/bin "$1" awk $(pwd) export readonly "$@"
+		awk sed --verbose echo readonly sed $(pwd) "$1" "$@" --verbose
+--verbose x=1 "$1" echo ${HOME} awk /usr/bin ${HOME} && local
+		$(pwd) printf local local | test 'quoted text' export readonly /usr/bin sed test
+--verbose $(pwd) "$1" /usr/bin 2>/dev/null "$1" --verbose ${HOME}
+		--verbose printf echo 'quoted text' sed $(pwd) $(pwd) test awk ${HOME}
+	$(pwd) local readonly $(pwd) --verbose grep 'quoted text' sed local awk
+		"$@" && $(pwd) echo 2>/dev/null $(pwd) && /usr/bin
+echo export grep "$1" 'quoted text' awk "$@" readonly
+	2>/dev/null /usr/bin export cd -eu readonly readonly && echo sed readonly
+	--verbose readonly 'quoted text' then printf
+		export -eu echo grep "$@" && "$1"
+	grep -eu ${HOME} grep sed && ${HOME} done --verbose cd sed
+--verbose "$@" -eu "$@" then "$1" echo done echo && 'quoted text'
+		grep awk 'quoted text' "$1" && 'quoted text' --verbose
+	"$1" cd sed x=1 sed "$1"
+		/usr/bin test "$1" "$1" 2>/dev/null
+		readonly -eu test --verbose then && echo echo "$1"
+	test sed /usr/bin export "$1" cd cd then
+echo && -eu $(pwd) 'quoted text' 'quoted text' ${HOME} readonly then cd cd 'quoted text'
+sed done then ${HOME} export --verbose 'quoted text'
+	&& x=1 readonly 'quoted text' sed /usr/bin readonly x=1 $(pwd) /usr/bin cd
+echo ${HOME} 'quoted text' -eu sed test readonly done readonly done --verbose
+grep local ${HOME} | x=1 done readonly readonly
+cd /usr/bin -eu "$@" cd x=1 x=1 $(pwd)
+		2>/dev/null -eu /usr/bin sed echo
+readonly local -eu awk readonly
+-eu --verbose readonly
+-eu -eu x=1 ${HOME} "$1" x=1 --verbose export "$@" --verbose
+	sed 2>/dev/null then sed 2>/dev/null export /usr/bin cd "$1" "$1"
+$(pwd) test cd done -eu cd --verbose x=1 | $(pwd) printf echo
+	'quoted text' "$1" | x=1 x=1 ${HOME} local "$@" | && test /usr/bin
+printf "$@" 2>/dev/null "$1" printf
+awk cd --verbose ${HOME} local echo ${HOME} ${HOME} then readonly then
+	awk local sed "$1" && done "$1" --verbose printf -eu
+	| printf $(pwd) then awk local x=1 grep
+		done then then 2>/dev/null awk | | export --verbose export "$@" printf
+	local readonly -eu done readonly && x=1 | -eu done done
+		"$@" printf 'quoted text' printf "$1" && cd
+		export 'quoted text' grep
+		export 'quoted text' awk export
+		'quoted text' sed done && echo cd awk readonly
+| 'quoted text' echo awk then local local "$1" /usr/bin
+	done grep echo 'quoted text' grep then /usr/bin "$1" | x=1 /usr/bin -eu --verbose
+	cd done test grep $(pwd) x=1 "$@" "$1" cd local then ${HOME}
+		test done sed readonly "$@" -eu ${HOME} echo grep "$1" /usr/bin
+		${HOME} done cd "$1" x=1 --verbose | | "$1" --verbose -eu done
+		/usr/bin && x=1 printf --verbose --verbose export readonly
+	echo cd sed ${HOME} done
+		x=1 readonly && | && x=1 ${HOME}
+done "$1" awk /usr/bin 'quoted text' local x=1 printf 2>/dev/null "$@"
+echo 2>/dev/null 2>/dev/null local test "$1" then printf
+echo 2>/dev/null sed &&
+	echo 'quoted text' sed ${HOME} test "$1" "$1" "$@" sed 2>/dev/null
+	"$1" x=1 local printf local && then ${HOME} 2>/dev/null done
+		/usr/bin grep "$1" /usr/bin x=1 'quoted text' x=1 2>/dev/null
+		cd "$@" grep sed export readonly 2>/dev/null sed
+	x=1 sed $(pwd) grep cd awk readonly
+test local x=1 && "$1" printf x=1 printf done -eu 'quoted text'
+/usr/bin readonly 2>/dev/null
+		&& && sed -eu printf export | "$@" -eu then x=1 sed
+cd x=1 2>/dev/null local grep x=1 done && -eu /usr/bin x=1 printf printf &&
+		then then local $(pwd) 2>/dev/null grep
+	$(pwd) "$@" cd done 'quoted text'
+		sed local | awk printf "$@"
+x=1 test --verbose 2>/dev/null "$1"
+		awk "$@" $(pwd) test x=1 sed "$1" --verbose then then "$@" 2>/dev/null && &&
+	x=1 ${HOME} /usr/bin sed export then "$1" 'quoted text'
+		"$1" -eu ${HOME} local | readonly readonly x=1 x=1 $(pwd) | done $(pwd) $(pwd)
+2>/dev/null awk "$@" x=1 | "$1" printf x=1 grep && x=1 sed --verbose ${HOME}
+		-eu "$@" awk local x=1 done echo --verbose 2>/dev/null --verbose
+		"$@" | -eu x=1 x=1 "$1" "$1" "$1" 2>/dev/null 'quoted text' "$1" grep
+		'quoted text' awk export && readonly test $(pwd)
+	done export local printf ${HOME} "$@" local $(pwd) /usr/bin
+	x=1 local /usr/bin --verbose sed ${HOME} grep test 'quoted text' echo
+	test "$1" $(pwd) cd local readonly /usr/bin sed echo && ${HOME} printf echo "$@"
+		"$1" printf && export 2>/dev/null sed grep
+	| readonly 2>/dev/null 2>/dev/null readonly ${HOME} /usr/bin printf test
+	readonly local test -eu 'quoted text' "$@" export "$@"
+/usr/bin | x=1 x=1 grep --verbose
+	sed printf x=1 | printf done /usr/bin "$1" test local
+	'quoted text' test | &&
+local /usr/bin cd | local readonly 'quoted text' --verbose $(pwd) awk export
+	2>/dev/null test --verbose x=1 test ${HOME}
+		--verbose "$@" 2>/dev/null --verbose "$@" && x=1 awk done done test --verbose
+	local export done && /usr/bin awk readonly readonly
+sed grep test printf grep /usr/bin "$@" | test && then sed && "$1" then cd | 'quoted text'
+${HOME} grep --verbose printf 'quoted text' then 'quoted text' echo printf
+	"$@" | "$1" x=1 awk ${HOME} sed "$1"
+	"$@" local ${HOME} export && grep
+	-eu "$@" /usr/bin -eu awk /usr/bin cd
+		&& $(pwd) readonly ${HOME} test echo "$@" "$@" "$1" $(pwd) local
+-eu ${HOME} ${HOME} 2>/dev/null && test | export
+		awk readonly echo grep 2>/dev/null $(pwd) --verbose ${HOME} "$1"
+"$@" readonly awk | printf done x=1 echo printf -eu /usr/bin /usr/bin
+	--verbose test 2>/dev/null done then 'quoted text'
+awk 2>/dev/null /usr/bin -eu export
+	"$1" 2>/dev/null "$@" --verbose awk --verbose 2>/dev/null
+| awk test -eu local sed -eu -eu done readonly local -eu done printf | then sed
+done /usr/bin ${HOME} done local printf
+		awk grep then local echo "$1" ${HOME} printf export readonly /usr/bin /usr/bin
+	then done grep $(pwd) --verbose ${HOME} "$@" -eu export export
+		sed "$@" local && "$1" cd done readonly
+		&& | $(pwd) $(pwd) awk done sed grep
+		/usr/bin -eu echo done "$@" x=1 "$@" | echo --verbose
+		2>/dev/null test then printf
+		-eu printf && --verbose ${HOME}
+	"$1" sed --verbose | printf
+		done ${HOME} 2>/dev/null
+test echo && echo x=1 done x=1
+		/usr/bin sed && /usr/bin local export done grep grep --verbose test
+cd awk /usr/bin export then ${HOME} grep then && ${HOME}
+		done 'quoted text' cd then awk "$@"
+readonly /usr/bin sed /usr/bin /usr/bin && awk export cd cd readonly
+		&& x=1 then 2>/dev/null cd cd /usr/bin awk local
+test -eu then cd then cd export -eu $(pwd) /usr/bin
+x=1 'quoted text' --verbose
+readonly readonly 'quoted text' | readonly awk "$1" sed --verbose
+		-eu cd export | done printf sed
+		readonly readonly grep cd printf ${HOME} cd readonly local 'quoted text'
+		cd $(pwd) printf -eu 'quoted text'
+awk /usr/bin local echo readonly --verbose && echo 2>/dev/null
+	| echo 'quoted text' grep -eu
+	2>/dev/null "$@" awk export
+	then awk x=1 --verbose readonly readonly local $(pwd)
+		awk cd "$1" local "$1" -eu | --verbose local && awk "$@" $(pwd) export "$@" readonly
+done 2>/dev/null | grep "$@"
+"$@" -eu sed $(pwd) 'quoted text' test $(pwd) --verbose local "$1"
+	--verbose readonly && ${HOME} 2>/dev/null export grep then /usr/bin test grep
+2>/dev/null done 'quoted text' sed readonly 2>/dev/null "$@" done test x=1 ${HOME}
+		cd echo echo 2>/dev/null cd -eu printf -eu done local
+		--verbose --verbose ${HOME} 2>/dev/null cd awk
+$(pwd) export "$1" awk
+	'quoted text' printf $(pwd) grep $(pwd) test then then && grep then
+		"$1" done sed export x=1 --verbose "$1" local ${HOME} -eu
+x=1 printf --verbose /usr/bin && test
+x=1 done $(pwd) sed |
+	readonly test echo printf "$1" test "$@" 'quoted text' "$1" && local cd -eu
+	--verbose echo | readonly $(pwd) && awk then && &&
+	'quoted text' awk 'quoted text' local ${HOME} x=1 --verbose
+| test done sed $(pwd) sed test ${HOME} cd cd local /usr/bin grep
+		-eu 'quoted text' awk awk local readonly
+/usr/bin /usr/bin sed readonly then awk readonly ${HOME} readonly
+-eu echo awk /usr/bin export /usr/bin awk ${HOME} done printf echo awk local
+| ${HOME} done ${HOME} sed 2>/dev/null cd
+"$@" then done local /usr/bin "$@" --verbose export cd awk cd && 'quoted text'
+		local && --verbose "$@" done
+	| $(pwd) | awk test echo 2>/dev/null
+	$(pwd) sed local printf readonly test --verbose export && grep &&
+	$(pwd) /usr/bin --verbose
+sed done test && ${HOME} awk echo 'quoted text' /usr/bin
+		"$@" test | local printf cd "$1" ${HOME}
+		2>/dev/null 'quoted text' "$1" "$1" 2>/dev/null 2>/dev/null
+		&& then test awk x=1 test local export "$@" grep
+&& --verbose /usr/bin cd echo sed 2>/dev/null -eu --verbose grep /usr/bin
+		&& x=1 "$@" ${HOME} x=1 awk awk --verbose export grep "$@" "$1" readonly /usr/bin
+	grep "$@" && done readonly 2>/dev/null
+-eu printf grep readonly grep -eu $(pwd) local test $(pwd)
+'quoted text' printf export | echo "$@" --verbose -eu
+	x=1 readonly "$1" 'quoted text'
+--verbose | -eu export | local x=1 ${HOME}
+	export x=1 sed && cd "$1" sed
+x=1 local cd grep --verbose grep --verbose x=1 && then printf
+		2>/dev/null readonly readonly test sed "$1" "$@"
+	echo "$@" grep ${HOME} cd printf test cd test readonly ${HOME} "$@"
+		$(pwd) printf then ${HOME}
+	/usr/bin "$@" --verbose echo
+	/usr/bin "$1" cd /usr/bin --verbose grep then cd
+	echo local echo readonly done
+		local awk -eu sed echo | sed /usr/bin
+&& && readonly echo | 2>/dev/null export grep |
+	printf ${HOME} -eu ${HOME} done grep
+	-eu ${HOME} x=1 'quoted text'
+		echo -eu awk then -eu 2>/dev/null echo cd "$1" --verbose ${HOME}
+	readonly -eu grep cd grep printf 2>/dev/null awk test readonly
+	'quoted text' --verbose /usr/bin then -eu ${HOME} echo readonly
+'quoted text' | 'quoted text' | test
+		test cd then /usr/bin export
+		cd local awk sed local local printf ${HOME} && cd /usr/bin "$@" done sed 'quoted text'
+		2>/dev/null $(pwd) /usr/bin
+	local echo -eu export && -eu x=1 awk printf $(pwd) -eu ${HOME} $(pwd) "$1" /usr/bin
+		2>/dev/null export sed $(pwd)
+		local readonly "$@" export then
+${HOME} $(pwd) test /usr/bin printf
+"$1" test then "$1" sed "$@" 2>/dev/null /usr/bin local export
+then then then readonly done
+&& readonly done ${HOME} "$@" done done test x=1 x=1 -eu $(pwd) local test "$@"
+		cd 'quoted text' --verbose "$@" cd --verbose
+x=1 ${HOME} echo ${HOME} test sed local
+done export awk /usr/bin && --verbose "$@" sed local ${HOME} awk export then
+		"$1" awk local cd local | awk printf
+	readonly x=1 -eu printf /usr/bin -eu 'quoted text'
+		"$1" then $(pwd) grep awk 2>/dev/null then "$1"
+		"$1" 'quoted text' "$@" 2>/dev/null "$1" 2>/dev/null $(pwd)
+		/usr/bin test $(pwd) grep readonly test grep --verbose "$@" 2>/dev/null
+		printf sed grep ${HOME} /usr/bin "$1" |
+	--verbose $(pwd) "$1" sed sed /usr/bin then
+		printf export export printf && -eu -eu | awk
+		done ${HOME} x=1 | local sed "$@" then "$@" readonly 2>/dev/null
+| cd 2>/dev/null sed | ${HOME} /usr/bin && printf -eu local
+local /usr/bin "$1" && awk cd cd done test "$@" printf "$@" readonly 'quoted text'
+readonly done && "$@" x=1 $(pwd) awk awk local /usr/bin --verbose
+	$(pwd) local cd printf /usr/bin done awk "$1" readonly 'quoted text' sed "$@" awk
+done | 2>/dev/null -eu 'quoted text'
+	"$@" local sed readonly ${HOME} echo x=1 test echo then sed export 2>/dev/null
+export --verbose | done local then ${HOME} --verbose awk then echo
+		-eu echo printf && "$1" printf
+readonly | export cd ${HOME}
+	"$@" x=1 "$1" done echo awk
+${HOME} export | x=1 'quoted text'
+"$1" cd readonly 2>/dev/null done grep readonly
+		--verbose awk done $(pwd) 2>/dev/null
+	x=1 echo ${HOME} 'quoted text' 'quoted text' 'quoted text' printf sed
+	awk echo local awk printf cd awk done then cd -eu /usr/bin local echo
+		-eu "$@" local cd printf
+	then -eu test grep 'quoted text' ${HOME} printf then $(pwd) "$1" x=1
+done && ${HOME} awk "$1" awk
+grep awk && local awk echo cd echo 2>/dev/null --verbose export && && /usr/bin
+	local echo local 'quoted text' then readonly "$1"
+	echo grep 'quoted text' then readonly
+$(pwd) 2>/dev/null 2>/dev/null then echo 'quoted text'
+"$@" /usr/bin awk local sed readonly echo then
+$(pwd) echo echo echo "$1" && echo -eu done readonly done && 2>/dev/null /usr/bin
+2>/dev/null ${HOME} "$@" sed grep ${HOME} && -eu
+	$(pwd) export --verbose local sed
+$(pwd) && 'quoted text' grep local x=1 sed readonly sed
+		awk test --verbose && export printf --verbose echo export awk "$1" then
+		echo then readonly --verbose
+	echo printf | 2>/dev/null printf /usr/bin
+	--verbose "$1" "$1" sed readonly "$1" awk $(pwd) | x=1 ${HOME} export -eu
+--verbose local "$1" && --verbose then grep
+	awk /usr/bin "$1" -eu export x=1 awk /usr/bin awk "$1" 'quoted text' done done
+	grep --verbose -eu -eu && 'quoted text' --verbose printf
+printf cd local cd then test
+'quoted text' "$1" local --verbose $(pwd) 2>/dev/null "$@" sed "$1" local
+		cd echo $(pwd) 'quoted text' export local grep
+	test done && /usr/bin sed 'quoted text' echo -eu --verbose -eu awk export
+$(pwd) sed | 2>/dev/null readonly printf x=1 && done local --verbose printf readonly
+		"$1" ${HOME} && $(pwd) && export awk /usr/bin "$1" $(pwd) x=1
+2>/dev/null "$@" cd awk
+		-eu test cd local 'quoted text' $(pwd) --verbose
+		echo cd "$@" "$1" cd readonly 2>/dev/null test then
+		then /usr/bin local $(pwd) x=1 'quoted text'
+| cd $(pwd) -eu grep
+	awk test ${HOME} cd test cd then -eu /usr/bin $(pwd) x=1 2>/dev/null done /usr/bin
+	printf cd /usr/bin "$@" x=1 'quoted text' $(pwd) echo --verbose local
+--verbose then echo cd $(pwd) test
+		"$@" export --verbose cd 'quoted text' 'quoted text'
+local test local ${HOME} printf printf /usr/bin && export
+		${HOME} "$1" "$1" -eu 2>/dev/null "$1" export
+	"$@" local sed awk 'quoted text' printf
+		--verbose echo $(pwd) done 'quoted text' 2>/dev/null
+	readonly export | ${HOME} test -eu awk -eu
+test | | awk printf "$1" done sed "$@"
+		printf 'quoted text' --verbose then sed 2>/dev/null | "$@"
+$(pwd) awk "$@" x=1 done 2>/dev/null cd echo /usr/bin echo && test
+		echo -eu sed x=1 local /usr/bin echo then /usr/bin sed /usr/bin /usr/bin /usr/bin
+		| "$@" $(pwd) | && local $(pwd)
+		test local export /usr/bin x=1 then --verbose export "$1" readonly grep x=1
+$(pwd) "$1" "$@" $(pwd) done x=1 &&
+	awk done -eu echo | && -eu && echo readonly 2>/dev/null cd sed done
+		2>/dev/null "$1" && "$1" ${HOME} grep awk /usr/bin grep /usr/bin -eu && local
+	then ${HOME} printf awk "$1" x=1 grep 2>/dev/null "$1"
+cd $(pwd) cd && 2>/dev/null /usr/bin /usr/bin 'quoted text' then readonly grep
+--verbose x=1 printf 2>/dev/null then ${HOME} sed
+		2>/dev/null "$1" $(pwd) 2>/dev/null "$@" ${HOME}
+| export /usr/bin 2>/dev/null --verbose
+printf readonly cd export "$1" test $(pwd) test export echo /usr/bin then "$1"
+export local local ${HOME} done /usr/bin grep /usr/bin test "$1"
+		-eu local cd x=1 cd $(pwd) "$1" x=1 cd test grep local test $(pwd)
+	then && readonly sed -eu readonly echo echo "$1" "$1" echo | readonly sed test
+	printf -eu --verbose 2>/dev/null test 2>/dev/null readonly
+"$1" 'quoted text' echo done
+	test /usr/bin ${HOME} readonly readonly |
+	printf printf x=1 -eu ${HOME} grep ${HOME} "$1" test printf
+	/usr/bin "$1" $(pwd) /usr/bin echo cd
+	--verbose echo ${HOME} x=1 -eu printf readonly then
+	local echo x=1 sed sed 'quoted text'
+		| 2>/dev/null $(pwd) /usr/bin ${HOME} awk sed
+	"$@" -eu -eu 'quoted text' readonly x=1 && --verbose x=1 then grep echo
+x=1 --verbose done 'quoted text' done $(pwd) -eu then cd sed
+sed ${HOME} test $(pwd) | ${HOME} then | awk cd grep grep echo --verbose
+		grep cd "$1" ${HOME} export && ${HOME} $(pwd) 'quoted text' | -eu
+	$(pwd) local cd grep /usr/bin echo x=1 $(pwd)
+export -eu echo awk readonly
+| done cd then "$1" -eu "$@" then local 'quoted text'
+		/usr/bin ${HOME} sed sed test x=1 local "$1" $(pwd) awk then
+-eu 2>/dev/null test -eu | done test && sed
+	test --verbose ${HOME} 'quoted text' $(pwd) printf 'quoted text'
+done grep echo /usr/bin cd --verbose
+		awk $(pwd) "$@" sed "$@" done /usr/bin readonly 'quoted text'
+		'quoted text' sed x=1 awk
+		'quoted text' done test | | /usr/bin --verbose printf
+	readonly | | cd export readonly echo export echo grep grep -eu &&
+	awk ${HOME} grep grep test cd done && sed ${HOME} "$@" && sed sed
+	--verbose export test echo "$@" --verbose export grep /usr/bin export
+	awk grep x=1 grep && 'quoted text' echo readonly -eu readonly
+	$(pwd) "$@" && printf /usr/bin x=1 2>/dev/null awk cd then then test ${HOME} "$@"
+		x=1 x=1 done awk done grep --verbose
+		$(pwd) $(pwd) cd local 'quoted text'
+		"$1" && awk 2>/dev/null 'quoted text' 2>/dev/null readonly awk grep -eu
+$(pwd) ${HOME} --verbose export echo cd "$1" export
+readonly export /usr/bin
+done printf cd grep x=1 "$1" | awk && cd cd "$1" test 'quoted text'
+-eu x=1 done 2>/dev/null &&
+	awk sed | export done $(pwd) test test local $(pwd) awk local
+	cd --verbose cd echo done x=1 sed --verbose cd "$@" -eu done
+readonly --verbose local $(pwd) && -eu ${HOME} "$1" export local
+test "$1" -eu | | /usr/bin 2>/dev/null export readonly test
+		then /usr/bin local grep cd readonly grep echo awk
+		cd done 2>/dev/null | export -eu 'quoted text' sed
+test 2>/dev/null sed echo readonly
+		export done -eu test readonly
+	--verbose cd "$1" local -eu --verbose /usr/bin echo /usr/bin
+		cd done "$@" cd && --verbose $(pwd) printf "$@" done echo /usr/bin
+	"$@" 'quoted text' awk
+		done 'quoted text' export 'quoted text' sed && then 2>/dev/null
+	done readonly export && then ${HOME} x=1 cd x=1 grep then awk readonly ${HOME}
+2>/dev/null sed awk --verbose x=1 && -eu | then export -eu 'quoted text' done
+		grep | sed echo -eu -eu export awk 2>/dev/null /usr/bin echo export "$@"
+	cd cd printf "$@" local "$1" | "$1" x=1 | then then "$1" 'quoted text'
+| export && "$1" 2>/dev/null grep 'quoted text'
+		readonly sed echo printf echo
+local "$1" echo 'quoted text' echo local && export -eu
+"$@" sed test $(pwd) test cd --verbose "$@" "$1" 2>/dev/null grep
+		local $(pwd) then then 2>/dev/null echo test 2>/dev/null "$1"
+grep /usr/bin local 'quoted text' 'quoted text' /usr/bin 2>/dev/null 'quoted text'
+		grep --verbose then test readonly printf
+/usr/bin export | "$1" $(pwd) done x=1 "$1" 2>/dev/null
+	grep echo echo sed sed /usr/bin | local echo "$@" local
+	-eu $(pwd) grep /usr/bin
+cd --verbose readonly 'quoted text' awk local ${HOME} "$1" /usr/bin 'quoted text'
+		"$1" "$1" awk cd /usr/bin x=1 /usr/bin
+sed "$1" $(pwd) $(pwd) --verbose export x=1 sed ${HOME} local -eu test readonly
+cd 'quoted text' && && --verbose readonly ${HOME} "$@" "$@"
+	awk 2>/dev/null 2>/dev/null "$1" test done local export export &&
+--verbose cd done done && "$1" -eu test --verbose /usr/bin
+printf export "$1" 'quoted text' /usr/bin
+		$(pwd) | | && -eu 'quoted text'
+	export $(pwd) && echo sed export --verbose -eu 'quoted text'
+	cd ${HOME} --verbose /usr/bin && export ${HOME} printf "$1"
+x=1 $(pwd) ${HOME} done --verbose ${HOME} "$@" sed local
+		test "$1" readonly x=1 'quoted text' printf ${HOME} echo && --verbose
+	export readonly done done local readonly /usr/bin -eu grep 'quoted text'
+	export export -eu -eu && --verbose awk printf "$1" sed
+	echo test ${HOME} local "$@" readonly then sed grep "$@" x=1 | "$1" local
+	test cd then "$1" done awk | && x=1 cd $(pwd) 2>/dev/null cd /usr/bin
+printf | "$1" 2>/dev/null
+-eu readonly then echo local cd | sed
+		grep | done "$@" x=1 "$@" --verbose done done echo /usr/bin printf && awk /usr/bin
+"$1" export -eu --verbose cd done awk cd ${HOME} sed x=1 echo "$1" done /usr/bin
+	&& --verbose ${HOME} "$@" -eu && x=1 "$1" cd $(pwd) /usr/bin echo -eu 2>/dev/null
+	test then 2>/dev/null grep ${HOME}
+cd ${HOME} "$@" "$@" awk printf sed readonly ${HOME} | export local /usr/bin
+| cd echo awk awk ${HOME} -eu | && then -eu "$@" "$1" export local /usr/bin
+	test echo echo -eu 2>/dev/null local 'quoted text'
+$(pwd) local $(pwd) ${HOME} "$@" --verbose "$1" test ${HOME} echo
+printf x=1 2>/dev/null |
+	export echo export $(pwd) /usr/bin printf | cd grep 'quoted text'
+		| echo "$1" grep ${HOME} export done $(pwd) && done | /usr/bin test awk sed then
+		readonly sed /usr/bin awk "$1" $(pwd) 2>/dev/null then ${HOME}
+	| done sed x=1 export export local readonly cd && | done /usr/bin && done
+grep readonly grep grep "$@"
+-eu then echo x=1 "$@" awk test grep "$@" "$@" x=1 cd readonly x=1
+$(pwd) 2>/dev/null && readonly x=1 'quoted text'
+local | printf test done -eu $(pwd)
+/usr/bin x=1 awk --verbose test 'quoted text'
+		test grep export ${HOME} /usr/bin 2>/dev/null
+		then "$1" 'quoted text' 2>/dev/null readonly |
+		/usr/bin "$@" /usr/bin 'quoted text'
+-eu printf then sed echo && awk "$@" then printf printf
+		"$1" export printf x=1 printf echo -eu --verbose "$1" echo
+printf test 'quoted text' && echo | local done -eu $(pwd) cd test
+grep /usr/bin -eu test echo awk $(pwd) ${HOME} | | x=1 cd test cd then 'quoted text'
+		2>/dev/null export && "$@" /usr/bin awk readonly sed x=1 && --verbose
+	2>/dev/null awk $(pwd) -eu /usr/bin local x=1 --verbose
+sed $(pwd) sed -eu grep done "$1" -eu then 2>/dev/null
+	2>/dev/null x=1 'quoted text'
+2>/dev/null printf then $(pwd) local x=1 'quoted text' done | cd cd
+awk readonly sed done cd 2>/dev/null readonly printf then awk test readonly
+2>/dev/null "$1" readonly x=1 && --verbose "$1" test grep local "$1" then
+		grep | ${HOME} readonly done && -eu echo --verbose awk 'quoted text'
+		grep 2>/dev/null echo --verbose awk grep done 2>/dev/null
+		${HOME} test printf then && export /usr/bin
+	--verbose /usr/bin "$@" then ${HOME} export && awk 'quoted text'
+"$@" printf $(pwd) $(pwd) | -eu 2>/dev/null x=1 local printf sed cd /usr/bin
+grep grep export /usr/bin
+readonly | local export readonly 'quoted text' export
+then readonly done ${HOME}
+		2>/dev/null x=1 "$@" echo 'quoted text'
+"$@" --verbose 2>/dev/null readonly echo "$@" sed local "$1" grep local 'quoted text'
+		printf done echo --verbose ${HOME} -eu
+		cd --verbose grep grep | ${HOME} readonly readonly
+then 2>/dev/null printf -eu "$@"
+	printf && awk printf cd /usr/bin local test
+	printf x=1 test test printf done 'quoted text' "$1"
+	cd x=1 2>/dev/null awk then "$@" sed then cd echo test ${HOME} export ${HOME}
+	grep sed done awk "$1"
+test ${HOME} "$@" | echo 'quoted text' --verbose /usr/bin ${HOME}
+		&& -eu echo printf --verbose
+	"$1" $(pwd) --verbose readonly
+#include c171.sh
+		&& $(pwd) 2>/dev/null awk && --verbose x=1 2>/dev/null
+		readonly && awk test export x=1 export 2>/dev/null done readonly
+	/usr/bin test | export test awk test printf
+		awk $(pwd) done ${HOME} --verbose x=1 ${HOME} --verbose
+'quoted text' --verbose sed readonly
+		then test "$@" $(pwd) cd && echo
+		-eu -eu awk sed x=1 local done x=1 -eu then
+test 2>/dev/null /usr/bin grep
+		$(pwd) grep export $(pwd) done | sed printf readonly cd -eu
+	"$@" test awk cd && --verbose printf local x=1 echo printf x=1 --verbose
+	test | printf "$1" test 2>/dev/null cd 2>/dev/null /usr/bin "$@" | &&
+&& ${HOME} echo "$1" cd readonly sed local
+		$(pwd) "$1" export awk local printf && grep printf done grep then test
+&& done awk awk 'quoted text' 2>/dev/null cd --verbose x=1 awk grep
+| 'quoted text' -eu then grep $(pwd) -eu x=1 readonly x=1
+		local then grep local local printf echo then then "$@" then
+printf "$@" ${HOME} local /usr/bin | && --verbose export printf readonly readonly
+2>/dev/null /usr/bin echo
+		readonly 2>/dev/null 2>/dev/null
+		2>/dev/null /usr/bin echo test x=1 export
+	--verbose printf && cd done "$1" | readonly echo export | "$@"
+	x=1 printf then -eu 2>/dev/null
+	| && cd "$1" printf printf /usr/bin "$@"
+		'quoted text' export grep cd /usr/bin
+--verbose export grep test x=1 local grep done grep done then 'quoted text'
+-eu cd grep local then $(pwd) --verbose
+'quoted text' done && "$@"
+	x=1 export -eu grep awk "$1" done $(pwd)
+export sed /usr/bin ${HOME} "$@" --verbose
+		sed $(pwd) done | 'quoted text' grep export
+"$@" then | "$1" | awk sed ${HOME} export
+		done printf 2>/dev/null x=1 export && && "$1" && -eu export sed export readonly
+grep sed $(pwd) printf then printf -eu done && awk echo grep 'quoted text'
+awk | "$1" then x=1 printf grep grep awk ${HOME} awk | then --verbose "$@" /usr/bin
+	"$@" x=1 test ${HOME} $(pwd) printf $(pwd) "$@" &&
+echo && --verbose 2>/dev/null x=1 readonly x=1 grep | then 2>/dev/null
+export --verbose local 'quoted text' --verbose printf sed | && done x=1 export
+	/usr/bin "$1" readonly "$1" /usr/bin export
+echo export "$@" x=1 "$1" awk x=1 test ${HOME} echo then
+		${HOME} $(pwd) test "$1" -eu local 'quoted text'
+	echo printf readonly -eu cd ${HOME} ${HOME} sed x=1
+then done awk export x=1 x=1 "$@" "$1" /usr/bin test
+awk 2>/dev/null echo --verbose sed -eu --verbose sed ${HOME} readonly $(pwd)
+then cd awk echo "$1" test -eu done "$@" readonly
+		&& then then "$@" cd echo sed awk $(pwd) "$@" /usr/bin
+readonly $(pwd) -eu &&
+&& echo -eu "$1" readonly
+		cd --verbose readonly 2>/dev/null ${HOME} --verbose $(pwd) local
+	--verbose /usr/bin 'quoted text' sed echo sed grep 2>/dev/null 'quoted text'
+	printf cd then ${HOME} && -eu 'quoted text' awk test | $(pwd) sed "$1" /usr/bin
+test x=1 sed x=1 sed ${HOME} | ${HOME} echo test "$1" "$@"
+	x=1 then printf readonly "$1" 'quoted text' "$@" $(pwd) then | 2>/dev/null
+		echo echo done local 2>/dev/null /usr/bin && test 2>/dev/null sed then ${HOME}
+		${HOME} readonly test then /usr/bin "$@" 2>/dev/null $(pwd) cd
+		cd cd test $(pwd) echo ${HOME} sed cd -eu cd export $(pwd)
+		awk then | grep export done printf then local x=1 cd readonly "$1" export local
+		test awk test | export && --verbose ${HOME} sed grep
+&& printf grep local echo export cd export 'quoted text' local export
+${HOME} -eu printf done export "$@" local
+${HOME} cd -eu grep -eu done local export
+printf x=1 2>/dev/null x=1 2>/dev/null local | sed && -eu -eu /usr/bin
+		local /usr/bin ${HOME} "$@"
+		test printf grep awk local 'quoted text' printf done sed
+done test grep && sed
+	cd ${HOME} $(pwd) echo "$1" awk && 2>/dev/null awk --verbose
+		"$@" export | awk "$1" export readonly cd 'quoted text' $(pwd)
+cd && && "$@" $(pwd) --verbose then test done | awk test
+then local cd "$1" test ${HOME} cd export ${HOME} sed /usr/bin
+awk cd cd | && test x=1 then done 'quoted text' $(pwd) $(pwd) ${HOME}
+2>/dev/null grep sed /usr/bin "$1" sed sed | x=1
+	test -eu --verbose local sed x=1 | done
+		echo && 'quoted text' && then | done
+$(pwd) x=1 local "$1" 'quoted text' readonly cd $(pwd) && printf
+		echo x=1 "$@" printf printf -eu test && local | | then
+		x=1 2>/dev/null $(pwd) 2>/dev/null $(pwd) cd x=1
+	"$@" local ${HOME} 'quoted text' printf "$@" -eu "$1" $(pwd) 'quoted text'
+done "$1" /usr/bin /usr/bin readonly
+		test x=1 x=1 printf sed ${HOME} && printf done printf --verbose x=1
+'quoted text' "$@" grep printf local x=1 done test x=1 test done cd -eu 2>/dev/null
+$(pwd) local ${HOME} export | echo sed && export $(pwd) sed export then local
+		test "$@" 'quoted text' done 2>/dev/null awk
+	then | cd then test $(pwd) grep -eu echo awk then cd /usr/bin awk
+		x=1 grep then ${HOME} test printf readonly 2>/dev/null test
+		'quoted text' "$1" test 'quoted text' local awk local ${HOME} readonly local
+		readonly echo export done "$@" && local | export | ${HOME} -eu && | done export
+-eu 'quoted text' cd x=1 test echo
+sed echo /usr/bin grep printf "$1"
+export x=1 local then then /usr/bin echo awk 'quoted text' awk "$@"
+		export local sed readonly | | export
+export cd awk cd | then done cd | $(pwd)
+	-eu then /usr/bin local echo 'quoted text' cd done readonly
+done --verbose -eu $(pwd) echo echo sed printf x=1 -eu awk
+		test test grep cd readonly 2>/dev/null
+		"$@" export printf sed readonly | "$@"
+| test --verbose -eu /usr/bin x=1 /usr/bin
+${HOME} then $(pwd) 2>/dev/null -eu local readonly grep "$@" | test -eu "$@" awk
+		sed $(pwd) test echo "$1" ${HOME} sed | /usr/bin
+		${HOME} 'quoted text' --verbose $(pwd)
+	2>/dev/null | sed sed "$1" /usr/bin 2>/dev/null then $(pwd)
+-eu export grep awk cd test ${HOME} export
+"$1" test sed && readonly
+	"$1" sed local export then
+	2>/dev/null "$1" $(pwd) then done test --verbose grep | cd readonly readonly
+	&& "$1" $(pwd) /usr/bin grep
+		&& --verbose $(pwd) grep export echo test export | printf && $(pwd) sed 'quoted text'
+	'quoted text' /usr/bin done -eu && "$1" -eu echo $(pwd) ${HOME} local echo
+		$(pwd) ${HOME} && echo local "$@" readonly
+		--verbose test readonly -eu cd --verbose "$1" cd then echo then sed
+		$(pwd) sed cd local x=1 x=1 export 'quoted text' -eu grep /usr/bin echo printf x=1
+		"$1" local done local local "$@" "$1" -eu printf printf
+	export echo test then 2>/dev/null /usr/bin local cd
+		done "$1" then export echo grep && awk --verbose local test test
+	echo $(pwd) $(pwd) ${HOME}
+		'quoted text' printf 2>/dev/null grep sed $(pwd) --verbose 'quoted text'
+	then grep cd "$1" sed export done -eu then cd ${HOME} /usr/bin ${HOME}
+	| | "$@" $(pwd) /usr/bin 'quoted text' "$1" "$1" 'quoted text' test
+readonly x=1 readonly "$@" then cd 'quoted text'
+		awk then -eu 'quoted text' $(pwd) --verbose x=1 "$1" $(pwd) 'quoted text'
+2>/dev/null sed cd --verbose --verbose readonly export && "$@" | | awk
+	${HOME} ${HOME} echo | grep "$@" done $(pwd) grep x=1 | --verbose --verbose
+test test $(pwd) x=1 awk awk done /usr/bin echo test cd 'quoted text'
+"$1" local done cd 2>/dev/null readonly
+done printf export && awk "$1" test test local
+	printf printf export $(pwd) sed | local done cd $(pwd) | x=1
+	awk then "$@" x=1 2>/dev/null then export printf
+		readonly x=1 "$@" cd -eu
+sed awk /usr/bin "$1" 2>/dev/null &&
+readonly -eu printf printf -eu readonly ${HOME} x=1
+&& readonly -eu sed awk -eu done grep sed local local done --verbose x=1
+	--verbose "$1" export 'quoted text' 2>/dev/null "$@" /usr/bin then 2>/dev/null
+	/usr/bin | test sed export x=1 "$@" ${HOME} -eu /usr/bin readonly
+	grep "$1" /usr/bin then local printf printf x=1 export echo export export readonly
+grep test 2>/dev/null 2>/dev/null "$1" echo
+		| printf $(pwd) printf printf 2>/dev/null 'quoted text' -eu /usr/bin
+	$(pwd) sed printf --verbose
+		${HOME} export sed test | | -eu test test --verbose
+	export /usr/bin sed | test
+		x=1 | printf "$1" | /usr/bin /usr/bin /usr/bin printf test
+		test echo "$1" export 'quoted text' grep done 2>/dev/null
+"$@" "$@" $(pwd) export then grep
+&& "$1" "$1" printf test echo echo ${HOME} echo $(pwd) echo "$1" sed sed "$@"
+2>/dev/null x=1 "$@" $(pwd) --verbose then then "$@" $(pwd) "$1"
+		$(pwd) ${HOME} local echo echo readonly "$@" test sed 2>/dev/null
+&& export "$1" then 'quoted text' 'quoted text' local 2>/dev/null 'quoted text'
+local /usr/bin x=1 then 'quoted text' ${HOME} && "$@" "$1"
+		test 'quoted text' "$1" ${HOME} printf | && --verbose x=1 ${HOME} --verbose
+		readonly "$@" | "$1" export && export $(pwd) "$1" && test
+		export cd x=1 awk local "$@" 2>/dev/null $(pwd)
+		export "$1" printf grep x=1 &&
+	local sed grep local $(pwd) "$@" awk -eu sed | sed 'quoted text' 'quoted text'
+	sed /usr/bin 'quoted text' readonly test "$@" | printf $(pwd) 'quoted text'
+	/usr/bin readonly $(pwd)
+$(pwd) awk && | echo 'quoted text' | x=1 done cd awk then "$1"
+		${HOME} --verbose $(pwd) 'quoted text'
+	${HOME} export done grep local local
+	cd 2>/dev/null && /usr/bin awk then "$1" test
+		/usr/bin /usr/bin x=1 2>/dev/null then done -eu then
+	-eu x=1 export "$@" local test 2>/dev/null /usr/bin 2>/dev/null grep awk
+${HOME} -eu done $(pwd) printf 2>/dev/null
+	readonly test then $(pwd) 2>/dev/null sed x=1 $(pwd) sed grep -eu /usr/bin
+	printf printf x=1 2>/dev/null printf sed --verbose "$@" "$@" 'quoted text'
+	cd "$@" local 2>/dev/null awk 'quoted text' && export readonly
+	printf awk done --verbose | "$1" local
+	printf sed "$1" done sed 2>/dev/null done $(pwd) test done |
+		export echo test grep then echo echo ${HOME} "$1" 2>/dev/null
+'quoted text' | /usr/bin --verbose | cd readonly
+		awk local 2>/dev/null cd readonly test local readonly 'quoted text' 2>/dev/null
+echo test && "$@" awk -eu $(pwd) printf
+		cd $(pwd) --verbose test --verbose
+		done printf 2>/dev/null | export "$@" /usr/bin 'quoted text'
+		sed 2>/dev/null done --verbose done --verbose echo "$@" export "$@"
+		local awk echo | export --verbose echo
+export then readonly readonly $(pwd) done done -eu done 2>/dev/null
+	"$@" --verbose 'quoted text' x=1 printf
+'quoted text' then done -eu 'quoted text'
+		cd export -eu ${HOME} sed "$1" "$1" then printf -eu |
+		printf echo ${HOME} ${HOME} grep cd /usr/bin cd $(pwd) echo
+		'quoted text' local 'quoted text'
+	then -eu $(pwd) | sed grep --verbose then $(pwd)
+printf | awk readonly echo grep export sed grep 'quoted text' $(pwd) sed x=1 2>/dev/null
+	"$1" grep ${HOME} ${HOME}
+		export echo && -eu ${HOME} grep ${HOME} done then local -eu cd ${HOME}
+then grep && export awk
+	"$@" done echo test && then "$1" test
+	2>/dev/null && x=1 | grep local
+/usr/bin cd --verbose sed then "$1" /usr/bin export export --verbose sed "$@"
+awk $(pwd) awk export "$1" cd -eu then -eu $(pwd) cd /usr/bin readonly && 'quoted text'
+&& x=1 done | "$1" | /usr/bin readonly readonly export $(pwd) readonly
+	local 2>/dev/null grep && | "$1" 2>/dev/null
+${HOME} sed readonly -eu
+&& printf readonly -eu readonly /usr/bin printf awk local --verbose awk
+	local sed && $(pwd) sed -eu awk cd sed
+	test grep /usr/bin readonly &&
+then "$@" ${HOME} sed /usr/bin
+		readonly then echo -eu export readonly $(pwd) echo --verbose
+	x=1 "$@" $(pwd) local test local awk sed cd sed /usr/bin --verbose ${HOME}
+	/usr/bin "$1" done printf 2>/dev/null
+	-eu grep local /usr/bin done -eu x=1 "$@" /usr/bin local -eu
+export | && sed /usr/bin $(pwd)
+		2>/dev/null "$1" cd readonly done test
+		awk ${HOME} --verbose export --verbose "$1" test awk x=1 && test --verbose
+printf sed echo done "$1" $(pwd) 2>/dev/null 2>/dev/null
+"$@" grep --verbose &&
+		printf cd echo --verbose sed local sed sed cd x=1
+	2>/dev/null "$1" && 'quoted text' && awk /usr/bin
+x=1 "$@" echo x=1 export && 'quoted text' then test local test | export
+	awk printf awk /usr/bin grep printf "$1" "$@" grep cd /usr/bin | awk grep
+	'quoted text' sed $(pwd) awk grep "$@" local "$@" x=1 2>/dev/null printf
+	'quoted text' x=1 /usr/bin x=1 --verbose local 'quoted text'
+		$(pwd) && sed printf awk --verbose
+	2>/dev/null "$@" "$@" cd x=1 sed --verbose 2>/dev/null
+		done readonly "$@" cd -eu ${HOME}
+grep printf then local ${HOME} 2>/dev/null /usr/bin "$1" "$1" 2>/dev/null cd echo
+	'quoted text' "$1" $(pwd) cd sed --verbose printf ${HOME} echo && $(pwd) ${HOME}
+cd 2>/dev/null local "$@"
+		cd $(pwd) $(pwd) readonly "$1" $(pwd)
+test x=1 sed 'quoted text' && "$1" export cd printf local 'quoted text' &&
+	-eu readonly && | echo
+		awk test $(pwd) test $(pwd) |
+2>/dev/null sed grep awk then x=1 local $(pwd) "$1" 'quoted text' $(pwd) printf
+| cd $(pwd) local x=1 /usr/bin $(pwd) test grep export
+	-eu "$@" echo $(pwd) grep grep local 'quoted text' 2>/dev/null grep awk awk
+		test 2>/dev/null cd grep $(pwd) "$1" | export x=1 readonly done 'quoted text'
+		/usr/bin && "$1" awk done 2>/dev/null awk && readonly 'quoted text' awk
+		done /usr/bin /usr/bin
+	readonly /usr/bin test | cd | test readonly "$1" export export awk "$@" x=1
+done -eu /usr/bin test done test 2>/dev/null
+x=1 grep then --verbose sed sed "$1" && then echo done sed
+$(pwd) | done $(pwd) sed cd awk 'quoted text'
+$(pwd) echo local x=1 $(pwd) readonly "$@" export /usr/bin ${HOME}
+	"$1" "$1" && readonly /usr/bin 'quoted text'
+"$@" sed 'quoted text' x=1 && echo 'quoted text'
+		echo sed | -eu -eu test printf 'quoted text' awk && 2>/dev/null
+		&& readonly sed printf -eu awk
+"$@" echo $(pwd) 'quoted text'
+| /usr/bin then echo printf "$1" echo | readonly
+	test ${HOME} readonly printf 2>/dev/null sed sed export && ${HOME} local
+	local echo then 'quoted text' then echo $(pwd)
+	| 2>/dev/null ${HOME} echo test grep &&
+--verbose sed "$@" 2>/dev/null
+	x=1 "$1" && 'quoted text' && /usr/bin then | grep && sed $(pwd) "$@" x=1 --verbose
+sed done test 2>/dev/null echo -eu x=1 x=1 export /usr/bin awk export
+	export x=1 /usr/bin cd 'quoted text'
+		'quoted text' sed local local local test awk | | 2>/dev/null
+		$(pwd) local grep grep "$1" | grep /usr/bin
+printf awk readonly export ${HOME} | then done
+test "$@" "$@" 'quoted text' $(pwd) --verbose
+--verbose -eu readonly x=1 "$@" $(pwd) cd 2>/dev/null grep test cd $(pwd)
+grep then x=1 'quoted text' && $(pwd) cd -eu sed echo echo done -eu && |
+/usr/bin -eu sed done x=1 echo awk 'quoted text' ${HOME}
+		2>/dev/null /usr/bin readonly | --verbose export sed
+		readonly 2>/dev/null awk sed grep printf
+		/usr/bin awk && readonly then x=1 && export readonly "$@" awk sed
+		echo 2>/dev/null x=1 cd grep printf
+2>/dev/null then local export 2>/dev/null sed 'quoted text' "$@" done cd
+		/usr/bin "$1" then -eu -eu export export /usr/bin | export /usr/bin | -eu
+readonly export --verbose local --verbose then local
+		grep 2>/dev/null awk done 'quoted text' --verbose 2>/dev/null export
+		2>/dev/null cd --verbose
+	grep then --verbose export
+	cd local grep export done readonly
+	x=1 $(pwd) echo then ${HOME} $(pwd) x=1 "$@" x=1 x=1 /usr/bin local
+	readonly done 'quoted text' 'quoted text'
+		then && "$@" "$1" printf export /usr/bin
+		then --verbose readonly $(pwd) awk local && x=1 "$@" --verbose 'quoted text'
+"$@" ${HOME} | sed sed test readonly test -eu local
+		sed x=1 cd cd cd test readonly $(pwd) 'quoted text' local sed then cd awk x=1
+	'quoted text' printf /usr/bin printf 2>/dev/null "$1"
+		&& /usr/bin cd && sed /usr/bin /usr/bin -eu "$@" printf $(pwd) done
+echo $(pwd) cd | | x=1 local -eu test
+2>/dev/null 'quoted text' then "$@" printf $(pwd) readonly 'quoted text'
+	"$@" export local sed done
+done && $(pwd) && x=1 2>/dev/null done 'quoted text'
+	$(pwd) readonly x=1 awk ${HOME}
+then readonly cd export 'quoted text'
+local | sed sed then x=1 2>/dev/null done | "$@" echo export $(pwd)
+local && printf "$1" echo local -eu $(pwd)
+	"$1" | cd -eu done | cd sed 2>/dev/null sed export printf
+cd local "$1" done 2>/dev/null | "$@" then x=1 -eu awk test 2>/dev/null "$@"
+	readonly "$1" x=1 awk x=1 --verbose done
+${HOME} grep && grep printf then 2>/dev/null "$@" readonly | cd
+$(pwd) 'quoted text' 2>/dev/null export printf 2>/dev/null
+	sed $(pwd) --verbose ${HOME} "$1" 'quoted text'
+		2>/dev/null grep | test sed
+		--verbose echo awk readonly "$1"
+	export /usr/bin /usr/bin readonly "$@"
+	/usr/bin x=1 x=1 /usr/bin | $(pwd) "$@" done "$@"
+/usr/bin echo export test grep /usr/bin echo /usr/bin -eu /usr/bin 'quoted text'
+	| ${HOME} grep then cd x=1 grep x=1 'quoted text' readonly | $(pwd)
+		-eu --verbose local cd done grep x=1 'quoted text'
+local ${HOME} x=1 cd --verbose
+	printf cd cd $(pwd) ${HOME} export then "$@" -eu $(pwd) local ${HOME} 2>/dev/null
+/usr/bin echo export sed x=1 export $(pwd)
+	awk echo 2>/dev/null | test
+	export cd awk export /usr/bin
+	printf | "$@" $(pwd) 2>/dev/null local cd awk
+cd | then grep $(pwd) 'quoted text'
+		&& awk readonly export local test --verbose
+printf sed printf awk 2>/dev/null
+--verbose -eu local /usr/bin sed awk 'quoted text' then printf awk /usr/bin 2>/dev/null
+		'quoted text' then echo done readonly readonly test readonly
+		"$@" ${HOME} --verbose echo then echo && done | 2>/dev/null &&
+	-eu ${HOME} /usr/bin export echo /usr/bin 'quoted text' awk --verbose
+export 2>/dev/null "$@" --verbose /usr/bin readonly readonly x=1 "$1" -eu $(pwd)
+	/usr/bin -eu --verbose | && done awk "$@" "$1" awk
+	2>/dev/null | sed awk echo printf printf "$1"
+		test "$1" x=1 "$@" then local $(pwd) local "$@" export
+		${HOME} 'quoted text' "$1" ${HOME} sed 2>/dev/null
+		printf sed "$1" 'quoted text' "$1" $(pwd) echo export
+		&& cd 'quoted text' $(pwd) printf readonly x=1 test sed | /usr/bin -eu
+"$1" -eu readonly -eu readonly --verbose 2>/dev/null ${HOME}
+		&& readonly -eu | then done --verbose 2>/dev/null /usr/bin grep awk $(pwd)
+"$@" x=1 then | -eu awk 2>/dev/null x=1 ${HOME} -eu sed echo
+"$1" sed -eu 2>/dev/null ${HOME}
+'quoted text' | done 'quoted text' && "$@" ${HOME} export | awk
+	2>/dev/null -eu x=1 printf
+	local | printf cd cd printf test cd -eu sed && export
+	test | export done $(pwd) then ${HOME}
+		cd -eu test "$1" done echo
+		${HOME} /usr/bin 2>/dev/null 2>/dev/null | cd
+local test && $(pwd) readonly /usr/bin sed done printf
+		/usr/bin readonly | --verbose && cd 2>/dev/null -eu echo -eu local
+${HOME} then 'quoted text'
+		&& $(pwd) "$@" /usr/bin 2>/dev/null
+		readonly "$@" | export | "$@" awk local export
+local "$1" sed echo -eu
+		'quoted text' grep -eu test x=1
+	export 'quoted text' 2>/dev/null $(pwd)
+		sed | 2>/dev/null $(pwd) "$@" /usr/bin "$1"
+	-eu --verbose $(pwd) done |
+grep "$1" $(pwd) x=1 $(pwd) ${HOME} "$1" -eu /usr/bin
+done $(pwd) echo export
+	readonly 2>/dev/null printf "$@" /usr/bin grep
+		${HOME} echo --verbose && "$1" printf then 2>/dev/null test "$@" --verbose test
+local echo printf --verbose grep done export 2>/dev/null "$1" sed done $(pwd)
+/usr/bin echo 'quoted text' test readonly sed sed awk export
+done "$1" 2>/dev/null && readonly cd 'quoted text' x=1 "$@" -eu grep local readonly
+done export printf done awk ${HOME} done --verbose |
+'quoted text' --verbose local
+		"$@" ${HOME} echo then /usr/bin local
+		printf grep export ${HOME} local
+	echo && cd printf x=1
+		done grep ${HOME} awk ${HOME}
+	--verbose awk awk test ${HOME} 2>/dev/null readonly printf
+	then /usr/bin 'quoted text' $(pwd) "$@" done | 'quoted text'
+| export local awk echo ${HOME} $(pwd) ${HOME} 'quoted text' -eu printf /usr/bin
+		readonly echo cd then test "$@" ${HOME} echo /usr/bin /usr/bin
+	x=1 echo grep grep -eu test 'quoted text' "$@" cd then cd cd done
+		done test | "$1" $(pwd) 2>/dev/null local then -eu $(pwd)
+2>/dev/null 'quoted text' test --verbose
+	"$1" x=1 "$1" -eu test 'quoted text' sed awk sed readonly "$@" local && export
+	"$@" && test local -eu 'quoted text'
+	$(pwd) x=1 "$@" awk --verbose
+	then local echo done ${HOME} 2>/dev/null
+	"$1" grep && test test /usr/bin awk awk "$1" "$1" echo readonly
+		local 'quoted text' /usr/bin test local done x=1 grep cd
+export 'quoted text' /usr/bin
+	printf grep then echo 'quoted text' test
+2>/dev/null export /usr/bin 'quoted text' then --verbose /usr/bin sed export
+	"$@" x=1 grep --verbose
+	x=1 done --verbose grep $(pwd) done 2>/dev/null sed --verbose
+	"$@" done 'quoted text' "$@" awk x=1 | test
+	-eu x=1 printf then cd --verbose 'quoted text'
+		-eu | echo grep --verbose test sed printf 'quoted text' | readonly
+		grep printf done "$@" sed export "$1" "$1" && test /usr/bin export
+x=1 then /usr/bin x=1 --verbose && /usr/bin echo --verbose export 'quoted text'
+		echo && sed "$1" && $(pwd) done grep "$@" local ${HOME} echo && /usr/bin --verbose
+		| $(pwd) --verbose export 2>/dev/null
+	export local x=1 "$@" 2>/dev/null grep && grep then && done
+'quoted text' x=1 $(pwd) /usr/bin printf
+		-eu -eu then sed "$@" --verbose echo /usr/bin test cd && /usr/bin
+	sed sed | && x=1 --verbose --verbose -eu /usr/bin then --verbose
+$(pwd) && 2>/dev/null | grep 'quoted text'
+printf echo $(pwd) local done 2>/dev/null
+		grep "$1" printf sed local export readonly
+		cd echo "$1" printf awk /usr/bin test awk "$@" "$1" test done 2>/dev/null local
+&& printf "$@" sed | printf "$@" "$1" "$@" then $(pwd) 2>/dev/null ${HOME} --verbose
+		--verbose /usr/bin awk
+	sed grep ${HOME} awk "$@" $(pwd) grep -eu done printf echo
+	local export then 'quoted text' sed "$@" /usr/bin && "$1" /usr/bin
+		"$1" local --verbose then awk then "$@" "$@" x=1 cd && then --verbose
+		grep cd then then printf grep then awk | /usr/bin && --verbose x=1 printf
+	cd export printf /usr/bin /usr/bin
+"$1" printf --verbose cd export local test export sed ${HOME} test sed echo grep
+	$(pwd) test 'quoted text' -eu readonly "$1" echo grep readonly awk $(pwd) local
+cd test && "$1" local cd "$@" local --verbose 2>/dev/null
+		sed /usr/bin echo 'quoted text' grep --verbose 2>/dev/null | test done
+/usr/bin test "$1" "$1" then /usr/bin sed
+		'quoted text' grep test 2>/dev/null 'quoted text'
+		| --verbose printf && then $(pwd) | readonly local
+local export ${HOME} grep awk /usr/bin
+		then "$@" x=1 && 'quoted text'
+		2>/dev/null | cd export printf "$1" "$1"
+		printf "$@" readonly && readonly local /usr/bin "$@"
+	x=1 grep local 'quoted text' | grep 2>/dev/null printf
+	2>/dev/null --verbose printf local readonly
+-eu awk --verbose | $(pwd)
+		awk sed cd && && grep test -eu ${HOME} 'quoted text' awk local
+--verbose awk $(pwd) grep sed && $(pwd) done printf --verbose x=1
+	local "$@" readonly /usr/bin && $(pwd) export done x=1 awk
+		export 2>/dev/null "$@" awk grep /usr/bin echo sed cd && x=1 $(pwd)
+		awk /usr/bin "$1" ${HOME} 'quoted text'
+echo grep && && cd then "$1" local 2>/dev/null 'quoted text' readonly
+		2>/dev/null test | 'quoted text'
+	--verbose -eu /usr/bin | /usr/bin && local "$@"
+	$(pwd) then local -eu sed echo grep done grep "$1" $(pwd) echo
+		| local done cd -eu -eu awk && $(pwd) 2>/dev/null
+		cd && grep | test done echo 2>/dev/null
+	/usr/bin && printf echo 'quoted text' -eu cd /usr/bin printf | /usr/bin 'quoted text'
+		| && $(pwd) 'quoted text' sed export grep && echo
+	&& awk grep sed echo 2>/dev/null
+readonly printf export done "$1" 2>/dev/null $(pwd) 'quoted text' --verbose
+	export export done done "$@" 2>/dev/null
+'quoted text' sed readonly
+	test -eu echo 2>/dev/null --verbose
+	&& echo local && "$1" done grep printf
+sed readonly cd done "$1" | 2>/dev/null done | "$1" test 2>/dev/null
+/usr/bin export x=1 && local export awk "$@" echo printf
+		"$@" awk "$1" -eu x=1 test grep readonly
+		&& cd $(pwd) | grep printf printf echo "$1" /usr/bin local printf done 'quoted text'
+		-eu sed readonly ${HOME} -eu /usr/bin cd echo export awk x=1 --verbose grep 2>/dev/null
+		cd 'quoted text' && ${HOME}
+sed && test local echo
+	&& then local local 2>/dev/null readonly awk /usr/bin printf grep
+		2>/dev/null printf "$@" awk local grep -eu awk | /usr/bin
+	test echo echo done $(pwd) grep ${HOME} then &&
+'quoted text' && done ${HOME} local /usr/bin ${HOME} 2>/dev/null
+	2>/dev/null cd -eu then then echo then then 2>/dev/null 'quoted text'
+| $(pwd) then then --verbose "$@" "$1" done
+		awk 'quoted text' grep && cd echo 'quoted text' && test /usr/bin
+	readonly then ${HOME} cd 2>/dev/null readonly --verbose
+		grep | $(pwd) --verbose done sed x=1 /usr/bin
+		test -eu /usr/bin printf 2>/dev/null && "$@" /usr/bin
+		"$@" grep $(pwd) "$1" 2>/dev/null cd --verbose -eu export
+		2>/dev/null sed sed && "$1" "$@" echo 'quoted text'
+	grep "$1" && "$1" 2>/dev/null cd --verbose -eu --verbose
+/usr/bin | readonly -eu grep printf
+		local cd $(pwd) "$1" -eu test
+		-eu sed /usr/bin | printf
+	done test 'quoted text' "$1" "$@" --verbose
+	2>/dev/null --verbose sed grep && sed 2>/dev/null | ${HOME} -eu -eu /usr/bin
+	2>/dev/null ${HOME} cd export done echo -eu printf x=1 /usr/bin
+		printf -eu test $(pwd) done 'quoted text'
+2>/dev/null --verbose printf sed
+grep "$1" ${HOME} readonly printf local printf "$@" x=1
+		| readonly sed export /usr/bin | sed echo | | readonly
+	${HOME} 2>/dev/null /usr/bin awk test ${HOME} export echo $(pwd)
+		"$1" printf --verbose /usr/bin "$1" sed export echo readonly --verbose $(pwd) echo
+	test cd x=1 2>/dev/null $(pwd)
+		--verbose ${HOME} 'quoted text' "$@" /usr/bin printf grep
+grep local cd ${HOME} && 'quoted text' grep | cd -eu grep export
+		-eu "$1" sed cd x=1 local "$@" printf
+		2>/dev/null -eu --verbose
+"$1" "$@" printf x=1 printf 2>/dev/null && -eu echo "$@" readonly
+	sed --verbose "$1" /usr/bin /usr/bin "$@" x=1 readonly
+	"$@" ${HOME} then | echo echo echo --verbose
+	done awk | | readonly -eu && "$1" x=1 grep 'quoted text'
+		"$@" "$1" readonly awk grep readonly then printf then $(pwd)
+/usr/bin ${HOME} | printf done -eu test local then |
+	export $(pwd) done readonly | then awk
+		grep ${HOME} && printf "$1" cd "$@" echo then "$1" export export 'quoted text'
+--verbose cd && then sed "$1"
+		${HOME} echo local done test readonly && "$@"
+	"$@" grep awk 2>/dev/null "$1" sed | grep &&
+		echo | readonly "$@" done
+--verbose "$1" awk 2>/dev/null "$1" 2>/dev/null local $(pwd) -eu 'quoted text'
+	/usr/bin $(pwd) x=1 "$1" done
+	printf awk echo then &&
+	then sed then 2>/dev/null echo done sed
+		then /usr/bin && sed cd cd readonly 'quoted text' x=1 done
+	awk readonly "$1" "$1" ${HOME} $(pwd) printf ${HOME} /usr/bin local "$1"
+		-eu sed grep sed done "$@" sed done $(pwd) awk awk /usr/bin ${HOME}
+'quoted text' echo done printf ${HOME} sed awk $(pwd) cd
+	export sed x=1 grep awk -eu -eu grep && readonly awk awk local cd sed
+/usr/bin /usr/bin 'quoted text' /usr/bin "$@" test x=1 'quoted text'
+		export grep x=1 | 'quoted text' x=1 sed 2>/dev/null export
+		then | --verbose export grep "$@" local --verbose 'quoted text' | echo
+		$(pwd) printf --verbose local echo cd export $(pwd) 2>/dev/null
+		then cd "$@" $(pwd) printf then readonly grep "$@" /usr/bin ${HOME} x=1
+		'quoted text' done | /usr/bin ${HOME} sed awk 2>/dev/null
+	awk | test x=1 export --verbose x=1
+		| done done done export
+		"$1" awk awk test sed export awk
+| readonly ${HOME} 'quoted text' awk sed cd grep export && readonly
+readonly readonly $(pwd) | "$1"
+		test printf --verbose | readonly export ${HOME} /usr/bin x=1
+	grep "$1" done local printf -eu then -eu sed grep 'quoted text'
+then awk awk /usr/bin x=1 "$@" sed printf $(pwd) |
+		grep $(pwd) 2>/dev/null sed awk --verbose 2>/dev/null "$@" export readonly -eu test
+		done /usr/bin then done
+--verbose "$1" -eu done local "$@" printf echo
+	cd printf then "$@" && /usr/bin | export 2>/dev/null "$1" /usr/bin --verbose
+	export $(pwd) 'quoted text' grep awk $(pwd) cd 2>/dev/null
+	echo /usr/bin x=1 2>/dev/null /usr/bin
+	printf /usr/bin then | printf
+		done | && echo "$@" cd test "$@" &&
+grep $(pwd) done | "$@" /usr/bin echo printf x=1 && ${HOME} grep
+echo sed ${HOME} test | x=1 "$1" export
+	cd grep grep "$@" -eu then 'quoted text' 'quoted text' /usr/bin && &&
+	done cd -eu x=1 x=1 awk 'quoted text'
+	printf 2>/dev/null ${HOME} | test grep -eu echo awk
+"$1" echo done "$@" 2>/dev/null $(pwd) 'quoted text' "$1"
+	-eu $(pwd) then test "$1" cd /usr/bin cd ${HOME}
+	awk $(pwd) then test done awk "$1" 'quoted text'
+	x=1 ${HOME} 2>/dev/null sed readonly export sed 'quoted text'
+		cd && 'quoted text' printf printf "$@" grep grep "$1" echo
+	awk done readonly then | 'quoted text'
+		$(pwd) cd $(pwd) readonly
+	2>/dev/null test && grep printf local done
+	test "$@" 2>/dev/null "$@" sed done --verbose local grep /usr/bin test /usr/bin
+	awk local readonly sed test readonly ${HOME} "$@" local -eu
+--verbose awk readonly cd printf
+2>/dev/null | -eu /usr/bin awk --verbose local readonly /usr/bin done grep 2>/dev/null
+grep "$1" x=1 "$@" awk then --verbose && local 'quoted text' sed export
+	-eu -eu 'quoted text' done echo awk readonly -eu "$@"
+	$(pwd) "$1" "$1" ${HOME}
+printf printf 'quoted text' 'quoted text'
+test echo $(pwd) then sed 2>/dev/null x=1 sed
+	'quoted text' "$1" 2>/dev/null printf
+"$1" 2>/dev/null printf -eu && /usr/bin --verbose sed 2>/dev/null
+		&& --verbose $(pwd) sed --verbose "$@" 2>/dev/null 2>/dev/null
+-eu then sed /usr/bin
+	cd readonly awk echo "$@" grep "$@" "$@" $(pwd) export echo
+--verbose "$@" echo readonly cd local
+'quoted text' 2>/dev/null "$1" --verbose --verbose then ${HOME} && local awk
+/usr/bin cd x=1 'quoted text' "$1" ${HOME} echo then 2>/dev/null readonly
+		sed then "$1" x=1 "$1" 2>/dev/null awk export -eu "$1"
+	awk 2>/dev/null sed sed echo --verbose 2>/dev/null 2>/dev/null
+then printf export "$1" --verbose ${HOME} done
+	&& local --verbose -eu readonly --verbose readonly /usr/bin /usr/bin grep
+		2>/dev/null && readonly sed "$1" cd --verbose "$1"
+		&& x=1 && sed -eu local
+then x=1 2>/dev/null ${HOME} printf /usr/bin "$1" grep done x=1 /usr/bin
+	"$1" 'quoted text' printf "$1" /usr/bin | export "$1" awk && then --verbose
+	${HOME} && --verbose "$1" echo export grep export 2>/dev/null
+		then $(pwd) test sed grep sed ${HOME}
+		$(pwd) ${HOME} then local done cd printf 2>/dev/null
+	echo /usr/bin printf cd export 2>/dev/null local ${HOME}
+		'quoted text' export readonly && done test test export 'quoted text'
+		$(pwd) "$@" export sed test sed export "$@" -eu && 2>/dev/null
+	echo printf $(pwd) grep
+	x=1 $(pwd) ${HOME} echo 2>/dev/null printf /usr/bin awk
+		echo 2>/dev/null cd awk awk /usr/bin printf ${HOME}
+		&& ${HOME} 'quoted text' 2>/dev/null
+		${HOME} 2>/dev/null 'quoted text' readonly grep readonly
+		${HOME} $(pwd) | awk then "$@" -eu && /usr/bin
+"$@" x=1 /usr/bin then local then 2>/dev/null done "$1" --verbose echo "$1" "$@"
+		printf ${HOME} 2>/dev/null 2>/dev/null && grep $(pwd) | then sed printf
+readonly /usr/bin 'quoted text' /usr/bin test then ${HOME} ${HOME} --verbose "$@"
+	cd "$@" test 2>/dev/null cd awk grep done "$@" $(pwd) local printf
+x=1 printf grep "$1" ${HOME}
+	test /usr/bin 2>/dev/null 'quoted text' 2>/dev/null test local
+	cd "$@" -eu | echo -eu test ${HOME} local ${HOME} readonly
+x=1 printf 'quoted text' 'quoted text' x=1
+		test --verbose $(pwd) grep grep && awk export && --verbose local 2>/dev/null
+	$(pwd) -eu cd then && -eu echo readonly && "$1" /usr/bin local --verbose
+		awk printf $(pwd) /usr/bin readonly echo
+	/usr/bin | "$1" --verbose /usr/bin
+	${HOME} "$1" 2>/dev/null printf local | sed export readonly 2>/dev/null
+		then "$1" cd /usr/bin "$@" /usr/bin "$1" -eu -eu
+	${HOME} readonly cd grep "$@" && export export readonly -eu
+	$(pwd) done test export cd readonly --verbose done
+	awk export export /usr/bin then /usr/bin awk grep readonly
+x=1 'quoted text' grep printf $(pwd) done ${HOME} sed $(pwd)
+readonly test x=1 grep test | readonly |
+export | "$1" printf echo grep ${HOME} && 'quoted text' $(pwd) -eu $(pwd)
+		"$1" then --verbose awk ${HOME} 2>/dev/null x=1 cd x=1 --verbose 2>/dev/null 2>/dev/null
+	&& 2>/dev/null 2>/dev/null
+	local | --verbose then 2>/dev/null done done sed ${HOME} | x=1 && $(pwd)
+$(pwd) done cd echo printf 2>/dev/null -eu grep
+	done && export export -eu 'quoted text' cd 'quoted text' sed done "$1" --verbose
+$(pwd) test cd ${HOME} ${HOME} "$1" then $(pwd) local local
+cd $(pwd) grep local awk readonly test -eu then printf
+		--verbose printf done $(pwd) -eu then
+	x=1 cd printf && "$@" echo sed
+	awk ${HOME} grep cd 'quoted text' then sed then then
+		cd $(pwd) then local | --verbose
+	readonly $(pwd) done readonly | local x=1 /usr/bin /usr/bin
+	x=1 local local cd x=1 "$@" 'quoted text' local
+		"$1" 2>/dev/null ${HOME} /usr/bin ${HOME} && 'quoted text'
+		local -eu --verbose ${HOME} -eu then -eu
+	local x=1 export printf done 2>/dev/null echo local
+	then /usr/bin echo x=1 "$1" --verbose then local $(pwd)
+export --verbose echo 'quoted text' --verbose export
+	sed done /usr/bin then export test local awk && x=1 2>/dev/null ${HOME}
+		"$1" --verbose 2>/dev/null | /usr/bin printf /usr/bin awk -eu ${HOME}
+--verbose "$1" test echo local ${HOME} done local "$1" local grep -eu export
+		2>/dev/null export printf
+		${HOME} 'quoted text' x=1 | local 'quoted text'
+printf && x=1 "$@" sed 'quoted text'
+	printf readonly local echo then cd printf then 'quoted text' --verbose then "$1"
+		/usr/bin sed "$@" && | 'quoted text' export then -eu test
+		printf done local readonly | awk cd | echo | 2>/dev/null "$@" /usr/bin "$@"
+	export x=1 sed grep grep readonly |
+		local -eu sed 'quoted text' x=1 readonly
+		"$1" 2>/dev/null readonly -eu "$@" sed
+		${HOME} printf local /usr/bin && | cd sed export x=1 awk "$1"
+	awk && /usr/bin readonly x=1 export --verbose ${HOME} 'quoted text' x=1 $(pwd)
+		sed done --verbose echo grep local then
+		x=1 /usr/bin test then awk export 2>/dev/null sed awk /usr/bin awk && cd --verbose
+--verbose grep -eu && "$@" "$@" | x=1 printf 'quoted text' /usr/bin && 'quoted text'
+cd | grep test awk --verbose | 'quoted text'
+	then grep awk export $(pwd) local echo "$1" ${HOME} printf
+	cd done grep 2>/dev/null test export export awk done awk
+	$(pwd) $(pwd) "$@" $(pwd) local grep
+		export $(pwd) readonly awk $(pwd) x=1 test sed $(pwd)
+	--verbose ${HOME} grep grep printf cd done then
+printf 'quoted text' /usr/bin printf
+	grep 'quoted text' printf test -eu export $(pwd) x=1 printf awk cd
+	x=1 cd x=1 awk then printf && x=1 $(pwd)
+		x=1 && sed done ${HOME} awk done printf export && --verbose cd | 'quoted text'
+	awk done cd x=1 'quoted text'
+"$@" done awk /usr/bin $(pwd) "$@" "$@"
+	printf export | 2>/dev/null readonly $(pwd) echo "$@" awk "$@" | sed cd
+		x=1 sed -eu local grep grep -eu then "$1" "$@" /usr/bin /usr/bin
+		printf printf local 'quoted text' sed cd export awk local done --verbose
+'quoted text' grep readonly awk | ${HOME} printf cd cd && sed printf 2>/dev/null
+grep ${HOME} test /usr/bin "$@" echo x=1 grep $(pwd)
+		sed "$1" && ${HOME} x=1 | readonly x=1 /usr/bin "$@" "$1" test cd /usr/bin
+		local grep && cd awk cd cd 2>/dev/null
+	echo test done "$@" /usr/bin
+echo cd "$@" ${HOME} readonly
+	'quoted text' done awk | x=1 then && "$1" done export printf sed
+	export export readonly 'quoted text' --verbose printf done
+		echo | ${HOME} && grep && "$1" ${HOME} grep export cd
+"$@" readonly awk echo | then test test
+/usr/bin done 'quoted text'
+test $(pwd) 2>/dev/null $(pwd)
+	| ${HOME} 2>/dev/null echo 2>/dev/null 2>/dev/null printf done
+		/usr/bin done readonly export sed local "$@"
+	test done grep then --verbose done awk x=1 "$1" 'quoted text' ${HOME} -eu -eu
+	'quoted text' | /usr/bin readonly 'quoted text' then
+		printf printf test grep 'quoted text' /usr/bin
+local printf | done grep 'quoted text' 2>/dev/null
+		awk then grep --verbose readonly && "$@" export ${HOME} | awk "$1"
+	local awk then ${HOME} printf
+&& /usr/bin $(pwd) local export grep readonly --verbose
+	--verbose $(pwd) "$1" -eu cd -eu $(pwd) awk grep done "$@" local echo
+		cd && done then printf x=1 --verbose
+		cd $(pwd) grep && then printf readonly
+		done grep x=1 'quoted text'
+		readonly done test ${HOME} $(pwd) 'quoted text' && readonly
+awk sed cd sed | "$1" cd
+	"$@" --verbose awk "$1" done echo readonly $(pwd) $(pwd) grep then
+	sed sed "$1" sed sed "$1" sed done --verbose readonly test 2>/dev/null 'quoted text'
+	"$@" -eu | sed $(pwd) then -eu done export
+cd awk grep $(pwd) x=1 ${HOME} -eu $(pwd) printf --verbose
+		test | readonly echo /usr/bin grep awk readonly "$1" | sed "$@" /usr/bin local
+		"$@" "$@" --verbose /usr/bin -eu "$@" x=1 x=1 grep ${HOME} grep readonly
+		&& grep then awk export local local readonly done export x=1 done
+$(pwd) echo awk /usr/bin test | local x=1 local printf -eu "$@" grep
+	then grep grep readonly
+$(pwd) | local && echo awk /usr/bin -eu readonly ${HOME} sed cd ${HOME} x=1 |
+		done /usr/bin $(pwd) 'quoted text' /usr/bin local /usr/bin echo
+		x=1 export 'quoted text' readonly
+	$(pwd) export echo /usr/bin 2>/dev/null "$@" --verbose "$@"
+	&& local "$@" grep --verbose ${HOME} --verbose local sed readonly 'quoted text'
+	x=1 --verbose grep local cd |
+test | -eu 2>/dev/null -eu ${HOME}
+	"$1" echo && "$1" "$@" sed --verbose
+	readonly awk grep done echo local x=1 export printf $(pwd) grep && awk "$@"
+awk | done local grep done "$1" then test
+		'quoted text' readonly echo readonly ${HOME}
+		done "$1" /usr/bin done 2>/dev/null | $(pwd) local then then
+		echo test printf 2>/dev/null
+		"$1" 2>/dev/null sed "$1" test
+		sed "$@" local x=1 "$@" sed /usr/bin then x=1 then ${HOME} printf
+		-eu awk 'quoted text' grep "$1" $(pwd) 2>/dev/null done x=1 /usr/bin then
+	$(pwd) /usr/bin export printf ${HOME} export test awk ${HOME}
+		done 'quoted text' | grep 'quoted text' && then -eu then && awk 2>/dev/null
+$(pwd) "$@" awk x=1 grep ${HOME} && awk "$1" grep then 2>/dev/null
+awk readonly export 'quoted text'
+		readonly && --verbose -eu awk echo then export readonly 2>/dev/null -eu 'quoted text'
+	echo local export "$1" "$1" && printf 'quoted text' ${HOME} done
+$(pwd) printf printf -eu
+		echo ${HOME} awk done $(pwd) awk | local grep x=1 -eu readonly printf /usr/bin
+	$(pwd) 'quoted text' /usr/bin grep grep test test 'quoted text'
+		"$@" 2>/dev/null $(pwd) &&
+grep --verbose awk grep readonly awk readonly then local 2>/dev/null
+echo test test ${HOME} readonly 'quoted text' done $(pwd)
+		local sed test | && then cd "$1" test cd --verbose -eu done grep $(pwd) local
+		$(pwd) "$1" | 2>/dev/null -eu grep awk
+awk echo "$@" --verbose -eu && sed 'quoted text'
+	grep ${HOME} --verbose 2>/dev/null "$@" then grep sed -eu --verbose export readonly
+	awk export --verbose readonly --verbose ${HOME} x=1 grep printf echo
+readonly ${HOME} printf ${HOME}
+"$@" ${HOME} $(pwd) $(pwd) 'quoted text'
+'quoted text' local export "$@" /usr/bin
+	awk && sed ${HOME} local grep readonly
+		${HOME} sed 'quoted text'
+test x=1 2>/dev/null cd readonly done test x=1 && "$@" awk readonly
+	&& export | $(pwd) export "$1" sed test x=1 cd echo
+		${HOME} -eu ${HOME} done
+export 2>/dev/null $(pwd) then 2>/dev/null sed echo local grep 'quoted text'
+	/usr/bin && test /usr/bin "$@" readonly $(pwd) x=1 |
+	then awk | done /usr/bin && cd cd test test sed | sed
+/usr/bin cd readonly | $(pwd) local echo then test $(pwd) then local --verbose
+		2>/dev/null /usr/bin -eu $(pwd) then | sed "$@"
+"$1" done --verbose $(pwd)
+		sed grep && 'quoted text' printf
+	${HOME} 2>/dev/null awk "$@" done | --verbose "$@" awk | then sed --verbose --verbose
+$(pwd) local echo awk done done 2>/dev/null
+done && $(pwd) ${HOME} 2>/dev/null | | --verbose
+	done done cd test then ${HOME} /usr/bin 2>/dev/null awk 'quoted text' cd && awk
+	"$1" sed grep cd export "$@" ${HOME}
+	test | echo done printf && 'quoted text'
+	$(pwd) cd readonly x=1 x=1 printf
+sed && test | $(pwd) local readonly readonly grep then | grep -eu "$@" test echo
+done local 'quoted text'
+		--verbose -eu ${HOME} local x=1 x=1 ${HOME} export readonly $(pwd) | -eu
+then test && echo 'quoted text' readonly
+	x=1 export 2>/dev/null done -eu sed "$1" grep echo
+	local "$1" 'quoted text' echo readonly
+	$(pwd) sed /usr/bin test -eu /usr/bin --verbose grep local export 'quoted text'
+		export && grep "$1" 'quoted text' 2>/dev/null then
+		/usr/bin grep 'quoted text' grep -eu 2>/dev/null grep ${HOME}
+export ${HOME} echo sed 2>/dev/null done test --verbose $(pwd)
+then done | /usr/bin local awk | "$@" $(pwd) awk done /usr/bin readonly
+'quoted text' 'quoted text' then test then printf -eu
+		&& awk awk cd ${HOME} local test 'quoted text'
+		then 2>/dev/null $(pwd) export grep sed
+'quoted text' ${HOME} 'quoted text' done echo -eu cd --verbose
+		done /usr/bin | local ${HOME} -eu "$@" -eu done export local $(pwd) local
+	grep then awk test x=1 export readonly 2>/dev/null awk /usr/bin
+		local grep /usr/bin --verbose 'quoted text'
+	x=1 awk 'quoted text' printf /usr/bin printf --verbose local readonly local
+echo readonly grep printf | export | local grep $(pwd)
+	--verbose ${HOME} x=1 x=1 -eu $(pwd) && export /usr/bin
+	'quoted text' "$1" printf $(pwd) grep export -eu export then $(pwd)
+$(pwd) && --verbose test echo
+	sed echo done /usr/bin 'quoted text' local && "$1" awk | printf "$@"
+		echo local "$@" sed -eu then done echo sed sed 'quoted text'
+	printf x=1 echo local /usr/bin cd /usr/bin "$1" grep done /usr/bin
+		"$@" test readonly x=1 -eu awk echo
+	/usr/bin 'quoted text' awk --verbose test test export -eu
+"$1" 2>/dev/null && test echo "$@"
+export x=1 2>/dev/null test /usr/bin
+		done "$1" -eu $(pwd) awk echo grep done && cd | | cd 'quoted text' test "$1" local
+	grep echo printf test /usr/bin export x=1 ${HOME} 'quoted text'
+		test --verbose 2>/dev/null sed cd grep 2>/dev/null
+	export 'quoted text' "$1" then grep printf --verbose 'quoted text'
+		cd "$@" cd printf done test 'quoted text' then readonly then 'quoted text' test
+export | "$1" "$1" /usr/bin cd awk && sed -eu cd awk
+		sed 2>/dev/null test cd printf printf echo
+		awk "$@" "$@" /usr/bin sed readonly 2>/dev/null
+	${HOME} awk then sed printf test /usr/bin "$@" x=1
+		export x=1 $(pwd) x=1 cd grep awk $(pwd) then local x=1 2>/dev/null local
+test -eu 'quoted text' x=1 x=1 echo cd /usr/bin
+${HOME} ${HOME} --verbose 2>/dev/null
+	export 2>/dev/null --verbose 'quoted text'
+-eu printf then x=1 awk test
+		| sed printf readonly local sed "$1" --verbose local $(pwd) 'quoted text'
+	echo /usr/bin awk export
+		sed && 2>/dev/null 2>/dev/null sed ${HOME}
+		2>/dev/null sed x=1 test printf test
+	grep sed then local printf
+export test $(pwd) "$1" export awk ${HOME} awk sed done
+		readonly 'quoted text' 2>/dev/null | sed awk done grep -eu grep test
+"$1" "$1" done echo cd done | && test grep export --verbose printf
+	$(pwd) x=1 $(pwd) "$1" 2>/dev/null awk local local
+printf export echo echo awk
+	local -eu echo /usr/bin echo awk readonly --verbose grep cd "$1" $(pwd)
+	awk then printf -eu ${HOME} readonly
+local sed then test readonly awk ${HOME} /usr/bin awk then awk --verbose "$1"
+"$@" sed "$@" 2>/dev/null $(pwd) 2>/dev/null export readonly 'quoted text'
+		done /usr/bin "$@" local ${HOME} then test
+export -eu export 2>/dev/null 2>/dev/null then -eu then test export 'quoted text'
+grep | printf "$@" 'quoted text' sed sed cd | x=1 | "$1" echo printf
+-eu cd sed 2>/dev/null then "$@" ${HOME} | grep awk readonly
+		x=1 echo 'quoted text' -eu 2>/dev/null
+	grep echo "$@" ${HOME} local then && test x=1 sed export grep 'quoted text' grep
+		| -eu ${HOME} $(pwd) sed test 'quoted text' done readonly
+		echo -eu && $(pwd) local | export
+	echo test cd "$@" sed test --verbose
+local 'quoted text' 2>/dev/null 'quoted text'
+		| --verbose awk x=1 awk export --verbose
+		done sed ${HOME} cd -eu
+x=1 "$1" /usr/bin printf ${HOME} test 'quoted text' --verbose 'quoted text' -eu
+${HOME} --verbose done -eu awk then local
+2>/dev/null && cd 'quoted text' "$@" then --verbose done
+	sed $(pwd) done export $(pwd) echo /usr/bin
+		local --verbose test awk done export sed local export | readonly test
+		echo --verbose printf awk
+	export grep readonly && | done "$@" awk
+	2>/dev/null test then grep grep readonly "$1" done awk
+		"$@" $(pwd) ${HOME} 2>/dev/null ${HOME}
+	x=1 2>/dev/null cd |
+		done && cd echo echo 'quoted text' grep sed $(pwd) /usr/bin
+local grep $(pwd) cd -eu readonly
+	printf echo | 2>/dev/null "$1" echo test grep "$@"
+/usr/bin ${HOME} $(pwd) echo sed ${HOME} ${HOME} local then
+grep -eu /usr/bin 'quoted text'
+$(pwd) 'quoted text' /usr/bin
+--verbose local printf export $(pwd) export "$1" | "$@" readonly
+		x=1 cd cd then ${HOME} "$@" && /usr/bin | export done test && "$1" /usr/bin
+printf grep "$1" then && ${HOME} | ${HOME}
+		cd test "$@" && cd x=1 grep "$1"
+	| local awk "$@" | echo test x=1 "$@" "$1" --verbose then 2>/dev/null 'quoted text'
+local /usr/bin local x=1
+		x=1 readonly echo cd --verbose && /usr/bin /usr/bin export grep printf
+	$(pwd) readonly x=1 |
+test $(pwd) 'quoted text' export x=1 sed ${HOME} --verbose | "$@" 2>/dev/null
+	2>/dev/null ${HOME} printf x=1 -eu
+	awk 'quoted text' sed grep grep printf | 2>/dev/null test
+		local | printf | /usr/bin /usr/bin echo x=1
+	-eu | 'quoted text' ${HOME} $(pwd) test
+		local export x=1 ${HOME} local
+local printf "$1" grep /usr/bin done | sed local cd 'quoted text'
+	--verbose x=1 | cd 'quoted text' printf
+&& sed | /usr/bin grep 'quoted text' readonly grep cd awk x=1 printf && | printf
+grep 'quoted text' then /usr/bin grep then printf && export printf export ${HOME}
+&& grep export export readonly
+	'quoted text' cd --verbose done /usr/bin readonly
+	&& 2>/dev/null --verbose &&
+	'quoted text' "$1" && sed test echo grep x=1 | x=1 /usr/bin $(pwd)
+--verbose sed cd cd "$1" && x=1 && $(pwd) 'quoted text'
+$(pwd) cd $(pwd) && 'quoted text' then -eu "$@"
+	"$1" 'quoted text' cd grep echo $(pwd) /usr/bin cd sed "$1" done
+	echo then "$1" printf "$@" local
+	test export "$@" then test cd "$1" cd "$1"
+		-eu test sed export done sed readonly | 'quoted text'
+		export then -eu -eu /usr/bin
+	grep /usr/bin awk echo ${HOME} grep sed
+'quoted text' then grep ${HOME} local local 2>/dev/null
+	cd "$1" printf x=1 --verbose cd printf test readonly
+| $(pwd) "$1" 2>/dev/null awk "$@"
+	export -eu 'quoted text' printf done | ${HOME} echo | then sed "$1" sed 2>/dev/null
+	sed 'quoted text' test
+		cd 2>/dev/null echo awk done grep --verbose --verbose "$1" echo |
+then 'quoted text' | "$1" local "$@" "$1" sed /usr/bin
+done test && cd "$@" ${HOME} && "$@" done $(pwd) | then
+	awk 'quoted text' test 2>/dev/null "$1" awk done test ${HOME}
+	| echo sed x=1 | then 2>/dev/null
+	sed $(pwd) printf local readonly test export | | awk printf ${HOME}
+cd --verbose /usr/bin | && "$1" 2>/dev/null grep sed
+		"$@" export /usr/bin done /usr/bin "$1" cd 2>/dev/null -eu "$@" 'quoted text'
+-eu test grep local local ${HOME} awk x=1 then done ${HOME}
+		export done && cd | awk 2>/dev/null sed /usr/bin ${HOME} test
+		"$@" "$@" && "$1" export 'quoted text'
+	"$1" readonly echo --verbose
+	echo sed awk ${HOME} grep -eu ${HOME} && "$@" 2>/dev/null x=1 -eu done
+	--verbose grep done x=1 /usr/bin
+	x=1 then "$1" grep ${HOME} awk x=1 local
+	$(pwd) cd 'quoted text'
+		/usr/bin export printf ${HOME} | $(pwd) awk /usr/bin sed
+		sed x=1 'quoted text' awk echo cd --verbose then x=1
+grep /usr/bin local then ${HOME} "$1" printf printf
+		test x=1 then "$1" /usr/bin | --verbose /usr/bin --verbose $(pwd) /usr/bin
+awk cd --verbose && printf
+awk test 'quoted text' export local done
+	x=1 echo /usr/bin test readonly test /usr/bin $(pwd)
+	awk readonly "$1" done
+	&& | x=1 printf ${HOME} grep readonly 'quoted text'
+then -eu readonly && "$@" local && grep "$1" $(pwd) $(pwd) /usr/bin
+		| --verbose grep 2>/dev/null | ${HOME} 2>/dev/null --verbose printf
+		then awk export $(pwd) awk -eu ${HOME} -eu
+	"$@" awk x=1 local done test local -eu sed test test
+		cd ${HOME} then readonly
+	-eu grep --verbose -eu export awk awk 2>/dev/null
+	printf local ${HOME} test echo readonly -eu grep printf cd 'quoted text'
+	sed grep ${HOME} grep cd echo --verbose echo -eu
+	--verbose x=1 'quoted text' awk $(pwd) && local export
+		cd then echo "$1" echo readonly 2>/dev/null
+done "$1" $(pwd) --verbose local awk /usr/bin | grep $(pwd)
+/usr/bin grep sed sed /usr/bin cd cd grep x=1 x=1 -eu x=1 printf then test
+"$1" export grep printf /usr/bin "$@" test /usr/bin
+awk grep cd export readonly
+		$(pwd) 2>/dev/null --verbose printf then | x=1 --verbose grep grep awk
+	--verbose x=1 /usr/bin done
+		sed echo "$@" echo grep && --verbose
+	readonly 2>/dev/null x=1 --verbose
+	x=1 local grep ${HOME} --verbose $(pwd) grep | "$@" test echo -eu
+		grep 'quoted text' 2>/dev/null grep sed | ${HOME} then $(pwd) readonly |
+	cd local 'quoted text' then 2>/dev/null -eu echo $(pwd)
+cd sed export 2>/dev/null sed then "$1" sed echo grep
+local then -eu then then cd -eu --verbose echo printf grep 2>/dev/null "$@" test
+	-eu $(pwd) -eu 2>/dev/null printf $(pwd) x=1 sed | echo awk grep "$@" printf
+2>/dev/null x=1 && readonly sed test test sed test |
+local test x=1 cd --verbose && done "$@" |
+	readonly -eu printf && ${HOME}
+	sed grep --verbose 2>/dev/null test then "$@" x=1 "$@" --verbose 2>/dev/null
+		awk ${HOME} ${HOME} echo awk readonly
+2>/dev/null 'quoted text' cd awk
+test -eu -eu export /usr/bin 2>/dev/null then x=1 $(pwd) grep --verbose /usr/bin
+| "$@" grep export readonly local 'quoted text' 2>/dev/null printf printf export
+	printf sed ${HOME} sed printf --verbose readonly test awk done && awk ${HOME} /usr/bin
+		'quoted text' cd 2>/dev/null done 'quoted text'
+	${HOME} $(pwd) 'quoted text' echo printf cd export "$@" --verbose done export
+echo export -eu readonly grep readonly
+		$(pwd) | cd && echo "$@" cd
+	grep "$1" awk printf export 'quoted text' awk awk x=1 -eu printf then
+		export && readonly export /usr/bin "$@" printf local -eu cd readonly $(pwd) grep
+		echo printf -eu 2>/dev/null grep awk /usr/bin 2>/dev/null echo -eu readonly
+		"$1" | readonly ${HOME} ${HOME} "$@" cd readonly
+test $(pwd) ${HOME} "$1" printf /usr/bin readonly
+	| echo awk cd x=1 echo test -eu readonly grep
+	"$1" && && export ${HOME} then 2>/dev/null printf | "$1"
+	x=1 && cd "$1" x=1 local $(pwd) /usr/bin then export ${HOME} grep grep $(pwd) &&
+	'quoted text' 2>/dev/null grep ${HOME}
+	sed --verbose ${HOME} /usr/bin grep 'quoted text' sed sed "$@" | "$@" cd
+grep "$1" ${HOME} ${HOME} | echo x=1 readonly cd done $(pwd) -eu &&
+sed then /usr/bin ${HOME} "$1" 2>/dev/null "$@" test printf done done
+		&& x=1 ${HOME} x=1 echo "$1" cd printf 'quoted text' && "$1"
+	awk cd then test && readonly 'quoted text' cd awk /usr/bin -eu
+		"$@" echo cd | -eu -eu export "$@"
+	cd grep test grep cd x=1 "$1" --verbose readonly && done
+	readonly done export then | printf && then
+		printf | test $(pwd) | --verbose
+	--verbose /usr/bin test -eu
+	/usr/bin -eu x=1 -eu ${HOME} cd /usr/bin
+		cd 'quoted text' awk echo readonly readonly awk readonly && done --verbose && echo
+		sed "$@" ${HOME} readonly test echo done sed test $(pwd) "$@" -eu printf $(pwd)
+		test "$@" 2>/dev/null readonly /usr/bin x=1
+"$1" printf echo "$@" $(pwd) /usr/bin
+"$1" done 'quoted text' && echo grep awk "$@" --verbose readonly x=1 "$@"
+		"$1" local -eu --verbose echo export 2>/dev/null /usr/bin -eu ${HOME} printf
+	2>/dev/null && printf x=1 --verbose --verbose export "$@" | export printf
+	x=1 test readonly "$1" && x=1 --verbose ${HOME} done printf x=1 echo "$1" 'quoted text'
+'quoted text' -eu "$1" 'quoted text'
+		'quoted text' grep export export echo --verbose printf ${HOME}
+	sed x=1 local printf export | -eu then $(pwd) cd local echo
+		| | export 'quoted text' cd "$@" | then 'quoted text'
+		'quoted text' then sed | cd && --verbose "$@" awk sed 'quoted text' -eu grep
+echo sed echo sed readonly grep test 2>/dev/null local done then /usr/bin
+awk | x=1 cd $(pwd) printf -eu $(pwd) "$@" grep
+		--verbose "$@" export readonly -eu -eu awk test cd ${HOME} "$1" local "$@" 2>/dev/null
+		"$1" 'quoted text' /usr/bin
+		export sed export "$1" done
+	awk cd $(pwd) printf export echo readonly test | then -eu echo echo && local
+		/usr/bin done awk local printf &&
+		echo echo local local x=1 /usr/bin | -eu awk echo test done 'quoted text'
+		readonly && printf awk -eu then sed sed grep "$1"
+		2>/dev/null "$@" 2>/dev/null then local --verbose && done /usr/bin
+		printf "$@" 2>/dev/null awk |
+	| x=1 ${HOME} /usr/bin awk &&
+		sed printf "$1" export | /usr/bin "$@"
+"$1" /usr/bin /usr/bin
+	test "$1" --verbose ${HOME} sed "$@" -eu done | printf done | then grep --verbose
+	"$@" x=1 2>/dev/null echo then export sed printf 'quoted text' "$@" done
+x=1 done printf ${HOME} test 2>/dev/null /usr/bin $(pwd) 'quoted text' export
+| export test --verbose awk done echo cd awk test echo
+		&& --verbose test "$@" x=1 -eu 'quoted text' local
+		-eu $(pwd) grep done readonly test && "$@" then /usr/bin $(pwd) --verbose
+2>/dev/null "$1" sed echo local cd | then grep
+	cd -eu printf ${HOME} export export
+	--verbose echo && echo sed
+"$@" test printf "$@" 2>/dev/null $(pwd) then | grep cd --verbose && 2>/dev/null
+	&& ${HOME} awk "$@" printf then && ${HOME} local grep then /usr/bin
+	done test $(pwd) cd cd test export awk
+test --verbose 2>/dev/null "$@" then
+	"$@" awk echo $(pwd) cd 'quoted text'
+	'quoted text' done readonly && done -eu -eu && 2>/dev/null "$@" sed -eu 2>/dev/null
+printf $(pwd) ${HOME} sed -eu
+		| test local done x=1 -eu sed echo echo
+--verbose then | export sed x=1 'quoted text' /usr/bin 2>/dev/null cd awk
+	$(pwd) x=1 export test echo local
+cd ${HOME} /usr/bin test done -eu test done
+$(pwd) 2>/dev/null readonly /usr/bin "$1" --verbose
+		$(pwd) export sed "$@"
+	printf 'quoted text' ${HOME} ${HOME} sed /usr/bin test ${HOME}
+cd grep printf && "$@" $(pwd)
+	echo local | -eu --verbose local awk -eu x=1 2>/dev/null echo sed 'quoted text'
+		sed $(pwd) 'quoted text' printf grep | printf export done
+x=1 "$1" local 2>/dev/null
+2>/dev/null --verbose test "$1" local && &&
+echo printf --verbose local "$1" "$@" local
+		local echo sed "$@" printf
+| --verbose cd $(pwd) done $(pwd) export /usr/bin then "$@" export grep
+-eu 2>/dev/null $(pwd) done cd export
+local grep /usr/bin test $(pwd) ${HOME} printf $(pwd) -eu --verbose
+	awk then then export then printf $(pwd) printf
+		printf ${HOME} -eu /usr/bin test x=1 | grep "$@"
+	then then 'quoted text'
+		local 2>/dev/null 'quoted text' $(pwd) -eu 2>/dev/null
+	| "$@" && awk | "$@" done | then
+-eu | readonly /usr/bin -eu $(pwd) 'quoted text'
+awk $(pwd) cd $(pwd) echo
+		${HOME} readonly "$@" awk 2>/dev/null export readonly
+/usr/bin cd -eu sed --verbose
+	/usr/bin "$1" export export
+	| | export ${HOME} "$@" echo 2>/dev/null cd "$@" sed done | ${HOME} "$1" printf
+		printf "$1" | echo echo 'quoted text'
+	then then $(pwd) x=1 $(pwd)
+	2>/dev/null printf printf sed then x=1 'quoted text' test "$@"
+		"$1" printf ${HOME} test 'quoted text' -eu 'quoted text'
+	local done && --verbose export awk awk awk /usr/bin cd printf
+&& printf cd x=1 | "$1" | readonly local -eu -eu done done | grep echo sed x=1
+		"$@" sed x=1 grep test && /usr/bin local 2>/dev/null local && export
+| ${HOME} echo "$1" 'quoted text' $(pwd) done -eu
+		cd ${HOME} -eu test x=1 &&
+		sed | 2>/dev/null -eu printf done "$1" then
+		${HOME} 'quoted text' export awk && 'quoted text' sed readonly --verbose
+		"$@" echo done sed && cd echo --verbose
+	-eu x=1 -eu local awk cd done | ${HOME} /usr/bin awk grep readonly readonly 2>/dev/null
+	export local ${HOME} --verbose "$@" grep cd then
+printf /usr/bin local "$@" readonly printf
+"$1" printf done then | sed then cd then
+	$(pwd) "$1" echo "$@" 2>/dev/null ${HOME} ${HOME}
+	done export | ${HOME} local local cd && | printf local sed 2>/dev/null local
+then "$1" --verbose cd readonly 'quoted text' 2>/dev/null -eu && test
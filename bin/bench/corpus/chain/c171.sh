@@ -0,0 +1,2001 @@
+	export x=1 printf cd grep readonly done readonly echo "$1" -eu /usr/bin echo
+	sed /usr/bin -eu /usr/bin awk /usr/bin printf echo grep
+--verbose printf done awk grep x=1 ${HOME} -eu then /usr/bin ${HOME}
+	"$1" sed then export export done "$1" test "$@"
+		| cd /usr/bin test | echo |
+"$@" done --verbose test grep test echo
+	${HOME} printf done 2>/dev/null readonly /usr/bin "$@" awk 'quoted text'
+"$1" ${HOME} export x=1 printf $(pwd) then printf readonly
+	done awk test export awk local printf | --verbose
+	readonly printf then "$@" done grep test $(pwd)
+	awk awk "$@" local -eu 'quoted text'
+		test $(pwd) grep readonly cd local $(pwd) ${HOME} --verbose $(pwd) then
+	2>/dev/null ${HOME} "$1" echo && test 'quoted text' /usr/bin then local printf
+printf | /usr/bin 2>/dev/null 'quoted text' && /usr/bin
+		readonly x=1 2>/dev/null then
+	then /usr/bin cd sed "$1" 2>/dev/null x=1 && "$1" sed readonly
+	cd ${HOME} && --verbose 2>/dev/null 2>/dev/null export
+--verbose | ${HOME} | printf
+		-eu then "$@" --verbose awk ${HOME} echo --verbose 2>/dev/null awk
+		'quoted text' /usr/bin local /usr/bin cd "$1" ${HOME} printf cd x=1 2>/dev/null
+		cd -eu cd ${HOME} local then -eu
+		grep 'quoted text' local awk sed | echo
+		local /usr/bin "$@" "$1" --verbose "$@" x=1 $(pwd) cd done grep export
+--verbose sed echo | sed && 'quoted text' 'quoted text' && readonly 'quoted text'
+		"$@" test readonly ${HOME} 2>/dev/null sed export
+		--verbose $(pwd) grep
+		echo done sed sed | local --verbose x=1 x=1
+		cd $(pwd) printf "$@" $(pwd) && readonly
+	awk && readonly awk echo grep x=1 $(pwd)
+"$@" x=1 "$@" -eu then ${HOME} export $(pwd) && cd test done printf echo done grep
+		| done "$@" readonly test && cd local && x=1 2>/dev/null "$1" 'quoted text'
+$(pwd) && test cd test
+then echo -eu $(pwd) x=1 export "$@" test ${HOME}
+		--verbose grep then /usr/bin done done x=1 test | $(pwd)
+	--verbose "$1" "$@" -eu then
+	grep local /usr/bin local -eu $(pwd) test /usr/bin done echo test
+	printf 'quoted text' grep 'quoted text' /usr/bin -eu echo --verbose
+	done "$1" ${HOME} --verbose grep grep ${HOME} /usr/bin
+	/usr/bin grep 'quoted text' then cd --verbose printf sed awk echo /usr/bin
+printf x=1 test readonly
+		$(pwd) -eu "$@" | then ${HOME} export then awk "$1" cd
+	export x=1 "$@" echo printf 2>/dev/null
+/usr/bin then grep test local
+	$(pwd) 'quoted text' 2>/dev/null local grep printf test --verbose
+2>/dev/null printf x=1 cd "$@" export /usr/bin
+test 2>/dev/null export cd printf "$@" cd then "$@" echo export then readonly
+	readonly readonly export --verbose
+	then x=1 --verbose echo sed printf x=1 then local 2>/dev/null
+printf ${HOME} ${HOME} /usr/bin awk $(pwd)
+x=1 x=1 2>/dev/null readonly cd --verbose "$1" -eu "$1" export printf
+		local | readonly local && -eu | sed cd export /usr/bin awk --verbose 'quoted text'
+&& test printf && grep echo then grep -eu export readonly
+${HOME} then $(pwd) cd | grep
+		export done -eu sed then "$@" awk && && 'quoted text'
+test --verbose echo --verbose
+cd $(pwd) ${HOME} 'quoted text' grep printf 'quoted text' 'quoted text' 2>/dev/null
+$(pwd) --verbose /usr/bin
+		then "$1" --verbose grep x=1 sed "$1" --verbose
+		echo readonly 'quoted text' grep x=1
+/usr/bin grep "$1" 'quoted text' grep ${HOME} $(pwd)
+"$@" 2>/dev/null done /usr/bin --verbose readonly local cd
+		printf && printf local printf && test readonly "$1" sed && then
+		$(pwd) && sed done printf cd export echo ${HOME}
+${HOME} printf --verbose cd /usr/bin
+	readonly "$@" --verbose "$@" 2>/dev/null export done awk --verbose
+	test /usr/bin -eu awk grep "$1" ${HOME} "$@" 'quoted text'
+	2>/dev/null awk /usr/bin then 'quoted text' 'quoted text'
+		readonly sed local done then test -eu $(pwd) "$@" export echo export printf
+${HOME} && x=1 sed printf "$1"
+		'quoted text' $(pwd) export -eu /usr/bin printf -eu export test | x=1
+then -eu 'quoted text' $(pwd) | | "$@" awk /usr/bin
+printf cd $(pwd) x=1 then local cd -eu -eu "$@" ${HOME} then export "$1" local
+	--verbose 'quoted text' x=1 ${HOME} $(pwd) grep x=1 | "$@" then $(pwd) test 'quoted text'
+readonly | "$1" 'quoted text' export readonly echo /usr/bin && /usr/bin
+	grep x=1 readonly 'quoted text'
+		&& awk awk $(pwd) ${HOME} "$1" done -eu sed echo 'quoted text'
+${HOME} awk echo local $(pwd)
+		awk 'quoted text' $(pwd) "$1" printf awk then printf sed
+	--verbose awk cd local $(pwd) $(pwd) cd sed
+		grep | ${HOME} && 2>/dev/null readonly x=1 'quoted text'
+then 2>/dev/null sed printf grep
+	grep /usr/bin printf 2>/dev/null test 2>/dev/null local --verbose --verbose
+	"$@" && test $(pwd) awk --verbose grep test
+/usr/bin && --verbose 2>/dev/null export && then readonly
+		/usr/bin then && printf | $(pwd) "$@" test "$1" --verbose $(pwd) sed ${HOME}
+		-eu awk local && export
+cd && --verbose /usr/bin
+${HOME} $(pwd) $(pwd)
+test readonly cd awk && x=1 local /usr/bin done
+	| && ${HOME} grep grep x=1 sed "$1" -eu grep | "$@"
+	"$@" done | /usr/bin readonly printf grep printf x=1 $(pwd)
+	done && awk then x=1 ${HOME} /usr/bin x=1 x=1 ${HOME} export --verbose --verbose
+--verbose --verbose -eu done $(pwd) -eu ${HOME} export readonly
+	test -eu done /usr/bin
+		then /usr/bin printf done export "$1" 'quoted text' /usr/bin sed "$@" readonly --verbose
+	grep ${HOME} echo ${HOME}
+printf then done grep cd printf
+	test local "$@" printf x=1 --verbose -eu ${HOME} x=1 'quoted text'
+	${HOME} x=1 x=1 awk cd awk "$1" export done echo 'quoted text'
+		${HOME} "$1" /usr/bin $(pwd) grep -eu -eu x=1 /usr/bin then export -eu $(pwd)
+done ${HOME} | 'quoted text' -eu "$1" --verbose awk sed grep local -eu -eu
+awk --verbose x=1 local && then "$@"
+sed awk test done echo 'quoted text'
+	grep 2>/dev/null --verbose cd 2>/dev/null && printf
+'quoted text' echo printf 'quoted text'
+	done printf 'quoted text' done &&
+test && readonly sed $(pwd) /usr/bin awk readonly
+	| echo x=1 --verbose 2>/dev/null then && awk | $(pwd) then local "$1" local /usr/bin
+		| done 'quoted text' /usr/bin | | "$1" test test cd readonly -eu --verbose
+	readonly sed done sed echo --verbose "$1" -eu
+	x=1 'quoted text' -eu done grep grep --verbose local cd x=1
+x=1 export test $(pwd) then | echo
+/usr/bin --verbose "$1" && local
+		export sed "$1" sed printf $(pwd) -eu 2>/dev/null done "$@" test sed
+		cd | sed && test echo $(pwd) test x=1 test readonly ${HOME} readonly grep 'quoted text'
+	"$@" && printf /usr/bin echo $(pwd) -eu done echo test "$@"
+		"$1" ${HOME} echo "$1"
+	cd readonly done -eu awk "$1" done echo local readonly done
+	'quoted text' x=1 "$1" $(pwd) --verbose export "$1" 'quoted text'
+	${HOME} | "$@" awk local readonly grep
+"$@" && local grep 2>/dev/null -eu "$@" test sed 2>/dev/null printf $(pwd) then
+grep /usr/bin readonly && then done test grep local then "$@"
+| local sed cd 2>/dev/null -eu sed x=1
+		2>/dev/null then echo export sed printf
+export 'quoted text' local && readonly 'quoted text' cd "$@" ${HOME}
+&& ${HOME} grep test && /usr/bin done local export
+		$(pwd) "$1" echo --verbose
+		export printf cd /usr/bin
+	"$1" "$@" 2>/dev/null "$1" 2>/dev/null cd done grep
+test $(pwd) echo done 'quoted text' x=1 && readonly grep
+		grep x=1 echo && --verbose done
+grep | 'quoted text' done grep
+x=1 awk | grep echo printf -eu $(pwd) ${HOME} 2>/dev/null ${HOME} cd
+export $(pwd) "$@" awk printf then readonly cd ${HOME}
+		'quoted text' $(pwd) /usr/bin printf 'quoted text'
+	cd echo echo ${HOME} 'quoted text' && /usr/bin sed x=1 ${HOME}
+/usr/bin then ${HOME} cd | echo "$1"
+	$(pwd) /usr/bin --verbose printf -eu then "$@" cd 'quoted text'
+		"$@" x=1 'quoted text' -eu $(pwd) | ${HOME} "$1" &&
+		"$1" then ${HOME} && &&
+		--verbose echo export 2>/dev/null test "$@" 'quoted text' export
+		$(pwd) 2>/dev/null then export x=1
+		export test echo "$1" awk 'quoted text'
+	2>/dev/null awk --verbose | -eu then then grep export /usr/bin
+		done --verbose done --verbose -eu then
+| readonly -eu ${HOME} echo export cd
+awk "$1" echo x=1 /usr/bin -eu done local 'quoted text' readonly
+	grep "$@" "$1" cd echo "$1" readonly /usr/bin cd awk sed grep | done export
+	"$@" --verbose done | /usr/bin then
+		then $(pwd) export $(pwd) local grep -eu grep | then
+	"$@" grep | grep && "$@" echo --verbose $(pwd) grep
+	local grep 'quoted text' 2>/dev/null sed test echo &&
+		local then local 'quoted text'
+grep local cd grep -eu --verbose $(pwd) printf x=1 echo printf && -eu
+sed -eu grep done printf echo printf cd export printf -eu readonly
+		export | done -eu export awk cd echo then
+	-eu readonly ${HOME} sed "$@" grep cd
+readonly --verbose -eu && grep /usr/bin printf local /usr/bin
+		$(pwd) readonly readonly done -eu && printf export grep export $(pwd) done
+test /usr/bin /usr/bin x=1 $(pwd)
+'quoted text' awk 'quoted text' echo cd -eu 'quoted text' awk -eu 'quoted text'
+		'quoted text' /usr/bin | -eu "$@" awk grep 2>/dev/null export --verbose test 'quoted text'
+		x=1 x=1 done then done readonly "$1" "$1" grep local
+	printf echo done ${HOME} test ${HOME}
+		grep 2>/dev/null "$1" export | awk grep export "$@"
+	test cd && sed ${HOME} then
+		sed then | echo echo "$@"
+x=1 --verbose && done ${HOME} done done local 'quoted text' -eu -eu | echo "$1"
+		export then "$1" echo --verbose then local && sed "$1" sed printf
+		grep awk grep printf then printf cd | && $(pwd) /usr/bin -eu ${HOME} sed
+	readonly 'quoted text' then sed &&
+		2>/dev/null then --verbose --verbose $(pwd) 'quoted text' done &&
+sed "$@" readonly "$@" 'quoted text'
+		"$@" "$1" "$1" /usr/bin --verbose | x=1 local awk cd echo
+		--verbose -eu x=1 awk "$@" export printf | printf /usr/bin grep local then ${HOME}
+"$1" sed done cd readonly awk --verbose -eu && cd echo
+then then "$@" awk -eu sed "$1" local
+		grep export 'quoted text' -eu sed grep -eu /usr/bin export grep
+x=1 ${HOME} sed grep test echo -eu 'quoted text' --verbose local $(pwd) test sed
+		"$1" cd printf x=1 then cd $(pwd) 2>/dev/null printf $(pwd)
+	/usr/bin --verbose test awk --verbose x=1 /usr/bin /usr/bin
+$(pwd) readonly $(pwd) cd | then grep "$1" 2>/dev/null 2>/dev/null $(pwd) --verbose
+'quoted text' "$@" echo then done && "$1" && export readonly local cd 'quoted text'
+		echo x=1 export "$1" printf ${HOME} readonly
+--verbose done sed sed grep awk 2>/dev/null 'quoted text' 2>/dev/null -eu printf
+awk -eu ${HOME} "$@" awk
+done cd $(pwd) then local awk readonly readonly --verbose done x=1 |
+		grep 2>/dev/null awk "$1" then -eu $(pwd)
+		local "$1" 'quoted text' cd
+		-eu export ${HOME} done && | && --verbose
+-eu && | local -eu "$1" /usr/bin cd done "$1" -eu --verbose && done
+	/usr/bin | "$1" | done local export echo -eu $(pwd) && grep
+		grep export local local | "$1" echo -eu && 'quoted text'
+"$1" done $(pwd) grep "$@" done x=1 'quoted text' done readonly
+		awk | test /usr/bin local | x=1 cd | readonly x=1 'quoted text'
+/usr/bin done sed "$@" cd && grep 'quoted text' sed ${HOME} "$1" /usr/bin 'quoted text'
+	then "$1" "$@" 2>/dev/null && cd x=1 cd printf printf
+x=1 readonly echo /usr/bin -eu cd "$@" awk local then local test grep ${HOME}
+		local /usr/bin "$1" then awk done 'quoted text' $(pwd) $(pwd) printf
+$(pwd) | | echo 2>/dev/null && cd /usr/bin sed cd awk
+--verbose 'quoted text' --verbose
+	awk echo --verbose local
+readonly awk "$@" sed local x=1 "$@" export echo printf $(pwd)
+		"$@" 'quoted text' grep /usr/bin then readonly
+		| ${HOME} | 2>/dev/null test $(pwd) export local awk export "$@" "$1" test printf
+	printf sed && cd /usr/bin done then cd $(pwd) export | done
+/usr/bin x=1 --verbose /usr/bin echo "$@" done sed "$1" x=1 export "$@"
+	'quoted text' 2>/dev/null $(pwd) awk sed grep "$1" "$@" export ${HOME}
+		x=1 sed cd test -eu export && sed
+	test then awk readonly 'quoted text' 2>/dev/null
+grep -eu local echo export "$@" sed awk readonly && awk "$@" -eu 2>/dev/null grep
+		cd echo printf done echo readonly done done sed readonly ${HOME} local "$@" grep
+		--verbose cd | sed sed done "$@" readonly "$@" echo test done
+	then export 2>/dev/null
+done sed x=1 sed test export awk test && $(pwd) export grep sed done ${HOME}
+then 2>/dev/null $(pwd) $(pwd) export x=1 --verbose x=1
+		local grep x=1 readonly "$@" readonly
+	"$1" sed "$1" awk then x=1 echo 2>/dev/null x=1 "$@" echo
+printf readonly -eu grep 2>/dev/null
+	2>/dev/null done then "$1" grep "$1" readonly cd --verbose 'quoted text'
+	-eu then "$@" /usr/bin
+	readonly "$1" local local -eu 2>/dev/null 'quoted text'
+awk --verbose $(pwd) "$@" "$1" awk readonly done echo then
+-eu "$@" grep done printf 2>/dev/null ${HOME} -eu -eu && cd 'quoted text'
+	${HOME} ${HOME} && cd export 2>/dev/null
+		/usr/bin 'quoted text' | x=1 ${HOME} && export export -eu
+cd "$1" then "$@" readonly x=1 /usr/bin echo awk | sed export
+		cd --verbose --verbose ${HOME} awk 2>/dev/null
+"$1" "$@" "$@" echo done sed
+${HOME} ${HOME} readonly grep 2>/dev/null
+		$(pwd) export 'quoted text' test x=1 ${HOME} $(pwd) awk
+then sed 'quoted text' "$@" 'quoted text'
+		readonly ${HOME} 'quoted text' "$@" && echo done 2>/dev/null
+		&& then 'quoted text' | test awk done -eu done 'quoted text' /usr/bin x=1
+		sed export export then 2>/dev/null x=1 --verbose local
+		local && grep then awk
+	"$1" readonly printf $(pwd) grep sed readonly
+		x=1 awk cd printf export echo 2>/dev/null then ${HOME} awk local $(pwd) /usr/bin
+grep cd x=1 "$@" local -eu "$@"
+$(pwd) 2>/dev/null readonly then | "$@" "$@" "$@" local
+--verbose ${HOME} x=1 'quoted text' echo local readonly
+	2>/dev/null | x=1 "$1" "$1" "$@" && test printf sed printf ${HOME}
+		'quoted text' awk cd x=1 $(pwd) /usr/bin sed
+		local | x=1 readonly 2>/dev/null --verbose 2>/dev/null $(pwd) 'quoted text'
+	test ${HOME} then $(pwd) then "$@" sed | --verbose awk -eu export printf then
+	readonly local "$1" x=1 echo
+	cd readonly $(pwd) --verbose --verbose test then test "$@" |
+		grep && 2>/dev/null export "$@" 'quoted text' sed
+		echo x=1 && ${HOME} awk grep export "$1" then then --verbose $(pwd) -eu test &&
+		$(pwd) /usr/bin --verbose -eu done test "$@" sed readonly 'quoted text'
+		readonly local sed test x=1 readonly /usr/bin "$@" --verbose
+		echo awk | cd then x=1 echo 'quoted text' -eu
+		$(pwd) /usr/bin done | cd grep awk local --verbose $(pwd) readonly
+		--verbose x=1 /usr/bin --verbose sed test ${HOME} "$1" ${HOME}
+done /usr/bin printf grep $(pwd) x=1 sed | /usr/bin --verbose --verbose test "$1"
+		export then $(pwd) printf cd test
+readonly 2>/dev/null then $(pwd) test
+done x=1 export local echo echo then ${HOME} /usr/bin readonly
+	export printf 2>/dev/null /usr/bin
+	local "$1" "$@" /usr/bin echo "$1" printf --verbose ${HOME}
+	-eu $(pwd) 'quoted text' done "$@" "$@"
+| done done done awk "$@" /usr/bin awk
+		printf --verbose 2>/dev/null 2>/dev/null awk 2>/dev/null
+	done awk "$1" cd 'quoted text' sed printf awk
+	$(pwd) echo "$@" -eu ${HOME} |
+		printf "$@" 'quoted text' then cd then --verbose ${HOME}
+	export echo printf -eu
+	readonly done /usr/bin test ${HOME} --verbose readonly 2>/dev/null ${HOME}
+		cd --verbose x=1 echo grep test "$@" 'quoted text' 2>/dev/null
+	${HOME} /usr/bin && then
+		local test readonly 'quoted text'
+--verbose -eu test grep 2>/dev/null printf cd grep
+	x=1 done cd 2>/dev/null /usr/bin $(pwd) --verbose printf && sed /usr/bin
+	awk test "$@" /usr/bin echo echo readonly local -eu && /usr/bin && export
+done export sed --verbose test | x=1 /usr/bin --verbose $(pwd) -eu $(pwd)
+		sed grep sed 2>/dev/null awk local | | export cd $(pwd) $(pwd)
+-eu 'quoted text' x=1 test /usr/bin x=1 $(pwd)
+local echo echo then && test $(pwd) echo cd 2>/dev/null -eu ${HOME} "$@" grep
+awk test then readonly $(pwd) --verbose export then "$@" cd $(pwd) ${HOME}
+	2>/dev/null -eu x=1 $(pwd) 'quoted text' && $(pwd) echo cd $(pwd) && export
+	| -eu 'quoted text' x=1 local
+	export 'quoted text' 'quoted text' ${HOME} 'quoted text' | 2>/dev/null
+		then awk && "$@" && x=1 test grep then && -eu |
+	2>/dev/null cd x=1 awk
+	done done && "$1" grep local awk "$@" "$@"
+	cd sed grep $(pwd) $(pwd)
+export cd then /usr/bin x=1 awk readonly done test local
+/usr/bin grep done 'quoted text' $(pwd) cd done -eu -eu
+2>/dev/null done test ${HOME} x=1 /usr/bin then && then $(pwd) then
+	$(pwd) -eu --verbose --verbose -eu --verbose test cd echo ${HOME}
+	printf 2>/dev/null local 2>/dev/null $(pwd) cd awk
+	local grep x=1 /usr/bin ${HOME} 'quoted text'
+"$1" awk readonly -eu $(pwd) x=1 && "$1" x=1 awk
+	export test export sed grep /usr/bin cd
+		2>/dev/null -eu printf export | $(pwd) cd /usr/bin export
+		echo x=1 $(pwd) done echo local sed x=1 echo export done "$@" 2>/dev/null
+	--verbose -eu -eu echo
+done test && "$@" then | 2>/dev/null local then printf cd 'quoted text'
+	"$@" "$@" echo test x=1 echo printf sed awk ${HOME} cd --verbose
+${HOME} cd done x=1 done "$@" cd readonly
+&& x=1 /usr/bin sed echo ${HOME} sed &&
+		x=1 -eu x=1 printf cd -eu ${HOME}
+		/usr/bin local local local readonly echo 'quoted text' 2>/dev/null test
+local test export cd done 'quoted text' grep then 2>/dev/null
+&& 'quoted text' "$1" $(pwd) printf readonly -eu | awk cd /usr/bin x=1 "$1" done
+	sed then local readonly
+sed 2>/dev/null test export 2>/dev/null ${HOME} $(pwd) printf
+	echo sed printf ${HOME} test sed -eu $(pwd) /usr/bin --verbose
+		2>/dev/null /usr/bin "$@" echo 2>/dev/null
+	-eu done x=1 ${HOME} sed
+done awk x=1 | echo "$@" $(pwd) && printf x=1 test 'quoted text' "$@" 'quoted text'
+	local sed awk awk printf awk
+	--verbose echo local 2>/dev/null awk && ${HOME} then cd "$1" echo 2>/dev/null
+	export x=1 x=1 echo | readonly done export echo $(pwd) 'quoted text' ${HOME}
+'quoted text' && sed echo 'quoted text' local --verbose
+"$@" --verbose ${HOME} echo ${HOME} cd ${HOME} -eu awk
+		test test export printf 2>/dev/null --verbose
+local cd test "$1" export grep $(pwd) local test local "$1" export test
+	cd readonly --verbose | -eu export $(pwd)
+	awk printf 'quoted text' x=1 -eu cd
+'quoted text' "$@" 'quoted text' readonly export
+	| cd /usr/bin 2>/dev/null "$1" $(pwd)
+		awk then printf "$1" 2>/dev/null 'quoted text' ${HOME}
+grep test awk 2>/dev/null export awk 2>/dev/null done printf && "$@" sed --verbose
+	local then ${HOME} readonly ${HOME} test grep printf
+	test grep x=1 "$1" then printf awk then "$1" export
+local test then sed cd export echo test grep printf --verbose "$@" "$1" "$1" printf
+$(pwd) sed done "$1" 'quoted text' "$1" then 'quoted text' then ${HOME} grep sed
+readonly export 2>/dev/null | local
+done x=1 echo ${HOME} --verbose
+	-eu $(pwd) echo x=1 x=1 && -eu local export
+readonly "$@" $(pwd) export x=1 sed done $(pwd) then grep 'quoted text'
+	/usr/bin "$1" "$1" echo awk readonly export grep 'quoted text'
+awk then readonly sed cd && --verbose "$@" $(pwd) ${HOME}
+		x=1 --verbose --verbose echo readonly grep x=1 "$@" $(pwd) && "$@" 'quoted text'
+readonly $(pwd) grep sed done x=1 ${HOME} $(pwd) && then --verbose
+&& | /usr/bin "$@" 'quoted text' readonly echo ${HOME} "$1"
+	done "$@" "$1" sed ${HOME} export 'quoted text'
+		'quoted text' export 'quoted text'
+		2>/dev/null $(pwd) /usr/bin
+grep | 'quoted text' done
+		echo sed grep test x=1 "$1" | cd then readonly
+then --verbose -eu readonly ${HOME}
+-eu export sed 2>/dev/null printf $(pwd) | sed done then "$@" $(pwd)
+local | readonly x=1 -eu awk printf $(pwd) $(pwd)
+		sed then $(pwd) 2>/dev/null 2>/dev/null | then
+	grep $(pwd) then export test echo 2>/dev/null -eu $(pwd) printf
+		echo "$1" $(pwd) -eu awk "$@" done done cd echo done
+		grep x=1 sed cd awk ${HOME} x=1 done /usr/bin
+		echo test | 'quoted text' readonly
+grep 2>/dev/null grep 2>/dev/null | 2>/dev/null
+local $(pwd) grep -eu ${HOME} grep -eu export
+	awk echo awk echo printf readonly x=1 x=1 cd local && ${HOME} 2>/dev/null
+"$@" && | done "$1" printf
+		then echo -eu test local printf ${HOME}
+		--verbose -eu readonly done
+"$1" sed sed awk $(pwd) 'quoted text' export ${HOME} ${HOME} test awk local done
+		"$@" done ${HOME} awk done
+		grep printf sed done done | export "$1" then then done grep
+		-eu ${HOME} sed then awk "$1" ${HOME} x=1 test readonly 'quoted text' --verbose
+		"$1" --verbose cd -eu grep --verbose 2>/dev/null cd readonly
+x=1 sed then cd 2>/dev/null printf readonly
+		printf done export 2>/dev/null 2>/dev/null 2>/dev/null local "$1"
+	--verbose ${HOME} readonly /usr/bin -eu awk done
+		cd test --verbose sed && 2>/dev/null --verbose -eu done sed && done -eu echo
+then cd export then echo && x=1 x=1 'quoted text' export local export readonly awk
+		sed 'quoted text' cd && readonly readonly sed then readonly "$@" cd awk test
+	"$1" "$@" "$1" readonly -eu then local readonly export "$@" /usr/bin
+	sed x=1 readonly sed 'quoted text' /usr/bin grep --verbose /usr/bin
+		export done readonly local --verbose
+		2>/dev/null sed cd grep "$1"
+export echo "$@" 2>/dev/null x=1 --verbose test
+		sed test --verbose 'quoted text' -eu echo 2>/dev/null
+2>/dev/null printf && && readonly --verbose readonly sed ${HOME}
+local 2>/dev/null grep done "$@" "$1" 'quoted text' awk "$1" --verbose $(pwd)
+&& local "$@" cd ${HOME} -eu done done test && /usr/bin
+	then $(pwd) echo printf awk cd |
+		--verbose done then $(pwd) local cd "$1" readonly then readonly
+		| local done --verbose then /usr/bin printf
+		&& | && | -eu -eu echo -eu awk -eu awk x=1 "$1" cd local --verbose then
+	--verbose /usr/bin done $(pwd) 2>/dev/null
+		$(pwd) "$@" /usr/bin echo $(pwd) cd local
+-eu "$@" done /usr/bin echo
+"$@" "$1" local awk then 'quoted text' | test echo -eu readonly
+| grep cd local $(pwd) grep echo awk readonly
+		sed "$@" --verbose ${HOME} "$@" awk done then cd done && then awk
+		"$@" export | readonly 'quoted text' cd x=1 readonly
+	"$@" 'quoted text' cd echo "$@" done then --verbose 'quoted text'
+		-eu awk export done done printf local | echo $(pwd)
+		done "$@" 'quoted text' 2>/dev/null grep cd &&
+		local cd ${HOME} readonly done awk export "$@"
+		cd --verbose 'quoted text' sed $(pwd) "$1" && readonly printf 2>/dev/null
+		"$@" cd test x=1 local readonly "$@" 2>/dev/null
+x=1 && | local printf 'quoted text' ${HOME}
+grep x=1 printf 2>/dev/null /usr/bin x=1 test -eu export
+	local readonly test sed then echo && && x=1 "$1" awk awk && readonly
+		/usr/bin test printf readonly 'quoted text' echo local -eu done
+	"$1" echo "$@" printf local --verbose then -eu -eu printf readonly x=1 /usr/bin
+readonly cd printf local 2>/dev/null 'quoted text' grep readonly printf 'quoted text'
+		awk -eu printf export export --verbose echo -eu 'quoted text'
+		local | echo echo cd | readonly then --verbose
+	"$@" "$1" 2>/dev/null 'quoted text' echo -eu export ${HOME} test | echo
+		--verbose awk awk local readonly
+printf && 2>/dev/null grep done | cd test -eu test -eu "$1" --verbose echo
+		then x=1 sed "$1" awk 'quoted text' x=1 | "$1" done ${HOME}
+	cd /usr/bin /usr/bin x=1 export
+/usr/bin $(pwd) $(pwd) sed -eu done x=1 awk $(pwd) grep then
+		readonly -eu ${HOME} done "$1" "$@" x=1 "$@" awk ${HOME} sed printf
+		2>/dev/null "$1" local echo 2>/dev/null | "$@" $(pwd) &&
+	-eu local "$@" then $(pwd)
+	local grep printf then /usr/bin --verbose
+	local echo printf test --verbose
+	done done readonly done "$1" --verbose ${HOME} printf then test cd test 2>/dev/null
+test export local && 'quoted text' "$@" "$@" sed | awk $(pwd) /usr/bin
+test $(pwd) x=1 2>/dev/null -eu cd printf cd "$@"
+		--verbose cd x=1 export awk then sed export
+${HOME} export awk x=1 printf
+test local done readonly ${HOME} /usr/bin local sed && | export
+		local "$1" sed -eu cd ${HOME} then
+	test x=1 2>/dev/null && done grep ${HOME} sed sed 2>/dev/null -eu test 2>/dev/null
+	'quoted text' test readonly then
+		-eu done sed sed 2>/dev/null readonly -eu printf cd 2>/dev/null
+	| 'quoted text' $(pwd) local printf | readonly
+-eu | then then awk export x=1 done export "$@" "$@" sed "$@" readonly 'quoted text'
+'quoted text' awk | 'quoted text' then --verbose export printf --verbose test
+		grep -eu 2>/dev/null grep echo then
+/usr/bin ${HOME} "$@" /usr/bin cd test "$1" 2>/dev/null ${HOME} | sed sed awk
+		--verbose printf --verbose readonly sed echo "$@" export
+	awk 2>/dev/null --verbose x=1 awk "$1" /usr/bin --verbose echo /usr/bin x=1 x=1
+	cd -eu -eu grep export -eu then cd
+	done 2>/dev/null readonly | local
+		awk x=1 x=1 | 'quoted text' && 2>/dev/null readonly && "$1" "$@" readonly
+		printf echo "$1" printf done test 'quoted text' -eu && sed
+	2>/dev/null x=1 test echo
+--verbose printf "$1" echo "$1" awk
+	cd export --verbose ${HOME}
+		"$1" --verbose $(pwd) 'quoted text' local then 2>/dev/null 2>/dev/null 2>/dev/null
+'quoted text' printf readonly
+	&& done then $(pwd) awk cd && then ${HOME} "$@" printf 'quoted text' then readonly
+--verbose done x=1 | printf 'quoted text' then -eu "$@" cd echo "$@"
+		"$1" 'quoted text' readonly test
+	echo printf -eu "$@" cd readonly
+	${HOME} echo done "$@" ${HOME} awk && printf test && cd $(pwd) test && readonly
+sed ${HOME} 'quoted text'
+	done x=1 awk -eu printf local readonly awk /usr/bin export awk
+	2>/dev/null awk -eu "$1" x=1 printf grep "$@" && cd
+	"$@" 2>/dev/null test sed local cd 'quoted text'
+	local awk "$1" sed echo readonly cd sed printf ${HOME} done ${HOME}
+	echo "$1" test export test ${HOME} --verbose
+local then printf -eu awk printf test --verbose local printf awk | ${HOME}
+awk awk test -eu 'quoted text' echo ${HOME} done
+readonly local local $(pwd) 'quoted text' awk --verbose printf /usr/bin
+		printf /usr/bin "$1" "$@" local awk done readonly
+		awk export local "$1" echo done test then "$@" local printf then readonly
+		awk cd export 'quoted text' | ${HOME}
+sed echo 2>/dev/null "$@" cd 2>/dev/null --verbose test $(pwd) 2>/dev/null |
+		--verbose echo "$@" printf $(pwd) sed ${HOME} sed
+	--verbose --verbose done /usr/bin
+		test /usr/bin && "$@" local local "$@" /usr/bin
+	x=1 && test x=1 awk echo 2>/dev/null
+		--verbose x=1 test then 2>/dev/null "$1"
+-eu printf -eu ${HOME} cd cd --verbose
+export export sed | cd readonly export ${HOME} then $(pwd) printf --verbose
+	local sed test "$@" awk cd x=1 readonly export $(pwd)
+${HOME} export echo local | export "$1" "$1" then echo
+	test local printf "$1"
+	$(pwd) --verbose done test x=1 cd grep
+	2>/dev/null sed done x=1 export && $(pwd) then 'quoted text'
+		${HOME} $(pwd) cd && /usr/bin -eu ${HOME} done test ${HOME}
+$(pwd) x=1 /usr/bin --verbose x=1 export echo && cd export --verbose "$@" then
+		cd echo "$1" done sed ${HOME} x=1
+	'quoted text' sed && done awk sed echo "$1" printf then /usr/bin cd
+cd test awk grep sed export ${HOME} awk 'quoted text' grep export test echo then
+		test readonly 'quoted text' awk 'quoted text' 2>/dev/null 'quoted text'
+/usr/bin export local "$1" export
+grep sed cd test 2>/dev/null local sed printf awk sed awk | ${HOME} done
+sed && /usr/bin grep printf /usr/bin 'quoted text'
+		test $(pwd) ${HOME} /usr/bin && awk printf printf "$@"
+	/usr/bin printf done && cd grep echo printf $(pwd)
+		done --verbose local ${HOME} readonly "$@" "$1" && then
+	&& --verbose local $(pwd) $(pwd) $(pwd) x=1 'quoted text' grep "$@" test test
+--verbose "$1" grep /usr/bin echo then cd ${HOME} "$1" readonly printf echo sed
+"$1" 2>/dev/null /usr/bin | /usr/bin | 2>/dev/null sed test test --verbose --verbose
+		printf grep --verbose
+	cd test --verbose x=1 /usr/bin "$@" ${HOME} then $(pwd) x=1 readonly | | "$@"
+	"$@" ${HOME} done -eu "$@" awk && awk awk done --verbose && --verbose
+	"$@" sed echo /usr/bin readonly cd $(pwd) x=1 export sed done x=1 sed grep x=1 ${HOME}
+	--verbose "$@" test printf 2>/dev/null readonly
+sed export then echo done
+printf "$@" -eu readonly "$@" awk ${HOME}
+		test "$@" echo awk 2>/dev/null echo --verbose cd echo "$1" /usr/bin && 2>/dev/null
+		&& test /usr/bin "$1" x=1 local cd done --verbose echo && sed awk readonly
+-eu readonly printf x=1 echo readonly local echo done
+done awk | readonly sed done x=1
+	done grep sed 'quoted text' x=1 awk 'quoted text' cd "$@" 2>/dev/null
+	"$1" test echo printf -eu ${HOME} 2>/dev/null -eu x=1 "$@" printf
+awk awk --verbose then echo -eu "$@" && readonly
+		'quoted text' "$1" cd export
+	sed export awk cd printf done
+awk then 'quoted text'
+	test local x=1 --verbose done sed 'quoted text' cd readonly test
+printf readonly ${HOME} ${HOME} 2>/dev/null echo then "$@" local
+		readonly sed && "$@" /usr/bin "$1" grep readonly
+	| $(pwd) 2>/dev/null grep test then readonly local then && $(pwd)
+"$1" local test cd grep $(pwd) readonly export
+test then --verbose done grep $(pwd)
+		grep 'quoted text' export -eu /usr/bin sed export echo "$@" readonly readonly local
+	'quoted text' then "$@" $(pwd) | readonly
+/usr/bin grep sed grep | readonly /usr/bin
+		--verbose test done echo /usr/bin | export printf 2>/dev/null $(pwd) then
+		'quoted text' 2>/dev/null && awk -eu "$@" "$@" /usr/bin
+		"$@" "$1" 'quoted text' --verbose export /usr/bin
+		sed local 'quoted text' x=1
+	"$1" printf "$@" | sed "$@" 'quoted text' $(pwd) && -eu
+	sed export && -eu cd 2>/dev/null
+	export -eu ${HOME} "$@"
+		-eu x=1 readonly then --verbose
+		awk /usr/bin printf $(pwd) done && grep done then cd export
+		--verbose done readonly test export "$@" sed "$@" export "$1" test printf
+		'quoted text' && then export local | grep awk
+	/usr/bin readonly echo readonly done test -eu readonly "$@" | "$@" local cd test
+'quoted text' "$1" && readonly 2>/dev/null
+		echo "$1" 'quoted text' ${HOME} 'quoted text' 2>/dev/null export "$1" /usr/bin
+"$1" then ${HOME} /usr/bin | --verbose local &&
+	/usr/bin awk 2>/dev/null 2>/dev/null x=1 grep readonly
+| test sed cd "$1" cd test ${HOME} awk awk readonly done done
+		"$@" && | test | test sed test | && 'quoted text' x=1 readonly awk local
+		done --verbose awk /usr/bin export | x=1 --verbose 2>/dev/null
+	awk then export -eu done 2>/dev/null $(pwd) $(pwd) export then test
+		| 'quoted text' then then x=1 'quoted text' then cd local test test cd | $(pwd)
+test test && done /usr/bin --verbose then 'quoted text'
+local cd cd then cd printf "$1" /usr/bin sed $(pwd) local export sed
+		2>/dev/null awk ${HOME} then echo "$@" "$1" export then -eu $(pwd) --verbose
+/usr/bin export test ${HOME}
+	echo "$1" cd x=1 2>/dev/null readonly done
+	&& readonly local echo local 'quoted text' awk x=1 'quoted text'
+echo sed local x=1 export local local cd local 'quoted text' cd 'quoted text'
+		sed -eu done "$@" printf sed ${HOME} 'quoted text' local grep cd && local
+	awk test $(pwd) done ${HOME} 'quoted text' && --verbose "$1" echo export
+		'quoted text' 'quoted text' 2>/dev/null
+		local awk $(pwd) $(pwd) readonly then x=1 | "$1" -eu cd "$1" printf
+	${HOME} x=1 "$@" x=1 readonly export 2>/dev/null sed
+	echo /usr/bin grep && echo done "$@" /usr/bin export ${HOME} awk "$1"
+	"$1" 'quoted text' done
+		$(pwd) sed export --verbose "$1" export printf | done awk -eu sed
+	x=1 done echo done test printf && echo readonly
+--verbose sed local cd
+	-eu awk grep done --verbose && && --verbose then 'quoted text' /usr/bin printf
+${HOME} ${HOME} ${HOME} --verbose /usr/bin awk readonly test export
+	local "$1" -eu | then readonly sed printf ${HOME} | then local
+	printf grep cd readonly sed local
+		done /usr/bin /usr/bin test | test $(pwd) then sed --verbose
+	export echo $(pwd) printf done "$@" done
+	--verbose 'quoted text' ${HOME} grep sed | readonly --verbose | awk
+test $(pwd) readonly local "$1" test -eu test printf $(pwd) printf /usr/bin
+	| test $(pwd) x=1 -eu export export readonly awk echo
+		printf sed cd printf "$@" awk
+	grep awk then "$@" "$1" 'quoted text' && 'quoted text' test echo --verbose
+done readonly "$@" "$1" "$1" --verbose ${HOME} "$1" x=1 -eu 'quoted text'
+		test $(pwd) ${HOME} awk "$@" echo
+		-eu "$@" | $(pwd) grep printf 'quoted text' local 'quoted text'
+awk done export local local $(pwd) then ${HOME} printf
+		/usr/bin cd cd export done $(pwd) -eu local cd /usr/bin echo --verbose
+	&& | export grep readonly --verbose awk | test printf sed sed cd -eu then
+echo readonly 2>/dev/null
+&& ${HOME} cd ${HOME} readonly && awk export "$@" export done
+	"$1" && echo readonly echo "$1" "$@" cd 2>/dev/null readonly
+then readonly sed printf ${HOME} echo $(pwd) cd && readonly
+	readonly readonly echo cd $(pwd) export
+echo -eu local && export awk --verbose
+grep "$1" cd grep -eu then $(pwd) printf printf echo
+	--verbose -eu $(pwd) printf "$1" awk $(pwd) /usr/bin
+	x=1 ${HOME} then export 'quoted text' readonly "$@" -eu done
+		printf local awk readonly "$1"
+		test --verbose && then grep done --verbose
+	done ${HOME} then done | --verbose
+${HOME} && 'quoted text' done | test awk local 2>/dev/null 'quoted text'
+sed local 'quoted text' test sed $(pwd) cd readonly $(pwd)
+	"$@" cd "$@" "$1" grep "$@" | test printf
+&& 'quoted text' test export ${HOME} "$1" printf | && local readonly 'quoted text'
+		"$1" ${HOME} --verbose 2>/dev/null /usr/bin then done x=1 --verbose then printf
+export -eu cd ${HOME} local export | local
+		'quoted text' /usr/bin readonly export cd 2>/dev/null grep local test
+	grep grep readonly sed readonly
+	awk 2>/dev/null "$1" test readonly
+sed 'quoted text' /usr/bin cd x=1 readonly readonly
+	"$@" -eu /usr/bin cd local
+		&& 'quoted text' done /usr/bin 'quoted text' readonly
+	test $(pwd) --verbose $(pwd) echo | $(pwd) | echo x=1 && 'quoted text'
+local awk x=1 sed cd grep cd
+sed /usr/bin 'quoted text' -eu readonly
+grep --verbose $(pwd) echo awk readonly local | x=1
+"$1" sed test printf "$@" done export readonly
+	echo done "$1" done grep ${HOME}
+	--verbose readonly $(pwd) done
+| --verbose | echo 2>/dev/null ${HOME}
+		/usr/bin readonly 'quoted text' echo "$1" readonly readonly | printf x=1
+	| export /usr/bin test $(pwd) /usr/bin cd readonly | && /usr/bin | | 'quoted text'
+	readonly && then export echo grep --verbose echo done local readonly /usr/bin
+test && export | --verbose /usr/bin "$1" printf done && -eu grep grep | 2>/dev/null
+		'quoted text' | 'quoted text' x=1 local readonly echo grep
+	&& cd && $(pwd) --verbose x=1 | x=1 done
+	cd -eu 'quoted text' echo sed
+	/usr/bin 2>/dev/null && /usr/bin
+	-eu grep && 2>/dev/null grep
+&& --verbose && 'quoted text' awk cd local -eu awk cd
+		awk ${HOME} 'quoted text' grep cd 'quoted text' "$1"
+		printf $(pwd) grep x=1 readonly printf && $(pwd) export --verbose /usr/bin
+printf grep "$1" readonly | grep local export cd /usr/bin
+		| "$1" /usr/bin awk 2>/dev/null sed export
+x=1 cd test done local -eu /usr/bin | grep test -eu x=1
+		/usr/bin readonly sed awk | echo readonly x=1 cd "$1" done awk export cd local
+'quoted text' cd readonly
+		/usr/bin local --verbose ${HOME} | 2>/dev/null -eu
+2>/dev/null && "$@" "$1" $(pwd)
+	echo "$1" "$@" printf
+		--verbose 2>/dev/null readonly "$@" /usr/bin ${HOME}
+${HOME} --verbose /usr/bin --verbose
+	echo echo x=1 sed then /usr/bin /usr/bin cd ${HOME} local
+| 'quoted text' $(pwd) "$@"
+	"$@" /usr/bin -eu awk sed --verbose "$1" $(pwd) cd grep readonly local "$@" $(pwd)
+	${HOME} export x=1 "$1" done export
+$(pwd) "$@" "$@" --verbose then grep -eu "$@" 2>/dev/null done
+		"$@" sed readonly --verbose sed local && ${HOME} done $(pwd)
+		awk test export 2>/dev/null echo printf -eu $(pwd)
+	"$1" && -eu readonly then /usr/bin test echo x=1 "$1" --verbose | 'quoted text'
+		printf printf export x=1 then export "$1" awk | test $(pwd) sed awk /usr/bin
+local sed "$1" x=1 | cd
+	/usr/bin $(pwd) readonly local export 'quoted text' 2>/dev/null ${HOME}
+| local awk /usr/bin sed then export "$1" -eu echo 2>/dev/null
+"$@" grep 2>/dev/null echo 'quoted text'
+	${HOME} local cd local && local "$1" test && awk cd -eu
+		then $(pwd) grep sed /usr/bin && awk /usr/bin
+	cd grep test export | export awk then $(pwd) $(pwd)
+		-eu test done cd ${HOME} 'quoted text'
+	/usr/bin readonly $(pwd) 'quoted text' && "$@" sed echo export 'quoted text'
+	sed -eu printf x=1 then printf && 2>/dev/null local $(pwd) cd done --verbose &&
+	readonly 'quoted text' --verbose --verbose $(pwd) awk --verbose printf "$@" test
+		'quoted text' local printf awk awk test -eu 2>/dev/null --verbose
+		awk sed echo && sed | 2>/dev/null
+		awk echo && awk && ${HOME} export && echo "$@" sed sed then echo $(pwd) $(pwd)
+	2>/dev/null 2>/dev/null | export awk then test done 'quoted text'
+	/usr/bin local && export export
+		local done x=1 printf $(pwd) export readonly 2>/dev/null
+test echo 2>/dev/null echo "$1" ${HOME}
+test -eu then sed local x=1 "$1" ${HOME} && printf local awk $(pwd) printf done
+local 'quoted text' local 2>/dev/null | /usr/bin
+echo grep 2>/dev/null grep local sed x=1 grep /usr/bin done awk readonly grep grep
+export export done done test 2>/dev/null --verbose
+sed printf "$1" readonly -eu $(pwd) cd 'quoted text' | awk 2>/dev/null awk 2>/dev/null
+echo done && printf ${HOME} | echo awk "$1" /usr/bin "$@" sed && $(pwd)
+		test cd echo 2>/dev/null "$1" local "$1" then awk readonly
+&& sed ${HOME} ${HOME} && ${HOME} test cd | grep then --verbose
+		test "$@" local $(pwd) 'quoted text' x=1 x=1 test
+printf grep && then sed then printf awk cd x=1 -eu "$@" echo
+${HOME} $(pwd) then -eu && "$1" echo done x=1 'quoted text'
+/usr/bin && x=1 "$1" -eu sed && 'quoted text'
+		x=1 sed then sed 2>/dev/null --verbose "$1" echo readonly --verbose then
+'quoted text' -eu --verbose export "$1" local 2>/dev/null
+	2>/dev/null --verbose done $(pwd) "$1" sed test /usr/bin 'quoted text'
+		export test test readonly local then $(pwd) awk printf --verbose cd -eu ${HOME}
+		awk done -eu ${HOME} 'quoted text' && done $(pwd) echo then 'quoted text'
+echo && echo then "$@" "$@" cd done test x=1 -eu cd /usr/bin awk
+$(pwd) export printf done && 2>/dev/null test cd "$@" $(pwd) test x=1 2>/dev/null
+	test readonly --verbose sed && done grep readonly test -eu sed
+test "$@" grep 'quoted text'
+/usr/bin 2>/dev/null x=1 &&
+printf echo && test &&
+	local sed cd /usr/bin printf 'quoted text'
+	done local "$1" ${HOME} grep grep export done export "$@" /usr/bin awk sed 'quoted text'
+test grep && 'quoted text' x=1 | --verbose done "$@" --verbose test test /usr/bin
+export ${HOME} /usr/bin "$1" 'quoted text' $(pwd) echo "$1" $(pwd) test then "$@"
+| -eu local "$1" x=1 2>/dev/null "$@" | sed printf
+	"$@" grep grep && echo test grep "$@" /usr/bin local export
+	printf "$1" $(pwd) sed /usr/bin echo | grep "$@" awk | x=1 readonly
+echo then grep echo printf $(pwd) /usr/bin "$@" x=1 "$1" cd
+awk ${HOME} echo | x=1 readonly --verbose awk awk readonly x=1 --verbose
+	$(pwd) readonly 2>/dev/null && cd echo 2>/dev/null "$1" "$1" "$1" grep /usr/bin
+	-eu -eu grep ${HOME} cd awk "$1" "$1" /usr/bin --verbose sed 'quoted text'
+echo $(pwd) grep "$@" | x=1 | sed ${HOME} then readonly $(pwd)
+		x=1 local sed echo /usr/bin then && "$1" local grep ${HOME}
+		x=1 /usr/bin awk awk | awk done then x=1 done /usr/bin "$1"
+printf grep test x=1 local ${HOME} x=1 export --verbose
+done 'quoted text' done
+done 'quoted text' $(pwd) awk awk x=1 grep x=1 -eu cd sed
+	local /usr/bin | --verbose printf readonly
+	| export 'quoted text' cd $(pwd) --verbose grep
+--verbose then ${HOME} awk 2>/dev/null
+grep x=1 ${HOME} export --verbose
+		x=1 local "$@" ${HOME} "$1" | then /usr/bin awk
+	cd | cd done local /usr/bin "$1" printf -eu printf grep $(pwd)
+	sed awk echo --verbose $(pwd) awk printf
+	x=1 then grep $(pwd) ${HOME} export "$@"
+		cd /usr/bin done && echo grep sed 2>/dev/null --verbose
+2>/dev/null then "$@" local --verbose
+		x=1 'quoted text' 2>/dev/null /usr/bin export done printf "$1"
+2>/dev/null sed test 2>/dev/null grep done "$1" readonly sed --verbose
+&& && then && awk echo printf
+	$(pwd) | then | then && "$1" done /usr/bin /usr/bin awk readonly --verbose
+| echo && 'quoted text' test awk local test then 2>/dev/null
+/usr/bin ${HOME} x=1 echo cd local ${HOME} export grep done awk test awk
+2>/dev/null "$1" sed $(pwd) ${HOME} awk sed
+	then echo | test $(pwd) export "$1" then ${HOME} | ${HOME} awk export
+	printf echo 2>/dev/null cd readonly sed 'quoted text' --verbose && readonly
+	echo 2>/dev/null "$@" |
+then echo -eu then local | x=1 test $(pwd) then "$1" printf local awk
+${HOME} cd x=1 x=1 x=1 "$@" grep 'quoted text'
+	cd $(pwd) printf | echo readonly /usr/bin | echo grep done grep
+		export --verbose && && export then -eu test ${HOME}
+	test then | cd ${HOME} | && sed 'quoted text' sed 2>/dev/null
+	2>/dev/null printf grep -eu ${HOME} "$@" ${HOME} printf
+	${HOME} ${HOME} --verbose ${HOME}
+	&& then printf "$1" "$1"
+	| --verbose echo 'quoted text' 'quoted text' done
+		echo -eu printf export x=1 /usr/bin sed && readonly "$@" 2>/dev/null /usr/bin
+echo 2>/dev/null "$1" awk printf
+"$1" 'quoted text' readonly then "$1" cd grep x=1 grep $(pwd) 2>/dev/null
+		test local cd echo && | sed /usr/bin readonly
+x=1 && ${HOME} ${HOME} ${HOME} 'quoted text'
+	grep readonly then done -eu 2>/dev/null
+$(pwd) 2>/dev/null $(pwd) done -eu --verbose then local
+	then grep "$1" readonly awk sed "$@" awk local cd x=1 | x=1 'quoted text'
+| echo x=1 $(pwd) 'quoted text' ${HOME} echo
+		local -eu then "$1" awk x=1 --verbose
+	"$@" | 'quoted text' printf readonly
+		x=1 /usr/bin echo x=1 done --verbose --verbose sed cd awk cd cd grep test 'quoted text'
+	cd test readonly readonly ${HOME} && "$@" -eu printf -eu printf 2>/dev/null $(pwd)
+	$(pwd) local x=1 | -eu sed then then export && readonly
+	readonly test local "$@" | -eu
+		x=1 export printf 2>/dev/null cd sed "$1"
+test echo local grep -eu ${HOME} awk then then | /usr/bin awk test done
+/usr/bin grep && "$1" done test grep echo |
+readonly "$1" echo ${HOME} echo --verbose export
+	then grep export test /usr/bin local printf export -eu printf
+$(pwd) "$1" awk grep 'quoted text' awk $(pwd)
+local 'quoted text' $(pwd) 'quoted text' x=1 test x=1 grep --verbose
+echo --verbose 'quoted text'
+		| local awk | then done "$1" export cd cd
+		"$@" 'quoted text' then && echo export -eu cd 'quoted text' awk
+		$(pwd) x=1 local export "$@" printf x=1 x=1 "$1"
+cd "$@" "$1" $(pwd) x=1 done done /usr/bin --verbose local done
+		&& cd /usr/bin local grep x=1 grep readonly x=1 | awk -eu grep done printf
+"$@" cd 2>/dev/null grep export printf --verbose readonly grep awk "$1"
+		grep ${HOME} x=1 --verbose
+		&& awk echo echo && && then
+		export test grep -eu readonly "$1"
+		sed local cd cd 'quoted text' "$@" grep 2>/dev/null && then
+	local export sed readonly ${HOME} printf $(pwd) /usr/bin &&
+-eu /usr/bin awk "$1" grep
+	awk cd echo local 2>/dev/null
+		"$@" "$1" sed readonly done && awk cd /usr/bin
+grep 'quoted text' export "$1" echo
+export | --verbose sed && 'quoted text'
+awk printf ${HOME} $(pwd) sed awk grep "$1" test
+		export sed printf sed $(pwd) ${HOME} awk cd -eu readonly
+	echo done /usr/bin --verbose
+	test test done "$@" | grep x=1 | 2>/dev/null 'quoted text'
+		grep awk $(pwd) 2>/dev/null 2>/dev/null
+		-eu x=1 && -eu echo ${HOME} /usr/bin
+		printf done 'quoted text' x=1 then awk | | | -eu
+		printf /usr/bin printf --verbose ${HOME}
+	${HOME} -eu "$1" then "$@" sed readonly "$1" export | awk
+		awk --verbose printf awk awk local sed local test cd export x=1
+x=1 /usr/bin export |
+	-eu "$1" then $(pwd) printf
+2>/dev/null then -eu awk $(pwd)
+		sed test /usr/bin 'quoted text' done cd
+test grep && "$@" export echo export cd "$1" readonly "$1"
+	test then /usr/bin 'quoted text'
+test readonly "$1" /usr/bin readonly $(pwd) test printf grep test x=1 /usr/bin
+	--verbose awk done local cd readonly done readonly grep done readonly readonly
+	| echo sed readonly cd 2>/dev/null cd
+		--verbose ${HOME} awk
+$(pwd) $(pwd) then 2>/dev/null
+x=1 && local then local x=1 /usr/bin /usr/bin local $(pwd) export | grep $(pwd)
+$(pwd) && | ${HOME} "$@" -eu cd test $(pwd) echo awk cd "$1" awk /usr/bin
+	"$1" echo /usr/bin && "$@" cd $(pwd)
+		$(pwd) cd 'quoted text' done test 'quoted text'
+	export grep sed --verbose "$1" $(pwd)
+then echo /usr/bin printf done cd --verbose cd grep readonly awk 'quoted text'
+		printf local awk && /usr/bin "$1" export | test local echo 'quoted text'
+export awk local readonly then "$1" $(pwd) readonly ${HOME} && | "$@" 'quoted text'
+	export --verbose $(pwd) cd sed x=1 x=1 && && && && sed x=1 awk && local then
+		echo awk awk test sed done /usr/bin
+		x=1 then grep "$@" cd export then readonly
+	&& then | 'quoted text' -eu then cd grep | sed local export done echo cd readonly
+| awk local && printf ${HOME} readonly cd 2>/dev/null test
+	&& | readonly printf ${HOME} x=1 && ${HOME}
+	"$@" 2>/dev/null grep sed --verbose 2>/dev/null sed local "$@"
+	"$1" --verbose "$1" done -eu readonly
+	grep 2>/dev/null "$1" then "$1" 2>/dev/null
+		"$@" "$1" export 2>/dev/null then awk readonly | 2>/dev/null $(pwd) 2>/dev/null
+done /usr/bin --verbose local 'quoted text' cd test "$1" cd then printf done
+"$@" x=1 --verbose then grep printf /usr/bin "$1" grep 2>/dev/null sed then local
+--verbose -eu then then ${HOME} x=1 export "$@"
+	"$1" x=1 echo printf 'quoted text' 'quoted text' echo && printf local
+/usr/bin --verbose then then 2>/dev/null --verbose
+/usr/bin export "$1" sed | done sed awk sed "$@" 'quoted text' /usr/bin printf
+	grep "$@" grep -eu export 'quoted text'
+	/usr/bin -eu sed then
+	grep && --verbose x=1 'quoted text' done done $(pwd)
+	-eu 2>/dev/null --verbose
+		echo echo echo 'quoted text'
+	then done -eu 2>/dev/null
+-eu | 2>/dev/null $(pwd)
+	grep export "$1" then local local x=1 "$@" test test test readonly
+		grep local ${HOME} "$1" && 'quoted text' awk readonly 'quoted text'
+	printf "$@" | grep done test /usr/bin --verbose 'quoted text' -eu 'quoted text'
+2>/dev/null cd 'quoted text' readonly grep ${HOME} -eu "$@" export && grep "$1"
+	x=1 ${HOME} test test /usr/bin $(pwd) echo && awk --verbose cd printf
+	test | done then -eu 2>/dev/null export --verbose grep echo export
+printf awk printf --verbose ${HOME} readonly awk echo 'quoted text'
+"$1" --verbose "$1" 2>/dev/null -eu grep
+$(pwd) | then sed "$@" grep x=1 echo -eu x=1 ${HOME} done readonly
+awk export $(pwd) cd "$1" x=1 export printf readonly done --verbose "$1" done sed
+		2>/dev/null then | readonly
+done local && $(pwd) export && done cd 2>/dev/null grep test printf local
+		readonly "$1" && local x=1 /usr/bin test grep awk then cd printf /usr/bin
+		-eu $(pwd) done | then grep cd done printf | readonly
+		grep ${HOME} /usr/bin "$@" local && && | then
+		"$@" cd local grep local export x=1 "$@" echo then --verbose
+	2>/dev/null readonly x=1 then sed -eu 'quoted text'
+local 2>/dev/null 'quoted text' | $(pwd) echo -eu && echo
+"$@" 'quoted text' $(pwd)
+$(pwd) x=1 local echo grep printf export $(pwd) export 2>/dev/null
+| ${HOME} x=1 printf -eu "$1"
+awk --verbose | ${HOME} grep x=1 $(pwd) export printf 'quoted text'
+--verbose grep -eu then printf
+		readonly -eu printf export printf | printf printf $(pwd)
+printf | "$1" /usr/bin done local sed 'quoted text' 2>/dev/null
+grep && | | local "$@" -eu sed 'quoted text' && echo echo 2>/dev/null local printf
+	&& x=1 printf -eu 'quoted text' ${HOME} x=1 sed done
+	grep echo "$1" 2>/dev/null cd local
+		export ${HOME} /usr/bin && local x=1 $(pwd) sed echo cd test local
+--verbose 2>/dev/null "$1" awk export 2>/dev/null test readonly "$@" readonly
+		sed 2>/dev/null export readonly 2>/dev/null x=1 awk sed printf cd
+printf then sed | local readonly
+		readonly $(pwd) && cd x=1 sed x=1 local x=1 $(pwd)
+readonly && $(pwd) test 'quoted text' $(pwd) export done
+| && sed cd -eu | cd printf then echo cd x=1 then grep
+	test && "$@" local | 2>/dev/null printf
+	grep cd cd grep then ${HOME} --verbose 'quoted text' $(pwd)
+	$(pwd) -eu local then 2>/dev/null
+	'quoted text' | 'quoted text' 'quoted text' 'quoted text' local
+grep local export done sed --verbose "$@"
+| "$@" "$@" grep $(pwd) && "$1" /usr/bin test then
+-eu awk && local test test readonly
+	/usr/bin $(pwd) cd echo test local x=1 2>/dev/null test then printf local && local
+	then readonly "$@" grep local then 'quoted text' 'quoted text' cd
+		2>/dev/null "$1" 'quoted text' x=1
+		export $(pwd) then awk
+		export /usr/bin test test echo then $(pwd) 'quoted text'
+"$1" --verbose && --verbose | ${HOME} -eu x=1 test $(pwd)
+		awk done 'quoted text' && x=1 $(pwd) echo then 2>/dev/null && "$@" local 'quoted text'
+	export /usr/bin printf -eu /usr/bin && grep grep
+		done awk sed export export
+	local grep | 2>/dev/null
+		-eu && export grep --verbose
+		2>/dev/null "$@" test 'quoted text' export "$@"
+		sed sed --verbose sed then then
+		$(pwd) ${HOME} local 2>/dev/null local && test cd 'quoted text'
+		2>/dev/null $(pwd) | "$@" readonly
+		readonly -eu x=1 "$@" echo done
+	then export printf printf 'quoted text' sed grep grep cd | echo cd
+		x=1 | -eu local cd export --verbose
+local test /usr/bin | "$@" | --verbose 2>/dev/null 'quoted text'
+	/usr/bin printf /usr/bin cd x=1 readonly ${HOME} /usr/bin sed
+"$1" -eu export "$1" 2>/dev/null -eu local sed then "$@" -eu export local
+	export x=1 readonly $(pwd) done -eu printf x=1 then readonly
+export readonly cd 2>/dev/null readonly awk
+	test "$1" export grep && cd cd "$1" 2>/dev/null "$@" -eu echo done
+		then readonly readonly /usr/bin -eu
+	| --verbose local 2>/dev/null done
+local 'quoted text' x=1 test local x=1 ${HOME} x=1 | grep
+&& $(pwd) "$@" ${HOME} |
+	sed export /usr/bin "$1" export sed /usr/bin &&
+x=1 "$@" ${HOME} awk "$1" | readonly && -eu sed awk
+		x=1 sed 2>/dev/null echo x=1 local readonly $(pwd)
+	"$@" "$1" sed local readonly "$1" ${HOME} && "$@" echo &&
+	echo 'quoted text' "$@" export && | grep /usr/bin "$@" printf test grep /usr/bin
+	x=1 awk | local ${HOME} local
+--verbose 'quoted text' -eu awk echo --verbose sed sed grep && done
+	sed echo cd $(pwd) "$@" 2>/dev/null 2>/dev/null test --verbose x=1 $(pwd) grep
+	/usr/bin readonly ${HOME} done local readonly
+	sed x=1 "$1" 'quoted text' "$@" --verbose done printf "$@" test
+		grep 2>/dev/null /usr/bin cd ${HOME} -eu $(pwd) "$1" sed -eu test awk readonly
+echo | 'quoted text' "$1" export done grep echo "$1" ${HOME}
+		"$1" grep -eu 2>/dev/null then
+"$1" x=1 -eu /usr/bin printf export 'quoted text'
+		then "$@" 'quoted text' local
+cd x=1 readonly "$@" cd printf awk done 'quoted text' 'quoted text' printf
+	sed $(pwd) cd 'quoted text' printf | --verbose $(pwd) readonly export
+		$(pwd) grep && printf /usr/bin 2>/dev/null | 'quoted text' /usr/bin export
+	cd local export echo test echo
+printf echo | $(pwd) ${HOME} && echo readonly export echo "$@" test
+		readonly && cd -eu x=1 "$1" done cd export x=1 sed local 'quoted text' "$1"
+		echo cd awk && awk export then sed then 2>/dev/null
+$(pwd) 'quoted text' 2>/dev/null 'quoted text' test printf
+		cd ${HOME} -eu readonly "$@" 2>/dev/null
+	grep /usr/bin grep 2>/dev/null
+	then done printf then ${HOME} test --verbose "$@" $(pwd) ${HOME} sed done
+	&& -eu then /usr/bin --verbose
+	done export local export && grep -eu "$1" 2>/dev/null && printf
+	echo && grep done cd 2>/dev/null
+	$(pwd) readonly done done
+cd echo -eu test && export 'quoted text' awk then -eu $(pwd) export ${HOME}
+		readonly x=1 test readonly then printf x=1 grep printf
+	cd ${HOME} cd grep test done done 2>/dev/null export -eu printf
+	x=1 /usr/bin -eu 2>/dev/null awk "$@" -eu cd readonly 'quoted text' echo
+	--verbose | printf printf /usr/bin printf
+		printf ${HOME} --verbose x=1 echo "$@" local x=1 'quoted text'
+		done && "$@" cd 'quoted text'
+&& 2>/dev/null echo 'quoted text' x=1 x=1 grep awk readonly | --verbose
+"$1" "$@" echo | awk "$@" echo "$@" test /usr/bin | ${HOME}
+		readonly --verbose ${HOME} echo echo $(pwd)
+	/usr/bin grep 2>/dev/null /usr/bin "$1" export -eu cd $(pwd)
+		2>/dev/null | printf done ${HOME} echo sed --verbose -eu
+	echo 2>/dev/null "$@" echo 'quoted text' printf
+		printf x=1 local local test 'quoted text' $(pwd) printf -eu then then
+		/usr/bin | grep printf $(pwd) local test export
+| printf awk --verbose sed export done then
+		printf readonly && $(pwd) local && "$1" grep printf $(pwd) ${HOME}
+sed export done awk then export 2>/dev/null awk echo readonly
+		"$@" /usr/bin test sed local local "$@" /usr/bin export 'quoted text' sed
+	grep -eu printf printf --verbose && 'quoted text' && then "$1"
+	grep && sed --verbose | local readonly then test local printf
+	2>/dev/null readonly local ${HOME} sed readonly grep done then 'quoted text' "$@"
+		-eu awk printf echo export grep echo printf 2>/dev/null
+cd | cd sed $(pwd) 2>/dev/null | -eu --verbose
+		2>/dev/null echo local $(pwd)
+		grep readonly sed 'quoted text' $(pwd) | awk grep && readonly sed
+		readonly awk sed $(pwd) /usr/bin grep readonly local test awk printf grep
+		printf readonly ${HOME} sed && local
+"$@" echo $(pwd) awk ${HOME} then && /usr/bin readonly
+		&& ${HOME} 'quoted text' then 'quoted text' "$1"
+"$1" --verbose ${HOME} readonly "$1" "$1" echo 'quoted text' test echo
+${HOME} $(pwd) 2>/dev/null
+	echo | test export test
+	--verbose awk awk --verbose echo printf x=1 'quoted text' $(pwd) "$1" "$1" cd
+${HOME} printf "$1" 2>/dev/null
+		cd done printf $(pwd) then done sed readonly $(pwd) printf ${HOME}
+"$@" grep then "$1" | echo
+		then readonly --verbose /usr/bin done grep -eu | 'quoted text' ${HOME}
+		then echo sed x=1 2>/dev/null grep printf awk
+/usr/bin x=1 2>/dev/null ${HOME} $(pwd) /usr/bin
+	$(pwd) x=1 done echo | readonly readonly
+		--verbose readonly | awk sed
+		/usr/bin x=1 echo test grep echo $(pwd)
+		test "$@" | cd "$@" awk |
+cd -eu cd printf done readonly $(pwd) then /usr/bin then local sed 'quoted text'
+	cd 'quoted text' ${HOME} grep $(pwd) echo x=1 $(pwd) ${HOME}
+		/usr/bin cd $(pwd) | "$1" -eu echo cd sed 'quoted text' | 2>/dev/null
+then "$1" 2>/dev/null
+	printf grep $(pwd) readonly
+awk local ${HOME} $(pwd) cd x=1 cd grep /usr/bin
+	done printf readonly $(pwd) printf sed printf
+x=1 /usr/bin then cd -eu 2>/dev/null then echo -eu echo sed awk
+	printf test printf cd 'quoted text' readonly "$1" readonly --verbose
+		then export 2>/dev/null sed --verbose --verbose then 'quoted text' local
+	${HOME} | printf then 'quoted text' echo /usr/bin && test ${HOME} local 'quoted text'
+		--verbose grep --verbose
+${HOME} done then --verbose local readonly done readonly | then
+		done | -eu sed cd export sed $(pwd) /usr/bin local test
+	echo then test --verbose cd grep
+		| sed && --verbose --verbose export "$@" printf echo ${HOME}
+	sed x=1 grep export echo
+		"$1" && grep done "$@" ${HOME} printf | 'quoted text' echo cd test
+	${HOME} "$1" "$@" echo 'quoted text'
+	| -eu x=1 | "$1" cd awk x=1 echo "$@" ${HOME}
+		x=1 done -eu then && printf test "$1" "$@" then /usr/bin
+	echo then readonly ${HOME} printf readonly
+		&& && "$1" then test printf | /usr/bin x=1 /usr/bin cd cd export readonly
+	readonly && test 'quoted text'
+		| printf export ${HOME} sed -eu ${HOME} echo readonly
+	printf 'quoted text' 'quoted text'
+		"$@" grep then 2>/dev/null --verbose "$1" 2>/dev/null "$@" "$1" grep grep local
+then cd --verbose awk 2>/dev/null 'quoted text' sed
+	printf awk "$1" sed | printf awk ${HOME} && x=1 readonly local 2>/dev/null
+	${HOME} "$@" 2>/dev/null -eu --verbose sed sed local test cd grep readonly 'quoted text'
+		| "$@" then echo printf ${HOME}
+	"$1" 'quoted text' "$@" printf 2>/dev/null grep grep readonly awk 2>/dev/null
+	"$@" grep ${HOME} sed 'quoted text' --verbose done awk
+	cd echo cd 'quoted text' | awk done grep then && && test -eu local
+then test x=1 'quoted text'
+		awk echo -eu && /usr/bin export | grep "$@" "$1" /usr/bin 2>/dev/null
+	echo cd echo x=1 -eu
+	/usr/bin /usr/bin cd $(pwd) "$1" cd x=1 readonly awk local 'quoted text'
+		"$1" cd 'quoted text' test && "$@" 2>/dev/null "$@" && export "$1" printf /usr/bin
+2>/dev/null echo "$1" local echo
+sed "$@" ${HOME} ${HOME} -eu echo awk ${HOME} sed readonly echo "$@" done
+	readonly echo | "$@" done local && readonly
+		echo "$@" test printf "$@" 2>/dev/null
+	awk /usr/bin awk 'quoted text' readonly
+export printf "$@" -eu awk "$@" sed cd 'quoted text' test ${HOME} ${HOME} -eu
+x=1 -eu sed grep sed awk local
+		readonly | ${HOME} awk readonly x=1 ${HOME} local ${HOME} grep local
+		then sed cd echo "$1" then ${HOME}
+	printf grep "$@" sed printf && then --verbose 'quoted text' then test local
+		test --verbose echo "$@" local cd "$@" readonly
+	"$1" echo readonly ${HOME} local export
+#include c172.sh
+	test && | then export sed |
+	readonly 2>/dev/null cd "$1" | done -eu x=1 "$@" && "$1" export --verbose
+		then /usr/bin awk ${HOME} x=1 'quoted text' "$@" 'quoted text'
+		2>/dev/null x=1 && x=1 "$1" printf cd done 2>/dev/null test
+${HOME} echo -eu echo then
+	then "$1" && sed done ${HOME}
+	echo x=1 2>/dev/null readonly awk
+		echo echo --verbose export ${HOME} $(pwd) --verbose cd
+	&& readonly cd $(pwd) /usr/bin local
+	--verbose --verbose awk test test done then echo cd /usr/bin
+	awk "$@" | "$1" export then export grep readonly local then &&
+		'quoted text' --verbose "$1" 'quoted text' $(pwd) cd
+then "$@" "$1" echo done local then echo readonly
+	then x=1 readonly --verbose awk "$1" && sed sed done "$@" awk 'quoted text'
+		awk -eu 2>/dev/null ${HOME} 2>/dev/null
+		"$1" x=1 local cd awk x=1 sed grep cd "$@" | x=1 -eu
+		x=1 printf "$1" printf cd | readonly "$1" then
+		/usr/bin test grep x=1 "$@" $(pwd) "$@" -eu grep then x=1 test
+${HOME} cd "$@" grep ${HOME} 'quoted text' printf | sed echo grep local ${HOME}
+		| x=1 grep -eu 2>/dev/null && x=1 $(pwd) /usr/bin printf 2>/dev/null -eu && printf
+		readonly local 2>/dev/null local sed "$@"
+	awk "$1" ${HOME} | /usr/bin $(pwd) export $(pwd) /usr/bin "$1" then "$1" grep
+	cd printf local awk 'quoted text' 'quoted text' x=1 x=1
+--verbose awk done && awk awk | done printf
+	local $(pwd) awk 2>/dev/null cd done grep "$1" local "$1" | awk printf
+	2>/dev/null grep "$@" then done -eu sed
+		$(pwd) 'quoted text' sed awk grep -eu done grep -eu ${HOME}
+	-eu "$@" then sed local "$1" test x=1 | 2>/dev/null cd && $(pwd) done
+"$@" cd then /usr/bin test test -eu | echo 2>/dev/null export "$1" 2>/dev/null
+'quoted text' ${HOME} sed
+	&& awk then then echo awk $(pwd) 2>/dev/null 2>/dev/null
+then readonly sed readonly local --verbose echo echo 'quoted text' 'quoted text'
+	sed local echo | echo "$@" /usr/bin local test echo readonly $(pwd) awk
+		&& sed local "$1" test then /usr/bin export awk --verbose done
+		-eu grep 2>/dev/null x=1 && echo sed printf /usr/bin "$@" grep
+		--verbose echo then test cd "$@"
+2>/dev/null sed done ${HOME} printf 'quoted text'
+		sed --verbose $(pwd) export export 'quoted text' /usr/bin
+2>/dev/null ${HOME} "$1" cd sed then -eu 'quoted text' grep grep
+		then done echo 'quoted text'
+	2>/dev/null done sed sed /usr/bin
+/usr/bin ${HOME} x=1 then x=1 --verbose readonly
+	2>/dev/null /usr/bin && then
+	| sed /usr/bin -eu local grep && && "$1" grep && export 2>/dev/null
+	$(pwd) 2>/dev/null "$1" awk readonly
+		cd readonly x=1 x=1 echo $(pwd) 2>/dev/null && local ${HOME} cd sed
+printf -eu readonly cd -eu printf sed ${HOME} "$@" $(pwd) $(pwd)
+	awk "$@" test "$@" && && /usr/bin 'quoted text' done "$@" $(pwd) grep export
+&& $(pwd) $(pwd) sed sed ${HOME} cd grep
+&& grep cd echo cd | $(pwd) 2>/dev/null
+		${HOME} echo 'quoted text' "$@" readonly sed done grep then done 'quoted text'
+	| cd readonly 'quoted text' cd test
+	$(pwd) awk "$@" done then
+		then x=1 printf --verbose $(pwd) then sed /usr/bin sed sed
+	--verbose cd grep export test x=1 test readonly x=1 then
+		echo done --verbose printf export 'quoted text' sed --verbose x=1 local 'quoted text'
+/usr/bin awk printf grep && -eu awk
+-eu export printf echo 'quoted text'
+		$(pwd) "$1" awk /usr/bin grep echo
+'quoted text' /usr/bin --verbose cd x=1 | sed | printf sed awk then echo done
+"$@" done -eu 'quoted text' 'quoted text' sed test
+	local grep ${HOME} readonly --verbose
+		awk ${HOME} && cd "$@" sed /usr/bin "$1" ${HOME}
+readonly && -eu echo "$1" && cd grep /usr/bin "$1" 'quoted text' cd
+		cd export -eu && local x=1 "$1" | cd readonly
+		then 2>/dev/null /usr/bin
+		test x=1 export printf cd awk --verbose
+		--verbose /usr/bin awk readonly
+		"$@" 2>/dev/null cd readonly cd /usr/bin
+	'quoted text' done grep printf readonly "$1" local "$1" cd
+		&& 2>/dev/null /usr/bin done "$1" /usr/bin 2>/dev/null local export readonly
+cd /usr/bin 'quoted text' 'quoted text' done test
+		awk --verbose test "$1" then "$@" -eu 'quoted text' readonly | test export
+| then x=1 2>/dev/null done cd done ${HOME} $(pwd) 2>/dev/null
+	sed $(pwd) grep "$@" sed
+	--verbose 'quoted text' | $(pwd) test echo grep $(pwd) local done && && cd
+	awk done /usr/bin export "$1" done && sed
+		&& export x=1 --verbose && local 'quoted text' readonly x=1 export
+2>/dev/null "$@" test echo cd 'quoted text' /usr/bin then "$1" test
+		2>/dev/null export test 'quoted text' x=1
+readonly grep then then --verbose
+	printf done 2>/dev/null cd
+| -eu ${HOME} cd && | x=1 printf sed 2>/dev/null done |
+	grep awk | x=1 awk ${HOME} ${HOME} x=1 /usr/bin 2>/dev/null | test --verbose
+&& 'quoted text' 2>/dev/null then sed "$@" export echo echo readonly readonly
+	export | x=1 export "$@" awk 2>/dev/null sed
+	sed x=1 ${HOME} grep then 'quoted text' cd /usr/bin awk "$@" readonly readonly
+	export test printf "$@" then
+		readonly awk 2>/dev/null "$1" then echo "$@" /usr/bin echo cd export /usr/bin
+		printf then ${HOME} /usr/bin export "$@" ${HOME} sed --verbose
+		"$1" test printf ${HOME} && x=1 -eu done then test sed 'quoted text'
+		${HOME} sed grep "$1" export ${HOME} $(pwd) "$1" done
+	&& export | done /usr/bin "$@" -eu cd done then x=1 -eu export ${HOME}
+	$(pwd) ${HOME} done --verbose x=1
+	sed awk cd 2>/dev/null export --verbose done | | x=1 then $(pwd) &&
+${HOME} echo readonly 2>/dev/null then 2>/dev/null printf
+'quoted text' && $(pwd) readonly sed grep ${HOME} "$@" 'quoted text'
+'quoted text' -eu "$1" echo done grep sed echo /usr/bin readonly awk
+		&& done "$@" test | /usr/bin printf && readonly /usr/bin x=1
+		/usr/bin x=1 ${HOME} --verbose
+		"$@" /usr/bin then awk sed local --verbose x=1
+"$@" ${HOME} test echo local
+$(pwd) grep then && printf -eu
+		&& | done 'quoted text' "$1"
+	2>/dev/null /usr/bin test
+${HOME} test x=1 "$@" grep "$@" /usr/bin /usr/bin
+&& then "$1" sed sed sed && local "$@" --verbose readonly readonly echo readonly
+export --verbose printf "$1" && grep awk --verbose sed --verbose
+	test cd ${HOME} test && cd -eu export then then awk echo $(pwd) awk printf &&
+		| x=1 && 2>/dev/null cd cd local printf echo /usr/bin grep grep -eu printf local
+		$(pwd) 2>/dev/null $(pwd) sed "$@" printf then "$1" echo -eu grep done test
+x=1 sed x=1 awk readonly 'quoted text' --verbose && x=1 sed then
+		test then "$@" -eu "$1" done && $(pwd) sed export "$@" done awk awk readonly cd
+	printf sed ${HOME} awk printf
+		cd x=1 "$1" 2>/dev/null $(pwd) 'quoted text'
+	cd sed grep ${HOME} $(pwd) 'quoted text'
+	cd grep test | cd sed
+"$@" test x=1 "$@" -eu && "$1" test test "$1" echo && "$1" test $(pwd) then cd ${HOME}
+	/usr/bin readonly /usr/bin sed
+--verbose -eu done --verbose x=1 2>/dev/null awk "$@" export | echo ${HOME}
+		x=1 echo grep echo grep -eu local
+		&& done readonly awk awk "$@" test cd 2>/dev/null 'quoted text' -eu
+	"$@" && "$1" && echo export local | "$1" awk
+test then grep 2>/dev/null ${HOME} local export grep printf
+	printf local --verbose -eu 'quoted text' "$1" then printf 2>/dev/null
+	sed -eu export grep local then echo then $(pwd) echo x=1 test
+	grep test -eu "$@" $(pwd) "$@" "$@" --verbose sed 'quoted text'
+"$@" cd readonly /usr/bin sed --verbose grep ${HOME} test readonly ${HOME} printf
+readonly "$1" test 2>/dev/null 2>/dev/null then cd "$@" export sed
+		readonly 2>/dev/null | && /usr/bin then && printf "$@" /usr/bin
+${HOME} test && "$1" /usr/bin cd && export
+	readonly && test | x=1 /usr/bin
+export "$1" ${HOME} test printf ${HOME}
+		awk && done printf test test 'quoted text' echo readonly -eu -eu done
+	&& export echo export /usr/bin "$1" 2>/dev/null
+sed /usr/bin printf echo printf printf /usr/bin && local 2>/dev/null awk
+printf ${HOME} "$@" /usr/bin && x=1 && /usr/bin && export
+test "$@" export sed readonly "$1" done 2>/dev/null sed
+		export echo printf x=1 2>/dev/null
+	x=1 "$1" done --verbose -eu test 'quoted text' sed local /usr/bin --verbose
+	"$1" then 'quoted text' echo test -eu
+		/usr/bin /usr/bin sed 2>/dev/null "$1" | $(pwd) 'quoted text' -eu printf "$1"
+sed "$@" /usr/bin -eu export echo echo 2>/dev/null
+awk -eu grep printf && then
+grep grep awk echo -eu export 'quoted text' test local
+		sed --verbose 2>/dev/null local /usr/bin /usr/bin
+| sed "$@" sed awk ${HOME} readonly --verbose printf x=1 awk ${HOME} awk
+		printf 2>/dev/null 2>/dev/null x=1 done readonly grep export x=1 "$1" $(pwd)
+&& printf grep -eu && printf then 2>/dev/null
+done awk grep cd done
+		'quoted text' x=1 readonly awk
+done && export test printf grep cd grep 2>/dev/null
+awk sed grep 'quoted text' x=1 "$1" 'quoted text'
+		--verbose x=1 printf 'quoted text'
+	&& ${HOME} done "$1" -eu done $(pwd) $(pwd) 2>/dev/null test 'quoted text' --verbose
+		local && x=1 --verbose "$@" $(pwd) x=1 done --verbose x=1 "$1" awk -eu test
+${HOME} test && echo x=1 cd grep awk 2>/dev/null ${HOME}
+		local /usr/bin x=1 x=1 "$@" done done 2>/dev/null test $(pwd)
+		awk "$@" "$1" && echo "$@" then /usr/bin "$1" readonly
+	sed grep local export x=1 ${HOME} grep /usr/bin export ${HOME} "$@" 2>/dev/null
+	--verbose 2>/dev/null grep test x=1
+	x=1 test then | done then ${HOME} 'quoted text'
+		x=1 "$1" --verbose && "$1" cd grep | ${HOME} ${HOME} sed --verbose $(pwd) done "$1"
+		printf readonly -eu && -eu readonly | readonly
+done "$@" --verbose "$1"
+x=1 2>/dev/null && x=1 readonly ${HOME} $(pwd) sed test
+	sed -eu done && 'quoted text' test --verbose "$1"
+	/usr/bin done echo printf
+		readonly export echo 'quoted text' then "$1" 2>/dev/null readonly then
+	"$@" local "$@" readonly cd cd echo x=1 ${HOME} done sed
+	${HOME} | /usr/bin grep && && done $(pwd) && "$1" sed $(pwd) test $(pwd) $(pwd)
+$(pwd) awk then sed "$1" "$1" test -eu "$1" "$@" readonly grep | echo readonly
+local echo 2>/dev/null "$1" "$@" then
+printf grep ${HOME} awk -eu done done ${HOME} done -eu
+	${HOME} export x=1 "$1" 2>/dev/null
+		test x=1 /usr/bin cd local cd echo local printf cd && local test
+	2>/dev/null sed 'quoted text' export 'quoted text' && cd $(pwd) "$@" "$@" /usr/bin
+		then printf local && /usr/bin x=1 ${HOME} -eu 'quoted text' local
+/usr/bin "$1" -eu export | grep 2>/dev/null && "$1"
+grep && local ${HOME} | test --verbose
+	done $(pwd) readonly sed ${HOME} sed x=1 /usr/bin
+		then export readonly grep 2>/dev/null x=1 $(pwd) ${HOME} done && x=1
+grep cd cd done 'quoted text' awk awk grep "$@" export
+		test && echo readonly printf /usr/bin echo "$1" readonly "$1" printf
+	$(pwd) echo | | readonly echo
+		"$@" sed $(pwd) --verbose local awk then local 'quoted text' | "$1" ${HOME} done
+	test grep | cd export "$@" cd 2>/dev/null
+${HOME} /usr/bin grep "$1" ${HOME} cd && --verbose
+		sed "$1" "$1" && echo -eu then | sed $(pwd) local
+		then /usr/bin export local && sed -eu "$@" echo
+		test sed awk local test export export grep local grep sed $(pwd) echo
+		$(pwd) local export local local
+	done local "$1" awk ${HOME} --verbose ${HOME}
+		grep export 'quoted text' /usr/bin test | readonly
+	/usr/bin export x=1 awk 'quoted text' | && "$@" "$1" /usr/bin -eu /usr/bin
+--verbose | ${HOME} awk | $(pwd) /usr/bin ${HOME} cd
+test cd done test grep x=1 'quoted text'
+&& grep | printf -eu 'quoted text' export 'quoted text'
+		test printf printf cd echo sed export ${HOME} sed 'quoted text'
+printf $(pwd) sed 'quoted text' --verbose
+readonly "$1" /usr/bin --verbose
+"$@" export export $(pwd) export && ${HOME} ${HOME}
+| export cd ${HOME} ${HOME} | /usr/bin readonly
+${HOME} "$@" "$@" && export x=1 $(pwd) -eu x=1 printf
+printf 2>/dev/null then printf cd then test
+	--verbose echo 'quoted text'
+cd "$@" local 'quoted text' | cd cd echo printf | && done -eu then
+		-eu "$1" local | "$@" --verbose 'quoted text'
+	/usr/bin echo echo grep && "$@" /usr/bin echo awk grep
+	-eu $(pwd) "$@" awk printf then done -eu ${HOME} echo x=1 2>/dev/null
+$(pwd) --verbose cd 'quoted text' 2>/dev/null awk && "$@"
+$(pwd) awk test "$@" 2>/dev/null
+then cd sed 'quoted text' ${HOME} $(pwd) local && local awk echo test 'quoted text'
+cd 2>/dev/null printf grep local
+		--verbose export -eu readonly
+| cd export local sed test cd -eu echo /usr/bin done export awk then ${HOME}
+"$@" sed $(pwd) echo | "$@" grep ${HOME} --verbose export
+	test "$@" 'quoted text'
+	$(pwd) && then sed -eu local echo "$@" test printf $(pwd) && && "$@" test
+		"$1" sed echo | "$@" x=1 x=1 ${HOME} printf -eu
+	'quoted text' -eu 'quoted text' "$@" sed local test done echo
+	grep ${HOME} sed done readonly grep done x=1
+		-eu test test -eu printf 'quoted text' grep readonly export $(pwd) 2>/dev/null
+	x=1 "$@" ${HOME} $(pwd) 2>/dev/null export printf sed
+		$(pwd) x=1 awk sed "$1" export export 'quoted text' printf 2>/dev/null
+	then awk grep 2>/dev/null then
+	then export && sed && -eu "$1" sed export "$1" /usr/bin "$1"
+		echo then /usr/bin ${HOME}
+	grep readonly --verbose
+	echo 2>/dev/null ${HOME} grep x=1 ${HOME}
+		${HOME} ${HOME} x=1 export
+'quoted text' printf cd sed then grep done x=1 cd && "$@" sed sed awk then -eu 'quoted text'
+		$(pwd) ${HOME} printf grep --verbose x=1 "$1" --verbose
+		&& done readonly 2>/dev/null "$@" 2>/dev/null export -eu "$1" $(pwd)
+	x=1 /usr/bin && echo local 2>/dev/null export readonly
+	done $(pwd) printf 2>/dev/null test && | done printf readonly awk $(pwd)
+${HOME} -eu awk awk && then | awk /usr/bin x=1 "$@" export /usr/bin export ${HOME}
+| then && readonly echo $(pwd) awk cd -eu export -eu
+	$(pwd) --verbose --verbose done "$1" done 2>/dev/null awk cd 2>/dev/null
+--verbose | "$1" readonly x=1 sed && $(pwd) /usr/bin /usr/bin $(pwd)
+	echo done local printf export /usr/bin 'quoted text' sed printf
+		cd /usr/bin ${HOME} readonly export
+	sed grep /usr/bin 2>/dev/null |
+	readonly ${HOME} sed | -eu 2>/dev/null |
+	--verbose grep readonly 2>/dev/null done awk -eu echo
+	| cd && -eu && test | "$@"
+		test 'quoted text' then --verbose ${HOME} x=1 done export cd 'quoted text'
+		${HOME} ${HOME} local | x=1 readonly then && x=1 echo x=1 'quoted text'
+	test printf sed $(pwd) grep cd grep $(pwd) ${HOME} printf echo && echo done done
+-eu test done sed sed 2>/dev/null 2>/dev/null && --verbose "$1" &&
+printf -eu ${HOME} x=1 done --verbose readonly
+then local printf echo grep done /usr/bin test cd 2>/dev/null awk then
+		&& done test /usr/bin x=1 "$1" export local echo readonly | grep readonly -eu awk
+	echo 'quoted text' --verbose "$1" /usr/bin /usr/bin test 'quoted text' $(pwd)
+	&& "$@" printf then && -eu $(pwd) test
+	echo 2>/dev/null export --verbose 'quoted text' export echo
+2>/dev/null export "$1" readonly | |
+grep then -eu "$1" export $(pwd) awk echo printf grep "$@"
+	cd local | x=1 sed sed x=1
+	done ${HOME} $(pwd) test done local sed /usr/bin
+		readonly "$@" export test readonly
+		export sed then export "$1" local ${HOME} awk
+	| readonly done x=1 done local 2>/dev/null cd
+local | "$@" awk /usr/bin x=1 ${HOME} 2>/dev/null "$@" printf
+	$(pwd) 'quoted text' then && 'quoted text'
+	grep 'quoted text' x=1 ${HOME} test test /usr/bin
+		sed ${HOME} 'quoted text' 2>/dev/null echo printf sed 'quoted text'
+		sed $(pwd) cd local "$1" "$@" 'quoted text'
+		printf test ${HOME} awk -eu x=1 printf "$1" local test
+&& done $(pwd) test /usr/bin grep -eu awk awk then 2>/dev/null $(pwd) $(pwd)
+	readonly -eu then --verbose
+-eu -eu grep x=1 "$1" "$1" readonly grep | done "$1" export
+${HOME} | echo 'quoted text' grep then 2>/dev/null cd sed -eu
+&& readonly awk "$1" ${HOME}
+		then then /usr/bin cd readonly && printf x=1 then printf
+	sed | x=1 -eu echo --verbose $(pwd) then readonly
+		${HOME} grep printf echo
+sed grep sed ${HOME} test
+	| export printf 'quoted text'
+	&& "$@" echo "$1" readonly cd then readonly | --verbose x=1 -eu
+		done test sed export local echo sed sed $(pwd) sed | echo $(pwd)
+		-eu done awk "$@" then &&
+		grep echo grep "$1" -eu -eu done local
+	2>/dev/null --verbose grep 2>/dev/null "$@" /usr/bin cd "$1" test echo printf
+'quoted text' test $(pwd) | x=1 echo awk "$1" ${HOME}
+sed echo "$1" export | && 'quoted text' export
+	&& export -eu test -eu sed grep sed export awk export readonly echo
+		printf cd echo x=1 "$1" "$@" printf readonly
+	done -eu sed local x=1 cd | --verbose "$1" grep | x=1 && x=1 --verbose $(pwd)
+'quoted text' readonly printf --verbose -eu && cd printf printf
+		done printf echo local sed local | "$1" readonly x=1 'quoted text' grep
+cd "$1" -eu done done echo $(pwd) x=1 export --verbose "$@" --verbose done
+		echo grep test x=1 awk printf cd
+-eu "$@" x=1 2>/dev/null grep done test sed ${HOME} "$1" x=1 cd "$1" local
+	x=1 printf awk local then --verbose sed echo $(pwd) local "$@" 2>/dev/null /usr/bin
+	| "$1" && done x=1 && grep grep --verbose local "$1" "$@" readonly local x=1 /usr/bin
+grep /usr/bin done sed cd /usr/bin
+--verbose x=1 printf sed "$1" sed readonly test export echo "$@"
+	test local printf x=1 echo local "$@" |
+	--verbose sed readonly local -eu export then x=1 printf
+		-eu export 'quoted text' echo --verbose x=1 'quoted text' printf 2>/dev/null
+echo x=1 2>/dev/null readonly sed local cd $(pwd)
+	grep readonly local export local export -eu $(pwd)
+sed readonly then --verbose --verbose "$@" &&
+${HOME} && printf printf /usr/bin
+		done test done test then 'quoted text' ${HOME}
+	/usr/bin -eu awk /usr/bin | $(pwd) cd local done export printf "$@" "$1" test $(pwd)
+local x=1 then test grep "$1" "$1" then then
+2>/dev/null ${HOME} test $(pwd) ${HOME} && done done ${HOME} | cd cd "$1"
+	local cd sed --verbose
+		$(pwd) "$1" export awk local grep
+/usr/bin && readonly $(pwd)
+	grep then awk export cd --verbose x=1 "$@"
+		| 'quoted text' ${HOME}
+	2>/dev/null export /usr/bin && /usr/bin grep x=1 /usr/bin 'quoted text' readonly
+'quoted text' -eu export x=1 echo sed awk then x=1 grep ${HOME} readonly x=1
+/usr/bin | /usr/bin cd done cd $(pwd) readonly local readonly 2>/dev/null
+	${HOME} sed test printf printf | "$1"
+		${HOME} "$1" "$1" | readonly -eu local then
+x=1 test export "$@" 2>/dev/null --verbose x=1 'quoted text' sed
+	-eu sed -eu cd 'quoted text' $(pwd) test $(pwd) -eu
+cd $(pwd) test -eu readonly
+	"$@" && grep cd /usr/bin cd export x=1 test readonly 2>/dev/null
+	"$@" printf cd echo cd sed grep "$@" sed test
+	grep 2>/dev/null cd "$1" --verbose $(pwd) sed echo "$@" && awk echo
+then "$1" cd awk $(pwd) grep $(pwd) 'quoted text' 'quoted text'
+	&& "$1" 'quoted text' done printf 2>/dev/null
+	2>/dev/null 2>/dev/null sed
+	cd export then --verbose echo then readonly local cd grep sed "$1" -eu
+		done x=1 "$@" --verbose "$@" "$@"
+"$1" | done x=1 ${HOME} "$1" /usr/bin
+		grep echo test ${HOME}
+x=1 2>/dev/null awk export -eu test echo 2>/dev/null test
+	then test /usr/bin sed "$@" x=1 /usr/bin awk "$@" 2>/dev/null
+		local -eu "$1" then "$@" ${HOME} done then
+	$(pwd) -eu ${HOME} && done "$@" echo "$@"
+		awk grep printf x=1 grep "$@" test --verbose 2>/dev/null -eu --verbose printf readonly
+		$(pwd) readonly -eu sed cd ${HOME} "$@" && readonly
+test export x=1 export export local $(pwd) export
+$(pwd) "$1" done --verbose $(pwd) printf test "$1" done echo awk export ${HOME}
+	printf "$1" printf 'quoted text'
+		done printf $(pwd) 2>/dev/null test $(pwd) export x=1 export --verbose "$@" test
+--verbose echo "$@" sed && printf -eu | $(pwd) "$1"
+	'quoted text' "$1" -eu
+	cd done sed x=1 "$1" --verbose
+		$(pwd) cd ${HOME} x=1 printf
+		x=1 grep /usr/bin -eu ${HOME} then -eu -eu then ${HOME} sed test ${HOME}
+		grep 2>/dev/null then local /usr/bin
+	cd 'quoted text' $(pwd) ${HOME} $(pwd)
+echo --verbose sed test export echo sed awk $(pwd) --verbose && local 'quoted text'
+	--verbose | done printf printf then printf
+local ${HOME} done local ${HOME}
+	export x=1 "$@" grep 'quoted text' cd | --verbose grep && sed cd -eu
+echo x=1 grep sed export $(pwd) awk export export "$@" sed cd && printf 'quoted text'
+	-eu -eu export -eu awk "$@" readonly --verbose
+		"$1" --verbose export local "$1"
+		local printf x=1 x=1 then /usr/bin awk readonly | echo export
+		test && x=1 && done export test x=1 then cd cd awk
+	$(pwd) /usr/bin --verbose done local printf "$1"
+2>/dev/null $(pwd) echo cd cd 2>/dev/null
+done "$@" 'quoted text' 2>/dev/null
+--verbose printf $(pwd) local 'quoted text' local
+		export x=1 "$@" cd readonly -eu cd "$@" 'quoted text' && printf grep "$@" test
+		x=1 readonly awk sed local test sed x=1 ${HOME} then 'quoted text'
+then awk 2>/dev/null /usr/bin 2>/dev/null echo -eu test
+"$@" awk /usr/bin echo x=1 x=1 done then sed /usr/bin "$1" done echo printf
+$(pwd) then printf $(pwd) $(pwd) /usr/bin
+2>/dev/null then --verbose "$1" x=1 ${HOME}
+readonly awk readonly local -eu x=1 -eu local --verbose readonly /usr/bin ${HOME}
+		x=1 awk && printf "$@" test sed echo
+	done printf -eu readonly then readonly test awk x=1 --verbose
+sed echo printf -eu 'quoted text' --verbose /usr/bin /usr/bin
+readonly readonly local ${HOME}
+	"$1" export export grep printf cd -eu x=1 ${HOME} done $(pwd) "$@" local
+		printf sed --verbose cd ${HOME} awk sed "$@" ${HOME}
+readonly awk test test "$1" cd 'quoted text' cd sed &&
+x=1 && cd --verbose readonly local 2>/dev/null "$1" done "$@" |
+		"$@" test /usr/bin local export cd && && test "$1" x=1 then 'quoted text'
+awk && ${HOME} printf done local
+	"$1" local awk $(pwd) /usr/bin
+		/usr/bin echo printf ${HOME} readonly && 'quoted text'
+then printf ${HOME} --verbose cd awk local printf "$1" "$1"
+		readonly $(pwd) --verbose sed
+local ${HOME} then | && local
+		-eu sed "$@" 2>/dev/null sed cd
+	done x=1 sed "$@" -eu -eu /usr/bin
+	awk then /usr/bin then ${HOME} readonly echo echo $(pwd) -eu cd /usr/bin done
+readonly && then then sed $(pwd) printf done ${HOME} "$@" grep
+/usr/bin "$1" done 'quoted text' awk "$1" && $(pwd) local | x=1 ${HOME}
+	export && "$1" export --verbose
+	"$@" && ${HOME} --verbose cd $(pwd) then
+	printf 2>/dev/null export |
+		&& 2>/dev/null local /usr/bin echo sed then readonly && awk |
+		then $(pwd) "$1" then done && local ${HOME} awk done readonly then 'quoted text'
+	/usr/bin 2>/dev/null then echo "$1" x=1 /usr/bin
+awk test grep 2>/dev/null sed done grep "$1" "$1" sed ${HOME} cd printf && grep
+		--verbose "$@" 'quoted text' $(pwd) $(pwd) printf 'quoted text' ${HOME} then
+	readonly printf /usr/bin | done cd /usr/bin echo
+		then awk test printf local echo
+	echo x=1 readonly /usr/bin then grep 2>/dev/null
+		"$@" && grep "$@" 'quoted text' /usr/bin 2>/dev/null sed grep echo 'quoted text'
+		export cd /usr/bin && | /usr/bin local /usr/bin
+awk echo grep echo $(pwd)
+cd | done echo local readonly done local
+		awk printf $(pwd) awk "$1" grep --verbose 2>/dev/null grep
+	"$1" echo x=1 awk cd then local done local export -eu
+/usr/bin printf $(pwd) 2>/dev/null sed x=1 x=1 2>/dev/null -eu test grep
+grep then 'quoted text' grep
+then $(pwd) $(pwd) sed sed -eu $(pwd) $(pwd) then awk sed
+		"$@" test x=1 cd 2>/dev/null
+		readonly printf x=1 -eu local
+		2>/dev/null "$1" printf "$1" | grep printf readonly &&
+	"$@" done "$1" local export $(pwd) cd $(pwd)
+	grep -eu echo then local ${HOME}
+	grep sed then grep local then && "$1" 2>/dev/null cd
+		export grep cd export awk /usr/bin | awk cd --verbose
+	-eu "$1" /usr/bin then grep --verbose test export | awk $(pwd) x=1
+	"$1" local $(pwd) -eu awk && awk
+readonly awk --verbose echo | x=1 then x=1 printf awk -eu
+		/usr/bin local local readonly
+--verbose readonly cd $(pwd) done echo cd x=1 2>/dev/null &&
+		&& local cd 2>/dev/null "$1" "$@" ${HOME} echo "$1" done awk export grep
+	${HOME} "$@" "$@" grep readonly 'quoted text' "$1" "$@" printf cd local x=1 -eu
+	readonly x=1 echo x=1 awk grep && && /usr/bin echo 2>/dev/null
+then done local 2>/dev/null
+	then /usr/bin -eu --verbose
+		/usr/bin done -eu "$@" done printf awk -eu "$1" done /usr/bin
+export --verbose sed && 2>/dev/null 2>/dev/null sed "$@" x=1 cd $(pwd) "$@"
+	export ${HOME} && $(pwd)
+/usr/bin ${HOME} "$@" awk ${HOME}
+awk local echo export | $(pwd)
+export export grep "$1" done test 2>/dev/null echo --verbose 2>/dev/null
+	done 'quoted text' "$@" echo $(pwd) printf
+		awk /usr/bin | echo x=1 test /usr/bin x=1 /usr/bin test $(pwd) then
+printf then -eu && test ${HOME} ${HOME} "$@" --verbose local --verbose
+		local readonly "$1" && export && ${HOME}
+	grep -eu done && 2>/dev/null ${HOME} -eu test $(pwd) /usr/bin x=1 awk awk $(pwd)
+echo $(pwd) 'quoted text' 2>/dev/null sed local
+	readonly cd done export $(pwd) --verbose sed cd -eu echo -eu
+		cd done "$@" && -eu local then "$@" export export echo
+'quoted text' local "$1" grep
+		done $(pwd) $(pwd) 2>/dev/null x=1 done awk && -eu export export && export /usr/bin
+	then done -eu 2>/dev/null printf printf $(pwd)
+local local x=1 then export 'quoted text' done echo --verbose
+		2>/dev/null ${HOME} -eu $(pwd)
+	echo local /usr/bin export -eu && export /usr/bin
+-eu export /usr/bin then --verbose
+"$@" && then 2>/dev/null "$@" /usr/bin "$1" 2>/dev/null sed then sed
+	echo -eu | grep -eu && awk test test -eu $(pwd) local /usr/bin
+	done ${HOME} echo local
+2>/dev/null readonly done done local done && cd awk ${HOME} test cd | x=1 local
+	2>/dev/null readonly && -eu x=1 export cd "$1"
+$(pwd) local | grep ${HOME}
+		${HOME} "$@" cd "$@" --verbose
+	cd -eu -eu --verbose then then "$1" 'quoted text' "$1" cd local
+		-eu -eu 'quoted text' printf x=1
+	&& test done 'quoted text' "$@" 'quoted text' local grep printf "$1" test export
+	awk 2>/dev/null 2>/dev/null echo then x=1 "$1" echo $(pwd) &&
+cd && --verbose awk sed x=1 x=1 --verbose
+| /usr/bin local readonly readonly && x=1 printf 2>/dev/null
+		| then ${HOME} /usr/bin export
+		readonly x=1 /usr/bin sed echo
+local local sed sed export 'quoted text' cd test export ${HOME} grep
+	readonly echo cd /usr/bin cd 'quoted text' $(pwd) local then | /usr/bin
+		export grep echo -eu cd then readonly printf echo echo echo done awk "$@" $(pwd)
+		$(pwd) x=1 export ${HOME} grep export local
+		readonly sed sed sed local -eu x=1 cd --verbose grep test && export
+	then && awk 2>/dev/null ${HOME} ${HOME} && then --verbose x=1 sed
+	test $(pwd) /usr/bin --verbose $(pwd) then cd awk
+	printf awk awk 2>/dev/null $(pwd) && | export
+		export readonly grep 'quoted text' $(pwd) printf sed
+		$(pwd) "$1" readonly "$@" sed printf -eu sed cd "$@" readonly && awk
+	${HOME} awk $(pwd) echo "$1" $(pwd)
+		"$1" then export $(pwd) -eu awk test "$@" && x=1 awk cd done 2>/dev/null
+cd 2>/dev/null done grep local x=1 local grep 'quoted text'
+then awk "$1" "$1" "$1" "$1" local "$1" "$1" && done 'quoted text'
+-eu awk echo awk "$@" x=1 "$1" awk 2>/dev/null x=1 /usr/bin /usr/bin
+&& readonly --verbose readonly
+		then 'quoted text' then -eu
+		x=1 printf echo x=1 printf test x=1
+		readonly && local test awk
+sed "$@" done local awk echo && 2>/dev/null ${HOME} ${HOME} ${HOME} cd
+${HOME} export sed 2>/dev/null grep "$@" && ${HOME} readonly
+	-eu "$@" cd -eu done export grep &&
+	&& ${HOME} echo "$@" local sed | ${HOME} --verbose
+	cd ${HOME} "$@" grep /usr/bin sed then --verbose -eu awk then 'quoted text'
+	-eu local x=1 cd local | --verbose done 2>/dev/null
+readonly $(pwd) echo printf && grep awk cd | ${HOME} --verbose
+		cd then export done && "$1" && "$@" grep awk /usr/bin | 2>/dev/null test
+		&& $(pwd) /usr/bin then test "$1" -eu "$1"
+		-eu 'quoted text' done local 2>/dev/null
+	local /usr/bin echo grep 'quoted text' 2>/dev/null && printf done done
+		$(pwd) awk test echo export awk printf echo readonly 'quoted text'
+	readonly then local printf 2>/dev/null "$1" && grep then 2>/dev/null
+		grep x=1 awk "$1" awk readonly x=1 'quoted text'
+		echo x=1 printf cd ${HOME} grep -eu test
+		cd ${HOME} 'quoted text' ${HOME}
+cd && "$1" local | sed export export test --verbose
+		'quoted text' then readonly then cd -eu ${HOME} readonly | export "$@" "$1"
+	then && -eu test printf awk then printf then then export -eu ${HOME}
+local "$1" 'quoted text' ${HOME} -eu
+		--verbose ${HOME} $(pwd) x=1 readonly sed sed /usr/bin --verbose
+	awk then then --verbose -eu cd | cd
+"$@" | 'quoted text' "$1" awk && /usr/bin echo x=1 "$@" ${HOME} export
+echo && x=1 printf 'quoted text' | then local /usr/bin
+	readonly | -eu -eu printf $(pwd) grep echo --verbose sed readonly
+	-eu 'quoted text' readonly grep awk export && |
+	| --verbose done x=1 echo 'quoted text' awk grep readonly grep echo $(pwd) done
+$(pwd) sed grep | ${HOME} then ${HOME}
+	x=1 && export && local export "$1" test $(pwd)
+	test --verbose cd "$1" ${HOME} /usr/bin readonly 2>/dev/null
+	sed done | grep ${HOME} cd "$@" test "$@" export then local ${HOME} local
+	-eu test && x=1 ${HOME}
+-eu done cd awk cd then test 2>/dev/null done local local export local
+printf test export 'quoted text'
+/usr/bin x=1 awk echo | local local ${HOME} "$@" && ${HOME} local
+"$@" then echo && local "$1" then "$1" echo sed then then printf
+		--verbose printf then awk sed
+awk readonly done "$@" ${HOME} x=1 done ${HOME} --verbose 'quoted text' sed 'quoted text'
+	$(pwd) sed | -eu $(pwd) "$@"
+-eu cd ${HOME} grep /usr/bin sed $(pwd) x=1 then 2>/dev/null
+${HOME} local "$@" $(pwd) sed $(pwd) "$1" "$@" awk 2>/dev/null test
+		export -eu cd ${HOME} --verbose test 2>/dev/null x=1 local test $(pwd)
+/usr/bin awk "$1" && sed && x=1 "$1" 'quoted text' echo grep /usr/bin
+		cd | local ${HOME} cd "$1" "$1" /usr/bin export grep
+		echo 2>/dev/null sed done 'quoted text' --verbose readonly
+	2>/dev/null && /usr/bin
+		then grep readonly && | printf | then x=1 then -eu 'quoted text' $(pwd) 'quoted text'
+then cd 2>/dev/null "$@" --verbose test
+		-eu && 2>/dev/null "$@" awk $(pwd) readonly 2>/dev/null 'quoted text' grep local
+		local $(pwd) export local 'quoted text'
+	awk | export grep /usr/bin $(pwd) printf done grep 'quoted text' ${HOME}
+	--verbose then local local x=1 --verbose
+		x=1 --verbose done awk local "$1" readonly printf export readonly cd
+	done 'quoted text' awk export x=1
+readonly echo done 2>/dev/null | --verbose "$1"
+		"$1" printf cd then sed test ${HOME} -eu awk cd then done | ${HOME}
+readonly cd cd ${HOME} 'quoted text' grep readonly sed sed
+	/usr/bin 2>/dev/null cd && export ${HOME} ${HOME} $(pwd) export test export
+x=1 printf sed ${HOME} ${HOME} readonly printf awk
+		${HOME} && awk ${HOME} ${HOME} 2>/dev/null /usr/bin local && "$1" /usr/bin cd "$@"
+then cd 2>/dev/null local -eu echo
+-eu grep /usr/bin echo "$@" -eu /usr/bin local
+		-eu readonly 2>/dev/null ${HOME} grep awk echo
+	2>/dev/null awk 2>/dev/null /usr/bin 2>/dev/null x=1 $(pwd)
+	/usr/bin readonly test printf x=1 cd "$1" $(pwd) sed --verbose | x=1 x=1
+		sed echo done awk readonly ${HOME}
+		${HOME} /usr/bin cd | test $(pwd) then "$1" -eu cd
+sed printf awk printf local "$@"
+	echo "$@" local local
+		printf export test test "$1" export sed printf -eu
+done export 'quoted text' cd x=1 printf
+--verbose ${HOME} printf x=1
+	'quoted text' $(pwd) 'quoted text' printf "$1" printf -eu echo then
+test | "$@" "$1" -eu | "$1" --verbose
+	awk sed grep | readonly 2>/dev/null echo grep "$@" grep $(pwd)
+	&& && test local then $(pwd) then awk test local printf
+	-eu grep export ${HOME} awk --verbose awk grep | local 'quoted text'
+-eu "$@" $(pwd) x=1 --verbose $(pwd) cd $(pwd) echo "$@"
+echo ${HOME} echo --verbose done $(pwd) echo
+	| echo && then | test | grep
+'quoted text' cd done test "$@" printf "$@" grep 2>/dev/null
+	x=1 sed -eu then ${HOME} readonly "$1" ${HOME} 2>/dev/null
+		then /usr/bin $(pwd) echo local echo export
+	-eu grep awk printf grep test
+	grep -eu "$@" ${HOME} echo cd ${HOME} local echo $(pwd)
+		"$1" export /usr/bin done test --verbose echo then sed
+	awk /usr/bin && 2>/dev/null sed "$1" printf sed awk /usr/bin $(pwd) then echo then
+echo "$@" export -eu cd "$@" /usr/bin "$@" echo readonly | $(pwd)
+"$@" --verbose then 2>/dev/null 'quoted text' echo && done then -eu
+	sed "$1" test && --verbose printf then /usr/bin echo --verbose
+	test cd readonly then printf /usr/bin echo cd cd
+grep test ${HOME} | export cd grep -eu
+		grep x=1 "$1" sed printf --verbose 2>/dev/null done /usr/bin echo --verbose
+'quoted text' readonly awk export | echo 2>/dev/null
+| grep export x=1 test && test export local printf then
+	/usr/bin printf then echo
+	echo ${HOME} readonly "$@" /usr/bin printf -eu $(pwd) -eu
+	awk -eu export test awk "$1" && test | -eu "$@" local
+2>/dev/null x=1 ${HOME} cd awk && grep /usr/bin
+--verbose sed local echo awk then "$1" x=1 "$@" readonly
+	"$1" then awk readonly done --verbose 'quoted text' done test
+	cd grep cd ${HOME} --verbose local done
+x=1 2>/dev/null then done ${HOME} "$@" | x=1 test && grep
+		'quoted text' ${HOME} $(pwd) $(pwd) 2>/dev/null -eu
+/usr/bin cd 'quoted text' awk done readonly | cd
+2>/dev/null "$@" export $(pwd) 'quoted text' /usr/bin $(pwd) sed printf
+local "$1" $(pwd) /usr/bin "$@" --verbose
+sed grep | printf -eu readonly /usr/bin | export
+	2>/dev/null export /usr/bin 'quoted text' done awk && cd echo --verbose local
+	cd awk then | echo 2>/dev/null ${HOME}
+sed readonly readonly grep "$1" test awk ${HOME}
+		/usr/bin $(pwd) ${HOME} sed awk cd /usr/bin
+		test --verbose grep local cd /usr/bin --verbose x=1 && "$1" "$@" && "$1" sed awk
+	/usr/bin grep /usr/bin 'quoted text'
+	x=1 grep --verbose then && then 2>/dev/null
+		sed ${HOME} echo then --verbose printf "$@"
+		/usr/bin -eu done 2>/dev/null
+echo 'quoted text' $(pwd) local -eu printf export
+		/usr/bin sed test 'quoted text' ${HOME} done ${HOME} printf &&
+	grep then then sed && x=1 sed awk done | test done local 2>/dev/null
+		done "$@" sed | 2>/dev/null done awk done
+&& ${HOME} then printf then --verbose /usr/bin | "$1" "$1" local && echo --verbose
+	sed cd --verbose 2>/dev/null --verbose ${HOME} /usr/bin sed export 'quoted text'
+		"$@" sed ${HOME} printf 'quoted text' $(pwd) then then
+	-eu grep $(pwd) test printf x=1 local grep 2>/dev/null cd cd cd readonly -eu
+done cd cd cd x=1 -eu grep 'quoted text' "$@" -eu "$@" sed echo
+	export --verbose /usr/bin 2>/dev/null
+		| readonly "$1" -eu --verbose test ${HOME} readonly readonly then
+/usr/bin $(pwd) ${HOME} 2>/dev/null sed awk --verbose
+	echo echo | 'quoted text' grep test
+	done printf grep --verbose grep "$@" export x=1 sed $(pwd) done x=1 readonly 'quoted text'
+	&& local -eu then printf sed 2>/dev/null 2>/dev/null awk
+sed 2>/dev/null --verbose test cd echo awk
+		export ${HOME} -eu "$1" $(pwd) /usr/bin sed "$@" readonly then export test
+		then x=1 "$@" sed $(pwd) /usr/bin
+		'quoted text' readonly /usr/bin -eu
+		test /usr/bin $(pwd) 2>/dev/null printf grep /usr/bin
+		sed /usr/bin then echo && x=1 local ${HOME} sed -eu sed -eu
+		grep /usr/bin sed ${HOME} test ${HOME} "$1" then | "$1" grep --verbose "$@" "$1"
+		"$1" awk grep test awk printf
+local export export done 2>/dev/null grep grep awk $(pwd) local
+		export -eu echo "$@" -eu /usr/bin printf /usr/bin
+	printf $(pwd) local 2>/dev/null cd local "$@" printf 2>/dev/null
+'quoted text' awk local awk grep then then cd then
+/usr/bin awk ${HOME} sed $(pwd) test echo readonly export -eu local && grep
+	awk --verbose sed local test "$1"
+local x=1 test ${HOME} --verbose "$1"
+"$@" "$@" /usr/bin "$1" export | then done x=1 x=1 /usr/bin
+| test 2>/dev/null x=1 "$@" "$1"
+	x=1 'quoted text' awk grep | cd 2>/dev/null
+$(pwd) grep sed && | export $(pwd) && "$1" x=1 "$1" $(pwd)
+		-eu $(pwd) x=1 sed x=1 awk $(pwd) cd
+	2>/dev/null test sed -eu export cd cd echo test -eu 'quoted text' sed
+"$1" --verbose readonly x=1 awk x=1 ${HOME} cd then test export export
+test "$1" "$1" export done export printf sed then && test --verbose
+readonly 'quoted text' printf readonly x=1 cd -eu "$1" export x=1 -eu -eu
+then readonly awk then | done echo 'quoted text'
+${HOME} | awk $(pwd) | 'quoted text' && /usr/bin export ${HOME} echo export done
+	/usr/bin grep then ${HOME} export && printf --verbose echo printf
+	x=1 2>/dev/null done export 2>/dev/null 'quoted text' export test
+awk $(pwd) sed | ${HOME} test echo awk cd then && /usr/bin
+		done -eu local -eu done /usr/bin
+		local 2>/dev/null echo $(pwd) test
+		test done ${HOME} grep x=1 -eu grep done /usr/bin
+grep echo then ${HOME} "$1" && readonly export then $(pwd)
+	export | awk printf readonly -eu
+grep export -eu --verbose echo
+		done readonly x=1 -eu "$1" sed 2>/dev/null readonly readonly test /usr/bin done
+		then && /usr/bin $(pwd) echo $(pwd)
+then --verbose grep grep $(pwd) export | cd then | then
+		$(pwd) 2>/dev/null -eu then
+'quoted text' -eu | /usr/bin -eu | $(pwd) grep grep local
+		2>/dev/null /usr/bin && then export "$1" grep ${HOME} then echo --verbose test
+	cd 2>/dev/null test done ${HOME} sed grep then $(pwd)
+printf $(pwd) --verbose x=1 | local | sed grep export $(pwd) grep awk
+printf -eu x=1 2>/dev/null -eu --verbose done done readonly echo -eu
+		printf then --verbose printf && ${HOME} "$1"
+		${HOME} 'quoted text' awk 2>/dev/null then "$1" then
+	"$@" "$1" 'quoted text' --verbose cd done
+		2>/dev/null awk then x=1 cd cd
+	readonly x=1 awk local done ${HOME} readonly --verbose awk done sed
+		-eu done --verbose /usr/bin
+readonly && 2>/dev/null then 'quoted text'
+then 2>/dev/null 2>/dev/null grep "$1" grep grep grep then printf then -eu
+		'quoted text' 'quoted text' x=1 x=1 && | ${HOME} 'quoted text' test
+	echo x=1 sed x=1 "$@" 'quoted text' grep done /usr/bin "$1" local grep echo local
+		local printf readonly test
+/usr/bin grep readonly test
+		2>/dev/null export && /usr/bin local "$1" awk 'quoted text' awk
+printf $(pwd) && "$1" -eu awk test awk x=1 test && cd "$1" printf grep
+	local echo 2>/dev/null grep "$1" grep --verbose cd 2>/dev/null --verbose x=1
+		done grep x=1 sed "$1" 'quoted text' ${HOME}
+&& then 2>/dev/null --verbose local | 'quoted text' 'quoted text' done
+grep test -eu -eu cd 2>/dev/null
+		readonly printf x=1 /usr/bin "$1" readonly awk "$1" sed /usr/bin x=1 'quoted text'
+	&& then readonly x=1 cd /usr/bin echo /usr/bin $(pwd) 2>/dev/null awk
+		export "$1" "$@" sed "$1" | awk then printf
+		$(pwd) | echo | cd printf local
+	export test && export $(pwd) sed then echo printf export -eu && printf
+	/usr/bin /usr/bin x=1 'quoted text' printf "$1"
+readonly ${HOME} --verbose "$@" done 'quoted text'
+		${HOME} -eu awk local test
+		readonly echo cd printf echo && test ${HOME} $(pwd) --verbose sed x=1
+--verbose -eu "$@" readonly local grep && $(pwd) --verbose
+		"$1" && done ${HOME} /usr/bin readonly 'quoted text' export | | then printf
+		sed done export -eu awk -eu "$1" --verbose test readonly
+		$(pwd) awk readonly $(pwd) "$@" grep 'quoted text' ${HOME} "$@" test "$@"
+		2>/dev/null -eu done 2>/dev/null echo --verbose $(pwd) printf ${HOME} ${HOME}
+		local export export test readonly grep
+	"$@" readonly "$1" 'quoted text' && /usr/bin readonly
+	awk export test x=1 done 'quoted text'
+echo $(pwd) x=1 awk cd sed
+then /usr/bin "$1" awk ${HOME} echo done $(pwd) 'quoted text' echo |
+		2>/dev/null -eu done echo readonly export readonly -eu -eu then cd x=1 "$1" "$@"
+readonly x=1 | printf $(pwd) x=1 | sed
+	/usr/bin -eu test export sed ${HOME} printf echo sed echo
+done && $(pwd) readonly echo --verbose "$@"
+		local export printf export done test
+	printf readonly ${HOME} $(pwd) 'quoted text' "$@" then local | printf grep | done
+		sed "$1" 2>/dev/null readonly local readonly sed sed local && then
+		2>/dev/null sed cd ${HOME} 2>/dev/null $(pwd) $(pwd) done sed "$1" then -eu
+	&& done cd /usr/bin readonly local then 2>/dev/null
+2>/dev/null --verbose done $(pwd) local -eu -eu 2>/dev/null
+	then test echo x=1 awk -eu echo test local $(pwd)
+		readonly awk test $(pwd) -eu test then cd done 2>/dev/null &&
+		x=1 && x=1 sed echo && --verbose -eu /usr/bin local ${HOME} local
+		"$@" "$@" 'quoted text' "$@" "$@" "$@"
+	&& 'quoted text' done /usr/bin sed 'quoted text' /usr/bin awk --verbose --verbose
+		local --verbose && -eu ${HOME} "$@" 2>/dev/null
+		2>/dev/null echo readonly sed -eu | then && 'quoted text'
+		printf && export printf /usr/bin -eu 2>/dev/null "$1"
+readonly readonly awk awk ${HOME} done 2>/dev/null "$@"
+	'quoted text' $(pwd) "$@" -eu 'quoted text' local cd test 2>/dev/null
+	&& printf cd sed test export /usr/bin sed && readonly export | printf
+		test /usr/bin readonly && -eu awk done
+		test export then echo "$1"
+done echo x=1 printf "$1" then local sed done "$@" printf local ${HOME}
+export cd printf "$1" $(pwd) | | && test && ${HOME}
+		sed readonly printf "$1" done 2>/dev/null
+		"$1" ${HOME} 2>/dev/null grep && $(pwd) | grep 2>/dev/null then test local
+&& "$@" done grep "$1"
+awk grep export sed done /usr/bin grep grep
+		sed x=1 'quoted text' "$1" "$@" then echo then echo | --verbose
+		2>/dev/null 2>/dev/null export -eu --verbose x=1 sed cd | then printf
+&& echo /usr/bin && && /usr/bin test "$1" && --verbose | --verbose
+--verbose 2>/dev/null export local done 2>/dev/null && --verbose --verbose
+local cd --verbose echo
+	printf then /usr/bin sed test then printf ${HOME} "$@" then sed "$1"
+		grep /usr/bin && local ${HOME} export 'quoted text'
+grep readonly awk export echo "$1" "$@" done
+	-eu x=1 echo then done &&
+		"$@" --verbose x=1 done $(pwd)
+sed /usr/bin x=1 printf sed -eu /usr/bin
+		test "$@" local awk 2>/dev/null then ${HOME} ${HOME}
+		echo "$1" printf readonly export printf -eu test $(pwd) sed 2>/dev/null
+	local --verbose /usr/bin 2>/dev/null local grep --verbose echo
+	echo printf printf --verbose
+		2>/dev/null 2>/dev/null "$@" echo 'quoted text' readonly
+		readonly done then sed done /usr/bin $(pwd) grep
+		awk x=1 'quoted text' /usr/bin && grep "$@" ${HOME} export "$@" echo ${HOME} then
+		"$@" x=1 /usr/bin then && --verbose sed $(pwd) | $(pwd)
+'quoted text' printf --verbose export cd && export $(pwd) grep echo
+	cd 'quoted text' $(pwd)
+| grep local ${HOME} done | /usr/bin printf cd done grep "$1" -eu awk x=1
+		-eu "$1" -eu echo "$1" /usr/bin $(pwd) | --verbose 2>/dev/null
+		awk && /usr/bin $(pwd) "$1" "$@"
+	done echo local cd done done local
+grep sed export export --verbose
+	&& awk awk /usr/bin "$1" --verbose ${HOME} local x=1 x=1 --verbose echo
+export then "$@" sed done cd echo 'quoted text'
+	&& --verbose then "$@" /usr/bin /usr/bin test $(pwd) export && cd local --verbose
+		done x=1 "$@" test grep x=1 --verbose "$@" readonly 2>/dev/null "$1" grep
+	"$@" && printf x=1 echo $(pwd) "$1"
+-eu 2>/dev/null sed then /usr/bin
+		-eu export 2>/dev/null | readonly x=1 echo
+	"$@" && 'quoted text' export export cd
+	then "$1" /usr/bin --verbose echo
+		&& "$@" echo local test grep sed awk && sed local "$1" 'quoted text' grep |
+	$(pwd) ${HOME} echo awk readonly x=1 printf
+awk 'quoted text' readonly
+		/usr/bin then local test -eu readonly readonly | |
+--verbose -eu sed cd /usr/bin sed grep --verbose ${HOME} readonly grep 'quoted text'
+		$(pwd) 2>/dev/null 'quoted text' grep "$@" awk --verbose ${HOME} "$@" --verbose
+| /usr/bin sed echo echo $(pwd) sed 2>/dev/null sed sed local printf printf --verbose
+	| 'quoted text' then 2>/dev/null && "$1" 'quoted text'
+sed test "$@" "$1" then printf 'quoted text'
+"$1" echo "$1" "$@" ${HOME} echo
+export "$@" -eu done echo "$@"
+		sed "$@" echo then test grep then test local /usr/bin grep
+		cd --verbose && x=1 done --verbose local test grep then echo
+		"$1" /usr/bin x=1 echo $(pwd) "$1" x=1 local sed
+		grep readonly ${HOME} awk grep readonly -eu x=1 grep readonly
+export 2>/dev/null | "$1" local test echo
+		local 2>/dev/null -eu && export done x=1 $(pwd) --verbose
+	-eu test 2>/dev/null -eu readonly --verbose 2>/dev/null
+		sed export 'quoted text'
+printf then readonly grep ${HOME} done
+echo ${HOME} cd $(pwd) then
+&& "$@" local grep /usr/bin cd 'quoted text'
+	done echo cd then cd --verbose cd echo cd 2>/dev/null /usr/bin && |
+	"$@" local 'quoted text' grep && grep /usr/bin "$@" awk
+	readonly test 2>/dev/null 'quoted text'
+	-eu "$1" done then done "$@" done export
+	'quoted text' "$1" test ${HOME} $(pwd) done 'quoted text' | sed
+	${HOME} && printf readonly sed sed echo x=1 sed readonly
+cd readonly printf ${HOME} cd test test && 2>/dev/null -eu ${HOME} printf
+		| x=1 x=1 "$@" /usr/bin done x=1 ${HOME} printf 'quoted text'
+		x=1 'quoted text' then --verbose
+/usr/bin /usr/bin done awk --verbose printf "$@"
+		done local x=1 /usr/bin grep "$1"
+| awk cd local /usr/bin test | x=1 printf x=1 'quoted text'
+	$(pwd) export test grep 2>/dev/null 2>/dev/null 2>/dev/null
+	echo | 'quoted text' --verbose local "$1" && local sed grep done done
+		echo x=1 export readonly awk "$1"
+sed | $(pwd) sed 2>/dev/null
+	/usr/bin "$@" grep sed sed "$1"
+readonly ${HOME} cd "$1" -eu sed 2>/dev/null echo && sed "$@" sed && --verbose
+		$(pwd) 2>/dev/null --verbose
+	"$1" printf echo 'quoted text' local
+awk sed sed printf sed echo 2>/dev/null x=1
+		${HOME} $(pwd) sed test cd x=1 then $(pwd) done -eu test 'quoted text'
+local "$1" 2>/dev/null 'quoted text'
+	readonly sed test --verbose test readonly
+	'quoted text' echo 'quoted text'
+	2>/dev/null ${HOME} --verbose echo then 2>/dev/null 2>/dev/null
+	-eu 2>/dev/null readonly | echo 2>/dev/null -eu | sed "$1" 2>/dev/null
+		| -eu ${HOME} ${HOME} /usr/bin | | /usr/bin "$@" sed && $(pwd)
+test -eu export x=1 ${HOME} ${HOME} readonly
+"$@" --verbose cd echo local | then --verbose -eu && && echo awk readonly x=1
+	readonly ${HOME} export $(pwd) awk grep printf printf echo local sed
+echo awk then printf sed "$1"
+printf /usr/bin grep 2>/dev/null "$@" "$@" $(pwd) 'quoted text' 2>/dev/null | readonly
+	x=1 readonly x=1 $(pwd) cd "$1" 'quoted text' "$@" /usr/bin local then
+		'quoted text' x=1 test echo grep sed 2>/dev/null export
+$(pwd) echo then test local readonly "$1" local "$@" grep 2>/dev/null cd
+	test "$@" then done --verbose /usr/bin
+test 2>/dev/null readonly done && -eu | "$@"
+	'quoted text' "$@" grep export ${HOME} export printf readonly 2>/dev/null &&
+-eu /usr/bin ${HOME} awk && awk printf
+	export && -eu ${HOME} sed && awk printf
+&& --verbose sed | --verbose && test printf 'quoted text'
+local x=1 'quoted text' test && x=1 "$1"
+		/usr/bin cd 2>/dev/null "$1" then grep grep "$@" then done sed cd ${HOME}
+	local done 2>/dev/null then -eu x=1 readonly awk
+printf done ${HOME} grep | 2>/dev/null
+	--verbose && sed test then --verbose 'quoted text' /usr/bin
+	echo 2>/dev/null done cd done -eu 'quoted text' "$@"
+		$(pwd) 2>/dev/null x=1 printf echo cd printf export export
+readonly readonly printf ${HOME} && then test echo export $(pwd) awk grep awk
+local --verbose grep 'quoted text'
+	/usr/bin && then "$1" 'quoted text' 'quoted text'
+	"$1" ${HOME} then 'quoted text' x=1 printf
+		| grep 'quoted text' 2>/dev/null awk 'quoted text'
+		cd echo -eu sed $(pwd) | awk done x=1 done 2>/dev/null
+	cd ${HOME} 2>/dev/null && readonly printf done then 'quoted text' | test
+--verbose x=1 test x=1 grep then cd -eu cd | x=1 then cd printf
+	cd | done echo printf
+	${HOME} echo cd && local "$@" awk | readonly ${HOME} --verbose ${HOME} 2>/dev/null
+sed $(pwd) then --verbose --verbose cd export done sed sed readonly -eu readonly
+local | printf readonly
+export cd -eu printf "$@" "$1" && awk
+	x=1 printf sed | readonly done sed test test done
+		-eu -eu && | test $(pwd) test ${HOME} --verbose cd test then printf
+		export cd -eu | test readonly ${HOME} "$@" local awk
+		"$@" local /usr/bin sed && /usr/bin echo /usr/bin /usr/bin
+awk x=1 then grep printf local 2>/dev/null -eu
+'quoted text' export && "$@" $(pwd) 'quoted text' then cd readonly
+	--verbose $(pwd) grep local
+'quoted text' 2>/dev/null | done 'quoted text'
+2>/dev/null x=1 "$1" --verbose awk && then "$1" /usr/bin 'quoted text'
+	--verbose export "$@" test && sed /usr/bin awk 2>/dev/null readonly export x=1
+		printf test && then cd && local test 2>/dev/null test local --verbose -eu "$@" x=1
+		"$1" /usr/bin | cd sed awk -eu "$1"
+--verbose | awk /usr/bin /usr/bin echo then awk "$@" echo "$@" then ${HOME}
+	export ${HOME} sed done sed test $(pwd) then readonly grep ${HOME} grep sed echo
+	test /usr/bin echo "$@" test readonly readonly done ${HOME} --verbose ${HOME} export
+	done --verbose then grep 2>/dev/null
+	cd printf && sed then local sed "$@" x=1 /usr/bin
+		"$@" test sed echo grep
+	&& 'quoted text' ${HOME} export
+	$(pwd) echo cd "$@" sed cd -eu | done
+		x=1 ${HOME} echo "$1" sed awk awk done grep echo local sed
+sed grep "$1" "$1" | "$1" 'quoted text' sed done printf grep
+	--verbose sed awk awk 2>/dev/null
+		test echo grep "$@" && grep "$@" readonly
+		'quoted text' "$@" ${HOME} -eu 2>/dev/null
+export && $(pwd) 'quoted text' then then ${HOME}
+		printf --verbose done && "$1"
+		awk $(pwd) --verbose && readonly echo -eu test
+| ${HOME} "$@" grep "$1" test x=1 readonly && --verbose -eu 2>/dev/null then done
+	sed local ${HOME} echo --verbose x=1 awk printf $(pwd) sed ${HOME} $(pwd) readonly
+		"$1" printf x=1 export sed cd grep x=1 local ${HOME} && test $(pwd)
+2>/dev/null "$@" --verbose test 'quoted text'
+		| 'quoted text' ${HOME} && done && grep
+		test grep 'quoted text' --verbose grep -eu then ${HOME} | ${HOME} printf export
+		sed cd "$1" "$@" export printf -eu $(pwd) $(pwd)
+		readonly --verbose awk --verbose then sed
+--verbose 'quoted text' sed /usr/bin echo
+	done then done ${HOME} --verbose 'quoted text' "$@" printf x=1 --verbose
+	printf 'quoted text' readonly then readonly export $(pwd)
+readonly grep readonly then done x=1 echo export cd readonly -eu echo -eu |
+		--verbose then "$1" 2>/dev/null --verbose readonly cd test
+		$(pwd) export printf && | test sed done local
+	"$@" done grep ${HOME} then done then printf grep "$@" && x=1 && 2>/dev/null
+		| cd readonly cd "$1" "$@" readonly local grep "$1" echo
+		awk echo "$1" local export --verbose
+	/usr/bin cd && "$1" local
+'quoted text' ${HOME} export done sed grep
+	printf x=1 cd x=1 "$@" export 'quoted text' echo "$1" /usr/bin test x=1 'quoted text'
+		&& readonly x=1 done cd local -eu awk cd
+test then awk readonly cd 'quoted text' readonly cd -eu cd "$1" awk 2>/dev/null
+cd cd 2>/dev/null export test local 'quoted text'
+		grep -eu readonly /usr/bin --verbose then x=1 then done sed $(pwd)
+"$1" printf awk sed echo x=1 && awk cd sed
+test export | export echo "$1"
+	export x=1 printf sed 'quoted text' 2>/dev/null sed "$@" then "$@"
+		cd 2>/dev/null cd awk && echo readonly printf --verbose grep 2>/dev/null
+	$(pwd) | local cd grep cd 'quoted text' x=1 grep /usr/bin --verbose
+	2>/dev/null $(pwd) cd "$1" grep $(pwd) grep
+	2>/dev/null cd x=1 -eu cd -eu awk test /usr/bin export
+	-eu test && readonly 'quoted text' export cd 2>/dev/null export export &&
+		sed cd $(pwd) "$@" awk
+done test 2>/dev/null then 2>/dev/null -eu local $(pwd) /usr/bin
+		readonly 'quoted text' test ${HOME} ${HOME}
+		then --verbose -eu then 'quoted text' grep "$1" $(pwd) "$1" awk test export readonly
+	&& /usr/bin then echo cd awk /usr/bin readonly test
+		sed grep printf local cd /usr/bin -eu local printf sed | test -eu
+"$@" sed /usr/bin "$@" 2>/dev/null ${HOME} ${HOME} | "$@" test awk
+	cd grep --verbose cd cd --verbose "$@" $(pwd) "$1" | test /usr/bin
+local then export "$1" readonly cd printf done printf cd
+		sed grep done readonly ${HOME} test done cd
+	'quoted text' then echo then ${HOME} 'quoted text' --verbose && /usr/bin
+${HOME} echo then $(pwd) -eu awk /usr/bin
+"$1" 2>/dev/null printf $(pwd) test | 2>/dev/null --verbose export
+	x=1 awk ${HOME} -eu local 'quoted text' "$1" ${HOME}
+--verbose readonly $(pwd) -eu /usr/bin $(pwd) export grep test
+	/usr/bin echo printf && | ${HOME} $(pwd) test --verbose
+		"$1" $(pwd) | 'quoted text' --verbose 2>/dev/null then "$1"
+	'quoted text' done 2>/dev/null /usr/bin sed ${HOME} 2>/dev/null x=1 then cd readonly
+		export grep $(pwd) | export done && --verbose readonly 2>/dev/null
+done /usr/bin done "$@" echo cd "$@" local readonly
+	test printf export echo "$@" then printf 2>/dev/null export echo "$1" sed awk printf
+		grep cd x=1 && echo x=1 printf export echo "$1" --verbose 2>/dev/null "$@"
+"$@" "$1" -eu ${HOME} export ${HOME} export --verbose ${HOME}
+'quoted text' awk "$@" | /usr/bin | done -eu "$@" ${HOME}
+	2>/dev/null readonly -eu grep done $(pwd) x=1 -eu done readonly x=1 -eu
+/usr/bin echo done && done 2>/dev/null test awk "$@" /usr/bin export sed "$@"
+		x=1 2>/dev/null grep echo sed ${HOME} &&
+--verbose awk export ${HOME} --verbose
+	readonly --verbose awk awk awk local 'quoted text' -eu readonly ${HOME}
+'quoted text' /usr/bin test
+	printf -eu export "$1" local local cd test test "$1" local test
+awk x=1 local local printf echo -eu echo -eu ${HOME} done cd "$1" | awk 2>/dev/null
+printf $(pwd) test grep | echo "$@" printf
+		/usr/bin 'quoted text' "$@" && x=1 "$@" then test "$1" grep
+	'quoted text' echo cd --verbose
+x=1 cd 'quoted text' /usr/bin local grep echo
+	--verbose cd echo ${HOME} grep local awk
+		"$@" /usr/bin test | "$1" grep /usr/bin sed sed $(pwd) printf 2>/dev/null &&
+		| $(pwd) x=1 echo awk then sed grep
+echo done readonly then awk done sed cd --verbose | && sed local "$@" echo --verbose
+| printf $(pwd) cd then export grep readonly sed
+	echo /usr/bin test 2>/dev/null x=1 $(pwd) then echo && -eu ${HOME} printf /usr/bin
+	&& grep grep ${HOME} test test
+&& 'quoted text' done 2>/dev/null
+${HOME} /usr/bin --verbose | && && echo ${HOME} local x=1 readonly
+$(pwd) "$@" ${HOME} -eu echo local readonly
+		awk then then ${HOME} echo printf --verbose 2>/dev/null local /usr/bin
+printf x=1 printf "$1" ${HOME} 2>/dev/null sed &&
+	sed awk local "$@" cd printf then grep && "$@" printf | echo 'quoted text'
+	x=1 export cd 'quoted text' 'quoted text' /usr/bin echo x=1 cd export export
+		test grep | readonly /usr/bin then test | sed awk /usr/bin --verbose
+	/usr/bin then then grep $(pwd) local | readonly done 2>/dev/null export 2>/dev/null
+		x=1 --verbose local cd cd /usr/bin
+-eu /usr/bin grep readonly "$@" local then /usr/bin
+		&& local local && cd && "$@" 2>/dev/null done $(pwd) local x=1 test x=1 "$@"
+	awk echo "$1" done sed /usr/bin && cd 2>/dev/null 2>/dev/null
+export x=1 --verbose /usr/bin 2>/dev/null export $(pwd) cd
+cd 2>/dev/null then ${HOME}
+		2>/dev/null test local -eu | -eu | 'quoted text'
+		local echo | "$1" --verbose grep 2>/dev/null && $(pwd) | export $(pwd) awk -eu /usr/bin
+		&& sed 'quoted text' echo ${HOME}
+"$@" done 'quoted text' grep 'quoted text' export
+	grep -eu x=1 /usr/bin printf "$1" printf && && test cd "$@" test ${HOME}
+		/usr/bin printf then $(pwd) readonly
+		"$@" export cd grep 2>/dev/null
+	test done /usr/bin cd grep 2>/dev/null printf ${HOME}
+$(pwd) 2>/dev/null "$1" printf ${HOME} -eu local printf
+		grep -eu then local sed ${HOME}
+	-eu ${HOME} x=1 export local --verbose && x=1 | | 2>/dev/null awk cd export
+2>/dev/null && "$@" export && echo |
+	local "$@" printf export done | | 'quoted text' test $(pwd) local local
+		export done "$1" awk "$@" printf | 2>/dev/null
+readonly local sed readonly
+		printf then sed grep readonly -eu sed 'quoted text'
+awk printf "$@" x=1 "$@" local 'quoted text' -eu printf grep
+		--verbose grep local "$@" ${HOME} readonly "$@" 'quoted text'
+/usr/bin $(pwd) && 'quoted text' --verbose "$@" x=1 "$@"
+	"$1" "$@" grep sed x=1 cd && export | sed $(pwd) -eu local test "$1" /usr/bin
+	2>/dev/null awk && sed readonly local
+		test "$@" echo --verbose cd
+		grep x=1 && printf done printf printf "$@" $(pwd) test ${HOME}
+		x=1 && local readonly "$1" cd test sed local $(pwd) /usr/bin
+		-eu local cd done local x=1 done awk then /usr/bin
+		"$@" done && test printf readonly test cd done 2>/dev/null x=1 test $(pwd)
+then grep $(pwd) "$@" export done 'quoted text' local 'quoted text' test 'quoted text'
+readonly x=1 && -eu echo
+x=1 export test awk grep sed
+	printf "$@" readonly && echo done awk -eu -eu sed | $(pwd) done awk echo cd grep
+	then 'quoted text' 'quoted text' awk $(pwd) | /usr/bin $(pwd)
+	done then x=1 sed local
+		/usr/bin sed "$@" 'quoted text' echo awk -eu 2>/dev/null
+	&& && cd local "$@" test cd -eu --verbose readonly sed
+readonly x=1 printf --verbose "$1" 'quoted text' export "$1"
+${HOME} ${HOME} export sed /usr/bin test
+	--verbose -eu /usr/bin local grep "$1" done | $(pwd) && x=1 -eu
+/usr/bin readonly 'quoted text' readonly 2>/dev/null | -eu --verbose echo "$1"
+		&& -eu done "$1" x=1 cd $(pwd) done echo readonly
+/usr/bin && "$@" -eu test
@@ -0,0 +1,2001 @@
+	x=1 cd "$1" && 2>/dev/null "$1" awk ${HOME} -eu x=1 grep awk
+		--verbose cd --verbose 'quoted text' printf export
+'quoted text' x=1 export 2>/dev/null 2>/dev/null cd "$@" --verbose echo $(pwd)
+'quoted text' -eu printf
+	"$@" readonly local cd "$@" | /usr/bin "$1" echo "$@" then
+	x=1 'quoted text' | 'quoted text' /usr/bin grep
+--verbose export printf | 2>/dev/null
+	$(pwd) done export export sed done --verbose grep awk --verbose "$1" && local
+		local awk printf /usr/bin local "$1" then | grep -eu
+	echo --verbose done then "$@" "$1" "$1" --verbose
+		x=1 done sed sed awk readonly done x=1 export echo then "$1" cd grep
+		/usr/bin $(pwd) x=1 --verbose 2>/dev/null echo local | ${HOME} grep awk
+| 2>/dev/null export sed then
+		'quoted text' 2>/dev/null $(pwd)
+	then awk export $(pwd) $(pwd) printf 2>/dev/null then echo
+| grep sed $(pwd) grep x=1 $(pwd) cd "$@" test echo 'quoted text'
+sed "$@" | grep -eu -eu 2>/dev/null --verbose readonly
+		--verbose "$1" "$@" readonly sed
+--verbose --verbose done x=1 && && export && cd local
+		'quoted text' printf "$@" && local sed "$1" awk
+2>/dev/null ${HOME} ${HOME} printf grep /usr/bin
+	awk | test "$@" grep 'quoted text'
+	/usr/bin $(pwd) cd sed cd test then awk x=1 ${HOME} /usr/bin 2>/dev/null then
+		"$1" 2>/dev/null grep then "$@" $(pwd) 'quoted text'
+| /usr/bin done readonly readonly
+	--verbose done awk echo 2>/dev/null readonly
+	test echo then echo "$@"
+	$(pwd) then cd local sed --verbose
+		&& grep "$1" export printf --verbose | cd echo done
+		echo grep 'quoted text'
+	echo export export "$@" "$1" sed 2>/dev/null echo ${HOME} |
+		"$1" "$1" $(pwd) then cd readonly test local export cd | 2>/dev/null
+readonly --verbose cd x=1 local 2>/dev/null
+		$(pwd) "$@" then 'quoted text' | && ${HOME} "$1" 'quoted text' $(pwd)
+		local /usr/bin x=1 test export echo export && cd /usr/bin /usr/bin awk sed
+	sed readonly test --verbose
+${HOME} sed && 'quoted text' -eu -eu
+		'quoted text' done done printf echo /usr/bin $(pwd) $(pwd) then echo && readonly
+grep sed x=1 test "$@" printf awk sed 'quoted text'
+sed 'quoted text' ${HOME} ${HOME} "$1" then 2>/dev/null | sed awk --verbose
+sed 2>/dev/null cd test && "$1" export ${HOME}
+		| | | /usr/bin $(pwd) $(pwd) test
+		readonly -eu sed grep cd cd | local /usr/bin /usr/bin $(pwd) local local "$@" |
+	/usr/bin /usr/bin local && ${HOME} done grep --verbose
+local readonly ${HOME} readonly local
+		x=1 export $(pwd) 'quoted text' readonly | "$@" grep cd /usr/bin
+	done echo $(pwd) printf x=1 local echo /usr/bin
+&& echo grep readonly echo
+	/usr/bin x=1 "$1" sed grep done
+		'quoted text' done /usr/bin printf echo && sed /usr/bin "$1" export
+		${HOME} done sed --verbose -eu | sed readonly awk "$1" x=1 awk
+	"$@" local 2>/dev/null readonly 2>/dev/null --verbose awk echo local
+${HOME} "$@" grep && done grep 2>/dev/null test && done "$1"
+$(pwd) x=1 done $(pwd) x=1 printf printf ${HOME} && x=1 ${HOME}
+-eu ${HOME} "$@" -eu cd $(pwd) awk $(pwd) done export "$1"
+'quoted text' && --verbose
+x=1 local grep "$1" printf ${HOME} x=1 done export "$1" 2>/dev/null
+		awk sed | --verbose 'quoted text' done x=1 x=1 "$@" echo ${HOME} test -eu
+	awk awk --verbose ${HOME} readonly grep /usr/bin sed sed then test cd test
+&& /usr/bin local printf printf | cd x=1 printf local sed then &&
+${HOME} local local awk local awk 2>/dev/null sed -eu -eu ${HOME} printf echo
+	"$@" sed $(pwd) "$1" x=1 "$@" local | $(pwd) /usr/bin
+export $(pwd) printf 2>/dev/null && then printf sed done "$1" /usr/bin local
+'quoted text' grep export local
+		/usr/bin printf local local
+		test "$1" 2>/dev/null && readonly done -eu 2>/dev/null
+awk done grep echo -eu done 'quoted text' $(pwd) $(pwd) ${HOME} printf
+		/usr/bin cd && then ${HOME} awk export
+test ${HOME} "$1" done echo grep done readonly /usr/bin
+x=1 export local then /usr/bin cd ${HOME} done --verbose echo
+		x=1 local cd x=1 echo readonly
+	test x=1 -eu $(pwd) $(pwd) --verbose $(pwd) then /usr/bin "$@" $(pwd)
+		"$@" -eu export done done && -eu "$@" ${HOME} sed grep awk $(pwd) local sed
+"$@" "$@" x=1 && done then readonly -eu x=1 sed | 'quoted text'
+	awk $(pwd) "$1" | | done awk sed 2>/dev/null sed awk &&
+		test $(pwd) x=1 sed grep x=1 then export
+'quoted text' done readonly && /usr/bin awk ${HOME}
+printf printf cd local ${HOME} ${HOME} --verbose
+	printf printf 2>/dev/null awk export x=1 done "$1" -eu -eu cd readonly
+$(pwd) "$1" then grep && 'quoted text' "$@"
+printf then export cd -eu x=1 $(pwd) sed sed /usr/bin ${HOME}
+	"$1" export -eu $(pwd) /usr/bin $(pwd) export --verbose done "$1"
+	$(pwd) "$@" awk done then then then 'quoted text' $(pwd) test x=1 local $(pwd) x=1
+	$(pwd) cd -eu readonly grep
+		/usr/bin readonly cd x=1 done done cd cd grep awk "$1" $(pwd) sed "$1" | cd
+		"$@" awk grep then awk /usr/bin done done -eu "$@" x=1 -eu export
+		echo echo done 'quoted text' | then "$@" /usr/bin
+${HOME} awk "$1" then readonly &&
+	export 'quoted text' 2>/dev/null test readonly awk echo awk
+	grep "$1" printf $(pwd) $(pwd) sed 2>/dev/null "$1"
+	sed && x=1 echo grep x=1 awk --verbose readonly local ${HOME} 'quoted text'
+export grep then cd x=1 readonly /usr/bin echo 'quoted text'
+	"$@" readonly | $(pwd) | echo awk -eu
+	sed ${HOME} done ${HOME} printf sed export local export x=1 then "$1"
+	| done "$@" grep | awk | then
+		cd then readonly x=1 --verbose $(pwd) $(pwd) export 2>/dev/null export local
+printf readonly /usr/bin sed $(pwd) "$1" | then echo | 2>/dev/null
+	readonly | "$@" x=1 ${HOME} "$@" done 'quoted text' --verbose x=1 -eu awk
+		${HOME} grep -eu done export then awk &&
+	sed export x=1 cd sed
+		echo ${HOME} 2>/dev/null "$1" local then awk echo "$@" readonly grep
+awk readonly echo readonly $(pwd) "$1" x=1 then "$@"
+$(pwd) test 'quoted text' --verbose /usr/bin $(pwd) echo | 'quoted text'
+		'quoted text' "$@" export "$1" x=1 | 'quoted text' "$@" sed
+grep "$@" then "$1" --verbose
+		'quoted text' 'quoted text' /usr/bin grep "$1" $(pwd)
+	'quoted text' 2>/dev/null export
+	local printf "$@" | then sed
+		${HOME} sed then --verbose
+		$(pwd) 'quoted text' grep
+	echo $(pwd) done ${HOME} 2>/dev/null "$@" done grep /usr/bin
+"$@" && x=1 -eu "$1"
+	x=1 printf 2>/dev/null "$@" "$1" awk cd
+		echo echo export x=1 export | export done test | x=1 grep grep printf done ${HOME}
+		test x=1 "$@" /usr/bin echo /usr/bin 'quoted text'
+/usr/bin "$@" local x=1 grep $(pwd) "$1" 'quoted text'
+	echo echo /usr/bin ${HOME} readonly printf | then /usr/bin then grep && printf
+| ${HOME} -eu ${HOME} $(pwd) x=1 done
+		$(pwd) --verbose | x=1 /usr/bin sed "$@" 2>/dev/null ${HOME} 'quoted text'
+grep | cd x=1 /usr/bin readonly sed done 2>/dev/null
+"$1" cd local "$1" readonly
+		"$@" | && then "$1" awk 2>/dev/null "$@" /usr/bin
+	awk 'quoted text' test /usr/bin $(pwd) readonly test --verbose "$@" grep
+		--verbose $(pwd) cd local awk grep --verbose
+		grep test done --verbose export echo sed $(pwd) $(pwd) awk --verbose
+${HOME} grep readonly /usr/bin --verbose done
+printf x=1 local grep $(pwd) grep "$@" local
+then $(pwd) --verbose local printf -eu
+	x=1 $(pwd) ${HOME} "$@" "$@" awk $(pwd) cd "$@" /usr/bin
+grep readonly "$1" "$1" ${HOME} awk
+cd && local 2>/dev/null $(pwd) test cd awk export && 'quoted text' "$1" $(pwd)
+	test printf cd /usr/bin 'quoted text' 2>/dev/null --verbose
+	sed --verbose 'quoted text' -eu $(pwd) sed then | echo done grep ${HOME} x=1
+| | --verbose $(pwd) "$@" /usr/bin done --verbose
+		readonly && $(pwd) ${HOME} && echo grep grep 'quoted text' cd 2>/dev/null |
+		sed export 'quoted text' x=1
+		$(pwd) "$@" sed readonly
+local x=1 "$1" echo --verbose 2>/dev/null && sed | /usr/bin 'quoted text'
+done /usr/bin x=1 "$@" | test then "$@" && sed sed --verbose /usr/bin
+	printf test test --verbose | $(pwd) -eu echo done sed done && sed | grep
+local echo x=1 then ${HOME} --verbose && printf
+	"$1" $(pwd) $(pwd) cd 'quoted text' export
+	local && export | printf grep printf grep then $(pwd)
+--verbose 2>/dev/null cd 2>/dev/null grep awk grep echo
+		/usr/bin "$1" export "$@" sed 2>/dev/null
+	2>/dev/null then export 'quoted text' 'quoted text' 'quoted text' export 2>/dev/null
+local ${HOME} test x=1 2>/dev/null x=1 printf "$@" local /usr/bin export
+	export 2>/dev/null "$1" echo 2>/dev/null "$1" echo test readonly && ${HOME} x=1
+	then grep | -eu --verbose grep echo then && | then
+	${HOME} awk readonly 'quoted text'
+"$1" -eu x=1 && grep --verbose sed 2>/dev/null echo local x=1 "$@" x=1 -eu sed
+readonly grep printf cd then readonly /usr/bin 'quoted text' x=1
+x=1 x=1 awk cd awk grep /usr/bin
+'quoted text' 'quoted text' 'quoted text'
+"$@" --verbose sed x=1 ${HOME} grep echo printf test echo done then 'quoted text'
+	then cd && readonly awk x=1 | && 2>/dev/null printf sed sed then printf
+	"$1" 'quoted text' && export
+grep printf | cd awk grep then
+	$(pwd) printf then && local /usr/bin sed --verbose && -eu echo
+&& && /usr/bin x=1 x=1 readonly
+	done local 'quoted text' awk "$@" --verbose export
+		then --verbose | -eu echo sed awk && "$1" grep
+	'quoted text' ${HOME} readonly readonly grep awk && 'quoted text'
+		2>/dev/null test awk readonly cd printf 'quoted text'
+		awk -eu /usr/bin echo && echo "$@" x=1
+awk then | -eu awk test --verbose /usr/bin then echo export
+	sed x=1 | export export --verbose echo && test "$1" echo
+	2>/dev/null grep sed ${HOME} "$1" export -eu --verbose local
+'quoted text' "$@" "$1" 'quoted text' "$1" "$1"
+	readonly sed test local "$@" cd x=1 x=1 sed export readonly | ${HOME}
+		sed test then then $(pwd) "$1" awk local 'quoted text' 2>/dev/null local $(pwd)
+| "$1" grep 2>/dev/null local readonly
+awk then $(pwd) && local x=1 $(pwd) then local printf "$@" -eu -eu /usr/bin readonly
+sed 2>/dev/null local $(pwd) grep $(pwd) && cd $(pwd) "$@" readonly local "$@" readonly
+	echo && | export local echo ${HOME} cd x=1 && done sed cd && 'quoted text' 2>/dev/null
+readonly test echo --verbose awk x=1 /usr/bin --verbose "$@" sed
+then export "$1" 'quoted text' && -eu && ${HOME} x=1 && echo
+		--verbose | sed local local "$@" | $(pwd) x=1 test
+/usr/bin export cd printf $(pwd) "$1" test awk cd readonly --verbose
+--verbose readonly readonly 2>/dev/null echo awk -eu ${HOME} ${HOME} | then /usr/bin
+$(pwd) -eu printf sed export 2>/dev/null
+		/usr/bin /usr/bin ${HOME} --verbose local
+		&& export -eu readonly export printf && /usr/bin -eu $(pwd) ${HOME} $(pwd)
+	cd 2>/dev/null 2>/dev/null grep $(pwd) then
+		readonly test $(pwd) printf | printf sed 2>/dev/null then sed
+		local echo sed $(pwd) x=1 readonly
+	awk /usr/bin ${HOME} local local
+		"$@" test echo then 'quoted text' 2>/dev/null cd echo $(pwd) -eu --verbose
+	printf x=1 | "$@" readonly grep | grep
+		/usr/bin $(pwd) done ${HOME} 2>/dev/null -eu -eu
+		&& cd && ${HOME} "$@" 2>/dev/null $(pwd) && awk awk echo local done echo 2>/dev/null
+	cd 'quoted text' "$1" | ${HOME}
+/usr/bin readonly && "$1" x=1 && export awk done test awk
+		awk done export sed export local sed printf
+printf cd "$@" 'quoted text' cd done
+	$(pwd) /usr/bin --verbose -eu sed printf $(pwd) /usr/bin 2>/dev/null
+		&& then test /usr/bin -eu
+readonly readonly x=1 x=1 --verbose
+echo export export && | 'quoted text' grep /usr/bin grep "$1" printf
+	x=1 awk $(pwd) ${HOME} done grep local awk done 2>/dev/null
+	| then -eu awk && /usr/bin readonly "$1" --verbose done
+--verbose sed echo awk "$@" test -eu echo "$1" "$@" awk
+		grep $(pwd) local $(pwd) $(pwd)
+		printf 'quoted text' echo $(pwd) local -eu then
+"$@" "$1" sed 2>/dev/null 2>/dev/null
+		2>/dev/null -eu /usr/bin
+	grep cd grep readonly printf
+printf sed ${HOME} grep readonly
+	"$@" --verbose printf local awk local 2>/dev/null && sed | ${HOME} sed done
+x=1 $(pwd) sed cd local $(pwd)
+	2>/dev/null printf then x=1 2>/dev/null "$1" export 'quoted text' "$1" $(pwd)
+"$1" export cd "$1" /usr/bin awk done --verbose then x=1 $(pwd) grep grep
+		awk export /usr/bin printf | && && sed awk grep && ${HOME} done
+/usr/bin ${HOME} echo $(pwd) | done
+	'quoted text' $(pwd) | export x=1 test
+| echo /usr/bin done printf --verbose printf sed /usr/bin
+	"$@" then sed echo printf $(pwd) export sed
+-eu && test export | | awk ${HOME} && | "$@" -eu
+done "$1" done 2>/dev/null
+'quoted text' export test $(pwd) --verbose "$@" awk then export echo
+		"$@" 2>/dev/null "$@" printf -eu grep test
+		printf grep echo awk ${HOME} awk /usr/bin 2>/dev/null $(pwd)
+		echo readonly -eu $(pwd) $(pwd) sed ${HOME} ${HOME}
+	x=1 test test local && sed -eu && awk x=1 cd "$@" then
+	'quoted text' --verbose ${HOME}
+	local printf --verbose "$@" "$@" | 2>/dev/null local --verbose readonly 'quoted text'
+	&& "$@" done sed grep grep --verbose
+"$1" x=1 test then $(pwd) ${HOME} test "$1" "$@" | $(pwd)
+		${HOME} 'quoted text' done |
+x=1 test x=1 cd printf | printf then
+test cd readonly "$1" test "$1" then local 'quoted text'
+		grep --verbose test local
+$(pwd) then "$1" 'quoted text' -eu ${HOME} ${HOME} grep cd "$1" grep --verbose "$@"
+		grep x=1 local export | -eu "$1" test export export readonly
+&& test 'quoted text' export readonly "$1" 2>/dev/null && "$1" --verbose
+2>/dev/null awk "$1" && $(pwd) /usr/bin
+		then done awk awk ${HOME} readonly
+readonly x=1 "$@" $(pwd) 2>/dev/null awk | "$1" "$@" 2>/dev/null
+	cd ${HOME} test export printf | done -eu "$@" "$@" -eu -eu export --verbose export
+		&& && && -eu --verbose ${HOME} done && 'quoted text'
+	export printf | ${HOME} test cd "$@" echo /usr/bin test
+local then awk "$1" ${HOME} cd local | ${HOME} | ${HOME} -eu sed done 2>/dev/null
+		readonly | echo echo && done 2>/dev/null 2>/dev/null | ${HOME} 2>/dev/null
+	/usr/bin grep cd grep awk "$1" | 2>/dev/null then
+${HOME} grep done local
+		/usr/bin --verbose 2>/dev/null
+done | $(pwd) "$@" "$@" cd then "$@" export
+		then then "$1" "$1" local -eu cd ${HOME} $(pwd) --verbose awk /usr/bin done
+		cd then --verbose | /usr/bin x=1 test $(pwd) /usr/bin | sed $(pwd) 'quoted text'
+	&& 'quoted text' done /usr/bin export /usr/bin ${HOME} 'quoted text' "$1"
+	printf then local export readonly export
+		$(pwd) printf "$1" grep -eu /usr/bin && 2>/dev/null printf
+		| local $(pwd) 2>/dev/null grep 'quoted text' sed $(pwd) echo local test
+		printf local printf "$@" test then test --verbose export
+	done 2>/dev/null ${HOME} --verbose x=1 --verbose ${HOME}
+	'quoted text' awk --verbose
+	local awk done done then --verbose x=1
+		/usr/bin then echo local readonly grep /usr/bin | "$@" test x=1 awk awk test 2>/dev/null
+readonly grep export $(pwd) sed local printf
+		"$@" awk grep && /usr/bin -eu done export "$1" x=1 local 2>/dev/null
+x=1 $(pwd) 'quoted text' -eu readonly grep export cd "$@" test
+	local 2>/dev/null local echo
+readonly x=1 sed local then /usr/bin then ${HOME}
+	"$@" | sed grep export 2>/dev/null cd cd export
+done sed printf cd && "$1"
+$(pwd) && x=1 | | readonly export --verbose
+	| "$1" "$1" then echo awk echo done grep test
+cd local 2>/dev/null | printf export done $(pwd) printf "$@" then 2>/dev/null |
+		/usr/bin "$1" "$1" x=1 test
+		&& 2>/dev/null -eu readonly echo awk grep "$1" then -eu x=1 && done --verbose
+		cd "$1" | --verbose 2>/dev/null
+	awk printf "$@" awk && /usr/bin
+'quoted text' awk awk && 2>/dev/null 2>/dev/null $(pwd)
+&& test grep sed "$1" $(pwd) && printf 'quoted text' printf "$@" test "$1" ${HOME}
+		cd $(pwd) export 'quoted text' $(pwd) grep cd 2>/dev/null readonly --verbose
+	local | cd grep printf --verbose
+	readonly local -eu readonly grep "$@"
+grep "$@" --verbose grep /usr/bin ${HOME} -eu then /usr/bin | 2>/dev/null
+echo awk printf grep /usr/bin 2>/dev/null x=1 grep cd $(pwd) x=1
+		test sed test awk grep echo ${HOME} echo
+		--verbose sed sed ${HOME} echo && awk "$@" /usr/bin $(pwd) -eu
+		&& export -eu awk export printf cd echo echo
+"$1" awk "$1" export
+awk done 2>/dev/null printf 2>/dev/null x=1 echo 'quoted text' cd printf local printf
+		'quoted text' ${HOME} printf | done sed
+		local "$1" readonly 2>/dev/null
+	done export printf test ${HOME} x=1 printf && && "$@" -eu grep && test cd cd echo
+	$(pwd) && readonly export cd export -eu grep test grep && awk | 2>/dev/null then
+		then done /usr/bin -eu then 2>/dev/null /usr/bin && grep echo && --verbose
+		done ${HOME} export then local --verbose "$@"
+	"$@" --verbose | then 2>/dev/null done $(pwd) | echo
+done sed then cd awk $(pwd) /usr/bin grep 'quoted text'
+	then awk x=1 printf awk "$1" sed local -eu &&
+2>/dev/null | "$1" sed x=1 export
+| -eu "$1" 2>/dev/null local $(pwd) sed "$@" grep $(pwd) grep ${HOME} local
+	| printf -eu $(pwd) test printf -eu sed done $(pwd) "$1"
+'quoted text' printf | export then 'quoted text' x=1 2>/dev/null
+awk then test x=1 sed -eu done awk && ${HOME} readonly 'quoted text'
+		export readonly $(pwd) | 2>/dev/null
+	| ${HOME} --verbose done echo "$1" 'quoted text'
+	local && grep 2>/dev/null ${HOME} "$@" ${HOME} "$@" cd /usr/bin test /usr/bin
+		done awk --verbose sed | --verbose ${HOME} "$1" "$@" | done sed $(pwd) 'quoted text'
+	done "$@" && "$@" /usr/bin -eu then /usr/bin test test done | cd
+x=1 --verbose ${HOME}
+		cd grep awk test cd awk && /usr/bin
+echo export "$1" local x=1
+	export grep $(pwd) "$1" 'quoted text' grep sed echo
+	-eu "$1" echo | test then then $(pwd) grep
+	/usr/bin printf && export -eu
+	awk printf | 'quoted text' printf then local -eu -eu
+	| /usr/bin test local $(pwd)
+	grep printf awk $(pwd) /usr/bin 2>/dev/null -eu $(pwd) -eu "$1"
+	'quoted text' 'quoted text' | printf sed x=1 test readonly readonly
+		readonly readonly grep readonly "$1" 'quoted text' "$@" then readonly 'quoted text'
+"$1" && cd then && && | sed $(pwd) && ${HOME} done
+	"$@" && echo done awk "$@" sed ${HOME}
+		x=1 'quoted text' grep then /usr/bin export ${HOME} cd -eu --verbose
+		-eu awk "$@" /usr/bin /usr/bin echo x=1 awk && cd local printf --verbose "$1" grep
+		x=1 "$@" awk done ${HOME} | readonly --verbose --verbose
+	cd printf "$1" ${HOME} done readonly | readonly then grep
+	/usr/bin && awk readonly sed printf ${HOME} grep test
+	awk test 2>/dev/null local then $(pwd) grep sed x=1
+		"$1" readonly $(pwd) test 2>/dev/null printf
+	/usr/bin export && sed
+		-eu readonly && 2>/dev/null 'quoted text' ${HOME} grep
+then ${HOME} test | 'quoted text' printf
+--verbose $(pwd) echo printf local
+		$(pwd) x=1 cd 'quoted text' awk $(pwd)
+awk 2>/dev/null | grep done -eu $(pwd) x=1 awk &&
+	awk | awk grep awk awk "$@" 2>/dev/null -eu
+		/usr/bin "$1" /usr/bin sed
+	grep -eu "$@" 2>/dev/null local -eu "$1" --verbose readonly "$@"
+	grep export echo /usr/bin $(pwd) x=1 2>/dev/null
+		awk done sed --verbose "$1" ${HOME} /usr/bin then then
+		readonly && export echo "$1" --verbose "$@" echo -eu test ${HOME} 2>/dev/null local
+/usr/bin export --verbose -eu 'quoted text' readonly printf
+	2>/dev/null echo awk && printf then grep "$@" /usr/bin | 'quoted text' && | ${HOME}
+	cd $(pwd) awk | export
+	${HOME} /usr/bin -eu test echo -eu export -eu && "$1" 2>/dev/null /usr/bin
+printf echo /usr/bin printf echo 'quoted text' | grep $(pwd) --verbose
+		"$@" x=1 grep export 'quoted text' --verbose local x=1 --verbose local readonly
+		| printf $(pwd) printf export --verbose
+	$(pwd) "$@" readonly $(pwd) /usr/bin 2>/dev/null
+	printf /usr/bin x=1 "$1" echo local export "$@" readonly local cd ${HOME}
+x=1 awk printf echo x=1 printf grep
+	done x=1 echo 2>/dev/null | ${HOME} export /usr/bin
+		cd sed "$@" ${HOME} awk awk --verbose done sed /usr/bin echo --verbose then printf
+cd 'quoted text' | done "$@" local /usr/bin 2>/dev/null "$@" grep
+2>/dev/null test local "$1" --verbose readonly
+	done 'quoted text' test echo x=1 export awk done then ${HOME}
+-eu then | awk export -eu -eu then sed awk readonly sed local "$@"
+		2>/dev/null grep grep local sed export x=1 x=1 then --verbose
+	printf /usr/bin 'quoted text'
+		readonly printf "$@" $(pwd)
+	echo 2>/dev/null --verbose export export export awk ${HOME} readonly echo
+then $(pwd) readonly readonly
+	--verbose && local local cd 2>/dev/null done
+	printf echo done then && /usr/bin cd -eu x=1 'quoted text'
+	export 'quoted text' && "$1" --verbose then printf cd grep 'quoted text'
+		then export -eu && readonly 2>/dev/null
+		printf | ${HOME} local --verbose 2>/dev/null 2>/dev/null
+		"$@" x=1 $(pwd) local then
+	then 2>/dev/null test && test 2>/dev/null
+		--verbose export readonly grep /usr/bin /usr/bin "$@"
+		echo local | local awk grep && "$1" printf /usr/bin sed "$1" awk ${HOME}
+"$@" export cd done ${HOME} 'quoted text' "$@" awk 2>/dev/null awk
+		cd x=1 -eu $(pwd) then awk ${HOME} echo printf && readonly -eu
+		-eu -eu "$@" "$1" echo readonly done ${HOME} 2>/dev/null sed test
+sed 'quoted text' cd grep "$1" awk readonly
+	--verbose x=1 local done export grep cd x=1 test test awk echo
+echo "$@" | x=1 && "$@" cd printf -eu x=1 grep echo export
+		awk grep /usr/bin sed export readonly
+&& x=1 -eu && --verbose done cd
+'quoted text' /usr/bin -eu local test --verbose
+	-eu readonly --verbose | awk
+		done && "$1" echo "$@" echo 2>/dev/null
+	${HOME} done export test awk 2>/dev/null
+test /usr/bin awk -eu -eu
+		"$@" /usr/bin -eu export export grep "$@" sed | | export sed
+	echo sed "$@" && && | | awk x=1 export then test sed grep "$1" "$1" readonly
+$(pwd) 2>/dev/null sed x=1 done x=1 'quoted text'
+export --verbose export test done printf "$1" 2>/dev/null
+		printf test readonly export && 2>/dev/null
+${HOME} readonly echo x=1 && /usr/bin $(pwd)
+		awk 2>/dev/null grep local echo && && printf
+		readonly x=1 grep readonly done && -eu 'quoted text' echo 2>/dev/null
+then test 2>/dev/null done $(pwd) 'quoted text' then | printf x=1 | grep cd -eu
+${HOME} echo | x=1 sed readonly $(pwd) grep -eu && done | "$@" 2>/dev/null
+		${HOME} then "$@" then 2>/dev/null /usr/bin "$@"
+		export then readonly awk ${HOME} test grep -eu && 'quoted text' 'quoted text'
+	done readonly && "$@" --verbose
+		${HOME} export export && | | "$1" grep -eu test --verbose $(pwd) local
+		"$1" | -eu echo 'quoted text' export &&
+	x=1 && done 2>/dev/null "$1" done 'quoted text'
+--verbose done ${HOME} then
+		export sed sed 2>/dev/null 2>/dev/null printf test grep readonly sed sed
+export test echo grep cd done $(pwd) awk awk x=1 export $(pwd)
+	readonly then && sed test
+	export sed && export --verbose then 2>/dev/null
+readonly $(pwd) awk sed cd
+&& 2>/dev/null awk local 2>/dev/null
+	printf | -eu echo printf x=1 export --verbose readonly
+	then /usr/bin echo x=1 echo readonly -eu "$1" 'quoted text'
+	| export 'quoted text'
+--verbose -eu readonly -eu --verbose
+	local then local 'quoted text' 2>/dev/null
+$(pwd) "$1" printf $(pwd) ${HOME} sed sed local --verbose x=1
+		x=1 /usr/bin readonly "$1" -eu export
+	${HOME} /usr/bin done && echo local x=1 "$1" echo && sed --verbose -eu then
+awk ${HOME} awk export printf x=1 x=1 ${HOME} sed
+		readonly readonly test test printf --verbose && /usr/bin
+	$(pwd) 'quoted text' 2>/dev/null sed | echo grep local echo sed echo &&
+	export "$@" && done printf export export
+"$1" && local cd "$1" "$1"
+	readonly $(pwd) "$1" "$@" cd awk x=1 then && local 'quoted text'
+awk export echo 'quoted text' export "$1" --verbose 2>/dev/null echo
+		test sed printf 'quoted text' grep && echo echo
+	grep 2>/dev/null 'quoted text'
+		printf ${HOME} 'quoted text'
+	export 2>/dev/null "$1" test x=1 local /usr/bin /usr/bin grep -eu "$1"
+2>/dev/null -eu sed x=1
+	readonly printf export then test test echo then 'quoted text' printf
+		sed grep "$1" --verbose
+-eu awk grep --verbose x=1 test $(pwd) 2>/dev/null "$@" "$@" -eu x=1
+		--verbose "$1" x=1 --verbose test ${HOME} sed 2>/dev/null
+	${HOME} local && test grep sed x=1 test -eu "$1" "$@" grep
+${HOME} cd test then x=1 export echo then then cd
+	then ${HOME} 'quoted text' test done sed 2>/dev/null done /usr/bin |
+		"$1" local test ${HOME} awk /usr/bin
+	"$@" sed --verbose awk "$1" then /usr/bin | "$1" awk --verbose | x=1 test
+		echo local x=1 && x=1 readonly
+2>/dev/null then grep
+	echo x=1 sed echo 2>/dev/null "$@" ${HOME} printf local grep | then
+/usr/bin 2>/dev/null 2>/dev/null
+	test echo "$@" ${HOME} 'quoted text' cd /usr/bin /usr/bin awk cd printf /usr/bin
+	2>/dev/null cd /usr/bin local readonly
+	| test local export cd "$@" 'quoted text' /usr/bin then
+	sed awk 2>/dev/null 2>/dev/null x=1 /usr/bin x=1 readonly
+	readonly test && 2>/dev/null /usr/bin cd grep x=1 local
+		then $(pwd) echo readonly done then --verbose
+	'quoted text' local ${HOME} /usr/bin "$1" "$@" echo echo x=1 awk
+	local -eu readonly local export
+		grep echo test /usr/bin | $(pwd) --verbose done /usr/bin
+		-eu grep readonly readonly local test cd 'quoted text' grep ${HOME} echo test awk
+	-eu /usr/bin done ${HOME} | 2>/dev/null done test cd local 2>/dev/null /usr/bin
+	2>/dev/null printf 'quoted text'
+		then x=1 echo sed awk printf $(pwd)
+		test test 'quoted text' | awk export grep ${HOME}
+	-eu test readonly $(pwd) then
+		awk echo cd x=1 --verbose echo 2>/dev/null ${HOME}
+	2>/dev/null export "$1" done
+	"$@" awk readonly grep echo -eu awk sed "$1" && then done x=1 awk --verbose
+echo sed printf "$@" $(pwd) echo echo -eu $(pwd) printf --verbose
+	local cd && cd $(pwd) done echo
+x=1 -eu --verbose then local "$@" "$1" 'quoted text'
+"$1" done local test "$1" printf awk awk cd 2>/dev/null "$1" export awk | test
+	--verbose /usr/bin $(pwd) x=1
+		'quoted text' readonly printf "$1"
+grep "$1" export local /usr/bin done readonly
+		-eu x=1 local done && $(pwd) 2>/dev/null grep --verbose 2>/dev/null test x=1 "$@"
+/usr/bin $(pwd) then "$@" local export local test echo
+		test $(pwd) printf 2>/dev/null
+local "$1" 'quoted text' 'quoted text' grep awk x=1 export "$@"
+	${HOME} "$1" x=1 local echo /usr/bin ${HOME} "$@"
+		${HOME} test cd 2>/dev/null "$@" test done sed then "$1" local --verbose
+		sed grep "$@" | $(pwd) "$@" echo 'quoted text' local x=1 'quoted text'
+	"$1" 'quoted text' ${HOME} then readonly
+test cd x=1 test readonly done
+		--verbose "$@" --verbose 2>/dev/null
+	grep export cd sed | readonly
+		export printf "$@" sed $(pwd) --verbose && "$1" /usr/bin "$1" local
+awk sed awk 2>/dev/null sed $(pwd) echo
+	${HOME} "$@" ${HOME} test $(pwd)
+	$(pwd) "$1" --verbose "$@" ${HOME} printf then then grep readonly
+		cd $(pwd) /usr/bin $(pwd) grep 'quoted text' cd grep then grep sed done ${HOME}
+'quoted text' readonly sed then echo $(pwd) | printf
+readonly && "$@" cd ${HOME} --verbose awk grep -eu echo then printf export "$1"
+then test sed "$@" -eu readonly
+		"$1" ${HOME} echo grep "$@" 'quoted text' export local local /usr/bin
+$(pwd) echo "$@" export then local 2>/dev/null
+		test then export then /usr/bin
+		"$@" && x=1 -eu "$1" "$1" echo $(pwd)
+		then awk readonly $(pwd) done printf awk local
+| "$1" done --verbose "$1" awk then
+	2>/dev/null | "$@" | -eu --verbose cd
+	grep readonly export then -eu 'quoted text' echo /usr/bin grep
+	'quoted text' && local /usr/bin echo local
+		export test echo sed "$1" test cd sed $(pwd) 2>/dev/null /usr/bin
+		test export | ${HOME} cd
+		${HOME} awk export then "$@" grep 'quoted text' 'quoted text'
+&& then local local $(pwd) && then echo $(pwd) echo export sed test --verbose
+		echo && grep echo && -eu /usr/bin /usr/bin then /usr/bin
+		$(pwd) && cd | then ${HOME} readonly x=1 "$@" done
+	readonly printf 'quoted text' awk readonly $(pwd) "$@" x=1 $(pwd) | sed
+	$(pwd) export "$@" then sed && --verbose test sed awk cd awk
+		test done x=1 -eu cd "$1" then cd --verbose cd "$@" 'quoted text'
+		echo grep awk printf
+		test --verbose then /usr/bin echo then echo -eu "$@" echo
+--verbose ${HOME} then local | x=1 $(pwd) -eu --verbose grep /usr/bin
+	| x=1 -eu "$@" then $(pwd) then --verbose x=1 echo
+		readonly export && && echo $(pwd) | echo 2>/dev/null then local
+x=1 echo grep grep awk 'quoted text' -eu sed sed sed
+	awk awk readonly | 'quoted text' awk "$1" "$1"
+/usr/bin local then /usr/bin cd /usr/bin | "$1" $(pwd) then
+${HOME} readonly 'quoted text' x=1 export -eu && $(pwd)
+"$@" --verbose export grep
+	readonly | 2>/dev/null
+		then --verbose 'quoted text' then /usr/bin readonly
+		-eu sed 'quoted text' done | /usr/bin test 'quoted text' /usr/bin awk then "$@"
+	test $(pwd) /usr/bin x=1 /usr/bin test | /usr/bin 2>/dev/null | $(pwd)
+	/usr/bin awk | 2>/dev/null grep cd done printf /usr/bin done ${HOME} cd /usr/bin
+test | printf && 2>/dev/null echo $(pwd) then --verbose grep local
+		test --verbose local export --verbose 2>/dev/null 'quoted text'
+-eu /usr/bin test sed ${HOME} then sed x=1 printf
+$(pwd) export 2>/dev/null export
+		/usr/bin 'quoted text' && x=1 sed echo sed echo done test
+grep "$1" awk echo "$@" 2>/dev/null test x=1 awk
+		| ${HOME} then sed grep local -eu /usr/bin then then 'quoted text' awk "$1"
+	sed --verbose && grep grep 2>/dev/null export
+		local /usr/bin readonly --verbose local printf
+${HOME} | done export done printf "$1"
+	${HOME} -eu "$1" test local cd -eu "$1" /usr/bin then then readonly ${HOME}
+	| printf sed | done "$@" awk printf ${HOME} $(pwd) cd /usr/bin then
+		sed | local sed -eu "$@" "$1"
+then x=1 cd -eu 'quoted text' printf | test readonly awk echo "$1" "$1"
+awk x=1 ${HOME} grep awk "$@" "$@" then "$@" then
+	2>/dev/null "$1" grep ${HOME} readonly "$1" local done
+		export "$@" | "$1" sed readonly "$1" grep "$1" export
+		&& echo -eu x=1 then "$1" "$@" && ${HOME} readonly
+		'quoted text' $(pwd) /usr/bin "$@" --verbose echo
+	cd sed | && done local | "$1" grep readonly awk && grep local readonly /usr/bin
+&& sed | then readonly local export /usr/bin awk then readonly
+&& -eu ${HOME} x=1 2>/dev/null export export cd ${HOME}
+		test export cd "$1" printf
+local -eu 'quoted text' export "$@"
+	$(pwd) then --verbose export -eu
+$(pwd) grep awk "$1" cd && --verbose
+2>/dev/null echo "$1" $(pwd) cd "$1" /usr/bin --verbose then awk sed
+	done local -eu printf printf
+		-eu cd echo --verbose then ${HOME} then sed
+"$1" 2>/dev/null x=1 | then awk -eu $(pwd)
+local | echo cd local | sed local 'quoted text' sed readonly x=1 then &&
+test | --verbose | readonly $(pwd)
+cd done readonly && grep then "$@"
+-eu local done /usr/bin -eu printf test local done export
+2>/dev/null cd | then --verbose | grep && $(pwd) x=1 | "$1" done readonly
+export export $(pwd) echo --verbose 2>/dev/null
+		done | 2>/dev/null readonly && local /usr/bin export -eu then && cd | | echo
+		cd -eu local readonly then awk "$1" then then grep 'quoted text' 'quoted text'
+	cd 2>/dev/null then sed && sed
+		$(pwd) awk && "$@" done test /usr/bin ${HOME} sed readonly printf grep export x=1
+		2>/dev/null cd local test
+		"$1" test printf 'quoted text' ${HOME} --verbose sed
+$(pwd) 'quoted text' x=1 &&
+readonly local 'quoted text' export x=1 then "$1" awk --verbose
+		cd readonly 'quoted text' "$@" x=1 && echo printf cd ${HOME}
+		$(pwd) done -eu export $(pwd) readonly echo local awk
+		-eu ${HOME} /usr/bin | awk awk readonly $(pwd) | readonly x=1
+	echo x=1 --verbose printf done sed local "$1"
+		done sed | | "$1" sed then printf local -eu then sed --verbose
+echo test && && echo test --verbose printf 2>/dev/null 'quoted text' local
+	&& 2>/dev/null $(pwd) cd cd readonly "$1" then done sed ${HOME} printf echo | $(pwd)
+	test awk done echo echo sed printf /usr/bin | "$@" x=1 sed sed
+		--verbose sed x=1 2>/dev/null
+		done $(pwd) then cd 2>/dev/null && local 'quoted text' 2>/dev/null
+	local local "$@" cd awk | grep echo x=1 /usr/bin
+		printf x=1 $(pwd) echo awk awk ${HOME}
+	/usr/bin cd "$1" 'quoted text'
+		echo then echo local 'quoted text' grep sed ${HOME}
+	'quoted text' ${HOME} x=1 then echo --verbose export
+	echo sed "$1" local export ${HOME} then grep done | printf local printf "$1"
+	-eu readonly test --verbose /usr/bin awk "$1" sed && "$@" -eu && /usr/bin
+		export "$1" $(pwd) then then readonly awk | printf --verbose awk local readonly
+		$(pwd) sed ${HOME} /usr/bin grep done awk cd export
+sed then sed 2>/dev/null | $(pwd) 'quoted text' then 2>/dev/null
+"$1" sed printf -eu echo
+x=1 done -eu grep then echo export sed --verbose
+	'quoted text' --verbose test export sed ${HOME} | | export printf
+		cd 2>/dev/null printf done "$@" awk echo
+cd readonly x=1 sed done done "$@" cd --verbose
+$(pwd) export printf printf | readonly "$1" readonly ${HOME} "$@" && sed
+export sed $(pwd) cd test --verbose && 'quoted text'
+	--verbose local -eu && --verbose done 2>/dev/null local | awk
+	$(pwd) test export ${HOME} $(pwd) cd x=1 export --verbose cd && 'quoted text'
+| printf 2>/dev/null then echo
+		| --verbose "$@" export sed printf /usr/bin
+		&& local then -eu 2>/dev/null
+		${HOME} -eu test cd printf done
+'quoted text' 'quoted text' "$@" $(pwd) then printf
+		${HOME} test "$1" test awk | then "$1" then readonly "$1" x=1
+		cd | awk printf /usr/bin /usr/bin
+		then && x=1 && 'quoted text'
+		-eu echo /usr/bin --verbose echo grep sed ${HOME} && done export
+local done -eu x=1 cd done awk --verbose grep | echo "$@" sed then /usr/bin
+		local x=1 awk "$@" done export export 'quoted text'
+		test awk then "$1" cd readonly local readonly
+$(pwd) readonly test && | then ${HOME} 2>/dev/null readonly | grep
+-eu -eu 2>/dev/null "$@" /usr/bin /usr/bin done echo "$1"
+		| export /usr/bin echo 2>/dev/null sed readonly
+		export local -eu then -eu readonly
+	echo $(pwd) then /usr/bin -eu cd cd cd 2>/dev/null
+export awk export sed
+&& | | "$1" "$@" --verbose then 2>/dev/null $(pwd) cd /usr/bin /usr/bin
+		--verbose "$1" x=1 test -eu --verbose "$1" -eu ${HOME} echo "$1" sed "$@" "$1"
+${HOME} "$1" $(pwd) /usr/bin echo test && 2>/dev/null awk | $(pwd) 'quoted text'
+		"$@" done | cd echo /usr/bin $(pwd) "$@" test awk then test ${HOME} | sed done
+	&& | 'quoted text' -eu
+printf cd done | | done x=1 "$@" |
+		awk ${HOME} then --verbose && local export done cd
+2>/dev/null && x=1 awk awk echo done sed cd -eu x=1
+		--verbose test x=1 sed grep readonly then && && /usr/bin export x=1 cd ${HOME}
+		-eu then 'quoted text'
+	x=1 'quoted text' 'quoted text'
+		'quoted text' "$@" printf export echo test
+	${HOME} x=1 awk cd done export test --verbose --verbose test
+/usr/bin awk awk --verbose ${HOME} /usr/bin
+/usr/bin 'quoted text' awk 'quoted text' grep readonly
+		2>/dev/null awk export -eu -eu done readonly sed
+/usr/bin "$@" export readonly local
+	/usr/bin local local "$1" "$1" x=1 sed echo | && local
+"$1" sed $(pwd) x=1 $(pwd) test "$@" sed readonly
+		then export readonly done sed ${HOME} && "$@" done
+		&& --verbose printf /usr/bin local done grep test --verbose 'quoted text'
+	${HOME} x=1 2>/dev/null "$1"
+	local export "$@" --verbose $(pwd) awk printf export /usr/bin
+		'quoted text' "$1" && && sed echo 'quoted text'
+		printf then awk done /usr/bin sed
+		"$@" $(pwd) $(pwd) x=1 && readonly ${HOME} test -eu "$1" readonly
+	${HOME} cd export /usr/bin
+grep --verbose | then cd $(pwd) $(pwd) done 'quoted text' |
+	"$@" && then x=1 /usr/bin readonly
+-eu "$@" "$@" x=1 export printf
+		x=1 && echo done printf "$@" then "$1" export printf 2>/dev/null
+--verbose 2>/dev/null --verbose
+		--verbose printf awk "$@" x=1 --verbose sed 2>/dev/null then -eu
+	"$1" "$@" ${HOME} ${HOME} -eu export awk echo test export cd "$@" echo
+		${HOME} | grep $(pwd) echo 'quoted text'
+/usr/bin then --verbose
+	x=1 grep awk grep 'quoted text' /usr/bin
+grep printf && | /usr/bin grep
+	${HOME} cd printf $(pwd) printf
+--verbose test /usr/bin
+		grep cd 2>/dev/null 2>/dev/null 2>/dev/null --verbose
+	"$@" awk awk -eu echo | ${HOME} test export echo
+&& printf ${HOME} | test grep printf "$1" then --verbose cd x=1
+		&& /usr/bin cd "$1" "$@" "$1" awk 'quoted text' readonly
+grep readonly grep -eu then /usr/bin 'quoted text'
+		$(pwd) 'quoted text' && export /usr/bin
+		${HOME} export $(pwd) 2>/dev/null /usr/bin export printf export
+&& awk printf awk && 'quoted text' /usr/bin /usr/bin
+		done then cd | grep export && && then && sed | $(pwd) 'quoted text' done
+		&& x=1 -eu cd /usr/bin | test && "$1"
+	sed cd readonly 2>/dev/null ${HOME} $(pwd) done printf readonly
+		grep "$@" $(pwd) readonly awk export $(pwd) "$1"
+| echo | printf "$@" done $(pwd) && grep -eu readonly
+	x=1 test done test "$1" done
+-eu done | grep -eu "$@" x=1 grep -eu readonly
+	${HOME} grep "$@" sed cd sed ${HOME} test local --verbose && done grep
+cd local echo && $(pwd) then "$1" 'quoted text'
+		x=1 done then ${HOME} local "$1" local 'quoted text'
+	-eu x=1 "$@" awk 'quoted text' sed
+echo "$@" then readonly && done awk local ${HOME} 2>/dev/null cd "$1"
+	awk $(pwd) x=1 && local done done awk "$1" test sed done sed export
+-eu 'quoted text' readonly awk "$1" awk --verbose readonly
+"$@" 2>/dev/null local "$1" export | "$@"
+"$1" $(pwd) local test done "$1" export export 'quoted text' "$1" grep readonly
+cd -eu echo 'quoted text' 'quoted text' sed
+		-eu test 'quoted text' "$1" ${HOME} local awk 'quoted text' --verbose
+		done /usr/bin && export printf --verbose local ${HOME} then
+	-eu | 2>/dev/null && "$1" ${HOME} "$@" then --verbose sed x=1 test export done
+		2>/dev/null $(pwd) --verbose then
+export echo cd --verbose local then ${HOME} cd 2>/dev/null then 2>/dev/null
+cd printf grep "$1" done | --verbose $(pwd) cd echo $(pwd)
+'quoted text' grep then then test | then
+	&& export 'quoted text' echo 2>/dev/null | printf export
+	printf "$1" x=1 $(pwd)
+--verbose 2>/dev/null sed test "$@" /usr/bin 2>/dev/null | then 2>/dev/null
+	test $(pwd) /usr/bin sed export test done echo $(pwd) 2>/dev/null local sed --verbose
+x=1 grep export /usr/bin echo $(pwd) echo x=1 2>/dev/null local x=1
+	readonly --verbose --verbose sed
+	export test grep test /usr/bin ${HOME}
+local echo --verbose local then
+	"$@" $(pwd) export ${HOME} /usr/bin "$@" --verbose
+	printf local local echo test grep 2>/dev/null "$@" 'quoted text' 2>/dev/null
+		cd "$@" "$@" grep done then $(pwd) ${HOME} $(pwd) grep -eu
+export 'quoted text' then export $(pwd)
+	x=1 "$@" --verbose cd sed "$@" done | /usr/bin 2>/dev/null done /usr/bin
+/usr/bin "$1" "$1" "$@" export grep x=1 && echo "$@" printf --verbose 'quoted text'
+		x=1 awk sed "$1" $(pwd) printf $(pwd) readonly done sed local
+	readonly readonly && cd echo local 2>/dev/null done printf cd && export
+-eu grep 'quoted text' 2>/dev/null /usr/bin then -eu echo grep readonly
+		x=1 awk && export 'quoted text' cd 2>/dev/null ${HOME} grep export $(pwd) test
+		-eu $(pwd) /usr/bin export test 2>/dev/null 'quoted text' "$@" $(pwd) then
+		| x=1 test && x=1 export 'quoted text' done
+		test -eu sed "$1" printf awk /usr/bin printf
+	then 'quoted text' --verbose --verbose printf x=1 "$1" then test sed local
+	'quoted text' local && sed awk --verbose --verbose $(pwd)
+		done grep /usr/bin test "$@"
+sed echo | echo /usr/bin sed
+	| then 2>/dev/null awk echo /usr/bin done cd && sed "$1" /usr/bin grep ${HOME}
+		2>/dev/null "$1" printf 2>/dev/null
+x=1 2>/dev/null && | "$@" echo grep readonly ${HOME} /usr/bin then | export $(pwd)
+cd echo "$1" $(pwd) ${HOME} /usr/bin ${HOME} /usr/bin done readonly export ${HOME}
+'quoted text' --verbose
+	then 'quoted text' /usr/bin sed -eu export
+--verbose "$@" $(pwd) 'quoted text'
+	export test 2>/dev/null cd $(pwd) readonly
+		grep --verbose $(pwd)
+	"$@" ${HOME} awk | && 'quoted text' "$1"
+	sed readonly 'quoted text'
+	then done then cd 'quoted text' x=1 && printf grep echo
+test 2>/dev/null done grep cd --verbose 2>/dev/null
+local $(pwd) export echo echo
+${HOME} test --verbose printf "$@" $(pwd) echo /usr/bin /usr/bin cd 2>/dev/null
+"$1" 'quoted text' "$@" $(pwd) grep
+--verbose 2>/dev/null "$1" "$@"
+	--verbose --verbose sed 2>/dev/null | x=1 | --verbose -eu "$@" test
+	-eu printf then -eu local -eu 2>/dev/null | 'quoted text' 2>/dev/null
+local export /usr/bin | && printf then 'quoted text' && done done then
+		export "$@" && 2>/dev/null cd &&
+-eu test sed /usr/bin readonly
+2>/dev/null cd x=1 && then test -eu "$@" local grep echo test grep
+sed sed done -eu $(pwd) test
+		done grep "$@" && | export awk readonly
+	$(pwd) echo "$@" /usr/bin export && sed "$1" sed x=1 export local 'quoted text'
+	echo "$1" local | grep "$@" 2>/dev/null then printf x=1
+'quoted text' sed --verbose x=1 ${HOME}
+		cd 2>/dev/null 2>/dev/null local cd && /usr/bin 'quoted text' --verbose echo -eu
+	${HOME} done $(pwd) grep
+		readonly readonly /usr/bin x=1 ${HOME}
+	done 2>/dev/null printf && | "$1" /usr/bin printf cd && export -eu
+	cd /usr/bin done then export
+$(pwd) ${HOME} /usr/bin | "$@" test readonly then done
+	-eu "$@" /usr/bin test readonly $(pwd) readonly test local && export 'quoted text'
+sed grep $(pwd) echo awk
+2>/dev/null printf /usr/bin
+readonly readonly && then | done x=1 cd 'quoted text' && -eu /usr/bin
+		done $(pwd) | -eu "$1" awk && "$@"
+grep "$1" 'quoted text' readonly 2>/dev/null $(pwd) /usr/bin x=1
+		--verbose x=1 "$@" ${HOME} test $(pwd) done printf test printf done
+	-eu -eu done echo && 2>/dev/null -eu local sed
+		then printf -eu 'quoted text'
+readonly local "$@" then awk then done
+	done --verbose grep awk export $(pwd) x=1 awk local x=1 export grep ${HOME}
+		/usr/bin readonly "$1" echo
+echo ${HOME} readonly local --verbose $(pwd) -eu && printf
+local sed echo 'quoted text' cd cd done "$1"
+local test printf 2>/dev/null readonly sed "$1" | local | /usr/bin 'quoted text'
+		-eu echo readonly ${HOME} done done $(pwd) --verbose sed then /usr/bin done 2>/dev/null
+		grep readonly sed ${HOME} $(pwd) test
+	${HOME} --verbose /usr/bin
+	--verbose grep awk 2>/dev/null printf grep
+	"$1" $(pwd) x=1 test echo test 2>/dev/null test "$@" sed ${HOME}
+	'quoted text' 'quoted text' $(pwd) && | "$@" echo export $(pwd) x=1 ${HOME}
+		local /usr/bin cd ${HOME} echo readonly
+		done cd "$1" echo sed x=1 x=1 local export ${HOME} then echo x=1 "$@" local
+${HOME} 2>/dev/null 'quoted text' ${HOME} export test --verbose
+	'quoted text' sed x=1 sed --verbose awk grep export export printf
+		test --verbose done /usr/bin echo cd "$1" then sed $(pwd) 2>/dev/null
+		export ${HOME} 'quoted text'
+		${HOME} && /usr/bin readonly &&
+'quoted text' awk awk | "$@" 2>/dev/null --verbose done "$1" local local
+		cd done echo printf test readonly done x=1
+"$1" --verbose echo x=1 local then "$1" | && --verbose sed "$1" export /usr/bin
+	$(pwd) then && --verbose --verbose then | export | echo sed && 2>/dev/null then
+		"$1" grep echo -eu 'quoted text' && x=1 grep -eu
+		"$1" sed grep ${HOME} -eu done /usr/bin then 'quoted text' echo then
+	${HOME} | $(pwd) export grep "$@" $(pwd) then done cd test --verbose
+		printf grep && readonly 'quoted text' sed "$1" 'quoted text'
+		-eu awk then 'quoted text' -eu $(pwd) 'quoted text' printf --verbose &&
+		done test 2>/dev/null readonly awk 2>/dev/null sed ${HOME} -eu grep
+$(pwd) then ${HOME} "$@" | "$1" 'quoted text' 'quoted text' 2>/dev/null export
+&& awk ${HOME} "$1" printf awk readonly awk --verbose echo
+		${HOME} cd grep export awk ${HOME}
+		awk --verbose sed local awk 2>/dev/null echo awk sed /usr/bin "$1"
+--verbose test done printf x=1 awk printf
+awk | grep export | export sed echo "$1" readonly "$@" cd grep printf
+then printf "$1" echo "$@" "$@" $(pwd) done export && readonly
+	-eu 2>/dev/null then awk export
+		'quoted text' done readonly cd -eu $(pwd) export readonly then 2>/dev/null
+printf "$@" --verbose -eu "$1" then awk 2>/dev/null local 2>/dev/null
+		--verbose | "$1" && "$@" echo $(pwd) &&
+2>/dev/null 'quoted text' "$@" awk printf | sed /usr/bin local 'quoted text'
+echo ${HOME} | grep echo sed -eu "$1" ${HOME} then test readonly -eu
+		| grep --verbose -eu 'quoted text' then awk x=1 | readonly cd
+		cd -eu && cd local && echo
+export then ${HOME} sed /usr/bin | test readonly readonly
+	printf done readonly --verbose
+	"$@" -eu "$@" --verbose cd grep 2>/dev/null
+		cd | 2>/dev/null ${HOME} done --verbose
+	grep "$@" -eu ${HOME} x=1 local /usr/bin | local x=1 -eu cd "$@" grep "$1" cd done
+		printf printf $(pwd) ${HOME} | 'quoted text' /usr/bin && local 'quoted text'
+	awk printf 2>/dev/null cd export echo grep export sed
+	${HOME} cd ${HOME} local x=1 local test 'quoted text'
+	readonly printf -eu then local readonly
+		printf | | 'quoted text' printf "$@"
+-eu printf "$1" echo export done readonly
+		x=1 test x=1 done grep test ${HOME} -eu 'quoted text' "$1" "$1" test
+	then done awk ${HOME} echo cd /usr/bin
+grep grep test 2>/dev/null awk readonly printf local --verbose
+local -eu ${HOME} "$@" 2>/dev/null
+local sed then /usr/bin readonly && done
+grep cd awk printf -eu -eu
+	awk --verbose --verbose $(pwd) 'quoted text' grep && cd | ${HOME} "$@"
+	echo --verbose export ${HOME} printf | "$1"
+local done cd x=1 done /usr/bin
+	sed awk done done awk "$@" ${HOME}
+$(pwd) printf && cd export
+		/usr/bin test x=1 -eu printf printf "$1" cd ${HOME}
+2>/dev/null 2>/dev/null --verbose grep 'quoted text' then then echo "$1" export
+echo x=1 --verbose test -eu local local
+test printf -eu -eu local export then 2>/dev/null local readonly
+cd /usr/bin ${HOME} 'quoted text' | sed $(pwd)
+&& awk awk test done | --verbose "$1" "$@" x=1 x=1
+		then readonly printf printf
+&& "$1" sed $(pwd) -eu 'quoted text'
+printf "$@" done done awk sed export
+		printf then done printf echo printf awk && export sed then 2>/dev/null
+&& "$@" ${HOME} printf && grep awk x=1 printf done 'quoted text' |
+		grep printf x=1 x=1 2>/dev/null "$1" $(pwd) && x=1 "$@"
+	local -eu -eu $(pwd) awk "$1"
+x=1 grep then export awk x=1 "$@" awk ${HOME} local $(pwd) then 'quoted text'
+	export done export $(pwd) cd x=1 "$@" test
+| awk then | 2>/dev/null printf
+awk $(pwd) --verbose awk echo --verbose awk -eu cd done 2>/dev/null
+-eu done then "$1" /usr/bin --verbose
+		awk $(pwd) /usr/bin $(pwd) ${HOME} 'quoted text' "$@" then "$1" && cd $(pwd)
+'quoted text' $(pwd) ${HOME} 2>/dev/null sed /usr/bin sed awk readonly
+	readonly grep "$1" awk
+	printf awk grep x=1 local grep "$@" test && done && done awk 2>/dev/null
+		awk x=1 local "$@" export cd printf "$1" "$@"
+-eu cd printf local -eu "$1" readonly printf
+'quoted text' $(pwd) then cd grep printf sed "$1" readonly --verbose cd "$@" 2>/dev/null
+printf echo /usr/bin --verbose test readonly awk
+printf && | test cd local x=1 test done then
+		printf sed then readonly
+		${HOME} $(pwd) "$1" -eu 'quoted text' done
+echo grep | then printf $(pwd) -eu test export 'quoted text' x=1 "$1" printf local
+		awk then 'quoted text' local then done | /usr/bin printf local test $(pwd)
+		awk printf 2>/dev/null x=1 x=1 grep x=1 cd "$1" local printf
+sed then --verbose printf | cd "$@" cd test grep
+sed 2>/dev/null --verbose sed test done done | awk -eu export | "$@" done $(pwd)
+"$@" readonly x=1 echo $(pwd)
+export x=1 export test readonly sed | readonly sed $(pwd) "$1" test grep
+	&& ${HOME} | | printf grep cd sed grep 'quoted text' sed
+printf sed local x=1 export $(pwd)
+/usr/bin export /usr/bin
+		awk then x=1 export "$@" cd done 'quoted text'
+cd 'quoted text' test then && && --verbose printf grep local | 2>/dev/null export
+		&& echo test sed then 2>/dev/null 'quoted text' "$@"
+		x=1 "$@" then "$1" 'quoted text' then grep grep "$1" | "$@" export awk awk
+"$@" cd ${HOME} --verbose awk -eu x=1 ${HOME} readonly
+	| x=1 x=1 grep && test /usr/bin sed --verbose "$@" done -eu 2>/dev/null
+	"$1" && local grep ${HOME} "$@" grep readonly
+		$(pwd) ${HOME} grep cd awk "$@" | test | /usr/bin -eu sed && "$1" readonly
+	2>/dev/null --verbose -eu $(pwd) 'quoted text' | x=1 && local |
+	$(pwd) 'quoted text' "$@" x=1 "$@"
+	$(pwd) done 2>/dev/null ${HOME} 'quoted text' "$1" --verbose
+local test export | ${HOME}
+${HOME} "$1" printf printf then printf 2>/dev/null
+		x=1 local /usr/bin cd test -eu --verbose then readonly
+x=1 $(pwd) x=1 done -eu cd x=1 "$1" echo && 'quoted text'
+| | export sed ${HOME} sed
+	/usr/bin sed cd grep -eu 'quoted text' echo awk ${HOME}
+		printf test 2>/dev/null $(pwd) test 'quoted text'
+| ${HOME} x=1 x=1 done | "$@" grep printf test export local
+	export --verbose x=1 local
+		/usr/bin ${HOME} readonly done done grep | export
+done "$1" test echo local grep sed awk awk done "$1" printf
+	--verbose 'quoted text' "$@" local 2>/dev/null then
+		grep awk test && test | echo sed grep cd -eu readonly printf grep test 'quoted text'
+awk grep $(pwd) export sed local
+'quoted text' /usr/bin cd test cd done echo local echo x=1 | 2>/dev/null
+x=1 x=1 echo "$1" local readonly $(pwd)
+		then | ${HOME} 2>/dev/null done 2>/dev/null
+		done && | | sed cd $(pwd) /usr/bin $(pwd) ${HOME} cd sed -eu local test
+"$@" readonly "$@" "$1"
+export readonly --verbose --verbose cd then 2>/dev/null x=1 /usr/bin "$1" -eu |
+	--verbose printf local local ${HOME} x=1 $(pwd) -eu 2>/dev/null awk /usr/bin "$@"
+printf /usr/bin ${HOME} grep
+		local done export x=1 -eu then printf "$1" done grep sed
+	'quoted text' x=1 'quoted text' done --verbose
+		--verbose "$1" x=1 export $(pwd)
+	"$1" test readonly | test
+		"$1" --verbose "$@" /usr/bin local && grep test local 2>/dev/null --verbose
+		&& && awk awk -eu cd readonly 2>/dev/null "$1" $(pwd) ${HOME} sed then | | grep
+		2>/dev/null test printf 2>/dev/null
+${HOME} --verbose test grep test "$1" echo 'quoted text' awk 2>/dev/null sed test
+done grep 'quoted text' readonly sed /usr/bin ${HOME} "$@" printf done 2>/dev/null
+		test test && -eu export && 'quoted text' && done readonly
+	'quoted text' "$@" ${HOME}
+	/usr/bin done grep sed ${HOME} grep && "$1" ${HOME}
+	${HOME} --verbose ${HOME} $(pwd) done && sed then export readonly export
+printf echo | awk | | grep printf then done --verbose export
+${HOME} printf ${HOME} $(pwd) -eu then --verbose done --verbose 'quoted text'
+		| done printf cd 2>/dev/null awk test $(pwd) 2>/dev/null 'quoted text' -eu
+'quoted text' 2>/dev/null done done local x=1 --verbose
+	export done sed 2>/dev/null
+	echo export awk echo 'quoted text'
+readonly export 'quoted text' cd /usr/bin
+$(pwd) done export -eu cd printf sed && echo "$@" grep local sed ${HOME} /usr/bin
+	"$@" local "$@" x=1 --verbose done "$@" sed readonly grep test --verbose "$1"
+cd export 'quoted text' | x=1 -eu grep
+		local x=1 test && --verbose ${HOME} readonly export && -eu /usr/bin $(pwd) printf
+		cd awk | echo 'quoted text' cd sed $(pwd) 2>/dev/null export
+2>/dev/null 'quoted text' $(pwd) sed printf
+$(pwd) grep grep "$1" local "$1" sed awk 2>/dev/null 2>/dev/null
+	readonly export $(pwd) printf --verbose then echo export
+	-eu ${HOME} cd /usr/bin -eu "$@" 'quoted text'
+	$(pwd) readonly awk -eu local && readonly -eu
+		then then "$@" printf printf export grep
+		readonly -eu awk --verbose readonly awk && 'quoted text' -eu ${HOME} $(pwd)
+		readonly test x=1 /usr/bin local "$@" printf x=1 done --verbose
+		"$@" readonly "$@" printf -eu echo | $(pwd) echo "$1" test readonly local done sed
+	--verbose done ${HOME} grep
+cd 2>/dev/null && local /usr/bin "$@" "$1" then
+		awk | echo 'quoted text' 2>/dev/null
+/usr/bin then | test | "$1" "$@" -eu sed ${HOME} 'quoted text' /usr/bin
+	done then ${HOME} sed grep "$1" readonly $(pwd)
+test ${HOME} x=1 sed ${HOME} test cd printf test --verbose export --verbose
+x=1 export readonly /usr/bin x=1 "$1" | --verbose x=1 readonly
+local grep grep && readonly cd $(pwd) awk -eu local
+printf && x=1 --verbose /usr/bin
+	'quoted text' /usr/bin "$@" -eu 'quoted text' cd export readonly readonly
+	grep /usr/bin && 'quoted text' --verbose export echo $(pwd) x=1 'quoted text'
+x=1 'quoted text' ${HOME} printf /usr/bin
+--verbose | cd local ${HOME} sed then readonly "$@"
+done "$@" | "$@" test awk export | grep "$@" grep
+-eu x=1 'quoted text' --verbose
+cd readonly --verbose awk /usr/bin ${HOME} -eu echo
+	test x=1 && ${HOME} export grep export
+	test "$@" | then sed ${HOME} export then -eu sed then --verbose cd
+readonly $(pwd) cd && "$@" test && --verbose
+		grep echo -eu x=1 local | printf printf export
+	${HOME} export /usr/bin 2>/dev/null
+echo $(pwd) awk awk export readonly
+		--verbose "$@" -eu ${HOME} "$@"
+		"$1" "$1" done test echo done export
+${HOME} printf ${HOME} grep $(pwd) 2>/dev/null --verbose
+		sed cd local 2>/dev/null | local
+'quoted text' ${HOME} test then local printf "$1"
+${HOME} && echo --verbose
+		grep done ${HOME} test && printf
+	| readonly -eu $(pwd) 'quoted text' export sed x=1 sed printf local -eu
+test /usr/bin 2>/dev/null grep echo awk /usr/bin echo x=1 cd 2>/dev/null readonly
+		test grep "$1" 'quoted text' grep readonly
+| export echo 'quoted text' echo $(pwd) && then awk local
+$(pwd) ${HOME} done export then ${HOME} grep grep grep sed
+		awk awk --verbose cd done x=1 x=1 | $(pwd) | local $(pwd) echo
+grep then 2>/dev/null test
+| cd awk readonly $(pwd) sed 'quoted text' echo 'quoted text' readonly printf then
+		"$1" | done && local "$1" /usr/bin
+| x=1 printf 2>/dev/null sed awk test test --verbose -eu printf $(pwd)
+'quoted text' $(pwd) $(pwd) /usr/bin local
+	test -eu awk "$1" sed $(pwd)
+	export "$@" --verbose "$@" 2>/dev/null echo cd
+sed /usr/bin done done test --verbose
+/usr/bin readonly ${HOME} local cd echo "$@" --verbose ${HOME} -eu local x=1 $(pwd)
+		printf printf echo && awk
+		/usr/bin 2>/dev/null /usr/bin ${HOME} && readonly grep
+		/usr/bin export local awk
+		sed echo grep 'quoted text'
+	'quoted text' $(pwd) echo /usr/bin x=1 "$1" readonly --verbose echo --verbose grep
+		"$@" | export sed ${HOME} | awk export
+	--verbose "$@" then -eu sed then test | ${HOME}
+		test 2>/dev/null export grep "$@" local -eu && $(pwd) printf -eu
+		cd 'quoted text' cd export |
+		'quoted text' echo x=1 cd then test 'quoted text' 'quoted text' local 2>/dev/null
+	--verbose ${HOME} "$@" x=1 --verbose -eu -eu | printf $(pwd) 'quoted text'
+		--verbose cd cd "$1" export --verbose awk /usr/bin grep 'quoted text' 'quoted text'
+readonly test cd grep readonly /usr/bin
+	test "$1" "$1" local local local done &&
+cd ${HOME} /usr/bin export
+	echo cd && echo done 2>/dev/null cd echo grep | && x=1 then 2>/dev/null
+echo test "$@" 2>/dev/null then | 'quoted text'
+	'quoted text' awk ${HOME} cd grep | awk 'quoted text'
+	export ${HOME} test -eu then awk && ${HOME} echo | /usr/bin --verbose
+	local echo /usr/bin test | x=1 'quoted text' readonly --verbose -eu 2>/dev/null
+"$1" echo export then 2>/dev/null 2>/dev/null cd --verbose "$@"
+	printf "$1" test cd | cd sed | 2>/dev/null
+/usr/bin -eu x=1 grep awk 2>/dev/null test "$1" echo /usr/bin "$1"
+	printf done done x=1 'quoted text' readonly readonly 'quoted text' cd test $(pwd)
+		"$1" test && | 'quoted text' echo readonly sed done 'quoted text' x=1
+		-eu then local "$@" then done "$1" x=1 then 'quoted text' | 2>/dev/null
+	cd $(pwd) cd done x=1 "$1" "$1" printf
+--verbose 2>/dev/null 'quoted text' | -eu then /usr/bin x=1 $(pwd)
+/usr/bin 'quoted text' x=1 -eu grep sed 'quoted text'
+/usr/bin local cd x=1 readonly
+		--verbose 'quoted text' awk ${HOME}
+	2>/dev/null $(pwd) /usr/bin
+"$1" then && export ${HOME} ${HOME}
+	| $(pwd) local echo x=1 export test sed -eu -eu done "$@" --verbose grep
+		"$@" local 'quoted text' printf test | test "$1" -eu
+	echo 2>/dev/null --verbose test
+	readonly done done "$1" printf
+		--verbose test done --verbose printf
+| $(pwd) done echo then /usr/bin done
+"$1" awk sed /usr/bin /usr/bin | awk done sed export awk export
+	2>/dev/null && x=1 cd ${HOME}
+	$(pwd) export "$1" then export x=1 awk test /usr/bin $(pwd) "$1"
+#include c173.sh
+&& 2>/dev/null -eu --verbose grep
+		2>/dev/null 2>/dev/null /usr/bin awk | printf local 'quoted text' "$@" done
+${HOME} printf -eu ${HOME} grep "$@" test test echo
+		${HOME} | test awk x=1 /usr/bin
+		cd | echo /usr/bin | "$@" 2>/dev/null 2>/dev/null
+		--verbose test x=1 export
+		&& x=1 "$@" awk ${HOME} | readonly
+		local cd cd done ${HOME} sed test x=1 grep "$@" /usr/bin printf
+	&& sed awk local test local $(pwd) echo -eu test 2>/dev/null
+		awk cd sed sed test "$1"
+		"$@" "$1" grep test "$@"
+x=1 /usr/bin done then 2>/dev/null
+		"$@" cd --verbose -eu local printf
+	x=1 2>/dev/null $(pwd) | && x=1
+	then "$1" --verbose export cd | $(pwd) test
+	-eu export then sed ${HOME}
+&& sed && -eu local ${HOME} && 2>/dev/null awk "$@" --verbose
+		"$1" echo 2>/dev/null 2>/dev/null $(pwd) x=1
+grep $(pwd) && export -eu x=1 grep then "$@" ${HOME} cd printf
+	test $(pwd) grep local grep -eu 'quoted text'
+		| grep printf --verbose "$@" ${HOME} then printf ${HOME}
+	/usr/bin test 2>/dev/null export printf then done /usr/bin
+		/usr/bin x=1 printf && -eu | sed &&
+	--verbose test cd echo done "$@" 'quoted text'
+/usr/bin 'quoted text' -eu grep --verbose then then /usr/bin ${HOME}
+"$@" $(pwd) echo ${HOME} awk | | 'quoted text' readonly
+	sed -eu echo | --verbose local -eu done then
+"$1" sed "$@" "$1" readonly test 'quoted text'
+printf grep $(pwd) x=1 sed export
+'quoted text' printf && grep x=1 2>/dev/null readonly local 'quoted text' awk then
+		done 2>/dev/null local && cd test "$@" done 'quoted text' local sed 2>/dev/null
+		test awk readonly awk | export export /usr/bin
+	echo sed readonly "$1" done
+	test ${HOME} $(pwd) x=1 ${HOME} 2>/dev/null test readonly test cd /usr/bin
+		then done && ${HOME} "$1" --verbose "$1" /usr/bin test test
+	done done printf done export 2>/dev/null
+		&& echo then done printf "$1" local "$1" printf done 2>/dev/null "$1"
+echo ${HOME} "$@" cd export 'quoted text' export 2>/dev/null awk printf
+x=1 done 2>/dev/null 'quoted text'
+	x=1 grep -eu 2>/dev/null done awk ${HOME}
+-eu -eu | "$1" 'quoted text' export "$@" cd readonly 2>/dev/null $(pwd) -eu then
+		"$1" done done export awk sed | export "$@" readonly "$1" | "$@" cd echo 2>/dev/null
+--verbose sed export awk | awk
+$(pwd) 'quoted text' test --verbose cd $(pwd) ${HOME} awk && cd /usr/bin
+&& sed printf printf local /usr/bin | grep
+		${HOME} test x=1 sed local export readonly sed local ${HOME} -eu done
+		-eu awk 2>/dev/null then "$1" && 2>/dev/null
+"$@" export cd && /usr/bin -eu cd --verbose 2>/dev/null done awk
+	$(pwd) echo --verbose && readonly
+		printf local $(pwd) -eu awk --verbose $(pwd) grep ${HOME}
+	${HOME} x=1 "$1" cd x=1 sed then $(pwd) echo
+	readonly then done grep export
+| "$@" /usr/bin readonly $(pwd) 'quoted text' grep $(pwd) echo then
+		sed printf ${HOME} -eu sed "$@"
+	then local ${HOME} local ${HOME}
+/usr/bin grep /usr/bin $(pwd) done x=1 then awk done 'quoted text'
+		grep $(pwd) then printf then "$@" "$@" /usr/bin "$1" grep
+		"$1" export sed /usr/bin grep
+	--verbose export readonly /usr/bin grep sed readonly
+		--verbose grep | | readonly ${HOME} -eu test 2>/dev/null ${HOME}
+		cd 'quoted text' readonly "$@" ${HOME} --verbose awk done export /usr/bin
+	$(pwd) cd cd --verbose test then "$1" x=1 done local readonly | $(pwd) export test
+	sed printf cd 2>/dev/null ${HOME} /usr/bin grep sed
+		cd "$1" "$1" echo grep awk
+"$@" 2>/dev/null done local && $(pwd) x=1 "$@"
+	test test ${HOME} printf 2>/dev/null done
+		export x=1 readonly 'quoted text' cd sed | export
+		--verbose "$1" then "$@" /usr/bin 'quoted text' printf
+-eu then $(pwd) local local
+		awk -eu awk -eu -eu | then test && local awk ${HOME} done cd 'quoted text'
+		done done then 2>/dev/null readonly sed readonly printf local $(pwd) --verbose
+		sed awk local printf $(pwd) awk echo then cd local
+| ${HOME} 'quoted text' ${HOME} readonly ${HOME} /usr/bin "$1" echo then printf
+	--verbose sed sed printf export /usr/bin readonly export test 'quoted text'
+awk printf | sed printf ${HOME} /usr/bin
+$(pwd) /usr/bin x=1 done "$1" done "$@" sed awk 2>/dev/null
+"$@" ${HOME} && done | ${HOME} 'quoted text' && "$1" then "$1" &&
+/usr/bin | echo echo /usr/bin cd sed 2>/dev/null test 'quoted text' ${HOME} x=1
+	'quoted text' && -eu cd $(pwd) 'quoted text'
+		done | test local echo local awk sed "$1" then export 2>/dev/null export
+		readonly done test printf echo local
+	printf "$1" ${HOME} --verbose
+		&& then /usr/bin 'quoted text' | cd export awk export "$@" --verbose export --verbose
+		/usr/bin "$1" local echo echo /usr/bin | 'quoted text' -eu $(pwd) done && 'quoted text'
+	x=1 2>/dev/null test -eu /usr/bin readonly
+	${HOME} cd && /usr/bin sed 2>/dev/null --verbose 2>/dev/null
+	awk sed 2>/dev/null | 'quoted text' printf /usr/bin /usr/bin sed local cd
+	echo readonly readonly $(pwd) /usr/bin echo --verbose cd export sed && x=1 && echo
+/usr/bin echo readonly | readonly grep ${HOME}
+sed local grep ${HOME} x=1 2>/dev/null printf && test
+		${HOME} printf export done echo 2>/dev/null readonly
+		then && done awk 'quoted text' echo /usr/bin awk cd test -eu && local $(pwd)
+		${HOME} -eu local $(pwd) done "$1" grep ${HOME} test && ${HOME} sed ${HOME}
+	echo local /usr/bin awk --verbose $(pwd) local readonly sed cd
+		$(pwd) $(pwd) && /usr/bin -eu
+/usr/bin && export -eu "$1" | -eu readonly sed
+		awk "$@" echo ${HOME} printf -eu grep printf
+		printf sed && export $(pwd) x=1
+	"$@" echo && cd done --verbose grep --verbose | $(pwd) ${HOME} then 'quoted text'
+	readonly "$1" test cd $(pwd) readonly /usr/bin
+grep cd /usr/bin done sed export then -eu "$1" 'quoted text' cd awk "$@"
+test ${HOME} echo --verbose -eu | sed test $(pwd) 'quoted text' $(pwd)
+		cd /usr/bin "$@" --verbose --verbose 'quoted text' local
+"$1" local echo grep readonly "$1" 2>/dev/null then /usr/bin printf x=1
+done local 2>/dev/null done readonly done echo "$@" 'quoted text'
+	/usr/bin grep sed /usr/bin 2>/dev/null test | sed "$1" then sed
+done && | "$1" 2>/dev/null awk grep
+	test readonly cd sed cd awk grep "$1" --verbose
+grep x=1 awk --verbose && | --verbose awk --verbose
+		| cd export -eu "$@" test /usr/bin ${HOME}
+		&& then $(pwd) grep 2>/dev/null echo /usr/bin /usr/bin -eu "$1" echo
+	${HOME} cd done 'quoted text' $(pwd) done export && "$1" sed export
+		| "$@" -eu /usr/bin export export
+local | done 2>/dev/null $(pwd) -eu test "$1" readonly
+		local $(pwd) ${HOME} awk "$@" printf
+		-eu --verbose "$1" echo done $(pwd) done $(pwd) -eu "$1" ${HOME} /usr/bin
+/usr/bin echo x=1 done "$1" "$@" then readonly /usr/bin local local
+		echo --verbose sed $(pwd) export 2>/dev/null "$1"
+		then awk then --verbose /usr/bin sed --verbose x=1 local grep
+local local 'quoted text' | export local 2>/dev/null -eu grep test readonly printf
+2>/dev/null 2>/dev/null "$1" "$@" echo readonly test readonly echo awk /usr/bin
+	'quoted text' ${HOME} echo readonly 'quoted text' "$@"
+	&& 2>/dev/null then awk 'quoted text'
+		2>/dev/null awk | awk --verbose test 2>/dev/null 2>/dev/null test | echo echo awk
+test sed echo printf /usr/bin awk printf -eu grep -eu then local |
+'quoted text' printf x=1 | "$1" "$@" | -eu
+| --verbose ${HOME} cd cd test /usr/bin --verbose
+	awk 2>/dev/null done --verbose
+	"$1" "$@" then /usr/bin sed -eu /usr/bin "$@" sed "$@" readonly readonly 2>/dev/null
+		2>/dev/null printf "$1"
+		&& --verbose done local test ${HOME} test
+	test $(pwd) awk ${HOME} local x=1 echo && printf --verbose then
+"$1" echo echo && grep cd 2>/dev/null grep && && "$@"
+printf echo readonly export x=1 export "$@"
+	sed local "$1" ${HOME} test x=1 ${HOME} echo ${HOME} awk 'quoted text' /usr/bin
+		${HOME} export readonly | grep
+	2>/dev/null "$1" export printf "$@"
+	/usr/bin /usr/bin 2>/dev/null
+	awk --verbose 'quoted text' $(pwd) cd -eu export -eu printf
+		local sed && then | grep done then | | && -eu echo local
+	cd printf 2>/dev/null && then test "$@" && ${HOME} -eu local /usr/bin "$1" |
+awk cd "$1" --verbose test -eu awk printf sed "$1" done 2>/dev/null --verbose
+		${HOME} | "$@" $(pwd)
+grep x=1 && | done $(pwd) grep readonly local
+		sed echo awk cd export readonly x=1 local export --verbose local
+		cd x=1 readonly echo test then done $(pwd) $(pwd) export
+		cd local then "$1" 'quoted text' export readonly
+		${HOME} x=1 echo $(pwd) $(pwd)
+		"$@" --verbose -eu /usr/bin 2>/dev/null /usr/bin x=1 'quoted text'
+		test 2>/dev/null 'quoted text' awk -eu
+		2>/dev/null --verbose x=1 printf $(pwd) then test test then grep "$@" sed echo
+$(pwd) printf then "$1" export local
+		then local | -eu "$@" -eu -eu /usr/bin echo
+		local done local test done 'quoted text' 'quoted text'
+	x=1 $(pwd) "$@" /usr/bin echo | done | done test readonly x=1 awk export
+-eu sed /usr/bin 'quoted text' local $(pwd) -eu -eu /usr/bin
+	cd $(pwd) ${HOME} sed sed -eu sed readonly -eu grep
+	readonly cd 2>/dev/null readonly 'quoted text' test -eu cd export x=1 -eu
+	local readonly | awk printf -eu grep cd -eu cd done ${HOME} cd /usr/bin
+sed sed -eu echo 'quoted text' echo readonly
+		readonly done cd grep test 'quoted text'
+	printf test cd "$1" local
+	printf -eu "$1" -eu export "$1" readonly sed
+	${HOME} x=1 grep sed /usr/bin awk x=1 sed cd test --verbose readonly export
+	then sed | echo awk test ${HOME} printf "$@"
+		"$@" readonly done done 2>/dev/null sed local printf "$@" -eu done
+	-eu --verbose && --verbose
+/usr/bin -eu /usr/bin test local "$1" done $(pwd) "$1"
+		&& readonly done readonly -eu export grep printf "$@"
+	&& "$1" cd done "$1" readonly && cd $(pwd) cd test -eu test
+		2>/dev/null 2>/dev/null && printf "$1" cd "$@" | 'quoted text' cd
+		x=1 "$1" grep $(pwd) /usr/bin local ${HOME} done test local export 2>/dev/null
+readonly ${HOME} -eu printf && "$@" awk /usr/bin
+		awk ${HOME} done printf local 2>/dev/null --verbose readonly sed readonly "$@"
+	awk /usr/bin echo -eu 2>/dev/null && echo done cd then echo
+		grep 2>/dev/null "$1" done
+		/usr/bin 'quoted text' --verbose "$@" "$1" x=1
+	'quoted text' ${HOME} test then printf done -eu $(pwd) "$@" local |
+		cd then readonly 2>/dev/null "$1" awk $(pwd) cd "$@"
+-eu done "$@" test readonly 'quoted text' 'quoted text' then | grep
+	then x=1 --verbose && 'quoted text' then awk
+	"$@" ${HOME} cd then 'quoted text' grep echo "$1" --verbose awk printf
+	--verbose then --verbose | -eu x=1 then cd ${HOME}
+-eu then /usr/bin done /usr/bin /usr/bin $(pwd) test
+${HOME} -eu ${HOME} x=1 &&
+	then export awk local done done then sed -eu echo awk echo awk | local
+	/usr/bin echo echo readonly
+	local done "$1" "$@" export sed then
+2>/dev/null /usr/bin -eu grep $(pwd) grep
+echo /usr/bin local -eu awk $(pwd) then
+		${HOME} 'quoted text' $(pwd) awk ${HOME} readonly
+		then /usr/bin then | -eu echo 'quoted text'
+		cd x=1 ${HOME} && x=1 export "$@" 2>/dev/null 'quoted text' x=1
+	done then sed export "$1" sed 'quoted text' 2>/dev/null
+		grep -eu 'quoted text' | echo then
+		-eu $(pwd) -eu then awk export x=1 echo then grep printf | --verbose && "$@" 'quoted text'
+		grep | /usr/bin grep awk --verbose $(pwd) |
+		local export | cd 2>/dev/null 'quoted text' ${HOME} echo
+	"$@" readonly done --verbose sed 2>/dev/null
+	grep /usr/bin "$@" $(pwd) --verbose awk /usr/bin -eu sed done awk
+		awk ${HOME} grep /usr/bin --verbose readonly cd "$1" x=1 ${HOME}
+		'quoted text' readonly $(pwd) export sed sed sed 'quoted text' local awk "$1" 'quoted text'
+${HOME} "$@" 2>/dev/null grep local "$@" then sed "$@" 'quoted text'
+| $(pwd) grep grep 'quoted text'
+	cd /usr/bin -eu echo test --verbose test awk "$@"
+	done 'quoted text' echo $(pwd) /usr/bin
+| done /usr/bin export --verbose export grep printf test done $(pwd)
+		2>/dev/null sed test export printf | | cd x=1 sed
+		done printf /usr/bin grep test
+	export printf "$1" -eu export readonly readonly
+x=1 x=1 then 'quoted text' export echo cd "$1" $(pwd)
+local "$@" export 2>/dev/null
+echo export test echo $(pwd) $(pwd) then ${HOME} then sed test x=1 cd /usr/bin
+		echo sed then && -eu && done | then "$1" sed test
+		'quoted text' then test local test "$@" "$1" cd readonly
+awk cd 'quoted text' grep $(pwd) then 'quoted text' x=1 2>/dev/null done
+	${HOME} readonly awk 'quoted text' export
+printf "$@" -eu "$1" | then
+	"$@" x=1 && -eu x=1 /usr/bin 2>/dev/null
+	then && echo ${HOME} | done awk export grep test ${HOME} 2>/dev/null /usr/bin
+		-eu 2>/dev/null readonly 'quoted text'
+2>/dev/null grep 'quoted text' then /usr/bin awk && done
+test done && /usr/bin && "$1" then 2>/dev/null test |
+	&& 'quoted text' local local local --verbose
+		test cd readonly sed local echo
+		sed ${HOME} ${HOME} test echo "$@" then export awk | "$1" printf --verbose -eu awk
+cd done ${HOME} grep /usr/bin "$@" test sed echo $(pwd) test done
+	--verbose "$@" && && && awk $(pwd)
+		${HOME} -eu 'quoted text' readonly "$@" echo awk grep && done test readonly
+		"$1" 2>/dev/null then /usr/bin "$@"
+	cd done $(pwd) x=1 awk then cd "$1" grep awk ${HOME} /usr/bin local echo done
+	echo 'quoted text' grep echo $(pwd) | test 2>/dev/null "$1" --verbose local grep
+"$1" && test ${HOME} -eu local local sed cd 'quoted text'
+		2>/dev/null "$1" grep | 2>/dev/null sed printf /usr/bin ${HOME}
+awk done cd 'quoted text' sed printf
+	| cd | readonly cd cd echo readonly "$@" -eu $(pwd) x=1
+	-eu then done cd awk ${HOME} --verbose
+	export 2>/dev/null echo export sed && "$@" --verbose then $(pwd)
+2>/dev/null test test test echo -eu | sed "$1" sed
+		$(pwd) x=1 x=1 /usr/bin grep done readonly --verbose printf readonly -eu done then
+sed export "$@" grep grep printf 2>/dev/null && ${HOME}
+		echo --verbose ${HOME} x=1 grep 'quoted text'
+2>/dev/null x=1 awk done grep local ${HOME} && --verbose "$@" printf | then -eu
+		local /usr/bin "$1" echo | echo local && awk
+&& cd --verbose readonly "$1" /usr/bin x=1
+	readonly /usr/bin awk grep 'quoted text'
+	export ${HOME} $(pwd) 'quoted text' awk /usr/bin /usr/bin 'quoted text' "$1" sed
+test local printf echo done
+"$@" grep done -eu "$1" done --verbose --verbose $(pwd) | sed /usr/bin ${HOME}
+		"$1" 2>/dev/null | "$1" $(pwd) grep x=1
+done -eu awk echo sed x=1 export | echo "$1" 'quoted text'
+		x=1 sed sed export ${HOME} export $(pwd) cd export cd
+		then ${HOME} grep local awk then "$1" awk printf x=1 then
+$(pwd) readonly grep cd done local printf --verbose
+	test test sed "$1" local 'quoted text' && local $(pwd) export && local awk done
+local -eu test | ${HOME} | awk /usr/bin
+		readonly printf printf
+		done "$@" done ${HOME} export
+	x=1 sed | "$@" cd local awk
+	/usr/bin /usr/bin | echo "$@" -eu done awk "$1" 'quoted text' --verbose
+${HOME} sed "$1" | export cd 'quoted text'
+	export cd printf /usr/bin $(pwd) 2>/dev/null $(pwd) sed cd -eu echo export
+		grep 'quoted text' && -eu test done /usr/bin -eu sed local /usr/bin test awk awk
+	${HOME} export 2>/dev/null readonly cd | printf sed x=1 "$@"
+		'quoted text' 'quoted text'
+	"$@" --verbose 2>/dev/null "$1" sed 2>/dev/null awk ${HOME}
+	sed /usr/bin ${HOME} sed -eu local --verbose export grep 'quoted text'
+grep x=1 readonly grep done ${HOME} 2>/dev/null "$1" /usr/bin x=1 test
+'quoted text' "$1" test test then grep readonly -eu --verbose /usr/bin readonly
+"$@" 'quoted text' then then && "$1" 'quoted text' | /usr/bin x=1 sed grep x=1 cd
+		| printf readonly then -eu x=1
+awk | "$1" printf "$1" cd $(pwd)
+		-eu && awk grep "$@" echo then && done printf then readonly readonly
+	sed grep export awk "$@" awk awk 2>/dev/null ${HOME} 2>/dev/null
+		${HOME} x=1 test "$1" echo export readonly "$1" readonly sed printf sed
+		| sed 'quoted text' echo | readonly --verbose
+	${HOME} done sed x=1 'quoted text' "$@" readonly printf local /usr/bin $(pwd)
+		test local x=1 done sed "$@" test readonly grep cd readonly sed cd awk
+		echo && 2>/dev/null "$1" x=1 $(pwd) -eu test cd cd
+	--verbose awk then -eu $(pwd) awk test printf $(pwd)
+'quoted text' /usr/bin awk x=1 printf ${HOME} printf
+-eu 2>/dev/null awk $(pwd) cd grep sed /usr/bin
+	/usr/bin local | grep $(pwd) awk $(pwd) echo cd /usr/bin "$@" "$1" sed -eu $(pwd)
+${HOME} ${HOME} then 2>/dev/null ${HOME} x=1 cd --verbose x=1
+		grep $(pwd) ${HOME} readonly -eu then 'quoted text'
+	| test 'quoted text' awk readonly echo sed cd x=1 --verbose
+		export sed test "$@" 2>/dev/null | cd cd
+	"$1" 2>/dev/null --verbose readonly then | echo x=1 2>/dev/null ${HOME} 'quoted text'
+	&& awk ${HOME} cd printf && cd -eu "$@"
+	printf export --verbose done local 'quoted text' x=1 "$1" 'quoted text' sed
+		&& x=1 echo /usr/bin --verbose "$@" x=1 && --verbose "$@" export
+		test local grep 2>/dev/null "$1" readonly done && && -eu local &&
+sed awk 2>/dev/null printf sed
+		then x=1 "$@" printf then then awk sed -eu 2>/dev/null && 'quoted text'
+		done done x=1 && grep local --verbose
+	| 2>/dev/null 'quoted text' ${HOME} printf
+/usr/bin local local && cd then then --verbose 'quoted text'
+sed -eu awk $(pwd) "$@" && awk "$1" grep 'quoted text' && cd x=1 awk done
+	-eu "$@" grep --verbose grep && $(pwd) done test printf && ${HOME} "$@"
+		/usr/bin && local "$@" sed sed 'quoted text' readonly cd && /usr/bin
+test test 'quoted text'
+$(pwd) x=1 2>/dev/null echo ${HOME} awk local
+'quoted text' 2>/dev/null sed local echo local ${HOME}
+		readonly 'quoted text' | test "$1" grep
+	grep 'quoted text' 'quoted text' done --verbose done -eu done
+		done -eu done local x=1 grep $(pwd) /usr/bin --verbose
+local test done export 'quoted text'
+		$(pwd) then 2>/dev/null /usr/bin | 2>/dev/null
+		export 'quoted text' $(pwd) then readonly 'quoted text'
+	grep awk $(pwd) then 'quoted text'
+		'quoted text' ${HOME} x=1 export export printf "$@" readonly
+local awk printf local 2>/dev/null && -eu readonly && printf sed echo done printf
+readonly export --verbose 2>/dev/null done
+	export printf printf "$1" | echo x=1 $(pwd) local readonly export 2>/dev/null done
+readonly && "$1" echo sed "$1" 2>/dev/null x=1 done awk
+		done $(pwd) then cd printf echo ${HOME} "$@" test x=1 "$@" grep readonly
+done awk --verbose --verbose /usr/bin then
+		${HOME} 'quoted text' "$@" local $(pwd) -eu ${HOME} grep grep $(pwd) sed sed 2>/dev/null
+		"$1" /usr/bin local printf then 2>/dev/null "$1"
+"$@" 'quoted text' local /usr/bin grep | && ${HOME} /usr/bin done local readonly
+awk readonly test awk && /usr/bin awk | local /usr/bin done
+awk then grep -eu printf 'quoted text'
+		sed echo x=1 test then readonly done $(pwd)
+	done echo 2>/dev/null $(pwd) then cd "$@" then local --verbose 'quoted text'
+		test $(pwd) test x=1 then -eu | ${HOME} export grep echo export | printf ${HOME}
+		echo 'quoted text' -eu sed echo 2>/dev/null grep /usr/bin /usr/bin
+	printf "$1" readonly cd sed echo -eu then /usr/bin "$1" readonly 2>/dev/null
+	readonly then export --verbose "$@"
+-eu printf --verbose echo cd x=1
+local local echo test sed -eu x=1 grep printf /usr/bin done awk test "$@" echo readonly
+		local cd grep $(pwd) && "$1" sed readonly echo sed "$1" 2>/dev/null
+		awk --verbose test $(pwd)
+	| "$@" awk ${HOME} done echo cd ${HOME}
+		x=1 cd "$@" echo grep awk && "$1" ${HOME} done
+	-eu && -eu -eu ${HOME} && -eu
+	readonly --verbose && cd -eu then awk && 2>/dev/null done 2>/dev/null
+-eu local "$@" 2>/dev/null x=1 printf x=1 local "$1"
+	2>/dev/null 2>/dev/null printf --verbose 'quoted text' "$1" ${HOME} | awk done
+	test sed then awk grep x=1 && grep && "$1"
+		'quoted text' cd --verbose x=1 echo readonly export
+	test -eu | local "$1" then 'quoted text' && awk readonly
+--verbose sed -eu printf export 'quoted text'
+	"$@" | sed test 2>/dev/null cd then "$1" test printf 'quoted text'
+	x=1 echo | readonly | "$@" cd
+		x=1 test awk 2>/dev/null export echo sed x=1 grep /usr/bin "$@"
+		&& local then /usr/bin | cd export readonly "$@" 'quoted text' /usr/bin
+		awk done cd export | x=1 echo 2>/dev/null
+	grep test test then -eu sed 2>/dev/null readonly "$@" cd test
+		grep awk --verbose x=1 then readonly | $(pwd) ${HOME} local 'quoted text'
+| then 2>/dev/null grep test then -eu sed
+		awk cd sed -eu done x=1 -eu "$1" test local /usr/bin
+test done $(pwd) x=1 export x=1 local test sed /usr/bin then
+		printf "$@" sed && echo /usr/bin "$1" 'quoted text' "$@" | readonly grep ${HOME}
+echo "$@" && test readonly && export 2>/dev/null echo awk 2>/dev/null --verbose
+	x=1 sed awk $(pwd) then ${HOME} 2>/dev/null "$@" $(pwd)
+		cd echo 'quoted text' local printf test cd 'quoted text'
+| "$1" 'quoted text' 2>/dev/null 'quoted text'
+'quoted text' then grep x=1 local
+	-eu "$@" echo printf "$1" printf 'quoted text' ${HOME} ${HOME}
+	-eu cd local export export readonly --verbose
+		echo local | -eu "$1" x=1 grep printf awk awk | /usr/bin
+	done "$1" "$1" cd --verbose /usr/bin then
+		readonly 2>/dev/null cd ${HOME}
+		sed $(pwd) 2>/dev/null "$@" then 2>/dev/null
+cd | awk 2>/dev/null done -eu | 'quoted text' then echo awk "$1" /usr/bin
+	local local printf awk printf readonly
+x=1 /usr/bin && export -eu grep grep && 2>/dev/null 'quoted text' test cd --verbose
+	"$@" "$1" "$@" | then | then cd awk cd --verbose awk "$1" awk echo
+		readonly 2>/dev/null grep then local /usr/bin readonly /usr/bin -eu
+	--verbose then cd /usr/bin | $(pwd) 2>/dev/null export
+	2>/dev/null "$@" $(pwd) ${HOME} local then printf local 2>/dev/null local
+grep cd && ${HOME} /usr/bin $(pwd) "$1" grep "$@" 2>/dev/null "$@" local
+export sed --verbose test done cd "$@" $(pwd)
+	grep 'quoted text' local printf && && readonly sed then ${HOME} done $(pwd) &&
+'quoted text' -eu cd x=1 "$1" /usr/bin
+sed "$@" echo -eu export 2>/dev/null cd cd 'quoted text' echo
+${HOME} --verbose printf done x=1 --verbose awk --verbose readonly awk
+/usr/bin $(pwd) done /usr/bin
+'quoted text' && x=1 "$1" cd 'quoted text' -eu -eu then --verbose 2>/dev/null
+		x=1 then $(pwd) done 'quoted text' then echo
+'quoted text' cd export -eu --verbose
+		test cd awk then done grep echo done sed | x=1 printf
+sed echo then "$@" "$@" ${HOME} 2>/dev/null sed
+		"$@" "$@" then "$@" cd grep | grep --verbose
+"$1" export sed awk grep "$@" printf 'quoted text'
+--verbose awk export x=1 && then 2>/dev/null /usr/bin test --verbose local
+		test echo readonly ${HOME} test x=1
+		then x=1 "$1" 2>/dev/null echo then -eu 'quoted text'
+		&& then local grep done | printf
+		"$@" -eu && awk then grep $(pwd) 2>/dev/null --verbose x=1 $(pwd)
+		echo awk 2>/dev/null | ${HOME} then then local /usr/bin $(pwd) printf
+	$(pwd) -eu -eu -eu | $(pwd) "$@" readonly readonly
+| "$1" cd "$1" cd cd local 2>/dev/null
+	"$@" "$1" /usr/bin | echo | --verbose /usr/bin |
+	done "$@" then x=1 && sed
+	cd export 'quoted text' -eu -eu "$1" "$1"
+	'quoted text' "$1" printf echo ${HOME}
+		echo then x=1 awk "$1" ${HOME} echo test && $(pwd) -eu $(pwd) export -eu grep 2>/dev/null
+	local cd $(pwd) export done
+		sed "$@" printf | sed cd test done "$1"
+		local x=1 /usr/bin printf awk && test --verbose -eu -eu $(pwd) && | test
+	x=1 then 2>/dev/null 2>/dev/null
+	x=1 readonly awk readonly echo --verbose | sed awk
+		&& local -eu ${HOME} export test x=1 --verbose 2>/dev/null
+${HOME} && printf printf test
+	printf x=1 'quoted text'
+grep export done cd sed grep grep done local
+2>/dev/null | test 'quoted text'
+echo cd test "$1" awk ${HOME} && /usr/bin test then cd 2>/dev/null 2>/dev/null
+		/usr/bin && sed ${HOME} printf sed printf grep /usr/bin $(pwd) echo ${HOME}
+		'quoted text' && -eu 2>/dev/null echo "$@" readonly sed 'quoted text'
+		test 'quoted text' && grep then test cd --verbose ${HOME} readonly
+	| awk sed export -eu sed "$1" then echo x=1 $(pwd) x=1 ${HOME} readonly 2>/dev/null
+	printf test "$@" -eu "$1" /usr/bin
+	&& test readonly /usr/bin test local local --verbose 'quoted text'
+	test done -eu 2>/dev/null cd awk /usr/bin
+		2>/dev/null x=1 cd && local --verbose 'quoted text'
+"$1" 'quoted text' --verbose printf test export x=1 "$@" test
+		x=1 ${HOME} cd 2>/dev/null --verbose "$@"
+		export cd | cd printf local then sed export test && "$1" x=1 | --verbose cd 'quoted text'
+		sed printf grep 'quoted text'
+cd 'quoted text' echo
+printf sed grep x=1 test
+	"$1" 2>/dev/null "$@" $(pwd) echo local -eu printf && local $(pwd) local local
+		export 2>/dev/null grep 'quoted text' awk
+	"$@" sed "$@" | | && && && && printf $(pwd)
+'quoted text' "$@" $(pwd) grep "$@" "$@" cd grep awk 2>/dev/null
+	printf readonly $(pwd) /usr/bin test x=1 -eu local "$1" export $(pwd) printf &&
+		-eu --verbose test readonly sed awk grep
+		sed 2>/dev/null export ${HOME} -eu printf ${HOME} 'quoted text'
+		grep sed -eu -eu grep $(pwd) echo --verbose then 2>/dev/null "$@"
+/usr/bin && export then printf && "$1" "$@"
+echo done echo --verbose --verbose 'quoted text'
+		-eu -eu /usr/bin --verbose local "$1" --verbose
+	local sed export echo 'quoted text' 'quoted text' test awk x=1 test export
+	sed "$@" test sed x=1 sed $(pwd) x=1 -eu $(pwd) /usr/bin echo && --verbose done
+	'quoted text' && --verbose
+		| "$@" awk /usr/bin $(pwd) readonly "$@" && 'quoted text'
+	readonly -eu x=1 /usr/bin grep export echo cd $(pwd) test test --verbose
+		readonly 'quoted text' --verbose | test -eu readonly | --verbose --verbose
+	cd export awk "$1" export ${HOME} awk "$1" printf && ${HOME} && && echo
+"$@" --verbose | 'quoted text' -eu export
+		echo | /usr/bin "$@" test
+		test 2>/dev/null sed /usr/bin
+		awk | -eu test printf readonly done "$1" -eu && awk echo
+		sed echo 'quoted text' 'quoted text' export $(pwd) $(pwd) test grep x=1
+done grep printf 'quoted text' 2>/dev/null
+	2>/dev/null grep x=1 then export
+	| readonly printf done 2>/dev/null ${HOME} local readonly
+	done | local sed echo done 'quoted text' ${HOME} grep /usr/bin done
+		grep export echo --verbose --verbose readonly test && export local awk
+		2>/dev/null done | /usr/bin sed -eu 'quoted text' /usr/bin echo
+| printf x=1 readonly printf "$@" then awk 2>/dev/null && local "$1" /usr/bin
+	&& readonly test printf local
+awk then && 'quoted text' local --verbose | local "$1" echo ${HOME}
+	local echo --verbose
+${HOME} | /usr/bin test ${HOME} then ${HOME} /usr/bin cd then
+grep then sed && cd sed then /usr/bin export echo -eu | printf
+	sed x=1 cd readonly export ${HOME} test
+		export x=1 | grep local readonly test x=1 "$@" $(pwd) sed export | x=1
+	sed grep sed "$1" done $(pwd) 2>/dev/null
+printf 'quoted text' sed --verbose then echo sed ${HOME}
+		then grep --verbose 'quoted text' test && cd
+readonly awk -eu "$1" "$1"
+	-eu printf 'quoted text' 2>/dev/null $(pwd) export
+then --verbose test cd cd then /usr/bin
+/usr/bin readonly "$@" export 'quoted text' "$@" awk awk
+		readonly | sed test -eu test $(pwd)
+		echo echo grep cd test readonly awk 2>/dev/null -eu awk ${HOME} readonly
+printf 'quoted text' --verbose "$1" test x=1 sed && awk printf grep export
+	printf && done && "$1" /usr/bin cd /usr/bin test awk ${HOME} awk readonly echo
+		then ${HOME} && cd 2>/dev/null 'quoted text' local
+'quoted text' | --verbose | x=1 readonly readonly 2>/dev/null
+		local 'quoted text' && grep && && then readonly
+	"$1" 2>/dev/null awk /usr/bin
+	$(pwd) --verbose echo cd 2>/dev/null "$@" local 2>/dev/null grep
+		readonly awk "$1" sed then printf 'quoted text' 'quoted text'
+&& test local && ${HOME} local x=1 x=1 sed
+		local test $(pwd) readonly $(pwd)
+	'quoted text' export cd test
+		test && "$1" echo "$@" printf | /usr/bin "$@"
+-eu "$1" $(pwd) test test echo
+	"$1" --verbose --verbose "$1" $(pwd) "$1"
+		/usr/bin "$1" "$1" /usr/bin sed done ${HOME} grep -eu "$1" $(pwd)
+		"$@" 2>/dev/null && sed --verbose export then $(pwd) 2>/dev/null
+	done test printf /usr/bin && 'quoted text' then
+grep && "$@" printf --verbose awk "$@" echo awk echo local local
+		sed readonly -eu $(pwd) 'quoted text'
+	cd 2>/dev/null "$1" done grep local echo test local "$1" &&
+"$1" "$1" test test "$@" -eu /usr/bin --verbose
+2>/dev/null "$1" ${HOME} sed "$@" 2>/dev/null awk local awk local then --verbose
+		--verbose x=1 --verbose
+	then awk cd 'quoted text' $(pwd) local 2>/dev/null /usr/bin
+	"$1" grep grep 'quoted text' ${HOME} awk export printf done sed printf
+	| x=1 'quoted text' 'quoted text' awk
+export | -eu ${HOME} 'quoted text' awk ${HOME}
+--verbose awk --verbose --verbose cd x=1 awk --verbose
+	x=1 sed x=1 export $(pwd)
+		| sed awk done "$1" readonly --verbose then
+sed printf done "$@" -eu sed /usr/bin then
+	$(pwd) done ${HOME} && $(pwd) local $(pwd) cd done local test
+	done -eu --verbose ${HOME} -eu awk 'quoted text' readonly done "$1" 2>/dev/null
+grep /usr/bin ${HOME} then | awk
+	local $(pwd) then /usr/bin "$@" ${HOME} then $(pwd)
+-eu 2>/dev/null x=1 done export $(pwd) && sed awk cd echo && grep awk printf &&
+	| readonly export $(pwd)
+	2>/dev/null awk -eu done | | "$1" 2>/dev/null readonly "$1" ${HOME}
+export awk /usr/bin "$@" test x=1 $(pwd) -eu && | test | readonly test &&
+	"$1" sed export test readonly $(pwd) "$@" x=1 done awk 'quoted text' 2>/dev/null
+	x=1 export then --verbose
+	"$@" test $(pwd) done printf && --verbose cd -eu /usr/bin
+		'quoted text' "$@" cd "$@" readonly awk -eu then | 'quoted text'
+	printf $(pwd) printf /usr/bin export --verbose printf
+		echo export /usr/bin $(pwd) done local ${HOME} && /usr/bin sed done "$1" -eu
+	printf awk sed 'quoted text' done grep --verbose done $(pwd) 2>/dev/null --verbose
+	awk 'quoted text' done then awk ${HOME} && test /usr/bin then -eu "$@"
+done cd sed awk export ${HOME} export 'quoted text' then done readonly 'quoted text'
+	/usr/bin x=1 then $(pwd) done ${HOME}
+| | readonly readonly awk /usr/bin cd cd done
+	| $(pwd) ${HOME} 'quoted text' && "$@" 2>/dev/null
+	"$@" | && | awk x=1 readonly 'quoted text' && && x=1 local export sed printf
+	$(pwd) printf readonly --verbose 2>/dev/null && "$@"
+	/usr/bin /usr/bin printf |
+	readonly -eu | awk printf local "$1" readonly grep "$1" printf
+${HOME} 2>/dev/null --verbose /usr/bin 2>/dev/null sed then
+	-eu grep done awk local echo grep done export then $(pwd)
+		${HOME} "$1" && sed grep awk ${HOME} sed cd readonly done grep export "$1" local
+		printf 2>/dev/null awk 2>/dev/null local &&
+	awk x=1 printf grep --verbose $(pwd)
+	x=1 -eu test "$1" && ${HOME} x=1 sed cd | -eu | cd then awk cd echo export
+cd $(pwd) -eu export readonly echo | local echo x=1 awk local printf "$@" "$1"
+		/usr/bin $(pwd) "$@" /usr/bin "$1" sed | --verbose
+	"$1" done sed awk $(pwd) export readonly
+x=1 --verbose 'quoted text' 'quoted text' 2>/dev/null 2>/dev/null
+sed x=1 then grep && "$1" /usr/bin grep x=1 test sed cd printf
+	--verbose readonly 'quoted text' echo printf
+	local && 2>/dev/null export 2>/dev/null then
+'quoted text' 2>/dev/null readonly 'quoted text' | 'quoted text' -eu ${HOME}
+	"$1" | then sed x=1 test
+-eu 'quoted text' "$1" ${HOME} printf /usr/bin $(pwd)
+done printf export echo ${HOME} && cd printf --verbose "$@" --verbose
+	&& /usr/bin $(pwd) 2>/dev/null export | test $(pwd) cd x=1
+2>/dev/null 2>/dev/null /usr/bin local printf "$@"
+sed test -eu /usr/bin 2>/dev/null
+	awk 'quoted text' grep
+${HOME} "$@" sed $(pwd) | "$@" readonly sed then
+		awk x=1 readonly | ${HOME} grep && 'quoted text' --verbose 2>/dev/null
+	$(pwd) -eu 2>/dev/null 'quoted text'
+	grep -eu sed sed test cd -eu
+sed && done | x=1 2>/dev/null 2>/dev/null
+	cd cd done $(pwd) 2>/dev/null then "$@" echo 'quoted text' printf "$1" 'quoted text'
+'quoted text' local export local "$@" then cd "$@" awk awk awk export
+echo && "$@" test awk printf -eu export ${HOME} --verbose 2>/dev/null ${HOME}
+		cd $(pwd) awk && 'quoted text' ${HOME}
+		"$@" $(pwd) "$1" | --verbose /usr/bin
+-eu echo /usr/bin $(pwd) && $(pwd)
+export "$1" 'quoted text' "$@"
+$(pwd) sed then sed done local test done | 'quoted text' export readonly then
+		readonly echo $(pwd) && awk 'quoted text' grep then echo printf -eu
+	--verbose 2>/dev/null printf /usr/bin
+	export x=1 done export echo 2>/dev/null test
+awk grep printf done test "$1" "$@" readonly x=1 $(pwd) printf && "$1"
+awk test "$1" echo "$@" grep -eu test
+x=1 'quoted text' x=1 2>/dev/null "$@" ${HOME} $(pwd) local printf 2>/dev/null
+test printf $(pwd) cd && 2>/dev/null 2>/dev/null | | readonly x=1 cd then local
+	/usr/bin test done ${HOME} printf then cd "$@" -eu echo readonly
+cd local 'quoted text' x=1 ${HOME} echo /usr/bin | -eu printf printf "$@"
+		export done sed x=1 cd x=1 awk x=1 printf $(pwd)
+${HOME} $(pwd) && awk export echo "$@" | $(pwd) then | "$@" | x=1 export test
+		echo sed local test 2>/dev/null "$@" test cd "$@"
+	${HOME} ${HOME} | test readonly $(pwd) "$@" 'quoted text' cd x=1 'quoted text'
+"$1" "$1" $(pwd) sed /usr/bin echo ${HOME} 'quoted text' 2>/dev/null
+-eu -eu grep printf && echo ${HOME} "$1" | export "$@"
+		&& "$1" "$@" "$@" sed ${HOME} printf export ${HOME} 'quoted text' -eu -eu
+	--verbose local -eu 'quoted text' grep "$1" x=1 /usr/bin local
+printf --verbose cd $(pwd) then ${HOME} 2>/dev/null 'quoted text' cd export
+	cd "$1" echo -eu echo -eu /usr/bin $(pwd) "$@" export cd && cd x=1 printf printf
+		2>/dev/null awk "$@" sed -eu done grep echo /usr/bin
+		sed -eu done && "$@" done awk x=1 local export sed grep ${HOME} -eu grep
+x=1 export $(pwd) && awk test /usr/bin awk ${HOME} $(pwd) ${HOME}
+		export done awk readonly x=1
+		$(pwd) 'quoted text' 'quoted text' "$@" awk x=1 $(pwd) then local "$@"
+		| local ${HOME} export && | sed readonly echo --verbose test readonly
+	'quoted text' /usr/bin done 2>/dev/null test test cd local /usr/bin
+2>/dev/null 2>/dev/null /usr/bin export then readonly done
+	/usr/bin export | grep --verbose 'quoted text'
+awk "$@" cd --verbose $(pwd)
+	"$1" "$1" then --verbose done --verbose printf
+&& -eu grep -eu cd "$1" | --verbose printf cd ${HOME}
+	x=1 -eu echo printf /usr/bin export
+	'quoted text' done 2>/dev/null
+	/usr/bin grep printf -eu 'quoted text' sed echo awk
+	&& export local && sed "$1" 2>/dev/null
+		--verbose "$@" "$@" -eu x=1 /usr/bin x=1 test done
+		local --verbose grep "$1" --verbose
+		grep -eu readonly | test /usr/bin local 2>/dev/null printf
+		readonly then --verbose sed "$@" cd done cd echo then
+	cd readonly awk "$@" readonly --verbose sed /usr/bin printf
+	then done && export && printf local --verbose x=1 printf printf then "$@"
+		"$@" "$1" cd | -eu readonly | printf "$1" /usr/bin printf --verbose awk grep
+sed 'quoted text' "$@" cd $(pwd) | cd 2>/dev/null
+	sed printf ${HOME} $(pwd) export printf
+	| -eu /usr/bin ${HOME} local | | 'quoted text'
+		cd grep test grep local
+	/usr/bin readonly test 2>/dev/null $(pwd) x=1 test done then ${HOME}
+	printf | done local $(pwd) sed awk local
+		/usr/bin test $(pwd) readonly done then readonly awk cd /usr/bin
+		local && test sed readonly readonly && awk | "$@" grep awk 'quoted text'
+	${HOME} readonly then -eu | "$1"
+	"$@" done sed readonly test sed printf /usr/bin -eu test ${HOME} export export
+	cd readonly grep echo ${HOME} then "$@" grep
+		| readonly "$@" readonly "$1" done --verbose echo
+2>/dev/null 2>/dev/null "$1"
+sed ${HOME} then "$@" readonly ${HOME} && --verbose then -eu printf $(pwd) sed export
+$(pwd) | /usr/bin "$@" export printf ${HOME} "$1" printf
+${HOME} -eu x=1 local --verbose -eu /usr/bin "$@" $(pwd) awk awk cd /usr/bin
+x=1 cd -eu 2>/dev/null ${HOME} && test grep
+	done readonly echo sed done -eu export
+	"$1" --verbose test 2>/dev/null readonly export local
+	'quoted text' /usr/bin /usr/bin | local local test
+		then sed local "$@" -eu
+		local 'quoted text' then 'quoted text' -eu
+		printf "$1" $(pwd) awk $(pwd) awk readonly 'quoted text' ${HOME} "$@"
+	| 'quoted text' printf test --verbose
+		sed 'quoted text' $(pwd) --verbose /usr/bin $(pwd)
+done 'quoted text' "$@" sed x=1 --verbose
+		2>/dev/null "$1" echo grep "$@" ${HOME} then awk -eu echo readonly "$1" done
+	$(pwd) local "$1" "$1" awk printf
+		$(pwd) done -eu then /usr/bin sed grep grep --verbose export x=1 readonly readonly
+		| printf readonly && readonly printf
+	echo x=1 x=1 x=1 "$1" --verbose -eu sed
+	readonly awk $(pwd) done readonly test 'quoted text'
+$(pwd) | 2>/dev/null awk 'quoted text' --verbose awk && awk readonly /usr/bin
+		awk | sed 'quoted text' ${HOME} readonly cd && local
+		cd 'quoted text' --verbose local readonly printf
+		${HOME} sed grep printf cd echo local readonly 'quoted text' export $(pwd) readonly
+	$(pwd) awk x=1 $(pwd) local echo awk 2>/dev/null then 'quoted text'
+		x=1 $(pwd) then "$1" 'quoted text' awk then ${HOME} 'quoted text' grep "$1"
+		"$1" awk grep export grep $(pwd) export /usr/bin --verbose "$1" done "$1" | |
+	/usr/bin readonly grep export done
+	x=1 cd "$1" then local readonly
+readonly 'quoted text' test
+printf readonly "$@" /usr/bin local
+		then "$1" cd ${HOME} x=1 local then "$1" && | cd grep
+"$@" 'quoted text' "$@" test
+	cd done 'quoted text' ${HOME} /usr/bin export --verbose 'quoted text' ${HOME}
+$(pwd) --verbose 'quoted text'
+	cd sed local -eu awk /usr/bin
+		done && --verbose "$1" /usr/bin export echo 2>/dev/null
+export readonly ${HOME} echo -eu | -eu done 2>/dev/null
+	test grep 'quoted text' cd local test
+2>/dev/null grep | &&
+| awk | local echo sed /usr/bin 'quoted text' $(pwd) done --verbose
+		-eu echo /usr/bin 2>/dev/null
+	x=1 --verbose x=1 && then
+--verbose printf sed readonly "$1" -eu $(pwd) awk
+${HOME} /usr/bin then export echo sed cd done 'quoted text'
+'quoted text' 'quoted text' sed
+	$(pwd) | local local ${HOME} cd sed export cd test x=1 local
+then test echo grep 'quoted text'
+	"$@" local /usr/bin local then export
+readonly /usr/bin sed printf readonly
+		local sed done readonly echo test /usr/bin "$@"
+local cd "$1" local 2>/dev/null ${HOME} echo | 2>/dev/null
+	grep ${HOME} "$@" | grep /usr/bin grep local --verbose ${HOME} test sed echo printf
+		/usr/bin sed /usr/bin test $(pwd) | echo x=1 local echo sed cd printf |
+sed $(pwd) ${HOME} ${HOME} awk $(pwd) sed cd ${HOME} printf -eu ${HOME} -eu
+	"$1" "$1" sed "$1" x=1 -eu printf grep cd && echo readonly test test sed sed
+echo 'quoted text' 'quoted text'
+'quoted text' grep printf readonly ${HOME} export --verbose -eu test test "$@"
+		&& $(pwd) --verbose printf sed printf local $(pwd) "$@" readonly readonly --verbose
+	2>/dev/null grep | printf --verbose 'quoted text' /usr/bin sed 2>/dev/null -eu
+		awk done --verbose grep echo printf awk -eu printf 'quoted text'
+		test export --verbose /usr/bin awk local 'quoted text' readonly 2>/dev/null
+test "$1" sed 2>/dev/null echo "$@" local "$@" /usr/bin readonly export --verbose
+	&& x=1 export && "$@" done | sed | done export && --verbose done x=1
+x=1 sed /usr/bin test export then ${HOME} "$1"
+		x=1 ${HOME} awk readonly local awk "$1"
+		echo cd done echo /usr/bin x=1 'quoted text'
+cd "$1" --verbose then --verbose /usr/bin 2>/dev/null awk | 2>/dev/null
+	printf echo --verbose readonly ${HOME} local 2>/dev/null
+then echo awk grep ${HOME} $(pwd) test && | grep --verbose echo
+		local ${HOME} awk "$1" && cd 2>/dev/null done
+		${HOME} && printf /usr/bin then && ${HOME} cd test export
+		printf "$@" sed ${HOME} then $(pwd) local printf
+done sed readonly --verbose x=1 "$@" readonly echo
+| grep readonly x=1 | done
+		sed sed printf sed cd /usr/bin
+	printf x=1 grep export "$1" export
+	&& "$@" awk x=1 'quoted text' printf then "$1" local
+		grep "$1" "$@" x=1 then then $(pwd) 'quoted text'
+echo cd 'quoted text' grep test --verbose x=1 /usr/bin "$1" export $(pwd)
+	grep printf -eu readonly cd x=1 x=1
+$(pwd) "$1" test -eu test -eu readonly
+		readonly -eu ${HOME} grep
+		-eu x=1 awk local sed x=1 test "$1" cd
+		'quoted text' readonly "$1" "$1" echo -eu | x=1 echo
+		-eu && "$@" printf test "$@" $(pwd) "$@" printf 'quoted text'
+		| printf ${HOME} then | && grep grep test | | cd grep
+	"$1" then echo done readonly awk awk -eu "$1" 'quoted text'
+		x=1 done ${HOME} grep /usr/bin
+		local done 2>/dev/null grep sed "$@" /usr/bin /usr/bin
+	$(pwd) export test x=1 awk printf
+'quoted text' ${HOME} sed grep "$1" -eu done
+	printf done sed "$@" x=1 export ${HOME} --verbose
+		sed 2>/dev/null --verbose
+	printf export awk /usr/bin /usr/bin $(pwd) export
+	"$1" $(pwd) | then -eu test 2>/dev/null x=1 awk echo "$@" "$@" 'quoted text' /usr/bin
+-eu ${HOME} printf 2>/dev/null "$1"
+		readonly export --verbose
+2>/dev/null readonly local -eu "$@"
+test "$@" cd test | readonly && echo sed readonly
+		awk --verbose awk export ${HOME} x=1 "$@" | ${HOME} local then ${HOME} echo
+		cd --verbose x=1 && 2>/dev/null "$1"
+	${HOME} sed local ${HOME} && cd
+local | ${HOME} x=1 awk printf
+printf /usr/bin 'quoted text'
+then printf --verbose sed echo 2>/dev/null -eu 2>/dev/null
+&& x=1 done then 2>/dev/null | ${HOME} done cd readonly 2>/dev/null echo
+	sed printf ${HOME} export printf test printf
+		| 'quoted text' -eu sed sed -eu readonly
+		-eu awk test "$1" readonly -eu local x=1 cd then grep then cd "$1" test |
+	x=1 export grep then && printf sed "$@" | awk 2>/dev/null readonly ${HOME}
+		x=1 local "$@" export ${HOME} sed sed printf sed 2>/dev/null
+2>/dev/null test sed awk ${HOME} && $(pwd) export
+		readonly done echo -eu sed test /usr/bin cd readonly "$@" then /usr/bin /usr/bin
+	| then cd echo printf -eu "$1" cd -eu then 'quoted text' /usr/bin local
+	cd && test --verbose ${HOME} local cd then x=1 -eu
+		done "$1" test --verbose /usr/bin
+		echo local -eu "$1" export "$@" ${HOME} -eu && readonly 'quoted text'
+		${HOME} && local readonly local "$1" $(pwd) echo printf ${HOME}
+local ${HOME} "$@" x=1
+		done sed cd local /usr/bin 'quoted text' 2>/dev/null done test done then export
+	/usr/bin local sed --verbose awk x=1 grep x=1 x=1 local then /usr/bin test ${HOME}
+	2>/dev/null export --verbose readonly 2>/dev/null printf --verbose -eu
+	readonly local "$1" export "$1" local $(pwd) $(pwd) | printf
+	local sed readonly "$1" then cd printf export
+	done local -eu | 'quoted text' --verbose --verbose
+	x=1 echo 2>/dev/null sed x=1 "$1" 'quoted text'
+&& --verbose done then && ${HOME} &&
+		-eu ${HOME} ${HOME} x=1 'quoted text' echo -eu --verbose
+export 2>/dev/null local
+		--verbose $(pwd) /usr/bin sed ${HOME} readonly 2>/dev/null "$@" printf
+awk sed local done test printf 2>/dev/null
+2>/dev/null printf then export "$1" 'quoted text'
+	$(pwd) echo 'quoted text' x=1 then && 'quoted text' | grep "$@" done readonly
+		2>/dev/null /usr/bin -eu "$1" export printf "$1" 2>/dev/null "$@" 2>/dev/null
+local local awk -eu readonly printf && "$1" echo then --verbose "$@" test
+done "$1" /usr/bin echo && --verbose awk echo $(pwd) readonly done $(pwd)
+awk readonly awk x=1 cd grep 2>/dev/null readonly
+	test echo then then /usr/bin -eu cd
+		cd /usr/bin done test "$1" local done printf
+	printf x=1 done --verbose grep
+		--verbose 'quoted text' then | --verbose readonly
+		awk readonly grep 'quoted text' 2>/dev/null
+"$1" /usr/bin && test && 2>/dev/null -eu -eu test test
+	awk local printf echo /usr/bin sed cd 2>/dev/null printf echo
+	$(pwd) awk "$1" -eu readonly "$@" grep done
+done "$@" "$1" export done -eu done /usr/bin done test sed done
+		2>/dev/null printf /usr/bin 2>/dev/null then local grep echo cd cd then "$@"
+sed $(pwd) 2>/dev/null $(pwd) export local local
+	test printf 2>/dev/null $(pwd) && awk 2>/dev/null x=1 $(pwd) | 'quoted text'
+		local grep printf printf $(pwd) "$@" then readonly then | then export
+		readonly cd local test local echo x=1 readonly
+		readonly local && printf awk 2>/dev/null readonly
+	printf ${HOME} && cd local export "$@" cd | done -eu export ${HOME} readonly
+'quoted text' then cd sed --verbose
+2>/dev/null local awk --verbose awk && ${HOME}
+	local done sed | ${HOME} 2>/dev/null printf | sed
+		awk "$1" sed cd && "$@" ${HOME} 'quoted text' grep
+	$(pwd) grep ${HOME} local cd | sed awk -eu "$1" "$@" local $(pwd) cd -eu /usr/bin
+		| /usr/bin $(pwd) grep awk export grep readonly ${HOME} ${HOME} awk --verbose
+echo sed 'quoted text' ${HOME} 2>/dev/null -eu export 2>/dev/null
+		&& --verbose cd x=1 echo && ${HOME} local --verbose
+	&& x=1 "$@" | test x=1 && grep test -eu readonly /usr/bin export
+		grep export grep done x=1 done | echo
+"$1" then && test printf local -eu -eu echo -eu $(pwd) local --verbose
+	test cd ${HOME} awk local readonly readonly grep local ${HOME}
+		export then test printf test "$@" done export
+	readonly local ${HOME} export
+printf readonly done "$1" awk --verbose 2>/dev/null "$@" 2>/dev/null
+then | ${HOME} x=1 $(pwd) echo done awk echo export "$1"
+x=1 local -eu x=1 then -eu | x=1 export awk
+		2>/dev/null sed test 'quoted text'
+	/usr/bin ${HOME} | "$@" $(pwd)
+	then cd /usr/bin then local ${HOME} 'quoted text' then test
+/usr/bin local awk done
+		readonly | x=1 $(pwd) && "$1" ${HOME}
+test awk 2>/dev/null && "$1" 2>/dev/null --verbose "$@" | /usr/bin /usr/bin && -eu
+	readonly $(pwd) 'quoted text' $(pwd) 2>/dev/null -eu
+	local cd local 'quoted text' then cd $(pwd)
+	cd ${HOME} x=1 | test --verbose then readonly
+		export then 'quoted text'
+	| awk cd | "$1" export ${HOME} $(pwd) grep 'quoted text'
+		'quoted text' sed "$1" x=1 awk ${HOME}
+		2>/dev/null readonly cd
+	'quoted text' echo 'quoted text'
+echo && printf export cd -eu local test
+		-eu sed then --verbose -eu printf printf done 2>/dev/null printf export
+		cd x=1 | -eu local then grep export printf local local
+	grep 'quoted text' done echo --verbose 'quoted text'
+		$(pwd) printf | --verbose "$@" done awk cd export test then readonly
+	"$@" then readonly "$1" --verbose cd printf
+done "$1" --verbose done
+then x=1 printf done "$@" cd sed
+		x=1 printf --verbose test 2>/dev/null
+	&& local 2>/dev/null ${HOME} sed x=1 x=1 ${HOME} $(pwd)
+--verbose $(pwd) grep printf | readonly
+${HOME} 'quoted text' echo cd grep grep printf grep
+then /usr/bin awk test x=1 | grep x=1 export then --verbose x=1 cd /usr/bin
+		local x=1 export printf --verbose $(pwd) sed done | then
+	| $(pwd) $(pwd) test /usr/bin readonly then --verbose x=1
+sed "$@" awk then grep local | grep $(pwd) done -eu echo $(pwd)
+		'quoted text' /usr/bin awk test /usr/bin ${HOME} 2>/dev/null | done readonly
+		export 'quoted text' $(pwd)
+	echo awk awk -eu echo x=1 done --verbose local readonly 'quoted text'
+	test -eu --verbose 2>/dev/null
+	-eu printf 'quoted text'
+$(pwd) $(pwd) sed local "$1" --verbose ${HOME} ${HOME} export /usr/bin
+cd grep sed && /usr/bin "$@" "$1" "$1" 'quoted text'
+export test then awk x=1 "$@" grep printf awk export cd --verbose
+	x=1 sed done "$1" export -eu readonly test "$1" ${HOME} /usr/bin printf
+$(pwd) 'quoted text' export ${HOME} grep
+$(pwd) readonly | export done --verbose sed grep | "$@" ${HOME} "$1" test
+	echo 'quoted text' && sed export printf "$@" sed sed && sed 'quoted text'
+	export cd "$@" x=1 2>/dev/null "$1" $(pwd) done --verbose local echo
+/usr/bin export "$@" && -eu | local export 'quoted text' | -eu
+		readonly "$@" x=1 sed 'quoted text'
+		2>/dev/null "$@" readonly readonly | export test
+	--verbose local "$@" sed -eu 2>/dev/null "$@"
+	| done /usr/bin cd /usr/bin ${HOME} --verbose
+sed echo then done test echo
+		local sed | "$@" --verbose $(pwd) cd 'quoted text' "$1" 'quoted text' 'quoted text'
+	'quoted text' done 2>/dev/null /usr/bin --verbose $(pwd) readonly
+	x=1 "$@" grep sed local 'quoted text' test $(pwd) --verbose grep
+	/usr/bin 'quoted text' ${HOME} local readonly
+		$(pwd) 'quoted text' test -eu printf --verbose
+	--verbose export "$@" cd test echo --verbose echo | test --verbose &&
+export echo /usr/bin grep x=1
+--verbose echo then local
+	echo echo 2>/dev/null cd printf awk then readonly
+		readonly --verbose && export ${HOME} export done test 2>/dev/null 2>/dev/null
+	done test "$1" x=1 grep && sed sed -eu export $(pwd) local readonly
+	"$@" sed echo printf -eu "$@" local /usr/bin test grep "$1" 2>/dev/null
+echo cd test cd /usr/bin
+export -eu sed cd /usr/bin --verbose sed 2>/dev/null
+-eu sed cd --verbose then done
+awk export /usr/bin echo grep ${HOME} x=1 export "$1"
+export awk printf "$1"
+		export done x=1 export -eu cd then grep cd grep x=1 "$1" test readonly --verbose
+--verbose export then --verbose then
+		x=1 && export ${HOME} "$1" "$1" sed export echo test then done local
+		x=1 awk -eu $(pwd) | done sed done && done 2>/dev/null
+"$@" | | cd "$@" x=1 local -eu
+	grep ${HOME} "$@" export
+-eu /usr/bin sed export $(pwd) "$1" readonly printf printf local "$@" | then printf
+	${HOME} awk then "$@" local 'quoted text'
+local && x=1 local /usr/bin done && export awk /usr/bin --verbose
+"$1" grep "$1" 2>/dev/null awk printf $(pwd) x=1 "$@" echo
+	2>/dev/null 'quoted text' | test local $(pwd) ${HOME} 2>/dev/null
+	grep --verbose 2>/dev/null then --verbose printf
+	2>/dev/null 2>/dev/null export cd printf printf "$1" && readonly printf
+		-eu awk awk 'quoted text' cd x=1 2>/dev/null sed -eu test readonly
+		"$@" "$1" /usr/bin && "$@" grep test "$1" local "$@" then
+${HOME} /usr/bin /usr/bin readonly readonly | ${HOME} 'quoted text'
+printf x=1 x=1 && "$1" printf readonly --verbose $(pwd) export export -eu echo
+${HOME} local cd readonly awk
+--verbose && test | cd sed && -eu
+		&& && --verbose "$1" grep local x=1 $(pwd)
+		x=1 awk && cd grep test -eu | $(pwd) -eu ${HOME} | /usr/bin sed
+grep "$@" x=1 -eu 2>/dev/null
+		grep done sed -eu cd -eu export awk done grep $(pwd)
+--verbose sed "$1" local ${HOME} echo readonly | 2>/dev/null "$1" "$@" readonly
+	'quoted text' readonly && echo 2>/dev/null ${HOME} 'quoted text'
+	&& readonly echo awk && test printf awk | done echo grep
+grep 2>/dev/null readonly
+export | "$1" 'quoted text' x=1 && readonly then 'quoted text' cd ${HOME}
+	export test $(pwd) done /usr/bin x=1 | x=1 --verbose sed $(pwd) readonly
+		printf --verbose local /usr/bin export cd "$@" cd export done awk
+	"$@" -eu ${HOME} done test "$1" ${HOME} 'quoted text' printf awk "$@" export
+		cd cd | cd --verbose $(pwd) 2>/dev/null done
+	/usr/bin printf local cd
+		--verbose done readonly cd export $(pwd) grep $(pwd) 2>/dev/null
+	2>/dev/null readonly then then done &&
+		/usr/bin export "$@" -eu then "$1" "$@"
+	-eu export -eu then ${HOME} printf 'quoted text' &&
+| awk echo awk "$@" readonly readonly
+		| $(pwd) done $(pwd) grep "$1" "$1"
+		awk grep test "$1" x=1 | 2>/dev/null test local
+done done printf sed sed then x=1 /usr/bin cd cd x=1 -eu awk readonly
+| "$1" readonly test "$@"
+	then $(pwd) export readonly readonly done grep test cd /usr/bin then
+		done sed | export x=1 awk | 2>/dev/null /usr/bin done 2>/dev/null
+		| test | done "$1" readonly
+		${HOME} then awk 'quoted text'
+	'quoted text' export test test 'quoted text' echo echo
+	x=1 x=1 grep local local readonly 'quoted text' $(pwd) "$1" $(pwd) test $(pwd)
+		local 2>/dev/null x=1 x=1 "$1" "$@" "$1" awk x=1 && x=1 awk printf printf "$1"
+done -eu x=1 ${HOME} echo 2>/dev/null && 2>/dev/null
+	local "$1" "$1" /usr/bin
+		export echo awk export "$@" -eu echo local sed $(pwd) $(pwd)
+	$(pwd) awk $(pwd) -eu awk "$@" -eu sed && readonly
+		awk --verbose local echo x=1 /usr/bin 2>/dev/null then printf
+	'quoted text' awk export then awk export
+		then -eu 'quoted text' /usr/bin cd "$@" cd 'quoted text' 2>/dev/null echo grep
+	| "$@" ${HOME} 2>/dev/null
+		awk done && local "$1" then local ${HOME} export test printf echo -eu local
+		/usr/bin 2>/dev/null awk
+	"$@" sed awk 2>/dev/null "$@" && test echo echo "$1" x=1 $(pwd) local
+		echo cd local echo | sed ${HOME}
+		cd test awk 'quoted text' "$1" cd --verbose x=1 echo
+'quoted text' "$1" local | then local ${HOME} local test 2>/dev/null
+&& cd "$@" awk readonly ${HOME} cd printf test sed &&
+	&& echo "$1" x=1 done cd echo then local
+		| && "$@" -eu local then $(pwd) echo local test "$@" $(pwd) cd --verbose
+	export "$1" done -eu | --verbose readonly readonly readonly x=1 "$1" test
+	echo --verbose echo /usr/bin done 2>/dev/null
+	then && test x=1 "$1" awk -eu grep done local 2>/dev/null "$1" test done
+	'quoted text' 'quoted text'
+x=1 done awk export done /usr/bin printf 2>/dev/null &&
+		export 'quoted text' readonly awk 2>/dev/null "$1" local 'quoted text'
+2>/dev/null $(pwd) | -eu ${HOME} -eu 'quoted text' done printf
+		test then | export ${HOME} --verbose
+	-eu 'quoted text' local local test ${HOME} "$@"
+		awk local awk "$1" awk 2>/dev/null --verbose printf echo --verbose done grep
+		then printf done | done local local readonly $(pwd) then export done
+	$(pwd) -eu cd | local /usr/bin then --verbose
+	${HOME} x=1 $(pwd) /usr/bin sed "$@" | 'quoted text' ${HOME}
+	| x=1 | --verbose local "$@" -eu | awk awk |
+	done -eu /usr/bin then $(pwd) 'quoted text' then readonly | grep
+	sed 2>/dev/null x=1 then local test echo cd --verbose | ${HOME} test cd
+	export /usr/bin --verbose 2>/dev/null
+2>/dev/null sed /usr/bin grep ${HOME} && "$1" $(pwd) "$@" | test
+	-eu printf 2>/dev/null awk done printf export $(pwd) grep 2>/dev/null
+	--verbose test | /usr/bin sed --verbose export
+		readonly then --verbose /usr/bin $(pwd) | "$1" 2>/dev/null /usr/bin readonly 2>/dev/null
+&& echo then echo done echo "$@" sed --verbose echo
+'quoted text' /usr/bin readonly 2>/dev/null
+then | echo local /usr/bin 'quoted text'
+		test 2>/dev/null 2>/dev/null done /usr/bin
+		2>/dev/null done echo "$@"
+		awk $(pwd) awk --verbose
+		printf echo "$@" then x=1 local -eu printf cd -eu
+		cd printf -eu cd awk awk sed x=1 'quoted text' export "$1"
+		$(pwd) "$1" export test -eu export grep -eu -eu /usr/bin awk echo 2>/dev/null
+	export readonly sed "$1" awk export $(pwd) test readonly cd "$@"
+	| "$1" then test ${HOME} done
+		done grep 2>/dev/null export local 2>/dev/null
+	echo export -eu && ${HOME} printf local test ${HOME} ${HOME} x=1
+	test local local awk 'quoted text' && --verbose && x=1 readonly && grep x=1 sed
+| "$@" x=1 then cd x=1 "$1" && $(pwd) done cd ${HOME}
+	printf sed test 'quoted text' /usr/bin grep
+	done then 'quoted text' printf
+readonly readonly /usr/bin
+		| sed echo done local -eu | | ${HOME} ${HOME} "$@"
+	2>/dev/null printf done export $(pwd) 2>/dev/null readonly readonly
+	test --verbose x=1 2>/dev/null
+--verbose ${HOME} && "$@"
+		--verbose ${HOME} readonly 2>/dev/null
+readonly x=1 readonly test /usr/bin done done awk /usr/bin sed grep local
+"$@" /usr/bin $(pwd) "$@" 'quoted text' "$1" awk test echo sed grep
+test "$@" grep done "$@" readonly grep export local "$@" && --verbose ${HOME}
+	export export cd awk awk "$@"
+test 'quoted text' "$@" --verbose --verbose && -eu
+"$@" | -eu x=1 then sed "$@" then "$@" readonly
+local && grep && "$@" sed echo
+		local ${HOME} x=1 && readonly then
+	cd x=1 -eu ${HOME} export awk then local
+		2>/dev/null done cd export export export
+	sed | done sed local ${HOME} && then /usr/bin | sed done done 2>/dev/null
+--verbose echo then x=1 export
+"$1" awk local cd echo "$@" test local then test printf
+x=1 'quoted text' awk "$@" ${HOME} ${HOME} awk then printf printf
+	2>/dev/null readonly 'quoted text' -eu
+		then "$1" export sed awk awk && local done x=1 "$@" 2>/dev/null
+		"$@" /usr/bin "$1" then | $(pwd) -eu grep "$1"
+	| done ${HOME} done export | readonly | then then 'quoted text' x=1 --verbose x=1
+		| echo then | 'quoted text'
+		--verbose /usr/bin /usr/bin "$1" "$@" "$@" done awk -eu /usr/bin grep
+		2>/dev/null "$1" "$@" test --verbose /usr/bin test
+${HOME} --verbose /usr/bin $(pwd) export then /usr/bin -eu test
+awk printf then --verbose 2>/dev/null
+		grep x=1 x=1 x=1 'quoted text' test test
+echo && x=1 | --verbose
+	&& /usr/bin && cd local then && test --verbose "$1"
+		then done sed | -eu readonly printf sed printf grep x=1 awk && test
+x=1 awk sed $(pwd) done 'quoted text' x=1 x=1 printf readonly
+		grep | sed grep awk printf sed local ${HOME} x=1 sed && sed sed
+export "$1" sed awk cd 'quoted text'
+${HOME} /usr/bin grep ${HOME} done ${HOME} export && --verbose
+"$1" grep test local test awk 'quoted text' cd -eu awk -eu "$@"
+"$@" $(pwd) && printf echo --verbose awk awk export export "$@" 2>/dev/null
+		test ${HOME} $(pwd) | "$1" echo echo 2>/dev/null local
+	&& test readonly --verbose then sed echo /usr/bin &&
+'quoted text' "$1" 2>/dev/null test --verbose 2>/dev/null local x=1
+	x=1 ${HOME} printf readonly printf "$@" grep test readonly "$@"
+sed --verbose && test "$1" -eu test 'quoted text' ${HOME} sed echo grep sed echo
+x=1 | "$1" then export && echo readonly awk "$@" 2>/dev/null
+		--verbose cd -eu sed /usr/bin "$1" local test
+	/usr/bin x=1 local test awk x=1
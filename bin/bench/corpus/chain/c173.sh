@@ -0,0 +1,2001 @@
+grep "$@" x=1 "$@" grep && local then --verbose local /usr/bin
+	awk /usr/bin export test ${HOME} -eu /usr/bin echo /usr/bin 2>/dev/null local then
+	x=1 x=1 printf sed echo test then then cd sed test
+"$1" then "$@" "$1" echo
+		&& -eu /usr/bin x=1 "$@" --verbose echo "$1" done done /usr/bin "$@" x=1
+2>/dev/null "$@" "$@" "$1" "$@"
+--verbose $(pwd) test sed test /usr/bin "$@" awk test awk done sed done ${HOME}
+		local awk 'quoted text' 'quoted text' done ${HOME} echo --verbose local
+| sed 2>/dev/null echo 'quoted text' done &&
+	awk cd 'quoted text' ${HOME} "$@" sed
+	2>/dev/null -eu test printf sed ${HOME} "$1" local ${HOME}
+		then cd "$1" /usr/bin awk /usr/bin ${HOME} test cd 2>/dev/null
+2>/dev/null "$1" /usr/bin
+		'quoted text' && "$@"
+cd local test "$@" ${HOME}
+	sed readonly 2>/dev/null echo local cd then cd --verbose "$1" 2>/dev/null
+cd && done /usr/bin cd done awk readonly
+$(pwd) readonly 2>/dev/null 'quoted text' x=1 $(pwd) 'quoted text' grep
+		/usr/bin printf readonly
+		"$1" && done ${HOME} awk 2>/dev/null
+done test $(pwd) --verbose export awk awk readonly readonly
+		sed 2>/dev/null && awk readonly export --verbose | export "$1" 2>/dev/null
+		${HOME} $(pwd) $(pwd) readonly $(pwd) --verbose
+		grep /usr/bin /usr/bin
+	| test done cd test "$1" "$1" "$@" /usr/bin readonly readonly test cd awk
+	test local export local awk --verbose export grep printf export --verbose
+		'quoted text' export export done
+		awk $(pwd) ${HOME} sed printf cd test
+grep local | printf echo /usr/bin "$1" && awk done
+		"$@" echo ${HOME} && --verbose 'quoted text' ${HOME} x=1 'quoted text'
+		done -eu then ${HOME} | test awk
+		&& | echo && "$1" test readonly readonly x=1 && readonly && --verbose
+	echo && ${HOME} sed printf sed awk | 2>/dev/null ${HOME} "$1" local && awk
+echo 2>/dev/null | then local --verbose --verbose grep
+	/usr/bin then 2>/dev/null $(pwd) ${HOME} test | $(pwd) "$@" &&
+printf /usr/bin done readonly "$@" $(pwd)
+echo --verbose x=1 2>/dev/null test echo ${HOME} 'quoted text' 'quoted text' echo
+	local /usr/bin sed test readonly local /usr/bin 2>/dev/null done done
+	/usr/bin ${HOME} 2>/dev/null done /usr/bin | export 2>/dev/null export printf
+	export printf "$1" && awk && | && sed --verbose local
+	readonly cd 2>/dev/null /usr/bin 2>/dev/null grep done | "$@" && then
+	"$1" readonly sed cd awk /usr/bin /usr/bin done x=1 "$@" $(pwd) test --verbose
+| x=1 /usr/bin test sed then
+	$(pwd) /usr/bin && | awk | $(pwd) readonly | done printf grep $(pwd) export readonly
+		export 2>/dev/null 2>/dev/null cd sed done
+$(pwd) 2>/dev/null local printf "$1" 'quoted text' 2>/dev/null -eu
+	$(pwd) cd 'quoted text'
+	cd awk local 'quoted text' x=1 readonly
+		then echo x=1 -eu && --verbose
+		awk | sed local $(pwd) x=1 /usr/bin 'quoted text' local echo done "$1" local
+	export && 2>/dev/null local done $(pwd) "$1"
+		local -eu test $(pwd) $(pwd)
+"$@" | | | export sed grep export awk 2>/dev/null sed cd --verbose
+	-eu awk --verbose x=1 "$1" $(pwd)
+local awk readonly cd done --verbose cd /usr/bin | -eu echo 2>/dev/null
+	${HOME} then 2>/dev/null done export then cd echo then
+		sed 'quoted text' /usr/bin export test cd && 'quoted text'
+	printf x=1 cd 2>/dev/null awk && "$@" then grep $(pwd)
+	cd "$1" "$@" printf printf
+2>/dev/null /usr/bin readonly "$1" && echo done
+$(pwd) export | printf $(pwd) $(pwd) 'quoted text' done
+		grep readonly $(pwd) "$@" done export grep
+		$(pwd) --verbose echo
+		/usr/bin test --verbose x=1 readonly
+	'quoted text' done local
+		done grep local "$@" echo sed /usr/bin
+done && echo x=1 --verbose && sed export printf /usr/bin
+		${HOME} done then test -eu awk readonly --verbose then then 2>/dev/null
+	grep awk readonly cd --verbose
+sed cd local local x=1 -eu -eu /usr/bin
+	printf readonly awk sed done test cd awk "$1" grep && echo local && echo then
+	export 'quoted text' local 'quoted text' 2>/dev/null "$@" export
+printf then ${HOME} local awk "$@" cd cd $(pwd) cd && then printf x=1
+awk cd grep done -eu sed printf x=1 x=1
+readonly local done sed -eu awk test
+		awk x=1 'quoted text' $(pwd) && sed echo test sed
+grep && /usr/bin awk cd 'quoted text' done readonly
+		'quoted text' done grep readonly /usr/bin
+		/usr/bin readonly done -eu printf then grep "$1" "$@" then /usr/bin cd 'quoted text'
+		awk 'quoted text' then test $(pwd) printf $(pwd)
+$(pwd) cd test -eu /usr/bin /usr/bin grep test echo then
+		&& sed local ${HOME} "$1" ${HOME} -eu echo
+	sed printf /usr/bin --verbose /usr/bin export ${HOME}
+"$@" | /usr/bin | echo x=1 --verbose then ${HOME} -eu 'quoted text'
+		/usr/bin "$@" && export echo ${HOME} readonly done local echo awk /usr/bin
+'quoted text' ${HOME} ${HOME} 'quoted text' done awk awk && cd $(pwd) sed
+done | 2>/dev/null local "$1" ${HOME} $(pwd) "$1" "$1" cd $(pwd)
+		&& | $(pwd) ${HOME} grep "$1" && grep export
+		local $(pwd) "$@" readonly "$1"
+	${HOME} | echo printf 2>/dev/null
+	"$@" /usr/bin cd grep done ${HOME}
+	/usr/bin $(pwd) "$@" | test $(pwd) -eu export grep cd readonly 2>/dev/null
+		awk 'quoted text' /usr/bin
+	awk "$1" then -eu /usr/bin /usr/bin readonly printf /usr/bin "$1" "$1"
+		local $(pwd) 2>/dev/null && --verbose awk awk x=1 "$1" awk $(pwd)
+	| "$@" "$@" done export x=1
+		/usr/bin 'quoted text' sed test x=1 echo -eu 2>/dev/null
+	then cd grep readonly export
+	'quoted text' && local ${HOME} 2>/dev/null "$1"
+		export grep test then "$1" echo -eu --verbose awk done x=1 awk /usr/bin
+		${HOME} /usr/bin && local printf | | /usr/bin cd x=1 test -eu "$@" 2>/dev/null
+	"$@" done x=1 then "$@" "$@"
+	echo export 'quoted text' $(pwd) export -eu 2>/dev/null --verbose printf cd
+| | grep done "$1" && "$@"
+local $(pwd) | | then grep /usr/bin awk grep then --verbose then "$1" "$@"
+	/usr/bin test export -eu test readonly then 2>/dev/null
+$(pwd) x=1 | export | "$1" "$1" sed cd $(pwd) local
+	grep done sed grep $(pwd) $(pwd) | | echo readonly
+		cd printf -eu grep sed
+done export 2>/dev/null -eu printf cd /usr/bin
+	test ${HOME} export 'quoted text' local export /usr/bin ${HOME} "$@" 'quoted text'
+	test "$1" /usr/bin cd x=1 $(pwd) /usr/bin
+	'quoted text' test echo then grep grep -eu
+"$1" sed grep && -eu "$@" -eu cd 'quoted text'
+		echo cd && awk 'quoted text' printf /usr/bin readonly done
+		cd export /usr/bin 'quoted text' awk cd 'quoted text' sed echo
+&& "$@" "$@" -eu awk -eu 2>/dev/null 'quoted text'
+	2>/dev/null 'quoted text' test "$@" 'quoted text' sed export --verbose
+	&& x=1 awk && export done done cd && -eu
+	echo done "$@" done -eu local
+	done /usr/bin -eu 2>/dev/null grep /usr/bin echo done | printf -eu
+	/usr/bin && done 2>/dev/null sed
+awk -eu printf echo | /usr/bin "$1" cd readonly "$@" awk /usr/bin echo
+printf ${HOME} 2>/dev/null | "$@" -eu test 2>/dev/null "$1" 'quoted text'
+		/usr/bin readonly then -eu local sed ${HOME} done /usr/bin
+	awk cd printf printf cd && 'quoted text' then $(pwd) echo grep then readonly
+	'quoted text' printf "$@" then readonly && grep grep
+x=1 'quoted text' awk -eu
+2>/dev/null "$1" 'quoted text' ${HOME} echo sed sed --verbose
+	$(pwd) readonly export printf printf && --verbose
+$(pwd) | cd "$@" $(pwd) done --verbose x=1 /usr/bin done then "$@" grep -eu
+	2>/dev/null $(pwd) local done x=1 readonly
+	2>/dev/null export local then export cd --verbose 2>/dev/null "$@" && echo then
+	${HOME} then "$1" then cd export grep
+	awk grep 2>/dev/null
+"$1" echo export --verbose 'quoted text'
+	cd sed x=1 $(pwd) readonly
+	readonly x=1 && local 'quoted text' $(pwd) sed echo
+		done 'quoted text' "$@" "$@" 'quoted text' sed $(pwd) sed printf /usr/bin $(pwd)
+	awk sed 2>/dev/null | test && "$@" --verbose && | echo test x=1
+		echo x=1 'quoted text' sed 'quoted text' local |
+grep grep export | then | --verbose | /usr/bin done
+test /usr/bin test $(pwd) done local done sed | then "$1" | echo -eu /usr/bin
+		--verbose done "$@" x=1 echo printf awk "$@" echo 2>/dev/null done grep
+		test ${HOME} "$@" --verbose $(pwd) done $(pwd) cd grep readonly
+		| x=1 x=1 -eu grep export then
+	${HOME} "$1" "$1" 2>/dev/null x=1 && 'quoted text'
+	2>/dev/null then echo ${HOME} 2>/dev/null grep awk test 2>/dev/null
+		cd ${HOME} then 'quoted text' then -eu local
+then readonly 2>/dev/null -eu sed grep | echo grep sed export echo && sed
+		test x=1 --verbose echo export x=1 printf
+sed --verbose awk awk grep
+printf then -eu cd sed && "$@" 2>/dev/null
+"$1" sed --verbose export grep printf /usr/bin readonly test done cd
+		--verbose export $(pwd) $(pwd) grep
+	awk awk ${HOME} "$@" 'quoted text' awk test
+		${HOME} done done echo 2>/dev/null -eu
+cd && $(pwd) local cd done /usr/bin --verbose $(pwd) $(pwd) "$1" "$1" /usr/bin
+	export done --verbose ${HOME} -eu ${HOME} && awk /usr/bin |
+		x=1 x=1 | --verbose -eu "$@" ${HOME} ${HOME} test "$@"
+		$(pwd) | $(pwd) local | ${HOME} test 'quoted text' "$@"
+export 'quoted text' printf 2>/dev/null && /usr/bin
+		'quoted text' grep printf x=1 | sed x=1 "$1" --verbose 2>/dev/null
+	/usr/bin sed "$1" sed 2>/dev/null
+"$1" $(pwd) local | local 2>/dev/null 'quoted text' 'quoted text'
+	done && local export done | "$1" x=1 "$@"
+'quoted text' && sed readonly "$1" 2>/dev/null 2>/dev/null
+		cd sed sed sed readonly "$1" x=1 done -eu 2>/dev/null
+	--verbose 'quoted text' /usr/bin done export
+echo "$1" test cd "$1" printf ${HOME} test | grep local printf | "$@" /usr/bin
+	grep | x=1 sed "$1" && 'quoted text' | 'quoted text'
+| /usr/bin grep ${HOME} x=1 echo done && /usr/bin local x=1
+"$@" "$@" "$@" x=1 -eu awk readonly local done test sed /usr/bin then
+	x=1 -eu sed export "$1" sed
+	/usr/bin awk --verbose 'quoted text'
+$(pwd) grep $(pwd) | done test ${HOME}
+		echo $(pwd) -eu 2>/dev/null | | awk echo x=1 && test readonly done test
+x=1 | /usr/bin grep readonly then x=1
+		printf x=1 done readonly local export /usr/bin test
+sed x=1 echo ${HOME} --verbose export export cd
+	then export ${HOME} && then export
+	sed awk && "$1" /usr/bin export && then "$@" test sed | "$@" printf
+"$@" local awk "$1" printf && readonly echo local |
+	2>/dev/null then ${HOME} cd 'quoted text'
+	2>/dev/null cd && "$1" awk awk /usr/bin awk awk
+&& done echo "$1" ${HOME}
+/usr/bin test local readonly readonly export echo | readonly "$1" /usr/bin
+		export 'quoted text' | -eu $(pwd)
+grep ${HOME} "$1" ${HOME} export 'quoted text'
+echo grep sed grep --verbose echo cd $(pwd) 2>/dev/null
+		awk local "$1" | test grep
+	--verbose -eu ${HOME} awk ${HOME} awk awk /usr/bin cd local
+"$@" -eu $(pwd) readonly 'quoted text' /usr/bin && --verbose
+$(pwd) "$@" | "$@" | /usr/bin
+&& -eu readonly awk 'quoted text' $(pwd)
+		x=1 awk export then ${HOME} x=1 2>/dev/null "$@" readonly | x=1 &&
+readonly sed printf $(pwd) "$1" then awk "$@" echo
+	awk test 'quoted text' -eu x=1 then "$@" && /usr/bin sed 2>/dev/null
+-eu | | && export --verbose export awk test
+		awk -eu ${HOME} --verbose printf test
+		2>/dev/null done | && test sed --verbose test x=1 local sed $(pwd)
+	$(pwd) then -eu cd /usr/bin readonly -eu readonly export sed test
+	test readonly 2>/dev/null x=1 && printf && done --verbose
+	grep printf printf then echo
+		"$@" export "$1" && --verbose
+	local ${HOME} awk done /usr/bin "$@" "$@" printf then /usr/bin
+		readonly then -eu $(pwd) x=1 cd -eu /usr/bin --verbose
+	cd --verbose "$1" /usr/bin echo
+	cd /usr/bin done $(pwd) grep cd -eu --verbose ${HOME}
+	grep ${HOME} printf grep then ${HOME} then cd --verbose sed $(pwd) export -eu
+		local | export $(pwd) $(pwd) grep grep then && sed then test cd grep then
+	"$@" -eu -eu readonly $(pwd) test x=1
+	$(pwd) grep cd readonly "$@" /usr/bin | $(pwd) -eu then
+	"$@" export 2>/dev/null done echo done done grep echo --verbose
+$(pwd) then ${HOME} export "$@"
+&& x=1 done $(pwd) ${HOME} test && "$@" $(pwd) sed cd grep 2>/dev/null "$@"
+local done echo readonly printf -eu
+	export 2>/dev/null cd 2>/dev/null
+	grep awk | export export ${HOME}
+x=1 | -eu ${HOME} --verbose x=1 x=1 awk local
+	cd printf cd sed readonly then cd sed "$@" printf $(pwd)
+		--verbose cd cd | export sed export local | cd x=1 /usr/bin /usr/bin 2>/dev/null
+		--verbose readonly /usr/bin
+		done awk printf then echo ${HOME} then readonly && then
+		awk 'quoted text' export readonly 'quoted text' 'quoted text'
+local 2>/dev/null done then
+		readonly readonly 2>/dev/null sed "$1"
+	awk --verbose --verbose cd --verbose echo grep --verbose
+		$(pwd) sed done sed echo awk done | /usr/bin awk awk
+printf "$1" "$1" 2>/dev/null printf
+	grep sed awk awk local local
+		/usr/bin $(pwd) -eu --verbose 'quoted text' cd printf awk
+	done printf export 2>/dev/null test echo --verbose
+	2>/dev/null 2>/dev/null grep grep test /usr/bin
+	echo awk done x=1 test "$1" 'quoted text' -eu export /usr/bin echo
+--verbose ${HOME} x=1 -eu
+		export sed && ${HOME} grep ${HOME}
+$(pwd) cd 2>/dev/null --verbose export x=1 && --verbose readonly "$1" readonly
+printf printf awk && 2>/dev/null
+		grep export 2>/dev/null x=1 /usr/bin cd export
+		2>/dev/null sed cd export 2>/dev/null "$1" "$1" export printf test $(pwd) cd test
+sed "$1" readonly /usr/bin cd "$@" --verbose done "$@" grep
+-eu awk 'quoted text' | printf | then awk local
+	then awk sed --verbose awk done ${HOME} then echo sed
+		awk grep $(pwd) test grep local "$1" printf 2>/dev/null sed && grep
+		done | --verbose readonly && cd printf "$1" && | "$1" /usr/bin
+		${HOME} grep "$@" 2>/dev/null printf awk 2>/dev/null cd /usr/bin local "$1" grep
+		done done echo grep 2>/dev/null
+		--verbose done /usr/bin --verbose local cd awk echo then 'quoted text' local --verbose
+"$1" echo ${HOME} | ${HOME} grep "$@" cd readonly --verbose
+		sed -eu readonly x=1 awk x=1 echo done 2>/dev/null && /usr/bin && printf
+	printf --verbose then export test local readonly
+--verbose grep export $(pwd) && 'quoted text' -eu done 2>/dev/null sed
+cd cd "$1" 2>/dev/null 2>/dev/null done
+		readonly test test printf /usr/bin && printf awk
+		echo done sed && -eu "$@" grep && /usr/bin done done "$@" local
+	echo printf "$@" sed "$1" 'quoted text'
+	printf 'quoted text' ${HOME} echo 'quoted text' cd then grep test grep
+		"$@" test cd export echo export &&
+	then 'quoted text' then
+	x=1 export "$1" 2>/dev/null -eu | 'quoted text'
+	2>/dev/null "$1" --verbose awk --verbose
+	| x=1 --verbose $(pwd) cd done test echo && /usr/bin test 'quoted text' export
+	test "$@" 2>/dev/null sed | cd --verbose grep ${HOME} export 2>/dev/null
+	'quoted text' --verbose
+	$(pwd) awk cd /usr/bin x=1 cd export done sed /usr/bin /usr/bin
+		| --verbose export cd 2>/dev/null
+	awk done sed grep /usr/bin | x=1 readonly test "$@" /usr/bin printf 2>/dev/null
+		then cd "$@" $(pwd) 2>/dev/null
+		--verbose $(pwd) "$1" test
+then x=1 done grep readonly cd 2>/dev/null | sed ${HOME}
+"$@" 2>/dev/null done "$@" "$@" test
+		done "$@" local && | $(pwd) /usr/bin
+local -eu 2>/dev/null export test cd then ${HOME} "$1"
+	echo | readonly "$@" && sed grep 'quoted text' && echo test local
+/usr/bin local then cd "$1" grep readonly then "$@" ${HOME} /usr/bin -eu
+		| --verbose export "$@" echo then done --verbose readonly sed ${HOME}
+$(pwd) --verbose && then printf readonly $(pwd) echo printf test /usr/bin done
+		cd done cd awk 'quoted text' -eu $(pwd) echo then echo then local local local
+"$1" -eu | done 2>/dev/null echo sed readonly export done -eu x=1
+		"$@" then test && awk cd readonly cd grep && ${HOME} /usr/bin --verbose -eu 'quoted text'
+	-eu sed "$@" test echo grep | done 2>/dev/null x=1 awk grep /usr/bin printf
+		"$1" sed then test local sed $(pwd)
+export test | && export --verbose --verbose echo 2>/dev/null 'quoted text' done
+		| | grep then x=1 cd then cd --verbose
+&& echo sed printf ${HOME} local $(pwd) sed grep grep export cd
+	"$@" sed 'quoted text' done x=1 ${HOME}
+		local | | x=1 'quoted text' grep readonly readonly
+local grep -eu then ${HOME} local $(pwd) "$@" echo $(pwd) $(pwd) sed readonly
+		then printf 2>/dev/null export && grep printf "$@" /usr/bin
+printf export x=1 grep "$1" | /usr/bin
+printf -eu done printf printf cd printf "$@" done readonly
+		-eu | printf $(pwd) cd echo cd export /usr/bin
+	printf ${HOME} printf awk awk printf ${HOME} && "$@" /usr/bin
+		$(pwd) local test -eu 2>/dev/null $(pwd) -eu && && readonly test --verbose awk
+		done && printf && then 2>/dev/null "$1" printf /usr/bin echo
+	echo grep test awk readonly
+		-eu done "$1" done ${HOME}
+		done done 2>/dev/null 2>/dev/null "$@" echo
+awk awk sed test 'quoted text' test
+		awk awk awk then export printf $(pwd)
+"$1" ${HOME} grep | echo export -eu printf && awk local local done cd grep test
+	'quoted text' --verbose awk $(pwd) echo ${HOME}
+cd grep ${HOME} printf then export
+	/usr/bin 'quoted text' x=1 readonly $(pwd) 'quoted text' --verbose x=1 "$1"
+export readonly x=1 awk export | "$1" /usr/bin "$@" sed --verbose done
+readonly cd /usr/bin done awk then then printf 'quoted text' 2>/dev/null
+| | 'quoted text' $(pwd) local
+local x=1 && "$1" export x=1 x=1 echo -eu 2>/dev/null
+		readonly test done local /usr/bin done
+&& /usr/bin done "$1" --verbose grep export
+printf test printf "$1" awk
+&& -eu 2>/dev/null $(pwd) ${HOME} /usr/bin test x=1 "$1" local printf
+sed "$1" "$1" local "$1" test x=1 2>/dev/null && awk
+x=1 echo --verbose awk "$1" done /usr/bin test cd --verbose
+		"$1" printf echo sed sed export
+echo printf ${HOME} readonly x=1 local x=1 sed 2>/dev/null
+| printf /usr/bin readonly
+	2>/dev/null "$1" ${HOME} && --verbose
+	printf readonly 'quoted text' $(pwd) sed echo -eu /usr/bin readonly -eu
+	'quoted text' sed && 2>/dev/null | sed export /usr/bin --verbose cd
+cd /usr/bin /usr/bin -eu --verbose readonly 'quoted text'
+		sed sed 2>/dev/null export /usr/bin -eu
+		grep sed readonly && local printf ${HOME} cd "$1" export 2>/dev/null printf
+grep 'quoted text' printf export
+done export -eu x=1 then &&
+	printf cd && x=1 --verbose test local
+	local 2>/dev/null --verbose export $(pwd) 2>/dev/null
+x=1 $(pwd) cd "$1" cd x=1 export sed then local test sed grep /usr/bin 2>/dev/null
+	sed sed then 'quoted text'
+	sed 2>/dev/null then /usr/bin local done grep readonly then /usr/bin ${HOME} &&
+cd x=1 /usr/bin | ${HOME} x=1 "$@" ${HOME} | | "$1" ${HOME} local --verbose
+	${HOME} | && /usr/bin cd 2>/dev/null $(pwd) export 'quoted text' echo | |
+	local 'quoted text' done x=1 readonly
+-eu 'quoted text' done local echo grep $(pwd) 'quoted text' | grep "$1"
+	export readonly cd echo test printf echo
+		| done printf export sed
+export awk x=1 'quoted text' cd cd $(pwd) 'quoted text'
+| awk then && readonly -eu ${HOME} /usr/bin "$1" done sed $(pwd)
+		&& "$1" && export x=1 $(pwd) export
+${HOME} x=1 ${HOME} | export test grep printf printf cd && then "$@"
+	"$1" echo /usr/bin --verbose printf x=1 "$@" readonly readonly then grep cd sed
+awk "$1" $(pwd) local | /usr/bin
+	| then awk /usr/bin --verbose -eu
+'quoted text' $(pwd) --verbose
+awk then && export sed readonly sed echo -eu cd ${HOME} $(pwd)
+	2>/dev/null grep printf "$1" local printf test | -eu "$1" done export "$1" 2>/dev/null
+	then && 'quoted text' 'quoted text'
+		echo 'quoted text' printf
+	then --verbose printf cd echo x=1 --verbose "$1" 2>/dev/null -eu export
+cd /usr/bin awk -eu printf echo 'quoted text' ${HOME} then local
+cd done awk x=1 printf x=1 grep test grep "$@" cd printf 2>/dev/null /usr/bin
+		'quoted text' "$1" 'quoted text' sed echo grep awk readonly
+-eu --verbose x=1 grep grep
+		echo then then test echo cd 'quoted text' 2>/dev/null grep 2>/dev/null x=1
+"$1" x=1 "$@" && then && echo 'quoted text' grep readonly
+	${HOME} echo sed awk printf | local /usr/bin | --verbose printf cd 2>/dev/null
+	x=1 $(pwd) cd $(pwd) cd awk done export 'quoted text' ${HOME}
+	| && done done "$1" printf
+		&& /usr/bin printf && 'quoted text'
+	export --verbose test then test -eu then awk "$@" done && grep export 'quoted text'
+		$(pwd) "$1" -eu ${HOME} && --verbose
+	"$1" 2>/dev/null echo then local printf printf export local
+	-eu $(pwd) awk ${HOME} grep cd local cd | 'quoted text' readonly x=1
+export cd test cd printf --verbose test echo awk
+printf && 'quoted text' 'quoted text'
+	cd /usr/bin 'quoted text' "$1" -eu local "$1" sed
+		${HOME} readonly local sed -eu test /usr/bin
+	sed 'quoted text' export printf "$1" readonly
+	$(pwd) test local cd | awk done /usr/bin
+--verbose -eu echo "$@" awk grep -eu readonly
+	| printf then --verbose "$@" 2>/dev/null -eu | grep echo
+		echo "$1" /usr/bin --verbose
+	cd $(pwd) cd x=1 export test -eu done grep && export
+		export ${HOME} sed done
+	awk printf printf test 2>/dev/null
+	readonly "$1" then printf ${HOME} readonly "$@" ${HOME}
+	export sed && test test then done ${HOME} done
+	"$1" /usr/bin $(pwd) readonly printf
+	$(pwd) export readonly grep sed echo "$@" cd then awk 2>/dev/null
+	&& /usr/bin awk --verbose /usr/bin x=1 awk
+	$(pwd) | done x=1 && ${HOME} readonly
+		grep /usr/bin grep && awk local 2>/dev/null printf echo $(pwd) 2>/dev/null
+/usr/bin cd ${HOME} "$@" echo done then local "$1"
+local /usr/bin ${HOME} grep cd -eu
+		"$@" sed done && | && done
+	| local --verbose cd $(pwd) /usr/bin --verbose 2>/dev/null printf
+done test grep 'quoted text' local cd grep | && x=1 then
+printf ${HOME} export then sed ${HOME} then sed
+		-eu printf && export
+		| x=1 echo grep grep readonly "$1" | printf
+	x=1 /usr/bin "$1" ${HOME} printf
+	echo | && printf 'quoted text'
+		export then x=1 "$@" "$@" cd 2>/dev/null then test --verbose export &&
+	--verbose sed then then then printf 2>/dev/null
+		x=1 done x=1 then done
+		readonly printf then ${HOME} then ${HOME}
+		done export done ${HOME} then | sed --verbose
+x=1 'quoted text' 2>/dev/null local echo
+		${HOME} x=1 /usr/bin ${HOME} 2>/dev/null cd "$1" then done
+printf export readonly sed 2>/dev/null done
+done "$@" export readonly && && echo
+	$(pwd) ${HOME} export 2>/dev/null sed && awk test
+'quoted text' done cd test && "$1" -eu x=1 sed grep readonly
+	"$1" "$1" | "$@" x=1 "$@" echo readonly readonly
+		test 'quoted text' echo done printf "$@"
+		readonly local then 2>/dev/null ${HOME} sed echo "$1"
+		"$1" echo awk test cd /usr/bin export done --verbose cd local
+printf "$@" grep sed ${HOME} x=1 2>/dev/null $(pwd) 2>/dev/null
+$(pwd) x=1 cd $(pwd) cd
+	$(pwd) 'quoted text' readonly then
+then | $(pwd) "$1" then "$1" "$1" local "$1" 'quoted text' "$@"
+x=1 echo sed "$1" "$@" 2>/dev/null
+		2>/dev/null ${HOME} -eu x=1 x=1 "$1" done x=1 printf awk awk $(pwd) 2>/dev/null
+	printf echo && | done test x=1 /usr/bin && "$1"
+	"$@" readonly -eu --verbose | 'quoted text'
+done export grep && test echo -eu grep cd
+		readonly printf "$@" echo sed grep 'quoted text' ${HOME} 'quoted text'
+		readonly grep ${HOME} "$@" /usr/bin /usr/bin
+		| "$@" 2>/dev/null readonly 2>/dev/null
+--verbose ${HOME} export $(pwd) 2>/dev/null export -eu --verbose local &&
+	x=1 $(pwd) --verbose then --verbose
+	/usr/bin "$@" done export --verbose "$@" then printf printf
+	grep /usr/bin done /usr/bin grep 'quoted text'
+2>/dev/null 2>/dev/null readonly test grep -eu
+		| /usr/bin /usr/bin cd
+		"$@" echo test awk printf then 'quoted text' grep -eu sed "$@" sed awk
+		'quoted text' readonly awk
+"$@" sed $(pwd) 2>/dev/null local --verbose 'quoted text' $(pwd) /usr/bin
+		sed -eu x=1 --verbose export 'quoted text' -eu x=1
+2>/dev/null 'quoted text' echo 'quoted text' readonly &&
+/usr/bin readonly grep export printf /usr/bin --verbose then sed then --verbose
+		&& cd printf && then ${HOME} ${HOME}
+x=1 | test cd 2>/dev/null "$1" 'quoted text'
+sed echo 2>/dev/null export done echo && test then cd done printf $(pwd) then
+		'quoted text' --verbose printf "$1" then 2>/dev/null
+		export awk ${HOME} done
+done x=1 ${HOME} | 'quoted text' awk | /usr/bin
+-eu 'quoted text' echo grep $(pwd) echo sed local ${HOME} 'quoted text' test
+grep --verbose --verbose 2>/dev/null
+		$(pwd) 'quoted text' 2>/dev/null printf -eu awk /usr/bin ${HOME} ${HOME}
+	"$1" -eu echo cd echo ${HOME} 'quoted text' done
+export 2>/dev/null sed local "$1"
+then ${HOME} local $(pwd) --verbose 2>/dev/null
+		done -eu test -eu | && 'quoted text' done 'quoted text' then
+		readonly && printf "$@" && done && sed grep sed printf local
+		&& done --verbose 'quoted text' "$1"
+		sed 'quoted text' x=1 ${HOME} grep -eu printf
+$(pwd) sed ${HOME} -eu done
+then $(pwd) printf local 2>/dev/null cd export cd printf ${HOME} local ${HOME}
+	awk readonly 'quoted text' cd export 'quoted text' "$1"
+	x=1 ${HOME} "$@" test sed
+		echo sed $(pwd) awk echo readonly "$@" cd export then "$@"
+done grep $(pwd) grep grep -eu test x=1 then 2>/dev/null "$1" x=1 2>/dev/null
+		cd /usr/bin echo local cd "$@" && 2>/dev/null
+	2>/dev/null x=1 | && 'quoted text' --verbose done 'quoted text' -eu | echo -eu
+	sed ${HOME} "$@" echo -eu then readonly test | grep
+	echo awk awk 2>/dev/null readonly printf grep | "$@" sed local printf
+awk 'quoted text' test x=1 cd --verbose readonly
+	awk printf 2>/dev/null ${HOME} done "$@" readonly
+	&& readonly /usr/bin test grep 'quoted text' local readonly local -eu local
+$(pwd) -eu x=1 readonly && done && grep export -eu ${HOME} && export
+cd 'quoted text' 'quoted text' ${HOME} ${HOME}
+		--verbose then "$1" --verbose echo echo export | readonly done /usr/bin export
+		/usr/bin cd x=1 awk | printf -eu "$1" 'quoted text' printf test $(pwd)
+		grep /usr/bin "$1" | test /usr/bin $(pwd) local test 'quoted text'
+		${HOME} sed export then $(pwd) printf x=1 $(pwd) $(pwd) readonly 2>/dev/null
+$(pwd) echo echo 'quoted text' && "$1" x=1
+		"$1" ${HOME} echo x=1 done echo
+/usr/bin "$1" x=1 grep local echo awk readonly
+		printf echo cd echo /usr/bin | "$1" done test
+	| "$1" /usr/bin -eu test cd printf done printf && && readonly
+		$(pwd) $(pwd) 2>/dev/null ${HOME} ${HOME} cd /usr/bin export x=1 readonly
+		export awk --verbose test
+readonly then local awk done "$@" -eu | readonly
+		2>/dev/null "$1" grep local "$1" -eu -eu 'quoted text'
+done ${HOME} awk cd /usr/bin --verbose ${HOME}
+		/usr/bin cd ${HOME} awk grep | test
+	test done echo -eu 'quoted text' grep readonly test
+		x=1 local | cd && printf ${HOME} 2>/dev/null && grep --verbose done
+		grep cd | grep done x=1
+	"$@" readonly test ${HOME} --verbose
+		--verbose cd /usr/bin readonly
+cd cd sed --verbose then "$@" then x=1 'quoted text'
+	--verbose export export "$1" 2>/dev/null | export grep
+		cd export awk 2>/dev/null local local grep grep "$@" local 'quoted text' test
+	x=1 then | 2>/dev/null 'quoted text' echo export "$@" x=1 "$@" $(pwd) sed --verbose
+grep && echo sed x=1 export echo "$1" "$@" $(pwd) readonly ${HOME}
+	local "$1" export /usr/bin x=1
+		sed && 2>/dev/null -eu test $(pwd)
+	echo 2>/dev/null 'quoted text' printf test export grep
+sed && 2>/dev/null readonly export echo export
+		test printf 'quoted text' "$1" --verbose
+		"$@" 'quoted text' printf --verbose "$@" 'quoted text' sed ${HOME}
+x=1 -eu $(pwd) | awk ${HOME}
+	&& done sed && ${HOME} echo
+	export local /usr/bin readonly /usr/bin /usr/bin "$@" | && done
+		done sed sed && then x=1 printf "$1" 'quoted text'
+	${HOME} x=1 export sed |
+		--verbose && done -eu 2>/dev/null cd x=1 x=1 echo "$1" cd echo cd awk 'quoted text'
+		"$1" grep --verbose ${HOME} 2>/dev/null test done export grep 2>/dev/null
+-eu local export "$1" "$@" done ${HOME} $(pwd) grep "$@" |
+	cd echo "$@" done && test | ${HOME} then "$@"
+		| cd --verbose echo then test --verbose -eu | readonly done readonly
+		--verbose sed done awk x=1 readonly /usr/bin -eu done $(pwd)
+		export && -eu --verbose
+	&& echo then grep 'quoted text'
+	'quoted text' sed readonly /usr/bin sed sed export local
+	then --verbose --verbose awk sed grep /usr/bin cd grep
+		printf then done && -eu | | && "$1" done export "$@" readonly
+		${HOME} "$@" readonly /usr/bin -eu local
+	cd "$@" test -eu printf
+/usr/bin && awk then echo readonly done "$@" 'quoted text'
+		then grep x=1 local --verbose "$1" "$@" /usr/bin awk cd then "$@"
+	cd test --verbose grep x=1 readonly x=1 "$@" readonly printf
+	-eu /usr/bin "$@" printf local --verbose sed "$1" local --verbose | -eu
+		| grep "$@" "$1" readonly "$1" && then
+	--verbose /usr/bin export export ${HOME} x=1 local x=1 "$1" --verbose
+		local sed grep local "$@" "$@"
+	local cd "$@" readonly && then -eu sed awk /usr/bin
+sed awk $(pwd) --verbose then 'quoted text'
+	/usr/bin local awk --verbose --verbose grep ${HOME} "$1" /usr/bin x=1 | echo
+local grep awk readonly 2>/dev/null echo then x=1 done export
+		printf test readonly "$@" $(pwd) /usr/bin $(pwd)
+		then printf "$@" readonly "$1" awk | 'quoted text' x=1 x=1
+export done readonly && echo "$1" export x=1 done | export
+'quoted text' $(pwd) "$@" test -eu done $(pwd) cd sed test
+	readonly /usr/bin local echo ${HOME}
+then done echo then 2>/dev/null /usr/bin $(pwd)
+		awk && cd local printf sed "$1" local export
+		test "$1" 'quoted text' x=1 export test 'quoted text'
+		local /usr/bin awk sed awk printf local grep /usr/bin export /usr/bin cd grep
+	'quoted text' awk then local -eu "$1" ${HOME} -eu readonly sed done awk --verbose
+	/usr/bin awk local printf
+| cd 'quoted text' $(pwd) && grep awk
+	| readonly export readonly printf 'quoted text' && /usr/bin
+		cd sed test readonly 'quoted text'
+		then local grep x=1 then x=1 | "$@" /usr/bin -eu export export --verbose export
+	awk test cd grep x=1 2>/dev/null
+		| local "$@" x=1 $(pwd) -eu readonly $(pwd) sed cd grep grep test
+	then readonly export --verbose x=1 export --verbose test readonly cd "$@"
+		'quoted text' printf | then
+local sed $(pwd) sed echo printf --verbose awk
+		cd grep x=1 readonly "$1"
+		'quoted text' "$@" && | 2>/dev/null then "$@"
+local -eu cd | x=1 done test | then awk "$@" test
+		printf $(pwd) sed $(pwd) -eu awk 2>/dev/null test x=1 test test
+	'quoted text' -eu 'quoted text' && "$1"
+		"$1" echo "$1" 2>/dev/null
+| --verbose then /usr/bin ${HOME} printf then cd then -eu
+grep --verbose cd --verbose $(pwd) awk "$@" ${HOME} --verbose export
+		--verbose local && | /usr/bin
+	-eu $(pwd) echo "$1" done -eu readonly awk -eu | then export
+done /usr/bin then grep echo $(pwd) "$@" "$@" "$1" && 'quoted text'
+	-eu && echo cd grep /usr/bin | cd local cd echo test local "$@" echo x=1 | 2>/dev/null
+	readonly sed "$1" 'quoted text' | x=1
+	-eu test "$1" --verbose "$@" local echo done -eu 2>/dev/null && --verbose
+		$(pwd) readonly && 'quoted text' readonly then -eu awk test && 2>/dev/null
+		grep "$1" echo then x=1 echo readonly | cd sed awk
+		cd awk echo $(pwd) -eu awk local $(pwd) "$1" grep "$1"
+		sed cd $(pwd) echo 2>/dev/null /usr/bin awk grep $(pwd) $(pwd) | -eu --verbose
+"$1" $(pwd) sed awk local printf local echo --verbose
+"$@" && echo /usr/bin cd | -eu test readonly echo
+done ${HOME} echo && local 2>/dev/null 'quoted text' printf cd done -eu
+		--verbose then echo 'quoted text'
+		"$@" printf "$@" -eu
+		2>/dev/null test then $(pwd) local --verbose
+		cd "$@" x=1 printf x=1 awk -eu
+		grep 2>/dev/null export then sed
+	printf 2>/dev/null grep "$@" $(pwd) test cd "$@"
+	echo 'quoted text' export ${HOME}
+		${HOME} export ${HOME} awk "$@" export cd export done cd ${HOME} cd --verbose
+readonly ${HOME} readonly ${HOME} 2>/dev/null --verbose x=1
+	test 2>/dev/null done export echo | | /usr/bin done
+	then | $(pwd) | sed "$@" 'quoted text' awk
+		printf cd readonly then x=1 'quoted text'
+		&& | sed readonly local | grep cd sed "$1" | --verbose
+		readonly /usr/bin $(pwd) test && "$@" awk printf
+		sed x=1 'quoted text' sed 2>/dev/null --verbose sed $(pwd) 'quoted text'
+	export local && then ${HOME} 'quoted text'
+"$1" readonly test "$1" local done --verbose grep
+echo printf export done cd grep local -eu readonly
+		sed && --verbose /usr/bin echo ${HOME} ${HOME}
+	cd x=1 done test grep 'quoted text' test
+x=1 /usr/bin sed 2>/dev/null
+/usr/bin cd then done done
+${HOME} done then x=1 'quoted text'
+	then /usr/bin export 'quoted text' printf test $(pwd) $(pwd) "$1" printf
+	--verbose then $(pwd) done sed sed 2>/dev/null
+-eu --verbose 2>/dev/null awk ${HOME} export $(pwd) echo
+	-eu done awk cd sed readonly sed x=1
+printf test readonly then grep --verbose x=1 done then awk local export $(pwd)
+	x=1 2>/dev/null printf readonly then echo printf cd x=1 printf ${HOME} | cd $(pwd)
+grep -eu $(pwd) 2>/dev/null export -eu x=1 "$@" /usr/bin x=1 'quoted text'
+		-eu 'quoted text' "$1" sed then then x=1 'quoted text'
+	-eu cd then && | awk 2>/dev/null ${HOME} local readonly
+$(pwd) printf x=1 2>/dev/null
+cd local export "$1" 2>/dev/null 'quoted text' /usr/bin --verbose
+	${HOME} export test x=1 awk --verbose awk x=1 then --verbose
+		${HOME} sed | local export sed awk printf awk cd test /usr/bin
+-eu -eu printf printf && -eu readonly then printf readonly "$@" then test
+printf -eu then done $(pwd) cd 2>/dev/null
+		2>/dev/null local local /usr/bin
+grep "$@" x=1 cd 2>/dev/null "$1" readonly local && printf /usr/bin -eu
+		/usr/bin export echo $(pwd) readonly |
+/usr/bin cd readonly x=1 echo test 2>/dev/null
+test local -eu -eu 2>/dev/null readonly done then &&
+		then sed awk ${HOME} x=1 export grep "$1" readonly -eu -eu -eu
+	x=1 && /usr/bin awk readonly awk printf "$1"
+	${HOME} && local readonly test printf $(pwd) 'quoted text' x=1 local ${HOME}
+		cd sed x=1 grep && local export ${HOME} ${HOME} cd export awk && cd done
+/usr/bin export "$@" printf then --verbose export ${HOME} local local
+printf 'quoted text' test "$@" local 'quoted text' x=1 -eu printf
+		&& grep x=1 test sed grep echo
+	printf done -eu readonly done 2>/dev/null 2>/dev/null readonly x=1 ${HOME}
+		'quoted text' done local sed 2>/dev/null $(pwd) /usr/bin /usr/bin ${HOME} "$1"
+/usr/bin -eu | "$@" -eu /usr/bin awk printf ${HOME} then done /usr/bin
+done $(pwd) /usr/bin printf then echo --verbose then
+		done echo then x=1 cd -eu | done local
+grep x=1 printf x=1 done
+		test readonly x=1 printf 2>/dev/null "$1" test --verbose printf | -eu --verbose
+	x=1 cd then | ${HOME} "$@" ${HOME} echo "$@" 2>/dev/null
+		sed done ${HOME} done test ${HOME} cd export 'quoted text'
+		--verbose done "$@" then x=1 readonly cd $(pwd) echo 2>/dev/null
+| echo 2>/dev/null export
+--verbose -eu -eu 2>/dev/null export then
+	-eu export echo 2>/dev/null "$@" grep && "$@" "$1" then sed "$@" awk sed
+	$(pwd) then $(pwd) && cd done test then printf local --verbose /usr/bin
+cd done | readonly printf
+	$(pwd) grep ${HOME} ${HOME} x=1 sed | 2>/dev/null cd | | "$1" ${HOME} readonly
+--verbose awk --verbose test "$@" export | --verbose
+		then echo 'quoted text' --verbose awk 2>/dev/null grep
+--verbose echo local --verbose awk
+		done ${HOME} ${HOME} && export cd | export printf echo test "$1" "$@" /usr/bin
+	-eu grep && cd grep printf then awk cd
+		sed -eu --verbose && --verbose cd test | && awk
+test "$1" "$1" readonly x=1 done cd &&
+	2>/dev/null test | printf test
+		awk x=1 awk 'quoted text' printf readonly sed then local -eu export cd &&
+	--verbose && done export /usr/bin readonly test readonly --verbose awk
+		'quoted text' -eu grep test done local | done && echo "$@" printf 'quoted text'
+	"$@" x=1 ${HOME} | done 'quoted text' && && export && printf
+cd echo export awk 'quoted text'
+test ${HOME} "$1" test readonly then 'quoted text' done echo /usr/bin 2>/dev/null
+"$1" test | && awk "$@" then printf "$1" -eu "$1" test | "$@"
+		"$1" grep --verbose | && then export done 'quoted text'
+	2>/dev/null test echo "$@" "$@" readonly done
+		cd then echo | ${HOME} x=1 sed cd printf then
+&& echo grep done printf ${HOME} ${HOME}
+	readonly x=1 /usr/bin "$@" export local cd printf "$1" 'quoted text' readonly export
+--verbose && grep done printf then /usr/bin && grep 2>/dev/null
+done echo test grep ${HOME} printf && done "$1" grep --verbose
+	| local test "$1" | then $(pwd) echo
+cd "$@" | printf | -eu cd local sed /usr/bin done 2>/dev/null awk sed "$1"
+		/usr/bin "$@" x=1 export sed awk /usr/bin cd local local cd | done | export
+| printf sed /usr/bin | export then
+	/usr/bin test -eu -eu test $(pwd) --verbose "$@" x=1
+		export | --verbose then | -eu $(pwd) | && local local export 'quoted text' &&
+--verbose sed then readonly sed $(pwd) then
+		sed export export -eu sed 2>/dev/null --verbose "$@" 'quoted text' && -eu
+	/usr/bin --verbose 2>/dev/null /usr/bin && --verbose | grep ${HOME} local
+2>/dev/null then | echo printf "$1" ${HOME} echo echo --verbose
+		--verbose 2>/dev/null $(pwd)
+sed cd grep -eu echo printf export
+/usr/bin "$@" "$1" $(pwd) "$1" readonly 'quoted text'
+		x=1 awk test && done export then && ${HOME} 'quoted text' test -eu echo --verbose
+done awk | done /usr/bin grep readonly sed export then ${HOME} local
+'quoted text' 'quoted text'
+		grep done "$1" done done $(pwd) x=1 $(pwd) local | export 2>/dev/null x=1 "$1" cd
+		local "$1" grep 2>/dev/null 2>/dev/null "$1"
+		test x=1 x=1 "$@" printf x=1 echo | /usr/bin local echo
+"$@" echo done grep && 'quoted text' -eu test ${HOME}
+-eu -eu awk | then local echo local sed grep printf 'quoted text' sed
+echo "$1" -eu 2>/dev/null export 'quoted text' -eu --verbose $(pwd) ${HOME} 2>/dev/null
+		${HOME} awk | sed echo echo readonly printf local /usr/bin $(pwd) $(pwd) sed
+	done local done awk grep /usr/bin local printf test cd --verbose
+x=1 test readonly test | /usr/bin
+export -eu 2>/dev/null cd sed awk
+	sed test --verbose | local cd
+"$@" cd printf cd echo sed readonly x=1 /usr/bin 'quoted text'
+2>/dev/null awk echo done --verbose x=1 readonly test then
+| $(pwd) awk echo sed then 'quoted text' ${HOME} done test then "$@" &&
+		echo $(pwd) /usr/bin echo done cd | done
+done "$1" printf export x=1 cd printf
+readonly "$1" --verbose printf "$1" /usr/bin printf 2>/dev/null cd
+--verbose 2>/dev/null readonly 'quoted text' "$@" 'quoted text'
+	local export "$1" test && $(pwd) x=1 sed
+		sed /usr/bin grep /usr/bin && export echo local ${HOME} x=1
+		echo grep ${HOME} 'quoted text' then awk "$1" $(pwd) local
+x=1 awk $(pwd) "$@" done $(pwd) awk -eu | $(pwd)
+	grep 2>/dev/null printf local cd local 'quoted text' x=1 | "$@" x=1 done cd
+	"$1" readonly -eu "$1" readonly
+		${HOME} printf $(pwd) 'quoted text'
+export grep 'quoted text' "$@" test 'quoted text'
+		'quoted text' 2>/dev/null ${HOME}
+${HOME} /usr/bin echo | --verbose --verbose
+		| local readonly x=1 | awk x=1 $(pwd) 2>/dev/null done ${HOME}
+	cd sed grep 'quoted text' printf
+		printf -eu test grep export
+	2>/dev/null /usr/bin printf then
+	echo "$@" "$@" then awk 'quoted text' awk /usr/bin test readonly
+		x=1 2>/dev/null done 'quoted text' readonly test awk echo
+	2>/dev/null sed x=1 'quoted text' test
+	local $(pwd) ${HOME} --verbose
+		-eu then $(pwd) echo && export export cd readonly "$@" /usr/bin
+sed printf cd local test awk && awk -eu "$1" export 'quoted text'
+export cd sed "$@" then echo sed test $(pwd) awk printf readonly /usr/bin
+	awk "$@" 2>/dev/null echo export echo "$1" done export
+		&& x=1 done /usr/bin grep
+printf echo printf export "$@" "$1" awk cd /usr/bin cd export awk "$@"
+	echo 2>/dev/null awk --verbose done | && /usr/bin
+-eu | -eu 'quoted text' 'quoted text' echo ${HOME} ${HOME} /usr/bin ${HOME}
+	x=1 $(pwd) printf echo then -eu ${HOME} -eu ${HOME} | "$@" echo test
+	"$@" then test x=1 echo /usr/bin --verbose grep
+'quoted text' then -eu grep grep grep | && sed then
+	'quoted text' grep echo printf awk 2>/dev/null -eu grep
+		-eu "$@" && then then $(pwd) grep export | done
+sed "$@" local done /usr/bin grep 2>/dev/null $(pwd) test 2>/dev/null
+	2>/dev/null | "$1" 'quoted text' --verbose
+	test cd ${HOME} awk ${HOME} 2>/dev/null done
+		printf done done "$@" test ${HOME}
+		export echo "$1" local sed cd /usr/bin
+x=1 'quoted text' "$@" printf
+done awk awk test 'quoted text' | | $(pwd)
+	echo test cd | awk awk "$@" -eu
+	test 'quoted text' -eu echo -eu "$@" echo --verbose && /usr/bin export done /usr/bin
+printf x=1 grep | echo x=1
+	printf readonly local sed then -eu /usr/bin -eu export
+/usr/bin export x=1 $(pwd) export 2>/dev/null 2>/dev/null grep /usr/bin
+	printf then done printf printf grep 2>/dev/null && -eu done | then && |
+	test local /usr/bin local cd echo "$@" "$@"
+	2>/dev/null then $(pwd) then -eu $(pwd) /usr/bin
+		local && -eu readonly readonly $(pwd) --verbose echo cd then
+	local "$1" 2>/dev/null export 2>/dev/null --verbose | --verbose sed && && done
+export local /usr/bin 'quoted text'
+	done -eu test sed readonly /usr/bin
+		| && echo export printf done x=1 'quoted text' printf 'quoted text'
+	then sed x=1 'quoted text'
+		grep grep 2>/dev/null /usr/bin 2>/dev/null /usr/bin readonly
+	then /usr/bin local echo awk export
+	"$1" grep test x=1 $(pwd) printf /usr/bin then then /usr/bin local
+sed printf $(pwd) grep 'quoted text'
+	${HOME} echo --verbose sed cd $(pwd)
+readonly x=1 "$1" x=1 --verbose then grep -eu local 2>/dev/null then test
+	2>/dev/null | test --verbose then
+		$(pwd) local $(pwd) grep /usr/bin then ${HOME}
+	cd | ${HOME} awk grep $(pwd) 'quoted text'
+'quoted text' readonly grep awk local
+	| $(pwd) "$1" awk echo /usr/bin echo -eu
+		local grep test | grep x=1 $(pwd) "$1" then local echo readonly "$@"
+$(pwd) x=1 readonly --verbose done "$@"
+		| grep test then export printf -eu echo local done grep --verbose
+	cd && "$1" export "$1" 'quoted text'
+		readonly echo "$@" local "$@" 2>/dev/null
+| done ${HOME} ${HOME} "$1" cd 2>/dev/null grep 2>/dev/null &&
+		readonly readonly "$@" /usr/bin sed cd "$@" then 2>/dev/null printf --verbose
+		"$1" awk 'quoted text' && 2>/dev/null
+echo sed awk readonly test $(pwd) sed readonly x=1 readonly awk local
+		readonly --verbose sed sed echo then 'quoted text'
+&& ${HOME} | $(pwd) -eu && grep -eu && "$1" done echo x=1 printf
+		2>/dev/null 2>/dev/null $(pwd) sed cd "$@" printf 2>/dev/null --verbose $(pwd)
+'quoted text' ${HOME} cd $(pwd) cd | "$@" --verbose test cd awk 2>/dev/null --verbose
+		/usr/bin sed then test sed cd x=1 $(pwd) -eu readonly
+		-eu "$1" 'quoted text' | 2>/dev/null
+	$(pwd) 2>/dev/null test local 'quoted text' /usr/bin test
+printf export cd && "$@" /usr/bin printf export
+"$@" echo then -eu && x=1 then local sed readonly 2>/dev/null grep | export
+&& then then $(pwd) sed /usr/bin | done readonly done cd
+-eu --verbose x=1 test cd ${HOME} $(pwd) sed
+"$1" 2>/dev/null grep $(pwd)
+		grep then 2>/dev/null grep ${HOME} local "$1" echo "$1" x=1
+"$1" local local cd | test grep --verbose -eu cd --verbose sed
+	/usr/bin echo readonly $(pwd) -eu --verbose then 2>/dev/null
+${HOME} grep && 2>/dev/null | 'quoted text' 2>/dev/null done
+		readonly test $(pwd) $(pwd)
+echo 2>/dev/null "$@" grep ${HOME} done ${HOME} export
+		'quoted text' $(pwd) "$@" && export then
+		x=1 --verbose cd 2>/dev/null
+grep export "$1" local -eu readonly &&
+	--verbose sed "$1" 2>/dev/null
+	then ${HOME} grep | | | 2>/dev/null then $(pwd)
+		${HOME} --verbose awk test echo
+		2>/dev/null "$@" && -eu
+	/usr/bin cd /usr/bin $(pwd) readonly
+2>/dev/null 'quoted text' done "$@" /usr/bin echo | cd test 'quoted text'
+"$1" then 'quoted text' 2>/dev/null && printf && $(pwd) 2>/dev/null --verbose
+	$(pwd) "$@" export $(pwd) printf --verbose
+		local cd | | done | awk && cd echo ${HOME} 2>/dev/null readonly --verbose
+		readonly readonly x=1 2>/dev/null
+	grep --verbose sed grep && awk $(pwd) 'quoted text' sed x=1 awk -eu cd
+x=1 | /usr/bin --verbose | --verbose ${HOME} | && /usr/bin -eu | awk
+cd grep -eu --verbose grep awk ${HOME} local
+readonly && grep && | then x=1 local printf "$1" "$@" &&
+done awk test ${HOME} test local ${HOME} echo $(pwd) x=1 then $(pwd)
+		local "$@" 2>/dev/null then $(pwd) && grep
+	cd --verbose readonly
+		echo "$1" local readonly printf ${HOME} | grep
+test && sed x=1 sed --verbose test
+grep /usr/bin local cd export
+		test ${HOME} 'quoted text'
+		echo -eu | cd export && ${HOME} "$1" test $(pwd) local "$1"
+	x=1 then awk "$@" sed awk --verbose 'quoted text' /usr/bin --verbose
+		&& /usr/bin 'quoted text' && 2>/dev/null /usr/bin local
+		'quoted text' cd grep x=1 sed grep ${HOME} test "$1" grep test local
+		export && done awk /usr/bin done cd
+		2>/dev/null printf then done 2>/dev/null /usr/bin export 2>/dev/null
+x=1 then "$1" --verbose local done awk --verbose
+	"$@" "$@" 'quoted text' x=1 printf export "$1" $(pwd) cd | | cd readonly sed
+then cd then done grep grep done then done then echo
+		"$@" 'quoted text' cd --verbose | -eu "$1" | x=1 grep echo cd echo grep "$1"
+	awk local readonly sed test export ${HOME} /usr/bin awk done test
+sed cd local 2>/dev/null "$@" ${HOME}
+	-eu "$@" /usr/bin done ${HOME} /usr/bin echo test sed && "$1" /usr/bin ${HOME}
+		$(pwd) awk $(pwd) ${HOME} sed /usr/bin done then export
+		--verbose ${HOME} ${HOME} && awk 'quoted text' 2>/dev/null
+	2>/dev/null export "$1" done -eu echo | echo cd done done ${HOME} $(pwd)
+"$1" --verbose cd readonly local 2>/dev/null "$@"
+| && done grep readonly "$@" awk "$@" --verbose test
+	readonly local /usr/bin "$1" echo awk sed grep $(pwd) | /usr/bin
+	$(pwd) grep test echo awk export "$1"
+	echo --verbose | && 'quoted text' /usr/bin
+		printf readonly --verbose awk then "$@" "$1" | -eu /usr/bin
+"$@" done export awk echo ${HOME} cd $(pwd) $(pwd)
+awk local export then then "$1" "$@" "$@" $(pwd) local echo
+local ${HOME} test printf test
+sed 'quoted text' grep --verbose export cd local
+	sed test readonly -eu "$1" readonly cd -eu done printf grep test /usr/bin readonly
+		--verbose grep 2>/dev/null local "$@" "$1" local then printf
+	local sed awk test ${HOME} awk readonly then ${HOME} --verbose done printf
+	done /usr/bin then test && awk readonly export grep "$@" sed "$1" sed local
+		x=1 export x=1 | done echo 'quoted text' grep printf test awk ${HOME} test
+		/usr/bin "$@" -eu grep sed done &&
+		/usr/bin test -eu --verbose cd export 'quoted text' "$1" /usr/bin
+$(pwd) printf 2>/dev/null ${HOME} --verbose $(pwd) cd
+cd grep 2>/dev/null awk 2>/dev/null
+2>/dev/null 'quoted text'
+	'quoted text' /usr/bin test export grep then "$@" then ${HOME}
+	printf && done printf -eu 'quoted text' --verbose -eu test "$@" &&
+-eu awk then printf -eu printf then export $(pwd) -eu done
+		'quoted text' /usr/bin grep export printf grep local
+		done test -eu --verbose | sed done
+--verbose echo | "$1" awk
+		local --verbose x=1 test /usr/bin "$@" x=1 $(pwd)
+		grep readonly --verbose done
+		${HOME} 2>/dev/null grep
+	sed cd grep x=1 then export ${HOME} done local awk export "$1" export test && &&
+		| | grep test -eu /usr/bin then 2>/dev/null export && | "$@" awk 'quoted text' &&
+| local printf 'quoted text' | $(pwd) "$1" /usr/bin 2>/dev/null printf $(pwd) export
+		grep $(pwd) then -eu $(pwd)
+	2>/dev/null grep --verbose
+"$@" 2>/dev/null local cd && --verbose
+		| cd test grep $(pwd) export
+&& && then 'quoted text' "$@" readonly
+	$(pwd) "$1" "$@" then sed cd --verbose && | readonly
+		"$@" awk done echo test --verbose --verbose grep -eu $(pwd) "$1" x=1
+		done export "$@" export echo
+	--verbose | --verbose sed -eu sed local ${HOME} /usr/bin
+		then test local test "$1" grep 'quoted text' cd /usr/bin && "$1" grep export &&
+		'quoted text' done awk done "$1" cd grep readonly && x=1
+--verbose /usr/bin x=1 'quoted text' 'quoted text' --verbose
+	grep --verbose then test ${HOME} readonly
+		${HOME} --verbose x=1 'quoted text' then awk awk | printf sed
+		echo sed "$@" cd "$1" echo ${HOME} done "$@" 2>/dev/null
+/usr/bin $(pwd) 'quoted text' awk $(pwd)
+export $(pwd) then echo then readonly x=1 ${HOME} readonly echo sed export
+done awk grep 'quoted text'
+		test 2>/dev/null grep echo /usr/bin
+		printf then $(pwd) -eu x=1 --verbose export 2>/dev/null 2>/dev/null done grep
+		"$@" ${HOME} readonly sed
+--verbose -eu $(pwd) "$@" readonly grep printf
+		export --verbose "$1" x=1 local /usr/bin grep /usr/bin cd echo
+	'quoted text' printf echo "$@" "$1" 2>/dev/null printf
+	/usr/bin "$1" export readonly 2>/dev/null then cd grep -eu local ${HOME} ${HOME}
+		local printf awk local readonly
+	-eu cd then 2>/dev/null grep local $(pwd) 2>/dev/null cd done test echo
+		$(pwd) -eu --verbose --verbose
+	${HOME} local export test && ${HOME} done 2>/dev/null sed awk sed "$@"
+	export then "$1" export readonly $(pwd) test "$@" /usr/bin then "$1" /usr/bin
+	cd "$1" echo cd -eu readonly $(pwd) "$@" cd $(pwd) sed && awk $(pwd) "$@" 2>/dev/null
+	cd 2>/dev/null cd sed cd 2>/dev/null
+2>/dev/null ${HOME} && cd cd
+| "$1" 'quoted text' | && sed 2>/dev/null x=1 cd 2>/dev/null "$@" | local cd "$@"
+	sed printf 2>/dev/null | then $(pwd)
+	test done -eu "$@" | test "$@" then $(pwd) local awk grep x=1 -eu "$1" -eu
+		'quoted text' && /usr/bin "$1" /usr/bin "$1" awk $(pwd)
+		"$@" | 2>/dev/null "$@" $(pwd)
+		"$1" /usr/bin "$1" "$@" done "$1" | test /usr/bin
+	echo local readonly sed x=1 local 'quoted text'
+	-eu cd --verbose sed 2>/dev/null 2>/dev/null "$@" --verbose "$1"
+-eu then grep readonly $(pwd) test 2>/dev/null --verbose test
+		test local "$@" && 'quoted text' local 'quoted text' $(pwd)
+	echo | echo export "$@" local "$@" then echo $(pwd) echo -eu sed
+		| printf done local 2>/dev/null local
+local "$1" | 'quoted text' local local --verbose "$@" 2>/dev/null cd x=1 /usr/bin
+	| grep 2>/dev/null awk printf test 'quoted text'
+	sed -eu "$1" "$@" readonly ${HOME} readonly then sed $(pwd) grep grep
+		sed --verbose export grep printf ${HOME} echo ${HOME} printf echo local
+		'quoted text' $(pwd) x=1 'quoted text' local echo done && then 'quoted text'
+	2>/dev/null readonly -eu 'quoted text' 'quoted text'
+	2>/dev/null && echo readonly
+		'quoted text' test test local local readonly "$1"
+		2>/dev/null -eu export grep 'quoted text' "$1" "$1"
+	$(pwd) readonly 'quoted text' && /usr/bin "$1" export grep cd readonly
+"$@" 2>/dev/null --verbose -eu test readonly test test readonly printf
+then readonly -eu local printf grep then
+		export local x=1 /usr/bin done && 'quoted text'
+		readonly --verbose then --verbose export -eu "$1" -eu
+		--verbose 'quoted text' ${HOME} local x=1 | "$1" "$1" --verbose echo grep x=1
+	awk printf && then awk 2>/dev/null --verbose && ${HOME}
+		export "$@" $(pwd) printf test $(pwd) then grep echo awk
+-eu sed export local grep /usr/bin "$1" 2>/dev/null $(pwd) ${HOME} cd "$@"
+		then export done grep | grep cd
+/usr/bin cd cd x=1 $(pwd)
+		"$@" awk 2>/dev/null ${HOME} local && awk export
+grep local done -eu awk then | done readonly
+	local export $(pwd) $(pwd) done test test echo
+		cd 'quoted text' test 'quoted text' ${HOME} x=1 cd | 'quoted text'
+		"$@" /usr/bin readonly /usr/bin 'quoted text' done --verbose
+	done ${HOME} test && "$1" ${HOME} --verbose done then cd cd
+		"$1" && sed export test 'quoted text' readonly export local then
+	| awk $(pwd) ${HOME} local awk done readonly cd echo then printf export |
+"$1" readonly --verbose local $(pwd) /usr/bin
+-eu $(pwd) | 2>/dev/null readonly && 'quoted text' sed printf
+		$(pwd) export sed printf export printf sed --verbose
+		'quoted text' local | then then then "$@" && "$1"
+echo awk cd grep awk then "$@" cd readonly echo ${HOME}
+	awk /usr/bin 2>/dev/null done 'quoted text'
+cd readonly --verbose done 2>/dev/null "$1" readonly 'quoted text'
+export then awk test awk && sed --verbose && awk
+test -eu grep awk ${HOME} cd grep -eu "$@"
+	2>/dev/null --verbose export "$@" grep /usr/bin cd
+		echo /usr/bin 'quoted text' 'quoted text' --verbose /usr/bin cd 'quoted text'
+sed awk | -eu -eu && 'quoted text' "$1" "$@" cd -eu --verbose
+	/usr/bin "$1" readonly | printf local "$1" | 'quoted text' && printf 2>/dev/null
+		printf then readonly ${HOME} printf test
+	done 'quoted text' x=1 awk x=1 awk /usr/bin 'quoted text' grep then
+		local then /usr/bin -eu "$@" 2>/dev/null
+	echo -eu grep echo local local && "$1" && done && test awk $(pwd) export x=1
+		local then $(pwd) x=1 done cd echo done grep awk --verbose
+	&& test then printf done x=1 --verbose
+	export sed export --verbose | test test grep -eu cd printf -eu cd local
+"$1" 'quoted text' echo sed | "$1" "$@"
+-eu "$1" /usr/bin -eu done /usr/bin then && sed
+/usr/bin --verbose "$@" then readonly local "$@" ${HOME}
+echo then export 2>/dev/null sed 'quoted text' ${HOME} printf
+	readonly --verbose export
+		cd /usr/bin done awk && "$1" done 2>/dev/null | done "$1" --verbose "$1"
+| -eu then ${HOME} x=1 x=1 awk done done local
+'quoted text' | "$@" --verbose "$@"
+cd "$1" readonly export test ${HOME} sed ${HOME} readonly
+'quoted text' export /usr/bin awk | $(pwd) -eu
+		2>/dev/null 2>/dev/null grep x=1 && 2>/dev/null $(pwd)
+	/usr/bin cd export cd -eu ${HOME} printf ${HOME} printf readonly
+	-eu echo x=1 ${HOME} "$1" cd && $(pwd) sed x=1 local done grep "$1" ${HOME}
+		--verbose ${HOME} $(pwd) readonly cd && grep printf printf
+	"$1" | "$@" cd --verbose grep echo printf cd
+		&& done cd echo echo grep
+		"$1" test 'quoted text' 'quoted text' echo done done | done
+		'quoted text' -eu /usr/bin sed $(pwd) 2>/dev/null 2>/dev/null /usr/bin awk
+	sed -eu 2>/dev/null export test "$1" -eu 'quoted text' local --verbose printf
+		done --verbose 'quoted text'
+${HOME} printf x=1 sed sed 'quoted text' --verbose x=1 done | done done
+	${HOME} -eu 'quoted text' cd
+		local cd 'quoted text' | &&
+	local "$1" test 'quoted text' "$1" echo printf sed ${HOME} echo
+		${HOME} local ${HOME} awk
+		"$@" "$1" test ${HOME} /usr/bin 'quoted text'
+	-eu && grep x=1 printf test $(pwd) grep "$@" grep sed
+		then $(pwd) done && | awk export $(pwd) | 2>/dev/null
+		readonly sed --verbose && /usr/bin readonly -eu 'quoted text' readonly test readonly
+	local test done then 'quoted text' sed test | ${HOME} /usr/bin -eu -eu
+		readonly test x=1 done | "$1" "$@" /usr/bin awk ${HOME}
+	--verbose readonly -eu ${HOME} ${HOME} export
+		grep sed --verbose 2>/dev/null echo local done printf --verbose $(pwd)
+readonly x=1 'quoted text' x=1 cd test "$@" x=1 -eu
+grep 2>/dev/null grep -eu grep awk awk $(pwd) 2>/dev/null export then
+	x=1 then 2>/dev/null && then "$1" "$1" readonly cd local
+	local "$1" cd "$1" echo sed | -eu done export sed
+		| printf readonly grep readonly readonly local
+		cd x=1 then done echo sed export awk sed -eu 'quoted text' readonly cd -eu readonly
+test && readonly grep then | 2>/dev/null "$1"
+		--verbose export sed "$@" printf then export awk awk cd | grep 2>/dev/null
+	2>/dev/null ${HOME} "$1"
+	"$@" local echo && done ${HOME} then local awk grep
+		printf cd then 'quoted text'
+		${HOME} export echo local
+	then /usr/bin sed ${HOME} test && | export local 'quoted text' ${HOME} export
+	grep $(pwd) awk 'quoted text' | awk test 'quoted text' local grep awk grep /usr/bin
+		local && done test -eu x=1 && /usr/bin test echo "$@" ${HOME} --verbose
+	x=1 cd "$@" cd 2>/dev/null cd
+printf then --verbose grep test 'quoted text' "$@" echo && --verbose
+		printf awk then printf && |
+	'quoted text' local x=1 "$1" done local done test && echo 'quoted text' test --verbose
+	${HOME} | test sed 2>/dev/null
+	$(pwd) test -eu 'quoted text'
+"$@" echo 2>/dev/null
+then grep cd printf printf grep $(pwd) readonly
+		export 2>/dev/null x=1 grep test ${HOME} && echo grep
+		grep --verbose done cd cd echo grep printf done "$@" && printf readonly cd test
+	| export /usr/bin | printf /usr/bin echo $(pwd) "$@" "$@"
+#include c174.sh
+		then "$1" --verbose grep "$@" test awk cd local
+		--verbose test --verbose "$1" x=1
+	| /usr/bin -eu --verbose test grep | 2>/dev/null echo "$@" /usr/bin test
+		/usr/bin awk readonly --verbose
+		grep awk sed x=1 printf | && cd readonly echo local
+		printf "$@" 'quoted text' printf "$1"
+	/usr/bin $(pwd) 'quoted text' local cd test then cd 'quoted text'
+export "$@" ${HOME} /usr/bin "$@" test --verbose export /usr/bin | | /usr/bin
+	| ${HOME} 2>/dev/null printf printf -eu ${HOME}
+		2>/dev/null 'quoted text' 'quoted text' "$@" grep
+grep 'quoted text' && -eu echo -eu "$@" $(pwd) test 2>/dev/null
+		sed && "$1" "$@" 2>/dev/null | 2>/dev/null /usr/bin && then sed awk /usr/bin sed
+	done then | echo done readonly
+	echo done export ${HOME} x=1 awk | local ${HOME} readonly "$1" echo x=1 readonly
+"$@" echo ${HOME} local &&
+| cd then awk $(pwd) awk export 'quoted text' printf export 'quoted text'
+	"$1" grep export done 'quoted text' --verbose
+		| --verbose printf "$@" export | x=1 "$1" "$1" sed "$1" done awk test printf
+		printf readonly -eu 2>/dev/null export export local done test awk done
+		&& echo done "$@" "$1" -eu "$1" test readonly -eu $(pwd)
+		cd then ${HOME} cd test grep cd grep
+		x=1 export --verbose 2>/dev/null
+		&& x=1 'quoted text' 2>/dev/null
+export readonly readonly && "$1" grep awk 'quoted text' -eu done grep "$@" cd then
+	printf ${HOME} sed echo /usr/bin test
+		$(pwd) grep "$1" grep done $(pwd)
+		${HOME} ${HOME} --verbose | grep x=1 'quoted text' && awk "$@" local -eu ${HOME}
+		test done | 'quoted text' echo sed done --verbose ${HOME} local --verbose echo then
+	"$1" --verbose $(pwd) && grep --verbose $(pwd) $(pwd) -eu | echo then x=1 'quoted text'
+	| $(pwd) echo /usr/bin && test then 2>/dev/null
+		${HOME} echo test x=1 done awk ${HOME} cd local awk x=1 "$@" "$@" $(pwd)
+	${HOME} 2>/dev/null -eu grep /usr/bin
+	then echo 'quoted text' --verbose | x=1 'quoted text' 'quoted text' 'quoted text'
+		-eu "$@" ${HOME} echo x=1 then grep ${HOME} cd "$1" | local --verbose
+-eu 'quoted text' ${HOME} 2>/dev/null readonly /usr/bin done sed
+	echo 2>/dev/null test grep 2>/dev/null && && "$1"
+	-eu | local done x=1 cd "$1" then readonly sed |
+		done ${HOME} ${HOME} "$1" && readonly done sed "$@" | --verbose awk "$1"
+	local -eu printf grep echo x=1 x=1 2>/dev/null
+	export x=1 local $(pwd) cd 'quoted text' echo echo cd 'quoted text' local |
+	cd && -eu -eu $(pwd) cd grep printf 2>/dev/null x=1 test
+	grep export && $(pwd) -eu local printf /usr/bin awk echo 'quoted text'
+	cd cd /usr/bin | done awk $(pwd) readonly 2>/dev/null
+	printf done -eu --verbose --verbose x=1 ${HOME} --verbose grep local -eu ${HOME}
+		/usr/bin /usr/bin done 2>/dev/null -eu | -eu export | 2>/dev/null
+	cd sed printf --verbose done --verbose test | | echo 2>/dev/null
+		/usr/bin echo 2>/dev/null -eu --verbose x=1 sed ${HOME} ${HOME} test
+'quoted text' sed test readonly "$1" && && "$1"
+		local "$@" /usr/bin --verbose export
+		sed echo local done ${HOME} x=1 -eu 2>/dev/null readonly 2>/dev/null done
+	&& export awk echo local -eu && printf 2>/dev/null sed awk ${HOME} grep 'quoted text'
+		"$@" grep ${HOME} "$1" cd "$@" && printf
+	test 2>/dev/null --verbose $(pwd) /usr/bin 2>/dev/null
+readonly "$@" "$@" printf $(pwd) -eu --verbose "$1" readonly
+	done x=1 cd test export --verbose /usr/bin readonly
+	cd $(pwd) && -eu -eu awk x=1 -eu
+		2>/dev/null awk x=1 | ${HOME} local then export then | grep x=1 export
+	awk $(pwd) $(pwd) export --verbose
+	2>/dev/null /usr/bin /usr/bin readonly
+	$(pwd) local x=1 printf export | ${HOME} test test grep then "$@" local local
+	x=1 sed then "$1" $(pwd) $(pwd) 'quoted text' --verbose
+	awk echo | x=1 sed echo readonly ${HOME}
+	local --verbose awk awk /usr/bin | grep local readonly sed
+awk "$@" $(pwd) done --verbose "$1" /usr/bin printf &&
+&& "$1" done x=1 then
+		local $(pwd) done 'quoted text' --verbose "$@" --verbose
+-eu --verbose --verbose $(pwd) | local && | awk $(pwd) readonly
+		"$1" echo x=1 2>/dev/null then readonly "$1" test "$@"
+		awk ${HOME} export --verbose $(pwd) awk $(pwd) local x=1
+sed sed | 2>/dev/null readonly $(pwd) "$1" local | && ${HOME} --verbose
+		export cd "$@" sed --verbose "$@" -eu |
+printf awk done && ${HOME} sed readonly "$@" && cd /usr/bin "$@" "$1" sed
+| "$1" readonly grep echo "$@" ${HOME} test 2>/dev/null --verbose "$@" 'quoted text'
+		$(pwd) x=1 then then sed printf echo cd then cd | && readonly /usr/bin
+		awk export "$@" && sed "$1" awk cd &&
+$(pwd) /usr/bin -eu test then ${HOME} 'quoted text' /usr/bin x=1 done --verbose
+	then "$1" 2>/dev/null export
+awk ${HOME} test x=1 "$@" ${HOME} ${HOME} | then export
+		printf /usr/bin && done "$1" sed -eu
+		'quoted text' 2>/dev/null awk then ${HOME} /usr/bin $(pwd) printf --verbose
+		2>/dev/null ${HOME} 2>/dev/null
+		echo sed readonly -eu test 'quoted text' then 'quoted text' --verbose
+	2>/dev/null $(pwd) echo ${HOME} | readonly
+	echo x=1 done && 2>/dev/null grep |
+	local export 2>/dev/null "$1" --verbose printf 2>/dev/null
+		x=1 grep grep echo done export
+	cd -eu done | --verbose echo --verbose
+		&& "$@" && && sed printf
+--verbose echo -eu "$@" grep 'quoted text' "$@" awk cd /usr/bin 2>/dev/null --verbose
+	local --verbose echo cd | local x=1 $(pwd) 2>/dev/null | x=1
+		"$@" done 2>/dev/null then done ${HOME} $(pwd)
+	sed /usr/bin cd awk --verbose local ${HOME} done grep "$@" 2>/dev/null |
+		done awk /usr/bin printf done /usr/bin
+-eu export 'quoted text' done then 2>/dev/null
+	-eu && done cd sed ${HOME} -eu "$@" "$1" -eu readonly
+	done printf "$1" test && local --verbose cd
+	grep then test x=1 && && export sed $(pwd) ${HOME} 2>/dev/null
+	| sed then --verbose echo --verbose cd local done 2>/dev/null
+test grep $(pwd) awk $(pwd) x=1 "$1" then cd printf
+	--verbose awk 'quoted text' --verbose /usr/bin -eu
+export 2>/dev/null $(pwd) echo $(pwd) 'quoted text' x=1 awk
+	done local "$@" then 'quoted text' && export --verbose
+	&& -eu $(pwd) then printf awk sed echo test sed ${HOME} grep local awk
+		"$@" printf done && "$1" /usr/bin test "$1" done
+local done --verbose sed export
+	sed | x=1 cd | --verbose then awk sed /usr/bin echo grep
+/usr/bin && local echo sed | cd "$@" local echo export awk cd readonly "$1" echo
+x=1 2>/dev/null local cd "$@" && -eu 'quoted text' -eu --verbose $(pwd)
+	x=1 x=1 -eu echo x=1 'quoted text' sed test local sed ${HOME} "$1" x=1
+		awk -eu | local printf
+| /usr/bin $(pwd) 'quoted text' cd -eu local cd "$@"
+		/usr/bin ${HOME} | 'quoted text' -eu sed
+		x=1 echo local awk $(pwd) -eu grep then "$1" done 'quoted text' | ${HOME} 'quoted text'
+		printf export local awk
+	awk | | done echo printf x=1 readonly test ${HOME} sed 2>/dev/null
+	export | then | x=1 printf awk --verbose printf test then ${HOME}
+		&& printf sed 2>/dev/null grep printf /usr/bin "$@" awk readonly
+done done | x=1 2>/dev/null -eu test "$1" readonly done x=1 /usr/bin /usr/bin
+	printf sed echo 2>/dev/null --verbose "$@" "$@" && --verbose x=1 echo ${HOME}
+${HOME} -eu grep $(pwd)
+		awk $(pwd) 'quoted text' -eu local | -eu test test "$1"
+	then then sed | cd awk | awk test 2>/dev/null -eu "$@" /usr/bin ${HOME}
+		${HOME} 'quoted text' done /usr/bin awk $(pwd) && "$1" -eu -eu /usr/bin "$1" $(pwd)
+		export then ${HOME} cd ${HOME} local 'quoted text' 'quoted text'
+	readonly | sed echo "$@" "$@" awk ${HOME} awk readonly -eu --verbose done
+		"$@" | $(pwd) --verbose |
+		sed x=1 sed 'quoted text' local local
+		'quoted text' 'quoted text' local -eu --verbose ${HOME}
+		grep ${HOME} "$@" printf -eu local /usr/bin "$@" x=1 2>/dev/null done local /usr/bin
+	printf "$1" ${HOME} && $(pwd) && export readonly test "$1" "$1" then
+	| && "$1" local export sed grep sed ${HOME} local |
+	--verbose done echo echo 2>/dev/null done
+	readonly "$@" export /usr/bin done ${HOME}
+sed printf local readonly && awk 2>/dev/null local $(pwd)
+		"$@" test echo echo -eu test -eu $(pwd)
+grep readonly cd 'quoted text'
+		x=1 -eu echo export local "$1" && printf $(pwd) readonly readonly $(pwd)
+	echo sed /usr/bin done local awk -eu $(pwd) local readonly
+	${HOME} printf grep | echo then "$1" ${HOME} x=1 "$@" done then && 2>/dev/null
+$(pwd) grep 'quoted text' "$1" | awk /usr/bin then echo
+	--verbose "$@" test local done printf
+readonly printf "$1" local && $(pwd) && 'quoted text' grep | ${HOME}
+		readonly 2>/dev/null done -eu done $(pwd) printf ${HOME} printf
+&& done grep local then
+	local grep grep readonly printf && |
+		done x=1 printf cd awk done printf readonly | grep printf 2>/dev/null then
+	-eu awk grep cd /usr/bin grep cd -eu -eu && ${HOME} awk sed then export "$1"
+printf printf export echo /usr/bin $(pwd) done then -eu -eu
+		--verbose done awk -eu 'quoted text' test "$@" --verbose
+		&& /usr/bin grep export && then echo ${HOME}
+		${HOME} "$@" "$@" then cd cd /usr/bin grep test $(pwd) sed $(pwd)
+		"$1" then test $(pwd) grep
+		"$1" | readonly ${HOME} 2>/dev/null printf echo sed test grep cd then
+		printf test /usr/bin done then awk test "$1" -eu printf test
+	local && --verbose x=1 "$@" -eu local then export
+		done done awk sed export "$1" ${HOME} 'quoted text' readonly --verbose
+test sed 2>/dev/null ${HOME} printf 2>/dev/null | printf --verbose awk grep "$1"
+		/usr/bin "$1" 'quoted text' 'quoted text' readonly awk 2>/dev/null x=1 2>/dev/null
+	-eu readonly --verbose done printf "$@" ${HOME} 'quoted text' --verbose cd
+		awk /usr/bin -eu 'quoted text' x=1 --verbose && sed sed --verbose
+		done awk ${HOME} $(pwd) readonly --verbose "$@" printf "$1" readonly awk echo
+$(pwd) grep "$@" "$1" printf printf grep 'quoted text' x=1 "$1" |
+-eu echo then /usr/bin && 2>/dev/null sed sed sed local
+printf 2>/dev/null &&
+-eu $(pwd) readonly "$1" test awk "$1" sed then local x=1 awk && grep "$1" grep
+	"$@" then echo --verbose local echo printf printf /usr/bin ${HOME} then
+		--verbose && sed export "$1" readonly
+		"$@" local && done grep cd echo printf sed /usr/bin && sed test sed printf echo
+		&& "$@" printf cd ${HOME} test printf 2>/dev/null -eu local && -eu cd
+	test --verbose test /usr/bin /usr/bin "$1" -eu sed && sed printf
+	2>/dev/null readonly test test | "$@" done
+		done x=1 | -eu done then --verbose 'quoted text' 'quoted text'
+x=1 'quoted text' export "$1" export -eu local sed awk readonly --verbose
+	readonly -eu export $(pwd) x=1
+| -eu done then local echo printf
+	x=1 --verbose "$1" export && echo 2>/dev/null
+	then && cd readonly then && awk -eu done
+	x=1 export /usr/bin --verbose /usr/bin "$@" printf cd awk
+		2>/dev/null 2>/dev/null /usr/bin
+sed && "$1" done cd 2>/dev/null test
+-eu export | | "$1" ${HOME} echo
+readonly ${HOME} done readonly 2>/dev/null "$1" echo
+		readonly ${HOME} "$1" | awk
+	awk 2>/dev/null grep export then cd test "$1" done echo readonly "$1" ${HOME} 2>/dev/null
+	--verbose awk 2>/dev/null 2>/dev/null && 2>/dev/null
+	"$@" readonly test "$@" readonly local readonly $(pwd) echo $(pwd)
+	$(pwd) awk 'quoted text' done 'quoted text'
+		x=1 --verbose then test 'quoted text' then
+	2>/dev/null $(pwd) awk
+		x=1 cd 'quoted text' sed && | x=1 awk $(pwd) |
+	printf ${HOME} /usr/bin 2>/dev/null readonly
+${HOME} export "$@" done then export | --verbose echo
+		sed "$@" echo awk sed readonly && "$1" sed sed x=1 && 2>/dev/null
+	'quoted text' grep local --verbose printf test
+x=1 grep 'quoted text' $(pwd)
+	/usr/bin echo cd sed 'quoted text'
+	--verbose 2>/dev/null readonly local awk grep && "$@" 2>/dev/null $(pwd) | done
+		"$@" 2>/dev/null awk /usr/bin
+	${HOME} $(pwd) printf "$1" $(pwd) printf 2>/dev/null && --verbose sed
+"$1" echo printf && test $(pwd) test 2>/dev/null test | -eu cd $(pwd) printf &&
+	"$1" "$@" test /usr/bin echo "$@" | 'quoted text' "$1"
+	${HOME} awk -eu $(pwd) --verbose && test "$@" sed "$1" awk 2>/dev/null
+cd "$@" x=1 2>/dev/null "$@"
+		x=1 "$1" 'quoted text' ${HOME} x=1 local grep 'quoted text'
+		/usr/bin local awk done printf "$@" x=1
+		readonly export -eu cd test -eu local 2>/dev/null
+grep grep -eu cd "$1" && sed 2>/dev/null ${HOME} && local "$1" $(pwd) 'quoted text'
+readonly "$1" "$1" sed && awk cd 'quoted text' done printf
+awk echo | readonly printf "$@" $(pwd) grep | x=1 sed 2>/dev/null grep -eu grep
+-eu 2>/dev/null awk && "$1"
+-eu /usr/bin "$@" printf then && printf
+$(pwd) $(pwd) x=1 'quoted text' printf
+		readonly local export && ${HOME} | cd ${HOME} sed readonly done
+| printf /usr/bin printf -eu /usr/bin
+		grep export x=1 test /usr/bin echo grep grep local --verbose x=1 awk cd grep test
+readonly "$@" then done ${HOME} "$@" grep awk printf then
+grep "$@" "$@" ${HOME} done sed local 2>/dev/null
+	sed /usr/bin echo grep done
+	x=1 printf test export done "$1" local grep 2>/dev/null
+	| /usr/bin sed | sed $(pwd) 'quoted text' -eu
+	"$1" ${HOME} --verbose "$@" /usr/bin -eu test local then
+	sed -eu --verbose readonly grep echo readonly 'quoted text'
+	-eu grep grep sed "$@" done $(pwd) $(pwd) local /usr/bin --verbose readonly
+	"$1" ${HOME} cd --verbose export $(pwd) then printf "$1" x=1 -eu printf "$@" | "$@"
+		2>/dev/null --verbose local printf
+		| local | -eu "$@" export "$1" cd done awk echo test ${HOME}
+		&& /usr/bin test --verbose awk "$1" x=1 awk then 'quoted text' -eu local echo |
+		"$1" done printf "$1" ${HOME}
+	2>/dev/null && sed x=1 "$@" grep echo readonly ${HOME} "$@" x=1 echo local
+	printf test awk grep done readonly $(pwd) 'quoted text'
+	then cd -eu "$@" "$@" 'quoted text' 2>/dev/null
+/usr/bin "$@" --verbose | /usr/bin echo test /usr/bin readonly export $(pwd) --verbose
+	test $(pwd) grep 2>/dev/null $(pwd) awk 'quoted text' then grep /usr/bin
+	cd -eu | readonly && done ${HOME}
+	cd "$@" printf 'quoted text' 2>/dev/null done
+		then -eu then ${HOME}
+local 2>/dev/null readonly x=1 done printf -eu "$1" "$@" awk echo --verbose
+	printf local then --verbose --verbose
+&& /usr/bin --verbose test 2>/dev/null
+	awk cd x=1 'quoted text' sed readonly
+		-eu grep local test printf test | "$1" "$1" "$@" grep readonly
+		&& x=1 done sed "$@" echo awk
+	printf test grep ${HOME} done "$1" grep $(pwd) sed sed done -eu export export
+export local readonly --verbose awk "$@" export local "$@" | 2>/dev/null 'quoted text'
+	readonly printf done printf local 'quoted text'
+	export done 'quoted text' then readonly sed $(pwd) 'quoted text' readonly 2>/dev/null
+test echo $(pwd) readonly && printf cd export export
+	'quoted text' then ${HOME} 2>/dev/null --verbose then then
+x=1 ${HOME} printf readonly then then 2>/dev/null grep -eu /usr/bin
+&& "$1" local /usr/bin && done x=1 | done printf
+&& -eu then --verbose then "$1" grep --verbose export printf "$@" export
+x=1 grep sed | 2>/dev/null
+test cd /usr/bin /usr/bin -eu &&
+-eu readonly "$@" && readonly echo --verbose ${HOME} $(pwd) | readonly --verbose
+		sed awk --verbose awk && sed
+		'quoted text' done /usr/bin done --verbose 'quoted text'
+		awk && echo done echo then -eu test readonly
+	$(pwd) && done "$@" test 2>/dev/null
+	export --verbose readonly 'quoted text'
+		&& /usr/bin --verbose printf $(pwd)
+		'quoted text' x=1 x=1 test sed local printf readonly readonly
+	"$1" awk --verbose test --verbose sed grep /usr/bin /usr/bin awk "$1"
+		"$@" "$@" 2>/dev/null test $(pwd) --verbose readonly "$1" --verbose
+2>/dev/null ${HOME} "$@" cd done "$1"
+	/usr/bin sed sed test cd cd then local then "$@"
+		then sed "$@" && readonly "$1" local local "$@" local cd
+		${HOME} -eu && $(pwd) awk ${HOME} local local cd sed -eu -eu
+	sed $(pwd) done /usr/bin local "$1" grep then ${HOME} then sed x=1 local sed x=1
+	readonly sed $(pwd) 'quoted text' local readonly local /usr/bin
+		sed cd -eu ${HOME} 'quoted text' 2>/dev/null && x=1 export && | local 'quoted text'
+	then ${HOME} "$1" x=1 local /usr/bin cd -eu /usr/bin 'quoted text' awk
+		readonly "$1" && x=1
+	| cd awk "$@" x=1 ${HOME} sed grep "$@"
+x=1 printf 'quoted text' sed readonly "$@" /usr/bin /usr/bin "$@" local
+		grep x=1 awk grep export then 2>/dev/null
+	done ${HOME} readonly | grep grep echo awk 2>/dev/null
+/usr/bin test readonly readonly --verbose
+		test readonly local $(pwd) echo
+		printf printf then "$@" 2>/dev/null /usr/bin 'quoted text' awk export awk
+'quoted text' "$1" /usr/bin -eu | local echo && local
+done readonly local 2>/dev/null grep $(pwd) 'quoted text'
+		'quoted text' sed readonly export cd sed ${HOME} echo /usr/bin local ${HOME}
+	2>/dev/null /usr/bin "$1" --verbose $(pwd) | echo printf "$1"
+		done local export "$1" then printf awk ${HOME} x=1 2>/dev/null "$1"
+x=1 sed $(pwd) sed then x=1
+readonly ${HOME} | done readonly "$@"
+grep printf 2>/dev/null x=1 "$@" x=1 "$1" && "$1" printf /usr/bin
+		'quoted text' --verbose | then -eu /usr/bin "$@" readonly
+		'quoted text' -eu printf readonly
+	local grep "$1" echo x=1 'quoted text'
+		-eu export done -eu grep -eu /usr/bin 2>/dev/null && done local export
+	local cd "$@" x=1 sed done | $(pwd) ${HOME} /usr/bin readonly cd "$1" "$1"
+test 2>/dev/null -eu echo echo grep ${HOME}
+	--verbose awk readonly --verbose | "$1" sed awk grep 'quoted text' test
+		-eu | done | local cd printf && --verbose printf sed printf sed
+${HOME} done echo && --verbose grep cd awk local 'quoted text'
+	x=1 x=1 then awk 'quoted text' 'quoted text'
+		"$@" -eu 2>/dev/null | grep --verbose "$1" /usr/bin
+		$(pwd) done --verbose awk --verbose && grep | && echo done
+local -eu then x=1 sed ${HOME} local && echo x=1 readonly "$@" local local
+	local test local grep --verbose && /usr/bin grep local
+-eu done "$@" x=1 x=1 "$1" readonly readonly export 2>/dev/null
+		$(pwd) $(pwd) | /usr/bin
+		cd "$1" then 'quoted text' |
+		'quoted text' $(pwd) test printf -eu sed "$1" -eu | grep "$@" export -eu
+		awk "$1" 2>/dev/null sed printf "$@" 'quoted text' 'quoted text'
+		"$1" /usr/bin 'quoted text' printf
+	x=1 x=1 --verbose readonly echo sed cd echo ${HOME} x=1
+		cd "$1" sed /usr/bin -eu then 2>/dev/null
+2>/dev/null cd sed local grep grep "$@" then awk then /usr/bin
+echo test -eu --verbose done grep ${HOME}
+		-eu -eu then --verbose --verbose
+done local -eu readonly grep 2>/dev/null sed
+"$@" -eu "$@" --verbose "$@" awk
+'quoted text' /usr/bin x=1
+	&& -eu "$@" awk awk "$1" awk then "$1" then && export && cd grep --verbose cd
+		x=1 $(pwd) awk sed /usr/bin x=1 then "$1" then x=1 -eu
+		x=1 local 'quoted text' local ${HOME} && $(pwd) ${HOME}
+then | 'quoted text' "$@" "$1" echo grep export /usr/bin readonly
+		$(pwd) /usr/bin printf awk then
+cd local x=1 /usr/bin ${HOME} grep | x=1 $(pwd) export --verbose $(pwd) $(pwd)
+	then $(pwd) | /usr/bin readonly 'quoted text'
+grep "$1" local then cd ${HOME}
+test /usr/bin 'quoted text' | export | -eu readonly local readonly grep
+&& printf -eu local sed 2>/dev/null then "$@"
+		&& "$1" && readonly && printf
+sed /usr/bin 2>/dev/null grep 2>/dev/null
+		printf echo -eu then echo sed $(pwd) grep sed -eu readonly export 'quoted text'
+	"$@" then 'quoted text' grep && printf grep local cd ${HOME}
+		${HOME} --verbose | $(pwd) echo && && x=1 --verbose sed export
+	"$@" sed echo ${HOME} 2>/dev/null $(pwd) test
+local sed echo -eu "$@" -eu sed x=1 echo | ${HOME} "$@" printf local
+printf x=1 'quoted text' -eu | /usr/bin test /usr/bin "$1"
+awk -eu x=1 /usr/bin test /usr/bin local "$1" test --verbose cd 'quoted text' x=1
+		awk "$@" -eu --verbose local
+	awk echo x=1 echo grep done
+		x=1 local export x=1 && then echo && ${HOME} 'quoted text' awk "$1" export
+'quoted text' grep && /usr/bin | grep done echo grep && test
+/usr/bin | echo sed /usr/bin then
+		2>/dev/null /usr/bin --verbose echo export x=1 echo sed export ${HOME} awk &&
+		awk x=1 'quoted text' /usr/bin x=1 && then grep /usr/bin
+		"$1" cd "$@" && export done test x=1 --verbose
+	'quoted text' echo | local -eu echo echo awk sed then -eu /usr/bin export
+	-eu test ${HOME} sed && "$1" done echo
+		| 2>/dev/null x=1 then 'quoted text' --verbose local 2>/dev/null 2>/dev/null
+	-eu grep --verbose 'quoted text' ${HOME} 2>/dev/null $(pwd) awk export $(pwd) export
+		2>/dev/null $(pwd) -eu test "$@" | awk cd awk /usr/bin | test printf export
+		awk local readonly x=1 sed done 2>/dev/null $(pwd) ${HOME} 2>/dev/null grep cd
+		$(pwd) echo sed grep printf $(pwd)
+	/usr/bin -eu "$1" 'quoted text'
+| ${HOME} then cd sed local -eu sed sed $(pwd) | readonly grep cd
+		--verbose 2>/dev/null export --verbose grep done readonly $(pwd) $(pwd) "$@"
+	--verbose 2>/dev/null sed then x=1 --verbose test $(pwd) readonly
+done ${HOME} $(pwd) -eu readonly x=1 2>/dev/null && -eu
+		| "$@" 'quoted text' --verbose local ${HOME} ${HOME} done 2>/dev/null then echo
+		&& awk cd grep 'quoted text' done
+		| "$@" awk export "$1" then && sed 2>/dev/null "$@" x=1 local
+		2>/dev/null ${HOME} -eu cd x=1 --verbose
+		-eu readonly readonly local /usr/bin then --verbose x=1 awk
+		test | ${HOME} done printf cd cd ${HOME} /usr/bin "$@" -eu sed done -eu
+		done export readonly "$1" printf -eu export 2>/dev/null "$@" local printf
+	$(pwd) local awk printf printf ${HOME} ${HOME} sed | x=1 test
+local printf ${HOME} ${HOME} test 'quoted text'
+2>/dev/null --verbose 'quoted text' && export test printf "$@" $(pwd) printf cd
+		| local printf 'quoted text' readonly -eu export then --verbose
+		cd cd /usr/bin ${HOME} local done echo echo $(pwd) awk
+		export test "$@" sed -eu grep --verbose
+	export done x=1 readonly sed "$@" | x=1 test then sed local readonly "$1" sed export
+2>/dev/null "$1" --verbose 'quoted text' 'quoted text' then done awk echo
+	"$1" --verbose 'quoted text' $(pwd) x=1 ${HOME}
+$(pwd) | "$1" "$@" grep "$@" then x=1 done /usr/bin "$1" export x=1
+	printf export && -eu echo local ${HOME} then awk && "$@" test export
+	then cd "$1" ${HOME} && 'quoted text' -eu /usr/bin $(pwd)
+		grep done grep cd echo --verbose printf 'quoted text'
+	local --verbose cd readonly ${HOME} $(pwd) "$1" local
+	2>/dev/null "$1" && "$1" local 2>/dev/null x=1 x=1 --verbose
+		/usr/bin -eu grep x=1 && "$@" -eu local --verbose
+	$(pwd) printf 'quoted text' sed test export | | cd
+		then 'quoted text' 2>/dev/null readonly
+local cd | printf $(pwd) test ${HOME} -eu ${HOME} --verbose "$1" | awk awk
+		-eu | sed then local cd "$1" "$@" done /usr/bin
+		done grep export printf "$@" $(pwd)
+		printf | test awk "$1" | cd $(pwd) ${HOME} && "$@" readonly 2>/dev/null 2>/dev/null
+	sed | "$1" "$@" then | local sed ${HOME}
+		readonly | awk $(pwd) grep then "$@" "$@" sed && local --verbose
+	&& done echo x=1 readonly test awk ${HOME} 'quoted text' x=1 $(pwd) export
+		done test done $(pwd) then echo -eu sed cd awk local "$@"
+	/usr/bin grep x=1 then
+	test done printf awk test 2>/dev/null && "$1" test ${HOME} /usr/bin
+	local -eu done awk printf test 2>/dev/null 2>/dev/null
+		x=1 echo /usr/bin | grep then awk --verbose | | && -eu awk "$1" sed
+		echo local $(pwd) test then test export export sed then readonly 2>/dev/null
+"$1" --verbose done 'quoted text'
+2>/dev/null awk export | printf done done awk $(pwd) 'quoted text'
+	local ${HOME} $(pwd) -eu local -eu "$1" --verbose export "$1" 2>/dev/null
+		local readonly "$1" -eu sed done cd | x=1 printf local done "$@" test printf printf
+	printf /usr/bin readonly cd local "$1" /usr/bin
+	printf awk 'quoted text' --verbose export -eu done "$@" readonly echo $(pwd)
+	/usr/bin done test | && cd printf $(pwd) /usr/bin then grep x=1 ${HOME}
+	2>/dev/null ${HOME} then done then then | export -eu --verbose printf $(pwd) test
+		export done "$1" x=1 | test awk
+x=1 && x=1 then 2>/dev/null local 2>/dev/null && printf grep local
+	echo 2>/dev/null awk && grep
+		sed 2>/dev/null /usr/bin ${HOME} then --verbose | 'quoted text' grep then
+		done ${HOME} done echo sed -eu export
+		printf then printf $(pwd) readonly test
+		then test | && test sed echo ${HOME} grep --verbose | done
+	grep x=1 done done local
+	awk printf "$1" awk cd && --verbose then x=1 sed echo readonly
+	echo then /usr/bin ${HOME} | awk "$1" grep ${HOME}
+awk --verbose 2>/dev/null printf $(pwd) ${HOME}
+2>/dev/null printf printf printf 'quoted text' /usr/bin && --verbose done
+export "$1" x=1 x=1 "$@" grep
+sed $(pwd) 'quoted text' $(pwd) $(pwd) $(pwd) echo /usr/bin
+		-eu /usr/bin -eu test --verbose "$@" --verbose 2>/dev/null
+	export | | 'quoted text' -eu then grep cd /usr/bin
+		/usr/bin printf "$1" && "$@" "$1" then --verbose $(pwd) echo readonly
+	test --verbose && sed done test 'quoted text'
+	local && $(pwd) then local awk ${HOME} grep -eu $(pwd) then | done
+		'quoted text' then 'quoted text' -eu awk echo
+printf $(pwd) printf ${HOME} -eu -eu done sed $(pwd)
+	readonly awk x=1 readonly | awk printf | 2>/dev/null
+local /usr/bin done ${HOME} test done local cd --verbose
+	echo && done --verbose printf grep && local 2>/dev/null printf 2>/dev/null
+		'quoted text' 'quoted text' $(pwd) ${HOME}
+	--verbose --verbose -eu -eu sed
+	'quoted text' done -eu "$1" then 2>/dev/null --verbose cd done ${HOME} 2>/dev/null
+export | -eu readonly export grep export | -eu
+local /usr/bin local echo && 2>/dev/null done test 2>/dev/null 'quoted text' then
+		&& --verbose grep -eu | sed awk done 'quoted text'
+cd local | readonly test "$1" readonly awk awk -eu -eu done done sed
+	cd sed awk readonly $(pwd) test 'quoted text'
+	readonly --verbose done ${HOME} -eu 'quoted text'
+	"$1" --verbose "$1" done sed export /usr/bin $(pwd) awk cd 2>/dev/null -eu
+awk 2>/dev/null --verbose export
+export export "$@" printf cd 'quoted text' export done sed ${HOME}
+		echo cd done "$@" --verbose | local local --verbose 2>/dev/null
+	&& | $(pwd) 'quoted text' --verbose 'quoted text'
+	"$1" readonly done ${HOME}
+done x=1 2>/dev/null printf echo | ${HOME} readonly 2>/dev/null
+	2>/dev/null cd grep ${HOME} -eu | "$@" 2>/dev/null /usr/bin echo done done awk local
+$(pwd) 'quoted text' sed "$@" grep local then then
+		"$1" test readonly export export "$@" x=1 then
+echo x=1 2>/dev/null "$1" && 2>/dev/null
+$(pwd) cd export "$@" -eu done "$@" cd "$1" echo /usr/bin | local echo awk
+printf local local readonly "$@" then && -eu "$@"
+		local "$@" -eu --verbose -eu printf awk ${HOME} then $(pwd) -eu local
+		readonly awk done "$1" readonly test "$@" cd /usr/bin export 'quoted text'
+then cd awk $(pwd) printf 2>/dev/null && "$1"
+	&& grep /usr/bin awk done local 'quoted text'
+	sed ${HOME} readonly 'quoted text' -eu /usr/bin awk x=1
+--verbose printf | && grep
+		/usr/bin -eu export x=1 cd local $(pwd) sed grep awk done
+$(pwd) "$@" | $(pwd) cd echo cd 2>/dev/null x=1 grep test &&
+	/usr/bin cd grep 'quoted text' cd -eu 2>/dev/null echo 2>/dev/null -eu
+		grep $(pwd) export cd sed ${HOME} grep x=1 readonly "$1" /usr/bin "$1"
+		${HOME} grep readonly --verbose readonly readonly 'quoted text'
+'quoted text' readonly $(pwd) | ${HOME} readonly 2>/dev/null local
+echo 'quoted text' grep printf ${HOME}
+	export export sed --verbose readonly
+		"$1" /usr/bin /usr/bin "$@" then done 2>/dev/null then sed echo test
+	"$1" "$1" cd sed printf grep && then x=1 cd --verbose local cd done
+	/usr/bin then "$1" x=1 $(pwd) grep && 'quoted text' -eu && awk local 'quoted text'
+local echo cd local cd && then | done "$1" printf done
+	x=1 -eu x=1 cd 'quoted text' --verbose 2>/dev/null printf 2>/dev/null 2>/dev/null
+		--verbose awk "$@" $(pwd) echo test grep $(pwd) 'quoted text' echo
+/usr/bin grep readonly grep printf |
+	2>/dev/null -eu then "$@" cd local test && 2>/dev/null 2>/dev/null local
+	readonly | "$@" done export "$1" && "$1" test -eu cd x=1 -eu /usr/bin done
+		cd "$@" x=1 --verbose x=1 $(pwd) && $(pwd)
+	printf echo --verbose local awk $(pwd) printf
+echo x=1 -eu | 'quoted text' echo readonly /usr/bin grep awk /usr/bin grep
+	--verbose /usr/bin test readonly awk readonly x=1 "$@" grep
+export x=1 awk cd printf 2>/dev/null
+		2>/dev/null then export 'quoted text' /usr/bin export readonly $(pwd) 'quoted text'
+		cd awk then x=1 done echo x=1 "$@" export then
+cd | x=1 printf awk printf done /usr/bin 2>/dev/null then /usr/bin
+	then "$@" /usr/bin -eu 'quoted text' --verbose
+		"$@" export -eu "$1" /usr/bin 'quoted text' $(pwd)
+	| readonly $(pwd) cd /usr/bin $(pwd) $(pwd) then -eu
+		then --verbose 'quoted text' local 'quoted text' then ${HOME} | x=1 readonly
+		echo x=1 "$1" -eu /usr/bin && 'quoted text' echo
+		--verbose cd awk done sed readonly x=1 ${HOME} awk "$@" done $(pwd)
+		x=1 | $(pwd) awk local grep ${HOME}
+sed awk done grep x=1 sed grep
+readonly printf then
+	${HOME} && local ${HOME} && local &&
+	then --verbose then done printf
+	then printf 'quoted text' test ${HOME} local cd
+	cd cd test echo local sed $(pwd) grep "$1" /usr/bin
+local "$1" && echo awk "$@" then cd x=1 awk ${HOME} echo export readonly
+		"$1" 'quoted text' local cd | 2>/dev/null grep cd
+	$(pwd) sed awk "$@" echo printf -eu ${HOME} echo then "$@" --verbose
+printf local grep printf cd local
+		'quoted text' $(pwd) --verbose -eu --verbose | 2>/dev/null "$1" | then /usr/bin
+	'quoted text' readonly && --verbose -eu 2>/dev/null | "$1" --verbose "$1"
+		sed done awk printf readonly x=1 sed x=1 awk "$1" && 'quoted text'
+readonly $(pwd) ${HOME} 2>/dev/null 2>/dev/null | done done echo printf then
+		grep cd cd printf echo printf awk --verbose
+grep $(pwd) /usr/bin printf ${HOME} x=1 grep export test
+x=1 "$@" export 'quoted text' && /usr/bin sed then
+	test 'quoted text' grep sed sed "$1" awk then grep
+	"$@" x=1 local printf x=1 local then printf test | "$1" cd
+	&& "$@" $(pwd) "$1" ${HOME} cd local printf printf
+${HOME} | -eu && local "$@" local "$1" && && && 2>/dev/null
+		export awk 2>/dev/null "$@" 2>/dev/null local
+		x=1 "$@" x=1 2>/dev/null $(pwd) -eu awk x=1 --verbose "$1" $(pwd) $(pwd) -eu awk
+		cd test x=1 && 2>/dev/null -eu "$1" 'quoted text' printf
+cd 2>/dev/null && done printf local -eu export | "$1"
+printf awk /usr/bin | --verbose ${HOME} echo printf readonly
+	'quoted text' printf $(pwd)
+	x=1 export done echo local printf readonly ${HOME} sed readonly
+	readonly local then local && export printf
+	$(pwd) export local readonly
+		then 2>/dev/null sed | then x=1 test printf x=1 x=1
+	$(pwd) && "$1" export --verbose sed printf $(pwd)
+		/usr/bin "$@" done -eu
+$(pwd) export awk | --verbose sed "$@" |
+		export cd readonly printf readonly readonly local -eu -eu printf readonly
+	readonly done done awk cd grep test "$@" 'quoted text' echo
+	${HOME} readonly $(pwd) done "$1" 2>/dev/null local grep echo
+	2>/dev/null && | && --verbose local ${HOME} then awk 'quoted text' test
+| local test 'quoted text' x=1 printf
+--verbose && local cd "$1" 2>/dev/null $(pwd) "$@" test /usr/bin x=1 'quoted text'
+	awk | ${HOME} test --verbose local 'quoted text' local
+	echo readonly | sed ${HOME} --verbose
+	&& x=1 printf readonly readonly grep 'quoted text' -eu then sed x=1 printf "$1"
+cd done local test 2>/dev/null cd 2>/dev/null printf /usr/bin printf
+		local local echo grep then grep -eu && "$1" grep export
+"$1" $(pwd) $(pwd) ${HOME}
+$(pwd) "$1" then printf then 2>/dev/null
+		local export sed cd grep cd x=1 sed $(pwd) | $(pwd) -eu ${HOME} local
+grep cd ${HOME} awk --verbose | done --verbose -eu sed && sed sed &&
+	printf "$1" 'quoted text' cd --verbose && then $(pwd) "$1" awk "$1"
+		echo /usr/bin 2>/dev/null done then export awk test cd | grep grep
+	echo grep /usr/bin readonly
+	sed | 'quoted text' 'quoted text'
+echo awk done grep --verbose -eu --verbose "$@" test readonly ${HOME} grep
+	grep local --verbose 'quoted text' "$@" awk done test
+		test readonly then sed printf --verbose && "$1" test sed $(pwd) 2>/dev/null | test
+		awk then done cd grep 'quoted text' awk readonly export |
+		$(pwd) $(pwd) | grep && "$@" 'quoted text' awk export --verbose export
+		export 2>/dev/null -eu cd cd ${HOME} local ${HOME} -eu && "$@" $(pwd) x=1 awk
+cd ${HOME} 2>/dev/null "$1" export 2>/dev/null "$1" -eu && readonly
+	sed && sed && awk "$1" "$@" cd sed local grep grep
+		x=1 readonly awk echo grep x=1 awk "$1" x=1
+	test -eu ${HOME} | sed -eu then | cd "$1" sed --verbose | local done | "$1"
+		test awk ${HOME} then done ${HOME} export && "$1" --verbose "$1"
+	printf && grep x=1 grep echo --verbose ${HOME} "$1" $(pwd) "$1" x=1
+	-eu sed ${HOME} sed done --verbose echo --verbose awk done ${HOME} ${HOME}
+		${HOME} export $(pwd) export -eu && test && sed 2>/dev/null
+	'quoted text' $(pwd) $(pwd) cd readonly printf sed echo
+		-eu 'quoted text' cd "$@" grep "$1" | 'quoted text'
+| "$1" -eu test done echo $(pwd)
+	2>/dev/null test export /usr/bin
+		awk 'quoted text' done sed cd export && 'quoted text' done readonly
+	done cd 'quoted text' x=1 cd export sed "$1"
+echo readonly then local && 'quoted text' && then
+	cd "$1" 'quoted text' export cd
+&& sed done | test | 'quoted text' done -eu | then --verbose
+	done "$1" $(pwd) --verbose ${HOME} sed "$1" printf 'quoted text' awk then
+then printf /usr/bin 'quoted text'
+	2>/dev/null | done done | 2>/dev/null
+	local grep | "$@" ${HOME} done
+		"$@" done "$@" | $(pwd) $(pwd) readonly local $(pwd) local x=1 "$1" --verbose
+	x=1 x=1 | readonly export local awk done --verbose
+$(pwd) "$1" export 'quoted text'
+export awk readonly 'quoted text' ${HOME} sed 2>/dev/null readonly
+echo sed export cd sed echo readonly awk 2>/dev/null $(pwd) readonly local
+		"$1" printf readonly 2>/dev/null x=1 $(pwd) readonly 2>/dev/null awk /usr/bin
+	readonly && --verbose sed 2>/dev/null | then ${HOME}
+	--verbose then then test --verbose local then awk
+/usr/bin /usr/bin $(pwd) && | 2>/dev/null 'quoted text'
+export /usr/bin && readonly test $(pwd)
+	$(pwd) "$@" x=1 $(pwd) echo
+		&& x=1 awk then cd &&
+		"$1" cd 2>/dev/null "$1" export
+	"$1" -eu echo $(pwd) printf /usr/bin
+	echo local then grep grep done awk 2>/dev/null sed 'quoted text' readonly
+	awk 'quoted text' export
+		"$@" readonly cd sed readonly /usr/bin local local $(pwd)
+2>/dev/null local 'quoted text' 'quoted text' /usr/bin
+	"$1" && echo grep echo test printf test $(pwd) then then readonly "$@"
+${HOME} awk --verbose x=1 "$@" cd awk --verbose
+"$@" ${HOME} && "$@" done | export -eu "$1" printf 2>/dev/null
+		echo x=1 awk done "$@" export 2>/dev/null sed echo done
+		| done 2>/dev/null $(pwd) readonly
+cd && x=1 --verbose done printf printf done && echo
+		test | test --verbose --verbose then sed --verbose "$1" then
+		readonly 'quoted text' ${HOME} $(pwd)
+awk "$1" test "$1" "$@" $(pwd) --verbose && /usr/bin readonly --verbose 2>/dev/null
+grep "$1" 'quoted text' "$@" /usr/bin
+		2>/dev/null awk --verbose
+${HOME} awk "$1" ${HOME}
+		export "$@" ${HOME} $(pwd) 2>/dev/null "$@" "$@"
+		test 'quoted text' sed export -eu "$@" grep /usr/bin ${HOME}
+	-eu ${HOME} "$@" test done done $(pwd) x=1 test then "$@" "$1" sed $(pwd)
+		'quoted text' then "$1" x=1
+		readonly awk 2>/dev/null done
+		then grep printf | echo /usr/bin ${HOME} | | done ${HOME}
+		'quoted text' --verbose cd 2>/dev/null "$@" done 'quoted text' then x=1
+	-eu readonly --verbose "$@" sed done 'quoted text' done "$@" test "$@" done cd
+&& awk 2>/dev/null ${HOME}
+	/usr/bin x=1 test /usr/bin /usr/bin then "$@" sed
+	2>/dev/null cd 'quoted text' x=1 readonly ${HOME} 'quoted text'
+	x=1 readonly test export && sed readonly cd sed grep --verbose
+		test awk | && 2>/dev/null export ${HOME} "$1" grep test "$1" /usr/bin "$@"
+	-eu --verbose then then printf echo && export $(pwd) test cd
+		readonly $(pwd) $(pwd) done "$1" awk 'quoted text'
+	-eu "$@" cd printf $(pwd) $(pwd) x=1 2>/dev/null
+		2>/dev/null local --verbose then 2>/dev/null printf local
+	--verbose export echo "$@" 'quoted text' 'quoted text' done ${HOME} /usr/bin
+		| export export sed printf awk | printf then then ${HOME} local
+echo awk readonly awk printf
+	then local | echo /usr/bin awk then export
+awk $(pwd) -eu cd /usr/bin then ${HOME} cd 2>/dev/null
+readonly --verbose export
+	local /usr/bin 2>/dev/null done local
+		| | ${HOME} ${HOME} && && echo then 2>/dev/null
+	/usr/bin && cd echo readonly $(pwd) sed readonly readonly awk 2>/dev/null x=1 x=1
+x=1 /usr/bin "$1" export | "$@"
+/usr/bin /usr/bin 2>/dev/null readonly
+		&& 2>/dev/null ${HOME} 2>/dev/null
+	grep export ${HOME} | then echo test printf -eu /usr/bin |
+readonly readonly awk sed 'quoted text' grep printf
+	done printf readonly echo grep echo
+	${HOME} -eu export printf
+	2>/dev/null 'quoted text' then "$1" -eu grep "$1" "$1" && "$@" done "$1"
+	grep done local readonly cd local $(pwd) then test /usr/bin cd then export 'quoted text'
+		then grep "$1" 2>/dev/null 2>/dev/null readonly | "$1" echo sed then done echo
+	echo && test 2>/dev/null && $(pwd) && done $(pwd) /usr/bin export x=1 'quoted text'
+'quoted text' "$1" 'quoted text' | export $(pwd) done grep 'quoted text'
+printf | 'quoted text' printf then 2>/dev/null export grep 2>/dev/null
+		"$@" then && --verbose local -eu 2>/dev/null done grep cd && test
+readonly | 'quoted text' test
+	echo /usr/bin done awk 2>/dev/null sed sed
+		"$@" && test /usr/bin then 2>/dev/null cd grep x=1 local
+		cd && /usr/bin echo x=1 --verbose
+	2>/dev/null ${HOME} cd readonly --verbose then --verbose /usr/bin echo echo
+readonly --verbose /usr/bin awk grep echo ${HOME}
+		local "$@" "$@" 2>/dev/null
+	x=1 awk 'quoted text' readonly cd $(pwd) sed cd echo sed
+"$@" ${HOME} sed echo then test ${HOME} 2>/dev/null printf ${HOME} "$@"
+	| test && grep readonly test -eu $(pwd) grep 'quoted text' -eu "$@" | 'quoted text'
+		export $(pwd) "$1" then
+	sed ${HOME} local x=1 printf
+	export "$1" local done 2>/dev/null
+		&& $(pwd) x=1 x=1 cd | sed cd awk readonly
+	local -eu x=1 sed "$@" cd awk export
+		| export ${HOME} cd && export -eu export 'quoted text' "$1" /usr/bin | export
+		x=1 x=1 2>/dev/null &&
+| "$@" --verbose sed $(pwd) --verbose local export && echo
+		&& then "$@" -eu printf
+	cd 'quoted text' $(pwd) x=1 local x=1 $(pwd) printf
+	$(pwd) && cd readonly cd done echo printf cd --verbose awk "$1"
+local "$1" | sed grep /usr/bin cd grep done $(pwd) $(pwd) printf printf
+readonly awk done sed readonly grep ${HOME} &&
+		"$1" x=1 then cd awk sed cd x=1 /usr/bin printf readonly 'quoted text'
+	x=1 grep awk ${HOME} awk echo sed
+		awk "$1" 'quoted text' echo test x=1 printf readonly && 'quoted text'
+then /usr/bin sed --verbose export done sed local readonly -eu 'quoted text'
+	export x=1 awk sed --verbose | "$@" then $(pwd) awk ${HOME} echo x=1 test
+done 'quoted text' export | awk --verbose --verbose
+	local cd local printf x=1 grep local sed local local
+		/usr/bin test x=1 /usr/bin printf awk done local 'quoted text' export --verbose
+	| && x=1 export cd done sed local cd echo grep grep $(pwd) &&
+'quoted text' then then --verbose done test ${HOME} export ${HOME} | awk x=1
+	--verbose then "$1" x=1 -eu ${HOME} --verbose done done then | readonly
+&& sed x=1 && $(pwd) "$@" 2>/dev/null done ${HOME} "$1" then awk test
+		awk done readonly printf cd done awk
+		$(pwd) "$1" | | local | grep 2>/dev/null cd printf then
+${HOME} local grep $(pwd) --verbose readonly echo /usr/bin
+	printf then 'quoted text' sed | local printf local "$@" sed printf grep
+		x=1 x=1 export x=1 2>/dev/null x=1 /usr/bin /usr/bin | sed
+"$1" --verbose then /usr/bin "$@" then sed $(pwd)
+export /usr/bin awk test --verbose /usr/bin "$@" export done x=1 awk then readonly
+		"$1" readonly readonly readonly cd x=1 "$1"
+	cd 'quoted text' x=1 /usr/bin | $(pwd) export export
+		echo --verbose local then $(pwd) export 2>/dev/null
+		-eu $(pwd) "$@" sed x=1 cd readonly cd local printf printf $(pwd)
+		'quoted text' 'quoted text' grep 'quoted text' $(pwd) awk grep awk export done
+	"$@" printf --verbose $(pwd)
+cd then | test cd readonly
+	$(pwd) done export echo -eu "$1" test readonly printf 2>/dev/null
+		/usr/bin ${HOME} x=1 2>/dev/null 2>/dev/null
+	$(pwd) printf "$1" -eu printf /usr/bin 2>/dev/null
+		echo 2>/dev/null "$1" x=1 $(pwd) awk /usr/bin
+		grep export sed readonly readonly readonly --verbose awk x=1 readonly x=1 2>/dev/null
+printf export ${HOME} export -eu test test sed then local 'quoted text'
+	-eu "$1" awk echo test "$1" grep test x=1 | cd grep 2>/dev/null "$@" | readonly
+		local test then cd "$1" "$@" -eu echo 2>/dev/null printf awk | sed sed readonly
+x=1 then --verbose $(pwd) cd -eu 'quoted text' "$1" sed echo test
+"$@" test "$@" "$@" test $(pwd) "$1" export test then echo export
+done export cd awk /usr/bin 2>/dev/null cd
+x=1 2>/dev/null /usr/bin test /usr/bin done | "$1" then grep then
+	"$1" x=1 -eu readonly "$1" && | then --verbose local ${HOME} 2>/dev/null awk test
+		${HOME} export done "$1" done "$1" "$@" awk "$1" local
+	cd /usr/bin /usr/bin local echo cd awk sed
+'quoted text' --verbose "$@" done export && 'quoted text'
+	cd export sed 2>/dev/null local /usr/bin grep awk
+		'quoted text' local printf awk awk 2>/dev/null
+		test export then cd 'quoted text'
+		$(pwd) "$1" "$@" /usr/bin
+sed done && x=1 export echo ${HOME} printf readonly
+$(pwd) export 2>/dev/null grep 2>/dev/null x=1 then $(pwd) test
+	${HOME} x=1 $(pwd) printf then then -eu local /usr/bin 'quoted text'
+grep echo grep | 'quoted text' /usr/bin | test -eu && sed /usr/bin awk
+local 2>/dev/null done export x=1 export cd then 2>/dev/null
+		done cd echo /usr/bin /usr/bin ${HOME} && export test test ${HOME} --verbose
+done $(pwd) --verbose $(pwd) printf then
+export then && 'quoted text' 2>/dev/null -eu "$@" printf
+then /usr/bin --verbose local "$@" x=1 "$@" 'quoted text'
+	"$1" readonly cd readonly printf test -eu 2>/dev/null cd echo local "$@" "$@"
+	export echo $(pwd) | -eu 'quoted text'
+	| sed /usr/bin -eu -eu test echo ${HOME} x=1 cd "$@"
+grep grep x=1 sed x=1 -eu then export done -eu export awk
+	&& grep readonly grep done "$1" 2>/dev/null sed -eu readonly | $(pwd)
+		readonly grep cd test awk local sed -eu awk ${HOME} awk awk echo /usr/bin
+		&& export echo "$1" | cd ${HOME} -eu 2>/dev/null then ${HOME} x=1 awk /usr/bin
+	-eu test done test grep readonly ${HOME} $(pwd) -eu
+x=1 export 2>/dev/null then echo grep awk ${HOME} --verbose
+done | 'quoted text' printf printf --verbose ${HOME} test sed ${HOME}
+printf printf -eu "$@"
+		-eu "$@" x=1 x=1 -eu awk | "$@"
+cd awk $(pwd) awk -eu readonly && sed grep "$1" && readonly x=1 local
+	-eu printf printf "$1" echo && local
+	then --verbose sed readonly awk "$1" -eu
+		test 2>/dev/null grep awk local
+grep export "$@" done export "$1"
+		sed readonly done awk echo echo local export $(pwd) "$@"
+		grep "$@" echo $(pwd) 'quoted text' --verbose
+		"$@" printf 2>/dev/null x=1 /usr/bin local
+sed | test echo --verbose x=1 --verbose --verbose "$@" grep done --verbose
+"$1" then then -eu done then "$1"
+export cd x=1 'quoted text' printf "$1" -eu
+	local $(pwd) "$@" ${HOME} test x=1 grep -eu readonly
+	"$@" done awk && --verbose ${HOME} readonly
+		$(pwd) "$@" sed sed 2>/dev/null printf 2>/dev/null
+	cd test 2>/dev/null local "$1" ${HOME} awk export 2>/dev/null && 'quoted text'
+/usr/bin readonly "$@" --verbose cd x=1 -eu
+	done cd local ${HOME} local "$1" | awk echo 'quoted text' cd --verbose
+	${HOME} local -eu && done echo /usr/bin echo && 'quoted text' 'quoted text'
+		awk awk local --verbose 'quoted text' --verbose
+"$1" printf echo then test "$1" 2>/dev/null local
+	"$1" $(pwd) 'quoted text' 'quoted text' | readonly 'quoted text' then
+sed grep test && && "$1" test
+		-eu x=1 && then done done x=1 /usr/bin then done
+	/usr/bin export x=1 | x=1 $(pwd) sed /usr/bin readonly
+	"$@" "$1" readonly readonly x=1 && ${HOME} ${HOME}
+export 'quoted text' "$1" && "$@" /usr/bin
+| "$@" x=1 export cd local awk ${HOME} "$@"
+		'quoted text' printf 2>/dev/null && "$@" ${HOME} test x=1 --verbose && readonly
+		cd && export sed grep /usr/bin /usr/bin -eu awk "$@"
+export echo $(pwd) /usr/bin local
+-eu 'quoted text' -eu "$@" x=1 x=1 $(pwd)
+		grep test ${HOME} printf "$1" test 2>/dev/null export "$1" | 2>/dev/null
+		cd x=1 echo $(pwd) then "$1"
+		/usr/bin then -eu export readonly --verbose
+		cd echo "$@" echo test $(pwd) | local /usr/bin local x=1 echo cd then ${HOME}
+	test $(pwd) 2>/dev/null "$@" --verbose | | test x=1 readonly sed test grep
+	-eu -eu $(pwd) /usr/bin x=1 awk test
+		then printf then $(pwd) "$1" local 2>/dev/null 2>/dev/null readonly -eu
+	readonly echo grep x=1 $(pwd) echo done readonly x=1 $(pwd) then $(pwd) 'quoted text'
+		sed local echo awk done 'quoted text'
+	sed | echo $(pwd) x=1 "$1"
+	done /usr/bin | test 2>/dev/null
+	done printf sed done --verbose "$@"
+cd export 'quoted text' local
+"$1" "$@" awk $(pwd) ${HOME} grep && grep
+"$@" echo grep x=1 ${HOME} $(pwd) 'quoted text' "$@" "$1" $(pwd) done -eu x=1
+	2>/dev/null grep test export
+| ${HOME} ${HOME} printf sed
+-eu echo --verbose printf echo
+		${HOME} export 2>/dev/null /usr/bin 2>/dev/null
+	/usr/bin "$@" "$@" local x=1 grep grep | "$1" && grep grep "$@" printf
+sed then echo | test /usr/bin x=1
+		&& "$1" --verbose local 'quoted text'
+	| export awk ${HOME} test x=1 local export "$1" local
+	"$@" --verbose test sed x=1 done cd done
+	echo x=1 done | ${HOME} | --verbose
+		awk -eu -eu cd 2>/dev/null --verbose ${HOME} 2>/dev/null "$@" && printf
+	grep ${HOME} test ${HOME}
+awk test grep sed then 'quoted text'
+	cd /usr/bin 'quoted text' 2>/dev/null grep --verbose 2>/dev/null x=1
+-eu /usr/bin echo x=1 awk test "$@" --verbose -eu -eu "$@"
+sed readonly | local --verbose awk printf --verbose export test --verbose 'quoted text'
+		awk 2>/dev/null && $(pwd)
+x=1 grep -eu printf $(pwd)
+		printf echo grep echo done done local sed grep cd then
+	cd /usr/bin echo --verbose | -eu 2>/dev/null "$@" 2>/dev/null echo
+		/usr/bin ${HOME} "$@" sed -eu then grep cd sed printf
+| sed export grep -eu x=1 test -eu 2>/dev/null sed | done echo | 'quoted text'
+		printf | /usr/bin ${HOME} echo sed sed --verbose 'quoted text' test
+"$1" grep echo grep && echo awk awk local ${HOME}
+		readonly sed grep 'quoted text' "$@" cd awk ${HOME}
+	'quoted text' done readonly readonly printf && test 'quoted text'
+	-eu export test echo $(pwd) ${HOME} test 'quoted text' echo /usr/bin
+&& local --verbose 2>/dev/null 2>/dev/null then local export "$@" -eu
+	--verbose readonly test export awk && | ${HOME} grep $(pwd) grep sed
+--verbose | ${HOME} -eu
+		then done done /usr/bin
+grep 2>/dev/null readonly $(pwd) grep sed
+	'quoted text' readonly done -eu echo -eu
+	local -eu readonly readonly --verbose | printf -eu sed /usr/bin
+	awk grep 'quoted text' /usr/bin cd then /usr/bin
+	test ${HOME} test sed printf cd printf echo "$@" 'quoted text'
+x=1 'quoted text' cd printf && printf echo local x=1 /usr/bin readonly
+	-eu ${HOME} awk $(pwd) readonly sed --verbose 2>/dev/null /usr/bin | local cd
+	awk done --verbose | /usr/bin awk then x=1 echo cd export
+'quoted text' done sed awk $(pwd) $(pwd) -eu done "$1" 2>/dev/null awk
+		awk then | then export awk then ${HOME} test done /usr/bin test grep x=1 ${HOME}
+	cd && | ${HOME} local x=1 sed printf
+		done "$@" && echo grep test "$1" then --verbose 'quoted text'
+export $(pwd) 2>/dev/null done grep 'quoted text'
+		readonly $(pwd) cd -eu test x=1 2>/dev/null sed 'quoted text' | readonly readonly
+"$1" -eu done printf
+		x=1 local awk -eu | -eu "$1" then done "$@" readonly test local
+local echo printf readonly /usr/bin
+		'quoted text' grep readonly ${HOME} 'quoted text' -eu cd local grep cd
+		&& grep awk ${HOME} printf "$@"
+	/usr/bin done then x=1 readonly local awk | ${HOME} cd
+	printf /usr/bin ${HOME} ${HOME} && sed "$@" local | awk --verbose $(pwd)
+		$(pwd) /usr/bin done local 'quoted text' 2>/dev/null echo "$@" "$1"
+		echo printf "$@" x=1 test echo awk readonly readonly -eu --verbose
+/usr/bin /usr/bin "$1" echo "$1" "$@" done 'quoted text'
+grep sed "$1" test export cd sed done
+		"$@" "$@" local -eu echo /usr/bin export cd local --verbose && 'quoted text'
+		x=1 grep readonly -eu --verbose
+$(pwd) cd $(pwd) x=1 done 'quoted text' readonly grep done printf
+awk sed done cd then $(pwd) "$1" echo local
+	-eu echo echo $(pwd)
+		'quoted text' ${HOME} then awk awk grep done cd test awk
+		export $(pwd) "$1" 2>/dev/null done done -eu awk "$1"
+	--verbose -eu 2>/dev/null awk sed export readonly
+		test -eu awk then 2>/dev/null test export
+	&& && 'quoted text' $(pwd) && done readonly "$@" "$@" "$1" printf "$@" test "$@"
+		local readonly echo /usr/bin local --verbose grep "$@" awk echo ${HOME}
+		awk readonly x=1 export local sed local readonly local then 'quoted text' 2>/dev/null
+export /usr/bin --verbose then export cd 'quoted text' test
+		echo grep cd x=1 --verbose && readonly
+	x=1 'quoted text' then /usr/bin -eu grep /usr/bin ${HOME}
+x=1 readonly $(pwd) x=1 sed "$@" printf
+		awk then echo 'quoted text' export test echo ${HOME}
+		echo | export test test && | x=1 test readonly local $(pwd) sed "$1"
+		"$1" -eu -eu --verbose ${HOME} -eu awk ${HOME} readonly grep "$@" export sed
+		done --verbose cd local done export x=1 ${HOME} | export
+	printf printf | printf echo && then
+		/usr/bin export readonly
+2>/dev/null printf test export
+| sed 2>/dev/null | x=1 local
+	readonly x=1 ${HOME} done $(pwd)
+		echo $(pwd) ${HOME} /usr/bin | readonly test sed cd readonly
+	$(pwd) -eu printf | local echo grep -eu 'quoted text' awk grep x=1 echo grep
+	awk "$1" local | sed grep then export echo
+	cd 2>/dev/null done readonly done awk sed && | grep test x=1 then 'quoted text'
+'quoted text' /usr/bin "$@"
+		&& awk cd ${HOME} | ${HOME} /usr/bin
+/usr/bin && "$@" then grep
+		--verbose awk -eu echo test ${HOME} awk done $(pwd) ${HOME}
+then x=1 then awk echo cd sed | ${HOME} readonly /usr/bin
+		awk echo readonly && "$@" | | "$@" $(pwd) && $(pwd) readonly awk x=1 "$1" awk
+sed local done done readonly && ${HOME} x=1
+		done | ${HOME} done readonly $(pwd) 'quoted text'
+test then awk cd | $(pwd) ${HOME} ${HOME} 'quoted text'
+		printf 'quoted text' local | then x=1 echo
+		echo test then then "$@" --verbose ${HOME} readonly
+x=1 && $(pwd) awk --verbose --verbose printf ${HOME} printf echo && local local
+		${HOME} /usr/bin $(pwd) x=1 sed
+	"$1" printf awk echo | done readonly
+	then local cd printf && "$1" && done && ${HOME} grep grep --verbose
+printf cd -eu grep then then cd "$1"
+		2>/dev/null ${HOME} "$@" printf sed
+readonly grep test 'quoted text' -eu $(pwd) printf done echo readonly "$@" &&
+2>/dev/null cd done echo sed grep --verbose -eu printf awk cd sed /usr/bin
+		cd --verbose local -eu grep 2>/dev/null
+	export -eu "$1" printf done ${HOME} "$@" "$@" printf done
+		$(pwd) -eu readonly 2>/dev/null "$@" --verbose --verbose
+		grep --verbose readonly printf awk $(pwd) printf $(pwd) test |
+test "$1" test test echo --verbose
+2>/dev/null && done then "$1" /usr/bin echo readonly done /usr/bin
+&& local /usr/bin 2>/dev/null --verbose | printf -eu export
+		echo printf --verbose awk && export x=1 'quoted text'
+		$(pwd) "$1" awk -eu awk
+		"$@" export "$@" /usr/bin
+$(pwd) "$@" 2>/dev/null --verbose done "$@" -eu export -eu cd /usr/bin --verbose
+		readonly cd echo awk | x=1 'quoted text' sed printf 'quoted text' --verbose
+echo then awk --verbose "$1" echo printf
+	then --verbose test local echo | ${HOME} /usr/bin
+		${HOME} ${HOME} ${HOME}
+then ${HOME} "$@" then printf readonly 2>/dev/null grep
+printf printf -eu /usr/bin 'quoted text'
+	${HOME} -eu readonly 2>/dev/null
+		-eu test echo "$1" && | x=1 test then -eu cd awk awk "$1" awk grep "$1" grep
+export "$1" $(pwd) && printf then $(pwd)
+sed done ${HOME} $(pwd) 2>/dev/null printf -eu sed done
+-eu ${HOME} test done 'quoted text'
+cd local $(pwd) test
+	--verbose then 2>/dev/null 'quoted text' awk cd export local && ${HOME} done
+	then /usr/bin x=1 "$1" -eu local "$1"
+awk echo ${HOME} | /usr/bin cd $(pwd) | 'quoted text'
+readonly 2>/dev/null awk local "$@" printf awk "$1"
+		-eu grep awk x=1 /usr/bin awk sed grep readonly
+		--verbose && /usr/bin "$@" /usr/bin 'quoted text' awk x=1 x=1 test printf "$@"
+sed --verbose awk x=1 test $(pwd)
+		export -eu awk echo echo 'quoted text'
+		$(pwd) test --verbose test readonly "$1" awk echo "$@" readonly /usr/bin
+/usr/bin /usr/bin --verbose sed /usr/bin cd printf
+x=1 | 'quoted text' echo local 'quoted text' $(pwd) | $(pwd)
+printf export x=1 echo then /usr/bin
+	cd -eu "$1" -eu grep "$@" printf
+	/usr/bin | then x=1 awk -eu sed /usr/bin echo 'quoted text' 2>/dev/null
+2>/dev/null ${HOME} 'quoted text'
+	&& -eu "$1" readonly done awk
+grep grep -eu printf -eu printf printf echo
+	"$@" -eu | $(pwd) /usr/bin /usr/bin --verbose cd "$@"
+	'quoted text' awk printf -eu
+		| -eu 'quoted text' export 2>/dev/null done awk done echo sed "$@"
+| x=1 ${HOME} test echo $(pwd) ${HOME} done "$1"
+	x=1 -eu /usr/bin done "$1" 'quoted text' test echo readonly
+	test done "$1" $(pwd) | 2>/dev/null -eu --verbose 2>/dev/null ${HOME} ${HOME} x=1
+		$(pwd) export -eu 2>/dev/null 2>/dev/null export cd
+		then test x=1 awk "$1" readonly sed && "$@" export
+		"$1" then echo && 'quoted text' /usr/bin "$@" 2>/dev/null awk done "$@"
+	"$@" && "$@" printf awk $(pwd) then sed done 'quoted text' then then && echo
+then 2>/dev/null awk sed cd cd done cd 'quoted text' "$@" x=1 done
+	"$@" --verbose test done && local 'quoted text' ${HOME} x=1 local
+		${HOME} $(pwd) readonly readonly echo grep then -eu echo then 2>/dev/null /usr/bin
+		cd awk done -eu -eu 2>/dev/null
+x=1 export x=1 -eu | echo
+sed export echo 'quoted text' cd -eu --verbose | printf ${HOME}
+&& ${HOME} | -eu | | awk local cd sed done 2>/dev/null
+		readonly then "$@" awk ${HOME} | --verbose --verbose x=1 export /usr/bin
+		then /usr/bin printf export test /usr/bin --verbose
+	$(pwd) $(pwd) sed export /usr/bin export -eu x=1 printf local cd ${HOME} done
+	"$1" awk --verbose done ${HOME} x=1 x=1 -eu sed then && 2>/dev/null export
+local x=1 cd "$@" $(pwd) printf
+	&& /usr/bin cd "$@" readonly local && && 2>/dev/null "$@" test test
+x=1 -eu printf 'quoted text'
+"$@" "$@" readonly | --verbose echo -eu printf export
+cd then printf printf 2>/dev/null
+		&& "$@" cd /usr/bin 2>/dev/null grep "$1" cd -eu x=1 readonly | export
+		&& test 2>/dev/null 2>/dev/null 2>/dev/null 2>/dev/null
+	sed grep then echo 2>/dev/null --verbose && 'quoted text' "$@"
+		echo sed export grep ${HOME} export | --verbose done $(pwd)
+"$1" grep "$@" -eu ${HOME} printf echo printf cd ${HOME} done echo
+	done test --verbose printf test awk ${HOME} | awk awk
+local "$1" | local done
+	cd done | x=1 "$1" local
+	$(pwd) | $(pwd) -eu test 2>/dev/null
+		/usr/bin readonly /usr/bin readonly x=1 2>/dev/null
+		-eu grep local export
+	echo test "$@" done x=1 /usr/bin echo 'quoted text' test
+		$(pwd) $(pwd) -eu 2>/dev/null && -eu sed test
+		${HOME} then x=1 "$@" export printf test sed grep test sed grep 'quoted text'
+		--verbose test cd | then && --verbose then sed local export 2>/dev/null
+$(pwd) echo echo cd printf
+		cd "$@" printf 2>/dev/null readonly $(pwd) cd 'quoted text' done
+		grep then then printf
+	test ${HOME} 'quoted text' "$@" printf ${HOME} /usr/bin "$@"
+	readonly done | awk 2>/dev/null 2>/dev/null
+"$1" echo ${HOME} cd 'quoted text'
+	echo echo /usr/bin sed "$1" "$@" -eu "$1" x=1 grep sed 2>/dev/null
+		$(pwd) --verbose then "$@" done printf printf test echo -eu | printf 2>/dev/null
+		cd sed readonly sed ${HOME} done export echo
+		--verbose 2>/dev/null then /usr/bin
+echo 2>/dev/null grep "$1" "$1" test export 'quoted text' $(pwd) printf
+		printf x=1 2>/dev/null awk readonly export $(pwd)
+	local /usr/bin ${HOME} ${HOME} 'quoted text' grep ${HOME} $(pwd)
+	$(pwd) awk awk printf awk
+x=1 printf ${HOME} ${HOME} 'quoted text' /usr/bin
+	printf $(pwd) 'quoted text' /usr/bin readonly
+		then awk "$1" local --verbose
+	grep /usr/bin grep x=1 /usr/bin $(pwd) readonly echo grep then |
+		cd $(pwd) x=1 awk export --verbose x=1 cd export "$1" sed printf ${HOME}
+		readonly ${HOME} -eu 'quoted text' readonly export echo printf grep awk done /usr/bin
+	${HOME} grep readonly 2>/dev/null awk "$@" then --verbose sed | then
+	"$1" "$1" printf "$@" done cd local then && printf x=1 test then $(pwd)
+		readonly local x=1 export -eu printf readonly sed && export && "$@" grep then
+| echo export $(pwd)
+	readonly 2>/dev/null 2>/dev/null sed
+		printf "$1" cd local awk -eu sed grep cd sed ${HOME} -eu then |
+	'quoted text' 'quoted text'
+/usr/bin ${HOME} test && 2>/dev/null $(pwd) then $(pwd) $(pwd) 'quoted text'
+then -eu 'quoted text'
+sed && then export then /usr/bin sed local
+'quoted text' awk "$1" x=1 cd 2>/dev/null test --verbose
+	/usr/bin x=1 x=1 && "$1" echo "$@" /usr/bin | "$@" then sed /usr/bin awk grep
+		--verbose export done grep grep 'quoted text'
+/usr/bin export then | local "$1"
+then local -eu awk local printf awk "$@" "$@" "$1" export /usr/bin echo sed sed
+	&& 'quoted text' "$1" printf echo export
+then readonly -eu sed test $(pwd) echo | done grep done echo test
+	then 2>/dev/null printf done local printf printf
+		&& sed "$1" then sed 2>/dev/null test echo
+| ${HOME} | -eu local "$1" done test
+$(pwd) echo /usr/bin | grep ${HOME}
+	test export --verbose x=1 "$@" "$1" && --verbose "$1" 2>/dev/null
+	$(pwd) -eu awk | export ${HOME} local printf x=1 "$1" /usr/bin readonly then $(pwd)
+2>/dev/null $(pwd) $(pwd) 2>/dev/null ${HOME} sed 2>/dev/null
+--verbose "$1" ${HOME} 2>/dev/null awk
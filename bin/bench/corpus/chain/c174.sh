@@ -0,0 +1,2001 @@
+		awk then $(pwd) && cd readonly --verbose awk --verbose grep /usr/bin
+		test printf export printf --verbose test grep $(pwd) test 2>/dev/null 2>/dev/null
+echo ${HOME} --verbose
+		-eu export "$@" test awk local /usr/bin done
+		2>/dev/null -eu $(pwd) 2>/dev/null
+		done 2>/dev/null local grep 'quoted text' done grep
+		test | done awk 2>/dev/null awk test
+printf "$@" | test -eu readonly /usr/bin
+	"$1" /usr/bin 2>/dev/null local "$@" --verbose sed local printf printf awk
+	/usr/bin then sed done -eu
+echo x=1 cd export grep done ${HOME} awk --verbose cd && x=1 printf
+grep && local local printf x=1 $(pwd)
+done grep --verbose $(pwd) cd awk "$@" grep "$@" awk grep cd -eu test
+	2>/dev/null grep local && printf then ${HOME}
+		then grep cd local echo readonly 'quoted text'
+"$1" echo 2>/dev/null printf
+	x=1 2>/dev/null awk 'quoted text' then --verbose then 2>/dev/null export printf
+	$(pwd) 2>/dev/null done -eu x=1 sed export -eu "$@" x=1 2>/dev/null 2>/dev/null
+	readonly cd 'quoted text' $(pwd) | echo x=1
+		--verbose -eu grep --verbose --verbose
+	cd then ${HOME} /usr/bin
+		local printf printf sed printf sed then done 2>/dev/null $(pwd) grep readonly cd
+export && echo | sed readonly "$1" export done echo
+		| | /usr/bin 2>/dev/null "$@" $(pwd) --verbose awk test test | local
+sed cd local | && then grep
+		done | test test cd cd printf local
+'quoted text' printf local
+awk && printf cd && $(pwd) --verbose test
+	cd then x=1 local grep "$@" "$1" 2>/dev/null
+		sed printf -eu then readonly $(pwd) awk grep sed && x=1 readonly local awk
+"$1" sed done 2>/dev/null --verbose 'quoted text' grep
+		x=1 sed x=1 --verbose cd -eu ${HOME} printf local printf x=1 printf
+echo /usr/bin local "$@" local /usr/bin
+		sed then export && grep -eu --verbose
+		printf 'quoted text' export 2>/dev/null grep printf "$1" local cd -eu
+&& sed $(pwd) | x=1 local /usr/bin grep local echo $(pwd) awk sed printf
+		awk sed | x=1 2>/dev/null $(pwd) ${HOME} done "$1" && && echo cd readonly
+awk cd awk readonly export export
+cd "$1" && ${HOME} test readonly
+		${HOME} | sed --verbose $(pwd) then grep awk
+	x=1 "$1" printf then $(pwd) echo printf awk ${HOME}
+	sed readonly "$1" awk $(pwd) cd
+		readonly export /usr/bin cd echo awk --verbose export then --verbose local
+awk | grep export test --verbose echo "$1" -eu $(pwd)
+| ${HOME} $(pwd) done --verbose ${HOME} echo "$1" "$1"
+	-eu printf --verbose awk done export printf
+	cd done | awk && && 2>/dev/null
+sed 'quoted text' cd -eu ${HOME} "$@" grep grep | && -eu 'quoted text'
+	grep then --verbose sed ${HOME} local grep printf printf 'quoted text' | echo test
+		done then $(pwd) 'quoted text' $(pwd) x=1 &&
+then /usr/bin --verbose readonly
+		${HOME} printf ${HOME} --verbose x=1
+		"$1" export readonly -eu /usr/bin x=1
+grep /usr/bin $(pwd) "$@" --verbose ${HOME} | then 'quoted text'
+	readonly local sed cd "$@" test 'quoted text'
+	grep done export ${HOME} "$1" "$@" local printf sed
+		'quoted text' $(pwd) done local 2>/dev/null done --verbose
+	-eu -eu test --verbose echo grep awk | -eu
+	test done awk "$1" | 2>/dev/null 'quoted text' done ${HOME} --verbose | then --verbose
+2>/dev/null -eu local -eu readonly then $(pwd) echo echo $(pwd)
+done | -eu cd ${HOME} /usr/bin export "$1" --verbose ${HOME}
+		local printf "$@" local then done done "$1" cd then
+	&& --verbose sed export 'quoted text' done
+printf readonly done echo cd export printf ${HOME}
+	grep readonly cd 'quoted text' "$1" --verbose 2>/dev/null
+	| local local local x=1 "$@"
+	cd printf awk awk done then readonly ${HOME} -eu awk 'quoted text'
+	2>/dev/null $(pwd) done && awk then | 2>/dev/null
+-eu ${HOME} grep "$@" then local
+		cd 'quoted text' readonly ${HOME} $(pwd) sed done
+	-eu awk printf ${HOME} readonly grep sed awk cd
+	"$1" 2>/dev/null printf echo --verbose x=1
+-eu cd 'quoted text' 'quoted text'
+		test "$1" --verbose /usr/bin echo grep done
+	| export -eu sed -eu printf /usr/bin --verbose then readonly && echo grep
+		"$@" 'quoted text' sed test
+	${HOME} export export x=1 test ${HOME} x=1 /usr/bin printf && export
+-eu --verbose done "$@" cd --verbose
+"$@" sed ${HOME} printf printf then "$@" --verbose
+		then /usr/bin readonly test ${HOME}
+	'quoted text' cd grep ${HOME} "$1"
+2>/dev/null x=1 "$1" grep /usr/bin "$1" --verbose local "$@" 2>/dev/null 'quoted text'
+awk ${HOME} -eu "$@" ${HOME}
+		"$@" $(pwd) printf cd readonly 'quoted text'
+	grep echo 2>/dev/null sed test readonly "$@" "$1" printf /usr/bin
+		| 2>/dev/null "$1" $(pwd) --verbose 2>/dev/null && echo done
+	sed 2>/dev/null $(pwd) | 2>/dev/null ${HOME} local export && cd &&
+	--verbose x=1 /usr/bin test -eu /usr/bin readonly $(pwd) -eu
+		x=1 --verbose cd 'quoted text' local "$1" readonly
+	printf then $(pwd) test "$@" grep $(pwd) printf readonly sed
+	echo readonly sed test sed grep --verbose $(pwd)
+		awk && /usr/bin printf 'quoted text' grep readonly cd /usr/bin
+$(pwd) export "$1" && echo "$1"
+export printf done then done printf $(pwd) $(pwd) awk grep export cd then test
+	export printf $(pwd) $(pwd) grep x=1 echo
+	printf awk test 'quoted text' then export 2>/dev/null 'quoted text'
+${HOME} readonly printf "$1" printf x=1 local
+/usr/bin 'quoted text' "$1"
+		done 'quoted text' readonly printf readonly grep grep grep done
+		then "$1" | && awk cd done /usr/bin "$1" /usr/bin
+	sed local printf readonly grep && $(pwd) 2>/dev/null --verbose sed
+		test readonly --verbose echo -eu x=1 "$1" x=1
+	${HOME} test echo local ${HOME} printf cd test
+	grep awk --verbose && readonly 'quoted text' $(pwd) $(pwd) printf $(pwd) awk grep
+	then cd printf local x=1 /usr/bin
+		done awk -eu "$@" echo printf
+echo $(pwd) awk export then echo $(pwd) x=1 grep then 2>/dev/null
+awk "$1" echo test /usr/bin --verbose --verbose grep then /usr/bin readonly 2>/dev/null
+		printf sed 'quoted text' /usr/bin
+	cd ${HOME} cd /usr/bin "$@"
+	"$1" 2>/dev/null /usr/bin export sed /usr/bin sed | $(pwd) awk -eu "$1" x=1
+	--verbose test printf grep export export grep && echo then && local "$1" x=1
+then printf "$@" cd "$@" /usr/bin export
+"$@" sed done export echo
+		printf "$1" --verbose && done "$@" "$1" cd "$@" | export "$@" grep done
+	sed printf "$@" --verbose 2>/dev/null printf local "$1" sed echo &&
+	test then ${HOME} && test then 'quoted text' echo done "$1"
+	test sed sed echo done then test awk $(pwd) sed $(pwd)
+2>/dev/null "$1" awk | "$1" echo
+2>/dev/null ${HOME} grep
+		sed then --verbose | && 2>/dev/null
+		/usr/bin x=1 -eu readonly done export printf test 2>/dev/null echo ${HOME} 2>/dev/null
+| grep echo done grep x=1 sed awk printf echo 'quoted text' "$1"
+		readonly awk --verbose x=1 'quoted text'
+		readonly "$1" readonly awk grep --verbose
+	-eu printf readonly $(pwd) cd cd /usr/bin printf export --verbose -eu
+/usr/bin printf /usr/bin export && test 2>/dev/null
+		echo "$1" | 'quoted text' && test done awk readonly test
+	| 'quoted text' done "$1" awk done grep awk awk --verbose
+		readonly /usr/bin x=1 local "$@" done "$@" /usr/bin ${HOME}
+	awk x=1 export "$@" "$@" cd printf x=1 /usr/bin --verbose
+awk ${HOME} $(pwd) "$1" echo 2>/dev/null && then --verbose printf done
+echo /usr/bin --verbose ${HOME}
+/usr/bin test -eu ${HOME} done then local "$1" cd awk local local cd
+		readonly 'quoted text' readonly "$1"
+	echo /usr/bin sed ${HOME} printf export printf
+| cd "$@" test $(pwd) 'quoted text' readonly printf x=1 --verbose local grep sed
+	| && "$1" awk ${HOME} ${HOME} && x=1 printf echo --verbose sed ${HOME} printf test
+	${HOME} "$@" echo then $(pwd) ${HOME} printf
+/usr/bin ${HOME} echo sed -eu $(pwd) 'quoted text' 'quoted text' 'quoted text'
+		&& sed awk -eu echo $(pwd) 'quoted text' x=1 $(pwd) sed "$@" "$@" -eu
+		grep && x=1 cd awk then -eu --verbose export -eu --verbose
+readonly -eu "$1" && $(pwd) readonly readonly grep --verbose
+	then ${HOME} echo | echo /usr/bin 2>/dev/null printf 2>/dev/null
+		"$@" test readonly then then readonly done -eu "$1" readonly ${HOME} "$@" && $(pwd)
+	readonly -eu done "$@" local test "$1" readonly 2>/dev/null cd $(pwd)
+awk printf grep local x=1 ${HOME} 'quoted text' echo /usr/bin $(pwd)
+$(pwd) $(pwd) echo /usr/bin "$@" local /usr/bin done cd awk test
+		then export test $(pwd) "$@" && export /usr/bin "$@" "$1" done 'quoted text'
+done test 2>/dev/null cd echo && then 2>/dev/null printf printf "$@" &&
+	then test done sed grep local | then grep 2>/dev/null
+	export grep "$@" cd x=1 local "$1" then readonly cd awk readonly && 2>/dev/null
+		"$@" local local ${HOME} readonly local x=1 2>/dev/null grep cd readonly
+grep -eu awk grep done --verbose echo --verbose -eu export $(pwd) | ${HOME}
+		x=1 2>/dev/null awk $(pwd) readonly
+		${HOME} then export "$@" grep "$@" 2>/dev/null
+		test --verbose grep x=1 -eu export -eu
+		test "$@" echo 'quoted text'
+| -eu $(pwd) test then printf then 'quoted text' -eu ${HOME} /usr/bin 2>/dev/null
+		cd 'quoted text' done grep
+export "$1" --verbose cd /usr/bin x=1 grep 2>/dev/null ${HOME} local
+cd readonly | test -eu printf local "$1" | sed "$@"
+		awk 'quoted text' local 'quoted text' -eu readonly
+x=1 $(pwd) echo ${HOME}
+		awk 2>/dev/null readonly done | printf "$1"
+	x=1 local | grep ${HOME} export --verbose printf cd -eu 2>/dev/null
+	/usr/bin sed export printf
+	x=1 'quoted text' 2>/dev/null "$@" readonly
+export awk done 2>/dev/null done "$1" 2>/dev/null ${HOME}
+		sed 'quoted text' | sed 2>/dev/null -eu
+		cd ${HOME} ${HOME} 'quoted text' x=1
+	'quoted text' $(pwd) grep printf
+		"$@" readonly readonly 2>/dev/null
+	${HOME} $(pwd) test | -eu | 2>/dev/null | sed local && x=1 then | readonly
+printf --verbose && "$1" x=1 x=1 grep "$1" 'quoted text' export
+done /usr/bin ${HOME} readonly x=1 then then -eu --verbose printf 'quoted text'
+	x=1 grep "$@" x=1 ${HOME} "$@" export $(pwd)
+done && 'quoted text' -eu test
+	"$1" done /usr/bin $(pwd)
+awk | readonly then grep && awk ${HOME} echo echo
+readonly 'quoted text' export grep /usr/bin awk "$1" /usr/bin export && sed
+		$(pwd) 2>/dev/null "$@" done --verbose done && sed --verbose
+${HOME} 2>/dev/null export then printf 2>/dev/null then readonly && $(pwd)
+		echo test then 'quoted text' sed ${HOME} "$1" "$1"
+${HOME} -eu 2>/dev/null grep sed done --verbose
+		cd cd export | done --verbose awk readonly -eu printf x=1 export echo printf
+awk 2>/dev/null "$@" grep sed done sed awk -eu printf
+test && echo 2>/dev/null grep 'quoted text' cd cd local awk local
+"$1" --verbose readonly ${HOME} grep | 'quoted text' awk echo local
+	local done /usr/bin readonly export then
+	| -eu then | $(pwd) sed -eu /usr/bin done && && awk cd local && -eu --verbose
+		2>/dev/null -eu echo printf echo cd | 2>/dev/null
+	export 2>/dev/null $(pwd) done awk cd --verbose readonly
+	'quoted text' -eu && awk 2>/dev/null | | cd
+		done $(pwd) 'quoted text' "$@" awk x=1 grep then cd done 2>/dev/null
+	sed | && $(pwd) sed && sed | awk sed "$1"
+	cd x=1 local "$@" x=1 cd grep readonly
+local "$@" test printf readonly test /usr/bin $(pwd) cd -eu local
+	then test -eu done test export 'quoted text' test then test awk "$1"
+		export "$@" "$@" ${HOME} "$1"
+2>/dev/null $(pwd) then x=1 awk export
+"$@" && printf "$1" --verbose grep local $(pwd) export
+	awk awk /usr/bin test --verbose cd echo "$1" sed
+	-eu "$@" 'quoted text' cd readonly --verbose
+	done 2>/dev/null && $(pwd) | /usr/bin 2>/dev/null
+done && ${HOME} sed readonly then --verbose awk then awk $(pwd)
+		grep local awk then done $(pwd) then | $(pwd) "$1"
+	"$@" export echo test then printf /usr/bin x=1 "$@"
+	done grep readonly --verbose "$@" ${HOME} done readonly
+-eu /usr/bin awk "$@" cd echo local awk --verbose 2>/dev/null 'quoted text'
+awk then grep readonly ${HOME} /usr/bin --verbose x=1
+	test && | x=1 /usr/bin
+	grep printf 2>/dev/null cd ${HOME} -eu
+	readonly | && cd then awk echo echo then local --verbose
+	&& x=1 2>/dev/null sed cd $(pwd) then readonly "$@" readonly $(pwd)
+'quoted text' ${HOME} /usr/bin local sed 'quoted text'
+export then printf | "$1" cd ${HOME}
+		"$1" --verbose ${HOME} && cd then done
+		/usr/bin done grep | | echo echo readonly test --verbose echo printf
+		printf --verbose 2>/dev/null readonly
+readonly then | grep sed
+${HOME} cd printf 2>/dev/null x=1 readonly $(pwd) 2>/dev/null cd
+echo $(pwd) test "$1" /usr/bin
+		grep "$@" printf then cd sed local /usr/bin ${HOME} -eu 'quoted text'
+	cd && readonly /usr/bin 'quoted text'
+	cd -eu local x=1 printf test export -eu awk $(pwd) test then export x=1
+echo "$@" done 2>/dev/null
+	x=1 export cd test local grep -eu | 'quoted text'
+"$@" done sed done local test echo readonly 2>/dev/null | done printf echo --verbose
+		--verbose 'quoted text' printf 'quoted text'
+		readonly grep "$@" x=1 'quoted text' 2>/dev/null x=1 test
+&& readonly --verbose "$@" test done ${HOME} && then then done ${HOME} awk $(pwd)
+	&& local "$@" | 2>/dev/null done /usr/bin "$@" then printf echo readonly -eu
+		"$@" printf export test readonly $(pwd) x=1 'quoted text'
+local grep echo 2>/dev/null awk "$1" local | 'quoted text' echo
+then then $(pwd) -eu ${HOME} cd /usr/bin $(pwd) export x=1 cd readonly
+| /usr/bin sed $(pwd)
+		awk /usr/bin "$1" && $(pwd) local --verbose ${HOME} cd
+	&& 2>/dev/null -eu /usr/bin "$1" test then done printf cd test grep /usr/bin
+	sed cd | | readonly $(pwd) |
+	printf done "$@" 'quoted text' grep then /usr/bin
+		"$@" readonly sed && printf test echo then ${HOME} -eu "$1" | awk 2>/dev/null
+		echo export done sed local /usr/bin done awk $(pwd) x=1 && local
+readonly test $(pwd) 'quoted text'
+		"$1" printf echo sed then printf done sed export 2>/dev/null local then ${HOME}
+		done /usr/bin "$@" -eu cd export
+	awk --verbose ${HOME} then
+sed 'quoted text' awk local export then test grep awk x=1 test --verbose $(pwd)
+then export export cd 2>/dev/null 2>/dev/null "$@" awk
+sed 'quoted text' --verbose then cd done cd | printf
+		2>/dev/null -eu x=1 | --verbose printf export -eu export
+&& done 'quoted text' ${HOME} $(pwd) cd printf
+		export $(pwd) 'quoted text'
+"$1" grep cd $(pwd) then export /usr/bin test then
+		readonly grep cd && cd -eu "$@" ${HOME} "$1" readonly | $(pwd)
+cd $(pwd) awk 'quoted text' then $(pwd) && done awk test
+	"$1" $(pwd) grep "$1" && ${HOME} $(pwd) printf printf
+| awk printf 'quoted text'
+		readonly ${HOME} $(pwd) $(pwd) grep && | --verbose
+	test 'quoted text' awk grep 'quoted text' -eu local | sed x=1 'quoted text'
+	-eu $(pwd) 2>/dev/null test x=1 2>/dev/null then printf test 'quoted text' done
+		"$1" then | test "$1" -eu ${HOME} sed then /usr/bin
+	test $(pwd) $(pwd) "$@" /usr/bin /usr/bin && export
+/usr/bin "$1" test test printf ${HOME} readonly
+	"$@" done -eu -eu grep done done "$@" "$1" -eu
+cd cd -eu && | "$@" "$@"
+		x=1 sed then printf "$@" then && /usr/bin 2>/dev/null /usr/bin
+	-eu $(pwd) grep done grep --verbose | sed x=1 --verbose
+'quoted text' sed /usr/bin 'quoted text' "$@"
+	x=1 /usr/bin sed awk test -eu export --verbose
+local local done printf cd 2>/dev/null
+printf done | cd done
+		2>/dev/null grep test local then | 2>/dev/null "$1" "$@" /usr/bin
+--verbose readonly readonly cd export --verbose /usr/bin sed local "$@" grep
+		-eu then "$@" -eu && -eu cd grep
+grep 'quoted text' test export && export sed $(pwd) $(pwd) grep awk grep
+test "$1" /usr/bin 'quoted text'
+		cd cd -eu grep "$1" | awk
+${HOME} | done $(pwd) local "$@" ${HOME} echo then | printf /usr/bin
+&& x=1 'quoted text' --verbose sed ${HOME} sed grep /usr/bin $(pwd) printf 'quoted text'
+	/usr/bin cd "$1" | then printf 'quoted text'
+		then x=1 x=1 readonly --verbose grep --verbose grep && "$1"
+	-eu 'quoted text' "$1" test --verbose
+	$(pwd) ${HOME} printf
+printf "$@" -eu readonly -eu 'quoted text' local ${HOME} then awk && printf
+echo | cd "$@" "$@" | grep cd ${HOME} sed done 2>/dev/null 'quoted text'
+	echo local test && --verbose readonly done --verbose done
+		cd 2>/dev/null 'quoted text' awk -eu | | awk 2>/dev/null
+		${HOME} sed $(pwd) local printf -eu
+		printf x=1 grep /usr/bin "$1"
+	echo grep done grep done --verbose local -eu | printf
+	-eu "$@" echo "$1" -eu && echo readonly x=1 grep sed "$@" --verbose
+		2>/dev/null 2>/dev/null 2>/dev/null /usr/bin done echo x=1 $(pwd) awk cd ${HOME}
+	readonly /usr/bin test --verbose 'quoted text' 2>/dev/null cd
+export then test local cd 'quoted text' then
+/usr/bin ${HOME} | then | /usr/bin done -eu x=1 -eu then export
+	echo --verbose sed echo then 'quoted text' $(pwd) done test grep | /usr/bin
+		"$1" 'quoted text' "$1" grep done $(pwd) -eu 'quoted text' export $(pwd) readonly
+done 2>/dev/null grep 2>/dev/null export
+	/usr/bin && printf grep awk readonly $(pwd) -eu printf && --verbose -eu ${HOME}
+	readonly readonly done echo
+	grep $(pwd) echo | echo done test "$1"
+--verbose cd test done | readonly awk local awk "$1" awk --verbose grep
+"$1" 2>/dev/null local export --verbose
+	awk printf cd -eu done /usr/bin 2>/dev/null | test echo $(pwd)
+	done -eu readonly readonly readonly $(pwd) test "$1" $(pwd) "$@" awk sed x=1
+		--verbose then readonly cd
+	2>/dev/null --verbose echo
+printf cd && local | export export "$1" local local grep export
+2>/dev/null $(pwd) | done echo grep 'quoted text' /usr/bin
+2>/dev/null sed local printf export
+${HOME} && grep "$@" test then local "$1" 'quoted text' 'quoted text' echo $(pwd)
+"$@" /usr/bin sed then 2>/dev/null
+readonly printf test && x=1 done
+	awk export --verbose x=1 awk export $(pwd) readonly "$1" 2>/dev/null then
+	2>/dev/null awk --verbose && | awk grep 2>/dev/null then x=1 export printf
+	| then ${HOME} then readonly x=1 $(pwd) --verbose /usr/bin -eu sed 2>/dev/null
+		then /usr/bin | 'quoted text'
+	"$@" local grep /usr/bin $(pwd) && $(pwd) test grep cd readonly printf
+	/usr/bin export readonly test -eu export 'quoted text' readonly ${HOME}
+printf $(pwd) ${HOME} export
+	--verbose | ${HOME} printf readonly sed then /usr/bin 2>/dev/null
+"$1" echo sed done grep ${HOME}
+test "$@" x=1 printf done &&
+		done readonly | printf test -eu | /usr/bin awk /usr/bin then then $(pwd) x=1 echo
+	echo printf "$@" --verbose -eu 2>/dev/null "$@" | 2>/dev/null
+		/usr/bin "$@" /usr/bin $(pwd) | awk awk done readonly && 'quoted text'
+		readonly 'quoted text' -eu local && test echo
+	then awk awk 2>/dev/null printf
+		sed echo /usr/bin readonly export 2>/dev/null sed "$1"
+done | /usr/bin | $(pwd) $(pwd) grep done grep $(pwd) test 2>/dev/null done
+	export ${HOME} local export grep awk readonly sed printf awk readonly
+	2>/dev/null 'quoted text' printf | x=1
+	/usr/bin grep awk --verbose local -eu then ${HOME}
+	/usr/bin printf export cd x=1 $(pwd) local "$@" sed "$1" x=1 2>/dev/null
+	"$@" -eu "$1" "$1" 2>/dev/null
+	then awk | local grep sed 2>/dev/null $(pwd) printf local | sed "$@" $(pwd) local
+		--verbose readonly grep "$1" then $(pwd) --verbose local grep -eu 2>/dev/null
+		local done readonly local export ${HOME} local printf then
+		x=1 'quoted text' awk 2>/dev/null /usr/bin -eu /usr/bin 'quoted text' 2>/dev/null
+	${HOME} $(pwd) $(pwd) 2>/dev/null test awk local | test test then
+	'quoted text' && 'quoted text' grep 2>/dev/null 'quoted text' grep
+	$(pwd) cd echo x=1 sed "$1" $(pwd) --verbose
+		"$1" x=1 "$@" readonly ${HOME} grep grep echo sed sed done sed $(pwd)
+		test done /usr/bin echo 'quoted text' ${HOME} test x=1
+	x=1 && $(pwd) 2>/dev/null | --verbose /usr/bin x=1 then --verbose
+	'quoted text' printf grep --verbose local
+	"$@" ${HOME} ${HOME} printf grep "$@" readonly local ${HOME}
+		cd && "$@" grep sed then |
+	2>/dev/null --verbose $(pwd) printf -eu echo --verbose /usr/bin
+		test 'quoted text' export 'quoted text'
+done grep -eu printf x=1 /usr/bin test /usr/bin export echo "$@" 2>/dev/null
+	/usr/bin --verbose "$@"
+		then printf awk $(pwd)
+		then test /usr/bin grep -eu ${HOME} -eu readonly x=1 --verbose awk | "$1" sed
+		echo test "$1" | done sed readonly local sed test test
+grep grep then $(pwd) "$@" grep cd then "$@" -eu -eu
+	${HOME} && local --verbose local 'quoted text'
+'quoted text' && "$@" sed $(pwd)
+sed local sed done /usr/bin then local $(pwd) -eu
+sed readonly ${HOME} && "$@"
+		--verbose export cd test local echo x=1 test sed export echo x=1 --verbose
+"$@" done printf "$@" then
+sed printf awk && /usr/bin then
+	"$@" readonly cd /usr/bin
+	'quoted text' sed awk "$1" --verbose
+${HOME} "$@" x=1 then local sed "$@" awk $(pwd) grep -eu export "$@"
+	--verbose local cd readonly 'quoted text' sed && $(pwd) sed
+		awk grep grep 2>/dev/null /usr/bin test ${HOME} $(pwd)
+&& 'quoted text' echo | grep readonly 'quoted text' $(pwd) test | "$1" cd
+		&& readonly --verbose "$@"
+	sed "$@" x=1 local cd /usr/bin && readonly
+	export test awk test done awk echo "$1" printf -eu done x=1 'quoted text' done -eu
+	-eu /usr/bin export cd && awk -eu then -eu local then
+		readonly 'quoted text' | "$1" test grep awk awk /usr/bin local 2>/dev/null 'quoted text'
+		x=1 && grep test && grep awk then local 'quoted text' readonly -eu local
+		readonly done echo && --verbose done printf
+test cd then "$@" "$@" | 2>/dev/null
+		echo ${HOME} 'quoted text' test grep done echo
+	| "$@" readonly test printf done cd x=1 grep --verbose "$@" done
+		'quoted text' ${HOME} 'quoted text'
+awk /usr/bin done local --verbose
+echo cd echo echo --verbose --verbose "$@" && -eu cd echo $(pwd)
+cd /usr/bin export ${HOME} && "$1" && -eu --verbose
+printf awk export && sed -eu cd
+	$(pwd) readonly sed /usr/bin
+		cd 'quoted text' -eu --verbose -eu echo then
+		-eu "$1" "$@" sed 'quoted text' export
+		awk printf /usr/bin echo "$@" 'quoted text' grep echo "$1"
+$(pwd) 2>/dev/null x=1
+		/usr/bin && "$@" export "$@" x=1 "$@" $(pwd)
+'quoted text' "$1" | 2>/dev/null && done then 'quoted text'
+		local 2>/dev/null awk awk | | | | printf
+	sed test && x=1 /usr/bin 2>/dev/null ${HOME} done echo printf echo "$@" printf
+x=1 cd && cd 2>/dev/null x=1 echo grep && grep
+${HOME} test 'quoted text' 'quoted text'
+"$@" /usr/bin $(pwd) /usr/bin --verbose
+--verbose local 2>/dev/null awk x=1 -eu cd echo /usr/bin
+	-eu sed $(pwd) awk x=1 test readonly
+	then echo && "$1" export test --verbose cd /usr/bin $(pwd) -eu
+		awk && && "$1" test -eu
+	grep ${HOME} "$@" "$1" readonly awk ${HOME} 2>/dev/null
+		"$@" sed "$@" 'quoted text'
+	2>/dev/null sed printf
+then printf /usr/bin /usr/bin echo printf ${HOME} sed x=1 'quoted text'
+test done x=1 local x=1 local | /usr/bin grep $(pwd)
+		$(pwd) -eu awk grep | "$@" /usr/bin printf sed cd then /usr/bin --verbose
+local local "$1" done grep "$1" test x=1 export readonly test && then
+local readonly then "$1" $(pwd) 2>/dev/null 'quoted text' export sed ${HOME}
+		$(pwd) sed local done local sed | | local printf local x=1 | -eu awk | 2>/dev/null
+	grep "$1" echo --verbose done cd 'quoted text' local test printf
+$(pwd) /usr/bin awk ${HOME} local export ${HOME} awk 'quoted text'
+readonly cd done awk && 2>/dev/null export export -eu 2>/dev/null grep cd -eu /usr/bin
+-eu export printf -eu /usr/bin "$@" printf local --verbose then "$1" cd then
+		-eu awk cd 2>/dev/null "$@" "$1" export
+then x=1 -eu ${HOME}
+"$1" x=1 local x=1 sed --verbose $(pwd) local local awk "$@" ${HOME}
+	local "$@" echo && done "$1" "$1"
+		2>/dev/null 2>/dev/null ${HOME} export "$1" readonly readonly && $(pwd) echo "$1"
+$(pwd) sed awk 'quoted text' then
+		| -eu | ${HOME} sed done awk -eu test | echo |
+/usr/bin cd echo 'quoted text' grep printf ${HOME} sed && readonly
+--verbose grep printf then
+	local readonly 'quoted text' echo then ${HOME} && ${HOME} awk local ${HOME}
+		grep x=1 cd readonly export cd
+		&& -eu /usr/bin ${HOME} readonly /usr/bin $(pwd) done $(pwd) grep x=1
+	readonly export x=1 readonly | printf "$@" grep "$@"
+		&& done grep | "$@" --verbose
+x=1 sed "$@" x=1 "$@" 'quoted text' readonly done echo /usr/bin test 2>/dev/null
+		export "$1" grep test /usr/bin sed done readonly ${HOME} "$@"
+		2>/dev/null printf $(pwd) echo export export 'quoted text' /usr/bin
+		'quoted text' cd /usr/bin export x=1 local 2>/dev/null ${HOME}
+	| x=1 /usr/bin | awk test 'quoted text'
+		| then printf export 'quoted text'
+	export ${HOME} x=1 awk -eu
+| "$@" readonly done local | grep "$@" awk sed export test awk
+x=1 'quoted text' /usr/bin --verbose ${HOME} 'quoted text' echo
+		--verbose export echo cd "$@" | awk export then awk $(pwd) readonly
+sed cd printf done 'quoted text'
+then 2>/dev/null awk then done printf ${HOME} 'quoted text'
+	$(pwd) -eu echo test --verbose "$1" cd printf test
+	readonly /usr/bin && x=1 cd && awk x=1 ${HOME} "$1" test cd |
+cd && "$@" --verbose local &&
+		sed -eu $(pwd) test "$@" --verbose cd export then test
+	test printf export | test sed then --verbose
+		/usr/bin sed ${HOME} "$1" awk sed 'quoted text' export done
+		"$@" readonly "$@" $(pwd) 'quoted text'
+	| | readonly sed 2>/dev/null test 'quoted text' readonly
+	x=1 ${HOME} "$@" --verbose 2>/dev/null "$1" then && echo local --verbose
+	'quoted text' cd "$1" awk done cd --verbose 'quoted text' awk x=1 awk
+		--verbose -eu "$1" sed --verbose && test
+2>/dev/null echo 'quoted text' printf awk $(pwd)
+		readonly | test --verbose --verbose
+		2>/dev/null $(pwd) "$@" echo test "$1" x=1 done test local grep
+	&& awk "$@" grep /usr/bin "$@"
+		$(pwd) | awk export local done | sed /usr/bin sed echo echo cd | --verbose
+		$(pwd) grep done export export "$1"
+| ${HOME} $(pwd) $(pwd) readonly export 'quoted text'
+	x=1 awk /usr/bin x=1 done readonly 2>/dev/null -eu 'quoted text'
+| 2>/dev/null local x=1 "$@" 2>/dev/null then sed sed -eu
+		grep printf /usr/bin && cd cd then echo then
+	export readonly echo && done local 2>/dev/null "$@" --verbose awk 2>/dev/null
+		test then --verbose printf export local grep test done 2>/dev/null
+		test test && 'quoted text' | | -eu awk readonly then grep -eu "$@" readonly cd 2>/dev/null
+		"$1" 2>/dev/null | --verbose printf
+&& grep ${HOME} test echo export /usr/bin ${HOME} grep readonly
+	"$@" export ${HOME} ${HOME} --verbose awk grep
+grep test x=1 echo done export local cd -eu 2>/dev/null
+		/usr/bin | echo then local $(pwd)
+		awk "$1" -eu awk | grep
+	| "$@" && /usr/bin echo && && export echo
+		done grep cd && && local grep readonly local echo -eu
+	/usr/bin 'quoted text' ${HOME} done $(pwd) export "$@" echo && test sed test
+x=1 $(pwd) test then 2>/dev/null
+2>/dev/null ${HOME} | cd -eu test /usr/bin export
+"$1" test then -eu "$1" done sed /usr/bin /usr/bin
+	export awk echo -eu test export
+	echo done | ${HOME} local "$1" && grep local /usr/bin | "$1" sed done --verbose
+grep local 'quoted text' "$1" export done 'quoted text'
+		done ${HOME} $(pwd) printf && awk
+then "$1" readonly export
+export then readonly
+	/usr/bin export printf export --verbose 'quoted text' local -eu
+	"$1" cd 'quoted text' -eu x=1 --verbose
+		export "$@" local export --verbose && cd 2>/dev/null echo /usr/bin then then
+	$(pwd) printf 'quoted text' then --verbose 2>/dev/null | x=1 --verbose
+	"$@" 2>/dev/null $(pwd) ${HOME}
+		&& "$@" done && done --verbose && ${HOME} printf cd 2>/dev/null
+	$(pwd) sed readonly test && -eu echo | then
+		2>/dev/null x=1 done export x=1 "$1" "$@"
+test | sed awk then local "$@" readonly printf local -eu echo 'quoted text' | x=1
+		echo echo && test awk then "$1" echo && cd 'quoted text' done test test /usr/bin
+	grep --verbose awk printf -eu
+	export grep then export cd sed then done local test --verbose
+		'quoted text' readonly
+x=1 echo grep 2>/dev/null then $(pwd) then
+echo sed && grep && done --verbose /usr/bin sed grep local
+		cd | done && /usr/bin "$@" ${HOME} "$1" "$@" ${HOME} awk "$@"
+readonly ${HOME} "$@" awk local sed readonly echo "$1" cd "$1" local
+	test "$@" /usr/bin sed printf test readonly export $(pwd) 2>/dev/null
+	readonly --verbose grep
+		${HOME} echo "$@" local test --verbose x=1 test test $(pwd) test "$1"
+	-eu -eu 'quoted text' --verbose
+	--verbose x=1 then $(pwd) test --verbose test x=1 --verbose test
+	cd local | --verbose grep awk /usr/bin 'quoted text'
+cd export -eu x=1 readonly awk
+		/usr/bin 2>/dev/null awk ${HOME} cd then awk /usr/bin $(pwd) grep /usr/bin
+--verbose done /usr/bin awk grep printf cd export echo ${HOME}
+		export | -eu "$@" export grep -eu
+done grep grep cd -eu printf && 2>/dev/null "$@" &&
+| echo printf then echo export then readonly then | 2>/dev/null then
+	awk done then 'quoted text' export /usr/bin done awk
+echo awk echo -eu --verbose done test awk echo sed "$1" then test /usr/bin --verbose
+		'quoted text' then 'quoted text' 'quoted text'
+$(pwd) echo /usr/bin done test ${HOME} awk
+sed local && readonly cd sed
+	'quoted text' 'quoted text' /usr/bin 2>/dev/null | 'quoted text' printf
+		printf $(pwd) echo x=1 echo
+	awk printf --verbose then test 2>/dev/null
+sed x=1 /usr/bin printf -eu /usr/bin x=1 readonly && 2>/dev/null
+export 'quoted text' cd && then ${HOME} 2>/dev/null -eu --verbose
+done cd $(pwd) && ${HOME}
+		test awk local local awk test export x=1
+$(pwd) "$@" local readonly /usr/bin test local /usr/bin /usr/bin printf
+| echo readonly $(pwd) grep 'quoted text' export done "$@" grep test
+		printf echo export | local export x=1 local awk test
+	test | local echo export
+		echo 'quoted text' test echo
+	then test export sed then "$@" "$@" awk awk 'quoted text' readonly export awk
+then local local cd sed
+		2>/dev/null $(pwd) -eu printf 2>/dev/null x=1 done && readonly $(pwd)
+--verbose export awk printf "$1"
+	"$1" 'quoted text' $(pwd) | then
+	--verbose -eu 2>/dev/null "$@" "$@" | "$1" --verbose then printf $(pwd)
+	test | -eu x=1 echo sed 'quoted text' ${HOME} done cd cd -eu echo
+		x=1 $(pwd) $(pwd) ${HOME} test -eu awk "$@" $(pwd)
+	printf -eu done then awk "$1" /usr/bin ${HOME} echo echo "$@" awk | "$@" /usr/bin
+	${HOME} grep 2>/dev/null printf awk echo
+	| | done then export "$@" done local | --verbose
+	--verbose "$1" --verbose "$@"
+	--verbose then && "$1" "$@" printf 'quoted text'
+	${HOME} test cd $(pwd) --verbose ${HOME} --verbose
+		$(pwd) --verbose awk && cd readonly sed grep test "$1" test
+	"$@" $(pwd) then --verbose "$1" $(pwd) cd /usr/bin cd 'quoted text'
+	export "$1" sed --verbose
+	/usr/bin "$1" x=1 | echo /usr/bin "$1" sed ${HOME} sed && -eu test -eu
+	-eu | readonly local && then done && x=1 local
+echo "$1" printf --verbose cd
+${HOME} 2>/dev/null $(pwd)
+		| echo x=1 && grep awk /usr/bin $(pwd) ${HOME} readonly done ${HOME}
+	sed --verbose grep readonly 2>/dev/null then $(pwd) -eu ${HOME} /usr/bin --verbose
+then printf awk done 'quoted text' printf echo
+	&& printf done && awk sed echo echo grep -eu
+local $(pwd) /usr/bin grep local sed printf /usr/bin grep printf sed then ${HOME}
+	done && echo echo && then $(pwd) -eu then done echo ${HOME} cd ${HOME}
+		&& echo -eu export "$@"
+		test | awk "$1" awk echo then awk 2>/dev/null 2>/dev/null
+		'quoted text' local done
+	&& echo sed done cd printf
+		x=1 ${HOME} done test grep test ${HOME} then $(pwd) echo export $(pwd) readonly
+	done --verbose printf readonly grep echo
+2>/dev/null 'quoted text' | 'quoted text' $(pwd) done --verbose /usr/bin |
+	&& "$1" local test -eu /usr/bin cd
+		2>/dev/null readonly "$@" 2>/dev/null "$1" 2>/dev/null grep x=1 done 2>/dev/null
+	x=1 readonly printf -eu sed printf export ${HOME} && local
+&& printf 'quoted text' "$@" | -eu x=1 readonly $(pwd)
+readonly local ${HOME} $(pwd)
+export awk cd | | grep cd x=1 -eu x=1 && -eu awk 'quoted text'
+then awk printf | 'quoted text' | x=1 2>/dev/null x=1 /usr/bin cd readonly
+then local && grep test sed printf "$@" then -eu then
+		$(pwd) grep export then then /usr/bin "$@" done 2>/dev/null
+-eu done awk 'quoted text'
+| "$1" "$@" /usr/bin printf local &&
+		x=1 | readonly "$1" awk $(pwd) --verbose
+	| ${HOME} 'quoted text' $(pwd)
+		export $(pwd) awk awk --verbose done | --verbose done awk local echo 'quoted text'
+	test local echo cd 'quoted text' readonly | 2>/dev/null
+		done sed printf cd test $(pwd)
+done awk sed readonly export cd echo "$@" 2>/dev/null
+	'quoted text' "$1" 2>/dev/null echo | x=1 x=1 -eu "$1" /usr/bin sed readonly
+${HOME} cd readonly grep /usr/bin awk "$@" $(pwd) "$1" then
+		local ${HOME} done grep local done
+"$@" done 2>/dev/null "$@" local && printf | ${HOME} && readonly export
+		| cd sed ${HOME} "$@" 2>/dev/null && then cd x=1 printf
+readonly grep export "$1" grep awk
+		test done sed && && | x=1 awk export $(pwd) /usr/bin 2>/dev/null local
+		2>/dev/null awk cd x=1 "$1" 'quoted text' readonly x=1
+awk && then $(pwd) ${HOME} done test "$1"
+"$@" export "$@" | "$@" 'quoted text'
+"$1" printf $(pwd) test export cd --verbose echo
+	&& sed 'quoted text' "$@" export "$1" ${HOME} 2>/dev/null
+	sed /usr/bin test $(pwd) ${HOME} sed sed local readonly 2>/dev/null
+$(pwd) awk sed awk sed printf awk test 'quoted text'
+	sed done local local 'quoted text'
+2>/dev/null 'quoted text' echo && local export export
+cd done cd 2>/dev/null 'quoted text'
+| "$1" --verbose grep && "$1" grep ${HOME} "$@" && 'quoted text' grep
+'quoted text' x=1 ${HOME} && | && && grep echo | 'quoted text'
+		$(pwd) echo "$@" 2>/dev/null ${HOME} 'quoted text'
+	grep "$@" 'quoted text' --verbose awk awk grep $(pwd) --verbose cd
+	awk $(pwd) test $(pwd) test printf sed | awk ${HOME} echo x=1 ${HOME} cd | 2>/dev/null
+/usr/bin | /usr/bin local /usr/bin | export printf test export $(pwd) sed grep
+		'quoted text' ${HOME} --verbose -eu $(pwd) then "$1" grep 'quoted text'
+		readonly awk "$1" -eu | 2>/dev/null then "$@" printf
+	printf local readonly "$@" readonly grep
+	then -eu --verbose local awk grep export 2>/dev/null grep echo ${HOME} export
+	| ${HOME} sed then test && printf
+		2>/dev/null awk "$1"
+	| -eu /usr/bin "$@" awk printf 2>/dev/null x=1 "$1" printf export x=1
+	$(pwd) "$1" sed -eu | cd | 2>/dev/null then local test
+	cd readonly "$1" cd $(pwd) then
+	sed test sed export --verbose sed local ${HOME} ${HOME} ${HOME} "$1" --verbose
+		x=1 | done then echo -eu $(pwd) then | test
+local then done export 'quoted text' x=1 x=1 'quoted text' && x=1
+	awk awk 2>/dev/null $(pwd) "$1" "$@"
+--verbose done "$@" -eu then x=1
+| grep 2>/dev/null grep 'quoted text' && && awk done
+-eu ${HOME} test cd ${HOME} export then $(pwd) $(pwd) echo local
+local then cd test cd "$@" test done
+'quoted text' then $(pwd) readonly && -eu echo sed $(pwd)
+		readonly x=1 --verbose readonly | -eu awk echo echo --verbose awk readonly
+	${HOME} export /usr/bin export
+"$1" x=1 readonly /usr/bin awk /usr/bin then ${HOME} printf then
+	sed -eu local done echo x=1
+		/usr/bin sed 'quoted text' x=1 -eu echo cd && grep then /usr/bin
+		grep done --verbose echo export x=1 local awk | grep export test
+export 'quoted text' ${HOME} 2>/dev/null ${HOME} cd
+	awk export grep 'quoted text' -eu --verbose
+done grep 'quoted text'
+		test x=1 awk done done | sed local sed cd | "$@" printf export grep
+		"$1" test && test | 2>/dev/null
+	&& -eu 'quoted text' test local $(pwd) "$1" readonly | printf
+	$(pwd) done then | 'quoted text' -eu $(pwd) --verbose
+sed echo && x=1 $(pwd) cd cd -eu printf readonly --verbose
+printf --verbose test "$1" "$1" awk cd -eu done x=1
+	printf echo 'quoted text' | 'quoted text' sed export
+-eu grep ${HOME} grep
+	grep | x=1 done --verbose "$1" then local test --verbose | "$1" local
+	readonly ${HOME} awk readonly grep && "$1" grep -eu readonly then then
+	--verbose grep test $(pwd) local printf echo test echo "$1"
+	echo readonly 2>/dev/null done -eu "$1" 'quoted text' $(pwd)
+		test $(pwd) && x=1 local "$@" 2>/dev/null "$@" cd | grep 'quoted text'
+		echo export --verbose export --verbose export
+	readonly -eu awk && "$1" &&
+	&& | --verbose awk x=1 export then local ${HOME} local readonly | x=1 test readonly
+	cd 'quoted text' done x=1 done readonly done test printf echo sed export
+		2>/dev/null grep x=1 printf
+		sed "$1" printf --verbose done sed $(pwd)
+		printf "$1" then readonly test | printf $(pwd) | awk && x=1 grep -eu $(pwd)
+	export --verbose echo && done done -eu printf "$1" printf
+test readonly "$1" /usr/bin readonly ${HOME} readonly then /usr/bin x=1
+	sed echo export awk --verbose done 2>/dev/null local awk -eu then -eu
+	$(pwd) "$@" grep "$1" local x=1 then awk local -eu x=1 2>/dev/null 'quoted text'
+--verbose then test then /usr/bin
+	echo awk | test ${HOME} export -eu 'quoted text' local
+		"$@" ${HOME} "$1" | 'quoted text' --verbose
+		"$1" cd echo export awk
+	echo local readonly printf
+	test readonly | --verbose done 2>/dev/null local "$@" cd
+		--verbose printf --verbose x=1 then test 'quoted text' --verbose export
+		'quoted text' "$@" -eu printf local sed $(pwd) 'quoted text'
+	echo "$@" printf then "$1" 2>/dev/null local
+echo 'quoted text' then local grep --verbose /usr/bin sed export
+cd echo readonly then done x=1 export sed | awk 'quoted text' printf awk readonly
+		readonly x=1 echo then $(pwd) echo
+	readonly -eu local printf $(pwd) echo "$@" local | -eu --verbose
+	x=1 $(pwd) "$1" sed export test grep $(pwd)
+		| test echo printf | | |
+		2>/dev/null /usr/bin test
+| && | awk done ${HOME} awk && 2>/dev/null
+	cd "$1" && test 'quoted text' /usr/bin
+printf | awk test -eu local ${HOME} sed awk test local "$@" export 'quoted text'
+$(pwd) 2>/dev/null "$1" "$1" then "$1" then printf done && |
+		-eu && x=1 echo readonly cd done x=1 awk sed --verbose cd sed "$@" 2>/dev/null
+	local readonly readonly /usr/bin done x=1 awk local && --verbose
+		-eu awk echo | "$@" "$@" "$@" local /usr/bin echo | local 'quoted text' sed
+		"$1" test $(pwd) "$@" -eu
+		then done test 'quoted text' readonly cd grep
+		&& && grep local 2>/dev/null "$@" test awk then readonly grep
+		| 'quoted text' echo grep test "$1"
+	--verbose x=1 x=1 grep 2>/dev/null | test local
+		awk "$1" printf /usr/bin $(pwd)
+-eu local cd export cd 'quoted text'
+	| $(pwd) 2>/dev/null "$@" grep
+local grep printf done echo | 'quoted text' export "$1" cd export echo
+${HOME} test /usr/bin export readonly 2>/dev/null 2>/dev/null test
+done "$1" then sed echo done "$@" $(pwd) echo --verbose
+		'quoted text' x=1 "$1" local 'quoted text' "$1"
+/usr/bin x=1 $(pwd) 'quoted text' | x=1 sed echo "$1"
+	sed "$1" local 'quoted text' -eu ${HOME} grep 2>/dev/null
+then export 2>/dev/null awk readonly then test local 2>/dev/null echo export
+		&& 2>/dev/null ${HOME} --verbose readonly 2>/dev/null /usr/bin
+		grep 2>/dev/null done "$1" $(pwd) "$1" | test export
+		then done 'quoted text' && x=1 awk done ${HOME} echo done echo done printf
+	--verbose 'quoted text' /usr/bin printf awk awk grep
+		2>/dev/null "$1" ${HOME} 'quoted text' x=1
+sed --verbose echo 2>/dev/null 2>/dev/null 2>/dev/null -eu "$1" "$1" sed readonly
+		$(pwd) done done printf test cd 'quoted text' "$@"
+		/usr/bin cd echo && readonly printf grep printf test -eu x=1 readonly 'quoted text'
+test ${HOME} awk sed | ${HOME} done awk ${HOME} test ${HOME} --verbose | --verbose
+		done echo sed 2>/dev/null $(pwd)
+		"$1" export done $(pwd) $(pwd)
+	test ${HOME} "$@" --verbose $(pwd) 2>/dev/null then "$@" | 2>/dev/null sed 2>/dev/null
+done 2>/dev/null test local ${HOME} $(pwd) $(pwd) 'quoted text' && test export
+"$@" "$@" x=1 $(pwd) x=1 $(pwd) 'quoted text'
+		| awk "$@" /usr/bin ${HOME} -eu "$@" 'quoted text'
+		| x=1 ${HOME} readonly test export x=1 cd test "$@" && local test
+| local sed grep local test test --verbose export test /usr/bin | -eu /usr/bin
+	x=1 echo echo 2>/dev/null $(pwd) && printf done
+&& | echo export printf $(pwd)
+	sed 'quoted text' x=1
+	sed printf test --verbose
+	-eu awk sed echo echo /usr/bin local
+	'quoted text' sed "$1" ${HOME} done export "$@" -eu "$@" 'quoted text' grep
+		cd export ${HOME} x=1 then 'quoted text' "$@" /usr/bin && printf local echo awk
+		test echo "$1" && | export 2>/dev/null "$@" cd "$1" echo && /usr/bin
+readonly then cd done sed local "$1" ${HOME}
+"$1" local cd readonly | "$1" printf /usr/bin then "$@" readonly sed x=1 test
+	x=1 -eu then && /usr/bin export 'quoted text'
+	done echo | then ${HOME} | --verbose
+		grep | | && ${HOME} echo grep
+		cd "$@" done done 'quoted text' | $(pwd) | export
+printf awk echo sed ${HOME} 2>/dev/null 'quoted text' grep
+2>/dev/null local 'quoted text' readonly 2>/dev/null export grep then
+"$@" 2>/dev/null x=1 /usr/bin
+		cd --verbose sed local $(pwd) grep
+x=1 test /usr/bin export awk 'quoted text' "$@" --verbose
+test done ${HOME} export local printf export sed 'quoted text'
+/usr/bin 2>/dev/null sed printf | printf 2>/dev/null done x=1 &&
+	--verbose echo x=1 -eu "$@" readonly -eu
+		then -eu test sed -eu ${HOME}
+	'quoted text' then x=1 echo
+-eu then -eu --verbose 2>/dev/null
+2>/dev/null x=1 2>/dev/null done printf 'quoted text' test x=1 -eu 2>/dev/null
+		awk "$@" sed --verbose echo $(pwd) export
+	cd local "$@" export export 2>/dev/null && "$@"
+		$(pwd) 'quoted text' -eu export cd && && export grep cd readonly 2>/dev/null /usr/bin
+		grep done ${HOME} "$@" local
+	awk 2>/dev/null awk && readonly
+		-eu "$@" $(pwd) echo "$1" export
+	test /usr/bin test | grep test "$@" done echo x=1 test && grep then $(pwd)
+		export sed echo $(pwd) --verbose printf 'quoted text' local then "$1" x=1
+		export readonly -eu printf awk then
+		printf readonly sed ${HOME} "$1" | cd
+		2>/dev/null --verbose then --verbose | grep
+grep printf $(pwd) "$1" awk
+	'quoted text' readonly test
+| ${HOME} done | 2>/dev/null "$@" then export ${HOME} 'quoted text' export
+		/usr/bin | -eu local 2>/dev/null grep
+		"$1" /usr/bin echo echo ${HOME} "$1" | && $(pwd)
+		"$@" cd 2>/dev/null | readonly printf && 2>/dev/null /usr/bin
+echo done $(pwd) readonly export /usr/bin
+	2>/dev/null sed printf ${HOME} done
+echo test readonly then
+	x=1 printf $(pwd) 'quoted text' "$@" test readonly echo local
+		x=1 "$1" done local printf then done local
+| /usr/bin readonly readonly grep "$1" awk local
+	x=1 'quoted text' x=1 | && 2>/dev/null ${HOME} echo sed 'quoted text' done | readonly
+		&& test 'quoted text' local -eu "$@" | awk && then 'quoted text' -eu | 'quoted text'
+	-eu 'quoted text' cd $(pwd) && awk
+2>/dev/null grep | ${HOME} && /usr/bin --verbose sed | awk
+export cd x=1 && local cd $(pwd) awk readonly
+		| && && 'quoted text' 2>/dev/null 2>/dev/null
+		"$@" local 2>/dev/null /usr/bin
+		$(pwd) readonly $(pwd) -eu /usr/bin x=1 echo && && test
+		readonly -eu awk | awk echo 2>/dev/null local grep x=1 x=1 sed
+export /usr/bin --verbose --verbose
+printf ${HOME} 'quoted text' grep test done ${HOME} printf
+export export "$1" local 2>/dev/null local
+readonly $(pwd) "$1" $(pwd)
+	printf test "$@" -eu readonly 2>/dev/null --verbose -eu export export $(pwd)
+	/usr/bin "$@" | ${HOME} 2>/dev/null && sed
+cd && echo cd 2>/dev/null done 2>/dev/null done /usr/bin 2>/dev/null
+	cd x=1 cd "$1" /usr/bin 2>/dev/null awk grep cd
+		sed sed test 'quoted text' then 2>/dev/null
+$(pwd) ${HOME} ${HOME} "$@" "$1" ${HOME} --verbose | local 2>/dev/null
+		$(pwd) local "$1" "$1" local "$1" $(pwd) --verbose x=1 printf
+x=1 done local local ${HOME} --verbose 2>/dev/null test 'quoted text' "$@"
+		/usr/bin done ${HOME} grep x=1 "$1" sed sed
+	'quoted text' then "$@" done
+	x=1 grep | "$1" && export grep ${HOME} $(pwd) then --verbose printf
+	done $(pwd) --verbose awk printf
+${HOME} then sed echo 2>/dev/null && && ${HOME} cd --verbose local "$@" -eu
+		&& "$@" done readonly /usr/bin x=1 && awk cd awk x=1 awk -eu | awk
+		2>/dev/null x=1 grep x=1 local readonly
+		sed cd cd $(pwd) local 'quoted text' "$1" printf
+done /usr/bin "$@" local test ${HOME} x=1 |
+		local grep 2>/dev/null printf
+	test done export /usr/bin test printf local grep
+		/usr/bin x=1 printf -eu && cd
+-eu | test -eu then 'quoted text' cd 2>/dev/null ${HOME}
+grep && echo sed "$1" x=1 cd readonly test && | "$1" x=1 grep
+| export x=1 local export sed 2>/dev/null
+	grep | "$@" /usr/bin 2>/dev/null "$@" --verbose printf export readonly
+	2>/dev/null "$1" | test -eu
+done readonly cd echo $(pwd) 'quoted text'
+printf echo --verbose x=1 -eu -eu -eu 2>/dev/null
+	printf -eu done && readonly x=1 echo local export then $(pwd) local |
+		awk | && 2>/dev/null test cd
+${HOME} --verbose "$@" x=1 "$@" x=1 && && then echo test ${HOME}
+	x=1 && --verbose export | done x=1 printf
+	test export export local sed
+	${HOME} && /usr/bin "$@" done --verbose "$@" | sed 2>/dev/null
+then readonly test done done "$@" "$1" x=1 "$@" sed |
+test grep then grep && printf x=1 export "$1"
+		export ${HOME} awk echo awk readonly --verbose then "$1" -eu test test
+| local | sed then ${HOME} 'quoted text' /usr/bin local readonly "$1" sed x=1 then
+		test 2>/dev/null readonly "$@" cd x=1 awk cd
+	'quoted text' x=1 sed | 2>/dev/null readonly
+		-eu grep echo echo test awk && 2>/dev/null "$1" | 'quoted text'
+	| local -eu echo /usr/bin then done 'quoted text'
+then local then $(pwd) local | ${HOME} then readonly
+	cd --verbose echo 2>/dev/null ${HOME} ${HOME} then x=1 readonly "$@" export -eu
+"$1" printf --verbose /usr/bin /usr/bin x=1 "$1" cd then 'quoted text' cd "$1"
+	grep done x=1 -eu --verbose 2>/dev/null /usr/bin 'quoted text' awk
+printf && export && cd awk /usr/bin
+	readonly 'quoted text' x=1 && awk test printf local echo ${HOME} | --verbose
+	--verbose 2>/dev/null | $(pwd) local
+		test ${HOME} ${HOME} | printf
+test readonly echo && grep done printf sed local test local | local --verbose
+		"$@" x=1 --verbose "$1"
+		readonly echo 2>/dev/null readonly local "$@" x=1 2>/dev/null | /usr/bin
+echo && | sed printf $(pwd) then then "$@" x=1 cd 'quoted text'
+		x=1 done echo echo export $(pwd) done --verbose "$@"
+	/usr/bin then grep 'quoted text' readonly echo "$@" 2>/dev/null
+-eu --verbose echo cd sed $(pwd)
+printf printf then awk x=1 ${HOME} export local grep readonly ${HOME} /usr/bin
+printf --verbose /usr/bin 2>/dev/null $(pwd) ${HOME}
+	${HOME} echo then export
+	grep --verbose printf 'quoted text' local grep
+	then "$1" "$@" awk then export && test awk sed awk |
+printf "$@" sed awk readonly --verbose && /usr/bin awk printf -eu $(pwd) "$1"
+		awk local | export then 2>/dev/null
+/usr/bin x=1 readonly 2>/dev/null cd --verbose then done export export readonly
+		local x=1 'quoted text'
+		awk echo | 'quoted text' 2>/dev/null
+done cd "$@" | "$@" -eu $(pwd) readonly then
+	x=1 $(pwd) /usr/bin local $(pwd) echo local cd 2>/dev/null sed "$@"
+	x=1 cd "$1" then /usr/bin export echo readonly done sed /usr/bin 'quoted text'
+		"$1" sed awk 'quoted text' awk | 'quoted text' "$@" printf
+cd echo awk done x=1 "$@" --verbose test $(pwd)
+2>/dev/null export "$1" sed then "$@" $(pwd) 'quoted text'
+		-eu then $(pwd) | echo printf awk && && -eu -eu -eu 2>/dev/null awk && echo
+	done test /usr/bin test "$@" awk printf
+2>/dev/null local sed "$1" "$@" -eu readonly 2>/dev/null grep
+${HOME} awk awk printf -eu then "$1" -eu readonly ${HOME}
+-eu then -eu | test 2>/dev/null awk test printf 'quoted text'
+		readonly --verbose local "$@" /usr/bin echo -eu -eu
+		&& 2>/dev/null -eu -eu $(pwd) --verbose x=1 'quoted text'
+awk x=1 /usr/bin 2>/dev/null -eu test "$1" sed grep ${HOME} $(pwd) $(pwd)
+x=1 ${HOME} && | | $(pwd) | readonly local done readonly 'quoted text'
+		--verbose grep test cd
+	| done "$1" printf echo
+		grep readonly --verbose sed then export && export then echo -eu "$1" ${HOME} done
+| echo && then printf done done 'quoted text'
+	--verbose local awk awk -eu | test --verbose | "$@" cd local
+${HOME} | export "$1" 'quoted text' printf
+	"$@" "$@" echo grep then && "$1"
+	sed -eu test $(pwd) $(pwd) grep done x=1 | $(pwd)
+${HOME} readonly local --verbose -eu -eu "$1" | -eu cd --verbose
+--verbose local /usr/bin then done
+		'quoted text' ${HOME} 'quoted text' "$@"
+	grep echo export 'quoted text'
+	$(pwd) && "$1" 'quoted text' local -eu local echo local printf then export readonly
+		-eu /usr/bin grep export "$@" ${HOME} 'quoted text' done
+	&& grep local done then $(pwd) local printf readonly
+	'quoted text' x=1 'quoted text' done sed --verbose awk x=1 x=1
+	grep && x=1 printf then $(pwd) && | 2>/dev/null $(pwd) "$1"
+&& | readonly local readonly test then sed 'quoted text'
+		readonly "$@" test local export | cd done && awk then | && /usr/bin export
+		local x=1 then export awk |
+	printf local | "$@" printf $(pwd) -eu 2>/dev/null
+	grep && grep --verbose readonly test echo --verbose x=1 -eu export 'quoted text'
+		&& 'quoted text' grep -eu echo "$@" local awk awk cd readonly grep ${HOME}
+	| printf local 2>/dev/null "$@" -eu local
+		awk -eu 'quoted text' ${HOME} x=1 sed
+		/usr/bin 2>/dev/null test
+		x=1 2>/dev/null "$1" awk export local cd "$1" sed export sed 2>/dev/null
+x=1 local cd echo echo --verbose sed x=1 local
+	then then ${HOME} grep 'quoted text' done -eu awk done ${HOME}
+	--verbose $(pwd) && awk && readonly 'quoted text'
+	${HOME} | $(pwd) local cd "$1" 2>/dev/null x=1
+		x=1 ${HOME} export "$1" readonly
+readonly cd sed test $(pwd) cd x=1 printf echo "$1" done
+--verbose $(pwd) "$@" -eu x=1 done
+	test | test sed && 2>/dev/null export export export done | export cd readonly
+export sed ${HOME} echo $(pwd)
+	$(pwd) x=1 "$1" printf "$1" "$@"
+	cd readonly 2>/dev/null local test
+	readonly | $(pwd) 'quoted text' | cd awk "$@" "$@" && "$1" readonly ${HOME}
+	awk cd printf then readonly --verbose then x=1
+	/usr/bin printf sed awk
+		then local /usr/bin ${HOME} 'quoted text' x=1 then printf done cd cd test sed $(pwd)
+	"$1" -eu 'quoted text' /usr/bin awk readonly "$1" 2>/dev/null
+sed echo printf echo -eu --verbose then | printf printf -eu
+		done grep x=1 2>/dev/null export -eu
+	cd | test 'quoted text'
+awk ${HOME} printf ${HOME} 2>/dev/null && $(pwd) -eu echo
+		2>/dev/null grep 'quoted text' "$@" cd test awk echo readonly -eu | done
+		&& && --verbose x=1 readonly /usr/bin local sed
+x=1 sed --verbose export -eu -eu $(pwd) | awk
+		'quoted text' -eu "$1" "$@" -eu done "$1" local x=1 export echo
+then done sed && -eu && test && echo done 'quoted text' echo 2>/dev/null 'quoted text'
+sed x=1 "$@" readonly grep test
+		-eu && /usr/bin export /usr/bin -eu
+	"$@" 'quoted text' /usr/bin && awk /usr/bin test 2>/dev/null
+		"$1" awk sed "$1" ${HOME}
+	grep | "$@" sed | cd cd "$1" grep --verbose
+		'quoted text' local printf local $(pwd) 2>/dev/null --verbose
+		"$@" cd 'quoted text' "$@" printf "$1"
+		--verbose local export /usr/bin cd -eu echo | "$@" readonly test printf
+export 2>/dev/null test cd then && awk "$1" cd | echo readonly done
+	| -eu then "$@" then | printf
+		test "$@" | cd test cd sed 'quoted text' -eu "$1" awk echo
+	$(pwd) $(pwd) --verbose && --verbose ${HOME}
+	2>/dev/null $(pwd) 2>/dev/null 'quoted text' ${HOME} "$@"
+| done -eu sed ${HOME} done 2>/dev/null
+		"$@" -eu grep | x=1 local "$@" /usr/bin awk
+"$@" done echo local test && echo done /usr/bin
+| cd $(pwd) local test /usr/bin -eu --verbose && sed printf grep awk
+		then echo awk then readonly | sed "$1" cd 'quoted text' awk | export "$1"
+	test /usr/bin local cd x=1 -eu sed readonly printf
+-eu x=1 2>/dev/null 'quoted text' -eu
+	echo test export grep $(pwd) --verbose then /usr/bin
+	'quoted text' awk && readonly x=1 && echo
+	x=1 then 2>/dev/null awk echo x=1 grep "$1" x=1 readonly
+cd grep grep 2>/dev/null "$@" /usr/bin |
+	echo local ${HOME} 'quoted text' && test "$@" sed
+| | sed ${HOME} --verbose | ${HOME} x=1 $(pwd) ${HOME}
+		cd readonly grep | --verbose
+	readonly 'quoted text' grep 'quoted text' 2>/dev/null ${HOME} 'quoted text'
+	-eu done --verbose test /usr/bin then x=1 && "$1" echo done echo then
+		2>/dev/null 2>/dev/null "$1" /usr/bin done && 'quoted text'
+		x=1 ${HOME} x=1 then && "$1" printf echo awk grep /usr/bin done echo
+		done sed local ${HOME} then then
+	&& && grep readonly readonly readonly test | /usr/bin printf
+sed then 'quoted text' export readonly sed grep then "$@"
+	| $(pwd) sed /usr/bin cd && --verbose
+		local /usr/bin $(pwd) printf 'quoted text' && "$@" -eu export readonly readonly
+		grep x=1 /usr/bin local ${HOME} --verbose readonly done printf
+		export sed | "$1" x=1 $(pwd)
+test $(pwd) cd then 2>/dev/null 2>/dev/null echo cd | --verbose
+		${HOME} && export export cd 'quoted text' done done 2>/dev/null /usr/bin ${HOME}
+	cd local sed "$@" echo then && $(pwd) test "$@"
+		2>/dev/null test 2>/dev/null then 'quoted text' awk readonly awk printf printf
+		--verbose | -eu awk /usr/bin local $(pwd) export sed ${HOME} &&
+"$@" 2>/dev/null echo printf then ${HOME} "$@" $(pwd) done
+2>/dev/null sed ${HOME} $(pwd) then local
+		sed echo printf done "$1" grep -eu ${HOME} ${HOME} ${HOME} then local awk $(pwd)
+-eu -eu /usr/bin awk export ${HOME} test grep test then
+	done sed cd "$@" awk cd done && "$1"
+		'quoted text' test grep cd export && &&
+		-eu local cd export then /usr/bin grep readonly "$1" printf && | --verbose
+awk local grep | cd awk echo | export
+	test then readonly local done ${HOME} | $(pwd) grep echo
+-eu readonly $(pwd) -eu | awk
+$(pwd) | | /usr/bin then $(pwd) 2>/dev/null test local |
+		$(pwd) --verbose done then local $(pwd) | cd ${HOME} /usr/bin awk local "$@"
+		local $(pwd) awk done then -eu awk done ${HOME} awk | local /usr/bin
+	| && "$1" cd done then && 'quoted text' printf local && then /usr/bin cd readonly
+		echo then printf && test cd done -eu |
+export export grep $(pwd) "$@" grep printf printf local sed readonly
+		test --verbose printf test 'quoted text' awk $(pwd) grep "$@" test "$@"
+-eu export cd "$@" -eu printf export x=1 export && local
+		printf 2>/dev/null "$@" 'quoted text'
+		--verbose local -eu test local grep "$@" 2>/dev/null
+		'quoted text' "$1" /usr/bin local awk sed | x=1 test then
+		then echo -eu "$@" 'quoted text' sed |
+sed x=1 'quoted text'
+	&& /usr/bin "$@" x=1 --verbose test sed
+"$@" done "$@" done export
+	"$1" --verbose local ${HOME} "$@"
+		"$1" 'quoted text' --verbose
+	echo -eu 'quoted text' $(pwd) --verbose awk 'quoted text'
+-eu then 2>/dev/null done sed "$1" && 'quoted text'
+	--verbose ${HOME} x=1 /usr/bin cd echo
+cd done x=1 then test 'quoted text' -eu
+test && && ${HOME} awk $(pwd) | echo x=1 ${HOME} export printf done
+x=1 done cd awk sed "$1" grep /usr/bin x=1
+		readonly --verbose "$1" cd && /usr/bin
+		grep ${HOME} -eu 2>/dev/null -eu ${HOME} "$1" awk "$1" -eu cd cd
+grep done ${HOME} 'quoted text'
+		2>/dev/null awk "$1" /usr/bin
+		'quoted text' --verbose export grep --verbose -eu 'quoted text' local 2>/dev/null
+x=1 printf export "$@" &&
+		printf then -eu sed awk readonly grep && --verbose
+		cd --verbose done 2>/dev/null
+then "$@" $(pwd) grep then /usr/bin readonly
+	/usr/bin printf /usr/bin x=1 | export done printf 2>/dev/null
+	/usr/bin echo 2>/dev/null $(pwd)
+		x=1 test /usr/bin then -eu x=1 ${HOME} -eu
+		${HOME} test "$1" "$@" x=1 ${HOME} done 2>/dev/null echo awk readonly
+		x=1 sed echo ${HOME} grep printf && $(pwd)
+	grep grep export then | cd /usr/bin ${HOME} awk 'quoted text'
+		| sed x=1 'quoted text'
+		awk export grep then 2>/dev/null printf $(pwd) export --verbose 2>/dev/null printf
+	cd --verbose && then $(pwd) $(pwd)
+/usr/bin done 'quoted text' done
+grep x=1 "$@" 2>/dev/null &&
+sed | sed 'quoted text' -eu
+#include c175.sh
+	readonly "$1" && cd --verbose 2>/dev/null
+"$1" cd /usr/bin export cd cd awk "$@" 2>/dev/null | x=1
+		export export done sed then echo export export
+		"$@" then then ${HOME} 2>/dev/null echo --verbose 2>/dev/null cd echo
+		then ${HOME} local then local
+"$1" && -eu test && -eu echo
+	cd && $(pwd) ${HOME} /usr/bin 2>/dev/null printf 'quoted text' | "$1" grep
+'quoted text' printf --verbose 2>/dev/null
+		| then 2>/dev/null -eu test $(pwd) "$1" done local /usr/bin | export cd sed
+		"$1" local x=1 "$@" test grep
+		local readonly $(pwd) |
+	local printf test readonly "$1" printf test "$1" && 'quoted text'
+	-eu then 2>/dev/null -eu grep then /usr/bin -eu sed then local
+x=1 "$1" ${HOME} "$@" $(pwd) | local "$@" local
+		/usr/bin "$1" $(pwd) cd grep --verbose --verbose
+cd "$@" done $(pwd) sed test then awk | echo then $(pwd) readonly
+export echo printf -eu
+		local then && && 2>/dev/null 2>/dev/null
+	local then test printf "$@" then echo | sed 2>/dev/null 2>/dev/null $(pwd) 2>/dev/null
+	echo echo done grep export awk test test 'quoted text' awk -eu /usr/bin --verbose
+done readonly 2>/dev/null
+	printf local cd -eu 2>/dev/null echo sed test ${HOME} cd then local export
+	$(pwd) readonly local "$@" 'quoted text'
+2>/dev/null local cd awk then --verbose 'quoted text'
+${HOME} /usr/bin "$1" --verbose
+		--verbose 'quoted text' | sed | printf printf done 2>/dev/null
+	${HOME} readonly echo 'quoted text'
+		2>/dev/null sed echo 2>/dev/null printf local awk --verbose echo "$1"
+'quoted text' x=1 local 2>/dev/null readonly "$1" $(pwd)
+test x=1 $(pwd) export "$1" 2>/dev/null "$@" echo
+	${HOME} "$@" 2>/dev/null && ${HOME} awk ${HOME} x=1 2>/dev/null
+	${HOME} done sed awk test echo --verbose export &&
+		/usr/bin "$1" grep then readonly readonly
+${HOME} --verbose grep sed /usr/bin "$@" readonly --verbose
+test "$@" ${HOME} grep echo && awk printf local
+	done cd test ${HOME} | local readonly readonly readonly printf
+		sed 'quoted text' grep test 2>/dev/null ${HOME} awk -eu awk export |
+		| -eu local then "$1" export
+	done test 'quoted text'
+		2>/dev/null cd readonly local x=1 printf x=1 cd printf ${HOME} /usr/bin
+readonly cd "$1" grep done $(pwd) echo printf local printf $(pwd)
+	sed printf "$@" && 2>/dev/null done
+x=1 -eu local sed readonly && /usr/bin echo -eu local echo test done
+		awk | readonly $(pwd) then cd 2>/dev/null grep
+/usr/bin -eu /usr/bin "$1" 'quoted text' export
+done then awk 'quoted text' grep then test && done
+--verbose echo | echo then --verbose sed --verbose then "$@" then 'quoted text'
+		${HOME} local awk --verbose && ${HOME} --verbose /usr/bin grep
+"$1" then && 'quoted text' -eu "$@" local then
+--verbose 2>/dev/null | readonly --verbose cd printf grep --verbose cd /usr/bin
+	/usr/bin done "$@" grep 2>/dev/null awk
+	${HOME} readonly "$1" "$1" then done | 2>/dev/null -eu "$@" then export then cd
+		test printf done /usr/bin 2>/dev/null echo 2>/dev/null test echo
+echo ${HOME} sed test | test "$@"
+	sed then export "$@" | "$@" local printf local | readonly local
+| test cd awk local $(pwd) test /usr/bin 'quoted text' then readonly
+		-eu export /usr/bin | 2>/dev/null "$1" x=1 readonly 'quoted text' && done "$@"
+${HOME} --verbose 2>/dev/null "$1" awk --verbose
+	test "$1" "$1" -eu "$1" then
+		then then local ${HOME} 'quoted text' 'quoted text' 2>/dev/null
+then export -eu echo && "$1" --verbose grep /usr/bin && -eu grep export then
+		test cd export done printf echo done "$1" $(pwd) "$@" printf
+2>/dev/null then readonly "$@" "$1" $(pwd)
+		test sed x=1 -eu echo test
+"$1" /usr/bin export done
+grep | awk readonly "$1" |
+		x=1 | done "$1" | 2>/dev/null done
+readonly $(pwd) sed 2>/dev/null && -eu "$1" && 'quoted text' ${HOME}
+		printf readonly --verbose 2>/dev/null local test cd "$1" --verbose
+	'quoted text' "$@" --verbose $(pwd) export $(pwd) "$1" "$1" --verbose 'quoted text'
+		x=1 $(pwd) export grep local done | --verbose sed cd then printf
+		&& 2>/dev/null readonly sed /usr/bin cd "$@" /usr/bin $(pwd)
+"$1" echo awk echo 'quoted text' export echo
+echo 'quoted text' -eu readonly "$1" && --verbose
+	cd test printf export 2>/dev/null x=1 ${HOME} -eu "$@" printf
+readonly cd then sed awk done local readonly local
+		-eu printf echo readonly | 2>/dev/null sed
+	grep ${HOME} grep "$1"
+		| 'quoted text' -eu export
+echo readonly x=1 then && 'quoted text'
+2>/dev/null printf && --verbose -eu readonly /usr/bin
+	test echo x=1 grep 2>/dev/null /usr/bin "$@" then export "$@" sed
+		awk -eu x=1 awk local sed /usr/bin
+	done "$@" done local cd then -eu ${HOME} grep "$1" done grep "$1" $(pwd)
+grep then cd sed ${HOME} test $(pwd)
+		export printf echo --verbose cd x=1 | grep grep -eu $(pwd) readonly
+2>/dev/null echo printf "$@" -eu printf export && --verbose
+	printf "$1" grep readonly awk "$@" x=1 -eu x=1 "$1" printf && sed
+	printf printf test test --verbose && "$@" done --verbose grep
+	test -eu grep readonly export echo sed 'quoted text' -eu ${HOME} awk then
+	done grep cd test ${HOME} local echo
+done --verbose && sed awk &&
+		export 'quoted text' $(pwd) 'quoted text' ${HOME} 2>/dev/null readonly
+		'quoted text' && awk &&
+	/usr/bin test awk "$1" /usr/bin
+		$(pwd) ${HOME} "$@" sed $(pwd) --verbose printf | cd ${HOME} 2>/dev/null
+--verbose 2>/dev/null cd | sed local readonly cd && readonly "$1"
+	&& ${HOME} ${HOME} cd
+		done test ${HOME} printf test x=1 local "$@" cd "$@" | 2>/dev/null readonly --verbose
+	echo sed printf then test readonly 2>/dev/null 'quoted text'
+-eu sed local awk done readonly 'quoted text' x=1 2>/dev/null 'quoted text'
+printf | grep -eu | then cd sed ${HOME} | sed awk -eu then done | "$@"
+"$@" ${HOME} $(pwd) readonly done local
+		x=1 sed && ${HOME} && "$1" export local "$@" 'quoted text' $(pwd) /usr/bin printf
+local cd --verbose grep done "$1" "$1" "$1" 'quoted text'
+	awk done /usr/bin done x=1 | 'quoted text' echo /usr/bin ${HOME}
+		sed $(pwd) export cd "$1" test grep
+done -eu printf ${HOME} /usr/bin /usr/bin
+		local x=1 /usr/bin cd printf printf -eu grep
+then printf x=1 2>/dev/null sed | "$@"
+	-eu x=1 2>/dev/null $(pwd) | printf "$1" $(pwd)
+		"$@" printf grep $(pwd) sed sed cd export
+		cd readonly done && $(pwd) --verbose -eu sed
+done | --verbose $(pwd) cd grep | x=1 then --verbose test cd
+		/usr/bin 'quoted text' x=1 x=1 grep
+export /usr/bin /usr/bin /usr/bin printf grep | 2>/dev/null local 2>/dev/null
+	awk "$@" "$1" readonly "$@" --verbose grep
+		readonly x=1 | grep done 'quoted text' local printf
+		"$1" sed $(pwd) -eu echo x=1 readonly -eu awk grep grep local echo cd "$1" awk
+x=1 export | cd /usr/bin "$1" $(pwd) done printf readonly
+	x=1 test x=1 /usr/bin cd export echo readonly /usr/bin awk | 'quoted text'
+	echo 'quoted text' cd sed "$@" echo ${HOME} export
+	test | -eu "$@" test "$1" | readonly 2>/dev/null
+awk $(pwd) test /usr/bin echo $(pwd) | local
+		awk /usr/bin done readonly ${HOME} export && readonly --verbose then
+		then printf readonly then echo
+	/usr/bin done "$@" $(pwd) &&
+	${HOME} "$1" then /usr/bin
+	readonly --verbose 2>/dev/null then printf
+		cd $(pwd) awk readonly grep readonly
+	export 2>/dev/null local sed awk --verbose 'quoted text' "$@"
+		export done local grep grep then x=1 local then 2>/dev/null export
+	local /usr/bin "$1" | sed grep printf awk 'quoted text' done x=1 awk done test
+$(pwd) done echo "$1" && 'quoted text' printf printf done /usr/bin 'quoted text'
+readonly --verbose awk 'quoted text' --verbose done
+	--verbose export x=1 printf test
+		cd then && && cd -eu printf export echo test | then test
+/usr/bin x=1 cd -eu "$1"
+		-eu -eu sed awk test "$@" /usr/bin done
+		/usr/bin cd /usr/bin && 'quoted text' ${HOME} local "$1" awk "$@" 2>/dev/null
+printf awk "$1" x=1 echo echo grep ${HOME} x=1 $(pwd) "$@"
+	grep /usr/bin 2>/dev/null
+&& && cd grep done grep | "$1" -eu /usr/bin echo 2>/dev/null local awk readonly
+		done grep then 2>/dev/null readonly
+local done readonly 'quoted text' ${HOME} then
+	${HOME} awk grep -eu 'quoted text'
+		export ${HOME} ${HOME} test grep test done
+${HOME} -eu "$1" "$1" | sed done awk ${HOME}
+		x=1 readonly echo 2>/dev/null x=1 sed $(pwd) -eu printf readonly &&
+	then printf 2>/dev/null cd readonly
+		sed awk done test test sed 2>/dev/null export
+&& then /usr/bin done -eu echo echo echo $(pwd)
+		| test && 2>/dev/null cd -eu 'quoted text' --verbose local --verbose &&
+		sed 2>/dev/null "$@" local
+	echo readonly -eu 'quoted text' x=1 "$@"
+	then "$1" echo done 2>/dev/null
+local -eu && echo test test done grep
+		sed "$@" 'quoted text' sed 2>/dev/null "$1" 'quoted text'
+	x=1 printf echo echo grep "$1" "$@" "$@" "$1" 'quoted text'
+		x=1 /usr/bin 'quoted text' printf cd ${HOME} done test x=1 'quoted text'
+test "$1" then sed --verbose ${HOME} local readonly /usr/bin export x=1
+		local && cd grep "$@" | -eu x=1 --verbose --verbose readonly
+	then 2>/dev/null test export echo awk local awk $(pwd) | 2>/dev/null done local
+		then | readonly done /usr/bin then $(pwd) ${HOME}
+then "$@" echo grep ${HOME} readonly awk /usr/bin grep local readonly
+		--verbose sed /usr/bin grep
+${HOME} | "$@" --verbose "$1" readonly readonly /usr/bin -eu awk readonly
+awk cd cd --verbose then "$1" test 'quoted text' then printf
+	"$1" export sed 'quoted text' local $(pwd) "$1" "$1" x=1 printf cd -eu grep
+	--verbose readonly grep export
+readonly sed -eu cd "$@"
+	test export x=1 sed awk ${HOME} "$@" awk x=1 2>/dev/null sed readonly $(pwd) "$1"
+	$(pwd) echo --verbose x=1 "$1" /usr/bin
+done x=1 local "$@" x=1 "$@" /usr/bin /usr/bin test 2>/dev/null
+	test grep 'quoted text' "$1" $(pwd)
+	&& done printf awk ${HOME} cd sed 2>/dev/null test "$1" "$1" | cd -eu /usr/bin
+| test "$1" ${HOME} -eu && && export test
+awk --verbose x=1 x=1 | /usr/bin
+		echo awk readonly printf -eu /usr/bin
+readonly 'quoted text' 2>/dev/null sed cd x=1 sed then
+	cd ${HOME} --verbose 2>/dev/null
+	| | test then grep awk 'quoted text'
+		x=1 'quoted text' "$@" -eu echo | echo export test -eu $(pwd)
+	--verbose $(pwd) readonly -eu | ${HOME} "$1" x=1 cd
+	/usr/bin readonly 2>/dev/null 2>/dev/null
+$(pwd) printf test --verbose awk done /usr/bin test
+	/usr/bin 2>/dev/null local export --verbose "$1"
+	/usr/bin cd printf "$1" && && awk cd printf && printf local x=1 sed "$@" done
+		| 2>/dev/null "$1" done ${HOME} -eu then echo $(pwd) cd
+		--verbose grep ${HOME} 2>/dev/null test awk export "$1" /usr/bin
+	readonly grep sed then test then local "$@"
+	awk local "$@" done ${HOME}
+		then echo -eu x=1 awk -eu $(pwd) grep && sed
+readonly export | "$@" awk export ${HOME} x=1 readonly sed -eu local --verbose
+		awk sed local printf export $(pwd) 'quoted text' 'quoted text'
+done then then 2>/dev/null -eu awk && cd
+		2>/dev/null cd export --verbose grep awk
+grep test /usr/bin | local awk echo echo 2>/dev/null grep local /usr/bin
+${HOME} cd 2>/dev/null --verbose
+		"$1" printf echo -eu --verbose
+grep local awk -eu /usr/bin "$1" awk grep export readonly local x=1 readonly
+	awk test "$1" /usr/bin readonly "$1" 'quoted text'
+		/usr/bin done /usr/bin
+	grep then "$1" -eu -eu 2>/dev/null cd $(pwd) done && x=1
+${HOME} --verbose sed grep test
+		export echo printf sed done grep echo /usr/bin printf x=1 ${HOME} sed done $(pwd)
+2>/dev/null 2>/dev/null printf | sed sed --verbose
+cd test grep export && then
+	/usr/bin $(pwd) --verbose export -eu "$1" awk ${HOME} "$@"
+	grep local $(pwd) awk 'quoted text' readonly
+		| --verbose local -eu awk /usr/bin awk grep done
+		"$@" done /usr/bin test sed 'quoted text' local done
+	$(pwd) x=1 awk -eu local 'quoted text'
+	echo printf && grep awk echo 'quoted text' printf sed | export
+		&& /usr/bin echo printf echo ${HOME} awk $(pwd) "$@" -eu /usr/bin test sed
+local echo && export | | $(pwd) --verbose printf echo awk done -eu export ${HOME}
+		test ${HOME} grep test "$1" local "$@" test export done /usr/bin | cd
+	"$@" awk 'quoted text' local grep grep "$@" export export /usr/bin
+		printf "$1" export then | "$1" echo export /usr/bin sed grep
+	"$1" 'quoted text' done local /usr/bin test 2>/dev/null awk sed readonly
+x=1 | readonly export "$1" test readonly sed --verbose 2>/dev/null -eu 'quoted text'
+	grep "$@" awk awk $(pwd) test
+	grep printf awk sed ${HOME} "$1" $(pwd) "$@" test x=1 "$@" local "$@" 'quoted text'
+	sed x=1 x=1 -eu done then $(pwd) printf x=1 awk then done done done
+test x=1 cd | grep | 2>/dev/null awk $(pwd) done "$1" export
+	"$1" grep sed cd grep export && printf "$1" && echo
+	test /usr/bin readonly local x=1 grep --verbose /usr/bin awk "$1" test grep
+--verbose 'quoted text' printf
+		'quoted text' sed | $(pwd)
+		local cd $(pwd) && 2>/dev/null done | test "$1"
+	test "$1" 2>/dev/null x=1 sed sed test printf 'quoted text'
+		-eu local "$1" done && && echo "$@"
+	test sed then awk test ${HOME} done grep "$@" 'quoted text'
+"$@" grep test cd export awk readonly -eu echo readonly
+		$(pwd) ${HOME} /usr/bin x=1 && $(pwd) /usr/bin
+	--verbose printf --verbose echo 'quoted text'
+	printf "$@" 'quoted text' x=1 local | "$@" 'quoted text' && printf ${HOME} awk &&
+echo cd ${HOME} 2>/dev/null
+'quoted text' ${HOME} x=1 ${HOME} echo readonly
+		x=1 "$@" | -eu cd /usr/bin | cd
+'quoted text' "$@" awk $(pwd)
+	test sed /usr/bin ${HOME} local "$@" local grep
+		2>/dev/null test "$@"
+local sed sed printf 'quoted text' ${HOME}
+		'quoted text' x=1 awk && done sed | x=1 readonly export done
+	awk test readonly && local
+	'quoted text' ${HOME} "$1" $(pwd) 'quoted text'
+'quoted text' -eu && echo export echo printf
+		$(pwd) export -eu && x=1
+		awk | "$@" ${HOME} sed done readonly
+--verbose $(pwd) 2>/dev/null
+		$(pwd) then printf readonly
+	awk | readonly done test 'quoted text' 'quoted text' local
+	awk /usr/bin test printf 2>/dev/null
+--verbose $(pwd) /usr/bin "$1" $(pwd) $(pwd) ${HOME} && --verbose -eu test
+	export x=1 export "$1" grep grep awk x=1 x=1
+	sed ${HOME} && | awk | readonly 2>/dev/null
+"$@" --verbose /usr/bin -eu echo 'quoted text' then /usr/bin 2>/dev/null
+-eu then x=1 ${HOME} test
+	export "$1" echo "$1" awk
+		awk awk "$@" -eu -eu "$@" export --verbose $(pwd) readonly
+| sed export 'quoted text' awk 2>/dev/null then then --verbose -eu
+$(pwd) sed then echo readonly test grep 2>/dev/null
+echo grep export && "$1" $(pwd) sed export sed printf then
+x=1 grep then "$1" $(pwd) sed "$@" $(pwd)
+'quoted text' -eu 'quoted text' local "$1" printf $(pwd) /usr/bin
+&& cd local /usr/bin 'quoted text' local --verbose x=1 export "$1" printf
+-eu /usr/bin "$@" 'quoted text' grep readonly | --verbose echo x=1 export
+| /usr/bin test cd done done 'quoted text' local && x=1 "$@" /usr/bin sed
+		'quoted text' awk sed grep done --verbose "$@" done export "$1" cd
+	'quoted text' 'quoted text'
+		--verbose $(pwd) readonly 2>/dev/null
+| local $(pwd) "$1" "$@" x=1 && sed | && export
+"$@" readonly echo /usr/bin 2>/dev/null grep $(pwd) 'quoted text'
+	x=1 awk printf cd x=1
+-eu echo "$1" cd | /usr/bin
+cd echo "$@" -eu 'quoted text' ${HOME} /usr/bin
+$(pwd) "$@" | 'quoted text' 2>/dev/null awk -eu "$1" cd --verbose &&
+then 2>/dev/null ${HOME} "$@" "$1" then local && 2>/dev/null
+sed ${HOME} "$@" --verbose --verbose printf 'quoted text' export export done
+local sed echo echo sed -eu && 2>/dev/null
+	--verbose "$@" echo echo export
+	local && readonly sed "$@" sed "$1"
+		then 'quoted text' x=1 awk && echo echo grep $(pwd) export ${HOME} sed 'quoted text'
+	"$@" then printf x=1 sed local
+-eu $(pwd) 2>/dev/null export readonly "$@" grep 'quoted text' $(pwd) x=1 ${HOME}
+grep /usr/bin local sed done local
+		/usr/bin export echo ${HOME} grep then 2>/dev/null | local $(pwd)
+		x=1 echo && --verbose && done grep export -eu $(pwd) sed --verbose
+'quoted text' 'quoted text'
+		then awk "$@" x=1 export
+		"$1" awk export ${HOME}
+		--verbose ${HOME} awk "$1" done -eu -eu done ${HOME} grep
+	/usr/bin echo test "$1"
+	sed 'quoted text' x=1 "$@" && local sed | done
+		then cd export printf ${HOME} 2>/dev/null cd 'quoted text'
+--verbose done "$@" /usr/bin export export local --verbose "$@"
+	awk export "$1" grep local echo sed "$@" test "$1" --verbose sed --verbose
+	echo ${HOME} /usr/bin grep then then "$1" /usr/bin
+export --verbose done export "$@" sed 'quoted text' "$@"
+		local $(pwd) awk ${HOME} ${HOME} && local 2>/dev/null
+--verbose 'quoted text' x=1 --verbose && test sed echo && cd --verbose export
+	echo "$1" x=1 ${HOME} test echo local
+"$1" | "$@" echo -eu "$1" local readonly echo -eu test 'quoted text' done
+		local test -eu 'quoted text' readonly "$1" awk
+	| | x=1 cd cd export local readonly
+	x=1 -eu printf $(pwd) cd $(pwd) "$1"
+local readonly 'quoted text'
+	"$1" -eu then 'quoted text' cd
+/usr/bin readonly cd && awk -eu awk awk /usr/bin
+	"$1" test local readonly
+"$1" x=1 ${HOME} echo readonly export | x=1 --verbose then export done
+		2>/dev/null local done /usr/bin echo export 'quoted text'
+--verbose readonly readonly local echo ${HOME} echo test |
+"$1" -eu 2>/dev/null cd then ${HOME}
+		grep && sed awk done -eu /usr/bin 'quoted text' grep awk /usr/bin
+| cd then readonly then
+		awk "$1" ${HOME} 2>/dev/null
+local x=1 sed sed done "$1" cd
+&& $(pwd) then $(pwd) -eu /usr/bin
+	x=1 $(pwd) sed sed then $(pwd) awk ${HOME} $(pwd) then cd -eu grep
+	x=1 /usr/bin /usr/bin sed export test x=1 2>/dev/null sed
+'quoted text' export printf -eu $(pwd) echo cd
+		&& "$1" -eu x=1 "$1" echo cd done readonly awk export local 'quoted text'
+	"$@" --verbose "$1" --verbose
+		2>/dev/null --verbose && sed -eu awk 2>/dev/null 'quoted text' sed "$1"
+		done echo sed cd local
+"$1" cd then sed -eu printf /usr/bin local printf awk "$1" ${HOME} 2>/dev/null
+-eu -eu "$@" ${HOME} sed readonly ${HOME} grep sed sed printf 2>/dev/null export
+"$@" then printf echo "$@"
+	then awk sed 'quoted text' "$1" "$1" awk /usr/bin
+then "$@" then sed done grep readonly
+sed test && 2>/dev/null grep
+sed printf grep x=1 "$@" "$1" 2>/dev/null /usr/bin
+	done readonly local /usr/bin awk test "$@" readonly x=1 -eu "$@" local local "$1"
+	test /usr/bin local |
+	/usr/bin echo && local 2>/dev/null x=1 x=1 printf printf readonly /usr/bin
+	done "$1" local readonly done $(pwd) $(pwd) x=1
+2>/dev/null readonly 2>/dev/null ${HOME} grep test export cd sed then
+		'quoted text' "$@" then "$@" --verbose /usr/bin then "$1" $(pwd) cd printf
+		sed ${HOME} done export "$1" /usr/bin 2>/dev/null
+	| cd -eu done readonly
+| /usr/bin cd local --verbose
+| local readonly /usr/bin local | "$1" then x=1 x=1
+		sed && local 2>/dev/null $(pwd) --verbose grep /usr/bin --verbose
+	sed $(pwd) local awk export 'quoted text'
+'quoted text' export local -eu $(pwd) -eu echo awk x=1 export $(pwd) /usr/bin
+	&& | ${HOME} printf echo -eu readonly "$1" -eu echo /usr/bin cd x=1 printf
+	"$1" "$@" grep "$@" grep local ${HOME}
+	test && export grep /usr/bin then awk x=1
+"$1" /usr/bin ${HOME} 2>/dev/null
+done echo echo test readonly sed 2>/dev/null -eu done 'quoted text'
+then -eu grep -eu sed awk grep | | /usr/bin /usr/bin
+grep echo grep $(pwd) local | | grep
+		2>/dev/null printf done printf printf then ${HOME} readonly 2>/dev/null
+	&& ${HOME} export "$@" "$@" "$1" done ${HOME} && grep then 'quoted text'
+	'quoted text' cd readonly -eu "$1" sed then && test
+"$@" then grep cd && | local $(pwd)
+-eu done -eu ${HOME} 2>/dev/null awk sed $(pwd)
+		readonly grep printf test 2>/dev/null -eu 'quoted text'
+		done $(pwd) awk readonly "$@" && test 2>/dev/null readonly
+--verbose ${HOME} --verbose "$1" readonly awk export readonly printf done
+	echo "$@" && $(pwd) export echo x=1 "$1" echo
+	export echo then -eu local then -eu then | then then && then grep
+		'quoted text' cd 2>/dev/null then x=1 ${HOME} /usr/bin cd readonly export local
+		grep && awk then x=1 $(pwd) awk
+	-eu 2>/dev/null test -eu done done --verbose
+	then /usr/bin $(pwd) && ${HOME} && && --verbose sed "$1"
+	printf sed | $(pwd) test
+${HOME} 2>/dev/null printf printf --verbose
+		readonly $(pwd) printf 'quoted text' readonly echo "$@"
+		export /usr/bin 'quoted text' sed && 2>/dev/null "$1" 'quoted text'
+		printf --verbose "$@" grep then 2>/dev/null 'quoted text'
+		"$1" readonly && && done cd echo done readonly x=1 grep
+		--verbose export 2>/dev/null echo sed cd grep readonly printf /usr/bin "$1"
+"$@" | /usr/bin grep -eu then cd done 'quoted text'
+done 'quoted text' -eu sed test -eu grep "$1" -eu -eu awk
+x=1 done grep then x=1 x=1 export ${HOME} test 'quoted text' cd && $(pwd) printf
+	'quoted text' -eu grep export "$1" echo | echo ${HOME} 'quoted text' done
+	sed -eu -eu $(pwd) /usr/bin awk export export then awk local "$1" $(pwd)
+		done cd local --verbose grep sed export
+${HOME} test 2>/dev/null "$1" awk then echo --verbose
+		echo x=1 then readonly /usr/bin then "$1"
+sed awk 'quoted text' echo
+"$1" 2>/dev/null echo readonly 2>/dev/null $(pwd) 'quoted text' cd "$@" local
+	echo test grep -eu sed 'quoted text' 2>/dev/null then test then
+		sed -eu $(pwd) --verbose export --verbose x=1 grep
+		grep $(pwd) awk readonly printf -eu awk --verbose done $(pwd) cd
+		printf export done awk test --verbose cd ${HOME} grep -eu local export --verbose
+| then 'quoted text' echo "$1" printf && "$@" 2>/dev/null then
+	2>/dev/null "$@" "$@" "$@" grep -eu 2>/dev/null printf "$1" ${HOME}
+export awk grep awk printf "$@" test then $(pwd) && -eu awk then "$@" x=1
+		sed 2>/dev/null -eu export then done $(pwd) then
+		-eu && readonly | | $(pwd) done export export echo
+	done local "$1" done grep /usr/bin local grep test cd test $(pwd) local | cd --verbose
+		$(pwd) 'quoted text' --verbose done cd && done printf
+	$(pwd) echo 'quoted text' 'quoted text' echo then export cd 'quoted text'
+		$(pwd) printf printf done
+		grep local --verbose -eu x=1 then
+local grep ${HOME} 'quoted text' "$1" done then cd "$@" $(pwd)
+		$(pwd) 2>/dev/null 2>/dev/null sed -eu -eu
+		cd $(pwd) ${HOME} $(pwd) x=1 "$1" then "$@" ${HOME} "$@" 2>/dev/null
+	$(pwd) /usr/bin cd then export "$1" echo done /usr/bin
+cd -eu 2>/dev/null -eu x=1 x=1 --verbose awk printf
+| ${HOME} grep 'quoted text'
+		'quoted text' printf 'quoted text' x=1 test echo "$@" local 2>/dev/null printf
+	local done grep | $(pwd) /usr/bin && -eu ${HOME}
+"$@" | cd 2>/dev/null --verbose readonly /usr/bin -eu --verbose then
+		$(pwd) grep $(pwd) ${HOME} sed /usr/bin ${HOME} x=1 grep sed 2>/dev/null
+	printf 'quoted text' done ${HOME} | readonly readonly "$1" /usr/bin ${HOME} local
+	printf -eu | readonly
+grep ${HOME} "$1" printf
+| then then sed local /usr/bin
+		sed echo printf done printf export --verbose "$1" | readonly 2>/dev/null
+	then done then 2>/dev/null local /usr/bin export cd --verbose
+"$@" local echo then "$1" -eu cd readonly x=1 export export local x=1
+	printf 2>/dev/null local awk test | printf $(pwd) cd ${HOME} "$1" echo
+readonly $(pwd) echo awk | | echo "$1" cd then export &&
+		${HOME} local done "$@" "$1" x=1 -eu printf /usr/bin
+done cd grep then test local /usr/bin readonly local cd 2>/dev/null
+		${HOME} local | printf awk
+		${HOME} "$1" sed ${HOME} readonly | --verbose
+readonly --verbose echo grep | --verbose local local /usr/bin
+awk | "$@" readonly test "$@" && && readonly echo sed && 'quoted text' &&
+	"$@" sed x=1 sed awk -eu /usr/bin /usr/bin
+	sed echo /usr/bin $(pwd) /usr/bin grep echo | done
+/usr/bin printf cd && done && ${HOME} sed ${HOME} printf then && printf
+		-eu cd cd 'quoted text' grep $(pwd) "$1" --verbose
+grep local done awk ${HOME}
+	${HOME} ${HOME} 'quoted text' "$@" /usr/bin cd /usr/bin 'quoted text'
+x=1 readonly cd grep readonly
+cd echo export awk "$@" echo
+echo awk echo echo cd /usr/bin x=1 'quoted text' readonly ${HOME}
+		${HOME} readonly test --verbose | local
+printf readonly export cd
+		grep echo then test ${HOME} "$1" $(pwd) cd test $(pwd) echo
+	"$@" test $(pwd) --verbose readonly
+	$(pwd) echo ${HOME} readonly ${HOME} echo "$1" x=1 test -eu ${HOME}
+	sed x=1 --verbose then echo printf sed && echo readonly then --verbose ${HOME}
+	cd "$1" done | grep cd sed sed 2>/dev/null x=1 test "$1" done
+	local readonly "$1" then
+x=1 "$@" readonly 2>/dev/null x=1 && readonly ${HOME} done | "$1" readonly
+		${HOME} grep echo && then "$@" readonly
+		&& "$@" then ${HOME} --verbose readonly
+		-eu 2>/dev/null awk printf ${HOME} x=1 x=1 printf then $(pwd) | $(pwd)
+	cd $(pwd) echo 2>/dev/null ${HOME} x=1 echo
+	done cd awk "$@" ${HOME} awk grep local 'quoted text' "$@" export cd $(pwd) x=1
+	"$@" local -eu export -eu done readonly /usr/bin
+	-eu && test done sed -eu readonly printf $(pwd) $(pwd) "$1" local printf
+export test echo then printf
+"$@" $(pwd) done test --verbose 'quoted text' ${HOME}
+		echo export sed -eu awk "$@"
+		| readonly awk done "$1" /usr/bin
+	cd printf 'quoted text' cd printf printf awk sed
+-eu 'quoted text' cd printf grep echo x=1 | readonly && done readonly
+		test | done cd export | local echo ${HOME} test x=1 --verbose --verbose && 'quoted text'
+$(pwd) 'quoted text' local readonly
+		sed test cd local test echo 'quoted text' export ${HOME} "$1" ${HOME} | export test
+	printf echo "$1" "$@" awk "$1"
+	sed "$@" done printf 'quoted text'
+		done && test export printf | sed readonly
+		then "$1" -eu | cd readonly printf -eu cd readonly cd 2>/dev/null | cd x=1 | test
+	awk --verbose awk --verbose
+/usr/bin --verbose then cd 'quoted text' cd $(pwd) grep readonly ${HOME} printf
+echo grep readonly && done then $(pwd)
+--verbose /usr/bin ${HOME} "$@" sed && sed readonly
+		test readonly $(pwd) /usr/bin | echo $(pwd) sed awk ${HOME} done
+		--verbose -eu x=1 /usr/bin "$@" local ${HOME} then export readonly
+grep -eu grep awk then grep -eu export echo x=1 'quoted text'
+awk /usr/bin printf $(pwd) cd then echo export readonly && grep done "$1" readonly
+		'quoted text' readonly local readonly readonly /usr/bin echo echo export
+		sed 'quoted text' x=1 x=1
+	export | -eu x=1 awk
+		export --verbose "$1" 'quoted text'
+	&& done "$@" | ${HOME} && /usr/bin grep printf 'quoted text'
+	"$1" ${HOME} sed && | && "$@" done cd awk printf "$@" then 2>/dev/null x=1
+		&& -eu 'quoted text' readonly echo then "$@" then x=1 x=1 "$1" printf ${HOME}
+sed awk done "$1" --verbose -eu 2>/dev/null local readonly -eu export && 2>/dev/null
+		${HOME} grep printf then | grep ${HOME} test cd awk
+	done /usr/bin /usr/bin test && export printf printf "$1" awk -eu | | echo "$@"
+		done | export | "$1" $(pwd) test printf $(pwd) | | grep printf 2>/dev/null "$@"
+		&& | | -eu /usr/bin sed local -eu local then x=1 --verbose
+		| x=1 grep /usr/bin ${HOME} | local done test 'quoted text'
+	-eu "$1" printf | ${HOME} -eu && grep export grep printf cd && /usr/bin 2>/dev/null
+awk sed readonly cd "$1" test done export "$1" | printf awk test
+	-eu "$1" $(pwd) $(pwd) readonly ${HOME} && export
+x=1 printf done ${HOME} grep export x=1 "$1" awk
+/usr/bin cd cd readonly 2>/dev/null
+		"$@" | 'quoted text' printf echo export
+/usr/bin | grep "$1" && cd /usr/bin -eu 'quoted text'
+	cd cd $(pwd) sed && ${HOME} cd -eu 2>/dev/null
+		"$@" /usr/bin ${HOME} |
+		then sed test 2>/dev/null
+		awk awk $(pwd) sed /usr/bin awk && "$@"
+		sed cd ${HOME} x=1 awk cd printf "$@" "$1" && "$1" echo grep | done x=1
+/usr/bin test echo 'quoted text' && | test export
+local printf 2>/dev/null -eu -eu local then sed 2>/dev/null
+	-eu awk ${HOME} echo x=1 --verbose "$1" /usr/bin "$@" /usr/bin 'quoted text' /usr/bin
+then local 'quoted text' 2>/dev/null $(pwd) test test then
+${HOME} cd sed | echo awk "$@" echo cd readonly 'quoted text'
+	sed ${HOME} && --verbose
+		&& grep | local export --verbose printf "$@" | echo
+readonly echo grep | ${HOME} awk "$@" sed local cd x=1
+		x=1 "$@" echo then /usr/bin && awk --verbose
+		'quoted text' local echo then -eu echo 2>/dev/null awk
+	local "$1" && && ${HOME} | printf done --verbose
+	/usr/bin export grep --verbose cd x=1 then test $(pwd)
+--verbose /usr/bin echo echo sed echo grep readonly x=1 "$@" x=1 /usr/bin awk
+-eu -eu sed done printf $(pwd) --verbose readonly /usr/bin
+awk then grep "$1" test done sed export ${HOME} ${HOME}
+awk "$@" 'quoted text' cd sed 2>/dev/null
+	test /usr/bin /usr/bin echo local printf echo then awk readonly
+		$(pwd) awk printf sed x=1 local --verbose awk printf --verbose 2>/dev/null
+done /usr/bin "$1" ${HOME} awk --verbose --verbose sed
+test 'quoted text' --verbose readonly done done "$1" cd sed test done
+		--verbose export x=1 --verbose ${HOME} x=1 x=1 done
+test 'quoted text' | sed test 'quoted text' 'quoted text' 'quoted text'
+		then && 'quoted text' then sed 'quoted text' | -eu "$1" local
+awk /usr/bin printf /usr/bin "$@" 'quoted text'
+	--verbose "$@" awk printf cd "$1" echo test "$@" awk x=1
+2>/dev/null printf printf then readonly grep $(pwd)
+		'quoted text' done then echo 2>/dev/null local 2>/dev/null
+		| echo $(pwd) grep grep then readonly && -eu readonly
+	"$@" $(pwd) echo "$1" grep printf 2>/dev/null | echo echo cd then $(pwd)
+		"$1" "$1" echo 'quoted text' done x=1 echo done 'quoted text' "$1" printf
+local && test $(pwd) readonly --verbose printf
+-eu 'quoted text' "$1" sed && 2>/dev/null awk then --verbose
+		local readonly 2>/dev/null /usr/bin | cd then x=1 printf /usr/bin printf
+--verbose cd | export grep 2>/dev/null sed 'quoted text' printf local
+	sed done | /usr/bin --verbose
+		--verbose then done sed ${HOME} ${HOME} printf echo 2>/dev/null | export $(pwd)
+		cd cd --verbose then $(pwd)
+'quoted text' "$@" x=1 "$@" then local x=1 ${HOME} "$1" printf --verbose ${HOME}
+		"$1" ${HOME} 2>/dev/null local done cd local grep local done echo printf grep
+		'quoted text' | x=1 awk echo -eu echo "$1" echo sed /usr/bin grep -eu x=1 &&
+	grep cd 2>/dev/null 'quoted text'
+	local /usr/bin local -eu
+		local local local x=1 && 2>/dev/null ${HOME} /usr/bin
+--verbose sed $(pwd) 'quoted text'
+		'quoted text' printf grep grep 2>/dev/null awk $(pwd) readonly
+		then printf x=1 ${HOME} "$@"
+2>/dev/null x=1 $(pwd) cd $(pwd) cd readonly local $(pwd) printf $(pwd) done
+"$1" ${HOME} x=1 --verbose
+test --verbose $(pwd) local /usr/bin then
+export cd && readonly test && ${HOME} echo done | 2>/dev/null readonly test
+	| "$1" sed readonly done export then -eu
+	"$@" $(pwd) | x=1 2>/dev/null export "$1" -eu echo echo ${HOME} then
+	grep printf | awk "$1" local done 2>/dev/null ${HOME}
+		"$1" test echo local cd echo 'quoted text' -eu then sed then x=1 ${HOME}
+		&& export echo "$@" export && -eu && $(pwd) 2>/dev/null readonly
+	readonly $(pwd) done $(pwd) done then | local
+'quoted text' /usr/bin awk local
+'quoted text' "$@" "$@" grep local test x=1 /usr/bin x=1 test &&
+	/usr/bin readonly && --verbose 2>/dev/null -eu ${HOME} -eu /usr/bin
+		done "$@" readonly sed export
+	awk sed sed /usr/bin
+		test ${HOME} done export && printf
+		${HOME} done sed cd then | /usr/bin
+	printf --verbose $(pwd) test -eu "$1" ${HOME} ${HOME} printf 2>/dev/null
+"$1" test cd 'quoted text' echo
+	done "$@" x=1 "$@" grep then "$@" echo --verbose
+		"$@" ${HOME} /usr/bin
+2>/dev/null then local test "$@"
+${HOME} && && grep test readonly
+	'quoted text' echo echo readonly readonly
+${HOME} readonly ${HOME}
+-eu && && "$@" then awk done cd -eu $(pwd) x=1 done local /usr/bin
+	sed done $(pwd) | readonly cd local local export awk $(pwd) echo
+		2>/dev/null "$1" /usr/bin ${HOME} $(pwd) export "$@" "$1" local done
+| ${HOME} x=1 'quoted text' printf echo $(pwd) then $(pwd) "$1" x=1 | -eu echo cd
+	| 'quoted text' awk readonly readonly $(pwd) --verbose then && cd ${HOME} done
+readonly then -eu x=1 done "$1" "$@" -eu "$@" x=1 "$1" "$@" cd export
+	2>/dev/null sed ${HOME} x=1 grep then --verbose awk
+		printf && 2>/dev/null done /usr/bin $(pwd) awk export
+		2>/dev/null x=1 'quoted text'
+		then ${HOME} test /usr/bin ${HOME} awk -eu sed sed printf | && echo done
+-eu "$@" echo echo grep x=1 'quoted text'
+${HOME} readonly "$1" readonly "$1" local echo "$@"
+x=1 x=1 then export echo test $(pwd) /usr/bin cd /usr/bin local /usr/bin
+		${HOME} done export grep $(pwd) readonly cd sed --verbose "$1" 2>/dev/null
+printf cd x=1 ${HOME} x=1 local readonly 2>/dev/null readonly 2>/dev/null test
+		test then readonly $(pwd) readonly printf done readonly -eu
+	awk -eu printf /usr/bin readonly export /usr/bin | then sed ${HOME} local export
+then echo grep grep awk && /usr/bin --verbose 'quoted text'
+awk "$@" cd echo /usr/bin 2>/dev/null done ${HOME}
+		then printf x=1 awk 2>/dev/null local cd cd ${HOME} --verbose
+		grep done 'quoted text' /usr/bin "$@" $(pwd) "$@" local
+		grep ${HOME} /usr/bin -eu
+	$(pwd) 'quoted text' 'quoted text' sed then &&
+"$1" "$1" 2>/dev/null x=1 'quoted text' sed readonly then
+	sed awk /usr/bin readonly 'quoted text' 'quoted text' cd sed /usr/bin
+	local --verbose ${HOME} 'quoted text'
+export "$@" printf export 2>/dev/null 'quoted text' --verbose local 2>/dev/null
+	2>/dev/null readonly x=1 export | done
+	sed done printf && printf echo ${HOME} /usr/bin grep /usr/bin
+		local "$1" -eu 'quoted text' awk export
+'quoted text' local x=1 grep export x=1 --verbose cd $(pwd) awk ${HOME}
+	'quoted text' readonly --verbose 'quoted text'
+	'quoted text' ${HOME} done
+grep echo --verbose -eu x=1 done && sed readonly 2>/dev/null -eu export
+	--verbose done grep x=1 then
+		sed echo test echo 'quoted text' readonly $(pwd) 'quoted text'
+awk /usr/bin "$@" 'quoted text' readonly local
+readonly --verbose readonly grep $(pwd) awk readonly | $(pwd) sed
+"$@" --verbose "$1" grep 2>/dev/null done "$@" --verbose -eu 2>/dev/null /usr/bin
+readonly "$1" x=1 echo cd cd grep 'quoted text'
+	test && x=1 readonly then -eu grep -eu echo echo readonly
+	-eu "$1" --verbose awk ${HOME} awk grep "$1" printf --verbose "$@" --verbose
+x=1 ${HOME} "$1" 'quoted text' x=1 sed local ${HOME}
+	${HOME} 'quoted text' "$@" | test 'quoted text' awk export then export
+		"$1" echo --verbose ${HOME} sed grep export ${HOME} echo
+	--verbose grep export | /usr/bin /usr/bin awk echo echo readonly && 2>/dev/null
+'quoted text' local local done "$1" test test then x=1
+	local | -eu test 2>/dev/null "$@" $(pwd) cd "$@"
+/usr/bin sed local done x=1 export x=1 $(pwd) && | ${HOME} echo "$1" $(pwd) readonly
+		readonly awk 2>/dev/null local then sed test "$@" export sed
+${HOME} "$1" grep x=1 grep sed -eu test --verbose && cd sed
+		&& readonly 2>/dev/null test export 2>/dev/null -eu -eu
+		export export ${HOME} /usr/bin grep | -eu /usr/bin cd --verbose
+		cd x=1 done printf echo /usr/bin ${HOME} sed done grep cd then 2>/dev/null
+echo grep 2>/dev/null grep local 2>/dev/null done | 'quoted text'
+readonly then 2>/dev/null sed awk export | echo sed echo printf sed
+	sed 'quoted text' 'quoted text' ${HOME} x=1 done
+	then 'quoted text' sed x=1 done grep echo 2>/dev/null
+	local && cd 2>/dev/null cd grep 'quoted text'
+	"$1" grep export then
+	test 'quoted text' grep printf --verbose
+	"$1" $(pwd) awk $(pwd) test sed -eu awk grep printf --verbose
+		cd $(pwd) /usr/bin test done
+		$(pwd) $(pwd) --verbose awk echo done $(pwd) echo
+	then sed | cd && echo "$1" && grep 2>/dev/null && awk then /usr/bin
+	printf $(pwd) /usr/bin awk $(pwd) export echo && | -eu cd 2>/dev/null $(pwd)
+		"$1" readonly readonly ${HOME} echo test awk
+		"$1" "$1" 2>/dev/null readonly sed then ${HOME} --verbose
+readonly --verbose $(pwd) 'quoted text'
+then $(pwd) then "$@" -eu readonly export then
+	grep "$1" local then 'quoted text' $(pwd) -eu | "$1" "$@" -eu
+	2>/dev/null test 2>/dev/null local printf &&
+printf $(pwd) 'quoted text'
+export local "$1" done | export "$@" readonly then "$@" "$1" local
+	$(pwd) local readonly 2>/dev/null
+"$@" /usr/bin local 2>/dev/null
+&& readonly 2>/dev/null
+$(pwd) readonly awk ${HOME} $(pwd) cd 'quoted text'
+	&& sed export echo grep --verbose "$@" sed --verbose then
+x=1 export local printf 2>/dev/null x=1 2>/dev/null x=1 awk then "$1" ${HOME} grep
+		&& -eu test grep printf echo x=1 x=1 sed done --verbose printf done 'quoted text'
+	printf cd sed 'quoted text' export export x=1 'quoted text'
+		$(pwd) -eu | cd x=1 /usr/bin local
+	| readonly then 'quoted text'
+		--verbose x=1 "$1" ${HOME} echo
+	2>/dev/null $(pwd) ${HOME} 'quoted text' 'quoted text'
+	readonly | done x=1 cd /usr/bin cd done sed
+2>/dev/null --verbose local "$@" ${HOME} -eu
+		| "$1" done printf $(pwd) 2>/dev/null | "$@" test /usr/bin export readonly
+grep | 'quoted text' --verbose x=1 -eu echo
+		printf $(pwd) "$1" printf printf 2>/dev/null
+	x=1 done && cd echo x=1 export -eu grep test $(pwd) -eu -eu test ${HOME} "$@"
+grep --verbose cd /usr/bin x=1 printf 'quoted text'
+awk | x=1 $(pwd) "$@" then awk
+		--verbose readonly $(pwd) done $(pwd) awk export readonly "$@"
+local sed "$@" --verbose /usr/bin ${HOME} "$1" echo 'quoted text' awk
+grep awk && export local echo done readonly done cd readonly -eu grep sed done
+"$@" export sed 2>/dev/null --verbose grep x=1 test export $(pwd) local $(pwd)
+		echo sed echo sed && -eu 2>/dev/null "$@" cd x=1 2>/dev/null echo --verbose
+--verbose x=1 sed | "$1" grep
+--verbose echo | local 'quoted text' readonly awk sed export export grep
+-eu --verbose grep awk | then readonly $(pwd) &&
+		readonly printf | && local
+		done awk 2>/dev/null export then 2>/dev/null
+	2>/dev/null | awk ${HOME} then 'quoted text' local && /usr/bin
+"$1" readonly --verbose test cd -eu done awk
+		"$@" local test sed awk echo "$@"
+		cd echo $(pwd) "$1" grep x=1 | 2>/dev/null
+readonly ${HOME} ${HOME} printf local x=1 awk grep sed --verbose
+	readonly export printf --verbose local -eu export
+	echo echo test x=1 local
+	--verbose ${HOME} grep "$1" cd -eu -eu printf /usr/bin done && 2>/dev/null
+	2>/dev/null test grep 'quoted text'
+	sed $(pwd) grep 2>/dev/null test grep | then "$1" awk -eu grep ${HOME} awk
+		x=1 cd /usr/bin /usr/bin local
+	sed "$@" x=1 "$1" "$@" 'quoted text' local --verbose
+		| $(pwd) x=1 readonly grep "$@" cd $(pwd) 2>/dev/null readonly readonly --verbose
+x=1 readonly grep -eu 2>/dev/null | printf 2>/dev/null printf 2>/dev/null
+	then -eu /usr/bin then cd readonly
+		| ${HOME} then grep -eu /usr/bin | -eu "$1" test done 'quoted text'
+		echo ${HOME} readonly printf sed "$@" done cd /usr/bin done printf
+| sed $(pwd) done test --verbose $(pwd) done printf
+	cd done then /usr/bin ${HOME} awk test readonly
+		"$@" printf sed --verbose 'quoted text' --verbose export cd "$1" readonly "$@" ${HOME}
+		printf sed $(pwd) export done --verbose x=1 $(pwd) | ${HOME} awk echo "$@"
+&& $(pwd) readonly sed /usr/bin then export ${HOME} then x=1 awk ${HOME}
+"$1" "$@" -eu then printf $(pwd) && done "$@" then && 2>/dev/null &&
+&& local cd export --verbose
+	${HOME} -eu test readonly
+	printf export -eu "$1" 2>/dev/null 'quoted text' ${HOME} -eu | printf "$1" sed
+	cd "$1" && "$@" grep 'quoted text'
+	2>/dev/null -eu /usr/bin local "$@" x=1 awk done
+		"$@" echo --verbose 'quoted text' /usr/bin test done "$@" /usr/bin
+'quoted text' 2>/dev/null printf cd readonly
+	then 'quoted text' done --verbose | done | awk "$@" $(pwd)
+awk | local cd | sed cd &&
+		echo $(pwd) done -eu cd "$@" $(pwd) --verbose 'quoted text' grep readonly awk
+2>/dev/null cd test done | then printf
+'quoted text' export | echo echo 'quoted text' then
+$(pwd) ${HOME} "$1" ${HOME} cd "$@" echo | | x=1 local awk
+	"$@" && && echo printf then -eu echo ${HOME} done grep readonly
+		grep cd echo ${HOME} --verbose 2>/dev/null 'quoted text' 2>/dev/null done
+	printf x=1 | | "$@" --verbose "$@" grep $(pwd) awk |
+	printf printf printf "$@" export "$1" | export grep "$@"
+then then && 2>/dev/null 'quoted text' $(pwd) done printf printf "$1"
+	--verbose sed printf sed
+	/usr/bin then echo -eu "$@"
+	echo echo $(pwd) 2>/dev/null echo && "$@" cd export
+&& 2>/dev/null 2>/dev/null /usr/bin
+	done | 2>/dev/null then $(pwd) grep | sed | -eu test sed printf printf
+	'quoted text' grep 'quoted text' 'quoted text'
+	echo --verbose /usr/bin local x=1 readonly ${HOME}
+cd $(pwd) --verbose printf test x=1 done local sed test "$1" cd export awk done
+--verbose ${HOME} x=1 /usr/bin
+		2>/dev/null export then && "$1" test ${HOME} sed 'quoted text' 'quoted text'
+		-eu sed ${HOME} x=1 && "$@" --verbose printf "$1" ${HOME} && ${HOME}
+	&& export export then readonly test && readonly cd
+		printf export cd export --verbose grep local readonly awk echo cd x=1
+awk && awk "$@" sed ${HOME} cd done
+		readonly 2>/dev/null 'quoted text' printf | ${HOME}
+	'quoted text' awk && printf "$1" x=1 test
+	cd then echo | awk test then cd /usr/bin
+printf readonly done awk "$1" local echo echo done readonly 'quoted text'
+	cd done x=1 done -eu test cd "$@" echo 'quoted text'
+	readonly done done export printf sed "$1" test done x=1 "$@" -eu 2>/dev/null printf
+local | x=1 ${HOME} /usr/bin sed $(pwd)
+		$(pwd) sed done && cd x=1 export printf cd --verbose grep
+${HOME} grep done readonly x=1 "$@" export test
+	${HOME} printf "$1" then "$1" | -eu "$@" /usr/bin test sed -eu
+cd printf test && export local readonly then ${HOME} && /usr/bin then done
+awk -eu cd --verbose $(pwd) x=1 then sed awk $(pwd) ${HOME} && sed
+&& | readonly 'quoted text' grep local
+		/usr/bin echo echo grep /usr/bin then cd cd $(pwd) /usr/bin 2>/dev/null --verbose
+| 2>/dev/null 'quoted text' 'quoted text' grep
+	2>/dev/null --verbose local cd
+-eu "$1" x=1 "$1" done --verbose test "$@" "$1" "$@" export grep
+	--verbose --verbose "$1" | sed printf -eu "$@" test
+		readonly export readonly 'quoted text'
+2>/dev/null awk && "$@" readonly "$@" done cd x=1 local done 2>/dev/null
+&& | sed grep printf /usr/bin --verbose "$1"
+		&& --verbose printf --verbose sed printf test 2>/dev/null local "$@" echo
+	then ${HOME} "$1" awk "$@" -eu readonly sed ${HOME} echo
+	$(pwd) | x=1 sed -eu local 2>/dev/null export "$@" grep && printf && --verbose
+		x=1 printf 'quoted text' /usr/bin done &&
+	2>/dev/null --verbose test -eu --verbose 2>/dev/null cd --verbose done
+grep ${HOME} then printf $(pwd) ${HOME} ${HOME} echo /usr/bin
+		cd then "$@" printf readonly --verbose echo cd -eu
+'quoted text' ${HOME} echo grep | 'quoted text'
+	x=1 local done grep | 'quoted text' "$@" sed "$@" sed done then "$1" export "$1"
+	${HOME} ${HOME} readonly grep printf --verbose && x=1
+		--verbose "$@" printf &&
+		sed --verbose 'quoted text' export -eu cd awk $(pwd)
+		sed test 2>/dev/null 'quoted text' test ${HOME}
+	"$@" awk echo cd local local local | export /usr/bin "$1" done test 'quoted text'
+	grep export "$@" export cd then $(pwd) --verbose printf done
+awk && -eu awk test ${HOME} | x=1 local
+export x=1 test local sed then 'quoted text' "$@" awk local export sed
+		"$1" | $(pwd) 2>/dev/null /usr/bin -eu sed -eu --verbose x=1 ${HOME}
+		sed x=1 ${HOME} 2>/dev/null readonly 'quoted text' echo --verbose
+	$(pwd) 'quoted text' 2>/dev/null then 2>/dev/null export --verbose
+		awk | local -eu /usr/bin x=1 "$@" "$@"
+	awk x=1 'quoted text' 2>/dev/null cd local
+$(pwd) "$1" 2>/dev/null grep printf | $(pwd) "$1"
+echo | readonly 2>/dev/null printf cd export sed then sed "$@"
+		/usr/bin ${HOME} echo test $(pwd) grep "$@" 2>/dev/null
+echo ${HOME} --verbose cd readonly
+	/usr/bin echo /usr/bin
+${HOME} export local x=1 readonly
+	done local 'quoted text' sed x=1
+		grep awk sed awk $(pwd) $(pwd) done ${HOME} cd && echo ${HOME}
+'quoted text' test 'quoted text' /usr/bin | grep echo && local
+done awk && | grep export sed && echo export 'quoted text'
+	done --verbose x=1 --verbose "$1" local
+		grep export /usr/bin "$@" readonly /usr/bin local $(pwd) readonly then test /usr/bin
+export awk && done sed sed sed readonly $(pwd)
+		"$@" readonly && 'quoted text'
+		cd printf "$@" /usr/bin --verbose grep 2>/dev/null then local done
+--verbose printf "$1" /usr/bin test x=1 x=1 /usr/bin x=1 awk sed && test
+	| test echo && local "$1" printf
+	2>/dev/null test awk "$1" 'quoted text' --verbose --verbose
+		awk "$@" "$@" /usr/bin grep then awk 2>/dev/null $(pwd) sed
+&& "$1" sed export && /usr/bin --verbose "$1" grep /usr/bin
+		$(pwd) 'quoted text' --verbose then then then awk echo sed
+"$@" -eu -eu done $(pwd) cd "$1" 'quoted text'
+		echo | 2>/dev/null && echo cd $(pwd) test "$1" export $(pwd) -eu echo cd /usr/bin
+--verbose "$1" $(pwd)
+	/usr/bin /usr/bin grep "$1" readonly
+readonly grep 2>/dev/null -eu echo awk -eu printf cd then x=1 cd
+	local "$1" -eu sed /usr/bin --verbose 'quoted text' /usr/bin cd
+		awk x=1 readonly then test ${HOME} export
+	done && --verbose -eu test then cd export
+done "$@" local | printf ${HOME} printf
+		echo sed ${HOME} 'quoted text'
+		test local "$@" done x=1 $(pwd)
+"$@" && -eu done | && 2>/dev/null
+		2>/dev/null echo awk && sed
+	"$1" done test echo grep | grep | | /usr/bin 2>/dev/null "$1" echo -eu then
+2>/dev/null test /usr/bin && | sed /usr/bin
+	x=1 export printf grep && /usr/bin --verbose
+		| x=1 done ${HOME} /usr/bin 'quoted text' local "$@" then ${HOME} | awk
+	/usr/bin awk -eu awk -eu awk -eu --verbose done 'quoted text' then
+		"$@" grep x=1 $(pwd) ${HOME} done awk 2>/dev/null sed printf export awk
+		$(pwd) echo 'quoted text' awk echo local 2>/dev/null && local
+	cd done grep | 'quoted text' done
+		sed sed then | --verbose $(pwd) export -eu && ${HOME} x=1 export printf --verbose
+"$@" --verbose && $(pwd) sed -eu "$1" ${HOME}
+	local /usr/bin x=1 "$@" sed cd awk ${HOME} "$1" x=1 test "$1" done $(pwd) x=1
+		'quoted text' test local ${HOME} ${HOME}
+"$1" && export 2>/dev/null local
+	export && x=1 then ${HOME} readonly
+		export test -eu test | done && --verbose test done x=1 "$1" sed
+		/usr/bin then readonly $(pwd) done -eu $(pwd)
+awk echo "$1" grep sed awk grep sed "$@" printf local readonly
+test sed sed 2>/dev/null && /usr/bin
+	echo "$1" /usr/bin cd cd local 2>/dev/null printf echo test awk echo --verbose
+${HOME} printf then export && echo ${HOME} ${HOME} $(pwd) x=1 grep
+		test | awk test 'quoted text'
+	${HOME} export printf export 2>/dev/null sed
+${HOME} /usr/bin -eu "$1" $(pwd) cd 'quoted text'
+		--verbose -eu --verbose ${HOME} x=1 'quoted text' x=1
+		-eu echo | ${HOME} x=1 sed done awk
+	then && $(pwd) ${HOME} /usr/bin x=1 sed
+		local /usr/bin cd "$1" x=1 printf then --verbose ${HOME}
+awk echo $(pwd) 'quoted text' --verbose
+	x=1 /usr/bin 'quoted text' | export cd sed --verbose
+	grep then awk local "$1" grep cd $(pwd) readonly export cd test "$1"
+	readonly local done grep 2>/dev/null | readonly printf local "$@" test
+		grep grep x=1 'quoted text' done -eu 2>/dev/null printf
+		grep --verbose test -eu readonly export printf | then export "$@"
+done done && export "$@" 2>/dev/null sed printf grep sed cd printf | "$1"
+	2>/dev/null /usr/bin echo &&
+	export | echo sed /usr/bin --verbose
+	"$1" printf | /usr/bin | /usr/bin test ${HOME} "$1" $(pwd)
+$(pwd) "$@" echo printf /usr/bin
+	local awk && --verbose awk done ${HOME} cd readonly done printf --verbose
+		2>/dev/null && grep readonly echo then then printf $(pwd) x=1
+-eu awk test local "$1" /usr/bin $(pwd) ${HOME}
+	'quoted text' done ${HOME} awk "$@" grep awk "$@" $(pwd)
+		cd printf 'quoted text' &&
+local echo awk 2>/dev/null && $(pwd) $(pwd) && sed readonly "$@" echo
+&& --verbose $(pwd) x=1 grep "$1" then --verbose 2>/dev/null printf --verbose
+	test export && printf | export then awk done && export -eu ${HOME} --verbose
+		&& sed /usr/bin 2>/dev/null
+	test | && echo awk $(pwd) then sed "$1" -eu ${HOME} /usr/bin
+then && "$1" printf grep then local test
+		printf $(pwd) local && test readonly then awk ${HOME} export done done
+	cd 2>/dev/null -eu x=1 ${HOME} && readonly --verbose -eu
+	--verbose ${HOME} "$@" export printf printf then --verbose | $(pwd)
+		export export "$@" "$1"
+		${HOME} printf local export && then 'quoted text'
+grep /usr/bin export x=1
+&& local done 2>/dev/null sed readonly x=1 --verbose x=1 "$@"
+	cd /usr/bin | "$1" cd grep && x=1 && "$1"
+		cd printf 2>/dev/null "$1" --verbose grep export "$1" $(pwd)
+		"$@" x=1 cd "$@" done cd && | --verbose test
+readonly 'quoted text' grep awk $(pwd)
+-eu ${HOME} cd echo "$1" done 2>/dev/null
+		local $(pwd) cd $(pwd) $(pwd) sed x=1 then done grep "$@" /usr/bin echo
+	${HOME} cd 'quoted text' then |
+test export grep "$1" grep export x=1 "$@" local cd "$1"
+	grep awk then test ${HOME} grep "$@"
+	/usr/bin ${HOME} 'quoted text' done -eu x=1 test "$@" sed local
+	x=1 grep | done export $(pwd)
+		-eu sed printf done readonly readonly x=1 2>/dev/null local 'quoted text'
+	local readonly 2>/dev/null "$@" awk
+--verbose echo test printf grep cd grep /usr/bin then grep done -eu printf
+		done | printf local -eu printf awk sed done -eu /usr/bin
+grep "$@" echo --verbose
+	2>/dev/null test ${HOME} --verbose --verbose readonly
+| /usr/bin --verbose done test printf -eu -eu echo readonly x=1
+		sed printf then --verbose /usr/bin
+		grep --verbose awk ${HOME} 'quoted text'
+	"$1" && --verbose --verbose done --verbose awk echo test "$1" && 2>/dev/null
+$(pwd) -eu done done x=1 -eu sed --verbose
+	sed cd && echo printf echo "$@" x=1 2>/dev/null && then grep readonly
+		"$1" grep "$@" awk printf "$@"
+echo export export export test 2>/dev/null
+-eu sed --verbose ${HOME} local export then printf 2>/dev/null echo local cd awk
+printf 'quoted text' x=1
+		local grep /usr/bin cd x=1 $(pwd) printf
+x=1 printf /usr/bin cd "$@" then 'quoted text' awk --verbose
+	x=1 cd | x=1 cd readonly 'quoted text'
+| echo echo local --verbose && x=1 "$1" "$1" then
+printf && "$1" ${HOME} local
+	'quoted text' 'quoted text' then
+		readonly test "$@" done x=1 -eu then ${HOME} sed test | 'quoted text'
+	echo export x=1 && --verbose test export
+		echo then done | readonly
+awk $(pwd) 2>/dev/null 2>/dev/null sed | ${HOME} "$@"
+		| cd x=1 /usr/bin 2>/dev/null 2>/dev/null /usr/bin
+	2>/dev/null test -eu && local ${HOME} "$@" then grep && local 2>/dev/null
+		sed /usr/bin x=1 -eu --verbose test -eu readonly && readonly test "$1" "$@"
+-eu done printf cd readonly cd export
+		cd cd readonly | -eu 2>/dev/null ${HOME} printf $(pwd) cd printf grep /usr/bin
+		/usr/bin x=1 "$@" ${HOME} readonly
+	"$1" test 'quoted text' 'quoted text' export "$1" echo
+readonly printf then --verbose done | ${HOME}
+	then --verbose sed then /usr/bin
+printf then done | readonly 'quoted text'
+"$@" -eu sed cd x=1 done done $(pwd) sed sed 'quoted text' -eu
+x=1 then done x=1 grep --verbose local sed awk "$1" |
+-eu x=1 /usr/bin grep echo export awk -eu
+&& grep then test "$1" $(pwd)
+awk -eu then -eu done local local | done cd && 2>/dev/null
+	echo "$1" then "$1" "$1" sed /usr/bin
+${HOME} | "$1" grep local | --verbose
+		readonly $(pwd) done "$@" local $(pwd) awk local 'quoted text' awk
+grep -eu cd x=1 "$1" local $(pwd) 'quoted text'
+	$(pwd) local echo && x=1
+$(pwd) ${HOME} && /usr/bin local ${HOME} "$1"
+export grep echo | cd 'quoted text'
+		readonly cd "$@" $(pwd) ${HOME}
+&& --verbose readonly 2>/dev/null test echo readonly
+'quoted text' awk x=1 "$@" test cd then "$1" sed sed && awk test
+	"$@" | --verbose ${HOME} 'quoted text'
+		| echo readonly "$1" done
+local -eu "$@" && "$1" readonly awk done && export | --verbose
+test local $(pwd) -eu printf "$1" printf && cd local grep export
+	echo $(pwd) awk awk test ${HOME} done && ${HOME}
+	'quoted text' then export cd cd readonly then --verbose --verbose "$1" --verbose
+		readonly /usr/bin ${HOME} 'quoted text'
+	local "$1" $(pwd) "$@" export sed
+x=1 $(pwd) x=1 $(pwd) 'quoted text' test -eu
+	"$1" readonly 2>/dev/null cd -eu
+	| | "$1" -eu local done && 2>/dev/null $(pwd)
+grep done echo export readonly then $(pwd) local printf awk sed 'quoted text' readonly
+'quoted text' 2>/dev/null local /usr/bin test -eu "$@" "$@"
+	echo echo --verbose then test readonly
+		printf "$@" echo ${HOME} 2>/dev/null
+	"$@" "$@" grep --verbose test local ${HOME} awk done
+then done export export | sed awk && x=1 export sed
+	2>/dev/null "$1" grep | printf export | 2>/dev/null printf local --verbose
+local echo 2>/dev/null
+cd $(pwd) ${HOME} awk && "$1" 2>/dev/null cd x=1 done 'quoted text' /usr/bin
+		local && sed sed local -eu $(pwd)
+/usr/bin "$1" "$1" echo ${HOME}
+	&& | 'quoted text' sed "$@" local x=1 cd test $(pwd) && | grep $(pwd) readonly
+		echo /usr/bin echo echo local
+	cd awk then | /usr/bin echo
+readonly test | "$@" grep
+--verbose && sed export "$@" "$1"
+		test then ${HOME} /usr/bin /usr/bin $(pwd)
+test sed export 'quoted text' ${HOME} grep export -eu 'quoted text' test awk
+		grep 'quoted text' sed /usr/bin grep awk export
+		'quoted text' cd $(pwd) /usr/bin
+	$(pwd) /usr/bin done x=1 done local /usr/bin && echo
+		&& local test "$1" x=1 export
+		local ${HOME} sed test export then "$@" /usr/bin printf echo -eu then grep
+${HOME} awk ${HOME} done --verbose /usr/bin
+&& export export ${HOME} done done awk printf sed then
+${HOME} && 2>/dev/null x=1 test sed
+	then 2>/dev/null echo awk test printf /usr/bin cd readonly /usr/bin --verbose
+		local local "$@" --verbose $(pwd) local /usr/bin sed "$1"
+grep 2>/dev/null $(pwd) "$1"
+	"$1" echo sed grep cd readonly local -eu 'quoted text' test readonly $(pwd)
+-eu cd sed done export echo ${HOME} awk --verbose /usr/bin done test
+		awk export done awk cd done done && then grep then done x=1 $(pwd) sed awk
+	-eu x=1 cd sed /usr/bin export
+		printf printf $(pwd) local --verbose
+		2>/dev/null -eu -eu ${HOME} done 'quoted text' sed
+		"$@" sed echo grep ${HOME} test done export echo readonly
+	--verbose --verbose /usr/bin
+		echo /usr/bin 2>/dev/null /usr/bin | && 'quoted text'
+		2>/dev/null 'quoted text' echo test printf
+	--verbose 2>/dev/null export 'quoted text'
+		awk local cd | cd sed x=1
+	cd cd --verbose | "$1" -eu local awk ${HOME} cd cd
+		"$1" printf --verbose done export --verbose | echo local
+		awk && --verbose awk 2>/dev/null
+	printf 2>/dev/null test 'quoted text' && test local readonly awk
+		test cd 2>/dev/null --verbose
+x=1 sed local -eu $(pwd) "$@" readonly cd x=1 done -eu readonly && printf
+	| && cd $(pwd) test cd readonly done ${HOME} echo -eu export awk then 'quoted text'
+sed then --verbose -eu printf ${HOME}
+	--verbose | | then -eu readonly -eu echo local $(pwd)
+readonly sed ${HOME} cd then ${HOME} ${HOME} 2>/dev/null | echo sed then sed
+	${HOME} 2>/dev/null printf cd sed readonly sed ${HOME}
+	-eu grep cd printf --verbose x=1 ${HOME} printf
+x=1 "$@" then $(pwd) && cd /usr/bin grep
+		-eu sed printf $(pwd) | 'quoted text'
+/usr/bin sed done awk printf grep
+done done --verbose then then sed "$@" -eu sed grep then readonly "$1" test
+	--verbose -eu readonly export sed /usr/bin --verbose done readonly x=1 test export
+	awk --verbose /usr/bin sed
+		readonly 2>/dev/null ${HOME} "$@" sed test | cd --verbose
+		2>/dev/null done awk ${HOME} ${HOME} /usr/bin export readonly $(pwd) done
+	2>/dev/null 'quoted text' test then cd then 'quoted text' -eu local
+	grep "$1" echo x=1 $(pwd) awk
+		"$1" $(pwd) awk "$1" grep "$@" grep | cd export test grep 'quoted text'
+readonly x=1 printf /usr/bin x=1 printf x=1 "$@" | &&
+		then printf awk 2>/dev/null $(pwd) awk 'quoted text' done --verbose
+'quoted text' && "$1" done readonly "$1" export local && && "$@" then local
+		/usr/bin echo readonly --verbose 'quoted text' | then
+		&& export 'quoted text' grep ${HOME} "$1" 'quoted text' --verbose -eu --verbose
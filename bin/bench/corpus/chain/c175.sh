@@ -0,0 +1,2001 @@
+sed local readonly done export
+	$(pwd) /usr/bin grep grep | --verbose test --verbose then export
+	2>/dev/null sed 2>/dev/null then $(pwd)
+	readonly echo | export printf /usr/bin printf sed export
+	printf /usr/bin then export
+		done $(pwd) "$1" local 2>/dev/null
+		$(pwd) printf test -eu test printf x=1 export x=1 readonly cd cd "$@"
+		then then /usr/bin 'quoted text' test
+		| | awk -eu -eu && 'quoted text'
+local 2>/dev/null $(pwd) local
+	printf ${HOME} export done done x=1 test "$1" grep awk 2>/dev/null $(pwd) "$1"
+		$(pwd) done x=1 'quoted text' readonly 2>/dev/null then --verbose
+	test echo $(pwd) done | "$1" "$@" grep 2>/dev/null then sed
+	sed x=1 'quoted text' cd
+		cd local 'quoted text' x=1 'quoted text' done export
+		awk local echo /usr/bin "$1" "$@" /usr/bin grep cd && 'quoted text'
+	-eu && /usr/bin export local ${HOME} echo local export cd "$1" echo
+	-eu test x=1 test $(pwd) done printf awk 'quoted text' x=1 "$1" then 'quoted text'
+		| && 'quoted text' 'quoted text' export echo export echo x=1
+	awk local grep 2>/dev/null echo done --verbose $(pwd) local
+		awk echo readonly readonly /usr/bin
+	export local echo | -eu ${HOME} grep "$@" cd cd 2>/dev/null export 2>/dev/null
+export && "$@" "$@" then x=1
+	awk readonly done echo ${HOME} -eu --verbose cd -eu /usr/bin && done 'quoted text'
+2>/dev/null awk 'quoted text'
+	&& "$@" | awk ${HOME} grep /usr/bin readonly done /usr/bin --verbose &&
+	${HOME} echo --verbose sed "$1" /usr/bin --verbose
+		-eu awk grep local 'quoted text' done -eu echo awk sed awk export sed
+test 'quoted text' "$@" cd echo
+	"$@" sed grep test "$1" printf cd /usr/bin "$@" grep x=1 'quoted text' then sed
+/usr/bin "$1" $(pwd) then | && echo "$@"
+	echo 2>/dev/null 2>/dev/null then --verbose printf --verbose
+/usr/bin "$@" $(pwd) printf | test | --verbose
+		x=1 printf echo awk -eu "$@" done readonly awk awk grep cd /usr/bin 'quoted text'
+		awk cd printf done ${HOME} | 2>/dev/null
+		/usr/bin readonly "$@" then test readonly awk | | 'quoted text'
+	&& x=1 | --verbose cd sed && local "$1"
+	then 'quoted text' 'quoted text'
+		&& --verbose echo 'quoted text' grep 2>/dev/null | /usr/bin local --verbose
+		-eu awk ${HOME} export "$@" local grep echo x=1 then sed "$1" local
+	readonly 'quoted text' $(pwd)
+'quoted text' printf test 2>/dev/null /usr/bin local cd /usr/bin
+		grep local && /usr/bin done
+		"$@" 'quoted text' printf "$@" readonly "$@"
+x=1 then | awk awk | test cd x=1
+		export awk sed readonly x=1 && then -eu export -eu
+		'quoted text' && | "$@" -eu printf
+		$(pwd) --verbose $(pwd) cd local --verbose 2>/dev/null
+	export sed "$1" -eu local --verbose | test &&
+		/usr/bin then "$1" export /usr/bin grep echo x=1 2>/dev/null ${HOME} ${HOME} awk
+	x=1 /usr/bin "$1" ${HOME} $(pwd) local 'quoted text' &&
+test 2>/dev/null sed ${HOME} -eu done "$1" cd && "$@" local echo sed then then
+sed "$@" -eu printf sed ${HOME} printf grep ${HOME} grep then 2>/dev/null
+'quoted text' sed "$1" then | export
+	| ${HOME} test done --verbose readonly /usr/bin "$@"
+-eu 2>/dev/null 'quoted text' printf
+	| printf | "$@" readonly ${HOME} printf awk $(pwd)
+	-eu /usr/bin then done "$1" ${HOME} printf $(pwd) "$1" grep done export
+	cd && 'quoted text' $(pwd) $(pwd) x=1 cd --verbose sed awk ${HOME}
+		"$1" cd /usr/bin done done
+"$@" awk --verbose /usr/bin 2>/dev/null readonly 2>/dev/null "$@" echo && "$@"
+	export local cd export echo
+	readonly | $(pwd) 'quoted text' then "$1" echo sed echo
+export /usr/bin sed echo ${HOME} test readonly readonly readonly "$1" --verbose
+	printf "$@" && /usr/bin local test "$@" export then "$@" grep && local awk | local
+	test printf test printf awk readonly readonly printf
+		sed local ${HOME} /usr/bin x=1 "$@" 2>/dev/null grep $(pwd)
+	${HOME} export && export printf printf x=1 grep cd readonly cd local |
+	cd --verbose /usr/bin cd awk | echo done
+		grep --verbose "$@" ${HOME} test cd awk --verbose ${HOME}
+		'quoted text' --verbose readonly "$@" -eu done --verbose /usr/bin "$1"
+then echo /usr/bin 'quoted text' echo ${HOME} x=1 awk cd done -eu done && | && readonly
+readonly sed "$@" /usr/bin local x=1 x=1 sed readonly
+local $(pwd) x=1 readonly 2>/dev/null readonly
+	done export grep $(pwd) /usr/bin ${HOME} local awk $(pwd) readonly /usr/bin
+		--verbose export echo --verbose $(pwd) 2>/dev/null
+	"$1" cd export ${HOME} awk cd "$@" --verbose ${HOME}
+		grep /usr/bin 'quoted text' readonly echo 'quoted text' ${HOME}
+'quoted text' then "$@"
+		awk printf readonly --verbose
+		/usr/bin export grep x=1 grep
+	done 2>/dev/null printf then x=1 ${HOME} --verbose sed
+	"$@" sed && 2>/dev/null --verbose
+printf grep | --verbose $(pwd) x=1 readonly export x=1 export "$@" ${HOME}
+		"$@" | then grep && $(pwd) /usr/bin
+		$(pwd) x=1 --verbose cd printf printf echo done echo "$@" x=1 grep readonly cd
+		-eu 2>/dev/null && sed x=1 --verbose | export /usr/bin readonly
+	$(pwd) $(pwd) done | "$1" 2>/dev/null grep awk ${HOME} --verbose
+		-eu grep "$1" done ${HOME} cd then -eu grep "$1" "$@" x=1 echo
+		${HOME} -eu --verbose done sed grep done
+	cd printf /usr/bin done sed readonly sed
+		test awk grep export 'quoted text' cd && done local export local && 2>/dev/null
+export && test export
+-eu export then && "$@" awk -eu done then 'quoted text' test
+		"$@" printf x=1 --verbose "$@" --verbose "$1"
+	awk $(pwd) | ${HOME} printf sed grep $(pwd) | echo ${HOME} ${HOME} --verbose
+		awk --verbose | then --verbose grep grep
+	test x=1 $(pwd) export -eu test
+		/usr/bin 2>/dev/null x=1 x=1 readonly && x=1 test echo | awk
+		sed test x=1 --verbose then ${HOME} "$@" | 'quoted text'
+"$@" ${HOME} export printf cd
+	echo done && | /usr/bin export export export
+		| echo grep && test awk x=1 $(pwd) then local 'quoted text' x=1 printf $(pwd)
+done /usr/bin echo awk awk echo --verbose "$@" test export
+	"$@" $(pwd) x=1 && then echo local -eu x=1 local
+		-eu done | echo 'quoted text' /usr/bin "$@"
+		then | echo 2>/dev/null 'quoted text' x=1 done readonly
+	${HOME} /usr/bin sed && ${HOME} test then echo "$@" printf 2>/dev/null export
+test -eu sed export cd echo
+	sed /usr/bin "$@" | | --verbose "$1" echo x=1
+x=1 /usr/bin && && then --verbose awk
+		export $(pwd) --verbose "$1" awk test export echo
+cd sed "$@" cd /usr/bin then sed | done "$1" 'quoted text' && cd readonly | "$1"
+	2>/dev/null export local test /usr/bin | cd | then $(pwd) --verbose done ${HOME}
+		cd printf export sed && --verbose echo export local awk x=1
+	printf done | then local
+	--verbose done echo x=1 2>/dev/null "$1" printf
+		printf /usr/bin "$@" done then x=1 awk done grep
+	test test x=1 ${HOME} grep then
+local echo 2>/dev/null 2>/dev/null cd | test 2>/dev/null -eu ${HOME} awk then
+awk x=1 printf echo | done done ${HOME}
+	done /usr/bin "$@" sed | then printf "$@" grep readonly cd export
+'quoted text' then 'quoted text' local cd $(pwd) 'quoted text' cd awk
+export | echo export sed cd --verbose sed "$1" x=1 printf
+	$(pwd) 2>/dev/null cd && awk export
+done 2>/dev/null ${HOME} &&
+	test /usr/bin $(pwd) && -eu && export 'quoted text' awk
+		2>/dev/null 2>/dev/null x=1 'quoted text' x=1
+	-eu echo $(pwd) -eu 'quoted text'
+		'quoted text' then "$1" --verbose grep --verbose printf printf
+	grep echo export sed printf
+	$(pwd) $(pwd) export test sed then
+--verbose "$@" "$@" 2>/dev/null local then -eu $(pwd) done 'quoted text' cd readonly
+'quoted text' 2>/dev/null --verbose "$1" | -eu local ${HOME} then 'quoted text'
+	readonly readonly echo
+export awk "$@" grep /usr/bin local
+		2>/dev/null ${HOME} "$@" 2>/dev/null
+	echo local done echo "$@"
+		export $(pwd) local local -eu 2>/dev/null
+cd $(pwd) -eu echo x=1 done readonly | $(pwd) 'quoted text' /usr/bin then $(pwd)
+grep printf grep done printf then then export && echo sed grep done | grep
+local $(pwd) 'quoted text' grep --verbose
+	readonly grep /usr/bin "$@" "$@" export --verbose
+2>/dev/null test done then "$1" 2>/dev/null "$1"
+		grep | "$1" && ${HOME} test readonly printf |
+		--verbose sed grep 'quoted text' readonly 2>/dev/null "$@" 2>/dev/null
+	&& "$1" then "$1" x=1 done echo "$1" ${HOME} awk awk "$1" printf test
+		readonly --verbose | readonly cd "$@" readonly test readonly 2>/dev/null
+		/usr/bin sed cd "$@" ${HOME} done readonly done cd echo printf
+	-eu done /usr/bin grep done cd ${HOME} --verbose grep --verbose cd grep
+$(pwd) "$1" "$@" 2>/dev/null local then | ${HOME} --verbose
+echo test "$@" x=1 "$1" | grep cd
+done "$1" cd /usr/bin 'quoted text' x=1 test then --verbose /usr/bin
+		/usr/bin && ${HOME} local export "$@"
+	export cd cd done /usr/bin local test x=1
+		| grep x=1 echo awk done test /usr/bin
+		| test test --verbose local 'quoted text' /usr/bin "$@" readonly
+sed sed echo 2>/dev/null done "$1" test printf then -eu "$1"
+	x=1 done done echo "$@" 2>/dev/null && awk
+	export cd ${HOME} | readonly test grep -eu 'quoted text' ${HOME}
+test | cd printf | x=1 $(pwd) sed then --verbose
+		x=1 local --verbose done | --verbose $(pwd) "$@" sed ${HOME} -eu export
+	then sed awk $(pwd) $(pwd) && then
+printf | ${HOME} 'quoted text' x=1 | local sed local sed "$1" "$1" --verbose
+	then --verbose "$@" 'quoted text' readonly "$1"
+		${HOME} 'quoted text' local -eu sed
+cd done echo $(pwd) sed ${HOME} | | 'quoted text' "$1"
+&& cd 2>/dev/null printf sed "$@" |
+		/usr/bin done "$@" then export echo then "$1" /usr/bin export
+		cd /usr/bin "$@" local cd -eu
+	done cd local "$1" awk | export echo grep && --verbose echo 'quoted text'
+		printf readonly $(pwd) grep && grep /usr/bin "$1"
+		awk done -eu | -eu grep awk sed ${HOME}
+'quoted text' | /usr/bin --verbose done readonly 2>/dev/null 'quoted text' x=1
+	done 2>/dev/null awk 2>/dev/null sed &&
+&& printf | -eu done 'quoted text' --verbose cd sed && && "$1"
+	-eu ${HOME} test grep "$1" test then test 2>/dev/null 'quoted text' test then
+		'quoted text' $(pwd) --verbose --verbose 2>/dev/null
+	x=1 cd 'quoted text' then /usr/bin done --verbose "$1"
+	grep "$1" printf --verbose echo then ${HOME} /usr/bin
+		-eu cd grep -eu readonly /usr/bin |
+sed $(pwd) cd printf -eu 'quoted text' printf ${HOME} sed readonly export echo
+		x=1 sed "$1" 2>/dev/null "$@" -eu then printf then awk
+export /usr/bin | | sed
+	local $(pwd) -eu grep test "$@" test
+		cd 'quoted text' printf --verbose printf /usr/bin test grep && | 2>/dev/null
+readonly -eu printf -eu 'quoted text' local grep | $(pwd) -eu /usr/bin
+	--verbose sed readonly export | && printf grep test grep && "$@" ${HOME} &&
+	readonly readonly cd then ${HOME} 'quoted text' grep grep local --verbose
+		then && awk "$1" export awk then cd 2>/dev/null 2>/dev/null x=1 grep 2>/dev/null
+		printf -eu $(pwd) done 2>/dev/null grep readonly test
+	sed && readonly sed grep ${HOME}
+echo --verbose 'quoted text'
+x=1 grep -eu done done $(pwd) -eu test 'quoted text'
+		cd ${HOME} readonly awk readonly sed /usr/bin readonly --verbose export
+		--verbose 'quoted text' x=1
+		2>/dev/null -eu local test "$@" done sed && && && 'quoted text' done 'quoted text'
+	-eu grep $(pwd) 2>/dev/null 2>/dev/null cd export
+		2>/dev/null printf readonly readonly "$@" | --verbose
+	done ${HOME} sed awk printf | 'quoted text' readonly ${HOME}
+grep grep x=1 awk grep -eu $(pwd) && printf 2>/dev/null cd -eu cd grep
+	sed -eu && "$@" local --verbose x=1 readonly ${HOME} -eu "$@" export
+test 'quoted text' export done local -eu grep /usr/bin grep
+	grep /usr/bin --verbose sed
+	export cd then $(pwd)
+2>/dev/null printf /usr/bin awk --verbose "$@" x=1 export export test cd sed local
+		cd export $(pwd) "$1" && $(pwd) echo printf
+"$@" 2>/dev/null then echo local "$1" test
+		echo x=1 local cd echo "$@"
+		export sed x=1 /usr/bin grep done cd done 'quoted text' 'quoted text' sed &&
+	${HOME} && "$@" "$@" printf 2>/dev/null done local $(pwd) test awk $(pwd) awk
+'quoted text' printf ${HOME} then done "$1" test test
+		"$@" && awk /usr/bin /usr/bin -eu /usr/bin
+	grep "$@" sed sed sed &&
+	done 2>/dev/null printf $(pwd) x=1 ${HOME} && --verbose printf sed
+	readonly printf -eu 2>/dev/null printf /usr/bin grep
+		echo sed ${HOME} ${HOME} printf
+	done -eu then "$@" 2>/dev/null $(pwd) x=1 'quoted text' --verbose
+	$(pwd) readonly readonly
+	printf then local ${HOME}
+awk test x=1 && export "$@" "$@" cd sed
+echo local grep printf "$1" 2>/dev/null cd x=1 | test done
+export sed /usr/bin done | export sed $(pwd) x=1
+		| 2>/dev/null | --verbose export readonly
+printf "$1" "$1" grep sed ${HOME} x=1 awk export "$1" $(pwd)
+		export local 'quoted text' --verbose $(pwd) grep
+readonly sed done -eu printf
+	&& cd local ${HOME} "$1" test | ${HOME} 'quoted text' /usr/bin
+		readonly then $(pwd) export
+	${HOME} 'quoted text' && $(pwd) 2>/dev/null grep test "$1" 'quoted text'
+		&& x=1 "$1" done | -eu cd sed | printf
+	echo 'quoted text' echo /usr/bin printf 'quoted text'
+"$1" export cd awk && grep ${HOME} /usr/bin --verbose local
+${HOME} --verbose local
+	"$1" | then echo /usr/bin test readonly -eu printf "$@"
+		printf "$1" 2>/dev/null /usr/bin
+x=1 && && | | sed sed echo 2>/dev/null /usr/bin 'quoted text' awk --verbose awk
+'quoted text' 2>/dev/null awk "$1" --verbose "$@" test
+export 'quoted text' 'quoted text'
+	readonly export | --verbose export $(pwd) local test | export printf echo
+		printf awk /usr/bin x=1 --verbose 2>/dev/null
+	printf test export export /usr/bin grep echo 2>/dev/null ${HOME} then
+		then && sed $(pwd) && printf $(pwd) 'quoted text' && && then "$@"
+		test readonly $(pwd) done | 'quoted text' "$1" x=1 | -eu echo | $(pwd)
+		&& -eu test "$1" done then echo printf -eu 'quoted text' echo cd echo readonly
+x=1 2>/dev/null readonly --verbose
+	/usr/bin sed done ${HOME} 'quoted text'
+awk /usr/bin printf "$1" cd cd then awk
+		test | /usr/bin "$1" readonly local awk x=1 local "$@" --verbose
+		| test test x=1 test && && sed sed echo cd ${HOME} x=1 sed
+	awk test awk 2>/dev/null ${HOME}
+		--verbose local printf x=1 x=1 test -eu | done | readonly printf x=1
+		/usr/bin -eu | printf /usr/bin echo grep grep awk 'quoted text'
+	-eu -eu $(pwd) test /usr/bin
+		| cd export export printf x=1 printf
+		${HOME} test export ${HOME} | echo -eu echo cd test
+$(pwd) /usr/bin 2>/dev/null "$@" | x=1 | printf | "$@" --verbose cd 2>/dev/null
+--verbose sed 'quoted text' 2>/dev/null
+--verbose awk cd export /usr/bin --verbose
+	cd 'quoted text' done /usr/bin /usr/bin echo cd &&
+	export x=1 2>/dev/null /usr/bin printf cd 'quoted text' echo 'quoted text'
+'quoted text' $(pwd) | | echo grep grep grep grep && export /usr/bin
+test -eu readonly "$1" && export local sed --verbose 'quoted text' grep
+echo "$1" local sed grep --verbose export echo then 'quoted text' done
+&& x=1 done printf "$@" grep --verbose cd sed x=1 done
+	done sed | $(pwd) local done x=1
+	export -eu echo local "$@" $(pwd)
+then /usr/bin local grep 2>/dev/null grep
+	export $(pwd) export sed awk "$1" -eu sed 'quoted text'
+		readonly grep "$@" 'quoted text' -eu local grep && awk cd "$@" test local
+		awk /usr/bin local then grep
+	${HOME} local done done 'quoted text' cd readonly
+		awk readonly local local awk done grep /usr/bin echo awk && then echo
+	export | then grep -eu export awk
+		"$1" export x=1 $(pwd) readonly echo 'quoted text'
+	2>/dev/null awk then 'quoted text' -eu "$1" -eu
+		x=1 local readonly local 'quoted text' cd -eu local cd readonly test | done sed
+		${HOME} grep --verbose /usr/bin
+	/usr/bin --verbose test | done -eu "$1" 'quoted text' --verbose
+	2>/dev/null grep grep local cd "$1" then readonly test echo export 2>/dev/null
+	'quoted text' -eu /usr/bin grep && awk then 'quoted text'
+	| 'quoted text' done readonly x=1 'quoted text'
+	/usr/bin 2>/dev/null sed grep 2>/dev/null local $(pwd) --verbose 2>/dev/null
+		| local 2>/dev/null sed x=1 ${HOME} -eu awk echo grep then | test
+	readonly cd export local -eu 'quoted text' -eu $(pwd) echo readonly
+	export done echo -eu 2>/dev/null
+		awk readonly x=1 cd $(pwd) export test -eu $(pwd) x=1 2>/dev/null awk "$1"
+&& 2>/dev/null && test printf /usr/bin then readonly
+	readonly | done done $(pwd) done then $(pwd)
+	echo cd && 2>/dev/null 2>/dev/null | | done --verbose then sed 'quoted text'
+	| 2>/dev/null /usr/bin done echo readonly
+		done done echo cd 2>/dev/null printf
+	--verbose done sed -eu ${HOME} cd test awk
+	readonly readonly $(pwd) done done --verbose "$@" awk &&
+	export grep done awk test --verbose printf --verbose
+		readonly export -eu awk 'quoted text' ${HOME} "$1" -eu echo sed /usr/bin local
+	-eu "$1" "$1" awk 2>/dev/null echo done
+		-eu readonly readonly --verbose "$@" cd echo -eu 'quoted text' test then 'quoted text'
+		export echo echo "$@" sed local
+	test awk $(pwd) cd export local 'quoted text' -eu 2>/dev/null sed printf
+test 2>/dev/null cd then "$1" export 'quoted text' export 2>/dev/null
+/usr/bin 2>/dev/null 2>/dev/null ${HOME} awk then 'quoted text' && 'quoted text'
+cd 'quoted text' then "$@" --verbose 2>/dev/null
+	--verbose "$1" -eu $(pwd)
+		test --verbose printf x=1 then
+		printf -eu done | cd "$@" local | "$@" ${HOME} "$@" x=1 /usr/bin
+	local "$@" printf "$1" /usr/bin "$@" printf cd 'quoted text' awk
+echo "$1" && test printf echo --verbose -eu ${HOME}
+		2>/dev/null done 'quoted text' x=1 sed local -eu -eu x=1 printf printf --verbose
+printf done "$@" grep --verbose grep | echo -eu sed then echo cd | readonly
+		then "$@" /usr/bin 'quoted text' then grep readonly
+	"$1" done "$@" x=1 'quoted text' && -eu test readonly /usr/bin
+		grep ${HOME} x=1 $(pwd) 'quoted text' sed $(pwd) cd && --verbose
+--verbose && printf sed ${HOME} && x=1 $(pwd) then sed printf 'quoted text'
+	local $(pwd) sed && "$1" -eu sed --verbose
+		&& export --verbose done "$@" x=1
+		printf --verbose echo readonly
+		/usr/bin 'quoted text' | x=1 "$1" "$1" | done x=1 export done && sed
+		"$@" readonly sed && echo sed -eu && -eu
+	${HOME} $(pwd) cd readonly printf /usr/bin | cd "$@"
+		local sed x=1 x=1 'quoted text' then
+	$(pwd) $(pwd) then -eu /usr/bin --verbose awk local test printf
+grep export 'quoted text' /usr/bin local grep local "$@" echo 2>/dev/null
+		| readonly readonly ${HOME} done | echo /usr/bin --verbose
+	test export echo readonly -eu sed x=1 "$1" -eu export 'quoted text' grep 2>/dev/null
+		export 2>/dev/null x=1 awk printf echo ${HOME} --verbose
+printf /usr/bin "$1" then ${HOME} -eu "$1" echo 'quoted text'
+	readonly "$1" local ${HOME} test readonly cd 'quoted text'
+	echo x=1 readonly then "$1" export "$@"
+	"$@" 'quoted text' "$1" readonly
+	"$1" x=1 "$1" ${HOME} awk test awk --verbose $(pwd) cd /usr/bin awk
+	sed cd -eu "$1" sed "$1" -eu 2>/dev/null --verbose local readonly | $(pwd)
+'quoted text' "$@" sed then --verbose | ${HOME} test $(pwd) test echo sed
+	export $(pwd) echo $(pwd) export test --verbose readonly | export printf
+	grep export x=1 && 'quoted text' "$1" $(pwd)
+grep 2>/dev/null --verbose test export awk test
+	2>/dev/null && --verbose /usr/bin test 'quoted text'
+${HOME} "$1" local readonly done awk "$1" done
+	export test --verbose local ${HOME} awk then echo 'quoted text'
+		done "$@" readonly printf /usr/bin sed then cd cd
+"$1" awk done "$1" x=1 readonly -eu | 'quoted text'
+test /usr/bin 'quoted text' $(pwd) readonly
+		/usr/bin export sed test done export 'quoted text'
+$(pwd) then test && test "$@"
+	&& test "$@" local $(pwd)
+"$1" done sed 2>/dev/null local ${HOME}
+		cd 'quoted text' -eu -eu "$@"
+	'quoted text' ${HOME} then --verbose /usr/bin && test test grep "$@"
+	export export echo "$1" --verbose
+		| /usr/bin -eu "$@" grep --verbose local 'quoted text' /usr/bin "$1" 'quoted text'
+		cd cd /usr/bin sed printf 2>/dev/null
+		"$@" readonly 'quoted text' 2>/dev/null
+		export "$1" $(pwd) /usr/bin grep cd ${HOME} local x=1 2>/dev/null
+		export awk done 'quoted text' test && $(pwd) printf "$@"
+	$(pwd) grep cd readonly done ${HOME} "$@" "$@"
+	-eu --verbose grep 2>/dev/null "$@" local grep "$@" /usr/bin then -eu "$@"
+	"$1" -eu cd local 'quoted text' export sed grep sed --verbose /usr/bin
+grep 2>/dev/null grep test --verbose export &&
+	/usr/bin test local then
+grep grep "$@" -eu 'quoted text' test
+		cd local 2>/dev/null 'quoted text' "$@" done test
+		sed x=1 2>/dev/null cd /usr/bin $(pwd) printf
+	done grep awk echo --verbose
+local export local export ${HOME} echo export export cd echo $(pwd)
+-eu $(pwd) echo 'quoted text'
+		local cd "$1" local 'quoted text' 2>/dev/null 2>/dev/null
+		'quoted text' ${HOME} grep sed 'quoted text'
+$(pwd) && done x=1 -eu --verbose "$1"
+2>/dev/null test export done export awk 2>/dev/null
+	${HOME} echo -eu local x=1 x=1 --verbose echo
+local local --verbose "$1" x=1 -eu
+	sed awk x=1 local 2>/dev/null
+		printf then awk sed "$1" cd awk 2>/dev/null $(pwd) then -eu readonly --verbose
+		${HOME} cd sed 2>/dev/null
+$(pwd) | sed local "$1" grep export ${HOME} x=1 -eu then grep test
+		awk 2>/dev/null then local "$@"
+| awk ${HOME} 'quoted text' ${HOME} awk
+readonly then 'quoted text' -eu printf then "$1"
+	/usr/bin "$1" | then x=1 x=1 grep -eu 'quoted text' cd "$1" ${HOME}
+| 2>/dev/null then -eu
+	done | && /usr/bin "$1" done awk test cd
+		--verbose cd done readonly awk local cd
+&& $(pwd) | -eu export ${HOME} --verbose --verbose $(pwd)
+-eu test printf x=1 echo --verbose
+		grep /usr/bin printf && printf echo /usr/bin local 2>/dev/null ${HOME}
+2>/dev/null 2>/dev/null "$@" then echo --verbose readonly
+	done "$1" $(pwd) test $(pwd) ${HOME} $(pwd)
+grep 2>/dev/null done echo export 'quoted text' 'quoted text' 2>/dev/null
+	2>/dev/null x=1 "$@" $(pwd) | 'quoted text' -eu 'quoted text' test && sed
+done ${HOME} printf test
+		grep x=1 2>/dev/null 2>/dev/null x=1 2>/dev/null
+cd awk cd x=1 x=1 local sed local /usr/bin
+	export ${HOME} export readonly awk "$@" /usr/bin awk cd echo --verbose
+		then test cd printf "$1" && grep && && grep done printf ${HOME}
+		--verbose --verbose x=1 2>/dev/null /usr/bin export /usr/bin /usr/bin
+	-eu | echo grep $(pwd) readonly "$1" "$@"
+/usr/bin awk 'quoted text' $(pwd) $(pwd) "$1" -eu done 2>/dev/null readonly sed
+/usr/bin --verbose $(pwd) awk echo /usr/bin /usr/bin grep 'quoted text'
+		"$1" 'quoted text' -eu $(pwd) done 'quoted text'
+	sed echo | "$1" awk echo | export 2>/dev/null 'quoted text'
+	echo echo local printf -eu
+--verbose 2>/dev/null 'quoted text' awk $(pwd) $(pwd) then test grep --verbose
+x=1 $(pwd) local test "$1" x=1 2>/dev/null /usr/bin printf
+"$1" 'quoted text' x=1 -eu -eu echo test done done
+		printf awk --verbose then export && && cd sed test sed |
+export "$1" --verbose $(pwd) ${HOME} cd sed sed -eu
+	"$@" ${HOME} export sed readonly "$@" local readonly printf printf
+echo then -eu awk $(pwd) done 'quoted text' then then
+		2>/dev/null && export | sed then printf 2>/dev/null
+		2>/dev/null "$@" "$@" --verbose
+		2>/dev/null grep sed then local && 2>/dev/null
+'quoted text' readonly 2>/dev/null && done "$@" cd ${HOME} -eu sed local
+/usr/bin sed 'quoted text' | export "$@" "$@" "$@" echo 'quoted text' "$@"
+| "$@" -eu awk grep 2>/dev/null test && readonly test sed
+	-eu cd -eu 'quoted text' readonly export then
+awk /usr/bin --verbose test -eu sed test
+		cd x=1 test echo cd echo 'quoted text' ${HOME} ${HOME} cd echo readonly ${HOME}
+		awk local test | $(pwd) "$@"
+		/usr/bin -eu echo test && 'quoted text' awk /usr/bin | $(pwd) --verbose done
+'quoted text' test cd grep local
+	export then printf done -eu -eu
+		cd && $(pwd) then ${HOME}
+	test echo sed then then | /usr/bin cd then x=1 test $(pwd) grep -eu
+		"$1" ${HOME} 2>/dev/null then awk -eu x=1 sed x=1 sed -eu "$1" printf
+| grep | && /usr/bin grep /usr/bin 2>/dev/null | cd readonly
+		$(pwd) "$1" echo | -eu echo done x=1 done local sed 'quoted text' -eu done
+		test && done grep test ${HOME} /usr/bin | /usr/bin 2>/dev/null
+		done | sed "$@" -eu awk done readonly readonly x=1 test sed then $(pwd)
+	/usr/bin 2>/dev/null 2>/dev/null readonly test then $(pwd) sed /usr/bin
+		export /usr/bin printf export
+		2>/dev/null done then | ${HOME} "$@" cd ${HOME} grep /usr/bin sed done $(pwd)
+cd echo 'quoted text' grep "$@"
+	| 2>/dev/null grep echo /usr/bin then $(pwd) 'quoted text' printf
+	awk ${HOME} -eu grep && 'quoted text' | -eu --verbose then readonly x=1
+	readonly cd export test sed
+		| then local export grep
+		printf printf ${HOME} export x=1 x=1 grep -eu printf local -eu readonly | -eu
+--verbose -eu x=1 export export awk x=1 --verbose
+	test printf "$@" x=1 "$1" ${HOME} 2>/dev/null echo local export ${HOME} echo
+		x=1 export export "$@" done 'quoted text' echo then test export test echo && ${HOME}
+done done readonly 'quoted text' $(pwd)
+readonly -eu sed -eu x=1 /usr/bin
+"$1" /usr/bin readonly 'quoted text' test test awk awk
+printf "$1" test $(pwd) cd printf -eu 'quoted text' cd && printf sed readonly sed
+		/usr/bin local readonly && 2>/dev/null
+	grep printf "$1" 'quoted text' 'quoted text' 'quoted text' done /usr/bin "$@" awk
+	-eu grep export /usr/bin cd "$1" local /usr/bin cd cd test 'quoted text'
+then grep /usr/bin export test | local local cd x=1
+| done echo 'quoted text' sed
+		readonly local x=1 local export -eu test -eu echo 2>/dev/null
+| cd echo done $(pwd) done "$1" $(pwd)
+	printf printf done then "$@" --verbose echo
+	done 2>/dev/null awk 'quoted text' 2>/dev/null done done sed
+		"$1" done -eu echo printf 'quoted text' 'quoted text' ${HOME} ${HOME} x=1 test
+	-eu local cd printf cd sed awk
+	"$1" cd printf /usr/bin readonly -eu "$1" /usr/bin /usr/bin "$@"
+		cd local /usr/bin "$@" export ${HOME} "$1" | cd awk awk local $(pwd) printf
+		readonly export awk awk done
+		2>/dev/null export -eu x=1 local "$1" then done echo "$1" readonly
+	/usr/bin -eu grep /usr/bin x=1 awk test echo --verbose "$@" /usr/bin
+		--verbose readonly printf "$1" "$1" grep 2>/dev/null done done $(pwd) readonly
+&& local 2>/dev/null -eu done sed 2>/dev/null
+	"$1" local /usr/bin ${HOME} x=1 echo 2>/dev/null "$@" "$1"
+		-eu $(pwd) local 'quoted text' && grep printf readonly $(pwd) "$1" --verbose x=1
+	$(pwd) && then grep done printf && ${HOME} $(pwd) readonly
+"$@" awk readonly x=1 && -eu cd "$@" cd export $(pwd) --verbose done then then
+		local /usr/bin 2>/dev/null then --verbose --verbose ${HOME} then "$@"
+	sed awk -eu export --verbose done sed ${HOME} readonly sed
+		readonly echo local -eu
+echo 'quoted text' sed
+	then sed 2>/dev/null --verbose -eu -eu | readonly ${HOME} grep printf
+		/usr/bin -eu && "$1" /usr/bin -eu 'quoted text' readonly then
+	/usr/bin local --verbose test 'quoted text'
+&& "$1" "$1" grep grep cd
+export done printf | then local ${HOME} awk --verbose
+		printf export grep && x=1 export ${HOME} /usr/bin /usr/bin
+	&& done "$1" local grep --verbose && x=1 readonly && && local -eu done
+		"$@" /usr/bin sed | "$@" x=1 "$1" /usr/bin x=1 ${HOME} ${HOME}
+	x=1 "$@" "$1" printf echo
+		&& readonly then | --verbose -eu readonly test cd grep echo --verbose
+echo cd --verbose then /usr/bin /usr/bin ${HOME} done
+		echo cd "$1" 2>/dev/null "$1" ${HOME}
+readonly x=1 && && ${HOME} x=1
+	| local /usr/bin then 2>/dev/null test --verbose -eu
+	| awk export | --verbose /usr/bin
+$(pwd) readonly awk ${HOME} readonly ${HOME} export x=1 local -eu
+-eu -eu grep readonly 2>/dev/null awk "$@" printf
+	"$@" $(pwd) then then grep done
+	cd local export | cd 2>/dev/null --verbose
+		done test "$@" export | grep x=1
+x=1 && && "$1" -eu --verbose grep test test readonly cd readonly
+	readonly test 'quoted text' 2>/dev/null 'quoted text' grep
+		x=1 "$1" "$1" readonly $(pwd) -eu "$1" cd | "$@" "$@"
+		"$@" readonly sed done echo --verbose x=1 $(pwd) cd grep
+		2>/dev/null $(pwd) "$1" x=1 $(pwd) done export
+"$@" -eu 'quoted text' echo -eu sed done "$@" local
+	/usr/bin readonly "$@" then
+	--verbose x=1 cd ${HOME} 'quoted text' |
+'quoted text' "$@" test "$1" readonly awk "$@" "$1" then cd grep 'quoted text'
+"$1" then "$@" test -eu sed printf cd --verbose
+		'quoted text' readonly echo --verbose readonly grep local --verbose $(pwd) x=1 &&
+awk done local | sed echo cd 'quoted text' grep printf awk 2>/dev/null 'quoted text'
+		$(pwd) --verbose cd 'quoted text' awk then awk echo | /usr/bin
+		echo /usr/bin export printf test local printf readonly grep | readonly readonly
+	--verbose done ${HOME} "$1" then | local local
+	&& awk 2>/dev/null "$@" --verbose readonly
+export -eu echo echo | echo echo readonly
+awk /usr/bin --verbose x=1 ${HOME} --verbose /usr/bin grep echo test then ${HOME}
+	/usr/bin 2>/dev/null done sed local 'quoted text'
+	| test 2>/dev/null /usr/bin cd "$@" echo then 2>/dev/null sed readonly
+x=1 -eu -eu awk && sed --verbose x=1
+test | cd 2>/dev/null echo 'quoted text' -eu && awk ${HOME} sed ${HOME} x=1 local
+	then awk x=1 $(pwd) cd echo echo
+export awk grep $(pwd) then grep sed awk 2>/dev/null 'quoted text'
+		${HOME} ${HOME} 'quoted text' ${HOME}
+		printf done $(pwd) then grep ${HOME} local "$@" then done
+${HOME} done 2>/dev/null 2>/dev/null | x=1 echo "$@" local then ${HOME} | export
+		| "$@" | awk /usr/bin grep readonly 2>/dev/null done /usr/bin
+"$@" sed | && && cd done then then $(pwd) export 'quoted text' then
+done grep echo 'quoted text' echo && -eu $(pwd) done readonly
+"$1" /usr/bin x=1 $(pwd) grep printf done "$@" export sed && ${HOME} "$1" then
+	readonly ${HOME} ${HOME} awk test x=1 'quoted text'
+"$@" && cd local then 'quoted text' done export "$@" echo test printf local
+		done "$@" x=1 done x=1 readonly cd -eu cd cd 2>/dev/null -eu ${HOME} ${HOME} readonly
+readonly local --verbose 'quoted text'
+	printf "$1" test "$1" --verbose awk awk echo export
+	--verbose then && -eu then printf awk && x=1 sed
+	$(pwd) "$@" "$@" /usr/bin cd $(pwd) 2>/dev/null test echo --verbose && test
+		grep done awk test echo local
+	then readonly -eu awk $(pwd) "$1" --verbose local
+grep 2>/dev/null done grep x=1 "$@" 'quoted text'
+		$(pwd) ${HOME} printf -eu test
+	/usr/bin readonly readonly readonly --verbose | | -eu printf then
+	"$1" grep test grep local x=1 x=1 | cd cd x=1 cd readonly 'quoted text'
+grep /usr/bin 2>/dev/null
+		readonly awk ${HOME} -eu | 2>/dev/null --verbose "$@" echo | | local printf
+readonly 2>/dev/null 'quoted text' printf
+	grep 2>/dev/null grep export --verbose
+	local printf grep && cd printf --verbose -eu
+		local "$1" cd readonly -eu "$1" "$@" printf local $(pwd) awk printf grep
+		echo export local local && export --verbose cd grep sed echo awk then
+	x=1 $(pwd) test echo done |
+	-eu printf ${HOME} --verbose x=1 &&
+done 2>/dev/null 'quoted text' done
+	echo then 'quoted text'
+readonly "$1" export && 'quoted text' 'quoted text'
+	-eu ${HOME} printf "$@" awk cd "$@" "$@"
+		${HOME} 'quoted text' sed --verbose $(pwd) export
+printf -eu /usr/bin test then /usr/bin
+done awk 2>/dev/null -eu ${HOME} test -eu -eu ${HOME} done done |
+| grep "$@" 2>/dev/null --verbose
+	readonly -eu | | 'quoted text' x=1 readonly local "$@" then export export
+	-eu readonly sed export sed | grep "$1" test
+		readonly printf then && -eu "$1" awk cd grep ${HOME}
+		-eu grep && $(pwd) $(pwd) x=1 test local grep "$1"
+	--verbose 'quoted text' printf sed export export | 2>/dev/null test then
+x=1 'quoted text' export grep
+&& grep sed /usr/bin ${HOME} --verbose sed
+"$1" sed readonly cd echo "$1" $(pwd) done sed cd awk "$1"
+	| readonly x=1 sed 2>/dev/null
+	awk printf done ${HOME}
+		2>/dev/null readonly readonly echo -eu then awk ${HOME}
+		echo readonly ${HOME} then awk && test export --verbose
+awk grep sed export export -eu awk grep /usr/bin echo test then /usr/bin ${HOME}
+	grep "$1" then 2>/dev/null x=1
+/usr/bin | && awk done awk sed "$@" x=1 /usr/bin && local awk 'quoted text'
+	printf echo grep awk "$1" x=1 then ${HOME} && -eu | --verbose
+		echo echo "$1" 'quoted text' ${HOME} test
+		grep "$@" 2>/dev/null --verbose export
+x=1 awk done && | | grep --verbose awk readonly
+| 2>/dev/null test test "$@" readonly cd x=1 echo | | then test 'quoted text'
+local "$@" cd then --verbose
+		x=1 awk echo "$@" x=1 && --verbose 'quoted text'
+		2>/dev/null 2>/dev/null awk done x=1
+echo awk -eu local echo ${HOME} readonly then | echo export
+	printf 2>/dev/null awk | printf --verbose "$@" | done && "$1" -eu sed local
+	readonly awk test printf ${HOME} cd sed grep "$@"
+		2>/dev/null printf awk export 2>/dev/null readonly 'quoted text' -eu test
+x=1 echo 'quoted text' cd awk && "$@" 2>/dev/null "$1"
+		"$1" sed printf && "$1" done then $(pwd) echo sed -eu export
+$(pwd) $(pwd) test $(pwd) done test
+cd && test "$1" export "$1" echo --verbose ${HOME} echo $(pwd) done
+		${HOME} -eu grep export done ${HOME}
+		then cd && echo | export readonly
+	local x=1 grep grep "$@" $(pwd) readonly readonly test ${HOME} --verbose ${HOME}
+	${HOME} "$@" | 2>/dev/null local && --verbose echo readonly
+echo export && -eu awk "$1" done local done test "$1" sed x=1
+	export export --verbose export --verbose grep /usr/bin then awk "$@"
+		-eu readonly export -eu 2>/dev/null 'quoted text'
+		grep test grep 'quoted text'
+x=1 readonly then "$1" export ${HOME} awk -eu 'quoted text' 2>/dev/null sed 2>/dev/null
+	cd cd test "$1" awk /usr/bin
+		2>/dev/null "$@" && test grep x=1 done /usr/bin
+		| then x=1 'quoted text'
+	echo && local && cd ${HOME} && $(pwd) "$1" && ${HOME} x=1 && echo local
+	$(pwd) "$@" ${HOME} ${HOME} grep cd test sed -eu cd 2>/dev/null
+-eu "$1" printf printf $(pwd) printf | test awk
+	${HOME} --verbose /usr/bin echo $(pwd) sed -eu
+test 'quoted text' readonly echo "$1" echo "$1" x=1 cd "$@" printf
+cd "$@" && && echo echo cd
+2>/dev/null done 2>/dev/null
+	"$@" | cd /usr/bin test /usr/bin
+		grep -eu export ${HOME}
+	echo sed readonly export echo -eu export -eu readonly --verbose printf cd grep
+readonly && 2>/dev/null grep sed x=1 printf done 2>/dev/null cd $(pwd) 2>/dev/null
+	/usr/bin readonly && --verbose
+		x=1 x=1 test | x=1 readonly done ${HOME} 2>/dev/null grep test cd | x=1 'quoted text'
+echo printf echo -eu cd && 'quoted text' then then printf grep local "$@" 2>/dev/null
+'quoted text' "$1" "$@" --verbose -eu local readonly "$1" sed ${HOME} test "$1"
+		printf --verbose local 'quoted text' && x=1
+	${HOME} printf x=1 test ${HOME} echo local
+x=1 cd cd ${HOME} grep then local test 'quoted text' sed readonly x=1 'quoted text'
+sed grep | cd printf ${HOME}
+		readonly 'quoted text' done printf 'quoted text' local "$1" --verbose printf
+	x=1 -eu readonly "$1" 2>/dev/null echo && sed printf done local
+cd test | cd x=1 --verbose test $(pwd) test
+		${HOME} && grep "$1" printf printf
+printf then awk && && --verbose "$1" then
+		readonly /usr/bin local then cd
+		'quoted text' && ${HOME} "$1" 'quoted text' echo x=1 | local
+echo test done cd sed printf cd | 2>/dev/null 'quoted text' x=1 x=1 cd sed local
+		echo 'quoted text' 'quoted text' export sed x=1 2>/dev/null | export
+		awk echo awk ${HOME} local echo grep 2>/dev/null --verbose done grep $(pwd)
+		grep $(pwd) 2>/dev/null
+		sed "$1" -eu cd "$@" $(pwd) sed cd 2>/dev/null
+echo export local "$1" then grep awk printf grep "$@" then cd awk ${HOME}
+&& export 'quoted text' 'quoted text' $(pwd) | -eu
+done readonly then done
+		export printf grep x=1 x=1 test awk x=1
+	| test 2>/dev/null /usr/bin /usr/bin
+	echo ${HOME} 'quoted text' "$1" "$1" cd /usr/bin -eu && x=1 cd 'quoted text'
+	&& "$1" "$1" grep export grep -eu /usr/bin /usr/bin readonly sed then ${HOME}
+		then grep cd | | | sed grep "$1" ${HOME} "$@" export
+		2>/dev/null test "$1" x=1 x=1 sed readonly done 2>/dev/null printf 'quoted text'
+	export x=1 then && ${HOME} "$1" local readonly
+then readonly grep 2>/dev/null "$1" readonly 'quoted text' readonly "$@" grep printf
+	-eu echo then test then -eu ${HOME} then $(pwd) --verbose
+sed test $(pwd) readonly awk "$@" test ${HOME} $(pwd) printf printf
+		'quoted text' "$@" -eu export awk echo
+	&& x=1 | export local printf then
+	sed test printf /usr/bin export "$1" cd printf cd
+	then && && export ${HOME} local ${HOME} export awk sed $(pwd) local --verbose $(pwd)
+	readonly then 'quoted text' then printf x=1 /usr/bin 2>/dev/null
+		then readonly awk /usr/bin
+		done 2>/dev/null -eu awk
+printf /usr/bin /usr/bin readonly 'quoted text' printf then local then 2>/dev/null
+grep /usr/bin "$1" x=1 export
+	test -eu "$1" printf readonly "$1" x=1 sed export
+	"$1" 2>/dev/null awk readonly cd readonly -eu "$1" /usr/bin --verbose done
+sed /usr/bin x=1 export $(pwd) &&
+export awk done "$1" readonly 2>/dev/null printf cd | "$1" 2>/dev/null local
+		printf $(pwd) readonly /usr/bin $(pwd) done echo test local "$@" && 'quoted text'
+-eu export export | awk readonly 'quoted text' sed && | then sed
+	"$@" 2>/dev/null then printf --verbose test local printf 'quoted text'
+then echo ${HOME} sed "$1" echo export
+"$@" sed export export echo printf
+		echo x=1 awk grep printf x=1
+test 'quoted text' cd then && "$@" x=1 printf local done -eu "$@" ${HOME} ${HOME}
+	echo readonly "$@" | /usr/bin /usr/bin "$1" 'quoted text'
+x=1 --verbose --verbose local local -eu printf then
+		test -eu -eu --verbose sed cd done | local 'quoted text' sed
+&& readonly then | cd test echo export cd ${HOME} "$@" "$@" "$1" -eu
+"$@" 'quoted text' done sed test "$1" /usr/bin
+	${HOME} "$1" 'quoted text' /usr/bin x=1 $(pwd) ${HOME} /usr/bin 'quoted text'
+	then export | 2>/dev/null ${HOME}
+		/usr/bin test x=1 "$1" grep grep echo | grep ${HOME} awk test -eu printf -eu
+		"$1" grep export --verbose | $(pwd) $(pwd) x=1 $(pwd) && --verbose
+		local 'quoted text' $(pwd) ${HOME}
+		then echo awk 2>/dev/null sed x=1 test ${HOME} awk /usr/bin 2>/dev/null sed -eu
+	test cd then echo 2>/dev/null | 2>/dev/null --verbose grep --verbose
+		$(pwd) "$@" test test $(pwd) awk
+"$1" /usr/bin -eu grep awk grep 2>/dev/null
+		--verbose /usr/bin 'quoted text' echo printf && --verbose "$1" x=1
+		cd -eu printf done "$@" && | echo then && awk $(pwd) printf | -eu export done ${HOME}
+		${HOME} done | | test export cd 2>/dev/null done cd awk ${HOME}
+--verbose 2>/dev/null test -eu && && awk
+	"$@" export echo "$1" x=1 readonly
+sed && awk grep awk echo cd sed "$1" echo x=1 && | /usr/bin
+sed x=1 "$1" "$@" then && $(pwd) sed | 2>/dev/null awk "$@" cd export local "$@"
+	x=1 $(pwd) printf printf done $(pwd) "$1" /usr/bin
+		"$1" 'quoted text' test test ${HOME} 'quoted text'
+"$1" readonly sed awk --verbose
+	${HOME} --verbose ${HOME} && local cd then 2>/dev/null
+		2>/dev/null echo $(pwd) sed 2>/dev/null --verbose
+x=1 $(pwd) cd done printf
+	| echo -eu 'quoted text' sed -eu
+		"$@" printf export /usr/bin done readonly local $(pwd) 2>/dev/null x=1 sed readonly
+	| test echo echo $(pwd) 'quoted text' awk /usr/bin grep -eu $(pwd)
+then x=1 then /usr/bin readonly "$1" local
+	awk | 2>/dev/null --verbose
+test "$@" 2>/dev/null 2>/dev/null echo done
+"$@" grep 'quoted text' done test readonly readonly -eu echo readonly export
+		'quoted text' printf /usr/bin
+export grep test test local readonly
+awk | local "$1" "$@" readonly then echo cd readonly done
+		${HOME} /usr/bin "$@" export test
+/usr/bin ${HOME} then grep && done "$@" |
+echo done 'quoted text' then
+	x=1 -eu && grep test && awk awk local then readonly local sed
+		&& $(pwd) /usr/bin --verbose /usr/bin grep grep done | --verbose
+	'quoted text' awk ${HOME} export printf && done
+	&& 2>/dev/null --verbose echo readonly -eu export readonly | test
+	"$1" 2>/dev/null 'quoted text' ${HOME}
+	"$@" ${HOME} /usr/bin echo readonly
+echo --verbose && -eu echo -eu 2>/dev/null awk -eu
+		grep 2>/dev/null x=1 awk $(pwd) readonly /usr/bin cd
+${HOME} /usr/bin "$1" "$@" -eu &&
+		cd printf $(pwd) export && grep x=1 echo 2>/dev/null --verbose
+test "$@" | ${HOME} -eu printf done | -eu && "$1" -eu printf printf local 'quoted text'
+	printf cd $(pwd) printf local "$1" x=1 x=1 echo "$@" "$@" && && 2>/dev/null
+	export sed "$1" && x=1 "$1" --verbose --verbose x=1 $(pwd) x=1 --verbose /usr/bin
+	printf cd echo then cd grep ${HOME} 'quoted text' --verbose
+	-eu export -eu /usr/bin done grep
+'quoted text' 'quoted text' test done "$1" done 'quoted text' ${HOME}
+		2>/dev/null sed 2>/dev/null echo 2>/dev/null test local echo test
+$(pwd) ${HOME} --verbose done -eu printf printf done ${HOME} 'quoted text' x=1
+then x=1 && done "$@" echo local
+		"$@" $(pwd) && && -eu then awk test 'quoted text'
+		awk 'quoted text' export local cd grep && ${HOME}
+	awk export then done export $(pwd) "$@" "$@" readonly test cd readonly
+awk local local awk then
+		awk sed "$1" done then done export
+	awk sed cd grep 'quoted text' && ${HOME} $(pwd) grep 'quoted text'
+&& -eu test 2>/dev/null 'quoted text' | | $(pwd) -eu
+readonly grep echo printf readonly sed "$@" cd then printf
+--verbose 2>/dev/null ${HOME}
+	echo "$1" --verbose ${HOME} sed /usr/bin echo /usr/bin sed /usr/bin readonly --verbose
+test | then && printf echo sed && 2>/dev/null 'quoted text' cd
+		$(pwd) ${HOME} local sed readonly "$1" /usr/bin
+	"$1" done echo 2>/dev/null
+	--verbose then local awk local printf | | printf then local ${HOME} done | 2>/dev/null
+	'quoted text' done export "$1" grep export echo $(pwd) cd then sed awk readonly
+		&& echo printf local cd --verbose
+	printf readonly | x=1 echo
+		| echo done cd then grep --verbose export export
+		x=1 "$1" grep grep sed test done printf "$1" done | 'quoted text' test
+/usr/bin then printf awk test 'quoted text'
+sed local cd cd then cd echo --verbose | x=1 &&
+		'quoted text' "$@" ${HOME}
+readonly 'quoted text' ${HOME} --verbose
+	2>/dev/null /usr/bin sed
+		&& readonly /usr/bin ${HOME} printf --verbose
+	-eu x=1 -eu "$@" -eu "$@" 'quoted text' && sed echo then sed "$1"
+		then 'quoted text' local grep grep --verbose then ${HOME} $(pwd) echo readonly
+		cd export 2>/dev/null x=1 'quoted text' sed 'quoted text' && "$1" cd 2>/dev/null
+		test | export echo export grep --verbose local "$1" | local "$1"
+		echo echo sed 'quoted text' "$@" ${HOME} grep then && awk ${HOME} sed awk && sed
+test printf done $(pwd) "$1" --verbose sed readonly sed /usr/bin 2>/dev/null
+	| grep --verbose awk ${HOME} echo
+		"$1" local "$1" done x=1 grep then export done ${HOME} grep -eu readonly then /usr/bin
+	grep --verbose $(pwd) "$@" 2>/dev/null sed $(pwd) export 2>/dev/null -eu "$1"
+test grep -eu readonly cd && $(pwd) done 'quoted text' 'quoted text'
+	/usr/bin sed -eu "$1" grep /usr/bin sed done awk -eu &&
+		| sed cd ${HOME} export x=1 2>/dev/null echo printf sed $(pwd) printf
+		awk cd --verbose 'quoted text' readonly x=1 done --verbose grep
+		${HOME} export --verbose grep
+	2>/dev/null test cd grep then grep | export then --verbose
+		/usr/bin done "$1" grep test ${HOME} --verbose x=1 readonly
+	grep awk printf done local then && local test && awk sed $(pwd) sed ${HOME}
+awk x=1 -eu "$@" 2>/dev/null && printf export echo
+	'quoted text' -eu ${HOME} grep -eu "$@" 2>/dev/null "$@" cd export -eu
+		local && done cd "$1" export echo
+	test | $(pwd) --verbose --verbose export | readonly 'quoted text'
+		| "$@" "$1" cd readonly awk then done cd $(pwd) done "$@" then -eu ${HOME}
+		then "$1" done "$@" sed
+		test printf test $(pwd) x=1 -eu done /usr/bin
+	done readonly echo local export sed cd /usr/bin
+		test /usr/bin 2>/dev/null awk "$1" printf 'quoted text'
+		echo --verbose "$@" | --verbose
+	2>/dev/null done 'quoted text' test $(pwd) "$1"
+| awk /usr/bin "$1" done done $(pwd) "$1"
+'quoted text' done -eu local sed && done done "$@" "$1" test --verbose
+		2>/dev/null && | 2>/dev/null ${HOME} readonly cd ${HOME} local /usr/bin grep x=1
+		done x=1 --verbose sed readonly x=1 readonly readonly
+awk ${HOME} echo 2>/dev/null done --verbose "$@" done /usr/bin done
+	readonly | ${HOME} ${HOME} | echo export awk local sed sed $(pwd) awk test
+	done && --verbose test "$1" grep done cd | awk $(pwd) done 'quoted text'
+2>/dev/null export $(pwd) -eu then 'quoted text' 2>/dev/null local -eu awk $(pwd)
+	/usr/bin grep done then 'quoted text'
+test grep export "$1" test -eu cd "$@" 'quoted text'
+	"$@" sed "$@" done cd "$1" ${HOME} 2>/dev/null
+	export sed "$1" 'quoted text' echo 'quoted text'
+export awk 2>/dev/null
+-eu sed grep test local $(pwd) && cd "$1" then ${HOME} printf
+	local echo | echo echo 'quoted text' sed x=1 local 2>/dev/null
+		echo $(pwd) ${HOME} test then then cd sed grep export cd x=1 "$1" grep $(pwd)
+	| x=1 | then 'quoted text'
+		then printf "$1" "$1"
+		then $(pwd) local local echo x=1 done
+echo then && local --verbose awk -eu ${HOME} export /usr/bin
+"$@" "$1" "$1" x=1 done 2>/dev/null "$1" 'quoted text' echo "$@" export
+		/usr/bin readonly --verbose
+		"$@" && 'quoted text' awk printf 2>/dev/null
+	then readonly grep grep "$1"
+		2>/dev/null x=1 printf done
+"$@" test cd local "$@" cd cd --verbose printf $(pwd)
+		printf test sed echo "$@" x=1 && x=1 then readonly -eu 'quoted text'
+		$(pwd) local done -eu cd printf x=1 export readonly 2>/dev/null readonly
+		readonly echo "$1" $(pwd) sed -eu x=1 --verbose echo 'quoted text'
+		printf test -eu sed echo readonly 2>/dev/null "$1" "$@" sed && echo ${HOME} -eu
+	-eu /usr/bin | "$@" done 'quoted text' /usr/bin x=1 ${HOME}
+then export export "$@" "$@" -eu
+2>/dev/null export && sed export export printf 2>/dev/null "$@" /usr/bin readonly
+		&& done /usr/bin grep 'quoted text' then /usr/bin
+	"$1" /usr/bin readonly sed awk grep printf printf "$1" export && /usr/bin
+		"$@" done export awk && --verbose
+		readonly cd echo -eu && 2>/dev/null test done
+		echo then then awk awk
+grep --verbose $(pwd) x=1 "$1" ${HOME} grep done grep test --verbose then
+"$1" "$1" cd | sed $(pwd)
+	cd ${HOME} printf done ${HOME} printf x=1 local 2>/dev/null awk
+test --verbose 2>/dev/null --verbose
+		2>/dev/null cd export local grep test -eu "$1" grep
+		${HOME} printf local 2>/dev/null x=1 printf | export
+		test done 2>/dev/null |
+		/usr/bin ${HOME} awk local cd $(pwd)
+		${HOME} /usr/bin then /usr/bin -eu
+	export ${HOME} sed "$1" ${HOME} printf
+cd | -eu awk awk "$1" done
+		grep printf --verbose 'quoted text' "$@"
+		&& "$@" export sed local cd test echo --verbose grep sed 'quoted text' test |
+then "$@" 'quoted text' "$@" printf && ${HOME} printf
+		${HOME} && done 2>/dev/null /usr/bin --verbose ${HOME} /usr/bin
+		-eu && 2>/dev/null x=1 echo "$1" grep 'quoted text' sed printf ${HOME}
+		sed | then && echo local
+		grep /usr/bin && done 'quoted text'
+readonly --verbose awk
+		| printf done awk local cd echo $(pwd) 2>/dev/null 2>/dev/null
+	2>/dev/null 'quoted text' readonly echo "$1" echo x=1 then grep cd readonly
+x=1 && test | done --verbose $(pwd) | /usr/bin test sed "$@" then ${HOME}
+	sed done test local 2>/dev/null echo
+test printf done ${HOME} sed export
+		/usr/bin "$1" export "$@" readonly printf readonly /usr/bin
+		local /usr/bin readonly
+	done echo printf then 2>/dev/null
+		"$1" $(pwd) local then "$1" awk export /usr/bin
+		sed then export && then 'quoted text' readonly export 'quoted text'
+	echo sed sed "$@" --verbose
+awk grep test "$@" --verbose 2>/dev/null
+x=1 && test | "$1" done && /usr/bin grep -eu grep export
+local x=1 printf cd 2>/dev/null export
+done awk local 2>/dev/null
+	local --verbose x=1 x=1 grep awk awk --verbose done --verbose -eu && -eu awk
+		--verbose "$1" "$1" ${HOME} --verbose awk done
+		"$1" echo awk -eu sed | cd grep done local then
+"$1" /usr/bin "$@" 'quoted text' -eu export --verbose $(pwd) printf local 'quoted text'
+		readonly readonly $(pwd) readonly ${HOME} done $(pwd)
+	printf readonly -eu grep local cd "$@" then printf awk cd | -eu &&
+		/usr/bin export 2>/dev/null printf
+		then 2>/dev/null 2>/dev/null | -eu x=1 local && "$1" echo grep done -eu local
+		test | printf | awk awk x=1 2>/dev/null readonly printf
+		${HOME} grep 2>/dev/null printf grep sed
+local $(pwd) test printf 'quoted text' sed "$1" test $(pwd) ${HOME} && printf echo
+	${HOME} grep x=1 -eu 'quoted text' && ${HOME}
+local -eu sed echo ${HOME} $(pwd) grep local sed "$@"
+		x=1 cd local && local "$@" awk export -eu | cd readonly $(pwd) $(pwd)
+	done x=1 | echo "$@" printf readonly && "$1" "$1" $(pwd) && echo export
+| "$@" readonly readonly local then 'quoted text'
+	then readonly echo -eu ${HOME} 2>/dev/null
+		printf "$1" | ${HOME} echo awk --verbose && grep 2>/dev/null 'quoted text' done
+test echo "$@" export grep | 'quoted text' cd local 2>/dev/null | | done awk -eu
+		x=1 /usr/bin ${HOME} awk echo
+'quoted text' local echo test local --verbose
+	--verbose grep sed 'quoted text' awk
+${HOME} 'quoted text' test done --verbose | printf readonly cd 2>/dev/null
+		$(pwd) 2>/dev/null readonly test printf
+		--verbose | -eu cd then done 2>/dev/null "$1" sed done $(pwd)
+	cd cd export --verbose readonly printf x=1 /usr/bin export export
+		readonly $(pwd) /usr/bin --verbose cd -eu printf -eu --verbose
+		"$1" "$@" grep then -eu x=1
+x=1 'quoted text' export | awk 2>/dev/null
+		x=1 && test sed grep echo grep cd && export awk $(pwd) local -eu echo | test
+	${HOME} -eu then "$@" "$1" $(pwd) printf local $(pwd) echo -eu echo "$1" readonly
+	/usr/bin "$1" local printf awk test readonly grep awk readonly
+'quoted text' local -eu /usr/bin -eu sed "$@" done
+	"$1" --verbose && printf -eu 'quoted text'
+		&& $(pwd) 2>/dev/null /usr/bin --verbose && echo then cd then ${HOME}
+--verbose && x=1 cd x=1 done test 'quoted text' 2>/dev/null
+		| test printf --verbose -eu
+	test cd export echo cd 2>/dev/null
+		printf test --verbose done done local ${HOME} readonly 2>/dev/null
+		then 'quoted text' local printf cd 2>/dev/null /usr/bin -eu export
+${HOME} --verbose awk | "$@" x=1 done 2>/dev/null done local ${HOME} printf
+	| | x=1 "$@" cd && then $(pwd) -eu sed done 'quoted text'
+		-eu $(pwd) printf echo x=1
+		x=1 /usr/bin "$@" /usr/bin local export && -eu -eu echo sed -eu
+		2>/dev/null | "$@" grep -eu ${HOME} $(pwd) awk
+/usr/bin then | readonly then && echo ${HOME} test printf -eu echo && /usr/bin export
+		$(pwd) -eu && $(pwd) --verbose | local "$1" cd -eu awk test printf "$@"
+	-eu --verbose --verbose export x=1 done
+done local -eu "$@" 2>/dev/null cd printf readonly grep
+$(pwd) ${HOME} "$1" /usr/bin cd /usr/bin readonly
+${HOME} printf grep --verbose test $(pwd)
+	sed local test export ${HOME} test $(pwd) $(pwd) "$@" 'quoted text'
+		$(pwd) export --verbose export export test "$1" | test "$@" local cd echo done
+		x=1 grep $(pwd) -eu ${HOME} awk export 2>/dev/null 'quoted text'
+awk ${HOME} && ${HOME} 2>/dev/null export done echo cd 2>/dev/null /usr/bin
+export && && --verbose printf
+		${HOME} ${HOME} | cd "$@" echo
+	cd printf test printf
+		${HOME} "$1" echo printf awk "$1" ${HOME} sed ${HOME} grep
+	x=1 'quoted text' "$1" readonly grep -eu /usr/bin "$@" done -eu | awk && export
+${HOME} local test x=1 'quoted text'
+then export sed 2>/dev/null done then cd test
+		| 'quoted text' export cd 2>/dev/null local "$@"
+--verbose && readonly $(pwd) --verbose /usr/bin
+	export -eu done $(pwd) ${HOME} sed "$1" export "$@"
+test readonly ${HOME} | --verbose
+	awk sed -eu test echo 2>/dev/null -eu
+		printf readonly --verbose 'quoted text' 2>/dev/null
+	then 2>/dev/null --verbose export
+"$@" done sed 'quoted text' 'quoted text'
+	grep grep readonly awk -eu 'quoted text'
+	grep -eu 'quoted text'
+$(pwd) "$@" 2>/dev/null 2>/dev/null echo sed "$@" 'quoted text' "$1" awk test
+	done printf printf --verbose done sed --verbose ${HOME} "$1" $(pwd)
+/usr/bin x=1 $(pwd) sed $(pwd) && &&
+		done /usr/bin echo -eu -eu then 'quoted text'
+		printf 'quoted text' "$1" && echo
+		-eu /usr/bin then printf readonly awk | "$1" $(pwd) local sed then grep
+	-eu --verbose 2>/dev/null sed x=1 --verbose awk $(pwd) local -eu cd
+x=1 readonly /usr/bin done /usr/bin $(pwd) export local "$1" readonly
+	-eu x=1 $(pwd) local done export x=1 x=1 grep awk $(pwd) /usr/bin
+	2>/dev/null test 2>/dev/null "$@" "$@"
+		| -eu printf -eu local test -eu grep grep cd echo 'quoted text' /usr/bin "$1" awk
+then printf then && awk
+cd export 2>/dev/null grep
+2>/dev/null sed test awk && "$@"
+		| grep $(pwd) test $(pwd) -eu | printf grep grep 'quoted text'
+printf 2>/dev/null x=1 | -eu awk x=1 "$1" /usr/bin "$@" /usr/bin test
+		/usr/bin && "$@" --verbose
+	x=1 --verbose readonly sed ${HOME} ${HOME}
+local $(pwd) sed grep sed test readonly
+awk echo awk cd "$@" export cd
+	--verbose "$@" ${HOME} cd ${HOME} export -eu /usr/bin "$1" /usr/bin export
+	readonly test done "$@" sed --verbose awk echo && readonly
+grep "$@" 'quoted text' 2>/dev/null
+		then grep grep 2>/dev/null
+test awk --verbose ${HOME} done test export /usr/bin grep
+then x=1 | readonly readonly cd | --verbose
+		-eu readonly done grep echo then test 'quoted text' export "$1" 2>/dev/null
+	-eu sed local -eu 2>/dev/null
+		x=1 'quoted text' export printf local 'quoted text'
+${HOME} 2>/dev/null sed cd grep test 2>/dev/null printf cd export
+readonly x=1 local 2>/dev/null | "$@" grep grep /usr/bin then 2>/dev/null
+		--verbose x=1 test x=1 --verbose
+		done "$@" awk printf 2>/dev/null export 'quoted text' export -eu /usr/bin done
+sed --verbose then then then export sed 'quoted text'
+		echo /usr/bin cd local cd x=1 x=1 "$@" awk ${HOME} echo | x=1 'quoted text'
+	/usr/bin export --verbose 'quoted text' then sed x=1 cd /usr/bin && sed --verbose
+	-eu x=1 2>/dev/null then test awk ${HOME}
+		grep readonly test "$@" --verbose
+${HOME} x=1 x=1 2>/dev/null printf test done echo
+	awk --verbose | test echo ${HOME} $(pwd) awk -eu done export
+cd -eu grep then | -eu /usr/bin $(pwd)
+x=1 test ${HOME} -eu grep /usr/bin awk echo 'quoted text' 2>/dev/null
+		'quoted text' $(pwd)
+		--verbose echo export && /usr/bin $(pwd) && then
+grep local ${HOME} -eu "$1" readonly sed /usr/bin
+then /usr/bin | "$@" ${HOME}
+	local then 'quoted text' export done $(pwd) -eu 'quoted text'
+		readonly ${HOME} $(pwd) | test | "$@" export /usr/bin "$@" sed
+		export && export 2>/dev/null cd 'quoted text' local echo done 2>/dev/null "$@"
+		local readonly && done awk grep $(pwd) "$@" printf printf cd /usr/bin readonly &&
+	&& then then /usr/bin 'quoted text' then echo ${HOME} "$1" "$1" 'quoted text' &&
+		awk printf --verbose awk
+		&& cd | awk | /usr/bin "$@" export readonly
+		x=1 then test grep export | 2>/dev/null sed /usr/bin local awk echo
+		/usr/bin cd 2>/dev/null ${HOME} | /usr/bin "$@" 2>/dev/null && local done test
+awk awk test then printf then
+		x=1 sed -eu then readonly
+		2>/dev/null "$@" && $(pwd)
+		local $(pwd) 'quoted text' sed printf $(pwd)
+&& cd local 2>/dev/null readonly sed local then && done test local
+x=1 test $(pwd) printf then export printf
+		$(pwd) grep echo "$@"
+		echo local export cd $(pwd) local "$1" done export | awk ${HOME} 2>/dev/null
+		${HOME} printf && test "$1" export "$1" && printf --verbose
+	--verbose x=1 awk echo -eu then echo "$1" then -eu -eu readonly
+	local "$@" && 'quoted text' printf local "$1" local ${HOME}
+		| --verbose ${HOME} awk /usr/bin
+	readonly awk 2>/dev/null echo /usr/bin
+		/usr/bin --verbose readonly done 2>/dev/null
+local test cd local 'quoted text' 'quoted text' 'quoted text' /usr/bin
+		local grep 2>/dev/null | | export
+		done -eu then "$1" && /usr/bin cd cd done sed
+done printf | done | awk "$@" /usr/bin
+		grep "$@" ${HOME} echo grep ${HOME} && printf "$@" x=1 --verbose "$@" -eu test
+		readonly -eu /usr/bin "$1" && echo
+	/usr/bin 2>/dev/null $(pwd) && x=1 echo done local ${HOME} local
+		"$@" sed sed grep "$@" cd 2>/dev/null -eu then 2>/dev/null "$1" x=1 'quoted text'
+	&& then $(pwd) export local cd then --verbose echo 'quoted text' && test
+		printf | then /usr/bin -eu printf awk then grep | echo /usr/bin test local
+'quoted text' 'quoted text' then 2>/dev/null local "$1" awk printf then
+	export export $(pwd) "$1" done ${HOME} 2>/dev/null ${HOME} done
+grep done | awk 'quoted text' awk
+	test export ${HOME} "$1" 'quoted text' | --verbose test
+		readonly 'quoted text' echo awk test $(pwd) --verbose
+readonly echo 2>/dev/null /usr/bin $(pwd) && cd "$1" && grep "$1" --verbose x=1
+	2>/dev/null --verbose test "$@" ${HOME} x=1 grep -eu sed printf
+#include c176.sh
+'quoted text' printf cd $(pwd)
+test then readonly readonly $(pwd) test then echo "$@" && printf printf
+		local && "$1" printf local --verbose /usr/bin local && awk 2>/dev/null
+&& ${HOME} "$1" printf 'quoted text' x=1 export export
+	local $(pwd) $(pwd) local echo printf test
+	2>/dev/null 2>/dev/null
+	x=1 export echo then | -eu | "$@" 'quoted text' readonly
+		&& done grep awk printf local export local export echo 2>/dev/null awk
+export | && /usr/bin ${HOME} test local 'quoted text' ${HOME} $(pwd) grep "$1"
+printf $(pwd) printf then "$1" 'quoted text'
+		then printf $(pwd) echo -eu
+		"$1" "$1" -eu printf | sed ${HOME} readonly export awk
+sed grep 'quoted text' "$1" 2>/dev/null
+		| --verbose -eu "$@" x=1 sed
+		printf /usr/bin test cd
+local grep awk "$@" /usr/bin /usr/bin -eu local "$1" local printf
+${HOME} grep sed then test x=1 grep --verbose
+x=1 ${HOME} -eu ${HOME} "$1" "$@" 'quoted text'
+	local local && sed ${HOME} | echo done | printf -eu x=1 local ${HOME}
+"$@" readonly then && awk /usr/bin
+then /usr/bin -eu 2>/dev/null $(pwd) "$1" ${HOME} export | grep sed 'quoted text'
+--verbose local --verbose /usr/bin then &&
+		echo cd "$1" /usr/bin echo
+		&& readonly ${HOME} grep ${HOME} awk && cd 2>/dev/null $(pwd) test
+	echo -eu awk $(pwd) awk $(pwd) /usr/bin | "$1" local
+	sed 2>/dev/null cd "$1" $(pwd) then --verbose
+$(pwd) readonly "$@" -eu && printf
+		then readonly grep && ${HOME} then awk -eu local 'quoted text' | | x=1 'quoted text'
+		test grep done -eu test "$@" --verbose test x=1 readonly && cd local
+		--verbose echo awk test ${HOME} done echo printf echo readonly then
+		echo printf done done local grep x=1 echo $(pwd) done /usr/bin x=1 local "$@" $(pwd)
+	echo cd /usr/bin local 'quoted text' x=1 cd readonly done ${HOME}
+	cd echo "$1" 2>/dev/null echo --verbose | $(pwd)
+		/usr/bin sed "$@" then "$@" $(pwd) -eu /usr/bin sed
+	&& | then printf local grep /usr/bin && awk 2>/dev/null printf "$1" export
+${HOME} sed done printf awk done
+	-eu -eu && "$@" --verbose
+		printf $(pwd) then readonly test awk grep test
+		grep "$@" readonly &&
+	&& | done echo -eu x=1 | 2>/dev/null x=1 "$1" echo done 'quoted text'
+		export sed $(pwd) --verbose "$@" && awk 2>/dev/null | readonly echo done
+		x=1 echo 'quoted text' test /usr/bin
+--verbose sed x=1 cd "$@" "$@" awk "$@" ${HOME} /usr/bin sed grep
+	"$@" $(pwd) local && grep -eu "$@" awk x=1 $(pwd) done done /usr/bin grep test
+		2>/dev/null "$@" "$1" 2>/dev/null test ${HOME} /usr/bin grep 2>/dev/null
+grep cd echo && grep x=1 2>/dev/null test test "$1" cd awk echo | echo export printf
+		'quoted text' "$1" test "$1" printf /usr/bin --verbose cd "$1" "$@"
+		${HOME} grep echo printf awk -eu local ${HOME} && local && then
+--verbose "$@" $(pwd) export sed /usr/bin ${HOME}
+	awk test awk local export echo && --verbose
+	x=1 'quoted text' --verbose then | sed sed grep x=1 test
+$(pwd) "$@" local grep | echo local readonly then
+	| readonly -eu ${HOME} then
+$(pwd) && sed local "$@"
+export local | x=1 local printf echo local /usr/bin then
+		${HOME} cd export then --verbose grep "$@" 'quoted text' x=1
+	"$@" test grep then cd "$1" test readonly
+	cd ${HOME} echo awk printf --verbose done done readonly local | local 2>/dev/null
+		&& x=1 then test printf then x=1 then then awk --verbose x=1 ${HOME}
+		2>/dev/null | "$@" -eu then | $(pwd) /usr/bin --verbose
+		export sed /usr/bin readonly -eu 2>/dev/null awk x=1 echo --verbose
+cd ${HOME} x=1 printf | 'quoted text' 2>/dev/null local cd | 'quoted text'
+grep readonly ${HOME} readonly
+		2>/dev/null test && readonly test
+"$@" ${HOME} readonly -eu echo x=1 $(pwd) 'quoted text' readonly printf
+		${HOME} cd export | sed 2>/dev/null
+x=1 $(pwd) 'quoted text' sed test /usr/bin ${HOME} 2>/dev/null
+	"$@" readonly $(pwd) local "$@" -eu /usr/bin export readonly
+	awk /usr/bin && awk done
+		-eu --verbose local 'quoted text' ${HOME} sed printf "$@" /usr/bin "$1" local sed
+		/usr/bin sed && 'quoted text' then local readonly
+		readonly | /usr/bin cd 2>/dev/null export
+test then 'quoted text' awk "$@" grep 2>/dev/null sed -eu x=1 readonly | local
+		done awk $(pwd) cd grep "$1" printf readonly "$@"
+	done 2>/dev/null awk printf grep "$@" -eu local "$@" && "$@" --verbose readonly
+'quoted text' "$1" 2>/dev/null sed $(pwd) grep
+	/usr/bin | 'quoted text' test sed awk test awk test 2>/dev/null local
+		--verbose ${HOME} readonly
+2>/dev/null -eu "$@" --verbose "$@" -eu 2>/dev/null
+		echo test /usr/bin "$@" ${HOME} echo sed | $(pwd) awk printf
+		"$@" $(pwd) $(pwd) 'quoted text' echo then sed echo readonly
+2>/dev/null echo done local && done sed grep local -eu $(pwd)
+		done /usr/bin grep -eu awk printf
+		"$1" awk /usr/bin awk cd cd
+		'quoted text' done done test -eu 'quoted text' done ${HOME} | x=1
+grep $(pwd) local /usr/bin | "$@" 'quoted text'
+"$1" "$1" export readonly ${HOME} then echo local export
+		| "$1" readonly then "$@" local /usr/bin done 2>/dev/null
+awk && -eu then sed test echo $(pwd)
+		"$1" -eu local awk export /usr/bin export cd $(pwd) printf awk
+"$@" | export 2>/dev/null local sed -eu && grep $(pwd) /usr/bin grep
+	grep then 2>/dev/null printf
+	then readonly grep --verbose 'quoted text' 2>/dev/null echo x=1 sed
+--verbose export readonly export done test /usr/bin
+	-eu readonly -eu && -eu cd -eu | awk done echo 'quoted text'
+	printf | export $(pwd) echo 2>/dev/null
+		grep export 'quoted text' "$1" 'quoted text' sed done then
+		test sed cd && ${HOME} grep | awk
+"$@" awk readonly grep export local
+	$(pwd) ${HOME} printf sed export then sed ${HOME}
+		--verbose then done --verbose
+	test sed done x=1 "$@" $(pwd) --verbose --verbose
+cd local grep | cd readonly sed && then 2>/dev/null local
+	--verbose $(pwd) then local $(pwd) local test "$1" grep done
+	&& 'quoted text' export "$@" local test $(pwd)
+		2>/dev/null 2>/dev/null then readonly printf cd && test awk
+2>/dev/null --verbose export 'quoted text' test ${HOME} local "$1" 2>/dev/null
+	printf grep ${HOME} test "$1" "$1" $(pwd) echo $(pwd) && readonly sed test &&
+		"$@" readonly readonly
+	-eu $(pwd) local /usr/bin "$@" echo "$1" 2>/dev/null
+		readonly sed then 'quoted text' --verbose x=1 grep done --verbose done grep then
+	&& cd /usr/bin 'quoted text' 'quoted text' grep -eu && cd done local done | sed
+		cd export | printf && "$@" grep awk export && --verbose readonly
+		$(pwd) done echo grep ${HOME} $(pwd)
+/usr/bin ${HOME} echo then "$@" ${HOME} printf grep local
+	&& then awk cd 'quoted text' grep
+	sed $(pwd) /usr/bin local echo "$1" --verbose && "$@" printf printf
+	x=1 cd ${HOME} "$1" readonly ${HOME} "$1" "$@" printf done
+then done cd awk export && test printf &&
+		export awk test "$1" --verbose "$1" readonly echo sed "$@"
+cd | readonly cd sed cd sed
+		grep readonly test && -eu
+done -eu $(pwd) x=1 ${HOME} printf readonly -eu && export x=1 done "$@"
+	${HOME} $(pwd) local then --verbose done && | x=1 "$@" awk 'quoted text'
+		export sed echo awk ${HOME} sed cd 'quoted text'
+		readonly readonly ${HOME} grep "$@" -eu -eu test grep $(pwd) /usr/bin
+	--verbose awk printf cd "$@" x=1 -eu x=1 export readonly echo local 2>/dev/null
+	test local export awk 'quoted text' | && x=1 export
+		sed $(pwd) --verbose "$@" /usr/bin /usr/bin awk && 'quoted text' 'quoted text'
+	"$@" --verbose -eu && readonly local /usr/bin /usr/bin
+	--verbose 2>/dev/null sed "$1" 'quoted text' test $(pwd) x=1 ${HOME}
+		/usr/bin done awk 'quoted text' export echo grep --verbose awk && cd
+	readonly echo cd printf && done | echo 'quoted text' readonly 'quoted text'
+export /usr/bin test printf done then -eu echo 'quoted text' 2>/dev/null
+		printf awk x=1 echo awk --verbose && && "$@" $(pwd) -eu grep awk done x=1
+		then $(pwd) $(pwd) awk readonly
+	done local test then test -eu --verbose awk test x=1 && export echo
+x=1 done --verbose test "$1" then cd grep awk echo 2>/dev/null readonly grep $(pwd)
+		'quoted text' grep ${HOME}
+		local printf ${HOME} done cd --verbose "$1" sed export x=1 echo -eu done ${HOME}
+-eu -eu x=1 done 'quoted text' "$@" x=1 $(pwd)
+x=1 then grep --verbose test "$@" "$@" export x=1 $(pwd) done sed echo local
+| awk -eu "$1" echo awk 'quoted text'
+		readonly cd test | test && printf printf
+		-eu $(pwd) ${HOME} grep
+local --verbose sed -eu local cd && "$@" && ${HOME} --verbose sed awk | echo
+| 'quoted text' sed awk "$@" /usr/bin done
+		'quoted text' ${HOME} awk cd printf && export x=1 done test
+	then /usr/bin test $(pwd) readonly 2>/dev/null --verbose local
+	grep | "$@" sed test readonly sed test ${HOME} local sed
+		${HOME} -eu echo export done ${HOME} 2>/dev/null 'quoted text' sed
+		awk -eu local /usr/bin local -eu awk | 2>/dev/null
+		then "$1" -eu local export sed "$1" $(pwd) local grep done "$@"
+		/usr/bin | grep && printf echo awk printf | 2>/dev/null
+		$(pwd) /usr/bin awk grep | cd
+	cd then --verbose cd 'quoted text' sed 'quoted text' test echo --verbose | "$1"
+	readonly $(pwd) cd 'quoted text'
+readonly local "$@" done then printf done && | export "$1" then test test cd export
+	'quoted text' $(pwd) ${HOME} cd /usr/bin | then awk done
+	| 2>/dev/null printf -eu
+${HOME} x=1 2>/dev/null && local printf cd /usr/bin && "$1"
+	test 2>/dev/null echo done && /usr/bin 2>/dev/null && export
+readonly grep 'quoted text' 2>/dev/null "$1" $(pwd) -eu test grep | awk
+	sed "$@" && 'quoted text' "$@" 2>/dev/null -eu $(pwd) awk cd x=1 $(pwd)
+	| && readonly /usr/bin /usr/bin
+echo --verbose /usr/bin 'quoted text' awk readonly
+		-eu "$1" x=1 -eu test sed 'quoted text' "$1" ${HOME} test -eu test
+| grep grep ${HOME} readonly "$@" $(pwd) ${HOME} && printf
+"$1" --verbose "$1" "$@" x=1 sed "$1" readonly
+'quoted text' $(pwd) --verbose -eu x=1
+	done "$@" ${HOME} $(pwd) -eu x=1 test "$1" sed
+		--verbose then $(pwd) readonly grep "$@" 2>/dev/null
+	x=1 -eu "$@" && export echo | export ${HOME} ${HOME} awk 2>/dev/null "$1" "$@"
+		'quoted text' "$1" done -eu readonly then export grep test x=1 done | "$1"
+awk && test test ${HOME} && -eu grep local ${HOME}
+		printf /usr/bin "$@" then awk -eu 'quoted text' "$1" awk | | test
+		sed ${HOME} cd test -eu readonly --verbose --verbose awk
+	local 'quoted text' then x=1 /usr/bin $(pwd)
+local "$@" 2>/dev/null -eu done test readonly
+then ${HOME} && done echo 2>/dev/null printf cd local done
+	done x=1 x=1 /usr/bin local test
+		${HOME} cd grep local export then
+		${HOME} --verbose /usr/bin local cd done then -eu readonly export local -eu "$@"
+	$(pwd) | grep readonly /usr/bin echo $(pwd) && done awk | | cd
+awk export --verbose cd printf then 'quoted text'
+then "$@" 'quoted text' | test /usr/bin cd "$@" local ${HOME} --verbose x=1 echo
+		$(pwd) "$1" grep "$1" sed -eu done --verbose echo
+-eu printf $(pwd) 'quoted text' export export x=1 2>/dev/null sed readonly
+		x=1 sed 2>/dev/null 'quoted text' && "$@" && then 'quoted text'
+grep $(pwd) echo --verbose grep && $(pwd) echo local local grep &&
+'quoted text' readonly export "$@" 2>/dev/null echo then "$@"
+		| cd 2>/dev/null then test printf readonly ${HOME} sed 2>/dev/null $(pwd)
+	then -eu --verbose test /usr/bin then local readonly | "$1" | -eu x=1 --verbose
+${HOME} test /usr/bin "$@" && ${HOME}
+		awk sed "$1" "$1" 'quoted text' /usr/bin echo /usr/bin $(pwd) test --verbose
+	readonly --verbose 2>/dev/null "$1" done -eu grep "$1" export
+	${HOME} export done then sed printf grep local local cd test
+cd x=1 --verbose test export echo "$1" 2>/dev/null test export sed
+		awk then sed -eu $(pwd) cd "$1" | "$1" grep "$@" cd x=1 local awk -eu
+done | /usr/bin test -eu awk
+-eu /usr/bin cd 'quoted text' "$1" local && readonly
+		/usr/bin echo && "$1" 'quoted text' printf && done printf awk
+readonly echo then --verbose
+	sed 'quoted text' echo
+	2>/dev/null grep awk then 'quoted text' sed test /usr/bin
+"$1" "$@" --verbose | --verbose echo test awk -eu awk --verbose done echo printf
+'quoted text' -eu 'quoted text' printf -eu then &&
+readonly 'quoted text' printf | sed 2>/dev/null 2>/dev/null grep cd then then grep
+local && awk export test cd sed /usr/bin local sed echo | -eu $(pwd) /usr/bin
+		awk 2>/dev/null | sed sed "$@" grep done 2>/dev/null grep awk 'quoted text'
+		sed awk local | && -eu /usr/bin "$1" x=1 2>/dev/null /usr/bin $(pwd) ${HOME} cd
+echo local "$@" -eu "$@" cd $(pwd)
+	echo -eu readonly "$@" 2>/dev/null -eu sed | $(pwd) x=1 awk
+	local x=1 x=1 awk test
+	echo && --verbose local "$@" && /usr/bin 2>/dev/null 2>/dev/null
+		"$1" grep 'quoted text'
+	x=1 printf echo then sed local "$1" $(pwd) done echo x=1
+-eu && x=1 cd readonly /usr/bin local cd "$1" readonly
+${HOME} ${HOME} "$@" readonly $(pwd)
+--verbose printf cd && printf 'quoted text' cd ${HOME} 'quoted text'
+		2>/dev/null /usr/bin export done 2>/dev/null x=1 echo
+		&& done "$1" /usr/bin local readonly $(pwd) && export export | echo
+/usr/bin then export awk $(pwd)
+	x=1 grep "$@" cd ${HOME} 'quoted text' test ${HOME} -eu ${HOME}
+	then 'quoted text' /usr/bin echo | 'quoted text' printf
+/usr/bin readonly "$1" done then cd local "$1" "$1" grep --verbose
+test 2>/dev/null echo | -eu then 2>/dev/null
+"$1" readonly $(pwd) cd 2>/dev/null done local grep echo "$1" done
+/usr/bin local export x=1
+		/usr/bin grep export /usr/bin
+	test then /usr/bin "$@" awk sed /usr/bin /usr/bin $(pwd)
+grep export then echo sed && -eu | awk grep "$1" | grep grep then -eu x=1 sed
+x=1 sed awk 2>/dev/null cd then then export
+		x=1 x=1 test 'quoted text' --verbose "$1" local local local done $(pwd)
+done $(pwd) test "$@" | sed --verbose "$@" grep grep test grep printf
+"$@" | awk "$1" echo $(pwd) local | then printf "$@" readonly 2>/dev/null
+		cd "$@" local grep ${HOME} | sed
+	"$1" 'quoted text' -eu cd $(pwd) cd | export
+	readonly test cd 2>/dev/null | -eu printf && done && cd 'quoted text' grep test
+	${HOME} | echo -eu 2>/dev/null -eu sed x=1 && $(pwd) echo /usr/bin --verbose
+	readonly readonly sed | grep 'quoted text'
+${HOME} x=1 && printf
+cd --verbose export done -eu 2>/dev/null export readonly $(pwd)
+	export then grep sed ${HOME} readonly "$@"
+--verbose readonly /usr/bin /usr/bin then cd "$@" $(pwd) then | "$1" "$1" echo
+	readonly "$1" then cd cd $(pwd) sed -eu && /usr/bin x=1 x=1 sed | local
+done $(pwd) --verbose echo --verbose awk local --verbose 2>/dev/null "$@" &&
+readonly --verbose "$@"
+		2>/dev/null then 2>/dev/null
+	cd ${HOME} 'quoted text' 2>/dev/null sed test test
+		awk -eu ${HOME} 2>/dev/null then local 2>/dev/null
+	| local 'quoted text' 2>/dev/null && | | "$1" printf local 'quoted text'
+		awk --verbose cd "$@" printf ${HOME} test /usr/bin awk
+	export /usr/bin --verbose readonly $(pwd) "$@" "$1"
+		readonly test --verbose done cd printf "$1" x=1 cd export 2>/dev/null
+cd "$@" printf printf done readonly 2>/dev/null && 2>/dev/null
+		printf then --verbose local x=1 awk printf echo test sed grep /usr/bin
+		cd printf /usr/bin grep cd cd test "$1" export awk && awk cd
+		test 2>/dev/null "$1" && sed -eu "$1" awk
+		&& then cd cd printf -eu ${HOME} 2>/dev/null
+printf $(pwd) local local
+	"$1" export --verbose cd $(pwd)
+	awk done --verbose x=1 $(pwd) printf awk cd printf 'quoted text' && --verbose
+		&& grep $(pwd) x=1 echo $(pwd) sed 2>/dev/null awk test local 2>/dev/null
+local sed done done then local "$1" readonly
+		test printf local 'quoted text' /usr/bin done
+test "$1" done printf printf done readonly
+	/usr/bin /usr/bin cd echo x=1 grep 2>/dev/null x=1
+	'quoted text' | $(pwd) --verbose "$@" "$@" done export
+export echo | echo then export | /usr/bin local
+		sed done x=1 -eu cd --verbose export /usr/bin then sed done done done awk
+'quoted text' local readonly awk then export 2>/dev/null
+| printf grep /usr/bin readonly test
+	2>/dev/null "$1" /usr/bin && readonly 'quoted text' "$@"
+	&& $(pwd) echo echo cd test 'quoted text'
+	"$@" export 'quoted text' 2>/dev/null awk readonly
+printf 2>/dev/null | export -eu cd 'quoted text' readonly
+	2>/dev/null ${HOME} echo done sed printf local awk printf ${HOME} --verbose
+		"$1" | then awk -eu cd 2>/dev/null /usr/bin -eu readonly then "$@" ${HOME}
+-eu readonly local awk -eu export test $(pwd)
+x=1 --verbose 'quoted text' done grep --verbose
+${HOME} | sed then sed
+	${HOME} 2>/dev/null && 2>/dev/null "$1"
+	grep readonly export readonly "$@" grep && -eu | printf 'quoted text' 'quoted text'
+		printf done echo "$@" && done | -eu "$1" printf readonly readonly printf
+echo -eu then cd export 'quoted text' &&
+	sed local sed 2>/dev/null x=1 local
+		cd "$1" sed then 'quoted text' then local
+"$1" local sed "$1" x=1 sed cd "$1" echo then local --verbose then
+	-eu test | 'quoted text' $(pwd) echo x=1 "$@" /usr/bin readonly readonly then ${HOME}
+"$1" $(pwd) readonly printf then -eu export
+	"$1" grep echo && echo grep test awk -eu grep 'quoted text'
+	printf 2>/dev/null local -eu /usr/bin printf echo
+	readonly && local $(pwd) readonly ${HOME} $(pwd) ${HOME} export /usr/bin
+	printf --verbose | printf && /usr/bin
+		then export awk x=1 echo export -eu --verbose
+	sed x=1 cd && local --verbose --verbose 'quoted text' /usr/bin cd
+		x=1 sed test x=1 "$1" -eu test /usr/bin
+		then awk export && ${HOME} --verbose ${HOME} 2>/dev/null
+	$(pwd) readonly export "$@" grep printf && awk grep export grep sed readonly 2>/dev/null
+	printf sed export sed grep cd local && "$@" grep "$@"
+		test grep readonly echo x=1 sed "$@" /usr/bin x=1 ${HOME} -eu "$@" readonly $(pwd)
+		readonly grep | $(pwd) /usr/bin -eu sed $(pwd)
+"$1" export local export 2>/dev/null local export done 2>/dev/null
+		printf awk && 'quoted text'
+awk "$@" x=1 "$1" readonly && done sed /usr/bin then export --verbose && cd
+		awk --verbose cd local /usr/bin awk "$@" "$@" done then 2>/dev/null
+local 'quoted text' $(pwd) then cd "$1" 'quoted text' cd ${HOME} | sed | x=1 -eu
+$(pwd) -eu x=1 done && ${HOME} echo x=1
+		$(pwd) ${HOME} sed echo "$1" test | ${HOME} export readonly x=1 local ${HOME} local
+-eu local ${HOME} done cd ${HOME}
+	x=1 cd --verbose printf local local readonly grep && printf test $(pwd)
+	"$1" echo 2>/dev/null ${HOME} cd local awk readonly && $(pwd) local echo | /usr/bin
+done cd --verbose "$1" printf 'quoted text' x=1 awk
+		readonly /usr/bin -eu test $(pwd) x=1 x=1 echo --verbose awk $(pwd) $(pwd) export
+		local "$1" /usr/bin local 2>/dev/null export ${HOME}
+	"$1" $(pwd) ${HOME} sed "$@" $(pwd) printf readonly awk
+cd then done x=1 test 2>/dev/null
+cd 2>/dev/null x=1 then local then then awk 2>/dev/null
+| export readonly 'quoted text'
+		export ${HOME} && "$@" 'quoted text' grep test "$@" test | test 'quoted text'
+		awk printf "$1" printf && && | --verbose --verbose done export awk
+	printf local then "$1" then readonly sed test
+		readonly sed | export --verbose ${HOME}
+		grep test grep -eu done x=1 2>/dev/null
+		export echo cd x=1 awk
+		echo awk x=1 export echo -eu printf 'quoted text' export cd cd awk
+		--verbose 'quoted text' test
+-eu printf then -eu 2>/dev/null
+test /usr/bin awk cd "$1" done -eu x=1 "$@" readonly
+	/usr/bin test -eu "$1" printf done 'quoted text' "$1" done test then
+	done 'quoted text' cd readonly grep -eu readonly
+done printf "$@" x=1 2>/dev/null printf
+		sed export local -eu 'quoted text' local
+awk echo && echo echo /usr/bin export test echo --verbose sed cd &&
+		| -eu -eu awk awk --verbose
+		done "$1" "$1" x=1 | sed done then printf $(pwd) 2>/dev/null
+done ${HOME} readonly ${HOME} done then --verbose $(pwd) "$1" x=1
+		echo /usr/bin readonly sed readonly $(pwd) --verbose
+	cd -eu x=1 x=1 "$1" readonly printf export ${HOME} export
+	export $(pwd) "$@" sed x=1 then echo "$1" "$@" awk done awk
+	'quoted text' | readonly && | /usr/bin
+echo export echo then "$1" readonly ${HOME} $(pwd) local "$1" -eu "$1"
+2>/dev/null local /usr/bin "$@" local export awk local
+	/usr/bin 'quoted text' done "$1" && | --verbose then x=1 "$@"
+${HOME} 2>/dev/null ${HOME} "$1" test
+		&& --verbose grep /usr/bin 'quoted text' --verbose && /usr/bin
+	then local local printf
+		'quoted text' echo /usr/bin printf "$@" "$1" echo "$1" $(pwd)
+		test printf sed local done echo 2>/dev/null
+| $(pwd) x=1 printf local x=1 sed --verbose
+'quoted text' /usr/bin /usr/bin x=1 test
+done /usr/bin && echo done
+		cd then test sed export ${HOME} done ${HOME} --verbose local awk sed awk
+-eu 2>/dev/null && && && "$1" 2>/dev/null -eu test test ${HOME}
+		printf 2>/dev/null x=1 ${HOME} --verbose
+		done done export 2>/dev/null cd sed cd "$1" awk ${HOME}
+		test cd grep "$1" "$@" | grep printf echo local cd 'quoted text'
+sed | --verbose echo ${HOME}
+		local then grep 2>/dev/null -eu done -eu $(pwd) export echo
+	then awk 'quoted text' $(pwd) |
+"$1" awk 2>/dev/null done done then "$1" cd /usr/bin sed --verbose | done
+		echo grep $(pwd) --verbose /usr/bin readonly $(pwd)
+		--verbose -eu cd sed "$@" "$1" cd "$1" done done awk | done x=1 && readonly "$1"
+export ${HOME} cd ${HOME} printf done /usr/bin export && $(pwd) "$1" test
+		echo x=1 then done "$@" printf local done sed x=1 -eu -eu "$1" 2>/dev/null
+--verbose readonly --verbose "$@" x=1 grep echo grep | printf test
+		x=1 x=1 "$@" x=1 --verbose "$@" awk "$1" echo printf grep awk printf readonly
+	&& | then then --verbose test && awk sed then grep /usr/bin | $(pwd) "$1" --verbose
+		sed | 2>/dev/null grep && echo && 2>/dev/null sed test cd /usr/bin awk readonly
+x=1 echo sed echo then test readonly
+printf --verbose && 2>/dev/null grep
+grep grep x=1 awk test | "$1" $(pwd) ${HOME} x=1 --verbose && $(pwd) test
+	x=1 "$1" "$1" cd x=1 grep | $(pwd) cd cd readonly
+cd x=1 readonly | && done ${HOME} local sed --verbose 2>/dev/null
+		--verbose | -eu -eu cd printf
+local sed ${HOME} 2>/dev/null | "$1" | $(pwd) "$@" local export "$@"
+	-eu | "$1" "$1" ${HOME} | local "$@" sed
+sed && done readonly cd x=1
+	--verbose awk grep awk | local
+		-eu $(pwd) printf awk && && done export awk done local local
+sed -eu test test "$1" "$@" grep readonly --verbose local cd printf "$1"
+-eu /usr/bin printf then printf
+	&& sed "$@" test x=1 printf done 2>/dev/null ${HOME} export 'quoted text'
+cd then sed test "$@" export "$@" cd "$@" -eu cd
+	awk readonly x=1 x=1 /usr/bin x=1 export test
+		test local sed | printf "$@" done local --verbose printf "$@" then
+then readonly test 2>/dev/null "$@" $(pwd) cd | cd echo ${HOME}
+		/usr/bin --verbose export awk --verbose
+"$@" awk sed local "$1" readonly
+		sed 2>/dev/null "$@" test cd cd
+	'quoted text' done -eu test --verbose
+	'quoted text' -eu -eu "$1" test "$1" 2>/dev/null
+$(pwd) sed && then grep --verbose
+		x=1 x=1 "$@" echo readonly readonly ${HOME} 'quoted text' export readonly
+		| local ${HOME} cd /usr/bin export
+x=1 readonly $(pwd) awk
+		'quoted text' 'quoted text' then /usr/bin --verbose
+echo export "$1" then --verbose local grep 'quoted text' ${HOME} cd done "$@"
+x=1 done sed readonly printf --verbose
+	${HOME} sed -eu echo 'quoted text' echo 'quoted text' readonly
+then test echo then "$1" -eu | --verbose $(pwd) echo ${HOME} && done
+		2>/dev/null && readonly test sed cd --verbose "$1" | printf
+'quoted text' ${HOME} echo cd -eu echo sed readonly test
+		"$1" done echo --verbose -eu
+		cd | grep ${HOME} --verbose $(pwd) -eu 2>/dev/null readonly -eu export
+	echo sed then printf readonly echo | /usr/bin local
+export ${HOME} | $(pwd) local
+	readonly cd printf echo echo then $(pwd) sed -eu 'quoted text' cd $(pwd) 2>/dev/null
+then | printf && ${HOME} echo x=1 "$@" 2>/dev/null /usr/bin
+	$(pwd) /usr/bin 'quoted text'
+		x=1 sed local readonly
+		echo --verbose -eu 'quoted text'
+${HOME} $(pwd) done export -eu 'quoted text' $(pwd) grep -eu /usr/bin
+		"$1" && export /usr/bin $(pwd) local awk -eu --verbose local | && /usr/bin --verbose
+2>/dev/null done local printf readonly 'quoted text' then 'quoted text'
+		"$@" test test /usr/bin export 2>/dev/null
+		--verbose export -eu echo printf
+		grep "$1" awk export sed ${HOME} && test echo
+-eu echo "$1" 'quoted text' "$1" 2>/dev/null export -eu /usr/bin
+cd test local --verbose 2>/dev/null done $(pwd) "$@" test -eu printf --verbose 'quoted text'
+'quoted text' grep sed cd printf test
+local /usr/bin $(pwd) 2>/dev/null
+		--verbose cd $(pwd) "$@" then test /usr/bin test
+cd printf awk x=1 ${HOME}
+	local -eu "$1" sed local awk echo
+	x=1 /usr/bin -eu "$1" &&
+	${HOME} "$1" "$@" 'quoted text' local /usr/bin cd | echo
+	cd && | awk "$1" then "$1" sed awk cd &&
+	then then x=1 $(pwd) local ${HOME}
+		"$@" $(pwd) readonly local 2>/dev/null "$1" 'quoted text' echo && -eu
+	'quoted text' echo grep readonly awk --verbose export
+printf grep $(pwd) /usr/bin ${HOME}
+		then cd export test cd ${HOME}
+		local "$@" sed done /usr/bin grep 'quoted text' printf $(pwd)
+		cd | awk export awk && grep sed done then awk test local then echo x=1
+	--verbose printf "$@" "$1" -eu ${HOME} "$@" -eu sed /usr/bin
+sed local done export x=1 "$@" /usr/bin "$@" local "$1" readonly
+$(pwd) export local then done | --verbose awk
+	-eu test grep echo -eu printf done x=1 x=1 printf local test done cd local
+		export $(pwd) | /usr/bin ${HOME} echo
+		-eu | readonly sed echo printf
+export echo "$1" done
+	then then sed "$1" "$@" readonly x=1 --verbose &&
+${HOME} | -eu x=1 --verbose readonly test -eu echo "$1" $(pwd) ${HOME}
+	grep test ${HOME} && export awk sed awk "$@" readonly
+		test echo | | cd $(pwd) echo "$1" awk 'quoted text' 'quoted text' "$@" readonly
+		echo readonly printf done && "$@" export --verbose echo sed 2>/dev/null awk 2>/dev/null
+	readonly export printf local ${HOME} -eu printf readonly cd "$1" local "$@" "$1"
+then local /usr/bin local export cd ${HOME} "$1" printf ${HOME} local | then
+printf test test --verbose && export awk ${HOME} done && "$1"
+	--verbose awk --verbose done $(pwd) | x=1 awk -eu done awk
+x=1 2>/dev/null sed export
+		| 'quoted text' printf "$@" echo "$@" echo sed
+	grep echo "$1" "$1" readonly && export ${HOME} then awk /usr/bin
+		printf readonly sed "$@" grep local printf | | ${HOME} awk sed -eu ${HOME} awk
+2>/dev/null ${HOME} | done --verbose test cd -eu
+"$@" ${HOME} echo --verbose echo
+		export -eu "$@" | /usr/bin x=1 "$@" | cd then export "$@" 2>/dev/null ${HOME}
+	sed $(pwd) /usr/bin readonly local 'quoted text' test test
+/usr/bin /usr/bin 2>/dev/null sed local 'quoted text'
+	done ${HOME} awk /usr/bin printf done awk cd sed printf sed /usr/bin $(pwd)
+test "$@" cd | sed x=1 'quoted text' "$@" --verbose done && echo export sed
+		sed && ${HOME} awk sed test test
+"$@" export 2>/dev/null /usr/bin $(pwd) $(pwd) ${HOME}
+		cd "$1" && local "$1" readonly | awk done --verbose $(pwd) printf /usr/bin --verbose
+		done | x=1 | /usr/bin local export export printf
+		test export && && export test sed test x=1 "$@" | && x=1 | echo sed $(pwd) $(pwd)
+	cd export test echo echo -eu then --verbose 2>/dev/null "$@" "$1"
+		-eu echo local grep cd echo -eu echo awk echo echo export
+	"$1" | export "$1" 2>/dev/null
+		/usr/bin then $(pwd) ${HOME} sed "$@" /usr/bin "$1" grep then x=1 "$1" /usr/bin
+		/usr/bin done -eu grep awk printf readonly --verbose
+		local && export cd "$1" ${HOME} awk -eu
+		sed /usr/bin ${HOME} "$@"
+readonly ${HOME} ${HOME} --verbose x=1 printf then
+	test done 2>/dev/null $(pwd) grep 2>/dev/null export sed
+printf printf awk --verbose x=1 $(pwd)
+		awk /usr/bin sed echo awk export "$1" "$1" test echo cd
+awk printf /usr/bin done --verbose test
+	2>/dev/null 2>/dev/null && -eu "$1" | then export readonly done -eu $(pwd)
+	/usr/bin && cd x=1 "$1" awk | printf
+	sed "$@" && local | then 2>/dev/null 'quoted text' grep && 2>/dev/null
+	readonly | | "$1" -eu x=1 "$1"
+		| "$@" && $(pwd) done readonly echo local x=1
+$(pwd) local ${HOME} -eu
+	local /usr/bin /usr/bin grep local
+"$@" test /usr/bin "$1" 'quoted text' done then /usr/bin printf ${HOME}
+	awk awk "$@" ${HOME} "$@" done && | cd
+		test x=1 export 'quoted text'
+x=1 | ${HOME} awk | done sed awk then | "$1" awk export test
+	then awk "$@" | $(pwd) test awk 2>/dev/null && 'quoted text' x=1 awk
+x=1 cd printf awk printf sed ${HOME} grep x=1 --verbose
+	"$@" done "$1" x=1 then 2>/dev/null --verbose 'quoted text' && cd then
+		'quoted text' local echo x=1 echo export export "$@"
+x=1 -eu awk ${HOME} -eu done
+	/usr/bin local 2>/dev/null ${HOME} && awk 'quoted text' | /usr/bin
+	cd then | then x=1 awk --verbose | ${HOME}
+		&& test "$1" $(pwd) x=1 /usr/bin 'quoted text'
+		&& then test "$1" cd readonly awk $(pwd)
+		local ${HOME} x=1 export local done test test "$@" $(pwd) 'quoted text' 2>/dev/null
+grep /usr/bin x=1 grep 2>/dev/null $(pwd) echo export && printf x=1 grep $(pwd)
+	&& sed printf $(pwd) awk echo
+		echo --verbose | readonly awk -eu readonly "$1" cd export --verbose
+		'quoted text' awk --verbose ${HOME} /usr/bin export local "$@" && 'quoted text'
+		awk cd echo x=1 then | /usr/bin cd && export
+		awk done 2>/dev/null export then --verbose --verbose
+	then "$1" x=1 local done echo /usr/bin sed done | grep -eu
+		test export grep $(pwd) -eu 2>/dev/null awk local |
+done test local -eu echo
+		&& awk test done cd /usr/bin $(pwd) "$@" &&
+awk "$@" cd local x=1 'quoted text' -eu && awk ${HOME} then ${HOME}
+${HOME} local "$1" readonly ${HOME}
+		echo | export then --verbose awk | /usr/bin local
+	echo printf then cd local "$1" readonly cd done
+x=1 echo "$1" grep "$1" sed test $(pwd)
+		--verbose test printf /usr/bin --verbose $(pwd) cd local "$@" ${HOME}
+	done | /usr/bin "$@" awk printf done awk readonly 'quoted text'
+	awk then export printf sed echo done
+		${HOME} sed x=1 "$@" test ${HOME}
+$(pwd) done ${HOME} cd test grep then
+	grep awk export "$@" sed && grep 2>/dev/null
+	local "$@" "$1" 'quoted text' echo test | | export -eu ${HOME}
+grep -eu export 2>/dev/null 2>/dev/null
+	"$@" && echo -eu /usr/bin x=1 $(pwd) $(pwd) local -eu cd && $(pwd)
+printf sed && then test $(pwd) 'quoted text' local
+	"$@" 2>/dev/null | /usr/bin test -eu
+--verbose readonly echo x=1 readonly
+$(pwd) done done grep sed done then && -eu x=1 awk $(pwd) --verbose 'quoted text'
+		awk | done printf -eu then 2>/dev/null readonly 'quoted text'
+	printf then readonly export
+	grep done 2>/dev/null local echo
+		'quoted text' then /usr/bin export
+	test done /usr/bin && /usr/bin "$1" done
+		awk "$1" 2>/dev/null $(pwd) /usr/bin /usr/bin
+${HOME} --verbose 2>/dev/null /usr/bin
+		"$1" x=1 2>/dev/null --verbose "$1" sed readonly | -eu | local export
+	$(pwd) -eu awk && $(pwd) readonly done -eu ${HOME} 'quoted text'
+/usr/bin --verbose && $(pwd)
+		echo echo local sed 'quoted text' /usr/bin awk /usr/bin
+	| done printf local echo grep awk awk | grep then export
+done 'quoted text' grep printf then && sed "$1" 'quoted text' 'quoted text'
+--verbose -eu 2>/dev/null 2>/dev/null grep "$1" -eu 'quoted text' && | printf
+--verbose /usr/bin --verbose echo awk done 'quoted text'
+	2>/dev/null grep --verbose | "$1" $(pwd) awk export sed -eu 'quoted text' "$@"
+done readonly | then /usr/bin awk $(pwd) sed export -eu -eu
+	then "$1" "$1" | $(pwd) 2>/dev/null awk echo
+local "$1" ${HOME} x=1 --verbose sed
+	grep && readonly 2>/dev/null then | awk | done | $(pwd)
+		'quoted text' readonly 'quoted text' test cd local ${HOME} "$1" done ${HOME}
+/usr/bin export 'quoted text' x=1 $(pwd) awk then "$@" cd cd printf
+		"$1" local export x=1 /usr/bin
+	printf /usr/bin 2>/dev/null "$@"
+		local | $(pwd) awk /usr/bin "$1" && sed cd sed "$1" 2>/dev/null
+		printf awk 'quoted text' "$@" export
+	"$1" && awk readonly sed "$@" "$@"
+	"$1" then x=1 cd -eu test ${HOME} readonly test local
+	sed && then echo printf 2>/dev/null readonly ${HOME}
+'quoted text' /usr/bin cd cd test && 2>/dev/null sed ${HOME} grep local
+	local | grep "$@" -eu sed 2>/dev/null
+		2>/dev/null x=1 --verbose readonly ${HOME} 2>/dev/null 2>/dev/null
+then test | --verbose |
+		x=1 local printf 'quoted text' done test && echo printf 2>/dev/null | $(pwd)
+		--verbose export 2>/dev/null test --verbose then | then --verbose sed -eu $(pwd)
+printf "$@" "$@" test
+		sed 2>/dev/null awk local done echo
+	then echo awk -eu local 'quoted text' test "$@" | then 'quoted text' test
+	sed /usr/bin done "$@" /usr/bin test --verbose export cd 'quoted text'
+	"$@" readonly | export then $(pwd) test "$1" --verbose 2>/dev/null 2>/dev/null
+		"$@" grep echo x=1 "$@" readonly grep
+	| local $(pwd) -eu grep echo 'quoted text' local export
+2>/dev/null --verbose done
+		printf 2>/dev/null echo /usr/bin ${HOME} 'quoted text' "$@" then local -eu export
+		"$@" then cd --verbose | "$1" | 2>/dev/null
+		readonly && x=1 cd "$@" &&
+echo cd -eu readonly x=1 test export cd echo echo cd
+cd grep grep then x=1 2>/dev/null sed 2>/dev/null sed | -eu
+		x=1 x=1 printf x=1 local echo readonly
+		echo printf test cd grep "$1"
+	export 2>/dev/null test x=1 awk ${HOME} && ${HOME} done
+test "$@" test export /usr/bin /usr/bin
+		cd 2>/dev/null local --verbose 2>/dev/null x=1 ${HOME}
+echo readonly grep grep $(pwd) "$1" --verbose --verbose
+		${HOME} cd done /usr/bin "$1" cd export
+/usr/bin --verbose "$1" done
+echo && done 2>/dev/null sed sed /usr/bin 2>/dev/null done export export
+readonly | ${HOME} --verbose $(pwd)
+		x=1 "$1" done 2>/dev/null printf | --verbose x=1 && echo | ${HOME}
+		sed printf sed local x=1 export 2>/dev/null
+2>/dev/null then awk
+	cd /usr/bin test "$@" 'quoted text' 2>/dev/null | local cd x=1 readonly "$1" 'quoted text'
+	--verbose echo --verbose echo $(pwd) $(pwd)
+	sed $(pwd) then then "$@" readonly
+	$(pwd) export sed test 'quoted text' awk && /usr/bin x=1 test echo
+		| "$@" -eu cd 2>/dev/null export cd /usr/bin
+		"$1" 2>/dev/null ${HOME}
+done grep cd $(pwd) grep readonly readonly
+	${HOME} test echo 2>/dev/null cd awk "$@" printf /usr/bin $(pwd) "$@" 'quoted text'
+		"$1" then then ${HOME} x=1 ${HOME} -eu /usr/bin then export
+	awk test "$@" -eu sed done
+	cd done "$1" $(pwd) echo x=1 x=1 readonly sed
+		--verbose echo local awk
+		${HOME} 2>/dev/null done /usr/bin | printf && done
+		grep x=1 readonly echo then readonly
+		then echo cd && ${HOME} && --verbose test | && test echo /usr/bin
+	$(pwd) awk cd awk test echo x=1 -eu awk | "$@" grep $(pwd) "$@" awk
+	| 2>/dev/null readonly x=1 echo
+cd awk | echo 'quoted text' ${HOME} readonly && x=1 sed sed test export awk 2>/dev/null
+		x=1 "$1" local /usr/bin x=1 /usr/bin
+		${HOME} 2>/dev/null then local "$1"
+| local "$@" grep x=1 "$1" /usr/bin -eu printf
+	x=1 sed "$1" readonly readonly ${HOME} /usr/bin sed "$1" cd export
+	/usr/bin awk "$@" "$@" -eu
+		&& sed | 2>/dev/null echo then x=1
+		&& awk local printf -eu $(pwd) done | "$1" --verbose
+x=1 && done $(pwd) local -eu 2>/dev/null sed echo test "$1" echo
+cd --verbose grep done 2>/dev/null
+$(pwd) && 2>/dev/null -eu local x=1 'quoted text'
+		cd "$@" "$1" printf then readonly 2>/dev/null && echo readonly then printf x=1
+"$@" awk "$@" $(pwd) readonly
+/usr/bin x=1 local grep -eu | test done
+		printf 2>/dev/null ${HOME} echo && 2>/dev/null 'quoted text' done export
+/usr/bin /usr/bin readonly printf export -eu awk "$1"
+		"$1" test -eu | sed echo grep local && ${HOME} cd then grep --verbose x=1 test
+	readonly sed sed 2>/dev/null then
+	done 'quoted text' echo -eu
+	export --verbose local local then 2>/dev/null
+		"$1" awk printf 2>/dev/null $(pwd) | $(pwd) sed ${HOME}
+		/usr/bin test readonly
+echo grep ${HOME} readonly export && x=1
+	--verbose echo x=1 -eu readonly awk -eu grep grep
+sed 'quoted text' echo cd test 2>/dev/null awk printf
+	${HOME} readonly && export $(pwd) 2>/dev/null
+		awk --verbose awk --verbose readonly test echo printf then sed 2>/dev/null
+	"$@" sed ${HOME} export x=1 'quoted text' test
+		&& then && $(pwd) export 'quoted text'
+		then --verbose "$1" x=1 && awk echo test
+	"$1" /usr/bin grep ${HOME} ${HOME} printf -eu $(pwd) x=1 -eu printf echo
+"$1" "$@" "$1" 'quoted text' --verbose --verbose printf
+		done printf then printf awk sed sed ${HOME}
+local export printf grep /usr/bin ${HOME}
+		| $(pwd) readonly local local
+	readonly -eu && sed /usr/bin $(pwd) grep 'quoted text'
+		export cd "$1" "$1" && "$@" readonly 2>/dev/null printf sed $(pwd)
+	"$1" 2>/dev/null 2>/dev/null "$1" echo &&
+export then 'quoted text' test 'quoted text'
+		"$@" printf awk "$1" && ${HOME}
+		then "$@" cd export echo "$1" $(pwd) 2>/dev/null x=1 --verbose $(pwd)
+		readonly ${HOME} sed test 2>/dev/null 2>/dev/null printf
+		export grep printf grep -eu "$@" readonly $(pwd) "$@" echo -eu "$1" ${HOME}
+		sed && $(pwd) "$@" --verbose 2>/dev/null
+'quoted text' 2>/dev/null echo local done 2>/dev/null
+	x=1 sed 'quoted text' | test done x=1 ${HOME} test local -eu grep | awk printf
+		'quoted text' "$@" awk awk "$@"
+awk export local && --verbose /usr/bin
+$(pwd) x=1 "$@" cd x=1 "$1" export local /usr/bin -eu 'quoted text' 'quoted text'
+		local local grep printf x=1 echo | cd sed done
+printf | grep local export local sed printf /usr/bin done
+	done local echo done /usr/bin 2>/dev/null $(pwd) x=1 -eu "$1" "$1" echo
+	| --verbose x=1 | printf --verbose readonly awk ${HOME} then
+		2>/dev/null local /usr/bin && ${HOME} cd
+done sed ${HOME} x=1 readonly export 2>/dev/null
+-eu 'quoted text' local x=1 $(pwd) "$1"
+		"$@" echo cd export then then $(pwd) then "$1" grep sed
+	printf export awk "$@" 2>/dev/null x=1 readonly 2>/dev/null
+x=1 test sed cd $(pwd) -eu sed -eu 'quoted text' | local
+	"$1" local readonly x=1 /usr/bin printf then &&
+	-eu x=1 cd echo done "$@" --verbose && sed 'quoted text'
+		"$@" ${HOME} export echo $(pwd) "$@"
+		| done $(pwd) then "$@" export cd && then then && && export echo awk /usr/bin 2>/dev/null
+	test $(pwd) printf $(pwd)
+	"$@" cd 2>/dev/null "$@" then
+	"$1" done 2>/dev/null 'quoted text' test
+		awk /usr/bin "$1" && readonly $(pwd) echo --verbose echo /usr/bin test done readonly
+	awk "$1" --verbose sed awk "$1"
+	sed readonly "$1" 'quoted text' then -eu "$1" readonly 'quoted text'
+		| x=1 export test cd sed | printf readonly x=1 'quoted text'
+readonly done "$@" grep
+	grep readonly done readonly grep $(pwd) -eu export ${HOME} grep
+		grep printf $(pwd) -eu
+'quoted text' --verbose awk grep readonly 2>/dev/null 2>/dev/null
+| 'quoted text' grep echo then $(pwd)
+		$(pwd) "$1" 2>/dev/null | readonly printf "$1" --verbose
+	${HOME} | readonly -eu export /usr/bin
+		"$@" 2>/dev/null ${HOME} test
+"$@" "$@" && echo /usr/bin
+awk awk printf && done && echo x=1 && x=1 ${HOME} $(pwd) -eu printf | |
+	done $(pwd) cd "$1" sed "$@"
+	--verbose readonly ${HOME} test then /usr/bin echo local grep
+	cd then "$@" ${HOME} readonly readonly 'quoted text' ${HOME} --verbose --verbose
+		x=1 echo export test printf
+		${HOME} ${HOME} awk awk printf && export ${HOME} test
+	-eu $(pwd) ${HOME} cd local "$@" && $(pwd) export awk cd test x=1
+		sed "$1" readonly | export
+	done | 2>/dev/null | awk x=1 x=1 test test /usr/bin then
+'quoted text' awk ${HOME} local export then $(pwd) && -eu ${HOME}
+--verbose cd "$@" grep "$@" export printf x=1 grep awk && done 'quoted text'
+local --verbose local sed ${HOME} 2>/dev/null grep 2>/dev/null echo
+"$1" /usr/bin sed /usr/bin 'quoted text' export awk ${HOME} echo
+		cd local -eu "$1" ${HOME}
+| awk 2>/dev/null $(pwd) --verbose "$1"
+	&& awk $(pwd) $(pwd) cd echo 'quoted text' "$@" /usr/bin x=1 test
+	readonly 'quoted text' then local readonly local "$@" $(pwd) "$1" echo x=1 printf
+	awk "$@" then $(pwd) printf cd --verbose ${HOME} -eu x=1 | readonly
+	${HOME} -eu x=1 printf && $(pwd) cd x=1 export | ${HOME}
+grep echo cd echo 2>/dev/null -eu $(pwd) 2>/dev/null "$@" -eu local /usr/bin
+	${HOME} -eu printf && cd printf /usr/bin local x=1 'quoted text' printf
+	2>/dev/null "$1" cd printf awk
+	done then grep printf done readonly cd "$1" /usr/bin
+		done -eu export "$1" readonly cd cd 'quoted text' "$1" test done local | grep
+then sed cd echo | echo
+export printf local export cd local
+		export "$1" local | -eu awk sed ${HOME}
+		x=1 /usr/bin "$@" -eu --verbose then &&
+	${HOME} readonly then | readonly then 2>/dev/null export
+		export readonly 'quoted text' printf test
+	"$1" && --verbose echo sed $(pwd) printf done -eu
+	test cd x=1 echo $(pwd) done grep done 2>/dev/null test export
+	sed printf then cd /usr/bin grep | && sed
+		local cd | 'quoted text' echo done sed ${HOME}
+	/usr/bin cd "$@" export done | && cd x=1 && test
+	then | export sed test "$1" ${HOME}
+	'quoted text' && -eu 2>/dev/null test 2>/dev/null then &&
+		printf printf echo echo export -eu grep readonly --verbose sed then
+		"$@" export local awk local done awk readonly 'quoted text' 2>/dev/null
+		'quoted text' done echo printf printf grep test && -eu --verbose 'quoted text'
+		export readonly 'quoted text' $(pwd) readonly 'quoted text' awk printf test --verbose
+then test printf grep && cd echo grep test then | done awk awk /usr/bin
+	"$@" awk x=1 $(pwd) "$@" && cd
+x=1 2>/dev/null grep awk
+		&& ${HOME} sed $(pwd) grep && sed /usr/bin
+x=1 readonly readonly grep -eu readonly /usr/bin local
+readonly readonly export --verbose
+		export then $(pwd) test && test readonly then done echo "$1" done
+	sed awk then export $(pwd) then x=1 local export
+echo -eu "$1" done && ${HOME} echo
+		awk printf local -eu ${HOME} x=1 ${HOME} test
+readonly $(pwd) awk x=1 awk echo echo export readonly grep -eu x=1
+		done printf local "$@" printf sed grep test "$@" 'quoted text' "$@" readonly
+		test /usr/bin ${HOME} cd 'quoted text'
+test 2>/dev/null local export export echo sed awk echo echo x=1 done then
+"$@" grep readonly awk
+	echo | test "$1" printf $(pwd) sed
+	$(pwd) grep echo done && ${HOME} cd then printf
+&& ${HOME} export cd test x=1 then printf local
+"$1" "$1" local 2>/dev/null
+local grep 'quoted text' 2>/dev/null | done local
+x=1 --verbose /usr/bin awk && sed
+		'quoted text' cd $(pwd) done sed -eu printf -eu awk sed grep 'quoted text' sed
+awk $(pwd) test sed readonly echo then | cd test "$@" | printf sed sed
+	grep cd then "$@" test | local --verbose 2>/dev/null then cd --verbose
+		test done echo x=1 -eu sed done -eu grep
+"$@" 'quoted text' 'quoted text'
+	x=1 done done then grep
+${HOME} "$1" grep && printf 2>/dev/null readonly $(pwd)
+export $(pwd) cd printf awk x=1 --verbose --verbose $(pwd) sed
+		echo awk printf grep echo ${HOME} | -eu && $(pwd) local grep -eu --verbose
+	cd export export "$1" -eu -eu -eu cd sed 'quoted text'
+	2>/dev/null $(pwd) ${HOME} printf local "$@" local done /usr/bin
+	2>/dev/null | 'quoted text' /usr/bin sed grep printf $(pwd)
+		"$1" then cd $(pwd) export "$1" done grep 'quoted text' cd sed readonly
+		'quoted text' && awk cd cd sed cd sed sed 2>/dev/null -eu /usr/bin printf
+	done "$1" x=1 export then grep sed grep
+	cd $(pwd) then -eu printf | cd grep sed
+	-eu "$@" local grep -eu readonly sed export -eu readonly &&
+	--verbose test readonly /usr/bin
+export export printf done /usr/bin
+| 'quoted text' 'quoted text' 2>/dev/null 'quoted text' /usr/bin --verbose
+x=1 then sed cd grep --verbose
+printf -eu 2>/dev/null --verbose 'quoted text'
+"$@" awk && x=1 done ${HOME} export echo local grep "$@" sed && cd then echo
+then printf sed $(pwd) "$@" echo x=1 grep export "$@"
+		awk then --verbose test /usr/bin /usr/bin "$1" printf "$1"
+		x=1 'quoted text' -eu && export /usr/bin
+/usr/bin $(pwd) $(pwd) 'quoted text' local /usr/bin sed printf awk echo ${HOME}
+	"$1" "$@" $(pwd) done sed $(pwd) echo
+done printf sed local
+		readonly ${HOME} ${HOME} local local 'quoted text' | readonly readonly
+	"$1" cd "$1" x=1 export | grep x=1 | awk ${HOME}
+readonly then $(pwd) grep cd --verbose --verbose readonly sed
+		cd | printf /usr/bin echo grep | readonly ${HOME} done
+		$(pwd) $(pwd) done test "$@" | readonly
+cd | printf "$1" printf -eu
+		done && $(pwd) && printf test /usr/bin printf /usr/bin done "$1"
+readonly done | --verbose readonly export "$@" sed -eu done
+'quoted text' readonly echo grep x=1 readonly
+2>/dev/null 2>/dev/null "$1" echo then done
+	-eu done $(pwd) sed --verbose -eu done
+		done sed && "$1" x=1 echo awk readonly test local | echo export
+		done readonly export printf && printf "$1" "$1" then "$1" | done --verbose "$@"
+local printf ${HOME} -eu
+	| -eu grep printf sed "$@" --verbose
+		done -eu $(pwd) grep $(pwd) readonly
+		cd sed -eu then ${HOME} && export sed echo local && | test "$@" $(pwd)
+		readonly test $(pwd) local cd test "$1" --verbose
+		done awk x=1 test awk /usr/bin then done then "$@" "$1" "$@" x=1
+		sed test awk 2>/dev/null
+	done /usr/bin then /usr/bin ${HOME} cd x=1 "$1" 'quoted text'
+local && local "$1" readonly /usr/bin export
+	echo grep $(pwd) export "$@" printf readonly 2>/dev/null -eu $(pwd) cd done
+		2>/dev/null then awk $(pwd) 2>/dev/null echo "$@" 'quoted text' x=1 then
+	"$1" && export then $(pwd) /usr/bin "$@" /usr/bin cd /usr/bin
+printf done /usr/bin /usr/bin 'quoted text' -eu x=1 ${HOME} done test readonly
+echo awk x=1 $(pwd) cd -eu export grep "$1" -eu 'quoted text' "$@" 'quoted text'
+	"$1" grep echo sed export printf "$1"
+local printf --verbose cd local "$1" "$@"
+		--verbose local echo sed
+	cd && "$1" then export --verbose cd echo
+	export -eu | 2>/dev/null awk then then "$1" "$@" awk 2>/dev/null done readonly
+		awk $(pwd) cd readonly readonly local
+$(pwd) test ${HOME} done export && 'quoted text'
+x=1 ${HOME} && grep printf test && | cd awk "$1" readonly then -eu
+		grep /usr/bin sed "$@" $(pwd) x=1 export && grep /usr/bin export
+$(pwd) then --verbose echo && export --verbose
+	cd | $(pwd) | /usr/bin test x=1 cd local ${HOME} sed
+	/usr/bin "$@" readonly then --verbose && | /usr/bin echo cd -eu cd
+	/usr/bin --verbose then echo x=1 -eu $(pwd) "$1" cd -eu local grep local
+		done | local printf "$@" ${HOME}
+		export printf test "$1" 2>/dev/null x=1 readonly ${HOME}
+	export 2>/dev/null sed done readonly export grep local /usr/bin ${HOME} | printf
+	done --verbose test --verbose "$1" grep
+	printf && printf 'quoted text' ${HOME}
+	"$1" test cd done awk cd done
+	x=1 /usr/bin local x=1 done
+sed awk -eu x=1 grep ${HOME} sed $(pwd) then
+		/usr/bin readonly sed $(pwd) then 'quoted text'
+		test 2>/dev/null /usr/bin printf local echo done then
+-eu printf && ${HOME} grep -eu sed "$@" 'quoted text'
+		${HOME} printf export sed x=1 x=1 $(pwd) then /usr/bin 'quoted text' test done
+	grep then | -eu --verbose then grep
+		local --verbose awk awk echo 2>/dev/null then cd x=1 2>/dev/null
+	"$1" grep test "$@" -eu /usr/bin
+	echo 2>/dev/null && && readonly -eu test done then
+		"$1" $(pwd) cd 2>/dev/null then printf --verbose ${HOME} "$1" done -eu
+		$(pwd) awk ${HOME} && done echo echo echo printf readonly /usr/bin /usr/bin
+		done /usr/bin echo printf awk local local
+	sed x=1 cd 2>/dev/null
+	$(pwd) awk printf $(pwd) -eu "$1" x=1 && x=1
+		local "$@" 'quoted text' "$1" -eu --verbose grep --verbose -eu /usr/bin done cd
+		test local echo done "$1" $(pwd) "$1" grep 'quoted text' $(pwd) 2>/dev/null
+		test --verbose sed $(pwd) readonly x=1 echo 2>/dev/null awk
+	cd export export sed 'quoted text' printf export 'quoted text' | | test | "$1"
+		--verbose then awk done && then | cd "$@" ${HOME} | --verbose local printf
+	done 'quoted text' cd "$1" export ${HOME} sed -eu readonly
+	echo export local | test $(pwd) 2>/dev/null -eu --verbose done awk grep
+	"$@" done done readonly sed cd printf
+cd done local echo $(pwd) then | x=1 "$1" done then test
+$(pwd) ${HOME} awk grep "$1" | | then sed /usr/bin test 'quoted text'
+		sed ${HOME} /usr/bin x=1 readonly /usr/bin printf
+cd "$@" ${HOME} local $(pwd) ${HOME} readonly export test printf printf --verbose
+'quoted text' "$1" then then grep local export sed "$@" echo
+	test /usr/bin "$@" ${HOME} "$@" sed local
+cd done /usr/bin sed cd "$@" test $(pwd) -eu x=1 "$@" "$@" && 'quoted text'
+		awk export sed 2>/dev/null readonly export test
+	-eu 2>/dev/null --verbose awk
+		&& test awk "$@" 2>/dev/null
+$(pwd) /usr/bin grep sed done x=1 readonly x=1 sed $(pwd)
+		$(pwd) | readonly then --verbose "$@" export ${HOME}
+done /usr/bin test 2>/dev/null
+		x=1 "$1" echo export "$1" local cd grep x=1 cd export $(pwd) ${HOME} export
+	'quoted text' $(pwd) test local readonly 2>/dev/null
+	x=1 awk 'quoted text' printf
+&& && test /usr/bin export
+	done done --verbose grep x=1 && && x=1 "$@" then readonly grep echo x=1
+	grep awk printf export 2>/dev/null readonly test
+	$(pwd) grep 2>/dev/null readonly local --verbose -eu export local
+"$1" --verbose 'quoted text'
+/usr/bin then cd test echo done sed && 'quoted text'
+		printf echo /usr/bin sed done --verbose "$@"
+sed test x=1 cd "$@" then cd readonly | -eu cd /usr/bin readonly
+		local "$1" --verbose done ${HOME}
+export done ${HOME} | awk 'quoted text'
+	awk x=1 printf cd test "$1" && "$1" 'quoted text'
+	done awk then echo 2>/dev/null
+x=1 echo 'quoted text' /usr/bin 2>/dev/null -eu done 'quoted text' then "$1"
+/usr/bin && echo "$1" --verbose $(pwd)
+	sed x=1 --verbose sed export sed -eu "$1" awk "$@" $(pwd)
+		x=1 echo && sed done --verbose local && | ${HOME}
+		-eu done export "$@" local 'quoted text' then $(pwd) cd -eu echo
+		sed test readonly 'quoted text' 'quoted text' export -eu /usr/bin -eu
+local local ${HOME} done /usr/bin cd cd -eu test done
+		grep 'quoted text' readonly sed grep test awk /usr/bin then grep cd then
+	test grep ${HOME} export echo then readonly $(pwd) local awk | export
+	then awk 2>/dev/null x=1 sed x=1 'quoted text' readonly 2>/dev/null echo -eu
+	awk sed export awk cd readonly
+		"$@" readonly cd export readonly 'quoted text' x=1 x=1 readonly "$@" --verbose
+		-eu $(pwd) "$1" /usr/bin 'quoted text' readonly echo export 'quoted text'
+	sed export test 2>/dev/null ${HOME} done awk ${HOME} /usr/bin 2>/dev/null
+&& | $(pwd) "$1" | x=1 -eu test 2>/dev/null /usr/bin
+		readonly done -eu awk export printf echo readonly local "$@" $(pwd) ${HOME} $(pwd)
+x=1 $(pwd) then "$1" printf printf
+		test test sed -eu done x=1 local awk readonly 'quoted text' readonly
+	echo readonly readonly 'quoted text'
+		-eu test x=1 | x=1 "$1" "$@" $(pwd) sed --verbose
+export readonly sed 'quoted text' $(pwd) 'quoted text'
+grep 2>/dev/null x=1 local $(pwd) then "$@" && 'quoted text'
+	2>/dev/null && echo done ${HOME} && | printf x=1 | done local "$@" readonly
+	then printf $(pwd) x=1 'quoted text' "$@"
+		test 2>/dev/null then local
+	sed done 'quoted text' | cd ${HOME} then grep
+--verbose sed export readonly
+	x=1 sed && export $(pwd) 2>/dev/null test readonly
+	"$1" 2>/dev/null "$@"
+		then test "$@" local printf grep readonly
+		grep ${HOME} -eu --verbose x=1 sed readonly $(pwd) test 'quoted text' 'quoted text'
+then --verbose --verbose local printf --verbose sed then "$1"
+	printf | awk --verbose --verbose
+-eu x=1 test echo grep --verbose sed $(pwd)
+	echo 'quoted text' export cd local
+		2>/dev/null echo done 'quoted text' /usr/bin echo grep |
+		-eu cd awk x=1 2>/dev/null --verbose cd printf cd /usr/bin grep "$@" | && --verbose
+		'quoted text' grep 'quoted text' awk grep
+/usr/bin awk /usr/bin "$1" cd then
+awk test && readonly "$@" $(pwd) && && local "$@"
+	x=1 grep /usr/bin 'quoted text' x=1 awk echo "$1" /usr/bin 2>/dev/null
+"$@" --verbose /usr/bin done "$@" 'quoted text'
+then echo /usr/bin | echo "$@" export 2>/dev/null
+	&& sed | 2>/dev/null /usr/bin
+	"$1" printf awk "$1" | grep sed x=1
+	local test "$1" --verbose | -eu local test | readonly grep | grep "$@" echo
+		2>/dev/null done "$@" awk awk -eu
+		echo echo test awk grep 2>/dev/null
+	done done --verbose /usr/bin 2>/dev/null
+local x=1 grep "$@" then && grep | $(pwd) done export cd x=1 test x=1 -eu cd awk
+		grep awk "$@" "$@" sed $(pwd) 2>/dev/null "$@" /usr/bin x=1 /usr/bin 2>/dev/null
+		"$1" $(pwd) sed --verbose 2>/dev/null
+awk test grep grep echo printf ${HOME} | sed ${HOME} | sed export
+x=1 test x=1 cd echo /usr/bin cd 'quoted text'
+	"$1" readonly 2>/dev/null ${HOME} ${HOME} 2>/dev/null
+		cd test 'quoted text' done ${HOME} | export
+		/usr/bin 'quoted text' readonly done 'quoted text'
+	${HOME} cd "$@" "$@" | -eu | "$@" test 2>/dev/null "$1"
+2>/dev/null 'quoted text' readonly && --verbose local readonly
+${HOME} local $(pwd) echo export --verbose
+	awk test readonly | ${HOME} readonly "$1" then echo x=1 sed | "$1"
+		then awk /usr/bin printf test
+'quoted text' "$@" grep test --verbose -eu awk awk
+		export cd cd then && "$1" echo awk -eu -eu ${HOME} readonly
+then && cd /usr/bin export $(pwd) "$1" ${HOME} "$1" x=1 grep done /usr/bin
+readonly /usr/bin export x=1 awk done --verbose x=1 x=1 cd local local $(pwd)
+awk $(pwd) echo then $(pwd) ${HOME} | then -eu 'quoted text'
+done --verbose x=1 awk readonly sed echo x=1 'quoted text'
+cd "$1" readonly /usr/bin then "$@" readonly test
+then -eu | grep cd -eu readonly
+	| cd $(pwd) -eu then | "$1" grep readonly 2>/dev/null printf -eu /usr/bin -eu
+	cd --verbose local local sed $(pwd) grep /usr/bin "$1" local echo ${HOME}
+		grep cd --verbose --verbose grep test export awk "$1" printf grep
+		local -eu 'quoted text' "$1" cd && then done -eu "$1" /usr/bin done awk echo -eu
+		"$1" cd | && cd done export done sed --verbose "$@" 2>/dev/null sed
+printf cd 2>/dev/null then $(pwd) --verbose
+	&& $(pwd) export export done -eu export
+	cd ${HOME} sed && $(pwd) then sed && /usr/bin
+awk sed "$1" ${HOME} done | x=1 export
+'quoted text' echo && readonly ${HOME} cd done export "$1"
+	/usr/bin "$1" readonly "$@" grep done
+		cd | echo 'quoted text' 2>/dev/null local -eu 2>/dev/null "$1" awk "$1"
+	echo test export sed local test then sed echo /usr/bin
+		| "$1" 'quoted text' export printf local /usr/bin | readonly readonly local
+	'quoted text' awk readonly cd echo "$1"
+local awk 2>/dev/null readonly
+		$(pwd) "$1" then done "$@" then sed | x=1 then -eu readonly echo
+	echo ${HOME} awk $(pwd) readonly && cd
+	readonly done 2>/dev/null $(pwd) "$1" echo
+		awk awk 'quoted text' 'quoted text' grep done "$@" local $(pwd) 'quoted text'
+		${HOME} echo $(pwd) sed "$1" echo printf
+-eu "$1" sed x=1 then "$1" cd readonly $(pwd) x=1 export cd readonly readonly test
+	"$1" done cd cd awk export
+		test "$1" echo -eu local $(pwd) "$1" "$1" awk sed grep /usr/bin ${HOME} -eu then
+		'quoted text' then "$@" export local
+--verbose -eu export 'quoted text'
+	-eu test -eu --verbose printf -eu done $(pwd) cd --verbose "$1" $(pwd) cd echo
+		${HOME} readonly done /usr/bin 'quoted text' export echo $(pwd) awk
+printf local 2>/dev/null readonly -eu done export grep
+		${HOME} then --verbose sed && 2>/dev/null
+x=1 'quoted text' ${HOME}
+'quoted text' echo export echo grep done --verbose
+		-eu export -eu $(pwd) printf --verbose
+		--verbose && export then done cd "$@" printf -eu --verbose $(pwd) ${HOME} "$@" echo
+		sed awk $(pwd) --verbose -eu echo 'quoted text' then &&
+	x=1 ${HOME} echo /usr/bin done x=1 'quoted text' && "$@"
+echo readonly printf readonly x=1 /usr/bin then sed
+		2>/dev/null grep awk grep
+printf | /usr/bin printf /usr/bin
+	then local 'quoted text' -eu x=1
+		"$1" && ${HOME} $(pwd) done 2>/dev/null
+sed readonly 2>/dev/null -eu
+		awk awk --verbose 'quoted text' $(pwd) echo x=1 $(pwd) echo grep 'quoted text'
+		-eu 'quoted text' | --verbose
+awk grep printf local test export export -eu
+--verbose /usr/bin $(pwd)
+		echo -eu done awk && done && echo local "$@" -eu done
+	--verbose | echo printf $(pwd) then sed -eu /usr/bin 'quoted text' "$@" echo then
+export "$@" ${HOME} 'quoted text' then sed cd cd awk && x=1 cd 'quoted text'
+	| test /usr/bin grep --verbose 'quoted text'
+	"$@" "$1" echo then echo printf "$1" 2>/dev/null printf ${HOME} cd
+2>/dev/null then "$1" && x=1 ${HOME} x=1 "$1" echo done && test cd 2>/dev/null
+	export readonly x=1 export -eu local | "$1" readonly
+local local readonly | 'quoted text'
+	| ${HOME} && --verbose cd -eu "$@" echo -eu cd /usr/bin test "$1" echo -eu
+	$(pwd) export && sed x=1 then "$@" echo 2>/dev/null 2>/dev/null printf
@@ -0,0 +1,2001 @@
+	'quoted text' "$@" awk "$@" --verbose sed test test
+${HOME} printf "$1" 'quoted text' readonly awk -eu echo sed export
+	/usr/bin local local "$@" then readonly export $(pwd) export x=1
+x=1 readonly 'quoted text'
+awk then local sed 'quoted text' "$@" 'quoted text'
+awk local x=1 echo ${HOME} x=1 printf done ${HOME} 'quoted text'
+| $(pwd) test && test done && then local echo -eu "$@" local done /usr/bin
+local --verbose -eu 'quoted text' 'quoted text' export "$@" x=1 /usr/bin /usr/bin
+	$(pwd) printf sed local done cd "$1" "$1" sed local awk awk printf grep
+	/usr/bin 2>/dev/null readonly -eu 'quoted text' printf
+	echo then 'quoted text' local ${HOME} readonly readonly
+		--verbose cd echo sed echo | then | awk ${HOME} x=1
+		--verbose ${HOME} test /usr/bin export awk echo
+	done -eu | "$@" x=1 "$@" 'quoted text' echo "$1"
+		awk test done ${HOME} ${HOME} 'quoted text' --verbose --verbose cd echo
+		x=1 --verbose local && awk | test readonly awk 'quoted text' grep
+	grep then /usr/bin printf local && awk export then sed "$@" grep cd
+then 'quoted text' done readonly
+		$(pwd) awk $(pwd) echo /usr/bin $(pwd) "$@" grep done -eu 'quoted text'
+		then local export "$@" x=1 /usr/bin x=1 x=1 sed then
+		cd "$@" local "$1" 2>/dev/null 2>/dev/null local local export test printf
+	/usr/bin export done $(pwd) local | -eu
+${HOME} x=1 2>/dev/null readonly "$@" sed x=1 awk | local awk "$1"
+"$@" readonly then $(pwd) local test /usr/bin x=1 "$@" "$1" export -eu "$1"
+echo x=1 done echo grep && 2>/dev/null printf
+		export readonly --verbose
+awk readonly printf --verbose local x=1 ${HOME} && -eu echo done $(pwd) /usr/bin
+		"$@" 'quoted text' cd "$1" | awk --verbose
+		/usr/bin test export test awk then 2>/dev/null local 2>/dev/null
+	sed "$@" cd grep done then | && export "$1" "$1" cd done export
+	local grep cd $(pwd) && cd "$@" readonly x=1 then awk cd export $(pwd)
+	test /usr/bin export 2>/dev/null
+	awk 'quoted text' echo 2>/dev/null x=1 cd export 'quoted text'
+		"$1" "$1" x=1 then --verbose /usr/bin
+	"$@" readonly test sed --verbose
+		done echo awk sed readonly
+		/usr/bin /usr/bin awk awk test ${HOME} cd ${HOME} test $(pwd) echo
+--verbose local echo /usr/bin grep -eu
+printf grep printf local echo 'quoted text' grep printf echo 'quoted text'
+$(pwd) done 'quoted text' echo cd "$1" sed -eu -eu then
+	"$1" awk 2>/dev/null && /usr/bin local printf 'quoted text' --verbose
+		grep /usr/bin done done 'quoted text' printf
+cd done 'quoted text' x=1 export &&
+		-eu -eu test readonly grep $(pwd) awk $(pwd) "$@" "$@" /usr/bin | local
+local done "$1" 'quoted text' sed x=1 -eu --verbose then done echo cd readonly
+/usr/bin printf test printf "$1" x=1 then printf then grep x=1 x=1
+export cd local sed && done local $(pwd) 'quoted text' sed -eu done 2>/dev/null
+		test grep test readonly /usr/bin ${HOME} /usr/bin
+	/usr/bin sed export echo
+	&& "$@" && x=1 $(pwd) x=1 export cd cd test printf readonly
+	| "$@" "$@" "$1" test
+	x=1 ${HOME} done && then x=1 | then local $(pwd) cd echo x=1 local && $(pwd) /usr/bin
+	| -eu 2>/dev/null x=1 local printf /usr/bin
+		export /usr/bin ${HOME} test then | -eu readonly "$1" "$@" --verbose 2>/dev/null
+		readonly /usr/bin $(pwd) /usr/bin | local | $(pwd) && echo ${HOME} $(pwd) |
+		'quoted text' printf -eu done ${HOME} done ${HOME} readonly test "$1" local "$@"
+	then "$1" then then echo 2>/dev/null grep "$@" sed
+		grep grep printf 'quoted text'
+	"$1" awk 'quoted text' && test /usr/bin printf | x=1 --verbose done
+	echo | grep echo -eu printf local --verbose printf
+	awk --verbose 'quoted text'
+		test | /usr/bin echo $(pwd) 'quoted text'
+	local | -eu "$1" cd done export export $(pwd) readonly x=1 $(pwd) --verbose then
+		&& done 2>/dev/null test --verbose
+		-eu && test --verbose x=1 x=1
+echo -eu printf -eu x=1 && /usr/bin readonly "$1" --verbose awk export
+	cd "$@" 'quoted text' readonly && test "$1" test test && export -eu $(pwd)
+		then /usr/bin --verbose x=1 grep "$1" "$1" test ${HOME}
+grep export awk -eu readonly echo then -eu local &&
+		echo echo "$@" ${HOME} 'quoted text'
+		then cd "$1" test && grep sed && $(pwd) $(pwd)
+	${HOME} && --verbose "$1" "$@" cd 2>/dev/null
+		$(pwd) "$@" printf export && "$1" test
+		awk 2>/dev/null cd done awk local --verbose readonly local readonly
+	x=1 echo done /usr/bin printf $(pwd) then grep
+x=1 echo printf ${HOME} /usr/bin sed x=1 $(pwd) readonly -eu "$@" && /usr/bin
+		readonly readonly 2>/dev/null
+	test export | -eu cd 2>/dev/null --verbose export | | -eu 2>/dev/null
+done ${HOME} export printf
+export $(pwd) grep sed 2>/dev/null x=1 readonly ${HOME} grep awk export ${HOME}
+	test "$@" | test --verbose $(pwd) "$1" readonly printf
+		local sed awk 2>/dev/null grep
+		$(pwd) "$@" /usr/bin /usr/bin -eu "$1" 2>/dev/null readonly echo
+		local echo $(pwd) sed -eu sed local echo -eu then "$@" done
+		printf && then local export 'quoted text' then "$@" | "$@" local test export local
+		grep "$@" readonly 2>/dev/null "$1" test then "$@" /usr/bin --verbose
+2>/dev/null readonly "$@" echo /usr/bin sed x=1 --verbose local
+		--verbose /usr/bin test $(pwd) then "$@"
+		done local export 'quoted text'
+		cd then grep export cd test grep grep test /usr/bin readonly printf ${HOME} x=1
+	local grep /usr/bin 2>/dev/null
+then cd -eu ${HOME} ${HOME} "$1"
+	--verbose $(pwd) x=1 2>/dev/null grep printf readonly --verbose
+x=1 printf --verbose 'quoted text' /usr/bin sed
+done 'quoted text' printf test
+	&& awk sed export local echo export
+		test && printf local cd done local
+		/usr/bin local grep | | echo $(pwd) awk ${HOME}
+awk 'quoted text' then test
+	awk readonly x=1 'quoted text' 2>/dev/null 'quoted text'
+		2>/dev/null grep ${HOME} x=1 export done "$1" ${HOME}
+		readonly export | "$1" awk awk then local cd --verbose
+		--verbose echo /usr/bin /usr/bin readonly cd
+&& local "$@" printf echo export "$1" /usr/bin done done 'quoted text' "$@"
+	export printf echo && | export $(pwd) then done | cd then 2>/dev/null --verbose
+	--verbose 2>/dev/null /usr/bin local 'quoted text' printf local 2>/dev/null
+"$@" $(pwd) export "$1" -eu cd x=1 grep
+${HOME} sed "$1" export echo sed "$@" readonly --verbose -eu
+		test done awk grep local awk cd awk local done
+	echo echo readonly x=1 echo
+		grep readonly awk local export "$@" 2>/dev/null grep $(pwd) 2>/dev/null
+	printf /usr/bin && "$1" cd awk 2>/dev/null test "$1"
+		| "$1" awk --verbose sed /usr/bin echo "$1" x=1 --verbose test
+	x=1 --verbose --verbose echo && 2>/dev/null /usr/bin
+readonly printf cd $(pwd) "$@" --verbose
+export test "$@" local awk readonly local grep awk cd grep awk printf 2>/dev/null
+	cd sed awk awk | local sed sed 'quoted text' readonly
+	done 'quoted text' sed --verbose done x=1
+		readonly ${HOME} printf 'quoted text'
+awk cd local && $(pwd) 2>/dev/null awk done export
+		/usr/bin cd --verbose -eu echo readonly readonly done export echo sed 'quoted text'
+		${HOME} done grep | export $(pwd) --verbose awk
+local then "$@" then printf awk echo $(pwd) "$@" --verbose
+		'quoted text' export 2>/dev/null 'quoted text'
+		grep /usr/bin -eu cd x=1 $(pwd) sed done
+	-eu cd grep "$@" readonly cd local "$1" done done echo cd $(pwd) sed "$@" && readonly
+	then "$1" "$@" awk x=1 -eu && "$@" readonly --verbose "$1" && -eu export done
+	x=1 --verbose printf 2>/dev/null test
+awk awk /usr/bin awk && then "$1" awk 'quoted text' "$1" sed "$1" "$1"
+grep test echo -eu --verbose test /usr/bin sed sed
+	printf x=1 export then echo -eu sed ${HOME} awk printf $(pwd) | cd sed && export
+		| then /usr/bin cd --verbose then echo ${HOME} "$@" "$@" then "$1"
+local readonly $(pwd) done awk "$1" grep | export /usr/bin
+		readonly && 'quoted text' $(pwd) -eu 'quoted text'
+printf --verbose --verbose
+		/usr/bin ${HOME} echo echo ${HOME} 2>/dev/null 'quoted text' cd
+	local readonly awk | grep
+	"$1" test "$1" 'quoted text' $(pwd) /usr/bin
+	sed "$@" $(pwd) x=1 echo test && export $(pwd)
+"$@" then local $(pwd) echo -eu awk readonly "$@" -eu
+	test local test printf "$1" local cd x=1 --verbose test readonly
+	&& 'quoted text' /usr/bin /usr/bin
+		/usr/bin grep cd export ${HOME} -eu printf $(pwd) readonly /usr/bin sed cd
+"$@" done sed -eu --verbose cd printf
+x=1 'quoted text' | | | readonly done awk x=1 'quoted text' -eu
+readonly $(pwd) --verbose cd x=1 local -eu $(pwd) done 2>/dev/null /usr/bin awk
+		export x=1 'quoted text' cd
+"$@" grep $(pwd) 2>/dev/null echo
+cd echo "$@" --verbose awk /usr/bin 2>/dev/null
+grep $(pwd) && printf readonly export then awk --verbose
+	"$@" "$@" x=1 --verbose sed printf ${HOME} -eu
+	test echo /usr/bin x=1 then
+		local done "$1" -eu local done 2>/dev/null ${HOME}
+cd x=1 local 'quoted text'
+	cd x=1 done 'quoted text' export 2>/dev/null
+	cd grep "$1" -eu echo echo sed
+cd -eu | 'quoted text' 2>/dev/null --verbose
+		"$1" cd printf -eu && x=1 $(pwd) sed export $(pwd) -eu export $(pwd) done
+	2>/dev/null 'quoted text'
+echo then "$1" awk test $(pwd) readonly echo then then
+		-eu cd $(pwd) readonly then && "$1"
+		--verbose "$1" /usr/bin x=1 cd "$1" then sed "$@" ${HOME} 'quoted text' echo ${HOME}
+	'quoted text' "$@" echo sed done then test
+| -eu --verbose 2>/dev/null
+echo 2>/dev/null printf test printf export
+	| printf awk then printf test -eu --verbose
+		${HOME} printf export --verbose
+	x=1 cd printf 2>/dev/null
+| printf then then $(pwd)
+readonly readonly | sed "$@" 'quoted text' x=1
+	&& 2>/dev/null | sed printf
+export -eu $(pwd) "$1" echo
+| local "$1" cd /usr/bin readonly then "$1" local readonly local /usr/bin
+	echo local done | done export | echo echo | 'quoted text'
+$(pwd) done x=1 ${HOME} -eu --verbose && "$@" "$@" "$1" "$@" grep
+	--verbose -eu test ${HOME} local $(pwd)
+	| 'quoted text' $(pwd) 2>/dev/null /usr/bin
+		x=1 grep local printf x=1 printf local 2>/dev/null x=1
+		"$1" done 'quoted text' ${HOME} x=1 "$1" "$1" cd
+export -eu local printf ${HOME} "$@" grep -eu
+"$1" | done done $(pwd) printf | "$@" test cd
+sed sed $(pwd) x=1 ${HOME} ${HOME} readonly --verbose awk | 2>/dev/null
+		awk echo awk 2>/dev/null local --verbose ${HOME} local 2>/dev/null
+awk | readonly -eu ${HOME}
+		&& && --verbose 'quoted text' export $(pwd)
+		readonly "$1" echo /usr/bin test sed test && "$@" grep
+	printf done && -eu "$1" printf /usr/bin then x=1 $(pwd) printf
+export awk ${HOME} --verbose
+grep test cd | readonly test && local "$1" 2>/dev/null
+		done | x=1 awk 'quoted text' printf --verbose
+	2>/dev/null then readonly echo awk x=1 readonly -eu
+		-eu test then sed 'quoted text'
+		-eu local done printf ${HOME} export export
+cd printf 'quoted text'
+local /usr/bin --verbose "$1" printf awk | 'quoted text' cd 2>/dev/null
+		'quoted text' readonly $(pwd) x=1 2>/dev/null ${HOME} x=1 grep $(pwd)
+	local -eu --verbose $(pwd) | ${HOME}
+"$1" printf --verbose "$1" "$@" done | x=1 test readonly export cd x=1 readonly
+	$(pwd) "$@" printf | --verbose then "$@" test "$@" grep &&
+		| test then done readonly /usr/bin sed | test ${HOME}
+	grep "$1" export awk
+		cd /usr/bin done printf ${HOME} "$@" printf && test export printf
+		| "$@" awk x=1 --verbose done grep readonly readonly then sed export grep ${HOME}
+	/usr/bin test local grep local 'quoted text' cd cd test sed echo -eu && "$1"
+		/usr/bin "$@" cd /usr/bin 2>/dev/null sed | readonly
+		--verbose --verbose "$1"
+		cd 'quoted text' grep grep $(pwd) "$@" "$@"
+	done 2>/dev/null && export
+		echo echo export 2>/dev/null 'quoted text' | then grep
+grep "$1" local cd $(pwd) test && sed ${HOME}
+${HOME} x=1 cd grep "$1" && done
+	export sed -eu --verbose x=1 /usr/bin 'quoted text' local | --verbose &&
+cd --verbose "$1" test echo 2>/dev/null sed awk -eu 'quoted text'
+		export $(pwd) printf printf printf cd $(pwd) ${HOME} local sed "$@" 2>/dev/null
+	grep export echo | ${HOME} $(pwd) | ${HOME}
+x=1 "$1" grep $(pwd) "$1"
+		$(pwd) awk /usr/bin $(pwd) done --verbose
+		"$1" | done 2>/dev/null x=1 $(pwd) done readonly
+	readonly 2>/dev/null && --verbose echo ${HOME} x=1 "$1" &&
+		| then awk $(pwd) then ${HOME} printf local done
+/usr/bin --verbose 2>/dev/null local test export echo --verbose -eu | grep
+'quoted text' ${HOME} && sed export local 'quoted text' local && && export grep
+	export readonly && awk export 'quoted text'
+		-eu cd cd cd local 2>/dev/null $(pwd) ${HOME} export printf 'quoted text'
+	then sed readonly -eu
+		-eu done then grep then --verbose "$@" grep $(pwd)
+	echo then 2>/dev/null echo
+		awk grep /usr/bin ${HOME}
+		${HOME} --verbose grep
+	awk done 'quoted text' $(pwd) printf then && export done then test && x=1 x=1 "$@"
+		awk | && readonly $(pwd) x=1 "$@" /usr/bin x=1 then 2>/dev/null
+		| echo local export test "$@" "$@" x=1 cd sed then "$1"
+-eu --verbose | readonly echo done "$@" sed "$@" 2>/dev/null
+		"$1" ${HOME} readonly readonly test local | x=1 /usr/bin && then | |
+	&& 2>/dev/null printf awk
+	"$1" done sed && grep done 'quoted text' local -eu
+awk local "$1" /usr/bin x=1 -eu echo 'quoted text'
+		echo grep test awk readonly printf echo "$@" && $(pwd) && "$@" awk
+	awk then --verbose local 'quoted text' test /usr/bin ${HOME} readonly
+		test echo export local then sed "$@" ${HOME} && test export "$1" && export
+	export done readonly export grep 2>/dev/null grep ${HOME}
+		printf done -eu $(pwd) test grep then
+		"$@" local awk $(pwd) sed
+	grep printf 2>/dev/null sed sed | "$1" cd cd cd -eu awk
+"$1" | x=1 2>/dev/null cd awk sed | | ${HOME} readonly sed
+	/usr/bin "$1" /usr/bin -eu x=1 -eu sed
+		done "$@" export test echo -eu "$@" ${HOME} "$1"
+sed ${HOME} x=1 readonly 'quoted text' -eu grep --verbose x=1 cd "$@" cd "$1"
+printf echo local -eu "$@" grep 'quoted text'
+	x=1 sed export /usr/bin local -eu 'quoted text'
+then export 2>/dev/null readonly "$1" awk printf then
+	sed ${HOME} "$@" --verbose 2>/dev/null
+		test grep test done grep ${HOME} ${HOME}
+printf | echo && /usr/bin then sed export awk
+test awk "$1" "$@" done -eu $(pwd) then awk then local echo -eu printf &&
+	"$1" cd echo done --verbose then /usr/bin "$@"
+	$(pwd) | cd x=1 printf echo local 2>/dev/null
+		cd | 'quoted text' 2>/dev/null awk "$1" local readonly
+		--verbose export "$1" test $(pwd) "$@" "$1" ${HOME} cd sed readonly
+test "$1" $(pwd) /usr/bin export export
+-eu grep awk && 2>/dev/null
+		/usr/bin printf -eu sed done sed ${HOME} then done 2>/dev/null x=1 echo /usr/bin
+done 2>/dev/null printf sed -eu --verbose then && 'quoted text' 'quoted text'
+		&& ${HOME} test awk --verbose
+		awk --verbose /usr/bin cd sed 'quoted text' echo "$1"
+	cd sed -eu awk cd --verbose "$@" readonly 2>/dev/null -eu done -eu $(pwd) | export
+	--verbose --verbose && ${HOME} ${HOME} printf -eu 'quoted text' cd -eu
+echo /usr/bin done 2>/dev/null "$@" echo readonly readonly sed awk
+		"$1" done done awk local test
+&& printf printf cd export x=1 awk test readonly && /usr/bin
+grep | cd && done 2>/dev/null sed "$1" "$@"
+	--verbose grep echo && /usr/bin | echo
+	then --verbose "$1" export
+| -eu test local cd readonly grep |
+		--verbose x=1 ${HOME} 'quoted text' "$@" "$@"
+		--verbose local local 'quoted text'
+		readonly grep 2>/dev/null
+-eu then ${HOME} x=1 grep grep | then ${HOME} $(pwd) echo cd sed
+		x=1 --verbose "$1" 'quoted text' readonly local export --verbose export 'quoted text'
+	--verbose 'quoted text'
+	printf ${HOME} ${HOME} cd test readonly
+	-eu --verbose test awk local ${HOME} readonly "$@" x=1 $(pwd) | awk ${HOME}
+		cd sed done -eu grep done | test --verbose
+		local $(pwd) echo grep then | 2>/dev/null sed
+	cd | -eu "$@" 'quoted text' && then x=1 cd
+awk test | && $(pwd) -eu x=1 cd /usr/bin local 2>/dev/null
+	grep "$@" then then then "$1" --verbose 'quoted text' sed
+		&& echo export x=1 cd | then -eu && readonly
+"$@" --verbose "$1" printf $(pwd) cd "$1" ${HOME} -eu export done --verbose
+	$(pwd) printf then export /usr/bin grep ${HOME} local export
+/usr/bin printf x=1 sed then
+/usr/bin 'quoted text' 'quoted text'
+	${HOME} sed sed readonly sed then sed /usr/bin then 2>/dev/null && sed $(pwd) sed
+"$@" awk test ${HOME} x=1 grep | && then sed x=1 && /usr/bin
+export /usr/bin 2>/dev/null export /usr/bin done cd $(pwd)
+	printf test $(pwd) | ${HOME} echo readonly
+		local --verbose && ${HOME} grep $(pwd) done local sed &&
+		"$1" cd "$1" "$1" $(pwd) /usr/bin /usr/bin local grep readonly
+	&& sed readonly printf echo | grep export then $(pwd) ${HOME} ${HOME}
+	-eu $(pwd) printf then grep local -eu ${HOME}
+		'quoted text' echo export grep sed then awk --verbose | x=1 "$1" done grep local
+		grep --verbose | ${HOME} -eu ${HOME} awk local then && echo local cd cd ${HOME}
+	-eu done then --verbose ${HOME} 2>/dev/null test echo export 'quoted text' -eu
+	sed x=1 'quoted text' cd ${HOME} --verbose -eu ${HOME} | "$@" local
+		${HOME} test sed "$1" /usr/bin test then 2>/dev/null | grep
+done readonly sed sed "$@"
+		2>/dev/null cd done export ${HOME} cd awk
+		then test "$1" readonly printf $(pwd) then 2>/dev/null x=1
+	test grep grep grep echo sed
+printf local --verbose sed then 'quoted text'
+		export test -eu export x=1 grep "$1" echo local readonly --verbose readonly
+| awk export then echo -eu printf then awk readonly awk
+	done "$@" "$@" ${HOME} sed test cd export
+'quoted text' awk readonly -eu awk --verbose echo printf && x=1 2>/dev/null readonly
+	cd | export 2>/dev/null $(pwd) "$@" awk cd done --verbose $(pwd) awk awk test done
+test readonly 2>/dev/null
+		readonly done test test 'quoted text' --verbose
+	done | test 2>/dev/null "$@" --verbose 'quoted text' printf grep
+/usr/bin ${HOME} 2>/dev/null 'quoted text' cd /usr/bin local
+		$(pwd) 2>/dev/null && /usr/bin export -eu then export 2>/dev/null
+	test test echo awk x=1 done test ${HOME} 'quoted text'
+$(pwd) sed echo x=1 local done -eu
+	"$1" readonly && echo awk done
+	"$@" test readonly -eu echo "$1" $(pwd) ${HOME} sed 2>/dev/null local readonly
+	grep $(pwd) x=1 && | 'quoted text' ${HOME}
+	done 'quoted text' printf sed "$@" echo 'quoted text'
+'quoted text' --verbose cd x=1 ${HOME} cd printf && && $(pwd) readonly $(pwd)
+	local cd local readonly sed printf awk -eu --verbose echo
+	sed -eu $(pwd) export export export awk /usr/bin printf
+	| cd 2>/dev/null x=1 'quoted text' --verbose "$@" | cd sed x=1
+/usr/bin readonly --verbose local x=1 2>/dev/null local done printf
+		"$@" test cd sed 2>/dev/null export echo /usr/bin $(pwd) readonly
+	/usr/bin --verbose echo echo && awk sed export /usr/bin
+	local local cd then grep awk cd readonly -eu -eu --verbose local ${HOME}
+	--verbose export --verbose --verbose --verbose ${HOME} readonly export
+	echo x=1 2>/dev/null
+local "$@" 2>/dev/null printf
+		sed /usr/bin x=1 export grep | local echo $(pwd) grep ${HOME} sed
+	-eu 'quoted text' $(pwd) local grep sed --verbose local
+		cd -eu grep test then $(pwd) --verbose ${HOME}
+		'quoted text' test $(pwd) test test -eu "$@" grep | | 'quoted text'
+--verbose | echo local cd test && --verbose export
+	2>/dev/null readonly /usr/bin readonly x=1 grep cd --verbose --verbose &&
+		readonly grep /usr/bin echo test printf && grep $(pwd) && 'quoted text'
+		then x=1 -eu $(pwd) readonly
+		/usr/bin export /usr/bin "$1" | done --verbose awk
+		/usr/bin export then export echo 2>/dev/null done sed awk ${HOME} ${HOME}
+local && cd sed $(pwd) ${HOME} "$@" local printf test /usr/bin then readonly
+--verbose then $(pwd) ${HOME} x=1 && $(pwd)
+	-eu then $(pwd) echo --verbose done
+then /usr/bin | awk 2>/dev/null "$@" --verbose sed
+cd grep | -eu printf local --verbose sed done printf awk local ${HOME} echo 2>/dev/null
+--verbose --verbose $(pwd) readonly
+	$(pwd) printf then --verbose grep 2>/dev/null cd $(pwd) $(pwd) echo
+	$(pwd) awk export done done sed 'quoted text' --verbose sed ${HOME} printf -eu
+		/usr/bin grep ${HOME} printf
+	&& 2>/dev/null "$1" 2>/dev/null grep "$@" done awk then awk awk cd
+	--verbose done | readonly 2>/dev/null "$@" "$1" awk x=1 ${HOME} done
+test grep | done 'quoted text'
+	2>/dev/null export 'quoted text' then && readonly x=1 test --verbose export grep
+	&& 'quoted text' -eu grep sed 2>/dev/null "$1"
+	sed readonly export /usr/bin /usr/bin local export 2>/dev/null
+		awk 2>/dev/null sed ${HOME} | readonly 'quoted text' printf export
+		readonly cd "$@" x=1 sed -eu
+readonly readonly 2>/dev/null 2>/dev/null grep echo local | ${HOME}
+		x=1 grep -eu | "$@" awk $(pwd) 'quoted text' local grep --verbose then sed --verbose
+readonly && readonly local && && sed | echo --verbose
+cd readonly --verbose sed /usr/bin readonly | test done
+echo "$1" export --verbose "$1" /usr/bin grep done -eu "$1" /usr/bin test x=1
+&& 'quoted text' readonly | awk /usr/bin test awk x=1
+	-eu "$@" -eu | 'quoted text' sed 2>/dev/null
+		-eu export test grep cd readonly export
+&& grep ${HOME} --verbose local done 2>/dev/null -eu x=1 done echo | grep cd then
+	$(pwd) 'quoted text' printf $(pwd) |
+		cd printf -eu readonly cd export echo
+	--verbose && /usr/bin x=1 readonly grep -eu /usr/bin && cd readonly 2>/dev/null
+	"$1" /usr/bin && awk -eu "$1" $(pwd) "$1" ${HOME} cd done /usr/bin
+		x=1 2>/dev/null done grep /usr/bin /usr/bin then | -eu $(pwd)
+		${HOME} local --verbose export | && sed x=1 x=1 ${HOME} cd local awk printf grep
+		export readonly done awk then test grep ${HOME}
+	then done ${HOME} readonly local /usr/bin
+		sed done -eu 2>/dev/null "$@" "$@" --verbose test
+	${HOME} /usr/bin grep | readonly readonly /usr/bin cd
+$(pwd) printf "$@" 'quoted text' local grep printf then $(pwd)
+		test then grep x=1 then "$@" x=1 sed readonly "$@" readonly --verbose local
+awk $(pwd) "$@" ${HOME} --verbose -eu export awk 2>/dev/null
+		| echo cd printf cd printf grep awk | 2>/dev/null &&
+local 'quoted text' done -eu grep readonly 2>/dev/null export export
+		x=1 | --verbose test local "$1" --verbose && local cd
+		"$@" && | --verbose echo /usr/bin sed awk /usr/bin
+${HOME} 2>/dev/null /usr/bin then readonly | $(pwd) 2>/dev/null
+'quoted text' then /usr/bin
+	$(pwd) -eu x=1 readonly then -eu -eu cd cd
+	'quoted text' sed readonly echo "$1" 'quoted text'
+		"$@" && echo && "$1" && awk grep
+		cd then awk 2>/dev/null
+		echo --verbose 'quoted text' && echo ${HOME} cd sed ${HOME}
+grep echo done done 'quoted text' "$1" "$@" "$@" x=1 local
+	2>/dev/null 'quoted text' /usr/bin x=1 2>/dev/null readonly
+--verbose printf printf test x=1 export printf
+		-eu 'quoted text' cd $(pwd) awk |
+	sed "$1" 'quoted text' printf 'quoted text'
+		local echo sed x=1 local
+printf readonly $(pwd) x=1 test "$@" | printf then
+	grep 2>/dev/null awk x=1 2>/dev/null 2>/dev/null "$1" printf readonly x=1 2>/dev/null
+		| done && cd /usr/bin readonly $(pwd) $(pwd) 'quoted text' "$1" /usr/bin "$1"
+	then then cd 'quoted text' cd awk done test -eu $(pwd) 'quoted text' grep
+		sed x=1 local awk 'quoted text' awk x=1 "$1" cd test "$1" sed test 2>/dev/null
+	sed printf cd printf local grep "$1" x=1 "$1" sed 2>/dev/null 2>/dev/null |
+echo done 2>/dev/null 'quoted text' $(pwd) awk awk 2>/dev/null readonly
+	export printf x=1 test grep "$@" export printf readonly awk "$1" 2>/dev/null
+		2>/dev/null ${HOME} ${HOME} sed -eu cd
+	awk && printf && then cd -eu local | 2>/dev/null
+local --verbose x=1 'quoted text' awk --verbose ${HOME} then --verbose |
+		"$1" x=1 then $(pwd) -eu ${HOME}
+		echo echo awk 2>/dev/null --verbose awk sed $(pwd) done 'quoted text'
+		local sed local && 'quoted text' sed /usr/bin cd grep /usr/bin
+sed $(pwd) && "$@" --verbose done
+	--verbose | local "$1" readonly x=1 test then /usr/bin 'quoted text' 'quoted text'
+	"$1" readonly && then && | echo "$@" /usr/bin
+	--verbose /usr/bin --verbose
+$(pwd) /usr/bin "$1" printf --verbose && /usr/bin
+$(pwd) local "$@" awk awk
+		"$1" $(pwd) --verbose --verbose $(pwd) -eu then test "$@" /usr/bin echo /usr/bin
+"$@" readonly | ${HOME} /usr/bin
+cd && test then 'quoted text' 'quoted text' cd grep 2>/dev/null local export
+	${HOME} cd test local cd readonly done --verbose then then /usr/bin
+awk printf printf "$@" grep "$1"
+		awk 2>/dev/null $(pwd) && then test echo $(pwd) $(pwd) grep sed x=1 ${HOME} /usr/bin
+		grep --verbose awk test x=1 "$@"
+	echo printf ${HOME} && /usr/bin echo local export ${HOME} /usr/bin then ${HOME}
+		local x=1 ${HOME} 'quoted text'
+	done echo -eu cd 'quoted text'
+		done echo | && echo grep ${HOME} | "$@"
+cd awk echo echo readonly echo grep &&
+	grep local && "$1" awk | printf done cd printf --verbose awk cd readonly
+local done && echo ${HOME} ${HOME} test done printf /usr/bin grep x=1
+		"$@" ${HOME} /usr/bin cd local
+${HOME} cd $(pwd) ${HOME} /usr/bin ${HOME} readonly x=1 "$1" "$1" | "$1" ${HOME}
+	"$1" local x=1 then | --verbose echo awk && printf && test ${HOME}
+	then test echo 'quoted text' | 'quoted text' $(pwd) echo 'quoted text'
+done export "$@" printf "$@" local ${HOME} echo x=1 awk then awk local
+local readonly | readonly readonly ${HOME} /usr/bin && | cd awk sed
+		sed 2>/dev/null --verbose export
+		awk x=1 $(pwd) $(pwd) export export "$@" awk local /usr/bin printf
+	"$@" grep 'quoted text' awk local echo local test 'quoted text' 'quoted text' test
+	--verbose local then echo /usr/bin grep
+readonly $(pwd) 'quoted text' sed --verbose awk export "$@" test sed export
+		sed | 'quoted text' awk "$@" "$1" grep readonly 'quoted text' awk
+	grep sed && then -eu "$1" /usr/bin awk x=1 readonly ${HOME} awk then /usr/bin
+	test sed | export sed
+	2>/dev/null 2>/dev/null --verbose 2>/dev/null export --verbose
+		printf printf x=1 test local "$@" x=1 /usr/bin awk
+		"$@" echo done printf $(pwd) sed awk then -eu -eu done ${HOME}
+export test then /usr/bin --verbose "$1"
+		done ${HOME} "$1" awk $(pwd) -eu
+'quoted text' local readonly 2>/dev/null
+	printf "$@" grep done export x=1 awk
+	"$1" cd x=1 grep "$1" readonly x=1 cd grep && awk test local echo test
+$(pwd) --verbose --verbose ${HOME}
+	$(pwd) --verbose done x=1 sed 'quoted text' printf --verbose
+cd ${HOME} -eu awk -eu sed test local awk grep 'quoted text'
+		export "$1" 'quoted text' readonly && sed 'quoted text' grep | sed local
+export "$@" && $(pwd) cd x=1 "$@" ${HOME} test -eu 'quoted text'
+		'quoted text' x=1 $(pwd) x=1 cd cd ${HOME} export test done x=1 | --verbose
+	then x=1 sed "$@" awk 'quoted text' $(pwd) test export ${HOME} $(pwd) x=1 $(pwd)
+grep "$1" local sed readonly
+| grep | readonly 'quoted text' then echo cd |
+	x=1 cd && readonly x=1 | printf 2>/dev/null x=1 "$1" "$1" test echo
+-eu export echo ${HOME} | /usr/bin grep x=1 -eu echo done ${HOME}
+export 2>/dev/null printf --verbose local -eu printf cd echo
+export test "$1" ${HOME} /usr/bin 'quoted text' echo
+echo "$1" echo printf grep grep local sed ${HOME} 2>/dev/null /usr/bin then
+printf local readonly "$1" local && awk grep readonly awk readonly
+	$(pwd) readonly done awk && local then ${HOME} test sed $(pwd) echo export
+		test awk sed | sed $(pwd) echo awk done local
+		echo test ${HOME} $(pwd) cd readonly 2>/dev/null local readonly local /usr/bin
+	export --verbose && $(pwd) $(pwd) x=1 /usr/bin sed && && export cd grep
+"$@" && 2>/dev/null --verbose local cd ${HOME} local test -eu echo
+	--verbose /usr/bin export awk x=1 'quoted text'
+	--verbose echo "$1" printf
+		printf sed --verbose "$1" -eu grep
+		-eu "$@" --verbose echo readonly printf printf -eu $(pwd) ${HOME} |
+| x=1 "$@" local x=1 awk
+		test grep printf test local sed echo $(pwd) grep 2>/dev/null readonly sed
+	--verbose done | sed sed done printf -eu export printf test awk -eu /usr/bin
+echo readonly done then --verbose "$@" 'quoted text' test test
+		/usr/bin done | readonly done readonly && $(pwd) "$1"
+		"$@" 'quoted text' /usr/bin test printf
+	| --verbose awk ${HOME} /usr/bin x=1 awk test printf 2>/dev/null
+		cd awk /usr/bin done done "$@" /usr/bin /usr/bin printf then "$1" --verbose
+grep cd -eu echo $(pwd) awk "$@" 2>/dev/null
+	sed 'quoted text' printf /usr/bin test sed --verbose readonly cd printf awk grep
+awk -eu done && -eu printf --verbose --verbose 2>/dev/null
+"$@" "$@" ${HOME} grep ${HOME} echo cd ${HOME} awk grep /usr/bin
+	${HOME} done echo then
+	--verbose "$1" sed --verbose then | then grep -eu local /usr/bin local printf
+	readonly echo done local export
+'quoted text' "$1" export echo readonly printf test -eu
+		x=1 printf 'quoted text' awk local export | grep && cd printf x=1 echo "$1" sed
+	then readonly sed readonly | local test | &&
+		-eu export awk awk local -eu export "$1" done | | echo readonly test $(pwd)
+x=1 2>/dev/null then /usr/bin export readonly
+done grep grep --verbose echo 2>/dev/null then local && "$1" |
+export | sed 2>/dev/null printf done
+	sed grep then test && ${HOME} 2>/dev/null $(pwd) -eu ${HOME} grep x=1 ${HOME}
+'quoted text' 'quoted text' x=1 done echo grep cd | grep sed x=1 printf
+		cd x=1 2>/dev/null "$@" awk printf "$@" printf -eu "$1" grep
+cd $(pwd) awk && awk | export awk
+		"$1" 'quoted text' 2>/dev/null echo && grep echo sed printf $(pwd) 'quoted text'
+'quoted text' -eu --verbose ${HOME} then cd 'quoted text'
+	export --verbose sed readonly printf -eu local sed 'quoted text'
+		$(pwd) --verbose && "$1" local ${HOME}
+		printf x=1 ${HOME} "$@" ${HOME} printf
+	&& awk "$@" x=1 'quoted text' && done printf "$1" echo readonly test
+"$@" local | $(pwd) x=1 done -eu "$1" readonly
+	echo x=1 echo local $(pwd) awk grep awk -eu --verbose -eu /usr/bin "$1" local
+readonly then $(pwd) readonly
+		"$@" "$1" "$@" 'quoted text' export awk && awk 'quoted text' $(pwd)
+		$(pwd) export test "$@" local --verbose printf done readonly
+		| done echo done local $(pwd) sed grep
+	grep -eu 2>/dev/null cd 2>/dev/null
+printf then cd printf awk done 'quoted text' readonly
+		local export -eu then -eu grep printf local sed
+		--verbose done 2>/dev/null grep done
+-eu awk test done grep sed -eu export printf local local echo "$@" sed
+	done readonly x=1 local x=1 awk awk ${HOME} echo 'quoted text' awk -eu printf
+cd | && done "$@" readonly 'quoted text' local
+	awk done test local grep cd echo -eu | done export then
+		"$@" grep awk 'quoted text'
+		test "$1" x=1 echo echo test then x=1 readonly cd 'quoted text' 2>/dev/null
+sed sed x=1 export awk --verbose
+	&& 'quoted text' x=1 2>/dev/null $(pwd) cd --verbose
+--verbose $(pwd) sed x=1 local 2>/dev/null awk printf echo
+cd ${HOME} cd echo /usr/bin x=1 grep 'quoted text' local /usr/bin /usr/bin 'quoted text'
+"$1" then ${HOME} readonly | awk test done readonly sed local
+test --verbose grep -eu x=1 grep --verbose --verbose
+		echo 'quoted text' done --verbose ${HOME} done
+		grep 'quoted text' sed /usr/bin /usr/bin --verbose -eu /usr/bin
+	$(pwd) echo x=1 export | $(pwd) sed cd printf grep x=1 sed then echo "$1" ${HOME}
+	echo cd cd -eu test $(pwd) then $(pwd) "$1" echo local
+		test grep /usr/bin 'quoted text' /usr/bin
+printf x=1 "$1" readonly grep export 'quoted text' | 2>/dev/null -eu
+&& readonly x=1 "$@" "$1" then --verbose export /usr/bin 'quoted text'
+"$1" "$@" 'quoted text' sed done sed export 'quoted text'
+	then local /usr/bin | "$1" local readonly ${HOME} "$1" grep test
+done readonly then ${HOME} "$@" awk | readonly | && done done "$1" local
+		x=1 printf local "$@" $(pwd) | x=1 readonly
+		x=1 $(pwd) readonly "$1"
+		test local | --verbose printf
+		local $(pwd) ${HOME} then "$@" readonly
+	2>/dev/null export test test ${HOME} sed then x=1 sed
+		x=1 --verbose /usr/bin local -eu local printf then export x=1 "$1" readonly readonly
+	"$@" | --verbose echo test export test echo readonly local awk x=1 cd
+2>/dev/null local 'quoted text' readonly 2>/dev/null
+	| test test grep $(pwd) export grep then ${HOME} echo sed "$@" export test
+		echo x=1 ${HOME} sed --verbose local ${HOME}
+then $(pwd) /usr/bin ${HOME} then awk readonly echo x=1 local
+		x=1 "$@" 2>/dev/null ${HOME} ${HOME} test 2>/dev/null echo test printf
+		'quoted text' printf ${HOME} $(pwd) $(pwd) grep $(pwd) cd readonly
+	cd printf export $(pwd) $(pwd) && test x=1 && awk then
+cd done ${HOME} 'quoted text' echo export cd done 2>/dev/null | /usr/bin
+/usr/bin 'quoted text' awk x=1 $(pwd) x=1 test test
+		sed && 2>/dev/null --verbose ${HOME} grep
+	"$1" printf printf test |
+--verbose "$@" -eu x=1 cd local /usr/bin /usr/bin
+test /usr/bin 'quoted text' local 2>/dev/null then test --verbose cd readonly
+		sed -eu readonly sed echo -eu then 'quoted text'
+		x=1 x=1 -eu --verbose $(pwd) /usr/bin then && &&
+test --verbose ${HOME} x=1
+echo then printf grep grep cd printf test test -eu /usr/bin
+	| local ${HOME} x=1 'quoted text' "$@" "$1" test export
+"$1" echo -eu sed "$1" --verbose /usr/bin /usr/bin export 'quoted text' awk cd
+		'quoted text' test ${HOME} "$@" --verbose readonly -eu && cd sed
+-eu then -eu readonly "$1" /usr/bin test
+2>/dev/null "$@" ${HOME} readonly done awk $(pwd) 'quoted text' /usr/bin
+		/usr/bin local echo 'quoted text' "$1" export local && -eu ${HOME}
+grep && ${HOME} local /usr/bin test "$1" ${HOME} |
+	"$@" sed local grep | ${HOME} && awk sed "$@" done sed "$@" | awk && done
+	| echo cd 2>/dev/null readonly 2>/dev/null sed grep
+	&& readonly $(pwd) 'quoted text' awk
+	printf && awk echo export readonly --verbose grep $(pwd) | $(pwd) 2>/dev/null then
+		local -eu && /usr/bin && sed test local x=1 /usr/bin x=1 local done "$@" ${HOME}
+		"$@" "$1" && 'quoted text'
+local local "$@" x=1 done cd
+test ${HOME} grep 2>/dev/null echo grep
+		'quoted text' done echo && $(pwd) $(pwd) printf 'quoted text' local sed
+	--verbose -eu --verbose then "$@" export -eu x=1 x=1 $(pwd) echo
+done && 'quoted text' awk ${HOME} awk && -eu echo ${HOME} "$1" grep 2>/dev/null
+		cd x=1 done ${HOME} ${HOME} ${HOME} export
+		grep done "$@" | then cd $(pwd) "$@" | $(pwd) "$@" test grep test printf 2>/dev/null
+--verbose "$1" 2>/dev/null
+		local sed echo ${HOME} local readonly printf 'quoted text' 'quoted text' --verbose
+		then grep 'quoted text' -eu | local | $(pwd) awk "$@" printf
+		/usr/bin $(pwd) && -eu done "$1" then 'quoted text' grep awk readonly
+${HOME} 2>/dev/null then then sed printf -eu "$1" $(pwd) awk then
+		&& export echo grep echo test /usr/bin 2>/dev/null
+	done readonly /usr/bin /usr/bin export 'quoted text' ${HOME}
+printf test -eu done then printf 2>/dev/null
+	sed --verbose $(pwd) --verbose | test
+	&& cd done test "$@" /usr/bin
+		'quoted text' cd readonly -eu test "$1" printf test readonly sed
+| done then local ${HOME} ${HOME}
+		readonly --verbose $(pwd) ${HOME}
+	$(pwd) echo $(pwd) readonly
+"$1" grep | "$1" x=1 then grep printf test /usr/bin 'quoted text'
+		2>/dev/null --verbose "$1" export 2>/dev/null x=1 sed ${HOME} local
+		local test "$@" ${HOME} && awk sed done test
+	'quoted text' /usr/bin --verbose 'quoted text' 2>/dev/null local ${HOME}
+		| 2>/dev/null done printf sed /usr/bin cd readonly cd sed $(pwd) "$@" &&
+		'quoted text' awk sed 'quoted text' /usr/bin local /usr/bin
+	'quoted text' && "$1" readonly awk then /usr/bin
+	2>/dev/null sed -eu && grep
+		printf /usr/bin 2>/dev/null
+then x=1 -eu && local /usr/bin printf then "$@" sed ${HOME}
+	readonly 'quoted text'
+		sed done x=1 --verbose && | /usr/bin local x=1 test 'quoted text'
+$(pwd) --verbose "$1" --verbose done export readonly
+	2>/dev/null /usr/bin 2>/dev/null --verbose -eu $(pwd) | "$1" sed awk
+	echo "$@" export 'quoted text' printf done
+		done 'quoted text' "$1" done sed "$@"
+		done && 'quoted text' $(pwd) 'quoted text' "$@" echo --verbose
+$(pwd) /usr/bin "$1" ${HOME} x=1 -eu local local then --verbose /usr/bin 'quoted text'
+readonly --verbose printf ${HOME}
+		export ${HOME} | $(pwd) grep && "$@" readonly cd sed | /usr/bin
+test --verbose export && local /usr/bin test --verbose | --verbose
+		sed | -eu cd echo "$1" echo export cd readonly 'quoted text'
+		echo printf awk local -eu echo readonly 'quoted text' -eu --verbose
+'quoted text' readonly then "$@"
+		printf -eu echo --verbose local sed "$1" sed --verbose "$@" ${HOME} local export
+	printf --verbose test cd sed awk
+	/usr/bin /usr/bin export then cd local done awk grep readonly $(pwd) ${HOME} "$1"
+	${HOME} && 'quoted text' 2>/dev/null
+sed then $(pwd) export cd then cd grep "$@"
+'quoted text' cd "$@" readonly
+	local echo awk local local $(pwd) readonly grep /usr/bin --verbose "$1" 'quoted text'
+${HOME} | then local "$@" 'quoted text' echo "$@" grep awk 2>/dev/null "$1" /usr/bin
+-eu --verbose awk ${HOME} done sed done
+"$@" ${HOME} grep 2>/dev/null "$@" "$1" -eu export printf
+"$1" "$1" -eu readonly 2>/dev/null sed cd test 'quoted text' /usr/bin export
+	then awk /usr/bin done 'quoted text'
+		done $(pwd) readonly test echo test | && "$@" done $(pwd) "$1" sed grep /usr/bin
+&& 'quoted text' local readonly grep readonly x=1 | | export test printf &&
+printf x=1 grep test /usr/bin printf export --verbose cd x=1 /usr/bin
+	test && local "$1" x=1
+	done "$1" test | echo x=1 2>/dev/null echo "$@" readonly printf sed cd awk
+	2>/dev/null export /usr/bin awk --verbose
+		&& cd | $(pwd) test grep echo "$@"
+	cd | readonly "$@" grep "$1" awk readonly 2>/dev/null then $(pwd) sed "$1" $(pwd)
+		export 'quoted text' printf readonly
+'quoted text' && ${HOME} /usr/bin export printf then 2>/dev/null grep export
+		"$@" /usr/bin done grep readonly
+"$@" 'quoted text' x=1 $(pwd) ${HOME} /usr/bin
+export cd $(pwd) "$1" echo local -eu "$@" echo then readonly x=1 && grep
+	cd x=1 test "$@" cd /usr/bin awk printf local
+	'quoted text' --verbose x=1 then 2>/dev/null then -eu
+	echo && echo awk ${HOME} cd /usr/bin
+	"$@" | printf cd 'quoted text' grep && sed
+		test awk | 'quoted text' printf --verbose sed
+| "$@" printf x=1 export local printf then
+		then && 2>/dev/null cd $(pwd) x=1 sed readonly grep
+	cd done 'quoted text' done printf local x=1 then -eu -eu echo "$1" 'quoted text'
+	then sed "$@" x=1 local grep -eu /usr/bin printf "$@"
+		readonly export 'quoted text' -eu $(pwd) sed awk x=1 "$@"
+"$1" && cd | "$1" $(pwd)
+	| export "$1" done echo 'quoted text' local 2>/dev/null
+then "$1" "$1" "$1" $(pwd) local echo --verbose 'quoted text'
+	x=1 | --verbose && sed 2>/dev/null printf
+		/usr/bin echo awk cd export
+$(pwd) sed && sed --verbose 2>/dev/null ${HOME} --verbose 2>/dev/null |
+	-eu printf sed 2>/dev/null "$1" x=1 printf sed $(pwd) && "$@" done --verbose
+		'quoted text' grep awk
+	test | done cd sed 'quoted text' --verbose --verbose
+	echo readonly sed sed --verbose
+		--verbose --verbose printf "$@" $(pwd) done local
+then --verbose echo 2>/dev/null 'quoted text'
+		cd "$1" && 'quoted text' then then 'quoted text'
+	"$1" ${HOME} then | 'quoted text' | cd | local && export --verbose echo -eu &&
+export awk ${HOME} | | grep --verbose
+	then /usr/bin "$1" 2>/dev/null
+		| local -eu awk $(pwd) | "$1"
+'quoted text' 'quoted text' then --verbose
+		-eu local printf cd printf 'quoted text' -eu
+	export $(pwd) 'quoted text' sed readonly awk test test readonly
+done done grep -eu printf then cd "$1" x=1 ${HOME}
+$(pwd) printf ${HOME} $(pwd) -eu
+		sed test ${HOME} ${HOME}
+	"$1" printf | "$1" cd 'quoted text'
+		-eu 'quoted text' export awk "$@" ${HOME} sed test 'quoted text'
+export $(pwd) then done 'quoted text' echo "$1" grep 2>/dev/null test
+x=1 /usr/bin test echo /usr/bin
+		cd test readonly sed $(pwd) echo && --verbose
+	echo | then echo /usr/bin test export test "$1" cd ${HOME} x=1 && | "$@" "$1"
+local done export test done test test grep cd x=1 | echo cd ${HOME}
+readonly grep test --verbose 'quoted text' export && "$1" 2>/dev/null
+printf --verbose 'quoted text' echo then /usr/bin readonly
+		| "$1" $(pwd) $(pwd) then /usr/bin /usr/bin export cd $(pwd) | ${HOME}
+-eu local /usr/bin 'quoted text'
+		&& ${HOME} export local
+		| readonly ${HOME} grep -eu then grep $(pwd) 2>/dev/null -eu "$@" 2>/dev/null
+"$1" printf ${HOME} -eu $(pwd) $(pwd) 2>/dev/null
+	done -eu -eu $(pwd) cd 'quoted text'
+	then ${HOME} test ${HOME}
+-eu readonly /usr/bin --verbose then /usr/bin
+x=1 "$1" "$1" --verbose printf grep $(pwd) ${HOME}
+"$1" done /usr/bin $(pwd) && --verbose grep $(pwd) export -eu 2>/dev/null
+		local /usr/bin 2>/dev/null done printf awk /usr/bin
+grep export && -eu "$1" x=1 | x=1 sed
+	"$@" cd ${HOME} awk printf awk export x=1 'quoted text' /usr/bin export
+	"$1" 'quoted text' sed export readonly export $(pwd) export grep grep
+		grep cd sed export $(pwd) then /usr/bin grep $(pwd) x=1 readonly test export
+		printf export echo -eu cd export $(pwd) echo export
+	"$1" | printf test echo ${HOME}
+'quoted text' ${HOME} "$1" echo
+	echo "$@" 'quoted text' /usr/bin echo 2>/dev/null x=1 then done cd --verbose export
+-eu then echo awk grep "$@" printf done "$1" | awk x=1 export echo "$1" local
+		readonly $(pwd) sed 'quoted text' grep
+		-eu && | 'quoted text' cd grep "$1" | --verbose done awk local local
+	cd | printf x=1 then x=1 x=1 readonly 'quoted text' x=1
+		${HOME} cd grep "$1" "$@" -eu printf
+		${HOME} awk local export 2>/dev/null | awk 'quoted text' printf $(pwd) $(pwd)
+${HOME} echo readonly x=1 'quoted text'
+		x=1 x=1 echo "$@" grep cd cd --verbose local printf printf
+	readonly /usr/bin ${HOME} /usr/bin test
+-eu -eu 'quoted text' | 2>/dev/null grep awk export /usr/bin
+x=1 x=1 'quoted text' "$1" done cd printf "$1" export export ${HOME} x=1
+printf -eu done local -eu local $(pwd) "$1" export
+		"$@" grep 2>/dev/null printf
+test --verbose "$@" $(pwd) test
+	"$@" ${HOME} echo $(pwd)
+		| grep done export | echo
+		export | $(pwd) local "$1" done x=1 "$@" | ${HOME} "$1" |
+'quoted text' grep grep test
+		"$1" done x=1 local done
+		echo cd printf $(pwd) "$@" x=1 x=1 done 2>/dev/null then --verbose
+done 'quoted text' 'quoted text'
+		"$1" "$1" /usr/bin readonly | -eu
+		'quoted text' local --verbose -eu | sed | $(pwd) then local 2>/dev/null
+	"$@" grep local then cd 'quoted text' local && --verbose
+		test sed echo done test sed export
+	done grep $(pwd) | ${HOME} local $(pwd) -eu local --verbose x=1
+	"$@" 'quoted text' cd cd "$@" -eu | 'quoted text'
+	test grep done 2>/dev/null
+local awk -eu export -eu && export printf && sed
+		$(pwd) cd ${HOME} | $(pwd)
+'quoted text' 2>/dev/null done test
+	echo /usr/bin /usr/bin
+		x=1 ${HOME} 'quoted text' echo done "$@" 'quoted text' "$@" printf
+	--verbose printf test then awk grep local
+awk local 'quoted text' echo local done && /usr/bin
+	&& 2>/dev/null echo "$1" /usr/bin x=1 && then |
+	sed awk && sed grep --verbose "$@" grep --verbose $(pwd) test awk done readonly
+awk | readonly 2>/dev/null "$@" ${HOME}
+	"$1" --verbose export "$@" "$1" printf readonly 'quoted text'
+grep ${HOME} grep ${HOME}
+&& export echo local 'quoted text' 'quoted text' export 'quoted text' test x=1
+		local cd -eu sed echo done
+		--verbose x=1 "$@" -eu export
+printf /usr/bin export then echo /usr/bin done $(pwd) readonly
+		test /usr/bin sed 'quoted text' grep awk ${HOME} x=1 then sed --verbose
+	cd "$@" ${HOME} 2>/dev/null ${HOME} test | 2>/dev/null ${HOME} -eu then
+		x=1 cd readonly | then $(pwd) $(pwd) "$1" "$1" echo --verbose
+		grep test "$@" | echo x=1 awk "$1" local
+	local -eu ${HOME} -eu printf 'quoted text' | sed local "$1"
+	&& test grep grep test export local ${HOME} cd
+&& awk test -eu x=1 done --verbose printf done -eu done readonly
+'quoted text' readonly /usr/bin | "$@" --verbose
+		printf awk sed sed | | 2>/dev/null export --verbose x=1 -eu then export
+		grep && ${HOME} sed printf cd "$@" --verbose
+$(pwd) "$1" && test /usr/bin then /usr/bin ${HOME} awk then $(pwd) grep
+		printf "$1" done then | cd "$1" /usr/bin -eu
+x=1 readonly done export $(pwd) | x=1 then "$1" --verbose
+	then echo local | --verbose /usr/bin local x=1 then sed x=1 local cd -eu
+		done "$@" 'quoted text' x=1 readonly
+		"$@" $(pwd) done grep 2>/dev/null awk done --verbose $(pwd)
+${HOME} ${HOME} && --verbose then "$1" printf export printf
+	test -eu then -eu cd echo 'quoted text' "$1" local local sed readonly
+	printf ${HOME} local test local ${HOME} cd "$@" -eu
+	"$@" readonly export | cd cd export --verbose $(pwd)
+	-eu | x=1 awk | cd local -eu
+2>/dev/null ${HOME} grep readonly 'quoted text' export
+		$(pwd) $(pwd) done cd /usr/bin awk
+	2>/dev/null -eu awk then 'quoted text' "$@" --verbose
+'quoted text' 'quoted text' awk x=1 then && sed
+	"$@" 'quoted text' test readonly awk x=1 then x=1 printf local local cd then then
+	&& echo test --verbose $(pwd) readonly 'quoted text'
+	--verbose local /usr/bin echo then x=1 readonly printf
+		readonly sed cd sed /usr/bin /usr/bin --verbose local
+"$1" sed -eu printf /usr/bin
+'quoted text' local awk sed readonly readonly done grep x=1 x=1 2>/dev/null readonly
+		awk awk --verbose test 'quoted text' -eu
+cd readonly --verbose
+		then "$1" awk grep then /usr/bin | echo readonly $(pwd)
+	"$1" done readonly export
+		printf readonly then grep grep printf "$1" -eu 'quoted text'
+		&& then echo 'quoted text' --verbose "$@" $(pwd) test local grep $(pwd)
+	"$1" 2>/dev/null "$@" printf ${HOME} test done awk |
+		&& printf printf done printf x=1 --verbose -eu local
+	readonly test -eu 2>/dev/null 'quoted text' test -eu cd $(pwd) printf | local
+		readonly done sed && $(pwd) && $(pwd) --verbose
+| readonly $(pwd) && ${HOME} test done then
+		x=1 done cd grep x=1 done
+	&& test local then | | /usr/bin ${HOME} 'quoted text'
+	"$@" "$1" -eu then echo test $(pwd) | && sed grep printf grep awk
+	test test x=1 $(pwd) 'quoted text' then sed | sed cd ${HOME} && | /usr/bin
+		awk then $(pwd) cd cd $(pwd) $(pwd)
+		2>/dev/null sed "$1" export printf /usr/bin awk printf export -eu x=1 ${HOME} 2>/dev/null
+		awk 2>/dev/null 2>/dev/null grep grep local | "$@" -eu test ${HOME} sed
+		2>/dev/null $(pwd) awk
+	/usr/bin | | 2>/dev/null done done cd echo ${HOME} done
+${HOME} export export -eu readonly sed done
+echo x=1 -eu printf | "$@"
+	--verbose ${HOME} awk --verbose cd | "$1"
+export 2>/dev/null cd then then $(pwd) echo printf
+echo && cd $(pwd) ${HOME} ${HOME} readonly
+readonly && | then cd export
+		echo export then ${HOME} local 2>/dev/null then "$@" test grep done -eu done x=1
+	2>/dev/null grep | x=1 | local "$@" x=1 awk printf /usr/bin
+&& 'quoted text' | ${HOME} | then --verbose
+		$(pwd) 'quoted text' --verbose
+		readonly export $(pwd) /usr/bin --verbose sed "$@" awk --verbose --verbose x=1 grep
+done export done && && cd readonly "$@" ${HOME}
+readonly then grep 'quoted text' export readonly && cd grep 'quoted text'
+		&& grep readonly --verbose done -eu | awk $(pwd) | export
+	local grep /usr/bin readonly test then readonly test $(pwd) "$1" 'quoted text'
+2>/dev/null sed cd then sed
+	${HOME} x=1 test $(pwd) local
+		grep test "$@" 2>/dev/null cd done
+	$(pwd) printf awk readonly
+		sed echo awk 'quoted text' ${HOME} done
+then 'quoted text' readonly
+export "$@" grep grep "$1" readonly 2>/dev/null | $(pwd) /usr/bin -eu $(pwd)
+grep /usr/bin | readonly | ${HOME} local awk -eu readonly
+		awk export awk export x=1 --verbose awk 2>/dev/null cd awk $(pwd)
+	/usr/bin readonly test ${HOME} 2>/dev/null | sed then done && $(pwd)
+		x=1 "$@" export local /usr/bin "$@" done grep "$@" /usr/bin
+		printf ${HOME} "$1" ${HOME} "$1" readonly sed
+	x=1 export 2>/dev/null printf then then readonly
+		| echo 2>/dev/null then ${HOME} 'quoted text' echo sed "$@" grep echo x=1 $(pwd)
+		$(pwd) printf awk -eu export $(pwd) echo local export cd
+export /usr/bin grep | awk
+sed readonly --verbose ${HOME} local export sed cd
+grep 'quoted text' 'quoted text' "$1" --verbose "$@" && local
+	-eu echo done "$@" test printf awk | x=1 printf ${HOME} readonly
+		x=1 echo && "$@" --verbose export && 2>/dev/null && echo awk /usr/bin
+		echo cd then done grep
+${HOME} "$1" then awk sed "$@" $(pwd) cd sed
+"$1" grep sed export $(pwd)
+$(pwd) -eu $(pwd) x=1 printf |
+	sed test readonly local "$1" --verbose -eu
+--verbose 2>/dev/null awk ${HOME} x=1 "$1" $(pwd) "$1" echo "$1" readonly
+		--verbose $(pwd) | "$1" /usr/bin done then ${HOME} ${HOME} $(pwd) then
+	x=1 awk export ${HOME} | printf -eu 2>/dev/null awk cd "$@" -eu readonly -eu
+		local done test && readonly
+	'quoted text' printf done "$@" done /usr/bin 'quoted text'
+		sed 2>/dev/null /usr/bin cd x=1 then &&
+		grep grep export export done test && && "$1" readonly then
+		--verbose done export --verbose done sed -eu $(pwd)
+		--verbose sed ${HOME} --verbose readonly local --verbose local sed && $(pwd)
+	local && $(pwd) 'quoted text' cd "$@" /usr/bin export 'quoted text'
+then printf test 'quoted text' awk 'quoted text' ${HOME}
+		x=1 ${HOME} awk "$@" "$1" ${HOME} && /usr/bin
+		done cd --verbose then && 'quoted text' test then -eu
+		local echo awk done -eu x=1 readonly $(pwd) local ${HOME} then awk test &&
+grep $(pwd) /usr/bin awk printf "$1" readonly && echo then 2>/dev/null local
+export echo awk 'quoted text' sed test -eu echo 2>/dev/null ${HOME} |
+	sed local done sed done local done "$1" && -eu | export
+'quoted text' grep x=1 local && | --verbose --verbose "$@"
+then "$1" test -eu sed readonly -eu ${HOME} | awk test done awk ${HOME}
+	"$@" awk && --verbose local 2>/dev/null
+	x=1 local cd sed $(pwd) -eu "$@" printf 'quoted text' ${HOME}
+/usr/bin sed local cd "$@"
+x=1 cd --verbose awk awk echo 2>/dev/null "$@" "$@"
+"$1" 'quoted text' ${HOME} "$1" ${HOME} export
+	readonly --verbose done x=1 x=1 --verbose readonly grep && cd
+		then awk cd local | -eu export $(pwd) test awk sed
+${HOME} test sed && then test readonly && --verbose test
+/usr/bin "$1" export /usr/bin awk
+$(pwd) printf "$@" sed local | printf export cd | 'quoted text'
+		export -eu test -eu ${HOME} 'quoted text' printf && test ${HOME} local echo echo
+	sed "$1" done printf ${HOME} | grep sed ${HOME} awk "$@"
+echo sed x=1 cd --verbose && /usr/bin ${HOME} then $(pwd) grep $(pwd) && $(pwd)
+		/usr/bin cd sed local local 2>/dev/null
+sed local export export sed echo export local
+/usr/bin 'quoted text'
+/usr/bin grep cd export awk grep 2>/dev/null | sed $(pwd)
+local readonly | awk 2>/dev/null ${HOME} && -eu && x=1 echo
+	-eu && test x=1 grep sed ${HOME} then readonly $(pwd) echo ${HOME} cd
+		echo ${HOME} /usr/bin /usr/bin ${HOME} /usr/bin $(pwd)
+		printf then printf echo printf cd "$1"
+local sed --verbose then
+		"$1" $(pwd) cd ${HOME} awk done 'quoted text'
+		printf 2>/dev/null then sed $(pwd) export $(pwd) printf && x=1 awk
+&& "$1" then test /usr/bin -eu export 2>/dev/null
+		&& x=1 done sed grep -eu && readonly ${HOME} 2>/dev/null -eu echo ${HOME}
+		"$1" export ${HOME} -eu
+		then test readonly then sed then | printf then "$1" printf "$1" readonly 2>/dev/null
+		cd "$@" "$@" done "$@" done then --verbose /usr/bin x=1
+	&& then 'quoted text' then awk -eu then grep cd export sed && x=1 readonly
+	2>/dev/null done then x=1 "$1" cd grep export --verbose |
+	done local && 'quoted text' cd "$@" "$1" readonly 2>/dev/null ${HOME}
+"$1" --verbose -eu then 2>/dev/null local $(pwd) -eu done 'quoted text'
+		echo "$@" 2>/dev/null cd /usr/bin awk readonly
+	echo local test /usr/bin
+printf "$@" -eu /usr/bin x=1 ${HOME} printf local 2>/dev/null | readonly | awk
+	export && echo -eu done "$1" cd ${HOME} local cd --verbose
+| sed --verbose awk 2>/dev/null 2>/dev/null
+local -eu awk sed 2>/dev/null
+		printf /usr/bin sed x=1 "$1"
+	printf "$1" 2>/dev/null test echo done sed 2>/dev/null then "$@" cd -eu awk
+		cd readonly then /usr/bin grep 2>/dev/null
+	| echo "$@" ${HOME} echo && 2>/dev/null then /usr/bin /usr/bin | test "$1" export
+		export x=1 --verbose grep && export grep awk
+		readonly grep test printf printf ${HOME} -eu | ${HOME}
+&& printf 'quoted text' export readonly -eu ${HOME} test grep grep $(pwd) printf
+		grep echo $(pwd) "$1" /usr/bin
+$(pwd) "$@" | local awk sed ${HOME} $(pwd)
+		"$1" && "$@" "$1" && sed /usr/bin
+		done 'quoted text' export export awk /usr/bin ${HOME} /usr/bin ${HOME} "$1" 'quoted text'
+echo sed then grep $(pwd) awk "$@" --verbose
+	'quoted text' "$@" readonly "$1" x=1 -eu
+	&& 'quoted text' 2>/dev/null $(pwd) cd 'quoted text'
+	&& ${HOME} ${HOME} then awk grep export grep
+| -eu | then x=1 ${HOME} 2>/dev/null /usr/bin
+	export printf "$@" /usr/bin ${HOME}
+	then export "$1" grep test && 2>/dev/null 2>/dev/null printf
+awk "$1" cd "$1" -eu "$@" x=1
+-eu sed done -eu "$@" then echo awk 2>/dev/null
+	2>/dev/null then grep sed printf "$@" 2>/dev/null x=1 awk "$1" "$@" ${HOME}
+	sed $(pwd) grep | echo 2>/dev/null done
+${HOME} --verbose local /usr/bin ${HOME} 'quoted text'
+"$1" printf done $(pwd) x=1 'quoted text'
+x=1 then 'quoted text' sed
+2>/dev/null cd export echo local x=1 test local x=1 export then printf export
+		-eu sed awk awk "$@" done | then grep -eu $(pwd) "$@" -eu |
+"$@" grep "$@" test -eu echo "$@" -eu
+		then -eu export grep test then local && done -eu echo echo "$1" then 'quoted text'
+		grep 2>/dev/null echo done cd printf 2>/dev/null
+	awk then -eu test done echo
+export export grep cd local 2>/dev/null
+		$(pwd) | export 2>/dev/null | -eu printf 'quoted text' 'quoted text'
+	printf local 2>/dev/null /usr/bin 2>/dev/null ${HOME} export export
+		local ${HOME} "$1" done $(pwd)
+grep test "$1" ${HOME}
+	done printf 'quoted text' ${HOME} readonly sed 2>/dev/null
+	printf grep grep echo export 2>/dev/null sed grep "$1" sed /usr/bin then
+	then then "$@" | 'quoted text' done "$@" readonly echo grep 2>/dev/null
+		2>/dev/null printf /usr/bin -eu cd $(pwd) echo sed local done readonly $(pwd)
+	test --verbose local x=1 ${HOME} && "$1" "$1" x=1 then then "$1" --verbose local
+	awk 'quoted text' 2>/dev/null /usr/bin then then /usr/bin echo sed 2>/dev/null awk
+${HOME} --verbose x=1 | ${HOME} done awk awk grep | local 'quoted text'
+	export ${HOME} && /usr/bin "$@" /usr/bin 'quoted text'
+		"$@" cd $(pwd) grep test -eu sed
+	test then -eu local /usr/bin 2>/dev/null awk && $(pwd) 2>/dev/null done
+"$@" test grep then /usr/bin "$@" grep --verbose "$1" | "$1"
+awk readonly cd export grep echo --verbose && 'quoted text' --verbose "$1"
+		2>/dev/null awk x=1 local "$@"
+sed --verbose cd grep 2>/dev/null echo echo test && /usr/bin x=1 -eu
+"$@" sed sed local echo -eu 'quoted text'
+| grep ${HOME} then cd --verbose | --verbose $(pwd) --verbose
+	sed $(pwd) "$@" cd done printf echo x=1 then grep
+	echo sed && grep | "$1" /usr/bin printf
+	-eu then cd export printf sed && ${HOME}
+x=1 export "$@" test local | | "$@" printf cd export sed grep && -eu "$@" echo
+	export ${HOME} then echo echo ${HOME} printf ${HOME} awk
+	local readonly sed done echo | --verbose $(pwd) ${HOME} printf ${HOME} readonly
+	2>/dev/null awk readonly ${HOME} $(pwd) "$1" x=1 done test printf /usr/bin "$@"
+		done && 2>/dev/null export printf done "$1" grep
+	${HOME} sed "$1" --verbose 'quoted text' /usr/bin
+	test export readonly ${HOME} /usr/bin then done local cd local
+	sed printf "$@" local x=1 2>/dev/null
+		export $(pwd) 'quoted text' --verbose
+/usr/bin 2>/dev/null --verbose awk sed | --verbose
+		done echo then echo 'quoted text' ${HOME} grep
+	local x=1 --verbose sed export $(pwd) --verbose x=1
+"$1" 'quoted text' awk x=1
+	done 'quoted text' awk && readonly "$1" 2>/dev/null
+		done $(pwd) $(pwd) awk then readonly
+--verbose -eu cd awk awk $(pwd) grep cd $(pwd) 'quoted text' cd -eu "$1" echo
+	echo x=1 echo /usr/bin && -eu "$1" local ${HOME} -eu local
+	&& $(pwd) readonly /usr/bin $(pwd) x=1 "$1" && test echo local
+		"$@" /usr/bin printf cd 'quoted text' ${HOME} then | test x=1
+--verbose && 2>/dev/null 2>/dev/null
+	done cd $(pwd) grep test -eu readonly 'quoted text'
+	| awk $(pwd) "$@" | readonly
+		cd export export export awk echo --verbose
+test ${HOME} readonly && grep echo sed then
+		printf --verbose awk printf test sed -eu local $(pwd) export readonly
+"$@" done --verbose cd printf test then -eu
+local 2>/dev/null "$1" --verbose cd 2>/dev/null
+		"$@" test done done x=1 -eu
+export $(pwd) x=1 -eu export done ${HOME}
+local "$@" sed --verbose /usr/bin echo --verbose local done awk then
+2>/dev/null x=1 ${HOME} test $(pwd) ${HOME}
+readonly && echo 'quoted text'
+/usr/bin && test "$1" "$@" 'quoted text' -eu awk grep echo &&
+readonly | export 2>/dev/null
+		$(pwd) "$@" echo echo test /usr/bin cd && && readonly
+--verbose --verbose sed test 'quoted text'
+		| cd echo 'quoted text' x=1 then
+#include c177.sh
+		${HOME} && $(pwd) readonly ${HOME} then cd "$1" cd "$@" "$1" 2>/dev/null $(pwd)
+	"$@" $(pwd) 2>/dev/null echo readonly
+		"$@" /usr/bin "$@" 2>/dev/null readonly export readonly
+-eu cd /usr/bin x=1 awk echo then 'quoted text'
+	| 'quoted text' "$@" x=1 $(pwd)
+		test done 2>/dev/null local 'quoted text' ${HOME}
+	/usr/bin "$1" test done export
+	"$1" grep ${HOME} done && |
+	test "$@" $(pwd) echo awk "$1" 'quoted text'
+then x=1 then | sed | ${HOME} local
+done sed -eu && export
+'quoted text' | printf $(pwd) 2>/dev/null
+$(pwd) awk "$1" then local awk /usr/bin && --verbose /usr/bin -eu
+done x=1 /usr/bin $(pwd) /usr/bin $(pwd) then x=1
+	awk "$1" 2>/dev/null
+		export 'quoted text' $(pwd) | 2>/dev/null $(pwd) --verbose ${HOME}
+		${HOME} cd $(pwd) awk -eu awk "$@" ${HOME} test --verbose /usr/bin | "$1" then
+		$(pwd) ${HOME} test "$1" done done 'quoted text' local 2>/dev/null
+	&& awk "$@" grep | test
+		$(pwd) cd cd 'quoted text' export grep
+		grep test 'quoted text' ${HOME} export sed grep -eu && done then
+		"$1" sed /usr/bin grep readonly
+	awk awk sed $(pwd) test sed 'quoted text' x=1 /usr/bin
+	sed done $(pwd) 'quoted text' "$@" | -eu readonly printf readonly
+	grep printf "$@" then | done local local
+	&& ${HOME} export 2>/dev/null 'quoted text' then --verbose local
+	"$@" x=1 sed readonly "$@" ${HOME}
+	"$1" "$1" $(pwd) "$1" --verbose readonly 'quoted text' &&
+		cd local sed -eu ${HOME} "$1" test "$@"
+"$1" && done awk /usr/bin
+		done "$@" -eu sed "$@" $(pwd) "$1" "$@" -eu done then
+done test 2>/dev/null | test --verbose "$@" --verbose "$@" local then cd | grep
+printf --verbose 2>/dev/null "$@" printf
+		| export done done x=1 -eu
+export readonly test /usr/bin local && 'quoted text' /usr/bin 2>/dev/null
+then /usr/bin test readonly "$@" sed echo ${HOME} 'quoted text'
+		"$@" $(pwd) sed && /usr/bin test
+sed grep export done cd --verbose --verbose grep 'quoted text' then
+	'quoted text' readonly ${HOME} "$@"
+	awk local cd | test printf
+&& export awk local 'quoted text'
+	$(pwd) $(pwd) x=1 printf &&
+		sed sed x=1 readonly local "$@" $(pwd) printf --verbose $(pwd) ${HOME}
+-eu sed --verbose -eu echo
+	--verbose done echo | sed
+		then done && readonly echo
+	&& -eu -eu printf local && test done | done local
+		/usr/bin && cd ${HOME} "$1" done $(pwd) sed local
+		done cd | /usr/bin local -eu test echo | export awk local grep "$@" readonly
+"$1" local local x=1
+local && awk sed | test 'quoted text'
+	export ${HOME} sed export done echo then "$1" -eu
+	--verbose export 'quoted text' local then echo test "$@" | -eu
+awk $(pwd) x=1 local ${HOME} && export 2>/dev/null printf sed cd then -eu export
+&& readonly && sed then |
+sed && && 2>/dev/null -eu && 'quoted text' test done /usr/bin
+	done cd x=1 x=1 local printf -eu -eu && readonly $(pwd) awk "$@" then
+	done awk awk echo local | x=1 echo "$@" done local
+$(pwd) "$1" /usr/bin ${HOME} export
+echo local | -eu printf grep awk local
+		done export local 'quoted text' | ${HOME} export awk
+		grep | | export ${HOME} done awk $(pwd) sed grep $(pwd) | 'quoted text'
+		/usr/bin "$1" "$@" sed then -eu x=1 "$1" | done "$1" echo
+printf ${HOME} ${HOME} --verbose readonly then 'quoted text' /usr/bin
+	--verbose --verbose 'quoted text' cd sed export awk && then x=1 | --verbose local
+		${HOME} $(pwd) sed | awk grep cd "$1" cd then done | printf
+	done && echo local x=1 local then
+		echo /usr/bin test --verbose cd awk -eu /usr/bin "$1" then --verbose echo cd x=1
+grep --verbose && readonly awk ${HOME} $(pwd) --verbose done --verbose
+		-eu --verbose grep "$1"
+		test sed awk test awk grep then ${HOME} 'quoted text' local && local "$1" 'quoted text'
+	/usr/bin $(pwd) $(pwd) 2>/dev/null sed echo |
+then x=1 2>/dev/null echo -eu readonly readonly done sed "$@" 'quoted text'
+	/usr/bin 'quoted text' -eu echo sed done awk && -eu local
+test echo && echo done then /usr/bin | export export 2>/dev/null
+echo then "$@" export "$@" local test then "$1" then "$1" && 'quoted text'
+	cd -eu | cd printf grep export then sed local
+		$(pwd) && test awk readonly readonly done sed ${HOME} $(pwd)
+		"$@" printf "$@" echo cd export --verbose
+	grep awk && grep --verbose cd done "$@" export 2>/dev/null grep local cd echo
+	&& cd then readonly readonly "$@" 'quoted text' 'quoted text'
+	awk 2>/dev/null --verbose awk && grep 2>/dev/null
+		test test readonly cd printf cd && "$@" ${HOME} done awk
+/usr/bin done && sed awk echo
+		x=1 export printf ${HOME}
+echo ${HOME} 2>/dev/null x=1 "$@" grep | printf -eu x=1 ${HOME}
+--verbose $(pwd) test export echo then --verbose /usr/bin then readonly
+done ${HOME} export "$@"
+		-eu x=1 x=1 "$1" export done awk
+	then echo 2>/dev/null local
+	"$1" echo then test sed awk
+export then echo sed done export
+/usr/bin printf readonly then
+		echo then grep /usr/bin "$@" done
+	cd sed 'quoted text' "$@" echo --verbose
+		local 2>/dev/null then 'quoted text' cd "$1" local then echo 2>/dev/null
+	-eu | echo 'quoted text' "$1"
+local printf readonly && grep
+		then 'quoted text' x=1 && x=1 local local export -eu cd "$1"
+$(pwd) "$@" --verbose then
+	2>/dev/null | $(pwd) x=1 local awk -eu --verbose
+		${HOME} $(pwd) /usr/bin --verbose grep "$1" /usr/bin test awk local $(pwd) sed
+		local --verbose grep "$@" sed "$@" --verbose /usr/bin
+		"$@" awk --verbose export sed export local ${HOME} "$@"
+	done ${HOME} && && 'quoted text' -eu --verbose
+	sed grep export test -eu export printf x=1 "$1" export
+grep done 2>/dev/null echo awk awk | done
+	2>/dev/null done x=1 /usr/bin
+		&& grep test test -eu local "$@" 'quoted text' x=1 export done 'quoted text'
+		&& --verbose x=1 test grep grep cd then local cd
+echo 'quoted text' cd cd | sed sed ${HOME}
+local "$@" 'quoted text' -eu done x=1 'quoted text'
+		2>/dev/null printf "$@" export grep done | $(pwd) grep ${HOME} | 'quoted text'
+"$1" echo local done 'quoted text' then readonly
+		test -eu 2>/dev/null && sed grep x=1 | "$1" echo cd 'quoted text'
+		local | readonly /usr/bin
+2>/dev/null x=1 2>/dev/null
+/usr/bin export 'quoted text'
+		awk awk $(pwd) cd x=1 | -eu $(pwd) 2>/dev/null 2>/dev/null x=1 | test | sed awk
+		/usr/bin readonly sed "$1" 2>/dev/null |
+		printf readonly $(pwd) -eu
+		echo && -eu -eu x=1 cd --verbose
+sed -eu echo 'quoted text' cd local && && $(pwd) grep 'quoted text' awk --verbose
+"$@" export | "$@" | ${HOME} --verbose awk awk
+	"$1" && 'quoted text' export | test /usr/bin --verbose then echo
+		2>/dev/null awk export local "$1" 'quoted text' test readonly printf 'quoted text'
+		--verbose grep sed cd sed "$1"
+| local awk 2>/dev/null -eu 2>/dev/null 2>/dev/null ${HOME}
+${HOME} $(pwd) cd printf && 2>/dev/null
+then done ${HOME} 'quoted text' export local done
+	'quoted text' | awk then --verbose | grep export echo "$1" local readonly
+	then "$1" ${HOME} printf ${HOME} && sed x=1 $(pwd)
+		2>/dev/null $(pwd) /usr/bin
+	x=1 x=1 grep echo 2>/dev/null 2>/dev/null && -eu ${HOME} --verbose "$@"
+sed x=1 && test readonly --verbose x=1 grep export "$1"
+readonly -eu 'quoted text' 2>/dev/null /usr/bin then sed local 'quoted text'
+		"$1" printf local done | $(pwd) ${HOME} sed 2>/dev/null 'quoted text'
+		${HOME} done printf ${HOME}
+	"$1" 2>/dev/null $(pwd) | ${HOME} $(pwd)
+		/usr/bin awk "$1" $(pwd) local $(pwd) readonly 2>/dev/null
+		-eu cd "$@" sed cd 'quoted text' ${HOME} && && x=1 x=1 x=1
+done "$1" 'quoted text' readonly | export /usr/bin then /usr/bin readonly
+		| done "$@" "$@" grep test 2>/dev/null 2>/dev/null x=1 sed | local echo
+2>/dev/null 2>/dev/null then x=1 test "$1" --verbose done then printf echo
+		/usr/bin printf x=1 "$1" local --verbose test "$1"
+		grep printf -eu $(pwd) test sed
+	/usr/bin then printf printf -eu export | export printf cd $(pwd) 2>/dev/null
+	--verbose | | readonly grep | then /usr/bin $(pwd) printf 2>/dev/null
+		"$1" awk export cd | awk test cd 'quoted text' x=1 done readonly | grep
+		"$@" echo x=1 /usr/bin "$@" printf
+		readonly $(pwd) then
+| "$1" ${HOME} awk 'quoted text'
+		$(pwd) 'quoted text' sed sed cd $(pwd) && then
+	awk && then awk $(pwd) -eu 2>/dev/null
+		readonly $(pwd) /usr/bin "$@" awk --verbose --verbose grep && printf && "$1" local
+	-eu $(pwd) -eu sed printf printf export done 'quoted text'
+--verbose "$1" local done
+		$(pwd) sed $(pwd) --verbose awk x=1 then --verbose done /usr/bin ${HOME} sed
+-eu then test cd ${HOME} && -eu "$1" 'quoted text'
+		test | -eu x=1 then done cd export x=1 cd
+		done | export readonly echo echo && then readonly --verbose 'quoted text'
+2>/dev/null /usr/bin readonly test awk "$1"
+		done sed 'quoted text' | done local readonly && "$1" --verbose local echo
+		-eu cd echo $(pwd) | printf echo | | done sed echo grep printf
+	awk -eu then then "$1" "$1" ${HOME} /usr/bin grep --verbose /usr/bin awk --verbose
+		echo x=1 readonly "$@"
+		export | | sed printf | echo test | readonly ${HOME} printf "$@"
+readonly cd awk local echo
+grep && readonly sed "$@" "$1" export test done cd test "$@" -eu export
+		${HOME} /usr/bin printf then
+	'quoted text' then readonly export echo sed local ${HOME} readonly cd "$@"
+export local "$1" $(pwd) | | echo
+	/usr/bin /usr/bin ${HOME} sed test 2>/dev/null then | local "$@"
+		cd && x=1 /usr/bin sed $(pwd) && | ${HOME} then cd awk --verbose
+then echo awk /usr/bin /usr/bin 'quoted text' echo export ${HOME} done --verbose
+		2>/dev/null printf 'quoted text' x=1 readonly grep --verbose
+echo sed "$1" /usr/bin echo $(pwd) printf
+${HOME} cd local grep ${HOME} --verbose done ${HOME}
+'quoted text' 'quoted text' test then then done -eu readonly
+	| -eu test "$1" sed then 2>/dev/null readonly local then printf ${HOME} --verbose
+		x=1 then ${HOME} awk -eu then && done then 2>/dev/null -eu test
+		done ${HOME} cd /usr/bin readonly 2>/dev/null 'quoted text' && 'quoted text'
+	-eu awk printf export --verbose ${HOME} x=1 --verbose
+		echo "$1" ${HOME} -eu grep --verbose 2>/dev/null
+		&& $(pwd) 'quoted text' cd echo "$@" export -eu sed printf /usr/bin grep ${HOME}
+	sed x=1 then | export --verbose | then --verbose 2>/dev/null -eu ${HOME}
+/usr/bin sed ${HOME} 'quoted text' grep
+${HOME} 2>/dev/null test test echo
+		grep done printf export x=1 done
+--verbose "$@" done 'quoted text' /usr/bin
+	grep printf sed cd awk --verbose -eu | grep
+		export readonly echo done "$@" sed echo "$1" echo x=1 -eu 2>/dev/null
+export /usr/bin "$@" grep && "$@" 2>/dev/null
+done x=1 test "$1" export readonly done readonly
+	x=1 printf x=1 'quoted text' 2>/dev/null ${HOME} "$@" done test grep
+		printf awk ${HOME} sed /usr/bin ${HOME}
+		then --verbose $(pwd) printf then test done $(pwd) test -eu
+test export "$@" /usr/bin | awk /usr/bin then ${HOME} echo
+--verbose /usr/bin 2>/dev/null grep 2>/dev/null
+		local readonly $(pwd) export -eu 2>/dev/null
+'quoted text' cd export && then sed ${HOME} && printf $(pwd) test done 'quoted text'
+export sed echo x=1 'quoted text' awk ${HOME} export sed "$@" sed "$1" &&
+	echo done /usr/bin grep 2>/dev/null
+echo "$@" awk export x=1 test local /usr/bin 2>/dev/null export done sed
+cd then 2>/dev/null awk
+"$@" | echo 'quoted text' grep done x=1 cd -eu test $(pwd) "$@" grep
+	printf local sed printf x=1 ${HOME} cd readonly 2>/dev/null
+		x=1 test "$@" test | | ${HOME} local --verbose echo sed $(pwd) "$@" readonly
+readonly /usr/bin x=1 ${HOME} x=1
+		"$@" 2>/dev/null cd x=1 export export -eu -eu
+cd cd | -eu x=1 readonly x=1 local printf cd echo --verbose |
+2>/dev/null "$1" | 2>/dev/null ${HOME} grep sed
+		sed ${HOME} | sed 'quoted text' cd | printf echo -eu done done "$1" then
+		-eu test ${HOME} grep sed cd
+&& sed x=1 echo "$@" /usr/bin --verbose echo then 2>/dev/null "$@" printf
+| local --verbose export export 'quoted text' 2>/dev/null
+awk printf 'quoted text' test /usr/bin /usr/bin export cd done 2>/dev/null
+		done readonly x=1 && echo readonly echo "$@" printf export done $(pwd) awk grep
+		echo | readonly /usr/bin -eu 'quoted text' "$1" ${HOME} echo
+		x=1 | "$@" readonly --verbose readonly x=1 grep local echo $(pwd)
+	${HOME} printf "$1" x=1 then sed -eu printf --verbose
+		then readonly 'quoted text' awk export 2>/dev/null test | | then &&
+echo ${HOME} --verbose "$1" "$1" done --verbose grep --verbose
+		'quoted text' then -eu printf ${HOME} sed done
+	"$1" | /usr/bin test export local printf cd export -eu
+--verbose --verbose test readonly "$1" -eu x=1 then awk /usr/bin -eu
+	&& awk then export -eu awk
+		/usr/bin $(pwd) "$@" echo grep
+	grep awk ${HOME} $(pwd) echo "$@"
+-eu sed export 2>/dev/null ${HOME} --verbose local
+"$@" x=1 && "$1" awk grep "$1" --verbose
+		export grep then ${HOME} | cd grep then done && ${HOME} awk
+		printf awk $(pwd) test echo && /usr/bin awk export | done x=1 then
+${HOME} sed then echo awk x=1
+		/usr/bin cd "$1" && ${HOME} test
+		local -eu sed sed done readonly "$1" echo sed /usr/bin $(pwd) awk test
+	$(pwd) ${HOME} -eu 2>/dev/null
+	done "$1" ${HOME} $(pwd) grep 2>/dev/null printf && x=1
+	test -eu x=1 /usr/bin test grep -eu -eu test "$1" | cd | done
+		${HOME} done then "$1" -eu && 'quoted text' /usr/bin "$1" local export "$1"
+$(pwd) ${HOME} local -eu && 'quoted text'
+	then x=1 done /usr/bin grep done grep export -eu done x=1 cd
+		x=1 export x=1 $(pwd) ${HOME} done awk | then
+-eu readonly done local awk ${HOME} grep sed 'quoted text' grep then done
+		--verbose --verbose "$@" grep $(pwd) done sed 2>/dev/null echo
+	x=1 'quoted text' /usr/bin cd local printf export x=1 readonly &&
+	then test --verbose x=1 /usr/bin
+awk printf test && 'quoted text' test printf -eu
+--verbose printf sed x=1 2>/dev/null 'quoted text' export
+		/usr/bin 'quoted text'
+		$(pwd) && 2>/dev/null "$1" readonly done local 'quoted text'
+--verbose cd && 2>/dev/null --verbose
+	x=1 --verbose done cd sed then done /usr/bin
+	'quoted text' awk | local test 'quoted text' 'quoted text' then
+		then "$@" then 'quoted text' --verbose -eu x=1
+		"$1" 'quoted text' test x=1 done x=1 awk echo 2>/dev/null
+		sed grep done local export 'quoted text' local /usr/bin grep 2>/dev/null
+		printf && sed printf && -eu printf |
+		&& --verbose then printf then done x=1 readonly
+	awk test x=1 cd done sed --verbose $(pwd) test 'quoted text'
+awk done test then | $(pwd)
+		--verbose -eu --verbose x=1 cd "$@" -eu readonly readonly grep --verbose
+	2>/dev/null readonly then 2>/dev/null local x=1 x=1 -eu /usr/bin
+	x=1 printf | -eu "$1" ${HOME}
+	${HOME} 2>/dev/null export printf printf
+		sed "$@" done local sed printf x=1 readonly readonly && x=1
+		cd export echo export x=1 cd | | 'quoted text'
+	"$1" cd grep awk $(pwd) "$1" export 2>/dev/null ${HOME} | "$1" -eu printf
+	printf sed "$1" "$@" && sed "$@" echo -eu
+/usr/bin done export /usr/bin x=1 "$1" $(pwd) 'quoted text' "$1" /usr/bin /usr/bin
+local readonly grep export ${HOME} -eu | ${HOME} x=1 local done /usr/bin
+	$(pwd) | x=1 sed local ${HOME} $(pwd) ${HOME}
+	echo 2>/dev/null cd test printf awk sed
+	sed "$1" grep sed sed then | x=1 printf ${HOME} grep cd cd
+	/usr/bin grep -eu | sed done awk
+/usr/bin echo sed -eu readonly printf /usr/bin && $(pwd)
+	cd -eu printf local cd
+grep 2>/dev/null | "$1"
+"$1" 'quoted text' local 'quoted text' test "$1" "$1" test local $(pwd)
+"$1" | 2>/dev/null awk x=1 $(pwd) /usr/bin -eu /usr/bin grep test local awk export
+		/usr/bin done test x=1 readonly cd readonly
+		2>/dev/null ${HOME} 'quoted text'
+		local ${HOME} local readonly printf cd "$1" --verbose echo
+	"$@" x=1 /usr/bin sed awk "$1" -eu "$1" ${HOME} $(pwd) echo && cd
+test -eu x=1 "$1" /usr/bin -eu /usr/bin cd export /usr/bin "$1" "$1" test
+		export 2>/dev/null echo --verbose
+"$@" echo "$@" 2>/dev/null "$@" grep x=1 'quoted text' printf
+awk grep 'quoted text' "$1"
+readonly x=1 done -eu readonly
+		/usr/bin /usr/bin echo awk echo echo "$1" /usr/bin
+| export x=1 && readonly done -eu $(pwd) /usr/bin "$@" x=1 "$@" -eu
+	awk x=1 echo done local -eu /usr/bin printf 2>/dev/null /usr/bin echo 2>/dev/null
+	"$1" -eu 2>/dev/null printf readonly awk /usr/bin "$@" --verbose "$1"
+| ${HOME} printf /usr/bin export
+		local --verbose echo printf done local &&
+		grep ${HOME} $(pwd) echo awk printf awk test 'quoted text' local "$1" 2>/dev/null
+echo cd test && x=1 local sed 'quoted text' done grep export test done /usr/bin
+		readonly "$1" export awk "$@" 2>/dev/null readonly /usr/bin $(pwd) test cd local
+	readonly cd 2>/dev/null local sed 'quoted text' cd "$1" $(pwd) done
+/usr/bin awk then "$1" x=1 x=1 -eu done done cd then sed done done local $(pwd)
+--verbose awk -eu awk && local done grep
+		test --verbose --verbose --verbose /usr/bin readonly grep && 2>/dev/null echo grep
+${HOME} | awk done cd x=1 then export
+'quoted text' 'quoted text'
+		test /usr/bin /usr/bin |
+		echo $(pwd) -eu /usr/bin readonly | /usr/bin
+	/usr/bin awk | "$1" readonly then
+	${HOME} grep 'quoted text' printf $(pwd) readonly "$@"
+-eu cd "$@" grep grep local --verbose
+		"$@" -eu -eu sed | 2>/dev/null printf $(pwd) ${HOME}
+&& x=1 "$@" "$1" local local readonly && then ${HOME} done "$@" && done
+		"$@" grep ${HOME} sed export "$@" "$1" readonly
+	awk /usr/bin 2>/dev/null && local sed
+	done 2>/dev/null readonly printf
+	'quoted text' test -eu echo export
+export echo echo local echo grep printf x=1 'quoted text' then
+		/usr/bin sed grep $(pwd) --verbose
+"$@" readonly x=1 local 2>/dev/null
+		export readonly readonly /usr/bin
+	grep -eu local grep $(pwd)
+		echo then cd export done echo echo
+	test | 'quoted text' | $(pwd) export /usr/bin --verbose /usr/bin then 2>/dev/null
+printf --verbose && 'quoted text' --verbose printf ${HOME} 'quoted text'
+	/usr/bin grep x=1 2>/dev/null sed -eu /usr/bin cd grep
+$(pwd) test awk 'quoted text' done -eu --verbose
+	test 2>/dev/null "$1" x=1 export --verbose local echo done grep sed
+	then x=1 2>/dev/null test printf "$1" "$@" | echo readonly
+	"$@" ${HOME} echo "$1" | 2>/dev/null echo 2>/dev/null 'quoted text'
+		'quoted text' && --verbose echo ${HOME} "$1"
+		printf ${HOME} 2>/dev/null && readonly cd sed ${HOME}
+&& readonly && ${HOME} done cd 'quoted text' 'quoted text' --verbose export
+	--verbose test readonly done 2>/dev/null "$@" done local /usr/bin done
+	echo export cd grep cd && export x=1 $(pwd) "$@" export | readonly | | test
+		printf "$@" /usr/bin sed export --verbose "$@"
+		/usr/bin done then --verbose echo /usr/bin
+--verbose --verbose done "$@" grep 2>/dev/null awk ${HOME} awk 'quoted text'
+	grep cd local cd && 'quoted text' /usr/bin "$1" x=1 cd then export /usr/bin "$1"
+		sed /usr/bin export export "$@" x=1 cd ${HOME} | $(pwd) printf readonly
+		printf --verbose test /usr/bin export 'quoted text'
+	x=1 printf then && x=1 "$@" ${HOME} | ${HOME} x=1 readonly
+		sed "$@" ${HOME} printf "$@"
+		${HOME} grep --verbose then readonly awk $(pwd)
+2>/dev/null 2>/dev/null
+	test ${HOME} sed --verbose 2>/dev/null local
+		"$1" grep | sed "$@" grep x=1 awk 2>/dev/null then export echo "$1"
+"$1" ${HOME} && --verbose echo cd --verbose -eu then x=1 'quoted text'
+	x=1 | "$1" test awk sed sed && --verbose
+${HOME} echo ${HOME} printf -eu 2>/dev/null
+	done "$1" done -eu 'quoted text' x=1 --verbose ${HOME} "$@"
+cd && 'quoted text' ${HOME} 2>/dev/null 'quoted text' test done
+		"$@" "$@" 2>/dev/null done echo cd "$@" --verbose local test done test /usr/bin
+	done -eu -eu 'quoted text'
+	--verbose x=1 2>/dev/null "$1"
+	test then && /usr/bin cd printf
+		/usr/bin readonly echo
+		${HOME} && /usr/bin --verbose sed ${HOME} then readonly && x=1 "$@" --verbose printf
+	done printf 2>/dev/null test printf
+readonly sed && export echo sed -eu x=1 export echo --verbose readonly then
+	'quoted text' $(pwd) --verbose --verbose "$1" "$1" then 2>/dev/null then --verbose
+	export cd 'quoted text' "$@"
+		$(pwd) 2>/dev/null "$@" "$1" ${HOME}
+'quoted text' x=1 --verbose $(pwd) && 'quoted text' test /usr/bin ${HOME}
+$(pwd) cd && then -eu test "$@" ${HOME} cd x=1 readonly
+'quoted text' /usr/bin echo /usr/bin --verbose readonly
+	$(pwd) 2>/dev/null printf ${HOME} "$1" echo local cd cd ${HOME}
+	&& -eu 2>/dev/null echo local x=1 'quoted text' export cd
+	local printf "$1" x=1 printf $(pwd) "$@" | "$1" 'quoted text' local
+	2>/dev/null export $(pwd) grep "$@" cd 2>/dev/null &&
+		x=1 echo echo $(pwd) grep | awk 2>/dev/null cd --verbose local local test
+done "$@" printf $(pwd) "$@" then awk awk "$1"
+local readonly awk echo then --verbose printf readonly
+	--verbose readonly sed readonly readonly | --verbose /usr/bin export "$@" &&
+	printf readonly cd export x=1 printf echo done grep -eu && &&
+&& x=1 test sed test ${HOME} "$1" 2>/dev/null --verbose sed printf
+	cd "$@" then local local "$1" readonly /usr/bin /usr/bin test --verbose "$@"
+2>/dev/null printf $(pwd) local --verbose 'quoted text' awk grep
+		| test printf && "$@" local 'quoted text' 2>/dev/null ${HOME} awk then echo
+cd "$@" local export x=1 printf 2>/dev/null 'quoted text' local 'quoted text'
+		${HOME} then awk then && --verbose echo && --verbose 'quoted text' cd
+	--verbose sed readonly /usr/bin
+	$(pwd) --verbose ${HOME}
+	2>/dev/null echo | ${HOME} readonly --verbose awk test /usr/bin
+	"$1" local cd local awk 2>/dev/null
+done x=1 x=1 sed local "$@"
+	&& && echo echo local cd echo sed export printf sed
+		&& echo x=1 2>/dev/null awk "$@"
+	grep "$1" sed x=1 cd grep then test
+		/usr/bin -eu $(pwd) ${HOME} -eu 2>/dev/null "$@"
+export cd awk readonly | $(pwd) 'quoted text'
+${HOME} export | test export local cd | then awk grep readonly "$@" -eu x=1
+-eu /usr/bin --verbose "$1" && $(pwd) readonly 2>/dev/null awk | awk
+	$(pwd) "$1" 'quoted text' done 'quoted text' "$@"
+--verbose 2>/dev/null 'quoted text' | 'quoted text' 2>/dev/null
+		grep then x=1 readonly local
+	sed cd test "$@" "$1" awk /usr/bin local
+		&& $(pwd) ${HOME} export done "$1" --verbose
+$(pwd) readonly -eu x=1 awk export $(pwd)
+		local $(pwd) then local 2>/dev/null
+		/usr/bin printf readonly $(pwd) export awk x=1 ${HOME}
+printf readonly cd "$@" test "$@" done /usr/bin sed readonly -eu echo
+$(pwd) "$@" -eu done export x=1 "$1" grep cd readonly ${HOME}
+&& done ${HOME} x=1 printf 2>/dev/null /usr/bin "$1" cd && && &&
+readonly echo export -eu $(pwd) export x=1 then $(pwd) test
+--verbose then ${HOME} echo $(pwd) "$1" echo --verbose "$@" --verbose done -eu
+export "$@" done x=1 -eu x=1 local grep cd && grep local 2>/dev/null
+	--verbose | 'quoted text'
+		-eu 'quoted text' --verbose -eu | /usr/bin |
+$(pwd) done "$@" cd readonly sed echo sed awk test
+	export 'quoted text' ${HOME} $(pwd) grep x=1
+	"$@" | "$1" sed readonly echo local readonly done echo && &&
+grep printf $(pwd) printf printf /usr/bin "$1" test "$1" grep x=1
+&& grep then /usr/bin export cd done 2>/dev/null | ${HOME} awk local --verbose
+done printf ${HOME} sed ${HOME}
+readonly | grep | --verbose
+--verbose grep $(pwd) "$1" cd test "$@" printf
+	export test printf export
+	$(pwd) grep echo then readonly --verbose -eu --verbose local
+awk echo printf test readonly then
+local 2>/dev/null test sed 'quoted text' awk echo
+	local "$@" readonly 2>/dev/null local sed ${HOME} export echo
+		done $(pwd) x=1 test cd sed 'quoted text' grep && x=1 $(pwd) echo grep
+	then done /usr/bin --verbose /usr/bin grep $(pwd) | awk 2>/dev/null "$@"
+		export "$1" export done awk "$@" /usr/bin
+		grep echo 2>/dev/null echo x=1 sed /usr/bin sed export awk $(pwd)
+		then readonly --verbose --verbose grep 2>/dev/null
+	awk test $(pwd) -eu readonly grep x=1 "$@" awk readonly then && -eu /usr/bin "$1"
+	printf test awk printf 2>/dev/null --verbose -eu done
+awk cd && -eu export "$1" grep then x=1 readonly then echo "$@"
+	/usr/bin sed "$@" grep
+		grep --verbose /usr/bin export x=1 && test then
+-eu cd x=1 x=1 cd -eu done then /usr/bin /usr/bin && --verbose ${HOME} printf
+		"$@" 'quoted text' && "$1" readonly "$1" /usr/bin awk /usr/bin
+		"$1" && | x=1 test awk --verbose printf "$@"
+	printf export x=1 ${HOME} 2>/dev/null -eu sed 'quoted text'
+--verbose 'quoted text' export local done && --verbose echo 2>/dev/null
+		test cd "$@" --verbose --verbose "$@" $(pwd) awk sed readonly x=1
+	| x=1 ${HOME} | test "$1" "$1" readonly grep && && test /usr/bin readonly
+		/usr/bin x=1 ${HOME} export --verbose --verbose "$@" 2>/dev/null
+		| awk grep export --verbose done sed readonly --verbose
+		--verbose sed local | grep /usr/bin x=1 /usr/bin /usr/bin printf grep
+		grep /usr/bin /usr/bin export export
+		${HOME} printf cd cd echo && | --verbose | --verbose awk 2>/dev/null
+	--verbose 2>/dev/null -eu ${HOME} && -eu ${HOME} done echo 'quoted text'
+		grep -eu local awk local local $(pwd) $(pwd) /usr/bin readonly grep echo 'quoted text'
+"$1" echo local "$1" done cd ${HOME} $(pwd) printf
+echo export cd readonly ${HOME} 'quoted text'
+"$@" grep | ${HOME} test | x=1 sed /usr/bin
+	printf local test echo done readonly --verbose
+		"$1" | sed readonly grep
+		readonly ${HOME} -eu sed printf cd local echo $(pwd) --verbose | /usr/bin
+		awk ${HOME} "$1" export done /usr/bin "$@" printf
+--verbose test done -eu 'quoted text' --verbose cd 2>/dev/null -eu sed
+		readonly done -eu done /usr/bin "$@" local local cd -eu -eu test awk && test
+	grep done cd readonly $(pwd) readonly
+| grep test -eu $(pwd) grep "$1" then "$@" $(pwd) "$1"
+echo ${HOME} echo awk "$1" x=1
+		${HOME} printf awk ${HOME} echo ${HOME} 'quoted text' awk 'quoted text'
+		x=1 "$@" export && $(pwd) | /usr/bin echo done awk "$1" ${HOME} test printf then
+		/usr/bin && test 2>/dev/null --verbose awk "$1" | export -eu -eu 2>/dev/null
+	echo then ${HOME} readonly
+	local test awk 2>/dev/null awk $(pwd)
+		--verbose export then readonly echo /usr/bin /usr/bin printf test sed
+	$(pwd) then local echo -eu 2>/dev/null export awk test 2>/dev/null --verbose
+"$@" --verbose sed awk /usr/bin export echo
+-eu test then && done --verbose --verbose local awk 'quoted text'
+	then local awk -eu echo test --verbose
+cd readonly readonly printf -eu local
+-eu "$@" x=1 readonly &&
+	&& awk x=1 export /usr/bin local x=1 --verbose "$1" test -eu
+--verbose ${HOME} readonly readonly awk then x=1 awk grep 'quoted text' cd
+test then && $(pwd) sed grep then then done /usr/bin readonly test &&
+	local sed -eu grep ${HOME} readonly ${HOME} grep /usr/bin -eu $(pwd)
+		awk | --verbose ${HOME} /usr/bin | cd "$1" test -eu then "$1" $(pwd) x=1 | then
+	${HOME} cd | ${HOME} $(pwd) && --verbose sed then && 2>/dev/null local 'quoted text'
+done -eu x=1 sed awk -eu "$@" "$@" ${HOME} "$1" "$1"
+		cd export then sed 2>/dev/null "$1" then /usr/bin
+		"$@" x=1 'quoted text' "$1" cd local echo awk $(pwd) 'quoted text' sed /usr/bin
+		grep grep -eu cd | then grep "$@" then /usr/bin --verbose
+		2>/dev/null echo readonly printf x=1 local test sed | --verbose
+local /usr/bin $(pwd) /usr/bin grep
+		readonly echo ${HOME} local local cd local
+	awk --verbose done "$1" cd test sed done sed export printf test --verbose printf
+		readonly 2>/dev/null ${HOME} test readonly --verbose
+"$1" /usr/bin 'quoted text' cd local "$1" | --verbose
+	export | done "$@" -eu cd $(pwd) done grep echo echo 2>/dev/null && "$1"
+	-eu "$@" readonly "$@" "$@" /usr/bin 2>/dev/null /usr/bin test &&
+		/usr/bin awk "$@" 2>/dev/null test printf -eu x=1 --verbose
+	echo /usr/bin 2>/dev/null "$1" 'quoted text' readonly export -eu done ${HOME}
+${HOME} done -eu --verbose x=1 /usr/bin -eu | cd grep
+		/usr/bin ${HOME} 2>/dev/null sed test
+"$@" && | | printf local awk "$1" awk grep test awk && $(pwd) && export $(pwd)
+	local && local "$1" readonly then export --verbose export printf --verbose
+	sed -eu test local cd
+	'quoted text' -eu ${HOME} 'quoted text' $(pwd) 'quoted text' export "$@"
+${HOME} $(pwd) test then grep && /usr/bin 'quoted text' printf printf x=1 | &&
+| ${HOME} /usr/bin 2>/dev/null
+"$1" cd local | export "$@" test
+		export x=1 "$1" export && "$1" ${HOME} -eu export && done 2>/dev/null test "$1"
+	grep grep /usr/bin /usr/bin
+	done x=1 x=1 ${HOME} local /usr/bin && x=1 grep "$@" --verbose 2>/dev/null local
+		echo "$1" /usr/bin done "$@" "$1" local local ${HOME} awk cd cd "$1" ${HOME}
+		&& awk readonly x=1 test test local && ${HOME} printf
+	$(pwd) cd awk echo -eu test sed grep && sed /usr/bin
+$(pwd) echo cd echo test -eu cd printf cd $(pwd)
+		then awk grep $(pwd) /usr/bin done readonly then export &&
+	export echo 2>/dev/null grep "$@" 'quoted text' cd sed --verbose then
+	-eu "$1" awk echo $(pwd) export test --verbose --verbose sed grep
+then printf then awk "$1" echo 'quoted text'
+-eu printf readonly readonly "$1" x=1 awk --verbose
+	printf readonly $(pwd) export export readonly test local then
+		'quoted text' export echo awk --verbose && $(pwd)
+2>/dev/null ${HOME} echo cd "$@" done export
+		then ${HOME} local "$@" "$@" then ${HOME} printf --verbose
+-eu echo echo /usr/bin awk printf --verbose
+		--verbose "$@" /usr/bin grep
+		readonly x=1 2>/dev/null 2>/dev/null
+		&& grep 'quoted text' echo local -eu
+	"$@" -eu ${HOME} && 2>/dev/null local export "$1" $(pwd) "$1" ${HOME} x=1 local
+test cd local then | /usr/bin 'quoted text'
+	2>/dev/null $(pwd) /usr/bin "$@" done export
+	export --verbose | 'quoted text' printf export --verbose 2>/dev/null
+		x=1 $(pwd) export x=1 test && awk cd /usr/bin then /usr/bin export $(pwd) readonly
+test then | export -eu done /usr/bin "$1" local --verbose cd readonly -eu &&
+		grep /usr/bin done sed --verbose test sed readonly
+	$(pwd) --verbose 2>/dev/null
+	done 'quoted text' cd grep printf
+		sed grep -eu "$1" --verbose then grep local awk && 2>/dev/null
+	"$1" 'quoted text' /usr/bin echo awk 2>/dev/null then local | /usr/bin
+then cd "$@" echo /usr/bin then awk ${HOME} done printf
+		-eu ${HOME} $(pwd) then | sed | printf 2>/dev/null $(pwd)
+	"$1" echo -eu | 2>/dev/null --verbose 'quoted text'
+		readonly awk /usr/bin awk awk /usr/bin printf /usr/bin local cd /usr/bin "$@"
+&& cd sed "$1" export export -eu ${HOME} x=1 local ${HOME} done ${HOME}
+/usr/bin "$1" grep export "$@" echo readonly echo
+	x=1 --verbose then printf grep test test export 'quoted text'
+	$(pwd) cd --verbose local then done "$@"
+	echo "$1" x=1 sed sed /usr/bin | && grep ${HOME}
+grep test /usr/bin printf
+done $(pwd) done grep echo sed grep done then test
+		2>/dev/null x=1 then x=1 'quoted text' | $(pwd) /usr/bin cd export
+		grep printf | --verbose export readonly ${HOME} ${HOME} 2>/dev/null
+		-eu export awk awk /usr/bin test test /usr/bin then
+	export && sed awk && readonly --verbose ${HOME} local then test export
+test readonly sed readonly --verbose readonly readonly 2>/dev/null "$1"
+	"$1" "$@" | cd && x=1 echo export cd
+	x=1 export -eu 2>/dev/null grep
+		readonly && $(pwd) echo ${HOME}
+	echo echo ${HOME} ${HOME} "$@" x=1 | export readonly | readonly
+	echo --verbose --verbose sed --verbose local
+		$(pwd) 'quoted text' 2>/dev/null printf && printf
+&& then && "$@" awk printf
+	grep 'quoted text' 'quoted text' readonly x=1 /usr/bin echo --verbose
+	then printf test sed echo 'quoted text' | echo readonly | then grep
+${HOME} $(pwd) && --verbose 2>/dev/null
+then grep 'quoted text' x=1 | 2>/dev/null ${HOME} export grep sed awk
+		'quoted text' cd "$@" "$1" x=1 printf cd /usr/bin $(pwd) 2>/dev/null
+2>/dev/null "$1" local grep "$@" done 'quoted text' grep && 2>/dev/null
+x=1 "$1" readonly x=1 /usr/bin $(pwd) cd awk ${HOME} | done 2>/dev/null
+		| -eu echo | -eu "$@" "$1" awk echo --verbose awk
+local "$1" $(pwd) && cd 'quoted text' local /usr/bin
+"$1" x=1 ${HOME} awk printf $(pwd) cd ${HOME} echo 2>/dev/null printf awk readonly
+		done export done test /usr/bin 2>/dev/null readonly export test echo x=1 sed | -eu
+	printf | --verbose echo
+		| test awk /usr/bin && done cd -eu grep printf "$@" x=1 test
+		"$1" readonly printf "$1" then 2>/dev/null printf ${HOME}
+readonly grep sed | readonly
+		echo then echo sed local ${HOME} then "$1"
+readonly x=1 2>/dev/null
+		then -eu printf /usr/bin x=1 awk sed "$1" 2>/dev/null ${HOME}
+	-eu local $(pwd) cd export "$@" /usr/bin export --verbose |
+		done awk test "$1" local grep awk done /usr/bin 'quoted text' x=1
+	x=1 awk "$@" 2>/dev/null "$1"
+		done ${HOME} && printf awk ${HOME} 'quoted text'
+	"$@" /usr/bin export cd awk
+-eu printf test printf export
+&& test export awk --verbose "$@" sed awk $(pwd)
+		awk readonly awk readonly /usr/bin $(pwd) $(pwd) "$1"
+	done test grep 2>/dev/null readonly ${HOME} local then && export ${HOME}
+		cd export 'quoted text' test --verbose done | export
+'quoted text' done --verbose
+"$1" | "$@" printf cd grep ${HOME} local awk
+		sed ${HOME} /usr/bin "$1" ${HOME} test x=1 'quoted text'
+		$(pwd) | "$1" 'quoted text'
+	| grep export --verbose then done sed done /usr/bin
+readonly | && export awk export
+	--verbose /usr/bin readonly echo grep "$@" grep
+		done readonly sed then 'quoted text'
+		printf && sed then export $(pwd) "$@" local
+printf "$1" readonly /usr/bin | local then grep
+	/usr/bin cd echo local test
+		echo printf && /usr/bin
+/usr/bin echo test | $(pwd) 'quoted text' "$1" cd
+	-eu export 'quoted text' | &&
+	--verbose /usr/bin test 2>/dev/null export "$1" done | "$1"
+		readonly grep then test local test ${HOME} test -eu && test readonly printf
+| ${HOME} 'quoted text' $(pwd) grep export test
+		test printf printf readonly cd printf
+		local awk printf local --verbose $(pwd) test 2>/dev/null x=1 &&
+	| printf 'quoted text' done /usr/bin local && readonly export
+readonly --verbose -eu cd x=1 printf
+		'quoted text' x=1 "$1" echo | cd cd 'quoted text'
+"$1" cd -eu "$1" "$1"
+		-eu "$1" local grep awk -eu
+		printf x=1 | "$1" sed --verbose readonly
+	sed "$@" echo --verbose /usr/bin done
+		"$@" -eu readonly 'quoted text'
+${HOME} printf | && cd | then && then $(pwd) ${HOME} $(pwd)
+2>/dev/null awk local done 'quoted text' readonly local
+		"$@" -eu export grep 2>/dev/null ${HOME} local grep then
+		done test "$@" | "$@" $(pwd) $(pwd) "$1" "$1" --verbose grep
+	done local x=1 | printf 2>/dev/null --verbose
+		local --verbose ${HOME} grep then x=1 readonly printf readonly "$@" cd
+		&& /usr/bin readonly readonly echo done ${HOME} echo &&
+echo --verbose printf -eu export awk 'quoted text'
+	export && sed awk printf && then /usr/bin then ${HOME} done grep readonly
+| then ${HOME} --verbose "$1"
+		export printf test -eu ${HOME} 'quoted text' test then done x=1 2>/dev/null
+	grep /usr/bin "$@" test awk 'quoted text'
+	&& awk 2>/dev/null echo ${HOME} echo
+	"$1" | /usr/bin local 2>/dev/null then && 'quoted text' done | x=1 readonly
+awk echo --verbose sed -eu
+| 'quoted text' 2>/dev/null local awk
+	| echo && test x=1 grep awk awk /usr/bin awk 'quoted text' cd done readonly
+	/usr/bin /usr/bin "$@" | /usr/bin then x=1 then "$1" export sed local
+	awk x=1 readonly local --verbose
+	echo | awk done --verbose ${HOME} awk
+	then --verbose cd test 'quoted text'
+		awk "$@" readonly grep then "$@" 'quoted text' local local then | "$@" | printf
+		export && 'quoted text' echo done test then --verbose
+-eu 'quoted text' readonly then 2>/dev/null done 'quoted text'
+	readonly "$@" export 'quoted text'
+		then -eu echo then export && cd export
+readonly "$1" sed "$1" then grep export "$1" "$1" readonly ${HOME} &&
+	$(pwd) then sed -eu 2>/dev/null | 'quoted text'
+	local ${HOME} $(pwd)
+		--verbose 'quoted text' export ${HOME} readonly awk 2>/dev/null
+x=1 readonly && -eu "$@" x=1
+		sed 'quoted text' echo $(pwd)
+		cd printf cd 'quoted text' ${HOME}
+readonly grep export /usr/bin readonly ${HOME} $(pwd) | printf x=1 cd export
+	| ${HOME} x=1 local "$1" -eu readonly
+	echo test cd $(pwd) export $(pwd) 'quoted text'
+		grep --verbose x=1 cd 2>/dev/null done test sed
+&& cd $(pwd) sed cd local --verbose 2>/dev/null "$1" ${HOME} 2>/dev/null --verbose
+&& x=1 ${HOME} readonly echo 2>/dev/null awk readonly
+	grep local "$1" test "$@" sed done sed grep readonly
+		test -eu done grep -eu then -eu done echo
+	${HOME} x=1 'quoted text' /usr/bin 'quoted text' printf then
+cd $(pwd) sed --verbose readonly "$@" x=1 echo local
+		cd --verbose | $(pwd) 'quoted text' x=1 -eu "$1"
+--verbose cd --verbose local 2>/dev/null
+		--verbose then --verbose echo --verbose
+	x=1 && | 2>/dev/null 2>/dev/null -eu 2>/dev/null x=1 echo readonly &&
+	grep export 2>/dev/null awk grep "$@" 'quoted text' readonly local x=1 /usr/bin
+printf "$1" -eu grep then export echo | printf cd test "$1" -eu export
+	| 2>/dev/null done | grep ${HOME} readonly $(pwd) x=1 cd -eu
+		cd /usr/bin awk /usr/bin /usr/bin done && --verbose
+	cd -eu "$@" printf cd readonly "$1" --verbose 'quoted text' export
+	"$@" ${HOME} test sed sed "$1"
+	2>/dev/null export 'quoted text'
+		'quoted text' cd 2>/dev/null grep
+	readonly export echo sed grep "$@" test cd local
+		done local 2>/dev/null
+export then $(pwd) echo ${HOME} | local awk then
+/usr/bin 'quoted text' $(pwd) $(pwd) 2>/dev/null x=1 2>/dev/null local
+	echo ${HOME} sed readonly cd
+		export local export x=1 $(pwd) sed grep && cd | | "$@" | ${HOME} /usr/bin
+		local && --verbose ${HOME} local --verbose echo
+		test 2>/dev/null echo readonly awk 2>/dev/null local done $(pwd)
+	x=1 awk | awk -eu 'quoted text' sed test x=1 x=1 /usr/bin "$@" "$1" cd
+	grep local "$1" --verbose local cd && cd
+	cd && $(pwd) --verbose
+awk ${HOME} then 'quoted text' "$@" $(pwd) done echo sed export "$1" echo | local
+--verbose awk --verbose -eu "$@" local 2>/dev/null
+sed printf done --verbose
+	sed --verbose printf done && export readonly export | && done local "$@" echo
+	| readonly export "$1" /usr/bin | test "$@" x=1 'quoted text' ${HOME} $(pwd)
+		${HOME} "$@" --verbose --verbose | echo --verbose done readonly awk "$@"
+cd echo cd done --verbose sed ${HOME} done && test printf
+		/usr/bin $(pwd) && echo "$1" $(pwd) -eu ${HOME} -eu test --verbose local x=1 "$@"
+		x=1 /usr/bin printf /usr/bin sed readonly grep ${HOME} $(pwd) 2>/dev/null
+then sed ${HOME} && then --verbose "$1" printf
+	"$1" sed printf printf local awk
+		"$@" && grep echo grep readonly done printf printf then $(pwd) 'quoted text' export
+	local sed local cd "$@" grep && "$1" done | x=1 readonly echo | "$@" 'quoted text'
+	awk $(pwd) printf --verbose echo awk "$@" test done 2>/dev/null cd --verbose
+		&& sed -eu --verbose "$1" &&
+		done echo then ${HOME} /usr/bin
+	| local /usr/bin cd awk printf export 2>/dev/null -eu
+readonly readonly /usr/bin ${HOME} | x=1 --verbose 2>/dev/null
+	"$1" /usr/bin echo -eu --verbose sed done | /usr/bin "$1" --verbose sed sed
+	echo --verbose "$@" && "$1" local grep cd -eu x=1 && grep
+${HOME} done ${HOME} echo echo 'quoted text'
+		cd 'quoted text' && sed readonly readonly && /usr/bin --verbose cd --verbose
+2>/dev/null -eu -eu awk local sed -eu cd "$@" sed grep done 2>/dev/null
+	then "$@" grep sed awk awk "$1" local --verbose echo
+		&& printf /usr/bin $(pwd) cd test "$@" /usr/bin
+	"$1" "$1" done --verbose echo sed
+	echo 'quoted text' "$1" awk && echo
+		"$1" | done 'quoted text' 'quoted text' echo ${HOME} grep awk "$@" sed 'quoted text'
+		2>/dev/null "$@" cd "$1"
+		--verbose printf echo ${HOME} readonly
+		/usr/bin 2>/dev/null "$@" echo "$1" printf --verbose
+sed done | awk done ${HOME} 'quoted text' grep /usr/bin grep /usr/bin readonly
+		"$@" && sed && | 2>/dev/null readonly --verbose | $(pwd) --verbose x=1 sed then
+	--verbose test 2>/dev/null grep $(pwd) awk
+	local readonly --verbose local done
+echo /usr/bin $(pwd) export cd | $(pwd) sed printf
+		x=1 awk sed x=1 "$1" then
+	${HOME} grep $(pwd) ${HOME} cd test x=1 grep sed grep then grep /usr/bin then
+done local test x=1 $(pwd) x=1 --verbose export readonly
+printf "$@" sed echo /usr/bin $(pwd)
+printf "$1" /usr/bin echo awk export readonly "$@" then echo
+then readonly "$1" /usr/bin $(pwd) --verbose
+		sed cd "$@" "$@" 'quoted text' readonly
+		-eu "$@" echo $(pwd) cd -eu awk export printf
+		done "$@" cd echo done echo grep test 'quoted text'
+		-eu "$@" readonly awk ${HOME} awk readonly local
+then awk sed grep then /usr/bin -eu local
+		/usr/bin "$1" "$@" test "$@" "$1" "$@" 2>/dev/null
+		&& export export 'quoted text' && export echo cd echo "$@" x=1 awk
+	readonly "$@" printf readonly -eu && "$@" x=1 2>/dev/null --verbose
+		--verbose readonly echo --verbose
+		2>/dev/null --verbose cd awk 'quoted text' 2>/dev/null then export && local
+		"$1" x=1 | echo then 'quoted text' export local done then
+		echo | && readonly "$1" readonly /usr/bin test readonly
+		echo local /usr/bin ${HOME} "$@" grep
+	awk && sed done readonly /usr/bin "$1" cd awk 2>/dev/null /usr/bin x=1 then
+	2>/dev/null grep 2>/dev/null 2>/dev/null /usr/bin
+		done printf sed local test echo then printf
+		test local /usr/bin export
+		echo | local && cd -eu test ${HOME} "$1" grep 'quoted text'
+		${HOME} /usr/bin x=1 -eu
+	echo | sed cd then -eu cd --verbose ${HOME} readonly && awk "$@" cd
+		2>/dev/null && awk 'quoted text' ${HOME} done
+		done local $(pwd) "$@" && "$@" 'quoted text' $(pwd) ${HOME} $(pwd)
+	--verbose 'quoted text' -eu "$@" cd sed
+	readonly awk echo --verbose
+		${HOME} | --verbose 'quoted text' --verbose
+		'quoted text' 'quoted text' ${HOME} done -eu && printf -eu
+		&& -eu readonly --verbose sed "$@" local
+${HOME} sed /usr/bin "$1" export | 2>/dev/null export grep grep
+	local grep 2>/dev/null test 'quoted text'
+	echo test sed then local grep && "$1" printf
+	sed "$1" echo --verbose echo readonly
+		sed export "$@" x=1 x=1 x=1 $(pwd) --verbose then
+readonly export then --verbose sed ${HOME} sed && local sed done $(pwd)
+	-eu export && then "$1" export --verbose "$@" grep done | local "$1" --verbose
+		export grep grep "$@" awk cd | "$@" "$@"
+| | awk /usr/bin readonly && printf readonly test printf grep
+echo /usr/bin echo echo cd $(pwd) $(pwd) 'quoted text' readonly
+test done sed --verbose echo /usr/bin grep test test
+	readonly test && sed grep sed cd printf 2>/dev/null grep x=1 cd cd && local
+	$(pwd) --verbose -eu sed 2>/dev/null readonly then
+	x=1 "$1" --verbose | done awk "$1" export $(pwd)
+	2>/dev/null $(pwd) ${HOME} -eu then export then printf $(pwd) 2>/dev/null
+		test | grep | 'quoted text' done "$@" export test
+	$(pwd) echo | grep test | printf printf then local
+"$@" "$@" awk cd done readonly 'quoted text'
+		local -eu /usr/bin /usr/bin 'quoted text' 'quoted text' && cd test "$@"
+then export export cd 'quoted text' 'quoted text' awk ${HOME} awk awk "$@" "$@"
+then then sed $(pwd) sed "$@" $(pwd)
+	${HOME} x=1 2>/dev/null "$@" $(pwd) 2>/dev/null -eu 'quoted text'
+		test && export $(pwd) readonly
+done cd "$@" cd "$@" ${HOME} 2>/dev/null && 'quoted text'
+	test echo --verbose && done ${HOME} x=1 then grep awk ${HOME}
+		${HOME} awk 2>/dev/null "$1" | export done
+		${HOME} /usr/bin "$1" local $(pwd) export 2>/dev/null
+		readonly local local done 2>/dev/null -eu 'quoted text' ${HOME} && $(pwd) then
+	echo cd && /usr/bin -eu printf "$1" cd 'quoted text'
+grep grep -eu done then then then readonly test && ${HOME} -eu sed local
+	${HOME} done /usr/bin grep test && cd export "$1" 'quoted text'
+"$@" sed export $(pwd)
+		&& /usr/bin 'quoted text' --verbose ${HOME} 2>/dev/null
+"$@" export done then && printf readonly
+		${HOME} readonly | -eu done done local
+		/usr/bin echo done done "$1" export done done local "$1" test
+'quoted text' cd local grep 'quoted text'
+"$1" cd x=1 export cd -eu 'quoted text'
+	&& --verbose /usr/bin awk then cd test readonly grep test sed "$1" 'quoted text'
+		done ${HOME} --verbose local ${HOME} "$1" sed
+	sed awk | /usr/bin test
+		2>/dev/null --verbose cd -eu 'quoted text' --verbose x=1 readonly "$1" 'quoted text'
+test done x=1 test --verbose /usr/bin /usr/bin ${HOME} printf && 'quoted text'
+		'quoted text' test $(pwd) then ${HOME} ${HOME} "$1" -eu then $(pwd) ${HOME}
+sed readonly awk local 2>/dev/null grep grep -eu export cd $(pwd)
+		sed awk grep | test cd echo /usr/bin done /usr/bin -eu ${HOME}
+		awk "$1" test local done -eu "$@" done --verbose grep
+x=1 && -eu -eu test export --verbose x=1 | test then && &&
+		--verbose printf | echo "$@" done echo cd done 'quoted text'
+x=1 test awk "$1" ${HOME} $(pwd) printf test x=1 'quoted text'
+	test cd && cd 2>/dev/null printf $(pwd) readonly done /usr/bin done && 2>/dev/null
+$(pwd) export awk then && echo awk printf x=1 sed local | test /usr/bin
+	readonly --verbose ${HOME} "$1" 'quoted text'
+		'quoted text' && && --verbose sed
+	x=1 export /usr/bin -eu "$@" echo then grep "$@" readonly -eu grep
+	local export done "$1" /usr/bin
+		"$1" then grep done | x=1 /usr/bin awk $(pwd) awk -eu /usr/bin then 2>/dev/null
+'quoted text' -eu echo /usr/bin && $(pwd)
+	echo -eu local $(pwd) sed "$1"
+	2>/dev/null test echo readonly ${HOME} printf cd test done grep sed 'quoted text'
+		readonly "$1" sed readonly "$@" sed && ${HOME} readonly /usr/bin
+		x=1 export "$1" x=1 $(pwd)
+then | "$1" then x=1 echo grep && awk local $(pwd) -eu
+grep printf awk ${HOME} cd
+	local printf grep echo -eu printf sed 2>/dev/null $(pwd) done cd test 2>/dev/null
+test local x=1 grep 'quoted text'
+		grep 2>/dev/null echo then test "$@" local awk --verbose
+	export -eu 'quoted text' ${HOME} done awk cd local local
+	2>/dev/null /usr/bin sed echo x=1 done 'quoted text' | "$1" export done then
+		"$1" -eu /usr/bin 2>/dev/null | done "$1" --verbose x=1 test x=1 -eu
+	then -eu awk x=1 | x=1 export then 2>/dev/null
+/usr/bin $(pwd) | x=1 $(pwd)
+done done awk "$@" printf done
+test local /usr/bin ${HOME} local 'quoted text' sed export --verbose local done
+	printf grep sed test then awk then -eu ${HOME} done grep export | local
+	then "$1" && grep echo sed && && --verbose $(pwd)
+		export | $(pwd) ${HOME} echo sed local
+		--verbose -eu ${HOME} echo export printf done | readonly
+cd /usr/bin $(pwd) then then --verbose done "$@" --verbose cd /usr/bin sed
+		x=1 then "$@" then awk $(pwd) readonly printf echo readonly |
+		2>/dev/null -eu ${HOME} then test cd cd "$1" /usr/bin
+		${HOME} 2>/dev/null 2>/dev/null "$1" local -eu echo test test
+	"$@" && sed cd "$1" 2>/dev/null 'quoted text'
+	done "$@" "$@" then --verbose
+	grep --verbose cd awk export
+	local awk export cd x=1 export
+	local x=1 sed printf then && export
+		/usr/bin cd $(pwd) done $(pwd) readonly grep -eu $(pwd) "$1"
+		"$1" "$1" awk readonly test "$1" | | ${HOME} then --verbose
+	grep | test echo cd -eu test
+		sed 'quoted text' local sed
+	--verbose /usr/bin | "$1" $(pwd) | printf done export sed
+x=1 "$@" done x=1 readonly
+awk grep then "$@" local -eu sed | cd then
+	'quoted text' && grep test --verbose readonly printf x=1 export ${HOME}
+sed sed test /usr/bin printf /usr/bin test "$@" readonly
+'quoted text' --verbose done && "$1"
+"$1" "$@" readonly echo awk ${HOME} echo test ${HOME} ${HOME} &&
+local /usr/bin 'quoted text' grep printf
+	| test test local /usr/bin
+	local cd grep x=1 sed sed && | -eu then echo awk echo 'quoted text'
+		done test printf awk
+	then && test then && local awk -eu local
+		then readonly | echo test ${HOME} grep done && local "$1" -eu
+	"$@" "$1" | --verbose /usr/bin -eu | printf cd && then 'quoted text'
+$(pwd) $(pwd) then sed && sed && awk echo grep sed "$1" grep
+$(pwd) printf printf awk 2>/dev/null --verbose 2>/dev/null
+	readonly sed sed echo $(pwd) printf test && && printf "$@" done
+'quoted text' x=1 printf export 'quoted text'
+	done sed --verbose grep local 'quoted text' done grep $(pwd) then ${HOME}
+	echo export local test | grep echo done awk ${HOME} 2>/dev/null
+		printf 2>/dev/null x=1 --verbose done printf --verbose
+		&& grep export sed 2>/dev/null
+	readonly 2>/dev/null readonly export && echo readonly
+	-eu --verbose readonly cd 2>/dev/null grep && readonly --verbose 'quoted text'
+	local local x=1 $(pwd) /usr/bin done "$1" ${HOME} -eu local cd echo
+sed -eu | sed ${HOME} && awk "$1" done readonly /usr/bin 2>/dev/null 2>/dev/null
+		'quoted text' test -eu then cd readonly readonly
+	$(pwd) cd | sed "$1" echo "$1" grep echo -eu --verbose readonly grep
+		-eu echo test readonly cd --verbose $(pwd) echo 2>/dev/null
+		echo export test test ${HOME} --verbose | done $(pwd) /usr/bin ${HOME} readonly
+	2>/dev/null 'quoted text' cd cd --verbose "$@" then awk grep readonly printf
+		"$1" test test echo sed --verbose
+		grep "$@" awk "$1" awk | export ${HOME} sed $(pwd) x=1 sed
+		"$1" sed echo "$1" sed "$@" sed test ${HOME} export
+	/usr/bin awk | --verbose "$@" printf echo | printf x=1
+		done x=1 --verbose ${HOME} && 'quoted text' echo "$@" grep ${HOME}
+		then -eu readonly 2>/dev/null
+echo readonly sed 'quoted text' -eu /usr/bin
+		'quoted text' ${HOME} -eu "$1" x=1 sed $(pwd)
+		'quoted text' 2>/dev/null -eu then echo --verbose readonly awk --verbose
+		export readonly ${HOME} test --verbose x=1
+		--verbose cd cd "$1" cd ${HOME} grep && "$1" test ${HOME}
+		"$1" printf 2>/dev/null done grep /usr/bin && awk
+	local && "$1" local cd readonly &&
+	2>/dev/null export export "$1" x=1 && "$@" "$1"
+	"$1" sed awk $(pwd) --verbose cd grep awk --verbose awk -eu export readonly "$1"
+	"$1" sed --verbose printf cd -eu sed done awk test awk /usr/bin
+		${HOME} 'quoted text' "$@" "$@" done && done 'quoted text'
+export printf done sed done "$1" test "$@" "$1" $(pwd)
+	"$@" -eu done test printf -eu printf then --verbose readonly
+	test "$@" x=1 /usr/bin x=1 'quoted text' --verbose 'quoted text'
+grep grep grep | "$@" grep "$1" "$@"
+printf $(pwd) export 'quoted text' "$1" | grep "$1" ${HOME} x=1 x=1
+	test 2>/dev/null 'quoted text' "$1" done cd local "$1" export export done
+		$(pwd) x=1 --verbose done echo /usr/bin printf local cd local /usr/bin cd 2>/dev/null
+	/usr/bin cd /usr/bin 'quoted text' grep 'quoted text' echo grep
+		'quoted text' "$1" export test then
+grep -eu x=1 export readonly
+sed x=1 | x=1 grep printf x=1 'quoted text' 2>/dev/null ${HOME} cd done local
+"$@" test readonly --verbose export -eu then local then "$@" $(pwd)
+-eu 2>/dev/null readonly 'quoted text'
+		$(pwd) -eu done -eu "$@" -eu && echo "$1"
+		$(pwd) sed echo && | "$1"
+	"$@" grep | 'quoted text' readonly
+		cd echo done --verbose "$1" export cd x=1 local done ${HOME}
+		local 2>/dev/null --verbose readonly "$@" $(pwd) 'quoted text'
+		grep cd "$@" "$@" && x=1 2>/dev/null "$@" --verbose local 'quoted text' 'quoted text'
+	"$@" done | | x=1 awk --verbose awk
+		grep done x=1 awk test /usr/bin export /usr/bin local -eu test --verbose
+		'quoted text' grep cd -eu cd "$@" grep sed /usr/bin
+| then $(pwd) 2>/dev/null /usr/bin
+		readonly sed sed cd printf sed --verbose grep test test --verbose "$@"
+		then /usr/bin cd then --verbose done -eu readonly
+grep local readonly export then ${HOME}
+	readonly printf done "$1" "$1" -eu | test test printf
+		grep "$@" && grep printf sed local 'quoted text' -eu done
+		-eu /usr/bin x=1 test && "$@" $(pwd) && | --verbose test local 'quoted text'
+		$(pwd) && local --verbose export $(pwd) local x=1 x=1
+	2>/dev/null sed && awk local awk sed /usr/bin test "$1"
+		export grep then ${HOME} done
+sed readonly --verbose -eu
+	/usr/bin ${HOME} "$@" grep ${HOME} /usr/bin -eu --verbose sed
+-eu --verbose -eu $(pwd) local "$1" test
+/usr/bin test done echo | local export export 'quoted text' export
+		x=1 sed then x=1 then 'quoted text' awk -eu
+	then cd "$@" $(pwd) test readonly printf && then
+		--verbose awk awk | ${HOME} echo grep
+printf then awk then --verbose --verbose $(pwd) 'quoted text'
+readonly --verbose awk cd readonly x=1 2>/dev/null -eu then then 2>/dev/null
+	then "$1" readonly echo cd readonly
+	local $(pwd) 'quoted text'
+	echo test test readonly echo echo && /usr/bin local "$@"
+	--verbose printf && ${HOME} 2>/dev/null ${HOME} -eu "$1"
+		cd $(pwd) sed readonly ${HOME} $(pwd) cd cd 'quoted text'
+export | test done grep cd
+		-eu "$1" cd cd grep awk 2>/dev/null 2>/dev/null 2>/dev/null
+'quoted text' export "$@" printf x=1 $(pwd) readonly local then /usr/bin &&
+	$(pwd) /usr/bin $(pwd) 'quoted text' "$1" grep grep then | grep && grep printf
+		then cd echo x=1 echo 2>/dev/null | then sed -eu && ${HOME} echo
+done export x=1 export done --verbose awk -eu ${HOME}
+	then then $(pwd) local /usr/bin --verbose echo 'quoted text'
+cd echo done echo "$1" readonly 'quoted text' done
+		grep sed echo 'quoted text'
+	printf sed echo sed sed test sed then x=1 printf 2>/dev/null 2>/dev/null
+		then -eu echo cd printf
+/usr/bin test local grep then export
+	test 'quoted text' -eu printf local sed
+		then printf echo then "$@" sed 'quoted text' ${HOME}
+x=1 && --verbose echo "$1" x=1 x=1 done $(pwd) ${HOME} ${HOME} sed local
+		${HOME} awk printf /usr/bin export $(pwd) 'quoted text' readonly
+	awk /usr/bin grep x=1 echo --verbose --verbose
+		local /usr/bin export sed /usr/bin x=1 test echo export
+local ${HOME} && "$@" --verbose awk export $(pwd) cd grep ${HOME} local "$1"
+		readonly $(pwd) --verbose $(pwd) -eu local cd
+		grep -eu sed printf done -eu x=1 local 2>/dev/null -eu -eu cd "$1" local
+		readonly cd /usr/bin 'quoted text' test grep
+${HOME} x=1 --verbose --verbose $(pwd) printf test "$@" grep readonly
+	test cd cd ${HOME} then ${HOME} 'quoted text' x=1 awk
+		export grep test && 2>/dev/null
+		awk /usr/bin 'quoted text' 'quoted text'
+"$1" test 'quoted text' &&
+then -eu awk awk 2>/dev/null done awk done sed
+	"$1" $(pwd) "$1" $(pwd)
+	2>/dev/null cd echo awk echo | 2>/dev/null $(pwd) export
+	cd cd then cd done test readonly
+		--verbose awk grep readonly | test /usr/bin sed test
+test then -eu 2>/dev/null $(pwd)
+printf then local local then "$@" | grep cd readonly export cd printf "$@" grep
+	"$1" sed /usr/bin && x=1 done printf x=1 local ${HOME} ${HOME}
+printf --verbose local sed /usr/bin readonly
+| cd done done test grep 'quoted text' "$1" --verbose 'quoted text' export awk
+local cd test 'quoted text' local grep | | --verbose test "$1" cd ${HOME}
+	${HOME} awk /usr/bin $(pwd) export sed test grep test then
+		${HOME} -eu local test /usr/bin
+-eu && sed done ${HOME} $(pwd) $(pwd) -eu cd ${HOME} cd export
+"$1" sed printf printf sed x=1
+		/usr/bin then /usr/bin "$@" grep x=1 sed "$@" test "$@" --verbose grep
+${HOME} grep x=1 && 'quoted text' --verbose
+test 2>/dev/null grep sed && export test /usr/bin 2>/dev/null echo local test
+	sed && grep echo ${HOME} "$@" "$1" awk ${HOME}
+		readonly "$@" --verbose && awk /usr/bin test echo echo printf grep 2>/dev/null
+		$(pwd) test 'quoted text' local /usr/bin x=1 readonly grep sed
+		export /usr/bin | ${HOME} awk $(pwd) x=1 export 2>/dev/null then "$1" export export
+$(pwd) cd --verbose x=1 printf && done awk x=1 -eu "$1" /usr/bin
+"$@" done 'quoted text' && awk cd 2>/dev/null
+		${HOME} ${HOME} local local 'quoted text' "$1" echo ${HOME} 'quoted text'
+test printf test x=1 export export export && $(pwd) 2>/dev/null printf
+		/usr/bin && then done then then
+	local test sed local then readonly "$1" /usr/bin readonly cd -eu --verbose
+		awk "$@" cd 'quoted text' test then "$@" echo -eu /usr/bin cd sed && 2>/dev/null
+&& "$@" readonly 'quoted text' cd --verbose "$1"
+export --verbose awk 'quoted text' readonly
+printf "$@" sed readonly readonly $(pwd) sed printf
+		cd readonly ${HOME} $(pwd) $(pwd)
+sed test test -eu then /usr/bin then
+		x=1 done grep | test echo && test test && 'quoted text' cd
+then 2>/dev/null 2>/dev/null echo /usr/bin && | $(pwd) local done $(pwd) export
+		then local 'quoted text' grep cd && echo cd -eu 2>/dev/null printf
+		/usr/bin cd 'quoted text' $(pwd) then export
+| "$@" test export readonly
+${HOME} --verbose --verbose | ${HOME} sed local && echo sed export
+export ${HOME} sed 'quoted text' $(pwd) 2>/dev/null ${HOME} &&
+/usr/bin 'quoted text' 2>/dev/null 'quoted text'
+	export && -eu -eu -eu |
+	echo $(pwd) printf $(pwd) | test && then sed cd then grep done export "$@" ${HOME}
+	${HOME} test cd $(pwd) 'quoted text' 2>/dev/null cd printf "$1" 2>/dev/null
+then echo 'quoted text' done cd 2>/dev/null awk 'quoted text'
+		local echo cd then readonly local sed cd && ${HOME} export
@@ -0,0 +1,2001 @@
+		x=1 test $(pwd) x=1 && awk $(pwd) 2>/dev/null ${HOME} sed "$1" | done --verbose
+	test awk 2>/dev/null done
+readonly awk readonly export 2>/dev/null -eu done 'quoted text' /usr/bin
+		echo /usr/bin | && "$@" local -eu | cd 'quoted text' grep grep | sed echo awk
+		'quoted text' export printf "$@" export
+local then --verbose | export
+	"$1" printf then 2>/dev/null --verbose --verbose x=1 |
+	x=1 ${HOME} x=1 --verbose
+awk grep 2>/dev/null 2>/dev/null && sed -eu awk
+	local then local readonly &&
+		2>/dev/null local sed ${HOME} sed printf "$1"
+	local sed 2>/dev/null grep local && $(pwd) readonly then --verbose $(pwd)
+		&& "$1" awk 'quoted text' /usr/bin printf local export cd 'quoted text'
+'quoted text' export && 'quoted text'
+	export 2>/dev/null ${HOME} | awk then 2>/dev/null -eu sed
+		then test --verbose grep export
+		readonly --verbose x=1 --verbose test "$@" && /usr/bin printf printf
+		&& && x=1 awk readonly readonly sed 'quoted text' --verbose awk done readonly
+		done printf printf done
+		$(pwd) done --verbose --verbose $(pwd) export done 2>/dev/null
+		-eu export "$@" test "$1" "$@" grep 'quoted text'
+	${HOME} 'quoted text' --verbose -eu local readonly readonly 2>/dev/null
+	sed grep && x=1 test printf
+		cd "$1" "$@" | -eu 2>/dev/null /usr/bin /usr/bin ${HOME} && cd /usr/bin local
+		done "$@" local local printf
+--verbose local x=1 $(pwd) $(pwd) then
+	cd echo printf test /usr/bin test 2>/dev/null "$@" readonly
+		grep readonly echo | && 'quoted text' --verbose $(pwd) then $(pwd) cd
+then then local grep local printf -eu
+		&& local $(pwd) -eu sed | "$1" ${HOME} test readonly readonly awk /usr/bin 'quoted text'
+	/usr/bin test --verbose sed
+		grep grep "$@" export 2>/dev/null | printf then test
+then x=1 -eu ${HOME} "$@"
+		x=1 cd readonly && readonly done echo sed
+	grep --verbose ${HOME} export export sed ${HOME} export readonly 'quoted text'
+	readonly awk awk "$@" 2>/dev/null then test
+then ${HOME} readonly sed --verbose 2>/dev/null | local --verbose
+&& 2>/dev/null sed 2>/dev/null && -eu ${HOME} "$@" -eu echo -eu --verbose 'quoted text'
+	awk done echo echo sed ${HOME}
+	sed 'quoted text' done ${HOME} printf cd cd /usr/bin grep /usr/bin
+	grep sed done --verbose "$1" $(pwd) "$1" echo $(pwd) $(pwd) echo done sed "$1" -eu
+	"$@" test -eu export /usr/bin grep --verbose readonly
+		$(pwd) --verbose ${HOME} --verbose
+	"$@" grep 'quoted text' 2>/dev/null
+readonly -eu printf 'quoted text' awk test x=1
+	then "$@" 'quoted text' --verbose echo awk
+	local $(pwd) ${HOME} 2>/dev/null "$1" grep awk done awk done cd
+2>/dev/null 'quoted text' grep -eu sed done
+		test export printf 'quoted text' | printf done export grep
+	"$@" 'quoted text' test done local echo "$1" done "$@" 2>/dev/null
+		"$1" 'quoted text' test done grep
+$(pwd) "$1" && test test 2>/dev/null local | | test
+	cd --verbose local 'quoted text' grep 2>/dev/null
+2>/dev/null echo -eu sed cd grep sed sed /usr/bin echo
+		echo readonly sed printf awk x=1 awk done
+	readonly "$1" cd 2>/dev/null "$1" echo cd
+sed test $(pwd) 'quoted text' "$@" awk "$@" x=1 local readonly
+		grep --verbose ${HOME} export $(pwd) then
+	done export export "$@" 'quoted text'
+	"$@" test cd $(pwd) 2>/dev/null grep done sed $(pwd) && readonly
+	2>/dev/null then awk --verbose
+	&& 2>/dev/null ${HOME}
+| readonly /usr/bin "$1" readonly echo readonly printf
+		export --verbose 'quoted text'
+	--verbose $(pwd) sed awk export test 'quoted text' x=1 "$1" -eu -eu readonly
+		readonly echo cd --verbose printf printf /usr/bin done 2>/dev/null
+2>/dev/null sed export echo awk 2>/dev/null
+		echo /usr/bin grep awk done cd
+	| "$@" printf ${HOME} x=1 $(pwd) /usr/bin sed grep x=1 'quoted text' test
+		done export "$1" readonly "$1" /usr/bin
+		"$@" test 'quoted text' $(pwd) then -eu $(pwd) "$@"
+"$@" | 2>/dev/null "$1" | sed ${HOME} 'quoted text'
+	printf export echo readonly "$@" /usr/bin "$@" echo -eu "$1" --verbose x=1 2>/dev/null
+		2>/dev/null printf --verbose readonly grep &&
+		readonly test ${HOME} ${HOME} "$1" 'quoted text'
+		"$1" x=1 cd | 2>/dev/null awk --verbose x=1 export done -eu export $(pwd) /usr/bin
+		cd echo readonly cd | then grep /usr/bin /usr/bin $(pwd)
+readonly grep && awk awk printf "$1" awk
+cd "$@" printf printf 'quoted text' --verbose test cd echo awk
+	readonly 'quoted text' 2>/dev/null
+2>/dev/null "$@" local x=1 printf cd /usr/bin ${HOME} echo /usr/bin $(pwd)
+		"$@" 2>/dev/null $(pwd)
+		grep export test "$@" /usr/bin export 'quoted text' then 2>/dev/null cd export
+	printf readonly /usr/bin local
+sed grep awk sed then 'quoted text' sed
+		grep done 2>/dev/null sed sed "$1" && $(pwd) export
+then grep /usr/bin awk local local "$1" x=1 "$1" 2>/dev/null
+	x=1 test "$@" "$@" then awk && done --verbose
+	export done x=1 done cd
+		'quoted text' test cd x=1
+		then ${HOME} ${HOME} local $(pwd)
+	/usr/bin printf echo "$@" $(pwd)
+--verbose | /usr/bin 2>/dev/null
+2>/dev/null grep then --verbose local export then echo awk readonly
+then && echo $(pwd) "$@" $(pwd) done done awk -eu
+done ${HOME} test x=1 $(pwd) 'quoted text'
+$(pwd) done readonly --verbose 2>/dev/null "$@" printf awk 'quoted text'
+	export "$1" | "$@" cd awk x=1 echo sed sed awk awk readonly /usr/bin $(pwd)
+	export awk "$@" awk 2>/dev/null -eu 2>/dev/null "$1" cd test then
+	&& /usr/bin awk | printf readonly --verbose | 'quoted text'
+	then printf --verbose echo local
+	| cd $(pwd) grep then "$1" test echo then test && readonly awk local 'quoted text'
+		| "$1" && -eu test printf | then x=1 test test done test && printf "$@"
+		x=1 awk printf done grep /usr/bin printf ${HOME} --verbose
+"$1" sed grep -eu cd test cd sed
+	$(pwd) && awk printf export test -eu test "$@" then --verbose readonly "$@" awk
+		test "$1" | ${HOME} --verbose
+readonly "$1" cd local done -eu done
+${HOME} --verbose echo awk export ${HOME} readonly -eu local echo
+	export 2>/dev/null grep 'quoted text'
+	cd sed 'quoted text' "$@" x=1 export printf echo test x=1 "$@" 2>/dev/null printf
+		"$1" printf ${HOME} echo test cd -eu readonly x=1 ${HOME} ${HOME}
+	$(pwd) "$@" && grep awk -eu $(pwd) x=1 export
+	echo "$1" ${HOME} local awk -eu sed sed 2>/dev/null grep
+	"$@" grep "$1" | done /usr/bin export done local
+printf -eu "$1" --verbose echo /usr/bin --verbose
+| echo -eu /usr/bin && && "$1" /usr/bin 2>/dev/null echo readonly awk echo cd
+	local $(pwd) readonly local -eu 'quoted text' awk $(pwd) "$@" | sed grep test
+	sed then --verbose awk && --verbose ${HOME} readonly "$1" readonly cd /usr/bin
+		export | 'quoted text' -eu | "$@" awk test grep readonly "$@" --verbose /usr/bin
+		| printf readonly ${HOME} "$1" grep test --verbose done cd export | then
+--verbose ${HOME} readonly
+		| "$1" ${HOME} --verbose
+		then done printf sed && 2>/dev/null readonly && done echo --verbose
+"$1" grep export && then ${HOME} --verbose echo local sed | && | && readonly
+	then printf printf echo | awk local ${HOME} grep
+		export readonly done grep --verbose 2>/dev/null done -eu grep /usr/bin | done
+		x=1 x=1 grep -eu | 2>/dev/null && ${HOME} 'quoted text'
+	--verbose local readonly cd readonly printf export then local -eu "$1" ${HOME} printf
+readonly sed | sed | sed test 2>/dev/null then "$1" "$@" --verbose "$1"
+		$(pwd) cd awk && sed 'quoted text'
+	| 2>/dev/null x=1 /usr/bin $(pwd) echo sed --verbose
+echo --verbose cd ${HOME} then 2>/dev/null local /usr/bin then 2>/dev/null
+		-eu test awk echo 'quoted text' x=1 export
+done --verbose "$1" then "$@" local x=1 export
+		awk -eu $(pwd) export cd
+done done x=1 -eu export 2>/dev/null done done sed
+	done awk $(pwd) && -eu local 2>/dev/null 2>/dev/null --verbose readonly
+		2>/dev/null cd sed awk --verbose ${HOME}
+	--verbose "$1" readonly then "$1"
+		cd 'quoted text' /usr/bin export test awk "$@" printf test
+	"$1" then then readonly -eu "$1" sed sed /usr/bin done 2>/dev/null sed cd readonly
+	$(pwd) -eu printf export && /usr/bin sed then grep echo 2>/dev/null
+test cd --verbose awk -eu --verbose echo test "$1" "$1" readonly
+		echo printf 2>/dev/null echo --verbose done 2>/dev/null done local --verbose
+	/usr/bin sed -eu "$1" printf $(pwd) /usr/bin
+		sed done grep /usr/bin 2>/dev/null local ${HOME} /usr/bin readonly awk
+	printf local printf sed "$@"
+	/usr/bin && "$@" x=1 /usr/bin && awk
+		&& printf export awk | readonly
+		readonly cd test -eu x=1 echo | /usr/bin x=1 'quoted text'
+		/usr/bin export printf --verbose awk local local local grep
+"$@" $(pwd) "$@" x=1 x=1 | done "$1" grep /usr/bin && 'quoted text'
+&& | x=1 | grep "$1" printf local ${HOME} /usr/bin
+		done awk /usr/bin x=1 echo then ${HOME} sed readonly
+| then -eu cd /usr/bin sed 2>/dev/null 2>/dev/null cd awk
+&& local echo /usr/bin done "$@"
+done x=1 2>/dev/null done readonly readonly local printf ${HOME} /usr/bin local
+	"$1" sed awk then then sed grep test 2>/dev/null done
+	2>/dev/null 2>/dev/null printf $(pwd)
+echo readonly cd "$1" local printf
+	--verbose $(pwd) | test 2>/dev/null && -eu then then 2>/dev/null grep
+		"$@" local grep 'quoted text' readonly "$1" "$1" /usr/bin -eu sed 2>/dev/null
+		done grep then -eu awk printf printf sed readonly done export echo
+x=1 "$@" --verbose sed && "$1" awk test awk cd -eu printf
+2>/dev/null local cd ${HOME} test grep /usr/bin then $(pwd) --verbose
+"$1" "$@" 'quoted text' printf -eu /usr/bin /usr/bin done sed readonly -eu
+done ${HOME} --verbose 'quoted text' 'quoted text' printf echo done | readonly
+	echo ${HOME} 2>/dev/null printf $(pwd) local "$1" cd printf
+	-eu ${HOME} 2>/dev/null export -eu awk 2>/dev/null export echo
+		/usr/bin cd x=1 local awk --verbose
+	cd cd --verbose $(pwd) local 2>/dev/null
+		"$@" printf | x=1 "$1" $(pwd) "$@" x=1 echo sed $(pwd) ${HOME} grep readonly "$1"
+		test x=1 $(pwd) sed --verbose x=1 --verbose &&
+	x=1 2>/dev/null | echo ${HOME} grep -eu && x=1 2>/dev/null
+awk sed cd --verbose | 'quoted text'
+		/usr/bin -eu -eu echo
+		sed awk "$1" && "$@" done 'quoted text' grep --verbose "$1" test echo && then -eu
+grep grep grep sed sed $(pwd) && done /usr/bin sed 'quoted text' test
+'quoted text' cd "$1" ${HOME} echo awk /usr/bin awk && "$@" cd readonly then then
+awk done echo local sed "$@"
+	--verbose test local test 2>/dev/null | 2>/dev/null readonly /usr/bin
+sed test $(pwd) -eu ${HOME} "$@" test readonly | /usr/bin 'quoted text'
+		readonly ${HOME} cd 2>/dev/null local --verbose
+	local 'quoted text' ${HOME}
+	| awk then sed x=1 ${HOME} sed test export awk && 'quoted text' done "$1" printf
+| then x=1 /usr/bin test /usr/bin
+		/usr/bin 2>/dev/null printf --verbose readonly --verbose
+grep && printf sed x=1 local test done
+&& x=1 cd ${HOME} $(pwd) --verbose -eu
+		2>/dev/null sed -eu readonly sed 'quoted text' readonly "$@" readonly x=1 printf
+		awk export done "$@" grep echo $(pwd)
+awk -eu /usr/bin test sed echo $(pwd) awk $(pwd)
+--verbose awk 2>/dev/null readonly /usr/bin
+	cd cd printf x=1 2>/dev/null sed grep cd 'quoted text' test | $(pwd) --verbose
+		then export done test 'quoted text' sed
+test && printf sed printf cd x=1 -eu -eu 'quoted text'
+		x=1 /usr/bin 'quoted text' done echo awk "$@" /usr/bin 'quoted text'
+/usr/bin "$@" printf "$@" readonly && then && then | awk then ${HOME} readonly
+	"$@" echo /usr/bin && printf test 'quoted text' test readonly | -eu
+$(pwd) --verbose printf 2>/dev/null $(pwd) done echo cd test "$@" export
+	&& grep | sed 2>/dev/null $(pwd) -eu cd test --verbose /usr/bin
+	2>/dev/null --verbose readonly ${HOME}
+		"$1" $(pwd) readonly 'quoted text'
+	then readonly x=1 x=1 --verbose awk --verbose
+		'quoted text' grep grep /usr/bin
+	done test export "$1" printf test then $(pwd) grep $(pwd) grep done export -eu
+	done echo grep "$@" done -eu "$@" local "$@" -eu cd 2>/dev/null && && ${HOME} x=1
+	'quoted text' cd $(pwd) printf
+	${HOME} echo $(pwd) local test x=1 x=1 grep awk printf "$@" | x=1
+then --verbose awk test local 'quoted text'
+"$@" awk echo "$@" | done then
+		cd | x=1 printf ${HOME} awk "$@" | then printf x=1
+		done $(pwd) && awk ${HOME} -eu "$@" /usr/bin 'quoted text'
+	&& $(pwd) "$@" grep --verbose local "$@" grep && awk
+2>/dev/null printf 2>/dev/null | x=1 done /usr/bin 2>/dev/null "$@"
+		"$@" test then -eu "$1" printf readonly local echo /usr/bin then x=1 local |
+--verbose cd echo --verbose
+	export awk "$@" -eu -eu done local done | "$@" done done
+		sed -eu && "$1" --verbose /usr/bin awk /usr/bin --verbose
+		printf grep awk "$1" -eu done then 'quoted text' grep | x=1 'quoted text'
+	printf /usr/bin ${HOME} done
+		cd | --verbose done readonly then && printf
+/usr/bin /usr/bin 2>/dev/null done
+	&& done done cd printf test -eu local | echo printf 'quoted text'
+	export x=1 && ${HOME} test "$1"
+	test grep "$@" printf awk ${HOME} done 'quoted text' grep printf 2>/dev/null
+		"$1" 'quoted text' sed "$@" ${HOME} /usr/bin "$1" "$@" && test
+		$(pwd) && x=1 test --verbose $(pwd) /usr/bin
+	grep --verbose "$1" $(pwd) "$@" sed 'quoted text'
+		export --verbose -eu "$1" 'quoted text'
+	grep then cd | -eu local echo $(pwd)
+		sed then awk 'quoted text' grep $(pwd) test && -eu "$@" cd
+	export export $(pwd) local ${HOME} --verbose 'quoted text'
+	$(pwd) grep grep "$1" 2>/dev/null readonly readonly --verbose 2>/dev/null
+	&& local 2>/dev/null done 2>/dev/null --verbose
+"$1" local test | grep /usr/bin readonly x=1 then
+awk ${HOME} grep grep 2>/dev/null /usr/bin
+	local grep | -eu done ${HOME} -eu awk sed /usr/bin test $(pwd)
+	2>/dev/null then then | x=1 ${HOME} x=1
+	readonly "$@" -eu awk $(pwd)
+		grep && && export x=1 echo ${HOME} test
+done printf "$@" x=1 x=1 readonly
+	grep sed done echo x=1 /usr/bin test test done readonly
+		${HOME} sed "$@" grep $(pwd) local
+test 'quoted text' then "$1" sed x=1 cd cd 'quoted text' test readonly
+	local "$@" awk awk cd
+	readonly echo && grep readonly --verbose local | x=1 -eu sed $(pwd) echo
+	then -eu x=1 /usr/bin printf
+	echo test test 2>/dev/null cd --verbose echo --verbose "$@" done ${HOME} | "$1"
+	/usr/bin "$1" printf 'quoted text' grep local
+		grep cd sed cd test grep
+then cd awk cd echo --verbose done test --verbose && echo
+	then "$@" grep sed --verbose /usr/bin then "$@" &&
+export sed "$1" local $(pwd) printf x=1 done done
+		"$1" "$1" done "$1" "$@" cd cd sed cd 'quoted text'
+-eu readonly cd printf /usr/bin 'quoted text' test sed then readonly printf
+	-eu "$1" sed && "$1" 'quoted text' /usr/bin
+		${HOME} ${HOME} test local cd cd "$1" -eu | "$@" | | "$1"
+/usr/bin local | test
+	export echo readonly | 'quoted text' readonly 2>/dev/null
+		echo local --verbose done "$@" && echo "$@" | ${HOME} x=1
+test awk --verbose /usr/bin export x=1 done echo && test 2>/dev/null grep x=1
+awk then cd awk $(pwd) then
+	"$1" && cd sed readonly ${HOME} "$@" then echo export awk sed then sed "$@"
+		grep awk 2>/dev/null awk cd sed /usr/bin -eu readonly sed readonly
+cd awk 'quoted text' x=1
+	test printf readonly && echo | then x=1 done export /usr/bin
+x=1 printf local | echo 2>/dev/null
+		| | --verbose "$@" test
+	$(pwd) sed ${HOME} "$1" ${HOME} echo 2>/dev/null printf test ${HOME} readonly
+		echo x=1 -eu export export $(pwd) --verbose printf printf cd export
+		'quoted text' readonly printf $(pwd) export -eu 'quoted text' /usr/bin
+	$(pwd) sed --verbose test x=1 sed cd local /usr/bin then grep
+sed && printf done "$@" && grep done 'quoted text' && awk 2>/dev/null then
+	2>/dev/null /usr/bin echo sed
+		export x=1 test 2>/dev/null printf done awk
+		grep export awk x=1 /usr/bin cd awk echo local --verbose
+cd x=1 local -eu "$1" --verbose echo local cd test done 2>/dev/null
+	"$1" test readonly $(pwd) x=1 /usr/bin 2>/dev/null 2>/dev/null grep
+export "$1" 2>/dev/null printf grep /usr/bin
+	printf "$@" $(pwd) | 2>/dev/null grep -eu ${HOME} grep $(pwd) $(pwd)
+		echo test export 2>/dev/null "$1" grep 'quoted text' export "$@" 2>/dev/null sed
+		"$1" echo /usr/bin export && 'quoted text' grep
+		"$@" then grep readonly export grep echo && && 'quoted text' 'quoted text' grep
+"$1" 2>/dev/null | test -eu -eu printf done local awk --verbose
+		"$@" printf 'quoted text' "$1" -eu 2>/dev/null --verbose sed test sed x=1
+	sed -eu "$1" /usr/bin -eu --verbose grep
+	readonly echo printf "$1" cd test --verbose
+export cd test awk $(pwd) awk |
+	sed "$@" test | 'quoted text'
+	sed echo "$1" echo | done $(pwd) --verbose test cd test 'quoted text' then echo
+	&& && && "$@" sed sed --verbose "$@" grep echo "$@" done --verbose
+	x=1 awk local export awk grep && --verbose --verbose export awk
+		'quoted text' readonly /usr/bin then printf export grep then awk 2>/dev/null
+"$@" local local && | echo "$1" local grep 'quoted text'
+readonly then /usr/bin ${HOME} --verbose printf sed export "$@" printf local readonly
+		/usr/bin "$@" --verbose echo /usr/bin printf
+		/usr/bin local ${HOME} ${HOME}
+		done echo -eu --verbose grep sed
+	'quoted text' readonly export "$1" ${HOME} --verbose local
+'quoted text' -eu grep ${HOME} x=1 "$1"
+	--verbose local 'quoted text' local printf --verbose export
+	"$@" export export printf cd x=1
+cd export done "$1" echo 2>/dev/null
+	printf readonly cd | --verbose x=1
+x=1 -eu --verbose export --verbose cd && local
+		'quoted text' sed local 2>/dev/null echo local echo x=1 readonly
+	test 2>/dev/null awk grep "$1" ${HOME} /usr/bin local local "$@" 2>/dev/null
+sed | done | | readonly local export awk
+		cd ${HOME} "$1" test cd x=1
+'quoted text' awk --verbose $(pwd)
+		grep cd | x=1 | ${HOME} $(pwd) "$@" readonly 'quoted text' "$1" | "$1"
+done grep local $(pwd) --verbose
+		&& echo grep done then $(pwd)
+		"$1" sed grep readonly sed 2>/dev/null then 2>/dev/null 2>/dev/null local readonly
+	echo printf --verbose cd && "$1" local "$1" && awk ${HOME} printf then done
+		awk 2>/dev/null $(pwd) $(pwd) export
+	test /usr/bin export awk x=1 2>/dev/null "$1" test export && /usr/bin |
+	$(pwd) 2>/dev/null grep -eu
+		"$@" /usr/bin local ${HOME}
+| sed --verbose /usr/bin local "$1" export | readonly --verbose
+printf cd local /usr/bin
+		echo export sed && 'quoted text'
+		${HOME} export awk /usr/bin grep
+		${HOME} x=1 /usr/bin -eu local readonly local
+		x=1 2>/dev/null printf "$@" | echo ${HOME}
+	then $(pwd) "$1" "$1" 'quoted text' 'quoted text'
+$(pwd) ${HOME} local 2>/dev/null $(pwd) -eu x=1 && sed printf $(pwd)
+	${HOME} 'quoted text' /usr/bin ${HOME} test -eu test
+awk export export sed export && "$@" awk test 2>/dev/null printf
+	'quoted text' done 'quoted text'
+	export then then grep local cd printf --verbose sed $(pwd) local then sed --verbose
+		&& /usr/bin x=1 $(pwd) -eu echo then awk "$@" | -eu done ${HOME}
+		x=1 then local readonly local
+| 2>/dev/null --verbose cd -eu echo export export --verbose export
+grep | --verbose grep "$@" -eu echo | /usr/bin
+		/usr/bin awk --verbose x=1 test done grep done cd local test export
+	grep $(pwd) grep grep && -eu "$1" "$@" grep echo 2>/dev/null && export
+	done local test --verbose sed sed && cd --verbose $(pwd) awk -eu grep export
+	| local readonly $(pwd) printf echo /usr/bin
+readonly awk then grep | cd x=1 /usr/bin $(pwd) "$1" printf
+	&& done --verbose ${HOME} $(pwd) 2>/dev/null then /usr/bin
+test awk cd then --verbose x=1 && "$1"
+	sed cd -eu x=1 cd 'quoted text' 2>/dev/null
+	-eu sed echo 'quoted text' printf -eu export then 2>/dev/null
+	&& done awk grep test "$@" 2>/dev/null
+2>/dev/null ${HOME} cd "$@" readonly
+	grep grep grep ${HOME} cd -eu 'quoted text' done x=1 test done --verbose
+		then | 2>/dev/null && "$1" $(pwd) cd x=1 done then $(pwd) awk then 'quoted text'
+		x=1 | "$1" test then && readonly ${HOME} sed
+	export $(pwd) done local "$1" && done cd cd $(pwd) printf | done 2>/dev/null
+done -eu done export $(pwd)
+$(pwd) && readonly then awk export 'quoted text'
+	'quoted text' test cd --verbose cd test --verbose
+	readonly ${HOME} /usr/bin done | grep && printf sed $(pwd)
+		| ${HOME} awk "$1" sed sed "$@" ${HOME} | /usr/bin printf -eu "$1"
+/usr/bin | local && cd readonly && echo ${HOME}
+	&& cd $(pwd) test --verbose 2>/dev/null | awk "$1" done -eu awk
+'quoted text' 'quoted text' "$@" readonly 'quoted text' -eu
+printf echo x=1 | -eu sed
+	2>/dev/null --verbose printf printf printf
+test awk ${HOME} | && x=1 | x=1 cd then local then
+	| ${HOME} 2>/dev/null x=1 ${HOME} -eu
+		cd --verbose awk echo --verbose | | -eu ${HOME} /usr/bin cd done done
+		&& ${HOME} "$@" && local echo 'quoted text'
+	test sed export -eu "$1" export "$1" cd -eu 'quoted text'
+		cd /usr/bin grep export "$1" test sed /usr/bin then --verbose grep x=1 /usr/bin
+	2>/dev/null printf | then printf x=1 done 'quoted text' echo ${HOME} $(pwd)
+awk done awk -eu cd "$1" local local
+	then export /usr/bin local readonly -eu ${HOME}
+		export sed --verbose awk 'quoted text' awk -eu $(pwd) readonly
+local awk x=1 sed "$@" "$1" grep printf then "$1" "$@" "$1" $(pwd) sed grep
+--verbose $(pwd) -eu grep test "$1" done readonly
+		done export done readonly && done x=1 x=1
+${HOME} done printf grep $(pwd) --verbose done grep done -eu $(pwd) sed
+${HOME} cd test test sed --verbose 'quoted text'
+		test /usr/bin sed cd printf grep 2>/dev/null printf echo
+	local "$@" --verbose 'quoted text' done
+| -eu 'quoted text' done then 'quoted text' --verbose sed | /usr/bin x=1
+	x=1 printf test $(pwd) awk sed awk $(pwd) local /usr/bin
+	export sed x=1 done then local readonly cd awk awk && x=1 then
+	/usr/bin done echo local grep awk done
+		2>/dev/null then -eu then grep /usr/bin x=1 "$1" 'quoted text' ${HOME}
+| | printf export 'quoted text'
+	echo local sed "$1" sed then done --verbose readonly done --verbose
+sed "$@" printf test sed local echo sed $(pwd)
+awk && && export then grep 'quoted text' printf done |
+		grep echo awk test ${HOME} readonly awk 'quoted text'
+	sed echo ${HOME} --verbose | test "$1" sed x=1 export ${HOME} test | | 'quoted text'
+		then ${HOME} local done done readonly cd echo echo "$1"
+		--verbose done echo done --verbose printf local
+--verbose /usr/bin "$1" echo | printf x=1 then then test then awk 'quoted text'
+--verbose | 2>/dev/null
+local local $(pwd) /usr/bin awk "$1" export
+		cd x=1 | 'quoted text' /usr/bin -eu x=1 | && x=1 ${HOME} x=1 readonly
+		"$1" done test /usr/bin && && sed 'quoted text' grep "$@" | -eu /usr/bin then
+	"$@" echo $(pwd) sed printf done
+	-eu ${HOME} awk readonly done "$1" export "$@" echo then readonly sed "$1" ${HOME}
+		x=1 2>/dev/null "$@" readonly | "$1" /usr/bin -eu 'quoted text' --verbose
+	grep | test sed 2>/dev/null x=1 export 2>/dev/null sed 2>/dev/null
+test "$@" && sed printf "$1" ${HOME} cd export then readonly
+		-eu echo -eu x=1 && export echo awk export | readonly x=1 'quoted text' $(pwd)
+done test $(pwd) $(pwd) "$1" &&
+local test -eu printf done "$1" test
+		/usr/bin echo cd x=1 -eu "$1" cd x=1 ${HOME}
+		--verbose 'quoted text' readonly -eu readonly ${HOME} $(pwd) $(pwd) local &&
+test 'quoted text' then done ${HOME} --verbose ${HOME} /usr/bin
+grep "$1" then 'quoted text' echo 2>/dev/null
+	2>/dev/null test printf export echo "$@" awk cd /usr/bin "$@" done grep local
+		$(pwd) awk 'quoted text'
+		x=1 awk | printf /usr/bin "$@" readonly
+x=1 ${HOME} 'quoted text'
+	x=1 -eu printf readonly ${HOME}
+	| -eu done 2>/dev/null x=1 --verbose done readonly
+	$(pwd) "$@" 2>/dev/null local "$@" ${HOME} /usr/bin &&
+--verbose | cd && /usr/bin 'quoted text' cd
+${HOME} && cd export test export readonly
+		| "$1" cd -eu 'quoted text' --verbose
+	'quoted text' local echo sed export test 'quoted text' --verbose 'quoted text'
+		-eu awk $(pwd) then echo awk then 'quoted text' local "$1" | printf
+	awk awk $(pwd) printf test /usr/bin | ${HOME}
+$(pwd) readonly $(pwd) "$1" awk
+&& local x=1 | local sed | cd --verbose
+export then $(pwd) 2>/dev/null echo -eu | 2>/dev/null
+	"$@" done printf echo export then cd echo done test $(pwd) -eu
+test ${HOME} $(pwd) printf readonly then "$1" test done done /usr/bin
+		/usr/bin --verbose test awk ${HOME} 2>/dev/null 2>/dev/null
+"$@" "$1" awk awk printf $(pwd) then done && $(pwd) /usr/bin readonly
+		/usr/bin cd echo 'quoted text' cd 'quoted text' awk && "$@" /usr/bin sed
+sed $(pwd) ${HOME} 'quoted text' readonly 2>/dev/null $(pwd) done "$@"
+	awk awk cd export grep done x=1 $(pwd) test then ${HOME} "$@" ${HOME}
+		awk | export printf x=1 'quoted text' && cd /usr/bin ${HOME} printf
+		'quoted text' grep local | printf --verbose ${HOME} local local /usr/bin
+		/usr/bin readonly 2>/dev/null done "$@" "$1" x=1
+grep /usr/bin 2>/dev/null
+2>/dev/null "$@" readonly && sed local /usr/bin 2>/dev/null
+$(pwd) | $(pwd) /usr/bin awk local
+sed echo $(pwd) readonly "$@" grep export ${HOME} x=1 then ${HOME}
+local 'quoted text' /usr/bin grep "$@" ${HOME} /usr/bin 'quoted text' -eu printf
+	local && done readonly awk done awk "$@" grep x=1 printf
+then x=1 echo then -eu "$1" then done && cd grep awk test readonly
+printf "$@" | | 2>/dev/null x=1
+then export local echo then 2>/dev/null --verbose $(pwd) -eu local
+		printf printf readonly "$1"
+"$@" readonly export /usr/bin
+		done awk "$1" 2>/dev/null 2>/dev/null 2>/dev/null -eu && export --verbose "$1" awk
+		test readonly sed 2>/dev/null --verbose $(pwd) -eu --verbose
+	then echo local --verbose
+	then local ${HOME} -eu | 'quoted text'
+--verbose awk printf $(pwd) --verbose ${HOME} then $(pwd) "$1" readonly && | cd
+	readonly done sed x=1 awk grep 'quoted text' done && 'quoted text' export
+	cd $(pwd) -eu 2>/dev/null /usr/bin x=1 readonly sed sed grep
+	${HOME} cd grep 2>/dev/null "$@" ${HOME} 'quoted text'
+"$1" export awk test $(pwd) 'quoted text' && "$@" sed
+	/usr/bin export -eu test 2>/dev/null
+	2>/dev/null ${HOME} 2>/dev/null --verbose readonly
+	awk 'quoted text' export cd 'quoted text' -eu printf done
+	"$@" "$1" "$@" echo awk test printf
+$(pwd) echo 2>/dev/null && awk && -eu /usr/bin 2>/dev/null --verbose
+		'quoted text' && local export 2>/dev/null "$@"
+printf done | "$@" printf $(pwd) local test
+sed sed -eu ${HOME} printf awk readonly
+		$(pwd) --verbose export | echo "$1" | then "$1" export
+	cd local --verbose && 2>/dev/null
+	local "$@" /usr/bin -eu $(pwd)
+	printf "$@" $(pwd) local ${HOME} awk
+		"$1" echo --verbose "$1" test export ${HOME} then -eu done local done
+grep done | "$1" 'quoted text' awk 2>/dev/null
+	export "$1" export 2>/dev/null
+		printf 'quoted text' | export awk
+${HOME} export 'quoted text' -eu sed /usr/bin /usr/bin echo
+${HOME} local ${HOME} | done then /usr/bin
+		cd --verbose x=1 awk /usr/bin /usr/bin "$@" | then 'quoted text' then /usr/bin "$@"
+	printf 2>/dev/null &&
+		test printf ${HOME} local cd $(pwd) $(pwd) && export
+readonly ${HOME} ${HOME} done
+/usr/bin done "$@" | "$@" | $(pwd) "$1" -eu $(pwd) && $(pwd) echo | test echo /usr/bin
+${HOME} cd 'quoted text' x=1 echo 'quoted text' readonly "$@" done
+		done sed printf echo "$@" && 2>/dev/null /usr/bin readonly -eu done
+		cd echo readonly 2>/dev/null
+		readonly 'quoted text' /usr/bin "$@" done x=1
+		cd echo --verbose && awk then "$@"
+	/usr/bin --verbose "$@" printf sed 'quoted text' grep /usr/bin x=1 grep
+x=1 | $(pwd) then grep awk export sed grep printf grep local
+	${HOME} local test "$@" 'quoted text' x=1 ${HOME}
+	echo sed done 2>/dev/null then readonly && --verbose
+	done export done | sed export ${HOME} x=1 test
+$(pwd) echo 'quoted text' "$@" ${HOME} done --verbose --verbose awk -eu "$1"
+sed printf /usr/bin awk $(pwd) grep done "$1" readonly
+		awk $(pwd) $(pwd) done echo test sed then | local
+	done local "$1" $(pwd) /usr/bin "$@" 'quoted text'
+		done readonly grep test cd | 'quoted text'
+	cd | /usr/bin --verbose sed grep "$1" test --verbose test echo
+		printf readonly done printf --verbose "$@"
+	test x=1 x=1 done readonly export ${HOME} x=1 && && -eu /usr/bin /usr/bin $(pwd)
+echo ${HOME} && readonly
+${HOME} readonly ${HOME} then test
+		cd printf grep echo "$1" -eu 2>/dev/null awk -eu "$1" | --verbose --verbose
+		printf x=1 printf x=1 | --verbose "$1" grep 2>/dev/null echo &&
+done ${HOME} 2>/dev/null "$@" x=1 sed
+		then test x=1 "$@" ${HOME} "$1"
+export cd ${HOME} then readonly awk x=1 test local awk
+		-eu && done "$@" -eu echo readonly readonly
+	'quoted text' && | readonly readonly 2>/dev/null export
+	awk "$@" export "$1" grep --verbose ${HOME} 2>/dev/null
+		printf "$1" 2>/dev/null export "$@" 'quoted text'
+		export ${HOME} cd test --verbose
+printf && | "$1" /usr/bin awk grep 2>/dev/null -eu local awk readonly
+--verbose 2>/dev/null cd then /usr/bin $(pwd) echo echo printf -eu ${HOME}
+printf $(pwd) x=1 echo local $(pwd) cd 2>/dev/null 2>/dev/null --verbose
+	readonly sed 2>/dev/null then awk | test done local echo "$1" -eu sed -eu
+local sed ${HOME} then done echo -eu done printf echo test grep 2>/dev/null grep
+x=1 local readonly test &&
+		'quoted text' 2>/dev/null readonly 2>/dev/null
+		&& | | grep "$1" cd local "$@" | "$1" export
+		grep grep -eu awk readonly $(pwd) ${HOME} --verbose $(pwd)
+		test cd $(pwd) done grep export
+--verbose echo "$@" --verbose "$@" readonly
+	"$@" export test && 'quoted text'
+awk echo readonly && x=1
+	readonly then export grep printf -eu "$1" export 2>/dev/null
+| && 2>/dev/null export x=1
+	--verbose "$@" -eu x=1 "$1" echo grep grep | test ${HOME} done export
+	"$@" 2>/dev/null export readonly /usr/bin export echo --verbose test
+		$(pwd) $(pwd) && -eu local x=1 "$1" "$@"
+		then 'quoted text' "$@" /usr/bin readonly cd readonly -eu echo cd test "$@" then
+-eu "$@" x=1 echo 'quoted text' printf
+		readonly ${HOME} local --verbose cd done /usr/bin local grep test 'quoted text'
+printf 'quoted text' 2>/dev/null /usr/bin echo awk local
+	&& "$1" $(pwd) then readonly 2>/dev/null
+'quoted text' "$1" grep grep x=1 local local --verbose 'quoted text'
+then done local x=1 test /usr/bin "$@" done printf done 'quoted text'
+	--verbose $(pwd) --verbose -eu "$1" && && $(pwd)
+2>/dev/null local /usr/bin "$1" ${HOME} "$@" done $(pwd) readonly -eu "$1"
+	export test 2>/dev/null && 'quoted text' grep then 2>/dev/null
+| ${HOME} ${HOME} test 'quoted text' done cd $(pwd)
+		2>/dev/null sed ${HOME} -eu
+		awk then test x=1 -eu x=1 grep export echo awk |
+export grep --verbose local done "$@" $(pwd)
+		echo then $(pwd) 'quoted text' -eu -eu ${HOME} then printf test
+	${HOME} $(pwd) "$@" x=1 ${HOME} "$@" 2>/dev/null
+	--verbose printf done 'quoted text' "$1"
+"$@" test readonly $(pwd) ${HOME} ${HOME} export then 2>/dev/null
+	"$@" "$@" ${HOME} 'quoted text'
+		$(pwd) ${HOME} sed done /usr/bin
+	awk --verbose $(pwd) done "$1" $(pwd)
+test $(pwd) ${HOME} $(pwd) ${HOME} local
+	export -eu && sed -eu printf local readonly -eu "$1" echo /usr/bin
+export x=1 /usr/bin | /usr/bin --verbose /usr/bin
+2>/dev/null readonly -eu local --verbose awk test
+		&& readonly export -eu awk export && "$1" local readonly x=1 &&
+		"$@" done --verbose --verbose && cd printf awk then 2>/dev/null
+	2>/dev/null cd cd then
+		-eu printf -eu then /usr/bin
+	local local done "$@" sed printf done awk cd 2>/dev/null /usr/bin
+"$@" /usr/bin 2>/dev/null /usr/bin 2>/dev/null echo grep
+		export done --verbose && "$1" local
+	readonly "$1" && test -eu then echo /usr/bin -eu readonly
+printf ${HOME} | --verbose cd test awk 2>/dev/null
+| 2>/dev/null 'quoted text' printf && export "$@" ${HOME} && | printf 2>/dev/null
+		then | 'quoted text' done grep x=1
+-eu export printf | && "$1" ${HOME} --verbose ${HOME} "$@" | awk ${HOME}
+	sed --verbose local then readonly local 2>/dev/null
+	--verbose grep --verbose awk printf x=1 /usr/bin
+	test 2>/dev/null echo then --verbose x=1 local && readonly sed then
+		then local -eu "$1" /usr/bin awk
+	printf echo --verbose -eu "$1" awk |
+done awk | "$@" awk ${HOME}
+		"$@" "$@" then cd done printf test printf sed awk -eu grep grep grep local export
+| sed "$1" 2>/dev/null echo test && then "$@" --verbose awk test
+test -eu x=1 /usr/bin ${HOME} export echo readonly -eu 2>/dev/null
+"$1" export awk cd $(pwd) "$1" "$@" && echo sed "$@" echo
+		grep done | echo done awk test "$@" x=1 /usr/bin test export && -eu
+done --verbose awk grep done --verbose
+readonly readonly done grep "$@"
+x=1 -eu printf readonly -eu
+	--verbose export $(pwd) --verbose 'quoted text'
+		local /usr/bin -eu 'quoted text' local "$1"
+done echo /usr/bin awk printf done
+	local "$@" readonly printf x=1 awk done grep 2>/dev/null sed $(pwd) --verbose
+		2>/dev/null 2>/dev/null local /usr/bin awk -eu test printf "$1" "$@" 'quoted text'
+	readonly awk -eu "$1" readonly cd && -eu "$1" x=1 cd grep grep ${HOME} "$@"
+		test echo x=1 "$@" done then && test
+		"$@" "$@" $(pwd) then --verbose "$1" done readonly -eu readonly local test ${HOME}
+${HOME} 'quoted text' awk /usr/bin sed readonly
+${HOME} "$@" readonly readonly export printf echo && --verbose --verbose
+/usr/bin /usr/bin && 2>/dev/null export then "$@" grep /usr/bin
+	sed cd 'quoted text' local awk $(pwd) | then awk 'quoted text' done readonly
+		-eu ${HOME} ${HOME} x=1 export /usr/bin /usr/bin printf cd --verbose echo echo
+	$(pwd) readonly 2>/dev/null --verbose "$@" readonly x=1 sed --verbose
+readonly export export "$@" done | printf readonly /usr/bin test
+	awk export grep 2>/dev/null
+	'quoted text' test "$1" 'quoted text' sed $(pwd)
+"$@" sed | "$1" grep -eu /usr/bin
+"$1" /usr/bin 'quoted text' -eu /usr/bin -eu x=1
+	sed awk echo then then /usr/bin --verbose "$@" test
+		done /usr/bin cd ${HOME} --verbose | export
+	x=1 then 2>/dev/null cd sed test "$1" && --verbose then awk ${HOME} && local "$1"
+done then /usr/bin then printf --verbose $(pwd)
+		"$1" /usr/bin --verbose 'quoted text' local ${HOME} test ${HOME} -eu then done
+		readonly local -eu "$@" grep cd 2>/dev/null
+		$(pwd) grep printf export sed --verbose echo && && test ${HOME}
+		$(pwd) 'quoted text' done export export "$@" $(pwd) done awk /usr/bin
+	echo echo done local sed $(pwd) x=1 then readonly test x=1 grep echo
+	grep --verbose cd && echo x=1 cd && --verbose then grep |
+		export --verbose local && --verbose 'quoted text' | /usr/bin "$@" --verbose
+awk 'quoted text' ${HOME}
+	test | readonly $(pwd) then
+echo $(pwd) "$@" echo local x=1 "$1" --verbose "$1" | awk -eu x=1 /usr/bin
+		"$1" x=1 then && cd awk ${HOME} awk grep && local echo export sed then | --verbose
+	readonly 2>/dev/null -eu "$1" done local local
+local test /usr/bin export
+		$(pwd) --verbose --verbose echo echo | cd /usr/bin ${HOME} local ${HOME}
+	-eu export done && /usr/bin "$@" done export -eu then done done 2>/dev/null
+		test $(pwd) printf $(pwd) echo awk "$@" test | x=1 $(pwd)
+		grep cd done x=1 | 2>/dev/null awk /usr/bin 'quoted text'
+"$@" && 2>/dev/null -eu export /usr/bin cd "$@" awk -eu local 2>/dev/null awk ${HOME}
+		| awk | "$@" then then x=1 grep awk
+		2>/dev/null "$1" readonly && printf sed
+	${HOME} && 2>/dev/null "$1" $(pwd) -eu | readonly
+	"$1" awk "$1" local && done printf readonly printf 'quoted text' done -eu
+		awk sed "$@" --verbose readonly "$@" grep awk x=1 'quoted text' 2>/dev/null printf
+		-eu ${HOME} awk 'quoted text' ${HOME} export 'quoted text' "$1" export
+		$(pwd) done test grep then then sed export printf -eu && echo echo "$1" "$@" grep
+test "$@" $(pwd) 2>/dev/null /usr/bin 'quoted text' | 2>/dev/null --verbose done
+		local | done "$1" local -eu 'quoted text' &&
+awk "$1" 2>/dev/null
+	${HOME} sed "$@" sed -eu x=1 && cd test --verbose export
+	--verbose echo echo $(pwd) $(pwd) awk /usr/bin grep
+		| "$@" 'quoted text' sed -eu -eu -eu then ${HOME} |
+awk then grep echo sed $(pwd) -eu echo done echo $(pwd) && echo
+		/usr/bin && /usr/bin "$@" readonly 'quoted text'
+2>/dev/null printf done x=1 -eu done awk "$1" export
+		local then ${HOME} grep grep sed | echo 2>/dev/null
+	--verbose 'quoted text' && 2>/dev/null "$1"
+		test then "$1" test then ${HOME} ${HOME}
+	$(pwd) grep then 'quoted text' readonly local && $(pwd)
+	-eu /usr/bin -eu then awk -eu grep printf 'quoted text' awk done echo awk --verbose
+&& test local x=1 && then | --verbose export grep -eu "$1"
+	x=1 test awk "$1" awk /usr/bin echo /usr/bin cd
+| "$1" ${HOME} local /usr/bin grep awk cd "$@" awk echo
+		done readonly 'quoted text' "$1" "$@" export
+'quoted text' readonly -eu done
+		"$@" cd /usr/bin printf $(pwd) readonly test
+&& -eu test then printf "$@" 'quoted text'
+	cd done x=1 printf -eu x=1 cd readonly readonly x=1 x=1 then -eu | done
+	'quoted text' cd cd grep 'quoted text'
+	2>/dev/null "$@" printf cd --verbose && cd test | export
+	cd x=1 2>/dev/null export done
+		/usr/bin 'quoted text' export
+"$1" ${HOME} grep export /usr/bin | grep
+	2>/dev/null done local cd awk -eu 2>/dev/null then done
+awk /usr/bin done done -eu test export x=1 done 'quoted text' 'quoted text' "$@"
+	sed grep readonly local 'quoted text' | sed cd echo test "$1" readonly
+	'quoted text' $(pwd) x=1 $(pwd) printf 'quoted text' cd x=1 -eu -eu
+$(pwd) ${HOME} grep then 2>/dev/null grep local -eu -eu done local 'quoted text'
+	awk export "$@" awk done -eu printf cd 2>/dev/null 2>/dev/null --verbose grep
+	2>/dev/null --verbose 2>/dev/null | done 2>/dev/null
+	x=1 'quoted text' grep awk $(pwd) echo -eu &&
+		export test awk echo ${HOME} 2>/dev/null readonly | readonly | /usr/bin grep
+		&& grep && sed $(pwd) -eu ${HOME} local cd &&
+		test printf 2>/dev/null /usr/bin export 2>/dev/null
+-eu cd grep test awk 2>/dev/null then
+cd awk "$@" cd $(pwd) 2>/dev/null grep ${HOME} printf grep then
+		test readonly x=1 printf cd
+	--verbose readonly test --verbose /usr/bin $(pwd) 2>/dev/null
+	echo readonly --verbose /usr/bin echo $(pwd)
+local "$@" /usr/bin "$@" test export
+		-eu then test -eu local awk cd x=1
+x=1 'quoted text' cd x=1 $(pwd)
+	readonly && cd awk 2>/dev/null printf
+awk cd ${HOME} printf echo
+		--verbose printf echo 'quoted text' test $(pwd)
+	2>/dev/null -eu | "$@" "$@" /usr/bin sed printf
+| cd $(pwd) export x=1
+x=1 printf --verbose -eu cd printf 'quoted text' -eu $(pwd) "$@" local printf
+		test --verbose "$@" $(pwd)
+	/usr/bin local | x=1 printf test export cd ${HOME} "$1" -eu -eu cd ${HOME}
+/usr/bin "$@" x=1 /usr/bin x=1 x=1 cd -eu local /usr/bin
+		cd x=1 printf --verbose export ${HOME} cd
+	local readonly readonly -eu export 2>/dev/null cd readonly
+	printf readonly then /usr/bin awk printf awk "$1" awk awk printf sed readonly
+	-eu printf local then "$1" done x=1 export && ${HOME} | cd
+	sed 'quoted text' 'quoted text' echo -eu "$1" ${HOME} --verbose export
+		readonly ${HOME} readonly awk | ${HOME}
+		$(pwd) test /usr/bin | && sed done
+"$@" -eu cd /usr/bin && "$@"
+		test "$@" && x=1 -eu cd $(pwd) 'quoted text' --verbose
+		readonly && export && -eu /usr/bin local "$1" readonly printf local
+		grep then ${HOME} awk 2>/dev/null printf done /usr/bin printf printf -eu "$1" sed
+		x=1 "$@" x=1 -eu awk then "$1" && readonly $(pwd) sed $(pwd) "$@" "$@"
+awk 2>/dev/null /usr/bin local "$1" printf "$@" export sed awk cd 2>/dev/null
+		&& readonly x=1 export export export then 'quoted text'
+		"$1" sed cd /usr/bin x=1 2>/dev/null awk export 'quoted text' /usr/bin -eu /usr/bin
+	sed "$@" $(pwd) | -eu then then cd 2>/dev/null 'quoted text'
+	'quoted text' cd /usr/bin sed "$@" "$@" | export
+		awk then cd sed awk local
+		"$@" awk /usr/bin cd && -eu -eu
+2>/dev/null "$1" /usr/bin echo export awk 'quoted text' sed printf echo
+		| printf 'quoted text' && export x=1 sed done
+		echo grep printf 2>/dev/null sed test 'quoted text'
+		printf then "$@" "$@" --verbose && /usr/bin "$1" -eu | cd echo ${HOME}
+		"$@" printf /usr/bin 2>/dev/null printf done --verbose printf export
+		cd cd 'quoted text' /usr/bin
+	sed sed awk x=1 awk /usr/bin sed --verbose test
+'quoted text' cd test "$@" sed then && && -eu
+&& sed --verbose --verbose awk grep echo -eu && awk awk local --verbose
+done cd echo grep printf
+		${HOME} x=1 export --verbose sed
+		export cd x=1 "$1" awk grep | local
+		$(pwd) x=1 awk readonly done test
+	2>/dev/null 2>/dev/null echo local ${HOME} echo sed
+	${HOME} export printf 'quoted text' cd 'quoted text' awk
+	${HOME} cd 'quoted text' then 'quoted text' grep export "$@"
+	grep readonly local printf export 'quoted text' then cd && readonly 'quoted text'
+		export | readonly printf 2>/dev/null sed printf && sed 2>/dev/null
+&& && ${HOME} local then
+then x=1 export awk x=1 printf
+	$(pwd) -eu grep export $(pwd)
+		$(pwd) -eu grep readonly x=1 "$@" sed
+2>/dev/null done x=1 | /usr/bin
+2>/dev/null 2>/dev/null | $(pwd) 'quoted text' printf
+		x=1 && cd "$@" /usr/bin test | readonly 'quoted text'
+'quoted text' x=1 -eu done 'quoted text' then printf done sed x=1 && &&
+		&& awk $(pwd) && x=1 awk "$1" printf "$@" grep then export
+		| export then ${HOME} "$@" awk grep 2>/dev/null done x=1 then then grep done
+"$@" cd then sed 2>/dev/null
+		then test 'quoted text' 2>/dev/null
+	"$1" test local && then then printf 'quoted text' && done then $(pwd) test
+		-eu x=1 --verbose echo printf grep awk x=1 readonly
+	local /usr/bin x=1 'quoted text'
+	"$1" -eu | "$1" /usr/bin local
+		"$1" printf done --verbose --verbose echo grep
+grep readonly "$@" readonly && done && printf 'quoted text' sed 2>/dev/null
+		| "$1" | && then --verbose
+&& local && -eu --verbose && | local
+2>/dev/null -eu local test | && | then x=1 ${HOME} ${HOME} && awk local
+'quoted text' x=1 printf done | test then done then
+	sed x=1 /usr/bin readonly "$@" printf ${HOME}
+		readonly done ${HOME} "$@" $(pwd)
+${HOME} /usr/bin -eu test test cd | $(pwd) "$1" -eu "$1" readonly
+	cd cd then local -eu then $(pwd) ${HOME} awk
+		| 'quoted text' 'quoted text' then cd test ${HOME} x=1 |
+--verbose sed awk ${HOME} 'quoted text'
+grep test done x=1 echo 2>/dev/null
+${HOME} echo 'quoted text' then sed "$1"
+	| x=1 x=1 sed $(pwd) grep $(pwd) | cd -eu && echo /usr/bin /usr/bin printf
+	$(pwd) ${HOME} cd /usr/bin printf cd sed grep printf -eu readonly
+		"$@" "$@" -eu 2>/dev/null local sed && printf -eu /usr/bin cd then
+	printf local && test --verbose readonly
+done -eu "$@" echo test echo export local 2>/dev/null
+x=1 cd && grep printf --verbose echo grep ${HOME} "$@" --verbose printf
+	export /usr/bin --verbose local "$1" --verbose echo sed test
+2>/dev/null done echo grep "$1" cd cd 2>/dev/null && cd printf
+	grep "$1" local test sed -eu /usr/bin -eu /usr/bin
+		/usr/bin | printf /usr/bin
+		cd local 2>/dev/null "$1"
+	--verbose "$@" export grep ${HOME} x=1 /usr/bin
+	${HOME} x=1 "$@" sed readonly "$@" local 'quoted text' test local "$1"
+		x=1 -eu printf x=1 test printf "$1" then export test $(pwd)
+		&& readonly | readonly grep 'quoted text' "$@" test
+$(pwd) 'quoted text' sed test "$1" echo done "$1" printf 2>/dev/null
+grep printf | grep -eu "$@" grep done
+	cd | && export x=1 && done "$@" then then done grep cd then export "$@" printf
+		sed "$@" sed local readonly sed x=1 --verbose cd && done printf && "$1" /usr/bin
+-eu ${HOME} readonly ${HOME} "$@" local readonly 'quoted text' grep local
+		&& echo "$1" test "$1" grep awk "$@" && 2>/dev/null |
+	&& printf $(pwd) awk test "$1" sed "$1" test then
+test done then printf 2>/dev/null
+	echo readonly done | echo test
+	2>/dev/null echo 'quoted text'
+		then cd done "$1" 2>/dev/null "$@" && --verbose export test cd test 2>/dev/null
+		grep export local done sed readonly echo
+		grep awk ${HOME} local printf cd grep | x=1 then grep grep "$1"
+x=1 export then sed $(pwd) done && -eu cd
+		'quoted text' cd $(pwd) /usr/bin /usr/bin cd 2>/dev/null
+| printf then test "$@" "$1" --verbose
+	printf cd done $(pwd)
+export && ${HOME} local 2>/dev/null
+&& readonly test "$1" 'quoted text' /usr/bin cd | grep test
+| then export /usr/bin grep "$1" echo "$1" printf
+test grep cd ${HOME} echo
+local /usr/bin x=1 | echo 'quoted text'
+		export local awk grep
+	printf $(pwd) echo readonly $(pwd) local
+		| echo "$1" test grep export x=1 --verbose sed | export grep -eu echo awk "$1"
+		2>/dev/null ${HOME} local printf "$@"
+${HOME} local then 2>/dev/null done grep test "$1" readonly "$1" awk
+test ${HOME} | then 'quoted text' test "$@"
+	2>/dev/null "$1" readonly export $(pwd) ${HOME} --verbose $(pwd) awk echo done
+		$(pwd) readonly cd then
+	-eu && printf readonly 'quoted text' awk
+'quoted text' readonly x=1 $(pwd) cd "$@" done
+		cd | sed x=1 /usr/bin $(pwd) x=1 readonly ${HOME} && readonly local then
+	grep "$@" export "$@" 2>/dev/null awk | 'quoted text' export test x=1
+done done readonly cd $(pwd) grep cd echo ${HOME}
+"$@" $(pwd) echo "$1" --verbose | then ${HOME} x=1 "$1" readonly x=1
+&& 2>/dev/null awk cd --verbose local awk done && /usr/bin test export readonly
+		test test cd grep echo 2>/dev/null --verbose 'quoted text'
+	${HOME} echo "$@" export echo "$@" /usr/bin
+cd --verbose /usr/bin then "$1" /usr/bin grep awk x=1
+	&& "$@" ${HOME} grep | test export export "$1" then $(pwd) done sed sed then
+	${HOME} local "$1" 2>/dev/null x=1 'quoted text' test export $(pwd)
+-eu cd local local awk "$@" readonly 2>/dev/null cd echo | export ${HOME}
+${HOME} x=1 --verbose $(pwd)
+		local grep "$@" --verbose
+awk | export -eu printf /usr/bin ${HOME} $(pwd) printf then
+--verbose ${HOME} local x=1 grep x=1 ${HOME} export
+	/usr/bin then /usr/bin ${HOME} && --verbose export export cd 'quoted text' x=1
+	printf | grep printf 2>/dev/null /usr/bin
+		"$1" export && "$@" test awk 2>/dev/null test
+		then local echo then local "$1" -eu printf
+awk done local 'quoted text' awk && x=1 'quoted text' --verbose
+&& -eu done -eu awk readonly
+	done readonly grep x=1 2>/dev/null -eu sed then cd ${HOME} "$@" x=1 "$@"
+		then cd then 2>/dev/null --verbose echo && printf readonly export cd then echo
+	"$@" test "$1" grep -eu -eu sed "$@"
+grep cd 2>/dev/null export readonly
+"$1" | local | x=1 then printf -eu
+local readonly 2>/dev/null readonly
+	x=1 sed awk echo 'quoted text'
+then "$@" then x=1 cd --verbose -eu ${HOME} && "$@" awk grep cd --verbose printf
+		"$@" local local cd grep sed sed local cd export
+awk awk done awk test done "$@" --verbose 'quoted text' sed export done printf
+		&& 2>/dev/null cd | test local grep /usr/bin $(pwd)
+		-eu 'quoted text' local 'quoted text' awk awk awk
+export x=1 export then done grep
+	2>/dev/null sed /usr/bin ${HOME} ${HOME} "$@" local && sed 2>/dev/null
+${HOME} "$1" printf -eu "$@" printf && grep printf /usr/bin 'quoted text'
+	&& -eu cd $(pwd) local $(pwd)
+	-eu then then local | done $(pwd) $(pwd) && "$1" $(pwd) "$@" export
+		done ${HOME} export 2>/dev/null
+		-eu 'quoted text' && 'quoted text' /usr/bin awk 'quoted text' x=1 done | 2>/dev/null
+	'quoted text' $(pwd) --verbose ${HOME} echo 2>/dev/null x=1 awk
+cd test test && x=1 local echo "$@" "$@" export | echo "$1" test
+	printf 'quoted text' --verbose x=1 then done echo sed "$@"
+-eu -eu then "$@" ${HOME} | done
+	export then "$1" 'quoted text' 2>/dev/null "$@" done $(pwd) 2>/dev/null
+	-eu ${HOME} test grep printf && sed -eu export /usr/bin "$1" grep ${HOME}
+	| /usr/bin export done cd test "$1" grep export awk sed $(pwd) "$@" sed /usr/bin
+		export cd ${HOME} && grep echo readonly
+${HOME} --verbose | 2>/dev/null
+	sed --verbose x=1 awk awk "$1"
+	2>/dev/null test ${HOME} readonly awk test x=1 echo awk /usr/bin cd 2>/dev/null
+done $(pwd) readonly $(pwd) cd awk $(pwd) awk
+test /usr/bin sed ${HOME} 'quoted text' 'quoted text'
+cd | then sed local "$1" then 2>/dev/null -eu
+		then "$@" $(pwd) awk readonly readonly ${HOME} export printf sed done /usr/bin
+	done awk "$@" && 'quoted text' $(pwd) && printf ${HOME} echo
+2>/dev/null local done | then local echo "$1" echo -eu
+| $(pwd) /usr/bin local && /usr/bin readonly | x=1 sed "$@"
+	| printf then $(pwd) | cd 2>/dev/null ${HOME} done done export printf awk
+	sed | $(pwd) /usr/bin 2>/dev/null 2>/dev/null test --verbose awk x=1
+awk $(pwd) x=1 sed awk readonly done cd done "$1" 2>/dev/null
+	x=1 $(pwd) $(pwd) "$1" cd x=1 /usr/bin
+| -eu ${HOME} local "$@" && --verbose -eu
+		2>/dev/null ${HOME} /usr/bin test 'quoted text'
+		/usr/bin echo 'quoted text' test "$@" done $(pwd) cd -eu readonly awk | awk
+	--verbose -eu printf -eu &&
+		readonly sed test readonly export ${HOME} | x=1 readonly cd 2>/dev/null 2>/dev/null
+		x=1 -eu "$@" export local
+echo cd --verbose readonly | done
+cd 'quoted text' -eu grep -eu x=1 sed sed then && then cd "$1" ${HOME} --verbose
+		| "$@" $(pwd) awk x=1 x=1
+		then $(pwd) then 'quoted text' |
+	readonly readonly ${HOME} "$@" local export
+sed done "$@" sed /usr/bin
+		"$@" "$@" | ${HOME} local readonly export test awk then
+		sed | -eu -eu readonly x=1 local $(pwd) "$@" sed cd then 2>/dev/null awk
+		-eu export "$@" -eu $(pwd) /usr/bin "$1" local -eu local
+done grep x=1 readonly cd cd export echo | /usr/bin printf local /usr/bin /usr/bin
+		--verbose echo -eu "$@" readonly 2>/dev/null
+		echo /usr/bin x=1 echo -eu local /usr/bin ${HOME} cd then /usr/bin
+local 'quoted text' sed "$1" then readonly --verbose 2>/dev/null
+	awk --verbose awk 'quoted text'
+	${HOME} --verbose x=1 && 'quoted text' --verbose done then -eu $(pwd)
+		2>/dev/null "$@" readonly 'quoted text'
+"$@" -eu x=1 grep -eu test export local && done export sed
+	| done printf $(pwd) echo /usr/bin | readonly 2>/dev/null cd grep echo
+		/usr/bin 'quoted text' -eu -eu $(pwd) sed
+		/usr/bin && then 2>/dev/null "$1" "$1"
+"$@" 'quoted text' "$@" echo -eu /usr/bin sed | -eu /usr/bin export --verbose
+local cd "$@" x=1 /usr/bin $(pwd) awk grep then test
+		readonly local 'quoted text' test awk x=1 readonly done
+-eu sed $(pwd) grep local readonly && "$1" --verbose --verbose
+		readonly cd "$@" export export readonly sed
+	awk local $(pwd) echo grep sed | ${HOME} && local
+	export test export grep done test 2>/dev/null
+	done 'quoted text' sed awk --verbose $(pwd) cd && /usr/bin ${HOME} 'quoted text'
+		x=1 "$1" export 2>/dev/null then echo "$@" echo readonly && echo
+		--verbose local local grep 'quoted text'
+readonly then "$@" readonly -eu x=1 2>/dev/null local echo /usr/bin
+		grep awk && "$1" printf test ${HOME} readonly export ${HOME} $(pwd) -eu
+/usr/bin "$1" sed local -eu readonly export sed
+"$@" -eu 2>/dev/null --verbose
+	echo sed "$1" $(pwd) && "$@" x=1 cd --verbose
+		x=1 /usr/bin sed /usr/bin then $(pwd) "$@" && | ${HOME} awk awk printf | export
+	-eu "$1" && | sed -eu &&
+		test done ${HOME} /usr/bin /usr/bin
+		-eu "$@" readonly ${HOME} test sed local "$@" then -eu
+		-eu "$@" "$@" test "$@" /usr/bin export
+'quoted text' sed sed "$1" x=1 2>/dev/null | -eu test 'quoted text'
+	| "$1" readonly cd x=1 echo && 'quoted text'
+| $(pwd) "$@" x=1 then readonly printf
+	2>/dev/null then | 'quoted text'
+		"$1" done 2>/dev/null ${HOME} local && -eu echo "$1" echo printf
+		test ${HOME} cd "$@" grep echo sed
+	printf "$1" cd "$1" grep awk done
+	done ${HOME} local x=1 echo printf awk echo then cd
+2>/dev/null local export ${HOME} done readonly
+		${HOME} done printf /usr/bin
+		&& "$@" local /usr/bin ${HOME} 'quoted text' | $(pwd) printf ${HOME}
+	${HOME} -eu ${HOME} printf export | readonly cd ${HOME} then --verbose
+		printf x=1 x=1 /usr/bin readonly export done && ${HOME}
+-eu 'quoted text' ${HOME}
+		grep /usr/bin export printf $(pwd) local cd -eu $(pwd) grep "$@" --verbose test
+	$(pwd) echo awk sed readonly export "$@" printf 2>/dev/null | /usr/bin
+$(pwd) test ${HOME} done local test && test awk x=1 grep then 'quoted text' local
+	--verbose then | $(pwd) done grep grep then -eu test grep 'quoted text'
+	sed echo printf grep sed x=1 2>/dev/null then awk readonly | -eu
+	export $(pwd) "$1" sed "$@"
+&& --verbose readonly export
+	cd sed "$@" 'quoted text'
+	export && | --verbose readonly export ${HOME} printf
+		"$@" | echo | /usr/bin sed -eu | $(pwd) export | "$1" 2>/dev/null
+		export readonly sed cd ${HOME} /usr/bin echo && grep export
+done $(pwd) then awk sed | x=1 then export /usr/bin test
+	export cd then x=1 local local 'quoted text'
+	"$@" echo echo then x=1 then
+x=1 "$@" ${HOME} && sed ${HOME} local awk echo --verbose
+	sed x=1 --verbose x=1
+		cd test 'quoted text' test && printf test x=1 done | 'quoted text' "$@" sed
+	grep | 2>/dev/null local printf $(pwd) /usr/bin 2>/dev/null $(pwd) cd 2>/dev/null
+	"$@" ${HOME} "$@" | | "$1" ${HOME} ${HOME} awk cd && --verbose 'quoted text' then
+		test local $(pwd) ${HOME} 'quoted text'
+sed sed test awk then done then | "$@" done then
+${HOME} local "$1" readonly 'quoted text'
+	"$@" echo ${HOME} local 2>/dev/null then local readonly export awk 2>/dev/null
+awk /usr/bin 2>/dev/null -eu --verbose local echo | echo -eu
+	'quoted text' export -eu
+x=1 grep printf -eu && $(pwd) sed awk readonly
+	2>/dev/null /usr/bin grep ${HOME} x=1 /usr/bin printf grep /usr/bin
+	grep test "$1" ${HOME} ${HOME} grep local && awk "$@" echo cd sed local
+	export echo local grep done grep export grep 'quoted text' &&
+		x=1 --verbose sed readonly ${HOME}
+		'quoted text' done readonly cd export awk "$@" -eu local x=1 cd /usr/bin
+readonly ${HOME} local then test "$@" done grep 2>/dev/null printf
+	/usr/bin -eu then test sed local --verbose awk "$@" "$@"
+	test test ${HOME} done readonly done $(pwd) "$1" readonly
+		printf awk export /usr/bin test --verbose printf sed
+done && echo | && ${HOME} ${HOME} cd --verbose ${HOME} grep
+		--verbose export | && printf /usr/bin sed | 'quoted text'
+		2>/dev/null -eu done local then --verbose | cd x=1 local printf ${HOME} "$@"
+		export -eu "$1" done printf then echo "$1" ${HOME} printf local $(pwd)
+	done grep /usr/bin ${HOME}
+awk 2>/dev/null readonly export readonly "$1"
+'quoted text' "$@" 'quoted text' grep sed readonly
+/usr/bin 'quoted text' --verbose test readonly $(pwd)
+&& 'quoted text' grep test
+/usr/bin then awk x=1 readonly test | /usr/bin 'quoted text' test readonly
+	&& export local 2>/dev/null readonly
+then local 2>/dev/null -eu awk ${HOME} sed --verbose 2>/dev/null done
+	"$@" --verbose then export echo -eu printf | then --verbose "$@" 'quoted text'
+		awk export 2>/dev/null readonly
+		| printf | 'quoted text' | && awk -eu local grep /usr/bin
+'quoted text' done /usr/bin x=1 $(pwd) && sed cd "$1"
+		$(pwd) "$1" 2>/dev/null --verbose done readonly awk /usr/bin 2>/dev/null /usr/bin
+	"$1" awk 2>/dev/null cd -eu 2>/dev/null
+		-eu --verbose "$1" done test export
+awk echo "$@" echo awk echo ${HOME} test $(pwd) readonly
+	then --verbose local && && export 'quoted text' grep cd --verbose && -eu
+| 2>/dev/null echo "$1" -eu | ${HOME}
+		"$1" /usr/bin cd | 'quoted text' done awk
+awk --verbose printf test cd ${HOME} 'quoted text' --verbose done
+		--verbose printf grep cd local --verbose test $(pwd) "$1" | sed readonly grep 'quoted text'
+'quoted text' then export x=1 | awk -eu 'quoted text' -eu export awk
+then | test --verbose export "$1" done export | local ${HOME} x=1 "$@" awk -eu
+/usr/bin $(pwd) awk echo ${HOME} ${HOME} echo 'quoted text'
+		done | test cd local awk awk done 'quoted text' test ${HOME} --verbose local
+		"$@" ${HOME} grep export
+	done | "$@" | test -eu local 2>/dev/null /usr/bin export x=1 && $(pwd) then
+	'quoted text' local test ${HOME} --verbose
+	grep "$@" 2>/dev/null 'quoted text' then && echo grep printf "$@" 'quoted text'
+done then --verbose echo awk | cd -eu cd test local | cd local test "$@" export
+		"$1" /usr/bin | -eu $(pwd)
+	--verbose && cd printf 'quoted text'
+		x=1 printf export && readonly printf
+		${HOME} printf export echo awk readonly local done done
+	local export "$1" 'quoted text' echo /usr/bin test grep readonly && export
+	cd cd && /usr/bin local then grep
+export echo readonly $(pwd) && then /usr/bin "$@" /usr/bin test && export "$@" test
+		then echo done awk cd x=1 done x=1 grep local done --verbose grep
+-eu readonly export local /usr/bin ${HOME} 2>/dev/null
+		&& sed "$@" grep then grep test ${HOME} 'quoted text' 'quoted text' local
+echo -eu local then "$@" ${HOME} awk done readonly 2>/dev/null
+		awk 'quoted text' test ${HOME} x=1 "$1" 'quoted text'
+	/usr/bin $(pwd) /usr/bin ${HOME} --verbose
+"$@" -eu 2>/dev/null printf 'quoted text' 2>/dev/null
+		${HOME} then -eu export /usr/bin | export then export
+#include c178.sh
+	echo -eu echo printf "$@" $(pwd) -eu awk && done
+		&& /usr/bin printf | echo
+	--verbose -eu cd done "$1" $(pwd) then -eu test 2>/dev/null
+then then readonly done ${HOME} cd "$1" $(pwd) test grep awk
+test 2>/dev/null export printf --verbose "$@" ${HOME} "$@"
+		$(pwd) --verbose $(pwd) readonly -eu done -eu grep readonly printf
+	'quoted text' local sed grep && "$1" sed test 'quoted text' && readonly
+grep grep export grep local test "$1" x=1 "$1" cd printf --verbose 2>/dev/null
+	sed "$@" --verbose x=1 printf sed | --verbose -eu echo
+	grep awk "$1" export 'quoted text' && grep printf sed awk "$@" export
+	sed x=1 grep readonly cd $(pwd) "$1" --verbose
+		x=1 -eu local | && "$@" $(pwd)
+x=1 "$1" 'quoted text' grep | --verbose |
+"$@" awk $(pwd) ${HOME} ${HOME} grep /usr/bin
+	/usr/bin printf sed cd readonly test sed "$1" readonly
+	&& local 2>/dev/null |
+/usr/bin 2>/dev/null local then then 2>/dev/null
+		'quoted text' && test -eu /usr/bin
+export readonly x=1 awk 'quoted text' echo 2>/dev/null ${HOME} -eu test
+	sed --verbose sed awk ${HOME} "$1" export sed readonly awk printf
+		printf local cd $(pwd) -eu && 'quoted text' && 2>/dev/null then 2>/dev/null
+-eu cd && 2>/dev/null done | ${HOME} ${HOME} then local /usr/bin
+'quoted text' /usr/bin echo ${HOME} "$@" printf printf cd /usr/bin
+/usr/bin && /usr/bin | then
+		grep 'quoted text' 2>/dev/null local ${HOME} -eu cd
+echo x=1 "$1" export --verbose /usr/bin -eu 'quoted text' "$1" test grep
+	x=1 awk test /usr/bin
+		printf && awk /usr/bin "$@" | -eu "$@" test
+	-eu "$@" "$@" "$1" && cd $(pwd) "$@"
+		"$@" "$1" test sed 2>/dev/null test then readonly printf
+	-eu $(pwd) sed local && local then --verbose awk && printf
+	local x=1 export echo "$@" echo 'quoted text'
+sed | 2>/dev/null /usr/bin export 2>/dev/null 'quoted text'
+"$1" --verbose test /usr/bin && && grep $(pwd) | $(pwd) --verbose "$1" export
+sed echo /usr/bin cd readonly "$1" x=1 --verbose local local 'quoted text'
+	| readonly && "$1" then grep
+2>/dev/null local grep grep then 'quoted text' ${HOME}
+		2>/dev/null "$@" done -eu x=1 2>/dev/null "$1"
+		printf grep | export "$@" cd grep /usr/bin
+	| x=1 printf "$1" 2>/dev/null local echo
+	-eu && 2>/dev/null | "$1" readonly ${HOME} 'quoted text'
+		"$@" awk printf 2>/dev/null
+cd then ${HOME} sed x=1 /usr/bin export sed printf export export local done
+2>/dev/null then $(pwd) $(pwd) grep -eu echo done
+x=1 readonly && local -eu test | awk 2>/dev/null &&
+		| ${HOME} done test cd -eu $(pwd) ${HOME} local
+		awk && test grep cd printf "$@" then grep then 2>/dev/null local local
+2>/dev/null then | awk 'quoted text' $(pwd) cd /usr/bin cd
+	${HOME} echo --verbose awk echo sed test awk test readonly done readonly "$1"
+		sed awk awk 2>/dev/null x=1 test 2>/dev/null printf "$@" export
+	done sed ${HOME} --verbose awk $(pwd) export "$1" export x=1 ${HOME}
+sed done echo /usr/bin ${HOME} 2>/dev/null grep
+		$(pwd) 2>/dev/null --verbose && test then local && -eu sed
+		"$1" done $(pwd) done then "$@" echo x=1 printf awk | "$@" 2>/dev/null
+		then awk printf | then "$1" sed readonly cd test 2>/dev/null printf "$1" local
+&& export "$1" awk && printf --verbose
+/usr/bin | /usr/bin grep && printf test | local && "$@" awk
+	sed grep "$1" x=1 && "$@" x=1 cd readonly awk test
+test 2>/dev/null then cd printf done --verbose "$@" -eu --verbose
+"$1" printf ${HOME} cd echo printf local | sed "$1"
+"$1" x=1 && 2>/dev/null
+	readonly && local "$@" local
+		then /usr/bin readonly 'quoted text' x=1 sed then -eu x=1 local
+		cd "$1" -eu grep x=1 readonly sed then "$1" grep 'quoted text' x=1 $(pwd)
+		grep $(pwd) done $(pwd) && readonly test /usr/bin | then export
+	done 2>/dev/null ${HOME} ${HOME} --verbose
+	cd && printf | printf done 'quoted text' local --verbose $(pwd)
+grep cd x=1 printf --verbose printf
+&& awk -eu local readonly awk --verbose
+		sed cd sed | /usr/bin x=1 grep -eu 2>/dev/null printf | /usr/bin printf
+	local readonly readonly
+${HOME} cd readonly "$1"
+local then export 2>/dev/null readonly 'quoted text' "$1"
+	echo readonly ${HOME}
+	2>/dev/null sed readonly printf 'quoted text' "$@" -eu | /usr/bin printf
+printf --verbose grep -eu done printf test then ${HOME} ${HOME}
+		x=1 | grep local $(pwd) "$1" test -eu x=1 test test sed --verbose local local
+	printf cd | ${HOME} echo 'quoted text' /usr/bin
+	"$1" then /usr/bin 'quoted text'
+		x=1 --verbose 2>/dev/null sed "$1" export local /usr/bin /usr/bin
+		| -eu test test grep -eu local && && export awk
+		grep test export /usr/bin
+		"$@" 'quoted text' readonly done 'quoted text' "$@" && ${HOME} --verbose
+sed -eu then awk cd --verbose local /usr/bin /usr/bin
+"$1" x=1 --verbose x=1 sed
+	local local 'quoted text' readonly "$1" cd sed export then && -eu grep
+	then --verbose "$1" awk test grep | "$@" test ${HOME} done echo 'quoted text' "$1"
+	awk x=1 | 'quoted text' && grep $(pwd) 2>/dev/null "$1"
+		-eu test then -eu awk printf /usr/bin test $(pwd)
+		2>/dev/null then -eu printf local -eu local 'quoted text' "$1" ${HOME} -eu echo
+	"$1" readonly --verbose -eu | x=1 echo --verbose
+		"$1" -eu done readonly printf --verbose readonly sed export
+&& "$1" --verbose cd "$1" 'quoted text' --verbose -eu readonly
+	'quoted text' local /usr/bin readonly 2>/dev/null "$1" cd then then
+	'quoted text' x=1 -eu test local 'quoted text' && 'quoted text' echo sed
+	| done local -eu && --verbose
+"$1" sed $(pwd) /usr/bin | cd grep "$1" --verbose done printf "$1"
+		cd grep ${HOME} 2>/dev/null
+readonly 2>/dev/null grep
+cd sed printf grep ${HOME} x=1 readonly grep test grep
+		&& 2>/dev/null ${HOME} | sed /usr/bin echo $(pwd) 2>/dev/null
+	readonly x=1 readonly then --verbose sed "$@" 2>/dev/null
+echo /usr/bin grep echo ${HOME} test sed
+		then $(pwd) 2>/dev/null | x=1
+		then --verbose test done -eu 2>/dev/null
+		cd | | "$@" cd readonly -eu awk ${HOME}
+readonly printf "$1" printf | readonly && 2>/dev/null "$@"
+		&& | done ${HOME} x=1 | "$1" printf readonly sed 2>/dev/null echo local
+grep printf ${HOME} -eu then then "$@" 'quoted text' /usr/bin $(pwd) awk echo
+"$@" cd /usr/bin $(pwd) && && 2>/dev/null && sed sed cd cd
+	'quoted text' export export sed echo 'quoted text' "$@" local test
+readonly ${HOME} --verbose --verbose then "$1" awk "$1"
+-eu local grep 'quoted text' test awk 'quoted text' ${HOME} awk export
+		local grep 2>/dev/null --verbose export sed
+		local | grep local grep $(pwd) awk 'quoted text'
+		export x=1 test "$@" test /usr/bin | x=1 /usr/bin 2>/dev/null
+"$@" awk done grep local printf /usr/bin readonly readonly
+		cd $(pwd) export cd then printf
+"$@" -eu x=1 | sed done awk ${HOME} ${HOME} $(pwd) export
+		"$1" /usr/bin $(pwd) && ${HOME} -eu 2>/dev/null
+	x=1 sed grep && | then sed cd readonly $(pwd) ${HOME} /usr/bin
+		printf ${HOME} /usr/bin && --verbose awk
+	then export test 2>/dev/null | readonly test $(pwd) local | echo cd grep
+done /usr/bin done 2>/dev/null "$@"
+	| done echo cd done x=1 2>/dev/null
+2>/dev/null export --verbose
+&& && printf 2>/dev/null
+		x=1 sed $(pwd) test export "$@" printf
+		awk cd "$1" -eu sed export ${HOME} printf -eu ${HOME} "$1" echo awk grep |
+awk export -eu done /usr/bin export
+	/usr/bin "$@" done /usr/bin x=1 done x=1 2>/dev/null "$1" | grep
+		sed test export sed export
+'quoted text' && && x=1 "$1" cd --verbose cd echo done && awk ${HOME}
+grep sed awk && grep cd 'quoted text' done then
+	sed x=1 test sed /usr/bin -eu test "$@" local
+cd done "$@" "$@" | $(pwd) test cd readonly "$1" ${HOME} then then | done grep
+		"$1" local ${HOME} $(pwd) $(pwd) test -eu echo 'quoted text' cd x=1 x=1 readonly
+cd cd test export ${HOME} -eu x=1 export done x=1 && done printf
+	grep "$1" readonly echo x=1 printf $(pwd) /usr/bin local /usr/bin
+		'quoted text' ${HOME} done sed
+	printf 'quoted text' x=1 sed $(pwd) --verbose awk 2>/dev/null
+	"$@" sed readonly echo "$1" $(pwd) 2>/dev/null 2>/dev/null /usr/bin
+"$@" 2>/dev/null -eu "$@" local 2>/dev/null awk awk x=1 done export done
+	--verbose local done --verbose && printf $(pwd)
+		'quoted text' --verbose "$1" "$1" && x=1 x=1 'quoted text' done "$1" && -eu /usr/bin
+		2>/dev/null cd 'quoted text' grep --verbose then ${HOME} done && local printf
+"$@" "$1" -eu echo echo then
+	local "$@" test local --verbose awk grep test -eu
+	test /usr/bin -eu export readonly local printf export readonly && export
+	"$@" 'quoted text' "$1" cd /usr/bin test
+		&& --verbose then grep 'quoted text' printf then x=1 printf grep && |
+		/usr/bin printf sed echo readonly awk "$@"
+${HOME} 'quoted text' printf readonly -eu ${HOME} readonly sed
+printf done && ${HOME} test test 'quoted text' "$@" | cd cd
+"$@" /usr/bin 2>/dev/null then then "$@" $(pwd) printf 2>/dev/null
+	printf done $(pwd) done 2>/dev/null
+2>/dev/null 'quoted text' cd
+x=1 grep | test "$1" | /usr/bin export "$@" && echo readonly done cd /usr/bin
+awk "$@" readonly x=1 test echo local --verbose then
+		x=1 local -eu sed 2>/dev/null 'quoted text' "$1"
+--verbose x=1 ${HOME} export echo
+-eu printf readonly 2>/dev/null $(pwd) 2>/dev/null --verbose export && awk $(pwd)
+	&& "$@" awk echo --verbose "$@" test awk ${HOME}
+	2>/dev/null printf ${HOME} readonly -eu local /usr/bin "$@" done "$@" $(pwd) x=1
+2>/dev/null 'quoted text' awk
+	${HOME} 'quoted text' grep "$@" cd x=1 "$@" local "$@" $(pwd) test ${HOME}
+		then local -eu awk ${HOME} 2>/dev/null "$@"
+	${HOME} | $(pwd) "$@" --verbose /usr/bin export /usr/bin $(pwd) grep export
+		"$1" && --verbose ${HOME} printf "$@" test
+		test 'quoted text' | readonly -eu -eu export local
+	'quoted text' then ${HOME} $(pwd) export $(pwd) --verbose readonly
+then ${HOME} -eu readonly grep sed
+	echo then 2>/dev/null /usr/bin awk readonly | printf
+		cd 'quoted text' --verbose export test && then && && done
+		'quoted text' 'quoted text' $(pwd) awk export
+		"$@" "$1" export local -eu export && local
+"$1" echo ${HOME} --verbose printf 'quoted text' 2>/dev/null readonly
+cd "$@" grep grep readonly /usr/bin
+		printf awk readonly readonly 2>/dev/null
+${HOME} && echo ${HOME} 2>/dev/null local $(pwd)
+	2>/dev/null --verbose local /usr/bin && x=1 export $(pwd) &&
+	--verbose export "$@" "$@" 'quoted text'
+	| cd 'quoted text' "$1" "$@" done -eu cd test export local printf local then
+	cd printf test ${HOME} echo grep | export
+		done sed grep local ${HOME} "$1" x=1 local
+		-eu /usr/bin export test grep
+$(pwd) cd sed export $(pwd) 'quoted text' x=1 test "$@" && awk -eu x=1 x=1 echo
+	${HOME} then $(pwd) 2>/dev/null "$@" export cd x=1 echo
+		cd "$1" awk awk export | export ${HOME}
+	&& x=1 --verbose x=1 x=1 ${HOME} x=1 printf then then
+		cd echo 2>/dev/null echo then ${HOME} && --verbose && "$@" /usr/bin
+'quoted text' echo awk x=1 test "$1" local 'quoted text' && then
+	/usr/bin ${HOME} printf -eu -eu grep $(pwd) && local then grep done /usr/bin
+		echo "$@" 'quoted text' 2>/dev/null --verbose grep --verbose echo -eu sed 'quoted text'
+		readonly $(pwd) readonly | printf printf done $(pwd)
+		| local local cd sed ${HOME}
+then awk then 2>/dev/null export sed $(pwd) 2>/dev/null $(pwd)
+		then sed $(pwd) 2>/dev/null 'quoted text' local
+test ${HOME} --verbose
+	| printf echo "$@" --verbose && cd -eu printf | awk "$1" awk "$1"
+done /usr/bin "$1" x=1 && -eu readonly ${HOME} 'quoted text' sed awk "$@"
+		awk x=1 then echo printf test ${HOME}
+		--verbose done sed "$@" "$1" -eu && && | ${HOME}
+| then 2>/dev/null "$@" printf --verbose "$@" sed x=1 2>/dev/null |
+		"$1" local test printf printf $(pwd)
+&& done done "$@" ${HOME} ${HOME} &&
+		| sed sed grep local "$1" "$1" 'quoted text' then && -eu export
+	/usr/bin x=1 2>/dev/null --verbose | x=1 | local x=1 /usr/bin printf ${HOME} /usr/bin
+	$(pwd) export ${HOME} awk "$1" /usr/bin && echo
+		| grep test -eu ${HOME} --verbose
+"$1" local done | done grep
+		/usr/bin x=1 readonly 2>/dev/null cd ${HOME} | grep
+		$(pwd) test /usr/bin then sed local x=1 | done then
+	printf grep 'quoted text' ${HOME} grep then && done local -eu
+		x=1 | && echo /usr/bin 'quoted text' readonly done ${HOME}
+	echo -eu local printf -eu
+then done awk echo ${HOME} --verbose
+	echo cd cd "$1" test 2>/dev/null ${HOME} local | done --verbose awk local export
+2>/dev/null cd "$@" done 'quoted text' | x=1
+done "$@" | done readonly && echo && "$@" --verbose ${HOME}
+		"$@" 2>/dev/null "$@" "$1" -eu test readonly --verbose sed echo
+		awk test grep -eu $(pwd) test readonly
+		"$1" done /usr/bin "$@" readonly
+$(pwd) printf "$1" $(pwd)
+		/usr/bin x=1 echo awk awk test
+		done awk then cd awk echo x=1
+	"$@" "$1" sed test cd
+		printf 'quoted text' ${HOME} cd /usr/bin $(pwd)
+	grep 'quoted text' grep | done x=1 export --verbose echo sed /usr/bin x=1 | 'quoted text'
+"$@" local sed && /usr/bin
+		test 'quoted text' export cd export sed ${HOME}
+	"$1" sed && "$@" $(pwd)
+	export done | readonly echo ${HOME} printf -eu echo
+		'quoted text' echo then
+		'quoted text' cd awk echo sed ${HOME}
+--verbose /usr/bin test -eu awk readonly readonly $(pwd)
+	export 'quoted text' echo grep local grep | | --verbose local /usr/bin
+		export sed sed --verbose
+	x=1 $(pwd) -eu | | "$@" export done
+		/usr/bin -eu export $(pwd) awk printf
+		2>/dev/null done awk 2>/dev/null 'quoted text' cd "$@" --verbose "$@" readonly
+		test x=1 export && | awk 'quoted text'
+		done 'quoted text' grep readonly printf --verbose | printf "$@" local
+	/usr/bin -eu local done "$@" ${HOME} cd "$1" $(pwd) then done | done
+	--verbose printf export $(pwd)
+	test $(pwd) "$@" -eu cd grep && grep --verbose
+		awk --verbose $(pwd) printf grep readonly ${HOME}
+x=1 test done | done export "$@" test "$1"
+--verbose | readonly sed 2>/dev/null printf awk ${HOME} done x=1 local
+done sed $(pwd) "$1" "$1" readonly
+'quoted text' readonly sed readonly "$1" export
+	export test --verbose printf 'quoted text' then --verbose
+	2>/dev/null "$@" $(pwd) /usr/bin local $(pwd) sed
+$(pwd) | -eu cd sed ${HOME} sed
+	| printf 'quoted text' -eu then cd ${HOME} /usr/bin 'quoted text' then
+	awk cd readonly cd --verbose then
+		x=1 --verbose done 'quoted text' sed $(pwd) --verbose -eu 2>/dev/null
+	then "$1" printf && done -eu printf $(pwd) "$1" ${HOME} x=1 readonly
+		2>/dev/null x=1 grep export ${HOME} done printf
+		$(pwd) 2>/dev/null grep
+	cd grep export cd /usr/bin "$1" -eu cd
+		| 2>/dev/null cd awk printf "$@" sed grep | "$@" grep && test sed
+		${HOME} ${HOME} grep | then printf sed
+		-eu "$1" echo cd then sed --verbose grep 'quoted text' -eu "$1"
+	printf sed echo --verbose && echo "$1" echo printf
+	grep cd "$1" printf echo sed grep
+--verbose 'quoted text'
+	test "$1" then test export "$@" --verbose done readonly ${HOME} "$@" | 2>/dev/null
+	$(pwd) 2>/dev/null /usr/bin $(pwd) $(pwd) grep |
+	2>/dev/null "$1" test local cd x=1 'quoted text' $(pwd) awk local ${HOME} awk
+	-eu 'quoted text' echo /usr/bin awk
+	readonly 'quoted text' $(pwd) 'quoted text'
+		then 'quoted text' ${HOME} done ${HOME} local then cd cd "$1" export
+	sed 'quoted text' "$1" echo && test x=1 cd awk
+awk echo echo readonly /usr/bin grep
+test awk export grep $(pwd) local 'quoted text' x=1 awk ${HOME} -eu 'quoted text'
+		| awk printf export x=1 cd | -eu grep x=1 printf
+echo /usr/bin grep awk --verbose local -eu then
+		${HOME} test x=1 test $(pwd) "$1" --verbose
+${HOME} printf --verbose local ${HOME} "$@" test then
+	'quoted text' "$@" --verbose
+then cd 2>/dev/null "$1" --verbose printf export $(pwd) sed x=1
+	cd ${HOME} local export awk printf then printf
+--verbose && printf "$1" readonly /usr/bin grep
+		then echo x=1 "$@" ${HOME} cd
+	grep "$1" --verbose done "$1"
+		cd grep export --verbose printf ${HOME} done -eu -eu echo 2>/dev/null then
+echo awk then 2>/dev/null x=1 'quoted text'
+	--verbose 2>/dev/null "$@" && | echo then
+	then cd $(pwd) grep 2>/dev/null
+readonly then echo readonly | --verbose printf export 'quoted text' readonly
+	/usr/bin then 2>/dev/null 'quoted text' done "$@" x=1 | ${HOME} local 2>/dev/null
+"$1" --verbose -eu sed cd sed
+		-eu "$1" grep x=1 grep && | -eu
+&& "$@" x=1 done readonly --verbose
+		"$@" done echo cd x=1 printf ${HOME} x=1 printf x=1 readonly /usr/bin echo printf
+$(pwd) && x=1 "$@" "$@" 2>/dev/null
+	--verbose && done "$1" x=1 done "$1" printf export echo "$1" awk readonly
+	test done grep -eu "$1" readonly grep x=1 'quoted text' test export ${HOME} echo
+		grep printf ${HOME} 'quoted text' awk $(pwd) 2>/dev/null then 'quoted text'
+		x=1 --verbose -eu local
+	$(pwd) /usr/bin export sed awk local x=1 test 2>/dev/null x=1 -eu then
+		awk then "$@" sed && $(pwd) then
+local -eu then export $(pwd) done done
+	"$@" /usr/bin --verbose printf printf $(pwd) ${HOME} done -eu 2>/dev/null
+	then ${HOME} ${HOME} -eu awk readonly
+then && ${HOME} 2>/dev/null cd /usr/bin grep local
+"$@" x=1 awk "$1" --verbose -eu sed
+		$(pwd) done sed echo ${HOME} x=1 --verbose sed then -eu printf grep echo
+		sed 'quoted text' printf export
+grep "$@" readonly x=1
+	/usr/bin export test printf export -eu awk "$@" sed cd cd "$@" "$1"
+	printf 2>/dev/null local | test test grep cd && readonly
+awk ${HOME} /usr/bin ${HOME} && 'quoted text' export cd
+		grep printf /usr/bin 'quoted text' test $(pwd) readonly test echo
+	/usr/bin "$@" awk | && x=1 test $(pwd)
+		awk done ${HOME} 2>/dev/null | "$@" readonly printf cd --verbose && done "$@"
+$(pwd) done && done | echo $(pwd) ${HOME}
+--verbose /usr/bin awk readonly local readonly "$@"
+		'quoted text' | "$@" readonly /usr/bin then then grep
+/usr/bin awk readonly
+	echo x=1 /usr/bin | cd local grep -eu --verbose | then then readonly
+test printf $(pwd) 2>/dev/null
+		printf then local then then test local "$@" 2>/dev/null awk
+		2>/dev/null readonly readonly then
+cd 2>/dev/null export cd "$@" local readonly $(pwd) then
+		echo awk export --verbose x=1 ${HOME} sed | && 'quoted text' &&
+	"$1" test grep sed readonly cd export x=1 $(pwd) grep cd ${HOME}
+x=1 /usr/bin sed && 'quoted text' printf awk printf | grep ${HOME} done $(pwd)
+	--verbose then cd x=1 x=1 local printf echo 'quoted text' 2>/dev/null
+		--verbose && /usr/bin 'quoted text' echo test 2>/dev/null export local
+		--verbose sed 'quoted text' awk test --verbose $(pwd) cd "$1" x=1 "$@" $(pwd)
+	&& 2>/dev/null $(pwd) "$1" $(pwd) 2>/dev/null
+		"$1" echo /usr/bin -eu done
+--verbose --verbose 2>/dev/null ${HOME} ${HOME} && && ${HOME} export
+sed x=1 test printf | test export | local grep local cd | x=1
+--verbose awk printf printf cd 'quoted text' 2>/dev/null 2>/dev/null sed
+	sed "$@" && done awk $(pwd) "$@" readonly awk
+readonly grep done x=1 x=1 echo export then -eu printf --verbose local "$@" &&
+	cd -eu printf 2>/dev/null sed &&
+awk && "$1" $(pwd) awk printf done 'quoted text' "$1" 2>/dev/null grep readonly
+	'quoted text' readonly "$1" test echo local awk test sed done $(pwd) readonly
+		cd echo echo grep $(pwd) | "$1" then x=1 then -eu done grep test then readonly cd
+"$@" then printf -eu done
+	local cd export then "$@" && ${HOME} awk then printf sed
+		grep grep grep cd done local | export 'quoted text' readonly 'quoted text' sed test
+		--verbose ${HOME} test export done done 2>/dev/null echo 2>/dev/null
+	grep && grep && x=1 $(pwd) echo
+	| ${HOME} export then $(pwd)
+${HOME} /usr/bin ${HOME} cd /usr/bin then /usr/bin cd grep ${HOME} /usr/bin
+'quoted text' && && readonly awk && "$@" printf sed ${HOME}
+&& awk --verbose "$1" export --verbose test printf "$@" && export -eu printf
+	2>/dev/null then -eu --verbose
+-eu $(pwd) 2>/dev/null local test &&
+		local done x=1 cd "$@" 'quoted text' test 2>/dev/null
+&& && echo done cd sed
+		local | x=1 -eu test 'quoted text' 2>/dev/null
+readonly readonly x=1 awk $(pwd) -eu local export /usr/bin local
+	echo done printf sed readonly
+	$(pwd) ${HOME} x=1 x=1 echo /usr/bin
+		${HOME} $(pwd) /usr/bin --verbose && test
+	local x=1 readonly done grep /usr/bin -eu /usr/bin
+echo && -eu 2>/dev/null && sed && test --verbose "$1" readonly
+		local "$@" cd "$1" cd echo done printf "$1" sed export printf --verbose
+done done /usr/bin export x=1 -eu --verbose cd local 2>/dev/null
+		awk then printf "$1" | sed -eu | x=1 echo -eu
+then echo /usr/bin grep export readonly awk 2>/dev/null ${HOME} $(pwd)
+	${HOME} ${HOME} export x=1 /usr/bin done
+		| && && readonly $(pwd) x=1 local sed --verbose sed
+	echo then sed grep readonly /usr/bin echo $(pwd) printf "$1" /usr/bin
+	local then /usr/bin then
+	test awk "$1" "$1" export 'quoted text' cd awk readonly local export x=1
+	done "$@" done echo printf --verbose -eu done echo sed 'quoted text'
+grep 2>/dev/null printf
+		| "$@" "$1" 'quoted text'
+--verbose cd awk ${HOME} sed
+	awk cd printf then then ${HOME} 2>/dev/null
+	cd 2>/dev/null -eu local -eu /usr/bin grep --verbose
+	/usr/bin | sed echo && --verbose done
+		printf done x=1 cd echo && "$1" local 'quoted text' grep "$@" export &&
+cd local test "$1" 'quoted text' then --verbose
+		-eu test x=1 x=1 echo printf --verbose
+	-eu "$1" sed test echo 'quoted text'
+		${HOME} /usr/bin "$1" export
+then /usr/bin -eu 2>/dev/null ${HOME}
+${HOME} x=1 -eu "$1" "$1" test sed sed --verbose
+		then readonly "$@" test readonly grep grep --verbose test $(pwd) echo done ${HOME}
+printf sed grep cd done | "$@" done 'quoted text' "$@"
+	2>/dev/null local readonly awk
+awk readonly then local printf 'quoted text' grep ${HOME} awk | "$@" "$@" |
+&& /usr/bin 'quoted text' ${HOME} cd
+		done && "$1" --verbose grep
+	then "$1" printf | 2>/dev/null
+then awk --verbose -eu x=1 $(pwd) && test sed && then 2>/dev/null
+readonly echo && 2>/dev/null --verbose --verbose printf ${HOME}
+		&& echo /usr/bin x=1 --verbose test && 2>/dev/null "$1" awk then then
+'quoted text' 'quoted text' --verbose "$1" x=1 local -eu
+		printf /usr/bin ${HOME} "$1" ${HOME} -eu
+		"$@" then done /usr/bin done
+	-eu && /usr/bin readonly
+	| --verbose then awk then --verbose then x=1 --verbose ${HOME} readonly awk done
+		"$1" $(pwd) printf /usr/bin -eu cd x=1 then x=1 $(pwd) |
+then awk export x=1 -eu
+		grep cd export done "$1" && x=1 done "$@" awk grep
+readonly "$@" echo x=1 test && -eu cd x=1 sed done ${HOME} then
+		${HOME} "$@" "$1" echo grep --verbose
+	cd && /usr/bin grep "$@" local
+'quoted text' --verbose local && export x=1 $(pwd) cd "$@"
+	readonly grep cd -eu sed --verbose awk "$@" ${HOME} 2>/dev/null
+2>/dev/null "$1" local sed | /usr/bin
+	grep "$@" "$@" $(pwd) done /usr/bin -eu "$1" /usr/bin | "$@" export
+	| ${HOME} printf --verbose echo
+then export local awk
+		local && /usr/bin printf | then sed grep printf local "$1" 2>/dev/null printf
+	&& test cd test $(pwd) && cd export readonly done cd local
+	printf readonly printf test 2>/dev/null awk | done --verbose readonly
+		sed sed x=1 echo printf echo test
+	-eu sed --verbose /usr/bin grep echo awk
+then "$1" test -eu 2>/dev/null sed export ${HOME} awk 2>/dev/null printf $(pwd)
+	done 'quoted text' readonly "$@" then cd "$1" grep
+	test grep "$@" sed test -eu 'quoted text'
+	-eu "$1" x=1 done printf echo x=1 local cd x=1 ${HOME} 'quoted text' echo /usr/bin
+		local 2>/dev/null "$1" grep /usr/bin $(pwd)
+		-eu | done && x=1 printf done | 'quoted text' awk "$@"
+	x=1 --verbose done cd readonly sed --verbose
+| | && && export readonly grep then "$@" then grep cd
+	readonly --verbose ${HOME} 2>/dev/null grep
+	then sed done then local cd ${HOME} local
+	grep 2>/dev/null readonly && then sed local grep cd && "$1" ${HOME} awk
+grep readonly 'quoted text' ${HOME} "$@" readonly readonly "$1" $(pwd) export
+	then test awk sed done then --verbose x=1 ${HOME} grep test printf
+		readonly 'quoted text' local "$@" local local ${HOME} -eu | "$1" readonly cd
+		done local export local ${HOME} export
+awk awk echo /usr/bin local /usr/bin /usr/bin $(pwd)
+		$(pwd) 2>/dev/null sed readonly && x=1 awk grep echo readonly local
+		readonly cd readonly export "$@" readonly x=1 2>/dev/null
+		local sed 'quoted text' then -eu /usr/bin readonly test $(pwd) printf ${HOME}
+		awk $(pwd) /usr/bin $(pwd) printf
+	then readonly grep test sed -eu awk "$@" /usr/bin 2>/dev/null
+		cd 'quoted text' cd | local then $(pwd)
+		printf --verbose then sed 'quoted text' test
+		awk local && /usr/bin "$@"
+		--verbose local && awk test then echo 2>/dev/null then x=1
+		'quoted text' 'quoted text' cd printf 2>/dev/null
+	local grep printf | && test --verbose
+		test 2>/dev/null test grep
+"$@" "$1" 2>/dev/null export "$1"
+		awk $(pwd) x=1 grep | --verbose export ${HOME} sed then readonly
+	echo awk printf "$1" | awk ${HOME} readonly 'quoted text'
+	awk cd echo test readonly "$@" readonly test $(pwd) | then x=1 local -eu
+--verbose cd /usr/bin 2>/dev/null done ${HOME} cd 2>/dev/null ${HOME}
+	then grep export x=1 then sed done local
+		local /usr/bin printf 'quoted text'
+grep x=1 x=1 awk sed --verbose
+		export 2>/dev/null printf "$1" grep $(pwd) echo
+		echo 2>/dev/null $(pwd) cd printf "$@" done
+		${HOME} 2>/dev/null cd readonly awk "$@" cd | awk awk printf -eu ${HOME}
+then export test $(pwd) cd
+&& | $(pwd) 2>/dev/null "$@" awk test test $(pwd)
+		cd "$@" "$1" sed echo "$1" $(pwd) export readonly
+x=1 grep 2>/dev/null x=1 export ${HOME} awk sed $(pwd) cd printf printf
+$(pwd) echo printf && $(pwd) 2>/dev/null
+	test awk local awk sed /usr/bin export readonly
+		sed | 2>/dev/null $(pwd) && ${HOME} /usr/bin done done /usr/bin "$@" $(pwd)
+		printf && | grep then "$@" | test echo printf done done
+		awk export echo then && export printf then | /usr/bin /usr/bin done "$1"
+		awk test export echo printf then local && echo
+		2>/dev/null "$1" --verbose
+		--verbose | 'quoted text'
+printf readonly local /usr/bin printf && "$@" cd ${HOME} awk -eu printf
+		printf ${HOME} then && grep --verbose x=1 && 'quoted text'
+		cd done local 2>/dev/null local -eu sed awk
+	awk test $(pwd) done printf | then readonly
+		cd 2>/dev/null /usr/bin --verbose local --verbose $(pwd) echo local readonly grep
+&& x=1 $(pwd) $(pwd) echo "$1" 'quoted text'
+-eu echo cd awk && echo /usr/bin awk awk sed echo awk && local
+&& && printf export export sed awk printf | | awk
+${HOME} 'quoted text' cd 'quoted text' echo sed $(pwd) then
+	then x=1 $(pwd) 2>/dev/null echo --verbose sed
+	printf 2>/dev/null readonly
+	&& "$@" done "$1" | test echo readonly
+	printf $(pwd) --verbose 'quoted text' export then "$1" ${HOME}
+export readonly local local 'quoted text' /usr/bin && awk /usr/bin done
+		"$1" $(pwd) done --verbose test --verbose
+		grep "$@" && test test
+		/usr/bin "$1" "$1" awk echo -eu echo | && 'quoted text' grep local
+		echo grep /usr/bin --verbose -eu "$@" done local test --verbose echo 'quoted text'
+	| ${HOME} export $(pwd) sed printf | 2>/dev/null done "$1" --verbose cd -eu
+	readonly awk x=1 -eu cd done /usr/bin readonly export 2>/dev/null readonly readonly
+'quoted text' sed | export sed --verbose
+--verbose $(pwd) echo | |
+export readonly done "$1" echo "$1" "$1" "$@" --verbose awk
+grep 2>/dev/null | grep printf done test then --verbose
+	echo 2>/dev/null /usr/bin sed "$1" 'quoted text' echo printf ${HOME} then
+		x=1 export cd then $(pwd) && 'quoted text' then /usr/bin
+		&& export 'quoted text' ${HOME} -eu printf 2>/dev/null
+	--verbose grep echo awk sed x=1 'quoted text'
+		2>/dev/null -eu test 'quoted text' "$@" "$1" x=1 readonly
+		done 2>/dev/null "$@" cd
+	cd && "$@" awk "$1" x=1 local readonly "$@" printf grep x=1 local --verbose
+	"$@" /usr/bin awk then local cd 2>/dev/null
+	&& ${HOME} sed 'quoted text' then "$1" done then "$@" 2>/dev/null
+awk /usr/bin /usr/bin | ${HOME} x=1 "$@" local then --verbose | | then
+		| /usr/bin | 'quoted text' done 'quoted text' readonly
+		"$1" --verbose 'quoted text'
+		| grep x=1 && 'quoted text' "$1" readonly -eu -eu cd -eu $(pwd) 2>/dev/null ${HOME}
+		2>/dev/null ${HOME} ${HOME} export then sed 2>/dev/null && grep cd "$@"
+		| cd cd printf then readonly
+sed then x=1 /usr/bin ${HOME} echo
+	"$1" test ${HOME} grep sed test export | local readonly x=1
+	&& echo export grep | $(pwd) readonly "$@"
+'quoted text' echo | test grep
+		$(pwd) awk 2>/dev/null readonly grep --verbose grep | -eu awk x=1
+	"$@" cd /usr/bin grep && 2>/dev/null && "$1" printf
+export ${HOME} echo | --verbose && | grep | /usr/bin grep 'quoted text' ${HOME}
+		export $(pwd) export "$1" export readonly
+grep done then $(pwd) cd && ${HOME} "$1"
+${HOME} 2>/dev/null 2>/dev/null cd | echo sed readonly
+	export cd x=1 ${HOME} done | x=1 /usr/bin cd awk "$@"
+		grep "$@" --verbose ${HOME}
+		x=1 echo local "$1" && 2>/dev/null --verbose export
+		"$@" awk && awk done grep awk test 2>/dev/null test "$@" "$@"
+	/usr/bin $(pwd) $(pwd) 2>/dev/null cd | -eu test echo -eu
+		export printf cd printf grep echo --verbose
+	$(pwd) grep export | export $(pwd) /usr/bin printf $(pwd) /usr/bin /usr/bin
+	local 2>/dev/null x=1 grep x=1 done -eu awk test echo --verbose
+		2>/dev/null export export
+cd cd "$1" | echo cd echo echo printf x=1
+cd "$@" ${HOME} "$1" test readonly then 'quoted text' export | -eu --verbose
+${HOME} $(pwd) then test readonly "$@" local 2>/dev/null 'quoted text'
+x=1 2>/dev/null printf awk done sed $(pwd) printf
+		local awk readonly 2>/dev/null test readonly "$@" x=1
+	| done test cd then | grep awk /usr/bin awk printf local && "$@" --verbose
+$(pwd) "$1" printf /usr/bin | && --verbose -eu "$1" cd grep 'quoted text'
+	-eu /usr/bin 2>/dev/null echo
+		grep 'quoted text' | local awk x=1 echo x=1 && export ${HOME} grep echo -eu cd
+"$1" grep export 2>/dev/null "$1"
+	done ${HOME} ${HOME} cd 'quoted text' x=1
+readonly awk done $(pwd) local "$1" printf --verbose "$1" printf test cd
+		local ${HOME} --verbose "$1" printf test && done then
+	awk cd local 'quoted text' | 'quoted text'
+		readonly test echo test -eu --verbose $(pwd) ${HOME} echo
+	then "$1" "$1" "$@" sed && && ${HOME} sed 2>/dev/null printf x=1
+	${HOME} local /usr/bin /usr/bin
+	echo done then printf $(pwd)
+	"$1" "$1" sed x=1 printf printf
+		then "$@" test then "$@" sed x=1 "$1" printf local
+	local && "$@" cd grep $(pwd) -eu ${HOME} sed "$@" 2>/dev/null
+awk x=1 "$@" 'quoted text'
+		x=1 then then "$@" readonly /usr/bin "$@" export grep local "$1"
+local x=1 "$@" test | export
+test --verbose echo ${HOME} x=1 readonly 2>/dev/null
+		export cd local x=1 ${HOME} export
+	echo /usr/bin local /usr/bin /usr/bin printf cd echo -eu readonly ${HOME}
+	then 'quoted text' test "$1" local 'quoted text' grep "$@"
+| x=1 -eu | /usr/bin local then grep readonly /usr/bin then test
+	&& printf done && | 'quoted text' ${HOME} test -eu --verbose
+--verbose ${HOME} readonly $(pwd) echo sed -eu local test local /usr/bin
+		then && readonly awk echo /usr/bin "$1" 2>/dev/null --verbose export done
+export awk echo local awk "$@" grep printf 2>/dev/null done "$1"
+		done echo done /usr/bin 'quoted text' test "$1"
+	readonly grep then | awk
+	"$@" && done "$@" -eu x=1 grep
+	'quoted text' printf -eu --verbose
+		then cd readonly sed && "$1" export 'quoted text'
+| | -eu --verbose printf "$@" then local 'quoted text'
+	then local readonly grep /usr/bin local | export printf cd /usr/bin 2>/dev/null
+| "$1" $(pwd) echo /usr/bin sed
+	/usr/bin test $(pwd) sed -eu $(pwd) |
+test $(pwd) $(pwd) --verbose "$1" "$@" sed printf local "$@" $(pwd) 2>/dev/null
+		"$@" grep done then test printf
+| /usr/bin cd export "$1" printf test -eu sed test then | test test done
+	local local -eu /usr/bin "$1" ${HOME} readonly -eu | -eu
+'quoted text' echo x=1 done
+readonly 2>/dev/null local && "$@" --verbose then done test && test | -eu grep
+	printf 'quoted text' echo && /usr/bin && | 'quoted text' ${HOME}
+		&& cd | $(pwd) 'quoted text' "$1" 'quoted text' "$1"
+done readonly printf export 'quoted text' -eu "$@"
+then echo --verbose echo cd local
+		2>/dev/null x=1 sed "$1" --verbose
+		'quoted text' $(pwd) echo && awk cd cd export $(pwd)
+&& cd "$@" grep /usr/bin
+"$@" ${HOME} done 2>/dev/null | $(pwd)
+&& readonly readonly done readonly | --verbose then 'quoted text'
+${HOME} -eu done printf done then $(pwd) $(pwd) | "$1" /usr/bin --verbose
+	| then grep sed then $(pwd) | "$@"
+		--verbose -eu export echo echo
+--verbose 2>/dev/null
+export "$@" local grep "$@" x=1 then
+&& 2>/dev/null "$1" ${HOME} local $(pwd)
+	done readonly | printf export
+	--verbose sed awk local /usr/bin echo | ${HOME}
+	${HOME} export readonly
+	grep | --verbose grep -eu x=1 cd printf done
+	-eu /usr/bin awk local
+		local awk export ${HOME} 'quoted text' printf "$1" awk x=1
+test /usr/bin done export local ${HOME} 2>/dev/null
+		printf local then local 2>/dev/null test x=1 export awk "$1" /usr/bin
+	echo "$@" readonly --verbose
+then test readonly ${HOME} cd local $(pwd) local | test
+		"$1" test printf export | --verbose |
+sed -eu 2>/dev/null cd 'quoted text' x=1 cd then
+		&& $(pwd) -eu /usr/bin export awk 'quoted text' && "$@" printf sed awk | -eu
+awk then sed done --verbose x=1 $(pwd) "$1" cd ${HOME}
+| export awk printf x=1 && printf echo 2>/dev/null readonly awk
+		awk echo $(pwd) readonly test "$1" grep awk printf printf
+		'quoted text' cd $(pwd) "$@" -eu $(pwd) -eu export cd $(pwd) done readonly then
+$(pwd) local | 2>/dev/null sed 2>/dev/null -eu echo test "$@" printf
+&& grep | | export --verbose printf
+	test $(pwd) 2>/dev/null done printf --verbose | -eu echo readonly
+	"$@" export sed 2>/dev/null x=1 sed grep then done sed cd local -eu then "$@" sed
+		x=1 ${HOME} "$@" ${HOME} test && echo then
+	$(pwd) && ${HOME} done "$@" &&
+sed then export ${HOME}
+sed "$1" 2>/dev/null test && | awk done -eu "$1" test x=1
+	awk x=1 --verbose printf $(pwd) ${HOME} | done $(pwd) awk then
+	$(pwd) readonly sed -eu "$1" readonly --verbose test done 2>/dev/null
+	"$@" printf 2>/dev/null -eu $(pwd) --verbose -eu
+		"$@" sed awk --verbose | printf $(pwd)
+	sed x=1 && awk x=1 local local
+	| --verbose export grep "$@" export
+readonly x=1 --verbose
+	export | "$@" sed readonly echo done export && cd grep $(pwd)
+"$@" /usr/bin echo x=1 awk readonly x=1 --verbose done $(pwd)
+		printf 'quoted text' awk printf --verbose cd
+		cd export then grep && export local readonly && -eu 2>/dev/null -eu -eu 'quoted text'
+"$1" grep export $(pwd) cd 'quoted text' $(pwd) -eu $(pwd) sed /usr/bin
+	awk ${HOME} printf "$1" "$@" "$@" | grep 'quoted text' 'quoted text'
+	grep test then --verbose -eu local -eu done then | 'quoted text'
+done export export --verbose "$@" --verbose -eu sed $(pwd)
+	then -eu echo -eu "$1" "$1" && "$1" && 2>/dev/null echo done
+		x=1 printf then grep 'quoted text' /usr/bin | 'quoted text'
+	--verbose /usr/bin awk test grep | echo -eu 2>/dev/null && 'quoted text'
+sed -eu /usr/bin --verbose 2>/dev/null ${HOME}
+export -eu /usr/bin -eu $(pwd) cd done -eu echo local
+		${HOME} readonly sed awk 2>/dev/null 'quoted text' $(pwd) $(pwd) test printf
+	&& 2>/dev/null ${HOME}
+cd test -eu grep -eu -eu /usr/bin awk $(pwd) "$1" /usr/bin readonly export
+		export -eu cd "$@" 2>/dev/null printf local sed readonly | readonly test && $(pwd)
+	grep test readonly echo && readonly
+	&& then grep awk $(pwd) readonly awk 'quoted text' printf
+		-eu cd --verbose 'quoted text' -eu awk "$1" -eu 'quoted text' /usr/bin sed
+		grep echo echo 'quoted text' grep "$1" /usr/bin sed done printf done /usr/bin
+		'quoted text' export then --verbose
+		readonly "$1" cd printf "$1" grep
+'quoted text' "$1" export
+--verbose export cd export grep ${HOME} "$@" done --verbose
+		/usr/bin echo --verbose $(pwd)
+$(pwd) && 'quoted text' 'quoted text' grep echo /usr/bin
+	'quoted text' readonly -eu grep
+	${HOME} export export echo 'quoted text' then "$@" $(pwd)
+	| local local export $(pwd) ${HOME} test
+		${HOME} "$@" --verbose 2>/dev/null
+	/usr/bin $(pwd) && ${HOME} 2>/dev/null 'quoted text' 2>/dev/null test cd "$@" printf
+		then sed printf "$1" "$@" $(pwd)
+	local 2>/dev/null | sed --verbose | | then "$1" /usr/bin
+--verbose ${HOME} $(pwd) export test readonly 2>/dev/null --verbose readonly
+	local printf echo local ${HOME} cd
+awk then awk awk awk --verbose -eu then awk && 'quoted text'
+		"$@" /usr/bin --verbose -eu done $(pwd)
+		/usr/bin && local "$@" &&
+		then ${HOME} $(pwd) then done -eu sed awk 'quoted text' readonly "$@" cd /usr/bin
+x=1 && /usr/bin $(pwd) printf cd -eu grep "$@" -eu local $(pwd) -eu awk printf export
+	then done 2>/dev/null --verbose | printf awk /usr/bin local $(pwd)
+		$(pwd) /usr/bin grep readonly done --verbose then 'quoted text'
+	grep | done printf /usr/bin sed && cd
+		done "$@" 'quoted text' ${HOME} local then && $(pwd)
+		x=1 awk done echo && printf
+		$(pwd) | /usr/bin "$@" x=1
+	local awk --verbose echo
+		&& sed --verbose "$@" echo printf /usr/bin /usr/bin --verbose /usr/bin $(pwd)
+	| && done 'quoted text' && 'quoted text' /usr/bin 2>/dev/null $(pwd) "$1"
+-eu --verbose local $(pwd)
+		"$@" cd test | ${HOME} test test grep
+	&& | 2>/dev/null && export
+	-eu $(pwd) 2>/dev/null --verbose cd && readonly test done x=1 readonly | 2>/dev/null
+readonly && test /usr/bin echo x=1
+		'quoted text' test readonly | && test sed | then --verbose
+	readonly ${HOME} "$1" -eu /usr/bin
+	-eu sed local "$@" sed | -eu $(pwd) export "$@" x=1 x=1
+		echo sed | echo then $(pwd)
+	x=1 sed && echo awk readonly printf awk readonly "$1" cd sed readonly $(pwd)
+		'quoted text' cd printf export test
+	done echo 'quoted text' sed $(pwd) x=1 ${HOME} grep then && sed echo --verbose
+	test export then x=1 sed local "$@" $(pwd) 'quoted text' readonly "$@"
+test done ${HOME} ${HOME} export echo
+	-eu "$@" printf 2>/dev/null
+		"$@" 'quoted text' local $(pwd) then
+		2>/dev/null then printf
+		/usr/bin && local $(pwd) cd ${HOME} cd sed then sed then 'quoted text'
+	done ${HOME} "$1" done local 'quoted text' $(pwd) "$@" 2>/dev/null $(pwd) awk
+echo /usr/bin grep 2>/dev/null cd local $(pwd) grep export
+--verbose 'quoted text' test test /usr/bin && readonly "$1" 2>/dev/null grep
+	2>/dev/null test sed done 'quoted text' 2>/dev/null awk --verbose cd then
+		done /usr/bin $(pwd) sed | --verbose sed $(pwd) "$1" cd
+	2>/dev/null "$@" x=1 /usr/bin cd done printf 'quoted text'
+$(pwd) local cd "$1" $(pwd) -eu "$1" local | then echo /usr/bin
+		| 'quoted text' grep /usr/bin $(pwd) | cd /usr/bin echo /usr/bin test export
+"$@" cd cd $(pwd) done echo cd export export -eu test /usr/bin
+	grep x=1 $(pwd) && "$1" export -eu x=1 then awk -eu | done then echo local
+grep x=1 export /usr/bin $(pwd) | | "$@"
+		x=1 "$@" "$1" done grep then 'quoted text'
+echo x=1 'quoted text' printf local then awk $(pwd) 'quoted text' 'quoted text'
+&& then | readonly sed "$1" then grep done
+	done printf local -eu "$1" "$@" $(pwd) echo test -eu cd && cd awk awk awk grep
+	grep local "$1" -eu /usr/bin | done grep then cd grep
+| "$1" "$@" test cd "$1" 'quoted text' 'quoted text' echo printf
+'quoted text' printf $(pwd) | ${HOME} 'quoted text'
+	${HOME} ${HOME} readonly 'quoted text'
+	cd 2>/dev/null 'quoted text' export echo local ${HOME} 'quoted text'
+${HOME} then --verbose x=1 local cd | | x=1 | done ${HOME} | grep 2>/dev/null
+${HOME} printf 2>/dev/null "$1" grep -eu readonly printf
+		export && echo 2>/dev/null echo sed grep test && --verbose --verbose
+	sed printf readonly /usr/bin test printf
+--verbose x=1 ${HOME} grep 'quoted text'
+	2>/dev/null done ${HOME} --verbose awk $(pwd) && "$@" done /usr/bin readonly
+		done printf test "$@" "$@" && | --verbose test ${HOME} 2>/dev/null test awk readonly
+${HOME} "$1" done x=1 printf
+		done 'quoted text' sed export 'quoted text' ${HOME} | "$@" echo local export
+	"$@" -eu && test sed done readonly awk /usr/bin awk
+	-eu /usr/bin local && --verbose readonly done echo
+	done local ${HOME} "$1" /usr/bin --verbose ${HOME} /usr/bin
+export sed --verbose echo sed grep local
+	then local done printf
+grep awk x=1 then done "$1" && grep sed | $(pwd) export then done
+	echo && awk export local sed --verbose echo 'quoted text'
+	2>/dev/null /usr/bin x=1 export
+/usr/bin ${HOME} test done /usr/bin ${HOME} grep "$1" sed export export
+--verbose /usr/bin x=1 done && -eu $(pwd) sed 'quoted text'
+grep awk | awk ${HOME} | | -eu "$1" awk then
+test x=1 then | x=1 'quoted text'
+echo export grep readonly
+	printf export ${HOME} x=1 x=1 /usr/bin $(pwd)
+x=1 -eu export "$@" echo echo
+	$(pwd) && done -eu sed /usr/bin
+	echo 2>/dev/null printf 2>/dev/null sed && then $(pwd) "$1"
+	readonly export "$1" | export readonly -eu
+	export -eu printf printf
+	awk x=1 -eu -eu "$@" echo echo grep sed 2>/dev/null local
+"$1" local "$@" test grep "$1" grep test -eu "$1" then
+	awk /usr/bin sed $(pwd) ${HOME} then | 'quoted text'
+		echo printf --verbose then "$1" $(pwd) sed cd then x=1 /usr/bin "$1" export
+2>/dev/null then cd then done echo 2>/dev/null $(pwd)
+$(pwd) sed awk ${HOME} sed readonly echo
+	then "$1" local 2>/dev/null
+--verbose done | 'quoted text' done /usr/bin x=1
+	done --verbose "$1" test --verbose /usr/bin $(pwd) printf x=1 2>/dev/null sed
+"$@" sed test sed awk /usr/bin
+export "$@" done "$1" | then 'quoted text'
+		2>/dev/null --verbose readonly cd export 'quoted text' echo
+	"$1" --verbose | export cd -eu --verbose readonly grep "$1"
+		readonly local cd x=1 grep 'quoted text' awk "$1" --verbose && --verbose
+	| cd ${HOME} 2>/dev/null /usr/bin
+		export && "$1" ${HOME} cd 2>/dev/null 2>/dev/null ${HOME}
+local "$@" -eu -eu done "$1" sed grep export cd 2>/dev/null && then awk "$@"
+		| sed echo readonly then && $(pwd) sed readonly
+x=1 export awk 2>/dev/null sed 'quoted text' -eu --verbose
+/usr/bin && cd local grep $(pwd) | awk
+done export awk "$@" /usr/bin ${HOME} test local
+done && echo 2>/dev/null
+		| local "$@" "$1" export 2>/dev/null
+		-eu echo x=1 && grep readonly
+	export done sed && --verbose awk echo awk sed -eu printf export
+	&& then x=1 printf local test then -eu
+	| echo local $(pwd) "$@" $(pwd) && local --verbose
+		readonly then echo --verbose readonly "$1" && /usr/bin
+	export -eu test awk sed 'quoted text' /usr/bin "$@" echo $(pwd)
+	export then done /usr/bin x=1 echo cd $(pwd) "$1" then "$@"
+test "$@" test awk x=1 && "$@" ${HOME} grep /usr/bin printf "$1"
+test $(pwd) awk "$1" then done -eu then
+readonly x=1 ${HOME} grep echo /usr/bin
+	grep && "$1" -eu "$@" $(pwd) then local printf echo -eu
+done awk && printf test $(pwd) 'quoted text' && --verbose grep readonly
+		cd then awk --verbose | done x=1 -eu cd printf /usr/bin awk /usr/bin
+	$(pwd) awk then done 'quoted text'
+		sed done 'quoted text' export ${HOME} x=1 'quoted text' local 'quoted text'
+		--verbose then grep -eu -eu "$1" x=1 cd
+		'quoted text' 'quoted text' test --verbose $(pwd)
+		grep --verbose test --verbose readonly export "$1" awk | sed export
+2>/dev/null "$@" --verbose printf printf "$1" cd
+	done export test --verbose 2>/dev/null grep then "$1" export
+	| "$1" x=1 test cd local | "$1"
+	$(pwd) readonly "$1" then local 2>/dev/null | "$@" done /usr/bin grep -eu readonly
+		local echo $(pwd) "$1" readonly printf local echo $(pwd) "$@" readonly "$1"
+	/usr/bin echo export sed -eu readonly export test grep --verbose ${HOME} "$1" then
+/usr/bin readonly 'quoted text' then
+x=1 $(pwd) printf done readonly done "$@" "$@" cd
+then sed --verbose local $(pwd) then
+export ${HOME} -eu echo 'quoted text' then /usr/bin -eu -eu 2>/dev/null
+	readonly export /usr/bin "$@" && done
+	grep export grep local cd echo test 2>/dev/null x=1 $(pwd) awk $(pwd)
+		x=1 done awk printf test export done awk ${HOME} "$1" awk "$@" --verbose
+	${HOME} x=1 done --verbose 2>/dev/null
+		printf test $(pwd) echo awk test -eu ${HOME} | /usr/bin
+		'quoted text' --verbose export cd x=1 sed ${HOME} /usr/bin x=1 x=1 echo
+x=1 x=1 "$@" && -eu "$1" cd printf done 'quoted text' |
+		--verbose /usr/bin -eu $(pwd) local -eu 'quoted text' export | | x=1 "$@" && awk
+	${HOME} awk $(pwd) grep && done
+	test | awk -eu "$@" "$1" /usr/bin 'quoted text'
+x=1 test grep cd done readonly then 'quoted text' --verbose --verbose
+	| echo cd then awk $(pwd) /usr/bin done "$1" "$1" sed
+	x=1 | x=1 awk --verbose sed local -eu 2>/dev/null --verbose
+&& && "$@" 'quoted text' awk $(pwd) $(pwd) echo
+export /usr/bin done cd printf echo echo "$@" | && "$@" echo sed awk "$@" grep 2>/dev/null
+	| cd printf awk "$@" grep "$1" && readonly -eu grep sed done awk cd awk sed
+	awk readonly $(pwd) test 'quoted text'
+	done --verbose | -eu local cd local done echo grep
+test readonly awk done ${HOME} "$@" done echo awk sed "$1"
+		grep export printf done "$@" x=1 printf /usr/bin --verbose "$@" $(pwd) -eu "$@"
+local echo printf | local cd "$@" sed -eu readonly test cd "$@" export
+	"$1" 'quoted text' readonly && done /usr/bin "$@" export test test
+	2>/dev/null sed "$1" 'quoted text' test | local
+	$(pwd) cd sed test export
+--verbose cd test "$1" cd local --verbose cd cd readonly /usr/bin "$@" sed
+		readonly -eu 'quoted text' sed $(pwd) --verbose local then && "$@" --verbose
+		grep "$1" | awk -eu grep ${HOME} awk /usr/bin /usr/bin sed
+	"$1" x=1 grep $(pwd) awk && -eu
+sed && grep cd then /usr/bin "$1" && 'quoted text' awk -eu printf
+	x=1 sed cd cd then /usr/bin grep ${HOME} sed then --verbose test sed 'quoted text'
+then then printf export cd "$@" readonly readonly
+	awk export done local /usr/bin
+	'quoted text' printf 'quoted text' export
+	cd 2>/dev/null cd done ${HOME} grep local awk export $(pwd)
+	printf readonly "$1" echo && | readonly 'quoted text' ${HOME} grep "$1"
+	test printf x=1 awk /usr/bin
+		done "$@" readonly local local "$1" ${HOME} echo grep | local export
+		'quoted text' x=1 "$1" then
+		local --verbose grep readonly printf sed $(pwd)
+		grep | test | printf printf export done ${HOME} sed
+&& 'quoted text' sed --verbose export | printf && x=1 test 2>/dev/null
+awk echo test grep done printf
+		"$@" && && echo local readonly test && cd test readonly /usr/bin
+		awk --verbose 'quoted text' 'quoted text' | ${HOME} awk && echo | && /usr/bin
+	'quoted text' 'quoted text' done -eu "$1" then --verbose done
+		| printf 'quoted text' --verbose export awk test printf | printf then export
+		&& printf grep $(pwd) printf
+done grep then grep | | readonly cd --verbose 2>/dev/null
+"$1" ${HOME} $(pwd) awk /usr/bin export $(pwd) then sed
+${HOME} test && done export echo
+		grep echo /usr/bin awk && printf local 2>/dev/null test
+		echo /usr/bin ${HOME} -eu --verbose 'quoted text'
+		${HOME} "$@" cd 'quoted text' readonly $(pwd) cd export printf 2>/dev/null printf
+		--verbose echo done /usr/bin done export cd | x=1 'quoted text' cd export
+		-eu done ${HOME} export local "$1" x=1 ${HOME} echo | test sed
+| echo export sed 'quoted text' $(pwd) echo echo | && -eu done
+	test && $(pwd) awk && awk awk cd /usr/bin then && | /usr/bin test
+		local then sed echo --verbose echo 'quoted text' "$1" ${HOME}
+		done readonly grep $(pwd) readonly
+		printf test cd 2>/dev/null then
+"$1" ${HOME} x=1 && test && "$@" grep $(pwd) 'quoted text' grep
+sed -eu ${HOME} x=1 -eu
+| export cd x=1 done echo readonly -eu "$@"
+	| cd "$@" echo 2>/dev/null 'quoted text' cd done 2>/dev/null cd x=1 sed test printf
+		export x=1 --verbose export local | cd then grep
+		grep 'quoted text' then awk local /usr/bin printf "$1" /usr/bin test export printf
+		2>/dev/null then "$1" test test x=1 "$@" echo then
+		/usr/bin cd then | && "$1" 2>/dev/null -eu && "$@" awk | "$@" --verbose test
+	"$1" export -eu -eu grep then 2>/dev/null awk 2>/dev/null
+sed /usr/bin readonly local "$1" done readonly
+	printf local ${HOME} export then /usr/bin sed "$@" awk "$@" awk ${HOME}
+		${HOME} $(pwd) done printf printf 2>/dev/null readonly grep
+		-eu /usr/bin | --verbose 'quoted text' ${HOME}
+	readonly "$@" cd done /usr/bin /usr/bin 2>/dev/null
+printf printf "$@" done "$@" 2>/dev/null -eu awk 'quoted text' then awk
+		test && "$@" /usr/bin /usr/bin done test x=1 $(pwd) "$1" -eu local cd awk "$@"
+	"$1" --verbose "$@" /usr/bin sed then export
+	cd echo /usr/bin ${HOME} ${HOME} test 'quoted text' 'quoted text'
+cd 2>/dev/null "$@" "$1" 2>/dev/null ${HOME}
+'quoted text' sed awk local 2>/dev/null "$1" ${HOME} export done "$@" printf
+		${HOME} $(pwd) /usr/bin ${HOME} -eu -eu /usr/bin
+-eu export local 'quoted text' grep $(pwd) x=1 /usr/bin grep
+-eu 'quoted text' then printf 'quoted text' local readonly
+-eu readonly /usr/bin | export 2>/dev/null cd then done local sed echo cd readonly
+		cd printf $(pwd) --verbose echo | -eu grep readonly
+		awk ${HOME} sed "$1" $(pwd) export "$@" 'quoted text' ${HOME} awk
+	cd | test -eu "$1" /usr/bin
+done test x=1 -eu cd sed grep test "$1" $(pwd)
+readonly done sed $(pwd) "$@"
+	cd x=1 printf printf "$1"
+	"$1" | | --verbose sed cd /usr/bin cd --verbose
+$(pwd) "$1" -eu ${HOME} && x=1
+	then "$1" test $(pwd) 'quoted text' local ${HOME} export export
+		awk ${HOME} "$1" local test
+	"$1" x=1 grep grep local 2>/dev/null
+	$(pwd) echo 2>/dev/null 'quoted text' &&
+	grep printf test sed readonly
+x=1 cd 'quoted text' x=1 readonly test /usr/bin $(pwd) $(pwd) ${HOME}
+		grep local --verbose local -eu cd grep
+	sed local "$@" 2>/dev/null -eu
+test printf && echo done sed "$1" sed echo done x=1 2>/dev/null
+	/usr/bin ${HOME} $(pwd)
+x=1 export sed "$@" echo /usr/bin test sed done &&
+	cd readonly -eu 'quoted text' grep 'quoted text' awk sed x=1 export && x=1
+		awk done local grep done grep x=1 readonly test -eu
+		grep sed -eu sed --verbose
+		done | "$@" printf | ${HOME} ${HOME} --verbose then && "$1" 'quoted text'
+-eu local readonly cd /usr/bin local then done
+		grep x=1 "$1" printf
+		'quoted text' | printf "$1" then
+	2>/dev/null echo -eu printf readonly --verbose 'quoted text' readonly cd
+"$1" readonly test printf local export
+	$(pwd) 'quoted text' x=1 /usr/bin echo awk | readonly $(pwd) local "$@" local
+		test awk 'quoted text' x=1 echo printf
+		then sed grep | $(pwd) export printf 2>/dev/null ${HOME} cd
+		${HOME} "$1" sed $(pwd) cd sed "$@" local ${HOME} awk
+"$@" then cd ${HOME} export --verbose --verbose
+		$(pwd) cd readonly readonly && "$@"
+		export "$@" $(pwd) readonly | 'quoted text'
+| local echo awk echo x=1 sed readonly local 'quoted text'
+		2>/dev/null sed done export "$@" &&
+		export 2>/dev/null "$@" done "$@" sed $(pwd) echo x=1 && $(pwd) echo $(pwd)
+&& | sed cd done | awk /usr/bin local && local
+echo "$@" readonly "$@" "$1" 2>/dev/null | done done readonly
+		| done then echo echo printf readonly grep export
+		'quoted text' ${HOME} && local cd | --verbose
+		-eu -eu "$1" readonly "$@"
+then then test 2>/dev/null x=1
+	echo -eu awk local -eu grep && 2>/dev/null ${HOME}
+	${HOME} 2>/dev/null --verbose printf awk 'quoted text' /usr/bin
+	then "$@" /usr/bin readonly awk
+echo "$1" echo "$@" readonly cd -eu then x=1 done 'quoted text' test
+then grep done /usr/bin test 'quoted text' /usr/bin readonly "$@" "$@" echo |
+'quoted text' 2>/dev/null "$@"
+		--verbose ${HOME} printf then then "$1"
+test && cd echo readonly $(pwd) readonly
+		${HOME} $(pwd) "$1" readonly printf then sed 'quoted text' sed
+		echo /usr/bin $(pwd) ${HOME} cd export done export
+grep then done local | sed --verbose local 'quoted text' local
+	echo /usr/bin awk "$@" /usr/bin -eu 'quoted text'
+		grep awk x=1 awk cd | sed /usr/bin ${HOME} /usr/bin
+echo $(pwd) cd /usr/bin printf then printf ${HOME} then
+	"$1" cd export printf local 2>/dev/null export readonly "$@" "$1" $(pwd) test
+	${HOME} 'quoted text' test printf echo &&
+2>/dev/null grep 'quoted text' cd "$@" sed 'quoted text' x=1 x=1 grep "$1"
+readonly "$@" awk 'quoted text' awk local
+	sed && local && sed | $(pwd) export --verbose awk ${HOME}
+then 'quoted text' export ${HOME} echo --verbose then readonly $(pwd) "$1" printf
+		then local x=1 -eu test 2>/dev/null
+	done then "$1" echo $(pwd) export "$@" 'quoted text'
+	/usr/bin "$@" export 2>/dev/null "$@"
+		/usr/bin readonly --verbose awk
+		echo then sed then && awk done $(pwd) x=1 -eu -eu printf local /usr/bin
+		"$1" readonly && done 'quoted text' local done then done test $(pwd) test awk test
+		local 'quoted text' test sed "$1" printf "$1" 'quoted text' ${HOME}
+		"$1" grep awk "$@" cd "$@" && -eu cd | awk
+		-eu x=1 then done | then --verbose 'quoted text' grep
+local then /usr/bin cd "$@" /usr/bin done "$@"
+| export x=1 x=1 grep /usr/bin
+printf export awk test 'quoted text' readonly
+	"$1" then export 2>/dev/null readonly ${HOME}
+	/usr/bin done printf sed ${HOME} echo grep readonly printf
+	done --verbose | readonly sed export 2>/dev/null 'quoted text'
+		--verbose local "$1" local /usr/bin ${HOME} done
+	/usr/bin --verbose --verbose | $(pwd) local test echo done "$@" export printf
+| test awk export echo export && -eu local
+	test --verbose && done then /usr/bin /usr/bin
+grep ${HOME} then "$@" awk 'quoted text' echo test
+"$@" "$1" awk printf awk "$@" printf
+2>/dev/null $(pwd) $(pwd) cd export then /usr/bin
+	-eu /usr/bin readonly ${HOME} --verbose $(pwd) readonly
+	awk ${HOME} $(pwd) | readonly "$@" | $(pwd) 2>/dev/null /usr/bin 2>/dev/null
+	-eu --verbose | echo awk | test
+	printf done 2>/dev/null done awk cd grep cd echo | test
+	'quoted text' /usr/bin awk $(pwd)
+	awk 'quoted text' $(pwd) grep printf sed done cd grep awk $(pwd)
+		| readonly "$@" grep printf readonly 2>/dev/null
+		"$@" 'quoted text' grep printf
+	readonly printf test echo readonly then awk echo
+export -eu grep test 2>/dev/null
+--verbose && local local
+readonly | test --verbose readonly readonly
+	printf -eu sed -eu local "$1" ${HOME} &&
+echo echo grep local 'quoted text' local x=1 export --verbose
+	"$@" test printf --verbose --verbose done sed echo export awk export sed echo
+	$(pwd) awk printf sed echo 2>/dev/null "$1" $(pwd)
+		/usr/bin /usr/bin cd local x=1 sed grep done /usr/bin test
+		sed "$1" 'quoted text' ${HOME} printf
+	$(pwd) 2>/dev/null 2>/dev/null echo --verbose then "$1"
+cd export /usr/bin cd && x=1 ${HOME} grep awk sed | "$1" printf -eu local
+	awk "$1" sed /usr/bin ${HOME} $(pwd)
+	"$@" 'quoted text' grep export then export grep --verbose
+	${HOME} done then ${HOME} ${HOME} printf 'quoted text' && grep sed
+	done echo then export && "$1" --verbose local cd printf 2>/dev/null
+		2>/dev/null awk done --verbose
+		$(pwd) then -eu -eu --verbose ${HOME} | 'quoted text' readonly
+readonly local x=1 "$1" "$1" /usr/bin then "$1" -eu --verbose --verbose echo ${HOME}
+	then $(pwd) "$1" readonly 'quoted text' export $(pwd) /usr/bin "$@" printf grep
+	--verbose printf 'quoted text'
+cd then 'quoted text' x=1 ${HOME} readonly --verbose local export "$@" && 'quoted text'
+	${HOME} then -eu readonly done && --verbose
+	--verbose then && 2>/dev/null && && x=1 cd sed -eu "$@" "$1" sed
+	then 2>/dev/null sed x=1 cd "$@" grep sed then sed done
+	&& --verbose "$1" && awk done /usr/bin sed x=1 /usr/bin
+readonly ${HOME} readonly readonly export echo | sed --verbose
+		readonly readonly export x=1 "$@" "$1" cd printf
+/usr/bin /usr/bin "$1" /usr/bin
+	-eu test test printf /usr/bin
+	done 'quoted text' 'quoted text' 'quoted text'
+		echo "$@" export local awk /usr/bin printf
+		"$@" x=1 sed echo "$1" cd -eu 2>/dev/null cd "$@"
@@ -0,0 +1,2001 @@
+		grep 'quoted text' -eu awk echo echo
+	done 'quoted text' readonly
+	-eu grep readonly test "$1" 2>/dev/null
+	$(pwd) local cd export local cd "$1" && then 2>/dev/null awk readonly
+done readonly printf then 2>/dev/null local /usr/bin
+		"$@" grep done && test $(pwd) then local "$@" --verbose
+	grep /usr/bin 2>/dev/null readonly
+		readonly --verbose "$@" awk 'quoted text'
+	-eu /usr/bin printf --verbose "$1" $(pwd) sed grep x=1 done test x=1 printf printf
+	then ${HOME} "$@" "$1"
+	readonly "$@" "$1" $(pwd) "$1" | grep 'quoted text' 'quoted text'
+'quoted text' then awk test -eu sed -eu export test local export "$@"
+	2>/dev/null "$@" grep test sed cd grep --verbose 'quoted text' --verbose
+	export | 'quoted text' readonly export
+	| "$1" /usr/bin local sed "$1" /usr/bin /usr/bin local printf "$1" sed cd "$@"
+		then then sed -eu local cd 2>/dev/null grep
+| ${HOME} $(pwd) cd then
+		"$1" done "$@" "$1" "$1" readonly ${HOME} "$1" echo test awk sed $(pwd) printf
+		echo x=1 x=1 echo ${HOME}
+	"$@" 2>/dev/null printf -eu readonly 'quoted text' echo export "$1" test --verbose
+		printf -eu | "$1" -eu "$@" | done printf 'quoted text'
+		$(pwd) --verbose "$@" sed 'quoted text'
+done ${HOME} $(pwd) "$@" export
+echo then | local awk "$@" 'quoted text'
+		grep grep readonly local awk "$@" local --verbose done | "$1" 'quoted text'
+	2>/dev/null ${HOME} "$1" local
+	done test export ${HOME} $(pwd)
+'quoted text' test "$1" echo
+	&& export "$@" && readonly then "$@" awk && grep -eu "$1" then
+| readonly -eu echo -eu echo export --verbose
+		"$1" cd local --verbose awk
+${HOME} $(pwd) readonly /usr/bin grep 'quoted text' export echo
+		&& test cd then echo export local 'quoted text' grep --verbose grep readonly
+		--verbose -eu printf
+local && $(pwd) x=1 awk 'quoted text'
+'quoted text' 2>/dev/null "$@" sed x=1 "$@" sed sed readonly done
+		2>/dev/null export cd
+		2>/dev/null --verbose && test readonly
+		echo --verbose ${HOME} -eu readonly
+		&& test local printf readonly x=1 export cd local cd
+	"$@" ${HOME} echo $(pwd) "$1" ${HOME} "$@" local --verbose ${HOME} /usr/bin |
+done then readonly -eu
+-eu ${HOME} "$@" | --verbose sed 'quoted text' "$@" printf "$1" awk local cd
+	| done grep printf 'quoted text' x=1 "$1" x=1 'quoted text' | | x=1 "$1"
+	awk done done $(pwd) 'quoted text' --verbose local 'quoted text'
+		-eu x=1 sed then then 'quoted text'
+		echo done cd sed --verbose test | --verbose grep x=1 ${HOME} grep | 2>/dev/null
+	then ${HOME} export 'quoted text' local $(pwd) local awk /usr/bin "$@" --verbose
+		/usr/bin awk awk local echo readonly
+		&& printf ${HOME} echo sed $(pwd) 2>/dev/null local ${HOME}
+		'quoted text' cd sed -eu && cd 'quoted text' | grep done /usr/bin -eu --verbose
+		$(pwd) 2>/dev/null readonly test export 'quoted text' printf 2>/dev/null -eu
+		readonly then --verbose then cd | 'quoted text' "$1" 2>/dev/null grep
+x=1 cd 'quoted text' $(pwd) /usr/bin
+	readonly grep cd --verbose
+		sed echo printf /usr/bin ${HOME} export /usr/bin grep local
+		2>/dev/null "$1" $(pwd) cd done awk export local readonly
+	"$@" "$1" $(pwd) test && echo "$@" ${HOME}
+		x=1 $(pwd) | "$@" x=1 /usr/bin
+	done cd "$1" printf $(pwd) export $(pwd) $(pwd) | grep echo
+	sed echo then /usr/bin "$1" 2>/dev/null x=1 cd test
+${HOME} export readonly done 'quoted text' echo ${HOME} sed $(pwd) $(pwd) | done
+	done done printf -eu awk then ${HOME} sed | | printf grep
+		printf readonly printf "$1" local done
+&& done --verbose 2>/dev/null
+| printf grep ${HOME} readonly "$1" export /usr/bin awk $(pwd) readonly
+		| grep test grep done cd -eu local /usr/bin "$@" /usr/bin awk
+2>/dev/null grep "$1" | ${HOME} readonly readonly ${HOME} sed /usr/bin
+x=1 -eu cd sed 2>/dev/null -eu "$@" "$@" grep awk && printf $(pwd)
+${HOME} $(pwd) --verbose 2>/dev/null | | grep ${HOME} | then &&
+	--verbose cd -eu then --verbose grep 'quoted text'
+	grep awk readonly done test -eu "$1" "$1" 2>/dev/null
+	local test sed then "$1" -eu printf 'quoted text' "$1" then "$@" printf $(pwd)
+readonly test cd export
+		2>/dev/null sed $(pwd) echo "$1"
+then ${HOME} "$@" "$@" done
+x=1 -eu echo cd readonly awk /usr/bin
+		sed local test cd readonly cd awk "$@" "$1" 'quoted text' echo echo export
+		2>/dev/null "$@" grep echo
+	/usr/bin -eu done sed -eu printf test grep && -eu grep --verbose
+2>/dev/null then done -eu "$1" ${HOME} | "$1"
+cd 'quoted text' | test sed grep then test test 'quoted text'
+	2>/dev/null ${HOME} local done /usr/bin
+	x=1 echo | then local -eu then && grep | /usr/bin
+'quoted text' then && 'quoted text' test export grep && --verbose done grep
+		'quoted text' sed readonly local 'quoted text'
+		done printf --verbose test cd
+		local | ${HOME} local -eu test
+		awk && then then then ${HOME} echo local x=1 | readonly
+		then && done done $(pwd) 2>/dev/null /usr/bin &&
+		2>/dev/null /usr/bin 2>/dev/null 'quoted text' $(pwd) 2>/dev/null done /usr/bin
+x=1 done && 2>/dev/null local export && && cd test done 2>/dev/null
+	sed test "$@" grep local
+	&& echo ${HOME} then readonly test
+		export printf ${HOME} /usr/bin sed printf "$@" local grep /usr/bin ${HOME} awk export
+		done -eu readonly ${HOME} && awk -eu grep local
+	${HOME} sed /usr/bin && export local awk grep
+	echo ${HOME} echo "$1" $(pwd) $(pwd) x=1 'quoted text' --verbose local export
+		echo "$@" cd done echo local "$1" "$@" awk local "$@"
+		| 2>/dev/null "$@" | grep && $(pwd)
+$(pwd) && "$@" | && cd -eu -eu --verbose && then readonly
+		printf echo then printf "$@" -eu printf
+		local | sed done /usr/bin ${HOME} grep
+		/usr/bin readonly "$1" -eu sed "$@" 2>/dev/null "$1"
+/usr/bin awk sed x=1 done | && x=1 --verbose readonly
+grep | printf 2>/dev/null printf x=1 /usr/bin local
+		grep done grep /usr/bin printf /usr/bin sed x=1 cd -eu --verbose ${HOME}
+/usr/bin | then x=1 $(pwd) 2>/dev/null cd && --verbose
+echo then then cd 2>/dev/null "$1" test awk local
+		printf "$1" test printf ${HOME} then x=1 2>/dev/null "$@" then export export
+	readonly printf /usr/bin sed sed local sed $(pwd) test
+export 'quoted text' export export
+readonly 2>/dev/null ${HOME} export then "$@" grep export
+		grep printf cd echo | ${HOME} readonly awk
+	'quoted text' echo test "$1" 'quoted text' awk "$@" | local readonly awk && 2>/dev/null
+		grep "$@" $(pwd) readonly done 'quoted text'
+	test x=1 local "$@" local readonly 2>/dev/null echo then "$@" grep test
+	${HOME} echo export /usr/bin && test done printf cd readonly --verbose sed ${HOME}
+	&& /usr/bin "$@" --verbose "$@" -eu sed export cd -eu
+-eu done $(pwd) grep printf export "$@"
+		done ${HOME} readonly --verbose done local test local x=1
+x=1 echo ${HOME} sed then export
+	x=1 "$1" --verbose grep 'quoted text'
+		-eu "$@" then $(pwd) "$@" "$@" echo grep cd x=1 test | then printf
+	cd x=1 "$@" "$@" done /usr/bin $(pwd) "$@"
+	&& echo grep --verbose readonly test ${HOME} && --verbose readonly export
+	'quoted text' then x=1 then "$1" ${HOME} local 2>/dev/null echo sed --verbose
+		readonly sed echo then |
+test 'quoted text' printf | -eu "$@" "$1" sed &&
+		'quoted text' local export 'quoted text' -eu
+	readonly && echo grep && printf then local --verbose
+	"$@" readonly printf test x=1 2>/dev/null
+		echo local done | echo | -eu -eu awk x=1 local export printf
+		&& ${HOME} printf test ${HOME} then grep ${HOME}
+	readonly && /usr/bin ${HOME} "$1" done /usr/bin export done
+		&& test x=1 ${HOME} ${HOME}
+	/usr/bin "$@" --verbose | | && 'quoted text' printf "$@"
+		echo readonly then x=1 ${HOME}
+-eu 'quoted text' echo grep 'quoted text'
+		${HOME} done then "$@" local printf
+readonly | "$@" --verbose 'quoted text' echo readonly done
+		x=1 printf 'quoted text' export echo printf
+	"$@" printf --verbose 2>/dev/null done echo cd cd test export grep
+		grep awk then 'quoted text' /usr/bin x=1 ${HOME} && grep then
+		&& readonly then ${HOME} export 'quoted text' -eu "$@"
+export $(pwd) ${HOME} && 'quoted text'
+	printf $(pwd) grep readonly grep -eu "$1" cd "$@" x=1 x=1 --verbose
+	"$@" --verbose test 'quoted text' printf done awk grep done printf
+x=1 sed $(pwd) 'quoted text' | awk grep && printf 2>/dev/null
+	grep then then readonly x=1 printf -eu "$1" | | ${HOME} |
+--verbose -eu echo sed test test
+done printf /usr/bin
+	x=1 echo sed "$1" --verbose readonly
+&& export grep readonly export /usr/bin | "$@" local cd -eu
+	then | then local "$@" printf readonly readonly
+test readonly echo sed then "$@" then /usr/bin awk 'quoted text'
+	echo /usr/bin 2>/dev/null grep ${HOME} $(pwd) sed
+echo /usr/bin && x=1 cd test "$@" awk ${HOME}
+	sed printf echo printf 2>/dev/null printf sed cd ${HOME} 2>/dev/null
+		sed -eu printf 2>/dev/null
+then | x=1 $(pwd) 'quoted text' -eu readonly sed cd
+		x=1 awk then x=1 then export local $(pwd) echo
+/usr/bin awk cd export awk 2>/dev/null awk ${HOME} printf
+		"$@" readonly --verbose readonly x=1 x=1 export
+		'quoted text' "$1" $(pwd) cd sed "$@" | | readonly | printf --verbose x=1 "$1"
+&& 'quoted text' -eu x=1 readonly
+		echo --verbose "$@" then readonly ${HOME} | done && 'quoted text' awk then /usr/bin
+	export local export cd ${HOME} "$@" readonly
+sed "$1" ${HOME} echo done done /usr/bin export grep sed done local 2>/dev/null
+	"$1" local | -eu export ${HOME} x=1 echo readonly echo export
+	done $(pwd) sed $(pwd) "$@" awk readonly
+awk && 'quoted text' 'quoted text' --verbose
+	printf ${HOME} local export then ${HOME} printf && 2>/dev/null
+		done ${HOME} printf export
+$(pwd) x=1 && local done printf | 2>/dev/null export 'quoted text' done test
+		local sed awk then local cd then test
+	local --verbose done readonly awk $(pwd) "$@" "$@"
+grep | echo -eu then $(pwd) printf 2>/dev/null
+		&& sed "$1" printf -eu sed $(pwd) "$1" "$1" printf | then
+		"$@" awk readonly x=1 awk awk echo echo then readonly && awk echo cd export |
+$(pwd) ${HOME} sed && -eu | /usr/bin
+	echo /usr/bin "$@" $(pwd) cd -eu /usr/bin 2>/dev/null
+	$(pwd) "$1" 'quoted text' && --verbose && ${HOME} grep
+		sed awk && echo echo "$@" export grep $(pwd) && awk test ${HOME}
+		${HOME} export 'quoted text'
+x=1 then x=1 x=1 test then printf sed x=1 | -eu done "$1" then 2>/dev/null
+done done readonly local --verbose --verbose
+printf x=1 cd readonly local
+-eu x=1 test /usr/bin echo $(pwd) | "$@" done done readonly /usr/bin ${HOME}
+	readonly sed 2>/dev/null $(pwd) -eu printf
+		2>/dev/null -eu ${HOME} export --verbose x=1 export $(pwd) echo /usr/bin
+	"$@" -eu done local "$@" x=1 done done test echo grep done x=1
+-eu cd 'quoted text' -eu x=1 sed awk grep --verbose |
+		echo then done ${HOME} local "$@" ${HOME}
+		'quoted text' cd sed test && "$1"
+	done local cd sed readonly local grep local test then ${HOME}
+x=1 cd done ${HOME} readonly printf "$1" /usr/bin
+awk printf && awk 2>/dev/null
+	2>/dev/null -eu "$1" --verbose -eu && --verbose /usr/bin echo
+	/usr/bin --verbose echo | grep x=1 /usr/bin | echo sed
+local grep 'quoted text'
+	printf && readonly -eu
+2>/dev/null 'quoted text' cd $(pwd) test then grep export 'quoted text'
+	x=1 ${HOME} local export | x=1 /usr/bin
+	export local test x=1
+	$(pwd) "$1" $(pwd) done "$@" x=1
+		| then /usr/bin 2>/dev/null printf --verbose echo
+		export /usr/bin sed readonly cd $(pwd) readonly ${HOME} && && 'quoted text' "$1"
+x=1 "$1" /usr/bin ${HOME} sed echo $(pwd)
+"$@" awk "$1" cd then -eu ${HOME}
+readonly && then "$@" echo
+sed /usr/bin test | grep local x=1 cd
+	sed awk -eu local awk cd
+		"$1" --verbose $(pwd) x=1 | x=1 local cd cd "$@" test && readonly then grep readonly
+test done test grep printf
+	done readonly "$@" local cd sed
+		readonly export echo /usr/bin | export
+	$(pwd) x=1 && awk echo local --verbose grep x=1 "$@" test done test printf
+readonly 2>/dev/null --verbose /usr/bin echo && &&
+-eu done x=1 --verbose sed $(pwd) local then "$@" readonly
+	'quoted text' ${HOME} && then | cd then printf -eu | cd ${HOME} echo
+	readonly export "$1" $(pwd) readonly ${HOME} printf export awk ${HOME} echo
+--verbose test awk printf 'quoted text'
+export export -eu && "$1" echo x=1 'quoted text' then
+		"$1" && --verbose x=1 /usr/bin grep export
+		/usr/bin 'quoted text' test cd $(pwd) awk | "$1"
+	/usr/bin --verbose cd cd then
+readonly "$1" sed printf $(pwd) readonly awk
+readonly "$@" "$1" awk readonly printf 'quoted text' readonly --verbose /usr/bin
+${HOME} x=1 "$1" printf -eu && then -eu awk grep --verbose awk | | done && test
+		'quoted text' done /usr/bin | echo export "$@" cd done
+	"$1" grep 2>/dev/null local grep --verbose
+		"$1" local $(pwd) && readonly echo grep
+		local && sed | grep awk "$1"
+x=1 printf local grep "$@" | sed readonly 2>/dev/null
+		printf export ${HOME} "$@" cd then 'quoted text' 'quoted text'
+	echo readonly 'quoted text' -eu grep
+	-eu grep /usr/bin /usr/bin awk | readonly
+readonly export echo $(pwd) "$1" echo ${HOME} then grep
+${HOME} && 'quoted text' printf /usr/bin awk --verbose "$@" cd readonly cd then
+/usr/bin /usr/bin printf test -eu x=1 done &&
+		&& echo && cd printf -eu readonly then && 'quoted text' test printf
+done 'quoted text' && printf --verbose readonly cd -eu done readonly /usr/bin
+		readonly "$@" sed 2>/dev/null "$1"
+	| ${HOME} /usr/bin export grep local /usr/bin ${HOME} $(pwd)
+"$@" "$1" export sed "$1" readonly "$1" ${HOME} x=1
+printf local readonly done printf echo cd then awk echo awk sed test
+		readonly "$1" test export cd export then awk export $(pwd) test
+	local $(pwd) 'quoted text' cd x=1 | -eu cd echo export 2>/dev/null x=1 grep
+	done awk ${HOME} cd $(pwd) done export /usr/bin --verbose awk
+	echo test local local echo test $(pwd) test grep grep "$@" grep && 'quoted text'
+readonly | grep then printf && ${HOME} /usr/bin --verbose grep "$1"
+		echo echo ${HOME} && $(pwd) awk $(pwd) | local /usr/bin printf printf -eu done
+	-eu echo && ${HOME} --verbose
+'quoted text' grep done --verbose sed && export ${HOME} $(pwd) awk
+		awk "$1" && printf 'quoted text' "$1" $(pwd) sed readonly then local 'quoted text'
+local readonly "$1" then readonly test grep ${HOME} then "$1" done cd 2>/dev/null
+	'quoted text' x=1 readonly export done $(pwd) && --verbose echo "$@" && grep
+		export 2>/dev/null 'quoted text' 'quoted text' | sed x=1 test test
+sed cd cd export then export done
+	done && grep cd "$1" grep test grep sed echo grep cd -eu 'quoted text' then "$@"
+	-eu local $(pwd) export "$1" test /usr/bin cd local export /usr/bin "$1" ${HOME}
+	done done ${HOME} --verbose $(pwd) sed then | 2>/dev/null 2>/dev/null "$1" -eu
+		--verbose grep grep awk
+$(pwd) && done | -eu 2>/dev/null test "$1" then done printf test local test
+-eu test test /usr/bin $(pwd) ${HOME} 2>/dev/null "$1"
+	'quoted text' echo 'quoted text' "$@" /usr/bin readonly -eu local local
+'quoted text' done awk 2>/dev/null &&
+awk "$@" /usr/bin 2>/dev/null /usr/bin
+	&& "$1" && readonly "$@" | | readonly "$@" readonly
+		then 'quoted text' done "$1" local --verbose printf grep readonly ${HOME}
+		-eu $(pwd) && awk ${HOME} 'quoted text' local 2>/dev/null test x=1
+printf readonly echo x=1 "$@"
+	/usr/bin "$1" 'quoted text' /usr/bin x=1 2>/dev/null ${HOME} done "$@"
+test x=1 --verbose cd then test then -eu 2>/dev/null cd
+	${HOME} grep 2>/dev/null test sed "$@"
+sed | export $(pwd) cd cd --verbose sed x=1 then /usr/bin 'quoted text'
+cd "$1" x=1 $(pwd) test
+		&& "$@" readonly -eu $(pwd) 2>/dev/null echo done --verbose printf "$@"
+-eu "$@" then test printf readonly then && printf --verbose | export 'quoted text'
+	readonly test test cd x=1 /usr/bin
+	done awk 2>/dev/null export readonly readonly | readonly sed local $(pwd)
+	export x=1 local "$1" $(pwd) readonly
+$(pwd) 'quoted text' "$1" done sed | && x=1
+		echo test ${HOME} local test ${HOME} done readonly sed then cd test
+	local ${HOME} | x=1 $(pwd) then ${HOME} grep 'quoted text' printf x=1 grep
+	local ${HOME} cd x=1 /usr/bin sed cd awk &&
+local awk export then export 2>/dev/null done 2>/dev/null /usr/bin "$1" $(pwd)
+		awk export cd x=1 local --verbose x=1 printf test echo /usr/bin
+		"$@" --verbose cd done $(pwd)
+		cd x=1 2>/dev/null /usr/bin
+grep /usr/bin 'quoted text' "$1" grep export cd printf -eu -eu x=1 done /usr/bin
+cd grep --verbose readonly
+		cd | ${HOME} | "$@" "$1" /usr/bin grep then "$1" 2>/dev/null
+x=1 $(pwd) x=1 sed then 2>/dev/null sed "$1" grep 'quoted text'
+		2>/dev/null | && "$@" readonly test --verbose printf then "$1" sed
+'quoted text' grep "$@" "$@" -eu --verbose
+	then done 2>/dev/null | sed $(pwd)
+readonly printf export echo | "$@" sed | --verbose
+		export cd sed x=1 'quoted text' done grep
+		then awk -eu x=1 readonly sed local
+	awk done done sed printf printf readonly "$@" 2>/dev/null grep echo
+	test export && /usr/bin awk awk 'quoted text'
+		test readonly cd 2>/dev/null
+"$@" export $(pwd) done readonly printf cd -eu -eu | local export then 2>/dev/null
+		2>/dev/null | awk readonly ${HOME}
+		$(pwd) test awk -eu readonly sed readonly readonly
+readonly && local $(pwd)
+--verbose 2>/dev/null test grep then test echo
+	then export then then --verbose /usr/bin grep "$@" 2>/dev/null
+	printf echo then test local cd x=1 then test "$@" cd $(pwd) readonly sed 'quoted text'
+--verbose | cd "$@" x=1 -eu --verbose cd 'quoted text' awk ${HOME} test then ${HOME}
+		--verbose -eu export grep printf && -eu printf
+	sed 2>/dev/null done export "$1" export echo -eu export sed done test awk awk local
+	'quoted text' awk local --verbose $(pwd) ${HOME}
+		cd readonly echo 2>/dev/null 2>/dev/null x=1 printf $(pwd)
+	${HOME} --verbose /usr/bin 2>/dev/null done
+		test grep x=1 printf "$1" readonly "$1" echo "$1" $(pwd) cd && printf "$@"
+		awk grep $(pwd) --verbose export x=1 grep echo
+readonly && 2>/dev/null && done 2>/dev/null
+	cd local $(pwd) | then grep done test -eu 'quoted text' test |
+		grep cd printf echo export cd "$@" -eu awk 2>/dev/null
+	| 2>/dev/null grep sed -eu | printf --verbose echo 'quoted text' readonly test
+	test echo x=1 done readonly export /usr/bin 'quoted text' -eu x=1 then
+		x=1 local x=1 export readonly /usr/bin --verbose -eu "$@" cd cd done then ${HOME}
+		"$1" cd done | x=1 "$1"
+		test readonly printf done $(pwd) /usr/bin
+then /usr/bin x=1 readonly then ${HOME} readonly "$1" "$@"
+	-eu printf "$@" ${HOME} /usr/bin && 2>/dev/null
+	2>/dev/null then grep 'quoted text' cd && done cd then 2>/dev/null
+	&& ${HOME} echo "$@" && /usr/bin -eu local "$@" cd "$1" local 2>/dev/null --verbose
+/usr/bin --verbose "$1" awk /usr/bin x=1 local && then local x=1 echo readonly
+	awk --verbose grep awk x=1 sed --verbose ${HOME} awk "$@" local then
+		"$@" 2>/dev/null 'quoted text' printf 2>/dev/null printf cd && then
+&& x=1 readonly printf echo x=1 /usr/bin printf cd export
+grep done export ${HOME} $(pwd)
+	$(pwd) grep cd grep $(pwd) grep awk --verbose awk --verbose 2>/dev/null ${HOME}
+		$(pwd) cd then sed then ${HOME} | cd /usr/bin x=1 export
+	-eu test ${HOME} awk then then test
+		export /usr/bin local local grep | x=1 | printf ${HOME} --verbose awk then x=1
+		readonly printf 2>/dev/null 2>/dev/null done local grep sed local ${HOME}
+	sed /usr/bin awk | --verbose export local local "$@" done readonly
+	readonly -eu 'quoted text' "$@" /usr/bin 'quoted text'
+done | readonly sed echo sed "$@" cd awk $(pwd) 2>/dev/null "$@" sed then --verbose
+		"$1" test | echo cd awk printf printf && cd x=1 grep 2>/dev/null 2>/dev/null
+		&& $(pwd) ${HOME} ${HOME} sed done sed x=1 awk $(pwd)
+	&& test "$@" grep ${HOME} | "$@"
+		-eu test /usr/bin echo cd
+	| printf --verbose 'quoted text'
+		2>/dev/null $(pwd) echo "$1" cd cd printf then "$@" -eu readonly ${HOME} printf
+	$(pwd) --verbose "$@" "$1" && | printf local | --verbose then sed --verbose
+		$(pwd) 'quoted text' cd printf
+		-eu /usr/bin awk local x=1 printf
+		then "$1" test echo -eu --verbose printf export awk "$1" | "$1" sed
+	done $(pwd) test echo test 2>/dev/null
+		echo export 'quoted text' 'quoted text'
+test done /usr/bin done done 2>/dev/null "$@" local sed done grep test ${HOME}
+sed 'quoted text' then "$1" done x=1
+/usr/bin "$1" x=1 grep awk test x=1 $(pwd) 2>/dev/null
+printf sed /usr/bin then --verbose grep done test "$1" test
+		sed --verbose ${HOME} local
+	awk readonly ${HOME} ${HOME} && awk test echo echo | done 'quoted text'
+		export 'quoted text' x=1 ${HOME} cd x=1 /usr/bin --verbose $(pwd) 2>/dev/null
+		--verbose readonly | grep grep 'quoted text'
+cd 'quoted text' printf 2>/dev/null
+	&& && cd "$@" export done "$1" cd |
+		echo echo export sed grep grep cd |
+		done then then "$@" export grep /usr/bin cd test done local -eu
+2>/dev/null "$1" --verbose export x=1 done && printf -eu readonly
+	$(pwd) local "$1" /usr/bin awk export /usr/bin readonly echo sed | readonly
+		-eu local -eu export 'quoted text' --verbose then local
+		--verbose awk awk cd ${HOME} done | "$1" "$@" /usr/bin readonly echo
+echo grep export then -eu /usr/bin grep "$@" echo $(pwd) grep echo awk printf
+printf --verbose echo "$@"
+echo readonly 'quoted text' "$1" 'quoted text'
+done | /usr/bin "$1" cd -eu /usr/bin
+	2>/dev/null /usr/bin 2>/dev/null "$1" test "$@" echo ${HOME} readonly
+export $(pwd) && readonly export && sed readonly /usr/bin
+local echo "$1" awk echo "$@" printf x=1
+&& "$@" --verbose && export export readonly
+		${HOME} awk echo "$1" done "$1" export sed cd --verbose then sed test
+| echo -eu x=1 readonly sed readonly "$1" /usr/bin test
+done /usr/bin 'quoted text'
+		test $(pwd) awk cd readonly
+		test export done -eu export /usr/bin 2>/dev/null readonly && then ${HOME}
+	&& readonly -eu awk local echo "$@" "$1" awk grep then test
+-eu -eu "$@" done | -eu "$@" $(pwd) x=1 local | local /usr/bin local | awk
+		| -eu readonly done && ${HOME} 'quoted text'
+awk cd x=1 printf export awk --verbose x=1 ${HOME} 2>/dev/null readonly && "$@"
+		local then grep /usr/bin then then --verbose "$1" /usr/bin ${HOME}
+awk && readonly ${HOME} done done "$1" -eu cd $(pwd) x=1 'quoted text'
+		then | $(pwd) && then 'quoted text' cd
+		awk x=1 done echo echo x=1 |
+		--verbose | readonly | test
+-eu readonly test export awk
+awk local local done /usr/bin "$@"
+	"$@" 2>/dev/null $(pwd)
+	done && | then "$@" readonly /usr/bin then test 'quoted text'
+export grep "$@" /usr/bin | echo test ${HOME}
+	local local test sed cd 'quoted text' -eu
+	${HOME} 2>/dev/null && test sed then printf done printf readonly
+	$(pwd) readonly cd local
+| | awk test readonly && awk $(pwd) printf x=1
+	--verbose printf export ${HOME} ${HOME}
+"$@" 'quoted text' then "$1" $(pwd) then test echo -eu x=1 local 'quoted text'
+"$1" -eu 'quoted text' export awk echo --verbose
+		'quoted text' --verbose ${HOME} ${HOME} export | export printf
+printf 'quoted text' awk readonly | cd local ${HOME} test ${HOME}
+	| test sed echo echo awk then done
+	awk $(pwd) --verbose local "$@" cd 2>/dev/null /usr/bin awk 'quoted text'
+echo /usr/bin grep cd 2>/dev/null then --verbose --verbose grep
+grep awk then 'quoted text' /usr/bin && -eu --verbose
+	printf readonly then --verbose local grep $(pwd) then export test | /usr/bin
+		export done cd test $(pwd) "$1" then "$@" echo sed "$1" "$@"
+		'quoted text' ${HOME} printf $(pwd) | printf readonly 'quoted text' printf cd
+		printf --verbose --verbose 2>/dev/null &&
+	x=1 cd grep local x=1 then -eu echo local
+"$1" -eu echo echo | cd test /usr/bin
+		x=1 done then && done local test -eu then done grep 2>/dev/null 2>/dev/null
+	${HOME} export readonly | readonly cd -eu "$@" $(pwd) export
+readonly && 'quoted text' awk then export /usr/bin awk cd local | /usr/bin
+	$(pwd) 'quoted text' ${HOME} ${HOME} test
+-eu cd "$1" awk && "$@" | && /usr/bin then --verbose awk "$@" readonly
+	"$1" grep "$@" "$@" -eu 'quoted text'
+	-eu --verbose echo echo test && && x=1 "$1" $(pwd) done $(pwd) --verbose
+	--verbose then -eu -eu "$1"
+	'quoted text' readonly
+	done grep grep echo && done then readonly &&
+		"$@" local printf readonly done export && then export
+		then readonly ${HOME} x=1 "$@" echo export 2>/dev/null
+$(pwd) then cd && awk "$1" x=1 2>/dev/null -eu local
+		$(pwd) /usr/bin ${HOME} done grep /usr/bin readonly test "$1" readonly
+x=1 printf done 2>/dev/null cd ${HOME} readonly awk && grep
+${HOME} --verbose "$1" && then local ${HOME} "$@" -eu readonly awk printf
+"$@" 'quoted text' -eu && | done echo -eu && awk readonly ${HOME} "$@" printf
+then x=1 $(pwd) -eu x=1 test then "$@" | printf awk local
+cd test done && x=1 'quoted text' && $(pwd)
+		test export /usr/bin cd grep 2>/dev/null "$1"
+	-eu -eu grep cd | awk done
+		| awk && cd export x=1 "$@" && -eu -eu echo then --verbose
+	export 'quoted text' then test x=1 x=1 "$@"
+	"$@" test --verbose grep ${HOME} grep ${HOME} x=1 test $(pwd) "$1" export $(pwd)
+export cd ${HOME} done "$1" | x=1 'quoted text'
+		test 'quoted text' |
+		sed cd 2>/dev/null export awk -eu && /usr/bin "$1" sed "$1" && x=1 readonly
+		&& echo echo "$1" ${HOME} test cd x=1 && echo 2>/dev/null
+	sed printf "$1" --verbose ${HOME} 2>/dev/null test local cd -eu "$1"
+		printf x=1 && -eu then cd export 'quoted text'
+		--verbose 'quoted text' 2>/dev/null $(pwd) /usr/bin ${HOME} done -eu -eu
+echo x=1 $(pwd) 2>/dev/null local done export
+	"$1" | /usr/bin "$@" --verbose test | x=1 ${HOME}
+		done local then done local
+	'quoted text' readonly readonly x=1 x=1 then then 2>/dev/null
+export ${HOME} cd x=1 x=1 "$1" done 2>/dev/null x=1 /usr/bin cd echo test
+${HOME} cd -eu test && readonly printf export 2>/dev/null
+"$1" "$1" 'quoted text' test readonly
+		test ${HOME} 'quoted text' | ${HOME} | x=1 -eu grep "$1" "$1" &&
+done 'quoted text' && done then | && done "$1" then then -eu && "$@" grep "$@" done
+		test readonly "$1" $(pwd) | awk "$1" export $(pwd)
+	echo done 'quoted text'
+		done --verbose ${HOME} sed printf ${HOME}
+&& export grep && readonly "$1" x=1 cd awk /usr/bin x=1
+	awk awk cd -eu 2>/dev/null then test | && 2>/dev/null
+printf cd done "$1" | "$@" "$@" grep echo --verbose done ${HOME} printf
+		$(pwd) test export awk
+	'quoted text' echo "$@" sed 'quoted text' local -eu sed local x=1
+		&& cd sed "$@" test test /usr/bin 'quoted text' printf /usr/bin readonly
+		/usr/bin 2>/dev/null cd echo x=1 &&
+	export /usr/bin 2>/dev/null 2>/dev/null 'quoted text'
+		done 2>/dev/null printf awk $(pwd) grep /usr/bin export sed ${HOME}
+-eu printf grep readonly 'quoted text' -eu ${HOME} -eu | printf grep "$1"
+		local ${HOME} 'quoted text'
+	readonly then /usr/bin done "$@" grep ${HOME} sed local local 'quoted text' test
+		local x=1 'quoted text' then test cd $(pwd) export --verbose
+		/usr/bin "$@" grep sed "$@" "$1" && local /usr/bin
+		done -eu test | printf "$1" --verbose /usr/bin echo cd
+$(pwd) done done $(pwd) then "$1" readonly awk
+	readonly test -eu grep grep --verbose $(pwd) awk printf then --verbose
+		-eu printf echo grep export local echo echo
+		test grep "$1" grep $(pwd) printf
+		echo cd /usr/bin echo export "$@" "$@" 2>/dev/null
+	'quoted text' then export done 2>/dev/null grep echo /usr/bin $(pwd)
+${HOME} 2>/dev/null grep "$@" export | 'quoted text'
+		readonly printf readonly $(pwd) test 'quoted text' 'quoted text' sed 'quoted text'
+${HOME} test "$@" local 2>/dev/null "$1" readonly
+		| --verbose sed cd cd "$@" echo --verbose
+	$(pwd) export export sed local --verbose $(pwd) done 2>/dev/null export
+		sed grep awk then readonly x=1 printf | sed && "$@" sed cd
+--verbose $(pwd) x=1 && then cd | | /usr/bin x=1 /usr/bin x=1 awk
+	2>/dev/null cd export /usr/bin export "$1" 2>/dev/null sed $(pwd) | sed awk
+done printf test --verbose "$1" printf readonly sed export sed -eu readonly 'quoted text'
+	$(pwd) sed readonly 'quoted text' x=1 && $(pwd) sed printf && then -eu
+test echo "$1" done $(pwd) x=1 && x=1 "$@"
+		printf 2>/dev/null && x=1 2>/dev/null "$@" then test | test ${HOME} "$1" x=1 grep
+--verbose && then "$@" 'quoted text' printf && export
+2>/dev/null echo done sed export printf sed printf "$1" | && 2>/dev/null
+sed | done echo "$@" -eu printf 'quoted text' | export then | &&
+		-eu printf local ${HOME} 2>/dev/null
+awk export then && echo "$@" /usr/bin local awk | done sed local
+	${HOME} x=1 ${HOME} echo -eu awk | export
+	export cd done 'quoted text' then ${HOME}
+awk && readonly awk test echo 'quoted text' then $(pwd) ${HOME}
+&& $(pwd) then 'quoted text' sed $(pwd) awk echo echo && readonly
+	local -eu | 'quoted text' grep cd test then export test then
+'quoted text' grep grep /usr/bin readonly $(pwd) /usr/bin
+		x=1 && printf local done x=1 $(pwd)
+	x=1 "$@" --verbose printf "$1" echo
+		&& local $(pwd) 'quoted text'
+	-eu 'quoted text' then printf grep export 2>/dev/null
+		sed /usr/bin --verbose $(pwd) local
+'quoted text' export $(pwd)
+		sed -eu then echo -eu done | && done $(pwd) cd then local && $(pwd)
+	$(pwd) printf -eu /usr/bin then $(pwd) sed grep && done test | cd awk sed cd done
+	$(pwd) printf readonly $(pwd) local sed
+		-eu x=1 printf -eu echo 2>/dev/null cd cd /usr/bin $(pwd) && "$@" export x=1 ${HOME}
+		cd -eu export x=1 awk test local $(pwd) /usr/bin
+done -eu sed sed "$1" 'quoted text'
+done | test 'quoted text' 'quoted text' awk printf test 2>/dev/null $(pwd)
+		done test readonly printf 2>/dev/null -eu sed $(pwd) && && --verbose /usr/bin printf
+	--verbose test done "$1" --verbose /usr/bin
+	printf printf 'quoted text' /usr/bin local x=1 -eu awk awk export export
+		x=1 readonly export $(pwd) 'quoted text'
+echo done echo local grep grep --verbose | test echo done 'quoted text'
+	awk echo /usr/bin /usr/bin | $(pwd) "$1" readonly local "$1" cd
+	"$@" then 2>/dev/null | && &&
+		grep x=1 2>/dev/null local export "$@" 2>/dev/null test awk awk local printf test
+		$(pwd) | sed done 2>/dev/null /usr/bin && cd | "$1" /usr/bin /usr/bin
+sed ${HOME} ${HOME} | printf cd local
+-eu 'quoted text' cd -eu printf then printf && cd printf echo local
+--verbose /usr/bin readonly then cd 2>/dev/null
+		readonly 2>/dev/null ${HOME}
+		$(pwd) cd --verbose --verbose awk done grep printf readonly
+	cd readonly x=1 "$1" $(pwd)
+	/usr/bin then readonly | cd awk 2>/dev/null && "$1" 'quoted text'
+		2>/dev/null export then test /usr/bin 'quoted text' readonly then $(pwd) "$1"
+test then sed "$@" x=1 local echo printf x=1 $(pwd) test ${HOME} 'quoted text'
+local "$1" ${HOME} && /usr/bin then
+		"$1" -eu | awk "$@" | --verbose ${HOME} sed && local local echo
+	sed --verbose test export ${HOME} "$@" sed done | ${HOME} 2>/dev/null $(pwd)
+	done ${HOME} then --verbose
+	"$1" cd && -eu "$@" 2>/dev/null export |
+		grep x=1 -eu && readonly && local export
+	"$@" cd cd then "$1" ${HOME} "$@" 2>/dev/null
+	readonly $(pwd) ${HOME} awk 2>/dev/null echo export 'quoted text'
+2>/dev/null test ${HOME} 'quoted text' local
+&& export $(pwd) awk then
+		"$1" 'quoted text' ${HOME} sed cd export grep && local then "$1" readonly
+echo readonly local sed | 2>/dev/null 2>/dev/null
+	grep printf && awk local cd $(pwd) test
+		done --verbose x=1 ${HOME} | "$1"
+		--verbose grep local test local ${HOME} local 'quoted text' done test
+		&& /usr/bin then sed 2>/dev/null local cd readonly awk
+local -eu --verbose echo 'quoted text' awk $(pwd) | test then -eu x=1 printf cd
+		done done x=1 test -eu $(pwd) cd
+	readonly echo awk awk cd --verbose 2>/dev/null readonly printf
+	"$1" "$1" done local awk x=1 done
+local test then "$@" | echo test
+		readonly ${HOME} grep 'quoted text' done local && 2>/dev/null cd
+export local then sed --verbose test then
+		$(pwd) $(pwd) awk grep $(pwd) sed readonly 'quoted text' $(pwd) /usr/bin "$1"
+		local | && && cd | ${HOME} 2>/dev/null x=1 x=1 done grep done
+		test local --verbose && awk
+	--verbose ${HOME} x=1 'quoted text' cd sed x=1 'quoted text'
+	--verbose x=1 printf then done "$1"
+"$1" test 'quoted text' &&
+		'quoted text' && then local -eu printf "$1" grep -eu ${HOME} $(pwd) then
+${HOME} echo echo grep printf ${HOME} $(pwd)
+		| --verbose echo /usr/bin
+	local local "$1" test 'quoted text' $(pwd)
+		$(pwd) export printf
+	| awk cd sed x=1 echo --verbose
+	'quoted text' sed export ${HOME} sed -eu then readonly /usr/bin --verbose
+x=1 x=1 -eu cd 'quoted text' test grep grep ${HOME}
+		&& $(pwd) --verbose x=1 $(pwd) -eu 'quoted text' done "$@" -eu echo
+		$(pwd) ${HOME} test test 'quoted text'
+	readonly readonly export readonly
+		| export sed /usr/bin grep grep --verbose "$@" cd sed cd sed readonly
+${HOME} test && grep 2>/dev/null "$1" /usr/bin 2>/dev/null
+	local /usr/bin local printf | 2>/dev/null
+"$1" x=1 && readonly "$1" export sed | --verbose grep awk
+		&& local test /usr/bin local /usr/bin --verbose grep then sed local
+		readonly grep | "$1" --verbose "$@" echo
+	test readonly ${HOME} test 2>/dev/null "$1" cd x=1 'quoted text' sed &&
+	then echo x=1 grep test | echo then $(pwd) cd then | then /usr/bin readonly
+	x=1 awk sed ${HOME} x=1 $(pwd) ${HOME} sed && x=1 ${HOME} grep "$1" -eu "$1"
+		test done --verbose awk readonly done
+awk 2>/dev/null 2>/dev/null test | awk -eu cd echo x=1 cd "$1"
+"$1" ${HOME} printf echo cd ${HOME} "$1" printf "$1" sed awk && $(pwd) $(pwd)
+		/usr/bin -eu -eu export printf printf local $(pwd) ${HOME}
+	test awk /usr/bin cd test "$1" /usr/bin awk $(pwd) grep echo then
+--verbose --verbose --verbose cd local readonly "$@" x=1 && grep
+	/usr/bin ${HOME} readonly awk && cd x=1 sed test 2>/dev/null
+test -eu cd readonly grep
+printf 'quoted text' awk $(pwd) && && grep /usr/bin then | ${HOME} test local
+		--verbose local echo -eu export "$1" | 2>/dev/null cd && "$1" --verbose "$1"
+		/usr/bin awk && ${HOME} then --verbose sed export 'quoted text' $(pwd) "$@"
+	2>/dev/null printf ${HOME} grep export awk -eu $(pwd) 2>/dev/null
+	$(pwd) -eu cd export $(pwd) -eu cd 'quoted text'
+	$(pwd) local echo ${HOME} export export $(pwd) ${HOME} /usr/bin readonly
+'quoted text' echo export export /usr/bin /usr/bin local --verbose
+	readonly ${HOME} -eu "$1" --verbose local $(pwd) grep | ${HOME}
+	then $(pwd) test readonly | sed && "$1" --verbose | awk echo x=1
+done done | then /usr/bin echo --verbose && ${HOME} echo | test cd
+	x=1 --verbose && 2>/dev/null -eu ${HOME} cd x=1 readonly
+	readonly -eu awk export then readonly -eu "$1" grep &&
+		"$@" | echo then x=1 && 'quoted text' /usr/bin printf test
+		export test "$@" cd $(pwd) && --verbose
+"$1" awk x=1 cd 'quoted text' -eu local && 'quoted text' | 'quoted text'
+cd "$1" sed x=1 local echo 2>/dev/null -eu | printf export export
+		echo export -eu then local 2>/dev/null
+		test && "$@" readonly
+	"$1" local then cd x=1 sed --verbose x=1 then --verbose --verbose echo
+	test readonly -eu $(pwd)
+awk grep /usr/bin /usr/bin x=1 local
+x=1 cd then $(pwd) ${HOME} -eu awk
+	readonly sed /usr/bin && --verbose awk export then |
+		&& echo printf then --verbose
+test 2>/dev/null "$1" echo | cd $(pwd) readonly --verbose export 2>/dev/null
+	test then readonly --verbose done done "$1" grep grep | --verbose
+	export "$@" -eu x=1 local $(pwd)
+		grep echo $(pwd) | ${HOME} /usr/bin echo readonly test echo local
+	echo then export test ${HOME}
+printf "$@" --verbose cd printf x=1 $(pwd) grep
+		"$1" --verbose --verbose local echo
+		x=1 cd /usr/bin then | --verbose "$@" 2>/dev/null && echo ${HOME} test grep
+echo $(pwd) cd done sed | $(pwd) --verbose done && sed /usr/bin
+	done then sed x=1 --verbose local "$1" readonly printf sed
+then echo local readonly awk printf cd export printf "$@" grep
+then readonly 'quoted text' /usr/bin echo $(pwd) local | test grep local "$1" --verbose
+	echo readonly export awk ${HOME} cd sed sed export echo
+		/usr/bin /usr/bin grep ${HOME} /usr/bin local "$1"
+	$(pwd) && x=1 export "$@" echo -eu 'quoted text' sed awk
+	local awk /usr/bin /usr/bin --verbose && readonly readonly
+test "$1" $(pwd) ${HOME} && local /usr/bin | "$@"
+awk test export 'quoted text' local --verbose -eu x=1 x=1 then test && test
+		awk "$@" then /usr/bin echo cd
+${HOME} && $(pwd) ${HOME} awk ${HOME} /usr/bin printf awk export "$1" then
+	'quoted text' awk then ${HOME} "$1" "$@" && awk cd readonly
+		${HOME} awk readonly echo sed done done echo done 2>/dev/null $(pwd) $(pwd)
+	"$1" sed "$1" x=1 "$@"
+	x=1 echo awk grep test "$@" "$1" sed 2>/dev/null done -eu
+	readonly 'quoted text' -eu local x=1
+	--verbose then --verbose
+	cd export then | $(pwd) echo x=1 printf
+		printf "$@" cd | test | && export x=1 -eu then echo 'quoted text' 2>/dev/null
+		done done && "$@" echo awk then
+	local $(pwd) -eu printf --verbose local 2>/dev/null done test
+| echo local test /usr/bin awk cd echo done then
+readonly export awk test sed $(pwd) done && |
+		x=1 "$1" && $(pwd) && grep local "$@" readonly
+		printf printf test local && "$1" cd local /usr/bin
+	echo "$@" /usr/bin sed then 2>/dev/null export
+	local "$@" 'quoted text'
+		-eu echo echo export readonly echo printf
+	echo --verbose sed --verbose
+grep done "$@" 2>/dev/null local /usr/bin local -eu x=1 /usr/bin &&
+		test ${HOME} && then --verbose x=1 "$1" $(pwd) --verbose sed cd -eu cd
+		printf grep ${HOME} printf "$@" --verbose $(pwd) $(pwd) && echo --verbose ${HOME}
+		local grep local 2>/dev/null export local grep -eu echo done local | done 'quoted text'
+${HOME} printf | test echo $(pwd)
+	then -eu test echo local then "$@" done cd awk -eu
+		/usr/bin "$1" echo sed printf awk 'quoted text' 2>/dev/null awk cd then
+	awk local /usr/bin readonly local
+	then then readonly readonly --verbose printf /usr/bin grep |
+		--verbose readonly then test export "$@" cd | -eu local
+		printf local cd readonly $(pwd) grep "$@" grep test test
+		export awk sed printf && --verbose printf then --verbose echo
+		sed local grep cd then && printf --verbose
+	done "$@" "$@" 2>/dev/null export echo sed | test "$@" sed
+	/usr/bin printf test test ${HOME} 2>/dev/null 2>/dev/null && sed done
+test cd printf echo "$1" && x=1 'quoted text' "$1" done $(pwd)
+		${HOME} | then cd x=1 readonly "$@" echo
+	then awk export done 2>/dev/null printf | echo x=1
+	-eu && echo awk done $(pwd) "$1" 2>/dev/null --verbose then echo readonly
+		then printf awk cd 2>/dev/null 2>/dev/null /usr/bin
+		/usr/bin /usr/bin readonly "$1" "$1" readonly
+		echo 'quoted text' && | ${HOME} 2>/dev/null && ${HOME}
+export awk "$@" test 'quoted text' awk readonly
+	x=1 x=1 echo ${HOME} export x=1 ${HOME}
+		awk && sed done sed $(pwd)
+	awk readonly export |
+	awk sed done grep --verbose test 2>/dev/null /usr/bin
+	'quoted text' /usr/bin cd grep 'quoted text' "$@" x=1 grep echo
+	&& readonly export x=1 /usr/bin done 'quoted text'
+	"$1" "$@" printf awk cd /usr/bin cd && echo done then 'quoted text' echo test
+		&& $(pwd) then done x=1 sed local x=1 ${HOME} local "$1" awk echo 2>/dev/null
+		x=1 x=1 x=1 test readonly /usr/bin | "$@" echo then $(pwd)
+		$(pwd) 'quoted text' /usr/bin done 2>/dev/null sed cd "$@" readonly
+	${HOME} "$1" /usr/bin 2>/dev/null && && readonly $(pwd) grep
+		export awk sed "$1" then then "$@" $(pwd) printf done
+"$@" test -eu /usr/bin readonly then awk awk done && local 2>/dev/null sed
+grep done && | sed printf "$1" ${HOME} 'quoted text' -eu 'quoted text' --verbose
+		"$@" sed test 2>/dev/null "$1" then
+		readonly sed export done cd -eu test awk ${HOME} echo x=1 local --verbose done
+2>/dev/null && printf echo done ${HOME} x=1 --verbose ${HOME}
+cd /usr/bin readonly "$1" && "$1" test awk 'quoted text' echo --verbose $(pwd)
+	"$@" --verbose export done "$@" awk "$1" "$@" readonly $(pwd) local
+test test && /usr/bin 2>/dev/null
+		printf printf && done export sed then grep ${HOME} awk awk
+"$1" | -eu /usr/bin printf |
+echo then then 2>/dev/null test | /usr/bin 2>/dev/null cd && -eu 'quoted text'
+	printf "$1" cd readonly grep "$1" local x=1 "$1" echo cd
+	export then | readonly --verbose --verbose $(pwd) ${HOME} test export | x=1 export
+	| local | $(pwd) "$1" ${HOME} awk
+echo | readonly 2>/dev/null
+2>/dev/null echo readonly ${HOME} printf x=1 local --verbose ${HOME} test
+	local | $(pwd) x=1 2>/dev/null
+		&& grep local /usr/bin printf
+readonly readonly 'quoted text' grep ${HOME} $(pwd) ${HOME} readonly
+then grep 'quoted text'
+		--verbose /usr/bin 2>/dev/null grep -eu printf printf ${HOME} then test 2>/dev/null
+	--verbose then sed 'quoted text' printf
+sed "$1" | -eu printf /usr/bin sed -eu | /usr/bin sed "$1"
+	| -eu 2>/dev/null printf && done "$1" done
+		export done sed $(pwd) 2>/dev/null cd
+	/usr/bin then readonly ${HOME} printf
+--verbose export then | grep local grep && then "$1" grep "$@" test --verbose
+	x=1 | awk cd --verbose grep readonly export "$@" export /usr/bin 'quoted text'
+		--verbose | echo export --verbose
+		/usr/bin --verbose x=1 2>/dev/null
+	then ${HOME} ${HOME} readonly done 2>/dev/null awk
+"$1" 2>/dev/null 2>/dev/null | echo && | test cd "$1" done awk then awk
+		sed -eu cd readonly "$@" "$1" "$1" | -eu && awk
+awk 'quoted text' sed 'quoted text'
+		x=1 readonly -eu "$@" grep printf echo | export --verbose test
+readonly /usr/bin | awk readonly 'quoted text' --verbose test
+echo ${HOME} "$1" --verbose && sed /usr/bin test echo 'quoted text'
+| awk x=1 awk readonly x=1 done then sed $(pwd) 'quoted text' -eu /usr/bin
+		--verbose /usr/bin local then "$1" sed "$@" 'quoted text'
+	done readonly "$1" sed export local x=1 sed grep test "$@" printf /usr/bin
+		"$1" 'quoted text' local $(pwd) test grep | grep "$1" x=1 cd ${HOME} -eu readonly
+	awk grep ${HOME} x=1 "$1" ${HOME} /usr/bin
+	grep 2>/dev/null --verbose /usr/bin && cd sed -eu x=1 cd --verbose
+		'quoted text' $(pwd) "$1" then --verbose local 2>/dev/null
+		local done then | local && ${HOME} | --verbose test
+	x=1 then x=1 ${HOME} ${HOME} | && 'quoted text' grep then ${HOME}
+&& /usr/bin echo then | --verbose
+	test "$@" 'quoted text' x=1 printf 'quoted text'
+	then printf sed readonly awk cd cd && readonly
+		"$1" test x=1 sed 2>/dev/null "$@" export
+		readonly echo readonly grep --verbose 2>/dev/null | sed
+readonly sed local printf "$1" cd
+test /usr/bin test printf --verbose
+	| export 'quoted text' sed $(pwd) $(pwd) | 2>/dev/null "$1" local
+	--verbose ${HOME} x=1 'quoted text'
+	$(pwd) ${HOME} 'quoted text' then 2>/dev/null sed
+	"$1" local && export
+		printf ${HOME} -eu $(pwd) grep grep grep awk $(pwd) -eu ${HOME} && 'quoted text'
+		"$1" 2>/dev/null printf done test && readonly test sed readonly then
+	grep "$@" x=1 --verbose cd cd $(pwd) grep then then /usr/bin /usr/bin -eu done
+		echo /usr/bin ${HOME} printf /usr/bin done test test | cd printf
+		export x=1 printf grep awk | 2>/dev/null
+	grep export && local -eu grep "$1" "$@" | x=1 done grep then | echo
+grep then "$1" --verbose
+export done && sed $(pwd) export
+		-eu -eu test --verbose cd cd grep then "$1" $(pwd) grep
+-eu grep | printf test echo 2>/dev/null local readonly then echo 'quoted text'
+	-eu sed /usr/bin 'quoted text' | --verbose $(pwd) /usr/bin | "$1"
+	test "$@" awk 2>/dev/null printf "$@" 'quoted text' echo --verbose | export
+export test "$1" awk printf "$1" grep then --verbose printf printf
+	"$@" x=1 && /usr/bin ${HOME} /usr/bin && "$@" 2>/dev/null done "$1" -eu grep
+grep local test /usr/bin sed -eu grep test then --verbose test -eu 2>/dev/null
+awk done then x=1 local local
+		2>/dev/null x=1 "$1" printf ${HOME} --verbose done && $(pwd) export cd
+printf x=1 | x=1 && local "$@" $(pwd)
+	test "$@" sed then local cd echo test printf ${HOME} then cd x=1 done local
+		echo export grep then awk && "$@" readonly "$1" printf "$@" local readonly then
+		cd test 'quoted text' awk readonly --verbose echo sed awk grep && "$1" "$@" --verbose
+cd test /usr/bin | export | "$1" /usr/bin
+	"$@" $(pwd) awk awk sed x=1 | $(pwd) sed then awk 2>/dev/null
+		"$1" readonly "$@" local echo "$@" | x=1 sed printf printf
+/usr/bin grep sed readonly export x=1 readonly 2>/dev/null readonly echo
+		echo "$1" local x=1 && x=1 -eu sed 2>/dev/null "$1" | 'quoted text'
+${HOME} x=1 cd && local grep -eu 2>/dev/null
+	sed --verbose ${HOME} grep "$@" && $(pwd) grep grep export sed printf --verbose
+		&& done $(pwd) done -eu local printf | export --verbose 'quoted text' echo ${HOME}
+		&& then "$1" "$1" 'quoted text' "$1" grep | ${HOME} awk test | test ${HOME}
+	'quoted text' $(pwd) export sed grep x=1 /usr/bin
+	-eu /usr/bin test done test echo local -eu export 2>/dev/null
+cd "$1" grep 2>/dev/null sed 'quoted text' test done 2>/dev/null -eu "$@"
+	export cd "$@" | then -eu awk awk awk local grep test 2>/dev/null
+		local ${HOME} -eu -eu /usr/bin "$@" &&
+export 2>/dev/null 2>/dev/null echo awk x=1
+-eu done export echo test "$1" "$@"
+	'quoted text' done /usr/bin test ${HOME} echo
+		done local sed 2>/dev/null printf x=1 export printf ${HOME} readonly /usr/bin
+	done ${HOME} x=1 --verbose echo "$1"
+		"$1" /usr/bin $(pwd) test export
+		x=1 local export "$1" done echo 'quoted text'
+		x=1 cd --verbose && /usr/bin "$@"
+	&& grep printf && --verbose /usr/bin printf
+		x=1 ${HOME} 2>/dev/null "$@" x=1 local -eu $(pwd) awk "$@" echo 'quoted text'
+		$(pwd) "$1" test echo &&
+	$(pwd) grep 'quoted text'
+	2>/dev/null "$@" export --verbose 'quoted text' done
+	printf 2>/dev/null | x=1 test export sed 2>/dev/null cd --verbose | done
+		"$1" test ${HOME} 2>/dev/null "$@" x=1
+"$1" export grep cd readonly && awk test printf -eu
+$(pwd) $(pwd) && readonly "$@" local 'quoted text' echo
+$(pwd) grep grep "$1" readonly
+		"$1" "$1" --verbose "$1"
+cd /usr/bin x=1 ${HOME}
+		awk test 'quoted text' 2>/dev/null "$1"
+		/usr/bin x=1 echo 2>/dev/null $(pwd) 'quoted text' printf
+		then | $(pwd) echo test sed /usr/bin printf --verbose
+	"$@" | && printf 2>/dev/null
+	| "$@" sed && sed sed readonly /usr/bin readonly printf
+		"$1" awk test -eu 2>/dev/null cd "$@" echo sed readonly
+awk && "$@" done local
+	'quoted text' test -eu $(pwd) -eu -eu 2>/dev/null ${HOME}
+	local 'quoted text' sed 'quoted text' --verbose 2>/dev/null then
+	-eu then readonly ${HOME} | x=1 2>/dev/null "$@" ${HOME} printf awk
+	| ${HOME} && sed export $(pwd) local
+	export $(pwd) grep ${HOME}
+		2>/dev/null && then "$@" -eu done printf --verbose cd 2>/dev/null awk
+		done "$@" ${HOME} done 'quoted text' grep readonly
+		| grep 'quoted text' done && -eu echo && ${HOME} "$@" printf "$1" test
+		"$@" && "$@" echo && grep cd "$@" test grep | | printf 2>/dev/null done &&
+	&& grep --verbose ${HOME} printf test 2>/dev/null sed
+		local "$1" done export readonly | | ${HOME} && sed -eu /usr/bin echo echo
+${HOME} then echo test export sed local grep 'quoted text' "$1" printf done local
+		'quoted text' | ${HOME} ${HOME} -eu "$@" echo x=1 echo /usr/bin
+cd export grep grep x=1 2>/dev/null --verbose test | grep 'quoted text' export
+		$(pwd) awk printf /usr/bin
+	grep -eu | awk && printf sed -eu 2>/dev/null
+		grep "$@" 2>/dev/null --verbose
+		$(pwd) done awk $(pwd) --verbose cd ${HOME} /usr/bin
+cd test echo ${HOME} ${HOME} readonly cd /usr/bin cd printf && "$@" "$@"
+	then grep $(pwd) $(pwd) local echo && $(pwd)
+		test --verbose 'quoted text'
+		local 'quoted text' $(pwd) cd then x=1 && 'quoted text' export cd
+	sed /usr/bin done local grep readonly test echo export cd "$@" local export echo
+		'quoted text' grep local local 2>/dev/null --verbose printf /usr/bin
+	cd sed | "$1" awk | $(pwd)
+"$1" $(pwd) local grep $(pwd) test cd $(pwd) 'quoted text' export sed
+		| "$1" 2>/dev/null test readonly
+	$(pwd) /usr/bin grep "$1" && "$@" export "$@" 'quoted text'
+		$(pwd) /usr/bin grep cd grep local "$1" "$1" x=1 2>/dev/null awk
+local readonly echo export sed "$1" 'quoted text'
+&& grep x=1 then "$@" | "$1" export | local && sed readonly
+awk 2>/dev/null then readonly export test --verbose
+	then && /usr/bin "$@" /usr/bin "$1" awk
+	| 'quoted text' readonly
+		-eu -eu 'quoted text' cd echo --verbose export
+	local /usr/bin test 2>/dev/null | printf grep done export
+	test | --verbose ${HOME} "$1" "$1" ${HOME} local 2>/dev/null
+	export "$1" export 'quoted text' local printf "$@" printf /usr/bin ${HOME}
+/usr/bin awk | sed 'quoted text' echo sed local local export 2>/dev/null | local
+		sed -eu 'quoted text' 'quoted text' export && ${HOME}
+	awk sed $(pwd) sed 2>/dev/null printf -eu | "$1" sed /usr/bin ${HOME} ${HOME}
+		2>/dev/null /usr/bin echo
+	${HOME} export x=1 && 2>/dev/null done test 2>/dev/null cd test readonly x=1 awk
+export awk 'quoted text' grep /usr/bin readonly &&
+		| 'quoted text' "$@" && "$@" done test $(pwd) | test sed awk done --verbose cd
+		echo sed test then test readonly 'quoted text' "$@" "$@" $(pwd) cd grep
+	done printf local readonly /usr/bin $(pwd) test 'quoted text'
+x=1 $(pwd) awk echo export --verbose | export
+| done done 2>/dev/null --verbose
+	--verbose x=1 && then /usr/bin | echo ${HOME} cd x=1 --verbose && test
+		readonly "$1" /usr/bin test 'quoted text' grep
+"$@" printf "$1" /usr/bin local sed | local --verbose && "$@" test
+		| grep readonly printf then /usr/bin echo export && readonly
+	echo sed done awk readonly
+		done && grep awk readonly test "$1"
+		${HOME} printf grep "$1" test 'quoted text' sed local 2>/dev/null
+		/usr/bin $(pwd) export $(pwd) | done x=1 cd --verbose
+-eu | awk awk local printf then
+		--verbose test 2>/dev/null printf export
+	"$@" | echo test ${HOME} 'quoted text' "$@"
+	local export printf 2>/dev/null --verbose $(pwd)
+	| ${HOME} then 2>/dev/null then "$1" awk "$@" --verbose -eu printf printf
+done grep awk -eu "$1" $(pwd) local "$1" x=1 cd ${HOME}
+		"$@" 'quoted text' /usr/bin $(pwd) done awk
+	$(pwd) grep 'quoted text' ${HOME} $(pwd) --verbose
+		| cd | --verbose | cd done --verbose 2>/dev/null "$@" test x=1 readonly echo
+		| && cd done x=1 local grep
+cd echo ${HOME} done && /usr/bin "$@" && | /usr/bin 'quoted text'
+${HOME} | cd then cd
+--verbose grep local printf $(pwd)
+		&& readonly test done cd then "$1" grep awk
+	-eu --verbose grep awk "$@" echo test echo export grep /usr/bin awk
+	${HOME} $(pwd) x=1 x=1 $(pwd) then "$@" cd awk then grep | &&
+${HOME} $(pwd) 'quoted text' grep awk 2>/dev/null /usr/bin 2>/dev/null ${HOME}
+	local awk export export export
+	export x=1 && awk "$1" awk "$@" -eu ${HOME} grep 2>/dev/null export cd
+		awk && export echo "$@" 2>/dev/null && $(pwd)
+	cd grep && grep --verbose echo export 2>/dev/null &&
+		cd awk cd then -eu $(pwd) --verbose --verbose local then sed ${HOME}
+	readonly "$1" ${HOME} cd
+		echo "$1" 2>/dev/null 2>/dev/null export 'quoted text'
+done --verbose "$@" local -eu 'quoted text' /usr/bin printf
+test printf | "$@" "$1" test cd ${HOME} /usr/bin then x=1
+2>/dev/null --verbose
+	&& cd | -eu local sed local -eu
+	grep /usr/bin readonly ${HOME} cd -eu -eu $(pwd) 'quoted text' --verbose "$1"
+printf 'quoted text' 2>/dev/null
+readonly then -eu ${HOME} then x=1 $(pwd) ${HOME} 2>/dev/null
+	${HOME} ${HOME} test export cd export "$1" 'quoted text' export "$@" test --verbose
+		sed awk printf local local | x=1 cd &&
+$(pwd) sed printf test --verbose
+2>/dev/null /usr/bin --verbose echo sed x=1 printf sed && ${HOME}
+		| printf then cd local -eu && && grep
+	local done "$1" "$1" echo local test ${HOME} --verbose
+	"$1" "$1" "$@" awk x=1 -eu && --verbose printf $(pwd) "$1" -eu && 2>/dev/null
+		&& | "$@" $(pwd) "$@" 2>/dev/null
+	${HOME} export printf grep "$1" test /usr/bin test
+		x=1 export 'quoted text' cd readonly
+		local x=1 $(pwd) echo /usr/bin
+export "$1" printf -eu "$1" $(pwd)
+	test /usr/bin 2>/dev/null
+		sed then /usr/bin | "$1" then printf test echo test $(pwd) | "$1" readonly
+		"$@" && "$1" | readonly -eu | cd "$@" /usr/bin echo && "$@" $(pwd)
+		done "$1" awk grep readonly --verbose
+	test grep sed | 'quoted text' /usr/bin cd 'quoted text' $(pwd)
+	--verbose 2>/dev/null --verbose | printf "$1" cd awk 'quoted text'
+"$@" ${HOME} cd echo grep done readonly 2>/dev/null
+test 'quoted text' /usr/bin x=1
+	2>/dev/null -eu x=1 local grep && export local awk $(pwd)
+		echo 'quoted text' sed --verbose -eu printf
+		done then local /usr/bin $(pwd) ${HOME} 2>/dev/null | local 'quoted text'
+		export readonly grep cd export test
+		export local sed awk 2>/dev/null ${HOME}
+	"$1" export cd x=1 echo export
+		&& ${HOME} test then
+sed readonly x=1 "$1" cd test grep "$1" local readonly --verbose $(pwd) | local
+	"$@" -eu grep cd cd sed /usr/bin test test sed | export awk done
+sed readonly x=1 --verbose grep --verbose 'quoted text' "$1" --verbose sed "$1"
+&& /usr/bin test x=1 awk grep && export echo x=1 export local && 2>/dev/null
+-eu export 'quoted text' awk "$@" "$@" 2>/dev/null
+sed awk then then export $(pwd) then printf cd
+	printf export printf printf -eu --verbose done 2>/dev/null "$1" -eu
+	"$1" x=1 echo local "$1" x=1 local 2>/dev/null "$1" x=1 local x=1 && "$@" "$1"
+		test | "$1" $(pwd) test && printf
+'quoted text' test 'quoted text' echo then ${HOME}
+	local then $(pwd) grep grep "$1" /usr/bin test
+	readonly done x=1 && done $(pwd) --verbose 'quoted text' 'quoted text'
+	then done /usr/bin $(pwd) done local local printf
+"$@" /usr/bin x=1 sed x=1 | 2>/dev/null
+	export grep done $(pwd) test test then ${HOME} "$1" 'quoted text' "$1" printf $(pwd)
+cd "$@" --verbose printf grep 2>/dev/null sed readonly |
+	"$1" ${HOME} $(pwd) test done then grep printf | export
+cd | sed --verbose "$@" "$1"
+${HOME} export export test export && grep && echo && ${HOME} echo awk
+	/usr/bin awk grep export done | 'quoted text'
+		then && sed printf then "$@" && test echo /usr/bin export test
+		"$@" $(pwd) $(pwd) ${HOME}
+		--verbose 'quoted text' awk awk 2>/dev/null | printf printf
+	readonly readonly /usr/bin 'quoted text' local local grep test echo "$@"
+$(pwd) 'quoted text' 2>/dev/null 'quoted text'
+'quoted text' "$1" done export /usr/bin export
+	-eu echo local sed | cd 'quoted text' 'quoted text' && ${HOME} echo awk | local
+		${HOME} | x=1 then done grep ${HOME} /usr/bin test grep --verbose
+	export "$@" -eu echo "$1"
+	&& local export "$1" awk
+"$1" readonly 2>/dev/null then x=1 x=1 then sed
+		readonly ${HOME} /usr/bin echo then --verbose
+&& && $(pwd) 2>/dev/null ${HOME} then $(pwd) -eu export
+		&& printf test -eu awk x=1 'quoted text' | printf "$@" && "$@" "$1" grep
+	local && grep echo sed export then $(pwd) $(pwd) sed && grep "$@" done x=1
+		${HOME} x=1 grep ${HOME} test "$@" cd $(pwd) /usr/bin x=1 --verbose
+	${HOME} ${HOME} sed "$@" awk test cd awk "$1"
+then x=1 done export $(pwd) $(pwd) "$1" sed echo awk echo
+/usr/bin $(pwd) && readonly 'quoted text' readonly "$@" echo | 'quoted text'
+'quoted text' 2>/dev/null readonly awk readonly ${HOME} then
+	| done $(pwd) "$1" 2>/dev/null test $(pwd) cd -eu --verbose export
+		readonly | --verbose local -eu readonly local | echo done /usr/bin export
+	$(pwd) --verbose 2>/dev/null -eu -eu
+	-eu cd then done && echo cd "$1" -eu local export test echo | $(pwd)
+	$(pwd) | then awk echo "$1" "$@" /usr/bin test test "$1" "$@" | awk x=1 |
+		grep && export "$1" grep awk awk test /usr/bin
+	'quoted text' -eu test
+	sed --verbose --verbose "$1" "$1" export
+		${HOME} test $(pwd) $(pwd) 2>/dev/null sed grep x=1 | ${HOME} echo awk
+2>/dev/null 'quoted text' && echo
+	'quoted text' --verbose then
+		grep awk | "$1" grep echo $(pwd) then printf 2>/dev/null done
+		done readonly sed printf cd
+		-eu grep grep readonly awk
+	--verbose ${HOME} $(pwd) grep readonly cd done export
+	-eu readonly export sed
+--verbose /usr/bin printf
+"$@" "$@" then | test sed sed test grep printf
+		echo "$1" readonly grep && export cd $(pwd) readonly echo printf
+readonly sed 'quoted text' export then echo printf | awk printf -eu 2>/dev/null
+	&& 'quoted text' ${HOME} test 2>/dev/null cd grep /usr/bin "$@" 'quoted text'
+		awk $(pwd) printf awk printf -eu printf && readonly $(pwd) done grep
+		| grep --verbose export 'quoted text'
+	awk && "$1" "$@" x=1 /usr/bin awk -eu --verbose export $(pwd)
+echo "$1" done "$@" $(pwd) /usr/bin
+$(pwd) sed done grep /usr/bin ${HOME} local --verbose --verbose then x=1
+	/usr/bin grep sed readonly /usr/bin test | printf x=1 'quoted text' "$1"
+	&& sed 2>/dev/null && /usr/bin
+		grep $(pwd) test printf then then --verbose && x=1 then
+	-eu sed x=1 "$1" readonly "$@" $(pwd)
+		&& local readonly export | "$1" -eu printf export export
+		&& $(pwd) awk echo "$@" --verbose -eu 'quoted text' export readonly
+	readonly && grep awk cd -eu /usr/bin readonly
+printf grep export readonly printf sed then local && local
+readonly x=1 2>/dev/null echo export | 'quoted text' echo done then /usr/bin
+		2>/dev/null $(pwd) export 2>/dev/null printf --verbose x=1 x=1
+#include c179.sh
+	then sed export -eu --verbose ${HOME}
+		grep export printf && /usr/bin
+cd "$@" sed grep awk 'quoted text' "$1" readonly ${HOME} 2>/dev/null sed
+	sed 'quoted text' readonly then "$1" printf sed export sed "$@" sed echo $(pwd)
+	sed --verbose printf x=1 -eu --verbose printf then "$1" done test /usr/bin readonly
+		readonly /usr/bin && grep "$1" "$@"
+--verbose grep ${HOME} readonly | test grep 2>/dev/null readonly /usr/bin
+		done "$1" $(pwd) -eu cd then then 2>/dev/null readonly --verbose 2>/dev/null
+	--verbose $(pwd) sed | sed export echo 'quoted text'
+		/usr/bin grep sed --verbose echo --verbose then "$@" export "$@" printf test
+grep then sed done printf awk $(pwd) grep ${HOME} export "$@"
+	printf local readonly -eu cd 2>/dev/null grep && && readonly then --verbose
+x=1 /usr/bin grep then -eu "$@" x=1 'quoted text' echo
+	$(pwd) ${HOME} "$@" x=1 && 2>/dev/null
+	done x=1 cd echo export
+echo then readonly 'quoted text' -eu export ${HOME}
+	sed "$@" echo then | ${HOME} then local sed 'quoted text'
+		done --verbose then /usr/bin /usr/bin /usr/bin test x=1
+echo --verbose /usr/bin "$1" 2>/dev/null
+"$1" ${HOME} x=1 then "$1" 'quoted text' -eu ${HOME}
+printf printf -eu | && sed sed awk echo echo cd | cd export sed | --verbose
+done --verbose "$@" x=1 "$@" export $(pwd) 'quoted text' awk test
+	local local printf "$@" 'quoted text' | readonly && local $(pwd) ${HOME} 2>/dev/null
+/usr/bin grep x=1 "$1" -eu echo sed | --verbose /usr/bin then --verbose
+		then 'quoted text' x=1 | "$@" -eu local sed 'quoted text'
+| local "$1" $(pwd) export && ${HOME} 2>/dev/null
+	2>/dev/null sed && readonly readonly | "$@" --verbose && x=1 && $(pwd)
+	echo cd export 2>/dev/null then test local -eu readonly export --verbose
+test | 'quoted text' x=1
+"$1" --verbose 2>/dev/null done 2>/dev/null
+	local printf test $(pwd) $(pwd) done awk cd then
+| echo x=1 x=1 sed "$@" done sed ${HOME}
+	cd then readonly 'quoted text' then $(pwd)
+	echo && done echo done then export echo awk
+		${HOME} readonly done awk awk grep "$@" done cd echo sed ${HOME}
+	"$@" export echo x=1 /usr/bin local 'quoted text' grep readonly
+	readonly $(pwd) -eu done x=1 cd && --verbose test -eu local /usr/bin
+	$(pwd) $(pwd) export local local --verbose cd $(pwd) x=1 sed -eu ${HOME}
+then printf done && local then -eu sed $(pwd) grep && done ${HOME} -eu ${HOME}
+		cd sed /usr/bin 2>/dev/null x=1 -eu | $(pwd) /usr/bin cd test && cd &&
+		sed ${HOME} && && 2>/dev/null done test ${HOME} readonly
+	x=1 | ${HOME} 'quoted text' | ${HOME}
+readonly /usr/bin | cd local && "$1" then test printf | test 'quoted text'
+"$1" | --verbose /usr/bin printf grep
+printf printf --verbose printf 'quoted text'
+	"$1" test sed /usr/bin test local done local $(pwd) grep ${HOME} then export
+readonly test 'quoted text' grep 'quoted text' $(pwd) echo echo --verbose "$@"
+	2>/dev/null echo x=1 2>/dev/null ${HOME} local
+	| /usr/bin x=1 sed export export --verbose
+	x=1 export ${HOME} then ${HOME} 2>/dev/null && | printf export ${HOME}
+grep cd export "$1" -eu 2>/dev/null test --verbose "$1" cd
+	"$1" done grep 2>/dev/null --verbose "$@" grep 2>/dev/null printf
+		echo then /usr/bin then 2>/dev/null
+test awk --verbose done 2>/dev/null -eu $(pwd) readonly
+&& | grep test then readonly --verbose /usr/bin
+	local /usr/bin -eu sed "$@" /usr/bin echo awk 'quoted text' $(pwd) local
+--verbose awk then && 2>/dev/null --verbose 'quoted text' export export /usr/bin
+		awk "$@" "$@" done --verbose /usr/bin grep printf /usr/bin
+	readonly $(pwd) /usr/bin cd -eu 2>/dev/null /usr/bin && done
+	local x=1 && && readonly $(pwd) sed echo |
+		'quoted text' printf -eu then x=1 'quoted text' | test readonly
+		| cd "$1" test ${HOME}
+"$1" "$1" --verbose export grep printf then --verbose && 2>/dev/null
+${HOME} $(pwd) -eu export /usr/bin test sed -eu && 2>/dev/null x=1 local
+grep awk x=1 grep export -eu 2>/dev/null x=1 $(pwd) x=1 readonly /usr/bin
+		'quoted text' "$@" readonly 2>/dev/null sed awk export | export
+	awk sed && local "$1" 2>/dev/null "$1"
+		${HOME} $(pwd) x=1 grep && cd printf && "$1" cd 'quoted text'
+		&& local export grep grep awk printf && export ${HOME} $(pwd) ${HOME}
+		awk x=1 awk export test "$@" export $(pwd)
+		awk cd printf 'quoted text' /usr/bin x=1 "$@" done printf
+"$1" local awk then "$@"
+		printf done done grep printf
+		-eu export grep local printf
+	export grep "$@" 'quoted text' done -eu "$1" printf 'quoted text' "$1" then
+echo && | cd ${HOME} "$1" x=1 then local /usr/bin "$1" -eu
+		export echo grep test export -eu readonly printf then echo test
+2>/dev/null $(pwd) local
+	test then | done echo readonly cd
+	| awk awk done ${HOME} /usr/bin done "$@" then x=1 cd grep
+		2>/dev/null grep 2>/dev/null export
+readonly /usr/bin "$@" done $(pwd)
+		cd /usr/bin $(pwd) echo awk --verbose export "$@" grep && /usr/bin export printf
+		'quoted text' 2>/dev/null export cd echo cd ${HOME} done echo export $(pwd)
+echo 2>/dev/null "$@" x=1 then printf ${HOME} "$1" grep && readonly
+		awk sed done test local "$@"
+		/usr/bin | then test awk -eu
+		readonly && readonly 2>/dev/null 2>/dev/null /usr/bin && sed sed local
+${HOME} -eu $(pwd) readonly /usr/bin grep ${HOME} printf printf
+	$(pwd) echo local 'quoted text'
+		$(pwd) ${HOME} echo readonly test ${HOME} sed printf -eu grep "$1" awk done
+	| ${HOME} awk cd "$1" 'quoted text'
+		"$@" then -eu awk local local export -eu && then --verbose awk "$@" | grep awk
+		export ${HOME} "$@" -eu local /usr/bin -eu "$1" $(pwd)
+echo export done "$1" printf ${HOME} | "$1" x=1 && readonly
+	printf -eu sed "$1" && readonly &&
+	-eu /usr/bin local awk test test
+'quoted text' done -eu $(pwd) $(pwd)
+		done "$@" 2>/dev/null done done && then test -eu --verbose
+	| awk /usr/bin -eu cd export $(pwd)
+	| test local export --verbose ${HOME} local $(pwd) readonly local
+		grep cd --verbose $(pwd) then grep grep export awk done /usr/bin local
+--verbose done $(pwd) /usr/bin awk done &&
+		cd cd ${HOME} readonly "$1" | && sed test -eu printf readonly
+	sed sed cd | test --verbose export $(pwd) export printf local
+	/usr/bin then --verbose
+		$(pwd) 2>/dev/null -eu 'quoted text' cd "$@"
+		grep && printf sed && 'quoted text' readonly
+	-eu "$@" test -eu readonly x=1 ${HOME}
+	"$1" test -eu done $(pwd) sed "$1" "$@" "$@"
+	echo --verbose "$1" "$@" $(pwd) sed
+--verbose sed echo 'quoted text' && awk done "$@" -eu -eu && test then ${HOME}
+	export 2>/dev/null 'quoted text' test --verbose
+		2>/dev/null sed /usr/bin x=1 grep && echo cd cd -eu 2>/dev/null local export
+--verbose printf then "$@" "$1" -eu | export done
+		${HOME} printf printf
+	&& cd "$@" readonly && then local
+		x=1 | cd "$@" done sed "$1"
+"$1" 'quoted text' export local test "$@" "$@" grep
+-eu echo $(pwd) cd "$@" done grep echo awk cd local test 2>/dev/null
+	"$1" then awk ${HOME} --verbose echo local test
+printf x=1 2>/dev/null readonly test 2>/dev/null x=1 done "$@" export
+		$(pwd) printf --verbose local "$1"
+	local cd done printf "$1" awk | sed then $(pwd) ${HOME}
+printf test ${HOME} export $(pwd) readonly done local
+x=1 "$@" 'quoted text' 'quoted text' 'quoted text' grep ${HOME} -eu | test
+$(pwd) echo -eu cd readonly "$1" then
+		-eu && && && awk | echo sed done export ${HOME}
+	printf /usr/bin then -eu && "$@" local
+		export /usr/bin then | -eu local then 2>/dev/null
+	/usr/bin readonly cd "$@" readonly export
+	grep 2>/dev/null -eu -eu "$1" "$@" /usr/bin 'quoted text'
+"$1" grep echo $(pwd) awk "$@" readonly done awk x=1 -eu done export 2>/dev/null
+	"$@" "$@" -eu then grep -eu cd ${HOME} "$@" done 2>/dev/null echo 'quoted text'
+	'quoted text' echo grep && then | /usr/bin -eu ${HOME} /usr/bin
+	grep grep -eu local 'quoted text' x=1 then echo local $(pwd) echo
+		grep "$@" done sed local then export 'quoted text'
+		-eu $(pwd) --verbose ${HOME} then x=1 ${HOME} $(pwd) grep --verbose
+	2>/dev/null test && test ${HOME} x=1 readonly
+		awk done test --verbose grep sed export /usr/bin
+	awk test local | grep ${HOME} echo /usr/bin $(pwd) 2>/dev/null | cd test ${HOME}
+		awk -eu printf done export awk -eu
+echo x=1 2>/dev/null done -eu 2>/dev/null "$@" readonly export 2>/dev/null
+		export awk 'quoted text' x=1 sed test 2>/dev/null export
+readonly "$@" cd grep --verbose 'quoted text' --verbose sed --verbose local &&
+$(pwd) local echo cd ${HOME} x=1 printf awk x=1 x=1 grep test
+	/usr/bin readonly echo grep test awk $(pwd) /usr/bin
+		grep echo awk -eu local --verbose printf x=1 "$1" done done "$1" local
+		test readonly -eu "$1" readonly 'quoted text'
+		$(pwd) test 2>/dev/null export
+grep readonly sed ${HOME}
+	grep sed -eu 'quoted text' /usr/bin readonly
+	grep 'quoted text' readonly -eu echo --verbose awk --verbose
+	/usr/bin cd | printf 2>/dev/null grep awk
+		2>/dev/null /usr/bin done ${HOME} then "$1" readonly
+$(pwd) local | test readonly ${HOME} sed echo "$1" printf | ${HOME}
+	"$1" export && grep | 2>/dev/null
+	&& export readonly local test done echo ${HOME}
+echo /usr/bin /usr/bin cd $(pwd) done cd $(pwd) /usr/bin echo readonly
+x=1 test --verbose readonly readonly
+	export readonly done cd --verbose
+		${HOME} x=1 done 2>/dev/null echo
+	printf awk ${HOME} $(pwd) $(pwd) "$@" x=1 --verbose
+local done x=1 test /usr/bin $(pwd)
+x=1 echo awk export /usr/bin "$@" then awk && $(pwd)
+		echo /usr/bin sed $(pwd) ${HOME}
+'quoted text' 2>/dev/null 2>/dev/null "$1" printf cd "$1" "$1" ${HOME} | awk
+local readonly then cd /usr/bin
+	/usr/bin $(pwd) done | && -eu "$1" sed 2>/dev/null local -eu grep export
+		local --verbose test 'quoted text' readonly $(pwd) done readonly
+	test printf --verbose -eu /usr/bin x=1 readonly 'quoted text' then local
+		test --verbose "$@" -eu readonly
+		printf && | "$1" echo
+	$(pwd) 2>/dev/null "$@" then /usr/bin sed 2>/dev/null awk export "$@"
+		&& awk $(pwd) printf test -eu test readonly printf && export && printf /usr/bin
+	test --verbose grep /usr/bin cd -eu local echo test x=1 --verbose && -eu cd
+	sed -eu done && grep echo grep then printf readonly 'quoted text' done export
+echo x=1 printf && && readonly 2>/dev/null
+		/usr/bin awk -eu --verbose "$1" awk | test x=1 then
+		readonly printf sed "$@" grep "$1" then echo && ${HOME} $(pwd) "$@"
+	--verbose | $(pwd) | 2>/dev/null -eu echo 'quoted text' readonly --verbose $(pwd)
+		echo local echo ${HOME} "$1"
+	awk 2>/dev/null | grep -eu $(pwd) $(pwd) cd && sed $(pwd) done awk $(pwd)
+		${HOME} $(pwd) grep x=1 export grep &&
+	$(pwd) test cd 2>/dev/null local printf && printf
+x=1 then local | /usr/bin done -eu /usr/bin
+		'quoted text' -eu x=1 test echo -eu test cd --verbose
+		grep printf then sed test --verbose echo /usr/bin | echo sed
+		export -eu printf awk export export "$1" grep grep | local
+		done done && local test local test sed sed x=1 | cd $(pwd) ${HOME}
+	/usr/bin x=1 grep 'quoted text' x=1 printf
+		'quoted text' --verbose export then
+export local "$1" && grep echo
+		--verbose --verbose done then /usr/bin
+$(pwd) export readonly
+		"$@" $(pwd) cd /usr/bin readonly $(pwd) "$1" readonly printf awk -eu readonly
+	test readonly -eu export echo echo 'quoted text' x=1 -eu
+		awk ${HOME} test readonly grep "$@" | echo
+	"$@" cd done /usr/bin 2>/dev/null local 'quoted text' printf
+2>/dev/null --verbose 'quoted text' then
+	-eu done /usr/bin grep export sed x=1 cd sed /usr/bin
+		'quoted text' echo --verbose echo $(pwd) x=1 2>/dev/null ${HOME} | readonly
+		then echo test 2>/dev/null export x=1 ${HOME} grep awk export
+		${HOME} sed test grep sed 2>/dev/null
+		local 2>/dev/null /usr/bin ${HOME} "$1" awk -eu $(pwd) awk
+	done test "$1" ${HOME} then 'quoted text'
+		local awk awk sed x=1 x=1 "$1" /usr/bin && cd ${HOME} then "$1" printf
+		| then /usr/bin grep grep test "$@" x=1 'quoted text'
+	echo "$1" /usr/bin export -eu -eu printf
+echo --verbose "$@" readonly $(pwd) printf test awk test export awk
+	grep 2>/dev/null "$@" echo "$@" echo awk local echo export
+2>/dev/null echo done echo ${HOME}
+		grep local sed test sed
+		readonly sed x=1 cd test test ${HOME}
+	${HOME} printf | x=1 export 'quoted text' | "$@" -eu x=1 then test
+	$(pwd) | /usr/bin "$1" done ${HOME} "$1"
+		then export grep 'quoted text' -eu then -eu then
+grep 2>/dev/null readonly readonly grep export printf export $(pwd) "$@" then
+		done grep awk cd cd --verbose
+done "$@" --verbose x=1 && && ${HOME}
+	| readonly test "$@" --verbose && readonly
+	| 2>/dev/null "$@" cd
+	2>/dev/null x=1 /usr/bin $(pwd) $(pwd) readonly local done test printf echo
+		printf ${HOME} ${HOME} ${HOME}
+grep | then then | sed --verbose --verbose
+	2>/dev/null x=1 | readonly --verbose export printf 'quoted text'
+		readonly grep | printf readonly cd echo done done | -eu --verbose /usr/bin
+'quoted text' done 2>/dev/null printf local test test sed readonly export
+cd grep 'quoted text' 2>/dev/null "$@"
+	export grep local --verbose | ${HOME} /usr/bin
+		-eu echo --verbose | /usr/bin x=1 | $(pwd)
+	printf --verbose cd awk --verbose "$1" sed sed $(pwd)
+readonly "$1" -eu | sed printf | export "$1"
+	grep then $(pwd) /usr/bin --verbose
+/usr/bin /usr/bin test -eu
+printf test --verbose --verbose
+		awk "$@" sed && awk cd test then echo /usr/bin "$1"
+x=1 $(pwd) "$@" printf
+local echo | && --verbose $(pwd) 'quoted text'
+done test grep done grep then ${HOME} && --verbose done
+	awk 2>/dev/null echo done | "$1"
+		| "$@" done --verbose x=1 printf
+	| export printf export && 2>/dev/null && export local
+	| ${HOME} sed then echo
+printf | export ${HOME} && local 2>/dev/null awk -eu "$@" /usr/bin
+-eu $(pwd) "$@" then sed
+	local sed -eu "$@" | x=1 "$1" | readonly echo printf /usr/bin awk then then
+then echo 'quoted text' sed ${HOME} local
+		"$1" "$@" $(pwd) then readonly x=1 ${HOME} && 'quoted text' readonly readonly
+		then done export && awk && echo then 2>/dev/null "$1" x=1 "$@" sed && 'quoted text'
+	grep then grep grep --verbose
+${HOME} printf "$1" echo echo ${HOME} awk -eu /usr/bin 'quoted text'
+	--verbose "$@" test local "$@" then
+&& grep && && /usr/bin /usr/bin readonly local echo $(pwd) then echo echo
+$(pwd) && cd "$1" then ${HOME} echo test export && --verbose "$@" $(pwd) cd
+| printf then && "$1" echo sed $(pwd)
+| ${HOME} grep ${HOME} export -eu readonly awk x=1 --verbose printf -eu
+	"$1" --verbose /usr/bin readonly done ${HOME} awk 'quoted text'
+| "$1" && /usr/bin test --verbose ${HOME} readonly
+${HOME} $(pwd) "$@" -eu | cd grep local done export /usr/bin $(pwd)
+		/usr/bin 'quoted text' test ${HOME} awk readonly 2>/dev/null $(pwd)
+	x=1 | /usr/bin done local then --verbose
+	x=1 export 2>/dev/null printf 2>/dev/null then printf
+	local test then "$@" awk echo | cd cd echo "$@" "$1"
+		$(pwd) | 2>/dev/null 'quoted text' done local
+readonly test sed awk /usr/bin grep "$@" /usr/bin ${HOME} printf -eu
+		'quoted text' readonly --verbose $(pwd) echo awk "$1" $(pwd) 'quoted text'
+-eu $(pwd) ${HOME} export local then then printf
+		awk done | echo test | done echo x=1 -eu $(pwd)
+-eu "$1" 'quoted text' /usr/bin test done test grep --verbose $(pwd) |
+	'quoted text' 'quoted text' local "$@" then --verbose 'quoted text'
+	local then cd readonly -eu ${HOME}
+		done cd readonly 'quoted text' -eu then 'quoted text' local 'quoted text'
+		'quoted text' grep x=1 grep grep export
+		then grep cd readonly $(pwd) $(pwd) && echo /usr/bin
+local test $(pwd) test | ${HOME} x=1 | export grep
+	x=1 export test printf $(pwd) -eu | cd local sed export 'quoted text'
+	-eu && | /usr/bin awk "$1" cd | "$1" 'quoted text' 2>/dev/null -eu
+done x=1 echo "$1" grep awk export
+		local ${HOME} test -eu then
+${HOME} 'quoted text' cd awk readonly then awk x=1 $(pwd) $(pwd)
+		"$@" ${HOME} export $(pwd) 'quoted text' $(pwd) local awk then awk --verbose readonly
+		cd printf then /usr/bin local
+local 2>/dev/null test done then readonly -eu ${HOME} x=1
+"$@" done export readonly x=1 awk export echo echo "$1" printf | -eu sed
+then sed && 2>/dev/null | readonly printf |
+		"$1" ${HOME} grep /usr/bin ${HOME}
+		printf --verbose readonly echo "$@" readonly | ${HOME} export
+		echo grep "$1" "$1" -eu echo /usr/bin readonly printf local
+done export 2>/dev/null $(pwd) grep $(pwd) grep awk -eu test then done done
+"$1" 'quoted text' then echo
+	export -eu export 2>/dev/null 2>/dev/null x=1 cd x=1 | export sed local then
+	echo x=1 cd then sed echo x=1 done grep 2>/dev/null /usr/bin
+		&& && | readonly awk cd awk export done x=1 export local "$1" sed 2>/dev/null local
+cd --verbose 'quoted text' "$1" awk $(pwd) x=1 cd
+--verbose test $(pwd) --verbose -eu sed printf done "$1" | |
+		"$1" /usr/bin sed "$1" ${HOME} /usr/bin grep
+	local "$@" grep done x=1 | done then
+-eu $(pwd) test cd awk "$1" awk awk && "$1" 2>/dev/null
+	export | "$@" printf sed && echo x=1
+'quoted text' -eu ${HOME} $(pwd) grep -eu
+		awk /usr/bin echo | $(pwd) printf grep test echo && $(pwd) printf
+	local /usr/bin ${HOME} printf $(pwd) | grep sed "$1" then cd
+2>/dev/null -eu awk /usr/bin grep test done --verbose 2>/dev/null sed
+	cd -eu -eu readonly ${HOME}
+		$(pwd) then "$1" --verbose | echo local awk && test test
+		${HOME} printf test -eu grep
+		awk "$@" "$@" echo printf $(pwd) done
+		readonly test awk 2>/dev/null readonly 'quoted text'
+		readonly --verbose | -eu 2>/dev/null ${HOME} readonly then ${HOME} x=1
+/usr/bin $(pwd) "$1" done printf local 'quoted text' "$1" printf && 'quoted text'
+sed echo readonly ${HOME} 'quoted text' echo
+		--verbose && local test then x=1 cd grep | "$@" x=1
+-eu grep x=1 2>/dev/null sed -eu &&
+--verbose | readonly then test --verbose | cd ${HOME} x=1 -eu && awk
+		| sed echo readonly then local sed export -eu export
+	-eu cd -eu done sed x=1 cd | printf 'quoted text'
+--verbose | echo x=1 echo &&
+	"$@" && 2>/dev/null readonly
+		local cd | ${HOME} export export | ${HOME} | -eu ${HOME} "$1" /usr/bin test &&
+	awk "$1" x=1 $(pwd) -eu --verbose "$@" -eu
+then -eu "$1" test ${HOME} readonly "$@" $(pwd)
+	"$1" readonly printf | export /usr/bin grep -eu printf ${HOME} sed
+	&& grep then && 2>/dev/null sed done "$1" --verbose
+	'quoted text' && 2>/dev/null $(pwd) | && echo export
+		| cd | ${HOME} x=1 local readonly grep | --verbose 'quoted text'
+	sed 'quoted text' export -eu "$1" "$1" export
+		export -eu "$1" sed grep printf readonly $(pwd) "$1" test export && 'quoted text'
+		${HOME} sed then /usr/bin "$@" | /usr/bin -eu sed 'quoted text' cd sed |
+printf printf then && ${HOME} export awk test
+		${HOME} /usr/bin export 'quoted text' 'quoted text' cd ${HOME} x=1 done
+	/usr/bin -eu --verbose && awk sed /usr/bin done grep sed awk /usr/bin "$@" then
+	sed readonly cd && awk printf test -eu ${HOME} && printf test /usr/bin
+	printf printf grep export | then "$1" 'quoted text' grep &&
+done printf test printf grep grep cd /usr/bin && ${HOME} grep | done ${HOME}
+		"$1" local --verbose && $(pwd) 'quoted text'
+	"$@" printf 'quoted text' | grep ${HOME} "$1"
+	done printf grep "$@" grep readonly
+		done /usr/bin printf cd
+$(pwd) && done awk echo --verbose then sed cd "$@" | 2>/dev/null 'quoted text'
+"$@" done awk printf "$@"
+		export | ${HOME} "$@" awk done echo cd 2>/dev/null
+		readonly test echo $(pwd) cd test --verbose test x=1 --verbose | "$1" awk /usr/bin
+	2>/dev/null printf /usr/bin --verbose printf sed cd grep --verbose ${HOME}
+		"$@" /usr/bin grep echo $(pwd) echo && readonly echo then | ${HOME}
+		$(pwd) ${HOME} "$1" | printf 2>/dev/null ${HOME}
+	"$1" printf | sed cd /usr/bin awk printf printf echo
+2>/dev/null done -eu /usr/bin
+grep ${HOME} local echo then | 2>/dev/null
+	"$@" sed readonly local readonly ${HOME} then ${HOME}
+		&& cd 2>/dev/null grep done --verbose 2>/dev/null ${HOME} 2>/dev/null
+	echo "$1" grep "$1" awk awk
+	/usr/bin "$@" | export echo $(pwd) export | printf 2>/dev/null
+		&& "$@" awk 2>/dev/null -eu then echo x=1 $(pwd) ${HOME}
+awk x=1 export x=1 printf /usr/bin export 2>/dev/null &&
+		export export x=1 "$@" ${HOME} export export 2>/dev/null then && --verbose
+		${HOME} printf local ${HOME} export && "$@" export 'quoted text'
+printf test $(pwd) done grep 2>/dev/null
+		echo done printf "$1" readonly -eu && done printf $(pwd) test
+		--verbose export "$1" grep && readonly "$@" awk readonly
+test "$@" done grep x=1 "$1" 2>/dev/null then -eu 'quoted text' cd --verbose export
+		x=1 ${HOME} local | done "$1" /usr/bin
+echo export cd 2>/dev/null $(pwd) printf sed awk $(pwd) local echo echo
+	&& 2>/dev/null echo printf grep --verbose
+		printf then then done x=1 $(pwd) test cd export
+	'quoted text' /usr/bin ${HOME} 'quoted text'
+sed grep cd 'quoted text' -eu "$1" && x=1 awk done local grep cd done done
+		"$@" grep --verbose && ${HOME} "$@" done local $(pwd) x=1 /usr/bin export
+local local done 'quoted text' readonly && | /usr/bin
+	--verbose /usr/bin "$1" /usr/bin export readonly /usr/bin
+		grep $(pwd) readonly sed awk && sed echo then grep &&
+	${HOME} done cd $(pwd) /usr/bin export test awk "$@" /usr/bin $(pwd) awk
+		x=1 && --verbose local && $(pwd) ${HOME} awk done test x=1 local 'quoted text'
+		"$1" grep done awk readonly x=1 grep && $(pwd)
+	sed x=1 awk local -eu 2>/dev/null $(pwd) ${HOME} x=1
+'quoted text' /usr/bin cd 'quoted text' local cd x=1 && cd done $(pwd)
+		local ${HOME} x=1 "$1" $(pwd) done awk done test done
+		then 'quoted text' 'quoted text' done ${HOME} local local then then 2>/dev/null
+then then 'quoted text' export
+cd sed $(pwd) awk /usr/bin
+	-eu sed 2>/dev/null test
+cd printf awk | /usr/bin 2>/dev/null
+	$(pwd) grep echo 2>/dev/null ${HOME}
+2>/dev/null -eu "$1" export
+grep echo then grep sed
+export "$1" grep cd readonly awk sed && 'quoted text' done cd ${HOME} local 'quoted text'
+		local readonly 'quoted text' 2>/dev/null cd export
+		done | local local 'quoted text' "$1"
+	echo --verbose x=1 'quoted text' readonly grep test test readonly awk
+	cd $(pwd) -eu $(pwd) | awk --verbose 2>/dev/null -eu done "$@"
+export grep awk ${HOME} "$1" printf $(pwd) export test "$@" && x=1 --verbose done
+	local done x=1 grep then x=1 "$1" -eu $(pwd) awk
+	grep printf export test export --verbose sed grep "$1" sed ${HOME} --verbose
+		awk printf printf grep $(pwd)
+2>/dev/null cd then cd export grep export /usr/bin cd cd readonly done
+		'quoted text' echo "$1" "$1" 'quoted text' then readonly $(pwd) grep
+	export sed echo 'quoted text' ${HOME} awk grep x=1
+	test /usr/bin printf sed echo
+		-eu && -eu cd grep done sed && /usr/bin x=1 sed test echo echo /usr/bin && awk
+		cd $(pwd) ${HOME} done awk $(pwd) grep $(pwd) $(pwd) export grep 'quoted text'
+		done x=1 local cd --verbose printf grep cd x=1
+		"$@" local 2>/dev/null -eu done --verbose
+local "$1" readonly printf "$@" printf && 2>/dev/null local
+done /usr/bin echo export
+		"$1" --verbose -eu then x=1 awk 'quoted text'
+${HOME} && echo export cd 2>/dev/null "$1" sed sed ${HOME} /usr/bin local "$1"
+		| ${HOME} then export local sed x=1 awk echo local
+x=1 done 2>/dev/null sed cd && echo x=1
+		awk awk printf echo export printf "$@" ${HOME} /usr/bin export local cd echo
+		local | 2>/dev/null export "$1" ${HOME} done awk
+&& test 'quoted text' && echo x=1 $(pwd)
+local sed echo 'quoted text'
+		printf 2>/dev/null grep -eu
+		awk then sed test $(pwd) cd cd $(pwd)
+	printf | | $(pwd) 'quoted text' 'quoted text'
+		awk /usr/bin cd -eu done 'quoted text' | $(pwd)
+	cd "$1" printf readonly && 'quoted text' awk cd readonly then export
+done done sed | "$1" 'quoted text' then | local
+		printf printf x=1 cd printf grep
+	echo "$@" --verbose --verbose 2>/dev/null $(pwd) printf 2>/dev/null
+--verbose printf "$@" export -eu test "$1" x=1
+awk export readonly 2>/dev/null awk /usr/bin -eu sed ${HOME}
+		sed 'quoted text' echo readonly
+then 2>/dev/null then -eu readonly done printf test done test
+	local 'quoted text' && grep printf 2>/dev/null /usr/bin
+${HOME} ${HOME} printf then -eu
+		test cd /usr/bin 'quoted text'
+	--verbose done done /usr/bin
+awk printf printf test | awk readonly done test then | /usr/bin cd 'quoted text'
+		/usr/bin "$@" 'quoted text' --verbose sed readonly ${HOME} export
+		${HOME} x=1 -eu 2>/dev/null grep "$1" 'quoted text'
+		awk grep 'quoted text' then
+		&& -eu 'quoted text' done 2>/dev/null cd x=1 /usr/bin grep local done ${HOME}
+readonly "$@" $(pwd) test /usr/bin then -eu grep
+echo echo /usr/bin "$@" -eu $(pwd) awk $(pwd) awk readonly
+awk export 2>/dev/null && "$@" 'quoted text' ${HOME} "$1" readonly
+	echo x=1 | 'quoted text' --verbose /usr/bin done /usr/bin sed $(pwd)
+	grep export export test export test printf 2>/dev/null echo readonly "$1" sed
+	"$@" readonly echo --verbose then then 2>/dev/null 'quoted text' $(pwd) local
+	-eu done --verbose grep echo then grep | cd done done $(pwd)
+		-eu then x=1 readonly | done "$@" readonly "$1"
+	&& ${HOME} export && printf | awk
+	${HOME} ${HOME} "$1" echo /usr/bin x=1 then test printf cd --verbose "$@"
+		&& then "$1" ${HOME} ${HOME} -eu 2>/dev/null export cd
+"$@" local 2>/dev/null test "$@" &&
+		readonly printf export printf && "$@" echo | printf printf test local export
+		readonly -eu export $(pwd) | sed -eu grep cd export 2>/dev/null -eu then
+	2>/dev/null awk sed awk sed then local "$1" && then export
+		${HOME} ${HOME} 2>/dev/null then && "$@" -eu --verbose export awk
+		readonly 2>/dev/null /usr/bin local && done ${HOME} 'quoted text' "$@" x=1 -eu cd
+	"$@" then then ${HOME} awk cd |
+		grep ${HOME} && local 'quoted text' awk "$@" readonly
+		'quoted text' grep printf echo
+		sed awk x=1 $(pwd) "$1"
+-eu --verbose | /usr/bin
+export 2>/dev/null cd -eu "$1" printf /usr/bin grep export "$1" -eu
+then "$@" export echo | test local --verbose
+--verbose 2>/dev/null && | ${HOME} local "$@"
+		2>/dev/null 'quoted text' echo grep x=1 local printf sed grep printf
+	awk readonly | 'quoted text' export
+grep sed x=1 /usr/bin "$1" awk x=1 ${HOME} cd echo $(pwd) awk -eu --verbose
+		| /usr/bin awk 'quoted text'
+	awk done | test export --verbose
+		$(pwd) readonly | "$@" --verbose printf /usr/bin "$1" export
+	test test "$1" --verbose echo echo
+		echo 2>/dev/null grep echo && echo && sed $(pwd) local
+	| sed ${HOME} -eu | 'quoted text' echo echo
+		sed "$1" x=1 "$@" test readonly
+&& --verbose awk local "$@" echo sed --verbose
+	printf export "$@" 2>/dev/null printf local echo cd /usr/bin
+	"$@" then | x=1 | ${HOME} printf 'quoted text'
+		printf printf $(pwd) done echo "$1" 2>/dev/null x=1 && x=1
+		$(pwd) | "$@" sed --verbose 2>/dev/null printf "$@" ${HOME} $(pwd)
+		local done $(pwd) /usr/bin 'quoted text' x=1
+	$(pwd) /usr/bin ${HOME} export readonly x=1 /usr/bin --verbose -eu
+		-eu ${HOME} | sed then done x=1 "$@" --verbose export local cd sed readonly
+	2>/dev/null printf readonly 2>/dev/null awk x=1 awk "$@" done /usr/bin
+	"$@" test "$@" echo sed cd done "$@" "$@" --verbose grep local
+		'quoted text' grep "$1" && echo /usr/bin test
+	printf $(pwd) | ${HOME} &&
+		printf $(pwd) echo 2>/dev/null local printf export test &&
+	$(pwd) printf ${HOME} grep readonly test /usr/bin printf sed printf | echo /usr/bin
+		--verbose done printf then $(pwd) export 'quoted text'
+grep --verbose export done /usr/bin test done
+'quoted text' grep export ${HOME} local sed export printf
+readonly && 'quoted text' 2>/dev/null 'quoted text' x=1 -eu
+	x=1 2>/dev/null then "$@" done x=1 --verbose x=1 sed awk "$@" readonly awk
+	readonly test then echo local local done test then | "$1"
+		export --verbose && export done && && 2>/dev/null 'quoted text' "$@" sed $(pwd)
+	then sed x=1 echo local "$1" sed grep "$1" grep "$1" test "$1"
+grep cd $(pwd) test done done export
+	2>/dev/null && ${HOME} "$@" --verbose ${HOME} then local
+	$(pwd) && x=1 && printf "$@" sed -eu readonly
+		awk cd test printf local --verbose readonly awk test x=1
+	x=1 /usr/bin then readonly awk test export local "$@" |
+	--verbose --verbose awk local ${HOME} test grep then test "$1"
+		'quoted text' sed grep local cd sed 'quoted text' | && "$1" --verbose
+--verbose /usr/bin && echo
+		then ${HOME} cd -eu sed
+		-eu --verbose sed "$@" printf sed test --verbose readonly
+	$(pwd) sed x=1 cd | x=1 grep test awk then $(pwd) grep 'quoted text'
+	&& | --verbose /usr/bin && "$1" readonly | awk
+	sed "$@" awk /usr/bin sed 2>/dev/null ${HOME} done then test done cd /usr/bin
+		${HOME} "$@" 'quoted text' --verbose export echo ${HOME} x=1 "$1" && --verbose
+readonly /usr/bin 2>/dev/null && export done cd --verbose 2>/dev/null "$@"
+test grep test readonly export /usr/bin 2>/dev/null | sed "$1" grep readonly
+	grep readonly sed -eu done export | "$@" then readonly export -eu
+'quoted text' && $(pwd) test awk 'quoted text' export
+		done && done /usr/bin ${HOME}
+	'quoted text' | "$@" x=1 ${HOME} printf $(pwd) local -eu
+'quoted text' /usr/bin grep grep done
+		local then /usr/bin cd "$@" done "$1" awk then --verbose
+		grep 'quoted text' local x=1 grep test printf then then /usr/bin done export
+2>/dev/null | "$1" echo
+| local printf then ${HOME}
+		| 2>/dev/null 2>/dev/null printf done --verbose export test
+		cd grep | && "$1" cd --verbose
+	"$@" 2>/dev/null grep test
+'quoted text' echo cd "$@" printf then printf $(pwd) -eu done &&
+	| printf "$1" printf awk test awk "$@" test 'quoted text' awk
+	grep $(pwd) printf ${HOME} export $(pwd) "$1" done grep /usr/bin printf echo
+	echo --verbose | $(pwd)
+		grep done && /usr/bin ${HOME}
+		export grep x=1 printf "$@" $(pwd) printf "$@" x=1 x=1
+awk x=1 --verbose x=1 export | | x=1 then && --verbose /usr/bin
+		"$1" sed 2>/dev/null 'quoted text' awk readonly printf readonly awk
+then local -eu echo -eu /usr/bin echo "$@" done 'quoted text'
+	echo $(pwd) test local local ${HOME} | &&
+		export grep 2>/dev/null 'quoted text' $(pwd) awk "$1"
+		then 2>/dev/null test $(pwd) then local --verbose cd
+cd -eu --verbose echo -eu 2>/dev/null then cd "$@" printf
+	x=1 ${HOME} "$@" grep awk 'quoted text'
+x=1 "$@" cd cd cd grep 2>/dev/null
+		"$@" | cd awk grep printf
+		readonly && | 'quoted text' local /usr/bin
+	local then --verbose | awk printf readonly
+	done ${HOME} 'quoted text' awk | then x=1 test readonly
+		local -eu /usr/bin 2>/dev/null "$@" | sed test 2>/dev/null && && x=1 grep export
+--verbose 'quoted text' 'quoted text' x=1 'quoted text'
+		2>/dev/null awk ${HOME} --verbose /usr/bin test test ${HOME} $(pwd)
+	${HOME} /usr/bin export 'quoted text' "$1"
+-eu /usr/bin grep readonly readonly --verbose grep printf
+	$(pwd) printf x=1 2>/dev/null | grep grep ${HOME} ${HOME} $(pwd) 2>/dev/null
+export -eu "$1" 'quoted text' cd /usr/bin echo 2>/dev/null
+		awk && 2>/dev/null local sed x=1 export
+		x=1 cd local cd --verbose local "$@" sed "$1" then export local 2>/dev/null ${HOME}
+done then "$@" 'quoted text' done "$@" test "$1" test test ${HOME}
+export /usr/bin local readonly
+--verbose ${HOME} done ${HOME} -eu "$1" readonly
+		-eu --verbose then 2>/dev/null
+	'quoted text' done $(pwd) printf ${HOME} --verbose done 'quoted text'
+test "$@" then then && "$@"
+local | grep --verbose | readonly
+| export then | $(pwd) ${HOME} then then local export cd
+	cd grep echo then awk "$@" "$@" | --verbose printf
+	sed readonly cd ${HOME} "$@" then
+		then ${HOME} grep 2>/dev/null ${HOME} printf
+x=1 then printf "$@" $(pwd) $(pwd)
+sed export readonly cd readonly export awk
+	export cd cd local sed 2>/dev/null ${HOME} local
+readonly /usr/bin echo ${HOME} echo
+sed /usr/bin --verbose export /usr/bin export ${HOME} export "$@" "$1" printf
+		x=1 test cd $(pwd) "$@" then readonly $(pwd) readonly
+		awk "$1" ${HOME} ${HOME} --verbose
+		grep awk awk grep export "$1"
+awk grep sed | awk 'quoted text' ${HOME} done
+cd -eu && 'quoted text' cd "$@" export --verbose | readonly 'quoted text'
+		--verbose ${HOME} -eu grep done export | && printf
+	"$@" sed /usr/bin printf local ${HOME}
+		readonly then export awk printf grep -eu test export local
+		-eu awk "$@" echo readonly
+echo $(pwd) awk printf x=1 2>/dev/null readonly 'quoted text' "$@" awk grep export
+		-eu test done test echo -eu /usr/bin /usr/bin 'quoted text'
+		-eu x=1 printf awk done then cd echo awk grep
+grep sed then && | x=1 --verbose 'quoted text'
+		grep grep export sed
+		"$@" printf echo 'quoted text'
+		then printf $(pwd) 'quoted text'
+done | then export -eu test x=1 "$1" readonly done | "$1"
+	&& local printf x=1 -eu grep then echo awk local 2>/dev/null -eu
+		then echo -eu --verbose && --verbose cd readonly
+	$(pwd) grep printf sed "$@" echo done awk --verbose
+	printf -eu local --verbose 'quoted text' 'quoted text' 2>/dev/null
+	grep 2>/dev/null done "$@" "$@" 'quoted text' sed readonly test
+&& "$1" sed export "$1" 2>/dev/null awk echo then
+	| test | echo then 2>/dev/null cd sed
+		"$@" done local ${HOME} 'quoted text' ${HOME} readonly export ${HOME}
+		then 'quoted text' grep | && awk --verbose readonly $(pwd) | cd 2>/dev/null
+		test readonly 2>/dev/null | grep 'quoted text' test
+-eu x=1 sed $(pwd) /usr/bin -eu /usr/bin export cd readonly "$@" export test
+	x=1 done then export sed done printf echo 'quoted text' && && | readonly local
+/usr/bin grep then --verbose $(pwd) "$1" test && echo done
+	x=1 /usr/bin done readonly local
+		"$1" export readonly local 2>/dev/null $(pwd) $(pwd)
+| "$1" readonly done echo test
+	echo -eu $(pwd) x=1 2>/dev/null printf "$1" printf test $(pwd) /usr/bin
+sed echo grep printf $(pwd) "$1" 2>/dev/null local $(pwd)
+	export $(pwd) $(pwd) printf printf "$@" x=1 awk echo /usr/bin printf cd test
+		$(pwd) readonly ${HOME} ${HOME}
+		test export cd 2>/dev/null
+export export awk | 'quoted text' sed local | "$1" "$1"
+		test test export test -eu echo
+sed sed done /usr/bin echo "$@" "$1" /usr/bin export
+"$@" $(pwd) printf && "$@" export | awk done export
+	'quoted text' then | $(pwd) local 'quoted text'
+	x=1 ${HOME} sed readonly echo 'quoted text' && cd grep done 2>/dev/null
+	2>/dev/null --verbose export done done | x=1
+2>/dev/null "$@" awk then "$@" awk 2>/dev/null
+	-eu sed grep 'quoted text'
+export ${HOME} 'quoted text' -eu 2>/dev/null
+	${HOME} --verbose 2>/dev/null
+	cd && local 'quoted text'
+awk then test | then readonly
+	$(pwd) x=1 test 'quoted text' ${HOME}
+done done x=1 local "$1" 2>/dev/null printf printf ${HOME} $(pwd) local
+		| x=1 -eu done then "$@" 2>/dev/null echo awk | export test -eu "$@"
+export x=1 ${HOME} test export readonly echo x=1 'quoted text' $(pwd)
+		${HOME} readonly && /usr/bin | export echo
+		local 'quoted text' | --verbose test && "$1" awk done -eu $(pwd) awk
+	cd "$1" export awk | "$1" 2>/dev/null "$@" then 'quoted text'
+"$@" grep | --verbose ${HOME} test &&
+		readonly echo cd cd "$1" "$@" test ${HOME} $(pwd) --verbose
+$(pwd) done awk -eu sed local local "$1" "$1" && export
+		"$@" done x=1 readonly 2>/dev/null
+&& x=1 grep readonly x=1 x=1 cd printf then
+		'quoted text' export "$@" readonly
+&& ${HOME} export --verbose printf | $(pwd) 2>/dev/null $(pwd) readonly
+	cd then readonly "$@" /usr/bin
+	export 'quoted text' cd local echo then printf cd test $(pwd)
+/usr/bin && ${HOME} 'quoted text' 'quoted text' export
+	"$1" printf cd sed "$@" && readonly then readonly "$@" "$@" echo sed
+$(pwd) x=1 | sed sed echo 2>/dev/null done "$@"
+	grep sed 'quoted text' done local --verbose
+		--verbose grep "$1" x=1 export done sed then --verbose grep &&
+		x=1 /usr/bin export printf echo | "$1" --verbose
+sed awk awk then -eu done
+printf "$1" "$1" "$1" readonly
+		test then echo then local sed export then grep printf "$1" | local "$1"
+then readonly echo 2>/dev/null --verbose
+		test then then -eu echo "$@" local
+"$@" && | x=1 'quoted text' --verbose
+	local -eu 'quoted text'
+	/usr/bin export $(pwd) | done printf "$@" then
+		"$1" awk -eu grep 2>/dev/null
+/usr/bin sed echo 2>/dev/null 'quoted text' $(pwd) -eu x=1
+${HOME} cd | grep 2>/dev/null awk grep awk awk cd test echo ${HOME}
+		--verbose then local export x=1 cd readonly "$1"
+		| $(pwd) --verbose test 2>/dev/null
+		awk readonly | awk 2>/dev/null local grep 'quoted text'
+		awk grep "$@" --verbose done sed done | | ${HOME} /usr/bin "$@" $(pwd) awk -eu
+		$(pwd) "$@" grep local /usr/bin echo done "$@" echo x=1 x=1 printf sed
+	echo awk export cd && local sed local echo
+	/usr/bin | export 2>/dev/null "$1" grep 2>/dev/null
+then sed printf awk x=1 export local 2>/dev/null 2>/dev/null
+	awk sed cd grep sed awk "$@" awk printf $(pwd) $(pwd)
+	"$1" export "$@" grep /usr/bin --verbose
+		sed local done && awk /usr/bin cd then
+	printf 'quoted text' x=1 2>/dev/null && done local sed -eu awk x=1 echo ${HOME}
+	printf done 2>/dev/null $(pwd) printf local local x=1 x=1 cd 'quoted text' echo
+		${HOME} local 2>/dev/null local grep local
+&& then echo $(pwd) done -eu "$1" | x=1 $(pwd) grep $(pwd)
+	--verbose test | $(pwd) printf
+	| 2>/dev/null printf done | --verbose && echo done "$1" sed done /usr/bin --verbose
+	$(pwd) 2>/dev/null "$1" cd $(pwd)
+		'quoted text' ${HOME} export
+		2>/dev/null readonly $(pwd) test
+&& 2>/dev/null -eu -eu --verbose cd local awk "$@" done echo grep | && $(pwd) awk
+		export | "$@" sed "$1" 'quoted text' sed "$@" test printf awk readonly
+	readonly "$1" 2>/dev/null then --verbose "$1" $(pwd) 2>/dev/null readonly awk $(pwd)
+		$(pwd) then test -eu readonly 'quoted text' --verbose sed then
+		2>/dev/null echo /usr/bin 'quoted text' grep --verbose &&
+		/usr/bin x=1 sed | local export ${HOME} test awk &&
+local echo awk local grep done
+${HOME} $(pwd) "$1" then 2>/dev/null x=1 "$1"
+"$@" cd "$1" "$@" test printf grep /usr/bin
+		"$@" && "$1" readonly 2>/dev/null --verbose echo sed ${HOME} test "$@"
+		--verbose --verbose -eu
+"$@" x=1 sed | then grep readonly cd then sed printf readonly done awk --verbose
+	export local -eu readonly cd export
+	cd "$@" | "$@" test test done export
+test printf x=1 2>/dev/null x=1 echo
+printf | && test grep echo /usr/bin | "$1" echo && echo "$@"
+echo x=1 local "$@" local local x=1 echo 2>/dev/null && $(pwd)
+		printf awk printf 2>/dev/null -eu cd export
+		done | $(pwd) local printf 'quoted text' printf x=1 x=1 test sed then
+"$1" /usr/bin | | -eu done export done
+grep echo awk $(pwd) 2>/dev/null && "$@" --verbose
+		grep grep echo export ${HOME} then $(pwd)
+	grep | grep readonly --verbose "$@" grep /usr/bin echo 2>/dev/null grep done
+then $(pwd) && sed local && 'quoted text' "$@" grep 'quoted text' "$@" 2>/dev/null
+2>/dev/null "$1" echo export export x=1 x=1 test "$1" ${HOME} | echo
+readonly && ${HOME} /usr/bin "$@" "$@" done cd ${HOME} then && echo
+sed $(pwd) grep --verbose then then --verbose grep test
+	awk $(pwd) 'quoted text' awk -eu x=1
+		/usr/bin /usr/bin grep | x=1 --verbose "$1" local export sed grep sed | "$1" "$@"
+$(pwd) -eu test "$1" -eu 2>/dev/null x=1 | $(pwd) then -eu then
+		cd ${HOME} sed "$1" "$1" | 2>/dev/null cd local ${HOME}
+	done readonly printf readonly readonly && test /usr/bin export
+	printf readonly | sed --verbose echo
+		/usr/bin sed "$@" done --verbose 'quoted text' && 'quoted text'
+&& "$1" -eu grep echo readonly 'quoted text' cd
+| "$@" | | "$@" /usr/bin ${HOME} cd x=1 | done "$@" --verbose
+--verbose && then 'quoted text' $(pwd) && --verbose
+	readonly 'quoted text' cd done ${HOME} -eu --verbose && local local echo ${HOME}
+--verbose printf ${HOME} cd "$1" printf | ${HOME} --verbose && local cd 'quoted text'
+	local x=1 x=1 cd cd $(pwd) 2>/dev/null local
+readonly done test local $(pwd) "$1" then | done
+$(pwd) "$1" "$@" awk then "$@" echo 'quoted text' | done grep | then sed printf
+	grep done then echo awk 2>/dev/null test -eu awk
+		then done export /usr/bin export "$1" 2>/dev/null /usr/bin
+"$1" echo done --verbose echo $(pwd)
+		| awk && cd --verbose echo --verbose
+	/usr/bin | grep done then export 2>/dev/null grep local awk x=1
+	printf sed readonly done awk
+echo test /usr/bin -eu sed grep $(pwd) export grep --verbose 'quoted text' cd
+	export awk /usr/bin --verbose
+cd grep -eu 'quoted text' x=1 echo "$1" sed printf -eu /usr/bin
+	/usr/bin export grep cd export local "$@" grep sed "$@" cd cd /usr/bin
+	done then --verbose --verbose
+		2>/dev/null awk --verbose x=1 | /usr/bin awk x=1 readonly test
+/usr/bin x=1 2>/dev/null -eu local test awk
+	x=1 ${HOME} local --verbose
+'quoted text' cd "$1" ${HOME} --verbose
+	export "$1" 'quoted text' && | echo "$@" echo export grep awk test | -eu "$1"
+		'quoted text' /usr/bin && && readonly 'quoted text' local | --verbose
+		readonly | then 'quoted text' $(pwd) sed | "$@" echo
+	2>/dev/null readonly | "$1" sed --verbose printf $(pwd) awk sed readonly
+"$@" /usr/bin && export $(pwd) /usr/bin $(pwd) test test then export | local
+		/usr/bin -eu echo $(pwd) | cd sed ${HOME} 2>/dev/null
+	cd echo grep "$1" 2>/dev/null readonly x=1 printf
+	x=1 export done printf then -eu $(pwd) test sed awk --verbose local
+	-eu sed && "$@" sed test --verbose printf 'quoted text'
+		readonly awk done sed grep | 'quoted text' readonly "$1"
+-eu export -eu cd 2>/dev/null /usr/bin done local readonly /usr/bin /usr/bin
+	printf then local 'quoted text' "$1" $(pwd) echo ${HOME} grep
+$(pwd) echo grep -eu 'quoted text' --verbose readonly awk awk
+--verbose grep | && "$@" -eu && local then --verbose /usr/bin && export readonly
+awk 2>/dev/null 'quoted text' done export
+		echo export sed -eu ${HOME} then local 'quoted text' | sed sed export cd
+	${HOME} test --verbose /usr/bin ${HOME} grep 'quoted text'
+	--verbose sed awk test -eu x=1 2>/dev/null /usr/bin printf
+	"$@" x=1 2>/dev/null 2>/dev/null
+	sed then 2>/dev/null printf readonly readonly test sed printf /usr/bin && local
+cd export awk $(pwd) awk
+	x=1 readonly "$@" "$@"
+		grep readonly test --verbose 'quoted text' | && $(pwd) echo printf export
+		readonly "$1" done $(pwd)
+		-eu && export local ${HOME} local | /usr/bin
+	&& "$@" 'quoted text' local /usr/bin echo export ${HOME}
+		readonly sed 2>/dev/null sed then | local -eu test readonly --verbose awk
+		grep export -eu then --verbose /usr/bin then awk
+	'quoted text' "$@" readonly "$@" && test ${HOME} cd 'quoted text'
+grep 'quoted text' | grep x=1 echo ${HOME} local x=1 | test
+sed x=1 local echo /usr/bin export $(pwd) local /usr/bin test
+2>/dev/null "$@" $(pwd) && -eu grep echo /usr/bin | readonly -eu awk "$1" readonly
+'quoted text' printf --verbose test $(pwd) export echo x=1 --verbose -eu
+		awk "$1" sed done cd echo
+	cd test --verbose -eu awk local --verbose
+$(pwd) x=1 echo -eu awk | test echo && -eu "$@" local
+	printf --verbose test ${HOME} x=1 'quoted text' awk $(pwd) done 'quoted text'
+'quoted text' "$@" 'quoted text'
+	"$@" "$1" "$1" ${HOME} export echo export readonly 2>/dev/null /usr/bin
+		${HOME} export local --verbose -eu 'quoted text' && x=1 readonly
+done 2>/dev/null then awk echo x=1 then cd "$@"
+	-eu cd "$1" sed && local printf
+		2>/dev/null readonly "$@" awk $(pwd)
+--verbose local cd ${HOME}
+	2>/dev/null local cd x=1 ${HOME} printf grep -eu awk ${HOME} sed local ${HOME}
+	"$@" cd printf echo test /usr/bin test
+		echo grep local 2>/dev/null printf
+		readonly && local then grep ${HOME} "$1" /usr/bin printf "$@" ${HOME} awk && sed
+	export echo -eu "$@" test cd test -eu
+		test ${HOME} "$@" && /usr/bin -eu "$1"
+"$@" && && done "$@" sed --verbose
+		$(pwd) $(pwd) -eu ${HOME} /usr/bin $(pwd) grep x=1 -eu cd x=1 then readonly && &&
+	echo | --verbose "$1" printf
+printf echo "$1" echo /usr/bin 'quoted text' done -eu sed
+"$1" sed "$1" "$1" x=1 --verbose
+awk awk /usr/bin cd then then "$@" grep printf grep printf test readonly done awk
+		-eu 'quoted text' export then /usr/bin && local awk 2>/dev/null 'quoted text'
+export local done cd x=1 readonly cd
+	cd done test test && readonly x=1 'quoted text'
+		"$1" cd --verbose "$@" /usr/bin
+'quoted text' ${HOME} 2>/dev/null local readonly x=1 "$1"
+		2>/dev/null ${HOME} readonly local /usr/bin /usr/bin export | "$1" x=1 readonly
+${HOME} sed x=1 -eu 'quoted text' "$@"
+-eu /usr/bin "$@" | local 'quoted text'
+	"$@" x=1 local --verbose --verbose echo 'quoted text' "$1" 2>/dev/null 2>/dev/null
+		done --verbose cd -eu echo done
+printf ${HOME} 2>/dev/null --verbose export local
+"$1" 'quoted text' local --verbose then sed then printf && -eu "$1"
+${HOME} sed readonly printf done test then awk /usr/bin then 2>/dev/null &&
+	| $(pwd) awk -eu "$1" -eu printf /usr/bin "$@" x=1 $(pwd) done 2>/dev/null
+	then local then /usr/bin done
+--verbose 2>/dev/null printf /usr/bin local | 2>/dev/null
+x=1 done grep 'quoted text' 2>/dev/null test then | cd local
+		/usr/bin sed cd "$@" 2>/dev/null $(pwd) ${HOME} grep
+	readonly then && | "$1" echo -eu
+		| then sed $(pwd) echo /usr/bin cd
+	echo printf --verbose export 2>/dev/null then $(pwd) test awk && --verbose
+		x=1 grep printf printf | printf 2>/dev/null
+cd local ${HOME} ${HOME} awk readonly
+		grep printf 'quoted text' readonly && cd awk readonly | /usr/bin then --verbose
+	cd "$@" awk test /usr/bin $(pwd)
+-eu printf | then && readonly "$@" $(pwd) $(pwd) export echo --verbose cd "$1"
+		&& awk 'quoted text' local export ${HOME}
+	| test 'quoted text' readonly
+		/usr/bin awk export --verbose
+		--verbose $(pwd) /usr/bin readonly then test readonly then
+--verbose done done x=1 cd 'quoted text' -eu local -eu grep done 'quoted text'
+		then "$@" then && then local echo --verbose && | test
+		local cd 2>/dev/null readonly "$1" 'quoted text'
+-eu "$1" "$1" printf 2>/dev/null -eu -eu cd test
+	printf && /usr/bin test | "$1" test 2>/dev/null
+export cd local 2>/dev/null /usr/bin awk 2>/dev/null export readonly 'quoted text'
+'quoted text' echo | local ${HOME} cd awk readonly
+"$@" "$@" done sed && echo -eu
+2>/dev/null printf /usr/bin
+		sed sed export "$@" $(pwd) 2>/dev/null printf test 'quoted text'
+		--verbose then && local 2>/dev/null
+	export grep "$@" 'quoted text' 2>/dev/null
+	"$@" && cd cd done 2>/dev/null | cd | 'quoted text' local
+	'quoted text' -eu sed "$1" "$@" -eu cd ${HOME} test echo 2>/dev/null test /usr/bin
+		sed "$1" 'quoted text' /usr/bin awk $(pwd) 2>/dev/null "$1" "$1" && ${HOME}
+	&& ${HOME} ${HOME} "$1" "$1" echo /usr/bin echo /usr/bin
+"$1" done $(pwd) -eu ${HOME} --verbose && export printf "$1" readonly grep
+done --verbose printf grep 'quoted text' echo "$@"
+"$1" grep printf "$1" local x=1 printf 2>/dev/null test $(pwd) "$@" --verbose
+		${HOME} "$1" && --verbose readonly && --verbose
+		"$1" grep printf done grep "$1" done local /usr/bin readonly
+${HOME} local echo 2>/dev/null readonly x=1 "$1" printf then local --verbose
+x=1 printf $(pwd) grep x=1 | "$@" export then then awk ${HOME} --verbose
+"$@" $(pwd) test "$1" done echo 2>/dev/null
+	export "$@" ${HOME} "$@" /usr/bin
+	then $(pwd) export export ${HOME} && test cd | done 2>/dev/null -eu done
+-eu done local -eu sed printf printf awk awk x=1 echo x=1 && done local printf &&
+grep echo sed 'quoted text' test
+--verbose sed grep grep cd sed awk 'quoted text' cd export cd export x=1 --verbose
+		--verbose | | /usr/bin x=1 grep echo grep
+test grep printf export "$@" local | 'quoted text' cd cd readonly echo
+	readonly echo cd sed awk local echo --verbose readonly test /usr/bin awk
+		| grep echo grep sed ${HOME} --verbose
+-eu 2>/dev/null printf echo readonly cd test ${HOME}
+		"$1" ${HOME} done --verbose
+		test ${HOME} "$@" done cd local echo 2>/dev/null 'quoted text' readonly
+		x=1 -eu grep ${HOME} echo grep test /usr/bin printf | --verbose local grep test
+		| then readonly cd cd -eu done && sed
+		readonly x=1 then sed "$@" test local 'quoted text' "$@" awk
+	done then readonly "$1" | local $(pwd) local readonly then --verbose sed "$1"
+		awk $(pwd) local "$@" then $(pwd) /usr/bin echo local then x=1 printf -eu "$@"
+		done then test | 2>/dev/null
+printf 2>/dev/null "$1" &&
+	$(pwd) then printf awk --verbose
+	x=1 | then 'quoted text' echo readonly -eu local printf
+	cd grep "$1" export --verbose -eu --verbose $(pwd) "$@" $(pwd) done
+		then | grep "$@" cd cd cd grep 'quoted text' $(pwd) -eu grep | done done
+	export sed then done sed grep --verbose
+	echo grep "$1" 2>/dev/null grep echo $(pwd) readonly "$1"
+		x=1 echo cd readonly printf $(pwd) printf test then then then sed printf
+	$(pwd) awk "$1" grep x=1 "$@" /usr/bin 'quoted text' readonly done readonly
+		local local printf --verbose sed
+	export echo local ${HOME} && "$1" then | grep export | grep readonly
+readonly local 2>/dev/null test | sed
+/usr/bin then 2>/dev/null printf readonly printf &&
+	--verbose && /usr/bin local test 2>/dev/null x=1 | x=1 --verbose local | -eu cd
+--verbose "$@" && "$1" export readonly $(pwd) grep export grep | 'quoted text'
+cd ${HOME} | local done
+export sed 2>/dev/null local echo $(pwd) -eu test "$1" readonly
+	then x=1 "$@" grep grep grep | /usr/bin local awk cd -eu $(pwd) printf
+	-eu done && "$@" x=1 grep cd awk done | grep readonly printf printf
+awk --verbose "$1" readonly $(pwd) ${HOME}
+		readonly | sed local printf test x=1 --verbose readonly awk --verbose $(pwd)
+		echo --verbose ${HOME} |
+local | local 2>/dev/null local /usr/bin ${HOME}
+"$1" grep printf cd echo echo /usr/bin
+	echo 2>/dev/null sed test
+		2>/dev/null awk /usr/bin 2>/dev/null /usr/bin echo export ${HOME} | | local cd
+		"$1" -eu 'quoted text' printf && /usr/bin x=1 grep x=1 2>/dev/null awk grep readonly
+		readonly ${HOME} $(pwd) echo /usr/bin
+	--verbose then --verbose $(pwd) | cd /usr/bin "$1" cd awk sed /usr/bin
+"$1" cd awk done readonly grep "$@" 'quoted text' $(pwd) 'quoted text'
+"$1" then then export "$1" echo done
+		| then ${HOME} 'quoted text' x=1 $(pwd) then --verbose "$1" -eu -eu grep
+export test cd grep "$1" printf cd done done "$1"
+		"$@" done ${HOME} && printf sed
+awk "$@" $(pwd) echo -eu
+	"$1" -eu | --verbose "$1" "$1" readonly -eu ${HOME} then sed
+	--verbose /usr/bin -eu echo && -eu | "$1" -eu "$@" then $(pwd) $(pwd) printf
+then printf cd x=1 readonly -eu
+		printf "$1" test then readonly
+	done | readonly $(pwd) grep ${HOME}
+	"$@" cd done 2>/dev/null grep && 'quoted text' done x=1 | echo export test done
+		grep test x=1 done ${HOME} then
+		-eu test readonly export cd | "$1" done x=1 "$@" test echo echo grep && 'quoted text'
+	done echo export sed ${HOME} 2>/dev/null
+	2>/dev/null readonly printf /usr/bin $(pwd) && test "$@" export export 'quoted text'
+	test --verbose then awk && x=1 sed printf test awk /usr/bin
+	export 'quoted text' then x=1 /usr/bin
+printf grep printf readonly then 2>/dev/null
+	"$1" x=1 export /usr/bin 2>/dev/null &&
+		export readonly readonly | | | sed grep 'quoted text' done then done && |
+		"$@" "$@" export /usr/bin done x=1 done
+	echo | "$@" && then && test && 2>/dev/null then awk
+		$(pwd) "$@" printf ${HOME} -eu /usr/bin readonly echo readonly
+local readonly export awk
+--verbose | then /usr/bin "$@" /usr/bin
+		$(pwd) 'quoted text' ${HOME}
+		"$@" ${HOME} test test "$@" cd $(pwd) && ${HOME} sed x=1 cd cd readonly printf
+		2>/dev/null export awk export
+	grep awk export cd export | ${HOME} readonly | sed 'quoted text'
+		x=1 export --verbose x=1 test export local echo x=1
+awk x=1 "$1" ${HOME} $(pwd) -eu ${HOME} /usr/bin
+		echo && test local cd $(pwd)
+| cd && export ${HOME} export echo -eu | echo 2>/dev/null
+2>/dev/null -eu printf ${HOME} echo $(pwd) printf 2>/dev/null
+		${HOME} 2>/dev/null awk sed cd | 'quoted text' grep awk | cd cd /usr/bin
+awk $(pwd) x=1 printf && cd | /usr/bin
+		${HOME} echo local 2>/dev/null "$1" "$@" done /usr/bin
+		cd test ${HOME} ${HOME} "$@" "$@" && && sed "$1" 'quoted text' cd && ${HOME}
+	test echo 2>/dev/null "$@" --verbose /usr/bin grep printf
+| 2>/dev/null done printf export echo && "$1" awk $(pwd) awk sed done grep
+	test echo --verbose readonly test then 2>/dev/null
+	&& | --verbose echo "$1" /usr/bin "$1" readonly test readonly cd
+		done then awk grep cd
+		$(pwd) "$@" $(pwd) done ${HOME} -eu x=1 local
+| test x=1 -eu x=1 "$1" 'quoted text' sed done
+	readonly x=1 | /usr/bin x=1 $(pwd)
+'quoted text' done $(pwd) local "$1" && && 'quoted text' "$1" 'quoted text'
+$(pwd) "$1" test | 2>/dev/null cd --verbose then && done export local ${HOME}
+readonly export echo $(pwd) && done sed cd "$@" test
+		"$@" "$@" cd -eu "$1" echo ${HOME}
+		&& cd echo done grep x=1 grep /usr/bin x=1 grep x=1
+		&& echo x=1 "$@" --verbose done readonly | echo && test awk && "$@" local done
+		awk | 'quoted text' grep local --verbose
+	--verbose x=1 /usr/bin "$1" "$1" x=1 grep then then $(pwd) /usr/bin /usr/bin
+	test && test test then test test
+	2>/dev/null x=1 'quoted text' "$1" 2>/dev/null
+&& local test local | then
+		'quoted text' printf -eu "$1" echo echo
+	sed export printf echo awk $(pwd) printf done 2>/dev/null 'quoted text'
+		x=1 awk readonly 2>/dev/null ${HOME} then 2>/dev/null && echo $(pwd) local
+		cd | export grep awk /usr/bin $(pwd)
+		done /usr/bin export x=1 &&
+2>/dev/null local test then test "$@" test --verbose
+		readonly --verbose $(pwd)
+/usr/bin local echo test 2>/dev/null test done x=1 readonly printf
+		| readonly test 'quoted text' $(pwd) $(pwd) "$1" echo x=1
+	2>/dev/null x=1 test | && grep local --verbose readonly then
+-eu awk 2>/dev/null readonly
+		"$1" sed "$1" then export sed x=1 "$@" | awk readonly
+	printf && "$1" grep sed 'quoted text' awk local awk $(pwd) echo 'quoted text'
+awk /usr/bin export export test awk test "$@" cd -eu printf
+| /usr/bin echo done
+${HOME} sed /usr/bin test | echo
+		readonly -eu "$@" "$1" then
+	x=1 --verbose then x=1 "$1"
+sed done /usr/bin awk echo ${HOME} | | sed
+		done -eu then --verbose export
+$(pwd) -eu 'quoted text' cd ${HOME}
+		x=1 printf "$@" && readonly export
+		"$@" | cd test /usr/bin --verbose awk $(pwd) -eu 2>/dev/null
+	"$1" && "$@" echo $(pwd) /usr/bin
+		sed readonly local local export --verbose ${HOME}
+	-eu local | x=1 'quoted text' printf grep 2>/dev/null
+2>/dev/null awk "$@" sed 'quoted text' &&
+	then done $(pwd) x=1 && sed readonly ${HOME} && "$@" && $(pwd) $(pwd) then $(pwd)
+	/usr/bin 2>/dev/null x=1 "$1" x=1 /usr/bin 'quoted text' 'quoted text'
+	x=1 -eu --verbose "$1" grep | local grep 'quoted text'
+--verbose cd --verbose 2>/dev/null -eu /usr/bin && sed cd awk /usr/bin
+sed 2>/dev/null x=1 then test -eu test $(pwd) printf sed local /usr/bin cd
+		local grep grep ${HOME} local sed && sed -eu done readonly -eu echo
+		test local echo done $(pwd) done test ${HOME} && 'quoted text'
+| cd test awk printf echo then awk 2>/dev/null done
+cd 2>/dev/null then --verbose done -eu cd awk
+		then "$1" /usr/bin then local
+		readonly printf "$1" /usr/bin $(pwd) x=1 echo sed x=1 grep done
+		readonly echo | then awk ${HOME} 2>/dev/null -eu
+done local grep printf /usr/bin export done --verbose sed local local local
+	awk -eu echo test test cd $(pwd) x=1 "$1" done /usr/bin /usr/bin
+--verbose x=1 'quoted text' && "$1" cd "$1" echo sed ${HOME} readonly readonly
+x=1 local $(pwd) local printf x=1 then -eu cd 'quoted text'
+		&& | grep "$1" 2>/dev/null test ${HOME} 'quoted text' --verbose local printf
+		then ${HOME} export ${HOME} "$1" echo /usr/bin grep printf cd readonly
+printf 'quoted text' then "$1" cd 'quoted text'
+	local export awk $(pwd) /usr/bin 2>/dev/null printf done readonly
+	2>/dev/null grep local awk grep "$1" then echo "$1" ${HOME} "$1" printf "$@" 'quoted text'
+grep 'quoted text' then grep 'quoted text' ${HOME} done readonly
+then "$1" then sed && x=1 "$@" cd awk printf sed "$1"
+	$(pwd) local local --verbose
+| x=1 -eu x=1 cd awk then | echo -eu export printf --verbose
+		printf /usr/bin local printf readonly "$1" export $(pwd) then
+		/usr/bin $(pwd) local readonly -eu grep $(pwd) awk
+$(pwd) x=1 readonly $(pwd) sed "$1" -eu /usr/bin awk 'quoted text' -eu
+'quoted text' then && cd ${HOME} then
+readonly --verbose $(pwd) printf | sed test export
+	"$@" --verbose sed printf --verbose /usr/bin then echo echo 2>/dev/null
+		&& /usr/bin --verbose $(pwd) --verbose echo printf --verbose readonly --verbose
+&& x=1 'quoted text' && export grep awk cd export /usr/bin local printf
+echo && 2>/dev/null readonly x=1 local /usr/bin ${HOME} done local | done echo
+awk export -eu printf then export local export "$1" sed readonly
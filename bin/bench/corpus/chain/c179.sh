@@ -0,0 +1,2001 @@
+awk echo awk "$@" && done $(pwd)
+		printf echo then local
+	--verbose grep done echo 2>/dev/null local grep
+	sed echo ${HOME} readonly sed readonly local
+cd | "$1" | sed test readonly && && --verbose readonly 'quoted text'
+	then test export --verbose --verbose "$@" 2>/dev/null /usr/bin export
+		echo "$1" done printf echo -eu $(pwd) 'quoted text' done
+	--verbose "$@" done x=1 local 2>/dev/null
+readonly export $(pwd) sed /usr/bin x=1 | 'quoted text'
+/usr/bin --verbose "$1" cd $(pwd) --verbose echo "$1" | -eu && awk echo $(pwd)
+		readonly cd --verbose | ${HOME} local x=1 done -eu
+	"$1" printf | printf then printf cd echo ${HOME} sed awk -eu $(pwd) grep ${HOME}
+$(pwd) 'quoted text' printf ${HOME}
+		--verbose local 2>/dev/null export x=1
+"$1" export /usr/bin x=1 x=1 echo $(pwd) local local echo x=1 && $(pwd) "$1"
+		2>/dev/null printf ${HOME} "$@" cd readonly sed 'quoted text'
+&& | printf readonly export done grep "$1" awk --verbose && readonly then
+	local printf done -eu local echo -eu printf readonly | "$@" done
+	x=1 && sed printf 'quoted text'
+echo ${HOME} test done export readonly
+		test $(pwd) done --verbose | cd -eu --verbose "$@" export grep --verbose $(pwd)
+	&& printf echo ${HOME} "$@" -eu && && -eu sed "$@" 'quoted text' done then ${HOME}
+		awk done 2>/dev/null done | done "$1" /usr/bin then $(pwd) then
+		--verbose awk 'quoted text' awk $(pwd) readonly export then "$@" && local
+grep | awk printf printf -eu "$@" $(pwd) printf sed
+$(pwd) && then $(pwd) readonly grep readonly awk done --verbose $(pwd)
+	sed 2>/dev/null sed echo echo
+		printf export awk "$1" echo /usr/bin --verbose echo && ${HOME}
+2>/dev/null grep ${HOME} 'quoted text' | echo 2>/dev/null | -eu ${HOME}
+	echo readonly grep then /usr/bin cd sed "$1" 2>/dev/null "$@"
+cd sed test done -eu done 'quoted text'
+		| ${HOME} then x=1 sed then -eu "$1" done done sed sed "$@" /usr/bin sed grep
+		--verbose readonly && | export awk 'quoted text' done sed ${HOME} && printf
+		done echo readonly 2>/dev/null export | local
+echo ${HOME} export then grep
+| readonly 2>/dev/null && -eu ${HOME} grep && --verbose export
+cd $(pwd) printf test && | | readonly | 'quoted text'
+		2>/dev/null --verbose 'quoted text' | "$1" test grep 2>/dev/null
+		grep ${HOME} | readonly echo
+${HOME} awk export sed test && --verbose
+	$(pwd) x=1 then x=1 cd "$1" --verbose
+sed "$1" cd then done -eu /usr/bin
+2>/dev/null cd export $(pwd)
+	&& x=1 grep echo | x=1 "$1" printf awk done cd grep "$1" done cd |
+		x=1 readonly 2>/dev/null done && 2>/dev/null sed | x=1 -eu | done cd sed
+	grep cd test awk grep "$@" "$1" test $(pwd) cd 2>/dev/null
+grep cd cd then awk 2>/dev/null
+	| echo 2>/dev/null --verbose -eu test ${HOME} done cd | 2>/dev/null echo
+	'quoted text' done "$@" -eu local
+local echo readonly "$1" test "$@" readonly "$1" ${HOME}
+		echo printf awk printf "$@" echo x=1 "$@"
+	local then test cd | && done ${HOME} export --verbose ${HOME} printf --verbose
+	/usr/bin && cd $(pwd) 'quoted text' | --verbose x=1 export readonly
+		readonly ${HOME} readonly echo cd | done && awk then ${HOME} /usr/bin
+	local /usr/bin x=1 done x=1 | "$@" awk "$@" x=1 | ${HOME} 2>/dev/null
+		cd done /usr/bin | local "$@" readonly --verbose
+--verbose "$1" /usr/bin 'quoted text' local --verbose $(pwd)
+	/usr/bin x=1 sed 'quoted text' /usr/bin
+printf /usr/bin local
+	2>/dev/null sed && export "$1" "$@" local x=1 2>/dev/null grep |
+		/usr/bin --verbose x=1 export grep local /usr/bin
+"$@" sed "$1" cd -eu sed -eu "$@" local
+	&& grep 'quoted text'
+--verbose /usr/bin | test local $(pwd) --verbose then
+		cd && grep cd $(pwd) then --verbose
+		"$1" -eu grep "$@" "$@" local $(pwd) then 'quoted text' local 'quoted text'
+	echo && | echo -eu cd sed done done sed cd 'quoted text'
+	test awk $(pwd) local && && readonly ${HOME} "$@" 2>/dev/null x=1 printf /usr/bin
+		'quoted text' done then "$1" awk 'quoted text' done x=1 cd local "$@" | readonly
+	cd cd readonly "$1" then ${HOME} cd x=1 local 'quoted text'
+local readonly awk cd | awk then printf ${HOME} grep readonly /usr/bin
+readonly 2>/dev/null done then readonly awk done "$@" export &&
+		| | "$1" then && done test export test awk --verbose
+	"$1" --verbose "$1" "$@" awk echo export -eu sed printf ${HOME} --verbose --verbose
+"$1" | | $(pwd) printf printf printf 'quoted text'
+		$(pwd) ${HOME} readonly test /usr/bin printf grep done then /usr/bin |
+	local sed export grep
+--verbose cd awk -eu 'quoted text' done | "$1"
+		/usr/bin $(pwd) | local readonly /usr/bin 2>/dev/null
+grep local local | --verbose /usr/bin -eu $(pwd) readonly
+local -eu echo | ${HOME} 'quoted text' local echo 2>/dev/null
+		-eu local --verbose local ${HOME} printf "$@" cd 2>/dev/null then /usr/bin 2>/dev/null
+		'quoted text' /usr/bin grep then "$1" x=1 'quoted text'
+		printf /usr/bin test done x=1 sed readonly /usr/bin ${HOME}
+--verbose -eu export "$1" /usr/bin ${HOME} grep | sed -eu "$@" | ${HOME}
+	grep --verbose && 2>/dev/null && cd done && 2>/dev/null sed
+	-eu x=1 --verbose then printf 'quoted text' grep export | local export grep test
+echo done ${HOME} && | test then readonly 'quoted text' export echo /usr/bin
+	x=1 grep "$@" local ${HOME} /usr/bin done local -eu sed && cd | printf --verbose
+	2>/dev/null --verbose awk 'quoted text' done done | | export && $(pwd)
+	export && sed echo | "$1" printf
+		export "$1" $(pwd) 2>/dev/null readonly
+		"$1" 2>/dev/null grep printf
+'quoted text' --verbose "$@" 'quoted text'
+printf | sed awk x=1 /usr/bin | ${HOME} $(pwd)
+$(pwd) then awk $(pwd) | test | "$1" local awk readonly
+	export printf cd local "$1" ${HOME} awk printf "$@" awk echo ${HOME}
+"$@" -eu ${HOME} --verbose
+	grep echo $(pwd) "$1"
+cd "$1" "$1" awk && "$1" && printf done "$@" | && echo /usr/bin
+	x=1 sed "$1" "$1" && awk && export grep test && readonly x=1 --verbose
+	-eu -eu x=1 export grep sed --verbose
+	readonly then local 2>/dev/null export -eu
+$(pwd) cd grep "$1" "$1" 'quoted text' x=1 done
+	'quoted text' echo 2>/dev/null readonly "$@" 2>/dev/null
+		$(pwd) sed /usr/bin grep sed echo export cd then | test 'quoted text'
+printf "$@" "$1" readonly
+		x=1 done 'quoted text' cd echo
+	sed && cd then "$@" local "$1" x=1 readonly printf $(pwd) | -eu 2>/dev/null
+	test 2>/dev/null $(pwd) | 'quoted text' x=1 /usr/bin "$@"
+	export then sed 2>/dev/null test "$1" /usr/bin "$1" test echo 2>/dev/null done
+		local done export /usr/bin export
+		then local export awk /usr/bin &&
+then "$1" echo | 'quoted text' echo cd --verbose "$@" && export |
+	${HOME} printf sed done 'quoted text' "$1" export
+	done test -eu export then grep readonly x=1 awk --verbose
+	&& "$1" "$@" sed -eu done ${HOME} printf
+		"$1" $(pwd) readonly | ${HOME} grep | | "$@" && ${HOME} $(pwd) | echo "$1"
+		sed export -eu | export 2>/dev/null local local done | -eu done -eu 2>/dev/null
+		"$1" x=1 "$1" -eu /usr/bin
+		--verbose $(pwd) printf cd ${HOME} | -eu $(pwd) /usr/bin "$@" test --verbose
+		echo x=1 -eu test test
+	echo x=1 sed $(pwd) -eu then export 2>/dev/null readonly
+		"$@" x=1 readonly printf awk printf 2>/dev/null 2>/dev/null "$@"
+		local sed ${HOME} awk 'quoted text'
+	/usr/bin | 'quoted text'
+"$@" done test -eu $(pwd) grep grep grep grep awk awk test
+	awk 'quoted text' done x=1 test && ${HOME}
+'quoted text' sed readonly
+grep then "$1" --verbose --verbose printf x=1 2>/dev/null
+--verbose grep local --verbose test 'quoted text' 'quoted text' cd 'quoted text'
+	echo "$1" awk cd done
+export -eu 2>/dev/null local | /usr/bin 2>/dev/null
+		echo 'quoted text' test awk 'quoted text'
+	x=1 && grep export echo "$1" | readonly && 2>/dev/null -eu /usr/bin done local
+	test 2>/dev/null export "$1" then
+2>/dev/null local then done --verbose
+cd echo | grep grep awk "$1" export
+	2>/dev/null "$1" --verbose awk 'quoted text' test $(pwd) "$@"
+	2>/dev/null x=1 --verbose
+&& "$1" && /usr/bin then --verbose awk
+		--verbose $(pwd) local test 2>/dev/null -eu $(pwd)
+		done 2>/dev/null then && test export local readonly printf printf local
+		x=1 then sed sed local grep readonly printf readonly
+		test printf | /usr/bin printf
+--verbose && done x=1 | "$1" echo ${HOME} cd | | ${HOME} cd | /usr/bin printf &&
+-eu local sed | "$@" echo $(pwd) 2>/dev/null test
+		grep readonly export "$@" ${HOME} printf ${HOME} local | ${HOME} export cd export
+		2>/dev/null printf && then "$1"
+		${HOME} printf 'quoted text'
+export 'quoted text' echo done 'quoted text' test then ${HOME} "$1" && | 'quoted text'
+/usr/bin 'quoted text' 2>/dev/null cd /usr/bin
+		then ${HOME} $(pwd) "$1" x=1 x=1 2>/dev/null && ${HOME} $(pwd) x=1 | -eu
+cd cd grep grep test local export && export printf local readonly /usr/bin echo
+--verbose cd readonly cd ${HOME}
+		echo printf -eu 2>/dev/null echo "$1" then
+	x=1 -eu ${HOME} | readonly then export "$1" $(pwd) readonly "$1" --verbose
+	grep awk echo x=1 cd "$@" --verbose echo test awk x=1 && ${HOME} ${HOME} printf
+'quoted text' "$1" readonly | then export /usr/bin sed
+	| "$@" /usr/bin x=1 done "$@" "$1" $(pwd) cd export awk "$@" -eu && 2>/dev/null
+		"$@" $(pwd) test sed local export echo
+	"$@" --verbose && /usr/bin test $(pwd) $(pwd) /usr/bin x=1 then grep
+	'quoted text' test && cd printf awk
+	then cd 2>/dev/null test grep
+local && 2>/dev/null then
+	x=1 then printf export printf 2>/dev/null sed readonly "$1" printf
+		-eu | /usr/bin done 2>/dev/null ${HOME} /usr/bin && -eu export
+/usr/bin local sed -eu
+		2>/dev/null awk /usr/bin
+		| 'quoted text' cd grep
+		${HOME} -eu echo cd ${HOME} 'quoted text' test $(pwd) cd export
+| && export "$@" local x=1 'quoted text' /usr/bin $(pwd)
+then local local sed then /usr/bin && cd &&
+	--verbose awk awk 2>/dev/null x=1 "$@" done echo -eu echo --verbose -eu && cd
+awk /usr/bin 'quoted text' grep test | /usr/bin /usr/bin
+		$(pwd) "$1" then echo x=1 export local
+		${HOME} "$1" "$1" done
+	| ${HOME} then $(pwd) echo && ${HOME}
+	export readonly "$1" && echo echo --verbose -eu
+		awk /usr/bin local -eu test 2>/dev/null "$@" x=1 test local 'quoted text' echo
+&& | grep cd ${HOME} then ${HOME} | done
+		2>/dev/null "$@" awk && grep "$1"
+	export echo test printf $(pwd) then $(pwd) awk printf
+${HOME} -eu "$1" 'quoted text' test -eu done grep
+	$(pwd) grep printf ${HOME}
+&& awk /usr/bin cd "$@" /usr/bin readonly echo
+grep /usr/bin grep cd awk readonly
+		&& && --verbose | test echo "$1" $(pwd) | ${HOME} $(pwd) grep readonly
+'quoted text' --verbose | /usr/bin 2>/dev/null $(pwd)
+		$(pwd) export grep local echo | export awk 'quoted text'
+local --verbose "$1" && "$1"
+export echo ${HOME} then sed then --verbose grep -eu
+readonly awk -eu --verbose
+awk grep then readonly test -eu
+		| 'quoted text' printf && export ${HOME} echo x=1 2>/dev/null printf local
+| -eu --verbose local $(pwd) grep local echo
+		grep local printf && sed cd sed -eu test
+		awk 'quoted text' --verbose | awk &&
+		readonly export then printf
+	cd echo grep printf "$1" /usr/bin "$@" "$1" then
+	printf readonly done sed test "$@" 2>/dev/null export sed sed 2>/dev/null cd
+"$1" cd export cd cd x=1 export done "$1" | cd printf
+	local 2>/dev/null 'quoted text' export &&
+		export 'quoted text' $(pwd) && 'quoted text' x=1 export cd export
+	/usr/bin grep done awk /usr/bin
+		echo --verbose | then local
+x=1 | -eu -eu $(pwd) readonly awk
+${HOME} local | test readonly --verbose | readonly
+cd ${HOME} x=1 grep x=1 /usr/bin 2>/dev/null x=1 --verbose x=1
+		echo test then awk grep echo
+export "$@" grep /usr/bin readonly grep "$1" awk readonly -eu 'quoted text' echo
+-eu printf /usr/bin printf test local x=1 x=1
+		"$@" sed && test --verbose then x=1 sed awk printf "$@" grep 'quoted text' test
+	${HOME} && | then local done test "$1" "$@" 'quoted text' /usr/bin
+	test then cd readonly ${HOME} ${HOME}
+-eu 'quoted text' printf x=1 $(pwd)
+awk /usr/bin "$@" x=1 "$1" done x=1 ${HOME}
+		local test sed --verbose printf cd "$1" grep local grep cd readonly -eu export
+grep x=1 /usr/bin export awk x=1 test printf 2>/dev/null
+		sed then readonly readonly grep "$@" done && x=1 "$1" "$1" export
+echo "$@" | local && ${HOME} sed readonly
+printf echo local 2>/dev/null --verbose /usr/bin
+		then awk 'quoted text' $(pwd) readonly --verbose cd &&
+		${HOME} done 2>/dev/null printf cd echo test then x=1 echo 2>/dev/null
+		export /usr/bin /usr/bin cd 'quoted text' test
+2>/dev/null echo export "$@" "$1" ${HOME} 2>/dev/null sed then |
+	"$1" done --verbose x=1 ${HOME} export echo ${HOME} x=1 | "$@" printf 2>/dev/null
+${HOME} $(pwd) | done ${HOME} ${HOME} /usr/bin test /usr/bin 2>/dev/null
+	export awk 'quoted text' --verbose echo /usr/bin then 'quoted text' --verbose
+/usr/bin export $(pwd) then 'quoted text' ${HOME} done sed 'quoted text'
+		${HOME} readonly -eu "$1" ${HOME} 2>/dev/null --verbose
+	echo "$@" -eu local printf done test test ${HOME}
+		-eu then x=1 done local $(pwd) "$1" grep 'quoted text' "$1" ${HOME}
+	then local test --verbose "$@" "$1"
+--verbose 2>/dev/null 2>/dev/null printf readonly | echo then | 2>/dev/null
+sed -eu --verbose sed done "$@" $(pwd) "$1" test export
+--verbose awk grep /usr/bin 'quoted text' | grep
+		$(pwd) readonly x=1 done 'quoted text'
+		done | $(pwd) local readonly
+	sed done printf 'quoted text' "$1" awk
+	export export export awk
+"$@" 'quoted text' 2>/dev/null 2>/dev/null export
+| printf export 2>/dev/null
+readonly | readonly 2>/dev/null local --verbose then
+	grep local echo ${HOME} /usr/bin x=1 x=1 /usr/bin grep --verbose "$1" test export
+	readonly awk && echo && export sed then "$@"
+	done echo export readonly
+&& --verbose grep cd | test
+--verbose printf | then done
+	local --verbose local test printf
+		-eu done $(pwd) "$@" x=1 printf 2>/dev/null
+export echo "$@" 'quoted text' | echo x=1
+		2>/dev/null awk | x=1 local echo | | export export local
+	test local cd echo "$@" readonly cd sed export /usr/bin
+		x=1 "$@" test && awk test test local export ${HOME} readonly
+	awk export export && done "$1" --verbose
+		2>/dev/null sed echo then printf /usr/bin
+| 'quoted text' "$1" ${HOME} 2>/dev/null x=1 export echo
+		sed && sed cd local ${HOME} 'quoted text'
+		then 2>/dev/null export local
+		/usr/bin test export done sed export --verbose test | -eu ${HOME}
+	echo "$@" sed grep "$@" --verbose
+		x=1 $(pwd) 'quoted text'
+$(pwd) sed ${HOME} ${HOME} "$@" grep local --verbose "$@" then readonly test
+	${HOME} local $(pwd) sed export /usr/bin awk "$@" && readonly
+	| test && 'quoted text' | | -eu -eu echo -eu
+	sed grep sed "$@" -eu export && cd
+	'quoted text' printf --verbose x=1 x=1
+		readonly $(pwd) echo $(pwd)
+	${HOME} echo ${HOME} echo sed 2>/dev/null 2>/dev/null --verbose awk local 'quoted text'
+	export readonly sed done | && cd 'quoted text' done
+readonly awk /usr/bin awk readonly test cd printf sed cd
+		x=1 test local sed -eu awk --verbose
+		echo grep grep awk done export 2>/dev/null /usr/bin
+	-eu local grep local
+		readonly done /usr/bin && && x=1 awk 'quoted text' /usr/bin
+		then 'quoted text' 2>/dev/null "$@" printf sed
+&& && readonly grep --verbose sed awk -eu awk x=1 test readonly
+	${HOME} then printf 2>/dev/null && | done cd local -eu x=1
+$(pwd) "$1" readonly then readonly grep | $(pwd) x=1
+awk grep awk && && 2>/dev/null test "$1" && local echo then --verbose grep $(pwd)
+$(pwd) x=1 2>/dev/null ${HOME} readonly && ${HOME}
+	${HOME} cd sed && then $(pwd) && grep 'quoted text' test -eu then grep local grep
+--verbose $(pwd) sed readonly
+		$(pwd) /usr/bin && sed grep 'quoted text' ${HOME} readonly awk
+		local export | cd done local readonly cd /usr/bin --verbose | 'quoted text' ${HOME}
+		x=1 "$@" && printf /usr/bin sed then cd 2>/dev/null done readonly
+	&& --verbose --verbose grep --verbose "$@" ${HOME} done done test printf $(pwd)
+| then "$@" --verbose "$1" test cd "$@" done /usr/bin
+	${HOME} ${HOME} "$@" --verbose
+		grep $(pwd) "$1" && then && test printf local ${HOME} /usr/bin echo | /usr/bin
+		"$@" --verbose echo /usr/bin x=1 awk then readonly printf test local export $(pwd)
+printf -eu x=1 "$1" cd -eu grep
+		echo 2>/dev/null -eu grep
+	local test x=1 "$1" printf /usr/bin -eu then -eu cd
+		sed test $(pwd) echo local 'quoted text' x=1 local then
+	test ${HOME} /usr/bin local 2>/dev/null ${HOME} "$1" --verbose "$@" readonly
+"$1" cd x=1 -eu export /usr/bin readonly x=1 'quoted text'
+	export ${HOME} --verbose x=1 && then echo "$@"
+		cd --verbose test sed local "$@" cd printf 'quoted text' sed local
+		cd sed ${HOME} readonly export awk readonly
+		-eu cd export then local test printf test /usr/bin x=1
+		awk printf grep -eu "$1" "$@" && done cd
+awk done ${HOME} sed "$@" "$1" --verbose
+		test printf grep 2>/dev/null && | test && export "$@" echo test
+	"$@" done "$1" cd | readonly printf x=1 'quoted text' then done readonly
+	done 'quoted text' readonly 'quoted text' | export awk echo /usr/bin then
+	local | --verbose echo 2>/dev/null sed done $(pwd) sed done echo
+	/usr/bin printf grep test
+	printf "$@" awk --verbose | -eu done x=1 --verbose then echo
+		$(pwd) export sed -eu -eu
+		echo 'quoted text' $(pwd) "$@" sed test awk sed
+		/usr/bin export done readonly && 2>/dev/null -eu awk $(pwd)
+	awk -eu done x=1 cd -eu done "$@" 2>/dev/null sed
+	$(pwd) ${HOME} ${HOME} ${HOME} 2>/dev/null /usr/bin export then readonly
+		"$@" && "$1" && $(pwd) export "$1" 'quoted text'
+| export awk "$1" ${HOME} x=1 x=1 awk | x=1 grep test awk test echo
+		--verbose done grep 2>/dev/null $(pwd) --verbose "$@"
+"$@" /usr/bin "$@" 'quoted text' "$@" done done
+		2>/dev/null x=1 readonly && local
+| local printf grep sed cd "$@" "$1" $(pwd) /usr/bin grep
+	&& local export done "$@" 2>/dev/null readonly --verbose
+		printf then /usr/bin "$@" printf then printf
+sed grep "$@" then --verbose 'quoted text'
+	-eu | -eu grep printf then test /usr/bin ${HOME} --verbose done
+	&& echo ${HOME} grep ${HOME} done | local
+then done --verbose printf "$@" readonly -eu grep "$@" -eu grep ${HOME} then
+		| x=1 sed awk 2>/dev/null
+'quoted text' 'quoted text' ${HOME} x=1 grep "$1" printf done
+done local test awk && && test $(pwd)
+		cd test 2>/dev/null && export 'quoted text'
+	${HOME} 'quoted text' $(pwd) done printf $(pwd)
+		cd ${HOME} readonly export 'quoted text' printf 2>/dev/null
+	x=1 x=1 "$@" sed local cd readonly export && test
+sed awk "$1" $(pwd) ${HOME}
+		readonly "$1" grep done echo 'quoted text' printf then -eu sed printf /usr/bin sed
+${HOME} printf echo local local ${HOME} export
+	readonly --verbose x=1 grep 2>/dev/null
+		| done 2>/dev/null echo 2>/dev/null
+		sed x=1 export test /usr/bin done cd readonly | sed && | $(pwd) cd done
+	readonly "$1" cd 2>/dev/null
+	readonly && cd then printf local done "$@" cd printf export sed printf $(pwd)
+		/usr/bin local test | "$1" x=1 sed "$@" x=1 export done echo readonly
+		--verbose then grep ${HOME}
+	local 2>/dev/null echo grep then sed | x=1 'quoted text'
+	2>/dev/null readonly awk awk printf done $(pwd) echo done export echo "$@"
+test "$1" echo cd sed | printf | /usr/bin --verbose ${HOME} sed grep
+then 'quoted text' x=1 'quoted text' grep ${HOME} && readonly
+2>/dev/null -eu then awk
+2>/dev/null cd | awk --verbose test printf $(pwd) --verbose "$@"
+	echo && done awk /usr/bin done export | "$1" sed x=1 'quoted text' export
+		awk -eu sed "$@" /usr/bin /usr/bin echo readonly then sed
+	| grep awk printf then -eu "$@" echo cd test test "$1" readonly local local
+cd $(pwd) "$@" readonly -eu 'quoted text' readonly
+		printf "$@" 2>/dev/null ${HOME} sed /usr/bin --verbose
+		$(pwd) echo readonly $(pwd) readonly
+	x=1 2>/dev/null --verbose 'quoted text'
+		readonly -eu && echo test && test | done | done echo --verbose -eu 'quoted text'
+cd x=1 test then 2>/dev/null local 'quoted text' readonly
+		echo cd "$@" $(pwd) && sed | echo x=1 2>/dev/null 2>/dev/null && "$1"
+${HOME} sed "$@" $(pwd) /usr/bin /usr/bin printf "$1" | export
+		printf readonly sed 'quoted text' echo readonly export printf x=1 -eu then cd |
+	--verbose sed $(pwd) local done awk 2>/dev/null --verbose printf awk cd test then
+	sed && 2>/dev/null done
+		grep local x=1 readonly "$@" ${HOME} 2>/dev/null ${HOME} $(pwd) 'quoted text'
+${HOME} -eu 2>/dev/null 2>/dev/null --verbose
+then echo awk "$1" --verbose cd 'quoted text'
+"$1" x=1 2>/dev/null printf readonly sed grep "$@" export
+	"$@" local echo awk sed readonly test cd awk grep grep /usr/bin
+		done test "$@" $(pwd) x=1 /usr/bin done test export ${HOME}
+printf cd awk sed ${HOME} readonly ${HOME} awk test && 2>/dev/null
+"$@" --verbose x=1 sed | export && test | -eu && sed test
+export --verbose grep echo /usr/bin awk "$1" && | 2>/dev/null
+		${HOME} "$1" 'quoted text' --verbose grep done grep ${HOME} "$@" grep -eu "$@"
+grep $(pwd) x=1 /usr/bin
+		--verbose $(pwd) test && test && export
+echo 'quoted text' local /usr/bin 'quoted text' | && printf /usr/bin test awk readonly
+'quoted text' -eu then -eu x=1 export "$@" export "$1" ${HOME} 'quoted text'
+	| 2>/dev/null 'quoted text' then then grep local $(pwd) then
+&& printf 2>/dev/null sed export cd export sed 2>/dev/null test sed grep "$1"
+&& readonly then /usr/bin "$1" printf readonly 2>/dev/null awk "$@" ${HOME}
+	${HOME} -eu sed local cd "$1" done local awk 2>/dev/null && x=1 grep $(pwd) grep
+sed ${HOME} /usr/bin test test printf printf
+		${HOME} sed then echo ${HOME} awk grep local printf
+	test && grep 2>/dev/null --verbose /usr/bin ${HOME} && readonly
+	-eu && printf "$@" done test printf sed ${HOME} echo && test
+		&& test $(pwd) printf "$@" | cd /usr/bin
+done sed local then echo --verbose "$1" grep
+		printf -eu && ${HOME} | --verbose ${HOME} echo "$1" -eu 2>/dev/null
+	| export "$@" sed 'quoted text'
+		grep then "$@" test done x=1 $(pwd) then done "$1"
+	"$1" ${HOME} /usr/bin cd echo 2>/dev/null
+local printf readonly "$1" readonly
+--verbose "$1" sed done "$1" ${HOME}
+	local /usr/bin awk sed local -eu awk done then done
+x=1 'quoted text' "$@" | export
+	/usr/bin | test echo cd readonly sed 2>/dev/null && grep echo "$1" echo printf
+2>/dev/null readonly awk && sed && export && then done export "$1"
+	readonly printf && $(pwd) 'quoted text' -eu && |
+cd 'quoted text' test x=1 && local cd ${HOME} -eu awk
+		printf echo local readonly ${HOME} export test awk ${HOME} then /usr/bin | /usr/bin
+	2>/dev/null 2>/dev/null echo export "$@" done --verbose done sed sed export 2>/dev/null
+test local cd 'quoted text' /usr/bin "$1" $(pwd) echo -eu readonly
+	export done x=1 export -eu printf
+local readonly local 'quoted text' $(pwd) sed echo /usr/bin
+&& printf -eu cd && 'quoted text' 2>/dev/null readonly ${HOME} /usr/bin
+awk 2>/dev/null 2>/dev/null 'quoted text' echo cd 2>/dev/null 'quoted text'
+done --verbose | grep 2>/dev/null x=1
+	| "$1" /usr/bin -eu $(pwd) done ${HOME} then readonly echo cd 'quoted text'
+		$(pwd) then && echo export $(pwd) export
+done grep cd done printf then 2>/dev/null | "$1" done | readonly
+		echo $(pwd) done echo done | export cd "$@" /usr/bin
+	grep "$@" readonly 2>/dev/null 'quoted text' "$1"
+awk sed done --verbose sed echo cd 'quoted text'
+export x=1 "$@" | | $(pwd) 2>/dev/null echo -eu
+	test 'quoted text' $(pwd) readonly "$1" "$1"
+		"$1" echo --verbose /usr/bin /usr/bin
+		readonly /usr/bin x=1 export
+then /usr/bin readonly readonly awk
+		| "$@" "$1" x=1 cd readonly printf
+'quoted text' grep local printf && grep grep awk readonly
+x=1 awk --verbose echo then 2>/dev/null
+sed then 'quoted text' | --verbose
+echo cd -eu readonly "$1" test /usr/bin 2>/dev/null x=1 local export printf export
+		'quoted text' "$1" && x=1 awk "$@"
+	x=1 x=1 local ${HOME} printf then "$@" echo echo --verbose cd echo local
+done cd $(pwd) "$@" grep grep 2>/dev/null "$1" grep printf
+&& 'quoted text' "$1" --verbose local "$@" grep "$1" printf cd echo && "$1" &&
+		local x=1 test x=1 x=1 /usr/bin
+	--verbose echo awk sed x=1 grep readonly 'quoted text'
+	printf ${HOME} echo -eu printf ${HOME} grep "$1" sed "$1" $(pwd) then test 'quoted text'
+$(pwd) 'quoted text' && export --verbose ${HOME} ${HOME} echo 'quoted text'
+		"$@" x=1 echo sed test /usr/bin && sed test "$@" awk cd printf
+		"$@" ${HOME} echo export | | && --verbose "$1" done done export && grep
+	local 'quoted text' sed
+${HOME} then ${HOME} cd echo readonly
+		awk echo test export local echo export --verbose then
+		"$@" && awk "$1" test grep ${HOME} awk awk cd grep grep
+	2>/dev/null echo x=1 2>/dev/null
+	$(pwd) /usr/bin 'quoted text' -eu grep export done -eu printf "$1" export ${HOME}
+	| printf /usr/bin then 'quoted text'
+	done export ${HOME} "$@" awk awk /usr/bin "$1" done test -eu ${HOME} awk x=1
+		--verbose 'quoted text'
+done && printf export test | test | /usr/bin
+		printf cd ${HOME} x=1 readonly
+	readonly /usr/bin 2>/dev/null
+	test readonly --verbose && /usr/bin "$@" grep echo | x=1 $(pwd) export sed
+echo awk -eu readonly --verbose sed
+		then --verbose printf -eu cd then echo "$1" then --verbose awk test x=1
+		x=1 grep then then | test
+		--verbose $(pwd) test grep sed printf --verbose
+		test done then grep "$@" test "$@" export | done printf
+2>/dev/null done echo awk echo test
+${HOME} "$1" done $(pwd) grep done awk
+	then echo test "$@" | 2>/dev/null --verbose $(pwd) && | cd -eu
+2>/dev/null 'quoted text'
+	x=1 export sed -eu sed printf --verbose local "$@" ${HOME}
+		then echo done ${HOME} 'quoted text' $(pwd) grep printf
+		then "$1" readonly export echo awk
+test $(pwd) $(pwd) printf --verbose then printf | /usr/bin
+-eu "$@" then echo test /usr/bin $(pwd) test
+		readonly $(pwd) -eu "$1" "$@" $(pwd) $(pwd) cd 'quoted text'
+&& 2>/dev/null "$1" awk awk readonly "$1" then -eu $(pwd) cd ${HOME} cd grep
+	"$@" $(pwd) then 2>/dev/null echo readonly ${HOME} readonly cd $(pwd) echo sed ${HOME}
+		printf ${HOME} awk | x=1 readonly sed cd local sed done &&
+		--verbose then printf printf export test echo done
+cd /usr/bin /usr/bin 2>/dev/null $(pwd) "$@" then
+--verbose ${HOME} "$1" done awk export 2>/dev/null
+		printf readonly local "$1" export echo grep ${HOME} --verbose
+		${HOME} awk then readonly 2>/dev/null $(pwd) "$1" x=1 && readonly --verbose
+	sed $(pwd) $(pwd) sed sed 'quoted text' 'quoted text'
+'quoted text' echo 'quoted text' test readonly then 2>/dev/null $(pwd) test
+		"$1" --verbose $(pwd) x=1 test && then /usr/bin
+export cd export 'quoted text' then
+$(pwd) cd local | -eu /usr/bin --verbose export $(pwd) then awk x=1 "$@"
+		/usr/bin $(pwd) | then grep 2>/dev/null
+		done done test 2>/dev/null readonly $(pwd) sed 'quoted text'
+		| 2>/dev/null test done && "$@" 2>/dev/null /usr/bin cd export
+	${HOME} grep readonly "$1" export awk sed then test 2>/dev/null awk
+	/usr/bin test printf grep echo local cd --verbose then local $(pwd)
+readonly grep "$@" export | printf local printf 'quoted text'
+		cd x=1 'quoted text' test sed grep sed
+"$@" /usr/bin done && --verbose && sed readonly echo grep |
+	readonly export | export --verbose --verbose
+then /usr/bin local sed 'quoted text' test
+	"$@" && && export && grep | 2>/dev/null "$@" "$1" "$1" grep export
+| "$1" export | awk then sed readonly
+awk echo x=1 x=1 x=1 export | echo /usr/bin done
+		-eu echo cd | "$@" && "$1" 2>/dev/null "$@"
+-eu "$@" grep awk printf ${HOME}
+		/usr/bin -eu export "$@" --verbose printf -eu | readonly
+sed grep readonly readonly
+		export cd 'quoted text' awk export --verbose
+-eu grep test then 2>/dev/null | local $(pwd) test echo "$1" grep
+	done -eu $(pwd) -eu export sed done "$@" cd readonly
+"$1" | cd awk | then test | cd ${HOME}
+	printf local $(pwd) 'quoted text'
+		sed "$1" local x=1 grep then
+	grep | | done test then cd x=1 | $(pwd) printf x=1 done then readonly readonly
+		local "$1" 2>/dev/null x=1 | "$1" "$1" && then 2>/dev/null && --verbose
+	-eu 2>/dev/null ${HOME} grep -eu sed export -eu readonly
+	done done 'quoted text' sed -eu done export test 2>/dev/null 2>/dev/null ${HOME}
+		echo x=1 sed 'quoted text' "$1" --verbose echo test $(pwd)
+	"$1" export readonly grep cd
+	x=1 readonly export $(pwd) x=1 cd -eu cd | "$@" export
+		| -eu sed then $(pwd) done "$@" readonly
+		then export ${HOME} local 'quoted text' "$1" local test
+	echo ${HOME} "$@" 2>/dev/null "$@" --verbose
+echo "$@" printf 2>/dev/null 'quoted text'
+	echo ${HOME} readonly awk | echo printf 2>/dev/null "$@" | echo "$1" then echo
+	printf sed $(pwd) "$1" "$@" -eu done sed 'quoted text'
+		-eu grep x=1 sed | 2>/dev/null readonly grep x=1 printf
+		then sed local --verbose /usr/bin
+	"$1" $(pwd) x=1 ${HOME} "$1" | 2>/dev/null
+	export x=1 sed -eu done x=1 done "$@" export --verbose grep export echo test "$@"
+	&& | --verbose echo $(pwd) --verbose grep cd
+		${HOME} grep ${HOME} x=1 x=1 | cd then --verbose $(pwd)
+	"$@" "$@" /usr/bin | /usr/bin $(pwd) -eu 2>/dev/null
+then x=1 local x=1 ${HOME} then sed local
+grep test printf /usr/bin /usr/bin
+	cd sed $(pwd) printf ${HOME} cd printf "$@" cd
+		awk export /usr/bin echo awk echo $(pwd) readonly
+| sed test then awk "$1"
+	grep ${HOME} local local done printf 'quoted text'
+	test "$1" printf "$@" -eu echo $(pwd) $(pwd) cd awk 2>/dev/null
+printf "$@" /usr/bin /usr/bin export ${HOME} | --verbose awk -eu printf
+	done -eu awk test local sed local awk readonly done -eu awk --verbose
+	sed 'quoted text' printf echo "$@" "$@" | printf done export
+&& export done sed readonly grep "$1" /usr/bin $(pwd) 'quoted text'
+cd readonly "$1" export $(pwd)
+		done done awk --verbose /usr/bin cd echo then grep cd test "$@"
+		done echo printf && grep -eu export
+then ${HOME} x=1 then --verbose readonly printf "$1" "$@" &&
+awk then | export $(pwd) cd local /usr/bin
+	test awk grep 'quoted text' --verbose | test "$@" sed 'quoted text' -eu done done
+$(pwd) readonly 'quoted text' 2>/dev/null /usr/bin | done 'quoted text'
+	test sed | export echo done local sed sed test local test | --verbose ${HOME}
+		local printf done -eu -eu 2>/dev/null awk export
+		done grep | "$1" | && ${HOME} | cd readonly
+		"$@" test done printf
+x=1 --verbose && awk "$1" $(pwd) sed printf
+		"$1" awk 'quoted text' --verbose -eu | printf then then "$1" done sed "$1" awk
+"$@" export cd 2>/dev/null -eu
+awk | "$1" ${HOME} cd local grep /usr/bin
+	cd then test --verbose export /usr/bin && awk local /usr/bin test ${HOME}
+		then "$1" 'quoted text' grep $(pwd) 'quoted text'
+	echo grep grep 2>/dev/null printf 'quoted text' && cd sed 2>/dev/null awk cd
+	x=1 printf export | awk readonly
+/usr/bin && cd printf sed "$1" "$@" $(pwd) --verbose "$1" "$@" $(pwd) -eu ${HOME}
+	echo 'quoted text' x=1 local
+		x=1 then grep --verbose done sed cd awk 2>/dev/null "$1"
+then test 'quoted text' --verbose && 2>/dev/null --verbose
+"$1" echo echo 'quoted text' --verbose -eu
+		"$@" | local x=1 awk && "$1" readonly -eu /usr/bin test done awk && $(pwd) awk
+$(pwd) "$@" test "$1" $(pwd) done export
+		then $(pwd) ${HOME} awk -eu cd readonly
+		then then export then sed done ${HOME} /usr/bin "$@" export
+echo printf $(pwd) && 'quoted text' -eu "$@" printf
+	-eu /usr/bin cd awk printf export "$1" -eu cd | test "$1" "$1" /usr/bin
+		then --verbose printf -eu export
+&& awk local $(pwd) export /usr/bin $(pwd) ${HOME} then echo export
+		test | 'quoted text' && awk export /usr/bin readonly --verbose
+	echo -eu grep test --verbose 2>/dev/null x=1
+"$1" "$1" test sed awk --verbose done 'quoted text' ${HOME}
+${HOME} x=1 | -eu printf
+grep "$@" echo $(pwd) 2>/dev/null
+"$@" done -eu printf sed
+	--verbose grep "$@" cd --verbose awk sed
+'quoted text' then local readonly echo $(pwd) x=1 | then then readonly
+		export --verbose --verbose test local "$@"
+	local readonly /usr/bin -eu ${HOME} $(pwd) printf x=1 export ${HOME}
+2>/dev/null export awk cd cd local then done awk "$1" printf -eu "$@" /usr/bin
+grep -eu grep | | printf cd cd $(pwd) test export awk awk
+/usr/bin test echo cd | awk done "$@" "$1"
+		echo sed --verbose x=1 readonly printf sed test ${HOME}
+		grep 'quoted text' "$1" awk readonly | --verbose printf 'quoted text'
+	cd 'quoted text' cd awk cd ${HOME} sed cd local 'quoted text'
+		"$@" | -eu -eu /usr/bin x=1 printf readonly readonly
+&& "$@" grep local "$@" $(pwd) $(pwd)
+		local then | 'quoted text' /usr/bin | "$@" cd then printf export $(pwd) x=1 readonly
+	done readonly 2>/dev/null x=1 done "$1" --verbose "$@" ${HOME}
+"$1" then echo cd "$1" grep x=1 cd sed $(pwd) 'quoted text' 'quoted text' && local
+	sed local x=1 printf ${HOME} echo done local local && "$1" awk -eu x=1
+/usr/bin "$1" then then "$@" $(pwd) export
+	readonly printf echo "$1" 2>/dev/null
+		/usr/bin cd awk | | awk grep then x=1 then --verbose cd grep /usr/bin
+	echo "$1" test --verbose done ${HOME} --verbose ${HOME} export 2>/dev/null
+	x=1 test awk awk awk export
+"$1" | /usr/bin sed then $(pwd) printf x=1 --verbose local cd awk done
+		${HOME} | | | && printf grep | printf 2>/dev/null "$1" test
+cd readonly local "$@" 2>/dev/null $(pwd) $(pwd) "$1" export "$@" then sed &&
+$(pwd) sed ${HOME} /usr/bin awk grep
+-eu test ${HOME} sed cd export awk 'quoted text'
+	readonly x=1 x=1 | test 2>/dev/null cd 2>/dev/null "$@"
+		sed 2>/dev/null | test 2>/dev/null /usr/bin printf $(pwd)
+	$(pwd) /usr/bin sed "$1" echo echo
+--verbose readonly /usr/bin | | | --verbose echo echo local grep ${HOME}
+	local readonly export test readonly export -eu /usr/bin &&
+	2>/dev/null grep --verbose sed ${HOME} --verbose $(pwd) -eu
+&& grep then x=1 awk echo done then 2>/dev/null readonly --verbose test x=1 ${HOME}
+	export readonly ${HOME} cd $(pwd)
+	cd "$@" done -eu | local | sed test "$1" -eu | printf cd
+		| cd echo x=1 export -eu --verbose readonly printf readonly -eu then
+		--verbose 2>/dev/null readonly readonly $(pwd) readonly cd export test done $(pwd)
+	&& cd 'quoted text' grep cd awk $(pwd)
+	sed cd sed grep grep cd
+echo $(pwd) awk readonly test ${HOME} "$@" "$1" local done sed /usr/bin x=1 readonly
+		${HOME} awk $(pwd) local
+--verbose cd cd export grep readonly
+${HOME} "$@" test $(pwd) sed grep
+	/usr/bin echo echo 'quoted text' then "$1"
+		sed ${HOME} readonly echo 'quoted text' $(pwd) readonly 2>/dev/null
+"$@" | local awk then "$1" grep /usr/bin 'quoted text' "$1" grep done printf
+	--verbose readonly ${HOME} sed grep done && grep ${HOME}
+		local then -eu -eu $(pwd) test $(pwd) then cd awk done then
+test "$1" readonly printf
+		x=1 'quoted text' printf cd echo
+	x=1 local sed done "$1" export
+2>/dev/null printf ${HOME} "$@" local
+awk readonly cd x=1 awk export | $(pwd)
+test /usr/bin printf && grep cd /usr/bin done | -eu "$1" "$@" local
+		| sed readonly sed awk awk export done done x=1
+	$(pwd) echo awk cd printf $(pwd) /usr/bin
+"$@" --verbose local "$1" grep local sed -eu ${HOME} done grep
+		printf sed sed | 2>/dev/null
+	echo -eu done ${HOME} 2>/dev/null --verbose 2>/dev/null
+		--verbose local local grep readonly then
+sed done readonly export
+		--verbose 'quoted text' -eu && 'quoted text' sed awk readonly
+		$(pwd) 2>/dev/null readonly 'quoted text'
+		sed 'quoted text' ${HOME} export awk then export
+	sed export sed local /usr/bin done $(pwd) x=1 cd readonly grep echo done
+	"$1" local 'quoted text' sed local | test 'quoted text' ${HOME} $(pwd)
+test sed $(pwd) readonly | "$@" ${HOME} -eu printf "$@" $(pwd) test printf done
+		echo && -eu test then -eu --verbose
+x=1 local cd "$1" readonly -eu 2>/dev/null
+-eu ${HOME} /usr/bin done $(pwd) sed awk x=1 printf then -eu x=1 && x=1 ${HOME}
+	readonly local awk grep "$1" 'quoted text' -eu cd readonly /usr/bin -eu awk done
+	"$@" sed printf x=1 done | test 2>/dev/null done "$1"
+		"$1" echo test "$1" $(pwd) test printf "$@" -eu test awk 'quoted text' then
+	awk done 2>/dev/null awk ${HOME} readonly --verbose cd $(pwd) cd cd | export
+-eu done done --verbose
+		local --verbose readonly test
+		&& local done echo /usr/bin 2>/dev/null awk printf printf
+	readonly done x=1 echo test cd done cd test local ${HOME} /usr/bin
+cd grep "$1" | x=1 2>/dev/null
+--verbose printf test
+		printf done && ${HOME} readonly done local
+		cd test echo done cd --verbose
+	test echo | local awk done -eu echo readonly echo --verbose && |
+sed 2>/dev/null "$1" echo 'quoted text'
+		readonly test -eu then $(pwd) readonly echo
+${HOME} 'quoted text' && $(pwd) | -eu "$1" --verbose then
+"$1" ${HOME} sed export grep x=1 /usr/bin sed --verbose echo
+-eu printf done && --verbose
+	awk printf | local awk
+	then echo --verbose 'quoted text' printf | "$@" then
+	cd test awk /usr/bin -eu --verbose && $(pwd) "$1" --verbose 2>/dev/null
+		printf ${HOME} printf readonly "$@" echo 'quoted text' ${HOME} 2>/dev/null
+| local 2>/dev/null readonly export cd echo done -eu
+$(pwd) $(pwd) | /usr/bin --verbose "$@" | x=1 sed local x=1 $(pwd) cd -eu export
+	local $(pwd) $(pwd) test done readonly grep | done "$@"
+--verbose 2>/dev/null
+	&& "$1" done local awk x=1 local grep x=1 --verbose test done /usr/bin
+	$(pwd) export -eu cd -eu && echo local && ${HOME}
+2>/dev/null done test
+	-eu 'quoted text' grep /usr/bin readonly "$1" printf "$1" $(pwd)
+export done ${HOME} grep 2>/dev/null
+		"$1" echo && && ${HOME} 'quoted text' printf "$1" "$@" /usr/bin
+export 'quoted text' printf cd /usr/bin
+test local awk test readonly done awk test
+awk export test $(pwd) sed &&
+${HOME} && awk done local done
+	awk 'quoted text' "$@" 2>/dev/null awk 2>/dev/null
+	readonly awk x=1 done --verbose 2>/dev/null done "$@"
+	&& sed export cd then /usr/bin
+		test export $(pwd) ${HOME} grep | cd readonly echo test then
+	readonly ${HOME} | 2>/dev/null grep ${HOME} "$@" | export done --verbose 'quoted text'
+		echo -eu grep --verbose echo -eu readonly
+	--verbose sed test awk then /usr/bin | | -eu readonly readonly
+		"$@" && sed echo 'quoted text' "$@"
+$(pwd) test cd x=1 x=1 | done grep done
+	&& $(pwd) printf "$@" grep | --verbose cd "$1" awk readonly local local readonly
+	cd x=1 test /usr/bin then cd test "$1" 2>/dev/null "$@"
+	sed x=1 export 2>/dev/null 2>/dev/null
+	test && sed ${HOME} --verbose 'quoted text'
+${HOME} --verbose test export -eu cd done grep | "$1" 2>/dev/null
+printf local awk done done cd readonly printf -eu done printf /usr/bin -eu
+		test $(pwd) --verbose /usr/bin "$1" sed awk "$@" export --verbose
+		grep ${HOME} printf --verbose 2>/dev/null /usr/bin awk | /usr/bin "$1" /usr/bin
+		local then readonly sed 2>/dev/null
+-eu "$1" then awk cd /usr/bin "$@" sed 'quoted text' sed test
+	"$1" 'quoted text' 'quoted text' sed
+		${HOME} 2>/dev/null done then export done test awk /usr/bin ${HOME} ${HOME}
+	then -eu /usr/bin sed x=1 && && test 2>/dev/null export echo then &&
+		--verbose "$1" then readonly
+	export "$1" export && awk "$1" /usr/bin /usr/bin cd "$@" ${HOME}
+	export export | cd export then "$@" printf
+	"$1" export then x=1 test $(pwd) | | export
+awk $(pwd) export cd grep awk
+sed 2>/dev/null | awk done "$1" sed 'quoted text' | export
+	readonly $(pwd) test $(pwd) printf 2>/dev/null ${HOME} /usr/bin readonly
+		--verbose local done grep readonly ${HOME} $(pwd) printf | -eu sed "$@" printf
+printf test /usr/bin -eu "$1"
+$(pwd) export then test cd sed test &&
+export "$1" grep cd awk "$@" done echo $(pwd)
+		grep "$1" readonly local export -eu readonly sed "$1" $(pwd) printf /usr/bin
+		/usr/bin done ${HOME} /usr/bin "$@" grep cd awk export readonly 'quoted text'
+		local ${HOME} /usr/bin ${HOME}
+		done export export && readonly 2>/dev/null --verbose echo | test echo /usr/bin grep
+		done -eu printf $(pwd) grep && done then echo test ${HOME} 2>/dev/null
+"$1" 2>/dev/null -eu awk | printf 'quoted text'
+"$1" /usr/bin done 'quoted text' x=1 ${HOME} x=1 'quoted text' test
+	&& | test ${HOME} export $(pwd) done
+"$1" $(pwd) /usr/bin local 'quoted text'
+		readonly cd local awk grep $(pwd) done $(pwd) then
+then && /usr/bin awk ${HOME} done 'quoted text'
+	| "$1" | | grep 'quoted text' $(pwd) "$@" done 'quoted text' | x=1
+test 'quoted text' printf printf cd /usr/bin "$1" export $(pwd) --verbose done
+x=1 x=1 echo echo x=1 done then x=1 readonly 2>/dev/null sed /usr/bin $(pwd)
+		"$1" x=1 -eu ${HOME} "$@"
+	${HOME} done 'quoted text' then x=1 cd echo --verbose grep "$1" awk --verbose 'quoted text'
+	"$@" ${HOME} cd ${HOME} echo /usr/bin ${HOME} sed echo /usr/bin
+		echo "$@" 'quoted text' 2>/dev/null 2>/dev/null /usr/bin 'quoted text' 'quoted text'
+	then | --verbose then export printf test grep test 2>/dev/null ${HOME}
+then 2>/dev/null printf -eu --verbose export
+		awk printf && x=1 ${HOME} cd $(pwd)
+		/usr/bin grep 'quoted text' sed "$@" readonly /usr/bin then
+	sed "$@" export "$@" echo
+${HOME} done cd /usr/bin /usr/bin printf
+cd "$@" sed "$1" export ${HOME} 'quoted text' ${HOME} cd --verbose
+		$(pwd) cd -eu sed grep done printf x=1 grep ${HOME} --verbose $(pwd) sed export
+	awk x=1 readonly done grep echo /usr/bin
+		printf 2>/dev/null --verbose "$1" sed /usr/bin export export printf
+	echo test sed $(pwd) test /usr/bin local then echo export
+	&& /usr/bin x=1 readonly echo /usr/bin cd local |
+/usr/bin awk | done 2>/dev/null "$1" echo $(pwd) sed x=1
+${HOME} $(pwd) "$@" && test awk "$@" x=1 grep
+		--verbose -eu --verbose x=1 /usr/bin then grep x=1 'quoted text'
+test "$@" export printf readonly ${HOME} $(pwd) test done
+sed "$1" 2>/dev/null sed sed ${HOME} -eu "$1"
+local local "$@" test -eu ${HOME} awk readonly && ${HOME} | &&
+done grep cd x=1 then x=1 --verbose cd readonly echo /usr/bin
+	then "$1" printf sed && x=1 readonly export "$1" echo ${HOME} echo
+done then test 2>/dev/null sed 'quoted text' echo 'quoted text' readonly
+		&& && done echo x=1 export x=1 readonly x=1 echo awk done export sed /usr/bin
+printf $(pwd) readonly test ${HOME} echo printf
+${HOME} cd $(pwd) sed printf then then grep x=1 grep "$@" export
+		readonly && /usr/bin 'quoted text' cd export ${HOME} sed
+local awk 2>/dev/null $(pwd) printf
+${HOME} "$1" -eu | ${HOME} "$1" awk /usr/bin export test sed
+		grep printf done "$1" "$@" grep done then "$@" test
+		printf 2>/dev/null grep "$1"
+/usr/bin printf ${HOME} -eu $(pwd)
+	done local export readonly export
+sed echo readonly $(pwd) --verbose 2>/dev/null local -eu x=1 -eu done then
+		&& awk cd test /usr/bin -eu 'quoted text'
+	printf x=1 2>/dev/null | 2>/dev/null 'quoted text' ${HOME} -eu
+		&& export $(pwd) 'quoted text' && sed | then local 2>/dev/null
+| 2>/dev/null local 2>/dev/null
+'quoted text' test export done
+--verbose echo readonly $(pwd) -eu -eu -eu $(pwd) printf x=1
+x=1 readonly printf 2>/dev/null export echo ${HOME} sed done then export
+printf ${HOME} local awk then
+	-eu grep echo awk $(pwd) $(pwd) && readonly
+		export readonly | --verbose
+		| -eu 'quoted text' local | grep 'quoted text' $(pwd) /usr/bin --verbose x=1 |
+	awk awk && ${HOME} awk -eu --verbose "$1" done
+${HOME} && "$1" done $(pwd) /usr/bin done 2>/dev/null ${HOME} 2>/dev/null
+x=1 cd x=1 ${HOME} readonly export awk printf x=1 readonly "$@" grep
+x=1 ${HOME} 2>/dev/null | echo local grep sed printf readonly -eu && &&
+		x=1 x=1 && x=1 "$@" 2>/dev/null
+	2>/dev/null echo readonly 2>/dev/null | "$@" "$@" x=1 /usr/bin x=1 ${HOME}
+	x=1 /usr/bin test export printf $(pwd) grep grep echo -eu x=1 'quoted text'
+	'quoted text' /usr/bin printf
+grep | cd | 'quoted text' ${HOME}
+done export echo 'quoted text' /usr/bin cd -eu printf
+"$1" -eu --verbose x=1 -eu done then "$@" 2>/dev/null | echo echo /usr/bin
+		export $(pwd) --verbose --verbose x=1 local cd ${HOME} then
+	sed then $(pwd) --verbose local test /usr/bin readonly export -eu
+		${HOME} 2>/dev/null -eu && local local 2>/dev/null
+		--verbose grep done awk grep ${HOME} grep readonly "$@" done 'quoted text'
+	$(pwd) $(pwd) local "$@" grep then sed echo
+/usr/bin 2>/dev/null grep echo
+echo test printf /usr/bin "$@" awk local test x=1 -eu
+		test grep -eu 2>/dev/null && "$1" && --verbose then --verbose
+		"$@" && --verbose export cd sed echo then "$1" /usr/bin test done
+-eu -eu 2>/dev/null readonly $(pwd) 2>/dev/null ${HOME} cd echo awk /usr/bin
+	awk awk $(pwd) -eu "$@" "$1"
+		readonly sed $(pwd) /usr/bin done && | printf x=1 2>/dev/null then
+cd grep printf --verbose sed | printf echo
+		sed 'quoted text' echo -eu /usr/bin
+		x=1 test grep $(pwd) local x=1 2>/dev/null test echo echo export awk
+		$(pwd) grep export /usr/bin
+	| "$@" ${HOME} export echo && grep cd ${HOME} done readonly done --verbose
+	/usr/bin grep /usr/bin printf test test sed $(pwd) export local readonly
+		then export test local /usr/bin
+	--verbose awk awk grep then readonly -eu | | $(pwd) x=1
+	test | readonly ${HOME} sed
+		printf | "$@" | then | --verbose $(pwd) export sed $(pwd) ${HOME} printf awk
+		${HOME} "$1" readonly done awk export 2>/dev/null
+	"$@" printf /usr/bin cd "$1" echo echo 'quoted text' "$1" grep /usr/bin
+${HOME} sed awk /usr/bin x=1
+		$(pwd) | test ${HOME} --verbose
+	2>/dev/null 'quoted text' sed 'quoted text' "$1" /usr/bin awk ${HOME}
+	2>/dev/null 2>/dev/null printf grep 2>/dev/null $(pwd)
+	${HOME} "$1" sed awk --verbose readonly --verbose
+		x=1 done cd readonly | awk awk readonly sed
+		printf awk done "$1" echo sed 2>/dev/null 'quoted text'
+		x=1 x=1 done | cd --verbose echo echo export
+	-eu cd test readonly "$@" /usr/bin && /usr/bin x=1 "$1"
+	"$1" grep done awk --verbose -eu $(pwd) awk export && -eu 2>/dev/null
+		&& 'quoted text' awk printf printf /usr/bin awk
+&& grep done sed then | export then done |
+-eu cd local "$1" x=1 x=1 -eu 2>/dev/null 'quoted text'
+	--verbose grep done ${HOME}
+	export 'quoted text' x=1 then ${HOME} | sed cd /usr/bin local
+	awk readonly --verbose echo grep cd ${HOME} | /usr/bin test &&
+${HOME} local "$@" export readonly && cd awk sed test | awk
+		-eu done x=1 "$@" sed
+		&& echo | $(pwd) /usr/bin 2>/dev/null ${HOME} "$@" cd 'quoted text'
+	&& echo cd x=1 ${HOME} x=1
+$(pwd) test -eu -eu $(pwd) x=1 sed sed sed 2>/dev/null -eu /usr/bin | cd cd awk
+	"$1" ${HOME} x=1 test done
+echo "$@" | export "$@" grep sed test
+readonly echo printf "$1" sed $(pwd) done done grep -eu 2>/dev/null printf --verbose
+x=1 echo $(pwd) awk | /usr/bin
+${HOME} cd export /usr/bin 2>/dev/null done
+		2>/dev/null 2>/dev/null ${HOME}
+		echo then echo awk local echo $(pwd)
+| "$@" | $(pwd) cd --verbose
+	&& export ${HOME} awk -eu ${HOME} printf x=1 --verbose "$1"
+/usr/bin 2>/dev/null done test /usr/bin
+	"$1" done x=1 -eu x=1 done then x=1 sed ${HOME} ${HOME} printf $(pwd)
+&& -eu --verbose $(pwd) sed awk | x=1 "$1" x=1 $(pwd) export ${HOME}
+	sed test -eu printf local && --verbose 2>/dev/null && export
+		test printf sed then --verbose && | | done
+readonly echo awk 2>/dev/null done -eu cd 2>/dev/null
+	cd export sed printf -eu echo 2>/dev/null ${HOME} ${HOME}
+	| echo x=1 /usr/bin sed $(pwd)
+		'quoted text' x=1 grep readonly /usr/bin
+2>/dev/null x=1 ${HOME} /usr/bin /usr/bin
+"$@" --verbose 'quoted text' 'quoted text'
+cd export && --verbose sed
+	printf echo && --verbose echo
+		/usr/bin 2>/dev/null test test grep done ${HOME} /usr/bin test test &&
+	echo /usr/bin /usr/bin && done && export x=1 export done awk --verbose awk local
+grep awk ${HOME} "$1" test "$@" 2>/dev/null awk grep "$@" /usr/bin export
+	echo $(pwd) sed test cd done --verbose 'quoted text'
+	local cd 2>/dev/null --verbose -eu && x=1 local readonly
+	-eu ${HOME} "$1" printf 'quoted text'
+	grep -eu "$@" /usr/bin "$@" test -eu /usr/bin "$@" awk then grep
+	grep /usr/bin $(pwd) awk x=1 "$@"
+local --verbose "$1" done && 2>/dev/null awk
+local "$@" 'quoted text' grep test --verbose sed export cd | ${HOME} export
+	'quoted text' ${HOME} "$1" ${HOME} 2>/dev/null $(pwd) "$@"
+	local 'quoted text' ${HOME} grep && echo --verbose
+${HOME} local grep export awk && export then /usr/bin
+		printf echo printf test 2>/dev/null awk
+		--verbose 2>/dev/null local test "$@" 2>/dev/null 2>/dev/null ${HOME} readonly
+		readonly awk export ${HOME} $(pwd) "$@" --verbose "$@" $(pwd) awk "$@" | $(pwd)
+readonly test --verbose printf
+"$@" | echo --verbose cd done export echo readonly
+	grep done "$1" test awk ${HOME} "$1" | echo test "$1"
+		'quoted text' printf --verbose grep readonly echo readonly sed awk
+readonly $(pwd) "$1" local &&
+-eu export then cd $(pwd) x=1 readonly echo echo x=1 cd --verbose -eu printf
+cd cd "$@" then test echo "$1" cd test done readonly
+	--verbose then sed cd $(pwd) --verbose sed && -eu
+readonly test && echo 2>/dev/null grep x=1 /usr/bin local echo x=1
+x=1 $(pwd) sed done done printf -eu readonly
+		--verbose "$1" | "$1" then readonly "$1" readonly ${HOME} 'quoted text' echo
+	| then --verbose /usr/bin ${HOME} "$1" done /usr/bin echo grep test
+		| /usr/bin | 2>/dev/null awk x=1 'quoted text'
+	-eu test then $(pwd) test && printf ${HOME}
+echo awk awk 'quoted text' cd test -eu
+	&& "$1" -eu --verbose done
+	sed -eu sed --verbose "$@" 2>/dev/null sed echo sed
+grep then done test printf export ${HOME} 2>/dev/null
+		--verbose test 2>/dev/null && "$1" readonly done &&
+sed done test "$@" echo $(pwd) export "$@"
+cd "$1" echo then x=1 local local | && sed printf
+		grep "$@" echo "$1" awk sed then | "$@" "$@" $(pwd) export /usr/bin "$1" done done
+-eu $(pwd) "$1" export --verbose -eu -eu done 2>/dev/null test x=1 awk
+	cd $(pwd) sed 'quoted text' grep echo readonly done | grep
+	$(pwd) /usr/bin && readonly export export local /usr/bin
+cd "$@" readonly test --verbose /usr/bin $(pwd) 'quoted text'
+	cd x=1 then && grep | --verbose export $(pwd)
+readonly awk --verbose printf sed awk "$@" $(pwd) grep readonly --verbose
+		printf test /usr/bin --verbose done then $(pwd) x=1 --verbose local 2>/dev/null
+awk | grep echo echo "$1" readonly
+	readonly $(pwd) echo "$@" cd 2>/dev/null done cd test
+	x=1 "$@" awk ${HOME} done then ${HOME} readonly
+		done printf awk x=1 ${HOME} x=1 export local /usr/bin && -eu local
+test then ${HOME} | awk grep | printf export
+		x=1 cd echo $(pwd) --verbose 2>/dev/null "$1" 'quoted text'
+local done x=1 echo printf /usr/bin x=1 $(pwd) ${HOME} 'quoted text'
+x=1 then | sed sed --verbose 'quoted text'
+		"$1" printf 2>/dev/null export done sed 'quoted text'
+	"$@" local test ${HOME} /usr/bin
+	| --verbose ${HOME} $(pwd) echo "$1" local "$1" export "$1" readonly "$1" then
+		readonly $(pwd) "$1" "$1" "$1" sed "$1" "$1" readonly done 2>/dev/null printf
+		"$1" grep done /usr/bin grep x=1 ${HOME} -eu local cd "$@" /usr/bin $(pwd) /usr/bin
+	readonly --verbose /usr/bin grep then export $(pwd) grep export /usr/bin
+done | echo sed echo then sed readonly grep local local
+	2>/dev/null 'quoted text' done && test then then readonly export ${HOME}
+local sed readonly cd | grep x=1 then x=1 local "$@" "$@" test /usr/bin
+		awk 'quoted text' -eu $(pwd) done -eu /usr/bin local "$@"
+echo 'quoted text' printf /usr/bin
+	x=1 cd "$@" export "$@" local "$@" 2>/dev/null
+echo then /usr/bin cd cd readonly export test local
+| export ${HOME} /usr/bin test printf --verbose
+		then printf awk $(pwd) /usr/bin cd --verbose "$@"
+readonly "$1" | -eu printf export printf -eu | --verbose printf -eu
+	${HOME} 2>/dev/null echo ${HOME} 'quoted text' sed -eu x=1 "$1" &&
+	readonly then --verbose 2>/dev/null
+	echo 2>/dev/null && cd echo readonly "$1" $(pwd)
+"$1" 2>/dev/null export readonly x=1 'quoted text'
+"$1" "$1" "$1" | x=1 readonly cd -eu export -eu cd | grep | printf then
+-eu 2>/dev/null x=1 | 2>/dev/null
+	echo && $(pwd) ${HOME} "$@" "$@" then --verbose then | test
+${HOME} printf $(pwd) -eu grep /usr/bin printf
+	sed then export test --verbose $(pwd)
+	local -eu sed x=1 | "$@" "$@" then echo -eu x=1
+		done -eu $(pwd) test local grep local --verbose
+		-eu awk 'quoted text' echo 'quoted text'
+	"$1" cd -eu cd test test sed export
+	'quoted text' --verbose /usr/bin test ${HOME}
+		sed "$1" done /usr/bin cd --verbose then then && --verbose /usr/bin cd echo |
+		sed | | cd readonly export export sed | /usr/bin awk cd ${HOME} 2>/dev/null
+${HOME} | done 2>/dev/null -eu test /usr/bin then awk done done
+	$(pwd) readonly test export --verbose /usr/bin sed ${HOME}
+		x=1 export then sed 'quoted text' done | && printf
+		grep -eu && ${HOME} 'quoted text' then x=1
+| --verbose 'quoted text' $(pwd) cd "$1" echo printf done ${HOME} ${HOME} /usr/bin
+		cd -eu done | printf 'quoted text' sed
+		echo test --verbose sed grep printf
+		export x=1 "$@" export x=1 | 2>/dev/null printf x=1 test local local export
+	2>/dev/null "$1" $(pwd) 2>/dev/null 2>/dev/null readonly sed export readonly printf
+		/usr/bin cd && --verbose test echo x=1
+	local export "$@" test test done done /usr/bin sed /usr/bin
+		export readonly printf printf
+--verbose $(pwd) "$1" x=1 grep --verbose | awk 'quoted text'
+	export then 'quoted text' -eu 'quoted text'
+| readonly "$@" then printf 'quoted text' sed 2>/dev/null
+local "$@" local 2>/dev/null 2>/dev/null then "$@" test $(pwd) --verbose
+${HOME} export ${HOME} && printf -eu --verbose && sed "$1" "$@" done
+	then "$1" --verbose ${HOME} && 2>/dev/null
+		--verbose x=1 echo echo 'quoted text' 2>/dev/null
+grep && 'quoted text' printf grep echo printf x=1
+awk grep --verbose awk
+	"$@" "$@" x=1 grep | local done cd ${HOME} readonly done /usr/bin grep /usr/bin
+		then local "$@" then sed && test done
+	local local -eu grep printf printf --verbose $(pwd) -eu done
+		awk x=1 test done | 'quoted text'
+	/usr/bin readonly 'quoted text' "$1" "$1" ${HOME} printf
+	readonly grep 2>/dev/null -eu
+	test then ${HOME} then -eu cd |
+	2>/dev/null grep done sed readonly echo --verbose 'quoted text' 'quoted text'
+		&& --verbose test sed cd -eu -eu readonly test 'quoted text' ${HOME}
+		grep local x=1 && ${HOME}
+	test done then export 'quoted text'
+	| -eu local "$1" "$@" -eu grep x=1 --verbose local | | 2>/dev/null
+	${HOME} /usr/bin local
+		local done then x=1 | x=1 readonly /usr/bin
+		2>/dev/null cd sed sed cd "$1" | "$1" --verbose x=1 local grep done 'quoted text'
+		'quoted text' printf | test awk x=1 echo cd cd then $(pwd) "$1"
+		awk x=1 readonly awk cd 2>/dev/null x=1 2>/dev/null
+		awk local --verbose && readonly
+		cd "$@" readonly awk awk readonly
+readonly 2>/dev/null
+	${HOME} test cd "$1" "$@" 2>/dev/null
+	2>/dev/null $(pwd) -eu --verbose then $(pwd) /usr/bin 'quoted text'
+		'quoted text' $(pwd) "$1" then local sed awk && --verbose
+		local echo grep 'quoted text' then grep sed 2>/dev/null printf
+		test 2>/dev/null test grep readonly
+		cd awk local test -eu | grep
+test 'quoted text' cd sed sed --verbose "$@" 'quoted text'
+'quoted text' test sed cd | ${HOME} then --verbose echo 2>/dev/null
+echo $(pwd) readonly "$@" export sed echo --verbose
+grep sed awk local cd 2>/dev/null
+		done /usr/bin test && -eu done -eu x=1 |
+		sed test /usr/bin printf awk --verbose $(pwd) then x=1 cd /usr/bin | ${HOME}
+local then $(pwd) echo && "$1" x=1 | printf | && grep 2>/dev/null
+		$(pwd) "$@" | sed $(pwd) -eu printf awk ${HOME} "$@" readonly
+		echo && cd ${HOME} test -eu 'quoted text' "$@" done export --verbose /usr/bin
+then awk export done grep $(pwd) && awk printf $(pwd) awk readonly x=1
+local x=1 "$1" | awk -eu local 2>/dev/null
+		"$1" x=1 x=1 x=1 $(pwd) /usr/bin --verbose
+		"$1" grep && cd then && echo
+	2>/dev/null echo cd printf done | then $(pwd) awk ${HOME} export export | sed
+sed echo grep readonly
+		"$1" "$1" done sed done 'quoted text'
+		cd test readonly "$1" export "$@" "$1" | then printf | x=1 export test
+		/usr/bin 'quoted text' /usr/bin export local "$1" export test 2>/dev/null $(pwd)
+		readonly | printf printf ${HOME} export x=1 grep /usr/bin
+	"$@" done 2>/dev/null grep && /usr/bin grep x=1 cd echo printf --verbose
+local test export "$@" -eu ${HOME} $(pwd) awk cd sed
+cd "$1" ${HOME} && local -eu -eu printf 2>/dev/null done readonly --verbose 2>/dev/null
+		test sed readonly "$@" "$1"
+#include c180.sh
+sed then grep done printf grep local readonly sed readonly grep grep 2>/dev/null
+2>/dev/null x=1 awk | then export cd sed echo
+sed -eu local "$1" | test -eu $(pwd) sed grep ${HOME} done 'quoted text'
+cd 'quoted text' && && readonly
+sed readonly $(pwd) 2>/dev/null done echo "$@" done
+		test readonly $(pwd) /usr/bin x=1
+$(pwd) "$1" grep | ${HOME} grep
+&& ${HOME} x=1 done "$@" 'quoted text' "$@" | x=1 awk awk test done grep
+		printf 2>/dev/null readonly /usr/bin | awk ${HOME} 2>/dev/null -eu sed
+		grep 'quoted text' export -eu "$1"
+	| done -eu --verbose && --verbose awk "$1" $(pwd) /usr/bin
+		local "$1" $(pwd) echo sed
+		readonly grep /usr/bin /usr/bin | ${HOME} $(pwd) x=1
+	done "$@" | ${HOME} then readonly
+	then "$@" -eu $(pwd) $(pwd) | ${HOME} 'quoted text' test grep test "$@" 'quoted text'
+grep "$1" 2>/dev/null then 2>/dev/null x=1 done
+	then readonly "$1" ${HOME} $(pwd) --verbose "$@" && awk grep
+printf && awk echo export export
+	x=1 readonly && "$@" readonly
+	"$@" 2>/dev/null export sed "$@" ${HOME} x=1 echo && printf
+	/usr/bin 'quoted text' printf grep
+export "$@" 2>/dev/null -eu printf ${HOME} /usr/bin cd "$@" /usr/bin then
+"$@" -eu ${HOME} readonly grep then ${HOME} echo /usr/bin export
+		"$1" -eu ${HOME} | cd local ${HOME}
+		&& 'quoted text' awk ${HOME} export -eu -eu ${HOME} then readonly
+cd done x=1 x=1 sed $(pwd) | $(pwd) printf
+	--verbose 2>/dev/null 'quoted text' && ${HOME} ${HOME} $(pwd) sed /usr/bin readonly
+		grep export export "$1" 'quoted text' | "$@" $(pwd) "$@" printf export readonly
+	test then local "$1" echo 'quoted text' 'quoted text'
+${HOME} test readonly 2>/dev/null ${HOME} echo test 2>/dev/null cd test
+2>/dev/null -eu x=1 sed
+		sed readonly printf $(pwd) 'quoted text' x=1 sed echo cd local x=1 && "$1"
+		export local 'quoted text' printf readonly cd awk x=1 grep echo
+	then echo sed && grep 'quoted text' done --verbose | && sed --verbose
+		${HOME} /usr/bin done export && local
+done local x=1 grep export "$@" "$1" grep /usr/bin
+		$(pwd) readonly cd printf ${HOME} 'quoted text' sed test
+-eu "$@" cd 'quoted text' "$1" done local sed export /usr/bin ${HOME}
+	2>/dev/null sed test ${HOME} 2>/dev/null | 'quoted text' | echo then 'quoted text'
+		printf local printf /usr/bin
+	x=1 test readonly local
+		--verbose done grep test echo | 2>/dev/null done
+grep "$@" grep "$1" x=1 done | 2>/dev/null 'quoted text' printf then grep done "$@"
+	${HOME} grep readonly awk grep
+		local "$@" "$@" awk 'quoted text' then
+		2>/dev/null | test cd grep echo "$@"
+	sed done echo awk readonly
+	local 'quoted text' test -eu "$@" done /usr/bin then done --verbose $(pwd) x=1
+		| "$@" done /usr/bin "$@"
+local -eu readonly 2>/dev/null 2>/dev/null echo readonly awk $(pwd)
+sed echo x=1 readonly then grep sed readonly $(pwd) readonly awk export x=1 $(pwd)
+		x=1 printf export test 'quoted text' done /usr/bin cd "$@" && printf $(pwd)
+	echo /usr/bin "$@" /usr/bin done readonly ${HOME}
+cd awk "$@" done $(pwd) local grep echo $(pwd) --verbose cd && then
+cd /usr/bin && /usr/bin then then
+export $(pwd) /usr/bin --verbose "$1" x=1 --verbose local
+	$(pwd) /usr/bin ${HOME} readonly -eu
+		then export -eu export 'quoted text'
+	2>/dev/null /usr/bin x=1 local done echo export echo "$1" 'quoted text' done
+grep /usr/bin 'quoted text' sed readonly printf ${HOME} awk test printf echo
+		grep $(pwd) awk local local 'quoted text' /usr/bin test local 2>/dev/null readonly
+		sed x=1 done grep 'quoted text' local --verbose then x=1 --verbose
+		$(pwd) 'quoted text' "$1" --verbose x=1 /usr/bin /usr/bin $(pwd) x=1 readonly local
+	then --verbose then test sed printf awk readonly
+export readonly done sed awk local
+then 'quoted text' export x=1 $(pwd) readonly cd done && ${HOME} --verbose 2>/dev/null
+		cd printf 2>/dev/null then /usr/bin readonly 2>/dev/null sed grep 'quoted text'
+	--verbose sed grep awk $(pwd) --verbose "$1" "$1" && done cd local "$@" x=1 local
+		/usr/bin export grep ${HOME} 2>/dev/null export grep readonly 'quoted text'
+		$(pwd) then echo export -eu then -eu awk awk echo sed readonly 'quoted text'
+		| sed local && then 2>/dev/null --verbose readonly readonly
+	-eu grep local printf && /usr/bin 'quoted text' 'quoted text'
+done x=1 printf "$1" /usr/bin $(pwd)
+readonly cd done "$@" 'quoted text' printf test sed local ${HOME}
+		local awk done sed x=1
+	"$1" awk "$1" "$@" "$1" then awk && local 'quoted text'
+	x=1 local local --verbose
+	cd test then grep 'quoted text' --verbose /usr/bin cd then 2>/dev/null ${HOME}
+	sed $(pwd) test | x=1 2>/dev/null --verbose
+		printf awk "$1" /usr/bin /usr/bin cd
+then grep $(pwd) --verbose grep ${HOME} cd then printf
+local /usr/bin done --verbose sed $(pwd) /usr/bin readonly "$@"
+	"$1" x=1 | local --verbose && done ${HOME} "$1" echo awk $(pwd)
+	readonly "$1" "$1" export
+		printf local && grep --verbose && 2>/dev/null
+x=1 echo then sed then printf export ${HOME} readonly 'quoted text'
+--verbose 2>/dev/null test readonly done awk x=1 local printf grep | --verbose local
+	-eu x=1 cd readonly 2>/dev/null test sed && cd | grep awk export readonly
+		| sed sed export 'quoted text'
+		export cd awk export sed test local local $(pwd) export readonly then
+-eu local readonly 'quoted text' "$@"
+	then "$1" local /usr/bin 2>/dev/null
+"$1" local 2>/dev/null --verbose cd -eu -eu test grep | ${HOME}
+	'quoted text' grep then
+		sed sed sed cd export cd -eu then x=1 local
+	/usr/bin $(pwd) "$@" -eu then $(pwd) /usr/bin grep ${HOME}
+		then "$1" x=1 -eu sed 2>/dev/null
+		2>/dev/null 'quoted text' test done | | "$1" export cd cd readonly
+-eu export --verbose then $(pwd) echo awk /usr/bin local test then local
+done then "$1" test sed done && cd cd ${HOME} "$@" && sed test
+	readonly && ${HOME} grep 2>/dev/null printf |
+/usr/bin done -eu ${HOME} | printf x=1 | grep
+		grep --verbose local awk export
+		sed printf 2>/dev/null done readonly test awk then
+		&& test awk 'quoted text'
+	${HOME} "$1" test printf local cd awk && 'quoted text' $(pwd) test echo grep "$@"
+		local | 2>/dev/null printf "$1" "$@" readonly
+--verbose --verbose local 'quoted text' readonly grep local sed test "$@" 'quoted text'
+&& printf sed sed sed cd readonly $(pwd) then sed
+&& sed sed -eu echo then "$1" x=1 local done &&
+	test "$1" && -eu readonly cd 'quoted text' done export $(pwd) 2>/dev/null
+	awk -eu x=1 $(pwd) readonly test ${HOME} --verbose && $(pwd)
+readonly && "$1" sed $(pwd) 'quoted text' export
+/usr/bin export 2>/dev/null "$1" "$@" x=1
+'quoted text' ${HOME} $(pwd) echo grep -eu then done grep awk -eu | x=1 &&
+cd echo export cd ${HOME}
+	| grep test then grep x=1 echo x=1 then ${HOME} -eu /usr/bin
+echo awk && 2>/dev/null cd 2>/dev/null /usr/bin x=1
+		2>/dev/null && -eu | export
+-eu 2>/dev/null grep printf done printf $(pwd) $(pwd) ${HOME} "$@"
+		-eu awk 2>/dev/null done printf sed export
+		echo "$1" done | test | ${HOME} then 2>/dev/null x=1
+		"$@" echo grep "$@" printf $(pwd) ${HOME}
+"$@" | | test $(pwd) 2>/dev/null
+readonly printf "$@" export done readonly ${HOME}
+2>/dev/null grep 2>/dev/null test
+	2>/dev/null export echo $(pwd) && printf "$1" then "$@" /usr/bin "$1"
+--verbose echo cd echo 2>/dev/null export printf ${HOME}
+		then printf /usr/bin && cd awk x=1 test readonly done "$@"
+		readonly x=1 sed x=1 -eu "$@" awk x=1 cd
+then x=1 sed "$1" grep 2>/dev/null sed test --verbose
+then && then echo -eu then test export
+'quoted text' --verbose grep awk --verbose ${HOME}
+| done -eu 2>/dev/null | echo sed "$1" -eu "$1" readonly export cd 2>/dev/null "$@"
+	/usr/bin printf local "$@" /usr/bin cd
+/usr/bin sed readonly export test "$@" grep then done "$1" echo
+2>/dev/null && | "$@" printf
+	-eu | | x=1 awk "$@" echo x=1 awk $(pwd) ${HOME} test
+awk $(pwd) done "$@" done test grep
+		done --verbose /usr/bin done printf local $(pwd) echo sed sed
+grep printf done "$1" 2>/dev/null x=1 then 'quoted text'
+		x=1 && test x=1 ${HOME} grep x=1 | /usr/bin local local ${HOME}
+grep sed readonly 'quoted text' "$1" "$1" ${HOME} export printf
+&& 2>/dev/null local test sed then --verbose ${HOME}
+	$(pwd) "$1" sed grep -eu export sed readonly export
+	2>/dev/null --verbose && x=1 /usr/bin sed local sed x=1
+	then -eu "$1" $(pwd) x=1 sed ${HOME} awk
+	export test echo $(pwd) grep "$1" readonly
+		"$@" $(pwd) ${HOME} "$1" then 2>/dev/null test readonly done echo
+/usr/bin | --verbose ${HOME} then printf printf
+		grep printf local && 2>/dev/null ${HOME} "$@" && 2>/dev/null printf
+'quoted text' $(pwd) then grep printf export cd test "$@" readonly
+export ${HOME} test --verbose /usr/bin
+		'quoted text' sed then -eu awk echo readonly "$1" --verbose
+"$@" && cd grep -eu 2>/dev/null
+		done export then $(pwd) && && $(pwd) 'quoted text' --verbose | -eu /usr/bin
+| ${HOME} ${HOME} ${HOME} printf test ${HOME}
+-eu && cd cd && 2>/dev/null readonly cd -eu -eu $(pwd) local $(pwd)
+		--verbose /usr/bin "$@" "$@" sed 2>/dev/null local awk export printf test --verbose
+cd 'quoted text' ${HOME} awk printf awk local sed
+printf echo | test "$@" printf local echo && "$@" local && $(pwd) "$@"
+-eu $(pwd) "$1" local | /usr/bin sed 'quoted text'
+	"$@" "$1" 'quoted text' echo | test && /usr/bin | --verbose | 2>/dev/null
+	2>/dev/null grep printf done sed | export readonly
+		$(pwd) local "$1" | done cd "$@" ${HOME} | ${HOME} sed done "$@" then test
+2>/dev/null local 'quoted text'
+local readonly x=1 readonly grep cd -eu
+	awk done 'quoted text' awk grep local "$1" done -eu "$@" done x=1 "$1" local |
+		${HOME} test --verbose --verbose ${HOME}
+	cd cd $(pwd) | local cd $(pwd) done sed echo -eu grep /usr/bin "$@" export
+	"$@" test $(pwd) | && /usr/bin ${HOME} echo echo cd && | grep && "$@" -eu | 'quoted text'
+export then test export export grep local
+		done grep done cd 2>/dev/null test && $(pwd) grep echo $(pwd) 2>/dev/null
+		'quoted text' sed done awk -eu printf && echo
+	x=1 && cd awk then ${HOME} "$@" | sed /usr/bin "$@" "$1" export echo cd
+		x=1 --verbose sed awk
+		x=1 sed sed $(pwd) local
+grep sed grep awk && -eu && readonly /usr/bin done
+		done local x=1 readonly done export grep cd $(pwd) 2>/dev/null x=1
+		sed sed readonly 'quoted text' done && && test printf grep printf export "$@"
+2>/dev/null local | "$@" echo local then sed "$1"
+		cd done ${HOME} awk && grep printf grep done sed --verbose
+		--verbose x=1 echo sed && ${HOME} /usr/bin "$1" then
+	"$@" readonly awk test && echo "$1" then done && awk echo grep $(pwd)
+		2>/dev/null then awk awk "$1" export then done
+"$1" then x=1 test -eu then "$1" export -eu -eu /usr/bin -eu
+then 2>/dev/null "$1" "$@" -eu | --verbose
+	done --verbose 2>/dev/null | grep
+	export /usr/bin $(pwd) echo echo $(pwd) ${HOME} x=1 'quoted text' echo
+		awk sed --verbose local sed | ${HOME} printf /usr/bin /usr/bin cd echo
+	readonly readonly | awk printf grep readonly --verbose "$@" awk sed /usr/bin x=1
+-eu /usr/bin "$1" done
+		'quoted text' grep 2>/dev/null cd /usr/bin grep test echo 'quoted text'
+then "$@" readonly "$@" local done done echo echo
+		readonly x=1 && "$@" readonly grep readonly export && echo $(pwd) grep 2>/dev/null
+		done 2>/dev/null "$1" cd echo printf sed printf
+x=1 2>/dev/null sed local awk | local sed "$@" test x=1 test readonly
+		cd "$1" | && "$@" "$@" echo export
+	"$1" -eu $(pwd) $(pwd) | awk done printf cd cd $(pwd) grep done echo
+awk done x=1 echo && | printf /usr/bin | -eu sed local awk test grep | x=1 readonly
+	/usr/bin awk local local --verbose
+	printf 2>/dev/null done "$@" 'quoted text'
+		cd then "$1" -eu sed printf
+	| && export test awk export "$@" ${HOME} "$1" "$@" test grep grep /usr/bin &&
+readonly $(pwd) cd $(pwd) -eu "$@" grep echo -eu
+readonly --verbose export
+&& 'quoted text' export /usr/bin "$@" echo awk test ${HOME} grep
+	test cd 2>/dev/null 2>/dev/null
+		x=1 cd $(pwd) cd --verbose
+		"$1" "$1" --verbose | done ${HOME} echo -eu test cd 2>/dev/null
+"$@" readonly 2>/dev/null | local $(pwd) ${HOME}
+		export echo | done -eu "$1" awk x=1 && $(pwd) sed && ${HOME} /usr/bin echo
+		cd /usr/bin $(pwd) grep then ${HOME} readonly &&
+sed echo readonly -eu --verbose then ${HOME} done
+		cd grep test local "$1" readonly local --verbose printf awk readonly
+		sed 'quoted text' x=1 "$@" then sed 2>/dev/null awk export -eu ${HOME}
+		"$1" x=1 $(pwd) awk echo 2>/dev/null ${HOME} ${HOME}
+	sed echo 'quoted text' | x=1 printf awk /usr/bin
+	--verbose ${HOME} --verbose
+printf $(pwd) 2>/dev/null awk &&
+		printf /usr/bin test then
+	awk --verbose 2>/dev/null -eu echo test done test then sed export ${HOME}
+	"$1" export 2>/dev/null then x=1 awk | sed then awk export local && "$@" "$1"
+		"$@" test then done $(pwd)
+		export 'quoted text' "$@" grep x=1 'quoted text' cd awk -eu grep | grep grep
+	grep printf readonly "$1"
+		| awk cd x=1 test sed 2>/dev/null readonly "$1" sed echo 2>/dev/null printf
+echo printf grep "$@" | cd --verbose &&
+		"$1" local printf local done cd 2>/dev/null test grep && | cd 'quoted text'
+| readonly x=1 | "$@" && /usr/bin x=1 -eu
+		| -eu grep readonly echo test then cd printf ${HOME} 'quoted text'
+		x=1 --verbose $(pwd) grep test $(pwd) /usr/bin
+	&& sed then awk ${HOME} "$1" test sed printf
+		local awk ${HOME} 2>/dev/null
+	"$1" 2>/dev/null done --verbose
+		${HOME} sed echo "$@" sed
+test cd $(pwd) cd && --verbose echo | /usr/bin ${HOME} sed x=1 -eu export local
+		echo echo "$@" 'quoted text' awk
+	grep -eu ${HOME} ${HOME} ${HOME} | ${HOME} x=1 echo 'quoted text' grep
+	done done done export printf echo done sed 'quoted text' && awk awk awk local
+		local cd /usr/bin readonly test done --verbose awk ${HOME} /usr/bin grep sed /usr/bin
+	$(pwd) done readonly echo
+	echo "$@" done | export sed local then /usr/bin -eu
+		printf sed awk sed && test local test 'quoted text' local --verbose grep
+		local local ${HOME} --verbose done then "$@" local
+		export test && | grep local 2>/dev/null
+		"$1" sed local --verbose /usr/bin sed cd test x=1 cd printf printf then done
+	sed "$@" 2>/dev/null 'quoted text' 'quoted text' --verbose "$1"
+	${HOME} readonly --verbose 2>/dev/null
+	$(pwd) /usr/bin cd x=1
+	--verbose test export
+		&& /usr/bin readonly then export cd && sed test 'quoted text' awk
+		x=1 local cd x=1 test --verbose -eu 2>/dev/null --verbose
+		x=1 && "$1" 'quoted text' grep echo
+--verbose | "$@" readonly "$1" x=1 printf local "$1"
+	printf /usr/bin done /usr/bin grep done 'quoted text'
+	then 'quoted text' "$1" | /usr/bin $(pwd) printf then sed test grep cd
+		--verbose done ${HOME} 'quoted text' 'quoted text'
+		--verbose ${HOME} cd readonly grep "$@" echo sed test ${HOME}
+		| grep sed local printf local echo readonly test echo --verbose
+export "$@" && 'quoted text' ${HOME} ${HOME}
+test "$@" $(pwd) 'quoted text' sed /usr/bin -eu "$@" 'quoted text' echo cd local
+		readonly awk -eu printf "$1" export && && $(pwd) done
+"$1" local "$@" --verbose export echo readonly 2>/dev/null local -eu
+	echo awk -eu 2>/dev/null --verbose
+x=1 readonly --verbose echo printf --verbose ${HOME} x=1
+	readonly readonly /usr/bin && cd | echo && export | cd local done
+$(pwd) awk grep 2>/dev/null "$@" && grep
+	echo sed grep test $(pwd) 2>/dev/null then then 'quoted text'
+		then echo readonly then local /usr/bin
+readonly grep readonly sed 2>/dev/null $(pwd) done | 'quoted text' echo
+-eu done printf "$1" "$1" awk
+readonly ${HOME} --verbose 2>/dev/null "$@" /usr/bin awk && $(pwd) | echo 2>/dev/null
+$(pwd) grep "$1" test cd 2>/dev/null | 'quoted text' "$1" local "$1"
+	'quoted text' 2>/dev/null then then /usr/bin then
+test done grep 2>/dev/null grep | awk then && -eu x=1
+	sed awk done | printf ${HOME} done -eu 'quoted text' | 'quoted text'
+		${HOME} awk | grep grep && sed grep $(pwd)
+	cd /usr/bin ${HOME} sed /usr/bin 2>/dev/null test $(pwd) sed awk printf sed done
+		2>/dev/null sed export --verbose ${HOME} | sed "$@" &&
+awk readonly local x=1 sed echo | export echo --verbose then $(pwd) printf local
+		awk awk ${HOME} cd 'quoted text' done /usr/bin then 2>/dev/null
+"$@" $(pwd) --verbose test
+	awk && readonly echo 'quoted text' then awk
+		2>/dev/null -eu /usr/bin
+	done printf x=1 2>/dev/null
+		done /usr/bin local echo local then awk echo $(pwd) grep grep local cd
+$(pwd) "$@" && | ${HOME} done test -eu $(pwd) export -eu then
+		local && echo done | "$@" cd test 'quoted text'
+then -eu /usr/bin /usr/bin /usr/bin readonly
+		$(pwd) 'quoted text' grep | 'quoted text' printf ${HOME}
+		-eu "$1" && 'quoted text' echo readonly -eu $(pwd) export awk readonly
+	grep cd test cd grep local && $(pwd) -eu export test readonly
+'quoted text' done printf 2>/dev/null | printf "$@" echo
+awk /usr/bin test printf grep "$@" --verbose /usr/bin 'quoted text' local --verbose
+	sed x=1 cd /usr/bin -eu done test && test 'quoted text' grep | /usr/bin
+local done sed export ${HOME} "$1" echo
+		echo done test ${HOME} printf && local readonly then
+&& awk 2>/dev/null ${HOME}
+		awk test sed "$@" 2>/dev/null
+then cd | then | awk "$@" $(pwd)
+	awk export ${HOME} then readonly x=1 sed then --verbose
+	test | /usr/bin 'quoted text' echo $(pwd) --verbose 2>/dev/null
+	"$1" sed awk local "$@" -eu 'quoted text' 'quoted text' x=1 /usr/bin
+		printf 'quoted text' $(pwd) awk /usr/bin --verbose
+	${HOME} x=1 echo test $(pwd) printf | --verbose $(pwd) 2>/dev/null $(pwd)
+&& then local test --verbose printf readonly grep | done cd "$@" -eu $(pwd) ${HOME}
+		readonly 2>/dev/null export done -eu --verbose echo
+	then awk | -eu $(pwd) -eu awk "$1"
+		test "$@" 2>/dev/null --verbose
+grep -eu done sed test export
+	test 2>/dev/null test test done
+		grep grep 2>/dev/null local awk 'quoted text' awk && then | 'quoted text'
+readonly then x=1 printf | /usr/bin done "$1"
+printf --verbose | readonly "$1" export readonly sed echo
+		local cd printf --verbose /usr/bin /usr/bin
+&& cd export echo cd 'quoted text' grep | local done local readonly
+sed grep awk $(pwd) 2>/dev/null
+		awk awk x=1 --verbose "$1" export cd test
+grep -eu test awk test local then -eu cd | sed $(pwd) readonly ${HOME} cd 'quoted text'
+&& /usr/bin grep done "$1" 2>/dev/null grep sed
+'quoted text' $(pwd) cd awk done $(pwd) printf export
+		'quoted text' --verbose x=1 "$1" local sed && "$1" awk sed awk export export
+		cd "$@" -eu 'quoted text'
+		then done /usr/bin /usr/bin && x=1 "$@" grep readonly --verbose printf |
+${HOME} cd /usr/bin export ${HOME} "$@" echo test readonly sed
+x=1 test /usr/bin grep
+	${HOME} /usr/bin -eu x=1 ${HOME}
+		$(pwd) 2>/dev/null sed /usr/bin
+	/usr/bin "$@" "$1" sed 'quoted text'
+		cd x=1 'quoted text'
+		'quoted text' ${HOME} ${HOME} printf | -eu then sed sed awk $(pwd)
+2>/dev/null 2>/dev/null "$1" readonly test echo "$@" export local
+		"$@" then export "$1" 2>/dev/null sed export /usr/bin cd 2>/dev/null
+2>/dev/null export awk /usr/bin /usr/bin ${HOME} then sed
+	local readonly test local local "$@" grep /usr/bin
+		2>/dev/null x=1 x=1 then 2>/dev/null
+		done 2>/dev/null readonly -eu -eu "$@" printf $(pwd) "$1" awk ${HOME} "$1"
+	"$1" "$1" /usr/bin ${HOME} -eu printf 2>/dev/null -eu x=1 then x=1 ${HOME}
+		&& awk x=1 printf ${HOME} readonly 2>/dev/null $(pwd) --verbose 'quoted text'
+--verbose && | "$@" grep cd then /usr/bin readonly cd cd $(pwd) sed
+		$(pwd) export test export
+		| echo x=1 awk x=1 ${HOME} awk echo echo
+	"$1" 2>/dev/null grep 'quoted text' cd readonly
+		2>/dev/null then export test $(pwd) printf sed && -eu printf -eu sed &&
+	'quoted text' local "$1" 'quoted text' "$@" ${HOME} done 2>/dev/null -eu 'quoted text'
+		cd echo echo /usr/bin "$1" 2>/dev/null /usr/bin cd test ${HOME} local
+		then echo awk "$@" --verbose
+		local "$@" grep x=1 sed $(pwd) export echo 2>/dev/null 'quoted text' /usr/bin
+		awk printf cd test 'quoted text' -eu 2>/dev/null
+	'quoted text' | && $(pwd) grep && grep && test $(pwd)
+		cd "$@" --verbose sed echo /usr/bin
+	awk printf "$1" "$@" 2>/dev/null -eu cd --verbose "$1"
+		echo sed ${HOME} test local x=1
+	x=1 sed ${HOME} then $(pwd) --verbose done ${HOME}
+		sed cd printf export 2>/dev/null | --verbose sed | echo -eu "$@"
+		awk grep 'quoted text' $(pwd) printf
+'quoted text' local "$1" | export awk cd cd 'quoted text' local -eu -eu 'quoted text'
+done printf --verbose then -eu local test test "$@" $(pwd) $(pwd) x=1 then
+		${HOME} printf 2>/dev/null
+then 'quoted text' --verbose echo echo grep
+2>/dev/null 2>/dev/null done awk 2>/dev/null ${HOME} echo "$@" grep echo echo $(pwd)
+		${HOME} "$1" "$1" x=1 "$@" | "$1" local cd test readonly
+	export printf "$@" "$1" -eu readonly readonly && 2>/dev/null printf
+		'quoted text' readonly 2>/dev/null /usr/bin sed grep cd | sed 2>/dev/null
+		"$1" | "$1" $(pwd) printf cd export local
+grep --verbose awk | readonly then "$1" x=1 printf | test echo export
+		'quoted text' /usr/bin sed --verbose grep ${HOME} --verbose
+		| -eu "$1" readonly readonly | 'quoted text'
+		&& 'quoted text' grep local sed $(pwd) 'quoted text' awk cd ${HOME} ${HOME} $(pwd)
+	echo "$@" grep 2>/dev/null --verbose "$1" 'quoted text' printf
+		-eu echo cd /usr/bin test --verbose local sed
+		grep $(pwd) done | readonly awk sed 'quoted text'
+		/usr/bin 'quoted text' then ${HOME} -eu printf then 2>/dev/null grep
+		done x=1 echo x=1 'quoted text' awk 'quoted text'
+		test x=1 ${HOME} sed /usr/bin sed sed awk readonly
+-eu local 2>/dev/null 'quoted text' awk then sed | printf "$1" --verbose
+test x=1 -eu awk 'quoted text' cd sed -eu awk
+	| awk $(pwd) local "$1" /usr/bin --verbose sed done
+export 2>/dev/null && readonly
+		-eu 2>/dev/null -eu sed printf "$1" 2>/dev/null -eu test test 'quoted text'
+		echo done awk sed echo readonly done /usr/bin 2>/dev/null
+echo 'quoted text' x=1 2>/dev/null printf /usr/bin
+		printf test ${HOME} x=1 local $(pwd) "$@" then printf /usr/bin done 2>/dev/null
+		&& $(pwd) ${HOME} && local
+	/usr/bin local ${HOME} test && cd sed readonly -eu &&
+		awk echo "$@" cd "$1" readonly x=1 "$1" awk export 'quoted text'
+		| | $(pwd) 2>/dev/null test "$@" x=1 | "$1" sed test /usr/bin readonly awk
+	then export $(pwd) x=1 x=1 done grep x=1 done | 'quoted text' then
+		sed echo && readonly done 2>/dev/null --verbose "$@" local ${HOME}
+	sed cd awk x=1 && --verbose --verbose sed $(pwd) echo local | | 2>/dev/null sed
+		'quoted text' test readonly done readonly echo "$@" local
+	local echo | printf "$@"
+		"$1" sed /usr/bin | 2>/dev/null
+awk cd ${HOME} | && then done export $(pwd) --verbose ${HOME} 'quoted text' $(pwd)
+		-eu | echo printf --verbose ${HOME} x=1 x=1 x=1
+		$(pwd) readonly ${HOME} grep awk && grep $(pwd) -eu echo
+		then export x=1 grep done ${HOME} local 'quoted text' 2>/dev/null
+'quoted text' ${HOME} cd /usr/bin then /usr/bin
+		readonly sed | x=1 test readonly "$1" "$@" ${HOME} --verbose $(pwd) awk
+	then && sed sed then $(pwd) test
+		grep $(pwd) awk && sed test ${HOME} printf | grep cd $(pwd) grep then echo sed $(pwd)
+		echo export sed -eu /usr/bin $(pwd) --verbose cd --verbose echo awk
+	done | sed test readonly grep export cd echo printf 2>/dev/null local 2>/dev/null
+	&& && "$@" then 2>/dev/null "$@" x=1
+	| printf printf test x=1 echo echo -eu "$@" test test /usr/bin awk 2>/dev/null
+local x=1 local 2>/dev/null then ${HOME}
+	$(pwd) -eu cd echo then -eu cd export
+then "$@" | | 2>/dev/null echo readonly "$1" 'quoted text' echo 2>/dev/null
+-eu -eu "$@" --verbose
+done | grep cd x=1 then | awk awk "$1" x=1 readonly -eu 2>/dev/null done
+	done readonly grep export "$1" export cd done
+grep printf printf export /usr/bin readonly --verbose "$@" echo
+	export && ${HOME} cd echo $(pwd) x=1 /usr/bin "$1" cd echo
+sed ${HOME} readonly &&
+| | ${HOME} && readonly
+		grep echo echo readonly | sed && cd local $(pwd)
+	"$@" then awk sed "$1" $(pwd) echo 2>/dev/null sed && grep printf awk && readonly
+		cd -eu $(pwd) --verbose awk then x=1 readonly readonly printf export awk 2>/dev/null
+	printf printf sed ${HOME} $(pwd) --verbose
+2>/dev/null x=1 printf
+2>/dev/null --verbose | ${HOME}
+		&& -eu -eu 'quoted text'
+		cd && then "$@" x=1 printf
+		readonly -eu 2>/dev/null && x=1 then printf $(pwd) 2>/dev/null echo ${HOME}
+awk test export ${HOME}
+	local 2>/dev/null test 'quoted text' sed sed local sed --verbose
+		grep && then "$@" printf $(pwd) && "$@" awk ${HOME} grep && grep done -eu
+		&& printf test export 2>/dev/null
+		local --verbose $(pwd) --verbose
+	local --verbose sed test 'quoted text'
+		export cd echo cd sed then grep "$1" | "$@" | local | printf done -eu
+sed "$@" --verbose awk awk echo "$@" 2>/dev/null
+$(pwd) printf printf awk "$@" && local 2>/dev/null |
+	done && then sed && 'quoted text' readonly
+		$(pwd) readonly export printf local done --verbose local "$@"
+$(pwd) done local --verbose readonly --verbose /usr/bin cd printf
+--verbose --verbose | printf x=1 ${HOME} export local $(pwd) awk
+| "$@" grep done x=1 export ${HOME} export done done echo && --verbose
+	"$1" awk grep x=1 done "$@" $(pwd) local 'quoted text' ${HOME} export
+	x=1 readonly $(pwd) "$@"
+		sed test sed local cd ${HOME} export 2>/dev/null
+	--verbose -eu -eu | "$1" 'quoted text' test /usr/bin awk
+--verbose "$@" $(pwd) grep 'quoted text' done 2>/dev/null 'quoted text'
+	printf /usr/bin cd cd cd $(pwd) awk | done cd | export "$1" test "$1" sed
+echo awk test "$1" -eu cd printf x=1 | $(pwd) done cd awk
+	"$@" export sed 'quoted text' local export 2>/dev/null grep awk ${HOME} |
+	echo test 2>/dev/null then "$1"
+	done "$@" grep grep --verbose
+'quoted text' x=1 awk 'quoted text' /usr/bin sed readonly
+awk && --verbose 2>/dev/null cd 2>/dev/null sed printf -eu echo x=1 then test
+$(pwd) grep "$@" /usr/bin then local --verbose
+echo export local 'quoted text' printf awk sed readonly export
+		&& 2>/dev/null | 2>/dev/null --verbose
+cd 2>/dev/null | $(pwd) ${HOME} 2>/dev/null local x=1 cd | "$1"
+cd readonly ${HOME} --verbose local sed "$1" /usr/bin
+x=1 export $(pwd) 'quoted text' local ${HOME} done local $(pwd)
+		-eu ${HOME} readonly "$1" -eu ${HOME}
+		grep printf 'quoted text' "$1" -eu test "$1" /usr/bin 2>/dev/null /usr/bin
+${HOME} --verbose 'quoted text' --verbose test local printf
+		printf x=1 awk $(pwd) ${HOME} ${HOME}
+		cd export echo echo 2>/dev/null export | 'quoted text' then done
+	/usr/bin x=1 ${HOME} test then && awk 2>/dev/null --verbose printf
+	"$1" 'quoted text' -eu "$1" | echo sed 'quoted text' --verbose
+		"$@" $(pwd) cd ${HOME} &&
+local then /usr/bin && awk
+| ${HOME} local x=1 2>/dev/null "$1" &&
+/usr/bin test cd "$1" ${HOME} echo | ${HOME} done awk -eu 2>/dev/null
+		grep /usr/bin then echo | grep test 'quoted text'
+		-eu ${HOME} local &&
+		then && echo then printf local echo && printf cd /usr/bin grep echo cd local
+echo readonly $(pwd) --verbose 'quoted text' grep "$1"
+		/usr/bin -eu readonly readonly && "$@" x=1 test export -eu
+	&& && local "$1" /usr/bin -eu
+	-eu ${HOME} cd done test printf x=1 2>/dev/null
+	export printf -eu && /usr/bin x=1
+export readonly local "$1" then | $(pwd) | sed done test
+	/usr/bin readonly /usr/bin
+	x=1 "$1" -eu ${HOME} echo x=1 export && | grep test awk --verbose && test 'quoted text'
+/usr/bin then sed ${HOME} && export --verbose sed | local cd 2>/dev/null x=1 "$1"
+grep "$@" export done awk export then $(pwd)
+done "$1" && export sed --verbose "$@" 'quoted text' test awk
+	"$@" -eu echo && awk local --verbose readonly
+	readonly $(pwd) sed "$@" | local
+printf 2>/dev/null 'quoted text' readonly /usr/bin "$1" 2>/dev/null && && cd
+	grep printf --verbose awk "$1"
+	'quoted text' 'quoted text' awk echo awk local
+	test printf echo done -eu ${HOME} then printf && export && local x=1 done
+	x=1 /usr/bin ${HOME} "$@" --verbose ${HOME} sed test grep then awk test
+		x=1 test && sed | awk awk printf
+"$@" grep grep && 2>/dev/null
+	"$@" readonly | "$@"
+		sed export && test test done 'quoted text'
+		sed --verbose x=1 "$@" then ${HOME} export then sed && local
+		done done grep "$1" echo ${HOME} readonly
+/usr/bin done grep printf awk grep sed test /usr/bin
+/usr/bin --verbose && sed 'quoted text' local "$1" printf local local
+| printf sed test -eu x=1 test --verbose
+		grep then cd test 2>/dev/null echo awk 2>/dev/null "$1" "$1" done 2>/dev/null
+/usr/bin x=1 -eu "$1" grep 2>/dev/null /usr/bin &&
+cd x=1 /usr/bin echo 'quoted text' ${HOME} cd 'quoted text' x=1 && test
+sed local -eu "$1" done cd | readonly x=1 echo
+		done ${HOME} "$@" local --verbose --verbose --verbose &&
+		&& printf export local x=1 test "$@" 2>/dev/null 2>/dev/null test echo
+	then 'quoted text' | export
+printf "$1" export printf
+test 2>/dev/null && test done local echo test /usr/bin
+	${HOME} done export local done 2>/dev/null
+	"$@" cd --verbose test echo "$1" then "$@" "$@" local
+		cd grep x=1 -eu --verbose
+		"$@" -eu sed cd done cd "$1" "$@" 2>/dev/null && export | echo echo
+		export "$1" export readonly printf export | readonly awk x=1 echo 'quoted text'
+		2>/dev/null test printf local done sed echo /usr/bin grep done x=1 printf
+awk done awk "$@" && /usr/bin x=1 printf then "$@" sed
+	/usr/bin 'quoted text' 'quoted text' -eu ${HOME} && test
+	'quoted text' "$@" export ${HOME} export printf grep x=1 2>/dev/null 2>/dev/null
+&& $(pwd) awk grep 2>/dev/null awk ${HOME} "$1" then sed printf cd awk 'quoted text'
+	"$1" 2>/dev/null local x=1 'quoted text' 2>/dev/null echo x=1 ${HOME} readonly
+		printf ${HOME} awk awk export "$@" "$@" -eu
+		done test awk readonly /usr/bin sed ${HOME} "$@" printf then
+cd && -eu test $(pwd) x=1 echo local grep |
+then "$1" "$1" sed cd 2>/dev/null printf printf grep
+awk "$@" 'quoted text' readonly test --verbose "$1"
+	x=1 test $(pwd) 2>/dev/null done readonly "$1" readonly 'quoted text'
+sed $(pwd) ${HOME} $(pwd) test
+$(pwd) /usr/bin 'quoted text' done printf -eu 2>/dev/null readonly "$1" done
+		done 2>/dev/null 'quoted text' sed grep
+grep -eu | -eu && then then
+/usr/bin printf && -eu "$@" 2>/dev/null printf awk 'quoted text' && cd -eu readonly
+		cd && 2>/dev/null local grep "$@" | sed && sed
+		grep ${HOME} then "$1" test ${HOME}
+sed test --verbose $(pwd) x=1 && --verbose
+&& grep --verbose then printf 2>/dev/null "$@" && export awk then
+		test cd export "$@" sed cd printf awk readonly "$@" readonly --verbose
+then | done echo echo sed printf printf /usr/bin
+	awk $(pwd) 2>/dev/null done done 2>/dev/null cd | export sed then "$@" 'quoted text'
+	readonly --verbose export
+	printf 2>/dev/null /usr/bin local -eu $(pwd) --verbose awk
+		2>/dev/null cd ${HOME} local export 'quoted text'
+printf -eu 2>/dev/null export test $(pwd) | | x=1 sed "$@" -eu local
+		x=1 $(pwd) echo && cd then test
+	awk 'quoted text' then done
+		done local echo x=1 -eu done $(pwd) 2>/dev/null printf -eu -eu awk x=1 /usr/bin
+awk grep /usr/bin export /usr/bin x=1 'quoted text'
+		'quoted text' --verbose cd printf grep then local && "$@" export
+local printf cd awk printf 'quoted text'
+	then sed then 2>/dev/null
+	local $(pwd) /usr/bin 'quoted text'
+	| then "$@" ${HOME} done done /usr/bin
+&& $(pwd) "$1" local x=1
+cd done "$1" done done printf
+		-eu "$1" export cd ${HOME} export export ${HOME}
+"$@" done sed readonly printf
+	grep "$@" 'quoted text' $(pwd) printf test /usr/bin 2>/dev/null
+	${HOME} readonly 'quoted text'
+		"$1" awk ${HOME} "$1" awk then sed test /usr/bin cd 2>/dev/null
+	/usr/bin test "$1" 'quoted text' export x=1 /usr/bin ${HOME} /usr/bin then
+	grep test grep sed grep cd --verbose test
+grep readonly | --verbose "$1" done --verbose grep --verbose awk
+	"$@" printf /usr/bin -eu 'quoted text' sed /usr/bin awk -eu
+	sed | grep cd 'quoted text' "$@"
+	$(pwd) --verbose grep 2>/dev/null export | ${HOME} ${HOME} /usr/bin
+--verbose export "$@" local readonly grep done echo x=1 --verbose
+	then test --verbose sed echo echo /usr/bin -eu grep grep done grep /usr/bin
+	| | grep readonly x=1 "$1" --verbose
+		test export --verbose | then
+	local | readonly && echo x=1 printf cd done sed --verbose then 2>/dev/null "$@"
+/usr/bin x=1 then "$1" | $(pwd)
+then readonly "$@" "$@" --verbose
+		local local | sed test 'quoted text' "$1" local export | readonly done export test
+--verbose echo "$@" grep grep 2>/dev/null /usr/bin /usr/bin
+		sed $(pwd) local x=1 /usr/bin export grep | && |
+		| done 2>/dev/null echo 'quoted text' test
+	cd -eu 2>/dev/null --verbose $(pwd) && --verbose
+		cd sed test cd ${HOME} local /usr/bin done
+	"$@" readonly "$1" echo -eu --verbose && ${HOME}
+	&& echo cd | | 'quoted text' "$@" 2>/dev/null done /usr/bin
+test echo test -eu awk 'quoted text'
+		'quoted text' "$1" --verbose x=1 'quoted text' --verbose done
+		test done test readonly 2>/dev/null /usr/bin then 'quoted text'
+	&& echo echo test ${HOME} awk -eu "$@" x=1 $(pwd) && cd /usr/bin
+	/usr/bin test then x=1 x=1 echo then grep && /usr/bin
+	sed x=1 then ${HOME} export "$@"
+done grep local export readonly sed then x=1 | printf -eu local | export
+readonly $(pwd) "$1" sed readonly x=1
+	export "$@" then done awk 2>/dev/null cd -eu local
+		cd test printf printf grep printf export
+		readonly 'quoted text' local echo grep 'quoted text'
+| ${HOME} export sed sed
+	$(pwd) printf export -eu --verbose 'quoted text' /usr/bin then grep
+		-eu awk --verbose 2>/dev/null local $(pwd) "$1" -eu --verbose done
+	| && awk cd "$1" /usr/bin 2>/dev/null 'quoted text'
+		/usr/bin done then ${HOME} --verbose cd grep done
+"$1" --verbose echo "$@" then awk done cd 'quoted text' sed | readonly
+	--verbose "$@" printf "$@" grep
+	"$@" x=1 awk local x=1 $(pwd) && test echo echo
+	${HOME} && && then ${HOME} cd awk then
+		local then sed "$@" test sed export -eu echo
+	${HOME} -eu awk printf -eu x=1 test 2>/dev/null ${HOME}
+export sed done echo 2>/dev/null
+	test export x=1 -eu readonly
+2>/dev/null local grep x=1 printf then
+		done | cd printf export awk | && sed x=1 && $(pwd) printf printf printf -eu
+	printf "$1" -eu export readonly /usr/bin awk "$@" cd $(pwd) "$1" ${HOME}
+	export local $(pwd) test sed readonly local then /usr/bin test
+'quoted text' sed readonly printf echo 'quoted text'
+$(pwd) --verbose awk 2>/dev/null && export "$@" ${HOME} "$1" sed | "$1" cd
+	"$@" sed -eu "$@" awk then test then local
+	awk test cd then export local 'quoted text'
+		--verbose --verbose done readonly
+2>/dev/null sed echo readonly --verbose x=1 $(pwd) && "$1"
+done cd printf "$1" local "$@" readonly
+	${HOME} cd export test
+local cd test cd | -eu
+	readonly -eu 'quoted text' done cd awk
+		'quoted text' "$@" export cd $(pwd) "$1" readonly --verbose "$1"
+		test sed cd export /usr/bin -eu awk |
+${HOME} readonly sed -eu echo cd && export
+test "$@" | $(pwd) && readonly printf
+	&& 'quoted text' export grep grep readonly x=1 local readonly grep grep && readonly
+sed $(pwd) "$1" $(pwd) echo | cd echo ${HOME} --verbose
+		printf done "$1" then awk x=1 -eu export && 'quoted text'
+		"$@" readonly awk local "$@" 2>/dev/null export /usr/bin
+	'quoted text' "$@" done cd echo 'quoted text' grep done 'quoted text' readonly
+		-eu done echo | -eu 'quoted text' -eu -eu x=1 echo printf
+	"$1" | "$@" $(pwd) && 'quoted text'
+test echo readonly sed | && printf done test done
+		| local grep /usr/bin echo then
+	&& $(pwd) && cd $(pwd) -eu && | test /usr/bin
+export $(pwd) echo readonly
+		${HOME} local 2>/dev/null printf cd $(pwd)
+&& test | $(pwd) $(pwd) /usr/bin cd done -eu && /usr/bin "$1"
+printf ${HOME} readonly grep
+		$(pwd) local grep -eu ${HOME} ${HOME} echo done | local grep "$1"
+${HOME} --verbose $(pwd)
+	"$1" test ${HOME} local && "$@" local -eu local
+	| printf ${HOME} test "$@" | readonly cd echo awk cd test printf && done printf
+		/usr/bin x=1 -eu readonly 2>/dev/null | grep | $(pwd) grep readonly --verbose
+		x=1 done done | x=1 awk local | cd x=1 "$1" grep /usr/bin
+	'quoted text' --verbose x=1 echo test --verbose --verbose awk "$@" ${HOME} |
+then printf echo | done then "$@" | $(pwd) -eu "$@"
+"$1" export | then 'quoted text' readonly cd "$1" local echo --verbose /usr/bin
+		2>/dev/null --verbose readonly /usr/bin 'quoted text'
+		then /usr/bin ${HOME} sed | -eu readonly local
+		test grep "$1" sed /usr/bin echo then cd x=1 "$1" && echo
+	--verbose printf grep then
+		printf -eu ${HOME} then local readonly "$@" 'quoted text' && test readonly
+		cd echo done cd readonly |
+		${HOME} && "$1" readonly local then "$@" then sed done cd
+		| 'quoted text' export
+	"$1" ${HOME} "$1" --verbose "$@" local ${HOME}
+export test grep x=1 "$1" | --verbose --verbose 2>/dev/null local
+		sed | printf /usr/bin | done test -eu printf done 2>/dev/null -eu 2>/dev/null
+		local readonly awk printf echo -eu then awk | echo printf echo awk --verbose
+	sed export readonly ${HOME} /usr/bin
+sed local sed sed 2>/dev/null "$@" cd cd 2>/dev/null --verbose export "$@" grep
+	"$1" test done grep done $(pwd)
+		"$@" x=1 "$1" printf x=1 done $(pwd) grep
+/usr/bin readonly -eu printf sed sed --verbose $(pwd) "$@" sed
+-eu x=1 printf --verbose awk printf /usr/bin -eu awk -eu "$1" echo 2>/dev/null
+		&& export echo sed ${HOME} grep "$1" cd x=1 cd grep
+		test /usr/bin -eu done then awk printf | local "$@" cd done $(pwd)
+		--verbose /usr/bin awk -eu echo
+	awk then && echo | readonly && echo local $(pwd) 'quoted text'
+	export "$@" done 'quoted text' sed echo echo "$@" 2>/dev/null && 'quoted text'
+	cd grep export -eu ${HOME} echo ${HOME} -eu
+sed echo test sed printf /usr/bin test awk export && 2>/dev/null && $(pwd)
+		grep x=1 --verbose sed 'quoted text' $(pwd) cd &&
+"$@" && sed export -eu
+export grep x=1 printf export
+	printf 2>/dev/null 2>/dev/null
+		then /usr/bin done ${HOME} x=1
+2>/dev/null echo "$1" ${HOME} | export ${HOME} | 2>/dev/null && | x=1 sed test
+		"$1" --verbose 'quoted text' export echo | $(pwd) then echo
+sed | sed -eu 'quoted text' 2>/dev/null
+2>/dev/null grep cd done
+		"$@" grep done done "$@" printf local awk grep sed 'quoted text' echo
+$(pwd) export && "$1" ${HOME} done -eu ${HOME} /usr/bin && local |
+	"$1" printf export ${HOME} printf --verbose sed echo
+	"$1" export done ${HOME} "$@" then -eu $(pwd) awk "$1"
+awk -eu x=1 'quoted text' x=1 cd done cd "$1" readonly -eu
+	grep 2>/dev/null ${HOME} awk | test cd awk x=1 /usr/bin export x=1 done -eu ${HOME}
+	readonly done ${HOME} | 2>/dev/null && done ${HOME}
+echo -eu ${HOME} 'quoted text'
+2>/dev/null then "$1" -eu && "$@" readonly cd x=1
+&& local "$@" x=1 $(pwd) x=1 cd
+| readonly && sed $(pwd)
+		printf "$@" export local then export cd x=1 echo
+	$(pwd) done done "$@" ${HOME} done awk x=1 2>/dev/null echo
+		then done then 2>/dev/null awk done
+x=1 && | grep 2>/dev/null local | local /usr/bin 'quoted text' printf ${HOME}
+	/usr/bin "$@" "$1" $(pwd) | test echo && "$@" export --verbose
+		--verbose grep cd $(pwd) sed x=1 /usr/bin 'quoted text'
+	export "$@" "$@" "$1" "$@" $(pwd) | "$1" $(pwd) --verbose $(pwd) "$1" | cd $(pwd)
+	--verbose cd sed 'quoted text' 'quoted text' local --verbose --verbose
+	${HOME} ${HOME} /usr/bin /usr/bin printf test awk 2>/dev/null && && then "$@" awk
+	'quoted text' awk 'quoted text' -eu sed "$@" -eu sed awk export local "$1" "$@"
+		'quoted text' "$1" sed | && export && printf 2>/dev/null --verbose x=1 'quoted text'
+	"$1" export then "$@" x=1 "$1"
+/usr/bin done | $(pwd) --verbose $(pwd) grep 'quoted text'
+	then awk ${HOME} --verbose local printf echo readonly 2>/dev/null readonly
+		cd /usr/bin 'quoted text'
+"$@" --verbose test "$1" 2>/dev/null printf "$@"
+	then printf ${HOME} -eu printf readonly
+"$@" "$1" echo export x=1 "$1"
+		/usr/bin --verbose echo echo "$@" awk --verbose /usr/bin awk echo
+		${HOME} 'quoted text' /usr/bin local done
+	-eu && printf then 2>/dev/null cd done "$1" grep export awk readonly readonly
+		readonly test then sed ${HOME} local readonly awk readonly cd $(pwd) "$@"
+	&& local ${HOME} export -eu "$@" cd done export "$1" export readonly
+		awk 'quoted text' $(pwd) ${HOME} echo $(pwd) awk done
+	cd cd 2>/dev/null then sed printf /usr/bin cd local grep
+		$(pwd) sed | "$@" && 'quoted text'
+	done 2>/dev/null printf x=1 && "$1" sed local ${HOME} 2>/dev/null
+"$1" local sed 2>/dev/null cd | --verbose --verbose
+	echo sed "$1" -eu 'quoted text' export test && local && sed readonly
+awk --verbose done && x=1 readonly printf | "$@" done
+		test done $(pwd) 'quoted text' echo -eu sed grep
+	grep awk 'quoted text' 2>/dev/null test --verbose 'quoted text'
+	printf cd x=1 x=1 "$@" then done | done 'quoted text' echo readonly grep sed "$@"
+		"$@" done | grep "$@" 'quoted text' /usr/bin 2>/dev/null
+	local cd readonly sed "$1" 2>/dev/null
+		done -eu "$1" sed echo --verbose readonly done --verbose readonly
+		"$1" local --verbose | echo export export -eu export "$1" test 'quoted text'
+'quoted text' $(pwd) then 2>/dev/null readonly
+		grep | cd "$@" sed "$1" --verbose cd -eu 'quoted text' --verbose
+readonly ${HOME} local grep "$@" 'quoted text' && "$1" local printf grep sed /usr/bin
+		test cd printf --verbose | readonly 2>/dev/null grep 'quoted text'
+	/usr/bin "$@" | && grep test sed local
+$(pwd) then && | cd --verbose readonly test local /usr/bin
+		printf grep sed "$1" export
+"$@" grep && export echo x=1 awk
+	| | $(pwd) /usr/bin printf "$1"
+	sed awk then ${HOME} awk "$@" awk echo "$@" export done echo sed -eu
+	echo test awk 2>/dev/null printf 'quoted text' ${HOME}
+	cd "$1" x=1 /usr/bin 'quoted text'
+x=1 && /usr/bin awk "$1" sed readonly
+		--verbose ${HOME} echo | 2>/dev/null printf readonly
+grep 'quoted text' /usr/bin "$@" then -eu
+local ${HOME} ${HOME} && --verbose test local test ${HOME} export
+	2>/dev/null -eu | "$1" then x=1 /usr/bin printf -eu
+	-eu readonly /usr/bin x=1 readonly
+${HOME} local | $(pwd) 2>/dev/null awk export
+	local $(pwd) -eu /usr/bin 2>/dev/null readonly -eu
+		echo -eu echo 'quoted text' x=1
+	awk /usr/bin readonly "$@" grep 2>/dev/null --verbose x=1 echo && local
+	${HOME} 2>/dev/null x=1 --verbose awk | "$1" $(pwd) --verbose then | && printf then
+	sed done -eu readonly /usr/bin export cd $(pwd) local -eu x=1
+&& /usr/bin local $(pwd) then | cd test 'quoted text' export | "$1" | sed
+done $(pwd) --verbose echo "$@"
+		readonly x=1 then "$1"
+'quoted text' ${HOME} && then then grep "$1" sed 2>/dev/null ${HOME}
+	| | 'quoted text' done readonly ${HOME} awk grep | --verbose /usr/bin then
+		sed | /usr/bin -eu printf -eu awk awk | 'quoted text'
+test /usr/bin readonly | "$@" "$1" "$1" done cd 2>/dev/null --verbose ${HOME}
+$(pwd) local export "$@" sed "$@" "$@"
+		| -eu cd /usr/bin awk done printf 2>/dev/null cd grep sed echo
+echo sed echo -eu "$1" awk ${HOME} "$@" 'quoted text'
+	"$1" cd test "$1" then then /usr/bin ${HOME} && awk cd --verbose
+test /usr/bin $(pwd) sed 'quoted text' local printf export 2>/dev/null $(pwd)
+		sed 'quoted text' readonly
+printf ${HOME} readonly && then
+echo "$1" test sed && -eu done
+x=1 "$1" -eu $(pwd) grep
+"$@" sed echo | "$1" export
+| cd export then x=1 printf echo -eu $(pwd) printf awk --verbose 'quoted text'
+| export awk --verbose sed export grep 'quoted text' ${HOME} echo
+		2>/dev/null "$1" local awk echo test -eu x=1 grep readonly
+		sed then test | then grep then printf grep done --verbose
+'quoted text' $(pwd) "$@" then echo local readonly echo
+echo ${HOME} awk | && cd | && printf
+		2>/dev/null awk export 'quoted text' -eu | awk /usr/bin "$1" printf
+		echo 'quoted text' 2>/dev/null printf test done "$1" && echo x=1 2>/dev/null sed
+x=1 sed sed "$@" | ${HOME} readonly
+	${HOME} x=1 sed --verbose "$1" local awk
+test then $(pwd) local printf && && -eu x=1 | sed $(pwd) export awk grep
+${HOME} done "$@" --verbose done ${HOME} ${HOME}
+'quoted text' then $(pwd) sed sed export ${HOME} readonly "$@" awk export
+		done awk x=1 echo "$@" then /usr/bin /usr/bin readonly --verbose export
+	cd printf test test then "$1"
+	then -eu then 'quoted text' | printf ${HOME}
+	-eu sed grep echo echo done --verbose "$1" $(pwd) readonly
+local $(pwd) | x=1 x=1 ${HOME} ${HOME} --verbose echo then $(pwd) -eu
+	then then test test cd echo echo echo then -eu ${HOME} done local -eu ${HOME}
+		/usr/bin cd /usr/bin --verbose awk $(pwd)
+"$@" x=1 printf awk sed 2>/dev/null test && export "$@"
+		/usr/bin grep $(pwd) sed 'quoted text' readonly grep grep && | readonly
+	echo | && && then | local "$1" printf cd printf 2>/dev/null
+		local printf $(pwd) local x=1 ${HOME} "$@" cd
+	done | ${HOME} sed awk then "$@" "$1" export awk
+	grep 2>/dev/null 2>/dev/null test "$@" $(pwd) --verbose
+-eu 'quoted text' sed sed test done then "$1" export
+		'quoted text' /usr/bin printf
+	echo echo --verbose then grep 2>/dev/null 'quoted text' echo local
+		echo -eu -eu | x=1 awk /usr/bin "$1" echo test readonly
+awk sed grep "$@" "$@" done then then echo x=1 2>/dev/null
+	printf cd grep done |
+		| sed sed && ${HOME} 'quoted text'
+done awk printf done then grep echo local ${HOME} grep
+	/usr/bin export grep 'quoted text'
+--verbose $(pwd) "$@" readonly printf $(pwd) $(pwd) test done export x=1
+	grep test printf /usr/bin "$@" /usr/bin test ${HOME} export 2>/dev/null
+2>/dev/null export $(pwd) readonly
+	/usr/bin local printf -eu 2>/dev/null && printf --verbose awk
+	2>/dev/null "$@" 2>/dev/null --verbose
+	printf echo grep && readonly cd /usr/bin export cd cd awk sed sed | printf "$@"
+${HOME} cd readonly 2>/dev/null
+grep -eu printf $(pwd) done sed local printf x=1 cd awk
+	"$1" sed printf "$@" printf | 2>/dev/null -eu "$1" local "$1" printf local printf
+		'quoted text' x=1 export
+		"$1" readonly sed $(pwd) "$@" | "$1"
+local awk && "$@" then test 2>/dev/null ${HOME} export local /usr/bin
+done sed local grep $(pwd) --verbose /usr/bin "$1" ${HOME} test
+--verbose then printf sed
+	awk 'quoted text' sed cd awk ${HOME}
+	echo done 2>/dev/null -eu printf echo
+		&& readonly done "$1" ${HOME} sed -eu $(pwd) local /usr/bin 2>/dev/null local "$1"
+| --verbose cd $(pwd) -eu
+done "$@" echo /usr/bin x=1 && local local "$1" export "$1" then echo done readonly
+		$(pwd) "$1" 'quoted text' x=1 echo /usr/bin test -eu
+	"$1" --verbose local export
+		${HOME} done export x=1
+		'quoted text' cd /usr/bin grep export
+		done 2>/dev/null -eu --verbose local readonly
+'quoted text' $(pwd) -eu export
+		awk "$@" 2>/dev/null -eu echo $(pwd) | done --verbose
+		test -eu readonly 2>/dev/null
+		"$@" grep x=1 "$@" then --verbose echo x=1 -eu
+		&& $(pwd) readonly printf sed -eu ${HOME} "$1" cd ${HOME}
+echo export -eu test export sed | echo grep
+"$@" readonly done | ${HOME} test
+--verbose cd 2>/dev/null cd && then x=1 2>/dev/null
+		then && "$@" done grep export x=1 --verbose
+	cd 'quoted text' readonly then --verbose awk | ${HOME} -eu "$@" sed then
+	x=1 --verbose "$1" && /usr/bin x=1 /usr/bin ${HOME}
+x=1 "$@" "$1" cd -eu done echo "$1" | --verbose
+export "$1" export sed 'quoted text' | awk
+	| $(pwd) cd cd test grep 2>/dev/null ${HOME}
+		2>/dev/null readonly "$1" cd awk "$@" then test "$@" "$@" --verbose
+		awk "$1" echo "$1" ${HOME} printf export echo readonly 'quoted text' sed "$@" awk
+done printf --verbose sed | sed
+x=1 grep awk done printf local | && 2>/dev/null
+		${HOME} x=1 printf 'quoted text' -eu | --verbose done -eu echo test test
+&& awk grep /usr/bin then then -eu --verbose "$1" x=1 awk local -eu grep grep
+		readonly ${HOME} ${HOME}
+	grep sed local /usr/bin 'quoted text' export cd "$@" export --verbose
+	/usr/bin 'quoted text' x=1 ${HOME} sed /usr/bin done 2>/dev/null
+$(pwd) printf echo test
+		| done | 2>/dev/null "$@" "$@" printf ${HOME} printf awk -eu printf then echo
+		cd /usr/bin /usr/bin readonly printf done done awk echo
+	export | cd printf 2>/dev/null printf 2>/dev/null then 2>/dev/null
+| printf --verbose --verbose && 2>/dev/null
+${HOME} printf done then echo x=1
+		${HOME} echo grep done grep done
+		x=1 sed x=1 ${HOME} sed export printf
+/usr/bin cd sed /usr/bin cd $(pwd) 'quoted text' x=1 test
+echo | local readonly cd --verbose 2>/dev/null
+	sed && "$@" | && 2>/dev/null awk grep
+		local done -eu 'quoted text' -eu ${HOME} done $(pwd) echo readonly readonly test
+	local printf then sed grep ${HOME} 'quoted text' cd local -eu 'quoted text'
+		local --verbose --verbose test grep -eu readonly
+	local 'quoted text' readonly
+"$@" grep | --verbose readonly
+	--verbose export done x=1 --verbose &&
+	"$@" done local awk -eu done export grep && sed awk "$1" 'quoted text'
+		2>/dev/null cd local echo
+	| awk && | | 'quoted text' readonly
+		-eu "$@" grep grep grep --verbose -eu --verbose "$1" /usr/bin
+		done echo cd test grep $(pwd) x=1 "$1" echo printf
+		then cd local awk 2>/dev/null local echo "$@" $(pwd) done
+		export local && then sed test /usr/bin
+	sed awk "$1" /usr/bin "$@" | 'quoted text'
+printf test readonly cd cd awk | test then printf printf -eu ${HOME} --verbose
+	export 'quoted text' 'quoted text' "$@" sed export && then "$@" sed awk
+	"$1" /usr/bin readonly echo $(pwd)
+--verbose readonly done awk | readonly --verbose /usr/bin cd
+		printf then ${HOME} --verbose ${HOME} /usr/bin | grep 2>/dev/null export
+	/usr/bin export --verbose
+	/usr/bin printf cd cd sed && grep | --verbose echo export 'quoted text'
+		"$1" readonly "$1" done grep |
+		${HOME} then && ${HOME} ${HOME} echo readonly $(pwd) -eu "$@" -eu export
+-eu --verbose readonly export -eu /usr/bin /usr/bin sed
+		sed done $(pwd) printf echo done echo
+		$(pwd) | $(pwd) sed && /usr/bin then 2>/dev/null
+test printf -eu ${HOME} sed --verbose 2>/dev/null "$@" cd "$1" "$@"
+local | 2>/dev/null export x=1
+	cd readonly awk done readonly | x=1 /usr/bin "$@" readonly
+		test awk local echo 'quoted text'
+		echo 'quoted text' grep sed export 2>/dev/null printf
+		--verbose && done 'quoted text' 2>/dev/null done 2>/dev/null echo
+		cd -eu $(pwd) -eu done --verbose | 2>/dev/null |
+	2>/dev/null cd /usr/bin
+done | -eu done cd readonly "$1"
+	&& grep /usr/bin cd 'quoted text' echo readonly | sed printf /usr/bin $(pwd) $(pwd)
+	--verbose x=1 echo "$1" ${HOME}
+		test 2>/dev/null readonly test done awk $(pwd) sed x=1
+grep /usr/bin && ${HOME}
+echo echo awk sed then awk
+'quoted text' 'quoted text' --verbose test 2>/dev/null && ${HOME} cd $(pwd)
+	--verbose --verbose grep sed ${HOME} export "$1" $(pwd)
+$(pwd) cd printf grep ${HOME} grep "$@" echo 2>/dev/null printf -eu
+	"$1" $(pwd) then local printf local && "$1" "$@" local export
+local ${HOME} -eu | echo local sed local
+		printf $(pwd) local awk printf /usr/bin x=1 -eu && 2>/dev/null 'quoted text'
+	printf /usr/bin readonly
+'quoted text' printf export awk | sed -eu && x=1 && test x=1 x=1 cd test
+printf --verbose --verbose | test x=1 export "$1"
+	local x=1 test local 'quoted text' /usr/bin
+		grep then --verbose 2>/dev/null test then
+	echo "$1" | "$1" awk "$1" x=1 x=1 x=1 printf && && "$1" x=1 readonly "$1" "$1"
+	-eu $(pwd) && "$1" -eu readonly cd cd | grep done printf
+	$(pwd) "$1" 'quoted text' $(pwd) x=1 export --verbose "$1" -eu && local x=1
+	-eu local done --verbose grep local readonly sed printf echo cd sed
+		"$@" "$@" | printf test --verbose echo printf --verbose local &&
+		cd printf x=1 ${HOME} local awk awk 'quoted text'
+'quoted text' printf grep done awk printf
+printf done awk $(pwd) sed | then printf cd $(pwd)
+	readonly sed grep done printf sed --verbose grep "$@" sed "$@"
+	local 'quoted text' awk printf printf local
+	echo && grep 2>/dev/null
+${HOME} $(pwd) --verbose then x=1 /usr/bin cd $(pwd) "$1" --verbose echo &&
+--verbose done x=1 && | "$1" x=1 --verbose 2>/dev/null
+	cd awk 'quoted text' $(pwd) echo cd echo $(pwd) /usr/bin
+readonly 'quoted text' /usr/bin then grep --verbose x=1 awk echo
+	local local local sed --verbose export ${HOME} test
+		${HOME} printf "$@" sed awk
+		/usr/bin -eu && test "$1" "$1"
+	$(pwd) x=1 cd grep awk export 2>/dev/null printf export x=1 cd test echo
+test then export export /usr/bin done test | /usr/bin /usr/bin cd local
+'quoted text' x=1 && readonly then done
+"$@" grep "$@" 'quoted text' 2>/dev/null "$@" echo && "$1" $(pwd) --verbose
+local local ${HOME} sed grep "$1" ${HOME} | test cd 2>/dev/null ${HOME}
+	${HOME} awk --verbose "$1" sed
+	${HOME} readonly "$1" done x=1 done test $(pwd) | && echo echo "$1" readonly
+	$(pwd) ${HOME} x=1 awk -eu export then test x=1 local echo ${HOME} test && $(pwd)
+		--verbose -eu then 2>/dev/null && "$@" awk $(pwd) "$@"
+	done printf export x=1 readonly then awk "$1"
+	'quoted text' /usr/bin /usr/bin echo $(pwd) grep /usr/bin awk local | 'quoted text'
+		test --verbose sed "$1" cd
+		export 'quoted text' -eu --verbose 'quoted text' readonly && x=1
+	&& --verbose "$1" test sed -eu $(pwd) --verbose readonly
+$(pwd) | sed x=1 'quoted text' readonly awk /usr/bin
+		--verbose done sed $(pwd) echo 'quoted text'
+'quoted text' done printf -eu
+	sed $(pwd) | /usr/bin grep 'quoted text' echo export --verbose grep printf
+		&& grep cd x=1 "$1" printf grep export
+$(pwd) x=1 awk test done "$@" ${HOME}
+	test "$@" | 'quoted text' | echo /usr/bin x=1 && then -eu /usr/bin local "$1"
+		readonly "$@" readonly grep 2>/dev/null && 2>/dev/null cd |
+	--verbose x=1 x=1 -eu printf &&
+${HOME} | | cd awk sed done then 'quoted text'
+done --verbose ${HOME} ${HOME} ${HOME} 'quoted text' ${HOME} awk test
+	/usr/bin && | awk printf export
+&& test readonly --verbose "$1"
+		readonly | | ${HOME} 2>/dev/null export 2>/dev/null
+	${HOME} 'quoted text' "$1" test done export
+		printf grep export x=1 x=1 | test -eu cd
+readonly 'quoted text' 2>/dev/null sed awk 2>/dev/null
+	printf && cd 2>/dev/null
+echo x=1 | "$@" local done "$1" ${HOME} export
+	then -eu test then then
+		readonly cd | && "$1" $(pwd) 'quoted text' test then $(pwd)
+	"$@" --verbose | echo | local export $(pwd) 2>/dev/null
+/usr/bin test $(pwd) readonly && && cd cd then
+	echo --verbose /usr/bin | $(pwd) 'quoted text' x=1 "$@" "$@" echo $(pwd)
+--verbose $(pwd) done /usr/bin cd export | -eu /usr/bin && local cd done $(pwd)
+echo done /usr/bin awk | && --verbose
+	/usr/bin cd && | /usr/bin readonly | test ${HOME} -eu export -eu 'quoted text'
+		x=1 'quoted text' ${HOME} test readonly x=1 x=1 then then
+x=1 then printf --verbose 2>/dev/null then printf
+${HOME} 'quoted text' /usr/bin
+	$(pwd) done | printf x=1 readonly "$1" done "$1"
+		${HOME} sed "$@" ${HOME} sed printf "$1" -eu "$1" $(pwd) "$1" printf sed echo
+		$(pwd) --verbose ${HOME} /usr/bin
+	| printf printf done "$@" test "$1" test awk then
+-eu echo export x=1 /usr/bin test sed
+sed done ${HOME} | export cd export 'quoted text'
+		x=1 done echo "$@" awk awk then 'quoted text' grep sed echo 'quoted text' --verbose
+		test 2>/dev/null printf 'quoted text'
+		cd "$1" x=1 "$@" $(pwd) awk done
+		done export local /usr/bin && test awk
+	"$1" printf grep cd ${HOME} /usr/bin /usr/bin
+		sed && ${HOME} echo | echo /usr/bin "$1" cd x=1 local export
+cd readonly then "$@" --verbose
+		$(pwd) /usr/bin cd sed x=1 --verbose sed
+		2>/dev/null $(pwd) sed local then -eu test done 'quoted text' 'quoted text'
+	| echo 2>/dev/null && test
+	2>/dev/null export --verbose x=1 sed cd sed cd local | ${HOME} local
+&& ${HOME} $(pwd) x=1 printf grep $(pwd) /usr/bin "$1" grep printf x=1 local
+	'quoted text' echo 'quoted text' -eu cd
+	readonly 'quoted text' echo | -eu
+"$1" ${HOME} done echo -eu done awk cd test echo -eu then
+		$(pwd) /usr/bin test done then -eu printf 2>/dev/null ${HOME} grep
+		awk 2>/dev/null 2>/dev/null
+		"$@" test --verbose /usr/bin ${HOME} export
+sed sed sed "$1" 2>/dev/null sed then | /usr/bin awk
+sed local --verbose --verbose awk x=1 then 2>/dev/null
+	"$1" -eu "$1" | | awk sed x=1 sed $(pwd) export -eu test "$@" "$1"
+${HOME} "$@" | grep -eu | done ${HOME} --verbose then x=1 echo
+		/usr/bin grep grep /usr/bin 'quoted text' "$1" test grep /usr/bin x=1 echo
@@ -0,0 +1,2001 @@
+	echo -eu done cd readonly 'quoted text' "$@" $(pwd) 'quoted text'
+$(pwd) echo $(pwd) 2>/dev/null printf awk readonly echo
+	"$1" grep cd printf && echo export "$@" /usr/bin
+done awk printf grep 'quoted text' grep grep --verbose
+grep "$1" /usr/bin printf printf /usr/bin 2>/dev/null &&
+then /usr/bin grep && then grep test && "$1" echo $(pwd) grep
+"$1" local && awk x=1 "$@" test $(pwd) awk "$@" "$1" cd x=1 sed 'quoted text'
+	then cd --verbose 'quoted text' then then test then
+		x=1 2>/dev/null /usr/bin "$@"
+--verbose /usr/bin printf | --verbose "$1" | /usr/bin "$1" local
+"$@" "$@" grep export sed 'quoted text' readonly
+${HOME} done 'quoted text' cd sed "$@" awk && 'quoted text' 'quoted text'
+		${HOME} test awk echo awk done x=1 done
+	cd grep --verbose -eu x=1 readonly
+		$(pwd) cd readonly local sed /usr/bin
+		then echo local sed export then | -eu
+	--verbose export 2>/dev/null /usr/bin done readonly -eu readonly
+	"$1" | export export readonly cd && ${HOME} -eu /usr/bin /usr/bin sed &&
+	2>/dev/null | echo local x=1 -eu test && export && $(pwd) export
+		awk awk awk 2>/dev/null 2>/dev/null
+		$(pwd) done echo done echo readonly cd echo local x=1 -eu sed printf grep "$@"
+		'quoted text' local done 2>/dev/null grep export ${HOME} done
+${HOME} test then "$@" --verbose cd printf grep echo echo "$@" -eu
+		grep grep | then echo ${HOME} 'quoted text' done grep
+		echo local test /usr/bin --verbose "$1" done "$@"
+		test then $(pwd) then "$@"
+		printf && echo cd done export local x=1 'quoted text' cd echo local
+		2>/dev/null $(pwd) --verbose printf sed export then then | 'quoted text'
+	&& "$1" awk 'quoted text' test then ${HOME} ${HOME} echo
+	/usr/bin awk readonly "$@"
+		cd awk 2>/dev/null done && "$@" grep echo then x=1 export
+	x=1 local echo && sed test sed ${HOME} 'quoted text' 'quoted text'
+'quoted text' local export
+done "$@" ${HOME} -eu test then x=1 "$1" done
+		printf printf done echo "$1" 2>/dev/null test /usr/bin $(pwd) "$1"
+		"$@" echo sed -eu printf 2>/dev/null ${HOME}
+		2>/dev/null "$@" --verbose done awk | done echo /usr/bin
+	cd x=1 export /usr/bin cd printf "$@"
+--verbose cd -eu "$@" --verbose echo $(pwd) awk $(pwd) --verbose sed
+-eu ${HOME} ${HOME} sed -eu echo -eu
+	2>/dev/null 2>/dev/null printf $(pwd) "$1" 'quoted text'
+		readonly "$1" grep --verbose export
+	readonly cd readonly 2>/dev/null --verbose grep --verbose | "$1" | | done "$1" sed
+	printf $(pwd) /usr/bin 'quoted text' cd echo sed --verbose 2>/dev/null
+&& echo awk x=1 -eu "$@" x=1 done then ${HOME} sed grep local --verbose x=1 /usr/bin
+	'quoted text' "$1" ${HOME} cd
+"$1" --verbose printf awk "$1" "$1" 'quoted text' readonly grep awk x=1
+-eu echo "$1" cd echo printf printf done done
+	$(pwd) && then done "$@" "$1" $(pwd) printf 'quoted text' export
+	--verbose 'quoted text'
+	awk 2>/dev/null -eu "$@" 'quoted text' readonly ${HOME} test awk "$@" printf sed
+	done then test --verbose "$@" ${HOME} "$@" 2>/dev/null done done test awk &&
+	"$1" test local cd 2>/dev/null | $(pwd) cd -eu
+local cd && x=1 $(pwd) ${HOME}
+	"$@" /usr/bin export echo
+	printf ${HOME} printf readonly x=1 --verbose awk --verbose --verbose done local
+2>/dev/null ${HOME} -eu then --verbose
+		then -eu done echo awk && -eu done then 'quoted text'
+		&& x=1 local 2>/dev/null local local && "$1" && "$@" sed | readonly then awk export
+		awk -eu echo echo done local $(pwd) done 'quoted text' && grep
+/usr/bin && $(pwd) 'quoted text'
+grep local grep test $(pwd) -eu local awk /usr/bin
+printf done $(pwd) 'quoted text' printf awk "$@" readonly $(pwd)
+echo then 2>/dev/null echo 2>/dev/null awk --verbose --verbose -eu 'quoted text'
+	done local 2>/dev/null grep then sed sed local then awk done
+	grep $(pwd) sed readonly then
+	x=1 sed x=1 awk awk local
+/usr/bin --verbose printf printf test awk
+--verbose x=1 -eu "$@" "$1" export local $(pwd) echo printf --verbose
+	2>/dev/null | grep "$@" "$@" printf 'quoted text' local ${HOME}
+	cd readonly "$@" --verbose export cd
+	'quoted text' 'quoted text' --verbose && 'quoted text' 'quoted text' then /usr/bin
+awk 'quoted text' 2>/dev/null 2>/dev/null /usr/bin printf printf "$1" then "$@"
+then ${HOME} then && readonly "$1" echo | -eu x=1 "$@" ${HOME} done local
+	echo /usr/bin "$1" 2>/dev/null awk
+	export "$1" then && 'quoted text' && 'quoted text' 'quoted text' && $(pwd)
+printf "$1" x=1 ${HOME} local echo ${HOME} ${HOME} ${HOME} done --verbose "$@" cd
+	"$1" then $(pwd) cd "$1" echo grep sed --verbose $(pwd) && ${HOME}
+	'quoted text' cd | "$1" 2>/dev/null "$@" grep sed
+	cd sed 2>/dev/null done test --verbose "$@"
+		"$@" echo $(pwd) echo 'quoted text' awk x=1 local
+&& $(pwd) /usr/bin 'quoted text' grep 'quoted text'
+		then sed local && export 2>/dev/null cd done local ${HOME} echo /usr/bin awk then
+'quoted text' awk echo then ${HOME} |
+$(pwd) then export "$@" test && sed $(pwd) "$1" echo ${HOME} 2>/dev/null awk ${HOME}
+	export grep printf -eu 2>/dev/null then grep x=1 export sed
+		2>/dev/null 2>/dev/null --verbose
+	&& /usr/bin 'quoted text' printf 'quoted text'
+"$@" | ${HOME} cd awk export 'quoted text' "$1" --verbose
+		${HOME} "$1" "$1" "$@" grep echo
+	done cd 2>/dev/null sed local then readonly -eu readonly
+echo then echo then --verbose grep "$1" local
+	2>/dev/null then && sed /usr/bin
+awk 'quoted text' local sed awk --verbose awk --verbose awk
+readonly -eu -eu readonly
+		cd readonly echo readonly
+	readonly 'quoted text' ${HOME} ${HOME} 2>/dev/null |
+	local | export then printf x=1 printf sed cd test x=1
+"$@" sed readonly echo ${HOME} sed 'quoted text'
+	${HOME} printf done printf && then /usr/bin done readonly --verbose -eu -eu
+		done printf 2>/dev/null --verbose echo grep printf
+		cd local sed done 'quoted text' local 2>/dev/null
+'quoted text' sed grep 'quoted text'
+export printf test && "$@" echo printf awk ${HOME} $(pwd) | cd --verbose
+		grep export local printf 'quoted text' grep 2>/dev/null
+	cd ${HOME} export cd export --verbose
+		test "$1" ${HOME} export $(pwd) printf local
+printf grep then readonly /usr/bin | echo grep
+		cd then test | local sed "$1" readonly awk $(pwd)
+"$1" "$1" -eu readonly /usr/bin x=1 $(pwd) done readonly test local
+		${HOME} cd /usr/bin awk "$1" x=1 "$1" echo test awk ${HOME} -eu -eu
+		&& ${HOME} readonly printf export grep 2>/dev/null
+/usr/bin && ${HOME} | done done
+		grep readonly printf "$1" readonly awk "$@" printf -eu echo "$@" "$1"
+cd "$1" printf echo 2>/dev/null grep ${HOME} 'quoted text'
+done 'quoted text' cd readonly done ${HOME} test awk local sed ${HOME} local
+	x=1 export then printf awk && then test sed ${HOME} | 'quoted text' && --verbose
+		${HOME} $(pwd) cd --verbose printf 2>/dev/null echo export printf cd done
+		done echo && && grep sed 2>/dev/null $(pwd) grep | x=1 sed --verbose 2>/dev/null
+		2>/dev/null 2>/dev/null && cd
+		test | 'quoted text' "$@" /usr/bin && done /usr/bin grep && -eu /usr/bin then done
+done | x=1 printf 'quoted text'
+sed sed echo cd -eu export
+	readonly test "$1" local done awk test export awk --verbose cd 2>/dev/null sed
+		&& cd sed readonly 'quoted text' && printf local sed "$1" test export -eu --verbose
+	2>/dev/null then test "$1" local done -eu readonly "$1" --verbose --verbose
+	awk "$@" x=1 -eu then 'quoted text'
+echo --verbose /usr/bin $(pwd) done readonly $(pwd) /usr/bin 'quoted text'
+export done /usr/bin && && cd -eu readonly cd "$1"
+grep test x=1 grep readonly test "$@" --verbose test ${HOME} --verbose "$@"
+		done ${HOME} 2>/dev/null echo
+	done printf grep 'quoted text' 'quoted text' local printf ${HOME} awk
+awk export done "$1" printf
+	local 2>/dev/null && x=1 x=1 "$1" printf test 2>/dev/null | 'quoted text' local
+	readonly /usr/bin awk "$@" --verbose grep grep
+	cd "$@" done export printf /usr/bin readonly then --verbose 'quoted text' sed cd
+		x=1 "$@" x=1 | $(pwd) cd grep x=1 'quoted text' ${HOME} x=1 "$1"
+| awk done printf 'quoted text' export "$@" test 2>/dev/null
+		awk "$1" 'quoted text' x=1 local
+		2>/dev/null grep 'quoted text'
+		awk 2>/dev/null -eu awk && ${HOME}
+echo local x=1 -eu | 'quoted text' 'quoted text' -eu awk x=1 $(pwd) cd
+		-eu "$1" 2>/dev/null /usr/bin readonly done && sed -eu cd $(pwd) 2>/dev/null
+	$(pwd) | 'quoted text' echo sed ${HOME} "$@" /usr/bin -eu sed "$@"
+		x=1 cd grep readonly "$@" -eu export then ${HOME} sed readonly grep 'quoted text'
+--verbose "$@" printf "$1" --verbose "$1" "$@" sed then sed
+	done x=1 local awk done export
+	/usr/bin echo cd grep then x=1 test
+	-eu awk "$@" "$@" test export sed -eu 'quoted text' -eu | awk "$1" $(pwd) x=1 cd
+	"$@" readonly cd grep /usr/bin --verbose local done ${HOME} ${HOME} test "$@"
+	export cd | ${HOME} && grep readonly test | && /usr/bin "$@" then ${HOME} ${HOME}
+cd awk $(pwd) --verbose ${HOME} /usr/bin | awk
+	sed local 'quoted text' "$@" cd $(pwd) printf done 2>/dev/null $(pwd)
+| readonly --verbose $(pwd) sed /usr/bin printf $(pwd) $(pwd) ${HOME} cd | ${HOME}
+x=1 done then awk awk "$@" echo | test
+awk grep x=1 && readonly grep export "$@"
+grep ${HOME} done readonly local "$@" 2>/dev/null echo -eu readonly /usr/bin
+	cd readonly && cd "$@" "$1" $(pwd) test awk cd sed cd -eu grep
+		readonly done echo printf
+	readonly cd 'quoted text'
+		test "$@" export awk sed x=1 "$1" grep local x=1 cd grep sed -eu "$@"
+		readonly -eu --verbose grep
+then "$1" 2>/dev/null sed x=1 "$1" "$@" sed then "$1"
+| -eu printf readonly then export done local /usr/bin test | x=1 "$1" awk awk
+test grep local sed && "$1" readonly export
+	"$1" $(pwd) "$1" /usr/bin local "$@"
+"$1" readonly sed ${HOME} awk "$@"
+echo cd "$1" cd test -eu ${HOME} /usr/bin done --verbose
+	x=1 $(pwd) 2>/dev/null x=1
+		grep 2>/dev/null cd export --verbose
+	| /usr/bin x=1 ${HOME}
+${HOME} ${HOME} grep cd --verbose grep 2>/dev/null
+		&& local x=1 test printf sed awk awk $(pwd)
+printf sed sed cd x=1 test
+	x=1 cd cd then grep done "$1" readonly export && done | readonly test
+		'quoted text' readonly cd printf --verbose grep local
+readonly sed readonly done done "$@" "$1" | "$@" $(pwd) printf
+	printf awk grep -eu -eu | ${HOME} -eu cd --verbose
+		$(pwd) "$@" readonly /usr/bin ${HOME} ${HOME} awk sed /usr/bin
+2>/dev/null awk readonly --verbose export 2>/dev/null awk "$1"
+		$(pwd) export -eu awk | && test
+&& "$@" readonly $(pwd) && test grep x=1 sed ${HOME} $(pwd)
+		"$1" --verbose cd awk && then readonly
+	-eu readonly --verbose "$@" done /usr/bin local "$1" x=1 local
+	printf -eu "$@" export /usr/bin grep /usr/bin "$1" done awk echo awk
+"$1" $(pwd) ${HOME} | | then printf cd "$@" printf grep
+"$@" test awk readonly grep echo -eu readonly cd printf
+x=1 /usr/bin local cd export && echo
+| /usr/bin done cd readonly then printf
+	readonly --verbose ${HOME} --verbose local 2>/dev/null cd x=1 x=1 2>/dev/null
+		-eu sed then "$@" sed grep x=1 && grep then grep readonly /usr/bin
+		sed "$1" readonly readonly --verbose
+	readonly 'quoted text' --verbose
+		done && | ${HOME} grep export then export grep
+-eu sed "$1" printf | export printf grep
+		'quoted text' printf export && /usr/bin printf echo awk printf test grep "$1"
+	readonly export grep 'quoted text'
+	readonly readonly grep test sed "$@"
+	2>/dev/null cd sed echo ${HOME} grep x=1 --verbose 2>/dev/null
+${HOME} sed printf local readonly sed export 'quoted text' then
+		2>/dev/null printf -eu echo readonly
+	&& x=1 echo --verbose && test test sed cd --verbose --verbose
+	test /usr/bin && --verbose
+		"$@" echo -eu done sed 2>/dev/null $(pwd)
+	"$@" 2>/dev/null readonly ${HOME}
+	readonly && 'quoted text' "$1" 2>/dev/null $(pwd) readonly "$1"
+	grep "$1" printf readonly local x=1 | --verbose awk
+		local local /usr/bin | grep sed -eu local done local
+	test ${HOME} 2>/dev/null && export done awk &&
+	--verbose cd export -eu ${HOME} "$@"
+		${HOME} readonly --verbose /usr/bin sed $(pwd) done "$1" 2>/dev/null
+done grep /usr/bin then test "$1" grep
+	printf local ${HOME} local x=1 printf --verbose local printf | echo readonly
+awk /usr/bin printf cd export /usr/bin --verbose readonly "$1" printf ${HOME} then
+		done "$@" ${HOME} cd grep test
+		echo then then readonly grep awk --verbose --verbose
+	"$1" "$@" x=1 printf grep local
+	awk ${HOME} echo "$@" cd cd export cd local && local sed
+		sed awk | $(pwd) ${HOME} | | && "$@" echo --verbose $(pwd) readonly echo
+	echo x=1 test test readonly 2>/dev/null export 2>/dev/null 2>/dev/null
+"$@" done -eu readonly awk test x=1 local grep done then cd
+		${HOME} readonly grep ${HOME} cd
+	--verbose readonly local
+		awk 2>/dev/null x=1 "$1"
+	$(pwd) echo then readonly 2>/dev/null /usr/bin
+	grep echo x=1 local /usr/bin x=1 grep cd $(pwd)
+| | --verbose ${HOME} echo &&
+x=1 x=1 echo | 'quoted text'
+	--verbose then done 'quoted text' "$@" echo x=1
+cd && --verbose grep then readonly --verbose
+		export then printf local done export cd
+		done | && echo done grep 2>/dev/null -eu sed cd export readonly
+/usr/bin "$@" x=1 then 'quoted text' | 2>/dev/null
+	awk -eu local | | 'quoted text'
+	x=1 "$@" done "$1" -eu printf export grep x=1 then /usr/bin
+		"$@" "$1" cd done awk test && && "$@" cd cd "$1" | 2>/dev/null export readonly
+	--verbose 'quoted text' /usr/bin -eu awk ${HOME} 2>/dev/null &&
+		2>/dev/null done $(pwd) x=1 done local -eu readonly grep ${HOME}
+		x=1 local | sed then echo 2>/dev/null 'quoted text' local echo && awk -eu --verbose
+| x=1 cd && "$1" test export sed && --verbose done
+-eu then sed | cd --verbose 'quoted text' "$1" | --verbose
+| printf $(pwd) -eu sed sed
+cd ${HOME} /usr/bin echo --verbose cd printf export "$1"
+	&& --verbose export | "$1"
+	export done -eu && ${HOME} | printf sed printf grep 'quoted text'
+'quoted text' export local x=1 grep local test then ${HOME} grep /usr/bin
+	export test done /usr/bin $(pwd) ${HOME} sed
+		cd echo x=1 awk test echo /usr/bin
+awk 2>/dev/null awk 2>/dev/null
+	-eu $(pwd) printf "$@" $(pwd) 'quoted text'
+		-eu then awk echo -eu 2>/dev/null 2>/dev/null awk printf printf test
+		2>/dev/null 'quoted text' test "$@"
+printf done && && 'quoted text' then cd local | x=1 printf grep then test |
+$(pwd) | 'quoted text' printf /usr/bin grep $(pwd) then
+	echo done grep | readonly "$@" test x=1 sed local
+		'quoted text' -eu && "$@" awk echo "$1" |
+	then | -eu readonly 'quoted text'
+	"$@" -eu readonly 'quoted text' test
+	/usr/bin echo && local cd sed local ${HOME} test --verbose local then local
+	&& 2>/dev/null 2>/dev/null then sed --verbose 2>/dev/null grep x=1
+		--verbose "$@" export x=1 local | 'quoted text' -eu echo | printf local --verbose
+	"$@" | sed export readonly 'quoted text' --verbose ${HOME}
+${HOME} printf cd cd ${HOME} awk $(pwd) $(pwd) grep export "$@" readonly
+	echo awk -eu sed grep 'quoted text' -eu echo
+2>/dev/null | 2>/dev/null 'quoted text' "$@" x=1 && -eu export -eu readonly
+	grep printf done done printf export | 2>/dev/null then export
+		"$1" | echo local "$1" "$1" awk done awk done /usr/bin &&
+	cd then then awk 'quoted text' -eu "$1"
+	then 'quoted text' -eu
+	'quoted text' readonly done --verbose
+/usr/bin test test $(pwd) $(pwd) awk
+$(pwd) --verbose 'quoted text'
+"$@" readonly sed && grep awk sed $(pwd) "$@" done
+| export readonly "$1" awk --verbose cd test --verbose && export
+	/usr/bin "$@" sed --verbose test readonly grep sed test x=1 "$@" 2>/dev/null
+then "$@" readonly echo
+		"$1" 'quoted text' echo printf cd "$1" sed -eu -eu &&
+test printf 'quoted text' | sed export export
+	"$1" 'quoted text' readonly -eu x=1 echo 'quoted text' grep local 'quoted text'
+awk printf then readonly local $(pwd) $(pwd)
+readonly x=1 2>/dev/null -eu
+	&& awk printf /usr/bin 'quoted text'
+		2>/dev/null "$1" awk --verbose sed
+test && 2>/dev/null awk x=1 "$1" /usr/bin && export cd printf grep 'quoted text'
+done awk -eu then -eu x=1 awk /usr/bin | printf then local 2>/dev/null
+		/usr/bin /usr/bin export 'quoted text' grep 'quoted text'
+	| ${HOME} export done $(pwd) test then printf
+		sed && 2>/dev/null $(pwd) printf /usr/bin printf ${HOME}
+		"$@" ${HOME} && -eu "$@"
+	2>/dev/null sed test && then | -eu -eu printf echo
+	test then done printf "$@" readonly awk local ${HOME} done 'quoted text' &&
+		then then "$@" cd ${HOME} grep then then
+--verbose local | echo awk $(pwd) ${HOME}
+echo sed sed -eu | export ${HOME} echo $(pwd) "$1"
+	"$1" && awk local cd | cd ${HOME}
+	"$1" then test | cd printf sed /usr/bin
+	awk ${HOME} awk x=1 | "$@" printf $(pwd) grep grep
+awk ${HOME} printf 2>/dev/null && --verbose printf $(pwd) then /usr/bin then done
+x=1 'quoted text' | | 2>/dev/null export 2>/dev/null printf x=1 && 'quoted text'
+		"$@" grep 2>/dev/null awk then -eu /usr/bin readonly -eu cd done &&
+		| 2>/dev/null "$1" then sed done x=1 awk sed && test printf export printf
+		2>/dev/null x=1 'quoted text' "$@" test x=1
+		$(pwd) $(pwd) --verbose | done
+cd x=1 --verbose 'quoted text' $(pwd) | awk awk local export "$@" done local --verbose
+		--verbose --verbose ${HOME} grep /usr/bin done grep ${HOME} local "$@" test
+	-eu x=1 echo printf 'quoted text' /usr/bin then "$@" &&
+		readonly | 'quoted text' "$@" --verbose 'quoted text'
+		echo export 'quoted text' "$@" ${HOME} cd readonly
+		&& readonly grep cd 'quoted text' readonly --verbose
+	cd "$1" x=1 local export ${HOME} export
+x=1 done 2>/dev/null export $(pwd) "$1" /usr/bin | readonly $(pwd) ${HOME}
+		printf "$1" echo test
+'quoted text' echo readonly --verbose $(pwd) && x=1 'quoted text'
+		$(pwd) printf printf local grep 'quoted text' "$@" && then printf "$@" sed $(pwd)
+"$1" "$@" local /usr/bin grep
+	-eu /usr/bin | local cd sed x=1 --verbose 2>/dev/null
+	'quoted text' sed done | ${HOME}
+		printf done x=1 awk grep readonly local 'quoted text' sed grep test | --verbose
+		printf /usr/bin "$1" x=1
+	grep "$1" readonly ${HOME}
+		grep local /usr/bin local readonly
+	'quoted text' x=1 $(pwd) local "$@" "$@" done printf awk local && --verbose
+then cd readonly ${HOME} --verbose && sed then --verbose echo
+		'quoted text' cd --verbose grep
+	"$1" /usr/bin /usr/bin echo ${HOME} 2>/dev/null $(pwd) | "$1" x=1 /usr/bin
+		-eu sed ${HOME} local 'quoted text' awk grep sed 'quoted text' "$1" && 'quoted text'
+		then then printf "$@" 2>/dev/null 'quoted text' export -eu -eu && --verbose
+		2>/dev/null test test && grep cd grep -eu done done test cd /usr/bin | local
+		grep sed echo printf echo "$1"
+		then cd test sed test 2>/dev/null local -eu "$1" test
+readonly awk cd 2>/dev/null grep awk -eu grep printf then echo "$@" awk done
+	readonly 2>/dev/null
+		x=1 ${HOME} readonly sed && && printf ${HOME} readonly "$@" local awk
+2>/dev/null x=1 'quoted text'
+$(pwd) && done cd cd /usr/bin awk local 'quoted text'
+		-eu /usr/bin /usr/bin "$1"
+grep 2>/dev/null "$1" "$@" 2>/dev/null printf test 'quoted text'
+		${HOME} done grep then $(pwd) "$@" done -eu ${HOME} "$@" | export
+2>/dev/null ${HOME} cd sed 'quoted text' "$@" readonly /usr/bin "$@" && 'quoted text'
+	grep 'quoted text' /usr/bin 'quoted text'
+'quoted text' /usr/bin && "$@" then "$@" test 'quoted text'
+	"$1" $(pwd) done && cd export ${HOME} done -eu 2>/dev/null /usr/bin && awk
+x=1 grep export done --verbose && printf
+	sed printf done readonly sed "$@"
+		sed x=1 x=1 -eu local $(pwd) x=1 --verbose awk done x=1 x=1 -eu x=1 'quoted text'
+	sed awk awk -eu x=1 cd done export cd test | "$1" /usr/bin ${HOME}
+	sed echo printf "$@" && cd "$@" $(pwd) &&
+		$(pwd) export -eu then ${HOME} -eu local
+${HOME} 'quoted text' "$1"
+cd 'quoted text' 2>/dev/null printf
+--verbose | 2>/dev/null cd --verbose
+x=1 cd echo x=1 /usr/bin 2>/dev/null /usr/bin echo grep 'quoted text'
+		$(pwd) "$1" "$@" cd && export 2>/dev/null x=1 then
+grep export local x=1 export test local test awk $(pwd) --verbose "$@" printf
+		"$@" 'quoted text' printf /usr/bin
+	${HOME} x=1 --verbose awk "$@" "$@" awk sed
+		cd --verbose local cd readonly ${HOME} then sed /usr/bin && --verbose
+		${HOME} x=1 awk sed --verbose -eu grep ${HOME} | grep local x=1 export
+	awk 2>/dev/null "$1" "$@" 2>/dev/null cd --verbose export
+	x=1 ${HOME} x=1 readonly done done 2>/dev/null "$@" $(pwd) $(pwd)
+"$@" sed sed test -eu printf
+	2>/dev/null awk done readonly local cd done printf -eu test grep -eu grep $(pwd)
+	"$@" grep sed grep "$1" && printf test $(pwd) ${HOME}
+	done done | | 2>/dev/null sed export |
+	grep | && export -eu $(pwd) && x=1 cd 2>/dev/null "$@" /usr/bin /usr/bin
+test awk awk cd grep local readonly printf x=1 'quoted text' x=1 echo "$@"
+local 'quoted text' done grep grep --verbose "$@" sed --verbose local -eu
+	test 'quoted text' then local sed echo then echo && done cd awk
+		"$@" echo | | /usr/bin then export /usr/bin
+		--verbose test printf sed printf export --verbose local sed && done
+	readonly sed done printf cd sed "$@" ${HOME} -eu "$@" 'quoted text'
+	cd test "$@" grep cd grep "$@" $(pwd) export sed
+		/usr/bin && $(pwd) then
+		echo cd $(pwd) 2>/dev/null x=1 local sed done cd /usr/bin 'quoted text' "$@"
+		-eu x=1 sed -eu ${HOME} "$@" local
+	export test then x=1 2>/dev/null
+echo local grep awk printf export readonly "$1" --verbose
+		sed awk && grep && grep test | readonly -eu done readonly &&
+		"$@" && awk ${HOME} grep "$@" grep test
+		/usr/bin "$1" grep grep 'quoted text' $(pwd) sed 'quoted text' 'quoted text'
+		awk && then && sed $(pwd) -eu x=1 -eu $(pwd) cd local "$@"
+	'quoted text' -eu "$1" x=1 x=1 local awk local then
+${HOME} then --verbose | $(pwd) /usr/bin
+	--verbose export awk printf sed /usr/bin printf
+${HOME} "$1" export test 'quoted text' "$1" 2>/dev/null "$@" readonly
+	$(pwd) --verbose "$1" done then -eu "$1" echo ${HOME} "$@" ${HOME} awk ${HOME}
+	cd done echo && && "$@" ${HOME} ${HOME}
+	sed echo 2>/dev/null -eu x=1 "$1"
+then x=1 'quoted text' "$1" -eu 'quoted text' | $(pwd) cd readonly
+	-eu $(pwd) "$1" done then 2>/dev/null "$@" printf
+echo sed "$@" ${HOME} grep printf --verbose 2>/dev/null -eu "$1"
+		--verbose x=1 -eu local export export echo cd local export
+export sed echo $(pwd) printf --verbose
+	then local sed | then done "$1" sed awk /usr/bin 'quoted text' awk
+		&& | 2>/dev/null local && readonly sed 'quoted text' x=1 export &&
+| 'quoted text' sed export --verbose -eu sed test | 'quoted text'
+	export awk "$@" 2>/dev/null && $(pwd)
+2>/dev/null && x=1 /usr/bin | --verbose "$1" echo
+"$1" printf printf ${HOME} export --verbose local awk test && "$1" echo ${HOME}
+	2>/dev/null | then printf awk $(pwd)
+		grep grep readonly then 'quoted text' x=1 printf "$1" readonly sed "$@" then &&
+readonly echo readonly readonly
+	2>/dev/null "$1" cd printf awk cd 2>/dev/null
+		-eu done readonly "$@" /usr/bin --verbose "$1" readonly
+&& 'quoted text' -eu $(pwd) test $(pwd) awk | done readonly "$@" then grep
+	printf awk && "$@" "$1" x=1 "$1" done readonly export /usr/bin 2>/dev/null | 2>/dev/null
+		awk $(pwd) /usr/bin -eu readonly printf --verbose sed x=1 | && x=1 done x=1
+		"$1" echo printf x=1 cd then grep --verbose then echo
+	/usr/bin 'quoted text' grep done $(pwd) grep "$1" | export
+	echo 2>/dev/null "$1" echo 2>/dev/null local 'quoted text'
+	&& x=1 x=1 && x=1 done grep grep | x=1 done ${HOME} ${HOME} /usr/bin "$@"
+	'quoted text' 2>/dev/null && x=1 printf cd | $(pwd) -eu
+cd echo /usr/bin 2>/dev/null x=1 then readonly
+awk 2>/dev/null local && /usr/bin readonly | local
+echo awk ${HOME} "$1" "$@" sed /usr/bin -eu 'quoted text' then then
+-eu cd 2>/dev/null --verbose echo awk test $(pwd) awk $(pwd) local ${HOME}
+	-eu && sed x=1 /usr/bin -eu cd readonly export cd export awk "$@"
+	$(pwd) grep awk echo readonly done cd grep && grep local
+| "$1" echo test ${HOME} -eu then test -eu "$1" grep
+done $(pwd) /usr/bin local readonly 'quoted text' $(pwd)
+then echo | | /usr/bin /usr/bin printf /usr/bin | export && done 2>/dev/null printf
+		printf printf ${HOME}
+| done grep | --verbose "$@" test | /usr/bin grep | 'quoted text'
+awk test | /usr/bin sed awk 2>/dev/null $(pwd) sed $(pwd)
+		/usr/bin $(pwd) test grep $(pwd)
+local -eu && echo echo grep "$1" -eu && "$1" -eu "$@" --verbose printf x=1 readonly
+		cd | 'quoted text' "$1" export "$@" local --verbose local x=1 | sed --verbose
+		"$@" "$@" printf readonly grep -eu printf | /usr/bin
+	local "$1" "$1" $(pwd) "$1" -eu test
+	awk cd --verbose local printf "$1"
+		x=1 cd local && echo export awk export printf
+	/usr/bin sed sed "$@" && $(pwd)
+		${HOME} "$1" done done $(pwd)
+		test then printf && echo printf
+	cd test then then done | ${HOME} then --verbose then
+	sed $(pwd) | $(pwd) --verbose then 'quoted text' printf export "$@" cd done
+	-eu $(pwd) done printf "$@" | printf
+		readonly cd test export echo awk "$@" grep printf echo
+"$@" ${HOME} 2>/dev/null 'quoted text' --verbose
+	x=1 ${HOME} -eu then x=1
+	printf "$@" export printf ${HOME}
+	done $(pwd) && export --verbose "$1" done readonly "$@"
+		then awk ${HOME} done 2>/dev/null awk "$@" ${HOME} export 'quoted text'
+--verbose awk --verbose "$@" readonly /usr/bin "$@"
+		readonly readonly "$@" readonly -eu grep "$@" sed echo
+	local "$1" local readonly | readonly "$1" then
+readonly "$@" export ${HOME} /usr/bin export
+	grep export | $(pwd) --verbose "$1" awk local awk
+		printf x=1 "$@" test sed 2>/dev/null sed then printf export
+	test "$@" sed then | done /usr/bin
+"$@" 'quoted text' done /usr/bin printf then export done
+	done x=1 $(pwd) && local x=1 grep readonly sed x=1 x=1
+	x=1 "$1" $(pwd) grep x=1
+		done awk && 'quoted text' printf --verbose
+		test "$@" | export 2>/dev/null | x=1
+printf then x=1 then cd done -eu --verbose
+$(pwd) test $(pwd) grep 'quoted text' cd --verbose $(pwd) "$@" /usr/bin readonly
+--verbose local | $(pwd) test
+		/usr/bin local then sed local export sed 2>/dev/null echo -eu
+| 2>/dev/null | grep done test echo readonly printf printf then $(pwd)
+		$(pwd) 'quoted text' printf then test done x=1 local "$@" done | --verbose
+	echo 'quoted text' awk sed 'quoted text' then "$@" /usr/bin
+test then "$1" export "$@" /usr/bin echo echo -eu /usr/bin
+echo export -eu && &&
+export awk "$1" 2>/dev/null done 2>/dev/null
+	$(pwd) cd export "$@" 2>/dev/null ${HOME} /usr/bin then --verbose 'quoted text'
+		awk "$1" export 'quoted text' 2>/dev/null printf
+	printf sed x=1 echo | cd --verbose --verbose
+done -eu "$1" --verbose ${HOME} -eu ${HOME} ${HOME} printf done &&
+&& awk echo local local /usr/bin test cd "$1" $(pwd) cd ${HOME} 'quoted text'
+--verbose | "$@" /usr/bin | done test
+	x=1 'quoted text' export "$@" awk sed local -eu readonly readonly
+		-eu test then printf x=1 $(pwd)
+"$@" /usr/bin && done export export export | && awk $(pwd) cd done -eu ${HOME}
+		sed cd local 'quoted text' 'quoted text' readonly
+done then sed --verbose grep
+		grep cd | awk -eu local cd && |
+	test --verbose --verbose
+		"$@" ${HOME} printf /usr/bin ${HOME} 'quoted text' "$@" | echo
+		grep $(pwd) sed printf 'quoted text' sed $(pwd) echo --verbose export
+	cd echo echo done local
+		export printf cd /usr/bin x=1 export -eu done && --verbose export export readonly
+cd test sed /usr/bin test | "$1"
+2>/dev/null 2>/dev/null $(pwd) printf
+		done done readonly cd export $(pwd) test local
+		local local printf && --verbose "$@" --verbose
+cd 2>/dev/null grep test ${HOME} sed
+		"$@" printf $(pwd) | sed
+	/usr/bin /usr/bin awk sed
+		export printf --verbose sed --verbose | && sed test /usr/bin --verbose
+		export readonly printf sed awk | echo ${HOME} cd "$@"
+'quoted text' export export | grep sed $(pwd) awk export test
+		--verbose /usr/bin echo grep done grep -eu x=1 x=1 2>/dev/null echo --verbose
+	awk grep | readonly test awk
+		export test /usr/bin | "$1" x=1 echo -eu echo sed /usr/bin
+		grep test 'quoted text' && sed | "$1" "$1" readonly printf -eu
+	/usr/bin readonly export 'quoted text' grep done ${HOME} echo echo |
+--verbose then && done
+	/usr/bin sed cd grep | sed x=1 2>/dev/null echo done && cd printf
+		grep "$1" export 'quoted text' then cd && readonly
+	readonly awk grep awk --verbose 2>/dev/null | ${HOME} "$@" -eu printf local
+		export ${HOME} /usr/bin "$1"
+	grep test sed /usr/bin done /usr/bin 'quoted text' printf $(pwd) readonly
+$(pwd) --verbose -eu | ${HOME} readonly grep local sed "$@"
+"$@" done x=1 done export 2>/dev/null --verbose
+sed grep readonly 2>/dev/null "$@" && 2>/dev/null "$@" cd 2>/dev/null
+	${HOME} sed awk /usr/bin && sed /usr/bin x=1
+awk 'quoted text' echo
+	echo then then export ${HOME} ${HOME} --verbose grep
+		"$@" | then awk "$1" printf test
+	test export export sed sed | sed echo -eu 2>/dev/null done done x=1 "$1"
+		"$@" done then awk x=1 /usr/bin | export "$@" | cd 'quoted text' grep --verbose
+$(pwd) then then local echo ${HOME} done export "$1" awk && export
+	then printf 2>/dev/null test export /usr/bin
+	2>/dev/null cd export readonly awk && grep && && grep ${HOME} local printf "$@"
+&& then echo ${HOME} && cd awk printf
+		$(pwd) cd -eu 2>/dev/null 'quoted text'
+	2>/dev/null x=1 "$1" "$@" export "$@" echo local x=1 && echo
+--verbose grep "$1" echo ${HOME}
+	"$1" done --verbose -eu echo awk 2>/dev/null ${HOME} -eu
+	awk --verbose sed && 2>/dev/null
+		"$1" 2>/dev/null grep -eu done awk "$@" /usr/bin readonly printf echo
+		echo -eu $(pwd) 'quoted text' export export echo done
+/usr/bin local "$@" "$@" grep ${HOME} /usr/bin awk grep
+	'quoted text' "$1" 2>/dev/null cd readonly test -eu "$@"
+echo --verbose 2>/dev/null | readonly done printf /usr/bin -eu 2>/dev/null
+	"$@" cd && test $(pwd) x=1 sed
+	printf --verbose local then -eu "$1" test test printf then cd cd printf
+echo echo | $(pwd) x=1 test then --verbose then sed echo
+$(pwd) test test done && test && then "$@" done "$1" grep grep "$@"
+		echo then "$@" 'quoted text' "$@" ${HOME} printf
+then ${HOME} /usr/bin sed | cd sed -eu 'quoted text' ${HOME}
+awk ${HOME} /usr/bin readonly local
+		&& cd "$@" test && sed echo awk -eu -eu test $(pwd) export -eu grep cd 'quoted text'
+	${HOME} -eu -eu --verbose x=1
+		${HOME} readonly "$@" ${HOME} then grep "$@" awk 'quoted text' --verbose
+	export | x=1 export $(pwd) cd awk 'quoted text' -eu readonly 2>/dev/null
+'quoted text' ${HOME} --verbose --verbose ${HOME} sed
+		--verbose | grep --verbose
+	/usr/bin 'quoted text' ${HOME} /usr/bin
+	2>/dev/null done "$1" "$@" printf cd echo --verbose readonly 2>/dev/null &&
+	2>/dev/null ${HOME} readonly /usr/bin $(pwd) local readonly
+	&& --verbose /usr/bin $(pwd) then done x=1 grep "$@"
+	2>/dev/null awk --verbose /usr/bin 2>/dev/null export && 'quoted text'
+		&& 'quoted text' "$1" done export sed sed $(pwd) 'quoted text'
+		x=1 -eu $(pwd) | 'quoted text' $(pwd) /usr/bin 'quoted text'
+echo test readonly --verbose sed grep test ${HOME}
+		grep /usr/bin ${HOME} "$1" export "$@" then
+	/usr/bin echo | grep grep grep printf x=1 'quoted text' $(pwd) 2>/dev/null
+sed echo 'quoted text' ${HOME} "$@" then export
+		$(pwd) $(pwd) | cd cd $(pwd) && x=1 "$1" "$1" printf -eu awk | local then 2>/dev/null
+		cd "$@" readonly local ${HOME} $(pwd) export awk
+${HOME} printf readonly --verbose "$1" 2>/dev/null /usr/bin grep /usr/bin printf
+awk "$1" /usr/bin --verbose cd awk /usr/bin
+		printf awk grep sed then test --verbose && sed x=1 -eu sed -eu --verbose
+-eu -eu | grep then 'quoted text'
+	| "$1" grep then export x=1 -eu "$1" && done sed cd ${HOME}
+		-eu cd x=1 && done /usr/bin readonly 'quoted text' 'quoted text'
+	printf awk cd | local /usr/bin local /usr/bin "$1"
+	grep 2>/dev/null 2>/dev/null
+		local /usr/bin printf -eu 'quoted text' "$1"
+'quoted text' awk test sed && sed printf local | export
+grep cd 2>/dev/null x=1 printf echo x=1 x=1 test test --verbose
+		local 'quoted text' $(pwd) | 2>/dev/null --verbose
+	$(pwd) printf export $(pwd) test "$1" 2>/dev/null awk local awk 2>/dev/null
+	grep 'quoted text' cd ${HOME}
+${HOME} printf local | 'quoted text' --verbose 2>/dev/null /usr/bin && readonly
+		${HOME} "$1" --verbose x=1 x=1 "$1" cd test x=1 then echo $(pwd) readonly
+		printf "$@" ${HOME} export then then -eu local
+	readonly then x=1 "$1" printf
+		sed -eu printf --verbose && grep then 2>/dev/null awk x=1 readonly
+		x=1 x=1 local $(pwd) awk 2>/dev/null -eu -eu 'quoted text' "$1" -eu /usr/bin
+test local then echo cd
+	awk /usr/bin test sed ${HOME} 2>/dev/null awk then && test ${HOME} $(pwd) local
+sed readonly awk -eu -eu x=1 local local && local grep --verbose /usr/bin grep
+		export && sed 2>/dev/null 2>/dev/null x=1 "$@" ${HOME} /usr/bin
+		| ${HOME} cd $(pwd) awk grep | readonly local test ${HOME}
+	awk test done awk 2>/dev/null --verbose
+		'quoted text' awk --verbose done -eu done
+	-eu then test cd 'quoted text' "$1" ${HOME} && -eu readonly echo
+		${HOME} sed "$@" test && -eu awk readonly | ${HOME} | ${HOME} awk | printf
+		-eu then --verbose test printf ${HOME} -eu
+		export "$1" $(pwd) export awk awk x=1 "$@" /usr/bin
+		then 2>/dev/null export export $(pwd)
+	cd /usr/bin --verbose 2>/dev/null local echo 2>/dev/null export echo -eu
+/usr/bin printf x=1 2>/dev/null
+		--verbose | sed "$1" test test 2>/dev/null "$@" done grep --verbose
+then | done export -eu ${HOME} 2>/dev/null test awk echo x=1 done 2>/dev/null
+	2>/dev/null -eu /usr/bin "$1" done done -eu local then && ${HOME} awk "$@" done
+	cd test echo "$@" printf cd "$@" then
+/usr/bin readonly "$1" -eu "$1" done
+printf awk $(pwd) $(pwd) sed --verbose | x=1 echo grep readonly
+		test cd cd then awk -eu
+&& | awk x=1 ${HOME}
+		&& test --verbose local | readonly cd grep cd then
+		local x=1 ${HOME} $(pwd) printf
+		cd | export local test then local && ${HOME} export /usr/bin
+	local $(pwd) export "$1" readonly printf "$@" local
+		local then | echo "$1" export 'quoted text' readonly
+		grep grep /usr/bin | /usr/bin | | "$1" then 'quoted text'
+/usr/bin | 'quoted text' awk 'quoted text'
+local "$1" $(pwd) grep
+done sed -eu ${HOME} then then done awk then /usr/bin -eu "$1"
+export test local echo export
+		readonly "$@" ${HOME} 'quoted text' printf | $(pwd) printf local awk local /usr/bin
+		/usr/bin 'quoted text' test readonly printf awk 2>/dev/null ${HOME} printf
+		--verbose x=1 2>/dev/null "$1" printf done awk export cd grep --verbose
+		local then $(pwd) printf sed done
+	cd 'quoted text' awk "$@" x=1
+	"$@" -eu "$1" echo $(pwd) "$@" grep
+	2>/dev/null local /usr/bin
+readonly grep | /usr/bin | readonly cd 2>/dev/null then x=1 --verbose
+		grep test && local readonly local -eu --verbose
+	| 2>/dev/null -eu && export grep -eu echo cd /usr/bin
+		grep grep x=1 then sed -eu "$@" done
+	x=1 echo /usr/bin export "$@" sed $(pwd) --verbose
+	--verbose export -eu then then done echo
+done && "$1" export -eu /usr/bin cd x=1
+awk readonly printf awk ${HOME} | awk grep echo readonly done local awk awk sed
+| cd x=1 cd | cd x=1 then then printf done readonly
+--verbose x=1 echo 'quoted text' grep $(pwd) sed then |
+${HOME} 2>/dev/null /usr/bin done awk sed $(pwd) "$@" local
+	export sed local "$@" done x=1 "$@" done 'quoted text' 2>/dev/null
+$(pwd) test awk "$@" x=1 && awk 2>/dev/null "$@" -eu local
+	printf --verbose local then 'quoted text' /usr/bin
+	printf 'quoted text' $(pwd) printf
+		test grep readonly -eu /usr/bin readonly 'quoted text' /usr/bin export
+	cd x=1 "$1" "$1" local awk /usr/bin x=1 grep readonly printf /usr/bin 2>/dev/null
+2>/dev/null "$@" --verbose "$1" echo /usr/bin local done
+sed && echo readonly && $(pwd) ${HOME} printf grep x=1 -eu test -eu awk "$@"
+$(pwd) && sed export export && | export sed local 'quoted text'
+cd then 2>/dev/null /usr/bin export ${HOME} 2>/dev/null printf
+&& printf --verbose local readonly grep
+	"$@" && echo $(pwd) printf "$1"
+		echo cd test grep "$@" test
+	then ${HOME} sed export readonly 'quoted text' test done printf printf
+		printf awk export /usr/bin ${HOME} then export echo "$1" -eu 2>/dev/null
+		/usr/bin | && sed 2>/dev/null 2>/dev/null x=1 grep test printf export -eu
+| ${HOME} then readonly test sed awk --verbose "$@" then -eu grep readonly printf
+	printf sed --verbose | | then printf local /usr/bin printf
+	printf local sed "$1" then /usr/bin "$@" grep |
+| && --verbose grep 2>/dev/null
+| $(pwd) awk cd /usr/bin "$@" 'quoted text' "$@" local |
+export cd && then readonly --verbose &&
+	| printf && x=1 export sed 'quoted text' /usr/bin
+		| $(pwd) done 'quoted text' echo cd echo
+${HOME} cd echo done 'quoted text' echo x=1 x=1 ${HOME} -eu export
+		&& ${HOME} local echo echo --verbose done grep ${HOME}
+		"$@" "$1" export $(pwd) && ${HOME} grep /usr/bin --verbose ${HOME}
+	readonly $(pwd) echo ${HOME} awk --verbose cd 2>/dev/null grep
+	${HOME} --verbose cd "$1"
+	printf test x=1 --verbose awk ${HOME}
+	readonly readonly local 'quoted text'
+	| "$@" 'quoted text' --verbose local local local cd then awk && export local
+	'quoted text' "$@" ${HOME} test 'quoted text'
+export "$1" "$@" then ${HOME} ${HOME}
+	x=1 echo done grep 2>/dev/null
+	/usr/bin local printf readonly
+"$@" then sed done grep "$1" -eu -eu
+		then echo export export then export 2>/dev/null | --verbose 2>/dev/null 2>/dev/null
+--verbose 2>/dev/null -eu ${HOME} | export export "$1" echo awk export
+	export echo echo grep | "$@" x=1 printf $(pwd)
+		awk -eu && grep readonly awk "$@" test sed
+"$1" cd && test grep local /usr/bin 'quoted text'
+		&& 'quoted text' --verbose echo /usr/bin 2>/dev/null
+	then cd awk cd printf $(pwd)
+grep test 2>/dev/null && x=1 readonly $(pwd) "$@" sed 2>/dev/null |
+		-eu /usr/bin ${HOME} $(pwd)
+	test done x=1 test ${HOME} grep x=1 echo "$1" test
+	&& -eu --verbose && "$1" printf
+	readonly local then ${HOME} grep | readonly $(pwd) done readonly
+		export "$@" export test x=1 "$@" /usr/bin then awk echo printf
+/usr/bin echo readonly 2>/dev/null
+-eu sed done export "$1" then
+	grep --verbose echo "$@" | then
+then awk --verbose cd --verbose local cd x=1 test 2>/dev/null
+cd x=1 local printf "$@" cd --verbose readonly 2>/dev/null && 'quoted text' --verbose
+		then x=1 grep x=1 local "$@" test $(pwd) done grep awk "$1" x=1 -eu awk
+&& 2>/dev/null x=1 echo "$1" /usr/bin then /usr/bin -eu "$1" cd
+	sed "$1" ${HOME} readonly
+	2>/dev/null 2>/dev/null | awk echo | ${HOME} echo --verbose
+local test --verbose echo awk && "$@" printf local $(pwd) --verbose awk readonly
+		-eu /usr/bin done export printf --verbose
+	&& ${HOME} readonly export ${HOME}
+		x=1 echo "$1" x=1 ${HOME} then | "$@"
+		-eu 'quoted text' echo awk export "$@" readonly export awk readonly
+readonly 'quoted text' /usr/bin echo 2>/dev/null
+/usr/bin awk x=1 printf 2>/dev/null | cd then done x=1
+then --verbose --verbose awk ${HOME}
+	$(pwd) | /usr/bin /usr/bin done "$1"
+readonly test | awk echo 2>/dev/null done --verbose | cd test
+2>/dev/null /usr/bin test export sed $(pwd)
+		sed | sed "$1" $(pwd) grep "$@" /usr/bin
+		grep 'quoted text' ${HOME} grep "$@" echo "$1" -eu cd | awk cd then then
+"$@" "$@" 2>/dev/null x=1
+		grep 'quoted text' cd test export
+	| awk "$@" local readonly --verbose
+		x=1 test -eu ${HOME} printf readonly
+${HOME} cd local 'quoted text' test printf cd 'quoted text'
+/usr/bin x=1 awk test printf -eu | echo --verbose
+--verbose "$1" && && -eu
+"$@" then export export export grep "$@" 2>/dev/null
+"$@" printf x=1 printf ${HOME} grep grep
+	--verbose grep x=1 sed && test $(pwd) done echo
+	local /usr/bin export cd --verbose
+cd 2>/dev/null 2>/dev/null 'quoted text' |
+		readonly echo awk then local grep local awk
+	grep "$1" then -eu test "$@" x=1 local
+${HOME} done local 'quoted text' local
+		grep export --verbose awk test printf local /usr/bin ${HOME}
+		readonly && then echo $(pwd) "$@"
+	readonly sed local echo ${HOME} printf cd awk "$1" then printf "$@"
+	done done "$@" sed then "$1" readonly "$@" done sed |
+	/usr/bin echo 2>/dev/null "$@" x=1 sed echo test /usr/bin local
+	x=1 then readonly "$1" && then then then awk
+/usr/bin sed --verbose "$@" echo awk local $(pwd) $(pwd) x=1
+		--verbose done --verbose "$1" readonly printf
+&& done cd printf local echo test printf echo cd export grep echo
+	sed "$1" "$@" ${HOME} 2>/dev/null
+2>/dev/null ${HOME} export /usr/bin "$@" done readonly
+${HOME} 2>/dev/null | x=1 then local sed --verbose "$@" && "$@" local
+		printf export x=1 export --verbose 'quoted text' grep printf x=1 readonly
+	&& x=1 && "$1" /usr/bin local
+		-eu echo cd test sed /usr/bin done -eu /usr/bin echo sed then awk echo ${HOME}
+	${HOME} -eu echo local ${HOME}
+		then x=1 printf 2>/dev/null sed test grep then awk test ${HOME} 'quoted text' export
+	x=1 "$1" x=1 awk echo | test sed awk readonly
+		-eu test printf local awk grep grep sed sed x=1 awk test sed "$@" printf
+		sed awk 2>/dev/null printf "$1" $(pwd)
+		local 2>/dev/null | cd 2>/dev/null sed echo sed sed ${HOME} $(pwd) && --verbose
+	-eu grep done | 2>/dev/null ${HOME} "$1" sed x=1 awk grep local ${HOME} | 'quoted text'
+		x=1 grep grep grep $(pwd) 2>/dev/null 'quoted text' x=1 'quoted text' --verbose
+		${HOME} 2>/dev/null "$1"
+2>/dev/null done 2>/dev/null "$@" x=1 printf
+		printf -eu "$1" awk echo test export ${HOME} then done /usr/bin && test printf
+	echo local 2>/dev/null /usr/bin ${HOME} export -eu done
+		/usr/bin | printf then local printf
+		then printf then /usr/bin -eu
+	test -eu | echo ${HOME} /usr/bin done 'quoted text' --verbose | "$1"
+		cd ${HOME} 'quoted text' test x=1 local then printf echo
+		"$@" --verbose x=1 echo "$@" 2>/dev/null "$@" 'quoted text'
+		&& | -eu printf && export test
+	echo --verbose 'quoted text'
+		export x=1 -eu $(pwd) printf readonly $(pwd) test printf
+'quoted text' local --verbose
+		echo | grep local -eu test sed then grep 2>/dev/null
+$(pwd) awk | "$@" done done printf then "$1" awk -eu done test
+'quoted text' local grep 'quoted text' then awk export readonly sed 'quoted text'
+echo awk export -eu -eu -eu
+	echo awk local | "$1" local --verbose
+$(pwd) awk /usr/bin 'quoted text' "$@" printf ${HOME} echo export printf
+	echo "$1" printf $(pwd) --verbose then "$@" awk
+		--verbose grep "$@" ${HOME} && readonly echo grep x=1 "$1" cd x=1
+		"$1" export printf export printf $(pwd) | grep --verbose export
+		export "$1" local "$@" ${HOME}
+then awk 'quoted text' "$@" test
+		printf then then --verbose awk echo $(pwd) test && "$1" x=1 $(pwd) 'quoted text'
+		2>/dev/null sed 'quoted text' 'quoted text' | $(pwd) awk && /usr/bin
+	local done x=1 'quoted text'
+	$(pwd) local --verbose 'quoted text' then /usr/bin
+	test $(pwd) "$1" && $(pwd) | -eu -eu "$@" export
+| "$@" printf then x=1 then then readonly
+then export ${HOME} readonly 'quoted text' x=1 cd "$1" local /usr/bin
+cd awk $(pwd) | x=1 export test sed done grep then
+cd "$1" sed grep 'quoted text' export "$1" -eu "$1" sed cd export done
+"$1" $(pwd) -eu local test "$@"
+	printf "$@" $(pwd) && "$@" 2>/dev/null cd x=1 export printf printf /usr/bin
+	'quoted text' cd then ${HOME} | done awk grep "$@" test -eu cd 2>/dev/null
+	&& -eu 2>/dev/null echo cd x=1
+export then grep echo test cd grep ${HOME} awk
+		test | echo readonly
+export ${HOME} test local readonly $(pwd)
+	--verbose -eu echo export --verbose -eu 2>/dev/null
+		$(pwd) echo ${HOME} | cd export done test then printf --verbose grep cd $(pwd) &&
+	then awk sed "$@" awk
+		"$@" awk test then "$@" grep && 2>/dev/null 'quoted text'
+		readonly grep test printf awk readonly "$1" && "$@"
+		-eu export done /usr/bin -eu cd -eu "$@" "$@" test -eu --verbose
+		then -eu test -eu then x=1 awk -eu x=1
+"$1" test cd $(pwd) && export | x=1 -eu --verbose -eu 'quoted text' x=1 local
+		echo local sed echo then -eu "$@" done "$@" /usr/bin "$@" local test
+		export ${HOME} cd grep -eu && ${HOME}
+grep "$@" done 2>/dev/null $(pwd) x=1 cd "$@" cd cd --verbose export $(pwd)
+local --verbose "$1" x=1 then local grep done local local export 2>/dev/null
+awk then then x=1 ${HOME} grep --verbose 'quoted text'
+		printf cd -eu sed awk 'quoted text' -eu x=1 "$1" done "$@" "$@"
+	then then export "$@" -eu cd x=1 readonly "$@"
+		awk done ${HOME} | local cd "$1" /usr/bin
+&& 2>/dev/null && 2>/dev/null echo
+grep x=1 && $(pwd) sed test --verbose test /usr/bin
+	2>/dev/null local | readonly 'quoted text'
+echo --verbose readonly
+printf local grep readonly export local $(pwd) -eu 2>/dev/null awk awk sed grep
+		then printf "$1" sed 2>/dev/null sed grep "$@" && grep "$1" && /usr/bin
+	done readonly echo then x=1 done cd sed && -eu "$1" echo sed awk
+	$(pwd) $(pwd) /usr/bin printf
+		/usr/bin readonly $(pwd) cd grep --verbose then sed ${HOME} 'quoted text' --verbose
+readonly done test "$1" "$1" "$1" sed && -eu then | done -eu test --verbose ${HOME}
+		local sed x=1 x=1 /usr/bin export sed sed x=1 export --verbose
+	printf x=1 export "$1"
+"$@" "$1" sed | then done readonly "$1" 'quoted text'
+awk printf local grep echo "$@"
+		$(pwd) -eu 'quoted text'
+done then cd then grep "$1" sed &&
+printf 'quoted text' export x=1 "$@" | "$@" cd local -eu then printf --verbose
+cd --verbose && sed awk "$@"
+sed cd grep echo "$1" && test ${HOME} $(pwd) 'quoted text' export
+		done -eu | grep readonly && 2>/dev/null | 'quoted text' echo | 2>/dev/null x=1
+	2>/dev/null /usr/bin "$@" /usr/bin x=1
+awk done sed export $(pwd) "$@" printf test 'quoted text' "$@" cd sed 'quoted text'
+		x=1 2>/dev/null export printf /usr/bin done cd cd $(pwd) --verbose
+	x=1 | local -eu && local ${HOME} test
+		sed | --verbose grep printf test && | 'quoted text' && --verbose sed cd
+		&& test 2>/dev/null awk sed | "$1" local sed readonly local 'quoted text'
+	--verbose echo export -eu $(pwd) $(pwd)
+		--verbose $(pwd) done echo export printf echo test awk
+echo sed export local /usr/bin
+		${HOME} local | sed export echo sed
+		local grep /usr/bin "$1" &&
+		/usr/bin export 2>/dev/null ${HOME} $(pwd) echo 2>/dev/null
+then export export test && cd export 'quoted text' x=1 export
+awk $(pwd) done x=1 printf done --verbose
+"$@" echo echo 2>/dev/null sed "$1" ${HOME} readonly ${HOME} /usr/bin /usr/bin
+		"$@" ${HOME} ${HOME} /usr/bin /usr/bin printf done ${HOME} x=1 &&
+	echo echo grep "$@" "$1" -eu readonly
+		2>/dev/null ${HOME} && then export "$@" --verbose
+	x=1 | ${HOME} && readonly && grep 'quoted text' local
+	'quoted text' cd | --verbose /usr/bin then && x=1 local
+		echo test 2>/dev/null then -eu grep /usr/bin "$1" 2>/dev/null x=1 readonly --verbose
+		$(pwd) grep && grep printf echo echo sed export test $(pwd) export then
+export export then -eu cd test 'quoted text'
+		/usr/bin $(pwd) 'quoted text' done local
+"$@" | ${HOME} 2>/dev/null ${HOME}
+${HOME} sed /usr/bin x=1 sed 2>/dev/null /usr/bin
+	awk readonly sed echo ${HOME} "$@" awk
+/usr/bin "$@" /usr/bin ${HOME} 2>/dev/null -eu 2>/dev/null local
+		2>/dev/null && 2>/dev/null export printf then test readonly cd printf
+x=1 grep sed 2>/dev/null /usr/bin 2>/dev/null $(pwd) then "$@" readonly $(pwd)
+test 'quoted text' export printf
+${HOME} x=1 && "$1" ${HOME} echo ${HOME} grep readonly
+	cd -eu /usr/bin then grep "$@" echo 2>/dev/null /usr/bin printf ${HOME}
+local | 2>/dev/null sed -eu --verbose 2>/dev/null -eu ${HOME} /usr/bin
+readonly sed && "$@" done "$@" test cd done 'quoted text' 2>/dev/null
+	'quoted text' -eu grep readonly awk --verbose 'quoted text'
+		export test --verbose awk $(pwd) x=1
+		2>/dev/null grep --verbose -eu "$1" --verbose export grep 'quoted text'
+-eu test "$1" grep grep | "$@" sed /usr/bin sed ${HOME} "$@" x=1 ${HOME} /usr/bin
+		x=1 -eu grep grep 2>/dev/null 'quoted text' grep "$@" 2>/dev/null readonly readonly
+-eu grep printf sed done -eu -eu printf echo test
+	sed sed x=1 awk then $(pwd) ${HOME} "$1" export ${HOME} $(pwd) /usr/bin cd
+	&& awk local -eu then $(pwd) then "$1" 'quoted text'
+done "$@" awk $(pwd) local echo 2>/dev/null
+		&& /usr/bin "$@" | | x=1 test grep echo then done
+done -eu local --verbose echo --verbose local
+	"$1" && "$@" "$1" "$@" 2>/dev/null ${HOME} 'quoted text' "$1" grep
+		printf grep test test -eu -eu "$1" -eu printf
+	then grep ${HOME} awk cd $(pwd)
+	2>/dev/null awk echo awk 'quoted text' 2>/dev/null test "$@" done done
+		$(pwd) -eu /usr/bin awk "$1" && cd then then "$1" done
+--verbose x=1 "$1" test | export cd && | grep cd -eu ${HOME} export -eu --verbose
+	done grep then test echo "$1" then x=1 x=1 cd x=1 readonly 'quoted text' printf
+		-eu && then ${HOME} echo grep awk -eu
+--verbose --verbose -eu cd readonly "$@" echo
+done readonly grep test /usr/bin done readonly test grep echo done "$1" cd
+	cd "$@" | 'quoted text' "$1" /usr/bin sed -eu sed x=1 local
+/usr/bin printf -eu readonly
+		2>/dev/null cd cd -eu grep then test
+	"$@" ${HOME} sed sed | sed | readonly --verbose printf printf
+		-eu --verbose --verbose done "$@" "$@"
+-eu readonly cd "$@" printf awk readonly test echo 'quoted text'
+	grep test /usr/bin "$1" awk ${HOME}
+readonly printf sed --verbose done ${HOME} /usr/bin printf grep sed local
+	$(pwd) then ${HOME} cd echo /usr/bin test /usr/bin printf ${HOME} test | /usr/bin
+printf -eu 2>/dev/null local grep ${HOME} 'quoted text'
+local && "$1" then --verbose x=1 --verbose
+		echo sed cd x=1 then 'quoted text' cd test 2>/dev/null "$@" then then -eu
+		$(pwd) grep test | --verbose /usr/bin export
+cd grep then test 'quoted text' then 'quoted text'
+		${HOME} test sed local echo local printf -eu | cd -eu --verbose export grep 'quoted text'
+		sed awk then /usr/bin awk x=1 sed && 2>/dev/null x=1 "$1"
+	"$1" -eu -eu /usr/bin -eu awk done sed ${HOME}
+cd /usr/bin /usr/bin sed then $(pwd) sed local 2>/dev/null
+		--verbose 2>/dev/null 'quoted text' "$1" "$1" 2>/dev/null printf local cd
+--verbose ${HOME} cd | local awk x=1 echo 'quoted text' -eu ${HOME}
+2>/dev/null 'quoted text' echo export test
+		cd "$@" local local printf && ${HOME} printf local && grep | --verbose
+	| "$@" local --verbose 2>/dev/null test /usr/bin then export
+		awk cd && readonly /usr/bin
+		-eu "$@" printf done 'quoted text' && test
+	/usr/bin readonly -eu grep /usr/bin awk echo grep $(pwd) sed echo
+		/usr/bin $(pwd) /usr/bin echo /usr/bin --verbose awk -eu $(pwd) cd done "$@"
+	&& then cd local awk sed --verbose
+	local test --verbose --verbose sed && | "$@" done local export
+		"$@" -eu cd $(pwd) test sed --verbose x=1
+	awk export grep cd done -eu | cd --verbose -eu 'quoted text' --verbose
+&& printf && $(pwd) 2>/dev/null "$1" sed local
+then awk test x=1 cd /usr/bin grep cd -eu readonly export && &&
+	export sed readonly 2>/dev/null x=1 then x=1 | local ${HOME} awk then grep
+| readonly export cd $(pwd) "$@" | --verbose ${HOME} /usr/bin 2>/dev/null local
+		-eu -eu | then -eu export -eu test
+	export --verbose awk -eu /usr/bin echo local export local 'quoted text'
+readonly sed readonly ${HOME} echo test printf test /usr/bin
+	test -eu -eu echo test echo readonly | cd
+/usr/bin local x=1 test done readonly awk --verbose cd echo
+'quoted text' printf then export grep readonly ${HOME} -eu "$@" export
+'quoted text' awk "$1" ${HOME} -eu local $(pwd)
+		then $(pwd) /usr/bin export "$1" &&
+	done 'quoted text' | local done && && done 2>/dev/null awk 'quoted text' test
+$(pwd) | "$@" export 'quoted text' 2>/dev/null
+		--verbose printf 'quoted text' then readonly
+	| && done cd cd "$@" export 'quoted text' -eu echo 2>/dev/null -eu
+	'quoted text' sed sed 'quoted text' && done 'quoted text'
+readonly ${HOME} "$@" | done test echo -eu grep
+printf local | then echo | cd
+local "$@" 'quoted text' then cd cd awk printf /usr/bin "$1" -eu then -eu
+	done 2>/dev/null 'quoted text' echo printf
+printf /usr/bin printf local readonly test echo 'quoted text' done echo |
+	grep | export && | 2>/dev/null sed done &&
+		sed -eu "$@" -eu 'quoted text' grep "$@" x=1 ${HOME} then export
+	2>/dev/null export then | local /usr/bin echo test --verbose /usr/bin 2>/dev/null
+${HOME} "$@" | ${HOME} done readonly --verbose grep done && test -eu 2>/dev/null
+		printf grep local grep | "$1" "$@" $(pwd) "$@" 2>/dev/null
+	sed "$1" | awk -eu 2>/dev/null 2>/dev/null then sed -eu 'quoted text' && x=1 2>/dev/null
+		awk cd -eu x=1 cd ${HOME} then awk sed local "$1" --verbose --verbose
+		then --verbose printf awk awk ${HOME} then echo then 'quoted text' local
+		grep /usr/bin --verbose "$@" x=1 sed
+"$@" local echo --verbose awk sed sed then cd
+echo $(pwd) -eu ${HOME} /usr/bin -eu export echo
+then then "$@" sed echo done --verbose | grep --verbose readonly awk /usr/bin
+grep export test then grep cd cd x=1 x=1 export 2>/dev/null sed done 2>/dev/null
+--verbose readonly test readonly grep grep local local 2>/dev/null
+	"$1" && local readonly ${HOME} echo
+		"$@" echo -eu $(pwd) "$@" grep grep --verbose && export
+	test x=1 local --verbose | grep readonly "$1" -eu then awk
+	| awk echo && -eu x=1 --verbose 2>/dev/null readonly "$1" awk awk
+	&& readonly "$@" /usr/bin export 'quoted text' $(pwd) readonly ${HOME}
+	&& "$1" sed "$@" local | /usr/bin test "$1" grep x=1 && /usr/bin 2>/dev/null
+	'quoted text' | echo |
+	export -eu | 2>/dev/null x=1 /usr/bin sed
+then done 'quoted text' ${HOME} awk "$1" sed --verbose local echo /usr/bin
+		'quoted text' ${HOME} 'quoted text' cd printf local ${HOME}
+$(pwd) then grep x=1 && ${HOME} --verbose 2>/dev/null "$@" |
+		test then echo && export printf printf
+		local grep ${HOME} local x=1
+	sed local done $(pwd) local test -eu echo readonly $(pwd) cd printf
+--verbose 'quoted text' grep 'quoted text' /usr/bin /usr/bin
+		awk ${HOME} then local export "$1" && printf
+		x=1 sed | cd --verbose printf export "$@" 2>/dev/null
+	echo sed export $(pwd) 'quoted text'
+&& --verbose "$@" test "$1" echo printf x=1
+then 'quoted text' sed ${HOME}
+export grep | awk done echo readonly x=1 then printf --verbose
+		x=1 grep done printf cd printf /usr/bin -eu readonly "$1" ${HOME} export
+	&& awk ${HOME} && "$1" done --verbose --verbose
+	"$@" && $(pwd) --verbose local 2>/dev/null x=1 done echo
+	--verbose test local "$1" cd && sed -eu printf "$1" $(pwd) 'quoted text' "$@"
+awk echo --verbose done ${HOME} $(pwd) 2>/dev/null done $(pwd)
+	export && -eu grep "$@" readonly ${HOME} readonly && "$1" x=1 "$1" printf
+	echo readonly 2>/dev/null 2>/dev/null 2>/dev/null local echo -eu "$@" | export
+		2>/dev/null readonly ${HOME} export test then echo 'quoted text'
+	export 2>/dev/null && && 2>/dev/null /usr/bin && local 'quoted text' x=1 then
+	done sed awk awk awk echo 2>/dev/null then grep readonly then export
+export echo 2>/dev/null
+| "$@" x=1 local ${HOME} cd echo
+done echo local | /usr/bin 'quoted text'
+	grep --verbose local --verbose /usr/bin cd 2>/dev/null
+cd $(pwd) export 2>/dev/null --verbose then /usr/bin
+		export sed test -eu cd && grep && sed
+	x=1 cd --verbose done printf /usr/bin
+	done | grep -eu echo -eu then sed sed echo readonly test then local |
+&& /usr/bin ${HOME} 'quoted text' 'quoted text' "$@" x=1 then
+		-eu ${HOME} readonly "$@" awk readonly
+		2>/dev/null 'quoted text' "$1"
+"$@" printf local 'quoted text' sed "$1" | then cd "$1" x=1 "$@" then x=1 local
+		sed printf /usr/bin /usr/bin 'quoted text'
+		$(pwd) printf grep 'quoted text' export
+	"$1" echo test | "$1" readonly ${HOME}
+sed sed grep && && awk sed
+	echo -eu export && 'quoted text'
+	"$@" echo awk grep cd
+		cd $(pwd) ${HOME} cd /usr/bin then awk "$1" 'quoted text' --verbose sed echo
+	&& /usr/bin done grep 'quoted text' 2>/dev/null
+	grep x=1 "$1" test 'quoted text'
+	&& "$@" then readonly echo export local printf
+	done grep printf echo then awk x=1 grep && 'quoted text' sed && sed test
+		local grep echo export
+		"$@" | 2>/dev/null echo local done 'quoted text' ${HOME} "$@" --verbose "$@" local
+		--verbose -eu "$@" $(pwd)
+${HOME} ${HOME} grep readonly ${HOME} "$1" && 2>/dev/null x=1 export
+	/usr/bin then "$1" then 2>/dev/null then awk -eu readonly done /usr/bin 'quoted text'
+awk | ${HOME} -eu test -eu /usr/bin ${HOME} local "$1" export 'quoted text'
+		x=1 readonly -eu done sed awk -eu -eu awk grep
+		awk test local "$@" && | && test ${HOME} && "$1" -eu printf printf
+	printf | | 2>/dev/null "$@" printf readonly readonly cd "$@" echo sed
+		'quoted text' $(pwd) export
+	local grep awk cd then sed && printf awk | -eu test ${HOME} $(pwd)
+		done x=1 | test --verbose -eu x=1 local
+	export 'quoted text' 2>/dev/null
+		echo printf --verbose --verbose
+		"$@" x=1 x=1 x=1 local ${HOME} 2>/dev/null awk echo
+#include c19.sh
+echo cd ${HOME} -eu local readonly printf printf
+	local 'quoted text' -eu sed
+&& 2>/dev/null ${HOME} "$@" 'quoted text' && /usr/bin 'quoted text' grep echo
+'quoted text' /usr/bin local x=1 $(pwd) ${HOME} --verbose && test | then cd | /usr/bin
+	awk 'quoted text' x=1 local && readonly export export $(pwd) done
+x=1 done awk --verbose | 2>/dev/null x=1 done done 2>/dev/null --verbose
+	-eu -eu && export "$1" --verbose ${HOME} --verbose "$1" echo local
+done readonly 'quoted text' 2>/dev/null ${HOME} "$1"
+| awk printf 2>/dev/null --verbose && cd cd sed done sed then | printf && /usr/bin
+	echo | cd "$@" grep | readonly cd "$1" --verbose --verbose x=1
+		x=1 printf awk test awk grep 2>/dev/null
+	readonly "$@" $(pwd) echo 2>/dev/null /usr/bin "$@" done local
+	/usr/bin awk printf $(pwd) && ${HOME} 'quoted text' "$@" cd done
+echo "$1" cd "$1" local && echo test x=1 "$@" test readonly grep
+	&& | test && grep readonly x=1 cd "$1" /usr/bin test grep ${HOME}
+	${HOME} test x=1 'quoted text' --verbose echo
+		/usr/bin awk local printf x=1 export printf echo --verbose 2>/dev/null 2>/dev/null
+awk "$@" 'quoted text' ${HOME} local echo /usr/bin && done export -eu
+		2>/dev/null --verbose done sed "$1" "$@" cd
+'quoted text' "$1" && local 'quoted text' ${HOME} 'quoted text' sed "$@"
+-eu export local cd && "$@" 'quoted text' readonly /usr/bin /usr/bin echo then
+		2>/dev/null 'quoted text' grep "$@" 2>/dev/null sed --verbose
+		local -eu then ${HOME} readonly "$1" && ${HOME} test test local local
+-eu awk x=1 readonly export readonly export "$1" --verbose test /usr/bin
+	test 2>/dev/null echo |
+	readonly 2>/dev/null grep done done 'quoted text' "$@" 2>/dev/null
+printf echo 2>/dev/null -eu -eu local $(pwd)
+		x=1 2>/dev/null export test
+	x=1 $(pwd) cd | 'quoted text' local test ${HOME} -eu ${HOME}
+		grep 'quoted text' export readonly readonly
+	2>/dev/null "$1" /usr/bin "$@" printf
+	&& --verbose | readonly done 2>/dev/null $(pwd) local && echo awk awk readonly
+	sed echo local "$1" export | then x=1 x=1 ${HOME} grep $(pwd) readonly
+		--verbose grep ${HOME} /usr/bin cd ${HOME} "$1" cd /usr/bin 'quoted text' awk |
+		then && /usr/bin /usr/bin | /usr/bin grep
+		$(pwd) 'quoted text' ${HOME} | cd export readonly export printf
+| cd readonly cd "$@" then readonly ${HOME}
+	"$@" printf test test "$@" 'quoted text' x=1 -eu x=1 /usr/bin readonly 'quoted text'
+sed ${HOME} done | ${HOME} 'quoted text' cd export readonly
+${HOME} x=1 -eu export printf "$@" test test export &&
+		-eu printf "$1" test "$@" export "$1" -eu export "$1" /usr/bin local echo
+	--verbose /usr/bin awk export export
+		export echo cd -eu local x=1 x=1 then cd 2>/dev/null
+		${HOME} "$1" echo done awk
+		readonly then 2>/dev/null x=1 /usr/bin "$@" echo export $(pwd) 'quoted text'
+	done $(pwd) -eu /usr/bin
+&& then done /usr/bin ${HOME} ${HOME}
+	cd sed --verbose -eu 2>/dev/null "$@" printf sed sed test
+grep ${HOME} test /usr/bin && sed echo sed --verbose $(pwd)
+echo /usr/bin test ${HOME}
+		done -eu then printf sed $(pwd)
+| x=1 local x=1 "$@" $(pwd) grep "$1" grep readonly /usr/bin $(pwd) "$@" echo
+		2>/dev/null sed grep -eu then readonly
+	awk readonly --verbose done ${HOME} cd
+&& grep sed | done then
+	printf --verbose printf /usr/bin -eu 2>/dev/null echo test
+		x=1 ${HOME} echo readonly readonly /usr/bin
+&& then local --verbose --verbose /usr/bin "$1" grep /usr/bin
+readonly grep ${HOME} printf
+	printf /usr/bin readonly printf 'quoted text' -eu sed "$1" echo
+"$@" done 'quoted text' sed done ${HOME} --verbose
+done | /usr/bin "$@" grep && "$@" && --verbose readonly awk grep && "$@" && $(pwd)
+	echo local awk awk echo test | awk then x=1 cd 2>/dev/null
+		-eu 'quoted text' done awk
+cd awk --verbose readonly 2>/dev/null sed readonly printf awk $(pwd) test x=1 echo
+| 2>/dev/null test 'quoted text' -eu test "$@" sed test echo
+"$@" echo 'quoted text'
+grep then test readonly
+		"$@" echo /usr/bin awk 2>/dev/null export "$1"
+	readonly "$1" then done 2>/dev/null local grep
+	&& then x=1 sed sed --verbose sed -eu 'quoted text'
+		"$1" "$@" printf -eu then test export "$@" echo grep test local $(pwd) $(pwd)
+export echo test ${HOME} ${HOME} && local $(pwd)
+test local && "$1" /usr/bin
+		grep cd "$1" test done test test echo
+"$1" /usr/bin readonly echo local done printf sed local awk x=1 $(pwd)
+		/usr/bin export ${HOME} | cd cd | printf 2>/dev/null "$@"
+		-eu 2>/dev/null --verbose /usr/bin 2>/dev/null 2>/dev/null -eu done | $(pwd)
+		2>/dev/null export local sed sed
+	"$@" echo /usr/bin /usr/bin /usr/bin "$1" 2>/dev/null $(pwd)
+		readonly 2>/dev/null --verbose -eu
+		grep echo export -eu printf "$@" "$1" then
+x=1 "$1" "$@" "$1" "$@" "$@"
+		-eu awk test -eu awk --verbose readonly grep -eu awk ${HOME} local
+		sed $(pwd) readonly &&
+| 'quoted text' 'quoted text' "$@" awk sed echo -eu local sed /usr/bin
+		echo local x=1 cd sed awk printf
+-eu ${HOME} printf 'quoted text' echo done grep 2>/dev/null 2>/dev/null
+/usr/bin x=1 "$1" | sed test ${HOME}
+		x=1 awk "$1" sed local | "$@" /usr/bin printf grep --verbose
+		/usr/bin done cd then local grep test 2>/dev/null then -eu awk then
+$(pwd) x=1 awk echo export "$@" | test "$1" echo
+echo $(pwd) cd echo grep x=1 $(pwd) x=1 --verbose /usr/bin
+	&& "$1" printf then sed
+	"$1" sed awk sed 'quoted text' ${HOME} 'quoted text'
+		test cd -eu echo local /usr/bin /usr/bin export awk grep done ${HOME}
+	test export -eu "$@" local printf done /usr/bin | test 2>/dev/null
+	done export readonly /usr/bin $(pwd) awk $(pwd) grep 2>/dev/null
+		awk $(pwd) 2>/dev/null /usr/bin "$1" test readonly
+		| done -eu echo x=1 awk /usr/bin /usr/bin test -eu -eu -eu local
+x=1 ${HOME} "$@" local sed
+done cd --verbose printf
+local $(pwd) sed grep 2>/dev/null --verbose |
+		done x=1 2>/dev/null | | /usr/bin cd x=1 $(pwd)
+	cd awk done cd cd | done printf 'quoted text'
+--verbose then grep awk && awk export 'quoted text' && printf grep /usr/bin |
+		x=1 printf echo test then test awk ${HOME}
+done -eu cd | 2>/dev/null | x=1 x=1 2>/dev/null
+| --verbose sed grep 'quoted text'
+done && x=1 then awk then export
+'quoted text' export "$1" test printf
+$(pwd) -eu awk sed "$@" readonly sed sed readonly --verbose
+"$@" "$1" grep done sed
+		--verbose "$@" awk -eu test test /usr/bin echo done
+	"$@" $(pwd) 'quoted text' export x=1 readonly && /usr/bin export grep 2>/dev/null
+	-eu sed export sed grep printf --verbose --verbose
+		-eu echo 'quoted text' local && "$@" awk
+test "$1" --verbose "$1" awk
+		x=1 ${HOME} -eu x=1 --verbose
+		sed 2>/dev/null ${HOME} awk --verbose $(pwd) -eu x=1 "$1" -eu
+-eu x=1 test $(pwd) test readonly /usr/bin grep | test then x=1 "$@"
+	done done echo 2>/dev/null 2>/dev/null printf x=1 echo ${HOME} awk printf "$1"
+export | printf grep readonly export x=1 --verbose /usr/bin
+		"$1" 2>/dev/null readonly "$1" export sed
+		export test export 2>/dev/null test $(pwd) | --verbose
+&& /usr/bin "$@" /usr/bin x=1 readonly 2>/dev/null | export readonly
+	test -eu x=1 $(pwd) 2>/dev/null local | done local cd -eu 2>/dev/null
+	grep "$1" done "$1" grep grep done local
+	sed then then then x=1 done --verbose && "$1"
+echo readonly /usr/bin -eu done then /usr/bin x=1 $(pwd) done x=1 -eu "$1" done
+cd echo ${HOME} awk ${HOME}
+		grep then -eu cd local cd x=1 -eu local 'quoted text' awk readonly -eu -eu export
+		/usr/bin cd ${HOME} 'quoted text' && /usr/bin "$1" done
+	'quoted text' done | grep $(pwd) local
+		"$@" x=1 && && grep done && printf $(pwd) --verbose grep
+local 2>/dev/null cd -eu && | ${HOME} 2>/dev/null "$@" 2>/dev/null
+/usr/bin local ${HOME} -eu sed local x=1 -eu /usr/bin
+2>/dev/null test done local "$1" local then export printf echo "$1" -eu && grep
+	then && | /usr/bin --verbose $(pwd) awk
+		cd 2>/dev/null | local test "$1" x=1 sed x=1 && "$@" grep
+		/usr/bin --verbose echo --verbose sed "$1" && sed export
+	| echo $(pwd) 2>/dev/null -eu 'quoted text' test
+	local printf sed | readonly "$1" cd
+| cd x=1 "$1" grep x=1 $(pwd) local local then 2>/dev/null
+		-eu --verbose readonly awk
+	&& && cd grep 'quoted text' grep printf cd &&
+done $(pwd) /usr/bin x=1 echo cd cd printf printf test "$@" | |
+		export "$@" cd awk ${HOME} /usr/bin test 2>/dev/null local
+		local 2>/dev/null ${HOME} "$@" echo
+	-eu awk "$@" readonly
+		${HOME} $(pwd) local export && ${HOME} test
+2>/dev/null done readonly x=1 then 'quoted text' then test echo sed 'quoted text'
+echo --verbose then sed printf echo local x=1
+	| done sed test export cd -eu
+echo -eu x=1 && ${HOME} test
+export readonly "$1" readonly sed done export ${HOME}
+"$@" sed "$@" grep export x=1 sed --verbose done
+	"$@" /usr/bin local grep grep echo /usr/bin then 'quoted text'
+/usr/bin test 2>/dev/null x=1 x=1 "$@" local 2>/dev/null /usr/bin awk "$1"
+		-eu && sed cd readonly echo ${HOME} echo && export
+		$(pwd) done --verbose ${HOME} | awk | | ${HOME} then
+		"$@" awk awk then /usr/bin && 2>/dev/null 'quoted text' grep
+$(pwd) $(pwd) grep x=1 "$@" --verbose cd echo sed grep awk local readonly
+	| readonly ${HOME} local sed
+&& local awk readonly
+-eu && x=1 x=1 --verbose 'quoted text' 'quoted text' test
+	-eu -eu printf echo | | printf sed
+cd ${HOME} $(pwd) /usr/bin printf
+	${HOME} -eu local export echo -eu --verbose "$1" then | /usr/bin export readonly
+		/usr/bin 2>/dev/null /usr/bin done ${HOME} cd && "$1" | export
+/usr/bin 'quoted text' -eu "$1" && $(pwd) awk && then $(pwd) test --verbose
+echo then test export &&
+		"$@" local awk -eu && local grep 2>/dev/null
+	--verbose ${HOME} /usr/bin done $(pwd) test | 'quoted text'
+--verbose "$1" --verbose done "$1" test echo awk then
+		export echo && /usr/bin test test test "$@" x=1 cd local 2>/dev/null echo
+	x=1 | readonly test readonly cd "$1" ${HOME} ${HOME} echo $(pwd)
+&& test 2>/dev/null -eu x=1
+--verbose 2>/dev/null 'quoted text'
+readonly then -eu "$@" cd 2>/dev/null x=1 done /usr/bin x=1 then
+	'quoted text' --verbose then sed ${HOME} x=1
+${HOME} /usr/bin awk | "$1" 2>/dev/null
+	local "$@" --verbose local
+		readonly x=1 awk awk grep awk sed done readonly then then | /usr/bin $(pwd)
+		&& "$1" 'quoted text' && sed x=1 done && ${HOME} --verbose
+	sed export cd grep export cd test printf && done export readonly | echo && && /usr/bin
+		"$@" cd /usr/bin 'quoted text' cd "$@" 'quoted text'
+${HOME} grep && export -eu test printf done printf then x=1 | x=1 sed
+local readonly readonly
+		--verbose 2>/dev/null echo sed ${HOME} echo && done echo x=1 local
+2>/dev/null "$@" "$@" | $(pwd) $(pwd)
+grep | awk echo done sed sed awk 2>/dev/null local grep -eu awk done
+printf $(pwd) done 2>/dev/null --verbose
+${HOME} 2>/dev/null echo
+	export | | /usr/bin cd readonly /usr/bin && -eu export x=1 2>/dev/null $(pwd)
+		echo grep grep | $(pwd) 'quoted text'
+test done -eu ${HOME} /usr/bin x=1 | x=1 done /usr/bin sed
+		"$@" test grep x=1 cd x=1
+	"$@" done local export
+	printf && printf echo local
+export -eu then /usr/bin sed done readonly -eu then && grep done
+	done export then grep awk /usr/bin "$1" done $(pwd) cd && awk test "$@"
+	--verbose test --verbose ${HOME} readonly
+		test awk /usr/bin 'quoted text' readonly && && -eu done x=1 grep
+	&& $(pwd) cd done && local /usr/bin | "$@" x=1 export
+${HOME} grep "$1" "$1" grep
+done ${HOME} test $(pwd) readonly cd --verbose grep /usr/bin "$1"
+then done | x=1 ${HOME} cd "$@" done grep grep
+		export /usr/bin 'quoted text' | $(pwd)
+		local readonly local cd printf awk 'quoted text' /usr/bin awk "$1" export
+		echo | test test --verbose "$@"
+	| && 2>/dev/null export "$1" test 2>/dev/null then /usr/bin "$@" --verbose
+	done sed cd 2>/dev/null 'quoted text' x=1 && readonly printf /usr/bin export
+	sed "$1" printf 'quoted text' $(pwd) readonly --verbose test
+		"$1" test printf export --verbose
+	awk 2>/dev/null then local echo sed cd
+	readonly printf && 'quoted text'
+	/usr/bin sed grep $(pwd) && export then | test
+x=1 sed then --verbose && /usr/bin grep cd && done export --verbose
+	-eu && "$@" sed printf $(pwd) test "$1" /usr/bin
+	| 2>/dev/null ${HOME} local echo awk then ${HOME} done printf
+	export && printf export cd echo then x=1 echo sed x=1 -eu x=1 "$@" cd
+		printf "$1" -eu awk then && test | -eu
+local 2>/dev/null readonly test $(pwd) &&
+		x=1 awk "$@" 2>/dev/null --verbose 2>/dev/null local grep
+		grep ${HOME} ${HOME} export && 'quoted text' export test --verbose ${HOME}
+		${HOME} 'quoted text'
+	-eu local readonly 2>/dev/null x=1 export $(pwd) sed cd -eu sed 'quoted text' sed
+		export 2>/dev/null printf
+		"$@" echo ${HOME} cd export local -eu "$1" then
+		printf 2>/dev/null printf | /usr/bin sed 'quoted text' echo grep
+		export 2>/dev/null 2>/dev/null -eu "$1" --verbose echo
+grep ${HOME} local && 'quoted text'
+/usr/bin printf --verbose sed done then sed awk readonly echo cd
+local /usr/bin echo cd 'quoted text'
+	${HOME} --verbose "$1" "$1" x=1 cd x=1 done 2>/dev/null "$@" readonly local cd
+	"$1" "$1" sed echo -eu export
+		'quoted text' x=1 && x=1 ${HOME} --verbose
+-eu local -eu $(pwd) done printf 2>/dev/null x=1 $(pwd) "$1"
+	grep 'quoted text' cd | | readonly -eu "$@"
+	export 'quoted text' ${HOME} awk
+then cd printf readonly 2>/dev/null --verbose ${HOME} then && && test
+		| cd echo printf && readonly
+| cd test awk grep test 2>/dev/null
+	export 'quoted text' /usr/bin
+	test readonly test then "$@"
+"$@" -eu | "$@" -eu /usr/bin done $(pwd) x=1 'quoted text'
+	'quoted text' awk $(pwd) ${HOME} printf
+		&& /usr/bin 2>/dev/null readonly "$@" $(pwd) then test x=1 echo grep "$@" test
+sed cd local | local export
+&& grep | 2>/dev/null readonly "$@" then then sed "$1" $(pwd)
+		| local --verbose export readonly "$1" $(pwd) echo echo echo readonly
+echo cd test /usr/bin 2>/dev/null --verbose x=1 local echo
+		"$1" grep && -eu awk export awk done export done "$1" 'quoted text' test awk
+		'quoted text' 'quoted text' grep export && $(pwd) $(pwd) echo
+cd $(pwd) | "$@" --verbose "$1" test then readonly local &&
+	/usr/bin awk $(pwd) echo readonly printf x=1 grep awk export local x=1 grep echo
+	| local local x=1 local done
+export readonly /usr/bin x=1 --verbose
+	${HOME} --verbose then | then "$@"
+&& && "$@" && 2>/dev/null readonly grep done grep local cd done
+x=1 "$1" local awk export done
+	x=1 test ${HOME} export then sed /usr/bin sed awk "$1"
+		test 2>/dev/null x=1 local printf 2>/dev/null cd x=1 echo -eu then $(pwd)
+		2>/dev/null cd "$@" --verbose $(pwd) && ${HOME} | then "$@"
+	'quoted text' echo grep -eu 'quoted text'
+printf -eu test local printf local 'quoted text'
+	readonly | | -eu "$1" readonly export x=1 "$1" && "$1" /usr/bin
+readonly x=1 --verbose "$1" 'quoted text'
+| test then grep printf -eu
+awk "$@" awk done cd | test awk readonly --verbose -eu --verbose x=1 readonly
+	/usr/bin ${HOME} /usr/bin -eu sed --verbose
+	"$1" readonly /usr/bin /usr/bin /usr/bin 'quoted text' then export 2>/dev/null
+x=1 echo /usr/bin ${HOME} -eu |
+		2>/dev/null printf "$@" sed cd test $(pwd) ${HOME}
+'quoted text' then export && 2>/dev/null | awk ${HOME} awk --verbose 'quoted text'
+		&& $(pwd) sed printf sed
+$(pwd) x=1 -eu local /usr/bin printf 'quoted text' readonly | "$1" cd 'quoted text'
+	readonly 'quoted text' "$1"
+		grep cd cd | local cd test sed awk $(pwd) "$1" ${HOME} sed /usr/bin
+		x=1 readonly -eu 2>/dev/null "$1"
+		echo export sed grep "$@" done "$@" readonly
+		/usr/bin then export grep && && cd test 2>/dev/null $(pwd)
+	/usr/bin | ${HOME} export printf x=1 readonly --verbose
+"$1" awk printf readonly
+	export /usr/bin | grep
+	echo | && 'quoted text' x=1
+		sed export x=1 && x=1 "$1" 2>/dev/null readonly test -eu printf
+| grep /usr/bin then "$1" --verbose grep 'quoted text' readonly
+		/usr/bin 2>/dev/null export "$@" && $(pwd)
+		"$@" | | awk ${HOME} && readonly "$@" "$@" done local then && 2>/dev/null
+		sed && grep export cd ${HOME}
+export grep "$@" && awk echo echo "$@" 'quoted text' cd echo /usr/bin
+	awk ${HOME} 'quoted text' export grep export && ${HOME} readonly "$1" $(pwd)
+	-eu export ${HOME} grep awk $(pwd) done cd | "$@" awk "$@" printf echo
+printf done grep x=1 awk printf |
+	2>/dev/null 2>/dev/null printf | done 2>/dev/null printf done echo x=1 -eu cd export
+		printf "$1" "$@" --verbose sed 2>/dev/null
+	readonly echo export ${HOME} "$@" export && ${HOME}
+'quoted text' readonly
+	--verbose ${HOME} test then readonly export sed "$@"
+	cd readonly done x=1 2>/dev/null awk cd grep cd local $(pwd) printf then readonly
+	-eu /usr/bin printf $(pwd) readonly printf readonly echo
+local && && 'quoted text' x=1 echo $(pwd) $(pwd) 'quoted text'
+	done "$@" readonly local "$1" | grep local /usr/bin
+		x=1 printf export $(pwd) "$1" /usr/bin --verbose done test /usr/bin $(pwd) printf
+printf "$@" /usr/bin echo && local "$@" 'quoted text' done "$@" echo readonly
+"$1" readonly /usr/bin export printf 'quoted text'
+	cd /usr/bin sed | | | test echo grep local && grep $(pwd)
+		awk done /usr/bin grep -eu cd test ${HOME} readonly --verbose local "$@"
+readonly --verbose /usr/bin && echo export grep $(pwd) cd
+		--verbose "$@" export $(pwd)
+--verbose sed export cd /usr/bin --verbose
+	echo /usr/bin awk readonly then "$1" ${HOME} -eu | printf x=1 ${HOME}
+		sed /usr/bin local -eu -eu "$@" then "$1" test | export x=1 && printf x=1
+done "$1" 'quoted text' x=1 "$@" grep cd -eu x=1 /usr/bin 'quoted text'
+		"$1" && export sed local
+	export local 2>/dev/null
+	x=1 export awk ${HOME} echo ${HOME} then
+	then --verbose readonly 2>/dev/null readonly 'quoted text' sed 2>/dev/null "$1"
+	sed echo printf --verbose ${HOME} "$1"
+	cd $(pwd) local printf printf grep 'quoted text' printf export awk "$1" $(pwd)
+	echo readonly done "$@" "$1" readonly then --verbose
+	"$1" $(pwd) printf ${HOME} 'quoted text' -eu then $(pwd) x=1 --verbose
+	grep "$@" 2>/dev/null done 2>/dev/null ${HOME} $(pwd)
+-eu ${HOME} local && printf grep /usr/bin && 'quoted text' /usr/bin test 'quoted text'
+grep sed ${HOME} done sed $(pwd) 'quoted text' --verbose test $(pwd) local
+/usr/bin --verbose x=1 "$@" 'quoted text' done --verbose sed test 2>/dev/null
+		/usr/bin export printf cd done "$@" cd ${HOME} echo $(pwd) /usr/bin readonly
+		| echo 'quoted text' sed done
+		awk 2>/dev/null 2>/dev/null --verbose && 'quoted text'
+		$(pwd) $(pwd) 'quoted text' echo "$1" echo local x=1 'quoted text'
+	local -eu readonly $(pwd) 'quoted text' export
+		'quoted text' $(pwd) -eu && && ${HOME} x=1 grep printf sed | $(pwd) test
+x=1 $(pwd) export | grep readonly ${HOME} echo "$1" --verbose
+sed done && -eu 'quoted text' then -eu
+echo test 2>/dev/null grep "$1" readonly | | "$1" "$1"
+	--verbose awk local --verbose export "$1" | export
+	$(pwd) "$1" 'quoted text' test x=1 printf export
+		test 'quoted text' cd && x=1 done export --verbose done "$1" --verbose awk 'quoted text'
+	echo ${HOME} cd x=1 grep readonly -eu 2>/dev/null export 2>/dev/null then 'quoted text'
+awk cd awk printf grep then cd 2>/dev/null
+		printf "$@" cd grep -eu awk | $(pwd) local done test /usr/bin echo export test
+	awk grep $(pwd) export echo
+&& printf ${HOME} sed $(pwd) 2>/dev/null local echo ${HOME} sed 'quoted text' echo
+--verbose --verbose ${HOME} printf echo echo "$1" grep | printf local
+	local x=1 then 2>/dev/null 2>/dev/null | $(pwd) sed -eu
+		done x=1 local awk | | export sed "$1"
+	readonly readonly /usr/bin
+grep -eu grep "$1" "$@" -eu
+		sed && /usr/bin grep 2>/dev/null "$1" done test
+		/usr/bin test printf export printf
+		&& grep /usr/bin 2>/dev/null readonly done 'quoted text'
+grep printf grep readonly $(pwd) local -eu
+		done then local && sed test
+	'quoted text' local printf && --verbose x=1 "$@" test 2>/dev/null
+	readonly export "$1" /usr/bin
+	$(pwd) sed "$@" then /usr/bin 'quoted text'
+readonly --verbose | echo sed done "$1" test sed done
+	/usr/bin echo sed cd sed echo export echo echo ${HOME} printf
+&& export && then then cd /usr/bin then awk cd
+&& | x=1 cd "$@" sed x=1
+		"$1" -eu ${HOME} | cd -eu cd awk 2>/dev/null 2>/dev/null
+		--verbose export local "$@" test "$1"
+	then /usr/bin grep --verbose export local sed -eu sed local echo
+	'quoted text' done then 'quoted text' sed sed done sed
+	"$1" $(pwd) test then test && sed done awk readonly then /usr/bin
+		then echo 'quoted text' /usr/bin | local && awk
+		"$@" export awk x=1 $(pwd) ${HOME} export $(pwd) | export export readonly 'quoted text'
+	local 2>/dev/null --verbose local x=1 awk x=1 then local x=1
+		2>/dev/null --verbose && | local "$@" 2>/dev/null --verbose echo printf --verbose
+"$1" done 2>/dev/null local
+	${HOME} echo local "$@"
+echo --verbose 2>/dev/null "$1" echo echo -eu printf --verbose |
+	test readonly readonly x=1 test export
+		'quoted text' $(pwd) x=1 2>/dev/null grep test printf grep
+	local test export -eu "$1" 'quoted text' grep test "$@" | /usr/bin test sed
+${HOME} /usr/bin "$@" cd "$@" -eu x=1 echo readonly
+	done --verbose && readonly cd readonly
+export then 2>/dev/null --verbose
+	-eu awk "$@" awk && cd ${HOME} grep "$1" ${HOME} cd awk sed --verbose
+sed x=1 ${HOME} export 2>/dev/null
+		local done cd echo export local x=1 readonly ${HOME} cd | 2>/dev/null
+	"$1" $(pwd) echo cd x=1 awk local && local then
+		local x=1 "$1" sed then local /usr/bin export done grep
+	export local "$1" sed grep grep "$@" | test
+awk cd "$1" ${HOME} && /usr/bin "$@" | &&
+x=1 2>/dev/null done /usr/bin readonly
+		/usr/bin --verbose && /usr/bin ${HOME} && readonly done then 2>/dev/null
+--verbose && | readonly cd $(pwd) "$1" 'quoted text' 2>/dev/null -eu awk $(pwd)
+	readonly "$1" sed 2>/dev/null awk | x=1 "$@" | 'quoted text' 'quoted text'
+		test echo && | done -eu export | printf grep sed grep then then
+		local echo ${HOME} $(pwd) /usr/bin cd --verbose 2>/dev/null | export
+		$(pwd) printf awk cd "$@" sed ${HOME}
+export printf export printf echo export
+export 'quoted text' $(pwd) done done /usr/bin $(pwd) 'quoted text' sed
+	"$@" printf 'quoted text' test "$@" --verbose readonly && && echo printf echo
+cd "$1" "$1" x=1 sed ${HOME} 2>/dev/null cd 'quoted text'
+		cd sed -eu sed export && sed --verbose then
+"$1" "$1" "$1" $(pwd) --verbose ${HOME} x=1 "$1" 'quoted text' x=1 x=1 echo export
+		--verbose grep cd awk grep readonly | "$1" ${HOME}
+		${HOME} readonly readonly
+	done cd test test cd && | test awk /usr/bin local "$@"
+		printf awk | x=1 -eu echo then export && local --verbose && export
+then printf done --verbose "$@" "$@" $(pwd) grep then | "$@" sed | | "$1"
+	/usr/bin done && x=1 sed local export 'quoted text' echo cd echo ${HOME}
+		cd readonly then $(pwd) | 2>/dev/null then sed x=1 echo echo "$@" cd 'quoted text'
+local $(pwd) --verbose x=1 cd $(pwd) test test | /usr/bin
+x=1 "$@" export && 2>/dev/null && "$1" x=1 "$@" --verbose test x=1 done ${HOME}
+		/usr/bin printf sed "$1" then printf readonly --verbose ${HOME}
+		printf ${HOME} -eu awk && --verbose sed 2>/dev/null "$1" test $(pwd)
+	&& /usr/bin printf && 2>/dev/null
+cd && test "$1" done readonly export local
+/usr/bin printf 2>/dev/null -eu cd echo awk awk "$1" ${HOME}
+	$(pwd) readonly echo export "$@" test ${HOME} then "$@" "$@"
+	'quoted text' sed echo sed --verbose 2>/dev/null | done readonly sed grep
+-eu echo export grep printf cd test | "$@" echo && "$1" 2>/dev/null
+		--verbose -eu $(pwd) printf --verbose 2>/dev/null test
+		/usr/bin --verbose --verbose
+cd 'quoted text' awk $(pwd) echo -eu awk local | sed "$@" --verbose
+2>/dev/null export ${HOME}
+		-eu "$1" /usr/bin "$1" /usr/bin awk $(pwd) --verbose printf cd grep
+		printf "$1" local printf done then echo then 'quoted text'
+	cd then echo "$@" local $(pwd) echo 2>/dev/null
+echo local cd 2>/dev/null "$@" then awk |
+x=1 readonly $(pwd) "$1" printf -eu $(pwd) ${HOME}
+test $(pwd) local x=1 awk echo | && echo 2>/dev/null
+		echo grep $(pwd) "$1" cd readonly local ${HOME}
+		printf x=1 $(pwd) x=1 "$@" done readonly local test local --verbose --verbose readonly
+$(pwd) && /usr/bin "$1" awk export local "$1"
+	'quoted text' && ${HOME} then "$1" 'quoted text' $(pwd) printf -eu "$1" local
+done 2>/dev/null export readonly test
+	"$1" 'quoted text' readonly awk printf then "$@" 'quoted text' $(pwd)
+grep ${HOME} 2>/dev/null $(pwd) then awk 'quoted text'
+-eu export 'quoted text'
+		test 'quoted text' 'quoted text' -eu export "$@" 'quoted text'
+	printf grep local ${HOME} $(pwd) /usr/bin test local
+| local local export "$1" done printf
+	done -eu "$@" sed --verbose
+		2>/dev/null 'quoted text' export 'quoted text'
+	readonly then readonly test export "$@" --verbose --verbose done test echo "$@"
+grep 'quoted text' then echo cd echo && grep cd /usr/bin
+		&& -eu "$@" test --verbose test printf 2>/dev/null
+	"$@" "$1" "$@" 2>/dev/null 'quoted text' --verbose grep && awk
+		-eu awk test x=1 $(pwd) && "$@" | ${HOME}
+	awk 'quoted text' 'quoted text' | cd export /usr/bin awk &&
+		-eu export local local -eu then done grep "$1" awk ${HOME} ${HOME} --verbose
+	--verbose 'quoted text' &&
+		done then done && 'quoted text' | ${HOME} test
+		--verbose ${HOME} x=1 2>/dev/null
+		2>/dev/null x=1 sed grep
+	export && test --verbose x=1 awk cd $(pwd) "$@" local
+	'quoted text' 2>/dev/null sed cd export export cd
+	printf local then | $(pwd) export
+		-eu then | export && readonly && "$1" test done
+	printf --verbose done test cd then | x=1 grep /usr/bin awk -eu 2>/dev/null
+		export test echo export local cd grep export /usr/bin 'quoted text' /usr/bin ${HOME}
+	$(pwd) local | | /usr/bin "$1" "$1" "$@" | done "$@" 'quoted text' 2>/dev/null
+	then local sed "$1" cd /usr/bin -eu --verbose export 'quoted text'
+		readonly echo grep test done grep done | ${HOME} echo 'quoted text'
+printf x=1 sed /usr/bin printf local sed sed && /usr/bin "$1" && --verbose
+	"$1" && done -eu done ${HOME} 2>/dev/null
+		"$1" 'quoted text' && "$@" | &&
+		x=1 awk readonly /usr/bin done "$1" export "$1" done x=1 awk
+		--verbose done awk 2>/dev/null then --verbose grep && local
+done done export -eu then readonly
+		local && cd cd $(pwd) /usr/bin awk -eu $(pwd)
+		"$1" test sed 2>/dev/null echo done
+		x=1 --verbose x=1 --verbose "$1" --verbose sed done readonly
+		${HOME} 2>/dev/null test | local local $(pwd) | x=1 'quoted text' -eu local "$1"
+		| sed x=1 $(pwd) echo test done printf export test ${HOME} then && test && local
+local readonly cd test sed | "$1" && sed
+		readonly /usr/bin 'quoted text'
+	$(pwd) | ${HOME} sed /usr/bin grep cd /usr/bin readonly 'quoted text'
+	-eu test -eu $(pwd) /usr/bin local x=1 readonly cd readonly
+		| export && /usr/bin test local --verbose grep grep /usr/bin
+		/usr/bin "$@" printf 2>/dev/null | 2>/dev/null awk sed | | "$@" then &&
+	2>/dev/null 2>/dev/null && done local && local | ${HOME} printf printf /usr/bin
+	then cd 'quoted text' test
+	--verbose then "$@" 'quoted text' ${HOME}
+'quoted text' | echo sed readonly then local local done
+		$(pwd) x=1 grep x=1 export
+sed "$1" echo $(pwd) grep --verbose --verbose printf "$1"
+		test | test --verbose --verbose echo export x=1 "$1" awk x=1 2>/dev/null
+-eu 'quoted text' x=1 2>/dev/null && $(pwd) echo then ${HOME}
+		then then echo /usr/bin
+cd 'quoted text' --verbose awk $(pwd) "$@" local sed $(pwd) 2>/dev/null
+	echo x=1 sed --verbose | 2>/dev/null --verbose
+/usr/bin cd export done --verbose && awk awk -eu done x=1 echo
+		awk printf ${HOME} sed export cd -eu $(pwd) printf 2>/dev/null
+grep export "$@" -eu 'quoted text'
+	done 2>/dev/null grep 2>/dev/null printf 2>/dev/null 'quoted text'
+	sed -eu && "$@" local && awk readonly $(pwd)
+	"$@" -eu awk cd --verbose | "$@"
+	grep local readonly sed echo
+"$@" x=1 --verbose "$@" "$@" 2>/dev/null awk awk printf readonly then grep "$1"
+2>/dev/null test | "$1" | ${HOME}
+		| sed x=1 then export export
+		done --verbose then done awk test
+		grep then "$@" cd cd ${HOME} printf && sed ${HOME} --verbose
+/usr/bin ${HOME} cd readonly awk -eu cd printf ${HOME}
+		readonly x=1 local done echo test done "$1" echo readonly 2>/dev/null
+	"$@" 'quoted text' sed | export 2>/dev/null ${HOME} sed ${HOME} cd ${HOME}
+	2>/dev/null cd local sed
+		local ${HOME} export && done &&
+cd awk 2>/dev/null 2>/dev/null printf grep | done
+		awk -eu export "$@" 'quoted text' | ${HOME}
+	local 2>/dev/null x=1 | export --verbose readonly done then $(pwd)
+sed "$1" "$@" && printf /usr/bin && then | test
+	"$@" echo "$1" local readonly ${HOME} readonly echo -eu local
+	'quoted text' --verbose sed $(pwd) $(pwd)
+	printf 2>/dev/null | local x=1 awk readonly
+		sed readonly --verbose echo 2>/dev/null x=1 ${HOME} local $(pwd) "$1" grep
+	sed "$1" --verbose "$1" "$@" export done /usr/bin ${HOME} readonly ${HOME} 2>/dev/null
+	$(pwd) cd && echo echo 2>/dev/null | test --verbose cd local && test x=1 export
+echo export $(pwd) | $(pwd) test 'quoted text' done cd /usr/bin | /usr/bin --verbose
+	-eu local sed ${HOME} local -eu 'quoted text'
+sed x=1 sed "$1" ${HOME} x=1 awk /usr/bin -eu local local export
+		$(pwd) sed then sed then --verbose /usr/bin
+	| /usr/bin "$1" 2>/dev/null export printf grep readonly grep echo grep printf
+		| awk local sed $(pwd) 'quoted text' readonly 'quoted text'
+printf /usr/bin export then "$1" 'quoted text' | --verbose
+		-eu --verbose /usr/bin export && "$@" x=1 grep $(pwd)
+	"$1" x=1 -eu awk && | 'quoted text' -eu x=1 local /usr/bin grep x=1 export
+		readonly cd local awk "$@" then -eu grep ${HOME} x=1 grep ${HOME} printf $(pwd)
+	grep $(pwd) | /usr/bin | 2>/dev/null "$1" then readonly --verbose "$@" ${HOME}
+		printf test "$1" cd ${HOME} -eu x=1
+	"$@" ${HOME} local ${HOME} grep sed &&
+/usr/bin "$1" echo --verbose 'quoted text' ${HOME} /usr/bin
+	-eu test --verbose ${HOME} echo $(pwd) -eu
+	"$@" done awk "$@" printf sed done 'quoted text' printf
+	echo 'quoted text' grep && sed readonly awk $(pwd) readonly x=1
+	"$1" | printf then grep
+echo "$@" cd --verbose $(pwd)
+		x=1 "$@" done "$1" --verbose | /usr/bin
+$(pwd) grep cd cd done cd grep 'quoted text' test -eu "$@" then
+		/usr/bin "$1" | "$@" 2>/dev/null
+/usr/bin grep /usr/bin export 'quoted text' ${HOME} "$@" grep
+	export readonly echo | readonly
+		readonly echo x=1 printf test 2>/dev/null export /usr/bin
+		'quoted text' --verbose 'quoted text'
+		sed -eu ${HOME} sed sed /usr/bin
+		| ${HOME} echo test echo ${HOME} then ${HOME} export --verbose
+local then readonly readonly
+		export -eu x=1 echo | export /usr/bin
+x=1 "$@" done sed done done export echo
+	local grep export /usr/bin 2>/dev/null
+	| -eu awk -eu 'quoted text' "$1" awk --verbose awk /usr/bin grep grep printf
+2>/dev/null grep /usr/bin 2>/dev/null $(pwd)
+	2>/dev/null local 2>/dev/null
+	awk /usr/bin --verbose echo ${HOME} sed cd printf -eu
+--verbose x=1 "$@" readonly grep /usr/bin x=1 ${HOME} then sed && $(pwd)
+		x=1 ${HOME} $(pwd) grep grep test "$@" "$@" local
+	| local printf printf | x=1 awk "$1" test -eu 2>/dev/null 'quoted text'
+		"$@" sed x=1 awk test done sed
+		awk $(pwd) | cd && ${HOME} grep grep test export readonly test awk local
+	&& "$@" x=1 $(pwd) grep $(pwd)
+	export 'quoted text' cd -eu "$1" x=1 'quoted text' echo 2>/dev/null
+readonly && test cd awk -eu x=1 /usr/bin "$@" then test --verbose ${HOME}
+	"$1" "$@" $(pwd) 'quoted text' awk
+		readonly "$@" grep /usr/bin 'quoted text' export "$@" echo
+		cd x=1 && printf x=1 "$@" cd "$1" | | readonly
+	${HOME} "$1" test /usr/bin /usr/bin | /usr/bin && 2>/dev/null
+		test $(pwd) echo | ${HOME} -eu done -eu 'quoted text' --verbose 2>/dev/null
+	grep | awk "$1" /usr/bin && $(pwd) x=1 "$1" /usr/bin awk "$1" done
+	grep "$1" 2>/dev/null printf /usr/bin ${HOME} 'quoted text'
+	test | $(pwd) --verbose -eu | ${HOME} test then && 2>/dev/null export
+awk -eu sed x=1 sed cd 2>/dev/null -eu x=1 && 2>/dev/null sed /usr/bin
+		"$1" 'quoted text' local --verbose
+x=1 2>/dev/null /usr/bin echo sed $(pwd) grep
+		readonly readonly | && grep --verbose done $(pwd)
+		x=1 && "$1" readonly $(pwd) sed grep local sed "$1" x=1 echo echo | x=1 ${HOME}
+test ${HOME} 'quoted text' export --verbose -eu grep | ${HOME} done
+	-eu | --verbose x=1 awk local printf then 'quoted text' --verbose
+local /usr/bin export export sed -eu
+${HOME} x=1 done grep 2>/dev/null
+		"$1" printf awk export sed cd ${HOME} sed echo test x=1 ${HOME}
+test ${HOME} grep -eu x=1 grep "$@" /usr/bin -eu && "$1" readonly grep readonly
+test /usr/bin 2>/dev/null ${HOME} "$1" done 'quoted text' "$@" cd
+		printf /usr/bin --verbose --verbose && readonly 'quoted text' "$1" x=1 $(pwd) "$@"
+	2>/dev/null test | $(pwd) --verbose export x=1 | $(pwd) x=1 'quoted text'
+sed x=1 export export x=1 readonly cd
+done -eu 'quoted text' then "$1" x=1 --verbose then $(pwd) 'quoted text'
+		done local | 'quoted text' /usr/bin ${HOME} | $(pwd) printf $(pwd) && awk
+		${HOME} "$1" ${HOME} sed "$1" --verbose test
+	test echo | | --verbose && "$1" sed 'quoted text' awk "$1" $(pwd) | 2>/dev/null
+	/usr/bin then $(pwd) /usr/bin then sed then 'quoted text'
+awk | 'quoted text' x=1 test -eu test && 2>/dev/null 'quoted text' local export
+	awk then local ${HOME} cd | -eu cd test local
+		"$@" "$@" cd export cd test test ${HOME} &&
+		printf "$1" test ${HOME} && --verbose -eu export printf grep test cd local cd /usr/bin
+		2>/dev/null -eu --verbose cd --verbose x=1 x=1 2>/dev/null local
+	cd "$@" "$@" printf awk -eu test
+		-eu cd x=1 test local awk
+	then | "$1" --verbose && then --verbose then readonly "$1" | "$@" then readonly
+	/usr/bin --verbose 2>/dev/null grep --verbose done printf ${HOME}
+	"$@" /usr/bin | | then then x=1 $(pwd) 2>/dev/null --verbose
+	x=1 done awk awk /usr/bin 2>/dev/null export ${HOME}
+		printf | x=1 readonly ${HOME}
+	| $(pwd) readonly --verbose echo readonly readonly ${HOME} printf readonly
+	/usr/bin /usr/bin local grep
+		export 2>/dev/null awk | printf "$@" awk 2>/dev/null x=1 x=1 then | && /usr/bin
+"$@" && ${HOME} "$1" "$1" cd 'quoted text' cd &&
+	test -eu local ${HOME} then /usr/bin local done | && --verbose 2>/dev/null
+		-eu grep ${HOME} cd --verbose echo sed then
+sed local local done -eu 'quoted text' -eu test sed export local $(pwd)
+	export /usr/bin ${HOME} export cd "$1" $(pwd) cd cd echo test
+'quoted text' awk "$@" awk $(pwd) printf
+'quoted text' /usr/bin ${HOME} "$@" | 2>/dev/null --verbose
+&& --verbose cd "$@" $(pwd) ${HOME}
+x=1 test && $(pwd) $(pwd) printf export awk echo printf grep export 2>/dev/null
+		x=1 | printf "$@" cd cd ${HOME} done export x=1 x=1 "$1" then
+x=1 done local sed local "$@" ${HOME} test echo 'quoted text'
+		test test sed "$@" then printf
+		$(pwd) x=1 grep x=1 then | done | export ${HOME} | /usr/bin $(pwd) 'quoted text'
+	echo readonly done "$1" x=1 export awk printf
+| $(pwd) && && "$@" 2>/dev/null 'quoted text' local -eu | sed 2>/dev/null ${HOME}
+	sed export then cd 'quoted text' readonly done sed 'quoted text'
+export 'quoted text' "$@" sed && x=1 'quoted text'
+cd "$@" "$1" && /usr/bin sed 'quoted text' done 'quoted text'
+		then "$1" cd done "$1" "$@" awk
+--verbose done test readonly echo ${HOME} then readonly awk readonly export readonly
+	grep done | --verbose readonly && grep awk readonly echo x=1
+export && --verbose echo --verbose
+	x=1 then $(pwd) ${HOME} /usr/bin readonly /usr/bin
+		readonly grep grep sed awk --verbose 'quoted text' 2>/dev/null
+	&& 2>/dev/null test test -eu "$1" then 'quoted text' local && /usr/bin
+&& && sed readonly export 'quoted text' && printf --verbose
+		$(pwd) printf printf awk sed sed 2>/dev/null -eu printf echo
+	echo sed echo sed echo readonly
+		$(pwd) "$1" awk /usr/bin --verbose
+"$1" awk then echo cd | | $(pwd) /usr/bin
+		cd && export readonly test x=1 "$1" local 'quoted text'
+	/usr/bin echo export then local 'quoted text' cd printf 'quoted text' done awk
+test /usr/bin local $(pwd) ${HOME} /usr/bin && 'quoted text' cd
+/usr/bin 2>/dev/null printf ${HOME} readonly -eu printf -eu local 2>/dev/null
+	'quoted text' grep /usr/bin grep "$@" ${HOME}
+"$1" 'quoted text' sed "$1" echo "$@" | x=1 | $(pwd) --verbose --verbose
+test awk cd printf test cd 'quoted text' 'quoted text' printf readonly $(pwd) local
+grep 'quoted text' cd 2>/dev/null then "$1" "$@" | cd ${HOME}
+		/usr/bin "$1" readonly done cd cd --verbose printf done
+printf awk sed 2>/dev/null 2>/dev/null grep $(pwd) sed | sed
+		done --verbose then local "$1" --verbose --verbose /usr/bin /usr/bin
+	${HOME} "$1" $(pwd) $(pwd) "$@" --verbose then -eu --verbose awk ${HOME} grep
+	${HOME} -eu sed readonly $(pwd) readonly
+		then printf echo --verbose && x=1 then cd echo awk grep |
+	/usr/bin readonly test
+	cd ${HOME} then awk awk sed 'quoted text'
+	readonly 'quoted text' $(pwd) ${HOME} -eu awk cd awk test --verbose grep
+		/usr/bin export local sed -eu 2>/dev/null && 2>/dev/null awk readonly
+	$(pwd) echo 2>/dev/null awk readonly "$@"
+	2>/dev/null ${HOME} x=1 printf sed 2>/dev/null --verbose 'quoted text' ${HOME}
+readonly cd $(pwd) done readonly --verbose $(pwd)
+&& $(pwd) $(pwd) awk 2>/dev/null ${HOME} && -eu
+awk x=1 export | | awk then | $(pwd) awk cd && x=1
+${HOME} 2>/dev/null done then export cd x=1 "$1" then echo && local --verbose test
+	'quoted text' "$@" awk cd /usr/bin sed test "$1" then "$@"
+		export -eu x=1 sed echo ${HOME} && $(pwd) 'quoted text' "$@" 'quoted text' echo
+	${HOME} printf echo awk | local export local echo "$@" done sed done --verbose
+	cd /usr/bin test printf "$@" /usr/bin then -eu x=1
+"$@" -eu && | | | cd grep printf printf echo export | cd -eu export
+echo $(pwd) --verbose echo test --verbose
+grep | done -eu done $(pwd) cd x=1 --verbose
+		2>/dev/null sed "$@" "$1" test then 'quoted text' -eu
+grep local "$@" done then cd
+$(pwd) readonly x=1 export local | | grep test /usr/bin
+	awk test "$@" "$1" test && 2>/dev/null grep readonly printf 'quoted text'
+		local 'quoted text' "$@" && && test x=1
+cd done done grep test && test x=1 "$1"
+	$(pwd) then awk echo /usr/bin
+		-eu echo /usr/bin 'quoted text' readonly printf ${HOME} export "$1" done cd printf
+	grep printf echo grep "$@" printf "$@" export readonly export /usr/bin
+then done ${HOME} done readonly test x=1 "$@" local
+		local sed sed local ${HOME} x=1 --verbose && | x=1 export sed ${HOME}
+	echo local cd 2>/dev/null grep test "$@" cd x=1 done 2>/dev/null 'quoted text' -eu
+	| cd 2>/dev/null echo test then "$@" ${HOME} awk then printf
+		grep | ${HOME} x=1 x=1 awk $(pwd) -eu /usr/bin
+	"$1" -eu awk ${HOME} readonly local -eu then echo
+${HOME} export | echo $(pwd) 'quoted text' -eu local awk echo grep
+	awk then /usr/bin 2>/dev/null
+export export awk /usr/bin printf printf awk ${HOME} -eu then readonly
+		$(pwd) $(pwd) printf /usr/bin 'quoted text'
+	/usr/bin then --verbose then 2>/dev/null then
+		x=1 x=1 "$@" && readonly "$1" --verbose
+		cd $(pwd) | printf export | "$1" ${HOME} export | local test sed "$1"
+		$(pwd) 2>/dev/null printf sed
+--verbose -eu "$1" local done local 'quoted text' sed /usr/bin 2>/dev/null
+	sed test local --verbose echo echo
+		--verbose ${HOME} x=1 && export readonly /usr/bin
+x=1 | $(pwd) --verbose local | done sed x=1 "$@" printf
+		printf -eu "$1" "$1" local cd grep ${HOME} "$@" /usr/bin readonly readonly
+		/usr/bin $(pwd) /usr/bin export export grep | grep 2>/dev/null
+/usr/bin printf export local sed sed -eu cd --verbose && awk 2>/dev/null
+echo then $(pwd) 2>/dev/null /usr/bin sed sed sed readonly export awk
+	${HOME} cd local grep $(pwd) x=1 export
+	$(pwd) done 2>/dev/null 2>/dev/null
+export "$1" test then "$@"
+local | cd 'quoted text' then local
+	echo done /usr/bin grep "$1" --verbose sed && printf printf --verbose
+	&& grep $(pwd) 'quoted text' -eu && local test ${HOME}
+	&& -eu $(pwd) then -eu printf local
+readonly local readonly --verbose x=1 /usr/bin done then ${HOME} ${HOME} done
+	done 2>/dev/null sed grep | done export then
+		readonly echo grep test $(pwd) then -eu -eu "$@" ${HOME} printf
+		printf --verbose $(pwd)
+--verbose --verbose local grep awk $(pwd) then
+		x=1 && ${HOME} $(pwd) --verbose | | x=1
+local echo x=1 2>/dev/null 'quoted text' local done readonly
+2>/dev/null | -eu printf cd grep cd cd echo grep 'quoted text'
+		readonly --verbose ${HOME}
+test awk echo 2>/dev/null && /usr/bin
+cd grep export 2>/dev/null "$@" cd
+		local printf echo "$@" then readonly "$@"
+then --verbose done x=1 "$@" cd local
+	--verbose export echo --verbose 2>/dev/null "$1" awk 2>/dev/null cd
+	x=1 -eu /usr/bin | local ${HOME} done printf export local "$@" sed sed echo awk
+		sed readonly x=1 /usr/bin export
+		cd printf | 'quoted text'
+	-eu "$1" readonly local $(pwd) 2>/dev/null
+		awk -eu --verbose test $(pwd) && x=1 | 2>/dev/null then printf
+	$(pwd) cd "$@" local /usr/bin 'quoted text' local local
+cd ${HOME} 2>/dev/null -eu 'quoted text'
+		awk awk done | export 'quoted text' readonly then 2>/dev/null x=1 'quoted text'
+"$1" local ${HOME} printf
+"$@" test | echo x=1 local cd grep then then "$1"
+		"$@" sed test done 'quoted text' "$1" then 'quoted text' test echo done "$1"
+		| -eu "$1" "$1" sed cd printf printf sed -eu awk
+echo 2>/dev/null readonly grep -eu readonly cd ${HOME} /usr/bin --verbose
+	sed ${HOME} /usr/bin readonly sed -eu
+	-eu local done /usr/bin -eu sed then
+	done echo then "$1" -eu "$1" readonly && "$@" cd done cd && awk awk export
+"$1" printf printf -eu awk 2>/dev/null
+		echo "$@" "$1" sed | 2>/dev/null readonly sed /usr/bin
+	2>/dev/null && grep echo /usr/bin
+	/usr/bin sed | cd "$@" | && then grep "$@" echo printf local
+awk done grep 'quoted text' -eu echo export $(pwd) "$1" 'quoted text' sed
+	echo -eu -eu && && x=1 -eu cd --verbose printf
+		done "$1" ${HOME} sed cd
+	awk --verbose 'quoted text' /usr/bin grep local
+		export && 'quoted text' /usr/bin 'quoted text' printf
+	awk "$1" -eu ${HOME} then
+	printf test local "$@"
+	local printf export --verbose sed then local
+/usr/bin done --verbose export ${HOME} | 'quoted text'
+		grep then cd "$1" 2>/dev/null ${HOME} "$1" export "$1"
+then /usr/bin ${HOME} then && $(pwd)
+		&& sed && 'quoted text' "$1" local "$@"
+		"$@" | x=1 readonly ${HOME} -eu echo readonly
+		2>/dev/null && 2>/dev/null /usr/bin "$@" grep cd "$1" --verbose
+		sed 'quoted text' $(pwd) grep
+	done awk 'quoted text' awk x=1 done local ${HOME} local /usr/bin awk -eu readonly
+	cd "$1" printf readonly && $(pwd) export printf --verbose test | cd 2>/dev/null
+	"$1" then 'quoted text' echo
+		printf local "$@" printf awk "$@" done readonly 2>/dev/null cd test
+2>/dev/null 2>/dev/null grep done cd grep echo
+		&& "$1" local -eu && 2>/dev/null cd | -eu x=1 && && x=1 x=1 done
+		2>/dev/null done local grep /usr/bin test "$@" x=1 2>/dev/null
+2>/dev/null printf && export "$@" printf -eu export -eu
+	${HOME} awk test then -eu
+	done sed done grep | 2>/dev/null local
+then $(pwd) grep 'quoted text' sed echo --verbose
+readonly done -eu test "$@" 2>/dev/null $(pwd) ${HOME}
+done then cd /usr/bin | 2>/dev/null sed "$@" test | /usr/bin
+		${HOME} cd done local | echo readonly $(pwd) "$1" cd readonly 2>/dev/null
+		--verbose export grep printf ${HOME} sed 2>/dev/null
+	done && then echo export sed 'quoted text' "$@" "$@" 2>/dev/null 'quoted text'
+		local echo printf then readonly local /usr/bin
+readonly export test && test done
+	done -eu echo /usr/bin "$@" && printf grep printf done test then grep -eu
+	sed $(pwd) "$@" done readonly sed done "$1" sed 'quoted text'
+		--verbose then | readonly 2>/dev/null --verbose 2>/dev/null echo printf
+	$(pwd) printf sed export x=1
+		--verbose cd "$@" x=1 'quoted text' local echo ${HOME}
+	sed printf ${HOME} echo then local 2>/dev/null "$@" test cd test echo | then
+	awk test readonly printf cd then printf /usr/bin
+	| then readonly awk export --verbose x=1 printf
+		awk /usr/bin "$@" readonly readonly test 'quoted text' 2>/dev/null grep
+	&& --verbose x=1 export --verbose $(pwd) x=1 | $(pwd) "$@" && | 'quoted text'
+	"$@" local test done "$@" export readonly 2>/dev/null
+		${HOME} grep printf test 'quoted text' $(pwd)
+done export | echo cd test $(pwd) awk then readonly readonly &&
+	| --verbose cd x=1 "$@" printf readonly $(pwd) --verbose
+awk "$1" 'quoted text' "$1" x=1 "$@" then
+	${HOME} 'quoted text' echo sed awk "$@" --verbose 2>/dev/null 'quoted text'
+	"$@" echo | $(pwd) "$@" "$@" grep $(pwd) $(pwd)
+echo done sed /usr/bin cd sed then test /usr/bin
+		local x=1 cd ${HOME} echo
+		/usr/bin /usr/bin -eu ${HOME} -eu && then sed awk "$1" cd awk awk
+		awk echo grep awk --verbose --verbose --verbose 2>/dev/null
+	readonly ${HOME} /usr/bin -eu grep test readonly
+		-eu local "$1" | "$@" grep --verbose
+&& && /usr/bin test $(pwd) then then export done -eu then cd grep "$@" export
+	cd /usr/bin x=1 then test
+printf | echo readonly test 2>/dev/null local readonly --verbose local ${HOME}
+	"$1" x=1 2>/dev/null 2>/dev/null then sed cd && test
+		2>/dev/null -eu "$@" /usr/bin "$1" then echo "$1" echo printf ${HOME}
+	-eu awk x=1 awk /usr/bin printf export readonly
+cd cd $(pwd) x=1 local export -eu grep "$@" 2>/dev/null awk
+local "$1" 'quoted text' done
+	printf ${HOME} "$@" -eu done test ${HOME} 'quoted text' /usr/bin
+		local export echo /usr/bin printf
+test | 'quoted text' printf
+$(pwd) done readonly --verbose export export done && -eu cd 2>/dev/null done
+$(pwd) "$1" 2>/dev/null 'quoted text' awk
+local test -eu grep | /usr/bin printf "$@" printf | cd "$1" x=1 x=1 test "$@"
+		/usr/bin $(pwd) x=1 local cd awk 2>/dev/null awk echo 2>/dev/null
+echo grep 2>/dev/null readonly cd done $(pwd) test done test export printf done
+	$(pwd) done -eu awk grep grep readonly printf --verbose
+		&& then sed $(pwd) "$@" "$1" sed /usr/bin
+cd 2>/dev/null local $(pwd) ${HOME} && printf
+${HOME} "$@" local x=1 awk grep then grep | -eu awk done
+		$(pwd) --verbose "$1" cd cd && "$1" /usr/bin export ${HOME}
+/usr/bin local x=1 cd -eu --verbose local
+	grep x=1 readonly cd | test "$1" readonly readonly /usr/bin x=1
+		x=1 --verbose printf -eu x=1 readonly cd awk awk $(pwd) && export done
+2>/dev/null printf readonly awk
+	"$@" done | sed sed awk echo cd -eu 'quoted text'
+	printf cd done printf then then "$@" test echo "$1"
+	echo test then done awk
+then -eu "$@" /usr/bin printf printf printf awk --verbose && cd
+		--verbose -eu readonly "$@" ${HOME}
+printf && /usr/bin 2>/dev/null && | grep cd readonly x=1 export "$1" 'quoted text'
+echo "$@" $(pwd) readonly export grep /usr/bin awk awk
+	"$@" sed 'quoted text' echo "$@" $(pwd)
+${HOME} export printf ${HOME} cd && grep export | printf sed test &&
+then then /usr/bin ${HOME} then x=1 sed sed "$@" "$@" done 2>/dev/null
+sed /usr/bin | then export test 2>/dev/null printf x=1 cd && ${HOME} grep test
+		done test cd awk "$1" $(pwd) readonly test readonly sed readonly grep
+2>/dev/null grep 2>/dev/null -eu export local awk
+	readonly | cd && $(pwd)
+"$@" 2>/dev/null $(pwd) --verbose ${HOME} printf | done
+	local $(pwd) sed cd echo test sed -eu "$1" ${HOME} grep grep 'quoted text'
+		export export sed && --verbose 2>/dev/null | then printf cd -eu /usr/bin
+export x=1 -eu "$1" -eu 2>/dev/null "$@" -eu | local
+	| $(pwd) test done local printf 2>/dev/null readonly x=1 | -eu && printf
+	then && "$@" awk ${HOME} export &&
+		&& "$@" /usr/bin cd | -eu /usr/bin
+		"$@" export "$1" | "$@" 2>/dev/null ${HOME}
+	awk $(pwd) /usr/bin && then ${HOME} export ${HOME} --verbose 2>/dev/null 'quoted text'
+		| cd /usr/bin x=1 done grep "$@" readonly
+	x=1 then $(pwd) printf "$1"
+	export test then "$1" awk
+test && ${HOME} "$1" $(pwd) grep -eu printf 2>/dev/null then | 2>/dev/null export
+&& ${HOME} /usr/bin done && x=1 2>/dev/null -eu $(pwd) "$@"
+x=1 /usr/bin x=1 then | local readonly && 'quoted text' -eu local
+x=1 "$@" done /usr/bin $(pwd) --verbose &&
+	printf readonly --verbose "$1"
+	${HOME} grep cd readonly -eu done "$@" readonly
+		2>/dev/null /usr/bin done && "$1" x=1
+done /usr/bin awk $(pwd) sed test
+${HOME} 'quoted text' x=1 $(pwd) readonly local && ${HOME}
+		export /usr/bin x=1 "$1" done export -eu "$@"
+		'quoted text' --verbose awk
+		'quoted text' grep -eu x=1
+	"$1" done "$@" readonly printf local
+	awk then awk grep "$1" done grep done | | x=1 printf 'quoted text'
+	local echo awk test -eu 2>/dev/null -eu /usr/bin
+	/usr/bin local "$@" && "$@" cd export x=1 export $(pwd) x=1 | /usr/bin awk
+	then then && ${HOME} "$@" "$@"
+	-eu -eu 'quoted text' | "$1" done --verbose local printf local printf "$1" $(pwd)
+	grep /usr/bin x=1 x=1 "$1" test ${HOME} printf 2>/dev/null export | local --verbose
+readonly printf $(pwd) "$@" export sed ${HOME} /usr/bin printf
+		"$1" local awk sed | --verbose 'quoted text' | | cd $(pwd) $(pwd)
+		test awk then then $(pwd) 'quoted text' 2>/dev/null
+	sed 2>/dev/null "$@" done readonly $(pwd) cd echo grep then then /usr/bin
+echo cd local test /usr/bin
+		local local test ${HOME} "$1" echo then /usr/bin && "$1"
+-eu local x=1 cd "$1" done export "$@" done |
+	grep -eu 2>/dev/null sed
+		-eu export | --verbose --verbose | 2>/dev/null --verbose 2>/dev/null echo
+printf --verbose x=1 done /usr/bin local 'quoted text' /usr/bin 'quoted text'
+then 2>/dev/null grep then
+'quoted text' "$1" printf test then export grep -eu sed
+x=1 'quoted text' echo -eu test | ${HOME} -eu
+		2>/dev/null x=1 local printf grep
+$(pwd) ${HOME} readonly readonly done sed 'quoted text' && local
+done "$1" ${HOME} test /usr/bin cd --verbose ${HOME} awk
+	$(pwd) 2>/dev/null 'quoted text'
+-eu printf export printf --verbose cd grep ${HOME}
+--verbose --verbose 2>/dev/null
+--verbose echo local echo $(pwd)
+		2>/dev/null printf x=1 done 2>/dev/null 2>/dev/null
+		&& readonly -eu grep local local then | /usr/bin 2>/dev/null awk echo
+		echo export | cd && --verbose readonly "$@" echo done /usr/bin
+	| $(pwd) && local test then
+-eu 'quoted text' $(pwd) 'quoted text' 'quoted text' awk test printf
+		"$1" -eu /usr/bin "$1" --verbose readonly x=1 readonly printf
+		x=1 $(pwd) /usr/bin 2>/dev/null 'quoted text'
+	--verbose awk done sed echo test
+readonly /usr/bin echo cd 'quoted text' echo awk echo then --verbose
+		&& then -eu --verbose cd 2>/dev/null -eu export |
+	then echo echo test "$@" -eu 'quoted text' export
+	cd /usr/bin $(pwd) "$@" printf readonly ${HOME} --verbose $(pwd) /usr/bin
+		&& $(pwd) "$@" /usr/bin /usr/bin grep "$@" readonly 'quoted text' "$@" readonly
+	&& test printf "$1" cd sed cd 2>/dev/null cd
+local && $(pwd) x=1 printf done
+'quoted text' x=1 && sed x=1 ${HOME} $(pwd) awk /usr/bin
+		export cd --verbose export sed x=1 $(pwd) test ${HOME}
+	echo 2>/dev/null ${HOME} && grep
+		2>/dev/null export x=1 grep 2>/dev/null local "$@" cd test ${HOME} x=1
+| x=1 echo && $(pwd) ${HOME} 2>/dev/null 'quoted text'
+		$(pwd) done readonly then cd /usr/bin --verbose cd
+echo sed readonly "$@" awk 2>/dev/null printf "$1" --verbose
+test "$1" then && printf /usr/bin "$@" "$@" | /usr/bin cd x=1 -eu cd x=1 --verbose
+	&& x=1 ${HOME} echo -eu
+		readonly grep readonly | awk x=1 local then /usr/bin
+		$(pwd) "$@" awk --verbose "$1" && cd then export awk readonly
+readonly -eu $(pwd) $(pwd) $(pwd)
+		echo local "$1" -eu test && local | awk then "$1" sed export x=1 -eu
+	cd -eu export grep --verbose
+$(pwd) "$1" /usr/bin test x=1 then local local printf readonly
+-eu local --verbose --verbose sed /usr/bin $(pwd) awk "$1" | x=1
+		&& /usr/bin test printf
+	| grep ${HOME} printf done readonly then "$1" && printf x=1 | local done $(pwd)
+		cd /usr/bin $(pwd) printf cd readonly
+${HOME} cd test 2>/dev/null export grep test then
+		done | export done export -eu echo sed done grep -eu local | printf cd then | then
+&& && "$@" readonly "$@" then -eu test done ${HOME} "$1" grep then done
+cd local sed x=1 cd -eu | x=1 'quoted text' printf "$1" 2>/dev/null "$1" ${HOME}
+		${HOME} 'quoted text' echo 'quoted text' done local export /usr/bin
+		echo export 2>/dev/null grep "$1" && "$1" /usr/bin cd /usr/bin && sed echo
+		echo 'quoted text' test
+readonly $(pwd) test printf printf
+	x=1 && "$@" then printf
+	local local | test grep
+		$(pwd) grep x=1 grep "$1" test printf cd cd cd /usr/bin 2>/dev/null
+x=1 x=1 $(pwd) export cd done export x=1 readonly local
+		--verbose cd grep then sed /usr/bin --verbose readonly
+	| x=1 'quoted text' readonly local local printf grep echo echo
+	${HOME} && && done cd awk 'quoted text' test --verbose
+	cd export local done printf local test awk local $(pwd)
+	x=1 ${HOME} sed printf cd awk echo grep cd 'quoted text'
+then | export awk | && "$1" sed $(pwd) && echo ${HOME} -eu
+local $(pwd) local grep test echo done test --verbose
+2>/dev/null "$@" | $(pwd) x=1 2>/dev/null then --verbose grep done
+		"$@" export 2>/dev/null "$@" echo && x=1 && printf
+		-eu -eu printf readonly --verbose
+	grep awk 2>/dev/null -eu local printf ${HOME}
+readonly --verbose "$@" 'quoted text' readonly then echo 2>/dev/null
+	-eu ${HOME} /usr/bin --verbose grep local
+printf grep "$@" local grep awk $(pwd) ${HOME} cd then | readonly test then
+&& awk export grep test $(pwd) awk printf export /usr/bin test echo
+		then --verbose then "$1" && --verbose cd test grep done 'quoted text'
+		export local x=1 cd x=1 /usr/bin "$@" awk cd "$@" export
+	grep printf export ${HOME} sed readonly then "$1" -eu
+readonly x=1 test export /usr/bin local local readonly "$1" sed /usr/bin
+	${HOME} echo 'quoted text' done export "$@" | "$1" awk grep | x=1 'quoted text'
+	&& printf 'quoted text' 2>/dev/null awk echo
+		| grep --verbose printf | local export "$@"
+| export then $(pwd) --verbose 'quoted text' sed "$@" --verbose
+| then | cd | sed $(pwd) readonly echo "$@" awk -eu
+	-eu test export $(pwd) 2>/dev/null --verbose done cd done grep /usr/bin
+	"$@" "$1" printf printf ${HOME} grep x=1 "$1" done local --verbose export
+		"$1" -eu "$@" export $(pwd) "$@"
+	| ${HOME} | awk --verbose done done $(pwd) readonly done grep awk $(pwd) local
+	/usr/bin then $(pwd) /usr/bin -eu ${HOME} x=1 "$1" export
+	sed export printf "$1" readonly -eu printf awk
+	'quoted text' local test grep -eu -eu x=1
+		-eu "$@" echo then local x=1 --verbose
+	printf 2>/dev/null cd sed /usr/bin awk | test grep export then
+awk sed 'quoted text' | x=1 then sed 2>/dev/null 'quoted text'
+$(pwd) done | "$1" echo --verbose printf 2>/dev/null
+awk -eu $(pwd) done awk cd 'quoted text'
+	cd $(pwd) /usr/bin export readonly --verbose && 'quoted text' then && then cd
+	readonly ${HOME} 2>/dev/null | && done x=1 readonly && x=1 "$1" x=1 2>/dev/null
+		grep -eu test 'quoted text' grep x=1 ${HOME} --verbose /usr/bin
+cd $(pwd) printf "$@" readonly x=1 local | readonly -eu 2>/dev/null
+then printf readonly -eu cd readonly
+		then echo printf "$@" x=1 ${HOME} test | echo -eu 2>/dev/null then /usr/bin
+	/usr/bin awk "$@" && echo grep
+	x=1 ${HOME} grep x=1 echo "$1" ${HOME} done echo then | cd sed | /usr/bin
+	printf sed readonly echo 'quoted text' -eu $(pwd) printf grep
+awk grep echo echo echo ${HOME} /usr/bin x=1 test local -eu local
+	&& && then echo "$1" $(pwd) done
+	test test printf "$1" "$1" && echo && sed done | grep $(pwd) done awk
+sed echo done x=1 --verbose done && "$1" --verbose && | $(pwd) awk sed
+		test && 'quoted text' ${HOME} $(pwd)
+local local x=1 readonly then printf test cd echo | ${HOME} "$1"
+		/usr/bin awk 'quoted text' then sed && $(pwd) export grep | $(pwd) -eu done
+/usr/bin export echo | 'quoted text'
+local "$@" x=1 /usr/bin
+	| "$@" readonly 2>/dev/null
+		$(pwd) then export $(pwd) "$@"
+		"$1" "$@" "$1" | readonly
+then echo cd "$1" test grep awk readonly readonly
+done /usr/bin local ${HOME} echo local local && echo
+	2>/dev/null printf "$@" "$@" export $(pwd)
+	readonly done && awk cd echo /usr/bin /usr/bin | "$@" /usr/bin
+	--verbose local awk export && /usr/bin
+--verbose "$1" ${HOME} printf done local
+		grep --verbose readonly | cd /usr/bin printf --verbose printf done
+		"$@" printf awk -eu --verbose 'quoted text' 'quoted text'
+		readonly | "$1" cd grep readonly readonly -eu done export test |
+grep --verbose then 'quoted text' | grep then export sed
+		export | printf readonly && awk readonly readonly done local 'quoted text' x=1
+		&& ${HOME} cd test test sed readonly
+		2>/dev/null echo 2>/dev/null cd x=1 ${HOME} grep grep | --verbose done printf
+awk | --verbose "$1" echo then && x=1 -eu --verbose printf test local awk sed
+		grep "$@" "$1" && 'quoted text' x=1 export
+local cd awk printf cd --verbose 2>/dev/null then "$1" export awk --verbose then
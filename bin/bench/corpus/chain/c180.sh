@@ -0,0 +1,2001 @@
+	'quoted text' ${HOME}
+readonly export && export 'quoted text'
+	awk local && cd grep $(pwd) echo x=1 |
+test grep export && 'quoted text' /usr/bin ${HOME} -eu sed awk x=1 "$1"
+local echo x=1 cd --verbose sed test 'quoted text'
+echo | then "$@" local awk 'quoted text' local export "$1" local
+		test && echo x=1 x=1 test awk
+${HOME} ${HOME} sed "$@" -eu $(pwd) awk -eu x=1 local -eu &&
+		echo awk sed done echo x=1 /usr/bin cd --verbose && printf 2>/dev/null
+awk "$@" test 'quoted text' cd | grep 'quoted text' /usr/bin
+	echo awk export "$@" --verbose
+		| --verbose x=1 --verbose echo "$@" printf sed
+		| -eu sed /usr/bin $(pwd) awk ${HOME} echo | printf
+	test sed | --verbose 'quoted text' && /usr/bin printf
+		${HOME} x=1 2>/dev/null x=1 awk awk
+		&& -eu /usr/bin done 'quoted text' printf test cd local -eu
+export awk echo /usr/bin printf grep done | 'quoted text' "$@" "$@"
+"$1" x=1 local echo "$1"
+	'quoted text' "$1" then printf then local echo export | -eu
+	'quoted text' --verbose 'quoted text' ${HOME} && cd --verbose ${HOME} done
+		/usr/bin "$1" readonly | printf printf cd echo
+	| then "$@" grep echo $(pwd) $(pwd) $(pwd)
+		"$1" "$@" x=1 "$1" x=1 local readonly printf done ${HOME} local /usr/bin cd grep
+		'quoted text' -eu --verbose export
+		$(pwd) grep -eu 'quoted text' sed test
+export $(pwd) "$@" 'quoted text' 'quoted text'
+		&& 2>/dev/null echo readonly grep
+		printf cd "$1" test printf
+	2>/dev/null | export test ${HOME} awk ${HOME} cd
+	readonly ${HOME} then sed printf grep 'quoted text' && printf
+		2>/dev/null /usr/bin then awk | ${HOME} 'quoted text'
+	&& x=1 $(pwd) test cd done ${HOME} echo ${HOME} then test grep
+readonly /usr/bin /usr/bin $(pwd) /usr/bin grep /usr/bin 'quoted text' readonly
+		test sed /usr/bin 2>/dev/null awk echo /usr/bin
+/usr/bin $(pwd) | 2>/dev/null echo awk && grep awk 'quoted text'
+	cd local ${HOME} 'quoted text'
+local "$@" local 'quoted text' 2>/dev/null
+then ${HOME} sed "$1" sed then
+		/usr/bin "$@" "$1" echo grep then 'quoted text' "$@" --verbose "$1" ${HOME} 'quoted text'
+	| export 2>/dev/null -eu export | -eu "$1"
+&& cd $(pwd) echo sed
+	awk "$@" 2>/dev/null "$1" /usr/bin test
+"$1" $(pwd) "$1" "$@" awk export /usr/bin
+'quoted text' export awk "$1" awk printf x=1
+&& --verbose sed /usr/bin && test && && /usr/bin
+done && --verbose test /usr/bin sed --verbose 2>/dev/null --verbose x=1 | printf
+--verbose printf && --verbose local && done ${HOME} 'quoted text'
+		readonly readonly sed | done "$@" local --verbose
+	cd done | echo --verbose export --verbose echo 2>/dev/null cd awk sed "$1" -eu
+		"$@" printf printf local "$1" && "$1" awk ${HOME} ${HOME} "$1" "$1" && "$1"
+		--verbose sed $(pwd) awk 'quoted text' export cd awk && printf -eu
+	/usr/bin export echo $(pwd) x=1 cd then | "$@" ${HOME}
+done grep then grep echo 'quoted text' $(pwd) "$@" local test &&
+	'quoted text' | 'quoted text' | 2>/dev/null grep local awk "$1"
+		echo sed readonly && | && 2>/dev/null x=1 then sed cd echo
+		x=1 /usr/bin awk "$@" 'quoted text' echo 2>/dev/null ${HOME}
+then "$1" /usr/bin echo $(pwd) ${HOME} awk
+then echo test grep local done done done &&
+/usr/bin -eu grep cd --verbose done sed done
+${HOME} sed done 'quoted text' --verbose "$1" $(pwd)
+	done printf export done --verbose readonly then then printf 2>/dev/null
+done | $(pwd) --verbose export export export printf -eu sed $(pwd) "$1" "$1"
+	2>/dev/null export && ${HOME} then printf
+	x=1 then local && 2>/dev/null test -eu x=1
+	echo -eu echo -eu && x=1 2>/dev/null ${HOME}
+		grep | local 2>/dev/null cd x=1 sed sed && cd export "$@" cd
+"$@" then cd export readonly | echo test
+		-eu awk x=1 "$1" ${HOME} --verbose sed "$1" ${HOME}
+	"$@" sed export x=1 /usr/bin ${HOME} export sed
+&& | 'quoted text' | 'quoted text' printf ${HOME}
+	export export sed 2>/dev/null $(pwd) -eu
+	| then --verbose 'quoted text'
+		cd "$1" "$1" x=1 grep done 'quoted text'
+then printf | && 'quoted text' 2>/dev/null && readonly --verbose
+"$@" test $(pwd) readonly && grep /usr/bin done done sed | ${HOME} test
+		&& readonly 'quoted text' $(pwd) "$@"
+	--verbose && done && $(pwd) | export | "$@" $(pwd) echo /usr/bin grep echo && &&
+cd grep test $(pwd) echo
+	2>/dev/null awk test awk "$@" readonly ${HOME} 2>/dev/null
+${HOME} done $(pwd) "$@" 'quoted text' ${HOME} /usr/bin readonly
+	2>/dev/null 'quoted text' x=1 $(pwd) local
+		awk -eu | local awk awk 2>/dev/null done ${HOME} "$@" printf printf printf -eu
+	then local | local done awk ${HOME} x=1 2>/dev/null $(pwd)
+$(pwd) then --verbose test awk grep 'quoted text' test 2>/dev/null test sed &&
+	/usr/bin done | echo /usr/bin 2>/dev/null echo echo -eu local 'quoted text'
+	echo printf && && 2>/dev/null "$@" --verbose
+	sed | -eu then | grep 'quoted text' && ${HOME} export && awk ${HOME} "$@" local
+		2>/dev/null 2>/dev/null grep cd | 'quoted text' test $(pwd) ${HOME} cd 2>/dev/null
+		export | echo x=1 'quoted text'
+--verbose export --verbose
+	readonly $(pwd) "$1" local readonly | test cd --verbose $(pwd)
+| awk grep && "$1" $(pwd) cd | "$1" local sed
+		${HOME} readonly then --verbose cd "$1" readonly
+		--verbose done "$1" | x=1 grep && && test x=1 then
+		${HOME} "$@" local "$@" local | cd "$1" local local local
+done && /usr/bin | done done x=1 2>/dev/null
+		cd done printf --verbose grep grep && sed $(pwd)
+		"$1" -eu test grep sed && test
+		awk 2>/dev/null && && cd readonly done sed x=1 printf
+sed --verbose test "$1" /usr/bin | test
+	echo -eu x=1 done | "$@" x=1 export "$1" x=1 "$1" --verbose 'quoted text'
+"$1" $(pwd) cd test awk then /usr/bin -eu local
+	&& grep ${HOME} ${HOME} "$@" readonly done $(pwd)
+	echo sed -eu echo done sed cd done ${HOME} 2>/dev/null cd x=1 echo | sed x=1
+	awk test /usr/bin --verbose readonly | x=1
+	| done sed && grep "$1" local awk printf local ${HOME} 'quoted text' |
+done /usr/bin awk sed local $(pwd) --verbose "$@" cd local x=1 cd -eu "$@"
+2>/dev/null then export local x=1 "$@" && awk
+		--verbose /usr/bin ${HOME} export
+	"$1" && echo --verbose | -eu 'quoted text'
+then x=1 /usr/bin x=1 && test done $(pwd) then
+"$1" /usr/bin local -eu "$@" then readonly awk printf 2>/dev/null 'quoted text'
+		export /usr/bin then done then test -eu 2>/dev/null | /usr/bin local printf export
+/usr/bin 2>/dev/null -eu awk sed -eu --verbose sed $(pwd) ${HOME} ${HOME} 'quoted text'
+	awk x=1 "$1" done local $(pwd) readonly export x=1 sed "$@"
+	cd $(pwd) done ${HOME} && x=1 local -eu 'quoted text'
+	echo cd then sed echo done "$1"
+-eu "$@" done export && --verbose ${HOME} readonly && 2>/dev/null x=1 test
+	-eu grep awk -eu && then sed "$1" local | readonly 'quoted text' echo && ${HOME}
+	cd /usr/bin sed then printf awk sed then | local
+	"$1" x=1 --verbose cd | cd $(pwd) grep done printf then cd local 2>/dev/null grep
+	echo done && then -eu $(pwd) echo /usr/bin 'quoted text' ${HOME}
+		echo 'quoted text' local readonly then
+		echo -eu echo --verbose
+	grep then echo && -eu awk awk echo
+	sed grep --verbose "$1" readonly
+		awk 2>/dev/null $(pwd) -eu /usr/bin
+		$(pwd) grep && readonly $(pwd) /usr/bin sed test --verbose /usr/bin && 2>/dev/null
+		printf cd -eu sed && 2>/dev/null done then && cd
+		awk readonly && x=1 awk then sed then readonly --verbose -eu done local
+	awk local printf then done done
+	${HOME} ${HOME} "$@" | cd 2>/dev/null 2>/dev/null echo "$1" $(pwd) "$1"
+		$(pwd) printf then done readonly awk "$@" x=1 echo
+	"$@" 'quoted text' "$@" 2>/dev/null sed 2>/dev/null readonly
+'quoted text' $(pwd) echo
+	| 2>/dev/null printf test 'quoted text' | local done local
+	x=1 --verbose sed readonly test $(pwd) grep
+	${HOME} cd readonly test
+		-eu echo test | awk $(pwd) readonly readonly -eu && ${HOME}
+	awk printf ${HOME} test "$1" x=1 done local ${HOME} done -eu x=1
+	${HOME} export grep grep test "$@" 2>/dev/null
+${HOME} echo grep | "$1" readonly local sed $(pwd) --verbose &&
+	2>/dev/null "$@" cd $(pwd) done "$@" --verbose
+	'quoted text' cd done awk local "$1" -eu echo grep
+		| "$1" awk && 'quoted text'
+		${HOME} --verbose ${HOME} "$@" 'quoted text' 2>/dev/null
+printf cd cd 2>/dev/null 'quoted text' local done 2>/dev/null | /usr/bin awk readonly
+	&& then printf | ${HOME} "$@" printf awk test export --verbose 'quoted text'
+"$1" ${HOME} then echo echo $(pwd) printf 2>/dev/null printf && printf
+	echo echo && grep test /usr/bin "$1" grep --verbose
+		export "$1" /usr/bin echo /usr/bin 'quoted text' 'quoted text'
+${HOME} --verbose ${HOME} "$@"
+printf then /usr/bin cd --verbose -eu local && 'quoted text' cd "$1"
+		awk && 'quoted text' $(pwd) cd sed echo test
+		'quoted text' 'quoted text' readonly
+	done readonly ${HOME} export sed "$@" grep 2>/dev/null x=1 ${HOME}
+/usr/bin printf --verbose /usr/bin printf cd
+	printf -eu cd ${HOME} x=1 && "$1" cd "$1" 2>/dev/null -eu sed
+then --verbose then |
+		$(pwd) && sed && export local -eu awk "$1" --verbose awk export 'quoted text'
+	grep export && cd --verbose -eu ${HOME}
+		&& ${HOME} && /usr/bin "$@" 2>/dev/null 2>/dev/null
+		| | $(pwd) grep --verbose $(pwd) local "$@" test test -eu cd echo --verbose
+		'quoted text' | && x=1 done sed local echo && sed ${HOME} cd $(pwd) readonly
+		echo then awk "$@" ${HOME} $(pwd) printf ${HOME} && "$1" grep test
+		2>/dev/null test sed "$1" cd x=1
+$(pwd) 'quoted text' test sed printf "$@" |
+		'quoted text' /usr/bin 2>/dev/null
+		--verbose && readonly printf "$1" x=1 readonly export --verbose grep
+		grep -eu done printf cd readonly /usr/bin 2>/dev/null
+x=1 printf local printf "$@" ${HOME} done done ${HOME} printf sed test grep
+	printf awk "$1" cd && test
+x=1 --verbose "$1" -eu printf grep then x=1 | sed && --verbose
+local "$1" x=1 done ${HOME} awk awk readonly echo x=1 | then cd /usr/bin &&
+		/usr/bin printf 'quoted text'
+	"$1" then local then grep && -eu $(pwd) printf "$@" --verbose
+		2>/dev/null -eu done test $(pwd) -eu then readonly x=1 "$@" grep sed $(pwd)
+	/usr/bin 'quoted text' echo local -eu then echo &&
+	x=1 -eu grep sed "$@" then 2>/dev/null 2>/dev/null "$@"
+	sed /usr/bin printf 'quoted text'
+		/usr/bin export -eu done "$1" grep && export /usr/bin
+-eu local "$1" local cd | ${HOME} -eu test && export 2>/dev/null sed --verbose 'quoted text'
+		&& --verbose grep "$1" -eu x=1 && -eu 2>/dev/null awk cd | awk 'quoted text' echo
+test awk done "$1" awk
+"$1" readonly /usr/bin /usr/bin "$1"
+printf /usr/bin awk ${HOME} then | export export
+	then awk then awk -eu x=1 'quoted text' readonly test echo
+echo "$@" -eu x=1 ${HOME}
+printf cd /usr/bin && /usr/bin awk | export sed
+		export /usr/bin done "$@" $(pwd) local
+echo && local printf cd ${HOME} 'quoted text'
+	"$1" 'quoted text' export test printf local
+		--verbose -eu 2>/dev/null --verbose | awk printf
+test export done awk export -eu export
+readonly 2>/dev/null ${HOME} --verbose 'quoted text' export readonly
+--verbose && "$1" awk awk /usr/bin
+		&& printf readonly grep printf && printf sed echo printf "$@" "$1" grep /usr/bin
+		test -eu readonly 'quoted text' /usr/bin /usr/bin then cd 'quoted text'
+'quoted text' --verbose -eu grep local "$@" grep -eu | local awk
+"$@" 2>/dev/null --verbose readonly then && | printf "$@" export --verbose
+local 'quoted text' && ${HOME}
+		--verbose && 'quoted text'
+x=1 /usr/bin test readonly 2>/dev/null
+		cd && printf /usr/bin awk && "$@" echo $(pwd) sed x=1 "$1" 2>/dev/null sed
+test readonly "$1" readonly
+${HOME} 'quoted text'
+${HOME} ${HOME} 'quoted text' 'quoted text' $(pwd) printf
+	$(pwd) readonly ${HOME} | cd then $(pwd) local local local "$1"
+then --verbose awk -eu 'quoted text' local -eu export test
+		| x=1 | sed ${HOME} "$1" --verbose --verbose export
+	"$1" then echo $(pwd) $(pwd) cd printf echo "$@" readonly 'quoted text'
+		/usr/bin done ${HOME} -eu printf $(pwd) --verbose --verbose
+	cd "$@" test --verbose 'quoted text' && /usr/bin echo then /usr/bin then -eu
+awk export 'quoted text' 2>/dev/null 2>/dev/null $(pwd) grep done | --verbose
+echo test "$1" /usr/bin $(pwd)
+awk $(pwd) x=1 printf readonly done echo export $(pwd) -eu awk 'quoted text' --verbose
+		readonly export $(pwd) 'quoted text' local
+grep -eu 'quoted text' && | 'quoted text' export awk local test grep /usr/bin
+then echo 'quoted text'
+	echo cd /usr/bin /usr/bin export awk "$@"
+	local /usr/bin ${HOME} printf "$@" done awk readonly 'quoted text'
+sed cd grep /usr/bin 'quoted text'
+${HOME} $(pwd) printf /usr/bin 'quoted text'
+sed -eu ${HOME} done grep "$1" x=1 sed ${HOME}
+x=1 awk "$@" ${HOME} echo
+2>/dev/null sed test $(pwd) local grep grep "$@" /usr/bin
+	local test readonly done echo readonly 2>/dev/null
+	grep sed local test test readonly --verbose test -eu grep
+local $(pwd) echo sed -eu then 2>/dev/null grep then --verbose
+	sed printf local echo done
+	&& -eu awk printf /usr/bin printf 2>/dev/null
+export ${HOME} local cd 'quoted text'
+		x=1 -eu "$@" | | /usr/bin /usr/bin
+	/usr/bin x=1 done then | then | $(pwd) /usr/bin -eu "$@" x=1
+	| grep awk awk readonly | awk awk -eu done ${HOME} /usr/bin printf export
+-eu 'quoted text' -eu cd sed readonly "$@" /usr/bin cd
+$(pwd) cd test echo awk ${HOME} test awk
+	awk then /usr/bin 2>/dev/null "$@" test 'quoted text' | then cd --verbose
+${HOME} x=1 'quoted text' printf 'quoted text'
+awk ${HOME} sed 'quoted text' /usr/bin export "$@" -eu --verbose
+		-eu x=1 test | then && /usr/bin 2>/dev/null local cd echo "$1" awk awk sed readonly
+		"$1" done then -eu local cd x=1 2>/dev/null
+	done cd $(pwd) printf x=1 printf
+		awk && "$@" done awk && cd export x=1 grep then 'quoted text'
+printf $(pwd) x=1 ${HOME} awk export --verbose awk cd ${HOME} printf
+	then && -eu done "$1" printf "$1" 2>/dev/null
+	then x=1 | -eu printf "$1"
+		'quoted text' "$1" echo readonly --verbose
+"$1" printf cd printf done then
+		"$1" grep test | local 'quoted text' printf printf | printf printf sed echo --verbose
+		/usr/bin test then done then 2>/dev/null
+	&& 'quoted text' 'quoted text' then local
+done grep 2>/dev/null export
+		&& 2>/dev/null local test sed --verbose export "$1" -eu local then "$@" export
+"$1" readonly done "$@" grep local sed 2>/dev/null
+-eu | sed | x=1 && && ${HOME} && "$1" -eu printf printf local | 'quoted text'
+		printf $(pwd) $(pwd) 'quoted text'
+		grep --verbose readonly $(pwd) cd test && && printf "$@" done done
+sed echo --verbose 2>/dev/null 2>/dev/null awk export cd x=1 test
+	grep 2>/dev/null x=1 local readonly x=1 | | sed
+test export then "$1" awk grep ${HOME} local grep && test $(pwd) then
+		grep && echo ${HOME} ${HOME} grep && $(pwd) grep -eu cd 2>/dev/null ${HOME}
+		cd "$@" ${HOME} "$1" "$1" grep "$1"
+	2>/dev/null local $(pwd) local -eu /usr/bin ${HOME} 'quoted text' 'quoted text'
+&& --verbose 'quoted text' awk grep 'quoted text'
+	readonly 2>/dev/null | printf /usr/bin
+	then -eu x=1 echo "$@" "$@" x=1 sed 'quoted text' 2>/dev/null "$@" "$@" --verbose
+&& "$@" $(pwd) --verbose cd && export --verbose ${HOME}
+	x=1 awk x=1 -eu /usr/bin "$1" done $(pwd) /usr/bin test && then
+| done cd sed -eu readonly grep
+	printf ${HOME} x=1 -eu && echo awk sed "$1" echo 'quoted text' && echo
+	'quoted text' $(pwd) export printf "$1" 'quoted text' --verbose
+		/usr/bin x=1 export done x=1 grep "$@" && echo
+--verbose then "$1" sed sed grep grep 'quoted text' grep
+		export ${HOME} grep done local test --verbose test
+		"$@" grep | -eu $(pwd) 'quoted text' grep -eu grep
+		--verbose done readonly awk 'quoted text'
+		${HOME} "$1" cd grep awk sed ${HOME} | "$@" done | -eu echo | awk
+	awk then awk then "$1" && $(pwd) done x=1 ${HOME} "$@" 2>/dev/null grep /usr/bin
+		'quoted text' grep && $(pwd) ${HOME} then "$@" "$@" local "$@" --verbose
+		'quoted text' test export
+done sed --verbose ${HOME} local 'quoted text'
+		--verbose awk 2>/dev/null awk grep && $(pwd) /usr/bin
+		$(pwd) "$@" 'quoted text'
+	sed done then local cd "$@" local -eu $(pwd)
+	then printf awk x=1 'quoted text'
+		"$1" test printf test ${HOME} readonly
+--verbose echo -eu x=1 readonly -eu
+		-eu "$1" ${HOME} readonly awk ${HOME} 'quoted text' $(pwd) export echo sed
+x=1 | "$@" test echo grep grep
+	test readonly x=1 echo done x=1 done printf awk
+		${HOME} then ${HOME} echo "$1"
+readonly grep readonly --verbose --verbose test "$1" then --verbose
+export ${HOME} grep readonly 'quoted text' --verbose /usr/bin printf /usr/bin
+printf "$1" 'quoted text' &&
+echo ${HOME} -eu $(pwd) 2>/dev/null sed --verbose then
+cd test printf | grep 'quoted text' export test --verbose then cd -eu --verbose
+		"$1" printf awk then 'quoted text' sed "$1" awk "$1" local sed
+		local $(pwd) echo -eu printf -eu then grep echo "$@" printf awk -eu then awk
+-eu export | "$1" local -eu | -eu echo export "$1"
+		done 2>/dev/null -eu export --verbose | x=1 && -eu
+	done --verbose printf x=1 -eu then /usr/bin
+		/usr/bin test /usr/bin echo "$@" readonly "$@" "$@" "$@" test | printf -eu |
+	"$@" ${HOME} 'quoted text' x=1 | "$@" /usr/bin 2>/dev/null cd readonly && local
+	done cd done printf /usr/bin 'quoted text' then grep ${HOME} "$@" export awk
+		local export $(pwd) x=1 cd --verbose -eu /usr/bin awk /usr/bin
+		printf awk printf grep sed export "$@" "$@" /usr/bin ${HOME} export && local
+		readonly export $(pwd) ${HOME} printf grep "$@" local 2>/dev/null
+		'quoted text' /usr/bin 'quoted text'
+readonly "$@" $(pwd) $(pwd) ${HOME} then ${HOME} printf
+	"$@" echo export /usr/bin cd grep --verbose
+	cd ${HOME} ${HOME} "$1" printf cd && x=1 readonly
+printf | grep readonly 'quoted text' test ${HOME} && -eu echo local $(pwd)
+	| done sed "$1" done awk local &&
+then then 2>/dev/null awk then done /usr/bin printf -eu
+readonly | /usr/bin grep grep | cd /usr/bin printf echo awk x=1 grep &&
+	test then export done printf 'quoted text' ${HOME}
+	x=1 | done echo grep sed export ${HOME}
+		2>/dev/null $(pwd) && $(pwd) sed echo readonly done
+		/usr/bin | grep | 2>/dev/null && grep /usr/bin printf "$@" echo readonly --verbose
+	sed awk sed echo then readonly /usr/bin
+		cd $(pwd) echo grep | echo awk "$1" local "$1" "$@" ${HOME} 2>/dev/null
+	done awk "$@" /usr/bin then
+		${HOME} awk 2>/dev/null awk ${HOME} x=1 done sed "$@" done done awk "$1"
+		x=1 export echo cd && && | -eu sed
+	then then 'quoted text' export ${HOME} | test sed ${HOME} && 2>/dev/null
+		done grep && 'quoted text'
+${HOME} sed "$@" echo x=1 "$@" /usr/bin --verbose 'quoted text' | | then
+		/usr/bin done sed done
+printf $(pwd) test local x=1 then
+cd | cd readonly done echo --verbose "$1" $(pwd) 'quoted text'
+	test /usr/bin ${HOME} sed
+		2>/dev/null "$1" -eu 2>/dev/null
+		x=1 cd test "$@" local sed
+	echo --verbose "$1" 'quoted text' printf
+	then ${HOME} 2>/dev/null x=1 'quoted text' "$1" "$@" test grep
+--verbose -eu done | | -eu && --verbose
+	test $(pwd) x=1 "$1" $(pwd) 'quoted text'
+echo echo --verbose then printf printf ${HOME} echo "$1" local done
+printf then 2>/dev/null $(pwd) "$@" -eu /usr/bin
+	awk "$1" $(pwd) done ${HOME} && "$1" sed 2>/dev/null printf
+		cd 'quoted text' 'quoted text'
+		readonly awk /usr/bin test readonly
+/usr/bin | /usr/bin ${HOME}
+	'quoted text' test 2>/dev/null test ${HOME} cd then | ${HOME}
+		local $(pwd) $(pwd) echo 2>/dev/null
+	"$@" x=1 | printf sed export && sed test grep 'quoted text' then | "$1"
+--verbose echo awk local x=1 x=1
+	local grep printf sed echo then export ${HOME} && done 'quoted text'
+	"$@" && --verbose then
+		${HOME} grep $(pwd) printf cd /usr/bin ${HOME} --verbose readonly then
+test readonly --verbose echo x=1 --verbose $(pwd)
+		/usr/bin | cd local export 'quoted text' echo local $(pwd) x=1 echo local | "$@"
+		printf echo cd local "$1" awk 'quoted text' export "$1" ${HOME} echo
+	$(pwd) sed --verbose $(pwd) export grep sed $(pwd) grep ${HOME}
+	test sed && export "$@" echo printf /usr/bin cd 'quoted text' x=1 echo done x=1
+	x=1 && -eu local sed test then readonly 2>/dev/null -eu printf
+readonly ${HOME} echo /usr/bin
+local ${HOME} awk grep x=1 cd x=1 | 2>/dev/null x=1 ${HOME} cd -eu
+	-eu local then && awk /usr/bin ${HOME} done sed grep ${HOME} test 2>/dev/null test
+done local echo -eu done printf "$1" echo export "$1" echo --verbose
+printf 2>/dev/null /usr/bin | grep --verbose
+		sed 'quoted text' -eu grep printf 2>/dev/null readonly $(pwd)
+awk export "$@" done | && 'quoted text'
+--verbose grep grep echo readonly 2>/dev/null then "$@" grep
+done printf "$1" "$@" && "$@" ${HOME} "$@" then "$1" sed printf
+		done && test readonly readonly x=1 done --verbose
+"$@" --verbose echo readonly && readonly
+	-eu echo "$@" grep && test grep grep | cd test local then awk
+		x=1 done x=1 "$@" && readonly local
+	done test ${HOME} printf test -eu --verbose "$1"
+		${HOME} | && grep $(pwd) then && -eu sed sed | export | $(pwd) 2>/dev/null &&
+	then x=1 done then sed /usr/bin 2>/dev/null ${HOME} printf "$@" awk
+	test echo echo test echo "$@" 'quoted text' -eu
+	grep ${HOME} sed done ${HOME} ${HOME} 'quoted text' && export done -eu
+	cd test $(pwd) test 2>/dev/null local
+	2>/dev/null sed export export grep && printf readonly -eu "$@" cd sed sed /usr/bin
+		"$1" 2>/dev/null export test x=1 then
+| cd --verbose local --verbose x=1 done export x=1 ${HOME} x=1 awk $(pwd)
+local done "$@" "$@" "$@" readonly
+		done awk "$1" export echo grep --verbose sed sed --verbose
+	sed x=1 cd "$@" --verbose cd $(pwd) awk local "$1"
+		done then 2>/dev/null 2>/dev/null -eu 'quoted text' $(pwd) printf awk then
+--verbose test sed then
+	2>/dev/null readonly awk export
+	-eu cd cd echo done printf 2>/dev/null test export /usr/bin sed "$@" awk $(pwd)
+		2>/dev/null test ${HOME} "$@" x=1 awk && -eu 'quoted text' 2>/dev/null
+	'quoted text' awk echo export && | test
+"$1" "$1" x=1 awk /usr/bin -eu 'quoted text' "$@" 'quoted text' "$1" awk 'quoted text'
+		readonly done 2>/dev/null "$@" sed
+	awk 2>/dev/null done /usr/bin local ${HOME} test echo ${HOME}
+${HOME} | echo /usr/bin x=1 | && /usr/bin sed local "$1" readonly 2>/dev/null
+	'quoted text' awk local "$@"
+test test "$1" awk && done local -eu printf --verbose awk --verbose
+	2>/dev/null sed "$1" grep 'quoted text'
+		--verbose printf $(pwd) | echo "$1" then 'quoted text'
+&& cd sed | $(pwd) "$@" | "$@" then | x=1 x=1 'quoted text' ${HOME} sed awk awk
+	done "$@" cd "$@" /usr/bin
+'quoted text' && && readonly 'quoted text' "$1" 'quoted text'
+		awk test | "$1" echo /usr/bin x=1 | readonly --verbose
+		x=1 test echo sed /usr/bin readonly ${HOME}
+readonly sed echo "$@" echo $(pwd) printf sed grep awk printf x=1 | /usr/bin $(pwd)
+/usr/bin echo test test -eu cd cd $(pwd) $(pwd) cd x=1 /usr/bin /usr/bin -eu
+$(pwd) "$@" "$1" /usr/bin sed 'quoted text' ${HOME} export
+		--verbose -eu then printf done
+${HOME} grep 'quoted text' echo -eu echo "$@" cd local
+	then $(pwd) && ${HOME} x=1 export grep $(pwd) 2>/dev/null ${HOME} grep
+export --verbose x=1 2>/dev/null 2>/dev/null
+		done --verbose export echo readonly 'quoted text' then $(pwd)
+	test grep -eu cd printf $(pwd) export --verbose readonly x=1 x=1
+--verbose --verbose x=1 export && && grep 'quoted text' "$1" | && awk
+		x=1 grep /usr/bin --verbose && 'quoted text' x=1 echo | "$1" "$1" local | && 'quoted text'
+	cd printf ${HOME} x=1 --verbose
+		export --verbose cd x=1 readonly "$@" cd x=1 "$@" awk grep done
+grep 'quoted text' /usr/bin "$1" printf /usr/bin done awk echo cd local
+	printf 'quoted text' /usr/bin
+		$(pwd) $(pwd) local -eu export done "$1"
+		done cd -eu then $(pwd) echo "$1" 'quoted text' awk x=1 awk awk -eu --verbose
+then --verbose 2>/dev/null 'quoted text'
+$(pwd) export sed awk echo "$@" awk then echo
+	'quoted text' --verbose grep
+		2>/dev/null "$1" cd x=1 awk printf echo grep /usr/bin 2>/dev/null 2>/dev/null
+| cd printf $(pwd) -eu then sed x=1 "$@" $(pwd) $(pwd)
+	2>/dev/null /usr/bin local echo 2>/dev/null /usr/bin
+		x=1 && grep /usr/bin test
+	sed -eu export 2>/dev/null ${HOME} /usr/bin cd awk --verbose ${HOME}
+		x=1 x=1 2>/dev/null done printf local --verbose 2>/dev/null
+		$(pwd) $(pwd) then 'quoted text' 'quoted text' ${HOME} done 2>/dev/null
+	"$1" awk --verbose awk done 'quoted text' 'quoted text' && "$1" $(pwd) readonly
+		test done x=1 grep 2>/dev/null ${HOME}
+		grep /usr/bin -eu sed cd 'quoted text' done "$1" then export echo
+-eu /usr/bin cd $(pwd) done then ${HOME} cd
+-eu && ${HOME} /usr/bin awk "$1" done echo done
+		"$1" -eu 2>/dev/null test 'quoted text' sed 2>/dev/null "$@" ${HOME}
+	done 'quoted text' x=1 sed echo grep export
+awk /usr/bin echo "$@" ${HOME} readonly --verbose
+	${HOME} -eu 'quoted text'
+	"$@" done "$@" grep readonly
+	/usr/bin $(pwd) printf awk | echo
+		/usr/bin grep --verbose x=1 --verbose grep export grep x=1 cd
+		| /usr/bin echo 2>/dev/null readonly && /usr/bin export "$@" /usr/bin && --verbose
+	${HOME} --verbose echo && test done echo 'quoted text' $(pwd)
+		readonly --verbose done test done then test grep grep test "$@" "$@" grep |
+2>/dev/null ${HOME} done && local test export $(pwd) grep readonly grep "$1"
+grep sed awk local export 2>/dev/null readonly export 'quoted text' "$@" "$@"
+test then sed sed cd awk readonly $(pwd)
+&& && echo test test "$@" grep
+	$(pwd) --verbose then 2>/dev/null --verbose echo | cd /usr/bin
+		awk ${HOME} grep x=1 grep ${HOME} x=1 -eu printf
+		local "$1" -eu printf export "$1" /usr/bin $(pwd) echo --verbose $(pwd) export
+readonly grep local grep | 2>/dev/null echo test test 2>/dev/null
+	cd grep 'quoted text' grep awk local --verbose 'quoted text'
+readonly /usr/bin --verbose test
+		&& && x=1 /usr/bin then then readonly &&
+	cd local x=1 grep /usr/bin -eu | cd
+		/usr/bin sed && test -eu test
+		printf export readonly && cd x=1 export $(pwd) "$@" cd
+&& /usr/bin $(pwd) echo ${HOME} readonly done
+	| 2>/dev/null "$@" "$1" echo $(pwd) && then
+	x=1 local 'quoted text' 'quoted text'
+echo 'quoted text' ${HOME} done test export then sed 'quoted text'
+	local $(pwd) readonly --verbose then 'quoted text' local
+	--verbose && /usr/bin "$@" awk 2>/dev/null --verbose
+	/usr/bin awk local x=1 export -eu ${HOME} $(pwd) sed 'quoted text' /usr/bin
+	$(pwd) -eu | && cd ${HOME} readonly
+readonly echo -eu then ${HOME} sed readonly
+	${HOME} then awk cd $(pwd) printf local
+		export x=1 echo cd readonly 'quoted text' 'quoted text' -eu local -eu grep
+		cd x=1 "$@" $(pwd) cd readonly
+	$(pwd) done && done awk x=1 export awk local test /usr/bin sed
+	awk echo $(pwd) cd cd local
+		| done echo && printf 'quoted text' 2>/dev/null
+	"$1" export done test test 2>/dev/null local awk printf echo cd | "$1" /usr/bin
+	--verbose printf | echo done awk "$@" -eu x=1
+		readonly local then export local echo
+		'quoted text' test | cd readonly 'quoted text'
+	printf $(pwd) sed export -eu x=1
+		&& echo sed printf local sed 2>/dev/null then sed done sed 'quoted text' cd
+--verbose ${HOME} "$1" sed && $(pwd) echo done cd --verbose test test "$@"
+	/usr/bin "$@" && printf
+export /usr/bin printf ${HOME}
+		cd readonly x=1 && 2>/dev/null 'quoted text'
+	-eu printf done echo $(pwd) grep
+		cd test cd 2>/dev/null 2>/dev/null x=1 awk 2>/dev/null ${HOME} awk
+2>/dev/null $(pwd) then | /usr/bin --verbose readonly
+	awk export sed local local printf ${HOME} export "$@" grep && /usr/bin
+		-eu done ${HOME} 'quoted text' printf test printf sed "$@" && 2>/dev/null "$@"
+		"$@" export grep echo ${HOME} 'quoted text'
+	local printf readonly readonly -eu awk $(pwd) "$1" $(pwd) then grep then --verbose
+		echo && x=1 --verbose done cd sed then done then 2>/dev/null test
+		x=1 ${HOME} /usr/bin | sed "$@"
+	"$@" local done readonly echo done printf
+		--verbose done | cd && grep local then
+	test ${HOME} x=1 sed -eu
+		| -eu grep ${HOME} done awk sed export awk "$@"
+		echo $(pwd) /usr/bin sed then
+		cd && 2>/dev/null then local && 'quoted text' -eu "$@" -eu
+		--verbose cd x=1 /usr/bin --verbose awk $(pwd) | test awk 2>/dev/null
+	sed done --verbose readonly readonly readonly "$1" done
+		then sed export test then --verbose test grep echo echo printf awk $(pwd)
+		done --verbose sed grep grep
+		'quoted text' printf sed "$@"
+	"$1" then sed printf --verbose "$1" grep --verbose
+	-eu printf | -eu awk sed
+		2>/dev/null x=1 ${HOME} readonly cd "$1" "$1" cd &&
+	awk local done && readonly x=1 'quoted text' done readonly --verbose /usr/bin
+	| 2>/dev/null -eu printf test x=1 cd sed /usr/bin
+		awk local ${HOME} then "$1" x=1
+export cd "$@" cd /usr/bin -eu | /usr/bin then printf "$@" "$@"
+	grep cd echo ${HOME} then ${HOME} "$1" grep /usr/bin $(pwd) ${HOME}
+	cd grep export cd readonly sed 2>/dev/null
+		| grep printf ${HOME} "$1" "$1" | --verbose $(pwd) export echo
+grep ${HOME} export done
+	${HOME} grep echo -eu printf export done awk $(pwd) $(pwd)
+${HOME} export printf -eu "$1" cd ${HOME}
+| echo sed 'quoted text' printf -eu awk && "$1" grep readonly
+		/usr/bin x=1 $(pwd) "$1" -eu | local echo 'quoted text'
+		cd $(pwd) $(pwd) done "$1" --verbose
+	| | readonly "$1" then "$@"
+	test local && grep "$@" 2>/dev/null ${HOME} test done
+	export cd 2>/dev/null && grep then --verbose 2>/dev/null
+	export -eu awk printf local /usr/bin
+		awk 2>/dev/null then grep printf cd ${HOME} done local "$@" local printf
+	done then 'quoted text' $(pwd) grep test then export
+	echo && 'quoted text' "$@" done echo grep "$1" test test export done
+		| "$@" done printf test /usr/bin
+		| -eu | "$1" grep export $(pwd)
+--verbose then sed -eu local 2>/dev/null 2>/dev/null
+printf sed export "$1" --verbose
+echo export then readonly | x=1 ${HOME} ${HOME} "$@" then
+		/usr/bin -eu ${HOME} x=1 then echo | | done awk x=1
+	cd sed export echo printf --verbose "$@" | 2>/dev/null echo
+	echo -eu test -eu local ${HOME} local $(pwd) printf
+local "$1" test --verbose
+done "$@" "$1" ${HOME}
+-eu cd readonly 2>/dev/null printf sed
+	done export test local awk readonly --verbose then awk
+		awk local ${HOME} echo echo "$1" export $(pwd) done x=1 cd x=1 test ${HOME}
+/usr/bin awk --verbose $(pwd) awk -eu readonly -eu "$@" | then
+	x=1 && then sed /usr/bin cd
+/usr/bin cd $(pwd) export awk done 'quoted text' /usr/bin
+		x=1 | -eu | then $(pwd) printf ${HOME}
+	'quoted text' /usr/bin
+		grep then printf cd then
+		$(pwd) printf 2>/dev/null
+"$1" export -eu cd export cd $(pwd) awk x=1 export then $(pwd)
+	/usr/bin sed $(pwd) sed | done $(pwd) /usr/bin "$1"
+		sed readonly ${HOME} --verbose grep $(pwd) printf $(pwd) awk test /usr/bin readonly
+-eu export echo test printf $(pwd) 'quoted text' 'quoted text'
+	done ${HOME} readonly -eu /usr/bin 2>/dev/null ${HOME} "$@" x=1 ${HOME}
+	printf cd "$1" then 'quoted text' awk sed && 2>/dev/null
+	'quoted text' "$@" local /usr/bin 2>/dev/null x=1 then awk
+--verbose -eu --verbose cd export
+	"$@" ${HOME} 'quoted text' ${HOME} export
+then ${HOME} export | awk 'quoted text' echo then 'quoted text'
+	local "$@" $(pwd) -eu "$1" x=1 readonly
+	then cd readonly export 'quoted text'
+'quoted text' grep awk grep awk cd x=1 cd && export awk x=1 then cd
+	x=1 local sed ${HOME} "$@" ${HOME} awk grep export ${HOME} 'quoted text'
+test echo cd && 'quoted text' test --verbose then echo test ${HOME}
+-eu cd x=1 echo --verbose sed done then 'quoted text'
+	local --verbose $(pwd) then printf local && ${HOME} "$1"
+	x=1 then cd grep 2>/dev/null done | test
+	-eu cd done awk /usr/bin 2>/dev/null export readonly echo
+$(pwd) | x=1 --verbose cd | then $(pwd) readonly test "$1" --verbose
+		-eu | grep grep && awk sed then
+"$1" ${HOME} 'quoted text' ${HOME} "$1"
+		-eu printf "$@" grep done 2>/dev/null readonly echo
+		"$1" echo "$1" --verbose 2>/dev/null -eu -eu --verbose local readonly
+		2>/dev/null then ${HOME} /usr/bin sed then local "$1" 2>/dev/null echo
+		then export x=1 sed $(pwd) cd done 2>/dev/null local echo &&
+| readonly then grep done then "$@" test 'quoted text' "$1" awk
+${HOME} sed 2>/dev/null 2>/dev/null && $(pwd) 2>/dev/null export
+	/usr/bin /usr/bin grep | 2>/dev/null grep
+		"$@" "$@" && awk cd "$1" -eu /usr/bin "$1"
+	readonly | /usr/bin /usr/bin then sed "$1" done 'quoted text' "$@"
+		--verbose x=1 local then awk /usr/bin test ${HOME} local
+		awk printf test | "$@" cd cd readonly "$@" export --verbose
+sed export sed printf --verbose done $(pwd)
+		printf local && sed awk done echo done grep
+cd 2>/dev/null 'quoted text' -eu -eu /usr/bin export echo ${HOME}
+readonly grep 'quoted text' done -eu | ${HOME} 'quoted text' && x=1
+	"$1" printf sed $(pwd) && "$1" | && export /usr/bin
+		awk "$1" 'quoted text' readonly export
+"$@" /usr/bin "$1" printf readonly printf export
+		sed 'quoted text' /usr/bin echo local readonly
+	$(pwd) export "$1" $(pwd)
+		'quoted text' local printf
+awk sed | done x=1 awk grep | -eu 'quoted text' sed "$1" awk readonly awk
+sed 'quoted text' $(pwd) 2>/dev/null test awk | test
+		printf "$1" ${HOME} "$1" sed local local echo
+		export "$@" --verbose printf sed $(pwd) done
+		sed "$1" awk | grep "$1" echo export grep grep "$@" ${HOME}
+done --verbose /usr/bin |
+		${HOME} printf x=1 readonly $(pwd)
+echo then && x=1 "$@" echo "$1" grep cd grep "$@" &&
+	grep 2>/dev/null $(pwd) x=1 x=1 readonly local x=1 /usr/bin $(pwd) echo
+		test awk | test grep local -eu --verbose awk done awk done
+	| 'quoted text' cd grep grep "$1" export
+	sed awk "$1" echo local ${HOME} sed
+	/usr/bin /usr/bin echo $(pwd) | | test /usr/bin sed done ${HOME}
+sed local readonly local /usr/bin cd "$1" then /usr/bin x=1 awk
+-eu local sed export readonly echo -eu done && "$@" ${HOME} $(pwd)
+		x=1 then echo grep 2>/dev/null
+	sed -eu --verbose grep x=1 | local $(pwd) awk done $(pwd)
+printf done echo /usr/bin
+		grep cd awk && x=1 local then sed 'quoted text' local $(pwd) /usr/bin $(pwd)
+	x=1 | done grep $(pwd) /usr/bin && x=1 "$@" echo | --verbose
+$(pwd) sed $(pwd) x=1 sed -eu "$@" 'quoted text' readonly
+	local -eu /usr/bin "$1" echo
+--verbose sed echo printf done "$1" "$1" ${HOME} --verbose then "$1" done
+	&& 'quoted text' ${HOME} x=1 sed "$1" x=1 printf $(pwd)
+then test awk x=1 "$1" --verbose "$@" 2>/dev/null $(pwd) 2>/dev/null
+		${HOME} ${HOME} awk grep | export export | sed
+	printf 2>/dev/null awk x=1 printf cd -eu | /usr/bin export done $(pwd)
+	${HOME} "$1" && /usr/bin "$@" --verbose 2>/dev/null /usr/bin "$@" printf
+--verbose x=1 local cd
+		local export 'quoted text' x=1 echo readonly
+		'quoted text' 2>/dev/null echo export "$1"
+/usr/bin readonly done test
+		grep 2>/dev/null | test
+		&& export && test readonly test awk grep readonly local --verbose |
+	printf awk cd && echo x=1 printf "$1" readonly printf local test printf ${HOME}
+		${HOME} grep -eu then --verbose
+		&& --verbose --verbose echo test ${HOME} /usr/bin && grep
+	&& echo printf "$1" export --verbose "$@" grep grep 2>/dev/null | cd | /usr/bin
+	readonly x=1 ${HOME} x=1 ${HOME} echo then echo "$@" "$@" $(pwd) 'quoted text'
+	export done 'quoted text' x=1 ${HOME} -eu /usr/bin "$@" awk 'quoted text'
+export -eu | $(pwd) then echo /usr/bin done
+	x=1 done grep 'quoted text' $(pwd) printf "$@"
+	$(pwd) -eu "$1" export "$@" done
+	${HOME} "$1" ${HOME} then local sed grep echo sed --verbose awk
+"$@" 2>/dev/null readonly grep 'quoted text' 2>/dev/null local /usr/bin /usr/bin
+"$1" /usr/bin | --verbose sed --verbose echo ${HOME} "$@" --verbose "$@"
+	sed test --verbose grep
+test "$@" sed then echo -eu | local x=1 cd $(pwd) && ${HOME} test
+grep $(pwd) test /usr/bin local ${HOME} grep local done
+printf $(pwd) "$@" 'quoted text' local done awk then echo &&
+		awk ${HOME} cd ${HOME} cd then sed 2>/dev/null test
+		grep test 'quoted text' export export local 'quoted text'
+	echo $(pwd) sed | --verbose -eu readonly
+		printf --verbose 2>/dev/null local sed sed | $(pwd) test $(pwd)
+"$1" | "$@" export printf
+		&& sed awk --verbose -eu 'quoted text' local printf -eu x=1 printf cd
+'quoted text' --verbose echo /usr/bin awk /usr/bin done
+then $(pwd) && "$@" local done 'quoted text' x=1 "$1"
+"$@" $(pwd) && $(pwd) /usr/bin test ${HOME} $(pwd) export export cd grep /usr/bin
+echo 2>/dev/null local ${HOME} printf && then $(pwd) --verbose ${HOME}
+	&& export export test "$@" sed awk -eu sed grep &&
+	done done grep cd 2>/dev/null /usr/bin | && then && grep then /usr/bin
+"$1" --verbose echo "$1" $(pwd) "$@" then -eu then export
+		done awk test export grep done -eu awk sed export /usr/bin x=1 'quoted text'
+	readonly ${HOME} local local test then cd test cd
+cd then ${HOME} grep --verbose grep then ${HOME} sed $(pwd)
+		readonly --verbose "$@" grep $(pwd) awk 2>/dev/null
+	-eu && --verbose done && test local "$@" export awk then grep cd echo $(pwd)
+	readonly "$1" | done && "$1" export ${HOME} then x=1 'quoted text'
+$(pwd) --verbose awk && -eu cd 2>/dev/null sed $(pwd) awk
+${HOME} sed | local x=1 -eu local done 'quoted text'
+x=1 awk && test readonly
+		&& grep echo | grep "$1" && /usr/bin sed readonly ${HOME} -eu sed
+"$1" "$@" ${HOME} --verbose then "$1" "$@" "$1" done printf
+		then readonly then | 2>/dev/null
+sed echo done -eu echo done
+then -eu done x=1 $(pwd) printf --verbose local
+	then awk --verbose x=1 test "$@" $(pwd) test ${HOME} done grep local --verbose
+		echo local 2>/dev/null --verbose && "$@" echo grep $(pwd) done $(pwd) | printf
+local x=1 readonly printf "$@" --verbose
+&& test export then | 'quoted text'
+/usr/bin && ${HOME} then 2>/dev/null "$@" printf ${HOME} "$1" sed awk done
+--verbose test done then /usr/bin printf test "$1" 'quoted text' cd grep then
+	'quoted text' && cd export ${HOME} $(pwd) /usr/bin test $(pwd) echo "$@" ${HOME}
+	export awk sed printf 'quoted text' 'quoted text' export readonly
+cd printf $(pwd) x=1 done --verbose "$@" 'quoted text'
+	"$1" grep test sed done 2>/dev/null sed
+	${HOME} $(pwd) -eu $(pwd) --verbose sed done |
+/usr/bin ${HOME} "$1" local /usr/bin -eu local | /usr/bin --verbose
+		echo 'quoted text' grep --verbose sed then sed x=1
+		/usr/bin sed echo $(pwd) --verbose
+printf echo | local --verbose | grep test && 2>/dev/null
+		done then local /usr/bin done echo
+		awk "$1" printf x=1 && --verbose readonly
+cd echo readonly grep printf done --verbose local --verbose
+		readonly x=1 done local | grep
+		x=1 cd x=1 printf "$1" export awk sed -eu printf echo "$1" test local
+		test x=1 grep $(pwd) "$1"
+'quoted text' readonly awk sed printf 2>/dev/null then export "$1" -eu
+	'quoted text' local "$1" 2>/dev/null local echo "$1" "$@" ${HOME}
+		cd "$1" -eu local export awk 2>/dev/null awk echo readonly -eu -eu |
+	echo --verbose 2>/dev/null grep 'quoted text'
+		-eu $(pwd) x=1 -eu ${HOME}
+		--verbose cd | --verbose && -eu grep export grep test
+		readonly 2>/dev/null && export | export 2>/dev/null grep cd 'quoted text'
+$(pwd) export cd readonly | test /usr/bin then echo /usr/bin cd awk
+		"$1" ${HOME} 'quoted text' sed && local
+&& export local then then sed ${HOME} sed sed --verbose export awk 2>/dev/null
+		| sed | grep "$@" $(pwd) export
+		--verbose "$@" test /usr/bin
+		grep $(pwd) local /usr/bin then awk
+	echo 'quoted text' echo test | test then local "$@"
+	then 'quoted text' local sed done printf x=1 2>/dev/null local
+		awk 'quoted text' | done local ${HOME} -eu 'quoted text' $(pwd)
+	| sed "$@" local awk test then awk echo
+--verbose export grep cd printf -eu
+	echo 2>/dev/null test --verbose && "$@" "$1" -eu export 'quoted text'
+| test awk readonly readonly
+		x=1 "$@" cd x=1 "$@" local --verbose 2>/dev/null readonly awk cd 2>/dev/null readonly
+then then "$@" x=1 -eu /usr/bin | grep done
+-eu $(pwd) cd "$@" --verbose done printf "$1" && done grep "$@" && "$@"
+		2>/dev/null awk grep done 2>/dev/null sed export readonly | | x=1 grep &&
+	printf awk | awk awk readonly
+		echo export printf awk "$@" 'quoted text' grep echo 'quoted text' --verbose
+	done sed awk "$1" done readonly -eu ${HOME} local readonly -eu export && /usr/bin
+		&& done "$1" printf ${HOME} "$1" awk cd printf 2>/dev/null $(pwd) $(pwd)
+		export echo -eu | | 'quoted text' | then --verbose 'quoted text' echo
+	$(pwd) echo /usr/bin sed --verbose readonly x=1 done
+	done 'quoted text' ${HOME} done && /usr/bin then cd local then -eu
+		export | ${HOME} | echo
+		"$@" /usr/bin x=1 then grep $(pwd) local -eu $(pwd) |
+	sed $(pwd) && | && --verbose cd awk sed --verbose grep | "$1" printf -eu
+		local /usr/bin test x=1 'quoted text'
+&& echo grep sed then done grep -eu $(pwd) | && | ${HOME} --verbose cd
+	${HOME} $(pwd) awk done local then -eu
+		/usr/bin test sed "$1" --verbose printf done "$1" | then readonly export 'quoted text'
+| /usr/bin "$1" | -eu "$@" grep && done x=1 then | ${HOME}
+		--verbose $(pwd) --verbose -eu cd $(pwd) --verbose echo cd x=1 'quoted text'
+cd sed printf awk cd echo ${HOME} awk
+	/usr/bin then x=1 -eu /usr/bin 'quoted text' "$@" 2>/dev/null
+		-eu then awk then $(pwd) $(pwd) local ${HOME} $(pwd) grep done readonly cd -eu
+		done ${HOME} | done --verbose
+-eu /usr/bin /usr/bin done && x=1 local | --verbose 2>/dev/null
+	grep export readonly grep | printf done -eu test
+	"$1" readonly x=1 "$@" ${HOME} awk $(pwd)
+		"$@" && -eu export printf readonly export
+		awk "$@" printf $(pwd) grep export $(pwd) /usr/bin done "$1" grep
+	${HOME} printf export printf | && && "$1" awk grep export
+	sed test sed cd "$@" && test cd ${HOME}
+/usr/bin local && grep ${HOME} test done
+		'quoted text' awk readonly then ${HOME}
+		"$@" readonly 'quoted text'
+$(pwd) export /usr/bin -eu 2>/dev/null grep -eu grep awk --verbose && --verbose
+	grep test 'quoted text' ${HOME} test test test awk awk 2>/dev/null export
+		$(pwd) cd -eu 'quoted text' printf -eu
+		x=1 x=1 sed grep sed && then && $(pwd) && test then grep --verbose
+export readonly ${HOME} readonly grep x=1 awk x=1 test grep cd | done 2>/dev/null
+		2>/dev/null "$1" "$1" --verbose
+2>/dev/null | local sed echo awk -eu | 'quoted text' $(pwd)
+		'quoted text' && done then ${HOME} done && export grep cd sed local
+		export && sed x=1 $(pwd) 2>/dev/null readonly cd $(pwd) | --verbose
+	$(pwd) "$@" ${HOME} "$1" done test ${HOME} /usr/bin 2>/dev/null
+$(pwd) local grep test x=1
+"$@" "$@" "$@" "$@" "$1" 'quoted text' && && done printf "$@" grep export $(pwd)
+		-eu printf -eu | awk cd ${HOME} then | x=1 local ${HOME} $(pwd) readonly 2>/dev/null
+	cd | then sed /usr/bin "$1"
+		test done x=1 done done printf "$1" awk done local
+	done x=1 readonly local cd $(pwd)
+| printf printf "$1" grep --verbose 'quoted text'
+printf | ${HOME} awk test "$@" local 2>/dev/null --verbose
+	sed ${HOME} grep local /usr/bin -eu
+		"$@" "$1" ${HOME} awk --verbose x=1 'quoted text' local "$1" awk
+		'quoted text' done "$@" printf cd readonly then grep
+	x=1 awk sed ${HOME} export
+		then ${HOME} export grep export
+		test 'quoted text' cd local --verbose "$1" x=1 sed
+'quoted text' -eu ${HOME} 'quoted text' | awk --verbose $(pwd) && --verbose
+		2>/dev/null ${HOME} test /usr/bin --verbose $(pwd) export
+		test echo 2>/dev/null
+sed sed --verbose local && cd local export | then -eu export
+		x=1 x=1 grep && awk then
+done done done 'quoted text'
+	local 2>/dev/null printf
+	2>/dev/null sed && export printf local export printf
+$(pwd) grep echo local readonly readonly
+x=1 x=1 2>/dev/null local "$1" echo printf 'quoted text'
+	grep && awk x=1 sed then "$@" export --verbose readonly sed 'quoted text'
+		-eu then readonly echo 'quoted text' $(pwd) sed /usr/bin
+echo export x=1 'quoted text'
+	grep "$1" "$1" && printf "$@" 'quoted text'
+	printf export awk "$@" printf --verbose awk 2>/dev/null sed done
+		local printf export grep done x=1 cd test
+export $(pwd) && $(pwd) echo -eu -eu echo && test
+		| 'quoted text' && awk sed local 'quoted text' local "$@"
+		2>/dev/null test 2>/dev/null ${HOME}
+	"$@" x=1 -eu 'quoted text' x=1 awk "$@" cd export
+	cd done /usr/bin sed /usr/bin export printf export then /usr/bin then export ${HOME}
+		2>/dev/null 2>/dev/null echo echo && -eu sed printf awk x=1 && | done --verbose
+	readonly cd 'quoted text' ${HOME} -eu --verbose grep printf then &&
+	cd "$@" /usr/bin echo then | -eu x=1 export awk done echo printf test "$1" awk
+		test awk --verbose ${HOME} sed export x=1 local -eu | /usr/bin $(pwd) export -eu
+	${HOME} $(pwd) test grep x=1 --verbose ${HOME}
+sed local then awk 'quoted text' 2>/dev/null --verbose
+		done "$@" readonly "$1" ${HOME} export export local done then -eu then
+	x=1 done echo done 'quoted text'
+"$1" x=1 export -eu x=1 x=1 then "$@"
+		export grep printf cd printf sed readonly
+then readonly 'quoted text' export echo echo && test readonly && 2>/dev/null
+	${HOME} x=1 awk $(pwd) | awk
+"$1" then done grep 2>/dev/null done 'quoted text' $(pwd) x=1 grep export cd readonly
+	"$1" $(pwd) local awk ${HOME} local "$@" --verbose x=1 /usr/bin "$@" export
+	'quoted text' then ${HOME} grep "$@" then /usr/bin --verbose "$1" test readonly
+	/usr/bin done export --verbose echo local readonly
+		awk grep done | && | echo x=1 local echo
+	x=1 ${HOME} echo ${HOME} awk local local printf printf x=1 echo awk && --verbose
+	local sed 2>/dev/null | printf
+/usr/bin echo "$@" "$1" then test $(pwd) --verbose
+		&& /usr/bin x=1 'quoted text' /usr/bin
+		local 2>/dev/null 2>/dev/null
+		awk "$@" sed 'quoted text' sed done 2>/dev/null
+readonly x=1 -eu local $(pwd) grep | test 'quoted text' && done /usr/bin
+/usr/bin printf echo readonly --verbose x=1 grep
+		printf && awk $(pwd) echo printf -eu /usr/bin 2>/dev/null
+		&& readonly test --verbose
+| --verbose x=1 'quoted text' echo awk x=1 -eu
+	test done export done 2>/dev/null echo -eu 'quoted text' test --verbose --verbose
+"$1" ${HOME} $(pwd) done echo local
+printf export $(pwd)
+		done /usr/bin /usr/bin 'quoted text' 'quoted text'
+printf && local "$1" then local
+	$(pwd) 2>/dev/null test readonly x=1 readonly
+		sed x=1 grep x=1 printf -eu local readonly
+		grep /usr/bin ${HOME} x=1 --verbose "$1" then --verbose "$1" sed export
+--verbose 'quoted text' -eu echo --verbose readonly --verbose "$@" 'quoted text'
+		x=1 grep grep then && | sed
+		"$@" then --verbose $(pwd)
+awk test test export cd local x=1 | -eu x=1 export 2>/dev/null
+grep test readonly --verbose readonly done sed | echo -eu x=1 sed x=1 &&
+	cd /usr/bin awk echo 'quoted text' echo
+x=1 echo printf /usr/bin test sed echo "$1" -eu --verbose
+	--verbose /usr/bin && readonly
+	awk cd -eu && sed $(pwd) then "$1" 'quoted text'
+| "$1" --verbose ${HOME} ${HOME}
+	x=1 cd echo $(pwd) local test && then && readonly echo "$@" grep then 2>/dev/null
+		readonly printf local -eu awk sed x=1 $(pwd) test cd 'quoted text' 'quoted text'
+grep echo 2>/dev/null printf
+		| done x=1 export /usr/bin
+x=1 awk ${HOME} grep ${HOME} $(pwd) done then awk 'quoted text' --verbose
+'quoted text' sed grep ${HOME} test /usr/bin | printf
+		local 2>/dev/null 'quoted text' 2>/dev/null done printf test ${HOME} grep "$@"
+	local --verbose export test done
+	then "$@" ${HOME} 2>/dev/null then 2>/dev/null done done $(pwd) --verbose grep
+	2>/dev/null echo 'quoted text' sed cd echo $(pwd) "$1"
+$(pwd) printf 2>/dev/null | grep && printf printf awk &&
+	sed awk && 2>/dev/null awk test ${HOME} cd --verbose readonly --verbose
+${HOME} -eu 'quoted text' "$1" printf ${HOME} |
+readonly awk cd sed echo echo ${HOME} ${HOME}
+${HOME} $(pwd) printf $(pwd) -eu readonly "$1" awk done "$@" 'quoted text' --verbose
+	${HOME} cd 'quoted text' $(pwd) done sed $(pwd) -eu then -eu "$1" test
+	echo --verbose "$@" printf --verbose cd --verbose x=1 echo export ${HOME}
+&& 2>/dev/null -eu cd local local export printf echo && "$@" sed export "$1"
+		export cd export 'quoted text' | "$1"
+	$(pwd) echo cd grep local cd "$1" $(pwd) /usr/bin
+		sed grep awk 'quoted text' ${HOME} export done readonly cd cd
+${HOME} done 2>/dev/null test
+	"$@" $(pwd) 'quoted text' 2>/dev/null
+	awk ${HOME} local sed then 2>/dev/null -eu
+awk readonly 'quoted text' $(pwd) test then
+	2>/dev/null then sed then local sed ${HOME}
+local 2>/dev/null | then awk printf
+	${HOME} awk /usr/bin 'quoted text'
+--verbose "$1" readonly 'quoted text' --verbose local cd ${HOME} | sed
+	&& done "$1" x=1 grep | "$@" echo /usr/bin test sed $(pwd) cd
+	--verbose test done then x=1 echo grep
+&& cd grep "$@" sed 'quoted text' -eu && --verbose
+/usr/bin export local "$1" echo readonly test 2>/dev/null
+	$(pwd) --verbose -eu /usr/bin grep -eu grep echo /usr/bin cd | grep x=1 readonly
+		${HOME} printf grep 2>/dev/null readonly test sed awk -eu "$@" | 'quoted text'
+		printf done --verbose then echo 2>/dev/null
+	"$@" 'quoted text' grep awk x=1 && readonly grep x=1
+	test export awk -eu && && 2>/dev/null
+		sed awk x=1 sed -eu done cd awk 'quoted text'
+	test then printf x=1 then /usr/bin
+		-eu awk sed sed 2>/dev/null awk -eu | "$@"
+		"$1" local $(pwd) readonly $(pwd) readonly
+grep --verbose -eu | 'quoted text' $(pwd) cd
+sed "$@" echo && done x=1 $(pwd) ${HOME} sed test cd | local done local
+	readonly "$1" done grep -eu awk cd 2>/dev/null readonly | local -eu export local
+	--verbose ${HOME} export x=1 2>/dev/null 'quoted text' --verbose
+		sed 2>/dev/null test awk grep
+/usr/bin && -eu ${HOME} echo test echo sed readonly
+		"$@" | 2>/dev/null $(pwd) export | --verbose
+	x=1 /usr/bin printf x=1 export /usr/bin
+	export 2>/dev/null ${HOME} done test /usr/bin 'quoted text' 2>/dev/null
+test && done x=1 export local local
+		sed readonly test awk done
+		"$@" ${HOME} export && readonly printf local "$@" "$1" sed
+	&& export "$@" $(pwd) grep
+	echo printf test "$1" test --verbose /usr/bin
+'quoted text' "$1" sed ${HOME} ${HOME}
+		export done cd "$@" cd awk local export
+	2>/dev/null "$1" ${HOME} printf "$@" printf
+test 2>/dev/null grep --verbose
+		cd export $(pwd) readonly export local sed "$@" "$1" echo printf
+	grep echo grep --verbose 2>/dev/null ${HOME} "$1" echo done test export
+	/usr/bin --verbose echo grep | readonly readonly cd awk test local echo
+	-eu | --verbose local "$@" "$1"
+		-eu /usr/bin && grep then printf then /usr/bin export echo -eu then ${HOME} "$@"
+		grep cd --verbose ${HOME} 2>/dev/null awk done
+		-eu /usr/bin 2>/dev/null test sed "$1" "$1" echo | $(pwd) export readonly sed
+&& | echo && -eu cd --verbose then export
+		-eu test cd cd && echo readonly export test grep | $(pwd) local
+-eu "$@" readonly $(pwd) export test && local
+		2>/dev/null export awk 2>/dev/null $(pwd) sed "$1"
+	sed --verbose awk printf local test "$@" printf ${HOME} printf
+	${HOME} sed $(pwd) $(pwd) "$1" 'quoted text' x=1
+local grep local grep cd "$@" then
+		$(pwd) "$1" awk -eu sed | echo then printf sed && x=1 ${HOME} "$@" readonly echo
+		"$1" $(pwd) then $(pwd) done done export
+		--verbose readonly /usr/bin sed sed
+-eu echo -eu "$1" readonly then -eu echo 'quoted text'
+cd awk export echo -eu "$1" printf "$@" grep $(pwd)
+awk --verbose 'quoted text' | cd "$@"
+		grep -eu | /usr/bin printf awk 'quoted text' "$1" echo sed |
+cd 2>/dev/null --verbose awk
+		local test | grep --verbose "$1" "$@" readonly test echo 'quoted text'
+	"$@" export -eu then printf awk test awk && export
+	readonly /usr/bin grep ${HOME} local "$1" && ${HOME} "$1" |
+		${HOME} sed export ${HOME} sed printf sed "$@" cd /usr/bin $(pwd)
+		test "$@" test grep cd grep printf printf | sed grep && | then readonly
+	cd $(pwd) awk 'quoted text' local
+	x=1 -eu "$@" --verbose "$1" ${HOME} -eu test |
+		test local 'quoted text' | /usr/bin ${HOME} readonly awk cd /usr/bin $(pwd)
+		done awk test 2>/dev/null export
+		| printf && local ${HOME} ${HOME} printf && "$1" | && printf echo "$1" ${HOME}
+		cd printf cd "$1" sed
+	printf export grep readonly && echo readonly | grep "$@" local 2>/dev/null grep
+	cd $(pwd) then && test readonly --verbose --verbose printf
+		&& then "$1" -eu readonly --verbose "$@"
+	${HOME} --verbose /usr/bin /usr/bin 2>/dev/null
+"$1" then grep --verbose
+&& | local export -eu "$1"
+	"$@" test grep test --verbose "$1"
+	export printf "$@" $(pwd) sed
+	readonly x=1 cd "$1" test sed export
+	printf "$@" test local readonly echo ${HOME} 2>/dev/null "$1" -eu local
+	readonly 2>/dev/null awk export 'quoted text' "$@" 2>/dev/null export &&
+	| --verbose && awk then && test grep x=1 ${HOME} $(pwd)
+		2>/dev/null -eu $(pwd) 2>/dev/null |
+		test --verbose x=1 "$1" then "$1"
+		local then -eu --verbose 'quoted text' then -eu cd echo then cd ${HOME} ${HOME}
+	grep "$@" && x=1 sed -eu sed
+awk test && cd -eu local cd x=1 awk test | -eu echo awk awk cd local
+	"$@" export "$1" done
+	-eu "$1" x=1 | 'quoted text' "$1" x=1 "$@" test sed 'quoted text' && echo awk
+		printf cd cd /usr/bin $(pwd) "$1" awk then -eu printf local test done
+		$(pwd) $(pwd) "$1" -eu $(pwd) then x=1 grep done "$1"
+	local awk local --verbose test /usr/bin "$1" test done
+	test awk then cd test local test
+cd --verbose ${HOME} /usr/bin cd | printf cd sed
+		echo cd test --verbose test export | "$@"
+		sed echo 'quoted text' readonly test 'quoted text'
+		--verbose local -eu test /usr/bin $(pwd) && printf printf x=1
+	"$1" grep readonly local -eu /usr/bin done readonly printf echo
+"$@" ${HOME} grep done "$@"
+		x=1 ${HOME} --verbose x=1 /usr/bin cd local test | echo grep $(pwd) x=1 'quoted text'
+		test ${HOME} 2>/dev/null
+cd done && 'quoted text' --verbose -eu 'quoted text'
+		"$1" && $(pwd) readonly test --verbose grep
+	test then --verbose "$@" 'quoted text' && | --verbose
+		"$1" test sed /usr/bin printf sed grep ${HOME} local
+	test grep local awk | "$1" export 'quoted text' cd "$1" && /usr/bin
+"$@" readonly sed grep -eu "$1" 'quoted text'
+	readonly "$1" | done awk export echo && 2>/dev/null
+		then echo then $(pwd) $(pwd)
+	cd done ${HOME} $(pwd) && $(pwd) local cd test
+		--verbose --verbose export 'quoted text' export --verbose sed test
+	then | 2>/dev/null /usr/bin
+"$1" -eu ${HOME} cd "$@" ${HOME} awk cd then test 2>/dev/null | awk test
+x=1 "$@" done /usr/bin $(pwd) export sed done awk 'quoted text'
+		done test -eu /usr/bin | grep grep grep && --verbose /usr/bin x=1 readonly
+	| export "$@" readonly | x=1 echo
+	export | grep readonly "$1"
+$(pwd) grep "$@" | echo "$@" sed grep | ${HOME} awk local
+		awk x=1 export sed test /usr/bin test cd test x=1 sed
+	done && 'quoted text' grep readonly
+awk grep && -eu done /usr/bin && export cd then echo
+sed && x=1 | -eu then ${HOME}
+echo | local grep test awk "$1" sed && awk
+$(pwd) 'quoted text' $(pwd) printf "$@" -eu sed echo grep awk $(pwd) "$@"
+${HOME} readonly awk --verbose
+		awk | cd $(pwd) "$1" sed --verbose ${HOME} && x=1 printf
+local test --verbose $(pwd) "$@" /usr/bin ${HOME} export
+	$(pwd) then $(pwd) grep printf --verbose -eu && -eu done /usr/bin
+	'quoted text' /usr/bin then export -eu readonly ${HOME}
+	${HOME} "$@" awk 'quoted text' awk "$@" then awk x=1 -eu test echo
+	readonly x=1 "$1" local $(pwd) local ${HOME}
+awk /usr/bin 2>/dev/null done echo export
+	x=1 cd "$1" && sed --verbose then ${HOME} "$@" done x=1
+	-eu readonly && then readonly "$@"
+"$@" $(pwd) | done x=1 | export && /usr/bin ${HOME} x=1 /usr/bin |
+-eu 'quoted text' local -eu
+-eu 'quoted text' printf
+	readonly "$1" "$1" "$1" && && grep
+	then "$1" done "$@" local
+test x=1 'quoted text' --verbose export ${HOME}
+		then sed done -eu grep awk $(pwd) readonly /usr/bin 'quoted text'
+		done && /usr/bin printf | then sed export x=1 'quoted text'
+		"$1" && "$1" /usr/bin x=1 cd local x=1 export
+		-eu echo test then && sed "$1" local x=1 grep ${HOME} && | grep cd &&
+	sed test test grep then | then 'quoted text'
+		local "$@" $(pwd) awk && $(pwd) export then && 2>/dev/null ${HOME} ${HOME}
+#include c181.sh
+	| export "$1" -eu done awk readonly $(pwd) x=1 --verbose 'quoted text'
+		done $(pwd) ${HOME} $(pwd) grep local cd && ${HOME} then | sed --verbose local
+		$(pwd) --verbose x=1 'quoted text'
+grep export 'quoted text' | local readonly | 2>/dev/null readonly
+	2>/dev/null local ${HOME} -eu /usr/bin /usr/bin
+		awk local "$@" readonly cd echo echo sed 2>/dev/null local
+		printf "$@" 'quoted text' ${HOME} test readonly "$@"
+		echo | grep /usr/bin x=1 echo done 'quoted text' 'quoted text' x=1
+		$(pwd) /usr/bin "$@" readonly
+local echo "$1" $(pwd) -eu echo grep && export cd done -eu
+/usr/bin && cd done then echo "$@" --verbose done grep cd export test test local
+	x=1 -eu 2>/dev/null "$@"
+-eu echo x=1 sed printf export | && sed echo 2>/dev/null
+	2>/dev/null -eu $(pwd) readonly echo test &&
+/usr/bin x=1 printf done --verbose $(pwd) ${HOME} ${HOME} "$@" awk
+"$@" && awk | then grep awk printf | readonly $(pwd) 2>/dev/null -eu && awk
+		test test sed | cd sed $(pwd) local
+$(pwd) cd $(pwd) "$@" cd sed export $(pwd) ${HOME} 'quoted text' sed "$@" sed
+-eu export echo done /usr/bin done grep /usr/bin local
+		"$@" sed "$@" awk $(pwd) | --verbose x=1 /usr/bin
+	| export $(pwd) 'quoted text' sed | x=1 grep export readonly grep grep sed sed
+| x=1 && printf grep | then "$@" | echo then then
+"$1" grep ${HOME} "$1" printf
+	| local grep "$@" x=1 then printf $(pwd) local readonly local --verbose sed
+&& "$1" | 'quoted text' 'quoted text' sed ${HOME}
+	&& sed local x=1 awk --verbose cd test
+	-eu readonly readonly readonly /usr/bin 2>/dev/null | done --verbose then export
+/usr/bin | /usr/bin ${HOME} /usr/bin /usr/bin done 'quoted text'
+sed && "$@" printf 'quoted text' echo test awk "$1" 2>/dev/null
+	echo grep cd echo test test /usr/bin && cd printf ${HOME}
+	'quoted text' -eu cd 'quoted text' | done && 'quoted text'
+	readonly /usr/bin printf "$@" sed x=1 readonly 2>/dev/null "$1"
+	readonly echo readonly grep readonly | --verbose
+	"$1" && sed done then 2>/dev/null cd $(pwd) /usr/bin grep /usr/bin awk grep then
+printf local x=1 then readonly echo 2>/dev/null /usr/bin
+		-eu ${HOME} then --verbose | "$@" export x=1 $(pwd) awk /usr/bin readonly --verbose
+	-eu printf "$@" cd "$1" --verbose cd echo
+	2>/dev/null readonly
+		grep x=1 | done -eu export sed "$1" -eu cd printf echo 'quoted text'
+readonly "$1" sed &&
+		&& test | | && echo -eu then then awk x=1 -eu "$1" printf
+	"$1" /usr/bin sed sed awk then 2>/dev/null
+	grep "$@" | | cd 'quoted text'
+	| 2>/dev/null | local
+		-eu then "$@" echo 'quoted text' done x=1 x=1
+		readonly "$1" cd export then test then echo
+		readonly x=1 cd && export 'quoted text' cd --verbose "$1" awk printf --verbose
+	sed ${HOME} sed done test $(pwd) awk --verbose readonly ${HOME} export
+		2>/dev/null && then --verbose readonly x=1 sed x=1 "$@" printf -eu then "$@" test
+	export printf then "$1" echo /usr/bin 2>/dev/null printf ${HOME}
+		-eu | then sed printf /usr/bin 2>/dev/null
+then done --verbose && local then "$1" printf 2>/dev/null then local
+	$(pwd) --verbose readonly /usr/bin
+		-eu && awk cd readonly awk "$1" x=1 "$1"
+echo && -eu local 'quoted text' x=1
+done -eu awk && -eu 'quoted text' test ${HOME} cd awk awk
+	-eu awk 'quoted text' --verbose -eu 'quoted text' grep x=1 echo -eu
+		readonly 2>/dev/null -eu awk x=1
+	"$1" 'quoted text' 'quoted text' /usr/bin /usr/bin sed printf then echo 'quoted text'
+test && echo /usr/bin test
+		awk $(pwd) && awk $(pwd) echo $(pwd)
+local | cd cd sed done -eu && 2>/dev/null echo
+test sed /usr/bin "$@" ${HOME} printf "$@" then /usr/bin
+then /usr/bin "$@" 'quoted text' printf grep x=1 awk "$@" sed 2>/dev/null done
+	awk grep cd $(pwd) && sed /usr/bin then grep ${HOME} ${HOME} ${HOME}
+	-eu -eu -eu export cd | "$1" test "$1" 2>/dev/null awk
+		readonly done "$1" echo -eu | 'quoted text' awk "$@" test "$1" -eu /usr/bin
+local $(pwd) --verbose && "$@" 2>/dev/null
+echo ${HOME} ${HOME} readonly local -eu local | awk 'quoted text'
+	-eu local 'quoted text' "$@" "$1" $(pwd) export --verbose awk
+then 'quoted text' /usr/bin done
+echo "$1" | echo printf cd test | awk echo sed awk test && echo $(pwd) -eu local
+	echo echo && --verbose export 'quoted text' sed /usr/bin echo ${HOME}
+		readonly echo echo readonly
+	'quoted text' 2>/dev/null done ${HOME} cd 'quoted text' ${HOME} printf
+		${HOME} && $(pwd) cd export then done cd awk ${HOME} grep --verbose
+"$1" grep awk x=1 && sed done echo sed sed --verbose
+"$@" printf grep /usr/bin x=1 grep then cd $(pwd) done
+"$@" /usr/bin local test cd 'quoted text' readonly local -eu printf
+| $(pwd) /usr/bin && "$@" "$@" /usr/bin
+		grep grep test 'quoted text' | "$1" 'quoted text'
+	'quoted text' --verbose
+test test ${HOME} x=1 -eu done printf done "$@" 2>/dev/null
+	--verbose sed then "$@" -eu 2>/dev/null cd ${HOME} $(pwd) -eu $(pwd) && cd 'quoted text'
+		grep grep "$1" printf awk sed ${HOME} 'quoted text' "$@" export
+| test /usr/bin sed then echo --verbose "$@" then
+	done echo grep && awk done "$1" readonly "$@" readonly "$1" sed local
+		/usr/bin 'quoted text' 'quoted text' then local ${HOME} && x=1 ${HOME}
+		--verbose --verbose 2>/dev/null
+		$(pwd) awk awk 2>/dev/null 'quoted text' ${HOME} && "$@" then 2>/dev/null
+done 'quoted text' 'quoted text' "$1" cd 2>/dev/null 'quoted text'
+	awk awk cd then printf --verbose x=1 && -eu $(pwd) grep done
+x=1 readonly $(pwd) -eu 2>/dev/null && ${HOME} $(pwd) 2>/dev/null
+done echo /usr/bin echo grep done echo | ${HOME} x=1 printf echo local then printf
+	'quoted text' "$@" ${HOME} "$1" grep grep grep printf
+	"$@" readonly sed done
+		'quoted text' 2>/dev/null x=1 readonly | local | 2>/dev/null
+export && grep awk awk grep then sed readonly cd ${HOME} awk awk && done
+	printf | -eu echo local 2>/dev/null ${HOME} export --verbose test echo
+		grep sed -eu 'quoted text' sed -eu --verbose "$1" ${HOME} done | --verbose
+	&& sed test cd x=1 -eu "$1" done awk cd test local
+	export printf export 2>/dev/null --verbose
+		$(pwd) export "$1" printf --verbose echo
+	/usr/bin x=1 cd 'quoted text' awk 'quoted text' cd 2>/dev/null then 'quoted text'
+	2>/dev/null cd /usr/bin "$1" local awk -eu $(pwd) --verbose
+echo "$1" --verbose $(pwd)
+		readonly x=1 grep | sed "$1" printf /usr/bin export "$1" printf done done awk grep
+		2>/dev/null cd --verbose printf "$@" awk ${HOME} x=1
+		-eu sed printf readonly -eu done grep readonly printf
+sed -eu local readonly cd 2>/dev/null sed /usr/bin
+	printf test ${HOME} awk /usr/bin printf
+$(pwd) local then export readonly then test done grep done echo export --verbose
+		readonly sed sed ${HOME} "$1" echo done cd ${HOME} 'quoted text' 2>/dev/null
+		test then sed printf export export
+&& local local /usr/bin | local awk ${HOME} /usr/bin sed
+--verbose -eu test 'quoted text' export echo
+readonly -eu sed --verbose 2>/dev/null x=1 2>/dev/null awk && --verbose --verbose
+${HOME} readonly "$@" then | sed "$@" 2>/dev/null cd
+-eu -eu 2>/dev/null --verbose cd | done local -eu ${HOME} -eu | then
+echo | /usr/bin cd sed 2>/dev/null printf x=1 printf ${HOME}
+		--verbose --verbose cd done test "$1" | local cd awk readonly then cd x=1 readonly
+'quoted text' "$1" 2>/dev/null ${HOME} --verbose test grep sed --verbose
+x=1 printf then export local sed 'quoted text' then $(pwd) readonly then printf
+local grep cd awk | | readonly $(pwd) x=1 x=1 awk /usr/bin ${HOME} $(pwd) grep
+		'quoted text' "$@" 2>/dev/null export
+export && echo -eu 2>/dev/null -eu /usr/bin then sed sed awk awk
+	2>/dev/null --verbose /usr/bin 2>/dev/null
+	readonly printf grep
+	${HOME} done "$1" && local /usr/bin export ${HOME}
+	/usr/bin export readonly echo "$@" -eu ${HOME} | --verbose
+	-eu done export ${HOME} done cd ${HOME} printf $(pwd)
+then /usr/bin readonly awk | 2>/dev/null echo readonly --verbose
+sed x=1 $(pwd) local export
+	$(pwd) awk grep 'quoted text' printf awk "$1" test /usr/bin
+	printf local "$@" local | grep 'quoted text' done
+		cd -eu $(pwd) printf local
+		"$1" local ${HOME} 'quoted text' sed | | test readonly
+export "$@" cd x=1 $(pwd) grep printf "$1" 'quoted text' "$1"
+$(pwd) done 'quoted text' 'quoted text' export test done && | awk --verbose /usr/bin
+	2>/dev/null --verbose grep export echo
+	'quoted text' x=1 | -eu /usr/bin test printf
+sed echo /usr/bin -eu cd
+		'quoted text' x=1 grep
+export -eu echo export --verbose
+sed && done x=1 printf "$1"
+	then local cd 'quoted text'
+	readonly -eu sed cd "$1" sed then readonly ${HOME} then then grep "$@"
+		test /usr/bin grep awk
+'quoted text' -eu test ${HOME}
+		2>/dev/null awk && sed /usr/bin export sed awk ${HOME} x=1 -eu
+cd echo awk "$1" export | readonly then
+	echo && "$1" then awk then "$@" awk
+$(pwd) cd --verbose /usr/bin --verbose --verbose "$1" $(pwd) local $(pwd)
+		-eu export awk ${HOME} printf -eu
+then $(pwd) echo $(pwd) /usr/bin export | x=1 then /usr/bin sed done ${HOME}
+		echo --verbose 2>/dev/null local && sed test sed export 2>/dev/null
+"$@" done $(pwd) /usr/bin awk done ${HOME} 'quoted text' local 'quoted text'
+cd | done cd ${HOME} echo readonly grep && -eu x=1 2>/dev/null 'quoted text'
+		awk "$@" cd /usr/bin cd /usr/bin 'quoted text' /usr/bin
+		sed readonly test 2>/dev/null export "$1" echo printf 2>/dev/null
+		echo ${HOME} local echo printf printf -eu 'quoted text' /usr/bin
+	printf echo x=1 'quoted text' /usr/bin ${HOME} 'quoted text'
+		-eu "$1" sed 'quoted text' $(pwd) test 'quoted text'
+		grep -eu done /usr/bin ${HOME} 2>/dev/null echo local "$1" then grep echo
+printf printf "$1" done
+	then 'quoted text' | local test then $(pwd) $(pwd) && sed export | sed echo then
+/usr/bin grep readonly export sed awk readonly sed done /usr/bin -eu
+		printf sed 2>/dev/null test export | $(pwd) "$1" "$@" --verbose
+test x=1 'quoted text' --verbose echo grep
+	grep --verbose /usr/bin
+	"$1" /usr/bin printf | readonly grep then echo export
+		&& ${HOME} && --verbose then done
+	test $(pwd) ${HOME} /usr/bin grep | 'quoted text' local -eu grep
+	cd $(pwd) "$@" /usr/bin then "$1" printf done cd "$@" /usr/bin
+readonly 2>/dev/null readonly && 'quoted text' -eu grep 2>/dev/null
+		awk cd && x=1 -eu $(pwd) $(pwd) test -eu cd done test | readonly
+"$1" /usr/bin -eu -eu then 'quoted text' echo 2>/dev/null sed test
+		--verbose && 'quoted text' cd 'quoted text'
+test local && /usr/bin done "$@" printf
+	2>/dev/null readonly | |
+	-eu readonly printf -eu "$1" "$@" printf | && grep 2>/dev/null
+x=1 printf 2>/dev/null test then cd /usr/bin x=1 -eu readonly grep echo sed "$1"
+		$(pwd) && /usr/bin | x=1 export 'quoted text'
+	| x=1 /usr/bin readonly /usr/bin | echo 2>/dev/null
+		'quoted text' done /usr/bin readonly
+	| printf --verbose /usr/bin test export printf 2>/dev/null
+		"$@" x=1 "$@" cd --verbose "$1" --verbose grep done cd echo
+	printf ${HOME} local awk readonly echo /usr/bin test local /usr/bin x=1
+	/usr/bin awk -eu -eu | export awk printf export -eu export x=1
+--verbose $(pwd) then /usr/bin && test $(pwd) --verbose
+	awk printf awk "$@" done readonly echo then 'quoted text' done awk -eu ${HOME}
+		x=1 && test $(pwd) awk sed /usr/bin export $(pwd) local then
+${HOME} local awk local "$@" 2>/dev/null /usr/bin grep 2>/dev/null && "$@"
+	2>/dev/null | | && grep $(pwd) $(pwd) -eu /usr/bin test local
+		2>/dev/null && test done test readonly then --verbose then
+	/usr/bin 'quoted text'
+-eu then export readonly awk test ${HOME} && cd "$1" printf 2>/dev/null
+&& && "$1" cd | grep && export ${HOME} readonly x=1 x=1 sed cd /usr/bin
+$(pwd) $(pwd) then printf && ${HOME} printf
+2>/dev/null $(pwd) "$1"
+		done done readonly done echo local 2>/dev/null sed cd
+		done cd export printf done grep printf grep "$@" sed $(pwd) $(pwd) --verbose
+x=1 | awk done cd -eu -eu cd 2>/dev/null
+	grep then export cd "$1" printf --verbose done -eu grep local $(pwd) | echo
+$(pwd) 'quoted text' "$1" 2>/dev/null test 'quoted text' ${HOME}
+echo $(pwd) echo local readonly awk | done awk
+	grep | x=1 export x=1 2>/dev/null 'quoted text' sed "$@" $(pwd) grep test
+	printf | 'quoted text' x=1 cd --verbose ${HOME}
+	local cd | ${HOME} -eu --verbose readonly done x=1 local cd "$@" sed ${HOME}
+		export then awk cd ${HOME} grep ${HOME} 2>/dev/null 'quoted text'
+	echo "$1" export awk ${HOME}
+		${HOME} cd $(pwd) sed printf
+grep 2>/dev/null export sed
+/usr/bin $(pwd) $(pwd) ${HOME} x=1 "$@" 2>/dev/null export
+	done 'quoted text' then printf 2>/dev/null "$@"
+'quoted text' 'quoted text' sed 'quoted text' $(pwd)
+		$(pwd) sed cd local --verbose readonly
+	local printf && done -eu --verbose local "$1" /usr/bin grep sed -eu
+	awk ${HOME} && ${HOME} cd ${HOME} done cd test readonly ${HOME}
+echo /usr/bin /usr/bin done then 2>/dev/null
+	2>/dev/null test "$1" export --verbose -eu readonly
+sed ${HOME} --verbose awk &&
+		local /usr/bin "$@" then
+	echo awk && x=1 ${HOME} ${HOME} sed ${HOME} printf
+-eu local done readonly readonly | "$1" grep /usr/bin sed done
+	awk awk /usr/bin grep printf 'quoted text' x=1 $(pwd)
+	then /usr/bin "$@" /usr/bin then "$@" printf done && export cd grep 2>/dev/null
+	2>/dev/null sed 'quoted text' "$1" | ${HOME} echo awk readonly
+		&& -eu then echo printf printf sed printf readonly
+	export --verbose 2>/dev/null printf readonly && && local "$1" done
+cd -eu sed "$@" ${HOME} 2>/dev/null grep --verbose export
+2>/dev/null awk cd echo cd readonly echo 'quoted text'
+x=1 "$@" export "$@" /usr/bin 2>/dev/null "$@" 2>/dev/null awk "$@" /usr/bin
+	test readonly awk x=1 "$1" done "$@" printf 'quoted text' $(pwd) cd "$1"
+printf --verbose "$1" test "$@" sed done then grep && "$@" 'quoted text'
+		&& "$@" cd && test printf echo printf
+"$1" export cd then $(pwd) 2>/dev/null ${HOME}
+export local 2>/dev/null echo 2>/dev/null ${HOME} done | 2>/dev/null
+&& $(pwd) "$@" test /usr/bin
+grep readonly -eu awk printf --verbose cd
+-eu awk -eu "$@" | | $(pwd) awk "$@" /usr/bin "$@"
+cd "$1" export sed 2>/dev/null 'quoted text' printf grep
+done x=1 printf readonly 2>/dev/null --verbose 2>/dev/null
+		cd "$1" $(pwd) awk sed /usr/bin 2>/dev/null export
+		/usr/bin && done grep 'quoted text' 2>/dev/null export
+		awk x=1 local | local x=1 /usr/bin local 'quoted text' --verbose "$@"
+echo "$@" ${HOME} | local ${HOME} local
+	cd cd "$1" ${HOME} "$1" test
+		sed -eu printf | "$1" /usr/bin printf --verbose "$@"
+		readonly 'quoted text' awk $(pwd) "$@" "$1" grep
+readonly "$1" grep x=1 export grep export awk x=1 cd "$@" "$@" 'quoted text' 2>/dev/null
+	/usr/bin && cd done x=1 &&
+	'quoted text' then x=1 --verbose
+		then test | printf then
+		"$@" "$@" awk export grep && awk printf
+--verbose cd 2>/dev/null test
+		2>/dev/null /usr/bin | sed -eu printf /usr/bin
+		"$@" then 2>/dev/null printf test -eu
+		echo echo "$1" --verbose printf $(pwd) sed sed local "$@" cd
+		test test "$1" grep then
+"$1" $(pwd) 2>/dev/null && then sed "$@" local readonly $(pwd)
+"$1" 2>/dev/null && awk "$1" ${HOME} "$1" ${HOME} 2>/dev/null export local
+	cd ${HOME} | sed awk then -eu sed printf then --verbose 2>/dev/null export
+	awk "$1" printf "$1" | -eu 2>/dev/null -eu echo ${HOME}
+test printf sed 2>/dev/null sed "$@" && sed "$1" | && sed cd grep -eu grep cd &&
+		then | grep local | printf done /usr/bin
+	&& x=1 x=1 "$1" && $(pwd) "$1" /usr/bin | done -eu $(pwd) /usr/bin "$1"
+		$(pwd) /usr/bin awk ${HOME} /usr/bin then | 2>/dev/null x=1
+		printf awk ${HOME} x=1 "$1" echo | sed readonly test awk cd -eu $(pwd)
+	-eu /usr/bin printf then cd test done 'quoted text'
+x=1 --verbose | 2>/dev/null -eu sed test export -eu | done -eu
+then export printf printf
+		'quoted text' grep && | then grep x=1 x=1 | | readonly && readonly
+"$1" | cd done echo cd x=1 export done printf 2>/dev/null
+	grep x=1 /usr/bin "$@" $(pwd) x=1 cd readonly cd --verbose awk echo cd x=1 --verbose
+	$(pwd) grep | $(pwd) local export $(pwd) done export | && | "$@"
+"$1" grep printf echo echo "$1" readonly ${HOME} then ${HOME} ${HOME}
+		-eu 'quoted text' export export | | test
+"$1" grep ${HOME} -eu local -eu echo awk cd test ${HOME} 2>/dev/null
+	/usr/bin local --verbose readonly then local | cd x=1 readonly local 'quoted text'
+		cd $(pwd) export --verbose sed readonly -eu 2>/dev/null "$1"
+	-eu grep grep /usr/bin export 2>/dev/null
+	awk 2>/dev/null x=1 -eu ${HOME} test local x=1
+/usr/bin then awk echo grep 'quoted text' awk $(pwd) ${HOME} then ${HOME} 2>/dev/null
+		done "$1" readonly --verbose ${HOME} cd echo export test then awk && 'quoted text'
+echo x=1 ${HOME} 2>/dev/null then -eu -eu 2>/dev/null
+	then echo "$1" local /usr/bin /usr/bin export echo
+	2>/dev/null /usr/bin local readonly grep "$@" done ${HOME}
+		-eu cd then -eu cd test printf printf 'quoted text'
+then --verbose local x=1 export echo readonly
+	export | && | test "$1" 'quoted text' export x=1 sed local
+	awk cd -eu 'quoted text' printf printf 2>/dev/null /usr/bin "$@"
+		--verbose ${HOME} -eu cd readonly --verbose --verbose
+done "$1" echo printf --verbose grep local "$1" cd
+		$(pwd) x=1 -eu sed ${HOME}
+done && then cd $(pwd) ${HOME} ${HOME} $(pwd) printf "$1"
+	grep echo /usr/bin printf "$1" "$@" --verbose --verbose
+	-eu 2>/dev/null export ${HOME} echo "$@" grep printf printf ${HOME} printf
+		"$1" 'quoted text' local
+		done | -eu echo $(pwd) grep "$@" awk readonly x=1 'quoted text' -eu local --verbose
+		"$1" --verbose done /usr/bin test -eu done -eu printf ${HOME} "$1" 2>/dev/null
+	| awk --verbose sed then /usr/bin echo grep && test sed 2>/dev/null
+	${HOME} sed x=1 && grep echo cd "$@" test
+${HOME} $(pwd) /usr/bin ${HOME} sed export ${HOME} $(pwd) then grep | ${HOME}
+	--verbose test done 'quoted text'
+	printf then echo sed readonly $(pwd) --verbose x=1 done "$@" printf done
+	"$1" then 2>/dev/null
+		printf export done export | echo grep
+		&& export echo ${HOME} echo cd printf ${HOME} echo sed cd grep printf sed
+"$1" cd --verbose printf readonly cd x=1 ${HOME} sed -eu 2>/dev/null
+	test done x=1 -eu x=1 /usr/bin test printf then sed -eu then $(pwd) awk
+$(pwd) ${HOME} $(pwd) $(pwd) -eu then cd 'quoted text'
+/usr/bin 2>/dev/null x=1 local 'quoted text' $(pwd)
+${HOME} export "$@" $(pwd) /usr/bin && local test /usr/bin
+		echo | export x=1 "$@" 'quoted text' printf done done done export
+	"$1" printf x=1 2>/dev/null ${HOME} && -eu then "$1" done readonly x=1 then export
+	test 'quoted text' --verbose x=1 | awk done awk local local local $(pwd)
+		echo printf ${HOME} $(pwd) x=1 "$@" ${HOME}
+"$@" done awk "$1" test $(pwd) done 2>/dev/null x=1
+	--verbose --verbose echo && test awk sed printf
+		then awk x=1 2>/dev/null echo readonly ${HOME} /usr/bin --verbose local
+2>/dev/null grep awk "$@" x=1 "$@" -eu grep x=1 test --verbose &&
+| sed ${HOME} ${HOME} grep echo ${HOME} -eu grep done /usr/bin test grep x=1 &&
+		awk "$1" 2>/dev/null awk printf export test 2>/dev/null 2>/dev/null -eu local
+		x=1 awk && done /usr/bin "$@" && test "$@" | x=1 | done local $(pwd)
+	test printf then then "$1" then test sed --verbose
+	test printf echo then test /usr/bin 2>/dev/null
+		'quoted text' sed "$@" sed export grep cd echo readonly 2>/dev/null | &&
+		readonly local -eu -eu echo x=1 grep $(pwd) readonly then 2>/dev/null
+		&& "$1" cd "$@" cd echo -eu
+	echo "$@" 2>/dev/null /usr/bin && x=1 'quoted text'
+test echo then cd | then printf $(pwd) --verbose
+		readonly grep grep done x=1 readonly "$1" local cd printf "$1" then && 2>/dev/null
+		cd 'quoted text' done -eu export sed sed
+	awk | 'quoted text' test
+'quoted text' grep ${HOME} 2>/dev/null | echo sed
+	awk awk ${HOME} "$1" "$@" grep
+		"$@" awk /usr/bin -eu cd echo | $(pwd) 'quoted text'
+test --verbose "$1" "$1" "$@" export --verbose cd "$1" echo ${HOME} --verbose grep
+	--verbose x=1 "$1" export done /usr/bin then $(pwd) "$1" && printf
+readonly cd grep printf -eu export --verbose sed "$@" -eu
+		'quoted text' cd 2>/dev/null --verbose -eu printf readonly
+		2>/dev/null 'quoted text' awk ${HOME} -eu
+		local $(pwd) awk printf ${HOME}
+${HOME} "$@" printf && local printf $(pwd) "$1" --verbose 'quoted text'
+	echo awk test | $(pwd) done sed
+		export test echo -eu && /usr/bin grep awk 2>/dev/null awk /usr/bin
+2>/dev/null x=1 echo done | | 'quoted text' x=1 "$@"
+	test cd sed then | then awk cd then readonly readonly cd grep --verbose
+		export "$@" | cd readonly then then
+	readonly | ${HOME} test cd "$@" test 'quoted text'
+		local 2>/dev/null x=1 "$1" "$@"
+	grep && -eu 'quoted text' | grep /usr/bin && awk | sed
+	"$1" "$@" sed printf | grep readonly awk done 'quoted text'
+cd echo echo -eu grep export $(pwd) echo export ${HOME} | cd printf
+	"$1" echo 'quoted text' export && 'quoted text'
+		/usr/bin "$@" export "$1" done local readonly printf readonly && x=1 echo --verbose
+	test then printf 'quoted text' sed x=1 grep cd printf echo grep /usr/bin printf
+&& x=1 --verbose x=1 cd sed then cd 2>/dev/null -eu awk readonly cd
+		$(pwd) echo --verbose readonly "$1" | cd sed local $(pwd) "$1" local --verbose
+/usr/bin printf /usr/bin && $(pwd)
+		done test x=1 && /usr/bin echo
+		done sed && $(pwd) test
+done printf readonly 2>/dev/null
+/usr/bin x=1 /usr/bin local done awk export done awk readonly
+		2>/dev/null | | && readonly echo grep --verbose
+		test /usr/bin local local 2>/dev/null echo /usr/bin test awk
+		'quoted text' -eu "$1"
+		printf -eu awk local test sed cd
+	awk done export test ${HOME} local local awk
+		| | echo printf --verbose then "$1" -eu $(pwd) cd cd awk
+		printf 'quoted text' "$1" $(pwd) done printf echo sed $(pwd)
+		sed --verbose done -eu /usr/bin
+&& /usr/bin export "$@"
+	2>/dev/null done --verbose
+		${HOME} test "$@" export "$1" && local done done "$1" export
+	readonly then test test $(pwd) local /usr/bin grep 'quoted text' | local
+	printf && echo echo "$@" /usr/bin readonly 2>/dev/null test | awk
+	done 'quoted text' 2>/dev/null $(pwd) printf
+		/usr/bin "$1" "$@" grep "$1" grep done
+"$1" awk echo test printf "$1" /usr/bin -eu ${HOME} then local x=1 echo
+grep awk -eu 'quoted text' x=1 'quoted text' grep
+		cd printf grep echo && printf
+export test test "$1" sed "$1"
+	"$@" "$@" ${HOME} done && readonly export
+	2>/dev/null --verbose && $(pwd)
+		export && $(pwd) cd test && 2>/dev/null $(pwd)
+		cd && awk $(pwd) "$@" done -eu --verbose 2>/dev/null x=1 test
+readonly export "$1" then 2>/dev/null /usr/bin 'quoted text' "$1" awk
+		"$1" test | ${HOME} then --verbose
+sed cd readonly 'quoted text' cd "$@" $(pwd) -eu printf /usr/bin
+		--verbose echo --verbose sed 2>/dev/null
+awk --verbose sed "$1" printf -eu 2>/dev/null "$@" done echo | local
+	2>/dev/null local /usr/bin grep sed | $(pwd) awk then readonly
+		&& grep export /usr/bin &&
+	-eu -eu /usr/bin then ${HOME} "$@" /usr/bin readonly then -eu ${HOME} 'quoted text'
+	"$@" /usr/bin | sed export awk printf done x=1 --verbose
+-eu -eu "$@" "$@" "$1" x=1 done
+	sed local then -eu awk export 'quoted text' $(pwd) ${HOME} 'quoted text'
+${HOME} -eu | 'quoted text' --verbose ${HOME} awk -eu echo | sed
+export && "$1" ${HOME} readonly "$@" --verbose && 'quoted text'
+&& done echo 'quoted text'
+test "$1" 2>/dev/null readonly -eu /usr/bin
+awk 2>/dev/null grep x=1
+		done done 'quoted text'
+	then local export grep then printf
+		| x=1 -eu test cd && "$@" awk grep echo cd readonly
+	test && printf 'quoted text' /usr/bin echo --verbose printf
+		'quoted text' | readonly done done /usr/bin "$@"
+		${HOME} export echo readonly && --verbose test echo
+then export && then export "$1"
+	sed && -eu printf "$@" ${HOME} x=1 local then "$@" export awk "$1" cd cd export
+		"$1" 'quoted text' "$1"
+awk sed /usr/bin | && &&
+done -eu export $(pwd) x=1 then "$1" test
+	${HOME} local grep ${HOME} | done $(pwd)
+"$1" awk echo $(pwd) | 2>/dev/null printf sed echo awk 2>/dev/null
+	echo cd "$1" /usr/bin sed grep "$@" "$1" -eu awk $(pwd) --verbose x=1 printf
+		grep awk "$@" then echo -eu x=1 /usr/bin && printf then | printf then echo
+		--verbose readonly cd printf 2>/dev/null
+	done --verbose readonly cd -eu grep printf awk export
+		"$@" $(pwd) awk then local local x=1
+2>/dev/null test x=1 sed
+"$@" sed && local $(pwd) /usr/bin 'quoted text'
+		'quoted text' grep /usr/bin --verbose | x=1 'quoted text' sed sed "$@"
+2>/dev/null grep "$1" --verbose
+		"$@" grep readonly sed --verbose export /usr/bin x=1 done sed -eu "$1" readonly
+	awk "$@" awk 'quoted text' echo | "$@" then then
+	x=1 echo && | then && export 'quoted text' local 'quoted text'
+		printf -eu printf "$@" --verbose sed | 2>/dev/null $(pwd) && $(pwd) done ${HOME}
+	awk /usr/bin echo done sed local x=1 ${HOME} grep
+		| --verbose $(pwd) cd --verbose $(pwd) /usr/bin -eu export readonly
+		${HOME} test awk --verbose test
+		| printf grep ${HOME} grep --verbose echo 'quoted text' "$@" && x=1
+--verbose "$1" ${HOME} --verbose --verbose
+export test /usr/bin readonly export readonly awk | readonly x=1 sed $(pwd) &&
+	grep export cd local done then
+		-eu local "$1" done "$1" cd done
+$(pwd) && 2>/dev/null
+		&& -eu x=1 && export local x=1 $(pwd) local
+		echo /usr/bin /usr/bin then "$1" export /usr/bin
+	test grep test 'quoted text' && awk /usr/bin
+--verbose test printf ${HOME} 2>/dev/null
+readonly $(pwd) awk $(pwd) /usr/bin printf readonly done | echo echo test
+2>/dev/null /usr/bin printf 'quoted text' 2>/dev/null
+		test "$1" && ${HOME} awk "$1" "$@" "$@" export --verbose done printf && "$@"
+	readonly then test test cd sed 2>/dev/null /usr/bin ${HOME} "$1" && /usr/bin grep
+		export export "$@" export 2>/dev/null done ${HOME} --verbose cd
+	test "$1" "$1" printf --verbose awk export "$1"
+echo export x=1 echo awk local printf printf
+awk grep echo test x=1 --verbose echo then readonly x=1 printf
+		sed $(pwd) printf cd x=1 then 2>/dev/null sed --verbose ${HOME} printf
+	awk awk echo && -eu printf /usr/bin 'quoted text' -eu awk
+		awk "$1" 2>/dev/null then export /usr/bin
+	done echo then "$1" "$@" && sed grep readonly export then test | readonly
+		/usr/bin printf test "$@" x=1 done local | 2>/dev/null
+		--verbose readonly cd | /usr/bin
+		2>/dev/null done ${HOME} cd test /usr/bin 2>/dev/null
+	'quoted text' cd "$@" -eu --verbose x=1 2>/dev/null
+	grep ${HOME} -eu export printf /usr/bin x=1 test && -eu 'quoted text'
+		export | local local x=1 export "$@" 2>/dev/null "$1" printf -eu then && | printf
+printf then 2>/dev/null echo
+		-eu echo ${HOME} test /usr/bin "$1" local grep printf 'quoted text' "$1" ${HOME}
+| --verbose test grep x=1 printf test "$@" 'quoted text' readonly
+	export "$@" readonly then cd x=1 ${HOME} 2>/dev/null "$1"
+	printf readonly then -eu x=1 grep
+		local cd | done then --verbose export readonly test $(pwd) $(pwd) --verbose
+		&& done export cd ${HOME} && export grep ${HOME} test "$@" grep
+awk sed "$@" "$@" ${HOME} "$@" "$@"
+	cd "$1" 'quoted text' ${HOME}
+	test echo ${HOME} 2>/dev/null
+	done x=1 sed "$1" printf sed --verbose --verbose "$@" "$1" cd "$@" awk readonly
+		sed awk then --verbose local ${HOME} sed test
+		printf | "$@" done export 'quoted text' readonly /usr/bin then $(pwd) printf
+		local 'quoted text' /usr/bin cd cd cd ${HOME} local
+x=1 $(pwd) sed done --verbose cd x=1 -eu x=1 sed grep
+	readonly local 2>/dev/null readonly grep 'quoted text' cd ${HOME} sed
+		done ${HOME} local export echo "$1" 2>/dev/null && readonly
+	grep && $(pwd) --verbose sed export cd export /usr/bin $(pwd) 2>/dev/null
+then then /usr/bin -eu awk echo printf echo x=1 "$@" /usr/bin
+		then test x=1 --verbose /usr/bin --verbose "$1"
+	-eu done sed x=1 2>/dev/null awk $(pwd)
+		${HOME} local local --verbose local local |
+	then -eu -eu sed 'quoted text' cd /usr/bin "$1"
+	export /usr/bin test "$@" && awk readonly
+	grep done /usr/bin "$1" grep printf awk x=1 /usr/bin awk grep "$@"
+	export export 'quoted text' printf "$1" | local --verbose 2>/dev/null cd done -eu
+		test local && $(pwd) awk /usr/bin printf -eu "$@" --verbose --verbose ${HOME}
+	awk printf -eu grep awk /usr/bin echo | | 2>/dev/null done
+		&& echo printf --verbose then awk echo export "$1"
+		"$@" | export "$1" 'quoted text' && printf
+		then && printf 'quoted text' $(pwd) ${HOME}
+		'quoted text' | --verbose && x=1 awk /usr/bin
+	&& x=1 2>/dev/null printf && $(pwd) local readonly grep awk then ${HOME}
+		x=1 "$@" /usr/bin sed 'quoted text'
+test readonly sed "$@" awk awk x=1 "$@" && then done awk $(pwd) test
+x=1 "$@" cd sed readonly /usr/bin
+		export printf sed 2>/dev/null | "$1" sed | -eu --verbose export --verbose
+		-eu "$1" x=1 x=1 local sed cd sed sed | local /usr/bin "$1" export cd --verbose
+		'quoted text' then 2>/dev/null 2>/dev/null 2>/dev/null export |
+		| "$1" -eu "$1" then echo "$1" done x=1 then 'quoted text' ${HOME} x=1
+		then $(pwd) readonly test grep awk
+export export cd -eu "$@" --verbose ${HOME}
+cd grep local 'quoted text' printf
+		/usr/bin grep sed x=1 export ${HOME} done "$@" printf "$@" then $(pwd)
+		| readonly printf "$@" awk x=1 "$@" 2>/dev/null
+echo "$@" | x=1 cd echo
+	"$1" echo grep 2>/dev/null "$1" $(pwd) printf
+		-eu cd test "$1" export | test cd awk /usr/bin "$@"
+		readonly local && 2>/dev/null "$1" $(pwd)
+awk sed | sed sed -eu "$1" grep
+local ${HOME} --verbose --verbose readonly
+		readonly "$1" --verbose "$@" printf grep echo grep printf 'quoted text'
+		&& local /usr/bin -eu | 2>/dev/null "$1" -eu "$1" printf echo -eu cd
+	--verbose "$@" test grep | test "$@" 'quoted text' ${HOME} /usr/bin sed 2>/dev/null
+sed done 2>/dev/null ${HOME} $(pwd) done 'quoted text'
+	2>/dev/null ${HOME} x=1 grep echo awk printf local
+		'quoted text' cd test grep grep
+readonly awk test then done then | x=1 -eu
+-eu x=1 | echo && | test awk 'quoted text' /usr/bin export
+		export /usr/bin export 2>/dev/null local cd $(pwd) then echo grep
+		test test 'quoted text' | sed grep && "$@" echo
+		'quoted text' done --verbose local
+readonly 2>/dev/null $(pwd) grep "$@" 2>/dev/null "$1" 2>/dev/null export grep
+	--verbose $(pwd) $(pwd) 2>/dev/null sed local --verbose
+		test cd && 'quoted text' | 'quoted text'
+export done sed 'quoted text' export "$1" 2>/dev/null | "$1" | then
+then readonly echo 2>/dev/null && cd "$1" 2>/dev/null done export -eu cd /usr/bin
+x=1 done x=1 && ${HOME} x=1 cd grep awk local | echo printf ${HOME} local $(pwd)
+		export 'quoted text' 2>/dev/null local
+&& 'quoted text' ${HOME} x=1 $(pwd) x=1 'quoted text' sed 'quoted text' local "$@"
+&& ${HOME} sed sed sed then ${HOME} done export sed && local $(pwd)
+		/usr/bin | "$@" "$1" x=1 done awk | then cd |
+	-eu awk awk done -eu cd local test /usr/bin
+	awk grep printf local readonly /usr/bin
+	"$1" && 'quoted text' ${HOME} "$1"
+	cd readonly echo export printf --verbose 'quoted text' $(pwd) --verbose
+	then /usr/bin -eu ${HOME} grep readonly
+	--verbose done printf done awk local readonly 2>/dev/null readonly /usr/bin
+		local $(pwd) ${HOME} -eu printf local test local readonly --verbose done |
+/usr/bin && | done "$@"
+	echo "$@" "$@" 'quoted text' cd /usr/bin
+	${HOME} x=1 x=1 readonly test --verbose printf done /usr/bin then
+		"$1" "$1" then local "$1" --verbose $(pwd) -eu cd && grep $(pwd) --verbose
+	2>/dev/null printf /usr/bin 2>/dev/null echo 'quoted text' 'quoted text'
+sed "$@" readonly export -eu echo && "$@" cd test export "$1" readonly export
+		$(pwd) "$1" cd | | done awk echo export local grep
+	export && --verbose | test && echo readonly -eu
+done sed 2>/dev/null ${HOME} awk "$@" local -eu export -eu -eu local
+awk 'quoted text' --verbose $(pwd) "$1" then export test sed
+	-eu ${HOME} ${HOME} done
+-eu awk awk | -eu readonly printf done awk
+	echo cd then cd cd export | awk done "$@" done sed echo /usr/bin
+awk echo then && sed x=1 x=1 done ${HOME} $(pwd)
+	printf test then /usr/bin then --verbose sed
+		&& awk | export test awk | sed grep sed export export cd ${HOME} test
+awk export 'quoted text' | then 2>/dev/null export -eu local done
+then --verbose echo echo sed
+	export then grep test test cd 'quoted text' sed sed
+export export | -eu sed
+2>/dev/null cd --verbose $(pwd) /usr/bin "$@" done export
+		then "$@" 2>/dev/null /usr/bin -eu test $(pwd)
+	| "$1" echo "$@" && -eu "$@" done cd readonly grep /usr/bin
+		test done 2>/dev/null then echo test cd echo test test export 2>/dev/null echo
+2>/dev/null then local && sed sed printf local $(pwd) printf /usr/bin
+		then | sed grep /usr/bin printf "$1" grep
+sed grep awk | /usr/bin done -eu echo -eu readonly printf -eu $(pwd) $(pwd)
+done 2>/dev/null grep printf readonly -eu && ${HOME}
+	then grep sed cd "$1" 'quoted text'
+	grep grep && then x=1 printf grep ${HOME} readonly then
+test --verbose echo -eu x=1
+	echo --verbose cd done "$1" echo local "$1" echo 'quoted text'
+		--verbose --verbose test x=1 && 'quoted text' then -eu sed ${HOME}
+		awk cd then grep "$1" "$1" "$@" && awk echo
+	local /usr/bin && readonly export
+	export grep export ${HOME} done --verbose local /usr/bin grep
+		readonly echo echo /usr/bin
+		local awk cd export sed printf
+	"$@" && printf local sed $(pwd) echo
+		local | done printf awk /usr/bin $(pwd) then grep -eu 'quoted text' 'quoted text'
+$(pwd) | then 2>/dev/null 2>/dev/null then awk $(pwd)
+		printf /usr/bin awk x=1 grep --verbose 2>/dev/null export -eu
+grep x=1 | printf printf "$@" export && | test 'quoted text' readonly done export
+		done x=1 /usr/bin echo local test ${HOME} ${HOME} grep done readonly export x=1
+		awk printf printf $(pwd) && readonly
+export $(pwd) $(pwd) --verbose sed
+printf 'quoted text' cd --verbose local then done | 'quoted text'
+		local then --verbose "$1" "$1" 'quoted text' -eu --verbose && $(pwd) ${HOME}
+		"$@" -eu "$@" cd --verbose cd
+	readonly ${HOME} "$1" local
+export awk -eu sed readonly local grep ${HOME} | $(pwd) cd 'quoted text'
+		sed -eu | x=1 readonly awk readonly test ${HOME} test test 2>/dev/null 2>/dev/null
+local "$@" then test readonly sed local done
+		-eu 2>/dev/null printf x=1
+printf local 'quoted text'
+	cd -eu local test awk awk awk echo export awk 2>/dev/null
+		printf /usr/bin local readonly cd $(pwd) -eu then "$@"
+	&& "$1" 2>/dev/null printf $(pwd) 2>/dev/null echo echo "$1" then --verbose
+echo $(pwd) local echo -eu 'quoted text' echo && && grep awk
+echo then local sed then printf && ${HOME}
+		&& 'quoted text' then && done
+		printf local | --verbose ${HOME} grep grep readonly 'quoted text' ${HOME}
+		awk printf printf sed grep sed grep done | grep echo
+		export echo --verbose export done "$@"
+		-eu /usr/bin sed $(pwd)
+	--verbose readonly $(pwd) "$1" printf export
+	done export export readonly
+	done export test "$1" then sed x=1 --verbose --verbose | then | "$@" printf
+		'quoted text' then echo grep | local "$@" readonly --verbose
+	x=1 export -eu local grep printf "$@" readonly ${HOME} 'quoted text'
+	awk | "$@" ${HOME} /usr/bin readonly
+grep "$@" "$@" x=1 $(pwd) local 'quoted text'
+local then $(pwd) sed $(pwd) 'quoted text' readonly awk ${HOME} printf
+	$(pwd) test -eu "$@" 2>/dev/null echo
+$(pwd) && ${HOME} sed export
+then echo --verbose "$1" 'quoted text' 2>/dev/null --verbose
+		printf done echo && grep --verbose 'quoted text' /usr/bin
+		/usr/bin | /usr/bin then local | 2>/dev/null then 'quoted text'
+	cd --verbose && -eu local sed cd local
+x=1 local then test cd --verbose export echo ${HOME} done x=1 awk local
+		readonly sed "$1" 2>/dev/null "$1" 2>/dev/null then 'quoted text' echo && grep
+echo "$@" cd local grep echo
+		then grep "$1" $(pwd) && $(pwd) &&
+--verbose printf 'quoted text' echo test readonly ${HOME} ${HOME}
+$(pwd) 'quoted text' local "$@" $(pwd) test export /usr/bin --verbose test
+	readonly 'quoted text' "$@" cd local cd local
+		"$@" readonly 2>/dev/null readonly test printf test
+		--verbose /usr/bin awk readonly x=1 | /usr/bin export ${HOME} /usr/bin /usr/bin
+	2>/dev/null x=1 local sed --verbose grep awk $(pwd) readonly &&
+--verbose "$1" "$1" sed $(pwd) "$@" export
+	done 'quoted text' 'quoted text' /usr/bin readonly "$@" sed && && --verbose done
+	&& local /usr/bin cd test 'quoted text' then
+local grep "$@" test awk done $(pwd) | && then /usr/bin
+	then "$1" 2>/dev/null "$@" | readonly 'quoted text' cd --verbose x=1 test --verbose
+| && "$1" then $(pwd) --verbose | printf -eu sed 'quoted text' cd awk echo "$@"
+"$@" readonly printf export cd && done then 2>/dev/null ${HOME} /usr/bin "$1"
+'quoted text' --verbose readonly 2>/dev/null sed echo -eu
+${HOME} grep sed 'quoted text' printf 2>/dev/null | export "$1" | ${HOME} "$1"
+		"$@" && | sed --verbose x=1 echo
+	test x=1 cd 2>/dev/null $(pwd) readonly
+		| x=1 "$1" /usr/bin test ${HOME} "$@"
+"$@" awk done x=1 sed test x=1 readonly printf 2>/dev/null
+/usr/bin cd ${HOME} "$1" x=1 then readonly x=1 awk local
+"$@" awk export awk "$1" then test export printf --verbose
+| test readonly ${HOME} | $(pwd) local local printf | grep cd -eu cd "$1" /usr/bin
+'quoted text' "$1" then test --verbose "$@" --verbose
+	${HOME} done cd "$@" readonly $(pwd)
+		--verbose readonly readonly x=1
+		then sed test 2>/dev/null printf ${HOME} 'quoted text' printf x=1 then
+x=1 2>/dev/null sed x=1 && local $(pwd) ${HOME} cd readonly
+	x=1 ${HOME} done done --verbose
+-eu ${HOME} then | x=1 readonly printf
+"$1" local done 'quoted text' 2>/dev/null readonly local && printf
+&& printf awk ${HOME} cd sed cd -eu then grep then then x=1 then sed export printf
+		'quoted text' cd $(pwd) ${HOME} "$1" done $(pwd) cd &&
+	echo x=1 sed printf printf ${HOME} $(pwd) export --verbose ${HOME} test
+echo "$1" test x=1 2>/dev/null grep
+	cd "$@" sed "$1" then "$1" "$@" "$1" --verbose local
+	sed $(pwd) awk "$@" cd | export readonly readonly
+echo "$@" test "$1" local awk 'quoted text' --verbose
+awk --verbose printf 2>/dev/null -eu | done $(pwd) cd 2>/dev/null -eu &&
+		/usr/bin 'quoted text' then printf ${HOME} sed 'quoted text'
+		readonly export echo | printf echo awk /usr/bin
+		2>/dev/null cd /usr/bin sed /usr/bin /usr/bin 'quoted text' 'quoted text'
+		"$1" done test done then done awk --verbose done 2>/dev/null
+		awk "$@" $(pwd) 2>/dev/null "$1" then -eu -eu local sed readonly
+		awk printf export then then sed "$@" done 2>/dev/null "$1" "$1" && test "$1"
+	${HOME} awk "$@" ${HOME} echo printf sed cd "$1"
+	x=1 test --verbose done export then ${HOME} export
+	${HOME} 2>/dev/null test local readonly readonly printf then export test /usr/bin
+	--verbose printf -eu awk local --verbose $(pwd) /usr/bin
+	-eu x=1 cd /usr/bin ${HOME} 'quoted text' then sed readonly then local then test
+		| ${HOME} $(pwd) $(pwd) local export cd local /usr/bin
+	"$@" export test grep "$1" export then 2>/dev/null export sed
+"$1" printf --verbose && printf x=1 x=1 "$@" grep
+		$(pwd) export "$@" sed -eu $(pwd) readonly | $(pwd) "$1" /usr/bin
+	sed "$@" cd awk | echo "$1" readonly done
+		$(pwd) cd /usr/bin "$@" $(pwd) "$1" printf
+| 2>/dev/null printf readonly done
+		2>/dev/null $(pwd) -eu awk "$1" local
+	readonly export export cd "$1" /usr/bin ${HOME}
+		grep local done echo export && -eu
+	printf /usr/bin 'quoted text' -eu
+then test | then $(pwd) && x=1
+"$@" && 'quoted text' local printf printf grep test --verbose
+printf sed 2>/dev/null 'quoted text' x=1 export -eu echo test grep
+	-eu grep export echo printf && test test sed "$@" ${HOME}
+	echo | "$1" $(pwd) -eu local | | local local 2>/dev/null
+		-eu echo $(pwd) | "$@" printf x=1 local echo 2>/dev/null $(pwd)
+		sed export 'quoted text' $(pwd) 'quoted text'
+		'quoted text' cd readonly readonly x=1 done ${HOME} 2>/dev/null printf readonly
+	$(pwd) && export grep x=1 local cd "$1" | --verbose x=1 echo --verbose
+		'quoted text' -eu printf 2>/dev/null grep 'quoted text'
+		test "$@" export "$1" "$@" echo test cd readonly then test
+		"$@" then printf -eu "$@" --verbose /usr/bin $(pwd) grep "$1" then --verbose
+		"$1" $(pwd) then grep local x=1 "$@" 'quoted text'
+		done done 'quoted text' $(pwd)
+test sed grep -eu $(pwd)
+	'quoted text' test x=1 grep && 2>/dev/null
+	x=1 test /usr/bin local test printf local
+local | && 2>/dev/null x=1 grep readonly export "$1" && 2>/dev/null
+		awk && -eu && local "$@" local
+/usr/bin echo test readonly
+		2>/dev/null /usr/bin awk
+'quoted text' readonly x=1 readonly export | awk test 2>/dev/null grep
+	then 2>/dev/null ${HOME} cd readonly /usr/bin
+-eu --verbose 'quoted text' 2>/dev/null echo | -eu
+readonly local local && export export export test grep export awk x=1 -eu then
+grep 'quoted text' 2>/dev/null $(pwd) "$@" --verbose
+cd awk readonly done
+cd then printf "$@" --verbose sed
+/usr/bin "$@" echo -eu /usr/bin sed local x=1 'quoted text'
+	sed printf sed --verbose x=1 /usr/bin --verbose | test -eu
+		"$@" --verbose "$1" grep cd sed ${HOME} cd
+		'quoted text' $(pwd) cd sed awk 'quoted text' 'quoted text'
+printf awk cd -eu test 'quoted text' 2>/dev/null
+printf "$@" cd /usr/bin "$1" /usr/bin cd -eu awk "$@" x=1 'quoted text'
+$(pwd) done test cd then | &&
+		'quoted text' then x=1 --verbose then
+$(pwd) then printf && x=1 then | done then
+		readonly "$1" cd "$1" | echo 2>/dev/null
+		sed grep $(pwd) export sed 'quoted text' && printf
+	${HOME} 2>/dev/null -eu 2>/dev/null ${HOME} printf
+	-eu export && x=1 cd awk grep export test export grep --verbose 'quoted text'
+--verbose local done 2>/dev/null ${HOME} --verbose 2>/dev/null
+grep "$1" && cd export -eu ${HOME} "$@" readonly --verbose /usr/bin
+x=1 | "$1" done sed grep "$1" done "$1" printf --verbose
+	readonly $(pwd) -eu &&
+/usr/bin local printf 2>/dev/null "$1" 'quoted text' cd /usr/bin "$@"
+"$1" ${HOME} done /usr/bin awk "$1" local
+'quoted text' local $(pwd)
+	| sed then 'quoted text' echo && then readonly sed | ${HOME}
+${HOME} grep && "$1" test
+		awk readonly cd | --verbose cd 'quoted text'
+	awk 'quoted text' local 2>/dev/null /usr/bin local export done
+	sed readonly cd then then x=1 --verbose -eu $(pwd) && local then grep
+	awk echo && "$@" -eu echo local |
+	'quoted text' printf --verbose
+	export ${HOME} sed local done 2>/dev/null export $(pwd)
+printf $(pwd) then awk -eu grep 2>/dev/null echo ${HOME}
+		done | $(pwd) -eu printf && && readonly export
+		2>/dev/null echo done /usr/bin --verbose && $(pwd) printf
+		"$1" --verbose -eu then /usr/bin 2>/dev/null && && readonly printf
+/usr/bin grep 'quoted text' echo awk 2>/dev/null && cd && "$@" && $(pwd)
+		test ${HOME} awk -eu /usr/bin ${HOME} grep cd local /usr/bin "$@" done "$@" local
+		2>/dev/null "$@" test awk /usr/bin
+| $(pwd) --verbose test echo local x=1 test | $(pwd) "$@"
+"$1" cd local sed then ${HOME} ${HOME} && $(pwd)
+sed /usr/bin /usr/bin echo 'quoted text' export then export then
+	"$1" | 'quoted text' echo test export && done 'quoted text' echo
+cd --verbose printf -eu -eu cd -eu done export
+"$@" 2>/dev/null sed ${HOME} -eu 2>/dev/null then
+		then grep grep x=1 echo cd 2>/dev/null
+-eu 2>/dev/null /usr/bin done then readonly --verbose -eu awk
+		| "$@" -eu ${HOME} | &&
+	awk && echo export sed | | local export && /usr/bin "$@" done
+"$@" local cd echo -eu test
+		printf grep x=1 readonly test
+		awk && then ${HOME} x=1
+x=1 local "$@" then echo cd "$1" 2>/dev/null export then x=1 /usr/bin
+	--verbose grep grep -eu printf
+	awk | 'quoted text' && test local then 2>/dev/null
+	${HOME} then 'quoted text' && /usr/bin ${HOME}
+		sed "$@" test grep test then readonly done 2>/dev/null done then awk &&
+	export printf awk local sed /usr/bin && cd local
+		/usr/bin x=1 x=1 local /usr/bin "$@" awk $(pwd) x=1 export
+	then x=1 readonly --verbose
+x=1 readonly local -eu && | done /usr/bin awk "$@" done --verbose
+	${HOME} x=1 && awk export ${HOME}
+	'quoted text' --verbose 'quoted text' 2>/dev/null then x=1 test
+		"$1" 'quoted text' readonly $(pwd) cd && printf readonly $(pwd) local &&
+'quoted text' done readonly | awk --verbose
+		grep cd && done "$1" -eu echo 2>/dev/null $(pwd) cd -eu readonly $(pwd) x=1 "$1"
+	${HOME} sed --verbose ${HOME} "$1" grep echo
+	then x=1 'quoted text' && x=1 "$@" sed test echo local x=1 test 2>/dev/null
+"$@" export x=1 echo "$1" export x=1 local awk /usr/bin "$1" $(pwd)
+	${HOME} -eu | echo readonly -eu 'quoted text'
+-eu printf "$@" then printf
+sed awk local -eu | printf export x=1 echo 2>/dev/null echo export cd awk |
+	local printf done awk | then 2>/dev/null
+		then "$1" "$@" | readonly echo -eu ${HOME} then readonly test
+	&& --verbose x=1 printf
+		grep | export sed echo 2>/dev/null echo x=1 x=1 /usr/bin local done "$@" printf
+x=1 awk awk cd && && |
+		local x=1 ${HOME} 2>/dev/null
+		cd "$@" 2>/dev/null done && readonly test 2>/dev/null readonly
+awk ${HOME} cd $(pwd) then x=1 | "$@" /usr/bin | readonly ${HOME} --verbose
+	| done readonly x=1 --verbose ${HOME} grep $(pwd) 'quoted text'
+/usr/bin then echo local 2>/dev/null
+	local then readonly done | ${HOME} then ${HOME} awk test
+x=1 --verbose "$1" --verbose export echo /usr/bin grep printf "$@" "$@" --verbose
+	$(pwd) local then | x=1 $(pwd) echo test printf x=1 && 'quoted text' test sed
+		sed grep awk --verbose export ${HOME} x=1 readonly printf local echo 2>/dev/null
+		/usr/bin /usr/bin /usr/bin cd readonly "$1" grep echo 'quoted text'
+		grep readonly "$@" cd "$@" 2>/dev/null 'quoted text' && awk printf readonly
+	done "$@" cd readonly $(pwd) --verbose
+	$(pwd) printf $(pwd) 2>/dev/null "$@" sed export cd awk
+done awk "$1" then test 'quoted text' then /usr/bin grep cd cd
+	done printf sed "$@" 2>/dev/null 'quoted text'
+		--verbose export printf "$1" | cd awk && "$1" local
+	x=1 local echo echo test export sed 'quoted text' | "$@" x=1 test awk done
+	"$1" && -eu && then x=1 export 'quoted text' $(pwd) done $(pwd) "$1"
+		readonly 2>/dev/null 2>/dev/null sed local /usr/bin
+	done $(pwd) export local && $(pwd) 2>/dev/null /usr/bin
+		readonly 2>/dev/null readonly cd | "$1" then then ${HOME}
+		done done --verbose readonly printf "$1" sed done done printf --verbose echo
+-eu sed $(pwd) 'quoted text' $(pwd)
+"$1" x=1 --verbose "$@" local && | grep
+		test x=1 -eu -eu $(pwd) test echo sed /usr/bin --verbose readonly printf
+done && readonly sed 2>/dev/null done /usr/bin then sed test
+	awk awk export readonly printf sed printf
+	-eu "$@" ${HOME} && awk local /usr/bin x=1 done "$1" export test readonly
+x=1 then then cd grep local $(pwd) printf
+$(pwd) 2>/dev/null echo ${HOME} 2>/dev/null && cd printf local export
+--verbose --verbose done "$@" | /usr/bin ${HOME} awk $(pwd) 2>/dev/null
+&& 2>/dev/null | sed "$1" -eu x=1 readonly "$1" && awk readonly grep --verbose
+local export readonly sed "$1" -eu awk x=1 -eu 2>/dev/null 2>/dev/null
+	2>/dev/null --verbose cd --verbose readonly echo ${HOME} --verbose
+	local "$@" 2>/dev/null 2>/dev/null then printf && local 'quoted text'
+/usr/bin readonly readonly -eu --verbose | /usr/bin cd --verbose /usr/bin export
+	cd printf local $(pwd) then 2>/dev/null 2>/dev/null
+	x=1 printf then $(pwd) 2>/dev/null cd export sed "$1"
+		'quoted text' ${HOME} cd "$1" -eu test /usr/bin awk echo /usr/bin
+printf && "$1" printf "$1" cd echo
+done awk grep ${HOME} "$@" local
+sed /usr/bin test "$@" 'quoted text' -eu then /usr/bin ${HOME}
+		then cd 2>/dev/null "$@" 2>/dev/null test --verbose && | done "$1" ${HOME} "$1"
+	"$@" export cd cd | "$@"
+	${HOME} cd local then cd "$@" "$1" 2>/dev/null
+		export ${HOME} export | grep /usr/bin "$1" grep then export
+		grep awk done -eu && sed
+		&& ${HOME} 2>/dev/null test grep 'quoted text' --verbose
+		"$1" awk && test sed printf 2>/dev/null x=1 $(pwd) awk x=1
+		test printf cd && x=1 test 'quoted text'
+		local /usr/bin echo 2>/dev/null
+		echo sed then ${HOME} --verbose
+		x=1 export readonly && grep | printf sed done
+		$(pwd) local 'quoted text' "$1" /usr/bin --verbose
+		| test then awk done printf printf x=1 ${HOME} | -eu printf 'quoted text'
+"$1" "$@" test 2>/dev/null grep
+/usr/bin then awk && printf 'quoted text' echo | ${HOME}
+		then readonly echo --verbose done echo
+		$(pwd) local | ${HOME} test export "$1" -eu cd x=1 x=1
+		export --verbose echo 2>/dev/null -eu local export && awk then grep "$@" cd test
+	--verbose 'quoted text' grep
+	x=1 awk /usr/bin readonly printf done local grep printf ${HOME}
+	done echo "$1" grep 2>/dev/null
+	export echo --verbose /usr/bin ${HOME}
+		| done readonly then ${HOME}
+	'quoted text' 'quoted text' grep grep && && "$@" --verbose
+		printf then then export /usr/bin awk awk
+		"$1" grep --verbose --verbose /usr/bin 'quoted text' | 'quoted text' sed grep "$@"
+	'quoted text' && "$@" awk
+test then "$1" 'quoted text' $(pwd) /usr/bin $(pwd) test
+		$(pwd) printf $(pwd) local "$1" sed echo "$1" | echo --verbose
+| /usr/bin grep "$@" -eu done readonly grep x=1 sed /usr/bin sed 'quoted text'
+	-eu && test then /usr/bin x=1 2>/dev/null --verbose done ${HOME} then done awk
+		$(pwd) 'quoted text' "$1"
+		2>/dev/null sed sed 2>/dev/null "$1" | -eu cd | "$1" awk sed cd grep cd test export
+2>/dev/null "$@" awk -eu printf "$1" "$1"
+printf x=1 echo then x=1 $(pwd) test grep x=1 'quoted text'
+	2>/dev/null grep x=1 done | test "$@" $(pwd) local "$@" "$1" 2>/dev/null
+		$(pwd) x=1 echo ${HOME} printf local ${HOME}
+	'quoted text' local done printf --verbose done 'quoted text' test "$@" cd done
+		printf ${HOME} cd /usr/bin test echo 'quoted text' done
+test readonly /usr/bin done x=1 then cd 'quoted text' done $(pwd) /usr/bin
+		-eu 2>/dev/null readonly readonly --verbose "$@" ${HOME} test &&
+		echo awk local | "$1" test "$1" awk "$1" "$1" -eu grep "$@"
+		sed 'quoted text' && readonly test then && sed /usr/bin echo
+local echo x=1 grep echo grep then grep printf then --verbose
+echo readonly "$@" export ${HOME} cd awk x=1
+		--verbose then grep export done --verbose
+	grep "$1" grep /usr/bin "$@" -eu && awk
+		local --verbose done export
+	x=1 -eu echo local done -eu -eu local && 2>/dev/null echo "$@" | export awk then
+	awk 'quoted text' cd local cd
+	done sed ${HOME} --verbose $(pwd) echo awk "$1" local
+	sed $(pwd) "$1" done | test readonly
+		done --verbose 'quoted text'
+then then then 2>/dev/null "$1" local && cd $(pwd) export -eu
+		readonly $(pwd) awk "$1" "$1" x=1 grep
+		grep then readonly 'quoted text'
+		--verbose -eu printf /usr/bin "$@" awk
+done $(pwd) 2>/dev/null cd printf awk grep sed cd /usr/bin 'quoted text'
+	'quoted text' | grep test "$1" done export --verbose then 2>/dev/null export
+"$1" --verbose then /usr/bin ${HOME} sed local echo 2>/dev/null --verbose /usr/bin
+sed done --verbose "$@" /usr/bin done local local sed -eu "$@"
+		$(pwd) readonly x=1 | "$@" "$@" "$1" "$@" cd cd && echo --verbose
+export --verbose readonly local local 2>/dev/null grep 2>/dev/null
+		cd test 2>/dev/null && | --verbose "$@" cd 'quoted text'
+"$@" "$@" | local "$@" then $(pwd) 2>/dev/null | x=1 cd
+	printf 2>/dev/null -eu $(pwd) export printf
+		echo done done test $(pwd) grep sed x=1
+		local echo --verbose then printf "$@" grep ${HOME} awk awk sed test
+		--verbose awk && export local printf -eu echo && x=1 &&
+		x=1 --verbose awk test 2>/dev/null grep --verbose local export awk export then test
+	grep -eu printf 2>/dev/null 'quoted text'
+		cd then test ${HOME} grep sed 2>/dev/null sed x=1 -eu echo --verbose sed "$1"
+		--verbose then -eu "$@" | printf && export -eu /usr/bin 'quoted text'
+	export "$@" --verbose cd
+	2>/dev/null then $(pwd) /usr/bin "$@" && export x=1
+export 'quoted text' x=1 echo
+		grep printf "$1" --verbose 'quoted text' echo x=1 readonly x=1 'quoted text'
+awk "$1" done ${HOME} "$@" /usr/bin readonly test 2>/dev/null
+| "$1" sed export awk test echo "$@" printf x=1 --verbose
+awk printf export | grep echo export export
+		&& printf sed echo test ${HOME}
+		cd sed "$1" readonly echo | awk /usr/bin export 'quoted text' printf
+		sed x=1 then grep export && done then local 2>/dev/null awk
+local "$1" x=1 /usr/bin --verbose done grep "$@" export sed export done x=1
+'quoted text' "$1" local awk test | readonly /usr/bin 'quoted text'
+		"$@" local then && grep $(pwd) awk 2>/dev/null ${HOME} export local
+		${HOME} echo $(pwd) then printf local "$@" done then done && --verbose
+	echo $(pwd) --verbose sed
+export sed printf ${HOME} | done echo awk 2>/dev/null /usr/bin done readonly
+		then grep test "$@" cd readonly | export
+		-eu "$@" export echo $(pwd) | echo echo export awk local && cd x=1
+		/usr/bin done $(pwd) local && grep sed cd
+awk ${HOME} x=1 local --verbose then then then ${HOME} "$1" 2>/dev/null | then
+	then printf sed x=1 /usr/bin "$1" export
+grep x=1 cd export test -eu export
+sed -eu $(pwd) ${HOME} && --verbose 2>/dev/null
+echo 'quoted text' local
+${HOME} && export test export sed local 2>/dev/null readonly /usr/bin
+		${HOME} | awk "$@" /usr/bin cd -eu grep && readonly
+	then local 'quoted text' done printf printf
+test "$1" 'quoted text'
+	| cd export cd 'quoted text' done echo echo printf printf
+	export then "$1" echo local && test sed printf $(pwd)
+done $(pwd) awk grep cd | ${HOME} /usr/bin printf "$1"
+	echo | readonly sed x=1 export grep sed local test 'quoted text'
+		echo cd done x=1 && cd local &&
+	| && awk printf /usr/bin x=1 --verbose
+2>/dev/null $(pwd) grep x=1 x=1 /usr/bin awk "$@" test
+		"$1" done | | echo printf "$1" /usr/bin sed export
+	${HOME} && /usr/bin 'quoted text' && export 'quoted text' echo && cd
+	-eu then /usr/bin | sed
+		cd sed then cd 'quoted text' /usr/bin grep
+		sed ${HOME} then grep grep "$@" cd | $(pwd) -eu sed done
+	done cd export sed 'quoted text' sed | done -eu 'quoted text' x=1 cd then
+		"$1" export sed /usr/bin echo -eu local test && readonly
+&& ${HOME} /usr/bin $(pwd) then test awk ${HOME} x=1 x=1 printf
+done $(pwd) && done 2>/dev/null ${HOME}
+readonly done | -eu sed readonly
+	cd --verbose sed then cd done readonly
+		"$@" x=1 awk "$@" 2>/dev/null --verbose -eu echo "$@" export then
+	test --verbose awk "$1" &&
+	printf grep && awk ${HOME} && test sed local printf "$1" awk readonly grep printf
+sed then "$@" grep cd
+	readonly grep awk test export | && "$@" cd "$1" 2>/dev/null
+		&& then ${HOME} $(pwd) | 'quoted text'
+		awk grep awk done echo ${HOME}
+		done echo local "$@" x=1 /usr/bin x=1 test sed cd readonly
+| && readonly x=1 grep local readonly done $(pwd) export && && &&
+	test --verbose export cd done 'quoted text'
+--verbose ${HOME} awk
+		&& $(pwd) --verbose /usr/bin /usr/bin "$@" --verbose readonly /usr/bin export x=1
+	done awk printf 2>/dev/null local ${HOME}
+		then grep cd sed && && then &&
+		$(pwd) ${HOME} sed grep && /usr/bin
+awk local local local echo x=1 ${HOME}
+		echo 2>/dev/null sed --verbose sed then $(pwd)
+	-eu test --verbose 'quoted text' && echo then done
+	"$@" then local readonly export
+	-eu "$@" printf sed -eu && done awk
+		local "$1" "$@" --verbose --verbose echo /usr/bin
+${HOME} | sed grep ${HOME} readonly 2>/dev/null
+		readonly "$@" readonly x=1 /usr/bin export | printf done test
+cd ${HOME} printf readonly grep ${HOME} "$@" echo printf then
+		local local export -eu --verbose -eu printf 'quoted text'
+awk export printf "$@" -eu "$@" sed local test "$@" --verbose | grep
+		2>/dev/null readonly $(pwd) | done test awk ${HOME} echo
+"$@" sed printf "$1" "$1" $(pwd)
+&& printf "$@" && x=1 test echo "$@" sed grep test 'quoted text'
+		printf --verbose awk && /usr/bin
+	x=1 ${HOME} export "$1"
+$(pwd) then then 2>/dev/null | && echo grep then done x=1 grep
+	grep test done test echo export x=1 export 2>/dev/null local done
+		cd && | sed local --verbose
+"$1" 'quoted text' x=1 printf 2>/dev/null then 2>/dev/null --verbose cd 2>/dev/null
+	"$@" grep printf awk printf awk $(pwd) ${HOME} printf readonly test
+	local 2>/dev/null "$1" 'quoted text' printf
+	-eu 'quoted text' | sed done
+	echo x=1 2>/dev/null cd awk echo
+	$(pwd) ${HOME} grep /usr/bin --verbose local readonly &&
+'quoted text' 2>/dev/null echo 2>/dev/null /usr/bin awk test readonly
+	readonly then "$1" /usr/bin local echo -eu export 'quoted text'
+		grep x=1 ${HOME} local -eu sed printf | 2>/dev/null cd x=1 $(pwd) && "$@"
+		sed | --verbose $(pwd) export && 'quoted text'
+		&& 2>/dev/null --verbose test
+	grep x=1 && x=1 grep done && $(pwd) echo &&
+		-eu awk $(pwd) | "$1" --verbose "$1" grep sed cd $(pwd) done sed
+	$(pwd) awk readonly awk done $(pwd) grep readonly "$@" grep /usr/bin --verbose
+		'quoted text' printf export local sed $(pwd) done ${HOME} printf awk done
+sed done $(pwd) && --verbose printf && 'quoted text'
+		printf cd test awk awk export grep cd && "$1" "$1" | "$@"
+readonly test awk /usr/bin awk "$1" awk export grep cd export
+		"$@" ${HOME} test $(pwd) then $(pwd) export
+	export 2>/dev/null 'quoted text'
+	"$1" test awk then done awk
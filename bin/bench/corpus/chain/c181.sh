@@ -0,0 +1,2001 @@
+then 2>/dev/null echo done 2>/dev/null readonly ${HOME} 2>/dev/null
+then test -eu awk awk $(pwd) ${HOME} | x=1 x=1 2>/dev/null echo echo then
+	--verbose echo | cd awk --verbose sed 2>/dev/null
+		echo /usr/bin 'quoted text' export readonly
+	printf ${HOME} grep done
+--verbose $(pwd) ${HOME} /usr/bin cd -eu 'quoted text' sed printf export --verbose
+		| done --verbose awk | x=1 && done done
+	${HOME} "$@" "$1" && done -eu echo && -eu -eu cd && test && export test printf
+		2>/dev/null x=1 sed readonly test "$@"
+	done grep -eu /usr/bin -eu "$1" readonly ${HOME} --verbose
+| 'quoted text' awk export
+"$@" --verbose local && echo sed grep printf ${HOME} then cd /usr/bin done test
+		"$1" 'quoted text' && awk 2>/dev/null cd grep printf /usr/bin sed -eu local
+		echo $(pwd) printf $(pwd) sed -eu && --verbose "$@" $(pwd) printf sed "$@" local
+awk awk done test done echo grep | readonly local $(pwd) grep printf && grep
+done export done done local 'quoted text' cd echo | grep -eu
+sed --verbose "$@" -eu
+x=1 x=1 "$@" ${HOME} -eu && x=1 grep 'quoted text'
+$(pwd) done printf && test "$1" done printf cd 2>/dev/null sed "$@" x=1
+	"$@" 2>/dev/null sed "$@" local awk grep /usr/bin echo export
+		printf -eu -eu awk 2>/dev/null readonly
+"$@" -eu --verbose && grep "$1" cd --verbose awk &&
+export done readonly "$1"
+	test then ${HOME} readonly local readonly 2>/dev/null x=1 x=1 readonly --verbose
+		"$1" "$1" "$1" export then -eu
+	printf 'quoted text' grep && 2>/dev/null ${HOME}
+		/usr/bin && awk /usr/bin
+local grep "$@" | 2>/dev/null
+$(pwd) test printf $(pwd) --verbose x=1 && grep "$1" /usr/bin x=1
+		readonly 'quoted text' | /usr/bin &&
+		x=1 grep -eu x=1 printf sed
+/usr/bin grep --verbose 2>/dev/null
+cd then /usr/bin 'quoted text' "$1" sed printf sed && "$1" done
+then ${HOME} --verbose export --verbose export then printf awk grep
+&& --verbose 'quoted text' "$@" --verbose export "$@" $(pwd) printf cd local then
+local /usr/bin --verbose "$1" 'quoted text' local
+then echo $(pwd) -eu --verbose "$1" then /usr/bin sed
+	-eu export x=1 export export 2>/dev/null /usr/bin local cd "$@" sed --verbose
+-eu test readonly 'quoted text' readonly --verbose sed 'quoted text' &&
+		2>/dev/null --verbose --verbose sed "$@" | /usr/bin export sed 'quoted text'
+	/usr/bin ${HOME} cd echo export local
+		export grep "$1" "$1" then 'quoted text'
+	test cd test -eu export "$1" cd | test
+"$@" done then $(pwd) test ${HOME} --verbose export "$@" x=1 done
+export local 'quoted text' export readonly local
+	done $(pwd) -eu $(pwd) cd 'quoted text' export readonly | /usr/bin
+		grep export $(pwd) && x=1 done echo then cd "$1" test
+		awk $(pwd) then /usr/bin 'quoted text' x=1 2>/dev/null --verbose | 2>/dev/null x=1
+&& readonly cd done then export sed
+awk --verbose export echo $(pwd) && awk -eu --verbose local
+		&& echo echo $(pwd) echo printf readonly 'quoted text' $(pwd) echo printf
+awk "$1" echo test $(pwd) awk /usr/bin "$@" grep "$@"
+	--verbose done local printf 2>/dev/null
+$(pwd) test echo export "$@" /usr/bin x=1 export
+/usr/bin x=1 cd sed readonly echo then | x=1
+"$1" then sed done then "$1" 'quoted text' ${HOME} echo
+local cd printf readonly "$1" test 'quoted text'
+"$1" sed x=1 local ${HOME} "$1" then -eu x=1 printf sed done 'quoted text'
+	| cd awk "$1" 2>/dev/null /usr/bin x=1 -eu
+	&& printf local grep "$@" 'quoted text' "$1" echo "$@" "$1"
+x=1 export x=1 awk 2>/dev/null grep local 'quoted text' grep 2>/dev/null export
+&& && && ${HOME} -eu $(pwd) printf readonly
+		--verbose awk echo then grep --verbose
+	export x=1 --verbose then "$1" echo ${HOME} "$@" printf cd sed | sed
+		cd test sed /usr/bin then ${HOME} done export test -eu local 2>/dev/null
+then --verbose local test
+		$(pwd) "$@" echo echo -eu $(pwd)
+	--verbose -eu && done 2>/dev/null cd awk | sed | --verbose test export done echo
+	echo export grep export export then awk
+	| "$@" grep --verbose local
+	readonly "$1" 'quoted text' test local export grep
+test ${HOME} "$1" -eu printf &&
+	cd 2>/dev/null "$1" echo echo cd cd
+	${HOME} $(pwd) 2>/dev/null awk 'quoted text'
+		printf x=1 $(pwd) done | --verbose $(pwd) 'quoted text'
+grep cd && sed awk export cd /usr/bin 2>/dev/null grep "$1" "$@"
+	${HOME} then sed | done $(pwd) printf 'quoted text'
+		sed test local grep awk "$1" /usr/bin "$1" ${HOME} x=1 $(pwd) -eu $(pwd) printf
+	'quoted text' readonly ${HOME}
+${HOME} 'quoted text'
+	test $(pwd) $(pwd) -eu "$1" /usr/bin
+		echo cd echo | 'quoted text' --verbose /usr/bin
+export $(pwd) test x=1 --verbose
+/usr/bin echo cd cd ${HOME} 2>/dev/null done printf "$1" | 'quoted text'
+$(pwd) printf readonly 'quoted text' | export
+	2>/dev/null test -eu | printf awk then cd $(pwd) echo 'quoted text' "$@"
+	echo /usr/bin echo 'quoted text' then --verbose awk && -eu "$1" then 'quoted text'
+	-eu -eu 2>/dev/null readonly test sed "$@" 'quoted text'
+	2>/dev/null -eu done done && local 'quoted text' /usr/bin done
+done -eu echo done grep awk ${HOME} 'quoted text' $(pwd) -eu /usr/bin
+	'quoted text' cd ${HOME} "$1" done x=1 $(pwd) echo | grep
+printf -eu -eu | echo | 'quoted text' printf
+readonly printf echo
+	printf export export 'quoted text' | awk then readonly ${HOME}
+"$1" done x=1 "$@" ${HOME} 2>/dev/null
+	printf local 2>/dev/null done /usr/bin | /usr/bin readonly readonly echo export
+	echo awk readonly "$1" grep "$1" /usr/bin printf
+	$(pwd) done $(pwd) ${HOME} echo "$1" local
+	| | printf echo && grep sed done readonly
+		then 2>/dev/null local then awk 'quoted text' printf && --verbose local |
+	readonly $(pwd) sed $(pwd) local local grep --verbose
+${HOME} echo $(pwd) done export
+test | /usr/bin done readonly done
+-eu | readonly export /usr/bin | --verbose local ${HOME} grep grep "$1" 2>/dev/null
+		"$1" test "$@" then ${HOME} -eu
+	grep printf cd test ${HOME} && /usr/bin $(pwd) --verbose
+"$@" | && 'quoted text' x=1 then awk echo local test "$@"
+		readonly | awk --verbose -eu test cd printf grep awk --verbose export
+		| "$1" then awk 'quoted text'
+cd readonly readonly awk | sed x=1 export
+		sed -eu then awk "$1" | /usr/bin then sed awk
+	$(pwd) cd "$1" --verbose --verbose
+x=1 "$@" done cd --verbose ${HOME} "$1"
+		"$1" 'quoted text' "$1" x=1 x=1 $(pwd) export -eu "$@" export ${HOME}
+	/usr/bin --verbose -eu "$1" $(pwd)
+		$(pwd) readonly "$@" done "$@" grep $(pwd) local done "$@" ${HOME} then
+		awk local "$1" export done cd echo echo awk x=1 readonly
+		then --verbose ${HOME}
+/usr/bin x=1 export export printf grep grep ${HOME} sed
+		$(pwd) grep echo done $(pwd) $(pwd) x=1
+'quoted text' "$1" then test
+		/usr/bin grep local awk -eu local | done done --verbose "$1" && ${HOME} then
+/usr/bin local $(pwd) 2>/dev/null 2>/dev/null
+	then export sed cd x=1 local "$1" x=1 $(pwd) then printf && 'quoted text'
+		export awk "$1" 'quoted text'
+	export --verbose awk -eu "$@" $(pwd) test ${HOME} "$1" "$@" cd "$1" then -eu local
+sed /usr/bin ${HOME} /usr/bin "$@" cd && awk sed "$1"
+	export 2>/dev/null sed | $(pwd) && && test "$1" sed done
+	export /usr/bin test grep ${HOME} echo
+	/usr/bin 'quoted text' $(pwd) local done 'quoted text'
+		/usr/bin "$@" cd cd /usr/bin
+		-eu -eu | ${HOME} local grep && /usr/bin awk 'quoted text'
+	"$1" printf 2>/dev/null /usr/bin printf
+--verbose ${HOME} export grep "$1" then ${HOME} ${HOME} x=1 awk
+	| x=1 printf 2>/dev/null 2>/dev/null && | awk export -eu -eu done done done
+		done 2>/dev/null echo 2>/dev/null /usr/bin then && --verbose 2>/dev/null
+done --verbose awk $(pwd) cd then /usr/bin cd ${HOME} grep test done sed
+then 2>/dev/null local grep "$1" local awk sed x=1 ${HOME} cd -eu --verbose echo
+		$(pwd) readonly "$@" test local | $(pwd) 'quoted text'
+	"$1" -eu sed echo cd local cd "$@" --verbose
+test grep | cd printf test ${HOME}
+test 'quoted text' "$1" then printf x=1 local awk grep
+echo -eu export 'quoted text' cd done 'quoted text' 2>/dev/null export
+cd echo local awk readonly printf grep "$@" sed readonly
+	sed done /usr/bin printf cd printf
+printf /usr/bin "$@" -eu printf done readonly then | x=1 "$1" test sed cd
+	-eu ${HOME} x=1 --verbose readonly ${HOME}
+		echo $(pwd) && printf | cd /usr/bin readonly grep
+	$(pwd) export export --verbose awk --verbose 2>/dev/null
+		"$@" then printf | 'quoted text' && -eu -eu | grep && $(pwd)
+	test then sed && echo 2>/dev/null
+	grep local export "$@"
+	| x=1 "$1" $(pwd) readonly "$@" "$1" $(pwd) sed "$1" echo 2>/dev/null $(pwd)
+		'quoted text' /usr/bin "$1" "$1" readonly --verbose $(pwd)
+	${HOME} export grep && | 2>/dev/null
+	cd 2>/dev/null -eu | sed echo /usr/bin
+	test export -eu local sed $(pwd) awk 2>/dev/null -eu
+-eu export export "$1" $(pwd) local awk | printf
+	"$@" /usr/bin 'quoted text' grep sed 'quoted text' readonly test sed sed &&
+	awk ${HOME} /usr/bin x=1 export "$@" 2>/dev/null cd | ${HOME} ${HOME} awk
+"$@" printf export | then readonly readonly test --verbose test then
+		awk "$1" test | x=1 2>/dev/null && $(pwd) then grep x=1 2>/dev/null
+		${HOME} then -eu test local cd export done sed "$@" awk "$1" /usr/bin -eu
+| 'quoted text' echo cd /usr/bin -eu cd 2>/dev/null
+grep -eu echo 2>/dev/null && printf sed local
+		printf sed "$1" awk --verbose sed cd export printf
+done 2>/dev/null then "$1" awk cd export && printf |
+	"$@" $(pwd) cd 2>/dev/null echo 2>/dev/null x=1 2>/dev/null 'quoted text' --verbose
+	local awk test && printf awk awk grep "$@" cd readonly printf awk readonly
+		test grep grep 'quoted text' "$@" awk sed && "$@" printf --verbose local
+	echo printf then done readonly done
+		awk 'quoted text' export --verbose 2>/dev/null done then
+		export cd then | cd printf local "$1" sed then export
+		-eu -eu 2>/dev/null && grep then 2>/dev/null echo && --verbose
+		"$@" -eu "$1" then --verbose readonly $(pwd) -eu "$@" /usr/bin
+done readonly 'quoted text'
+/usr/bin && | readonly x=1 export then cd cd ${HOME} x=1 then && cd --verbose
+		"$@" 2>/dev/null grep 2>/dev/null "$1" x=1 grep grep echo x=1 --verbose cd
+		$(pwd) --verbose "$1" "$1" ${HOME} then export readonly then export 'quoted text'
+	readonly --verbose /usr/bin readonly "$1" /usr/bin ${HOME} then "$1" "$@"
+--verbose sed ${HOME} /usr/bin x=1 test ${HOME} "$1"
+	sed echo awk "$1" "$1" sed x=1 export local grep && --verbose sed x=1
+		export sed /usr/bin x=1 cd && done -eu cd awk grep
+		-eu local --verbose then then local
+then -eu readonly then export printf x=1 done
+"$@" | /usr/bin awk /usr/bin printf -eu cd echo -eu grep test export --verbose
+"$@" --verbose && test ${HOME}
+&& && "$1" then readonly test -eu awk "$1" test cd --verbose "$1" then
+		done $(pwd) awk --verbose done "$1" $(pwd) readonly done printf 'quoted text'
+| sed test ${HOME} printf $(pwd) awk --verbose ${HOME} --verbose
+	grep export done echo
+	'quoted text' awk readonly 2>/dev/null
+	export "$1" --verbose readonly 2>/dev/null
+--verbose "$@" "$@" | ${HOME} local sed && cd /usr/bin $(pwd) echo
+		grep awk 2>/dev/null printf -eu 'quoted text' --verbose
+		"$1" printf done "$1" done
+	x=1 cd /usr/bin test local | export readonly printf --verbose printf
+	"$@" 'quoted text' grep cd $(pwd) sed --verbose export && -eu echo awk
+		sed readonly echo --verbose awk test --verbose --verbose
+	/usr/bin x=1 printf awk echo && echo printf --verbose sed
+grep "$@" grep grep grep ${HOME} then $(pwd) "$1" ${HOME}
+		printf "$1" echo "$@" printf awk sed | done
+	&& awk /usr/bin "$1" /usr/bin echo readonly "$1" awk export "$@" export
+"$1" x=1 x=1 2>/dev/null test then ${HOME} ${HOME} echo awk $(pwd) export then
+		"$@" /usr/bin $(pwd) --verbose cd cd "$@" x=1 printf sed readonly
+	-eu done printf echo "$@"
+		$(pwd) -eu awk export done && "$1" 'quoted text'
+		/usr/bin awk grep "$1" "$1" then
+| | 'quoted text' && --verbose "$1" awk 2>/dev/null
+sed awk sed sed test x=1 && && local $(pwd) awk grep printf echo --verbose
+test readonly readonly done echo grep | && ${HOME}
+/usr/bin printf ${HOME} cd grep done grep export printf
+	-eu /usr/bin -eu --verbose
+${HOME} cd grep | -eu "$@" printf 2>/dev/null
+	done x=1 grep sed printf ${HOME} export
+--verbose grep cd grep | && "$1" 'quoted text' ${HOME} local "$@" local local
+$(pwd) export readonly cd ${HOME} test test local "$1"
+readonly 2>/dev/null && export cd done done "$@"
+		awk /usr/bin x=1 /usr/bin done --verbose sed $(pwd) | export
+test --verbose x=1 $(pwd) 2>/dev/null -eu local /usr/bin 'quoted text'
+	--verbose export /usr/bin sed echo ${HOME} ${HOME} awk /usr/bin done &&
+		test done then cd 2>/dev/null x=1 ${HOME} /usr/bin "$1"
+	"$1" readonly test -eu grep export 'quoted text' export
+		--verbose awk done "$@"
+'quoted text' $(pwd) -eu x=1
+	local then export 2>/dev/null /usr/bin sed
+	cd "$@" | 'quoted text' then local done cd then -eu "$@"
+'quoted text' printf readonly /usr/bin "$@" awk "$@" local grep --verbose ${HOME}
+		x=1 echo cd -eu && /usr/bin -eu
+		awk printf x=1 grep grep "$@" echo "$1" echo x=1 --verbose
+--verbose awk local -eu
+&& test ${HOME} local cd --verbose 'quoted text'
+${HOME} test export --verbose cd echo cd 'quoted text' ${HOME}
+then "$@" x=1 2>/dev/null then ${HOME} && ${HOME} export then echo x=1 --verbose
+| | export printf local readonly echo test done awk test
+		/usr/bin export 'quoted text'
+		cd --verbose "$1" test ${HOME} sed | 2>/dev/null
+		$(pwd) grep --verbose awk echo printf 'quoted text' "$1" echo
+	"$@" export cd --verbose readonly --verbose
+		$(pwd) readonly done && test done grep echo local --verbose test cd grep
+/usr/bin readonly export sed cd awk echo readonly
+"$1" echo done | && && export /usr/bin --verbose -eu then cd -eu ${HOME}
+	/usr/bin echo x=1 2>/dev/null test
+		${HOME} "$1" then ${HOME} grep ${HOME} | echo printf "$1" cd done grep
+	sed grep cd readonly cd echo $(pwd)
+		echo local | awk /usr/bin 'quoted text' ${HOME} local --verbose
+local && cd export sed echo -eu then echo printf local printf
+	local test export test "$@" readonly
+echo readonly cd /usr/bin /usr/bin | --verbose
+		echo --verbose 2>/dev/null | $(pwd) /usr/bin --verbose test -eu awk cd 2>/dev/null
+		/usr/bin cd awk ${HOME} echo "$@" then printf echo
+	'quoted text' 2>/dev/null readonly export 2>/dev/null x=1 /usr/bin export "$1"
+	$(pwd) --verbose cd /usr/bin /usr/bin
+	x=1 cd then x=1 grep --verbose local --verbose
+		then $(pwd) $(pwd) x=1 awk ${HOME} then export readonly | x=1 "$1" $(pwd) |
+export x=1 && then | echo awk export
+		readonly grep x=1 export local 2>/dev/null "$@" && printf
+		done readonly cd 'quoted text' -eu 2>/dev/null sed 'quoted text'
+	&& /usr/bin test "$1" export ${HOME} 2>/dev/null "$1" x=1 && "$1" grep echo sed
+	--verbose 2>/dev/null --verbose cd test 'quoted text' ${HOME} --verbose sed test
+		awk then local test then /usr/bin 2>/dev/null done | test readonly
+		-eu "$@" | awk && | && local ${HOME}
+		export sed 2>/dev/null "$1" awk && test | --verbose
+		test /usr/bin grep local then "$@" x=1 printf then /usr/bin
+then cd "$@" 'quoted text' | grep x=1 export readonly awk
+x=1 "$1" $(pwd) printf export awk /usr/bin grep cd 'quoted text' grep test "$@"
+		echo 'quoted text' /usr/bin then cd export /usr/bin
+done -eu local /usr/bin awk cd readonly export "$1" /usr/bin
+	test awk awk awk && x=1 && done -eu cd "$@" 'quoted text' --verbose $(pwd)
+		"$@" $(pwd) test readonly export done
+grep 2>/dev/null /usr/bin export readonly $(pwd) "$1" x=1 x=1 'quoted text' -eu
+${HOME} "$@" sed then "$1"
+	x=1 awk done "$@" -eu "$@" -eu 'quoted text'
+	'quoted text' test "$1" cd --verbose export test | && $(pwd) 2>/dev/null
+		test grep local && done ${HOME} sed -eu -eu x=1 readonly $(pwd)
+echo -eu $(pwd) grep 2>/dev/null
+| grep | awk $(pwd) x=1 cd x=1 ${HOME} --verbose
+	x=1 echo $(pwd) | --verbose 'quoted text' echo && readonly then -eu sed --verbose
+cd done /usr/bin export local 2>/dev/null grep printf then
+done local | "$@" echo --verbose "$1" && printf -eu && done -eu "$1" 2>/dev/null
+awk "$1" export --verbose
+grep then local && 2>/dev/null 'quoted text' "$1" done /usr/bin printf export 'quoted text'
+	test printf --verbose 'quoted text'
+		then echo "$@" local printf $(pwd) readonly -eu x=1 test ${HOME} readonly
+	${HOME} x=1 "$@" -eu
+		echo echo x=1 | awk test "$1" echo then 'quoted text' --verbose /usr/bin
+	-eu test 'quoted text' 'quoted text' 'quoted text' /usr/bin && 'quoted text'
+then /usr/bin -eu local local /usr/bin "$@"
+	-eu /usr/bin /usr/bin | cd then export local done /usr/bin echo echo
+		cd awk sed $(pwd) cd local 'quoted text' --verbose readonly -eu | echo $(pwd)
+2>/dev/null grep readonly && -eu -eu test awk -eu local test 'quoted text'
+	awk /usr/bin && awk $(pwd) "$1"
+		then echo then --verbose readonly
+		then /usr/bin printf 'quoted text' ${HOME} && x=1 | -eu done readonly $(pwd) sed
+-eu -eu echo sed done x=1
+| then sed 'quoted text'
+		/usr/bin local test sed test /usr/bin
+	"$@" awk ${HOME} "$@" -eu ${HOME}
+${HOME} grep grep local "$@" awk sed "$@" awk "$1" "$@" | 'quoted text'
+		${HOME} "$1" cd awk | "$@" done echo 'quoted text' -eu test
+	&& $(pwd) done x=1 $(pwd) export echo x=1 -eu cd cd done x=1 --verbose 'quoted text'
+	-eu $(pwd) test grep "$@" sed readonly
+		${HOME} printf ${HOME} then
+		$(pwd) && local done "$1" && ${HOME} |
+	"$1" printf export test
+		"$1" "$@" export | 'quoted text' readonly "$1" then --verbose --verbose $(pwd)
+sed grep ${HOME} cd local -eu echo done sed export 2>/dev/null --verbose "$1"
+	cd readonly cd | done 2>/dev/null cd printf done
+test printf && 'quoted text' "$@" export sed -eu | awk export export "$1" local
+		| cd && "$1" then readonly "$@" 2>/dev/null 2>/dev/null "$1" "$1" 2>/dev/null
+x=1 test | done /usr/bin grep
+	printf 2>/dev/null readonly --verbose test -eu /usr/bin -eu
+		test && readonly x=1 --verbose printf "$@" then 2>/dev/null
+"$1" ${HOME} && sed readonly
+	grep grep export "$1" "$@" -eu local printf
+		&& echo | "$@" "$@" test echo cd | done && awk "$1"
+		test "$@" then awk grep 2>/dev/null ${HOME} 'quoted text' sed then 2>/dev/null
+"$1" local grep $(pwd) $(pwd) local -eu 2>/dev/null /usr/bin
+		export local echo cd readonly
+printf ${HOME} printf local sed sed && sed then printf printf
+test --verbose && local "$@" echo --verbose | test then awk x=1 export &&
+		"$@" 'quoted text' 'quoted text' test && done /usr/bin
+	&& local x=1 printf && ${HOME} printf 2>/dev/null local sed ${HOME}
+	readonly awk --verbose
+		echo export local grep
+		"$1" --verbose echo export ${HOME} --verbose "$@" test grep
+	2>/dev/null readonly ${HOME} echo then awk && --verbose
+x=1 sed export | ${HOME} cd "$@" 'quoted text' local test /usr/bin
+	awk x=1 --verbose 2>/dev/null
+	export export readonly grep sed 2>/dev/null
+		&& /usr/bin printf --verbose export
+	test readonly awk readonly readonly echo x=1
+	"$1" awk x=1 2>/dev/null awk sed local ${HOME} cd then echo local "$@" export
+		| 'quoted text' readonly test test local
+	-eu $(pwd) cd -eu cd sed
+		then "$@" x=1 ${HOME} | ${HOME}
+	"$@" "$@" --verbose cd -eu
+		x=1 echo readonly awk ${HOME}
+	$(pwd) done $(pwd) x=1 local
+	&& && "$@" test x=1 printf && /usr/bin then 'quoted text' 2>/dev/null export then
+test "$1" --verbose export --verbose sed 2>/dev/null
+local cd then then grep 2>/dev/null $(pwd) cd "$1" printf
+-eu --verbose printf readonly 2>/dev/null --verbose
+"$@" "$1" awk awk awk grep then then ${HOME} done printf
+	cd done /usr/bin cd --verbose grep echo export awk local
+x=1 "$1" sed printf sed
+grep --verbose grep $(pwd)
+"$@" grep readonly ${HOME} printf done && test cd -eu "$1" /usr/bin $(pwd)
+"$1" && printf --verbose grep && x=1 | 2>/dev/null export
+	grep "$1" cd $(pwd) 2>/dev/null grep cd x=1 printf -eu -eu done
+		grep local cd $(pwd) sed -eu "$@" test export --verbose
+		local echo "$1" test "$@" $(pwd) ${HOME} awk readonly local --verbose cd 'quoted text'
+then ${HOME} "$1" echo 2>/dev/null /usr/bin | && sed done
+		printf /usr/bin test export then --verbose readonly ${HOME}
+		then 2>/dev/null $(pwd) | $(pwd) "$@" -eu then sed ${HOME}
+		2>/dev/null /usr/bin sed sed printf grep && && printf
+		export "$1" then "$@" && grep sed then done echo then sed 'quoted text'
+cd && sed x=1 && then | printf "$1" then grep local done grep grep 2>/dev/null
+	&& sed --verbose echo grep 'quoted text'
+		x=1 awk /usr/bin /usr/bin export sed sed
+		cd done | test printf $(pwd) grep 2>/dev/null "$1" echo
+	done x=1 test local export
+cd echo -eu -eu && export awk 2>/dev/null sed
+		sed 2>/dev/null printf -eu --verbose | grep
+	&& /usr/bin /usr/bin | cd $(pwd)
+sed | ${HOME} test && grep ${HOME} cd $(pwd) 2>/dev/null && printf 2>/dev/null
+&& /usr/bin grep /usr/bin readonly -eu echo
+		x=1 readonly echo grep 'quoted text' done sed local grep readonly
+	x=1 echo 2>/dev/null "$1" -eu 'quoted text' "$1" sed echo -eu cd ${HOME} printf
+then cd awk x=1 | local "$@" sed 'quoted text' readonly
+| /usr/bin ${HOME} x=1 2>/dev/null ${HOME} --verbose
+grep -eu readonly cd test && done export | --verbose echo done done echo local
+$(pwd) "$1" "$@" "$@" x=1 printf sed && sed $(pwd) --verbose ${HOME} sed x=1 /usr/bin
+		&& 'quoted text' sed export echo awk /usr/bin local
+printf grep | /usr/bin awk then test export then readonly --verbose awk 'quoted text'
+2>/dev/null --verbose /usr/bin cd export test cd ${HOME}
+		"$@" ${HOME} --verbose x=1 -eu cd readonly
+export cd --verbose echo -eu
+	--verbose then cd | local -eu ${HOME} cd done sed done | "$@" "$1" ${HOME}
+		x=1 local done "$1" 'quoted text' ${HOME} 'quoted text' echo export
+		'quoted text' then local "$@" done
+&& readonly done readonly ${HOME} echo 'quoted text'
+	sed echo -eu sed then 2>/dev/null echo 'quoted text'
+		2>/dev/null test $(pwd) 2>/dev/null
+	export x=1 "$@" 2>/dev/null
+	2>/dev/null x=1 && x=1 && export --verbose -eu export --verbose done
+grep | test test x=1 ${HOME} --verbose x=1 x=1 ${HOME}
+then printf | "$@" test --verbose "$@" sed $(pwd) done 2>/dev/null "$@" x=1
+-eu "$@" 2>/dev/null "$1" grep && /usr/bin "$@" local "$1" "$1" $(pwd)
+${HOME} then cd echo /usr/bin
+readonly $(pwd) $(pwd) test
+	printf --verbose readonly && --verbose echo sed && -eu cd cd --verbose
+	/usr/bin 2>/dev/null readonly /usr/bin
+		| sed readonly "$1" test 2>/dev/null cd 'quoted text' sed x=1 ${HOME} readonly
+	then cd awk test /usr/bin && | | --verbose x=1 x=1 && /usr/bin
+		readonly readonly readonly 'quoted text' $(pwd) 'quoted text'
+readonly then "$@" grep --verbose sed
+	sed | 2>/dev/null readonly $(pwd)
+		local export 2>/dev/null printf sed $(pwd) ${HOME} printf printf then echo
+sed readonly --verbose ${HOME} awk ${HOME} done /usr/bin
+	"$1" grep x=1 printf readonly awk | x=1 2>/dev/null echo $(pwd) "$@" /usr/bin
+printf cd done | sed local cd
+	${HOME} 2>/dev/null awk done
+2>/dev/null grep printf local --verbose ${HOME}
+		--verbose "$1" readonly ${HOME}
+		"$1" echo 2>/dev/null $(pwd) cd x=1 printf --verbose "$1" local | &&
+	export done cd test done test export "$1" printf x=1 sed
+"$1" /usr/bin done ${HOME} awk local sed --verbose export "$@" --verbose
+x=1 awk ${HOME} $(pwd) echo awk sed printf
+		/usr/bin then printf printf grep "$@" local sed x=1 && --verbose
+	printf | local then done echo 'quoted text' 'quoted text' test then cd --verbose
+echo "$1" /usr/bin local "$1" grep /usr/bin -eu /usr/bin
+	local 'quoted text' printf "$1" test --verbose awk x=1 echo local x=1
+	sed then awk then 'quoted text' && awk "$@" grep /usr/bin
+	local test export sed readonly 'quoted text'
+	/usr/bin then -eu 2>/dev/null --verbose readonly readonly 2>/dev/null
+		$(pwd) -eu && "$@" sed x=1 awk $(pwd) done then "$1"
+	echo --verbose sed x=1 export done x=1 printf printf x=1 test "$@" test --verbose
+	2>/dev/null local --verbose | --verbose sed --verbose | x=1
+	'quoted text' grep -eu echo 'quoted text'
+		&& --verbose cd | ${HOME} echo
+awk awk "$@" local ${HOME} && ${HOME}
+local 'quoted text' printf cd readonly
+		awk 2>/dev/null printf "$1" printf
+	then -eu -eu --verbose then grep ${HOME}
+	cd | && grep printf 2>/dev/null -eu
+readonly local -eu --verbose
+		done --verbose cd then test "$@" --verbose 2>/dev/null done then ${HOME}
+		'quoted text' echo printf ${HOME} ${HOME} done awk then --verbose printf $(pwd)
+/usr/bin printf printf x=1 "$@" local $(pwd) "$1" local | echo
+		printf done echo 'quoted text' x=1 x=1 /usr/bin
+		then "$1" -eu local local done done
+		printf local | awk 2>/dev/null local cd export echo cd
+'quoted text' sed /usr/bin cd | 'quoted text' --verbose cd "$@" done grep /usr/bin
+		${HOME} && 'quoted text' "$@" /usr/bin --verbose cd -eu | --verbose
+	awk sed echo ${HOME} echo && then && then printf "$@"
+		${HOME} cd cd 2>/dev/null /usr/bin export 2>/dev/null
+		test /usr/bin cd "$@" echo $(pwd) /usr/bin "$1" ${HOME} "$@"
+		$(pwd) printf | 'quoted text' && sed local local local sed
+		'quoted text' $(pwd) sed "$@" && sed --verbose sed local done 2>/dev/null
+		grep cd local ${HOME} | readonly /usr/bin
+2>/dev/null "$@" "$@" cd ${HOME} done -eu $(pwd) /usr/bin cd x=1 local
+| cd $(pwd) -eu grep | /usr/bin
+test done --verbose done cd readonly cd printf grep then "$@" sed done
+awk local then "$@" "$1" $(pwd) x=1 ${HOME} awk done | then
+		$(pwd) sed local export $(pwd) --verbose cd 2>/dev/null cd echo --verbose then
+	${HOME} /usr/bin sed --verbose awk $(pwd) x=1
+		| printf done test "$1"
+		| --verbose readonly /usr/bin x=1 echo 'quoted text'
+	&& | && local ${HOME} local test sed grep
+"$@" awk export export local grep "$@" done --verbose printf cd $(pwd)
+	'quoted text' grep local cd local local test grep "$@" done sed then grep
+	&& 'quoted text' sed 'quoted text' "$1" && export --verbose sed /usr/bin echo
+		x=1 printf export $(pwd) --verbose local --verbose
+		${HOME} test 'quoted text' && | cd done /usr/bin
+	done grep ${HOME} echo
+	${HOME} "$1" --verbose awk "$1" 'quoted text' ${HOME} sed "$1" 2>/dev/null
+echo /usr/bin -eu test local grep printf printf then export
+	grep local cd sed "$@" export cd "$1" && then then then
+"$1" grep /usr/bin $(pwd) ${HOME} /usr/bin 'quoted text'
+		| cd done && then echo test "$@" 2>/dev/null
+		printf awk -eu x=1 2>/dev/null "$1" sed --verbose done x=1 printf | -eu printf
+		"$@" -eu --verbose test grep $(pwd) x=1 "$1" printf readonly
+	local then printf readonly cd x=1
+	cd -eu readonly 'quoted text' echo done grep "$@" x=1 export grep 2>/dev/null
+"$@" export export x=1 "$@" awk "$1" -eu ${HOME} sed then ${HOME} 'quoted text'
+	${HOME} then done | "$@" export cd done ${HOME}
+grep $(pwd) readonly done grep | 'quoted text' 'quoted text' $(pwd)
+| sed export test -eu && 'quoted text' local --verbose sed test export
+		/usr/bin printf ${HOME} -eu "$1" "$1" 'quoted text' done
+| awk local grep echo
+echo cd printf sed local $(pwd)
+grep "$@" cd /usr/bin then sed cd ${HOME}
+	${HOME} -eu local && then readonly $(pwd) "$1"
+test | -eu test x=1 printf
+	/usr/bin $(pwd) export -eu x=1 grep export 'quoted text' then cd then -eu
+	export x=1 then ${HOME} done 'quoted text' test awk x=1 export
+$(pwd) 'quoted text' done /usr/bin && then
+test printf "$1" /usr/bin "$@" echo
+		test 'quoted text' -eu /usr/bin /usr/bin export awk readonly /usr/bin
+	--verbose cd "$@" sed $(pwd) $(pwd) /usr/bin printf awk -eu /usr/bin
+		&& then sed local printf && awk
+	/usr/bin $(pwd) readonly then | x=1
+	x=1 "$@" then | /usr/bin ${HOME} "$@" printf && printf done -eu --verbose 2>/dev/null
+		export --verbose "$@" /usr/bin awk | awk /usr/bin 'quoted text' -eu
+	grep local && export | sed test local echo | sed grep &&
+export "$1" /usr/bin test then "$1" local && printf awk "$@"
+		done /usr/bin printf x=1 readonly
+	"$1" local "$@" --verbose local --verbose printf 2>/dev/null cd echo
+		-eu printf 2>/dev/null
+| -eu -eu readonly $(pwd) sed "$1" echo then | $(pwd) /usr/bin
+--verbose -eu 2>/dev/null --verbose 'quoted text'
+printf -eu 'quoted text' printf "$@" 'quoted text' test "$@" readonly
+&& x=1 test $(pwd) then done grep | printf
+test grep $(pwd) awk test
+cd then awk && grep cd -eu "$@" export
+	printf 'quoted text' local then --verbose "$@" $(pwd)
+	grep export done echo | grep --verbose "$@" && | /usr/bin 'quoted text'
+	2>/dev/null | "$1" then sed 'quoted text' test local x=1 grep local
+then | test awk readonly local readonly printf "$@" export
+cd 'quoted text' sed done echo grep then
+echo /usr/bin cd local cd 'quoted text' sed && 'quoted text' 2>/dev/null printf
+		grep sed export grep
+		grep grep awk x=1 --verbose export && $(pwd) grep ${HOME} cd $(pwd)
+		printf 'quoted text' && then readonly local echo grep "$@" then printf readonly
+local done then -eu done printf
+	${HOME} printf "$@" then grep sed "$@" x=1 "$1" grep
+		$(pwd) cd x=1 --verbose awk 2>/dev/null 2>/dev/null --verbose cd | --verbose
+		x=1 -eu && && awk then -eu done && 'quoted text'
+sed ${HOME} 'quoted text' cd 2>/dev/null ${HOME}
+-eu export x=1 --verbose 2>/dev/null readonly ${HOME}
+		$(pwd) test -eu grep -eu done cd printf /usr/bin grep grep $(pwd)
+	readonly "$@" echo export /usr/bin local -eu export $(pwd) && export
+then ${HOME} test awk printf | sed sed /usr/bin | printf readonly export
+	then x=1 /usr/bin $(pwd) 2>/dev/null x=1 -eu done ${HOME} -eu && printf export
+	"$1" "$1" echo printf grep
+sed readonly --verbose done export readonly
+	awk export then cd awk 'quoted text' | 2>/dev/null -eu grep cd grep -eu export
+		'quoted text' cd "$@" && x=1
+sed grep local && x=1 grep
+-eu && printf --verbose awk 'quoted text' ${HOME}
+echo && grep grep 'quoted text' sed awk $(pwd) -eu grep echo cd && echo
+printf && x=1 | readonly $(pwd) 'quoted text' awk readonly /usr/bin
+then | ${HOME} -eu local ${HOME} printf /usr/bin sed
+test test sed local readonly awk | -eu --verbose grep /usr/bin
+	/usr/bin local readonly
+--verbose 'quoted text' printf cd -eu sed readonly
+test x=1 then test x=1 local 'quoted text'
+		grep local x=1 2>/dev/null "$@" then "$1" export --verbose grep then x=1 cd ${HOME}
+	export test 2>/dev/null then ${HOME} "$1" | 'quoted text'
+	export ${HOME} 'quoted text' $(pwd) | sed printf export cd export &&
+--verbose echo then "$1" echo ${HOME}
+test local then --verbose
+		/usr/bin 'quoted text'
+	printf 'quoted text' readonly "$1" done awk /usr/bin
+&& grep 'quoted text' 2>/dev/null
+		grep grep printf && export | 'quoted text' "$@" | printf
+printf readonly --verbose cd && $(pwd) awk 'quoted text' echo echo 'quoted text'
+&& /usr/bin | && readonly grep printf grep && ${HOME} | done && $(pwd) $(pwd)
+		'quoted text' x=1 test ${HOME} readonly 2>/dev/null $(pwd)
+grep done "$@" ${HOME} && | awk 2>/dev/null && grep awk awk ${HOME} done &&
+		then cd "$@" echo | awk --verbose echo
+		"$@" -eu && done done cd test test grep local "$1" /usr/bin && cd
+${HOME} && readonly test x=1 grep /usr/bin sed
+		${HOME} 2>/dev/null echo grep awk echo $(pwd) grep cd /usr/bin 2>/dev/null
+cd $(pwd) awk -eu && $(pwd) echo | -eu $(pwd)
+		2>/dev/null 'quoted text' --verbose --verbose printf x=1 "$1" printf
+	sed then echo 2>/dev/null 'quoted text' 2>/dev/null --verbose && export | ${HOME}
+readonly grep sed --verbose -eu 'quoted text' cd then | awk --verbose then local
+		x=1 cd x=1 echo "$1" 'quoted text'
+	readonly done "$@" | $(pwd) local then "$@" "$1"
+grep cd echo test cd 'quoted text' grep 2>/dev/null printf grep $(pwd) export
+-eu x=1 x=1 echo sed echo x=1 -eu
+		&& grep readonly 'quoted text' -eu cd test grep awk awk
+	&& cd /usr/bin grep $(pwd) /usr/bin grep test
+'quoted text' 'quoted text' x=1 cd cd $(pwd)
+	'quoted text' $(pwd) then then && 'quoted text' "$@" cd $(pwd)
+		/usr/bin $(pwd) printf readonly then 'quoted text'
+x=1 /usr/bin /usr/bin -eu && sed readonly
+	&& grep 'quoted text' && sed echo | $(pwd) export $(pwd) printf echo
+		-eu ${HOME} "$1" grep -eu grep /usr/bin 'quoted text' /usr/bin readonly done
+-eu /usr/bin "$1" $(pwd) ${HOME} 'quoted text' -eu
+	grep ${HOME} local | echo -eu grep local
+	sed $(pwd) ${HOME} export /usr/bin $(pwd) echo x=1 -eu grep 2>/dev/null echo
+/usr/bin printf && then readonly -eu 2>/dev/null
+		'quoted text' -eu local && ${HOME} cd cd x=1 echo /usr/bin
+		test "$1" then printf done -eu /usr/bin | $(pwd) echo /usr/bin | "$1" /usr/bin
+"$1" echo export --verbose local
+	awk local 2>/dev/null --verbose
+		"$@" | awk echo -eu "$@" grep | "$1" awk done then cd 'quoted text'
+	${HOME} $(pwd) cd echo ${HOME} 2>/dev/null --verbose
+	printf 2>/dev/null "$@" 2>/dev/null then --verbose 2>/dev/null "$1"
+	local $(pwd) x=1 $(pwd) $(pwd) then ${HOME}
+	2>/dev/null --verbose "$1" x=1 2>/dev/null --verbose ${HOME}
+		&& readonly "$1" readonly echo sed sed printf "$1" echo local
+		export done export awk /usr/bin cd sed 'quoted text' && then export readonly
+	'quoted text' ${HOME} /usr/bin then test test $(pwd) printf test readonly
+${HOME} done awk readonly "$@" echo then export 2>/dev/null
+sed $(pwd) grep "$1" readonly x=1 cd test export
+awk local x=1 export grep
+		test echo local && then grep
+	awk 'quoted text' test then printf cd export echo readonly
+grep && test test 'quoted text' "$1" cd 'quoted text'
+	2>/dev/null && /usr/bin
+	'quoted text' 'quoted text' --verbose export test && export awk 'quoted text'
+		done --verbose --verbose && $(pwd) -eu awk echo grep $(pwd) export readonly grep
+export then local "$@" 2>/dev/null --verbose readonly ${HOME}
+echo /usr/bin && "$1"
+	$(pwd) test /usr/bin 2>/dev/null ${HOME} 'quoted text' "$@" local ${HOME}
+&& "$1" 'quoted text' cd echo echo grep
+${HOME} test --verbose $(pwd) export done printf cd sed local echo
+grep echo 'quoted text' local grep "$@" /usr/bin && awk --verbose
+	| -eu /usr/bin "$1" /usr/bin | awk 'quoted text'
+		| "$@" -eu awk grep "$1" -eu echo done
+	cd x=1 "$@" "$@" echo && "$1" --verbose grep 'quoted text'
+${HOME} --verbose export x=1 --verbose grep local grep x=1 awk
+	2>/dev/null done readonly ${HOME} grep
+		sed -eu "$1" x=1 grep readonly local 'quoted text' 'quoted text'
+	local --verbose test x=1 2>/dev/null
+		test && export export | test printf grep /usr/bin | export
+		test readonly local done sed ${HOME} test
+		printf printf sed cd grep readonly
+	echo printf readonly cd test "$1" cd && -eu $(pwd) done
+${HOME} sed echo grep $(pwd)
+"$@" test cd export sed --verbose test readonly "$1" local test
+	| "$@" awk readonly export echo && /usr/bin
+		| "$1" "$1" printf sed "$@" --verbose done cd grep --verbose && "$1" sed readonly
+	&& cd && x=1 --verbose x=1 x=1 done | local then
+		"$1" --verbose cd 2>/dev/null "$1" "$1"
+		then cd test ${HOME} then done test
+	${HOME} ${HOME} cd awk echo -eu "$@" printf ${HOME} "$1" x=1 "$@" x=1 /usr/bin
+	$(pwd) done export sed --verbose
+printf readonly --verbose
+&& local done | sed x=1 local
+		"$1" "$@" printf export ${HOME} "$1" grep readonly
+	--verbose done --verbose ${HOME} -eu then 2>/dev/null grep then sed
+export 'quoted text' x=1 then
+		awk printf x=1 x=1 $(pwd) test ${HOME} cd sed
+local ${HOME} ${HOME} echo test
+grep printf local echo awk sed readonly $(pwd) && readonly
+	echo grep ${HOME} echo | 'quoted text' "$1" /usr/bin awk
+	&& ${HOME} test --verbose $(pwd) printf /usr/bin $(pwd)
+		2>/dev/null sed 2>/dev/null done | --verbose local
+2>/dev/null "$@" readonly $(pwd) printf x=1 local local $(pwd)
+cd x=1 -eu printf export x=1 grep | ${HOME} export "$1" done export 2>/dev/null
+x=1 sed -eu readonly && -eu readonly echo $(pwd) then
+		-eu | "$1" then ${HOME} --verbose test echo then readonly test x=1 echo x=1 printf
+		grep && | 'quoted text' local test then sed export echo
+	2>/dev/null ${HOME} --verbose printf | grep -eu | then awk
+		$(pwd) test export --verbose $(pwd) readonly --verbose | ${HOME} done done
+		echo test -eu && awk 'quoted text' --verbose
+		/usr/bin echo "$@" "$@"
+readonly /usr/bin grep cd "$1" $(pwd)
+	&& then x=1 $(pwd) local "$@" awk sed "$1" "$@" printf --verbose local grep
+	-eu x=1 sed /usr/bin 'quoted text' readonly printf 'quoted text' awk grep
+awk grep 2>/dev/null "$@" $(pwd) && then test cd cd
+grep 2>/dev/null $(pwd) && 'quoted text'
+grep grep 'quoted text' readonly ${HOME} then
+--verbose x=1 "$@" ${HOME}
+/usr/bin -eu | then $(pwd) | local $(pwd) && "$1" awk $(pwd) export 2>/dev/null
+		local "$@" -eu 'quoted text' export sed local local /usr/bin
+	/usr/bin -eu echo "$@" cd "$@" printf
+		awk printf && 2>/dev/null grep | awk test
+		local export local 'quoted text' x=1 "$@" sed -eu 'quoted text'
+		"$@" 2>/dev/null local -eu && -eu |
+		'quoted text' export "$@" grep readonly 'quoted text' "$1" | &&
+		readonly awk export test export | done local && sed local test /usr/bin
+&& 2>/dev/null ${HOME} $(pwd) -eu done -eu awk
+--verbose cd /usr/bin /usr/bin done local "$@" sed 'quoted text'
+		"$@" awk $(pwd) awk export grep grep ${HOME} test $(pwd)
+	echo done export cd cd && "$1" "$@" readonly ${HOME} && --verbose readonly awk
+	printf printf x=1 2>/dev/null | printf grep test test done done grep "$@" sed -eu
+2>/dev/null 'quoted text' test sed -eu test --verbose --verbose | && cd
+	--verbose then | && 2>/dev/null
+		-eu 'quoted text' sed -eu "$@" 2>/dev/null
+awk sed printf "$1" cd -eu then 2>/dev/null
+		"$1" $(pwd) | -eu --verbose /usr/bin done 2>/dev/null echo 'quoted text'
+		x=1 --verbose awk echo test x=1 x=1 printf cd local grep -eu
+	grep $(pwd) readonly ${HOME} 2>/dev/null export "$@" /usr/bin
+	printf readonly cd printf sed 2>/dev/null printf x=1 "$1" grep | -eu
+-eu echo sed awk /usr/bin cd export "$1"
+	cd /usr/bin /usr/bin echo "$@" sed && echo test echo
+	"$1" "$@" 'quoted text' printf | "$@" echo 'quoted text' printf "$@" && printf
+	grep printf x=1 'quoted text' then done awk /usr/bin ${HOME}
+	awk printf | local "$1" "$@" "$@" "$@" $(pwd) -eu
+| && -eu /usr/bin done printf && echo done && test &&
+		${HOME} /usr/bin "$@" then echo then | | awk
+	--verbose | ${HOME} 'quoted text' "$1" /usr/bin awk cd "$1" && x=1 ${HOME} /usr/bin
+	awk /usr/bin readonly local
+-eu grep local then | ${HOME} "$@" | "$@" $(pwd) awk "$@" -eu --verbose export
+$(pwd) /usr/bin cd printf sed echo x=1 readonly
+awk && --verbose "$@" awk export | x=1 "$1" readonly grep
+then x=1 done | local printf printf then && ${HOME} done grep readonly
+	"$@" sed then "$@" printf && done test ${HOME} "$@"
+	test readonly $(pwd) awk then grep local
+-eu && | grep -eu $(pwd) done local readonly && done test export "$@" export
+	local 'quoted text' && 'quoted text' -eu && awk | $(pwd) done | printf echo /usr/bin
+echo test "$@" --verbose /usr/bin cd "$@" "$1" sed
+done then -eu local --verbose
+done "$1" local awk ${HOME} && local sed
+	/usr/bin --verbose local /usr/bin ${HOME} grep test test ${HOME}
+		echo export -eu /usr/bin printf 2>/dev/null $(pwd) echo 2>/dev/null
+		&& ${HOME} -eu x=1 cd export echo -eu --verbose && x=1 $(pwd)
+then done x=1 export test local then test x=1 printf
+| export cd | test printf /usr/bin "$@" && && then test -eu local grep x=1 test
+	/usr/bin 2>/dev/null ${HOME} local cd local echo sed "$@" 2>/dev/null
+export awk 2>/dev/null /usr/bin -eu readonly $(pwd) printf readonly | "$1" sed
+	--verbose && grep "$@" $(pwd) done $(pwd) | $(pwd) $(pwd) cd done
+done "$@" then | -eu -eu export ${HOME} x=1 cd local ${HOME} echo
+export echo awk 'quoted text' readonly --verbose grep "$1" export -eu
+	${HOME} sed grep | | done
+done && done test echo printf local ${HOME} local "$@" ${HOME}
+sed grep "$1" local readonly readonly $(pwd) grep "$@" 'quoted text'
+x=1 local | test 'quoted text' "$@" then grep sed local -eu
+		local test sed /usr/bin done local /usr/bin
+		local done done grep && "$@" /usr/bin test test export then readonly
+		${HOME} readonly done x=1 -eu done x=1 sed ${HOME}
+	echo 2>/dev/null "$@" && -eu --verbose cd | $(pwd) "$1" x=1 | x=1 -eu export
+"$1" local sed test --verbose 2>/dev/null
+${HOME} $(pwd) readonly echo 'quoted text' export $(pwd) x=1 cd done cd export
+	2>/dev/null "$1" export cd cd $(pwd) x=1 then readonly readonly
+		$(pwd) /usr/bin test x=1 cd "$@" readonly
+		${HOME} printf x=1 --verbose -eu echo -eu
+test 2>/dev/null "$@" "$@" x=1 local
+	"$@" echo printf cd $(pwd) grep
+then grep x=1 "$1" awk awk x=1 /usr/bin "$@"
+	/usr/bin "$@" --verbose "$@" 2>/dev/null echo done
+		done printf -eu readonly
+	awk "$1" test grep readonly sed local
+	'quoted text' cd "$1" | readonly --verbose local printf "$@" x=1 awk
+&& --verbose printf then "$1" test $(pwd) printf x=1 readonly
+done export sed $(pwd) test export "$1" awk
+		--verbose done echo local "$1" cd awk local done cd test local export
+| awk awk local printf x=1
+	export -eu -eu --verbose readonly local
+	export cd echo readonly | 2>/dev/null done "$@" cd "$@" export
+		awk export 'quoted text' ${HOME} && cd export
+		local -eu /usr/bin "$1" readonly then -eu awk test export $(pwd) printf readonly
+		'quoted text' awk 2>/dev/null
+		cd awk awk | --verbose local echo
+	--verbose printf printf test sed | local then 'quoted text'
+	cd --verbose && then test $(pwd) ${HOME} awk then
+		2>/dev/null --verbose readonly /usr/bin
+		printf --verbose $(pwd) "$@" grep export /usr/bin cd $(pwd) printf -eu /usr/bin
+		printf sed && 2>/dev/null
+		export then awk && "$@" "$@" cd echo
+		--verbose $(pwd) grep printf | ${HOME} 2>/dev/null grep export
+	grep "$1" 'quoted text' then /usr/bin ${HOME} $(pwd) done
+		printf /usr/bin export
+		-eu /usr/bin /usr/bin local | ${HOME} "$@" "$1" then 2>/dev/null -eu
+sed 2>/dev/null $(pwd) then | ${HOME} cd x=1 && --verbose awk 2>/dev/null
+readonly -eu local x=1 sed then printf then printf local /usr/bin -eu awk
+export -eu 'quoted text' 'quoted text'
+		--verbose x=1 x=1 local then local "$1" | "$1" -eu "$@" done grep 'quoted text'
+	awk test x=1 /usr/bin echo -eu awk $(pwd) && /usr/bin printf readonly
+		&& test && cd done readonly export printf -eu export then test 2>/dev/null
+	then cd ${HOME} && grep --verbose done export x=1 | --verbose echo readonly
+	-eu export x=1 done ${HOME} "$1"
+	$(pwd) "$@" echo echo done -eu cd grep
+'quoted text' awk "$@" then -eu awk --verbose readonly "$1" x=1 done 2>/dev/null
+/usr/bin then readonly printf "$@" "$1" ${HOME} -eu -eu --verbose
+		"$1" -eu grep 2>/dev/null echo -eu ${HOME} grep then | export local local 2>/dev/null
+	x=1 2>/dev/null $(pwd) test local sed
+$(pwd) "$@" 'quoted text'
+	sed "$@" test grep "$@" grep --verbose | 2>/dev/null
+		test "$@" test $(pwd) grep -eu ${HOME} done --verbose /usr/bin sed
+		/usr/bin test | | | awk $(pwd)
+		awk $(pwd) x=1 export $(pwd) done $(pwd)
+	done 'quoted text' readonly cd then awk done then "$@" "$1" /usr/bin export 'quoted text'
+		&& "$1" done sed /usr/bin --verbose x=1 /usr/bin |
+		x=1 "$@" grep "$1" "$1" awk sed /usr/bin cd | 2>/dev/null ${HOME} -eu "$@"
+/usr/bin -eu | printf /usr/bin "$@" test && 2>/dev/null
+		"$1" awk cd -eu test test printf --verbose /usr/bin x=1 echo
+grep sed echo printf done $(pwd) "$1" ${HOME} export $(pwd)
+		done "$@" then | -eu test sed readonly --verbose printf x=1 sed done ${HOME}
+--verbose /usr/bin ${HOME} sed test "$@" 'quoted text'
+		cd cd 'quoted text' "$1"
+	/usr/bin "$@" | 'quoted text' /usr/bin
+		readonly /usr/bin $(pwd) cd $(pwd) /usr/bin | printf test ${HOME} 2>/dev/null
+		printf x=1 local awk local grep
+cd then sed | grep cd x=1 test awk export 'quoted text' test
+&& awk done sed $(pwd) x=1
+	'quoted text' 2>/dev/null local 2>/dev/null echo
+	x=1 grep test test x=1 readonly test $(pwd) /usr/bin local done local $(pwd) &&
+printf ${HOME} cd "$1" sed done
+/usr/bin "$@" readonly --verbose done x=1 x=1 'quoted text' | then
+	echo readonly ${HOME} export printf done awk --verbose readonly
+		cd done printf $(pwd) awk grep
+	/usr/bin && printf local printf "$1" then awk sed && readonly cd | -eu && sed -eu
+		done test export 'quoted text' sed "$@" 2>/dev/null && --verbose test &&
+	awk echo ${HOME} $(pwd) -eu awk
+	&& grep sed "$@" /usr/bin
+	&& ${HOME} printf /usr/bin "$1" /usr/bin /usr/bin $(pwd) export awk "$1" 'quoted text'
+x=1 done printf --verbose grep $(pwd) /usr/bin export
+		2>/dev/null --verbose ${HOME} ${HOME} done readonly x=1 local export
+		--verbose && "$1" -eu -eu && grep x=1 echo awk test awk 'quoted text'
+		awk done --verbose sed grep sed awk -eu awk -eu echo printf $(pwd) 2>/dev/null
+	-eu sed x=1 printf grep x=1 ${HOME} x=1 | | test readonly
+	export && test printf && local awk | --verbose /usr/bin 'quoted text' test awk
+cd export cd sed printf ${HOME} done -eu
+		| "$@" --verbose export
+	echo -eu grep echo cd 2>/dev/null 'quoted text'
+'quoted text' "$1" export 'quoted text'
+	local export then local local -eu done --verbose /usr/bin
+		| awk "$@" export $(pwd) x=1 local sed "$@" printf $(pwd) echo
+		"$1" awk sed ${HOME} /usr/bin printf && 'quoted text'
+"$1" -eu | $(pwd) && | $(pwd) "$@" then -eu 2>/dev/null $(pwd)
+		readonly 'quoted text' -eu awk readonly
+		/usr/bin printf --verbose done && then "$@"
+	readonly 'quoted text' x=1 && "$@" grep test then
+		awk -eu ${HOME} 'quoted text' x=1 ${HOME} | /usr/bin
+		'quoted text' x=1 printf then echo echo | 2>/dev/null
+		/usr/bin /usr/bin then 2>/dev/null done cd echo
+	"$@" | export && "$@" $(pwd) awk 'quoted text' echo test /usr/bin $(pwd) | 'quoted text'
+awk cd | ${HOME} printf cd grep "$1" readonly 2>/dev/null
+	readonly done printf 'quoted text' then 2>/dev/null export done grep $(pwd) local
+2>/dev/null "$1" done printf
+	readonly export | sed 2>/dev/null
+printf /usr/bin cd grep printf export export 2>/dev/null 'quoted text' echo
+readonly x=1 printf export $(pwd) grep local "$1"
+$(pwd) -eu --verbose --verbose then 2>/dev/null /usr/bin --verbose
+		export --verbose readonly 'quoted text' --verbose
+	'quoted text' "$1" 2>/dev/null
+	'quoted text' && echo cd $(pwd) then "$@"
+	sed "$@" sed 'quoted text' ${HOME} export sed
+	done x=1 then && grep local -eu
+	readonly "$1" $(pwd) && sed awk local && 2>/dev/null 2>/dev/null
+test done x=1 test --verbose cd ${HOME} "$@" "$1" --verbose awk sed echo awk
+"$@" $(pwd) export cd then -eu && echo
+	$(pwd) grep local awk cd readonly
+		2>/dev/null "$@" printf awk cd $(pwd) readonly test readonly done
+'quoted text' export ${HOME} 'quoted text' echo $(pwd) --verbose
+	grep cd cd ${HOME} /usr/bin local ${HOME} "$@" $(pwd) "$@" test grep awk "$@" &&
+		&& /usr/bin 2>/dev/null sed 2>/dev/null "$1" then "$1" -eu
+		local export export sed
+	done printf awk readonly readonly sed | export
+	then awk cd printf cd $(pwd) --verbose --verbose 2>/dev/null
+	then 'quoted text' ${HOME} awk "$@"
+	export | sed --verbose sed x=1 | "$@" $(pwd) cd 'quoted text' grep done printf
+--verbose awk readonly x=1 local 2>/dev/null
+then readonly cd export $(pwd) "$1" export /usr/bin printf | awk
+	echo ${HOME} $(pwd) printf
+	&& printf x=1 export && printf /usr/bin $(pwd) cd x=1 done test --verbose
+	sed "$1" export test x=1 done 'quoted text' echo
+	done ${HOME} local cd 2>/dev/null cd "$1" test export awk -eu "$@" grep x=1 "$@"
+cd done readonly "$@" grep ${HOME} grep 'quoted text'
+		grep "$@" local sed --verbose
+echo test export -eu $(pwd) && sed test "$@"
+sed "$@" $(pwd) /usr/bin local sed x=1 grep done
+		readonly && 'quoted text' "$@" /usr/bin -eu &&
+	export $(pwd) 2>/dev/null --verbose ${HOME} readonly "$1" | -eu echo |
+"$1" test test printf grep done 'quoted text'
+		test awk test "$1" awk done
+	readonly echo 2>/dev/null grep awk $(pwd) printf ${HOME}
+	readonly sed ${HOME} grep
+awk --verbose printf /usr/bin local
+"$@" x=1 then printf export awk then readonly 2>/dev/null
+	export | test x=1 local awk && /usr/bin ${HOME}
+		| sed -eu && 'quoted text' 'quoted text'
+		readonly x=1 "$@" /usr/bin 2>/dev/null awk $(pwd) local readonly
+	done "$@" "$1" "$@" awk "$1" sed awk && export
+2>/dev/null && "$1" echo | -eu ${HOME} printf && $(pwd) x=1 ${HOME} "$1" ${HOME}
+	| "$@" 2>/dev/null awk readonly then cd --verbose
+		$(pwd) test /usr/bin then readonly printf x=1 done $(pwd) "$1" done cd "$@"
+local "$@" then printf printf $(pwd) then awk 2>/dev/null done
+grep "$1" $(pwd) x=1 /usr/bin $(pwd) x=1 $(pwd) readonly
+	--verbose sed test -eu ${HOME} cd then ${HOME} $(pwd) readonly 2>/dev/null
+printf ${HOME} done readonly 'quoted text' cd cd && readonly sed printf |
+sed 2>/dev/null x=1 --verbose done test
+		echo $(pwd) x=1 x=1 readonly 'quoted text' done echo --verbose 2>/dev/null
+		done sed && 2>/dev/null 2>/dev/null echo test then grep
+		-eu export 2>/dev/null --verbose
+		$(pwd) | done --verbose $(pwd) && $(pwd)
+&& /usr/bin grep $(pwd) done printf cd 'quoted text' grep
+sed then $(pwd) "$@" | $(pwd) printf readonly sed test "$1"
+awk | done local readonly "$@" then grep sed test test
+${HOME} && sed --verbose readonly done test sed export --verbose
+		${HOME} -eu --verbose echo local test cd sed ${HOME} 2>/dev/null cd -eu test then
+test sed 'quoted text' cd $(pwd) x=1 "$@" "$1" grep
+	-eu x=1 && | --verbose test grep $(pwd) && grep done sed sed /usr/bin | local
+	sed | "$1" export local printf echo local awk "$1" x=1
+&& then "$@" printf ${HOME} "$@" sed sed export 2>/dev/null && 2>/dev/null
+test ${HOME} -eu echo local ${HOME} "$@"
+	'quoted text' $(pwd) --verbose cd 'quoted text' $(pwd) test && printf
+	$(pwd) sed && printf && 'quoted text' ${HOME} ${HOME} done
+	readonly then | x=1 done cd "$@"
+	2>/dev/null sed grep ${HOME} awk "$1" && done awk export && echo export $(pwd) 2>/dev/null
+		then ${HOME} x=1 && awk then test
+cd export && --verbose ${HOME} "$1" test sed sed cd $(pwd) done $(pwd) done
+--verbose readonly /usr/bin && export
+		test 'quoted text' 'quoted text'
+		echo local ${HOME} sed "$1" sed $(pwd) /usr/bin 'quoted text' readonly 2>/dev/null
+	"$@" printf $(pwd) 'quoted text' test /usr/bin
+		grep x=1 local 'quoted text' "$@" grep test printf
+	test readonly ${HOME} /usr/bin
+done sed ${HOME} printf && sed -eu /usr/bin local $(pwd) printf awk then
+	| readonly done then
+| | printf cd test ${HOME} sed
+		echo printf $(pwd) x=1 cd cd ${HOME} local
+	cd test export 'quoted text' readonly -eu "$1" sed 'quoted text'
+		then grep grep "$@" "$@" readonly "$@"
+		"$1" test readonly readonly
+		${HOME} "$1" --verbose -eu 'quoted text'
+		grep export sed sed "$1" sed "$1" "$1" $(pwd)
+	awk | readonly 2>/dev/null
+		echo cd x=1 printf /usr/bin --verbose awk
+		&& cd "$@" local echo "$@" local --verbose echo
+		awk ${HOME} /usr/bin | "$@" "$@" then cd "$1" done && ${HOME} then "$@" printf 2>/dev/null
+	2>/dev/null && -eu sed "$@" | 2>/dev/null 'quoted text' awk --verbose
+		sed cd "$1" ${HOME} printf then local done "$@" then
+	cd 2>/dev/null grep &&
+		$(pwd) x=1 $(pwd) test 2>/dev/null
+		${HOME} -eu | printf "$1" "$@" | export ${HOME} 'quoted text'
+'quoted text' && "$@" /usr/bin "$@" sed 2>/dev/null
+awk grep echo -eu cd local && | "$1" done readonly printf --verbose
+	x=1 done export grep "$1" 2>/dev/null $(pwd)
+	2>/dev/null && done grep x=1 grep export x=1 printf printf sed echo /usr/bin
+		awk -eu $(pwd) "$@" 'quoted text' &&
+		echo grep --verbose grep readonly && | done "$1" "$1" echo readonly | printf
+		&& $(pwd) echo /usr/bin printf --verbose printf && && "$1" sed printf ${HOME} 2>/dev/null
+	$(pwd) awk | cd 2>/dev/null
+		x=1 'quoted text' done /usr/bin
+	test cd 2>/dev/null awk cd
+	"$@" echo --verbose --verbose
+--verbose local -eu local -eu then | $(pwd) grep awk awk "$1" done $(pwd)
+'quoted text' | | $(pwd) readonly
+		x=1 then readonly $(pwd)
+	test done awk 2>/dev/null then
+	"$1" -eu then test "$@" echo
+	awk local test 2>/dev/null
+/usr/bin sed readonly test readonly
+-eu cd "$@" -eu /usr/bin done "$1" /usr/bin sed cd grep sed sed cd x=1
+${HOME} "$@" 'quoted text' "$@" -eu readonly echo done --verbose
+	awk "$1" "$1" 2>/dev/null | export "$@" 'quoted text'
+2>/dev/null done "$1" test grep /usr/bin printf "$@" 2>/dev/null then test
+		readonly cd ${HOME} | sed 'quoted text' --verbose
+		$(pwd) | cd --verbose sed readonly cd echo
+export --verbose | then ${HOME} local readonly 'quoted text' export "$1" 2>/dev/null
+		$(pwd) /usr/bin /usr/bin $(pwd) 'quoted text' x=1 export readonly
+		local echo $(pwd) 'quoted text' done "$1" 'quoted text' --verbose
+		--verbose "$@" ${HOME} 'quoted text' cd -eu done awk
+		| readonly awk printf "$1" then $(pwd) $(pwd) local printf 2>/dev/null
+		&& 'quoted text' sed "$@"
+local local grep sed done 2>/dev/null done printf done && $(pwd) $(pwd)
+		export "$@" "$@" cd echo -eu && --verbose | -eu -eu && 2>/dev/null
+		| /usr/bin | /usr/bin grep /usr/bin /usr/bin
+export sed ${HOME} then grep awk ${HOME} echo cd 2>/dev/null
+--verbose 'quoted text' awk "$@" done && x=1
+done readonly "$@" done sed && 2>/dev/null "$@" --verbose 2>/dev/null
+		"$1" 'quoted text' grep done 'quoted text'
+--verbose | x=1 'quoted text' readonly printf 'quoted text'
+"$1" /usr/bin done && export readonly $(pwd) echo -eu ${HOME} /usr/bin
+x=1 grep done "$@" sed x=1 /usr/bin --verbose grep
+	test 2>/dev/null --verbose export sed cd 'quoted text' 'quoted text'
+		sed "$@" | "$@" $(pwd) --verbose done echo "$1" done && echo
+		"$@" export $(pwd) --verbose && $(pwd) awk 2>/dev/null readonly
+	$(pwd) 'quoted text' done -eu --verbose 'quoted text' | && -eu x=1
+	echo /usr/bin x=1 && then 'quoted text'
+	grep $(pwd) test done echo && "$1" -eu
+-eu grep --verbose -eu && test -eu "$1" printf cd x=1 printf awk && then /usr/bin
+	/usr/bin sed echo /usr/bin awk export test
+"$@" $(pwd) awk x=1 readonly && local done "$@" "$@"
+	x=1 $(pwd) grep printf test --verbose done ${HOME} export done cd
+	then readonly sed 2>/dev/null && 2>/dev/null "$@" grep sed /usr/bin grep printf
+		readonly "$1" /usr/bin "$@" then sed -eu awk local readonly
+		--verbose echo export test awk export grep "$@" readonly echo
+		${HOME} printf && export grep $(pwd)
+grep echo "$@" done echo 'quoted text' echo 'quoted text' awk
+	grep readonly sed done then then cd $(pwd) printf echo x=1 printf
+"$1" printf "$@" then local then grep 2>/dev/null
+$(pwd) done ${HOME} 'quoted text' "$1" local printf printf then readonly sed echo
+		/usr/bin echo grep "$@" /usr/bin local 2>/dev/null
+	$(pwd) readonly grep | local sed && x=1 cd cd
+		| sed /usr/bin $(pwd) sed && cd && --verbose 2>/dev/null
+2>/dev/null ${HOME} test && then | local then grep test -eu echo
+	printf "$@" 2>/dev/null "$@" readonly $(pwd)
+	-eu test ${HOME} "$@" -eu export test $(pwd) test $(pwd)
+		export then ${HOME} done local
+sed echo local done echo && |
+-eu readonly test --verbose
+'quoted text' echo printf | then "$@" test 2>/dev/null
+done export sed sed local echo /usr/bin
+	grep /usr/bin cd awk test printf "$@" 'quoted text'
+"$1" $(pwd) readonly | && sed && printf local
+"$1" 'quoted text' -eu then sed export
+	$(pwd) echo then 2>/dev/null $(pwd)
+	"$1" done test export /usr/bin done
+/usr/bin cd then readonly test sed cd && -eu export awk /usr/bin test
+	'quoted text' && "$@" --verbose "$@" --verbose sed readonly 'quoted text'
+	x=1 grep -eu 'quoted text' grep $(pwd) 2>/dev/null printf
+	-eu awk export then export $(pwd) 'quoted text' 2>/dev/null then
+done x=1 local | 2>/dev/null then export ${HOME} --verbose ${HOME}
+	export local done x=1 -eu "$1" -eu sed export
+		"$@" grep /usr/bin /usr/bin
+		awk readonly done sed local
+	/usr/bin /usr/bin test sed grep then local test export "$1" ${HOME} echo | &&
+	echo cd "$1" echo local "$1" readonly
+&& printf local sed "$1" $(pwd)
+		/usr/bin ${HOME} local /usr/bin "$1"
+awk export --verbose "$1"
+		2>/dev/null then 'quoted text' export awk $(pwd) cd test sed "$@" then --verbose
+	$(pwd) done awk grep $(pwd) then "$@" test echo
+		readonly 'quoted text' cd /usr/bin /usr/bin local x=1 ${HOME}
+		sed local sed printf echo grep 'quoted text' "$1"
+	local sed done 'quoted text' done
+	export then -eu test
+	then done x=1 grep --verbose grep x=1 then --verbose
+	local && 'quoted text' /usr/bin --verbose
+"$1" then "$1" | 2>/dev/null sed -eu /usr/bin sed printf && cd cd local then
+		$(pwd) 2>/dev/null ${HOME} --verbose
+-eu echo /usr/bin "$1" local grep "$@" 2>/dev/null /usr/bin
+	"$@" echo then printf -eu grep test
+		| then | 2>/dev/null local "$@" --verbose /usr/bin local awk "$@" -eu
+printf echo then "$1" printf test /usr/bin && 2>/dev/null /usr/bin
+		cd /usr/bin export printf | -eu then readonly
+"$@" then done sed then echo done grep export echo
+	sed printf sed "$@" awk then "$1" local
+	echo cd $(pwd) --verbose local && local $(pwd) x=1 echo local
+		$(pwd) sed | grep 2>/dev/null ${HOME} "$1" sed
+	readonly export ${HOME} readonly readonly readonly -eu test | sed x=1 export
+#include c182.sh
+		-eu --verbose grep --verbose printf test sed grep 'quoted text' awk
+test grep "$1" done echo readonly -eu test grep cd then $(pwd) 2>/dev/null
+	2>/dev/null "$@" "$1" --verbose ${HOME} done /usr/bin grep $(pwd) && $(pwd)
+	$(pwd) local 2>/dev/null 2>/dev/null sed "$1" sed "$@" && test done readonly
+'quoted text' ${HOME} then
+	| -eu awk && ${HOME} -eu printf --verbose 2>/dev/null
+test --verbose 2>/dev/null sed readonly x=1 export | cd -eu test ${HOME}
+		${HOME} --verbose echo local done cd export export then -eu
+	printf && export readonly export "$@" |
+	-eu export | --verbose awk /usr/bin $(pwd) grep --verbose cd | /usr/bin sed 'quoted text'
+${HOME} export | cd x=1 readonly echo "$@" "$1" 'quoted text' $(pwd)
+		done then "$@" 2>/dev/null -eu echo cd done
+printf /usr/bin local cd -eu -eu ${HOME} --verbose
+	cd x=1 "$@" x=1 x=1 x=1 x=1 done 2>/dev/null x=1 2>/dev/null test --verbose
+	--verbose $(pwd) then --verbose && done 2>/dev/null
+		x=1 sed "$@" readonly "$@" cd echo "$@" test "$@" echo export && ${HOME}
+	--verbose x=1 -eu 2>/dev/null
+export grep --verbose printf grep awk x=1 awk export --verbose
+	then --verbose -eu x=1 -eu /usr/bin grep $(pwd) echo done readonly | readonly
+		2>/dev/null done awk printf /usr/bin then x=1 --verbose grep 'quoted text'
+2>/dev/null $(pwd) x=1 | "$1" && ${HOME} "$@" /usr/bin
+/usr/bin ${HOME} "$1" grep then
+	cd readonly ${HOME} -eu awk then readonly cd test echo done 2>/dev/null -eu echo
+		echo 2>/dev/null 2>/dev/null
+-eu | ${HOME} printf test && sed grep "$1" && echo local
+	sed -eu $(pwd) | ${HOME} && sed "$1" echo test
+x=1 && cd | cd echo 2>/dev/null readonly
+		local "$1" -eu "$@" readonly awk
+		${HOME} test local local
+		--verbose $(pwd) -eu grep awk | -eu 2>/dev/null
+	"$1" echo /usr/bin 'quoted text' ${HOME} | local readonly readonly
+		'quoted text' then $(pwd) printf test 'quoted text' |
+		| readonly then awk then -eu local "$@" -eu cd sed && local then ${HOME}
+		2>/dev/null cd ${HOME} printf grep | ${HOME}
+	-eu awk x=1 ${HOME} export export test then
+	| | then cd | --verbose --verbose -eu | test export && printf printf x=1 then
+	2>/dev/null echo && awk | test x=1 | $(pwd)
+	local "$@" readonly /usr/bin /usr/bin
+export | && sed $(pwd) && -eu /usr/bin readonly x=1 | x=1 | grep
+	export ${HOME} 2>/dev/null "$@" then printf /usr/bin
+	export sed -eu readonly test
+then then local && readonly sed sed ${HOME} $(pwd) then 'quoted text'
+		${HOME} test export 'quoted text' printf done $(pwd) 2>/dev/null
+export x=1 cd then | done awk readonly | test --verbose
+		test cd && local export -eu x=1 grep
+		"$1" /usr/bin /usr/bin | /usr/bin /usr/bin
+	$(pwd) grep $(pwd) test x=1 echo $(pwd) readonly && -eu
+then then then then && && readonly "$1" export local
+-eu awk | printf awk -eu echo cd && test | /usr/bin
+	${HOME} 'quoted text' done -eu "$1" printf
+	"$1" export export readonly
+		x=1 test grep 2>/dev/null
+${HOME} sed done 2>/dev/null sed then then "$1" local awk awk x=1
+		export printf --verbose export readonly
+cd && -eu $(pwd) echo awk /usr/bin 2>/dev/null readonly
+		&& echo --verbose sed | sed sed echo "$1" test "$@" && readonly
+	'quoted text' /usr/bin echo "$1" -eu readonly 2>/dev/null cd
+	'quoted text' "$@" awk grep x=1 sed
+		grep done x=1 grep local "$1" local printf && | --verbose -eu ${HOME}
+&& 'quoted text' done 2>/dev/null
+	printf sed ${HOME} export "$@" cd
+		x=1 done ${HOME} grep /usr/bin done readonly printf
+	&& test grep $(pwd) test x=1 test then -eu | --verbose done 'quoted text' readonly
+	echo "$1" 'quoted text' $(pwd) "$1" then 2>/dev/null export && test test
+	--verbose sed then && local printf done 'quoted text' /usr/bin
+	$(pwd) "$@" "$1" then readonly
+readonly cd 'quoted text' echo /usr/bin grep -eu sed
+	x=1 2>/dev/null "$@" | export
+		grep "$1" | awk $(pwd)
+	"$1" 2>/dev/null sed x=1 grep grep && local $(pwd) printf export
+		grep $(pwd) cd $(pwd) echo readonly -eu |
+	2>/dev/null ${HOME} echo awk && -eu "$@" test echo | test 'quoted text'
+	x=1 | grep export cd $(pwd) done x=1 'quoted text' x=1 "$1" -eu
+-eu --verbose grep echo "$1" -eu /usr/bin | printf export
+"$1" then | echo $(pwd) 'quoted text' awk $(pwd) echo printf done grep awk
+$(pwd) x=1 readonly "$1" test ${HOME} --verbose
+local 'quoted text' 'quoted text' export && "$1" done "$@" grep
+	"$1" sed printf export awk cd "$@" "$@" -eu test awk local | x=1 --verbose
+		done 'quoted text' sed 'quoted text' "$1"
+${HOME} cd ${HOME} grep grep
+		done done 'quoted text' local "$1" then
+	$(pwd) done sed --verbose $(pwd)
+	x=1 grep grep "$1" test readonly && && | 2>/dev/null | export readonly
+		cd then /usr/bin then done
+		| && 2>/dev/null /usr/bin grep readonly
+	${HOME} ${HOME} test && export readonly awk test
+		printf sed cd readonly sed 2>/dev/null then readonly | --verbose grep $(pwd) printf
+/usr/bin -eu 'quoted text' /usr/bin local
+--verbose readonly sed && 2>/dev/null
+$(pwd) "$@" grep | printf
+	"$1" echo printf export /usr/bin then ${HOME} --verbose -eu
+2>/dev/null $(pwd) --verbose awk 'quoted text' test x=1 2>/dev/null
+	export test | && sed && -eu sed --verbose ${HOME}
+sed test 'quoted text' $(pwd) export
+$(pwd) export awk awk done done /usr/bin --verbose 2>/dev/null
+2>/dev/null -eu "$1" -eu export readonly ${HOME} cd printf
+	-eu echo "$@" "$1" x=1 "$@" $(pwd) readonly 'quoted text'
+	printf printf echo "$@" --verbose echo awk
+		2>/dev/null printf grep local local awk $(pwd) readonly cd done
+	local then -eu 2>/dev/null cd readonly "$@" "$@" 'quoted text' then && readonly
+		cd readonly awk --verbose 'quoted text'
+&& x=1 2>/dev/null /usr/bin
+		then "$@" "$1" then echo
+		$(pwd) /usr/bin && sed --verbose /usr/bin awk readonly
+	sed done | sed "$@" "$1" readonly
+test $(pwd) /usr/bin then 'quoted text' readonly -eu sed cd ${HOME} "$1"
+		echo readonly /usr/bin awk done then done
+	'quoted text' -eu local readonly --verbose readonly x=1 done
+		readonly then export test | awk readonly done printf
+	x=1 "$@" "$@" sed 2>/dev/null --verbose ${HOME} /usr/bin 'quoted text' "$@" 2>/dev/null
+		printf grep echo 'quoted text' | then local x=1 sed export "$@" "$@"
+		--verbose readonly && test ${HOME} --verbose "$@" local echo
+"$@" awk /usr/bin sed --verbose then /usr/bin ${HOME} | $(pwd) |
+		readonly 'quoted text' "$@" grep "$1" awk x=1 printf
+		$(pwd) then local awk grep then printf then test -eu export readonly
+		test && x=1 2>/dev/null done
+		export "$@" then -eu -eu /usr/bin "$@" then awk local local
+'quoted text' export 'quoted text' ${HOME} export then test export awk 2>/dev/null
+		'quoted text' echo printf $(pwd) "$@" "$@"
+local then then $(pwd) test /usr/bin /usr/bin then && ${HOME}
+		"$1" printf 2>/dev/null "$@" local -eu awk 2>/dev/null local --verbose
+		x=1 awk -eu cd "$@" --verbose 'quoted text' x=1 && printf sed |
+		test readonly readonly -eu cd printf /usr/bin 'quoted text'
+--verbose "$1" sed | grep local | done
+	printf -eu "$1" 'quoted text' /usr/bin $(pwd) -eu echo "$@" --verbose -eu
+echo -eu readonly printf awk | then cd done | echo readonly && export printf cd
+		"$1" /usr/bin ${HOME} awk 2>/dev/null local printf --verbose test -eu -eu ${HOME}
+"$1" ${HOME} local 'quoted text'
+		readonly printf local local printf $(pwd) then sed readonly
+sed cd awk awk "$1" ${HOME} done 2>/dev/null grep ${HOME} "$1" echo test
+	test x=1 2>/dev/null | "$@" $(pwd) local $(pwd) "$@" printf 2>/dev/null local
+readonly then printf test "$@" 'quoted text' export | then
+	2>/dev/null "$@" export "$@" awk printf 2>/dev/null export && awk readonly
+		--verbose cd 2>/dev/null export --verbose /usr/bin readonly "$@" sed ${HOME}
+&& awk "$1" | done grep /usr/bin 2>/dev/null grep x=1 2>/dev/null readonly
+		&& echo readonly | then sed then 'quoted text' export test
+	/usr/bin 'quoted text' 'quoted text' ${HOME} cd sed "$1" 'quoted text'
+		$(pwd) echo printf 2>/dev/null -eu test echo export -eu done then /usr/bin
+	then sed local --verbose $(pwd) && test | cd $(pwd)
+	--verbose | done --verbose
+awk grep sed && test awk local ${HOME} done grep -eu sed && awk -eu $(pwd) awk sed
+"$@" cd export 2>/dev/null "$@" "$@" then /usr/bin export | local
+	export 2>/dev/null "$1" grep grep 2>/dev/null ${HOME} sed /usr/bin
+-eu | awk readonly awk /usr/bin -eu && test $(pwd) "$@" sed x=1 x=1 test ${HOME}
+	printf readonly then | done ${HOME} && printf | export --verbose -eu ${HOME}
+	| 'quoted text' $(pwd) then sed "$1" sed 'quoted text' then --verbose | 'quoted text'
+	echo test export && && --verbose
+	--verbose local -eu -eu 2>/dev/null /usr/bin echo x=1 "$@" printf printf
+--verbose /usr/bin local local printf x=1 grep echo then "$1" local
+grep sed x=1 echo done sed ${HOME} printf 2>/dev/null cd done
+		grep sed | 2>/dev/null && local local cd echo printf echo | ${HOME}
+then /usr/bin "$1" -eu --verbose printf export 2>/dev/null local then $(pwd)
+done -eu "$1" local grep local awk echo
+	/usr/bin x=1 'quoted text' && /usr/bin 'quoted text' grep -eu awk && $(pwd) --verbose
+		awk readonly printf "$1" $(pwd) | 2>/dev/null
+	grep test x=1 done ${HOME} -eu 'quoted text' | awk cd $(pwd)
+grep readonly && 'quoted text' done test && ${HOME}
+${HOME} | "$@" awk 'quoted text' grep 2>/dev/null done sed
+&& then --verbose then then "$1" --verbose test /usr/bin /usr/bin $(pwd)
+	${HOME} ${HOME} echo $(pwd) done test cd sed echo | $(pwd)
+$(pwd) then grep printf
+$(pwd) 'quoted text' --verbose -eu grep
+	x=1 awk 'quoted text' sed /usr/bin "$1" printf done readonly sed 2>/dev/null
+| test local -eu -eu /usr/bin "$1" export done -eu then local export "$@" done
+cd $(pwd) "$1" "$1" test "$1" cd local x=1 done echo -eu 'quoted text'
+${HOME} readonly 2>/dev/null export -eu done test
+	local | local local echo -eu "$@" done x=1 ${HOME}
+		grep | $(pwd) ${HOME} export ${HOME}
+	sed then awk awk awk then -eu test cd done awk
+	cd readonly && 'quoted text' export
+		test ${HOME} | echo 'quoted text' sed
+	"$@" "$1" local done -eu grep
+		sed local printf $(pwd) echo 2>/dev/null echo local --verbose cd echo /usr/bin
+		cd echo "$1" $(pwd) ${HOME} "$1" awk grep
+$(pwd) then printf grep -eu --verbose awk readonly 2>/dev/null -eu echo
+grep awk x=1 'quoted text' then done "$@" "$1" "$1" -eu /usr/bin | 'quoted text'
+		echo 'quoted text' "$1" "$1" "$@" ${HOME} 2>/dev/null -eu echo awk "$1" &&
+		&& awk readonly 2>/dev/null $(pwd) readonly awk $(pwd) then grep
+		then 2>/dev/null 2>/dev/null
+	| "$1" then local grep /usr/bin
+		cd local echo test $(pwd) 'quoted text' test echo | done --verbose then
+	'quoted text' readonly | 2>/dev/null printf 'quoted text'
+	done 2>/dev/null x=1 "$@" 'quoted text' export test echo grep export cd
+grep /usr/bin local sed test awk x=1 then --verbose export then
+| x=1 awk printf 2>/dev/null 'quoted text' $(pwd)
+		| $(pwd) sed readonly | cd sed readonly
+		readonly $(pwd) local local x=1 | 'quoted text' cd $(pwd) awk 'quoted text' then
+grep sed grep grep "$@" x=1 test 'quoted text' readonly --verbose echo $(pwd) -eu
+	x=1 "$@" /usr/bin echo "$1" "$1" readonly ${HOME} x=1 test ${HOME}
+		then && printf && "$1" cd | test ${HOME} | -eu export sed cd && awk "$1" cd
+	${HOME} awk export grep export && export printf -eu test
+		| "$@" cd 2>/dev/null awk export grep
+export -eu --verbose $(pwd) test /usr/bin echo cd && export 'quoted text' printf
+x=1 awk 2>/dev/null $(pwd) "$1" grep 'quoted text'
+		done x=1 /usr/bin local done then 'quoted text' then -eu 'quoted text'
+| done test $(pwd) x=1 && -eu test test && --verbose "$1" readonly cd |
+	local "$@" grep | readonly test "$@" -eu "$1" | printf "$@" local $(pwd) echo x=1
+	grep done readonly && --verbose printf ${HOME} then ${HOME} $(pwd)
+	/usr/bin --verbose "$1" sed cd "$1" local "$1" 2>/dev/null
+	sed && test grep sed 'quoted text' /usr/bin echo
+	"$1" && grep --verbose grep echo
+		then then "$@" "$@" && cd echo readonly 'quoted text' readonly -eu
+cd test printf | --verbose grep | local -eu "$1" done "$1" export
+		grep x=1 printf test export grep && awk 2>/dev/null
+"$1" printf x=1 | /usr/bin --verbose readonly printf x=1 printf | --verbose
+export export local done && awk awk
+	readonly 2>/dev/null test test cd ${HOME}
+		local && "$1" --verbose && sed awk awk cd grep | "$@" grep "$1" cd ${HOME} x=1
+	${HOME} grep echo x=1 done 'quoted text' echo printf export /usr/bin
+export --verbose "$@" 'quoted text' cd done cd && /usr/bin cd "$1" echo cd cd
+sed done && export then | $(pwd) 'quoted text' printf done $(pwd) readonly echo
+${HOME} cd done printf && && ${HOME}
+		${HOME} /usr/bin | /usr/bin --verbose x=1 "$@" ${HOME}
+		test && -eu -eu -eu "$1" ${HOME} "$@" local
+-eu --verbose test readonly && 'quoted text'
+		cd && /usr/bin echo ${HOME} export then "$1" test $(pwd)
+		cd x=1 $(pwd) | 'quoted text' --verbose $(pwd) then
+--verbose cd "$1" -eu $(pwd) $(pwd) done "$@" && cd sed
+		awk 2>/dev/null done $(pwd) then | "$@" awk $(pwd) local grep -eu export
+		echo "$@" -eu --verbose sed --verbose -eu --verbose
+	done $(pwd) cd --verbose "$1" cd awk $(pwd) && printf
+		echo export x=1 local
+'quoted text' grep /usr/bin done
+		-eu test echo sed ${HOME} done $(pwd) -eu && sed local && | sed 2>/dev/null
+		echo ${HOME} local grep printf x=1 x=1 -eu && local awk "$1" then /usr/bin
+$(pwd) sed x=1 local test awk x=1 test 2>/dev/null printf ${HOME}
+$(pwd) x=1 ${HOME} -eu sed && awk 2>/dev/null
+	then --verbose export && /usr/bin $(pwd) then 2>/dev/null 'quoted text' && cd
+${HOME} 'quoted text' done printf
+	echo $(pwd) "$@" done done $(pwd) done sed "$@" 2>/dev/null $(pwd) local
+		$(pwd) test ${HOME} 2>/dev/null 'quoted text'
+/usr/bin && readonly export --verbose && && "$@" grep && && 'quoted text'
+	&& ${HOME} local sed awk "$1" awk grep 2>/dev/null then /usr/bin -eu cd
+		grep export readonly cd && then awk && test sed /usr/bin --verbose printf local
+		awk 2>/dev/null -eu /usr/bin printf
+"$1" ${HOME} then printf /usr/bin ${HOME}
+local | done readonly readonly
+	--verbose done 'quoted text' awk cd cd &&
+	local test 'quoted text' sed cd ${HOME} x=1
+		-eu grep test x=1 --verbose -eu printf done && "$@" grep
+	done x=1 readonly sed x=1 x=1 export
+export then test local then then
+	x=1 2>/dev/null ${HOME} "$@" "$@" /usr/bin x=1 2>/dev/null "$1" "$@"
+	-eu printf awk -eu x=1 readonly done echo $(pwd) export
+		--verbose /usr/bin test
+"$@" then 2>/dev/null awk
+	| ${HOME} readonly echo printf /usr/bin x=1
+		${HOME} "$@" awk export "$@" test export export -eu x=1 "$1" ${HOME}
+--verbose done ${HOME} ${HOME} grep local printf $(pwd) then x=1 | readonly
+	&& printf echo -eu 2>/dev/null
+		export --verbose local echo local ${HOME} 2>/dev/null
+		"$@" local grep then 2>/dev/null
+| test done | 2>/dev/null done x=1 awk $(pwd) $(pwd) test /usr/bin
+	2>/dev/null 2>/dev/null
+2>/dev/null cd local done cd grep then && ${HOME} ${HOME} cd export
+/usr/bin "$1" grep sed && awk ${HOME}
+		sed grep 'quoted text' test 2>/dev/null cd sed -eu awk
+	"$1" "$@" 'quoted text' ${HOME} --verbose
+	printf sed -eu export echo export
+	awk grep 2>/dev/null done
+		local grep 2>/dev/null |
+	printf awk && export echo -eu "$1" /usr/bin 2>/dev/null export /usr/bin --verbose
+	printf grep && echo local ${HOME} x=1 then "$1" test $(pwd) "$1"
+	done -eu sed 2>/dev/null 'quoted text' local sed then awk 'quoted text'
+		cd 2>/dev/null echo 2>/dev/null then | && sed ${HOME} | ${HOME} test x=1
+		'quoted text' 2>/dev/null 2>/dev/null
+	'quoted text' cd ${HOME} printf awk -eu
+		cd | test echo 'quoted text' -eu x=1
+		${HOME} -eu 'quoted text' awk --verbose local readonly
+	sed --verbose local then then
+test printf then test
+cd printf x=1 | printf -eu printf /usr/bin -eu
+awk echo "$@" "$1" 'quoted text' ${HOME} "$@" local sed x=1 cd | x=1 readonly
+		local | export /usr/bin x=1 $(pwd) done 2>/dev/null 2>/dev/null
+| | awk printf 2>/dev/null echo 2>/dev/null
+	"$1" | "$1" x=1 && test x=1 local $(pwd)
+--verbose done then -eu cd done
+		"$@" 'quoted text' ${HOME} printf printf grep
+	cd 'quoted text' sed done test export then -eu $(pwd)
+2>/dev/null test --verbose ${HOME} awk local then -eu && cd printf
+	x=1 readonly x=1 done export ${HOME} /usr/bin echo cd /usr/bin
+grep local "$@" "$1" sed cd /usr/bin $(pwd) grep then
+	'quoted text' local ${HOME} cd && local local sed cd echo 'quoted text' /usr/bin
+	done "$@" then /usr/bin readonly
+/usr/bin printf echo export "$@" ${HOME} "$1" cd done
+		&& sed ${HOME} /usr/bin printf cd done /usr/bin printf ${HOME} readonly
+		| awk test ${HOME} 'quoted text' printf then cd && "$@" "$1" --verbose export
+		done done "$@" "$@" | 2>/dev/null
+'quoted text' "$1" /usr/bin awk sed then ${HOME} cd "$@"
+	test sed cd $(pwd) export done x=1 printf ${HOME} --verbose
+cd sed cd "$1" $(pwd) then sed x=1 cd readonly $(pwd) "$1" export readonly
+echo x=1 "$@" --verbose then 'quoted text'
+printf echo 2>/dev/null done test x=1 export
+	sed 2>/dev/null 2>/dev/null && $(pwd) /usr/bin 2>/dev/null
+		'quoted text' export "$@" printf ${HOME} /usr/bin then grep --verbose
+		/usr/bin $(pwd) /usr/bin "$@" done | | echo -eu local awk sed
+		readonly 2>/dev/null "$1" echo "$@" grep
+		| readonly --verbose --verbose export then
+		"$@" -eu readonly "$1" /usr/bin cd 'quoted text' &&
+		| echo sed ${HOME} -eu x=1 export export /usr/bin "$1" 2>/dev/null
+		| $(pwd) 2>/dev/null "$1" awk
+cd export awk | $(pwd) printf 'quoted text' cd /usr/bin "$@" $(pwd) then "$1" "$@"
+	export 2>/dev/null "$1" done ${HOME} -eu && && local then ${HOME} sed sed sed
+	--verbose readonly grep echo
+		'quoted text' test awk --verbose && echo done $(pwd) printf --verbose &&
+	echo grep 2>/dev/null echo
+		"$@" "$1" then local grep echo 2>/dev/null
+/usr/bin grep then then x=1
+	$(pwd) 'quoted text' /usr/bin
+x=1 export awk | ${HOME} done -eu readonly --verbose cd cd /usr/bin
+printf --verbose awk cd
+	${HOME} /usr/bin sed -eu /usr/bin
+		awk export sed "$@" --verbose
+		sed | "$@" "$1" x=1 readonly local $(pwd) --verbose
+"$@" ${HOME} "$@" test $(pwd) export
+	export grep --verbose /usr/bin "$1" 2>/dev/null then
+		printf cd -eu -eu export ${HOME} readonly "$@" printf -eu cd awk local
+		-eu $(pwd) test sed "$@" grep readonly
+		${HOME} ${HOME} 2>/dev/null && awk && "$@" grep | test
+		readonly 'quoted text' grep --verbose /usr/bin 2>/dev/null
+done sed done "$1" "$@" &&
+'quoted text' "$@" /usr/bin then printf -eu &&
+-eu /usr/bin --verbose /usr/bin test ${HOME} cd -eu
+grep export sed grep done "$@" ${HOME} readonly $(pwd)
+'quoted text' done ${HOME} then sed -eu ${HOME} x=1 readonly "$@" readonly readonly
+		export /usr/bin done && && done readonly then x=1 &&
+	sed 'quoted text' printf && 'quoted text' local 'quoted text'
+| -eu awk printf | done x=1 2>/dev/null /usr/bin cd && -eu /usr/bin
+	done | $(pwd) export cd
+	'quoted text' $(pwd) "$1" --verbose printf
+"$1" -eu ${HOME} export 2>/dev/null
+	echo "$@" local export sed grep |
+		-eu "$@" x=1 export printf | test local readonly echo ${HOME}
+	&& awk "$@" printf --verbose "$1" export echo && "$1" && readonly sed cd test &&
+local printf 'quoted text' -eu "$@" | /usr/bin -eu ${HOME} "$@" $(pwd) grep
+sed --verbose cd readonly
+awk printf echo done cd --verbose 2>/dev/null
+printf grep grep x=1 --verbose 2>/dev/null "$1" local cd /usr/bin
+	cd grep "$@" 2>/dev/null grep $(pwd) export grep && readonly
+	&& then -eu 2>/dev/null awk "$1" 2>/dev/null awk 'quoted text' 'quoted text'
+done "$@" $(pwd) ${HOME} 'quoted text' -eu
+export awk then local && grep | $(pwd) done x=1 -eu "$@" && sed local "$1"
+	export grep done /usr/bin | printf
+		test 'quoted text' "$@" --verbose then
+'quoted text' && printf ${HOME}
+		local -eu test --verbose x=1 'quoted text'
+'quoted text' printf 'quoted text'
+		echo grep $(pwd) test test readonly ${HOME} export test grep then --verbose
+readonly then readonly x=1 ${HOME} printf cd readonly printf
+		done readonly local ${HOME} "$1" grep -eu done "$1" cd ${HOME}
+		awk "$1" --verbose $(pwd) "$@" -eu test "$1" done export && "$1" sed "$1"
+	${HOME} "$1" $(pwd) awk "$1" x=1 "$@" x=1 test "$@" --verbose "$@" "$1" && awk
+-eu 'quoted text' done
+	| grep -eu && --verbose done ${HOME} awk --verbose $(pwd) $(pwd)
+		$(pwd) --verbose awk export local grep readonly
+		"$1" printf /usr/bin "$@" cd $(pwd) grep
+sed "$@" export ${HOME} --verbose
+cd done ${HOME} x=1 grep "$1" ${HOME} 'quoted text'
+	"$1" 'quoted text' done "$1" cd -eu test && 'quoted text'
+--verbose && local done -eu && ${HOME} ${HOME}
+	done $(pwd) export grep awk -eu echo test
+	--verbose export then 'quoted text' ${HOME} echo "$1" local
+echo 2>/dev/null && 2>/dev/null -eu sed done grep echo
+&& then then then -eu echo printf "$@"
+awk x=1 printf done $(pwd) then
+	done grep --verbose "$@" export echo export ${HOME} "$1" readonly 'quoted text'
+		x=1 cd /usr/bin x=1 -eu "$1" printf printf $(pwd) x=1 readonly
+		sed 'quoted text' test | done && -eu grep done echo "$1" ${HOME}
+	--verbose "$@" export -eu then awk --verbose test
+then 'quoted text' "$@" --verbose export echo
+cd cd $(pwd) --verbose
+awk && done done test cd then cd readonly "$1" x=1 -eu
+		x=1 printf 'quoted text' "$@" export
+x=1 printf readonly echo x=1 ${HOME}
+	x=1 then awk && sed "$1" grep
+		"$@" then /usr/bin grep && | && then sed "$1" && done && 'quoted text'
+	done 2>/dev/null 2>/dev/null done --verbose printf --verbose x=1 2>/dev/null
+	printf "$@" local echo awk
+	awk local echo done 'quoted text' --verbose 'quoted text' ${HOME}
+"$@" done sed && echo | /usr/bin "$1" printf "$1" ${HOME} echo
+sed ${HOME} grep -eu done sed 2>/dev/null 'quoted text'
+		$(pwd) 2>/dev/null grep /usr/bin echo 'quoted text' echo
+	printf awk | then local 'quoted text' /usr/bin "$1" /usr/bin ${HOME} "$@" echo
+${HOME} export echo echo /usr/bin -eu $(pwd) 2>/dev/null cd
+test done x=1 cd "$@" printf $(pwd) ${HOME} awk then test readonly printf $(pwd)
+cd --verbose grep && 'quoted text'
+	'quoted text' ${HOME} $(pwd) then 'quoted text'
+		x=1 /usr/bin done $(pwd)
+	export done --verbose x=1 printf
+		local readonly | "$1" readonly /usr/bin printf done "$1" --verbose readonly --verbose
+		export printf | x=1 awk printf grep then
+		${HOME} -eu 2>/dev/null test "$1" sed done done awk /usr/bin
+		2>/dev/null done | 2>/dev/null
+	| printf printf sed done cd "$1" done "$1" grep $(pwd)
+		awk --verbose 'quoted text' done then cd 2>/dev/null
+		done grep sed then awk -eu "$1" $(pwd) echo
+test $(pwd) printf --verbose ${HOME} done grep awk sed test 'quoted text' test
+	&& "$1" printf | | ${HOME} readonly | $(pwd) ${HOME} -eu 2>/dev/null
+	"$@" local cd 2>/dev/null then echo ${HOME} grep
+done "$1" | && | echo local | 'quoted text' echo sed "$1" sed 2>/dev/null /usr/bin
+		/usr/bin done export grep done $(pwd)
+2>/dev/null /usr/bin then local printf "$@"
+&& done then local then
+		"$1" test awk 2>/dev/null local then | "$@" readonly export
+	/usr/bin "$@" | $(pwd) "$1" x=1 sed
+	grep sed ${HOME} export grep x=1 -eu && local grep then
+-eu printf && readonly ${HOME} 2>/dev/null echo 2>/dev/null printf
+		awk && done echo | | readonly "$@"
+		/usr/bin && ${HOME} "$1" 2>/dev/null && "$1" done | cd awk
+		-eu ${HOME} /usr/bin test $(pwd) /usr/bin export printf x=1 sed done
+&& -eu "$1" local export -eu 2>/dev/null awk printf
+	"$@" done printf grep "$1" | done ${HOME} awk awk printf local
+		/usr/bin -eu && 'quoted text' "$@" then 'quoted text' then export echo awk
+	grep ${HOME} readonly done "$@" echo readonly 'quoted text'
+		x=1 /usr/bin grep x=1 export --verbose
+	--verbose && -eu done
+		| export echo 'quoted text' awk cd sed
+"$1" 2>/dev/null "$1" grep --verbose --verbose
+	2>/dev/null "$@" printf local ${HOME} 'quoted text'
+		"$1" grep -eu awk ${HOME}
+		test | 2>/dev/null && done awk sed "$1" $(pwd) test | echo
+		'quoted text' && echo $(pwd) printf done then local export
+	sed --verbose --verbose echo export x=1 -eu 2>/dev/null
+	| "$1" ${HOME} grep 2>/dev/null export | x=1 test
+	readonly done -eu local done cd "$@" 2>/dev/null "$1" grep export done 2>/dev/null
+	done done /usr/bin -eu 'quoted text' "$@" then
+		| grep $(pwd) x=1 /usr/bin printf
+	${HOME} 'quoted text' ${HOME} test printf
+		test test x=1 -eu sed grep "$1" x=1 -eu grep readonly grep cd | awk
+/usr/bin echo 'quoted text' 'quoted text' sed $(pwd)
+$(pwd) done printf && export
+&& | printf | readonly test done
+		test export echo /usr/bin readonly cd $(pwd) awk /usr/bin echo
+$(pwd) x=1 x=1 /usr/bin 'quoted text' echo -eu && x=1 "$1"
+		awk "$1" printf local then
+		--verbose awk x=1 sed && "$@" then cd cd --verbose awk printf sed /usr/bin
+		sed awk done cd echo -eu x=1 done -eu "$@" /usr/bin awk
+	awk cd && -eu ${HOME} "$1" echo 'quoted text' grep test "$@" awk echo
+		'quoted text' sed "$1" 'quoted text' readonly
+readonly -eu ${HOME} 'quoted text' "$@"
+-eu 2>/dev/null test x=1 awk $(pwd) 2>/dev/null ${HOME} "$1" | awk |
+$(pwd) awk 'quoted text' test grep 2>/dev/null sed "$@" done "$@" && awk sed
+	cd 'quoted text' --verbose | grep cd 2>/dev/null $(pwd) local cd
+grep 'quoted text' 'quoted text'
+		"$1" $(pwd) readonly awk x=1 x=1 -eu local readonly x=1 test then printf
+	then readonly sed --verbose then awk 2>/dev/null -eu ${HOME} local
+	$(pwd) && --verbose ${HOME} cd --verbose ${HOME} && x=1 $(pwd) done
+'quoted text' ${HOME} --verbose $(pwd) "$@"
+		cd readonly awk readonly 2>/dev/null then grep x=1
+		| && echo 2>/dev/null "$@" export "$1" -eu --verbose
+	&& done --verbose 2>/dev/null
+	$(pwd) sed "$@" && printf 2>/dev/null echo | ${HOME}
+		echo done /usr/bin --verbose echo then "$@"
+	printf printf test export --verbose x=1 'quoted text'
+		/usr/bin readonly | cd /usr/bin grep -eu 'quoted text'
+local done awk /usr/bin "$1" sed -eu local /usr/bin | "$@" | -eu && -eu x=1 export
+		| -eu 'quoted text' grep test && sed | "$@"
+	printf | then readonly x=1 2>/dev/null
+	-eu /usr/bin ${HOME} export then printf $(pwd) sed
+	then export done export --verbose && | ${HOME} 2>/dev/null export test cd awk
+x=1 2>/dev/null 2>/dev/null x=1 test | 'quoted text' 'quoted text' -eu readonly
+x=1 $(pwd) | "$@" --verbose "$@" && then echo readonly printf awk export |
+sed sed $(pwd) 2>/dev/null 2>/dev/null "$@" -eu export x=1 echo
+$(pwd) done test --verbose
+	sed /usr/bin done "$1" /usr/bin test --verbose test x=1 then "$@" echo --verbose
+local -eu sed printf && readonly 'quoted text'
+		echo --verbose cd done echo awk sed
+	export 2>/dev/null local done --verbose && then grep grep done echo
+2>/dev/null done readonly grep readonly | --verbose x=1
+readonly 2>/dev/null ${HOME} x=1
+		2>/dev/null ${HOME} export test done readonly
+	$(pwd) printf echo -eu --verbose &&
+	cd grep 2>/dev/null "$@" grep then -eu echo done 2>/dev/null cd echo "$@" && &&
+then "$1" $(pwd) awk echo cd done && && 2>/dev/null /usr/bin
+'quoted text' ${HOME} $(pwd) --verbose 2>/dev/null cd 2>/dev/null ${HOME}
+echo -eu done local sed done x=1 test echo sed done
+	/usr/bin 2>/dev/null printf /usr/bin done sed
+	-eu awk grep x=1 echo /usr/bin echo x=1 printf | | $(pwd) x=1 local printf
+	&& ${HOME} sed done --verbose
+"$@" "$1" cd sed done && grep 'quoted text' /usr/bin
+--verbose echo done sed
+		export --verbose export cd -eu -eu awk then
+		'quoted text' x=1 awk $(pwd) awk "$@"
+		readonly $(pwd) sed "$@" "$1" "$1"
+		printf x=1 sed awk --verbose
+	local | "$1" then 'quoted text' sed 'quoted text' -eu cd $(pwd)
+	2>/dev/null $(pwd) cd then then cd | /usr/bin cd test sed
+readonly 'quoted text' x=1 sed 'quoted text' echo
+		${HOME} $(pwd) "$1" && --verbose -eu awk cd && | ${HOME} printf
+	local grep cd ${HOME} export test printf
+&& /usr/bin $(pwd) sed
+	2>/dev/null awk done sed ${HOME} /usr/bin 'quoted text'
+--verbose 2>/dev/null | "$1" ${HOME} "$1" ${HOME} /usr/bin readonly | awk "$1"
+		${HOME} && then "$1" done x=1 done "$@"
+-eu test x=1 awk then 'quoted text' ${HOME} echo -eu "$@" then grep readonly
+done then --verbose ${HOME} sed $(pwd) "$1" x=1 "$1" --verbose test done
+	-eu local $(pwd) awk readonly
+		sed && && test readonly 'quoted text' sed 2>/dev/null
+	'quoted text' then local readonly -eu 'quoted text' sed sed | echo && printf grep
+		then cd then "$1" "$1" x=1 ${HOME} done "$@"
+done echo local echo grep "$@" export printf
+		-eu then | export $(pwd) cd
+local then awk ${HOME} 'quoted text' export
+		local readonly 2>/dev/null | cd local readonly awk export 'quoted text' | x=1
+	2>/dev/null grep cd echo | then --verbose
+	&& done "$@" then awk grep then $(pwd) && 2>/dev/null "$@" grep | grep
+sed sed test --verbose 2>/dev/null cd test --verbose /usr/bin && x=1 awk grep
+		${HOME} grep | | sed && $(pwd) $(pwd) local
+		| grep cd "$@" --verbose | readonly printf awk 2>/dev/null $(pwd) export
+	| $(pwd) 2>/dev/null x=1 echo local x=1 export printf && export "$@" test
+done ${HOME} then && x=1 sed
+	&& "$@" | cd export --verbose
+echo local ${HOME} --verbose $(pwd) readonly x=1 &&
+	'quoted text' --verbose "$1" $(pwd) /usr/bin local
+	local readonly --verbose test -eu grep "$@" cd --verbose
+		| $(pwd) local x=1 ${HOME} x=1 local grep local printf && | -eu --verbose
+		| printf then then --verbose
+		-eu grep ${HOME} "$@" done cd readonly ${HOME} then test
+	x=1 awk x=1 cd $(pwd) sed $(pwd) sed $(pwd)
+	test local grep export grep done
+	echo | grep | -eu ${HOME} 'quoted text'
+		-eu | printf -eu readonly
+	cd --verbose "$@" then grep && readonly "$1" "$1" done local done -eu echo $(pwd)
+export "$1" printf 2>/dev/null --verbose
+done 'quoted text' 2>/dev/null 'quoted text' "$1" echo sed && cd "$1"
+	$(pwd) -eu x=1 | readonly done printf echo cd sed sed
+	echo readonly -eu then local --verbose readonly cd ${HOME} | "$1" export
+	2>/dev/null echo printf | $(pwd) readonly done echo $(pwd) 2>/dev/null
+echo 'quoted text' printf 'quoted text' cd --verbose
+		test x=1 done && grep "$1" 2>/dev/null export
+	local ${HOME} -eu test 2>/dev/null
+		local test sed "$1" then export
+	"$@" && "$@" local echo awk x=1 $(pwd) echo
+	cd --verbose sed test awk awk grep --verbose 'quoted text' "$@" x=1 --verbose
+then x=1 "$1" "$1" | x=1 local printf awk test
+| printf readonly 'quoted text' export "$1" cd -eu x=1 printf 'quoted text'
+export awk -eu echo 2>/dev/null cd && x=1 echo export local awk sed x=1 readonly
+		test echo export -eu readonly 2>/dev/null ${HOME} "$1"
+	x=1 | x=1 "$@" /usr/bin done done x=1 x=1 x=1
+		grep local 2>/dev/null readonly local printf --verbose done --verbose
+		-eu --verbose test printf && sed -eu "$@" $(pwd) $(pwd) /usr/bin 2>/dev/null
+done readonly --verbose export "$1" then cd readonly
+local echo then "$@" export --verbose
+cd local 2>/dev/null ${HOME} | test sed export $(pwd)
+	'quoted text' test cd export
+		printf done printf awk awk | echo local sed test export | $(pwd) --verbose
+x=1 'quoted text' /usr/bin done
+"$1" /usr/bin x=1 | --verbose test export
+	awk sed printf then | 2>/dev/null
+grep local awk $(pwd) cd ${HOME} then
+x=1 ${HOME} test export readonly done
+then "$@" "$@" /usr/bin printf test ${HOME} then --verbose
+	&& export -eu "$@" echo 'quoted text'
+	/usr/bin local 2>/dev/null cd -eu
+		printf ${HOME} | test "$@" /usr/bin grep printf echo ${HOME} --verbose
+		/usr/bin printf "$@" && 'quoted text' $(pwd) echo "$@" sed
+		${HOME} sed readonly && done awk x=1 -eu /usr/bin x=1 "$1" then /usr/bin $(pwd)
+	&& export x=1 then /usr/bin -eu test test
+	local awk "$@" export | ${HOME} export export && $(pwd) local awk test then
+2>/dev/null 'quoted text'
+'quoted text' && && | $(pwd) /usr/bin
+		cd 'quoted text' then
+		&& export then && 'quoted text'
+	&& readonly "$@" --verbose
+grep $(pwd) ${HOME} --verbose "$1" --verbose export readonly
+	echo ${HOME} awk "$1" grep "$1" 2>/dev/null readonly x=1
+		$(pwd) "$1" && done then cd /usr/bin
+&& "$@" -eu | printf /usr/bin
+	test "$1" x=1 x=1 printf echo echo test
+		grep local done 2>/dev/null
+		then local /usr/bin done sed $(pwd) sed export /usr/bin readonly
+'quoted text' $(pwd) then -eu $(pwd) local && test "$1" | "$@" -eu | -eu
+		export readonly && "$@" sed /usr/bin
+		local printf printf cd $(pwd) cd
+/usr/bin && 'quoted text' && "$1" cd sed "$1"
+"$1" awk printf printf /usr/bin x=1 ${HOME} test --verbose then
+		-eu 'quoted text' then --verbose
+		'quoted text' /usr/bin 'quoted text' grep sed export
+	"$1" x=1 /usr/bin | --verbose -eu "$@" ${HOME} echo && $(pwd) "$@" printf awk
+	"$@" awk --verbose $(pwd)
+	test readonly --verbose
+test "$1" "$@" grep -eu ${HOME} cd "$@" cd readonly sed then && ${HOME} cd grep
+${HOME} --verbose "$1" --verbose printf
+/usr/bin -eu printf | then done ${HOME} x=1 ${HOME}
+		-eu then | cd -eu --verbose /usr/bin "$@" | |
+		/usr/bin local $(pwd) x=1 /usr/bin "$@" done sed echo 2>/dev/null
+${HOME} -eu /usr/bin -eu $(pwd) | | 'quoted text' echo x=1 /usr/bin
+		sed local cd | awk 2>/dev/null ${HOME}
+		/usr/bin done --verbose echo
+| -eu && /usr/bin && local 2>/dev/null export
+		export sed --verbose ${HOME}
+echo awk local "$1" test echo && x=1 done ${HOME}
+	/usr/bin $(pwd) "$1" sed 'quoted text'
+	cd 2>/dev/null --verbose ${HOME} then awk 2>/dev/null 'quoted text' grep $(pwd)
+		awk $(pwd) --verbose export 2>/dev/null
+2>/dev/null x=1 x=1 /usr/bin grep sed /usr/bin
+--verbose $(pwd) cd /usr/bin
+local then echo echo "$1" local
+		sed done cd x=1 && local $(pwd) grep done sed echo | /usr/bin
+		--verbose && $(pwd) 2>/dev/null awk --verbose
+	readonly local awk 'quoted text' ${HOME} 'quoted text'
+then sed $(pwd) export cd $(pwd) readonly
+	export $(pwd) local --verbose "$@" echo export
+		done 'quoted text' export readonly --verbose cd /usr/bin awk
+		readonly 2>/dev/null ${HOME} printf "$1" && local readonly -eu awk
+		grep local then then && printf 'quoted text' printf "$@" 'quoted text'
+	-eu $(pwd) echo grep printf
+		/usr/bin echo --verbose "$@" "$1" $(pwd) -eu 'quoted text'
+&& -eu then | 2>/dev/null local --verbose -eu export --verbose
+then /usr/bin sed export
+		"$@" export cd "$1" $(pwd) && sed awk echo then -eu
+	2>/dev/null 'quoted text' 2>/dev/null
+echo grep export ${HOME} echo test x=1 printf export test done sed
+	export ${HOME} --verbose /usr/bin x=1 x=1 'quoted text' sed
+		&& x=1 "$@" export printf local printf export /usr/bin
+		printf ${HOME} sed cd local awk "$1" then local test cd && grep readonly
+	awk && && /usr/bin /usr/bin readonly echo printf "$@" printf then test awk ${HOME}
+	grep sed 2>/dev/null awk 'quoted text'
+	"$@" --verbose /usr/bin $(pwd) 'quoted text'
+2>/dev/null grep readonly test grep sed cd echo "$1" | $(pwd) readonly sed /usr/bin
+		"$1" sed awk -eu then ${HOME} 2>/dev/null
+$(pwd) cd local -eu cd 2>/dev/null
+		local then "$1" cd test grep
+		'quoted text' && -eu awk awk --verbose awk $(pwd) then --verbose
+		&& sed 'quoted text' ${HOME} grep && readonly -eu 'quoted text' cd test x=1
+		${HOME} && sed ${HOME} local 'quoted text' 'quoted text' export local 2>/dev/null
+	-eu | ${HOME} --verbose done
+	grep "$1" readonly test readonly sed --verbose --verbose done cd
+	cd x=1 | /usr/bin 'quoted text' echo -eu
+	--verbose /usr/bin local ${HOME} grep sed 'quoted text' export --verbose "$@" "$1"
+		/usr/bin test printf readonly x=1 local echo export export printf x=1 x=1
+		${HOME} -eu "$@" /usr/bin then "$1" 2>/dev/null --verbose /usr/bin
+cd echo done export sed 2>/dev/null sed cd sed cd 'quoted text' /usr/bin
+	cd -eu local sed printf awk grep local
+	-eu test local --verbose
+test | readonly $(pwd) --verbose && cd sed $(pwd) "$@" export | x=1
+		sed | export test ${HOME} cd $(pwd)
+		printf grep sed done | awk then "$@" -eu 'quoted text' readonly echo 2>/dev/null
+	/usr/bin readonly printf "$@" printf local "$@" sed local test ${HOME}
+grep local 'quoted text' echo --verbose sed grep /usr/bin
+		/usr/bin x=1 | && $(pwd) grep readonly "$1" 2>/dev/null && /usr/bin
+done printf sed "$1" export then
+then ${HOME} ${HOME} awk echo grep test && then $(pwd) | cd -eu 'quoted text'
+		then echo x=1 then printf done 'quoted text' printf then ${HOME}
+		local export 2>/dev/null --verbose sed x=1 x=1 grep grep echo
+		2>/dev/null awk echo printf x=1 && test grep "$@" 2>/dev/null
+awk 2>/dev/null ${HOME} -eu cd awk export x=1 readonly then grep grep
+		done 'quoted text' | $(pwd) "$@" awk $(pwd) cd ${HOME} --verbose "$@"
+		awk echo -eu grep grep ${HOME} -eu --verbose grep readonly
+cd printf done awk export
+		--verbose $(pwd) readonly 2>/dev/null
+echo ${HOME} | /usr/bin test printf 2>/dev/null /usr/bin
+		echo awk awk sed /usr/bin cd sed $(pwd) "$1" readonly
+	"$1" sed ${HOME} echo "$1" /usr/bin local
+		awk -eu "$@" 2>/dev/null
+		$(pwd) awk done done && x=1 'quoted text'
+--verbose | awk 2>/dev/null
+grep then x=1 local 'quoted text' | -eu export 2>/dev/null cd echo readonly
+sed awk local $(pwd) ${HOME} grep sed $(pwd) "$@" cd "$@" "$@" grep
+		readonly export "$@" && 2>/dev/null ${HOME} readonly readonly printf
+-eu local then test done -eu "$@" grep awk export -eu
+	export grep then sed readonly "$1" "$1" "$@" then | -eu done /usr/bin 2>/dev/null
+sed x=1 then 'quoted text' test -eu readonly cd
+&& -eu | sed done grep && echo then $(pwd) -eu echo
+	| $(pwd) printf | awk readonly 2>/dev/null
+		then echo -eu echo printf -eu x=1 sed "$1" readonly done
+&& echo --verbose -eu test ${HOME} --verbose
+	/usr/bin local test x=1 printf "$1" "$@" local
+		then then then x=1 test 'quoted text' export "$@" awk
+	x=1 readonly 2>/dev/null x=1 "$1" cd | | awk
+cd grep && cd 'quoted text' printf /usr/bin then && grep -eu local --verbose
+/usr/bin ${HOME} local readonly awk && export then | export
+		local ${HOME} | $(pwd) done 'quoted text' grep |
+cd "$1" --verbose | 2>/dev/null
+	test done $(pwd) /usr/bin /usr/bin test grep
+	/usr/bin echo then -eu readonly "$1" "$@" --verbose sed 'quoted text' then
+		local sed then grep ${HOME} cd sed 2>/dev/null /usr/bin --verbose
+	sed "$1" | awk then x=1 awk local sed export -eu
+	/usr/bin echo sed /usr/bin cd test printf
+		echo cd /usr/bin ${HOME} -eu ${HOME}
+&& test export $(pwd) sed "$1" 'quoted text' readonly 'quoted text'
+		sed echo && done local local printf export "$@" ${HOME} export local
+cd x=1 grep then readonly x=1 $(pwd) local -eu --verbose readonly printf grep x=1
+awk | --verbose x=1 local cd test x=1 grep local $(pwd) grep
+		echo done export echo && awk 2>/dev/null | cd done x=1 ${HOME}
+		"$1" /usr/bin local /usr/bin awk && sed | ${HOME}
+x=1 2>/dev/null -eu 2>/dev/null
+	readonly 2>/dev/null -eu /usr/bin
+	then | "$@" sed printf cd 'quoted text' readonly readonly cd && test cd --verbose
+"$1" sed 2>/dev/null readonly
+		printf && export ${HOME} x=1 test 'quoted text' cd
+export -eu export "$@" cd "$1" 'quoted text' 2>/dev/null /usr/bin && &&
+		awk sed | --verbose $(pwd) | -eu test done -eu readonly "$@" 'quoted text' awk
+		readonly echo /usr/bin sed cd readonly then done && echo grep $(pwd) ${HOME}
+	${HOME} "$@" | export --verbose --verbose test awk 'quoted text' "$1" ${HOME}
+		&& x=1 printf x=1 cd x=1 cd sed 2>/dev/null
+		sed printf awk --verbose -eu printf /usr/bin export | done echo echo local printf
+	-eu 'quoted text' export | x=1 -eu
+	"$1" cd --verbose | "$@" sed $(pwd) --verbose /usr/bin | "$@" && export
+	printf /usr/bin grep grep 2>/dev/null echo test test
+		sed /usr/bin -eu readonly $(pwd)
+		$(pwd) "$@" cd cd x=1 test awk then grep 'quoted text' 2>/dev/null
+"$1" "$@" "$1" --verbose "$@" sed
+		2>/dev/null x=1 printf -eu /usr/bin
+2>/dev/null awk grep awk 'quoted text'
+	then -eu $(pwd) -eu printf
+awk test "$@" then 2>/dev/null
+${HOME} sed "$@" done ${HOME} then "$@" readonly echo /usr/bin test ${HOME} cd
+$(pwd) x=1 readonly -eu local sed "$1"
+		readonly then "$@" -eu done 'quoted text' cd export 2>/dev/null
+	'quoted text' awk ${HOME} "$@" readonly
+		x=1 $(pwd) ${HOME} sed ${HOME} local $(pwd) 2>/dev/null
+--verbose $(pwd) sed done local
+printf "$@" sed export x=1 2>/dev/null
+		'quoted text' ${HOME} done /usr/bin 2>/dev/null
+		x=1 test cd local echo local
+		grep echo test local 2>/dev/null && "$@" "$@" 'quoted text'
+	$(pwd) 'quoted text' 'quoted text'
+--verbose sed echo printf /usr/bin test
+	-eu grep "$@" printf awk
+	| printf printf | local "$@" 'quoted text' $(pwd) cd done
+		-eu export /usr/bin | echo $(pwd) grep 2>/dev/null
+		sed "$1" cd awk 2>/dev/null 2>/dev/null
+then echo export readonly ${HOME} | /usr/bin done ${HOME}
+	/usr/bin | 'quoted text' ${HOME} $(pwd) readonly awk grep | -eu
+	2>/dev/null printf /usr/bin grep done
+		test local x=1 x=1 x=1 printf export readonly /usr/bin sed "$1" 'quoted text'
+	printf && printf $(pwd) grep && 2>/dev/null sed
+	done local export readonly x=1 done x=1 /usr/bin export --verbose sed sed "$@"
+echo 'quoted text' x=1 "$@" /usr/bin
+	| grep && /usr/bin echo 'quoted text' /usr/bin then ${HOME} then
+	2>/dev/null | "$1" grep then awk x=1 test
+then ${HOME} grep test "$@" && ${HOME} -eu 2>/dev/null
+	printf readonly done --verbose 2>/dev/null echo | -eu &&
+		echo export --verbose x=1 done echo 2>/dev/null "$1" 'quoted text' &&
+	awk --verbose $(pwd) printf sed --verbose --verbose then sed printf
+		&& && "$@" | echo x=1 grep 'quoted text' --verbose sed awk -eu
+		then --verbose && done 'quoted text'
+2>/dev/null grep export $(pwd)
+		--verbose echo "$1" x=1 done grep 2>/dev/null done export ${HOME}
+printf awk ${HOME} --verbose printf grep printf
+		echo $(pwd) | cd | readonly -eu readonly /usr/bin awk 2>/dev/null cd sed test 'quoted text'
+		then --verbose "$@" x=1 printf "$@" done test /usr/bin "$1" sed /usr/bin
+local cd local local 2>/dev/null grep then
+awk -eu printf done local
+	| awk --verbose "$1" |
+| $(pwd) echo x=1 && cd $(pwd) echo done readonly | /usr/bin -eu
+printf "$1" 'quoted text' ${HOME} "$@" -eu done grep -eu done
+readonly then awk test ${HOME} ${HOME} -eu ${HOME} echo test | then 'quoted text'
+	-eu grep sed "$@" readonly then /usr/bin 'quoted text'
+		readonly export $(pwd) ${HOME} ${HOME}
+"$@" "$1" ${HOME} "$@" printf | cd done
+		/usr/bin x=1 done --verbose grep 2>/dev/null test -eu readonly /usr/bin "$@"
+	cd awk && x=1 printf done grep /usr/bin
+	sed then printf printf done -eu --verbose 'quoted text' awk "$1" 'quoted text'
+echo done export printf then readonly /usr/bin | test "$1" &&
+	sed echo test --verbose readonly test done $(pwd) ${HOME} "$@" cd 'quoted text'
+		test $(pwd) printf 'quoted text' sed $(pwd) && 'quoted text'
+2>/dev/null --verbose export then 'quoted text' x=1 readonly
+	${HOME} then export -eu | grep grep cd --verbose 2>/dev/null echo --verbose
+echo echo ${HOME} cd $(pwd)
+-eu export awk awk local 'quoted text'
+	grep cd grep "$1" x=1 export && x=1 x=1 && export echo
+	awk | ${HOME} echo sed --verbose then 'quoted text' "$1" 2>/dev/null
+		'quoted text' cd x=1 2>/dev/null /usr/bin $(pwd) export printf then --verbose
+	echo 2>/dev/null -eu awk "$1" export 'quoted text'
+		cd --verbose /usr/bin awk export awk --verbose cd
+done 'quoted text' local "$1" x=1 && sed test
+	local 2>/dev/null /usr/bin then local local export /usr/bin ${HOME} /usr/bin
+		/usr/bin /usr/bin readonly --verbose /usr/bin
+		$(pwd) "$1" awk test ${HOME} $(pwd)
+	-eu "$1" readonly done cd awk cd echo sed 'quoted text'
+		x=1 "$@" echo test then printf -eu readonly --verbose -eu 2>/dev/null
+echo sed ${HOME} "$@" 2>/dev/null ${HOME} local readonly "$1" then --verbose
+	x=1 'quoted text' echo echo then ${HOME} cd -eu awk cd 'quoted text'
+	done printf ${HOME} --verbose && "$1" printf $(pwd) done
+	grep printf "$1" printf export "$1" "$@"
+/usr/bin grep | test export done grep sed 'quoted text' ${HOME}
+		cd 2>/dev/null /usr/bin cd test grep
+$(pwd) -eu 2>/dev/null printf | then 'quoted text'
+/usr/bin $(pwd) "$1" readonly
+		"$1" 'quoted text' "$@" printf | "$@" done ${HOME} grep && /usr/bin 2>/dev/null
+	awk grep sed --verbose && export awk awk -eu cd "$@" 'quoted text'
+"$@" "$1" test echo awk done echo
+		2>/dev/null test --verbose sed done cd grep "$1" echo cd grep
+		2>/dev/null "$1" x=1 "$1" grep export && x=1 awk ${HOME} 'quoted text'
+"$@" local then --verbose -eu export test test -eu "$1" cd
+		--verbose --verbose 'quoted text' export && "$1"
+$(pwd) x=1 test cd | echo awk readonly x=1 local /usr/bin grep && x=1
+cd local /usr/bin grep sed 'quoted text' then cd echo
+/usr/bin done -eu readonly -eu grep "$@" done x=1
+		${HOME} sed "$1" 'quoted text'
+cd --verbose readonly grep cd 'quoted text' "$1" x=1 x=1 $(pwd) echo ${HOME}
+	-eu grep "$1" readonly ${HOME}
+	--verbose "$@" sed ${HOME} then -eu 'quoted text'
+"$1" | cd -eu done readonly 'quoted text' "$@" "$@" awk awk
+'quoted text' /usr/bin -eu 'quoted text'
+	sed export awk local "$1" -eu printf then && awk 'quoted text' && ${HOME}
+	export | "$1" then echo done ${HOME} | "$@" printf 2>/dev/null
+		export awk local /usr/bin
+	2>/dev/null grep -eu export printf "$1" 2>/dev/null "$1" cd ${HOME}
+	done && export /usr/bin "$@" awk ${HOME}
+		test && 2>/dev/null | -eu | printf ${HOME} then /usr/bin /usr/bin
+	$(pwd) x=1 "$@" cd -eu printf | "$1" grep awk
+	${HOME} grep 2>/dev/null && "$@" "$1" grep
+		grep x=1 ${HOME} $(pwd) grep done x=1 local
+		then test --verbose test
+	'quoted text' then echo readonly
+printf sed x=1 export test x=1 echo cd local grep then x=1 /usr/bin
+	sed && awk | | $(pwd) export ${HOME} sed grep sed
+		&& done cd export ${HOME} printf test local grep local 2>/dev/null x=1 "$@"
+		cd grep 2>/dev/null printf sed then done then | -eu 'quoted text' done awk && /usr/bin
+		cd readonly 'quoted text' then /usr/bin --verbose &&
+	&& $(pwd) ${HOME} | -eu -eu 'quoted text' echo cd
+		'quoted text' $(pwd) $(pwd) /usr/bin export $(pwd)
+	"$@" $(pwd) $(pwd) 2>/dev/null awk "$1" -eu && $(pwd) && ${HOME}
+	| cd $(pwd) sed done echo echo 'quoted text' $(pwd) echo /usr/bin done grep echo
+		cd 'quoted text' 'quoted text'
+	| export | done then 2>/dev/null --verbose echo "$@"
+	test && echo grep "$1" export awk /usr/bin "$@" 2>/dev/null x=1 &&
+	'quoted text' x=1 cd echo
+	/usr/bin echo then && -eu "$@" sed --verbose awk x=1 x=1 ${HOME}
+	"$1" 'quoted text' echo | 'quoted text' awk then /usr/bin $(pwd) -eu
+	cd 2>/dev/null test && then then && export grep 2>/dev/null printf local
+		${HOME} done sed "$@" 'quoted text' --verbose
+	x=1 ${HOME} echo 2>/dev/null 'quoted text' done &&
+printf && "$1" local readonly local done test /usr/bin done
+printf 2>/dev/null export "$1" ${HOME} /usr/bin
+	readonly sed printf then $(pwd) cd ${HOME} grep done
+then ${HOME} local "$@" 'quoted text' test
+	grep "$1" local readonly grep printf "$@" "$1" local cd done sed $(pwd)
+	x=1 "$1" awk --verbose -eu readonly 2>/dev/null
+x=1 'quoted text' done sed readonly && test 'quoted text' printf test test cd
+	$(pwd) /usr/bin "$1" sed test 2>/dev/null
+sed done local 'quoted text' ${HOME} grep "$@" /usr/bin test -eu | ${HOME} 2>/dev/null
+		echo x=1 local x=1 && -eu export && test
+	done printf local test local local printf sed then grep test
+| /usr/bin then 'quoted text' 2>/dev/null cd sed echo test
+"$@" 'quoted text' x=1 readonly && 'quoted text' grep cd cd awk
+	| echo "$@" 'quoted text' x=1 printf "$@" grep /usr/bin | "$@" done test "$1" cd
+		local && readonly readonly "$1" local echo | /usr/bin sed ${HOME}
+	| -eu sed -eu -eu /usr/bin
+	2>/dev/null echo x=1 --verbose grep ${HOME} awk "$1" $(pwd) then cd done readonly
+$(pwd) export cd ${HOME} /usr/bin
+		export "$1" echo test printf awk | export "$1" 2>/dev/null grep "$@" /usr/bin
+	done cd 2>/dev/null 'quoted text' | test echo --verbose sed cd
+	sed /usr/bin echo sed $(pwd) test
+	readonly --verbose 'quoted text' | 'quoted text'
+		printf local --verbose then x=1 sed cd done 2>/dev/null
+echo readonly -eu printf x=1 -eu awk 'quoted text' 'quoted text'
+	local awk done printf printf local "$1" then grep test
+awk sed printf grep readonly $(pwd) 2>/dev/null
+	&& && "$1" then printf "$@" "$@" "$@" /usr/bin
+		/usr/bin test 'quoted text' x=1 "$@" x=1
+		done then | "$1" "$@" x=1 --verbose then readonly && && $(pwd)
+		-eu | x=1 "$@" printf 'quoted text' --verbose
+readonly && done grep x=1 awk
+		-eu /usr/bin done "$@" done -eu cd grep sed printf awk -eu 'quoted text'
+		test printf done | "$1" done printf readonly && done printf printf test
+	| printf sed then ${HOME} awk $(pwd) /usr/bin "$1" grep
+		printf -eu awk cd printf readonly
+		| && 'quoted text' /usr/bin export grep
+	${HOME} readonly grep then echo sed 'quoted text'
+readonly 2>/dev/null "$@" -eu --verbose x=1 printf readonly --verbose sed readonly
+	"$1" /usr/bin --verbose 2>/dev/null echo printf printf done --verbose
+	${HOME} x=1 awk printf awk done readonly
+readonly readonly "$@" 'quoted text' cd ${HOME} cd export | local --verbose
+	local export --verbose && done done then 'quoted text' "$1" done /usr/bin
+"$1" done test readonly export | --verbose awk
+	local readonly printf done ${HOME} grep then "$1"
+		"$1" "$@" echo $(pwd) then "$@" cd 'quoted text'
+	test | readonly cd then 'quoted text' --verbose done "$1"
+/usr/bin /usr/bin "$@" echo sed
+	then export awk export test cd cd sed export awk ${HOME}
+		printf ${HOME} "$1" local --verbose "$1" local && "$1" sed 2>/dev/null --verbose
+		--verbose -eu /usr/bin 2>/dev/null /usr/bin 2>/dev/null 2>/dev/null
+printf x=1 | printf | | -eu awk sed echo "$1" $(pwd) --verbose
+	readonly echo printf test "$@" cd x=1 x=1 then then readonly sed
+		awk awk done awk && --verbose printf && readonly $(pwd)
+x=1 ${HOME} grep x=1 printf x=1 readonly && 'quoted text' printf 2>/dev/null 2>/dev/null
+		sed awk then test local "$1"
+	"$1" echo sed && x=1 export
+		cd "$@" 'quoted text' grep done
+$(pwd) "$@" /usr/bin /usr/bin x=1 x=1 test readonly
+test echo $(pwd) done | --verbose "$1" "$@" local x=1 -eu readonly export then
+	$(pwd) echo echo "$1" readonly
+sed awk -eu ${HOME} /usr/bin /usr/bin "$@" --verbose 'quoted text' grep local "$1"
+		sed cd printf && local x=1 /usr/bin | "$1" sed cd
+	grep printf export 'quoted text' /usr/bin printf echo echo 'quoted text'
+		grep /usr/bin grep --verbose $(pwd) export
+	printf --verbose then readonly
+	x=1 echo grep -eu && local 'quoted text' done readonly export $(pwd) -eu grep
+then done sed awk cd grep then "$@" ${HOME} cd done export local ${HOME}
+		&& sed ${HOME} awk local sed "$1" "$1" && "$@" printf $(pwd) $(pwd)
+	printf echo && 'quoted text' -eu awk
+		$(pwd) test export -eu echo
+readonly awk sed x=1 /usr/bin x=1 export
+then "$@" "$1" done local ${HOME} sed /usr/bin
+	/usr/bin cd "$1" awk sed
+"$1" x=1 && ${HOME} awk
+		printf 'quoted text' local "$@" 'quoted text'
+		cd "$1" sed export $(pwd) x=1 --verbose export awk "$1" grep $(pwd)
+	done x=1 ${HOME} -eu export /usr/bin
+		2>/dev/null 'quoted text' 'quoted text' awk && "$@" -eu then --verbose export
+	&& printf 'quoted text' x=1 2>/dev/null 'quoted text' printf
+		"$@" then -eu $(pwd) grep printf "$@" readonly export
+awk "$@" grep | local "$1" echo "$1" done awk && 'quoted text'
+		grep 'quoted text' awk awk test readonly grep sed 'quoted text'
+		-eu done readonly 2>/dev/null ${HOME} done /usr/bin cd 'quoted text'
+		test | then echo export then
+	--verbose --verbose awk readonly "$1" 2>/dev/null export echo awk local then grep
+	readonly "$1" local then readonly /usr/bin
+	printf test echo sed /usr/bin then cd printf echo
+	grep awk local --verbose readonly test local
+	"$@" then readonly x=1 readonly 'quoted text' "$@" cd local then
+	/usr/bin "$1" test --verbose ${HOME} printf sed
+		"$1" --verbose sed x=1 $(pwd) -eu readonly
+'quoted text' sed readonly && done
+	${HOME} x=1 --verbose ${HOME} readonly x=1 | printf test 2>/dev/null ${HOME}
+	export x=1 done -eu echo /usr/bin x=1 x=1 done grep then export test
+	export readonly local grep then test 'quoted text'
+		'quoted text' test $(pwd) ${HOME} /usr/bin grep readonly $(pwd) echo done
+		$(pwd) 2>/dev/null cd done "$1" x=1 cd "$@"
+awk /usr/bin awk "$@" x=1 'quoted text'
+/usr/bin grep 'quoted text' cd cd then readonly sed
+	x=1 | /usr/bin done awk cd local --verbose
+2>/dev/null sed export && "$@" export --verbose $(pwd) --verbose
+	sed readonly && local done echo "$1" --verbose
+sed 'quoted text' test printf $(pwd) test "$1"
+sed -eu echo done then && -eu printf done
+		export "$1" -eu -eu 'quoted text' "$@" --verbose echo 2>/dev/null cd sed -eu ${HOME}
+	x=1 done cd x=1 then grep
+		--verbose /usr/bin readonly then readonly printf ${HOME} /usr/bin
+x=1 $(pwd) -eu test 2>/dev/null x=1 /usr/bin
+		${HOME} cd /usr/bin 'quoted text' --verbose sed && --verbose ${HOME} -eu
+${HOME} cd sed cd 2>/dev/null 'quoted text'
+		readonly | printf grep /usr/bin x=1
+cd printf sed sed --verbose then $(pwd) awk grep cd
+		$(pwd) $(pwd) then then x=1 then export /usr/bin
+	grep x=1 2>/dev/null sed ${HOME} --verbose sed printf 'quoted text'
+		-eu 2>/dev/null then 'quoted text'
+&& awk readonly && "$1" x=1 /usr/bin $(pwd) --verbose --verbose
+	--verbose x=1 done readonly 'quoted text' x=1 --verbose test /usr/bin "$@"
+		then readonly --verbose then ${HOME}
+		local 2>/dev/null x=1 sed local | sed /usr/bin awk readonly done awk 2>/dev/null
+	2>/dev/null done done local ${HOME} printf ${HOME} sed sed && "$1" x=1
+/usr/bin | | then | "$@" readonly x=1
+	-eu then && grep done $(pwd) && awk | --verbose echo "$@" echo /usr/bin sed
+	grep && local ${HOME} awk "$@" -eu printf readonly cd
+	export x=1 ${HOME} && then cd --verbose && export awk | $(pwd) && "$@" cd cd /usr/bin
+	awk ${HOME} echo x=1 ${HOME} awk cd done
+	local echo x=1 /usr/bin "$@" 2>/dev/null ${HOME} --verbose 2>/dev/null local
+	echo awk export cd $(pwd) 2>/dev/null "$@" $(pwd) grep then local ${HOME}
+test done --verbose local grep
+	-eu && printf printf /usr/bin -eu then 2>/dev/null awk awk x=1 'quoted text'
+		${HOME} test local | echo --verbose done
+	"$@" | | /usr/bin x=1 cd ${HOME}
+		export $(pwd) --verbose local
+	sed && $(pwd) -eu echo --verbose grep | $(pwd) /usr/bin $(pwd) 'quoted text'
+-eu echo echo | echo then
+	"$@" echo grep export echo grep readonly test awk test -eu
+	then --verbose --verbose | /usr/bin sed echo 2>/dev/null --verbose | ${HOME} test
+	"$@" test awk 'quoted text' readonly /usr/bin sed awk readonly readonly
+	cd printf done -eu "$1" done 2>/dev/null echo "$1" "$@" readonly
+		cd $(pwd) 'quoted text' | ${HOME} cd local readonly printf ${HOME} cd x=1
+		sed echo 2>/dev/null printf printf ${HOME} then "$1" "$1" echo x=1 2>/dev/null
+		done printf 'quoted text' cd ${HOME}
+then echo /usr/bin awk ${HOME} "$1" 2>/dev/null
+		2>/dev/null $(pwd) $(pwd) -eu cd local export --verbose ${HOME} then
+export $(pwd) printf x=1 && x=1 readonly test local ${HOME} $(pwd)
+	"$1" 2>/dev/null done readonly 'quoted text' test awk sed done -eu &&
+$(pwd) test then $(pwd) awk ${HOME} then test test readonly grep "$@"
+		test --verbose then "$1" "$@" awk
+'quoted text' export done printf -eu readonly cd --verbose "$@" x=1 /usr/bin --verbose
+${HOME} $(pwd) 2>/dev/null readonly /usr/bin grep export then
+	/usr/bin echo then $(pwd) 'quoted text' cd export then -eu printf
+		'quoted text' --verbose sed && awk ${HOME} ${HOME} cd awk readonly
+		-eu done "$1" echo printf then awk -eu "$1" then
+		grep && /usr/bin then echo
+		grep readonly local readonly ${HOME} "$@"
+local then /usr/bin -eu "$1" ${HOME} readonly readonly && cd done --verbose
+		-eu done -eu "$1" 'quoted text' grep echo done awk -eu echo then "$@" /usr/bin
+		awk readonly printf local 'quoted text' done echo /usr/bin export $(pwd)
+		cd /usr/bin echo x=1 --verbose 2>/dev/null 'quoted text' echo
+then --verbose cd echo readonly sed test readonly "$@" --verbose test 'quoted text'
+then 'quoted text' grep "$1" sed grep grep | "$@" | -eu | "$1" awk /usr/bin
+	| then printf readonly /usr/bin "$1" && grep 2>/dev/null $(pwd) $(pwd) export
+	awk test grep /usr/bin x=1
+	cd readonly test printf awk ${HOME} "$1" | 'quoted text' x=1 test && --verbose
+awk && && | printf local done &&
+		| cd sed 'quoted text' local $(pwd) printf echo grep sed ${HOME} done
+		printf local sed 'quoted text'
+		readonly sed $(pwd) readonly done ${HOME} grep cd /usr/bin "$1" done local 'quoted text'
+		'quoted text' && ${HOME} sed x=1 --verbose
+		"$1" "$1" test export -eu test then "$@"
+		2>/dev/null --verbose -eu && done
+		then | awk ${HOME} printf done cd $(pwd) --verbose
+--verbose readonly x=1 $(pwd) /usr/bin
+		readonly | echo done | sed local x=1 cd sed 2>/dev/null --verbose
+		test export --verbose ${HOME} export 2>/dev/null
@@ -0,0 +1,2001 @@
+	printf | readonly | /usr/bin
+	&& echo -eu 2>/dev/null
+		2>/dev/null readonly 2>/dev/null | $(pwd) awk sed export ${HOME}
+		echo local readonly && readonly 'quoted text' printf grep
+	echo test ${HOME} 'quoted text' grep ${HOME}
+	sed awk test "$@" "$@" /usr/bin -eu $(pwd)
+cd sed $(pwd) echo x=1 done test x=1 done
+		"$@" printf 'quoted text' "$1" readonly && test |
+export --verbose | cd $(pwd) local grep grep test ${HOME} x=1 "$@" --verbose readonly
+		echo local "$1" cd ${HOME} export then $(pwd) "$@" test
+	printf cd done ${HOME} grep ${HOME} test readonly 'quoted text' -eu 2>/dev/null
+	"$@" 'quoted text' $(pwd) /usr/bin grep
+done | test -eu echo echo "$@" $(pwd) 'quoted text'
+	cd done local /usr/bin $(pwd) then awk then printf then grep sed "$@" /usr/bin
+	--verbose 'quoted text' -eu | 2>/dev/null awk
+	-eu -eu --verbose cd -eu --verbose awk readonly
+	'quoted text' test --verbose --verbose export test 'quoted text'
+		then "$1" 'quoted text' -eu && awk x=1
+grep sed done printf test awk -eu grep
+		--verbose test x=1 /usr/bin
+	--verbose awk 'quoted text' printf --verbose "$1" awk cd printf $(pwd)
+	-eu x=1 done -eu printf done readonly cd ${HOME} awk awk done test $(pwd)
+		grep echo awk | grep cd echo && sed
+		export test /usr/bin "$1" cd cd grep x=1 && cd -eu echo 2>/dev/null
+		-eu "$1" readonly sed "$@" export
+2>/dev/null $(pwd) -eu x=1 2>/dev/null $(pwd) | "$@"
+local && printf done 'quoted text' done --verbose
+		cd echo -eu ${HOME} "$@" then "$@" &&
+local -eu then 2>/dev/null cd sed x=1 printf
+"$@" readonly 'quoted text' readonly then
+	| cd 2>/dev/null --verbose test sed 'quoted text' /usr/bin readonly printf test
+	$(pwd) printf printf | | "$@" $(pwd) done printf test done
+	export done printf $(pwd) "$@" --verbose "$1" -eu | then
+		cd x=1 then printf sed | grep 2>/dev/null | echo -eu grep done
+	cd -eu --verbose sed 2>/dev/null export local cd 'quoted text' "$1" -eu
+		| /usr/bin echo "$@" test /usr/bin local ${HOME} grep 'quoted text' then test
+| | ${HOME} 'quoted text' awk grep $(pwd) | 'quoted text'
+"$1" 'quoted text' export x=1 | grep "$1"
+		grep grep awk done grep x=1
+local 2>/dev/null "$@" awk
+/usr/bin printf x=1 echo 2>/dev/null ${HOME} 2>/dev/null export grep echo
+		| then export echo export done readonly
+	${HOME} cd x=1 grep local cd done then /usr/bin cd printf grep done /usr/bin
+		echo && printf readonly -eu "$1" x=1 local /usr/bin
+		grep x=1 sed local awk cd $(pwd) | readonly x=1 printf
+		test then 'quoted text' local done echo 'quoted text' /usr/bin x=1 | printf printf
+then ${HOME} printf $(pwd)
+done 'quoted text' -eu 2>/dev/null "$1" then | echo "$@" then grep |
+	$(pwd) "$@" 2>/dev/null echo /usr/bin test && test --verbose $(pwd)
+		$(pwd) && sed local /usr/bin grep 2>/dev/null --verbose export cd awk | 'quoted text'
+		| echo x=1 readonly "$1" cd ${HOME} done && "$1"
+grep done local test && test ${HOME} 'quoted text'
+export local /usr/bin ${HOME} sed "$1" then
+		x=1 $(pwd) 'quoted text' local done echo
+	export done ${HOME} done | test printf && test 2>/dev/null
+		"$@" 2>/dev/null --verbose $(pwd) sed $(pwd) cd export test x=1 done
+	'quoted text' printf local 'quoted text'
+test && && "$@" awk /usr/bin export && /usr/bin awk | sed --verbose
+	readonly 2>/dev/null x=1 'quoted text'
+	export sed export done
+-eu -eu $(pwd) done test | done printf test readonly $(pwd) printf
+&& -eu "$@" $(pwd) echo then grep readonly ${HOME} readonly --verbose
+	then then export $(pwd)
+	local 2>/dev/null | done cd --verbose && "$@" awk awk --verbose
+-eu export "$@" 2>/dev/null $(pwd) sed local
+then local awk grep printf
+'quoted text' x=1 "$@"
+	grep grep "$1" then then local readonly "$1" then "$1" printf
+	$(pwd) test ${HOME} && grep | -eu "$1" export test /usr/bin 2>/dev/null grep
+	then readonly cd | /usr/bin | then &&
+	grep done /usr/bin cd awk done sed sed awk /usr/bin
+	export "$1" $(pwd) grep export
+	${HOME} local local grep
+	printf cd done awk && 2>/dev/null echo x=1 printf /usr/bin --verbose ${HOME}
+		x=1 local printf --verbose x=1 awk printf
+		done && x=1 ${HOME} "$@"
+		echo then grep && readonly export $(pwd) "$@" done 2>/dev/null
+		| x=1 done /usr/bin /usr/bin export
+2>/dev/null | -eu local -eu test x=1 cd grep "$@" grep 2>/dev/null
+		--verbose echo done readonly
+--verbose sed then -eu
+sed grep export grep ${HOME}
+		--verbose cd "$1" export echo $(pwd) --verbose $(pwd) local 2>/dev/null "$@" 2>/dev/null
+		sed $(pwd) grep cd sed awk test "$@" grep awk cd done awk && -eu
+	readonly test test readonly "$@" | then then && x=1 export
+		"$@" -eu --verbose then ${HOME} echo "$@" grep done $(pwd)
+	sed --verbose awk 2>/dev/null echo printf 'quoted text' printf grep "$@"
+		readonly done then /usr/bin | sed
+2>/dev/null readonly && | | awk --verbose readonly export awk
+echo test printf && 2>/dev/null
+		done --verbose then 2>/dev/null grep && && 2>/dev/null printf -eu
+	-eu readonly $(pwd) | | then "$@" --verbose 'quoted text'
+		-eu ${HOME} x=1 awk printf then sed grep && done ${HOME} 'quoted text'
+awk "$@" grep /usr/bin $(pwd)
+awk 2>/dev/null test
+${HOME} "$1" awk | readonly cd 2>/dev/null readonly /usr/bin cd readonly | ${HOME}
+$(pwd) x=1 done readonly ${HOME} then cd cd awk test ${HOME} "$@" "$1"
+	x=1 readonly done -eu --verbose /usr/bin
+printf test local ${HOME} test done printf
+		local echo "$@" && echo test 'quoted text'
+		test 2>/dev/null awk 'quoted text' --verbose "$1" "$@" done test cd export
+awk echo 'quoted text' export "$1" | echo /usr/bin 2>/dev/null sed | readonly done
+	sed "$1" && cd printf $(pwd) --verbose awk readonly "$1" test readonly export
+	&& 'quoted text' | local | -eu --verbose ${HOME} cd 'quoted text' -eu "$1"
+		--verbose grep "$@" 2>/dev/null
+local grep 2>/dev/null grep readonly
+| sed grep 2>/dev/null then sed $(pwd) 2>/dev/null
+		-eu sed "$1" cd && 2>/dev/null done | "$@" -eu "$1"
+	printf --verbose x=1 then sed
+"$1" /usr/bin /usr/bin local x=1 $(pwd) 'quoted text'
+		done echo /usr/bin test cd $(pwd) "$1" 2>/dev/null export --verbose 'quoted text'
+	2>/dev/null ${HOME} sed /usr/bin
+| -eu export /usr/bin ${HOME}
+	sed printf echo grep cd
+	-eu 2>/dev/null sed 'quoted text' test export local then "$1" echo echo
+		"$@" "$1" $(pwd) then --verbose cd export x=1
+'quoted text' local "$1" $(pwd) x=1 test "$1" 'quoted text' "$1" readonly $(pwd)
+		2>/dev/null export readonly x=1 | "$@" local 2>/dev/null printf 'quoted text'
+"$1" printf $(pwd) echo export echo -eu cd
+	"$@" /usr/bin done readonly awk $(pwd) ${HOME} test | done "$@" "$@"
+test -eu | /usr/bin --verbose done printf x=1 sed grep cd -eu /usr/bin
+		${HOME} --verbose cd 2>/dev/null sed /usr/bin | grep
+	2>/dev/null 'quoted text' x=1 "$@"
+sed && x=1 "$@" readonly echo | awk ${HOME} then grep 'quoted text' |
+		"$1" && /usr/bin ${HOME} then $(pwd) --verbose
+		"$@" $(pwd) 'quoted text' x=1 then printf /usr/bin "$1" 2>/dev/null
+test test x=1 -eu then x=1 -eu done -eu /usr/bin
+		"$1" awk $(pwd) cd local cd && then local
+awk grep cd | | then printf
+	| local readonly printf 'quoted text' done grep $(pwd) then then -eu then cd
+"$1" awk ${HOME} grep -eu ${HOME} printf | readonly readonly export
+	"$@" printf 'quoted text' /usr/bin readonly | printf test x=1
+	"$1" $(pwd) "$1" awk && sed $(pwd) "$1"
+done "$@" printf 'quoted text'
+test local then printf export "$1" readonly test grep /usr/bin &&
+	printf awk /usr/bin -eu done $(pwd) echo x=1 export "$1" awk "$1" "$1" /usr/bin
+		"$1" printf awk "$1" 2>/dev/null awk printf done /usr/bin | echo readonly
+"$1" then export $(pwd) 'quoted text' "$@" "$1"
+	-eu | "$@" export sed cd /usr/bin 2>/dev/null
+	grep grep done 2>/dev/null
+		then echo local local readonly ${HOME} done cd | "$@" 2>/dev/null
+&& printf local --verbose 'quoted text'
+readonly "$@" 2>/dev/null /usr/bin done
+echo x=1 export awk readonly /usr/bin
+	cd then cd 'quoted text' local readonly grep && --verbose
+	&& 2>/dev/null test "$@" export awk grep test export
+awk 2>/dev/null export "$@" test 'quoted text'
+awk printf awk $(pwd) done printf test test && x=1 grep
+		grep -eu test then printf readonly printf ${HOME} "$1" -eu x=1 'quoted text'
+	sed && then --verbose /usr/bin test 2>/dev/null
+done 2>/dev/null then 'quoted text'
+		2>/dev/null grep grep echo local
+		--verbose /usr/bin awk
+		"$@" /usr/bin printf then export
+test grep export "$@" ${HOME} 2>/dev/null then
+then readonly 'quoted text' cd x=1 "$1" test $(pwd) "$@" && awk readonly
+		${HOME} done readonly 'quoted text' && echo --verbose
+		/usr/bin echo --verbose x=1 /usr/bin
+/usr/bin printf 2>/dev/null 'quoted text' printf then |
+		awk readonly awk x=1 $(pwd) local "$@"
+&& x=1 echo export "$1" awk cd test grep sed readonly
+	"$1" && --verbose ${HOME} readonly test export awk
+		printf sed then cd sed | echo 2>/dev/null echo sed
+	awk x=1 printf then --verbose --verbose awk awk ${HOME} test
+	local x=1 awk 'quoted text' "$@" readonly | "$1" |
+		&& ${HOME} local -eu /usr/bin sed x=1 x=1 sed awk $(pwd)
+	"$1" /usr/bin $(pwd) x=1 ${HOME} printf export ${HOME} then local
+${HOME} ${HOME} local | cd echo
+	'quoted text' sed ${HOME} readonly cd sed 2>/dev/null local "$1"
+	readonly echo test sed "$@" awk $(pwd)
+		sed local && "$1" printf --verbose test 'quoted text' local echo "$@" readonly
+	grep export 2>/dev/null cd
+		2>/dev/null test done grep -eu | echo
+	echo ${HOME} local local awk echo | echo printf /usr/bin export local sed "$@"
+cd "$@" cd && ${HOME} export | | &&
+		-eu | "$@" printf | grep $(pwd) /usr/bin
+		sed printf test printf sed test
+echo then /usr/bin cd "$1" -eu "$@" sed && "$1" $(pwd) -eu |
+		echo local ${HOME} 'quoted text' cd |
+		"$@" $(pwd) && echo x=1 cd x=1 printf export
+	&& -eu local readonly done export test cd /usr/bin
+	local | /usr/bin done |
+		"$@" echo local export then awk done printf 'quoted text'
+	sed "$@" printf --verbose x=1 awk "$@" then cd
+		test then done test x=1 sed
+	test --verbose -eu done && --verbose
+		echo awk --verbose 2>/dev/null test 'quoted text' cd echo x=1 | then -eu
+'quoted text' "$@" test readonly grep
+echo printf $(pwd) && printf
+"$@" printf "$1" -eu sed $(pwd)
+export local "$@" /usr/bin $(pwd) printf $(pwd) -eu awk then ${HOME} cd $(pwd)
+		echo --verbose && | sed then x=1 then $(pwd) local
+$(pwd) 'quoted text' -eu then x=1 local && ${HOME} ${HOME}
+	done /usr/bin ${HOME} cd test echo printf awk sed ${HOME} done awk -eu
+		then $(pwd) 2>/dev/null done printf local
+readonly local readonly readonly | $(pwd) then cd && echo 'quoted text'
+	test 2>/dev/null export grep
+	"$1" "$1" export /usr/bin readonly awk cd
+	then readonly 2>/dev/null test $(pwd)
+	2>/dev/null then "$@" test
+		&& "$1" /usr/bin then
+	export && grep $(pwd) readonly printf && /usr/bin 'quoted text'
+	awk "$@" readonly cd sed --verbose awk | printf 2>/dev/null | /usr/bin
+	printf $(pwd) grep 'quoted text'
+cd 'quoted text' echo x=1
+		then -eu x=1 readonly readonly "$1" test && echo done sed readonly
+		export -eu done -eu x=1 $(pwd)
+echo x=1 grep $(pwd) local
+		grep sed | local grep grep export && "$@" "$@" --verbose printf $(pwd) --verbose
+2>/dev/null 2>/dev/null done | -eu awk echo $(pwd)
+		2>/dev/null echo $(pwd) | "$1" 'quoted text' x=1 then sed "$@"
+		test && --verbose /usr/bin cd echo
+	test 2>/dev/null done
+grep --verbose | printf "$@" ${HOME} x=1 printf
+	$(pwd) ${HOME} readonly
+2>/dev/null --verbose done echo -eu "$@" local | | printf | -eu
+		awk export printf --verbose | "$@"
+--verbose cd local && "$@" export echo export then
+done printf awk printf test -eu awk --verbose then readonly "$1"
+x=1 local "$1" export -eu local /usr/bin x=1 "$@" done printf |
+	2>/dev/null $(pwd) awk awk readonly then readonly /usr/bin ${HOME}
+		test x=1 export grep ${HOME}
+	${HOME} /usr/bin then --verbose 'quoted text' | && echo ${HOME} x=1 |
+		awk grep export && done
+	$(pwd) done grep sed test x=1 test export grep x=1 test printf
+	grep 2>/dev/null readonly /usr/bin done awk ${HOME} | cd /usr/bin -eu /usr/bin
+		test --verbose 'quoted text'
+done "$1" grep printf
+	"$@" cd $(pwd) /usr/bin echo grep && 'quoted text' ${HOME} then test --verbose
+	x=1 then $(pwd) echo -eu ${HOME} done -eu readonly && x=1 && x=1 echo x=1 local
+"$1" ${HOME} readonly | done | sed sed done export
+	&& cd 'quoted text' --verbose awk | done then sed $(pwd) $(pwd) test export
+		cd then 2>/dev/null export $(pwd) -eu grep export 'quoted text' /usr/bin
+	readonly echo && echo cd cd then | "$1" 2>/dev/null
+		x=1 "$@" test -eu local local readonly echo ${HOME} export ${HOME}
+		"$1" | "$@" | | awk 2>/dev/null awk
+| 'quoted text' readonly printf $(pwd)
+awk awk export echo readonly /usr/bin /usr/bin echo awk then ${HOME} /usr/bin
+		&& "$@" -eu test export readonly local echo $(pwd) /usr/bin
+	"$@" echo 2>/dev/null echo done "$@" && "$@" local -eu readonly x=1 test "$@"
+	--verbose done x=1 "$@" printf "$@" 'quoted text' x=1 done
+	cd sed sed "$@" --verbose echo sed ${HOME} ${HOME}
+echo sed readonly test export sed cd | test local | | test --verbose
+		-eu cd grep 2>/dev/null then
+	sed export readonly local --verbose readonly sed x=1 "$@" "$@" test printf then
+	| then /usr/bin local /usr/bin
+	awk grep ${HOME} grep grep ${HOME} readonly cd test "$@" "$1" -eu export done
+		"$1" --verbose awk printf /usr/bin /usr/bin
+		local sed cd --verbose printf 'quoted text' export x=1 2>/dev/null
+		sed --verbose 'quoted text' && ${HOME} cd awk
+printf awk local ${HOME} | $(pwd) sed 2>/dev/null done readonly
+	export printf readonly
+local test test export done --verbose awk --verbose local local $(pwd) ${HOME}
+test then sed grep printf readonly local
+	then local sed readonly readonly
+echo sed --verbose export "$@" cd --verbose then then echo /usr/bin $(pwd) |
+	-eu -eu test 2>/dev/null
+		&& 2>/dev/null | test -eu 'quoted text'
+local | then ${HOME} --verbose awk done printf
+		| "$1" && awk --verbose awk then
+sed local export "$1" "$1" 2>/dev/null 'quoted text' cd -eu "$@" done $(pwd) local
+		--verbose | "$1" /usr/bin then cd && done grep | then --verbose cd printf $(pwd)
+	done 2>/dev/null && ${HOME} grep readonly
+		"$@" sed local "$1" readonly "$@" echo awk export local ${HOME} awk awk -eu
+	cd grep /usr/bin $(pwd) "$1" -eu grep "$@" | echo 'quoted text'
+readonly 2>/dev/null grep x=1 printf printf ${HOME} done -eu grep -eu
+		'quoted text' test --verbose 2>/dev/null grep export
+grep then && 'quoted text' cd printf 2>/dev/null /usr/bin
+	then grep done "$1" done cd export readonly ${HOME} x=1 local && grep
+	local 2>/dev/null printf $(pwd) 'quoted text' ${HOME} "$1" $(pwd)
+		--verbose x=1 then /usr/bin printf printf | local
+$(pwd) -eu /usr/bin then done grep ${HOME} export x=1 done awk /usr/bin grep
+	cd "$@" 'quoted text' 2>/dev/null "$@" printf
+		| "$1" test | x=1 x=1 test /usr/bin done readonly
+		| && | echo local 'quoted text' -eu -eu --verbose ${HOME} then done ${HOME} "$1"
+		x=1 test readonly awk $(pwd) && sed done "$1" 2>/dev/null
+	done export $(pwd) | | grep $(pwd) echo awk /usr/bin -eu printf
+	| grep 2>/dev/null done echo "$@" && local "$@" "$@"
+/usr/bin --verbose --verbose readonly
+	"$1" ${HOME} awk /usr/bin "$@" sed sed $(pwd) $(pwd) "$1"
+	grep $(pwd) sed test 'quoted text'
+cd 'quoted text' cd sed -eu --verbose 2>/dev/null /usr/bin readonly 'quoted text'
+	readonly 'quoted text' /usr/bin | then "$1" /usr/bin
+	'quoted text' local | -eu done x=1 printf test | echo local printf
+		-eu printf export done test "$@" test
+	cd --verbose cd done done $(pwd) "$1" 'quoted text' echo printf export
+		-eu readonly cd -eu local sed done ${HOME} 'quoted text'
+2>/dev/null done --verbose | ${HOME}
+	"$1" -eu "$1" readonly "$1" awk sed export | grep sed --verbose
+	done ${HOME} then /usr/bin && 'quoted text' then
+${HOME} --verbose && | grep && grep "$1" $(pwd)
+		cd then export "$@" echo awk sed sed done then
+	| sed grep grep $(pwd) test
+	--verbose sed "$@" done export && readonly then local local /usr/bin local $(pwd)
+${HOME} ${HOME} sed && $(pwd)
+	printf /usr/bin /usr/bin "$@" | export --verbose then -eu 2>/dev/null export cd
+		echo printf local grep 'quoted text'
+		&& -eu "$1" $(pwd) grep --verbose --verbose readonly
+	/usr/bin cd echo "$1" | && done then ${HOME} awk x=1
+	'quoted text' awk test export 2>/dev/null 'quoted text' local
+export x=1 | readonly awk "$@" && printf "$@" --verbose 2>/dev/null "$@" 'quoted text'
+/usr/bin && echo then 2>/dev/null awk awk test && awk ${HOME} ${HOME} "$@" --verbose
+	'quoted text' --verbose "$@" x=1 | ${HOME} cd printf "$@" ${HOME}
+	/usr/bin "$1" | && readonly local awk x=1 "$@" && export $(pwd) done 'quoted text'
+printf test echo printf 2>/dev/null
+readonly printf "$@" | --verbose export done /usr/bin "$@" test |
+		x=1 done 'quoted text' --verbose 2>/dev/null
+		echo grep | -eu echo 2>/dev/null local printf /usr/bin
+done sed grep ${HOME} cd done 'quoted text'
+	echo x=1 "$@" "$@" x=1 grep | /usr/bin
+"$1" cd $(pwd) "$@" sed then then export --verbose
+	$(pwd) cd ${HOME} printf 2>/dev/null readonly -eu ${HOME}
+		'quoted text' readonly export printf ${HOME}
+	"$1" && ${HOME} | awk export
+	export test echo 'quoted text' grep
+/usr/bin test "$@" printf 'quoted text' /usr/bin export
+		then local -eu x=1 local sed --verbose echo sed --verbose readonly ${HOME} /usr/bin
+	-eu 2>/dev/null export "$1" "$1" readonly test then | 'quoted text' /usr/bin grep
+	-eu --verbose ${HOME} test $(pwd) test ${HOME} 'quoted text' |
+	cd 'quoted text' 2>/dev/null then x=1 | "$@" readonly -eu then
+		cd x=1 test done -eu "$1" then done | && x=1 cd ${HOME} 'quoted text'
+	readonly local "$1" -eu -eu ${HOME} "$@" --verbose /usr/bin $(pwd)
+		grep export | export readonly && --verbose echo | && cd sed | test
+&& 2>/dev/null echo 2>/dev/null grep
+		cd "$1" done "$1" "$1"
+	'quoted text' test --verbose 'quoted text' | sed /usr/bin
+test ${HOME} ${HOME} "$@" 2>/dev/null --verbose 2>/dev/null export
+done -eu readonly local awk
+	export echo sed --verbose export &&
+done x=1 && test 'quoted text' --verbose x=1 ${HOME}
+		/usr/bin 'quoted text' grep
+	local then 2>/dev/null && "$1" local local awk test then
+	$(pwd) /usr/bin 'quoted text' awk "$1" 'quoted text' printf done printf | export
+		$(pwd) test -eu x=1 printf | grep -eu awk test export printf then export
+	2>/dev/null 'quoted text' x=1 cd echo test test grep awk 2>/dev/null
+	echo x=1 "$@" printf ${HOME} /usr/bin export cd "$@" done 2>/dev/null | | cd 'quoted text'
+echo 2>/dev/null printf sed && done sed export --verbose grep printf "$@" "$@"
+local then grep "$1" $(pwd) && then ${HOME} x=1 /usr/bin /usr/bin printf
+	${HOME} sed sed grep then -eu readonly "$1" then | ${HOME} awk -eu export
+	${HOME} 'quoted text' -eu "$@" x=1 $(pwd) ${HOME} printf readonly sed | readonly
+	test /usr/bin export done ${HOME} sed | awk "$1" --verbose -eu | test --verbose
+	awk -eu readonly | done done done ${HOME} --verbose
+		/usr/bin ${HOME} 2>/dev/null && x=1 test grep echo 2>/dev/null echo ${HOME} 'quoted text'
+		grep grep local export sed /usr/bin done | cd --verbose
+	/usr/bin sed 'quoted text' printf
+	awk -eu ${HOME} $(pwd) ${HOME} test --verbose
+	sed | 2>/dev/null 2>/dev/null && cd export "$@" readonly /usr/bin
+	echo echo then grep | done | ${HOME}
+		2>/dev/null sed then grep $(pwd) echo sed then then $(pwd) echo
+	then x=1 done $(pwd) local
+		readonly --verbose local ${HOME}
+grep 2>/dev/null local readonly ${HOME} sed done 2>/dev/null ${HOME}
+	/usr/bin done -eu cd 'quoted text' /usr/bin sed local --verbose then
+grep export "$1" then /usr/bin readonly readonly
+		local test export --verbose ${HOME} /usr/bin cd test then echo local done
+		&& awk -eu --verbose "$@" /usr/bin "$1" 2>/dev/null
+export 2>/dev/null | --verbose
+		"$@" then printf cd && test printf -eu awk export grep "$@"
+		test export $(pwd) "$@" "$1" 'quoted text' && "$1" $(pwd) printf "$@"
+		test 'quoted text' "$1" readonly
+	"$1" test ${HOME} echo then awk 2>/dev/null done
+		then printf done echo x=1 2>/dev/null
+	grep 'quoted text' echo sed then cd sed readonly ${HOME} ${HOME} printf "$1"
+	-eu awk test $(pwd) ${HOME} -eu /usr/bin awk |
+		awk /usr/bin sed "$@" readonly local | test -eu --verbose test
+		grep -eu && /usr/bin readonly echo "$@" local | local done 2>/dev/null
+'quoted text' x=1 done readonly cd 2>/dev/null /usr/bin
+	/usr/bin awk 2>/dev/null /usr/bin done test readonly 'quoted text' cd test
+x=1 cd cd --verbose grep $(pwd) then local $(pwd) grep 2>/dev/null $(pwd) 2>/dev/null
+	--verbose 'quoted text' $(pwd) -eu $(pwd)
+	"$@" -eu readonly done 'quoted text' 'quoted text' test
+	cd 'quoted text' ${HOME} x=1 2>/dev/null --verbose awk test local sed x=1 echo /usr/bin
+x=1 --verbose printf local 'quoted text'
+		printf /usr/bin printf local readonly awk local && && readonly
+	"$@" awk readonly 2>/dev/null then test 'quoted text' echo echo echo
+'quoted text' printf grep done --verbose "$1" /usr/bin 2>/dev/null cd done test
+	$(pwd) grep echo "$1" | cd
+	local "$@" -eu cd --verbose awk ${HOME} &&
+readonly /usr/bin cd |
+		test "$@" local then && readonly 'quoted text' export "$1" $(pwd) --verbose
+local 2>/dev/null grep printf grep x=1 export $(pwd)
+	--verbose ${HOME} "$1" /usr/bin export awk | -eu echo x=1 --verbose 2>/dev/null
+	export then "$1" echo $(pwd) 2>/dev/null printf --verbose awk
+export export | awk ${HOME} 'quoted text'
+"$1" $(pwd) $(pwd) x=1 --verbose | ${HOME}
+		sed grep "$@" done printf
+printf local && then /usr/bin "$1" echo 2>/dev/null
+x=1 grep done 'quoted text'
+${HOME} local 'quoted text'
+"$1" /usr/bin | test readonly
+		${HOME} grep "$1" "$@" cd | "$1" printf awk
+	cd export /usr/bin cd then then printf -eu readonly then $(pwd) 2>/dev/null
+		cd printf echo $(pwd) $(pwd) ${HOME} "$@" local "$@" awk |
+		x=1 echo grep cd -eu -eu /usr/bin export export sed -eu $(pwd) "$@"
+${HOME} awk grep cd $(pwd)
+		cd "$1" export -eu 'quoted text' grep /usr/bin ${HOME}
+	"$1" awk local grep export export
+/usr/bin readonly | $(pwd) &&
+--verbose && x=1 awk ${HOME} then readonly local "$@" readonly
+	printf | cd readonly done ${HOME}
+/usr/bin 2>/dev/null "$1" done then x=1 awk $(pwd)
+	"$@" sed readonly sed
+done /usr/bin --verbose 2>/dev/null --verbose
+printf done ${HOME} awk /usr/bin "$1" "$@" printf $(pwd) --verbose then
+	${HOME} $(pwd) cd ${HOME}
+	-eu x=1 x=1 then "$1" -eu echo "$@" done | && grep sed /usr/bin ${HOME} local
+	awk | x=1 && 2>/dev/null awk $(pwd) ${HOME} cd awk -eu x=1 local done
+	"$@" grep awk test grep && && sed 2>/dev/null
+grep -eu 2>/dev/null /usr/bin | "$1" | then done done then then --verbose
+	readonly echo cd 'quoted text' x=1 awk test grep done
+	$(pwd) $(pwd) echo --verbose printf && cd readonly echo sed echo --verbose
+		awk grep ${HOME} then | "$@"
+		readonly x=1 awk $(pwd) /usr/bin
+then then readonly $(pwd) x=1 local sed && 2>/dev/null export echo done $(pwd)
+	/usr/bin export $(pwd) test awk test "$1" local test
+		&& $(pwd) export x=1 "$1" 'quoted text' cd $(pwd) $(pwd) local then test
+		"$1" && ${HOME} done $(pwd) 2>/dev/null local printf
+	grep awk awk awk && ${HOME} |
+/usr/bin awk 'quoted text' sed 2>/dev/null
+	then sed $(pwd) "$1" && awk cd &&
+		local awk 'quoted text' grep grep sed cd awk awk -eu done /usr/bin sed
+	&& done then /usr/bin x=1 cd x=1 && ${HOME} done then "$@" && && local $(pwd)
+	"$1" awk $(pwd) test && sed echo --verbose "$1" ${HOME} export echo "$1"
+	| printf -eu test awk ${HOME} && 'quoted text'
+		printf done printf done ${HOME} --verbose && done
+		--verbose awk "$@" --verbose 2>/dev/null ${HOME} awk 'quoted text' $(pwd) x=1 &&
+		-eu | ${HOME} echo test "$1" readonly 'quoted text'
+		done grep x=1 grep && then | sed ${HOME} cd local
+	"$@" && x=1 test test printf 2>/dev/null local "$@" grep 'quoted text'
+	${HOME} "$1" $(pwd) printf ${HOME} printf 2>/dev/null "$1" /usr/bin readonly 2>/dev/null
+	--verbose cd x=1 test && ${HOME}
+		cd printf local | printf ${HOME} cd x=1 'quoted text' echo
+'quoted text' 2>/dev/null $(pwd) -eu
+x=1 "$1" awk "$@" then "$@" x=1 printf
+	"$@" --verbose "$@" done test readonly "$@" sed grep test x=1 2>/dev/null 'quoted text'
+| awk test printf "$1" "$1" readonly $(pwd) "$@" printf echo
+		done test awk cd cd 'quoted text' awk printf
+		test export printf /usr/bin
+	-eu then cd -eu sed && && 2>/dev/null && --verbose test done grep
+awk "$@" $(pwd) $(pwd) export export 2>/dev/null done readonly --verbose
+		$(pwd) awk grep "$1" echo --verbose cd grep cd printf "$@" printf 2>/dev/null
+	local export local 2>/dev/null -eu grep 'quoted text' test ${HOME}
+$(pwd) echo /usr/bin export echo -eu echo cd local test awk sed echo awk --verbose
+		&& printf sed done --verbose && "$1" done ${HOME} echo --verbose
+	&& $(pwd) sed export cd echo && cd done ${HOME} readonly $(pwd) cd readonly then
+	--verbose 'quoted text' --verbose printf grep sed export test
+		--verbose awk local echo "$1" && $(pwd) --verbose test printf "$@"
+		then done x=1 done 'quoted text' sed x=1 'quoted text'
+		awk test local | echo done
+		"$@" -eu printf sed $(pwd) ${HOME} && 'quoted text' sed export then 'quoted text'
+		test --verbose ${HOME}
+	2>/dev/null export | grep 'quoted text'
+		| /usr/bin $(pwd) "$@" --verbose then 2>/dev/null | done then cd
+		awk readonly -eu cd ${HOME} | /usr/bin
+		&& && test test /usr/bin
+	printf && 2>/dev/null awk local local
+		x=1 x=1 /usr/bin && -eu awk sed then cd
+awk cd -eu awk && 'quoted text' "$1" $(pwd) ${HOME}
+		cd 'quoted text' cd grep
+"$@" $(pwd) x=1 $(pwd) --verbose cd 'quoted text' then grep 'quoted text' then
+	done export $(pwd) local test sed
+	&& then sed export test cd /usr/bin
+sed --verbose grep done && /usr/bin "$1" cd awk 'quoted text'
+done printf --verbose done --verbose && /usr/bin x=1
+	-eu $(pwd) $(pwd) export 2>/dev/null "$@" 2>/dev/null "$1" awk echo "$@" local
+		--verbose grep done printf grep export local
+		cd local --verbose readonly "$@" /usr/bin export
+		awk --verbose sed --verbose 2>/dev/null /usr/bin grep then readonly x=1
+	&& cd && /usr/bin then
+	test 'quoted text' local awk --verbose 'quoted text'
+then | x=1 printf cd -eu &&
+		/usr/bin "$1" then ${HOME} $(pwd)
+awk cd test && done /usr/bin $(pwd) then test readonly "$1" $(pwd) awk done
+		&& readonly cd done 2>/dev/null cd sed | awk
+	$(pwd) 2>/dev/null /usr/bin "$1" readonly local ${HOME}
+		test "$1" 'quoted text' cd then grep grep 2>/dev/null
+test /usr/bin 2>/dev/null
+	done local x=1 && printf test grep $(pwd) $(pwd) printf test 'quoted text'
+| x=1 printf --verbose local grep then printf && sed --verbose --verbose 'quoted text'
+		readonly 2>/dev/null
+	'quoted text' --verbose | | 2>/dev/null $(pwd) export ${HOME} cd 'quoted text'
+readonly sed awk -eu test | ${HOME} && test "$1"
+then test awk echo 2>/dev/null | x=1 | export 2>/dev/null
+/usr/bin 2>/dev/null cd 'quoted text' $(pwd) --verbose test ${HOME} printf
+test -eu && done $(pwd) $(pwd) then echo -eu /usr/bin cd -eu | readonly
+		"$1" export local 2>/dev/null ${HOME} sed echo test
+--verbose cd x=1 ${HOME} grep | "$1" x=1 local --verbose awk grep
+		| $(pwd) done "$@" "$1" then grep printf && export -eu sed then && $(pwd)
+		"$@" readonly printf then test 2>/dev/null 2>/dev/null
+--verbose readonly sed
+/usr/bin export printf "$@"
+		export && echo ${HOME} | 'quoted text' export "$@" && done test "$1" --verbose export
+		2>/dev/null ${HOME} x=1 local
+		then grep "$1" export done "$1" x=1 /usr/bin | "$@"
+		cd --verbose /usr/bin ${HOME} grep grep printf printf /usr/bin "$1" 2>/dev/null
+		| 2>/dev/null test && "$1" ${HOME} | $(pwd) export
+	local /usr/bin x=1 $(pwd) sed $(pwd) $(pwd) x=1 done |
+	--verbose | | echo done cd 2>/dev/null awk 2>/dev/null then sed echo
+		2>/dev/null 'quoted text' -eu "$1" grep "$1" test sed awk "$@" printf
+awk readonly readonly readonly "$1" readonly
+test echo test 'quoted text' awk grep -eu
+		then export awk then sed -eu export grep export
+		readonly 2>/dev/null printf export sed ${HOME} 2>/dev/null
+test awk printf awk export test && cd 2>/dev/null echo "$@" sed grep $(pwd)
+local awk echo awk x=1 'quoted text' done export test "$@" echo
+		sed test x=1 done awk readonly
+2>/dev/null ${HOME} ${HOME} export local --verbose done readonly sed
+	x=1 readonly && cd sed readonly x=1 x=1 x=1 grep
+		local /usr/bin && 'quoted text' -eu "$@" then "$1" -eu "$@" | "$1"
+	-eu -eu test && echo 'quoted text' sed done printf cd then 'quoted text' "$1" echo
+		readonly | done then grep 'quoted text' cd readonly /usr/bin 2>/dev/null /usr/bin
+-eu $(pwd) $(pwd) "$@" readonly awk ${HOME} grep
+local x=1 readonly local $(pwd) cd ${HOME} "$1" &&
+		2>/dev/null printf "$1"
+"$@" 'quoted text' done x=1 2>/dev/null $(pwd) 'quoted text'
+		"$1" -eu "$@" echo 'quoted text' export /usr/bin 2>/dev/null
+-eu /usr/bin x=1 "$1" ${HOME} test then
+	grep --verbose awk /usr/bin cd done export
+	grep grep | export | awk export $(pwd) ${HOME} readonly &&
+	test echo "$@" $(pwd) awk && 2>/dev/null $(pwd)
+		local | 'quoted text' x=1 "$1" |
+		| "$@" -eu grep printf awk then "$1" $(pwd)
+	done export printf readonly sed -eu readonly cd readonly ${HOME}
+	done readonly echo 'quoted text'
+cd grep export "$1" | readonly --verbose printf $(pwd) && local echo done
+		local -eu done /usr/bin readonly
+export | --verbose grep -eu awk local then then done then sed "$@" x=1 2>/dev/null
+		cd sed done echo then cd readonly "$1"
+		/usr/bin done grep && local 'quoted text' test /usr/bin ${HOME}
+		test cd /usr/bin && export
+	'quoted text' sed | 2>/dev/null -eu 'quoted text' x=1 2>/dev/null
+"$1" grep printf /usr/bin printf sed cd --verbose
+	printf local "$1" --verbose --verbose ${HOME} | "$1" $(pwd) 2>/dev/null
+test printf | | ${HOME} | sed printf export ${HOME} x=1 $(pwd)
+| --verbose done awk printf
+		'quoted text' 'quoted text' printf local echo 2>/dev/null
+		2>/dev/null awk /usr/bin export sed
+2>/dev/null cd sed $(pwd) --verbose x=1 --verbose readonly
+		"$1" --verbose -eu "$1" printf 'quoted text' "$@" sed then
+		--verbose grep 'quoted text' && readonly | then ${HOME} "$1" sed echo echo
+		"$1" test -eu local cd 2>/dev/null
+		| "$@" printf -eu 'quoted text'
+| -eu then | test test -eu ${HOME} test then
+		--verbose $(pwd) 2>/dev/null test export
+	/usr/bin 2>/dev/null x=1 "$1" local grep 2>/dev/null echo 2>/dev/null
+	${HOME} test "$1" test -eu awk sed "$1" &&
+/usr/bin $(pwd) readonly printf test then awk local
+		then "$@" 2>/dev/null then test local sed x=1 && grep && grep export echo then
+x=1 $(pwd) cd ${HOME} /usr/bin echo readonly --verbose "$@" done
+${HOME} "$@" --verbose export "$1"
+	--verbose export | then cd $(pwd) 'quoted text'
+		/usr/bin | local awk grep "$@" export readonly awk "$@"
+		cd $(pwd) | awk 'quoted text' && cd 'quoted text' local "$@" /usr/bin
+		"$1" readonly readonly echo local grep --verbose | then ${HOME} cd "$1" done readonly
+	sed /usr/bin $(pwd) sed | "$1" "$@" "$1" cd test /usr/bin
+	"$1" "$1" "$1" | ${HOME} "$@" awk "$@" readonly cd awk
+	/usr/bin 2>/dev/null printf done -eu then
+		--verbose export ${HOME} done "$@" local then local "$1" && | local -eu $(pwd)
+		awk cd export export "$@" done cd printf printf --verbose
+	done export 2>/dev/null done ${HOME} | | 2>/dev/null
+	"$1" $(pwd) printf 'quoted text' && && --verbose
+		$(pwd) echo 'quoted text' $(pwd) sed /usr/bin
+test then 'quoted text' local -eu cd cd sed local &&
+sed awk ${HOME} /usr/bin x=1 $(pwd)
+	done export ${HOME} local /usr/bin local x=1 'quoted text' 'quoted text'
+	--verbose done x=1 -eu local export 'quoted text' -eu -eu then readonly 'quoted text'
+--verbose local /usr/bin done "$1" export
+		readonly test done local local "$@" 'quoted text'
+awk echo "$@" cd "$1" printf 'quoted text' done echo $(pwd) printf
+&& "$@" 2>/dev/null "$1" 'quoted text'
+readonly sed 'quoted text' cd 'quoted text' then test $(pwd)
+	${HOME} "$@" && 2>/dev/null $(pwd) && cd grep
+	local "$@" echo readonly -eu grep "$@"
+		2>/dev/null awk $(pwd) /usr/bin awk -eu && readonly ${HOME} $(pwd)
+readonly printf -eu x=1 done test && $(pwd) awk -eu -eu export /usr/bin then
+	| "$@" x=1 ${HOME} -eu 2>/dev/null
+/usr/bin "$@" done 2>/dev/null export
+	'quoted text' cd 'quoted text'
+	/usr/bin x=1 then test $(pwd)
+		then local x=1 -eu test x=1 awk test 'quoted text'
+export && --verbose /usr/bin
+		--verbose grep && sed then grep | $(pwd) test test printf cd 'quoted text' readonly
+		"$1" local x=1 sed 'quoted text' && export 'quoted text' done test awk printf
+		printf awk test readonly sed -eu -eu local echo then | 2>/dev/null printf
+		echo "$1" local done sed printf 2>/dev/null
+	grep $(pwd) "$@" 2>/dev/null "$@" /usr/bin
+		&& "$@" "$@" test awk awk done -eu cd then awk sed test && 'quoted text'
+"$1" then x=1 | 2>/dev/null test | cd && 'quoted text'
+		done echo 'quoted text' test && export local readonly
+	sed grep done readonly export sed "$@" ${HOME} 2>/dev/null "$@" export
+		awk readonly --verbose --verbose echo 2>/dev/null cd --verbose ${HOME} export
+		$(pwd) 'quoted text' local cd printf /usr/bin
+		then 2>/dev/null cd test $(pwd) 2>/dev/null "$@" test
+		"$@" printf test readonly local ${HOME} sed local
+	'quoted text' $(pwd) test ${HOME} sed -eu printf | awk $(pwd) --verbose "$1"
+		'quoted text' $(pwd) grep grep "$@" ${HOME} "$1" ${HOME}
+		x=1 test "$1" "$1" readonly local 2>/dev/null
+		done $(pwd) ${HOME} done 'quoted text' test grep
+		then 2>/dev/null cd local x=1 "$1" awk export | grep
+	2>/dev/null cd x=1 export done && done
+	local "$@" export /usr/bin then sed --verbose
+		done readonly then grep echo /usr/bin x=1 | 'quoted text'
+sed then awk grep done $(pwd) x=1 | printf sed 'quoted text' grep x=1
+done && -eu "$@" | sed grep $(pwd) /usr/bin readonly test && "$@" && printf
+	&& "$1" ${HOME} readonly test echo local
+		--verbose ${HOME} ${HOME} 2>/dev/null "$1" /usr/bin
+		sed /usr/bin "$1" /usr/bin x=1 | "$1" "$@" awk sed sed sed grep
+printf "$@" local ${HOME} --verbose printf
+	x=1 -eu && x=1 ${HOME} | --verbose printf printf export | sed echo sed readonly
+	2>/dev/null grep cd local "$@" x=1 sed printf local
+	-eu x=1 'quoted text' "$1" -eu readonly readonly
+		x=1 ${HOME} ${HOME} --verbose then export export
+	grep $(pwd) --verbose $(pwd) && "$@" readonly cd x=1 2>/dev/null 2>/dev/null
+2>/dev/null awk x=1 -eu && local cd 'quoted text'
+	'quoted text' 2>/dev/null "$@" printf "$@" cd && && -eu cd "$1" -eu "$1" local
+	echo echo --verbose "$@" awk grep echo $(pwd) grep export
+	cd 'quoted text' awk "$1" ${HOME} x=1 done grep awk done
+--verbose && grep test -eu
+"$@" "$1" --verbose | readonly cd readonly
+		--verbose -eu $(pwd) done && /usr/bin readonly
+x=1 done grep && ${HOME} export then
+	/usr/bin grep awk /usr/bin export done done && x=1 --verbose x=1
+export local test export test readonly sed then $(pwd) ${HOME} export
+	readonly --verbose "$@" -eu 'quoted text' then local -eu export 'quoted text'
+echo readonly echo && && /usr/bin then -eu export --verbose
+"$@" ${HOME} x=1 -eu export | export --verbose echo awk cd grep done
+readonly sed 'quoted text'
+		readonly echo local --verbose "$1" 'quoted text'
+"$1" --verbose cd done 'quoted text' echo ${HOME} then /usr/bin && cd --verbose
+		"$@" readonly readonly -eu
+	awk export ${HOME} /usr/bin x=1 --verbose cd done /usr/bin x=1 -eu printf
+	-eu "$1" readonly /usr/bin test x=1 done x=1 test /usr/bin "$@" then $(pwd)
+		"$1" sed readonly "$@" | awk grep test | echo $(pwd) readonly
+	local done 2>/dev/null 'quoted text' test --verbose /usr/bin && test readonly $(pwd)
+	done cd readonly printf -eu sed
+local awk printf echo readonly /usr/bin ${HOME}
+		| local done grep -eu cd echo && && done local sed grep
+	x=1 done x=1 ${HOME} "$1" local && ${HOME} 'quoted text'
+sed grep local done -eu | 'quoted text' echo awk ${HOME} done
+		2>/dev/null 2>/dev/null sed 'quoted text' "$@" -eu 'quoted text'
+$(pwd) --verbose export
+		-eu --verbose then && $(pwd) test cd test | export 'quoted text' && -eu --verbose
+		--verbose x=1 x=1 /usr/bin echo sed /usr/bin
+	$(pwd) readonly test grep $(pwd) cd "$1" local sed grep $(pwd) readonly
+	$(pwd) --verbose -eu ${HOME} cd cd awk x=1 "$1" && sed
+${HOME} echo /usr/bin $(pwd) printf x=1 "$@" then readonly
+echo awk 'quoted text' test | -eu ${HOME}
+	test "$@" | -eu 'quoted text'
+	| x=1 -eu /usr/bin ${HOME} then 2>/dev/null
+--verbose local "$1" --verbose then ${HOME} local x=1 $(pwd) local sed cd x=1
+		$(pwd) local /usr/bin $(pwd) ${HOME} readonly
+	grep cd export printf local readonly 'quoted text' export echo
+	done export then $(pwd) export then /usr/bin readonly export --verbose
+		printf $(pwd) done | -eu "$@" ${HOME}
+		&& && grep /usr/bin test sed export cd echo -eu export --verbose export echo
+	echo --verbose printf --verbose echo
+	local $(pwd) $(pwd) && ${HOME} sed
+		echo printf local echo test sed then echo --verbose
+	${HOME} test then local "$1" 2>/dev/null then 'quoted text' awk /usr/bin sed
+	x=1 export readonly 2>/dev/null
+	&& /usr/bin && 2>/dev/null grep sed
+--verbose ${HOME} done $(pwd) awk |
+		${HOME} "$@" | test x=1 --verbose
+	"$@" /usr/bin readonly done echo then grep | done done
+sed grep local echo && /usr/bin then $(pwd) -eu | test "$@" -eu ${HOME} test $(pwd)
+	local echo $(pwd) /usr/bin printf /usr/bin "$1" local grep cd ${HOME}
+		cd done /usr/bin export 'quoted text' && ${HOME} readonly ${HOME} then 'quoted text'
+'quoted text' x=1 -eu 2>/dev/null
+	| printf grep 'quoted text'
+x=1 2>/dev/null printf x=1 then then $(pwd) "$1" ${HOME} ${HOME} then then
+local | test printf 'quoted text'
+		--verbose printf local done echo "$@" export readonly --verbose done /usr/bin
+printf then grep printf awk sed "$@" readonly
+	x=1 readonly ${HOME} awk "$1" "$@"
+2>/dev/null echo then "$1" $(pwd) readonly then printf
+		test ${HOME} sed && | "$@" cd cd then export readonly test printf test "$1"
+	&& /usr/bin sed readonly grep $(pwd) echo readonly --verbose done $(pwd)
+sed 'quoted text' echo "$1" x=1 awk
+		export printf awk $(pwd) printf "$1" grep
+		--verbose local $(pwd) 'quoted text' --verbose export ${HOME}
+		readonly awk "$@" test cd export sed && | x=1 readonly test grep awk | local
+x=1 printf echo "$@" ${HOME} x=1 printf
+	sed local 'quoted text' x=1 grep printf $(pwd) $(pwd) $(pwd) &&
+		'quoted text' local $(pwd) printf
+cd test $(pwd) export x=1 printf 2>/dev/null local "$@" --verbose $(pwd)
+	done printf && "$@" readonly $(pwd) export | -eu /usr/bin
+	echo cd export && /usr/bin --verbose
+	grep echo awk echo done sed awk $(pwd) printf
+$(pwd) test && printf /usr/bin test cd /usr/bin grep printf
+		"$1" x=1 cd 'quoted text' 'quoted text' 2>/dev/null local test ${HOME}
+		readonly ${HOME} 2>/dev/null
+		/usr/bin "$1" 2>/dev/null printf /usr/bin test sed
+/usr/bin test export done 'quoted text' cd then -eu "$@" local x=1 grep && $(pwd)
+grep 2>/dev/null printf done done awk "$@" export x=1 --verbose
+		cd then $(pwd) printf local sed 'quoted text' "$1"
+	$(pwd) awk -eu test test 2>/dev/null cd "$1" export test
+--verbose "$@" printf $(pwd)
+--verbose export "$1" $(pwd) echo
+	${HOME} $(pwd) grep test
+		export "$@" export $(pwd)
+		printf "$@" $(pwd) test awk sed "$1"
+x=1 -eu sed $(pwd) $(pwd) done test "$@" x=1 /usr/bin /usr/bin printf --verbose
+'quoted text' -eu ${HOME} "$1" grep done test /usr/bin
+		'quoted text' export -eu 2>/dev/null done /usr/bin
+2>/dev/null x=1 -eu 2>/dev/null "$1" then 'quoted text' 2>/dev/null
+	x=1 then -eu ${HOME} readonly $(pwd) echo cd echo readonly local "$@" awk
+awk awk "$1" "$@" $(pwd) /usr/bin then readonly test "$1"
+echo sed printf | 'quoted text' echo && awk | local
+/usr/bin echo export 2>/dev/null
+	done 'quoted text' cd $(pwd) -eu awk local grep then awk "$@" then "$@"
+"$1" printf export awk done "$1" --verbose awk --verbose -eu && test export
+--verbose ${HOME} --verbose echo then grep done /usr/bin printf
+		$(pwd) "$@" echo done done 2>/dev/null done ${HOME} |
+test && done awk ${HOME} readonly | ${HOME} export && x=1 done /usr/bin
+		${HOME} ${HOME} x=1 "$@" export --verbose then sed cd sed "$@" 'quoted text'
+	readonly awk -eu -eu done && --verbose x=1 'quoted text'
+	$(pwd) done done sed /usr/bin
+	&& echo grep export export echo readonly $(pwd) 'quoted text'
+		grep test | | export echo && 2>/dev/null export done grep ${HOME} --verbose
+'quoted text' awk "$@" test /usr/bin -eu sed && done awk /usr/bin --verbose
+		cd echo grep cd 'quoted text' printf /usr/bin then && then cd "$@" local local done
+		awk echo "$1" 2>/dev/null $(pwd) 'quoted text'
+readonly printf then "$1" 'quoted text'
+	"$1" done | sed --verbose export
+	"$@" && ${HOME} cd x=1 printf 2>/dev/null 2>/dev/null
+		awk export readonly cd local sed then 2>/dev/null test sed $(pwd) awk done
+/usr/bin 'quoted text' && --verbose
+local 'quoted text' done 2>/dev/null echo awk then "$1" --verbose && | |
+then test awk x=1 "$1" printf echo cd
+	"$@" test /usr/bin 2>/dev/null local
+then sed echo cd export export -eu x=1 grep /usr/bin export --verbose printf |
+	| cd done x=1 printf printf "$@" | cd "$@" echo && ${HOME} then
+		awk x=1 --verbose x=1 local sed "$@" $(pwd) $(pwd) "$@" awk
+	readonly printf printf export test echo -eu $(pwd) /usr/bin done
+	echo x=1 --verbose "$@" then sed $(pwd)
+grep then cd done 2>/dev/null /usr/bin echo test
+2>/dev/null "$@" test readonly printf "$@" "$@" /usr/bin
+	printf printf cd 'quoted text' "$1" readonly cd
+	&& /usr/bin x=1 grep --verbose $(pwd) then done grep --verbose done
+	readonly | done -eu -eu x=1 "$1" ${HOME} awk done $(pwd)
+		| 2>/dev/null readonly grep $(pwd) -eu 'quoted text' grep 'quoted text'
+	done done $(pwd) 2>/dev/null
+echo export 2>/dev/null grep "$@" cd grep cd then awk --verbose
+	done x=1 --verbose "$@" echo 2>/dev/null
+	"$1" done && echo | printf $(pwd)
+--verbose export -eu 'quoted text' /usr/bin
+${HOME} grep export /usr/bin ${HOME}
+echo local grep && --verbose && "$@" |
+		test "$1" "$1" sed export && x=1 then "$@" sed 'quoted text' | ${HOME} test |
+		done then awk cd test ${HOME} sed export --verbose then sed 2>/dev/null
+	awk /usr/bin && $(pwd) echo readonly
+	cd local done test local | --verbose grep local --verbose done 'quoted text'
+		${HOME} export readonly $(pwd) 'quoted text' /usr/bin printf cd printf && ${HOME}
+	"$@" export "$@" 2>/dev/null export awk grep x=1 -eu && "$1"
+		x=1 done /usr/bin /usr/bin
+	&& sed ${HOME} $(pwd) awk echo ${HOME}
+		grep done | x=1 printf
+		'quoted text' cd readonly 'quoted text' then && local x=1 | /usr/bin test readonly
+		"$@" grep -eu | then $(pwd) 2>/dev/null
+	export --verbose done x=1 awk /usr/bin then local
+	&& cd awk echo ${HOME} sed
+	"$1" 2>/dev/null local --verbose export 2>/dev/null
+then test awk --verbose $(pwd) export | --verbose
+		sed /usr/bin awk && x=1 'quoted text' done --verbose | cd local /usr/bin done
+	printf /usr/bin then cd "$@" | -eu "$@" echo awk awk ${HOME} sed "$1" test test
+$(pwd) readonly awk echo | 2>/dev/null && export then $(pwd) then
+--verbose awk done ${HOME}
+2>/dev/null cd done | /usr/bin 2>/dev/null
+		echo 2>/dev/null -eu local local grep then -eu "$1" echo test cd -eu then
+	awk grep grep local $(pwd) -eu grep "$@" export readonly
+"$@" ${HOME} "$1" | awk echo done && "$@" grep ${HOME} test
+-eu cd "$@" /usr/bin "$@" | awk local sed $(pwd)
+	test && export "$1" "$1" 'quoted text' | "$1" awk then "$@"
+		test /usr/bin local --verbose done then local export readonly readonly | -eu
+		/usr/bin "$@" $(pwd) && cd then awk printf && readonly done readonly
+	grep readonly /usr/bin sed -eu awk "$1"
+echo 2>/dev/null /usr/bin $(pwd) printf sed test
+		readonly "$@" /usr/bin x=1 sed grep --verbose cd then done sed /usr/bin "$@" | "$1"
+sed echo test "$@" $(pwd) then 2>/dev/null && /usr/bin printf 'quoted text'
+awk | export printf awk --verbose | local
+		--verbose && printf printf export
+done --verbose test then cd grep cd $(pwd) x=1 | sed
+		'quoted text' 2>/dev/null printf printf -eu echo --verbose
+		done | printf /usr/bin printf --verbose "$1"
+"$1" readonly then ${HOME}
+cd -eu printf sed -eu x=1 test && export "$1" printf x=1 cd then /usr/bin
+then "$1" "$@" printf 'quoted text' export "$@" --verbose awk grep printf
+		done printf 2>/dev/null
+| "$@" $(pwd) --verbose readonly test grep grep readonly
+	local grep done test && && test /usr/bin echo | then "$1" grep x=1
+	-eu x=1 2>/dev/null test 2>/dev/null $(pwd) $(pwd) awk echo 2>/dev/null "$1"
+		readonly x=1 local sed ${HOME} test "$@" export export
+		2>/dev/null --verbose echo --verbose | sed grep 'quoted text' echo -eu &&
+	printf cd test ${HOME} --verbose then
+echo x=1 grep && $(pwd) local
+		x=1 $(pwd) then 'quoted text'
+	cd then $(pwd) "$@" && | "$@" "$@" sed echo "$1" done test readonly export
+grep readonly "$1" then $(pwd) readonly ${HOME} awk 'quoted text' x=1 -eu
+	cd local 'quoted text' readonly cd local && ${HOME} -eu cd x=1 local "$@" "$1"
+"$@" && x=1 cd sed printf echo grep | test --verbose cd awk
+	sed /usr/bin sed | readonly "$1" then readonly
+test cd printf echo export
+		printf && export x=1 /usr/bin export x=1 cd ${HOME} "$1" $(pwd) grep --verbose
+-eu && /usr/bin && sed --verbose sed ${HOME} done sed
+		grep echo "$@" awk cd | "$@" then test 'quoted text'
+		&& --verbose sed 'quoted text' then echo ${HOME} echo | && awk -eu echo
+	grep readonly /usr/bin x=1
+done "$1" readonly --verbose 'quoted text' cd printf -eu "$1" sed
+	local grep printf awk export echo "$@" ${HOME} awk ${HOME} printf 'quoted text'
+		&& then && then "$@" && sed local &&
+	test printf -eu ${HOME} readonly ${HOME} grep echo
+		&& ${HOME} test grep 'quoted text' ${HOME} then | 2>/dev/null "$@" "$@" "$1"
+	test cd grep 2>/dev/null 'quoted text' -eu sed && --verbose /usr/bin &&
+		printf cd 2>/dev/null | cd then local 'quoted text' done x=1 test
+	sed then $(pwd) local 'quoted text' local && 2>/dev/null readonly
+		export "$@" echo x=1 'quoted text' "$@" grep export
+	readonly then "$1" test 2>/dev/null grep grep /usr/bin grep grep x=1 -eu /usr/bin
+		-eu $(pwd) local cd echo grep printf $(pwd) | then
+	done ${HOME} sed -eu done cd | test printf
+	-eu -eu "$1" sed cd && | then awk -eu x=1
+sed local printf -eu "$1" sed test && "$@" ${HOME} grep | done
+	x=1 x=1 x=1 test $(pwd)
+	'quoted text' echo x=1 done "$@" --verbose ${HOME}
+awk export ${HOME} -eu "$1" printf
+	cd /usr/bin --verbose --verbose
+	awk | && --verbose --verbose sed ${HOME} local -eu "$1" -eu export sed "$1" 'quoted text'
+sed sed awk test /usr/bin -eu 'quoted text' local -eu readonly
+--verbose test ${HOME} done export awk test | --verbose cd cd then
+readonly readonly readonly cd export awk
+	printf "$1" && sed 'quoted text' | | -eu "$1"
+		'quoted text' | -eu printf done export
+		/usr/bin /usr/bin 'quoted text' $(pwd) x=1 | /usr/bin
+/usr/bin "$1" /usr/bin readonly readonly 'quoted text' "$1" test
+	${HOME} echo then | grep
+done x=1 "$@" readonly test && echo /usr/bin done awk x=1
+echo test printf export | && cd && && local | x=1 then test
+		awk echo -eu -eu cd /usr/bin grep "$1" local 'quoted text' export
+--verbose | awk "$1" "$1" awk "$@" test 'quoted text' readonly readonly 2>/dev/null
+	echo -eu export test "$@" "$@" sed local readonly cd "$@" 2>/dev/null x=1
+	local grep -eu --verbose x=1
+	done -eu then -eu grep awk done readonly "$@" readonly 'quoted text' grep
+"$1" grep | done sed echo echo "$@" sed done ${HOME}
+		| -eu | /usr/bin done && then
+printf local --verbose export && test -eu printf "$@" sed 'quoted text'
+		awk /usr/bin -eu x=1 sed export
+	test && test && | | export cd printf printf ${HOME} && export echo
+		/usr/bin echo "$@" "$@" 2>/dev/null printf "$1" | "$1" readonly 2>/dev/null
+		x=1 cd done --verbose cd cd /usr/bin done then && test readonly test
+	done -eu grep then | "$@" grep test test "$@" then --verbose
+"$1" /usr/bin sed cd 2>/dev/null --verbose | test readonly readonly $(pwd)
+"$1" ${HOME} "$1" test "$1" ${HOME} /usr/bin "$@" local then
+		2>/dev/null cd cd -eu /usr/bin echo "$@" awk export x=1 done done sed
+--verbose 2>/dev/null ${HOME} grep | then | readonly sed test -eu
+| printf 2>/dev/null "$1" "$@" awk grep | x=1 sed 2>/dev/null
+	| && ${HOME} sed cd $(pwd) ${HOME} "$1" test --verbose "$1" done && /usr/bin
+		-eu export $(pwd) readonly ${HOME} grep "$@" 'quoted text' grep done |
+		local export local &&
+	awk | $(pwd) local awk | done x=1
+	grep then echo 'quoted text'
+/usr/bin "$1" printf cd sed | 2>/dev/null
+"$1" "$@" awk local local "$1" 'quoted text' ${HOME} | readonly sed sed "$1"
+/usr/bin done cd /usr/bin "$@" test
+echo 'quoted text' cd && "$1" local && test echo
+		grep sed printf $(pwd) local && grep -eu echo
+echo cd printf export echo export done printf "$1"
+	"$1" --verbose "$1" cd grep readonly x=1 done
+		done grep "$@" && --verbose $(pwd) 2>/dev/null echo grep grep awk test
+	grep export echo 2>/dev/null
+	local grep echo local local readonly readonly grep
+		'quoted text' echo test echo -eu "$@"
+	x=1 done cd $(pwd) readonly 'quoted text' echo awk 'quoted text' | cd local echo
+	export $(pwd) then x=1 && then done "$1"
+"$@" --verbose /usr/bin local readonly then readonly
+		| "$@" x=1 $(pwd) local cd printf x=1 $(pwd)
+sed -eu echo printf x=1 readonly cd printf "$@" export | /usr/bin
+	grep ${HOME} $(pwd) echo then done done sed awk readonly x=1 "$@" ${HOME}
+	'quoted text' --verbose | grep
+		-eu local --verbose $(pwd) /usr/bin ${HOME} grep grep then 2>/dev/null
+	/usr/bin then awk awk export "$1" ${HOME} local then $(pwd)
+${HOME} && "$1" --verbose grep echo "$1" "$1" printf
+		cd cd then then ${HOME} 2>/dev/null
+	local --verbose $(pwd) "$1" -eu ${HOME} /usr/bin 2>/dev/null -eu printf
+export --verbose 'quoted text' local 2>/dev/null x=1 /usr/bin awk 2>/dev/null
+		cd -eu echo "$1" done x=1 "$@" awk x=1
+2>/dev/null export then /usr/bin 2>/dev/null
+&& test export --verbose cd local then then
+		awk ${HOME} export && && | | "$@" cd sed $(pwd) "$@"
+		printf "$@" ${HOME} --verbose
+	export printf test local export
+		awk then && sed then test test cd cd done readonly 'quoted text' local grep x=1
+x=1 cd cd "$1" awk awk done ${HOME} -eu ${HOME} x=1 'quoted text' | -eu awk
+		"$1" done -eu x=1 -eu cd -eu "$@" readonly
+	local -eu && "$@" "$1" readonly readonly "$@" x=1 awk $(pwd)
+readonly --verbose readonly grep echo x=1 ${HOME} local "$@"
+	&& ${HOME} grep "$@" sed
+	'quoted text' "$@" "$@" awk 2>/dev/null
+awk done then x=1 "$1" --verbose ${HOME}
+		then export "$@" /usr/bin export echo | | echo "$1" done "$1" | printf test
+	'quoted text' readonly grep
+		grep $(pwd) cd && "$1" --verbose
+		--verbose sed /usr/bin test export then sed /usr/bin
+		$(pwd) x=1 cd x=1 local printf /usr/bin readonly readonly done
+sed cd 'quoted text' then && 'quoted text' local "$@"
+	echo export grep echo /usr/bin awk then 2>/dev/null awk
+	"$@" readonly /usr/bin awk --verbose cd $(pwd)
+	test | sed sed awk x=1 done 2>/dev/null
+	local --verbose done /usr/bin
+test export grep && printf -eu /usr/bin done
+		'quoted text' "$@" 'quoted text' 'quoted text' printf cd
+/usr/bin "$1" test 2>/dev/null cd && echo done $(pwd) grep $(pwd) --verbose
+done cd 2>/dev/null local cd then "$1" readonly grep done readonly
+		${HOME} local 2>/dev/null sed export cd then then 2>/dev/null readonly
+		local -eu test /usr/bin -eu ${HOME} echo
+	printf /usr/bin awk awk then test done sed readonly
+	done grep export cd x=1 then $(pwd)
+printf grep "$@" 2>/dev/null 'quoted text'
+		export -eu export export x=1 --verbose 'quoted text'
+		--verbose x=1 awk $(pwd) 'quoted text'
+cd awk $(pwd) "$1" --verbose
+"$1" cd x=1 sed readonly && 'quoted text' sed cd then sed --verbose
+		-eu local -eu awk $(pwd) readonly
+	local | readonly && awk awk | sed 'quoted text' "$1" --verbose -eu printf awk
+		local grep local ${HOME} readonly printf local 'quoted text' readonly
+--verbose local grep then then --verbose readonly cd export sed then x=1 echo printf
+		awk 'quoted text' ${HOME} && grep export && | grep $(pwd)
+		2>/dev/null readonly sed then grep /usr/bin
+	test export 'quoted text' | --verbose | x=1 local 'quoted text' --verbose
+		'quoted text' $(pwd)
+	$(pwd) printf $(pwd) sed cd --verbose awk $(pwd) | echo && 'quoted text'
+echo cd done 2>/dev/null sed
+		${HOME} echo 'quoted text'
+export readonly --verbose --verbose awk x=1 "$@" "$1"
+		"$1" then && awk cd && test "$1" local
+	done echo /usr/bin then sed $(pwd)
+		"$@" test -eu done printf local /usr/bin
+	"$@" test cd printf $(pwd)
+		local ${HOME} "$@" ${HOME} done ${HOME} sed export then /usr/bin local then
+	echo awk "$@" /usr/bin then cd /usr/bin sed grep 'quoted text' -eu "$1" -eu
+	2>/dev/null grep readonly "$@" /usr/bin --verbose
+		-eu | done "$1" grep /usr/bin printf 2>/dev/null 2>/dev/null
+cd test export --verbose
+	--verbose test -eu echo echo test -eu readonly --verbose &&
+		printf readonly "$1" | then -eu
+	${HOME} cd 'quoted text' /usr/bin echo echo x=1 then "$@" export then "$@"
+${HOME} "$1" local | --verbose
+	echo then then local awk readonly then done grep ${HOME}
+		"$1" test --verbose echo sed --verbose echo readonly test && 'quoted text' echo
+test "$1" x=1 $(pwd) cd echo x=1
+		"$@" -eu "$1" then test echo
+		then "$1" && printf /usr/bin && then /usr/bin echo --verbose ${HOME} 2>/dev/null
+	echo "$@" awk --verbose x=1 export test && readonly 'quoted text' echo 2>/dev/null
+		&& cd --verbose done | --verbose
+	done printf printf && x=1 printf "$@" "$1" 'quoted text' "$@" 2>/dev/null
+	then readonly "$@" echo && sed /usr/bin test printf ${HOME} 'quoted text'
+sed sed 'quoted text' | echo
+		awk "$1" grep sed readonly then sed test awk --verbose -eu x=1 local awk
+		"$@" $(pwd) test -eu readonly "$1" export done export
+	cd export test sed echo test ${HOME} export "$1"
+	&& local sed | export 'quoted text'
+		&& ${HOME} && grep x=1 ${HOME} echo $(pwd) sed
+		awk "$@" sed /usr/bin export ${HOME} local
+test "$@" -eu grep && test $(pwd) --verbose grep
+		--verbose /usr/bin export sed grep awk /usr/bin then | grep "$1" && grep local sed
+		export readonly readonly done test printf /usr/bin local /usr/bin
+	local sed printf "$@" -eu && cd /usr/bin echo export
+		| export grep $(pwd) readonly /usr/bin -eu
+		"$@" x=1 test x=1 ${HOME} 'quoted text'
+test test ${HOME} -eu awk 'quoted text' ${HOME} cd &&
+	awk grep -eu sed | readonly
+	--verbose done /usr/bin /usr/bin
+export cd cd sed "$1" /usr/bin && $(pwd) printf then
+		$(pwd) grep echo $(pwd) x=1 2>/dev/null
+'quoted text' done ${HOME} printf "$@" | $(pwd) "$@" grep export $(pwd) x=1 local
+		${HOME} test ${HOME} 2>/dev/null echo done sed awk printf sed awk
+	export test sed ${HOME} then ${HOME} awk
+"$@" cd test --verbose ${HOME}
+	export --verbose 'quoted text'
+		cd x=1 echo "$@" "$1" export
+--verbose /usr/bin sed echo then awk printf grep $(pwd) "$@" "$1"
+-eu sed /usr/bin awk "$@" echo readonly | local test grep awk sed test readonly
+x=1 local 2>/dev/null awk
+		| 2>/dev/null export readonly
+	local /usr/bin "$1" cd && 'quoted text'
+		'quoted text' $(pwd) 2>/dev/null | && test local 2>/dev/null
+	cd -eu "$1" | "$@" --verbose -eu awk -eu readonly x=1 --verbose
+		export -eu printf -eu sed -eu then --verbose /usr/bin ${HOME} readonly cd --verbose
+		done | printf ${HOME} "$@" | && sed && $(pwd)
+awk | printf readonly grep x=1 --verbose grep sed printf awk sed "$@" "$@" x=1
+		grep ${HOME} "$1" grep $(pwd) done
+-eu sed grep test "$@" sed --verbose x=1 then $(pwd) sed awk cd -eu x=1 sed
+		/usr/bin --verbose | "$1" done $(pwd) export
+		grep -eu echo /usr/bin sed $(pwd) sed printf test sed test | printf done "$1"
+	then grep awk local x=1 local
+		--verbose "$1" done local
+		grep awk x=1 ${HOME} --verbose echo 2>/dev/null "$@" sed done
+	sed && export $(pwd) echo echo local grep "$@" grep
+		grep ${HOME} grep ${HOME}
+		$(pwd) local awk 'quoted text' --verbose then test x=1 "$1" export echo export
+&& test 2>/dev/null "$1" x=1 done awk readonly x=1 printf
+printf "$1" test 2>/dev/null awk 'quoted text' printf
+#include c183.sh
+		echo echo "$@" "$@" cd echo awk export && 2>/dev/null ${HOME}
+${HOME} test "$1" 2>/dev/null
+		${HOME} | test --verbose test /usr/bin
+| awk 'quoted text' | x=1 x=1 -eu cd ${HOME} echo x=1 $(pwd) readonly echo
+	$(pwd) | readonly /usr/bin &&
+$(pwd) "$@" 'quoted text'
+${HOME} sed "$@" sed -eu 'quoted text' cd -eu && -eu printf 'quoted text' 2>/dev/null
+	$(pwd) local --verbose x=1 readonly readonly
+		2>/dev/null x=1 -eu /usr/bin local && $(pwd) local 'quoted text'
+	/usr/bin echo && readonly cd 2>/dev/null 2>/dev/null cd 2>/dev/null
+		/usr/bin && --verbose 'quoted text' x=1 done then 'quoted text'
+	${HOME} awk then grep local x=1 && | 2>/dev/null $(pwd) local x=1
+	local ${HOME} --verbose sed export x=1 /usr/bin | $(pwd) then "$1" echo awk done
+		readonly export x=1 export then x=1 $(pwd)
+	local && ${HOME} && done ${HOME} grep done "$1" x=1 readonly | done awk
+	/usr/bin grep -eu -eu -eu echo $(pwd) cd sed "$1" then "$@"
+x=1 'quoted text' local --verbose x=1 grep -eu
+readonly | 'quoted text' printf x=1 test local $(pwd) "$1" $(pwd) grep
+		$(pwd) "$1" test then export grep --verbose cd cd 2>/dev/null
+readonly "$@" && awk then then test -eu -eu local grep --verbose
+test done x=1 awk local readonly done then
+		$(pwd) sed "$1" -eu --verbose grep
+		x=1 export test sed printf local readonly -eu done | x=1 cd | 'quoted text'
+		x=1 --verbose ${HOME} "$1" "$@" --verbose
+printf && -eu grep 'quoted text' ${HOME} export | cd
+	--verbose 2>/dev/null 2>/dev/null grep sed echo 'quoted text' awk sed local
+	then "$@" local grep x=1 printf local "$1" sed
+--verbose "$1" sed sed then local
+		local test export 2>/dev/null
+		x=1 printf 'quoted text' $(pwd) grep cd && grep
+sed awk local echo echo "$1" "$@" readonly done
+&& 2>/dev/null 'quoted text'
+then printf awk test local export 2>/dev/null printf awk
+		"$@" -eu cd ${HOME} sed then sed printf
+		sed 'quoted text' ${HOME} -eu printf echo echo "$1" export --verbose ${HOME} /usr/bin
+		sed $(pwd) awk "$1" awk 2>/dev/null
+		local && test sed -eu 'quoted text' ${HOME} /usr/bin --verbose
+		'quoted text' && echo done test $(pwd)
+	readonly echo --verbose done done "$1" /usr/bin /usr/bin | --verbose
+/usr/bin readonly test printf | readonly printf
+x=1 printf x=1 test local && awk readonly "$1" local export 2>/dev/null
+		readonly local 2>/dev/null
+readonly 2>/dev/null readonly printf
+		--verbose ${HOME} -eu sed && done 2>/dev/null local -eu -eu done /usr/bin
+	sed --verbose --verbose && then
+		cd export then 2>/dev/null
+-eu printf export x=1 awk $(pwd) grep then test
+		| cd "$1" | test -eu grep "$@" 'quoted text' then
+x=1 2>/dev/null $(pwd) echo grep && /usr/bin 2>/dev/null readonly readonly
+grep local test x=1 2>/dev/null
+	x=1 | 2>/dev/null x=1 local 2>/dev/null 'quoted text'
+		cd ${HOME} -eu -eu printf "$1" printf &&
+	&& cd test readonly sed printf grep -eu done 2>/dev/null ${HOME}
+		export grep ${HOME} echo
+--verbose --verbose awk ${HOME} 'quoted text' 2>/dev/null
+		local ${HOME} printf -eu 2>/dev/null x=1 then then sed printf
+	cd readonly done $(pwd) x=1 echo | "$1" grep done -eu 'quoted text' then --verbose
+sed x=1 cd test sed -eu | -eu x=1 readonly "$1" then ${HOME}
+readonly cd -eu --verbose printf test "$1" sed 'quoted text' 2>/dev/null
+		export x=1 $(pwd) grep 2>/dev/null printf x=1 "$@" awk
+$(pwd) done 2>/dev/null | x=1 $(pwd) grep grep 2>/dev/null
+		&& awk && done awk ${HOME} test export $(pwd) awk 'quoted text' readonly readonly
+	export | ${HOME} sed test $(pwd) then done test "$1" cd done readonly
+	echo cd sed echo grep --verbose && printf
+2>/dev/null echo sed | awk grep | grep
+echo local grep cd grep
+grep awk "$1" /usr/bin then
+	grep echo printf 2>/dev/null x=1 readonly export test
+&& | /usr/bin ${HOME} 2>/dev/null printf
+	test test 'quoted text' local && x=1 2>/dev/null
+	test ${HOME} test test /usr/bin --verbose
+		--verbose "$1" -eu readonly then local 'quoted text' 'quoted text'
+		cd printf then -eu $(pwd)
+		printf x=1 then readonly ${HOME} | --verbose /usr/bin done awk then cd "$1"
+echo echo | local 'quoted text' 'quoted text'
+	-eu readonly export done "$@" done x=1 --verbose sed | cd --verbose /usr/bin
+grep /usr/bin grep x=1 readonly local
+export --verbose printf $(pwd) export
+	&& 2>/dev/null ${HOME} then --verbose 'quoted text'
+x=1 export ${HOME} | $(pwd) echo 'quoted text' echo "$@" done | cd
+${HOME} grep then && echo | test local then --verbose
+		echo then grep /usr/bin local x=1 cd "$1" sed 2>/dev/null |
+	&& readonly sed test x=1 grep x=1 "$1" done export export test
+2>/dev/null awk then echo awk printf cd &&
+echo "$@" "$1" test 'quoted text' test readonly local ${HOME} then x=1 grep
+	sed --verbose done printf /usr/bin then --verbose "$1"
+	'quoted text' awk | cd "$1" ${HOME} ${HOME} 'quoted text' | "$1" then
+		"$@" printf 2>/dev/null | local local ${HOME} then "$@"
+test $(pwd) then local && echo local sed -eu "$@" test ${HOME} ${HOME} readonly
+		"$1" /usr/bin && && 'quoted text'
+${HOME} "$@" then done
+-eu "$@" --verbose 2>/dev/null printf x=1 export "$@" done sed local && | 2>/dev/null
+grep awk awk echo ${HOME} awk
+		local /usr/bin sed 'quoted text' echo $(pwd) readonly
+	2>/dev/null /usr/bin local done x=1 -eu local readonly /usr/bin "$@" echo
+		| 'quoted text' printf local && readonly && awk awk "$1"
+x=1 local test 'quoted text'
+	echo then "$@" $(pwd) -eu readonly 'quoted text' -eu
+/usr/bin then printf /usr/bin "$@" readonly then then then
+		awk --verbose printf printf grep | grep | 'quoted text' 'quoted text' "$@" "$@"
+		$(pwd) then done /usr/bin "$1" 2>/dev/null grep "$@" "$@" && "$1"
+	$(pwd) test $(pwd) done $(pwd) 'quoted text'
+		then test readonly "$1"
+/usr/bin grep 'quoted text' readonly
+		awk local sed 2>/dev/null export grep sed
+2>/dev/null "$1" 2>/dev/null ${HOME} $(pwd) $(pwd) 2>/dev/null
+		sed awk | 'quoted text' test
+	$(pwd) readonly sed grep readonly
+	echo then $(pwd) done "$@" cd --verbose
+&& "$1" then && 'quoted text' cd --verbose export echo cd cd sed done | 2>/dev/null
+grep $(pwd) --verbose sed /usr/bin && --verbose -eu && "$1" 2>/dev/null
+	then export $(pwd) x=1 test printf awk grep ${HOME} ${HOME} "$@"
+'quoted text' "$@" x=1 2>/dev/null then local "$1" x=1 'quoted text'
+	'quoted text' -eu && cd test 2>/dev/null
+	"$1" grep 'quoted text' "$1" x=1 done | 'quoted text' --verbose grep echo
+	local 'quoted text' readonly 2>/dev/null awk "$@" local | done 2>/dev/null
+"$1" "$@" "$@" 'quoted text' --verbose --verbose
+--verbose readonly grep --verbose "$1" sed readonly local cd local test
+	2>/dev/null done | "$@" echo "$1" -eu "$@" readonly printf awk
+		'quoted text' x=1 grep "$1" then sed
+		"$@" /usr/bin --verbose -eu cd | test echo "$1" -eu cd awk
+	&& echo -eu readonly "$@" $(pwd) $(pwd)
+grep readonly "$@" "$1" test
+	"$@" grep readonly ${HOME} done "$1" grep sed echo 2>/dev/null | export
+		local grep x=1 -eu /usr/bin then --verbose
+done test sed awk done then $(pwd) sed /usr/bin printf ${HOME} awk
+		grep grep && x=1 --verbose readonly readonly awk echo && local printf
+printf grep local 'quoted text'
+	done printf local | awk "$1" export
+echo -eu test x=1 cd awk done test export "$@" "$1" grep x=1 export
+	| && ${HOME} 'quoted text' x=1 ${HOME} $(pwd) echo readonly -eu echo 'quoted text'
+	"$@" awk test then grep sed export
+	then local printf cd 2>/dev/null x=1 x=1 | awk local --verbose
+then export export sed readonly x=1 $(pwd)
+	'quoted text' "$@" then | ${HOME} -eu test "$1"
+"$@" export $(pwd) echo
+	sed "$1" export ${HOME} "$@" ${HOME} $(pwd) "$1" && awk
+local | 'quoted text' local grep echo export test && 'quoted text'
+		cd cd awk sed readonly "$1" readonly
+		2>/dev/null printf sed sed readonly && readonly grep done && 'quoted text'
+cd --verbose awk sed --verbose | grep sed "$@" "$1"
+		2>/dev/null ${HOME} grep /usr/bin $(pwd) $(pwd) ${HOME} -eu -eu $(pwd) "$@" grep
+		export export then cd done awk ${HOME} x=1
+	${HOME} x=1 /usr/bin done -eu 2>/dev/null awk then && echo printf &&
+		then x=1 grep "$1" export test
+	echo && test echo done readonly
+	cd 2>/dev/null "$@" --verbose
+		| $(pwd) --verbose -eu $(pwd) /usr/bin
+	x=1 echo $(pwd) sed "$@" cd export -eu cd grep 'quoted text'
+2>/dev/null -eu 'quoted text'
+	sed done readonly local
+"$1" echo "$@" readonly | -eu readonly readonly $(pwd)
+2>/dev/null cd -eu awk echo | -eu
+--verbose readonly 'quoted text' test x=1 && echo
+sed "$@" 2>/dev/null grep done grep test --verbose x=1 | local
+'quoted text' awk test done
+		echo 2>/dev/null 'quoted text' local --verbose test x=1
+"$@" readonly export $(pwd) $(pwd) | export printf
+grep "$@" /usr/bin awk sed sed grep sed export echo 'quoted text' readonly
+		--verbose "$@" then awk | 2>/dev/null sed local | local done "$@" cd local "$@"
+		'quoted text' --verbose "$@" test "$1" --verbose readonly
+	test sed cd readonly --verbose 2>/dev/null printf then test 2>/dev/null
+	"$@" grep ${HOME} echo test echo grep sed 2>/dev/null local cd | then
+		&& -eu "$1" export "$1"
+		$(pwd) export 'quoted text' echo 2>/dev/null
+	grep 2>/dev/null | readonly echo echo
+	sed "$1" done $(pwd) | echo 'quoted text' export "$1"
+	${HOME} printf --verbose x=1 "$@" ${HOME} --verbose 'quoted text' --verbose export
+"$1" awk test cd done "$1" export printf grep | --verbose
+	'quoted text' awk then --verbose "$@" then ${HOME}
+	$(pwd) cd x=1 "$1" | -eu printf 2>/dev/null && done
+	"$1" "$@" | echo printf test then printf --verbose echo
+		| $(pwd) | printf /usr/bin grep -eu then "$@"
+	"$@" cd sed cd | $(pwd) && && 2>/dev/null
+"$1" 2>/dev/null export "$@" grep /usr/bin 'quoted text'
+		grep $(pwd) echo sed local readonly done x=1 test cd printf
+		-eu then "$1" "$1" printf test local done "$@" cd $(pwd) "$@" 2>/dev/null
+	printf 2>/dev/null grep -eu 'quoted text' then
+printf --verbose cd cd ${HOME} | test sed | echo && local /usr/bin echo printf
+	${HOME} ${HOME} "$1" test test readonly
+echo readonly done &&
+	| $(pwd) awk $(pwd) --verbose grep 2>/dev/null 2>/dev/null $(pwd) cd
+		-eu cd printf $(pwd) done "$@" cd | echo export done x=1 2>/dev/null printf
+-eu ${HOME} cd "$@" --verbose awk | --verbose ${HOME} readonly grep "$1" local
+2>/dev/null cd x=1 grep --verbose x=1 grep "$@" 2>/dev/null
+	export readonly cd awk echo --verbose $(pwd)
+cd --verbose 'quoted text' "$1" -eu readonly $(pwd) done -eu
+	grep then | && sed 'quoted text' && awk ${HOME} -eu "$@"
+-eu --verbose $(pwd) then 2>/dev/null local grep && --verbose --verbose
+	test then $(pwd) 'quoted text' local "$1"
+	$(pwd) | printf "$1" printf | /usr/bin echo then --verbose readonly
+	2>/dev/null test cd "$@" 2>/dev/null
+	test export then local local ${HOME} export
+	export then readonly 2>/dev/null sed x=1 "$@" then sed export readonly echo --verbose
+"$1" "$1" grep $(pwd) then local 2>/dev/null local &&
+	echo 'quoted text' x=1
+$(pwd) | readonly then && cd test
+-eu echo /usr/bin echo 2>/dev/null /usr/bin readonly
+		"$@" "$1" awk readonly && sed | -eu sed $(pwd) x=1 then
+sed printf grep then 2>/dev/null done "$@" test test readonly sed "$@"
+2>/dev/null printf -eu cd readonly cd x=1 "$@" 'quoted text' cd echo printf
+		grep 'quoted text' 'quoted text' grep
+		&& /usr/bin "$@" awk x=1 --verbose x=1
+		test -eu sed && sed sed cd done | awk readonly 2>/dev/null 2>/dev/null
+grep echo sed then /usr/bin 'quoted text'
+x=1 2>/dev/null $(pwd) &&
+		&& export 2>/dev/null awk
+	grep "$1" echo printf /usr/bin sed "$@" 2>/dev/null printf && done readonly
+	printf 2>/dev/null "$1" $(pwd) then echo && ${HOME}
+		"$1" readonly grep 'quoted text'
+then $(pwd) "$1" /usr/bin && | sed -eu readonly --verbose ${HOME} readonly
+	awk export echo sed "$1" done sed 2>/dev/null
+readonly "$@" | "$1" export
+	then "$@" then /usr/bin && $(pwd) echo readonly grep "$1" 'quoted text'
+		cd 'quoted text' sed test then x=1 --verbose 'quoted text'
+/usr/bin 'quoted text' local && local "$1" cd | | ${HOME}
+test "$1" /usr/bin 2>/dev/null export | 'quoted text' readonly echo -eu
+--verbose | -eu sed test echo grep 'quoted text' -eu grep test "$1" export
+	export sed then done | cd --verbose echo echo printf sed then
+		then then "$@" grep local done sed awk readonly
+	--verbose grep cd ${HOME} grep readonly && "$1" 'quoted text'
+&& x=1 2>/dev/null then readonly echo /usr/bin
+/usr/bin awk -eu export local test readonly grep cd local
+	"$1" cd awk 'quoted text' -eu && done echo --verbose printf awk
+		readonly && $(pwd) "$@" ${HOME} "$1" readonly ${HOME} echo printf then
+test done awk /usr/bin -eu test export echo export x=1 done cd local
+		"$@" sed cd test grep grep readonly
+		sed | awk export test then awk | done readonly echo $(pwd) --verbose
+		local 'quoted text' | $(pwd) grep printf
+$(pwd) test grep readonly export awk echo ${HOME} && export
+		'quoted text' $(pwd) "$@" test
+		done then ${HOME} && cd $(pwd) readonly
+	/usr/bin echo "$1" readonly
+'quoted text' x=1 --verbose ${HOME} grep awk /usr/bin cd "$1" "$@" "$@" sed
+	done local sed ${HOME} echo printf readonly
+		grep readonly && 'quoted text' ${HOME} && /usr/bin test local && | test "$1"
+grep "$1" && /usr/bin local done /usr/bin "$@" $(pwd) && readonly --verbose readonly
+	-eu && done $(pwd) x=1 && printf sed printf
+		then /usr/bin "$1" sed --verbose awk readonly then echo ${HOME}
+	readonly sed awk 2>/dev/null 2>/dev/null then awk export grep
+		done | done && x=1 then "$@" -eu echo "$1"
+		awk && "$@" --verbose sed sed export && $(pwd) echo cd awk local "$1" done
+		echo test 2>/dev/null local "$1" --verbose "$@" --verbose
+&& && readonly "$1" --verbose done local local x=1 x=1 then "$@" $(pwd)
+&& | local 'quoted text' sed ${HOME} grep "$1" cd local
+grep --verbose export "$1" done "$1"
+	grep export sed | -eu 'quoted text' 'quoted text' done ${HOME} awk $(pwd) printf
+"$@" "$@" local 2>/dev/null local && then x=1 ${HOME} "$1"
+		/usr/bin printf cd 2>/dev/null awk /usr/bin readonly -eu --verbose done
+	cd && echo "$@" export cd ${HOME} $(pwd) x=1 local
+	$(pwd) ${HOME} test --verbose --verbose /usr/bin local -eu | awk /usr/bin
+		"$1" printf $(pwd) && local
+done && echo x=1 $(pwd) && local test | /usr/bin -eu test ${HOME} --verbose &&
+		cd /usr/bin then sed && cd x=1 -eu awk "$@" /usr/bin
+		"$@" then echo --verbose x=1 2>/dev/null && then
+		echo && printf export /usr/bin "$1" test cd -eu printf sed --verbose -eu /usr/bin
+	-eu cd readonly test | awk then "$@" | --verbose "$1" | cd local /usr/bin
+	readonly -eu ${HOME} $(pwd) echo printf 2>/dev/null | export
+x=1 awk echo -eu export x=1 "$@" test then sed --verbose "$@" "$1" 2>/dev/null
+/usr/bin sed export "$@" x=1 && test && $(pwd) awk $(pwd) echo 'quoted text' x=1
+"$1" --verbose test 2>/dev/null
+		-eu $(pwd) echo $(pwd) echo 2>/dev/null ${HOME} x=1 readonly $(pwd)
+		cd awk done 'quoted text'
+	--verbose test "$@" grep export /usr/bin x=1 local local --verbose test 2>/dev/null
+	| 'quoted text' readonly echo "$1" awk test "$@" sed ${HOME} /usr/bin 2>/dev/null
+	awk -eu "$1" "$1" echo awk ${HOME} awk 'quoted text'
+	&& x=1 grep /usr/bin /usr/bin $(pwd) -eu readonly local --verbose cd local
+	readonly then export readonly
+	"$@" local done 2>/dev/null
+		2>/dev/null done echo 'quoted text'
+echo local sed readonly then printf x=1 "$@" local
+		'quoted text' --verbose cd /usr/bin 2>/dev/null local /usr/bin
+	x=1 test /usr/bin echo | done x=1 "$@" local -eu grep
+	echo awk | echo x=1 sed x=1
+"$@" export "$@" x=1 export /usr/bin $(pwd) grep
+		local test done export cd "$@" local ${HOME} | --verbose
+'quoted text' --verbose printf done readonly local then then 2>/dev/null
+done | sed grep grep -eu -eu sed
+	'quoted text' readonly readonly readonly printf printf 2>/dev/null
+-eu readonly "$1" $(pwd) awk -eu 'quoted text'
+	then --verbose grep $(pwd) sed local readonly x=1 awk sed "$1"
+'quoted text' --verbose
+printf ${HOME} echo export "$1" cd then
+		"$1" export export --verbose $(pwd) awk
+'quoted text' done -eu readonly grep
+	x=1 readonly x=1 ${HOME} -eu | test printf awk 'quoted text' -eu
+local -eu 2>/dev/null
+	${HOME} 'quoted text' -eu local done | printf "$@" /usr/bin
+	readonly sed awk x=1 && export done x=1 readonly 'quoted text' local "$@" 2>/dev/null
+		grep local local ${HOME} "$1" && cd echo "$@" ${HOME} export readonly
+	echo "$1" 'quoted text' --verbose
+	"$@" awk | test then grep cd cd
+	x=1 awk cd $(pwd) awk -eu local $(pwd) | readonly | export printf "$@"
+&& test ${HOME} 'quoted text' -eu 'quoted text'
+$(pwd) "$@" sed cd $(pwd) readonly -eu done then | 2>/dev/null
+		done readonly -eu "$@" && "$@" --verbose then
+	test readonly ${HOME} sed test 2>/dev/null
+cd $(pwd) --verbose sed done test "$1"
+	$(pwd) 2>/dev/null "$1" local && awk /usr/bin echo "$1" export done "$@" 2>/dev/null
+${HOME} grep --verbose export /usr/bin awk | -eu /usr/bin x=1 'quoted text' -eu
+	printf awk done 2>/dev/null
+		echo $(pwd) grep done 2>/dev/null 'quoted text' sed done local "$1" x=1 ${HOME}
+	then $(pwd) printf echo "$1"
+		$(pwd) sed echo awk grep "$@" --verbose "$1" && export x=1 "$1" echo "$1" readonly
+	${HOME} then $(pwd) local echo printf
+'quoted text' --verbose then then -eu then
+	echo done 2>/dev/null -eu awk --verbose local sed then
+| export 'quoted text' --verbose /usr/bin "$@" done
+'quoted text' x=1 /usr/bin ${HOME} local "$1" ${HOME} /usr/bin then echo
+		printf $(pwd) --verbose awk local
+		local 2>/dev/null "$@" sed test awk 'quoted text'
+	x=1 "$1" "$@" echo 'quoted text' echo | /usr/bin "$@" readonly
+awk /usr/bin printf printf cd sed sed && --verbose --verbose --verbose
+awk -eu local echo /usr/bin awk 2>/dev/null sed 2>/dev/null
+		awk "$@" sed readonly then --verbose
+		awk /usr/bin done grep done $(pwd) ${HOME} --verbose echo
+local printf test sed x=1 awk echo then then x=1 "$1" ${HOME} --verbose
+		readonly "$1" | sed readonly ${HOME} ${HOME} "$1" local
+		-eu "$@" awk done test cd
+		cd local && cd awk && && printf "$@"
+		--verbose -eu readonly
+'quoted text' --verbose --verbose ${HOME} grep
+		"$@" grep && sed /usr/bin awk 'quoted text' "$@" "$1" cd 2>/dev/null export
+-eu test 2>/dev/null
+	"$@" --verbose cd cd readonly x=1 done | 2>/dev/null --verbose awk -eu export
+${HOME} test done | | export awk done "$1"
+/usr/bin ${HOME} done
+$(pwd) readonly -eu /usr/bin export 'quoted text' then -eu done awk /usr/bin
+		echo test awk && && awk readonly done grep --verbose -eu 2>/dev/null
+		test grep $(pwd) done printf "$@" 2>/dev/null -eu -eu local -eu readonly echo
+		echo test | printf "$1" /usr/bin "$1" cd sed grep 'quoted text'
+		awk printf "$@" -eu export
+		grep $(pwd) local test x=1
+	echo cd printf awk export then 'quoted text'
+		test "$1" $(pwd) done printf sed
+"$1" cd 2>/dev/null x=1
+&& && then $(pwd) done x=1 --verbose done $(pwd) readonly --verbose echo
+done | /usr/bin sed sed readonly 2>/dev/null 'quoted text' export
+export "$@" awk && 2>/dev/null "$@" "$@" 2>/dev/null printf | local && local
+"$1" 2>/dev/null 'quoted text' ${HOME} 2>/dev/null
+test 'quoted text' 2>/dev/null printf $(pwd)
+		local readonly x=1 | "$@" "$1" x=1 2>/dev/null "$1" /usr/bin awk test ${HOME}
+| done $(pwd) cd ${HOME} printf
+	x=1 echo 'quoted text' awk readonly "$@" $(pwd) then then "$1" grep --verbose
+'quoted text' -eu printf printf printf "$1" --verbose
+		local export | /usr/bin cd awk
+		&& && local "$@" 'quoted text' /usr/bin /usr/bin export printf
+	cd echo echo cd | sed export x=1 -eu export /usr/bin
+printf "$1" && x=1 printf
+		grep --verbose --verbose "$@" "$@" /usr/bin
+		cd 'quoted text' done x=1 cd echo awk "$@" && /usr/bin x=1 -eu
+		"$1" cd done cd -eu printf "$@" printf $(pwd) 'quoted text' 'quoted text'
+	awk grep then && /usr/bin readonly local
+"$1" "$@" x=1 test grep test -eu "$1" /usr/bin then echo "$@" "$@" cd && export
+| cd 'quoted text' done
+"$@" 'quoted text' x=1 sed then awk readonly export /usr/bin
+	printf export export "$1" $(pwd) awk grep --verbose
+local awk local "$1" 2>/dev/null && sed ${HOME} export
+	export 2>/dev/null grep "$1"
+	x=1 export printf x=1 printf
+	printf 'quoted text' && | && grep && export
+--verbose awk cd "$@" ${HOME} echo "$1" then readonly $(pwd)
+	$(pwd) -eu 'quoted text' x=1 done
+		readonly test echo 'quoted text' printf
+		&& | --verbose && "$1" awk export | awk $(pwd) done test
+		/usr/bin then export test "$@" printf then echo &&
+	"$@" test readonly "$1" && awk $(pwd) "$@" local readonly export x=1 ${HOME}
+&& && awk then $(pwd) test awk local readonly
+		cd $(pwd) "$@" x=1 x=1 done "$@" 'quoted text' then export
+readonly done readonly x=1 then /usr/bin readonly && && grep
+awk "$1" cd readonly done "$1" | echo "$@" ${HOME} /usr/bin
+	'quoted text' -eu | && && "$1" then printf readonly $(pwd) /usr/bin
+/usr/bin -eu | then x=1 local awk test then export $(pwd)
+		cd then done /usr/bin cd sed -eu 'quoted text' sed "$1" then export echo test
+		then then "$1" $(pwd) awk awk 2>/dev/null
+	awk x=1 -eu /usr/bin readonly /usr/bin /usr/bin ${HOME}
+		done $(pwd) ${HOME} ${HOME} then x=1
+	$(pwd) --verbose 2>/dev/null 'quoted text' test grep 2>/dev/null | test "$1" 2>/dev/null
+		/usr/bin export /usr/bin
+	grep cd && x=1 "$@" printf
+grep done echo ${HOME} test && | |
+	test ${HOME} done local grep 'quoted text'
+	"$1" awk readonly "$@"
+grep "$@" 2>/dev/null printf | -eu test grep readonly
+then -eu -eu "$1" export | printf done test
+	export sed export "$@" && done sed then /usr/bin --verbose
+		cd 'quoted text' readonly sed local
+awk $(pwd) local ${HOME} 2>/dev/null /usr/bin readonly
+'quoted text' echo local readonly test /usr/bin
+sed && "$1" --verbose -eu done $(pwd) cd x=1 | then test done
+		/usr/bin grep sed grep -eu cd done ${HOME} local export | "$@" local
+/usr/bin cd export /usr/bin $(pwd) awk "$1" printf sed $(pwd)
+	printf local awk readonly test
+		echo && printf -eu printf readonly ${HOME} && export
+	export cd awk export printf /usr/bin readonly done export x=1 'quoted text'
+	local --verbose sed ${HOME} -eu && local $(pwd) 'quoted text' 'quoted text'
+sed 'quoted text' "$1" && export sed then 'quoted text'
+	sed test then then cd "$1" export sed
+echo $(pwd) echo $(pwd) echo "$1" done echo
+--verbose /usr/bin | ${HOME} 'quoted text' && done 2>/dev/null "$@" printf
+	-eu --verbose | cd then grep
+$(pwd) 'quoted text' cd cd $(pwd) --verbose export --verbose
+	x=1 echo -eu "$@" --verbose && --verbose awk | echo x=1 2>/dev/null test echo
+		then "$1" sed x=1 /usr/bin | export awk readonly "$1" 'quoted text' --verbose
+	cd echo export | sed /usr/bin && grep export
+	sed then "$1" readonly && test test then 'quoted text' -eu then awk then
+"$@" x=1 -eu readonly echo local sed
+-eu ${HOME} local "$@" sed sed export sed echo readonly test
+	/usr/bin -eu "$1" /usr/bin export ${HOME} cd /usr/bin "$1"
+	-eu $(pwd) | done 2>/dev/null | readonly | && "$1" "$1" "$@" $(pwd) then
+local echo "$1" then --verbose cd -eu grep done
+	/usr/bin | 2>/dev/null awk
+		test 2>/dev/null grep then --verbose export | -eu -eu x=1
+	'quoted text' ${HOME} | local
+	x=1 $(pwd) echo -eu test x=1 grep x=1 local "$1" echo
+		--verbose $(pwd) then /usr/bin
+	sed cd local -eu ${HOME} printf printf readonly grep x=1 awk sed local "$1" /usr/bin
+"$@" awk grep sed printf 'quoted text' "$1" 'quoted text'
+	$(pwd) sed ${HOME} --verbose
+	echo cd awk readonly | | readonly grep printf then
+	test then sed readonly readonly "$@" x=1 && ${HOME} local
+printf cd cd echo ${HOME} -eu test awk echo "$@" && awk readonly x=1 'quoted text'
+	sed cd cd done "$1" local done x=1 export
+	export && x=1 echo --verbose sed awk x=1 "$1" cd -eu local
+	x=1 ${HOME} && x=1 readonly /usr/bin awk sed -eu export ${HOME} && local
+x=1 /usr/bin $(pwd) test readonly ${HOME} x=1 x=1 "$@"
+2>/dev/null sed readonly export awk local cd cd ${HOME} | local sed $(pwd)
+		echo readonly x=1 --verbose test awk && done "$1" x=1 local | local printf
+	cd $(pwd) export grep 'quoted text' 'quoted text'
+	| readonly && "$1" sed x=1 test "$@"
+		local done test cd export --verbose then
+		'quoted text' test $(pwd) "$1" | 2>/dev/null local printf sed "$1" "$1"
+		${HOME} /usr/bin local "$1" "$@" && --verbose local --verbose sed -eu echo ${HOME}
+	/usr/bin ${HOME} export then readonly --verbose
+readonly 2>/dev/null export test readonly x=1 local awk -eu local --verbose cd
+	printf cd done 'quoted text' cd 'quoted text' printf cd
+		local | export ${HOME} echo sed $(pwd) ${HOME} && "$1" && printf
+cd export printf cd awk local sed -eu && 'quoted text'
+-eu ${HOME} x=1 "$1" | -eu x=1 cd grep ${HOME} "$@" -eu local ${HOME} echo local
+test "$@" test "$@" && /usr/bin
+echo echo "$@" sed x=1 --verbose "$1" local then ${HOME}
+echo --verbose "$1" test ${HOME}
+echo --verbose "$1" "$@" grep local x=1
+echo printf grep cd local
+		done echo -eu | echo /usr/bin done -eu -eu x=1 readonly sed | -eu
+	"$@" cd | | "$@" cd "$1" $(pwd) test --verbose "$@" cd "$@" -eu
+		test printf ${HOME} $(pwd) | local "$1" $(pwd) test grep sed 'quoted text' 2>/dev/null
+export --verbose echo done $(pwd)
+		/usr/bin 'quoted text' "$@" cd --verbose
+readonly sed local --verbose echo x=1 awk cd readonly $(pwd) 2>/dev/null awk
+	echo "$1" export grep done test && && -eu then /usr/bin ${HOME}
+	test test | cd local "$1" awk local | awk awk "$1" local
+	x=1 grep 'quoted text'
+	--verbose 'quoted text' sed echo
+	2>/dev/null local 'quoted text' echo test "$@" test "$1" 2>/dev/null printf
+test && export done --verbose export done grep printf 2>/dev/null
+	readonly x=1 sed 'quoted text' grep cd export readonly test
+	${HOME} done echo readonly sed local $(pwd) --verbose ${HOME} -eu awk $(pwd)
+awk "$@" -eu awk export
+	'quoted text' done $(pwd) | export "$1"
+		/usr/bin echo "$1" "$1" 2>/dev/null ${HOME} echo "$1" /usr/bin done x=1 | ${HOME}
+x=1 "$@" $(pwd) echo test done && "$@" x=1 /usr/bin "$1"
+		done x=1 "$@" x=1 x=1 x=1 'quoted text' echo x=1 then local local
+	test x=1 sed 2>/dev/null "$1" printf echo then | && cd
+local grep grep readonly export
+done /usr/bin | 2>/dev/null awk --verbose export x=1
+		cd awk grep sed "$1" "$@"
+	| && 'quoted text' grep done cd readonly $(pwd) /usr/bin 'quoted text' readonly
+	grep echo ${HOME} -eu -eu sed test done grep && --verbose -eu
+	2>/dev/null done test done test sed export export x=1 cd "$1" 'quoted text' ${HOME}
+$(pwd) printf grep then then "$1" export sed grep export then --verbose sed
+then echo sed x=1 | --verbose 'quoted text' grep 2>/dev/null readonly
+echo sed local --verbose --verbose test
+	printf local sed sed cd done "$@" then x=1 sed 2>/dev/null 'quoted text' "$1"
+		$(pwd) | export printf readonly $(pwd) export cd echo ${HOME} -eu
+local test printf x=1
+		-eu x=1 sed cd && printf grep x=1 --verbose grep then /usr/bin readonly
+		echo test $(pwd) awk test ${HOME} grep echo
+		-eu sed $(pwd) sed "$@" "$@" grep
+"$1" x=1 export 2>/dev/null readonly
+		awk /usr/bin ${HOME} /usr/bin cd grep -eu "$@" -eu awk -eu awk
+--verbose "$1" && readonly
+	done local 'quoted text' test export /usr/bin "$1"
+		done readonly sed awk && sed printf done "$1" -eu local done
+	$(pwd) then readonly | && export 2>/dev/null
+awk readonly test sed | /usr/bin ${HOME} "$1" 2>/dev/null
+printf readonly && "$@" readonly done test /usr/bin --verbose
+		--verbose sed x=1 export grep --verbose test 'quoted text' 2>/dev/null
+"$1" printf && 2>/dev/null /usr/bin x=1 $(pwd) grep cd $(pwd) grep |
+		-eu /usr/bin printf test echo 'quoted text'
+&& $(pwd) "$1" then local x=1 -eu local x=1
+&& local grep --verbose
+	"$@" then echo -eu 'quoted text'
+&& readonly 'quoted text' then
+		'quoted text' 2>/dev/null printf --verbose /usr/bin 'quoted text' /usr/bin awk
+	sed /usr/bin test test
+		cd grep grep export local --verbose readonly export ${HOME} local
+		x=1 test $(pwd) echo 'quoted text' "$1" sed -eu /usr/bin ${HOME} awk -eu test --verbose
+${HOME} --verbose -eu printf -eu
+readonly grep sed "$1" "$@" awk test
+	| local "$1" local ${HOME} export local done
+		--verbose echo $(pwd) | local export sed done && echo grep sed test sed echo
+		sed 2>/dev/null grep "$@" test local "$1" "$@" 'quoted text' && awk done && --verbose
+'quoted text' | readonly grep x=1 done done "$1" "$1" local echo readonly ${HOME}
+awk "$1" ${HOME} awk -eu /usr/bin && 2>/dev/null
+		'quoted text' awk grep 'quoted text' test 2>/dev/null done | test test cd 2>/dev/null
+		done readonly x=1 sed && | $(pwd) 'quoted text'
+		"$1" && x=1 sed echo && test
+		-eu | awk && ${HOME} $(pwd) awk ${HOME} printf ${HOME} x=1 -eu grep /usr/bin
+		${HOME} grep $(pwd) echo && /usr/bin $(pwd) && echo "$@"
+	&& 'quoted text' done printf && "$1" "$@" done
+&& awk 'quoted text' "$1" ${HOME} 2>/dev/null
+		"$1" then 2>/dev/null cd printf && then awk printf awk 2>/dev/null grep
+		test $(pwd) local echo
+	"$@" ${HOME} $(pwd) grep awk done grep "$@" grep sed echo
+-eu test "$1" 2>/dev/null ${HOME} -eu sed | awk 'quoted text'
+		grep readonly awk echo 2>/dev/null /usr/bin done 2>/dev/null test export
+		-eu --verbose grep "$@" printf --verbose local done 2>/dev/null grep
+done then | sed && sed echo "$1" readonly then "$@" readonly
+		&& -eu then printf printf export --verbose -eu "$1" local local local
+| $(pwd) then -eu awk
+		"$@" --verbose local export local $(pwd) --verbose
+	x=1 "$1" 2>/dev/null /usr/bin readonly then printf printf grep 2>/dev/null
+x=1 "$@" | x=1 printf sed cd readonly | sed 2>/dev/null then
+"$1" "$1" -eu "$1" ${HOME} test --verbose awk $(pwd) 'quoted text'
+	'quoted text' "$@" done && x=1 ${HOME}
+export grep /usr/bin test readonly $(pwd) local readonly | --verbose
+	$(pwd) "$@" export "$1" local done "$1" /usr/bin test 'quoted text'
+"$1" $(pwd) "$1" echo printf done | awk readonly cd readonly | x=1 grep
+	then done x=1 $(pwd) awk awk grep local | readonly
+	grep echo local -eu local 2>/dev/null echo
+		"$@" -eu "$@" "$1" grep echo 2>/dev/null sed "$@"
+done test "$@" /usr/bin $(pwd) x=1 $(pwd) grep 'quoted text'
+		done && | "$1" then echo | sed && printf printf "$1" test ${HOME} awk
+	then /usr/bin "$1" | x=1 /usr/bin then awk --verbose /usr/bin
+	local ${HOME} ${HOME} export awk grep "$1"
+"$1" printf done 2>/dev/null /usr/bin $(pwd) "$@" "$1" readonly export
+		readonly local export then ${HOME} readonly --verbose printf | awk -eu done
+	test ${HOME} "$@" 'quoted text' printf --verbose && && 2>/dev/null | x=1 printf
+| "$1" | then | cd local cd "$@" sed local 2>/dev/null printf echo "$1" readonly
+	"$1" test echo cd then printf test export --verbose 2>/dev/null |
+-eu 'quoted text' "$@" local local printf --verbose
+	export grep -eu readonly 'quoted text' readonly 'quoted text' | grep sed 'quoted text'
+/usr/bin sed "$1" ${HOME} 2>/dev/null
+		-eu $(pwd) then x=1 && cd echo -eu "$1" --verbose
+awk $(pwd) -eu "$1" export
+--verbose cd cd then local 2>/dev/null "$1" "$@" -eu
+		${HOME} 2>/dev/null awk | /usr/bin "$1" awk $(pwd) "$1" sed printf && local
+		"$1" 2>/dev/null then
+		awk printf awk sed /usr/bin
+		/usr/bin "$1" local readonly grep
+		/usr/bin 2>/dev/null | $(pwd) ${HOME}
+		readonly export -eu 2>/dev/null test 2>/dev/null | && done grep test
+	readonly && echo export done 'quoted text' test && "$1" printf
+local done "$@" grep | x=1 "$1" then /usr/bin ${HOME} printf done $(pwd)
+		then echo grep cd "$1" awk 2>/dev/null /usr/bin -eu ${HOME}
+"$@" readonly --verbose "$@" echo --verbose /usr/bin cd "$1" local ${HOME}
+local echo export ${HOME} $(pwd) test cd 2>/dev/null --verbose "$@" awk readonly
+	/usr/bin /usr/bin $(pwd) export 2>/dev/null
+		test | printf awk test 'quoted text' awk readonly cd grep "$1"
+${HOME} | && echo && /usr/bin cd echo x=1
+x=1 | awk x=1 --verbose echo local
+		grep && $(pwd) awk test export done | /usr/bin
+		echo grep export "$1" local local
+		--verbose $(pwd) ${HOME}
+	echo ${HOME} "$1" export sed then printf --verbose then grep
+		test -eu cd local export cd ${HOME}
+readonly --verbose local --verbose ${HOME}
+	x=1 cd x=1 printf then export
+	local && "$@" 'quoted text'
+then printf printf export echo done && grep $(pwd) && --verbose
+sed "$@" --verbose cd done ${HOME}
+awk x=1 ${HOME} --verbose "$@" 'quoted text' x=1 local |
+sed awk export --verbose 2>/dev/null
+		/usr/bin "$@" done /usr/bin
+2>/dev/null local readonly cd sed | printf 'quoted text' -eu export done
+		then awk cd --verbose local 'quoted text' /usr/bin ${HOME} done "$1"
+export then awk echo printf local "$@" "$@" printf 2>/dev/null cd then --verbose
+	sed local sed --verbose && --verbose 2>/dev/null && "$@" "$@" test /usr/bin test
+	awk 2>/dev/null "$1" local sed | grep
+		readonly 2>/dev/null then
+	printf awk done printf $(pwd) | x=1 | ${HOME} && 'quoted text'
+		done $(pwd) awk 'quoted text' $(pwd) "$1" | export export | x=1 "$1" awk cd
+awk 'quoted text' --verbose export echo x=1 done "$@" "$@" 2>/dev/null
+		${HOME} --verbose export then 2>/dev/null
+x=1 "$@" local then | cd -eu awk test "$1" | printf 'quoted text' sed $(pwd)
+		local | $(pwd) --verbose awk cd -eu done "$@" 'quoted text'
+	then grep | printf 2>/dev/null
+--verbose export $(pwd)
+echo sed && "$1" $(pwd) /usr/bin $(pwd) "$1" echo
+		$(pwd) test local test 'quoted text' sed
+		awk ${HOME} x=1 "$@" 'quoted text' cd done "$1" x=1 &&
+echo ${HOME} printf 2>/dev/null test cd local
+	test local test grep 'quoted text'
+	then done sed echo grep -eu -eu printf printf x=1 ${HOME} /usr/bin x=1 grep
+	/usr/bin then "$@" /usr/bin grep export --verbose
+	2>/dev/null readonly test
+done grep done local sed -eu local 2>/dev/null 2>/dev/null ${HOME} x=1
+$(pwd) 2>/dev/null printf 2>/dev/null sed readonly "$1" export done ${HOME}
+	readonly "$@" cd sed $(pwd) | local && /usr/bin
+	echo then $(pwd) /usr/bin | grep grep readonly
+'quoted text' "$1" readonly x=1 sed
+	"$@" readonly sed 'quoted text' printf "$1" done -eu
+		printf export then done grep 'quoted text' | | awk done grep 'quoted text' cd -eu
+"$1" export 'quoted text' export grep
+		cd "$1" export 2>/dev/null awk awk sed grep "$@" awk
+local ${HOME} sed test done awk 'quoted text' $(pwd) done "$1" done
+$(pwd) $(pwd) sed 2>/dev/null sed --verbose
+cd awk printf awk x=1 echo 'quoted text'
+test printf -eu 2>/dev/null local cd 'quoted text' local sed echo
+		2>/dev/null cd 'quoted text' $(pwd)
+'quoted text' then "$@" cd "$1" done x=1 | grep awk "$1"
+		"$1" x=1 ${HOME} cd echo && awk done -eu 'quoted text' "$1" "$@" | x=1 "$@" $(pwd)
+		test sed printf 2>/dev/null $(pwd) $(pwd) "$1" then
+		&& sed readonly cd | then "$1" && && ${HOME} export 2>/dev/null
+		test | then printf export | sed awk "$@" then 'quoted text' export grep sed readonly
+| export /usr/bin export local | $(pwd) done done readonly
+	test "$1" 'quoted text' local && then $(pwd) done
+	awk grep /usr/bin awk -eu printf export done export printf then cd done
+		"$@" sed then /usr/bin x=1 --verbose 'quoted text' done done /usr/bin cd grep sed
+	--verbose 2>/dev/null awk "$@" echo awk then ${HOME}
+done x=1 ${HOME} 'quoted text' && "$1"
+local | then cd "$@"
+"$1" grep sed readonly done x=1 ${HOME} local readonly
+	done done cd then | 'quoted text' export && printf readonly ${HOME} export then
+		cd 2>/dev/null "$1" && --verbose
+"$1" echo -eu then ${HOME} 'quoted text'
+readonly done test grep 'quoted text' 2>/dev/null
+	export grep | done ${HOME}
+	local readonly | awk 'quoted text' echo ${HOME} -eu "$@" /usr/bin
+x=1 "$@" sed | cd "$1" readonly echo export 'quoted text'
+		done x=1 "$@" cd export sed readonly
+		"$@" "$1" done 'quoted text' --verbose && then export echo echo && 2>/dev/null
+done $(pwd) cd && cd && export done
+		"$@" then -eu x=1 test | readonly local export grep
+	sed "$@" cd then 'quoted text' "$@"
+awk 'quoted text' --verbose local done readonly && grep $(pwd) 2>/dev/null
+		x=1 local echo 2>/dev/null "$1" local export awk then -eu
+	sed then "$1" ${HOME} $(pwd)
+		2>/dev/null sed 'quoted text' 'quoted text'
+	-eu readonly test sed awk readonly sed && "$1" sed --verbose "$1"
+grep grep /usr/bin sed awk awk x=1 cd
+${HOME} export then echo x=1 -eu
+	2>/dev/null then grep /usr/bin echo ${HOME} | printf echo $(pwd) test printf $(pwd)
+	cd /usr/bin printf readonly awk --verbose x=1 printf local echo
+grep $(pwd) grep /usr/bin && ${HOME} "$@" 2>/dev/null
+		sed "$@" -eu printf /usr/bin && /usr/bin cd printf then x=1 x=1 "$@" ${HOME}
+${HOME} -eu sed -eu awk grep "$@" "$1" export
+		local awk 'quoted text' | printf --verbose "$1" printf "$1" &&
+		sed sed 'quoted text' && 2>/dev/null
+		done readonly local $(pwd) x=1 --verbose
+	test x=1 'quoted text' printf | sed -eu readonly
+	${HOME} -eu then ${HOME} "$@" awk $(pwd) awk "$@" && cd
+local grep /usr/bin cd test awk echo
+		awk test ${HOME} then echo ${HOME}
+2>/dev/null | export local && readonly printf awk done sed -eu readonly test
+	2>/dev/null 2>/dev/null
+test --verbose then 'quoted text' | /usr/bin
+readonly readonly "$1" "$1" export sed export 2>/dev/null
+		--verbose x=1 -eu readonly then x=1 awk 'quoted text' test
+awk done && ${HOME} export
+	&& "$1" 2>/dev/null test -eu 2>/dev/null readonly test | x=1
+		| printf 'quoted text' --verbose
+&& readonly | sed "$@" ${HOME} --verbose sed -eu export done x=1 local
+	readonly done 'quoted text' test grep $(pwd) | --verbose sed /usr/bin
+		grep then 2>/dev/null 'quoted text'
+	&& "$1" "$1" --verbose done readonly "$1"
+	${HOME} readonly 'quoted text' && readonly readonly local then x=1 grep
+	test then then "$@" test 'quoted text' echo /usr/bin then "$1" cd ${HOME} awk "$@"
+		printf local -eu ${HOME} grep 2>/dev/null
+	awk readonly local ${HOME}
+		'quoted text' 2>/dev/null cd -eu 2>/dev/null
+local export "$@" -eu 'quoted text' "$1"
+		done then | x=1 'quoted text'
+	$(pwd) then export -eu x=1 "$@" export local test awk | awk then ${HOME}
+		| 2>/dev/null $(pwd) sed readonly
+		test cd "$@" echo grep --verbose cd /usr/bin "$1" sed
+		&& --verbose then 2>/dev/null /usr/bin awk /usr/bin test printf ${HOME}
+		readonly grep then awk printf readonly 'quoted text' test awk printf "$1"
+then -eu awk sed done "$1" x=1 awk "$@" && sed then x=1 | |
+		'quoted text' /usr/bin printf /usr/bin
+		&& /usr/bin sed awk done echo
+		$(pwd) done sed grep "$@" $(pwd)
+	awk echo done --verbose /usr/bin $(pwd) x=1 'quoted text' | then
+	grep /usr/bin --verbose -eu | ${HOME} awk && export
+		"$1" cd --verbose then x=1 printf ${HOME} done sed readonly printf
+	&& ${HOME} --verbose
+readonly ${HOME} grep grep
+local ${HOME} ${HOME} | then echo
+'quoted text' done sed
+	awk --verbose local echo 'quoted text' printf /usr/bin local -eu
+	'quoted text' -eu cd test test echo 2>/dev/null local sed cd /usr/bin
+		/usr/bin "$1" cd then awk -eu
+		readonly local then ${HOME} local grep
+		2>/dev/null ${HOME} done
+	| --verbose 'quoted text' cd "$1" x=1 ${HOME} then
+sed 2>/dev/null awk printf x=1
+then awk then test done -eu local readonly ${HOME} sed then awk 'quoted text'
+		/usr/bin --verbose local 'quoted text' && grep 2>/dev/null 'quoted text'
+		"$@" 'quoted text' && grep "$@"
+printf | "$@" then "$@" echo printf export then | grep /usr/bin
+		echo "$@" then local readonly test readonly local awk x=1 done
+	"$1" readonly sed then done done "$@" 2>/dev/null echo ${HOME} ${HOME} then /usr/bin
+grep "$1" grep 2>/dev/null
+		| 'quoted text' 2>/dev/null
+cd printf x=1 $(pwd) cd $(pwd) --verbose && -eu && printf then cd
+	readonly sed cd grep awk cd export test 'quoted text'
+	| test 'quoted text' export sed
+	x=1 -eu export printf test then
+$(pwd) echo readonly 'quoted text'
+	x=1 printf printf "$1" "$1" done
+		-eu x=1 /usr/bin cd | printf export test test cd readonly echo done echo
+	local /usr/bin test readonly "$@" 2>/dev/null
+/usr/bin ${HOME} local then done && local local
+		echo printf -eu then echo readonly 'quoted text' 'quoted text' grep && grep x=1
+	local $(pwd) x=1 /usr/bin 2>/dev/null local ${HOME} awk --verbose grep x=1
+		${HOME} cd $(pwd) awk /usr/bin grep "$@" done $(pwd) readonly cd then
+| awk && grep echo grep local 2>/dev/null | cd cd sed ${HOME} grep 2>/dev/null
+-eu x=1 export 'quoted text' sed "$@" local
+		/usr/bin ${HOME} /usr/bin grep $(pwd) export --verbose --verbose 2>/dev/null
+		then ${HOME} --verbose awk
+	| local export $(pwd) 'quoted text'
+	2>/dev/null ${HOME} /usr/bin --verbose x=1 | awk local
+${HOME} "$1" -eu sed "$1" /usr/bin grep ${HOME} printf $(pwd) test
+/usr/bin cd export awk x=1
+then -eu printf x=1 local "$@" ${HOME} export -eu cd | cd printf --verbose
+"$@" /usr/bin ${HOME} "$@" && /usr/bin && test
+	echo grep done grep --verbose "$@" 'quoted text' $(pwd) x=1
+cd cd test x=1 sed | 2>/dev/null
+		local sed /usr/bin -eu readonly ${HOME}
+		done --verbose grep printf -eu sed $(pwd) export awk --verbose 2>/dev/null | sed
+	| printf 2>/dev/null export sed 'quoted text' cd sed $(pwd) awk "$@" |
+	x=1 -eu export awk 2>/dev/null 2>/dev/null cd ${HOME}
+| && then then local printf --verbose
+grep awk | && cd "$@" x=1
+x=1 | "$@" /usr/bin | --verbose $(pwd) export "$1" /usr/bin
+2>/dev/null | awk local awk x=1 'quoted text' --verbose
+		echo export "$@" test "$@" "$1"
+	cd sed test sed x=1 x=1 then -eu
+	'quoted text' cd "$1" ${HOME} --verbose /usr/bin 'quoted text' printf
+&& --verbose sed $(pwd) && x=1 ${HOME} done "$1"
+${HOME} then then done printf | done $(pwd) export done
+	${HOME} "$@" | echo ${HOME}
+	$(pwd) x=1 grep $(pwd) /usr/bin "$1" awk --verbose "$1" grep
+	x=1 "$@" then -eu printf | --verbose grep
+		echo 2>/dev/null | ${HOME} -eu -eu grep done $(pwd)
+		${HOME} $(pwd) readonly | | local grep && 2>/dev/null then
+	"$1" | then "$1" --verbose && | --verbose
+		cd done --verbose local echo 'quoted text'
+	x=1 echo $(pwd) local && "$1" cd
+-eu ${HOME} 'quoted text' /usr/bin | test grep
+sed export sed 'quoted text' ${HOME} 'quoted text'
+/usr/bin "$@" && printf done -eu -eu printf grep x=1
+	/usr/bin 2>/dev/null $(pwd) cd "$@" readonly cd ${HOME} printf "$@" sed test
+$(pwd) then echo done "$@" grep grep "$1" x=1 2>/dev/null x=1 /usr/bin
+		grep export /usr/bin $(pwd) ${HOME} printf $(pwd) readonly
+	local | grep then ${HOME} $(pwd) && --verbose done /usr/bin then test /usr/bin $(pwd)
+	awk awk ${HOME} done "$1" readonly readonly
+--verbose awk awk cd test | "$@"
+	-eu 2>/dev/null export local $(pwd) ${HOME} cd awk | -eu 2>/dev/null export
+		"$1" awk --verbose && 'quoted text' printf local export awk test awk
+'quoted text' local done awk $(pwd) ${HOME}
+		| 2>/dev/null printf "$1" sed && cd && then | "$1" x=1 local
+		'quoted text' 2>/dev/null 2>/dev/null x=1 echo --verbose
+		export readonly -eu then then printf done | export | ${HOME} --verbose
+		&& -eu done awk export grep -eu readonly test awk
+	${HOME} | ${HOME} &&
+	'quoted text' 'quoted text'
+		x=1 export readonly /usr/bin printf awk
+		grep test 2>/dev/null printf /usr/bin sed "$@" -eu sed export grep ${HOME}
+--verbose ${HOME} grep test $(pwd) "$@" | cd x=1 "$1" "$@" x=1 export
+		test | awk test 2>/dev/null echo x=1 'quoted text'
+	'quoted text' done printf x=1
+-eu sed "$@" readonly
+		export ${HOME} grep --verbose export printf /usr/bin -eu /usr/bin
+local awk export "$@" local local "$1" cd ${HOME} awk export ${HOME} cd cd "$@"
+	$(pwd) -eu "$@" done 'quoted text' "$@" -eu
+		"$1" 'quoted text' | test test awk awk printf printf --verbose local && 'quoted text'
+	printf echo done echo 2>/dev/null local test "$@" /usr/bin $(pwd) 'quoted text'
+local local | $(pwd) printf $(pwd) done /usr/bin local 2>/dev/null x=1
+	${HOME} 'quoted text' --verbose
+grep 2>/dev/null -eu printf
+		export readonly x=1 | done printf local -eu grep test | "$@" 'quoted text'
+--verbose ${HOME} cd && echo sed local 2>/dev/null test printf
+		cd 2>/dev/null sed sed done export ${HOME} local
+$(pwd) echo && export && "$@" 2>/dev/null /usr/bin readonly
+echo export printf /usr/bin readonly then "$1" grep --verbose
+		${HOME} echo -eu x=1 $(pwd) export sed 2>/dev/null
+	'quoted text' printf /usr/bin -eu | x=1 done cd &&
+		${HOME} 'quoted text' | $(pwd) then
+sed --verbose "$1" done -eu "$1"
+	echo "$1" --verbose --verbose done ${HOME} "$@" readonly
+		2>/dev/null export ${HOME} "$@" awk &&
+&& echo readonly export | "$@" test $(pwd) 'quoted text'
+'quoted text' x=1 export local /usr/bin && cd $(pwd) done grep
+readonly local cd -eu cd awk local grep
+	&& local "$1" -eu -eu --verbose then then ${HOME} export printf local
+	${HOME} 2>/dev/null readonly x=1 | --verbose printf ${HOME} cd /usr/bin
+		awk 2>/dev/null sed export -eu cd
+	--verbose sed done then && printf
+		"$1" readonly 'quoted text' then "$1" 'quoted text'
+sed done export x=1 --verbose local test grep done && echo grep "$@" "$@" --verbose
+	-eu awk /usr/bin echo readonly x=1 --verbose echo readonly $(pwd) "$@"
+		test cd local $(pwd) then
+		awk x=1 done && grep "$1" "$@" $(pwd) cd
+		2>/dev/null $(pwd) "$@" "$1" local && -eu ${HOME} "$1" printf
+'quoted text' readonly 'quoted text' "$@"
+		sed cd readonly x=1 $(pwd) 'quoted text'
+	x=1 'quoted text' "$@" local -eu --verbose test readonly 2>/dev/null awk
+	sed $(pwd) -eu -eu "$@" --verbose | ${HOME} export -eu | printf awk
+		"$@" printf awk && grep done 2>/dev/null grep && local "$1"
+		awk -eu $(pwd) cd printf "$@" 'quoted text' grep
+	printf export -eu test "$@" readonly test
+		&& readonly readonly sed awk 2>/dev/null awk | 'quoted text' x=1 then awk
+-eu | sed --verbose | done 'quoted text' test
+grep /usr/bin readonly $(pwd) && /usr/bin printf sed --verbose | /usr/bin
+"$@" local awk -eu export
+local readonly test printf x=1 then | --verbose sed -eu -eu echo sed 2>/dev/null
+printf echo export /usr/bin
+		${HOME} --verbose -eu ${HOME} 2>/dev/null --verbose grep x=1 readonly --verbose
+	cd "$@" done ${HOME} test /usr/bin
+		--verbose 2>/dev/null x=1 ${HOME} done local
+		export test x=1 ${HOME} 2>/dev/null readonly -eu cd && | /usr/bin 2>/dev/null
+	grep /usr/bin echo readonly | -eu
+		"$1" cd then export x=1 done export awk "$@" local && &&
+		echo --verbose cd "$@"
+		$(pwd) local test readonly |
+	| $(pwd) $(pwd) export $(pwd) x=1 "$@" test -eu awk "$1"
+		awk "$1" local -eu echo cd test /usr/bin && | cd &&
+	${HOME} --verbose grep 'quoted text'
+	--verbose 'quoted text' | grep ${HOME} --verbose cd 2>/dev/null "$@" sed printf
+${HOME} && sed test awk -eu /usr/bin local sed awk /usr/bin
+	then | echo $(pwd) cd awk echo test 'quoted text' grep && printf
+	${HOME} awk grep printf cd export 'quoted text' cd done readonly 2>/dev/null 'quoted text'
+	local printf /usr/bin grep done awk "$1" -eu | readonly readonly export 'quoted text'
+		&& readonly awk ${HOME} x=1 /usr/bin /usr/bin sed
+| -eu export --verbose x=1 readonly /usr/bin "$1" -eu
+		| 2>/dev/null test "$@" grep $(pwd) /usr/bin
+readonly then awk | export done
+'quoted text' test readonly /usr/bin --verbose cd -eu grep done 'quoted text'
+x=1 x=1 2>/dev/null "$@" printf --verbose
+		'quoted text' local --verbose
+		sed test sed | cd local cd "$1" $(pwd) "$1" /usr/bin
+echo "$1" 2>/dev/null && grep
+	export "$1" test --verbose | local 2>/dev/null ${HOME}
+		-eu ${HOME} "$@" --verbose x=1 /usr/bin awk ${HOME} "$@"
+		export --verbose 2>/dev/null -eu cd --verbose -eu | then done local
+		sed 2>/dev/null "$@" -eu local | $(pwd) then -eu "$@" "$@" /usr/bin "$@" --verbose
+2>/dev/null test done awk printf "$@" x=1 echo awk x=1 echo test
+		2>/dev/null | export export done
+grep "$@" then sed done cd then test /usr/bin "$1" then sed test
+		&& printf ${HOME} done printf readonly then "$@" local awk echo printf $(pwd) export
+	readonly "$@" $(pwd) "$1" x=1 && && "$1" printf
+	cd then awk "$1" grep
+		"$@" awk ${HOME} "$@" $(pwd)
+	2>/dev/null "$@" test printf "$1" "$@" 2>/dev/null cd then sed awk -eu x=1 local
+readonly ${HOME} $(pwd) $(pwd) printf -eu readonly echo then
+		$(pwd) 'quoted text' "$1" | echo $(pwd)
+	grep printf "$1" awk 2>/dev/null 'quoted text' x=1 | printf && $(pwd) ${HOME}
+		export done $(pwd) awk grep local grep done test 2>/dev/null local
+test $(pwd) awk then ${HOME} 'quoted text'
+		$(pwd) "$@" && printf | x=1 grep 'quoted text'
+	grep then x=1 local 2>/dev/null export ${HOME}
+	readonly cd echo cd | sed readonly | test grep /usr/bin
+	/usr/bin x=1 local x=1 2>/dev/null sed
+"$1" | printf && "$@" | --verbose echo grep export sed printf -eu readonly "$1"
+	grep -eu awk cd "$@" local "$1" readonly
+$(pwd) x=1 $(pwd) --verbose grep $(pwd) sed "$1" "$1" 'quoted text'
+local test ${HOME} | grep awk ${HOME} sed -eu echo readonly 2>/dev/null --verbose
+	grep --verbose | then --verbose
+	awk export export export 'quoted text' test | test echo "$1" readonly
+		"$@" 'quoted text' cd sed
+		-eu "$@" --verbose local && then 2>/dev/null done $(pwd)
+	2>/dev/null then "$@" 2>/dev/null echo grep && test /usr/bin ${HOME}
+local then /usr/bin "$@" | echo && &&
+		echo "$1" echo local readonly grep x=1 echo grep cd printf ${HOME} cd ${HOME}
+		'quoted text' "$1" ${HOME}
+	readonly "$1" --verbose -eu | readonly readonly 'quoted text'
+	awk test && printf 'quoted text' && && $(pwd) "$1" x=1 &&
+-eu && done && -eu | local sed printf cd local
+${HOME} awk && then done
+	-eu test && | --verbose
+readonly sed -eu /usr/bin | "$1" test done $(pwd) $(pwd) test awk
+	printf awk "$1" x=1 x=1 -eu 2>/dev/null cd &&
+		export test echo && sed awk ${HOME}
+'quoted text' "$@" cd sed && done echo | 'quoted text'
+	sed -eu readonly awk -eu readonly ${HOME} cd sed
+"$1" "$1" echo x=1 --verbose
+		/usr/bin $(pwd) awk 2>/dev/null local printf export
+	&& x=1 test --verbose "$@" ${HOME} readonly -eu local printf $(pwd)
+	echo 2>/dev/null ${HOME} export
+		2>/dev/null /usr/bin && cd echo "$@" ${HOME}
+local --verbose then /usr/bin 'quoted text' x=1 x=1 sed export | then
+awk /usr/bin "$1" "$1"
+/usr/bin | awk export -eu 2>/dev/null -eu
+		then cd -eu $(pwd) grep | export 2>/dev/null then then ${HOME}
+grep done 2>/dev/null test grep printf "$@"
+grep grep printf | export cd ${HOME} ${HOME} cd test sed
+	"$@" grep "$1" "$1" sed /usr/bin x=1 readonly
+--verbose && local | 'quoted text'
+		awk --verbose && x=1 export -eu echo local
+	cd --verbose sed sed echo printf
+cd cd grep export grep $(pwd) "$@" "$@" local echo sed x=1 sed local awk |
+x=1 /usr/bin /usr/bin printf echo 'quoted text' awk ${HOME} printf
+	"$1" "$@" grep then sed done $(pwd) done /usr/bin ${HOME} | done printf
+		cd 2>/dev/null ${HOME} test && 2>/dev/null $(pwd) echo done --verbose
+		export test readonly 2>/dev/null
+		${HOME} /usr/bin grep "$@" $(pwd) /usr/bin cd /usr/bin
+		'quoted text' done local export grep $(pwd) sed ${HOME}
+		printf 2>/dev/null printf 2>/dev/null test
+	local /usr/bin && sed cd echo 'quoted text'
+		-eu readonly readonly awk x=1 readonly ${HOME} | sed | grep --verbose export
+		"$@" cd "$@" export 'quoted text' printf
+cd export then /usr/bin ${HOME} sed $(pwd)
+		grep "$@" awk "$1" -eu local export readonly cd 2>/dev/null readonly
+		$(pwd) echo done echo | readonly 2>/dev/null
+	${HOME} export then && printf cd
+		test readonly $(pwd) ${HOME} echo
+x=1 cd grep awk $(pwd) grep -eu done | 2>/dev/null readonly --verbose echo
+	grep awk --verbose local | cd done test then $(pwd) local "$1"
+	echo $(pwd) cd export test 'quoted text' sed
+$(pwd) "$1" test test -eu 2>/dev/null cd readonly test
+${HOME} done 'quoted text' 'quoted text' test 2>/dev/null local x=1
+	awk "$@" -eu "$@" 'quoted text'
+		--verbose grep "$1" "$@" $(pwd) then export "$@" &&
+	test local local $(pwd) 'quoted text'
+	$(pwd) "$1" grep local local cd /usr/bin -eu export -eu then done --verbose
+		readonly printf /usr/bin --verbose && done cd export echo -eu x=1 done x=1 ${HOME}
+	x=1 printf ${HOME} cd 2>/dev/null awk
+	printf awk cd cd cd awk x=1 ${HOME}
+x=1 awk "$1" $(pwd) /usr/bin readonly echo grep $(pwd) --verbose awk $(pwd) sed
+	grep done && x=1 export then 2>/dev/null | test awk
+	/usr/bin | export echo x=1 printf 2>/dev/null cd | /usr/bin local printf local
+	local /usr/bin ${HOME} -eu --verbose done readonly test
+--verbose x=1 -eu --verbose echo ${HOME} sed awk local grep | test 2>/dev/null
+		/usr/bin 'quoted text' 2>/dev/null local --verbose --verbose
+2>/dev/null /usr/bin export x=1 | local
+		'quoted text' printf 'quoted text' sed "$@" | export readonly 2>/dev/null -eu
+	then local 2>/dev/null echo && then && readonly done x=1 sed
+/usr/bin ${HOME} printf /usr/bin grep export /usr/bin sed test --verbose echo
+		$(pwd) 2>/dev/null grep readonly 'quoted text' /usr/bin 'quoted text' | 'quoted text'
+	local && | /usr/bin readonly "$@" awk "$1" echo printf
+		printf sed /usr/bin 2>/dev/null && readonly
+${HOME} sed 'quoted text' "$@" x=1 echo --verbose -eu export /usr/bin export done
+'quoted text' 2>/dev/null "$@" x=1 sed "$1"
+		sed $(pwd) grep then readonly echo && -eu | awk
+		test /usr/bin cd /usr/bin echo /usr/bin
+then then /usr/bin | echo --verbose x=1 "$1" test printf 2>/dev/null local then
+-eu 2>/dev/null | x=1 /usr/bin -eu grep echo done grep export
+	then x=1 done sed cd test ${HOME} test export done grep "$1" export 'quoted text'
+	awk printf local done export export then
+export awk --verbose sed
+	| then then printf 'quoted text' /usr/bin $(pwd)
+export "$1" export "$1" then $(pwd) | echo then
+	readonly | --verbose x=1 x=1 done "$1" "$@"
+"$@" -eu --verbose test test --verbose cd
+/usr/bin done echo then test readonly x=1 'quoted text' test test printf
+'quoted text' $(pwd) $(pwd) ${HOME} printf 'quoted text'
+${HOME} local x=1 done | 2>/dev/null "$1" readonly /usr/bin -eu cd grep $(pwd)
+cd $(pwd) printf echo then | "$@" done ${HOME} readonly
+	&& "$@" && test local "$@"
+-eu echo then -eu printf $(pwd) cd export --verbose && | "$@" x=1
+	${HOME} grep /usr/bin test done test done x=1 local test && | -eu 'quoted text'
+--verbose done 2>/dev/null "$1"
+printf test export | "$@" && "$1" 2>/dev/null
+	--verbose /usr/bin sed awk -eu 'quoted text' sed local $(pwd) -eu ${HOME} &&
+		"$1" --verbose | then then readonly 'quoted text' 2>/dev/null grep 'quoted text'
+| test 2>/dev/null && && 'quoted text' "$1" /usr/bin done printf ${HOME} 'quoted text'
+	/usr/bin cd 2>/dev/null /usr/bin x=1 sed printf && grep $(pwd) cd | |
+		local export cd $(pwd) /usr/bin
+local "$1" x=1 done grep readonly "$1" awk 2>/dev/null
+	sed --verbose printf "$@" 2>/dev/null
+		printf cd test printf test ${HOME} readonly done
+		| && 2>/dev/null sed | | -eu sed printf --verbose | --verbose
+	local 'quoted text' 2>/dev/null x=1 /usr/bin /usr/bin --verbose /usr/bin
+		then --verbose sed done sed 'quoted text' 2>/dev/null
+		2>/dev/null "$1" readonly awk
+		readonly readonly /usr/bin grep && export /usr/bin ${HOME} export grep echo x=1
+awk export readonly $(pwd)
+		| /usr/bin 2>/dev/null 2>/dev/null 2>/dev/null awk readonly readonly "$@" x=1
+grep awk awk cd 'quoted text' awk "$@" 2>/dev/null -eu
+	"$1" sed echo ${HOME} sed /usr/bin sed done readonly
+		readonly | local sed "$1" readonly local awk "$@"
+"$@" x=1 -eu export --verbose -eu grep local sed "$1" --verbose
+		printf done ${HOME} "$1" sed x=1 | "$1" && | test | | -eu printf "$@"
+/usr/bin sed echo cd | cd | $(pwd) printf /usr/bin cd cd awk 2>/dev/null && 2>/dev/null
+		| $(pwd) test sed cd --verbose
+'quoted text' 'quoted text' local grep |
+2>/dev/null done 2>/dev/null printf $(pwd) ${HOME} /usr/bin x=1 $(pwd)
+		$(pwd) "$1" "$1" 2>/dev/null export "$1" then cd cd "$1" export 'quoted text'
+	printf 'quoted text' then done "$@"
+	/usr/bin /usr/bin $(pwd) 'quoted text' echo grep
+	done "$@" then $(pwd) printf local printf 2>/dev/null
+grep sed "$@" "$@" -eu local grep "$@" local export
+x=1 $(pwd) cd then printf done printf $(pwd)
+		local cd x=1 printf -eu export
+	x=1 2>/dev/null readonly --verbose sed "$1" test awk -eu done
+grep "$1" ${HOME} done /usr/bin 'quoted text' then x=1 readonly cd /usr/bin
+awk ${HOME} cd echo 'quoted text'
+/usr/bin "$1" x=1 printf $(pwd) awk /usr/bin $(pwd)
@@ -0,0 +1,2001 @@
+test awk -eu echo done
+		sed -eu && done $(pwd) grep --verbose $(pwd) "$@" -eu awk x=1 /usr/bin done
+$(pwd) | awk x=1 "$@" done readonly sed --verbose | done
+		local cd printf && export 2>/dev/null
+	then --verbose "$@" 'quoted text'
+	-eu then "$@" echo grep export export echo readonly
+	readonly export ${HOME} $(pwd) export awk --verbose awk done grep grep
+	/usr/bin test grep -eu grep
+--verbose && "$1" 2>/dev/null printf $(pwd) x=1 x=1 export |
+		test local -eu test readonly --verbose awk
+		2>/dev/null sed 'quoted text' printf test echo /usr/bin done $(pwd) export
+	"$@" x=1 /usr/bin $(pwd)
+		echo x=1 test then 'quoted text' "$@" x=1 export echo "$1" done
+readonly sed 'quoted text' readonly /usr/bin export readonly
+	awk x=1 printf test local --verbose grep /usr/bin | then printf
+		x=1 sed 'quoted text' --verbose test export
+	awk "$@" /usr/bin 2>/dev/null 2>/dev/null
+	"$1" "$1" then ${HOME} readonly | 2>/dev/null "$@" x=1 x=1 grep --verbose ${HOME}
+		then | /usr/bin -eu -eu 2>/dev/null x=1 then readonly sed 2>/dev/null cd export
+awk /usr/bin 'quoted text' local
+"$@" sed echo "$@" readonly -eu -eu export readonly x=1 x=1
+		export "$@" export cd sed && ${HOME}
+		-eu -eu $(pwd) -eu 'quoted text' x=1 done sed
+'quoted text' 2>/dev/null done cd cd $(pwd)
+	&& ${HOME} "$1" grep done $(pwd) "$@" echo | ${HOME} cd
+	| ${HOME} /usr/bin local grep 2>/dev/null ${HOME} done
+${HOME} grep /usr/bin export /usr/bin readonly echo $(pwd) $(pwd)
+		2>/dev/null awk readonly
+	cd x=1 "$@" readonly | 'quoted text' "$1" | cd test $(pwd) printf --verbose
+export x=1 printf echo "$1" test "$1" sed "$@" printf "$1" --verbose
+	echo --verbose x=1 | $(pwd) done echo "$1" printf && awk grep | /usr/bin
+	| /usr/bin x=1 "$@" x=1 && readonly printf x=1
+		$(pwd) readonly --verbose x=1 readonly && grep readonly then
+x=1 then awk cd then | $(pwd) printf
+then x=1 --verbose /usr/bin
+	cd x=1 --verbose done 2>/dev/null
+	done done test test printf grep export "$1" | export done echo -eu /usr/bin
+	then 2>/dev/null echo 'quoted text' local
+		readonly ${HOME} then x=1 "$1" local
+	local awk --verbose && cd "$@" "$@" --verbose then ${HOME} export --verbose
+	x=1 printf grep sed cd "$@" 2>/dev/null test -eu done
+		&& ${HOME} "$@" x=1 ${HOME} ${HOME} /usr/bin done &&
+		'quoted text' echo -eu
+"$@" printf -eu -eu then export | cd printf echo
+		export test grep cd x=1 cd | test test done cd awk done export
+	grep printf /usr/bin "$@" $(pwd) $(pwd) && | && | 'quoted text' 'quoted text'
+'quoted text' ${HOME} "$@" sed ${HOME}
+test local 2>/dev/null grep "$@" local done && grep "$1"
+	&& grep -eu 2>/dev/null "$1" -eu | $(pwd) sed test printf | cd
+		cd 2>/dev/null 'quoted text' && ${HOME} "$@" /usr/bin $(pwd) $(pwd) test
+grep then 'quoted text' sed "$1" "$1" grep "$1" "$@" export then
+		${HOME} echo echo then echo /usr/bin "$1" cd && ${HOME}
+"$@" export && $(pwd) && 2>/dev/null awk /usr/bin
+		echo ${HOME} readonly && readonly $(pwd) "$@" grep
+		$(pwd) echo 'quoted text' echo awk
+"$@" test -eu cd ${HOME} $(pwd) /usr/bin
+"$1" test local awk readonly 2>/dev/null /usr/bin | --verbose "$@" echo awk
+	cd && ${HOME} $(pwd) "$1" x=1
+	local awk x=1 x=1 grep sed readonly test x=1
+'quoted text' "$@" then cd -eu
+done -eu -eu && awk printf --verbose $(pwd) grep /usr/bin --verbose
+		test cd "$1" printf sed "$1" export "$@" "$1" | --verbose | /usr/bin "$1"
+	/usr/bin /usr/bin local --verbose
+	| awk awk && | grep "$@" export readonly grep export readonly grep echo
+		readonly sed 'quoted text' readonly
+test x=1 | -eu "$1" 2>/dev/null export x=1 --verbose cd "$@" cd 2>/dev/null grep
+	&& then x=1 -eu then 2>/dev/null $(pwd) 2>/dev/null $(pwd)
+	${HOME} export done 2>/dev/null "$@" | --verbose awk 'quoted text' "$@" export printf
+done awk && "$@" sed 'quoted text'
+/usr/bin && x=1 awk 2>/dev/null printf --verbose /usr/bin x=1 --verbose
+	done awk grep then awk sed | 2>/dev/null sed
+	printf && "$@" export x=1 --verbose ${HOME} --verbose awk sed local export readonly
+2>/dev/null 2>/dev/null printf ${HOME} "$1" && x=1 2>/dev/null 'quoted text' &&
+		&& --verbose --verbose x=1 readonly echo export readonly
+		grep cd local 'quoted text' "$1" && done grep grep "$@" then readonly test
+done --verbose awk -eu 2>/dev/null
+		grep x=1 ${HOME} 2>/dev/null $(pwd) done "$1" test sed "$1" done "$1" "$@"
+	-eu -eu $(pwd) test readonly /usr/bin sed /usr/bin done
+${HOME} printf then sed "$@" "$@" -eu cd then
+	| --verbose 'quoted text' then 'quoted text' export 'quoted text'
+"$@" test /usr/bin sed printf sed x=1 then x=1
+	/usr/bin cd --verbose --verbose | printf test test cd 'quoted text'
+2>/dev/null -eu /usr/bin "$@" | -eu -eu
+	test 'quoted text' test
+		'quoted text' echo 2>/dev/null sed awk awk echo export 2>/dev/null
+	printf && printf "$1" test then then -eu "$1" "$1" cd ${HOME} cd ${HOME}
+		readonly done grep grep | cd ${HOME} readonly 'quoted text' x=1 'quoted text'
+		test | printf 'quoted text' 2>/dev/null
+	export test export "$@" done echo done local then "$@"
+test $(pwd) "$@" echo x=1 readonly sed 'quoted text'
+export echo "$@" cd awk -eu -eu $(pwd) 'quoted text' readonly /usr/bin
+$(pwd) printf export && test x=1 "$@" 'quoted text' "$1" done cd printf "$@"
+	| cd done local && "$1" awk grep local 'quoted text' --verbose readonly
+	done x=1 test awk readonly local ${HOME} sed 2>/dev/null --verbose /usr/bin done
+$(pwd) cd then export 'quoted text'
+	printf ${HOME} grep $(pwd) --verbose -eu $(pwd) then "$@" ${HOME} echo then
+test ${HOME} "$1" 'quoted text' then then echo | ${HOME}
+		readonly ${HOME} test local -eu | && printf grep readonly grep grep -eu ${HOME}
+		readonly grep cd $(pwd) done readonly export then "$@" local 2>/dev/null
+	--verbose sed /usr/bin -eu echo done printf awk $(pwd) "$1"
+	"$1" /usr/bin 2>/dev/null awk | | done
+		cd x=1 readonly "$1" x=1 then && "$1" --verbose $(pwd) 'quoted text'
+x=1 'quoted text' "$1" $(pwd) /usr/bin ${HOME} /usr/bin export awk awk cd
+		x=1 done local test --verbose -eu ${HOME} | --verbose
+	printf -eu 2>/dev/null "$1" --verbose
+		printf grep local then then -eu test printf /usr/bin && 'quoted text'
+sed "$@" sed echo echo | done "$@" /usr/bin sed
+	$(pwd) test grep then echo done printf cd $(pwd)
+"$@" ${HOME} x=1 'quoted text' $(pwd) then echo "$1" done 'quoted text'
+	grep test && printf $(pwd) "$1" local test x=1 ${HOME} 'quoted text' awk sed
+	--verbose /usr/bin readonly printf "$1" grep 2>/dev/null
+		&& -eu /usr/bin && local
+		2>/dev/null | done then -eu
+		/usr/bin then cd done $(pwd) x=1 2>/dev/null ${HOME} -eu sed $(pwd)
+	${HOME} | echo "$1" readonly
+	'quoted text' grep -eu /usr/bin -eu local
+readonly --verbose test export x=1 then readonly | -eu awk test x=1 "$@" -eu
+export then then printf echo && cd "$@" then |
+	then "$@" test cd awk ${HOME} -eu ${HOME} export && local then sed "$@" done
+| $(pwd) grep && ${HOME} "$@" $(pwd) printf "$1" $(pwd) | readonly "$@"
+	printf 2>/dev/null awk grep
+sed x=1 readonly | $(pwd) --verbose
+"$@" test then /usr/bin
+		then $(pwd) x=1 /usr/bin then grep cd 'quoted text'
+	--verbose local cd awk
+	${HOME} awk -eu test ${HOME} | -eu awk && printf --verbose --verbose -eu awk done
+	"$@" | /usr/bin test
+	printf && printf cd 2>/dev/null "$1" echo 2>/dev/null awk "$@"
+		| export && $(pwd) 'quoted text' printf /usr/bin readonly readonly
+		2>/dev/null local test $(pwd) | local readonly 'quoted text' "$1"
+		x=1 && sed /usr/bin 2>/dev/null 2>/dev/null local readonly readonly --verbose
+	local 2>/dev/null /usr/bin
+/usr/bin --verbose cd grep /usr/bin $(pwd) /usr/bin && sed test
+cd x=1 && "$1" grep ${HOME} cd --verbose test && awk test export readonly
+	-eu then readonly awk export 2>/dev/null $(pwd)
+	--verbose | --verbose 'quoted text'
+	-eu ${HOME} && 2>/dev/null | readonly
+sed 2>/dev/null export test x=1 local done test | && -eu ${HOME}
+		${HOME} -eu done | awk
+	${HOME} readonly 'quoted text' local "$1" printf $(pwd) cd grep sed
+		'quoted text' /usr/bin cd --verbose --verbose | grep readonly
+&& "$1" test done then $(pwd) $(pwd) 2>/dev/null --verbose readonly
+		'quoted text' "$1" sed -eu "$1" 'quoted text' "$1" awk
+	| --verbose | 2>/dev/null /usr/bin && $(pwd) | readonly printf
+	export grep then then printf grep awk done
+		done sed x=1 2>/dev/null export then -eu && readonly x=1
+local -eu echo ${HOME} | $(pwd) ${HOME} ${HOME} ${HOME} local && --verbose |
+awk done then 2>/dev/null | /usr/bin "$1" ${HOME}
+--verbose local awk printf /usr/bin
+		| "$1" x=1 --verbose /usr/bin -eu printf && sed $(pwd) readonly
+		sed "$@" awk ${HOME} echo readonly echo done local test && 2>/dev/null ${HOME} /usr/bin
+$(pwd) readonly echo && $(pwd) x=1
+| -eu 2>/dev/null --verbose "$@" -eu ${HOME} printf
+sed x=1 printf cd "$@" ${HOME} echo export && 'quoted text' $(pwd) export
+		export test readonly then
+		awk cd -eu readonly awk sed local 'quoted text' | -eu local --verbose
+${HOME} echo awk grep done
+		then | cd | && grep -eu sed echo export
+--verbose export 'quoted text' awk 'quoted text' grep readonly 2>/dev/null |
+		cd then awk -eu 2>/dev/null
+export cd echo 'quoted text' | ${HOME} awk 2>/dev/null -eu local 2>/dev/null
+local sed sed echo x=1 then printf
+	echo 2>/dev/null "$1" ${HOME}
+		test export then readonly ${HOME} "$1"
+		local cd ${HOME} x=1
+echo done 2>/dev/null test "$@" done 'quoted text'
+		2>/dev/null $(pwd) /usr/bin
+${HOME} ${HOME} cd local local done local readonly echo echo done
+		export awk $(pwd) test "$@" "$1" "$1" | --verbose
+	export && "$@" 2>/dev/null /usr/bin ${HOME}
+		--verbose ${HOME} 'quoted text' sed grep awk -eu local
+		-eu cd sed --verbose | --verbose
+	test 2>/dev/null sed --verbose cd awk x=1 $(pwd) export awk
+		${HOME} local $(pwd) "$@" -eu x=1 --verbose local echo | 2>/dev/null
+		readonly done grep echo echo -eu --verbose
+2>/dev/null 2>/dev/null
+then "$@" awk && | x=1 grep && local | $(pwd)
+grep done -eu "$1" done 2>/dev/null "$1" then x=1 test /usr/bin
+		sed /usr/bin | export awk sed cd x=1
+		"$@" export test export "$1" echo grep echo "$1" grep --verbose 2>/dev/null
+export && ${HOME} cd $(pwd) -eu 2>/dev/null && $(pwd) $(pwd)
+done sed x=1 sed local /usr/bin local 2>/dev/null 2>/dev/null
+	2>/dev/null 'quoted text' && /usr/bin -eu && --verbose local /usr/bin awk
+	-eu -eu /usr/bin local cd $(pwd) 2>/dev/null readonly awk && "$1" --verbose
+		x=1 -eu --verbose && "$@" export test && "$1" readonly "$@" 'quoted text' readonly
+done -eu awk 'quoted text' /usr/bin && $(pwd) "$@" 2>/dev/null "$@" done $(pwd)
+	readonly cd sed export "$1" --verbose 2>/dev/null test
+		awk 'quoted text' cd awk printf sed -eu local
+"$1" test 2>/dev/null echo
+	x=1 && 2>/dev/null 2>/dev/null
+	done "$@" then test /usr/bin cd | export
+		readonly cd test | ${HOME} cd readonly done
+	"$1" then readonly test /usr/bin ${HOME} 2>/dev/null $(pwd) $(pwd) ${HOME}
+		awk --verbose x=1 /usr/bin ${HOME} test printf test
+		then awk x=1 ${HOME} awk echo && -eu sed 'quoted text' 2>/dev/null "$@"
+		-eu cd -eu printf 2>/dev/null
+	2>/dev/null done printf
+		&& /usr/bin test "$@" ${HOME} x=1 "$@" export cd grep -eu then sed test
+	2>/dev/null sed grep export local export
+awk "$1" test sed grep grep "$@" local x=1 local 2>/dev/null echo
+	cd awk printf ${HOME} local printf x=1 echo "$@" "$1" "$1" then done
+		$(pwd) && && -eu grep sed awk $(pwd) | then then | printf 2>/dev/null
+awk awk x=1 ${HOME} awk "$1" --verbose
+/usr/bin 'quoted text' done ${HOME} 2>/dev/null echo
+	sed done "$1" echo printf
+		cd readonly readonly "$1" sed "$@" -eu done test then then local | sed then "$1"
+	sed "$1" 2>/dev/null 'quoted text' "$1" /usr/bin
+	--verbose "$@" "$1" 'quoted text' "$@" && | export
+	x=1 ${HOME} awk done printf echo 'quoted text' 'quoted text'
+		${HOME} | -eu echo then "$@" test readonly
+		"$1" cd x=1 x=1 awk "$@" readonly cd test x=1 grep done local --verbose
+	--verbose x=1 ${HOME} grep readonly
+		x=1 test readonly printf | local 'quoted text' /usr/bin grep test x=1 awk
+sed readonly | readonly awk --verbose awk echo echo
+	grep printf test awk cd $(pwd)
+	test 'quoted text' test | | test printf /usr/bin sed --verbose
+	2>/dev/null 'quoted text' ${HOME}
+		grep echo cd && cd 'quoted text' then ${HOME} sed $(pwd) echo
+		done /usr/bin -eu then $(pwd) | 2>/dev/null test
+		&& echo 'quoted text' echo
+	printf 'quoted text' export $(pwd) --verbose
+x=1 -eu -eu printf && x=1 done sed /usr/bin -eu && then "$1" 'quoted text' "$@"
+	'quoted text' sed awk "$1" "$1" awk "$1" test local
+"$@" 2>/dev/null printf test --verbose "$1" /usr/bin awk && readonly
+		test done then local | "$1" /usr/bin x=1 printf -eu
+$(pwd) sed cd | sed readonly 2>/dev/null echo ${HOME} x=1
+| test test echo "$@" sed "$1" test x=1 local test --verbose 'quoted text' &&
+$(pwd) x=1 /usr/bin "$@" printf echo x=1
+		sed test "$1" grep ${HOME} test -eu sed cd printf && then && && grep /usr/bin
+		grep test cd done test 'quoted text' echo
+		/usr/bin "$1" && done grep
+	$(pwd) local awk x=1 /usr/bin /usr/bin readonly --verbose
+		/usr/bin x=1 /usr/bin local
+${HOME} then $(pwd) echo printf --verbose export x=1 $(pwd) readonly
+x=1 $(pwd) cd x=1 export cd
+	sed grep x=1 /usr/bin sed done && "$@" done awk cd | "$1" |
+printf test awk $(pwd) test awk sed 'quoted text' && x=1 "$@" export &&
+readonly --verbose grep echo "$@"
+		cd test cd 'quoted text' local --verbose --verbose then -eu && local readonly
+	awk | export 'quoted text'
+&& && /usr/bin ${HOME} && echo 'quoted text'
+		then printf printf then export
+done | $(pwd) awk x=1 | done awk
+		"$@" "$1" export 2>/dev/null /usr/bin echo printf cd x=1 done ${HOME} test &&
+	'quoted text' export && sed grep local export && --verbose
+		--verbose grep /usr/bin && printf 2>/dev/null
+test echo echo /usr/bin 2>/dev/null $(pwd) | --verbose
+	then printf printf --verbose "$1" test done 2>/dev/null "$1" sed done
+${HOME} local -eu test local echo --verbose ${HOME}
+		&& done -eu | "$@" test x=1 sed grep "$@" sed $(pwd) x=1 ${HOME}
+	test done x=1 sed grep 2>/dev/null --verbose 'quoted text' "$@" 'quoted text'
+"$@" test "$@" 'quoted text' readonly
+printf then 2>/dev/null --verbose
+/usr/bin echo 2>/dev/null ${HOME} then -eu echo -eu ${HOME} && ${HOME}
+		export $(pwd) export awk -eu echo 2>/dev/null
+cd awk readonly test ${HOME} sed sed then cd "$1" $(pwd) | x=1
+--verbose "$1" x=1 /usr/bin test grep
+		| 'quoted text' ${HOME} cd export grep 2>/dev/null -eu awk export "$1" | -eu
+		2>/dev/null test 'quoted text' readonly && "$1" local 2>/dev/null 2>/dev/null
+grep grep printf echo "$@" grep x=1 test "$@" echo "$@" "$1" x=1 && echo
+		-eu $(pwd) --verbose /usr/bin then cd && grep
+	sed test -eu 2>/dev/null 'quoted text' 2>/dev/null cd sed echo test && readonly
+	/usr/bin readonly $(pwd) /usr/bin 2>/dev/null then /usr/bin
+	local awk test && 2>/dev/null then
+	x=1 readonly local "$@" test readonly
+	local cd echo 2>/dev/null -eu
+		echo "$@" test "$@" 'quoted text' awk "$1" then grep awk test $(pwd) 2>/dev/null
+		'quoted text' | export
+		cd echo test x=1 x=1 printf $(pwd) "$@" /usr/bin 2>/dev/null
+$(pwd) export | awk done | test | &&
+done done ${HOME} printf then 2>/dev/null |
+-eu local readonly "$@" | done ${HOME} $(pwd)
+	--verbose then done then 2>/dev/null x=1 then echo
+	/usr/bin /usr/bin printf local export --verbose
+	| done printf | --verbose cd /usr/bin
+'quoted text' "$1" x=1 /usr/bin test && test done grep /usr/bin
+$(pwd) /usr/bin ${HOME} printf "$@" /usr/bin "$1" "$1" "$1" ${HOME}
+		printf echo done "$@" -eu /usr/bin
+	grep readonly /usr/bin 2>/dev/null printf --verbose echo printf awk 'quoted text'
+local printf 2>/dev/null 'quoted text' readonly 'quoted text' "$@" grep
+		'quoted text' local cd "$1" test 2>/dev/null --verbose awk ${HOME}
+	| "$1" "$1" /usr/bin | $(pwd) awk 'quoted text'
+	"$@" "$1" -eu then ${HOME}
+	echo then test test --verbose ${HOME}
+	"$1" local 'quoted text' /usr/bin --verbose sed "$1" local $(pwd)
+	"$1" /usr/bin $(pwd) cd then echo x=1 | $(pwd)
+then printf 2>/dev/null "$@"
+		readonly /usr/bin 'quoted text' export x=1 --verbose && echo done export
+grep /usr/bin -eu export
+		grep && echo 2>/dev/null grep echo grep x=1 /usr/bin | $(pwd)
+		x=1 /usr/bin 'quoted text' ${HOME} -eu cd -eu export
+		&& $(pwd) $(pwd) ${HOME} 2>/dev/null
+--verbose 2>/dev/null sed $(pwd) --verbose
+x=1 then && sed -eu grep grep sed readonly ${HOME} "$@"
+		sed export echo && -eu test x=1 then x=1 cd "$@" "$1"
+		test export printf awk 2>/dev/null export 2>/dev/null
+		echo x=1 "$1" 2>/dev/null printf
+	-eu "$1" ${HOME} && $(pwd) done $(pwd) printf "$@" | grep done export 2>/dev/null
+		&& then grep -eu cd --verbose 2>/dev/null cd && done /usr/bin && then 'quoted text'
+	'quoted text' cd "$@" local $(pwd) done "$@" "$1" "$1" /usr/bin 2>/dev/null
+	--verbose done grep grep x=1 grep printf
+	echo 2>/dev/null 2>/dev/null 2>/dev/null awk local cd
+		echo 2>/dev/null awk readonly readonly
+	"$@" then local "$1" echo x=1 sed
+	cd cd done "$@" $(pwd) -eu
+	${HOME} | x=1 "$1" -eu export
+	-eu 'quoted text' then x=1 /usr/bin 2>/dev/null && | readonly x=1
+	printf "$@" ${HOME} "$1" cd --verbose
+	"$1" test printf echo echo --verbose "$@" "$@" test ${HOME}
+echo local local --verbose ${HOME} awk ${HOME} readonly test /usr/bin
+	cd ${HOME} "$@" awk "$1" --verbose then awk x=1 sed
+echo echo printf -eu && ${HOME} sed local 'quoted text' --verbose
+	2>/dev/null $(pwd) then 2>/dev/null
+	${HOME} 2>/dev/null readonly "$@" /usr/bin
+		'quoted text' printf "$1" ${HOME} 'quoted text' echo local then export sed
+"$@" sed 'quoted text' 'quoted text' cd readonly ${HOME} sed "$@" |
+		then grep "$@" $(pwd) | sed readonly 'quoted text'
+		echo test test 'quoted text'
+		grep /usr/bin x=1 echo cd x=1 cd
+then /usr/bin test sed awk echo $(pwd) x=1 local
+	local test awk && printf ${HOME}
+		/usr/bin 2>/dev/null done done echo awk sed printf x=1 | local printf
+"$@" sed awk $(pwd) awk
+	grep awk sed printf done test test
+	| cd "$1" awk x=1 cd $(pwd) echo then echo --verbose 'quoted text'
+	"$@" "$@" echo then -eu 2>/dev/null -eu then 'quoted text'
+	echo --verbose sed /usr/bin printf test then "$@" done test echo done
+cd readonly cd export local 'quoted text' local -eu
+		sed grep done /usr/bin /usr/bin grep grep 2>/dev/null readonly done -eu
+/usr/bin printf printf test ${HOME} done
+-eu done --verbose grep 'quoted text'
+		"$@" /usr/bin 2>/dev/null --verbose && export done && "$@" "$@" readonly
+	${HOME} printf cd "$@" "$@" then grep "$1" "$1" test done
+done test "$@" /usr/bin test grep local | $(pwd) sed sed x=1 --verbose /usr/bin
+	grep && -eu --verbose $(pwd)
+		"$1" $(pwd) test awk $(pwd) done | awk | then test
+		cd readonly ${HOME} "$@" $(pwd)
+-eu && local ${HOME} ${HOME} awk test "$1"
+	done then test | done
+	"$@" then | "$@" "$@" "$@" && --verbose local sed ${HOME} ${HOME}
+		"$@" export 'quoted text' x=1 test
+		printf x=1 echo x=1 readonly 'quoted text' $(pwd) "$@" /usr/bin awk echo
+	awk readonly local 'quoted text' test "$1" "$@" --verbose /usr/bin
+-eu test "$@" -eu /usr/bin -eu local "$1" test then readonly
+		"$@" awk --verbose then "$1" && 2>/dev/null sed x=1 test sed test then 2>/dev/null
+		test -eu done done done ${HOME} 'quoted text'
+	test grep awk $(pwd) readonly $(pwd) x=1 "$@" 2>/dev/null "$1" && sed
+echo local then cd && 2>/dev/null
+	-eu | 2>/dev/null -eu && ${HOME} readonly
+	${HOME} test test echo local $(pwd) awk --verbose
+"$1" --verbose awk $(pwd) then echo echo then awk printf done done "$@" &&
+sed 'quoted text' test echo
+'quoted text' 2>/dev/null --verbose test
+grep awk $(pwd) x=1 printf test done 2>/dev/null sed "$1" -eu 2>/dev/null
+	2>/dev/null export -eu echo "$@" && 2>/dev/null printf cd echo
+export --verbose then --verbose grep
+	| local export grep -eu done && cd test printf
+	2>/dev/null | awk | awk 'quoted text'
+	$(pwd) readonly | done echo export 'quoted text' export
+		| sed echo ${HOME} "$@" "$1" local sed done --verbose 'quoted text' "$@" printf
+$(pwd) grep 'quoted text' done
+	| | then local test -eu "$@" /usr/bin printf 'quoted text' $(pwd) &&
+then /usr/bin "$1" && 2>/dev/null cd
+	export ${HOME} test local && echo printf "$@" grep x=1
+		export /usr/bin awk printf && cd --verbose
+		2>/dev/null "$@" then grep export
+	local printf $(pwd) echo /usr/bin
+-eu test --verbose then 'quoted text' echo cd sed readonly -eu sed $(pwd)
+	local echo "$@" $(pwd) test ${HOME} "$1" printf readonly
+export -eu && printf "$1" 2>/dev/null 'quoted text'
+	then local sed 2>/dev/null cd $(pwd) local local
+	printf && grep then done "$1" printf awk "$@" /usr/bin grep echo | cd 2>/dev/null
+	readonly 2>/dev/null done "$1" echo | local echo
+local | 2>/dev/null echo then "$@"
+cd && echo /usr/bin readonly then readonly
+		printf local x=1 local 'quoted text' export x=1 ${HOME} then | test
+test ${HOME} grep && printf echo printf ${HOME} && x=1 local cd awk export then
+		local cd printf printf 'quoted text'
+		'quoted text' export readonly -eu export
+	cd x=1 "$1" ${HOME} readonly
+$(pwd) readonly | $(pwd) | cd -eu 'quoted text' sed 'quoted text'
+test echo sed cd grep /usr/bin | -eu -eu 2>/dev/null grep "$@"
+	local | $(pwd) /usr/bin "$1"
+	grep $(pwd) "$@" cd sed done $(pwd) sed 2>/dev/null x=1 --verbose
+done grep readonly cd x=1 then done echo | export cd
+$(pwd) 2>/dev/null $(pwd) test then then awk done --verbose && --verbose
+		cd | 'quoted text' $(pwd) $(pwd) printf x=1 cd 2>/dev/null echo $(pwd) -eu
+$(pwd) ${HOME} 2>/dev/null readonly printf x=1
+		cd done $(pwd) "$1" /usr/bin
+export -eu test /usr/bin 'quoted text'
+	then then 2>/dev/null test --verbose /usr/bin
+readonly test $(pwd) "$1"
+done export done && $(pwd) test grep export "$@"
+		sed grep -eu readonly sed /usr/bin
+		export done test -eu awk grep sed then printf && local cd 'quoted text'
+		grep then -eu readonly test export readonly then
+		sed grep cd export local -eu printf 2>/dev/null
+		| then cd x=1 echo && $(pwd) && cd then "$1" echo local
+	export x=1 /usr/bin done "$@" -eu printf export && ${HOME} test awk
+	x=1 "$@" 'quoted text' 2>/dev/null "$@" ${HOME} /usr/bin 'quoted text'
+	readonly local -eu x=1 ${HOME} then --verbose awk cd 2>/dev/null
+	x=1 grep printf 2>/dev/null | readonly ${HOME}
+test /usr/bin printf sed "$1" | readonly
+		'quoted text' printf readonly printf printf cd cd 2>/dev/null
+		x=1 ${HOME} readonly -eu
+	done -eu cd /usr/bin && done test && | "$1" local 'quoted text'
+"$1" done x=1 done && -eu grep
+	echo 2>/dev/null | -eu /usr/bin /usr/bin && sed
+		$(pwd) readonly printf then 'quoted text' test grep printf awk x=1 sed readonly
+		"$@" 2>/dev/null test export 'quoted text'
+| /usr/bin done local 2>/dev/null grep test | && test && -eu x=1 $(pwd) | local
+	echo 'quoted text' ${HOME} x=1 done then grep "$1" | 'quoted text' echo cd readonly
+	grep "$@" cd x=1 "$1" --verbose test echo "$1" "$1"
+		| 2>/dev/null test $(pwd)
+	'quoted text' echo x=1 local ${HOME}
+"$@" 'quoted text' x=1 'quoted text' local -eu sed
+printf sed /usr/bin printf
+x=1 --verbose sed then x=1
+	printf && /usr/bin -eu printf done --verbose x=1 sed --verbose sed | "$1" /usr/bin
+	cd && "$@" -eu awk test
+		$(pwd) 'quoted text' 2>/dev/null
+--verbose done "$@" awk test | awk x=1 | "$1" /usr/bin
+	test --verbose printf readonly $(pwd) sed local echo /usr/bin grep
+	export && local awk --verbose /usr/bin "$@" cd -eu "$1" 'quoted text'
+	/usr/bin 2>/dev/null test
+		"$@" grep test echo cd --verbose export readonly $(pwd) && && -eu cd grep grep
+	export /usr/bin readonly awk --verbose "$1" | test /usr/bin /usr/bin "$@"
+		echo export echo | cd && export sed local local /usr/bin awk sed ${HOME}
+	readonly echo /usr/bin then /usr/bin then cd "$@" "$1" ${HOME} |
+&& 2>/dev/null cd printf done | readonly
+		"$1" "$@" x=1 ${HOME} grep local sed done cd ${HOME} && readonly
+then awk awk 'quoted text' x=1 ${HOME} echo "$@" echo "$1" /usr/bin /usr/bin
+done | local echo awk test && test awk $(pwd) local && |
+		x=1 --verbose done x=1 done 2>/dev/null export printf --verbose
+	cd 2>/dev/null && sed "$@" 'quoted text' x=1 x=1 echo 2>/dev/null awk x=1
+		cd export "$1" /usr/bin printf done done && "$1" printf done "$@" -eu
+	grep then export "$1" 2>/dev/null 2>/dev/null && $(pwd) test 2>/dev/null |
+		'quoted text' awk cd "$1" cd 'quoted text' export ${HOME} grep echo 2>/dev/null
+		2>/dev/null echo -eu export
+then echo export then readonly "$@" $(pwd) readonly done grep x=1 --verbose
+	test $(pwd) | | 2>/dev/null x=1 'quoted text' readonly
+	"$@" readonly ${HOME} local -eu --verbose && echo printf echo | export sed
+		$(pwd) grep done readonly | export | && printf -eu test && local &&
+"$1" $(pwd) local x=1 grep && 'quoted text' cd local readonly then local --verbose
+	echo $(pwd) grep cd | then -eu cd
+		awk awk "$1" --verbose ${HOME} x=1 then grep "$1" /usr/bin "$1"
+		printf printf -eu cd sed ${HOME} awk echo
+"$@" local then /usr/bin cd printf done then 'quoted text' "$1" local cd && &&
+		${HOME} -eu 'quoted text' then done -eu | then --verbose
+		"$1" 2>/dev/null 'quoted text' x=1 &&
+$(pwd) cd /usr/bin printf /usr/bin 2>/dev/null x=1 -eu export cd
+	echo ${HOME} /usr/bin sed 2>/dev/null x=1 --verbose test cd $(pwd)
+		-eu sed done printf done then x=1 printf printf x=1
+		sed ${HOME} sed then sed test
+	done then local test test "$@" /usr/bin "$@" --verbose readonly
+&& grep printf x=1 done 'quoted text'
+	grep 2>/dev/null x=1 &&
+	$(pwd) && x=1 --verbose readonly
+	x=1 readonly sed "$@" readonly 2>/dev/null
+	sed echo readonly | 'quoted text' sed printf
+		--verbose /usr/bin && | printf 'quoted text' local grep sed "$1" && "$1" echo
+	"$@" x=1 x=1 readonly --verbose cd 2>/dev/null 'quoted text' then
+	awk 2>/dev/null awk sed test ${HOME}
+		| local sed test ${HOME} export done echo && 2>/dev/null -eu "$1" sed --verbose
+"$@" sed /usr/bin "$@" 'quoted text'
+		printf | grep $(pwd) 2>/dev/null done printf test awk awk cd
+printf "$@" 'quoted text' && test "$1" ${HOME} test local ${HOME}
+export local "$1" export "$@" test 2>/dev/null /usr/bin
+2>/dev/null /usr/bin printf awk awk 2>/dev/null local
+cd 2>/dev/null done -eu "$@" x=1 "$1" 2>/dev/null /usr/bin sed grep &&
+	x=1 echo sed $(pwd) x=1 cd | -eu -eu /usr/bin && /usr/bin done
+x=1 "$@" -eu && awk awk export ${HOME} printf then then x=1 grep /usr/bin
+done x=1 printf sed && grep
+"$@" --verbose echo "$@" readonly 2>/dev/null cd awk x=1 ${HOME} then /usr/bin
+		'quoted text' 2>/dev/null 'quoted text' sed 2>/dev/null readonly grep "$1" 'quoted text'
+		awk export then echo sed 2>/dev/null test cd --verbose -eu awk test "$1" local
+		printf "$@" x=1 local -eu
+		done x=1 awk local /usr/bin 'quoted text' --verbose local /usr/bin export
+'quoted text' /usr/bin echo "$@" then awk cd -eu export ${HOME}
+x=1 test done | --verbose sed /usr/bin grep awk 'quoted text' "$1" awk
+	--verbose 2>/dev/null $(pwd) -eu awk awk done "$1" x=1 cd 'quoted text' readonly
+		test cd "$1" "$1" "$1" export -eu readonly ${HOME} && awk $(pwd) echo then
+/usr/bin | | grep | grep && "$1" sed "$1" 'quoted text' $(pwd) /usr/bin
+2>/dev/null | cd export --verbose | awk echo && cd done
+		${HOME} export $(pwd) "$1" && "$1" readonly "$1" test x=1 grep grep 'quoted text'
+		/usr/bin ${HOME} $(pwd) sed "$1" "$@" "$1" "$@" && --verbose awk done
+	done awk "$@" | readonly readonly "$1" x=1 printf sed export awk
+test then cd ${HOME} 'quoted text' echo
+		"$@" then test local x=1 export echo awk readonly "$1" done readonly
+	awk awk "$1" printf done printf $(pwd) x=1 'quoted text' test local
+then echo awk readonly printf | printf cd "$@" echo then cd test readonly
+${HOME} readonly /usr/bin test grep 2>/dev/null
+		printf $(pwd) x=1 ${HOME} | $(pwd) then sed x=1 2>/dev/null
+-eu export 2>/dev/null "$1" echo $(pwd)
+readonly done awk 'quoted text' grep readonly awk x=1 | printf
+	cd grep ${HOME} /usr/bin "$1" cd echo "$@" printf cd echo awk cd "$1" echo sed
+	local /usr/bin readonly && | cd sed export echo
+grep | "$@" "$1" x=1 done echo cd -eu -eu local /usr/bin local grep
+-eu -eu $(pwd) then "$1" x=1 printf grep ${HOME} cd "$1" 'quoted text'
+		test 2>/dev/null readonly cd done -eu sed 'quoted text' $(pwd) printf
+		done done --verbose grep echo export "$@" -eu -eu sed grep
+		local awk sed 'quoted text' --verbose "$@" | | 'quoted text' && done sed ${HOME}
+		/usr/bin sed grep cd awk cd $(pwd) readonly x=1
+-eu then | sed then awk -eu local | ${HOME} x=1 -eu &&
+		&& local printf x=1 "$1" printf 'quoted text' then "$@" grep export 'quoted text'
+		sed grep && $(pwd) test $(pwd) x=1 "$@" printf awk awk /usr/bin awk -eu done sed
+	sed readonly printf echo readonly
+	local sed echo $(pwd) -eu cd local "$1" --verbose sed
+	then export "$1" -eu -eu sed awk local export 'quoted text'
+x=1 cd "$@" then x=1 "$@" -eu cd
+--verbose echo x=1 $(pwd) local -eu -eu | && ${HOME}
+		| ${HOME} local then "$1"
+${HOME} test "$@" local
+--verbose done | awk cd grep readonly cd cd
+done then local x=1 /usr/bin test then
+	${HOME} 2>/dev/null 'quoted text' 'quoted text' $(pwd)
+printf $(pwd) test awk --verbose
+	awk awk x=1 grep 2>/dev/null test ${HOME} && ${HOME} 'quoted text'
+		2>/dev/null | /usr/bin ${HOME} local echo
+		/usr/bin readonly 'quoted text' "$1" export then done "$1"
+	| test grep 'quoted text' && | && local
+| "$1" printf 'quoted text' -eu --verbose -eu ${HOME} cd
+	echo && local --verbose grep --verbose x=1 sed --verbose readonly ${HOME} then
+		&& && readonly ${HOME} then && --verbose
+	x=1 ${HOME} | /usr/bin 2>/dev/null sed printf $(pwd) then "$1" test -eu test
+awk /usr/bin 'quoted text' grep awk $(pwd) sed export
+	cd readonly test $(pwd) echo "$@" then test printf done /usr/bin --verbose awk
+then local readonly test && | export cd cd /usr/bin
+export echo /usr/bin && --verbose ${HOME} x=1 "$1" echo sed "$@" sed $(pwd) awk
+		$(pwd) x=1 && printf local awk local done
+		printf | 2>/dev/null export --verbose local | --verbose cd -eu printf
+		"$1" && -eu $(pwd) export awk $(pwd) grep /usr/bin local local
+'quoted text' && grep sed $(pwd)
+		test && export awk then "$1" local $(pwd) ${HOME} "$1" readonly "$@" awk
+/usr/bin test | awk cd /usr/bin
+		readonly local ${HOME} "$@" "$1" echo export
+		x=1 'quoted text' | "$@" grep "$1" cd "$@" /usr/bin
+	echo sed sed -eu echo $(pwd) &&
+| export local done ${HOME} --verbose then 'quoted text' -eu
+		x=1 local then local && awk $(pwd) done 'quoted text'
+	then echo "$1" /usr/bin
+		done cd export then x=1 -eu then printf /usr/bin printf printf
+		readonly "$@" readonly x=1 export
+'quoted text' done $(pwd) awk sed awk
+	sed ${HOME} test grep $(pwd) 'quoted text'
+	"$@" /usr/bin readonly echo x=1 done grep x=1 'quoted text' test
+grep && readonly done | "$1" $(pwd) 'quoted text' test -eu sed done
+${HOME} | test /usr/bin local printf test
+	test awk awk awk $(pwd) x=1 sed --verbose 'quoted text' grep printf "$1" test
+&& cd 2>/dev/null $(pwd) printf x=1 local
+	then $(pwd) "$@" "$1" --verbose echo done export /usr/bin
+		cd && 'quoted text' ${HOME}
+	printf -eu "$1" /usr/bin x=1 printf cd printf awk "$@"
+	"$@" --verbose then ${HOME} 2>/dev/null && 2>/dev/null export awk
+		2>/dev/null 2>/dev/null --verbose ${HOME} "$@" then
+	readonly export $(pwd) export | then x=1 awk awk x=1 then /usr/bin "$1" awk
+		local sed "$1" /usr/bin 'quoted text' test readonly "$@" echo |
+	sed test "$1" 'quoted text' 'quoted text' cd cd --verbose
+	then "$@" test "$@" 2>/dev/null && "$@" ${HOME} test --verbose
+	-eu x=1 echo 2>/dev/null "$@" then "$1" local
+		awk $(pwd) --verbose awk "$@" echo
+		done ${HOME} "$@" "$1" awk local printf
+		--verbose test cd done 'quoted text'
+		x=1 cd 'quoted text' sed -eu grep export --verbose export test --verbose
+printf cd $(pwd) readonly
+		done export 'quoted text'
+awk local sed cd echo 'quoted text' 2>/dev/null --verbose ${HOME} grep test /usr/bin
+2>/dev/null export "$1" && readonly --verbose test export awk -eu sed done test
+	local printf "$1" export echo
+		/usr/bin x=1 echo grep $(pwd) readonly printf 'quoted text' done
+	then grep sed /usr/bin && test -eu export done grep /usr/bin done
+	/usr/bin -eu printf test ${HOME} echo local x=1 "$1" /usr/bin
+		awk sed 'quoted text' /usr/bin "$1" readonly | readonly
+	readonly "$1" --verbose ${HOME} "$@" /usr/bin
+	test | done cd ${HOME} awk local sed echo /usr/bin /usr/bin 'quoted text'
+-eu grep ${HOME} "$1" /usr/bin --verbose readonly
+	'quoted text' readonly readonly then x=1 export grep | cd 'quoted text'
+cd then -eu echo "$1" -eu -eu "$1" && local grep --verbose
+	${HOME} ${HOME} printf test "$1" 'quoted text'
+		--verbose sed sed cd "$@" then x=1 then "$@" cd
+		readonly printf x=1 printf 2>/dev/null --verbose done --verbose
+		/usr/bin "$1" readonly
+	/usr/bin -eu /usr/bin "$1" ${HOME} 'quoted text' $(pwd) 'quoted text' "$1"
+	| && cd /usr/bin -eu then sed 'quoted text' && "$@" then
+$(pwd) /usr/bin readonly
+		printf test test export test echo done test
+&& awk echo readonly --verbose --verbose 2>/dev/null
+	$(pwd) && done local "$@" grep local readonly "$@"
+| 2>/dev/null test then printf "$1" test then awk
+	"$@" | cd cd readonly 'quoted text'
+		test 2>/dev/null --verbose 'quoted text' "$1"
+		x=1 test "$@" ${HOME} --verbose test /usr/bin done "$@" sed export done
+grep cd printf test $(pwd) local 'quoted text' done test /usr/bin sed ${HOME}
+	test done && "$@" grep test "$@" export -eu awk --verbose
+	export 2>/dev/null then | 2>/dev/null -eu /usr/bin printf then
+	printf awk && done export test done $(pwd)
+		'quoted text' ${HOME} 2>/dev/null x=1
+	&& --verbose grep 'quoted text' ${HOME} 'quoted text' && local grep "$@"
+sed ${HOME} printf "$@" 2>/dev/null awk
+		echo /usr/bin sed | && "$@" done cd |
+		cd 2>/dev/null ${HOME} $(pwd) && printf
+		awk cd local awk echo echo then "$1" done awk -eu && x=1 x=1 cd 2>/dev/null
+		$(pwd) then local | --verbose /usr/bin 'quoted text'
+		cd done ${HOME} && ${HOME} grep 2>/dev/null test done
+grep echo awk readonly "$@" export /usr/bin x=1 x=1
+		'quoted text' awk readonly test export then
+		| local done -eu "$@" export export --verbose
+cd sed x=1 readonly sed done && ${HOME} 2>/dev/null
+		printf cd printf -eu /usr/bin "$1" "$1" awk export /usr/bin
+	printf /usr/bin x=1 echo $(pwd) readonly "$@" printf export 2>/dev/null
+		x=1 cd x=1 awk -eu local sed /usr/bin
+printf 2>/dev/null readonly "$1" awk cd test done --verbose
+/usr/bin x=1 2>/dev/null ${HOME} echo grep x=1 2>/dev/null
+	cd -eu 2>/dev/null cd x=1 export awk echo local
+x=1 /usr/bin sed 'quoted text'
+	printf echo test test --verbose
+'quoted text' readonly
+		"$@" grep printf x=1 x=1 'quoted text' 2>/dev/null done "$1" printf 'quoted text'
+	then $(pwd) ${HOME} export done
+		done then sed echo --verbose "$@" readonly awk then echo printf
+	${HOME} 2>/dev/null ${HOME} x=1
+	readonly readonly printf printf 'quoted text' -eu 2>/dev/null
+		/usr/bin | cd export echo cd test "$1" x=1 --verbose test printf | $(pwd)
+		cd local 2>/dev/null "$@" sed readonly local 2>/dev/null
+		"$@" grep 'quoted text' readonly awk grep x=1 2>/dev/null printf "$1" done
+	readonly awk 2>/dev/null /usr/bin | test $(pwd) echo 2>/dev/null
+-eu readonly done ${HOME} awk 2>/dev/null test readonly done cd sed -eu readonly
+x=1 test sed echo printf readonly
+		grep && printf sed awk printf "$1" grep "$1" "$1" /usr/bin
+readonly "$1" $(pwd) /usr/bin
+		| && 2>/dev/null x=1 "$@" printf "$@" test test "$1" echo then --verbose cd sed
+		test test test | -eu ${HOME} printf
+$(pwd) 'quoted text' export -eu --verbose 2>/dev/null /usr/bin cd awk $(pwd)
+readonly then 2>/dev/null readonly sed | &&
+	cd ${HOME} awk && /usr/bin local $(pwd) readonly cd
+x=1 "$1" readonly done -eu test done cd | --verbose done x=1 done
+	${HOME} cd --verbose | echo $(pwd) &&
+"$@" awk readonly cd "$@" done test
+		done --verbose "$1" then
+		done -eu "$@" echo -eu awk x=1 /usr/bin
+	readonly -eu export /usr/bin export 'quoted text'
+"$@" $(pwd) echo -eu printf --verbose echo test readonly test
+		awk done awk done --verbose sed x=1 then export
+	&& "$1" printf --verbose
+"$@" "$@" export sed sed cd
+		grep "$@" awk export local cd
+	echo ${HOME} awk done "$1" cd 'quoted text'
+awk printf printf test printf printf export readonly sed
+	x=1 printf 'quoted text' printf cd "$1" done 'quoted text'
+printf /usr/bin -eu ${HOME}
+--verbose then echo 2>/dev/null awk export readonly && /usr/bin
+cd | printf local && export then export done readonly echo ${HOME} 'quoted text'
+2>/dev/null "$@" awk && "$1" /usr/bin x=1 awk | test "$@" x=1 "$1" export test
+then $(pwd) cd printf echo echo && 'quoted text' --verbose 'quoted text'
+		&& -eu awk 2>/dev/null | && grep grep && 'quoted text' | 'quoted text'
+	--verbose test --verbose readonly 2>/dev/null 'quoted text' local export x=1 export
+	then $(pwd) test -eu cd readonly | 2>/dev/null
+	awk "$1" "$1" /usr/bin echo "$1" local | "$1" then x=1 printf 2>/dev/null
+		local then --verbose grep --verbose && 'quoted text'
+grep && echo grep 2>/dev/null "$1" 2>/dev/null 2>/dev/null x=1 'quoted text' 'quoted text'
+'quoted text' 'quoted text' $(pwd) then done done
+2>/dev/null done -eu awk /usr/bin printf
+local "$1" cd grep "$1" then local ${HOME} ${HOME} | /usr/bin
+		"$@" x=1 'quoted text' $(pwd) 'quoted text' sed then done echo sed
+readonly && && --verbose local cd --verbose 'quoted text' then
+| x=1 --verbose echo && -eu 'quoted text' && done -eu "$@" /usr/bin
+		/usr/bin readonly awk readonly "$1" ${HOME} 2>/dev/null
+		-eu 'quoted text' done local export /usr/bin then -eu done then ${HOME} ${HOME}
+	printf "$1" awk cd cd export "$1" sed printf 'quoted text'
+	x=1 echo local test 'quoted text' printf echo && --verbose "$1" printf
+		awk -eu 2>/dev/null x=1 export sed grep | -eu x=1 | 2>/dev/null test && -eu awk
+readonly | local done readonly readonly
+		export awk local x=1 echo export /usr/bin -eu -eu 'quoted text' ${HOME} "$1" "$1"
+2>/dev/null printf readonly ${HOME}
+"$@" printf /usr/bin printf export | --verbose
+		--verbose /usr/bin 2>/dev/null 2>/dev/null readonly export -eu printf | then
+	${HOME} x=1 $(pwd) 2>/dev/null --verbose /usr/bin then test awk cd printf
+local sed --verbose printf 'quoted text'
+	--verbose | sed ${HOME} done 'quoted text' x=1 x=1 local
+	'quoted text' /usr/bin $(pwd) $(pwd) echo | 'quoted text' printf | then cd "$1"
+		2>/dev/null test awk printf
+-eu --verbose grep 'quoted text' echo 'quoted text' echo ${HOME}
+grep 2>/dev/null x=1 cd
+		test awk --verbose export | -eu x=1 x=1 --verbose
+grep 'quoted text' export "$1" readonly "$@" /usr/bin $(pwd)
+		"$1" echo sed grep --verbose test grep local $(pwd)
+	sed x=1 /usr/bin then | grep grep --verbose ${HOME} then awk cd && /usr/bin
+		test printf x=1 -eu ${HOME} grep cd test ${HOME} grep sed ${HOME} awk "$@" awk
+	export "$@" echo readonly "$1" test cd --verbose ${HOME} cd 'quoted text'
+sed awk awk then 2>/dev/null test "$1" | awk "$1" -eu sed 2>/dev/null
+grep local export readonly
+--verbose -eu x=1 grep awk readonly
+	x=1 && export local /usr/bin "$1" printf
+		| sed --verbose && -eu --verbose
+	/usr/bin /usr/bin printf && grep awk local sed
+	"$@" ${HOME} ${HOME} echo $(pwd) sed -eu $(pwd) sed
+	$(pwd) local echo then test x=1
+	"$@" $(pwd) cd cd && x=1 'quoted text' cd "$@" grep printf awk -eu
+	'quoted text' && cd then && readonly 'quoted text' --verbose && test /usr/bin ${HOME}
+	echo readonly echo done x=1 2>/dev/null echo
+	2>/dev/null awk test && 'quoted text' "$1"
+	x=1 export done awk grep echo
+	'quoted text' -eu echo "$@" ${HOME}
+grep sed printf --verbose echo | then 2>/dev/null
+| --verbose done then local
+	grep -eu ${HOME} grep local
+&& "$1" | cd cd x=1 /usr/bin grep ${HOME}
+		x=1 printf sed done then grep readonly then -eu "$@" local ${HOME} "$@"
+sed 2>/dev/null | awk ${HOME} grep readonly ${HOME}
+		&& sed local | done ${HOME} sed | done 2>/dev/null
+test $(pwd) printf | printf 'quoted text' awk done then local
+x=1 sed echo awk ${HOME} printf done $(pwd) done "$1" "$1" echo export ${HOME}
+	&& --verbose then export -eu local done $(pwd) printf "$1" ${HOME} then "$@"
+		"$@" | done /usr/bin local test done echo "$@" | "$1" && cd /usr/bin
+	echo readonly readonly done ${HOME}
+2>/dev/null local sed export echo grep $(pwd) test then export echo && awk
+		$(pwd) --verbose "$@" | test local x=1 test 'quoted text'
+		${HOME} cd then 2>/dev/null printf export 2>/dev/null "$@" done printf
+		2>/dev/null | cd ${HOME} 'quoted text' -eu done grep --verbose
+	echo then readonly x=1 'quoted text' 2>/dev/null "$@" readonly
+		x=1 2>/dev/null done --verbose ${HOME} awk | --verbose echo test local 2>/dev/null
+	"$@" "$1" --verbose -eu echo && "$@" readonly
+printf printf 2>/dev/null printf test
+		test /usr/bin --verbose readonly $(pwd) ${HOME} 2>/dev/null
+		2>/dev/null local /usr/bin 'quoted text' printf readonly test awk
+${HOME} grep x=1 ${HOME} --verbose
+| $(pwd) export -eu echo test export grep local "$@" printf | 2>/dev/null
+		$(pwd) /usr/bin --verbose
+		readonly readonly grep | --verbose 'quoted text' "$@" local "$1" ${HOME}
+		--verbose test 2>/dev/null cd grep /usr/bin test export echo --verbose
+		"$1" | cd export printf grep local grep printf done /usr/bin
+		readonly 'quoted text' x=1 test echo readonly test export --verbose readonly then
+		2>/dev/null awk && sed test && --verbose --verbose
+		export sed x=1 "$1" -eu grep | test | | | 2>/dev/null -eu $(pwd) | &&
+	done /usr/bin sed --verbose /usr/bin 'quoted text' done
+		cd | test $(pwd) "$@" 'quoted text' /usr/bin 2>/dev/null then $(pwd) printf
+		2>/dev/null readonly readonly "$@" --verbose "$@" "$1"
+	x=1 'quoted text' sed -eu then
+/usr/bin x=1 local ${HOME} ${HOME} then /usr/bin "$@" cd awk $(pwd)
+	&& export "$1" $(pwd) --verbose then | 2>/dev/null $(pwd)
+cd readonly echo /usr/bin echo -eu done
+	-eu x=1 && 'quoted text' done ${HOME} cd readonly local --verbose -eu echo
+		local /usr/bin local export export
+echo -eu "$1" && cd sed "$1" -eu readonly
+		"$1" echo "$@" 'quoted text'
+local sed ${HOME} "$1" grep sed | && | $(pwd)
+	--verbose then ${HOME} grep x=1 awk | printf readonly
+		done --verbose && local -eu --verbose -eu awk export echo printf awk
+	x=1 2>/dev/null then awk -eu $(pwd)
+awk | then "$@" 'quoted text' --verbose
+export x=1 cd -eu && export && sed "$1" then sed && test cd x=1 "$1"
+	"$@" done readonly --verbose done
+done | readonly printf | sed cd ${HOME} ${HOME} 'quoted text' local /usr/bin
+		test then then awk "$@" export sed "$1" readonly
+grep 'quoted text' && then printf printf ${HOME}
+		export sed $(pwd) $(pwd) |
+		&& "$1" 'quoted text' echo /usr/bin local 'quoted text' export 2>/dev/null done
+--verbose echo 2>/dev/null echo && --verbose local --verbose -eu &&
+	-eu "$1" ${HOME} && /usr/bin "$1" printf && x=1 readonly
+		$(pwd) grep awk export && test test grep export && cd 'quoted text' echo
+		${HOME} /usr/bin grep --verbose grep "$1" 'quoted text'
+	grep | readonly sed then "$1" && && awk x=1 readonly
+		export awk /usr/bin && test -eu printf $(pwd) then ${HOME}
+	local 'quoted text' test export sed grep printf
+2>/dev/null test test printf awk && "$@" "$1"
+printf "$@" /usr/bin | ${HOME} "$1" local && printf grep
+		local printf x=1 | echo echo "$1" $(pwd) ${HOME} sed cd
+		&& sed test x=1 ${HOME} | | 'quoted text' "$@" --verbose test 'quoted text' /usr/bin
+	x=1 echo test echo x=1 2>/dev/null test $(pwd) && -eu "$1" && export
+		${HOME} local readonly -eu export done
+	--verbose readonly 2>/dev/null
+		| "$1" 2>/dev/null -eu printf $(pwd) ${HOME} grep done done readonly ${HOME}
+'quoted text' readonly | done readonly awk awk ${HOME} sed local
+	local 'quoted text' --verbose $(pwd) awk 2>/dev/null $(pwd) ${HOME} && echo printf
+		| grep && 2>/dev/null 2>/dev/null /usr/bin sed /usr/bin
+/usr/bin printf echo printf -eu local
+		export 'quoted text' done -eu then
+	export sed && $(pwd) -eu readonly printf readonly readonly ${HOME} -eu
+	test done ${HOME} "$1" 2>/dev/null 2>/dev/null | "$1" ${HOME} test
+	printf grep test && awk printf printf local "$@"
+		--verbose -eu 2>/dev/null "$1" awk done "$1"
+		| ${HOME} done --verbose sed 2>/dev/null printf printf /usr/bin test
+readonly awk "$@" "$@" sed x=1 export 2>/dev/null grep then then
+printf printf && 2>/dev/null "$1"
+	"$@" x=1 | | /usr/bin then x=1 printf "$1"
+echo | done /usr/bin "$@" printf
+readonly | cd /usr/bin awk
+		x=1 x=1 then sed -eu cd "$1" $(pwd) then echo $(pwd) cd x=1 done
+		| $(pwd) test 'quoted text' "$1" /usr/bin
+		x=1 awk | cd grep cd 'quoted text' printf awk done then grep 2>/dev/null
+$(pwd) && then awk x=1
+	/usr/bin 'quoted text' "$1"
+readonly cd test then done /usr/bin sed $(pwd) local cd grep | x=1 | && -eu x=1
+		export 2>/dev/null -eu test /usr/bin awk echo "$@" export x=1 test 2>/dev/null
+		cd then echo echo 'quoted text'
+		readonly printf x=1 cd export awk && 'quoted text'
+x=1 export grep sed cd readonly 'quoted text'
+		cd export printf 2>/dev/null
+		--verbose cd ${HOME} 'quoted text' cd | 'quoted text' sed export then export
+	export x=1 then then "$@"
+		"$@" ${HOME} done export "$1" -eu --verbose
+		then $(pwd) grep then ${HOME} export "$@" readonly $(pwd) then "$@" awk "$1" 2>/dev/null
+		2>/dev/null echo | -eu cd then sed | readonly echo /usr/bin | /usr/bin
+/usr/bin $(pwd) 2>/dev/null
+		${HOME} awk ${HOME} && cd cd readonly
+	/usr/bin "$1" && && cd 2>/dev/null
+printf awk test --verbose $(pwd)
+cd 2>/dev/null ${HOME} then && && awk test | "$1" done "$1" local x=1 x=1 /usr/bin
+	'quoted text' "$@" "$1"
+awk -eu readonly && echo printf 'quoted text'
+		done | grep /usr/bin --verbose printf
+		test /usr/bin "$1" echo && $(pwd) "$1" then x=1 --verbose 2>/dev/null export
+awk --verbose 2>/dev/null
+grep grep 2>/dev/null | "$@" done --verbose
+	awk sed test x=1 2>/dev/null printf readonly x=1 cd cd grep | awk sed awk echo
+		x=1 export echo $(pwd) 'quoted text' cd
+	readonly | local echo export export $(pwd) export awk grep $(pwd) cd ${HOME}
+	| then x=1 x=1 export -eu 2>/dev/null local x=1 done ${HOME} 2>/dev/null readonly
+	echo awk 'quoted text' "$@" /usr/bin test --verbose echo 2>/dev/null
+	echo readonly cd 2>/dev/null readonly
+local && printf "$1" echo
+		x=1 done "$1" awk echo "$1" cd -eu readonly "$@" ${HOME}
+		-eu echo x=1 sed readonly x=1 $(pwd) | 2>/dev/null readonly
+"$1" sed && printf done cd then /usr/bin $(pwd) x=1 x=1 /usr/bin
+local $(pwd) --verbose "$@" cd export 'quoted text' cd ${HOME}
+| sed "$1" /usr/bin then sed echo readonly then export local /usr/bin
+	printf then /usr/bin echo ${HOME} local x=1 done sed
+		sed done export $(pwd) "$1" "$@" "$1" grep --verbose ${HOME} cd && readonly
+-eu cd readonly then then done $(pwd) done /usr/bin cd
+	${HOME} "$@" && awk "$@" && printf "$1" then local ${HOME} x=1 "$@" -eu test
+		2>/dev/null grep "$1" | local then $(pwd) 'quoted text' grep local
+	local readonly "$@" sed --verbose then -eu
+		cd grep "$1" then x=1 "$1" $(pwd)
+	&& "$1" -eu awk local $(pwd) "$@" | printf
+awk readonly local test
+	sed "$@" x=1 "$@" 2>/dev/null | 'quoted text' readonly
+	--verbose 2>/dev/null 2>/dev/null -eu "$@" test x=1
+/usr/bin $(pwd) x=1 export
+		local $(pwd) local done printf local echo done readonly grep
+		"$@" "$@" "$1" sed then "$@" done then "$1" test export -eu awk "$1" echo
+		sed sed echo export x=1 x=1 then "$@" printf && cd "$@"
+		test export test | awk && export export test /usr/bin ${HOME} grep
+grep "$@" -eu awk then -eu
+cd "$@" cd then -eu --verbose && | export "$1" "$@" x=1 'quoted text' done
+-eu 2>/dev/null "$@" test && --verbose
+	x=1 readonly --verbose --verbose "$@"
+		$(pwd) cd sed "$1" && printf test export
+readonly | $(pwd) 'quoted text' /usr/bin
+		/usr/bin && readonly -eu readonly && echo test 2>/dev/null
+x=1 echo awk x=1 --verbose
+readonly /usr/bin 'quoted text' "$1" cd /usr/bin /usr/bin 2>/dev/null
+| "$@" ${HOME} "$@" then printf echo done test export 'quoted text' printf
+	2>/dev/null --verbose 2>/dev/null x=1 && x=1 sed "$1"
+	echo -eu 'quoted text' x=1 awk "$1"
+		x=1 sed 2>/dev/null 'quoted text' sed
+then ${HOME} readonly
+		test /usr/bin 'quoted text' sed printf grep test local cd $(pwd) grep 2>/dev/null
+		export cd cd grep x=1 sed "$@" awk test grep "$1" sed /usr/bin grep local
+		test local "$@" cd -eu echo $(pwd) && sed /usr/bin "$@"
+	$(pwd) export export then export -eu
+	awk cd export -eu /usr/bin x=1 --verbose local
+done /usr/bin --verbose $(pwd) local echo cd && $(pwd) --verbose done done awk
+	awk --verbose ${HOME} test awk test then test
+		readonly $(pwd) x=1 /usr/bin 2>/dev/null
+x=1 echo local cd 2>/dev/null awk test awk && printf
+	awk done ${HOME} sed done "$@" /usr/bin local 2>/dev/null
+	/usr/bin sed | local 2>/dev/null
+2>/dev/null --verbose done
+2>/dev/null done done then "$1"
+	local grep | readonly -eu printf export 'quoted text' x=1 test sed
+	/usr/bin /usr/bin x=1 -eu "$@" readonly
+	grep test then ${HOME} --verbose echo sed done echo export
+2>/dev/null printf ${HOME} 'quoted text' then --verbose local /usr/bin
+		| -eu printf -eu 2>/dev/null /usr/bin export 2>/dev/null
+export readonly cd 2>/dev/null 'quoted text' echo printf local $(pwd) echo
+grep local "$1" test && "$@" && 2>/dev/null
+	export readonly test x=1 local "$@"
+&& printf && 2>/dev/null local && ${HOME} 'quoted text' then done ${HOME}
+	${HOME} /usr/bin export
+	done sed echo "$1" then -eu --verbose export
+test export printf ${HOME} |
+		then x=1 "$@" awk sed -eu ${HOME} $(pwd) awk test then
+2>/dev/null cd test 'quoted text' 2>/dev/null 2>/dev/null && "$1"
+	local done $(pwd) 'quoted text' -eu
+	readonly cd "$@" printf done sed then ${HOME}
+export $(pwd) $(pwd) printf grep grep test &&
+		/usr/bin && /usr/bin 'quoted text' sed /usr/bin -eu
+	/usr/bin $(pwd) done readonly awk /usr/bin "$1" -eu "$1" sed
+		awk x=1 cd done then "$@" readonly | cd sed printf
+		sed local echo readonly done sed test /usr/bin
+export test readonly 2>/dev/null done /usr/bin "$@" x=1 "$1" "$1" | "$1" echo
+'quoted text' ${HOME} test grep -eu 2>/dev/null 'quoted text' grep
+	2>/dev/null then awk -eu then export
+	$(pwd) 'quoted text' --verbose
+	"$1" then printf ${HOME} done
+	/usr/bin --verbose then "$1"
+	2>/dev/null | cd then cd then $(pwd) --verbose printf /usr/bin done printf
+	export ${HOME} then --verbose /usr/bin
+	"$1" grep then printf cd -eu export echo /usr/bin awk echo /usr/bin
+	--verbose awk "$1" ${HOME}
+--verbose local printf sed grep grep
+		export awk sed $(pwd) "$@" local cd then | export -eu local
+		x=1 'quoted text' echo sed test then then ${HOME} grep grep -eu /usr/bin awk
+		-eu "$1" awk x=1 awk --verbose export local -eu -eu test
+	"$1" -eu --verbose local | readonly "$1" | 'quoted text' -eu ${HOME}
+		-eu printf done echo | "$1" $(pwd) readonly readonly "$@" test local && 'quoted text'
+		echo local export echo readonly test echo -eu 2>/dev/null echo --verbose awk $(pwd)
+		| "$1" --verbose test awk readonly
+		cd /usr/bin /usr/bin 2>/dev/null echo done $(pwd)
+	| cd export /usr/bin "$@" 2>/dev/null --verbose
+x=1 printf local ${HOME} sed readonly grep printf sed done export "$@"
+	readonly "$1" echo 2>/dev/null done && echo ${HOME} /usr/bin sed grep
+	sed export && "$1" done /usr/bin --verbose
+'quoted text' && awk 'quoted text' grep x=1 $(pwd)
+&& cd "$1" "$@" x=1 $(pwd) test readonly printf awk /usr/bin test "$@"
+done export 2>/dev/null 2>/dev/null local -eu
+export $(pwd) grep then awk | test
+		--verbose readonly 2>/dev/null --verbose cd echo "$@" | then then sed test
+		"$@" $(pwd) | local "$1" ${HOME} | /usr/bin | then
+$(pwd) test && x=1 2>/dev/null
+	| --verbose printf echo export /usr/bin "$1"
+		/usr/bin local local export done printf -eu /usr/bin
+${HOME} local sed awk $(pwd) test --verbose cd 2>/dev/null "$@" /usr/bin echo &&
+		then 'quoted text' then $(pwd) $(pwd)
+cd /usr/bin -eu grep "$@"
+done -eu 'quoted text' then export awk /usr/bin "$1" --verbose
+	'quoted text' 2>/dev/null cd local ${HOME} -eu "$1" readonly x=1 -eu cd
+	--verbose && readonly export printf printf 'quoted text' grep done
+		export export "$@" local 2>/dev/null local
+	then 'quoted text' export && 2>/dev/null done
+		export awk -eu echo $(pwd) test then echo ${HOME} grep "$1" x=1
+		awk x=1 printf local then then done "$@"
+	cd -eu done "$1" export done export sed "$@" test /usr/bin | done awk "$1"
+&& readonly -eu --verbose export $(pwd)
+		sed ${HOME} export --verbose x=1 echo export | done cd echo readonly
+		done echo -eu cd | $(pwd) --verbose
+| 2>/dev/null grep cd 2>/dev/null export /usr/bin --verbose grep sed $(pwd)
+&& test 'quoted text' test
+		local readonly -eu -eu sed 2>/dev/null
+"$@" echo "$@" /usr/bin test $(pwd) readonly export -eu /usr/bin test cd 'quoted text'
+		-eu | x=1 --verbose 2>/dev/null "$@" test cd readonly cd &&
+		'quoted text' -eu "$1" printf | export readonly sed awk done printf /usr/bin sed
+	readonly grep echo local
+		local readonly "$@" printf 'quoted text' "$1" printf grep ${HOME} cd local 2>/dev/null
+&& --verbose done test && x=1
+	grep 2>/dev/null ${HOME}
+		2>/dev/null awk "$1" --verbose printf local readonly readonly awk test readonly
+		cd /usr/bin && /usr/bin
+readonly sed sed ${HOME} x=1 "$@" 2>/dev/null 'quoted text'
+	2>/dev/null x=1 sed 'quoted text'
+	'quoted text' 'quoted text' "$1"
+	done "$@" "$1" then x=1 sed x=1 ${HOME} | "$@" && done done -eu local "$@" cd export
+		x=1 test ${HOME} | sed 2>/dev/null awk | ${HOME}
+--verbose --verbose x=1 local awk 'quoted text'
+		--verbose cd | done grep
+		then echo --verbose local "$@" grep x=1 done
+	done /usr/bin --verbose "$@" sed $(pwd) -eu 2>/dev/null sed cd echo 'quoted text'
+	$(pwd) -eu test -eu awk done grep echo awk 'quoted text'
+${HOME} ${HOME} x=1 awk sed --verbose echo "$@"
+		2>/dev/null printf &&
+		done && $(pwd) grep -eu "$@" test then sed ${HOME} printf
+		-eu | "$@" "$1" printf $(pwd) $(pwd) then export then "$1" ${HOME}
+		"$@" cd ${HOME} x=1 cd grep 'quoted text' test -eu done
+		--verbose $(pwd) /usr/bin done
+	test $(pwd) "$@" ${HOME} -eu awk $(pwd) echo test x=1 /usr/bin
+-eu export printf | /usr/bin then local |
+	${HOME} done grep test --verbose echo -eu cd $(pwd) grep --verbose echo
+cd echo printf 'quoted text' | "$1" /usr/bin "$1"
+	then | ${HOME} && export local "$1" 2>/dev/null local then
+	"$@" test | awk /usr/bin sed readonly local
+	/usr/bin test grep export export --verbose echo grep --verbose
+done printf sed then x=1 | "$1" sed
+	then cd 'quoted text' -eu export grep &&
+		sed | --verbose echo grep x=1 readonly then export sed $(pwd)
+		sed sed 'quoted text' cd && sed "$1" local --verbose export /usr/bin sed 'quoted text'
+		&& awk awk awk then then
+	--verbose "$1" awk x=1 then ${HOME}
+	-eu --verbose --verbose done | --verbose grep then /usr/bin
+x=1 && cd echo cd x=1
+${HOME} /usr/bin ${HOME}
+printf readonly cd "$1" "$1"
+		--verbose -eu --verbose cd 2>/dev/null | sed &&
+		awk 2>/dev/null local done x=1 'quoted text' -eu /usr/bin
+then printf done local test
+		'quoted text' 2>/dev/null "$@" test test done then printf $(pwd)
+cd sed done sed export /usr/bin $(pwd) x=1 export done local 2>/dev/null ${HOME}
+		"$@" x=1 -eu 'quoted text' grep $(pwd) awk "$1" --verbose test && test x=1
+		2>/dev/null 'quoted text'
+	-eu $(pwd) printf $(pwd) sed | test then "$@" /usr/bin then grep sed $(pwd)
+cd x=1 printf $(pwd) sed export
+		'quoted text' "$@" echo "$@" "$1" export test grep
+x=1 "$@" ${HOME} "$@" local echo ${HOME}
+local test ${HOME} ${HOME} grep $(pwd) cd
+		done /usr/bin echo then
+	${HOME} ${HOME} grep done awk -eu $(pwd)
+local 'quoted text' x=1 then
+awk then cd && grep local "$1" test 'quoted text'
+echo /usr/bin && 2>/dev/null && --verbose readonly sed --verbose
+		"$1" x=1 ${HOME} "$1" readonly "$1" 2>/dev/null awk
+	printf local cd --verbose
+#include c184.sh
+	-eu 'quoted text' -eu then && readonly readonly
+		2>/dev/null sed test ${HOME} 2>/dev/null --verbose ${HOME} awk done
+	&& ${HOME} $(pwd) done export --verbose awk --verbose cd
+	-eu -eu x=1 "$@" then "$1" readonly test x=1 /usr/bin
+	local 'quoted text' printf test export test readonly $(pwd)
+readonly /usr/bin -eu test 2>/dev/null then printf /usr/bin
+	"$@" /usr/bin $(pwd) | echo ${HOME} then done "$@" ${HOME} --verbose --verbose
+	awk cd sed "$@" ${HOME} 'quoted text' export awk
+export test cd 'quoted text' 'quoted text' grep --verbose
+	echo echo local then done then done done test sed printf
+	grep "$@" x=1 readonly done -eu -eu printf 'quoted text' then cd awk "$1" -eu
+		-eu 'quoted text' 'quoted text' 2>/dev/null /usr/bin sed 2>/dev/null 'quoted text'
+		'quoted text' cd x=1 grep
+		-eu 'quoted text' "$1" printf | grep echo
+		then local ${HOME} /usr/bin --verbose
+| local cd grep then 'quoted text' -eu export
+	&& done "$@" grep readonly cd -eu 'quoted text'
+	/usr/bin cd sed readonly 'quoted text' export 'quoted text'
+	/usr/bin export readonly --verbose test
+		'quoted text' local readonly
+	awk export 2>/dev/null awk then done done then awk
+x=1 echo awk done readonly x=1 $(pwd) "$@" local "$1" $(pwd) echo
+		awk x=1 sed grep && /usr/bin done
+local then sed local 'quoted text' && $(pwd) test
+		cd test ${HOME} echo done "$1" readonly
+		local local x=1 export grep -eu -eu
+| cd ${HOME} grep sed readonly $(pwd) done test echo "$@" x=1 then awk "$@"
+		printf grep -eu "$1" 2>/dev/null readonly readonly
+&& done test export 2>/dev/null /usr/bin 'quoted text' awk "$@"
+done | done then grep done sed done echo && readonly && echo test export then -eu
+		${HOME} awk -eu awk local ${HOME} "$1" "$1" "$@" -eu x=1 2>/dev/null
+	| grep $(pwd) --verbose | then ${HOME} | && --verbose echo
+/usr/bin cd test | echo /usr/bin -eu test echo echo 'quoted text'
+		done ${HOME} export done readonly local export then 2>/dev/null 2>/dev/null
+		2>/dev/null x=1 -eu | grep export printf 2>/dev/null printf
+--verbose | awk "$@" test grep
+	done readonly | 2>/dev/null "$@" "$1"
+		${HOME} "$@" ${HOME} then | local /usr/bin | 'quoted text'
+		2>/dev/null printf ${HOME}
+	"$@" "$@" readonly printf readonly 'quoted text'
+local && local -eu 2>/dev/null export "$1" "$1" /usr/bin "$1"
+	2>/dev/null && $(pwd) x=1 "$@" readonly x=1 test cd $(pwd)
+test ${HOME} cd && -eu 2>/dev/null /usr/bin test && sed /usr/bin x=1 grep echo
+	x=1 x=1 grep /usr/bin readonly 'quoted text' "$@" 2>/dev/null
+		grep awk export local sed done echo export test awk
+		$(pwd) "$@" $(pwd) local echo readonly grep grep ${HOME} 'quoted text'
+	2>/dev/null "$1" then -eu | then 2>/dev/null
+		$(pwd) "$@" echo 'quoted text' cd
+		'quoted text' test local awk $(pwd) grep -eu ${HOME} then && awk done done
+	'quoted text' "$@" then echo then /usr/bin
+		'quoted text' "$1" | cd local echo
+sed 2>/dev/null | export 2>/dev/null export export
+	awk $(pwd) grep then ${HOME} done
+/usr/bin /usr/bin x=1 ${HOME} export then sed then | "$1" $(pwd)
+	2>/dev/null sed && --verbose cd readonly echo cd awk
+	$(pwd) export && done ${HOME} 'quoted text' 'quoted text'
+		grep "$1" test $(pwd) readonly
+echo awk echo echo local readonly
+"$@" "$1" "$@" 2>/dev/null awk
+	test test /usr/bin 2>/dev/null ${HOME} local sed 2>/dev/null readonly
+		x=1 awk /usr/bin echo x=1 local --verbose done
+		test then readonly /usr/bin -eu x=1 "$1" "$1" 'quoted text' sed --verbose && --verbose
+	printf local printf printf sed
+	/usr/bin local then sed done readonly /usr/bin awk /usr/bin && local awk x=1 test
+		cd | --verbose x=1 "$1" test "$@" cd grep "$@" test /usr/bin
+export /usr/bin readonly export 'quoted text' grep
+	awk -eu /usr/bin echo awk awk sed echo readonly ${HOME} readonly printf
+cd -eu /usr/bin cd then x=1 "$1" "$1" then --verbose grep
+	printf x=1 --verbose then 'quoted text' readonly --verbose ${HOME} | -eu
+	${HOME} | "$1" export 2>/dev/null && then grep /usr/bin
+	readonly done "$@" | && ${HOME} "$1" $(pwd)
+	export && sed export echo
+	export readonly /usr/bin "$@" local done --verbose x=1 $(pwd) && echo then
+	"$@" awk local && done "$1" -eu && echo
+		&& -eu && /usr/bin cd && /usr/bin 2>/dev/null echo local printf done awk
+	export done local sed && export "$1" ${HOME}
+	x=1 /usr/bin -eu && &&
+test awk awk done $(pwd) 'quoted text' "$1" test "$@" x=1 printf --verbose
+--verbose && 'quoted text' "$@" sed --verbose "$@"
+		'quoted text' /usr/bin printf cd export --verbose export -eu done "$1" printf local
+	cd /usr/bin "$1" local ${HOME} "$@" /usr/bin done
+		export 'quoted text' done cd --verbose
+test /usr/bin --verbose
+	done local test awk "$1" test awk printf done grep awk export
+	"$@" readonly sed $(pwd) grep /usr/bin
+'quoted text' sed | x=1 awk x=1 | done export sed ${HOME}
+"$@" readonly x=1 -eu awk local grep -eu echo && awk grep &&
+		done -eu --verbose -eu x=1 then /usr/bin
+	then && $(pwd) awk sed && test grep -eu 2>/dev/null
+		&& 'quoted text' && printf -eu grep then then
+	sed -eu --verbose cd 2>/dev/null cd
+printf done ${HOME} done echo x=1 then
+		${HOME} -eu && done 'quoted text' readonly x=1
+		local then | awk /usr/bin $(pwd) awk sed 'quoted text'
+	sed -eu --verbose 'quoted text' local readonly
+	sed readonly done test then echo /usr/bin
+	echo /usr/bin echo 2>/dev/null --verbose local awk cd $(pwd) grep then $(pwd)
+		$(pwd) then "$1" local grep printf test test --verbose printf && --verbose
+awk test | x=1 echo export
+export printf ${HOME}
+awk echo /usr/bin ${HOME} --verbose 'quoted text'
+"$@" $(pwd) local then export | awk "$@" echo /usr/bin
+		export x=1 printf test && readonly test && /usr/bin
+echo -eu done 'quoted text' cd "$@" local ${HOME} grep echo
+	then then grep export echo $(pwd) 'quoted text' "$1" 'quoted text'
+"$@" echo local -eu export --verbose echo local awk sed ${HOME} "$1"
+printf x=1 "$1" local done ${HOME}
+		"$1" | awk then readonly awk readonly readonly printf "$@" echo readonly 'quoted text'
+		echo sed $(pwd) done 2>/dev/null | /usr/bin readonly
+	readonly then $(pwd) done then
+done x=1 sed --verbose sed 2>/dev/null 'quoted text'
+		readonly export "$1" -eu readonly done ${HOME} readonly
+readonly "$1" 'quoted text' | 2>/dev/null ${HOME} "$1" export 'quoted text' grep
+		echo ${HOME} readonly done then export cd ${HOME}
+		grep /usr/bin ${HOME} readonly local export "$@" /usr/bin
+$(pwd) x=1 $(pwd) local sed export awk test test -eu local printf sed /usr/bin -eu
+	-eu /usr/bin ${HOME} | done cd done then awk "$1" readonly awk $(pwd) -eu x=1
+	then then ${HOME} echo $(pwd) grep grep cd sed ${HOME} done "$@"
+	&& -eu export printf echo /usr/bin grep
+$(pwd) "$@" then local | x=1 2>/dev/null local $(pwd)
+		then $(pwd) sed ${HOME} | sed | printf && | "$1" | export ${HOME} ${HOME}
+$(pwd) /usr/bin local x=1 awk && local echo awk
+	/usr/bin echo && "$1" sed done 'quoted text' readonly "$@" awk | | grep cd
+$(pwd) /usr/bin printf local --verbose printf /usr/bin printf /usr/bin
+	sed $(pwd) awk && /usr/bin 2>/dev/null /usr/bin grep export printf export ${HOME}
+		test awk | readonly "$@" $(pwd) ${HOME}
+printf awk awk test sed grep echo sed $(pwd) readonly
+	--verbose echo 2>/dev/null ${HOME} done
+		-eu grep -eu $(pwd) x=1 test -eu awk -eu --verbose
+		printf /usr/bin "$1" | test /usr/bin done -eu done ${HOME} 2>/dev/null test
+	x=1 "$@" "$@" local printf $(pwd) 'quoted text' printf -eu --verbose readonly export
+		2>/dev/null cd sed | "$1" $(pwd) --verbose "$@" export
+	cd | "$@" local done export echo --verbose ${HOME} readonly 2>/dev/null awk 2>/dev/null
+		awk 2>/dev/null ${HOME} --verbose printf -eu 'quoted text' "$1" "$1" cd test
+echo $(pwd) /usr/bin /usr/bin done echo printf local echo
+		$(pwd) && then readonly
+		done && && 2>/dev/null -eu x=1 x=1 then export
+x=1 then && /usr/bin cd grep sed done done /usr/bin && 'quoted text'
+	export /usr/bin "$@" local | "$@" export "$1"
+--verbose "$@" printf test $(pwd) x=1 then sed -eu sed x=1 && done ${HOME} x=1
+grep sed grep awk --verbose $(pwd)
+grep "$@" done export done cd awk
+	"$1" export sed 'quoted text' cd test
+	local awk printf 'quoted text' cd done ${HOME} local "$@" --verbose $(pwd) 2>/dev/null
+	'quoted text' export ${HOME} x=1 local 2>/dev/null export x=1 readonly
+	then | export export export
+		export then 2>/dev/null ${HOME} -eu awk |
+		awk readonly 2>/dev/null -eu export export printf $(pwd) grep done --verbose
+export readonly awk cd echo sed printf
+	export "$1" test ${HOME} 2>/dev/null done readonly 'quoted text' /usr/bin
+&& --verbose -eu x=1 grep readonly $(pwd) && awk export export -eu
+sed 2>/dev/null then "$1" | -eu printf "$@" --verbose
+x=1 /usr/bin test readonly grep | /usr/bin sed | readonly printf cd test "$1"
+		test grep /usr/bin | done
+		"$1" cd -eu x=1 ${HOME} /usr/bin readonly
+		local 'quoted text' 'quoted text' "$@" | ${HOME} | local 2>/dev/null
+	grep done x=1 test done 2>/dev/null -eu echo 2>/dev/null 'quoted text'
+		&& 'quoted text' "$@"
+	readonly done sed "$1" ${HOME} "$@" test 'quoted text' export
+	/usr/bin cd readonly "$1" echo local cd 'quoted text' && --verbose
+	| "$1" /usr/bin /usr/bin --verbose 2>/dev/null
+		-eu test awk cd "$@" echo grep 'quoted text' && test "$@" --verbose
+echo "$1" cd "$@" | "$@"
+${HOME} && awk /usr/bin then grep --verbose && $(pwd) && $(pwd)
+done printf "$@" && x=1 &&
+		done export 2>/dev/null $(pwd) ${HOME}
+	-eu ${HOME} /usr/bin /usr/bin | -eu 'quoted text' echo printf
+	"$1" && then && -eu local awk
+	then "$@" /usr/bin "$1" grep ${HOME} 2>/dev/null test
+		"$@" printf x=1 test readonly -eu -eu
+	test done readonly awk done readonly awk 2>/dev/null 'quoted text' -eu then
+&& printf $(pwd) test ${HOME} ${HOME} 'quoted text' done cd
+		printf readonly /usr/bin cd
+-eu "$1" "$1" done $(pwd) | sed 2>/dev/null
+${HOME} | ${HOME} test export echo local awk && echo done 2>/dev/null echo "$@"
+	/usr/bin cd printf "$@" readonly cd done x=1 2>/dev/null x=1 grep --verbose
+		then 2>/dev/null ${HOME} /usr/bin
+		--verbose "$1" /usr/bin ${HOME} | echo export awk
+		cd ${HOME} $(pwd) -eu -eu 'quoted text' && sed "$1" x=1 export 'quoted text'
+	x=1 awk echo done 2>/dev/null x=1
+	-eu cd export export
+/usr/bin /usr/bin 2>/dev/null grep sed
+	/usr/bin | awk ${HOME} | "$@" sed && awk done 2>/dev/null x=1 | /usr/bin
+$(pwd) then then done
+		2>/dev/null | ${HOME} grep -eu export then cd printf
+		&& readonly "$1" done then "$@"
+	| | | cd grep printf | | ${HOME} cd awk cd 'quoted text' export -eu -eu cd
+	grep echo 2>/dev/null printf then /usr/bin cd export then ${HOME}
+	| ${HOME} ${HOME} awk grep -eu -eu
+	"$@" 2>/dev/null x=1 echo ${HOME} export "$1" printf printf "$1" | "$1" &&
+grep -eu printf sed 'quoted text' --verbose done then
+		${HOME} | grep /usr/bin export --verbose 2>/dev/null
+	grep x=1 'quoted text' echo | --verbose then --verbose test echo local && export
+	printf x=1 printf ${HOME} $(pwd) export
+		2>/dev/null "$@" export
+	"$@" && cd awk -eu "$1" export
+grep done ${HOME} sed then local
+| local done readonly 'quoted text' then /usr/bin sed | echo x=1 -eu
+export 2>/dev/null $(pwd) sed then grep 'quoted text' test -eu
+	--verbose local 'quoted text' local --verbose
+$(pwd) sed "$1" cd printf printf "$1" "$@" printf
+$(pwd) "$1" export "$1" | /usr/bin "$1" done -eu readonly "$1" -eu export 'quoted text'
+done 'quoted text' -eu && export "$1" x=1 && done export export
+		sed /usr/bin echo local test export --verbose readonly "$@" 2>/dev/null
+		/usr/bin $(pwd) --verbose "$@" "$@" $(pwd) printf readonly | awk && /usr/bin
+cd && --verbose | local x=1 | "$1" grep echo $(pwd) x=1 | cd | 2>/dev/null
+${HOME} x=1 sed --verbose readonly
+		/usr/bin echo x=1 printf cd cd 2>/dev/null test
+	printf 'quoted text' local done printf
+		-eu echo | awk then sed test ${HOME} printf awk 2>/dev/null grep x=1 x=1 test
+"$@" readonly ${HOME} done
+	"$@" cd printf --verbose echo local done then "$1" export x=1 awk 2>/dev/null
+		'quoted text' ${HOME} test x=1 readonly export && cd
+		x=1 $(pwd) && grep /usr/bin ${HOME} -eu awk awk export --verbose grep $(pwd) ${HOME}
+	"$@" ${HOME} grep readonly x=1 then grep x=1 "$@" 'quoted text' echo printf echo
+	printf /usr/bin "$1" echo --verbose test grep awk && -eu | done
+	done export $(pwd) --verbose 2>/dev/null "$1" "$@" test "$@" "$@"
+&& $(pwd) $(pwd) cd done echo && 2>/dev/null printf readonly
+	"$1" test grep --verbose awk printf echo echo /usr/bin
+	"$@" sed echo /usr/bin | readonly then readonly $(pwd) readonly
+$(pwd) local then x=1 sed && printf $(pwd) printf done 'quoted text' sed
+		readonly then cd done test printf
+		&& -eu awk ${HOME} "$1" sed "$@" local $(pwd) $(pwd) $(pwd) &&
+done awk 'quoted text' readonly ${HOME} --verbose grep 2>/dev/null local
+	test echo then test printf --verbose
+	'quoted text' printf $(pwd) $(pwd)
+	done awk grep export done then local
+	printf 2>/dev/null test 'quoted text' --verbose
+	"$1" "$@" export export awk --verbose local done | printf -eu
+local 'quoted text' cd printf readonly 'quoted text' then awk done && local
+		export /usr/bin | x=1 ${HOME}
+		readonly then 2>/dev/null readonly export x=1 'quoted text'
+	local export grep 2>/dev/null && test
+	/usr/bin --verbose printf 2>/dev/null $(pwd) grep -eu "$1" local
+		"$@" sed export export
+	/usr/bin | ${HOME} --verbose
+-eu printf printf 2>/dev/null 2>/dev/null
+		awk echo /usr/bin && test /usr/bin && -eu
+"$@" export "$@" local done "$1" "$1" printf
+"$@" "$1" cd /usr/bin export
+		2>/dev/null x=1 export x=1 $(pwd) --verbose readonly export test 'quoted text'
+done printf /usr/bin "$@" cd readonly readonly test cd | echo x=1 /usr/bin
+	grep x=1 cd && local 2>/dev/null done /usr/bin 'quoted text'
+test x=1 grep done "$@" "$1" sed "$@" then echo | local sed export
+	"$1" $(pwd) ${HOME} && "$1" export
+'quoted text' 2>/dev/null export then /usr/bin /usr/bin awk
+	-eu awk $(pwd) --verbose x=1 done 'quoted text' done export sed x=1 test
+	&& readonly sed 2>/dev/null $(pwd) grep "$@" -eu export awk
+| 'quoted text' --verbose then | local --verbose
+	export "$@" grep x=1 printf then
+		| printf echo /usr/bin ${HOME} "$@" && x=1 then then /usr/bin
+	2>/dev/null --verbose done cd done readonly 'quoted text' grep then printf
+export && then local echo
+then done awk "$1" ${HOME}
+	| x=1 readonly -eu then export ${HOME} cd ${HOME} 2>/dev/null
+		then printf awk then "$@" printf -eu
+-eu sed /usr/bin "$1" ${HOME} printf local then printf x=1 ${HOME} $(pwd) then
+readonly test sed awk printf $(pwd)
+	| 'quoted text' grep --verbose && $(pwd) grep cd "$@"
+--verbose local && then "$@" ${HOME}
+		/usr/bin "$@" local cd export 2>/dev/null test then -eu readonly && cd
+		echo local --verbose | 2>/dev/null
+	echo grep done -eu "$1" 2>/dev/null local -eu | readonly grep $(pwd)
+done $(pwd) printf readonly cd
+		sed -eu echo && ${HOME} $(pwd) export printf 'quoted text' --verbose
+	readonly awk done test
+'quoted text' 'quoted text' test readonly -eu test ${HOME}
+		local readonly | export -eu
+		test sed 'quoted text' local "$1" $(pwd) awk | | 'quoted text'
+		--verbose --verbose sed export --verbose local
+$(pwd) readonly "$@" 2>/dev/null then /usr/bin /usr/bin x=1 local printf
+		sed ${HOME} | readonly done "$1" test echo printf 'quoted text' 'quoted text'
+		| /usr/bin printf test echo /usr/bin $(pwd)
+		grep ${HOME} export sed 2>/dev/null test awk
+		2>/dev/null sed then local
+	&& test && "$1" printf "$@" printf awk grep 'quoted text' x=1 done -eu -eu local
+		printf cd -eu $(pwd) done local cd grep ${HOME} 'quoted text' --verbose echo
+"$@" 'quoted text' && ${HOME} grep echo grep printf &&
+	/usr/bin x=1 export "$1" sed cd readonly
+	printf 'quoted text' local
+	then "$1" local | ${HOME} $(pwd) sed awk
+"$1" x=1 grep --verbose 'quoted text' x=1 readonly "$1" export
+		'quoted text' 'quoted text' sed "$1"
+		then readonly then test /usr/bin
+--verbose --verbose grep "$1" "$@" sed then $(pwd)
+		export | $(pwd) echo cd local local "$@" ${HOME} 'quoted text'
+	| then test done echo x=1 cd
+	${HOME} readonly ${HOME} echo cd cd "$@" -eu && cd $(pwd) printf printf
+-eu x=1 then 'quoted text' | 2>/dev/null -eu done 'quoted text' then test ${HOME}
+	/usr/bin /usr/bin then -eu -eu done done export 2>/dev/null
+/usr/bin ${HOME} sed 2>/dev/null 2>/dev/null
+	awk export -eu readonly $(pwd)
+printf printf "$@" 'quoted text' done awk "$@"
+		| $(pwd) local done local export /usr/bin done ${HOME} 2>/dev/null readonly
+sed 'quoted text' grep 2>/dev/null /usr/bin awk $(pwd)
+		readonly /usr/bin local "$@" 'quoted text'
+		printf echo sed test -eu sed echo -eu awk grep x=1
+-eu ${HOME} done x=1 ${HOME} | -eu
+		then done -eu sed sed | | awk 2>/dev/null awk "$@" && done x=1 cd 2>/dev/null 'quoted text'
+	${HOME} sed | awk then cd then -eu then "$@"
+	2>/dev/null "$@" "$@"
+		2>/dev/null "$1" | 'quoted text' export local printf -eu done x=1 "$@" "$@"
+		'quoted text' grep && then /usr/bin readonly
+	2>/dev/null 'quoted text' && export cd awk "$@"
+		export && 2>/dev/null /usr/bin
+		export awk "$1" --verbose then && 'quoted text' 2>/dev/null "$@" cd sed
+		grep then /usr/bin 'quoted text' --verbose
+		local grep grep then
+	${HOME} | "$@" "$1" sed $(pwd) "$@" /usr/bin sed echo
+x=1 --verbose local test $(pwd) test
+		2>/dev/null printf readonly
+done test /usr/bin -eu 'quoted text' /usr/bin 2>/dev/null
+	/usr/bin readonly done | echo echo -eu --verbose x=1
+		2>/dev/null 'quoted text' 2>/dev/null
+	| readonly printf --verbose 2>/dev/null
+	&& test "$1" then echo -eu done x=1 local
+	$(pwd) "$1" awk /usr/bin /usr/bin -eu
+		| local local printf readonly sed local test
+x=1 local echo readonly x=1 grep 2>/dev/null echo x=1 --verbose "$@" done
+	echo "$1" done printf "$@" x=1 local
+	/usr/bin grep | --verbose readonly sed local
+awk ${HOME} x=1 readonly "$@" sed ${HOME} --verbose
+local sed --verbose done /usr/bin $(pwd) ${HOME} grep export
+	printf -eu x=1 done echo x=1 x=1 printf 2>/dev/null
+		grep grep printf --verbose export
+		test x=1 local --verbose --verbose
+$(pwd) 2>/dev/null printf $(pwd) test grep x=1 local grep then echo | then export
+	$(pwd) grep $(pwd) --verbose echo $(pwd) 'quoted text'
+	/usr/bin echo printf sed sed test readonly awk
+awk grep sed && ${HOME} test $(pwd) echo 'quoted text' export
+	2>/dev/null cd test test then 2>/dev/null
+	"$1" test readonly 2>/dev/null cd test ${HOME} grep cd | test $(pwd)
+| 2>/dev/null cd awk test done "$@" grep grep local | $(pwd) $(pwd) --verbose
+/usr/bin local "$1" /usr/bin -eu "$1" export printf $(pwd) export done
+		"$1" --verbose printf sed "$1" "$@"
+-eu printf "$1" grep export 2>/dev/null $(pwd)
+test && done ${HOME} 'quoted text' --verbose
+then "$1" ${HOME} 2>/dev/null ${HOME} echo 2>/dev/null
+&& --verbose -eu x=1 local x=1 /usr/bin
+"$@" awk local test then
+		readonly "$@" printf && $(pwd) 'quoted text' | -eu done printf /usr/bin test
+then | printf x=1 awk export /usr/bin x=1 grep "$1" /usr/bin --verbose
+		printf echo printf export
+	$(pwd) local printf test sed 'quoted text' awk 'quoted text' printf
+	"$@" $(pwd) cd done x=1 2>/dev/null test grep then grep sed ${HOME} echo | 2>/dev/null
+	--verbose sed cd --verbose /usr/bin && echo -eu echo local test --verbose awk
+		awk -eu "$1" readonly awk 2>/dev/null "$@" local echo sed export $(pwd) grep echo
+	"$1" /usr/bin export test cd 2>/dev/null echo "$1" 'quoted text' ${HOME} | local
+	sed ${HOME} local x=1 cd printf
+local $(pwd) awk export printf then cd --verbose
+"$1" && grep 2>/dev/null export readonly cd export "$1"
+		test readonly printf then && cd 'quoted text' awk sed sed ${HOME} | 'quoted text'
+	test then grep x=1 | awk "$@" readonly cd x=1 local --verbose
+		printf "$@" 'quoted text' ${HOME} local grep test &&
+	sed && echo readonly export -eu then printf "$@" then printf test cd -eu
+		cd 'quoted text' grep "$1" awk 'quoted text' echo x=1 local cd
+		awk then /usr/bin && "$@" "$@"
+	${HOME} cd && x=1 local "$@" echo
+	sed | printf test local 'quoted text' local readonly export grep then
+		'quoted text' | | "$1" 'quoted text' /usr/bin &&
+&& && local local -eu x=1 then printf
+| echo local readonly readonly
+	/usr/bin printf done /usr/bin $(pwd) then 2>/dev/null grep $(pwd) cd then 'quoted text'
+	x=1 && local then | x=1 test
+	sed /usr/bin 2>/dev/null done /usr/bin test 2>/dev/null --verbose
+		| cd "$@" export printf $(pwd) printf cd readonly
+2>/dev/null local -eu | 'quoted text'
+		-eu -eu ${HOME} "$@" echo cd && && | ${HOME} printf x=1 local
+		grep echo then /usr/bin
+--verbose readonly && -eu printf "$1" printf readonly readonly cd $(pwd)
+cd && cd x=1 awk "$@" | | local $(pwd) then ${HOME} printf && test "$1" "$1"
+&& -eu local "$@" --verbose 'quoted text'
+${HOME} "$@" $(pwd) printf --verbose
+	local readonly done test cd done
+		/usr/bin | | readonly && | $(pwd) "$@" x=1
+then "$1" then readonly awk awk export --verbose grep "$1" grep /usr/bin
+	| 2>/dev/null "$1" 2>/dev/null -eu 2>/dev/null && $(pwd) $(pwd) "$1"
+'quoted text' cd && && cd printf then --verbose | local export test printf
+	"$@" 'quoted text' printf
+/usr/bin awk $(pwd) sed x=1 --verbose test printf echo
+		printf 'quoted text' --verbose
+		--verbose 2>/dev/null test readonly | /usr/bin sed | done readonly
+${HOME} done local cd "$@"
+	-eu done 'quoted text' cd x=1 -eu "$1" test done -eu | done
+--verbose local then | 'quoted text' echo then awk done readonly 2>/dev/null
+		done sed 2>/dev/null echo "$1" "$1" then ${HOME}
+	readonly awk echo 2>/dev/null "$@"
+	printf ${HOME} -eu echo 'quoted text' ${HOME} test /usr/bin "$@"
+		export grep export local
+		${HOME} x=1 awk grep 2>/dev/null done "$@" readonly
+		'quoted text' readonly -eu done && sed ${HOME}
+printf sed local local 'quoted text' --verbose then echo then "$1"
+"$@" x=1 printf sed --verbose done ${HOME} | cd sed readonly readonly
+		readonly 2>/dev/null 2>/dev/null done cd cd "$1" 'quoted text' --verbose
+		2>/dev/null && x=1 local --verbose && /usr/bin grep printf
+		cd readonly 2>/dev/null local
+	then local x=1 done && printf export -eu
+		--verbose export echo /usr/bin
+	| cd "$1" grep -eu "$1" done awk x=1 "$1" awk -eu | ${HOME}
+		awk local then "$1" "$1" "$1" "$1" $(pwd) local printf $(pwd)
+	done "$@" export -eu test
+	| ${HOME} "$1" $(pwd) test
+	printf && grep local 'quoted text' echo &&
+		"$@" --verbose && cd awk "$1" local printf | export
+		awk then --verbose /usr/bin 'quoted text'
+	cd echo local 2>/dev/null test 2>/dev/null export local test $(pwd)
+export done cd 2>/dev/null "$@" "$@" ${HOME} /usr/bin sed 'quoted text' -eu printf
+${HOME} /usr/bin "$@" ${HOME} "$@" /usr/bin 'quoted text' $(pwd) | sed export |
+		readonly 'quoted text' /usr/bin sed x=1 "$@" x=1 done "$@" grep -eu
+sed 'quoted text' 'quoted text' /usr/bin | cd | echo x=1 awk export "$@" && $(pwd)
+	'quoted text' $(pwd) echo export local done printf $(pwd)
+printf -eu cd done then local readonly 'quoted text' 'quoted text' awk
+		grep done grep 2>/dev/null "$1" local 2>/dev/null $(pwd) | test cd export
+		grep export --verbose done ${HOME} test
+	-eu ${HOME} awk x=1 | grep export "$1" readonly export $(pwd)
+	"$1" "$@" $(pwd) then sed grep "$@" then cd $(pwd) x=1 echo readonly -eu grep -eu
+		export printf | x=1 grep | "$@" ${HOME} 2>/dev/null then | 'quoted text'
+	done 2>/dev/null grep grep cd printf local -eu
+	echo x=1 "$@" ${HOME} echo test
+/usr/bin && awk grep "$1" test && then x=1
+	/usr/bin grep done -eu && "$@" 'quoted text'
+	"$1" printf && sed x=1 test
+	grep /usr/bin --verbose 2>/dev/null then
+$(pwd) | local sed "$@" then && sed
+		&& echo --verbose | sed cd 'quoted text' readonly -eu $(pwd) -eu local
+-eu --verbose && "$1" cd echo done test --verbose "$1" export
+	'quoted text' then printf | && "$@" awk 'quoted text' && cd local
+		done export test 'quoted text' --verbose readonly test export echo local "$1"
+grep 2>/dev/null /usr/bin | test
+${HOME} then done sed done ${HOME} -eu awk ${HOME} test
+	/usr/bin readonly awk | $(pwd) ${HOME} 2>/dev/null printf "$@" then export
+'quoted text' test /usr/bin | sed
+	echo local cd 'quoted text' grep
+-eu cd cd ${HOME} | --verbose done test export | x=1 cd printf cd x=1
+	test export | sed local -eu "$1" /usr/bin -eu && printf awk "$1" test "$@"
+-eu readonly test test "$@" 2>/dev/null cd && "$1"
+		-eu grep --verbose /usr/bin && test | 'quoted text'
+${HOME} ${HOME} echo x=1 && && sed echo -eu |
+		readonly /usr/bin && -eu printf echo --verbose /usr/bin
+"$@" "$1" | "$1" test && 'quoted text' sed
+	export ${HOME} -eu && grep then local /usr/bin 'quoted text'
+done | awk && $(pwd) "$@" 2>/dev/null awk -eu printf echo 2>/dev/null
+/usr/bin $(pwd) awk export done echo local export 'quoted text' |
+local ${HOME} /usr/bin -eu -eu "$@" test | printf --verbose cd "$1" sed /usr/bin
+		&& done -eu | /usr/bin --verbose "$1" 'quoted text'
+"$@" local "$@" then
+		export cd x=1 --verbose cd cd x=1 -eu test "$1"
+	--verbose 'quoted text' $(pwd) && "$1" "$1"
+test done done | printf 'quoted text' readonly readonly then test
+$(pwd) awk export echo echo cd | "$1" "$@" --verbose
+test local && local local
+		/usr/bin sed 'quoted text' -eu x=1 2>/dev/null
+	/usr/bin export --verbose --verbose /usr/bin printf readonly && sed test --verbose
+		readonly ${HOME} local 'quoted text' "$@"
+		2>/dev/null local ${HOME} 'quoted text' 'quoted text'
+	then printf && awk sed --verbose grep x=1 test then done "$@" local /usr/bin
+		-eu "$@" --verbose test awk 'quoted text' 2>/dev/null 'quoted text' then echo
+		"$@" awk awk local printf x=1 printf | grep done awk && 'quoted text' | cd ${HOME}
+then readonly --verbose -eu $(pwd) "$@"
+	--verbose $(pwd) then "$@" grep grep sed "$1" | sed 'quoted text'
+	"$@" local /usr/bin export ${HOME} grep local 'quoted text' test printf 'quoted text'
+	x=1 2>/dev/null --verbose done
+	${HOME} 2>/dev/null -eu ${HOME} /usr/bin --verbose
+	--verbose local export cd grep && grep 'quoted text' -eu "$1" "$@" readonly &&
+	'quoted text' -eu printf
+echo sed echo /usr/bin cd test | $(pwd) && readonly printf grep cd grep export
+	'quoted text' "$@" echo echo sed
+	echo export test | "$1" $(pwd)
+		${HOME} readonly | export awk /usr/bin local ${HOME} awk -eu
+	echo /usr/bin 'quoted text' x=1 awk sed --verbose
+	-eu "$1" grep "$1" "$1" $(pwd) $(pwd)
+test -eu "$@" 'quoted text'
+	2>/dev/null awk local done export "$@" ${HOME} /usr/bin echo cd awk readonly
+	then awk echo $(pwd) /usr/bin grep && grep then
+		--verbose printf export ${HOME} $(pwd) printf export readonly grep
+	/usr/bin echo --verbose test readonly 2>/dev/null
+readonly sed && echo "$1" --verbose echo readonly /usr/bin
+		readonly && $(pwd) test awk
+	-eu $(pwd) readonly x=1 -eu readonly printf ${HOME} printf local && awk echo /usr/bin
+	export | cd | then x=1
+	then readonly test local "$1" echo awk sed x=1 cd test
+		export 2>/dev/null --verbose cd cd $(pwd) | echo grep |
+		cd export done export /usr/bin test $(pwd) export ${HOME} local
+&& local && 'quoted text' test "$1" then 2>/dev/null echo x=1
+		"$1" 2>/dev/null 2>/dev/null
+	awk && x=1 test readonly "$1" then 'quoted text' "$1" $(pwd)
+sed && echo "$@" "$@" 2>/dev/null /usr/bin echo -eu --verbose ${HOME}
+	echo "$@" grep /usr/bin awk cd "$1" printf -eu cd 2>/dev/null printf /usr/bin /usr/bin
+readonly sed echo sed grep "$1" "$@" 2>/dev/null then &&
+/usr/bin "$@" && printf 2>/dev/null sed "$@" 'quoted text' local | x=1 "$@"
+	"$1" && && export local readonly "$1" echo grep 2>/dev/null
+		&& "$1" | 'quoted text' "$1" --verbose export readonly then && readonly
+		${HOME} --verbose then export awk ${HOME} $(pwd) then --verbose
+	local $(pwd) | local 'quoted text' sed --verbose
+	--verbose test x=1 x=1
+		/usr/bin 'quoted text' | "$@" 2>/dev/null x=1 x=1 'quoted text' 2>/dev/null
+cd && printf /usr/bin printf awk printf /usr/bin sed test /usr/bin -eu
+awk then ${HOME} cd printf "$1" local 2>/dev/null
+		sed -eu /usr/bin echo /usr/bin local ${HOME} grep cd test test
+grep --verbose /usr/bin | then then export | test echo
+export done done done
+then ${HOME} readonly test cd "$1" /usr/bin
+readonly grep echo awk 2>/dev/null grep cd local local "$@" 'quoted text' local
+		cd "$1" "$@" /usr/bin sed 'quoted text'
+	$(pwd) /usr/bin echo done printf echo done /usr/bin ${HOME} /usr/bin awk
+then cd && /usr/bin awk cd x=1 x=1
+		awk x=1 'quoted text' echo 2>/dev/null readonly then grep
+	x=1 readonly x=1 then readonly 'quoted text'
+		$(pwd) grep local && $(pwd) --verbose && 2>/dev/null
+		printf x=1 "$@" 2>/dev/null awk readonly awk then test cd $(pwd) $(pwd) local
+/usr/bin printf --verbose done cd "$@"
+		-eu "$1" echo test done export
+		printf ${HOME} local export grep /usr/bin
+	then test echo $(pwd) then
+	&& sed 'quoted text' readonly | -eu printf local ${HOME} sed echo export
+	local sed cd cd | /usr/bin done readonly cd /usr/bin 'quoted text'
+	done x=1 cd test cd $(pwd) 'quoted text'
+	echo /usr/bin awk cd 2>/dev/null
+		then awk | cd done -eu then sed echo readonly
+x=1 readonly $(pwd) /usr/bin "$1" "$@" test "$@" 2>/dev/null
+	x=1 echo 'quoted text'
+local 'quoted text' -eu echo
+		--verbose test $(pwd) ${HOME} "$@" test | /usr/bin test -eu |
+		&& ${HOME} && done "$1" /usr/bin then awk export readonly
+'quoted text' awk echo local sed awk grep && local
+		"$1" echo then awk test ${HOME} local --verbose 2>/dev/null && "$1" awk awk
+-eu done ${HOME} awk test 'quoted text' echo "$1" then $(pwd) "$@" && test "$@"
+2>/dev/null local readonly sed test cd readonly --verbose
+printf sed readonly "$1" | 2>/dev/null awk grep grep local local $(pwd) readonly
+		x=1 $(pwd) done /usr/bin ${HOME}
+local awk grep -eu $(pwd) 'quoted text' done local echo local 2>/dev/null
+		"$@" test readonly test /usr/bin /usr/bin
+		awk sed | 'quoted text' echo readonly echo readonly 'quoted text' then
+2>/dev/null 2>/dev/null done
+sed then printf ${HOME} /usr/bin done
+cd export awk -eu printf 2>/dev/null --verbose 'quoted text' /usr/bin && && export
+	'quoted text' echo -eu -eu echo
+${HOME} --verbose 'quoted text' "$1" && done
+	export cd ${HOME} /usr/bin awk x=1 x=1 echo "$1" && && export printf echo && echo
+		/usr/bin x=1 ${HOME} "$@" export x=1 "$@"
+		"$1" readonly /usr/bin | "$@" done 'quoted text' && printf $(pwd) local "$1"
+	$(pwd) echo -eu x=1 grep done then ${HOME} done -eu printf
+		grep 'quoted text' "$1" && ${HOME} 'quoted text' export
+	sed && then ${HOME} awk "$1" 'quoted text' local | test awk test "$1"
+	done local grep "$@" $(pwd) sed then echo "$1"
+		grep && | 2>/dev/null local export cd "$1" 2>/dev/null
+		| grep $(pwd) sed export
+		"$@" echo && ${HOME} grep | printf echo
+	2>/dev/null && "$1" readonly export sed $(pwd) /usr/bin cd $(pwd) done --verbose
+		'quoted text' 2>/dev/null done --verbose "$@" -eu export readonly x=1 -eu
+"$1" export cd test "$@" ${HOME} "$1" readonly ${HOME} awk grep
+	test /usr/bin | ${HOME} 2>/dev/null
+		readonly -eu done done x=1
+--verbose /usr/bin then "$@" done x=1 export x=1 'quoted text' && /usr/bin
+	sed then export | export && && ${HOME} 'quoted text' done readonly awk ${HOME}
+readonly ${HOME} awk ${HOME} test readonly x=1 -eu readonly awk awk readonly
+	| grep sed test "$1" sed 2>/dev/null sed echo awk done 'quoted text'
+		--verbose 2>/dev/null ${HOME} ${HOME} test then 2>/dev/null
+	"$@" /usr/bin && sed cd $(pwd) then 2>/dev/null 'quoted text'
+	x=1 $(pwd) | sed -eu sed printf
+sed cd x=1 awk test --verbose echo cd printf /usr/bin then
+-eu sed "$1" /usr/bin --verbose
+then 2>/dev/null printf --verbose $(pwd)
+2>/dev/null 2>/dev/null awk 'quoted text' && ${HOME} 'quoted text'
+then done "$@" then /usr/bin 'quoted text' 'quoted text' "$@"
+		${HOME} printf 'quoted text' -eu awk cd sed $(pwd)
+cd sed "$1" 2>/dev/null "$1" x=1 sed done "$1" 'quoted text'
+	$(pwd) local done local "$@" /usr/bin 'quoted text'
+'quoted text' "$1" sed printf local
+-eu printf echo done | readonly export && sed export local readonly
+		local -eu readonly done test |
+		--verbose grep -eu 2>/dev/null
+local test awk ${HOME} export
+	$(pwd) local export 2>/dev/null done grep cd sed 'quoted text' readonly grep
+		grep "$@" | export grep
+test ${HOME} 2>/dev/null --verbose "$@"
+		done sed export x=1 "$1" local printf ${HOME} printf
+	echo sed && x=1 -eu 'quoted text'
+readonly readonly printf ${HOME} cd readonly
+	readonly awk | && test sed export "$1" test then export && awk | sed && export
+		awk | test readonly done grep
+	'quoted text' grep readonly "$@" done /usr/bin
+		"$@" echo awk done 'quoted text' echo then -eu grep test
+sed | --verbose cd && export echo readonly
+export /usr/bin -eu "$@" | "$1" local awk 2>/dev/null
+"$@" printf readonly --verbose done "$1" ${HOME} printf awk && -eu test /usr/bin
+awk test && export readonly | | /usr/bin -eu local
+	&& local | --verbose readonly cd readonly && ${HOME} local 2>/dev/null
+	| --verbose printf sed ${HOME} 'quoted text' done "$1" printf --verbose
+	readonly 2>/dev/null local export printf grep
+		sed 2>/dev/null $(pwd) 2>/dev/null $(pwd) /usr/bin "$@" --verbose
+	| /usr/bin sed "$1" printf 2>/dev/null grep x=1 then awk cd cd "$@" && --verbose
+	export grep $(pwd) $(pwd) echo $(pwd)
+		&& ${HOME} then -eu export
+		&& test --verbose $(pwd) | done "$@" "$1" && x=1 printf grep "$@" 2>/dev/null
+sed x=1 readonly /usr/bin local grep cd readonly 2>/dev/null
+'quoted text' echo grep | "$@" $(pwd) local
+		printf 2>/dev/null done | local
+cd 2>/dev/null done echo
+	printf echo $(pwd) 'quoted text' local test
+test sed printf done "$1" "$@" /usr/bin
+grep /usr/bin /usr/bin sed export /usr/bin export awk
+		readonly | | "$1" $(pwd) awk awk && 2>/dev/null cd | echo -eu grep awk "$1"
+		"$@" awk then $(pwd) sed && -eu test
+		2>/dev/null /usr/bin "$@" && --verbose
+local cd export | && readonly cd local test 'quoted text' printf sed && then
+	local | && "$@" printf x=1 -eu
+--verbose sed readonly "$1" done -eu done x=1
+		then 2>/dev/null && 'quoted text' done
+${HOME} readonly readonly /usr/bin && sed ${HOME}
+'quoted text' x=1 ${HOME}
+	test cd 2>/dev/null /usr/bin ${HOME} readonly $(pwd) readonly "$1" export echo
+		awk x=1 /usr/bin --verbose printf local done x=1 ${HOME}
+		echo done printf "$@" local
+		| printf printf /usr/bin x=1 x=1 local
+	printf export $(pwd) then readonly 2>/dev/null local
+		local | readonly -eu 'quoted text' $(pwd) printf "$@" -eu && cd printf
+	printf cd && cd x=1 sed local readonly awk x=1 $(pwd)
+		awk grep grep test $(pwd)
+		sed printf ${HOME} 'quoted text'
+awk 'quoted text' printf -eu 'quoted text' then 'quoted text'
+	"$@" grep 'quoted text' sed cd test
+	local test x=1 /usr/bin | export sed "$@" done ${HOME}
+		local grep 'quoted text' 2>/dev/null
+		"$@" sed "$@" && local echo
+	${HOME} sed 'quoted text' | export ${HOME} printf then
+		readonly "$1" grep x=1 -eu "$@" $(pwd)
+'quoted text' -eu /usr/bin 'quoted text' "$@" awk "$@" readonly
+	awk local --verbose cd x=1 then $(pwd) done
+		${HOME} "$@" done cd | test echo $(pwd) 2>/dev/null awk --verbose | 2>/dev/null
+		$(pwd) ${HOME} cd echo $(pwd) cd "$1"
+		--verbose "$1" then x=1 -eu readonly
+		then ${HOME} then ${HOME} x=1 2>/dev/null cd --verbose /usr/bin $(pwd)
+then readonly grep local --verbose grep /usr/bin awk
+		'quoted text' $(pwd) then sed $(pwd) $(pwd) --verbose export |
+		awk 2>/dev/null ${HOME}
+then 2>/dev/null -eu x=1 x=1 test grep sed
+$(pwd) local --verbose 'quoted text' done $(pwd) x=1 export | "$@"
+	local local -eu "$@" done readonly -eu sed sed readonly done /usr/bin readonly
+		test test grep --verbose
+	then done cd done test | local 'quoted text' done
+		grep "$1" /usr/bin awk done 2>/dev/null sed export then ${HOME} $(pwd)
+	-eu echo done readonly awk && "$1" --verbose
+	&& local x=1 $(pwd) $(pwd) printf "$@" done
+	awk done export sed 'quoted text' grep test "$1" $(pwd) && "$@"
+grep --verbose --verbose grep $(pwd) local | cd then "$@" 2>/dev/null | test
+	'quoted text' --verbose local $(pwd) "$1" export 2>/dev/null | x=1
+echo cd sed export grep grep grep printf 'quoted text' local && ${HOME} sed awk
+		&& --verbose "$1" "$1" printf "$1" | ${HOME} printf && 2>/dev/null
+		$(pwd) | printf "$@" sed cd --verbose printf 'quoted text'
+	readonly $(pwd) done --verbose "$1" -eu printf | x=1 2>/dev/null
+&& /usr/bin 'quoted text' local
+		printf readonly $(pwd) test test then --verbose grep local
+		export $(pwd) && /usr/bin "$@" done && | echo --verbose echo $(pwd)
+	&& --verbose then then export
+	local /usr/bin --verbose test export export export printf --verbose /usr/bin printf
+		test test grep then 2>/dev/null then done then awk 'quoted text' export ${HOME}
+	local 'quoted text' awk ${HOME} sed printf grep
+'quoted text' export grep
+		x=1 local $(pwd) done local 'quoted text'
+-eu readonly grep /usr/bin echo
+		test local /usr/bin 'quoted text' then sed printf export echo "$1" 2>/dev/null
+	--verbose grep awk 2>/dev/null echo local /usr/bin cd x=1 echo 'quoted text' local
+	then --verbose readonly --verbose printf "$1" readonly done then done
+	| && 'quoted text' 'quoted text' done /usr/bin awk "$1" /usr/bin readonly
+		"$1" sed printf 'quoted text' "$@" then $(pwd) 'quoted text' done
+--verbose echo readonly
+		local test sed -eu && awk
+"$@" export 2>/dev/null readonly export && done /usr/bin printf readonly
+		$(pwd) awk awk | ${HOME} done | done |
+	printf printf cd "$1" cd --verbose /usr/bin x=1 x=1 printf
+	local done | echo 'quoted text' printf && grep test 'quoted text'
+	export --verbose cd -eu /usr/bin sed test --verbose --verbose grep done "$1"
+	awk local test -eu "$1" 'quoted text'
+awk readonly $(pwd) echo export
+sed done printf export && ${HOME} test grep ${HOME} "$1" printf
+	'quoted text' /usr/bin echo 'quoted text' 2>/dev/null then $(pwd) test 2>/dev/null
+readonly ${HOME} && test local /usr/bin test -eu
+/usr/bin cd 2>/dev/null 'quoted text' export grep readonly $(pwd) test && awk
+		cd && then local /usr/bin
+	--verbose cd /usr/bin
+	| 2>/dev/null 'quoted text' done local x=1 2>/dev/null
+	| done awk "$@" 'quoted text' cd x=1 echo -eu 'quoted text' --verbose
+		&& $(pwd) sed "$1" printf 'quoted text' 'quoted text' 2>/dev/null
+/usr/bin --verbose "$@" cd sed --verbose done ${HOME}
+	awk 2>/dev/null local --verbose then local then $(pwd) x=1 x=1 printf done local
+grep test -eu -eu && x=1 x=1 'quoted text' --verbose then --verbose
+	echo local $(pwd) awk awk export 'quoted text' x=1 sed
+	| then -eu cd test cd ${HOME} --verbose "$@" /usr/bin
+$(pwd) readonly then x=1 printf --verbose 'quoted text' /usr/bin awk 'quoted text'
+		&& awk done cd && x=1 "$@" ${HOME} sed
+echo && $(pwd) local -eu /usr/bin
+	-eu then test && readonly grep test printf && -eu x=1 ${HOME} --verbose /usr/bin
+	cd echo 'quoted text' $(pwd) -eu | awk |
+	"$1" printf ${HOME} /usr/bin | "$1" grep --verbose
+	then export 'quoted text' -eu grep 2>/dev/null export grep test $(pwd)
+	grep --verbose $(pwd) -eu export -eu | && test "$@" echo done
+&& export echo /usr/bin "$@"
+then | "$@" readonly --verbose
+readonly awk then $(pwd) sed sed then
+/usr/bin x=1 grep grep /usr/bin x=1 readonly 2>/dev/null
+		awk ${HOME} /usr/bin x=1 then --verbose
+/usr/bin -eu 'quoted text' readonly
+local local local local printf 2>/dev/null && printf
+--verbose done -eu echo
+		local cd 2>/dev/null 'quoted text'
+"$@" 2>/dev/null grep 'quoted text' echo cd /usr/bin
+		2>/dev/null test printf then ${HOME} local
+"$@" export --verbose --verbose 'quoted text'
+	'quoted text' --verbose
+	sed awk 'quoted text' && sed export --verbose
+		2>/dev/null && --verbose cd "$@" x=1 then test readonly export printf test
+sed test "$1" 2>/dev/null then done 2>/dev/null &&
+		local readonly "$1" && readonly awk awk
+	2>/dev/null ${HOME} $(pwd) done ${HOME} local "$1" "$@"
+export ${HOME} test echo echo --verbose awk
+		export ${HOME} "$1" then test 'quoted text'
+	2>/dev/null sed cd grep grep echo test 2>/dev/null
+	"$@" local then "$1" && export then readonly | export done ${HOME} export
+	-eu readonly done then $(pwd) printf echo "$@" $(pwd) "$1" 'quoted text'
+export "$1" | cd /usr/bin sed |
+		"$@" readonly sed printf "$@" test /usr/bin test
+		cd done "$1" -eu test echo
+		/usr/bin && done 'quoted text' -eu test x=1 $(pwd) done x=1 "$1" grep --verbose
+test then done && grep printf 'quoted text' readonly cd 2>/dev/null
+		$(pwd) test -eu done -eu &&
+	then "$1" ${HOME} echo 'quoted text' echo x=1 "$1" | grep readonly /usr/bin
+		awk /usr/bin grep export $(pwd) "$@" ${HOME}
+/usr/bin local 'quoted text' "$1" test 2>/dev/null
+--verbose | export readonly done ${HOME} test export -eu -eu done
+sed $(pwd) readonly --verbose
+	readonly echo printf
+	sed printf | cd ${HOME} then "$@" export -eu then 2>/dev/null --verbose
+		"$@" ${HOME} export -eu cd "$1" echo echo -eu awk awk --verbose
+-eu awk local 'quoted text' "$@" $(pwd) echo done "$1" | 2>/dev/null
+	'quoted text' | cd ${HOME} local "$1" x=1 export 2>/dev/null
+		${HOME} ${HOME} test done "$@" && then cd done ${HOME}
+		sed ${HOME} /usr/bin /usr/bin -eu $(pwd) awk
+		awk $(pwd) -eu 2>/dev/null cd cd export ${HOME} sed then done
+		cd export ${HOME} readonly then $(pwd) "$1" then ${HOME} x=1 "$@"
+	readonly | && grep 'quoted text' readonly 'quoted text'
+		grep cd --verbose readonly --verbose readonly cd | --verbose done
+readonly 'quoted text' 2>/dev/null 'quoted text' cd local local -eu then cd "$1"
+		"$1" --verbose && 'quoted text' export local done echo -eu
+	sed $(pwd) echo "$@" 2>/dev/null
+		/usr/bin 'quoted text' --verbose --verbose done | grep | "$1" | test "$1" /usr/bin
+	| ${HOME} test -eu $(pwd) export x=1 then awk 'quoted text'
+	test sed readonly grep "$@"
+-eu then && && local -eu grep readonly
+		test "$@" awk "$@" && x=1 /usr/bin 'quoted text'
+then printf readonly test grep && 'quoted text'
+	| test /usr/bin x=1 x=1 printf 'quoted text'
+		cd -eu printf then $(pwd) readonly x=1
+		/usr/bin cd x=1 2>/dev/null awk readonly x=1
+	done awk 2>/dev/null -eu local done export awk x=1
+"$1" /usr/bin local grep $(pwd) done awk test local |
+test awk | 2>/dev/null readonly export test export local cd done x=1
+grep readonly /usr/bin
+		"$1" then && cd cd readonly grep $(pwd) | 'quoted text' awk
+	$(pwd) echo done 2>/dev/null --verbose sed grep test
+echo awk local /usr/bin sed done "$@" x=1 then
+		then $(pwd) 2>/dev/null cd then /usr/bin
+-eu | echo "$@" "$@" readonly
+	test ${HOME} 2>/dev/null && test "$1" local
+local /usr/bin -eu done ${HOME}
+	"$1" 2>/dev/null echo $(pwd) ${HOME} /usr/bin readonly done readonly awk 2>/dev/null
+	&& echo grep local "$1" 2>/dev/null ${HOME}
+&& "$@" ${HOME} ${HOME} x=1 then done export
+test ${HOME} && | && "$1" -eu local /usr/bin "$@" test ${HOME}
+		local "$@" | 2>/dev/null awk echo
+	| -eu && printf export /usr/bin printf
+	2>/dev/null /usr/bin grep /usr/bin printf --verbose echo ${HOME} x=1 cd export
+/usr/bin export ${HOME} sed -eu awk local
+		"$@" printf $(pwd) then export -eu printf done "$@" ${HOME} -eu ${HOME}
+		readonly "$1" "$1" 'quoted text'
+/usr/bin -eu export export ${HOME} cd "$1" local then
+		sed "$1" awk printf done &&
+	-eu done grep then $(pwd) awk export cd sed 2>/dev/null 2>/dev/null
+sed | 'quoted text' sed -eu grep 2>/dev/null echo local readonly readonly
+		sed ${HOME} grep awk export | grep local readonly sed sed 2>/dev/null export
+		readonly | local "$@" x=1 'quoted text'
+	"$1" /usr/bin local cd echo grep
+	done --verbose $(pwd) x=1 2>/dev/null export grep 'quoted text' readonly awk sed
+	printf $(pwd) then x=1 then then
+		| awk awk export local local printf sed 'quoted text'
+		| grep | -eu 2>/dev/null ${HOME} /usr/bin readonly cd
+		export -eu sed 'quoted text' -eu && 'quoted text' /usr/bin test
+grep cd 'quoted text' cd "$@"
+	printf && echo awk 2>/dev/null awk export grep
+	x=1 printf export | ${HOME} printf sed ${HOME} echo printf readonly export
+/usr/bin echo 2>/dev/null
+	test -eu ${HOME} then done echo /usr/bin cd $(pwd) -eu done test
+	printf test sed "$@" local printf
+	--verbose | && then cd 'quoted text'
+/usr/bin ${HOME} test -eu && test | -eu -eu --verbose grep awk $(pwd) export --verbose
+	local 'quoted text' 'quoted text'
+		/usr/bin grep "$@" local
+| x=1 2>/dev/null && | "$1"
+		echo ${HOME} x=1 echo
+		awk awk -eu x=1 test ${HOME} "$1" done | ${HOME}
+	/usr/bin $(pwd) cd x=1 'quoted text' local test sed readonly 'quoted text'
+&& 2>/dev/null --verbose && 2>/dev/null && echo ${HOME}
+'quoted text' "$@" -eu --verbose --verbose "$@" "$1" "$1" --verbose
+		$(pwd) awk $(pwd) readonly printf awk printf
+	--verbose echo /usr/bin ${HOME} -eu $(pwd) then printf "$@" local
+$(pwd) done $(pwd) awk echo
+echo 2>/dev/null 'quoted text' export local cd readonly readonly
+readonly local x=1 awk printf echo then | test "$1" grep
+		test 2>/dev/null awk $(pwd) 'quoted text' export test export
+	"$@" 2>/dev/null grep echo done | --verbose test printf 'quoted text'
+		readonly sed then && test export
+		echo cd grep sed printf test sed 2>/dev/null sed x=1 local then echo -eu export
+		$(pwd) 2>/dev/null 2>/dev/null $(pwd) readonly export
+	echo then printf ${HOME} export x=1 --verbose
+		awk done ${HOME} printf cd ${HOME} 'quoted text' 2>/dev/null done done
+	test "$1" done "$@" /usr/bin "$1" && then
+		test printf "$@" $(pwd) sed sed then -eu grep test awk x=1 export grep
+done printf | sed x=1 cd grep done
+"$@" 2>/dev/null cd sed done awk done grep readonly sed local
+/usr/bin then /usr/bin $(pwd) 'quoted text' local then done sed --verbose
+	&& local printf done /usr/bin "$1" done /usr/bin && 'quoted text' && 'quoted text'
+	/usr/bin --verbose done -eu local then x=1 'quoted text' && /usr/bin ${HOME}
+then grep -eu "$1" readonly /usr/bin | test
+	| "$1" echo printf "$1" -eu done && 2>/dev/null "$1" |
+	'quoted text' cd "$1" printf && | awk readonly
+--verbose $(pwd) sed printf grep --verbose -eu cd /usr/bin cd printf $(pwd)
+	printf -eu ${HOME} awk | cd && export echo test -eu cd x=1 readonly
+		'quoted text' grep "$1" printf printf
+"$1" printf "$@" "$@" "$@" grep
+		echo local sed $(pwd) done echo printf --verbose
+	local /usr/bin readonly local
+	export x=1 test test ${HOME} local grep grep 'quoted text' cd sed
+	"$1" ${HOME} 'quoted text' $(pwd) test
+	test /usr/bin sed awk x=1 /usr/bin printf --verbose awk then done && done --verbose
+${HOME} x=1 awk then | 'quoted text'
+	local grep "$@" /usr/bin 'quoted text' x=1 $(pwd) && 2>/dev/null
+done echo sed readonly | x=1 /usr/bin | readonly /usr/bin
+		2>/dev/null printf --verbose x=1 test ${HOME} && export sed x=1 && x=1
+		sed && cd /usr/bin then export grep -eu | /usr/bin "$@" export done
+		x=1 cd done then local -eu then sed 2>/dev/null ${HOME} test 2>/dev/null
+		then "$@" readonly sed readonly "$1" local awk test printf done
+	| echo 2>/dev/null && x=1 local echo readonly $(pwd)
+cd $(pwd) "$@" printf then printf $(pwd)
+cd printf grep grep /usr/bin awk 2>/dev/null then echo
+		2>/dev/null printf 'quoted text' | echo
+&& 'quoted text' -eu readonly export awk done local -eu ${HOME} then &&
+		test 'quoted text' test then export awk then echo done local printf "$1"
+	"$@" && echo ${HOME} 'quoted text' "$1" "$@" test x=1 ${HOME}
+	| printf -eu local test "$@" ${HOME} echo /usr/bin
+	export && grep echo cd "$@" grep printf printf echo then x=1 done
+export cd then cd cd "$1" $(pwd) local
+		"$1" awk && then export test then readonly then && grep local
+	'quoted text' printf grep 'quoted text'
+	readonly done cd && done && done 'quoted text' cd && --verbose sed
+		done grep x=1 'quoted text' 'quoted text' /usr/bin | && grep echo sed
+		readonly "$@" | "$@" | sed "$1"
+	"$1" readonly then $(pwd) 2>/dev/null
+"$@" sed done && $(pwd) then printf 'quoted text' done | && local
+test sed sed -eu local ${HOME} /usr/bin printf grep done
+done local awk && "$@" export -eu
+"$1" then $(pwd) sed local --verbose
+	then $(pwd) && x=1 x=1 awk test done test test $(pwd) $(pwd) -eu local then test
+	export cd "$@" printf $(pwd) x=1 test -eu "$@" $(pwd) 2>/dev/null
+then awk $(pwd) && grep test "$@" x=1 -eu local sed awk x=1 printf
+sed readonly cd $(pwd) ${HOME}
+"$1" then cd printf test
+		-eu local 2>/dev/null 'quoted text' echo 'quoted text'
+		"$1" printf sed $(pwd) cd | --verbose --verbose "$@" x=1 && done echo then |
+sed ${HOME} --verbose --verbose readonly "$@" "$1"
+	printf awk /usr/bin && awk sed export echo readonly
+		done --verbose /usr/bin grep cd /usr/bin "$@"
+	${HOME} test then printf grep 2>/dev/null "$@"
+	then cd grep $(pwd) x=1 | $(pwd) echo "$@" 'quoted text' cd cd test
+		readonly test test "$1" --verbose
+sed "$@" "$@" awk local readonly printf ${HOME} local x=1
+	2>/dev/null then x=1 'quoted text' 'quoted text' | cd x=1 && --verbose
+$(pwd) 2>/dev/null && /usr/bin ${HOME} --verbose test "$@" x=1 'quoted text'
+	${HOME} | sed 2>/dev/null then readonly
+	then --verbose /usr/bin | /usr/bin | test
+	$(pwd) export awk x=1 test then done $(pwd)
+	x=1 | cd export awk grep awk "$1" export readonly
+export | printf grep echo test 'quoted text' && sed x=1 2>/dev/null grep
+	test readonly awk grep $(pwd) grep $(pwd) "$@"
+	--verbose ${HOME} test 'quoted text' then done &&
+	printf x=1 done local ${HOME} printf ${HOME} local x=1 --verbose ${HOME}
+&& 'quoted text' /usr/bin | | | "$1"
+	local test readonly readonly test 'quoted text' done done x=1 -eu | 'quoted text'
+	grep ${HOME} -eu ${HOME} && -eu && $(pwd)
+	&& | readonly done -eu cd --verbose export echo /usr/bin && export local ${HOME}
+	${HOME} readonly /usr/bin cd x=1 && x=1 then sed done "$1" /usr/bin
+		$(pwd) /usr/bin "$@" grep "$1" $(pwd) awk /usr/bin echo 2>/dev/null x=1 grep export
+		local && grep done grep
+done cd 2>/dev/null sed ${HOME} echo printf then && local grep --verbose echo
+	"$@" sed then ${HOME} /usr/bin sed readonly "$1" grep test
+		test && test && --verbose 'quoted text'
+	x=1 'quoted text' "$1" cd then grep awk done 'quoted text' export
+	'quoted text' -eu "$1" then cd x=1 ${HOME} "$1"
+	-eu readonly sed "$@"
+2>/dev/null x=1 | "$@" printf "$1" awk grep 'quoted text' sed echo "$@"
+	readonly x=1 cd then 'quoted text' /usr/bin $(pwd) 2>/dev/null
+"$1" echo grep "$1" cd awk
+${HOME} printf /usr/bin then
+	${HOME} /usr/bin printf 2>/dev/null $(pwd) then --verbose 'quoted text'
+	x=1 readonly echo "$@" echo local -eu "$1" cd "$@" -eu ${HOME}
+		"$1" test /usr/bin x=1 readonly
+		local 2>/dev/null && 'quoted text'
+"$1" local then && awk cd $(pwd) echo | 2>/dev/null x=1 then done --verbose cd then
+		cd readonly $(pwd) grep && $(pwd) sed "$1" | $(pwd) 'quoted text'
+${HOME} && test export | "$1" 2>/dev/null /usr/bin printf /usr/bin
+local cd cd then sed done grep grep awk echo readonly echo
+printf grep x=1 cd grep readonly --verbose --verbose grep | then test
+cd ${HOME} echo cd x=1 export 2>/dev/null export grep then && $(pwd)
+--verbose export /usr/bin readonly local | then /usr/bin printf cd export
+		"$1" $(pwd) 'quoted text' grep --verbose test && 2>/dev/null
+	$(pwd) ${HOME} then 2>/dev/null cd done $(pwd) readonly $(pwd) awk then 'quoted text'
+	"$@" local test test test 2>/dev/null 'quoted text' ${HOME} local
+		cd 'quoted text' sed x=1 | grep && x=1 done
+		"$@" printf --verbose 2>/dev/null local sed readonly
+'quoted text' 'quoted text' 2>/dev/null -eu local /usr/bin
+	/usr/bin "$@" -eu | 'quoted text' | && cd awk
+| ${HOME} 'quoted text' export
+		printf /usr/bin export /usr/bin ${HOME} export grep "$1"
+awk $(pwd) -eu /usr/bin 2>/dev/null /usr/bin $(pwd) then printf &&
+		grep test /usr/bin x=1 test test x=1 local "$@" done
+		then printf done local grep local sed awk "$1" | "$1" printf echo $(pwd) awk
+	cd grep 2>/dev/null | --verbose readonly local grep then --verbose
+cd "$1" --verbose 'quoted text' "$@" "$1" x=1 local export
+	/usr/bin sed sed then --verbose | --verbose
+		sed test ${HOME} "$@" echo grep
+grep x=1 | 'quoted text' awk grep "$1" awk x=1 sed
+		then 'quoted text' --verbose awk cd /usr/bin echo -eu
+		-eu readonly sed $(pwd) 2>/dev/null -eu sed then -eu --verbose
+		$(pwd) done echo --verbose && done sed -eu
+		${HOME} ${HOME} 'quoted text' then cd cd --verbose awk printf
+	"$@" awk test --verbose "$@"
+		done --verbose "$@" | done grep echo then
+then test grep x=1 x=1 /usr/bin | | "$1" export test /usr/bin
+	/usr/bin $(pwd) "$1" x=1 printf grep local --verbose "$@" -eu grep done 'quoted text'
+		cd cd test && | "$@" readonly grep test && then local done
+-eu -eu cd | test cd && 'quoted text' test x=1 $(pwd) printf x=1 then && $(pwd)
+		then -eu grep then | printf $(pwd) x=1 "$@" "$1" sed cd local
+		"$@" export cd cd "$1" export ${HOME} ${HOME} /usr/bin readonly 2>/dev/null
+x=1 test "$@" --verbose grep local && $(pwd) done $(pwd) awk
+cd then "$1" 2>/dev/null printf then ${HOME} 'quoted text'
+		grep export export printf cd 2>/dev/null 'quoted text'
+done --verbose done $(pwd) cd 2>/dev/null "$1" --verbose
+		2>/dev/null export --verbose /usr/bin printf grep && done 'quoted text' $(pwd)
+local /usr/bin echo export 'quoted text'
+cd export "$1" && export cd "$@" printf echo x=1 'quoted text'
+	$(pwd) grep then readonly then -eu ${HOME} printf "$@" printf --verbose sed
+	-eu grep sed printf ${HOME}
+		printf grep grep cd grep readonly 2>/dev/null done 2>/dev/null printf && sed
+	cd awk "$1" && cd then done ${HOME}
+x=1 && then test "$1" && --verbose awk 'quoted text' /usr/bin
+		export 'quoted text' echo /usr/bin "$@" && grep export x=1
+	$(pwd) grep sed cd readonly cd test export export
+		readonly cd echo | export 'quoted text' x=1 printf local cd awk "$@" ${HOME} x=1
+readonly | sed printf && $(pwd) printf
+	test x=1 'quoted text' $(pwd) 'quoted text'
+	printf -eu /usr/bin x=1 $(pwd) readonly
+2>/dev/null "$1" ${HOME} "$1" | sed /usr/bin
+		local awk export "$@" /usr/bin cd "$1" "$@" "$@" export grep --verbose
+${HOME} sed $(pwd) printf "$@" "$1" sed cd grep local "$@" --verbose
+		done ${HOME} awk | ${HOME} done 'quoted text'
+awk "$@" done "$1" export local export echo echo export printf ${HOME} echo done
+		'quoted text' test sed awk -eu ${HOME}
+awk test /usr/bin "$1" printf "$@" local grep ${HOME}
+x=1 export export export && export printf "$1"
+	then sed ${HOME} "$@" --verbose ${HOME} "$1" cd grep
+		cd --verbose readonly test -eu | 2>/dev/null "$@" grep --verbose echo export 'quoted text'
+	then local 'quoted text'
+	sed | 'quoted text' export "$@" echo then grep awk local && 2>/dev/null
+	grep done "$@" "$1" 2>/dev/null
+	${HOME} x=1 local && sed
+-eu $(pwd) cd echo "$1" 'quoted text'
+		readonly "$1" /usr/bin $(pwd) -eu "$1" "$@" "$@"
+	grep $(pwd) cd /usr/bin readonly x=1 x=1 "$1" $(pwd)
+		done cd cd ${HOME} $(pwd) awk readonly
+		| --verbose $(pwd) -eu sed grep sed test ${HOME} "$@" && 'quoted text'
+		cd 2>/dev/null awk && $(pwd) | | /usr/bin awk "$@" cd export -eu
+		done local | && | | readonly
+cd local /usr/bin readonly $(pwd) "$@" ${HOME} | test done
+	local then readonly /usr/bin x=1 $(pwd) && printf
+echo then 2>/dev/null readonly --verbose 2>/dev/null 2>/dev/null |
+grep && $(pwd) 'quoted text' $(pwd)
+${HOME} printf then export --verbose sed done 2>/dev/null
+	local | --verbose --verbose export readonly -eu 2>/dev/null
+		sed ${HOME} export --verbose
+"$@" local done "$@" -eu x=1 readonly cd then ${HOME} then
+test "$@" ${HOME} "$1" && $(pwd)
+		--verbose ${HOME} done readonly $(pwd) grep x=1 test /usr/bin grep readonly
+test x=1 "$1" -eu 2>/dev/null
+		printf $(pwd) echo --verbose sed readonly readonly
+	local -eu x=1 $(pwd) -eu 2>/dev/null sed local && "$@" echo readonly
+grep "$@" sed echo echo export export 'quoted text' grep sed | cd
+		readonly printf | local readonly 'quoted text' done grep 'quoted text'
+		export echo cd test -eu test local | readonly
+		2>/dev/null cd cd -eu -eu --verbose printf
+	printf grep $(pwd) done && | --verbose x=1 cd readonly awk "$1" -eu
+		grep local | readonly /usr/bin "$1" --verbose 2>/dev/null sed local awk test local
@@ -0,0 +1,2001 @@
+	then done 2>/dev/null 'quoted text' test && cd awk "$1" ${HOME} ${HOME}
+	&& readonly $(pwd) sed grep echo
+--verbose local $(pwd) readonly then echo
+readonly -eu sed echo grep then x=1 export /usr/bin $(pwd) readonly
+sed && grep awk readonly
+x=1 echo awk sed --verbose printf | test grep "$1" awk echo readonly
+		--verbose printf "$@" --verbose export local test then
+	/usr/bin --verbose then ${HOME}
+	| && -eu grep | test -eu local readonly | | export awk
+	'quoted text' 'quoted text' "$1" | then "$1" printf
+		done test printf ${HOME} | readonly cd 2>/dev/null 'quoted text'
+grep done export 2>/dev/null $(pwd) && export "$@" done awk
+		export ${HOME} then export --verbose
+		grep $(pwd) readonly readonly cd "$1" /usr/bin 'quoted text'
+		cd then awk cd 2>/dev/null awk
+export "$@" --verbose x=1
+	&& "$@" sed grep "$@" cd ${HOME} -eu -eu done grep
+	printf then -eu awk | local readonly readonly done test "$@" "$@" $(pwd)
+		echo x=1 sed awk ${HOME}
+		grep export --verbose --verbose 2>/dev/null readonly
+	readonly readonly 2>/dev/null grep export then local
+		done echo && then "$1" --verbose
+	2>/dev/null 2>/dev/null local export x=1 --verbose
+sed done /usr/bin echo 'quoted text' ${HOME}
+'quoted text' 2>/dev/null awk 2>/dev/null
+	| grep grep "$@" x=1 $(pwd)
+	export && $(pwd) && export 2>/dev/null grep /usr/bin then grep "$@" x=1 awk /usr/bin
+	2>/dev/null local printf
+		--verbose --verbose test x=1 ${HOME} cd 'quoted text'
+--verbose && ${HOME} done ${HOME} sed
+		--verbose echo local grep
+	readonly grep ${HOME} -eu readonly
+2>/dev/null echo cd x=1 && $(pwd) 'quoted text'
+cd test done x=1 | && cd export test /usr/bin && done
+	2>/dev/null && -eu then && readonly
+		--verbose /usr/bin "$1" --verbose x=1 2>/dev/null
+	local test 2>/dev/null then awk done sed done --verbose cd 'quoted text'
+		2>/dev/null then --verbose 'quoted text' x=1 then | awk then "$@" printf
+		sed sed awk test 2>/dev/null "$1"
+		printf readonly readonly cd && x=1 | "$1" then
+		${HOME} local echo awk --verbose ${HOME} export 2>/dev/null local
+		export --verbose "$@" 2>/dev/null && local then awk --verbose &&
+		-eu sed -eu cd export /usr/bin && local test sed echo | 'quoted text' echo --verbose
+	'quoted text' "$@" test
+		awk grep --verbose test printf grep sed $(pwd) echo
+readonly -eu /usr/bin echo
+		cd export x=1 "$1" 'quoted text'
+	'quoted text' /usr/bin
+	&& 2>/dev/null 2>/dev/null awk $(pwd) "$@" ${HOME}
+	${HOME} /usr/bin -eu -eu $(pwd) echo 'quoted text'
+"$1" /usr/bin awk awk | | done readonly
+cd cd printf "$1" /usr/bin awk done printf x=1 --verbose
+	-eu "$1" 'quoted text' readonly grep export "$1" --verbose --verbose
+	"$1" export $(pwd) cd awk printf
+	"$@" done awk $(pwd) then $(pwd) -eu then /usr/bin x=1 --verbose
+grep --verbose local ${HOME}
+		cd && | readonly && "$1" --verbose done -eu /usr/bin &&
+		-eu then "$@" "$1" echo then && -eu export test | test ${HOME} then && then
+		| --verbose $(pwd) -eu local
+2>/dev/null /usr/bin -eu $(pwd) cd readonly cd | -eu $(pwd) "$@" "$@" printf
+	readonly then grep 2>/dev/null 2>/dev/null done ${HOME} test
+		done printf then 'quoted text' /usr/bin $(pwd)
+		--verbose printf 'quoted text' x=1 sed sed ${HOME} readonly done /usr/bin
+		printf | && grep "$@" echo
+	-eu | grep then done && awk && export
+		"$1" cd grep echo done && local ${HOME}
+	--verbose -eu --verbose echo x=1 "$1" grep cd sed printf then then
+	/usr/bin echo 2>/dev/null "$@" printf ${HOME}
+	then ${HOME} && awk 'quoted text' | printf awk
+cd $(pwd) --verbose "$1" sed | cd printf 'quoted text'
+		readonly grep printf $(pwd) 2>/dev/null 'quoted text' "$1" done
+/usr/bin $(pwd) done local --verbose "$@" test /usr/bin echo export $(pwd) | grep
+		-eu --verbose "$1" x=1 | printf
+	echo $(pwd) sed "$1" export done
+		then done test then 2>/dev/null readonly x=1 done "$1"
+	"$@" local "$@" awk --verbose readonly
+		sed sed done /usr/bin x=1 printf printf printf readonly ${HOME}
+	awk && echo "$1" x=1 | "$@" ${HOME} then export done
+	"$@" /usr/bin awk | export x=1 then readonly $(pwd) sed test
+"$@" export sed 2>/dev/null export export
+		sed | /usr/bin /usr/bin x=1 cd readonly test 2>/dev/null
+	then local grep cd done test export 'quoted text' grep
+	$(pwd) sed grep done test readonly && 2>/dev/null
+/usr/bin /usr/bin local
+2>/dev/null export local done readonly readonly grep
+grep test cd printf -eu | && | readonly
+	/usr/bin readonly -eu
+-eu "$@" echo awk --verbose && then printf 'quoted text'
+	export /usr/bin ${HOME} sed 2>/dev/null local 2>/dev/null ${HOME} grep /usr/bin
+--verbose $(pwd) && sed /usr/bin echo x=1 | cd awk local printf 'quoted text' ${HOME}
+export /usr/bin test test local
+		grep readonly && cd awk "$@" x=1 export sed
+	awk done grep -eu "$@" $(pwd) test awk sed cd ${HOME}
+sed export x=1 done ${HOME}
+		'quoted text' "$1" printf | x=1 'quoted text' "$1" x=1 grep awk
+	'quoted text' 2>/dev/null done then -eu x=1 then | local
+		"$@" 'quoted text' readonly
+		"$@" grep cd --verbose cd then sed echo
+$(pwd) echo --verbose /usr/bin test 'quoted text' | sed "$1" ${HOME} readonly
+		local export /usr/bin && $(pwd) export | 2>/dev/null $(pwd) readonly sed test
+	test 'quoted text' ${HOME} x=1 awk local
+	local ${HOME} 'quoted text' grep -eu echo && ${HOME} readonly cd /usr/bin
+		export printf printf x=1 done | "$@" test "$@" awk -eu readonly "$1" then
+		'quoted text' -eu cd | sed && --verbose --verbose --verbose printf
+	cd local done "$1" $(pwd) then cd sed --verbose --verbose sed test && sed
+		sed readonly /usr/bin sed
+	-eu export --verbose printf test readonly "$@" grep awk grep printf local
+	"$@" 'quoted text' test --verbose
+-eu 2>/dev/null cd done then export --verbose x=1 local 2>/dev/null
+		| 2>/dev/null x=1 echo 2>/dev/null done awk &&
+	cd readonly | awk grep local --verbose done "$@" "$@" --verbose $(pwd)
+	readonly 2>/dev/null export
+	test export awk 2>/dev/null && | -eu echo
+	grep 'quoted text' && awk $(pwd)
+local export ${HOME} x=1 echo && 'quoted text' "$1" "$@"
+		echo echo done 'quoted text' "$1"
+		grep "$1" grep $(pwd) echo awk 2>/dev/null
+--verbose grep 2>/dev/null
+		readonly local && echo && ${HOME} | test /usr/bin local | cd "$1"
+	'quoted text' sed $(pwd) test --verbose
+		local /usr/bin -eu | sed
+awk /usr/bin export cd $(pwd) readonly 'quoted text' x=1 readonly
+readonly then /usr/bin && then echo ${HOME}
+	/usr/bin --verbose export then ${HOME} x=1 awk 'quoted text' "$1"
+		| cd done "$1" 'quoted text' -eu /usr/bin | done
+		export -eu cd $(pwd) --verbose 'quoted text' done cd sed sed /usr/bin export $(pwd)
+	grep 'quoted text' awk | printf then readonly
+2>/dev/null echo export --verbose -eu --verbose 'quoted text'
+	then 2>/dev/null --verbose printf /usr/bin "$1" && "$@" "$1" x=1 printf
+		cd $(pwd) --verbose export
+		"$@" ${HOME} done readonly export /usr/bin cd test export sed | local
+		printf sed | | printf | awk | $(pwd) --verbose done readonly
+${HOME} printf readonly
+		| echo done readonly ${HOME}
+		| local $(pwd) && grep cd cd "$1" test
+	test "$1" "$1" sed echo then sed -eu then readonly
+	/usr/bin local then "$@" | test printf
+${HOME} printf | "$1" x=1 grep ${HOME}
+x=1 x=1 /usr/bin /usr/bin -eu "$@" cd ${HOME} readonly 2>/dev/null
+		cd sed test done test "$@" then "$@" /usr/bin done awk printf
+		2>/dev/null /usr/bin x=1 ${HOME} "$1" /usr/bin awk readonly awk echo echo sed
+&& "$1" local grep echo sed
+		$(pwd) readonly 2>/dev/null 'quoted text' | -eu printf
+"$@" sed echo 2>/dev/null sed $(pwd) printf test $(pwd)
+/usr/bin /usr/bin grep --verbose then test "$@" readonly printf
+		cd ${HOME} test cd -eu /usr/bin
+		"$@" 2>/dev/null "$@" grep printf 2>/dev/null
+		x=1 /usr/bin readonly test -eu 'quoted text'
+	done "$@" /usr/bin sed readonly $(pwd) local done awk --verbose
+	then x=1 done "$@" sed $(pwd) cd grep && export
+/usr/bin awk readonly /usr/bin done sed
+local cd "$1" -eu local $(pwd) readonly
+	printf then test ${HOME} awk --verbose && "$1" then export &&
+	"$@" 2>/dev/null | then "$@" "$@"
+${HOME} "$1" --verbose awk "$1" --verbose 2>/dev/null
+x=1 awk local echo printf && ${HOME}
+		sed export then -eu readonly "$1" 'quoted text' done ${HOME} grep
+		$(pwd) readonly printf cd done 'quoted text' test /usr/bin --verbose
+		local x=1 cd cd $(pwd) echo $(pwd)
+	--verbose -eu 2>/dev/null readonly echo export test
+local then awk "$1" | x=1 --verbose
+sed -eu grep done test
+		then 'quoted text' --verbose
+	-eu --verbose /usr/bin -eu 2>/dev/null $(pwd) x=1 local
+	2>/dev/null --verbose 2>/dev/null done --verbose done done local &&
+	cd printf $(pwd) readonly -eu awk readonly "$1" test export printf grep
+	/usr/bin --verbose readonly "$@" x=1
+export -eu test test 2>/dev/null /usr/bin "$1" echo 'quoted text'
+		"$1" "$@" cd "$@" 2>/dev/null x=1 2>/dev/null
+grep $(pwd) "$1" "$1" "$1" local x=1 done
+	| grep --verbose printf sed 2>/dev/null -eu
+	x=1 export readonly sed | grep echo local test printf
+		| grep ${HOME} -eu "$@" | $(pwd) ${HOME} awk export --verbose && grep "$1"
+echo cd /usr/bin test /usr/bin then "$@"
+grep done "$@" cd && awk echo "$@" export "$1" --verbose
+		sed && sed $(pwd) sed local --verbose done local /usr/bin
+	printf printf | --verbose x=1 "$@"
+		sed x=1 $(pwd) ${HOME} readonly -eu grep cd printf x=1 printf
+	then ${HOME} cd && "$1" export x=1 grep cd "$1" && export grep
+	/usr/bin echo sed sed ${HOME}
+	then 'quoted text' "$1" -eu $(pwd)
+done --verbose local "$1" test -eu ${HOME} grep /usr/bin readonly
+	${HOME} "$1" "$1" /usr/bin echo 'quoted text' grep 2>/dev/null && test sed
+	x=1 /usr/bin local local "$1" $(pwd) "$@" awk | $(pwd) x=1
+	x=1 readonly local ${HOME} /usr/bin && "$1" sed printf then --verbose "$@" 2>/dev/null
+		cd awk 2>/dev/null ${HOME} --verbose
+		grep 'quoted text' readonly export readonly sed --verbose --verbose -eu "$@"
+		'quoted text' cd -eu 2>/dev/null --verbose readonly 'quoted text' ${HOME} then
+grep grep $(pwd) done sed --verbose --verbose echo awk readonly sed sed -eu
+	export cd done grep awk
+&& done 2>/dev/null 2>/dev/null cd printf then grep /usr/bin
+| ${HOME} sed export 2>/dev/null | awk "$1" /usr/bin printf ${HOME} 'quoted text'
+readonly "$1" x=1 echo awk -eu
+'quoted text' readonly export x=1 awk export cd printf sed 'quoted text' done
+	-eu "$1" /usr/bin sed -eu 2>/dev/null /usr/bin && 2>/dev/null
+'quoted text' $(pwd) | ${HOME} awk 'quoted text'
+		-eu awk -eu grep grep local /usr/bin readonly --verbose
+		&& | printf && && "$@" --verbose cd ${HOME} 'quoted text' "$@" echo grep | /usr/bin
+		-eu 2>/dev/null "$1" then export then
+	readonly grep ${HOME} export local ${HOME} && 2>/dev/null
+then ${HOME} | && readonly export export printf done local /usr/bin 2>/dev/null
+		$(pwd) grep --verbose printf | "$1" readonly
+		grep local "$@" 'quoted text' && readonly /usr/bin $(pwd) $(pwd) "$@"
+		2>/dev/null readonly 'quoted text' printf
+then cd awk test test
+local /usr/bin | done cd | printf
+		then grep cd && | x=1
+2>/dev/null /usr/bin && $(pwd) printf readonly
+		--verbose readonly grep
+		grep --verbose | "$@" && -eu done -eu
+	| "$1" && sed readonly x=1
+done && test grep local $(pwd) grep sed x=1 done "$@" echo
+		"$1" | export cd ${HOME} readonly printf printf && local echo test
+		test x=1 | readonly /usr/bin cd x=1 echo $(pwd) echo "$@" $(pwd) cd
+		2>/dev/null ${HOME} export sed --verbose
+		cd awk local readonly sed done readonly export
+| echo /usr/bin then cd 2>/dev/null grep sed --verbose "$1"
+2>/dev/null x=1 && cd /usr/bin | --verbose awk | "$1" cd ${HOME} && --verbose
+	then readonly | "$1" then --verbose | --verbose | | "$@" 2>/dev/null -eu 2>/dev/null
+		-eu readonly cd done echo printf | grep sed x=1 then
+		/usr/bin $(pwd) "$1" then "$@" test 'quoted text' awk ${HOME}
+	-eu $(pwd) test --verbose printf cd -eu printf | --verbose readonly
+	"$@" -eu sed sed test readonly 'quoted text'
+		'quoted text' done sed "$1" $(pwd) awk
+	&& 'quoted text' echo then --verbose test local readonly
+echo $(pwd) 2>/dev/null export
+		| grep grep 'quoted text'
+"$1" && 'quoted text' then sed export
+export "$1" | grep -eu 2>/dev/null echo "$1" && printf sed
+awk readonly 'quoted text' test local then cd readonly
+	awk local readonly export echo "$1" "$1" --verbose $(pwd) echo x=1 -eu
+		printf | done && x=1 local "$@"
+	"$@" sed 'quoted text' "$@" cd echo printf "$1" "$1" grep
+readonly | -eu cd sed export "$@" && done "$1" then local /usr/bin awk
+test test sed x=1 "$1" "$1" 'quoted text' echo
+--verbose test /usr/bin then export $(pwd) sed grep -eu
+		done grep ${HOME} grep awk x=1 | /usr/bin then
+		awk x=1 | /usr/bin --verbose
+		then sed 2>/dev/null | readonly -eu ${HOME}
+		grep | awk $(pwd) sed cd 'quoted text' printf local "$1" readonly
+	test awk grep local 2>/dev/null test cd "$@" local
+		done printf export | awk "$@" "$@" local ${HOME} cd ${HOME} echo "$1" readonly
+	| then -eu "$@" -eu /usr/bin grep then local printf local ${HOME} test
+	grep /usr/bin && && 'quoted text' "$1"
+	"$@" "$@" export | 2>/dev/null "$@" export test -eu 2>/dev/null awk &&
+	-eu export --verbose | --verbose grep sed sed 2>/dev/null local done
+	echo echo readonly then 'quoted text'
+		echo test 'quoted text' printf x=1 echo sed
+		&& done grep $(pwd) "$@" printf
+		local 'quoted text' x=1 grep export $(pwd) grep local
+	test x=1 export export x=1 --verbose && test $(pwd)
+grep echo x=1 then "$1" awk done -eu cd && readonly
+done ${HOME} awk 2>/dev/null echo
+		test ${HOME} && readonly
+		local /usr/bin /usr/bin echo
+| echo /usr/bin sed test --verbose --verbose grep
+		'quoted text' 2>/dev/null
+		cd readonly | 'quoted text' 'quoted text'
+		${HOME} sed x=1 $(pwd) /usr/bin "$1" 2>/dev/null test $(pwd) sed local readonly
+	'quoted text' "$@" $(pwd) then "$@" sed -eu ${HOME} grep then
+		| -eu 'quoted text' grep x=1 && export
+	x=1 export done && x=1 export "$1" done local sed sed done ${HOME}
+/usr/bin cd "$1" /usr/bin
+		--verbose "$1" printf -eu done readonly then && --verbose awk printf 2>/dev/null
+x=1 x=1 test && && readonly x=1 readonly 'quoted text' --verbose
+x=1 printf grep && printf
+	echo "$1" -eu local x=1 then printf /usr/bin --verbose | awk /usr/bin
+	| echo awk ${HOME} then awk readonly 'quoted text'
+	awk | echo test cd | ${HOME}
+		readonly 'quoted text' export test local 2>/dev/null "$@" sed /usr/bin
+		cd 'quoted text' sed export local sed
+		export "$1" local $(pwd) 'quoted text' 'quoted text' printf | sed -eu readonly
+		2>/dev/null awk --verbose sed $(pwd) awk local printf x=1 grep ${HOME} then awk
+$(pwd) ${HOME} printf sed
+	--verbose test 'quoted text' test local ${HOME} export grep export x=1
+		--verbose x=1 "$1" awk printf -eu "$1" && export ${HOME} "$1" "$@"
+		x=1 --verbose sed $(pwd) 'quoted text' "$@" $(pwd) 'quoted text' "$1" 2>/dev/null
+		/usr/bin export export -eu x=1
+		local local echo 2>/dev/null echo ${HOME} awk readonly 'quoted text'
+	2>/dev/null "$1" 'quoted text'
+	local then sed x=1 --verbose then cd $(pwd) "$@" export export /usr/bin | grep
+	export sed /usr/bin then export --verbose awk ${HOME}
+		done sed $(pwd) 'quoted text' && --verbose then printf
+	--verbose "$1" && ${HOME} "$1" cd local export 'quoted text' 2>/dev/null
+2>/dev/null export cd local x=1 "$1" printf
+--verbose sed grep $(pwd) cd awk grep done $(pwd) done 'quoted text' test local
+	'quoted text' ${HOME} --verbose awk readonly grep |
+	$(pwd) -eu 'quoted text' grep test ${HOME} then /usr/bin
+		test readonly echo --verbose awk "$1" | echo awk |
+echo test "$@" sed /usr/bin && done printf awk && ${HOME} test echo export sed grep
+	--verbose cd /usr/bin awk x=1 export export /usr/bin --verbose
+	&& 'quoted text' local 'quoted text'
+	done /usr/bin $(pwd) ${HOME} --verbose cd echo "$@" done && -eu "$1" export 2>/dev/null
+	readonly $(pwd) echo awk --verbose -eu $(pwd) readonly 'quoted text'
+		echo "$@" --verbose "$1"
+/usr/bin /usr/bin readonly then
+	test then export then "$1" echo -eu ${HOME}
+	test echo echo && echo |
+	--verbose cd $(pwd) readonly "$1" cd readonly export $(pwd) --verbose
+	--verbose ${HOME} x=1 && ${HOME} echo /usr/bin 'quoted text'
+		echo printf readonly then cd echo ${HOME} /usr/bin
+	x=1 $(pwd) local sed test export x=1 cd ${HOME} grep sed cd /usr/bin
+	x=1 printf test export ${HOME} 'quoted text'
+	export 2>/dev/null x=1 2>/dev/null local 'quoted text'
+	x=1 grep | grep 2>/dev/null x=1 'quoted text' cd local test "$@" then ${HOME}
+	$(pwd) && test cd 'quoted text' /usr/bin test
+/usr/bin ${HOME} export 2>/dev/null 2>/dev/null "$1" -eu
+	grep && readonly -eu | "$@" grep readonly local sed local /usr/bin 'quoted text'
+		"$@" grep test then done
+	2>/dev/null 'quoted text' --verbose readonly ${HOME} -eu --verbose
+		grep x=1 then $(pwd) /usr/bin echo x=1 "$1"
+export /usr/bin then && /usr/bin $(pwd) 2>/dev/null x=1 $(pwd) printf
+		/usr/bin readonly printf "$1" grep sed
+		x=1 cd export /usr/bin cd readonly "$@" printf readonly 2>/dev/null
+cd x=1 printf sed "$1" grep echo done echo $(pwd)
+"$@" 'quoted text' "$@" test | "$1"
+		${HOME} printf export | /usr/bin done $(pwd) printf awk echo --verbose
+	x=1 grep cd then /usr/bin grep printf "$@" 'quoted text' 2>/dev/null
+cd $(pwd) | 'quoted text' --verbose "$1" done local "$@" | sed
+printf then sed printf
+	echo /usr/bin grep grep -eu --verbose
+		--verbose grep done | "$@" awk 'quoted text' -eu sed awk printf cd echo
+-eu printf awk cd local grep
+		echo ${HOME} export printf test 2>/dev/null printf
+echo export "$1" then cd -eu ${HOME} awk "$1" then grep "$1" then
+		local test done echo -eu test "$@" awk echo test /usr/bin echo ${HOME} | awk | test
+test "$@" x=1 | export $(pwd) echo echo sed "$1" then --verbose
+	'quoted text' 2>/dev/null echo && 'quoted text' export
+	"$@" sed --verbose awk test local $(pwd)
+	${HOME} --verbose done export done sed -eu printf $(pwd) 'quoted text'
+	echo printf echo sed ${HOME} readonly "$@" echo
+--verbose done done cd --verbose done --verbose
+"$1" awk x=1 | then /usr/bin local "$1" x=1 echo done --verbose ${HOME}
+	&& readonly cd | echo 2>/dev/null ${HOME} done readonly | then --verbose export
+printf -eu /usr/bin test "$@" local awk
+	"$1" echo $(pwd) -eu echo readonly ${HOME} ${HOME}
+		echo "$@" export sed readonly /usr/bin then
+	echo ${HOME} test echo awk grep grep awk cd
+readonly printf x=1 'quoted text' echo
+$(pwd) 'quoted text' | echo echo then
+	"$1" x=1 --verbose ${HOME} $(pwd) 'quoted text'
+	then cd readonly cd -eu x=1 local printf -eu /usr/bin --verbose
+		echo grep export readonly done ${HOME} -eu x=1 'quoted text' 'quoted text' done
+x=1 2>/dev/null then 2>/dev/null grep x=1 2>/dev/null "$1" echo x=1 x=1 $(pwd)
+		sed | done "$1" -eu grep x=1 done 2>/dev/null done
+	--verbose readonly 'quoted text' $(pwd) awk "$1" $(pwd)
+${HOME} ${HOME} -eu test then --verbose --verbose | then test /usr/bin awk /usr/bin
+	cd ${HOME} | "$1" x=1 | 'quoted text' local x=1 grep
+readonly && sed "$1" "$1" x=1 awk grep awk && cd ${HOME} x=1 local grep awk
+		/usr/bin "$@" 'quoted text'
+		"$1" 'quoted text' then "$@" cd done /usr/bin then printf printf grep "$1"
+	/usr/bin && local printf "$1" x=1 "$@" grep "$@" test then
+grep 'quoted text' |
+	test echo awk readonly sed export "$1" done "$1" done
+	| printf --verbose -eu 'quoted text' awk printf cd then grep cd $(pwd)
+	x=1 readonly 'quoted text' export
+&& -eu "$1" then export grep --verbose 2>/dev/null
+test "$@" "$1" grep $(pwd) echo local printf | export "$1" x=1 --verbose
+		printf local printf echo sed 'quoted text'
+	'quoted text' readonly 2>/dev/null awk "$@" 2>/dev/null /usr/bin "$@" $(pwd) &&
+/usr/bin then $(pwd) sed export local
+		test readonly && "$1" 2>/dev/null && cd export
+	$(pwd) printf grep then printf sed cd echo -eu 'quoted text'
+export "$@" export local /usr/bin grep cd then "$@" 'quoted text'
+	x=1 $(pwd) -eu local then "$@" --verbose | /usr/bin /usr/bin readonly
+		x=1 "$1" cd then && test -eu sed | x=1 printf
+	done local ${HOME} done 2>/dev/null
+	test "$@" done && "$@" --verbose "$@"
+		'quoted text' grep sed sed echo && -eu
+	printf local && "$1" sed 'quoted text' "$@" && --verbose | 2>/dev/null
+		echo 'quoted text' 'quoted text' x=1 && -eu grep cd --verbose
+--verbose then then && awk | then && test
+$(pwd) readonly ${HOME} $(pwd) readonly 'quoted text'
+echo ${HOME} test done "$1" && grep sed | && printf then $(pwd)
+		"$@" export grep ${HOME} --verbose 'quoted text'
+		sed readonly ${HOME} $(pwd) local ${HOME}
+	2>/dev/null $(pwd) export test 2>/dev/null grep 2>/dev/null local
+		&& && $(pwd) && cd done | sed sed -eu printf /usr/bin
+		-eu grep echo test --verbose
+		--verbose ${HOME} export
+${HOME} "$@" printf "$@" export 'quoted text' test cd "$@" awk echo sed local printf
+		--verbose readonly /usr/bin readonly x=1 readonly
+test export then --verbose &&
+| export && local -eu cd "$1" $(pwd) grep sed printf | export
+	done awk then grep $(pwd) "$1" ${HOME}
+	--verbose 2>/dev/null 'quoted text'
+grep $(pwd) then 2>/dev/null 2>/dev/null
+sed grep readonly -eu --verbose grep "$@" | echo then awk test 'quoted text'
+		then --verbose "$1" --verbose x=1 -eu
+	local | x=1 | sed -eu x=1 echo "$@"
+	"$1" 2>/dev/null export ${HOME}
+	sed readonly -eu done 'quoted text'
+export --verbose awk local grep readonly -eu then
+		done echo grep grep awk "$1"
+2>/dev/null sed --verbose -eu 2>/dev/null --verbose | echo 'quoted text' 'quoted text'
+	done && local /usr/bin cd readonly export then readonly sed -eu
+/usr/bin "$@" readonly local 2>/dev/null x=1
+		"$1" "$1" then printf 'quoted text' && | ${HOME} x=1 printf
+sed 2>/dev/null echo readonly grep printf
+		local then sed ${HOME} readonly -eu cd export
+	grep sed --verbose awk then local 2>/dev/null
+	"$1" x=1 export export -eu && 'quoted text'
+	cd grep cd ${HOME} sed 'quoted text'
+		awk /usr/bin 2>/dev/null /usr/bin grep echo | awk --verbose ${HOME}
+	done printf "$@" sed
+done done ${HOME} "$1" awk --verbose "$1" 2>/dev/null printf
+		&& readonly $(pwd) then done then export test local
+then readonly 'quoted text' 'quoted text' $(pwd) readonly "$@"
+		done 'quoted text' echo -eu then grep 2>/dev/null cd "$@" then export grep
+		local echo readonly "$1"
+awk then local --verbose local grep cd ${HOME} cd ${HOME} done
+export test test | && x=1 && readonly $(pwd) /usr/bin readonly
+	'quoted text' awk && 2>/dev/null echo && 'quoted text' && export sed /usr/bin
+grep printf /usr/bin 'quoted text' -eu sed "$1" "$1" cd cd "$1" --verbose
+	2>/dev/null "$1" awk test printf /usr/bin done /usr/bin x=1 export 2>/dev/null
+		${HOME} cd local 2>/dev/null
+	"$1" sed 2>/dev/null "$1" && $(pwd) "$@" sed "$@" sed -eu local grep export
+done then 'quoted text' 'quoted text' cd cd then printf ${HOME} then done ${HOME}
+	&& x=1 sed x=1 | test 2>/dev/null
+		'quoted text' /usr/bin 'quoted text'
+	x=1 ${HOME} readonly done local readonly --verbose awk sed local
+		--verbose local sed x=1 /usr/bin local done then "$1" 2>/dev/null
+/usr/bin "$@" x=1 test x=1 'quoted text' x=1 test local -eu echo grep 2>/dev/null
+	printf cd cd done test sed done && 2>/dev/null --verbose x=1 && sed
+done local export --verbose "$@" "$1"
+&& export 'quoted text' -eu cd grep 2>/dev/null 'quoted text'
+	sed cd --verbose export x=1 printf x=1
+	| | x=1 then then done 2>/dev/null | x=1 local /usr/bin $(pwd) --verbose
+$(pwd) 'quoted text' $(pwd) echo awk --verbose $(pwd)
+"$1" test --verbose done "$1" && grep /usr/bin
+	grep x=1 cd export test sed printf | readonly awk 'quoted text'
+"$@" readonly $(pwd) awk x=1
+	"$@" "$@" readonly x=1 echo "$@" then 'quoted text' --verbose ${HOME} cd
+		local 2>/dev/null printf awk sed printf grep 'quoted text' local --verbose
+	$(pwd) readonly "$@" printf local /usr/bin x=1 "$1" readonly -eu
+		2>/dev/null --verbose "$@" awk done export export x=1 $(pwd)
+	-eu printf "$1" sed 'quoted text'
+	local then "$1" /usr/bin /usr/bin x=1 local grep test && readonly | 'quoted text'
+	local ${HOME} test $(pwd) grep x=1 export echo
+		"$1" /usr/bin && "$1" done done "$@" echo --verbose
+		| export 2>/dev/null && grep ${HOME} awk "$1" cd "$@" $(pwd) then
+		grep 'quoted text' local test printf done 2>/dev/null then awk cd x=1
+		sed grep sed $(pwd) --verbose sed
+	-eu done sed -eu -eu "$1" local $(pwd) readonly 'quoted text' local printf $(pwd)
+		echo "$@" x=1 -eu cd "$1" -eu readonly | sed echo --verbose
+x=1 -eu && && readonly "$1" $(pwd) readonly ${HOME}
+	'quoted text' "$1" export "$1" "$1" "$1" -eu grep -eu /usr/bin
+"$1" cd --verbose "$@" local done test -eu "$1" then grep sed awk
+done export $(pwd) 2>/dev/null --verbose --verbose local readonly
+	test readonly --verbose test cd $(pwd) --verbose grep /usr/bin export test
+		"$@" $(pwd) "$@" -eu cd 'quoted text' cd && "$@" local &&
+-eu awk -eu then sed "$@" --verbose readonly "$@" -eu then export -eu cd readonly
+sed awk --verbose sed $(pwd) ${HOME} readonly
+${HOME} test "$1" done then readonly sed export
+x=1 'quoted text' then --verbose x=1 -eu ${HOME} grep
+		--verbose printf readonly x=1 test
+		printf | echo | echo export 2>/dev/null $(pwd) awk
+export then cd echo printf
+	export export awk then sed 'quoted text' --verbose export "$1" awk
+		${HOME} printf local --verbose | x=1 ${HOME} $(pwd) 2>/dev/null done "$@" grep
+		echo $(pwd) "$1" cd 2>/dev/null /usr/bin printf test
+$(pwd) $(pwd) done "$@" echo grep
+	${HOME} "$@" && "$1" 'quoted text' --verbose $(pwd) readonly
+"$1" printf test then x=1
+	"$@" $(pwd) sed test printf awk $(pwd) then awk sed 2>/dev/null && test grep "$@"
+echo test /usr/bin grep "$@" printf x=1 /usr/bin
+awk | then && export then cd sed grep | sed 2>/dev/null 'quoted text'
+	x=1 && x=1 readonly | 2>/dev/null readonly
+	echo echo local 'quoted text' cd "$@" local cd "$@" 2>/dev/null echo $(pwd)
+--verbose ${HOME} --verbose | 2>/dev/null grep then | test awk
+		"$@" | "$@" && echo /usr/bin -eu "$1" grep $(pwd) test readonly $(pwd) $(pwd) grep
+		sed test | awk echo $(pwd) | readonly echo
+| ${HOME} /usr/bin /usr/bin ${HOME} "$1" grep awk sed "$@" -eu 2>/dev/null
+	/usr/bin --verbose export --verbose
+	"$1" sed then done 2>/dev/null $(pwd) -eu local local awk test cd x=1 /usr/bin
+		$(pwd) 2>/dev/null | "$@" local export 'quoted text'
+"$1" ${HOME} 'quoted text' cd -eu ${HOME}
+x=1 -eu "$1" awk printf "$@" then grep
+	&& echo export printf awk | -eu export printf -eu && /usr/bin
+		readonly "$1" "$@" cd 2>/dev/null
+'quoted text' "$@" done "$1" "$1" /usr/bin ${HOME} readonly
+	grep "$@" 2>/dev/null printf printf done 'quoted text'
+		echo 'quoted text' readonly sed 2>/dev/null 2>/dev/null 2>/dev/null
+		x=1 cd sed $(pwd) -eu $(pwd) ${HOME} && /usr/bin awk
+	'quoted text' 'quoted text' -eu readonly done
+-eu "$1" cd readonly then 'quoted text' x=1 readonly local
+then --verbose -eu 2>/dev/null 'quoted text' "$@" 2>/dev/null
+	echo x=1 readonly readonly | "$1" cd --verbose echo ${HOME} printf | cd --verbose
+		grep x=1 "$@" readonly --verbose cd --verbose
+echo && -eu test -eu cd && then test
+$(pwd) grep 'quoted text' awk "$@" awk awk | printf awk x=1 readonly
+test $(pwd) $(pwd) echo
+		${HOME} "$@" awk 2>/dev/null
+then echo /usr/bin done | && && export printf grep $(pwd)
+		x=1 && ${HOME} export "$1" ${HOME} | --verbose
+then -eu | ${HOME} printf "$@" export then printf && 2>/dev/null awk test test
+export test --verbose
+	then test 2>/dev/null && then test sed
+	readonly && awk $(pwd) done | printf
+readonly done done 2>/dev/null 'quoted text'
+	test $(pwd) echo grep echo readonly | $(pwd) done $(pwd)
+2>/dev/null readonly awk --verbose printf
+	local && grep grep | $(pwd)
+		echo x=1 2>/dev/null "$@" 2>/dev/null local && x=1
+then $(pwd) test cd 2>/dev/null echo test /usr/bin then cd readonly grep --verbose
+		${HOME} | && awk 'quoted text' sed sed "$@" sed
+		$(pwd) -eu | --verbose --verbose
+| "$1" "$1" $(pwd) awk 2>/dev/null test "$@" done readonly cd test
+/usr/bin awk "$1" echo cd then readonly -eu | cd /usr/bin export "$1" "$1"
+2>/dev/null "$@" ${HOME} then cd "$@"
+$(pwd) $(pwd) -eu | /usr/bin
+		/usr/bin grep && $(pwd) grep | export printf "$@" 'quoted text'
+	-eu 'quoted text' echo x=1 $(pwd) echo sed | /usr/bin printf |
+	export x=1 ${HOME} export readonly $(pwd) done $(pwd) "$@" 'quoted text'
+		'quoted text' /usr/bin done test ${HOME} test printf grep echo readonly
+		| && ${HOME} --verbose done grep $(pwd) $(pwd) awk 'quoted text'
+	local "$@" local -eu "$@" echo export /usr/bin grep cd /usr/bin | test echo /usr/bin
+	&& /usr/bin 'quoted text' echo
+done export "$1" && local test cd "$1" sed test export && 'quoted text'
+grep sed test --verbose sed 'quoted text' local cd then export 'quoted text' -eu
+	-eu grep --verbose && local "$@" --verbose $(pwd) ${HOME}
+echo | sed printf echo local "$@" "$1" done && 'quoted text' --verbose
+	export printf printf ${HOME} export 2>/dev/null sed test
+	${HOME} "$1" "$1" x=1 "$1" cd echo
+	printf -eu -eu awk done /usr/bin 2>/dev/null
+	| printf sed "$1" x=1 2>/dev/null
+	${HOME} "$1" 'quoted text'
+${HOME} then 'quoted text' awk /usr/bin "$1" sed /usr/bin printf readonly echo
+	cd && local export then readonly "$@" x=1 cd export "$1" "$1" printf
+export 'quoted text' awk then -eu "$@" | | cd grep awk --verbose 2>/dev/null 'quoted text'
+grep then "$1" then x=1 | /usr/bin --verbose ${HOME} cd
+echo ${HOME} sed printf grep 2>/dev/null cd x=1 x=1 grep "$1"
+then grep | printf ${HOME} sed export echo cd $(pwd) 2>/dev/null sed
+	export --verbose $(pwd) x=1 sed
+echo done readonly done ${HOME} test done "$1" echo readonly
+sed $(pwd) local --verbose readonly -eu 'quoted text' $(pwd) /usr/bin
+		"$1" "$1" "$1" sed local
+/usr/bin --verbose x=1 local --verbose
+${HOME} awk cd done ${HOME} cd | $(pwd) sed /usr/bin | done sed
+-eu | readonly done sed 2>/dev/null "$1" done awk
+awk local echo then -eu readonly sed "$@" "$@" sed done
+		2>/dev/null cd test readonly --verbose then --verbose
+awk grep -eu /usr/bin sed
+		'quoted text' export awk export &&
+printf /usr/bin /usr/bin 2>/dev/null grep && 2>/dev/null x=1 cd grep | ${HOME}
+$(pwd) x=1 /usr/bin printf cd grep 2>/dev/null && then export cd 'quoted text'
+	"$1" echo sed sed ${HOME} /usr/bin then echo echo $(pwd) grep grep printf "$@"
+done cd local /usr/bin -eu grep "$@" -eu
+	'quoted text' test local awk | --verbose /usr/bin --verbose export
+grep 2>/dev/null -eu then 2>/dev/null test "$1" sed
+		export printf $(pwd) "$@" -eu awk "$@" local --verbose local
+	"$1" 'quoted text' 2>/dev/null echo -eu then 2>/dev/null cd $(pwd) awk $(pwd)
+2>/dev/null 2>/dev/null then grep -eu -eu --verbose
+		export | local done && -eu test | test then 'quoted text' 'quoted text' sed
+	$(pwd) ${HOME} cd --verbose awk readonly ${HOME} cd
+test 'quoted text' $(pwd)
+	awk $(pwd) sed grep "$@" sed 2>/dev/null
+	grep export test -eu && echo "$1" awk sed local /usr/bin export
+	printf echo cd done done -eu "$1" printf && $(pwd)
+'quoted text' -eu awk /usr/bin cd grep grep 2>/dev/null 'quoted text'
+	-eu /usr/bin "$@" local x=1 printf 2>/dev/null "$1" -eu cd done sed then
+		test sed export export 2>/dev/null 'quoted text' /usr/bin local
+x=1 test readonly ${HOME} grep export done grep && done printf export printf "$@"
+	&& ${HOME} 2>/dev/null printf "$1" $(pwd)
+-eu cd /usr/bin cd printf echo --verbose
+		-eu awk 'quoted text' x=1 && export sed cd | /usr/bin
+		"$@" awk local local sed | ${HOME} cd awk x=1 -eu --verbose local done test cd grep
+		'quoted text' && readonly 'quoted text' && /usr/bin printf 2>/dev/null echo
+	-eu ${HOME} then "$1" x=1 -eu
+"$1" 'quoted text' local && cd
+		--verbose grep printf "$1" 'quoted text' then && then $(pwd)
+		'quoted text' local done readonly
+&& 2>/dev/null readonly local && x=1
+	awk $(pwd) test cd "$1" /usr/bin cd --verbose
+	local done echo -eu -eu readonly /usr/bin export 'quoted text'
+	local --verbose x=1 readonly | -eu
+awk echo sed 'quoted text' grep --verbose local awk 'quoted text' -eu
+	then test "$1" then grep cd then readonly done grep && --verbose then
+	${HOME} then export 2>/dev/null ${HOME} echo 'quoted text'
+		$(pwd) readonly echo 'quoted text' test | 'quoted text' --verbose
+		${HOME} 2>/dev/null 2>/dev/null x=1 --verbose cd
+echo x=1 cd readonly printf sed export awk export -eu 'quoted text' awk $(pwd)
+		x=1 awk awk | 'quoted text' -eu cd ${HOME} printf $(pwd) local echo /usr/bin
+x=1 done test "$1" $(pwd) "$@"
+	test grep sed grep $(pwd) "$1" then 2>/dev/null "$@"
+	'quoted text' test local sed echo /usr/bin printf
+		&& then ${HOME} --verbose "$1" 2>/dev/null test
+	export "$1" done $(pwd) echo echo x=1 test echo grep ${HOME} "$@" x=1 cd
+		export "$1" echo | awk test printf
+| sed ${HOME} cd cd grep | /usr/bin cd ${HOME} "$@" "$@" sed export "$@" awk
+"$@" 2>/dev/null ${HOME} export ${HOME}
+cd then /usr/bin awk readonly 2>/dev/null
+2>/dev/null sed cd then ${HOME} && | 'quoted text'
+	then readonly readonly printf x=1 awk --verbose test local x=1 "$1"
+'quoted text' awk -eu ${HOME} | echo "$1" --verbose
+		done "$@" cd --verbose echo cd -eu -eu ${HOME} ${HOME} grep
+	/usr/bin -eu --verbose printf ${HOME} $(pwd) x=1 "$1" sed
+		${HOME} sed "$1" cd local --verbose grep readonly -eu export then cd echo | 'quoted text'
+	$(pwd) then $(pwd) | /usr/bin
+		cd sed export done cd --verbose
+test done grep "$@" then /usr/bin export 2>/dev/null
+	printf local readonly | cd done -eu echo 2>/dev/null && 'quoted text'
+		readonly /usr/bin done "$@" 2>/dev/null ${HOME} printf "$@"
+readonly x=1 && readonly 2>/dev/null
+2>/dev/null && /usr/bin 2>/dev/null 2>/dev/null
+	cd 'quoted text' grep 'quoted text' test done x=1 local readonly
+local echo 2>/dev/null readonly 2>/dev/null
+	x=1 /usr/bin $(pwd) | export --verbose local test readonly done echo sed
+		cd 2>/dev/null grep test sed
+	readonly test --verbose export sed local sed done
+	"$@" done -eu export cd export
+then export 2>/dev/null x=1 export "$@" printf 2>/dev/null 'quoted text' $(pwd)
+		then export "$@" 'quoted text' | "$1" done then then $(pwd) x=1 export 2>/dev/null
+printf 'quoted text' export
+	--verbose printf test grep x=1 --verbose "$@" local && cd echo awk done
+	sed $(pwd) readonly printf ${HOME} sed
+	/usr/bin test awk "$1" printf && test cd readonly then
+/usr/bin sed sed 2>/dev/null 2>/dev/null
+then --verbose 'quoted text' then
+	| 'quoted text' export readonly 2>/dev/null -eu test sed then --verbose
+		printf "$@" printf -eu && done grep x=1 done ${HOME}
+	then -eu then then cd then x=1 done "$1"
+grep grep sed done local local /usr/bin "$@" "$1" | && then cd sed local /usr/bin
+	printf done echo done
+test then && $(pwd) done ${HOME} grep readonly /usr/bin test echo done --verbose
+	x=1 then done --verbose -eu 2>/dev/null /usr/bin then x=1
+		printf test "$@" -eu -eu readonly -eu grep 'quoted text'
+	cd printf | sed done echo ${HOME}
+grep then printf cd export export
+	x=1 sed "$1" ${HOME} $(pwd) x=1 --verbose
+"$@" local 'quoted text' then then -eu printf
+	--verbose then echo readonly | readonly | then
+2>/dev/null --verbose awk --verbose
+"$1" "$@" awk then -eu echo && | /usr/bin
+		'quoted text' 'quoted text' test readonly | export local
+		| x=1 then grep ${HOME} readonly | awk done /usr/bin local export
+	export export -eu readonly -eu -eu $(pwd) sed -eu cd --verbose
+$(pwd) | grep /usr/bin export
+&& x=1 x=1 && cd /usr/bin test -eu test awk --verbose ${HOME} "$1" sed cd awk x=1
+	| | | echo && printf /usr/bin "$@" export
+	local echo cd export "$1" test grep x=1 ${HOME} printf
+		grep 2>/dev/null grep local 2>/dev/null "$1" echo $(pwd) sed $(pwd) cd
+-eu ${HOME} export $(pwd) readonly $(pwd) /usr/bin
+2>/dev/null test 2>/dev/null 'quoted text' then printf cd 'quoted text'
+	readonly /usr/bin then grep sed echo "$@"
+"$1" ${HOME} 2>/dev/null then awk then ${HOME} export
+"$@" done ${HOME} sed 'quoted text'
+	test local $(pwd) export printf | echo --verbose sed sed x=1 local
+		| done -eu done done grep local && "$@" then $(pwd) then 'quoted text'
+	then /usr/bin 2>/dev/null readonly echo cd readonly done test ${HOME} 2>/dev/null
+&& --verbose local --verbose
+cd -eu grep local grep sed local local
+'quoted text' grep ${HOME} && sed local test &&
+	sed test 2>/dev/null | && done local -eu
+		x=1 readonly && printf && grep
+	&& local && 'quoted text' done echo then 'quoted text' && x=1 x=1
+${HOME} sed && ${HOME} awk "$@" $(pwd)
+$(pwd) 'quoted text'
+	done sed awk 'quoted text' "$@" readonly printf
+	done --verbose 2>/dev/null x=1 cd readonly "$@" $(pwd) cd echo | "$@" "$1" local
+	--verbose readonly grep grep ${HOME} "$@" echo
+		$(pwd) $(pwd) export test export awk then
+	printf "$@" readonly cd $(pwd) printf 'quoted text' "$@" done sed && grep
+		/usr/bin /usr/bin local "$@" 'quoted text'
+export $(pwd) /usr/bin cd sed -eu
+-eu -eu printf cd x=1 sed x=1 ${HOME}
+		test -eu 2>/dev/null 'quoted text' ${HOME} echo
+readonly 'quoted text' -eu test then awk
+		local export done 'quoted text' && 2>/dev/null ${HOME} "$@" grep x=1 ${HOME}
+		done then --verbose test $(pwd) x=1 then ${HOME} "$1" ${HOME} 2>/dev/null
+		${HOME} "$1" 'quoted text' cd -eu grep then
+	$(pwd) readonly export grep 'quoted text' ${HOME} cd ${HOME} readonly && done
+"$@" printf awk test "$1" ${HOME} && test sed $(pwd) ${HOME}
+$(pwd) x=1 'quoted text'
+/usr/bin ${HOME} "$1" local $(pwd) printf awk grep 2>/dev/null
+		x=1 ${HOME} ${HOME} local then /usr/bin grep ${HOME} done export printf
+	--verbose test sed sed /usr/bin --verbose
+${HOME} /usr/bin printf printf done then 'quoted text'
+		sed printf x=1 "$1" -eu ${HOME} echo x=1 ${HOME} $(pwd) readonly cd grep -eu 'quoted text'
+		cd local -eu && /usr/bin /usr/bin "$1" 'quoted text'
+		test /usr/bin ${HOME} printf awk "$1"
+test printf $(pwd) export x=1 'quoted text' 'quoted text' export 'quoted text'
+		-eu "$@" sed done | 'quoted text' local awk echo sed 2>/dev/null /usr/bin
+--verbose $(pwd) | done | | test --verbose local | | $(pwd) test export "$@"
+	"$@" -eu echo | readonly "$1" test -eu export "$@" test ${HOME} then
+readonly then --verbose
+	printf readonly --verbose 2>/dev/null local | "$@" echo "$@"
+	/usr/bin done test sed done && ${HOME} then awk /usr/bin
+		/usr/bin && $(pwd) --verbose awk 'quoted text' && readonly
+	--verbose cd printf grep printf echo echo then sed echo cd then $(pwd) -eu
+		'quoted text' local "$1" test /usr/bin && "$@" grep local grep "$@" export readonly
+	x=1 printf x=1 cd awk local "$1" "$@" 2>/dev/null export readonly
+	"$@" echo printf awk "$@" 'quoted text' awk then /usr/bin
+readonly /usr/bin x=1 then --verbose printf
+	&& 'quoted text' cd export
+		test then && "$@" $(pwd) x=1 --verbose export --verbose
+	test local sed $(pwd) grep done
+grep && --verbose | | --verbose cd then -eu --verbose $(pwd) sed echo x=1
+		$(pwd) $(pwd) x=1 | export && local | -eu "$1" cd
+awk ${HOME} $(pwd) printf printf
+		${HOME} "$@" export ${HOME} "$@" -eu done | | printf $(pwd)
+	${HOME} sed export -eu local
+	"$@" local --verbose export "$@" then 2>/dev/null x=1 local then /usr/bin
+$(pwd) sed /usr/bin /usr/bin printf
+--verbose 2>/dev/null test done test 2>/dev/null
+	${HOME} $(pwd) ${HOME} export echo 2>/dev/null printf $(pwd) --verbose
+	printf sed 2>/dev/null cd 2>/dev/null ${HOME} $(pwd) x=1 printf $(pwd)
+	${HOME} --verbose local then --verbose test ${HOME} "$1" cd
+	&& local echo --verbose grep && printf --verbose printf
+		done "$1" "$1" -eu sed /usr/bin 2>/dev/null
+		local test -eu cd grep printf awk ${HOME} readonly
+	&& -eu -eu echo "$@" cd
+		"$1" printf "$1" 'quoted text' readonly && "$1" then
+	awk "$1" && then echo test readonly then export then ${HOME} echo &&
+"$@" test test --verbose readonly | -eu local grep readonly printf readonly printf
+		cd test export --verbose awk "$1" --verbose -eu printf ${HOME} local
+$(pwd) $(pwd) then awk test "$@" echo | | --verbose
+${HOME} export then $(pwd)
+export local 'quoted text' echo done
+		awk "$1" 'quoted text' cd export
+local then readonly -eu then
+		${HOME} test printf test --verbose 2>/dev/null
+		awk /usr/bin readonly $(pwd) printf cd echo then $(pwd) x=1 export
+	test grep local "$1" -eu cd then local cd "$@" done
+		cd "$1" $(pwd) 2>/dev/null x=1 && x=1 | grep done cd printf then
+		| /usr/bin done grep printf $(pwd) -eu -eu grep 'quoted text' grep sed --verbose
+		export /usr/bin readonly
+		awk test "$@" && test test export /usr/bin | sed
+		grep ${HOME} grep grep local "$@" /usr/bin grep echo done readonly
+--verbose --verbose cd local test local export
+	grep readonly $(pwd) x=1 x=1 $(pwd) then "$1" ${HOME} -eu ${HOME} export grep
+		export local cd x=1 && done x=1 then export awk printf sed grep done | 'quoted text'
+		sed readonly x=1 --verbose done | 2>/dev/null local
+	awk cd /usr/bin then test 2>/dev/null
+	grep then readonly $(pwd) test "$@"
+	readonly readonly awk --verbose sed test local echo "$@"
+		sed x=1 echo "$@" printf printf && grep -eu -eu x=1 printf 2>/dev/null
+$(pwd) cd local 2>/dev/null
+		then $(pwd) then echo "$@" echo -eu 2>/dev/null test
+		x=1 | local ${HOME} cd grep done -eu "$@" 2>/dev/null test /usr/bin
+	${HOME} x=1 "$@" export x=1 x=1 -eu awk printf ${HOME}
+	x=1 && awk then cd sed
+grep $(pwd) then awk local printf |
+		"$1" export awk awk awk local -eu
+test "$@" printf printf test export echo test
+		echo ${HOME} $(pwd) cd ${HOME} -eu -eu x=1 ${HOME}
+	'quoted text' --verbose
+	/usr/bin done ${HOME} cd --verbose printf 'quoted text' test
+	cd $(pwd) 2>/dev/null
+	'quoted text' -eu "$@" echo readonly "$1"
+-eu "$@" local && 2>/dev/null -eu 'quoted text' $(pwd) --verbose awk "$1"
+	awk export grep printf local sed /usr/bin
+		x=1 sed done 'quoted text' ${HOME} && awk "$1" "$1" sed sed sed echo echo ${HOME}
+'quoted text' | "$@" -eu printf | test -eu "$1" awk
+		local $(pwd) && --verbose /usr/bin ${HOME} cd cd then /usr/bin x=1 done printf
+2>/dev/null then "$1" | && x=1 -eu -eu 2>/dev/null awk echo /usr/bin x=1 "$1"
+	echo grep && 2>/dev/null /usr/bin "$1" test --verbose export
+local grep 2>/dev/null "$@" $(pwd) awk readonly "$@" ${HOME} test printf
+/usr/bin then test 'quoted text'
+	'quoted text' echo test local "$@" test && 'quoted text' 'quoted text' --verbose
+		printf cd 2>/dev/null $(pwd) then awk | printf local awk readonly cd readonly
+		&& 'quoted text' awk x=1 'quoted text' "$1" cd "$1" "$1" export $(pwd) && &&
+echo then "$@" readonly sed 2>/dev/null |
+		sed 'quoted text' printf grep echo done
+export test awk sed -eu "$1" ${HOME} 'quoted text'
+grep "$@" test grep --verbose done done "$@"
+	x=1 --verbose /usr/bin sed 2>/dev/null x=1 grep $(pwd) test grep ${HOME} |
+		${HOME} local x=1 "$@" echo x=1 'quoted text' printf "$1" export && --verbose
+x=1 | --verbose x=1 2>/dev/null -eu -eu "$@" | "$1" | x=1
+export $(pwd) export export $(pwd)
+		2>/dev/null 'quoted text' done local printf "$1" | "$1" "$@" &&
+	then /usr/bin && "$1" sed | -eu "$@" sed then test "$1" "$@"
+	$(pwd) "$1" -eu readonly printf echo -eu done 2>/dev/null
+grep | test cd /usr/bin "$1" | $(pwd) "$1" printf
+--verbose export ${HOME} local printf x=1 | echo /usr/bin local grep $(pwd)
+	local printf x=1 readonly printf echo ${HOME} "$@" --verbose
+	then "$@" && done x=1 cd 'quoted text' sed ${HOME} done && -eu 'quoted text'
+'quoted text' --verbose then export echo
+test 2>/dev/null local awk | --verbose && /usr/bin readonly | awk && cd $(pwd)
+readonly then echo export "$@" "$1" grep
+		printf then -eu "$@" --verbose | --verbose x=1 printf echo $(pwd)
+		grep test | 'quoted text' local --verbose "$@" then cd export $(pwd) 'quoted text'
+&& then && ${HOME} | 2>/dev/null cd 'quoted text' "$1" && sed grep test then
+/usr/bin "$1" test echo export test x=1 test sed $(pwd) /usr/bin then --verbose
+	-eu local sed | "$1" export | cd done
+		'quoted text' 'quoted text'
+local readonly export 2>/dev/null export awk && x=1 local &&
+		x=1 echo && local /usr/bin ${HOME}
+	test test && local cd 'quoted text'
+grep grep x=1 ${HOME} "$@" readonly
+/usr/bin then 2>/dev/null 'quoted text'
+$(pwd) export sed ${HOME} $(pwd) 2>/dev/null "$1" -eu -eu export awk
+	readonly | x=1 echo grep local | "$@" "$@" export test sed printf 2>/dev/null cd
+| && $(pwd) sed /usr/bin 2>/dev/null -eu "$1" ${HOME} test
+		printf 'quoted text' 'quoted text'
+local done /usr/bin export
+/usr/bin printf export cd /usr/bin -eu -eu ${HOME} ${HOME} /usr/bin
+		${HOME} cd x=1 --verbose printf echo "$1" echo && test $(pwd) "$1" ${HOME} x=1
+	"$1" printf "$1" | done 2>/dev/null awk "$@" /usr/bin readonly done x=1 cd /usr/bin
+	&& ${HOME} export | ${HOME} "$@" export 2>/dev/null local
+test grep -eu && "$@" sed echo -eu --verbose awk && 2>/dev/null
+	test readonly cd then "$1" 2>/dev/null "$1"
+	local cd "$1" local grep --verbose printf /usr/bin cd grep readonly
+	grep local && 2>/dev/null
+	local --verbose "$1" --verbose local
+local x=1 test --verbose ${HOME} "$@" then printf
+	"$1" --verbose export --verbose local $(pwd) echo
+"$@" sed -eu | printf printf test grep printf && sed export $(pwd) "$@" ${HOME}
+		then readonly ${HOME} x=1 'quoted text' ${HOME} "$1" 'quoted text' sed -eu
+	-eu "$@" local "$1" readonly
+		${HOME} --verbose sed echo echo grep
+		${HOME} 'quoted text' grep awk && 2>/dev/null | /usr/bin $(pwd)
+readonly "$@" "$1" /usr/bin local x=1 'quoted text' 'quoted text' readonly -eu
+	x=1 grep printf printf sed --verbose
+$(pwd) grep $(pwd) printf --verbose 2>/dev/null
+echo printf then "$1" local | "$@"
+sed | -eu then done done test | "$@" --verbose cd echo && printf
+		test $(pwd) $(pwd) --verbose "$@"
+	2>/dev/null then x=1 ${HOME} "$@" sed "$@" export | -eu then echo awk printf
+		/usr/bin /usr/bin "$1" awk "$1" local /usr/bin echo /usr/bin ${HOME} "$@"
+	test cd && grep echo export sed export test $(pwd) cd test export | "$1"
+	awk done echo readonly 'quoted text' export
+-eu grep export local "$@" local sed test awk readonly sed
+export sed x=1 awk "$1" | ${HOME} then
+		&& /usr/bin | sed done export ${HOME}
+		export && "$1" cd export "$@" export 'quoted text'
+then 'quoted text' grep x=1 ${HOME} then | export /usr/bin "$1"
+	--verbose 2>/dev/null readonly grep
+cd /usr/bin grep awk /usr/bin
+		export "$@" /usr/bin echo
+	${HOME} awk awk local export then
+printf test x=1 then ${HOME} grep test
+x=1 grep x=1 --verbose "$@" 2>/dev/null ${HOME} readonly
+		export echo echo awk $(pwd) export ${HOME} sed export cd "$1" $(pwd)
+		sed awk readonly test "$1" $(pwd) "$@"
+	'quoted text' && "$1" 2>/dev/null "$1" then readonly export done "$@"
+	2>/dev/null "$1" /usr/bin done printf local /usr/bin export
+/usr/bin -eu /usr/bin |
+	$(pwd) x=1 echo ${HOME} test echo local done export -eu cd 2>/dev/null "$@"
+	printf x=1 | export | $(pwd) --verbose echo local 2>/dev/null sed then "$@"
+		then "$1" "$@" /usr/bin $(pwd) "$@" /usr/bin | | done | readonly
+	awk done grep /usr/bin | cd cd then "$@"
+	local $(pwd) sed --verbose awk ${HOME} "$@" export
+	"$@" "$1" cd local /usr/bin grep cd 'quoted text' sed test
+	echo printf -eu /usr/bin x=1 sed 'quoted text' sed | export sed cd x=1 && "$1"
+local done sed local done "$1"
+	${HOME} "$1" 2>/dev/null
+--verbose then x=1 grep "$@" readonly x=1 test test "$@" --verbose 'quoted text'
+2>/dev/null echo done ${HOME} printf $(pwd) sed 2>/dev/null
+readonly awk ${HOME} printf "$@" grep cd $(pwd) readonly
+	&& 'quoted text' /usr/bin awk grep "$@" cd 2>/dev/null local ${HOME} x=1 sed
+	sed export local readonly echo /usr/bin printf
+	readonly -eu && "$1" echo ${HOME} $(pwd) then $(pwd) x=1 /usr/bin "$1" export export
+	test "$@" x=1 -eu readonly
+		"$1" ${HOME} && --verbose "$@" | | echo x=1 test
+	| export sed "$1" 2>/dev/null ${HOME} &&
+--verbose done readonly then --verbose ${HOME} "$@" --verbose
+--verbose sed export /usr/bin
+	| "$1" | test export echo printf | && grep
+export readonly "$@" done 'quoted text'
+		"$@" export 'quoted text' x=1 test grep
+readonly cd readonly && echo /usr/bin local readonly
+		readonly $(pwd) awk "$1" ${HOME} printf x=1
+		| x=1 sed ${HOME} local done test -eu printf
+		-eu grep --verbose then cd "$@" && -eu readonly
+	awk grep awk --verbose -eu test printf
+	awk done 2>/dev/null && -eu sed
+	awk readonly readonly "$@" --verbose -eu sed done grep
+		done grep export -eu printf 'quoted text' then printf readonly cd -eu echo
+'quoted text' readonly done "$1" -eu cd export grep --verbose test printf | /usr/bin
+export test x=1 'quoted text' echo
+$(pwd) export $(pwd) 'quoted text' readonly
+	printf && 2>/dev/null "$@" echo -eu then --verbose echo sed && sed
+	-eu 2>/dev/null echo readonly cd ${HOME} local --verbose | $(pwd) -eu /usr/bin
+"$1" local 'quoted text' grep 2>/dev/null sed echo -eu | sed sed | --verbose "$1"
+--verbose $(pwd) --verbose readonly x=1 grep sed 'quoted text' printf
+	done ${HOME} test x=1 echo
+		awk local grep /usr/bin "$1" 'quoted text' then done ${HOME} then ${HOME} $(pwd)
+	| export | sed ${HOME} local test awk awk x=1 awk 2>/dev/null test
+	--verbose done then then export $(pwd) export readonly then
+	test 'quoted text' "$1" test x=1 cd readonly cd 'quoted text' sed --verbose
+	"$1" 'quoted text' /usr/bin readonly --verbose "$1" 2>/dev/null
+printf local x=1 done "$1" readonly
+	done export local local | readonly done awk -eu awk grep local 'quoted text'
+done 2>/dev/null $(pwd) sed --verbose then x=1 "$1" /usr/bin done awk ${HOME}
+--verbose 'quoted text' --verbose
+		${HOME} 2>/dev/null -eu
+		"$@" "$1" export $(pwd) then ${HOME}
+	grep done local sed "$1" /usr/bin cd x=1 ${HOME}
+		echo 2>/dev/null && $(pwd) done done sed cd x=1 awk printf local 'quoted text'
+2>/dev/null cd | -eu readonly
+		then "$@" readonly test | -eu awk awk awk awk /usr/bin ${HOME}
+--verbose cd $(pwd) then
+$(pwd) 2>/dev/null then then | sed "$1" /usr/bin printf
+		done && 'quoted text' /usr/bin grep export
+	| | ${HOME} ${HOME} && done
+		'quoted text' local 'quoted text'
+| --verbose "$@" ${HOME} local awk 'quoted text'
+	done awk awk awk 2>/dev/null printf -eu --verbose | awk 2>/dev/null
+		-eu local 2>/dev/null --verbose printf then
+		2>/dev/null | readonly ${HOME} --verbose
+	awk cd sed readonly "$1" && test test -eu && readonly then
+	/usr/bin export test printf "$1"
+	| grep export ${HOME}
+	2>/dev/null export echo -eu test awk readonly $(pwd) echo
+	2>/dev/null "$1" --verbose
+	cd test sed --verbose cd 'quoted text' test
+	test done /usr/bin echo "$1" 'quoted text' then grep "$1"
+	export export printf done | test
+	${HOME} ${HOME} readonly
+	printf cd x=1 ${HOME} -eu done test x=1 sed printf
+/usr/bin && export x=1 && test /usr/bin
+	'quoted text' $(pwd) readonly test && /usr/bin "$1" done done cd
+		export -eu --verbose "$@" 'quoted text'
+		awk "$1" export printf local export echo "$@" awk test local test then echo
+		echo done local sed then awk "$@" awk
+then export sed "$1" awk export "$1" test printf ${HOME} then done
+		&& done 'quoted text' && --verbose "$@" readonly awk -eu
+/usr/bin | "$@" && done && && echo -eu "$@" done echo 2>/dev/null /usr/bin |
+	--verbose done --verbose "$1" -eu local export
+	"$@" then sed "$1" test "$1"
+		| then awk 2>/dev/null | && sed echo done
+		${HOME} /usr/bin readonly
+	"$1" $(pwd) /usr/bin awk 2>/dev/null export grep printf --verbose
+'quoted text' echo $(pwd) x=1 | cd "$1" done grep echo | 2>/dev/null
+		local echo ${HOME} /usr/bin awk
+		2>/dev/null done ${HOME} then printf export "$@" cd printf --verbose
+		awk && "$@" echo local done test grep /usr/bin then sed
+cd cd --verbose "$@" then printf readonly sed x=1
+-eu awk -eu "$@" sed readonly x=1 --verbose x=1
+	$(pwd) test cd printf -eu sed
+		local then grep ${HOME} then cd echo 'quoted text' 'quoted text' awk -eu local
+		"$1" -eu "$1" 'quoted text' echo local then done cd $(pwd) ${HOME} export --verbose
+		--verbose | ${HOME} && local -eu test cd done ${HOME} /usr/bin
+done awk awk printf printf x=1 local
+	-eu readonly | ${HOME} --verbose /usr/bin
+"$@" x=1 "$1" echo printf awk printf
+grep cd echo x=1 -eu grep
+grep 2>/dev/null 2>/dev/null sed sed printf printf cd --verbose 2>/dev/null then
+done echo local local /usr/bin cd done done x=1 printf printf awk
+sed x=1 | then local test done sed -eu x=1 local 2>/dev/null then
+2>/dev/null "$@" "$@" printf awk $(pwd) "$1" readonly export ${HOME}
+		test cd export | 2>/dev/null then local readonly -eu readonly | $(pwd)
+	"$@" 'quoted text' -eu
+	done | | && --verbose $(pwd) echo "$1" local done done local 2>/dev/null
+	sed 2>/dev/null 2>/dev/null readonly | $(pwd) 'quoted text' cd
+'quoted text' then "$1" grep --verbose grep
+readonly echo printf "$1" "$1" cd
+local readonly x=1 "$@" && 2>/dev/null $(pwd) ${HOME} cd
+		then test --verbose "$@"
+"$1" 2>/dev/null echo then && cd echo grep awk -eu readonly test sed
+	/usr/bin | printf awk readonly 'quoted text' cd &&
+"$1" -eu local && sed "$@" && local
+-eu && test echo grep
+	grep | then $(pwd) cd ${HOME} $(pwd) cd sed local 2>/dev/null
+		&& grep export grep readonly 2>/dev/null "$@"
+		cd local then "$@" 'quoted text'
+	readonly readonly sed printf | 2>/dev/null x=1 | 'quoted text' local grep
+		printf done printf test
+		/usr/bin readonly printf && cd | && 'quoted text' "$1" echo --verbose
+	/usr/bin then && /usr/bin test echo ${HOME} cd sed x=1 'quoted text' /usr/bin
+printf $(pwd) ${HOME} "$@" 'quoted text' 'quoted text' printf &&
+| awk then 'quoted text' 2>/dev/null
+		awk "$1" $(pwd) grep -eu printf done && x=1 ${HOME} grep &&
+	echo --verbose printf readonly local readonly cd "$@" test test echo
+| echo awk printf $(pwd) printf 2>/dev/null --verbose
+sed && x=1 "$1" local local | 'quoted text'
+"$1" done cd local local done printf printf then --verbose
+	awk sed -eu | 'quoted text' "$@" echo
+		printf /usr/bin printf awk grep local -eu && test echo grep "$1" then
+	x=1 awk /usr/bin readonly 'quoted text' local ${HOME} local test awk 'quoted text'
+		${HOME} /usr/bin | done cd
+local x=1 x=1 "$1" x=1 ${HOME}
+		x=1 local $(pwd) echo local --verbose
+readonly ${HOME} export done --verbose readonly /usr/bin test 'quoted text'
+		x=1 2>/dev/null cd /usr/bin export export then 2>/dev/null 2>/dev/null "$1" x=1
+	/usr/bin 'quoted text' -eu then local 'quoted text' local "$@" printf
+		-eu printf | /usr/bin printf export "$1" export
+	cd "$@" 2>/dev/null local local "$@" /usr/bin
+then sed /usr/bin cd printf
+test echo printf $(pwd) $(pwd) 'quoted text' | ${HOME}
+	"$@" x=1 printf cd x=1 echo 2>/dev/null -eu test "$@" done x=1 'quoted text'
+grep grep x=1 then export readonly printf test --verbose /usr/bin 'quoted text'
+		cd cd done export -eu grep sed test $(pwd) x=1 -eu cd export 2>/dev/null
+cd cd awk /usr/bin 'quoted text' test "$@" "$1" x=1 /usr/bin local awk /usr/bin
+test $(pwd) -eu /usr/bin "$@" local x=1 "$@" "$@" test 2>/dev/null
+local $(pwd) --verbose readonly 'quoted text' readonly local 2>/dev/null
+		-eu awk $(pwd) | 2>/dev/null /usr/bin
+	-eu cd && /usr/bin sed 'quoted text' | readonly export
+	x=1 'quoted text' 2>/dev/null
+cd local /usr/bin sed local readonly export grep
+		"$@" $(pwd) x=1 -eu ${HOME} printf local
+		local $(pwd) | grep | /usr/bin grep 2>/dev/null then printf test
+		-eu grep echo grep cd echo then test ${HOME} awk x=1 --verbose done grep
+	grep x=1 --verbose grep --verbose | grep echo
+		grep "$1" "$@" awk echo ${HOME} ${HOME} $(pwd) 2>/dev/null x=1 ${HOME}
+	/usr/bin awk && awk -eu --verbose
+	${HOME} cd "$@" 'quoted text'
+		"$1" 'quoted text' "$1" /usr/bin local ${HOME} sed 'quoted text' ${HOME}
+		"$1" "$1" grep done local test awk && $(pwd) test "$1"
+#include c185.sh
+	readonly cd 2>/dev/null 'quoted text' sed "$@" "$@" /usr/bin
+echo $(pwd) 'quoted text' local sed
+	local printf grep "$@" echo sed -eu readonly ${HOME} 'quoted text' && "$@" echo
+2>/dev/null local ${HOME} test && ${HOME} sed | sed x=1 2>/dev/null 'quoted text'
+		echo grep awk 'quoted text'
+| export then test -eu echo printf test sed printf
+		${HOME} sed sed --verbose 2>/dev/null then cd grep
+		"$@" 2>/dev/null "$@" export echo | 'quoted text'
+cd "$1" "$1" test test $(pwd)
+local echo test 'quoted text'
+-eu -eu grep done /usr/bin --verbose
+${HOME} export ${HOME} test sed sed echo -eu
+/usr/bin sed ${HOME} && $(pwd) test readonly ${HOME} -eu 2>/dev/null
+	sed 'quoted text' grep --verbose export /usr/bin
+	--verbose -eu "$@" /usr/bin
+		${HOME} -eu printf local $(pwd) | /usr/bin sed cd printf test then "$1" then printf
+	&& printf "$@" "$@" $(pwd) export 'quoted text'
+readonly awk then cd echo -eu && -eu done then && sed local readonly cd | "$@"
+	test --verbose printf local
+		echo "$@" ${HOME} done local done cd 'quoted text'
+	| local echo "$1" "$1"
+	awk x=1 "$1" test 'quoted text' sed
+	"$@" $(pwd) 'quoted text' echo echo -eu "$@" local cd 2>/dev/null -eu
+	sed local done echo $(pwd) | /usr/bin awk x=1 echo local echo test && ${HOME} readonly
+	readonly /usr/bin printf /usr/bin local ${HOME} cd local printf -eu 'quoted text'
+	echo test cd export sed $(pwd)
+test cd export echo -eu echo export /usr/bin export local
+test printf cd grep sed
+	printf awk awk local x=1 "$1" then "$1" 2>/dev/null
+		local x=1 | local "$@" x=1 then
+	2>/dev/null | cd sed 'quoted text' "$@"
+sed x=1 readonly "$1" "$@" | cd /usr/bin 2>/dev/null | ${HOME} printf
+	echo x=1 /usr/bin then cd && --verbose
+awk 'quoted text' then then
+	echo | 2>/dev/null "$1" done local -eu && "$@" /usr/bin /usr/bin 2>/dev/null
+		cd 'quoted text' /usr/bin export
+		-eu done sed echo x=1 local 2>/dev/null
+	'quoted text' sed x=1 | grep 2>/dev/null
+	test done -eu cd printf echo local readonly
+/usr/bin test echo --verbose local /usr/bin then -eu "$@"
+		export ${HOME} -eu grep echo
+	$(pwd) echo printf test
+	cd 2>/dev/null printf /usr/bin cd export test export export /usr/bin "$1" local
+	"$1" $(pwd) && "$1" echo
+	-eu local cd /usr/bin -eu "$@" sed sed done $(pwd) sed 2>/dev/null ${HOME}
+	done --verbose grep $(pwd) -eu awk grep && sed then done then printf
+"$@" echo done x=1 "$1" export
+"$@" && echo ${HOME} ${HOME} 2>/dev/null
+	| | -eu echo x=1 /usr/bin done | printf x=1 sed grep test ${HOME} printf then
+export /usr/bin 'quoted text' --verbose x=1 awk
+		| $(pwd) 2>/dev/null test
+local "$@" | && then --verbose printf "$@" local
+"$@" -eu then /usr/bin && echo ${HOME} readonly /usr/bin
+		test export -eu cd "$1" "$@" local 'quoted text'
+cd done local $(pwd) 'quoted text'
+		local "$@" ${HOME} echo ${HOME} ${HOME} --verbose test readonly
+		x=1 $(pwd) "$@" test echo readonly $(pwd) printf && $(pwd) awk
+"$@" && "$@" ${HOME} "$@" local echo sed --verbose
+2>/dev/null done cd awk /usr/bin /usr/bin 2>/dev/null | ${HOME} /usr/bin -eu /usr/bin
+		&& /usr/bin grep awk x=1 awk 'quoted text'
+		$(pwd) && "$1" "$1" "$@" awk cd --verbose ${HOME} printf export
+sed export "$@" "$1" export "$@" grep grep
+	export x=1 x=1 && "$1" echo sed /usr/bin done "$1" "$1"
+-eu x=1 /usr/bin grep awk "$1" awk sed | test
+--verbose echo | printf sed --verbose
+		&& awk awk grep $(pwd) done sed | | local
+		| awk && echo printf /usr/bin --verbose
+		$(pwd) export /usr/bin awk 'quoted text' done then cd printf test ${HOME}
+		${HOME} awk then --verbose awk grep && then export
+	$(pwd) /usr/bin printf export ${HOME} local printf echo sed cd grep echo $(pwd)
+		2>/dev/null x=1 readonly -eu test && $(pwd)
+		${HOME} awk 2>/dev/null --verbose readonly sed --verbose sed "$@" export ${HOME}
+sed grep "$1" ${HOME} cd ${HOME} sed 'quoted text' test -eu
+		sed cd | ${HOME} "$@" local echo sed readonly && 'quoted text'
+	"$1" grep echo -eu then echo
+		'quoted text' sed done && test --verbose ${HOME} cd
+'quoted text' /usr/bin ${HOME} ${HOME} then "$@" export
+	${HOME} test cd --verbose "$1" done "$1" 2>/dev/null 2>/dev/null && then
+		/usr/bin cd cd echo sed | x=1 local done then ${HOME} --verbose -eu cd ${HOME} /usr/bin
+	2>/dev/null then x=1
+	done 'quoted text' sed grep sed grep
+${HOME} | | && export /usr/bin readonly /usr/bin done 2>/dev/null
+		2>/dev/null readonly "$1" | cd local awk | sed sed export
+test x=1 --verbose "$@" && "$@" readonly && "$@" test then && /usr/bin ${HOME}
+		"$1" $(pwd) readonly cd x=1 awk awk -eu x=1 local awk 'quoted text' grep echo then
+		echo awk grep grep then then sed local | echo -eu
+	then ${HOME} x=1 ${HOME} && then done test "$1" --verbose
+cd && done 2>/dev/null printf then grep test then then then
+test x=1 sed done | test 'quoted text'
+	sed then $(pwd) $(pwd)
+	export printf local readonly awk 2>/dev/null -eu printf printf
+		done local readonly done test sed --verbose printf ${HOME}
+	-eu cd test echo test echo $(pwd) /usr/bin grep /usr/bin done 'quoted text'
+&& readonly export local printf && grep --verbose
+		&& && --verbose --verbose 'quoted text' "$1" $(pwd)
+	"$@" export readonly cd && export
+		"$1" sed local then --verbose "$@" echo grep x=1 printf readonly
+	&& done then then grep "$1" export 'quoted text'
+		grep "$1" | ${HOME} cd grep /usr/bin "$@" export && test 'quoted text'
+test 2>/dev/null -eu readonly sed ${HOME}
+2>/dev/null echo | printf awk done ${HOME} test $(pwd)
+/usr/bin cd echo x=1 awk local
+x=1 $(pwd) "$@" --verbose done local printf --verbose
+echo --verbose 2>/dev/null echo x=1 --verbose /usr/bin | 2>/dev/null
+x=1 local sed export -eu 'quoted text' export cd 2>/dev/null x=1 -eu grep
+	x=1 awk "$@" | ${HOME} -eu printf
+		'quoted text' then test echo local 2>/dev/null awk && cd grep $(pwd)
+	then echo sed $(pwd) -eu --verbose readonly -eu
+		$(pwd) && readonly export export --verbose --verbose "$@" "$@" awk grep
+		"$@" && export /usr/bin test export $(pwd)
+/usr/bin "$1" --verbose | | ${HOME} grep awk cd --verbose 2>/dev/null
+		readonly awk printf && cd "$1"
+readonly readonly done /usr/bin done grep 'quoted text'
+readonly --verbose "$1" echo cd done echo
+$(pwd) done | echo /usr/bin $(pwd)
+		'quoted text' then echo --verbose /usr/bin awk readonly
+		-eu awk readonly x=1 | "$@"
+		printf /usr/bin && done printf local cd /usr/bin ${HOME} $(pwd)
+-eu export /usr/bin $(pwd) readonly $(pwd) local sed done local --verbose
+	--verbose 'quoted text' echo --verbose readonly ${HOME} export
+		done /usr/bin grep "$@" 2>/dev/null
+		&& ${HOME} grep 'quoted text'
+	"$@" ${HOME} readonly ${HOME} ${HOME}
+/usr/bin | | $(pwd) local && ${HOME}
+x=1 readonly test 2>/dev/null readonly | cd --verbose awk 2>/dev/null
+	"$1" /usr/bin | then done -eu 2>/dev/null /usr/bin then -eu cd readonly
+	grep "$@" test "$1" grep
+		| echo awk sed grep printf grep
+sed $(pwd) export readonly
+		local x=1 x=1 "$1" printf -eu then /usr/bin awk x=1 "$1"
+		$(pwd) readonly test cd export then -eu grep done local readonly
+	cd $(pwd) ${HOME} sed -eu 'quoted text' export export
+		--verbose then echo sed ${HOME} --verbose
+printf test "$@" && readonly ${HOME} readonly 2>/dev/null && cd sed x=1
+"$1" /usr/bin cd ${HOME} "$@" x=1 grep awk sed readonly "$1"
+&& grep | grep 2>/dev/null done x=1 sed then test --verbose grep
+echo $(pwd) local ${HOME}
+		cd --verbose echo /usr/bin local readonly "$1" 'quoted text'
+2>/dev/null echo --verbose "$@" printf done
+		export "$1" cd awk test 2>/dev/null 'quoted text' test 'quoted text'
+	"$1" cd 2>/dev/null test then x=1 && && 'quoted text'
+local grep 'quoted text' x=1
+		grep done echo then && "$@" export local "$1" done grep x=1 /usr/bin local x=1
+		$(pwd) echo sed echo x=1 | sed printf echo
+		| /usr/bin done "$1" then 'quoted text'
+	"$1" "$@" awk test done ${HOME} cd export ${HOME} "$@" "$1" 2>/dev/null grep
+"$@" /usr/bin --verbose printf &&
+		| | $(pwd) test 2>/dev/null
+	/usr/bin export $(pwd) --verbose
+	echo then printf && printf --verbose echo
+	printf local ${HOME} 2>/dev/null 'quoted text'
+-eu "$1" sed && grep cd "$1" printf |
+	x=1 done done sed x=1 2>/dev/null /usr/bin
+then printf 'quoted text' cd awk
+	export "$1" -eu $(pwd) | local
+&& awk $(pwd) test /usr/bin awk | then echo 'quoted text'
+		$(pwd) awk then sed "$1" /usr/bin ${HOME} echo awk --verbose x=1
+	'quoted text' echo readonly
+then 2>/dev/null --verbose && --verbose cd 'quoted text'
+&& "$1" 'quoted text' 2>/dev/null && sed
+"$1" /usr/bin local then 'quoted text' /usr/bin
+	/usr/bin test | sed | then test awk printf echo grep grep 2>/dev/null then printf
+"$1" echo && printf done awk sed
+		printf readonly /usr/bin --verbose readonly x=1 --verbose
+	"$@" 'quoted text' awk "$@" "$@" x=1 cd $(pwd) x=1 ${HOME} then $(pwd)
+	$(pwd) done && export export cd 'quoted text'
+		echo "$1" --verbose && sed readonly grep done then | local && awk
+	printf test x=1 -eu --verbose | "$@" echo printf cd printf
+	&& "$1" && x=1 "$@" -eu
+x=1 test --verbose grep 'quoted text' x=1
+		cd /usr/bin then "$1" export -eu export then "$1" x=1 x=1 "$1" /usr/bin then
+		2>/dev/null 'quoted text' | cd readonly "$1" "$1" 'quoted text' "$@" --verbose
+	/usr/bin grep local /usr/bin
+	cd local x=1 done printf sed local -eu test local /usr/bin -eu echo test
+		"$@" printf ${HOME} 'quoted text' then done 'quoted text' $(pwd) sed export
+local echo && "$@" then /usr/bin | cd
+test | grep then export && 'quoted text' echo "$@"
+		printf && | 2>/dev/null 2>/dev/null done -eu sed x=1 2>/dev/null 2>/dev/null grep
+--verbose 2>/dev/null then echo "$1" printf
+	| "$@" grep -eu local $(pwd) 2>/dev/null "$@" | 2>/dev/null --verbose
+		then export test sed --verbose local printf cd readonly
+sed awk ${HOME} "$1" ${HOME} grep -eu cd --verbose readonly --verbose
+	export echo 'quoted text' | && done export x=1 done ${HOME} printf && -eu
+	export grep printf && && grep grep readonly $(pwd) done 'quoted text' cd
+	-eu ${HOME} readonly 2>/dev/null /usr/bin export
+	"$1" printf done x=1 test ${HOME} export ${HOME} echo ${HOME}
+	echo ${HOME} ${HOME} -eu
+		"$1" sed awk | $(pwd) /usr/bin
+2>/dev/null "$1" -eu $(pwd) "$1" && then "$@" local "$@" -eu local
+test sed 'quoted text' awk &&
+readonly --verbose $(pwd) | && grep $(pwd) local 'quoted text'
+awk ${HOME} printf x=1 done grep 2>/dev/null /usr/bin then awk readonly && printf
+	then grep && awk ${HOME} -eu && $(pwd) echo grep x=1 -eu --verbose && 'quoted text'
+		${HOME} ${HOME} printf "$1" --verbose --verbose $(pwd) 'quoted text' sed
+"$1" "$1" awk 'quoted text' | grep --verbose
+		2>/dev/null $(pwd) printf sed local ${HOME} /usr/bin sed printf local grep printf
+	done printf printf /usr/bin grep --verbose printf x=1 "$@" "$1" ${HOME}
+"$1" "$1" then ${HOME} echo $(pwd)
+		$(pwd) cd cd /usr/bin local test 2>/dev/null awk x=1 "$@" printf ${HOME} grep |
+/usr/bin -eu "$@" done --verbose
+		sed export /usr/bin done
+		echo readonly readonly local $(pwd) local echo then /usr/bin cd | done
+"$@" && ${HOME} $(pwd) x=1 done
+then "$@" readonly local "$@" "$@" grep ${HOME} cd readonly 'quoted text'
+readonly "$@" -eu export "$1" $(pwd) export grep 2>/dev/null printf sed grep then
+		then sed x=1 x=1 "$@" $(pwd) export
+		readonly awk local printf cd grep sed "$@" &&
+	grep export -eu test then /usr/bin
+echo awk ${HOME} "$@" then /usr/bin ${HOME} readonly printf echo
+then $(pwd) then grep "$1" x=1 grep export grep 2>/dev/null /usr/bin
+	$(pwd) grep && awk --verbose test test /usr/bin local
+	cd cd then x=1 export awk printf && --verbose test
+export test sed then -eu 'quoted text'
+		cd ${HOME} "$1" | 'quoted text' -eu 2>/dev/null
+		cd then cd done echo awk
+$(pwd) cd x=1 && "$@" -eu readonly test 2>/dev/null done done
+		-eu ${HOME} /usr/bin then && | printf readonly readonly printf awk test awk /usr/bin
+		"$1" readonly 2>/dev/null 'quoted text'
+$(pwd) export test $(pwd) "$1" | then then cd done
+	sed then export "$1" printf
+readonly printf sed /usr/bin sed /usr/bin local done echo then 2>/dev/null
+		$(pwd) then local sed done $(pwd) readonly "$1"
+		2>/dev/null local "$1" && echo "$1" -eu /usr/bin $(pwd) export
+sed sed done printf printf 2>/dev/null /usr/bin 'quoted text'
+	| test done x=1 ${HOME} 'quoted text'
+		cd done echo done 2>/dev/null then sed /usr/bin echo sed /usr/bin test cd printf
+readonly export 'quoted text' x=1 "$1"
+test x=1 ${HOME} test ${HOME} && then local grep 2>/dev/null ${HOME} printf
+done 'quoted text' && x=1 awk
+	$(pwd) 'quoted text' 2>/dev/null done
+	echo readonly --verbose && /usr/bin | --verbose
+		awk $(pwd) grep && test "$@" grep test
+		2>/dev/null -eu --verbose 'quoted text'
+	| awk awk $(pwd) test 'quoted text' test
+export then then test cd grep /usr/bin
+		then cd x=1 && 'quoted text' 'quoted text' && && && done
+done sed awk printf sed "$@" test awk | 'quoted text' 2>/dev/null sed
+	${HOME} local echo -eu then ${HOME} test
+2>/dev/null --verbose
+&& "$1" --verbose readonly /usr/bin echo
+	cd grep --verbose local -eu | export echo sed local
+export --verbose grep "$1" echo export "$@" 2>/dev/null readonly done
+export local test "$1" "$@" grep
+'quoted text' && echo then | | 2>/dev/null awk grep awk printf
+		| -eu cd cd echo cd sed done 'quoted text'
+		export && done export ${HOME} $(pwd) export echo x=1 done -eu test --verbose /usr/bin
+grep echo then --verbose && printf sed x=1 echo test
+	awk $(pwd) 'quoted text' 2>/dev/null done "$@" printf export
+| x=1 -eu "$1" x=1 /usr/bin awk x=1 && done export && echo export then
+-eu --verbose awk printf then
+		local ${HOME} && 2>/dev/null /usr/bin then "$@" x=1 $(pwd) test grep echo &&
+&& 2>/dev/null then && cd grep cd export then
+	grep x=1 grep --verbose test sed -eu done
+	grep 2>/dev/null awk printf local x=1
+		$(pwd) export grep "$@" then && awk && $(pwd) /usr/bin -eu -eu
+	cd --verbose --verbose ${HOME} cd -eu done "$@" "$1" local
+/usr/bin test $(pwd) printf 'quoted text' x=1 local test readonly x=1 then readonly
+local cd | | echo 2>/dev/null /usr/bin | echo | then done echo -eu grep local
+		export cd -eu "$@" ${HOME} && "$1" grep grep grep 2>/dev/null
+	cd | /usr/bin -eu then grep "$@" -eu ${HOME} sed ${HOME} done $(pwd) 'quoted text'
+-eu /usr/bin /usr/bin awk $(pwd) test then echo printf sed && echo
+		test cd sed export -eu && 'quoted text'
+	2>/dev/null done && "$@"
+		cd sed cd ${HOME} | ${HOME} "$1" grep readonly /usr/bin 2>/dev/null x=1
+readonly awk -eu x=1 -eu export done test awk sed awk &&
+&& -eu local /usr/bin printf $(pwd) 2>/dev/null -eu ${HOME} printf done local
+		/usr/bin then grep then export printf
+	-eu readonly readonly local cd | -eu 'quoted text'
+		x=1 export "$@" grep && awk /usr/bin "$@" --verbose done /usr/bin
+${HOME} readonly x=1 'quoted text' -eu 2>/dev/null ${HOME}
+$(pwd) cd echo printf printf done readonly export local export 'quoted text'
+awk grep $(pwd) test 'quoted text' sed cd cd export test 2>/dev/null sed
+	sed readonly export && ${HOME} sed && ${HOME} --verbose export ${HOME} 2>/dev/null
+		sed | ${HOME} --verbose grep sed
+| 'quoted text' test 'quoted text' readonly done 'quoted text'
+export echo awk /usr/bin && readonly --verbose echo test printf grep readonly awk
+sed --verbose -eu echo export cd && cd ${HOME} sed then then &&
+	local then ${HOME} grep sed ${HOME} grep && ${HOME} 'quoted text'
+		-eu cd echo local sed /usr/bin cd 2>/dev/null
+		-eu grep --verbose awk | "$@" cd --verbose x=1
+export | -eu ${HOME} x=1 export | | | test done ${HOME} /usr/bin --verbose
+		/usr/bin 2>/dev/null $(pwd) then /usr/bin /usr/bin $(pwd) sed -eu then
+	export --verbose $(pwd) printf done awk && -eu readonly awk "$@" test local | export
+	'quoted text' 2>/dev/null && --verbose "$1"
+then local 2>/dev/null cd --verbose grep readonly && $(pwd) awk printf 'quoted text'
+		grep export && --verbose "$1" ${HOME} "$1"
+		2>/dev/null grep done done
+"$@" -eu export readonly local
+		"$1" readonly readonly "$@" awk test printf then x=1 test
+	export then x=1 then $(pwd) $(pwd)
+	sed cd sed echo cd && readonly sed x=1 $(pwd)
+local -eu -eu local 'quoted text' /usr/bin sed cd ${HOME}
+		then then $(pwd) && printf printf $(pwd) --verbose && readonly
+	2>/dev/null "$@" local "$1" x=1 test grep sed grep grep x=1 && export
+	&& echo --verbose 'quoted text'
+		local awk "$@" test | readonly
+grep /usr/bin /usr/bin awk awk 2>/dev/null export -eu export readonly
+	test "$@" "$1" 2>/dev/null 'quoted text' local
+export printf awk then $(pwd) done done && then local awk done printf "$1"
+		awk ${HOME} --verbose -eu x=1 grep x=1 "$1" &&
+	-eu sed 'quoted text' echo then && "$@" $(pwd) sed
+${HOME} export $(pwd) cd $(pwd) --verbose x=1
+	"$@" 'quoted text' local sed test then export $(pwd) then
+	$(pwd) "$@" | | grep grep echo "$@" | printf export
+		then $(pwd) printf test $(pwd)
+	/usr/bin | then /usr/bin sed done cd 2>/dev/null
+		printf sed grep test readonly 2>/dev/null "$1"
+export x=1 done x=1 echo ${HOME} --verbose x=1 printf test local | $(pwd)
+| then cd sed grep export grep export $(pwd) sed readonly
+	cd echo --verbose done awk local --verbose grep && grep --verbose 'quoted text'
+"$1" grep "$@" then | x=1 export done
+		$(pwd) 2>/dev/null $(pwd) "$1" ${HOME} printf x=1
+cd export then sed local x=1 then ${HOME}
+--verbose 2>/dev/null local cd /usr/bin && cd && "$1" then readonly
+	"$@" awk 2>/dev/null 'quoted text' echo ${HOME} "$1"
+	/usr/bin x=1 readonly x=1 2>/dev/null
+		readonly test export printf readonly grep --verbose -eu --verbose "$1" 'quoted text'
+x=1 test 'quoted text'
+-eu | -eu cd echo done /usr/bin readonly
+sed "$@" printf /usr/bin
+	export test echo awk -eu $(pwd) ${HOME} export test echo
+	awk then done 'quoted text' printf
+printf cd echo 'quoted text' --verbose 'quoted text' sed echo
+readonly $(pwd) echo then cd "$@" $(pwd) -eu local printf readonly
+$(pwd) && 'quoted text' cd "$1" awk $(pwd) echo "$@" $(pwd) 2>/dev/null export
+		--verbose awk then echo 2>/dev/null
+2>/dev/null printf && grep | done "$1" -eu done export readonly done
+	| --verbose && then sed sed readonly readonly
+		"$1" 'quoted text' "$@" "$@" grep ${HOME} cd 2>/dev/null printf
+		&& --verbose awk | echo $(pwd)
+$(pwd) done -eu | | done ${HOME}
+		| "$@" /usr/bin --verbose && 'quoted text' awk local awk sed cd --verbose
+		$(pwd) | ${HOME} awk $(pwd) awk sed | test grep -eu x=1 local -eu test local
+	grep test then grep then done
+/usr/bin readonly --verbose "$1" /usr/bin 'quoted text' grep test
+		2>/dev/null 'quoted text' readonly -eu --verbose && echo ${HOME} grep
+"$@" grep echo sed ${HOME} "$@" x=1 2>/dev/null /usr/bin "$@"
+		--verbose -eu $(pwd) "$1" "$@" | $(pwd)
+	-eu echo x=1 grep echo && cd /usr/bin test then printf grep /usr/bin 2>/dev/null
+	readonly && && local printf cd --verbose export echo x=1
+		-eu "$1" printf | test done export sed | echo local awk done "$1" grep "$1" awk
+	local printf 2>/dev/null export 'quoted text' sed "$@" x=1
+	&& /usr/bin grep | export $(pwd) 2>/dev/null
+	-eu local then readonly && cd | x=1 'quoted text'
+	x=1 $(pwd) printf 'quoted text' test 2>/dev/null "$@" readonly
+printf 2>/dev/null printf x=1 "$@" 2>/dev/null readonly "$@" local awk
+	export "$@" --verbose then "$1" "$1" test awk cd test -eu then test "$@"
+	local export $(pwd) printf local -eu
+cd /usr/bin -eu && cd cd 2>/dev/null 2>/dev/null "$1" "$1" test
+		x=1 cd ${HOME} --verbose |
+x=1 echo grep x=1 -eu "$@" cd -eu awk sed && ${HOME} $(pwd) echo then
+"$@" test /usr/bin "$1" export grep -eu readonly readonly 'quoted text' "$@"
+export test test "$@" readonly /usr/bin echo "$@" cd echo readonly 'quoted text'
+	$(pwd) sed test done 2>/dev/null readonly | --verbose && awk "$1" awk test && &&
+	export $(pwd) sed grep grep "$1" 2>/dev/null
+	then -eu printf 2>/dev/null |
+	sed /usr/bin $(pwd) done echo -eu sed grep cd x=1 $(pwd) export export
+'quoted text' readonly --verbose
+		-eu test echo "$1" "$@" --verbose --verbose
+		local then printf cd echo 'quoted text' && local
+&& -eu echo x=1 printf -eu readonly /usr/bin x=1 "$@"
+		grep $(pwd) --verbose echo cd local sed
+"$@" export /usr/bin printf printf readonly done --verbose
+"$1" test sed --verbose
+"$1" $(pwd) cd ${HOME} grep
+		local awk export grep grep
+	&& then && echo -eu "$1" 'quoted text' && echo grep readonly --verbose ${HOME}
+		/usr/bin done -eu test echo "$@" awk cd && cd 'quoted text' 'quoted text' "$@"
+export ${HOME} -eu && local "$1" "$@" grep | local ${HOME} awk $(pwd) cd
+	then test $(pwd) sed -eu export test then readonly readonly
+-eu $(pwd) /usr/bin | $(pwd)
+		local cd local ${HOME} then cd readonly then | ${HOME} $(pwd) /usr/bin printf
+		printf then test awk awk local | "$1" 2>/dev/null sed done local
+	--verbose sed | sed && 2>/dev/null /usr/bin
+		${HOME} test readonly echo export test local /usr/bin && done -eu local
+		&& readonly readonly "$@" export sed
+		then -eu test export awk local ${HOME} $(pwd) awk printf $(pwd) sed
+		x=1 "$@" "$@" 'quoted text' | "$@"
+		$(pwd) cd "$@" printf
+printf done cd local 'quoted text' --verbose echo
+	${HOME} $(pwd) | grep 'quoted text' export done $(pwd) &&
+		$(pwd) grep 'quoted text'
+	then "$1" "$@" ${HOME} --verbose test test 'quoted text'
+	| sed && grep printf local awk -eu readonly cd "$1" grep grep echo awk
+		echo local printf local | | $(pwd) 2>/dev/null readonly -eu "$@" echo
+	/usr/bin printf readonly "$@" awk 2>/dev/null done printf 2>/dev/null
+--verbose -eu && export done x=1 &&
+"$1" sed cd printf readonly done local cd 'quoted text' x=1 echo
+		-eu 'quoted text' sed cd -eu && ${HOME} sed printf then
+		awk echo --verbose && export "$1" | grep echo "$1" $(pwd) cd local --verbose "$@"
+&& cd 'quoted text' "$1" local /usr/bin sed
+$(pwd) export x=1 local done 'quoted text'
+		readonly sed test $(pwd) --verbose
+	$(pwd) sed readonly "$1" done export x=1 readonly 'quoted text' awk printf
+		test export cd /usr/bin
+	$(pwd) grep sed "$@" sed sed echo printf grep export cd "$@" sed "$@"
+		"$@" 2>/dev/null | echo export --verbose ${HOME}
+2>/dev/null $(pwd) ${HOME} --verbose "$1" awk then printf ${HOME} test
+		echo then -eu 2>/dev/null ${HOME} sed -eu test --verbose --verbose
+		/usr/bin done -eu 'quoted text' sed awk awk $(pwd) export x=1 readonly
+		local $(pwd) sed "$@" test grep done echo done
+	"$@" /usr/bin echo --verbose --verbose printf && "$@" ${HOME} |
+		done echo readonly x=1 && --verbose done ${HOME} 'quoted text'
+	awk echo echo test then 'quoted text'
+test 2>/dev/null "$1" echo cd $(pwd) then awk awk echo cd
+	/usr/bin printf && --verbose
+	test 2>/dev/null printf "$1" printf "$@" --verbose
+	&& && $(pwd) printf grep "$@" /usr/bin 2>/dev/null echo
+	"$1" sed $(pwd) --verbose then /usr/bin test x=1 readonly printf printf
+		$(pwd) local local /usr/bin local 'quoted text' ${HOME} then awk /usr/bin
+	sed && local local "$@" | ${HOME} grep
+	| sed cd grep then x=1 awk readonly /usr/bin grep | $(pwd)
+		${HOME} done && test -eu 2>/dev/null
+	&& test test | | "$@" "$1" $(pwd) readonly awk cd
+readonly printf 2>/dev/null && 'quoted text' grep awk local "$@" cd awk --verbose
+2>/dev/null local done | "$1"
+		$(pwd) | -eu "$1" x=1 printf --verbose 'quoted text' &&
+		$(pwd) awk then x=1 /usr/bin printf test echo local --verbose /usr/bin readonly
+then "$@" echo cd | then $(pwd) x=1 'quoted text' | cd --verbose awk x=1 readonly
+		-eu export $(pwd) test readonly sed local "$@" awk 'quoted text' 'quoted text'
+		--verbose local readonly awk ${HOME} test
+		done ${HOME} echo && --verbose sed 'quoted text'
+		local 2>/dev/null $(pwd) 2>/dev/null echo echo awk
+		test -eu | "$1" cd x=1 grep /usr/bin && echo $(pwd) export 'quoted text'
+readonly sed then && x=1
+		--verbose done "$1" grep local sed ${HOME} awk cd grep /usr/bin "$1"
+		awk $(pwd) -eu --verbose /usr/bin --verbose && 2>/dev/null test $(pwd) -eu
+	grep x=1 awk readonly readonly awk local sed 2>/dev/null then "$@" -eu x=1 cd
+		/usr/bin 2>/dev/null export export
+	--verbose then && then done export done && echo
+	-eu /usr/bin --verbose sed $(pwd)
+	--verbose export "$@" "$1"
+	local then sed awk then printf sed readonly ${HOME} x=1 x=1 cd local
+	'quoted text' sed printf awk | done local awk
+		${HOME} then awk echo "$1" "$1"
+	x=1 export 2>/dev/null grep printf printf done local 'quoted text'
+		readonly cd | $(pwd) "$@"
+	x=1 --verbose echo 2>/dev/null 'quoted text' "$@" "$@" readonly
+readonly 'quoted text' local -eu export "$1" sed
+		echo local sed x=1 --verbose echo test
+	then grep 'quoted text'
+	grep echo -eu readonly "$1" export x=1 x=1 /usr/bin /usr/bin local echo
+"$1" then "$@" done local 2>/dev/null
+		2>/dev/null cd --verbose /usr/bin --verbose 'quoted text'
+then ${HOME} then ${HOME} /usr/bin cd echo sed then 'quoted text' grep awk
+		grep && "$1" ${HOME} test && awk /usr/bin ${HOME} /usr/bin "$1"
+		| --verbose --verbose | /usr/bin readonly cd done grep export done
+cd sed sed --verbose | echo 2>/dev/null && sed sed 'quoted text'
+	test test /usr/bin x=1 $(pwd) "$@" x=1 test ${HOME} then -eu readonly
+	&& awk "$1" 2>/dev/null "$1" then
+	grep "$1" export ${HOME} | && | sed | cd /usr/bin export
+		"$@" | --verbose awk -eu x=1 $(pwd) awk $(pwd) $(pwd) sed awk test awk
+export sed local x=1 ${HOME}
+readonly then x=1 && cd
+&& then | cd sed --verbose awk sed printf
+	-eu readonly sed readonly
+	"$1" /usr/bin grep -eu
+sed then "$1" sed grep /usr/bin sed /usr/bin done printf --verbose then
+		-eu x=1 ${HOME} 'quoted text' awk export x=1 $(pwd)
+&& printf && awk test 2>/dev/null cd cd 'quoted text'
+	$(pwd) export | $(pwd) $(pwd) awk awk readonly 'quoted text' -eu grep -eu test
+		awk cd cd test export sed awk
+	"$1" 'quoted text' awk "$@" test "$1" printf "$1" test
+then x=1 test $(pwd) readonly
+"$@" readonly local 'quoted text' cd local
+		"$@" grep "$1" grep test readonly 2>/dev/null done 2>/dev/null
+&& /usr/bin --verbose printf /usr/bin
+		sed --verbose readonly echo -eu then awk
+echo echo x=1 cd echo -eu sed readonly cd ${HOME} sed echo "$1" done awk
+		"$@" x=1 "$1" cd 2>/dev/null
+--verbose cd --verbose 'quoted text' --verbose then ${HOME}
+2>/dev/null "$1" "$1" sed then local printf
+	export export "$1" awk "$1" 'quoted text' cd awk grep -eu local
+		awk readonly /usr/bin
+$(pwd) x=1 "$1" export export && grep && test readonly grep
+grep grep "$@" grep && "$1" "$1" $(pwd) 2>/dev/null $(pwd) ${HOME}
+		test echo awk awk "$1" echo $(pwd) then readonly export then
+export /usr/bin local done | "$1" cd /usr/bin
+	${HOME} | grep $(pwd) && ${HOME} done sed cd --verbose
+		sed awk ${HOME} | ${HOME} test test export $(pwd) -eu 'quoted text' ${HOME}
+readonly /usr/bin done grep --verbose cd x=1 && printf
+	$(pwd) echo sed | done ${HOME} cd done echo | ${HOME} -eu export
+&& "$@" "$1" 2>/dev/null
+		-eu && 2>/dev/null grep grep && 2>/dev/null printf | -eu
+	printf ${HOME} --verbose export $(pwd) readonly readonly then cd local
+	'quoted text' | "$1" done
+		echo /usr/bin grep export sed | ${HOME} "$1" printf then -eu --verbose test
+		| x=1 ${HOME} readonly test sed then "$1" local sed | 2>/dev/null
+-eu then export -eu "$1" awk sed | grep && && $(pwd)
+		readonly /usr/bin /usr/bin 'quoted text' ${HOME}
+		| export -eu x=1 /usr/bin ${HOME} "$1" done 2>/dev/null test 'quoted text'
+		printf readonly export --verbose -eu echo -eu grep ${HOME} then /usr/bin printf
+"$@" "$@" "$1" x=1 readonly 2>/dev/null
+	sed readonly echo "$1" -eu x=1 then readonly
+		${HOME} then $(pwd) 2>/dev/null test $(pwd) "$1" -eu $(pwd)
+| "$1" cd test x=1 cd /usr/bin x=1 x=1 2>/dev/null echo -eu 'quoted text'
+printf && ${HOME} "$@" && local $(pwd) cd
+		| then sed 'quoted text' awk "$@" x=1
+	$(pwd) awk x=1 'quoted text' "$@" local -eu sed done
+	test printf && && $(pwd) readonly printf printf
+	then export ${HOME} | $(pwd) printf done done sed grep 2>/dev/null
+&& --verbose sed /usr/bin export readonly
+		/usr/bin /usr/bin test | grep done ${HOME} $(pwd) sed 'quoted text' /usr/bin
+| 'quoted text' -eu -eu printf local "$1" done cd $(pwd) test cd
+	${HOME} done printf $(pwd) | awk local "$1"
+done 'quoted text' --verbose local local ${HOME}
+		printf "$@" -eu cd ${HOME} -eu printf ${HOME} && sed grep test /usr/bin /usr/bin
+	x=1 $(pwd) export done $(pwd)
+	"$1" -eu 2>/dev/null /usr/bin
+		readonly ${HOME} test then && printf local grep $(pwd) done export
+then then grep done grep local ${HOME}
+test test && grep x=1 local | 'quoted text' cd x=1 -eu grep -eu sed
+		"$1" test "$@" local --verbose &&
+		test $(pwd) cd $(pwd) awk --verbose awk x=1 --verbose then "$1" /usr/bin
+readonly --verbose test && grep grep
+	/usr/bin export echo awk "$1" echo x=1 export
+echo /usr/bin readonly && | -eu --verbose x=1 ${HOME} export
+export "$@" | /usr/bin sed ${HOME} echo $(pwd) -eu "$1" "$@"
+"$@" done awk printf done done 2>/dev/null /usr/bin
+	export then readonly grep local && 2>/dev/null
+	grep cd done cd echo export export | ${HOME} "$1" /usr/bin grep $(pwd) grep
+export -eu local /usr/bin x=1 /usr/bin printf 'quoted text' "$@" echo
+		/usr/bin "$1" -eu 'quoted text' 'quoted text' /usr/bin
+		readonly 'quoted text' echo
+		local printf 2>/dev/null
+	local printf echo echo $(pwd) $(pwd) --verbose done 2>/dev/null
+-eu awk -eu export ${HOME} x=1 printf readonly 2>/dev/null printf
+/usr/bin awk echo 'quoted text' test printf -eu 2>/dev/null x=1 2>/dev/null
+	awk sed echo --verbose awk "$1" grep "$1"
+		readonly ${HOME} cd cd "$@" test readonly done "$1" 2>/dev/null
+		x=1 then export "$@" x=1 echo 'quoted text' "$@" awk "$@" $(pwd) /usr/bin
+		x=1 "$@" local "$1" cd x=1 $(pwd) grep echo printf "$1" ${HOME} ${HOME} echo
+&& cd export sed && | "$1" sed local -eu
+	x=1 then | $(pwd) -eu $(pwd) "$1" cd $(pwd)
+2>/dev/null local then export printf 2>/dev/null
+		printf awk x=1 -eu test 'quoted text' && $(pwd) | && awk echo "$1" --verbose $(pwd)
+		awk $(pwd) -eu "$@" awk echo 'quoted text' $(pwd) cd /usr/bin
+		'quoted text' x=1 "$@" readonly ${HOME} 'quoted text' ${HOME} "$1" echo then |
+		| readonly sed then --verbose --verbose $(pwd) && export then
+		cd --verbose test 'quoted text' done test printf 'quoted text' x=1
+		test ${HOME} readonly ${HOME} 'quoted text' echo grep ${HOME} ${HOME} --verbose
+"$1" $(pwd) cd local "$@" 'quoted text' 2>/dev/null
+		echo /usr/bin local ${HOME} sed 2>/dev/null x=1 "$@"
+echo grep ${HOME} export && "$1" then awk $(pwd)
+	$(pwd) | ${HOME} --verbose
+awk -eu -eu ${HOME} export
+	printf "$1" export /usr/bin
+		/usr/bin | x=1 test readonly cd local done awk ${HOME} "$@" -eu
+cd printf --verbose test 'quoted text' 'quoted text' awk export cd echo --verbose
+	local printf ${HOME} test ${HOME} done awk x=1 grep ${HOME}
+		printf then /usr/bin 'quoted text' ${HOME} export echo 'quoted text' $(pwd)
+		&& done cd /usr/bin $(pwd) ${HOME} --verbose "$@" printf ${HOME} echo
+	x=1 done done cd awk done cd $(pwd) cd $(pwd) test cd 'quoted text'
+cd x=1 'quoted text' export --verbose && grep $(pwd) 2>/dev/null done
+	"$@" readonly 'quoted text'
+cd printf $(pwd) grep export sed | 'quoted text' ${HOME} grep x=1 cd export
+	local && export awk 'quoted text' $(pwd) -eu done /usr/bin
+awk 2>/dev/null x=1 -eu export -eu x=1 ${HOME} 'quoted text' 2>/dev/null echo
+		$(pwd) sed -eu && test cd && $(pwd)
+	$(pwd) x=1 test awk awk
+	"$1" sed grep test -eu 'quoted text' -eu done awk echo
+		echo sed 'quoted text' "$1" grep sed && ${HOME}
+	printf printf sed local cd awk export && --verbose
+| done ${HOME} /usr/bin /usr/bin
+		grep -eu 2>/dev/null awk
+then && | done readonly "$@" /usr/bin
+	2>/dev/null && /usr/bin /usr/bin
+	"$1" local "$@" sed && "$1" sed "$@" $(pwd) -eu grep done test ${HOME}
+	local cd readonly echo /usr/bin 2>/dev/null
+cd && local "$1" "$@" local printf sed $(pwd) "$@" printf | "$1" "$@"
+		awk done $(pwd) cd && -eu -eu $(pwd) then printf
+	| | readonly cd | x=1
+		"$@" | done $(pwd) cd local
+then cd x=1 "$@" 'quoted text' x=1 done | printf cd readonly
+	awk ${HOME} echo grep readonly then echo export
+grep awk then ${HOME} | x=1 --verbose grep -eu done printf "$@" -eu -eu /usr/bin
+| -eu 'quoted text' awk grep
+$(pwd) 2>/dev/null test 'quoted text' echo "$1" done awk sed "$@" $(pwd) ${HOME}
+	/usr/bin ${HOME} awk "$@" then test printf -eu local readonly
+		local echo sed | readonly printf
+	${HOME} x=1 printf ${HOME} local -eu /usr/bin export readonly sed printf
+		/usr/bin ${HOME} cd printf /usr/bin "$1" $(pwd) test --verbose "$1" /usr/bin -eu
+	grep readonly ${HOME} /usr/bin
+		awk 'quoted text' x=1 awk -eu local sed cd
+		sed 2>/dev/null local "$1" awk readonly echo readonly ${HOME}
+		| $(pwd) $(pwd) "$@" "$1" awk && x=1 --verbose export --verbose printf
+	then "$@" 2>/dev/null then x=1 cd -eu 'quoted text' echo
+test /usr/bin | 'quoted text' local --verbose local /usr/bin echo x=1 test
+		'quoted text' && awk -eu grep awk awk 2>/dev/null
+printf $(pwd) then $(pwd) /usr/bin
+	test test printf echo local echo local 'quoted text' $(pwd) export
+		echo done && readonly grep
+	awk ${HOME} local "$@" /usr/bin
+	| cd "$1" "$@" echo ${HOME} -eu export
+	x=1 "$1" "$1" && then -eu
+	grep 'quoted text' test printf 2>/dev/null
+		export "$1" then local readonly sed awk readonly awk echo readonly
+		'quoted text' ${HOME} test grep -eu 'quoted text' readonly 2>/dev/null --verbose
+		local echo "$@" 'quoted text' then $(pwd) readonly echo "$1"
+		test --verbose 2>/dev/null grep --verbose readonly
+	then cd grep -eu awk awk awk readonly sed | /usr/bin "$1"
+		--verbose -eu local done &&
+readonly x=1 -eu /usr/bin -eu readonly
+		-eu | | export local readonly sed then grep export echo then /usr/bin
+		awk export echo cd grep 2>/dev/null "$@" -eu 2>/dev/null grep then ${HOME} then
+--verbose && export echo | | echo 2>/dev/null echo cd 2>/dev/null
+		--verbose --verbose ${HOME} "$1" awk awk cd done
+${HOME} sed | ${HOME} printf x=1 awk
+grep ${HOME} awk $(pwd) cd test grep "$@" test -eu printf | printf echo
+grep grep test then $(pwd) echo | grep local | 'quoted text' done -eu
+done printf && done export
+"$@" export ${HOME} readonly
+		cd test && cd then export sed --verbose done
+local "$@" x=1 "$@" test done grep && "$1" "$1" "$1" local grep --verbose
+		&& ${HOME} echo 'quoted text' 'quoted text'
+	$(pwd) "$1" export grep printf echo cd printf -eu echo grep printf sed /usr/bin
+		${HOME} "$@" $(pwd) done ${HOME}
+--verbose 2>/dev/null -eu ${HOME} x=1 readonly
+	&& 'quoted text' sed --verbose -eu export
+		sed cd done done --verbose cd 2>/dev/null
+		sed 'quoted text' readonly
+	2>/dev/null ${HOME} awk test cd local readonly
+		then 2>/dev/null x=1 readonly 'quoted text' -eu readonly "$@" printf done
+		done then local | | then test sed | grep cd $(pwd) export -eu "$@"
+		cd sed printf sed 2>/dev/null 2>/dev/null echo x=1 /usr/bin
+	| -eu /usr/bin grep echo test
+	cd sed test grep export "$@" readonly "$@"
+	echo | test && 'quoted text'
+		echo "$@" $(pwd) cd "$1" /usr/bin
+"$@" $(pwd) readonly ${HOME}
+x=1 -eu && readonly "$1" && grep test && done 'quoted text' | local --verbose
+		/usr/bin && -eu 'quoted text' export 2>/dev/null export | test ${HOME}
+"$1" 'quoted text' done 'quoted text' done | "$1" -eu --verbose done
+	echo readonly awk test && 2>/dev/null export printf && /usr/bin 2>/dev/null
+		readonly 2>/dev/null awk then ${HOME} 'quoted text'
+${HOME} echo sed local --verbose then -eu then awk | echo done
+		local 'quoted text' export -eu sed grep test grep printf
+		| && awk printf | awk x=1 /usr/bin cd | | x=1 export 2>/dev/null ${HOME} -eu
+"$1" then "$1" $(pwd) "$@" -eu then printf "$@" /usr/bin | cd export "$@"
+grep 2>/dev/null "$1" $(pwd) /usr/bin done local printf test 'quoted text'
+		| ${HOME} x=1 "$1" && awk 2>/dev/null "$@" printf
+		$(pwd) then /usr/bin "$@" awk 'quoted text' "$1" grep ${HOME} sed $(pwd) export
+	${HOME} ${HOME} sed local
+		"$@" local /usr/bin cd test | export local
+	local "$1" x=1 $(pwd) local export $(pwd) test export -eu && ${HOME} export x=1
+| 2>/dev/null 'quoted text' ${HOME} awk sed then test
+	done && /usr/bin 'quoted text' | export test | test
+		cd "$@" cd ${HOME} then readonly awk sed export
+		export 'quoted text' --verbose -eu "$1" && "$1" 2>/dev/null
+x=1 /usr/bin "$@" x=1 cd done awk readonly grep "$1" then printf sed
+	| printf -eu then readonly $(pwd) printf done $(pwd)
+readonly readonly "$1" cd && sed sed echo done export
+		awk 'quoted text' grep readonly
+grep cd test echo readonly /usr/bin then "$1" readonly
+	test test done cd cd 'quoted text' "$1" test "$1" readonly done grep
+		"$1" /usr/bin --verbose then cd echo && ${HOME} sed test export | &&
+echo test && --verbose $(pwd) awk -eu grep echo "$1" local -eu
+		'quoted text' cd export | "$1" "$1" echo x=1
+printf ${HOME} "$@" 2>/dev/null then then -eu export
+cd 'quoted text' echo echo export printf export "$1" cd sed printf
+	&& cd then awk test $(pwd) --verbose /usr/bin 'quoted text'
+local ${HOME} $(pwd) -eu done 2>/dev/null
+		done export then readonly local local -eu cd then grep $(pwd)
+"$@" printf "$@" | done done "$@" test --verbose /usr/bin
+awk ${HOME} export sed done cd
+"$1" 2>/dev/null awk printf --verbose done -eu -eu ${HOME} printf
+| -eu local $(pwd) "$1"
+		export -eu 'quoted text' ${HOME} x=1 /usr/bin printf
+		test sed readonly --verbose 'quoted text' then echo x=1 echo
+		then -eu done echo -eu printf
+then printf grep x=1 readonly 'quoted text' test --verbose -eu $(pwd)
+		/usr/bin x=1 readonly $(pwd) --verbose
+	test | -eu 2>/dev/null test "$@" echo
+		printf /usr/bin "$@" "$1" export sed local export local readonly
+	--verbose -eu grep echo cd sed --verbose
+		&& -eu export readonly
+	test "$@" x=1 "$@" then | && test | printf "$@" cd cd local export x=1 | sed test
+"$1" "$1" 'quoted text' -eu printf $(pwd) then echo 'quoted text'
+		echo test export test /usr/bin
+readonly local | done printf | | && awk | readonly done printf 'quoted text'
+	readonly then -eu | grep sed awk "$@" done printf
+		&& printf | readonly export 2>/dev/null
+		| $(pwd) grep export | $(pwd) export sed export
+echo 2>/dev/null printf --verbose
+'quoted text' | cd sed export then export "$@" "$1" "$1" grep -eu ${HOME} echo
+readonly x=1 'quoted text' 2>/dev/null 2>/dev/null sed ${HOME} readonly ${HOME}
+awk --verbose echo printf local local grep -eu export then local printf "$@"
+	cd 2>/dev/null printf done 2>/dev/null
+-eu 'quoted text' && cd echo | x=1 /usr/bin "$@" /usr/bin "$1" -eu export
+	readonly done x=1 $(pwd) "$1" $(pwd)
+	grep then 2>/dev/null done done
+	echo && $(pwd) awk export /usr/bin "$1"
+2>/dev/null 2>/dev/null awk export test
+${HOME} export sed -eu -eu test grep done cd export printf test "$1" grep /usr/bin
+	cd readonly ${HOME} && -eu 'quoted text' "$1" -eu awk grep awk
+		2>/dev/null test export 'quoted text'
+		-eu local echo 'quoted text' local 2>/dev/null 'quoted text'
+		2>/dev/null | done "$@" echo
+printf "$@" ${HOME} test -eu ${HOME} awk printf 2>/dev/null
+/usr/bin then "$@" sed ${HOME} 'quoted text'
+		then -eu 2>/dev/null grep cd ${HOME} cd readonly printf 2>/dev/null local
+		--verbose awk "$1" awk test x=1 readonly --verbose
+'quoted text' 'quoted text' /usr/bin
+	readonly x=1 cd 2>/dev/null readonly "$@" echo printf
+awk x=1 then -eu | "$1" sed awk done 'quoted text'
+	export --verbose 'quoted text' 2>/dev/null sed awk ${HOME} "$1"
+		'quoted text' cd ${HOME} local $(pwd) "$@" ${HOME}
+		"$@" && printf --verbose sed x=1 cd | then echo | | "$@" 'quoted text'
+readonly 'quoted text' done $(pwd) cd awk awk echo sed "$1" --verbose then test
+	test test echo x=1 --verbose
+	/usr/bin 'quoted text' $(pwd) printf /usr/bin test then echo | 'quoted text'
+export cd printf grep printf awk local sed readonly grep 'quoted text'
+		2>/dev/null export sed sed ${HOME} done readonly --verbose export local
+	"$@" test | test -eu $(pwd) cd "$1" 'quoted text' then readonly --verbose
+		-eu "$1" && && done | echo export
+| printf 2>/dev/null cd /usr/bin 2>/dev/null "$@" | 2>/dev/null /usr/bin
+	"$1" awk ${HOME} "$1" echo --verbose local test x=1 | $(pwd) test awk export
+		2>/dev/null local -eu && test local then done sed --verbose test cd &&
+	'quoted text' test $(pwd) "$@" 2>/dev/null /usr/bin
+readonly x=1 $(pwd) --verbose local sed grep export "$1"
+		cd | "$1" echo $(pwd) -eu
+	&& $(pwd) /usr/bin echo "$1" printf
+	test grep "$1" done awk
+awk local ${HOME} && printf
+	&& 'quoted text' ${HOME} local 'quoted text' | -eu "$@"
+	export -eu --verbose "$@" /usr/bin $(pwd) 2>/dev/null sed "$@" ${HOME}
+"$1" x=1 then 'quoted text' export then 'quoted text' test grep cd local export
+	--verbose awk x=1 "$1" done cd 2>/dev/null 'quoted text' local "$1" export
+	x=1 done cd --verbose then $(pwd) test echo sed test done
+grep sed "$@" | x=1 awk cd grep $(pwd) /usr/bin
+		| 'quoted text' "$@" $(pwd) sed x=1 local done -eu local export
+		cd test ${HOME} 2>/dev/null
+local done 2>/dev/null 'quoted text' $(pwd) grep printf cd echo 'quoted text'
+	-eu cd | 'quoted text' | echo --verbose | "$1" awk | 2>/dev/null
+		done x=1 export awk x=1
+"$@" test done 'quoted text' ${HOME} awk readonly
+	test $(pwd) local 'quoted text' awk export then 2>/dev/null | 'quoted text'
+	done x=1 printf grep sed 'quoted text' && then grep readonly export readonly
+cd "$1" awk cd echo "$1" x=1
+printf done export local readonly $(pwd) | "$@" local echo ${HOME}
+	$(pwd) echo 'quoted text'
+		${HOME} 'quoted text' sed readonly
+	done printf 2>/dev/null then echo cd test /usr/bin "$1" local
+		${HOME} printf ${HOME} printf printf $(pwd) then awk
+	&& --verbose /usr/bin && "$@" && | readonly awk --verbose printf
+then && printf "$1" awk x=1 printf done local
+		2>/dev/null awk ${HOME} done export
+2>/dev/null sed "$1" && x=1 awk $(pwd) "$@" /usr/bin $(pwd) export cd x=1 printf
+	printf -eu sed export "$@" --verbose done
+	"$1" && /usr/bin ${HOME} "$@" $(pwd) "$@" $(pwd) /usr/bin readonly cd 2>/dev/null
+		local test 'quoted text' printf local printf "$1" sed sed 'quoted text'
+		${HOME} -eu 2>/dev/null --verbose 'quoted text'
+"$@" "$1" printf cd then export "$1" && awk test grep
+		$(pwd) "$@" "$1" --verbose local grep ${HOME} printf echo echo cd && -eu echo
+	$(pwd) export printf sed -eu ${HOME} -eu x=1 && sed "$1"
+		$(pwd) echo "$1" sed then /usr/bin readonly $(pwd) local $(pwd) printf
+		-eu sed grep "$1" "$1" -eu echo x=1 && printf done /usr/bin
+export cd 'quoted text'
+		"$1" -eu "$1" "$@" readonly | "$1" done && "$1" echo --verbose
+		done cd local done cd local done
+		${HOME} readonly --verbose export && grep cd grep x=1 'quoted text'
+		grep then awk $(pwd) --verbose /usr/bin echo
+	sed grep grep echo sed $(pwd) -eu echo $(pwd) awk awk 2>/dev/null local x=1 done
+		printf "$1" echo cd export 2>/dev/null
+		grep 'quoted text' "$@" then awk readonly local sed "$1" --verbose grep 'quoted text'
+x=1 ${HOME} -eu -eu | export
+then grep && && sed then test test "$1" readonly awk -eu 'quoted text' then | local
+	awk | -eu cd echo then sed test then "$@" export local
+cd && ${HOME} echo then cd
+	2>/dev/null -eu printf | --verbose x=1
+		sed | "$1" 'quoted text' $(pwd) 2>/dev/null done 'quoted text'
+		awk printf done 2>/dev/null --verbose local printf echo awk echo --verbose
+done $(pwd) $(pwd) -eu cd local test "$1"
+readonly "$1" sed --verbose "$@" && "$@" export done sed 'quoted text'
+	2>/dev/null && --verbose awk | &&
+		-eu then echo test $(pwd) 2>/dev/null
+		readonly 'quoted text' awk printf done -eu
+		test "$@" ${HOME} then export export local
+then test grep then cd x=1 local
+		x=1 ${HOME} awk -eu 'quoted text' printf test then | 'quoted text'
+awk then cd && && /usr/bin grep readonly "$1" | grep readonly local echo
+cd 2>/dev/null grep $(pwd) "$1" grep 2>/dev/null
+	cd ${HOME} x=1 -eu /usr/bin awk echo --verbose readonly
+$(pwd) 'quoted text' local echo | sed test -eu /usr/bin sed
+		x=1 --verbose test --verbose echo 2>/dev/null readonly sed then done --verbose &&
+cd /usr/bin readonly ${HOME} cd "$@" "$1" -eu
+		/usr/bin x=1 && /usr/bin 2>/dev/null done | | && echo test /usr/bin echo printf
+echo /usr/bin then echo "$1" -eu $(pwd) -eu sed
+		sed 'quoted text' "$1" printf
+	2>/dev/null x=1 "$@" -eu test test x=1 echo printf /usr/bin then readonly
+		--verbose test 2>/dev/null --verbose
+${HOME} local | then /usr/bin --verbose then && sed local
+		2>/dev/null local 2>/dev/null ${HOME} 2>/dev/null then && printf local x=1
+${HOME} /usr/bin test echo done echo 2>/dev/null awk ${HOME} -eu | 'quoted text'
+	cd -eu printf x=1 "$1" export export grep local /usr/bin grep "$1"
+then cd | sed cd --verbose done "$1" cd /usr/bin printf 2>/dev/null
+		echo $(pwd) 'quoted text' -eu ${HOME} 'quoted text'
+cd grep /usr/bin 2>/dev/null export x=1 --verbose x=1
+		${HOME} /usr/bin | --verbose export --verbose echo readonly test echo cd "$1"
+readonly x=1 $(pwd) sed -eu 'quoted text' x=1 cd | awk
+cd ${HOME} cd test 2>/dev/null export ${HOME} "$@"
+$(pwd) local $(pwd) grep && readonly
+		sed export "$1" cd then --verbose "$1" grep x=1 $(pwd) x=1 2>/dev/null
+		${HOME} grep 'quoted text'
+	sed --verbose /usr/bin /usr/bin local "$@" printf $(pwd)
+	'quoted text' then local ${HOME} then /usr/bin && done 'quoted text' awk
+		"$@" /usr/bin echo export test cd printf
+		echo export /usr/bin --verbose 'quoted text'
+"$1" grep local readonly /usr/bin -eu
+	2>/dev/null "$@" export
+	test --verbose x=1 sed then cd done local -eu then "$@" /usr/bin then
+sed echo awk sed export then done sed /usr/bin readonly
+cd | awk local awk /usr/bin local printf --verbose cd export
+grep printf && readonly 'quoted text'
+	sed -eu "$1" sed done /usr/bin
+local export local /usr/bin printf /usr/bin sed $(pwd)
+	'quoted text' x=1 -eu "$1" awk sed readonly --verbose done 'quoted text' echo
+2>/dev/null printf 'quoted text' printf /usr/bin "$@" "$@" --verbose grep
+then sed $(pwd) printf $(pwd) $(pwd)
+	sed done sed && --verbose test echo readonly
+-eu "$1" grep grep -eu then /usr/bin grep --verbose grep --verbose
+	readonly then readonly && echo && 2>/dev/null local export $(pwd) readonly
+		done echo test /usr/bin | $(pwd) test test --verbose readonly sed done export
+local 'quoted text' /usr/bin | sed | export grep echo ${HOME} printf printf
+awk echo "$@" 'quoted text' 2>/dev/null
+	"$1" readonly 'quoted text' grep done printf local echo --verbose | &&
+	-eu test $(pwd) --verbose export -eu readonly done sed then test awk local
+'quoted text' "$@" local /usr/bin
+	local /usr/bin cd ${HOME} /usr/bin test | cd --verbose then && x=1 $(pwd) && 2>/dev/null
+		$(pwd) readonly --verbose "$@" readonly then "$@" then x=1 /usr/bin
+	echo "$@" "$@" | "$@" grep | echo -eu /usr/bin -eu printf
+	"$@" "$@" local "$@" cd local 2>/dev/null readonly grep done
+	${HOME} && echo 'quoted text' printf done
+test echo echo printf printf -eu then test echo done test /usr/bin printf
+	printf readonly ${HOME} test sed
+		--verbose sed x=1 grep test "$@"
+	sed ${HOME} 2>/dev/null readonly test ${HOME} cd echo
+	"$@" then 'quoted text' done cd printf awk /usr/bin awk cd "$@"
+		&& test | && && && 2>/dev/null
+		done ${HOME} sed -eu test grep then "$1" readonly sed 2>/dev/null test --verbose
+'quoted text' readonly local printf -eu 2>/dev/null
+		&& "$1" sed | ${HOME}
+/usr/bin then --verbose x=1 cd -eu done ${HOME} awk
+echo -eu then echo sed && echo then
+		/usr/bin echo cd readonly export 'quoted text' "$1" "$1"
+	2>/dev/null sed /usr/bin done "$@" awk
+		"$@" awk x=1 done ${HOME}
+-eu readonly | readonly x=1 --verbose ${HOME} 'quoted text'
+grep "$1" "$1" /usr/bin 'quoted text' --verbose
+		${HOME} /usr/bin "$@" done 'quoted text'
+		grep "$@" x=1 test "$1" echo -eu
+	x=1 test grep "$@" sed && | then -eu /usr/bin
+	awk 2>/dev/null grep export awk readonly "$1" ${HOME}
+	awk | sed test grep test
+		export ${HOME} x=1 'quoted text' test then awk $(pwd) done grep
+sed readonly local printf x=1 then $(pwd) echo readonly
+	local export local sed awk cd grep ${HOME} local then
+	test 2>/dev/null "$@" -eu $(pwd) --verbose printf -eu
+		done local echo sed readonly --verbose printf "$1" test | local cd printf
+"$1" then grep export && -eu | $(pwd) echo test | $(pwd) local test cd "$1"
+		grep -eu 2>/dev/null done /usr/bin $(pwd) "$1"
+		2>/dev/null grep done export $(pwd) 'quoted text' --verbose -eu $(pwd) -eu -eu
+		'quoted text' -eu $(pwd) "$@" echo ${HOME} $(pwd)
+$(pwd) "$@" /usr/bin "$1" awk then awk then | $(pwd)
+	${HOME} "$@" ${HOME} grep -eu 'quoted text' -eu "$@"
+/usr/bin "$@" echo $(pwd) printf --verbose cd 'quoted text' 'quoted text'
+2>/dev/null awk 2>/dev/null /usr/bin readonly awk
+	done readonly sed -eu test test && printf
+grep "$1" && | export readonly
+printf ${HOME} test printf cd local local export
+-eu x=1 then then x=1 sed "$@" test && -eu readonly then grep | then
+--verbose 2>/dev/null "$@" ${HOME} -eu grep echo
+		cd x=1 "$1" cd readonly 'quoted text' -eu echo
+"$1" sed 2>/dev/null echo then printf x=1 ${HOME} local printf done "$1"
+		test -eu --verbose cd sed sed 2>/dev/null readonly local
+then awk grep cd && readonly awk
+		/usr/bin cd readonly 2>/dev/null
+	awk test echo local awk test | "$@" --verbose then sed cd "$1" done sed cd
+	"$1" --verbose export export then 'quoted text' 'quoted text' sed
+"$1" x=1 'quoted text' x=1 x=1 x=1 --verbose
+		'quoted text' grep export export 'quoted text' echo | then
+		--verbose echo local /usr/bin test /usr/bin -eu --verbose done ${HOME} "$@" "$@"
+	&& 2>/dev/null ${HOME} "$@" && 'quoted text' grep done --verbose
+		"$1" | grep export export done sed 'quoted text' | export
+	x=1 --verbose 'quoted text' && export grep $(pwd)
+	test readonly x=1 "$1" | export /usr/bin
+		local done ${HOME} $(pwd) test
+		awk x=1 local sed ${HOME} /usr/bin /usr/bin ${HOME}
+		&& test export readonly then 'quoted text' then ${HOME} $(pwd) ${HOME}
+	| export grep echo | -eu -eu --verbose
+cd "$@" awk printf && readonly -eu && $(pwd) $(pwd)
+'quoted text' grep grep printf cd /usr/bin local -eu printf x=1 readonly grep
+	awk --verbose local echo $(pwd) "$@" printf echo $(pwd) -eu sed
+'quoted text' /usr/bin export /usr/bin done 2>/dev/null test awk readonly
+'quoted text' /usr/bin --verbose /usr/bin 2>/dev/null echo "$@" local $(pwd)
+		"$@" "$@" /usr/bin export | -eu | echo ${HOME} echo 'quoted text'
+	sed export | x=1 ${HOME} -eu echo sed readonly
+		$(pwd) export printf -eu 2>/dev/null
+	"$@" /usr/bin test echo grep readonly test 2>/dev/null && test
+		cd /usr/bin | --verbose sed done local cd && $(pwd) done | "$@" printf "$@" printf
+		test printf then "$1" "$1" | cd printf then
+	| then 'quoted text' -eu grep grep ${HOME} printf local $(pwd) x=1 'quoted text'
+		x=1 'quoted text' && then local x=1 | then readonly "$@" done ${HOME}
+		-eu && grep | export then 'quoted text'
+x=1 'quoted text' echo $(pwd) $(pwd)
+		done 'quoted text' test readonly
+	--verbose grep export grep -eu printf
+	grep "$1" -eu ${HOME} --verbose done 2>/dev/null printf
+	done --verbose awk 2>/dev/null export && $(pwd) echo done "$1" printf sed x=1
+sed 2>/dev/null -eu && | x=1 cd "$1" test ${HOME} echo export
+	done echo | grep 'quoted text' printf 'quoted text' 'quoted text' 'quoted text'
+grep ${HOME} printf "$1" "$@" $(pwd) -eu /usr/bin "$@" $(pwd) "$@" ${HOME}
+| then -eu test grep local --verbose 2>/dev/null
+cd 2>/dev/null test local sed --verbose local done awk printf
+		&& then | $(pwd) readonly readonly /usr/bin grep "$@" 'quoted text'
+	2>/dev/null then printf -eu sed test "$1" then
+	'quoted text' cd echo sed sed -eu && && 2>/dev/null test local
+		--verbose $(pwd) export /usr/bin --verbose && 2>/dev/null x=1 /usr/bin
+		export local grep grep $(pwd) 'quoted text'
+	done | sed printf grep sed 'quoted text' readonly /usr/bin readonly then
+	printf | cd "$@" && export grep && grep export && -eu grep done local sed printf
+	printf echo printf readonly awk 2>/dev/null $(pwd) --verbose
+	-eu 'quoted text' $(pwd) grep sed x=1 test readonly export
+		&& ${HOME} 'quoted text' 2>/dev/null
+test printf grep --verbose echo readonly echo | && 'quoted text' $(pwd) $(pwd)
+	echo cd | "$@" done 'quoted text' "$@" && 2>/dev/null --verbose -eu
+	-eu && --verbose then test export export cd $(pwd)
+	&& done awk | "$@" -eu cd -eu readonly grep grep cd done
+		export "$1" 2>/dev/null then export $(pwd)
+		2>/dev/null x=1 export "$@" --verbose
+	test sed done && && x=1 cd "$1" /usr/bin local awk
+		sed "$1" 2>/dev/null "$1" then
+| echo cd export local readonly ${HOME} cd sed awk echo x=1 ${HOME}
+"$1" echo printf "$@" then printf done export cd echo local sed 2>/dev/null $(pwd)
+	printf export readonly --verbose printf done x=1
+	--verbose --verbose ${HOME} cd printf x=1 done echo sed $(pwd) "$1"
+		sed then local -eu done $(pwd) printf | x=1 cd
+	then readonly local cd sed test 2>/dev/null grep -eu && awk /usr/bin --verbose
+export 'quoted text' local printf -eu /usr/bin
+export cd awk "$1" && | "$@" "$1"
+	readonly $(pwd) then done grep done && && then echo readonly export -eu
+		grep x=1 | test export cd local $(pwd) local local /usr/bin $(pwd) cd "$@" ${HOME}
+/usr/bin "$1" "$1" "$1" && | grep $(pwd) awk /usr/bin done then cd /usr/bin
+then --verbose "$@" test
+"$@" grep grep done done /usr/bin sed readonly readonly test
+		&& && | --verbose readonly local 2>/dev/null && grep printf sed "$1" grep && -eu
+test x=1 done /usr/bin then 'quoted text' printf /usr/bin awk awk ${HOME}
+'quoted text' then --verbose done 'quoted text' readonly
+	sed test test ${HOME} sed done sed $(pwd) ${HOME} awk ${HOME} echo readonly
+"$@" ${HOME} grep $(pwd) echo done "$1"
+	local then 'quoted text' sed test then done ${HOME} test grep ${HOME}
+readonly test printf awk $(pwd) cd 2>/dev/null awk "$@" sed $(pwd) awk x=1
+/usr/bin then done -eu local export cd readonly cd $(pwd) export awk "$@" $(pwd)
+${HOME} x=1 export | cd | 2>/dev/null | | done /usr/bin "$@" 2>/dev/null
+	'quoted text' awk --verbose local cd local then cd "$@" ${HOME}
+grep echo readonly /usr/bin 2>/dev/null readonly "$@" grep awk $(pwd)
+echo printf | export 2>/dev/null 2>/dev/null test done printf
+	'quoted text' grep 'quoted text' ${HOME} grep && then
+"$@" x=1 export sed test awk sed test |
+test then readonly "$@" /usr/bin readonly ${HOME} local $(pwd)
+grep test sed export /usr/bin 'quoted text'
+	--verbose export test -eu && $(pwd)
+		readonly -eu -eu printf $(pwd) && printf && |
+"$@" $(pwd) /usr/bin -eu done echo echo | cd awk echo -eu "$@" 2>/dev/null echo
+		/usr/bin "$@" x=1 2>/dev/null --verbose
+"$@" "$1" /usr/bin sed cd -eu ${HOME} && export
+export --verbose done readonly x=1
+	cd | done sed 'quoted text' x=1 $(pwd) | local "$@" ${HOME}
+	${HOME} local -eu $(pwd) "$@" /usr/bin $(pwd) local -eu grep 2>/dev/null 'quoted text'
+grep test "$@" 'quoted text' printf x=1 export --verbose 2>/dev/null -eu
+		"$@" /usr/bin 'quoted text' awk awk 2>/dev/null
+		"$@" grep && then grep done x=1 grep export x=1 'quoted text'
+	-eu 2>/dev/null done 2>/dev/null $(pwd) then "$1"
+	x=1 "$1" grep 'quoted text' readonly cd echo echo -eu x=1 local echo "$1" -eu printf
+awk grep then cd /usr/bin
+/usr/bin awk test -eu $(pwd) ${HOME} --verbose
+/usr/bin printf printf
+		awk && sed x=1 local | then 'quoted text' export $(pwd) sed 'quoted text'
+		test test cd && "$@" export printf echo
+2>/dev/null $(pwd) --verbose echo ${HOME} then "$@" done
+	$(pwd) -eu $(pwd) 2>/dev/null
+	export | 'quoted text' 2>/dev/null "$@" "$@" ${HOME} test printf
+test local grep && 'quoted text' then "$1" done --verbose
+		export printf printf --verbose -eu -eu export echo "$1" && local printf
+	readonly awk readonly 'quoted text' done ${HOME}
+	test sed $(pwd) readonly readonly 'quoted text' local test echo && "$@" test
+		cd 'quoted text' awk then
+-eu export ${HOME} cd /usr/bin awk cd echo
+	'quoted text' | then -eu done
+test grep then test grep && "$@"
+		awk 2>/dev/null grep then then echo awk then
+		readonly grep 'quoted text' 2>/dev/null
+		awk cd printf then "$@" grep -eu 'quoted text' --verbose | "$@" 2>/dev/null grep
+| readonly --verbose readonly $(pwd) cd then awk done then
+	cd grep test test x=1 | done grep --verbose 'quoted text' test ${HOME} 'quoted text'
+| x=1 -eu ${HOME} "$1" "$1"
+${HOME} sed local | && grep -eu $(pwd) test "$1" -eu export test -eu "$@"
+&& then && export 'quoted text' &&
+	awk "$1" readonly "$@" then then 'quoted text' export
+		x=1 $(pwd) grep sed x=1 | test -eu $(pwd) done -eu test
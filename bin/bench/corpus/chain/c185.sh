@@ -0,0 +1,2001 @@
+		--verbose --verbose | local ${HOME} "$@"
+2>/dev/null && --verbose "$@" --verbose $(pwd) --verbose && test &&
+local awk && printf $(pwd) -eu -eu $(pwd) test awk
+	test readonly 2>/dev/null test --verbose x=1
+		printf cd awk cd 2>/dev/null
+2>/dev/null | export printf "$@" cd 2>/dev/null "$1" awk grep grep 2>/dev/null
+	grep test 2>/dev/null --verbose local printf "$@" readonly readonly cd
+${HOME} local 2>/dev/null ${HOME} sed x=1 done echo test readonly cd grep done
+	-eu printf "$@" "$1" $(pwd) $(pwd) "$1" done $(pwd) echo x=1 readonly -eu
+sed test sed "$1" "$1" 2>/dev/null readonly /usr/bin
+printf cd 2>/dev/null sed
+		local then /usr/bin 2>/dev/null "$1" 'quoted text'
+-eu | awk printf printf 2>/dev/null "$1" cd grep done local
+	-eu ${HOME} awk ${HOME} /usr/bin local /usr/bin $(pwd) -eu local 2>/dev/null
+done echo sed && test export then | 2>/dev/null readonly
+/usr/bin cd && awk "$@"
+		echo x=1 $(pwd) 'quoted text' sed sed grep
+	'quoted text' | local local
+	printf printf readonly && ${HOME} then
+	/usr/bin ${HOME} ${HOME} awk --verbose && "$1" cd --verbose
+cd echo cd x=1 2>/dev/null $(pwd) 'quoted text' -eu
+		"$@" x=1 export awk sed 'quoted text' done printf 2>/dev/null &&
+	'quoted text' test test $(pwd) then x=1 --verbose grep grep grep && ${HOME}
+cd /usr/bin printf $(pwd) then readonly echo export awk done grep grep
+	/usr/bin grep readonly 2>/dev/null /usr/bin "$1" grep
+		"$1" | -eu test cd grep /usr/bin | x=1
+	grep 2>/dev/null done printf 'quoted text' -eu cd "$@" readonly && export /usr/bin
+	local 2>/dev/null && "$@"
+sed done /usr/bin "$@" $(pwd) /usr/bin local test
+		sed ${HOME} 'quoted text'
+	"$1" -eu then grep 2>/dev/null then ${HOME}
+		sed printf export test | ${HOME}
+	done sed | -eu "$1" echo
+--verbose readonly printf test --verbose local test -eu test then export
+readonly ${HOME} 2>/dev/null 'quoted text' sed awk
+	test 2>/dev/null | /usr/bin test | awk --verbose
+cd --verbose | -eu $(pwd) "$1" 'quoted text' local local
+x=1 local x=1 then ${HOME}
+		echo --verbose "$1" && done readonly | --verbose test printf 'quoted text'
+${HOME} readonly ${HOME} printf sed test
+	"$@" local 'quoted text' --verbose done cd sed grep 2>/dev/null -eu
+		done 'quoted text' --verbose "$1" sed x=1
+		export | readonly local export -eu "$1" done x=1 awk export /usr/bin "$1"
+'quoted text' then $(pwd) printf echo 2>/dev/null
+	local "$1" $(pwd) printf
+		awk -eu echo local -eu && sed --verbose done /usr/bin 'quoted text'
+	2>/dev/null | sed /usr/bin test grep local --verbose
+	awk 2>/dev/null done -eu then $(pwd) done /usr/bin
+		printf awk local -eu x=1
+		export 'quoted text' cd cd "$1" grep -eu
+${HOME} printf "$@" $(pwd) -eu export test
+	then ${HOME} local readonly 'quoted text' ${HOME}
+	${HOME} /usr/bin $(pwd) test /usr/bin readonly --verbose $(pwd)
+		x=1 2>/dev/null echo -eu ${HOME} test awk local x=1 export done 2>/dev/null "$1"
+-eu 'quoted text' readonly --verbose sed grep printf | | ${HOME}
+	/usr/bin local 'quoted text' "$@" 'quoted text' sed readonly "$@" local
+grep --verbose 'quoted text' test "$1" $(pwd)
+		printf test done done awk 2>/dev/null local sed cd
+	then grep --verbose x=1 done /usr/bin --verbose
+	local done /usr/bin 'quoted text'
+	&& 'quoted text' 2>/dev/null "$@" echo local export 'quoted text' local
+	readonly readonly "$@" /usr/bin awk $(pwd)
+		2>/dev/null 2>/dev/null sed 'quoted text'
+'quoted text' --verbose local test "$1" && --verbose 2>/dev/null
+grep sed 2>/dev/null sed
+	done local awk | echo awk | "$@" ${HOME} echo | ${HOME} test readonly $(pwd) printf
+		done $(pwd) printf --verbose
+		echo export sed | --verbose export "$@" | printf export
+		-eu "$@" test -eu test 2>/dev/null --verbose
+	/usr/bin grep readonly readonly ${HOME} local -eu 2>/dev/null awk "$@" ${HOME}
+		${HOME} /usr/bin "$@" readonly
+		then export export $(pwd) | echo local "$1" $(pwd) local cd then echo "$@" "$1"
+cd "$@" export done /usr/bin cd cd ${HOME} grep
+	done "$1" /usr/bin 2>/dev/null /usr/bin 'quoted text'
+	echo export 2>/dev/null x=1 && export done -eu -eu 2>/dev/null x=1 x=1
+&& local -eu local /usr/bin "$1" 'quoted text' then -eu test ${HOME} x=1
+	| sed 2>/dev/null /usr/bin "$1"
+		/usr/bin | local 'quoted text' then printf | ${HOME}
+		--verbose $(pwd) printf && 'quoted text' then readonly --verbose cd
+	cd sed awk grep ${HOME} --verbose export 2>/dev/null awk
+	--verbose /usr/bin $(pwd) /usr/bin local ${HOME} sed echo grep --verbose
+cd local -eu then ${HOME} x=1 --verbose x=1 'quoted text'
+	test export --verbose printf -eu readonly
+	'quoted text' readonly "$@" -eu "$1" 2>/dev/null 2>/dev/null
+$(pwd) "$@" x=1 "$1" 'quoted text' 'quoted text' test
+		x=1 && -eu test export cd -eu printf done ${HOME} awk -eu export
+	"$1" sed local | echo cd $(pwd)
+--verbose export echo sed "$@" local 2>/dev/null -eu done then -eu
+${HOME} -eu export grep awk /usr/bin 'quoted text' done then /usr/bin
+	local printf | readonly ${HOME} $(pwd)
+	| 'quoted text' then 'quoted text' cd --verbose $(pwd) --verbose
+&& printf done 2>/dev/null local test export
+		test --verbose 2>/dev/null
+| x=1 grep done --verbose awk -eu then echo /usr/bin ${HOME}
+		'quoted text' then "$1" -eu ${HOME} sed then && sed
+	| ${HOME} 'quoted text' $(pwd) local awk then
+	"$1" local printf awk echo 'quoted text' readonly export test ${HOME}
+		x=1 | awk "$1" export "$1" local 2>/dev/null -eu test printf printf grep
+		'quoted text' echo printf 2>/dev/null -eu x=1 awk && grep
+	printf ${HOME} cd 2>/dev/null /usr/bin then x=1 ${HOME} local sed | ${HOME}
+		-eu grep local test readonly awk readonly cd && echo ${HOME}
+	done --verbose done $(pwd) local local $(pwd) echo | awk export
+		echo export export --verbose
+	'quoted text' --verbose grep
+local readonly sed export $(pwd) printf 2>/dev/null awk grep | 'quoted text'
+	${HOME} /usr/bin | "$@" /usr/bin
+readonly done then grep then done printf | then readonly $(pwd) readonly x=1 printf
+-eu grep then "$1" $(pwd) "$1" && $(pwd) /usr/bin readonly
+	${HOME} sed ${HOME} done done 2>/dev/null
+	"$@" readonly 'quoted text' /usr/bin $(pwd) then
+--verbose cd "$@" then printf sed
+	2>/dev/null then "$1" test 2>/dev/null
+done awk ${HOME} && x=1 -eu 'quoted text' export ${HOME}
+		2>/dev/null export | then sed done
+--verbose cd cd cd printf test test
+2>/dev/null --verbose local cd awk $(pwd) ${HOME}
+	"$@" cd readonly local "$1" ${HOME} local done
+		echo "$@" /usr/bin test echo "$@" done $(pwd) /usr/bin echo /usr/bin /usr/bin
+	-eu then cd awk -eu local -eu then
+${HOME} 2>/dev/null "$@" echo then ${HOME}
+test test grep && sed local
+		export readonly printf | sed -eu test && --verbose printf x=1 printf
+2>/dev/null sed echo done ${HOME} grep x=1 $(pwd) printf echo awk grep readonly
+	export awk /usr/bin | "$@"
+		awk /usr/bin ${HOME} echo test --verbose --verbose test printf
+&& ${HOME} && then 'quoted text' readonly /usr/bin
+	&& then 2>/dev/null $(pwd)
+x=1 --verbose "$1" 2>/dev/null test test | awk $(pwd) awk --verbose cd && "$@"
+	"$@" export export local echo /usr/bin
+	readonly grep local -eu readonly 2>/dev/null -eu
+local awk 2>/dev/null grep grep sed x=1 printf cd printf
+echo done /usr/bin 2>/dev/null ${HOME} cd $(pwd) $(pwd) | done cd
+done grep done | grep | /usr/bin grep sed test x=1 local grep "$@" && 2>/dev/null
+	echo then sed awk && awk 'quoted text' 'quoted text' $(pwd)
+local export done test local local ${HOME} done /usr/bin
+	done | 'quoted text' awk done done
+		export done printf ${HOME} local printf local ${HOME} then /usr/bin done 'quoted text'
+		&& 2>/dev/null ${HOME} export then export
+	grep sed $(pwd) /usr/bin
+"$1" x=1 $(pwd) readonly test "$1" awk "$1" ${HOME}
+grep && "$@" /usr/bin --verbose $(pwd) "$1" then $(pwd) &&
+	sed done cd readonly echo echo awk /usr/bin 'quoted text'
+		export done echo /usr/bin echo 2>/dev/null x=1 'quoted text'
+	2>/dev/null ${HOME} 2>/dev/null awk | grep local $(pwd) sed "$1" -eu && ${HOME}
+	printf ${HOME} then echo 2>/dev/null export ${HOME} grep "$1"
+| test grep done grep x=1
+	"$@" done then --verbose local
+local 2>/dev/null && -eu awk --verbose "$@" test grep test 'quoted text' export
+	-eu | 2>/dev/null done sed local readonly
+printf done export then
+awk 'quoted text' test -eu x=1 && awk 'quoted text' x=1 done "$1"
+grep ${HOME} /usr/bin 2>/dev/null $(pwd) /usr/bin grep /usr/bin readonly test &&
+		awk sed 2>/dev/null readonly x=1 echo printf ${HOME} | done readonly
+"$@" test grep grep sed "$1" "$1" "$1"
+		echo local grep "$@" ${HOME} readonly "$@" x=1 then --verbose
+		2>/dev/null $(pwd) x=1 done 'quoted text'
+--verbose then /usr/bin "$@" printf printf sed | readonly test &&
+	&& echo grep /usr/bin -eu 2>/dev/null export echo "$1" ${HOME}
+		sed 2>/dev/null then "$@" -eu test export awk export x=1 x=1
+'quoted text' 'quoted text' printf | awk awk echo echo awk /usr/bin "$1"
+	awk echo awk then | 2>/dev/null --verbose -eu "$@" ${HOME} 'quoted text'
+done ${HOME} 'quoted text' x=1 | printf | x=1 -eu cd x=1 --verbose
+		awk local sed grep test readonly export $(pwd) test 'quoted text' test done then
+/usr/bin 2>/dev/null grep test -eu sed && done "$@" then local done
+		'quoted text' awk awk x=1 | then "$@" "$@" printf export readonly "$1" &&
+		awk awk "$1" echo echo /usr/bin $(pwd) 'quoted text' cd then sed printf /usr/bin
+		echo | readonly grep $(pwd) |
+		sed --verbose done "$@" --verbose $(pwd) 'quoted text'
+	/usr/bin readonly 'quoted text' "$1" ${HOME} echo 2>/dev/null local $(pwd)
+sed grep local cd -eu local printf done ${HOME} -eu sed sed awk
+	$(pwd) sed x=1 test done /usr/bin export test local local
+then 'quoted text' awk /usr/bin --verbose --verbose sed sed && x=1
+		test readonly ${HOME} sed done
+x=1 2>/dev/null 2>/dev/null echo ${HOME} readonly
+	sed awk printf readonly done x=1 ${HOME} "$@" 2>/dev/null | done
+&& printf export done grep done cd readonly then -eu
+2>/dev/null "$1" then -eu
+		cd ${HOME} export -eu -eu $(pwd)
+	| x=1 -eu done x=1 export echo x=1 "$@" printf done cd && sed local echo -eu
+		sed | sed done -eu $(pwd)
+echo then --verbose 'quoted text'
+		"$1" "$@" --verbose $(pwd) cd grep
+"$1" x=1 && local --verbose 'quoted text'
+		&& $(pwd) "$@" done local 2>/dev/null /usr/bin /usr/bin done /usr/bin done
+	test /usr/bin 'quoted text' 2>/dev/null sed sed | test /usr/bin
+awk test echo | sed --verbose 2>/dev/null x=1 test
+	$(pwd) 'quoted text' then "$1" -eu printf && local --verbose
+	test awk local awk "$@" --verbose 'quoted text' && local
+	grep test readonly cd $(pwd) then 'quoted text' && x=1 | 'quoted text' | $(pwd)
+	cd test "$@" readonly awk -eu | test readonly /usr/bin /usr/bin export done x=1
+x=1 sed -eu x=1 2>/dev/null readonly cd x=1 cd -eu grep && echo 2>/dev/null
+export && then cd -eu readonly echo export && cd && local then
+		awk --verbose x=1 x=1 export readonly 2>/dev/null
+"$@" export echo /usr/bin then --verbose done &&
+"$@" x=1 x=1 test grep /usr/bin
+		cd "$1" grep test local readonly --verbose cd /usr/bin
+		/usr/bin readonly cd ${HOME} ${HOME} 2>/dev/null $(pwd) "$1" $(pwd) awk done
+		"$1" /usr/bin --verbose grep && /usr/bin export test printf x=1 done awk 'quoted text'
+2>/dev/null printf "$1"
+printf | ${HOME} 'quoted text' --verbose done printf x=1 && cd then 2>/dev/null
+	grep ${HOME} --verbose then
+done /usr/bin printf &&
+		printf $(pwd) "$@" local "$1"
+		then then /usr/bin | local 2>/dev/null --verbose -eu -eu then done
+	readonly -eu grep ${HOME} done 2>/dev/null
+printf done sed then "$@" local && grep export --verbose
+	"$@" $(pwd) then /usr/bin -eu export test grep "$@"
+	/usr/bin 'quoted text' test $(pwd) && export sed local x=1 'quoted text'
+		| export $(pwd) x=1 /usr/bin echo /usr/bin export awk
+echo readonly local test readonly echo ${HOME} then echo printf
+	test then local done sed
+	test export grep printf 2>/dev/null cd "$1"
+		printf then $(pwd) test |
+local echo 'quoted text' local echo awk echo -eu export sed x=1
+"$@" ${HOME} then readonly | grep sed local then
+	/usr/bin $(pwd) local then "$1" "$@" "$1" export 'quoted text'
+	export readonly /usr/bin "$1" cd
+	"$1" printf awk | $(pwd) cd then then readonly
+grep --verbose sed /usr/bin && echo && echo printf x=1 /usr/bin
+x=1 export x=1 'quoted text' printf local export x=1
+done $(pwd) printf | awk printf echo awk readonly
+	printf -eu grep -eu x=1 'quoted text' local awk done 'quoted text' cd
+	| export /usr/bin && then export && done grep cd grep -eu 2>/dev/null
+	export /usr/bin done $(pwd) "$@" awk $(pwd) "$1"
+		"$@" 'quoted text' export --verbose
+		"$@" && sed -eu printf test ${HOME} readonly
+-eu "$1" export sed $(pwd) $(pwd) export x=1 $(pwd) then &&
+		--verbose 'quoted text' /usr/bin local sed grep grep
+		local local --verbose "$1"
+local --verbose awk sed 'quoted text' ${HOME}
+		&& printf echo "$@" -eu ${HOME} export /usr/bin
+	grep readonly x=1 grep && then $(pwd)
+$(pwd) local readonly readonly export $(pwd)
+	${HOME} sed readonly x=1 -eu 2>/dev/null
+	awk /usr/bin local "$1" then then echo readonly x=1
+| readonly 2>/dev/null printf readonly
+awk awk printf -eu 2>/dev/null local readonly | --verbose
+		| awk local sed printf |
+		then /usr/bin readonly grep /usr/bin test readonly then 2>/dev/null
+	"$@" | 'quoted text' test -eu test $(pwd)
+	--verbose echo printf $(pwd) then printf -eu
+	&& done done local readonly
+test awk "$1" cd sed /usr/bin done -eu "$1" | "$@" -eu
+		${HOME} local "$@" echo echo awk | cd sed --verbose "$@"
+	done test "$1" --verbose awk 2>/dev/null then printf cd --verbose printf
+		sed $(pwd) readonly 2>/dev/null 'quoted text' cd printf 'quoted text'
+		-eu 2>/dev/null readonly && sed done 2>/dev/null readonly done export | 'quoted text'
+		x=1 sed -eu grep "$1" "$1" then $(pwd)
+&& $(pwd) printf && local readonly ${HOME} awk printf
+	grep && && | "$@" ${HOME}
+	done grep $(pwd) awk 2>/dev/null then export -eu printf $(pwd) export
+		grep 'quoted text' readonly x=1 -eu export
+done printf readonly /usr/bin done /usr/bin
+		grep | awk $(pwd) awk "$@" export | $(pwd)
+then ${HOME} && "$@" printf
+		&& /usr/bin ${HOME} cd awk test "$@" |
+	local && --verbose echo then 'quoted text' | ${HOME} printf "$1" | --verbose
+		done local --verbose | x=1
+	sed "$@" 'quoted text' 'quoted text' readonly done 'quoted text'
+		grep awk readonly 'quoted text'
+| sed readonly /usr/bin $(pwd) ${HOME}
+	cd then /usr/bin test 2>/dev/null printf x=1 readonly awk 'quoted text'
+		readonly test x=1 | "$@" ${HOME} grep cd then readonly grep 'quoted text'
+-eu awk ${HOME} x=1 -eu | | 2>/dev/null sed echo printf $(pwd) 2>/dev/null
+	'quoted text' printf "$@" export printf printf /usr/bin 2>/dev/null /usr/bin
+test cd x=1 "$1" readonly sed | "$1" --verbose
+local ${HOME} then x=1 -eu grep test local
+awk x=1 --verbose -eu --verbose /usr/bin &&
+		"$@" && local grep 'quoted text' --verbose printf "$@" local -eu x=1
+		-eu "$@" grep "$1" cd x=1 test cd | ${HOME}
+	export cd /usr/bin -eu echo "$@" echo && $(pwd) grep $(pwd) awk
+		sed awk echo then echo awk | awk echo done test "$1"
+	${HOME} readonly && -eu cd 2>/dev/null grep then ${HOME}
+		"$@" ${HOME} export then local "$1" echo then readonly then $(pwd) --verbose
+export echo export "$1" local readonly sed readonly "$1" cd $(pwd) && "$@"
+"$1" printf awk x=1 | /usr/bin $(pwd) "$@" 'quoted text'
+	2>/dev/null done ${HOME} local $(pwd) local grep sed
+printf then "$@" && ${HOME} "$1" readonly $(pwd) grep && echo
+awk done 'quoted text' test "$1" awk then grep ${HOME} && cd ${HOME}
+awk cd --verbose export export printf
+test grep cd echo awk $(pwd) x=1 local /usr/bin --verbose
+	awk "$1" grep "$@" ${HOME} readonly done $(pwd) echo
+	"$1" echo "$1" | && -eu echo test grep cd cd then x=1 export 2>/dev/null
+		"$1" ${HOME} export grep export 'quoted text' awk awk "$1"
+	"$@" export 2>/dev/null | -eu sed test readonly 2>/dev/null cd | | &&
+	$(pwd) --verbose | -eu /usr/bin "$1" | readonly
+		x=1 echo x=1 sed 'quoted text' | export export export readonly grep "$@" |
+		--verbose cd | x=1 | then local export --verbose
+	awk | done awk "$1" && echo x=1 grep
+	"$@" echo "$@" printf 2>/dev/null
+		/usr/bin -eu "$1" 'quoted text' --verbose x=1 | | local 'quoted text' cd cd
+		then grep awk $(pwd) /usr/bin
+| && then awk echo $(pwd) local 'quoted text'
+2>/dev/null done | test readonly && echo export sed
+		cd "$1" /usr/bin ${HOME} awk local done cd | readonly then local x=1 sed
+		test $(pwd) /usr/bin test cd then ${HOME} | /usr/bin "$@" | sed
+test readonly cd "$@" cd local export grep grep -eu --verbose ${HOME} x=1
+then readonly 'quoted text' "$@" grep echo awk echo test "$1" sed grep printf
+&& x=1 ${HOME} done echo test grep then echo --verbose
+local && 'quoted text' 2>/dev/null done 2>/dev/null test
+		'quoted text' grep 'quoted text' 2>/dev/null "$1" export readonly awk echo sed
+		2>/dev/null sed readonly export sed && && "$@" "$1" --verbose sed
+		$(pwd) printf $(pwd) x=1 && echo local cd printf 2>/dev/null
+awk then export "$@" grep | $(pwd) echo printf && export
+	local readonly sed done awk readonly ${HOME} local
+"$1" ${HOME} local "$1" $(pwd) -eu local && x=1 cd
+	| | ${HOME} x=1 $(pwd) grep ${HOME} done readonly readonly 2>/dev/null
+	&& readonly cd "$1" local x=1 x=1 "$1" && cd x=1 ${HOME} cd 'quoted text'
+	&& echo /usr/bin readonly grep --verbose "$@" && "$@" readonly echo cd
+		&& cd echo grep -eu printf sed cd | cd cd "$1" local x=1 readonly echo
+		local echo 2>/dev/null awk then ${HOME} $(pwd) awk ${HOME}
+	| --verbose awk $(pwd) --verbose 'quoted text' "$@" && grep awk && "$@" printf
+export "$1" printf --verbose ${HOME} awk test | x=1 echo 'quoted text'
+		'quoted text' export 2>/dev/null local grep cd export --verbose sed cd
+echo sed $(pwd) done /usr/bin
+echo readonly -eu readonly cd "$1" 'quoted text'
+		&& 2>/dev/null ${HOME} "$1" cd echo cd
+	readonly printf x=1 awk | local cd $(pwd) export cd 'quoted text'
+	then then then sed $(pwd) echo then && ${HOME} test $(pwd) --verbose local
+		readonly printf printf sed then 'quoted text'
+		x=1 2>/dev/null then 2>/dev/null awk ${HOME} sed sed
+'quoted text' /usr/bin sed "$@" | $(pwd) "$1" "$@" sed /usr/bin
+		'quoted text' | then local ${HOME} -eu sed /usr/bin 2>/dev/null done "$@" sed
+	printf grep && 2>/dev/null x=1 printf export local 2>/dev/null readonly
+		${HOME} printf sed 2>/dev/null -eu 2>/dev/null
+printf done awk done then test printf 2>/dev/null done
+	--verbose sed sed $(pwd) "$1" && sed local readonly --verbose
+2>/dev/null export readonly x=1 done test
+	grep awk 2>/dev/null && local 2>/dev/null /usr/bin 'quoted text'
+		"$@" test sed 2>/dev/null && echo done | 'quoted text' cd | x=1 printf local
+	--verbose done /usr/bin then 'quoted text'
+${HOME} "$@" ${HOME} sed "$1" 2>/dev/null
+	'quoted text' test ${HOME} 'quoted text' -eu awk
+	&& test echo readonly printf awk sed 2>/dev/null
+		then local -eu printf done sed 2>/dev/null
+		/usr/bin then printf echo 2>/dev/null echo | 'quoted text'
+${HOME} $(pwd) && readonly "$@" cd echo | export $(pwd)
+		printf echo /usr/bin echo 2>/dev/null /usr/bin printf
+		"$1" then awk done done -eu "$1" "$@" readonly /usr/bin --verbose awk test
+test printf printf ${HOME} echo then
+	&& --verbose done export /usr/bin echo export && && awk test "$1" test
+		--verbose 2>/dev/null test printf printf --verbose local printf 2>/dev/null
+	sed "$1" then local then sed x=1 && /usr/bin
+	$(pwd) then && done -eu export grep grep readonly then local grep "$1" &&
+		readonly 2>/dev/null then test && "$1" $(pwd) awk | "$1"
+	-eu ${HOME} --verbose && $(pwd) awk /usr/bin readonly -eu 'quoted text'
+		| sed --verbose readonly done test awk done -eu 2>/dev/null /usr/bin test --verbose
+export && cd "$@" -eu readonly "$1" readonly grep
+sed | -eu --verbose sed 'quoted text' echo done "$1"
+cd export printf -eu $(pwd) ${HOME} local "$1" done printf -eu 'quoted text' /usr/bin
+		echo "$1" x=1 cd "$@" -eu test 2>/dev/null awk grep --verbose |
+${HOME} test test sed done "$1" done sed x=1 then printf test ${HOME}
+$(pwd) printf test export | "$1" | x=1
+"$1" export export then
+sed awk then awk $(pwd) /usr/bin
+		sed && done export readonly "$@" awk "$1" export
+| && | ${HOME} && printf 2>/dev/null printf "$@" sed test echo
+		x=1 grep local done awk 'quoted text' printf awk cd readonly then sed grep 2>/dev/null
+	x=1 ${HOME} awk grep test x=1 local x=1 readonly x=1 --verbose
+export cd $(pwd) | /usr/bin && echo $(pwd) readonly | -eu test awk ${HOME}
+	2>/dev/null done printf x=1 export 'quoted text' printf ${HOME} "$@" "$1" then |
+	printf /usr/bin ${HOME} echo "$@" 'quoted text' local export ${HOME}
+		&& test sed sed test then sed
+x=1 done x=1 "$1" 'quoted text' x=1
+&& done ${HOME} --verbose "$1" $(pwd) --verbose 2>/dev/null 'quoted text' done
+		${HOME} export && grep --verbose printf readonly "$@" "$1" -eu
+${HOME} awk cd echo --verbose &&
+		sed && ${HOME} local 2>/dev/null export done "$1"
+	'quoted text' local 'quoted text' printf grep
+sed echo printf cd then awk printf 2>/dev/null "$@" export --verbose
+done 2>/dev/null /usr/bin | sed cd printf | --verbose printf
+		-eu done awk "$1" /usr/bin sed --verbose /usr/bin
+done "$1" | "$1" cd /usr/bin "$1"
+	sed grep cd printf | awk $(pwd) | && sed
+-eu 2>/dev/null --verbose
+	${HOME} sed --verbose sed echo sed
+		"$@" -eu grep done cd 'quoted text' done 2>/dev/null
+$(pwd) | cd -eu cd 2>/dev/null -eu done && sed x=1 then
+echo 'quoted text' 'quoted text'
+local export done | local 2>/dev/null grep readonly readonly --verbose ${HOME}
+	cd | export done test cd "$1" "$1" readonly printf printf /usr/bin
+	'quoted text' test then grep export
+-eu && -eu 'quoted text' 2>/dev/null readonly ${HOME} echo local
+${HOME} test echo export "$1" then echo -eu then | 2>/dev/null echo sed &&
+		2>/dev/null test 'quoted text' -eu sed "$1" then sed |
+	test ${HOME} printf x=1 $(pwd) /usr/bin && grep export && done
+	grep --verbose cd "$1" && printf
+-eu local grep local "$@" ${HOME} "$@" done echo grep
+	"$1" awk "$1" --verbose readonly printf 2>/dev/null
+		printf test printf $(pwd) local --verbose awk --verbose && "$1" 'quoted text'
+grep done /usr/bin echo export x=1 /usr/bin readonly
+'quoted text' grep 2>/dev/null
+then --verbose sed --verbose -eu 'quoted text' -eu then sed $(pwd) printf && readonly
+	${HOME} awk 2>/dev/null "$@" -eu ${HOME}
+		export cd "$1" cd sed echo grep "$1" -eu ${HOME} 'quoted text' cd grep x=1 /usr/bin
+done 2>/dev/null sed "$@" x=1 /usr/bin grep awk --verbose 'quoted text'
+	printf readonly x=1 'quoted text'
+x=1 then grep ${HOME} cd cd --verbose then sed x=1 printf
+x=1 awk ${HOME} 2>/dev/null ${HOME} 'quoted text' && 'quoted text' 'quoted text'
+	export | 'quoted text' printf
+/usr/bin test done ${HOME}
+	$(pwd) sed test "$@"
+	x=1 /usr/bin readonly echo test printf
+	awk ${HOME} cd ${HOME} echo x=1 --verbose
+		printf --verbose grep done
+	awk then test cd grep x=1 'quoted text'
+		sed printf grep echo -eu "$@" /usr/bin cd "$@" sed /usr/bin && awk "$1"
+		local 'quoted text' 2>/dev/null 'quoted text' readonly
+	2>/dev/null readonly x=1 awk 2>/dev/null "$1" "$@" local printf then
+		--verbose "$1" export $(pwd) done x=1 readonly 'quoted text' --verbose sed sed
+		cd echo readonly done ${HOME} -eu $(pwd) x=1 cd then x=1 cd done 2>/dev/null
+| local $(pwd) "$1" && 2>/dev/null printf then | local cd printf ${HOME}
+2>/dev/null /usr/bin then echo /usr/bin ${HOME} then test local --verbose
+		local sed "$1" && sed "$@" printf cd export export
+x=1 printf done cd 2>/dev/null sed --verbose "$@" printf && test
+		done $(pwd) done 2>/dev/null printf
+	then x=1 x=1 /usr/bin $(pwd) ${HOME} export done -eu 'quoted text'
+		-eu grep readonly | --verbose readonly export
+local "$@" --verbose 2>/dev/null -eu awk awk sed -eu x=1 $(pwd)
+		sed grep | ${HOME} grep test then readonly -eu 2>/dev/null
+		done x=1 x=1 then 2>/dev/null
+2>/dev/null ${HOME} ${HOME} -eu test awk printf awk -eu sed
+		$(pwd) /usr/bin sed "$@" $(pwd) 'quoted text'
+$(pwd) -eu then done awk x=1 'quoted text'
+	then 'quoted text' export sed /usr/bin -eu /usr/bin readonly $(pwd)
+printf && sed | 'quoted text' --verbose "$1" $(pwd) 'quoted text'
+		"$@" "$@" -eu "$1" 2>/dev/null sed
+		cd local echo grep x=1 local local
+then "$@" export sed ${HOME} "$1" 2>/dev/null
+	$(pwd) echo export done awk echo local -eu echo echo "$1" "$@" | ${HOME}
+	$(pwd) awk ${HOME} export "$1" "$1"
+		'quoted text' awk $(pwd) ${HOME} printf readonly export
+-eu "$@" 'quoted text' && 'quoted text' printf
+'quoted text' ${HOME} /usr/bin awk "$1"
+	"$@" echo test awk printf test -eu local 2>/dev/null
+/usr/bin printf sed "$@" printf echo grep && cd $(pwd) | $(pwd) && sed readonly
+sed done done export readonly readonly export "$1" test cd 2>/dev/null $(pwd)
+		'quoted text' "$1" then echo && x=1 awk
+printf local /usr/bin "$@" --verbose "$1" sed export then &&
+		echo 'quoted text' x=1 sed && cd "$@" 'quoted text' | awk /usr/bin "$@" -eu readonly
+		"$1" x=1 echo --verbose local readonly grep | "$@" x=1 ${HOME}
+	x=1 test sed ${HOME} $(pwd) /usr/bin | local $(pwd) 'quoted text' echo awk then
+${HOME} 2>/dev/null $(pwd) /usr/bin $(pwd) then done echo export && x=1
+	2>/dev/null echo | | | sed test
+	2>/dev/null printf /usr/bin awk ${HOME} printf cd export $(pwd) /usr/bin
+	"$@" local $(pwd) 'quoted text' cd && "$@" sed "$@" $(pwd) grep printf
+		cd printf sed ${HOME} awk test done --verbose /usr/bin test ${HOME}
+		awk && 2>/dev/null 'quoted text' test && grep readonly /usr/bin grep $(pwd) local
+--verbose test export echo 'quoted text'
+		&& awk 'quoted text' 2>/dev/null --verbose grep ${HOME}
+	/usr/bin grep && done 2>/dev/null x=1 grep local $(pwd)
+		'quoted text' /usr/bin grep echo $(pwd) x=1 readonly local "$@"
+	printf cd done "$1" echo export /usr/bin cd --verbose -eu test "$@" -eu test
+		done 2>/dev/null ${HOME}
+	awk -eu /usr/bin "$@" ${HOME} local ${HOME} sed then grep /usr/bin
+--verbose -eu --verbose /usr/bin ${HOME}
+	export done /usr/bin test
+	grep test $(pwd) readonly && then && echo readonly
+awk "$@" echo /usr/bin x=1
+		--verbose echo --verbose awk /usr/bin local done
+/usr/bin -eu then | ${HOME} awk readonly local printf "$@" sed | printf
+-eu grep x=1 ${HOME} cd grep grep printf sed readonly
+test ${HOME} "$@" awk printf echo echo readonly "$@" then then | sed
+2>/dev/null "$1" done -eu sed "$1" export readonly && 2>/dev/null cd 2>/dev/null
+		-eu cd grep x=1 --verbose 'quoted text'
+echo local -eu && ${HOME} printf echo "$@" local readonly sed printf "$@" "$@"
+	/usr/bin | awk "$@" grep echo printf
+export cd $(pwd) grep $(pwd) /usr/bin | then grep -eu awk test /usr/bin
+		readonly "$@" sed && sed export -eu echo "$1" ${HOME}
+		| /usr/bin x=1 done x=1 export printf local
+	printf x=1 'quoted text' readonly
+		printf "$1" x=1 2>/dev/null local "$1" grep printf /usr/bin cd echo
+	then "$1" cd "$@" awk
+	'quoted text' "$1" cd echo done echo --verbose $(pwd) test /usr/bin
+-eu local -eu "$1" export done
+"$@" x=1 /usr/bin sed cd --verbose cd && readonly grep "$1" printf
+export echo then x=1 x=1 test cd then readonly
+		"$@" grep --verbose /usr/bin $(pwd) grep && ${HOME}
+		sed 2>/dev/null "$@" x=1 sed $(pwd) cd -eu --verbose then
+		--verbose cd 2>/dev/null echo test cd sed 'quoted text'
+		"$1" /usr/bin /usr/bin | test
+readonly 2>/dev/null test grep x=1 then "$1" echo readonly export echo readonly
+		local x=1 printf | && x=1 "$@" test grep --verbose awk
+then --verbose | && then export ${HOME} sed && then "$1" 2>/dev/null 'quoted text'
+		grep x=1 readonly && grep echo echo awk && test 2>/dev/null
+		'quoted text' x=1 export $(pwd) cd echo done awk local && /usr/bin echo
+	echo cd "$@" grep sed /usr/bin /usr/bin x=1
+2>/dev/null printf --verbose readonly
+	cd readonly ${HOME} x=1 then echo && 2>/dev/null sed $(pwd) local && cd
+	'quoted text' awk /usr/bin echo && 'quoted text' test echo echo "$1"
+--verbose awk awk $(pwd) export grep test -eu "$1" sed then -eu 'quoted text'
+		"$1" cd then $(pwd) |
+	done done printf -eu -eu 2>/dev/null ${HOME} printf &&
+	sed awk && --verbose && test echo
+		sed 2>/dev/null done local echo 2>/dev/null | x=1 grep
+		"$1" 'quoted text' $(pwd) $(pwd) printf $(pwd) done cd printf -eu ${HOME} grep
+readonly printf sed $(pwd) x=1 sed
+		"$@" export && --verbose
+		-eu cd 'quoted text' cd sed cd readonly | "$@" echo | 'quoted text'
+	"$@" grep 'quoted text' awk && $(pwd) --verbose cd ${HOME}
+readonly && && x=1 /usr/bin | -eu "$@" test readonly cd /usr/bin
+then test | /usr/bin awk &&
+cd && cd local --verbose -eu cd $(pwd)
+| "$1" cd cd done /usr/bin 'quoted text' done | awk 'quoted text' then
+	'quoted text' local cd
+		-eu local readonly sed cd 'quoted text' sed test "$@" 'quoted text'
+cd export test cd local readonly -eu export ${HOME} --verbose readonly
+	echo 2>/dev/null /usr/bin x=1 "$@" echo printf
+		| x=1 cd test awk readonly $(pwd) /usr/bin
+test sed "$@" --verbose -eu && "$@" "$1" --verbose 'quoted text'
+x=1 'quoted text' "$1" then --verbose $(pwd) -eu
+		export "$1" 'quoted text' local -eu echo ${HOME} x=1 sed
+readonly sed sed cd echo ${HOME} 'quoted text' grep | "$@" /usr/bin /usr/bin
+${HOME} awk "$@" 'quoted text'
+		-eu then 2>/dev/null export "$1" 'quoted text'
+		${HOME} export echo cd sed readonly
+	then $(pwd) 'quoted text' && awk cd then -eu "$1" local then "$@" --verbose
+	sed 'quoted text' awk "$1" sed export -eu then
+		export test export sed echo awk done sed -eu x=1
+	$(pwd) grep readonly printf readonly
+export then sed cd local -eu grep then echo grep --verbose printf sed "$@" readonly
+		/usr/bin --verbose then 2>/dev/null
+		echo ${HOME} "$1" local -eu 'quoted text' --verbose readonly
+		'quoted text' /usr/bin export
+		x=1 2>/dev/null | && ${HOME} then echo grep done
+'quoted text' ${HOME} echo export x=1 awk cd
+	| awk /usr/bin "$1" then $(pwd) 'quoted text' "$1" test "$@"
+awk /usr/bin then | cd done grep 'quoted text' | readonly
+sed ${HOME} && 2>/dev/null grep local 2>/dev/null
+	sed --verbose done --verbose "$@" readonly ${HOME}
+		echo awk "$@" then test then local export export ${HOME} cd --verbose
+| sed sed 2>/dev/null /usr/bin
+	2>/dev/null "$@" awk grep done ${HOME} --verbose sed /usr/bin then
+		done printf /usr/bin "$@" test "$1" printf
+	test ${HOME} echo x=1 export grep $(pwd) "$1" && cd && printf export export
+		done test done "$@" then "$1" then export test -eu done && "$@" test
+		echo --verbose export test x=1 cd "$1"
+"$@" echo grep && /usr/bin x=1 awk
+		then && sed x=1 $(pwd) 2>/dev/null /usr/bin
+		sed awk cd $(pwd) "$@" grep | ${HOME}
+'quoted text' export "$1" cd local
+| awk local "$1" export ${HOME}
+	x=1 --verbose readonly 'quoted text' 'quoted text' test sed -eu then
+		done cd grep echo /usr/bin /usr/bin 'quoted text' readonly export "$@" ${HOME}
+	echo ${HOME} --verbose "$1" echo -eu grep awk echo && | && ${HOME} done
+		done export -eu echo "$1" grep echo ${HOME} printf echo
+		-eu 'quoted text' local "$@" -eu sed cd test readonly
+		x=1 done 'quoted text' /usr/bin $(pwd) 2>/dev/null local "$1" x=1 then 'quoted text'
+$(pwd) grep readonly | test echo x=1 local then done
+	cd -eu 2>/dev/null local
+		local x=1 local cd export && grep | /usr/bin $(pwd) -eu printf -eu
+	export "$1" readonly export | printf && x=1 cd $(pwd) grep /usr/bin
+sed awk echo && test printf 'quoted text' &&
+"$@" printf export && --verbose cd awk -eu export | | 'quoted text'
+	then "$@" then ${HOME} --verbose 2>/dev/null "$@" printf
+&& --verbose grep echo sed sed readonly -eu x=1 printf
+	readonly then then -eu
+grep done cd cd | grep | export
+	sed local done 2>/dev/null
+readonly test cd export "$1" "$1" printf readonly 'quoted text'
+	local sed /usr/bin printf 'quoted text'
+	x=1 $(pwd) local sed /usr/bin local test test printf printf then local
+export local sed sed x=1 x=1 'quoted text' done "$1" done export
+		grep --verbose local local $(pwd) awk sed export
+		-eu 2>/dev/null 'quoted text' done "$@" x=1 sed /usr/bin 2>/dev/null --verbose
+	x=1 ${HOME} /usr/bin then $(pwd) done | grep awk 2>/dev/null -eu
+"$1" then local $(pwd) export $(pwd) ${HOME} awk sed cd
+	2>/dev/null echo printf test "$1" grep "$1" then -eu grep $(pwd) done
+'quoted text' "$@" |
+awk grep x=1 && "$@" awk done local
+	cd printf "$1" export printf then --verbose sed && sed printf x=1 test
+		test 2>/dev/null readonly --verbose $(pwd) -eu local export -eu
+	$(pwd) 'quoted text' && | && "$@" && echo
+		cd printf "$1" export -eu done export --verbose ${HOME} echo grep
+	'quoted text' ${HOME} export awk sed 2>/dev/null done 'quoted text'
+		2>/dev/null test -eu export
+		"$1" ${HOME} --verbose x=1 $(pwd) awk --verbose
+		&& sed | local test grep test echo && 'quoted text'
+		local grep printf cd ${HOME} then sed then
+--verbose readonly cd export local ${HOME} 'quoted text' export awk local 'quoted text'
+		sed && grep cd printf | readonly 2>/dev/null -eu then 'quoted text'
+	${HOME} readonly --verbose printf /usr/bin
+	2>/dev/null done local 'quoted text' |
+echo "$1" x=1 printf grep /usr/bin
+"$1" -eu printf echo sed
+		'quoted text' test --verbose | "$@" echo export echo
+	grep -eu && /usr/bin local $(pwd) echo sed "$1" export "$1"
+		awk grep /usr/bin test 2>/dev/null --verbose x=1 $(pwd) grep then cd -eu test
+	$(pwd) -eu "$@" 2>/dev/null
+	x=1 done ${HOME} sed then cd grep && /usr/bin ${HOME} | ${HOME}
+		test | ${HOME} "$@" $(pwd) then printf 2>/dev/null
+	test cd x=1 2>/dev/null ${HOME} 'quoted text' local echo | $(pwd) readonly |
+		"$1" export ${HOME} cd -eu
+		readonly -eu cd local then grep --verbose --verbose awk
+		| ${HOME} sed | readonly grep ${HOME} readonly
+		"$1" printf x=1 'quoted text'
+done 2>/dev/null | x=1 export "$1" --verbose 2>/dev/null && --verbose export
+		printf 'quoted text' export
+		readonly awk test awk && printf $(pwd) $(pwd) echo
+		&& ${HOME} && -eu "$1" test "$@"
+		local export $(pwd) echo grep -eu grep x=1 ${HOME} "$@" -eu
+		2>/dev/null 2>/dev/null grep 2>/dev/null --verbose
+	test 'quoted text' "$@" x=1 -eu awk readonly x=1 $(pwd) readonly then $(pwd)
+echo grep --verbose "$@" readonly ${HOME} sed /usr/bin awk --verbose --verbose
+	sed export | /usr/bin 'quoted text' 2>/dev/null then echo export 'quoted text'
+&& local then /usr/bin cd readonly echo "$1" ${HOME} "$@"
+	$(pwd) ${HOME} test ${HOME} x=1 test export then && test export x=1 local x=1
+sed awk "$@" 'quoted text' test "$1"
+	echo readonly "$@" printf | x=1 ${HOME} "$@" local ${HOME}
+	export /usr/bin grep 'quoted text' --verbose printf awk echo
+	&& "$1" "$1" local then /usr/bin $(pwd) --verbose printf printf
+		awk $(pwd) test readonly cd "$@"
+	cd /usr/bin done readonly
+		grep /usr/bin ${HOME} 2>/dev/null cd done export echo echo readonly
+	test x=1 "$1" ${HOME} test -eu sed && awk export sed cd echo
+		&& local | test && /usr/bin 'quoted text' "$1" && readonly
+	$(pwd) readonly ${HOME} printf | --verbose then
+	echo test sed local grep x=1 done ${HOME} test x=1 grep
+cd readonly --verbose 'quoted text'
+		--verbose -eu --verbose sed $(pwd) | then "$1" 'quoted text' 2>/dev/null readonly
+cd $(pwd) export cd then | && -eu ${HOME}
+	$(pwd) && | awk awk awk echo awk cd done 2>/dev/null export echo x=1 test cd
+| /usr/bin grep | local cd done /usr/bin "$@" cd readonly
+/usr/bin /usr/bin printf 'quoted text' --verbose && | -eu
+		${HOME} sed readonly done readonly readonly done export "$@" export -eu x=1
+	"$1" readonly --verbose local x=1 then then --verbose done done x=1 "$@"
+export printf -eu ${HOME} export 2>/dev/null x=1 "$@" 'quoted text' $(pwd)
+	${HOME} -eu awk export --verbose ${HOME} then awk
+	| "$@" printf grep --verbose "$@" test -eu && printf
+x=1 x=1 then echo /usr/bin "$1" "$1" | 'quoted text' "$@" ${HOME} printf 2>/dev/null
+	2>/dev/null then /usr/bin test -eu
+	awk $(pwd) done then readonly 2>/dev/null /usr/bin 'quoted text' then && | export
+		"$@" awk 2>/dev/null test --verbose /usr/bin 'quoted text' -eu
+		"$@" "$@" -eu test sed local 'quoted text' 2>/dev/null -eu awk |
+	$(pwd) $(pwd) then -eu ${HOME} done --verbose grep test
+	/usr/bin grep -eu then export ${HOME} "$1" 'quoted text' printf $(pwd) 'quoted text'
+		sed && "$@" done /usr/bin sed 2>/dev/null ${HOME}
+printf readonly 2>/dev/null && && "$@" /usr/bin sed sed
+	test export && then $(pwd) 'quoted text' --verbose printf x=1 --verbose
+then done then printf ${HOME} printf grep readonly "$1" ${HOME} && $(pwd) /usr/bin
+		$(pwd) "$@" ${HOME} echo 'quoted text' awk printf
+awk "$@" local $(pwd) -eu awk 'quoted text'
+'quoted text' readonly done
+then done readonly /usr/bin 2>/dev/null 'quoted text' local /usr/bin
+		echo $(pwd) readonly local x=1 done && test readonly "$@" grep printf
+"$1" cd /usr/bin --verbose
+	sed -eu export "$1" 2>/dev/null local 'quoted text' local
+	&& $(pwd) /usr/bin printf $(pwd) cd local readonly readonly "$1"
+--verbose "$@" && sed "$@" $(pwd) --verbose
+	grep awk cd grep echo "$@" 2>/dev/null /usr/bin "$1" -eu "$@"
+		| x=1 grep x=1 readonly "$1" "$@" "$@" export
+| /usr/bin printf $(pwd) export echo local
+		'quoted text' echo 2>/dev/null awk /usr/bin
+		x=1 ${HOME} readonly --verbose
+		/usr/bin x=1 echo --verbose x=1 x=1
+local printf echo $(pwd) done $(pwd) && export echo ${HOME} 2>/dev/null printf
+	/usr/bin 2>/dev/null cd echo sed
+		done cd local 2>/dev/null x=1 --verbose $(pwd) x=1 --verbose 'quoted text' sed x=1
+	2>/dev/null 2>/dev/null cd export --verbose && awk readonly cd -eu ${HOME}
+		done then grep $(pwd)
+--verbose cd 2>/dev/null && | x=1 test x=1 printf grep -eu ${HOME}
+| /usr/bin done test x=1 test --verbose $(pwd) local 2>/dev/null
+		"$@" local awk local export
+	awk 2>/dev/null grep cd /usr/bin sed "$1" | --verbose
+		x=1 awk cd echo ${HOME} printf
+	readonly grep 'quoted text' export -eu 2>/dev/null
+readonly "$1" ${HOME} /usr/bin "$@" 'quoted text'
+2>/dev/null readonly --verbose
+		then && done -eu local sed echo x=1 "$@" sed grep sed test --verbose
+	"$@" done test 'quoted text' --verbose local printf && && then echo test awk --verbose
+&& test export local 2>/dev/null cd echo printf
+	then --verbose local && grep "$@" test then test ${HOME} export
+		x=1 $(pwd) x=1 ${HOME} && 'quoted text' echo readonly export 'quoted text'
+2>/dev/null readonly printf awk ${HOME} "$@" cd | && cd && "$@"
+		test $(pwd) readonly cd $(pwd) done | sed
+		x=1 2>/dev/null export x=1 /usr/bin -eu done x=1 "$@"
+	-eu x=1 sed -eu $(pwd) && "$1" then
+2>/dev/null $(pwd) "$@" printf sed /usr/bin "$@" 2>/dev/null ${HOME} cd printf
+	| export && readonly /usr/bin 2>/dev/null
+printf /usr/bin export printf export | ${HOME}
+		readonly grep "$@" -eu "$@"
+	2>/dev/null ${HOME} ${HOME} local -eu sed local test grep 2>/dev/null
+		"$@" test test $(pwd) printf cd echo ${HOME} awk cd $(pwd) /usr/bin
+	'quoted text' awk then sed
+echo $(pwd) sed -eu -eu printf "$1" 'quoted text'
+done readonly /usr/bin cd x=1 ${HOME} -eu $(pwd) -eu readonly readonly local echo
+	test export readonly cd ${HOME} done
+		'quoted text' test echo echo done $(pwd) --verbose ${HOME} test
+		${HOME} sed /usr/bin -eu /usr/bin test cd test export 'quoted text' test
+cd 'quoted text' "$1" |
+		'quoted text' | 'quoted text'
+"$@" "$1" cd sed awk ${HOME} echo echo /usr/bin
+'quoted text' cd | --verbose && test
+	then done cd export "$1" test
+	export 2>/dev/null && done awk test then
+		/usr/bin ${HOME} grep /usr/bin cd $(pwd) x=1 'quoted text'
+	test "$@" x=1 /usr/bin $(pwd) export
+x=1 ${HOME} ${HOME} -eu done x=1 "$@" 2>/dev/null /usr/bin done $(pwd) -eu grep
+	done sed 'quoted text' cd | readonly export ${HOME} -eu
+echo 'quoted text' && 'quoted text'
+	&& 'quoted text' | printf export readonly 2>/dev/null local awk grep
+		export --verbose "$@" test local
+local cd done --verbose awk
+readonly "$1" local cd sed && "$@" awk /usr/bin sed /usr/bin done sed "$1"
+		x=1 printf $(pwd) local printf | echo
+test test -eu --verbose local awk --verbose
+		cd export readonly export --verbose then awk $(pwd) 'quoted text' ${HOME}
+		awk grep export 2>/dev/null
+2>/dev/null $(pwd) x=1 'quoted text' 2>/dev/null
+		'quoted text' -eu cd | sed && then done then
+| /usr/bin echo awk -eu done x=1 readonly $(pwd) && then echo grep | | local
+readonly awk 'quoted text' /usr/bin /usr/bin echo readonly /usr/bin
+	printf local 'quoted text' printf /usr/bin ${HOME} echo --verbose
+		grep local -eu echo | awk 'quoted text' echo | sed | && then
+	sed sed "$1" grep /usr/bin | -eu --verbose readonly
+	grep 'quoted text' printf ${HOME} $(pwd) 2>/dev/null
+		$(pwd) $(pwd) --verbose
+		local awk "$@" --verbose test sed printf 'quoted text' local done test
+sed sed "$@" echo "$@" printf
+		done x=1 "$@" /usr/bin $(pwd) printf readonly local awk -eu grep then | done
+	local sed then sed ${HOME} local ${HOME}
+		&& --verbose cd "$1" export done awk -eu -eu grep x=1 "$1" cd x=1 | export done
+	| grep printf --verbose test cd grep
+		&& "$@" $(pwd) 'quoted text'
+sed sed cd | printf cd local
+		--verbose -eu readonly cd "$@" x=1 local printf echo $(pwd) then local -eu /usr/bin
+	printf echo export 'quoted text' grep sed -eu export ${HOME}
+--verbose x=1 2>/dev/null -eu | echo readonly
+	2>/dev/null printf then cd "$@" awk x=1
+		&& readonly export ${HOME} test "$1" $(pwd) -eu export
+	$(pwd) "$1" printf | readonly --verbose sed export ${HOME}
+	-eu -eu | sed "$@" "$@" $(pwd) export export cd printf | awk --verbose sed
+	x=1 | "$1" export awk readonly grep x=1 /usr/bin 2>/dev/null
+		| echo "$@" awk | 2>/dev/null -eu then test
+		readonly | && done 'quoted text' printf printf readonly
+	"$@" $(pwd) test printf export local awk -eu 2>/dev/null local then $(pwd)
+--verbose 2>/dev/null grep then 'quoted text' local sed ${HOME} readonly && sed
+-eu 2>/dev/null cd 2>/dev/null grep ${HOME} done then x=1
+	--verbose $(pwd) "$@" $(pwd) printf 'quoted text' ${HOME} --verbose done done then
+	local --verbose test && sed /usr/bin ${HOME} 2>/dev/null && --verbose
+		--verbose test echo export then "$@" &&
+		done readonly 'quoted text' x=1 cd printf && "$@" echo then sed
+		$(pwd) done ${HOME} readonly 'quoted text' --verbose cd sed sed
+	sed /usr/bin cd "$1" test | ${HOME} grep -eu x=1
+	cd 'quoted text' awk echo | done test x=1 $(pwd) done
+local $(pwd) | test $(pwd) readonly x=1 readonly local
+		local test 'quoted text' --verbose 'quoted text' done echo 2>/dev/null
+$(pwd) sed echo then echo echo
+	"$1" $(pwd) $(pwd) 2>/dev/null local 2>/dev/null && awk -eu
+	"$@" | awk cd export ${HOME} readonly $(pwd)
+		awk -eu awk | "$1" 'quoted text' then readonly /usr/bin ${HOME} --verbose
+		local sed -eu "$@" sed --verbose
+	export cd /usr/bin sed "$1" --verbose
+cd $(pwd) "$1" sed export "$1" printf printf && $(pwd) cd ${HOME}
+		done test ${HOME} then cd done -eu local cd x=1
+		test && $(pwd) readonly 2>/dev/null
+	| "$1" && ${HOME} sed grep /usr/bin printf local |
+	test "$@" $(pwd) --verbose "$@" grep | local readonly "$@" -eu "$1" "$1" "$1"
+	echo local grep "$1" echo 2>/dev/null $(pwd) sed cd /usr/bin 2>/dev/null -eu
+local echo done then x=1 $(pwd) echo "$1" | echo --verbose echo readonly
+		printf x=1 printf then readonly
+	-eu echo 2>/dev/null --verbose cd sed echo sed -eu done | done grep
+	readonly test ${HOME} export 'quoted text' x=1 --verbose
+		-eu x=1 echo ${HOME} -eu awk sed awk
+	echo "$1" readonly -eu readonly /usr/bin "$1" x=1 done && cd ${HOME} $(pwd) grep
+${HOME} --verbose test 2>/dev/null
+/usr/bin ${HOME} -eu done --verbose sed sed -eu cd | --verbose ${HOME} then
+	$(pwd) "$@" -eu readonly grep | readonly cd grep export grep --verbose
+export x=1 echo cd awk printf -eu | 'quoted text'
+"$1" cd x=1 $(pwd) readonly awk "$@" cd
+	local 2>/dev/null printf
+		printf export && -eu grep export then ${HOME}
+local done "$@" /usr/bin done 'quoted text' printf
+		'quoted text' -eu -eu /usr/bin 2>/dev/null
+	&& ${HOME} x=1 export | --verbose
+$(pwd) "$1" printf then ${HOME} "$1" 'quoted text' ${HOME}
+	printf export readonly readonly grep "$1" test awk | cd $(pwd)
+	/usr/bin cd "$@" | x=1 awk grep
+	done 2>/dev/null -eu /usr/bin $(pwd) /usr/bin && "$@" 2>/dev/null --verbose
+	awk -eu sed awk cd test printf && awk awk 'quoted text'
+		-eu ${HOME} then ${HOME} ${HOME} then "$1" cd
+	export -eu grep --verbose printf local export printf
+echo -eu grep export /usr/bin sed
+		$(pwd) -eu ${HOME} local local $(pwd) test --verbose grep "$@" --verbose
+	then 'quoted text' awk --verbose
+	local sed sed 'quoted text'
+		readonly cd 2>/dev/null ${HOME} $(pwd) export -eu -eu
+		then $(pwd) 'quoted text' done sed $(pwd) "$@" sed awk /usr/bin x=1 "$@"
+local -eu readonly readonly /usr/bin && 'quoted text'
+export "$1" awk 'quoted text'
+printf export x=1 2>/dev/null done cd && test
+grep $(pwd) && printf done && /usr/bin export
+done cd awk $(pwd) cd && ${HOME}
+		grep printf then grep
+	--verbose printf awk echo x=1 test export | export
+		done cd local awk then | $(pwd) awk -eu done readonly local
+2>/dev/null --verbose $(pwd) | cd export cd 'quoted text' 2>/dev/null
+		--verbose test "$@" x=1 /usr/bin && cd -eu "$@" ${HOME}
+awk x=1 local grep readonly "$1" x=1 /usr/bin -eu
+		awk 2>/dev/null export local /usr/bin 'quoted text'
+	&& $(pwd) cd done printf x=1 export done export echo
+sed && test ${HOME} /usr/bin
+		sed then && cd --verbose printf | $(pwd) 2>/dev/null | done /usr/bin | ${HOME}
+printf test test $(pwd) grep x=1 "$@" ${HOME} $(pwd) readonly printf
+/usr/bin "$1" cd echo test --verbose ${HOME} ${HOME}
+	printf export -eu "$@" | /usr/bin 2>/dev/null && && readonly ${HOME} grep
+	awk export "$1" awk "$@" | cd local
+	export --verbose && test --verbose
+--verbose x=1 && cd printf x=1 && $(pwd) awk test ${HOME} grep cd ${HOME} awk
+	"$1" x=1 | | cd /usr/bin done 'quoted text' 'quoted text' printf ${HOME}
+'quoted text' then --verbose
+	"$1" x=1 grep /usr/bin /usr/bin done test local
+	grep sed sed cd && --verbose test $(pwd) sed "$1" cd x=1 --verbose sed
+export "$@" --verbose x=1 cd export | done sed 'quoted text'
+export --verbose -eu sed 2>/dev/null export then x=1 /usr/bin
+	2>/dev/null then | echo /usr/bin
+readonly export 'quoted text'
+/usr/bin sed --verbose
+--verbose done | done readonly echo | grep | readonly $(pwd) awk grep 'quoted text'
+	done --verbose printf
+		| grep printf echo test sed awk | then "$1" -eu x=1 2>/dev/null
+awk x=1 cd | && then sed 2>/dev/null -eu ${HOME}
+	--verbose && | --verbose 2>/dev/null /usr/bin echo grep /usr/bin 'quoted text'
+		test | then /usr/bin 2>/dev/null -eu x=1 awk then -eu -eu "$@" echo grep
+	echo readonly "$@" grep grep
+		--verbose export ${HOME} $(pwd) then echo x=1 local | then | --verbose
+local 'quoted text' ${HOME} printf | --verbose /usr/bin
+sed ${HOME} done grep && readonly
+	grep awk /usr/bin awk "$@" export x=1 cd ${HOME} sed readonly /usr/bin --verbose
+		cd 'quoted text' done grep x=1 2>/dev/null "$@" 'quoted text' -eu done $(pwd)
+	test then /usr/bin "$@" 2>/dev/null then then
+printf export printf /usr/bin -eu --verbose 'quoted text'
+		awk export cd then /usr/bin $(pwd) x=1 ${HOME} readonly sed $(pwd)
+-eu cd 'quoted text' -eu &&
+		grep awk /usr/bin awk "$1" "$@" readonly
+	-eu x=1 awk x=1 test 2>/dev/null sed awk --verbose sed $(pwd) sed
+		sed then echo sed | sed readonly cd 'quoted text' then "$1" -eu export
+export && ${HOME} 'quoted text' test --verbose /usr/bin $(pwd)
+		2>/dev/null /usr/bin grep export -eu /usr/bin test printf -eu echo "$@" 'quoted text'
+		awk local "$@" test then /usr/bin readonly | printf
+		test $(pwd) | x=1 grep awk x=1 then && export echo
+${HOME} --verbose --verbose
+	echo "$1" echo /usr/bin awk echo /usr/bin 2>/dev/null cd grep local
+	local test done awk awk printf local "$1" x=1 test --verbose x=1 cd $(pwd)
+'quoted text' test "$1" then | --verbose --verbose --verbose done ${HOME}
+	&& && && ${HOME} /usr/bin
+printf local 2>/dev/null test $(pwd) 'quoted text' test
+${HOME} printf -eu "$1" -eu 'quoted text'
+		2>/dev/null | x=1 -eu | && ${HOME} cd printf && local test local $(pwd) | "$1" $(pwd)
+		'quoted text' local echo echo 2>/dev/null local "$@"
+		printf awk $(pwd) -eu "$1" local readonly printf ${HOME} readonly grep
+		2>/dev/null sed -eu | echo x=1 | cd 'quoted text' "$1"
+	&& 'quoted text' done && cd && cd
+	local --verbose 2>/dev/null /usr/bin
+echo ${HOME} printf then
+"$1" $(pwd) cd --verbose | /usr/bin grep "$1" $(pwd) test -eu ${HOME} grep
+		x=1 printf && "$@" 2>/dev/null awk --verbose $(pwd)
+		| test done && printf | /usr/bin
+echo sed printf | --verbose cd ${HOME}
+		--verbose x=1 ${HOME} readonly x=1 "$@" 2>/dev/null && export grep grep x=1 "$1"
+		cd | | $(pwd) $(pwd) /usr/bin "$1" sed then -eu
+	$(pwd) sed ${HOME} && then export
+		$(pwd) -eu 2>/dev/null ${HOME} && awk 'quoted text' 'quoted text' export 'quoted text'
+	awk awk "$@" printf awk
+readonly readonly then | cd local grep
+	awk 'quoted text' test awk local sed readonly test --verbose
+| echo printf grep echo then export sed x=1 --verbose | echo x=1 cd cd
+printf done cd export ${HOME} grep --verbose
+		test done local 2>/dev/null /usr/bin
+		test --verbose x=1 cd sed x=1 2>/dev/null then 'quoted text' ${HOME}
+		&& awk test sed export 'quoted text' then
+	$(pwd) export $(pwd) /usr/bin echo "$@" 'quoted text' /usr/bin grep then test
+&& x=1 "$1" then /usr/bin ${HOME} export --verbose /usr/bin "$1"
+"$@" "$@" -eu "$1" $(pwd) | done printf x=1 sed awk
+-eu then ${HOME} export -eu local && export -eu readonly awk
+2>/dev/null | export |
+		"$1" done printf printf grep 'quoted text'
+		printf grep done printf -eu $(pwd) local awk then 2>/dev/null
+		awk $(pwd) cd awk grep grep x=1 readonly local sed x=1 awk --verbose
+		2>/dev/null $(pwd) | && printf 'quoted text' ${HOME} local | "$@"
+		cd test 'quoted text' && | --verbose "$1" | x=1 grep then echo --verbose readonly
+cd x=1 'quoted text' --verbose
+	| ${HOME} local x=1 "$1" awk sed | 'quoted text' readonly | grep test sed ${HOME}
+'quoted text' test x=1 then echo printf x=1 printf echo export
+		${HOME} $(pwd) ${HOME} ${HOME} readonly x=1 readonly | && 'quoted text'
+		"$@" "$1" 2>/dev/null then printf "$@" "$1" printf local cd && done && 'quoted text'
+		readonly --verbose grep done cd /usr/bin printf awk then $(pwd) /usr/bin
+	/usr/bin printf 'quoted text' done done "$1" --verbose
+	--verbose awk then readonly readonly
+	&& local ${HOME} 'quoted text'
+awk awk readonly cd printf "$@" readonly local then ${HOME} /usr/bin
+	awk -eu awk printf grep readonly cd
+		cd -eu then cd x=1 --verbose test readonly echo sed grep export
+sed printf done | && awk awk test printf done test "$@" readonly
+		x=1 -eu cd "$@" grep --verbose cd printf awk awk "$1" sed x=1
+	printf | 2>/dev/null cd then 2>/dev/null
+	then 2>/dev/null x=1 awk $(pwd) /usr/bin awk sed readonly
+	&& awk readonly --verbose -eu 'quoted text' --verbose printf 'quoted text' && x=1
+	--verbose readonly ${HOME} grep
+	awk printf awk printf "$1" "$@" ${HOME} "$1" test
+		test export | sed 2>/dev/null cd 'quoted text'
+	&& x=1 awk done $(pwd) "$1" 'quoted text' ${HOME}
+/usr/bin echo $(pwd) export
+		"$@" $(pwd) 'quoted text' local
+echo -eu printf test "$@" then printf "$1" readonly "$1" "$1" | | awk
+		printf test --verbose local echo -eu "$1" --verbose
+then -eu x=1 --verbose $(pwd) x=1 done x=1 then --verbose $(pwd) -eu
+&& --verbose ${HOME} -eu -eu | $(pwd) then awk -eu echo
+		echo local "$1" cd printf test awk export test x=1 $(pwd) local
+		test $(pwd) cd && /usr/bin
+		"$1" 'quoted text' printf local cd cd 2>/dev/null "$@" && awk export
+	/usr/bin && test && "$@" done done x=1 cd cd /usr/bin echo
+x=1 $(pwd) && "$1" 2>/dev/null --verbose "$@" /usr/bin 2>/dev/null sed
+| /usr/bin -eu then readonly cd 'quoted text' cd done printf 'quoted text'
+2>/dev/null sed export test
+	/usr/bin 'quoted text' "$@" 'quoted text' readonly sed readonly cd
+cd cd printf 'quoted text' 'quoted text' done $(pwd)
+		grep readonly printf && local export x=1 ${HOME} done "$1"
+&& printf && --verbose x=1 printf
+awk x=1 "$1" | echo local awk 'quoted text' awk export
+		echo 'quoted text' "$1" printf && --verbose test 2>/dev/null sed 2>/dev/null
+		grep 2>/dev/null echo then
+/usr/bin | export then echo printf /usr/bin done readonly x=1 awk /usr/bin
+--verbose 'quoted text' readonly 'quoted text'
+local export /usr/bin done "$@" | $(pwd) local cd cd
+		"$1" /usr/bin sed export printf x=1 /usr/bin ${HOME}
+export local "$1" "$1" ${HOME} then /usr/bin ${HOME} && 'quoted text'
+		| cd sed 'quoted text' export
+		grep 2>/dev/null ${HOME} echo -eu "$1" | 2>/dev/null awk echo export ${HOME}
+		then echo 2>/dev/null /usr/bin test "$@" cd 2>/dev/null done grep x=1 test done
+		"$@" grep test export export /usr/bin | local "$1" 'quoted text' printf 2>/dev/null
+	-eu ${HOME} printf x=1 2>/dev/null ${HOME}
+		test test $(pwd) 2>/dev/null test then done --verbose
+test cd awk test sed sed cd 'quoted text'
+		sed grep | 2>/dev/null --verbose "$1" "$1" readonly /usr/bin
+		$(pwd) | && ${HOME} done printf grep && grep local then test -eu cd "$1" /usr/bin
+	echo && readonly "$@" done "$@" done test
+		"$1" done "$1" /usr/bin $(pwd) awk --verbose x=1
+printf --verbose readonly "$1"
+	grep -eu cd $(pwd) x=1 local
+	"$1" ${HOME} sed 'quoted text' echo local test 'quoted text' then && readonly
+		| "$@" 2>/dev/null grep | /usr/bin
+	test local local $(pwd) sed printf ${HOME}
+	done sed local export ${HOME} $(pwd) cd export |
+sed echo x=1 grep -eu sed 2>/dev/null sed readonly && -eu --verbose printf
+	/usr/bin readonly then echo --verbose | "$@" readonly
+local | && local x=1 done done
+		awk | local done cd --verbose readonly then 'quoted text' x=1 2>/dev/null
+	awk printf ${HOME} /usr/bin 'quoted text'
+	-eu awk x=1 then grep "$1" "$1" --verbose readonly -eu $(pwd) /usr/bin
+	| $(pwd) 'quoted text' "$@" grep -eu |
+	"$@" $(pwd) test sed 2>/dev/null &&
+test sed 'quoted text' cd test awk then "$@" local
+	readonly printf $(pwd) echo x=1 done | cd export readonly
+		-eu 'quoted text' "$1" $(pwd) sed 'quoted text'
+	readonly $(pwd) 'quoted text' cd
+	| ${HOME} sed x=1 && then cd echo "$@" -eu readonly ${HOME}
+		sed | && ${HOME} local "$1" local ${HOME} $(pwd) readonly
+		${HOME} grep | awk grep
+	"$1" x=1 local $(pwd) done sed cd $(pwd) -eu --verbose sed
+		-eu "$1" done export ${HOME} "$@" export --verbose done cd grep x=1 $(pwd) printf
+	-eu done $(pwd) ${HOME} done readonly export 'quoted text' --verbose sed 2>/dev/null
+		awk "$1" ${HOME} done 2>/dev/null test grep echo awk local 'quoted text'
+	| x=1 "$@" awk $(pwd) | --verbose | --verbose test 'quoted text'
+	| -eu local awk local /usr/bin awk ${HOME} grep "$1" | "$@" then export
+		grep awk "$1" 'quoted text'
+-eu /usr/bin readonly done "$@" echo echo export test
+		grep "$@" done --verbose local then "$@" x=1 readonly echo 2>/dev/null $(pwd)
+/usr/bin -eu && echo echo readonly 'quoted text'
+	/usr/bin $(pwd) x=1 printf grep echo printf local echo cd grep export -eu test grep
+		x=1 test cd local --verbose ${HOME}
+"$1" done -eu sed grep | echo grep
+		echo 2>/dev/null grep sed 'quoted text'
+		"$@" grep x=1 done readonly 2>/dev/null | printf | sed done $(pwd) echo grep
+	"$1" /usr/bin echo "$@" export readonly sed "$1" test 2>/dev/null x=1 --verbose
+then --verbose "$1" sed then printf /usr/bin /usr/bin local
+awk test 2>/dev/null cd --verbose "$@" test printf
+export $(pwd) test test export awk
+		cd -eu ${HOME} && then --verbose x=1 readonly && --verbose 2>/dev/null test
+		--verbose done echo && -eu | grep /usr/bin
+		test echo -eu --verbose -eu && /usr/bin
+	then cd && then export
+	then readonly local --verbose sed readonly
+readonly awk --verbose local sed
+--verbose done grep then x=1 local 'quoted text' echo x=1 && sed
+		/usr/bin test /usr/bin
+	"$@" $(pwd) -eu | /usr/bin readonly ${HOME} cd test $(pwd) 'quoted text'
+done export test -eu printf echo "$@" "$1" "$@" -eu printf echo local ${HOME}
+cd $(pwd) cd --verbose export printf --verbose done echo $(pwd)
+		'quoted text' readonly -eu ${HOME} export 'quoted text' -eu cd test test 'quoted text'
+	"$1" && 'quoted text' done 'quoted text' "$@" x=1 then cd 'quoted text' x=1
+	$(pwd) 'quoted text' local --verbose $(pwd) 2>/dev/null
+readonly -eu printf /usr/bin test /usr/bin
+local awk $(pwd) 'quoted text'
+2>/dev/null awk /usr/bin "$@" | ${HOME} --verbose ${HOME} local
+	printf 2>/dev/null grep | readonly "$1" cd done readonly
+		2>/dev/null cd x=1 sed 'quoted text' grep done local ${HOME}
+	local | echo sed --verbose printf 2>/dev/null echo -eu /usr/bin | cd echo
+sed done cd $(pwd) $(pwd) printf /usr/bin local x=1 'quoted text' sed echo --verbose
+	cd export 'quoted text' readonly grep
+#include c186.sh
+${HOME} -eu 'quoted text'
+export -eu grep awk "$@"
+		awk $(pwd) then echo ${HOME} "$1" test x=1 echo grep readonly then sed local
+	printf then x=1 sed export "$1" local printf /usr/bin awk $(pwd)
+grep -eu ${HOME} sed && && done awk test cd test
+		/usr/bin export -eu grep sed export then export printf awk sed -eu | readonly
+	printf done then 2>/dev/null printf "$1" "$1" && | "$1" cd && 2>/dev/null printf
+		cd local 2>/dev/null readonly done $(pwd) echo "$@" then
+		echo 'quoted text' 'quoted text' 2>/dev/null cd $(pwd) $(pwd)
+		awk readonly /usr/bin local
+	| x=1 grep printf sed grep sed awk sed x=1 export $(pwd) "$@" cd
+printf then printf cd && test "$@" local /usr/bin sed echo printf "$1"
+sed export grep cd test printf
+		'quoted text' done | "$@" readonly | 2>/dev/null grep test $(pwd) local awk && done
+&& --verbose && cd -eu 'quoted text' && 2>/dev/null x=1
+grep $(pwd) awk echo export then ${HOME} /usr/bin /usr/bin
+then local echo done then export readonly printf -eu test printf
+		readonly && --verbose | grep echo done awk ${HOME}
+		| /usr/bin echo then --verbose "$@" -eu printf grep --verbose
+	done $(pwd) test && "$1" | export
+-eu export && readonly sed --verbose awk done
+	2>/dev/null x=1 && local test /usr/bin awk -eu && cd cd sed then cd grep 'quoted text'
+		export /usr/bin 2>/dev/null && then ${HOME} printf
+$(pwd) done | 2>/dev/null
+	x=1 export "$1" /usr/bin readonly grep then readonly done printf "$1" then "$1"
+"$1" ${HOME} ${HOME} && -eu x=1 'quoted text'
+		/usr/bin "$@" | x=1 awk x=1 | grep --verbose
+		test ${HOME} sed -eu readonly export "$@" echo awk -eu | && awk | printf
+sed done /usr/bin -eu && "$@" cd grep
+sed x=1 export done ${HOME} /usr/bin
+2>/dev/null sed then sed local readonly then grep printf 'quoted text'
+		--verbose test "$1" local local readonly -eu readonly
+	${HOME} /usr/bin -eu && printf cd --verbose export grep
+	${HOME} cd "$@" printf ${HOME} test export
+	readonly echo $(pwd) x=1 sed
+		export "$1" "$@" readonly
+	awk --verbose test cd /usr/bin | 2>/dev/null grep then "$1" "$1"
+export local --verbose /usr/bin 2>/dev/null
+| && printf readonly local echo /usr/bin 'quoted text' 2>/dev/null sed 2>/dev/null
+		x=1 'quoted text' ${HOME} && echo local x=1 -eu cd /usr/bin 'quoted text'
+	sed ${HOME} done --verbose cd ${HOME} grep "$@" -eu test
+		${HOME} -eu 'quoted text' local --verbose cd x=1 test readonly "$@" export readonly
+		"$1" export && --verbose 'quoted text' test 2>/dev/null
+"$1" echo awk then | "$1" grep 'quoted text' cd 'quoted text' echo /usr/bin "$1"
+cd done "$@" | | then then printf test "$1"
+		$(pwd) --verbose /usr/bin -eu
+	sed "$@" x=1 export sed
+$(pwd) echo --verbose done && sed readonly readonly
+		done done && 'quoted text' 'quoted text'
+cd | local -eu "$@" 'quoted text' 'quoted text' "$1" awk echo local
+		${HOME} readonly --verbose grep
+readonly echo ${HOME} 'quoted text' $(pwd) awk 2>/dev/null echo
+	awk $(pwd) --verbose -eu printf /usr/bin cd local done --verbose
+		2>/dev/null echo /usr/bin readonly sed /usr/bin 'quoted text' local | done "$1"
+	/usr/bin | --verbose 'quoted text'
+export local export sed | $(pwd) echo | printf cd sed x=1 echo 2>/dev/null
+		awk export readonly && "$1" printf echo
+		${HOME} then done awk test export done --verbose
+	--verbose x=1 -eu test echo $(pwd) | done awk done 'quoted text'
+		&& "$1" "$@" printf done --verbose readonly 2>/dev/null
+	2>/dev/null "$1" "$1" $(pwd) 'quoted text' test test
+	echo /usr/bin export /usr/bin x=1 local
+	x=1 $(pwd) sed done done then done sed 'quoted text' local
+"$1" 'quoted text' x=1 cd 'quoted text' sed /usr/bin
+/usr/bin 2>/dev/null cd --verbose |
+echo then echo test | x=1 printf then printf 'quoted text' -eu | ${HOME}
+local | 2>/dev/null $(pwd) 'quoted text' ${HOME} && readonly -eu test "$@"
+	${HOME} local cd /usr/bin $(pwd) /usr/bin -eu echo echo /usr/bin
+readonly local then grep | awk readonly cd $(pwd)
+	--verbose -eu x=1 ${HOME} then grep 2>/dev/null | printf --verbose 'quoted text'
+	printf /usr/bin 'quoted text'
+	awk | "$@" | | $(pwd) x=1 --verbose grep grep "$1" then sed awk ${HOME}
+	readonly 2>/dev/null ${HOME} awk "$1" -eu 'quoted text'
+		sed echo -eu /usr/bin cd 2>/dev/null && --verbose /usr/bin 2>/dev/null awk x=1
+	-eu "$@" printf | --verbose readonly test $(pwd) local | 2>/dev/null
+		awk readonly "$@" x=1 then then test printf --verbose
+	x=1 awk export done then $(pwd) done printf echo
+	-eu $(pwd) done -eu x=1 --verbose && "$1" --verbose --verbose
+		/usr/bin awk 2>/dev/null x=1 && grep /usr/bin
+test 2>/dev/null grep $(pwd) echo &&
+	${HOME} echo printf | readonly export done ${HOME}
+	"$1" x=1 then $(pwd) -eu 2>/dev/null readonly awk && local grep readonly
+	readonly /usr/bin sed grep done "$1" ${HOME} done /usr/bin ${HOME}
+		2>/dev/null sed cd 'quoted text'
+	awk ${HOME} awk readonly 2>/dev/null sed 2>/dev/null /usr/bin
+${HOME} echo "$@" local export sed --verbose x=1 | 2>/dev/null "$1" local -eu
+echo $(pwd) && test cd sed /usr/bin "$1" done export
+		sed grep sed --verbose
+		export /usr/bin | && export "$1" /usr/bin cd test
+2>/dev/null --verbose sed /usr/bin x=1 && export then "$@"
+printf /usr/bin local echo /usr/bin | "$@" echo cd test
+then x=1 $(pwd) | -eu x=1 awk --verbose 2>/dev/null
+| -eu awk cd cd local 2>/dev/null grep | readonly
+	then "$@" cd x=1 2>/dev/null sed x=1
+${HOME} && x=1 grep $(pwd) x=1 sed cd
+		awk test export "$@" export local done done ${HOME} | readonly echo
+x=1 "$1" grep cd "$1" ${HOME}
+2>/dev/null 2>/dev/null -eu 'quoted text' 'quoted text' test readonly
+done then ${HOME} echo --verbose 'quoted text' awk local sed then grep --verbose
+	/usr/bin "$1" readonly $(pwd) local test local "$1" 2>/dev/null 2>/dev/null
+		sed sed -eu echo cd ${HOME} "$1" awk echo 2>/dev/null sed
+	x=1 then echo grep echo done "$1" $(pwd) awk 2>/dev/null
+	export printf echo "$@" echo sed awk ${HOME} echo 2>/dev/null
+	&& readonly sed /usr/bin test sed $(pwd) then
+	-eu export then | $(pwd) done 2>/dev/null echo
+		local -eu && echo "$1" && "$@"
+--verbose then ${HOME} -eu "$1" $(pwd) local
+	printf /usr/bin done -eu then echo sed 2>/dev/null 2>/dev/null done --verbose 'quoted text'
+	${HOME} 2>/dev/null 2>/dev/null awk then $(pwd)
+	cd && local | test "$@" readonly "$1" 'quoted text'
+		grep awk "$@" 2>/dev/null export "$@"
+	test --verbose grep then test 'quoted text' sed "$1" 'quoted text'
+x=1 grep && export export --verbose 2>/dev/null export echo local -eu 2>/dev/null
+	printf echo awk 2>/dev/null then | /usr/bin "$@" grep -eu awk
+/usr/bin --verbose then $(pwd) -eu 'quoted text' test printf "$@" then "$1" $(pwd)
+	--verbose then --verbose sed $(pwd) $(pwd) --verbose then $(pwd) "$@" readonly
+	-eu --verbose ${HOME} printf -eu
+		then sed $(pwd) 2>/dev/null | x=1 | grep /usr/bin
+echo test sed "$1" local 2>/dev/null 2>/dev/null export done x=1 grep
+readonly --verbose -eu readonly
+'quoted text' $(pwd) readonly local --verbose 2>/dev/null ${HOME}
+then printf echo 2>/dev/null -eu
+		| echo --verbose cd cd 2>/dev/null
+	local 2>/dev/null test 2>/dev/null -eu -eu /usr/bin $(pwd)
+'quoted text' printf | 2>/dev/null /usr/bin sed
+		2>/dev/null then awk readonly x=1 -eu readonly /usr/bin "$1"
+	"$@" | grep && "$@" ${HOME} --verbose && | cd sed 'quoted text' done
+sed "$1" ${HOME} readonly readonly 2>/dev/null --verbose | "$1" /usr/bin
+		then printf export "$1" $(pwd)
+then --verbose && readonly test
+		done 'quoted text' 'quoted text' export export
+'quoted text' printf "$1" done && export grep printf echo cd ${HOME} printf
+2>/dev/null x=1 cd 'quoted text' 'quoted text' --verbose cd local 2>/dev/null
+		grep "$@" cd | 'quoted text'
+		export | then -eu echo 'quoted text' x=1 echo | -eu 2>/dev/null | awk sed readonly
+	/usr/bin export readonly cd --verbose "$1" then
+	/usr/bin /usr/bin printf sed ${HOME} | ${HOME} echo export
+	| done --verbose local
+		$(pwd) --verbose /usr/bin local $(pwd) export | printf --verbose 'quoted text' "$@"
+		"$1" $(pwd) "$@" | 'quoted text' "$1" sed grep local "$1" local then local
+awk 'quoted text' -eu --verbose
+	${HOME} test test sed | 2>/dev/null 2>/dev/null
+"$1" 'quoted text' then /usr/bin printf test /usr/bin | -eu
+		export | && "$1" x=1 printf 'quoted text' printf
+	2>/dev/null sed "$@" local echo cd 2>/dev/null then readonly --verbose
+	&& x=1 awk cd 2>/dev/null export 2>/dev/null awk && printf
+		&& awk x=1 -eu --verbose done test grep cd -eu printf 'quoted text' sed
+--verbose test done local --verbose
+"$@" export done --verbose && $(pwd) test && grep
+	echo --verbose echo done local -eu local --verbose 'quoted text'
+	echo printf echo 2>/dev/null
+	/usr/bin done test test awk "$@"
+	"$1" $(pwd) $(pwd) test sed test sed then ${HOME} grep $(pwd) 'quoted text'
+		test done local local | -eu done 2>/dev/null |
+	then cd then "$1" test readonly awk readonly
+${HOME} done test echo grep test then awk -eu "$1" ${HOME} | | "$@" x=1 2>/dev/null
+		printf | 2>/dev/null cd && x=1 "$1" | "$1" printf && readonly
+	| local readonly x=1 awk test 2>/dev/null local then 2>/dev/null local | --verbose
+		done $(pwd) grep printf "$@" x=1 ${HOME} readonly && readonly cd grep 'quoted text'
+printf 2>/dev/null echo 'quoted text' $(pwd) "$1"
+$(pwd) "$1" $(pwd) awk 2>/dev/null
+x=1 printf grep ${HOME} cd echo awk $(pwd) done test $(pwd) 'quoted text'
+--verbose --verbose awk printf test | done export "$1" | $(pwd) -eu done then
+awk | x=1 $(pwd) local ${HOME} $(pwd) 'quoted text' "$@" printf export cd awk export
+		then done readonly 'quoted text'
+	awk cd awk printf x=1 "$@" $(pwd) 2>/dev/null 'quoted text'
+	$(pwd) $(pwd) && sed test then --verbose "$1" cd export | x=1 grep "$@"
+x=1 -eu cd && echo echo -eu /usr/bin printf $(pwd) awk 'quoted text' cd awk &&
+		sed 2>/dev/null --verbose then
+&& 2>/dev/null x=1 | 'quoted text' /usr/bin
+	/usr/bin 2>/dev/null && --verbose
+	echo -eu cd $(pwd) "$1" x=1 | "$@" awk export grep /usr/bin "$1" -eu export
+2>/dev/null echo sed "$1" export done ${HOME}
+	2>/dev/null $(pwd) x=1 done grep printf done
+	${HOME} /usr/bin -eu echo && "$@"
+	local $(pwd) local grep printf local /usr/bin 'quoted text'
+export && | ${HOME} -eu cd
+	sed awk readonly done test
+	cd | echo && awk "$1" 2>/dev/null echo ${HOME}
+	$(pwd) local grep && awk export
+${HOME} | readonly /usr/bin export
+$(pwd) ${HOME} awk readonly echo printf printf grep export export && ${HOME}
+${HOME} 2>/dev/null && --verbose | -eu
+		'quoted text' /usr/bin echo echo sed 2>/dev/null "$@" cd /usr/bin ${HOME} printf
+		&& "$1" x=1 grep "$@" test x=1 -eu /usr/bin ${HOME}
+readonly test /usr/bin done 2>/dev/null && x=1 ${HOME}
+	${HOME} done then 2>/dev/null cd --verbose cd --verbose export local ${HOME} done
+		grep "$@" grep local $(pwd) sed grep export "$@"
+$(pwd) /usr/bin 'quoted text' /usr/bin "$1" | printf local cd
+	&& 2>/dev/null awk cd 2>/dev/null /usr/bin "$@"
+		| && 'quoted text' 'quoted text'
+	echo --verbose -eu --verbose grep export "$@"
+export then && 'quoted text' awk printf --verbose test grep local grep | "$@"
+	cd ${HOME} 'quoted text' "$@"
+		-eu export /usr/bin local $(pwd) 'quoted text' readonly
+/usr/bin -eu x=1 'quoted text' cd x=1 awk
+&& && cd 2>/dev/null export "$@"
+	${HOME} grep 2>/dev/null && export test done then 'quoted text'
+		$(pwd) printf "$@" cd export awk 2>/dev/null 'quoted text'
+| | sed test readonly -eu done /usr/bin echo readonly
+		echo printf done grep /usr/bin echo "$1"
+	"$@" local export local cd /usr/bin 2>/dev/null 2>/dev/null 'quoted text'
+		&& 2>/dev/null test done grep done ${HOME} --verbose
+	cd | 'quoted text' && awk "$@" export $(pwd)
+x=1 export grep echo $(pwd) x=1
+		x=1 -eu local done $(pwd) then grep 2>/dev/null
+	x=1 export "$@" && ${HOME} done
+	/usr/bin readonly readonly
+		| then then echo printf 'quoted text'
+	export then then printf 2>/dev/null 'quoted text'
+		done readonly grep local 'quoted text' printf 'quoted text' export grep
+		&& done then echo | then done 2>/dev/null $(pwd) --verbose ${HOME}
+	local "$1" awk && | 2>/dev/null test -eu grep /usr/bin 2>/dev/null
+$(pwd) -eu "$@" readonly echo x=1 --verbose
+		awk x=1 done 2>/dev/null "$@"
+$(pwd) "$1" 2>/dev/null test done 2>/dev/null sed "$1" local grep export
+	cd "$@" local -eu x=1 2>/dev/null printf test "$1" done
+		printf $(pwd) sed x=1 readonly ${HOME} cd cd then "$@"
+cd 2>/dev/null "$1" local readonly
+&& grep printf 2>/dev/null "$@" "$@" ${HOME} "$1" awk awk $(pwd)
+		cd export x=1 export awk -eu printf ${HOME} printf readonly
+'quoted text' test x=1
+	sed readonly /usr/bin printf ${HOME} grep --verbose | | export
+	printf ${HOME} cd && && local awk x=1 grep x=1 export done -eu x=1 cd grep then
+	grep -eu grep printf | x=1 local ${HOME} sed "$1" grep -eu readonly
+printf | echo readonly awk local done local then
+	sed $(pwd) ${HOME} cd ${HOME} awk printf echo "$1" awk
+		${HOME} "$@" printf export grep x=1 "$@" 2>/dev/null && local
+local --verbose "$@" "$@"
+2>/dev/null -eu ${HOME} "$@" 'quoted text' done /usr/bin awk printf
+	--verbose $(pwd) readonly sed grep &&
+		/usr/bin grep awk /usr/bin sed $(pwd) -eu ${HOME}
+$(pwd) -eu x=1 export done "$@" local awk sed grep test
+	-eu awk --verbose then readonly done | $(pwd)
+&& && readonly local then test
+		echo "$1" sed export /usr/bin --verbose ${HOME} test local
+		test sed sed sed && /usr/bin awk local 'quoted text'
+	${HOME} test | readonly sed "$@" cd grep
+		then | local 'quoted text' 2>/dev/null 2>/dev/null | export 2>/dev/null
+printf x=1 ${HOME} printf x=1 x=1 test | "$1" sed then | 2>/dev/null
+--verbose --verbose 2>/dev/null test
+	awk && $(pwd) ${HOME} printf local readonly x=1 cd then ${HOME} 2>/dev/null
+	| local readonly export x=1 -eu
+	readonly && export echo /usr/bin | then then cd 2>/dev/null test x=1
+--verbose | 2>/dev/null -eu export $(pwd) cd printf grep 2>/dev/null
+"$@" && 2>/dev/null | then sed | export 'quoted text' "$@" "$1"
+		"$1" /usr/bin ${HOME} local
+echo x=1 done 'quoted text' awk --verbose
+		/usr/bin 'quoted text'
+	${HOME} --verbose sed grep 'quoted text'
+	echo x=1 "$1" x=1 --verbose readonly awk then && "$@" awk local export awk done
+then test sed --verbose sed test $(pwd) export 2>/dev/null
+printf printf $(pwd) readonly local 2>/dev/null awk then then && sed export
+		sed /usr/bin | sed x=1 awk printf "$@" echo &&
+		echo "$1" x=1 export ${HOME} done "$@" /usr/bin 'quoted text'
+"$1" test printf $(pwd) test --verbose $(pwd) "$1" grep echo && "$@"
+	2>/dev/null 2>/dev/null 'quoted text' then echo test | 2>/dev/null readonly
+	| grep x=1 local done test readonly 2>/dev/null $(pwd) readonly &&
+		--verbose readonly echo -eu readonly printf /usr/bin local readonly
+		export readonly sed 'quoted text' "$1" test
+		local $(pwd) ${HOME} -eu done /usr/bin
+	--verbose cd ${HOME} x=1 "$1" sed readonly local && readonly printf done x=1
+	echo -eu printf grep -eu grep 'quoted text' --verbose sed
+		local then echo readonly export 2>/dev/null grep "$1" cd 2>/dev/null
+	| test export /usr/bin
+/usr/bin -eu --verbose $(pwd) ${HOME} -eu echo printf -eu $(pwd) echo sed
+	$(pwd) grep test then x=1 ${HOME} awk /usr/bin then /usr/bin $(pwd) export
+then "$@" | 2>/dev/null "$@" -eu x=1 cd printf
+		x=1 --verbose && done 2>/dev/null
+	echo awk awk export awk "$@" export printf "$1" x=1 $(pwd) 'quoted text'
+test --verbose /usr/bin && awk $(pwd) test | echo
+test "$1" printf printf sed && grep &&
+		| /usr/bin cd local echo
+| -eu test readonly && echo "$1" printf --verbose echo $(pwd) --verbose
+		export export echo 'quoted text'
+		--verbose "$@" $(pwd) && $(pwd) test "$1" echo -eu local awk
+--verbose printf readonly && -eu done $(pwd) awk readonly ${HOME}
+	sed export grep && 'quoted text' then x=1 "$1" 2>/dev/null "$1" readonly
+"$1" export /usr/bin /usr/bin x=1 then test sed local /usr/bin cd awk 2>/dev/null
+&& --verbose grep -eu printf ${HOME} $(pwd) x=1 | awk
+	"$1" local --verbose /usr/bin 2>/dev/null && && cd
+	readonly $(pwd) $(pwd) 2>/dev/null export 'quoted text'
+		'quoted text' test printf 2>/dev/null cd
+"$@" cd --verbose export 'quoted text'
+		${HOME} 2>/dev/null "$@" -eu "$@"
+| && sed local done "$@"
+	test done $(pwd) | done test
+	$(pwd) grep test 2>/dev/null grep echo --verbose | sed
+		-eu grep sed 'quoted text' /usr/bin export echo $(pwd) printf
+sed /usr/bin "$1" grep 2>/dev/null grep export export "$@" "$@"
+&& -eu printf "$@" | then ${HOME} &&
+	grep "$1" sed /usr/bin local && grep $(pwd) ${HOME}
+		&& readonly done local grep export x=1 grep 'quoted text' grep | "$1" test | test
+		&& test readonly -eu awk printf done awk 2>/dev/null --verbose test
+		done 'quoted text' echo done done test grep "$@" done | "$1" | && readonly
+${HOME} test 'quoted text' export ${HOME}
+	-eu | done -eu cd cd "$1" sed 2>/dev/null sed "$1" 2>/dev/null readonly
+		| "$@" "$@" --verbose 'quoted text' then "$1" local grep 'quoted text' then echo
+		test 2>/dev/null grep
+$(pwd) grep 2>/dev/null done $(pwd) export done printf
+		/usr/bin grep x=1 -eu printf readonly 2>/dev/null && -eu cd "$@" awk done test grep
+2>/dev/null readonly
+	local done && "$1" 'quoted text' awk "$1"
+	$(pwd) grep test && /usr/bin printf awk 2>/dev/null ${HOME} sed echo
+readonly /usr/bin ${HOME}
+grep local "$1" && local printf echo -eu test then 2>/dev/null export awk
+		"$1" then $(pwd) printf then x=1 cd --verbose
+local cd grep "$@" done |
+	/usr/bin cd cd printf /usr/bin awk readonly --verbose
+	&& | sed && --verbose done && 'quoted text' awk printf
+		${HOME} grep 'quoted text' && "$1" printf
+	export printf | export echo cd
+$(pwd) local $(pwd) "$1"
+cd awk "$@" ${HOME} ${HOME} local readonly done $(pwd)
+		/usr/bin grep $(pwd) export "$@" $(pwd) grep export "$@" printf echo done
+		| awk "$@" --verbose echo x=1 &&
+	/usr/bin /usr/bin x=1 readonly --verbose grep done
+		then awk then export 2>/dev/null -eu x=1 && sed 'quoted text' 'quoted text'
+	grep "$@" cd ${HOME} sed grep then
+	x=1 x=1 sed | x=1 export 'quoted text' $(pwd) $(pwd) "$@"
+then $(pwd) test readonly
+	readonly $(pwd) 'quoted text'
+&& ${HOME} "$1" done 2>/dev/null test 'quoted text'
+		${HOME} $(pwd) -eu 2>/dev/null /usr/bin export printf ${HOME} $(pwd) grep done
+x=1 "$@" done done export | done
+	printf /usr/bin readonly readonly grep awk awk
+"$1" x=1 --verbose awk cd grep test | "$1" grep local "$@" && sed
+	printf then $(pwd) "$@" "$@" readonly --verbose /usr/bin | awk test
+| printf test cd then && --verbose "$@" && cd grep 'quoted text'
+		then "$@" printf "$@"
+	| grep test export echo readonly
+		awk printf printf 'quoted text' done echo cd --verbose --verbose grep grep readonly
+	then then awk "$@" ${HOME} /usr/bin --verbose local
+sed -eu "$1" | --verbose 2>/dev/null --verbose 2>/dev/null
+	--verbose 2>/dev/null 2>/dev/null sed x=1 /usr/bin grep "$1"
+		&& "$@" && | grep test 2>/dev/null
+local ${HOME} && local "$@" -eu
+echo $(pwd) "$1" grep x=1 /usr/bin then echo awk sed ${HOME} $(pwd) ${HOME}
+		local cd sed grep /usr/bin readonly sed then printf echo x=1 local /usr/bin
+	| ${HOME} -eu echo ${HOME} 'quoted text' cd "$1" && "$1" --verbose readonly
+| "$1" cd $(pwd) "$@" then then export
+-eu --verbose --verbose echo ${HOME} then /usr/bin local | -eu "$@" done then
+done --verbose printf &&
+		test ${HOME} --verbose && && echo cd ${HOME}
+"$@" echo "$@" sed && readonly
+x=1 "$1" export printf sed export printf && local
+	test && sed export | -eu printf
+		sed export && 'quoted text' ${HOME}
+awk ${HOME} "$@" cd sed sed /usr/bin 'quoted text'
+	echo done test grep ${HOME} 2>/dev/null
+	echo local grep x=1 test | -eu | && $(pwd)
+readonly test printf sed export 2>/dev/null then test 2>/dev/null -eu
+	then 'quoted text' ${HOME} -eu done echo 2>/dev/null
+	grep -eu --verbose local ${HOME} sed awk local | 2>/dev/null /usr/bin
+	--verbose readonly then 'quoted text' && --verbose readonly then
+		| printf readonly export ${HOME} grep readonly done sed && $(pwd) local
+	echo "$@" $(pwd) 'quoted text' 2>/dev/null local test readonly ${HOME}
+	"$1" 2>/dev/null 2>/dev/null 'quoted text' /usr/bin
+	grep $(pwd) x=1 2>/dev/null cd /usr/bin -eu ${HOME} test then x=1
+	$(pwd) readonly then awk ${HOME} test 2>/dev/null /usr/bin grep $(pwd) test test
+	test printf echo | ${HOME} ${HOME} echo 2>/dev/null $(pwd) echo "$1"
+&& $(pwd) grep sed $(pwd) /usr/bin grep | done cd local printf "$1"
+| 'quoted text' printf export 'quoted text' printf
+	/usr/bin done done printf x=1 then x=1 test
+awk 2>/dev/null readonly then ${HOME} "$@" echo | "$@" readonly
+		'quoted text' "$1" -eu | sed
+	&& x=1 then "$@" -eu cd
+		-eu x=1 grep printf 'quoted text' 2>/dev/null
+		${HOME} grep -eu | 'quoted text' grep sed cd --verbose then
+		'quoted text' cd 'quoted text' ${HOME} --verbose awk done sed "$1"
+		2>/dev/null 'quoted text'
+		grep awk test done x=1 2>/dev/null
+echo /usr/bin /usr/bin "$1"
+	grep "$@" grep --verbose -eu --verbose && test grep ${HOME} export
+		/usr/bin grep sed done "$@" -eu 'quoted text' x=1 echo "$1" then
+		readonly cd readonly "$@" --verbose awk sed /usr/bin && | | test export
+	'quoted text' x=1 then
+		--verbose $(pwd) /usr/bin local grep
+echo awk 2>/dev/null readonly x=1 ${HOME} then printf --verbose &&
+	export "$@" grep readonly local local done --verbose
+	$(pwd) /usr/bin export x=1 $(pwd) done test
+		-eu awk --verbose printf 2>/dev/null
+		"$@" echo 2>/dev/null test -eu then 'quoted text'
+	2>/dev/null readonly test ${HOME}
+	'quoted text' printf ${HOME} 'quoted text'
+done readonly then /usr/bin
+	local echo grep | /usr/bin ${HOME} awk ${HOME} test then grep local
+		&& then "$1" ${HOME} done -eu echo
+		echo local local x=1 --verbose awk x=1
+		"$@" 2>/dev/null done -eu -eu sed "$@" "$1" then "$1" "$1" export 'quoted text'
+readonly /usr/bin /usr/bin sed cd local readonly
+		| echo /usr/bin "$1" readonly | then /usr/bin sed /usr/bin
+| test sed test 'quoted text' $(pwd)
+test readonly "$1" x=1 "$@" ${HOME} --verbose local
+-eu && then 'quoted text' test local $(pwd) --verbose | $(pwd) $(pwd)
+	cd ${HOME} grep local awk done && ${HOME} $(pwd) --verbose export test
+		local x=1 export local "$1" --verbose | 2>/dev/null $(pwd)
+	-eu x=1 readonly cd 'quoted text' "$1" export readonly 2>/dev/null
+		&& done cd done cd && sed grep export $(pwd) grep then "$1" awk export echo
+	"$1" sed x=1 && test && x=1 --verbose 'quoted text'
+test printf /usr/bin done $(pwd) --verbose awk test x=1 then grep then export
+		echo ${HOME} $(pwd) done --verbose "$@" ${HOME} local
+	then -eu echo ${HOME} done | done
+done echo -eu awk 'quoted text' --verbose
+&& "$@" grep ${HOME} printf
+		$(pwd) ${HOME} local local 2>/dev/null $(pwd) readonly cd 'quoted text' cd &&
+		echo grep grep sed test grep 2>/dev/null
+-eu awk --verbose --verbose | && then && done 'quoted text' x=1 -eu printf then
+		printf test sed awk "$1" cd --verbose cd echo x=1 2>/dev/null
+	local --verbose local "$1" x=1
+done && ${HOME} cd export x=1 printf x=1 --verbose "$@" awk echo 2>/dev/null
+test awk $(pwd) $(pwd)
+"$1" awk "$1" export $(pwd) /usr/bin cd -eu printf 'quoted text' test x=1 printf
+	test $(pwd) cd $(pwd) "$1" readonly local
+	done cd ${HOME} done sed 'quoted text' "$1" echo awk 2>/dev/null
+		grep sed ${HOME} done | test echo | awk export ${HOME}
+readonly | "$1" "$@" --verbose cd printf /usr/bin $(pwd)
+printf x=1 | "$@" export ${HOME} readonly grep awk sed && 'quoted text' sed
+		echo "$@" | $(pwd) then done $(pwd) 2>/dev/null 2>/dev/null readonly
+		"$1" && grep grep sed 2>/dev/null 2>/dev/null done local local "$1" 'quoted text'
+then /usr/bin awk | cd "$@" local sed --verbose $(pwd) sed --verbose "$1" awk "$@"
+${HOME} ${HOME} "$1" sed cd --verbose "$@" awk test cd && "$@" /usr/bin then
+	sed "$1" test 2>/dev/null --verbose done
+&& cd --verbose /usr/bin cd "$@" 'quoted text' test readonly /usr/bin
+		readonly sed readonly $(pwd) /usr/bin printf sed && printf ${HOME} |
+		"$1" 'quoted text' local cd sed x=1
+	printf awk sed printf cd test local --verbose sed "$@" "$@" then 'quoted text'
+${HOME} echo "$1" x=1
+"$@" -eu "$@" local printf test
+		awk && export done 2>/dev/null cd "$@" x=1 printf /usr/bin
+		x=1 export cd | test local 2>/dev/null $(pwd)
+		/usr/bin && && sed --verbose readonly ${HOME} x=1 "$1"
+	awk cd | local | ${HOME} 'quoted text' 2>/dev/null cd $(pwd) echo readonly
+	echo cd 'quoted text' cd local | then --verbose
+	${HOME} done --verbose done
+	local "$1" awk 2>/dev/null /usr/bin
+		"$@" cd ${HOME} x=1 ${HOME} --verbose sed "$1" && cd
+grep | sed test grep "$1" test printf
+	cd awk /usr/bin 2>/dev/null cd local /usr/bin then x=1 $(pwd)
+	export then 'quoted text' sed echo | grep --verbose
+	&& grep export grep "$1" cd "$1" x=1 $(pwd) -eu cd printf $(pwd) --verbose
+'quoted text' readonly done /usr/bin local /usr/bin "$@" "$@" printf /usr/bin sed
+	/usr/bin "$@" "$@" done done --verbose ${HOME} ${HOME}
+		x=1 && ${HOME} 'quoted text' readonly --verbose cd sed
+	$(pwd) then awk "$1" && ${HOME} -eu cd -eu ${HOME} &&
+	/usr/bin ${HOME} $(pwd)
+| "$@" && x=1 grep readonly done test sed x=1 cd "$1" "$@" "$1" sed 'quoted text'
+		readonly printf x=1 local 2>/dev/null then test 'quoted text'
+	$(pwd) echo "$@" && "$@" readonly
+		-eu 2>/dev/null done x=1 $(pwd)
+	x=1 2>/dev/null export readonly && then
+then "$1" printf "$@" echo export sed x=1 readonly x=1 cd export $(pwd)
+done grep awk x=1 local readonly 'quoted text'
+cd done x=1 export then cd | export | awk 'quoted text' awk /usr/bin printf
+	--verbose && sed $(pwd)
+	printf /usr/bin then 2>/dev/null printf --verbose sed ${HOME}
+		cd 'quoted text' echo export export cd | --verbose -eu awk
+		--verbose cd -eu | | readonly cd test readonly grep grep
+		--verbose --verbose "$1" -eu awk grep "$1" readonly ${HOME}
+	grep ${HOME} $(pwd) then "$1" $(pwd) /usr/bin
+		/usr/bin /usr/bin printf | printf
+	echo 'quoted text' local echo "$1" -eu | && sed printf
+	awk $(pwd) "$@" 'quoted text'
+/usr/bin ${HOME} sed 'quoted text' | cd &&
+	'quoted text' printf "$1"
+test export 2>/dev/null export done then local
+"$@" awk 2>/dev/null sed "$@" export
+export then readonly | sed | && test "$@" 'quoted text'
+	readonly 'quoted text' x=1 'quoted text' cd readonly
+	echo $(pwd) && "$1" --verbose sed | test
+		| /usr/bin ${HOME} 2>/dev/null
+	printf awk echo /usr/bin done ${HOME} 2>/dev/null $(pwd) test && /usr/bin
+		'quoted text' readonly test then test && done
+	sed export test printf 2>/dev/null $(pwd)
+printf --verbose "$1" then $(pwd) done 2>/dev/null
+	"$1" /usr/bin ${HOME} export && grep test test "$1"
+		local awk 'quoted text'
+	then export "$@" done | --verbose test 'quoted text'
+"$@" readonly done ${HOME}
+		awk then ${HOME} -eu awk test
+'quoted text' sed "$@" awk test readonly
+/usr/bin done echo --verbose "$1" && -eu echo
+	"$@" local readonly grep | printf awk sed /usr/bin then awk |
+	local test 2>/dev/null "$@" 2>/dev/null
+		local | awk 'quoted text' "$@" $(pwd) x=1
+	${HOME} | 'quoted text' test | local
+	x=1 x=1 ${HOME} "$1" x=1 x=1 --verbose
+/usr/bin /usr/bin --verbose test sed sed export
+'quoted text' test done "$@" echo local "$1" local then 2>/dev/null
+export "$@" echo echo awk && -eu readonly /usr/bin
+"$1" test x=1 2>/dev/null
+		cd then cd "$@" printf printf "$1" "$@" ${HOME} | 'quoted text'
+	$(pwd) 2>/dev/null printf $(pwd) grep "$1" sed $(pwd)
+'quoted text' local -eu "$@" -eu | $(pwd) | test test then
+${HOME} sed done $(pwd) --verbose | test -eu && local --verbose x=1 'quoted text'
+awk --verbose ${HOME}
+		${HOME} test readonly local local "$@" | x=1 /usr/bin
+&& test ${HOME} -eu -eu then $(pwd) done
+/usr/bin readonly && | && &&
+	local 'quoted text' test -eu ${HOME} export export
+	"$1" readonly 2>/dev/null 'quoted text' ${HOME} /usr/bin export
+	${HOME} done -eu sed ${HOME} "$@" export $(pwd) test export echo $(pwd)
+		--verbose cd -eu $(pwd) done ${HOME} --verbose
+		${HOME} $(pwd) then | -eu -eu done x=1 -eu --verbose printf cd awk /usr/bin -eu
+	| x=1 then local grep sed ${HOME} --verbose 2>/dev/null
+		then "$@" -eu x=1 cd | | cd "$@" done export readonly readonly
+		export printf ${HOME} cd then done && $(pwd) x=1 2>/dev/null local
+	grep x=1 grep export | local test --verbose
+--verbose ${HOME} --verbose
+	$(pwd) printf | cd -eu 2>/dev/null sed && 2>/dev/null printf test sed local $(pwd)
+		| export -eu x=1 x=1 sed grep awk x=1 /usr/bin local
+sed grep --verbose && then
+		"$1" -eu printf cd readonly sed 2>/dev/null /usr/bin test grep local
+		echo | readonly export sed && awk export awk x=1 ${HOME}
+	test --verbose "$1" x=1 "$1" x=1 -eu $(pwd)
+		done cd cd 2>/dev/null $(pwd) test test ${HOME}
+'quoted text' grep ${HOME} cd sed --verbose sed 'quoted text' ${HOME} local
+		done | "$1" cd cd ${HOME} "$@" 2>/dev/null $(pwd) then 2>/dev/null cd --verbose
+	"$@" echo printf printf sed ${HOME}
+test done done sed 'quoted text' then "$@" cd ${HOME} test echo
+		2>/dev/null sed $(pwd) $(pwd) /usr/bin sed sed sed
+		${HOME} && ${HOME} sed grep sed readonly && then local test cd "$@"
+done x=1 echo local &&
+		-eu && "$1" | --verbose awk 2>/dev/null $(pwd) -eu 'quoted text' awk cd sed
+	"$1" local /usr/bin done test
+done "$1" x=1 local "$@" echo $(pwd) /usr/bin x=1 "$1"
+test 2>/dev/null x=1
+		${HOME} readonly --verbose | done done echo test readonly "$1" && echo sed
+	done /usr/bin printf local x=1 export
+done done | printf | grep x=1 $(pwd) $(pwd) $(pwd)
+	x=1 local | && ${HOME} 2>/dev/null sed -eu then local
+	then "$@" "$1" test grep x=1 $(pwd) awk printf local readonly $(pwd)
+"$@" | /usr/bin 'quoted text' && then
+$(pwd) sed awk local 'quoted text' $(pwd) -eu sed
+done | sed "$@" 2>/dev/null | test "$1" echo && -eu ${HOME} 'quoted text'
+	2>/dev/null test | 'quoted text'
+'quoted text' readonly done 2>/dev/null | "$@" export printf "$1"
+		'quoted text' | cd "$@" local x=1 sed export
+	"$@" | --verbose "$@" sed "$@" "$@" "$@" 'quoted text'
+then --verbose grep test done printf --verbose ${HOME} awk | then --verbose x=1
+	cd x=1 echo x=1 awk 'quoted text' sed printf
+	cd | --verbose ${HOME} readonly
+$(pwd) 2>/dev/null x=1 sed echo test 2>/dev/null
+	$(pwd) 'quoted text' "$@" grep then "$@" awk then export && -eu cd ${HOME} &&
+	export --verbose awk test grep 2>/dev/null then readonly 'quoted text'
+		--verbose cd 'quoted text' 'quoted text' test local "$@"
+		then "$1" | "$@" test done then printf "$1" | ${HOME}
+"$@" 2>/dev/null cd export --verbose grep "$@" /usr/bin 2>/dev/null
+		${HOME} echo --verbose echo "$@" echo local --verbose then local
+		awk awk 2>/dev/null "$@" awk then printf 2>/dev/null $(pwd) test
+	then 2>/dev/null --verbose --verbose awk printf "$1" printf 2>/dev/null
+		done "$@" && 'quoted text' done done done --verbose local export echo local
+then echo done 'quoted text' "$@" cd
+		readonly $(pwd) then | ${HOME} awk echo /usr/bin export "$1" printf
+		--verbose 'quoted text' test -eu cd "$@" test 'quoted text'
+		cd test "$@" then grep $(pwd) awk x=1 local "$@"
+"$@" grep --verbose test && test "$1" cd && && sed awk /usr/bin awk test -eu
+		--verbose "$@" /usr/bin export /usr/bin | 2>/dev/null export then local local
+	-eu | | 'quoted text' printf $(pwd) awk then test sed done | ${HOME}
+		--verbose grep printf x=1 local cd grep 'quoted text'
+--verbose sed sed 2>/dev/null /usr/bin
+		'quoted text' x=1 local grep local readonly export /usr/bin "$1" ${HOME}
+	| "$@" readonly --verbose grep 'quoted text'
+$(pwd) cd test && local -eu ${HOME}
+then -eu $(pwd) local ${HOME} "$@"
+x=1 export -eu done test "$1" && then "$1" && echo ${HOME} export test cd export
+readonly echo readonly
+	-eu awk awk $(pwd) grep readonly $(pwd)
+'quoted text' echo $(pwd) $(pwd) awk export local ${HOME} /usr/bin
+export -eu 2>/dev/null | /usr/bin grep
+--verbose | awk "$@" | | echo "$1" cd awk local echo
+		awk then readonly $(pwd) sed && export readonly local "$@" readonly ${HOME}
+readonly ${HOME} sed 2>/dev/null 2>/dev/null test "$1" --verbose
+${HOME} -eu cd 'quoted text' export && local awk 'quoted text' 2>/dev/null 2>/dev/null
+		&& $(pwd) 'quoted text'
+		test "$1" echo test -eu && sed --verbose cd x=1 2>/dev/null then | sed cd
+2>/dev/null 2>/dev/null local local x=1 test 2>/dev/null readonly
+		export "$@" echo 'quoted text' awk 2>/dev/null readonly 'quoted text'
+'quoted text' grep && awk printf cd 'quoted text'
+	&& export awk /usr/bin 'quoted text' $(pwd)
+${HOME} /usr/bin "$1" sed cd then printf
+		| test $(pwd) printf done readonly local export /usr/bin
+done "$1" x=1 test done
+	"$1" 'quoted text' local $(pwd) done "$1" | 'quoted text' done -eu cd then $(pwd)
+		echo ${HOME} readonly "$@" 'quoted text'
+		${HOME} echo --verbose then | export
+	echo echo test | $(pwd) --verbose ${HOME} | grep
+		2>/dev/null readonly readonly $(pwd) then awk
+	${HOME} then printf "$1"
+	done 2>/dev/null readonly done x=1 ${HOME}
+		done | printf done export local | grep echo --verbose
+		local "$@" | done export test x=1 echo && 'quoted text' 'quoted text' test
+	2>/dev/null test readonly | sed
+$(pwd) /usr/bin printf "$@" $(pwd) --verbose 'quoted text' "$1" --verbose
+		$(pwd) readonly $(pwd) x=1 /usr/bin cd printf && sed local 2>/dev/null done &&
+	sed -eu 'quoted text' $(pwd) 2>/dev/null 2>/dev/null -eu | ${HOME} 2>/dev/null
+	echo done 'quoted text' -eu
+	cd sed test grep | export $(pwd) cd 2>/dev/null local
+local grep "$1" grep $(pwd)
+"$@" awk x=1 "$@" then awk
+		readonly grep --verbose 2>/dev/null
+"$1" sed then "$1" awk -eu -eu grep export echo 'quoted text'
+		${HOME} x=1 grep "$@" grep grep local
+		'quoted text' --verbose "$@"
+		"$1" awk -eu done local sed grep cd "$1" | local awk -eu sed /usr/bin
+		export echo $(pwd) 2>/dev/null done sed
+		local done readonly | $(pwd) local sed export echo -eu sed --verbose
+test readonly done --verbose test | grep x=1 && 2>/dev/null
+	echo cd printf awk export
+		awk $(pwd) 2>/dev/null "$1"
+echo test --verbose /usr/bin then
+--verbose then -eu test | 'quoted text'
+-eu /usr/bin readonly grep cd test --verbose
+	x=1 then then && printf /usr/bin /usr/bin done "$@" printf done "$@"
+		${HOME} echo awk cd 2>/dev/null sed printf local $(pwd) awk test test
+export printf test ${HOME} "$@" grep "$@" $(pwd) ${HOME} -eu "$@" echo export echo
+'quoted text' printf done printf done 'quoted text' echo cd 'quoted text'
+	"$1" sed local ${HOME} readonly "$@" && test sed test printf echo
+awk /usr/bin local && 'quoted text' && printf local grep /usr/bin "$@" "$@"
+/usr/bin done x=1 x=1 done /usr/bin --verbose 'quoted text' -eu
+$(pwd) grep test x=1 --verbose
+/usr/bin --verbose --verbose "$1" test "$@" $(pwd) /usr/bin -eu -eu --verbose
+	export awk 'quoted text' grep readonly cd done
+x=1 sed then printf awk /usr/bin export -eu
+done 'quoted text' test sed
+		x=1 local readonly local -eu
+		-eu grep export grep grep | && --verbose then 'quoted text'
+export --verbose ${HOME} x=1 local 2>/dev/null
+done x=1 readonly --verbose then "$@" x=1 "$1" export --verbose echo
+		sed "$1" 2>/dev/null then 'quoted text' && "$1" done $(pwd)
+done readonly "$1" local awk local then readonly export echo test local
+		| 'quoted text' sed && -eu $(pwd) cd "$1" x=1 $(pwd) x=1 grep x=1 local cd
+		--verbose local done "$1" --verbose x=1 local
+		then -eu then local readonly export --verbose
+		-eu awk ${HOME} && test /usr/bin && 2>/dev/null
+"$1" | 2>/dev/null 'quoted text' export ${HOME}
+		--verbose sed export local | grep "$1" printf
+	export echo --verbose $(pwd) export "$1"
+printf readonly export && then echo printf
+x=1 -eu ${HOME} done cd $(pwd) /usr/bin "$@" "$1"
+	&& export local then | then
+then ${HOME} export awk grep readonly done awk then
+		${HOME} ${HOME} x=1 readonly cd --verbose $(pwd)
+	/usr/bin 2>/dev/null local "$1" "$@" /usr/bin
+		"$@" readonly done && export /usr/bin
+'quoted text' "$@" test 'quoted text' printf awk "$@"
+grep grep export 2>/dev/null test 2>/dev/null
+		--verbose done readonly $(pwd)
+		$(pwd) local && awk -eu 2>/dev/null | sed 2>/dev/null then "$@" local
+	| --verbose sed awk -eu printf awk 2>/dev/null export 2>/dev/null $(pwd) $(pwd)
+		/usr/bin 'quoted text' --verbose
+		"$@" grep /usr/bin "$@" test done && "$@" sed -eu x=1 "$1"
+sed 2>/dev/null --verbose --verbose then readonly /usr/bin cd 2>/dev/null done cd
+		/usr/bin "$1" printf grep --verbose && x=1 local "$@" grep printf ${HOME}
+		-eu test sed 'quoted text' "$1" --verbose echo x=1 /usr/bin 'quoted text'
+		"$1" 'quoted text' "$1" sed done --verbose awk | grep export then
+		then "$1" sed export readonly x=1 readonly
+	local 2>/dev/null x=1 then x=1 export
+--verbose readonly 'quoted text' echo echo cd echo "$1" $(pwd) export printf
+grep echo 'quoted text' --verbose
+		export test sed test printf 'quoted text' test done "$@" test
+"$1" x=1 echo sed /usr/bin | test cd $(pwd) | "$1" "$1" awk awk sed test --verbose
+export echo awk local /usr/bin printf
+done readonly cd 2>/dev/null x=1
+		"$1" 'quoted text' && grep 'quoted text' --verbose then
+readonly "$@" printf 'quoted text' -eu done printf done | printf ${HOME} test test
+		--verbose "$1" $(pwd) /usr/bin sed ${HOME}
+		readonly cd 'quoted text' 2>/dev/null
+2>/dev/null 'quoted text' && 'quoted text'
+		-eu readonly then awk "$@" --verbose grep then export ${HOME} "$@" -eu
+	x=1 "$1" /usr/bin then "$@" 'quoted text'
+	awk cd | test readonly && 2>/dev/null grep && sed grep ${HOME}
+		| local export --verbose &&
+		grep done && then sed "$@" printf 2>/dev/null $(pwd) |
+	x=1 ${HOME} cd done x=1 done export export then test
+	| sed test then $(pwd) /usr/bin ${HOME} -eu awk -eu $(pwd)
+	'quoted text' 2>/dev/null then export -eu -eu
+		done -eu local local readonly
+	| awk 2>/dev/null $(pwd) readonly local ${HOME} --verbose
+readonly -eu readonly grep printf
+	${HOME} 2>/dev/null awk cd export grep "$@" "$1" then grep
+grep readonly printf -eu awk done && --verbose cd local x=1 local awk then
+echo awk local local grep echo x=1 && --verbose export done
+		x=1 -eu cd --verbose && 'quoted text' done awk /usr/bin 'quoted text' -eu sed ${HOME}
+then cd x=1 grep --verbose then -eu $(pwd) local printf then
+	test cd local /usr/bin readonly grep | local --verbose ${HOME} --verbose
+readonly awk cd x=1 done
+awk 2>/dev/null local 2>/dev/null
+2>/dev/null printf local | grep /usr/bin awk -eu local ${HOME} export export
+	"$@" && done grep test
+${HOME} local sed ${HOME} x=1 $(pwd) --verbose sed test readonly printf | 2>/dev/null
+	then readonly 'quoted text' /usr/bin --verbose x=1 echo export
+	&& 2>/dev/null then 2>/dev/null -eu local
+cd && local sed $(pwd) ${HOME}
+		sed && 'quoted text' ${HOME} done readonly -eu --verbose grep readonly --verbose
+		sed local cd then $(pwd) /usr/bin "$@" x=1 then 'quoted text'
+	x=1 2>/dev/null local "$@" 2>/dev/null cd test
+		awk done export -eu then awk $(pwd) "$1" awk then 'quoted text' printf
+2>/dev/null done done /usr/bin
+	${HOME} echo | && /usr/bin /usr/bin
+	local /usr/bin 2>/dev/null && /usr/bin --verbose then awk -eu export
+		"$@" test readonly sed test printf /usr/bin | ${HOME} &&
+	echo then test echo 'quoted text' 'quoted text'
+		export readonly printf 'quoted text' $(pwd) --verbose && done -eu grep grep
+		&& && echo $(pwd) -eu && && /usr/bin --verbose -eu readonly --verbose awk test
+	done grep "$1" --verbose 'quoted text' echo echo "$1"
+		"$1" "$1" export export ${HOME} echo then grep cd 2>/dev/null sed done grep 2>/dev/null
+	'quoted text' then | awk readonly grep 2>/dev/null 'quoted text'
+x=1 $(pwd) && /usr/bin --verbose
+		done export 'quoted text' grep export printf 'quoted text' grep 'quoted text' "$@"
+		then export sed 'quoted text' /usr/bin "$1" ${HOME} export
+$(pwd) 'quoted text' 2>/dev/null
+then -eu then then grep export "$@"
+$(pwd) | | awk x=1 cd local --verbose awk test
+		awk sed 2>/dev/null awk then export && test local readonly "$@" readonly
+	echo && readonly "$1" 'quoted text' awk
+	'quoted text' | test readonly awk export readonly awk --verbose 2>/dev/null
+	"$1" test done ${HOME} printf && local ${HOME} readonly
+		sed test "$@" grep ${HOME} cd done --verbose printf && /usr/bin
+	local sed echo x=1 ${HOME} local awk printf
+	local test grep then ${HOME} printf 2>/dev/null awk printf &&
+	'quoted text' done "$@" test /usr/bin sed --verbose && ${HOME} cd x=1
+	then grep cd test | sed 'quoted text' local cd --verbose
+		grep done awk awk readonly grep "$1" "$@" --verbose 2>/dev/null
+| 'quoted text' | | readonly | "$@" awk -eu readonly
+x=1 "$@" "$@" /usr/bin printf -eu ${HOME} grep cd "$1" export ${HOME}
+/usr/bin $(pwd) ${HOME} /usr/bin
+printf ${HOME} | done sed "$1" echo 'quoted text' --verbose | 'quoted text' "$1"
+		grep readonly echo awk && cd test && grep grep ${HOME} "$1" sed then
+	echo 2>/dev/null readonly "$1"
+		echo printf | export $(pwd) x=1
+		printf && readonly /usr/bin ${HOME} cd /usr/bin
+'quoted text' export x=1 cd --verbose
+		awk test test export cd --verbose echo printf "$@" sed done export |
+	test then awk x=1 printf -eu done grep sed | test awk 'quoted text'
+		test then --verbose "$@" 'quoted text' cd sed "$@" 'quoted text'
+printf ${HOME} test $(pwd) 2>/dev/null
+export "$@" "$1" sed echo "$@" "$1" && $(pwd) readonly
+$(pwd) /usr/bin "$1" echo test ${HOME} && | then test
+	cd "$1" then x=1 | --verbose $(pwd) test sed -eu readonly $(pwd) -eu 2>/dev/null
+		| export grep done sed awk awk printf export "$1"
+export x=1 --verbose -eu readonly
+		/usr/bin -eu done local readonly printf cd local
+	| 2>/dev/null local x=1 printf 2>/dev/null | sed /usr/bin local x=1
+		/usr/bin /usr/bin ${HOME} "$@"
+local $(pwd) 'quoted text' grep && grep "$1"
+awk ${HOME} ${HOME} export ${HOME} cd local export --verbose then done "$@" |
+echo "$1" -eu $(pwd) echo ${HOME}
+		'quoted text' echo | 2>/dev/null --verbose
+		/usr/bin cd sed test | && local && awk --verbose local export then ${HOME}
+	done then grep x=1 | then printf
+		'quoted text' then x=1 export test awk local $(pwd) local $(pwd) echo readonly
+-eu "$@" cd 2>/dev/null awk && local $(pwd)
+| printf && readonly --verbose
+		test export --verbose --verbose ${HOME} cd && test
+readonly then grep test done echo "$1" echo $(pwd)
+	-eu sed export $(pwd) test printf grep grep done
+2>/dev/null then $(pwd) local
+		$(pwd) sed readonly 2>/dev/null local --verbose grep 2>/dev/null awk
+		then | export --verbose "$1"
+	readonly printf --verbose
+--verbose ${HOME} sed done echo
+printf readonly 'quoted text' 'quoted text' /usr/bin -eu "$@"
+	2>/dev/null --verbose awk $(pwd) done x=1 test
+	echo test 'quoted text' | sed 2>/dev/null "$@" --verbose | | printf export readonly
+		cd "$1" x=1 then grep "$@" test ${HOME} 'quoted text' "$1" test 2>/dev/null
+${HOME} x=1 'quoted text' awk && -eu test "$1" local awk then awk test cd
+	'quoted text' ${HOME} ${HOME} "$1"
+then export sed 2>/dev/null --verbose
+local -eu printf cd test test 'quoted text'
+		-eu -eu then cd done && echo grep sed readonly x=1 grep x=1 done local | printf
+	-eu sed done "$1" -eu export export x=1 ${HOME} 'quoted text'
+$(pwd) readonly --verbose 2>/dev/null cd 2>/dev/null cd grep
+$(pwd) grep 2>/dev/null sed cd ${HOME} then cd /usr/bin
+		export /usr/bin | && /usr/bin sed "$1" grep echo cd awk export done done
+		&& sed sed test then cd 'quoted text' -eu cd
+	'quoted text' ${HOME} $(pwd) && --verbose
+		cd 2>/dev/null then && ${HOME} && export 2>/dev/null && sed
+echo done awk $(pwd) && --verbose local then /usr/bin cd local "$@" awk
+	export --verbose then done echo awk test
+	printf test --verbose local awk | cd echo
+grep "$@" done export test --verbose export "$@" "$1" && cd x=1 "$1" ${HOME}
+		local ${HOME} "$1" --verbose 'quoted text' /usr/bin
+"$1" then ${HOME} export readonly 2>/dev/null readonly --verbose echo
+	2>/dev/null 'quoted text' cd | $(pwd) export grep $(pwd) local grep "$1"
+${HOME} readonly grep --verbose ${HOME} local local $(pwd) export echo
+	export --verbose && export echo
+		printf 2>/dev/null echo cd ${HOME}
+	test export 2>/dev/null sed ${HOME}
+		printf echo && grep /usr/bin 'quoted text'
+		test export done 2>/dev/null sed && local --verbose sed readonly echo --verbose
+	--verbose sed done local && done "$@" export ${HOME} && | --verbose
+printf printf done --verbose awk done readonly awk awk "$1" 2>/dev/null
+	cd $(pwd) sed then test /usr/bin $(pwd) cd local ${HOME} "$@"
+	awk awk done "$@" && cd readonly test grep
+then done 2>/dev/null && ${HOME} test | x=1 sed 2>/dev/null
+		cd readonly readonly 'quoted text' $(pwd) done "$1" 'quoted text'
+	echo 2>/dev/null done local cd export readonly && x=1 test cd
+"$@" /usr/bin test done 'quoted text' local
+	"$@" --verbose -eu 2>/dev/null cd readonly -eu
+		cd local sed done printf sed echo ${HOME} $(pwd) echo cd --verbose cd ${HOME} -eu
+${HOME} done ${HOME} printf &&
+awk 'quoted text' --verbose awk readonly then ${HOME} "$1" 2>/dev/null
+	| test /usr/bin grep cd | 2>/dev/null
+	printf "$@" --verbose /usr/bin done cd | then && x=1 readonly "$1"
+		2>/dev/null sed export --verbose "$1" readonly
+		sed "$@" --verbose then /usr/bin
+		sed done --verbose "$@" 'quoted text' export export
+cd | readonly | test sed --verbose --verbose
+	-eu done && --verbose cd -eu awk 2>/dev/null sed ${HOME}
+		${HOME} -eu then --verbose -eu && -eu printf sed --verbose /usr/bin test "$@"
+		'quoted text' && done awk -eu test then ${HOME} echo cd
+sed export done $(pwd) --verbose "$@" --verbose -eu done -eu ${HOME}
+$(pwd) awk x=1 done awk "$@" --verbose --verbose ${HOME}
+	"$1" "$@" x=1 echo test 'quoted text' cd
+	-eu /usr/bin done local -eu readonly && echo x=1 grep | "$@" cd
+		export printf printf export --verbose 2>/dev/null ${HOME}
+	2>/dev/null then echo $(pwd) | 'quoted text'
+${HOME} cd | awk 2>/dev/null "$1" test /usr/bin 'quoted text' readonly
+	"$@" "$@" -eu printf grep readonly local --verbose
+'quoted text' 2>/dev/null $(pwd) cd "$1" ${HOME} done ${HOME} $(pwd) 'quoted text'
+'quoted text' done && sed done --verbose then | x=1 2>/dev/null done ${HOME}
+	local "$@" cd grep ${HOME} $(pwd)
+		'quoted text' awk cd x=1 then && awk | awk 2>/dev/null grep awk done
+	"$1" $(pwd) readonly "$1" export --verbose 2>/dev/null export $(pwd) -eu awk
+readonly "$@" "$@" cd test 'quoted text'
+"$1" printf ${HOME} awk grep | "$1" echo $(pwd) 'quoted text'
+		readonly 'quoted text' /usr/bin sed $(pwd) then echo readonly readonly --verbose
+--verbose readonly readonly awk ${HOME} then 'quoted text'
+cd awk /usr/bin then && test $(pwd)
+	test ${HOME} test sed "$1" -eu local grep 2>/dev/null test "$@" "$1" $(pwd)
+	&& "$1" grep | -eu x=1 "$@" 2>/dev/null ${HOME}
+done "$@" local "$@" readonly
+	done export x=1 printf cd awk printf awk "$1" printf echo readonly -eu done done
+	x=1 /usr/bin sed | 'quoted text' x=1 --verbose "$1" awk $(pwd)
+	sed printf -eu printf x=1 then export $(pwd) cd printf ${HOME} local
+awk --verbose cd printf cd done | /usr/bin awk x=1 then 2>/dev/null
+		${HOME} export ${HOME} sed $(pwd) readonly 'quoted text'
+grep export cd -eu "$1" 2>/dev/null cd "$1" "$@" echo
+		grep then 2>/dev/null local
+		export test readonly awk grep $(pwd)
+	/usr/bin && | && "$1" -eu -eu awk
+		awk --verbose 'quoted text' && -eu -eu export test local ${HOME} $(pwd)
+grep readonly | $(pwd) printf printf
+	sed done readonly 2>/dev/null x=1
+	grep -eu ${HOME} echo sed printf -eu && grep --verbose && --verbose
+	sed -eu then echo sed $(pwd) 2>/dev/null local &&
+		cd done | sed && then grep "$1"
+		-eu && --verbose test /usr/bin x=1 && cd | $(pwd) done export
+--verbose && readonly printf printf --verbose /usr/bin export 'quoted text'
+x=1 grep then 2>/dev/null "$1"
+done "$1" x=1 "$1" sed /usr/bin
+		'quoted text' --verbose 2>/dev/null
+awk sed then local ${HOME} && 'quoted text' x=1 then cd /usr/bin
+grep done echo && export "$1" export x=1
+sed sed then "$@" done $(pwd) local local "$@" 2>/dev/null
+2>/dev/null awk test &&
+export $(pwd) sed echo --verbose local
+		&& done | readonly export export readonly local 'quoted text' --verbose 2>/dev/null
+		test awk local printf x=1 && /usr/bin cd ${HOME} printf export then echo --verbose
+		'quoted text' echo /usr/bin ${HOME} grep "$@"
+| | "$@" local echo 2>/dev/null
+"$1" done /usr/bin done 2>/dev/null grep readonly x=1 grep /usr/bin
+x=1 readonly sed 'quoted text' -eu awk printf
+		test readonly local "$@" "$1" test grep -eu 'quoted text' --verbose ${HOME} done
+		x=1 | sed export -eu printf local x=1
+	x=1 then printf done && test test && export readonly
+	test $(pwd) --verbose && "$1" export "$@"
+		${HOME} "$1" awk "$@" 2>/dev/null | -eu $(pwd) sed grep | && done printf then
+	"$@" awk 'quoted text' | awk $(pwd) export --verbose 'quoted text'
+done -eu x=1 sed readonly cd cd sed | --verbose && export awk done x=1 "$@"
+		"$@" /usr/bin sed grep local then grep /usr/bin
+printf sed | local x=1
+printf /usr/bin echo printf then 2>/dev/null done then readonly && ${HOME} /usr/bin
+	export "$1" -eu export x=1 done then 'quoted text' "$@" local printf
+		printf 'quoted text' echo cd done --verbose
+"$1" cd readonly -eu &&
+		echo done ${HOME} readonly --verbose && x=1
+		done readonly 2>/dev/null $(pwd) awk done local --verbose --verbose
+	| then awk printf /usr/bin /usr/bin "$1" "$1" done grep
+${HOME} | --verbose "$@" 2>/dev/null awk done 2>/dev/null
+	2>/dev/null -eu cd "$@"
+		done echo local x=1 "$1" --verbose
+		&& local export readonly then export local
+	| done ${HOME} --verbose
+x=1 cd readonly export | readonly 2>/dev/null 2>/dev/null
+	done printf export cd test sed awk && | readonly echo "$1" --verbose
+		| | x=1 --verbose export x=1 && | readonly cd grep 2>/dev/null x=1 ${HOME}
+		-eu cd ${HOME} grep --verbose local | sed 'quoted text' 'quoted text' /usr/bin
+	/usr/bin printf awk 2>/dev/null test done awk test grep local
+		2>/dev/null cd then done -eu x=1 cd 'quoted text' export --verbose
+"$1" $(pwd) x=1 /usr/bin local 2>/dev/null test echo echo cd | "$@" --verbose echo
+	x=1 "$@" test export "$1" "$@"
+		"$@" local cd grep printf printf "$@" --verbose grep
+		test then printf done $(pwd) local grep printf --verbose echo "$@" "$1"
+		sed echo printf echo sed grep done test && $(pwd) then && test x=1
+		"$@" then local | --verbose /usr/bin export test x=1 readonly /usr/bin
+grep sed "$@" && test ${HOME} printf "$1" 'quoted text' ${HOME} "$1" cd done readonly
+		echo then | | done export grep -eu -eu --verbose
+		awk grep "$1" /usr/bin echo awk cd 2>/dev/null ${HOME} 2>/dev/null grep test
+	sed readonly /usr/bin export sed x=1 local
+	'quoted text' /usr/bin $(pwd) readonly -eu 'quoted text' ${HOME}
+	echo | | "$1" -eu cd sed -eu 'quoted text' grep
+	2>/dev/null cd "$@" cd /usr/bin
+| --verbose 'quoted text' export --verbose cd 2>/dev/null cd | && awk grep export
+		'quoted text' local cd -eu --verbose "$@"
+	grep ${HOME} --verbose ${HOME}
+	--verbose 'quoted text' echo 2>/dev/null
+		x=1 x=1 | export --verbose | awk -eu cd readonly "$1" export awk | | grep
+		"$@" grep test /usr/bin "$@" then &&
+	&& "$@" -eu awk "$@" --verbose
+sed -eu -eu | "$@" "$@" "$1" cd && grep sed x=1 x=1 export
+	readonly cd test 'quoted text' && grep | "$1" export "$1" $(pwd) /usr/bin
+	echo && 2>/dev/null 2>/dev/null done
+	$(pwd) awk test export /usr/bin test x=1 'quoted text' "$@" 2>/dev/null
+	local grep "$1" 2>/dev/null /usr/bin 'quoted text' "$1"
+	/usr/bin x=1 'quoted text' test readonly done 'quoted text' sed
+export sed cd "$@" local "$1" cd awk && printf readonly /usr/bin ${HOME}
+		test cd then local grep "$1" local /usr/bin echo 'quoted text'
+export && $(pwd) | readonly sed 'quoted text' /usr/bin -eu awk "$1" ${HOME} test
+/usr/bin 'quoted text' echo /usr/bin ${HOME} readonly
+printf | | | printf "$@" --verbose cd grep sed readonly --verbose
+		awk $(pwd) "$1" && export test
+${HOME} done awk export printf | ${HOME} readonly
+printf printf -eu x=1 |
+		| printf readonly sed export /usr/bin echo sed $(pwd) x=1
+	/usr/bin echo 2>/dev/null -eu echo && ${HOME} ${HOME} $(pwd)
+		| then grep --verbose && local x=1 local grep 'quoted text'
+	awk && export $(pwd) $(pwd) awk grep readonly cd printf test export done $(pwd)
+	grep -eu local grep then 'quoted text' readonly
+${HOME} done then local x=1
+x=1 'quoted text' test grep done /usr/bin printf awk local
+		test "$@" | 2>/dev/null test awk cd cd awk grep local "$1" local awk
+--verbose && 'quoted text' done
+local 2>/dev/null --verbose -eu readonly
+	echo local 2>/dev/null echo --verbose then grep done echo ${HOME} | cd -eu
+		"$1" sed cd -eu grep export -eu awk "$@" awk cd awk && local local && export
+test "$1" | cd cd export ${HOME} test x=1 | $(pwd) awk cd "$1"
+	/usr/bin test echo printf 2>/dev/null /usr/bin printf printf
+printf awk ${HOME} --verbose $(pwd) readonly "$1"
+readonly && awk $(pwd) local export
+done test test && | "$1" $(pwd) test echo cd cd sed cd awk cd test awk x=1 cd
+	sed | printf awk awk 2>/dev/null readonly awk awk awk local /usr/bin $(pwd) x=1
+printf "$1" echo grep cd -eu echo export
+echo && export test grep ${HOME} | done local 'quoted text' awk && --verbose
+grep grep printf | done "$1" --verbose readonly
+	echo grep $(pwd) grep cd cd x=1 echo x=1 x=1 "$1"
+		"$1" cd cd $(pwd) ${HOME} sed then then sed --verbose
+${HOME} then "$1" sed ${HOME} | readonly $(pwd)
+$(pwd) then 'quoted text' --verbose grep
+	printf /usr/bin $(pwd) --verbose awk grep local grep done $(pwd) export readonly
+2>/dev/null printf local grep -eu x=1 'quoted text'
+	| printf "$1" $(pwd) /usr/bin ${HOME} then ${HOME} x=1 ${HOME} 'quoted text'
+		echo local test 'quoted text' printf ${HOME} cd grep ${HOME} awk sed readonly
+	-eu readonly 2>/dev/null cd awk | | then then local 2>/dev/null readonly "$1"
+	"$@" printf 'quoted text' printf 2>/dev/null | -eu /usr/bin
+	echo "$@" done test && 'quoted text'
+		sed grep local grep done
+	&& done /usr/bin local readonly "$@" echo 'quoted text'
+		test "$@" && local sed 'quoted text'
+		&& --verbose /usr/bin --verbose
+	then local done readonly readonly test "$@" printf
+		'quoted text' /usr/bin && "$@" sed -eu test 2>/dev/null sed "$1" $(pwd)
+		x=1 $(pwd) readonly cd awk test cd awk $(pwd) 'quoted text' 'quoted text' grep
+		--verbose ${HOME} "$@" x=1 grep then $(pwd) 2>/dev/null
+	&& ${HOME} readonly done test
+x=1 x=1 export "$@" --verbose x=1 readonly local grep
+		test -eu done $(pwd) readonly then -eu "$1"
+sed awk && "$1" local export grep $(pwd) -eu cd x=1 test test grep echo
+	${HOME} done sed | "$@" sed -eu readonly && awk $(pwd) 'quoted text' readonly
+grep export readonly awk cd $(pwd) 'quoted text' -eu "$@"
+		"$@" echo "$@" local "$@" local then --verbose awk /usr/bin local export --verbose
+	printf 2>/dev/null --verbose echo -eu test
+	readonly cd echo then "$1"
+-eu | "$@" 'quoted text' && grep --verbose done then --verbose readonly | done
+	sed cd done printf export "$1" $(pwd) then "$1" grep $(pwd) echo then
+echo 'quoted text' test cd $(pwd) done
+		awk awk 'quoted text' awk ${HOME} /usr/bin
+sed | --verbose /usr/bin -eu awk
+		| then && echo x=1 done $(pwd)
+echo x=1 x=1 $(pwd) && && --verbose --verbose x=1 --verbose 2>/dev/null
+	done test local local local --verbose cd awk "$@" readonly
+grep local grep "$@" grep export
+sed export printf done "$@" && test local export 2>/dev/null
+	grep done x=1 local && 2>/dev/null grep
+		sed local then awk sed $(pwd) awk /usr/bin | cd export done
+	'quoted text' cd awk "$1" $(pwd) | test "$@" sed grep readonly then local
+		2>/dev/null cd ${HOME} x=1 done 'quoted text'
+	grep "$1" x=1 x=1 printf grep sed export 2>/dev/null
+		x=1 awk done x=1 test done ${HOME} ${HOME}
+"$1" /usr/bin "$1" then 'quoted text' cd done then $(pwd) readonly export 'quoted text'
+		${HOME} ${HOME} test readonly export -eu done
+		--verbose sed sed readonly -eu
+	local export readonly $(pwd) readonly test awk echo /usr/bin export cd cd test
+		--verbose printf echo | export done cd && $(pwd) 'quoted text'
+	test grep x=1 "$@" awk 'quoted text' test | | echo | | "$@"
+	done 2>/dev/null 'quoted text'
+	| awk "$1" "$@" 2>/dev/null --verbose
+	grep sed | && x=1 'quoted text' x=1 ${HOME}
+	then ${HOME} printf sed 'quoted text' done 2>/dev/null done printf $(pwd) local
@@ -0,0 +1,2001 @@
+printf | 'quoted text' test 'quoted text' echo
+		${HOME} $(pwd) x=1 /usr/bin then then --verbose export
+		"$@" | /usr/bin done sed grep done readonly
+		${HOME} echo export printf $(pwd) test then --verbose then $(pwd) awk ${HOME}
+printf && | /usr/bin | $(pwd) ${HOME} cd ${HOME} grep done 2>/dev/null "$1"
+grep x=1 test grep sed sed --verbose done &&
+	echo 2>/dev/null sed /usr/bin printf x=1 /usr/bin
+		--verbose echo --verbose "$1" test grep grep x=1 "$@"
+	done printf --verbose export awk cd | local
+	-eu 2>/dev/null 2>/dev/null readonly -eu 2>/dev/null
+	--verbose 'quoted text' sed readonly -eu test export sed printf cd 'quoted text'
+		-eu sed awk export /usr/bin && test ${HOME} cd then | x=1
+	sed $(pwd) sed && "$@" readonly awk done awk export printf ${HOME}
+readonly test /usr/bin && sed
+grep "$1" 2>/dev/null /usr/bin $(pwd)
+		export $(pwd) | ${HOME} readonly local local test && /usr/bin cd cd
+		'quoted text' "$@" --verbose sed | awk awk test local export done then "$1" "$1"
+	${HOME} && echo sed ${HOME}
+		x=1 cd 'quoted text' 'quoted text' "$@" x=1 cd sed grep printf grep local local
+		x=1 grep awk local x=1 readonly grep
+	then --verbose && -eu awk ${HOME} 2>/dev/null && | then export
+		2>/dev/null readonly awk $(pwd) printf /usr/bin then done --verbose && export
+'quoted text' "$1" "$@" 2>/dev/null
+echo /usr/bin sed cd test done "$@"
+cd -eu cd grep readonly echo "$1" | export done | | grep -eu --verbose
+	readonly x=1 | 2>/dev/null readonly x=1 -eu --verbose awk /usr/bin
+	2>/dev/null && awk "$@" echo test -eu && | "$1" "$@" export /usr/bin x=1
+grep --verbose "$1" then sed 2>/dev/null $(pwd) ${HOME} then printf
+		2>/dev/null 2>/dev/null 'quoted text' x=1
+		cd "$@" then 2>/dev/null && test 2>/dev/null then grep -eu done sed $(pwd) --verbose
+		| readonly test echo $(pwd) readonly | done test | awk cd "$@" -eu --verbose
+		grep sed $(pwd) then | $(pwd) 2>/dev/null grep awk done 'quoted text' "$@" --verbose
+	$(pwd) printf "$@" done && cd $(pwd) done "$1" 'quoted text' "$@" export "$1"
+		$(pwd) "$@" -eu 2>/dev/null /usr/bin /usr/bin test then | printf "$1" local
+		"$@" $(pwd) cd --verbose "$1" grep export
+		-eu "$1" echo ${HOME} test
+	local --verbose | done x=1
+		--verbose -eu | | /usr/bin sed export
+	2>/dev/null awk test echo "$@" "$1" done x=1 cd readonly cd ${HOME} 2>/dev/null
+--verbose ${HOME} export "$1" x=1 -eu cd test 2>/dev/null test sed cd test && -eu
+		readonly local && export | "$@" -eu 2>/dev/null 2>/dev/null grep /usr/bin
+-eu printf grep ${HOME} export "$1"
+	--verbose --verbose readonly "$1" local awk done 'quoted text'
+awk 2>/dev/null done awk echo
+	"$1" test -eu awk export printf "$@" x=1 grep ${HOME} cd
+	${HOME} done sed /usr/bin
+		export | echo 2>/dev/null sed /usr/bin 2>/dev/null local 'quoted text'
+	local local local "$1" grep readonly ${HOME} echo grep /usr/bin echo /usr/bin
+	${HOME} sed readonly cd "$1" "$1" $(pwd) 2>/dev/null readonly grep
+		'quoted text' 'quoted text' readonly /usr/bin cd done sed
+		awk echo x=1 | test $(pwd) sed cd test "$@"
+"$1" awk awk printf then ${HOME} /usr/bin readonly awk 2>/dev/null
+	sed -eu $(pwd) 'quoted text' awk --verbose x=1 echo grep readonly ${HOME} ${HOME}
+	${HOME} then 'quoted text' local printf test test -eu done
+local local then ${HOME}
+	x=1 export export echo /usr/bin x=1 printf awk --verbose echo x=1 then
+printf /usr/bin then sed $(pwd) "$@" /usr/bin && awk readonly
+		sed -eu sed awk /usr/bin
+	&& readonly /usr/bin "$1"
+		x=1 --verbose "$1" "$1" --verbose /usr/bin then echo grep -eu x=1 'quoted text'
+		readonly 'quoted text' readonly printf -eu --verbose
+	${HOME} $(pwd) /usr/bin then ${HOME}
+&& -eu grep /usr/bin "$1"
+x=1 && sed -eu export done sed $(pwd) test done -eu awk done awk
+		readonly && printf 'quoted text' sed echo && -eu --verbose awk done
+"$1" $(pwd) awk readonly local
+	test | "$@" /usr/bin cd export
+	/usr/bin grep echo --verbose
+local awk awk then "$@"
+		then grep /usr/bin awk readonly && test ${HOME} "$@" then -eu &&
+	test && test "$@" awk /usr/bin && export then awk 2>/dev/null x=1 | "$1" sed
+		printf | test then awk export | then done /usr/bin && && | printf sed cd $(pwd)
+--verbose then then grep x=1 /usr/bin printf then "$1" "$1" readonly
+"$@" cd test /usr/bin export
+&& 'quoted text' sed printf -eu "$1" | $(pwd) /usr/bin export 'quoted text'
+"$@" echo export "$1" echo done echo readonly
+	local $(pwd) x=1 printf "$1" done echo export echo | sed -eu cd 2>/dev/null ${HOME}
+readonly $(pwd) sed test 'quoted text'
+&& readonly test "$1" /usr/bin awk echo done 'quoted text' -eu --verbose
+	&& /usr/bin sed then done then 2>/dev/null
+		2>/dev/null test grep $(pwd) 2>/dev/null sed 'quoted text' grep
+	echo then sed cd sed then printf printf readonly grep /usr/bin --verbose
+	cd test export awk echo --verbose cd readonly "$1" sed grep /usr/bin awk "$@"
+	$(pwd) ${HOME} export printf -eu 2>/dev/null x=1 -eu sed 2>/dev/null grep local
+"$1" cd awk -eu readonly done printf $(pwd) "$1"
+export then cd -eu export
+		$(pwd) sed export test test then 'quoted text' $(pwd) "$1" printf test
+${HOME} x=1 && done test local ${HOME} 2>/dev/null grep
+sed 'quoted text' cd readonly done /usr/bin
+| sed ${HOME} && --verbose grep && cd $(pwd) then /usr/bin
+	awk && $(pwd) x=1 -eu echo
+	readonly awk "$1" ${HOME} grep export "$@" ${HOME} $(pwd)
+--verbose | printf export test ${HOME} "$@" --verbose done awk sed
+	/usr/bin && grep 2>/dev/null -eu printf "$1" /usr/bin
+		done awk /usr/bin -eu && 2>/dev/null sed export readonly
+	test printf x=1 'quoted text' awk | then | printf grep --verbose sed
+		export echo x=1 awk readonly "$@" then grep
+		export then ${HOME} --verbose sed then /usr/bin awk test --verbose
+	-eu grep --verbose &&
+'quoted text' readonly test 'quoted text' cd
+$(pwd) grep export ${HOME} | sed readonly x=1 sed readonly
+	test -eu readonly awk echo printf printf done $(pwd)
+| -eu $(pwd) export --verbose awk sed
+	${HOME} local 2>/dev/null export 2>/dev/null "$1" 'quoted text' grep
+		echo then export 'quoted text' then test printf $(pwd) -eu cd
+	printf grep cd cd then local && "$1" readonly 2>/dev/null
+	local cd local local done
+	| local grep /usr/bin echo printf "$1" ${HOME} 2>/dev/null && test |
+		awk awk awk && sed test $(pwd) local "$@" | test awk -eu then echo
+		test "$1" 'quoted text' 'quoted text'
+	export | && export echo /usr/bin echo awk then && "$@" 2>/dev/null
+	&& readonly /usr/bin local then then grep then cd grep "$1"
+		cd then printf sed "$@" done "$1" echo /usr/bin "$@"
+echo "$@" local export ${HOME} x=1 test then readonly
+	then ${HOME} /usr/bin "$1" sed -eu $(pwd) export readonly
+${HOME} /usr/bin "$1" echo test local test awk 'quoted text'
+${HOME} "$@" && 2>/dev/null "$@" echo --verbose 'quoted text' echo printf echo
+	x=1 /usr/bin "$1" 'quoted text' -eu local
+	sed 'quoted text' 2>/dev/null $(pwd) export
+	'quoted text' "$1" 2>/dev/null ${HOME} "$1" then awk
+	done then -eu x=1 then --verbose then awk export 'quoted text' test
+"$@" && readonly ${HOME} 'quoted text'
+		--verbose --verbose echo then
+	${HOME} awk done done -eu -eu echo
+		--verbose --verbose awk local export grep done local x=1 | --verbose
+${HOME} cd | ${HOME} sed test readonly
+	cd "$@" grep -eu x=1 x=1
+		$(pwd) $(pwd) | readonly /usr/bin 2>/dev/null local
+2>/dev/null then test 'quoted text' /usr/bin
+	readonly grep ${HOME} && "$1" local x=1 && awk printf
+	test sed "$@" "$1" grep x=1 printf /usr/bin then
+	$(pwd) grep -eu /usr/bin 2>/dev/null then awk -eu /usr/bin awk /usr/bin
+'quoted text' && cd -eu grep $(pwd) local sed
+	--verbose | "$@" && printf awk test | cd 'quoted text'
+	&& echo ${HOME} | 'quoted text' then "$1" export done "$@" done "$1" && grep
+	x=1 done && done local grep 'quoted text'
+	sed done 2>/dev/null cd awk $(pwd) then $(pwd) sed done | local "$@" local
+	export --verbose readonly 'quoted text' ${HOME}
+	local printf | && awk "$1" /usr/bin grep local export | done
+		cd test | "$1" grep grep echo done --verbose
+| echo && then local -eu local
+	x=1 then done && readonly x=1 /usr/bin --verbose
+sed 2>/dev/null ${HOME} -eu
+grep && sed echo $(pwd) 'quoted text' --verbose
+	sed local test echo awk readonly
+		awk done "$@" 2>/dev/null --verbose && cd printf local
+readonly $(pwd) --verbose printf /usr/bin && printf "$1" "$1" && $(pwd)
+	sed -eu test "$@" readonly 'quoted text' echo --verbose
+readonly echo --verbose cd done "$1" 'quoted text' 'quoted text'
+cd "$1" local /usr/bin printf awk 2>/dev/null "$@"
+	export done 2>/dev/null printf ${HOME} /usr/bin && /usr/bin
+		/usr/bin export awk 'quoted text' /usr/bin awk x=1 "$1" "$@" done sed --verbose
+	--verbose readonly cd
+		awk --verbose "$@" local && $(pwd) /usr/bin done awk test awk /usr/bin ${HOME}
+		printf done | -eu /usr/bin $(pwd) readonly then $(pwd) 'quoted text'
+"$@" "$1" && -eu test /usr/bin test
+$(pwd) sed export "$1" echo --verbose "$@" --verbose x=1 done printf test export
+	test 'quoted text' sed sed awk x=1 x=1 done
+	2>/dev/null | "$@" test grep then sed -eu
+	printf $(pwd) echo /usr/bin test "$1" $(pwd) sed cd | 2>/dev/null "$@" printf done
+		${HOME} $(pwd) export cd 2>/dev/null export -eu /usr/bin
+	test readonly readonly printf "$1" printf x=1 /usr/bin x=1 grep
+sed then test sed printf then printf
+local $(pwd) "$1" 'quoted text' export && --verbose | awk then awk $(pwd)
+	$(pwd) export awk readonly -eu echo sed grep $(pwd) echo grep export
+	echo test /usr/bin then local printf sed "$@" done then "$1" "$@"
+		echo $(pwd) "$@" 2>/dev/null readonly $(pwd) "$@" 2>/dev/null "$@" echo grep
+${HOME} x=1 awk --verbose cd sed test
+	cd && local --verbose export 2>/dev/null -eu
+	echo printf 2>/dev/null ${HOME}
+grep -eu export cd local done
+	'quoted text' --verbose x=1 | awk done ${HOME} test printf printf readonly
+		grep cd 2>/dev/null && printf sed $(pwd) awk
+		test && awk -eu awk "$1" ${HOME} grep 'quoted text'
+	--verbose test ${HOME} ${HOME} 2>/dev/null grep 'quoted text' "$1"
+	readonly cd "$1" cd readonly ${HOME} /usr/bin ${HOME} local --verbose local x=1
+	echo | local /usr/bin 2>/dev/null && test -eu printf 2>/dev/null
+		sed export $(pwd) --verbose grep grep "$@" && /usr/bin sed readonly
+		"$@" printf export | readonly "$1" && awk | 'quoted text'
+"$@" test then | 'quoted text' test export done export printf cd
+	--verbose echo "$@" export grep 2>/dev/null
+		local readonly 2>/dev/null
+		test local done awk "$1" $(pwd)
+grep | readonly grep cd /usr/bin printf
+	| "$@" ${HOME} echo done "$@" test $(pwd)
+test "$1" --verbose 'quoted text' --verbose export
+cd export sed awk -eu x=1 export
+		x=1 readonly 2>/dev/null -eu "$1" | && awk
+export test x=1 x=1 "$@" readonly
+	export cd done | readonly "$@"
+grep test /usr/bin export x=1 /usr/bin sed /usr/bin export /usr/bin
+/usr/bin "$1" awk --verbose then x=1 "$@" local local 2>/dev/null local
+		${HOME} printf 2>/dev/null 'quoted text' local local cd awk 2>/dev/null
+	grep export awk x=1 /usr/bin -eu /usr/bin sed grep "$1" $(pwd)
+	readonly cd grep awk then readonly -eu grep sed
+${HOME} grep cd printf then local
+	"$1" -eu "$@" printf test printf
+		done | cd ${HOME} cd local then printf /usr/bin /usr/bin awk done ${HOME} export
+/usr/bin "$1" awk test then 'quoted text' cd cd readonly printf
+	/usr/bin then then local ${HOME}
+"$@" then export 'quoted text' sed ${HOME} /usr/bin
+	done local $(pwd) --verbose grep grep sed | awk readonly "$@" ${HOME} then
+	&& --verbose "$@" 'quoted text' test 2>/dev/null sed $(pwd) local cd "$@" sed
+		readonly && sed sed echo -eu grep
+&& "$1" local readonly x=1 readonly | cd cd
+		$(pwd) done echo 'quoted text' cd local 2>/dev/null 'quoted text' && echo
+		awk 'quoted text' sed readonly awk 'quoted text' readonly grep sed
+		printf sed 'quoted text' local && readonly $(pwd)
+	"$1" printf | -eu cd "$@"
+	done cd then /usr/bin printf echo $(pwd) then "$@" printf
+cd x=1 "$1" echo readonly --verbose printf |
+'quoted text' 2>/dev/null cd $(pwd) awk awk
+${HOME} readonly "$@" 2>/dev/null x=1 -eu --verbose -eu
+		done export then then && echo test 2>/dev/null --verbose echo
+	grep --verbose /usr/bin done
+	2>/dev/null grep --verbose && --verbose cd printf echo
+local $(pwd) grep --verbose -eu -eu /usr/bin
+export 'quoted text'
+readonly "$1" x=1 awk && ${HOME} cd /usr/bin test local test
+		then /usr/bin 2>/dev/null /usr/bin "$1" --verbose "$1" | sed /usr/bin
+	$(pwd) "$1" --verbose | printf 2>/dev/null && printf $(pwd) && /usr/bin then
+cd echo /usr/bin $(pwd) then printf grep export
+		awk cd -eu awk local grep awk /usr/bin then local -eu "$@" local 'quoted text'
+		'quoted text' echo "$@" $(pwd) "$1" sed /usr/bin
+	test 2>/dev/null "$1" 'quoted text' $(pwd) -eu 'quoted text' printf test printf
+	grep done test -eu test done cd readonly ${HOME} cd printf "$@"
+		-eu sed readonly /usr/bin
+"$@" test 2>/dev/null cd
+		echo then ${HOME} awk grep && --verbose 2>/dev/null
+	readonly local && done 2>/dev/null export then echo readonly
+"$1" | test sed grep "$@" && | cd
+		2>/dev/null -eu --verbose
+		cd test -eu test grep && "$@"
+readonly sed --verbose ${HOME} ${HOME} sed /usr/bin $(pwd)
+then cd cd printf sed local printf
+		/usr/bin grep export -eu && 'quoted text' /usr/bin
+done test -eu echo grep "$1" "$@" "$@"
+	| "$1" echo "$1" ${HOME} echo $(pwd)
+	/usr/bin 'quoted text' 'quoted text'
+		${HOME} test readonly test readonly printf echo export x=1 "$1" then sed sed grep
+	/usr/bin 'quoted text' /usr/bin readonly done | sed
+'quoted text' "$@" "$@" "$@" /usr/bin "$1" $(pwd) sed local readonly awk -eu "$@"
+'quoted text' | 'quoted text'
+	then "$@" export grep x=1 x=1 export done 'quoted text' test echo done cd then
+		readonly --verbose test printf done grep --verbose | sed ${HOME} /usr/bin 2>/dev/null
+sed -eu /usr/bin /usr/bin grep then $(pwd) -eu awk done &&
+--verbose then cd 2>/dev/null local 'quoted text'
+test && echo x=1 printf readonly
+	done test -eu echo ${HOME} test
+		done "$1" export "$1" "$1" "$1" 2>/dev/null x=1 "$1" echo cd x=1 "$@" sed then
+	"$@" export | --verbose $(pwd) awk awk 2>/dev/null cd export $(pwd)
+		sed grep /usr/bin "$1"
+sed export 'quoted text' printf ${HOME} then "$1" then | -eu cd
+		grep grep /usr/bin && done then then then x=1 && && cd $(pwd) done cd
+	sed -eu export then "$1" $(pwd) "$1" test | /usr/bin
+${HOME} -eu cd "$1" local local 'quoted text'
+		done awk -eu then 2>/dev/null ${HOME} printf /usr/bin readonly printf x=1 && &&
+	-eu --verbose done awk export local
+	&& | export 2>/dev/null then | grep --verbose
+	awk done export | "$1" printf echo
+&& sed "$@" -eu grep grep sed --verbose "$1" x=1
+2>/dev/null "$1" $(pwd) -eu --verbose $(pwd) local "$1" export
+	echo 'quoted text' 'quoted text' | && x=1 && readonly then then export
+		--verbose && done then done --verbose /usr/bin
+		$(pwd) then "$@" --verbose awk 'quoted text' cd echo echo 2>/dev/null
+		'quoted text' | /usr/bin
+		"$@" printf "$1" "$@" "$1" local echo
+		&& -eu echo readonly
+export --verbose ${HOME} $(pwd) $(pwd) awk sed
+export awk readonly export export 2>/dev/null local ${HOME}
+		printf printf -eu 2>/dev/null /usr/bin
+printf --verbose test 2>/dev/null "$@" 2>/dev/null test --verbose
+	echo printf awk && 2>/dev/null export printf /usr/bin |
+	cd export ${HOME} ${HOME} --verbose /usr/bin local 2>/dev/null echo sed ${HOME}
+x=1 export readonly done sed "$1" grep 'quoted text' $(pwd) 'quoted text' && ${HOME}
+$(pwd) "$1" 2>/dev/null 2>/dev/null printf printf "$@"
+	printf -eu awk sed 2>/dev/null | grep
+		printf printf /usr/bin | echo local x=1
+printf local local then awk $(pwd) "$1" export && awk
+	/usr/bin $(pwd) --verbose | "$@" -eu "$1" export -eu x=1 export
+${HOME} && 2>/dev/null ${HOME} "$@" done && printf -eu "$@" --verbose done
+	${HOME} "$1" echo 2>/dev/null -eu -eu
+	'quoted text' printf echo 2>/dev/null 'quoted text' 2>/dev/null test
+	echo 'quoted text' grep 'quoted text' && x=1 "$1"
+	"$@" cd --verbose x=1 $(pwd) awk sed && grep
+sed cd sed test "$1" echo 2>/dev/null "$1" sed
+	readonly 2>/dev/null 2>/dev/null cd echo "$1" 'quoted text' "$@" local then
+		test "$1" /usr/bin then sed $(pwd) cd printf 2>/dev/null "$@" local
+&& export | x=1 $(pwd) cd 'quoted text'
+x=1 'quoted text' -eu x=1 "$1" local 2>/dev/null echo "$@"
+| cd "$1" export "$@" ${HOME} -eu | |
+2>/dev/null grep && test $(pwd) ${HOME} "$@" grep readonly then readonly sed
+		readonly sed sed test 'quoted text' x=1 done && echo
+	2>/dev/null --verbose x=1
+	x=1 readonly done cd local done "$1" echo && done 2>/dev/null then 2>/dev/null
+	&& export && cd readonly $(pwd) $(pwd) 2>/dev/null printf sed | 'quoted text'
+done $(pwd) | sed export && -eu && then printf done cd readonly sed
+		2>/dev/null local "$@" "$1" sed | grep 2>/dev/null x=1
+	echo && test "$@" ${HOME} test grep awk /usr/bin
+export awk /usr/bin x=1
+	$(pwd) export 'quoted text' done /usr/bin cd "$1" x=1 "$1" $(pwd) "$@" local
+	awk then local | "$1" export then
+	"$@" echo printf | 2>/dev/null echo
+		&& cd --verbose /usr/bin --verbose grep 'quoted text' ${HOME} export then test
+2>/dev/null --verbose awk awk x=1 export /usr/bin
+test | local --verbose 2>/dev/null sed printf x=1
+echo /usr/bin export -eu sed /usr/bin -eu $(pwd) x=1 local
+	grep /usr/bin /usr/bin readonly printf
+	cd x=1 -eu && "$1" 'quoted text'
+		| echo grep 2>/dev/null 2>/dev/null 2>/dev/null
+	&& "$@" grep sed && -eu printf
+	| 2>/dev/null export -eu
+		readonly --verbose cd 'quoted text' awk --verbose
+		"$1" | cd 2>/dev/null test then
+	sed -eu then ${HOME} x=1 "$1" awk cd cd done -eu
+	done export /usr/bin | done
+		done 'quoted text' | x=1 $(pwd) test -eu $(pwd) && awk done 2>/dev/null "$@"
+grep -eu && 2>/dev/null local /usr/bin sed && "$1" "$@" awk
+	&& "$@" printf awk 'quoted text' ${HOME} echo echo "$1" "$1" "$1" "$@" /usr/bin
+		export sed test && | "$@" | | export echo $(pwd) -eu then echo -eu 'quoted text'
+		2>/dev/null $(pwd) printf echo sed $(pwd)
+		test done -eu /usr/bin x=1 done /usr/bin then local && test awk export --verbose
+	| cd && && -eu $(pwd) echo
+2>/dev/null "$@" test x=1 then local local --verbose
+-eu echo awk 2>/dev/null cd readonly cd done x=1 2>/dev/null "$1" awk
+		test export grep readonly | echo export export sed x=1 sed done ${HOME} 2>/dev/null
+--verbose local printf /usr/bin x=1 awk grep x=1 $(pwd) awk
+		done done then 2>/dev/null "$@" readonly -eu export /usr/bin
+test 'quoted text' grep test && "$@" done | done $(pwd)
+"$1" cd done then sed 2>/dev/null | sed 'quoted text' export awk printf | -eu -eu
+2>/dev/null -eu grep export | awk | "$1"
+	done done --verbose done 'quoted text'
+	then echo test $(pwd) ${HOME} 'quoted text'
+| readonly grep printf readonly --verbose then
+		&& local /usr/bin done ${HOME} awk -eu "$1" readonly 'quoted text' export |
+awk 'quoted text' grep "$1" 'quoted text' && $(pwd) echo
+"$@" then /usr/bin readonly echo done | test "$@" echo 2>/dev/null
+then local printf export done sed
+	'quoted text' && local "$@" sed awk -eu local sed
+| printf readonly export export printf "$1" "$1" --verbose
+printf ${HOME} grep "$@" readonly test "$1" "$@" printf done cd done local
+'quoted text' then "$@" local awk then readonly local local
+		awk x=1 grep /usr/bin sed --verbose done echo
+	'quoted text' awk ${HOME} done
+-eu "$1" test "$@" grep printf /usr/bin
+"$1" ${HOME} then sed awk cd 2>/dev/null
+	then "$@" test then ${HOME} cd printf then -eu
+$(pwd) local 2>/dev/null printf 2>/dev/null
+	&& test echo $(pwd) local then x=1 then 2>/dev/null
+		echo /usr/bin --verbose x=1 sed --verbose
+	/usr/bin test readonly readonly test then "$1" awk test awk
+	--verbose ${HOME} echo --verbose grep | | && grep cd local readonly $(pwd) -eu
+${HOME} printf 'quoted text' -eu readonly -eu cd -eu | awk ${HOME} printf --verbose
+&& cd $(pwd) $(pwd) cd done -eu done echo 2>/dev/null export "$@" local then
+		export done printf ${HOME}
+	'quoted text' printf printf 'quoted text' awk x=1 local 2>/dev/null
+		| done "$@" --verbose 2>/dev/null $(pwd) sed export test && --verbose
+done done ${HOME} $(pwd) x=1 'quoted text' sed awk
+${HOME} 2>/dev/null ${HOME} printf | export
+-eu export x=1 test grep
+	'quoted text' then done /usr/bin
+	local then done awk echo "$@" printf 'quoted text'
+	then | grep printf 'quoted text'
+	export test export grep --verbose | /usr/bin local grep readonly awk sed
+	"$1" --verbose export --verbose x=1 x=1 local
+		readonly test grep -eu readonly sed grep 'quoted text' sed $(pwd)
+		&& export cd grep && ${HOME} --verbose export done then awk x=1 $(pwd) 2>/dev/null
+	done cd 2>/dev/null grep grep "$1" echo x=1 x=1 printf then
+		"$@" test 2>/dev/null ${HOME} 'quoted text' done 2>/dev/null
+	done grep x=1 -eu --verbose
+	printf -eu printf test x=1 /usr/bin cd 'quoted text'
+	${HOME} /usr/bin readonly 2>/dev/null $(pwd) then x=1 readonly
+-eu 2>/dev/null done $(pwd) awk done local --verbose "$1"
+		x=1 test -eu $(pwd) local 2>/dev/null export "$@" | -eu x=1 -eu | then ${HOME}
+		"$1" 2>/dev/null 2>/dev/null -eu export
+	2>/dev/null done grep | cd "$1" echo awk readonly export
+	printf | | x=1 -eu "$@" done grep --verbose awk | 2>/dev/null
+	2>/dev/null sed $(pwd) local /usr/bin /usr/bin
+		${HOME} test /usr/bin "$1"
+		$(pwd) 2>/dev/null -eu ${HOME} printf local /usr/bin test
+		-eu ${HOME} 2>/dev/null test -eu --verbose --verbose /usr/bin awk
+	2>/dev/null awk echo "$1" ${HOME} -eu $(pwd) && | 'quoted text'
+echo local cd -eu grep export sed
+sed readonly x=1 done "$@" 'quoted text' grep test --verbose --verbose grep
+echo | cd "$@" printf && test local ${HOME} 'quoted text'
+		then readonly then export grep -eu -eu --verbose sed local "$@" "$@"
+	grep echo local "$1" -eu x=1 readonly $(pwd) --verbose grep
+		cd awk ${HOME} test export 2>/dev/null $(pwd) echo /usr/bin cd cd printf then cd
+done cd x=1 "$@" -eu sed "$1" printf
+${HOME} grep ${HOME} export local export then x=1 done
+	then 2>/dev/null "$@" $(pwd) | cd printf readonly ${HOME}
+	"$1" ${HOME} ${HOME} -eu 'quoted text' --verbose echo then echo $(pwd)
+	--verbose echo x=1 "$1" export sed cd "$@"
+	sed readonly export grep grep test readonly x=1 "$1" then sed echo
+		echo local ${HOME} done 2>/dev/null
+		printf $(pwd) done cd --verbose x=1 | --verbose
+	sed && then sed "$1" grep 'quoted text' readonly
+sed "$1" | echo grep && "$1"
+	then test sed "$@" --verbose && --verbose | "$@" -eu then readonly "$@" then $(pwd)
+		sed awk "$@" "$1" -eu && echo $(pwd) -eu then export 2>/dev/null
+${HOME} | && --verbose grep "$1" 'quoted text' then readonly export x=1 readonly
+"$@" "$1" grep local | && ${HOME} 2>/dev/null test
+'quoted text' test echo -eu local ${HOME} export ${HOME} export awk | local 2>/dev/null
+local printf 2>/dev/null echo 2>/dev/null $(pwd) "$@" | echo --verbose
+	--verbose grep echo then export done export
+		"$1" echo test "$1" then "$@"
+		/usr/bin local then readonly export cd --verbose 'quoted text' "$1" done 2>/dev/null
+		then -eu echo cd readonly printf then $(pwd) local printf "$1" then $(pwd) export
+	${HOME} awk | x=1 then $(pwd) x=1 "$1" --verbose done done then done echo
+		-eu -eu export "$@" then
+		cd 2>/dev/null test awk $(pwd) sed local cd "$@" 'quoted text'
+		&& export && then ${HOME} 'quoted text' 'quoted text'
+		printf 2>/dev/null done $(pwd) x=1 /usr/bin x=1 awk export sed "$1" then
+		2>/dev/null | "$1" /usr/bin 'quoted text' 2>/dev/null done 2>/dev/null
+	local ${HOME} grep grep then sed sed $(pwd) 2>/dev/null
+		| echo $(pwd) /usr/bin sed sed 'quoted text'
+		echo $(pwd) 2>/dev/null export x=1 printf printf "$1" grep 2>/dev/null 'quoted text'
+	export sed "$1" readonly done
+		'quoted text' && && $(pwd)
+		sed --verbose cd "$@" | | /usr/bin local -eu cd $(pwd) && 'quoted text'
+--verbose "$1" awk then
+		printf readonly x=1 -eu cd $(pwd) export test ${HOME}
+&& local awk && "$@" --verbose printf echo test 'quoted text'
+x=1 awk && done printf grep then grep
+/usr/bin test 'quoted text' awk echo sed sed done && --verbose "$@"
+&& done cd && --verbose --verbose awk echo echo readonly export
+	echo export /usr/bin export sed readonly /usr/bin export echo
+| echo | 'quoted text' cd printf && --verbose local local done x=1
+	/usr/bin /usr/bin && echo --verbose /usr/bin | | -eu printf x=1 awk then "$1"
+	readonly --verbose test -eu done grep readonly "$@" cd && test
+local --verbose readonly x=1 ${HOME} cd local
+	x=1 then --verbose test done 'quoted text'
+		${HOME} --verbose sed x=1 test echo
+		printf $(pwd) && awk printf x=1 && --verbose sed x=1 $(pwd) echo readonly
+		"$1" readonly awk test test test 'quoted text' done local
+	/usr/bin echo ${HOME} grep awk grep then export echo cd sed printf echo printf readonly
+--verbose done printf awk "$1" $(pwd) x=1 'quoted text' readonly | readonly
+		&& export x=1 then | local readonly
+local -eu /usr/bin /usr/bin sed local sed awk awk grep $(pwd) echo
+	grep cd x=1 --verbose echo export grep "$@" test
+	grep x=1 export -eu -eu export test readonly && local
+		-eu /usr/bin printf echo local 2>/dev/null echo export
+	&& 2>/dev/null done then export 'quoted text' cd | sed readonly
+echo printf local x=1 grep "$@" test && $(pwd) | printf then
+		/usr/bin awk printf done "$1" -eu "$@" | echo 2>/dev/null
+	local && done cd | readonly local --verbose "$@" ${HOME} --verbose then ${HOME}
+"$1" | test $(pwd) $(pwd) echo echo printf
+| 2>/dev/null cd done 'quoted text'
+		-eu sed printf done && && -eu "$@" test done -eu ${HOME}
+	| && ${HOME} 'quoted text'
+		&& 'quoted text' local $(pwd) | "$@" $(pwd) x=1 printf | x=1 -eu "$1" $(pwd)
+		printf cd "$@" grep "$@" local export echo test printf grep ${HOME} $(pwd) 'quoted text'
+	'quoted text' local sed grep $(pwd) printf -eu then echo && done | export /usr/bin
+	local -eu "$@" 'quoted text' export then
+cd then done | -eu "$@" -eu ${HOME} "$@" cd export readonly ${HOME} "$@"
+	readonly && test 'quoted text'
+-eu sed $(pwd) $(pwd) 'quoted text' done sed then cd awk
+&& 'quoted text' done | sed
+		-eu && readonly "$@"
+		"$1" 2>/dev/null awk test test $(pwd) cd cd echo
+	2>/dev/null /usr/bin
+		"$@" printf 2>/dev/null sed readonly
+		-eu --verbose export -eu "$1" "$@"
+	local x=1 then cd local then /usr/bin
+		local | cd --verbose cd 2>/dev/null && readonly | -eu --verbose
+		/usr/bin | then sed x=1 echo cd cd echo echo then test "$@" then ${HOME} done
+	done "$@" && printf awk grep x=1 sed readonly readonly local | "$1" awk readonly
+		${HOME} 2>/dev/null -eu awk local then /usr/bin x=1 sed export "$1" && done
+		cd -eu --verbose "$1" "$@" "$1" "$1" --verbose
+		then $(pwd) -eu echo readonly sed echo then readonly
+test sed x=1 ${HOME} -eu test readonly 'quoted text' awk 2>/dev/null local
+	cd "$1" x=1 && test export 2>/dev/null
+export x=1 echo -eu test cd && 'quoted text'
+awk printf local printf && 'quoted text' awk readonly awk $(pwd)
+		"$@" 2>/dev/null local test ${HOME} --verbose
+	awk local "$1" then printf export
+	${HOME} sed test "$1" /usr/bin "$@" "$1" | ${HOME} "$1" 2>/dev/null
+		sed $(pwd) 'quoted text' --verbose sed 'quoted text' 2>/dev/null -eu local
+		'quoted text' | /usr/bin && 'quoted text' then grep /usr/bin
+sed 2>/dev/null sed done then $(pwd) && x=1 sed grep && local && ${HOME} done
+		'quoted text' "$@" "$1" echo --verbose /usr/bin
+done done readonly /usr/bin 'quoted text'
+		--verbose --verbose cd test printf $(pwd)
+	printf 2>/dev/null "$1" $(pwd) local "$@" then $(pwd) readonly -eu -eu ${HOME} export
+| "$1" printf 'quoted text' /usr/bin export | -eu awk 'quoted text' sed
+		'quoted text' local "$@" export -eu readonly grep -eu awk "$@" sed
+		x=1 local $(pwd) then $(pwd) cd && /usr/bin cd x=1 $(pwd)
+	-eu done local export 2>/dev/null "$@"
+		cd cd echo 2>/dev/null export | x=1 /usr/bin
+		$(pwd) -eu | 2>/dev/null grep | awk ${HOME} ${HOME} ${HOME} x=1 $(pwd)
+local 2>/dev/null cd 'quoted text' awk awk printf test "$@" --verbose then test
+readonly 'quoted text' then
+export local -eu readonly cd test export && $(pwd) readonly
+local printf /usr/bin 2>/dev/null sed
+		sed printf test sed ${HOME} $(pwd) --verbose cd --verbose cd export ${HOME} sed
+	${HOME} awk | export test grep export 2>/dev/null sed readonly then
+cd echo ${HOME} | grep echo export grep
+-eu | local done export | --verbose awk export sed | "$1" done $(pwd) readonly
+$(pwd) $(pwd) x=1 x=1 test grep | test 'quoted text'
+		readonly | cd then && && "$@" awk
+test | x=1 "$1" --verbose --verbose sed local cd awk "$1" local
+	readonly grep readonly then
+		readonly test echo -eu ${HOME} /usr/bin grep grep test "$1" sed 'quoted text'
+	then "$1" readonly x=1 'quoted text' "$@" && printf && "$@" test export
+	${HOME} $(pwd) local "$@" ${HOME} --verbose test | grep && local
+-eu && 'quoted text' -eu local x=1 -eu | printf
+		readonly | -eu test test export grep done "$1" x=1 ${HOME} done "$@"
+		grep export -eu done -eu 2>/dev/null echo export export $(pwd) done
+${HOME} ${HOME} awk export grep echo | awk &&
+	'quoted text' "$1" done awk | sed 'quoted text' test "$1" /usr/bin -eu | cd sed
+	test awk /usr/bin /usr/bin --verbose --verbose -eu && printf local 2>/dev/null
+| 2>/dev/null 'quoted text' 2>/dev/null export
+	sed "$@" readonly done sed --verbose x=1
+${HOME} "$@" -eu --verbose
+		'quoted text' echo 'quoted text' /usr/bin local $(pwd) --verbose
+		awk "$@" --verbose /usr/bin "$@" done
+		done done readonly echo grep -eu local readonly
+		sed -eu "$1" awk then "$@" -eu && $(pwd) x=1 --verbose
+		--verbose done 2>/dev/null done grep /usr/bin test cd then && $(pwd)
+"$@" "$@" -eu printf done test /usr/bin
+	| -eu ${HOME} printf ${HOME} 'quoted text' | cd 'quoted text' "$@" done echo
+		done $(pwd) echo local then readonly 2>/dev/null ${HOME} "$@" "$1" export
+'quoted text' readonly
+		done cd "$1" cd | /usr/bin done awk --verbose then 'quoted text'
+		&& cd "$@" done cd --verbose --verbose "$1" printf $(pwd) 2>/dev/null then && done
+	test | | ${HOME} grep sed awk "$@" echo "$@" $(pwd) -eu x=1
+		awk x=1 2>/dev/null done /usr/bin 'quoted text'
+	-eu /usr/bin export ${HOME} cd test "$@" 'quoted text' -eu grep
+--verbose local grep && then echo readonly $(pwd) done local export
+	readonly awk then x=1 then -eu /usr/bin echo --verbose "$@" awk "$@" local
+	2>/dev/null sed x=1 | --verbose
+done --verbose printf /usr/bin /usr/bin sed sed
+		then | test && then grep
+test then x=1 echo /usr/bin /usr/bin -eu local local grep echo
+grep local printf local echo "$@" echo --verbose export --verbose ${HOME} $(pwd)
+	| x=1 ${HOME} local echo $(pwd) -eu local | local "$1" "$1" sed grep |
+/usr/bin test 2>/dev/null "$@" $(pwd) printf ${HOME}
+		-eu && then $(pwd) /usr/bin && readonly
+	local 2>/dev/null local printf test done
+readonly $(pwd) grep | printf export | && 'quoted text'
+		2>/dev/null $(pwd) printf $(pwd) printf x=1
+		"$1" -eu "$@" "$1" then ${HOME} local printf
+test printf echo export ${HOME} done printf 'quoted text'
+	| /usr/bin export | export then local 2>/dev/null
+| sed ${HOME} local -eu "$@" printf sed ${HOME} | local done local
+/usr/bin && awk test 2>/dev/null sed --verbose 'quoted text' 'quoted text' &&
+		/usr/bin $(pwd) ${HOME} readonly ${HOME} awk test ${HOME} grep ${HOME}
+2>/dev/null local 'quoted text' x=1 sed printf then local
+| sed printf then done sed readonly readonly | grep cd done done export $(pwd)
+&& test /usr/bin then echo readonly x=1 "$@" then && | x=1 grep
+x=1 "$@" 2>/dev/null then "$@" x=1 && 2>/dev/null
+		export echo "$@" 'quoted text' 2>/dev/null --verbose
+	2>/dev/null sed | awk $(pwd) --verbose
+${HOME} "$@" 2>/dev/null /usr/bin | x=1 done local 2>/dev/null "$@" export
+		test | 'quoted text' done x=1 awk awk test | done 2>/dev/null
+		echo export x=1 $(pwd) awk "$1" grep done $(pwd) "$1"
+	| readonly "$@" export -eu /usr/bin
+		"$@" ${HOME} 2>/dev/null x=1
+		readonly ${HOME} then grep readonly local test export done sed printf test
+printf local $(pwd) test export test 'quoted text' "$@" "$@" "$@" -eu
+cd $(pwd) test && export echo local "$1" done sed && done then
+	$(pwd) | test ${HOME} grep then 'quoted text' /usr/bin cd ${HOME} sed grep readonly
+	&& printf awk done printf -eu awk | /usr/bin 2>/dev/null $(pwd) awk done &&
+		sed x=1 ${HOME} | $(pwd) cd then | $(pwd) local
+		-eu awk local readonly --verbose sed --verbose
+	awk --verbose awk sed awk 'quoted text' ${HOME}
+	&& then then -eu printf local printf $(pwd) --verbose /usr/bin
+		done sed x=1 awk "$1" /usr/bin echo done "$@" echo &&
+awk local cd done grep test readonly /usr/bin export then x=1 cd
+	test done && -eu export x=1 $(pwd) ${HOME} test
+		-eu local | export "$1" && readonly sed x=1 /usr/bin 2>/dev/null
+test $(pwd) "$@" done local readonly --verbose x=1 sed readonly
+		done sed awk echo printf grep /usr/bin local
+	'quoted text' awk /usr/bin then ${HOME} | ${HOME}
+sed readonly sed "$1" --verbose local 'quoted text'
+	--verbose awk done && then sed 2>/dev/null
+readonly readonly ${HOME} awk sed grep export $(pwd) done then 2>/dev/null
+	printf $(pwd) local /usr/bin 'quoted text' awk test -eu export readonly "$1"
+		test $(pwd) x=1 printf awk test echo -eu echo local
+		x=1 'quoted text' 2>/dev/null sed then $(pwd) x=1 sed cd echo "$@" awk test
+	done export sed -eu readonly done ${HOME} -eu
+		${HOME} | 2>/dev/null echo "$1" --verbose test "$@" -eu "$@" sed sed x=1
+done printf | -eu | /usr/bin | readonly 2>/dev/null |
+		test test readonly sed --verbose echo $(pwd) -eu test readonly /usr/bin
+sed "$@" x=1 -eu local --verbose "$@" export local printf done
+		"$@" && awk "$1" printf --verbose done
+		2>/dev/null cd -eu local -eu --verbose then printf readonly then x=1 cd 2>/dev/null
+	--verbose printf awk && --verbose | export ${HOME} && --verbose
+local export sed | x=1 --verbose "$@"
+		awk printf export grep awk readonly /usr/bin echo
+	local $(pwd) | --verbose readonly x=1 sed printf
+		"$1" readonly -eu sed -eu done $(pwd)
+echo local sed /usr/bin awk | awk --verbose && "$@" -eu
+	test | grep /usr/bin cd "$1" /usr/bin awk sed
+		echo x=1 x=1 -eu export local /usr/bin sed done
+	x=1 test then printf cd -eu export 'quoted text' local echo 2>/dev/null
+printf then done "$1" --verbose cd | "$1" done && cd /usr/bin
+		grep "$1" done grep /usr/bin --verbose "$@"
+then then printf cd then done echo
+	readonly ${HOME} 2>/dev/null 2>/dev/null echo 'quoted text'
+sed then --verbose done then x=1 then sed done sed
+		grep 'quoted text' awk printf "$1" 'quoted text' "$1" printf grep
+	&& readonly local "$1" export && "$1"
+export sed done "$@" readonly
+2>/dev/null echo then then "$@" awk
+		'quoted text' $(pwd) --verbose 2>/dev/null ${HOME} "$@"
+&& x=1 awk echo 2>/dev/null grep --verbose
+		/usr/bin 'quoted text' printf "$@" export
+		test cd "$1" done echo ${HOME}
+cd echo $(pwd) export 2>/dev/null test 'quoted text' echo "$@" /usr/bin grep x=1
+		done sed readonly echo ${HOME} sed then sed --verbose 2>/dev/null
+	cd readonly then && printf 'quoted text' awk export /usr/bin
+${HOME} -eu 2>/dev/null local && done && --verbose
+	export printf awk && sed $(pwd) cd echo x=1 2>/dev/null export && --verbose
+| printf then cd -eu awk /usr/bin && done -eu awk readonly
+| 'quoted text' && 2>/dev/null cd readonly then "$1" ${HOME}
+2>/dev/null done awk readonly "$@" local "$1" 'quoted text'
+		done sed export 'quoted text' ${HOME} export
+		| sed awk readonly export
+| sed local awk -eu -eu ${HOME} --verbose 'quoted text' test done then
+		test 2>/dev/null /usr/bin echo -eu echo sed printf
+	done --verbose 'quoted text' local && x=1 cd grep --verbose --verbose echo
+	sed "$1" then readonly awk && x=1 "$@" $(pwd)
+printf test "$1" then then awk x=1 readonly && test "$1" readonly
+	$(pwd) && echo grep cd sed echo x=1 ${HOME} awk "$1" "$1" sed readonly --verbose
+sed ${HOME} $(pwd) 'quoted text' 'quoted text'
+2>/dev/null $(pwd) | done sed export export /usr/bin
+	"$@" -eu readonly then local /usr/bin --verbose && local
+		grep x=1 ${HOME} sed grep export then 'quoted text' x=1
+	export export | "$1" cd grep sed then then grep done x=1
+		/usr/bin export grep x=1 done | awk "$@" 'quoted text'
+		2>/dev/null "$1" /usr/bin
+		test grep export awk readonly && ${HOME} x=1 awk export test
+	${HOME} "$1" echo awk export $(pwd) test 'quoted text' -eu echo test export
+sed --verbose done && sed "$1" --verbose && && test
+		printf "$@" cd then printf printf sed x=1 && printf "$@"
+	test ${HOME} local |
+		printf grep echo test --verbose ${HOME} ${HOME} grep printf
+		--verbose local printf export local done "$@" && cd $(pwd) "$@" echo cd | readonly
+		&& | 'quoted text' cd grep grep -eu then printf then "$1" awk &&
+	2>/dev/null then $(pwd) "$1" --verbose local test &&
+		| awk awk awk grep done
+	export awk local && sed then
+		then ${HOME} && test local printf printf grep $(pwd) grep printf $(pwd)
+	printf && -eu -eu $(pwd) grep 2>/dev/null awk /usr/bin echo grep export |
+	${HOME} $(pwd) ${HOME} --verbose local done readonly then /usr/bin
+&& cd echo readonly done 'quoted text'
+	$(pwd) -eu grep done then awk grep $(pwd) then cd 'quoted text'
+	$(pwd) grep && sed "$@" --verbose "$@" local echo echo sed cd ${HOME} $(pwd)
+		local 'quoted text' done "$@" printf done
+--verbose cd $(pwd) "$1" then && readonly -eu && done done local cd readonly
+	| $(pwd) ${HOME} /usr/bin /usr/bin "$1" x=1
+	&& local x=1 test /usr/bin -eu cd echo
+		grep sed echo ${HOME} -eu /usr/bin ${HOME} readonly -eu echo
+test echo ${HOME} && then "$1" -eu grep x=1 test ${HOME}
+	--verbose --verbose -eu local done 'quoted text' cd test -eu
+x=1 ${HOME} test x=1 done | /usr/bin "$1" "$@" readonly done export x=1 x=1
+	echo ${HOME} ${HOME} "$1" 'quoted text' then awk --verbose printf done
+		test printf grep /usr/bin | -eu "$@" printf test
+	2>/dev/null local | /usr/bin "$@" echo /usr/bin cd then sed export local then
+		done grep grep 'quoted text' x=1 grep test 'quoted text' 'quoted text' done
+	export awk /usr/bin done -eu 'quoted text' "$@" printf done
+readonly ${HOME} cd && export ${HOME} readonly export && --verbose then
+	sed local /usr/bin export && 'quoted text'
+"$1" grep sed local local then then && export cd $(pwd) then sed ${HOME} 'quoted text'
+then sed grep cd local "$@"
+	| 'quoted text' test local -eu "$1" -eu echo "$1" done test awk
+	2>/dev/null then echo local cd done /usr/bin -eu
+		"$1" local /usr/bin readonly printf cd ${HOME} x=1
+		2>/dev/null "$@" readonly cd &&
+then ${HOME} local 'quoted text' && printf echo then export export
+		echo printf printf "$1" $(pwd) awk echo /usr/bin -eu -eu then test x=1 echo grep
+printf $(pwd) | x=1 test "$1" /usr/bin
+readonly "$@" sed local cd -eu x=1 export $(pwd) "$@" test awk
+		done readonly /usr/bin test
+export readonly test sed
+		'quoted text' cd awk --verbose
+${HOME} awk $(pwd) && x=1 "$1" test done x=1 sed local $(pwd) awk x=1 grep export
+	/usr/bin cd 'quoted text' x=1 local
+		printf x=1 && "$@" 2>/dev/null --verbose done sed
+		readonly 'quoted text' x=1 "$1" ${HOME} | test && echo then grep readonly
+--verbose sed "$@" grep && --verbose test $(pwd) $(pwd) sed /usr/bin 'quoted text'
+		'quoted text' /usr/bin sed export test printf local test 2>/dev/null
+echo 'quoted text' printf awk printf
+		test --verbose && x=1 printf export | then && /usr/bin cd ${HOME}
+	"$1" /usr/bin echo sed 'quoted text'
+$(pwd) /usr/bin x=1 | 'quoted text' grep export "$@" -eu local "$@" ${HOME} cd
+		2>/dev/null "$1" /usr/bin sed && readonly "$1" done /usr/bin x=1 then "$@" done
+"$1" printf export printf 2>/dev/null sed "$1" local cd $(pwd) sed printf "$@"
+/usr/bin sed | grep awk cd && "$@" "$1" test 2>/dev/null 'quoted text' cd /usr/bin
+		awk printf 'quoted text' local --verbose then test x=1 done awk test export
+		&& readonly cd && readonly "$@"
+	awk printf printf done awk /usr/bin
+	--verbose ${HOME} x=1 ${HOME} $(pwd) then printf then x=1 && ${HOME}
+	/usr/bin x=1 && $(pwd) && then | sed -eu awk /usr/bin readonly
+x=1 | grep x=1 -eu 2>/dev/null 'quoted text' local sed then ${HOME} x=1
+	"$@" echo "$@" $(pwd) awk
+	${HOME} grep /usr/bin awk /usr/bin export done printf
+x=1 "$@" then 2>/dev/null echo done export && x=1 "$1" x=1 /usr/bin -eu local
+		awk readonly done printf done /usr/bin sed -eu && sed
+cd awk grep $(pwd) && done $(pwd) "$1" ${HOME} "$@"
+	local awk | awk echo && x=1 cd local export cd "$1" export --verbose cd
+		'quoted text' $(pwd) 2>/dev/null echo grep export grep x=1
+	test "$1" "$@" --verbose ${HOME} echo "$1" printf sed then awk local
+test "$@" 2>/dev/null cd export x=1 'quoted text' done sed /usr/bin ${HOME} test
+	-eu x=1 "$1" | test export ${HOME} "$@" | && && printf grep 'quoted text' -eu test
+local sed /usr/bin -eu cd echo $(pwd)
+		done -eu cd export grep $(pwd) 2>/dev/null then
+		x=1 "$1" then && cd ${HOME}
+		'quoted text' --verbose
+printf /usr/bin x=1 test "$1" local awk readonly local x=1
+'quoted text' awk echo -eu ${HOME}
+test ${HOME} test test x=1 ${HOME} ${HOME} x=1 cd printf
+grep | 'quoted text' grep | "$1" -eu --verbose
+awk 2>/dev/null grep ${HOME} printf
+export echo then x=1 ${HOME} --verbose ${HOME} x=1 export -eu x=1
+-eu -eu $(pwd) test grep 2>/dev/null awk done cd x=1 | then --verbose ${HOME} ${HOME}
+&& test sed readonly readonly ${HOME}
+		${HOME} --verbose x=1 then "$@" 'quoted text' | -eu then test
+grep done x=1 then 'quoted text' grep /usr/bin grep grep grep ${HOME} then
+	$(pwd) readonly sed | echo done test && "$1" --verbose echo $(pwd) ${HOME}
+	--verbose sed grep x=1 echo printf ${HOME}
+		--verbose readonly 'quoted text' cd 2>/dev/null sed then cd
+		'quoted text' ${HOME} export done awk
+		export grep 2>/dev/null 'quoted text' 2>/dev/null
+	${HOME} sed grep then | readonly local cd grep
+		-eu 2>/dev/null ${HOME} "$@" | && export grep -eu local export ${HOME}
+		| 'quoted text' local "$@" "$1" 'quoted text' "$@"
+readonly done --verbose grep $(pwd) sed "$@" $(pwd) test
+	"$@" cd 2>/dev/null echo --verbose $(pwd) x=1
+		'quoted text' printf echo -eu /usr/bin $(pwd) "$@" "$1" x=1 'quoted text'
+		${HOME} cd done grep then --verbose x=1 "$1" local grep
+		$(pwd) export | awk x=1
+	"$@" ${HOME} done then ${HOME} "$@" $(pwd) "$@" && cd cd "$1" /usr/bin
+&& cd grep 'quoted text' $(pwd) --verbose sed grep
+		sed 2>/dev/null local | $(pwd) $(pwd) $(pwd) readonly awk $(pwd) grep
+	-eu printf then "$@" && -eu x=1 test echo /usr/bin --verbose grep ${HOME}
+		sed cd cd $(pwd) --verbose $(pwd) ${HOME} grep /usr/bin 'quoted text'
+	grep | grep "$@" 'quoted text' printf export
+readonly ${HOME} printf cd -eu "$@" 'quoted text'
+awk local "$@" awk 2>/dev/null -eu | export sed sed | printf --verbose done |
+cd then -eu local echo echo sed "$@" echo /usr/bin local 2>/dev/null local
+local export export "$1" then done /usr/bin --verbose printf test ${HOME}
+export readonly x=1 sed
+	awk echo local grep then sed printf readonly done $(pwd) $(pwd) sed
+		-eu then /usr/bin $(pwd) "$@"
+	"$@" sed && --verbose 2>/dev/null local awk -eu 2>/dev/null
+cd awk echo export local readonly -eu x=1 readonly 'quoted text' echo cd && --verbose
+	&& x=1 then export awk sed
+&& ${HOME} grep "$1" done awk echo ${HOME} $(pwd)
+	done export "$1" awk --verbose --verbose 2>/dev/null x=1 awk x=1 "$1" printf
+	2>/dev/null -eu x=1 -eu cd test printf done -eu export awk grep
+		test echo ${HOME} cd sed done local -eu
+	/usr/bin "$@" | /usr/bin x=1 awk awk 'quoted text' "$1"
+echo 2>/dev/null -eu echo -eu awk readonly test $(pwd) "$@"
+test readonly done 'quoted text' export grep "$@" readonly x=1 'quoted text' 'quoted text'
+	test 'quoted text' readonly | --verbose ${HOME} "$1" | --verbose | 'quoted text'
+	test /usr/bin ${HOME} export
+	awk x=1 --verbose printf awk printf awk cd x=1 echo ${HOME}
+	2>/dev/null printf then grep test && 'quoted text' | 'quoted text'
+sed readonly | -eu done sed grep
+	export 'quoted text' readonly x=1 echo sed test --verbose grep 2>/dev/null 2>/dev/null
+		"$@" test $(pwd) awk readonly /usr/bin export printf x=1 export local 'quoted text'
+	awk done x=1 printf --verbose && local grep
+done | /usr/bin x=1 printf
+		export readonly cd awk --verbose done cd export
+done x=1 cd printf local $(pwd) x=1 sed x=1 -eu $(pwd) export 2>/dev/null echo
+${HOME} x=1 -eu then test 'quoted text' sed
+	--verbose "$@" awk export readonly done $(pwd) cd ${HOME} cd echo test then
+		printf test grep && && done sed 'quoted text' local x=1 x=1 awk printf
+		then -eu cd /usr/bin local awk echo export echo /usr/bin && awk local -eu
+		done "$@" && /usr/bin readonly printf test then sed | sed test then
+| awk readonly done export cd then ${HOME} /usr/bin
+	echo -eu grep local 2>/dev/null "$1" awk 'quoted text'
+echo printf 'quoted text' 2>/dev/null readonly x=1 echo grep
+	echo test "$@" then 2>/dev/null $(pwd) done export 2>/dev/null done
+		"$1" | grep readonly /usr/bin
+2>/dev/null | && echo "$@" export ${HOME} local "$@" | "$1"
+"$1" -eu cd 2>/dev/null local /usr/bin
+		2>/dev/null --verbose printf && ${HOME} /usr/bin
+		sed ${HOME} "$1" | "$1" awk local sed ${HOME} done
+${HOME} export 'quoted text' -eu -eu -eu "$@" echo -eu --verbose done -eu readonly
+	"$@" "$@" sed sed "$1" "$1" --verbose printf
+		then "$@" $(pwd) then 2>/dev/null x=1 sed x=1 -eu export
+		awk 'quoted text' export $(pwd) "$1" "$1" | --verbose
+	x=1 grep local readonly 2>/dev/null "$@" ${HOME} sed --verbose | readonly
+	awk /usr/bin "$1" --verbose ${HOME} local sed sed test $(pwd) done echo export
+	readonly local ${HOME} | export export ${HOME} readonly awk sed && ${HOME} test
+		test && printf echo --verbose /usr/bin 'quoted text'
+		sed export readonly cd local printf local | -eu $(pwd) "$1" 'quoted text'
+	'quoted text' "$1" sed
+		/usr/bin export 'quoted text' "$1" | && then local printf echo cd
+		"$@" "$1" x=1 && printf ${HOME} echo "$@" test
+sed cd echo export $(pwd) local ${HOME} --verbose local ${HOME} "$1"
+'quoted text' "$1" x=1 printf /usr/bin $(pwd)
+		readonly test | readonly then cd 'quoted text' sed $(pwd)
+		"$@" export && && test && && echo && -eu export $(pwd) readonly local --verbose
+		awk ${HOME} -eu echo $(pwd) | grep && echo ${HOME} 'quoted text' printf
+		printf sed -eu readonly readonly cd $(pwd) ${HOME} "$1" local done ${HOME}
+		${HOME} grep -eu x=1 -eu --verbose
+		then export awk awk test -eu then done grep test export local | | echo 2>/dev/null
+		sed && export $(pwd) && echo "$1" --verbose x=1 && local then
+		${HOME} done x=1 then echo
+local | x=1 /usr/bin printf /usr/bin && echo
+local -eu done && then -eu local "$1" readonly sed
+	awk echo export ${HOME} --verbose ${HOME} && /usr/bin
+	done test --verbose $(pwd) | echo echo grep test && echo sed local
+		grep printf echo printf readonly --verbose export /usr/bin cd && 'quoted text'
+		sed export "$1" sed local | $(pwd) "$1"
+		echo --verbose x=1 /usr/bin /usr/bin sed grep /usr/bin &&
+'quoted text' sed --verbose x=1 echo grep readonly
+readonly done "$1" "$1" local 'quoted text'
+		test cd 'quoted text' "$@" export /usr/bin export
+2>/dev/null --verbose /usr/bin "$@" x=1 -eu ${HOME} echo echo awk then
+	local | echo then printf
+	readonly readonly 2>/dev/null $(pwd) x=1 test printf done "$@" then export
+		printf awk test /usr/bin printf local grep done x=1 2>/dev/null --verbose
+	awk sed done 'quoted text'
+		&& sed "$1" sed echo awk 'quoted text' --verbose x=1 && export "$@" --verbose
+${HOME} local ${HOME} test echo export $(pwd) && ${HOME} 'quoted text'
+		| 'quoted text' cd awk /usr/bin && 'quoted text'
+grep /usr/bin awk done "$1" awk $(pwd)
+2>/dev/null $(pwd) test
+		"$@" /usr/bin grep readonly -eu 'quoted text' -eu --verbose
+	&& done 'quoted text' && readonly echo done --verbose && grep readonly
+		$(pwd) ${HOME} | awk done cd awk -eu awk printf &&
+	'quoted text' ${HOME} cd /usr/bin && local readonly
+		local -eu readonly printf $(pwd) 'quoted text' awk echo then "$@"
+		awk --verbose grep test awk /usr/bin x=1 --verbose then test x=1
+then -eu echo sed awk /usr/bin ${HOME} sed grep printf 2>/dev/null export /usr/bin
+-eu "$1" readonly test && $(pwd) then /usr/bin sed echo done
+${HOME} readonly sed done -eu 2>/dev/null readonly "$@"
+done then 'quoted text' readonly && test -eu 2>/dev/null
+		'quoted text' | -eu printf "$@" readonly
+${HOME} --verbose "$1" ${HOME} -eu local
+		x=1 --verbose ${HOME} test --verbose
+grep awk ${HOME} 2>/dev/null cd done export x=1 printf ${HOME}
+	grep "$@" 'quoted text' "$@" "$@" ${HOME} sed /usr/bin
+		awk "$1" then "$1" ${HOME} sed "$1" "$@"
+		readonly readonly export then then echo cd $(pwd) echo local local then
+		grep x=1 then awk "$1" printf --verbose export
+	awk sed grep | x=1 cd /usr/bin
+	echo | && printf awk then local | grep "$1" printf test grep cd 2>/dev/null
+		grep && sed sed ${HOME}
+&& x=1 awk -eu printf cd -eu done | awk sed $(pwd) "$1" --verbose x=1 printf
+		awk cd "$1" ${HOME} --verbose grep
+		x=1 sed 'quoted text' /usr/bin ${HOME}
+printf done then --verbose sed && awk grep then grep then cd "$1" sed awk grep "$1"
+		x=1 -eu echo printf awk test x=1 readonly
+done 2>/dev/null test && | echo
+test test $(pwd) export | 'quoted text' cd printf
+x=1 grep -eu "$1" export "$1" done local
+		--verbose test x=1 "$@" local sed | sed | &&
+	readonly 2>/dev/null then done grep x=1
+		"$@" grep export export readonly test sed grep x=1 /usr/bin
+	sed awk then x=1 then echo echo 'quoted text' "$@" grep export readonly
+'quoted text' readonly export $(pwd) awk
+		sed printf awk | /usr/bin -eu done ${HOME} "$1" printf
+test then printf 2>/dev/null
+		test /usr/bin 2>/dev/null printf
+2>/dev/null $(pwd) readonly done 2>/dev/null ${HOME} grep then echo
+		awk grep | done --verbose x=1 export grep "$@"
+-eu $(pwd) export printf "$@" | && /usr/bin $(pwd)
+local && grep /usr/bin
+"$@" cd test local export sed local export
+	--verbose then printf echo x=1 --verbose
+		readonly sed $(pwd) -eu readonly ${HOME}
+		2>/dev/null sed | grep -eu x=1 echo awk
+		| test echo sed | sed cd printf -eu awk printf readonly
+		| x=1 cd --verbose ${HOME} test 'quoted text'
+cd export x=1 -eu | sed grep cd done | then 'quoted text' 'quoted text'
+	-eu printf /usr/bin "$1" done readonly
+	export cd export echo test "$1"
+	cd cd | "$1" "$1" test
+		test local x=1 echo && export ${HOME}
+		--verbose 'quoted text' local echo "$@" "$1" $(pwd) &&
+	--verbose $(pwd) "$@" --verbose && done cd readonly
+done local /usr/bin cd grep 'quoted text' printf local | ${HOME}
+	--verbose echo then && 2>/dev/null x=1 grep cd "$1" local "$1" grep export
+test && 'quoted text' "$1" printf echo then export
+		echo readonly local && readonly local -eu 'quoted text' test /usr/bin --verbose
+		echo grep awk sed | --verbose -eu --verbose | then
+		echo $(pwd) $(pwd) then sed
+x=1 test done cd "$@" 'quoted text'
+		cd grep test printf echo test readonly then printf --verbose
+		| -eu cd | 2>/dev/null awk x=1 /usr/bin
+export then echo "$1" "$@" printf ${HOME}
+test grep x=1 /usr/bin $(pwd) | done "$@" export export grep printf 'quoted text'
+		&& test 'quoted text' sed echo grep cd echo done printf local "$@" readonly
+cd done -eu ${HOME} --verbose grep sed | x=1 awk readonly -eu
+		&& sed /usr/bin /usr/bin printf $(pwd)
+2>/dev/null 'quoted text' readonly "$1" $(pwd) ${HOME} printf "$1"
+	x=1 && ${HOME} x=1 -eu -eu $(pwd) "$1" /usr/bin /usr/bin local --verbose
+sed echo "$@" done && "$1" readonly "$@" 2>/dev/null grep awk 'quoted text'
+export then | grep grep echo then $(pwd)
+	then export then x=1 grep then ${HOME} done sed "$1" /usr/bin
+done then | 'quoted text' 2>/dev/null "$@"
+		x=1 "$1" && 'quoted text' && then export grep grep done
+		then $(pwd) printf /usr/bin echo printf /usr/bin $(pwd) echo
+	then cd "$1" --verbose 2>/dev/null
+	printf export -eu printf 'quoted text' /usr/bin grep sed awk test printf | local
+		"$@" echo | $(pwd) "$@" local test 2>/dev/null "$1" && && --verbose export local
+	&& then | sed 'quoted text' | --verbose then 'quoted text' x=1 && local
+		grep | "$1" --verbose export
+${HOME} "$1" -eu && -eu x=1 then done && printf cd $(pwd) 'quoted text'
+	x=1 /usr/bin -eu "$1" /usr/bin cd && echo -eu sed export 'quoted text' local
+	export then --verbose 'quoted text' test 2>/dev/null then 'quoted text'
+-eu --verbose ${HOME} "$@" "$1" $(pwd) $(pwd) export echo 'quoted text'
+	echo awk then ${HOME} awk awk | printf echo local && ${HOME} /usr/bin
+awk grep printf then sed $(pwd) --verbose $(pwd) done then printf
+&& grep | printf printf /usr/bin grep -eu "$1"
+export then | cd "$@" local
+	--verbose echo "$@" x=1 sed readonly cd -eu awk cd sed -eu local test "$1" --verbose
+		2>/dev/null awk 'quoted text' &&
+		echo ${HOME} "$1" test grep export then grep sed ${HOME} 2>/dev/null /usr/bin
+		"$@" 'quoted text' $(pwd) --verbose /usr/bin local
+		awk awk cd 'quoted text' sed | readonly "$@" local
+readonly then ${HOME} local done x=1 && | -eu sed
+	'quoted text' readonly grep $(pwd) --verbose echo test 2>/dev/null
+'quoted text' 'quoted text' then test export "$1" &&
+"$@" | awk then 2>/dev/null done
+		--verbose export -eu $(pwd) cd /usr/bin /usr/bin $(pwd) && && "$@" "$1" | then
+		-eu echo then "$@" x=1 sed
+"$@" 'quoted text' $(pwd) local sed "$@" x=1 grep
+	-eu done -eu --verbose /usr/bin then x=1 echo test printf local /usr/bin
+test sed sed --verbose echo done then readonly then ${HOME} && 2>/dev/null grep
+done test $(pwd) && 2>/dev/null
+		2>/dev/null echo sed done printf done readonly
+sed 'quoted text' grep x=1 cd awk awk printf
+	"$1" | 2>/dev/null test test "$1" "$1" /usr/bin
+export echo --verbose x=1 done done x=1 $(pwd) echo -eu test |
+	cd $(pwd) printf --verbose grep local $(pwd) export
+		${HOME} test test 'quoted text' ${HOME} then echo --verbose done 2>/dev/null
+		-eu 2>/dev/null cd cd ${HOME} ${HOME} /usr/bin awk "$@"
+		x=1 2>/dev/null readonly
+		grep ${HOME} $(pwd) printf test | cd grep
+		"$1" $(pwd) sed ${HOME} cd x=1 cd && "$@"
+		"$1" | sed echo done export ${HOME} x=1 "$@" 'quoted text' awk cd -eu
+| readonly echo awk 'quoted text' && $(pwd) grep printf printf sed done 2>/dev/null
+	'quoted text' test test
+	"$1" 'quoted text' sed x=1 ${HOME} x=1 done local ${HOME} && --verbose
+	then -eu test -eu 'quoted text' &&
+	echo echo x=1 2>/dev/null -eu --verbose export "$@" -eu
+	/usr/bin $(pwd) -eu 2>/dev/null "$1" /usr/bin
+		"$1" echo x=1 x=1 --verbose sed && export ${HOME} export grep grep
+	/usr/bin then cd $(pwd)
+		local test grep "$1" $(pwd) awk test export
+	"$1" printf test printf /usr/bin
+		export readonly $(pwd) 'quoted text'
+		echo export grep "$1" then 'quoted text' 2>/dev/null
+	'quoted text' x=1 && /usr/bin --verbose --verbose --verbose x=1 -eu export &&
+	"$@" export done readonly then -eu | --verbose
+	--verbose printf "$1" --verbose --verbose 'quoted text'
+		"$1" -eu "$1" | readonly $(pwd) sed done export then 'quoted text'
+"$@" && echo cd /usr/bin echo
+	printf local && -eu x=1 grep "$1" readonly done ${HOME} /usr/bin &&
+&& local && awk readonly awk 'quoted text' readonly done
+"$1" export ${HOME} | && cd then local awk grep 'quoted text' grep $(pwd)
+	sed && "$@" | export 'quoted text'
+	local echo then ${HOME} && $(pwd) local printf --verbose sed 2>/dev/null x=1
+		"$1" done export export readonly
+	--verbose "$@" awk --verbose then export -eu && test 'quoted text'
+	&& -eu 2>/dev/null sed echo readonly && "$@" --verbose printf ${HOME} done
+/usr/bin sed local sed && printf && -eu
+awk local x=1 "$1" printf cd local --verbose /usr/bin -eu --verbose | x=1
+grep echo export "$1" local awk sed grep
+	test 'quoted text' 'quoted text' then 'quoted text'
+	grep 2>/dev/null then
+	awk grep && /usr/bin && --verbose -eu done sed sed test sed $(pwd)
+		'quoted text' grep "$@" cd $(pwd) "$@" && $(pwd)
+	"$@" awk grep 'quoted text'
+		readonly done readonly cd test "$@" grep /usr/bin $(pwd) && printf 2>/dev/null
+	echo -eu sed "$1" && ${HOME} "$1" -eu | then cd -eu cd "$1" "$@" cd test 'quoted text'
+grep /usr/bin done --verbose 'quoted text' 'quoted text' 'quoted text'
+readonly "$1" x=1 then readonly && done x=1 $(pwd) /usr/bin
+		2>/dev/null x=1 printf x=1 | --verbose ${HOME} done | "$1"
+--verbose cd /usr/bin | then printf done awk 'quoted text'
+| export sed sed then cd then "$1" "$@" cd x=1 "$@" test && done x=1 "$1"
+awk echo x=1 then "$1" sed
+	cd then readonly grep sed echo -eu ${HOME} grep /usr/bin local $(pwd) 2>/dev/null
+	grep "$1" test 'quoted text' && | echo test readonly "$@" printf
+sed grep ${HOME} awk
+$(pwd) ${HOME} printf printf --verbose /usr/bin test "$1" local "$@" /usr/bin
+		'quoted text' "$1" --verbose printf local --verbose cd -eu && x=1
+	export grep --verbose /usr/bin /usr/bin
+	"$@" "$@" printf done 'quoted text' readonly
+		readonly local done "$1" ${HOME}
+&& local cd 'quoted text' | printf then printf then --verbose then ${HOME}
+	"$@" | awk cd grep export
+		awk -eu /usr/bin grep | /usr/bin ${HOME} --verbose readonly /usr/bin local
+echo /usr/bin local --verbose
+| "$1" /usr/bin readonly done -eu cd -eu ${HOME} done sed $(pwd)
+"$1" 'quoted text' x=1
+		done export done 'quoted text'
+		'quoted text' ${HOME} 'quoted text' && /usr/bin readonly
+cd ${HOME} 2>/dev/null echo test echo $(pwd) ${HOME} cd
+	local awk echo echo grep then
+"$@" awk printf cd awk printf
+		"$@" export 2>/dev/null | | echo test
+	sed /usr/bin /usr/bin sed --verbose
+#include c187.sh
+	${HOME} readonly -eu "$1" ${HOME} printf readonly ${HOME} readonly ${HOME}
+--verbose "$@" export -eu --verbose 2>/dev/null sed printf
+		/usr/bin | then 2>/dev/null $(pwd) 2>/dev/null
+		awk done then /usr/bin && && "$1" sed | | readonly
+		export grep cd /usr/bin "$@" 'quoted text' printf $(pwd) then
+	"$1" awk 2>/dev/null --verbose awk 2>/dev/null 2>/dev/null -eu
+"$@" 2>/dev/null | 2>/dev/null awk $(pwd) sed then
+'quoted text' 'quoted text' then | awk local cd ${HOME} 2>/dev/null local
+test then printf cd /usr/bin $(pwd) done "$@" --verbose
+		done printf local local "$@" -eu x=1
+	grep echo grep --verbose /usr/bin x=1 "$@" $(pwd) cd
+done && sed echo grep then --verbose | /usr/bin "$@" printf $(pwd) "$@" local
+		'quoted text' awk | 'quoted text' echo ${HOME} cd
+		awk $(pwd) printf 2>/dev/null $(pwd) | $(pwd)
+echo local "$@" cd readonly awk "$@" readonly -eu "$1" cd test 'quoted text'
+		sed /usr/bin local awk cd
+		local sed grep done cd readonly
+test done export ${HOME}
+		test then local ${HOME} sed "$1" | "$@" then printf | | "$@"
+done -eu printf "$@" /usr/bin awk export local /usr/bin 'quoted text' readonly echo
+	sed grep export 'quoted text' then echo test 2>/dev/null echo -eu &&
+	done 'quoted text' export --verbose $(pwd)
+	2>/dev/null export x=1 ${HOME} x=1 sed export test awk cd export
+	then printf --verbose "$1" local
+	local x=1 readonly | export echo test then "$1" x=1 --verbose "$1" cd grep | "$1"
+		x=1 $(pwd) awk echo echo && $(pwd) grep "$@" echo sed /usr/bin /usr/bin echo
+		/usr/bin /usr/bin echo done 2>/dev/null
+		'quoted text' echo sed --verbose ${HOME} | $(pwd) --verbose
+	| /usr/bin ${HOME} && $(pwd) 2>/dev/null 'quoted text'
+	test done local then 'quoted text' test awk 'quoted text'
+		/usr/bin 2>/dev/null x=1 -eu printf awk printf &&
+	&& printf "$@" then then 2>/dev/null 2>/dev/null grep -eu $(pwd) done test 2>/dev/null
+	grep then awk /usr/bin grep --verbose export sed $(pwd) cd ${HOME}
+		${HOME} export 'quoted text' "$1" "$1" local awk then "$1" $(pwd) /usr/bin
+x=1 local x=1 x=1 test "$1" printf | echo /usr/bin test
+--verbose && "$1" readonly | echo
+export awk export grep export echo done echo 'quoted text' --verbose
+| done -eu grep echo local "$@" done echo --verbose && -eu 2>/dev/null local
+"$@" -eu done $(pwd) $(pwd) "$@" test
+		"$1" cd && ${HOME} 2>/dev/null grep $(pwd) echo
+	awk x=1 "$@" $(pwd) local ${HOME} local awk export printf local printf
+-eu "$@" x=1 'quoted text' test grep | -eu
+		cd 2>/dev/null x=1 readonly readonly sed grep && local then
+		'quoted text' ${HOME} "$1" awk readonly -eu "$@" -eu cd "$1" /usr/bin
+	$(pwd) sed /usr/bin 'quoted text' &&
+done "$1" cd grep test readonly
+		awk echo ${HOME} export
+		"$@" ${HOME} /usr/bin sed sed printf && cd export done -eu --verbose
+sed $(pwd) --verbose "$1" $(pwd) then | sed 'quoted text'
+	--verbose printf -eu awk local readonly then 'quoted text'
+	then done x=1 "$1" && "$@" x=1 && --verbose -eu local
+	grep export 2>/dev/null --verbose cd done ${HOME} ${HOME}
+--verbose grep "$@" x=1 x=1 then 2>/dev/null sed awk x=1 awk
+readonly 'quoted text' --verbose then
+	"$@" cd x=1 grep printf readonly ${HOME}
+	x=1 test then && --verbose awk grep -eu export $(pwd) printf 2>/dev/null $(pwd)
+| local -eu 'quoted text' "$@" ${HOME} ${HOME} "$1" then
+sed cd --verbose "$@" && /usr/bin 'quoted text'
+		test 'quoted text' "$1" "$@" ${HOME} --verbose
+'quoted text' local echo && sed test $(pwd) echo ${HOME} "$@" local "$1" awk
+	| sed ${HOME} "$1" --verbose -eu export x=1 local test --verbose ${HOME} /usr/bin
+| /usr/bin local -eu done
+	echo printf 2>/dev/null readonly grep awk then x=1 "$@" local printf
+	local | "$1" "$1" $(pwd) x=1 "$1" then grep
+		printf $(pwd) --verbose sed grep printf ${HOME} printf readonly awk 2>/dev/null
+		awk grep x=1 $(pwd) --verbose
+done echo $(pwd) x=1 "$1" x=1 $(pwd) done grep /usr/bin export
+2>/dev/null export | echo
+then 2>/dev/null local test
+	"$1" test echo ${HOME} ${HOME} && && done printf sed /usr/bin then
+--verbose printf printf local 'quoted text'
+grep echo -eu x=1 "$@" echo export test cd awk sed grep
+	export readonly 'quoted text' export | cd echo -eu "$1" "$1"
+${HOME} test cd awk readonly then cd done awk
+		grep ${HOME} /usr/bin 'quoted text' echo "$@" cd x=1 export "$@" && sed
+	test "$@" --verbose | && "$1" 2>/dev/null awk
+		sed -eu $(pwd) | cd $(pwd) test
+	2>/dev/null printf x=1 ${HOME} "$@"
+		| "$@" grep export "$1" | --verbose grep sed "$1" export | echo && readonly
+'quoted text' echo readonly then printf x=1 test cd |
+		x=1 | --verbose printf "$1" /usr/bin 2>/dev/null awk --verbose
+	local /usr/bin local --verbose done /usr/bin
+		"$1" done cd --verbose
+	${HOME} --verbose printf -eu 2>/dev/null "$1" && printf 'quoted text'
+		x=1 /usr/bin local then ${HOME} printf && grep x=1 sed cd sed
+local sed printf /usr/bin
+cd $(pwd) "$@" "$@" export sed -eu x=1 done printf --verbose awk "$@"
+		sed 'quoted text' export -eu 2>/dev/null test readonly
+	&& -eu "$1" local sed --verbose && ${HOME} /usr/bin done 2>/dev/null cd grep awk
+&& -eu 'quoted text' test sed local readonly 'quoted text' test awk
+then "$1" cd "$@" readonly export export 2>/dev/null
+		then 'quoted text' printf cd readonly /usr/bin "$1" readonly echo $(pwd) ${HOME}
+		printf ${HOME} 2>/dev/null sed 'quoted text' sed printf grep grep
+		| $(pwd) local then ${HOME} cd then local 2>/dev/null "$@" --verbose printf printf
+	--verbose grep cd export 'quoted text'
+	${HOME} --verbose cd ${HOME} --verbose export grep echo
+		export local -eu sed 'quoted text' && readonly
+	local then "$1" ${HOME} local
+		"$@" grep done --verbose $(pwd) readonly echo ${HOME} export x=1
+echo -eu /usr/bin printf $(pwd) test
+cd ${HOME} x=1 export "$@" readonly then then $(pwd) --verbose readonly
+		2>/dev/null local && "$@" printf sed "$@" echo sed then cd "$@" then
+	then -eu | 'quoted text' "$@" readonly 'quoted text'
+--verbose echo 2>/dev/null $(pwd) 2>/dev/null
+	--verbose --verbose 2>/dev/null 2>/dev/null 'quoted text' ${HOME} cd
+		export ${HOME} then export readonly export awk test then sed export
+	awk grep 2>/dev/null && "$@" test cd
+2>/dev/null | ${HOME} $(pwd) awk "$1" --verbose
+	awk printf /usr/bin -eu
+test -eu readonly "$@"
+| test && test "$@" -eu test "$@" then /usr/bin cd 2>/dev/null
+		cd printf awk done sed done x=1 $(pwd) readonly echo
+awk awk x=1 test printf x=1 /usr/bin /usr/bin export
+"$1" --verbose ${HOME} test then readonly $(pwd) cd awk
+sed export sed export | "$@" "$1"
+	then --verbose readonly readonly
+		&& printf test export 2>/dev/null x=1
+test cd awk $(pwd) "$1"
+	printf --verbose /usr/bin
+readonly awk echo echo awk && then cd 2>/dev/null printf | && then
+		"$1" awk -eu readonly $(pwd) 'quoted text' && local --verbose export x=1
+awk "$1" && test ${HOME} cd test "$@" "$@" "$1" readonly cd then
+		sed "$@" /usr/bin --verbose cd $(pwd) | && --verbose --verbose local | echo
+${HOME} export ${HOME} /usr/bin local 2>/dev/null cd | readonly local awk grep
+		${HOME} --verbose test awk printf 2>/dev/null grep then --verbose -eu -eu
+	cd "$1" grep $(pwd) local printf done "$1"
+	cd readonly local 2>/dev/null -eu 'quoted text'
+	$(pwd) local grep --verbose readonly
+sed /usr/bin -eu grep | --verbose done cd done | local cd export
+		test "$1" printf printf 2>/dev/null --verbose /usr/bin "$@" "$@" local
+&& local $(pwd) export export echo "$1" export readonly
+		then "$1" printf $(pwd) local
+"$1" $(pwd) test ${HOME} export echo readonly then awk "$1"
+grep grep $(pwd) test export echo then 2>/dev/null readonly 2>/dev/null
+		sed "$@" cd cd sed awk $(pwd) $(pwd) local grep
+	2>/dev/null /usr/bin $(pwd) 2>/dev/null then | 2>/dev/null then echo
+	awk cd readonly echo "$@" 2>/dev/null local 'quoted text' 2>/dev/null
+	'quoted text' $(pwd) grep local "$1" "$@"
+test test done grep local /usr/bin
+readonly --verbose awk readonly done x=1 'quoted text' x=1 echo done sed x=1 -eu
+${HOME} "$1" echo $(pwd) && sed
+	"$1" $(pwd) --verbose 2>/dev/null readonly
+	/usr/bin | "$@" x=1 cd --verbose x=1 | 'quoted text' x=1 | awk test --verbose
+	${HOME} /usr/bin test && grep | printf export
+		echo ${HOME} /usr/bin printf cd x=1 sed "$@" 2>/dev/null sed --verbose
+	local | ${HOME} "$@" --verbose
+		'quoted text' cd && readonly | local 2>/dev/null
+	| then grep then printf local done --verbose "$1" grep
+	printf local sed grep then local awk
+	then && local printf ${HOME} printf printf x=1 -eu /usr/bin 'quoted text'
+		$(pwd) grep "$1" local cd done /usr/bin --verbose
+done && && awk export grep readonly awk 2>/dev/null readonly && grep "$1"
+	local "$@" 'quoted text' ${HOME} awk ${HOME} awk then cd && done
+		local $(pwd) awk && "$1"
+		done done done 2>/dev/null then ${HOME} 'quoted text'
+		sed ${HOME} "$1" grep readonly /usr/bin
+		grep sed sed cd grep done echo done -eu x=1 x=1
+"$@" awk done grep sed "$@" printf sed $(pwd) 'quoted text' readonly cd && /usr/bin
+done "$1" 2>/dev/null ${HOME} x=1 'quoted text' $(pwd) cd printf
+		done /usr/bin "$1" --verbose /usr/bin
+--verbose /usr/bin done 2>/dev/null x=1
+		${HOME} printf grep done
+"$1" --verbose /usr/bin x=1 done $(pwd)
+		"$1" && | x=1 x=1 then "$@" echo awk export cd export "$@" local
+	sed echo --verbose printf then ${HOME} -eu sed cd x=1 && readonly --verbose
+	sed printf export local && 2>/dev/null
+		cd export echo && ${HOME} | x=1 $(pwd)
+	/usr/bin awk printf printf sed | x=1
+	awk | awk echo printf 2>/dev/null | ${HOME} "$@" export 'quoted text' ${HOME}
+		${HOME} awk awk /usr/bin
+		cd && x=1 'quoted text' done ${HOME}
+		2>/dev/null grep export $(pwd) --verbose test readonly local
+cd cd ${HOME} -eu done /usr/bin done
+'quoted text' ${HOME} done -eu 2>/dev/null echo && $(pwd) done
+		export $(pwd) sed && --verbose && x=1 'quoted text' && "$@" x=1
+		&& done ${HOME} echo printf --verbose | -eu sed cd |
+	grep | $(pwd) echo ${HOME} | printf
+	| printf "$1" /usr/bin test "$1" ${HOME} "$1" printf readonly
+	x=1 2>/dev/null done $(pwd) | done test /usr/bin
+awk cd awk $(pwd) /usr/bin sed "$@" then awk $(pwd) "$@" "$1"
+		2>/dev/null cd export 2>/dev/null x=1 x=1 x=1 sed sed && then 2>/dev/null
+	readonly ${HOME} printf awk "$@" --verbose awk "$@" printf local test && export
+&& $(pwd) echo sed then "$@" /usr/bin test sed $(pwd) /usr/bin /usr/bin $(pwd)
+	test -eu "$1" echo test done printf ${HOME} awk awk "$@" "$1" echo x=1 ${HOME}
+		printf grep done local 'quoted text'
+test | && echo /usr/bin printf grep then 2>/dev/null "$@"
+		x=1 /usr/bin /usr/bin printf --verbose
+$(pwd) awk sed "$1" test printf local
+	$(pwd) "$1" -eu 2>/dev/null x=1 done readonly
+		"$1" x=1 echo 'quoted text' cd "$@" x=1 local ${HOME} 2>/dev/null cd
+	then | test echo test echo local local test
+$(pwd) echo then grep then /usr/bin
+		readonly sed test test echo | printf awk /usr/bin $(pwd) cd
+		--verbose then test awk echo "$@" | printf 2>/dev/null awk 2>/dev/null
+2>/dev/null then grep awk $(pwd) x=1 readonly cd
+		sed 2>/dev/null 'quoted text' local done done local test &&
+	x=1 awk -eu done echo sed awk sed cd local 2>/dev/null --verbose $(pwd) $(pwd)
+&& | readonly test test -eu sed "$@" export /usr/bin export then
+&& grep done done 'quoted text' then then printf awk --verbose
+		--verbose /usr/bin -eu export x=1 local 'quoted text'
+readonly grep export awk /usr/bin sed "$1" test
+		echo test "$1" | sed 'quoted text' 2>/dev/null -eu local
+-eu readonly "$@" awk done grep test --verbose ${HOME} 'quoted text' cd
+'quoted text' /usr/bin --verbose then /usr/bin 2>/dev/null
+		awk done then sed then 'quoted text' &&
+grep ${HOME} x=1 2>/dev/null && cd $(pwd) printf | 'quoted text' | printf then
+		/usr/bin $(pwd) sed echo "$1" readonly sed test
+	'quoted text' cd readonly echo ${HOME} --verbose /usr/bin printf x=1 cd echo export
+then sed test "$@" readonly ${HOME} readonly
+		2>/dev/null local sed -eu awk | "$@" echo $(pwd)
+		| x=1 $(pwd) "$@" awk $(pwd)
+	then x=1 x=1 /usr/bin |
+	grep --verbose --verbose local done then readonly "$1" $(pwd) cd printf local
+	cd cd then --verbose cd x=1 /usr/bin
+		done --verbose /usr/bin then export x=1 grep export local "$1" then --verbose
+	printf | then export | "$1"
+sed /usr/bin 2>/dev/null $(pwd) 2>/dev/null sed ${HOME} local printf sed
+grep 'quoted text' readonly awk awk
+		-eu 2>/dev/null export sed "$1" cd cd echo $(pwd) echo && grep printf test
+		/usr/bin readonly local ${HOME} | ${HOME} 'quoted text' /usr/bin
+2>/dev/null cd $(pwd) awk
+		x=1 --verbose && --verbose /usr/bin readonly echo then local readonly
+awk "$@" sed test test export readonly 2>/dev/null $(pwd) sed -eu test ${HOME}
+	x=1 x=1 $(pwd) "$1" "$1" /usr/bin 2>/dev/null "$1" -eu
+		echo | sed then /usr/bin test "$1"
+	grep x=1 2>/dev/null "$1" ${HOME} x=1 readonly local
+		awk ${HOME} printf 2>/dev/null printf && printf $(pwd) awk local
+	&& readonly readonly "$@" test $(pwd) sed
+	${HOME} test printf && /usr/bin then done
+	then | printf /usr/bin awk "$@" /usr/bin printf sed test
+echo "$@" awk sed test ${HOME} -eu | 'quoted text' sed test x=1 | printf
+then "$@" printf ${HOME} local
+then cd awk export grep local test printf test
+	x=1 && /usr/bin readonly cd echo test export echo ${HOME} 'quoted text' "$@" readonly
+		&& /usr/bin printf cd printf
+	2>/dev/null | -eu local local "$1" cd then test grep "$1" | x=1 x=1 'quoted text'
+		"$1" grep "$@" grep echo x=1 && x=1 -eu /usr/bin then | export
+done 'quoted text' test done echo readonly
+		x=1 && 'quoted text' --verbose 'quoted text'
+cd grep ${HOME} readonly | sed --verbose test ${HOME} done
+		-eu && && awk "$1" printf test export done | /usr/bin printf
+		x=1 sed readonly test 'quoted text'
+local | awk ${HOME} x=1 /usr/bin 'quoted text'
+echo -eu 'quoted text' readonly then
+		2>/dev/null $(pwd) /usr/bin local 'quoted text' echo local -eu &&
+export 2>/dev/null 2>/dev/null
+export export ${HOME} $(pwd) /usr/bin awk ${HOME}
+		printf -eu && test | done
+| printf local export done $(pwd) 'quoted text'
+		| 2>/dev/null --verbose then "$1" 2>/dev/null cd 'quoted text'
+		done echo sed 2>/dev/null $(pwd) /usr/bin -eu -eu
+	cd /usr/bin done --verbose | awk "$@" test grep done
+	local /usr/bin readonly "$@" -eu sed awk
+	awk sed awk 'quoted text' cd /usr/bin export done
+	echo -eu export printf
+	$(pwd) awk cd done cd readonly cd then $(pwd)
+		done echo x=1 cd -eu export "$1" && grep cd grep test then
+		x=1 "$1" test --verbose /usr/bin /usr/bin |
+	readonly export x=1 ${HOME} sed awk
+$(pwd) /usr/bin grep echo && --verbose export echo done
+	local test done -eu $(pwd) done x=1 "$@" && grep 2>/dev/null
+readonly 'quoted text' printf echo $(pwd) -eu
+$(pwd) ${HOME} 'quoted text' ${HOME}
+then sed /usr/bin "$@" printf printf
+	local | ${HOME} then "$1" awk readonly "$@" awk echo cd
+	x=1 echo x=1 'quoted text' "$1" /usr/bin
+	cd sed "$1" /usr/bin /usr/bin test test grep "$@" 2>/dev/null
+	"$@" grep then ${HOME} readonly cd printf export --verbose
+		"$@" export printf local /usr/bin "$@" readonly --verbose sed 2>/dev/null
+	/usr/bin --verbose "$@" local
+		echo grep awk | x=1 cd grep cd export local
+		printf printf readonly export
+	readonly done done then readonly test && echo /usr/bin 2>/dev/null
+	--verbose --verbose then cd export sed sed 2>/dev/null
+		-eu export export | ${HOME}
+&& --verbose x=1 printf then grep ${HOME} sed echo x=1 printf awk "$1" $(pwd)
+	sed ${HOME} $(pwd) echo sed --verbose grep --verbose
+export awk export x=1 grep test $(pwd) 2>/dev/null --verbose /usr/bin then ${HOME}
+	grep readonly ${HOME} -eu
+	test sed | echo -eu export sed && sed && local local
+		sed /usr/bin 'quoted text' cd export readonly
+		&& -eu echo local done $(pwd) --verbose
+		printf $(pwd) then grep test grep awk "$@" echo grep awk export echo "$1" &&
+	test done awk 2>/dev/null --verbose local test export ${HOME}
+	sed --verbose x=1 printf readonly | readonly | test sed /usr/bin -eu
+printf | "$@" 2>/dev/null then awk then --verbose awk $(pwd) sed test
+		awk 2>/dev/null grep then done then
+		'quoted text' echo printf 2>/dev/null
+	awk 2>/dev/null export readonly
+		$(pwd) readonly printf test | "$1" x=1 "$@" done readonly grep $(pwd)
+	readonly -eu "$1" /usr/bin && sed x=1 | 'quoted text'
+	export && "$@" "$@" cd then grep sed grep
+"$@" 2>/dev/null -eu readonly 'quoted text' printf 'quoted text' 'quoted text'
+		done ${HOME} --verbose awk sed "$1" x=1 | then -eu grep cd local &&
+awk echo x=1 echo done $(pwd) && x=1
+export $(pwd) grep echo sed --verbose --verbose local --verbose
+"$1" 'quoted text' 'quoted text' readonly then cd "$@"
+${HOME} $(pwd) 2>/dev/null awk readonly
+		&& "$@" then 2>/dev/null 2>/dev/null 'quoted text' awk sed
+	"$1" readonly done x=1 "$@" ${HOME} &&
+-eu 'quoted text' test export ${HOME} $(pwd)
+	/usr/bin 'quoted text' --verbose awk 2>/dev/null
+| readonly x=1 sed -eu && readonly | -eu "$1"
+	/usr/bin grep export echo cd local printf |
+		then local export done "$@" then | printf
+		-eu -eu awk cd -eu done x=1 'quoted text' | 'quoted text' local local
+	$(pwd) test && echo --verbose awk printf local done then export
+		grep done cd grep --verbose cd &&
+readonly x=1 --verbose 'quoted text' printf
+		sed echo 2>/dev/null "$@" "$@" cd sed cd &&
+		"$1" | 2>/dev/null -eu grep readonly printf awk cd readonly test
+	-eu readonly readonly grep echo done "$1" 2>/dev/null test && echo
+${HOME} && "$1" && | sed 'quoted text' printf local echo sed --verbose
+sed -eu awk done && readonly test then $(pwd)
+		2>/dev/null printf --verbose
+| echo && | "$1" test $(pwd) done export done "$@" -eu echo awk cd --verbose
+		/usr/bin 2>/dev/null | ${HOME}
+		sed | printf local echo readonly 'quoted text'
+2>/dev/null /usr/bin 'quoted text' printf test "$1" echo 2>/dev/null
+local 'quoted text' export 2>/dev/null readonly --verbose
+printf awk sed local "$1" grep local readonly readonly 2>/dev/null
+	$(pwd) cd && 'quoted text' 'quoted text' x=1 then sed
+		$(pwd) x=1 printf | 'quoted text' export export /usr/bin -eu test ${HOME}
+		grep 'quoted text' export "$1" x=1 $(pwd) echo
+	&& x=1 echo awk cd ${HOME} "$@" sed printf
+		--verbose 2>/dev/null done export 2>/dev/null 'quoted text'
+	-eu x=1 sed export $(pwd) | 2>/dev/null local done then "$@" /usr/bin &&
+	awk /usr/bin "$1" ${HOME} sed
+	echo && then x=1 | -eu readonly grep export "$1" local awk grep 2>/dev/null
+	'quoted text' test echo readonly ${HOME} ${HOME} ${HOME}
+cd -eu export cd awk | cd export "$@"
+	printf export -eu ${HOME} 2>/dev/null ${HOME}
+		then $(pwd) ${HOME} then printf 'quoted text' x=1 x=1 grep -eu
+		x=1 ${HOME} grep then $(pwd) ${HOME}
+	awk local then /usr/bin grep /usr/bin
+	awk test cd --verbose test x=1 x=1 'quoted text' x=1 grep | test ${HOME}
+		--verbose echo "$1" ${HOME} sed awk sed "$@" /usr/bin local && export export
+	-eu local | grep && -eu grep 2>/dev/null
+'quoted text' --verbose x=1 /usr/bin -eu export "$@" && cd awk done
+	| x=1 readonly -eu local
+	2>/dev/null echo $(pwd) | then cd "$1" /usr/bin --verbose cd then |
+		cd printf test local "$1" "$1" -eu
+		cd 'quoted text' sed local -eu echo
+then 'quoted text' 'quoted text' --verbose
+		x=1 awk -eu printf local 2>/dev/null 2>/dev/null grep
+"$@" "$@" grep printf local
+| 2>/dev/null "$@" printf 2>/dev/null awk then --verbose readonly
+'quoted text' printf sed printf | x=1 $(pwd) awk 'quoted text' --verbose printf
+		$(pwd) 'quoted text' printf --verbose
+		"$1" then awk --verbose awk awk --verbose
+local test 2>/dev/null
+export 2>/dev/null local /usr/bin
+		printf --verbose cd -eu | then printf "$@" done sed /usr/bin awk echo
+"$1" --verbose awk && 'quoted text'
+2>/dev/null x=1 -eu -eu x=1 &&
+		grep x=1 export done 'quoted text' 2>/dev/null $(pwd) 'quoted text'
+local ${HOME} x=1 | -eu grep && then grep sed "$@" printf printf then x=1 -eu echo
+		--verbose echo x=1 /usr/bin echo cd "$@" export 'quoted text' echo then x=1
+		x=1 2>/dev/null /usr/bin && "$@" -eu
+--verbose -eu sed && echo printf x=1 &&
+		export readonly local test | test awk readonly test awk -eu /usr/bin
+	'quoted text' | echo && awk test done && /usr/bin local readonly
+		x=1 $(pwd) /usr/bin 'quoted text' x=1 echo 'quoted text' export echo sed
+		&& && --verbose 2>/dev/null
+		done then cd "$@" x=1 && | && "$1" && --verbose x=1 | test done
+	grep grep "$@" sed 2>/dev/null --verbose | --verbose x=1 then --verbose -eu then
+		export printf then printf &&
+	&& x=1 | done --verbose && ${HOME} $(pwd) readonly
+"$1" then readonly "$@" grep awk 'quoted text' awk test awk $(pwd) local
+		$(pwd) 'quoted text' awk $(pwd)
+	then /usr/bin $(pwd) done export /usr/bin --verbose
+test | ${HOME} done test 'quoted text' then 'quoted text' test && export 2>/dev/null
+sed "$1" "$@" /usr/bin echo /usr/bin --verbose printf readonly ${HOME}
+2>/dev/null test grep readonly awk grep awk cd sed cd
+--verbose -eu "$1" 'quoted text'
+		"$1" then x=1 awk awk test && then done
+	test 'quoted text' test awk ${HOME} test cd cd "$@" test
+	done readonly $(pwd) | /usr/bin test grep -eu
+--verbose sed cd then cd readonly local cd awk readonly /usr/bin "$@" grep
+	x=1 readonly done export echo $(pwd) readonly export echo "$@" cd 'quoted text'
+		"$@" done /usr/bin && | export -eu 'quoted text'
+		| x=1 then local readonly sed test export
+		/usr/bin | sed test then echo grep cd x=1
+	x=1 done then /usr/bin local "$1" sed sed 2>/dev/null
+	cd ${HOME} "$@" then awk readonly 'quoted text' /usr/bin
+	readonly && local x=1 grep 'quoted text'
+		/usr/bin $(pwd) ${HOME} cd done "$1" printf $(pwd)
+export | | readonly x=1 $(pwd) -eu test "$1" x=1 && | done
+	"$@" done --verbose echo -eu 'quoted text' done
+		local ${HOME} test echo readonly grep printf readonly
+	readonly local test test /usr/bin /usr/bin grep readonly
+		${HOME} 'quoted text' test && done
+		/usr/bin test cd readonly echo "$@" local awk "$@" echo
+cd done readonly test printf export printf printf /usr/bin
+-eu grep sed x=1 $(pwd) ${HOME} $(pwd)
+	sed sed sed local x=1 "$@" 'quoted text'
+-eu printf then 'quoted text' grep export -eu
+		sed export echo awk ${HOME} printf "$1" "$@" export done 2>/dev/null
+	then sed -eu 'quoted text' sed export $(pwd) 'quoted text'
+		echo local local local -eu "$@" 2>/dev/null --verbose echo 2>/dev/null export
+echo readonly -eu | x=1 done local /usr/bin -eu
+awk 2>/dev/null | ${HOME} grep readonly ${HOME}
+	2>/dev/null x=1 ${HOME} x=1 x=1 && "$1" test echo printf x=1
+		x=1 done echo $(pwd) "$@" ${HOME} test "$1" "$1" test sed /usr/bin
+	cd | done | "$@" printf /usr/bin printf "$@" "$@" sed /usr/bin
+		-eu grep --verbose then $(pwd) done
+sed $(pwd) local "$1" $(pwd) /usr/bin && "$1" | grep then done then "$1"
+	grep -eu -eu /usr/bin
+/usr/bin /usr/bin then ${HOME} &&
+	printf "$1" awk awk local
+	2>/dev/null sed "$@" export readonly && printf printf
+	"$@" printf grep ${HOME} | /usr/bin readonly "$1"
+		$(pwd) x=1 && local /usr/bin | &&
+| --verbose x=1 grep sed sed -eu done "$1" $(pwd) done done "$@"
+	local 2>/dev/null then && 2>/dev/null awk echo done -eu x=1 readonly
+	local 2>/dev/null $(pwd) test | then grep x=1 --verbose awk echo then && local
+		'quoted text' test grep sed local | -eu x=1 local
+		/usr/bin -eu done "$1" /usr/bin "$1" grep awk local readonly readonly
+readonly grep 'quoted text' grep $(pwd)
+-eu --verbose -eu done sed --verbose
+-eu 2>/dev/null echo echo 2>/dev/null ${HOME}
+		x=1 then then export |
+	x=1 -eu 2>/dev/null -eu awk -eu done done --verbose ${HOME}
+	$(pwd) --verbose echo export "$@" readonly
+	then sed then local ${HOME} grep
+	printf -eu x=1 test printf echo 2>/dev/null /usr/bin 'quoted text'
+		/usr/bin done && | then local local done readonly "$1" cd local /usr/bin grep
+		x=1 && echo $(pwd) sed /usr/bin ${HOME} cd sed done
+| test echo "$1" cd $(pwd) echo "$@" -eu -eu && test
+	readonly sed "$@" printf awk /usr/bin echo
+$(pwd) 'quoted text' sed 2>/dev/null echo $(pwd) grep awk then then
+	local then awk x=1 "$1" then then export echo grep grep awk --verbose cd local
+test x=1 | export -eu sed done grep local export && "$@" 'quoted text' x=1 ${HOME}
+'quoted text' "$@" /usr/bin /usr/bin sed cd 'quoted text'
+local "$@" sed grep test $(pwd)
+	/usr/bin --verbose echo "$1" test && export --verbose cd grep local | test "$@"
+echo export done --verbose test test | "$1" $(pwd) test -eu "$1"
+then ${HOME} then awk --verbose /usr/bin
+		--verbose 'quoted text' then printf | /usr/bin && "$1" && x=1 readonly
+	test | done local awk $(pwd) -eu "$@" export grep /usr/bin
+	then echo sed 2>/dev/null 'quoted text' | x=1 2>/dev/null
+	grep "$@" local done -eu $(pwd) then test
+	| -eu local x=1 $(pwd) 2>/dev/null test
+test readonly 2>/dev/null
+	export "$1" "$1" cd printf
+test /usr/bin echo test test cd $(pwd) /usr/bin awk -eu export 'quoted text'
+		/usr/bin awk readonly && export && --verbose then
+		readonly then done test 'quoted text' local x=1 cd
+		done test x=1 local cd local --verbose then done sed export
+	--verbose test export x=1 2>/dev/null 'quoted text' printf ${HOME} test
+	cd local grep cd done local --verbose
+sed sed /usr/bin local "$@" && printf then printf export
+readonly sed test done export && then done done | "$1" && "$1" $(pwd)
+		grep && 'quoted text' | sed grep done echo | /usr/bin grep "$1" sed
+cd export grep -eu x=1 /usr/bin x=1 'quoted text'
+printf ${HOME} export ${HOME} echo ${HOME} | cd then local
+export grep -eu export x=1 && | -eu readonly readonly echo echo test
+	/usr/bin cd "$@" "$@" /usr/bin
+	$(pwd) $(pwd) | cd echo "$@" printf 2>/dev/null
+sed /usr/bin --verbose echo cd "$@" | 2>/dev/null /usr/bin grep --verbose "$@"
+x=1 then export echo local "$1" "$1"
+sed 2>/dev/null export "$1" then awk printf ${HOME}
+sed $(pwd) "$1" 2>/dev/null ${HOME} awk $(pwd) done
+		export "$1" | readonly
+		-eu && -eu local ${HOME} --verbose export "$1" 'quoted text'
+		--verbose --verbose "$1" | | /usr/bin $(pwd) echo -eu echo
+		test 2>/dev/null $(pwd) 'quoted text' x=1 $(pwd) echo -eu test | x=1 x=1 export
+&& --verbose 'quoted text' done --verbose done grep ${HOME} grep
+-eu "$@" 'quoted text' | then --verbose export cd /usr/bin
+	"$1" $(pwd) --verbose then
+local readonly x=1 awk 2>/dev/null 'quoted text'
+-eu $(pwd) $(pwd) && readonly $(pwd) $(pwd) "$@" -eu export
+		${HOME} "$@" "$1" | echo test /usr/bin "$1" -eu "$1" grep readonly awk sed
+	"$@" $(pwd) sed | grep local cd "$@" x=1 test sed x=1
+		$(pwd) x=1 ${HOME} "$1" cd --verbose --verbose "$@" export --verbose
+| && -eu 2>/dev/null local
+	cd done export /usr/bin 2>/dev/null
+${HOME} grep ${HOME} local "$1" export test "$@" readonly "$@"
+		grep /usr/bin "$@" "$@" awk "$1" printf done sed 2>/dev/null
+		"$@" -eu test && "$1" x=1 'quoted text' test done echo ${HOME} /usr/bin
+printf awk "$1" /usr/bin /usr/bin echo "$1" test /usr/bin test -eu test
+	${HOME} local local "$@" local readonly | ${HOME} done x=1 echo echo $(pwd) 'quoted text'
+		"$@" cd awk local done "$@" "$1" local cd 2>/dev/null --verbose "$@"
+		-eu ${HOME} "$1" local && 'quoted text' /usr/bin export x=1 then
+	export /usr/bin export --verbose
+	export --verbose awk 2>/dev/null printf cd echo
+		x=1 $(pwd) "$@" sed then awk cd sed local $(pwd) grep x=1 $(pwd) echo
+	awk awk grep grep echo x=1 sed awk local cd $(pwd) -eu readonly export $(pwd)
+		cd 'quoted text' 'quoted text' done
+	awk readonly $(pwd) echo then -eu awk "$@" /usr/bin
+	'quoted text' ${HOME} $(pwd) $(pwd) 'quoted text'
+		"$@" then readonly $(pwd) 2>/dev/null
+-eu awk readonly test grep export && export test -eu ${HOME} 'quoted text'
+		${HOME} && echo export 'quoted text' then "$@" x=1 ${HOME} $(pwd) 'quoted text'
+		sed /usr/bin --verbose ${HOME} readonly --verbose printf test 2>/dev/null
+		echo grep grep echo echo 'quoted text' printf readonly x=1 "$@" 2>/dev/null
+		export then export awk test export ${HOME}
+&& && grep local --verbose
+	export test awk && "$@" $(pwd)
+	--verbose 'quoted text' sed
+		done x=1 export && grep $(pwd) /usr/bin ${HOME} done x=1
+	x=1 $(pwd) 'quoted text' cd -eu 'quoted text' "$1" /usr/bin local
+	cd done grep ${HOME} awk then ${HOME}
+		x=1 $(pwd) "$@" readonly printf | done 'quoted text' echo cd grep $(pwd)
+local -eu done | cd export readonly "$1" cd "$@" | printf
+	"$1" $(pwd) "$1" readonly x=1 readonly
+printf readonly test echo "$@" -eu
+		readonly 2>/dev/null &&
+		/usr/bin $(pwd) export readonly awk grep echo echo | awk printf done
+	sed grep ${HOME} "$1" && "$1" "$1" $(pwd)
+		${HOME} export test ${HOME} &&
+		printf local "$1" "$@" --verbose cd test | readonly /usr/bin
+		'quoted text' readonly
+	echo ${HOME} $(pwd) 2>/dev/null && | x=1 && $(pwd)
+		/usr/bin cd ${HOME} printf
+	'quoted text' "$1" "$1" &&
+		--verbose test echo && then printf "$@" done
+		/usr/bin ${HOME} && grep awk local local echo $(pwd) test cd -eu "$1"
+		--verbose readonly && -eu then /usr/bin $(pwd) ${HOME} grep sed export
+		grep ${HOME} awk "$1" local
+printf echo local --verbose sed
+	export grep printf | 2>/dev/null local $(pwd) --verbose 2>/dev/null sed grep
+	awk grep grep done /usr/bin cd 'quoted text'
+"$@" | then | sed | x=1 export
+done "$1" 2>/dev/null then local cd export x=1 'quoted text' printf | sed | sed
+	grep export | echo "$1" export 2>/dev/null readonly 2>/dev/null "$@" --verbose ${HOME}
+		&& && -eu && export echo then "$1"
+		$(pwd) x=1 x=1 sed $(pwd) --verbose
+		sed grep /usr/bin 2>/dev/null
+	x=1 /usr/bin done | awk --verbose grep test | readonly echo done "$1" done
+		$(pwd) sed readonly local done "$@" "$1" /usr/bin
+	2>/dev/null sed then printf
+	'quoted text' -eu then --verbose | done printf cd
+/usr/bin grep x=1 then | && done $(pwd) cd && echo echo "$@" $(pwd)
+	sed ${HOME} test ${HOME}
+	${HOME} echo echo "$1"
+	/usr/bin grep export export && local /usr/bin | printf done -eu export "$1"
+		awk then cd then | x=1 readonly sed | awk done "$1" && awk
+	"$1" readonly sed grep local
+		readonly /usr/bin 2>/dev/null printf export "$1" done echo 'quoted text' readonly
+readonly "$@" sed ${HOME} then printf "$@" local
+readonly "$1" $(pwd) 2>/dev/null "$@"
+	test /usr/bin ${HOME} done
+	"$@" "$1" export -eu test grep "$1" grep 'quoted text' $(pwd) "$1" sed ${HOME}
+		$(pwd) /usr/bin /usr/bin "$@"
+		printf echo "$@" && /usr/bin test ${HOME}
+	done awk x=1 then then echo printf done x=1 local grep printf awk then 'quoted text'
+--verbose awk readonly 2>/dev/null local test export -eu "$@" 'quoted text' echo
+		'quoted text' ${HOME} echo 'quoted text' sed ${HOME} ${HOME} --verbose
+x=1 | -eu "$1" local x=1
+		${HOME} then && grep 2>/dev/null
+		test grep /usr/bin $(pwd) local 2>/dev/null
+| | x=1 readonly && readonly --verbose done export ${HOME} grep &&
+${HOME} cd -eu readonly local $(pwd) /usr/bin
+awk && /usr/bin | local --verbose 'quoted text'
+	test test sed --verbose readonly 2>/dev/null
+readonly $(pwd) grep | printf x=1 local | "$@" local && 'quoted text' -eu x=1
+		local awk readonly 2>/dev/null cd awk ${HOME} printf /usr/bin /usr/bin
+	"$@" printf then 2>/dev/null test | x=1 --verbose printf done
+		"$@" x=1 printf readonly cd x=1 cd printf sed 'quoted text'
+printf done done local local
+		test ${HOME} cd --verbose cd -eu cd ${HOME} 'quoted text'
+		'quoted text' "$@" then "$1" grep /usr/bin readonly | ${HOME} echo | done x=1
+done then $(pwd) "$@" 'quoted text' ${HOME} /usr/bin echo local 'quoted text'
+		2>/dev/null | && done echo ${HOME} "$1" $(pwd) -eu
+		awk awk test printf cd test readonly
+	-eu -eu /usr/bin $(pwd)
+		done test && then echo awk "$1" | "$1" "$1" /usr/bin
+		sed "$@" cd sed "$1" /usr/bin awk cd
+	test awk 'quoted text' export | sed --verbose awk "$1" awk ${HOME}
+done readonly local && x=1 'quoted text' export awk
+then 'quoted text' test sed echo &&
+	| 'quoted text' 2>/dev/null done
+		-eu local readonly cd then -eu && /usr/bin "$@" && done then sed $(pwd) echo
+2>/dev/null x=1 printf && echo local test && --verbose echo x=1 "$1"
+		echo --verbose export && cd --verbose awk done export
+	then /usr/bin then done ${HOME}
+		--verbose 'quoted text' $(pwd) cd
+$(pwd) cd | cd test echo done x=1
+local grep test --verbose local x=1 test printf 'quoted text' test "$@" &&
+--verbose echo -eu -eu test $(pwd) --verbose grep "$1" echo cd cd test
+		test "$1" readonly local 2>/dev/null "$1" printf ${HOME}
+	"$@" "$1" | grep echo readonly 'quoted text'
+local "$1" awk /usr/bin sed && readonly printf x=1 awk $(pwd) 2>/dev/null
+-eu cd ${HOME} local local "$@" && done 2>/dev/null -eu echo readonly "$1" -eu
+printf && then grep /usr/bin
+cd echo | readonly local "$@" readonly readonly printf --verbose
+local "$@" cd 2>/dev/null 2>/dev/null 2>/dev/null done --verbose
+		x=1 && done /usr/bin && 2>/dev/null && | "$1" x=1
+		2>/dev/null -eu test printf "$@" x=1 printf
+	export 2>/dev/null $(pwd) echo awk awk
+	&& 2>/dev/null printf test test awk test -eu done "$1"
+	grep echo cd && grep grep
+'quoted text' local ${HOME} x=1
+	echo done echo /usr/bin | /usr/bin readonly
+	printf /usr/bin | -eu local then -eu printf /usr/bin readonly readonly
+	${HOME} local export cd sed cd | then | --verbose awk
+	printf ${HOME} grep done sed grep then 'quoted text'
+		/usr/bin "$1" then $(pwd) sed /usr/bin 'quoted text' 2>/dev/null
+test readonly && export then x=1
+	done /usr/bin test && cd -eu --verbose export ${HOME} "$@" "$@" $(pwd)
+local export ${HOME} /usr/bin
+	--verbose echo | "$@" /usr/bin /usr/bin cd x=1
+	printf printf x=1 /usr/bin
+	awk --verbose printf test $(pwd) /usr/bin ${HOME}
+		'quoted text' 2>/dev/null test test sed /usr/bin
+test export done ${HOME} printf test x=1 cd readonly
+		/usr/bin awk | cd /usr/bin 2>/dev/null -eu | "$1" export export grep $(pwd)
+&& && grep 2>/dev/null local 2>/dev/null
+	$(pwd) | | -eu grep then grep x=1 local test
+	/usr/bin export printf local awk "$@" ${HOME} export -eu printf /usr/bin grep
+export test 'quoted text'
+"$1" "$1" echo echo sed 'quoted text' && then then x=1 | readonly ${HOME}
+		awk then grep 'quoted text' awk then done --verbose
+awk export $(pwd) done echo sed grep
+	${HOME} awk test test cd -eu 2>/dev/null cd echo readonly && ${HOME}
+	then cd "$1" $(pwd) "$@" --verbose x=1 ${HOME} then export
+$(pwd) /usr/bin 2>/dev/null "$@" ${HOME} 2>/dev/null echo 'quoted text' | --verbose
+		/usr/bin printf 'quoted text' -eu | ${HOME} readonly cd "$1" "$1" grep
+	"$@" readonly ${HOME} -eu grep sed
+		local sed sed printf --verbose
+		| "$1" export export "$@" --verbose
+	readonly sed sed $(pwd) | 'quoted text' $(pwd) && test ${HOME}
+	readonly grep ${HOME} | && cd cd && /usr/bin ${HOME} "$1"
+		&& then printf local --verbose "$1"
+	export done then sed local then awk
+		echo --verbose test 2>/dev/null $(pwd) --verbose /usr/bin
+	grep 'quoted text' printf 'quoted text' done $(pwd) && sed local readonly
+		test echo --verbose test local
+${HOME} /usr/bin local done
+		--verbose ${HOME} 'quoted text' then "$1" local awk ${HOME}
+		grep | $(pwd) "$@" $(pwd) awk test "$1" test 'quoted text'
+		cd && local done done cd test test
+	$(pwd) local test done awk 'quoted text' ${HOME} local awk ${HOME} &&
+		grep readonly readonly $(pwd) then readonly cd local --verbose
+		grep 2>/dev/null printf ${HOME}
+	/usr/bin local test 2>/dev/null awk -eu "$@" echo awk awk -eu 2>/dev/null printf
+	cd test $(pwd) then sed 'quoted text' export /usr/bin awk test 'quoted text' "$@"
+		printf -eu $(pwd) awk 2>/dev/null
+	x=1 "$1" sed done sed "$@" -eu "$@" | | test local printf 'quoted text'
+	cd then x=1 cd $(pwd) ${HOME} 2>/dev/null test "$1" then test sed awk awk grep
+	grep /usr/bin "$1" local grep export --verbose 'quoted text'
+	/usr/bin -eu grep sed $(pwd) grep ${HOME} |
+"$@" awk ${HOME} "$1" then local x=1 $(pwd) grep echo grep local
+		awk printf test export && 'quoted text' local cd done sed
+local /usr/bin "$@" /usr/bin awk local readonly | 2>/dev/null
+		/usr/bin ${HOME} 'quoted text' "$1"
+	${HOME} cd | /usr/bin 'quoted text' test --verbose local ${HOME} -eu
+	--verbose then sed grep
+2>/dev/null cd done x=1 'quoted text' && x=1 && test
+done ${HOME} awk x=1 cd "$@" echo
+2>/dev/null cd grep --verbose sed printf $(pwd) --verbose local
+2>/dev/null 2>/dev/null readonly "$@" done awk "$1" grep awk $(pwd) /usr/bin
+echo printf then echo readonly 'quoted text'
+		then readonly grep sed x=1 -eu cd && --verbose x=1 'quoted text' awk 2>/dev/null
+	${HOME} readonly 2>/dev/null $(pwd) then readonly x=1 readonly "$1" export "$1"
+	$(pwd) $(pwd) cd grep echo -eu $(pwd) echo && |
+export then x=1 'quoted text' --verbose printf && sed --verbose
+		2>/dev/null done cd -eu 'quoted text' then x=1 $(pwd)
+x=1 readonly done export $(pwd) ${HOME} done
+"$@" ${HOME} then /usr/bin
+	grep ${HOME} $(pwd) /usr/bin "$@" $(pwd) awk /usr/bin && local x=1 2>/dev/null
+printf && test | awk local 2>/dev/null test export grep cd cd echo /usr/bin
+awk ${HOME} "$1" then $(pwd) sed && echo
+	| "$1" "$1" -eu | 'quoted text' cd cd grep sed then cd then 'quoted text'
+2>/dev/null echo readonly ${HOME} echo
+		echo echo then test 2>/dev/null sed echo -eu /usr/bin
+		"$@" 'quoted text' then $(pwd) 'quoted text' $(pwd) && --verbose readonly
+		x=1 $(pwd) done local then ${HOME} local printf cd "$@" | readonly
+printf -eu echo awk x=1 x=1 "$1" printf
+	local | ${HOME} printf local $(pwd) test grep -eu cd "$@" "$@"
+echo /usr/bin then echo awk grep grep "$1" --verbose echo && printf grep cd
+		readonly ${HOME} "$@" cd done ${HOME} echo cd -eu "$@" echo | sed
+local printf done test --verbose
+'quoted text' export cd local
+		readonly printf | | $(pwd) /usr/bin test
+	cd echo 2>/dev/null then "$@" 'quoted text' "$@" |
+		done ${HOME} export then awk x=1 echo printf x=1 then test readonly && grep
+--verbose ${HOME} test awk 'quoted text' awk export test then ${HOME}
+		"$@" then -eu | test && $(pwd) &&
+local echo ${HOME} sed x=1 "$1" local
+		${HOME} --verbose -eu awk sed 'quoted text' x=1 grep --verbose $(pwd) 2>/dev/null
+	/usr/bin awk ${HOME} grep -eu test
+		&& test "$@" export "$@" sed local test | $(pwd) grep sed
+local "$@" local printf x=1 echo /usr/bin
+		cd -eu | awk "$1" test then awk /usr/bin ${HOME}
+	/usr/bin export /usr/bin --verbose then
+	done then echo $(pwd) 2>/dev/null ${HOME}
+	grep 2>/dev/null export export
+		-eu /usr/bin test x=1 test -eu 'quoted text'
+cd test sed --verbose export local sed $(pwd)
+		export test x=1 && awk local && 2>/dev/null cd echo awk | /usr/bin awk then
+	export 'quoted text' echo "$@" printf
+		/usr/bin sed then local "$@" 2>/dev/null
+	then sed -eu done then "$1" "$@" echo 'quoted text' awk --verbose
+		&& --verbose readonly cd && ${HOME} x=1 grep --verbose
+	--verbose echo then local -eu 2>/dev/null ${HOME} | ${HOME} --verbose
+--verbose local cd x=1 local echo ${HOME} cd cd echo "$1"
+		$(pwd) local | ${HOME} done cd echo && && /usr/bin echo
+cd awk then awk && echo grep
+| -eu --verbose test sed && echo printf 2>/dev/null printf | --verbose grep
+		/usr/bin sed grep awk local export grep local 'quoted text' "$@" x=1 --verbose
+		cd -eu ${HOME} x=1 "$@" "$@" -eu
+test echo readonly --verbose --verbose export
+test readonly "$1" && 2>/dev/null
+	awk grep "$@" && grep $(pwd) then printf | ${HOME} "$@" grep grep echo awk "$1"
+/usr/bin local "$@" "$1" echo readonly "$@" done
+	cd sed 2>/dev/null /usr/bin && done 'quoted text' $(pwd) | test && && ${HOME}
+		local grep 2>/dev/null test x=1 x=1 test 2>/dev/null printf
+	| test printf --verbose | printf test ${HOME} && cd echo --verbose
+		-eu awk grep cd then && 'quoted text' /usr/bin 'quoted text' grep
+	export local readonly x=1 echo "$@" printf grep
+${HOME} 2>/dev/null local
+	readonly awk then && test $(pwd) $(pwd) test sed printf
+		local awk readonly && ${HOME} -eu local 'quoted text' 'quoted text' $(pwd) grep
+		readonly && test export
+		x=1 then "$@" ${HOME} --verbose grep ${HOME}
+	&& --verbose export cd 'quoted text' --verbose cd test test &&
+	'quoted text' "$1" then local
+		2>/dev/null "$@" --verbose ${HOME}
+		-eu grep $(pwd) "$@" printf -eu sed | $(pwd)
+readonly echo export then x=1 --verbose local awk
+	printf cd done 'quoted text' | | -eu grep 2>/dev/null
+		cd ${HOME} local 'quoted text' 'quoted text' --verbose
+	sed && 2>/dev/null /usr/bin "$@" x=1 ${HOME} --verbose && --verbose echo && export
+	'quoted text' ${HOME} 'quoted text' && cd echo done
+		readonly sed 'quoted text' grep
+	printf sed 2>/dev/null awk export "$@" 'quoted text' "$1" readonly grep
+		--verbose local "$1" /usr/bin
+&& sed && grep | done "$@" done --verbose 'quoted text' /usr/bin
+	readonly echo "$@" -eu | local local && local echo /usr/bin export printf ${HOME}
+		then "$1" cd then 'quoted text'
+		-eu test printf done echo --verbose ${HOME} x=1 -eu cd then
+awk cd local "$@" --verbose "$1" awk "$1" sed awk | printf readonly /usr/bin readonly
+	/usr/bin printf done export | 2>/dev/null done /usr/bin /usr/bin
+	-eu | 'quoted text' printf | local 'quoted text' cd grep
+printf export "$@" | then && "$1" --verbose export
+		printf local $(pwd) sed 2>/dev/null x=1 export
+		"$@" x=1 'quoted text' cd 2>/dev/null --verbose ${HOME}
+		--verbose "$1" "$@" --verbose sed 'quoted text' 2>/dev/null
+	local $(pwd) echo done "$1" "$1" "$@" printf 'quoted text'
+		then 2>/dev/null --verbose ${HOME} export ${HOME} sed && test 2>/dev/null
+local awk --verbose $(pwd) $(pwd) sed echo /usr/bin done cd sed printf sed cd "$@"
+'quoted text' /usr/bin -eu
+	/usr/bin done grep /usr/bin x=1 /usr/bin -eu "$1"
+		printf done local --verbose done /usr/bin then
+	-eu printf awk cd readonly 'quoted text' printf test 2>/dev/null --verbose
+		export ${HOME} "$@" sed -eu ${HOME} done awk then 2>/dev/null grep
+&& printf /usr/bin 2>/dev/null
+	readonly /usr/bin 2>/dev/null | echo
+		/usr/bin readonly then awk 2>/dev/null local awk
+"$@" /usr/bin sed test $(pwd) -eu local x=1 x=1 $(pwd) done $(pwd) printf |
+	$(pwd) $(pwd) grep cd | echo ${HOME} && readonly then | done
+	'quoted text' 'quoted text' "$@" /usr/bin | awk export grep "$@" -eu cd
+	'quoted text' test | -eu local local $(pwd) then
+	"$1" 2>/dev/null $(pwd) $(pwd) | 'quoted text' x=1 cd && --verbose
+		done --verbose grep "$1" test "$@" then | local export $(pwd) /usr/bin /usr/bin
+awk cd sed | grep cd "$1" test -eu "$1" local -eu && then "$1"
+printf -eu /usr/bin local awk then 'quoted text' cd
+"$1" "$1" grep x=1 /usr/bin "$1" test ${HOME} ${HOME} ${HOME} awk cd export
+	--verbose -eu --verbose --verbose export printf -eu && && ${HOME}
+readonly local test export 2>/dev/null --verbose local
+		${HOME} "$@" 2>/dev/null printf "$@" printf then export x=1 then ${HOME} sed
+	cd test -eu ${HOME} echo 'quoted text'
+then echo 2>/dev/null export printf test then
+		'quoted text' x=1 'quoted text' cd then test --verbose
+awk readonly $(pwd) "$1"
+${HOME} grep then $(pwd) readonly sed export --verbose
+grep sed awk --verbose then $(pwd) && echo
+--verbose local then readonly /usr/bin 'quoted text' | grep ${HOME} test
+		export export ${HOME} /usr/bin 'quoted text'
+		$(pwd) "$1" 'quoted text' printf awk readonly ${HOME}
+| export ${HOME} export x=1
+	then grep "$@" done -eu "$@" printf | -eu $(pwd)
+		${HOME} "$1" && export 'quoted text' awk --verbose grep readonly
+&& then && then then test
+	-eu "$@" "$1" ${HOME} /usr/bin sed local sed
+awk export readonly readonly awk 'quoted text'
+		$(pwd) x=1 test grep local | |
+	grep local /usr/bin awk x=1 local "$1" readonly
+	awk | then "$1" $(pwd) "$@" printf done --verbose cd && cd "$@" -eu awk printf
+then readonly local -eu && ${HOME} test --verbose
+		awk awk readonly ${HOME} done cd test
+		local x=1 grep grep --verbose "$@" local ${HOME} sed echo
+		&& then /usr/bin export sed grep awk local echo cd grep 'quoted text' $(pwd)
+		'quoted text' echo grep done echo -eu
+		grep done | /usr/bin awk --verbose x=1 2>/dev/null cd $(pwd) echo cd
+		export 'quoted text' 'quoted text' cd readonly
+	test /usr/bin ${HOME} /usr/bin
+printf x=1 export && done |
+	"$@" cd echo 2>/dev/null local $(pwd) "$1" export -eu
+		sed -eu grep export grep $(pwd) "$@" x=1 awk then
+		2>/dev/null test local x=1 then
+		-eu "$@" && /usr/bin export
+		| && grep echo cd && grep --verbose && sed $(pwd) export
+		readonly 2>/dev/null x=1 /usr/bin ${HOME} "$@" export echo
+	-eu grep cd echo cd /usr/bin echo && sed | 2>/dev/null
+		"$1" export x=1 "$@" then
+awk sed "$@" done then test export printf ${HOME} ${HOME}
+awk printf local echo && /usr/bin 'quoted text'
+		readonly awk readonly printf "$@" "$1" cd grep &&
+	local echo $(pwd) awk "$1" printf then ${HOME} echo x=1 'quoted text' test
+		&& sed test readonly echo done ${HOME} --verbose /usr/bin printf local -eu
+		--verbose cd local $(pwd)
+		printf done awk /usr/bin printf cd echo readonly export $(pwd) then readonly
+	then grep && -eu ${HOME} sed grep x=1 then done readonly test test readonly
+"$@" 2>/dev/null grep readonly "$@" done -eu
+grep sed echo grep "$1" | /usr/bin -eu done sed && 2>/dev/null |
+	&& 'quoted text' "$1" sed $(pwd) $(pwd) $(pwd) ${HOME} grep test
+		x=1 then --verbose -eu readonly "$1"
+	${HOME} echo "$1" then test 2>/dev/null printf | | grep awk x=1 ${HOME} cd 'quoted text'
+	2>/dev/null echo done echo done -eu export
+	export "$1" echo local echo export sed local "$1"
+"$@" then done readonly -eu --verbose "$@" 2>/dev/null --verbose --verbose
+		$(pwd) local /usr/bin ${HOME} echo sed | /usr/bin |
+		'quoted text' done local 'quoted text' --verbose && test --verbose echo
+'quoted text' echo sed done echo --verbose
+awk | $(pwd) echo grep --verbose awk ${HOME} test "$1" $(pwd) /usr/bin
+	x=1 "$1" | "$1" sed cd "$1"
+	'quoted text' done then /usr/bin | local sed awk 2>/dev/null /usr/bin cd && echo
+2>/dev/null "$@" readonly "$@" && local awk readonly printf "$1" cd && ${HOME}
+readonly ${HOME} awk 2>/dev/null done
+	readonly $(pwd) --verbose awk /usr/bin
+"$@" -eu printf export --verbose awk && 2>/dev/null export ${HOME}
+	$(pwd) /usr/bin grep cd 2>/dev/null awk
+done --verbose $(pwd) cd "$@" test |
+local then awk printf $(pwd) | printf echo x=1 readonly awk echo printf
+	cd sed "$@" x=1 local x=1 then && done --verbose grep | then "$@" grep x=1 /usr/bin
+-eu | done cd -eu x=1 test 2>/dev/null sed ${HOME} --verbose
+	test 'quoted text' ${HOME} --verbose 'quoted text' x=1 grep && -eu $(pwd)
+	grep printf x=1 local "$1" grep 2>/dev/null
+x=1 grep then awk done
+		grep ${HOME} "$@" 2>/dev/null $(pwd) 2>/dev/null /usr/bin ${HOME}
+		sed grep cd done then $(pwd) export 2>/dev/null
+		export | $(pwd) x=1 && grep $(pwd) local then | cd readonly --verbose "$@"
+awk test "$1" export $(pwd) ${HOME} export then x=1
+| "$1" /usr/bin local && sed export ${HOME} grep awk
+	sed 'quoted text' done awk cd export
+	"$@" x=1 sed "$1" "$1" $(pwd)
+| x=1 2>/dev/null "$@" then awk grep cd printf
+awk echo done $(pwd) -eu done test 'quoted text' grep printf
+	then 'quoted text' ${HOME} test $(pwd) $(pwd) sed --verbose echo export cd
+		"$1" && "$@" printf -eu cd sed x=1 -eu "$@" 2>/dev/null
+	x=1 test echo "$1" ${HOME} echo sed cd awk 'quoted text' "$1" /usr/bin awk 'quoted text'
+--verbose grep test readonly "$1" cd x=1 test cd
+-eu && sed export then printf $(pwd) sed
+		$(pwd) "$1" 2>/dev/null printf
+		'quoted text' 2>/dev/null echo $(pwd) local $(pwd) local printf ${HOME}
+		export /usr/bin echo --verbose x=1 ${HOME} export export && /usr/bin local test
+${HOME} ${HOME} 'quoted text'
+'quoted text' --verbose
+| | sed 2>/dev/null --verbose local then
+x=1 --verbose sed readonly sed --verbose done | /usr/bin grep
+	--verbose printf awk /usr/bin | local
+		then then then "$@" done | "$@" cd "$1" echo -eu
+	$(pwd) | echo 'quoted text' /usr/bin | cd 'quoted text' echo 2>/dev/null
+'quoted text' 2>/dev/null readonly ${HOME} local --verbose awk /usr/bin
+		x=1 local | "$1" printf grep /usr/bin "$1" local
+-eu ${HOME} "$@" $(pwd) /usr/bin local "$1" awk ${HOME} awk ${HOME}
+| "$@" --verbose done -eu "$@" cd sed
+test --verbose -eu done /usr/bin
+		cd printf local x=1 'quoted text' 'quoted text'
+		$(pwd) then test ${HOME} then
+readonly sed export --verbose x=1 /usr/bin printf grep printf $(pwd) && local
+grep printf readonly grep done sed ${HOME} awk --verbose 2>/dev/null
+		${HOME} 2>/dev/null then x=1 2>/dev/null
+		sed local awk /usr/bin
+		| then ${HOME} test sed done 2>/dev/null printf && echo /usr/bin readonly readonly
+x=1 local test sed | $(pwd) 2>/dev/null then grep local -eu "$1" sed
+	2>/dev/null /usr/bin grep /usr/bin echo export 2>/dev/null export local
+/usr/bin readonly awk readonly export | cd cd 2>/dev/null 2>/dev/null --verbose
+$(pwd) "$1" 'quoted text' "$1" readonly local && 'quoted text'
+printf ${HOME} 'quoted text' ${HOME}
+		readonly -eu -eu --verbose then local x=1 --verbose
+		done then echo 2>/dev/null done awk 2>/dev/null
+		done export -eu test awk then /usr/bin 'quoted text' done "$1" $(pwd) awk &&
+then /usr/bin then -eu sed && printf done "$1" ${HOME} "$@" test
+	/usr/bin 2>/dev/null --verbose 2>/dev/null $(pwd) cd /usr/bin && "$1" /usr/bin
+		done sed sed $(pwd) | /usr/bin done
+	2>/dev/null cd -eu cd then 'quoted text' x=1 local test awk x=1 ${HOME} --verbose
+grep cd ${HOME} -eu sed sed echo 2>/dev/null "$1" test $(pwd) test
+	export 2>/dev/null "$1" "$@" "$1" done "$1"
+	grep sed ${HOME} $(pwd) "$1" cd then cd grep local ${HOME} ${HOME}
+		&& echo done then test x=1 -eu x=1 sed ${HOME} --verbose echo echo /usr/bin
+done ${HOME} done /usr/bin then
+awk && -eu $(pwd) -eu -eu
+		test && test export -eu ${HOME} export -eu ${HOME} /usr/bin "$@" ${HOME}
+		cd -eu $(pwd) | ${HOME} | -eu awk ${HOME}
+	awk --verbose sed x=1 && export
+export /usr/bin export echo
+	2>/dev/null ${HOME} local "$1" sed -eu cd --verbose 'quoted text' ${HOME} done
+$(pwd) cd sed --verbose -eu local 2>/dev/null && ${HOME} local readonly "$1" awk
+		--verbose ${HOME} 'quoted text' export | test local cd && | "$1" grep x=1
+	2>/dev/null && grep | awk &&
+	| 2>/dev/null awk "$@" 'quoted text' local && -eu cd $(pwd) local grep -eu printf
+	then local --verbose printf
+	local local "$@" 2>/dev/null readonly printf done "$1" test awk export --verbose
+		-eu 2>/dev/null /usr/bin $(pwd) 'quoted text' awk export local sed $(pwd) --verbose
+export ${HOME} done cd
+"$1" then cd awk then cd done grep $(pwd) --verbose
+	/usr/bin --verbose cd printf | /usr/bin export local | 'quoted text' &&
+-eu test /usr/bin readonly test "$@" "$1" local && 2>/dev/null --verbose
+	export awk then cd 2>/dev/null 'quoted text' 2>/dev/null readonly ${HOME}
+	printf 'quoted text' grep --verbose grep $(pwd) readonly echo -eu 2>/dev/null
+then test local readonly "$1" readonly grep then && -eu
+		grep ${HOME} grep local -eu cd awk done
+		readonly echo sed cd test readonly then
+	x=1 cd sed $(pwd) "$1" x=1 readonly readonly
+	echo echo readonly ${HOME} printf cd x=1
+		/usr/bin echo ${HOME} | && sed sed /usr/bin test echo "$1"
+	grep local x=1 done awk
+"$1" readonly awk | awk echo
+	2>/dev/null awk ${HOME} done local "$1" done --verbose
+		| echo cd --verbose 'quoted text' printf then
+awk cd then $(pwd) echo 2>/dev/null printf | export printf --verbose
+test && $(pwd) local "$@"
+	2>/dev/null local 2>/dev/null grep test 2>/dev/null x=1 awk &&
+		&& 2>/dev/null --verbose done x=1 | test
+	--verbose done --verbose awk done "$1" echo echo done then ${HOME} x=1 "$1"
+&& local && -eu test readonly "$@" 2>/dev/null cd
+		2>/dev/null /usr/bin "$1" printf readonly | | printf 2>/dev/null && | readonly
+	&& grep | awk sed printf then 2>/dev/null test 2>/dev/null sed /usr/bin
+		| cd --verbose readonly
+		"$@" 'quoted text' echo test echo
+		$(pwd) "$@" then /usr/bin then echo | "$1" $(pwd) sed printf
+	printf /usr/bin | x=1 then
+	2>/dev/null | ${HOME} export done grep export
+$(pwd) && ${HOME} export sed then then grep export | -eu cd export
+		--verbose 2>/dev/null | x=1 --verbose $(pwd) 'quoted text' test && grep done
+	sed /usr/bin local 2>/dev/null "$@" echo &&
+	sed ${HOME} then -eu grep printf then "$1" /usr/bin done local "$@" then
+'quoted text' "$1" printf
+--verbose export sed "$1" --verbose x=1 echo test "$@" awk
+	sed && $(pwd) printf && -eu
+	"$1" --verbose awk sed "$@" awk then 'quoted text' readonly
+	/usr/bin --verbose -eu "$@" grep 'quoted text'
+		then "$@" --verbose grep /usr/bin
+		echo ${HOME} 2>/dev/null grep -eu local echo 'quoted text' done &&
+sed -eu "$1" /usr/bin --verbose "$@" 2>/dev/null sed "$1" -eu
+		done $(pwd) x=1 then local then x=1 sed cd && $(pwd) /usr/bin sed done awk
+--verbose "$1" done | x=1 x=1 | "$1" local
+"$1" "$@" 'quoted text' export
+		awk echo readonly then
+&& sed -eu grep ${HOME} 2>/dev/null awk | "$@" 'quoted text'
+	| echo printf export 'quoted text'
+then sed 2>/dev/null sed printf readonly 2>/dev/null 2>/dev/null 'quoted text'
+-eu x=1 ${HOME} 2>/dev/null done "$1" grep --verbose
+	$(pwd) echo readonly --verbose
+	-eu ${HOME} ${HOME} cd sed local ${HOME}
+		printf x=1 "$@" awk grep sed /usr/bin done /usr/bin
+echo "$1" ${HOME} done export
+	then grep --verbose then printf "$1" --verbose
+		${HOME} cd $(pwd) done local export sed
+		${HOME} awk && export $(pwd) sed ${HOME}
+		readonly -eu x=1 readonly test
+readonly ${HOME} "$@" readonly
+test && awk "$1" readonly "$1" readonly
+	"$1" -eu local done grep
+		test readonly 2>/dev/null then && |
+		local done ${HOME} sed | x=1 && --verbose
+awk test echo done cd $(pwd) export && readonly ${HOME} done local echo | ${HOME}
+		--verbose readonly local | export cd &&
+	"$@" readonly cd "$@" done then export awk printf awk readonly cd local
+cd grep $(pwd) "$@" 'quoted text' awk | 2>/dev/null "$1" export /usr/bin
+sed "$@" x=1 | -eu awk "$@" grep /usr/bin sed 2>/dev/null grep 2>/dev/null
+	"$1" --verbose | "$1" x=1 /usr/bin echo export awk &&
+test readonly 'quoted text' "$1" test cd -eu ${HOME} "$@" "$1" echo awk test local
+		x=1 $(pwd) printf cd then ${HOME} -eu "$1"
+	echo -eu then awk cd export
+	readonly && awk /usr/bin ${HOME} sed -eu grep x=1 readonly -eu --verbose
+		x=1 grep 2>/dev/null cd "$@" 2>/dev/null x=1
+		then cd echo --verbose --verbose awk ${HOME} /usr/bin test cd "$@" test
+-eu export grep | echo readonly -eu awk local local "$1" /usr/bin
+		/usr/bin /usr/bin /usr/bin "$1" test "$@"
+'quoted text' test then local "$@" x=1 echo local -eu x=1 --verbose $(pwd)
+		then then x=1 -eu $(pwd) printf "$@" ${HOME} local printf then test echo
+		-eu "$@" ${HOME} x=1 'quoted text' local
+	done then 'quoted text' x=1 2>/dev/null grep sed readonly --verbose readonly
+"$@" ${HOME} test $(pwd) export
+	2>/dev/null cd sed awk test "$@" /usr/bin /usr/bin ${HOME} grep
+		echo sed $(pwd) /usr/bin
+	grep printf sed | export sed /usr/bin "$@" /usr/bin cd $(pwd) cd done
+	done 'quoted text' 2>/dev/null | "$1" "$@" awk
+		${HOME} | 2>/dev/null x=1 && local awk done | && cd && export
+	local sed echo -eu export then -eu printf export "$1" 'quoted text' done
+2>/dev/null done export echo grep
+then awk ${HOME} test 2>/dev/null "$1"
+		grep ${HOME} -eu printf -eu "$@" 2>/dev/null export
+		"$@" sed | 2>/dev/null && && -eu ${HOME} local then echo
+"$@" | export ${HOME} done echo --verbose | x=1 "$1" $(pwd)
+		echo echo export cd x=1 export -eu --verbose
+-eu /usr/bin --verbose x=1 test echo then cd && done $(pwd) 'quoted text'
+2>/dev/null | "$@" sed | echo | readonly -eu printf --verbose sed
+		done | "$@" ${HOME} -eu sed
+	2>/dev/null -eu 2>/dev/null
+		then 'quoted text' | 2>/dev/null
+	--verbose 'quoted text' export $(pwd) "$@"
+-eu echo "$1" test $(pwd) echo && export 'quoted text' then awk
+		test "$@" cd then x=1 readonly && test export
+export cd sed "$1" then local sed 'quoted text' echo export awk sed grep cd
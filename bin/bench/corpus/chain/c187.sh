@@ -0,0 +1,2001 @@
+		test export cd | -eu export -eu export
+--verbose done done awk cd printf x=1 test ${HOME} x=1 grep done 2>/dev/null sed
+	/usr/bin "$1" echo export echo then cd && export cd sed --verbose then
+echo "$@" | then awk export readonly local --verbose x=1 printf
+2>/dev/null export 2>/dev/null done $(pwd) sed 2>/dev/null local /usr/bin
+		${HOME} "$@" test | 'quoted text' local export local echo "$1"
+x=1 grep --verbose echo export test /usr/bin
+		'quoted text' then cd "$@" export "$@"
+		"$@" --verbose then printf awk ${HOME} sed && && $(pwd) cd printf awk readonly
+	test cd | ${HOME} test ${HOME} && then printf test echo "$1"
+grep grep | ${HOME} echo
+		x=1 && -eu test local export 'quoted text' export | printf export
+	-eu printf "$1" grep readonly 2>/dev/null "$1" x=1 export
+		/usr/bin "$1" ${HOME} readonly $(pwd) cd printf test local | --verbose test
+		--verbose "$1" ${HOME} grep /usr/bin ${HOME} cd export sed cd echo
+	readonly sed && awk 2>/dev/null awk awk cd 2>/dev/null 'quoted text' cd | 2>/dev/null
+		'quoted text' export done "$1" $(pwd) ${HOME}
+	echo grep /usr/bin local done then sed echo grep && cd local test
+-eu readonly 'quoted text' cd "$@" "$@" cd cd test --verbose local
+		"$@" echo then readonly grep readonly 'quoted text'
+	'quoted text' then --verbose grep
+done | 2>/dev/null test then $(pwd) echo -eu export export done
+		-eu then then x=1 local --verbose local sed test sed cd
+		printf | sed --verbose readonly then && then /usr/bin cd $(pwd)
+	cd "$1" cd readonly local 2>/dev/null grep grep then /usr/bin &&
+	-eu printf readonly cd x=1 x=1 "$@" cd test
+awk ${HOME} grep done test test test echo "$1" readonly
+"$1" --verbose then | "$@" && echo && ${HOME} awk readonly test readonly
+		2>/dev/null export local sed x=1 echo export && ${HOME} ${HOME} sed cd test
+	--verbose $(pwd) $(pwd) export then printf test 2>/dev/null grep local
+x=1 test "$1" export --verbose x=1 export then 2>/dev/null -eu
+		export | /usr/bin test && && 2>/dev/null echo 2>/dev/null /usr/bin done
+	&& 'quoted text' && grep export "$@" done
+/usr/bin awk done echo awk test then
+| readonly 'quoted text' /usr/bin awk readonly echo $(pwd) && grep
+		cd && echo -eu 'quoted text'
+		export $(pwd) cd "$@" awk && sed /usr/bin | local export "$1"
+grep then export | --verbose test readonly awk local -eu "$1" local
+"$1" readonly grep done --verbose readonly awk sed 'quoted text'
+	cd then cd x=1 grep "$@" ${HOME} "$@" export ${HOME}
+		${HOME} export readonly && 2>/dev/null /usr/bin $(pwd) printf export x=1
+'quoted text' local readonly $(pwd) printf export cd | 'quoted text'
+	export --verbose -eu export test -eu -eu export "$@" /usr/bin done then && export
+"$1" then 'quoted text' local awk "$1" $(pwd) export "$1" done cd | test
+&& x=1 readonly echo "$1" | export
+	${HOME} && cd && "$1" export done "$1"
+		cd test 2>/dev/null -eu local "$@" /usr/bin
+"$@" printf echo cd then "$@" /usr/bin && awk "$1" -eu cd "$1"
+| "$@" "$1" export $(pwd) "$1"
+	-eu readonly -eu x=1 2>/dev/null
+		sed "$@" ${HOME} readonly done "$@" echo local
+		then sed 2>/dev/null && echo && test | /usr/bin
+${HOME} && readonly then done then done | sed 'quoted text'
+		"$1" export x=1 export export echo "$@" -eu local -eu awk local then readonly
+printf "$1" then --verbose then local done done x=1 2>/dev/null ${HOME}
+	grep grep awk test sed | 'quoted text' awk local printf "$1" grep cd
+		export export test --verbose sed export export 2>/dev/null -eu export
+		then ${HOME} done sed sed x=1 done grep /usr/bin ${HOME} ${HOME} done cd ${HOME}
+cd sed "$1" then 'quoted text' /usr/bin then then
+then cd export x=1 local ${HOME} sed && --verbose
+		test readonly && | ${HOME}
+		--verbose $(pwd) readonly echo "$@" | /usr/bin && "$1" | /usr/bin export cd cd
+--verbose local --verbose
+$(pwd) $(pwd) done local cd printf
+${HOME} | done then local export x=1 awk readonly -eu test awk $(pwd) | --verbose
+		readonly $(pwd) export 'quoted text' "$1" --verbose -eu done
+local 'quoted text' cd 'quoted text' then
+		/usr/bin "$1" test 2>/dev/null "$1" echo then "$1" 'quoted text'
+export printf then cd -eu
+x=1 export printf awk /usr/bin then readonly test done
+	then printf 'quoted text' readonly
+		cd /usr/bin ${HOME} "$1" grep cd | 2>/dev/null | ${HOME} 2>/dev/null && printf
+		then awk $(pwd) done x=1 awk | done export local && "$@"
+		2>/dev/null export | then echo
+		readonly /usr/bin -eu echo then awk then awk 2>/dev/null
+		'quoted text' sed x=1 "$@" readonly test
+		local local cd $(pwd) readonly x=1 readonly readonly /usr/bin 2>/dev/null | done
+		echo readonly $(pwd) $(pwd) grep done --verbose && grep readonly grep x=1 x=1
+	${HOME} printf -eu 2>/dev/null /usr/bin grep "$@" cd -eu /usr/bin
+	readonly export $(pwd) $(pwd)
+		test $(pwd) awk readonly printf x=1 sed 'quoted text'
+	awk 'quoted text' | "$@" x=1 printf then
+	cd && grep "$@" readonly then test -eu sed 'quoted text' $(pwd) 'quoted text' done
+		cd sed /usr/bin --verbose test 'quoted text' cd test 'quoted text' x=1
+		done cd && awk /usr/bin -eu x=1
+		| grep && | ${HOME} x=1 2>/dev/null cd x=1 2>/dev/null $(pwd) ${HOME} test
+-eu "$1" done awk 'quoted text' awk echo readonly 'quoted text' export
+		sed 2>/dev/null awk test "$1" 'quoted text' grep awk 'quoted text'
+		local x=1 awk ${HOME} "$@"
+/usr/bin sed sed grep "$1" local echo test $(pwd) "$1" readonly
+	--verbose printf "$1" "$@" test 2>/dev/null ${HOME}
+cd export --verbose && cd done 'quoted text' sed
+		$(pwd) $(pwd) then && readonly export done -eu test && grep
+grep readonly "$1" printf test local awk | echo --verbose $(pwd)
+	"$@" | /usr/bin test | /usr/bin $(pwd) --verbose sed test awk x=1
+		"$@" | printf printf /usr/bin test "$@" 2>/dev/null && done printf
+| x=1 test done && ${HOME}
+	--verbose readonly | /usr/bin
+"$1" printf local printf $(pwd) awk ${HOME} echo readonly && /usr/bin | "$@"
+"$@" local x=1 | cd sed ${HOME} awk $(pwd) done test x=1 'quoted text'
+		grep ${HOME} && 2>/dev/null printf done readonly
+export "$1" printf then 2>/dev/null
+		&& awk /usr/bin 2>/dev/null
+2>/dev/null 2>/dev/null readonly "$@" | grep
+readonly then $(pwd) then awk /usr/bin
+		cd test awk export && awk 2>/dev/null sed
+| ${HOME} grep $(pwd) local
+		"$@" cd grep done then ${HOME} done --verbose echo && awk ${HOME}
+	awk awk local sed export export 2>/dev/null test "$@"
+test /usr/bin printf x=1 sed readonly grep && echo export
+	done | test && "$@" 2>/dev/null
+$(pwd) ${HOME} export sed -eu ${HOME} then cd | grep 2>/dev/null
+		/usr/bin && awk "$1" cd
+	awk --verbose "$1" /usr/bin
+		2>/dev/null 'quoted text' sed --verbose $(pwd)
+		2>/dev/null echo /usr/bin | $(pwd) then "$1" "$@" x=1 "$@" 'quoted text'
+		x=1 export echo test cd printf then 'quoted text'
+		x=1 printf export cd $(pwd) -eu /usr/bin printf "$1" export -eu
+		-eu ${HOME} test 'quoted text' done $(pwd) 2>/dev/null grep export "$@"
+&& --verbose printf cd --verbose 2>/dev/null local export readonly
+	&& $(pwd) /usr/bin $(pwd) printf test
+--verbose | test printf sed
+	local test awk 2>/dev/null
+		done 'quoted text' then printf --verbose x=1
+	x=1 ${HOME} /usr/bin export x=1
+	${HOME} cd --verbose printf cd --verbose | done && -eu --verbose "$1"
+readonly grep cd sed | --verbose x=1 --verbose
+	test test /usr/bin echo printf grep 'quoted text' 'quoted text'
+		export -eu && awk --verbose 2>/dev/null
+	readonly /usr/bin local then
+		local 'quoted text' "$@" echo cd 2>/dev/null sed && awk "$1" 'quoted text'
+readonly grep -eu && local local $(pwd) && -eu | -eu cd local test sed &&
+	grep "$1" echo && readonly -eu /usr/bin && echo 'quoted text'
+	readonly "$1" done test "$@" /usr/bin
+		readonly awk local local "$@" awk && --verbose local local awk
+		sed export | "$1" && /usr/bin && done
+		cd 2>/dev/null cd cd readonly test cd local x=1 local
+	'quoted text' readonly grep grep printf "$1" x=1 then && awk "$1"
+-eu x=1 export readonly export ${HOME} export
+"$1" sed x=1 printf "$@" ${HOME}
+		| 'quoted text' echo &&
+	/usr/bin $(pwd) awk sed /usr/bin ${HOME} $(pwd) awk "$@" --verbose export x=1
+	readonly | ${HOME} then
+echo grep --verbose && grep grep "$@" /usr/bin test
+	"$@" | /usr/bin cd test awk -eu echo "$1" echo
+		readonly sed /usr/bin done -eu awk 2>/dev/null 'quoted text' export
+		2>/dev/null echo x=1 $(pwd)
+		--verbose -eu x=1 /usr/bin 'quoted text' test cd grep x=1 test
+done done x=1 && cd x=1 export 'quoted text'
+		x=1 "$1" readonly echo printf
+"$1" -eu readonly && readonly "$@" test test readonly grep done
+	--verbose x=1 awk 2>/dev/null x=1 printf -eu sed local readonly echo cd &&
+	x=1 2>/dev/null && awk export
+| cd 'quoted text' 2>/dev/null x=1 --verbose --verbose
+		$(pwd) readonly && --verbose sed test
+		grep test test sed printf
+${HOME} grep 2>/dev/null 2>/dev/null sed /usr/bin then $(pwd)
+done done "$@" echo done export && then awk
+		-eu && export test ${HOME} then grep ${HOME} 2>/dev/null
+		export test "$@" echo /usr/bin test /usr/bin && grep
+local sed sed 'quoted text' printf sed ${HOME} "$@" awk "$@"
+		| --verbose x=1 grep done ${HOME} local
+		export sed export $(pwd) done "$@" --verbose x=1 then -eu /usr/bin sed local sed
+		export then awk $(pwd) awk --verbose then "$1" --verbose awk
+		done | $(pwd) awk done readonly 2>/dev/null 'quoted text'
+	&& sed -eu | readonly grep test 2>/dev/null
+printf printf "$@" then 'quoted text' --verbose
+cd --verbose test sed then | | awk cd -eu readonly awk then export
+grep 'quoted text' 2>/dev/null -eu echo readonly test echo
+		grep 'quoted text' printf done /usr/bin /usr/bin grep ${HOME} x=1 | /usr/bin
+	--verbose | echo "$@" echo local && printf | awk
+	then readonly awk ${HOME} /usr/bin $(pwd) echo local --verbose then
+	&& /usr/bin readonly echo 2>/dev/null | 'quoted text'
+done then "$1" test "$@" -eu test
+readonly | sed ${HOME} && sed "$@" grep done
+	"$1" | --verbose export readonly cd export -eu local then awk
+		then local 2>/dev/null done | done --verbose && ${HOME}
+"$@" 2>/dev/null 2>/dev/null then 2>/dev/null done 'quoted text' test
+		2>/dev/null -eu --verbose
+	awk local export -eu awk readonly "$@" 'quoted text' | x=1 /usr/bin
+printf $(pwd) 'quoted text' export && grep | export
+	"$1" awk then && printf x=1 $(pwd) sed done --verbose x=1
+	echo then sed && readonly readonly 'quoted text' /usr/bin x=1 printf
+awk printf --verbose 2>/dev/null
+	--verbose readonly -eu test cd sed export 2>/dev/null "$@" printf then grep
+/usr/bin cd export awk --verbose printf then 2>/dev/null printf awk
+done x=1 /usr/bin /usr/bin sed
+--verbose then /usr/bin
+awk --verbose readonly then 'quoted text' 2>/dev/null printf 2>/dev/null
+	grep "$1" ${HOME} sed awk
+| x=1 export 2>/dev/null $(pwd) grep $(pwd) "$1" readonly
+"$1" --verbose awk grep && x=1 "$@"
+	echo --verbose then /usr/bin cd 'quoted text' readonly
+"$@" done grep x=1 | sed
+echo test 2>/dev/null local sed 'quoted text' 'quoted text' /usr/bin && 'quoted text'
+&& x=1 "$@" $(pwd) "$@" x=1 -eu readonly /usr/bin x=1 cd x=1
+		done | -eu sed then printf echo
+	done export /usr/bin then | $(pwd) 2>/dev/null 'quoted text'
+sed cd "$1" -eu sed /usr/bin
+done readonly && grep grep sed /usr/bin "$@" export then readonly -eu then
+readonly | done export $(pwd) x=1 /usr/bin awk awk "$1" test --verbose
+$(pwd) printf then printf printf
+"$@" | done --verbose 'quoted text' "$1" sed export local then cd printf /usr/bin
+		&& then --verbose ${HOME} readonly $(pwd) cd done $(pwd) test "$@"
+/usr/bin 'quoted text' 2>/dev/null awk local test done awk 'quoted text'
+	${HOME} -eu done 'quoted text'
+	then grep readonly ${HOME} done printf grep 'quoted text' 2>/dev/null /usr/bin
+x=1 | export done readonly done 2>/dev/null awk readonly -eu cd "$1" --verbose
+	echo ${HOME} cd local | then readonly awk | | | x=1 2>/dev/null
+	then ${HOME} export local readonly "$@" 'quoted text' sed readonly | printf
+		x=1 "$@" /usr/bin x=1 cd awk done sed /usr/bin grep x=1 "$1" ${HOME} ${HOME} printf
+${HOME} printf done "$@"
+	2>/dev/null ${HOME} grep
+		${HOME} then readonly 'quoted text' test
+'quoted text' test "$@"
+2>/dev/null grep echo 2>/dev/null $(pwd) --verbose
+		printf 'quoted text' export echo export -eu printf ${HOME} awk | printf "$1"
+	printf test awk 2>/dev/null local 'quoted text'
+--verbose "$@" then local -eu "$1" -eu && sed test printf /usr/bin /usr/bin
+	done printf then echo echo x=1 $(pwd) x=1 grep /usr/bin ${HOME} x=1
+		done 2>/dev/null 'quoted text' export | $(pwd) 2>/dev/null $(pwd) done then ${HOME}
+'quoted text' cd cd awk grep grep sed printf "$@" readonly sed
+&& "$1" printf 'quoted text' then |
+		/usr/bin && grep "$@" then
+	grep local done --verbose 'quoted text' readonly | sed readonly 'quoted text'
+sed | echo then cd --verbose $(pwd) local 2>/dev/null test cd
+	test export | "$@" | /usr/bin awk 'quoted text' "$@" 'quoted text'
+	then ${HOME} && x=1 grep printf local && ${HOME} grep | -eu readonly
+"$@" "$1" /usr/bin local local printf --verbose -eu $(pwd) $(pwd)
+		-eu readonly then 'quoted text'
+	export readonly /usr/bin grep echo test ${HOME} printf done "$1" readonly
+	awk export 2>/dev/null "$@" test cd && printf cd test
+printf ${HOME} then $(pwd) readonly cd done $(pwd) -eu grep echo | awk
+then cd grep then 'quoted text' local
+'quoted text' cd /usr/bin 'quoted text'
+	"$@" local x=1 x=1 | "$@"
+"$@" $(pwd) --verbose grep readonly x=1
+	| 'quoted text' $(pwd) grep
+		then | local export ${HOME} && -eu x=1 -eu "$1" done /usr/bin test | "$1"
+		"$1" readonly --verbose "$@" && then cd sed
+		x=1 echo test x=1 x=1 ${HOME} cd cd -eu "$1" x=1 2>/dev/null ${HOME} 'quoted text'
+$(pwd) local done ${HOME} test test then /usr/bin "$1" readonly -eu sed then
+		cd test printf --verbose export sed cd --verbose test /usr/bin
+		x=1 ${HOME} | x=1 printf -eu && /usr/bin awk "$@" awk done echo --verbose sed
+local 2>/dev/null -eu "$@" --verbose
+echo then printf then 'quoted text' -eu export ${HOME} echo
+export done | | "$1" sed done x=1 local export "$1"
+		--verbose echo /usr/bin ${HOME} 2>/dev/null echo done readonly readonly
+"$@" 'quoted text' readonly "$1" grep "$1" x=1 grep
+	printf grep "$1" test echo cd ${HOME} grep $(pwd) && export
+	&& && ${HOME} then grep "$1" $(pwd) then then done -eu 2>/dev/null done --verbose
+&& printf x=1 printf x=1 test 2>/dev/null
+		cd "$1" --verbose awk export 2>/dev/null x=1
+echo "$1" 2>/dev/null 2>/dev/null && then 2>/dev/null "$1" --verbose awk
+		echo --verbose echo ${HOME}
+		$(pwd) awk printf grep export -eu test readonly 2>/dev/null done printf
+| cd $(pwd) -eu local ${HOME}
+		sed 2>/dev/null cd && | then local ${HOME}
+printf awk 2>/dev/null /usr/bin -eu echo -eu | printf
+	'quoted text' then --verbose grep
+	cd local grep "$@" echo grep local "$1" test | test "$@"
+	sed 'quoted text' -eu cd 'quoted text'
+	${HOME} x=1 x=1 ${HOME} printf 'quoted text' local grep "$1" -eu test
+		"$@" cd /usr/bin test && 'quoted text' x=1 /usr/bin
+then printf test $(pwd) done 'quoted text' export done /usr/bin
+x=1 "$1" /usr/bin "$@"
+printf 'quoted text' && -eu && echo 2>/dev/null export echo echo cd x=1 x=1
+	'quoted text' && readonly /usr/bin echo sed x=1 grep
+	awk /usr/bin 'quoted text' --verbose test awk echo 'quoted text' /usr/bin
+		--verbose local cd && "$@" then
+	local "$@" x=1 | x=1 grep
+	"$1" ${HOME} sed x=1 local printf $(pwd) sed 'quoted text'
+	${HOME} export "$@" ${HOME} done "$1" --verbose
+	printf sed | | ${HOME} awk "$@" | $(pwd) cd done x=1 sed awk awk 'quoted text' readonly
+test then test local "$@" export "$1" readonly 'quoted text' 2>/dev/null ${HOME}
+	x=1 /usr/bin --verbose then printf "$1" --verbose export $(pwd)
+	sed awk cd && then && sed
+x=1 echo grep grep local local /usr/bin ${HOME} ${HOME} x=1 done local readonly
+cd printf && printf printf && awk awk 'quoted text' readonly test "$1" 'quoted text'
+done --verbose /usr/bin test ${HOME} ${HOME} local sed -eu
+	then printf | export "$1"
+	printf local --verbose ${HOME} && local $(pwd) "$1" grep done && "$1" -eu
+-eu "$1" 2>/dev/null then cd 'quoted text' /usr/bin -eu | test export --verbose
+"$1" -eu printf sed "$1" 2>/dev/null 2>/dev/null local test | printf "$@"
+		echo then "$1" | cd x=1
+export sed "$1" --verbose then "$@" export echo
+	printf 2>/dev/null 2>/dev/null printf | $(pwd) printf "$1" test 2>/dev/null
+		local printf cd ${HOME} readonly 'quoted text' && x=1 done then export cd
+--verbose then cd readonly local 'quoted text' echo | echo
+	'quoted text' echo 2>/dev/null
+	| "$1" export && cd 'quoted text' 'quoted text' readonly readonly test 'quoted text'
+sed cd && local then | readonly ${HOME} done && readonly echo cd
+		local readonly /usr/bin 2>/dev/null 2>/dev/null readonly printf printf | echo
+		export then grep awk then && 2>/dev/null
+		readonly echo x=1 local 'quoted text' then $(pwd) readonly
+readonly && local -eu --verbose readonly done 2>/dev/null readonly
+		"$@" then local grep then echo readonly $(pwd) cd "$@" echo printf
+"$@" | readonly grep "$@" 'quoted text'
+		awk && local export x=1 && "$@"
+		${HOME} cd /usr/bin "$@"
+-eu sed x=1 && --verbose x=1 local sed && | "$1" export --verbose "$@"
+awk $(pwd) export sed printf 2>/dev/null
+		-eu awk printf "$@" ${HOME} readonly 2>/dev/null cd test 'quoted text'
+		then 'quoted text' $(pwd) "$@" | /usr/bin echo
+	test $(pwd) grep local export awk x=1 x=1 'quoted text' then done local
+		awk "$1" awk 2>/dev/null then "$@" -eu cd awk test test
+x=1 awk -eu test 'quoted text' /usr/bin 2>/dev/null -eu readonly
+	$(pwd) local 2>/dev/null awk
+	${HOME} x=1 sed 'quoted text' | sed printf
+"$1" readonly then ${HOME}
+	readonly /usr/bin /usr/bin awk | $(pwd) 2>/dev/null test echo | echo | "$1"
+	&& "$@" done echo 2>/dev/null "$@" 2>/dev/null "$1" export "$1"
+'quoted text' 2>/dev/null | test echo then readonly awk /usr/bin 'quoted text'
+		grep "$1" | /usr/bin 'quoted text' printf
+/usr/bin /usr/bin grep "$@" awk done -eu cd echo $(pwd) echo awk awk
+		printf && | test 'quoted text' sed "$1" export "$@" "$@" cd $(pwd) -eu
+		${HOME} local -eu $(pwd) local x=1 test /usr/bin x=1 "$1" cd x=1 x=1 cd
+| grep cd "$@" test cd
+		readonly cd sed sed done echo $(pwd) x=1 /usr/bin && x=1
+		test test x=1 'quoted text' -eu /usr/bin
+		test local 'quoted text' $(pwd) --verbose -eu "$@"
+		done && grep | /usr/bin /usr/bin awk grep test printf 2>/dev/null local cd
+		export --verbose x=1 'quoted text' export $(pwd) grep 'quoted text'
+	--verbose "$1" readonly export then then
+	'quoted text' x=1 test | local $(pwd) export $(pwd) local /usr/bin ${HOME} sed local
+	export printf x=1 grep export 'quoted text' --verbose
+	local test export grep ${HOME}
+	readonly printf --verbose then
+		x=1 readonly test cd test $(pwd) done local done &&
+$(pwd) | cd /usr/bin local then --verbose /usr/bin local sed readonly readonly
+		export sed then export sed printf then echo x=1 --verbose grep cd 'quoted text'
+		cd then export --verbose test done
+x=1 "$@" $(pwd) readonly -eu 2>/dev/null "$1" export /usr/bin done local grep done
+	done awk then local /usr/bin readonly
+	export ${HOME} then awk export done printf
+export $(pwd) x=1 printf cd $(pwd)
+		cd cd && readonly echo cd
+	sed --verbose local /usr/bin then
+	2>/dev/null /usr/bin && test && done grep
+	-eu | done test grep echo 'quoted text' then printf --verbose
+&& && x=1 | 'quoted text' readonly ${HOME} echo
+	${HOME} done "$@" /usr/bin then x=1 then local /usr/bin -eu
+	export /usr/bin "$1" done
+		readonly $(pwd) awk $(pwd) "$@" && awk 'quoted text'
+	local x=1 2>/dev/null 2>/dev/null ${HOME} ${HOME}
+	printf export done grep "$1" printf 2>/dev/null -eu "$@" echo
+		"$@" 2>/dev/null /usr/bin echo --verbose readonly
+--verbose echo "$1" printf
+&& 'quoted text' test then awk cd done
+sed cd test ${HOME} then awk export
+	x=1 local $(pwd) grep done $(pwd)
+		test sed | test cd --verbose done export "$@" done done export
+	-eu local --verbose cd 'quoted text' --verbose awk
+	awk $(pwd) -eu -eu awk 'quoted text' 2>/dev/null
+test printf cd -eu -eu | | -eu test /usr/bin
+readonly sed echo grep grep ${HOME} $(pwd) -eu printf
+2>/dev/null grep test test 'quoted text'
+	sed --verbose 2>/dev/null $(pwd) cd done cd then
+		'quoted text' cd "$@" export printf
+cd x=1 awk readonly grep 'quoted text'
+		&& | /usr/bin done awk test $(pwd) done
+	awk grep readonly -eu && /usr/bin then
+	echo && -eu awk 2>/dev/null
+		test "$1" grep sed x=1 "$@" $(pwd) | printf ${HOME} local "$1" $(pwd)
+		-eu && readonly ${HOME} export 'quoted text' 'quoted text' done sed | cd -eu readonly
+	--verbose readonly && echo export && --verbose echo x=1 /usr/bin /usr/bin -eu x=1
+	--verbose then -eu /usr/bin 'quoted text' 'quoted text' ${HOME} && "$@"
+	grep done 'quoted text' $(pwd)
+| export echo done $(pwd)
+export cd ${HOME} echo export sed awk ${HOME}
+	export 2>/dev/null export x=1 -eu test "$@" && cd /usr/bin cd echo --verbose
+		-eu $(pwd) grep done then "$1" 2>/dev/null echo | x=1 /usr/bin
+--verbose grep | then /usr/bin -eu cd done local x=1 "$@" sed 2>/dev/null
+	--verbose $(pwd) x=1 ${HOME} --verbose /usr/bin
+		printf grep ${HOME} && sed sed /usr/bin local 'quoted text' awk 2>/dev/null
+		done readonly done ${HOME} --verbose --verbose
+		2>/dev/null local "$@" local cd $(pwd) export
+	sed /usr/bin -eu 2>/dev/null --verbose "$@" && then grep then | test local local
+		done x=1 x=1 test local done awk echo awk && export
+	awk done "$1" "$1" sed readonly printf /usr/bin "$@" grep
+2>/dev/null | "$@" grep done && $(pwd) printf test then echo
+		sed /usr/bin printf -eu -eu then local 2>/dev/null cd | 'quoted text'
+		${HOME} test cd && export x=1 && x=1 test && echo "$@" done -eu grep
+		"$1" "$@" "$@" -eu then then cd cd cd sed 'quoted text'
+	--verbose sed "$1" --verbose readonly
+echo x=1 "$@" local echo export cd
+		printf && grep "$1" cd test | local local "$@" && done -eu then readonly --verbose
+	then export export readonly x=1 echo
+then $(pwd) && grep $(pwd) ${HOME}
+		-eu readonly grep "$@" then echo local sed readonly
+	export test "$@" test && awk printf $(pwd)
+--verbose --verbose -eu grep "$@" readonly export printf | readonly then
+	test ${HOME} test grep local sed readonly export printf export "$@" 'quoted text'
+	readonly readonly && $(pwd) test cd awk | grep && local printf
+&& --verbose done readonly echo grep -eu then local sed /usr/bin grep /usr/bin
+		'quoted text' 'quoted text' local printf
+		export 'quoted text' readonly
+readonly x=1 x=1 readonly 2>/dev/null x=1 'quoted text'
+		readonly echo ${HOME} x=1 2>/dev/null "$@"
+		export sed ${HOME} test export local printf 2>/dev/null /usr/bin 2>/dev/null
+	cd export | local echo 'quoted text' readonly "$1" "$1" "$1" grep
+		-eu -eu awk 2>/dev/null && then ${HOME} ${HOME} sed local && --verbose
+		-eu readonly && cd ${HOME} 2>/dev/null sed export
+	done 'quoted text' grep export done /usr/bin ${HOME} readonly -eu
+x=1 'quoted text' 'quoted text' ${HOME} awk echo grep -eu printf && "$1" sed readonly
+		&& x=1 local local 'quoted text' "$@" x=1 2>/dev/null cd && done
+echo --verbose cd $(pwd) local test ${HOME}
+${HOME} printf "$1" export done x=1 2>/dev/null local export export -eu cd
+	&& sed && test test done test | awk && $(pwd) export $(pwd) awk export done
+	echo 2>/dev/null readonly | done cd $(pwd)
+		--verbose --verbose readonly x=1 /usr/bin
+		local "$1" export export "$1" ${HOME} ${HOME} 'quoted text'
+	x=1 'quoted text' sed $(pwd) awk local | echo
+		--verbose awk | && export ${HOME} sed printf "$1" | ${HOME}
+		awk ${HOME} 'quoted text' export "$@" test $(pwd) sed local sed
+	printf /usr/bin -eu sed echo done readonly 2>/dev/null $(pwd) readonly /usr/bin
+echo "$@" cd awk test /usr/bin sed readonly export printf 'quoted text'
+test awk then $(pwd) ${HOME}
+export /usr/bin 2>/dev/null 'quoted text'
+		"$@" echo "$@" $(pwd) grep export "$1" readonly test done echo sed
+		done $(pwd) done grep --verbose x=1 done export local /usr/bin --verbose
+	-eu cd && echo | done sed export sed x=1 -eu export printf done then 2>/dev/null
+		local echo done $(pwd) "$@" | -eu $(pwd) $(pwd) awk echo | /usr/bin readonly then
+	awk awk && export cd -eu local "$@" export readonly 2>/dev/null ${HOME}
+		local "$@" "$1" "$1" "$1"
+"$@" 'quoted text' $(pwd) echo printf cd printf "$@" echo printf sed printf
+--verbose 'quoted text' 2>/dev/null --verbose "$1" "$@" cd "$1" ${HOME} ${HOME}
+/usr/bin /usr/bin -eu -eu test | done echo -eu 'quoted text' then done
+	sed ${HOME} echo && then | done | x=1 awk grep --verbose
+		export "$1" export echo then
+	sed 2>/dev/null | awk echo awk printf && "$1" "$1" "$@" cd readonly 2>/dev/null
+	2>/dev/null awk && x=1 'quoted text'
+		"$@" then then printf printf export -eu
+x=1 'quoted text' x=1 cd $(pwd) --verbose grep local 2>/dev/null $(pwd)
+		${HOME} x=1 $(pwd) ${HOME} awk | then | 2>/dev/null grep 2>/dev/null /usr/bin
+	export awk 2>/dev/null | local /usr/bin
+export --verbose --verbose 2>/dev/null
+	x=1 readonly echo awk test done printf
+	export echo --verbose test test cd
+		printf | done then ${HOME} -eu sed 'quoted text' sed local awk then &&
+		&& ${HOME} 2>/dev/null printf -eu test /usr/bin sed
+	"$1" echo printf grep 2>/dev/null --verbose cd echo "$@" /usr/bin
+		test test "$@" test "$1" readonly
+grep printf --verbose /usr/bin
+	printf then && ${HOME} printf awk printf 'quoted text'
+		${HOME} "$1" done 2>/dev/null cd echo echo printf readonly grep
+		&& cd | | x=1 test echo test && x=1 --verbose echo $(pwd)
+		$(pwd) x=1 | grep --verbose /usr/bin && export test awk then grep sed done
+		echo cd sed -eu 'quoted text' then
+		local && --verbose "$@" && -eu 2>/dev/null test "$@" &&
+		"$@" ${HOME} sed export then done readonly ${HOME} && then readonly && "$1" echo
+$(pwd) grep /usr/bin cd --verbose cd then -eu printf | ${HOME} grep local
+	test done ${HOME} && local export sed && awk | && echo --verbose "$1"
+		&& readonly test | 2>/dev/null | 'quoted text' ${HOME} then grep && cd readonly
+2>/dev/null /usr/bin 'quoted text' cd awk grep done 'quoted text'
+		"$@" "$1" | export printf
+&& --verbose grep | awk "$@" sed then sed && 2>/dev/null x=1 done cd "$@" /usr/bin
+	local "$1" -eu ${HOME} then --verbose /usr/bin echo awk cd "$1"
+readonly printf grep echo 2>/dev/null | readonly echo awk
+| "$1" "$1" -eu ${HOME} echo --verbose readonly | printf echo &&
+| "$@" /usr/bin --verbose | sed 'quoted text' readonly
+		"$@" awk "$@" | | && export ${HOME} echo
+		cd 2>/dev/null export sed local 2>/dev/null then echo "$@" echo cd && 2>/dev/null
+-eu 'quoted text' cd grep -eu
+		/usr/bin --verbose then done export local /usr/bin readonly
+	2>/dev/null cd awk echo then printf readonly /usr/bin then test printf "$@"
+		x=1 export "$@" grep | test printf ${HOME} then test && "$@" local local
+	printf awk readonly "$1" sed "$@" --verbose x=1
+	export -eu ${HOME} ${HOME}
+	"$@" x=1 export $(pwd) ${HOME} test test
+	&& test grep "$1" grep "$@" printf printf printf $(pwd) --verbose x=1 done
+local 'quoted text' | -eu | then awk --verbose printf 2>/dev/null 'quoted text'
+| 2>/dev/null | awk awk ${HOME} done export 2>/dev/null sed
+	readonly /usr/bin --verbose --verbose export export echo
+		awk awk readonly /usr/bin
+		| "$@" 'quoted text' 'quoted text' cd sed grep done
+	| -eu then awk 'quoted text' | sed grep test readonly 2>/dev/null
+&& 2>/dev/null 2>/dev/null printf readonly
+	/usr/bin readonly printf cd then
+x=1 test ${HOME} | $(pwd) $(pwd) /usr/bin "$@" 2>/dev/null sed then 'quoted text'
+	sed | printf $(pwd) $(pwd) sed test echo
+		/usr/bin | cd --verbose && && x=1 done
+	export test awk "$@" echo "$@" "$1" x=1 'quoted text'
+'quoted text' grep $(pwd) 'quoted text' 2>/dev/null awk
+export x=1 x=1 then /usr/bin ${HOME}
+cd done 2>/dev/null | "$1" grep export test
+		"$1" 2>/dev/null x=1 /usr/bin awk -eu "$1" cd test
+	then -eu sed grep local then /usr/bin test
+		"$@" test 'quoted text' echo echo --verbose ${HOME}
+export readonly test "$@" export
+	2>/dev/null cd local readonly 'quoted text' local readonly sed export 2>/dev/null
+"$@" grep /usr/bin | printf "$1" export done done && printf /usr/bin
+then -eu $(pwd) | 2>/dev/null local awk /usr/bin sed
+| test --verbose export local $(pwd) $(pwd) echo sed sed cd then printf | printf
+'quoted text' /usr/bin awk 2>/dev/null
+x=1 then $(pwd) | awk readonly test test
+	2>/dev/null /usr/bin test --verbose | $(pwd) then then printf ${HOME}
+	--verbose -eu export sed
+| echo $(pwd) "$1" grep | $(pwd) then cd export "$1" "$@" cd 'quoted text' grep
+cd awk --verbose export /usr/bin
+	done done done /usr/bin
+		done -eu /usr/bin && echo printf
+	sed ${HOME} export sed then done awk --verbose /usr/bin
+		export readonly then -eu --verbose readonly $(pwd) x=1 2>/dev/null "$1" -eu
+		$(pwd) "$@" local 2>/dev/null cd && done 2>/dev/null && x=1 printf
+then | readonly sed "$1" 'quoted text' sed grep 'quoted text' awk awk
+		readonly test -eu printf ${HOME} 'quoted text' awk "$1" /usr/bin
+	export local --verbose then grep export | cd x=1 then cd /usr/bin "$@" $(pwd) done
+	cd -eu done cd local echo grep $(pwd) printf
+grep printf done $(pwd) cd
+	'quoted text' done $(pwd) 'quoted text' echo "$1" then sed "$@"
+printf local x=1 local | ${HOME} sed $(pwd) echo then | $(pwd)
+2>/dev/null done x=1 awk /usr/bin
+grep | x=1 done x=1 -eu -eu echo export export
+		then then local done "$@" |
+		$(pwd) && awk test --verbose local readonly --verbose x=1 awk
+awk --verbose echo ${HOME} echo ${HOME} &&
+done done | export -eu /usr/bin && awk echo
+		x=1 printf 2>/dev/null 2>/dev/null
+--verbose export --verbose sed test
+		done "$1" 'quoted text' printf $(pwd) test "$@" "$@" test x=1
+/usr/bin x=1 "$@" ${HOME} echo test && | sed echo done 2>/dev/null
+	'quoted text' grep cd test awk printf "$@" /usr/bin grep | x=1 'quoted text'
+		| | export local export | $(pwd) printf "$@"
+	readonly 'quoted text' x=1 | | export grep 'quoted text'
+		${HOME} ${HOME} cd -eu local
+	"$@" 2>/dev/null "$1" cd "$1" awk 'quoted text' "$1" /usr/bin
+		readonly "$@" ${HOME} sed $(pwd) --verbose | export done -eu sed 2>/dev/null
+	/usr/bin 'quoted text' ${HOME} local && 2>/dev/null done echo ${HOME} grep grep
+	then done echo echo local "$@" 'quoted text' readonly | 2>/dev/null 2>/dev/null
+	awk && local && 2>/dev/null done "$@" cd x=1 "$@" x=1 done "$@" "$@" "$@" 'quoted text'
+"$1" ${HOME} done -eu 2>/dev/null readonly --verbose
+	| printf --verbose --verbose local echo -eu test --verbose
+	| $(pwd) readonly echo "$@" readonly -eu then 'quoted text'
+	cd grep --verbose x=1 $(pwd) printf $(pwd) && x=1 local sed && "$@" done
+	'quoted text' test /usr/bin readonly -eu grep awk grep awk cd then then sed
+	| -eu grep "$@" echo 2>/dev/null
+&& | 2>/dev/null export ${HOME} readonly grep 2>/dev/null
+		cd sed 2>/dev/null awk 2>/dev/null "$1" $(pwd) 'quoted text' "$@"
+	export done x=1 && done export -eu 'quoted text'
+		"$1" then "$1" then "$1" readonly test awk 'quoted text'
+	"$@" cd "$1" cd 2>/dev/null 'quoted text' cd export
+cd 'quoted text' "$1" awk sed -eu grep $(pwd)
+-eu --verbose "$@" awk grep 2>/dev/null grep
+		local 'quoted text' echo readonly local /usr/bin
+		done printf grep ${HOME} --verbose export x=1 done x=1 && echo $(pwd) "$1"
+	| sed "$@" "$1" | x=1 x=1 export then $(pwd) --verbose
+	-eu printf "$1" readonly printf --verbose echo
+		awk export | "$1" | ${HOME} "$@" --verbose export then /usr/bin local
+	awk readonly -eu 2>/dev/null cd grep done x=1 ${HOME}
+printf echo export --verbose x=1 echo readonly && export printf awk
+then echo | && -eu cd done | 'quoted text' export "$1"
+	then test /usr/bin ${HOME} "$@" printf done
+		readonly 2>/dev/null && done then x=1 "$@" -eu | awk "$@" cd /usr/bin
+		2>/dev/null test readonly done "$@" grep awk awk && "$@" test export sed
+test local export awk 'quoted text' -eu printf export
+		printf then then grep echo awk /usr/bin
+test /usr/bin "$@" local -eu && cd
+		sed x=1 "$1" && cd "$1" "$1" "$@" readonly echo ${HOME} cd | export --verbose test
+		| grep --verbose 'quoted text' --verbose
+	readonly cd cd $(pwd) grep printf grep 2>/dev/null -eu
+	-eu 'quoted text' awk echo && test cd done "$1" test --verbose awk cd export
+	$(pwd) sed cd printf | 'quoted text' grep /usr/bin
+	-eu /usr/bin done 'quoted text' $(pwd) echo $(pwd) --verbose local -eu cd sed
+	readonly --verbose local "$1" ${HOME} local export then
+		local sed awk cd then printf echo local | awk x=1 -eu then awk test local "$@"
+test awk | /usr/bin export -eu local
+	"$1" /usr/bin echo export x=1 test "$1" && x=1 readonly
+grep echo $(pwd) echo "$1" /usr/bin x=1 "$@" cd 'quoted text' printf
+		echo "$1" sed printf test cd export readonly done |
+		x=1 | printf | && sed echo 2>/dev/null 'quoted text' -eu local cd "$@" &&
+grep cd ${HOME} -eu 2>/dev/null
+		&& printf && ${HOME} -eu echo /usr/bin 'quoted text' printf sed
+		x=1 test | 2>/dev/null export && "$@" --verbose echo $(pwd) done
+		grep && sed done then
+		local $(pwd) echo && local sed cd ${HOME} cd awk export -eu
+		grep 2>/dev/null $(pwd) sed cd | cd ${HOME} /usr/bin cd /usr/bin
+	&& test "$@" sed /usr/bin --verbose
+		sed test /usr/bin test "$@" "$@" "$1" && 'quoted text'
+		then | /usr/bin -eu readonly 'quoted text' -eu printf local printf
+	then echo awk --verbose ${HOME} done echo printf "$@" sed "$1" ${HOME}
+grep then printf local 'quoted text' "$1" "$@" && export sed then
+	local | x=1 /usr/bin x=1
+	&& 'quoted text' done grep | readonly export ${HOME} /usr/bin readonly awk echo
+		'quoted text' --verbose echo -eu awk ${HOME} "$@" test done /usr/bin ${HOME}
+	local done local "$@" "$1"
+		2>/dev/null then printf sed export && test | ${HOME}
+	echo ${HOME} -eu --verbose awk 2>/dev/null | 2>/dev/null
+		then 2>/dev/null printf local /usr/bin /usr/bin
+		then && export $(pwd) 'quoted text' /usr/bin export | && readonly
+		local --verbose readonly "$1" done && && 2>/dev/null done test /usr/bin $(pwd)
+	"$1" local done "$1" export "$1" "$1" echo --verbose cd "$1" -eu then ${HOME}
+| --verbose 'quoted text' awk /usr/bin --verbose sed grep
+sed then && awk /usr/bin "$1" x=1 --verbose
+	| awk export ${HOME} readonly -eu ${HOME} 2>/dev/null sed grep "$@"
+	sed --verbose 2>/dev/null /usr/bin cd readonly
+		echo | x=1 then 'quoted text' local printf x=1 test echo test
+		grep "$1" export -eu grep
+		"$@" /usr/bin --verbose cd | 'quoted text'
+		sed /usr/bin export -eu grep /usr/bin awk
+		readonly ${HOME} "$1" readonly local export cd echo ${HOME} sed local local
+test $(pwd) sed grep sed test --verbose export
+		awk 2>/dev/null cd ${HOME} 2>/dev/null
+		done printf grep awk readonly /usr/bin echo cd awk grep "$@" 2>/dev/null
+		| done 'quoted text' --verbose done printf /usr/bin &&
+$(pwd) awk printf grep local awk && -eu test -eu
+	then --verbose | done /usr/bin then echo readonly grep 2>/dev/null
+		cd local sed -eu $(pwd) | $(pwd) test done ${HOME} sed /usr/bin x=1 'quoted text'
+&& printf 2>/dev/null awk --verbose x=1
+export --verbose cd echo /usr/bin && sed done
+--verbose grep done echo 'quoted text' "$1"
+then $(pwd) grep printf | ${HOME} 'quoted text'
+		--verbose grep local $(pwd) && cd printf cd ${HOME} test --verbose
+		done "$1" test awk x=1 'quoted text' "$1" "$@" awk done grep $(pwd) 'quoted text'
+${HOME} -eu readonly --verbose readonly then grep sed -eu
+sed -eu echo && /usr/bin readonly /usr/bin x=1 test local | grep done ${HOME}
+		done printf test echo test grep
+		done 'quoted text' $(pwd) 2>/dev/null printf 2>/dev/null local --verbose
+		"$1" 'quoted text' echo -eu printf 2>/dev/null 2>/dev/null
+		grep local cd cd echo 2>/dev/null 'quoted text'
+grep -eu done 'quoted text' ${HOME} 'quoted text'
+		local local printf 2>/dev/null 'quoted text' "$@" /usr/bin | local ${HOME}
+		printf cd "$@" awk x=1 "$@" ${HOME} echo "$@" -eu 'quoted text'
+	&& 'quoted text' then "$1" --verbose
+	2>/dev/null x=1 'quoted text' | x=1 $(pwd) cd -eu 'quoted text'
+	printf 'quoted text' done test 'quoted text'
+done awk /usr/bin -eu $(pwd) x=1 grep awk
+		x=1 | cd test | grep grep cd awk then printf
+	x=1 2>/dev/null "$1" && local grep x=1 "$1" cd grep test then sed
+		| grep | export cd 2>/dev/null && printf export cd -eu grep --verbose
+	done local "$@" -eu /usr/bin cd
+	${HOME} printf sed printf -eu cd && export /usr/bin | sed -eu | echo cd 'quoted text'
+	/usr/bin local /usr/bin 'quoted text' test printf local $(pwd) readonly
+$(pwd) "$@" x=1 local local ${HOME} then ${HOME} --verbose cd then echo export
+-eu ${HOME} $(pwd) echo local && | && then ${HOME} "$@"
+		then awk readonly x=1 readonly
+	"$1" x=1 'quoted text' local 2>/dev/null sed 2>/dev/null 'quoted text' readonly
+--verbose local local | sed x=1 /usr/bin
+		/usr/bin test grep --verbose 'quoted text' 2>/dev/null 'quoted text' printf test
+	grep --verbose export x=1 && 'quoted text' "$@" --verbose local then 'quoted text'
+	test grep $(pwd) "$1" && 'quoted text'
+	cd export printf done awk -eu
+2>/dev/null local -eu 'quoted text' grep echo && local grep readonly
+		"$@" cd sed test ${HOME} printf grep -eu -eu ${HOME}
+	done $(pwd) export export export
+cd && | -eu awk $(pwd) grep --verbose test 'quoted text' -eu awk | &&
+	| grep test | awk "$@" local
+-eu echo local awk && x=1 grep then &&
+/usr/bin x=1 printf "$@" grep test "$@" printf
+		"$1" awk sed $(pwd) "$@"
+test && sed cd awk then "$@" ${HOME} export
+x=1 --verbose ${HOME} x=1 'quoted text' sed | && --verbose cd $(pwd) $(pwd)
+	-eu 2>/dev/null 'quoted text'
+test x=1 local export printf export ${HOME} | /usr/bin x=1 "$1" "$1"
+		readonly export export then $(pwd) "$@" -eu done "$1" ${HOME}
+cd ${HOME} "$@" awk |
+	local grep readonly then printf ${HOME} test /usr/bin x=1 printf
+		2>/dev/null /usr/bin local "$1" then export 'quoted text' sed
+"$@" export && ${HOME} awk ${HOME} 2>/dev/null /usr/bin
+		done test x=1 export local export 'quoted text' --verbose 'quoted text' grep "$@"
+	"$1" cd 'quoted text' -eu readonly "$1" "$1"
+		echo && grep awk 2>/dev/null then 'quoted text'
+&& | readonly done done && readonly awk --verbose x=1
+		cd --verbose 'quoted text' "$@" printf 2>/dev/null local printf "$@" awk "$@" cd
+		grep /usr/bin awk "$@" export 2>/dev/null cd sed done
+	cd 2>/dev/null then printf echo export awk "$1" readonly
+		echo sed echo "$1" $(pwd) && ${HOME} printf
+	cd test /usr/bin "$1" /usr/bin readonly cd test "$@" then readonly
+--verbose x=1 "$@" && "$@" $(pwd) awk $(pwd) export "$@"
+test done sed $(pwd) x=1 export x=1 /usr/bin export x=1 && done "$@" && echo
+awk local sed done -eu grep | echo awk sed --verbose --verbose --verbose grep
+	x=1 "$1" sed test test test x=1 local then export $(pwd) 2>/dev/null
+"$1" && 'quoted text' --verbose && awk
+grep readonly grep /usr/bin done
+-eu -eu -eu /usr/bin printf
+		-eu echo && local 2>/dev/null -eu ${HOME} $(pwd)
+		/usr/bin readonly "$@" printf 'quoted text'
+sed export echo echo awk -eu done $(pwd) local | cd $(pwd)
+	${HOME} "$@" --verbose test | x=1 2>/dev/null /usr/bin | printf
+		local && cd then && awk && done /usr/bin 'quoted text' ${HOME}
+2>/dev/null local echo "$@" sed 'quoted text' readonly echo export
+/usr/bin awk grep --verbose --verbose export grep grep ${HOME} test
+	"$1" sed --verbose printf awk printf printf 2>/dev/null then "$@" export
+$(pwd) && "$1" "$@" sed
+awk echo && echo done --verbose cd 'quoted text'
+	done | && "$1" x=1 -eu export cd export readonly
+		2>/dev/null done 2>/dev/null 'quoted text' then -eu
+| awk readonly $(pwd) 'quoted text' test
+		printf --verbose done "$@" "$@" cd printf ${HOME}
+	local && $(pwd) local cd echo 2>/dev/null sed test export /usr/bin
+	readonly local test awk "$1" local export grep printf "$@" cd 2>/dev/null done
+	"$1" echo done export awk grep then test $(pwd)
+--verbose printf x=1 | 'quoted text' ${HOME} export local
+	${HOME} cd /usr/bin local ${HOME}
+		$(pwd) test done "$1" /usr/bin "$@" grep "$@"
+		/usr/bin then cd test export
+	awk x=1 "$1" -eu 2>/dev/null test "$1" cd 'quoted text' 2>/dev/null then echo
+		done | ${HOME} x=1 grep | "$1" then | x=1 --verbose
+		readonly && sed x=1 "$1" done | x=1 "$1"
+export printf export "$@" echo x=1
+	export && echo ${HOME} readonly printf
+	done -eu x=1 /usr/bin "$1" grep printf then -eu grep ${HOME}
+readonly done awk done "$1" cd
+		awk sed cd cd readonly export test
+	&& then "$@" 2>/dev/null done cd 'quoted text' printf
+		test done local x=1 export | sed then grep then "$@" export grep done cd
+	${HOME} test local "$1" local
+export cd done --verbose cd readonly x=1
+	"$@" "$1" /usr/bin test ${HOME} grep done local 'quoted text'
+then printf ${HOME} 2>/dev/null
+		echo sed $(pwd) done export grep local $(pwd) "$@"
+cd echo && $(pwd) done
+		printf "$@" "$@" printf ${HOME} 2>/dev/null
+		local ${HOME} --verbose && cd && awk 2>/dev/null --verbose
+2>/dev/null 2>/dev/null echo && cd "$@" ${HOME}
+		awk export test x=1 --verbose && readonly echo export export local -eu --verbose
+grep && $(pwd) $(pwd) sed x=1 && -eu "$@" --verbose
+test test awk then printf | --verbose /usr/bin then grep x=1 readonly /usr/bin
+	readonly && x=1 | "$@" done $(pwd) readonly awk -eu &&
+printf sed readonly export cd "$1" | awk awk readonly "$@" echo done local
+-eu -eu readonly then done && awk 2>/dev/null test grep | 2>/dev/null
+	local && 2>/dev/null readonly "$1" | /usr/bin /usr/bin cd
+		"$@" test x=1 local 'quoted text'
+		-eu awk && x=1 -eu export && /usr/bin printf printf | | && done 2>/dev/null echo
+		| /usr/bin ${HOME} x=1 then echo 2>/dev/null
+readonly -eu | x=1 | local cd awk echo readonly cd awk
+	then "$1" && "$1" | x=1 local done then done x=1 $(pwd) /usr/bin
+test x=1 /usr/bin $(pwd) |
+	/usr/bin && && --verbose echo $(pwd) | && "$1" $(pwd) awk
+sed "$@" | "$1" sed then ${HOME} --verbose "$1" /usr/bin "$@" echo && sed 'quoted text'
+		sed local grep /usr/bin
+	export ${HOME} echo && "$1" then test cd local "$@" awk local 2>/dev/null cd
+done 'quoted text' readonly ${HOME}
+		"$1" 2>/dev/null 'quoted text' /usr/bin "$1" ${HOME} --verbose
+		done printf ${HOME} && x=1 | ${HOME} printf grep
+		then "$1" --verbose export grep sed printf "$1" x=1
+'quoted text' && sed /usr/bin x=1 grep
+		done --verbose 2>/dev/null 'quoted text' $(pwd) x=1 x=1 cd
+sed cd 2>/dev/null then export export ${HOME} /usr/bin test
+	${HOME} "$1" 2>/dev/null local grep ${HOME} "$1" $(pwd) test -eu sed 'quoted text'
+test ${HOME} /usr/bin grep readonly local awk 'quoted text'
+"$1" 2>/dev/null ${HOME} && readonly && /usr/bin
+x=1 $(pwd) $(pwd) test --verbose 2>/dev/null $(pwd) --verbose
+	grep "$@" sed export cd /usr/bin | awk printf echo
+	test awk 'quoted text' readonly done done 'quoted text' "$1" x=1
+	printf ${HOME} 'quoted text' | /usr/bin | test --verbose
+echo printf test | "$1" cd cd then printf -eu
+test | local ${HOME} ${HOME} export --verbose && echo "$1" ${HOME} x=1 local local
+		/usr/bin -eu sed grep export --verbose
+test /usr/bin "$@" echo export awk "$@" $(pwd) ${HOME} 2>/dev/null 'quoted text'
+		export readonly done ${HOME} x=1 'quoted text'
+	&& local local ${HOME} readonly /usr/bin sed 2>/dev/null local --verbose then
+-eu done | done -eu | 'quoted text' printf "$1" grep grep --verbose
+	2>/dev/null ${HOME} $(pwd) --verbose && | $(pwd)
+		grep test "$@" then --verbose --verbose
+		| grep 2>/dev/null test && /usr/bin done export 2>/dev/null
+printf $(pwd) "$1" printf x=1 grep awk printf done 2>/dev/null readonly
+		x=1 echo -eu local x=1 --verbose test "$@" 2>/dev/null cd
+sed 'quoted text' export echo export 'quoted text' readonly
+	done --verbose "$1" -eu then export --verbose "$@" grep "$@" "$@"
+'quoted text' done $(pwd) /usr/bin --verbose done readonly awk export /usr/bin
+"$@" $(pwd) awk ${HOME} && x=1 export then sed sed printf
+done awk | sed grep local done | --verbose
+		'quoted text' && sed -eu done awk | -eu
+	done -eu "$1" "$1" /usr/bin x=1 'quoted text'
+local $(pwd) 2>/dev/null
+echo 2>/dev/null cd echo done
+		&& | /usr/bin then echo && done $(pwd) && sed sed --verbose
+/usr/bin && printf cd 2>/dev/null test $(pwd) && local echo 2>/dev/null
+	2>/dev/null then x=1 printf --verbose done test grep export readonly readonly
+x=1 awk done export $(pwd) 2>/dev/null "$@" /usr/bin export awk cd done x=1 |
+test printf export sed | x=1
+	awk export export /usr/bin ${HOME} "$1"
+	awk awk -eu awk echo -eu awk local awk "$1" done 'quoted text'
+	"$1" 2>/dev/null $(pwd) printf x=1 readonly
+local test sed sed then done --verbose test local then test "$@" printf --verbose
+		awk then "$1" ${HOME} test x=1 ${HOME} readonly cd then
+		then --verbose 2>/dev/null
+		--verbose echo awk -eu test local sed ${HOME} | awk "$1" | && echo
+printf /usr/bin then -eu export awk sed readonly
+	--verbose $(pwd) export printf ${HOME} echo
+		cd cd readonly 2>/dev/null done
+	echo | printf echo sed 2>/dev/null -eu test
+awk test $(pwd) | "$1" | | echo
+	printf printf --verbose
+		readonly $(pwd) "$1" 'quoted text' sed
+sed --verbose 2>/dev/null --verbose
+echo printf /usr/bin -eu && |
+then --verbose | then awk "$1" done /usr/bin ${HOME} local local
+		export then ${HOME} --verbose /usr/bin readonly
+	local grep export cd -eu --verbose
+	awk | printf cd sed cd cd ${HOME}
+/usr/bin -eu "$@" export readonly --verbose grep
+	done && ${HOME} export local awk "$1" "$@" --verbose export --verbose
+--verbose echo --verbose cd then grep | printf /usr/bin awk grep --verbose --verbose
+	done && echo /usr/bin "$1"
+		-eu readonly sed --verbose "$1" $(pwd) sed | export export --verbose test grep
+		2>/dev/null x=1 grep echo echo readonly
+	$(pwd) $(pwd) test local grep $(pwd) "$@" ${HOME} 'quoted text' then 'quoted text'
+		"$1" -eu readonly done && sed $(pwd)
+	printf printf | test export printf ${HOME}
+	local echo done 'quoted text' 2>/dev/null "$@" test readonly |
+sed printf sed cd /usr/bin | --verbose then
+		done local 'quoted text' "$1" export
+"$@" && readonly printf sed 'quoted text'
+	cd "$@" 'quoted text' sed x=1 printf grep $(pwd) test "$@" &&
+local && grep $(pwd) && $(pwd) --verbose /usr/bin 'quoted text'
+		--verbose x=1 readonly x=1 x=1 /usr/bin readonly printf
+		done $(pwd) cd | --verbose 'quoted text' printf ${HOME}
+		export grep x=1 echo then x=1 awk local test cd 2>/dev/null readonly && then echo
+echo -eu echo "$1" $(pwd) "$1" /usr/bin local test printf "$1" x=1 "$@"
+cd then sed x=1 "$@" test --verbose ${HOME} "$1"
+--verbose ${HOME} done printf grep /usr/bin readonly done
+	printf -eu echo cd /usr/bin "$1" done then --verbose local ${HOME}
+		2>/dev/null | ${HOME} done done -eu readonly export
+	'quoted text' && awk printf ${HOME} grep /usr/bin "$@" --verbose awk $(pwd) &&
+2>/dev/null local then "$1" 'quoted text' sed --verbose
+		printf "$1" sed $(pwd) ${HOME}
+grep then | printf -eu | | grep done
+		"$1" "$1" readonly done 2>/dev/null cd export --verbose $(pwd) 'quoted text'
+		x=1 --verbose sed readonly export
+		| | x=1 then local grep ${HOME} done "$1"
+		awk sed export $(pwd) readonly sed x=1
+grep --verbose | then ${HOME} sed $(pwd) -eu "$1" 2>/dev/null test printf
+		test ${HOME} | /usr/bin $(pwd) $(pwd) -eu | "$@" | export
+	--verbose sed $(pwd) grep test /usr/bin echo export
+local -eu /usr/bin echo readonly test $(pwd) then echo printf
+"$@" --verbose sed && sed readonly $(pwd) ${HOME} sed echo printf 'quoted text'
+	"$1" "$1" --verbose echo /usr/bin cd grep
+		readonly --verbose sed /usr/bin -eu test x=1 echo export /usr/bin
+	&& sed 'quoted text' echo awk grep -eu
+		printf $(pwd) 'quoted text' echo echo readonly
+	test done sed local printf echo x=1 done test sed cd readonly local test
+		'quoted text' 2>/dev/null /usr/bin echo printf "$@" ${HOME} sed /usr/bin
+	local done | readonly "$@" /usr/bin then local
+		$(pwd) /usr/bin 2>/dev/null export sed ${HOME} cd
+	printf printf $(pwd) $(pwd) then sed echo 'quoted text' test $(pwd) 'quoted text'
+	export --verbose cd readonly
+		-eu -eu local 'quoted text' cd 2>/dev/null ${HOME} then -eu awk local "$@"
+	awk /usr/bin --verbose export --verbose
+export done done echo "$1" ${HOME} local done && $(pwd) then grep x=1
+	done x=1 | test then 2>/dev/null "$1" grep "$1" sed && export -eu --verbose
+		&& $(pwd) local echo grep echo 'quoted text' done awk x=1 then --verbose
+		&& test /usr/bin export cd grep then ${HOME} && readonly | grep then && local done
+		then grep sed x=1 ${HOME} then "$1" && 'quoted text' ${HOME}
+		"$@" echo && local local 'quoted text'
+		--verbose export 'quoted text' echo -eu cd readonly sed 2>/dev/null
+sed "$@" echo done -eu --verbose
+		test "$1" done x=1 then local
+	/usr/bin cd x=1 awk local "$1" grep "$@" then -eu export /usr/bin test /usr/bin
+sed --verbose then grep x=1 grep readonly "$@" done 2>/dev/null
+	sed ${HOME} ${HOME} printf ${HOME} x=1 done then test 2>/dev/null 2>/dev/null export
+	--verbose export then awk echo printf "$1" sed x=1
+	"$@" x=1 "$@" && "$@" "$@" readonly
+	${HOME} then | printf cd "$1" && --verbose cd test
+		$(pwd) grep ${HOME} 'quoted text'
+		then done awk readonly && "$1" | cd sed readonly done 2>/dev/null "$1"
+		-eu $(pwd) | echo export awk awk "$@" && && "$@" awk echo
+		"$1" $(pwd) /usr/bin grep sed test
+		sed test readonly done && && export
+	$(pwd) printf awk printf grep export then then
+		then printf grep export grep $(pwd) $(pwd) 2>/dev/null
+		grep $(pwd) grep grep ${HOME} done
+		awk echo awk $(pwd) && $(pwd) done
+	sed | awk test -eu $(pwd) | export readonly
+	${HOME} local done then readonly && "$1" 'quoted text'
+	"$1" $(pwd) /usr/bin local sed echo sed x=1 test echo cd $(pwd) $(pwd)
+		cd --verbose grep "$1" $(pwd) /usr/bin cd "$1" readonly 2>/dev/null 2>/dev/null
+	sed then then /usr/bin -eu export then
+echo --verbose "$@" grep x=1 grep then local echo | cd done
+		-eu 'quoted text' export local local && awk
+		"$1" awk cd sed local sed awk echo printf done ${HOME} "$1"
+	$(pwd) awk sed printf -eu "$1" 'quoted text' awk
+		${HOME} echo ${HOME} awk grep $(pwd) ${HOME} 'quoted text'
+		"$1" /usr/bin | 'quoted text' cd readonly x=1
+	$(pwd) ${HOME} "$1" cd grep && /usr/bin test done -eu grep 2>/dev/null
+--verbose && | echo x=1 -eu 'quoted text'
+		x=1 export printf test printf "$1" sed export --verbose
+	/usr/bin test 'quoted text' "$1"
+echo done export && grep printf grep x=1 echo | --verbose sed $(pwd) "$1"
+		| | /usr/bin $(pwd) readonly 2>/dev/null
+		done --verbose ${HOME} "$1" readonly cd x=1 'quoted text'
+| | -eu then && "$@" sed
+		${HOME} /usr/bin ${HOME} grep | cd test then cd 'quoted text'
+		${HOME} $(pwd) "$@" && "$1" grep x=1 export 'quoted text'
+		then | 'quoted text'
+		"$1" ${HOME} cd sed done "$@"
+	${HOME} readonly awk test sed local -eu --verbose then && "$@" grep export
+		done $(pwd) cd awk test printf awk && readonly /usr/bin | grep readonly | "$@"
+	awk && test cd -eu | grep test then $(pwd)
+		/usr/bin /usr/bin $(pwd)
+	awk readonly cd local awk x=1 then readonly sed export then awk then
+	--verbose grep && $(pwd)
+		${HOME} then && && 'quoted text' sed grep -eu 2>/dev/null then "$1" readonly
+	export -eu && grep cd 'quoted text' readonly /usr/bin cd 2>/dev/null
+	| then /usr/bin printf printf local "$@" 'quoted text' 'quoted text'
+		x=1 -eu --verbose "$@" printf then ${HOME} $(pwd) -eu grep awk
+		$(pwd) && echo 2>/dev/null
+	2>/dev/null sed 'quoted text' local
+echo x=1 printf done then 'quoted text'
+	then sed 'quoted text' && | --verbose awk test then cd
+"$1" export local printf readonly ${HOME} "$1" "$@"
+		${HOME} "$1" done done then printf cd export done /usr/bin ${HOME}
+	"$@" $(pwd) export done done test ${HOME} ${HOME} "$@" echo x=1 /usr/bin export
+"$@" readonly | sed "$@" x=1 sed 2>/dev/null
+		$(pwd) | --verbose done --verbose
+local $(pwd) grep | && cd echo export
+		"$@" echo export | then 'quoted text'
+		"$@" export cd && $(pwd) 2>/dev/null
+		awk printf grep done test readonly /usr/bin /usr/bin "$@" grep echo /usr/bin
+		'quoted text' 2>/dev/null ${HOME} readonly
+		sed printf "$@" local done
+	/usr/bin 2>/dev/null "$1" sed cd 'quoted text' export sed 2>/dev/null
+echo | cd local cd grep
+	--verbose "$@" --verbose
+	x=1 2>/dev/null awk grep "$1" cd && /usr/bin ${HOME} local &&
+		--verbose | local grep done
+	| ${HOME} awk awk 'quoted text' 2>/dev/null printf --verbose
+printf grep local "$1" 2>/dev/null && done
+	printf readonly --verbose -eu x=1 awk $(pwd) && cd && && && /usr/bin export
+	&& echo /usr/bin /usr/bin $(pwd) readonly 2>/dev/null
+"$@" awk 2>/dev/null done /usr/bin awk "$@" local test
+	test grep $(pwd) && $(pwd) /usr/bin printf done echo echo
+	printf /usr/bin done ${HOME} cd | grep -eu local
+	then awk 'quoted text' printf 'quoted text' cd echo 'quoted text'
+		/usr/bin readonly "$1" export
+printf x=1 $(pwd) 'quoted text' 'quoted text' --verbose --verbose
+echo printf --verbose grep test then done 2>/dev/null
+then | /usr/bin readonly "$@"
+	export grep | local && then grep test test ${HOME}
+cd 2>/dev/null -eu then x=1 grep grep printf sed $(pwd) export local
+"$@" 2>/dev/null echo grep /usr/bin "$@" -eu 2>/dev/null test printf echo
+		export export printf 'quoted text' done 2>/dev/null
+done $(pwd) test 2>/dev/null cd awk cd && | export readonly "$1" "$@"
+	"$@" readonly done local done export &&
+	| ${HOME} cd /usr/bin "$@" test grep awk grep -eu sed && /usr/bin -eu echo
+	echo "$@" x=1 cd echo cd ${HOME} sed 'quoted text'
+	local done 2>/dev/null /usr/bin "$1"
+cd "$1" $(pwd) $(pwd) local "$1" grep -eu
+		| ${HOME} export test --verbose /usr/bin
+$(pwd) awk echo $(pwd) "$1" then sed && ${HOME} grep && $(pwd)
+grep ${HOME} "$1" -eu grep cd --verbose --verbose then cd ${HOME} readonly
+cd sed test local readonly /usr/bin -eu "$1"
+"$1" "$@" echo grep "$1" test && done "$1" printf readonly
+		done 2>/dev/null export x=1 export grep awk cd awk echo grep export
+echo 2>/dev/null awk sed printf
+		readonly readonly $(pwd) 2>/dev/null | awk export
+	"$1" cd && done /usr/bin x=1 readonly -eu done 2>/dev/null local cd 2>/dev/null
+		local test done echo $(pwd) -eu 2>/dev/null sed x=1 local awk then
+/usr/bin then cd done grep then then echo 'quoted text'
+	sed test x=1 grep "$@" $(pwd) ${HOME} -eu cd export local --verbose
+export sed --verbose export echo cd "$1" "$1" && test ${HOME}
+		&& /usr/bin 2>/dev/null readonly && 2>/dev/null -eu --verbose $(pwd)
+	then test test test 2>/dev/null 2>/dev/null 'quoted text'
+	printf "$@" ${HOME} && export
+$(pwd) then test grep then awk -eu awk
+		grep /usr/bin "$1" awk "$@" && "$@" sed export --verbose x=1 ${HOME}
+export 2>/dev/null && test done grep | readonly done -eu then
+		readonly 'quoted text' grep readonly /usr/bin
+done printf cd && done "$1" sed printf then awk | | -eu test awk test &&
+		-eu "$1" test awk grep && | readonly grep sed awk --verbose awk test readonly
+${HOME} $(pwd) readonly --verbose /usr/bin 'quoted text'
+$(pwd) --verbose $(pwd) then x=1 "$1" sed x=1
+		| echo && export --verbose printf test
+	2>/dev/null test $(pwd) local
+$(pwd) | 'quoted text' $(pwd)
+'quoted text' 'quoted text' test cd
+/usr/bin 2>/dev/null | sed echo ${HOME} --verbose printf "$@" printf export
+	local 2>/dev/null grep cd && ${HOME} done then done 'quoted text' 2>/dev/null
+	"$1" sed grep 'quoted text' "$1" local sed readonly readonly export 2>/dev/null
+awk $(pwd) ${HOME} "$@"
+		export test then done x=1 "$@" 2>/dev/null echo local sed echo "$@"
+	x=1 $(pwd) /usr/bin "$1" sed printf 'quoted text' readonly then
+	"$1" | --verbose readonly | readonly test 2>/dev/null grep export
+&& export x=1 --verbose
+		export echo ${HOME} sed export readonly
+	grep x=1 | | $(pwd) "$1" -eu | readonly export | cd --verbose sed
+	grep awk "$1" done | done && x=1 /usr/bin then done "$1" local | grep
+	printf x=1 readonly export -eu "$1" echo local
+		done ${HOME} cd /usr/bin export done sed $(pwd) "$@"
+		printf "$@" sed "$1" "$1" then readonly | "$1" "$1" test x=1
+x=1 "$1" echo grep local test awk --verbose done cd && "$@" -eu cd 'quoted text'
+	done awk "$1" $(pwd) then --verbose --verbose sed grep ${HOME}
+	readonly done ${HOME} grep test | "$@" printf "$@" done -eu 2>/dev/null
+	/usr/bin awk done ${HOME} /usr/bin "$@" grep | | export printf 'quoted text'
+		/usr/bin awk 2>/dev/null --verbose -eu echo test grep
+		/usr/bin then printf 2>/dev/null
+x=1 | | test && echo export "$1" printf
+	/usr/bin sed ${HOME} grep
+cd -eu "$@" "$1" "$1" | awk 2>/dev/null | x=1 grep echo
+	then 2>/dev/null test local /usr/bin
+"$1" local /usr/bin x=1
+done -eu x=1 then ${HOME} export x=1 $(pwd) 2>/dev/null ${HOME} then
+		--verbose 'quoted text' $(pwd)
+grep ${HOME} grep grep then echo -eu -eu echo awk -eu
+		then $(pwd) export then x=1
+		cd printf sed readonly grep test then 2>/dev/null x=1
+	x=1 "$@" -eu export then echo | then 'quoted text' $(pwd) x=1 echo
+		done grep 2>/dev/null "$1" /usr/bin readonly
+		2>/dev/null 2>/dev/null "$@" printf 'quoted text'
+#include c188.sh
+	then readonly -eu readonly x=1 awk $(pwd) local export x=1 -eu echo "$@" test 2>/dev/null
+export /usr/bin "$1" | 2>/dev/null "$@"
+"$1" grep readonly ${HOME}
+2>/dev/null then | done readonly
+		| 2>/dev/null done x=1 echo ${HOME} --verbose | grep ${HOME}
+readonly cd 2>/dev/null done test readonly
+	local printf grep "$@" $(pwd) /usr/bin
+		-eu sed x=1 printf /usr/bin /usr/bin | $(pwd) x=1 sed -eu && x=1 2>/dev/null
+	'quoted text' "$@" 2>/dev/null grep then grep -eu done
+		/usr/bin --verbose -eu --verbose echo awk test x=1 && 'quoted text' then 2>/dev/null
+	test then sed | printf
+	readonly printf echo sed | "$@" export $(pwd) "$@" grep 2>/dev/null awk printf
+		readonly done $(pwd) --verbose /usr/bin 'quoted text' 'quoted text'
+	&& export --verbose export | "$1" echo awk done readonly ${HOME} sed sed
+		&& -eu cd "$1" /usr/bin "$@" 'quoted text' then "$@" test
+		&& cd grep local "$@" cd awk grep x=1
+then --verbose | readonly "$1" then 'quoted text' 'quoted text' "$@" x=1
+	"$@" "$@" $(pwd) export done /usr/bin --verbose && cd "$@" x=1 then sed && $(pwd)
+sed then export x=1 cd readonly ${HOME} $(pwd) | -eu sed "$@" /usr/bin 'quoted text'
+local "$1" x=1 local $(pwd) grep 2>/dev/null
+		$(pwd) awk echo && x=1 echo && && sed then -eu
+		printf sed sed printf printf "$1" printf done $(pwd)
+local && printf awk sed --verbose echo then done -eu readonly
+"$@" readonly local cd -eu then "$@"
+	done echo test /usr/bin 2>/dev/null test done readonly x=1 'quoted text'
+		"$1" awk export test awk && test sed done ${HOME}
+		done grep cd test test "$@" grep export readonly
+	export printf awk grep "$1" ${HOME} export -eu 'quoted text' && &&
+		echo cd readonly | grep echo grep awk done
+	export done sed sed "$@" echo $(pwd) export test ${HOME} 'quoted text'
+		/usr/bin && "$1" sed
+	awk sed export sed /usr/bin | done awk && printf "$1" "$1" "$1" local
+	printf echo then cd grep && cd echo ${HOME}
+&& echo x=1 grep awk -eu
+		&& cd echo && test then awk test then printf grep printf then grep "$1" /usr/bin
+		--verbose /usr/bin printf export done 'quoted text' "$@" /usr/bin | sed readonly
+	x=1 -eu 'quoted text' printf $(pwd) then grep && cd | "$1" ${HOME}
+printf done 'quoted text' "$1" awk printf
+"$1" sed "$@" grep "$1" ${HOME} readonly 2>/dev/null
+		echo /usr/bin -eu ${HOME} -eu --verbose echo && "$1" 2>/dev/null local
+		2>/dev/null && readonly x=1 local readonly local sed
+	${HOME} /usr/bin done | && local
+		awk cd && test 'quoted text' sed 'quoted text' readonly 2>/dev/null $(pwd)
+export then ${HOME} ${HOME} ${HOME} export readonly cd -eu readonly | |
+	export printf /usr/bin local grep awk then $(pwd) export printf "$@" then cd
+	'quoted text' 2>/dev/null test readonly printf --verbose done grep 'quoted text'
+	&& x=1 grep x=1 printf /usr/bin printf local 'quoted text'
+test --verbose local $(pwd) $(pwd) cd local
+		| readonly echo $(pwd) -eu --verbose awk "$@" cd printf echo "$1" "$@" && done
+		local done ${HOME} |
+	| "$1" grep then 2>/dev/null cd 2>/dev/null
+	printf && done local "$1" grep done test local awk done readonly
+cd --verbose | printf --verbose echo x=1 awk export local echo x=1 cd awk awk sed
+"$1" awk -eu && ${HOME} then $(pwd) ${HOME} 2>/dev/null 'quoted text'
+		| "$1" $(pwd) sed --verbose $(pwd) local
+	-eu --verbose test $(pwd) awk test 'quoted text'
+	readonly local cd echo && done && && sed 'quoted text' done export cd sed then
+sed awk --verbose local
+cd "$@" /usr/bin local awk then test readonly then | grep
+		&& 'quoted text' "$1" test x=1 x=1 &&
+'quoted text' x=1 done awk awk then ${HOME} grep ${HOME} printf sed "$@"
+	$(pwd) grep /usr/bin echo grep 'quoted text' /usr/bin
+export | printf then sed cd local readonly readonly 2>/dev/null echo -eu
+test test && then 'quoted text' "$1" then local $(pwd)
+echo x=1 then "$1" 2>/dev/null x=1 readonly export 'quoted text' then -eu
+		x=1 x=1 echo -eu /usr/bin grep sed local local "$1" awk $(pwd) readonly
+		/usr/bin printf then --verbose sed local echo
+		2>/dev/null test | /usr/bin "$@" | $(pwd) then printf ${HOME} -eu echo done done
+		grep | readonly awk -eu sed export ${HOME} "$@" local done sed printf
+	echo awk printf awk readonly export export && $(pwd) cd done && && cd ${HOME}
+		awk -eu -eu $(pwd) $(pwd) -eu "$1" 2>/dev/null
+-eu echo && awk grep echo $(pwd) | then --verbose && | 'quoted text' $(pwd) cd
+x=1 x=1 'quoted text' 2>/dev/null cd export "$@" | test 2>/dev/null done awk --verbose
+	${HOME} export 'quoted text' done "$@" done sed ${HOME}
+${HOME} readonly ${HOME} $(pwd) | cd export
+local | cd sed test done readonly test test grep /usr/bin
+		--verbose test --verbose printf 2>/dev/null done printf && printf
+	'quoted text' | echo export then 2>/dev/null echo printf export export && done
+	local export sed ${HOME} /usr/bin local readonly readonly then "$@" /usr/bin
+| /usr/bin test x=1 echo $(pwd) sed cd done x=1
+	printf grep --verbose $(pwd) x=1 "$1" | sed sed export
+	export local echo -eu local local then printf local
+		test 'quoted text' "$1" awk sed &&
+'quoted text' 2>/dev/null 2>/dev/null "$@" -eu printf then "$@"
+		${HOME} readonly ${HOME} local
+	cd then 2>/dev/null grep grep printf "$1" 2>/dev/null 'quoted text' grep grep echo
+	test echo ${HOME} ${HOME} $(pwd)
+		readonly -eu cd printf 2>/dev/null local grep
+		test export | --verbose local | x=1
+		then ${HOME} && /usr/bin echo local sed cd "$1"
+	x=1 local --verbose $(pwd)
+	--verbose --verbose --verbose 'quoted text' sed $(pwd)
+-eu "$@" && local /usr/bin &&
+export test 2>/dev/null "$1" printf local "$1" --verbose test 2>/dev/null
+	| sed "$1" && local -eu x=1 local x=1 ${HOME} /usr/bin ${HOME} cd |
+	| done 'quoted text' && ${HOME} ${HOME}
+	$(pwd) test then echo 2>/dev/null | awk then test test /usr/bin readonly
+local test --verbose 2>/dev/null $(pwd) test echo awk | test echo readonly
+/usr/bin ${HOME} --verbose &&
+	local "$@" --verbose grep
+	x=1 'quoted text' 'quoted text' "$@"
+		grep test | 2>/dev/null x=1 /usr/bin echo $(pwd) $(pwd) printf grep &&
+x=1 2>/dev/null ${HOME} "$1" test echo /usr/bin
+done ${HOME} "$1" export && /usr/bin echo then x=1 "$1"
+		sed readonly cd ${HOME} readonly --verbose 'quoted text'
+	'quoted text' && $(pwd) $(pwd) "$@" printf "$@" x=1 test "$1" export done
+		then local test | 'quoted text' cd then 2>/dev/null cd
+		then | | -eu -eu "$@" sed cd done "$1" /usr/bin 2>/dev/null
+		readonly && ${HOME} ${HOME} test printf local "$1" /usr/bin
+2>/dev/null 2>/dev/null && awk local /usr/bin echo printf "$@"
+		--verbose /usr/bin printf && ${HOME} done then $(pwd) 'quoted text' "$1" readonly
+| "$@" cd sed test /usr/bin $(pwd) cd x=1 cd -eu grep "$@"
+	${HOME} test done $(pwd) readonly grep /usr/bin printf export cd echo printf
+		&& local $(pwd) printf readonly $(pwd) && local x=1 cd
+&& then cd | ${HOME} cd then done | "$@" readonly local "$@" readonly x=1
+| 2>/dev/null --verbose
+		export x=1 "$@" grep done /usr/bin echo --verbose
+	cd ${HOME} | | -eu readonly readonly grep export 2>/dev/null done /usr/bin
+	export done echo --verbose -eu sed awk "$@" x=1 cd cd x=1
+| 'quoted text' "$@" 2>/dev/null "$1" local
+		"$1" grep grep "$1" | then --verbose readonly 'quoted text' x=1 x=1 -eu export
+done x=1 && --verbose done && done readonly awk printf then
+	sed | cd /usr/bin /usr/bin $(pwd) sed && awk | /usr/bin echo
+'quoted text' done "$1" -eu printf echo export $(pwd) then sed 'quoted text'
+/usr/bin -eu x=1 | && local test x=1 readonly export $(pwd) grep "$@"
+&& readonly echo sed test -eu -eu test | ${HOME} -eu | echo printf
+$(pwd) local | readonly x=1 readonly export echo cd readonly 2>/dev/null
+done test export "$1" sed test $(pwd) ${HOME} export "$1" awk --verbose
+	grep echo | 2>/dev/null done | $(pwd) done echo
+	${HOME} "$1" export 'quoted text' test --verbose
+		/usr/bin printf ${HOME} sed echo "$@" && && "$@" then export
+		2>/dev/null 2>/dev/null "$1" export readonly 'quoted text'
+	x=1 $(pwd) echo ${HOME} done 2>/dev/null local "$@" x=1 x=1
+sed cd cd x=1 ${HOME} printf x=1
+		printf $(pwd) printf export x=1 "$@" --verbose /usr/bin
+		echo local && done sed test grep echo readonly printf /usr/bin local
+then 'quoted text' 2>/dev/null test 2>/dev/null export echo $(pwd)
+$(pwd) x=1 'quoted text' 2>/dev/null cd
+--verbose done readonly /usr/bin awk 2>/dev/null
+test done && awk grep printf
+		awk "$@" printf ${HOME} export then done echo sed echo 'quoted text' ${HOME}
+	'quoted text' && /usr/bin export &&
+/usr/bin "$1" && done x=1 echo &&
+local grep readonly 2>/dev/null && x=1 done $(pwd)
+-eu $(pwd) grep sed test readonly then
+		export 2>/dev/null cd done --verbose readonly printf then /usr/bin
+'quoted text' readonly done printf $(pwd) local 2>/dev/null
+		awk | | $(pwd) sed x=1 sed && sed && done sed local local test printf
+		printf test "$@" && --verbose awk x=1 -eu awk printf
+	-eu --verbose awk awk "$1" && ${HOME}
+		-eu test --verbose export
+	cd | "$@" | printf && 'quoted text' ${HOME} x=1 export
+		cd $(pwd) "$@" done readonly local
+	"$1" /usr/bin ${HOME} readonly ${HOME} local printf sed grep $(pwd) -eu ${HOME}
+sed cd /usr/bin && test ${HOME} 'quoted text' export 2>/dev/null then | test awk
+	done ${HOME} echo 2>/dev/null test readonly && "$1" cd ${HOME} x=1 /usr/bin
+2>/dev/null "$@" grep "$@" export
+then echo "$@" then grep x=1 awk awk printf | -eu local
+	| awk /usr/bin $(pwd) then printf | $(pwd) "$@" /usr/bin printf grep
+	| -eu x=1 done /usr/bin
+readonly --verbose grep sed grep readonly
+	x=1 printf grep grep test echo then --verbose
+$(pwd) "$@" "$1" awk /usr/bin grep cd readonly test | done then grep awk
+		test "$1" awk awk 'quoted text'
+| ${HOME} echo "$1" | x=1 -eu -eu cd 'quoted text' sed cd
+--verbose readonly && printf "$1" echo export 'quoted text' done 'quoted text'
+		sed cd /usr/bin --verbose cd test cd ${HOME} | ${HOME}
+	grep | awk -eu && --verbose $(pwd) x=1 /usr/bin cd printf --verbose printf
+	sed $(pwd) 2>/dev/null --verbose $(pwd) -eu $(pwd) test
+		'quoted text' $(pwd) --verbose x=1 local 2>/dev/null
+	local sed $(pwd) echo readonly "$1" | local printf 'quoted text' local
+sed export printf 2>/dev/null echo $(pwd) /usr/bin $(pwd) | local 'quoted text'
+	--verbose -eu "$@" --verbose awk -eu awk printf local local
+	--verbose echo $(pwd) 'quoted text' ${HOME} && done ${HOME} echo /usr/bin
+-eu --verbose "$@" then --verbose -eu x=1 done /usr/bin local sed x=1 && done
+		-eu echo export -eu printf done x=1 x=1 then done
+	export -eu /usr/bin local local "$@" | echo 'quoted text' $(pwd) printf then ${HOME}
+local cd done printf 'quoted text'
+'quoted text' readonly
+'quoted text' sed "$1" "$1" export
+		"$1" echo && then printf readonly local && echo 2>/dev/null |
+/usr/bin sed awk cd 'quoted text'
+	/usr/bin done --verbose --verbose "$1" export "$1"
+x=1 $(pwd) && $(pwd) printf "$@" /usr/bin
+	"$1" awk 2>/dev/null local "$1"
+		then 2>/dev/null readonly /usr/bin ${HOME}
+	printf 'quoted text' | test --verbose
+	done then test | x=1 sed readonly sed "$@" done test $(pwd) --verbose printf
+		echo | "$@" printf done "$@" test echo "$1" grep
+printf 'quoted text' x=1 cd "$@" --verbose export -eu
+	test -eu "$1" local /usr/bin -eu sed cd $(pwd) readonly "$@" ${HOME} echo
+		test x=1 printf grep && awk printf awk then awk grep
+--verbose awk 2>/dev/null
+	awk && --verbose then 'quoted text'
+	grep grep "$1" -eu then local x=1 $(pwd)
+	"$1" cd readonly ${HOME} --verbose -eu && test "$1" && printf
+2>/dev/null ${HOME} test | echo | sed readonly readonly 2>/dev/null "$@" echo
+	grep x=1 --verbose then export echo printf && ${HOME} echo /usr/bin
+		printf cd "$@" 2>/dev/null then readonly then cd | 'quoted text'
+		"$@" | cd /usr/bin printf "$@" readonly
+		then readonly ${HOME} 'quoted text' | ${HOME} printf echo then
+	done && "$1" -eu -eu echo echo sed awk $(pwd)
+		${HOME} $(pwd) --verbose ${HOME} test readonly
+test "$1" printf echo grep && /usr/bin && echo --verbose
+	/usr/bin -eu ${HOME} && export grep
+	$(pwd) done -eu done && /usr/bin && ${HOME} done
+done local echo then -eu 'quoted text' --verbose
+sed printf local awk 2>/dev/null then ${HOME} x=1 -eu grep then
+		readonly 'quoted text' -eu local
+echo "$@" awk /usr/bin "$@" --verbose sed readonly then
+		--verbose done test printf cd export grep echo ${HOME} ${HOME} local grep
+	readonly $(pwd) ${HOME} test local x=1 awk local -eu
+--verbose --verbose test 2>/dev/null
+		echo then 'quoted text' printf x=1 | $(pwd)
+	| export ${HOME} ${HOME} --verbose sed /usr/bin
+x=1 printf readonly --verbose local -eu sed then done ${HOME}
+		-eu awk 'quoted text' readonly local 2>/dev/null | then 2>/dev/null
+export then "$@" "$@" -eu 'quoted text' test then | awk $(pwd) --verbose cd -eu
+export 2>/dev/null | done ${HOME} "$@"
+| -eu 2>/dev/null test test echo
+		$(pwd) sed printf 2>/dev/null test
+"$1" echo done ${HOME} | "$@" ${HOME} sed printf --verbose printf | sed awk cd sed
+export readonly awk "$@" "$@" done 2>/dev/null echo 2>/dev/null
+${HOME} export /usr/bin printf -eu "$@"
+	2>/dev/null x=1 "$1" export -eu 2>/dev/null
+		'quoted text' cd awk awk --verbose ${HOME}
+--verbose "$@" "$1" export echo test | export export
+		sed sed awk grep local then export readonly --verbose
+		--verbose $(pwd) x=1 x=1 /usr/bin cd then | local test "$@" -eu awk printf ${HOME}
+	"$1" 'quoted text' 2>/dev/null test awk done done x=1
+		"$@" 2>/dev/null cd printf $(pwd) ${HOME} local
+		printf export sed done ${HOME} awk sed "$@" local | printf 'quoted text'
+test test "$1" x=1 x=1 'quoted text' && echo
+		$(pwd) grep 2>/dev/null x=1 --verbose then x=1 2>/dev/null && /usr/bin
+	grep printf sed x=1 sed ${HOME} | "$@" -eu printf cd
+2>/dev/null $(pwd) "$@" then && 2>/dev/null "$1" && -eu "$1" "$@" $(pwd)
+&& sed /usr/bin local printf printf $(pwd) "$1" --verbose printf printf
+	| x=1 cd then awk | -eu done cd -eu cd /usr/bin $(pwd) x=1 local
+	echo /usr/bin grep $(pwd) then --verbose awk && "$1" awk awk
+$(pwd) $(pwd) grep /usr/bin done local -eu "$@" readonly $(pwd) && 'quoted text'
+		--verbose 2>/dev/null test "$1" awk 'quoted text' export
+	$(pwd) ${HOME} sed echo 'quoted text' && done readonly grep cd done test
+	done --verbose cd then done
+		sed grep ${HOME} test test
+	/usr/bin local cd "$1" cd
+		sed awk then then "$@" "$1" then
+		done readonly local --verbose && sed && awk | /usr/bin
+then awk x=1 sed ${HOME} export readonly export 2>/dev/null echo "$@"
+	awk "$@" local 'quoted text' ${HOME} test printf --verbose local cd printf
+		echo && done cd grep | local --verbose | echo sed grep test then
+	/usr/bin cd cd x=1 readonly awk $(pwd) grep sed grep | awk $(pwd)
+		| echo /usr/bin ${HOME} grep test "$@" printf sed printf echo
+		test then --verbose ${HOME} printf
+readonly -eu printf -eu /usr/bin cd local grep | printf "$@" ${HOME} "$@" 'quoted text'
+		echo test grep readonly grep sed 2>/dev/null ${HOME} grep 'quoted text' cd
+		2>/dev/null readonly echo -eu ${HOME} awk ${HOME} printf
+	local test printf echo
+	echo export sed "$1" done readonly
+		/usr/bin -eu grep /usr/bin --verbose
+done export sed --verbose printf --verbose
+		2>/dev/null -eu test ${HOME} "$@"
+x=1 x=1 export -eu readonly echo then then 2>/dev/null
+echo -eu -eu test /usr/bin echo grep readonly then
+&& sed printf grep awk printf local ${HOME}
+printf export echo -eu echo "$1" x=1 grep 2>/dev/null
+		x=1 'quoted text' -eu x=1 sed then -eu printf $(pwd) then 'quoted text'
+		--verbose sed test cd "$1"
+test | "$1" "$@" /usr/bin awk 2>/dev/null
+		echo done $(pwd) grep x=1 awk cd && "$@" cd "$@" done 2>/dev/null cd x=1 | then
+	export cd awk x=1 "$@" readonly test x=1 test export local
+		| done export printf cd local $(pwd) awk | grep x=1 cd echo 2>/dev/null
+	printf 'quoted text' sed
+		export $(pwd) local done printf /usr/bin x=1 sed
+	then printf -eu 'quoted text' -eu "$1" | export /usr/bin 2>/dev/null
+2>/dev/null printf grep && --verbose
+	"$@" | "$1" printf grep echo readonly test 2>/dev/null
+	done "$1" sed --verbose && cd
+		readonly | 'quoted text' test /usr/bin
+	test echo ${HOME} && | ${HOME} -eu /usr/bin done sed && --verbose export ${HOME}
+	/usr/bin awk "$@" "$1" echo
+'quoted text' done export $(pwd) 'quoted text' grep /usr/bin $(pwd)
+printf printf "$1" awk "$1" awk local && "$1" then x=1 sed printf
+		test ${HOME} 2>/dev/null sed local
+		${HOME} $(pwd) printf test x=1 "$@" x=1
+done readonly | "$@" local 2>/dev/null x=1 $(pwd) "$@" local -eu printf
+		grep readonly | sed "$@" export "$@" then $(pwd) cd readonly 'quoted text'
+	sed test grep --verbose awk --verbose x=1 "$1" "$1" readonly "$1" sed local
+		| ${HOME} --verbose "$1" x=1 --verbose sed sed 2>/dev/null test | printf
+-eu ${HOME} 'quoted text' -eu | "$1" | x=1 /usr/bin | && x=1 done
+		"$@" printf "$1" | "$1" echo /usr/bin --verbose
+then x=1 && cd /usr/bin awk $(pwd) sed -eu 2>/dev/null
+	readonly 'quoted text' /usr/bin --verbose ${HOME} export
+printf --verbose $(pwd) ${HOME}
+	-eu 'quoted text' $(pwd) sed cd &&
+	--verbose printf --verbose "$1" "$@" readonly export awk ${HOME} awk
+cd sed /usr/bin local grep export cd local
+	/usr/bin ${HOME} test cd 'quoted text'
+		"$@" echo grep sed -eu /usr/bin cd printf | "$@" 2>/dev/null export sed "$1"
+	grep grep -eu 'quoted text' x=1
+	$(pwd) "$1" export cd "$@" ${HOME} | &&
+		$(pwd) grep && && ${HOME} echo x=1 'quoted text'
+		2>/dev/null grep sed printf 'quoted text'
+		'quoted text' readonly readonly readonly local done local | printf x=1 "$1"
+		grep --verbose awk readonly sed x=1 local | "$@" -eu done
+| grep /usr/bin -eu printf $(pwd) x=1 x=1 done "$1" awk -eu "$@" "$@" test
+grep test && 2>/dev/null sed grep then cd grep sed "$@" grep test 2>/dev/null
+		x=1 'quoted text' 'quoted text' readonly done --verbose printf 'quoted text'
+		$(pwd) && then "$@" readonly local printf cd /usr/bin done 2>/dev/null
+$(pwd) /usr/bin 2>/dev/null
+	printf test 'quoted text' local |
+--verbose export 'quoted text' && then echo -eu ${HOME} done readonly "$1"
+		x=1 awk then cd done readonly done printf | $(pwd)
+		export -eu "$@" export awk export local cd cd "$1" ${HOME} "$@" | export printf
+	x=1 /usr/bin test local sed sed done sed printf
+		2>/dev/null grep x=1 sed "$1" "$1" -eu awk 2>/dev/null | readonly | ${HOME}
+		readonly ${HOME} 'quoted text' export --verbose
+		--verbose ${HOME} ${HOME} echo cd then 2>/dev/null
+		awk $(pwd) --verbose sed $(pwd) "$1" then
+	'quoted text' test grep grep && awk -eu 'quoted text'
+		echo $(pwd) readonly awk "$1" -eu 2>/dev/null export
+		"$1" "$1" 'quoted text' printf sed "$@"
+'quoted text' --verbose awk sed /usr/bin --verbose done grep
+		done awk -eu then sed readonly "$1" done "$1" printf "$@" "$@" /usr/bin | cd ${HOME}
+		'quoted text' 'quoted text' sed --verbose export printf && test "$1" readonly
+	awk printf sed local grep awk | "$1" --verbose --verbose ${HOME} then --verbose
+	"$@" awk printf echo ${HOME} grep printf /usr/bin export /usr/bin "$1"
+		| test | && readonly cd $(pwd) "$1" local awk /usr/bin "$@" $(pwd) "$1"
+	x=1 test $(pwd) -eu 'quoted text'
+	then echo && export ${HOME} printf then x=1
+then 2>/dev/null cd local then awk --verbose cd readonly "$@"
+$(pwd) readonly test | done sed
+		grep local done echo done "$1" $(pwd) test 'quoted text'
+	| printf echo 2>/dev/null x=1 "$1" done -eu printf done "$@" sed -eu -eu x=1
+		"$@" && ${HOME} sed test then grep --verbose ${HOME} 'quoted text' "$@"
+		test readonly "$@" $(pwd) | ${HOME} echo --verbose x=1 export sed 'quoted text'
+	${HOME} cd awk 2>/dev/null printf sed --verbose
+		test sed "$@" x=1 local x=1 "$1" 'quoted text' "$@"
+		$(pwd) grep cd -eu export && awk cd printf local then 'quoted text'
+awk && $(pwd) ${HOME} /usr/bin
+sed "$1" cd readonly printf awk printf
+readonly done awk 2>/dev/null echo
+		then then ${HOME} test | x=1 $(pwd) echo $(pwd) then export awk done /usr/bin
+	2>/dev/null -eu cd /usr/bin
+	"$@" 2>/dev/null sed --verbose
+		'quoted text' done test "$1" readonly ${HOME} "$@" x=1 awk 'quoted text'
+	$(pwd) cd then --verbose printf && && then export
+	test "$@" --verbose "$@" 2>/dev/null 2>/dev/null ${HOME} --verbose
+		then done awk readonly | echo printf 'quoted text'
+awk 2>/dev/null sed "$1" && | grep 2>/dev/null echo -eu export -eu "$1" sed
+sed ${HOME} then export --verbose $(pwd) grep
+	awk sed && echo && done 2>/dev/null grep export "$1"
+	$(pwd) --verbose /usr/bin
+	&& -eu printf echo --verbose /usr/bin --verbose && test x=1 local "$@" 'quoted text'
+		/usr/bin sed "$@" "$@" test | done ${HOME} done x=1 test export readonly
+	&& 2>/dev/null readonly | ${HOME} echo local ${HOME} ${HOME} then
+done "$1" export local done readonly cd && cd printf export
+		${HOME} ${HOME} local x=1 local sed printf printf printf
+		2>/dev/null awk | readonly local done echo export cd printf awk x=1 sed sed
+		/usr/bin -eu grep export grep && cd $(pwd) "$1" --verbose
+		&& "$@" -eu export "$@" export echo export ${HOME} export && grep grep grep --verbose
+	x=1 x=1 then local 'quoted text'
+${HOME} test /usr/bin && done
+		export test awk "$@" then
+readonly test sed | export 'quoted text'
+--verbose "$@" awk /usr/bin $(pwd) -eu export x=1 done --verbose awk "$@"
+		&& test | && grep echo 2>/dev/null
+		/usr/bin readonly printf /usr/bin $(pwd)
+2>/dev/null sed -eu echo local test done
+"$1" "$1" printf awk grep
+		"$@" export $(pwd) test 2>/dev/null done
+	x=1 $(pwd) then | awk cd
+	x=1 done $(pwd) x=1 ${HOME} cd "$1" ${HOME} 'quoted text'
+	cd 'quoted text' x=1 then ${HOME} printf | local export readonly
+printf | && test readonly --verbose awk "$@" grep "$1" echo then sed
+grep $(pwd) cd "$@" printf -eu readonly "$@" local -eu export grep && done |
+	done | then local 2>/dev/null $(pwd)
+		grep x=1 awk ${HOME} awk cd --verbose && "$1" cd x=1 awk awk "$@" 2>/dev/null
+cd $(pwd) awk done --verbose
+${HOME} test | cd cd done "$1" ${HOME} done then --verbose export local
+		| 'quoted text' local 2>/dev/null --verbose && "$@" local grep readonly test
+		awk awk -eu x=1 readonly readonly | ${HOME} test awk x=1 2>/dev/null sed
+	then -eu x=1 sed test 'quoted text'
+	readonly awk 2>/dev/null cd 2>/dev/null $(pwd) sed && "$@" -eu 2>/dev/null
+		/usr/bin "$1" sed then 'quoted text' cd 'quoted text' readonly x=1 test "$@" &&
+		readonly x=1 2>/dev/null export echo export grep awk cd $(pwd) |
+	printf $(pwd) "$1" test -eu readonly local
+	sed grep /usr/bin then awk local
+		echo local local 2>/dev/null done
+	then --verbose /usr/bin done /usr/bin done test export ${HOME} 2>/dev/null
+	"$1" sed echo readonly x=1 "$@"
+&& grep export cd grep -eu cd cd done "$@"
+	| cd "$1" printf -eu -eu /usr/bin
+export 2>/dev/null $(pwd) && sed readonly test export awk echo echo
+		x=1 export grep echo export -eu done grep ${HOME}
+/usr/bin cd && printf 'quoted text'
+sed readonly --verbose grep
+		grep 'quoted text' && x=1 $(pwd) readonly
+		x=1 readonly local done -eu 2>/dev/null
+	export --verbose awk sed awk test $(pwd)
+cd local ${HOME} x=1 "$@" echo -eu | /usr/bin test "$@" -eu x=1 printf
+	/usr/bin "$1" local ${HOME} && | grep | grep readonly
+done grep | && cd --verbose grep local readonly export printf export
+	readonly grep echo "$@" x=1
+		test printf -eu $(pwd) "$1" 2>/dev/null -eu 'quoted text'
+		-eu /usr/bin done printf printf cd | --verbose | then printf local
+	&& --verbose /usr/bin | "$@"
+x=1 -eu then 2>/dev/null 'quoted text' ${HOME} ${HOME} done cd cd done local
+2>/dev/null && -eu -eu sed awk awk x=1 grep readonly 2>/dev/null
+	$(pwd) "$@" then /usr/bin echo 2>/dev/null then | 'quoted text'
+sed /usr/bin "$1" x=1 ${HOME} && done 2>/dev/null "$@" sed
+--verbose sed && printf "$1" | then 2>/dev/null &&
+		printf "$@" readonly readonly then export ${HOME}
+	-eu && printf readonly readonly then 'quoted text' "$@" grep x=1 x=1 x=1 echo
+readonly done -eu /usr/bin | echo awk local test
+echo test awk 2>/dev/null x=1
+	2>/dev/null grep echo echo "$1" 2>/dev/null
+	--verbose then $(pwd) -eu "$1" | 2>/dev/null x=1 test x=1 "$@" printf
+		2>/dev/null readonly --verbose /usr/bin && 'quoted text' readonly
+	2>/dev/null "$1" cd printf 2>/dev/null
+"$@" ${HOME} printf then && x=1 'quoted text' $(pwd) && ${HOME} "$1" ${HOME}
+'quoted text' 2>/dev/null export
+	local --verbose x=1 cd echo "$@" --verbose test --verbose
+cd /usr/bin export printf ${HOME} awk /usr/bin $(pwd) local
+		&& 2>/dev/null test then x=1
+export local ${HOME} sed echo then readonly
+readonly sed --verbose cd export $(pwd) && /usr/bin "$@" $(pwd)
+echo 2>/dev/null -eu x=1 $(pwd) /usr/bin local $(pwd) ${HOME} ${HOME}
+		| then ${HOME} sed 2>/dev/null echo grep done
+sed $(pwd) && --verbose awk --verbose printf
+		$(pwd) && sed $(pwd) grep then x=1 --verbose
+	cd 'quoted text' && | done && cd local cd x=1 "$1" local | 'quoted text'
+		$(pwd) && -eu | $(pwd) -eu /usr/bin ${HOME} readonly /usr/bin "$1"
+	readonly grep 'quoted text' echo then export
+-eu awk sed then && export /usr/bin
+	--verbose -eu "$@" readonly | 'quoted text' x=1
+		awk | ${HOME} local "$@" --verbose ${HOME} && export "$@" local
+	local then awk local /usr/bin -eu 'quoted text' 2>/dev/null
+	"$1" ${HOME} export awk x=1 readonly /usr/bin printf then awk echo "$1" readonly
+	--verbose "$1" then sed x=1
+		test "$1" x=1 export -eu grep 'quoted text' -eu "$1" $(pwd) done 'quoted text'
+done printf done printf then test then -eu $(pwd) "$1"
+		printf then $(pwd) $(pwd) | printf "$@" "$1" then
+x=1 cd ${HOME} "$1" x=1 export && | done done "$1" x=1 readonly
+		test printf "$@" x=1 then local 2>/dev/null then "$1" --verbose
+readonly awk local "$@" && "$1" && sed 2>/dev/null x=1 | awk local
+		x=1 ${HOME} export readonly sed cd -eu echo
+	export then "$1" "$@" done && grep "$@" $(pwd)
+	cd "$1" readonly $(pwd) done export test cd "$@" done
+-eu "$@" && local | local 'quoted text' | --verbose
+		"$1" cd 'quoted text' sed grep cd cd 'quoted text' 2>/dev/null --verbose awk then
+	| /usr/bin then && readonly 2>/dev/null
+"$@" echo ${HOME} -eu grep --verbose /usr/bin sed
+		then awk ${HOME} done /usr/bin
+	test then test done then cd
+sed done 'quoted text' 2>/dev/null 2>/dev/null grep -eu test -eu readonly local
+	2>/dev/null ${HOME} && done local --verbose echo
+		sed then sed cd "$@" 'quoted text' "$1" x=1 sed test |
+	sed --verbose 2>/dev/null && printf 'quoted text' grep -eu local 'quoted text'
+echo | sed export cd readonly 'quoted text' "$1" -eu test then ${HOME}
+-eu "$1" x=1 ${HOME} test ${HOME} then | sed | /usr/bin sed 2>/dev/null
+/usr/bin 2>/dev/null && --verbose
+	"$@" echo then then x=1 'quoted text' --verbose done "$@"
+	local printf awk $(pwd) ${HOME} done
+echo --verbose local done sed 'quoted text' "$1" /usr/bin && "$1" | 2>/dev/null
+sed | sed awk /usr/bin echo cd $(pwd) printf
+readonly done -eu local sed local printf 2>/dev/null then readonly done -eu export
+	'quoted text' echo | "$1"
+x=1 echo $(pwd) local echo
+		awk then /usr/bin | $(pwd) && awk 'quoted text'
+'quoted text' export 2>/dev/null local 'quoted text' printf
+		then $(pwd) $(pwd) done test local
+x=1 2>/dev/null awk ${HOME} | |
+	test /usr/bin grep sed && ${HOME} 'quoted text' 2>/dev/null cd 2>/dev/null
+		$(pwd) cd "$1" printf export cd readonly
+readonly --verbose ${HOME} | then "$@" "$1" $(pwd)
+local x=1 sed $(pwd) x=1 --verbose export echo 'quoted text' --verbose
+		$(pwd) $(pwd) done printf x=1 printf printf x=1 x=1 echo cd 'quoted text' cd
+/usr/bin export done && "$@" then "$@" 'quoted text' done x=1
+	grep printf && 'quoted text' | -eu echo | sed $(pwd)
+done 'quoted text' --verbose | -eu then sed local "$1" awk printf readonly
+		'quoted text' --verbose x=1
+		-eu cd export && && 2>/dev/null
+2>/dev/null && | cd 'quoted text' readonly
+	echo --verbose export export | 2>/dev/null --verbose --verbose awk
+		sed done && local 2>/dev/null export done awk -eu
+${HOME} sed then | echo local echo 'quoted text'
+	"$1" done cd ${HOME} grep local --verbose then 2>/dev/null "$1" x=1 --verbose
+		local /usr/bin | ${HOME} local "$@" cd $(pwd) readonly
+	2>/dev/null "$@" done done x=1 ${HOME} | sed 'quoted text' export $(pwd)
+sed "$1" -eu ${HOME} -eu
+		2>/dev/null -eu echo grep local $(pwd) "$@" 2>/dev/null
+	--verbose export export | awk sed printf 'quoted text'
+grep --verbose && readonly then
+/usr/bin export 'quoted text' ${HOME} "$@" | && x=1 printf cd
+		"$@" 'quoted text' export
+		export /usr/bin $(pwd)
+		&& grep sed /usr/bin x=1
+	/usr/bin awk echo grep export readonly --verbose --verbose -eu 'quoted text'
+test "$1" "$1" echo && ${HOME} local && $(pwd)
+"$1" --verbose test 'quoted text' grep echo cd done | grep 2>/dev/null 2>/dev/null
+readonly -eu --verbose sed ${HOME} echo export 2>/dev/null grep -eu then $(pwd)
+		"$@" grep x=1 readonly $(pwd) grep --verbose | && cd --verbose done cd
+		"$@" /usr/bin /usr/bin cd --verbose 2>/dev/null
+readonly sed /usr/bin cd sed printf cd ${HOME} awk grep "$1" --verbose | /usr/bin
+		"$@" $(pwd) ${HOME} sed readonly | && grep awk
+		2>/dev/null /usr/bin test export
+&& "$1" printf then 'quoted text' test "$1" "$1" --verbose -eu "$1" /usr/bin &&
+		'quoted text' done x=1 'quoted text' x=1 local then
+		then export ${HOME} done
+	then && local printf export export --verbose
+	echo awk local export printf 2>/dev/null cd export | then "$1"
+local | 2>/dev/null && printf ${HOME}
+		done 2>/dev/null /usr/bin then --verbose "$@" local
+--verbose then $(pwd) readonly printf
+'quoted text' --verbose awk readonly "$@" export 2>/dev/null
+		grep --verbose printf export local done x=1 | local done | then
+echo 2>/dev/null x=1 ${HOME} then 2>/dev/null test -eu readonly readonly
+	/usr/bin "$1" "$@" awk readonly sed x=1 cd
+readonly $(pwd) 2>/dev/null ${HOME} export
+printf -eu 2>/dev/null then x=1 done -eu done done ${HOME} cd readonly && ${HOME}
+	export echo "$@" "$@" 'quoted text' "$1"
+	sed cd awk /usr/bin done -eu readonly readonly | "$@"
+cd local done grep 'quoted text'
+		${HOME} "$@" "$1" "$@" printf echo --verbose | -eu printf cd -eu export
+-eu "$1" printf --verbose 2>/dev/null 2>/dev/null -eu 'quoted text' printf --verbose
+	${HOME} x=1 ${HOME} printf readonly
+"$@" && done export 'quoted text' readonly 2>/dev/null
+export printf awk -eu "$1" 'quoted text'
+| x=1 "$@" cd | sed $(pwd) 2>/dev/null -eu export 'quoted text'
+"$1" --verbose --verbose && 2>/dev/null && x=1
+	done test local grep $(pwd) export local --verbose
+printf 'quoted text' grep ${HOME} x=1 'quoted text' echo export
+-eu 'quoted text' $(pwd) sed grep $(pwd) local "$@" && | export "$1"
+	sed /usr/bin export 2>/dev/null 2>/dev/null
+	sed && echo $(pwd) -eu 'quoted text'
+		echo -eu ${HOME} echo sed /usr/bin awk sed readonly grep
+| local readonly x=1 x=1 done x=1 local 'quoted text'
+	then ${HOME} | awk 'quoted text' -eu sed done "$@" --verbose awk printf done printf
+	"$1" 'quoted text' export 2>/dev/null grep printf readonly ${HOME}
+	then $(pwd) "$@" | -eu "$1" "$1" ${HOME} test
+		local sed /usr/bin 'quoted text'
+local 2>/dev/null awk readonly
+		&& cd grep --verbose 2>/dev/null
+	'quoted text' then sed 'quoted text' 2>/dev/null
+	sed x=1 "$@" cd 'quoted text' cd x=1 sed cd printf then awk export awk
+		readonly "$@" export readonly x=1 -eu readonly
+		export done 2>/dev/null /usr/bin awk echo test readonly
+	readonly 'quoted text' x=1 2>/dev/null awk | cd "$1" test x=1 test /usr/bin
+		x=1 cd ${HOME} grep readonly && cd test
+printf local sed cd ${HOME} done export --verbose
+| awk echo then local done echo readonly done local
+done test $(pwd) --verbose cd done | cd ${HOME} cd 'quoted text' --verbose test
+	-eu $(pwd) then local awk && /usr/bin ${HOME} 'quoted text' x=1 -eu local
+		2>/dev/null then grep done ${HOME} "$1" echo readonly "$@" && x=1 &&
+	| --verbose "$@" done 'quoted text' sed ${HOME} awk
+x=1 /usr/bin "$@" local /usr/bin 2>/dev/null sed export
+-eu printf then && echo readonly "$@"
+		grep test printf export export sed readonly test
+"$@" then printf 2>/dev/null sed $(pwd) grep
+		| /usr/bin then grep export readonly 2>/dev/null "$1" readonly ${HOME} then
+$(pwd) cd echo printf readonly /usr/bin "$@" "$@"
+$(pwd) readonly then 'quoted text'
+	--verbose then && local echo /usr/bin grep printf cd sed 'quoted text' -eu printf
+'quoted text' cd cd sed grep && /usr/bin cd 'quoted text' grep $(pwd) readonly
+echo test -eu awk local echo local /usr/bin
+-eu echo local cd test x=1 grep --verbose | local grep grep 2>/dev/null
+grep test readonly echo readonly "$@" local ${HOME} --verbose awk
+	readonly then ${HOME} /usr/bin grep $(pwd) awk sed | -eu printf done "$1"
+then echo test grep test
+		echo readonly /usr/bin done
+	export cd cd | "$1" 'quoted text'
+sed then done cd cd done echo echo cd sed /usr/bin sed --verbose "$1"
+test x=1 test local $(pwd) 'quoted text' x=1
+		grep "$@" echo | export local ${HOME} x=1 echo cd ${HOME} -eu test echo "$@" echo
+		/usr/bin grep 'quoted text' --verbose grep
+		${HOME} "$1" printf done local cd cd 2>/dev/null cd "$@" $(pwd) /usr/bin export
+local "$1" && done test /usr/bin "$1" &&
+"$@" -eu /usr/bin | -eu 'quoted text' /usr/bin
+	-eu "$@" $(pwd) && printf $(pwd) "$@" 2>/dev/null
+	-eu test awk /usr/bin printf printf
+	$(pwd) -eu 'quoted text' | | then echo -eu readonly echo readonly -eu
+'quoted text' -eu done ${HOME} 'quoted text'
+-eu 2>/dev/null "$1" grep x=1 'quoted text' "$@" local
+		export local $(pwd) -eu "$@" | grep -eu | cd -eu readonly -eu cd -eu printf export
+		--verbose export local $(pwd) 'quoted text'
+		${HOME} export printf sed sed printf x=1 "$1" export then $(pwd)
+"$@" x=1 -eu | /usr/bin test ${HOME} $(pwd) 2>/dev/null 'quoted text'
+done $(pwd) export export done
+		printf ${HOME} local /usr/bin
+		2>/dev/null readonly grep grep done 'quoted text' cd readonly
+	&& | $(pwd) $(pwd) 2>/dev/null 2>/dev/null then && sed sed readonly
+then export export grep cd then /usr/bin x=1 test 2>/dev/null cd 2>/dev/null
+	/usr/bin awk -eu export x=1 printf local | -eu --verbose test sed | && "$1" | "$1"
+		| printf "$@" sed test
+	$(pwd) "$@" test "$@" test printf && 2>/dev/null done -eu printf && readonly
+		${HOME} cd local x=1 cd 2>/dev/null --verbose done sed 2>/dev/null sed -eu export
+2>/dev/null 2>/dev/null "$@" /usr/bin test 'quoted text' 'quoted text'
+	awk 2>/dev/null grep 'quoted text' export --verbose printf --verbose
+		"$@" export echo local printf
+	"$@" export test awk -eu cd echo awk then export "$1" sed printf
+awk sed 2>/dev/null echo
+		then cd echo then local --verbose done test ${HOME} /usr/bin
+echo local "$1" test 2>/dev/null --verbose "$1" 2>/dev/null
+	echo /usr/bin "$1" readonly cd | test -eu -eu sed export local
+		-eu local done export awk && printf awk
+	/usr/bin -eu sed sed sed &&
+	| $(pwd) && sed 2>/dev/null done done then "$1" $(pwd) printf printf
+	awk cd 'quoted text' echo $(pwd) then readonly 'quoted text' && ${HOME} echo
+		x=1 "$1" cd local "$1" 'quoted text'
+	| $(pwd) 'quoted text' echo && readonly
+		-eu 'quoted text' echo $(pwd) /usr/bin x=1 "$1" ${HOME} grep test readonly
+		$(pwd) sed test test 'quoted text' cd readonly 2>/dev/null done
+		/usr/bin sed grep $(pwd) $(pwd) done cd --verbose grep done sed ${HOME} export
+export awk -eu local sed printf sed printf echo "$1" awk | | echo printf
+export echo /usr/bin cd "$1" 'quoted text'
+		local "$@" 'quoted text' then
+$(pwd) grep test --verbose 'quoted text'
+	then 2>/dev/null && cd | | /usr/bin grep | | | done export /usr/bin
+		"$1" -eu 2>/dev/null -eu grep readonly cd /usr/bin 2>/dev/null
+		${HOME} test "$1" cd -eu 'quoted text'
+		'quoted text' then /usr/bin && $(pwd) $(pwd)
+readonly 'quoted text' local -eu ${HOME} grep local awk ${HOME} "$@" printf -eu
+		awk 2>/dev/null sed $(pwd) cd local x=1 | test 2>/dev/null printf readonly
+		local test x=1 -eu --verbose sed | /usr/bin ${HOME} ${HOME} "$@" echo
+-eu /usr/bin x=1 --verbose 2>/dev/null /usr/bin 'quoted text'
+		printf | done sed ${HOME} grep export 'quoted text' x=1 grep awk "$@"
+		'quoted text' 2>/dev/null cd "$1" "$1"
+	"$1" "$@" cd local sed -eu echo test 'quoted text'
+		echo echo -eu cd "$@" readonly 'quoted text' "$@" "$1" done test readonly
+		done awk /usr/bin echo $(pwd) awk grep --verbose
+		printf 2>/dev/null "$1"
+then grep 'quoted text' local printf 2>/dev/null then sed --verbose cd --verbose
+		x=1 echo && then "$1" "$1" x=1 'quoted text'
+$(pwd) 'quoted text' | readonly
+	-eu awk ${HOME} done export $(pwd) $(pwd) readonly /usr/bin
+	export -eu | 'quoted text' | -eu
+		echo $(pwd) done "$@" export local ${HOME} then
+		&& export done 'quoted text' then printf cd sed
+${HOME} readonly cd $(pwd) echo test printf cd readonly
+		&& -eu x=1 printf "$@" ${HOME} sed "$1" && 'quoted text'
+		then awk && "$1" done ${HOME} 'quoted text'
+		--verbose "$@" then $(pwd) then
+	export "$1" local $(pwd)
+	sed "$1" then local local "$@" export x=1 /usr/bin ${HOME} && ${HOME}
+	| done sed readonly 2>/dev/null 'quoted text' "$@" --verbose
+	"$1" sed $(pwd) printf 2>/dev/null && && grep
+	-eu printf ${HOME} --verbose printf then done -eu
+	printf 2>/dev/null $(pwd) printf x=1 export "$1" --verbose "$1"
+	printf $(pwd) ${HOME} done "$1" cd x=1 readonly $(pwd)
+echo test readonly ${HOME} cd
+		done done local "$1" printf readonly echo test done echo sed
+	x=1 'quoted text' /usr/bin 'quoted text' sed printf /usr/bin --verbose echo
+readonly export /usr/bin printf "$@" test sed then sed && readonly ${HOME}
+		'quoted text' && /usr/bin 'quoted text' printf 2>/dev/null printf test
+	--verbose sed --verbose && 'quoted text' x=1 $(pwd) sed ${HOME} | done grep sed
+		awk 'quoted text' /usr/bin
+	local sed -eu && --verbose --verbose
+/usr/bin ${HOME} echo echo "$1" cd then printf awk "$@" cd
+	&& /usr/bin printf ${HOME} export readonly cd grep
+		awk x=1 -eu test then && done "$@" "$@" echo readonly -eu then then $(pwd)
+	readonly --verbose x=1 $(pwd) sed grep 'quoted text' readonly
+printf export --verbose 2>/dev/null
+		awk 2>/dev/null local cd done "$@" x=1 awk done
+then then readonly echo -eu done then
+		"$1" $(pwd) grep | done /usr/bin
+	then then readonly done -eu echo local && echo readonly x=1 &&
+grep $(pwd) /usr/bin 2>/dev/null printf
+echo "$@" done "$@" sed /usr/bin grep sed 2>/dev/null --verbose sed
+		then $(pwd) grep then local grep printf "$1"
+	$(pwd) --verbose local x=1 | local && /usr/bin
+${HOME} /usr/bin /usr/bin && | readonly local local -eu awk
+		test readonly readonly -eu 2>/dev/null
+		--verbose 2>/dev/null grep export -eu | /usr/bin
+	x=1 -eu cd done 'quoted text' -eu "$@" && readonly printf
+	cd 2>/dev/null export awk "$1"
+		"$1" local readonly "$@" sed
+	2>/dev/null readonly 2>/dev/null
+		'quoted text' printf $(pwd) echo cd 'quoted text' | --verbose then
+"$@" x=1 "$1" x=1 --verbose test -eu grep grep cd
+		"$@" $(pwd) grep ${HOME} /usr/bin && x=1 sed && cd sed 'quoted text' readonly
+awk test | --verbose /usr/bin $(pwd) 'quoted text'
+"$@" 'quoted text' "$1" && 2>/dev/null
+	sed export -eu 'quoted text' printf -eu && local x=1 export
+		local 2>/dev/null export echo echo awk sed 2>/dev/null readonly
+	export test --verbose 'quoted text' x=1 grep --verbose && cd
+readonly local export local && awk printf /usr/bin
+'quoted text' grep "$@" cd "$@" && test /usr/bin $(pwd) --verbose test printf -eu
+		"$@" "$1" $(pwd) "$1" ${HOME} done -eu 2>/dev/null cd export -eu then
+	-eu /usr/bin cd done "$1" then cd then $(pwd) --verbose
+test sed printf --verbose
+"$1" then echo 'quoted text' grep | grep "$1" test printf done --verbose
+	export /usr/bin done test --verbose cd &&
+&& cd then 'quoted text' 2>/dev/null
+	'quoted text' -eu export
+-eu then echo -eu 2>/dev/null then then $(pwd)
+		'quoted text' -eu local 'quoted text'
+		"$1" ${HOME} ${HOME} x=1 --verbose
+	x=1 grep $(pwd) done -eu "$@" sed x=1 test local readonly
+	cd export cd grep printf awk export local awk 'quoted text'
+-eu $(pwd) "$@" /usr/bin --verbose grep awk printf
+printf cd then --verbose "$1" cd grep --verbose cd "$@"
+		/usr/bin sed $(pwd) done printf export
+	| | sed awk && cd | /usr/bin $(pwd) awk cd "$@" cd x=1 echo
+		test 'quoted text' "$@" && -eu 2>/dev/null
+	2>/dev/null 'quoted text' printf 2>/dev/null test
+| awk done $(pwd) && | $(pwd)
+	--verbose /usr/bin --verbose local "$1" test test "$@" x=1
+	export grep --verbose ${HOME} 2>/dev/null
+		local | test then 2>/dev/null echo $(pwd) x=1 done cd sed && export local
+echo 'quoted text' -eu ${HOME} local test sed "$1" | echo readonly
+echo --verbose echo export printf echo -eu "$1" 2>/dev/null
+		sed /usr/bin test then done -eu $(pwd) | test ${HOME}
+	printf then cd local -eu export cd
+		sed && ${HOME} test echo sed echo
+		awk ${HOME} --verbose 2>/dev/null
+/usr/bin | readonly awk && $(pwd) x=1 'quoted text' ${HOME} --verbose echo
+		$(pwd) && then cd --verbose sed -eu "$@" /usr/bin --verbose 'quoted text' 2>/dev/null
+readonly x=1 && 2>/dev/null /usr/bin awk 'quoted text' done export
+	| done 'quoted text' "$1" then printf 'quoted text'
+		| $(pwd) x=1 "$1" 'quoted text' 2>/dev/null
+		"$1" $(pwd) export -eu 2>/dev/null /usr/bin 'quoted text' x=1 test
+awk "$1" && grep grep ${HOME} sed export $(pwd)
+	| | awk "$@" "$1" test printf test echo echo && sed done then readonly echo --verbose
+'quoted text' $(pwd) test 'quoted text' --verbose -eu "$@" && 'quoted text' echo
+		x=1 cd printf 2>/dev/null sed | echo sed printf && --verbose
+		x=1 $(pwd) readonly readonly x=1 printf | export $(pwd)
+cd --verbose -eu 'quoted text' x=1 | $(pwd) cd sed awk "$@" x=1 done "$1" 2>/dev/null
+export 'quoted text' --verbose |
+	2>/dev/null sed x=1 "$@" export printf x=1 /usr/bin
+local "$@" x=1 done done printf export
+then ${HOME} x=1 sed local cd 'quoted text' local test
+echo printf && 'quoted text' export --verbose awk test export export then grep
+	export local "$@" readonly done 2>/dev/null grep -eu /usr/bin ${HOME} "$1" awk /usr/bin
+		'quoted text' $(pwd) echo echo "$1"
+awk done -eu done $(pwd) test then readonly
+		awk && "$1" echo x=1 cd --verbose && export 'quoted text'
+		sed "$1" && then ${HOME} export sed 'quoted text'
+		export grep export ${HOME} awk && $(pwd) sed 2>/dev/null ${HOME} readonly echo
+"$1" export ${HOME} 2>/dev/null /usr/bin
+--verbose then local -eu
+		&& --verbose echo local test then $(pwd) done printf 2>/dev/null
+-eu x=1 test echo done | ${HOME} printf echo 'quoted text'
+	| readonly awk $(pwd) 2>/dev/null sed then $(pwd) | ${HOME} then
+x=1 $(pwd) export then --verbose /usr/bin readonly
+/usr/bin test "$@" test readonly export && 'quoted text' -eu --verbose
+		cd 2>/dev/null printf 'quoted text' sed
+		--verbose sed | local awk then then --verbose grep awk readonly awk
+test "$1" test echo test readonly printf test -eu local ${HOME}
+done export 'quoted text' test local cd readonly printf
+		awk done -eu printf $(pwd) readonly "$@" readonly export
+	local 'quoted text' printf x=1 export $(pwd) grep export readonly
+		$(pwd) /usr/bin echo "$1" grep readonly "$@" 'quoted text' $(pwd) echo printf
+sed echo readonly ${HOME} && test $(pwd) done readonly readonly cd test readonly
+&& $(pwd) echo 2>/dev/null x=1 test ${HOME}
+-eu export local 2>/dev/null cd then /usr/bin done test -eu -eu $(pwd) then
+		then echo echo --verbose 2>/dev/null export readonly done then && local grep
+		readonly $(pwd) local /usr/bin printf grep test
+$(pwd) awk then x=1 local
+export ${HOME} local x=1 export local export awk echo done 2>/dev/null cd
+sed | echo "$1" printf local sed | "$@" readonly 2>/dev/null
+		echo "$1" "$@" 2>/dev/null $(pwd) done done export | -eu 'quoted text' "$1" x=1
+x=1 --verbose /usr/bin ${HOME}
+	awk test done grep cd "$1" printf "$@" && awk 2>/dev/null local export --verbose
+	readonly --verbose "$@" | $(pwd)
+export export 'quoted text' 2>/dev/null $(pwd) test | printf && cd 'quoted text'
+		cd awk ${HOME} && printf local test done 2>/dev/null grep /usr/bin then
+	awk x=1 cd $(pwd) echo then local
+local export readonly 2>/dev/null test readonly readonly
+	2>/dev/null 'quoted text' echo ${HOME} "$@" && sed && awk done ${HOME} "$@"
+then readonly x=1 ${HOME} "$@" export "$@" | "$@" printf
+	readonly local grep cd "$1" x=1 awk "$1" x=1 x=1 /usr/bin x=1 then --verbose
+	done test "$1" export "$@" printf && x=1 2>/dev/null readonly -eu
+	2>/dev/null cd "$@" && 'quoted text' grep export | readonly
+&& "$1" --verbose "$@" echo done awk cd "$@" echo --verbose
+	cd 'quoted text' test export echo grep then 'quoted text' echo then export
+	sed -eu -eu /usr/bin export
+"$@" printf 2>/dev/null echo ${HOME} local "$@" test cd readonly
+	| /usr/bin readonly sed "$1" --verbose
+echo printf | "$1" $(pwd) $(pwd) 2>/dev/null -eu "$@" awk readonly readonly
+| x=1 local then $(pwd) --verbose cd grep 'quoted text' | && readonly cd "$1"
+		${HOME} x=1 -eu 2>/dev/null sed --verbose grep ${HOME}
+"$1" local printf x=1 sed then grep local 2>/dev/null 2>/dev/null
+	cd readonly "$@" printf && local local /usr/bin "$@" | cd
+export cd then test then /usr/bin
+	sed export "$@" echo local
+	2>/dev/null $(pwd) export sed
+		x=1 ${HOME} readonly test readonly &&
+		echo x=1 awk test echo && --verbose
+test export local "$@" test sed && "$1" 'quoted text' grep sed
+	test export --verbose /usr/bin test local
+export test readonly printf echo x=1 then && grep then done 2>/dev/null /usr/bin
+		then then "$@" --verbose grep grep $(pwd) then | "$1" 2>/dev/null
+		/usr/bin awk cd 2>/dev/null test x=1 /usr/bin local test local
+		done ${HOME} done ${HOME} test -eu
+	"$@" sed x=1 $(pwd) "$@" echo printf && --verbose done ${HOME}
+${HOME} printf done cd readonly "$1" printf then echo
+readonly "$1" readonly "$@" grep 2>/dev/null -eu x=1 /usr/bin 2>/dev/null -eu
+	${HOME} /usr/bin local "$@" /usr/bin x=1 then sed sed grep -eu done | x=1
+		readonly 2>/dev/null 2>/dev/null then test ${HOME} -eu && /usr/bin x=1 then && echo
+		echo readonly local $(pwd) test cd grep -eu sed then done echo | sed && echo
+		awk echo | sed x=1 export | -eu 'quoted text'
+x=1 x=1 done printf local 2>/dev/null then
+	| "$1" | sed "$1" local
+-eu 2>/dev/null /usr/bin
+		then printf grep readonly
+		export /usr/bin /usr/bin x=1
+		export x=1 /usr/bin && done local 2>/dev/null $(pwd) $(pwd) export --verbose
+	${HOME} 2>/dev/null test done readonly "$1" done -eu ${HOME}
+cd ${HOME} "$@" echo awk local export $(pwd) "$@" 'quoted text'
+export ${HOME} -eu --verbose -eu | sed ${HOME} 2>/dev/null printf ${HOME}
+		then "$@" done "$1" local "$1" cd "$@" done $(pwd) ${HOME} x=1 then printf
+"$@" printf x=1 -eu test readonly test cd && echo echo --verbose 2>/dev/null
+	${HOME} && "$@" --verbose readonly grep ${HOME} | ${HOME} export "$@"
+		export "$@" readonly x=1 'quoted text'
+	readonly local -eu $(pwd) test && printf
+	export 'quoted text' export readonly ${HOME} local cd && 'quoted text'
+	--verbose done "$@" $(pwd) 2>/dev/null echo
+		sed ${HOME} 'quoted text' export export
+	"$@" --verbose x=1 done export awk printf x=1 --verbose then --verbose "$@" 'quoted text'
+	/usr/bin x=1 | -eu -eu echo -eu printf then "$@" echo test
+cd then $(pwd) grep "$1" cd grep sed grep -eu sed grep echo printf
+	| /usr/bin printf test awk readonly local -eu 'quoted text'
+local local --verbose then readonly
+	/usr/bin 'quoted text' test sed | x=1 printf grep then 'quoted text' grep 2>/dev/null
+		2>/dev/null 2>/dev/null export | x=1 -eu --verbose echo cd sed done
+'quoted text' printf then 2>/dev/null
+${HOME} 'quoted text' local grep then /usr/bin x=1 readonly cd
+		done && sed -eu -eu done local $(pwd) --verbose test sed grep
+$(pwd) awk $(pwd) export local /usr/bin done
+		readonly | then then x=1 /usr/bin local 2>/dev/null -eu ${HOME} awk
+cd test -eu && awk x=1 -eu grep
+	readonly /usr/bin 'quoted text' sed /usr/bin
+	sed then local 'quoted text' 'quoted text' then $(pwd) -eu
+		export awk grep printf 'quoted text' echo sed done $(pwd) sed awk 'quoted text'
+2>/dev/null test "$@" ${HOME} | x=1 && awk echo | printf
+cd 'quoted text' && "$1" awk then 'quoted text'
+	awk x=1 readonly ${HOME} 2>/dev/null cd
+$(pwd) && ${HOME} x=1 grep sed done $(pwd) | x=1 readonly $(pwd)
+	'quoted text' sed cd awk cd test /usr/bin
+/usr/bin /usr/bin "$1" export && | export grep then test readonly | awk test | local
+		&& x=1 awk $(pwd) --verbose "$1" && grep
+	&& $(pwd) ${HOME} grep && $(pwd) | done export && "$@" $(pwd) local "$1" "$@" |
+	${HOME} grep cd awk 'quoted text' 2>/dev/null
+		"$1" | awk local /usr/bin
+"$1" --verbose cd x=1 export 'quoted text' | done readonly
+/usr/bin ${HOME} "$1"
+		${HOME} ${HOME} && /usr/bin "$1" readonly && echo local awk ${HOME} "$1" done
+		&& grep x=1 echo test /usr/bin
+	-eu awk local "$1" local done x=1 cd 2>/dev/null awk && "$@"
+		&& awk then export then awk "$1"
+	cd "$1" && -eu readonly local sed then 'quoted text' sed echo -eu "$1"
+	-eu "$@" test then printf sed done test
+		| /usr/bin then "$1" 2>/dev/null -eu --verbose
+	local 2>/dev/null ${HOME} readonly x=1 done x=1 test 2>/dev/null awk
+	"$1" readonly echo done $(pwd) /usr/bin "$@" echo then /usr/bin /usr/bin local
+	printf sed 'quoted text' 'quoted text' ${HOME} cd readonly /usr/bin && printf
+awk x=1 -eu local grep printf 2>/dev/null
+		awk $(pwd) "$1" done cd export 'quoted text' cd 2>/dev/null && test test 'quoted text'
+	&& ${HOME} grep readonly -eu 2>/dev/null
+		/usr/bin x=1 --verbose test
+	"$1" && sed export printf x=1 | -eu sed printf
+	readonly test -eu export
+	export x=1 ${HOME} "$@" && readonly local $(pwd) 'quoted text' --verbose
+export x=1 then cd test 2>/dev/null 2>/dev/null
+	"$1" local then x=1 --verbose local grep readonly
+	2>/dev/null sed local export
+cd export -eu sed sed echo
+		readonly && test then && local awk sed "$1"
+| x=1 x=1 'quoted text' | && x=1 grep $(pwd) local done
+echo "$1" && then $(pwd) --verbose
+	done done readonly && printf
+		cd cd ${HOME} then sed "$@" x=1 export && cd 2>/dev/null ${HOME} $(pwd)
+printf $(pwd) -eu 'quoted text' 'quoted text' "$@" done echo --verbose local
+		"$1" local "$@" awk done test x=1 done /usr/bin $(pwd) x=1 echo /usr/bin "$@"
+		done test readonly x=1 local grep && readonly then |
+	2>/dev/null && local grep grep -eu -eu awk /usr/bin x=1 ${HOME} done x=1 /usr/bin
+&& | "$@" grep --verbose echo cd cd then sed && && local x=1 /usr/bin
+$(pwd) sed awk local $(pwd) grep done
+	/usr/bin local awk cd echo ${HOME} 'quoted text' done
+	${HOME} cd cd sed grep && local 2>/dev/null export ${HOME} x=1
+		awk test /usr/bin $(pwd)
+	done --verbose ${HOME} export test awk awk done "$@" grep
+		grep cd printf done "$1" --verbose cd -eu $(pwd)
+		${HOME} $(pwd) then ${HOME} "$@" 'quoted text'
+	"$@" /usr/bin printf && "$@"
+		$(pwd) readonly then done -eu && echo sed export
+		echo printf then grep --verbose "$1" x=1 echo printf
+	x=1 readonly sed local awk --verbose test
+/usr/bin --verbose &&
+	grep done export 'quoted text' 'quoted text'
+test | --verbose done grep "$@" | local "$@" grep local
+		sed && awk readonly awk test --verbose awk x=1 | 'quoted text'
+grep | local grep local then /usr/bin x=1 && ${HOME}
+x=1 "$1" /usr/bin readonly export /usr/bin test --verbose export
+		test ${HOME} export "$@" printf awk test --verbose awk test 'quoted text' ${HOME}
+		awk done $(pwd) sed $(pwd) echo cd --verbose ${HOME}
+		awk test && 'quoted text' /usr/bin
+		readonly local export export echo done -eu then x=1 sed 2>/dev/null -eu 'quoted text'
+	grep -eu | grep export 'quoted text' done "$1" "$1" echo
+--verbose local && -eu then "$1" --verbose grep x=1 -eu
+sed echo awk printf cd "$1" export -eu /usr/bin --verbose
+	'quoted text' sed local done "$@" awk --verbose done printf done readonly test
+	readonly test local done
+	awk ${HOME} echo echo
+		-eu -eu then test sed sed done ${HOME} cd /usr/bin
+	| $(pwd) | 2>/dev/null | 2>/dev/null x=1 2>/dev/null awk sed
+cd printf then "$1" grep $(pwd) x=1 /usr/bin grep 'quoted text'
+		grep 2>/dev/null && echo x=1 && printf ${HOME} cd awk x=1 printf
+${HOME} done "$1" readonly then x=1 grep
+local 'quoted text' ${HOME} --verbose export local | "$@" $(pwd)
+$(pwd) $(pwd) 'quoted text' readonly 2>/dev/null
+		test x=1 local && -eu readonly done
+"$@" "$@" printf sed -eu && &&
+		awk printf && $(pwd) then --verbose -eu &&
+/usr/bin ${HOME} 'quoted text' readonly
+$(pwd) test | sed sed ${HOME} --verbose --verbose "$@" && readonly readonly
+	x=1 echo ${HOME} ${HOME} echo grep "$@" local --verbose
+	awk test readonly /usr/bin 2>/dev/null done x=1 readonly --verbose "$1" "$@" readonly
+	printf local sed awk 2>/dev/null echo /usr/bin then -eu
+${HOME} 2>/dev/null 'quoted text' x=1 'quoted text' done 'quoted text' printf
+'quoted text' /usr/bin printf 2>/dev/null awk "$1" | $(pwd) 2>/dev/null
+	-eu readonly echo cd export
+--verbose then readonly "$@" sed "$@" x=1 cd echo
+	cd x=1 "$@" -eu done && /usr/bin done
+		2>/dev/null printf /usr/bin -eu --verbose ${HOME}
+		-eu "$1" grep done then awk 2>/dev/null
+		export $(pwd) test export ${HOME} | grep && awk grep 2>/dev/null
+sed /usr/bin local x=1
+-eu "$@" "$@" $(pwd) done ${HOME} export readonly 2>/dev/null
+awk awk "$1" test printf -eu done echo
+	"$@" $(pwd) /usr/bin then test done cd export readonly
+printf ${HOME} && 2>/dev/null
+	grep | grep "$@" | then /usr/bin local
+echo -eu printf test export "$@" grep /usr/bin echo test x=1 awk
+	"$@" then 'quoted text' "$@" -eu "$@" /usr/bin 'quoted text' printf 'quoted text'
+		cd 2>/dev/null --verbose printf "$@" readonly printf /usr/bin x=1 "$1" cd
+	sed readonly grep sed "$1" ${HOME} export 2>/dev/null echo done local export ${HOME}
+		'quoted text' $(pwd) "$1" then readonly grep ${HOME} "$@" test "$1" echo
+	/usr/bin ${HOME} printf done readonly echo awk x=1 readonly
+awk export test 'quoted text' test $(pwd) --verbose test
+"$@" $(pwd) grep "$@" local cd $(pwd) printf printf
+sed 2>/dev/null "$1" /usr/bin x=1 ${HOME}
+		echo /usr/bin grep printf printf export
+	sed cd local $(pwd) echo "$@" $(pwd) sed printf
+		--verbose echo x=1 readonly printf 2>/dev/null
+export export grep printf --verbose cd $(pwd) "$1" $(pwd) /usr/bin
+grep | awk | 'quoted text' grep test
+$(pwd) --verbose printf /usr/bin done x=1 2>/dev/null
+$(pwd) 2>/dev/null then "$@" test done local "$1" ${HOME} sed
+		done && readonly $(pwd) 'quoted text' | 2>/dev/null done
+local x=1 ${HOME} done
+		readonly "$1" --verbose x=1 2>/dev/null sed local test sed
+readonly -eu echo 2>/dev/null 2>/dev/null awk ${HOME} then ${HOME} | awk readonly
+		local "$1" ${HOME} x=1 ${HOME} ${HOME} local then "$1" export printf "$1"
+$(pwd) test | 2>/dev/null readonly "$@" -eu readonly printf
+	x=1 /usr/bin then x=1 then | ${HOME} grep test test /usr/bin
+/usr/bin done && 2>/dev/null /usr/bin awk cd "$1" --verbose "$@" grep grep
+2>/dev/null /usr/bin 2>/dev/null --verbose awk --verbose
+grep "$@" grep done "$1" test x=1 ${HOME} cd local
+		cd export cd echo grep sed "$1" "$1" awk $(pwd) done 2>/dev/null
+export local export $(pwd)
+	"$1" "$@" printf x=1 --verbose export local /usr/bin && grep
+		/usr/bin sed local echo then "$@" printf 'quoted text'
+	then local | /usr/bin "$1" test && sed sed readonly done export "$@" then ${HOME}
+		local cd awk then local local 'quoted text' -eu
+	printf echo done local readonly 'quoted text' local 2>/dev/null test | printf -eu
+		x=1 awk 2>/dev/null 'quoted text'
+grep $(pwd) ${HOME} readonly -eu 2>/dev/null
+	"$@" export "$1" echo ${HOME} printf ${HOME}
+&& 2>/dev/null | echo && $(pwd) sed $(pwd) sed awk -eu /usr/bin awk test --verbose
+	--verbose awk awk echo local
+	local -eu "$1" -eu then then 'quoted text' | awk $(pwd) then 'quoted text'
+sed "$@" "$@" local "$1" -eu grep done 2>/dev/null
+cd ${HOME} 2>/dev/null local local then cd then
+| --verbose ${HOME} --verbose awk awk
+		sed ${HOME} $(pwd) readonly awk awk local
+test -eu awk grep sed 2>/dev/null printf -eu
+"$@" grep printf cd --verbose x=1 export "$1" grep sed && export $(pwd) done
+		"$1" -eu cd grep test "$@" local
+"$1" -eu 2>/dev/null awk "$1" grep
+	test local --verbose test 2>/dev/null cd export
+		grep readonly /usr/bin readonly -eu 2>/dev/null grep | export local
+"$@" printf /usr/bin test readonly
+	sed ${HOME} export test && $(pwd) test "$1" export export 'quoted text' echo
+	/usr/bin -eu test | local "$1" --verbose $(pwd) x=1
+	cd grep test "$@" echo readonly
+"$@" echo readonly /usr/bin "$1" 2>/dev/null then 'quoted text'
+		sed $(pwd) 2>/dev/null /usr/bin export cd
+	&& test "$1" && /usr/bin x=1 -eu /usr/bin x=1 test
+		$(pwd) local grep awk awk sed && export x=1
+| then export ${HOME} | export --verbose ${HOME} x=1 local cd cd "$1"
+-eu sed printf /usr/bin local &&
+--verbose ${HOME} grep readonly done && cd echo -eu test done --verbose
+	x=1 ${HOME} done && "$1" test awk local $(pwd) readonly
+${HOME} && readonly | printf cd ${HOME} && | ${HOME} done cd $(pwd) -eu
+readonly | then then echo $(pwd) ${HOME} sed
+x=1 cd grep "$1" $(pwd) | readonly sed 'quoted text'
+	printf grep awk -eu readonly grep $(pwd)
+	done x=1 2>/dev/null then readonly grep 2>/dev/null
+		sed $(pwd) grep then
@@ -0,0 +1,2001 @@
+x=1 $(pwd) "$@" /usr/bin "$1"
+	| "$1" "$1" && -eu printf x=1 'quoted text' cd test --verbose --verbose
+		"$1" echo 2>/dev/null export sed done $(pwd) test /usr/bin sed
+-eu grep done awk grep x=1 --verbose readonly
+then 'quoted text' echo export 2>/dev/null
+	export "$1" printf done then done | --verbose sed echo local "$1" | grep /usr/bin
+	sed --verbose local "$1" done grep && done awk 'quoted text'
+printf "$1" export "$@" readonly -eu export
+	"$1" "$1" 2>/dev/null x=1 test awk sed "$1" "$1" -eu export readonly "$1" --verbose
+		${HOME} printf awk "$@" grep | ${HOME} cd done readonly x=1 $(pwd) readonly
+	"$1" printf cd --verbose 2>/dev/null grep done
+	export --verbose local -eu
+-eu test && $(pwd) /usr/bin -eu done "$1" 2>/dev/null printf | readonly
+		--verbose | then && --verbose sed readonly "$@" /usr/bin
+		local "$@" export readonly then "$@" 'quoted text' ${HOME} /usr/bin
+export | --verbose ${HOME} cd export "$@" sed -eu sed readonly done
+		2>/dev/null cd -eu 'quoted text' -eu
+		$(pwd) | printf local /usr/bin ${HOME} && cd x=1 "$@" --verbose "$1" &&
+		2>/dev/null ${HOME} ${HOME} test readonly local "$@" /usr/bin && /usr/bin
+/usr/bin "$@" /usr/bin
+		grep | cd export $(pwd) export test | $(pwd) $(pwd) "$@" 'quoted text' ${HOME}
+	grep --verbose | grep cd awk awk -eu test
+	readonly cd --verbose "$@" awk export test
+		&& 2>/dev/null --verbose $(pwd) "$1" printf then awk then $(pwd)
+export grep grep $(pwd) test test echo -eu readonly export then --verbose
+		&& export && cd 2>/dev/null printf done export awk ${HOME} test
+"$1" export /usr/bin test
+	x=1 printf done printf ${HOME} && /usr/bin /usr/bin "$1" sed local $(pwd) $(pwd)
+x=1 cd cd readonly echo awk x=1
+	${HOME} "$@" export export --verbose && export awk
+x=1 'quoted text' x=1 cd sed "$@" ${HOME} printf
+	-eu awk && cd awk export then
+		x=1 -eu 2>/dev/null readonly export awk
+		grep $(pwd) local -eu $(pwd) done grep awk 2>/dev/null readonly sed "$1" printf
+	echo then "$@" "$@" awk readonly /usr/bin && done -eu && x=1 ${HOME} && -eu
+	printf test echo 'quoted text' "$@" /usr/bin
+${HOME} x=1 "$1" test | "$@" readonly local printf 'quoted text' export
+		'quoted text' sed && ${HOME} echo test /usr/bin
+		'quoted text' echo $(pwd) sed && test -eu
+	"$1" /usr/bin printf export cd printf readonly 2>/dev/null echo echo 'quoted text'
+		${HOME} cd --verbose "$@" /usr/bin awk readonly grep x=1 -eu done /usr/bin echo
+	grep readonly test cd local $(pwd) x=1 export ${HOME} cd test ${HOME}
+	echo --verbose readonly export 'quoted text' -eu done export $(pwd)
+| "$@" local x=1 then cd ${HOME} -eu awk | echo readonly sed ${HOME} export
+grep test printf cd test ${HOME} test "$1" cd export -eu awk "$@" 2>/dev/null
+	test | export --verbose "$1" echo readonly
+		2>/dev/null --verbose done 2>/dev/null -eu "$@" ${HOME} "$1" cd -eu x=1
+awk && printf "$@" cd done | && --verbose export /usr/bin --verbose 2>/dev/null
+		awk sed cd -eu --verbose grep then $(pwd) -eu | | /usr/bin "$1"
+		printf 'quoted text' $(pwd) then 2>/dev/null grep awk | cd then /usr/bin
+	echo -eu x=1 | then local "$1" 2>/dev/null
+	local --verbose cd readonly done grep
+	${HOME} printf -eu "$@" sed --verbose
+	&& /usr/bin cd /usr/bin 'quoted text' $(pwd) awk printf done
+awk ${HOME} x=1 sed echo $(pwd) sed readonly sed cd
+		| /usr/bin cd awk readonly
+		x=1 "$1" 'quoted text' printf done local
+		${HOME} x=1 'quoted text' echo done | "$1" export awk test 2>/dev/null sed | &&
+	grep ${HOME} local done $(pwd) ${HOME} echo
+		cd "$@" 'quoted text' 2>/dev/null --verbose local export done
+	awk test done printf && -eu $(pwd) readonly test grep readonly
+	| echo readonly ${HOME} readonly printf 'quoted text' printf printf
+x=1 $(pwd) /usr/bin echo then
+--verbose x=1 'quoted text' "$1" && sed then export awk
+	&& test | grep && /usr/bin then export --verbose x=1 ${HOME} 'quoted text'
+	--verbose "$@" done sed printf "$1" grep sed --verbose
+cd /usr/bin | export --verbose then --verbose
+	local grep echo | done awk export echo then 'quoted text'
+	2>/dev/null export echo x=1 test 2>/dev/null
+--verbose done awk echo x=1 $(pwd) | | cd --verbose sed "$1" --verbose
+	--verbose grep export grep echo awk && 'quoted text' awk -eu 'quoted text' awk
+-eu "$1" "$@" && x=1 $(pwd) ${HOME} | -eu test done ${HOME}
+$(pwd) then x=1 local --verbose echo printf "$1" /usr/bin && 2>/dev/null /usr/bin
+		/usr/bin readonly grep /usr/bin export --verbose
+	x=1 test "$1" readonly readonly x=1 /usr/bin --verbose "$1" ${HOME} echo
+'quoted text' readonly /usr/bin --verbose $(pwd)
+		/usr/bin --verbose export grep readonly
+		test 2>/dev/null then "$1"
+-eu sed x=1 echo sed 2>/dev/null ${HOME} export 2>/dev/null $(pwd) | export printf
+'quoted text' | export --verbose "$1" "$1" /usr/bin $(pwd) echo /usr/bin 'quoted text'
+		/usr/bin x=1 -eu done | -eu && grep 2>/dev/null
+	x=1 echo /usr/bin 2>/dev/null
+		local --verbose echo cd echo printf && 2>/dev/null printf
+		--verbose done readonly && /usr/bin ${HOME} done && awk then 'quoted text'
+		then -eu x=1 2>/dev/null "$1" local test $(pwd)
+		--verbose cd grep x=1 -eu done readonly "$@" sed ${HOME}
+2>/dev/null 'quoted text' printf
+${HOME} --verbose readonly grep 'quoted text' readonly then then --verbose
+	'quoted text' /usr/bin test awk readonly
+	--verbose 2>/dev/null -eu && test cd
+		sed x=1 printf -eu readonly test -eu /usr/bin sed 'quoted text' awk | done
+	printf local ${HOME} awk test sed "$@" printf
+	readonly --verbose cd test 'quoted text' grep test done local "$1" awk "$@"
+/usr/bin "$1" -eu --verbose
+		echo | "$1" 2>/dev/null echo then
+		&& then grep export ${HOME} printf -eu "$@" 2>/dev/null
+	test x=1 readonly $(pwd) local --verbose then /usr/bin sed -eu x=1 ${HOME} then
+	-eu cd export printf $(pwd) echo
+	/usr/bin cd && cd readonly $(pwd) $(pwd) 'quoted text' | export echo && then grep
+	"$1" | readonly done cd readonly
+		then 2>/dev/null echo x=1 "$1" "$1"
+done $(pwd) then -eu done | sed sed | done readonly ${HOME}
+		then 'quoted text' export readonly
+		grep $(pwd) ${HOME} 'quoted text' "$@" "$@" /usr/bin then
+	test awk done ${HOME} sed echo x=1 x=1 ${HOME} awk "$1" ${HOME}
+	--verbose "$1" printf --verbose sed --verbose --verbose "$1" awk test
+		x=1 then local awk printf
+echo x=1 echo --verbose echo sed
+		awk grep && | test done | grep "$@" done $(pwd) &&
+		echo --verbose /usr/bin cd awk ${HOME} $(pwd) ${HOME} grep "$1" sed
+		"$1" printf 2>/dev/null $(pwd)
+	${HOME} $(pwd) local then | ${HOME} test done 2>/dev/null
+		grep sed /usr/bin "$1" x=1 echo ${HOME} done
+		then export "$@" && cd | sed | --verbose "$@" done printf && export && printf
+	"$@" grep ${HOME} export "$1" "$1" "$@" export 2>/dev/null -eu "$1" -eu
+	printf "$1" ${HOME} done 'quoted text' readonly test x=1 $(pwd) echo done then
+		test --verbose cd 2>/dev/null readonly readonly sed
+2>/dev/null /usr/bin echo --verbose readonly -eu readonly
+| x=1 awk grep grep "$@" 2>/dev/null
+"$1" readonly test grep local "$1" && grep then 2>/dev/null sed | test
+	| awk ${HOME} ${HOME} x=1
+| readonly test -eu x=1 -eu sed 2>/dev/null /usr/bin /usr/bin
+--verbose "$1" export "$1" test 2>/dev/null
+	cd 2>/dev/null $(pwd) export x=1 test
+	test cd printf then 2>/dev/null 'quoted text'
+	"$1" export $(pwd) test $(pwd) echo test done cd
+printf printf export printf done 'quoted text' echo test
+	readonly printf "$1" ${HOME} export "$1" test
+		| x=1 ${HOME} local "$@" -eu | printf local export cd 'quoted text'
+		x=1 then 2>/dev/null cd then
+		"$1" then --verbose done -eu export ${HOME} 'quoted text'
+	--verbose && printf $(pwd) then
+		2>/dev/null x=1 /usr/bin awk "$@" 'quoted text'
+	then grep "$1" "$1" && 'quoted text'
+	| cd 2>/dev/null --verbose test grep x=1 2>/dev/null 'quoted text' readonly sed
+then printf test cd printf -eu export local local cd &&
+sed "$1" readonly sed done -eu local
+then grep sed /usr/bin && readonly /usr/bin -eu 'quoted text' grep echo x=1 'quoted text'
+export /usr/bin "$@" readonly && readonly | | readonly ${HOME} awk
+		echo echo 2>/dev/null 'quoted text' 2>/dev/null "$1" test local
+		-eu printf 2>/dev/null local --verbose export grep /usr/bin cd readonly done
+	"$@" "$1" then cd | && 2>/dev/null "$@" ${HOME} awk sed "$1"
+	grep --verbose printf $(pwd) printf "$@" --verbose then done
+	${HOME} 2>/dev/null printf done -eu x=1
+printf sed grep done test 'quoted text' | -eu $(pwd) --verbose readonly then
+	"$1" export "$@" "$@" /usr/bin 'quoted text' cd cd "$1" x=1 -eu 'quoted text'
+-eu test /usr/bin | "$1" /usr/bin
+printf x=1 local local -eu test 2>/dev/null --verbose done
+	readonly test printf x=1 then
+| 'quoted text' 2>/dev/null && 'quoted text' | echo printf
+echo | test readonly export
+	echo cd "$1" ${HOME} sed
+cd -eu --verbose then ${HOME} then
+		$(pwd) test echo test && sed /usr/bin && test "$@" local
+	done x=1 && | local ${HOME} export export readonly
+		sed local 2>/dev/null done x=1 && export
+		cd then export grep test "$@" cd
+	then grep printf export 2>/dev/null
+local echo test export sed "$@" /usr/bin local
+		printf cd awk awk printf x=1 |
+		"$1" /usr/bin cd printf && | echo printf $(pwd) 'quoted text'
+'quoted text' then | cd grep then && awk ${HOME} $(pwd) --verbose grep --verbose
+sed "$1" then 2>/dev/null test readonly -eu cd
+	"$@" "$@" "$@" printf $(pwd) printf "$1" sed done 'quoted text' readonly
+| readonly export && "$@" export $(pwd) && 2>/dev/null
+	printf "$1" "$1" "$1" printf sed grep /usr/bin 'quoted text' "$@" local 'quoted text'
+	2>/dev/null 'quoted text' export -eu test done echo "$1" && && readonly
+	$(pwd) cd readonly | --verbose
+x=1 test grep "$@" "$@" awk done cd "$@" readonly then "$@" |
+	--verbose sed | grep &&
+	| then sed local echo readonly x=1 2>/dev/null sed done
+test "$1" grep $(pwd) done echo
+	sed "$1" 'quoted text' grep local /usr/bin
+	done cd readonly then echo x=1 awk readonly "$@" cd local done "$@"
+		$(pwd) "$@" readonly /usr/bin /usr/bin
+	local x=1 "$@" readonly --verbose "$1" cd "$@" sed -eu && --verbose cd
+	local sed | -eu then $(pwd) done
+		test then printf export 'quoted text'
+	2>/dev/null 2>/dev/null grep awk awk -eu readonly ${HOME} export readonly $(pwd)
+	then 2>/dev/null --verbose x=1 2>/dev/null "$@"
+		"$1" "$1" 'quoted text' --verbose | export -eu "$1" "$@" | 2>/dev/null && test readonly
+	${HOME} sed --verbose cd ${HOME} && test -eu $(pwd)
+x=1 && /usr/bin test awk ${HOME} ${HOME}
+		then sed export 'quoted text' x=1
+cd then && sed /usr/bin local
+		"$@" cd "$1" && echo printf 2>/dev/null x=1
+then /usr/bin /usr/bin "$1" 'quoted text'
+	local printf export && export cd 'quoted text' export printf
+readonly local readonly 2>/dev/null
+		grep "$1" done --verbose printf
+$(pwd) $(pwd) sed readonly 'quoted text' | --verbose ${HOME} "$1" /usr/bin
+	x=1 $(pwd) grep $(pwd) 'quoted text' export 'quoted text'
+	/usr/bin /usr/bin then sed echo cd export
+		-eu "$1" done && awk |
+		&& --verbose "$@" cd cd cd "$@" echo
+		/usr/bin cd "$1" echo 'quoted text' grep "$1" 'quoted text' export
+	x=1 echo export -eu done readonly 'quoted text' echo 2>/dev/null
+grep sed printf grep ${HOME} --verbose $(pwd)
+then 2>/dev/null sed grep && local then awk awk $(pwd) ${HOME}
+		printf 2>/dev/null 2>/dev/null
+	done 2>/dev/null grep local --verbose ${HOME} test
+		--verbose --verbose echo printf 2>/dev/null done "$1" awk $(pwd) export
+		x=1 "$@" $(pwd) then /usr/bin --verbose 2>/dev/null "$1" ${HOME} -eu
+		readonly 'quoted text' -eu echo local sed && x=1
+	echo "$1" ${HOME} grep then then $(pwd) readonly echo grep && /usr/bin 'quoted text'
+		--verbose | | printf export 'quoted text' $(pwd)
+		--verbose readonly echo | | local
+	done awk then "$1" x=1 export "$@" done /usr/bin printf
+awk "$1" ${HOME} 2>/dev/null -eu 'quoted text' && x=1 "$1" "$1" readonly
+	${HOME} awk done grep && -eu readonly "$1" 'quoted text'
+export -eu 'quoted text' test
+	test then "$1" /usr/bin awk
+"$1" printf ${HOME} 'quoted text' && printf echo "$1" 2>/dev/null && --verbose $(pwd)
+	echo --verbose grep ${HOME} /usr/bin
+"$1" readonly printf test
+2>/dev/null 2>/dev/null printf local local x=1 "$1"
+	then printf awk "$@" x=1 2>/dev/null
+	&& awk readonly 2>/dev/null test -eu grep test $(pwd) grep
+		readonly test export
+	awk sed && | done readonly awk "$1" done --verbose 'quoted text' echo x=1
+then 'quoted text' done printf
+		"$@" ${HOME} $(pwd) awk ${HOME} "$@" x=1 awk 2>/dev/null
+	--verbose -eu ${HOME} grep $(pwd) $(pwd) echo grep x=1 grep awk 'quoted text'
+	2>/dev/null | 'quoted text' | cd sed readonly export && awk grep
+echo x=1 ${HOME} then 'quoted text' awk grep awk done done | /usr/bin
+		'quoted text' ${HOME} awk -eu | test test export cd done test awk "$@" test
+$(pwd) test 2>/dev/null -eu
+		| sed $(pwd) x=1 'quoted text' done /usr/bin 2>/dev/null 2>/dev/null
+readonly grep awk | && cd 2>/dev/null test --verbose
+	done local echo local x=1
+	readonly | export -eu cd then test awk grep
+sed x=1 /usr/bin export | cd done 'quoted text'
+-eu 'quoted text' ${HOME} | echo export
+	printf grep done echo ${HOME} $(pwd) /usr/bin $(pwd) $(pwd) && cd echo grep
+		awk /usr/bin -eu printf test ${HOME} "$@" readonly readonly
+		cd 'quoted text' | local
+echo then ${HOME} && 2>/dev/null 2>/dev/null -eu $(pwd) 'quoted text'
+	then cd /usr/bin -eu && test test
+		"$1" $(pwd) --verbose 2>/dev/null -eu x=1 "$1" /usr/bin "$1" -eu printf && "$@"
+2>/dev/null sed sed done echo grep -eu awk "$@" readonly test $(pwd) test printf
+&& ${HOME} "$@" echo 2>/dev/null --verbose 'quoted text' | --verbose export
+		2>/dev/null 'quoted text' echo readonly then "$@" /usr/bin
+-eu grep sed 'quoted text' ${HOME} cd -eu -eu done && awk grep awk export "$@"
+$(pwd) done export --verbose printf "$1" x=1
+		printf test x=1 $(pwd) printf -eu /usr/bin
+then local ${HOME} 'quoted text' done done awk "$1" done "$1" printf
+		&& | "$1" sed readonly then test $(pwd)
+	x=1 sed && /usr/bin awk "$1"
+	local grep echo "$@" printf
+		local then local "$@" sed echo 2>/dev/null $(pwd) test printf
+--verbose local printf ${HOME} printf --verbose
+	/usr/bin -eu 2>/dev/null "$1" | 2>/dev/null echo x=1 $(pwd)
+		local | "$1" "$@" x=1 "$@" | -eu export done 'quoted text'
+	test && local then -eu && awk "$1" && cd -eu grep test x=1 sed echo 'quoted text'
+	awk ${HOME} export test x=1 "$1" "$1" 'quoted text' "$@" |
+	$(pwd) x=1 test && sed done readonly
+		-eu sed export | | "$1" local export done cd 2>/dev/null
+	then sed x=1 --verbose readonly /usr/bin --verbose /usr/bin -eu $(pwd)
+--verbose | | sed 2>/dev/null
+/usr/bin | $(pwd) echo sed ${HOME} readonly sed readonly
+	grep -eu "$1" then test ${HOME} && done /usr/bin $(pwd) "$@"
+		2>/dev/null "$@" cd sed then
+	echo local local printf grep export $(pwd) awk | echo
+export "$@" grep test echo sed $(pwd) "$1" local --verbose 'quoted text' ${HOME}
+--verbose $(pwd) echo export /usr/bin x=1 /usr/bin 'quoted text'
+		cd echo --verbose printf "$1" export done sed 'quoted text' readonly grep
+	"$1" -eu done cd test $(pwd) ${HOME} "$@" export awk | grep
+		"$1" 'quoted text' "$@" x=1 && readonly done --verbose ${HOME} ${HOME} awk
+"$@" done sed "$1" "$@" printf grep then "$@" 2>/dev/null then test
+	readonly grep printf 2>/dev/null && 2>/dev/null
+	'quoted text' cd then echo --verbose readonly export
+	"$1" "$1" readonly printf then && --verbose readonly 'quoted text' test
+local -eu printf /usr/bin test ${HOME} "$1" cd /usr/bin "$@" ${HOME}
+$(pwd) "$1" && ${HOME} test printf "$@" local --verbose /usr/bin awk $(pwd) x=1
+	cd awk local /usr/bin /usr/bin test cd
+	-eu grep x=1 'quoted text' export cd $(pwd) test local ${HOME}
+	&& sed /usr/bin x=1 --verbose
+		$(pwd) | x=1 cd "$@" ${HOME} "$1" "$@" done printf --verbose | "$@"
+"$1" printf awk local "$1" cd x=1 local
+		"$1" echo --verbose $(pwd) echo 2>/dev/null cd "$@" 'quoted text'
+	readonly x=1 /usr/bin readonly "$1" done export test ${HOME} 2>/dev/null
+		awk $(pwd) test printf grep -eu && -eu ${HOME} sed readonly sed $(pwd) $(pwd)
+	echo export printf awk "$1" -eu "$1" test then && 'quoted text'
+printf local x=1 printf local done local && echo && 2>/dev/null
+	'quoted text' readonly grep export
+grep echo 2>/dev/null export then cd && ${HOME} | then awk local echo
+		/usr/bin echo "$@" sed 'quoted text' test grep && then awk ${HOME}
+export 2>/dev/null --verbose --verbose export local readonly x=1 'quoted text'
+	sed grep "$@" "$@" printf then echo --verbose
+	"$1" 'quoted text' then && /usr/bin printf done ${HOME} | readonly 'quoted text'
+	cd grep /usr/bin "$@" $(pwd) && sed
+	readonly local grep 'quoted text' &&
+		"$@" sed readonly --verbose
+		"$@" && -eu sed --verbose readonly -eu ${HOME} echo echo test done $(pwd)
+		awk --verbose "$@" readonly
+printf "$@" cd grep && printf --verbose printf local
+		/usr/bin "$@" grep test --verbose sed sed | | grep && && export
+	-eu grep "$1" cd local export printf cd ${HOME}
+	printf export sed "$@" ${HOME} echo cd "$@" 2>/dev/null done ${HOME} then
+	grep awk cd $(pwd) ${HOME} /usr/bin awk | x=1 cd 2>/dev/null 2>/dev/null
+	'quoted text' grep test /usr/bin | then test | local
+2>/dev/null readonly && sed printf
+$(pwd) --verbose 2>/dev/null $(pwd) printf && printf
+		printf grep "$1" ${HOME} readonly $(pwd) test 2>/dev/null then 2>/dev/null
+	'quoted text' -eu readonly "$1" -eu test cd export ${HOME}
+	then then test export 2>/dev/null 2>/dev/null | printf awk
+		${HOME} "$@" "$@" "$@" -eu test echo
+done awk | then then | -eu "$1"
+	done test done "$1" printf cd then x=1
+		--verbose 'quoted text' export test done 'quoted text' --verbose
+	test "$1" readonly readonly cd printf awk
+		-eu /usr/bin "$1" echo 'quoted text'
+--verbose export $(pwd) "$1" export
+		${HOME} "$1" then | local local && echo $(pwd)
+then -eu test then grep
+| cd sed sed awk && then && 'quoted text' --verbose 2>/dev/null 'quoted text' -eu
+then local 2>/dev/null readonly && echo local then /usr/bin x=1 export echo done
+	/usr/bin grep then cd local "$@" ${HOME} echo "$1" grep printf grep echo
+	2>/dev/null -eu test awk /usr/bin then export grep 2>/dev/null
+	grep echo cd done "$@" awk readonly grep
+		local /usr/bin -eu -eu $(pwd) $(pwd) then grep --verbose /usr/bin
+		"$@" && && done /usr/bin
+awk done awk local printf export $(pwd) -eu printf local "$1" 'quoted text'
+	cd local cd 'quoted text' && cd -eu cd
+	sed /usr/bin printf printf /usr/bin
+x=1 && x=1 2>/dev/null | awk sed && sed && 2>/dev/null ${HOME} echo | $(pwd)
+	printf done cd --verbose
+		'quoted text' "$@" cd
+		2>/dev/null | export 2>/dev/null awk done 'quoted text'
+export "$@" | -eu local done "$1" "$@" readonly /usr/bin | sed awk grep awk
+--verbose awk 2>/dev/null | echo
+grep $(pwd) 'quoted text' | x=1 && echo grep 'quoted text' "$1"
+$(pwd) echo readonly awk 2>/dev/null "$@" printf | -eu local /usr/bin
+	cd $(pwd) cd | && x=1
+awk --verbose export | then -eu 2>/dev/null sed cd readonly
+		${HOME} x=1 --verbose sed -eu export
+		${HOME} ${HOME} x=1 test -eu then --verbose
+		awk && then readonly ${HOME} then --verbose
+	awk && done awk then test ${HOME} grep
+2>/dev/null awk -eu done sed export grep x=1 readonly grep done
+		/usr/bin test x=1 2>/dev/null awk test printf ${HOME} | -eu -eu
+		2>/dev/null && && awk | readonly awk awk echo |
+| printf x=1 'quoted text' local cd echo
+/usr/bin ${HOME} --verbose readonly export export readonly ${HOME}
+	export printf local cd ${HOME} test
+| -eu done test "$1" grep export export
+	2>/dev/null printf echo
+	&& sed grep awk /usr/bin "$1"
+	/usr/bin | /usr/bin printf sed && x=1 /usr/bin done grep && test "$@"
+	test then echo local "$1" $(pwd)
+		readonly readonly --verbose ${HOME} then printf
+	test readonly done --verbose /usr/bin
+	&& cd grep printf awk -eu grep echo readonly
+		$(pwd) readonly readonly sed ${HOME} done "$1" -eu printf local cd
+| printf awk cd -eu "$1" && grep grep 'quoted text' "$1" --verbose
+	then test -eu -eu x=1 echo -eu /usr/bin "$@" test /usr/bin
+		local "$@" printf export export printf readonly "$@" $(pwd) export x=1 ${HOME}
+	--verbose "$1" readonly | test export
+test 2>/dev/null done 'quoted text' "$1" cd ${HOME} x=1 | printf --verbose
+	&& test -eu && $(pwd) grep 2>/dev/null 'quoted text' x=1
+sed grep local 2>/dev/null 2>/dev/null /usr/bin
+local && 'quoted text' printf "$@" then export $(pwd) ${HOME} echo
+sed then && cd then "$@" "$@"
+		--verbose printf /usr/bin && $(pwd) done && test echo local
+		then && readonly x=1 local "$1" printf export printf done ${HOME} "$@" grep
+		"$@" cd grep local --verbose
+		$(pwd) x=1 printf cd "$1" echo printf readonly
+	&& awk grep ${HOME} -eu && echo
+export && --verbose "$1" export && awk then then
+		grep local 'quoted text' awk /usr/bin /usr/bin -eu test $(pwd)
+	readonly test x=1 -eu grep --verbose
+	"$1" "$@" then echo | /usr/bin
+		${HOME} awk printf /usr/bin export && readonly
+x=1 2>/dev/null $(pwd) 2>/dev/null local then then x=1 | "$@"
+		"$@" readonly -eu readonly sed x=1 'quoted text' ${HOME} sed test
+	"$@" local echo x=1 export -eu printf echo grep grep "$@"
+done cd /usr/bin /usr/bin export grep printf awk awk grep local awk sed -eu echo
+	x=1 2>/dev/null /usr/bin sed echo awk
+	then -eu 2>/dev/null &&
+2>/dev/null then local then x=1
+	"$@" && "$1" awk "$@" printf test "$1" |
+		test then -eu /usr/bin test grep -eu awk -eu "$1" -eu
+	awk echo | -eu then -eu "$@"
+		| "$@" 2>/dev/null export 'quoted text'
+		'quoted text' printf done done x=1 && grep
+sed "$1" test test then sed then grep ${HOME} -eu
+export --verbose && awk readonly
+	test done sed /usr/bin 'quoted text'
+		export then && "$@" sed grep "$@" && $(pwd) "$1" sed done $(pwd)
+	$(pwd) 2>/dev/null $(pwd) sed readonly x=1 'quoted text' -eu sed && /usr/bin awk
+	/usr/bin done $(pwd) -eu test /usr/bin local printf "$1" cd 'quoted text'
+	test then "$@" --verbose "$1" readonly "$1"
+$(pwd) "$@" "$1" awk readonly 'quoted text' local local printf grep then
+then "$@" echo readonly /usr/bin export --verbose "$@" test
+		'quoted text' echo printf then 2>/dev/null cd
+		--verbose done readonly awk && 2>/dev/null sed sed
+		$(pwd) awk /usr/bin 'quoted text'
+	-eu "$1" echo then "$1" 'quoted text' /usr/bin
+		local | -eu echo sed 'quoted text' -eu "$@" awk echo && printf local "$@" readonly
+		${HOME} -eu done "$1" /usr/bin
+	'quoted text' "$1" --verbose readonly sed grep awk
+		echo -eu 'quoted text' -eu export then readonly echo --verbose local
+"$@" | test "$@" cd local then grep 'quoted text'
+		x=1 | grep grep done test
+echo then cd x=1 done test export /usr/bin && /usr/bin
+done local done done then /usr/bin
+		export cd echo sed --verbose -eu test done local -eu $(pwd) echo /usr/bin local
+		readonly $(pwd) $(pwd) "$@" | test export --verbose
+awk "$@" --verbose echo export x=1 /usr/bin
+	sed -eu && local cd awk test test awk export $(pwd) export 2>/dev/null -eu echo
+	test 2>/dev/null local ${HOME} echo $(pwd) local "$1" $(pwd) local 2>/dev/null
+grep then grep -eu --verbose "$1" x=1 echo
+export 2>/dev/null then echo "$@" local --verbose local
+cd x=1 $(pwd) "$@" then | sed "$1" export -eu ${HOME} |
+	--verbose /usr/bin /usr/bin printf echo && local test
+	"$@" grep then cd 'quoted text' local awk -eu $(pwd) export local
+grep "$@" && --verbose export sed cd local --verbose "$1" && export
+		grep | --verbose printf cd sed 'quoted text' test
+		x=1 | && "$1" --verbose awk ${HOME} grep && local x=1 readonly printf
+		"$1" -eu 'quoted text' x=1 "$1" export "$1" then local | awk export --verbose test
+		export 'quoted text' export then 2>/dev/null
+&& test then test | | done | echo "$1" cd ${HOME}
+		then && local /usr/bin done grep
+	2>/dev/null $(pwd) ${HOME} done -eu
+awk readonly grep 'quoted text' ${HOME} | "$1"
+2>/dev/null export 2>/dev/null && grep 'quoted text' x=1 -eu 2>/dev/null |
+	then --verbose --verbose $(pwd) awk echo ${HOME} test x=1 "$1" "$1"
+| --verbose test x=1
+	then awk readonly echo ${HOME} /usr/bin "$@"
+	then "$@" | -eu --verbose "$@" grep x=1 && then /usr/bin export sed $(pwd) readonly
+	| --verbose test | sed -eu export ${HOME} 'quoted text'
+		sed 2>/dev/null echo export "$@" awk | cd grep "$@" x=1 awk
+grep then awk /usr/bin x=1 /usr/bin export local && ${HOME}
+		awk done grep done ${HOME} --verbose test /usr/bin -eu local $(pwd) readonly
+	| sed --verbose -eu -eu
+		2>/dev/null && 2>/dev/null test -eu x=1 grep then export $(pwd)
+	printf printf local 'quoted text' printf cd readonly test
+	--verbose done /usr/bin "$1"
+	'quoted text' sed | $(pwd) 2>/dev/null
+		local ${HOME} "$@" "$@" 2>/dev/null done readonly test grep sed done
+$(pwd) grep -eu sed local grep $(pwd)
+		then then -eu export "$@" 'quoted text' test /usr/bin /usr/bin 2>/dev/null awk done
+		done sed --verbose -eu ${HOME} "$@" -eu cd sed "$1" /usr/bin local --verbose
+	awk && done $(pwd) then done $(pwd)
+	export x=1 grep done echo $(pwd)
+	$(pwd) grep x=1 printf readonly sed 'quoted text'
+		"$@" --verbose 'quoted text' --verbose | then test "$@" "$1" awk
+	$(pwd) x=1 local ${HOME} $(pwd) printf /usr/bin "$1" x=1 "$@"
+	done grep readonly /usr/bin readonly export sed test done local readonly awk
+		then && /usr/bin echo --verbose awk
+	done | && 2>/dev/null readonly ${HOME}
+	echo $(pwd) sed printf grep 'quoted text'
+	done local x=1 -eu cd grep export
+x=1 done 'quoted text' ${HOME} then readonly export awk ${HOME}
+		'quoted text' x=1 awk grep | sed && ${HOME} readonly "$1"
+		-eu cd ${HOME} "$@" cd $(pwd)
+awk "$1" -eu --verbose | | "$@" echo ${HOME} /usr/bin cd echo | awk
+	'quoted text' | --verbose /usr/bin
+	2>/dev/null 2>/dev/null 'quoted text' cd
+		2>/dev/null test | -eu | 'quoted text' then -eu 2>/dev/null
+	awk 'quoted text' sed ${HOME} && echo --verbose &&
+	readonly awk | | test sed -eu printf
+local 'quoted text' export "$@" awk cd $(pwd) awk x=1 done sed 2>/dev/null
+done printf -eu local test 'quoted text' /usr/bin "$1" echo sed "$1"
+	"$@" "$@" local echo 2>/dev/null $(pwd) test | test local
+2>/dev/null echo echo
+| | 'quoted text' local 2>/dev/null local echo "$@" "$1"
+	echo grep grep awk --verbose /usr/bin echo "$@"
+	then local -eu ${HOME} /usr/bin 2>/dev/null
+	cd 2>/dev/null "$1" --verbose grep sed $(pwd) printf
+local then --verbose --verbose "$1" then && "$@" 2>/dev/null --verbose
+		/usr/bin printf test awk echo cd awk awk local printf
+	grep then sed local 'quoted text' then x=1 /usr/bin test
+		done cd "$@" ${HOME} x=1 printf $(pwd) 'quoted text' 'quoted text' 'quoted text'
+		done sed && awk -eu /usr/bin printf ${HOME} done "$@" "$@" --verbose
+printf grep 'quoted text' echo $(pwd) | -eu export export done printf "$@" awk
+	2>/dev/null && "$1" && --verbose --verbose "$1" | done x=1 export grep
+		x=1 sed 'quoted text' 'quoted text' local then local printf -eu x=1
+		"$1" && printf --verbose then readonly then
+	-eu grep local /usr/bin 'quoted text' && | 'quoted text'
+	readonly && export export printf -eu | x=1 -eu done 'quoted text'
+	2>/dev/null then /usr/bin "$1" | readonly grep awk ${HOME}
+	done "$1" /usr/bin export && export
+	x=1 export done 'quoted text' then cd x=1 echo /usr/bin echo awk local
+test /usr/bin 'quoted text'
+	$(pwd) echo local export
+		export awk 'quoted text' | cd /usr/bin && then 2>/dev/null
+	"$@" "$1" && echo awk echo -eu grep x=1 'quoted text' 2>/dev/null awk --verbose
+grep "$1" awk grep echo "$@" |
+	then test grep sed -eu echo echo $(pwd) -eu ${HOME} 2>/dev/null
+$(pwd) sed sed "$@" printf printf /usr/bin cd
+		| echo printf printf local /usr/bin 2>/dev/null | grep
+		then --verbose readonly printf && printf
+		printf $(pwd) -eu export cd cd 'quoted text' -eu readonly cd ${HOME} test cd echo
+		"$1" local grep test /usr/bin | grep readonly cd then
+	-eu | awk sed x=1 done /usr/bin cd /usr/bin "$@"
+	printf readonly printf -eu sed $(pwd) awk ${HOME} sed awk
+	$(pwd) test x=1 local x=1
+${HOME} cd test --verbose then then printf -eu sed test
+		--verbose /usr/bin done x=1 cd && x=1 ${HOME} local readonly
+	then "$@" local ${HOME} export awk | printf cd echo x=1 "$1" "$1"
+	2>/dev/null readonly then export x=1
+	local --verbose test readonly sed 'quoted text' cd "$1"
+		-eu --verbose && export echo
+		"$1" 'quoted text' done cd cd -eu /usr/bin -eu -eu -eu && then
+	$(pwd) local then && test --verbose printf done
+		readonly x=1 readonly ${HOME} $(pwd) done /usr/bin grep grep $(pwd) done test export
+	local sed $(pwd) x=1 done then awk test echo
+		printf cd done grep ${HOME} readonly ${HOME} --verbose /usr/bin
+	"$1" echo | test $(pwd) 2>/dev/null printf | echo
+local printf export "$@" readonly
+-eu grep readonly /usr/bin $(pwd) cd sed &&
+printf "$@" && awk test && readonly awk
+	then export $(pwd) "$@" "$@" -eu ${HOME} 2>/dev/null local
+	$(pwd) "$@" readonly --verbose
+	printf readonly "$@" cd test "$@" 'quoted text'
+	| test | cd test grep test "$1" && export cd ${HOME} export &&
+cd && echo --verbose | local "$1" ${HOME} sed cd sed done 'quoted text' 2>/dev/null
+	grep export printf --verbose x=1 "$@" test export "$@" export readonly local
+export ${HOME} readonly done test then sed /usr/bin --verbose awk export
+	--verbose printf sed /usr/bin done -eu
+		echo readonly grep test $(pwd) && && 'quoted text' awk printf sed echo
+		export --verbose export test awk $(pwd) done printf "$1" sed 'quoted text' x=1
+	| local printf --verbose echo then 2>/dev/null
+	done then && cd cd 2>/dev/null -eu
+		done done echo readonly then done readonly /usr/bin x=1 x=1 | "$@" grep
+echo then then done done /usr/bin --verbose
+$(pwd) readonly awk cd --verbose grep 'quoted text' printf readonly grep
+		${HOME} 2>/dev/null done /usr/bin 2>/dev/null
+$(pwd) local awk echo 2>/dev/null $(pwd) then 'quoted text' printf "$1"
+	awk sed 2>/dev/null --verbose local local | printf -eu /usr/bin
+		| grep printf readonly "$1" --verbose sed 2>/dev/null
+export "$1" echo | "$1" grep export grep grep
+sed 'quoted text' $(pwd) 'quoted text' x=1 sed
+		printf && grep /usr/bin x=1 grep /usr/bin $(pwd) 2>/dev/null
+		cd --verbose test awk -eu readonly
+	2>/dev/null grep echo echo done
+	sed -eu x=1 | done x=1 2>/dev/null done echo ${HOME} ${HOME}
+cd ${HOME} $(pwd) "$@" -eu "$1" local cd printf -eu
+		-eu readonly 2>/dev/null "$1" local awk printf cd then echo test sed $(pwd)
+	then -eu --verbose -eu cd done "$@" 'quoted text' test /usr/bin
+readonly readonly "$@" | "$@" sed $(pwd) -eu /usr/bin export 2>/dev/null
+cd awk done && then readonly grep ${HOME} -eu test /usr/bin -eu
+	| local && cd | cd awk | ${HOME} ${HOME} /usr/bin x=1 printf awk echo ${HOME}
+	sed --verbose ${HOME} export export 2>/dev/null
+$(pwd) test done awk readonly 'quoted text'
+	-eu test x=1 sed grep 'quoted text' $(pwd) local $(pwd)
+x=1 local "$@" && local printf x=1 $(pwd)
+	/usr/bin -eu local 'quoted text' readonly --verbose 2>/dev/null printf
+/usr/bin --verbose --verbose -eu --verbose
+cd echo 2>/dev/null /usr/bin sed
+	local then then local then "$@" test "$@" 2>/dev/null
+	2>/dev/null x=1 export $(pwd) -eu x=1 $(pwd) --verbose $(pwd)
+	${HOME} then ${HOME} export x=1 --verbose local
+--verbose | grep cd ${HOME}
+	sed local && --verbose ${HOME} -eu ${HOME} done "$1" export then "$1" 2>/dev/null
+		awk test awk then cd | /usr/bin
+	'quoted text' grep "$1" /usr/bin grep
+-eu echo awk done local local && --verbose "$@" | awk 2>/dev/null /usr/bin
+		${HOME} sed readonly grep test --verbose 'quoted text' -eu local
+	${HOME} && cd printf /usr/bin echo
+		${HOME} x=1 grep "$1" echo "$1" $(pwd) $(pwd) sed --verbose
+	'quoted text' && readonly cd cd 'quoted text'
+	${HOME} test x=1 cd then sed -eu test && ${HOME} /usr/bin readonly 2>/dev/null
+2>/dev/null awk "$1" -eu && echo then 'quoted text'
+x=1 | ${HOME} -eu "$@" &&
+	${HOME} grep sed "$1" local cd then then
+	$(pwd) "$@" && ${HOME} cd grep 2>/dev/null
+local && test $(pwd) | "$@" "$@" -eu 2>/dev/null ${HOME} 2>/dev/null
+--verbose readonly 'quoted text' then echo "$@" echo
+	'quoted text' 'quoted text' echo x=1 awk "$1" && echo
+	-eu awk /usr/bin 2>/dev/null export | ${HOME}
+		$(pwd) test -eu | -eu
+		x=1 ${HOME} ${HOME} cd local done "$@" cd 'quoted text'
+		then local && -eu awk local printf 2>/dev/null export sed 2>/dev/null
+		sed $(pwd) "$1" printf echo sed /usr/bin --verbose then x=1 x=1
+		${HOME} sed sed --verbose grep "$@" ${HOME} printf readonly
+		local local -eu cd /usr/bin $(pwd)
+		&& printf && 'quoted text' cd | $(pwd) awk done local x=1 printf local
+printf "$@" x=1 ${HOME} x=1 "$1" done
+then | /usr/bin 2>/dev/null -eu "$@" then cd && 'quoted text' | echo $(pwd) then
+	echo then test --verbose cd && /usr/bin readonly then awk && | test ${HOME} ${HOME}
+"$1" readonly printf --verbose cd readonly /usr/bin 2>/dev/null 'quoted text'
+		grep /usr/bin "$@" "$1" local readonly export
+		done readonly awk done sed local && echo 'quoted text' readonly
+grep done | done | --verbose test x=1
+		| printf 'quoted text' "$@"
+		2>/dev/null export then readonly echo "$@" $(pwd) 2>/dev/null
+		cd awk printf echo --verbose && echo -eu grep done "$1" test
+/usr/bin | 2>/dev/null echo
+		export awk test -eu -eu grep /usr/bin test
+2>/dev/null grep 2>/dev/null
+&& test ${HOME} then -eu printf cd export
+		awk done 'quoted text' && export "$@" then x=1 sed | /usr/bin readonly echo
+	echo "$@" "$@" export 2>/dev/null test 2>/dev/null local
+	cd export local sed grep 'quoted text'
+	/usr/bin local "$1" test export awk "$@" "$@" awk grep x=1 'quoted text'
+		"$1" grep -eu done grep
+	local 2>/dev/null echo done export printf readonly /usr/bin
+	&& echo export | export /usr/bin $(pwd)
+		grep "$1" test /usr/bin awk | && | ${HOME} $(pwd) --verbose /usr/bin grep x=1
+		| -eu 2>/dev/null readonly 2>/dev/null cd test printf then
+readonly /usr/bin echo $(pwd) then sed | $(pwd)
+	done then then sed awk local readonly grep readonly test 2>/dev/null && "$@"
+	export awk local --verbose --verbose readonly | "$1"
+		then ${HOME} readonly 2>/dev/null local --verbose | readonly grep
+	-eu grep echo done && 'quoted text' sed 'quoted text'
+	echo export test export
+		echo sed sed sed --verbose readonly
+	--verbose | | ${HOME} x=1
+--verbose then then --verbose sed | ${HOME} 2>/dev/null awk test && echo printf
+		cd then | "$1" x=1 local x=1 cd | awk grep printf then "$1" | local
+2>/dev/null local ${HOME} cd local cd
+	grep export cd /usr/bin cd test && awk test -eu
+echo export /usr/bin sed "$@" export local 'quoted text' then
+	"$@" sed | "$@" 'quoted text' sed && then printf /usr/bin done -eu
+"$1" printf cd | readonly readonly | /usr/bin 2>/dev/null done
+	echo && cd -eu printf cd -eu then | "$@" printf "$1" echo ${HOME} -eu export
+	--verbose printf "$1" local sed /usr/bin cd export 2>/dev/null 'quoted text' x=1
+	done readonly echo grep ${HOME} grep printf sed /usr/bin "$@" x=1
+	grep test | printf && ${HOME} echo
+awk echo grep x=1 --verbose
+		&& | readonly "$@" then printf cd awk then test cd sed $(pwd) test
+$(pwd) ${HOME} ${HOME} 'quoted text' /usr/bin done x=1 sed "$1" /usr/bin done
+| /usr/bin local ${HOME} "$@" $(pwd) echo /usr/bin
+		'quoted text' readonly -eu test grep && export -eu 2>/dev/null
+		&& -eu echo && $(pwd) echo done 2>/dev/null cd grep grep
+	&& printf then && $(pwd) cd 2>/dev/null
+cd -eu then grep export done | local --verbose $(pwd) test
+		awk printf done readonly sed 2>/dev/null test -eu test 'quoted text' test
+	local readonly local /usr/bin /usr/bin cd ${HOME} local 2>/dev/null
+		/usr/bin 2>/dev/null $(pwd) -eu cd cd readonly | sed -eu export $(pwd)
+sed cd -eu awk test && local
+	printf x=1 local printf local && /usr/bin -eu | echo cd test | test $(pwd)
+	local 'quoted text' /usr/bin /usr/bin
+		awk --verbose local "$@"
+		then x=1 grep echo 2>/dev/null -eu export ${HOME} grep then $(pwd) test &&
+	readonly 'quoted text' awk /usr/bin sed printf -eu cd
+-eu echo export export && -eu 2>/dev/null "$1"
+"$1" && && done printf --verbose
+	done export x=1 && cd done 'quoted text' grep echo then "$@" readonly local grep
+	done /usr/bin cd echo && printf
+	grep export && export 2>/dev/null x=1 then done readonly
+	2>/dev/null | $(pwd) readonly test && readonly readonly then then -eu x=1 done
+	local then local "$@" && -eu grep && readonly "$1"
+		done local done readonly /usr/bin /usr/bin
+	sed --verbose 'quoted text'
+x=1 && export echo "$1" $(pwd) "$@" /usr/bin then grep sed ${HOME}
+cd grep ${HOME} cd then /usr/bin then export grep x=1 x=1 2>/dev/null
+cd -eu cd ${HOME} sed done | grep && && sed && local cd then
+		grep awk /usr/bin | awk export awk --verbose
+	echo "$@" "$@" sed /usr/bin test 2>/dev/null awk
+		| printf -eu --verbose "$@" grep 2>/dev/null 'quoted text' printf sed grep export
+		${HOME} && printf "$@" local awk export done "$1" test
+sed | ${HOME} 'quoted text' test then /usr/bin 'quoted text'
+	/usr/bin $(pwd) cd printf done
+"$@" done 2>/dev/null done --verbose then && "$@" sed 'quoted text'
+	echo -eu cd "$1" x=1 /usr/bin done readonly sed ${HOME}
+		'quoted text' readonly |
+		done "$1" /usr/bin readonly awk -eu
+	export local x=1 -eu --verbose $(pwd) | printf sed awk printf local && && echo &&
+local && echo x=1 x=1 && local -eu "$1" local
+	echo /usr/bin export printf $(pwd)
+		awk x=1 readonly export x=1 sed test echo $(pwd) |
+	/usr/bin export -eu 'quoted text'
+		export test ${HOME} x=1 |
+	$(pwd) | export "$1" 2>/dev/null test cd test then local /usr/bin
+--verbose cd printf 2>/dev/null /usr/bin "$@"
+	grep then /usr/bin --verbose printf 2>/dev/null 'quoted text'
+2>/dev/null /usr/bin awk
+	'quoted text' sed printf x=1 "$1" | test grep printf echo export "$1" &&
+	--verbose 'quoted text'
+	readonly done "$1" echo "$1" -eu 'quoted text' grep 'quoted text'
+| /usr/bin printf echo 'quoted text'
+		'quoted text' x=1 -eu echo echo /usr/bin done 2>/dev/null ${HOME} | export
+'quoted text' $(pwd) | /usr/bin -eu awk "$@"
+		/usr/bin export 'quoted text' 2>/dev/null | done echo grep &&
+-eu sed then -eu sed printf
+		-eu x=1 | -eu awk grep $(pwd)
+	"$1" | readonly ${HOME} awk | printf readonly $(pwd) echo
+	"$@" printf then local --verbose local x=1 'quoted text'
+		--verbose export $(pwd) then && 2>/dev/null printf
+		printf cd ${HOME} awk /usr/bin
+		2>/dev/null x=1 "$@" 'quoted text' "$1" |
+	local awk ${HOME} export ${HOME} readonly $(pwd) grep "$@" x=1 cd | x=1
+readonly ${HOME} -eu printf printf echo "$@" --verbose
+	cd local /usr/bin awk x=1 "$1" printf cd && /usr/bin readonly done sed && done export
+	done cd $(pwd) x=1 export readonly 'quoted text'
+done x=1 /usr/bin $(pwd) echo -eu then grep printf 'quoted text' 2>/dev/null
+2>/dev/null && readonly printf "$@"
+		| && cd grep --verbose ${HOME}
+		then test 'quoted text' cd echo && awk
+	cd $(pwd) awk x=1 ${HOME} cd --verbose printf printf cd $(pwd)
+		cd --verbose 'quoted text' && /usr/bin test && echo export done /usr/bin
+	"$1" readonly 2>/dev/null --verbose cd && grep "$1" echo then 'quoted text'
+	export "$@" 2>/dev/null cd
+		local | printf -eu | /usr/bin test printf local ${HOME} "$@" $(pwd)
+	sed sed local /usr/bin cd done then then readonly ${HOME} /usr/bin
+		${HOME} && /usr/bin readonly grep | awk grep --verbose 2>/dev/null 2>/dev/null
+	$(pwd) awk "$@" /usr/bin /usr/bin sed
+	export --verbose "$@" 2>/dev/null 'quoted text'
+		sed echo "$@" "$@" sed -eu local x=1 /usr/bin awk $(pwd) readonly
+		"$1" awk then /usr/bin readonly
+	$(pwd) printf $(pwd) then "$@" readonly
+echo printf --verbose printf -eu x=1 done 2>/dev/null
+		echo test then ${HOME} sed && | export
+	then x=1 echo && sed then -eu $(pwd) printf -eu $(pwd) "$1" --verbose
+	echo x=1 test ${HOME} x=1 cd readonly sed readonly
+	&& ${HOME} 2>/dev/null done 'quoted text' 'quoted text'
+then 'quoted text' sed
+		then test cd readonly ${HOME} ${HOME} done && 2>/dev/null
+	cd --verbose $(pwd) --verbose test "$@" /usr/bin readonly grep
+readonly 2>/dev/null x=1 "$@"
+		2>/dev/null x=1 -eu $(pwd) ${HOME} then readonly
+		"$1" "$1" done done /usr/bin --verbose 'quoted text' /usr/bin 2>/dev/null
+		sed | sed | readonly awk echo export "$1" -eu local
+	echo cd && export 'quoted text' local printf &&
+2>/dev/null ${HOME} test local local then echo cd grep done sed 2>/dev/null
+		${HOME} export -eu echo /usr/bin grep done | /usr/bin
+'quoted text' "$@" 2>/dev/null /usr/bin ${HOME}
+		-eu x=1 'quoted text' sed echo "$1" --verbose printf export ${HOME}
+echo readonly readonly done | echo done "$@"
+		then local export 2>/dev/null "$1" printf --verbose ${HOME}
+		export local 2>/dev/null
+	cd --verbose | echo printf "$@" "$@" -eu "$1" -eu local x=1 sed "$1"
+		test cd 'quoted text' echo local local grep "$@" /usr/bin
+	/usr/bin | ${HOME} test x=1 -eu "$1" && && 2>/dev/null export "$1"
+	2>/dev/null 2>/dev/null && sed --verbose "$1" "$1"
+then ${HOME} -eu local readonly awk printf cd export -eu printf
+	"$@" cd 'quoted text' -eu && readonly /usr/bin "$@"
+		${HOME} cd $(pwd) x=1
+		"$@" then cd ${HOME} $(pwd) ${HOME} | done then $(pwd) -eu then done x=1
+test --verbose -eu 2>/dev/null 'quoted text' readonly echo -eu done
+	/usr/bin cd /usr/bin $(pwd) grep ${HOME} readonly &&
+		2>/dev/null echo --verbose cd echo test
+done sed test test 2>/dev/null grep ${HOME}
+'quoted text' && export cd x=1 ${HOME}
+		test export printf test
+	grep cd local then local
+	test && 2>/dev/null grep printf then done $(pwd) then grep then "$1" 'quoted text'
+	export x=1 x=1 test && sed --verbose && $(pwd) 2>/dev/null "$1" "$1" x=1 ${HOME}
+		"$1" echo sed done local $(pwd)
+		'quoted text' export printf test local then printf sed sed --verbose
+		cd done ${HOME} grep | local cd cd sed readonly | $(pwd) --verbose sed then |
+		local /usr/bin "$1" sed | 'quoted text' 'quoted text' echo
+		"$@" /usr/bin then echo "$1" printf readonly
+awk readonly done readonly | "$1" "$@" 2>/dev/null
+		cd && 2>/dev/null /usr/bin readonly echo x=1 -eu awk sed x=1 done awk /usr/bin
+'quoted text' | awk readonly cd cd
+/usr/bin --verbose then
+test "$@" sed done grep cd readonly
+		${HOME} "$1" -eu --verbose "$1" sed readonly --verbose readonly
+echo /usr/bin awk cd 'quoted text'
+$(pwd) 2>/dev/null | && readonly test
+		test "$@" cd 'quoted text' "$@" ${HOME} echo awk 'quoted text' readonly
+		"$@" "$@" ${HOME} ${HOME} && sed readonly
+		test export "$1" --verbose awk done
+		$(pwd) && -eu done then x=1 grep test /usr/bin 'quoted text' /usr/bin export
+		2>/dev/null printf x=1 awk cd awk awk awk x=1 test printf
+	"$@" local "$@" 2>/dev/null "$@" local $(pwd) local export readonly
+'quoted text' "$@" awk | test readonly
+	local local sed printf done export $(pwd) 2>/dev/null 'quoted text' "$1"
+"$@" && done "$@" readonly test -eu then -eu &&
+'quoted text' x=1 --verbose then /usr/bin "$1" ${HOME}
+2>/dev/null -eu -eu awk x=1 readonly
+		"$@" /usr/bin readonly "$@" cd echo $(pwd)
+	echo /usr/bin done ${HOME}
+		2>/dev/null $(pwd) 2>/dev/null readonly printf x=1
+$(pwd) then "$1" "$1" done
+		'quoted text' local && /usr/bin
+	awk local echo 'quoted text' echo -eu test 'quoted text'
+	done --verbose done echo --verbose ${HOME} cd && "$@" 'quoted text'
+		awk grep $(pwd) x=1 echo ${HOME} done local sed done done --verbose -eu "$@" awk
+	export $(pwd) && local awk cd ${HOME} awk
+echo then --verbose awk export done sed -eu readonly
+readonly local done grep sed cd printf
+		| done cd --verbose local readonly test --verbose "$@" ${HOME} local 'quoted text'
+	${HOME} done "$@" awk echo done then "$1" export "$@" cd printf export 2>/dev/null
+		test readonly export sed
+	grep ${HOME} /usr/bin awk /usr/bin "$1" test ${HOME} then x=1
+	awk 2>/dev/null readonly done done readonly awk -eu done test | ${HOME}
+	export $(pwd) -eu cd --verbose awk ${HOME} /usr/bin x=1 export awk
+	readonly sed local /usr/bin "$1" done
+	sed grep grep then done 2>/dev/null
+2>/dev/null export -eu "$1" printf $(pwd) -eu readonly
+-eu x=1 'quoted text' 'quoted text' 'quoted text' done
+"$1" | awk "$@" | sed 'quoted text' x=1 --verbose ${HOME} test readonly -eu export
+	local readonly sed x=1 | -eu
+	sed && -eu --verbose x=1 export "$@" test echo 'quoted text' done
+done /usr/bin local readonly printf "$@" echo
+export sed sed /usr/bin sed && 'quoted text' test then test
+		local -eu $(pwd) "$1" $(pwd) 'quoted text' -eu local "$@" |
+	test then local $(pwd) test | local 'quoted text' local local
+readonly "$@" awk then ${HOME} cd printf cd echo echo done sed x=1 sed
+$(pwd) echo 'quoted text' -eu && then "$@" && readonly cd | printf 'quoted text'
+2>/dev/null ${HOME} "$@"
+		"$1" /usr/bin grep 2>/dev/null
+	printf ${HOME} --verbose echo | export | "$1" "$1" -eu 2>/dev/null
+$(pwd) $(pwd) /usr/bin then
+	--verbose x=1 'quoted text' | awk test 2>/dev/null
+test | export echo x=1 echo printf && test
+		sed 2>/dev/null && "$1" x=1 && ${HOME}
+		export $(pwd) awk grep readonly | | "$1"
+		"$1" grep then 2>/dev/null ${HOME} printf | local ${HOME}
+		x=1 echo && sed grep 2>/dev/null
+	--verbose -eu then /usr/bin "$@"
+cd | local then 2>/dev/null $(pwd) readonly cd x=1 "$1" awk "$1" export grep 'quoted text'
+		readonly $(pwd) awk x=1 ${HOME} then cd local -eu
+	--verbose 2>/dev/null | 2>/dev/null
+printf awk sed echo test sed export export && cd 'quoted text'
+&& sed sed printf -eu sed local --verbose | then cd local x=1
+		/usr/bin cd awk 2>/dev/null sed done -eu $(pwd)
+grep 'quoted text' $(pwd) grep sed export local "$1" done printf
+		done $(pwd) -eu ${HOME} then printf readonly -eu "$1" done sed printf ${HOME}
+		&& local export 2>/dev/null grep test
+	-eu && echo local x=1 ${HOME}
+export then | printf $(pwd)
+cd done export -eu export 2>/dev/null $(pwd) 'quoted text'
+		test local 'quoted text' sed printf "$1"
+	"$@" readonly ${HOME} "$@" printf
+then $(pwd) export /usr/bin 2>/dev/null
+local x=1 then printf echo -eu then $(pwd) /usr/bin ${HOME}
+		$(pwd) cd -eu printf --verbose "$1" $(pwd) readonly
+		printf echo sed "$1" local cd sed "$1" then awk done 'quoted text'
+		-eu 2>/dev/null | cd awk grep 'quoted text' done
+		grep cd /usr/bin awk then "$@" --verbose echo -eu echo then printf printf -eu awk
+		2>/dev/null sed /usr/bin then export echo done "$1" cd "$1" /usr/bin echo printf
+	| echo grep 'quoted text' ${HOME} -eu printf printf printf "$@" --verbose cd x=1
+done ${HOME} /usr/bin test --verbose ${HOME} cd echo
+		&& echo test | | readonly -eu
+	--verbose printf test export printf export
+		$(pwd) 2>/dev/null local && "$1" export 'quoted text' $(pwd)
+readonly --verbose /usr/bin --verbose
+x=1 2>/dev/null x=1 then cd 'quoted text' ${HOME}
+		done x=1 grep export 'quoted text'
+x=1 done "$@" sed sed --verbose | readonly cd | local
+	&& printf done local x=1 test echo
+	$(pwd) printf && ${HOME} export printf local readonly export awk -eu export
+/usr/bin 'quoted text'
+		export /usr/bin 'quoted text'
+	--verbose "$@" $(pwd) x=1 cd local printf /usr/bin "$@" then
+local $(pwd) grep then | "$@" "$1" printf then local -eu local
+"$1" grep 'quoted text' x=1
+	| x=1 "$@" sed --verbose then then export awk ${HOME} | $(pwd)
+--verbose awk awk "$@"
+	cd && test then echo x=1 echo cd done x=1 $(pwd) && 'quoted text' test local
+&& 2>/dev/null x=1 ${HOME} then ${HOME} x=1 readonly
+	export -eu /usr/bin local test done export $(pwd) && done
+	--verbose /usr/bin cd then cd then done then 2>/dev/null test --verbose
+sed "$1" sed 2>/dev/null echo 'quoted text' --verbose "$@" 'quoted text'
+	test ${HOME} cd /usr/bin | -eu sed export "$1"
+	then --verbose awk "$1" awk 2>/dev/null
+grep && "$1" done /usr/bin
+"$1" /usr/bin sed $(pwd) "$1" ${HOME} "$1" 2>/dev/null x=1 export
+	export cd readonly then "$1" x=1 export cd readonly
+2>/dev/null x=1 --verbose export ${HOME}
+-eu --verbose test 2>/dev/null x=1
+	--verbose | sed export -eu && --verbose done cd export export ${HOME} local
+	readonly then test "$@" awk 'quoted text' export --verbose | export
+	$(pwd) 2>/dev/null then awk 2>/dev/null
+		"$@" local local $(pwd) &&
+		x=1 printf 2>/dev/null -eu x=1 x=1 'quoted text' local done --verbose x=1
+"$@" awk | echo 'quoted text' 'quoted text' then x=1 printf
+		done printf "$@" printf grep printf 'quoted text' printf | echo test printf sed
+	done done "$@" x=1 && "$@" 'quoted text' /usr/bin 2>/dev/null 'quoted text'
+${HOME} --verbose && x=1 printf -eu done 'quoted text' export
+	x=1 sed 'quoted text' 'quoted text' -eu 'quoted text' export local "$1" done
+	export /usr/bin | printf done local x=1 /usr/bin
+		--verbose -eu test done $(pwd)
+	echo | cd | 2>/dev/null x=1 printf awk grep /usr/bin && printf
+	"$1" local ${HOME} printf
+	/usr/bin && cd "$1" 'quoted text' local sed "$@" "$1" && -eu 'quoted text' printf
+		export grep "$@" "$1" sed echo
+export readonly echo | -eu x=1 test done 2>/dev/null -eu -eu x=1
+-eu grep "$1" && 'quoted text' 2>/dev/null "$@" readonly ${HOME} echo cd
+2>/dev/null "$1" export
+-eu readonly awk sed then | export $(pwd) done 2>/dev/null 2>/dev/null
+local done 'quoted text' grep $(pwd) 2>/dev/null
+	| echo "$1" && echo test &&
+		"$1" done x=1 --verbose done x=1 grep "$1" export local
+${HOME} done then "$1" grep readonly
+		done 'quoted text' 2>/dev/null && done --verbose && awk "$@"
+sed --verbose readonly readonly test echo cd cd
+		export done export grep | local && awk -eu | 'quoted text' awk local --verbose
+	grep x=1 local /usr/bin then printf "$@" local printf export test cd 2>/dev/null
+	test "$1" sed && --verbose local done readonly 2>/dev/null
+		| readonly then printf /usr/bin 2>/dev/null test readonly
+		test done test sed then then awk echo x=1 --verbose
+		'quoted text' x=1 $(pwd) readonly -eu "$1" awk 'quoted text'
+	grep done ${HOME} cd 2>/dev/null --verbose local "$1" -eu 2>/dev/null
+	printf grep && done echo done | grep
+	local x=1 printf ${HOME} sed | export sed readonly
+		then local awk cd awk printf awk && readonly local
+/usr/bin readonly then awk ${HOME} awk 'quoted text' cd | | sed test cd sed
+	then ${HOME} local "$@"
+		sed test sed 'quoted text' echo $(pwd) 2>/dev/null done done --verbose grep test
+	'quoted text' x=1 ${HOME} done
+	'quoted text' /usr/bin $(pwd)
+		awk printf --verbose -eu 2>/dev/null
+		"$1" then "$1" echo test cd local "$1"
+	local readonly then sed "$1" cd done /usr/bin
+	then local -eu ${HOME} grep test then | grep 2>/dev/null 'quoted text' local
+	"$@" $(pwd) local readonly
+${HOME} readonly cd awk && && "$@"
+	then ${HOME} readonly awk export sed
+	"$@" done test x=1 grep
+		'quoted text' awk ${HOME} sed then readonly
+	echo done ${HOME} cd "$@" 'quoted text' x=1 test test "$@" "$@"
+		test local "$@" local --verbose x=1
+/usr/bin 'quoted text'
+awk then | $(pwd) local echo $(pwd) sed "$@" printf -eu | 'quoted text' &&
+	| grep x=1 printf "$@" grep printf test "$1" sed grep "$1"
+		$(pwd) $(pwd) test 2>/dev/null done cd | done "$@" "$1" /usr/bin echo then
+	| $(pwd) test -eu grep ${HOME}
+	test echo "$@" -eu 2>/dev/null grep grep 'quoted text'
+	--verbose && awk readonly
+		grep awk "$@" local | "$1" x=1 "$@" export printf ${HOME} 'quoted text'
+awk $(pwd) cd cd 2>/dev/null sed -eu awk $(pwd) echo local 'quoted text'
+		export echo done -eu printf 2>/dev/null
+	readonly "$@" x=1 $(pwd) -eu /usr/bin 2>/dev/null
+2>/dev/null "$@" done
+	sed export | grep then $(pwd) ${HOME} test then ${HOME}
+		&& | readonly 2>/dev/null /usr/bin "$@" $(pwd)
+-eu printf printf done printf then "$1" /usr/bin ${HOME}
+		sed then -eu && 2>/dev/null local
+"$1" done --verbose --verbose --verbose x=1 test "$1" "$@"
+		'quoted text' sed /usr/bin 2>/dev/null "$@" grep then "$@"
+	&& local "$@" readonly printf "$@" "$1" test awk
+	${HOME} | --verbose -eu then "$@" ${HOME}
+-eu && echo /usr/bin then readonly "$1" 2>/dev/null local grep
+sed sed /usr/bin x=1 test then
+		x=1 local && local x=1 && test echo then export awk grep x=1 readonly
+		export | local "$@" 'quoted text' x=1 "$@" done cd 'quoted text' --verbose
+		export test sed test sed cd "$@" cd awk | cd "$1" "$@" && readonly
+printf -eu then local done awk done printf /usr/bin export sed "$1" x=1
+	grep readonly echo sed && 2>/dev/null | "$1" --verbose --verbose 'quoted text'
+		'quoted text' done 2>/dev/null printf export ${HOME} | printf
+		-eu then --verbose awk readonly
+		done --verbose awk awk "$1" awk then grep /usr/bin then done "$@"
+| local awk readonly /usr/bin -eu local /usr/bin awk local
+		${HOME} readonly sed --verbose $(pwd)
+	--verbose 2>/dev/null --verbose -eu $(pwd) grep && sed $(pwd) printf
+		done cd readonly readonly export "$@" sed 'quoted text' 2>/dev/null readonly done
+	/usr/bin | export 'quoted text' readonly 2>/dev/null awk /usr/bin
+cd x=1 test --verbose "$1" done readonly
+	/usr/bin "$@" ${HOME} echo x=1 -eu
+		2>/dev/null "$@" --verbose && local then local --verbose "$@"
+	'quoted text' grep then readonly /usr/bin $(pwd)
+	-eu cd /usr/bin grep printf -eu $(pwd) && -eu "$@" ${HOME} --verbose
+		export "$@" | --verbose ${HOME} printf 2>/dev/null && /usr/bin local echo grep
+readonly | && "$@" $(pwd) awk 2>/dev/null
+	${HOME} printf grep | cd readonly 'quoted text' -eu grep
+x=1 -eu && grep echo echo grep && $(pwd) printf test /usr/bin cd "$@" done sed
+		2>/dev/null x=1 "$1" -eu "$1" export sed readonly /usr/bin then readonly
+		echo echo "$@" local then readonly 'quoted text'
+		export then ${HOME} $(pwd)
+		cd then done 'quoted text' readonly printf
+		echo printf printf $(pwd) test readonly
+	readonly x=1 ${HOME} x=1 local then ${HOME} local export &&
+	printf echo /usr/bin awk ${HOME} $(pwd) done "$1" grep --verbose
+	'quoted text' local x=1 grep && local
+	2>/dev/null grep echo then grep done sed --verbose echo | export "$@" local
+	&& | 'quoted text' sed test $(pwd) then done done --verbose
+		/usr/bin grep sed readonly 'quoted text' echo
+		&& /usr/bin -eu printf "$@" 'quoted text' x=1 /usr/bin x=1 "$@" /usr/bin
+		"$1" 2>/dev/null | cd -eu --verbose sed readonly
+		test awk echo $(pwd) test --verbose sed grep readonly cd echo
+		cd cd 2>/dev/null /usr/bin | x=1 x=1 2>/dev/null printf
+		&& printf done readonly --verbose test
+	sed x=1 "$@" --verbose then cd
+		| echo grep grep 2>/dev/null "$@" x=1 ${HOME} awk $(pwd) awk cd sed
+	2>/dev/null export echo then | && sed 'quoted text' x=1 /usr/bin
+$(pwd) /usr/bin 2>/dev/null --verbose cd grep echo grep
+test sed "$@" $(pwd) local export then printf $(pwd) awk done -eu --verbose
+		${HOME} x=1 "$1" /usr/bin grep done export cd
+	readonly sed 'quoted text' "$@" 'quoted text' -eu cd 'quoted text' printf
+		-eu done /usr/bin | cd -eu
+		x=1 export | done then then 'quoted text' test x=1 printf ${HOME} sed test
+		| | cd done then awk /usr/bin readonly 2>/dev/null test 'quoted text'
+		/usr/bin grep echo --verbose awk echo printf x=1 /usr/bin
+		then "$@" export then echo test done /usr/bin "$@" 2>/dev/null awk "$1" /usr/bin
+echo "$@" awk done && echo sed sed -eu $(pwd) echo printf awk $(pwd) ${HOME}
+		printf grep -eu then 2>/dev/null 'quoted text' /usr/bin
+local echo sed $(pwd) | x=1 export readonly test x=1
+	"$@" /usr/bin x=1 test cd local done local x=1 --verbose cd cd "$1" 'quoted text'
+	${HOME} && test readonly cd
+	test $(pwd) local "$@" awk x=1 $(pwd) "$1" local then && 'quoted text'
+	2>/dev/null done readonly printf then "$@" -eu
+	| | local 'quoted text' ${HOME}
+export ${HOME} awk -eu ${HOME}
+		"$@" -eu grep --verbose x=1 printf export ${HOME} sed
+printf --verbose /usr/bin "$1" echo "$@" grep
+/usr/bin echo readonly echo grep $(pwd)
+		| test $(pwd) local then "$@" $(pwd) -eu then ${HOME}
+grep -eu local --verbose
+	export readonly 2>/dev/null test printf
+echo then -eu | $(pwd) /usr/bin echo awk test sed /usr/bin
+test 'quoted text' echo then then | sed $(pwd) /usr/bin /usr/bin awk test
+		export 'quoted text' /usr/bin local -eu | local
+x=1 readonly --verbose |
+#include c189.sh
+	local local 2>/dev/null printf $(pwd) "$@" x=1 echo x=1
+-eu test | | "$1" 2>/dev/null
+		test 2>/dev/null 'quoted text' "$1" | "$@" 2>/dev/null
+-eu readonly sed x=1 awk | readonly test
+grep $(pwd) --verbose && printf ${HOME} x=1 printf "$@" grep
+"$@" then done done echo grep local cd
+	x=1 done grep then done done printf cd | then
+	'quoted text' then $(pwd) printf --verbose 2>/dev/null
+	local 'quoted text' readonly ${HOME} done test 'quoted text' && /usr/bin
+		done "$1" "$@" $(pwd) ${HOME}
+'quoted text' done /usr/bin "$1" "$@" 'quoted text' /usr/bin grep
+		&& sed | cd cd readonly done cd readonly then sed 2>/dev/null
+done -eu ${HOME} x=1 ${HOME} readonly awk x=1 then
+	grep x=1 test ${HOME} 2>/dev/null readonly ${HOME} /usr/bin then -eu printf grep
+readonly test readonly printf local $(pwd) local "$1" readonly ${HOME}
+readonly export then "$@" x=1 && export --verbose local readonly
+		test --verbose --verbose test then "$1"
+echo printf printf "$@" $(pwd) ${HOME} awk printf local local
+readonly -eu readonly "$@" awk ${HOME} | && 'quoted text' "$@" -eu "$1" awk
+	--verbose $(pwd) "$1" 2>/dev/null done test
+		"$@" | readonly $(pwd) local cd done test 2>/dev/null 'quoted text' /usr/bin
+		$(pwd) local grep x=1 printf echo cd then /usr/bin awk test
+	grep sed cd ${HOME} done cd x=1 x=1
+	$(pwd) x=1 echo local /usr/bin
+	echo local /usr/bin awk | done ${HOME} "$1" readonly test echo cd sed --verbose
+		-eu printf $(pwd) && $(pwd) done &&
+/usr/bin "$@" awk /usr/bin x=1 local test -eu awk echo x=1 awk local
+x=1 export -eu sed printf grep readonly $(pwd) sed readonly
+export export 'quoted text' awk 2>/dev/null
+/usr/bin cd x=1 | /usr/bin --verbose "$1" | awk "$@" /usr/bin
+sed then grep $(pwd) grep sed $(pwd) x=1 printf export test local sed
+sed awk cd then "$1" /usr/bin printf 2>/dev/null x=1 && readonly
+export sed $(pwd) readonly "$1" 2>/dev/null
+		"$1" cd export 'quoted text' "$1" readonly done done ${HOME} cd readonly local
+		test test 'quoted text' local 'quoted text' -eu -eu 'quoted text'
+		done readonly cd $(pwd) awk -eu grep /usr/bin $(pwd)
+| 2>/dev/null "$1" && grep then 'quoted text' x=1
+		printf grep cd | ${HOME} 'quoted text' printf | grep 'quoted text'
+		then 'quoted text' test awk x=1 sed export cd test $(pwd) | x=1 ${HOME}
+		test echo done | test /usr/bin && -eu printf readonly -eu 'quoted text'
+	-eu -eu 2>/dev/null /usr/bin local 'quoted text' export $(pwd)
+/usr/bin ${HOME} /usr/bin echo awk export
+awk /usr/bin cd --verbose cd /usr/bin echo printf echo $(pwd)
+		then x=1 then --verbose done sed local export "$@" export
+		'quoted text' grep $(pwd) x=1 $(pwd)
+	"$@" -eu test ${HOME} $(pwd) sed
+	sed $(pwd) "$1" -eu "$1" "$1" 2>/dev/null cd -eu cd sed 'quoted text'
+	readonly test /usr/bin printf /usr/bin sed $(pwd) test -eu test ${HOME} "$1"
+	x=1 "$@" cd grep 'quoted text'
+"$1" "$1" echo $(pwd) -eu awk x=1 awk echo "$@" printf
+"$@" test --verbose | sed "$@" -eu && ${HOME} "$@" grep local awk $(pwd)
+	cd echo 'quoted text' grep -eu done test
+		then printf 2>/dev/null readonly 2>/dev/null echo
+${HOME} --verbose --verbose | readonly | done grep
+		test | | echo readonly local cd then echo cd awk 2>/dev/null --verbose
+		export grep | --verbose test ${HOME} local echo cd readonly
+	2>/dev/null -eu "$@" && "$@" export readonly 2>/dev/null
+| ${HOME} grep local local local
+	sed export -eu cd test grep
+	awk echo | grep then done | --verbose
+| && readonly grep cd then sed printf printf | | --verbose "$@" readonly
+		cd done "$1" then ${HOME}
+		awk && --verbose done && | printf printf 2>/dev/null 'quoted text'
+printf sed 'quoted text' grep awk echo then local
+		--verbose --verbose x=1 x=1 'quoted text' -eu
+	export grep | 2>/dev/null $(pwd) 'quoted text' -eu printf
+		| "$@" local $(pwd) $(pwd) export && && printf awk echo && echo "$1"
+	${HOME} then readonly sed then echo then
+	${HOME} awk $(pwd) && grep
+${HOME} 2>/dev/null | grep printf printf awk cd "$@" "$1" done x=1
+		export -eu echo --verbose cd test x=1 grep x=1 grep echo
+test cd readonly $(pwd) --verbose 'quoted text'
+		grep export ${HOME} -eu export "$1"
+	awk export /usr/bin sed echo $(pwd) local readonly
+	readonly x=1 then cd then
+	&& echo 2>/dev/null printf awk test done echo export $(pwd)
+&& ${HOME} cd then echo test done "$@" 2>/dev/null done
+	cd | then | readonly export ${HOME} then grep awk echo -eu "$1" $(pwd)
+echo && && $(pwd) test grep --verbose
+		&& echo && awk && grep awk local ${HOME}
+		-eu x=1 && printf 'quoted text' cd -eu then local --verbose "$@"
+	$(pwd) | 2>/dev/null echo 2>/dev/null 'quoted text' done /usr/bin
+		"$1" done | /usr/bin grep
+		echo $(pwd) "$@" then sed cd /usr/bin 2>/dev/null local && | 'quoted text'
+printf export readonly 'quoted text' "$@"
+&& -eu 'quoted text' "$@" -eu then
+	${HOME} && 2>/dev/null then 2>/dev/null test
+		local local echo test $(pwd) cd x=1 printf 2>/dev/null ${HOME}
+readonly readonly /usr/bin $(pwd) grep x=1
+	then /usr/bin -eu printf "$@" grep 2>/dev/null --verbose then
+	local 'quoted text' echo printf $(pwd)
+	2>/dev/null && local test printf | && "$@" grep
+	-eu test | sed awk && awk /usr/bin awk --verbose done
+	$(pwd) /usr/bin readonly test test test local grep 2>/dev/null /usr/bin sed readonly
+	done /usr/bin x=1 x=1 sed --verbose done done | done
+sed x=1 local local echo 2>/dev/null ${HOME}
+		awk done | test x=1 test export "$1" export test -eu -eu && printf "$@"
+--verbose readonly awk ${HOME} "$1" cd x=1 echo echo export && "$1" 'quoted text'
+		"$1" test then readonly printf
+	then echo sed 'quoted text' x=1
+sed awk 2>/dev/null cd sed $(pwd) printf
+		awk | printf --verbose done /usr/bin
+	| then "$1" printf awk readonly
+	cd local | /usr/bin export grep 'quoted text' export -eu -eu 2>/dev/null
+	cd echo --verbose -eu "$1" $(pwd) 'quoted text' ${HOME} $(pwd) --verbose
+		/usr/bin "$1" 'quoted text' --verbose | && ${HOME} grep
+${HOME} && echo awk | test echo then && test cd test local
+		'quoted text' "$1" 2>/dev/null printf
+/usr/bin -eu x=1 cd | ${HOME} "$@" $(pwd)
+		readonly x=1 grep $(pwd) export then
+		readonly grep then export done printf $(pwd) $(pwd) local readonly export
+	-eu | readonly echo echo
+&& echo test 2>/dev/null "$1" then readonly x=1 readonly | local
+	"$1" export -eu then | "$1" 2>/dev/null done echo
+	--verbose | export local grep printf awk x=1 local done awk -eu readonly
+sed then $(pwd) sed ${HOME} | -eu local grep readonly cd 2>/dev/null | awk grep
+done $(pwd) "$1" ${HOME} ${HOME} x=1 | export "$@" --verbose local
+	--verbose "$@" test "$@" done $(pwd) echo awk
+		"$1" local local local echo readonly 2>/dev/null
+	$(pwd) grep local | 2>/dev/null 'quoted text'
+$(pwd) ${HOME} /usr/bin /usr/bin /usr/bin -eu local $(pwd) 2>/dev/null
+		done readonly && printf | grep awk echo --verbose cd readonly
+	sed -eu awk | export test sed grep
+test readonly printf "$@" cd echo | 'quoted text' cd 2>/dev/null grep
+"$@" grep local sed -eu 'quoted text'
+$(pwd) && printf printf readonly --verbose "$@" 'quoted text'
+	-eu done then && 2>/dev/null
+/usr/bin grep printf done echo export ${HOME} echo
+		export 2>/dev/null 2>/dev/null test "$1" 2>/dev/null cd ${HOME} "$1" local cd printf
+x=1 echo readonly | ${HOME} | readonly
+export grep "$1" test awk "$1" echo
+sed awk export --verbose
+echo | awk $(pwd) grep test readonly -eu done echo "$@"
+	&& ${HOME} | ${HOME} grep printf "$1" printf "$@" && then
+		printf echo /usr/bin then 2>/dev/null "$1" --verbose ${HOME}
+&& && x=1 export "$1" 2>/dev/null test local
+	| export printf $(pwd) -eu x=1 ${HOME} readonly
+grep then then 'quoted text' /usr/bin echo grep
+test ${HOME} grep then -eu -eu done
+		test then export cd export cd readonly /usr/bin
+${HOME} test && | readonly echo 2>/dev/null export printf
+		printf /usr/bin sed x=1 sed --verbose done --verbose sed grep done test awk readonly
+		test "$@" cd | "$1" then "$@" && readonly test --verbose $(pwd)
+	export then sed /usr/bin $(pwd) $(pwd) "$1" printf cd 'quoted text' x=1
+	printf --verbose then | x=1 awk readonly
+	printf awk -eu && "$@"
+	local "$1" /usr/bin | ${HOME} && cd $(pwd) cd readonly "$@"
+		readonly export x=1 "$1" "$@" ${HOME} echo "$1"
+sed "$@" echo 2>/dev/null sed then printf echo
+	done done ${HOME} awk export
+		$(pwd) "$@" test done ${HOME} awk export then awk $(pwd) test
+		${HOME} grep --verbose "$1" -eu $(pwd) 2>/dev/null
+		"$@" awk awk x=1 local echo grep readonly export local echo && readonly
+		done -eu test cd echo cd cd echo echo test 'quoted text' | $(pwd) /usr/bin
+		2>/dev/null cd printf ${HOME} "$1" awk
+then "$1" grep ${HOME} "$1"
+	then awk done grep | export 2>/dev/null
+		then | -eu export done readonly && readonly
+--verbose ${HOME} ${HOME} cd "$@" readonly ${HOME} awk -eu awk test cd sed
+		export | export printf && export echo 'quoted text' cd "$@" awk local then -eu
+	-eu printf test --verbose grep x=1 2>/dev/null
+	test && /usr/bin /usr/bin readonly "$@" done readonly "$1"
+	"$@" readonly | "$1" sed cd export then local | cd then printf grep /usr/bin
+		-eu -eu done export local then
+	echo echo export done "$@" 'quoted text' 2>/dev/null x=1 then | sed sed 'quoted text'
+	local ${HOME} cd 'quoted text' | | "$@" printf export then
+	/usr/bin export cd "$1" 'quoted text' grep local echo echo /usr/bin x=1 /usr/bin
+		--verbose && && done then then -eu && printf echo /usr/bin awk x=1
+sed then "$@" cd ${HOME} done && printf $(pwd)
+test && -eu grep echo $(pwd) "$1" readonly test ${HOME}
+awk x=1 local local local done cd grep 'quoted text'
+printf test && ${HOME} awk printf
+	-eu x=1 done --verbose then local /usr/bin x=1 "$1" printf -eu export
+/usr/bin x=1 'quoted text' grep | sed $(pwd) export done --verbose
+	grep /usr/bin && test 'quoted text'
+		"$1" done readonly cd --verbose readonly "$@" printf cd sed --verbose done /usr/bin
+	--verbose | done /usr/bin awk echo 2>/dev/null local | grep 'quoted text'
+		2>/dev/null $(pwd) ${HOME}
+	-eu cd readonly "$1" "$1" x=1 $(pwd)
+&& ${HOME} printf 'quoted text'
+'quoted text' | echo test x=1 then done sed export --verbose && ${HOME} $(pwd)
+done sed | -eu /usr/bin | && 'quoted text'
+printf test | sed -eu grep "$@" cd --verbose ${HOME} awk readonly
+	sed 2>/dev/null cd && "$1" local -eu 2>/dev/null --verbose printf grep then
+	x=1 /usr/bin printf x=1 -eu -eu awk grep grep then x=1 | grep --verbose
+		&& test 'quoted text' && --verbose "$1" 2>/dev/null local "$@"
+		| --verbose cd awk 'quoted text' 2>/dev/null $(pwd) 'quoted text' then
+echo | local -eu --verbose -eu sed -eu "$@" 'quoted text'
+		readonly ${HOME} local cd 'quoted text'
+		cd local 'quoted text' 2>/dev/null ${HOME} -eu readonly cd
+		"$@" ${HOME} then readonly 2>/dev/null
+	cd /usr/bin -eu then x=1 --verbose
+	${HOME} printf readonly --verbose "$1" 2>/dev/null -eu
+${HOME} cd sed "$@" && cd grep done ${HOME} 2>/dev/null --verbose | local
+"$@" cd test cd 2>/dev/null
+readonly done && printf | "$@" grep readonly local readonly x=1
+local echo ${HOME} ${HOME} ${HOME} 2>/dev/null
+		/usr/bin test done test cd readonly "$@" ${HOME} && local /usr/bin local done
+		readonly /usr/bin cd -eu "$@" ${HOME} local ${HOME} grep readonly
+sed --verbose awk /usr/bin | grep cd | -eu ${HOME} printf $(pwd) export
+		awk then done test $(pwd) 'quoted text' 'quoted text'
+	"$@" cd sed export -eu
+	printf /usr/bin printf /usr/bin "$1" | echo local readonly
+-eu export x=1 && x=1 'quoted text' x=1 printf
+	test $(pwd) then $(pwd) --verbose "$1"
+		grep "$1" $(pwd) | 2>/dev/null
+		printf -eu 'quoted text' x=1 $(pwd) "$1" printf | && awk x=1 "$@" test $(pwd)
+	'quoted text' /usr/bin echo && local echo --verbose 2>/dev/null --verbose
+--verbose cd 'quoted text' "$@" $(pwd) done readonly ${HOME} 2>/dev/null
+2>/dev/null test grep --verbose export export
+	${HOME} -eu awk --verbose sed $(pwd) x=1 readonly
+		cd -eu ${HOME} done export -eu "$1" sed sed sed then export done
+	awk $(pwd) awk /usr/bin | then printf
+		sed /usr/bin && printf "$@" ${HOME}
+readonly grep test local echo test
+		'quoted text' sed -eu export export x=1 2>/dev/null awk 2>/dev/null readonly
+	${HOME} x=1 cd && echo test echo awk x=1 -eu done awk
+grep sed 2>/dev/null local 'quoted text' export x=1 cd
+		then 2>/dev/null echo grep test readonly x=1 printf
+		-eu local /usr/bin $(pwd) "$1" grep 2>/dev/null grep "$1"
+	| && printf awk sed done -eu export printf awk && awk then $(pwd) "$@" then
+echo local awk | 'quoted text' done
+"$1" 'quoted text' awk test --verbose
+	x=1 cd done 'quoted text' && /usr/bin printf test $(pwd) export cd local
+		done grep --verbose cd x=1 grep printf test done --verbose
+	&& $(pwd) done grep printf | printf | $(pwd) cd test | && 2>/dev/null
+		-eu done readonly 'quoted text' "$@" && awk readonly cd "$1" /usr/bin "$@"
+		"$@" done | | ${HOME} test printf sed /usr/bin && test 'quoted text'
+		| --verbose --verbose export done awk echo local echo
+local 'quoted text' && grep --verbose then cd export cd readonly
+done local readonly -eu $(pwd) 'quoted text' printf cd local | x=1 -eu
+awk then then | sed grep
+	cd local local --verbose awk export printf awk
+	grep then local ${HOME} "$@" "$@" && -eu local echo export sed $(pwd)
+	| done done printf sed | readonly sed readonly
+cd $(pwd) x=1 | test ${HOME}
+	/usr/bin awk done cd echo 'quoted text' grep
+	local local readonly printf x=1 --verbose grep -eu grep -eu export sed
+test printf /usr/bin awk awk 'quoted text'
+		"$1" x=1 echo /usr/bin 2>/dev/null 2>/dev/null
+		${HOME} && done -eu 2>/dev/null printf "$@" printf awk local 2>/dev/null
+	2>/dev/null "$@" "$@" awk sed --verbose | --verbose
+	x=1 "$@" local ${HOME} && 2>/dev/null readonly done
+	| cd test ${HOME} /usr/bin 2>/dev/null sed --verbose cd sed ${HOME} export
+awk done ${HOME} test -eu test awk grep ${HOME} sed local
+		$(pwd) 'quoted text' awk awk test 'quoted text' echo sed $(pwd) --verbose
+	| printf echo --verbose awk $(pwd) 2>/dev/null "$1" sed /usr/bin awk /usr/bin awk
+'quoted text' grep export echo
+"$@" -eu "$1" | done 2>/dev/null "$@" printf x=1 then
+	grep cd cd 2>/dev/null echo x=1 grep /usr/bin export
+		readonly readonly test export
+	"$@" && readonly test done "$@" sed -eu cd printf test --verbose 2>/dev/null
+-eu | local then x=1 -eu readonly $(pwd)
+"$1" done x=1 -eu done then local /usr/bin "$@" /usr/bin cd sed -eu sed
+	echo done test awk readonly export local && cd $(pwd) "$1" then cd
+	local grep test local | /usr/bin -eu printf
+	cd $(pwd) export then grep ${HOME} test
+awk "$@" | awk x=1 | /usr/bin $(pwd) "$1" export -eu grep then
+		-eu ${HOME} && local export test test /usr/bin grep && export $(pwd) $(pwd) readonly
+&& local "$1" "$1" 'quoted text' awk local x=1 "$1"
+	/usr/bin sed 2>/dev/null printf && grep && printf 2>/dev/null x=1
+grep export awk "$@" "$@" 'quoted text' -eu cd /usr/bin sed -eu --verbose
+	"$1" echo 2>/dev/null | done && --verbose 2>/dev/null test x=1 "$@"
+		done grep then export | grep 'quoted text' /usr/bin
+		--verbose cd x=1 done sed awk sed readonly grep /usr/bin done grep | printf
+		echo cd 'quoted text' test printf grep 'quoted text' echo then "$@" 'quoted text'
+		test sed $(pwd) -eu cd 2>/dev/null
+${HOME} && "$1" && echo sed
+$(pwd) export ${HOME} $(pwd) ${HOME} | "$1" | x=1
+		2>/dev/null -eu | sed && 'quoted text'
+	$(pwd) 'quoted text' /usr/bin x=1 "$1" /usr/bin awk test awk -eu 2>/dev/null
+		2>/dev/null -eu awk "$@" local x=1 "$1" x=1 done awk | grep cd 2>/dev/null
+		printf grep local /usr/bin "$@" readonly
+	"$@" 2>/dev/null local then
+		echo echo /usr/bin sed ${HOME} export local export "$@" done
+	then "$@" --verbose cd --verbose export echo x=1 -eu --verbose /usr/bin
+echo echo 'quoted text' awk local --verbose 'quoted text' ${HOME} sed
+		${HOME} "$1" $(pwd) && /usr/bin --verbose
+--verbose printf then awk grep
+2>/dev/null $(pwd) | done && && grep done ${HOME} 2>/dev/null
+	$(pwd) -eu && /usr/bin 2>/dev/null
+		${HOME} --verbose sed export $(pwd) awk 2>/dev/null grep
+local "$@" cd local sed export
+cd cd "$@" --verbose sed grep done 'quoted text'
+		local | "$@" readonly cd 2>/dev/null /usr/bin awk x=1 x=1 | --verbose local
+local cd export --verbose "$1"
+	x=1 readonly -eu /usr/bin x=1 && awk | echo
+		"$@" 2>/dev/null local -eu local then /usr/bin ${HOME} cd --verbose "$@" awk 2>/dev/null
+		'quoted text' export cd test readonly | readonly printf /usr/bin readonly export
+	"$1" /usr/bin readonly "$1"
+	-eu --verbose sed printf x=1 2>/dev/null --verbose 'quoted text' ${HOME} printf
+		then "$@" 2>/dev/null x=1 -eu readonly 'quoted text'
+grep && readonly test "$@"
+x=1 2>/dev/null readonly grep --verbose x=1 /usr/bin
+		awk test local x=1 x=1 2>/dev/null $(pwd) done awk -eu test "$@"
+		then $(pwd) x=1 'quoted text' | sed /usr/bin 2>/dev/null
+		/usr/bin /usr/bin then $(pwd) echo --verbose awk /usr/bin "$@" "$@" "$1"
+readonly 'quoted text' grep local "$1" 2>/dev/null done && "$@" "$@" "$@" ${HOME}
+		2>/dev/null echo printf -eu | 'quoted text' readonly /usr/bin
+	-eu 'quoted text' local x=1
+	printf $(pwd) && | -eu awk printf "$@" then
+--verbose cd --verbose 'quoted text' printf "$1" --verbose
+		-eu readonly -eu printf cd done "$1" | awk "$@" local 'quoted text'
+	'quoted text' sed done
+-eu --verbose -eu grep echo done x=1 2>/dev/null readonly printf && "$@" test test
+	"$@" sed then printf echo readonly export done $(pwd) grep | x=1 export
+		awk test echo $(pwd) "$1" export
+	--verbose printf | /usr/bin grep then
+		'quoted text' ${HOME} grep done
+		x=1 ${HOME} "$@" 'quoted text' "$@" x=1 -eu test &&
+		done /usr/bin | test "$@" "$@" done local sed readonly done 'quoted text' &&
+${HOME} echo x=1 | export sed awk /usr/bin ${HOME}
+	awk /usr/bin test 2>/dev/null printf "$@" 'quoted text' $(pwd)
+	"$1" && -eu local printf readonly
+		local sed printf grep $(pwd) x=1 echo --verbose ${HOME} | -eu sed x=1
+2>/dev/null echo x=1 grep readonly awk /usr/bin echo echo "$1" cd "$1"
+	local cd 2>/dev/null "$1" /usr/bin readonly 'quoted text' echo export readonly
+	2>/dev/null ${HOME} then x=1 then
+	"$1" --verbose "$@" sed | then awk cd 2>/dev/null 2>/dev/null && then "$1" grep
+| /usr/bin printf && x=1 ${HOME} | echo local done
+		awk grep $(pwd) printf readonly ${HOME}
+	printf sed 'quoted text' echo
+		x=1 grep -eu 'quoted text'
+	echo printf | export 2>/dev/null echo echo && grep "$@" x=1 'quoted text'
+"$@" test printf "$1" grep 2>/dev/null 'quoted text' x=1 cd cd /usr/bin awk
+		-eu export then 'quoted text' "$@" export grep
+		&& echo echo echo 2>/dev/null /usr/bin local $(pwd) printf "$1" local $(pwd) 'quoted text'
+$(pwd) x=1 --verbose -eu /usr/bin export local 'quoted text' test
+/usr/bin local ${HOME} $(pwd) sed $(pwd)
+		echo export /usr/bin sed 2>/dev/null readonly sed /usr/bin
+	local sed "$@" done done | test "$@" printf | sed "$1" printf readonly
+| printf --verbose done x=1 test --verbose printf
+		/usr/bin awk test "$1" grep 2>/dev/null done then
+	&& x=1 | -eu 'quoted text' ${HOME} sed export ${HOME} "$1" | export grep "$@"
+		${HOME} test local readonly 2>/dev/null 'quoted text' printf 2>/dev/null -eu
+	sed awk /usr/bin "$1" /usr/bin 'quoted text'
+	&& --verbose echo --verbose sed cd x=1 ${HOME}
+echo sed && grep "$1" done ${HOME} "$@" $(pwd) done 2>/dev/null sed 2>/dev/null
+		then export export local sed && 'quoted text'
+echo && sed local local ${HOME} /usr/bin grep && "$1" $(pwd) ${HOME} x=1 &&
+		2>/dev/null then 'quoted text' ${HOME} 2>/dev/null x=1 "$1" awk && ${HOME} x=1
+	local done readonly "$1" printf
+echo "$@" sed x=1 "$1" /usr/bin x=1 && 'quoted text'
+/usr/bin sed -eu readonly awk 2>/dev/null "$1" test 'quoted text'
+		awk --verbose $(pwd) /usr/bin "$1" export printf /usr/bin "$@" local
+	local then $(pwd) awk --verbose && done local /usr/bin
+		"$1" | ${HOME} 'quoted text' && cd
+		done cd awk "$1" "$@" awk echo done awk grep awk readonly ${HOME} x=1
+		export && sed "$1" $(pwd) echo | echo "$@" -eu cd 2>/dev/null
+	grep cd sed cd 2>/dev/null sed local x=1 'quoted text' grep
+echo "$@" then -eu sed test ${HOME} --verbose --verbose /usr/bin /usr/bin
+sed local done cd sed grep done printf
+	done x=1 | local 2>/dev/null
+	awk -eu $(pwd) local echo grep echo grep "$@" && 'quoted text' printf 2>/dev/null
+		"$1" done echo | then printf $(pwd) done echo local awk
+	&& then cd then local then --verbose --verbose then "$@" 'quoted text' cd cd
+x=1 "$@" -eu 'quoted text' "$1" readonly sed local 'quoted text'
+	"$@" printf done | "$1" test | then cd
+2>/dev/null && /usr/bin sed export sed echo done
+	&& test 'quoted text'
+done x=1 sed -eu --verbose "$@" grep /usr/bin | 2>/dev/null "$1" "$1"
+		echo printf 'quoted text' 2>/dev/null
+		--verbose | cd && sed readonly export | --verbose --verbose x=1 ${HOME} && &&
+	export local && /usr/bin awk printf 'quoted text' x=1 printf
+-eu awk x=1 && readonly export --verbose
+	${HOME} export x=1 --verbose cd readonly /usr/bin test |
+	'quoted text' export done echo local awk "$@" "$@" done 'quoted text'
+		/usr/bin awk 2>/dev/null 2>/dev/null | test 'quoted text' test ${HOME} $(pwd)
+	&& /usr/bin sed echo -eu then "$@" readonly then then local ${HOME}
+		export && /usr/bin awk export test
+		echo ${HOME} --verbose local "$1" x=1 then done readonly /usr/bin /usr/bin
+		readonly test $(pwd) ${HOME} /usr/bin grep /usr/bin echo --verbose
+	cd 'quoted text' ${HOME} --verbose
+		&& "$1" -eu | ${HOME}
+		grep echo readonly sed test printf test ${HOME}
+x=1 export x=1 printf && 'quoted text' export test
+then "$1" then sed ${HOME} sed echo
+"$1" && grep local | "$@" && cd "$1" 2>/dev/null printf
+		done ${HOME} echo | sed export | "$@" 'quoted text'
+		/usr/bin $(pwd) sed then /usr/bin awk 2>/dev/null -eu -eu $(pwd) readonly
+cd grep printf grep "$@" 2>/dev/null
+	&& cd --verbose sed && echo | $(pwd)
+		cd 'quoted text' "$@" grep
+	sed sed awk $(pwd) done then 'quoted text' "$1" export then 2>/dev/null
+x=1 export | done "$@" readonly
+		export printf "$1" test echo --verbose
+		then 'quoted text' export 2>/dev/null
+		sed done grep readonly "$@" test 2>/dev/null /usr/bin $(pwd) $(pwd) /usr/bin
+	then 2>/dev/null echo
+	&& echo "$@" echo readonly grep $(pwd) $(pwd) local && done -eu
+		/usr/bin sed "$1" 2>/dev/null -eu -eu then "$1" "$1" then "$1"
+test 2>/dev/null printf "$@" "$1"
+		-eu cd echo 2>/dev/null /usr/bin -eu | $(pwd) 'quoted text'
+		${HOME} ${HOME} "$1" $(pwd) | readonly ${HOME} grep
+export && "$1" echo $(pwd) "$1"
+		echo export local $(pwd) 'quoted text'
+		"$1" -eu sed printf "$1" --verbose local "$@" sed
+		"$1" "$@" local awk | /usr/bin "$@" export sed | "$@" /usr/bin x=1 local --verbose
+${HOME} "$1" "$1" -eu local -eu 'quoted text' "$@"
+		sed -eu cd cd --verbose &&
+		| | grep echo test cd cd ${HOME} printf $(pwd)
+/usr/bin readonly export "$1" local done $(pwd) -eu awk sed | then echo 2>/dev/null
+	then "$@" "$@" then echo export | /usr/bin
+awk 2>/dev/null echo cd && | $(pwd) then awk ${HOME} 'quoted text'
+		readonly awk readonly && && "$1" then "$1"
+		"$@" export printf ${HOME} "$1" x=1 awk local
+test "$@" /usr/bin && /usr/bin cd printf "$@" x=1 --verbose
+	$(pwd) 2>/dev/null local "$@"
+| then sed "$1" $(pwd) readonly
+"$1" /usr/bin $(pwd) -eu && 2>/dev/null local /usr/bin 'quoted text'
+awk export /usr/bin then readonly x=1 2>/dev/null cd awk echo cd
+		grep printf awk readonly test | && 'quoted text' then grep
+		printf | grep then ${HOME} ${HOME} local local $(pwd) awk echo
+	echo cd sed awk $(pwd) echo "$1" $(pwd) 'quoted text' printf done grep
+cd | ${HOME} sed --verbose -eu "$1"
+		grep printf cd export
+/usr/bin | "$1" done && "$@" cd grep cd echo
+	"$@" && awk 'quoted text' "$@" | -eu
+	-eu | "$@" printf cd ${HOME} | echo "$@" done then
+grep printf local 2>/dev/null test | && --verbose
+		cd done readonly export "$@"
+$(pwd) ${HOME} $(pwd) awk ${HOME} printf grep /usr/bin
+		'quoted text' "$1" local
+		echo 2>/dev/null --verbose awk --verbose && printf readonly x=1 test printf printf
+test "$1" && sed "$@" done ${HOME} grep "$@" 2>/dev/null 'quoted text' -eu
+cd readonly grep done readonly test --verbose "$1" "$1" printf
+	export && x=1 2>/dev/null | ${HOME} x=1
+export echo --verbose printf "$@" x=1 awk $(pwd) local
+	cd && printf /usr/bin export cd cd export then x=1 'quoted text'
+		awk readonly | && "$1" 'quoted text' "$1" test 'quoted text' /usr/bin awk
+	x=1 sed 2>/dev/null cd export --verbose /usr/bin then $(pwd)
+		local cd ${HOME} cd $(pwd)
+		printf sed awk 'quoted text' grep done "$1" "$@" -eu echo | /usr/bin echo 2>/dev/null
+2>/dev/null ${HOME} test export 2>/dev/null readonly -eu 'quoted text'
+"$1" x=1 "$@" local test export then "$1"
+	| && 'quoted text' grep grep grep cd 'quoted text' sed x=1 done
+export awk -eu grep x=1 && &&
+&& ${HOME} done echo "$@" awk $(pwd) 'quoted text'
+		/usr/bin readonly export -eu export grep "$@" awk printf 2>/dev/null readonly
+		done && x=1 printf "$1" echo /usr/bin "$@" grep then printf
+	echo grep local then grep -eu then
+		printf 2>/dev/null test 2>/dev/null
+	--verbose test ${HOME} echo printf local && grep -eu local test /usr/bin
+		export x=1 && && done --verbose $(pwd) "$1" done local "$1" /usr/bin --verbose
+	readonly 'quoted text' export -eu then "$@"
+&& echo cd test grep $(pwd) done x=1 local --verbose $(pwd) /usr/bin awk
+		local local x=1 export | ${HOME} 'quoted text' awk "$@" && sed
+	readonly done awk x=1 printf readonly ${HOME} echo sed --verbose echo
+then "$1" ${HOME} "$1" $(pwd)
+/usr/bin | test then export /usr/bin test --verbose sed | sed
+	done ${HOME} test local done export x=1 local "$@" x=1 sed && printf --verbose
+		readonly | --verbose | awk -eu && ${HOME} x=1 | sed grep readonly
+'quoted text' "$@" --verbose sed
+-eu $(pwd) awk 'quoted text' then awk sed echo readonly
+--verbose 'quoted text' && | grep awk --verbose
+test sed "$1" -eu x=1 local "$1"
+-eu cd --verbose x=1 'quoted text' &&
+		test /usr/bin echo done sed then test --verbose
+		"$1" --verbose then x=1
+		x=1 | test $(pwd) ${HOME} && "$@" "$1" $(pwd) cd 'quoted text' /usr/bin sed test
+export then $(pwd) test then awk && "$@" -eu 2>/dev/null && /usr/bin printf readonly
+	2>/dev/null "$@" echo echo 'quoted text' 2>/dev/null readonly
+echo readonly done sed "$@" "$@" readonly ${HOME} test ${HOME}
+		'quoted text' x=1 test --verbose | ${HOME} x=1
+		printf done cd $(pwd) export readonly 2>/dev/null then readonly
+		local export $(pwd) readonly
+	| awk "$@" echo test done --verbose awk test "$@" ${HOME} ${HOME} /usr/bin
+	grep sed ${HOME} "$1" echo "$1" sed 'quoted text' grep grep
+	2>/dev/null && test grep "$@" "$1" sed printf "$@" export | grep test -eu export
+	grep $(pwd) sed grep test "$@" done export $(pwd) sed ${HOME} sed awk -eu export
+		printf then | local readonly then
+	-eu "$@" grep $(pwd) -eu export /usr/bin printf 'quoted text' "$1" ${HOME} 2>/dev/null
+	export | awk "$1" cd -eu --verbose export
+	&& local $(pwd) grep 2>/dev/null
+		export then local echo readonly awk export sed
+		then readonly ${HOME} then ${HOME} | | --verbose
+		done ${HOME} echo local && && "$@" grep
+		local ${HOME} echo 'quoted text' then &&
+	--verbose --verbose grep grep awk echo | "$@" "$@" sed export export readonly
+	x=1 grep sed /usr/bin readonly
+		--verbose 'quoted text' sed done grep awk
+	then --verbose "$1" cd awk cd $(pwd) x=1 printf grep echo export then /usr/bin
+		| $(pwd) local x=1 test readonly x=1 cd && readonly 'quoted text' "$@"
+--verbose -eu ${HOME} export echo local export export $(pwd) then readonly
+	local done --verbose 2>/dev/null awk ${HOME} /usr/bin /usr/bin ${HOME}
+	'quoted text' --verbose "$@" /usr/bin
+grep local export sed cd test
+| -eu test done ${HOME} local test echo 'quoted text' /usr/bin $(pwd) 2>/dev/null
+	x=1 $(pwd) cd 2>/dev/null export && echo | readonly export then 'quoted text'
+		export | done | "$@" readonly 'quoted text' awk
+'quoted text' grep local 2>/dev/null ${HOME} local && $(pwd) /usr/bin cd test
+		export x=1 cd "$1" grep -eu
+		sed then "$@" /usr/bin grep -eu $(pwd) readonly 2>/dev/null
+		test 'quoted text' test export test x=1 x=1 $(pwd)
+then awk | local 'quoted text'
+	${HOME} test --verbose && --verbose echo local test --verbose
+awk export 'quoted text'
+		&& ${HOME} grep $(pwd) local "$1" 'quoted text' x=1 export
+	-eu then test readonly 2>/dev/null "$1" 'quoted text' grep local "$1" printf
+		export 2>/dev/null sed grep grep $(pwd) 2>/dev/null "$1" readonly awk
+		--verbose $(pwd) export ${HOME}
+then "$1" --verbose grep done "$1" done
+	| grep printf test | awk
+		| --verbose grep 'quoted text' printf --verbose then x=1 -eu awk x=1
+	/usr/bin readonly "$1" $(pwd) grep grep cd printf test -eu awk 2>/dev/null 'quoted text'
+		cd "$@" --verbose echo local -eu done 'quoted text' 2>/dev/null -eu
+		x=1 "$@" 2>/dev/null grep ${HOME} /usr/bin /usr/bin
+	done && awk then done && echo /usr/bin /usr/bin printf x=1 $(pwd)
+		awk awk -eu readonly --verbose cd done
+		done local local printf | then
+"$@" 'quoted text' export done readonly && "$@"
+		then sed "$@" grep local sed done export "$@" cd && &&
+cd | printf then && "$1"
+		local "$@" echo local readonly
+cd grep test export /usr/bin grep && test export "$@" printf "$@" x=1 -eu
+		grep ${HOME} $(pwd) done sed printf
+	cd test && | 'quoted text' "$1" readonly --verbose 2>/dev/null cd sed
+| "$1" /usr/bin --verbose "$1" -eu $(pwd) export "$1" 'quoted text' --verbose
+	x=1 2>/dev/null grep printf done
+		/usr/bin done test ${HOME} "$1" local cd test
+	sed test x=1 /usr/bin test grep
+	cd then printf done "$1" export then ${HOME}
+	local cd --verbose local x=1 | echo sed
+	'quoted text' then awk printf test | /usr/bin echo readonly grep | export
+cd /usr/bin $(pwd) sed grep then export
+		echo grep $(pwd) awk 'quoted text'
+| && then cd then x=1 --verbose grep -eu $(pwd) then readonly sed | --verbose
+-eu local && sed grep cd cd $(pwd) export
+	| x=1 2>/dev/null sed sed 2>/dev/null
+		export readonly ${HOME} export awk $(pwd) --verbose --verbose --verbose test
+	echo echo x=1 x=1 'quoted text' sed echo && local x=1 /usr/bin "$@" test sed done
+	"$@" export done "$1" test
+local ${HOME} $(pwd) /usr/bin test cd sed x=1 x=1 x=1
+		done "$@" 'quoted text'
+		local sed --verbose --verbose
+--verbose "$@" grep printf grep cd printf --verbose sed grep export awk cd export
+done ${HOME} "$1" 2>/dev/null
+		test | ${HOME} 'quoted text' echo
+then echo "$1" awk printf local awk ${HOME} cd readonly then | export && test readonly
+	$(pwd) ${HOME} cd x=1 x=1 $(pwd) 'quoted text' $(pwd)
+	readonly | readonly printf x=1 ${HOME} cd /usr/bin sed "$@"
+-eu local awk /usr/bin 'quoted text'
+$(pwd) 2>/dev/null then 'quoted text'
+$(pwd) cd $(pwd) then readonly grep readonly /usr/bin cd readonly "$@" printf
+	local && local x=1 "$@" awk export "$@"
+		x=1 ${HOME} $(pwd) test sed $(pwd)
+readonly local cd ${HOME} then cd $(pwd) 'quoted text' cd printf
+		/usr/bin 2>/dev/null cd "$@" awk && | test grep printf
+		/usr/bin local ${HOME} "$@" ${HOME} "$@" awk
+		readonly -eu 2>/dev/null test
+	${HOME} -eu ${HOME} /usr/bin
+		"$1" then sed 'quoted text' | grep printf then printf && "$@" grep "$@" /usr/bin
+awk local 'quoted text' "$1" local local awk
+2>/dev/null "$1" awk test
+		printf /usr/bin grep sed $(pwd) cd readonly | then ${HOME}
+	${HOME} readonly | 2>/dev/null
+		&& "$1" -eu -eu /usr/bin grep printf grep --verbose
+	then --verbose test local test /usr/bin awk --verbose
+"$@" printf ${HOME} | readonly "$1" test then --verbose
+cd done cd local -eu $(pwd) cd local 'quoted text' done && sed "$1" cd sed
+	test && "$@" awk ${HOME} done test
+		local 'quoted text' /usr/bin $(pwd)
+		printf -eu cd done "$1"
+cd /usr/bin done x=1 x=1 printf test x=1 echo --verbose | && readonly 'quoted text'
+/usr/bin awk printf sed "$1" && then sed "$@" cd printf 2>/dev/null echo
+		then ${HOME} && ${HOME} awk sed "$1" done cd cd awk readonly "$@" x=1 done done
+	local ${HOME} sed grep /usr/bin printf cd awk $(pwd) && | && "$@" x=1 -eu done
+	test local 'quoted text' sed && cd
+then export $(pwd) "$@" export then local awk export
+	readonly grep 'quoted text' $(pwd) ${HOME} x=1 -eu "$1" -eu $(pwd)
+		-eu export x=1 --verbose awk 2>/dev/null cd readonly grep && grep
+		printf /usr/bin ${HOME} grep echo $(pwd) ${HOME}
+	printf export grep /usr/bin "$@" grep 'quoted text' "$1"
+		-eu -eu readonly 'quoted text' then 2>/dev/null
+		$(pwd) awk && x=1 2>/dev/null $(pwd)
+		2>/dev/null x=1 $(pwd) ${HOME} --verbose /usr/bin
+	cd export x=1 readonly -eu x=1 done local
+		export -eu done awk && -eu "$@" | 'quoted text'
+	2>/dev/null $(pwd) test awk x=1 sed "$@" echo "$@" && echo "$@" echo &&
+		cd "$1" cd -eu 2>/dev/null then 2>/dev/null 'quoted text' 2>/dev/null grep grep
+"$1" "$@" echo x=1 done 'quoted text'
+	$(pwd) 2>/dev/null local echo 2>/dev/null
+	'quoted text' x=1 export local test
+"$@" export export local x=1 --verbose awk echo "$1" awk
+	--verbose local done "$1" grep | then
+		readonly then test export readonly && 2>/dev/null grep export x=1
+	cd -eu awk readonly ${HOME} local done
+readonly echo printf "$@" 'quoted text'
+cd sed /usr/bin | awk readonly test echo export "$@" "$@" cd readonly 2>/dev/null
+echo done x=1 --verbose printf echo then sed export printf awk -eu then -eu
+		&& "$@" printf echo test "$@" local 'quoted text' 'quoted text'
+		awk "$@" echo /usr/bin && && then echo sed "$1" "$1" /usr/bin readonly
+x=1 -eu "$1" 2>/dev/null echo -eu local ${HOME} $(pwd)
+	cd echo readonly readonly printf -eu sed
+| awk -eu "$@" && && 2>/dev/null test
+	&& x=1 && sed export
+	local printf "$@" 'quoted text'
+awk /usr/bin echo done grep x=1 "$1" "$1" 'quoted text'
+		/usr/bin printf cd --verbose | test
+	echo cd sed grep export printf && &&
+		readonly | --verbose grep export -eu
+		awk done $(pwd) then 'quoted text' test cd /usr/bin /usr/bin
+local "$@" done 2>/dev/null done 2>/dev/null "$1"
+printf && -eu ${HOME} local "$1" test --verbose "$1" cd --verbose
+"$1" -eu printf "$1" readonly x=1 test test x=1 done x=1 sed readonly
+	sed --verbose 'quoted text'
+		awk awk | grep && test printf sed done "$@" /usr/bin && awk cd "$@" "$@" "$1" $(pwd)
+'quoted text' "$1" awk cd export 2>/dev/null cd | sed | &&
+--verbose local awk awk "$@" 2>/dev/null printf $(pwd) "$@"
+--verbose x=1 printf && sed echo printf $(pwd) 2>/dev/null export
+		cd readonly done cd -eu 'quoted text'
+-eu local test /usr/bin
+"$1" && sed -eu export printf cd /usr/bin x=1 "$1" test local cd
+		| 2>/dev/null local x=1 | cd $(pwd) && "$@" 'quoted text'
+		/usr/bin readonly ${HOME} 'quoted text' awk $(pwd) 2>/dev/null
+		done $(pwd) cd readonly awk | printf | x=1 x=1 $(pwd) /usr/bin /usr/bin
+	2>/dev/null test awk && -eu ${HOME} && "$@" -eu export readonly "$1" awk printf
+	export printf done awk "$@" local --verbose readonly local sed
+	$(pwd) local local awk cd printf test awk grep | local 2>/dev/null
+readonly && 2>/dev/null echo readonly sed printf sed
+		/usr/bin && && test readonly "$@"
+		export echo grep grep --verbose
+	local 'quoted text' cd ${HOME} cd && sed echo grep cd -eu sed readonly test printf
+		"$1" export sed printf grep | export $(pwd) echo cd "$@" 'quoted text' && /usr/bin
+$(pwd) done | export readonly
+"$@" export then 'quoted text' local --verbose /usr/bin done "$@" x=1 ${HOME}
+	test | x=1 done then export 2>/dev/null awk echo cd test
+		--verbose $(pwd) 'quoted text' $(pwd) /usr/bin grep export done --verbose done
+	/usr/bin x=1 local printf sed then done | 'quoted text'
+printf 'quoted text' printf cd then --verbose echo export "$@" readonly
+		-eu && x=1 -eu ${HOME} "$1" then cd printf | local sed "$1" readonly ${HOME}
+${HOME} readonly local 'quoted text' awk printf sed grep test
+		readonly /usr/bin "$@" printf -eu done $(pwd) then $(pwd)
+sed /usr/bin test cd 'quoted text' readonly cd grep 'quoted text'
+grep /usr/bin "$1" readonly done | -eu 2>/dev/null
+		${HOME} then && 'quoted text' test test -eu /usr/bin "$1"
+		--verbose test echo x=1
+	local echo awk cd $(pwd)
+		| readonly "$1" printf "$@" 'quoted text' -eu ${HOME} "$1"
+cd ${HOME} x=1 && ${HOME} --verbose --verbose local $(pwd)
+x=1 && readonly readonly grep awk /usr/bin "$1" 'quoted text' ${HOME}
+$(pwd) test echo 2>/dev/null awk echo test x=1 2>/dev/null | &&
+		test x=1 'quoted text' /usr/bin grep sed 2>/dev/null "$1" ${HOME}
+		local printf $(pwd) "$@" then /usr/bin
+${HOME} -eu cd /usr/bin /usr/bin
+	"$1" done $(pwd) "$@" printf then "$@" awk local then $(pwd) cd "$@"
+-eu sed cd --verbose /usr/bin test sed sed then -eu -eu x=1 grep
+2>/dev/null export ${HOME} --verbose 'quoted text' then cd echo
+	$(pwd) local /usr/bin x=1 | ${HOME} /usr/bin 2>/dev/null
+	| grep $(pwd) test x=1 done | cd x=1 sed readonly
+$(pwd) echo "$1" "$1" && 'quoted text' --verbose printf
+/usr/bin /usr/bin "$@" x=1 /usr/bin export
+$(pwd) then local test "$1" cd && readonly readonly
+		export echo $(pwd) cd 2>/dev/null echo && x=1 --verbose then cd 2>/dev/null
+${HOME} 2>/dev/null && -eu echo sed then --verbose
+${HOME} awk done -eu 'quoted text' readonly | readonly --verbose sed printf --verbose
+		echo -eu -eu 2>/dev/null
+	2>/dev/null test echo readonly test test | grep echo -eu
+		'quoted text' sed ${HOME}
+		/usr/bin done readonly "$@"
+		cd printf printf done grep cd ${HOME} "$@" --verbose && export ${HOME} "$1" export
+	&& readonly 'quoted text' grep
+	cd /usr/bin x=1 | test sed cd $(pwd) /usr/bin 'quoted text' then cd then | cd export
+	local echo x=1 grep ${HOME} | | --verbose 'quoted text' && test
+	local --verbose printf grep 2>/dev/null && "$1" readonly --verbose echo
+-eu grep "$@" 2>/dev/null "$@" done
+	2>/dev/null readonly $(pwd)
+		echo -eu | 2>/dev/null cd local echo export ${HOME} "$1" local printf 'quoted text'
+test grep printf echo 2>/dev/null
+	export test | 'quoted text' export export
+	x=1 | --verbose local $(pwd) export export printf 'quoted text' sed printf
+	sed /usr/bin ${HOME} "$@" echo printf /usr/bin 'quoted text'
+done cd done /usr/bin test grep awk "$1" then grep then then --verbose readonly
+/usr/bin x=1 readonly readonly
+--verbose /usr/bin 2>/dev/null awk "$@" awk 'quoted text'
+		2>/dev/null grep "$1" "$@" done && test cd grep
+| readonly printf test cd -eu $(pwd) then echo awk
+$(pwd) 'quoted text' cd grep 'quoted text' export /usr/bin
+readonly "$@" && ${HOME} && awk echo
+		readonly echo | --verbose then awk grep test sed $(pwd) /usr/bin 'quoted text'
+		'quoted text' echo -eu test -eu "$1" then awk |
+		"$@" -eu sed grep printf done "$1" -eu then readonly cd | readonly "$@" echo
+printf grep --verbose grep | 'quoted text'
+${HOME} cd export awk cd "$1" cd /usr/bin
+	then | echo 'quoted text' | $(pwd) echo printf then | printf test
+	| local awk "$1" && local $(pwd) /usr/bin ${HOME} 2>/dev/null local
+/usr/bin sed echo "$1" printf readonly 'quoted text' export 2>/dev/null
+		then readonly /usr/bin echo export $(pwd) && | cd sed --verbose done $(pwd)
+"$1" && readonly cd $(pwd)
+	--verbose readonly 'quoted text' $(pwd) sed printf x=1 readonly
+		done cd grep sed readonly
+		awk | echo grep local
+grep 2>/dev/null readonly "$@" "$1" /usr/bin awk
+	/usr/bin x=1 sed local readonly cd -eu cd printf --verbose 2>/dev/null
+sed $(pwd) test $(pwd) sed done "$1" printf echo echo "$1" test echo local
+export awk "$@" local
+		test printf 2>/dev/null done sed $(pwd) "$1" x=1
+grep cd ${HOME} -eu grep | | cd grep | 2>/dev/null sed awk x=1 echo
+		&& -eu ${HOME} $(pwd) cd && && /usr/bin test grep
+		cd "$@" && /usr/bin 2>/dev/null
+	$(pwd) "$@" 2>/dev/null echo test sed done awk "$1" export "$1"
+	awk ${HOME} x=1 $(pwd) grep 2>/dev/null cd 2>/dev/null
+test cd cd printf x=1 /usr/bin cd local "$@"
+--verbose "$1" test echo echo -eu export awk sed /usr/bin
+'quoted text' readonly $(pwd) echo 2>/dev/null printf
+	x=1 $(pwd) local local local /usr/bin grep $(pwd) grep echo "$@" echo 'quoted text'
+--verbose && -eu printf ${HOME} | test done | then export /usr/bin
+export --verbose ${HOME} grep | printf
+		readonly x=1 "$1" "$@" test printf awk -eu local grep readonly export "$1"
+		| ${HOME} 'quoted text' --verbose "$@" test done test readonly --verbose awk
+		'quoted text' | then $(pwd) 2>/dev/null export test awk printf grep
+x=1 grep | test ${HOME} sed local x=1 awk x=1
+--verbose --verbose cd "$@" ${HOME} awk $(pwd) done local test
+		test echo cd export export printf $(pwd) ${HOME} readonly
+	test then test ${HOME} 2>/dev/null -eu
+/usr/bin $(pwd) "$1" --verbose echo
+		echo --verbose done x=1 ${HOME}
+	x=1 readonly x=1 echo x=1 ${HOME} -eu then done $(pwd)
+local export then --verbose done awk test 2>/dev/null
+grep "$1" /usr/bin ${HOME} x=1 sed x=1 'quoted text' sed local "$@" local x=1
+	echo x=1 sed $(pwd) printf "$@" 2>/dev/null
+		export cd printf /usr/bin then ${HOME}
+echo sed sed ${HOME} "$@" "$1" then grep grep test echo
+x=1 && test "$@" readonly echo $(pwd) local then --verbose --verbose x=1 "$1" /usr/bin
+		$(pwd) $(pwd) sed "$1" -eu "$@" && cd "$@" $(pwd) awk "$1" grep
+echo && printf local $(pwd) x=1 -eu cd grep ${HOME} /usr/bin -eu 2>/dev/null /usr/bin
+	cd sed done then local local grep /usr/bin echo /usr/bin readonly $(pwd)
+		&& sed /usr/bin export readonly
+readonly | grep done /usr/bin "$@" awk
+test cd export 2>/dev/null test --verbose x=1 test -eu
+		grep x=1 /usr/bin --verbose export printf then sed -eu && test echo
+${HOME} ${HOME} -eu -eu x=1 "$@" local -eu 2>/dev/null
+		/usr/bin "$@" "$1" test then cd cd $(pwd)
+		test && /usr/bin done ${HOME} | printf "$@" printf
+${HOME} awk && 2>/dev/null awk cd $(pwd) /usr/bin local export
+echo 2>/dev/null grep grep | awk awk ${HOME} test
+		test "$1" sed 2>/dev/null | | printf | printf -eu
+		printf /usr/bin $(pwd) echo awk grep export test
+	-eu -eu "$@" --verbose export
+cd "$1" /usr/bin ${HOME}
+		&& -eu ${HOME} awk printf x=1 export "$@" done 'quoted text'
+		local done printf /usr/bin $(pwd) | grep
+		echo ${HOME} readonly /usr/bin
+	printf --verbose test 2>/dev/null then 'quoted text' test
+	&& 'quoted text' && cd --verbose ${HOME} $(pwd)
+	$(pwd) grep "$@" -eu awk awk /usr/bin /usr/bin
+	&& /usr/bin | sed grep 'quoted text' local
+export && "$1" "$1" awk ${HOME} /usr/bin 'quoted text'
+	local 2>/dev/null grep cd printf local /usr/bin
+sed && --verbose "$@" echo -eu done $(pwd) local "$@" --verbose
+	echo local 2>/dev/null readonly /usr/bin 2>/dev/null sed then
+$(pwd) test 2>/dev/null && $(pwd) $(pwd) --verbose ${HOME} local
+	cd printf readonly grep done 2>/dev/null
+then $(pwd) | "$@" "$1" sed 2>/dev/null
+$(pwd) printf /usr/bin ${HOME} printf -eu x=1 echo ${HOME} sed $(pwd) cd
+	cd done && $(pwd) -eu sed local $(pwd) printf x=1 | export printf "$1" done grep
+	then "$@" grep sed grep --verbose printf 2>/dev/null sed then 2>/dev/null
+	-eu then echo $(pwd) test 'quoted text'
+		x=1 awk sed ${HOME} printf cd grep --verbose 2>/dev/null
+		grep 2>/dev/null printf test x=1 "$1"
+local export -eu -eu /usr/bin printf then "$@" printf awk "$1" x=1 export
+readonly 'quoted text' 'quoted text' grep echo 2>/dev/null
+		sed grep ${HOME} awk | | "$1" export /usr/bin readonly 2>/dev/null readonly
+		${HOME} --verbose ${HOME} ${HOME} done done
+		then done && done then test printf $(pwd) awk then /usr/bin done
+		readonly echo ${HOME} $(pwd) 'quoted text' awk cd printf
+		"$@" cd ${HOME} done 2>/dev/null | local $(pwd) done local "$@"
+		test 'quoted text' "$1" printf local "$1" echo cd -eu awk
+	export local awk done x=1 local ${HOME} 2>/dev/null
+		done 'quoted text' 'quoted text'
+	sed local then readonly local x=1 cd local "$@" | sed "$1" cd /usr/bin
+	2>/dev/null then "$1" -eu grep
+export echo sed done then readonly then cd "$@" x=1 cd -eu
+		$(pwd) -eu grep 2>/dev/null "$@" local readonly /usr/bin x=1 ${HOME} --verbose
+	awk export done grep cd cd sed -eu --verbose /usr/bin --verbose
+/usr/bin && then x=1 2>/dev/null "$1" /usr/bin
+		-eu local echo "$1" | -eu local ${HOME} cd sed | then
+		printf | sed 2>/dev/null /usr/bin 'quoted text' | grep
+		then printf "$1" "$1" test awk readonly
+		readonly done x=1 local 'quoted text' x=1
+	"$@" | x=1 -eu $(pwd) grep sed && local test export awk ${HOME} printf
+"$1" awk grep | $(pwd) ${HOME} x=1 test x=1 --verbose "$@"
+	awk echo local printf /usr/bin 'quoted text'
+		export && 2>/dev/null done
+		${HOME} -eu grep x=1 --verbose --verbose local done test sed "$1" cd "$@"
+test echo ${HOME} -eu sed
+		| /usr/bin /usr/bin /usr/bin done cd | awk "$1"
+		| $(pwd) cd 2>/dev/null local
+		'quoted text' /usr/bin test
+		printf printf awk 2>/dev/null ${HOME}
+		done grep done /usr/bin "$@" "$1"
+	sed 2>/dev/null --verbose $(pwd) test
+		x=1 readonly local readonly grep ${HOME}
+	/usr/bin && printf export test done $(pwd) 2>/dev/null x=1 && local done /usr/bin
+${HOME} "$@" "$@" export awk
+	--verbose readonly grep --verbose 2>/dev/null -eu
+	printf done test -eu -eu 2>/dev/null "$@" ${HOME} && && x=1
+awk --verbose && local 'quoted text' printf echo /usr/bin
+		x=1 done && readonly then && | $(pwd) cd --verbose
+		done readonly $(pwd) --verbose
+"$1" && grep && echo awk export --verbose
+awk test printf then $(pwd) grep /usr/bin
+		$(pwd) /usr/bin echo "$@" | cd cd "$@" ${HOME} awk echo awk x=1 grep -eu "$1"
+		"$1" ${HOME} /usr/bin sed
+	&& export awk echo --verbose grep x=1 sed export $(pwd)
+	&& cd grep ${HOME} then
+done awk then local 'quoted text' echo "$@" test awk
+	-eu $(pwd) local local /usr/bin cd "$1" x=1 $(pwd) readonly
+echo -eu then /usr/bin
+	&& echo grep /usr/bin then awk local "$1" && sed "$@" && cd --verbose
+		x=1 export awk then then export 'quoted text' --verbose -eu
+		--verbose done 'quoted text' | /usr/bin $(pwd) grep
+	done /usr/bin printf "$@" cd echo done test $(pwd) export "$1" local /usr/bin
+		export echo "$@" local awk $(pwd)
+		printf echo echo then grep cd test "$1" $(pwd) "$1" --verbose test /usr/bin
+then readonly 'quoted text' test export /usr/bin cd $(pwd) done --verbose
+test sed sed sed ${HOME} local cd echo 2>/dev/null
+	"$@" $(pwd) --verbose x=1 done --verbose printf ${HOME} "$@" sed | printf
+		/usr/bin -eu "$@" awk $(pwd) &&
+	&& done test local | test --verbose then
+		-eu then --verbose && /usr/bin 'quoted text' test /usr/bin sed sed printf
+		awk "$@" printf --verbose x=1 export "$1" readonly
+		"$@" echo ${HOME} printf sed printf
+		sed "$@" "$1" cd awk readonly sed -eu export && printf /usr/bin ${HOME}
+cd sed sed sed "$1" echo then echo ${HOME}
+		-eu cd && /usr/bin "$@" --verbose /usr/bin 'quoted text' test x=1 -eu x=1
+		export awk ${HOME} local done $(pwd) sed echo /usr/bin sed 'quoted text'
+	${HOME} -eu && 2>/dev/null test "$1" --verbose printf test 2>/dev/null
+		awk grep ${HOME} /usr/bin | /usr/bin $(pwd)
+		&& --verbose 2>/dev/null grep done ${HOME}
+local "$@" -eu export 2>/dev/null "$@" 'quoted text' /usr/bin
+--verbose /usr/bin cd $(pwd) 'quoted text' 'quoted text'
+	grep "$@" printf sed 'quoted text' /usr/bin x=1 cd test | | ${HOME}
+echo /usr/bin cd then 'quoted text' printf ${HOME} | && "$@"
+		-eu $(pwd) export && "$1" x=1 printf $(pwd) | awk
+printf local --verbose export grep && 2>/dev/null printf grep
+	awk $(pwd) -eu cd | "$1" test grep done sed 2>/dev/null /usr/bin echo readonly
+${HOME} grep sed 'quoted text' ${HOME} && cd cd grep grep awk echo readonly
+	then 'quoted text' printf cd "$1" awk
+	sed grep && local local printf | $(pwd) $(pwd) $(pwd) ${HOME} "$1" export done
+test test sed ${HOME} test 'quoted text'
+--verbose export grep export
+${HOME} cd awk x=1 /usr/bin cd cd /usr/bin $(pwd)
+	/usr/bin && "$1" 2>/dev/null 'quoted text' sed
+		&& printf then --verbose readonly "$@"
+"$@" && ${HOME} printf $(pwd) && readonly echo awk x=1 grep
+		/usr/bin ${HOME} cd echo 2>/dev/null sed 'quoted text' local echo grep --verbose
+		$(pwd) ${HOME} then x=1 /usr/bin -eu "$1" echo
+		2>/dev/null /usr/bin local && readonly
+		"$@" then export sed /usr/bin "$1" then awk ${HOME}
+	-eu "$@" test done local echo "$1" export done 'quoted text'
+-eu sed 'quoted text' cd 'quoted text' | local x=1 grep 2>/dev/null local
+		| printf "$1" "$1" && test 'quoted text' echo $(pwd) "$1" cd /usr/bin
+		--verbose && awk x=1 -eu sed && -eu ${HOME} "$@" -eu ${HOME}
+"$@" ${HOME} ${HOME} export printf
+		-eu -eu readonly "$@" readonly 'quoted text'
+	-eu printf test done then 'quoted text' 2>/dev/null ${HOME}
+		--verbose ${HOME} 2>/dev/null ${HOME} printf awk printf "$1" awk done $(pwd)
+	readonly 2>/dev/null echo 2>/dev/null test ${HOME} "$1" -eu "$1" grep sed | readonly
+--verbose sed local && ${HOME}
+		awk $(pwd) 2>/dev/null sed readonly 'quoted text' readonly readonly
+	${HOME} export test /usr/bin readonly "$1" $(pwd) && echo
+	test --verbose 2>/dev/null && test then
+		--verbose sed "$@" "$1" && readonly export x=1 grep readonly
+		| echo readonly x=1 done | readonly x=1 echo readonly test "$@" printf x=1
+		"$1" cd then awk /usr/bin done readonly sed test $(pwd) "$@" "$1" sed
+	'quoted text' ${HOME} $(pwd) test
+		x=1 "$1" sed printf local export grep export $(pwd) --verbose
+	awk grep "$1" echo 2>/dev/null test "$1" -eu done | export /usr/bin
+	"$1" then printf then --verbose
+	'quoted text' | cd readonly test grep export sed then readonly
+	x=1 test grep 2>/dev/null --verbose
+	awk ${HOME} cd "$1" grep test done readonly cd $(pwd) sed local "$@" local awk
+	cd | local awk readonly test echo test "$1" /usr/bin local
+	--verbose && echo && done x=1
+	readonly then 2>/dev/null grep "$1"
+	test then --verbose 2>/dev/null export | readonly test -eu 2>/dev/null
+cd grep sed "$1" grep done -eu --verbose 'quoted text' | "$1" "$@"
+	printf 2>/dev/null "$1" | 'quoted text'
+printf && sed 2>/dev/null echo -eu echo 2>/dev/null
+	'quoted text' test done echo test -eu grep
+	printf 'quoted text' test sed -eu local awk test printf 2>/dev/null $(pwd)
+	| "$1" test readonly sed readonly awk && test x=1 export ${HOME}
+&& && && --verbose test
+		-eu | awk 'quoted text' local grep "$@" export export $(pwd) 2>/dev/null ${HOME}
+	grep then local 'quoted text' "$1" /usr/bin grep -eu 2>/dev/null ${HOME} $(pwd)
+&& grep -eu && printf then --verbose export --verbose awk then local
+$(pwd) echo | "$1" && export
+"$@" -eu "$1" ${HOME} cd
+	printf done awk ${HOME} sed test
+${HOME} $(pwd) echo cd x=1 awk "$1" ${HOME} 2>/dev/null
+x=1 sed cd echo then printf | 2>/dev/null "$@" test readonly && echo && sed
+	$(pwd) test export /usr/bin $(pwd) | awk echo then export --verbose
+		x=1 cd cd readonly "$@" "$1" cd --verbose test "$1" done
+	/usr/bin "$@" "$1" cd local --verbose cd sed echo readonly
+--verbose local /usr/bin grep echo "$@" 2>/dev/null local |
+	--verbose grep /usr/bin 'quoted text' sed && --verbose local readonly sed
+		'quoted text' local test test cd x=1 ${HOME} -eu -eu | printf | "$1"
+		then | /usr/bin grep ${HOME} x=1 sed "$@"
+	&& test local readonly
+| --verbose local local ${HOME} awk 2>/dev/null
+		export x=1 done awk then printf /usr/bin then awk test /usr/bin
+	cd -eu readonly test test echo printf local done -eu x=1 echo then
+		sed "$@" && local export ${HOME} ${HOME} x=1 test -eu local printf 'quoted text'
+&& ${HOME} grep /usr/bin cd ${HOME} | && export local --verbose "$1"
+sed && cd echo printf -eu 2>/dev/null $(pwd) "$@" done
+	echo local x=1 $(pwd) echo grep -eu export done done readonly /usr/bin $(pwd)
+	grep $(pwd) -eu x=1 export readonly
+	sed printf export 'quoted text' "$1" local
+		"$1" $(pwd) ${HOME} export readonly
+$(pwd) x=1 "$@" && "$1" grep 2>/dev/null
+	&& test 'quoted text' awk then sed export
+	&& awk readonly /usr/bin "$@" "$1"
+	export local x=1 test sed
+		printf | "$@" | test "$@"
+readonly x=1 | grep && /usr/bin --verbose x=1 2>/dev/null /usr/bin printf $(pwd)
+$(pwd) then printf /usr/bin
+export --verbose -eu $(pwd) "$@" "$@" --verbose
+'quoted text' ${HOME} printf | awk $(pwd)
+		"$@" done cd grep echo $(pwd) x=1 ${HOME} /usr/bin x=1 --verbose
+${HOME} "$1" export then --verbose x=1 --verbose sed sed | x=1 cd local && readonly
+then $(pwd) --verbose test echo 2>/dev/null --verbose local --verbose x=1 -eu
+	done printf printf grep test | $(pwd)
+"$@" local export readonly export ${HOME}
+	printf "$1" readonly 'quoted text' awk done "$1" ${HOME}
+awk readonly test $(pwd) ${HOME} echo /usr/bin printf
+cd ${HOME} 'quoted text' -eu awk sed
+		done ${HOME} readonly readonly readonly
+sed /usr/bin $(pwd) /usr/bin done grep then echo then | local test --verbose done
+	2>/dev/null awk echo printf
+printf cd printf | cd "$1" 'quoted text' --verbose x=1 $(pwd) printf 2>/dev/null
+		&& awk cd sed readonly local /usr/bin "$@" | grep -eu test
+	$(pwd) echo "$1" $(pwd) /usr/bin sed sed readonly then 'quoted text'
+		done local sed /usr/bin done "$@" export echo /usr/bin &&
+echo $(pwd) "$@" --verbose export awk "$@" readonly
+	--verbose 'quoted text' &&
+then readonly cd export -eu "$@" sed "$@" grep /usr/bin sed
+	local "$@" | /usr/bin readonly 'quoted text'
+-eu grep | 'quoted text' ${HOME} export --verbose /usr/bin "$1" /usr/bin
+	-eu sed 2>/dev/null local "$@" && && && | cd cd /usr/bin done ${HOME} echo
+	sed x=1 grep /usr/bin export grep export awk cd awk "$1" cd 2>/dev/null
+echo -eu "$1" 'quoted text' x=1 | cd printf 2>/dev/null x=1 'quoted text'
+${HOME} grep x=1 -eu $(pwd) done printf echo export
+	echo test ${HOME} && ${HOME}
+| 'quoted text' export /usr/bin
+		"$1" then 2>/dev/null printf "$1" awk /usr/bin
+grep --verbose cd done x=1 'quoted text' "$1" && done &&
+'quoted text' export awk x=1
+		awk ${HOME} readonly /usr/bin then printf --verbose x=1 export awk export
+		&& -eu && then "$1" /usr/bin echo sed grep && then 2>/dev/null
+	printf done printf cd 'quoted text' $(pwd) $(pwd) grep /usr/bin then x=1 readonly
+	"$@" then /usr/bin local -eu sed test 2>/dev/null
+local awk "$@" $(pwd) "$1" 2>/dev/null --verbose
+"$@" ${HOME} printf echo ${HOME} 'quoted text' 2>/dev/null echo x=1 "$@" x=1
+$(pwd) cd | then --verbose "$@" | 2>/dev/null
+		${HOME} /usr/bin cd x=1 2>/dev/null
+		echo awk x=1 printf printf echo x=1 local cd then done | --verbose
+--verbose export grep cd echo "$@" x=1
+	done then echo then local /usr/bin /usr/bin
+		2>/dev/null ${HOME} echo --verbose -eu echo -eu "$1" echo grep 'quoted text' /usr/bin
+	$(pwd) export sed x=1 /usr/bin
+		export then x=1 sed "$1" "$@" awk local then "$@" local readonly
+x=1 printf sed "$@" printf -eu 2>/dev/null "$@"
+export sed export $(pwd) export && export test done 'quoted text' --verbose
+	awk grep 2>/dev/null cd cd export grep echo 2>/dev/null echo |
+		echo sed /usr/bin --verbose "$1" ${HOME}
+readonly grep --verbose /usr/bin -eu test done awk local
+	done ${HOME} cd $(pwd) 2>/dev/null
+	printf done awk && | 2>/dev/null
+	-eu sed local --verbose --verbose x=1 "$@" export "$@" test 'quoted text'
+		done cd grep export local && "$@"
+	x=1 'quoted text' 2>/dev/null
+sed echo --verbose test echo
+${HOME} sed ${HOME} "$@" printf cd local 2>/dev/null
+	&& grep | awk grep 2>/dev/null
+	done cd awk then "$1" cd x=1 "$@" "$@" local -eu cd done "$@"
+	readonly --verbose /usr/bin x=1 'quoted text' export
+$(pwd) "$@" x=1 $(pwd)
+		"$1" $(pwd) done grep && grep export echo readonly
+printf ${HOME} -eu awk
+		| 2>/dev/null test grep 'quoted text'
+		&& export then && $(pwd) readonly 2>/dev/null 2>/dev/null
+		$(pwd) "$@" awk ${HOME}
+		test test -eu x=1 x=1 export grep then readonly then readonly printf
+	2>/dev/null ${HOME} --verbose | local 'quoted text'
+	cd | x=1 $(pwd) readonly "$1" cd sed export awk then
+export readonly sed && "$@" ${HOME} 2>/dev/null && sed
+		2>/dev/null --verbose export $(pwd) -eu printf done local ${HOME} test then readonly
+"$@" local "$1" awk "$@"
+x=1 then sed x=1 | cd awk --verbose 2>/dev/null && x=1 x=1
+		&& --verbose -eu then printf
+	done /usr/bin awk | done /usr/bin /usr/bin then | -eu awk awk echo
+		${HOME} echo test export local grep /usr/bin "$1" 2>/dev/null printf $(pwd)
+	2>/dev/null sed export done
+	$(pwd) | 'quoted text' && 2>/dev/null 'quoted text' ${HOME} export printf
+	&& ${HOME} local -eu "$1"
+printf 2>/dev/null && $(pwd) test
+	-eu then ${HOME} "$1" awk echo local done awk readonly 'quoted text' "$@" test
+		done grep then awk "$@" x=1 awk
+-eu && sed --verbose grep printf | test printf 2>/dev/null -eu readonly
@@ -0,0 +1,2001 @@
+	export $(pwd) local 2>/dev/null $(pwd) local sed "$@" sed ${HOME} "$1" done ${HOME}
+	cd grep echo /usr/bin && --verbose cd x=1 -eu $(pwd) 2>/dev/null
+$(pwd) cd /usr/bin "$@" 2>/dev/null x=1 -eu "$@" && | awk readonly
+	"$@" 'quoted text' printf then local awk printf cd local
+		$(pwd) grep -eu -eu then
+	awk ${HOME} export done | 2>/dev/null export x=1 'quoted text'
+printf x=1 echo "$1" echo /usr/bin sed /usr/bin $(pwd) echo ${HOME} /usr/bin
+&& ${HOME} x=1 | "$1" "$@" readonly test printf echo awk -eu | test
+awk 'quoted text' && | -eu sed -eu $(pwd) awk export 'quoted text' export grep
+readonly /usr/bin /usr/bin 2>/dev/null then echo sed test /usr/bin && "$@" export
+cd done sed sed 2>/dev/null done test local export 2>/dev/null
+	local ${HOME} local && x=1 x=1 'quoted text' "$1"
+		grep done then /usr/bin 'quoted text' echo printf cd awk printf echo "$@" |
+		export && /usr/bin -eu -eu
+		readonly "$1" echo then 2>/dev/null 'quoted text' cd printf
+${HOME} 'quoted text'
+	local --verbose printf && readonly ${HOME} test x=1 -eu -eu
+printf awk x=1 -eu export local | $(pwd) && sed "$@" "$@" /usr/bin
+	echo --verbose $(pwd) "$1"
+/usr/bin -eu grep "$1" /usr/bin &&
+	printf -eu then awk $(pwd) readonly
+/usr/bin && sed printf && --verbose ${HOME} printf
+done | printf printf -eu --verbose printf local echo
+&& 2>/dev/null -eu && | | x=1 'quoted text' -eu $(pwd) -eu 2>/dev/null
+printf 2>/dev/null then --verbose
+&& "$1" $(pwd) /usr/bin "$@" $(pwd) -eu x=1 2>/dev/null 'quoted text' printf 'quoted text'
+| ${HOME} export then $(pwd) done awk grep $(pwd) echo then
+		'quoted text' export --verbose local
+	&& readonly "$1" echo awk x=1 | local export ${HOME} "$1" done done 'quoted text'
+	test done then 'quoted text' done awk 'quoted text'
+		export ${HOME} 'quoted text' $(pwd) -eu export sed && sed printf
+	printf printf | | ${HOME} 'quoted text' && then /usr/bin
+'quoted text' export /usr/bin ${HOME} export $(pwd) grep $(pwd) "$@" echo export
+export printf ${HOME} then
+	cd $(pwd) $(pwd) sed cd test grep
+		grep "$@" echo done awk sed /usr/bin
+		grep $(pwd) ${HOME} export test --verbose
+	'quoted text' $(pwd) 'quoted text' | ${HOME} export ${HOME} sed grep awk
+	x=1 awk printf readonly --verbose awk | | local done -eu /usr/bin grep test
+		| test /usr/bin 'quoted text' 'quoted text'
+	export then /usr/bin
+	&& awk test 'quoted text'
+		done -eu -eu cd local | 2>/dev/null 2>/dev/null
+"$1" sed /usr/bin test | readonly
+	--verbose && sed grep $(pwd) "$1"
+		$(pwd) local "$@" test -eu /usr/bin /usr/bin done x=1
+	local sed awk local /usr/bin echo && local grep /usr/bin awk 'quoted text' echo
+	awk sed local ${HOME} echo grep grep 'quoted text' x=1 2>/dev/null
+2>/dev/null "$@" echo echo -eu grep test "$1" 'quoted text'
+	sed x=1 done ${HOME} then echo 'quoted text'
+/usr/bin 2>/dev/null && && cd && && "$@"
+	sed local export -eu ${HOME} echo && | grep awk awk awk
+	$(pwd) done ${HOME} readonly ${HOME} 2>/dev/null /usr/bin "$1" --verbose local
+	2>/dev/null done "$@" local echo 2>/dev/null --verbose
+	cd awk 2>/dev/null "$@" "$1" ${HOME}
+cd -eu ${HOME} && echo printf sed printf -eu 2>/dev/null | | 2>/dev/null
+	x=1 test local && $(pwd) -eu printf test ${HOME} "$@" --verbose
+	${HOME} 2>/dev/null awk x=1 grep readonly export x=1 echo | $(pwd)
+	&& cd printf printf -eu /usr/bin local readonly 'quoted text'
+		printf printf local readonly awk && "$1" --verbose test readonly
+		$(pwd) then --verbose | then "$@" export done sed ${HOME} 'quoted text'
+		| "$@" "$1" && export ${HOME} "$1" x=1 grep 'quoted text'
+| /usr/bin export echo -eu ${HOME} cd sed done echo then && --verbose "$1" ${HOME}
+		readonly echo then "$1" echo then --verbose sed -eu awk -eu 'quoted text' test
+--verbose grep export sed test $(pwd) /usr/bin /usr/bin
+	| readonly awk && $(pwd) $(pwd) local 2>/dev/null
+	awk x=1 then -eu $(pwd) "$1" "$1" &&
+		done printf grep 'quoted text' echo x=1
+	printf "$@" && awk 2>/dev/null echo "$1" grep then
+		local -eu echo local /usr/bin $(pwd) --verbose ${HOME} x=1 cd done && awk test
+${HOME} /usr/bin 'quoted text'
+| then then "$@" x=1 -eu && then local readonly cd local test 'quoted text'
+| echo grep done -eu "$1"
+		"$1" echo local export "$@" cd x=1 x=1 2>/dev/null ${HOME} readonly
+	| 2>/dev/null 2>/dev/null ${HOME} awk /usr/bin test "$@" awk sed "$1"
+		--verbose /usr/bin ${HOME} x=1 printf cd done grep x=1 ${HOME}
+		$(pwd) cd "$@" echo local grep | $(pwd) then $(pwd)
+		&& echo export "$@" ${HOME} export done 2>/dev/null readonly -eu /usr/bin test test
+		$(pwd) then ${HOME} done x=1 printf | ${HOME} "$1"
+	-eu && grep $(pwd) "$1" sed | "$@" "$@" "$@" ${HOME} awk echo "$@" | then "$1"
+		grep then then echo && x=1 export 'quoted text' local grep "$1" /usr/bin &&
+readonly grep --verbose | echo --verbose export local --verbose && local "$1" x=1
+	/usr/bin /usr/bin readonly x=1 export
+		${HOME} export && 'quoted text' /usr/bin "$@" export 2>/dev/null cd | readonly
+	| sed sed "$@" 'quoted text'
+	2>/dev/null sed readonly
+		awk --verbose readonly $(pwd) 'quoted text'
+readonly then "$1" -eu echo
+${HOME} "$@" ${HOME} done -eu -eu /usr/bin /usr/bin && &&
+readonly test ${HOME} local echo 'quoted text' --verbose sed awk awk | printf
+local done "$1" export
+		export x=1 -eu printf
+	done printf 'quoted text' "$1" -eu
+&& $(pwd) done local then ${HOME}
+		grep test ${HOME} x=1 test echo $(pwd) sed -eu 'quoted text' echo done | echo "$@"
+		awk 2>/dev/null x=1 local readonly grep grep 'quoted text'
+		${HOME} done /usr/bin then local "$@" --verbose done && export sed
+	awk sed 2>/dev/null local ${HOME}
+	printf 'quoted text' /usr/bin
+		'quoted text' | --verbose printf 'quoted text' awk
+done readonly cd "$@" grep --verbose
+		grep readonly sed echo cd readonly awk && 2>/dev/null export /usr/bin
+	cd 2>/dev/null "$@" local local "$@" && export | echo
+		printf cd "$@" | grep done readonly
+		--verbose printf echo done /usr/bin done readonly "$1"
+		${HOME} cd readonly "$1" printf "$1" "$1" test sed sed
+		then ${HOME} "$1" sed sed local
+		then 'quoted text' grep test && sed grep 'quoted text'
+	sed 2>/dev/null "$1" /usr/bin export $(pwd) cd -eu 'quoted text'
+		| awk cd $(pwd) readonly 'quoted text' done --verbose done local awk 2>/dev/null
+		awk --verbose 2>/dev/null "$@" $(pwd)
+	local then "$@" x=1 /usr/bin
+sed $(pwd) $(pwd) sed done "$@" grep
+	${HOME} printf 'quoted text' x=1 2>/dev/null done
+		"$1" sed printf cd /usr/bin /usr/bin $(pwd) readonly "$@" "$1" done
+	sed local awk ${HOME} test && --verbose "$1" "$1" --verbose then test | awk 'quoted text'
+test readonly "$1" sed $(pwd) local
+2>/dev/null echo -eu 2>/dev/null
+	-eu export /usr/bin ${HOME} export sed -eu /usr/bin 'quoted text'
+"$@" ${HOME} export echo "$1" ${HOME} x=1 grep export $(pwd) && -eu then
+	-eu "$1" export local printf
+${HOME} test local sed | readonly done local $(pwd) | ${HOME} awk awk then awk "$1"
+	readonly cd echo echo ${HOME} | 2>/dev/null then echo ${HOME}
+		--verbose awk x=1 x=1 2>/dev/null readonly awk local &&
+	--verbose && sed "$1" "$1" | $(pwd) then grep $(pwd) printf cd
+		x=1 /usr/bin export 'quoted text' $(pwd) cd test && ${HOME} done
+		readonly echo --verbose "$1" --verbose --verbose local readonly
+	done 'quoted text' "$1" "$@" then awk 'quoted text' awk | printf
+"$@" /usr/bin grep export echo
+		done --verbose "$@" 'quoted text' "$1"
+	/usr/bin "$1" | sed done | cd "$1" sed ${HOME}
+		export awk local sed /usr/bin sed ${HOME}
+	--verbose printf -eu /usr/bin done done
+	-eu echo "$@" done export readonly | /usr/bin grep test "$1" --verbose
+	x=1 sed --verbose x=1 2>/dev/null
+	local x=1 grep done -eu
+	/usr/bin readonly awk $(pwd)
+	echo x=1 sed cd readonly readonly
+${HOME} awk "$1" test | && then grep --verbose --verbose grep 2>/dev/null &&
+	printf grep $(pwd) x=1
+x=1 done local --verbose $(pwd) export
+/usr/bin "$@" "$1" "$@" 2>/dev/null grep $(pwd) ${HOME}
+	--verbose && awk local
+	local test printf export x=1 export /usr/bin sed
+cd && x=1 | local cd 2>/dev/null ${HOME} done "$@" local cd /usr/bin && echo
+		x=1 -eu "$1" done && readonly cd local -eu ${HOME} done export local
+"$@" "$1" ${HOME} done readonly
+		$(pwd) test then printf then printf sed readonly | echo done export done
+	| 'quoted text' sed | cd test /usr/bin
+		${HOME} test awk test | "$@" sed "$@" | grep $(pwd) readonly /usr/bin grep
+&& echo then $(pwd) && ${HOME} readonly echo $(pwd) 'quoted text'
+	test ${HOME} sed awk x=1 export test
+${HOME} cd && --verbose 'quoted text'
+'quoted text' | cd printf export
+		x=1 local $(pwd) "$1" test | $(pwd) echo printf -eu $(pwd) export echo local
+grep $(pwd) | --verbose done $(pwd) awk $(pwd) x=1 --verbose readonly 'quoted text'
+"$1" local 'quoted text' done --verbose $(pwd) 2>/dev/null local export sed
+		local 'quoted text' | -eu readonly 'quoted text'
+	echo sed && && ${HOME} export test | "$1"
+	export && | local echo /usr/bin 'quoted text' --verbose --verbose sed -eu
+		"$1" ${HOME} 'quoted text' /usr/bin
+-eu local printf grep x=1 x=1 -eu test /usr/bin echo x=1 export awk
+${HOME} test test -eu awk x=1 "$@" grep export local "$@"
+echo sed awk sed -eu export
+		cd /usr/bin export x=1 grep then 'quoted text'
+--verbose grep && | $(pwd)
+		grep echo $(pwd) "$1" | && "$1"
+		--verbose 2>/dev/null local echo -eu "$1" then echo
+		"$@" awk -eu -eu "$1" 'quoted text'
+		2>/dev/null x=1 ${HOME} /usr/bin --verbose awk -eu -eu
+		x=1 readonly readonly -eu /usr/bin $(pwd)
+	grep printf echo "$1" local local
+&& cd | sed | 2>/dev/null awk awk readonly
+cd "$@" export test "$@" /usr/bin --verbose
+		sed awk /usr/bin test | then readonly | awk then export
+		then | && readonly sed then /usr/bin ${HOME} ${HOME} cd done /usr/bin
+	local 'quoted text' -eu local echo
+		'quoted text' then local echo cd done printf /usr/bin $(pwd) cd test
+	echo "$1" | export cd -eu printf 2>/dev/null
+		export $(pwd) 2>/dev/null 2>/dev/null
+	'quoted text' 'quoted text' grep 'quoted text' | 2>/dev/null grep
+	"$@" 2>/dev/null /usr/bin export
+		readonly export awk 'quoted text' grep "$1" done "$1" /usr/bin 2>/dev/null "$@"
+test local readonly $(pwd) 2>/dev/null
+	-eu sed done readonly x=1 "$1" cd cd local /usr/bin
+"$@" printf test grep grep x=1 | ${HOME} ${HOME} then test "$@" sed cd 'quoted text'
+		sed done grep ${HOME} readonly done -eu test local
+test | $(pwd) ${HOME} /usr/bin $(pwd) printf grep $(pwd) sed -eu "$@"
+	grep x=1 printf echo grep printf 2>/dev/null
+printf "$1" 2>/dev/null "$1" export |
+		export awk export echo && done --verbose test x=1 then printf grep done -eu |
+2>/dev/null && $(pwd) "$@" 'quoted text' echo export
+	$(pwd) "$@" ${HOME} --verbose test --verbose
+grep grep --verbose done ${HOME} test awk | 'quoted text'
+done export done x=1 test && | cd "$1" -eu && grep /usr/bin
+2>/dev/null test "$@" awk ${HOME} readonly export echo readonly local | test echo
+	&& -eu ${HOME} "$@" printf /usr/bin && readonly
+-eu then 2>/dev/null "$1" local "$1" then
+		sed sed "$@" done x=1 && then x=1 done | done
+	grep /usr/bin && | && done 2>/dev/null -eu
+		then grep printf sed /usr/bin export "$1"
+then echo && && --verbose
+x=1 awk test x=1 sed | then x=1 grep echo
+	$(pwd) cd --verbose | cd ${HOME} 'quoted text' export
+	sed | /usr/bin export -eu then sed x=1 test 2>/dev/null 'quoted text' echo ${HOME}
+	/usr/bin -eu 2>/dev/null printf "$@"
+	/usr/bin grep 2>/dev/null cd export --verbose | test x=1 && echo readonly /usr/bin
+		"$1" "$@" echo -eu --verbose
+		export $(pwd) echo "$1"
+	&& cd "$1" local 'quoted text' test grep test done /usr/bin grep x=1 && &&
+		--verbose test export --verbose cd "$1" ${HOME} x=1 'quoted text'
+		x=1 /usr/bin done /usr/bin echo $(pwd) && grep "$@" && printf "$1"
+2>/dev/null local readonly "$1" then export test then test export -eu
+	| test sed then echo ${HOME} 2>/dev/null -eu awk "$@" x=1
+	-eu export ${HOME} awk awk done "$@" done local
+		x=1 2>/dev/null | "$@" export -eu local awk
+/usr/bin local -eu then test sed "$1"
+sed /usr/bin awk "$1" printf && test /usr/bin awk -eu printf cd printf
+		"$1" && --verbose printf --verbose echo grep readonly grep grep 'quoted text'
+	-eu awk export x=1 | awk ${HOME} ${HOME} export done done
+test printf 'quoted text' 'quoted text' ${HOME} -eu /usr/bin x=1 export 2>/dev/null
+	"$1" sed readonly readonly /usr/bin awk 'quoted text' "$@" --verbose sed --verbose
+	x=1 "$1" local sed $(pwd)
+then readonly "$1" then cd /usr/bin ${HOME} sed awk $(pwd) sed export /usr/bin
+		$(pwd) then test readonly sed echo --verbose local 'quoted text'
+awk echo | cd printf printf "$1" 'quoted text'
+test printf "$@" test "$1" printf | | readonly
+cd done | -eu "$@" && printf 'quoted text' cd echo | readonly
+readonly --verbose "$@" $(pwd) ${HOME} | cd "$@" grep done sed
+	$(pwd) -eu --verbose done awk
+2>/dev/null export "$1" grep x=1 && readonly
+	"$1" --verbose cd test --verbose
+		--verbose grep cd $(pwd) export 2>/dev/null local
+	readonly ${HOME} 'quoted text' "$1" $(pwd) sed -eu printf | grep
+-eu "$1" export awk export export awk test printf --verbose
+	echo readonly echo && $(pwd) x=1 sed local && "$@"
+		cd sed readonly local printf cd
+sed /usr/bin local --verbose local echo x=1 | 2>/dev/null
+	${HOME} --verbose done x=1 x=1 test grep $(pwd) awk printf 'quoted text'
+	x=1 awk grep && export readonly
+	-eu ${HOME} x=1 ${HOME} cd
+		echo sed | local done then awk then 'quoted text'
+done ${HOME} local /usr/bin | cd echo sed -eu --verbose
+x=1 'quoted text' then --verbose then | "$1" x=1 awk --verbose x=1 "$@" readonly
+then "$@" "$@" 'quoted text'
+	printf done $(pwd) $(pwd) cd echo awk --verbose awk cd test printf 2>/dev/null
+	done echo cd echo /usr/bin readonly "$1" 2>/dev/null
+		done echo && --verbose
+	"$1" | && | grep echo && local x=1 --verbose ${HOME}
+then cd -eu "$@" printf grep | $(pwd) sed awk && local local printf echo test
+	&& | printf -eu 2>/dev/null "$@" /usr/bin --verbose local printf
+		readonly test --verbose done -eu
+	awk "$@" then export export
+	grep "$@" | && cd 'quoted text' export x=1
+"$1" -eu 2>/dev/null ${HOME} 'quoted text' readonly
+	$(pwd) --verbose | test --verbose export && 2>/dev/null
+		2>/dev/null local 'quoted text' 'quoted text'
+		'quoted text' echo local "$@" then done echo echo test cd
+--verbose | 'quoted text' 'quoted text'
+	sed && /usr/bin printf then x=1 done x=1 'quoted text' grep echo 'quoted text'
+"$1" sed export 2>/dev/null done then 2>/dev/null export readonly | readonly echo
+-eu test -eu -eu local echo awk done readonly $(pwd) grep x=1 cd printf 2>/dev/null
+	test "$1" | "$@" test printf x=1 'quoted text' sed sed -eu -eu "$@"
+		$(pwd) test 2>/dev/null $(pwd) readonly printf
+	&& "$@" test "$1" done then $(pwd) readonly
+"$@" then echo "$@" | echo ${HOME}
+	cd sed "$1" 'quoted text' --verbose --verbose
+/usr/bin printf -eu then ${HOME} sed readonly grep "$1" readonly
+	readonly /usr/bin --verbose | grep | --verbose --verbose $(pwd)
+		readonly -eu awk done x=1 export /usr/bin then x=1 ${HOME}
+		grep /usr/bin $(pwd) /usr/bin
+		&& readonly ${HOME} export cd cd sed "$@" "$1"
+echo 'quoted text' "$@" readonly test then done then ${HOME} /usr/bin then
+then done cd | then 2>/dev/null x=1 local $(pwd)
+		--verbose | done -eu 'quoted text'
+	"$@" awk -eu printf cd export sed "$@" test printf then ${HOME}
+		echo $(pwd) "$1" "$1"
+		local awk awk test /usr/bin --verbose printf --verbose
+	-eu done done then ${HOME}
+x=1 awk --verbose then echo printf && sed grep --verbose awk "$@"
+x=1 readonly local then | awk test ${HOME} export echo export
+"$1" done 2>/dev/null grep done echo cd --verbose /usr/bin "$@" /usr/bin $(pwd)
+x=1 done -eu then 'quoted text' test "$@" printf x=1 | && -eu local /usr/bin
+| | grep test readonly -eu | grep done export done sed
+sed printf local echo "$1"
+--verbose printf export ${HOME} 'quoted text'
+awk --verbose then 2>/dev/null --verbose awk export
+		&& printf awk grep 2>/dev/null
+"$@" awk /usr/bin x=1 $(pwd)
+	&& "$@" export /usr/bin "$1" sed printf export export printf 'quoted text'
+		done "$@" printf readonly -eu export
+grep x=1 $(pwd) test 2>/dev/null export "$1" done test test "$@" echo
+local export | | | && --verbose local printf awk readonly && ${HOME} ${HOME}
+then readonly --verbose local export awk export | /usr/bin && awk
+echo 2>/dev/null | "$@" ${HOME} "$@" /usr/bin readonly cd grep x=1 local
+		x=1 grep && $(pwd) $(pwd) export readonly 'quoted text' 2>/dev/null
+		$(pwd) ${HOME} grep -eu "$@" awk local then export echo local
+		grep sed "$1" /usr/bin && echo 'quoted text'
+done /usr/bin -eu "$1" then awk "$@" cd readonly /usr/bin -eu
+		local test 2>/dev/null test local x=1 sed grep readonly | printf grep test "$1"
+		/usr/bin $(pwd) done printf ${HOME} cd test "$1" echo "$1" "$1"
+	-eu cd grep then 'quoted text' cd local ${HOME}
+done x=1 "$@" awk $(pwd) x=1 | --verbose $(pwd)
+		x=1 awk sed export echo /usr/bin
+		cd -eu -eu x=1 printf 'quoted text' local export -eu done && sed $(pwd) | 2>/dev/null
+"$@" 'quoted text' "$@" x=1 printf echo done | export
+sed echo cd 2>/dev/null then cd readonly cd | x=1
+$(pwd) echo 'quoted text' | $(pwd) $(pwd)
+	&& /usr/bin 'quoted text' "$1" 2>/dev/null
+	-eu -eu /usr/bin local ${HOME} export --verbose echo done --verbose 'quoted text'
+cd cd grep done grep 2>/dev/null readonly 2>/dev/null
+		"$1" 2>/dev/null cd -eu ${HOME} readonly
+"$1" "$@" local sed awk && done -eu "$1" local printf 2>/dev/null echo ${HOME}
+		/usr/bin x=1 --verbose && "$@" cd "$@" test export export grep x=1 done
+sed "$@" then "$1" cd /usr/bin echo printf awk local sed awk
+test "$@" "$@" cd $(pwd) echo $(pwd)
+	$(pwd) then 'quoted text' x=1 "$1" then sed readonly sed 2>/dev/null
+	test | --verbose && "$@" "$@"
+	-eu grep grep "$1" export echo grep then 'quoted text' export done
+	grep | -eu ${HOME} done "$1" /usr/bin awk printf $(pwd) readonly && "$@" cd
+x=1 /usr/bin 2>/dev/null printf | "$1" test printf awk cd readonly then && ${HOME}
+	grep readonly "$@" 2>/dev/null
+		readonly "$@" test readonly grep awk sed -eu awk grep cd awk awk grep
+		echo cd ${HOME} test 'quoted text'
+-eu awk readonly done done -eu "$@" ${HOME} cd
+		--verbose /usr/bin 2>/dev/null grep then local
+		awk grep local echo --verbose 2>/dev/null sed /usr/bin $(pwd) export
+printf echo "$1" /usr/bin && printf $(pwd) local
+	done "$1" printf "$1" 2>/dev/null printf "$@" --verbose "$@" done ${HOME} 2>/dev/null
+	"$1" grep cd /usr/bin test local
+done 2>/dev/null | -eu sed awk
+x=1 --verbose "$1" | local readonly "$1" /usr/bin --verbose 'quoted text' sed
+		done then local "$@" local
+test local | test && 'quoted text' 2>/dev/null --verbose
+readonly 'quoted text' && local --verbose "$@" x=1 done sed
+		cd sed $(pwd) ${HOME} done awk 2>/dev/null then grep x=1 then $(pwd)
+		--verbose sed /usr/bin -eu test 'quoted text'
+		sed 2>/dev/null x=1 sed 2>/dev/null --verbose 'quoted text'
+		"$@" --verbose && readonly 2>/dev/null printf
+x=1 local --verbose grep
+		--verbose /usr/bin 2>/dev/null 2>/dev/null
+	&& test | cd ${HOME} x=1 -eu done sed export "$@" test "$1" then
+	2>/dev/null "$1" sed local export -eu readonly
+export grep -eu && 'quoted text' "$@" test then
+done --verbose sed "$1" /usr/bin sed awk local done
+then ${HOME} printf $(pwd) awk test ${HOME} | 'quoted text'
+| echo printf 2>/dev/null
+echo 'quoted text' "$1" "$1" awk
+		test export | done cd then x=1 sed $(pwd) sed -eu echo grep "$@" export
+		export -eu && printf ${HOME}
+		"$1" 'quoted text' test printf
+	-eu done --verbose 'quoted text' done 2>/dev/null /usr/bin
+		${HOME} cd 2>/dev/null grep
+done local x=1 "$@" cd 'quoted text'
+		then 'quoted text' --verbose 2>/dev/null printf ${HOME} /usr/bin
+		cd local $(pwd) "$1" printf echo x=1 grep local
+		then --verbose readonly /usr/bin sed 'quoted text'
+	readonly "$@" sed grep grep
+	awk grep ${HOME} printf done export 'quoted text'
+	grep $(pwd) awk -eu sed test | awk -eu $(pwd) --verbose then ${HOME} echo --verbose
+	then sed test echo $(pwd) printf local 'quoted text' readonly --verbose
+		"$1" $(pwd) 2>/dev/null "$@" | | | local -eu
+done "$@" then | ${HOME}
+	sed -eu 'quoted text' 'quoted text'
+	&& 2>/dev/null echo $(pwd) "$1" local 2>/dev/null
+		| --verbose /usr/bin /usr/bin 2>/dev/null 'quoted text' "$@" --verbose
+	then && sed echo local -eu
+	${HOME} 'quoted text' test -eu && | x=1
+$(pwd) printf --verbose then x=1 awk "$@" x=1 local printf sed grep && x=1
+		test | "$@" ${HOME} export readonly printf echo export "$1" done
+		-eu /usr/bin grep 2>/dev/null done printf readonly -eu awk $(pwd) /usr/bin
+x=1 cd export $(pwd) && $(pwd) export done | /usr/bin printf awk readonly
+	sed then export done printf | test /usr/bin x=1 then local printf "$1" echo ${HOME}
+export ${HOME} && 2>/dev/null cd 'quoted text' test
+		local | && awk readonly readonly export "$1" sed local
+'quoted text' /usr/bin then "$1" test 2>/dev/null sed then grep
+	&& then echo sed cd readonly /usr/bin "$1" awk ${HOME} grep /usr/bin
+	then test /usr/bin /usr/bin x=1 done export done export && grep local cd
+x=1 /usr/bin cd 'quoted text' done sed echo readonly -eu
+	printf 2>/dev/null $(pwd) export "$@" ${HOME} 'quoted text' cd awk cd test
+		test echo -eu local && $(pwd) 'quoted text'
+cd sed done $(pwd) --verbose 'quoted text'
+/usr/bin x=1 2>/dev/null grep -eu awk
+export export /usr/bin awk | export printf && -eu
+	-eu awk grep $(pwd) done "$@" $(pwd) done then export 'quoted text'
+printf echo 'quoted text' ${HOME} done done echo --verbose echo export test "$@"
+		sed "$@" done echo && local
+test printf local cd "$@" printf 2>/dev/null $(pwd) "$@" "$@" "$@" grep "$@" local
+	done 'quoted text' local printf
+	/usr/bin awk --verbose --verbose /usr/bin && ${HOME} "$1" then /usr/bin
+	export "$@" 2>/dev/null then x=1 cd && -eu then "$1" grep printf
+	--verbose "$1" done awk local "$1"
+| x=1 awk test grep /usr/bin readonly grep then --verbose "$1" -eu awk --verbose
+export printf 'quoted text' --verbose ${HOME} readonly cd 'quoted text' grep printf
+		/usr/bin awk -eu 2>/dev/null ${HOME}
+${HOME} --verbose | then -eu ${HOME} /usr/bin then --verbose -eu x=1 $(pwd)
+&& 2>/dev/null 2>/dev/null cd -eu "$1"
+cd $(pwd) 'quoted text' "$@" 'quoted text'
+"$1" && --verbose x=1 echo
+readonly 2>/dev/null "$@"
+	cd readonly 2>/dev/null -eu grep $(pwd) | "$1" ${HOME}
+	"$1" local test done x=1 "$@" 2>/dev/null readonly sed done export
+x=1 test --verbose done then ${HOME} x=1 awk awk | local /usr/bin
+		--verbose awk done "$@" && "$@" "$1" test $(pwd) 'quoted text' | test
+	grep grep --verbose | ${HOME} grep printf && export /usr/bin
+		sed && done && cd printf
+2>/dev/null "$@" ${HOME}
+done printf awk $(pwd) echo -eu sed && test grep 'quoted text' echo "$@"
+--verbose cd /usr/bin done $(pwd) awk readonly &&
+		readonly cd echo then | --verbose awk then $(pwd) 'quoted text' local x=1 then
+done export test export 'quoted text' awk | sed 2>/dev/null 'quoted text'
+export local && printf "$1" echo
+		${HOME} -eu sed | grep grep | /usr/bin echo echo
+		$(pwd) $(pwd) cd awk $(pwd) 2>/dev/null cd cd echo
+	2>/dev/null test awk $(pwd) /usr/bin export -eu
+	x=1 export grep -eu "$@" | then 2>/dev/null 'quoted text' export && printf
+	export $(pwd) --verbose then printf 'quoted text' test done $(pwd)
+${HOME} ${HOME} echo done cd --verbose
+		-eu test 'quoted text' /usr/bin then $(pwd) 2>/dev/null "$@" $(pwd)
+	done 2>/dev/null then done test local
+		printf --verbose && /usr/bin -eu readonly grep cd then export /usr/bin
+export x=1 grep grep export local && sed | export echo && /usr/bin grep
+| done then x=1 grep export x=1 'quoted text'
+	test $(pwd) "$1" printf 2>/dev/null awk sed 2>/dev/null --verbose
+		2>/dev/null && && ${HOME} 'quoted text' --verbose
+awk 'quoted text' 'quoted text' x=1 $(pwd) cd $(pwd) then echo $(pwd)
+done | "$@" ${HOME} x=1 readonly "$@" "$1" --verbose
+		$(pwd) 'quoted text' done
+$(pwd) echo sed sed "$1" echo local
+		then && cd "$1" -eu export x=1 awk $(pwd) ${HOME} awk sed 2>/dev/null sed
+	2>/dev/null test --verbose x=1 then then | "$1" then sed then cd then
+&& ${HOME} "$1" grep readonly
+	--verbose "$1" 2>/dev/null
+	awk awk && 2>/dev/null -eu
+		"$1" 'quoted text' x=1 /usr/bin x=1 ${HOME} awk readonly --verbose
+		x=1 --verbose | then | 2>/dev/null | export echo echo then local "$@" 'quoted text'
+	${HOME} printf -eu then
+		'quoted text' && then --verbose
+	/usr/bin --verbose 'quoted text'
+		awk | "$1" awk grep local "$@" export ${HOME} then --verbose done local
+	local /usr/bin grep --verbose done -eu test
+| --verbose 2>/dev/null --verbose
+	echo readonly "$1" sed printf grep done done grep 'quoted text' /usr/bin
+		--verbose then "$@" cd then "$@" /usr/bin
+x=1 test /usr/bin /usr/bin /usr/bin "$@" printf 2>/dev/null ${HOME}
+	echo ${HOME} then "$@" && -eu sed
+		$(pwd) "$1" 'quoted text' local grep ${HOME} echo readonly then then echo awk
+--verbose /usr/bin awk echo then cd printf
+		cd local test local -eu && export && echo "$@" -eu x=1 local 'quoted text'
+	-eu local /usr/bin local x=1 then -eu 2>/dev/null cd printf
+	2>/dev/null sed printf test ${HOME} cd echo
+-eu awk --verbose ${HOME} x=1 $(pwd) "$@" ${HOME} local printf --verbose
+-eu -eu /usr/bin "$@" local
+		${HOME} cd x=1 done $(pwd) 'quoted text' test test ${HOME} --verbose
+cd && readonly "$@" done "$1" 2>/dev/null "$1"
+	local printf awk "$1" ${HOME} sed printf 'quoted text' $(pwd)
+	readonly $(pwd) echo /usr/bin cd /usr/bin && sed $(pwd) "$@"
+		awk test "$1" 2>/dev/null && export done echo |
+export "$@" awk /usr/bin && sed readonly --verbose /usr/bin -eu
+$(pwd) && sed -eu -eu cd readonly "$1" -eu ${HOME}
+		2>/dev/null && sed x=1 --verbose | $(pwd) $(pwd)
+		| -eu local --verbose printf | cd export && readonly
+	then sed test --verbose printf test "$@" echo printf export printf -eu test "$1"
+		printf /usr/bin sed then export test local awk sed 2>/dev/null then local
+		local printf x=1 cd /usr/bin printf | | echo test readonly printf readonly
+&& then sed cd 2>/dev/null 'quoted text' |
+local awk sed then x=1 ${HOME} && readonly printf printf && 2>/dev/null
+	x=1 done --verbose then && |
+		done && cd $(pwd) 2>/dev/null test test x=1 x=1 'quoted text' cd ${HOME}
+done --verbose cd grep printf printf "$1"
+	/usr/bin 2>/dev/null /usr/bin echo grep printf --verbose --verbose
+	readonly -eu then awk cd sed test /usr/bin "$@" then
+$(pwd) cd "$@" local ${HOME} 2>/dev/null 2>/dev/null
+done 'quoted text' sed readonly grep 2>/dev/null local x=1 local done
+--verbose sed echo cd awk 'quoted text'
+		export | grep export x=1 "$@" test | 2>/dev/null sed printf
+		export --verbose then test echo | $(pwd) echo readonly test test sed | $(pwd)
+	grep 'quoted text' test echo $(pwd) x=1 "$1"
+echo cd cd 2>/dev/null -eu && ${HOME} $(pwd) done test export ${HOME} ${HOME}
+		grep -eu 2>/dev/null --verbose /usr/bin done /usr/bin 'quoted text' grep
+		2>/dev/null echo test ${HOME} ${HOME} ${HOME} printf 2>/dev/null
+	${HOME} --verbose export printf cd cd "$@" readonly then 'quoted text'
+		2>/dev/null local 'quoted text' /usr/bin
+	printf done readonly test "$1" test 2>/dev/null "$@" $(pwd) ${HOME}
+echo printf grep --verbose "$1" 2>/dev/null
+awk -eu test $(pwd) -eu 'quoted text' 'quoted text' sed cd test cd $(pwd) "$@"
+		readonly ${HOME} --verbose grep && then && && then --verbose 2>/dev/null
+		-eu awk test printf /usr/bin "$@" ${HOME} cd cd
+	| 2>/dev/null "$1" -eu 'quoted text'
+		&& awk grep grep -eu grep local x=1 "$@" grep /usr/bin cd -eu awk
+		local 'quoted text' | readonly
+	x=1 | /usr/bin "$@" -eu $(pwd) 'quoted text' awk echo echo
+		${HOME} cd --verbose $(pwd) then
+		${HOME} awk && cd grep ${HOME}
+		readonly && "$1" cd -eu /usr/bin "$@" then readonly test && grep --verbose ${HOME}
+		2>/dev/null "$@" echo | awk readonly 2>/dev/null
+	x=1 ${HOME} 2>/dev/null $(pwd) && /usr/bin && /usr/bin "$@" 2>/dev/null
+	/usr/bin echo x=1 awk
+-eu -eu | /usr/bin export cd $(pwd) $(pwd)
+		done then x=1 then sed done
+	readonly $(pwd) -eu | echo echo
+	--verbose export "$@" -eu | x=1 printf /usr/bin grep --verbose test awk readonly
+"$@" | 'quoted text' && x=1 'quoted text'
+		cd --verbose then test 'quoted text' local awk && echo /usr/bin $(pwd) awk cd
+	done /usr/bin cd 2>/dev/null cd then $(pwd) sed | x=1 test && then local
+printf sed ${HOME} test | done "$@" printf
+then export test --verbose 2>/dev/null ${HOME} "$@" local
+	$(pwd) && && x=1 export then /usr/bin grep 'quoted text' /usr/bin sed | ${HOME}
+		| cd x=1 "$1" echo done sed && test done sed && "$1" | 2>/dev/null --verbose |
+		local 'quoted text' export test export -eu /usr/bin
+		2>/dev/null export "$1" printf --verbose 2>/dev/null sed sed -eu sed test -eu
+	echo --verbose local -eu x=1 then | then export local
+		/usr/bin done echo awk
+	--verbose x=1 test grep awk grep /usr/bin test && test awk /usr/bin
+	done echo --verbose grep local 2>/dev/null
+	sed $(pwd) test | readonly then $(pwd) -eu echo 'quoted text'
+2>/dev/null echo awk done readonly 'quoted text'
+printf readonly | export ${HOME} echo readonly then x=1 readonly 2>/dev/null
+| -eu 'quoted text' awk done awk "$1" ${HOME} grep
+	readonly export 2>/dev/null then $(pwd) readonly "$@" /usr/bin 'quoted text'
+		grep sed $(pwd) ${HOME} x=1 $(pwd) && -eu test | then -eu 'quoted text' test 'quoted text'
+		then ${HOME} export readonly awk echo grep sed "$@" | test "$1" /usr/bin
+		printf cd -eu "$@" x=1 awk readonly readonly "$1" "$1" x=1
+grep echo cd 2>/dev/null sed /usr/bin local ${HOME} && &&
+	readonly x=1 then test then test printf grep | cd /usr/bin
+	--verbose local x=1 --verbose 2>/dev/null 2>/dev/null 2>/dev/null /usr/bin && grep
+	| readonly $(pwd) "$@" awk sed /usr/bin test test cd /usr/bin
+sed readonly && x=1 /usr/bin | --verbose sed
+	x=1 awk test grep done x=1 test && /usr/bin "$@" awk sed -eu then
+		sed awk /usr/bin awk /usr/bin local 'quoted text' "$1" test cd cd sed local
+"$1" --verbose 2>/dev/null readonly
+		--verbose $(pwd) -eu /usr/bin local
+x=1 done grep x=1 then done local export && --verbose
+sed --verbose 2>/dev/null 2>/dev/null ${HOME}
+		export done | /usr/bin awk sed $(pwd) -eu 'quoted text'
+"$@" awk then test 'quoted text' echo x=1 sed ${HOME} echo printf
+		sed 2>/dev/null done test --verbose readonly
+cd export done | grep "$1" x=1 "$@" then "$1" done --verbose local "$@" -eu sed
+	${HOME} && then "$@" 'quoted text' export
+	printf && "$@" export grep
+		| 'quoted text' then cd local ${HOME}
+		"$1" readonly echo --verbose | /usr/bin | &&
+		"$1" printf -eu 'quoted text'
+		readonly --verbose $(pwd) $(pwd) cd && echo cd "$@" && cd printf $(pwd) echo
+'quoted text' readonly echo 'quoted text'
+	| sed readonly 2>/dev/null --verbose
+&& then printf export then sed x=1 "$@" readonly | local grep local 2>/dev/null
+		/usr/bin "$1" --verbose
+		grep cd local 2>/dev/null x=1 test echo readonly $(pwd) sed | local
+cd done local && test | 'quoted text' printf | "$1" --verbose 2>/dev/null
+	readonly local 2>/dev/null awk 'quoted text' --verbose
+		printf $(pwd) $(pwd) | export export grep x=1 cd readonly x=1 awk readonly
+	--verbose grep done "$1" then readonly printf export ${HOME}
+		done done x=1 "$@" $(pwd) "$1" $(pwd)
+&& cd -eu sed "$@" cd export 2>/dev/null && $(pwd) ${HOME}
+--verbose test awk local --verbose x=1 awk 2>/dev/null
+		x=1 local /usr/bin ${HOME} done
+		2>/dev/null ${HOME} $(pwd) /usr/bin /usr/bin sed "$@" /usr/bin
+		test && ${HOME} 2>/dev/null
+	then cd local readonly awk 'quoted text' "$1" then &&
+	x=1 printf 'quoted text' /usr/bin 'quoted text'
+		printf then local grep --verbose
+		awk /usr/bin && "$1" | /usr/bin
+	test /usr/bin awk $(pwd) printf "$1" cd --verbose x=1 && -eu "$@"
+		done export grep awk --verbose ${HOME} then sed x=1 done
+$(pwd) export | 2>/dev/null cd "$@" export --verbose /usr/bin
+		/usr/bin x=1 2>/dev/null "$@" export
+--verbose $(pwd) printf local -eu x=1 readonly echo grep export then /usr/bin
+		then export x=1 sed x=1 readonly ${HOME} /usr/bin "$1" && 'quoted text' sed
+&& echo cd readonly "$@" "$@" 2>/dev/null 'quoted text' sed --verbose
+		cd echo 'quoted text' echo local "$@" done 'quoted text'
+then awk "$1" printf sed readonly 'quoted text'
+		awk then grep 2>/dev/null readonly 'quoted text' grep && -eu export grep
+grep sed sed | cd -eu awk --verbose sed test awk "$1" done x=1
+2>/dev/null $(pwd) $(pwd) then -eu "$@" test
+	"$@" printf readonly echo readonly
+x=1 awk x=1 --verbose cd done local readonly echo export test
+${HOME} grep printf test && awk x=1 sed $(pwd) export "$@" sed sed echo
+		"$@" | cd -eu x=1 x=1 --verbose "$1"
+sed local "$1" echo "$@" ${HOME} -eu cd "$@" $(pwd) test printf printf
+cd awk x=1 awk && readonly printf "$@" | 2>/dev/null sed $(pwd)
+	${HOME} readonly cd then --verbose
+local -eu awk -eu /usr/bin /usr/bin
+		&& -eu | test 'quoted text' 'quoted text' x=1 'quoted text' grep export test export
+$(pwd) | x=1 readonly grep /usr/bin ${HOME} awk then
+x=1 readonly "$@" "$1" && grep then export x=1 awk cd
+local done readonly printf awk 'quoted text' "$1" x=1 readonly && -eu $(pwd)
+	-eu printf 2>/dev/null grep && sed | 'quoted text' cd cd x=1 local grep cd
+--verbose then ${HOME} cd done sed "$@" "$1" ${HOME} --verbose
+printf printf "$@" x=1 export &&
+		printf && | 2>/dev/null 2>/dev/null ${HOME} sed then
+	then then | "$@" grep $(pwd) done export /usr/bin awk ${HOME}
+		sed sed echo grep export export test 'quoted text' awk x=1 cd
+echo sed done | "$1" 2>/dev/null ${HOME} echo ${HOME}
+2>/dev/null $(pwd) "$@" readonly "$1" grep printf |
+"$1" 2>/dev/null local printf --verbose done test awk readonly readonly
+		cd && && --verbose /usr/bin export "$@" --verbose "$1" done | --verbose 2>/dev/null
+	&& 2>/dev/null awk export done local local grep done
+test printf export /usr/bin 2>/dev/null -eu --verbose export then cd 2>/dev/null
+	readonly local done grep done
+		2>/dev/null /usr/bin done export 'quoted text' sed x=1 && test /usr/bin
+		then ${HOME} x=1 test cd test then done readonly $(pwd) done
+		"$1" test $(pwd) readonly 2>/dev/null done
+	"$1" then readonly printf && $(pwd) x=1 awk sed -eu $(pwd)
+	&& grep echo test "$@" local echo sed /usr/bin printf && awk 'quoted text'
+	printf done readonly test export /usr/bin
+		test /usr/bin /usr/bin grep then | 2>/dev/null -eu then readonly
+	cd echo 2>/dev/null test -eu then then "$@" | $(pwd) x=1 export
+	2>/dev/null echo echo | printf done "$1" &&
+awk export printf "$1" echo done $(pwd)
+	${HOME} 'quoted text' -eu local awk readonly && test | --verbose
+		sed local x=1 cd awk awk "$1" awk printf printf local && 2>/dev/null && 'quoted text'
+| sed done && grep readonly
+	then 'quoted text' test --verbose "$1" --verbose awk -eu
+2>/dev/null "$@" readonly "$1" 'quoted text' test "$1" grep /usr/bin
+	'quoted text' export then --verbose && $(pwd) printf
+| export cd export readonly 'quoted text' $(pwd) | "$@" "$@" readonly 2>/dev/null
+echo echo export awk $(pwd) echo readonly sed grep awk && && done echo awk
+	sed local done && cd x=1 export
+		2>/dev/null cd test then export local local
+		local /usr/bin "$1" "$1" | | sed test $(pwd) ${HOME} sed --verbose
+sed | 2>/dev/null -eu x=1 sed local --verbose printf $(pwd) echo | "$@"
+		test --verbose x=1 $(pwd) "$@" readonly --verbose
+grep export | 'quoted text' printf echo local 'quoted text'
+	sed local 2>/dev/null grep "$1" local -eu
+		2>/dev/null cd /usr/bin
+	--verbose export | 'quoted text'
+		x=1 test printf 'quoted text' done awk
+	'quoted text' /usr/bin local printf --verbose cd printf printf "$1" 'quoted text'
+readonly echo 'quoted text' awk --verbose readonly sed then
+x=1 readonly /usr/bin echo --verbose 2>/dev/null
+	cd 2>/dev/null done $(pwd) grep test "$1" 2>/dev/null 'quoted text' echo
+	$(pwd) export printf --verbose
+		test | cd readonly then readonly 2>/dev/null
+	-eu 2>/dev/null awk grep "$@" then awk 'quoted text' done 'quoted text' test cd
+done test grep then "$1" then
+		x=1 awk ${HOME} then awk ${HOME} done -eu x=1 echo
+	"$1" /usr/bin echo sed
+awk /usr/bin cd "$@" local -eu echo ${HOME} "$1" echo ${HOME}
+	&& local 'quoted text' && done sed echo /usr/bin readonly 'quoted text' && "$@"
+	then readonly local sed sed "$1" done && /usr/bin echo export "$1" done export
+		export then echo "$1" grep sed export 2>/dev/null
+'quoted text' local grep ${HOME} && && && 'quoted text' $(pwd) 2>/dev/null /usr/bin
+test grep 'quoted text' awk awk grep then test printf --verbose
+	test done awk local --verbose echo awk | $(pwd) awk | "$1" ${HOME} cd echo readonly
+	"$@" awk x=1 && -eu 'quoted text' local -eu printf sed x=1
+awk sed echo echo grep
+	readonly cd awk 2>/dev/null | "$1" done then done then local ${HOME}
+printf ${HOME} x=1 && && |
+echo readonly && echo test -eu then && "$@" printf readonly echo local then done
+--verbose -eu done --verbose $(pwd) local && cd 2>/dev/null grep grep
+		export readonly echo echo done sed awk
+		'quoted text' 'quoted text' cd /usr/bin
+	&& export 'quoted text' 2>/dev/null cd 'quoted text' x=1 && readonly local local
+	2>/dev/null /usr/bin "$@" echo $(pwd) export
+$(pwd) 2>/dev/null --verbose awk then echo --verbose awk "$1" --verbose echo
+		export echo x=1 /usr/bin
+"$1" ${HOME} /usr/bin done grep x=1 /usr/bin done then then
+		${HOME} 'quoted text' 'quoted text' then --verbose sed |
+readonly "$@" 2>/dev/null grep x=1 echo test /usr/bin 'quoted text' ${HOME}
+then | "$1" export test sed 2>/dev/null done --verbose && echo 2>/dev/null
+	| grep "$@" ${HOME} "$@" 2>/dev/null sed printf --verbose
+test x=1 "$@" echo printf awk /usr/bin --verbose awk awk done awk "$1" printf awk
+	-eu cd "$1" 'quoted text' done
+	then "$@" 'quoted text' awk x=1 --verbose
+done awk awk export --verbose local ${HOME} -eu cd sed 'quoted text'
+		echo -eu "$@" done x=1 --verbose awk | "$1" | ${HOME} 'quoted text'
+$(pwd) /usr/bin -eu local 'quoted text' export export printf echo printf
+cd sed $(pwd) -eu "$@" && "$@" awk export grep
+export grep -eu -eu "$@"
+-eu "$@" x=1 2>/dev/null then 2>/dev/null --verbose sed echo /usr/bin readonly "$@"
+	"$@" then local x=1 grep /usr/bin $(pwd) 2>/dev/null x=1 readonly grep
+	/usr/bin done $(pwd) local x=1 2>/dev/null
+test grep 'quoted text' then awk then ${HOME}
+		awk test 'quoted text'
+"$1" then then sed local x=1 echo "$1" --verbose done
+sed export awk $(pwd) then "$1" readonly && grep | 2>/dev/null
+	then "$@" | "$@" && 'quoted text' readonly && &&
+	awk "$@" 2>/dev/null /usr/bin "$@" sed test echo "$1" /usr/bin
+		cd awk echo printf printf 2>/dev/null 'quoted text' export x=1 test cd && grep
+grep -eu ${HOME} $(pwd) 2>/dev/null
+	done --verbose awk $(pwd) 'quoted text'
+| ${HOME} sed test readonly sed "$@" | -eu
+printf $(pwd) local echo $(pwd) 'quoted text' 2>/dev/null ${HOME} printf
+		local grep 'quoted text' local then
+		local awk --verbose /usr/bin local sed test
+'quoted text' then readonly x=1 /usr/bin --verbose ${HOME} "$1" /usr/bin
+		cd && sed ${HOME} 2>/dev/null "$@" x=1 printf local /usr/bin && 2>/dev/null
+	&& | 'quoted text' awk /usr/bin --verbose echo ${HOME} | | awk "$@" local export
+	then /usr/bin && grep "$1" cd echo sed && ${HOME} printf awk --verbose
+-eu x=1 done printf test cd grep sed echo grep echo "$1" export ${HOME} && 'quoted text'
+done "$@" x=1 then ${HOME}
+	echo readonly "$@" grep && x=1 done --verbose
+	&& printf && printf echo echo ${HOME} grep && cd 'quoted text'
+		then | export readonly --verbose then export "$1" echo 2>/dev/null
+then ${HOME} export readonly sed done
+	/usr/bin 2>/dev/null $(pwd) awk then
+		| awk cd printf printf printf | && $(pwd) done 'quoted text' local local test
+		export echo 2>/dev/null 'quoted text' "$@" sed --verbose local then
+	x=1 /usr/bin test done "$1" $(pwd) "$1" grep export awk then awk readonly
+		printf local local "$@"
+		done -eu done awk awk 'quoted text' grep /usr/bin "$@"
+		sed printf "$@" && then $(pwd) "$@" readonly cd test --verbose grep local $(pwd)
+		then readonly done sed echo
+then ${HOME} "$1" local printf --verbose -eu test -eu ${HOME} done -eu $(pwd)
+		"$@" 'quoted text' --verbose echo
+"$1" export 2>/dev/null local --verbose 2>/dev/null then "$1" 2>/dev/null
+cd export /usr/bin && 2>/dev/null grep --verbose grep | "$1" printf --verbose
+		export cd "$@" then done awk -eu test local awk grep 2>/dev/null
+	2>/dev/null export -eu "$1" export x=1
+		cd "$@" /usr/bin /usr/bin cd "$@"
+	local local && /usr/bin "$@" --verbose -eu done awk -eu
+	readonly "$1" echo readonly test cd |
+		| done /usr/bin && "$1" "$@" export sed 'quoted text' grep "$@" && cd awk ${HOME}
+'quoted text' sed "$1" echo
+test 'quoted text' then done ${HOME} done ${HOME} 2>/dev/null
+	-eu 'quoted text' /usr/bin then export sed "$@" readonly awk 'quoted text'
+		awk "$@" readonly && test x=1 /usr/bin sed echo /usr/bin
+	'quoted text' 2>/dev/null local 2>/dev/null grep sed /usr/bin readonly
+	readonly export "$1"
+cd $(pwd) readonly echo && then readonly test done --verbose x=1
+echo grep cd | && readonly readonly "$1" --verbose
+		then test sed test "$1" -eu
+	then && test export && test -eu done && -eu
+		| export ${HOME} cd "$@" cd $(pwd) export x=1 x=1 then sed $(pwd) 'quoted text'
+$(pwd) --verbose test
+2>/dev/null test --verbose local /usr/bin then x=1 done 2>/dev/null
+	done test grep -eu "$1" 2>/dev/null local export "$1" "$1" 2>/dev/null readonly
+		cd -eu -eu --verbose local
+-eu printf 'quoted text' echo readonly && --verbose awk cd then | printf
+	echo --verbose 'quoted text' local /usr/bin --verbose
+	| 'quoted text' then grep x=1 awk test then then echo readonly "$1" printf
+	-eu awk local "$@" export grep sed readonly grep local /usr/bin export
+$(pwd) "$@" -eu 'quoted text' -eu x=1 export local 'quoted text'
+	grep ${HOME} 2>/dev/null printf readonly "$1" /usr/bin
+cd test cd "$@" awk ${HOME} 'quoted text' then -eu && 'quoted text' 'quoted text'
+	sed cd --verbose export awk --verbose 'quoted text' printf
+		$(pwd) | ${HOME} && then "$@" local ${HOME} awk grep
+"$1" cd awk grep $(pwd) "$@"
+--verbose echo && grep local "$@" echo 'quoted text' done local test sed
+2>/dev/null ${HOME} test x=1 && readonly sed
+export export local sed then
+	| | $(pwd) "$1" $(pwd) done echo
+test then x=1 printf export ${HOME} && ${HOME} echo
+	-eu then local printf sed done done ${HOME} $(pwd)
+x=1 printf then printf | 2>/dev/null 'quoted text'
+	$(pwd) printf cd printf sed ${HOME} readonly sed /usr/bin
+		--verbose 'quoted text' grep
+	then x=1 "$@" ${HOME} "$@" grep then readonly done | export done export x=1 export
+		"$1" "$@" then --verbose && "$1" sed echo /usr/bin -eu test &&
+	$(pwd) cd then echo printf then cd ${HOME} awk test "$1" awk
+printf then | test 2>/dev/null
+		"$@" local export done cd 2>/dev/null local --verbose test 'quoted text'
+	awk echo local done | && $(pwd)
+sed -eu echo "$1" readonly 'quoted text'
+		${HOME} grep | $(pwd) echo awk printf $(pwd) awk export
+2>/dev/null cd export test x=1 export ${HOME} ${HOME} awk
+	| printf cd 'quoted text' echo test test then test
+	-eu "$1" printf x=1 $(pwd) local "$@" local /usr/bin awk sed printf
+printf then && "$@" | | done "$1" 2>/dev/null && ${HOME} cd x=1 echo printf
+		--verbose test ${HOME} printf "$@" test test -eu then
+		x=1 awk 2>/dev/null | x=1 "$1" readonly
+		| test printf done cd printf
+/usr/bin ${HOME} "$1" awk export && 'quoted text' -eu
+		| test grep done done then echo sed x=1 test "$@" cd cd cd echo export "$1"
+	test | test "$1" --verbose && 'quoted text' $(pwd)
+test 2>/dev/null export grep test "$1" -eu -eu
+		"$@" then done printf echo
+export ${HOME} done local | local test sed "$@" awk export ${HOME} local
+		-eu -eu -eu local test export
+		&& x=1 export echo local cd -eu test 'quoted text' 2>/dev/null
+"$1" 2>/dev/null test x=1 && /usr/bin && -eu done "$@" 2>/dev/null 2>/dev/null
+	| done awk export export "$1" 'quoted text'
+then echo $(pwd) && 2>/dev/null && local $(pwd) "$1" $(pwd) readonly "$@"
+	readonly cd done grep x=1 cd 'quoted text' "$@" x=1 local "$1" 'quoted text'
+		then export done cd readonly --verbose test ${HOME} echo
+		--verbose printf awk sed 'quoted text' then -eu 2>/dev/null
+	x=1 && "$@" test "$1" ${HOME} cd local "$1" export done grep | --verbose printf
+	&& x=1 ${HOME} export local ${HOME} cd -eu 'quoted text' echo grep $(pwd) done readonly
+	test echo $(pwd) then then awk done echo
+done | sed readonly |
+		2>/dev/null | grep $(pwd)
+	awk export done local sed echo awk done echo echo export
+	| /usr/bin 2>/dev/null | ${HOME} $(pwd) local
+--verbose "$1" printf
+	| echo local "$1" then grep | grep
+	x=1 sed cd | /usr/bin done printf echo sed && awk
+	export test readonly x=1 export cd readonly "$1" test | --verbose
+test $(pwd) 2>/dev/null readonly
+		grep && ${HOME} "$1" -eu done ${HOME} /usr/bin then x=1 cd 'quoted text'
+		local --verbose --verbose $(pwd) "$@" --verbose
+	done readonly sed "$@" $(pwd) grep cd && 2>/dev/null | echo
+		local 2>/dev/null test "$@" "$@" awk --verbose then "$@" 2>/dev/null 2>/dev/null
+	--verbose x=1 echo $(pwd) sed "$1" test -eu local
+		sed "$1" $(pwd) grep $(pwd) --verbose readonly
+	export $(pwd) test | ${HOME} ${HOME} x=1 "$@"
+	done --verbose 2>/dev/null $(pwd) | cd test 2>/dev/null readonly "$1"
+| "$1" awk readonly export 2>/dev/null "$@" printf
+	'quoted text' /usr/bin
+	done awk test echo --verbose
+	sed readonly awk $(pwd)
+		/usr/bin -eu 2>/dev/null then -eu then
+	2>/dev/null done grep local export
+	'quoted text' "$1" 2>/dev/null | /usr/bin 2>/dev/null
+		--verbose --verbose | ${HOME} echo cd test sed "$1" echo --verbose sed | "$@"
+		awk readonly 'quoted text'
+	sed sed test ${HOME} "$1" sed sed -eu && $(pwd)
+grep echo | then "$1" echo export
+		readonly /usr/bin /usr/bin local test | awk "$@" sed -eu "$@" done "$1"
+		done -eu ${HOME} 2>/dev/null x=1 --verbose
+${HOME} local 2>/dev/null readonly "$@" sed test 2>/dev/null sed cd readonly
+$(pwd) 'quoted text' --verbose 2>/dev/null cd cd local
+		&& local grep --verbose 2>/dev/null
+-eu test "$1" ${HOME} export done
+	then echo done readonly 2>/dev/null echo awk cd 2>/dev/null 'quoted text'
+	&& readonly test echo "$@" then awk 'quoted text' "$1" readonly --verbose -eu
+readonly local sed test
+	readonly sed then "$1" printf then
+		| $(pwd) "$@" export readonly $(pwd) done | done grep | awk printf export
+readonly echo /usr/bin $(pwd) readonly awk awk ${HOME} readonly
+	test sed test echo 2>/dev/null
+then && /usr/bin "$1"
+&& printf test $(pwd) grep echo test cd /usr/bin
+	test cd --verbose /usr/bin
+-eu 2>/dev/null 2>/dev/null printf awk then "$1" && sed readonly
+awk export && readonly sed -eu export -eu grep printf "$1" export
+		$(pwd) grep test -eu test export ${HOME} test then readonly
+		"$@" $(pwd) test x=1
+	cd awk grep $(pwd) readonly -eu /usr/bin printf local sed
+	cd "$1" readonly 'quoted text' sed local
+	&& then 'quoted text' "$1" awk printf "$1" -eu done
+| 2>/dev/null local then printf sed done export printf test x=1 ${HOME} awk /usr/bin
+--verbose $(pwd) "$@" echo local && printf 'quoted text' local -eu &&
+	printf test && -eu 'quoted text' sed printf
+		"$1" -eu done printf sed "$@"
+		local --verbose --verbose test | grep export
+		done -eu then "$@" readonly --verbose "$@" cd -eu export -eu ${HOME} readonly
+	cd -eu then -eu test && then "$@" --verbose /usr/bin
+	grep --verbose sed local ${HOME} done "$@" test local
+		printf | export | 'quoted text' /usr/bin
+"$1" export test awk printf
+echo sed "$1" ${HOME} sed | echo awk echo grep echo "$1"
+done && 'quoted text' test then "$1" echo $(pwd) done readonly
+		readonly grep local 'quoted text' -eu -eu /usr/bin export grep "$1" &&
+sed && echo ${HOME} 2>/dev/null
+echo x=1 | awk printf $(pwd) awk -eu $(pwd) 'quoted text'
+	sed $(pwd) --verbose /usr/bin local sed done && | "$1" "$1" grep $(pwd) printf
+| echo $(pwd) local --verbose cd test --verbose
+printf --verbose 'quoted text'
+	done echo -eu export readonly test "$1" /usr/bin done
+	$(pwd) && then 2>/dev/null ${HOME} x=1 local ${HOME} done $(pwd) test -eu echo
+		/usr/bin ${HOME} | "$1" readonly && cd /usr/bin -eu "$@" ${HOME} $(pwd)
+	then test grep done 'quoted text' 'quoted text' echo /usr/bin $(pwd)
+		/usr/bin | 'quoted text' "$1" --verbose && done export
+test done $(pwd) "$@" printf done "$@" done "$1" --verbose
+	echo ${HOME} "$1" | test -eu readonly && 2>/dev/null echo "$1" then
+	readonly "$@" 'quoted text' $(pwd) printf /usr/bin then
+	2>/dev/null $(pwd) then test readonly grep -eu /usr/bin && grep then
+export printf then test /usr/bin x=1 export "$1" x=1 $(pwd) "$1" ${HOME} /usr/bin
+		sed grep "$1" --verbose awk echo export readonly done readonly cd sed /usr/bin
+		"$1" "$@" ${HOME} /usr/bin 2>/dev/null /usr/bin ${HOME} then export | done "$1"
+	$(pwd) export "$@" echo 'quoted text' | 2>/dev/null | 'quoted text' printf echo
+		done -eu x=1 x=1 printf x=1 2>/dev/null "$1"
+	awk cd | x=1 awk cd 2>/dev/null --verbose -eu -eu x=1 "$1" ${HOME} && export local
+	'quoted text' 2>/dev/null
+		/usr/bin ${HOME} /usr/bin /usr/bin local "$1" done local awk then awk $(pwd)
+'quoted text' export 'quoted text'
+	'quoted text' x=1 --verbose | &&
+	2>/dev/null then "$@" --verbose ${HOME} && "$1" -eu "$1" export 2>/dev/null then
+cd cd printf /usr/bin readonly awk -eu $(pwd) test
+then test done --verbose ${HOME} local test echo 'quoted text' readonly x=1 export
+		| done 'quoted text' cd ${HOME}
+	"$1" test && echo test -eu done cd --verbose echo test --verbose 2>/dev/null
+	echo cd 'quoted text' grep test echo x=1 /usr/bin readonly
+&& readonly 'quoted text' -eu "$@" done printf done --verbose 2>/dev/null
+/usr/bin /usr/bin sed --verbose
+		echo -eu local && printf | "$1" sed grep export
+awk --verbose sed /usr/bin 2>/dev/null
+		local ${HOME} cd printf --verbose 'quoted text' -eu |
+		grep grep -eu "$@" && echo && /usr/bin && awk 'quoted text' /usr/bin |
+		grep sed test sed grep &&
+	--verbose --verbose printf done x=1 readonly local sed local $(pwd) | test sed |
+cd 'quoted text' $(pwd) 'quoted text' | sed | | 'quoted text' grep sed -eu local
+	sed | x=1 "$@" -eu 2>/dev/null
+		printf grep sed test local /usr/bin $(pwd)
+test 2>/dev/null --verbose "$1" test awk "$@" cd grep ${HOME} readonly test
+		test ${HOME} cd 2>/dev/null awk then local export
+		x=1 2>/dev/null && readonly --verbose "$1" awk ${HOME} -eu readonly
+	test test then grep --verbose sed grep test -eu test readonly
+		cd sed --verbose echo $(pwd)
+-eu "$@" cd local "$@" readonly local grep
+&& ${HOME} && 'quoted text' ${HOME} x=1 /usr/bin awk | x=1 --verbose test done
+	readonly cd 'quoted text' local
+then echo awk $(pwd) awk done grep 'quoted text'
+'quoted text' grep cd /usr/bin --verbose
+then && -eu awk 2>/dev/null local printf awk
+2>/dev/null -eu export 'quoted text' --verbose "$@" done | x=1 "$@"
+grep 2>/dev/null -eu awk 2>/dev/null awk grep ${HOME}
+$(pwd) export -eu sed
+	/usr/bin 2>/dev/null local $(pwd) 2>/dev/null export cd "$@"
+"$1" -eu x=1 cd --verbose grep grep 2>/dev/null done export ${HOME} /usr/bin
+	/usr/bin "$1" awk sed local 'quoted text'
+		'quoted text' "$@" x=1 local
+		test local "$1" && grep then -eu printf && export printf |
+done done grep "$1" awk test
+	local "$1" /usr/bin printf
+&& sed /usr/bin "$@" "$@" export done done ${HOME} done cd local
+/usr/bin ${HOME} -eu printf 'quoted text' /usr/bin "$@" cd x=1 done echo echo then
+	sed awk done x=1 --verbose sed -eu local
+sed done test export $(pwd) sed printf
+local test "$1" --verbose ${HOME} && local
+		then printf 2>/dev/null "$1" done && ${HOME} /usr/bin --verbose printf
+test done readonly awk -eu done /usr/bin "$1" 2>/dev/null local printf
+local done ${HOME} --verbose export 'quoted text'
+	test $(pwd) test | | echo --verbose sed
+		/usr/bin --verbose test sed -eu /usr/bin
+${HOME} 2>/dev/null "$1" test
+export x=1 awk awk && grep "$@"
+	test sed done then export test readonly 'quoted text' && cd echo $(pwd) export
+local --verbose awk /usr/bin "$1" done test x=1 grep && cd
+		test 2>/dev/null readonly $(pwd) then /usr/bin cd sed readonly | 'quoted text'
+	echo test 'quoted text' sed | echo cd cd
+	'quoted text' awk grep export /usr/bin | printf readonly 2>/dev/null
+		done x=1 then test && ${HOME} grep x=1 grep x=1 /usr/bin
+awk printf x=1 ${HOME} local x=1 local 2>/dev/null
+		x=1 test sed | "$@" $(pwd) | done "$1" test export
+		sed x=1 test export 2>/dev/null 'quoted text' export 2>/dev/null
+		printf $(pwd) awk sed -eu $(pwd)
+	&& printf && cd 'quoted text' "$1" then echo test 'quoted text'
+	"$1" "$1" then export -eu $(pwd) /usr/bin 'quoted text'
+	echo done readonly test x=1 x=1 &&
+printf local | | test printf export sed && "$1" done -eu x=1 then "$1"
+	test readonly && test echo ${HOME}
+	cd ${HOME} 2>/dev/null sed echo readonly sed local export ${HOME} | ${HOME}
+		${HOME} /usr/bin "$@" -eu printf $(pwd) "$@" grep
+		'quoted text' done --verbose "$1" grep done test x=1 test grep && ${HOME} grep
+		$(pwd) sed cd ${HOME} -eu awk grep $(pwd) sed test done $(pwd) cd done 2>/dev/null
+		/usr/bin echo test "$1" /usr/bin grep printf $(pwd)
+2>/dev/null $(pwd) --verbose -eu local ${HOME} 2>/dev/null
+	--verbose ${HOME} test && |
+		cd -eu then && --verbose printf | /usr/bin
+		then then 2>/dev/null then readonly test then 2>/dev/null /usr/bin printf
+cd /usr/bin local x=1 cd -eu grep $(pwd) --verbose
+local readonly x=1 x=1 printf sed "$1" sed grep "$@" --verbose
+'quoted text' $(pwd) sed $(pwd)
+	export ${HOME} "$1" "$@" $(pwd) printf 2>/dev/null | -eu sed ${HOME}
+grep 'quoted text' export readonly echo readonly x=1 then
+		-eu /usr/bin $(pwd) "$@" awk readonly /usr/bin awk | --verbose ${HOME} --verbose
+/usr/bin then cd 2>/dev/null --verbose awk echo ${HOME}
+| "$1" /usr/bin 'quoted text' 'quoted text' && "$1" done printf && printf 'quoted text'
+export "$1" ${HOME} awk printf printf
+| /usr/bin /usr/bin readonly cd cd cd cd readonly
+	sed test | "$@" | | test export 2>/dev/null
+echo then | printf && export -eu echo x=1 $(pwd) /usr/bin
+		"$1" $(pwd) cd | grep export ${HOME} $(pwd) 2>/dev/null readonly ${HOME}
+	--verbose && awk ${HOME} printf 'quoted text' -eu readonly
+local --verbose && sed 'quoted text' readonly awk printf echo then "$1" test
+sed "$@" --verbose local | "$1" local "$1" -eu --verbose sed && grep --verbose
+		test "$1" then "$@" -eu cd -eu export
+		&& -eu local awk done 'quoted text' cd sed ${HOME} x=1 | --verbose "$1" export
+${HOME} -eu $(pwd) sed awk --verbose $(pwd)
+		done test local local 2>/dev/null --verbose printf -eu grep /usr/bin | x=1 sed
+done readonly --verbose
+	grep "$1" x=1 "$@" echo grep local printf test "$1" ${HOME} $(pwd) awk echo
+echo printf export 2>/dev/null "$1" ${HOME}
+done sed ${HOME} done readonly x=1 && local "$@"
+printf /usr/bin test x=1 ${HOME} "$@" local local awk
+	--verbose 2>/dev/null --verbose
+awk $(pwd) export &&
+printf ${HOME} -eu echo then sed x=1 2>/dev/null export done then local /usr/bin
+	${HOME} "$1" x=1 printf printf test 'quoted text'
+		done 2>/dev/null 'quoted text' "$@" then local $(pwd) test "$@" --verbose test 2>/dev/null
+| readonly $(pwd) | | "$1" ${HOME} echo | printf grep "$@" sed then "$@"
+	cd "$@" | "$@" done sed ${HOME}
+export --verbose --verbose | printf -eu awk | echo "$1" cd export
+		done --verbose cd export sed
+cd | | | ${HOME} "$@" awk 'quoted text'
+readonly "$@" export /usr/bin -eu then "$1" test -eu cd local | then
+	readonly export && echo test local
+	$(pwd) 2>/dev/null readonly cd printf 'quoted text' cd | sed $(pwd) &&
+		grep -eu test export ${HOME} -eu 'quoted text'
+	then && sed /usr/bin sed echo grep --verbose export local 2>/dev/null
+/usr/bin echo -eu readonly "$1"
+--verbose 'quoted text' 'quoted text' awk test cd x=1 test
+	export /usr/bin echo readonly
+		local export export export printf
+"$1" --verbose $(pwd) --verbose grep ${HOME} /usr/bin awk export
+${HOME} awk awk done done --verbose --verbose ${HOME} cd "$1" 2>/dev/null
+		$(pwd) $(pwd) --verbose x=1 && done cd done 'quoted text'
+	sed --verbose done 'quoted text' 'quoted text'
+		x=1 'quoted text' x=1 echo sed x=1 printf --verbose "$1"
+		awk sed 2>/dev/null 2>/dev/null local cd grep
+	| $(pwd) --verbose cd $(pwd) awk readonly local ${HOME} done
+	'quoted text' | awk awk && local grep echo /usr/bin grep export ${HOME} awk
+	grep $(pwd) 'quoted text' "$1" && -eu readonly
+		local --verbose | -eu -eu
+		echo 'quoted text' sed 2>/dev/null then -eu sed done cd
+	"$@" 2>/dev/null cd cd && -eu ${HOME} -eu then 2>/dev/null
+	--verbose --verbose readonly 'quoted text' 'quoted text'
+	${HOME} test "$@" --verbose
+#include c190.sh
+		'quoted text' /usr/bin 'quoted text'
+	"$1" 2>/dev/null awk test ${HOME} printf export $(pwd) grep -eu /usr/bin
+		2>/dev/null cd echo ${HOME} cd 2>/dev/null /usr/bin | test -eu | x=1 cd export
+	cd echo "$1" cd awk --verbose | "$1" local echo ${HOME} 'quoted text'
+		&& "$1" --verbose -eu sed cd readonly | ${HOME} cd
+		grep "$1" readonly /usr/bin awk -eu --verbose "$@" 'quoted text'
+		printf printf then 'quoted text' printf | -eu x=1 echo && sed ${HOME}
+	test /usr/bin 'quoted text' $(pwd) 2>/dev/null sed printf then
+	cd ${HOME} done x=1 && ${HOME} awk awk /usr/bin "$1" cd $(pwd)
+grep -eu printf awk done "$1" done "$@" | sed test printf &&
+x=1 /usr/bin then 'quoted text' 'quoted text'
+x=1 x=1 then test test 2>/dev/null test ${HOME}
+		cd "$@" $(pwd) grep ${HOME} "$1" ${HOME} sed awk 2>/dev/null ${HOME} echo test
+	x=1 export -eu done | 'quoted text'
+		sed --verbose echo "$1" local export test local grep readonly
+	"$1" export echo then /usr/bin x=1 "$@" test readonly 'quoted text'
+	printf test export && "$@" ${HOME} then printf grep 2>/dev/null
+grep -eu /usr/bin echo then /usr/bin
+	grep -eu /usr/bin "$1" awk printf ${HOME} readonly
+	'quoted text' echo "$@" awk -eu --verbose readonly 2>/dev/null x=1 'quoted text'
+test 'quoted text' export local done 2>/dev/null echo &&
+	"$@" --verbose x=1 sed 2>/dev/null test $(pwd) local
+		test && grep grep && ${HOME} $(pwd)
+	local "$1" "$@" 'quoted text' cd && 'quoted text'
+$(pwd) 2>/dev/null "$@" -eu $(pwd) readonly grep && local
+	${HOME} grep grep 'quoted text'
+awk 2>/dev/null "$@" echo 'quoted text' readonly echo cd "$@" -eu $(pwd) local
+		| x=1 && $(pwd) echo "$@" sed 2>/dev/null
+	readonly && && awk printf printf cd
+-eu printf readonly x=1 /usr/bin
+		then sed --verbose readonly
+	"$1" && then export done local ${HOME} -eu grep ${HOME} /usr/bin
+	--verbose --verbose done
+x=1 test ${HOME} 2>/dev/null cd 'quoted text' --verbose "$@"
+&& -eu done /usr/bin cd x=1 echo export
+-eu local echo cd 2>/dev/null | cd x=1 && -eu
+		"$1" echo 'quoted text' echo then "$1" "$1" "$@" readonly sed
+$(pwd) printf readonly
+-eu cd --verbose 2>/dev/null -eu printf then then test --verbose -eu grep
+	${HOME} --verbose echo readonly x=1 $(pwd) $(pwd) x=1 local
+	| export /usr/bin printf --verbose echo | test readonly
+test 'quoted text' ${HOME} awk --verbose --verbose readonly sed
+	"$1" --verbose --verbose
+	test "$1" echo echo local cd export
+	test /usr/bin awk awk local x=1 done --verbose "$1" | awk grep 2>/dev/null
+test && cd awk awk cd "$@" test 'quoted text' --verbose
+	grep x=1 sed 'quoted text' done 2>/dev/null test then "$@" 2>/dev/null then "$@"
+		&& ${HOME} awk export then cd test sed
+	&& /usr/bin grep 2>/dev/null sed $(pwd) && ${HOME} local && 2>/dev/null
+	local --verbose -eu /usr/bin x=1 -eu
+local printf done 'quoted text' | then export
+cd ${HOME} x=1 -eu && ${HOME} ${HOME} sed 2>/dev/null
+printf readonly --verbose x=1
+'quoted text' 2>/dev/null "$1" export export sed readonly
+| -eu then cd echo x=1 -eu then "$@" 2>/dev/null
+	readonly 2>/dev/null done | ${HOME} then --verbose ${HOME}
+-eu readonly | x=1 'quoted text'
+local /usr/bin cd --verbose | -eu export "$@" /usr/bin "$1" readonly test
+	sed x=1 | 'quoted text' ${HOME} done $(pwd) done "$@" then -eu sed /usr/bin $(pwd)
+&& && && 'quoted text' cd "$1" cd
+	"$1" | printf x=1 grep --verbose export /usr/bin -eu cd
+	test $(pwd) && x=1 && test grep x=1 $(pwd) --verbose /usr/bin "$1" /usr/bin
+	&& /usr/bin echo cd | echo ${HOME} echo 2>/dev/null
+		x=1 readonly awk export then "$@" |
+		-eu "$@" test grep awk "$@" awk /usr/bin export cd readonly
+grep 'quoted text' echo done "$@" grep done printf export readonly test printf
+		'quoted text' --verbose -eu
+		test cd 2>/dev/null local echo "$@" 2>/dev/null "$1" x=1 readonly
+		local cd readonly printf cd $(pwd) $(pwd)
+	echo export cd "$1" sed 'quoted text' x=1 then readonly awk grep 'quoted text'
+"$@" 2>/dev/null done "$1" local awk sed readonly readonly
+	export | readonly $(pwd) export readonly export "$@" x=1 $(pwd) && "$1" /usr/bin
+readonly echo /usr/bin "$1" "$@"
+		'quoted text' x=1 | --verbose awk cd test | $(pwd) && awk
+done /usr/bin | && local "$1" grep test local ${HOME}
+"$1" printf | done $(pwd) sed 'quoted text' 2>/dev/null grep "$1"
+	then export test then cd test "$1" x=1 grep | cd "$1" cd "$@" test test
+		"$@" sed sed echo local grep "$1" "$@" test cd 'quoted text'
+	&& "$@" local $(pwd) printf export cd echo x=1 cd done readonly grep printf $(pwd)
+| local sed readonly grep export
+echo "$@" | $(pwd) cd 2>/dev/null /usr/bin local ${HOME} | grep -eu /usr/bin
+	'quoted text' sed export awk "$1" then printf 'quoted text'
+then grep "$@" && local 2>/dev/null $(pwd) && readonly "$1" $(pwd) local local then
+		"$1" local ${HOME} x=1 test grep
+	local cd export test --verbose --verbose export --verbose | 2>/dev/null grep
+		test printf done "$1" then "$@"
+| then echo printf local $(pwd) awk local "$@" export --verbose
+		| | then /usr/bin --verbose "$@" 2>/dev/null cd && sed && x=1 $(pwd) 'quoted text'
+		echo --verbose done 'quoted text' export x=1
+	awk 'quoted text' test
+/usr/bin awk echo x=1 /usr/bin -eu done sed -eu ${HOME} /usr/bin
+		export awk $(pwd) --verbose -eu printf | /usr/bin
+	grep && "$@" sed | 2>/dev/null 'quoted text' echo | awk | | |
+		printf "$@" 2>/dev/null local echo echo then 2>/dev/null &&
+2>/dev/null readonly x=1 --verbose
+done x=1 awk local printf
+'quoted text' $(pwd) $(pwd)
+		$(pwd) "$@" -eu local "$1" export grep --verbose
+	${HOME} cd awk /usr/bin export
+then test 'quoted text' 2>/dev/null
+		x=1 sed 'quoted text' cd cd sed readonly sed grep local | grep grep test
+	printf echo /usr/bin grep && printf test
+local "$@" | | "$@" --verbose
+	grep ${HOME} ${HOME} -eu done 'quoted text'
+		-eu sed awk 2>/dev/null
+		$(pwd) 'quoted text' cd -eu local "$1" local ${HOME} awk
+	export readonly && export export /usr/bin sed "$@" 2>/dev/null | local echo && 'quoted text'
+		"$1" local local 'quoted text' export sed "$1"
+export done | 'quoted text' done grep awk awk then grep ${HOME} test --verbose
+x=1 $(pwd) echo echo x=1 "$1" grep -eu x=1 && echo readonly test export
+	local ${HOME} local $(pwd) readonly
+		cd echo echo /usr/bin test $(pwd) export local -eu
+local export test sed 2>/dev/null ${HOME} awk /usr/bin readonly
+readonly echo 'quoted text' -eu awk $(pwd) ${HOME}
+	local -eu "$1" printf "$1" test done 'quoted text' && ${HOME} $(pwd)
+awk echo export ${HOME} 2>/dev/null && grep readonly
+		&& ${HOME} readonly x=1 --verbose
+awk /usr/bin -eu /usr/bin then --verbose &&
+		x=1 then --verbose awk -eu --verbose /usr/bin
+		local /usr/bin | ${HOME} /usr/bin | printf test sed then 2>/dev/null "$1" then
+awk $(pwd) done /usr/bin $(pwd) test cd cd done |
+		${HOME} "$@" -eu done
+awk then $(pwd) done $(pwd) grep cd "$1" local x=1 ${HOME}
+		test echo --verbose test awk done
+"$@" local $(pwd) 2>/dev/null 2>/dev/null x=1 cd local
+		--verbose x=1 done && "$1" -eu x=1 && printf
+sed -eu | && export grep | export "$@" local done && | sed $(pwd)
+"$@" local export cd 2>/dev/null sed local 2>/dev/null --verbose
+	done sed "$1" "$1" "$@"
+		"$@" then test grep done echo 2>/dev/null /usr/bin "$1"
+		-eu "$1" export | x=1 && "$1" readonly
+	awk sed local export export "$@"
+&& awk "$@" echo awk cd cd /usr/bin printf test -eu
+'quoted text' x=1 printf && -eu "$1" | sed grep 'quoted text'
+test then then printf sed "$1" sed && "$@" printf local then printf readonly done
+	printf "$1" 'quoted text' then export && printf | then ${HOME}
+	&& | | sed export ${HOME} x=1
+	'quoted text' awk "$@"
+	| cd 'quoted text' 'quoted text' local 2>/dev/null ${HOME}
+		test local x=1 grep x=1 && echo 'quoted text' x=1 cd printf
+	&& && -eu | 'quoted text' x=1 local export 'quoted text'
+		"$1" | "$@" /usr/bin test
+		local /usr/bin cd 'quoted text' test "$1"
+	$(pwd) "$1" test "$@" "$1" "$1" "$@" grep x=1 --verbose $(pwd) x=1 awk "$1" && -eu
+local test && sed done --verbose "$1" | grep export && -eu
+	then test 2>/dev/null "$1" | then sed grep
+	local && 2>/dev/null 'quoted text'
+/usr/bin ${HOME} awk grep readonly
+		/usr/bin /usr/bin done sed
+$(pwd) awk 2>/dev/null "$1" cd 2>/dev/null cd done readonly
+		2>/dev/null ${HOME} $(pwd)
+		--verbose 'quoted text'
+		sed 'quoted text' readonly | /usr/bin cd readonly --verbose printf
+"$1" readonly export cd printf export /usr/bin grep
+	&& "$1" 2>/dev/null /usr/bin awk cd grep ${HOME} local && local
+	${HOME} x=1 /usr/bin done echo ${HOME}
+	printf readonly && &&
+local sed $(pwd) printf x=1 readonly grep ${HOME}
+echo cd | then $(pwd) export local 'quoted text' grep $(pwd) sed
+		&& cd awk x=1 --verbose | echo 2>/dev/null | printf $(pwd) -eu cd -eu readonly
+	"$1" x=1 then then | 'quoted text'
+	test -eu printf /usr/bin "$1" "$1" /usr/bin "$1" --verbose export
+		x=1 then local -eu export printf "$1" -eu printf
+&& awk awk then $(pwd) printf sed cd sed | then --verbose
+		&& 'quoted text' done cd test test $(pwd) && echo
+	echo && ${HOME} -eu echo $(pwd) 2>/dev/null
+		${HOME} then awk 'quoted text'
+	2>/dev/null /usr/bin printf /usr/bin | --verbose sed 2>/dev/null
+	then --verbose ${HOME} test | "$1" "$@" "$@" echo readonly
+		"$1" 2>/dev/null sed --verbose "$@" test 2>/dev/null "$1" printf test awk
+		then local readonly sed --verbose awk export
+	$(pwd) x=1 --verbose sed sed -eu readonly "$@" done --verbose
+		&& done export export x=1
+x=1 export "$1" 'quoted text' local --verbose --verbose done -eu cd printf
+	x=1 x=1 then --verbose readonly
+	cd ${HOME} grep && 'quoted text' test --verbose cd 2>/dev/null sed sed /usr/bin
+2>/dev/null 'quoted text' local echo ${HOME} --verbose printf
+		&& ${HOME} test printf | | then sed -eu grep --verbose
+	printf done echo local 2>/dev/null test ${HOME} 2>/dev/null local
+		export awk | 2>/dev/null && grep then "$@" -eu "$1"
+	"$1" "$1" 2>/dev/null awk printf ${HOME} $(pwd) export "$@"
+	export awk readonly test done -eu | && 2>/dev/null
+sed sed cd $(pwd) "$1" grep printf awk grep cd awk
+echo ${HOME} then awk awk then readonly
+	$(pwd) grep /usr/bin done cd && -eu printf done | export awk grep done
+local done $(pwd) "$@" && local then -eu /usr/bin /usr/bin grep
+grep echo -eu && awk /usr/bin -eu export
+		"$1" x=1 -eu -eu readonly -eu awk done echo "$@" test done done "$@"
+export echo then ${HOME} $(pwd) 2>/dev/null readonly readonly sed awk readonly
+then local "$1" 2>/dev/null grep awk
+	awk test "$@" export sed "$@"
+	awk export --verbose $(pwd) awk ${HOME} export export
+	'quoted text' cd readonly echo $(pwd) cd readonly 2>/dev/null
+"$@" x=1 "$1" ${HOME} x=1 echo 2>/dev/null ${HOME} 2>/dev/null
+then done ${HOME} cd readonly cd readonly grep /usr/bin "$@" then x=1
+readonly && "$1" grep cd test "$1" $(pwd) echo grep export
+		sed "$@" x=1 done echo --verbose test grep x=1 readonly | 'quoted text'
+		x=1 "$1" | "$@" "$@" -eu $(pwd) local && ${HOME} awk printf local
+		${HOME} $(pwd) 'quoted text' ${HOME}
+"$1" x=1 awk && /usr/bin x=1 cd readonly && && export export
+		$(pwd) 2>/dev/null --verbose "$@" 'quoted text' /usr/bin done sed
+	export test --verbose x=1 sed 2>/dev/null export test /usr/bin
+	test cd | cd | printf ${HOME}
+cd readonly "$1" ${HOME} 'quoted text'
+test done /usr/bin local
+export then sed export printf ${HOME} 2>/dev/null
+	"$1" /usr/bin $(pwd) awk /usr/bin readonly | -eu readonly
+	done printf cd "$@" |
+		| awk sed printf $(pwd) && sed
+echo $(pwd) test local | x=1
+		echo done && --verbose ${HOME} then 'quoted text'
+		"$1" echo -eu -eu test ${HOME}
+		local printf "$@" grep export $(pwd) "$1" $(pwd) ${HOME} x=1 $(pwd) printf done
+local /usr/bin done | 'quoted text'
+/usr/bin printf local readonly readonly then awk then awk done awk
+		printf printf /usr/bin then readonly -eu export awk done
+		&& echo "$1" x=1 && 'quoted text'
+printf "$1" test 'quoted text' printf export test test done "$1" -eu sed 'quoted text'
+	export $(pwd) "$@" x=1 test | export $(pwd) then grep $(pwd) grep
+		| "$1" /usr/bin sed "$@" export echo
+awk echo grep then sed then then 2>/dev/null
+		cd 'quoted text' $(pwd) 2>/dev/null grep cd export local awk test /usr/bin awk
+	cd awk then readonly -eu readonly "$@" local x=1 | | local echo $(pwd) local
+local done --verbose cd readonly /usr/bin printf -eu "$1" "$@" 2>/dev/null
+	test sed echo --verbose "$1" "$@" ${HOME} --verbose local export printf
+cd --verbose cd /usr/bin x=1 -eu x=1 awk -eu echo awk "$@" ${HOME}
+	export echo /usr/bin done && x=1 awk "$@" "$@"
+		/usr/bin echo awk 'quoted text' /usr/bin readonly
+	-eu $(pwd) | grep printf -eu 2>/dev/null
+	echo sed printf done test export | export /usr/bin awk "$1" -eu grep sed | local
+${HOME} then printf grep --verbose /usr/bin 2>/dev/null
+printf test /usr/bin sed local export awk sed $(pwd) test grep /usr/bin printf
+	&& grep ${HOME} x=1 export cd 2>/dev/null
+-eu ${HOME} -eu printf ${HOME} x=1 printf -eu done -eu sed "$@"
+		test /usr/bin ${HOME} 2>/dev/null
+		test 2>/dev/null grep x=1 ${HOME} readonly
+grep grep | then x=1 awk local readonly
+&& x=1 x=1 sed "$@" --verbose && $(pwd) then sed done cd
+2>/dev/null awk "$1" grep echo
+		then awk readonly x=1 local
+	echo "$@" -eu cd done --verbose -eu "$@"
+	--verbose printf awk done echo
+		/usr/bin | -eu | "$1" cd readonly 2>/dev/null
+		export | "$@" awk && echo test cd done local 2>/dev/null grep ${HOME}
+| export "$1" printf && 2>/dev/null
+		grep test x=1 'quoted text' "$1" $(pwd)
+local --verbose ${HOME} 'quoted text' test printf &&
+-eu 2>/dev/null grep printf local | echo then awk local "$@"
+/usr/bin export awk sed awk x=1 then
+	printf readonly "$1" && local "$@" export
+	sed test x=1 "$1" test sed x=1 printf
+	2>/dev/null test then test "$1" --verbose awk 2>/dev/null echo 2>/dev/null &&
+test done printf sed awk awk grep $(pwd)
+		&& "$1" echo | -eu "$@"
+	/usr/bin done $(pwd) /usr/bin echo "$@"
+		--verbose local readonly sed
+		/usr/bin then | export test test x=1 then test "$@" | -eu cd ${HOME}
+	then "$@" cd 2>/dev/null grep local export
+	readonly sed sed x=1 cd export sed then awk 'quoted text' local
+	done printf printf -eu x=1 local && 'quoted text'
+		sed 'quoted text' export done --verbose export 2>/dev/null "$@" then echo /usr/bin
+		2>/dev/null && $(pwd) grep
+		test readonly awk awk x=1 readonly 'quoted text'
+done -eu local grep "$1" then x=1
+$(pwd) grep cd local ${HOME} "$@" then "$1" printf then | readonly
+	echo printf printf readonly grep cd grep awk export /usr/bin
+'quoted text' $(pwd) awk readonly test local awk then export /usr/bin
+		then 2>/dev/null echo 'quoted text' then grep awk awk |
+		x=1 readonly -eu cd 'quoted text' -eu 2>/dev/null
+	then | export local | x=1 $(pwd) "$@" test grep sed readonly /usr/bin x=1
+then printf --verbose test export && x=1 export 2>/dev/null awk sed /usr/bin
+	/usr/bin -eu printf sed
+		/usr/bin readonly then 'quoted text' readonly -eu "$1" -eu grep
+	local | 2>/dev/null echo local done local
+		grep grep | readonly 2>/dev/null | $(pwd)
+		done awk -eu $(pwd) x=1 readonly 'quoted text' --verbose done &&
+		test cd sed grep | echo printf /usr/bin "$@" test $(pwd) /usr/bin echo x=1
+		grep cd then x=1 $(pwd) printf cd --verbose
+	awk local grep awk echo 'quoted text' test printf -eu cd x=1 sed
+	$(pwd) $(pwd) printf then test "$@" ${HOME} echo
+	sed -eu printf --verbose -eu | awk && test -eu ${HOME}
+		grep printf readonly awk ${HOME} cd x=1 done 'quoted text' then test echo
+done grep | test --verbose
+		${HOME} local | ${HOME}
+	echo grep 'quoted text' | | done | printf
+		${HOME} readonly sed echo
+	printf grep sed printf -eu cd readonly $(pwd) printf
+test grep 2>/dev/null printf grep x=1 "$@" 2>/dev/null x=1 $(pwd)
+2>/dev/null sed readonly sed "$1" 'quoted text' sed local "$@"
+	/usr/bin "$@" --verbose $(pwd) x=1
+echo local | 2>/dev/null -eu && $(pwd) readonly
+x=1 sed && echo grep sed 2>/dev/null /usr/bin "$@" printf 2>/dev/null
+awk echo ${HOME} done "$@" sed cd "$1" &&
+echo 2>/dev/null done 2>/dev/null -eu awk "$1" test 'quoted text'
+	printf sed -eu x=1 2>/dev/null printf then printf readonly |
+		"$1" x=1 2>/dev/null sed "$@" /usr/bin && done echo --verbose /usr/bin
+		readonly test && | /usr/bin --verbose printf export && cd grep awk cd
+		"$@" sed "$@" printf export --verbose then then x=1 cd
+done "$1" "$1" export "$@" --verbose 2>/dev/null export -eu grep
+test 2>/dev/null echo "$@" x=1 --verbose export 'quoted text'
+	/usr/bin ${HOME} printf then done 'quoted text' ${HOME}
+"$1" 2>/dev/null && $(pwd)
+	export "$1" "$@" sed then | done /usr/bin awk test export /usr/bin sed done
+		-eu && -eu 'quoted text' x=1 | "$@" echo done x=1
+		export cd echo export readonly cd echo -eu --verbose
+		"$1" export echo $(pwd) "$@" done local ${HOME}
+	--verbose && printf readonly
+	echo local sed local readonly 'quoted text' readonly
+	readonly -eu done awk done then local grep local awk -eu --verbose
+-eu 'quoted text' local sed export awk grep "$1" awk -eu done
+		x=1 'quoted text' cd local | | ${HOME} readonly test sed /usr/bin
+sed printf 'quoted text' --verbose
+		-eu awk echo 'quoted text' export | test done done then export 'quoted text'
+	awk awk --verbose && "$@" awk printf cd --verbose
+	cd "$@" "$1" "$@" readonly --verbose /usr/bin
+	x=1 local "$1" /usr/bin done local sed /usr/bin $(pwd) export
+	awk cd x=1 2>/dev/null
+"$1" sed awk grep export then $(pwd) -eu 'quoted text' /usr/bin $(pwd) -eu test
+$(pwd) readonly "$@" x=1 printf 'quoted text' printf export grep ${HOME} grep
+grep /usr/bin ${HOME} "$1" --verbose $(pwd) readonly 2>/dev/null
+		$(pwd) --verbose awk awk -eu printf
+export $(pwd) then sed done test && export | then export "$1" -eu cd ${HOME}
+	awk readonly test $(pwd)
+		$(pwd) | then "$1" test grep sed export "$1"
+	"$@" done sed x=1 awk --verbose /usr/bin -eu awk sed
+		local local local local echo
+		--verbose /usr/bin local /usr/bin && sed && "$@"
+	--verbose --verbose $(pwd)
+x=1 /usr/bin local printf $(pwd) "$1" ${HOME} x=1 then 2>/dev/null
+--verbose awk && 2>/dev/null printf $(pwd) cd readonly printf printf
+local echo test x=1 awk sed 'quoted text' grep
+&& /usr/bin cd local "$1" x=1 grep $(pwd) sed grep
+		cd done 'quoted text' grep --verbose 'quoted text' "$1" "$@"
+		local readonly /usr/bin sed && test --verbose export test /usr/bin | grep export
+| test done readonly grep ${HOME}
+		2>/dev/null export 'quoted text'
+	/usr/bin printf $(pwd) "$@"
+		"$1" done "$@" printf "$1" ${HOME} "$1" readonly
+	grep 2>/dev/null readonly cd 2>/dev/null --verbose export | --verbose 2>/dev/null
+	cd printf done "$1" 'quoted text'
+	/usr/bin then then -eu && $(pwd)
+		test cd ${HOME} 2>/dev/null $(pwd) sed
+	x=1 -eu ${HOME} readonly printf --verbose printf
+		sed | cd local 'quoted text' cd /usr/bin readonly /usr/bin x=1 2>/dev/null done
+		awk sed "$1" --verbose --verbose cd ${HOME}
+		x=1 cd echo export && x=1 echo readonly
+		"$1" "$@" then x=1 grep "$1" test --verbose then --verbose
+test --verbose then echo x=1 done $(pwd) test /usr/bin | ${HOME} echo printf
+	/usr/bin ${HOME} --verbose && 2>/dev/null
+	done 2>/dev/null "$1" awk | "$@" "$@" export 'quoted text'
+		--verbose $(pwd) test ${HOME} 2>/dev/null
+	| 'quoted text' readonly local done /usr/bin local "$1"
+	&& | ${HOME} done sed --verbose sed sed test grep echo x=1 then cd
+	&& "$1" printf 2>/dev/null
+sed 'quoted text' awk "$@" 2>/dev/null
+then local then "$1" printf "$1" -eu && test "$1" sed
+--verbose awk done --verbose 'quoted text' cd sed printf test printf echo then "$@"
+		${HOME} test | --verbose grep --verbose --verbose done then | && test
+$(pwd) echo export /usr/bin cd 'quoted text' -eu done
+	sed readonly local grep 'quoted text' awk then
+x=1 /usr/bin 'quoted text' grep readonly ${HOME} "$1"
+awk ${HOME} x=1 --verbose echo local "$1" --verbose export sed test
+cd "$@" test grep | readonly readonly test
+	then 'quoted text' && awk export
+		/usr/bin "$@" echo printf
+		${HOME} awk local $(pwd) --verbose 'quoted text'
+		export awk local then 2>/dev/null 2>/dev/null export
+	sed readonly $(pwd) && /usr/bin 2>/dev/null
+		$(pwd) 'quoted text' |
+	/usr/bin grep sed echo 2>/dev/null awk | 2>/dev/null
+$(pwd) printf readonly sed local
+		awk x=1 "$@" && export grep then awk test printf grep
+		-eu sed 'quoted text' 'quoted text'
+		$(pwd) grep -eu $(pwd) export
+		export $(pwd) echo printf cd /usr/bin $(pwd) then ${HOME} local local then
+		local local ${HOME} grep sed 2>/dev/null "$1" printf && "$@" grep cd 'quoted text'
+	/usr/bin ${HOME} printf local 'quoted text' "$1"
+	"$1" sed cd test export "$@" 2>/dev/null
+$(pwd) sed then x=1 awk x=1 printf awk export $(pwd) $(pwd) x=1 x=1 then
+-eu | x=1 then "$1" awk readonly
+awk then cd x=1 readonly test --verbose "$1" "$@" 2>/dev/null $(pwd)
+	| echo cd "$1" && export local -eu cd test grep printf
+/usr/bin grep printf /usr/bin sed local test then sed "$1"
+		/usr/bin x=1 readonly "$1" /usr/bin sed
+		$(pwd) $(pwd) ${HOME} "$1" grep echo test | sed "$@"
+	${HOME} awk -eu && 'quoted text' | done | cd 'quoted text'
+	'quoted text' /usr/bin then sed 2>/dev/null
+	-eu $(pwd) echo grep x=1 test done $(pwd) | "$@"
+		| $(pwd) readonly awk cd --verbose
+	cd --verbose /usr/bin sed | -eu local echo done 2>/dev/null
+sed x=1 --verbose $(pwd) readonly readonly cd "$1" $(pwd)
+		${HOME} 2>/dev/null 'quoted text' local then export
+	2>/dev/null | done done grep && 'quoted text'
+		done && -eu ${HOME} grep ${HOME} printf x=1 cd "$@" echo test
+		done then sed printf test "$1" 2>/dev/null cd --verbose sed test
+	export -eu local sed export && export sed ${HOME}
+sed x=1 && local readonly grep readonly && export
+	export "$@" test $(pwd) export "$@" cd awk x=1 export grep awk
+	awk done done 'quoted text' |
+	then ${HOME} 'quoted text' test then /usr/bin readonly readonly
+		local | export $(pwd) local x=1 done --verbose cd sed
+test test cd | $(pwd) then "$1" $(pwd) $(pwd) then test then 'quoted text' printf
+		| | -eu "$1" printf --verbose && && 2>/dev/null
+		${HOME} readonly printf grep sed test $(pwd) awk --verbose 'quoted text'
+	| test 'quoted text' | sed x=1
+	x=1 "$@" export -eu ${HOME} done ${HOME} awk
+test done test 'quoted text'
+	done done && --verbose test 'quoted text' $(pwd)
+local && /usr/bin ${HOME} awk | export grep export export test cd -eu ${HOME}
+x=1 /usr/bin "$@" readonly "$1" grep echo "$1" echo ${HOME} "$@" printf
+export then test printf echo grep $(pwd) local sed sed
+cd cd local export cd local printf -eu done $(pwd) 2>/dev/null "$1" local grep
+export --verbose readonly "$@" -eu --verbose printf
+		printf done -eu x=1 cd 2>/dev/null ${HOME}
+		${HOME} --verbose "$@" "$@" done printf grep $(pwd) export sed x=1 export -eu
+grep done -eu x=1 2>/dev/null done
+	--verbose printf | "$@" | then local cd then test --verbose
+echo then printf test grep readonly awk --verbose "$@" printf awk -eu
+		2>/dev/null local echo done -eu 'quoted text' grep $(pwd) x=1 awk export -eu
+		grep "$1" | cd -eu readonly readonly cd /usr/bin | | ${HOME} --verbose $(pwd)
+	then 2>/dev/null readonly | --verbose "$@" done
+awk --verbose test test local
+"$1" --verbose grep printf --verbose "$@" --verbose
+&& cd ${HOME} readonly echo -eu local grep 'quoted text'
+		cd done x=1 x=1 grep 'quoted text' -eu local then
+echo -eu local sed /usr/bin
+"$@" echo 2>/dev/null export printf x=1 /usr/bin
+| 2>/dev/null then 'quoted text'
+		$(pwd) --verbose -eu 2>/dev/null --verbose x=1 -eu
+"$1" 2>/dev/null test
+then /usr/bin "$1" export | done readonly then 2>/dev/null ${HOME}
+		${HOME} "$1" "$@" 'quoted text' printf grep "$@" printf then && echo printf
+'quoted text' test test cd local
+| -eu $(pwd) ${HOME} $(pwd) --verbose -eu "$@" printf
+cd export cd "$1" 2>/dev/null 'quoted text' local done --verbose ${HOME}
+	$(pwd) "$@" echo awk export "$@"
+	grep test awk /usr/bin echo /usr/bin then readonly sed 'quoted text'
+${HOME} test "$@" ${HOME} 2>/dev/null "$@"
+	$(pwd) done awk | 'quoted text' grep x=1 $(pwd) sed 2>/dev/null && then awk readonly
+&& ${HOME} awk /usr/bin local echo sed x=1 "$1" awk local x=1 --verbose test printf
+		test export local | done printf grep printf awk readonly ${HOME} &&
+'quoted text' readonly
+		cd $(pwd) then test /usr/bin "$1" export /usr/bin printf
+export export x=1 $(pwd)
+	local ${HOME} | -eu printf echo &&
+		done ${HOME} grep ${HOME} 2>/dev/null -eu readonly cd 2>/dev/null /usr/bin
+readonly $(pwd) ${HOME} "$1" $(pwd)
+		grep $(pwd) "$@" done export && done 2>/dev/null then export 2>/dev/null
+	"$1" cd then && sed $(pwd) "$1" 'quoted text' --verbose
+		done awk printf echo && echo printf echo readonly then && | readonly
+echo sed ${HOME} sed sed -eu /usr/bin
+		cd test then local | x=1 then --verbose -eu
+		"$@" && 2>/dev/null export local $(pwd)
+test export | 'quoted text' "$@" x=1 readonly awk sed then then "$1" ${HOME}
+	readonly "$@" && local done
+	grep -eu --verbose then cd | 2>/dev/null "$@" done 'quoted text'
+"$1" printf 2>/dev/null sed grep x=1 |
+| done "$1" local echo
+	/usr/bin printf export echo done sed -eu cd && readonly | export
+		grep cd -eu | | printf -eu test | sed && $(pwd) | local
+x=1 grep then local x=1 | /usr/bin sed echo 'quoted text' echo grep test
+		| echo awk done && && && -eu 'quoted text' done grep
+		--verbose 'quoted text' done x=1 "$@" export readonly grep echo /usr/bin
+	--verbose done "$@" done && readonly --verbose
+	x=1 x=1 'quoted text' 'quoted text' ${HOME} cd export /usr/bin
+		cd ${HOME} $(pwd) test --verbose "$1" test 2>/dev/null echo "$1" sed local "$1"
+	export --verbose | $(pwd) -eu cd printf && "$@" "$@" 2>/dev/null "$1"
+		printf test then && "$1" export 'quoted text'
+grep done x=1 readonly printf printf awk x=1 2>/dev/null 'quoted text'
+	printf | 2>/dev/null grep "$@" 2>/dev/null --verbose printf local "$1" echo grep
+	printf "$@" 2>/dev/null x=1 local echo awk
+	then done x=1 2>/dev/null ${HOME} -eu $(pwd) 'quoted text'
+		--verbose | 2>/dev/null -eu export awk then grep ${HOME} sed
+	2>/dev/null | /usr/bin grep cd 'quoted text' printf -eu local && printf "$@" -eu
+		awk $(pwd) printf 2>/dev/null echo --verbose ${HOME} done /usr/bin
+	"$@" grep done test $(pwd) readonly grep cd x=1
+		| test echo awk 2>/dev/null
+	'quoted text' printf test --verbose done then /usr/bin
+grep && "$@" export awk "$@" printf grep && done test ${HOME} grep "$@"
+x=1 then ${HOME} 'quoted text'
+		sed "$@" 2>/dev/null done "$@" export
+test test grep echo && "$@" x=1 export
+	x=1 printf && /usr/bin echo ${HOME} export
+cd --verbose ${HOME} --verbose | readonly sed && "$@" cd then
+	"$@" $(pwd) test -eu local export
+		'quoted text' cd cd -eu "$1" readonly cd ${HOME}
+		test 'quoted text' readonly readonly readonly x=1 printf 2>/dev/null
+		2>/dev/null "$1" grep grep ${HOME}
+	| $(pwd) done then 2>/dev/null ${HOME} x=1 'quoted text' -eu echo
+'quoted text' "$1" local 'quoted text' $(pwd) test 2>/dev/null readonly
+cd grep -eu "$@" "$1" --verbose
+	printf then grep $(pwd) then then cd 'quoted text'
+		readonly --verbose /usr/bin
+| then -eu cd 2>/dev/null
+done grep local $(pwd) --verbose ${HOME} 2>/dev/null
+		2>/dev/null | "$@" local --verbose
+		grep grep export echo 'quoted text' test done cd
+'quoted text' $(pwd) 2>/dev/null echo echo then -eu then grep "$@" export
+		${HOME} export awk printf "$@" 2>/dev/null export | cd echo
+x=1 -eu readonly cd x=1 then echo sed 2>/dev/null /usr/bin 2>/dev/null test
+	&& x=1 /usr/bin awk 2>/dev/null $(pwd) $(pwd) -eu readonly
+		readonly $(pwd) local $(pwd) --verbose then -eu echo 2>/dev/null
+	--verbose ${HOME} 'quoted text' --verbose /usr/bin local sed && cd readonly readonly
+		awk awk x=1 $(pwd) sed | test sed -eu echo cd awk --verbose
+done done ${HOME} readonly /usr/bin
+		x=1 test 'quoted text'
+		local $(pwd) -eu local 'quoted text' 'quoted text'
+sed awk && done sed echo x=1 && cd then 'quoted text' then --verbose sed -eu
+		2>/dev/null | grep "$1" $(pwd) "$1" && -eu readonly
+	grep x=1 'quoted text' 2>/dev/null
+cd 'quoted text' ${HOME} export $(pwd) then -eu readonly test local awk grep
+		cd 'quoted text' grep grep cd echo grep test && echo local local done
+		'quoted text' cd 2>/dev/null 'quoted text' then done | 2>/dev/null local
+	x=1 $(pwd) /usr/bin then && "$@" local /usr/bin awk done done $(pwd)
+	readonly && local 'quoted text' /usr/bin readonly local readonly sed |
+	--verbose $(pwd) sed printf -eu /usr/bin printf ${HOME}
+		echo /usr/bin cd -eu awk grep
+		$(pwd) then sed "$@" export local
+		echo awk | readonly echo echo sed | 2>/dev/null
+grep awk ${HOME} test "$1" x=1 awk "$1" /usr/bin export
+	| grep export "$@" grep echo && then
+awk done local x=1 "$1" sed then sed awk cd then --verbose
+		readonly x=1 local ${HOME}
+grep x=1 /usr/bin -eu | && grep "$1" echo x=1 cd test $(pwd) /usr/bin
+		"$1" grep grep 'quoted text' "$@" then readonly "$@" /usr/bin
+		&& cd ${HOME} done sed
+	$(pwd) $(pwd) test done cd --verbose
+2>/dev/null "$1" 2>/dev/null
+		readonly readonly | export grep /usr/bin
+	'quoted text' "$1" local local readonly $(pwd)
+$(pwd) awk ${HOME} awk export
+	sed done echo done test
+readonly echo /usr/bin --verbose sed test readonly
+"$@" echo export export 2>/dev/null "$@" /usr/bin
+test cd 2>/dev/null | -eu readonly $(pwd) && echo printf /usr/bin local 2>/dev/null
+	then echo printf awk grep local cd "$@" $(pwd) awk --verbose echo "$@" echo
+		'quoted text' $(pwd) 2>/dev/null readonly
+	--verbose awk && && | --verbose
+		x=1 && x=1 'quoted text' x=1 "$@" 2>/dev/null
+x=1 $(pwd) then grep grep awk export sed awk "$@" 'quoted text'
+		&& "$@" awk "$@" --verbose readonly $(pwd) grep readonly
+		readonly --verbose x=1 then 'quoted text' "$@" echo 'quoted text'
+	/usr/bin cd $(pwd) 'quoted text'
+sed && printf echo "$1" x=1 | done /usr/bin echo x=1 x=1 awk local "$1" x=1 test
+| /usr/bin 2>/dev/null test x=1 sed | local 2>/dev/null
+awk | /usr/bin && sed cd local grep grep
+	local 2>/dev/null /usr/bin local cd local sed 'quoted text' awk
+	x=1 && awk awk readonly echo cd then /usr/bin awk $(pwd) && $(pwd) local local
+2>/dev/null grep grep $(pwd) && sed printf 'quoted text'
+		local sed -eu printf test local local grep then $(pwd) cd |
+	echo readonly readonly $(pwd) export export awk cd echo "$@" printf ${HOME}
+export ${HOME} export printf
+	"$@" "$@" 2>/dev/null then readonly "$1" ${HOME}
+local 2>/dev/null $(pwd) ${HOME} && $(pwd) export /usr/bin && 'quoted text'
+	sed cd "$@" then 'quoted text'
+		test printf cd cd echo "$1" grep cd readonly "$@" --verbose | awk sed
+x=1 local | readonly 'quoted text' 'quoted text'
+	readonly readonly 2>/dev/null "$1" 2>/dev/null | $(pwd) readonly done sed grep 'quoted text'
+	echo cd 'quoted text' "$@" printf done printf $(pwd) "$@" awk
+		2>/dev/null test 2>/dev/null grep ${HOME} 'quoted text' export 'quoted text' awk
+| done then 2>/dev/null $(pwd) done /usr/bin
+		"$1" export grep readonly | then done export $(pwd) $(pwd) grep 2>/dev/null
+		${HOME} printf 'quoted text' ${HOME} -eu ${HOME} then -eu
+	export 2>/dev/null | then done local /usr/bin test done awk test cd grep
+awk /usr/bin echo --verbose "$1" test test --verbose echo "$@" sed x=1 2>/dev/null
+	local done printf sed "$@" sed /usr/bin echo local && | -eu readonly /usr/bin
+	&& echo x=1 "$@" grep local export
+sed 2>/dev/null $(pwd) "$@" --verbose x=1 then test ${HOME}
+		'quoted text' readonly ${HOME} "$@" ${HOME} $(pwd) /usr/bin --verbose
+echo test printf grep && cd x=1 /usr/bin awk then
+		| test ${HOME} local local printf local sed 2>/dev/null export x=1 sed
+done --verbose | 2>/dev/null local local /usr/bin export done 2>/dev/null
+	done /usr/bin $(pwd) export x=1 readonly test local 'quoted text'
+		'quoted text' ${HOME} 2>/dev/null
+	x=1 printf 2>/dev/null "$@" 2>/dev/null --verbose $(pwd) test echo | done cd test
+cd x=1 /usr/bin grep echo cd cd && "$1" cd | sed grep sed done export grep
+	| "$@" sed x=1 done 2>/dev/null local sed then local sed 'quoted text'
+		grep && "$1" export printf echo sed then readonly then && && done --verbose "$@"
+		grep local test cd 2>/dev/null export done test local awk
+	export | "$1" 2>/dev/null --verbose then test
+echo sed printf awk | $(pwd) grep
+	echo && readonly && readonly -eu "$@" printf test
+		grep -eu then 2>/dev/null done cd done -eu export export local
+	local local grep export export /usr/bin echo echo
+	$(pwd) grep sed && grep 2>/dev/null local && 2>/dev/null ${HOME}
+		$(pwd) | | --verbose 'quoted text' then | echo && export echo 2>/dev/null /usr/bin
+		"$@" 2>/dev/null awk awk export -eu -eu "$1" export cd 'quoted text'
+then 'quoted text' local --verbose /usr/bin
+	&& "$1" ${HOME} | x=1 "$@" x=1 --verbose sed
+"$@" -eu 2>/dev/null readonly -eu
+	printf grep x=1 --verbose --verbose cd
+		cd x=1 echo 2>/dev/null then -eu grep cd awk
+$(pwd) grep cd $(pwd) "$@" -eu sed "$@" | 2>/dev/null
+	"$1" "$@" printf done test grep x=1 /usr/bin grep awk then awk done "$1" && | $(pwd)
+	-eu readonly /usr/bin sed grep "$1" /usr/bin $(pwd) | echo "$1" done
+	cd then done x=1 echo /usr/bin
+		sed grep x=1 printf sed
+		then "$1" x=1 local "$@" 2>/dev/null then grep sed awk --verbose cd grep "$@" $(pwd)
+	-eu -eu cd && grep ${HOME} awk
+		then 'quoted text' "$@" ${HOME} cd readonly
+then "$1" ${HOME} -eu 2>/dev/null readonly printf &&
+	sed test printf test local "$@" "$@" 'quoted text' |
+		local x=1 "$1" awk && sed 2>/dev/null printf /usr/bin awk 2>/dev/null
+		&& echo "$@" --verbose echo echo ${HOME} awk 'quoted text' ${HOME} --verbose
+	--verbose then x=1 && x=1 printf "$1"
+		awk 'quoted text' 'quoted text' printf 'quoted text'
+-eu && /usr/bin && test 'quoted text' "$@" done printf 2>/dev/null
+awk then && then sed cd /usr/bin /usr/bin
+	sed cd export grep grep cd "$1" 'quoted text' | printf "$1" --verbose x=1 |
+	$(pwd) $(pwd) | -eu then then sed ${HOME} echo $(pwd)
+cd local cd test test --verbose
+$(pwd) -eu grep echo && --verbose x=1 'quoted text' && && $(pwd)
+		echo echo export && 2>/dev/null export local sed
+	printf grep local echo /usr/bin
+-eu "$1" awk echo awk export --verbose
+	x=1 printf x=1 readonly awk | -eu printf
+	"$@" grep $(pwd) 2>/dev/null cd done "$1" sed test
+	local export --verbose done printf && test && -eu 2>/dev/null
+		sed echo readonly done "$1" ${HOME}
+echo done local grep "$@"
+		"$1" done echo ${HOME} cd export
+2>/dev/null local --verbose grep -eu x=1 awk && "$1" ${HOME}
+		sed "$1" $(pwd) done awk -eu local --verbose --verbose x=1 $(pwd) export
+"$@" -eu ${HOME} "$@" test /usr/bin readonly local printf
+		awk grep cd x=1 /usr/bin ${HOME} -eu cd then 2>/dev/null
+	sed grep && test "$1" readonly test awk local ${HOME} export cd echo printf
+	then 'quoted text' test done | x=1 && "$1" "$@" x=1 echo readonly
+/usr/bin cd awk awk ${HOME} awk echo grep
+awk printf | 'quoted text' test && echo --verbose
+		grep 2>/dev/null "$1" local grep -eu | readonly "$@" awk grep cd | /usr/bin local
+		&& "$1" "$1" awk grep local "$@" test grep
+cd then /usr/bin && then sed --verbose /usr/bin test -eu printf x=1 ${HOME}
+	cd 'quoted text' readonly -eu "$@" ${HOME} then x=1 echo "$1"
+	${HOME} 2>/dev/null ${HOME}
+	sed local ${HOME} -eu
+		/usr/bin awk sed local | then grep test
+	echo test local --verbose "$1" "$@" test printf test printf
+		x=1 echo "$@" 2>/dev/null sed
+		'quoted text' -eu then awk test && && local $(pwd) printf 'quoted text'
+readonly awk /usr/bin export
+		sed echo | 2>/dev/null "$1"
+		local 2>/dev/null 'quoted text' -eu printf test done 2>/dev/null
+		"$@" "$@" /usr/bin /usr/bin --verbose
+	done "$1" ${HOME} && sed 2>/dev/null && done "$1" done test export
+local local "$@" -eu readonly
+	--verbose --verbose cd "$1" echo done
+	grep grep awk && "$1" /usr/bin printf ${HOME} 2>/dev/null local 2>/dev/null 2>/dev/null
+$(pwd) $(pwd) sed done grep 'quoted text' grep /usr/bin $(pwd) 2>/dev/null then
+		test $(pwd) ${HOME} grep printf 'quoted text' "$@" echo ${HOME}
+	/usr/bin ${HOME} sed awk
+		x=1 | printf grep 2>/dev/null | cd then
+-eu "$1" cd cd sed awk ${HOME} "$1" echo cd "$@" awk echo /usr/bin
+done && x=1 'quoted text' 2>/dev/null /usr/bin local x=1 ${HOME} cd
+		-eu -eu 2>/dev/null x=1 test "$@" "$1" sed then done awk readonly &&
+		"$@" then local "$@"
+		printf ${HOME} "$@" sed local echo
+	'quoted text' done echo x=1 'quoted text' export
+	export then test "$@" 'quoted text' | ${HOME} -eu
+		2>/dev/null done printf
+echo "$1" test then export local 'quoted text' -eu -eu sed
+/usr/bin test printf x=1 && sed 2>/dev/null local export readonly
+		&& local && then awk $(pwd) cd | grep
+	x=1 sed -eu test --verbose local sed "$@" "$@" done | $(pwd) "$1" | printf
+/usr/bin then grep done --verbose
+		--verbose test $(pwd) sed awk printf awk echo
+printf /usr/bin sed /usr/bin
+local && && echo awk /usr/bin && 'quoted text'
+"$@" export readonly done 'quoted text' $(pwd)
+	"$@" printf "$1" ${HOME} | done && -eu $(pwd) local cd ${HOME}
+	then 'quoted text' readonly done "$@" local printf then 2>/dev/null local
+awk "$@" | test local --verbose test export && x=1 printf
+	then --verbose "$@" test && 2>/dev/null
+		/usr/bin echo test --verbose echo x=1 printf ${HOME}
+	cd 'quoted text' /usr/bin then then awk "$1" 'quoted text' --verbose
+		then grep "$@" then 2>/dev/null test
+grep export then -eu 2>/dev/null
+	| "$1" /usr/bin cd local sed
+	--verbose echo /usr/bin done "$1" done && && "$@" --verbose
+		test awk && "$@" ${HOME} | cd $(pwd) test readonly
+x=1 /usr/bin $(pwd) ${HOME} echo then grep && sed done local sed awk awk /usr/bin
+		then ${HOME} 'quoted text' awk x=1 test printf $(pwd) export --verbose export
+		export awk sed then $(pwd) cd -eu /usr/bin local
+		then x=1 "$1" test "$@" local printf grep export awk then | 'quoted text' "$@"
+		echo "$@" echo x=1 sed 'quoted text' echo awk | --verbose
+	-eu awk readonly local -eu x=1 ${HOME} ${HOME} awk readonly
+	"$@" cd cd 2>/dev/null grep test readonly -eu --verbose local -eu done sed echo
+done ${HOME} 'quoted text' export | grep
+	echo 2>/dev/null 'quoted text' "$1" && && 2>/dev/null $(pwd) done export
+x=1 "$1" then x=1 cd /usr/bin cd done $(pwd) awk awk sed export $(pwd)
+		$(pwd) && "$1" --verbose ${HOME} /usr/bin $(pwd) "$1" 'quoted text'
+	| cd cd 2>/dev/null done ${HOME} x=1 && && $(pwd) printf
+		local printf done 2>/dev/null export
+awk && grep -eu x=1 sed $(pwd) -eu "$@" sed 'quoted text'
+		grep $(pwd) "$1" x=1 readonly "$1" printf test
+		/usr/bin readonly ${HOME} 'quoted text' export "$@" -eu export
+		/usr/bin ${HOME} printf
+	done x=1 cd ${HOME} cd printf then "$@" grep
+		| && /usr/bin awk export local | cd | test readonly && cd 'quoted text' awk
+		${HOME} done ${HOME} 'quoted text' grep ${HOME} printf local grep 'quoted text'
+	-eu 2>/dev/null cd --verbose local echo local "$@" sed "$@" | 'quoted text' /usr/bin
+awk -eu && 'quoted text' then export readonly
+	local printf export test test printf local "$@" -eu
+		| then then printf sed --verbose sed 'quoted text' then
+		readonly readonly 2>/dev/null sed readonly 'quoted text' x=1 'quoted text' export
+	"$1" local export export -eu /usr/bin
+x=1 && && 'quoted text' $(pwd) grep /usr/bin 2>/dev/null cd |
+	test awk ${HOME} -eu done 2>/dev/null "$1" echo awk grep "$@" done
+	local printf "$@" echo 2>/dev/null export --verbose "$@" --verbose
+| 'quoted text' "$1" x=1 && printf local && -eu && grep
+	'quoted text' -eu /usr/bin --verbose echo --verbose
+--verbose export test
+		&& then x=1 done 'quoted text' local then 2>/dev/null grep "$1" then "$1" test
+		done test --verbose 'quoted text' cd 'quoted text'
+		&& readonly cd -eu echo
+		export "$1" grep printf
+export grep | | echo grep test
+		x=1 && "$1" -eu local test cd local grep cd done sed readonly -eu awk
+		readonly && readonly echo 2>/dev/null
+	--verbose --verbose 'quoted text' export test
+		grep local x=1 sed done --verbose && "$@"
+then done "$@" "$@" 'quoted text'
+2>/dev/null grep awk printf "$@" done "$1" readonly 2>/dev/null cd $(pwd)
+-eu -eu 'quoted text'
+	'quoted text' /usr/bin sed done --verbose "$@"
+"$1" echo -eu cd ${HOME} ${HOME} test "$1" ${HOME} $(pwd) ${HOME} 'quoted text'
+		export $(pwd) && "$1" printf --verbose /usr/bin awk -eu test then 2>/dev/null
+		awk local "$1" awk test cd cd
+		echo then && test done grep then
+	'quoted text' "$@" printf export
+	"$1" 2>/dev/null 'quoted text' "$@" /usr/bin -eu done export local echo test --verbose
+	echo "$1" awk readonly readonly sed printf awk printf /usr/bin echo 2>/dev/null
+		test | "$1" echo local -eu then printf -eu grep sed echo test printf
+		test grep --verbose readonly 2>/dev/null sed sed 2>/dev/null
+'quoted text' --verbose awk sed echo "$1" x=1 $(pwd) 2>/dev/null "$@" x=1 --verbose
+	'quoted text' awk readonly && -eu export | "$@" printf echo grep /usr/bin | ${HOME}
+	echo 'quoted text' $(pwd) readonly readonly
+sed | | "$@" echo "$@" echo sed /usr/bin
+		echo cd $(pwd) cd && echo $(pwd) --verbose cd /usr/bin done x=1 done "$@"
+printf test --verbose 'quoted text' local local cd
+done 2>/dev/null done then readonly ${HOME} awk ${HOME} | sed x=1 $(pwd) printf
+		printf /usr/bin 2>/dev/null "$@" done done readonly
+	"$1" echo awk done x=1
+		echo then test readonly test && done sed $(pwd) cd |
+		sed | grep cd | x=1 then /usr/bin local printf awk sed local local && echo
+		readonly done "$@" grep -eu local grep --verbose
+echo /usr/bin 2>/dev/null --verbose 'quoted text' x=1
+		"$@" $(pwd) $(pwd) && grep printf grep $(pwd) "$@" printf sed -eu
+${HOME} 'quoted text' 'quoted text' $(pwd) test test 'quoted text' 2>/dev/null
+test sed done then local 'quoted text'
+	${HOME} $(pwd) done --verbose then export readonly
+	awk done printf 'quoted text' x=1 cd --verbose done /usr/bin awk $(pwd)
+		"$1" echo "$@" cd | sed local 2>/dev/null
+	local -eu done "$1" 2>/dev/null
+		local export local "$1" export --verbose | readonly grep test
+--verbose test export ${HOME} 2>/dev/null grep ${HOME} local 2>/dev/null
+		awk && /usr/bin sed 2>/dev/null local printf
+&& readonly --verbose --verbose "$1" echo printf echo "$@" $(pwd) && local "$1"
+		-eu 'quoted text' printf /usr/bin done then export echo
+-eu cd printf "$@" ${HOME} done readonly local --verbose /usr/bin export export
+	'quoted text' export 2>/dev/null printf sed 2>/dev/null $(pwd)
+		grep test awk $(pwd) then ${HOME} local echo
+x=1 echo $(pwd) x=1 cd readonly done echo && $(pwd) then then $(pwd) test --verbose
+		&& printf printf cd cd printf readonly grep -eu readonly && sed export
+		export && && readonly export printf --verbose echo "$@" local --verbose printf
+| "$@" local 'quoted text' ${HOME} | done 2>/dev/null
+/usr/bin x=1 $(pwd) cd /usr/bin -eu ${HOME} printf sed
+"$@" test awk 2>/dev/null x=1 --verbose sed then export && sed
+	printf grep x=1 ${HOME} sed cd export --verbose
+	2>/dev/null done awk -eu 2>/dev/null
+	$(pwd) 'quoted text' ${HOME} then sed
+$(pwd) --verbose | /usr/bin "$1"
+		test sed "$@" x=1 grep "$1"
+	cd ${HOME} then test $(pwd) /usr/bin export
+echo test grep 'quoted text' --verbose grep
+-eu 2>/dev/null ${HOME} local && --verbose $(pwd) printf --verbose
+		"$1" cd done done printf /usr/bin test --verbose 'quoted text' 'quoted text'
+	"$@" printf sed x=1 'quoted text' /usr/bin | local export
+	'quoted text' | test cd local && cd local /usr/bin
+2>/dev/null export local awk done test test grep sed 'quoted text'
+		| && export printf readonly local readonly awk $(pwd) done echo local
+		local export 'quoted text' sed test
+echo x=1 -eu -eu ${HOME} sed readonly then 2>/dev/null
+	cd echo local test /usr/bin readonly echo test test /usr/bin "$@" sed $(pwd) sed
+		echo --verbose && "$@" readonly awk "$@" grep "$1"
+	--verbose x=1 cd printf cd | -eu echo printf /usr/bin ${HOME}
+	awk cd done | x=1 cd printf readonly 'quoted text' printf sed "$@" | cd
+		awk x=1 | readonly x=1 printf -eu
+	| export x=1 --verbose done "$@" $(pwd) 'quoted text'
+		then cd | /usr/bin sed echo "$1" cd printf && grep
+		printf ${HOME} grep sed | 'quoted text' 'quoted text'
+	awk 'quoted text' printf awk "$1" $(pwd) | ${HOME} $(pwd) done
+		"$1" ${HOME} ${HOME} /usr/bin sed echo test | done
+	${HOME} grep readonly echo --verbose
+/usr/bin "$@" /usr/bin echo x=1 sed | "$1" local readonly
+		readonly cd 2>/dev/null echo readonly echo -eu x=1 sed | sed
+	&& ${HOME} local local readonly -eu echo printf awk awk export readonly awk cd
+		test ${HOME} x=1 2>/dev/null test
+$(pwd) grep --verbose test grep -eu | then $(pwd) $(pwd) done "$1" awk grep local
+		grep -eu printf printf cd --verbose done local cd echo &&
+printf --verbose x=1 cd readonly | printf $(pwd) awk then 2>/dev/null echo printf
+awk 2>/dev/null done /usr/bin
+	/usr/bin printf && 'quoted text' 'quoted text' sed awk echo ${HOME}
+	test readonly 2>/dev/null "$@" x=1 export -eu readonly grep test "$@" /usr/bin ${HOME}
+	sed export local test export grep awk grep 2>/dev/null cd readonly
+	export grep then x=1 /usr/bin readonly
+done "$@" -eu -eu ${HOME} then /usr/bin printf echo ${HOME} 2>/dev/null
+	readonly "$@" echo /usr/bin echo -eu | $(pwd)
+readonly "$1" then 'quoted text' -eu
+	cd done then /usr/bin done 2>/dev/null test grep done
+/usr/bin readonly -eu | export
+done x=1 test grep 2>/dev/null -eu then awk "$@"
+${HOME} done printf 2>/dev/null && && grep --verbose
+		| $(pwd) grep grep && 2>/dev/null "$1" local sed done $(pwd) echo
+	2>/dev/null then /usr/bin /usr/bin x=1 awk echo x=1 awk
+		test done /usr/bin x=1 done grep test echo 'quoted text' local
+	awk echo "$@" readonly test
+		then grep ${HOME} ${HOME} ${HOME} echo "$@" ${HOME} $(pwd)
+test cd --verbose && printf
+	'quoted text' --verbose grep sed then cd printf 2>/dev/null echo --verbose sed
+	${HOME} "$@" $(pwd) test -eu 'quoted text'
+		awk $(pwd) 'quoted text' "$@" test export "$1" then awk ${HOME}
+	-eu $(pwd) then "$1" cd then /usr/bin done --verbose
+		sed grep grep cd printf ${HOME} && readonly x=1 cd grep awk 2>/dev/null
+cd $(pwd) "$1" /usr/bin echo | 'quoted text' sed done "$@" done -eu &&
+awk -eu && done "$1" done -eu | printf x=1 2>/dev/null ${HOME}
+awk readonly x=1 printf readonly done printf && test "$@" 2>/dev/null && &&
+${HOME} | -eu $(pwd) /usr/bin | $(pwd) sed $(pwd) ${HOME} $(pwd)
+	cd cd done "$1" 2>/dev/null | test export && echo readonly
+	sed x=1 readonly x=1 echo readonly
+	echo echo readonly printf x=1 && x=1 2>/dev/null local cd cd -eu ${HOME}
+	&& "$@" done test "$1" grep && export ${HOME} export
+	x=1 "$1" grep local ${HOME} grep grep ${HOME} | &&
+		&& /usr/bin cd && -eu local
+awk 'quoted text' done grep 2>/dev/null export x=1 x=1 | echo "$@" 2>/dev/null done
+		readonly printf grep "$@"
+	cd "$@" cd "$1" && && x=1 local readonly echo then sed grep x=1 2>/dev/null test
+	printf done done 'quoted text' readonly ${HOME} x=1 test awk "$1"
+	done && "$1" $(pwd) /usr/bin /usr/bin
+		$(pwd) grep echo /usr/bin cd 'quoted text'
+	'quoted text' grep -eu test printf x=1
+printf sed "$@" -eu && sed then 'quoted text' test local printf
+--verbose local $(pwd) grep
+	cd $(pwd) 'quoted text' readonly -eu 'quoted text' printf -eu x=1 echo "$1"
+x=1 x=1 /usr/bin export awk ${HOME} printf
+awk --verbose printf then 'quoted text' && 2>/dev/null printf readonly "$@" cd cd
+readonly | ${HOME} -eu --verbose
+done grep /usr/bin $(pwd) export cd done test export "$1" | echo printf 2>/dev/null
+		-eu awk $(pwd) grep ${HOME} awk printf
+readonly | then "$1" $(pwd) awk ${HOME} -eu
+		&& export done ${HOME} then ${HOME} awk cd awk x=1 --verbose -eu printf sed
+		2>/dev/null done ${HOME} then printf -eu -eu $(pwd) test --verbose
+		readonly --verbose sed local local readonly then | $(pwd)
+	x=1 x=1 done cd echo readonly awk x=1 2>/dev/null $(pwd)
+done sed test "$1" 'quoted text'
+		then "$@" x=1 --verbose export then --verbose sed awk cd then "$@" 2>/dev/null test
+		awk && done x=1 export then
+readonly grep export done "$1" --verbose grep grep
+		&& && readonly readonly --verbose
+		local echo printf local && grep sed ${HOME} awk grep
+	echo -eu grep --verbose x=1 then test "$1"
+		'quoted text' -eu awk export
+		--verbose /usr/bin --verbose cd sed -eu
+	2>/dev/null sed "$@" echo readonly 'quoted text'
+local awk 'quoted text' && "$@" && && 2>/dev/null done ${HOME} "$1" cd /usr/bin
+	"$@" done sed "$1" "$@" 2>/dev/null
+		cd echo --verbose /usr/bin /usr/bin done && readonly
+export echo "$@" $(pwd) awk printf printf printf
+		-eu printf local $(pwd) local -eu -eu ${HOME} ${HOME} sed sed
+	awk then 'quoted text' | printf x=1 && readonly 'quoted text'
+		test sed grep ${HOME} test ${HOME}
+		"$@" done 'quoted text' 2>/dev/null echo x=1 --verbose 'quoted text' $(pwd) readonly
+		| x=1 printf sed ${HOME} 'quoted text'
+	&& $(pwd) -eu test test test sed echo local export "$@"
+/usr/bin $(pwd) x=1 --verbose grep 'quoted text' --verbose && -eu test 'quoted text'
+		"$1" then $(pwd) x=1 -eu
+awk --verbose readonly --verbose then done printf then /usr/bin sed
+	sed "$1" export done "$@" done x=1
+| echo awk export /usr/bin awk "$1" export
+		&& /usr/bin $(pwd) && &&
+	echo | awk test readonly export readonly done 2>/dev/null echo cd test
+		awk printf "$@" && ${HOME} test -eu cd awk printf /usr/bin
+done sed local "$1" /usr/bin
+x=1 -eu "$@" -eu printf grep awk then ${HOME} sed
+then printf x=1 printf done
+		done "$@" export then "$@" 'quoted text' then && done awk && awk "$1" "$@" test
+		test ${HOME} grep echo $(pwd) "$@"
+'quoted text' local $(pwd) /usr/bin printf done | "$@"
+	awk -eu 2>/dev/null "$@" x=1 then readonly | sed
+		printf $(pwd) printf 'quoted text' then then
+	"$@" --verbose --verbose then ${HOME} x=1 echo cd --verbose $(pwd)
+		"$1" printf --verbose sed export 'quoted text' 2>/dev/null test $(pwd) ${HOME}
+	x=1 then --verbose echo ${HOME} && x=1 | test readonly test
+sed printf printf --verbose "$1" printf /usr/bin readonly /usr/bin x=1
+	$(pwd) && echo -eu "$@" echo test ${HOME}
+$(pwd) --verbose 'quoted text' test then test
+test | $(pwd) $(pwd) cd grep test $(pwd) --verbose x=1 echo /usr/bin
+		${HOME} then sed echo done 2>/dev/null ${HOME} grep | printf "$@" cd --verbose
+	awk -eu && done 2>/dev/null printf done | cd echo export | grep 'quoted text'
+		x=1 then x=1 done readonly $(pwd) sed grep then printf /usr/bin done local ${HOME}
+sed /usr/bin 'quoted text' ${HOME} test cd grep x=1
+		2>/dev/null then awk grep --verbose local readonly | /usr/bin sed "$@" test
+	echo printf sed awk test
+		-eu local then $(pwd) awk 'quoted text'
+		'quoted text' /usr/bin --verbose awk $(pwd) | -eu export $(pwd) readonly "$1"
+export -eu then "$1" ${HOME} --verbose "$@" "$1"
+	grep /usr/bin --verbose "$@"
+	&& sed "$1" export ${HOME} x=1 x=1 export sed
+		${HOME} x=1 local readonly x=1
+sed "$1" echo | --verbose done test echo awk export
+	-eu "$1" && export cd 2>/dev/null x=1 "$@" printf cd local 'quoted text'
+$(pwd) x=1 | "$@" awk grep awk 'quoted text' x=1 awk "$1"
+	printf 2>/dev/null 'quoted text' "$1" then $(pwd) "$1" echo printf x=1 -eu -eu
+		| | printf sed ${HOME} grep test printf
+readonly | && then --verbose export printf
+		--verbose $(pwd) $(pwd) && local |
+		echo 'quoted text' cd && $(pwd) done printf 2>/dev/null
+export ${HOME} x=1 done printf && "$@" 'quoted text' export
+	awk && readonly echo x=1 test done -eu | "$1" $(pwd) $(pwd) && readonly cd printf
+"$1" $(pwd) then test export $(pwd) --verbose printf grep test | 2>/dev/null test
+		'quoted text' echo export test echo 2>/dev/null ${HOME} && cd | done "$@"
+		local echo | local then cd sed
+	local --verbose then --verbose
+done printf local test readonly "$@" export awk "$@"
+$(pwd) 2>/dev/null 'quoted text'
+"$@" cd x=1 -eu then
+	${HOME} $(pwd) cd -eu done echo -eu 2>/dev/null test "$1" then printf $(pwd)
+'quoted text' local $(pwd) test export | then export sed 'quoted text' grep
+test -eu -eu then ${HOME} "$1" done readonly "$@" | $(pwd) ${HOME}
+		done "$@" "$@" /usr/bin /usr/bin
+		"$1" 2>/dev/null local --verbose 2>/dev/null "$@" readonly 2>/dev/null
+		2>/dev/null local then export x=1 && $(pwd) test | 2>/dev/null awk /usr/bin
+		${HOME} readonly grep export --verbose grep $(pwd) --verbose "$@" grep ${HOME}
+		/usr/bin 2>/dev/null 2>/dev/null /usr/bin "$@" $(pwd)
+	--verbose done "$@" export cd && 2>/dev/null readonly "$1" local
+$(pwd) sed export grep readonly --verbose $(pwd)
+		grep "$@" readonly && && /usr/bin $(pwd) "$1" -eu printf /usr/bin
+cd done echo done &&
+		echo -eu local 'quoted text' local ${HOME} $(pwd) done
+grep && export -eu done echo 'quoted text'
+		test "$@" awk done $(pwd) /usr/bin --verbose grep "$@" readonly echo echo printf
+2>/dev/null --verbose awk done 2>/dev/null
+	| then 2>/dev/null echo test && export done /usr/bin sed local
+		2>/dev/null echo done -eu ${HOME}
+		grep readonly 2>/dev/null then "$1" sed done "$@" then 2>/dev/null
+		done x=1 && /usr/bin done awk /usr/bin /usr/bin done done ${HOME} grep export then
+local done 'quoted text' -eu x=1 cd 2>/dev/null
+		readonly x=1 local awk readonly $(pwd) 2>/dev/null local readonly then 2>/dev/null
+	echo 'quoted text' test
+		/usr/bin grep export "$@" done 'quoted text' then test local grep
+		local printf sed readonly | ${HOME} export "$@" readonly /usr/bin awk
+	-eu cd test ${HOME} "$1" 2>/dev/null awk awk awk grep /usr/bin echo grep | test
+	echo awk 2>/dev/null echo readonly x=1 local 'quoted text'
+		$(pwd) grep 2>/dev/null
+local awk | printf readonly
+		--verbose && echo $(pwd) sed then readonly done local $(pwd) awk x=1
+		echo "$1" done /usr/bin printf grep x=1 then test &&
+		| echo done | /usr/bin grep | done test test
+	2>/dev/null printf then -eu 'quoted text' cd /usr/bin printf sed
+	x=1 awk /usr/bin | readonly x=1 test 2>/dev/null awk 2>/dev/null "$@" "$1"
+	/usr/bin printf awk awk 2>/dev/null cd $(pwd) | cd test
+	printf $(pwd) | $(pwd) readonly test | cd --verbose grep --verbose
+	x=1 && then /usr/bin 2>/dev/null echo done "$1" && && --verbose
+	"$@" 2>/dev/null cd local /usr/bin local && && printf
+	/usr/bin x=1 test /usr/bin 2>/dev/null "$1" x=1 printf export
+		done x=1 cd done echo --verbose sed | then then x=1 $(pwd) printf $(pwd)
+	${HOME} && grep echo export export 'quoted text' then done export echo test export
+	"$@" awk test echo -eu 'quoted text' -eu grep local x=1 echo local cd cd local
+	-eu grep awk ${HOME} echo export sed && | 2>/dev/null awk 'quoted text'
+test | readonly x=1 then --verbose readonly export awk
+&& cd /usr/bin $(pwd) 2>/dev/null --verbose sed printf grep local echo 2>/dev/null
+		grep $(pwd) readonly /usr/bin readonly
+		-eu export $(pwd) local && awk grep |
+		"$1" /usr/bin /usr/bin printf x=1 then export export x=1 --verbose ${HOME} local
+	-eu "$@" then export printf done "$@" -eu
+awk echo && 'quoted text' awk sed
+"$1" $(pwd) test test
+	grep -eu | 'quoted text' then ${HOME} $(pwd) then
+| sed sed sed x=1 local 2>/dev/null printf $(pwd) awk /usr/bin sed 'quoted text'
+x=1 export $(pwd) --verbose && 'quoted text'
+'quoted text' /usr/bin && && export echo && "$1" /usr/bin
+	2>/dev/null test cd cd readonly -eu | 2>/dev/null printf test then
+		echo "$@" 2>/dev/null cd "$@" printf sed $(pwd) export "$@"
+		sed $(pwd) 'quoted text' done /usr/bin sed printf 2>/dev/null 2>/dev/null readonly
+	grep x=1 | grep /usr/bin sed 2>/dev/null
+	then "$@" echo && then -eu $(pwd) -eu -eu -eu awk done grep
+	&& test | 'quoted text' /usr/bin "$1" grep 2>/dev/null then printf cd "$@" then
+		"$@" && readonly grep $(pwd) done /usr/bin sed grep export local 'quoted text'
+		then readonly 'quoted text' "$1" |
+		then --verbose readonly 2>/dev/null "$1"
+cd x=1 done -eu -eu 2>/dev/null /usr/bin
+	readonly 2>/dev/null awk awk
+		sed $(pwd) grep local | grep | /usr/bin 'quoted text' local done awk
+		done "$@" ${HOME} --verbose readonly -eu -eu done -eu sed cd |
+	local export "$@" 2>/dev/null 'quoted text' export test
+		cd x=1 && readonly 2>/dev/null 2>/dev/null 'quoted text'
+		x=1 /usr/bin test ${HOME} ${HOME} echo -eu --verbose printf
+	awk /usr/bin $(pwd) ${HOME} grep $(pwd) "$1" $(pwd)
+${HOME} sed --verbose --verbose x=1 done -eu ${HOME} x=1
+		x=1 "$@" then cd --verbose --verbose /usr/bin "$@" echo x=1
+grep local x=1 grep echo local export "$1" export done x=1
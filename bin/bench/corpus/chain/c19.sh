@@ -0,0 +1,2001 @@
+	${HOME} /usr/bin x=1 'quoted text'
+x=1 then test "$@" --verbose readonly awk grep -eu
+	$(pwd) test awk echo export readonly $(pwd) export then && -eu test x=1 /usr/bin
+	export then grep "$@" local
+"$1" echo awk --verbose | "$1" "$1" sed "$1" echo done
+		export 'quoted text' /usr/bin --verbose sed awk export x=1 awk done sed ${HOME}
+'quoted text' readonly 'quoted text' grep awk printf
+readonly "$@" sed printf cd "$@" export $(pwd) ${HOME} 2>/dev/null
+${HOME} readonly grep /usr/bin
+	grep sed sed grep local
+		export echo cd ${HOME} readonly && ${HOME} -eu ${HOME}
+	'quoted text' $(pwd) --verbose printf
+printf done echo | 2>/dev/null cd "$1" echo sed
+		-eu -eu grep /usr/bin sed --verbose x=1 export echo 2>/dev/null awk
+$(pwd) done /usr/bin && export "$1" test
+	test /usr/bin echo printf x=1 then -eu |
+		"$1" then -eu echo export export "$@" "$@" -eu ${HOME} $(pwd) export
+	test then cd "$@" printf readonly &&
+		printf cd export /usr/bin 'quoted text' && cd cd then grep --verbose grep | export
+	cd done grep && $(pwd)
+"$@" | --verbose -eu then x=1 printf
+	printf --verbose grep grep x=1 awk ${HOME} --verbose printf "$1" /usr/bin
+		grep readonly 'quoted text' $(pwd) "$1" awk cd test /usr/bin
+		${HOME} done grep then --verbose ${HOME} "$1" ${HOME}
+		then awk 'quoted text' sed | echo awk -eu && local --verbose
+2>/dev/null grep test awk x=1 grep && grep "$1" readonly --verbose test
+2>/dev/null -eu echo && ${HOME} ${HOME} awk &&
+		"$@" $(pwd) x=1 printf readonly readonly /usr/bin
+	2>/dev/null cd --verbose
+		--verbose "$@" | -eu printf && | 'quoted text' then test |
+	grep && ${HOME} /usr/bin sed 'quoted text' sed grep && echo
+		readonly awk -eu awk --verbose ${HOME}
+done 2>/dev/null 2>/dev/null 'quoted text'
+	/usr/bin x=1 awk -eu -eu then sed echo x=1 export -eu cd echo
+${HOME} /usr/bin local ${HOME} -eu sed readonly --verbose && --verbose $(pwd)
+x=1 "$1" $(pwd) x=1 -eu x=1 export sed | ${HOME} test ${HOME} 'quoted text' /usr/bin
+then -eu printf awk | done grep | then ${HOME} then export readonly
+	/usr/bin x=1 readonly 2>/dev/null && readonly "$1" "$1" local awk x=1
+		awk | && | echo 'quoted text' -eu |
+local $(pwd) x=1 then local echo && awk /usr/bin
+		"$@" | awk sed && cd then test | x=1 x=1 'quoted text' $(pwd)
+printf -eu -eu echo sed x=1 $(pwd) readonly readonly done awk done readonly
+		| "$1" export 2>/dev/null printf printf && readonly ${HOME}
+-eu && test echo readonly "$1" echo sed echo x=1
+awk readonly /usr/bin /usr/bin echo x=1 printf "$@" local -eu local 'quoted text'
+done export readonly local
+	echo echo cd --verbose grep | $(pwd) printf "$@" local && cd 2>/dev/null test
+| "$1" "$1" readonly local x=1 "$1" $(pwd) /usr/bin
+		then 2>/dev/null cd $(pwd)
+${HOME} done $(pwd) ${HOME} then grep export
+"$1" printf | export readonly export echo -eu $(pwd) awk
+printf "$@" readonly "$1" $(pwd) sed "$1" cd "$1" export
+	-eu --verbose awk sed | export sed
+	test grep && done x=1 test --verbose "$1" 'quoted text' printf
+		done "$@" 2>/dev/null ${HOME} cd done $(pwd)
+		x=1 "$1" && x=1 export awk -eu grep && $(pwd) then -eu 2>/dev/null "$@" sed
+awk --verbose echo done -eu | awk $(pwd) /usr/bin --verbose "$1"
+		${HOME} then readonly export then readonly export
+		grep done /usr/bin awk printf test
+	$(pwd) "$@" $(pwd) /usr/bin "$@" test 2>/dev/null echo 'quoted text' | && $(pwd)
+	&& --verbose echo ${HOME} --verbose then
+sed echo | 2>/dev/null done grep -eu export && done
+	-eu $(pwd) /usr/bin x=1 sed x=1 cd --verbose --verbose --verbose -eu
+	--verbose printf "$@" ${HOME} export && awk && local | x=1 done 'quoted text'
+		awk printf 2>/dev/null "$@" local
+awk $(pwd) cd "$1" "$1" printf
+cd 'quoted text' x=1 readonly then $(pwd) test
+	export done cd readonly cd printf grep test export export
+sed printf /usr/bin $(pwd) printf "$@" | echo export
+	| cd export local echo test cd done grep --verbose $(pwd) 2>/dev/null
+'quoted text' awk | && export
+	sed | ${HOME} readonly local
+		x=1 local awk readonly $(pwd) grep
+$(pwd) $(pwd) /usr/bin $(pwd) test /usr/bin
+		2>/dev/null 'quoted text' 2>/dev/null
+		readonly export "$@" ${HOME} cd 2>/dev/null echo ${HOME} readonly && sed
+	| sed -eu | awk readonly | export | local sed
+	--verbose "$1" ${HOME} echo /usr/bin test /usr/bin 'quoted text' --verbose sed
+		test 2>/dev/null "$1" /usr/bin ${HOME} 'quoted text'
+| /usr/bin && 2>/dev/null
+	export done /usr/bin "$1" ${HOME} "$@" sed awk $(pwd)
+		2>/dev/null done --verbose && ${HOME} done -eu grep local cd 'quoted text'
+	${HOME} -eu x=1 ${HOME}
+'quoted text' test sed sed then cd && x=1 grep sed | printf
+		readonly then then ${HOME} "$@" local
+--verbose --verbose "$@" then test then ${HOME}
+test /usr/bin 2>/dev/null -eu export sed
+	--verbose ${HOME} local printf
+		-eu ${HOME} sed x=1 'quoted text' 'quoted text' "$@" ${HOME}
+		test -eu | grep local awk
+	printf local cd x=1 $(pwd) then "$1" local ${HOME} printf -eu --verbose
+	/usr/bin test && cd awk cd then echo --verbose echo 'quoted text' awk | grep
+	printf -eu "$@" 2>/dev/null grep 2>/dev/null && && then local readonly
+		-eu | x=1 /usr/bin test --verbose 2>/dev/null printf then then echo
+		'quoted text' -eu /usr/bin test done local "$@" /usr/bin cd
+		cd grep readonly 'quoted text' export
+		| readonly -eu export done "$1" $(pwd)
+	"$1" && grep test local cd $(pwd) test --verbose printf $(pwd) 'quoted text'
+		export "$@" local echo "$@" export then grep /usr/bin "$@" /usr/bin
+	printf 2>/dev/null grep
+	"$@" sed && local awk | x=1 && ${HOME} test local 'quoted text'
+	"$1" export awk echo -eu then $(pwd) readonly "$@" cd 2>/dev/null echo
+--verbose grep grep then "$@" cd sed x=1 grep printf "$@" cd cd sed echo -eu --verbose
+		local cd "$1" grep /usr/bin "$@" | test cd 'quoted text' done printf
+	grep 'quoted text' readonly export then echo grep then | export cd printf
+	printf "$@" done "$@" export "$1" readonly
+		test --verbose sed "$@" ${HOME} then 'quoted text' --verbose -eu && && echo done
+		grep readonly readonly 2>/dev/null
+/usr/bin readonly ${HOME} /usr/bin
+	| "$@" "$@" done echo readonly 'quoted text'
+local x=1 done grep /usr/bin && then x=1 cd -eu cd 2>/dev/null
+		readonly ${HOME} echo |
+		"$1" $(pwd) ${HOME} done $(pwd) grep export sed ${HOME} ${HOME} 2>/dev/null
+		$(pwd) cd printf export ${HOME} awk x=1 printf done -eu printf
+"$@" ${HOME} done readonly && x=1 export local
+x=1 'quoted text' "$@" printf ${HOME} "$@" ${HOME} /usr/bin readonly /usr/bin
+	then | local then then "$@"
+		grep awk done && "$1" export then printf 2>/dev/null /usr/bin sed ${HOME} $(pwd)
+		${HOME} readonly export 2>/dev/null "$@" /usr/bin sed cd
+	export readonly export readonly echo $(pwd) cd done export grep /usr/bin -eu
+&& | export sed done /usr/bin -eu cd "$@" && /usr/bin --verbose done
+	printf && ${HOME} -eu
+	/usr/bin done | readonly export export "$@" echo x=1 -eu $(pwd)
+	export test sed test grep 'quoted text' -eu 2>/dev/null done printf 2>/dev/null
+		2>/dev/null then "$1" local awk test /usr/bin "$@" /usr/bin
+		"$@" -eu then | 'quoted text'
+		done "$@" ${HOME} 2>/dev/null printf /usr/bin "$1" x=1 "$1" x=1
+	x=1 readonly && readonly $(pwd)
+&& grep echo 2>/dev/null echo printf && -eu echo readonly $(pwd) echo
+		echo 2>/dev/null 'quoted text' ${HOME} "$@"
+	local $(pwd) --verbose echo grep test awk awk printf printf -eu then ${HOME} "$1"
+	${HOME} done done done local readonly sed then -eu x=1 x=1 'quoted text'
+'quoted text' sed echo
+test 'quoted text' echo test then echo cd awk test
+cd local && | printf x=1 ${HOME} --verbose x=1 grep readonly then ${HOME}
+		awk done export "$1" 'quoted text' test echo then echo readonly && "$@" &&
+	-eu "$@" --verbose /usr/bin
+	readonly export 2>/dev/null && "$1" "$@" /usr/bin "$@"
+		echo export printf "$1" test ${HOME} "$@"
+		'quoted text' done done done 'quoted text'
+		awk | $(pwd) $(pwd) then x=1 readonly $(pwd)
+		cd 2>/dev/null done sed printf done awk test && echo ${HOME} local then
+		readonly awk readonly cd test export --verbose done sed 2>/dev/null cd echo
+export ${HOME} local done
+	awk && local x=1 && $(pwd) printf /usr/bin "$@" 'quoted text' && && 'quoted text'
+printf && x=1 "$@" then cd 2>/dev/null 2>/dev/null done
+	printf done 2>/dev/null cd $(pwd) export
+		readonly export --verbose | awk x=1 done ${HOME}
+		echo then cd /usr/bin printf sed test /usr/bin
+	&& /usr/bin ${HOME} -eu 2>/dev/null readonly
+	local && "$1" grep echo "$1" 'quoted text' grep "$1"
+	'quoted text' echo grep /usr/bin -eu cd test
+	cd "$@" ${HOME} 2>/dev/null cd x=1 export test export 2>/dev/null awk | && x=1
+&& local done "$@" 'quoted text'
+	'quoted text' export done test then --verbose grep grep grep && export "$@"
+	done 'quoted text' ${HOME} local sed sed printf
+		2>/dev/null x=1 'quoted text' ${HOME} x=1 2>/dev/null /usr/bin sed "$1"
+	$(pwd) --verbose "$1" then x=1 grep
+		/usr/bin awk grep $(pwd) "$1" x=1 "$@" && x=1 printf 'quoted text'
+	export grep then ${HOME} printf
+	$(pwd) readonly export done /usr/bin echo $(pwd) sed
+	export test done -eu --verbose "$1" awk -eu readonly then test printf
+	${HOME} ${HOME} "$1" then then x=1 | cd done awk
+cd then local awk "$1" local | 'quoted text' awk "$@" --verbose export
+	readonly awk local ${HOME}
+	/usr/bin cd && "$1" done sed readonly echo -eu export echo grep /usr/bin --verbose
+/usr/bin $(pwd) readonly
+$(pwd) ${HOME} x=1 echo cd && 'quoted text' local /usr/bin $(pwd) ${HOME} --verbose
+"$@" "$1" export awk 2>/dev/null grep 'quoted text'
+	"$1" /usr/bin /usr/bin $(pwd) | test printf readonly local export x=1 x=1 "$@" cd
+| | $(pwd) 'quoted text' cd && /usr/bin "$@" then x=1 echo awk
+	--verbose /usr/bin 'quoted text' | printf
+		awk -eu 'quoted text' x=1 sed echo export $(pwd) readonly
+		"$1" 'quoted text' ${HOME} local cd
+'quoted text' sed | awk then
+		readonly awk --verbose 'quoted text' echo local
+echo "$@" echo sed x=1 readonly export /usr/bin sed local 'quoted text' 2>/dev/null
+	| then awk done test ${HOME} 2>/dev/null then cd test printf
+	--verbose echo $(pwd) ${HOME} readonly printf && export then -eu readonly && &&
+		--verbose readonly echo "$@" "$@" sed awk x=1 cd done readonly
+readonly ${HOME} "$1" -eu x=1
+readonly local "$@" cd grep x=1 'quoted text' done test readonly
+sed ${HOME} awk done 'quoted text'
+		&& local echo ${HOME} printf cd export sed -eu --verbose printf printf export |
+		2>/dev/null grep "$1" | echo "$1" cd sed echo x=1 local 'quoted text'
+		done cd $(pwd) x=1 --verbose awk
+		2>/dev/null cd 2>/dev/null readonly 'quoted text'
+		x=1 && done "$@" && && "$1" local then ${HOME} awk 'quoted text' local | readonly
+		| | 'quoted text' 2>/dev/null printf "$@" done | test $(pwd) local readonly
+&& done export sed | echo $(pwd) awk "$1" then
+test echo 2>/dev/null && then "$@" ${HOME} then awk x=1 'quoted text' $(pwd) --verbose
+sed | grep --verbose "$@" then && && ${HOME} readonly printf cd "$@" && printf
+	| 'quoted text' printf --verbose cd export echo then sed --verbose
+"$@" x=1 then readonly readonly /usr/bin readonly
+	--verbose "$@" printf "$@" printf
+		awk export grep "$1" && echo done $(pwd) then "$@" done local local readonly
+$(pwd) sed echo export "$@" readonly 'quoted text' "$@"
+--verbose | grep then 2>/dev/null sed "$@" awk --verbose export
+		-eu -eu && awk ${HOME} cd local test ${HOME}
+	export export --verbose
+	$(pwd) x=1 -eu then sed
+		test test then /usr/bin then && x=1 then test sed ${HOME} x=1 sed local
+		done && -eu ${HOME} 'quoted text' "$@" printf export
+2>/dev/null export echo "$1"
+	| awk then | sed export | printf 2>/dev/null x=1 awk 2>/dev/null local
+		${HOME} 'quoted text' x=1 then
+| grep && --verbose "$@" echo && && | 'quoted text'
+	$(pwd) printf && echo local then local && 'quoted text'
+x=1 done readonly then done awk grep done /usr/bin test /usr/bin
+"$1" grep "$1" test readonly
+"$1" ${HOME} local -eu cd "$1"
+		readonly 'quoted text' cd
+grep "$@" --verbose x=1 export readonly printf local --verbose /usr/bin
+	awk echo sed 2>/dev/null --verbose
+test "$@" -eu 2>/dev/null then grep echo awk export $(pwd) 2>/dev/null
+readonly then ${HOME} done && export sed readonly /usr/bin | ${HOME} "$1" 2>/dev/null
+		then echo -eu echo 'quoted text' cd -eu export "$1" readonly cd
+2>/dev/null /usr/bin $(pwd) local
+	/usr/bin /usr/bin 'quoted text' x=1 'quoted text' then test 2>/dev/null
+		| /usr/bin cd x=1 /usr/bin export local echo && "$1" 'quoted text' $(pwd)
+	&& x=1 done done echo done x=1 'quoted text' cd readonly done done local --verbose
+		2>/dev/null echo done x=1 "$@"
+	printf 'quoted text' printf /usr/bin readonly
+	export /usr/bin --verbose test printf echo
+		/usr/bin cd 'quoted text' readonly ${HOME} /usr/bin test grep printf
+	"$@" readonly | 'quoted text' grep done x=1 printf --verbose $(pwd)
+	printf then "$1" printf then sed
+sed | export echo printf $(pwd) done sed printf /usr/bin then test
+	2>/dev/null ${HOME} readonly /usr/bin -eu awk export
+printf ${HOME} -eu awk printf echo ${HOME} -eu sed test done awk
+		sed sed "$1" awk 'quoted text' 'quoted text' && "$@" -eu | -eu sed --verbose
+	local 2>/dev/null grep --verbose 2>/dev/null "$1"
+		echo readonly && /usr/bin printf 2>/dev/null
+		then && x=1 printf 'quoted text'
+		echo | | ${HOME} done done && -eu
+	printf -eu && printf printf "$@" readonly grep grep ${HOME} sed printf then done
+		cd ${HOME} local ${HOME} ${HOME}
+x=1 grep export /usr/bin ${HOME}
+${HOME} cd readonly grep test -eu x=1 $(pwd) then ${HOME} printf cd ${HOME}
+--verbose $(pwd) export local cd export done 'quoted text' test printf done 'quoted text'
+/usr/bin echo 'quoted text' 'quoted text'
+	-eu && local --verbose
+		$(pwd) && sed awk test 'quoted text' readonly -eu readonly cd done then
+	then | cd | "$@" --verbose echo | local grep
+printf cd -eu "$1" sed readonly local -eu sed export printf
+-eu local printf 'quoted text' x=1 $(pwd) echo then 'quoted text' local readonly
+then 'quoted text' "$1" printf 'quoted text'
+		2>/dev/null test "$1" local $(pwd) printf local
+	echo sed "$1" printf --verbose x=1 /usr/bin echo /usr/bin |
+printf $(pwd) 2>/dev/null $(pwd) ${HOME} awk printf /usr/bin | cd /usr/bin
+awk --verbose readonly test 'quoted text'
+		sed 2>/dev/null 'quoted text' "$@" readonly /usr/bin x=1 printf readonly
+2>/dev/null /usr/bin readonly x=1 -eu readonly ${HOME} "$1"
+		$(pwd) --verbose printf grep export
+		--verbose grep "$1" export
+${HOME} echo -eu "$1" |
+$(pwd) 'quoted text' echo /usr/bin && $(pwd) echo grep 2>/dev/null
+--verbose local "$@" sed | | $(pwd) export local then && cd done readonly
+"$1" /usr/bin readonly local then cd -eu
+		-eu printf printf 'quoted text' test "$@" -eu grep test -eu ${HOME}
+	"$@" printf "$@" 2>/dev/null /usr/bin export sed
+| echo test grep | ${HOME} done ${HOME} printf local ${HOME} sed --verbose
+		echo && local test | awk "$@" echo /usr/bin export
+		'quoted text' 2>/dev/null printf
+	local "$1" cd then printf grep cd 2>/dev/null
+export printf --verbose
+	&& $(pwd) -eu | grep "$@" sed /usr/bin 2>/dev/null export cd readonly
+cd 'quoted text' 2>/dev/null
+	"$1" printf $(pwd) $(pwd) test then 2>/dev/null readonly x=1 test
+export test printf awk cd -eu grep | $(pwd) then awk $(pwd) $(pwd)
+		awk --verbose grep /usr/bin 2>/dev/null
+		local $(pwd) --verbose export "$1" ${HOME} local then awk
+grep ${HOME} 'quoted text' "$1" done "$@" sed x=1 ${HOME} $(pwd) &&
+echo && grep test printf
+export "$@" --verbose "$1" /usr/bin grep -eu ${HOME}
+		${HOME} done "$@" 'quoted text' | ${HOME} "$@" done readonly
+	-eu | cd && cd x=1 2>/dev/null $(pwd)
+	'quoted text' readonly | "$1" echo awk awk readonly "$1" 'quoted text' $(pwd) $(pwd)
+	awk printf readonly cd $(pwd) grep printf /usr/bin --verbose "$@" | awk then &&
+	cd done done cd export -eu printf | export "$@" grep
+	"$@" awk /usr/bin echo ${HOME} export --verbose $(pwd)
+		test export x=1 x=1 grep local ${HOME} | /usr/bin --verbose
+then $(pwd) test -eu done --verbose
+	grep sed then then x=1 printf then --verbose -eu 2>/dev/null "$@" grep grep
+	sed test test && cd 2>/dev/null readonly "$@" then -eu "$1" awk readonly
+	-eu awk grep $(pwd) done $(pwd) /usr/bin x=1 printf 'quoted text' echo x=1
+		-eu x=1 grep test grep "$1" && -eu /usr/bin "$1"
+${HOME} grep cd | -eu done readonly ${HOME}
+		--verbose grep grep x=1 printf export sed $(pwd) /usr/bin
+"$@" echo $(pwd) 'quoted text' done "$1" awk
+		sed x=1 grep "$@" cd && test x=1 && /usr/bin ${HOME} readonly | export
+	awk cd -eu test echo --verbose grep 2>/dev/null then readonly export readonly
+$(pwd) | ${HOME} grep test echo test then /usr/bin awk done awk
+	grep 'quoted text' printf readonly local grep test "$1" "$1" done ${HOME} local
+	readonly ${HOME} ${HOME} local sed ${HOME}
+		readonly printf "$1"
+2>/dev/null cd sed local "$@" "$@" printf --verbose
+		| | printf /usr/bin "$1" printf then 2>/dev/null
+-eu awk -eu | readonly readonly -eu "$@" then
+	sed /usr/bin && 2>/dev/null echo --verbose
+	printf then local $(pwd)
+		grep "$@" 2>/dev/null "$1" readonly
+		2>/dev/null printf sed local then "$1" printf test | printf --verbose echo
+--verbose readonly readonly --verbose sed -eu cd readonly
+		sed 2>/dev/null awk echo "$@" $(pwd) /usr/bin "$@"
+	${HOME} /usr/bin done $(pwd) "$1" done echo 2>/dev/null
+echo 2>/dev/null done && done 'quoted text' readonly readonly | x=1
+--verbose test x=1 -eu 2>/dev/null -eu then sed
+	then grep awk export then grep 2>/dev/null cd 2>/dev/null "$@" test $(pwd)
+${HOME} 'quoted text' grep $(pwd) /usr/bin readonly | --verbose "$@"
+		${HOME} 'quoted text' /usr/bin export -eu awk
+	2>/dev/null --verbose grep printf grep sed && x=1 /usr/bin ${HOME} $(pwd)
+	"$1" $(pwd) x=1 "$1" $(pwd) "$1" "$@" --verbose then test
+		test awk | done $(pwd) | 2>/dev/null
+/usr/bin cd 2>/dev/null awk
+local export | -eu -eu "$1"
+		x=1 --verbose 'quoted text' export local
+	/usr/bin readonly 'quoted text' awk -eu then awk test cd | export
+$(pwd) -eu grep readonly echo
+'quoted text' done test then -eu "$1"
+		&& -eu export x=1 grep --verbose 2>/dev/null sed 2>/dev/null grep 2>/dev/null
+		/usr/bin "$@" "$1" $(pwd) done echo sed "$@"
+x=1 $(pwd) "$1" x=1 local echo
+		awk cd sed readonly x=1 "$1" x=1 $(pwd) cd 'quoted text'
+	grep done && readonly sed local awk 2>/dev/null
+		/usr/bin $(pwd) then local "$@" x=1 grep --verbose export
+	export --verbose $(pwd) test $(pwd) cd $(pwd) echo x=1 done /usr/bin
+'quoted text' then test x=1 test sed test readonly export $(pwd)
+		awk test test 'quoted text' --verbose cd "$1"
+	done awk sed done echo $(pwd) done local | cd
+		"$@" --verbose cd then awk --verbose /usr/bin
+--verbose printf /usr/bin
+| ${HOME} x=1 export test awk && "$1"
+		'quoted text' 'quoted text' "$1" $(pwd) export 'quoted text' then local ${HOME}
+	cd awk $(pwd) grep "$@" "$@" "$@" awk 'quoted text' local | && --verbose
+		test 2>/dev/null sed --verbose
+local 'quoted text' readonly then export grep readonly then local done printf cd
+readonly "$@" /usr/bin | readonly
+		/usr/bin done --verbose 'quoted text'
+		sed echo -eu local && "$@" readonly && "$1" readonly && test awk $(pwd) test
+done readonly printf local --verbose sed "$@" sed readonly
+	--verbose ${HOME} cd $(pwd) 'quoted text' local test "$@" 2>/dev/null export 2>/dev/null
+	&& grep 'quoted text' cd ${HOME} && export
+	--verbose | x=1 echo -eu "$1" "$1" -eu -eu awk 'quoted text'
+'quoted text' readonly export /usr/bin $(pwd) done echo
+&& $(pwd) --verbose 'quoted text'
+printf x=1 awk echo export
+		awk --verbose export $(pwd)
+	readonly 2>/dev/null sed
+		-eu readonly $(pwd) export x=1 test 'quoted text'
+	awk local -eu "$@" --verbose ${HOME} cd export -eu readonly test cd readonly
+	-eu 'quoted text' 'quoted text' printf -eu sed /usr/bin export cd test &&
+	$(pwd) "$1" $(pwd) export test local local
+2>/dev/null --verbose cd |
+local "$@" local && /usr/bin
+	x=1 test readonly readonly
+	| | grep sed --verbose $(pwd) printf /usr/bin
+	done --verbose readonly export "$@" | readonly $(pwd) /usr/bin
+	export echo --verbose | x=1 "$@"
+'quoted text' echo | --verbose grep grep
+done /usr/bin --verbose
+		${HOME} /usr/bin "$1" local 2>/dev/null
+&& ${HOME} cd done sed | done "$@" cd echo "$1" "$1" -eu x=1
+		${HOME} 2>/dev/null && export "$@" | "$@" test awk --verbose --verbose echo
+		grep local test ${HOME} local | "$1" sed grep cd 'quoted text'
+then 'quoted text' test -eu $(pwd) 'quoted text' done $(pwd) export
+		-eu readonly awk echo --verbose -eu | /usr/bin | "$@" done printf
+		| ${HOME} $(pwd) export "$1" then
+		"$@" grep then $(pwd) local
+cd 2>/dev/null test test printf export done 'quoted text' && cd
+		| export grep local "$1" | | test | 2>/dev/null done readonly 'quoted text'
+x=1 /usr/bin 'quoted text' x=1 readonly -eu 'quoted text'
+		/usr/bin && /usr/bin $(pwd) -eu "$1" "$@" export | "$@"
+		-eu -eu awk $(pwd) then sed -eu | cd $(pwd) echo then "$@"
+--verbose /usr/bin | test 2>/dev/null |
+		"$@" --verbose "$@" 2>/dev/null then export x=1 | 2>/dev/null
+	awk ${HOME} done awk $(pwd) readonly 'quoted text'
+		local 'quoted text' grep printf --verbose sed | "$1" awk then test
+$(pwd) ${HOME} "$@" cd test | --verbose then export --verbose
+	then sed --verbose x=1 && /usr/bin printf grep 2>/dev/null -eu test cd |
+grep 2>/dev/null echo cd $(pwd)
+	/usr/bin printf echo awk grep done 'quoted text' && awk export export
+		sed sed export awk awk sed then local "$@" /usr/bin cd cd
+	printf -eu "$1" readonly "$1" awk sed "$1" sed
+$(pwd) -eu $(pwd) sed then $(pwd) x=1 local done 2>/dev/null grep
+		| | && echo $(pwd) readonly /usr/bin test && done then /usr/bin
+		-eu awk "$@" grep && export ${HOME} awk readonly 2>/dev/null echo /usr/bin
+readonly && sed /usr/bin && printf then echo awk 2>/dev/null 2>/dev/null
+	sed 2>/dev/null then echo
+	awk awk printf cd printf | --verbose
+	local readonly "$1" done readonly
+sed -eu 'quoted text' /usr/bin /usr/bin grep export readonly && -eu then x=1
+		echo ${HOME} local readonly 'quoted text'
+	$(pwd) x=1 | readonly 2>/dev/null $(pwd) sed
+		| echo ${HOME} ${HOME} "$1" ${HOME} then 2>/dev/null awk x=1 && awk printf -eu 2>/dev/null
+"$@" awk sed "$@" -eu "$1"
+	"$1" 2>/dev/null | -eu done echo $(pwd) echo | done readonly local grep
+grep readonly ${HOME} 2>/dev/null x=1 x=1 echo test sed sed then $(pwd) -eu
+x=1 | $(pwd) "$@" cd then then awk --verbose "$1"
+	-eu -eu export /usr/bin local local printf test "$1"
+| done $(pwd) export then local && "$1"
+	"$@" "$@" "$1" grep /usr/bin "$@" && 2>/dev/null printf && /usr/bin 2>/dev/null
+sed && done cd "$1" then sed && grep --verbose then 2>/dev/null
+	grep grep 'quoted text' -eu awk then
+	&& 2>/dev/null "$1" sed done local
+2>/dev/null && x=1 local --verbose --verbose --verbose
+		--verbose readonly done $(pwd) export cd export $(pwd) 'quoted text' export
+		printf | 2>/dev/null &&
+then /usr/bin printf 'quoted text' x=1 local export done readonly test echo
+		then x=1 "$1" --verbose 'quoted text' x=1 "$1" test | test $(pwd) printf "$1" -eu
+		done sed | /usr/bin sed --verbose $(pwd) --verbose
+	| echo printf awk && 'quoted text' | /usr/bin
+		--verbose ${HOME} x=1 /usr/bin readonly
+&& x=1 2>/dev/null -eu done sed -eu then grep done cd awk
+	${HOME} ${HOME} $(pwd) then cd test export awk printf printf "$1" test echo
+export export grep && -eu awk local --verbose cd then export -eu cd
+		export ${HOME} ${HOME} then /usr/bin cd | local --verbose
+	-eu export $(pwd) 2>/dev/null export then "$@" echo readonly
+		done export x=1 "$1" sed sed 'quoted text' --verbose
+	$(pwd) local && echo awk
+		then export $(pwd) awk sed printf --verbose local ${HOME} -eu then done local local
+	2>/dev/null test $(pwd) test 2>/dev/null local
+	-eu ${HOME} --verbose then awk | echo local printf
+		printf --verbose "$1" "$@" local -eu "$@" then awk ${HOME} cd --verbose awk
+-eu 2>/dev/null awk -eu "$@" $(pwd) -eu sed $(pwd) echo readonly done -eu
+		-eu echo grep grep /usr/bin
+		printf export sed grep done -eu /usr/bin test
+cd | grep /usr/bin grep test
+	--verbose test $(pwd) x=1 && /usr/bin
+	"$@" awk local sed test then grep 2>/dev/null x=1 ${HOME} cd local
+		"$@" && printf then x=1 --verbose sed && "$1"
+	"$1" local --verbose /usr/bin 2>/dev/null sed "$@"
+		cd grep echo 'quoted text' readonly readonly --verbose
+sed echo awk $(pwd) readonly then local "$1" /usr/bin cd readonly sed
+	$(pwd) sed | local sed "$@" printf && awk && x=1 --verbose
+$(pwd) test 2>/dev/null then | then echo cd 'quoted text'
+	'quoted text' echo "$@" --verbose
+	readonly "$@" grep awk test
+	cd done printf local "$1" awk "$1" $(pwd) test |
+&& sed "$1" echo sed 2>/dev/null sed x=1 'quoted text' cd x=1 sed
+	sed readonly grep --verbose awk test printf readonly sed && | ${HOME}
+		test local awk cd echo 2>/dev/null ${HOME} x=1
+	x=1 "$1" /usr/bin printf echo | "$@" cd 2>/dev/null "$@" sed cd local grep
+		cd /usr/bin printf printf cd 'quoted text' test test
+		readonly then ${HOME} cd
+		"$@" && $(pwd) done awk done awk export export readonly /usr/bin
+	printf done x=1 && readonly /usr/bin | "$@"
+/usr/bin && $(pwd) 2>/dev/null export echo | test "$@" && "$@" then printf
+cd echo 2>/dev/null $(pwd) sed grep
+	grep cd sed test 2>/dev/null ${HOME} 'quoted text' then /usr/bin
+--verbose done $(pwd) --verbose echo --verbose --verbose | | "$@" grep ${HOME}
+--verbose local printf x=1 /usr/bin
+	"$1" awk cd x=1 then "$1" 2>/dev/null then test echo
+	&& local "$@" | readonly awk $(pwd)
+	| --verbose -eu 'quoted text' && readonly ${HOME}
+--verbose grep test 2>/dev/null cd --verbose
+	"$1" -eu printf /usr/bin $(pwd) $(pwd)
+printf readonly $(pwd) "$@" /usr/bin test ${HOME} | "$@" "$1"
+		"$@" printf readonly 2>/dev/null
+2>/dev/null --verbose 'quoted text' x=1 printf
+		awk readonly "$1" readonly "$@" -eu sed 2>/dev/null sed 2>/dev/null -eu
+	${HOME} -eu export -eu 2>/dev/null cd "$@" $(pwd)
+		"$1" x=1 -eu $(pwd) echo
+local cd -eu awk sed done $(pwd) $(pwd) && $(pwd) x=1 ${HOME}
+	"$1" /usr/bin done done -eu && test x=1 echo -eu $(pwd) echo cd printf
+| echo sed ${HOME} --verbose awk cd 2>/dev/null |
+"$1" then --verbose then awk && awk /usr/bin "$@" $(pwd)
+--verbose -eu grep | done echo x=1 x=1 --verbose
+		export && test echo cd ${HOME} 'quoted text' grep --verbose $(pwd) cd readonly
+grep && test test readonly echo -eu | echo --verbose
+grep grep export echo sed cd done sed test sed then then cd cd 2>/dev/null export
+local echo printf "$1" printf printf
+/usr/bin grep awk done -eu test then done 'quoted text' "$@" done x=1 2>/dev/null
+awk 2>/dev/null echo export local ${HOME}
+		grep done 2>/dev/null | sed cd && /usr/bin -eu
+$(pwd) x=1 awk done | --verbose $(pwd) x=1 sed then ${HOME}
+		test && --verbose printf /usr/bin 'quoted text'
+	"$1" --verbose --verbose readonly test $(pwd) "$1" awk sed then
+"$1" export test then echo readonly
+		"$@" $(pwd) --verbose test test echo local "$1" /usr/bin ${HOME}
+sed "$1" | x=1 $(pwd) printf test done then export local then done
+export done "$@" $(pwd) local ${HOME} | printf --verbose /usr/bin awk test
+awk -eu then -eu test "$1" printf $(pwd)
+		&& readonly echo 2>/dev/null local /usr/bin 'quoted text' "$1" readonly 'quoted text'
+	echo done done /usr/bin printf $(pwd) -eu awk test x=1 sed "$@" && --verbose
+	test cd test printf awk readonly export
+then --verbose done then test 'quoted text' echo test -eu -eu echo -eu /usr/bin
+sed 2>/dev/null --verbose 'quoted text' cd 'quoted text' readonly
+	local --verbose echo echo $(pwd) test && done done export
+grep export "$1" ${HOME} 2>/dev/null printf /usr/bin /usr/bin
+	| x=1 export x=1 -eu 2>/dev/null x=1 export grep done | cd && "$1"
+	/usr/bin 2>/dev/null 2>/dev/null echo echo printf export |
+		&& grep --verbose && 2>/dev/null done then x=1
+	${HOME} ${HOME} local && | grep
+then test 'quoted text' export
+local echo /usr/bin then
+	${HOME} sed ${HOME} -eu readonly 2>/dev/null export readonly 2>/dev/null local
+		/usr/bin -eu --verbose $(pwd) 'quoted text' grep $(pwd) sed awk "$@" |
+export export sed test 2>/dev/null printf
+--verbose test cd sed "$@" readonly ${HOME} local
+		cd grep local /usr/bin "$@" test sed echo ${HOME} awk 2>/dev/null
+		cd printf echo cd x=1 | cd test ${HOME} printf "$@"
+		test echo -eu awk readonly
+-eu x=1 awk echo x=1 printf ${HOME} && done $(pwd) | /usr/bin $(pwd) printf
+		readonly test $(pwd) | test done 2>/dev/null export sed readonly
+	"$1" -eu test printf awk test grep "$1" --verbose
+		-eu /usr/bin then -eu "$@"
+	then /usr/bin 'quoted text'
+	${HOME} | $(pwd) 'quoted text' ${HOME} done -eu 2>/dev/null readonly
+	cd x=1 ${HOME} local x=1 local 'quoted text'
+	/usr/bin x=1 x=1 -eu echo 2>/dev/null
+	$(pwd) printf "$1" "$@" -eu grep
+readonly echo -eu echo readonly -eu export echo awk grep awk ${HOME} printf /usr/bin
+	'quoted text' done echo
+then 2>/dev/null -eu /usr/bin
+	then then export "$@" -eu cd export
+		sed export $(pwd) test test ${HOME} awk "$@" test export test then -eu
+		--verbose echo awk $(pwd)
+		2>/dev/null "$@" done readonly export
+	awk test "$@" 'quoted text' | printf /usr/bin 2>/dev/null /usr/bin && local
+	grep -eu sed --verbose ${HOME} $(pwd) -eu cd awk x=1 x=1 done && readonly cd
+done export done local | test "$1" -eu echo x=1 cd 'quoted text' sed -eu sed export
+	| --verbose -eu | grep "$1" "$@" ${HOME} awk test printf printf grep /usr/bin $(pwd)
+	/usr/bin echo ${HOME} 2>/dev/null then local sed then echo local | done test
+	| $(pwd) /usr/bin /usr/bin echo $(pwd) local
+&& && "$@" 2>/dev/null 2>/dev/null x=1 cd
+	grep && printf readonly echo cd readonly export grep -eu
+"$@" x=1 'quoted text' printf $(pwd) grep sed -eu
+	x=1 x=1 done && ${HOME} test export 2>/dev/null export | &&
+	${HOME} sed -eu --verbose x=1 /usr/bin /usr/bin export
+local cd 'quoted text' && ${HOME} readonly cd -eu cd export --verbose "$1" then
+		&& x=1 printf | ${HOME} "$@" 'quoted text'
+${HOME} readonly ${HOME} $(pwd)
+export done grep "$@" printf
+		test echo test /usr/bin test /usr/bin $(pwd) ${HOME} ${HOME} echo cd readonly ${HOME}
+2>/dev/null ${HOME} grep $(pwd) 2>/dev/null
+		-eu $(pwd) sed -eu cd ${HOME} "$1" test done
+sed && 'quoted text' readonly && grep ${HOME} && printf
+	export -eu local grep readonly local "$1" grep -eu 'quoted text'
+		export grep 2>/dev/null &&
+$(pwd) printf && sed && sed /usr/bin cd "$@" cd 2>/dev/null
+		$(pwd) echo -eu export 2>/dev/null export $(pwd) sed
+/usr/bin test readonly ${HOME} sed done cd
+grep /usr/bin export export export echo
+local then awk done "$1" "$@" -eu 2>/dev/null --verbose awk cd grep echo &&
+	"$@" cd x=1 -eu echo ${HOME} x=1 --verbose awk
+x=1 ${HOME} export x=1 local x=1 && x=1 local awk 2>/dev/null
+	sed awk ${HOME} --verbose "$1" 2>/dev/null "$1" ${HOME}
+&& printf $(pwd) ${HOME} "$@" readonly -eu "$@" $(pwd)
+	"$1" echo printf sed echo "$1" done local sed --verbose echo /usr/bin
+"$@" x=1 then && echo 'quoted text' local printf test
+printf cd 'quoted text'
+	test --verbose ${HOME} /usr/bin x=1 ${HOME} sed cd grep $(pwd) ${HOME} "$1" "$@"
+		cd 2>/dev/null cd x=1 then 'quoted text'
+grep 'quoted text' export done -eu 'quoted text' 'quoted text' 2>/dev/null local
+		'quoted text' then echo | printf | "$@"
+	local echo 2>/dev/null 2>/dev/null $(pwd)
+test echo local 2>/dev/null && grep "$@" /usr/bin
+		"$@" "$1" test --verbose /usr/bin -eu ${HOME}
+	export && export done then "$@"
+local | -eu 2>/dev/null 'quoted text' awk awk cd -eu /usr/bin
+	test "$@" /usr/bin $(pwd) --verbose
+"$@" test --verbose grep -eu awk test cd
+printf then echo x=1 ${HOME} --verbose &&
+		| echo export grep 2>/dev/null export done /usr/bin
+	| 2>/dev/null cd "$@" done printf test echo
+2>/dev/null $(pwd) cd then grep printf done ${HOME}
+		echo awk --verbose -eu --verbose "$1" readonly
+	-eu done /usr/bin ${HOME} cd done 2>/dev/null &&
+		cd --verbose readonly grep --verbose
+/usr/bin cd x=1 2>/dev/null 'quoted text' -eu | /usr/bin --verbose
+${HOME} sed sed | printf ${HOME}
+	-eu "$1" export sed sed --verbose
+		export test "$@" readonly && --verbose readonly readonly "$1" $(pwd) grep "$@" x=1
+readonly "$@" then export "$1" local
+readonly readonly then grep "$1" && "$1"
+then printf test export cd && "$@" ${HOME} 2>/dev/null grep ${HOME} "$@"
+readonly printf test test local awk test x=1 test then /usr/bin
+	sed export && echo test /usr/bin "$1" readonly "$1" local export ${HOME}
+		2>/dev/null "$@" $(pwd) grep sed ${HOME} -eu | awk --verbose x=1 "$1" readonly
+		grep echo | 2>/dev/null | printf done echo --verbose && echo readonly
+	"$@" && "$1" ${HOME} cd "$1" echo
+		awk sed grep cd grep sed awk local then awk /usr/bin
+cd && "$1" "$1" printf && echo readonly /usr/bin && grep done -eu -eu sed done grep
+awk sed -eu cd && echo test test -eu "$@" grep x=1 grep 2>/dev/null
+		sed grep --verbose x=1 -eu awk ${HOME} -eu
+		&& "$@" && then ${HOME} done done x=1 test readonly local local sed awk
+		"$@" $(pwd) --verbose && done 2>/dev/null
+	cd cd local x=1 --verbose echo sed | cd /usr/bin grep x=1 sed /usr/bin
+sed 2>/dev/null && /usr/bin local "$@"
+		/usr/bin done | test $(pwd) | awk x=1 local | awk test $(pwd) $(pwd)
+awk export readonly then echo
+| export readonly echo printf x=1 "$1" printf sed $(pwd) awk && test
+		printf 'quoted text' test -eu export ${HOME} local $(pwd)
+--verbose ${HOME} then
+		$(pwd) cd | "$@" echo "$1" /usr/bin test grep export printf readonly
+${HOME} grep done --verbose 2>/dev/null
+	awk readonly "$@" test printf "$@" readonly "$@" echo ${HOME} -eu 2>/dev/null
+| test -eu | printf done then && sed test then then then cd then
+	/usr/bin -eu ${HOME} "$@"
+	"$@" sed ${HOME} x=1 readonly ${HOME} local export ${HOME}
+		$(pwd) | -eu echo grep x=1 cd ${HOME} 2>/dev/null && && ${HOME} --verbose -eu
+test --verbose readonly echo then 2>/dev/null
+	echo $(pwd) test sed cd && $(pwd) "$@" local readonly && export
+cd && "$1" -eu done done cd 2>/dev/null
+done -eu printf "$1" x=1 echo 'quoted text' -eu test test printf "$1"
+		grep | ${HOME} cd export | echo $(pwd) 2>/dev/null --verbose /usr/bin
+printf -eu && echo $(pwd) | sed awk 2>/dev/null "$1" ${HOME} done export 'quoted text'
+		$(pwd) grep 2>/dev/null /usr/bin 2>/dev/null 2>/dev/null /usr/bin 'quoted text'
+	export && "$@" -eu $(pwd) sed -eu readonly printf done done 'quoted text'
+2>/dev/null 'quoted text' test grep 2>/dev/null | sed readonly
+	export then "$@" export awk 'quoted text' ${HOME}
+		"$@" grep echo cd && test ${HOME} test 2>/dev/null
+		export --verbose then -eu 2>/dev/null echo
+	done done grep "$1" local $(pwd) awk && export
+&& "$@" "$1" "$1" x=1 echo 2>/dev/null && /usr/bin grep then --verbose "$1"
+	&& x=1 echo -eu "$@" $(pwd) printf
+	&& -eu /usr/bin ${HOME} readonly "$@" "$1" ${HOME} then
+		${HOME} $(pwd) "$@" --verbose readonly x=1 --verbose $(pwd) x=1 awk 'quoted text'
+2>/dev/null "$1" x=1 echo && cd test local local export then awk 'quoted text'
+2>/dev/null | test "$@" awk
+/usr/bin --verbose export /usr/bin && -eu
+awk sed 'quoted text' ${HOME} done 'quoted text'
+x=1 2>/dev/null done test
+	local $(pwd) done sed && 'quoted text' ${HOME} 2>/dev/null
+	echo $(pwd) /usr/bin /usr/bin 2>/dev/null
+awk cd 2>/dev/null cd sed | ${HOME} grep 2>/dev/null x=1
+	| -eu printf x=1 && && printf done test done
+awk "$1" cd then "$1" ${HOME} 'quoted text' sed ${HOME} --verbose
+	"$1" -eu $(pwd) test && /usr/bin &&
+done 2>/dev/null 'quoted text'
+then x=1 test x=1 sed --verbose echo done $(pwd) "$@" local
+		readonly grep printf printf | "$1"
+		printf done /usr/bin 'quoted text'
+export /usr/bin $(pwd) "$1" x=1 done grep
+	grep awk printf grep local then sed --verbose ${HOME} echo x=1 sed test readonly
+--verbose -eu test --verbose then test "$1" readonly "$1"
+	-eu $(pwd) test /usr/bin readonly grep cd export sed
+	| && ${HOME} printf then $(pwd) 'quoted text' echo
+		readonly local | awk export "$1" "$@"
+	${HOME} printf cd test $(pwd)
+	grep echo -eu | test local x=1 test test grep 2>/dev/null awk grep
+	/usr/bin && "$@" sed /usr/bin && --verbose
+	export x=1 cd readonly sed cd "$@" | -eu
+		"$1" $(pwd) grep "$@" $(pwd) | 'quoted text'
+		printf echo ${HOME} then $(pwd) awk export x=1 readonly | printf
+cd grep 2>/dev/null -eu |
+	export cd then x=1 sed echo "$@" /usr/bin
+	export "$1" $(pwd) --verbose "$@" sed $(pwd) "$@" "$1" then x=1 then x=1
+	"$@" echo -eu x=1 /usr/bin | readonly 'quoted text'
+		awk | local /usr/bin | --verbose ${HOME} && export grep ${HOME} awk ${HOME}
+-eu local ${HOME} done local readonly 'quoted text'
+		test -eu echo awk ${HOME} then --verbose
+cd test x=1 ${HOME} -eu awk x=1 echo $(pwd) x=1 export test --verbose x=1
+		cd readonly x=1 ${HOME} cd printf printf
+	--verbose 2>/dev/null echo x=1 awk awk
+		'quoted text' grep grep grep /usr/bin /usr/bin printf local 2>/dev/null
+done then 'quoted text' export
+local "$@" /usr/bin test x=1 done | test
+		done x=1 "$@" ${HOME} sed export ${HOME} "$1" $(pwd) echo readonly
+	export 'quoted text' $(pwd) printf echo printf && local
+printf -eu ${HOME} ${HOME}
+		$(pwd) && test grep /usr/bin "$@" x=1
+sed --verbose done x=1 local 2>/dev/null then export -eu
+2>/dev/null /usr/bin 2>/dev/null test export awk awk "$@" echo 'quoted text' 2>/dev/null
+		"$@" awk "$@" printf cd 'quoted text'
+${HOME} x=1 'quoted text' cd echo &&
+	${HOME} "$@" x=1 $(pwd) -eu "$@" sed && "$@" 'quoted text' ${HOME} export
+	&& sed readonly "$1" x=1 $(pwd) export export
+	${HOME} export sed cd sed awk -eu 2>/dev/null 'quoted text' printf
+${HOME} grep done echo /usr/bin
+printf $(pwd) $(pwd) 2>/dev/null
+		&& echo then 2>/dev/null --verbose then echo awk $(pwd) then --verbose export
+grep then "$1" "$1" cd 2>/dev/null
+	${HOME} $(pwd) "$@" 'quoted text' "$1" cd 'quoted text' $(pwd)
+	sed then sed | 'quoted text' echo 'quoted text'
+		then local | $(pwd) grep | grep 'quoted text'
+	"$@" --verbose test $(pwd) 'quoted text' 'quoted text'
+	test printf -eu export --verbose | $(pwd) x=1 grep readonly
+readonly $(pwd) "$@" --verbose --verbose
+		| sed export printf done awk "$1" 2>/dev/null 2>/dev/null "$1" test
+awk -eu done $(pwd) cd $(pwd) /usr/bin /usr/bin sed x=1 'quoted text'
+	sed /usr/bin /usr/bin 2>/dev/null
+		| "$1" /usr/bin /usr/bin grep 'quoted text' test 2>/dev/null
+x=1 cd readonly ${HOME} then sed ${HOME} | readonly done $(pwd) echo 'quoted text'
+"$@" x=1 then "$1" test readonly
+| printf "$@" | x=1 /usr/bin sed awk done done printf ${HOME} awk awk | printf
+	&& test 'quoted text' /usr/bin $(pwd) --verbose
+		-eu "$@" then test grep $(pwd) printf $(pwd) local 2>/dev/null test
+	printf -eu printf -eu "$1"
+--verbose printf && 2>/dev/null then --verbose done
+		printf ${HOME} then /usr/bin grep
+	'quoted text' /usr/bin done readonly
+		test local x=1 $(pwd) /usr/bin 2>/dev/null "$@"
+awk | cd sed sed 'quoted text' 2>/dev/null --verbose
+	sed 2>/dev/null /usr/bin sed x=1 echo
+"$1" "$@" ${HOME} -eu
+		local 2>/dev/null awk /usr/bin
+		local x=1 test cd grep "$@" $(pwd) /usr/bin 'quoted text' | readonly export /usr/bin
+	2>/dev/null 'quoted text' awk x=1 readonly awk sed 'quoted text'
+'quoted text' "$@" export --verbose 'quoted text' printf
+		'quoted text' x=1 "$@" 'quoted text'
+2>/dev/null x=1 then /usr/bin
+	x=1 ${HOME} /usr/bin cd "$@" /usr/bin --verbose /usr/bin
+sed local && awk 2>/dev/null x=1 echo test
+		"$@" export x=1 --verbose "$@" $(pwd) "$1" "$1" sed readonly "$1" then
+--verbose "$@" && then then ${HOME} -eu $(pwd) printf "$@" /usr/bin
+		test local readonly && then readonly
+		"$1" "$@" "$1" $(pwd) grep 'quoted text' --verbose readonly
+2>/dev/null 'quoted text' 2>/dev/null $(pwd) grep awk printf 2>/dev/null --verbose
+then 2>/dev/null export awk sed
+readonly then printf $(pwd) | test readonly && grep local local echo
+x=1 local awk printf "$1" sed test printf
+sed cd echo then then echo "$1" 2>/dev/null then
+		/usr/bin local awk "$@" ${HOME} then then | "$@"
+local printf export local | -eu $(pwd) cd --verbose test awk grep test -eu sed
+sed -eu $(pwd) ${HOME}
+		-eu test awk grep cd "$1" --verbose 2>/dev/null then done readonly /usr/bin
+-eu cd sed grep echo && $(pwd) then
+&& awk cd --verbose cd 2>/dev/null ${HOME}
+grep grep export test 2>/dev/null 2>/dev/null --verbose
+/usr/bin --verbose -eu -eu && ${HOME} grep x=1 test awk
+	${HOME} -eu printf local 2>/dev/null "$1" grep export readonly
+/usr/bin -eu -eu export export /usr/bin "$@" -eu 'quoted text' "$1"
+	then export awk 'quoted text' "$1" 'quoted text' x=1 sed -eu "$@" awk
+local test awk grep done "$1" $(pwd) 'quoted text' readonly
+		export 'quoted text' && && && local cd test
+		readonly | ${HOME} sed $(pwd) readonly "$@" && $(pwd)
+test x=1 grep sed /usr/bin grep local ${HOME} echo export
+grep done done -eu export export awk /usr/bin /usr/bin printf echo
+		--verbose sed sed cd /usr/bin readonly x=1 -eu /usr/bin awk
+		"$1" cd printf $(pwd) 2>/dev/null grep | 'quoted text'
+then awk "$1" | x=1 x=1 $(pwd) "$@" "$1" grep | -eu $(pwd) $(pwd) 2>/dev/null
+		&& export "$@" awk | /usr/bin |
+'quoted text' 2>/dev/null && ${HOME} /usr/bin readonly done && 2>/dev/null
+	-eu -eu 2>/dev/null cd ${HOME} grep echo x=1 /usr/bin local ${HOME}
+	"$@" sed then grep ${HOME}
+		'quoted text' -eu ${HOME}
+2>/dev/null then 'quoted text' "$1" && readonly local readonly local
+		--verbose export done then
+done readonly awk readonly echo 'quoted text' awk "$1" /usr/bin
+		then 2>/dev/null sed | done cd grep x=1 echo 2>/dev/null -eu then printf 2>/dev/null
+		"$@" test x=1 ${HOME} cd echo cd grep printf echo echo grep
+	'quoted text' done /usr/bin awk /usr/bin | printf "$1" $(pwd) awk && | ${HOME}
+	readonly local | export "$1" echo sed ${HOME}
+	/usr/bin sed local done x=1 cd ${HOME}
+	--verbose /usr/bin export local && readonly
+		-eu ${HOME} -eu then echo cd awk -eu test
+--verbose $(pwd) sed $(pwd)
+	cd && awk "$1" readonly grep then | echo test x=1 "$1" test
+	&& ${HOME} "$1" grep export 'quoted text' 'quoted text' export $(pwd) /usr/bin
+	'quoted text' readonly --verbose cd grep
+		${HOME} -eu -eu 2>/dev/null
+	printf test local export && 'quoted text' cd "$1" --verbose $(pwd) | "$1"
+		-eu local "$1" x=1 x=1 x=1 then
+done local then printf printf printf
+	"$1" then printf awk cd readonly awk grep grep x=1
+| done test awk cd | 'quoted text' local x=1 && printf readonly
+&& then 'quoted text' ${HOME} && ${HOME} done readonly test --verbose
+	2>/dev/null export 'quoted text' && readonly 2>/dev/null then
+		"$@" local /usr/bin export test --verbose
+		"$1" -eu 'quoted text'
+	cd then sed 'quoted text' -eu -eu "$@" ${HOME} --verbose cd awk ${HOME} test
+	2>/dev/null | done ${HOME} && export sed awk 2>/dev/null export
+$(pwd) export export --verbose --verbose awk echo && readonly 2>/dev/null x=1
+| echo | readonly readonly /usr/bin --verbose
+		readonly then printf then x=1 $(pwd)
+/usr/bin ${HOME} 'quoted text'
+	printf ${HOME} cd cd echo awk "$@" local "$@" 'quoted text'
+		then local local then && readonly "$@" awk x=1 cd echo --verbose then
+	2>/dev/null sed $(pwd) then done export
+	| --verbose then -eu
+	/usr/bin awk "$1" --verbose awk then $(pwd) local | printf cd ${HOME} grep export
+		done awk done x=1 done /usr/bin x=1 ${HOME} | x=1
+'quoted text' sed test cd -eu x=1
+		| then done && 'quoted text' "$@" test "$@" ${HOME} export
+/usr/bin local cd 'quoted text' sed done $(pwd) $(pwd)
+2>/dev/null "$@" cd "$1" "$@" 2>/dev/null
+sed local "$@" ${HOME} /usr/bin x=1 ${HOME} test
+		| $(pwd) $(pwd) test 'quoted text' && $(pwd) export awk sed --verbose
+test /usr/bin | "$@" echo
+	echo readonly /usr/bin && ${HOME} test printf grep cd echo -eu |
+local | readonly /usr/bin | && 2>/dev/null x=1 2>/dev/null /usr/bin && && local
+		done awk ${HOME} grep grep awk grep --verbose export | export export
+done local -eu local printf printf --verbose local | readonly 2>/dev/null
+	/usr/bin 2>/dev/null done "$@" awk grep ${HOME} $(pwd) done "$1" grep cd "$1"
+		"$1" | /usr/bin && grep --verbose
+awk done 'quoted text' sed local readonly cd
+		$(pwd) readonly 2>/dev/null 'quoted text'
+/usr/bin 2>/dev/null ${HOME} --verbose
+		sed awk export cd $(pwd) 2>/dev/null
+		grep "$1" "$@" done local "$@" /usr/bin --verbose -eu cd awk cd -eu export then
+	${HOME} echo done test ${HOME} $(pwd)
+		'quoted text' done echo
+		readonly x=1 cd | -eu grep 2>/dev/null printf "$@" test cd export /usr/bin
+		/usr/bin readonly local
+	"$@" sed --verbose | /usr/bin "$@" -eu 2>/dev/null test then printf
+	-eu "$@" 2>/dev/null test export "$@" then test "$1"
+	test $(pwd) export x=1 then && awk $(pwd) test 'quoted text'
+$(pwd) ${HOME} && "$1" local /usr/bin
+&& "$1" -eu done --verbose cd then && "$1" "$1" cd x=1 x=1
+	export -eu "$1" printf export export echo printf echo "$1" ${HOME} echo "$@"
+&& $(pwd) 'quoted text' echo grep
+		${HOME} grep awk done "$1" cd $(pwd) printf cd -eu sed /usr/bin
+		--verbose test awk $(pwd) echo then
+	local sed "$1" "$@" && $(pwd) cd cd | "$@" done -eu | local ${HOME} then
+		'quoted text' --verbose /usr/bin
+export && "$@" readonly then -eu sed --verbose printf "$@" ${HOME} $(pwd)
+'quoted text' export 'quoted text' /usr/bin "$1" 'quoted text'
+	2>/dev/null done export sed sed cd cd ${HOME}
+--verbose test "$1" echo x=1 "$1" 'quoted text' readonly x=1 local
+	done export test "$@" "$@"
+${HOME} done readonly "$1" cd export /usr/bin done awk local x=1 printf $(pwd) 'quoted text'
+	"$1" awk 2>/dev/null "$1" ${HOME} readonly /usr/bin awk "$@" awk
+		"$@" $(pwd) awk cd /usr/bin then echo -eu readonly
+	grep | test /usr/bin -eu "$@" /usr/bin readonly test
+		--verbose awk export 'quoted text' then test --verbose
+		printf test readonly && /usr/bin then sed awk && cd awk done && echo grep
+	echo -eu then printf echo readonly --verbose
+		$(pwd) test "$@" export | awk awk 2>/dev/null grep
+--verbose -eu /usr/bin 'quoted text' done test ${HOME}
+		x=1 && "$1" then test /usr/bin grep "$1" 2>/dev/null then --verbose
+		| $(pwd) 'quoted text' 2>/dev/null awk done 2>/dev/null
+		-eu sed "$@" then "$@" x=1 --verbose
+sed local | then 'quoted text' 'quoted text' then
+		--verbose test awk export echo --verbose 2>/dev/null
+	readonly echo sed $(pwd) local then "$@" done --verbose sed grep then | test
+		awk sed /usr/bin x=1
+${HOME} readonly /usr/bin local /usr/bin
+	then export done --verbose printf -eu $(pwd) local cd local
+	test x=1 readonly x=1 then x=1 echo 2>/dev/null
+		echo -eu test export cd /usr/bin local export ${HOME}
+	export test --verbose ${HOME} sed x=1 --verbose export then grep -eu
+printf done test -eu done test /usr/bin echo done echo test awk
+	"$@" ${HOME} | -eu ${HOME}
+		awk $(pwd) "$1" x=1 "$@" local -eu readonly export cd echo --verbose
+	| /usr/bin echo done x=1 awk | | ${HOME}
+		-eu ${HOME} -eu /usr/bin grep local echo
+		${HOME} 'quoted text' grep --verbose grep x=1 -eu export 'quoted text'
+&& 'quoted text' printf /usr/bin ${HOME} then printf local done
+	2>/dev/null readonly x=1 printf 'quoted text'
+	echo /usr/bin done | printf awk done awk 2>/dev/null awk export export readonly
+test /usr/bin echo x=1 test sed then
+	'quoted text' $(pwd) cd 2>/dev/null
+	grep then /usr/bin /usr/bin readonly
+		2>/dev/null done test cd --verbose x=1 x=1 sed export
+	echo done $(pwd) awk x=1 readonly echo x=1
+	$(pwd) --verbose printf local readonly readonly
+		grep x=1 ${HOME} ${HOME} 2>/dev/null /usr/bin x=1 readonly -eu
+cd done grep 2>/dev/null ${HOME} local 2>/dev/null
+echo grep grep readonly awk grep "$1" printf /usr/bin done echo
+	local then 'quoted text' $(pwd) 2>/dev/null /usr/bin echo awk
+	echo sed export readonly | awk --verbose
+	sed /usr/bin -eu | -eu -eu printf 2>/dev/null /usr/bin local
+		-eu test -eu local "$@" printf $(pwd) "$1"
+	cd "$@" | "$@" 2>/dev/null echo && && sed grep sed 'quoted text' sed echo
+	x=1 && sed "$1" then 2>/dev/null export ${HOME} done done test x=1 printf
+-eu /usr/bin local then done 'quoted text' test done /usr/bin x=1
+--verbose done 'quoted text' /usr/bin
+	$(pwd) "$1" 'quoted text' done grep printf readonly ${HOME}
+printf then readonly -eu then ${HOME} | cd
+		readonly "$1" | | x=1 export printf
+$(pwd) cd test "$@" 2>/dev/null sed
+		-eu sed printf local printf printf && ${HOME} --verbose ${HOME} awk "$@" -eu cd
+		2>/dev/null awk then printf readonly |
+		then 'quoted text' then test export --verbose | --verbose
+	"$1" | 2>/dev/null echo
+		awk grep 2>/dev/null cd
+| export echo echo sed /usr/bin ${HOME} --verbose
+then 'quoted text' grep echo --verbose test --verbose then cd then
+local "$@" local test readonly
+	test echo sed grep 2>/dev/null readonly local -eu "$1" | 'quoted text' "$@"
+	cd --verbose /usr/bin cd local local done -eu sed 2>/dev/null echo
+'quoted text' export awk
+		| /usr/bin 2>/dev/null done local export readonly printf "$@" --verbose $(pwd)
+local sed export done printf "$1" echo sed -eu
+	| done then then --verbose && awk echo /usr/bin then
+	export export --verbose test x=1 printf $(pwd) "$@" export test awk --verbose
+"$1" local cd grep 'quoted text' ${HOME} done echo then "$@" x=1 grep grep local
+		&& cd cd ${HOME} --verbose /usr/bin $(pwd) ${HOME} 'quoted text'
+	&& --verbose readonly grep echo && echo $(pwd) readonly export
+'quoted text' "$@" x=1 && ${HOME} export cd local | ${HOME} "$@"
+local | test "$@" export ${HOME} echo x=1 cd readonly
+	echo 'quoted text' grep test /usr/bin readonly
+	local local grep -eu "$1" -eu export cd ${HOME}
+"$@" echo printf | --verbose 'quoted text' "$@" 'quoted text'
+	--verbose export awk export $(pwd)
+'quoted text' ${HOME} then /usr/bin printf $(pwd) cd local sed
+	printf "$1" test sed test x=1
+"$@" $(pwd) /usr/bin test test && cd -eu 'quoted text'
+	"$@" printf 2>/dev/null "$@" 'quoted text' -eu test 'quoted text'
+		'quoted text' x=1 sed done $(pwd)
+	${HOME} "$@" awk "$@" --verbose
+		'quoted text' printf then sed "$1" local --verbose "$@" sed sed ${HOME}
+		-eu ${HOME} awk sed then /usr/bin "$@" "$1" local cd echo echo -eu grep
+	-eu then --verbose awk x=1 done sed then local | then &&
+grep done 'quoted text' readonly printf done sed cd test then
+		readonly printf /usr/bin "$1" 2>/dev/null 'quoted text' /usr/bin echo local done
+		--verbose printf | echo 2>/dev/null -eu local
+	readonly export export then printf readonly && local
+	-eu "$@" | export then readonly sed printf done awk echo "$1" test printf --verbose
+		printf awk -eu local export then printf export
+local cd ${HOME} && "$1" echo
+cd --verbose "$1" "$1" awk local cd | x=1 'quoted text' grep x=1 export local
+'quoted text' local 2>/dev/null printf
+"$1" printf awk grep 2>/dev/null x=1 printf local
+	2>/dev/null "$1" ${HOME} "$1" $(pwd)
+awk grep export echo 2>/dev/null export readonly && cd --verbose
+		x=1 echo $(pwd) readonly test done grep test readonly echo done echo
+		"$1" "$@" --verbose $(pwd) 'quoted text'
+		cd cd grep "$1" awk local --verbose
+"$1" -eu cd sed x=1 $(pwd)
+x=1 local ${HOME} 2>/dev/null --verbose grep x=1 awk then 2>/dev/null "$@"
+		x=1 export | 'quoted text'
+printf test "$@" -eu readonly
+	--verbose -eu 'quoted text' done "$1" done done local
+	cd sed ${HOME} local printf echo local
+	export --verbose $(pwd) sed $(pwd)
+grep test --verbose $(pwd) cd "$1" 2>/dev/null export 'quoted text'
+"$1" 'quoted text' $(pwd) /usr/bin "$1" "$@" $(pwd) test readonly
+		test 'quoted text' printf test 'quoted text'
+		$(pwd) local grep export 2>/dev/null /usr/bin echo /usr/bin test
+'quoted text' $(pwd) done 2>/dev/null "$1" &&
+		"$1" echo && 'quoted text' cd cd | done grep "$1" readonly
+echo "$1" x=1 then --verbose x=1 x=1 then
+		'quoted text' cd /usr/bin "$@" | --verbose | /usr/bin $(pwd) $(pwd)
+	local grep | "$1" "$@" grep awk then | local test --verbose $(pwd)
+/usr/bin done 2>/dev/null --verbose 2>/dev/null $(pwd)
+		x=1 -eu | && 2>/dev/null
+	$(pwd) --verbose | -eu printf "$1" ${HOME} sed test done sed |
+		${HOME} --verbose "$1" /usr/bin --verbose
+		cd printf cd x=1 "$1" x=1 echo printf done x=1 local x=1
+		local -eu $(pwd) && $(pwd) test "$@"
+readonly sed test 2>/dev/null && sed grep then 2>/dev/null
+		x=1 --verbose 'quoted text'
+	"$@" "$1" local grep sed then export sed grep ${HOME} ${HOME}
+	awk awk readonly -eu && --verbose awk grep x=1 | /usr/bin
+x=1 awk test 2>/dev/null awk
+		2>/dev/null cd readonly done
+	grep cd 'quoted text' -eu then then 'quoted text' "$@" x=1
+| && 2>/dev/null sed printf /usr/bin grep done "$1" printf
+		--verbose --verbose done "$1" local done cd "$1" printf export x=1 done grep
+		$(pwd) echo grep done "$1" sed && "$@" -eu test then export /usr/bin
+awk $(pwd) cd sed -eu done 'quoted text' /usr/bin printf then
+		grep grep ${HOME} x=1 test export $(pwd) test -eu
+	--verbose /usr/bin ${HOME} done
+--verbose then then done
+then echo grep --verbose
+"$1" printf sed done cd $(pwd)
+		test && /usr/bin readonly done /usr/bin test readonly readonly
+	printf sed awk | /usr/bin readonly
+	"$@" done -eu $(pwd) export sed x=1 $(pwd) local &&
+local $(pwd) 'quoted text' export
+		awk grep cd test printf printf awk 2>/dev/null
+		echo /usr/bin cd printf printf $(pwd)
+export printf "$1" | local test && local local local "$@" /usr/bin
+		sed -eu grep --verbose export 2>/dev/null
+		x=1 done done "$@" awk then test readonly
+		echo then readonly cd readonly
+	$(pwd) | 2>/dev/null grep | "$1" ${HOME} done grep sed && test local done -eu
+cd local -eu done cd && awk --verbose --verbose grep local sed grep
+-eu cd then test && local local /usr/bin -eu export "$@" readonly done then
+	printf /usr/bin awk export 'quoted text' | --verbose 'quoted text' x=1
+	"$@" --verbose export | ${HOME} printf | ${HOME} "$1"
+	export "$@" 2>/dev/null
+local readonly then then 2>/dev/null
+	2>/dev/null "$@" 'quoted text'
+echo $(pwd) test sed && awk "$@" $(pwd) export 'quoted text' $(pwd) echo 2>/dev/null
+test then cd cd cd test done test printf --verbose /usr/bin awk cd | printf -eu
+		test 2>/dev/null printf cd && 2>/dev/null x=1 /usr/bin sed grep | awk readonly
+cd 'quoted text' "$@"
+test readonly && grep done /usr/bin 2>/dev/null 2>/dev/null -eu cd
+	cd --verbose cd $(pwd) "$1" && x=1 /usr/bin "$1" -eu readonly x=1 x=1 -eu
+		awk readonly echo local sed 2>/dev/null 2>/dev/null
+-eu ${HOME} export readonly ${HOME} local --verbose | local cd -eu
+cd -eu "$1" /usr/bin --verbose --verbose x=1 "$1" awk |
+	&& printf ${HOME} local 'quoted text' done && /usr/bin ${HOME} && /usr/bin
+	&& 'quoted text' test readonly 2>/dev/null then test
+	--verbose grep && -eu sed readonly -eu done 2>/dev/null cd 'quoted text' export
+	-eu sed local x=1 then ${HOME} export
+		echo test 2>/dev/null printf then /usr/bin echo printf
+	readonly ${HOME} cd readonly &&
+		sed printf grep test | x=1 test "$1"
+	printf local "$1" && grep test --verbose printf /usr/bin
+		2>/dev/null cd grep printf
+		| $(pwd) readonly printf sed done sed --verbose 'quoted text' cd echo -eu &&
+"$1" echo sed 2>/dev/null "$1"
+	awk x=1 export /usr/bin sed grep -eu cd local echo sed local printf
+export -eu --verbose awk grep "$1" ${HOME} $(pwd)
+readonly 'quoted text' grep 'quoted text'
+		then grep "$@" cd | done && -eu echo done 2>/dev/null export && 'quoted text'
+	awk printf --verbose grep local export
+${HOME} 'quoted text' local && readonly -eu readonly
+		export x=1 echo local grep sed ${HOME} echo /usr/bin ${HOME}
+	sed cd grep grep printf /usr/bin | "$@" awk then local x=1 ${HOME} x=1
+		-eu echo -eu && printf
+		${HOME} "$@" done then /usr/bin -eu test | awk printf awk echo readonly printf
+		'quoted text' awk cd --verbose grep 2>/dev/null done | done printf echo
+		readonly | -eu "$@" export 'quoted text' awk
+	$(pwd) printf then grep local 'quoted text' /usr/bin
+#include c20.sh
+		echo then -eu awk readonly
+		then -eu test -eu export test test 2>/dev/null | grep /usr/bin
+		export "$1" test grep | && | 2>/dev/null
+| readonly local done /usr/bin 'quoted text'
+done test export "$@" sed printf grep done echo done local && echo 'quoted text'
+		test echo readonly && readonly done
+&& -eu export sed 2>/dev/null
+export -eu -eu "$@" echo "$1" done then then "$1" then sed
+	echo && 2>/dev/null cd then readonly ${HOME} "$1" 2>/dev/null export then
+awk readonly | then export "$1" readonly local test "$1" grep grep
+	"$1" 'quoted text' cd /usr/bin
+x=1 done export then export echo readonly
+		'quoted text' then readonly x=1 x=1 x=1 2>/dev/null export -eu printf sed
+	"$@" && | export done sed "$1" $(pwd) "$@" -eu cd readonly 2>/dev/null 2>/dev/null
+		"$1" "$1" -eu then 'quoted text' $(pwd) grep echo sed $(pwd) cd local
+	"$@" "$1" $(pwd) local x=1
+--verbose printf done cd ${HOME} sed sed export
+| /usr/bin --verbose local "$1" && grep /usr/bin
+	grep then x=1 | 2>/dev/null sed 'quoted text'
+	/usr/bin x=1 && 'quoted text' $(pwd) sed readonly | grep && export ${HOME} "$1"
+readonly $(pwd) done grep export 'quoted text'
+		"$1" -eu $(pwd) x=1 local done test
+	/usr/bin sed cd && && awk export $(pwd) -eu cd then sed done
+test && && $(pwd) test export readonly
+	export export | 'quoted text' local "$@"
+		2>/dev/null 'quoted text' $(pwd) x=1 done --verbose echo printf echo
+printf then sed 2>/dev/null
+	test echo $(pwd) then --verbose /usr/bin && local $(pwd) 'quoted text'
+	| && local printf $(pwd) x=1 sed then done done
+		"$1" grep done 2>/dev/null printf local $(pwd) then echo done 'quoted text'
+		| then export --verbose cd local 2>/dev/null | grep "$1" local "$@"
+	grep x=1 $(pwd) x=1 then awk local test -eu done
+grep -eu x=1 sed grep readonly ${HOME}
+	sed 'quoted text' ${HOME} 2>/dev/null
+	awk "$1" -eu done x=1 cd -eu $(pwd)
+	local sed echo --verbose "$@" 2>/dev/null -eu -eu done x=1 test printf
+		printf 2>/dev/null "$1" done
+cd cd "$1" 2>/dev/null -eu "$1" -eu -eu echo /usr/bin done grep
+	"$@" awk local "$1" sed && $(pwd) "$@" 'quoted text'
+	/usr/bin "$@" done export readonly "$1"
+	--verbose local echo $(pwd)
+2>/dev/null 2>/dev/null x=1 'quoted text' printf | | /usr/bin | readonly
+		&& && -eu local awk "$1" printf 'quoted text' 2>/dev/null local local
+	'quoted text' && then ${HOME} --verbose "$1" x=1 x=1 "$1" cd then | 'quoted text'
+		cd $(pwd) "$@" sed done /usr/bin echo readonly echo
+		-eu 'quoted text' && --verbose | test
+		grep --verbose -eu test "$@" 'quoted text' test test
+	echo $(pwd) readonly sed test grep then export
+/usr/bin x=1 --verbose export -eu x=1 'quoted text'
+		sed then ${HOME} -eu cd echo export test local sed local --verbose readonly
+test awk 'quoted text' x=1 x=1 local local
+export ${HOME} "$@" 'quoted text'
+printf /usr/bin printf export "$1" 'quoted text' test "$@" cd x=1 test export
+		"$1" $(pwd) $(pwd) $(pwd) 'quoted text' "$@" "$1" ${HOME} 'quoted text'
+'quoted text' readonly
+		test 'quoted text' sed test sed "$1" --verbose 2>/dev/null $(pwd) /usr/bin
+	printf && sed then awk
+done "$1" 2>/dev/null /usr/bin --verbose $(pwd) then test sed
+		cd echo $(pwd) "$@" --verbose cd x=1 -eu
+-eu local awk echo x=1 local test grep 2>/dev/null "$1" /usr/bin sed
+	grep awk echo --verbose x=1 then local awk grep /usr/bin "$@" -eu sed
+&& ${HOME} echo test && cd && --verbose | cd printf /usr/bin -eu grep
+echo /usr/bin 'quoted text' awk 'quoted text' $(pwd)
+	awk && | test 2>/dev/null -eu grep echo local && printf
+grep "$1" && "$1" 2>/dev/null
+	test ${HOME} 'quoted text' --verbose /usr/bin "$1" sed 'quoted text'
+export grep test && awk test printf /usr/bin "$@"
+grep ${HOME} then $(pwd) ${HOME} ${HOME} printf ${HOME}
+grep then "$@" x=1 x=1 /usr/bin && then && -eu $(pwd) export echo
+		echo printf test x=1 ${HOME} ${HOME} local | then ${HOME}
+		then $(pwd) 2>/dev/null
+awk grep awk export --verbose printf 2>/dev/null export $(pwd) done
+	2>/dev/null then cd readonly sed done sed then x=1 then 2>/dev/null
+		grep printf grep awk test "$@"
+done "$1" done 2>/dev/null
+2>/dev/null cd /usr/bin $(pwd) export printf echo cd export /usr/bin test
+		test readonly "$@" "$@" export readonly
+cd sed local then local then 'quoted text'
+	$(pwd) test | echo done printf
+printf echo grep ${HOME} awk 'quoted text' export test grep /usr/bin 'quoted text'
+"$@" printf -eu "$@" 'quoted text' "$1" grep test cd readonly ${HOME} test $(pwd)
+	export echo test cd awk 2>/dev/null "$@" $(pwd) then
+		awk cd && x=1 grep sed x=1 local "$1" export test grep echo
+		-eu test --verbose printf local sed $(pwd) 'quoted text' $(pwd)
+echo then echo readonly grep ${HOME} &&
+		"$@" "$1" x=1 --verbose --verbose ${HOME} export test local grep
+		| 'quoted text' awk done sed /usr/bin && && sed $(pwd)
+	'quoted text' | -eu | test "$@" ${HOME}
+	${HOME} echo printf ${HOME}
+	${HOME} $(pwd) awk sed x=1
+	done echo /usr/bin awk echo 'quoted text' cd $(pwd) done -eu --verbose | | 'quoted text'
+		"$1" cd "$@" x=1 2>/dev/null export | cd "$@" awk --verbose
+-eu test grep test sed ${HOME} "$1" -eu grep
+		echo 2>/dev/null "$1" grep
+--verbose printf x=1 --verbose test $(pwd) 2>/dev/null
+| printf sed sed --verbose done local echo awk echo -eu "$1"
+export "$@" grep readonly done
+		done $(pwd) sed 'quoted text' then && printf "$1" awk
+		"$@" ${HOME} "$@" | $(pwd) awk local grep && echo
+	printf "$@" readonly 2>/dev/null x=1 export
+		&& $(pwd) printf readonly readonly --verbose done sed /usr/bin
+'quoted text' then readonly x=1
+		| /usr/bin printf x=1 'quoted text' | -eu "$1" --verbose done "$@"
+		/usr/bin echo awk && -eu | sed 2>/dev/null sed --verbose
+sed then | 2>/dev/null echo 'quoted text' local "$@" readonly x=1 &&
+grep 'quoted text' /usr/bin echo $(pwd) "$1" $(pwd) done test grep
+	test /usr/bin --verbose awk | && echo $(pwd) awk export 'quoted text' done --verbose
+		-eu | -eu "$1" done "$1" echo ${HOME} readonly -eu then grep
+--verbose printf ${HOME} -eu done test -eu 2>/dev/null -eu |
+	local "$@" 'quoted text' then echo export -eu readonly
+		grep test "$@" "$1" awk cd echo 'quoted text' sed $(pwd) /usr/bin
+--verbose local local -eu then
+		grep printf test && "$@" export export | 'quoted text' then local
+	&& "$@" ${HOME} x=1 then readonly --verbose cd && 2>/dev/null $(pwd) echo 2>/dev/null
+then echo test $(pwd) export printf
+		export awk "$1" | 2>/dev/null $(pwd) test
+	test then x=1 grep /usr/bin && 2>/dev/null export --verbose sed "$@" x=1
+x=1 printf local awk sed readonly
+	"$@" x=1 awk "$1" awk test sed 'quoted text' "$1" readonly done -eu /usr/bin
+		&& printf "$@" /usr/bin 2>/dev/null /usr/bin "$1" 'quoted text' then test
+test cd && x=1 -eu "$1" awk "$1" -eu "$1" then "$1" x=1 then sed then /usr/bin
+done readonly /usr/bin 'quoted text' test test 'quoted text' sed 'quoted text'
+sed sed readonly ${HOME}
+		&& --verbose echo && then done cd sed
+--verbose sed x=1 awk test sed then grep $(pwd)
+test ${HOME} test /usr/bin | /usr/bin /usr/bin 'quoted text'
+	"$@" -eu echo sed "$1" sed grep ${HOME} export echo grep $(pwd) 'quoted text'
+	"$@" echo /usr/bin "$1" readonly
+	"$1" ${HOME} export test then "$1" grep 2>/dev/null && ${HOME} export echo
+	printf sed printf $(pwd) "$1" awk done awk printf
+	readonly grep -eu local ${HOME} ${HOME} -eu done $(pwd) && echo then cd cd printf
+		export && readonly 'quoted text' awk ${HOME}
+		/usr/bin "$@" grep /usr/bin 'quoted text' -eu export && awk readonly
+		-eu $(pwd) test 2>/dev/null "$@" done | echo sed "$@" awk printf
+	sed --verbose "$1" 2>/dev/null
+		&& test grep | sed --verbose sed test export ${HOME} ${HOME}
+| "$@" ${HOME} cd export grep $(pwd) ${HOME} test
+done readonly ${HOME} sed
+$(pwd) -eu --verbose sed && cd "$1" done &&
+		echo cd cd readonly readonly then -eu 2>/dev/null
+export awk /usr/bin readonly grep 'quoted text'
+		readonly $(pwd) -eu 2>/dev/null 2>/dev/null readonly grep "$1" printf
+	2>/dev/null --verbose sed 'quoted text' echo echo cd local
+	2>/dev/null awk 'quoted text' x=1 export sed done
+		2>/dev/null -eu done cd 'quoted text'
+	readonly readonly grep echo "$1" | done local
+2>/dev/null printf sed sed sed | ${HOME}
+		${HOME} ${HOME} "$1" /usr/bin
+	"$@" then sed -eu x=1 awk then
+"$1" export 'quoted text' local then /usr/bin --verbose done && --verbose
+		done readonly export -eu test done done &&
+readonly test "$1" printf cd "$1" grep printf x=1 x=1 /usr/bin ${HOME}
+"$1" "$@" cd ${HOME} echo
+'quoted text' then x=1
+$(pwd) /usr/bin cd -eu | ${HOME} --verbose | 2>/dev/null x=1 cd ${HOME}
+awk readonly x=1 then
+	local $(pwd) "$1" "$@" export 'quoted text'
+		readonly --verbose grep awk sed sed --verbose sed 2>/dev/null
+		'quoted text' cd -eu printf $(pwd) && -eu readonly
+2>/dev/null awk -eu $(pwd) sed done cd local cd printf echo
+	done printf $(pwd) && --verbose printf ${HOME} --verbose readonly then
+		| 'quoted text' then x=1 -eu
+grep --verbose 'quoted text' 2>/dev/null grep
+		2>/dev/null 2>/dev/null
+	x=1 printf --verbose 2>/dev/null | x=1 test "$1" $(pwd)
+	--verbose printf && 'quoted text'
+printf /usr/bin readonly /usr/bin ${HOME} cd test | done | "$@" then 2>/dev/null
+		printf ${HOME} done done --verbose $(pwd) sed sed echo ${HOME} printf readonly
+	/usr/bin $(pwd) "$@" /usr/bin -eu 2>/dev/null
+	cd "$@" | ${HOME} x=1 export
+cd 'quoted text' --verbose
+		| then x=1 /usr/bin "$@"
+	then local export $(pwd) local test /usr/bin readonly
+-eu x=1 export -eu done
+	printf done printf awk --verbose test 'quoted text'
+	printf $(pwd) "$@" cd local echo awk awk --verbose
+/usr/bin $(pwd) printf ${HOME} echo grep done "$1" sed echo
+	awk x=1 readonly $(pwd) export
+	done cd | ${HOME} echo "$@" grep 2>/dev/null 'quoted text'
+	printf --verbose --verbose
+	export done grep x=1
+	awk ${HOME} export x=1 x=1 done grep --verbose ${HOME} local x=1 $(pwd) readonly
+	"$@" /usr/bin && grep "$1" $(pwd)
+cd local local then | grep
+| cd ${HOME} --verbose then printf
+		awk awk then test cd readonly x=1 && 2>/dev/null 2>/dev/null test then awk
+$(pwd) "$@" then awk 2>/dev/null readonly printf 2>/dev/null "$1"
+		echo 2>/dev/null echo ${HOME} sed then -eu 'quoted text' 'quoted text' printf
+"$@" export "$1" sed 2>/dev/null
+/usr/bin && | --verbose cd 2>/dev/null ${HOME} 'quoted text' test 2>/dev/null
+local cd ${HOME} awk | && done echo $(pwd) printf printf
+		test echo "$1" 2>/dev/null | local | ${HOME}
+printf --verbose echo x=1 | awk 'quoted text' "$@" readonly "$1" sed
+	/usr/bin cd local test --verbose 2>/dev/null
+		--verbose done ${HOME} echo "$1" ${HOME} printf
+	printf echo awk awk "$@" ${HOME} "$@" 2>/dev/null test ${HOME} sed /usr/bin
+then $(pwd) --verbose "$1" /usr/bin 2>/dev/null sed "$1" readonly
+&& && | readonly local then local
+readonly sed done x=1 'quoted text'
+		&& echo sed then && awk local /usr/bin ${HOME} local test && then sed $(pwd)
+	"$1" printf "$1" then printf
+2>/dev/null done test 2>/dev/null grep && printf grep printf $(pwd) --verbose
+'quoted text' -eu echo "$1" 'quoted text' awk -eu cd cd echo -eu -eu -eu done done
+		local readonly printf ${HOME} x=1 test grep -eu printf done done "$@"
+export "$@" --verbose && then
+	&& printf sed awk then readonly -eu 2>/dev/null
+		local local test 2>/dev/null export /usr/bin
+	x=1 2>/dev/null x=1 awk
+	--verbose cd echo done -eu
+		cd ${HOME} test cd 2>/dev/null
+local $(pwd) printf echo export ${HOME} --verbose -eu export local x=1 then done
+then x=1 x=1 --verbose
+	-eu 2>/dev/null && printf --verbose test grep then echo
+	readonly grep ${HOME} test readonly test --verbose | | echo done awk 'quoted text'
+| awk echo --verbose done /usr/bin
+	/usr/bin printf /usr/bin sed $(pwd) echo x=1 "$@"
+export cd && local && 2>/dev/null readonly $(pwd) && "$@" printf sed local export
+	/usr/bin echo export awk done awk -eu "$@"
+$(pwd) cd export ${HOME} printf done printf
+		-eu -eu -eu then /usr/bin then "$@" export
+local test && awk -eu printf $(pwd) 'quoted text' local
+awk $(pwd) printf readonly "$1" -eu done 2>/dev/null | test
+		| | export $(pwd) $(pwd) $(pwd)
+&& && x=1 'quoted text' x=1 && awk ${HOME}
+		x=1 --verbose local then && "$1" local
+		/usr/bin done readonly -eu | --verbose 2>/dev/null
+		2>/dev/null sed local && then readonly
+echo echo x=1 local test
+		test 'quoted text' -eu printf 'quoted text' --verbose
+test 'quoted text' cd test $(pwd) --verbose done sed echo
+		"$@" 'quoted text' sed local
+awk echo test done | awk 2>/dev/null sed -eu awk sed local "$@" "$1" 'quoted text'
+		readonly echo -eu "$1" test ${HOME}
+/usr/bin grep test --verbose cd grep
+	-eu test cd cd echo 2>/dev/null cd awk readonly 2>/dev/null test x=1 test printf
+&& $(pwd) cd export | then 'quoted text' then "$1" 'quoted text' grep
+	test readonly awk ${HOME} 'quoted text' ${HOME} grep
+	echo "$@" "$1" cd export readonly sed x=1 ${HOME} readonly | "$@" && grep $(pwd)
+		done && printf -eu readonly 'quoted text' -eu 2>/dev/null
+		"$1" sed sed readonly -eu 2>/dev/null done
+		"$@" awk -eu --verbose export /usr/bin -eu
+		echo export test test export then "$@" 2>/dev/null $(pwd) printf printf -eu done
+	grep then grep cd "$1" grep readonly "$1" export "$@" echo sed test test
+		local 'quoted text' export cd 'quoted text' done readonly 'quoted text' printf
+x=1 local sed done readonly
+	cd /usr/bin printf awk done awk ${HOME} echo 'quoted text' /usr/bin
+"$@" local readonly readonly --verbose
+$(pwd) done readonly sed export | x=1 grep sed done grep local printf
+	readonly | -eu readonly ${HOME} 'quoted text' 2>/dev/null "$@" $(pwd)
+		export --verbose "$@" ${HOME} x=1 /usr/bin 2>/dev/null "$1" --verbose grep 'quoted text'
+	-eu readonly -eu x=1 2>/dev/null /usr/bin x=1 echo 2>/dev/null "$@" sed -eu export
+"$@" $(pwd) awk && "$@" 'quoted text' /usr/bin 'quoted text' printf
+		then export then echo echo | "$1" 2>/dev/null done awk
+		sed -eu "$1" x=1 $(pwd) --verbose $(pwd) readonly printf grep test 'quoted text'
+	printf readonly done && sed /usr/bin
+	&& done "$1" sed "$@" test x=1
+		awk | then done ${HOME} export echo -eu sed then && printf -eu test readonly ${HOME}
+		export | x=1 awk 2>/dev/null echo /usr/bin 'quoted text' echo -eu test
+	export grep x=1 done readonly "$1"
+export | export cd x=1 && awk cd | awk "$@" | x=1 "$1" readonly |
+	awk 2>/dev/null "$1" | ${HOME} /usr/bin export x=1 2>/dev/null
+	sed x=1 && cd then cd readonly
+then x=1 $(pwd) && ${HOME} readonly sed 'quoted text' | done -eu | && --verbose
+2>/dev/null local ${HOME} ${HOME} 'quoted text' 2>/dev/null printf cd
+readonly readonly | "$1" done ${HOME} 'quoted text' awk
+		$(pwd) printf export -eu 'quoted text' &&
+		export x=1 awk awk $(pwd) readonly
+2>/dev/null echo export then
+	| && cd "$1" $(pwd) printf --verbose test $(pwd) "$@" then ${HOME} grep
+2>/dev/null /usr/bin --verbose readonly
+export done && 'quoted text' export printf awk readonly
+	'quoted text' "$@" readonly 'quoted text' /usr/bin then -eu readonly
+	-eu echo printf -eu local test export 2>/dev/null ${HOME} x=1 readonly cd grep
+		--verbose export 2>/dev/null readonly -eu 2>/dev/null
+	grep "$1" then --verbose
+| && "$@" "$@" grep test grep 2>/dev/null
+		$(pwd) | 'quoted text' cd 'quoted text'
+x=1 $(pwd) ${HOME} sed cd done | test &&
+test x=1 | cd -eu then test
+x=1 printf sed export && sed && printf test x=1
+	then $(pwd) /usr/bin 'quoted text'
+/usr/bin && echo test test readonly cd awk 'quoted text' -eu x=1
+		x=1 awk -eu "$1" then done --verbose | 'quoted text' echo ${HOME} readonly
+local then x=1 "$1" done x=1 | $(pwd) test then 'quoted text'
+		grep $(pwd) 2>/dev/null && && x=1 |
+	local grep "$@" then then awk 2>/dev/null ${HOME}
+		"$1" then done x=1 awk --verbose /usr/bin local printf export
+--verbose && export "$1" $(pwd) -eu ${HOME} then grep
+'quoted text' test ${HOME}
+		cd -eu "$@" printf readonly echo $(pwd) --verbose export printf done --verbose
+		local "$1" echo test 2>/dev/null echo x=1 done then && 2>/dev/null
+	${HOME} printf readonly 2>/dev/null ${HOME} &&
+	printf local ${HOME} local cd local done
+grep /usr/bin --verbose 'quoted text'
+		$(pwd) echo "$1" | "$1" export grep x=1 local cd then "$1" local $(pwd)
+		/usr/bin readonly sed
+		export -eu grep | 'quoted text' test readonly $(pwd) then
+		/usr/bin cd local 2>/dev/null export done then /usr/bin
+		cd --verbose /usr/bin "$@" $(pwd) echo 2>/dev/null
+	printf && grep && "$1" 2>/dev/null
+	readonly "$1" printf printf cd | | 'quoted text' -eu local
+export 'quoted text' /usr/bin echo $(pwd) | --verbose awk "$1"
+	grep ${HOME} test "$1" export local "$1" ${HOME} local && 2>/dev/null export $(pwd)
+		"$1" | $(pwd) then "$1" "$@" --verbose --verbose /usr/bin $(pwd)
+readonly readonly 2>/dev/null -eu then --verbose
+	/usr/bin export $(pwd) echo readonly "$@"
+local echo printf sed export grep $(pwd) grep && export export awk ${HOME}
+then | /usr/bin /usr/bin export --verbose
+	local $(pwd) export ${HOME} grep --verbose ${HOME} -eu -eu
+	| "$@" sed "$@" then awk cd 2>/dev/null -eu cd
+	$(pwd) "$1" readonly $(pwd) | test --verbose export 'quoted text'
+	echo test ${HOME} --verbose
+	${HOME} printf /usr/bin test then sed --verbose 'quoted text'
+done x=1 $(pwd) -eu sed cd cd readonly x=1 --verbose test echo
+	$(pwd) grep /usr/bin test x=1 x=1 awk /usr/bin 'quoted text' && /usr/bin
+		local /usr/bin printf
+		"$1" cd printf sed sed $(pwd) $(pwd) sed /usr/bin /usr/bin
+	awk done $(pwd) "$@" awk echo test sed
+	/usr/bin export $(pwd) test cd awk sed "$@" sed
+	2>/dev/null printf sed echo grep grep local --verbose | x=1 echo echo
+"$@" | --verbose then "$1" ${HOME} sed test done -eu
+	/usr/bin | && echo cd test "$1" then test --verbose
+	| $(pwd) then /usr/bin x=1 readonly
+		echo $(pwd) /usr/bin printf --verbose cd test readonly awk -eu then
+		-eu printf ${HOME} then then -eu test then sed printf
+		cd | 2>/dev/null export ${HOME} done | -eu done $(pwd)
+		test "$1" 'quoted text' printf
+readonly grep ${HOME} "$@"
+grep done /usr/bin done
+		export grep sed export awk done -eu "$@" cd done then ${HOME} $(pwd)
+readonly sed -eu done x=1 awk local printf ${HOME} --verbose
+	--verbose readonly | sed echo && --verbose $(pwd)
+		echo local && ${HOME} 2>/dev/null 2>/dev/null $(pwd) done x=1 x=1 2>/dev/null
+export /usr/bin echo sed done awk local | /usr/bin
+		2>/dev/null -eu && 2>/dev/null | readonly
+	&& grep "$1" done /usr/bin grep done export done grep ${HOME} "$@" then
+readonly "$1" readonly 2>/dev/null done 2>/dev/null local echo awk | -eu done
+	"$1" && printf cd printf 2>/dev/null "$1" export
+	${HOME} local /usr/bin then
+	-eu readonly done --verbose test "$@" local /usr/bin -eu &&
+	$(pwd) 2>/dev/null | $(pwd)
+		$(pwd) printf 'quoted text' --verbose local
+		printf local --verbose ${HOME} ${HOME} sed
+	"$@" | x=1 echo awk 2>/dev/null readonly awk done done
+printf cd x=1 "$@" awk 'quoted text' x=1 && 'quoted text' cd -eu awk ${HOME} $(pwd)
+	grep "$1" done then echo readonly | /usr/bin | awk | --verbose "$1"
+'quoted text' && && grep grep sed -eu && && 2>/dev/null echo
+	| awk ${HOME} --verbose ${HOME} then /usr/bin /usr/bin
+	"$@" local done grep test "$@" | "$1" awk sed local sed x=1 then
+/usr/bin sed --verbose
+echo $(pwd) cd 'quoted text'
+cd -eu cd awk && done echo -eu export done export x=1 ${HOME} grep printf
+sed done | x=1 x=1 local sed 'quoted text' ${HOME}
+		awk grep local 2>/dev/null then $(pwd) readonly
+$(pwd) sed export ${HOME} $(pwd)
+	printf echo "$@" ${HOME}
+	"$@" "$1" 'quoted text' --verbose readonly test /usr/bin printf
+-eu grep local readonly done
+		&& | cd readonly grep "$1" test ${HOME} cd local done sed awk echo
+--verbose test echo ${HOME}
+echo --verbose "$1" local -eu "$@" local done && "$1" export sed
+	&& printf $(pwd) 'quoted text'
+		$(pwd) test sed done | local printf cd --verbose then ${HOME}
+		/usr/bin /usr/bin /usr/bin echo 2>/dev/null local cd test "$@" "$1" 2>/dev/null
+		cd awk echo done ${HOME} sed sed cd readonly awk --verbose
+		test && 2>/dev/null "$@" $(pwd) cd --verbose $(pwd) done test sed readonly -eu
+then test readonly --verbose "$@" done
+'quoted text' printf "$1" printf 2>/dev/null sed test grep
+	"$1" && printf ${HOME} grep x=1 printf && ${HOME} echo awk grep local export "$@"
+		2>/dev/null local local $(pwd) /usr/bin local
+grep export readonly cd echo export 'quoted text'
+"$@" /usr/bin then done "$1" $(pwd) ${HOME} grep printf readonly
+		export grep /usr/bin --verbose awk test grep grep && printf
+		-eu "$@" done export sed $(pwd) | readonly
+	/usr/bin grep readonly cd export echo test sed test 'quoted text'
+		printf | awk -eu done printf sed $(pwd) ${HOME} --verbose then | x=1 then
+grep --verbose export
+	echo sed $(pwd) "$@" readonly /usr/bin $(pwd) test --verbose $(pwd) /usr/bin
+	echo --verbose grep then local cd awk 2>/dev/null
+	x=1 cd grep -eu && local printf grep then cd --verbose export test 2>/dev/null
+&& awk | export x=1 2>/dev/null
+	readonly | grep readonly /usr/bin --verbose grep 'quoted text' && awk readonly
+	&& && done printf local ${HOME} "$1" /usr/bin --verbose && echo "$1" -eu
+		export x=1 ${HOME} -eu && --verbose awk cd /usr/bin /usr/bin local && cd cd
+x=1 "$@" printf echo "$1" readonly readonly -eu /usr/bin
+	2>/dev/null x=1 $(pwd) | $(pwd) done
+	grep grep then && && /usr/bin
+2>/dev/null ${HOME} --verbose printf
+		&& 'quoted text' ${HOME} "$1" x=1 && echo local awk readonly readonly /usr/bin
+test local readonly "$1"
+	sed local sed 2>/dev/null awk --verbose local readonly
+		/usr/bin echo readonly export 'quoted text' "$1"
+	| "$1" grep awk ${HOME} export -eu test then cd local echo test export readonly
+echo test --verbose grep export ${HOME} $(pwd) printf
+	&& printf readonly printf /usr/bin awk sed local printf --verbose
+export x=1 sed export printf -eu sed printf
+		/usr/bin grep sed 'quoted text' test grep --verbose x=1 x=1 echo
+local ${HOME} export local 'quoted text' local printf $(pwd) x=1 sed
+x=1 local echo --verbose /usr/bin -eu grep printf
+"$@" then /usr/bin "$@" test 'quoted text' --verbose
+local grep -eu cd test "$1" export awk awk done echo && && printf
+$(pwd) sed /usr/bin readonly echo local "$1" -eu local
+	/usr/bin then && readonly echo
+	&& 2>/dev/null -eu then awk printf sed
+	test echo 'quoted text' | /usr/bin
+	awk test grep test x=1
+2>/dev/null x=1 --verbose "$1" cd printf sed
+	$(pwd) x=1 readonly "$1" | readonly && then readonly
+/usr/bin then 2>/dev/null /usr/bin readonly test
+"$1" awk $(pwd) ${HOME} | 'quoted text' echo grep ${HOME} ${HOME} done && /usr/bin
+sed local local local local awk grep done echo && 'quoted text'
+printf export x=1 x=1 readonly echo -eu --verbose 'quoted text'
+		--verbose sed cd x=1 $(pwd) | ${HOME} --verbose 2>/dev/null cd readonly
+		grep x=1 "$@" then local cd printf then --verbose
+		done "$1" then && "$@"
+		then $(pwd) && done done done test -eu local sed /usr/bin --verbose
+&& 'quoted text' test "$1" sed "$@" | 'quoted text'
+	local x=1 done $(pwd) export $(pwd) 2>/dev/null printf 'quoted text'
+		"$@" -eu -eu then --verbose export
+export readonly 'quoted text' done --verbose 2>/dev/null
+		grep $(pwd) $(pwd) "$@"
+	'quoted text' 'quoted text' 'quoted text' readonly test
+		export ${HOME} && awk grep test /usr/bin local echo
+	then local "$@" 'quoted text' 'quoted text'
+	/usr/bin local done | cd done export export -eu | x=1 echo grep readonly
+		--verbose 2>/dev/null 2>/dev/null
+		cd 'quoted text' test grep --verbose done echo cd "$1" 'quoted text'
+test done && | awk echo local x=1 sed printf | "$@" printf 2>/dev/null
+	readonly grep readonly sed "$1"
+	test awk -eu printf "$1" -eu echo grep readonly
+		"$@" echo sed "$@" cd test awk 2>/dev/null "$1"
+-eu cd done 'quoted text' echo printf -eu grep /usr/bin
+		${HOME} grep /usr/bin /usr/bin local
+		"$1" echo /usr/bin echo
+printf && && then x=1 then awk awk readonly
+	echo echo echo test printf printf -eu export /usr/bin then ${HOME}
+		"$@" done test export && echo sed $(pwd) ${HOME} ${HOME}
+		done local "$@" && then readonly $(pwd) 2>/dev/null cd export
+awk printf -eu printf "$@" && 'quoted text' sed sed done "$1"
+	/usr/bin sed && echo grep $(pwd) "$@" /usr/bin sed /usr/bin ${HOME}
+	readonly echo export x=1
+		x=1 export cd readonly echo cd "$@" echo x=1 -eu
+$(pwd) readonly ${HOME} 2>/dev/null grep -eu "$@" x=1
+local "$1" awk sed sed -eu "$@" sed readonly test
+-eu && && | x=1 awk 2>/dev/null
+	&& -eu cd -eu awk 'quoted text' grep printf $(pwd) ${HOME} test
+&& printf $(pwd) --verbose $(pwd) printf 'quoted text' "$1" printf "$@" echo
+	echo | | test /usr/bin readonly -eu "$1" x=1 cd echo readonly $(pwd) export
+/usr/bin "$1" grep "$@" readonly && 'quoted text' readonly done readonly
+export "$1" cd 2>/dev/null 2>/dev/null -eu sed readonly &&
+	sed grep test -eu $(pwd) "$1" test ${HOME} 2>/dev/null "$1" | cd awk
+	awk "$@" ${HOME} x=1 /usr/bin then export printf
+		'quoted text' | sed grep grep sed -eu "$1" done "$@"
+	--verbose readonly printf printf
+&& grep printf test printf $(pwd) then sed sed "$1" 'quoted text' && awk readonly
+		"$1" export then export printf
+	sed sed 2>/dev/null readonly /usr/bin local local -eu done /usr/bin
+		readonly 2>/dev/null && -eu $(pwd) -eu test ${HOME} "$@" cd x=1 then
+		cd /usr/bin /usr/bin 2>/dev/null test local x=1 sed grep sed echo && done
+sed cd $(pwd) $(pwd) readonly 2>/dev/null | && -eu
+		2>/dev/null sed test echo
+	&& printf ${HOME} awk printf cd test && "$@"
+		'quoted text' 'quoted text' ${HOME}
+	export readonly "$1" ${HOME} && sed export x=1 ${HOME}
+		"$@" local "$1" 2>/dev/null x=1 export $(pwd)
+export readonly awk | -eu then export test
+		sed printf readonly | test printf
+'quoted text' sed 'quoted text' 'quoted text'
+		test x=1 'quoted text' "$@" test grep then 2>/dev/null echo done test 2>/dev/null
+readonly awk x=1 && $(pwd) done && ${HOME} | --verbose -eu
+	then --verbose "$1" test printf echo && 'quoted text' test awk sed
+/usr/bin done echo local then /usr/bin "$@" test test cd printf 2>/dev/null
+		then 'quoted text' sed then test printf -eu test test /usr/bin cd done echo grep
+then "$1" $(pwd) echo export sed "$1" x=1 sed && local
+export done x=1 echo echo done
+test done 2>/dev/null echo grep 2>/dev/null
+"$@" sed awk $(pwd) printf test done awk | /usr/bin export local then $(pwd) 2>/dev/null
+		echo sed readonly "$@" -eu $(pwd) ${HOME} cd -eu awk readonly cd 2>/dev/null "$1"
+	"$@" echo | test /usr/bin grep export sed then awk "$1" $(pwd) ${HOME}
+	export grep export echo --verbose "$@" | local readonly sed local
+		readonly 'quoted text' export done done echo done export | done "$@" local
+		-eu printf x=1 cd sed awk
+		-eu "$@" /usr/bin sed 2>/dev/null awk
+		/usr/bin export "$1" sed -eu && "$@" local $(pwd) | --verbose done --verbose
+	${HOME} 2>/dev/null --verbose awk /usr/bin -eu && 2>/dev/null "$1" done
+sed grep -eu -eu ${HOME} then -eu
+	--verbose | -eu cd 2>/dev/null export done export x=1 echo printf then
+		/usr/bin printf echo cd "$1" 2>/dev/null "$1" readonly
+	"$1" cd | "$1" then | then echo test
+"$1" "$@" done x=1 cd done grep sed 2>/dev/null then x=1 2>/dev/null
+awk echo && readonly grep export export printf 2>/dev/null
+		'quoted text' ${HOME} export printf ${HOME} ${HOME} cd sed test "$1" ${HOME}
+		grep export 'quoted text' "$1"
+local "$@" && readonly --verbose ${HOME} echo
+x=1 test /usr/bin /usr/bin 'quoted text'
+		then && awk && printf printf printf readonly && x=1 "$1" ${HOME}
+grep ${HOME} /usr/bin
+	sed awk ${HOME} -eu grep cd "$1"
+$(pwd) readonly awk "$1" 'quoted text' printf echo printf x=1 then done && "$@"
+		-eu "$1" printf 2>/dev/null done ${HOME} && test
+'quoted text' -eu --verbose | local
+	"$@" export 'quoted text' x=1 && local done then then export test
+	${HOME} | then sed sed readonly local "$1" ${HOME} printf 2>/dev/null echo
+	export ${HOME} 'quoted text' $(pwd) x=1 done "$@" | --verbose -eu cd
+	"$1" $(pwd) sed test /usr/bin "$1" cd 'quoted text' 2>/dev/null 2>/dev/null
+test awk cd "$1" ${HOME} "$1" && done x=1 -eu x=1 local x=1 $(pwd)
+	done echo awk "$@" --verbose
+	'quoted text' x=1 export x=1 sed | printf -eu 'quoted text'
+	printf grep export export "$1" /usr/bin
+		x=1 && done done export -eu then done grep ${HOME} readonly grep | test
+		awk awk cd 'quoted text'
+		grep cd cd -eu local readonly
+		grep awk done && "$1" 2>/dev/null export "$@" 2>/dev/null 'quoted text'
+grep /usr/bin cd -eu export grep cd sed local | -eu test 'quoted text'
+		readonly echo "$@" cd printf
+		-eu x=1 printf | printf then --verbose echo echo export echo && cd 'quoted text'
+cd "$1" then 2>/dev/null grep ${HOME} test grep test /usr/bin
+		export ${HOME} local grep x=1 ${HOME} "$1" 'quoted text' $(pwd) /usr/bin
+	${HOME} x=1 awk "$@" && -eu $(pwd) $(pwd) done readonly
+&& /usr/bin "$@" /usr/bin
+	printf sed $(pwd) /usr/bin then test then
+then sed -eu x=1 | ${HOME} x=1 $(pwd) -eu export
+"$1" awk cd local "$1" x=1 printf local
+	"$@" | grep echo -eu ${HOME} readonly
+		export -eu grep --verbose
+	test test done $(pwd) readonly ${HOME} 'quoted text'
+	"$@" --verbose then -eu && sed && | x=1 'quoted text'
+		done --verbose /usr/bin then /usr/bin test
+	"$1" --verbose sed x=1 then ${HOME} ${HOME} $(pwd) $(pwd) awk 2>/dev/null
+		readonly local cd | 'quoted text' 'quoted text' done then printf
+	-eu && readonly sed cd 2>/dev/null x=1 2>/dev/null awk "$@" && --verbose
+		| ${HOME} --verbose "$1" --verbose 2>/dev/null export "$@" export grep | $(pwd)
+	printf sed test then ${HOME} --verbose && export ${HOME} "$@" test grep awk grep
+	"$@" local sed 'quoted text' readonly
+	printf 'quoted text' $(pwd) then "$1" -eu 2>/dev/null echo "$@" awk
+		sed awk test cd awk export
+	"$@" --verbose test printf grep done cd x=1 x=1 ${HOME} | test
+	/usr/bin 2>/dev/null grep printf 'quoted text' | 'quoted text' --verbose local
+| echo done test | awk &&
+	| echo --verbose printf "$1" && echo $(pwd) cd /usr/bin
+"$1" | cd --verbose awk
+--verbose test sed -eu readonly "$1" then readonly 2>/dev/null printf printf
+	test -eu echo && /usr/bin cd awk echo export echo x=1 2>/dev/null
+		echo sed 'quoted text' done grep then
+	printf awk $(pwd) awk grep --verbose readonly local export
+	| "$1" echo export grep && sed --verbose then readonly
+	readonly /usr/bin export cd --verbose
+	then readonly --verbose cd $(pwd)
+	&& grep done local /usr/bin awk grep 'quoted text' "$@" x=1 "$1" printf
+	x=1 done && echo done
+local 'quoted text' local "$1" -eu --verbose printf sed $(pwd) 2>/dev/null
+	--verbose "$@" readonly then
+'quoted text' awk echo 2>/dev/null
+test grep 2>/dev/null /usr/bin -eu /usr/bin
+	-eu 2>/dev/null local -eu | readonly 'quoted text' 'quoted text' /usr/bin
+		done -eu test 2>/dev/null awk ${HOME}
+		done $(pwd) --verbose $(pwd) export && grep awk readonly -eu | printf
+	"$1" $(pwd) ${HOME} -eu echo -eu ${HOME} x=1
+	readonly ${HOME} done "$1" ${HOME} --verbose done grep readonly cd x=1 awk
+"$1" $(pwd) x=1 | done awk && | "$@" awk x=1 x=1 ${HOME} sed -eu cd 'quoted text'
+	export then awk 'quoted text' then
+	-eu "$@" grep sed "$@" x=1 "$1"
+echo "$1" done $(pwd) "$@" && --verbose
+		--verbose then | ${HOME} x=1 awk "$1" && export done then
+	printf sed export test 'quoted text'
+		'quoted text' export "$1" export --verbose x=1 grep test 2>/dev/null
+		| then | "$@" /usr/bin | printf test awk local && /usr/bin done
+	--verbose "$@" echo "$1" grep &&
+		${HOME} /usr/bin printf |
+cd 'quoted text' sed /usr/bin cd 2>/dev/null 2>/dev/null
+		grep test 'quoted text' test local x=1 export test $(pwd) --verbose awk
+	/usr/bin /usr/bin /usr/bin
+2>/dev/null "$1" printf cd $(pwd) /usr/bin
+	"$@" printf then 2>/dev/null done
+	| x=1 done 'quoted text' printf local echo awk
+"$@" local 'quoted text' 2>/dev/null done done -eu cd test x=1 ${HOME}
+	$(pwd) grep 'quoted text' local x=1 cd -eu ${HOME} && 2>/dev/null
+${HOME} "$@" readonly sed --verbose $(pwd) sed --verbose done /usr/bin 2>/dev/null
+	2>/dev/null done x=1 grep /usr/bin | x=1 cd x=1 $(pwd) -eu "$@"
+	awk | $(pwd) grep local && | --verbose local 2>/dev/null | 'quoted text'
+		"$1" export sed ${HOME} --verbose readonly x=1 $(pwd) 'quoted text' 2>/dev/null
+'quoted text' done /usr/bin "$1" && x=1 &&
+grep ${HOME} 'quoted text' x=1 x=1 'quoted text' export "$@" then -eu local awk
+&& -eu awk printf readonly x=1 test sed printf 'quoted text' awk
+readonly awk cd | x=1 -eu done
+	&& local $(pwd) x=1 printf
+		local $(pwd) echo -eu "$1" -eu sed -eu sed 2>/dev/null
+		| ${HOME} cd /usr/bin -eu "$1" printf | && --verbose sed
+readonly x=1 local 'quoted text' sed "$1" export echo /usr/bin && done
+	/usr/bin x=1 then 'quoted text' readonly 'quoted text' test then --verbose --verbose
+	test "$@" $(pwd) -eu then
+	done x=1 ${HOME} $(pwd) sed 2>/dev/null "$@"
+echo $(pwd) 'quoted text' 'quoted text'
+		"$1" x=1 grep done export --verbose echo local sed
+		/usr/bin test printf test 'quoted text' grep then cd awk -eu test
+		readonly -eu readonly grep --verbose | ${HOME}
+	echo printf /usr/bin && ${HOME}
+	$(pwd) local -eu sed 2>/dev/null
+		"$1" --verbose sed echo
+		--verbose 'quoted text' "$@" /usr/bin then 'quoted text'
+export test sed sed /usr/bin
+	cd ${HOME} "$@" awk ${HOME} | grep echo --verbose
+	grep 'quoted text' awk --verbose
+	&& sed sed local grep awk sed $(pwd)
+	&& test --verbose local ${HOME}
+awk cd && ${HOME} && /usr/bin awk
+grep awk 'quoted text' grep awk done export /usr/bin
+	| done done cd done "$@"
+		${HOME} local done /usr/bin test
+	grep readonly 2>/dev/null $(pwd) /usr/bin awk && "$1" done then printf then
+	x=1 'quoted text' export then then grep done readonly local sed cd readonly
+	${HOME} "$1" awk x=1 "$@" "$@" 'quoted text' grep --verbose ${HOME}
+sed "$@" 'quoted text'
+2>/dev/null 2>/dev/null $(pwd) printf cd --verbose sed
+		local then 2>/dev/null awk then grep -eu --verbose 2>/dev/null grep awk -eu
+--verbose 'quoted text' cd | 2>/dev/null echo sed grep -eu 2>/dev/null $(pwd)
+	awk then | "$1" --verbose
+'quoted text' readonly done test x=1 /usr/bin "$1" $(pwd) | local cd x=1 x=1
+	cd cd | readonly test && "$1"
+		cd --verbose 'quoted text'
+printf | grep then "$@" printf cd awk done local test && -eu
+		cd 2>/dev/null ${HOME} test 'quoted text' /usr/bin
+		| readonly export test printf | test "$@" then
+	awk --verbose 'quoted text' readonly /usr/bin
+&& printf "$@" export
+	-eu x=1 "$@" readonly | local export 2>/dev/null cd "$1" ${HOME}
+cd awk echo cd awk --verbose -eu export done awk local readonly
+	echo && --verbose $(pwd) /usr/bin echo grep grep ${HOME}
+		sed | then "$1" /usr/bin | "$1" $(pwd) awk printf
+$(pwd) "$@" echo cd local x=1 &&
+		'quoted text' -eu grep --verbose "$@" test 2>/dev/null
+	export grep done printf local then readonly
+		/usr/bin /usr/bin x=1 cd -eu local -eu ${HOME} sed "$1" test cd 2>/dev/null
+	--verbose -eu --verbose /usr/bin 'quoted text'
+	done local readonly done awk ${HOME} local
+		cd 2>/dev/null local "$1" test grep export -eu readonly $(pwd) "$1"
+		echo x=1 $(pwd) /usr/bin $(pwd) /usr/bin --verbose 2>/dev/null sed grep
+'quoted text' "$@" done 2>/dev/null awk /usr/bin echo sed
+		grep /usr/bin | export echo grep grep "$@" done readonly
+	sed export printf && "$@" 'quoted text' ${HOME} ${HOME} && awk ${HOME} | 'quoted text'
+	done sed then $(pwd) grep 'quoted text' "$@" x=1 grep -eu -eu
+	grep grep grep awk -eu cd "$@" local x=1 x=1 | | "$@" echo done /usr/bin echo
+		/usr/bin "$@" | grep -eu "$@" local -eu
+-eu cd then local --verbose readonly $(pwd)
+--verbose readonly then && export 'quoted text'
+	printf done --verbose -eu | test /usr/bin local "$@" readonly $(pwd)
+local --verbose local done cd
+cd --verbose x=1 grep
+echo test 'quoted text' 2>/dev/null | sed "$1" 'quoted text' test 'quoted text'
+		x=1 | printf x=1 local 2>/dev/null "$1" done $(pwd) "$1" 2>/dev/null && 2>/dev/null
+		| /usr/bin x=1 local local
+		--verbose "$1" -eu 2>/dev/null -eu 'quoted text' then "$@" then then x=1
+		x=1 local $(pwd) done && $(pwd) $(pwd)
+test x=1 done cd cd cd $(pwd)
+		| ${HOME} awk "$@" local grep ${HOME}
+		done x=1 && ${HOME} ${HOME} 2>/dev/null ${HOME} sed ${HOME} then awk /usr/bin
+echo 'quoted text' x=1 local ${HOME} ${HOME}
+x=1 --verbose grep done sed cd done 2>/dev/null
+	cd grep $(pwd) x=1 grep test test then --verbose && 2>/dev/null readonly awk
+	awk readonly 2>/dev/null
+	grep echo $(pwd) then $(pwd) -eu test 2>/dev/null "$@" awk | echo local
+	echo x=1 printf | "$1"
+		/usr/bin local awk printf test --verbose "$1" /usr/bin readonly $(pwd) 'quoted text'
+	| ${HOME} export | 'quoted text' awk "$1" done 'quoted text' --verbose 'quoted text'
+| test /usr/bin done | "$@" | -eu x=1 --verbose
+awk awk 2>/dev/null then export done export echo && 2>/dev/null
+	local ${HOME} /usr/bin readonly printf sed test export export
+	sed readonly printf --verbose "$1" sed grep local ${HOME}
+/usr/bin "$@" echo printf | "$@" sed sed -eu x=1 test /usr/bin --verbose
+	test test grep -eu local -eu "$1"
+then 2>/dev/null done ${HOME} awk "$1" -eu awk grep export export ${HOME}
+readonly done echo /usr/bin --verbose local "$@"
+--verbose grep "$1" readonly "$@" | --verbose
+local sed --verbose then cd --verbose
+		-eu printf awk local echo cd cd -eu | x=1 --verbose 2>/dev/null 2>/dev/null
+		then 2>/dev/null then ${HOME} printf $(pwd) --verbose 'quoted text' "$@" | then
+	2>/dev/null "$@" done --verbose
+awk sed | && local printf local | readonly x=1 export -eu done cd printf x=1 "$1"
+	'quoted text' x=1 2>/dev/null echo 2>/dev/null x=1 grep echo then && grep
+		test x=1 test -eu then echo -eu ${HOME} cd done echo $(pwd) then then -eu cd -eu
+done 'quoted text' | && awk printf test readonly cd awk echo awk sed awk done |
+		x=1 cd printf 'quoted text'
+		${HOME} -eu grep /usr/bin 'quoted text' && x=1 echo readonly
+		then -eu echo test printf
+	"$1" "$@" $(pwd) /usr/bin --verbose cd readonly "$1" --verbose /usr/bin 'quoted text'
+	2>/dev/null test -eu
+export | -eu $(pwd) test -eu "$@" && printf
+/usr/bin --verbose "$@" ${HOME} printf export "$1" $(pwd) "$@" 'quoted text'
+		export "$@" "$1" cd && 2>/dev/null sed awk done 2>/dev/null export
+test then awk awk readonly readonly test $(pwd) ${HOME} export
+sed 'quoted text' "$1"
+${HOME} "$@" then then export
+		readonly then sed printf ${HOME} "$@"
+	then done 'quoted text' | export $(pwd) $(pwd) -eu | readonly
+2>/dev/null "$1" /usr/bin --verbose local ${HOME} printf sed && export /usr/bin
+then awk local test export cd echo cd test ${HOME} cd grep export 'quoted text'
+then | "$1" 'quoted text' 'quoted text' --verbose 2>/dev/null 2>/dev/null
+	awk && -eu echo cd "$1" sed ${HOME} --verbose sed readonly export test echo local
+	then sed local $(pwd) awk ${HOME} awk /usr/bin x=1 then echo -eu
+		| then local /usr/bin $(pwd) export && done /usr/bin
+		2>/dev/null "$@" --verbose printf sed | /usr/bin test test local echo export
+	-eu grep test printf ${HOME} ${HOME} /usr/bin sed && echo 'quoted text'
+x=1 ${HOME} readonly then awk --verbose printf $(pwd) | $(pwd) done && 'quoted text'
+sed local echo --verbose --verbose ${HOME} sed awk test cd 'quoted text' local
+	x=1 done --verbose | && /usr/bin /usr/bin test readonly
+	grep && 'quoted text' "$@"
+/usr/bin /usr/bin --verbose echo /usr/bin local cd grep
+		sed sed printf "$@" done done readonly echo echo "$@" grep | 2>/dev/null
+	done then 2>/dev/null -eu test | cd "$@" cd 2>/dev/null cd export 'quoted text'
+		$(pwd) ${HOME} 2>/dev/null echo x=1 printf
+printf 'quoted text' $(pwd) cd 2>/dev/null
+		local ${HOME} done ${HOME} | echo && test && local $(pwd) | /usr/bin done
+		/usr/bin grep test awk "$1" local awk awk
+/usr/bin --verbose --verbose --verbose then x=1 'quoted text'
+		"$@" local local "$1" /usr/bin grep
+	"$1" | readonly && sed $(pwd) 2>/dev/null 'quoted text'
+	$(pwd) local ${HOME} readonly --verbose -eu
+	awk 2>/dev/null ${HOME} "$@" done test 2>/dev/null
+	awk then test then -eu grep "$@" test --verbose x=1 -eu "$1" /usr/bin
+-eu awk echo -eu && && ${HOME} -eu
+"$@" 2>/dev/null printf "$1" local echo cd awk sed export
+'quoted text' grep && printf /usr/bin awk then | /usr/bin
+		"$@" | grep sed cd sed cd 'quoted text'
+readonly /usr/bin "$1" 'quoted text' test grep
+sed --verbose "$1" "$1" /usr/bin sed local awk
+		"$@" grep 'quoted text' -eu export -eu --verbose x=1 awk local
+		'quoted text' | grep ${HOME} "$1" cd 2>/dev/null export
+		done awk awk echo cd cd /usr/bin 'quoted text' readonly export $(pwd) "$1" sed grep
+		'quoted text' local local sed |
+	local && cd cd --verbose
+	"$@" local done sed cd $(pwd) printf 2>/dev/null grep
+		'quoted text' ${HOME} cd done 'quoted text'
+	done "$@" ${HOME} 2>/dev/null echo export test /usr/bin --verbose export /usr/bin
+		awk ${HOME} local 2>/dev/null | export local printf | x=1 echo 2>/dev/null
+'quoted text' -eu x=1
+printf "$@" test then printf cd | 'quoted text' grep
+	done | test done ${HOME} ${HOME} grep ${HOME} printf sed $(pwd)
+/usr/bin then local "$1" "$1" /usr/bin then then $(pwd)
+	export test local local
+echo grep readonly local "$1" echo --verbose 2>/dev/null "$@" "$1" "$@"
+		printf grep && then | -eu | 'quoted text' test readonly $(pwd)
+export -eu done "$@" "$1"
+		$(pwd) readonly done grep | then local ${HOME} done 2>/dev/null $(pwd) | $(pwd)
+/usr/bin local x=1 grep awk echo
+	echo x=1 && local 2>/dev/null 'quoted text'
+--verbose -eu $(pwd) grep
+		--verbose -eu x=1 "$1" grep test "$@" x=1 readonly /usr/bin
+sed printf /usr/bin done echo $(pwd)
+echo test "$1" ${HOME} then local printf x=1 done done && -eu sed | sed
+awk cd 'quoted text' /usr/bin export cd test 2>/dev/null ${HOME}
+		grep x=1 then grep /usr/bin --verbose "$@" "$1" grep "$@" /usr/bin sed ${HOME}
+		sed grep printf sed $(pwd) test "$@" "$1"
+then awk grep grep export grep cd local local printf
+		export awk /usr/bin 'quoted text' ${HOME}
+	done readonly export test echo readonly --verbose
+		'quoted text' sed /usr/bin 2>/dev/null sed grep "$1"
+sed then awk && -eu readonly $(pwd) "$1"
+printf && x=1 done x=1 readonly then printf export
+		local $(pwd) --verbose
+	readonly x=1 2>/dev/null 'quoted text' && echo local sed printf
+&& "$@" /usr/bin echo && 'quoted text' printf test --verbose sed x=1
+	/usr/bin $(pwd) -eu 2>/dev/null | x=1 then x=1 echo ${HOME}
+		/usr/bin /usr/bin "$1" && /usr/bin ${HOME} cd /usr/bin 2>/dev/null | done
+		2>/dev/null then "$1" -eu echo 'quoted text' echo then grep x=1 "$1"
+sed x=1 ${HOME} echo --verbose x=1
+	| x=1 ${HOME} ${HOME} test
+		2>/dev/null sed grep x=1 printf readonly ${HOME} cd printf
+awk done $(pwd) "$1" | test awk -eu then -eu | printf /usr/bin
+test then && then cd readonly test 2>/dev/null echo "$1"
+		echo local && export local awk && | -eu "$1" local x=1 "$1" printf "$@" "$@" awk
+	local | 'quoted text'
+awk then x=1 local --verbose x=1 ${HOME} 'quoted text'
+		'quoted text' grep readonly export sed -eu
+	local then printf export awk readonly
+		local $(pwd) && "$1" --verbose -eu awk
+		| done grep local "$1" readonly ${HOME} export | "$1" then cd /usr/bin | "$@"
+'quoted text' "$1" 'quoted text' x=1 printf done /usr/bin test echo grep
+		printf | "$@" 'quoted text' "$@" -eu printf local
+		done ${HOME} && ${HOME} export local | $(pwd) then printf --verbose
+readonly test printf grep 'quoted text' "$1" "$@"
+sed printf echo && awk printf done /usr/bin grep ${HOME}
+	awk printf sed grep test x=1 awk echo ${HOME} "$1" ${HOME}
+	cd ${HOME} /usr/bin awk then printf
+		| x=1 awk awk --verbose cd awk done | local $(pwd) $(pwd) local
+		x=1 "$@" | readonly printf sed 'quoted text' test then $(pwd) /usr/bin
+		echo -eu 'quoted text' 2>/dev/null
+/usr/bin done then "$1" 'quoted text'
+test grep x=1 sed echo "$@" | && then cd then "$1" "$@" $(pwd)
+/usr/bin "$@" $(pwd) cd sed x=1 local
+	--verbose | local $(pwd) $(pwd) export &&
+'quoted text' "$@" awk 'quoted text' x=1 && /usr/bin readonly -eu cd local
+		/usr/bin cd test sed -eu test test done grep export --verbose sed "$@" --verbose
+		"$1" x=1 printf cd readonly printf then test printf 2>/dev/null
+awk x=1 echo local -eu | sed export /usr/bin /usr/bin printf printf
+	readonly cd cd x=1 cd test export "$1" cd then 'quoted text'
+then readonly ${HOME} printf /usr/bin
+		/usr/bin echo -eu $(pwd) /usr/bin && local export 'quoted text' done readonly
+--verbose test grep cd then | x=1
+${HOME} echo awk printf $(pwd) ${HOME} awk
+	x=1 ${HOME} grep "$1" -eu printf 2>/dev/null "$1" x=1
+"$1" ${HOME} --verbose done -eu readonly "$@" cd awk cd cd grep --verbose awk
+	printf awk printf "$1" grep printf 'quoted text'
+		sed then printf echo $(pwd) readonly awk grep
+		-eu done cd && ${HOME} local -eu ${HOME} grep cd "$1" done /usr/bin then sed
+echo "$@" -eu $(pwd) local cd "$1" echo ${HOME}
+		awk local ${HOME} export then local
+		x=1 'quoted text' echo x=1 printf ${HOME} done echo
+'quoted text' cd "$@" "$@" printf awk /usr/bin test $(pwd) "$@" ${HOME} 'quoted text'
+/usr/bin then test -eu grep readonly readonly $(pwd) x=1 cd local
+	2>/dev/null /usr/bin /usr/bin grep /usr/bin /usr/bin 'quoted text' local
+		${HOME} readonly test x=1
+		/usr/bin --verbose && sed "$1" --verbose done 2>/dev/null sed
+	export sed readonly && x=1 awk readonly
+cd done x=1 x=1 export echo grep "$@" printf "$@" "$@" ${HOME} &&
+		awk then local grep 2>/dev/null "$1" && x=1 ${HOME}
+		awk 'quoted text' $(pwd) x=1 $(pwd) | "$1"
+	echo "$@" cd -eu x=1 /usr/bin readonly awk -eu grep
+	done test grep then /usr/bin --verbose /usr/bin done -eu
+-eu grep local "$@" "$@" -eu
+	| test ${HOME} sed "$1"
+		-eu 'quoted text' awk printf 'quoted text' "$@" grep readonly
+	sed local $(pwd) local sed /usr/bin cd 2>/dev/null --verbose
+	"$1" "$1" -eu awk readonly export readonly | printf awk ${HOME}
+	readonly echo | printf test "$@" ${HOME}
+readonly then awk readonly
+done --verbose then export | sed test
+		cd --verbose -eu readonly
+	| $(pwd) | readonly done ${HOME} &&
+	"$@" 'quoted text' printf ${HOME}
+local 2>/dev/null "$@" then then readonly export "$1"
+	then "$1" echo ${HOME} x=1 "$@" awk $(pwd)
+		awk grep 2>/dev/null ${HOME} --verbose echo cd $(pwd) | echo grep then --verbose
+grep grep -eu sed && "$@" && echo --verbose /usr/bin
+		${HOME} readonly sed && then
+$(pwd) done $(pwd) /usr/bin then "$@" 'quoted text' 'quoted text' && 2>/dev/null
+		x=1 "$@" -eu export ${HOME}
+grep cd "$@" && done test readonly
+"$1" 2>/dev/null test printf && grep "$@" test readonly grep
+		grep | local | 'quoted text' ${HOME} printf local grep $(pwd)
+--verbose --verbose | "$@" grep grep then then local
+		readonly "$@" $(pwd) test
+	done then local "$1" ${HOME} test cd --verbose && -eu test grep echo "$1" x=1 then
+'quoted text' sed test | readonly "$@" | export
+then -eu awk cd x=1 'quoted text'
+sed grep "$1" grep cd test x=1 sed awk && 2>/dev/null
+		sed readonly 2>/dev/null printf local | done done 'quoted text'
+2>/dev/null done awk 2>/dev/null 2>/dev/null 'quoted text' /usr/bin
+		done cd -eu 2>/dev/null x=1 ${HOME} x=1
+--verbose 2>/dev/null done export && sed local 'quoted text' | then && 'quoted text'
+		--verbose sed echo -eu $(pwd) && "$1" ${HOME} 2>/dev/null
+	&& done export $(pwd) echo -eu done local export x=1 --verbose /usr/bin &&
+&& 'quoted text' 'quoted text' grep "$1" awk then --verbose
+		"$1" 'quoted text' "$1" && export cd -eu done done printf -eu && done readonly
+"$@" 2>/dev/null grep export -eu --verbose grep $(pwd) 'quoted text'
+		-eu --verbose test test ${HOME} echo cd "$@" "$1" readonly grep | ${HOME}
+		--verbose -eu --verbose test 2>/dev/null
+		'quoted text' ${HOME} local /usr/bin && sed -eu $(pwd) test &&
+'quoted text' "$1" grep $(pwd) x=1 then
+	echo "$@" "$@" printf local readonly local x=1 done | "$@" then test
+then readonly /usr/bin sed test
+	/usr/bin grep "$@" "$@" grep -eu printf "$1" 'quoted text' && done
+	done -eu -eu cd echo grep then
+		'quoted text' 'quoted text'
+	done | echo 2>/dev/null readonly && readonly 'quoted text' then
+		2>/dev/null cd | ${HOME}
+	$(pwd) /usr/bin 2>/dev/null then sed -eu then
+	-eu cd done | "$@" 'quoted text' cd "$1" then then --verbose | ${HOME} cd
+		readonly printf readonly "$@" /usr/bin
+	/usr/bin && /usr/bin then "$1" cd printf export --verbose local sed
+printf && export ${HOME} done x=1 /usr/bin ${HOME} | cd --verbose cd cd grep echo
+	grep cd | /usr/bin readonly | local
+printf x=1 then /usr/bin $(pwd) 'quoted text' then readonly 2>/dev/null
+$(pwd) awk 2>/dev/null 'quoted text'
+		--verbose x=1 && grep 'quoted text' then 'quoted text' awk done grep
+		echo sed done 'quoted text' x=1 x=1 2>/dev/null
+'quoted text' local x=1 then "$@" then echo then "$1" grep
+	sed printf $(pwd) 2>/dev/null x=1 local cd | echo ${HOME} 2>/dev/null
+	echo readonly "$1" awk 2>/dev/null then 'quoted text' -eu /usr/bin /usr/bin
+test x=1 done ${HOME} grep
+printf done 2>/dev/null /usr/bin local
+&& /usr/bin x=1 printf done readonly
+		awk -eu test 2>/dev/null test "$1" -eu sed cd /usr/bin 'quoted text' -eu
+		$(pwd) -eu $(pwd) 2>/dev/null done printf export $(pwd) local 'quoted text'
+$(pwd) test cd $(pwd) done x=1 | | awk | && | && x=1 $(pwd) x=1 awk sed
+cd 'quoted text' export export -eu x=1 printf /usr/bin readonly awk "$@"
+	readonly local readonly && | then cd ${HOME} /usr/bin done 'quoted text'
+&& ${HOME} grep grep "$@" export awk awk && test 'quoted text'
+${HOME} x=1 2>/dev/null && grep local $(pwd) /usr/bin printf
+		--verbose echo $(pwd) 'quoted text' ${HOME} local sed --verbose
+		"$@" x=1 -eu && $(pwd) /usr/bin "$@" sed && 2>/dev/null
+	'quoted text' x=1 | export $(pwd) cd -eu | local
+then sed "$1" "$@" && sed awk printf ${HOME} x=1 | && export x=1 test awk
+		x=1 $(pwd) readonly test "$1" --verbose local 2>/dev/null "$1" ${HOME}
+&& done | echo $(pwd) -eu 'quoted text' /usr/bin export sed
+		--verbose ${HOME} test 2>/dev/null ${HOME} test cd 2>/dev/null
+		"$1" then 'quoted text' grep /usr/bin test 2>/dev/null awk done
+	cd -eu /usr/bin echo && sed 'quoted text' echo local 2>/dev/null /usr/bin
+"$@" "$@" sed /usr/bin export $(pwd)
+		test /usr/bin cd /usr/bin grep ${HOME} "$1" x=1 "$@" /usr/bin -eu then echo
+'quoted text' -eu grep /usr/bin | awk awk sed 2>/dev/null cd "$@"
+2>/dev/null "$@" $(pwd) then 2>/dev/null printf "$1" local done export done /usr/bin
+	x=1 export -eu local && $(pwd) sed grep done --verbose
+local 'quoted text' --verbose awk
+${HOME} then $(pwd) --verbose | awk sed 2>/dev/null local sed -eu
+export ${HOME} export sed cd local -eu echo printf echo && -eu "$@"
+	| grep done local echo test awk "$@" 2>/dev/null
+printf && awk test ${HOME} 2>/dev/null | echo local sed then /usr/bin
+	grep printf printf then "$@" 'quoted text' local sed done "$1" $(pwd) "$@" "$1"
+		| test cd local echo then
+export ${HOME} | grep cd echo awk $(pwd) 'quoted text' 2>/dev/null then 'quoted text'
+${HOME} $(pwd) ${HOME} export 'quoted text'
+		echo "$1" test 2>/dev/null 2>/dev/null 2>/dev/null
+		cd "$1" readonly --verbose local then grep
+	printf 2>/dev/null -eu $(pwd) "$1" "$1" awk done 2>/dev/null
+	${HOME} done sed readonly sed then printf
+	${HOME} 'quoted text'
+	grep x=1 sed then local cd x=1 && x=1 /usr/bin then awk test "$1" printf
+		done awk grep readonly --verbose --verbose 2>/dev/null
+		grep $(pwd) printf cd 2>/dev/null 2>/dev/null readonly -eu && /usr/bin
+	"$@" 2>/dev/null x=1 -eu x=1 && readonly
+		${HOME} printf /usr/bin -eu readonly
+	test awk ${HOME} grep $(pwd) 2>/dev/null export sed x=1 x=1 "$1" then "$@" then
+	&& "$1" ${HOME} done readonly 'quoted text' /usr/bin --verbose echo
+/usr/bin x=1 printf test export readonly /usr/bin
+x=1 x=1 2>/dev/null then --verbose awk && ${HOME}
+	${HOME} /usr/bin 2>/dev/null sed --verbose "$@" 'quoted text'
+printf && cd "$@" --verbose && readonly --verbose ${HOME} $(pwd) sed "$1"
+		done -eu local $(pwd) && | --verbose
+"$1" export -eu 'quoted text' cd grep awk done x=1 && awk ${HOME} 2>/dev/null "$1"
+	"$@" local --verbose "$@" grep sed $(pwd) local 2>/dev/null awk
+		-eu $(pwd) 2>/dev/null 2>/dev/null sed test readonly && then local done echo local
+		"$@" "$1" sed x=1 'quoted text' grep | -eu sed readonly 2>/dev/null
+	| 'quoted text' printf "$1" cd cd -eu ${HOME} sed ${HOME} -eu x=1 /usr/bin &&
+	/usr/bin x=1 | printf "$@" /usr/bin sed cd printf --verbose "$1" test 2>/dev/null
+	$(pwd) test "$@" sed -eu cd then readonly "$1"
+grep echo readonly | --verbose $(pwd) x=1 "$1" ${HOME} 'quoted text'
+"$@" | done "$1" && echo 2>/dev/null
+| echo "$1" done ${HOME} export readonly
+		$(pwd) $(pwd) then "$@" then "$@" printf test readonly $(pwd) --verbose then
+test ${HOME} /usr/bin "$@" && echo /usr/bin ${HOME} then cd && grep printf
+	$(pwd) cd cd then --verbose ${HOME} x=1 "$1" done cd then sed test then --verbose
+		export $(pwd) x=1 sed $(pwd) done && done x=1 x=1 sed then done "$@" cd awk
+	2>/dev/null test done readonly cd then -eu $(pwd)
+		"$@" export done printf -eu awk test --verbose
+done x=1 local x=1 grep -eu done
+done | 'quoted text' && -eu -eu local 2>/dev/null printf 'quoted text'
+	| readonly -eu local export -eu x=1 ${HOME}
+	local -eu "$1" --verbose /usr/bin
+cd 'quoted text' "$@" grep printf -eu 2>/dev/null then
+test $(pwd) awk 'quoted text'
+		echo && /usr/bin cd done
+/usr/bin readonly "$1" test done awk test awk grep | $(pwd) -eu local grep
+echo | && cd $(pwd) grep /usr/bin --verbose
+grep --verbose sed "$@" /usr/bin readonly "$1" --verbose grep $(pwd)
+		$(pwd) readonly $(pwd)
+		then /usr/bin $(pwd) cd readonly
+		/usr/bin done 'quoted text' | local export | printf readonly
+	-eu ${HOME} printf && readonly printf awk -eu printf 'quoted text'
+		readonly /usr/bin 'quoted text' "$1" x=1 x=1 local sed /usr/bin
+/usr/bin cd sed then echo -eu readonly 2>/dev/null
+--verbose local -eu grep readonly test
+	&& 2>/dev/null local cd done | readonly "$@" $(pwd) x=1 readonly
+echo 'quoted text' printf grep test $(pwd) then --verbose done awk $(pwd)
+	'quoted text' --verbose $(pwd) $(pwd) readonly "$1" test --verbose && 'quoted text'
+	sed 2>/dev/null test test cd $(pwd) "$@"
+$(pwd) 2>/dev/null ${HOME} local "$@" x=1 -eu local echo && 2>/dev/null
+		printf sed local 2>/dev/null x=1 then | cd grep
+		"$@" 2>/dev/null awk x=1 2>/dev/null | then grep "$@"
+	sed echo readonly echo -eu awk done cd "$1" local sed awk echo && grep done && grep
+	done --verbose export grep
+		test cd | | done export "$1" echo cd then "$@" printf x=1 -eu | done export --verbose
+	test done 2>/dev/null -eu ${HOME} cd && | --verbose test -eu
+		local "$1" cd done -eu sed awk then grep export sed local test sed $(pwd)
+		--verbose && done export done printf sed 2>/dev/null local sed --verbose 'quoted text'
+	--verbose 2>/dev/null grep test x=1 --verbose "$@" done export "$1"
+	test /usr/bin done sed readonly ${HOME} done -eu /usr/bin --verbose echo cd
+	x=1 export grep $(pwd) test -eu echo
+cd && "$@" test test grep x=1 ${HOME} readonly -eu readonly
+awk /usr/bin echo 'quoted text' done cd | | | -eu echo awk cd
+	x=1 /usr/bin local && "$@" /usr/bin done sed sed
+		sed $(pwd) awk readonly awk $(pwd)
+grep | $(pwd) "$@" sed grep $(pwd) /usr/bin $(pwd) "$@"
+	'quoted text' cd cd 'quoted text'
+--verbose readonly local $(pwd) printf "$@" /usr/bin $(pwd) echo -eu
+		2>/dev/null test readonly
+$(pwd) cd echo test then sed ${HOME} sed
+"$1" /usr/bin awk done awk x=1 done cd printf echo
+		--verbose echo grep 'quoted text' -eu /usr/bin printf "$1" export local
+	test $(pwd) export echo export ${HOME}
+	export printf && --verbose --verbose
+	cd --verbose test "$@" awk x=1 grep
+	&& 2>/dev/null ${HOME} "$1" ${HOME} --verbose ${HOME} awk "$@" readonly
+| local --verbose /usr/bin "$1" /usr/bin
+	local grep sed local && sed then then echo test 2>/dev/null "$@" sed
+		&& --verbose grep /usr/bin -eu export ${HOME} readonly export grep
+		local | | awk cd awk && readonly
+	readonly export "$@" readonly readonly 'quoted text' $(pwd) ${HOME} 'quoted text'
+test /usr/bin x=1 sed cd $(pwd) && /usr/bin then "$1" 2>/dev/null
+		$(pwd) export --verbose -eu 2>/dev/null grep local local
+	$(pwd) sed x=1 cd export "$@" 'quoted text'
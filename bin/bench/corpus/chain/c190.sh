@@ -0,0 +1,2001 @@
+${HOME} 'quoted text' "$1" echo && then then local awk -eu && export
+--verbose --verbose | test printf
+test cd printf 'quoted text' | grep "$@" 2>/dev/null printf && done done then readonly
+	local ${HOME} "$1" --verbose cd then readonly
+	export "$1" local 'quoted text' /usr/bin
+		export export readonly "$1" x=1 $(pwd) done 'quoted text' local ${HOME} &&
+		$(pwd) sed test printf /usr/bin cd $(pwd) readonly ${HOME} then
+	${HOME} --verbose -eu local
+	export 'quoted text' test 'quoted text' done --verbose printf local export
+		readonly "$1" /usr/bin local printf "$@" /usr/bin --verbose "$1" then 2>/dev/null
+	$(pwd) then printf export sed $(pwd) -eu "$@" awk "$@" local
+		'quoted text' --verbose $(pwd) 2>/dev/null /usr/bin
+	grep printf ${HOME} done
+export 2>/dev/null -eu
+sed "$1" done printf --verbose readonly local x=1 test readonly readonly
+cd 2>/dev/null 'quoted text' | 2>/dev/null local -eu ${HOME} then -eu echo
+	${HOME} --verbose $(pwd) then grep 2>/dev/null done 2>/dev/null
+		test done "$1" printf done $(pwd) sed "$@" 2>/dev/null local
+	test x=1 x=1 | local "$@" "$1" "$1" --verbose | 'quoted text'
+grep readonly $(pwd) echo "$1" sed 2>/dev/null /usr/bin sed $(pwd)
+	| test printf | awk $(pwd) --verbose cd | cd 2>/dev/null
+		echo "$@" sed | --verbose awk sed 2>/dev/null && then echo
+		local -eu -eu --verbose echo test
+	awk "$1" printf cd done cd "$@" && -eu test
+	then -eu awk "$@" -eu 2>/dev/null ${HOME} grep
+		local grep -eu -eu export test export -eu cd
+	echo && --verbose "$@" echo printf sed 2>/dev/null printf -eu
+&& "$1" grep | "$@" 'quoted text'
+	&& echo test grep "$@" -eu sed /usr/bin | done
+sed -eu "$@" sed local ${HOME} test --verbose x=1 'quoted text' -eu readonly
+/usr/bin local -eu 2>/dev/null
+test -eu $(pwd) "$1" --verbose
+--verbose x=1 'quoted text' /usr/bin -eu cd 2>/dev/null
+then $(pwd) test awk | local then
+	local $(pwd) 'quoted text' x=1 sed printf 'quoted text' printf ${HOME} readonly
+x=1 echo x=1 /usr/bin sed export --verbose
+cd grep export && | $(pwd) | local
+sed done export test ${HOME}
+&& && awk awk test echo grep --verbose
+cd done $(pwd) -eu export awk export cd readonly && 2>/dev/null
+	printf export 'quoted text' export $(pwd)
+	'quoted text' grep cd "$1" | local
+$(pwd) grep && x=1 /usr/bin /usr/bin
+	awk test "$@" /usr/bin printf --verbose echo local cd then local cd --verbose
+		| awk sed test test | local x=1 ${HOME} "$1" done $(pwd) awk "$1" &&
+		export | test printf && then ${HOME} sed test awk -eu /usr/bin readonly done
+	-eu -eu awk test done && local export | | export then cd test
+"$1" local -eu test "$@" 'quoted text'
+| readonly ${HOME} x=1 "$@" 2>/dev/null readonly 2>/dev/null done grep -eu
+	"$1" && done "$1" done && "$@" x=1 /usr/bin readonly
+	/usr/bin sed 'quoted text' ${HOME} cd sed --verbose readonly 'quoted text'
+/usr/bin -eu printf /usr/bin test
+		${HOME} export export /usr/bin local "$@" grep
+	"$@" export cd then --verbose awk "$@" 2>/dev/null
+		--verbose printf "$1" printf sed then x=1 -eu export x=1 "$1" 'quoted text'
+		| cd --verbose test echo sed 2>/dev/null x=1 then awk --verbose
+		"$1" grep "$1" export echo -eu sed done -eu
+		awk "$@" -eu test /usr/bin then $(pwd)
+		printf awk local --verbose printf
+		readonly then "$@" /usr/bin x=1
+sed cd test 'quoted text' local
+		then echo --verbose -eu $(pwd) sed /usr/bin cd -eu cd --verbose x=1 'quoted text'
+| $(pwd) $(pwd) test /usr/bin && 'quoted text'
+	&& then 'quoted text'
+		${HOME} 2>/dev/null test | done done sed 'quoted text' 'quoted text' $(pwd)
+	'quoted text' 2>/dev/null ${HOME} $(pwd) awk x=1 export $(pwd) readonly 2>/dev/null
+	cd sed && export 'quoted text' "$1" printf
+--verbose then x=1 "$1" grep sed 2>/dev/null then readonly local /usr/bin
+	test then cd cd local 2>/dev/null
+		cd readonly --verbose "$@" x=1 local local then "$1"
+export printf && echo --verbose -eu && --verbose --verbose done
+"$1" x=1 export readonly then awk 2>/dev/null
+		awk grep 'quoted text' ${HOME} x=1 echo ${HOME} x=1 export --verbose
+	test --verbose x=1 cd 'quoted text' done cd && sed | $(pwd)
+"$@" | "$1" | printf --verbose 'quoted text'
+	done "$1" test export test
+&& awk cd test ${HOME} sed cd && awk export /usr/bin && then export
+then 2>/dev/null ${HOME} cd then awk local --verbose done ${HOME} --verbose $(pwd)
+		done local cd local then | awk cd x=1 done printf echo test -eu
+		cd "$1" readonly readonly 'quoted text' echo 2>/dev/null export
+		"$@" readonly /usr/bin x=1 then $(pwd) test "$1"
+	x=1 $(pwd) printf echo -eu 'quoted text' 2>/dev/null 2>/dev/null
+'quoted text' x=1 sed echo 'quoted text' 'quoted text' awk
+		${HOME} --verbose local $(pwd) test
+		local grep test cd then awk printf
+2>/dev/null ${HOME} x=1 test cd echo ${HOME} cd
+readonly && --verbose "$@" -eu "$@" sed ${HOME} test done /usr/bin "$1" | readonly
+		x=1 then awk "$@" "$@" "$@" cd 'quoted text'
+--verbose readonly "$1" | 'quoted text' local test /usr/bin -eu readonly 2>/dev/null
+		grep local 'quoted text'
+	awk sed export done readonly 2>/dev/null ${HOME} cd
+echo "$@" export awk 2>/dev/null test readonly x=1 /usr/bin ${HOME}
+		| readonly printf /usr/bin echo $(pwd) --verbose readonly
+	$(pwd) sed cd --verbose readonly
+		export "$@" && then $(pwd) awk readonly sed grep "$@" "$1" test sed | readonly
+done && cd echo -eu printf
+	&& --verbose && then done export "$@" awk done ${HOME}
+export done test 'quoted text' then
+	awk cd 'quoted text' export then "$1"
+	awk | /usr/bin -eu awk --verbose sed done "$@" 'quoted text'
+		grep readonly "$@" export 2>/dev/null -eu && -eu local printf printf
+| "$1" echo 'quoted text' && echo ${HOME} echo
+sed && printf local "$@" -eu export ${HOME}
+then x=1 -eu | sed cd ${HOME} && 2>/dev/null echo readonly
+		--verbose echo 'quoted text' local sed cd --verbose "$1" grep
+echo 'quoted text' sed test --verbose sed readonly readonly
+&& local 2>/dev/null export then
+printf sed -eu sed printf "$1" "$@" then x=1 $(pwd) /usr/bin
+	--verbose --verbose 2>/dev/null x=1
+	&& readonly awk readonly sed | grep &&
+	| && done local | --verbose 2>/dev/null x=1 'quoted text' echo
+	--verbose echo done $(pwd) done 2>/dev/null -eu readonly awk ${HOME} export
+	"$@" $(pwd) | | sed "$@" test done --verbose test sed 'quoted text'
+	-eu local "$@" ${HOME} cd 2>/dev/null printf 'quoted text'
+	$(pwd) $(pwd) $(pwd) x=1 awk grep
+		local --verbose ${HOME} x=1 2>/dev/null then test $(pwd)
+	grep | | export 2>/dev/null local
+		/usr/bin then grep echo printf test cd readonly
+"$@" ${HOME} awk x=1 grep printf cd "$1" export --verbose ${HOME}
+x=1 'quoted text' echo readonly awk x=1 then ${HOME} printf | echo 'quoted text'
+		&& "$@" then then && sed x=1 x=1 /usr/bin --verbose --verbose
+echo grep local cd x=1 cd cd x=1 readonly then
+${HOME} -eu local sed test ${HOME} 2>/dev/null export
+	$(pwd) done -eu --verbose
+	$(pwd) readonly | "$1" | done cd "$@"
+		cd test then && sed ${HOME} | test awk 'quoted text' -eu
+	x=1 grep grep grep done x=1 sed readonly | test then
+export -eu grep | 2>/dev/null 'quoted text' test echo test test
+--verbose then awk test
+&& /usr/bin /usr/bin "$1" echo x=1 --verbose -eu && x=1 --verbose
+	-eu awk -eu -eu ${HOME} | awk 2>/dev/null then "$1" done
+		'quoted text' test awk && readonly
+		readonly x=1 | "$1" /usr/bin "$1" /usr/bin
+		echo 'quoted text' 'quoted text'
+		cd 'quoted text' "$@" done --verbose && | /usr/bin x=1 | export then
+"$@" export then test 2>/dev/null local done done
+		2>/dev/null readonly /usr/bin
+	2>/dev/null "$1" local grep grep grep 'quoted text' "$1" /usr/bin local
+		/usr/bin x=1 "$1" readonly ${HOME} && readonly
+		&& sed sed export ${HOME} --verbose x=1 sed "$1" grep "$@" sed --verbose echo
+		cd | "$@" export echo then --verbose then test awk sed
+'quoted text' echo && awk /usr/bin local cd "$@" x=1 $(pwd) "$1"
+		sed local sed done printf done printf readonly then 2>/dev/null cd done export
+grep sed echo "$@" cd echo grep done readonly test test grep grep printf "$@" |
+	'quoted text' local export echo cd readonly
+		test local done sed /usr/bin local $(pwd) awk "$1" test awk x=1 readonly
+		"$1" readonly 'quoted text' export done export export 'quoted text'
+| ${HOME} "$@" "$@" cd 2>/dev/null
+		| echo local 2>/dev/null
+		x=1 x=1 $(pwd) sed $(pwd) ${HOME} "$@" local echo "$@" readonly test
+	--verbose local done printf && echo awk
+		x=1 sed sed && | --verbose --verbose
+local x=1 "$@" readonly local local readonly -eu $(pwd) x=1 "$1" $(pwd) 'quoted text'
+--verbose then ${HOME} -eu $(pwd) $(pwd) sed -eu
+${HOME} then /usr/bin sed then | printf readonly | $(pwd) &&
+"$@" cd then "$1" cd "$1" | test echo $(pwd) && echo
+		cd "$@" x=1 -eu local --verbose sed readonly $(pwd) printf
+$(pwd) local /usr/bin | readonly test x=1 readonly echo done echo $(pwd) readonly
+		cd 'quoted text' printf $(pwd)
+	printf cd readonly printf printf $(pwd) /usr/bin "$@" printf
+	sed 'quoted text' 'quoted text'
+	test printf readonly 'quoted text' export /usr/bin grep "$1" then
+/usr/bin done echo then --verbose test "$@"
+		grep "$@" local then ${HOME} x=1 ${HOME} --verbose cd test grep sed export
+local "$@" "$1" test
+then local 'quoted text' echo test "$1" done --verbose 2>/dev/null
+	&& printf x=1 grep ${HOME} -eu "$@" export ${HOME} local 'quoted text' 'quoted text'
+	2>/dev/null /usr/bin grep printf && $(pwd) cd ${HOME} awk
+		2>/dev/null x=1 export x=1 | && then 'quoted text' awk 2>/dev/null done $(pwd)
+	local "$@" export "$1" readonly
+x=1 export printf "$@" awk cd readonly printf x=1
+	done awk "$1" test export /usr/bin -eu done
+		cd --verbose local awk 'quoted text'
+/usr/bin x=1 -eu done ${HOME} /usr/bin readonly then
+		--verbose && && sed cd ${HOME} 2>/dev/null
+		sed "$@" echo "$@" | "$1" printf ${HOME} 2>/dev/null && grep
+/usr/bin grep -eu grep | ${HOME} ${HOME} cd then
+done then 'quoted text' grep /usr/bin
+	awk $(pwd) && /usr/bin readonly then done test x=1
+"$1" "$@" sed grep sed "$@"
+	$(pwd) printf export cd cd test
+		| "$@" x=1 'quoted text' x=1
+"$1" local echo done export /usr/bin "$1" && readonly cd | -eu | | echo ${HOME}
+cd readonly -eu 'quoted text' x=1 done awk echo
+then awk cd 2>/dev/null awk "$@" export local printf 2>/dev/null /usr/bin awk
+--verbose --verbose export done
+	local export awk "$@" local done readonly then | printf
+| x=1 readonly x=1 echo awk ${HOME}
+		--verbose /usr/bin done cd x=1 --verbose "$@"
+	readonly local /usr/bin /usr/bin 'quoted text' printf && test
+local done test grep | done export | echo
+	done "$1" | "$1" | grep $(pwd) cd sed then readonly
+	--verbose sed "$1" "$1" /usr/bin --verbose test echo grep
+	export export "$@" -eu done sed --verbose then
+	echo awk local printf then then
+	cd $(pwd) /usr/bin readonly --verbose && | 'quoted text' ${HOME} | -eu $(pwd)
+cd readonly grep printf echo awk test then printf echo
+	echo echo /usr/bin grep test local 2>/dev/null
+		readonly /usr/bin local ${HOME}
+	&& ${HOME} done grep "$1" 2>/dev/null local --verbose
+	${HOME} /usr/bin grep "$@" export $(pwd) 'quoted text' && | 2>/dev/null local
+	sed "$1" test printf && 2>/dev/null
+		cd test test echo then awk 'quoted text' --verbose
+	"$@" /usr/bin -eu awk awk sed then printf 'quoted text'
+		2>/dev/null echo /usr/bin | printf | --verbose
+	--verbose "$@" 2>/dev/null grep 2>/dev/null ${HOME} export then ${HOME}
+sed local -eu readonly local
+		--verbose done awk echo /usr/bin
+local done cd grep $(pwd) sed -eu "$1" $(pwd) local cd awk "$1"
+	${HOME} echo "$@" $(pwd) local done 'quoted text' | grep 'quoted text'
+awk test --verbose --verbose grep "$1" cd awk local x=1 /usr/bin
+export sed $(pwd) && | test 2>/dev/null printf && x=1 x=1 test export
+	then printf "$1" echo ${HOME} && done export done grep
+	export echo "$1" && grep
+export sed grep export readonly awk test
+--verbose cd grep test "$1" readonly 2>/dev/null
+	| x=1 grep sed cd export -eu 2>/dev/null "$1" ${HOME} "$1" test
+		${HOME} "$@" grep | /usr/bin
+&& grep x=1 && readonly
+readonly printf done printf $(pwd) 2>/dev/null
+printf printf sed && 2>/dev/null sed --verbose
+	--verbose 2>/dev/null awk ${HOME} local 'quoted text' $(pwd)
+		sed -eu then $(pwd) then --verbose x=1 local
+		printf done "$@" -eu | sed done then export then 'quoted text'
+${HOME} && --verbose 'quoted text' | awk echo 'quoted text'
+	grep readonly && "$1" "$1" sed export $(pwd) export 'quoted text'
+	sed | cd cd then 'quoted text' printf --verbose echo done "$1" awk $(pwd) |
+| && then done sed echo 2>/dev/null
+$(pwd) 2>/dev/null readonly
+	"$1" $(pwd) done echo awk readonly "$@" test ${HOME} 'quoted text' ${HOME}
+		echo ${HOME} x=1 x=1 ${HOME} ${HOME} /usr/bin then echo ${HOME}
+		$(pwd) -eu "$1" && 'quoted text' -eu | readonly
+		${HOME} grep 'quoted text'
+awk readonly "$1" x=1 cd $(pwd) "$1"
+		$(pwd) "$1" "$1" ${HOME} printf awk --verbose
+cd && ${HOME} then cd 2>/dev/null test test &&
+	/usr/bin "$1" grep --verbose "$1" readonly --verbose test -eu "$1" ${HOME}
+	test export --verbose export
+		awk readonly | 'quoted text' echo 'quoted text' $(pwd) -eu -eu
+${HOME} done sed then sed awk cd x=1 $(pwd) export "$1" x=1 -eu done readonly
+-eu cd readonly $(pwd) awk
+		x=1 ${HOME} done sed then
+		$(pwd) done /usr/bin 2>/dev/null ${HOME} sed "$@" $(pwd)
+	test "$1" grep && local awk grep | printf
+	printf readonly | ${HOME} printf -eu | ${HOME}
+echo $(pwd) test done "$1" 'quoted text' export
+		&& 'quoted text' printf local && "$1" -eu -eu local -eu sed awk && ${HOME}
+printf echo test cd "$@" "$1" cd x=1 ${HOME} printf
+		grep done x=1 "$@" readonly test --verbose "$@" "$@" "$@" done /usr/bin $(pwd)
+printf export --verbose x=1
+/usr/bin awk printf "$1" sed /usr/bin
+	$(pwd) printf && 2>/dev/null
+"$@" 2>/dev/null x=1 "$1" | 2>/dev/null test /usr/bin $(pwd) "$1" then
+		echo readonly "$1" export && sed done | readonly
+		&& "$1" done echo local awk "$1" then test echo --verbose /usr/bin sed export
+		echo /usr/bin awk 2>/dev/null ${HOME} /usr/bin test local --verbose local "$1" cd
+		cd --verbose && cd -eu | /usr/bin
+	then readonly ${HOME} --verbose
+'quoted text' -eu 2>/dev/null 'quoted text' export 'quoted text' | $(pwd)
+	x=1 test --verbose grep "$1" && | ${HOME} readonly export $(pwd)
+		local --verbose test then then --verbose printf && | --verbose local export 2>/dev/null
+$(pwd) -eu test --verbose --verbose --verbose export
+		done then readonly 'quoted text' /usr/bin "$1" "$@" --verbose
+		| local grep /usr/bin x=1 awk "$1" | 'quoted text'
+cd ${HOME} | && cd /usr/bin x=1 --verbose readonly -eu printf
+	local grep grep -eu readonly readonly x=1 /usr/bin "$1" then awk export && awk
+		sed /usr/bin done done
+x=1 | /usr/bin test $(pwd) export then done local then
+export "$1" 2>/dev/null ${HOME} | grep
+	${HOME} then 2>/dev/null cd then | export awk --verbose export
+--verbose sed awk sed -eu $(pwd) 'quoted text' grep test
+	--verbose local ${HOME} done --verbose
+'quoted text' cd ${HOME} x=1 test
+sed export ${HOME} | export
+	export ${HOME} cd "$@" done
+'quoted text' "$@" x=1 local
+		x=1 --verbose 'quoted text' printf $(pwd) cd -eu then $(pwd)
+2>/dev/null cd ${HOME}
+	echo readonly then -eu export $(pwd) grep -eu ${HOME} x=1 grep grep readonly
+"$@" "$1" readonly "$1" /usr/bin grep echo grep test $(pwd) done test "$1"
+	"$1" && /usr/bin | grep "$1" local --verbose "$1"
+readonly awk && grep -eu 'quoted text'
+		x=1 x=1 ${HOME} sed 'quoted text' && sed readonly -eu export x=1 echo
+		x=1 | test | then test x=1 'quoted text'
+readonly echo $(pwd) x=1 cd && export
+	grep cd echo 2>/dev/null done "$@" --verbose grep
+		$(pwd) awk -eu $(pwd) 2>/dev/null -eu 'quoted text' x=1 2>/dev/null --verbose echo
+		awk --verbose cd --verbose sed export printf then test -eu && x=1
+		then ${HOME} -eu export "$@" grep awk done local awk
+		/usr/bin "$@" grep $(pwd) awk
+		sed grep /usr/bin ${HOME} && echo echo then then "$1" then --verbose
+	grep echo /usr/bin "$@" ${HOME} cd awk --verbose sed
+		"$1" $(pwd) "$@" 'quoted text' awk local 2>/dev/null
+	$(pwd) /usr/bin done echo 2>/dev/null $(pwd) $(pwd) awk -eu --verbose local
+		$(pwd) local test 2>/dev/null 2>/dev/null ${HOME} $(pwd) /usr/bin
+	'quoted text' readonly local -eu
+${HOME} | then ${HOME} test echo "$1" x=1
+		'quoted text' sed -eu $(pwd) export cd ${HOME} | grep export --verbose
+&& printf "$@" readonly --verbose sed && echo then done 'quoted text'
+		export sed /usr/bin 2>/dev/null test ${HOME} awk x=1
+		-eu printf awk test x=1 x=1 'quoted text' sed "$1" then
+	--verbose /usr/bin 2>/dev/null sed export | sed -eu "$1"
+&& then done | sed readonly done readonly ${HOME} grep && then local x=1
+	| -eu readonly then $(pwd) grep
+		"$1" -eu | grep awk && 'quoted text'
+awk local readonly -eu awk --verbose x=1 export /usr/bin
+	test -eu && "$1" && 2>/dev/null /usr/bin x=1 x=1 cd grep "$@"
+	then test -eu printf -eu echo "$1" local awk 'quoted text' awk |
+	--verbose --verbose test --verbose ${HOME} ${HOME}
+	"$@" sed then x=1 /usr/bin awk printf echo "$1" --verbose export
+		x=1 awk then && x=1 then printf
+test ${HOME} awk && 2>/dev/null
+		then ${HOME} echo 'quoted text' -eu test 'quoted text' test
+'quoted text' readonly readonly
+--verbose 2>/dev/null /usr/bin /usr/bin grep --verbose
+	local "$1" cd | | ${HOME} local "$@" cd ${HOME}
+		test readonly awk printf /usr/bin
+		printf 2>/dev/null sed then -eu cd grep awk ${HOME}
+then done grep "$@" export && cd readonly $(pwd) sed cd "$@" local echo
+	local "$1" --verbose export
+	'quoted text' readonly && export local then --verbose 2>/dev/null grep readonly
+	/usr/bin awk | echo cd x=1 $(pwd)
+		readonly && ${HOME} printf 2>/dev/null readonly $(pwd) then && echo
+grep local $(pwd) "$1" 'quoted text' /usr/bin
+&& -eu sed "$@" && grep printf "$@" 2>/dev/null | export
+	printf $(pwd) --verbose awk sed awk | --verbose | done
+	export then "$@" $(pwd) test 2>/dev/null
+| | | then ${HOME} "$1" && $(pwd) --verbose | ${HOME}
+		test local "$@" local export
+readonly ${HOME} x=1 && | readonly grep x=1
+		cd awk echo x=1 /usr/bin
+		-eu awk grep ${HOME} cd then -eu sed | 'quoted text'
+	grep awk 'quoted text' sed echo echo $(pwd) readonly
+echo x=1 'quoted text' export ${HOME} 'quoted text' 'quoted text'
+cd --verbose --verbose printf 2>/dev/null
+printf awk "$1" $(pwd) readonly grep /usr/bin 'quoted text'
+	readonly done "$1" && x=1 awk echo && done 2>/dev/null 'quoted text'
+	awk cd done sed ${HOME} done local grep 'quoted text' export grep grep &&
+	--verbose awk sed x=1 "$1"
+	"$@" test sed -eu && sed export
+/usr/bin 'quoted text' | local echo sed --verbose
+local -eu 'quoted text' local
+	'quoted text' done then awk sed "$@" "$1" -eu cd /usr/bin
+cd "$1" $(pwd) -eu sed ${HOME} local test
+&& then ${HOME} | printf local 2>/dev/null /usr/bin 'quoted text' export sed &&
+readonly sed ${HOME} sed done "$@" &&
+		--verbose "$1" sed ${HOME} test x=1
+	/usr/bin && export local echo awk "$1" && 2>/dev/null
+		-eu local printf export readonly
+test export "$@" $(pwd) --verbose "$1" local "$@" cd 'quoted text' ${HOME} sed
+'quoted text' sed awk done --verbose "$@"
+--verbose done && local then export
+		'quoted text' /usr/bin "$@" --verbose && --verbose done grep 'quoted text'
+	-eu export echo echo echo ${HOME} $(pwd) $(pwd)
+--verbose x=1 cd "$1" then cd | -eu 'quoted text' done "$1" -eu 2>/dev/null
+	done echo ${HOME} x=1 done cd x=1 cd sed /usr/bin test "$@" -eu "$@" x=1 cd
+	x=1 test grep $(pwd)
+	x=1 'quoted text' && 'quoted text' 'quoted text' "$@" done --verbose
+	test /usr/bin then $(pwd)
+	sed test cd /usr/bin awk awk local printf local
+	&& $(pwd) readonly 2>/dev/null printf ${HOME} -eu /usr/bin done then /usr/bin
+		awk grep cd local test then test 2>/dev/null "$1" -eu local "$1" ${HOME} &&
+'quoted text' /usr/bin -eu && | 2>/dev/null | local echo --verbose
+"$@" -eu x=1 export "$1" then then && done "$1" printf printf
+	--verbose readonly echo grep done
+	test && test sed sed cd 2>/dev/null /usr/bin && grep /usr/bin then grep test cd
+		x=1 echo --verbose then
+	printf readonly then echo cd readonly "$@" $(pwd) export done /usr/bin "$@" -eu
+done cd "$1" x=1 ${HOME} 2>/dev/null
+	readonly local 'quoted text'
+"$1" cd x=1 grep echo "$@" x=1
+2>/dev/null export && "$1"
+grep sed awk -eu && 'quoted text'
+export readonly $(pwd) echo && grep awk grep test readonly --verbose
+	--verbose "$@" | -eu echo test local 'quoted text' -eu x=1 sed done echo
+2>/dev/null printf 'quoted text' "$@" /usr/bin echo 2>/dev/null
+		grep && done awk && x=1 ${HOME} local export "$@" test cd sed
+	then cd x=1 export done && done awk
+	printf --verbose export grep echo --verbose cd awk
+		grep printf 'quoted text' ${HOME}
+| && done -eu readonly
+local ${HOME} ${HOME} -eu awk then x=1 readonly
+$(pwd) sed export 2>/dev/null $(pwd) "$1"
+	2>/dev/null -eu printf 2>/dev/null && 'quoted text'
+	$(pwd) done "$@" cd -eu "$1" cd $(pwd) x=1 awk
+		--verbose test done local local
+		export && printf export export echo "$1" "$1" test -eu test
+	printf local cd cd /usr/bin
+readonly $(pwd) echo readonly 'quoted text' done && echo /usr/bin printf
+		test export && printf then then $(pwd) then grep
+		'quoted text' 'quoted text' "$1" awk then $(pwd) cd printf
+test ${HOME} done --verbose echo cd x=1 grep test then awk "$1" readonly readonly
+	then /usr/bin -eu --verbose echo readonly /usr/bin
+	--verbose /usr/bin then "$@" x=1 | grep awk then ${HOME} && "$@" grep local --verbose
+		2>/dev/null readonly test
+	readonly readonly $(pwd) --verbose printf $(pwd) test | awk test -eu
+		$(pwd) "$@" printf $(pwd) local cd ${HOME} $(pwd) x=1 awk test
+		echo readonly test sed $(pwd) ${HOME} $(pwd) "$1" grep --verbose export
+	x=1 2>/dev/null test test | echo export awk "$@" echo ${HOME} echo ${HOME} 2>/dev/null
+		$(pwd) && printf done cd --verbose && | -eu printf sed "$1"
+	cd "$@" "$1" printf export printf 'quoted text' local
+	$(pwd) then printf sed "$1" done -eu echo 2>/dev/null
+	/usr/bin $(pwd) local -eu $(pwd)
+		sed "$@" | -eu awk awk sed export 'quoted text' echo
+then done test && /usr/bin local x=1 done "$@" export awk local --verbose
+awk x=1 local x=1 && done cd local readonly export echo done echo 2>/dev/null
+-eu done export local /usr/bin printf export ${HOME} -eu 'quoted text'
+| "$@" awk -eu 'quoted text' awk printf export
+		2>/dev/null then printf $(pwd)
+		${HOME} | x=1 awk test printf --verbose local done readonly --verbose printf test
+		awk 'quoted text' export
+		${HOME} export 'quoted text' cd export printf --verbose readonly
+--verbose | local "$@" && /usr/bin local readonly
+grep awk 2>/dev/null local grep --verbose awk readonly 'quoted text'
+		local 'quoted text' 2>/dev/null 2>/dev/null /usr/bin
+	/usr/bin cd 2>/dev/null
+		2>/dev/null grep grep | "$1" /usr/bin echo echo sed awk
+		cd "$1" "$1" then 'quoted text' "$1"
+test /usr/bin "$@" echo "$@"
+printf test done readonly "$@" /usr/bin "$1" 'quoted text'
+	local done printf grep 2>/dev/null printf local $(pwd) "$@" --verbose
+echo --verbose sed && readonly 'quoted text'
+sed x=1 echo $(pwd) -eu ${HOME}
+test 'quoted text' -eu "$1" ${HOME} then 2>/dev/null then /usr/bin 'quoted text'
+	| x=1 -eu awk cd --verbose "$@" export readonly
+	done $(pwd) x=1 -eu --verbose grep awk awk |
+	x=1 ${HOME} awk "$@" x=1 test done awk echo echo 'quoted text'
+--verbose printf then grep cd | x=1 'quoted text' export local local
+export --verbose 'quoted text' local grep awk readonly
+		x=1 printf 2>/dev/null cd done "$1"
+		local 2>/dev/null sed 'quoted text'
+		local test "$@" echo readonly echo test "$1" $(pwd) readonly /usr/bin
+		then echo sed 2>/dev/null done export export && export
+		test test /usr/bin -eu test done local "$1" x=1 cd 'quoted text'
+		${HOME} readonly "$1" 2>/dev/null $(pwd) local
+then $(pwd) x=1 grep ${HOME} 'quoted text' "$1" -eu export export
+done test | 'quoted text' export x=1 readonly
+	&& grep cd awk x=1 done grep "$@" sed --verbose --verbose -eu
+test sed cd 'quoted text' $(pwd) $(pwd) -eu 'quoted text' test "$@" done awk
+done "$1" 'quoted text' test
+		grep && "$1" --verbose sed "$1" local -eu | --verbose 'quoted text' | then
+		then 'quoted text' 2>/dev/null test printf 'quoted text' ${HOME} export
+		echo grep "$@" x=1 done 2>/dev/null
+$(pwd) printf export readonly readonly grep --verbose
+	then export 'quoted text' "$@"
+done test export --verbose "$1" 2>/dev/null
+		grep && x=1 $(pwd) x=1 'quoted text'
+&& awk 2>/dev/null x=1 /usr/bin /usr/bin test x=1 "$@" 2>/dev/null
+grep -eu && "$@" test $(pwd) -eu "$@" readonly export done ${HOME} /usr/bin 'quoted text'
+	export ${HOME} printf cd readonly /usr/bin test $(pwd) 'quoted text' awk readonly
+		x=1 -eu 2>/dev/null grep 2>/dev/null
+awk test "$1" readonly x=1 ${HOME}
+	echo then "$1" sed cd | awk
+		| && echo done awk cd -eu | | readonly
+		&& ${HOME} done awk -eu 2>/dev/null
+	2>/dev/null x=1 grep awk 2>/dev/null /usr/bin test readonly printf
+		-eu 2>/dev/null export printf x=1 printf "$@" --verbose ${HOME} test test &&
+	readonly local printf readonly -eu && 'quoted text'
+		"$@" $(pwd) readonly echo then "$1" $(pwd)
+		printf | sed 2>/dev/null $(pwd)
+local printf ${HOME} 'quoted text'
+	"$1" "$@" 'quoted text' x=1
+local "$@" "$1" | && awk x=1 $(pwd) local sed export done cd printf
+	$(pwd) cd export x=1 echo cd
+	$(pwd) then printf "$@" && 2>/dev/null
+	&& $(pwd) /usr/bin "$1" | readonly
+| printf x=1 done cd && && "$@" echo 'quoted text'
+export | | | sed -eu cd export readonly
+		-eu cd done $(pwd) export 'quoted text' -eu local sed -eu printf 'quoted text'
+		echo /usr/bin --verbose $(pwd) --verbose -eu $(pwd) && && x=1 done --verbose
+		x=1 local | "$1" grep done -eu 'quoted text' sed export 'quoted text' 2>/dev/null
+	awk --verbose /usr/bin ${HOME} 'quoted text'
+	'quoted text' sed -eu --verbose
+		&& done printf readonly x=1 ${HOME} --verbose echo && -eu echo /usr/bin "$@" "$@"
+	readonly && done cd /usr/bin sed ${HOME} readonly "$1" cd --verbose
+	local "$@" 2>/dev/null --verbose echo -eu && -eu export -eu "$1" ${HOME} 2>/dev/null
+		x=1 cd && 'quoted text' 'quoted text' -eu /usr/bin ${HOME} "$1" export grep echo
+	local echo 2>/dev/null test
+"$1" ${HOME} echo printf cd export cd test echo echo echo -eu "$@"
+x=1 cd --verbose /usr/bin readonly awk sed grep 'quoted text'
+awk 2>/dev/null | cd export local ${HOME} -eu "$1" -eu cd done 'quoted text'
+		test then local cd 2>/dev/null "$@" done && $(pwd) --verbose
+$(pwd) "$1" readonly | awk cd readonly 2>/dev/null local
+		done x=1 "$1" $(pwd) grep export awk --verbose
+-eu /usr/bin $(pwd) -eu "$1" 'quoted text' 2>/dev/null echo then
+		cd 'quoted text' printf ${HOME} 2>/dev/null "$1" x=1 ${HOME} -eu sed grep
+	local --verbose readonly x=1 --verbose x=1 readonly 2>/dev/null "$@" "$@" "$1" cd
+printf /usr/bin done printf
+	printf echo then done printf "$@" "$@" local -eu then $(pwd) 2>/dev/null
+	export local | grep x=1 readonly echo ${HOME}
+	x=1 'quoted text' x=1 x=1 'quoted text' /usr/bin printf printf
+		awk cd | done done &&
+	"$1" cd "$1" done | grep "$@"
+--verbose test readonly readonly 'quoted text' awk $(pwd) 2>/dev/null
+	export && -eu ${HOME} "$@" done cd then
+done 2>/dev/null awk local 2>/dev/null && local | done
+printf grep -eu --verbose "$1" $(pwd) export && readonly
+	$(pwd) grep | local $(pwd) done test /usr/bin
+then then /usr/bin --verbose
+		export grep grep printf ${HOME}
+	/usr/bin sed 2>/dev/null then export
+	"$1" -eu readonly && sed export 'quoted text'
+		x=1 printf test cd -eu
+	--verbose 'quoted text' -eu export $(pwd) cd | readonly
+	"$1" 2>/dev/null /usr/bin | sed printf "$@" echo
+--verbose readonly -eu sed $(pwd) echo cd x=1 readonly export $(pwd) $(pwd)
+		printf printf done | "$@" readonly
+		| echo ${HOME} x=1 grep $(pwd) 'quoted text' cd x=1 printf
+		done grep awk $(pwd) ${HOME} "$1" $(pwd) echo
+		/usr/bin && 2>/dev/null sed cd x=1 "$@" done echo && $(pwd) then | awk local
+echo $(pwd) x=1 readonly then printf "$1" /usr/bin | echo x=1 && "$1" export &&
+cd local | readonly then $(pwd) cd "$@" ${HOME}
+	printf test | 'quoted text' /usr/bin --verbose
+	test then --verbose awk grep /usr/bin ${HOME} ${HOME} "$1" | grep "$1"
+		'quoted text' test grep local grep readonly
+	sed "$@" && "$1" local "$1" then printf cd cd 2>/dev/null
+-eu x=1 ${HOME} x=1 "$@" grep -eu x=1 sed 2>/dev/null x=1
+then 2>/dev/null readonly local -eu && sed 'quoted text' x=1 then sed -eu sed
+export awk echo export awk readonly -eu | done
+$(pwd) "$1" readonly export
+2>/dev/null -eu -eu /usr/bin readonly 'quoted text' 2>/dev/null
+printf readonly /usr/bin -eu "$@" "$1" "$1" done "$@" -eu
+		x=1 cd sed printf export && x=1 sed ${HOME} local ${HOME} 2>/dev/null
+	done "$1" sed export x=1 grep sed
+	2>/dev/null /usr/bin $(pwd) "$@" sed sed then $(pwd) then 'quoted text' sed
+	printf readonly 2>/dev/null
+		2>/dev/null readonly done "$1" --verbose local 2>/dev/null
+		awk readonly -eu && 2>/dev/null then x=1 sed
+	"$1" cd --verbose grep sed ${HOME} local
+		grep | /usr/bin x=1 cd then 2>/dev/null test --verbose test grep | "$@" test 2>/dev/null
+	local then local cd then test test --verbose grep printf "$@"
+	$(pwd) -eu printf x=1 grep --verbose done $(pwd)
+		sed export --verbose && printf "$1" ${HOME} grep /usr/bin grep grep 2>/dev/null
+	export local && ${HOME} awk grep local sed $(pwd)
+| "$1" "$@" x=1 export
+grep readonly sed 2>/dev/null echo && /usr/bin
+	readonly then local ${HOME} done echo 2>/dev/null then grep readonly
+"$1" printf grep printf ${HOME} then /usr/bin grep --verbose
+		printf test readonly echo "$1" "$@" 'quoted text'
+		2>/dev/null sed && printf | ${HOME} --verbose
+		| then "$@" "$1" local -eu x=1 -eu x=1 test "$@" 'quoted text' 2>/dev/null grep
+echo cd export local x=1 then --verbose cd $(pwd) --verbose
+	grep printf "$@" echo x=1 "$1" 2>/dev/null
+sed x=1 ${HOME} awk then grep export | $(pwd) awk --verbose
+x=1 ${HOME} readonly && | x=1 2>/dev/null readonly then "$@" local x=1 $(pwd)
+	printf echo printf && -eu printf --verbose echo $(pwd) awk readonly
+	2>/dev/null 'quoted text'
+		x=1 /usr/bin -eu "$@" done /usr/bin 'quoted text' --verbose | readonly --verbose
+	then | 2>/dev/null x=1 test readonly x=1 2>/dev/null 2>/dev/null
+	export 'quoted text' -eu done
+	"$1" export done echo --verbose -eu ${HOME} cd "$@"
+	echo grep "$@" /usr/bin "$@" local /usr/bin grep done ${HOME}
+	2>/dev/null x=1 x=1 echo ${HOME} 'quoted text'
+echo test sed 'quoted text' "$@" echo 'quoted text' export && awk 2>/dev/null
+sed ${HOME} $(pwd) "$1"
+	&& sed $(pwd) readonly awk --verbose "$@"
+-eu grep ${HOME} grep |
+	awk "$1" "$1" --verbose --verbose sed /usr/bin
+'quoted text' --verbose
+	local ${HOME} -eu && readonly readonly |
+		| then awk grep -eu awk x=1 x=1 ${HOME} /usr/bin
+		readonly /usr/bin 'quoted text' sed printf
+x=1 && grep sed ${HOME} "$@" echo export echo
+		awk ${HOME} test && grep
+	local awk x=1 && --verbose done -eu
+	-eu grep 2>/dev/null --verbose x=1 "$@" local
+	"$@" cd && echo | export && | local echo -eu
+	"$@" -eu readonly "$@" $(pwd) test local $(pwd)
+readonly | 'quoted text' /usr/bin local export awk done test x=1 'quoted text'
+		then /usr/bin grep $(pwd) test echo /usr/bin x=1 cd "$1" "$1" printf 2>/dev/null
+'quoted text' awk readonly
+	-eu local awk | | 'quoted text' ${HOME} ${HOME} sed
+		export echo -eu x=1 awk -eu local $(pwd) awk x=1 2>/dev/null | -eu && echo cd
+	cd awk --verbose | local "$1" cd | /usr/bin readonly done 'quoted text'
+		sed local then && | sed --verbose echo export echo awk
+		printf local -eu export export awk awk test 2>/dev/null
+--verbose export "$@" readonly then
+	done printf sed -eu local echo && ${HOME} "$1" $(pwd) "$1" echo 2>/dev/null
+	readonly $(pwd) $(pwd) printf ${HOME} | printf "$1" done
+	printf -eu grep x=1 x=1 echo awk "$@" local /usr/bin 2>/dev/null printf then
+		export 'quoted text' --verbose "$1" "$@"
+	&& && 2>/dev/null test local readonly 'quoted text' then awk
+		| export x=1 sed then /usr/bin local then
+	printf done export "$@" cd local awk
+	${HOME} "$@" x=1 && $(pwd) cd export local test cd
+then test done sed sed && 2>/dev/null awk done ${HOME} grep
+		local $(pwd) --verbose awk 2>/dev/null --verbose echo cd "$1" $(pwd) awk
+test test | local test $(pwd) "$1" 'quoted text' done $(pwd)
+	| test /usr/bin awk cd then readonly
+		2>/dev/null | "$@" && then ${HOME}
+	readonly -eu $(pwd) done 2>/dev/null "$1" sed x=1 echo x=1 /usr/bin
+		2>/dev/null 'quoted text' && && test then "$1" ${HOME} printf printf awk "$@" done
+grep 'quoted text' export "$@" ${HOME}
+	-eu "$@" readonly | "$@" && then ${HOME} ${HOME}
+		"$1" "$1" --verbose -eu "$1" echo "$@"
+printf "$1" echo test x=1 test readonly
+	/usr/bin --verbose $(pwd) test --verbose readonly grep 'quoted text'
+		"$1" test -eu export /usr/bin sed echo x=1
+		--verbose test | "$1" printf awk
+	readonly printf awk test | x=1 /usr/bin
+	-eu test done cd cd readonly then && cd "$@" cd
+	x=1 'quoted text' $(pwd) then grep export $(pwd) | x=1 && grep echo && test
+	-eu awk /usr/bin | -eu awk done cd printf
+		${HOME} --verbose x=1 && --verbose echo local /usr/bin local
+	/usr/bin local && --verbose grep
+local 'quoted text' 2>/dev/null /usr/bin "$@"
+		&& printf echo 'quoted text' /usr/bin printf then "$@" grep --verbose then 2>/dev/null
+		$(pwd) 2>/dev/null done cd awk export local x=1 /usr/bin 2>/dev/null
+echo awk cd done 'quoted text' x=1
+		${HOME} && done ${HOME} done done
+cd | awk x=1 awk /usr/bin grep /usr/bin awk readonly | | readonly
+then done /usr/bin awk echo 'quoted text' x=1
+		&& local local then $(pwd)
+	$(pwd) "$@" -eu echo 2>/dev/null $(pwd) ${HOME} -eu | test export readonly
+	"$1" readonly | 'quoted text' sed test $(pwd) echo
+	then 'quoted text' export test "$1" |
+awk 2>/dev/null echo "$1" /usr/bin sed | $(pwd)
+		&& "$1" test ${HOME} $(pwd) 2>/dev/null test sed "$@" then "$@" --verbose
+		done export x=1 echo readonly | echo readonly cd $(pwd) x=1 echo 2>/dev/null
+grep ${HOME} --verbose
+export echo export printf echo export
+		$(pwd) | printf 2>/dev/null
+&& echo cd cd x=1 test printf 'quoted text'
+	printf 2>/dev/null readonly $(pwd) ${HOME} awk export
+	| "$@" grep /usr/bin -eu &&
+2>/dev/null "$1" export test
+		test local then "$1" -eu 'quoted text' sed $(pwd) x=1 printf export readonly
+		awk 2>/dev/null | printf cd
+"$@" grep -eu echo done && export awk 'quoted text' "$@"
+${HOME} 2>/dev/null awk "$1" readonly /usr/bin readonly
+	readonly 2>/dev/null export "$@" x=1 then grep --verbose && -eu && "$1"
+	-eu | --verbose echo $(pwd) readonly export -eu readonly "$1" readonly -eu 2>/dev/null
+	awk awk test 'quoted text' export
+"$1" | export echo test
+		done awk export ${HOME} x=1 then --verbose
+local | printf echo 2>/dev/null | -eu $(pwd) | --verbose grep awk ${HOME}
+		local test printf $(pwd) done sed sed printf
+	printf cd ${HOME} awk /usr/bin
+	${HOME} 2>/dev/null 'quoted text' grep $(pwd) /usr/bin | && printf | sed
+sed sed awk done echo readonly "$1" "$@" 'quoted text' | /usr/bin
+printf --verbose printf x=1 readonly sed |
+"$@" done grep 'quoted text' 2>/dev/null cd printf test /usr/bin local
+		printf /usr/bin "$@" local ${HOME} printf "$1" sed 2>/dev/null
+done --verbose 2>/dev/null echo /usr/bin 2>/dev/null 'quoted text' "$@"
+| --verbose export readonly /usr/bin "$@" 2>/dev/null
+	&& ${HOME} readonly -eu -eu then test test done
+		/usr/bin grep --verbose "$@" done then local
+	${HOME} && "$1" 2>/dev/null "$@" done test && echo x=1 | grep && then export
+x=1 | cd "$1" cd 'quoted text' done readonly -eu /usr/bin x=1
+	local done 'quoted text'
+	2>/dev/null local 2>/dev/null 2>/dev/null test | 'quoted text'
+"$1" "$1" readonly then x=1 x=1 x=1 && then export
+readonly --verbose echo x=1 'quoted text' $(pwd) grep $(pwd) echo | 'quoted text'
+		export cd $(pwd) done "$@" cd printf "$@" local $(pwd) cd
+		echo sed "$1" "$@" && 'quoted text' 'quoted text' "$@" awk x=1 then then
+	test | && 2>/dev/null printf readonly readonly export
+		'quoted text' -eu printf x=1 printf -eu test test
+		--verbose ${HOME} export -eu printf "$@" --verbose grep echo
+awk $(pwd) $(pwd) local printf
+		&& done /usr/bin sed sed export readonly 'quoted text'
+	local awk "$@" "$1" ${HOME} $(pwd)
+/usr/bin done | export "$1" sed
+		| x=1 'quoted text' 2>/dev/null test
+local export --verbose ${HOME} local
+	export readonly printf ${HOME} $(pwd) "$@" x=1 'quoted text'
+/usr/bin -eu export "$1" && ${HOME} /usr/bin
+then && sed local echo local readonly awk /usr/bin
+	local export 2>/dev/null -eu local
+grep 'quoted text' "$@" -eu readonly local
+done export && "$@" grep echo /usr/bin --verbose sed export local
+&& sed then 2>/dev/null awk "$@" sed readonly && "$@"
+/usr/bin export && export then
+		then printf printf local readonly local 2>/dev/null local readonly
+		readonly grep test test ${HOME} done
+	-eu test 2>/dev/null grep test echo sed -eu
+	2>/dev/null $(pwd) --verbose readonly done -eu readonly awk "$@" test
+test done awk sed -eu --verbose done | | /usr/bin then && --verbose sed 'quoted text'
+		&& $(pwd) ${HOME} "$@" then awk --verbose | /usr/bin -eu "$@"
+	printf done local | export then
+2>/dev/null export -eu cd -eu done done ${HOME} "$1" "$1"
+	local sed "$1" | 'quoted text' sed 'quoted text'
+-eu then | grep --verbose && readonly | "$@" && then ${HOME} echo local sed export
+$(pwd) -eu && then local 'quoted text' 2>/dev/null
+printf ${HOME} awk && then && 2>/dev/null $(pwd) sed export --verbose -eu test
+	local | test 'quoted text' sed --verbose "$1" | grep "$1" -eu
+		/usr/bin test --verbose /usr/bin test grep printf 'quoted text' then
+	test export test readonly -eu | export $(pwd) local ${HOME} echo 2>/dev/null x=1
+		printf /usr/bin /usr/bin export "$1" && 2>/dev/null x=1 cd printf 2>/dev/null sed
+'quoted text' local printf sed x=1 "$@" && readonly
+		"$@" test -eu $(pwd) $(pwd) && test awk done
+		"$1" then "$@" "$1" sed ${HOME}
+x=1 | test cd | && printf "$1" readonly --verbose awk -eu
+		-eu 'quoted text' && export "$@" -eu export
+done grep readonly 'quoted text' $(pwd) x=1 "$1" 2>/dev/null export cd "$@"
+		$(pwd) -eu printf && /usr/bin echo x=1 | && test export
+"$1" export cd -eu then local $(pwd) 2>/dev/null
+		"$1" /usr/bin $(pwd) | sed --verbose | 'quoted text'
+"$1" local | printf -eu $(pwd) --verbose && ${HOME} "$1" test
+	2>/dev/null test echo echo
+cd --verbose grep $(pwd) local
+sed "$@" done local cd echo ${HOME}
+export $(pwd) 'quoted text'
+		test test /usr/bin test export 'quoted text' local && awk $(pwd) "$@" local
+		cd 2>/dev/null "$1" readonly local grep sed -eu && ${HOME}
+	/usr/bin -eu 'quoted text' cd 2>/dev/null 2>/dev/null 'quoted text'
+-eu test /usr/bin ${HOME} 'quoted text' echo printf test "$1" /usr/bin
+printf sed /usr/bin -eu | ${HOME} readonly grep grep "$@" && done then printf done
+		2>/dev/null -eu printf grep grep -eu &&
+printf readonly sed printf local ${HOME} 2>/dev/null test
+printf export then /usr/bin then x=1 "$@" grep awk 2>/dev/null
+	printf x=1 export echo done ${HOME} 2>/dev/null test ${HOME} echo $(pwd) export
+| 'quoted text' printf | 'quoted text' export readonly && grep
+--verbose sed grep | export | /usr/bin /usr/bin && test && /usr/bin --verbose $(pwd)
+	"$@" 'quoted text' echo test | done printf test export
+		--verbose "$1" -eu printf then done cd $(pwd) awk done
+	/usr/bin export then | done | cd then awk /usr/bin cd $(pwd) done && printf
+printf readonly readonly $(pwd) local awk 'quoted text' --verbose printf then
+		local ${HOME} "$1" sed local
+		&& "$1" sed 2>/dev/null grep 'quoted text' 'quoted text' printf $(pwd) export
+		x=1 done echo then awk then echo ${HOME} local $(pwd) "$1" done
+| $(pwd) grep ${HOME} export cd $(pwd) | /usr/bin $(pwd) | --verbose "$@" test
+	readonly grep /usr/bin readonly && readonly sed grep -eu grep
+		'quoted text' readonly cd x=1 grep $(pwd) "$@"
+"$1" readonly $(pwd) --verbose local $(pwd) --verbose export
+		2>/dev/null grep printf echo x=1 local 2>/dev/null "$1" readonly
+	'quoted text' done local | /usr/bin
+		done && $(pwd) then $(pwd) echo -eu "$1" grep echo | "$1" --verbose sed
+		/usr/bin grep $(pwd) awk then
+| export cd ${HOME} "$@" cd echo $(pwd) sed export
+	2>/dev/null awk "$1" $(pwd) /usr/bin awk echo /usr/bin
+	awk | sed done "$1" printf x=1 "$@"
+		grep done --verbose printf -eu /usr/bin readonly 2>/dev/null awk printf
+	2>/dev/null then $(pwd) $(pwd)
+		$(pwd) 'quoted text' -eu "$@" printf $(pwd) cd done then
+		test 2>/dev/null cd /usr/bin done --verbose 'quoted text'
+done done readonly printf /usr/bin /usr/bin /usr/bin
+		--verbose echo $(pwd) export -eu done 'quoted text' x=1
+local /usr/bin local cd --verbose grep echo /usr/bin test
+	| awk export $(pwd) test cd "$1" printf
+${HOME} echo echo test cd && 'quoted text' export "$@"
+	2>/dev/null export --verbose local ${HOME} 2>/dev/null -eu
+--verbose cd x=1 awk printf && test then export local done $(pwd)
+2>/dev/null printf then grep
+		local "$1" ${HOME} $(pwd) readonly test printf printf /usr/bin "$1"
+"$1" --verbose ${HOME} sed "$1" export --verbose /usr/bin -eu
+		"$@" then 'quoted text'
+		2>/dev/null awk cd ${HOME} "$@" echo
+		"$@" | export sed "$1" ${HOME} 2>/dev/null then sed "$@" printf
+done then then printf && $(pwd) "$1" then ${HOME} grep "$1" awk export &&
+	done then done -eu x=1 cd | cd | sed test printf grep
+x=1 awk then readonly -eu
+awk grep done export local echo sed local
+$(pwd) $(pwd) cd -eu readonly printf 'quoted text' export
+	printf awk sed | x=1 export test printf ${HOME} grep
+/usr/bin /usr/bin readonly awk --verbose awk done ${HOME} "$@" grep ${HOME} done
+printf sed awk 2>/dev/null 2>/dev/null awk cd /usr/bin /usr/bin
+		echo && local ${HOME}
+		readonly 'quoted text' x=1 x=1 test cd readonly
+		/usr/bin "$1" done test printf /usr/bin
+${HOME} /usr/bin printf then printf ${HOME} grep x=1 local
+awk "$1" readonly export printf echo echo "$1" then | test && x=1 'quoted text'
+	x=1 2>/dev/null awk | readonly /usr/bin then sed "$@" 2>/dev/null
+	awk x=1 -eu -eu echo --verbose
+echo 'quoted text' -eu | echo export then /usr/bin "$@"
+		-eu done | -eu $(pwd) awk | /usr/bin "$@" grep echo echo --verbose grep -eu sed
+	printf && then awk 'quoted text' then 2>/dev/null readonly "$1" --verbose export
+	done echo --verbose "$1" local grep sed
+		readonly | $(pwd) export readonly then local $(pwd)
+		printf x=1 2>/dev/null sed /usr/bin export cd then
+		local /usr/bin -eu 2>/dev/null
+		-eu readonly cd awk "$1" 2>/dev/null printf 'quoted text'
+	printf grep export /usr/bin
+		cd sed grep 'quoted text' $(pwd)
+	'quoted text' export $(pwd) | readonly cd /usr/bin
+	test | local -eu grep 2>/dev/null
+	test /usr/bin | readonly ${HOME} | cd echo echo export readonly "$@"
+echo 2>/dev/null ${HOME} 2>/dev/null readonly awk echo --verbose
+	cd test local export awk ${HOME} awk ${HOME} x=1 ${HOME} | echo $(pwd)
+		then /usr/bin export x=1 2>/dev/null
+$(pwd) awk sed sed readonly /usr/bin -eu --verbose
+2>/dev/null readonly echo printf --verbose export test sed 'quoted text'
+		awk 'quoted text' then cd 'quoted text' && && x=1 /usr/bin
+x=1 export local | printf /usr/bin local 'quoted text' 2>/dev/null && done --verbose
+		then printf /usr/bin readonly readonly test "$@" --verbose grep 2>/dev/null
+		sed 'quoted text' 'quoted text' 2>/dev/null awk local grep 'quoted text'
+$(pwd) cd printf --verbose local 'quoted text' $(pwd) export local ${HOME}
+		/usr/bin sed echo --verbose readonly printf ${HOME} awk
+	&& ${HOME} && --verbose local grep -eu ${HOME} ${HOME}
+		${HOME} cd sed readonly && sed "$@" awk grep sed 2>/dev/null printf
+		${HOME} echo cd ${HOME}
+sed sed sed && "$@" then
+done "$1" "$@" -eu "$1" | export $(pwd) 'quoted text' && echo
+printf --verbose grep printf done -eu local --verbose echo export readonly cd ${HOME}
+	| export echo "$@" grep test done test printf "$1" "$@" | $(pwd) sed && --verbose
+		"$1" && printf "$@" /usr/bin
+${HOME} ${HOME} export | test printf then printf ${HOME}
+	sed awk test x=1 grep awk ${HOME} printf
+		/usr/bin ${HOME} "$@" readonly
+sed --verbose test "$@" grep
+		readonly "$1" echo export cd local
+		test done sed cd test 'quoted text' then echo 'quoted text'
+		${HOME} export && cd test 'quoted text'
+	readonly && $(pwd) 2>/dev/null local
+		$(pwd) test "$1" printf readonly && --verbose
+cd awk sed /usr/bin x=1 readonly 2>/dev/null -eu export 2>/dev/null
+grep "$@" readonly -eu test --verbose x=1
+		sed export sed echo awk grep --verbose -eu && readonly
+	printf $(pwd) printf x=1 'quoted text' 2>/dev/null /usr/bin test "$1" test echo
+		2>/dev/null awk -eu test then --verbose sed local 'quoted text' "$1" readonly
+	x=1 test sed --verbose test | 'quoted text'
+	done --verbose grep printf
+		done grep test test test 'quoted text' "$1" then test sed && local
+		done 2>/dev/null test | "$1" 'quoted text' local awk readonly &&
+/usr/bin 'quoted text' --verbose grep "$@" 2>/dev/null
+		export && --verbose $(pwd) printf ${HOME} && readonly test done echo readonly ${HOME}
+		-eu echo readonly sed then -eu | /usr/bin readonly awk | "$@" "$1"
+	awk $(pwd) grep printf
+/usr/bin -eu | /usr/bin local --verbose 'quoted text'
+		&& x=1 awk grep export
+		printf sed $(pwd) readonly printf
+	readonly "$@" /usr/bin done /usr/bin local readonly
+/usr/bin readonly readonly grep local --verbose 'quoted text'
+	export cd 'quoted text' | "$1" && readonly
+	/usr/bin /usr/bin test $(pwd) sed grep
+	x=1 then -eu awk && "$1" ${HOME} test --verbose
+		then printf done cd echo printf 'quoted text' ${HOME} printf
+	local cd test --verbose "$@" done grep awk grep | "$@" ${HOME} "$1" awk --verbose
+		sed test test done && sed echo
+| sed echo sed --verbose 2>/dev/null
+		&& /usr/bin awk local "$@" grep then ${HOME} 2>/dev/null sed echo x=1
+		"$1" local export x=1 sed export cd test "$@"
+		'quoted text' grep /usr/bin cd /usr/bin && && "$@" readonly then ${HOME} | | &&
+		sed grep && ${HOME} x=1 "$@" readonly
+$(pwd) local && awk test then "$1" echo cd --verbose readonly |
+		sed local "$@" 'quoted text' && export 2>/dev/null /usr/bin
+grep --verbose ${HOME}
+		local --verbose then then local export
+		done readonly local printf $(pwd) --verbose "$@" awk
+		$(pwd) "$1" done done test "$@" then 'quoted text'
+	"$1" ${HOME} local awk printf $(pwd) sed awk -eu local done export --verbose
+	"$@" && x=1 --verbose sed "$1" done | ${HOME}
+		x=1 --verbose 2>/dev/null
+		test readonly local done echo
+	readonly 2>/dev/null 2>/dev/null ${HOME}
+awk /usr/bin x=1 -eu test
+&& then cd done readonly printf test 2>/dev/null $(pwd) 'quoted text'
+		echo ${HOME} | 'quoted text' /usr/bin ${HOME} $(pwd) printf then
+	done echo "$@" | $(pwd) && readonly done | --verbose x=1 --verbose 2>/dev/null
+2>/dev/null then /usr/bin | "$1" test sed awk readonly ${HOME}
+${HOME} test echo grep && then test 2>/dev/null ${HOME} /usr/bin
+${HOME} local printf awk grep -eu -eu 'quoted text'
+		"$1" && cd sed -eu printf sed
+done local "$@" ${HOME} readonly
+		| | 'quoted text' -eu sed export /usr/bin local 2>/dev/null
+-eu echo cd export 'quoted text' echo printf readonly
+	"$1" --verbose --verbose then echo 2>/dev/null readonly readonly
+	sed 'quoted text' printf 'quoted text' printf local /usr/bin ${HOME}
+		${HOME} 'quoted text' then 'quoted text' | export echo 2>/dev/null "$1"
+export cd "$@" | echo 2>/dev/null echo readonly then cd done $(pwd) sed readonly
+	echo x=1 "$1" done grep done sed sed
+2>/dev/null "$@" export --verbose ${HOME} --verbose export grep awk then -eu
+		echo 'quoted text' /usr/bin
+"$1" 2>/dev/null printf /usr/bin done then grep "$1"
+	"$1" printf "$1" printf "$1" echo
+	"$@" sed | export export export 2>/dev/null -eu "$1" "$@" then grep echo
+	$(pwd) grep echo --verbose -eu ${HOME} then 'quoted text'
+		cd -eu local "$@" "$1" echo local grep "$@" local -eu
+"$@" cd sed grep | 'quoted text' -eu
+		"$@" ${HOME} printf awk $(pwd) -eu ${HOME} 2>/dev/null | sed 'quoted text'
+awk sed then 2>/dev/null export 'quoted text' echo --verbose && done
+/usr/bin cd "$1" -eu printf echo then printf echo
+test grep export grep 2>/dev/null done export then test local x=1
+	sed "$1" | echo 'quoted text' x=1 2>/dev/null readonly "$@" "$1" readonly "$@"
+"$1" -eu /usr/bin "$1" "$@" readonly then export "$@"
+	"$@" done "$@" cd sed ${HOME} test readonly | -eu "$1" ${HOME}
+		-eu /usr/bin && | done readonly local $(pwd) -eu
+	then local awk then ${HOME} cd printf $(pwd) "$@" readonly 2>/dev/null
+		done test export | grep --verbose
+		"$1" printf "$1" --verbose 'quoted text' sed x=1 && $(pwd) 'quoted text'
+sed printf $(pwd) then sed $(pwd) then $(pwd) x=1 /usr/bin local "$1" then cd
+		printf echo cd test x=1 $(pwd)
+	cd 'quoted text' x=1 done | echo grep 2>/dev/null 'quoted text'
+test | test echo sed printf grep ${HOME} 2>/dev/null sed
+	grep done local readonly readonly then x=1 sed ${HOME} cd printf && && 2>/dev/null
+		cd done | 2>/dev/null --verbose
+		-eu local --verbose 'quoted text' && awk
+	'quoted text' printf "$1" $(pwd) "$@" "$@" /usr/bin grep printf 2>/dev/null
+	export readonly printf cd /usr/bin --verbose | "$1" echo | local printf cd
+grep $(pwd) echo 2>/dev/null test $(pwd) readonly 'quoted text' /usr/bin
+		test /usr/bin done ${HOME} -eu /usr/bin printf
+sed "$@" x=1 -eu /usr/bin && $(pwd) "$@" sed echo cd && echo 'quoted text'
+		| sed printf "$@" export x=1 -eu 2>/dev/null test grep -eu test 'quoted text'
+		echo sed $(pwd) x=1 done cd done --verbose grep local "$@" then test 'quoted text'
+	| --verbose export "$1" | done grep "$1" 'quoted text' -eu local
+		sed --verbose local readonly printf "$@" --verbose ${HOME} sed done cd readonly
+done then 'quoted text' readonly x=1 | test "$@" "$1"
+	"$1" echo test test done --verbose export echo /usr/bin $(pwd) --verbose
+		'quoted text' && then echo echo
+		echo "$@" local $(pwd) readonly x=1 -eu echo --verbose 'quoted text'
+	"$1" cd && awk awk && $(pwd) then then awk then
+awk --verbose "$@" sed "$1"
+&& /usr/bin done /usr/bin sed awk awk && $(pwd) done
+	$(pwd) cd /usr/bin test readonly cd x=1 --verbose 2>/dev/null $(pwd)
+	${HOME} then $(pwd) -eu $(pwd) 2>/dev/null "$@" grep /usr/bin local
+		awk grep echo cd test echo && "$@" x=1 2>/dev/null --verbose --verbose
+	x=1 export then "$1" 'quoted text' cd /usr/bin -eu done | -eu export
+		cd | && --verbose printf "$1" ${HOME}
+	"$1" --verbose sed && | /usr/bin | && | grep "$@" local
+		grep test && /usr/bin "$1" && x=1 local x=1 -eu
+	export "$@" $(pwd) export --verbose test x=1 --verbose /usr/bin awk cd x=1 awk
+		then local | /usr/bin ${HOME}
+	"$@" grep 2>/dev/null done
+local test ${HOME} -eu x=1 printf export then printf "$1" "$@" x=1 --verbose
+	sed test awk grep --verbose cd echo -eu /usr/bin cd echo
+cd -eu 2>/dev/null "$@" /usr/bin x=1 grep "$1" --verbose
+		${HOME} "$1" 2>/dev/null 2>/dev/null readonly x=1 printf && "$1"
+		"$@" echo test "$1" export --verbose
+		grep x=1 test -eu /usr/bin local export "$@" | local readonly ${HOME} echo
+local sed x=1 /usr/bin -eu then done export awk 2>/dev/null "$1"
+	export --verbose local then
+'quoted text' readonly -eu grep -eu local done /usr/bin test printf "$1" then
+		local sed $(pwd) --verbose
+	$(pwd) -eu local && grep then readonly
+		"$1" test sed x=1 /usr/bin /usr/bin grep
+printf && grep printf local cd "$@" awk test -eu
+	then echo "$@" 'quoted text' done "$1"
+	$(pwd) readonly local grep 'quoted text' $(pwd) x=1
+	done printf sed echo readonly cd
+		cd then | printf done ${HOME} "$1"
+		${HOME} ${HOME} then $(pwd) printf --verbose
+		"$1" ${HOME} --verbose /usr/bin echo && grep
+		sed export awk cd printf local x=1 awk ${HOME}
+	done sed ${HOME} sed --verbose $(pwd) local export echo "$1" local echo export
+	export local -eu --verbose echo "$1" x=1 "$1" printf sed local export && cd -eu
+	grep | grep ${HOME} | awk echo 2>/dev/null 'quoted text'
+		/usr/bin printf -eu && export awk "$1" awk sed done -eu
+		local $(pwd) -eu ${HOME} then grep /usr/bin --verbose
+'quoted text' ${HOME} && grep readonly ${HOME} grep grep
+		2>/dev/null x=1 cd test -eu printf printf
+	cd sed test | sed test export | -eu -eu printf "$1" $(pwd)
+echo echo done export sed 2>/dev/null sed cd x=1 --verbose readonly
+		grep 'quoted text' local 2>/dev/null then -eu ${HOME}
+x=1 && x=1 $(pwd) done local grep grep ${HOME} local test test export sed x=1
+readonly test sed grep
+		test ${HOME} $(pwd) local && "$1" echo 2>/dev/null "$@" test --verbose x=1
+done /usr/bin 'quoted text' $(pwd) $(pwd) "$1" "$1" --verbose
+"$1" test -eu /usr/bin 2>/dev/null 2>/dev/null export awk readonly
+export grep grep $(pwd) 'quoted text' echo "$@" echo $(pwd)
+		export local -eu local "$@" then sed grep 'quoted text' 'quoted text'
+		sed /usr/bin 'quoted text' grep /usr/bin
+	grep export $(pwd) "$@" /usr/bin test 2>/dev/null done
+	2>/dev/null "$1" printf ${HOME} readonly sed --verbose
+	awk echo | done cd 2>/dev/null awk 'quoted text'
+	"$1" && awk 'quoted text'
+		${HOME} && cd grep | 'quoted text' | sed | "$@" printf export
+		&& "$1" readonly printf ${HOME} && --verbose echo awk "$@" cd
+		${HOME} && ${HOME} test 'quoted text'
+		&& grep x=1 echo test printf ${HOME} awk "$1"
+	| cd --verbose done awk | printf
+	then /usr/bin $(pwd) sed $(pwd) local -eu then 2>/dev/null
+then -eu export sed test test ${HOME} 'quoted text' done 'quoted text'
+done test awk -eu 'quoted text' test /usr/bin local x=1 'quoted text'
+	/usr/bin 'quoted text' "$@" | 2>/dev/null && 'quoted text' readonly -eu local
+		$(pwd) grep 2>/dev/null --verbose $(pwd) x=1 printf
+		cd then readonly sed x=1 | "$@" 2>/dev/null then $(pwd)
+		grep ${HOME} grep /usr/bin
+-eu /usr/bin /usr/bin then --verbose
+2>/dev/null local test echo 2>/dev/null
+sed grep cd /usr/bin "$1" 2>/dev/null
+readonly -eu then echo cd "$@" "$@" 'quoted text' -eu | echo ${HOME} --verbose
+sed printf "$@" && x=1 printf
+		| 'quoted text' done x=1 /usr/bin then local sed | done printf
+		cd grep awk printf 'quoted text' done
+/usr/bin x=1 local readonly then local export
+		${HOME} local grep /usr/bin | "$@" cd export export "$@"
+"$@" ${HOME} readonly | && done printf echo export x=1 cd grep "$@"
+		readonly "$1" echo "$@" printf grep -eu test cd readonly | echo | export done
+		cd grep export /usr/bin
+		test awk "$1" readonly test "$1" -eu $(pwd) | "$1" 'quoted text' done x=1
+		done grep "$@" x=1 awk readonly "$@" "$@" sed x=1 "$@" x=1 export && grep
+	2>/dev/null local grep --verbose
+		sed printf grep awk grep then grep ${HOME}
+		$(pwd) grep "$@" export | grep then export then echo 2>/dev/null
+	&& && grep && /usr/bin awk "$@" done
+/usr/bin "$1" export | "$1" "$1" readonly export x=1 sed cd
+| done && grep done -eu grep local "$1" 'quoted text' printf "$@" $(pwd)
+cd echo 2>/dev/null echo local $(pwd)
+"$@" cd /usr/bin done && local sed then readonly "$1" readonly -eu
+	-eu local ${HOME} --verbose then echo -eu export sed
+'quoted text' 'quoted text' local
+		export | 'quoted text' export
+		cd test then awk -eu 2>/dev/null ${HOME} cd sed "$1" x=1 grep
+		awk "$1" 2>/dev/null awk $(pwd) sed --verbose
+echo awk "$@" done awk -eu && export awk cd then awk readonly
+		awk done 'quoted text' done awk sed && -eu ${HOME} printf 'quoted text' "$1"
+		printf 'quoted text' $(pwd) "$1" echo cd echo
+-eu /usr/bin local cd readonly && printf
+		2>/dev/null "$@" ${HOME} 2>/dev/null local export
+	grep -eu ${HOME} 2>/dev/null --verbose "$@" && "$1" /usr/bin /usr/bin 'quoted text'
+		x=1 x=1 "$1" printf && sed export local cd --verbose
+#include c191.sh
+cd 'quoted text' printf --verbose -eu && grep
+	grep readonly cd | grep $(pwd) && ${HOME} x=1 done printf awk local local printf
+	grep done then then sed grep test && then awk sed cd --verbose export
+	echo "$@" sed $(pwd) cd done awk $(pwd) then -eu -eu local done
+		"$@" "$@" grep x=1 | sed sed echo "$@" | sed -eu local sed x=1 "$1" export "$@"
+	grep && test then awk 'quoted text' test "$1" done printf
+	cd -eu sed printf grep "$@" test grep test "$1" then "$1" export && grep
+	then readonly && test test x=1 --verbose | -eu grep awk $(pwd) then --verbose x=1
+	| done x=1 "$1" awk ${HOME}
+	$(pwd) x=1 export then export test && local $(pwd)
+	/usr/bin test 2>/dev/null $(pwd) local sed done
+		-eu awk 2>/dev/null test
+	export -eu 'quoted text' grep readonly local --verbose
+&& cd awk printf ${HOME} echo cd sed --verbose x=1 |
+echo done && test export export 2>/dev/null export awk | test --verbose
+sed 'quoted text' test x=1 done -eu echo
+&& 2>/dev/null --verbose awk awk local --verbose local
+		'quoted text' $(pwd) && 'quoted text' awk -eu echo export awk readonly --verbose
+		-eu && test cd $(pwd) cd
+	2>/dev/null grep $(pwd) local test cd "$1" awk 2>/dev/null
+"$1" --verbose then local |
+	then $(pwd) x=1 -eu 2>/dev/null 2>/dev/null echo
+/usr/bin --verbose test local test ${HOME} ${HOME} "$@" 2>/dev/null local x=1
+awk /usr/bin then && --verbose readonly "$1" | sed local readonly awk x=1 && sed
+	&& "$1" echo awk 'quoted text' readonly | done grep printf export awk
+		x=1 done then grep awk && "$@" x=1 echo x=1 "$1" x=1 export $(pwd) local
+	'quoted text' "$1" echo "$@" && | $(pwd) test then
+	cd test awk done 2>/dev/null done export && ${HOME} printf /usr/bin "$1"
+cd "$@" export && /usr/bin "$@" --verbose "$@" cd export
+	then ${HOME} printf x=1 echo $(pwd) done --verbose
+		'quoted text' awk --verbose done local 2>/dev/null ${HOME} $(pwd) "$1" grep
+		local grep /usr/bin && grep "$1" done then 'quoted text'
+local then $(pwd) -eu x=1 awk $(pwd) sed
+		awk awk --verbose $(pwd) | | "$1" -eu local readonly "$@" 'quoted text' 'quoted text'
+	/usr/bin local "$@" test test sed $(pwd) readonly echo && awk "$1" local
+	'quoted text' cd readonly grep test then done done --verbose x=1 export then
+	printf grep 'quoted text' export done | $(pwd) printf 'quoted text'
+${HOME} echo readonly && local
+/usr/bin done local sed -eu cd export 'quoted text'
+		done local "$@" echo echo x=1 ${HOME} --verbose local
+	x=1 | grep local "$@" sed && "$@" x=1 grep readonly local done sed local
+	grep 2>/dev/null 2>/dev/null 'quoted text'
+	-eu 'quoted text' awk done readonly sed -eu x=1 grep grep && printf
+		sed 2>/dev/null --verbose $(pwd) echo ${HOME} /usr/bin /usr/bin
+export | readonly export 2>/dev/null sed printf | export && ${HOME} awk
+x=1 /usr/bin echo -eu "$@" "$1" 2>/dev/null && sed then -eu
+	test cd $(pwd) echo grep test grep cd readonly echo && awk done
+		then x=1 "$1" "$@" local then awk --verbose awk export cd cd local "$@" --verbose
+export /usr/bin $(pwd) test readonly "$@" $(pwd)
+	readonly | echo local then "$@" then 'quoted text'
+	done && done printf /usr/bin test export "$@" --verbose "$1"
+-eu printf 2>/dev/null 2>/dev/null
+'quoted text' && && grep x=1 $(pwd) cd printf test 2>/dev/null 'quoted text'
+	${HOME} printf -eu 2>/dev/null
+	&& then then --verbose 'quoted text' "$@" -eu 'quoted text' ${HOME} &&
+		"$@" printf x=1 --verbose /usr/bin | awk 2>/dev/null $(pwd) "$@" then awk ${HOME}
+		| echo | "$1" && export $(pwd) sed -eu then | test x=1 export sed 2>/dev/null
+	'quoted text' && done then --verbose && echo && 'quoted text' printf --verbose
+		echo awk && | export grep grep --verbose
+$(pwd) cd 2>/dev/null
+		'quoted text' $(pwd) "$1" test test ${HOME} cd export readonly
+	x=1 /usr/bin grep then /usr/bin cd local | | printf "$1"
+		local -eu sed 'quoted text' local done export export then printf
+2>/dev/null /usr/bin sed 2>/dev/null
+| readonly readonly printf sed local sed sed /usr/bin
+	echo /usr/bin grep test "$@" export --verbose
+grep $(pwd) /usr/bin 'quoted text' awk ${HOME} /usr/bin "$@"
+	x=1 sed -eu ${HOME} echo | 'quoted text'
+		--verbose 'quoted text' && readonly then -eu printf --verbose "$1" $(pwd)
+		export "$1" /usr/bin | -eu $(pwd) | printf $(pwd) local cd -eu readonly "$@"
+	test echo 2>/dev/null 'quoted text' /usr/bin test echo readonly
+readonly 2>/dev/null $(pwd) | --verbose
+grep 'quoted text' done ${HOME} 'quoted text' local sed awk grep
+	/usr/bin printf 2>/dev/null sed "$@" | echo
+	then awk echo done done --verbose "$1" test $(pwd)
+	-eu cd x=1 && ${HOME} cd 2>/dev/null | local "$@" then awk
+		"$@" "$1" "$1" awk x=1 | local /usr/bin 'quoted text'
+		${HOME} -eu --verbose printf
+	sed 2>/dev/null readonly x=1 2>/dev/null
+grep $(pwd) then cd 2>/dev/null readonly
+		test 'quoted text' then then done $(pwd) -eu $(pwd) awk echo printf
+/usr/bin awk echo --verbose
+	local cd test -eu then export 2>/dev/null test | export printf
+	/usr/bin x=1 readonly local printf done 'quoted text' printf --verbose cd ${HOME}
+		readonly && /usr/bin echo | 'quoted text' echo
+	x=1 then ${HOME} 2>/dev/null ${HOME} done 'quoted text' --verbose readonly local
+		&& awk awk x=1 cd 'quoted text' "$@" export /usr/bin
+cd cd /usr/bin echo "$@" test awk then cd local && --verbose done sed cd printf
+--verbose awk ${HOME} && grep -eu export && awk printf echo
+local -eu readonly && /usr/bin done test "$@" done awk 2>/dev/null export
+		&& --verbose local 'quoted text' -eu readonly sed
+$(pwd) export echo 2>/dev/null then $(pwd) x=1 --verbose export
+		local done test x=1 local "$@" then x=1
+		export --verbose printf /usr/bin
+	then | 'quoted text' test then local "$@" grep && --verbose && 'quoted text'
+	cd printf "$@" grep cd --verbose then --verbose "$1" ${HOME} test awk
+&& "$@" cd then 'quoted text' "$@" 2>/dev/null then 2>/dev/null
+echo /usr/bin done 2>/dev/null cd awk printf
+		| then export | cd --verbose 2>/dev/null done -eu $(pwd) 'quoted text' sed | /usr/bin
+	printf /usr/bin sed -eu --verbose
+printf --verbose echo && printf done $(pwd)
+	readonly "$1" --verbose then 2>/dev/null done cd
+	then --verbose local "$@" grep export cd && sed printf then
+		done export 2>/dev/null
+	${HOME} cd -eu x=1 ${HOME} readonly /usr/bin $(pwd) cd printf test awk -eu grep
+		printf --verbose "$@" x=1 export /usr/bin | &&
+		x=1 -eu export echo -eu done ${HOME} "$@"
+		2>/dev/null test | then echo
+		-eu then 2>/dev/null export 2>/dev/null
+		printf readonly "$@" awk done awk
+	export $(pwd) cd grep 'quoted text' "$1" --verbose
+	'quoted text' ${HOME} then x=1 --verbose --verbose export /usr/bin -eu done done
+	local $(pwd) test --verbose echo awk "$@" awk done --verbose test test
+done cd -eu printf export awk done && -eu x=1 2>/dev/null grep /usr/bin
+	done | --verbose "$@" echo "$1" x=1 ${HOME} local -eu
+		echo | cd grep 2>/dev/null "$@" sed echo printf grep /usr/bin --verbose ${HOME}
+		done 2>/dev/null echo ${HOME}
+	then --verbose && done 'quoted text' -eu grep "$1"
+		/usr/bin && export cd export readonly grep export 2>/dev/null
+	/usr/bin then 2>/dev/null local "$1" awk ${HOME} "$1"
+	"$1" x=1 'quoted text' --verbose
+local export $(pwd) "$1" 'quoted text'
+	grep $(pwd) $(pwd) --verbose export x=1 /usr/bin then printf "$@" grep --verbose
+grep "$1" /usr/bin export 'quoted text' cd readonly
+test $(pwd) awk cd sed && --verbose 'quoted text'
+then ${HOME} then --verbose | "$@" local "$1" | -eu 2>/dev/null export
+		"$@" local 2>/dev/null then local export readonly 'quoted text'
+'quoted text' cd ${HOME} 2>/dev/null --verbose x=1 --verbose local test x=1
+--verbose sed grep 2>/dev/null && --verbose /usr/bin 'quoted text' && then
+	sed sed local test printf awk cd -eu grep "$1" 2>/dev/null sed then readonly
+		sed "$1" $(pwd) x=1 $(pwd) "$@" export $(pwd) then cd printf 'quoted text'
+then "$@" /usr/bin done then ${HOME} printf local
+		readonly -eu --verbose then 'quoted text' "$1" && done export "$1"
+awk local echo "$1" test local printf echo awk sed /usr/bin 'quoted text' awk &&
+		awk export readonly | /usr/bin 'quoted text'
+		sed readonly ${HOME} 'quoted text' /usr/bin
+x=1 readonly | x=1 done export -eu 2>/dev/null 2>/dev/null
+		grep cd test -eu echo grep | 'quoted text'
+		/usr/bin /usr/bin printf sed $(pwd) awk x=1 | 'quoted text'
+	test $(pwd) $(pwd) test then export "$1" readonly 'quoted text' done
+	${HOME} grep | "$1" x=1 | -eu "$@" "$@" local export "$@" 2>/dev/null
+	'quoted text' x=1 done --verbose -eu -eu printf printf
+readonly sed awk $(pwd) echo x=1 local "$@" --verbose | echo "$@" "$1" /usr/bin
+test 'quoted text' test test
+		readonly | 'quoted text' --verbose done
+grep local && --verbose 'quoted text' then "$1" echo sed printf
+		/usr/bin --verbose $(pwd) test done sed
+		local --verbose "$1" "$@" awk cd && local x=1
+		2>/dev/null sed awk awk $(pwd) x=1 /usr/bin awk echo test ${HOME} local && | awk
+		| "$@" cd 'quoted text' readonly echo test awk "$@" ${HOME} x=1 local -eu
+	| 2>/dev/null local done 'quoted text' --verbose cd $(pwd) local
+		-eu echo "$@" readonly printf /usr/bin
+		test "$1" $(pwd) 2>/dev/null ${HOME}
+export sed cd 2>/dev/null --verbose "$1" x=1 "$@"
+	${HOME} then 2>/dev/null awk 2>/dev/null $(pwd) awk test --verbose /usr/bin
+echo export $(pwd) 2>/dev/null printf readonly
+	--verbose --verbose && -eu readonly "$1" done cd local
+		| local "$@" "$@" "$@" x=1 | done
+		"$@" echo test test then done awk && -eu /usr/bin "$@" 2>/dev/null
+		awk /usr/bin 2>/dev/null then
+		test x=1 printf "$1" -eu "$1" sed local && "$@"
+grep /usr/bin && export -eu x=1 --verbose
+local export readonly awk awk echo test
+then ${HOME} && /usr/bin awk grep cd readonly awk "$@" awk x=1 awk ${HOME}
+	/usr/bin printf awk test "$@" 2>/dev/null -eu
+local sed -eu done export "$1" export awk done "$@"
+	readonly local readonly echo "$1" "$@" local test ${HOME} x=1 'quoted text' echo
+		echo then readonly printf export then | sed done x=1 --verbose
+"$1" echo x=1 'quoted text'
+		&& test test "$1" local cd printf && local printf 2>/dev/null
+		cd then "$1" 2>/dev/null awk "$@" done "$1" done
+"$@" awk local then ${HOME} "$@" /usr/bin 2>/dev/null
+	cd sed grep 'quoted text' 'quoted text'
+		$(pwd) "$1" awk && sed printf
+test awk printf --verbose && local readonly printf -eu ${HOME} readonly
+	$(pwd) test printf done readonly readonly
+		${HOME} test awk grep cd /usr/bin "$1" then export export 2>/dev/null
+		"$1" && printf printf x=1
+		awk then -eu ${HOME} $(pwd) "$1" "$1" awk local "$1" local
+		echo "$@" sed readonly 'quoted text'
+		"$@" printf cd awk 'quoted text' test "$1" then -eu printf && 'quoted text'
+	then test 2>/dev/null 'quoted text' -eu test export 'quoted text' done done
+	test | "$@" $(pwd) /usr/bin done grep 'quoted text' grep
+	'quoted text' done | local then echo sed /usr/bin
+	2>/dev/null x=1 awk /usr/bin && awk test 2>/dev/null
+	'quoted text' sed 'quoted text' cd
+	readonly -eu local cd printf --verbose
+		-eu 'quoted text' -eu x=1 --verbose cd test $(pwd) readonly && x=1 2>/dev/null
+-eu export test export && -eu sed /usr/bin export sed x=1 $(pwd)
+| "$1" test -eu /usr/bin
+-eu 2>/dev/null grep then readonly
+	done "$@" | echo ${HOME} ${HOME} export -eu /usr/bin grep $(pwd) local "$1"
+-eu /usr/bin -eu --verbose awk printf printf --verbose "$@" ${HOME} "$@"
+		export echo "$@" "$@" &&
+"$1" then /usr/bin done $(pwd) cd echo readonly awk done cd echo cd
+	done $(pwd) x=1 2>/dev/null grep ${HOME} printf --verbose /usr/bin "$1" $(pwd)
+/usr/bin awk awk done done printf sed "$@" awk awk export /usr/bin printf
+	2>/dev/null 'quoted text' 'quoted text' "$1" done then /usr/bin then test
+		2>/dev/null readonly 'quoted text'
+test cd cd --verbose ${HOME} --verbose grep sed readonly sed cd 'quoted text'
+		| x=1 local printf then done x=1 "$@" grep
+	x=1 && x=1 /usr/bin "$@" grep 'quoted text'
+		grep -eu | awk printf readonly
+		echo --verbose "$@" && 2>/dev/null "$1" then && /usr/bin printf awk /usr/bin
+		${HOME} awk echo local ${HOME}
+		--verbose awk test readonly $(pwd) test local "$@"
+local sed | x=1 /usr/bin local --verbose "$@" local | $(pwd)
+	'quoted text' export sed $(pwd)
+	"$1" --verbose local echo 2>/dev/null x=1
+		awk printf ${HOME} echo x=1 "$@" $(pwd) -eu grep
+	/usr/bin x=1 2>/dev/null awk "$@" --verbose cd sed done
+	--verbose 'quoted text' test local && "$@" cd -eu $(pwd)
+test && export 2>/dev/null export "$@" printf |
+sed test then grep grep printf export
+		local /usr/bin /usr/bin export && "$@" printf grep "$@" -eu $(pwd)
+	cd readonly test "$1" --verbose
+	awk cd && ${HOME} test 'quoted text' readonly | grep awk then "$1"
+		then cd && x=1 | 'quoted text'
+-eu | "$@" echo x=1 x=1 printf export printf $(pwd) then awk then && x=1 $(pwd)
+"$@" 'quoted text' local -eu awk test printf grep --verbose
+		&& sed printf then grep | awk ${HOME} readonly $(pwd) /usr/bin "$@" then awk
+		2>/dev/null | done && done | test test test /usr/bin cd cd printf
+		--verbose test -eu | cd done echo echo cd local grep cd export sed /usr/bin
+	$(pwd) && then $(pwd) $(pwd) local
+	2>/dev/null ${HOME} --verbose
+| | then grep done | 2>/dev/null
+	local && "$1" ${HOME} ${HOME} export -eu printf "$@"
+cd readonly /usr/bin done "$1"
+sed awk grep ${HOME} local
+2>/dev/null echo export -eu | -eu ${HOME} sed test
+	cd -eu -eu test x=1 then test export 'quoted text' --verbose echo -eu
+		| then sed --verbose -eu echo /usr/bin /usr/bin
+	/usr/bin -eu readonly local "$@" done awk
+		local $(pwd) grep "$1" done 'quoted text'
+		done /usr/bin /usr/bin && && cd $(pwd) 2>/dev/null
+cd ${HOME} sed x=1 $(pwd)
+		echo then "$@" "$@" && 'quoted text' done local --verbose && test 2>/dev/null
+		2>/dev/null then cd done "$@" echo test --verbose done
+	"$1" && 2>/dev/null "$@" -eu cd | then $(pwd)
+		echo sed test $(pwd) echo $(pwd) printf
+	sed ${HOME} echo 'quoted text'
+| --verbose 2>/dev/null then readonly done
+readonly local grep cd printf $(pwd) export | echo "$@" local x=1 x=1 export printf
+		then readonly -eu done ${HOME}
+cd --verbose | -eu 2>/dev/null
+		2>/dev/null grep done $(pwd) $(pwd) | export --verbose grep done export
+		'quoted text' local readonly --verbose 'quoted text' awk $(pwd) sed readonly x=1
+echo echo x=1 local "$@" /usr/bin "$1" local /usr/bin x=1 readonly cd | 2>/dev/null
+		cd readonly echo echo $(pwd) "$@" ${HOME} cd --verbose done
+	then local --verbose cd grep
+	cd local local | && grep echo "$@" printf printf
+		awk printf cd 'quoted text'
+&& "$1" -eu cd test "$1" 2>/dev/null
+x=1 ${HOME} ${HOME} $(pwd)
+	/usr/bin awk grep sed /usr/bin ${HOME} 2>/dev/null 2>/dev/null ${HOME} ${HOME} x=1
+	test awk cd done -eu done then sed then
+| local readonly then -eu done "$1" $(pwd) -eu "$@" 'quoted text' $(pwd) $(pwd)
+	awk sed | -eu "$1" /usr/bin test local --verbose "$1" cd ${HOME}
+local grep 2>/dev/null local 2>/dev/null local awk "$1" readonly | "$1" 2>/dev/null
+local test readonly local readonly "$1" "$1" /usr/bin 2>/dev/null /usr/bin done
+	local printf | printf && -eu /usr/bin "$@" &&
+	"$@" done readonly 'quoted text'
+	${HOME} /usr/bin echo grep grep test 2>/dev/null ${HOME} cd "$@"
+		then local | "$1" done grep cd awk local then
+		cd 2>/dev/null awk local $(pwd) && /usr/bin sed
+&& cd done sed test ${HOME} -eu grep awk
+readonly && "$@" /usr/bin done "$1" | cd
+		$(pwd) export ${HOME} 'quoted text' done done --verbose
+		x=1 --verbose awk awk cd 'quoted text' | done 'quoted text'
+		sed | 2>/dev/null "$1" --verbose
+awk $(pwd) done done ${HOME} export --verbose sed /usr/bin readonly then
+		awk | 2>/dev/null $(pwd) printf ${HOME} printf printf readonly "$1" | $(pwd) sed
+		2>/dev/null "$1" --verbose then ${HOME} sed awk test done 2>/dev/null
+		then printf | cd done | local local x=1
+		&& $(pwd) 'quoted text' done | $(pwd) -eu test "$1"
+"$@" echo done && then
+	export echo /usr/bin --verbose done /usr/bin ${HOME}
+sed grep x=1 2>/dev/null printf ${HOME} --verbose
+		2>/dev/null printf "$@" $(pwd) awk readonly
+echo then then local export
+${HOME} /usr/bin sed local printf awk cd readonly readonly -eu x=1 readonly
+	"$@" sed ${HOME} -eu --verbose /usr/bin 'quoted text' export sed --verbose
+x=1 printf 2>/dev/null grep echo test --verbose done
+		"$1" printf /usr/bin x=1 awk /usr/bin export grep 2>/dev/null
+"$1" then cd "$1" "$1" test cd && export echo done
+		"$1" sed 2>/dev/null 'quoted text' printf printf
+	echo 'quoted text' done ${HOME} printf awk readonly
+		then --verbose done x=1 test $(pwd) 'quoted text'
+		/usr/bin | cd done --verbose | && cd "$@" $(pwd)
+${HOME} $(pwd) 2>/dev/null printf /usr/bin --verbose |
+		echo 'quoted text' "$1"
+	${HOME} "$@" test | -eu "$@" | sed $(pwd) | then test grep "$1" $(pwd)
+awk then -eu ${HOME} printf readonly test "$1"
+"$1" -eu x=1 grep cd 'quoted text' /usr/bin 'quoted text' --verbose sed /usr/bin
+grep | awk && "$1" "$@" x=1 2>/dev/null done
+		awk done awk 'quoted text' grep ${HOME} "$@" "$@" test $(pwd) && readonly
+	| test grep export "$@" && ${HOME}
+awk then 2>/dev/null
+	done | readonly then && sed
+		export "$1" local && --verbose printf local printf
+	&& ${HOME} 'quoted text' then cd "$@" local && "$1" && echo $(pwd) export
+echo && --verbose --verbose readonly x=1 x=1 readonly
+/usr/bin test done sed "$@" sed awk $(pwd) ${HOME}
+${HOME} export "$1" echo --verbose
+	'quoted text' cd done -eu ${HOME}
+/usr/bin "$1" awk "$1" /usr/bin
+echo --verbose local && grep
+		| $(pwd) cd export echo test export printf -eu local export
+	| then | 2>/dev/null -eu -eu "$1" | sed "$@" printf x=1
+local awk local && echo local awk then $(pwd) | grep sed grep "$@" then
+		$(pwd) "$@" && -eu "$1" | -eu echo cd && echo echo && then printf
+		test local "$1" $(pwd) -eu x=1 /usr/bin
+	local && 'quoted text' | sed --verbose && $(pwd) 2>/dev/null
+	awk grep cd readonly ${HOME} sed export done test grep readonly x=1 --verbose "$1"
+		then x=1 test echo /usr/bin echo then ${HOME}
+		&& test x=1 'quoted text' cd readonly 2>/dev/null && cd export -eu "$@" echo 2>/dev/null
+		--verbose /usr/bin sed "$@" "$1" export ${HOME} "$@" then local -eu awk export
+	test /usr/bin local then sed x=1 printf -eu
+		"$1" x=1 then -eu readonly local
+	printf readonly sed grep echo export cd cd ${HOME} then 2>/dev/null ${HOME}
+		done done 'quoted text' done done then
+	"$1" "$1" $(pwd) --verbose --verbose --verbose test ${HOME}
+sed grep /usr/bin readonly done
+		done $(pwd) awk then cd ${HOME} cd | x=1 test 2>/dev/null
+		-eu sed printf then then "$1" done | $(pwd) cd awk "$1" "$1" sed readonly
+	| test readonly echo ${HOME} /usr/bin echo "$@" cd readonly
+	${HOME} test sed --verbose test then "$@" printf printf
+${HOME} "$@" sed printf ${HOME} -eu export /usr/bin 'quoted text' "$@" readonly
+local readonly done 'quoted text'
+then sed "$@" local --verbose --verbose
+'quoted text' printf export "$@" /usr/bin 2>/dev/null
+		"$@" --verbose then ${HOME} awk --verbose 'quoted text' 'quoted text' sed
+	"$1" sed test printf export grep 'quoted text'
+x=1 export echo -eu | done sed local export awk && -eu done 2>/dev/null done
+local "$@" 'quoted text' /usr/bin then cd -eu
+	echo done $(pwd) awk x=1 'quoted text'
+	/usr/bin /usr/bin | local "$@" "$1" "$1" "$@" export then local x=1 grep done
+	| local $(pwd) 'quoted text' --verbose
+	$(pwd) awk export ${HOME} export grep export then printf
+	local && awk --verbose --verbose --verbose readonly x=1 echo
+awk export /usr/bin echo "$@" cd then
+		| local echo cd "$1" && cd 2>/dev/null
+	awk cd 'quoted text' 'quoted text'
+		"$@" -eu $(pwd) "$1" 'quoted text' | /usr/bin $(pwd)
+		"$@" awk ${HOME} "$@" -eu 2>/dev/null test "$1" grep cd then readonly
+		cd cd readonly sed grep -eu | export sed 2>/dev/null
+awk && | local "$1" $(pwd) /usr/bin
+&& then /usr/bin echo cd awk export /usr/bin grep ${HOME} && "$1" 'quoted text'
+		grep "$@" export export awk grep ${HOME} "$1" local "$1" "$1"
+| /usr/bin /usr/bin local && -eu "$@"
+		"$1" -eu local grep --verbose && | local "$1" sed
+'quoted text' "$1" | 'quoted text' 2>/dev/null
+	"$@" | local readonly then echo done then cd && "$1" awk local
+readonly | --verbose cd awk done -eu test local echo echo
+		sed echo x=1 x=1 awk export ${HOME} /usr/bin export /usr/bin
+		| 'quoted text' -eu test 'quoted text' sed printf echo grep then echo done readonly
+grep grep /usr/bin cd "$1" local |
+--verbose then echo printf 'quoted text' local --verbose export
+2>/dev/null /usr/bin "$1" x=1
+	x=1 local then "$1" 'quoted text' /usr/bin
+'quoted text' readonly
+	sed /usr/bin -eu done 'quoted text' ${HOME} 2>/dev/null
+cd export 2>/dev/null /usr/bin ${HOME} done then done readonly ${HOME}
+| "$1" export /usr/bin "$@" x=1 -eu "$1" printf echo $(pwd) | "$1" readonly
+		&& sed && grep /usr/bin /usr/bin grep readonly x=1 printf && grep
+--verbose --verbose --verbose && 'quoted text'
+		test ${HOME} /usr/bin then 'quoted text' printf "$@"
+		/usr/bin echo 2>/dev/null local -eu sed then -eu | 2>/dev/null grep | printf test
+		then 'quoted text' $(pwd) ${HOME} ${HOME} "$@" export
+		then sed local "$@" --verbose ${HOME} sed x=1 export
+		then printf "$1" echo cd then sed done
+sed -eu cd $(pwd) 2>/dev/null export done
+'quoted text' export test export sed
+		echo /usr/bin printf awk grep awk "$@" readonly /usr/bin
+test test cd 'quoted text' --verbose grep
+sed && | && echo x=1 then readonly local sed export
+"$@" $(pwd) ${HOME} awk grep && --verbose
+"$@" "$1" "$@" "$1" then ${HOME} grep test awk then export then x=1 "$1"
+/usr/bin printf test then
+		then $(pwd) && /usr/bin cd export
+--verbose /usr/bin export 2>/dev/null /usr/bin grep &&
+		&& done ${HOME} printf echo cd 'quoted text'
+	${HOME} done then grep then local "$1" ${HOME} readonly $(pwd)
+		'quoted text' export && 'quoted text' printf ${HOME} x=1 then --verbose
+		then test then -eu export $(pwd) "$@" $(pwd) && grep then done $(pwd) echo sed $(pwd)
+		"$1" --verbose && -eu x=1 then sed test test
+	export readonly "$1" export done && printf printf --verbose ${HOME}
+		awk grep grep echo readonly $(pwd) grep
+		&& $(pwd) then printf | /usr/bin export awk
+		test "$@" export then awk grep cd 'quoted text'
+'quoted text' done /usr/bin --verbose "$1"
+		grep local "$@" export done
+	${HOME} done test 2>/dev/null $(pwd) test
+grep done | awk local done ${HOME} local readonly
+		cd -eu 2>/dev/null --verbose
+	awk printf && grep "$1" 2>/dev/null
+$(pwd) "$@" /usr/bin -eu
+	| awk test done 'quoted text'
+		-eu x=1 done && | /usr/bin --verbose
+'quoted text' | export x=1 2>/dev/null ${HOME} $(pwd) sed 2>/dev/null
+$(pwd) /usr/bin readonly then x=1 $(pwd) /usr/bin readonly echo
+--verbose -eu "$1" test /usr/bin x=1 printf
+test printf then -eu grep cd awk cd readonly local 2>/dev/null
+	&& then -eu grep export --verbose
+	local $(pwd) -eu then then /usr/bin --verbose
+${HOME} $(pwd) | awk sed --verbose ${HOME} grep 'quoted text'
+	| sed done | local cd awk $(pwd) grep ${HOME} ${HOME} 'quoted text' -eu export
+	awk cd 2>/dev/null 2>/dev/null grep sed && echo then local awk
+	2>/dev/null cd 'quoted text' /usr/bin test 2>/dev/null
+		echo -eu "$1" "$@" export "$1" $(pwd) cd ${HOME} 2>/dev/null grep
+		$(pwd) printf awk x=1 && test awk "$@" cd readonly then awk
+cd $(pwd) -eu then test test test && printf 2>/dev/null
+sed | "$1" test test "$@" -eu test echo 'quoted text' -eu printf cd awk
+		test test && 'quoted text' "$1" | --verbose done x=1 "$1" cd | test /usr/bin
+		"$@" local -eu x=1 cd | 2>/dev/null -eu | "$1" --verbose awk local && 'quoted text'
+		test /usr/bin $(pwd)
+	2>/dev/null && sed | "$1" && x=1 -eu printf awk "$@"
+	x=1 2>/dev/null echo echo local "$@" grep echo | cd test | --verbose
+	"$1" x=1 && sed echo --verbose /usr/bin cd awk then readonly done
+/usr/bin 2>/dev/null x=1 /usr/bin $(pwd) -eu | sed readonly $(pwd) export
+"$@" sed cd done --verbose $(pwd) cd
+		sed && | awk echo && printf
+		echo ${HOME} x=1 && grep --verbose && 2>/dev/null /usr/bin
+export x=1 grep cd local echo 'quoted text'
+	&& "$@" && readonly echo readonly 'quoted text'
+awk --verbose $(pwd) readonly --verbose
+echo readonly 'quoted text' then cd awk "$@" $(pwd) echo && /usr/bin cd &&
+&& ${HOME} cd test x=1 | | 'quoted text'
+"$@" sed /usr/bin "$1" x=1 2>/dev/null --verbose echo test sed x=1 ${HOME} /usr/bin
+	/usr/bin grep cd test then done "$1" ${HOME}
+export awk echo readonly export echo echo awk 2>/dev/null
+		cd $(pwd) 'quoted text' "$@" "$@" -eu export printf cd done done
+	cd -eu -eu cd echo echo
+	2>/dev/null done test cd ${HOME}
+$(pwd) 2>/dev/null readonly 2>/dev/null awk | done x=1
+&& done 2>/dev/null | /usr/bin $(pwd) readonly export done /usr/bin echo $(pwd)
+	${HOME} 'quoted text' grep -eu
+	awk then "$@" echo -eu x=1 x=1
+	readonly export done sed ${HOME} done && then
+	export printf grep $(pwd) then local sed --verbose
+sed grep 2>/dev/null readonly test
+		cd readonly 2>/dev/null
+		export | echo awk grep x=1 2>/dev/null ${HOME}
+'quoted text' 2>/dev/null x=1
+"$@" then cd /usr/bin "$@"
+cd awk sed done readonly sed $(pwd) x=1 awk
+		export done test x=1 'quoted text' && local | x=1 $(pwd) "$1" export echo
+		echo --verbose --verbose done
+echo awk awk /usr/bin "$@" test -eu && "$@" then export
+-eu grep "$@" export ${HOME}
+		$(pwd) 'quoted text' awk && 'quoted text'
+	then x=1 'quoted text' --verbose | done printf test "$1" -eu $(pwd)
+	echo grep readonly /usr/bin cd $(pwd) |
+		readonly sed test then export 2>/dev/null awk 'quoted text' test "$@" 'quoted text'
+awk printf cd | cd then | && awk && printf "$1" "$1"
+		export export test ${HOME} then export && -eu 'quoted text' done 'quoted text'
+		x=1 "$@" sed cd 'quoted text' ${HOME}
+	grep "$@" | ${HOME} export
+then "$1" 2>/dev/null done then done readonly
+		sed /usr/bin /usr/bin /usr/bin grep
+		--verbose export sed x=1 /usr/bin 2>/dev/null
+done ${HOME} /usr/bin awk test /usr/bin /usr/bin
+--verbose 'quoted text' readonly x=1
+		--verbose test sed echo test sed --verbose
+	cd --verbose /usr/bin sed x=1 -eu "$1" x=1
+test "$1" /usr/bin done done 2>/dev/null test done && "$@" --verbose
+	&& 'quoted text' ${HOME} 'quoted text' "$1" ${HOME}
+	/usr/bin readonly local 'quoted text' echo sed cd
+export printf -eu 'quoted text' awk awk x=1 awk grep
+test test local local awk $(pwd) 'quoted text' "$1" then x=1 local
+	sed done $(pwd) "$@" | $(pwd) x=1 export local grep grep done local --verbose $(pwd)
+cd ${HOME} /usr/bin grep cd awk "$@" 2>/dev/null --verbose 2>/dev/null
+	"$1" then local printf | "$1" local awk 2>/dev/null
+$(pwd) 'quoted text' then $(pwd)
+	${HOME} readonly $(pwd) cd --verbose local awk awk --verbose then ${HOME}
+		&& -eu && -eu export
+${HOME} echo then --verbose sed --verbose sed awk then export readonly
+	then printf grep sed 2>/dev/null
+		${HOME} --verbose then awk readonly test export |
+	local grep echo /usr/bin --verbose && 'quoted text'
+		&& 'quoted text' export ${HOME} ${HOME} /usr/bin /usr/bin
+		"$1" readonly ${HOME} echo sed
+grep ${HOME} awk --verbose readonly sed
+	'quoted text' local local 2>/dev/null --verbose sed test 2>/dev/null
+	printf done grep $(pwd) printf done test 'quoted text' ${HOME} && "$1" cd
+export "$1" grep | | grep 'quoted text' && then
+${HOME} $(pwd) | ${HOME} --verbose test test /usr/bin | "$@" cd
+"$@" ${HOME} 'quoted text' x=1 awk /usr/bin $(pwd) cd echo done
+		&& $(pwd) | readonly local 2>/dev/null /usr/bin -eu grep cd | local -eu then
+	| then readonly ${HOME} test printf 2>/dev/null
+	'quoted text' x=1 cd "$1" /usr/bin -eu
+		cd done 'quoted text' $(pwd)
+		echo | 'quoted text' local 2>/dev/null
+	done readonly $(pwd) && "$@" local export echo echo && echo
+/usr/bin "$@" "$@" local done
+'quoted text' readonly printf ${HOME} cd test /usr/bin x=1 done
+test done ${HOME} printf cd export readonly
+		sed 2>/dev/null sed test -eu && done
+		then sed readonly /usr/bin readonly ${HOME} printf
+sed grep 2>/dev/null export --verbose "$@" "$@" -eu && cd cd
+	"$@" | /usr/bin awk $(pwd) local 2>/dev/null test && --verbose cd "$@" 'quoted text'
+cd printf printf --verbose sed grep 'quoted text' sed ${HOME} "$1" sed
+| x=1 "$@" 'quoted text' printf ${HOME} readonly done local awk readonly "$@"
+	grep "$1" ${HOME} sed export
+		cd printf echo $(pwd) x=1 'quoted text'
+	2>/dev/null $(pwd) | cd x=1 -eu
+then "$1" 2>/dev/null export x=1 export && /usr/bin then "$1" -eu
+-eu "$@" test "$@" --verbose export
+	x=1 readonly 'quoted text'
+	2>/dev/null && --verbose "$@" ${HOME} "$@" "$1" ${HOME} | echo
+readonly /usr/bin cd done grep -eu done export done
+		${HOME} 2>/dev/null ${HOME} -eu x=1 ${HOME} test awk "$@"
+		&& -eu local test ${HOME} "$@" local 'quoted text' --verbose
+	$(pwd) $(pwd) -eu echo --verbose grep readonly ${HOME} | cd done awk
+	x=1 sed -eu then sed | "$1" /usr/bin
+	&& x=1 echo | echo --verbose
+		done | done export 2>/dev/null x=1 sed 2>/dev/null
+	sed $(pwd) echo "$1" "$@" export $(pwd) | 'quoted text' test cd cd
+		--verbose readonly awk
+		echo readonly readonly | "$1" "$1" "$@" $(pwd) grep x=1 $(pwd) done
+	$(pwd) "$1" cd grep echo x=1 cd then grep cd && 2>/dev/null readonly awk readonly
+sed ${HOME} done awk /usr/bin
+		echo grep "$@" x=1 grep awk done && "$1" sed test "$@"
+	awk printf "$1" readonly printf -eu cd printf x=1 awk --verbose local then
+${HOME} printf ${HOME} test -eu -eu export echo
+sed readonly | && echo
+sed "$@" -eu x=1 $(pwd) local local then ${HOME}
+readonly local local x=1 export && --verbose echo ${HOME} x=1 "$1" readonly
+"$1" ${HOME} awk echo test grep readonly
+	grep awk sed 'quoted text' --verbose "$1" test
+	sed echo $(pwd) echo --verbose | && && sed awk $(pwd)
+"$@" | -eu | x=1 --verbose "$1" done
+	| awk -eu sed done done x=1 cd -eu | cd --verbose local
+	2>/dev/null test awk printf ${HOME} test --verbose then export awk "$1" --verbose
+		'quoted text' "$1" 'quoted text' && readonly
+		test | x=1 export | "$1" printf --verbose readonly export 2>/dev/null /usr/bin
+	then $(pwd) "$@" export export local "$@" ${HOME} ${HOME} local | awk --verbose
+$(pwd) then --verbose test x=1 echo "$1" export |
+$(pwd) 'quoted text' readonly "$@" ${HOME} 2>/dev/null
+	echo printf "$1" test ${HOME} "$1" test then sed done done 2>/dev/null
+	awk echo ${HOME} test && export
+cd -eu sed --verbose awk echo -eu done /usr/bin -eu
+		printf grep | 2>/dev/null --verbose then $(pwd) /usr/bin x=1 done /usr/bin cd
+	readonly readonly local
+export cd "$1" printf "$1" test local 'quoted text' 'quoted text' 'quoted text'
+		${HOME} export cd 'quoted text'
+		printf --verbose -eu export cd --verbose /usr/bin cd export cd
+	local -eu printf "$@" then local readonly ${HOME} local 2>/dev/null | 2>/dev/null
+		awk awk echo --verbose cd -eu
+	2>/dev/null && --verbose -eu "$1" cd readonly /usr/bin --verbose awk "$@"
+		local export awk cd awk 2>/dev/null
+${HOME} test -eu awk | local |
+		/usr/bin /usr/bin test local && then sed && ${HOME} export
+--verbose done printf
+x=1 -eu "$@" cd awk && awk
+	export "$@" /usr/bin grep /usr/bin local 'quoted text' done $(pwd)
+		${HOME} && readonly $(pwd) "$@" done -eu
+		| && x=1 2>/dev/null readonly awk | 2>/dev/null
+		| "$1" | x=1 | ${HOME} x=1 export 'quoted text' | /usr/bin
+	grep export 'quoted text' | 'quoted text' 2>/dev/null cd "$1"
+	2>/dev/null cd 2>/dev/null readonly export cd done /usr/bin readonly test
+		test export && && "$1" test ${HOME} $(pwd) then test
+echo $(pwd) grep x=1 'quoted text' x=1 test readonly export local echo 'quoted text'
+		${HOME} printf ${HOME} ${HOME} $(pwd) cd x=1 then 'quoted text' readonly $(pwd)
+		/usr/bin /usr/bin local | x=1 grep test then
+'quoted text' export | cd -eu local local
+"$1" -eu then readonly cd ${HOME} /usr/bin grep echo export | test --verbose
+then grep /usr/bin cd "$@" "$@" $(pwd)
+"$1" cd awk x=1 | | awk "$@" ${HOME}
+	${HOME} readonly awk $(pwd) readonly --verbose && done && -eu x=1
+export sed -eu x=1 x=1 grep test | "$1" echo then
+	--verbose done | sed local 'quoted text' 2>/dev/null export
+	awk /usr/bin x=1 'quoted text' sed /usr/bin printf 2>/dev/null -eu done
+then ${HOME} ${HOME} ${HOME}
+	local echo cd echo test 'quoted text' /usr/bin done
+		-eu test $(pwd) && -eu test x=1 -eu done --verbose
+&& --verbose "$1" test test local cd sed test readonly ${HOME} && sed $(pwd)
+	sed awk grep 2>/dev/null --verbose then grep
+		then /usr/bin --verbose x=1 /usr/bin export awk local
+		printf awk sed 2>/dev/null export readonly 2>/dev/null
+	printf --verbose "$1" | "$1" -eu export grep -eu /usr/bin --verbose
+	awk echo && "$@" "$@" test
+		local printf printf then local cd then "$@" /usr/bin
+	x=1 "$1" sed | awk test export "$1" $(pwd) 'quoted text'
+		&& awk $(pwd) --verbose "$1" 2>/dev/null /usr/bin $(pwd) /usr/bin
+	"$@" printf --verbose then 2>/dev/null
+	--verbose cd 2>/dev/null then readonly then test
+'quoted text' cd grep "$@" grep "$1" 2>/dev/null && printf
+grep "$1" -eu cd && --verbose
+&& -eu "$1" cd printf cd "$@" -eu echo
+&& printf local cd && x=1 grep --verbose /usr/bin
+| cd sed /usr/bin /usr/bin grep ${HOME} -eu $(pwd)
+$(pwd) export 2>/dev/null test printf && export sed x=1 'quoted text' cd
+readonly cd /usr/bin cd
+	"$@" 'quoted text' then cd ${HOME} then 2>/dev/null echo grep 2>/dev/null printf
+	sed then sed 2>/dev/null awk awk "$1" --verbose --verbose | $(pwd) local "$@" "$@"
+	local readonly sed cd cd readonly local printf
+"$1" grep x=1 | cd then sed sed done --verbose test
+	'quoted text' local 2>/dev/null cd && "$@" cd local then export local then 'quoted text'
+	printf $(pwd) 2>/dev/null awk printf echo grep local "$@" printf echo grep
+grep -eu done 2>/dev/null sed "$1" $(pwd)
+	-eu local x=1 cd "$1" && readonly grep
+		$(pwd) cd local awk grep cd "$@" readonly ${HOME}
+	x=1 ${HOME} export /usr/bin
+	${HOME} awk x=1 && readonly
+echo --verbose export local done printf awk cd && 2>/dev/null awk
+		done export printf done export readonly 2>/dev/null
+	grep $(pwd) x=1 2>/dev/null "$@" awk echo cd test && done printf 2>/dev/null
+readonly test sed --verbose $(pwd) ${HOME} export /usr/bin then "$@"
+	| $(pwd) printf cd |
+$(pwd) local sed grep done done grep done --verbose
+test sed "$@" -eu echo && x=1 -eu done -eu x=1 /usr/bin
+		x=1 --verbose | -eu /usr/bin readonly 2>/dev/null
+&& local 'quoted text' &&
+awk 2>/dev/null cd export grep then
+	grep && cd "$1" | --verbose test test
+		x=1 x=1 export local --verbose ${HOME} export readonly
+	readonly export cd ${HOME} ${HOME} --verbose
+	-eu && && sed $(pwd) x=1 awk x=1 awk export | x=1 local local x=1 'quoted text'
+$(pwd) test grep ${HOME} && sed --verbose $(pwd) then awk "$@" local --verbose
+	readonly export awk readonly 2>/dev/null
+		'quoted text' printf then -eu local
+		local awk /usr/bin then sed local 'quoted text' "$@" "$@" | readonly "$@"
+		${HOME} && readonly | echo 2>/dev/null printf "$1" sed && done -eu printf "$@"
+	export /usr/bin 'quoted text' export -eu -eu
+		sed 'quoted text' x=1 'quoted text' echo export $(pwd) awk
+export test done 2>/dev/null awk /usr/bin cd printf 2>/dev/null
+		x=1 2>/dev/null /usr/bin then done 2>/dev/null
+	export echo $(pwd) 2>/dev/null awk
+	$(pwd) cd readonly readonly 2>/dev/null done && local && $(pwd) then echo 'quoted text'
+"$@" "$1" "$@" "$1" /usr/bin done --verbose
+	$(pwd) test readonly then
+		&& -eu --verbose export local done readonly local
+	export done | 2>/dev/null
+	2>/dev/null then -eu echo
+	x=1 "$@" $(pwd) 'quoted text' --verbose grep local echo x=1 export x=1 grep
+	grep -eu $(pwd) printf "$1" test 'quoted text' local sed x=1 echo | echo
+		$(pwd) ${HOME} ${HOME} | grep /usr/bin readonly local echo
+	export awk awk && grep 2>/dev/null 'quoted text'
+		"$1" | cd grep "$@" $(pwd) test "$1" readonly 2>/dev/null cd export done local
+"$1" local $(pwd) x=1 --verbose echo then --verbose readonly local sed "$@"
+		| "$@" 'quoted text' 2>/dev/null
+test | sed $(pwd) done awk echo && cd --verbose --verbose
+		readonly -eu "$@" 'quoted text' printf export test
+		then -eu ${HOME} grep x=1 printf export test x=1
+		export 2>/dev/null cd local ${HOME} test export local test export
+awk done export printf awk ${HOME} ${HOME} done grep done x=1 test
+		local sed grep printf then ${HOME} awk
+	"$1" test && $(pwd) awk "$@" echo /usr/bin
+		"$@" done local /usr/bin
+then 2>/dev/null printf /usr/bin --verbose done readonly
+"$1" | awk && echo --verbose readonly && echo --verbose test "$1" 'quoted text'
+	then "$@" --verbose grep 'quoted text' cd --verbose awk grep 'quoted text'
+		-eu 2>/dev/null echo 'quoted text' local -eu done
+| sed test export grep
+	"$1" ${HOME} -eu readonly --verbose --verbose "$1" test
+		--verbose 2>/dev/null sed
+	awk awk awk local && printf test done "$@" sed cd printf readonly
+		"$1" grep then ${HOME} "$@" ${HOME}
+	/usr/bin printf printf then -eu then
+	sed && /usr/bin local grep
+		&& awk export printf $(pwd) then "$1" awk readonly test export ${HOME}
+	"$1" readonly "$1" export
+	sed ${HOME} then x=1 cd "$@" done $(pwd) test
+		awk done done cd test x=1 x=1 export cd cd | awk printf /usr/bin cd printf /usr/bin
+sed test export echo --verbose done test x=1 done ${HOME} local done
+		/usr/bin sed --verbose ${HOME}
+&& printf readonly | -eu awk printf awk /usr/bin 'quoted text'
+		&& done done -eu | /usr/bin $(pwd) 2>/dev/null local
+&& /usr/bin cd grep x=1 cd "$@" 'quoted text' /usr/bin done sed export
+	grep --verbose x=1 test test readonly
+	"$@" ${HOME} -eu 2>/dev/null done 2>/dev/null then local /usr/bin 2>/dev/null
+	x=1 printf $(pwd) "$@" local ${HOME} x=1 | 2>/dev/null done
+readonly sed test then $(pwd) then
+	2>/dev/null "$1" -eu echo export grep then export
+cd $(pwd) /usr/bin x=1 ${HOME} printf readonly readonly cd cd awk local
+sed 2>/dev/null printf export 2>/dev/null
+| awk "$@" "$1" 'quoted text' --verbose $(pwd) ${HOME}
+		x=1 | local /usr/bin --verbose
+		"$@" awk awk "$1" $(pwd) x=1 echo /usr/bin | 2>/dev/null
+then "$1" | then /usr/bin "$@"
+		&& grep done -eu grep 2>/dev/null --verbose &&
+-eu cd awk then "$1" test printf "$1" cd test grep | x=1 /usr/bin --verbose
+$(pwd) ${HOME} export test 'quoted text' local then
+		&& $(pwd) ${HOME} ${HOME} readonly --verbose printf "$@" x=1 x=1 "$@"
+'quoted text' 'quoted text' | done test 'quoted text'
+		/usr/bin x=1 && x=1 --verbose awk readonly test echo 'quoted text' &&
+	2>/dev/null test $(pwd) readonly 2>/dev/null --verbose grep 2>/dev/null
+--verbose grep export 'quoted text' "$@"
+		| cd 2>/dev/null done local 2>/dev/null awk | ${HOME}
+cd -eu export && cd local | 2>/dev/null
+&& cd $(pwd) | "$@" --verbose && 'quoted text' done 'quoted text' sed
+	x=1 echo then /usr/bin /usr/bin "$@" done 'quoted text' done
+	x=1 awk "$1" --verbose && "$@" 'quoted text'
+		readonly done 'quoted text' 2>/dev/null readonly --verbose
+		&& && test readonly awk &&
+printf ${HOME} local x=1 test awk
+	'quoted text' "$1" grep $(pwd) readonly awk --verbose local
+	readonly "$@" then $(pwd) /usr/bin && /usr/bin x=1 then readonly
+echo grep "$1" | "$1" 'quoted text' printf "$1" $(pwd)
+		&& sed printf done -eu "$@" "$@" sed done cd && export cd grep local && test
+	printf /usr/bin test echo
+	x=1 then printf test /usr/bin -eu --verbose "$@" | --verbose sed "$1" --verbose
+	"$1" then -eu 'quoted text' 2>/dev/null | done --verbose
+		printf "$@" printf readonly "$@" local $(pwd) -eu sed echo 'quoted text'
+/usr/bin --verbose cd x=1 --verbose x=1 "$1" done "$@" readonly
+'quoted text' && "$@" | 2>/dev/null "$@" "$1" --verbose
+readonly then --verbose
+echo 2>/dev/null cd local printf printf $(pwd)
+readonly test export 'quoted text' export then then readonly done x=1
+awk grep "$1" readonly ${HOME}
+		'quoted text' "$1" test test x=1 test test /usr/bin "$1" -eu printf
+	cd awk awk sed | | ${HOME} 'quoted text' x=1 readonly
+		${HOME} printf 'quoted text' 'quoted text' then readonly export sed readonly awk
+2>/dev/null | readonly sed 'quoted text' && | && 2>/dev/null cd -eu done
+		done printf "$1" -eu sed grep readonly /usr/bin grep 2>/dev/null
+	x=1 local 2>/dev/null grep export test test 2>/dev/null
+x=1 && && local -eu /usr/bin | local
+		&& /usr/bin | 'quoted text' then 'quoted text' -eu "$@" sed echo
+--verbose then echo /usr/bin then sed readonly $(pwd) printf
+"$@" export && /usr/bin printf grep sed 2>/dev/null local 2>/dev/null then readonly
+	2>/dev/null grep grep grep export then local "$1" $(pwd) "$@" $(pwd)
+export "$1" printf then echo local awk /usr/bin echo 'quoted text'
+		x=1 sed "$@" printf grep $(pwd)
+	test then "$@" grep | --verbose "$1" $(pwd) /usr/bin local done cd cd echo
+		export cd done x=1 $(pwd) sed test echo "$@" export grep then 'quoted text'
+	printf 2>/dev/null ${HOME} "$1" printf readonly -eu
+	${HOME} 2>/dev/null -eu cd "$@" local export local grep -eu readonly |
+	export done 'quoted text' "$1" "$1" 2>/dev/null sed x=1 then -eu $(pwd) export
+		local sed readonly then sed export awk awk /usr/bin awk sed
+	readonly x=1 test export local "$1" $(pwd) done awk export
+-eu cd test then 2>/dev/null "$1"
+	readonly --verbose test test
+		x=1 "$1" echo 'quoted text' /usr/bin $(pwd) -eu
+	done export 'quoted text' sed 'quoted text'
+	local /usr/bin local then awk --verbose then $(pwd) readonly "$1"
+test sed local echo sed -eu local test /usr/bin --verbose
+--verbose readonly cd 'quoted text' test
+"$1" 2>/dev/null test && printf /usr/bin then sed local awk "$1"
+"$1" "$@" ${HOME} test --verbose -eu x=1 readonly
+-eu then ${HOME} printf /usr/bin local | 2>/dev/null
+		&& 'quoted text' printf 'quoted text' /usr/bin
+readonly "$@" local echo
+	echo sed x=1 "$1" "$@" x=1 awk
+	local readonly grep $(pwd) "$1" grep test export
+cd echo done "$@" | "$1" x=1 'quoted text'
+	sed readonly export 2>/dev/null done test x=1 done readonly export "$1" grep sed
+		grep | done $(pwd) printf readonly awk then && grep ${HOME} && "$1" grep
+2>/dev/null cd sed echo grep 2>/dev/null grep printf grep -eu | readonly printf
+"$@" printf /usr/bin -eu grep
+	--verbose && sed done sed | cd /usr/bin
+awk local | x=1 readonly test
+		${HOME} then printf grep
+test export /usr/bin local
+		2>/dev/null | readonly && && grep &&
+$(pwd) export /usr/bin readonly $(pwd) 'quoted text' printf
+	/usr/bin then export then test
+		"$@" readonly 2>/dev/null 2>/dev/null "$1" test 'quoted text' /usr/bin
+	'quoted text' && sed "$@" test "$1" "$1" test readonly -eu && then
+	export 'quoted text' test &&
+	"$1" /usr/bin sed ${HOME} grep echo then
+	printf $(pwd) x=1 then "$1" grep cd readonly
+"$@" then cd --verbose cd cd 2>/dev/null "$@" grep local test -eu awk ${HOME} --verbose
+		'quoted text' $(pwd) 'quoted text' && 'quoted text' 2>/dev/null $(pwd) awk
+	$(pwd) --verbose local x=1 sed
+	export $(pwd) "$1" grep then
+export export "$1" 2>/dev/null
+x=1 awk x=1 "$@" | sed local sed -eu 'quoted text' awk grep "$@" then "$@"
+		export "$1" "$@" -eu cd local && awk done
+		done sed then done "$1" 2>/dev/null 2>/dev/null awk then
+	'quoted text' printf export cd then then sed 2>/dev/null | -eu "$1" "$1"
+		--verbose "$@" --verbose printf
+		done cd && $(pwd) --verbose --verbose awk 'quoted text' then --verbose
+		sed awk awk awk /usr/bin 'quoted text' sed test echo awk test 2>/dev/null test
+	test x=1 'quoted text' $(pwd) cd cd 2>/dev/null
+	awk printf /usr/bin readonly
+		| "$@" --verbose /usr/bin done awk sed
+	readonly 'quoted text' test done -eu
+	"$@" ${HOME} "$@" $(pwd) 'quoted text' local cd --verbose sed done then
+	$(pwd) --verbose x=1 $(pwd) readonly printf readonly "$@"
+	/usr/bin awk -eu export x=1 /usr/bin | printf 2>/dev/null ${HOME} done -eu
+		grep test "$@" export then /usr/bin
+readonly awk printf x=1 done $(pwd) "$1" -eu && test 2>/dev/null $(pwd) test
+	done grep test "$1" then
+	test printf then grep $(pwd) ${HOME} awk && /usr/bin
+sed $(pwd) readonly readonly echo "$1" $(pwd) test local 2>/dev/null awk
+--verbose then 'quoted text' 2>/dev/null export local grep | test
+		done /usr/bin "$@" 2>/dev/null readonly echo
+	/usr/bin done "$@" 2>/dev/null
+grep -eu test 2>/dev/null "$1" ${HOME} cd done echo "$@" $(pwd) export -eu
+awk $(pwd) test | local && then
+${HOME} "$1" then done -eu -eu ${HOME} readonly local
+${HOME} ${HOME} x=1 -eu then sed "$1" && grep "$@" $(pwd)
+"$@" done cd cd local echo | | x=1 local ${HOME}
+/usr/bin x=1 sed export readonly done
+	test readonly -eu ${HOME} "$@" awk x=1 printf x=1 echo && test sed 2>/dev/null
+		echo export sed /usr/bin awk --verbose printf
+		x=1 awk 'quoted text' ${HOME} -eu readonly
+		"$@" export cd awk x=1 cd x=1 'quoted text' then grep /usr/bin
+		${HOME} printf 'quoted text' 2>/dev/null cd --verbose
+&& awk && readonly --verbose
+readonly printf echo done grep 'quoted text' sed --verbose grep
+| grep export x=1 2>/dev/null -eu -eu 2>/dev/null export && done /usr/bin $(pwd)
+		${HOME} x=1 2>/dev/null --verbose -eu ${HOME} echo cd "$1"
+		test test readonly export "$@" test ${HOME} 'quoted text' && "$1"
+		printf then && echo export cd
+printf then 'quoted text' --verbose 2>/dev/null printf && && x=1 echo x=1 --verbose
+	awk -eu ${HOME} 'quoted text' x=1 then ${HOME} cd then 'quoted text'
+	'quoted text' "$@" done -eu && sed 2>/dev/null "$@"
+		test 'quoted text' echo grep
+		/usr/bin -eu export cd --verbose
+		'quoted text' grep readonly readonly
+	'quoted text' && cd printf cd done --verbose x=1
+"$1" 'quoted text' && -eu test grep test 'quoted text' then local
+		readonly cd -eu printf then awk x=1 export echo -eu export x=1 printf echo
+export echo 2>/dev/null 'quoted text'
+		export | x=1 export $(pwd) awk $(pwd) && 'quoted text' local --verbose
+		grep "$@" test | "$1" test then echo | then $(pwd) 'quoted text' printf printf
+	2>/dev/null --verbose then "$1" readonly awk 2>/dev/null grep sed "$@"
+awk cd sed -eu printf "$@" echo then "$1" printf
+	${HOME} export "$@" cd awk x=1 export ${HOME} done test && "$1" awk $(pwd) ${HOME}
+| -eu "$@" export export $(pwd) "$@" echo 2>/dev/null -eu | 'quoted text'
+	sed echo test "$@" $(pwd) 2>/dev/null
+	echo export && /usr/bin "$1" && local cd printf
+	readonly then | x=1 awk sed readonly printf sed ${HOME} | local
+		| echo --verbose | "$@" -eu cd cd 2>/dev/null
+	/usr/bin x=1 then awk
+		/usr/bin -eu "$@" readonly echo | $(pwd) "$@"
+grep "$1" done printf 'quoted text' local test | &&
+		'quoted text' sed x=1 /usr/bin sed /usr/bin readonly grep awk then x=1
+	printf "$@" "$1" local "$@" --verbose then | "$@" /usr/bin awk /usr/bin sed export
+${HOME} test then grep readonly "$@" cd && grep awk readonly
+sed "$@" export sed then "$@" printf "$1"
+		done printf "$1" 'quoted text' 'quoted text' && x=1
+	readonly | export sed awk then | local x=1 -eu 2>/dev/null
+		local echo echo -eu then && ${HOME} echo 'quoted text' ${HOME}
+| test x=1 export sed
+/usr/bin "$@" "$@" readonly 'quoted text'
+	grep "$1" "$@" readonly test "$@" done 'quoted text' "$1" "$1" echo sed
+		printf 'quoted text' export -eu -eu --verbose
+		echo -eu done grep then export local "$1" --verbose /usr/bin awk
+	$(pwd) ${HOME} done awk 2>/dev/null export "$1" grep 2>/dev/null local grep
+/usr/bin 'quoted text' echo readonly done then &&
+		${HOME} sed printf 2>/dev/null sed grep --verbose
+		2>/dev/null sed 2>/dev/null 'quoted text'
+	cd sed done echo cd -eu local grep cd $(pwd) ${HOME} x=1 &&
+	'quoted text' 'quoted text' "$1" -eu $(pwd) export $(pwd) local
+	2>/dev/null /usr/bin export
+sed x=1 test readonly export export export | readonly export printf
+	2>/dev/null test awk | export printf && && readonly && 'quoted text' export 2>/dev/null
+	local cd x=1 local echo
+		2>/dev/null done "$@" echo done sed echo 'quoted text' "$1" export local | grep
+		$(pwd) 2>/dev/null && export then && | awk x=1 "$1" printf export
+		--verbose 'quoted text' "$@"
+	/usr/bin readonly "$@" $(pwd) echo $(pwd) echo local echo --verbose
+		printf test readonly x=1 local ${HOME}
+	"$@" cd "$1" && 2>/dev/null test ${HOME}
+cd ${HOME} readonly 2>/dev/null printf && readonly
+	test printf then x=1 grep /usr/bin /usr/bin grep grep sed --verbose echo done
+	local test -eu | 'quoted text' --verbose awk --verbose
+		'quoted text' && ${HOME} && /usr/bin cd "$@" && --verbose
+"$1" | export then $(pwd) then 'quoted text' -eu
+	test sed then x=1 --verbose
+grep then ${HOME} && awk done /usr/bin "$1" /usr/bin
+		done "$@" local readonly export then "$1" echo --verbose export printf then
+		| then then ${HOME} | awk $(pwd) 2>/dev/null
+		sed "$1" "$@" awk sed awk x=1 "$1" | grep sed /usr/bin x=1
+/usr/bin "$1" test echo then printf x=1 sed
+echo grep x=1 "$@" local
+	then /usr/bin echo sed | ${HOME} printf $(pwd) awk cd test sed && 2>/dev/null
+	done done export x=1 $(pwd) /usr/bin test "$1" "$1" test printf awk readonly 'quoted text'
+--verbose "$1" "$@" $(pwd) --verbose "$@"
+	"$1" /usr/bin cd "$1" echo -eu local /usr/bin awk "$1" cd sed export
+printf "$1" export -eu printf test awk x=1 then readonly "$@" /usr/bin /usr/bin
+		sed "$1" 'quoted text' sed echo readonly
+		cd -eu ${HOME} export test echo awk "$1" printf -eu -eu 2>/dev/null ${HOME}
+export | -eu local 2>/dev/null 2>/dev/null "$1" done export && echo readonly
+		done readonly done | | -eu | test /usr/bin /usr/bin awk 'quoted text'
+		local then "$@" "$@" && ${HOME} && "$1" 2>/dev/null
+printf awk x=1 | awk 'quoted text' /usr/bin
+"$1" | 2>/dev/null test cd /usr/bin x=1
+	echo --verbose test readonly echo x=1
+sed --verbose 'quoted text' sed local "$1" ${HOME} --verbose grep --verbose
+readonly local awk -eu grep grep && test
+		'quoted text' 2>/dev/null ${HOME} -eu
+	sed export && && | awk 'quoted text' grep
+/usr/bin cd echo done --verbose cd done then
+		test $(pwd) "$1" cd "$1" done /usr/bin readonly 2>/dev/null
+		${HOME} -eu $(pwd) -eu "$@" | then x=1 local && then x=1 printf 'quoted text'
+		awk "$1" -eu awk 2>/dev/null x=1 "$1"
+	grep $(pwd) ${HOME} echo 2>/dev/null readonly
+	${HOME} --verbose 'quoted text' "$1" | export
+		local "$1" 'quoted text' && done ${HOME} export
+	grep printf "$@" "$@" test readonly echo then | done -eu local "$@"
+		$(pwd) then $(pwd) ${HOME} test
+	awk echo then "$@" ${HOME} sed cd echo awk readonly printf 2>/dev/null ${HOME}
+	then /usr/bin && -eu 'quoted text' | "$1" x=1 cd 'quoted text' readonly
+	awk --verbose grep -eu export awk done echo awk export export grep
+	local "$1" | awk done then awk
+local sed ${HOME} then printf cd cd x=1 echo && --verbose
+		grep "$1" awk printf test printf 2>/dev/null ${HOME} done -eu x=1 readonly
+export -eu readonly ${HOME} x=1
+	&& "$1" cd ${HOME} "$@" 'quoted text' then cd $(pwd) echo
+	sed 'quoted text' -eu "$@" -eu x=1 grep awk -eu local -eu "$@"
+		/usr/bin grep local | test x=1 | x=1 grep export -eu local "$1" awk 'quoted text'
+grep ${HOME} local -eu && sed -eu ${HOME}
+		"$1" | "$1" 2>/dev/null
+	/usr/bin readonly "$1" "$1" /usr/bin readonly $(pwd) ${HOME} | echo sed export
+echo echo ${HOME} echo then && 'quoted text' printf --verbose
+	$(pwd) grep --verbose && test awk x=1 test local sed /usr/bin sed export
+readonly && && ${HOME} "$@" awk then x=1 ${HOME}
+"$1" /usr/bin x=1 grep grep
+		x=1 /usr/bin local 'quoted text' readonly ${HOME} grep && | test && export
+		"$@" local -eu awk 2>/dev/null $(pwd)
+test readonly "$1" 2>/dev/null && 'quoted text' local local x=1 /usr/bin cd
+awk $(pwd) awk ${HOME} awk test readonly
+		export grep test test "$@" sed 'quoted text' grep
+	echo cd --verbose -eu x=1 sed echo then ${HOME} sed $(pwd)
+	'quoted text' then --verbose
+		$(pwd) "$1" 'quoted text' awk then grep "$@" then local x=1 $(pwd) | 'quoted text'
+	then $(pwd) 2>/dev/null awk then --verbose cd echo && cd local
+		sed readonly export done 'quoted text' test printf
+	-eu export 'quoted text' test /usr/bin x=1 &&
+grep cd grep && cd 'quoted text'
+		cd -eu cd done grep | then awk printf -eu awk x=1 test --verbose
+printf export grep echo && 'quoted text' grep cd sed
+		/usr/bin echo /usr/bin readonly | /usr/bin export sed "$@" readonly sed
+	then then "$@" x=1 'quoted text' awk && export echo awk
+export then "$1" then "$@" $(pwd) export x=1 done "$@" done
+	sed 2>/dev/null then echo
+local | printf printf local export printf
+	grep 'quoted text' --verbose sed "$1" | --verbose cd cd 'quoted text' done /usr/bin
+	test "$@" 'quoted text' awk "$1" sed | 'quoted text'
+		readonly -eu cd -eu export cd
+cd export sed grep "$@" 'quoted text'
+	grep echo /usr/bin printf "$@" ${HOME} local export x=1 readonly --verbose sed
+		--verbose grep grep | && 2>/dev/null readonly "$1"
+-eu 'quoted text' then local 2>/dev/null done
+readonly "$@" "$1" cd | /usr/bin x=1 cd local -eu done 2>/dev/null
+	grep "$@" -eu -eu cd echo awk printf 2>/dev/null cd "$1" sed 2>/dev/null printf
+${HOME} cd 'quoted text' test sed
+		x=1 && sed 2>/dev/null "$@"
+	then 'quoted text' echo grep -eu printf sed grep done export
+		"$@" 'quoted text' cd $(pwd) echo ${HOME} /usr/bin /usr/bin awk $(pwd) && grep
+echo x=1 grep export x=1 && echo $(pwd) readonly 'quoted text' local
+awk then printf sed export -eu test --verbose
+	grep grep done --verbose --verbose sed test export printf readonly
+		local "$1" local readonly
+		awk export "$@" echo export && /usr/bin | then "$1" -eu then test "$@" done
+	export "$1" sed $(pwd) /usr/bin
+		x=1 sed sed /usr/bin 'quoted text' then cd
+awk "$@" 'quoted text' "$@" /usr/bin grep sed export
+		"$1" echo "$@" cd readonly
+		"$@" x=1 sed sed --verbose awk export awk
+printf local ${HOME} test done local $(pwd) cd
+		/usr/bin ${HOME} && grep && ${HOME} "$1" ${HOME} done --verbose
+	${HOME} -eu awk printf export
+		cd grep && /usr/bin | cd readonly echo echo cd | "$1" &&
+	echo printf -eu 2>/dev/null --verbose
+	awk sed /usr/bin grep --verbose -eu echo then x=1 "$1" 2>/dev/null
+	cd test echo x=1 'quoted text' -eu x=1 "$@" test "$1" echo
+	printf -eu done x=1 "$1" printf "$@"
+		&& $(pwd) -eu grep export x=1 readonly "$1" 2>/dev/null echo
+	"$@" sed "$@" x=1 echo grep grep --verbose --verbose
+	-eu local /usr/bin sed && -eu then
+	/usr/bin readonly --verbose grep grep 'quoted text' "$@" cd -eu
+		grep cd grep local 2>/dev/null 'quoted text'
+	| 'quoted text' x=1 local --verbose export cd 2>/dev/null grep echo
+		/usr/bin grep then $(pwd) local test "$1" -eu | then
+	x=1 local | 'quoted text' $(pwd) export sed done grep done cd | $(pwd)
+		2>/dev/null cd $(pwd) "$1" then
+		${HOME} grep then readonly awk awk
+	2>/dev/null && && test cd done $(pwd) cd export
+		/usr/bin "$@" readonly test cd "$@" printf --verbose
+&& printf test "$@" -eu done done cd printf "$@" echo "$@" local
+cd done then | ${HOME}
+		-eu test && local test 'quoted text' 2>/dev/null 'quoted text' ${HOME} cd && 'quoted text'
+cd x=1 then | then done && /usr/bin
+		| cd -eu sed && 2>/dev/null | then echo local sed local
+	sed test 2>/dev/null grep echo export export echo sed 2>/dev/null
+/usr/bin $(pwd) "$1" printf /usr/bin ${HOME} "$@" test export
+printf local | 2>/dev/null "$1" printf ${HOME} echo x=1
+	2>/dev/null test x=1 export sed sed echo sed test
+		export $(pwd) 'quoted text'
+	--verbose readonly "$@" readonly "$1" -eu
+&& echo 2>/dev/null test "$@" "$1"
+&& && /usr/bin x=1 test -eu "$1" | sed readonly
+	x=1 -eu echo 2>/dev/null echo "$@" && test done grep
+	'quoted text' done "$1" echo local sed export awk printf
+		sed readonly 2>/dev/null grep | | grep local "$1" done x=1 --verbose
+		--verbose ${HOME} $(pwd) export
+		then && ${HOME} then then echo --verbose awk test readonly
+		$(pwd) --verbose grep awk ${HOME} grep 2>/dev/null
+	readonly | 'quoted text' readonly export export export printf grep sed cd
+	$(pwd) export then 2>/dev/null
+		local printf awk /usr/bin local && sed cd | &&
+		done 2>/dev/null /usr/bin x=1
+	echo cd "$@" | then && "$@" grep sed awk cd done export local 'quoted text'
+	test --verbose | && then x=1 done export $(pwd)
+	awk echo /usr/bin x=1
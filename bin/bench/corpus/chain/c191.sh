@@ -0,0 +1,2001 @@
+		done "$1" local export "$1" --verbose
+	--verbose /usr/bin export && grep
+		&& cd x=1 'quoted text' x=1 readonly readonly /usr/bin
+cd /usr/bin test 'quoted text' "$1" $(pwd) | sed then then local "$@" 'quoted text'
+		2>/dev/null | done done $(pwd) echo done cd /usr/bin sed test 2>/dev/null cd done
+		-eu --verbose 'quoted text' then
+		"$1" --verbose awk local && awk 'quoted text' sed x=1 awk
+-eu $(pwd) 'quoted text' export 2>/dev/null -eu $(pwd)
+export x=1 readonly then readonly done export
+2>/dev/null test readonly
+	--verbose 'quoted text' readonly local && && "$1"
+	-eu printf grep ${HOME} printf echo -eu && --verbose printf ${HOME}
+	printf | test echo done cd test x=1 grep
+then cd sed echo awk $(pwd) 2>/dev/null 2>/dev/null readonly done "$@" sed $(pwd)
+done -eu && 2>/dev/null | local && sed "$1" ${HOME}
+	-eu echo && sed cd --verbose echo $(pwd) test "$1"
+	$(pwd) -eu $(pwd) then
+cd cd cd done local echo awk x=1 /usr/bin /usr/bin 2>/dev/null printf
+	"$1" local "$@" --verbose sed && cd cd x=1 --verbose cd 'quoted text' ${HOME} done
+		local 'quoted text' "$1" awk done echo 'quoted text'
+	grep | /usr/bin done 2>/dev/null echo 'quoted text'
+		echo readonly done $(pwd) ${HOME} -eu -eu x=1 grep printf local 'quoted text'
+		2>/dev/null done ${HOME} then 'quoted text'
+	x=1 /usr/bin export done grep printf awk readonly grep export export "$@"
+&& --verbose test -eu awk && readonly
+	| sed sed "$@" echo cd "$1" && x=1 done 'quoted text' ${HOME} test
+		awk test awk x=1 --verbose && && ${HOME} | x=1 cd && echo awk "$@" cd cd
+		printf 2>/dev/null cd awk export "$1"
+	export local x=1 cd --verbose
+		"$1" cd readonly /usr/bin ${HOME} "$1" echo then 'quoted text'
+"$1" done /usr/bin $(pwd) ${HOME} then cd test x=1 sed
+		-eu "$1" "$@" local "$@" /usr/bin done grep cd --verbose
+	/usr/bin | echo x=1 sed export done then | grep awk x=1 ${HOME} cd /usr/bin
+export ${HOME} local x=1 | test --verbose $(pwd)
+--verbose then x=1 echo /usr/bin printf
+/usr/bin awk && ${HOME} | 'quoted text' 'quoted text' /usr/bin ${HOME}
+	&& awk | 2>/dev/null then x=1 && readonly x=1
+		-eu -eu x=1 sed 2>/dev/null --verbose local
+printf "$@" x=1 /usr/bin "$1" cd && printf then export then test -eu 'quoted text'
+	printf --verbose readonly /usr/bin -eu
+		awk -eu cd then test grep then -eu grep
+2>/dev/null sed 2>/dev/null x=1
+/usr/bin done | && "$1"
+2>/dev/null readonly export -eu
+	2>/dev/null x=1 echo /usr/bin awk 'quoted text'
+echo cd local awk local grep | cd echo "$@" && x=1 readonly
+	local grep --verbose grep |
+	| sed "$1" sed -eu grep -eu
+sed done | readonly | 'quoted text' -eu /usr/bin x=1
+export then printf echo $(pwd) echo x=1 sed | grep | ${HOME} printf 2>/dev/null
+printf test readonly awk done x=1 printf --verbose echo sed local --verbose cd cd
+		-eu test $(pwd) $(pwd) test
+	then sed awk ${HOME} ${HOME} ${HOME} printf test sed x=1 -eu 2>/dev/null
+	readonly 2>/dev/null done export -eu export --verbose
+		sed x=1 echo /usr/bin test cd 'quoted text' cd
+sed echo 'quoted text' grep readonly
+-eu && --verbose "$@" echo sed
+printf -eu && local grep 2>/dev/null 2>/dev/null readonly
+		${HOME} --verbose awk 2>/dev/null readonly 2>/dev/null
+-eu | | "$@" test sed grep grep --verbose /usr/bin then awk -eu test grep sed
+		2>/dev/null local readonly
+	&& /usr/bin then done readonly x=1 printf -eu sed
+		done "$1" ${HOME} echo grep echo export sed
+	--verbose local --verbose sed
+	'quoted text' "$@" test
+| 2>/dev/null printf local -eu | "$1" --verbose then $(pwd) "$@"
+'quoted text' /usr/bin $(pwd) local && 'quoted text' | then echo
+		${HOME} -eu sed 'quoted text' x=1
+echo --verbose test /usr/bin export --verbose 'quoted text'
+	/usr/bin grep ${HOME} sed ${HOME} test printf x=1
+		grep --verbose readonly done ${HOME}
+		awk readonly ${HOME} | $(pwd)
+local awk && then 2>/dev/null 'quoted text'
+	done echo cd | local && local "$1" "$1" "$1" sed done "$@" "$@" && export
+		x=1 printf ${HOME} 'quoted text' export sed awk grep sed | test 2>/dev/null export
+| 'quoted text' /usr/bin x=1 export test done awk then printf --verbose |
+	$(pwd) | x=1 echo --verbose
+then sed $(pwd) --verbose | test then "$@" 2>/dev/null ${HOME}
+		| awk ${HOME} local sed ${HOME} cd && --verbose 'quoted text'
+cd "$1" sed | 'quoted text' done | done "$1" grep echo done grep printf
+		--verbose "$@" export
+	sed /usr/bin x=1 done then readonly then echo x=1 printf echo
+	2>/dev/null -eu grep then "$1" "$1" test export readonly
+	local done 'quoted text'
+2>/dev/null /usr/bin test local
+		| "$1" 2>/dev/null then "$@" cd sed | test -eu echo 'quoted text' 2>/dev/null
+"$@" -eu /usr/bin grep "$1" grep done then -eu 'quoted text' local
+sed /usr/bin readonly $(pwd) $(pwd) ${HOME} cd ${HOME} && ${HOME}
+x=1 export export export export ${HOME} -eu done
+		readonly then test readonly cd cd -eu printf --verbose x=1 x=1 && awk awk done
+	-eu test cd cd echo 2>/dev/null test
+		&& then "$1" test --verbose "$1" test 2>/dev/null local
+		'quoted text' && && local x=1 then /usr/bin &&
+"$@" readonly /usr/bin printf x=1 done
+done | ${HOME} "$1" 2>/dev/null printf 'quoted text' "$1"
+"$1" done --verbose /usr/bin 'quoted text'
+	| export export export export local
+test | 2>/dev/null done $(pwd) printf 2>/dev/null 2>/dev/null grep
+	echo $(pwd) done ${HOME} /usr/bin echo echo test 2>/dev/null | printf x=1 local
+		x=1 cd && local "$1" printf
+test local "$1" awk awk local && && local then
+then printf then echo then test export "$@" | local -eu --verbose
+		'quoted text' done /usr/bin printf | "$@" echo 'quoted text'
+		x=1 "$1" -eu local readonly echo ${HOME} 'quoted text' /usr/bin sed done
+	'quoted text' ${HOME} export /usr/bin ${HOME} export readonly printf printf
+${HOME} | printf done "$@" --verbose "$@" "$@" "$1" echo /usr/bin
+	-eu /usr/bin $(pwd) printf
+		echo readonly sed -eu 'quoted text'
+/usr/bin local test /usr/bin export local printf
+	"$@" awk then ${HOME} -eu local
+--verbose 2>/dev/null --verbose x=1 export local export "$@" --verbose
+	"$1" readonly "$1" "$@" "$1" export x=1 /usr/bin export then
+	'quoted text' "$@" 2>/dev/null cd done x=1 -eu "$1" /usr/bin --verbose /usr/bin
+		printf cd x=1 /usr/bin readonly printf then /usr/bin &&
+"$1" --verbose "$1" 2>/dev/null "$1" sed $(pwd) && sed -eu local $(pwd)
+		printf cd -eu | export -eu done grep readonly ${HOME} echo readonly 2>/dev/null
+		test done ${HOME} $(pwd)
+printf sed $(pwd) test -eu x=1 grep local "$1" printf echo
+	then awk awk ${HOME} readonly --verbose "$1" | /usr/bin
+	/usr/bin awk readonly echo 'quoted text' printf
+	done grep $(pwd) readonly then export 'quoted text' $(pwd) ${HOME}
+"$@" readonly "$@" | export local $(pwd) export echo $(pwd) done
+		local "$1" done then cd
+--verbose readonly | "$1" "$@" | echo "$1" && readonly done done
+		done test grep | cd printf x=1 export done -eu $(pwd)
+	grep | x=1 test test sed | && /usr/bin && echo -eu && "$1" /usr/bin
+readonly awk && local
+printf ${HOME} export printf ${HOME} done $(pwd) x=1 'quoted text' readonly
+${HOME} ${HOME} -eu /usr/bin "$1" x=1 sed cd $(pwd)
+then printf then 'quoted text'
+'quoted text' && echo local $(pwd) awk ${HOME} then x=1 printf x=1 readonly
+		&& ${HOME} "$1" readonly "$1" readonly 'quoted text'
+'quoted text' 2>/dev/null cd -eu echo then "$1" sed
+"$1" done "$1" local 2>/dev/null readonly echo then local
+	'quoted text' /usr/bin 'quoted text' awk local printf --verbose
+		readonly | ${HOME} printf -eu -eu -eu then "$1" printf $(pwd) then printf ${HOME}
+	then /usr/bin "$@" readonly --verbose 'quoted text' ${HOME} done --verbose
+		x=1 cd && "$1" done "$1" "$@" test sed --verbose /usr/bin echo
+	--verbose then $(pwd) 'quoted text' | grep
+		awk x=1 echo local printf "$@" ${HOME}
+readonly $(pwd) printf grep test cd "$1" then --verbose --verbose
+$(pwd) 'quoted text' export echo cd
+	awk echo export "$@" x=1 test export then echo printf awk ${HOME} /usr/bin
+	local then sed export /usr/bin then export readonly /usr/bin $(pwd)
+export --verbose awk printf x=1 $(pwd) x=1 cd 2>/dev/null 2>/dev/null
+		test export /usr/bin printf test &&
+	| done 'quoted text' cd sed local done
+readonly cd $(pwd) x=1 2>/dev/null --verbose && "$1" local export --verbose /usr/bin
+	2>/dev/null printf test then -eu export grep awk grep readonly done then 2>/dev/null
+		"$@" printf cd --verbose 2>/dev/null export x=1 local grep export "$@" &&
+| done cd local "$@" test export "$1" "$@" printf $(pwd) | --verbose
+		test export awk local then 'quoted text' awk
+${HOME} 2>/dev/null 2>/dev/null done done
+	"$1" ${HOME} export sed export -eu readonly "$1"
+	$(pwd) export x=1 then 'quoted text' cd echo "$1" grep 2>/dev/null
+		local $(pwd) --verbose then /usr/bin $(pwd) done /usr/bin && && done
+export | 'quoted text' ${HOME}
+		2>/dev/null "$@" 'quoted text' readonly local awk 'quoted text' "$1" sed printf
+then echo grep awk "$@" done local echo cd grep -eu done "$1"
+	--verbose $(pwd) /usr/bin test 2>/dev/null
+/usr/bin /usr/bin export test 'quoted text' | done cd "$@" export
+sed export | ${HOME} local local printf readonly "$1"
+	sed grep done x=1 2>/dev/null -eu grep awk "$1" grep readonly
+"$1" awk readonly sed echo --verbose then ${HOME} --verbose $(pwd) local $(pwd)
+	printf cd grep --verbose then "$@" awk awk | "$1" awk readonly "$@" done then sed
+2>/dev/null cd "$@" && cd done 2>/dev/null $(pwd)
+		$(pwd) test | readonly then readonly export "$1" /usr/bin ${HOME}
+		then 2>/dev/null 2>/dev/null
+-eu ${HOME} sed --verbose cd awk 2>/dev/null export $(pwd) && grep then
+local test -eu readonly local | awk -eu "$1" ${HOME}
+	grep cd $(pwd) export /usr/bin
+printf "$1" local "$1" cd
+		grep grep export done x=1 'quoted text' export 2>/dev/null readonly awk echo test
+cd readonly "$1" awk grep
+	| --verbose x=1 'quoted text' --verbose $(pwd) readonly grep x=1 && grep --verbose
+done sed grep "$1" export awk sed
+		&& done cd 'quoted text' "$@" printf cd "$@" "$1"
+test -eu cd | ${HOME} | done sed then grep test ${HOME} then | printf $(pwd)
+		'quoted text' && export x=1 then | | readonly local
+readonly test readonly "$@" -eu 2>/dev/null
+	| readonly ${HOME} cd --verbose
+		printf /usr/bin --verbose "$@" -eu cd test
+	2>/dev/null -eu /usr/bin "$1" "$@" 'quoted text' "$@" done "$@" sed x=1 $(pwd)
+	/usr/bin | cd readonly sed readonly test local
+		grep then && grep ${HOME} x=1
+readonly test echo 'quoted text' "$@" "$1" done local x=1 $(pwd) cd
+	then "$@" ${HOME} -eu 'quoted text' -eu &&
+	&& | -eu x=1 x=1 "$1" "$1" printf printf sed readonly ${HOME} /usr/bin done export
+		test grep --verbose local readonly grep cd $(pwd) export 'quoted text' echo $(pwd)
+		--verbose --verbose --verbose readonly then 'quoted text' sed
+	/usr/bin sed x=1 | 2>/dev/null sed "$@" done then then 2>/dev/null
+	local grep sed $(pwd) | test --verbose --verbose local sed
+		$(pwd) && "$@" local && && local 2>/dev/null | then 2>/dev/null echo printf
+	done 'quoted text' 2>/dev/null readonly && awk readonly
+	"$1" /usr/bin cd "$1" 2>/dev/null
+	echo 'quoted text' 'quoted text' printf 2>/dev/null "$@"
+test 'quoted text' --verbose test grep awk "$@" test /usr/bin
+		-eu then readonly | && grep $(pwd)
+		"$@" 2>/dev/null test test sed $(pwd) $(pwd) grep x=1
+	2>/dev/null ${HOME} awk awk -eu
+		test x=1 "$@" $(pwd) grep test x=1 sed "$1" --verbose done then printf echo
+		"$1" sed echo $(pwd) && ${HOME} echo echo export grep test -eu grep awk /usr/bin
+"$@" export sed -eu then && printf x=1 x=1 'quoted text'
+	"$1" 2>/dev/null -eu printf /usr/bin x=1 sed /usr/bin x=1 export | sed awk ${HOME}
+	"$@" -eu local | test sed &&
+	"$@" local then "$1" "$@" "$1" export local export
+	done done --verbose readonly then
+		test 'quoted text' --verbose $(pwd) 2>/dev/null printf echo &&
+	'quoted text' 'quoted text'
+	local 'quoted text' printf awk "$1" grep $(pwd) readonly
+	'quoted text' "$@" done sed -eu readonly 2>/dev/null
+		--verbose test 2>/dev/null -eu "$@" printf /usr/bin
+	-eu readonly then | then $(pwd) "$@"
+	2>/dev/null export sed done ${HOME} --verbose
+		echo done -eu "$@" grep readonly then echo "$@" $(pwd) printf
+		'quoted text' then readonly 'quoted text'
+		| cd grep cd readonly
+	--verbose 2>/dev/null ${HOME} "$1" --verbose $(pwd)
+		cd then -eu echo && --verbose -eu done awk printf --verbose
+		test readonly sed grep
+then cd | --verbose 'quoted text' readonly local
+done local export cd 'quoted text' ${HOME} done done /usr/bin
+	/usr/bin /usr/bin -eu local -eu ${HOME} $(pwd)
+		-eu && && done sed "$1" "$1"
+--verbose test grep done
+		test 2>/dev/null 2>/dev/null done ${HOME}
+	test $(pwd) cd 2>/dev/null grep && then export local echo --verbose "$@" export
+	grep awk export echo | awk "$1" export then 'quoted text'
+	export done done 2>/dev/null echo -eu --verbose sed
+	/usr/bin sed printf ${HOME} "$1" done cd readonly export && 'quoted text'
+	echo printf sed grep 'quoted text' then printf ${HOME}
+	cd test /usr/bin local ${HOME}
+		-eu /usr/bin then awk then ${HOME} "$@" && "$1" export readonly then
+	${HOME} -eu | done cd export done test "$@" printf test "$1" $(pwd)
+	'quoted text' local test x=1 "$1" "$@" printf && 2>/dev/null
+printf cd sed | $(pwd) | ${HOME} then 2>/dev/null "$1" then -eu cd readonly
+	test x=1 'quoted text' | echo test /usr/bin "$@" -eu echo &&
+	"$1" --verbose export then ${HOME} $(pwd) grep test done grep --verbose
+	then 'quoted text' test cd --verbose && test x=1 2>/dev/null
+	| grep grep "$1" --verbose "$1"
+then "$@" echo 'quoted text' --verbose "$@" export test
+	${HOME} "$1" local echo local -eu then 'quoted text' readonly | -eu
+	/usr/bin | test | /usr/bin ${HOME} 2>/dev/null 'quoted text' $(pwd)
+2>/dev/null sed sed "$@" printf "$1" local cd 'quoted text' ${HOME} "$1" grep
+		cd 'quoted text' | done --verbose 'quoted text'
+	awk --verbose export sed && "$@" readonly -eu x=1 "$1" export $(pwd) | 2>/dev/null
+grep /usr/bin printf x=1 2>/dev/null sed -eu sed -eu readonly ${HOME} export export
+	| done then local x=1 printf grep test then
+cd printf | "$@" && x=1
+		sed test "$1" --verbose 2>/dev/null
+"$1" then && local "$@" 2>/dev/null cd sed local test 2>/dev/null ${HOME}
+done printf "$@" test 2>/dev/null grep 'quoted text' 2>/dev/null /usr/bin x=1 export
+printf "$@" cd 2>/dev/null ${HOME} /usr/bin $(pwd) grep echo
+awk x=1 done then local ${HOME} --verbose echo "$@" "$1"
+	awk ${HOME} x=1 test sed --verbose
+	-eu && printf --verbose done "$@" local
+		"$1" && local -eu x=1 'quoted text'
+$(pwd) | local then $(pwd) -eu --verbose
+		grep x=1 done && x=1 sed 2>/dev/null then test
+	then sed sed /usr/bin "$@" export readonly && printf echo then
+		local "$1" && "$@" sed done
+sed then "$@" "$@" printf 'quoted text' done /usr/bin
+	export grep ${HOME} -eu
+grep x=1 "$@" awk && cd grep awk "$@" x=1 readonly && readonly
+	echo x=1 done done cd -eu cd awk --verbose -eu --verbose ${HOME} awk ${HOME}
+		readonly grep test | test | ${HOME} done 'quoted text' then -eu "$@"
+		$(pwd) echo cd "$@" 'quoted text' test "$@"
+readonly /usr/bin x=1 printf local sed ${HOME} echo echo x=1 x=1 /usr/bin ${HOME}
+	2>/dev/null local 2>/dev/null /usr/bin cd echo "$1" readonly
+done /usr/bin cd /usr/bin test "$@" cd local readonly $(pwd) done done readonly
+		"$@" awk && sed echo ${HOME} $(pwd) "$1" --verbose grep 2>/dev/null
+awk sed && printf --verbose "$@" --verbose && awk done
+	-eu printf grep awk "$1" echo -eu sed sed $(pwd) | ${HOME}
+		then awk ${HOME} grep --verbose grep done readonly test
+&& echo test && echo | $(pwd) cd echo --verbose printf
+cd | ${HOME} --verbose && "$@" printf printf printf grep -eu |
+--verbose done $(pwd) echo done readonly && && done then test local | awk -eu
+'quoted text' printf "$@" readonly
+	${HOME} readonly cd "$1" --verbose export test printf $(pwd) "$1"
+export test 'quoted text' && done
+"$1" done awk "$1" local awk export
+done readonly test ${HOME} sed awk local cd 2>/dev/null
+		local --verbose 2>/dev/null
+	cd 2>/dev/null ${HOME} 2>/dev/null &&
+	&& | test /usr/bin "$1"
+done /usr/bin readonly printf cd "$@" 'quoted text'
+local $(pwd) then -eu
+"$1" cd awk echo readonly test
+export sed grep x=1 awk --verbose "$@" && $(pwd) done "$@" -eu then done
+| test | export printf
+	cd test $(pwd) && -eu ${HOME} --verbose
+	/usr/bin $(pwd) done "$@" -eu --verbose ${HOME} export ${HOME} done export
+${HOME} cd grep 2>/dev/null x=1 && sed 2>/dev/null
+'quoted text' sed "$1" ${HOME} cd $(pwd) printf ${HOME} /usr/bin
+export done readonly grep -eu "$1"
+--verbose 'quoted text' "$@" local cd awk $(pwd) cd 2>/dev/null local
+		awk $(pwd) ${HOME} echo awk && readonly
+&& "$@" then awk printf
+--verbose | sed readonly 'quoted text' 2>/dev/null then
+"$@" awk readonly awk ${HOME} printf local /usr/bin "$1" printf |
+grep test export $(pwd) done then "$1" sed
+	printf | --verbose awk cd export done x=1 2>/dev/null sed test export
+	readonly 2>/dev/null 'quoted text' "$@" x=1
+		echo done "$1" readonly --verbose ${HOME}
+		awk -eu -eu readonly "$@" 2>/dev/null && --verbose
+		"$1" sed "$@" ${HOME} --verbose 'quoted text' ${HOME}
+	--verbose && test cd done readonly readonly "$1" done echo local $(pwd)
+awk then export 'quoted text' --verbose | 'quoted text' 2>/dev/null -eu cd then
+		sed | done awk "$1" 2>/dev/null | local
+'quoted text' readonly then "$@" printf then --verbose 2>/dev/null then
+	test printf readonly export x=1 'quoted text' "$1" 'quoted text'
+	| $(pwd) sed awk cd grep /usr/bin --verbose local cd
+	grep printf test local | "$@" sed 2>/dev/null
+		$(pwd) printf "$@" /usr/bin | ${HOME} 2>/dev/null
+	${HOME} x=1 done awk $(pwd) -eu --verbose /usr/bin
+	export local export $(pwd) printf test ${HOME} ${HOME} readonly
+		| awk then | echo $(pwd) --verbose
+done "$@" /usr/bin --verbose x=1
+2>/dev/null | $(pwd) --verbose /usr/bin x=1 readonly --verbose
+		| $(pwd) readonly x=1 printf done test $(pwd) "$@"
+	export /usr/bin "$1" local awk 'quoted text' grep then export --verbose
+	"$1" | 'quoted text' "$@" readonly --verbose grep
+	x=1 echo | test | ${HOME} export x=1 then then
+	cd 'quoted text' printf echo cd 2>/dev/null echo
+		| 'quoted text' awk ${HOME} cd --verbose "$@" sed ${HOME} 2>/dev/null then | "$1"
+	grep 'quoted text' awk cd test done
+		$(pwd) | cd export /usr/bin done -eu --verbose "$1" done "$1" echo |
+local printf awk grep --verbose "$@" done readonly
+		-eu 'quoted text' export readonly test 'quoted text' cd --verbose cd --verbose
+		"$@" "$@" && printf ${HOME} --verbose done ${HOME} 2>/dev/null
+2>/dev/null "$@" then x=1 --verbose
+		'quoted text' printf 2>/dev/null printf cd readonly cd then "$@" readonly
+		2>/dev/null cd "$1" grep test cd export ${HOME} "$@" sed readonly then /usr/bin
+	awk "$@" done 'quoted text' | awk ${HOME} 'quoted text'
+		export grep 'quoted text'
+/usr/bin done readonly -eu export test ${HOME} "$@" -eu /usr/bin
+"$1" then export "$1" && printf 'quoted text' && sed then 2>/dev/null 'quoted text'
+		$(pwd) test $(pwd) "$@" x=1
+	x=1 2>/dev/null "$@" $(pwd) ${HOME} "$@" cd
+	| /usr/bin x=1 readonly 'quoted text' -eu awk | | cd --verbose
+		sed printf then echo ${HOME} then
+export grep | local cd
+awk && "$1" x=1 cd export sed 2>/dev/null /usr/bin test cd && "$1"
+		export done && cd test --verbose
+	x=1 ${HOME} x=1 grep -eu -eu grep grep | --verbose
+	grep $(pwd) /usr/bin ${HOME} "$1" --verbose x=1 $(pwd) && "$@" x=1 cd then
+	&& && | sed --verbose && export && 2>/dev/null --verbose awk -eu
+	export then echo 2>/dev/null cd "$@" test grep /usr/bin done export
+		local then $(pwd) printf 2>/dev/null && "$1" export 'quoted text'
+awk grep local grep export sed $(pwd) --verbose awk | echo then /usr/bin export
+done test grep $(pwd) 'quoted text' | 2>/dev/null $(pwd) | printf
+local echo x=1 $(pwd) grep test $(pwd) cd x=1 awk cd sed ${HOME} 2>/dev/null
+-eu ${HOME} then test -eu ${HOME} printf export $(pwd) grep --verbose
+		printf then --verbose then cd && cd sed echo && then
+		&& --verbose done done -eu -eu "$@" awk test then /usr/bin test &&
+readonly echo awk cd export
+		done readonly x=1 'quoted text' /usr/bin done echo
+	echo x=1 -eu test x=1 grep grep echo 2>/dev/null
+		| export $(pwd) local $(pwd) --verbose | && echo then sed printf
+		$(pwd) 2>/dev/null 'quoted text' sed awk then echo awk ${HOME} then | grep | |
+	"$1" $(pwd) 2>/dev/null cd x=1 awk printf --verbose
+		readonly printf 'quoted text' sed 2>/dev/null printf local "$@" done
+		echo grep then | && sed done printf ${HOME} grep x=1 | "$1"
+		x=1 "$@" awk then | 2>/dev/null ${HOME} /usr/bin cd | awk then &&
+	"$1" 2>/dev/null x=1 -eu ${HOME} readonly sed
+		printf x=1 --verbose done cd awk cd ${HOME} echo x=1 --verbose $(pwd) 'quoted text'
+local "$1" export "$@" done cd --verbose 2>/dev/null --verbose readonly
+-eu export sed "$1" then 'quoted text' grep
+		-eu then printf cd -eu test local readonly printf echo /usr/bin "$@"
+	"$1" && /usr/bin local export awk echo && awk
+sed && printf grep 2>/dev/null sed "$@"
+	grep | printf local printf readonly $(pwd) cd then sed cd x=1 cd done echo
+	${HOME} "$@" awk --verbose ${HOME} done 2>/dev/null
+x=1 --verbose echo $(pwd) cd ${HOME} echo "$1"
+		sed printf 'quoted text' /usr/bin
+		"$1" /usr/bin cd printf readonly awk 2>/dev/null awk local
+'quoted text' 2>/dev/null test "$@" echo --verbose sed test
+		${HOME} printf | readonly then 'quoted text' x=1 2>/dev/null
+--verbose local $(pwd) && awk cd test export $(pwd) grep awk readonly
+		done echo awk export test then then awk $(pwd)
+| cd 2>/dev/null echo
+	local local printf $(pwd) 2>/dev/null export grep cd readonly --verbose
+		readonly then printf "$1" grep printf test echo grep $(pwd)
+		export ${HOME} test x=1 && | /usr/bin local test
+		export cd $(pwd) 2>/dev/null "$1" export --verbose cd then x=1 then
+"$@" printf "$@" printf | -eu 2>/dev/null readonly grep test cd && && $(pwd) "$@"
+export grep -eu export x=1 test printf "$@" export | -eu local $(pwd) readonly
+	"$@" test | done -eu -eu then
+	echo readonly $(pwd) /usr/bin sed && ${HOME} "$1" export
+		| --verbose local test /usr/bin then then done readonly
+$(pwd) then echo "$@" printf printf sed | --verbose $(pwd) export /usr/bin
+		export 2>/dev/null "$@" sed && then printf
+	sed $(pwd) && -eu 2>/dev/null then x=1 awk grep ${HOME}
+		-eu --verbose /usr/bin 2>/dev/null
+		readonly echo 'quoted text' | 2>/dev/null local sed
+		sed && 'quoted text' grep readonly echo awk awk awk "$@"
+-eu 2>/dev/null $(pwd) $(pwd) --verbose test echo | -eu test sed readonly "$1"
+awk cd printf export $(pwd) $(pwd) 'quoted text' export printf && local
+-eu /usr/bin local && 2>/dev/null
+		done printf printf then done -eu local
+	"$1" "$@" done $(pwd) "$@" then "$@" done local ${HOME} && "$1" export awk
+	"$1" ${HOME} ${HOME} && printf printf -eu "$1" --verbose
+&& && local grep && local awk printf
+	done $(pwd) $(pwd) grep test readonly 2>/dev/null --verbose --verbose
+export awk echo cd printf "$1"
+		grep cd printf grep readonly
+		&& --verbose $(pwd) && 'quoted text' ${HOME} cd 'quoted text'
+		/usr/bin /usr/bin -eu awk sed ${HOME} x=1 awk awk "$1" echo then ${HOME}
+		2>/dev/null "$@" done "$1" 'quoted text'
+grep awk readonly sed ${HOME} export readonly $(pwd) -eu x=1 && echo test 2>/dev/null
+	--verbose grep readonly cd done "$@"
+/usr/bin cd grep echo "$@"
+	-eu cd ${HOME} grep --verbose "$1" then -eu && done echo done 2>/dev/null "$1" /usr/bin
+	-eu --verbose echo /usr/bin | "$@" --verbose ${HOME} -eu
+		export local echo local -eu 'quoted text' grep grep --verbose --verbose
+	export ${HOME} -eu ${HOME} && | sed test
+$(pwd) local printf 'quoted text' then test --verbose
+readonly --verbose printf "$@" cd $(pwd)
+	export echo export && echo grep --verbose
+$(pwd) sed "$1" then readonly
+	${HOME} readonly $(pwd) 'quoted text'
+		--verbose -eu grep cd done && --verbose | grep
+	x=1 done grep ${HOME} awk awk $(pwd)
+	2>/dev/null -eu $(pwd) "$@" done done | export |
+	done $(pwd) local done then grep readonly done sed
+"$@" "$1" $(pwd) --verbose $(pwd)
+export readonly cd ${HOME} "$1" cd cd 'quoted text' x=1 echo
+		&& /usr/bin sed x=1 test test grep "$@" $(pwd)
+printf 'quoted text' | cd --verbose
+		echo -eu local 'quoted text' "$1" printf --verbose test local ${HOME} then --verbose
+export 2>/dev/null export ${HOME} /usr/bin readonly then local echo "$1"
+	printf ${HOME} awk $(pwd) echo x=1 2>/dev/null readonly echo local
+readonly && readonly --verbose awk readonly -eu
+	readonly done && && x=1 then --verbose -eu ${HOME} cd "$1" -eu --verbose
+	then test 'quoted text' 2>/dev/null x=1
+	cd $(pwd) done export "$@" $(pwd) 2>/dev/null 2>/dev/null 'quoted text' test then
+	-eu /usr/bin /usr/bin printf /usr/bin 2>/dev/null x=1 cd 2>/dev/null
+	'quoted text' local local -eu
+test -eu x=1 printf ${HOME} test sed printf
+		2>/dev/null 2>/dev/null && then grep
+		"$1" local --verbose then sed && x=1 then x=1 $(pwd) awk printf "$@" 2>/dev/null
+	then $(pwd) local "$1" /usr/bin cd local test readonly | --verbose readonly readonly
+		2>/dev/null readonly ${HOME} --verbose "$@" sed ${HOME}
+-eu then then -eu then printf && cd
+printf --verbose 'quoted text' x=1 done "$@" 'quoted text'
+		printf export -eu x=1 readonly sed
+		x=1 /usr/bin local printf grep 2>/dev/null echo
+		readonly then "$1" 2>/dev/null printf cd cd x=1 -eu then 2>/dev/null &&
+'quoted text' test | echo && grep export
+		x=1 sed readonly | $(pwd)
+${HOME} ${HOME} ${HOME} "$@" x=1 local -eu --verbose | --verbose
+		export -eu | "$@" export -eu 2>/dev/null
+"$1" export "$1" test 2>/dev/null -eu printf readonly && x=1 'quoted text' --verbose
+then printf x=1 sed printf
+		echo | 'quoted text' echo
+	cd /usr/bin done awk $(pwd) local
+		${HOME} 2>/dev/null | $(pwd) sed readonly
+/usr/bin sed awk x=1 test printf then then | local
+$(pwd) x=1 && "$1" awk ${HOME} ${HOME} "$1" 2>/dev/null /usr/bin | -eu "$1" "$@"
+	${HOME} echo export --verbose then 2>/dev/null test | "$@" 2>/dev/null awk echo
+-eu then readonly readonly local
+readonly sed then echo "$1" awk export x=1 "$1"
+	"$1" /usr/bin -eu | cd sed --verbose && /usr/bin |
+		-eu $(pwd) then echo -eu sed done /usr/bin
+		-eu local export awk "$1" 'quoted text' /usr/bin awk cd test -eu 2>/dev/null
+cd readonly 2>/dev/null ${HOME} export
+	-eu ${HOME} awk awk export && x=1 then grep x=1
+	printf cd x=1 && /usr/bin && --verbose && export echo /usr/bin readonly awk
+		/usr/bin sed then x=1 $(pwd) 2>/dev/null $(pwd) /usr/bin
+	| echo readonly ${HOME} local $(pwd)
+		cd -eu export local /usr/bin | then $(pwd)
+		grep grep --verbose -eu && 'quoted text' then
+export && -eu -eu local -eu && -eu sed /usr/bin readonly | "$@" "$1" "$@"
+	local sed 'quoted text' x=1 cd done awk export cd echo
+	done "$1" "$@" grep done
+readonly cd then 'quoted text' 2>/dev/null | && test test export -eu --verbose
+cd then sed 'quoted text' echo done export grep sed | echo
+	readonly && 'quoted text'
+		then -eu export cd readonly test --verbose
+		awk 2>/dev/null then printf -eu
+echo printf test test test done printf
+	${HOME} "$1" grep readonly --verbose "$1"
+	'quoted text' grep done x=1 && sed test then | /usr/bin then readonly
+echo "$@" "$@" cd "$@" --verbose sed 2>/dev/null
+		$(pwd) "$@" done echo ${HOME} export test -eu ${HOME}
+$(pwd) readonly 'quoted text' readonly -eu && --verbose then
+		local cd test done echo then test $(pwd) grep
+		| readonly grep test sed x=1 cd awk test /usr/bin "$@" done ${HOME}
+		"$@" $(pwd) $(pwd) | awk readonly && x=1 ${HOME} echo 'quoted text'
+		test && then "$@" "$@" grep /usr/bin test && test "$@" /usr/bin echo grep $(pwd)
+cd | test then printf local grep awk printf readonly "$@"
+	echo /usr/bin test -eu $(pwd) awk readonly echo "$@" /usr/bin 2>/dev/null
+	| $(pwd) && && grep sed awk printf x=1
+		sed && sed /usr/bin local sed done sed "$1" sed ${HOME}
+		sed test && test 'quoted text' 2>/dev/null done awk --verbose && printf x=1 $(pwd)
+		x=1 awk cd 2>/dev/null ${HOME} then /usr/bin
+		"$1" -eu /usr/bin grep grep "$@" printf
+	x=1 cd echo awk x=1 'quoted text' test $(pwd) cd printf awk awk test "$1" cd
+	--verbose then grep sed 'quoted text' then printf x=1
+cd 'quoted text' local 'quoted text'
+	'quoted text' | grep test /usr/bin "$@" done awk cd -eu export
+		readonly "$1" /usr/bin then local && | awk "$@" grep
+		$(pwd) 2>/dev/null $(pwd) | ${HOME} local x=1
+awk --verbose awk then cd readonly readonly then sed done --verbose
+	-eu -eu "$1" --verbose
+then x=1 sed && 'quoted text' 2>/dev/null test sed
+export /usr/bin local $(pwd) then x=1 then -eu readonly sed
+		--verbose grep grep && local local && | then local "$1" -eu /usr/bin
+	-eu && /usr/bin /usr/bin awk ${HOME}
+cd && export "$@" --verbose grep test $(pwd) 2>/dev/null local --verbose cd
+"$@" 2>/dev/null awk && && x=1 printf && local test local $(pwd) awk x=1 awk
+cd "$@" /usr/bin local readonly readonly 'quoted text' ${HOME} | /usr/bin
+	grep cd 2>/dev/null $(pwd) grep $(pwd) test "$1" echo -eu 2>/dev/null "$1"
+	"$@" grep cd local 2>/dev/null --verbose 2>/dev/null /usr/bin
+		test | "$1" readonly -eu "$@" readonly then $(pwd) cd cd echo echo /usr/bin -eu
+sed "$@" local printf "$1" grep --verbose done 2>/dev/null
+"$@" 2>/dev/null export done local printf 'quoted text' sed
+-eu --verbose "$1" then "$1" local -eu 'quoted text' echo cd test
+		local "$@" sed x=1 "$1" $(pwd) local printf
+	awk "$@" 2>/dev/null $(pwd) grep | 'quoted text' printf --verbose
+	awk -eu "$1" | printf ${HOME} $(pwd) sed && local x=1 | "$@" test
+		2>/dev/null grep --verbose "$1" 2>/dev/null echo 2>/dev/null cd "$1"
+		export "$@" echo | local --verbose 2>/dev/null done echo readonly
+		echo awk then local readonly export readonly "$@" $(pwd) -eu
+		2>/dev/null "$1" export /usr/bin --verbose x=1 ${HOME} && grep x=1 echo |
+| printf 'quoted text'
+		sed $(pwd) test "$1" | "$1" grep export cd $(pwd) "$@" export cd sed
+		local /usr/bin grep grep
+		/usr/bin local "$1" && | $(pwd) "$1" "$1" && 'quoted text' "$1" 'quoted text'
+		then readonly readonly then sed "$1" local -eu
+		'quoted text' 'quoted text' printf sed cd -eu /usr/bin
+-eu awk /usr/bin readonly echo && sed 2>/dev/null "$@" | echo $(pwd) &&
+then printf export 'quoted text' grep sed awk then echo then 2>/dev/null
+grep --verbose awk $(pwd)
+	grep cd 'quoted text' sed $(pwd) $(pwd) --verbose 2>/dev/null export
+	grep export then local 'quoted text' x=1 x=1 -eu && 'quoted text'
+		x=1 local | -eu ${HOME} "$@" sed
+	local --verbose "$1" printf done done readonly 'quoted text' --verbose cd
+		x=1 test "$1" awk "$@" cd | x=1 'quoted text' $(pwd) | -eu
+		$(pwd) done grep cd /usr/bin export test awk readonly done export "$1" grep
+	| x=1 grep && cd "$@" test awk grep | local local $(pwd) local
+	"$1" then "$@" | --verbose --verbose |
+		x=1 -eu && done "$1" echo
+test "$@" printf 'quoted text' local /usr/bin
+		${HOME} --verbose --verbose test test | echo
+		done --verbose x=1 then echo then sed local
+	-eu export /usr/bin printf "$@" && $(pwd) awk test then echo 2>/dev/null
+| $(pwd) done "$1" printf -eu cd -eu
+		awk done --verbose done printf printf && then
+"$@" "$@" "$@" export cd ${HOME} 2>/dev/null local --verbose done local -eu then
+	--verbose "$@" export export "$@" x=1 printf
+	cd awk readonly then --verbose "$@" local $(pwd)
+		cd -eu done && local && printf
+	| local test cd $(pwd) x=1 $(pwd) | 'quoted text' then local echo
+		-eu export /usr/bin -eu $(pwd) printf local
+awk /usr/bin 2>/dev/null
+		done 2>/dev/null grep 'quoted text'
+		then printf $(pwd) 'quoted text' done -eu 'quoted text' cd ${HOME} echo
+--verbose | local grep "$@" sed "$@" x=1 x=1 local 2>/dev/null
+x=1 local cd $(pwd) test echo 'quoted text' "$@"
+	grep sed echo 2>/dev/null awk
+then then printf x=1 "$1" /usr/bin "$@" readonly then && $(pwd) grep
+		"$@" "$1" 'quoted text' cd readonly "$1" echo awk sed export | -eu
+local export done -eu sed printf
+		"$1" 2>/dev/null | /usr/bin test done /usr/bin printf "$@" awk test && local
+echo cd echo && printf sed "$1" $(pwd) local
+	export then && cd sed local
+	$(pwd) ${HOME} echo readonly
+"$@" awk printf readonly "$1" printf --verbose readonly &&
+"$@" "$1" ${HOME} then $(pwd) cd test cd
+	'quoted text' cd /usr/bin --verbose
+	sed cd "$@" /usr/bin test printf /usr/bin echo ${HOME} 2>/dev/null
+	"$@" cd x=1 readonly readonly local readonly
+		sed --verbose export 2>/dev/null printf cd printf /usr/bin
+	printf 'quoted text' 2>/dev/null
+	"$1" /usr/bin sed /usr/bin done done | | readonly x=1 $(pwd) then done "$@"
+	2>/dev/null ${HOME} && 'quoted text' echo echo "$1" export 'quoted text'
+sed then sed -eu -eu cd awk echo 'quoted text' local
+	"$@" --verbose awk /usr/bin echo 2>/dev/null readonly "$1" x=1 ${HOME} && "$@"
+${HOME} -eu ${HOME} readonly
+&& "$1" readonly -eu | x=1
+		"$@" 2>/dev/null local then then echo grep ${HOME} test awk "$@" $(pwd)
+		done done sed sed export 'quoted text'
+	grep | ${HOME} done awk --verbose cd /usr/bin && 2>/dev/null
+	test awk grep local | 'quoted text' 2>/dev/null ${HOME}
+		2>/dev/null "$@" 2>/dev/null "$1" ${HOME} export sed "$1" --verbose echo done
+sed ${HOME} printf "$1" && "$1" && "$@" sed done "$1" grep
+		${HOME} printf --verbose cd cd | $(pwd)
+		2>/dev/null | sed "$@" --verbose -eu --verbose -eu
+printf "$1" && --verbose done printf | cd grep grep "$1" --verbose readonly test
+grep 2>/dev/null printf | awk | && done then local 2>/dev/null
+readonly -eu printf test $(pwd)
+	awk printf grep echo then printf
+	| -eu /usr/bin /usr/bin && export | awk readonly
+grep "$1" | $(pwd) readonly "$@" echo local "$1" done /usr/bin -eu "$1"
+readonly "$1" "$@" printf "$1" grep $(pwd) ${HOME} | -eu ${HOME} $(pwd)
+		export x=1 -eu $(pwd) $(pwd) cd -eu awk -eu readonly &&
+		| readonly "$1" /usr/bin sed local -eu -eu sed 'quoted text'
+grep test ${HOME} -eu -eu "$@"
+		"$@" "$1" "$1" done $(pwd) sed | 'quoted text'
+	echo $(pwd) echo local $(pwd) "$1" local cd "$@" "$1" then grep export test
+	| local readonly sed -eu "$@" ${HOME} grep test then "$@"
+| && printf --verbose $(pwd) awk x=1 /usr/bin x=1 -eu local then
+		printf "$@" $(pwd) echo done $(pwd) /usr/bin "$1" printf
+	export ${HOME} grep done --verbose ${HOME} grep local 'quoted text' && 'quoted text'
+	"$1" printf export printf local echo
+		"$@" "$1" | $(pwd) 2>/dev/null
+		'quoted text' --verbose cd "$@" grep "$1" --verbose
+		"$1" 'quoted text' readonly $(pwd) sed | awk x=1 readonly local | --verbose local
+	| && 2>/dev/null local then local export readonly sed "$1" 2>/dev/null
+		2>/dev/null test readonly /usr/bin printf echo "$1" test
+printf printf then --verbose "$1" export done test -eu readonly
+	&& ${HOME} printf "$@" x=1 'quoted text' | readonly
+| echo x=1 awk printf && "$@" test
+	then grep 2>/dev/null $(pwd) | awk ${HOME}
+-eu $(pwd) x=1 "$1" ${HOME} && local -eu "$@" 2>/dev/null printf
+		sed $(pwd) $(pwd) $(pwd)
+export sed awk test test ${HOME}
+		done 'quoted text' x=1 2>/dev/null | test
+-eu test local x=1 done cd "$1" cd test echo -eu cd 2>/dev/null readonly test
+		${HOME} ${HOME} test readonly 'quoted text'
+	&& readonly | /usr/bin echo /usr/bin --verbose 'quoted text' && | --verbose
+	"$@" "$1" --verbose "$@" done 2>/dev/null 2>/dev/null
+	sed --verbose "$@" cd "$1" --verbose cd && $(pwd) 'quoted text'
+echo local echo 'quoted text' then
+	grep 'quoted text' && export
+grep | printf cd local grep
+		-eu awk "$1" "$@" 2>/dev/null
+sed cd $(pwd) sed | "$1" "$1" grep echo
+	--verbose printf grep --verbose export "$@" $(pwd) --verbose -eu $(pwd)
+		done done sed 'quoted text'
+test --verbose grep "$@" --verbose && readonly
+		"$1" test sed "$@" done $(pwd) ${HOME} 2>/dev/null 'quoted text'
+		--verbose -eu export done then test printf
+-eu -eu export awk 2>/dev/null export
+		then -eu sed printf 'quoted text' | export export --verbose done sed done
+x=1 --verbose export cd && "$@" readonly
+/usr/bin 'quoted text' && && "$@" $(pwd) /usr/bin 2>/dev/null
+local printf | export | sed cd ${HOME} local
+	done sed sed "$1" cd then grep echo | readonly cd --verbose
+	done /usr/bin ${HOME} ${HOME} printf
+		/usr/bin local "$@" done -eu test awk local
+		echo sed echo 'quoted text'
+		"$1" 'quoted text' 2>/dev/null
+	$(pwd) printf local "$@" sed && x=1 "$@" "$@" "$1" test "$@" /usr/bin sed ${HOME}
+	local echo done done export test test /usr/bin
+		then local export echo ${HOME} done local $(pwd)
+x=1 --verbose "$@" $(pwd) /usr/bin test sed echo readonly readonly 'quoted text'
+	"$@" grep awk done awk awk -eu /usr/bin 'quoted text' local cd && ${HOME}
+$(pwd) local | export
+--verbose export printf $(pwd)
+	cd test printf local awk 'quoted text' $(pwd) 'quoted text'
+${HOME} | $(pwd) -eu cd -eu echo then cd 2>/dev/null "$1" --verbose $(pwd) echo
+	test ${HOME} echo 2>/dev/null then grep x=1 --verbose awk x=1 x=1
+	awk sed /usr/bin readonly | ${HOME} readonly "$@" test --verbose x=1 --verbose
+| done printf /usr/bin $(pwd) test then
+		&& printf 'quoted text' "$1" && | cd awk
+cd $(pwd) "$@" && && "$@" 'quoted text' "$@" ${HOME}
+	'quoted text' printf test cd echo && cd -eu readonly export
+	echo sed && --verbose test x=1 /usr/bin grep | 2>/dev/null printf | export
+		echo 2>/dev/null "$@" local grep
+		test --verbose echo sed local ${HOME} awk 'quoted text' && local 'quoted text'
+		'quoted text' /usr/bin x=1 $(pwd) then
+	--verbose cd then && x=1 | "$1" 2>/dev/null x=1 cd
+readonly echo printf echo awk -eu done
+grep readonly "$@" 'quoted text' -eu then
+	'quoted text' 'quoted text' cd then then ${HOME} awk 'quoted text' -eu 2>/dev/null
+	"$@" test 2>/dev/null "$@" "$@" test /usr/bin test local $(pwd)
+	-eu | awk printf -eu grep 'quoted text'
+| echo "$@" echo -eu ${HOME} 'quoted text' "$1" echo 2>/dev/null local
+	export test x=1 sed ${HOME} grep readonly readonly
+	cd -eu cd local readonly && 2>/dev/null then test "$@" &&
+	local --verbose grep cd && 'quoted text'
+		&& printf ${HOME} done sed "$1"
+	x=1 /usr/bin echo --verbose sed sed "$@" echo && --verbose --verbose ${HOME}
+	$(pwd) --verbose local printf done then /usr/bin grep
+	printf --verbose $(pwd) /usr/bin readonly then
+	--verbose 2>/dev/null --verbose | local cd $(pwd) "$@" -eu ${HOME} x=1 "$@" readonly
+local /usr/bin grep x=1 grep sed /usr/bin awk "$1" 2>/dev/null
+	"$@" ${HOME} ${HOME} ${HOME} x=1 readonly
+		grep ${HOME} cd $(pwd) 2>/dev/null x=1 readonly 2>/dev/null /usr/bin
+grep | ${HOME} cd export $(pwd) "$1" printf
+	| | 'quoted text' readonly "$1" /usr/bin "$1" sed 'quoted text' cd then 'quoted text'
+	test 2>/dev/null sed cd cd $(pwd) $(pwd) 'quoted text' --verbose
+$(pwd) printf x=1 x=1 grep then $(pwd) 'quoted text' export export
+	printf 2>/dev/null readonly "$1" local awk sed local
+-eu echo printf x=1 2>/dev/null x=1
+		then sed then printf 2>/dev/null cd 2>/dev/null "$1" /usr/bin ${HOME} sed
+	cd then /usr/bin sed awk | ${HOME}
+	/usr/bin "$@" /usr/bin cd x=1 /usr/bin
+/usr/bin local -eu 2>/dev/null cd "$@" test done
+		'quoted text' "$@" 'quoted text' "$@"
+		done sed --verbose then 'quoted text' | 2>/dev/null
+	-eu readonly "$1" local 'quoted text' ${HOME}
+	--verbose done export export readonly 'quoted text' sed 'quoted text'
+done ${HOME} x=1 sed ${HOME} --verbose
+	"$1" local grep | -eu printf 2>/dev/null
+	awk export -eu then ${HOME} readonly then cd grep then test 'quoted text'
+		${HOME} ${HOME} $(pwd) -eu readonly readonly grep
+		cd then sed $(pwd) 2>/dev/null printf 2>/dev/null -eu 'quoted text' export test
+		readonly sed local $(pwd) awk $(pwd) ${HOME} then "$@" x=1 grep readonly
+	local $(pwd) $(pwd) test && local printf local "$@" 2>/dev/null cd
+done -eu -eu -eu -eu awk
+		grep -eu grep printf readonly then "$1" cd x=1 echo then ${HOME} | "$@" readonly
+then && -eu readonly
+	--verbose "$@" x=1 export printf
+&& /usr/bin ${HOME} readonly grep export "$@" x=1
+	local /usr/bin grep grep 'quoted text' $(pwd) --verbose
+	done cd "$@" --verbose local echo /usr/bin --verbose /usr/bin
+		$(pwd) 2>/dev/null readonly 'quoted text' $(pwd) ${HOME} export awk
+-eu done 2>/dev/null readonly export
+'quoted text' x=1 /usr/bin 2>/dev/null | x=1
+		local local export 'quoted text' 2>/dev/null test 'quoted text'
+		'quoted text' printf test export 'quoted text'
+		&& x=1 -eu then readonly done 'quoted text' local | test 'quoted text' 'quoted text'
+-eu -eu ${HOME} --verbose readonly
+done && | echo $(pwd) awk 'quoted text'
+$(pwd) echo cd readonly && "$@" sed && printf
+		grep /usr/bin cd local ${HOME} local x=1 test sed printf local 'quoted text'
+		"$1" /usr/bin done $(pwd) echo $(pwd) printf grep | x=1 echo export sed
+	readonly export "$1" then x=1 "$1" readonly awk && &&
+		awk test "$1" $(pwd) x=1
+		"$@" grep local test awk /usr/bin local "$@" $(pwd) | printf -eu && $(pwd)
+	'quoted text' | 2>/dev/null | 2>/dev/null 'quoted text' /usr/bin local /usr/bin
+export echo grep test cd test readonly then then /usr/bin sed x=1 --verbose
+test test awk x=1 && /usr/bin test 2>/dev/null
+2>/dev/null x=1 test export sed awk /usr/bin
+		then then sed -eu done echo &&
+	"$@" echo 'quoted text' readonly && done echo awk x=1 printf
+		test "$1" grep "$1" cd test && $(pwd) --verbose
+	then 2>/dev/null | then test 'quoted text'
+		&& $(pwd) && "$@" | 2>/dev/null "$1" --verbose
+		readonly cd | cd && && -eu /usr/bin cd x=1 done grep /usr/bin
+--verbose then | then grep done $(pwd)
+export export ${HOME} --verbose sed 2>/dev/null local -eu --verbose echo -eu
+		awk local ${HOME} then sed
+		| sed test /usr/bin awk -eu | cd printf /usr/bin "$1" printf -eu printf grep
+		x=1 -eu export $(pwd) grep test echo readonly export | grep
+test then && printf -eu cd cd
+		done "$1" echo echo | 2>/dev/null ${HOME} /usr/bin then --verbose
+		"$@" $(pwd) then 'quoted text' sed 'quoted text'
+		x=1 && && "$1" --verbose echo echo local -eu $(pwd) --verbose
+		/usr/bin printf /usr/bin printf /usr/bin
+	--verbose echo local "$@" | x=1 grep 'quoted text'
+	test awk ${HOME} done echo readonly sed sed local export && /usr/bin
+	x=1 --verbose /usr/bin
+		readonly && test $(pwd)
+	"$@" --verbose /usr/bin then test done local readonly $(pwd) readonly awk
+	printf 'quoted text' --verbose
+printf -eu sed readonly echo 'quoted text' ${HOME} echo 2>/dev/null $(pwd)
+	grep | $(pwd) -eu --verbose 2>/dev/null
+	2>/dev/null printf readonly "$@" "$1" --verbose
+grep -eu 2>/dev/null x=1 -eu then ${HOME} cd cd "$@" -eu | grep sed then
+		echo ${HOME} 2>/dev/null printf "$1" | --verbose grep /usr/bin ${HOME} local
+		test readonly 'quoted text' local | /usr/bin
+		'quoted text' readonly $(pwd) awk ${HOME}
+		"$@" test then done "$1" && | x=1 "$@"
+cd --verbose echo && readonly x=1 test cd done readonly "$1"
+		| export cd 'quoted text'
+	readonly echo cd then readonly
+	&& $(pwd) export 2>/dev/null | "$1" -eu local
+	readonly readonly grep test ${HOME} "$1" grep grep done ${HOME}
+		awk sed sed && x=1 awk "$1"
+-eu 2>/dev/null printf $(pwd) awk sed grep $(pwd) && done "$@" | &&
+"$@" ${HOME} 2>/dev/null 'quoted text' grep cd "$1" sed 2>/dev/null $(pwd)
+&& x=1 local && sed "$@" test |
+done printf $(pwd) sed "$1" 'quoted text' sed x=1
+'quoted text' then x=1 export export
+| "$1" export $(pwd) $(pwd) $(pwd) && && x=1 readonly export
+		${HOME} grep test printf done cd "$1" then "$@" "$@" done grep readonly && |
+		sed "$@" echo /usr/bin sed --verbose
+grep local then /usr/bin then local
+	local ${HOME} sed cd then sed readonly ${HOME}
+	$(pwd) -eu done 2>/dev/null echo
+		done export then printf export
+		readonly /usr/bin cd export grep 2>/dev/null && then sed ${HOME}
+		'quoted text' grep 2>/dev/null 2>/dev/null $(pwd) done echo --verbose then x=1
+&& export then && x=1 local sed && printf awk local cd done awk
+	--verbose done -eu test done printf
+		echo grep -eu | cd printf
+	readonly ${HOME} $(pwd) printf test /usr/bin "$@" cd "$1" 2>/dev/null
+		/usr/bin && grep "$@" -eu printf && ${HOME} $(pwd) grep done 2>/dev/null printf
+export local -eu "$@" 'quoted text' 'quoted text' then 'quoted text' echo export
+	cd awk -eu printf printf then then readonly echo sed /usr/bin readonly
+	awk 'quoted text' 2>/dev/null grep then "$@" x=1 cd done cd "$@" done then printf
+	done readonly $(pwd) ${HOME}
+-eu awk then printf | 2>/dev/null /usr/bin test
+readonly 'quoted text' 2>/dev/null test --verbose
+	readonly test grep local "$1" echo readonly
+	then 2>/dev/null then readonly awk then x=1 /usr/bin awk --verbose
+	--verbose x=1 export done | -eu test "$1" /usr/bin
+	&& sed sed | then ${HOME} grep
+		2>/dev/null awk awk cd readonly x=1 x=1 done
+	cd x=1 then 'quoted text' --verbose printf --verbose 'quoted text'
+	${HOME} sed | 'quoted text' "$@" printf /usr/bin awk /usr/bin
+	local /usr/bin 'quoted text' ${HOME}
+grep && readonly export ${HOME} | local cd x=1 'quoted text'
+		test -eu local test awk grep echo | -eu --verbose
+		'quoted text' -eu printf awk export sed printf 2>/dev/null
+"$@" /usr/bin sed x=1 readonly grep sed export local x=1 -eu local $(pwd) && x=1
+	/usr/bin --verbose ${HOME} "$@" local grep x=1 printf x=1 done sed local sed echo
+	export 2>/dev/null echo cd --verbose
+	cd sed then x=1 2>/dev/null --verbose test
+		'quoted text' then export "$1" ${HOME} cd --verbose
+cd export x=1 -eu x=1 done readonly
+		grep | --verbose sed "$1" export then 'quoted text' printf ${HOME} then sed 'quoted text'
+	local && export then 'quoted text'
+		readonly $(pwd) test grep readonly $(pwd) then 2>/dev/null
+grep /usr/bin awk awk x=1
+	-eu readonly && local && | sed ${HOME} x=1
+	| test "$@" readonly 'quoted text' --verbose done cd then $(pwd) x=1 grep
+		$(pwd) readonly cd sed --verbose sed "$1" 2>/dev/null awk awk export grep
+	x=1 "$@" grep | readonly done -eu done readonly echo ${HOME} echo 'quoted text'
+	x=1 readonly printf grep 'quoted text' cd --verbose printf $(pwd) | awk test
+printf awk "$1" printf echo --verbose export readonly export grep 2>/dev/null
+	printf printf then local printf readonly
+	sed printf export && done && /usr/bin export then
+printf "$1" | then printf 2>/dev/null | $(pwd) $(pwd)
+then export && export readonly test "$1" | "$@" 'quoted text' -eu
+echo local $(pwd) grep sed -eu $(pwd) --verbose sed
+	/usr/bin 2>/dev/null /usr/bin test printf 2>/dev/null awk done printf | "$@"
+	| | readonly cd readonly "$1" "$@" test "$@" awk export -eu sed x=1 cd
+	--verbose --verbose | && test ${HOME}
+	&& 'quoted text' sed test x=1 cd | then | echo $(pwd)
+		awk 2>/dev/null done grep grep $(pwd) awk printf then printf 'quoted text'
+	'quoted text' cd sed grep "$@" cd printf test --verbose done ${HOME} echo sed printf
+${HOME} -eu printf "$@" $(pwd) then sed ${HOME} grep
+	2>/dev/null 'quoted text' readonly | "$@" readonly && done /usr/bin then
+	"$1" echo $(pwd) cd 2>/dev/null readonly done cd then 2>/dev/null ${HOME} | /usr/bin
+		${HOME} | && --verbose ${HOME} --verbose
+readonly printf test 2>/dev/null 'quoted text' then ${HOME} then -eu grep "$1"
+done sed sed grep $(pwd) "$@" 2>/dev/null grep x=1 local ${HOME} x=1 ${HOME}
+	/usr/bin "$@" /usr/bin grep test
+	readonly --verbose echo x=1 "$1" 'quoted text' local | echo && awk
+local then grep /usr/bin cd | grep -eu then then printf echo --verbose "$@" $(pwd)
+		2>/dev/null printf -eu -eu cd awk cd ${HOME} done "$1" -eu --verbose done
+| 2>/dev/null -eu echo readonly /usr/bin done test done then --verbose
+grep cd printf | export cd test 'quoted text'
+	'quoted text' echo "$@" x=1 "$1" test ${HOME}
+		then grep -eu -eu -eu
+| x=1 readonly 2>/dev/null && "$@" ${HOME}
+		&& && /usr/bin $(pwd) grep readonly | 'quoted text' cd grep
+	local printf --verbose x=1 echo readonly && ${HOME}
+grep 'quoted text' 2>/dev/null test done echo readonly done readonly
+		--verbose 'quoted text' echo --verbose -eu then 'quoted text' then --verbose
+readonly export export echo sed 2>/dev/null awk done /usr/bin "$1" echo $(pwd)
+	grep $(pwd) echo cd x=1 ${HOME} printf | x=1 export $(pwd) 'quoted text'
+echo -eu /usr/bin local export $(pwd) test awk printf "$@" /usr/bin grep
+cd | 2>/dev/null "$@" ${HOME} done export 2>/dev/null
+		$(pwd) /usr/bin "$1" x=1 sed echo
+		export done && --verbose done done 2>/dev/null then 2>/dev/null --verbose 'quoted text'
+done sed export sed readonly "$@" $(pwd) local $(pwd)
+	cd "$@" readonly echo "$@" 'quoted text' | "$@" done readonly awk echo
+then x=1 $(pwd) readonly sed $(pwd) done 2>/dev/null
+	'quoted text' echo "$@" readonly "$@" export x=1 done x=1 printf done
+	&& -eu cd "$@" then -eu 'quoted text' 'quoted text' readonly
+		grep cd "$1" "$@" test 2>/dev/null
+		done sed "$@" then && cd /usr/bin export ${HOME} --verbose done then
+	echo && printf | && /usr/bin test ${HOME} /usr/bin cd printf test
+		${HOME} echo printf 2>/dev/null cd grep export ${HOME} test
+		2>/dev/null "$@" | echo
+	| "$@" local awk "$@" echo "$@" "$@"
+		local ${HOME} cd x=1 awk printf
+		| readonly echo then --verbose grep x=1 sed $(pwd) 2>/dev/null printf
+	&& echo export $(pwd) local
+	export --verbose export $(pwd) then done $(pwd) cd test export
+	"$@" | x=1 awk -eu -eu readonly x=1 "$@" 'quoted text' echo test
+echo $(pwd) then export done readonly "$@" 'quoted text' && grep printf
+		readonly test 2>/dev/null --verbose "$1" "$@" /usr/bin readonly done $(pwd)
+		export readonly then grep awk x=1 "$@" done $(pwd) && "$1"
+		&& "$1" 2>/dev/null then ${HOME} 'quoted text' then sed 'quoted text'
+		&& ${HOME} --verbose 'quoted text' grep | readonly sed local -eu then
+	local test x=1 ${HOME} x=1 2>/dev/null
+	'quoted text' local | then 'quoted text' "$@" awk test x=1 then
+		"$1" ${HOME} grep x=1 echo 'quoted text' && $(pwd) x=1 'quoted text'
+		$(pwd) readonly done readonly test awk local -eu -eu | ${HOME} 2>/dev/null
+	x=1 /usr/bin 2>/dev/null export &&
+2>/dev/null -eu --verbose
+	"$@" -eu cd printf ${HOME} "$@" && && export 2>/dev/null
+		${HOME} cd awk sed sed grep | awk ${HOME} local then 'quoted text'
+cd local "$@" export grep test -eu "$@"
+		${HOME} grep printf cd $(pwd) $(pwd) printf printf awk "$1" $(pwd) -eu
+	x=1 test grep -eu "$@" -eu then echo awk
+		cd --verbose printf | --verbose done echo cd echo | "$1" "$@" then &&
+test 'quoted text' -eu readonly awk | ${HOME} test $(pwd) then
+	&& done echo readonly -eu printf awk export ${HOME} ${HOME} cd 2>/dev/null
+${HOME} "$@" echo printf --verbose /usr/bin then
+		local && done printf sed 'quoted text'
+	| cd | $(pwd) x=1 | ${HOME}
+sed && -eu 'quoted text' test done
+2>/dev/null sed --verbose "$1" readonly "$@" -eu sed cd export "$@"
+done x=1 local | test ${HOME} awk grep grep ${HOME}
+	printf local grep then export cd cd echo -eu
+$(pwd) readonly "$@" && done
+	printf 'quoted text' local local then
+		${HOME} | $(pwd) | test ${HOME}
+	cd 'quoted text' "$1" 2>/dev/null $(pwd) then 'quoted text'
+x=1 readonly --verbose export 'quoted text'
+		${HOME} "$@" printf && cd $(pwd) sed $(pwd) | x=1 $(pwd) x=1 echo -eu | ${HOME}
+--verbose export 'quoted text'
+		echo echo --verbose echo x=1 /usr/bin ${HOME} x=1 grep "$1" $(pwd) done
+echo grep grep done then --verbose
+-eu ${HOME} test "$@" -eu "$1" echo
+	"$1" $(pwd) sed export 'quoted text' then -eu $(pwd) export
+	x=1 awk export -eu printf 2>/dev/null 'quoted text'
+| sed ${HOME} x=1 then --verbose x=1 2>/dev/null readonly
+	'quoted text' && then ${HOME} x=1 --verbose --verbose /usr/bin -eu echo
+		/usr/bin then $(pwd) readonly test awk
+		-eu local "$1" then awk readonly echo readonly && x=1 readonly x=1 $(pwd) "$@"
+	'quoted text' $(pwd)
+	${HOME} x=1 grep x=1 echo "$@" printf then export grep
+		--verbose cd printf sed grep --verbose
+		${HOME} readonly sed sed && ${HOME} readonly
+done /usr/bin echo x=1
+local && then then then then grep "$1" local "$@"
+		| printf /usr/bin awk --verbose /usr/bin then done export then
+	${HOME} local "$1" "$1" then --verbose local awk awk printf readonly
+	readonly grep done done local readonly 'quoted text'
+	cd /usr/bin test ${HOME} sed $(pwd) cd | && "$@" -eu local
+	local awk cd then $(pwd) "$1" && grep "$1" then cd "$@" readonly 2>/dev/null
+	test local printf /usr/bin
+	| local export cd x=1 echo
+		then --verbose "$1" ${HOME}
+${HOME} | export cd printf x=1 awk export 2>/dev/null
+cd ${HOME} local awk echo then 2>/dev/null export printf --verbose
+		x=1 awk -eu "$1" done "$@" printf awk | test
+	x=1 test echo grep ${HOME}
+--verbose 'quoted text' /usr/bin echo
+test -eu cd 2>/dev/null readonly cd printf readonly --verbose test awk /usr/bin
+		grep cd readonly awk sed && $(pwd) test awk cd then
+		export done then printf x=1 readonly grep
+	-eu "$@" cd $(pwd) x=1 printf $(pwd) printf "$1" 2>/dev/null &&
+readonly export x=1 then $(pwd) x=1 ${HOME} | 'quoted text'
+	test echo 'quoted text' --verbose local "$1" echo
+	printf "$1" readonly /usr/bin local printf "$1" echo then
+	echo | done then done then x=1 x=1 | readonly
+"$@" export 2>/dev/null grep
+	'quoted text' awk | 'quoted text'
+"$@" -eu 2>/dev/null sed printf echo 'quoted text' "$@" "$@" awk
+		x=1 grep printf | local printf awk then 'quoted text' 2>/dev/null | test
+	2>/dev/null -eu --verbose 2>/dev/null
+	$(pwd) 2>/dev/null x=1 readonly readonly printf "$@" /usr/bin | ${HOME} then 2>/dev/null
+		&& && 2>/dev/null $(pwd) test 2>/dev/null ${HOME} ${HOME}
+	then -eu /usr/bin ${HOME} then "$1" grep local && sed test x=1 cd cd awk
+		grep done test then cd done grep printf | printf
+		local awk printf $(pwd) -eu export readonly local echo $(pwd) 2>/dev/null
+	-eu /usr/bin | 'quoted text'
+		awk grep "$@" done 'quoted text'
+	/usr/bin grep --verbose awk done then then done -eu --verbose printf
+	"$@" test --verbose ${HOME}
+		-eu then --verbose printf "$@"
+	sed cd sed sed && /usr/bin --verbose echo then 'quoted text'
+x=1 local ${HOME} echo 'quoted text'
+	export && 'quoted text' x=1 printf ${HOME} ${HOME}
+	export 'quoted text' $(pwd) echo done && test --verbose "$1" --verbose cd printf
+grep cd && 2>/dev/null sed export --verbose sed done ${HOME}
+		--verbose export printf grep | -eu | $(pwd) | $(pwd) readonly
+	then local | local export "$1" x=1 'quoted text' echo then ${HOME} sed done && grep
+		printf x=1 "$@" 2>/dev/null then awk && 2>/dev/null awk 2>/dev/null | cd "$1"
+		${HOME} sed printf cd /usr/bin 'quoted text' && --verbose
+export printf cd grep export test sed sed test grep
+	--verbose sed x=1 grep cd && export local ${HOME} "$@" printf "$@" sed $(pwd)
+		cd 'quoted text' && ${HOME} && && test x=1 "$@" export 2>/dev/null
+		awk test 'quoted text' cd 2>/dev/null then
+		-eu awk $(pwd) done --verbose | | readonly && /usr/bin
+"$1" 'quoted text' 2>/dev/null x=1 done readonly local --verbose then x=1 --verbose
+		"$1" -eu test 'quoted text' cd grep ${HOME}
+	test then sed printf echo local sed awk --verbose && /usr/bin
+	printf "$1" done export printf 2>/dev/null | local export
+then echo local | printf && echo $(pwd) -eu export cd | --verbose 2>/dev/null
+"$@" echo -eu 'quoted text' echo cd export 'quoted text'
+		/usr/bin | "$1" awk test 'quoted text' export
+		$(pwd) grep "$@" -eu echo x=1 /usr/bin export $(pwd) 'quoted text' /usr/bin cd
+		"$1" done $(pwd) x=1 2>/dev/null export test "$@" x=1 cd && | echo "$1" printf
+'quoted text' -eu && awk 2>/dev/null
+	export awk /usr/bin done awk 'quoted text' -eu
+		2>/dev/null ${HOME} export done ${HOME} --verbose -eu /usr/bin done
+	$(pwd) x=1 -eu cd && 2>/dev/null "$1" "$@" readonly 'quoted text'
+		&& "$@" awk awk printf done local
+	grep ${HOME} grep test export
+	| ${HOME} x=1 'quoted text' $(pwd) sed sed export sed -eu
+	then $(pwd) grep then export echo export $(pwd) /usr/bin done local 'quoted text'
+		-eu -eu --verbose "$@" cd printf ${HOME} 'quoted text'
+		grep "$@" then "$1" awk "$@" grep && printf x=1
+		readonly sed printf cd ${HOME} done 2>/dev/null done
+	"$1" 'quoted text' echo --verbose test | export $(pwd) ${HOME} | echo cd ${HOME}
+		$(pwd) -eu /usr/bin echo echo ${HOME}
+-eu sed readonly -eu then | && --verbose && "$@" then && | readonly "$1" "$@"
+	export "$1" | 'quoted text' export
+	local sed 'quoted text' readonly -eu local
+	/usr/bin && "$1" readonly x=1 && 'quoted text'
+		readonly /usr/bin test /usr/bin /usr/bin "$1" test
+2>/dev/null awk then && | readonly
+	$(pwd) sed $(pwd) awk && -eu
+	local sed $(pwd) | && grep -eu done $(pwd) grep "$@" sed
+	x=1 /usr/bin | ${HOME} && $(pwd) readonly readonly
+	&& "$1" "$@" awk readonly 'quoted text' sed && readonly
+"$@" "$@" awk | ${HOME} then export then
+	| awk export readonly /usr/bin && awk "$1" test local $(pwd) awk awk readonly
+	then /usr/bin readonly cd
+#include c192.sh
+		done test export | | /usr/bin | x=1
+		x=1 -eu 'quoted text' cd echo --verbose sed --verbose x=1 readonly echo awk /usr/bin
+--verbose echo sed grep export -eu printf $(pwd) sed done -eu
+	grep printf | readonly sed --verbose readonly grep echo | x=1 | | cd grep 'quoted text'
+echo "$1" "$@" "$@" then test export "$1" readonly readonly
+	awk then done grep done then
+sed echo "$1" ${HOME} "$@" 2>/dev/null
+		x=1 printf readonly local x=1 local
+printf 2>/dev/null test "$1" | grep local $(pwd) --verbose
+local "$@" "$1" 2>/dev/null
+	export readonly 'quoted text' && readonly && readonly /usr/bin printf
+echo then $(pwd) /usr/bin && "$@" | sed echo readonly then "$1"
+then readonly then local 2>/dev/null export -eu test then
+"$1" awk 2>/dev/null sed cd 'quoted text' awk x=1 2>/dev/null awk test readonly
+	local export | /usr/bin 'quoted text'
+| "$1" $(pwd) --verbose
+	then cd echo cd test export
+		--verbose "$@" sed 'quoted text' x=1 "$1" | awk ${HOME} printf local
+	sed 2>/dev/null readonly
+	readonly x=1 export grep echo
+		grep printf -eu cd export export
+'quoted text' -eu cd cd -eu local cd then grep local done
+'quoted text' x=1 --verbose then local awk test 2>/dev/null
+local done cd && readonly 'quoted text' local $(pwd)
+	| /usr/bin 'quoted text' test sed local sed
+grep /usr/bin && 'quoted text' echo --verbose /usr/bin then sed export /usr/bin
+		x=1 "$1" then local done cd then
+		"$1" $(pwd) then sed test printf | "$1" | local 'quoted text' readonly
+	'quoted text' awk sed then
+		2>/dev/null awk $(pwd) -eu done "$1" awk ${HOME}
+	awk test 2>/dev/null 2>/dev/null local x=1 then x=1 sed awk /usr/bin
+		cd && x=1 cd /usr/bin echo grep cd then "$1"
+readonly "$1" readonly /usr/bin &&
+	done ${HOME} | awk grep "$@" grep x=1 readonly readonly && done
+	"$1" export printf 'quoted text' | readonly
+	then -eu cd ${HOME} printf 2>/dev/null 'quoted text' && "$@" readonly -eu cd
+		2>/dev/null | x=1 | | /usr/bin ${HOME} done | "$@" 2>/dev/null local grep $(pwd)
+	/usr/bin && /usr/bin && cd readonly
+cd /usr/bin local awk "$1" -eu echo sed test
+	'quoted text' ${HOME} printf ${HOME} printf export echo echo 2>/dev/null
+	$(pwd) sed ${HOME} x=1 | && then local /usr/bin local
+		$(pwd) readonly "$@" --verbose && /usr/bin 2>/dev/null done x=1 printf
+readonly | x=1 && "$1" grep readonly /usr/bin
+		local | sed ${HOME} 'quoted text' | then
+'quoted text' 'quoted text' export | test
+	&& test ${HOME} awk x=1 test awk x=1 done export test printf "$@" -eu
+&& cd echo local grep "$1" test grep grep echo then ${HOME} grep $(pwd) x=1
+echo $(pwd) 2>/dev/null readonly "$1" 'quoted text' "$@" readonly $(pwd)
+	&& test x=1 ${HOME} 'quoted text' awk "$@" echo && done test &&
+	readonly test sed test readonly
+&& done sed echo sed echo $(pwd)
+cd echo grep printf | grep export readonly --verbose
+echo export -eu 'quoted text' printf done "$1" local && export
+grep 'quoted text' && cd /usr/bin local ${HOME} cd then /usr/bin
+	export | readonly sed local && grep grep ${HOME} test echo
+		local done "$@" export then test cd printf --verbose "$1"
+		then printf test then "$1"
+		echo -eu && echo printf && grep echo done x=1 cd test awk
+| export && "$1" --verbose grep sed local /usr/bin 'quoted text'
+cd -eu /usr/bin grep cd sed local export printf readonly -eu x=1 export
+cd ${HOME} "$@" $(pwd) printf
+	/usr/bin grep sed $(pwd) -eu
+local grep readonly /usr/bin
+	cd awk | done test $(pwd) 2>/dev/null test --verbose
+	| grep "$1" $(pwd) -eu then test 2>/dev/null "$1" --verbose echo awk x=1 x=1
+		/usr/bin printf done -eu
+/usr/bin && local export test
+		"$@" ${HOME} done printf x=1 sed
+"$1" local printf -eu local
+		echo cd 2>/dev/null "$1" ${HOME} cd x=1 "$1" | x=1 $(pwd)
+		echo grep "$1" cd awk 'quoted text' echo echo printf
+	x=1 test "$1" /usr/bin && done sed "$@" done test grep
+		"$@" echo readonly 'quoted text' 'quoted text' "$1" echo 2>/dev/null sed printf
+	"$@" 2>/dev/null export printf awk then $(pwd) 'quoted text' test -eu
+"$1" "$@" 2>/dev/null sed done test
+2>/dev/null ${HOME} grep echo -eu
+cd && $(pwd) $(pwd) sed export awk | | grep export -eu -eu
+		"$@" 2>/dev/null $(pwd) && && -eu local
+-eu /usr/bin $(pwd) printf cd then sed printf then export test local cd
+	2>/dev/null "$1" ${HOME} /usr/bin sed
+'quoted text' readonly ${HOME} cd x=1 2>/dev/null | -eu 'quoted text' ${HOME}
+	export "$1" 2>/dev/null local "$@" 'quoted text' $(pwd) awk export readonly
+		readonly "$1" 'quoted text' grep cd -eu $(pwd)
+		cd "$1" cd | test | --verbose | done
+	sed readonly awk local cd cd done test grep cd "$1" ${HOME} local local sed
+		printf echo --verbose grep echo
+		grep | 2>/dev/null cd local 'quoted text' /usr/bin /usr/bin echo printf
+grep && local done "$1" grep echo local ${HOME}
+export printf | done &&
+"$@" readonly | export 'quoted text' export
+awk /usr/bin awk done readonly "$@" $(pwd) awk && echo echo
+	"$1" | "$1" -eu readonly awk ${HOME} then "$@" && 2>/dev/null
+$(pwd) 2>/dev/null "$1" "$1" echo ${HOME} done
+		echo echo then done done /usr/bin grep echo test --verbose awk echo
+sed export && 2>/dev/null then readonly 'quoted text'
+$(pwd) test awk readonly local $(pwd) cd && $(pwd) "$@" -eu local readonly
+cd && export awk -eu local test sed -eu
+	cd export x=1 printf 'quoted text' x=1 cd $(pwd) 'quoted text' "$1"
+	| x=1 x=1 test cd done -eu readonly 2>/dev/null 2>/dev/null
+cd printf grep test && grep printf && done "$@" x=1 --verbose 2>/dev/null
+		then done 'quoted text' done done "$1" grep "$1" printf
+		test "$@" sed local sed --verbose test then grep 2>/dev/null
+	printf local "$@" "$1" readonly printf
+printf readonly | readonly readonly x=1 ${HOME}
+	printf grep /usr/bin sed local
+		printf sed echo local -eu $(pwd)
+/usr/bin "$1" export "$1" test | awk "$1" /usr/bin
+	'quoted text' test /usr/bin echo echo then 2>/dev/null
+${HOME} cd local done local printf local | "$1" readonly x=1 --verbose echo &&
+		| && done test --verbose cd $(pwd) /usr/bin
+	cd awk --verbose 2>/dev/null test then 2>/dev/null |
+		test echo grep --verbose sed $(pwd) export echo test --verbose grep
+cd 'quoted text' export && then 2>/dev/null $(pwd) 2>/dev/null /usr/bin
+	&& cd ${HOME} done grep 2>/dev/null ${HOME} 'quoted text'
+		awk | -eu cd && echo awk sed x=1 && x=1 $(pwd) x=1 readonly --verbose -eu local
+| | export | echo "$1" x=1 grep cd | sed export export export 2>/dev/null $(pwd)
+| then | export -eu cd x=1 readonly
+	readonly done 2>/dev/null x=1 "$1" 2>/dev/null -eu /usr/bin local test local
+	"$@" sed export readonly ${HOME} | readonly done
+done sed test && $(pwd) local sed 2>/dev/null --verbose ${HOME} /usr/bin export
+	/usr/bin then test 'quoted text' "$1" sed echo
+	readonly "$@" /usr/bin ${HOME} grep export "$@"
+x=1 --verbose sed /usr/bin echo "$1" 2>/dev/null "$1" done cd then | cd local
+		sed cd 'quoted text' $(pwd) done printf printf
+then printf awk awk "$@" done local readonly
+local sed done 2>/dev/null printf echo /usr/bin && --verbose
+		done done ${HOME} x=1
+		"$1" test sed ${HOME} 2>/dev/null done /usr/bin ${HOME} done then -eu echo
+2>/dev/null "$1" export done done local cd "$@" cd "$1" grep "$1"
+	echo cd then 2>/dev/null "$@" grep &&
+2>/dev/null ${HOME} | done
+"$@" 'quoted text' awk grep awk x=1 readonly
+	test export /usr/bin then export readonly "$@" 2>/dev/null local "$1" echo awk grep
+	printf | then && 2>/dev/null readonly
+done printf 2>/dev/null --verbose && cd
+local "$@" awk --verbose "$@" /usr/bin then awk $(pwd) then then x=1 ${HOME}
+	cd cd -eu 2>/dev/null export awk awk awk sed
+	2>/dev/null cd /usr/bin "$@" "$@" --verbose "$@" 'quoted text'
+		sed test export cd | done grep awk 2>/dev/null ${HOME}
+export export "$1" awk then $(pwd) && awk local grep
+		export echo --verbose "$1" awk grep awk $(pwd) ${HOME} x=1 export $(pwd)
+		${HOME} readonly grep $(pwd)
+		x=1 then | local /usr/bin grep && printf echo awk export
+awk echo export echo awk ${HOME} export /usr/bin 2>/dev/null readonly 2>/dev/null
+	2>/dev/null 'quoted text' | $(pwd) && printf echo done grep 'quoted text'
+		sed sed /usr/bin cd readonly sed
+test printf 'quoted text' sed grep --verbose x=1 echo
+		"$1" x=1 export export && grep --verbose awk "$1" local
+| then 'quoted text' grep -eu echo printf
+done awk printf printf local 2>/dev/null | ${HOME}
+	then --verbose test -eu test awk cd | cd local
+		/usr/bin grep sed $(pwd) --verbose
+		then awk | local && $(pwd) then && local "$@" "$1" printf export
+		cd echo grep cd sed -eu export export "$1" 2>/dev/null local /usr/bin
+	then --verbose "$@" echo && echo /usr/bin | | readonly 2>/dev/null
+	${HOME} cd $(pwd) cd sed x=1 $(pwd)
+		printf cd cd /usr/bin cd echo awk echo cd | ${HOME} "$1" done x=1 awk
+| awk printf grep ${HOME} then
+sed /usr/bin | 'quoted text' --verbose
+awk echo test test x=1 $(pwd) /usr/bin $(pwd)
+	done done /usr/bin | then "$@" sed --verbose
+	x=1 export x=1 --verbose /usr/bin
+		| readonly local readonly export readonly 2>/dev/null
+		printf awk then test 'quoted text' awk x=1 ${HOME} echo "$@" 'quoted text'
+/usr/bin "$1" awk sed ${HOME}
+	then test "$1" ${HOME} export 2>/dev/null awk grep
+awk printf export 'quoted text' | | x=1 2>/dev/null | 'quoted text'
+then x=1 ${HOME} awk && readonly then /usr/bin "$@" $(pwd) /usr/bin awk
+'quoted text' sed printf "$1" echo "$1" grep echo grep ${HOME} | 2>/dev/null
+cd awk && test then x=1 -eu --verbose "$1"
+		readonly 2>/dev/null done
+		test then echo printf "$1" x=1 done printf
+	x=1 && done -eu export test export "$@" done
+		"$@" $(pwd) echo 'quoted text'
+	"$1" then "$@" then then 2>/dev/null printf | local /usr/bin
+		2>/dev/null readonly test -eu export grep -eu 'quoted text'
+		2>/dev/null -eu --verbose /usr/bin
+local awk 'quoted text'
+	-eu | $(pwd) test cd local ${HOME} export -eu awk "$@" x=1
+		echo "$@" grep test then
+		local echo "$1" export
+printf export 'quoted text' -eu
+"$1" $(pwd) printf readonly x=1 $(pwd) awk then
+&& then | x=1 echo "$@" local --verbose "$1" --verbose 'quoted text'
+echo /usr/bin 'quoted text' grep done -eu 'quoted text' export | && local
+	test && local && x=1 printf sed $(pwd) 2>/dev/null sed
+printf grep 'quoted text' 'quoted text' | && local local --verbose
+	$(pwd) /usr/bin cd && local
+	readonly printf echo readonly done -eu && ${HOME} cd ${HOME} cd && x=1 export
+	cd $(pwd) 'quoted text' cd 2>/dev/null 'quoted text' --verbose local test then
+x=1 && test --verbose awk local local --verbose awk "$1" --verbose /usr/bin
+		readonly /usr/bin --verbose printf sed cd cd x=1 awk sed grep awk 2>/dev/null
+test 2>/dev/null grep x=1 x=1 | cd -eu printf grep done export
+		echo printf test awk "$@" && x=1 "$@" "$@" x=1 ${HOME} awk "$@" done &&
+	-eu printf "$1" -eu awk
+grep "$@" 2>/dev/null then "$1" done 'quoted text'
+		test ${HOME} | && x=1 /usr/bin sed sed readonly export
+		${HOME} done | x=1 then
+	2>/dev/null && readonly "$@" && cd -eu grep echo printf
+	/usr/bin | ${HOME} 'quoted text' local readonly -eu local $(pwd) export
+	test grep awk "$@" test done
+	test readonly cd 2>/dev/null "$1"
+		sed awk --verbose printf done cd x=1 export 2>/dev/null
+		"$1" --verbose test ${HOME} /usr/bin export export
+	| | | printf /usr/bin export echo local then grep echo test
+-eu 'quoted text' "$@" printf grep 2>/dev/null export sed "$@" ${HOME}
+$(pwd) readonly x=1 export
+		x=1 echo | done "$1" export "$1" /usr/bin readonly echo "$@" sed && --verbose
+cd $(pwd) ${HOME} cd echo $(pwd)
+		test done 2>/dev/null -eu export printf echo done grep echo -eu readonly printf
+		echo | -eu x=1 ${HOME} local 2>/dev/null && "$1" cd 2>/dev/null export
+		2>/dev/null --verbose --verbose && -eu grep 'quoted text' local readonly
+		"$@" export done readonly | /usr/bin sed export ${HOME} done "$1"
+-eu sed /usr/bin echo 'quoted text'
+		2>/dev/null x=1 readonly sed ${HOME} && $(pwd) awk "$1" test readonly
+	cd sed grep cd "$1" ${HOME} "$@" cd /usr/bin echo --verbose $(pwd) 'quoted text'
+	"$1" local x=1 export export cd grep
+local --verbose then
+		echo then echo echo --verbose then sed && $(pwd) $(pwd) echo
+printf 2>/dev/null -eu | "$@" && export $(pwd) export printf
+		sed test 2>/dev/null x=1 local ${HOME} x=1 --verbose export readonly
+x=1 local -eu 'quoted text'
+		-eu /usr/bin test 2>/dev/null --verbose then readonly "$1" sed -eu | x=1 local
+| | grep then ${HOME} 2>/dev/null
+	"$@" $(pwd) --verbose && x=1 grep
+		-eu test cd ${HOME} done "$@" "$1" ${HOME}
+		then echo /usr/bin export "$@" --verbose
+/usr/bin $(pwd) sed ${HOME} 'quoted text' && -eu "$@"
+		then done x=1 2>/dev/null ${HOME} 2>/dev/null then sed
+		"$1" /usr/bin --verbose 2>/dev/null $(pwd)
+	awk local ${HOME} "$1" x=1 | local
+	test "$@" && grep 'quoted text' $(pwd) printf 2>/dev/null sed | $(pwd)
+	/usr/bin --verbose test /usr/bin
+	/usr/bin && then printf test /usr/bin sed -eu "$@"
+	then 2>/dev/null $(pwd) done test test /usr/bin
+	/usr/bin local echo then readonly sed then cd
+	export grep 2>/dev/null local grep "$1" done
+	'quoted text' -eu grep cd printf local "$1" 2>/dev/null echo 'quoted text' cd export
+	readonly "$@" -eu awk 'quoted text' sed ${HOME} ${HOME} grep then /usr/bin && readonly
+		${HOME} test --verbose readonly 'quoted text' 'quoted text'
+		done "$@" awk done printf 'quoted text' then cd awk printf sed readonly local
+		awk awk awk && -eu ${HOME} /usr/bin sed ${HOME} grep
+--verbose test local && x=1 2>/dev/null cd 'quoted text'
+		done local done ${HOME} ${HOME} sed "$@" printf
+		done 2>/dev/null echo grep | "$1" test -eu sed printf then
+	| cd | awk then | -eu readonly "$1"
+| && "$1" x=1 sed cd printf "$@" 'quoted text' grep awk then
+	&& && x=1 printf --verbose then sed 'quoted text' --verbose 2>/dev/null
+	local export echo test export
+	$(pwd) | echo local x=1
+	cd done grep done /usr/bin done readonly ${HOME} "$@" awk --verbose
+	sed $(pwd) awk 2>/dev/null /usr/bin &&
+		sed "$1" /usr/bin ${HOME} then $(pwd) /usr/bin
+		$(pwd) /usr/bin -eu ${HOME} $(pwd)
+		printf 2>/dev/null "$1" test ${HOME} cd then | grep && local -eu then
+		$(pwd) export --verbose 2>/dev/null echo ${HOME} /usr/bin | printf
+		${HOME} awk $(pwd) cd awk test sed /usr/bin 'quoted text'
+	printf grep $(pwd) | echo printf
+		$(pwd) export --verbose /usr/bin then "$1" printf --verbose local done -eu readonly
+		sed echo awk /usr/bin -eu 'quoted text' awk printf readonly | echo /usr/bin &&
+	--verbose -eu sed echo local test readonly ${HOME} export test echo
+	export --verbose ${HOME} awk 'quoted text' x=1
+2>/dev/null && test local awk done "$@" awk x=1 done
+	'quoted text' x=1 sed /usr/bin /usr/bin ${HOME} /usr/bin done $(pwd) readonly cd
+		readonly printf "$1" 2>/dev/null grep /usr/bin echo "$@" 2>/dev/null readonly awk
+		$(pwd) --verbose cd /usr/bin -eu done awk cd --verbose x=1 local
+$(pwd) readonly printf readonly && "$1" test --verbose && 'quoted text'
+	cd cd awk && printf && export
+	awk -eu test -eu sed local sed test -eu grep && test x=1 awk grep test
+	"$@" done && "$1" test done -eu printf && &&
+		local printf export printf sed 'quoted text'
+		awk x=1 'quoted text' sed done | readonly "$@"
+	| echo $(pwd) 2>/dev/null echo done -eu readonly
+${HOME} cd awk "$1" done $(pwd) $(pwd) sed
+		echo grep cd "$1" --verbose awk x=1 cd done ${HOME} /usr/bin awk
+then "$1" /usr/bin echo printf then | test done local x=1 readonly local /usr/bin
+| | x=1 printf awk x=1 'quoted text' --verbose readonly "$@" /usr/bin
+local 2>/dev/null printf $(pwd) test test test
+		sed -eu -eu $(pwd) | $(pwd) -eu then 'quoted text'
+		2>/dev/null export export
+		cd ${HOME} then grep export local | "$@"
+		export ${HOME} echo | | "$1" $(pwd) 'quoted text' ${HOME} cd done cd then awk
+		"$1" local --verbose "$1" --verbose ${HOME} "$@" printf -eu && 2>/dev/null x=1
+		export $(pwd) readonly local cd grep x=1
+cd export cd /usr/bin "$@" printf done && awk
+	awk printf awk -eu "$@" local readonly "$1" --verbose "$1" --verbose
+		printf x=1 --verbose readonly -eu cd test printf cd 2>/dev/null /usr/bin
+	--verbose "$1" | cd | "$@" && grep sed done
+		echo | grep printf 2>/dev/null sed "$@" $(pwd) readonly
+	x=1 cd echo --verbose echo && cd export grep then $(pwd) cd
+	sed ${HOME} done /usr/bin echo sed done --verbose sed && ${HOME} readonly export
+		awk local grep sed 'quoted text'
+	cd ${HOME} "$@" test cd test x=1 && then | |
+	echo grep "$@" --verbose printf then cd && readonly $(pwd) cd $(pwd)
+"$@" then | sed cd echo $(pwd) /usr/bin 'quoted text' readonly && && -eu grep
+&& cd readonly x=1 | ${HOME} grep awk -eu
+test $(pwd) 'quoted text' sed sed "$1" x=1 awk $(pwd)
+done x=1 readonly grep grep && readonly "$@" /usr/bin "$@" x=1
+export /usr/bin cd readonly /usr/bin
+		then export grep "$1" x=1 ${HOME} "$1" &&
+printf x=1 test cd test then sed sed
+then "$@" then printf 'quoted text'
+		echo --verbose x=1 local && | cd echo -eu then
+cd -eu -eu "$@" local /usr/bin -eu
+echo local then ${HOME} then /usr/bin awk 2>/dev/null grep done x=1
+	&& ${HOME} 2>/dev/null echo then sed && $(pwd)
+	readonly --verbose ${HOME} sed cd 2>/dev/null test 'quoted text'
+		cd 'quoted text' sed "$1" test local done sed test printf 'quoted text' readonly
+	echo echo then 'quoted text'
+	local -eu /usr/bin then grep cd 'quoted text' -eu export local
+/usr/bin -eu test grep --verbose awk x=1
+	/usr/bin printf "$@" --verbose then
+"$@" readonly printf printf local printf cd | local
+export --verbose x=1 "$@" $(pwd) sed printf 'quoted text' awk
+readonly readonly cd &&
+${HOME} readonly test | ${HOME}
+		printf $(pwd) grep echo echo | --verbose awk x=1 ${HOME} $(pwd) "$1" "$1"
+sed "$@" "$@" printf "$@" sed test printf done done
+	printf /usr/bin && 'quoted text' x=1 echo local local
+then 'quoted text' --verbose printf export
+		/usr/bin 'quoted text' && export -eu local
+		"$@" local --verbose ${HOME} sed
+	done cd export "$@" cd export printf /usr/bin x=1 grep
+${HOME} test -eu -eu awk && printf /usr/bin "$@"
+grep 'quoted text' sed && awk local ${HOME}
+x=1 grep local -eu printf 'quoted text' sed x=1 readonly 2>/dev/null /usr/bin
+	local /usr/bin test -eu | printf ${HOME} printf test | | "$1"
+grep && local | x=1 'quoted text' ${HOME}
+$(pwd) --verbose cd $(pwd) then $(pwd) readonly 2>/dev/null readonly
+	cd /usr/bin awk then "$1" local printf x=1 local 2>/dev/null
+		&& then readonly 2>/dev/null | /usr/bin echo $(pwd) export
+		then then sed ${HOME} cd readonly readonly
+	then echo awk "$@" 'quoted text' readonly "$1" test ${HOME} test sed && test
+	printf ${HOME} "$@" /usr/bin 'quoted text'
+	sed --verbose "$1" cd |
+		$(pwd) sed readonly -eu
+$(pwd) echo && printf -eu echo echo && $(pwd) awk 2>/dev/null
+	export test "$@" && 'quoted text' readonly ${HOME} --verbose sed 2>/dev/null
+	/usr/bin --verbose cd test printf -eu $(pwd) "$@" /usr/bin
+		--verbose awk | "$@" | x=1 cd 2>/dev/null
+		done test --verbose test | && -eu | then export -eu -eu "$@" export cd readonly
+		local local 2>/dev/null x=1 echo test 'quoted text' -eu then cd local && done
+${HOME} printf "$@" readonly -eu local sed 2>/dev/null ${HOME}
+		"$@" "$1" done x=1 echo "$@" x=1 2>/dev/null
+		export -eu sed cd 2>/dev/null
+		echo sed local /usr/bin 'quoted text' done ${HOME} x=1 ${HOME} sed
+		${HOME} x=1 "$1" done grep
+	test then test 2>/dev/null && | done
+		local $(pwd) x=1 $(pwd) | ${HOME} --verbose readonly x=1
+		-eu "$@" 'quoted text' grep
+	--verbose grep ${HOME} export
+| echo -eu $(pwd) x=1 awk local then x=1 $(pwd) grep "$@" && 'quoted text' export
+		local awk /usr/bin x=1 sed echo &&
+		done "$@" && grep "$1" done readonly readonly "$@" awk --verbose $(pwd) readonly
+		awk grep sed test $(pwd) test
+echo export cd "$@" /usr/bin test
+	| printf 2>/dev/null ${HOME}
+	cd -eu test -eu "$@" && cd printf 2>/dev/null /usr/bin
+		"$@" 2>/dev/null 2>/dev/null
+x=1 sed 2>/dev/null readonly cd $(pwd) "$1"
+	local && && && x=1 echo echo && && "$1" x=1 "$@" -eu && grep
+	then grep 2>/dev/null local local ${HOME} /usr/bin
+$(pwd) --verbose && -eu "$1" export && 'quoted text' readonly x=1 test
+		local export --verbose done awk local && x=1 2>/dev/null
+	x=1 --verbose x=1 export "$@" 2>/dev/null "$@" sed then x=1 "$@" | -eu done --verbose
+		awk ${HOME} "$@" /usr/bin export && /usr/bin "$1"
+	${HOME} "$1" | | export
+done | --verbose local ${HOME} test grep
+	--verbose /usr/bin -eu done "$1" x=1 local cd ${HOME} /usr/bin "$@" --verbose
+		cd export sed 'quoted text' echo
+		cd x=1 cd readonly 2>/dev/null test && echo $(pwd) done grep
+	$(pwd) x=1 readonly --verbose done done 2>/dev/null
+	local ${HOME} printf | then ${HOME} $(pwd) echo ${HOME} 'quoted text'
+	/usr/bin grep echo echo $(pwd) x=1 2>/dev/null printf 2>/dev/null grep -eu
+		| 'quoted text' printf "$1"
+		awk cd x=1 sed | /usr/bin local "$1" 2>/dev/null done echo sed && export
+cd awk sed | --verbose
+		awk "$@" echo done 2>/dev/null $(pwd) -eu $(pwd) | "$@" "$@" grep
+	"$@" | then export sed $(pwd) test "$1" --verbose $(pwd) grep export --verbose
+		export export "$1" awk "$1" echo done done readonly "$1" test ${HOME}
+	cd test "$1" -eu cd awk printf test x=1 cd | "$@" printf
+| x=1 echo "$1" test readonly
+	"$1" | cd | --verbose then done 2>/dev/null echo "$1" /usr/bin export
+	'quoted text' "$@" export "$1" |
+	echo grep --verbose "$@" ${HOME} cd "$@" 'quoted text'
+${HOME} readonly $(pwd) grep
+		&& 2>/dev/null awk done ${HOME} grep readonly printf grep echo
+	test && $(pwd) test "$@" 2>/dev/null "$1" cd 'quoted text'
+	printf grep then --verbose --verbose export && 'quoted text' cd then grep 'quoted text'
+	test awk 2>/dev/null "$@" 'quoted text' then
+		$(pwd) then export then printf local printf grep | 2>/dev/null
+		--verbose echo && test done 2>/dev/null export $(pwd) echo printf -eu cd x=1
+		/usr/bin "$@" 'quoted text' $(pwd) test
+'quoted text' "$1" awk then "$@" -eu | export printf export "$1" readonly grep 'quoted text'
+printf readonly sed ${HOME} -eu awk cd 'quoted text' then x=1 readonly done
+		'quoted text' $(pwd) done cd /usr/bin then "$@" sed 2>/dev/null
+'quoted text' awk ${HOME} --verbose grep cd grep ${HOME} grep -eu export
+	&& printf x=1 x=1 "$1" echo then /usr/bin awk done ${HOME} | "$@" "$1"
+		test test $(pwd) 'quoted text' $(pwd) then test done && /usr/bin
+awk export "$@" printf cd $(pwd) sed sed grep cd readonly awk ${HOME} "$@" /usr/bin
+		x=1 done cd x=1 done 'quoted text' test "$@" cd x=1 export /usr/bin ${HOME}
+	--verbose done -eu echo "$@" cd local awk done -eu /usr/bin /usr/bin echo
+	&& local printf -eu done $(pwd) /usr/bin && "$1" x=1 "$1"
+	echo 2>/dev/null $(pwd) grep "$1" && echo then --verbose awk ${HOME}
+	'quoted text' "$1" 2>/dev/null awk test then sed
+	awk test local test 2>/dev/null
+sed 2>/dev/null readonly 'quoted text' done test x=1 --verbose 2>/dev/null
+	/usr/bin /usr/bin --verbose readonly "$@" && /usr/bin ${HOME} local
+		-eu awk 'quoted text' printf | x=1 'quoted text' ${HOME} done awk echo ${HOME}
+		cd 2>/dev/null readonly | done x=1 sed ${HOME} cd 'quoted text'
+	awk ${HOME} | | "$@" readonly x=1 $(pwd) echo printf then export "$@"
+		echo then export readonly $(pwd) "$1" && readonly
+'quoted text' | awk sed local sed readonly readonly 'quoted text' "$1"
+/usr/bin "$@" ${HOME} awk local $(pwd) /usr/bin readonly 2>/dev/null
+		echo readonly readonly x=1 export && -eu readonly
+	| printf grep -eu awk && "$@" --verbose ${HOME} test x=1 echo
+	'quoted text' then /usr/bin test /usr/bin echo | && 'quoted text' cd -eu
+then local sed && | local | ${HOME} echo grep printf echo 2>/dev/null
+2>/dev/null | "$1" /usr/bin
+		done 'quoted text' done printf readonly -eu
+		--verbose sed awk -eu awk $(pwd) ${HOME} --verbose
+		x=1 "$@" /usr/bin awk $(pwd) "$1" "$1" grep grep x=1 sed "$1" x=1
+	echo -eu "$1" | 'quoted text' | | "$@" done cd 'quoted text' readonly export
+	$(pwd) $(pwd) $(pwd) echo ${HOME}
+	| "$1" done "$1" printf 'quoted text' x=1 -eu grep echo echo "$@" awk /usr/bin
+	2>/dev/null | x=1 2>/dev/null 2>/dev/null
+	2>/dev/null ${HOME} awk "$1" "$@" --verbose printf readonly "$@" x=1 /usr/bin
+	-eu readonly printf $(pwd)
+	printf 2>/dev/null printf /usr/bin awk test
+printf echo --verbose echo && awk cd -eu /usr/bin then &&
+local $(pwd) x=1 'quoted text' -eu -eu x=1 ${HOME} test
+		x=1 -eu done echo "$1" --verbose "$1" -eu x=1 && "$@" echo --verbose echo
+--verbose printf 2>/dev/null && "$@" $(pwd) "$1" awk test local
+		cd 2>/dev/null done x=1 --verbose $(pwd) printf local echo export -eu sed then
+export awk /usr/bin &&
+	test "$@" printf -eu ${HOME} printf "$@" readonly
+		| sed && "$@" 2>/dev/null --verbose --verbose done test
+sed grep then -eu x=1 && readonly "$@" && && printf "$1" --verbose -eu then awk
+		$(pwd) printf x=1 sed then echo -eu test /usr/bin 'quoted text' export -eu local
+		/usr/bin export echo x=1 "$@" local
+		2>/dev/null readonly "$1" echo x=1 grep
+| | 'quoted text' 2>/dev/null export
+echo printf "$@" --verbose | local cd awk grep readonly done -eu export --verbose
+	cd | x=1 ${HOME} x=1 x=1 readonly
+		/usr/bin --verbose 'quoted text' 'quoted text' readonly "$@" cd && grep local x=1
+	test --verbose ${HOME} readonly cd awk test cd then
+sed printf sed sed --verbose -eu
+		-eu x=1 sed awk cd ${HOME} then 2>/dev/null "$1" cd "$1"
+	done "$1" /usr/bin printf then |
+x=1 test echo && done | done 2>/dev/null export | 'quoted text' 2>/dev/null
+		"$@" done --verbose | printf then printf awk "$@" echo sed
+	-eu ${HOME} "$1" then --verbose
+	&& awk test "$1" awk readonly local ${HOME} /usr/bin
+grep | echo readonly "$@" $(pwd) printf sed cd
+		-eu printf "$@" local
+	printf awk 2>/dev/null
+	awk | then "$@" | local export awk 2>/dev/null cd cd test awk echo && && 'quoted text'
+		'quoted text' "$@" |
+'quoted text' cd cd export "$1" readonly 2>/dev/null readonly | "$@"
+	--verbose echo awk 'quoted text'
+	&& cd local done echo 2>/dev/null sed ${HOME} 'quoted text'
+		then --verbose then "$1" grep 'quoted text'
+echo export readonly $(pwd) grep ${HOME} --verbose local test -eu local
+awk awk then cd | 'quoted text'
+then /usr/bin readonly cd export export sed /usr/bin test /usr/bin
+test ${HOME} awk then -eu && echo -eu -eu
+	| --verbose --verbose | awk test local export "$1" --verbose | done readonly
+		"$@" awk $(pwd) done grep awk awk local echo ${HOME} 'quoted text'
+2>/dev/null /usr/bin export printf -eu then export awk 2>/dev/null
+echo done 2>/dev/null "$1" 2>/dev/null printf cd echo && sed done 2>/dev/null
+		--verbose done test echo ${HOME} then 'quoted text' 2>/dev/null cd awk
+		'quoted text' export | "$@" grep
+		"$@" | grep done --verbose
+		then cd | sed awk test 2>/dev/null x=1 | ${HOME} local local x=1 $(pwd) sed
+$(pwd) | -eu readonly 'quoted text' "$1" awk /usr/bin
+	2>/dev/null printf | then awk test ${HOME} cd printf readonly local 2>/dev/null
+		echo -eu && ${HOME} /usr/bin cd --verbose done | readonly x=1 test
+then 2>/dev/null readonly printf
+	test "$1" readonly done /usr/bin | "$@" done local test
+then ${HOME} -eu "$1"
+		&& local | grep readonly readonly "$@" printf --verbose
+cd "$1" -eu printf cd readonly --verbose "$@" local test printf
+		x=1 readonly done ${HOME} -eu | echo echo done cd $(pwd) cd /usr/bin --verbose
+	${HOME} --verbose | -eu | ${HOME} printf |
+		sed test -eu grep export readonly -eu 2>/dev/null then
+cd readonly "$1" done then printf echo -eu awk
+		2>/dev/null $(pwd) $(pwd) test "$@" sed && echo echo then test | /usr/bin &&
+then cd cd export $(pwd) cd sed && test test printf &&
+	test sed "$@" x=1 then echo && ${HOME} then | "$@" printf
+$(pwd) "$@" readonly 2>/dev/null
+		export test printf echo sed ${HOME} done local -eu readonly
+		grep then sed printf sed awk awk 'quoted text'
+'quoted text' grep --verbose cd /usr/bin $(pwd) 'quoted text' echo export /usr/bin
+test 2>/dev/null 2>/dev/null local printf $(pwd) 'quoted text' test
+		readonly cd sed --verbose test "$@" "$@" "$1" -eu cd awk local &&
+		done 'quoted text' --verbose | local done echo done grep echo --verbose printf
+	sed local 'quoted text' test sed x=1 x=1 done then x=1 sed ${HOME}
+grep /usr/bin printf grep readonly
+		then then then echo test x=1 echo && | echo --verbose readonly 2>/dev/null 2>/dev/null
+	awk test then grep printf 2>/dev/null | awk awk 'quoted text'
+	echo export grep then --verbose ${HOME}
+		| readonly then grep 'quoted text' local "$1" sed $(pwd)
+	/usr/bin x=1 sed --verbose sed 2>/dev/null -eu 'quoted text'
+--verbose test && 'quoted text' echo test grep | readonly |
+		-eu echo && 'quoted text' sed -eu readonly readonly /usr/bin
+		cd $(pwd) test -eu x=1 readonly
+	printf grep "$@" echo $(pwd) /usr/bin && printf 2>/dev/null
+"$1" "$@" && then export /usr/bin test
+	done | $(pwd) done grep x=1 grep 'quoted text' awk done 'quoted text' --verbose
+| x=1 x=1 grep grep test /usr/bin readonly
+		'quoted text' done printf
+	${HOME} 'quoted text' local "$@" test grep echo 2>/dev/null printf
+		echo --verbose -eu --verbose sed ${HOME} test x=1 | 2>/dev/null $(pwd) awk
+		sed "$@" --verbose 'quoted text' printf awk sed
+cd printf awk echo x=1 /usr/bin "$1" x=1 test
+echo "$@" "$1" x=1 printf grep sed x=1 then 'quoted text'
+		readonly | echo && printf 'quoted text' grep | 2>/dev/null
+	2>/dev/null grep "$@" export | printf printf 'quoted text'
+		test echo grep -eu printf then done --verbose grep /usr/bin echo
+	-eu --verbose "$@" x=1 && 'quoted text' done 'quoted text' x=1 "$1"
+		x=1 sed $(pwd) readonly grep then 'quoted text' printf cd readonly
+	2>/dev/null $(pwd) 2>/dev/null 2>/dev/null
+		awk printf awk sed then readonly grep
+export grep echo -eu 'quoted text' printf --verbose 'quoted text' echo grep
+	echo 2>/dev/null echo awk 2>/dev/null
+		$(pwd) export grep done
+export cd sed $(pwd) echo cd grep
+	sed "$1" ${HOME} "$@" $(pwd) $(pwd) $(pwd)
+	'quoted text' -eu && ${HOME} echo export printf readonly
+		${HOME} done readonly && "$@" cd $(pwd) 'quoted text' "$@" printf local local
+test -eu sed echo | test $(pwd) | done "$1" test readonly export -eu $(pwd) then
+-eu then printf --verbose
+then x=1 x=1 local grep then 2>/dev/null readonly printf
+		"$@" ${HOME} sed then test "$1" -eu "$1"
+		echo --verbose test grep "$1" done then local /usr/bin 2>/dev/null
+	/usr/bin | awk cd then test $(pwd) grep then grep
+"$1" done -eu -eu --verbose local cd --verbose sed 2>/dev/null
+readonly 2>/dev/null && ${HOME} -eu echo cd 'quoted text' "$1" -eu 2>/dev/null
+		cd local cd && $(pwd) awk && 2>/dev/null ${HOME} 'quoted text'
+		grep -eu sed grep | readonly sed echo $(pwd) echo done 'quoted text' --verbose
+		then x=1 | | --verbose | local
+	local "$@" sed local echo then
+		&& | && echo readonly "$1" sed printf
+export sed test | && printf test
+"$@" && "$1" -eu test readonly local --verbose
+		local done cd --verbose $(pwd) | $(pwd) readonly readonly readonly
+	'quoted text' "$@" echo export sed cd 'quoted text' $(pwd)
+sed $(pwd) test "$@" printf echo printf && done grep --verbose "$@"
+		test /usr/bin export 2>/dev/null test printf ${HOME} cd ${HOME}
+awk cd printf x=1 cd printf then x=1 'quoted text' $(pwd) printf $(pwd)
+	cd $(pwd) local /usr/bin ${HOME} cd && echo -eu cd /usr/bin echo 2>/dev/null
+	${HOME} 2>/dev/null && ${HOME} 'quoted text' awk $(pwd) /usr/bin
+		-eu sed then test | | test | test
+	sed sed grep $(pwd) echo cd printf done sed
+2>/dev/null local "$@" 'quoted text' printf printf
+		export export /usr/bin then "$@" echo x=1 sed cd printf $(pwd) /usr/bin grep
+&& -eu "$1" readonly /usr/bin echo --verbose local echo
+		2>/dev/null awk test x=1
+	export awk readonly done local readonly 2>/dev/null --verbose
+	2>/dev/null ${HOME} -eu printf echo test cd x=1
+	local $(pwd) "$1" && grep then | | echo |
+	--verbose echo echo awk "$@" test -eu local "$@" awk -eu export ${HOME}
+sed 'quoted text' -eu | -eu 2>/dev/null local "$@" export x=1 readonly --verbose
+		awk | "$1" /usr/bin ${HOME} cd "$1" x=1
+awk -eu --verbose x=1 ${HOME} /usr/bin local
+then -eu printf awk -eu sed echo
+	test ${HOME} done -eu sed awk 'quoted text' grep -eu sed readonly
+		"$1" | local "$@" then cd grep "$1" 'quoted text' printf "$@" awk ${HOME}
+-eu ${HOME} ${HOME} sed --verbose
+		$(pwd) sed grep 2>/dev/null local -eu "$@" $(pwd)
+		--verbose printf done "$1" 'quoted text'
+local -eu done | 2>/dev/null awk && sed && 'quoted text' && printf
+cd grep done then test -eu "$@" echo echo cd
+$(pwd) then readonly "$1" local "$1" 'quoted text'
+		-eu | done cd --verbose then grep x=1 test -eu
+grep ${HOME} readonly then --verbose cd grep "$1"
+	'quoted text' $(pwd) readonly test | -eu local 'quoted text' cd local --verbose
+x=1 then ${HOME} printf done && ${HOME} "$1" x=1 then then local
+	${HOME} export && 2>/dev/null ${HOME}
+		"$@" done readonly && cd done x=1 grep sed local --verbose
+		${HOME} test --verbose awk cd sed "$1"
+${HOME} 'quoted text' | export "$@" "$1" awk ${HOME} cd then readonly
+printf test "$@" local printf export x=1 readonly -eu && -eu ${HOME} "$@" "$1"
+	-eu "$@" grep x=1 readonly test "$@" sed test 'quoted text' then x=1 ${HOME}
+		$(pwd) echo sed echo /usr/bin test x=1 x=1 cd printf done export $(pwd) /usr/bin
+local sed && 2>/dev/null "$@" done $(pwd) printf ${HOME} test 'quoted text'
+	echo "$1" 2>/dev/null | then sed then then then echo | grep
+	done $(pwd) awk local "$@" sed -eu ${HOME} 2>/dev/null printf test test local
+		| echo 'quoted text' "$@" /usr/bin x=1 awk
+		2>/dev/null echo sed echo test echo sed awk test x=1
+		x=1 local -eu 'quoted text' readonly done -eu ${HOME} "$1" 'quoted text' test
+		grep then ${HOME} "$1" local
+"$@" /usr/bin "$@" 2>/dev/null grep echo grep then grep && -eu 'quoted text'
+	test 'quoted text' cd -eu local --verbose sed "$1" --verbose sed
+	test -eu grep then export --verbose readonly awk 2>/dev/null
+	printf export -eu --verbose $(pwd) readonly 'quoted text' $(pwd) -eu "$1" grep $(pwd)
+		printf local done && sed printf local awk then awk "$1" && --verbose /usr/bin
+echo then && export done test $(pwd) && "$1"
+done 2>/dev/null /usr/bin printf export "$1" "$@" test
+readonly test ${HOME} readonly /usr/bin "$1" awk readonly
+	local echo && && awk ${HOME} export echo 2>/dev/null | echo echo then 'quoted text'
+	awk "$@" test awk grep test "$@" 'quoted text'
+	x=1 "$@" "$1" test export grep --verbose | x=1 --verbose | | "$1" $(pwd)
+		then test | ${HOME} export
+grep | "$1" cd sed then then -eu /usr/bin "$@" "$@" done done printf -eu -eu
+sed 'quoted text' test echo 'quoted text' /usr/bin printf $(pwd) sed x=1 --verbose
+'quoted text' printf echo
+"$@" && /usr/bin cd "$@" readonly export local cd -eu awk "$@" local
+		printf 'quoted text' -eu "$@" --verbose /usr/bin "$1" printf test $(pwd)
+	--verbose printf && 2>/dev/null
+		"$@" readonly test awk ${HOME} -eu export then
+	x=1 /usr/bin export && /usr/bin printf 2>/dev/null
+readonly test ${HOME} $(pwd) readonly /usr/bin export
+readonly then done x=1 2>/dev/null printf
+	local "$@" then | cd grep
+	2>/dev/null then x=1 2>/dev/null
+--verbose x=1 "$@" awk $(pwd) 'quoted text' 2>/dev/null x=1 export x=1 test
+	export awk 'quoted text'
+"$1" sed readonly "$@" test test local local export x=1 printf
+$(pwd) grep /usr/bin -eu 'quoted text' echo "$@" /usr/bin 2>/dev/null awk &&
+done x=1 sed cd grep x=1 --verbose done grep $(pwd) -eu -eu
+-eu local done "$@" printf grep
+		/usr/bin /usr/bin | echo then printf
+awk /usr/bin sed done awk printf --verbose "$@" readonly && "$@" -eu --verbose
+		-eu readonly export done --verbose "$@"
+x=1 done 'quoted text' "$@" && echo 2>/dev/null done sed done sed printf
+/usr/bin 'quoted text' awk 'quoted text' /usr/bin "$1" --verbose grep awk x=1 cd
+	local done cd printf | awk ${HOME} done local cd
+printf then export awk /usr/bin readonly cd printf cd grep && "$1" --verbose
+		readonly then | | done && awk sed printf
+		grep printf --verbose && "$@" |
+		x=1 then export 'quoted text'
+	test awk cd sed grep && /usr/bin "$@" 'quoted text' $(pwd) test awk "$@" sed echo
+	/usr/bin --verbose echo printf ${HOME}
+"$@" test sed && x=1 readonly -eu 2>/dev/null
+	grep awk grep -eu local ${HOME} x=1 printf printf then | awk
+		${HOME} 'quoted text' ${HOME} test -eu grep "$1" local "$@" local 2>/dev/null ${HOME}
+echo grep && 2>/dev/null then
+then readonly grep printf
+"$@" "$@" done /usr/bin "$1" then printf echo x=1 grep done && test /usr/bin
+		cd $(pwd) echo echo /usr/bin printf
+grep "$@" ${HOME} local cd ${HOME} grep awk readonly then "$@" grep
+		"$1" printf $(pwd) && cd -eu "$1" local "$@" done cd --verbose
+	2>/dev/null grep --verbose 2>/dev/null 'quoted text' local $(pwd) grep readonly
+'quoted text' "$1" done export && --verbose cd local
+		printf 2>/dev/null echo cd local readonly awk "$@" test export
+x=1 then grep readonly 'quoted text' "$@" ${HOME}
+-eu 2>/dev/null done | export grep test 'quoted text' cd then
+		x=1 export && printf awk cd sed $(pwd) printf "$1" local -eu --verbose
+cd export readonly x=1 readonly -eu --verbose /usr/bin sed test
+"$@" /usr/bin cd /usr/bin 2>/dev/null local echo local done
+${HOME} | 2>/dev/null awk ${HOME}
+		readonly && "$1" "$1"
+"$@" 'quoted text' local ${HOME}
+cd export then ${HOME} done 2>/dev/null ${HOME} echo
+		2>/dev/null 2>/dev/null 'quoted text' "$@" 'quoted text' printf
+	2>/dev/null done cd readonly
+	test awk echo "$@" "$1" echo "$1" && "$1" ${HOME} readonly
+	awk ${HOME} printf "$1" -eu then
+readonly /usr/bin 2>/dev/null "$1" echo "$1" echo && "$@" done -eu
+then local --verbose x=1 | 2>/dev/null --verbose 2>/dev/null
+	local echo sed --verbose echo printf sed then awk echo "$@" && /usr/bin sed export
+'quoted text' "$@" "$@" "$@" ${HOME} export 'quoted text' echo local
+		cd x=1 grep readonly then then
+		export | sed sed x=1 test test -eu
+		"$@" echo --verbose && cd sed $(pwd) 2>/dev/null done
+		echo x=1 test x=1 grep -eu | test "$1" 'quoted text' awk 2>/dev/null
+		cd --verbose test awk $(pwd) cd && awk sed export
+	test | cd then printf local awk cd sed 2>/dev/null export
+	| ${HOME} printf 'quoted text' then test
+	echo $(pwd) awk "$1" printf printf x=1 | | 'quoted text' --verbose $(pwd)
+		'quoted text' 'quoted text' x=1 done printf $(pwd) --verbose /usr/bin --verbose
+	export && x=1 sed $(pwd)
+	local then awk sed 'quoted text' cd local sed | -eu printf test && /usr/bin
+		grep then x=1 echo done export readonly
+	x=1 local awk x=1 grep && local --verbose
+	done cd export "$1" local
+		"$@" ${HOME} --verbose && sed --verbose $(pwd)
+	grep test x=1 -eu echo 'quoted text'
+-eu "$1" ${HOME} "$1" readonly cd local && --verbose test x=1 $(pwd)
+cd export done 2>/dev/null "$1" "$1" test test then $(pwd)
+		printf 2>/dev/null echo ${HOME} done awk "$@" ${HOME} grep
+	echo 'quoted text' cd readonly echo sed then && "$@" && printf "$@" x=1 echo
+		/usr/bin grep 'quoted text' test printf 2>/dev/null
+| local awk "$@" 2>/dev/null 2>/dev/null /usr/bin /usr/bin
+		local 'quoted text' && grep x=1 cd then 2>/dev/null done
+	"$1" done done readonly export | x=1 local test echo awk &&
+2>/dev/null | $(pwd) "$1" then x=1 | test -eu printf done echo printf
+	${HOME} done export then grep "$1" ${HOME} echo awk
+		export ${HOME} -eu printf $(pwd) awk export 2>/dev/null $(pwd)
+	done done done && sed /usr/bin local readonly
+		awk sed | "$@" awk printf awk grep x=1 x=1 && cd
+		/usr/bin awk test 'quoted text' awk echo printf echo | readonly --verbose
+	-eu 2>/dev/null then then "$@"
+-eu "$@" readonly export awk
+		echo && grep cd grep "$@" printf -eu echo then "$@" "$@" readonly -eu 2>/dev/null
+	'quoted text' readonly $(pwd) readonly cd then cd | --verbose printf
+		"$@" /usr/bin && $(pwd)
+"$1" export 'quoted text' local 2>/dev/null export printf test "$1" $(pwd)
+then grep --verbose test
+echo printf test x=1 $(pwd) 2>/dev/null test && -eu test /usr/bin local
+test export | then export --verbose sed -eu printf
+--verbose /usr/bin "$1" sed cd && cd printf printf "$@" && &&
+	sed echo echo x=1 cd awk echo | echo test --verbose "$@"
+		$(pwd) test "$@" "$@" && readonly
+export done done && echo readonly --verbose "$1" awk done export
+		echo /usr/bin done /usr/bin -eu
+/usr/bin grep | done cd grep export
+	echo sed -eu grep sed then done && "$1" -eu sed
+	-eu local printf && x=1 x=1 cd -eu 2>/dev/null cd test
+		${HOME} local cd 'quoted text' /usr/bin cd test export "$1" --verbose test
+then export local x=1 cd echo | local echo 2>/dev/null
+	"$1" then && awk "$1" 2>/dev/null done | sed
+	| -eu $(pwd) grep awk | then $(pwd) | sed 2>/dev/null $(pwd) 'quoted text'
+'quoted text' export --verbose && done grep && awk 2>/dev/null 'quoted text' done
+		"$1" 'quoted text' awk "$1" ${HOME} echo test printf "$@" "$1" test echo
+	-eu sed test | ${HOME} --verbose
+		2>/dev/null then local | cd cd test "$1" 'quoted text'
+/usr/bin export grep awk 'quoted text' | sed cd done readonly export 'quoted text'
+	printf awk then "$@" x=1 done readonly --verbose /usr/bin printf
+		-eu echo x=1 'quoted text' then "$1"
+done echo local && "$1" local "$1" sed 2>/dev/null then cd ${HOME} $(pwd) | ${HOME}
+	x=1 echo export local "$1"
+	echo ${HOME} export && /usr/bin printf printf test && sed awk "$1" "$1" echo
+then "$@" grep export && "$1" sed export --verbose
+	'quoted text' done then $(pwd) | awk
+done then && 2>/dev/null
+	test done grep done | readonly awk "$@" local 2>/dev/null
+echo echo 2>/dev/null | export "$1" local
+		done | "$1" done $(pwd) /usr/bin sed test -eu /usr/bin grep then -eu local
+readonly "$1" "$@" export local x=1 $(pwd) sed echo ${HOME}
+	export readonly test awk awk
+printf cd export 2>/dev/null echo -eu test "$1" --verbose sed x=1
+		-eu local readonly test export sed test && "$@" -eu $(pwd) test awk done /usr/bin
+	"$@" test readonly done /usr/bin
+	${HOME} 2>/dev/null export
+-eu | "$@" "$@" test ${HOME} $(pwd) local
+		awk /usr/bin "$1" "$@" x=1 $(pwd) awk export local &&
+sed x=1 grep $(pwd) /usr/bin echo cd awk x=1 then awk readonly --verbose /usr/bin
+"$@" 2>/dev/null printf "$1" awk /usr/bin done ${HOME}
+		grep 2>/dev/null /usr/bin printf --verbose $(pwd) printf 'quoted text'
+	/usr/bin echo export then $(pwd) awk readonly "$@" "$1" x=1 && x=1
+-eu test ${HOME} export export export echo local sed then done printf
+		done local 2>/dev/null "$@" 'quoted text'
+		readonly awk | export local test grep -eu test 2>/dev/null
+cd test /usr/bin export echo | test -eu $(pwd) /usr/bin --verbose | sed
+		readonly $(pwd) printf -eu | test echo echo "$1" readonly --verbose cd readonly
+	done awk "$@" "$1" printf "$@"
+&& $(pwd) grep ${HOME} 2>/dev/null x=1 "$1"
+readonly ${HOME} && readonly ${HOME} done "$1" export
+	-eu sed echo printf | --verbose
+	'quoted text' /usr/bin && cd
+		| --verbose done ${HOME} then local sed export printf /usr/bin | "$1" export awk
+		'quoted text' done -eu 'quoted text' 2>/dev/null $(pwd)
+export done $(pwd) ${HOME} x=1
+		test -eu && x=1 readonly
+${HOME} readonly && echo awk grep $(pwd) "$1" done
+test cd $(pwd) export /usr/bin then
+	${HOME} "$@" && grep $(pwd) | local x=1 -eu /usr/bin x=1 awk local ${HOME} local
+x=1 && local echo $(pwd) export --verbose | grep ${HOME} --verbose
+$(pwd) --verbose then done echo
+readonly sed local printf 'quoted text' echo awk then
+"$1" sed --verbose grep $(pwd)
+	echo -eu 'quoted text' "$@" cd ${HOME} --verbose done x=1 "$@"
+--verbose readonly 2>/dev/null && $(pwd) printf
+readonly local readonly test
+		echo -eu 2>/dev/null x=1 'quoted text'
+		local "$@" 2>/dev/null 2>/dev/null | /usr/bin $(pwd) --verbose 'quoted text'
+		export ${HOME} printf /usr/bin echo then x=1 ${HOME}
+		local --verbose "$1" --verbose /usr/bin /usr/bin awk && x=1 local
+${HOME} done x=1 grep test | then
+test printf export echo "$@" local echo x=1 done printf
+		--verbose 2>/dev/null readonly readonly test echo &&
+"$1" test test local export printf then grep --verbose sed printf --verbose
+	/usr/bin printf then --verbose
+-eu && -eu awk done -eu
+		done export sed -eu export -eu $(pwd) | echo echo local $(pwd) local
+		&& test | "$@" then done /usr/bin readonly x=1 export 'quoted text' x=1 awk
+	cd --verbose --verbose $(pwd) export cd echo printf | then local
+cd | /usr/bin && cd grep 2>/dev/null x=1 /usr/bin echo "$@" | sed "$1" "$@" "$1"
+/usr/bin "$1" x=1 grep --verbose $(pwd) test
+		test export readonly | 'quoted text' -eu cd sed awk echo "$1" awk
+done export && "$@" then sed && "$1" local
+&& ${HOME} then cd cd awk done /usr/bin local readonly -eu echo /usr/bin
+echo "$1" "$1" $(pwd) local x=1 $(pwd) "$@" 'quoted text' then awk sed
+		"$1" /usr/bin done readonly readonly grep grep | 'quoted text'
+		2>/dev/null printf "$1" awk test local --verbose
+		&& awk -eu readonly export "$@"
+printf "$1" && $(pwd) readonly ${HOME} printf "$@" 'quoted text'
+		grep "$@" awk awk readonly | | "$@" 2>/dev/null test grep readonly test cd test
+	printf readonly -eu 'quoted text' grep local
+		x=1 test local printf grep sed done done "$1" $(pwd) sed sed readonly sed cd test
+	&& 2>/dev/null "$1" x=1 export grep --verbose 'quoted text' && 'quoted text'
+	--verbose /usr/bin -eu readonly
+local export $(pwd) && /usr/bin then && ${HOME} then
+sed export cd --verbose awk | test -eu awk /usr/bin awk $(pwd) local
+$(pwd) -eu then | && --verbose "$@" x=1 /usr/bin ${HOME}
+/usr/bin export awk readonly /usr/bin x=1 awk export --verbose && /usr/bin export
+| $(pwd) && 2>/dev/null $(pwd) local
+export done && ${HOME} -eu then
+x=1 $(pwd) $(pwd) "$@" export readonly /usr/bin x=1 echo test
+test -eu x=1 cd -eu $(pwd)
+	readonly "$1" 2>/dev/null x=1 "$@"
+test 2>/dev/null readonly "$@"
+	cd printf export cd export printf "$@" | 2>/dev/null then then
+		2>/dev/null | sed "$@"
+		2>/dev/null x=1 then printf sed local -eu --verbose test
+		then --verbose $(pwd) x=1 $(pwd) sed | export cd echo echo done 'quoted text'
+| "$1" && x=1 awk done --verbose
+		then x=1 test local done
+	'quoted text' $(pwd) printf "$1" -eu echo | echo "$@" done
+		"$1" test "$@" 'quoted text'
+		printf echo then readonly /usr/bin -eu then sed "$1" "$@" sed printf -eu echo
+	| awk "$@" local then "$1" then local $(pwd) "$1" test sed cd export awk "$1" awk
+"$@" /usr/bin test export --verbose x=1 x=1 && -eu x=1
+export echo sed -eu /usr/bin && grep test export
+printf -eu echo 'quoted text'
+	'quoted text' grep $(pwd)
+	| "$@" /usr/bin --verbose "$@" "$@" x=1 x=1 "$@" export awk
+		"$1" local test export readonly $(pwd) "$@" readonly cd then $(pwd)
+| "$@" readonly x=1 $(pwd) "$1" $(pwd) 'quoted text' done printf
+	done echo grep "$@" 'quoted text' ${HOME} test then
+grep sed "$@" then awk "$1" x=1 --verbose
+local -eu echo then x=1 local x=1 "$@" | cd "$@" 2>/dev/null
+		export 2>/dev/null done && /usr/bin 2>/dev/null printf && && x=1 'quoted text'
+		then printf $(pwd) 2>/dev/null test 'quoted text'
+		"$1" test readonly x=1 --verbose 'quoted text' |
+	--verbose readonly awk sed 2>/dev/null
+	-eu echo /usr/bin x=1 | test --verbose --verbose then /usr/bin sed grep
+${HOME} echo 'quoted text' local echo cd "$@" 'quoted text' local
+	| -eu done sed local awk 'quoted text' | $(pwd) printf "$1" x=1 x=1
+	--verbose sed -eu -eu readonly | /usr/bin && done done /usr/bin
+	&& /usr/bin -eu done test awk && cd && "$@" "$1" echo local ${HOME} export local
+export readonly -eu cd 2>/dev/null
+export && awk -eu "$@" sed local $(pwd)
+	"$1" 'quoted text' local -eu -eu "$@" then awk
+		done then ${HOME} $(pwd) "$@" done local
+readonly awk /usr/bin "$1" -eu 2>/dev/null && ${HOME}
+	printf -eu echo /usr/bin -eu echo -eu x=1 readonly | local awk /usr/bin
+		then echo cd export test && grep readonly cd
+	test && done 2>/dev/null cd | export then && done "$@" $(pwd) --verbose awk
+		cd local export $(pwd) printf echo "$1" printf && -eu
+echo grep && | then done readonly
+		then printf grep test ${HOME} echo x=1 echo /usr/bin sed
+		sed echo --verbose && -eu echo sed
+		sed --verbose && echo export 'quoted text' awk
+	--verbose ${HOME} awk -eu readonly
+		"$@" | cd --verbose /usr/bin export printf /usr/bin local awk then
+--verbose echo sed cd 2>/dev/null
+		export local "$@" echo then x=1 "$1" "$1" "$1" --verbose ${HOME} export
+x=1 -eu cd -eu done /usr/bin -eu readonly awk "$1" --verbose done
+	$(pwd) ${HOME} x=1 printf readonly --verbose
+"$@" grep | $(pwd) test $(pwd) test cd awk --verbose 'quoted text'
+		--verbose --verbose --verbose local | --verbose "$@" $(pwd) 2>/dev/null
+echo export 2>/dev/null then "$@" --verbose awk awk echo then echo printf
+	test "$1" grep "$1" test printf
+	-eu | --verbose x=1 && grep export printf then
+	&& printf done readonly sed | awk 2>/dev/null
+test then -eu 'quoted text' then awk &&
+		sed | awk "$@" --verbose export grep | 2>/dev/null -eu test
+awk then then /usr/bin export 2>/dev/null export printf
+		local readonly readonly x=1 x=1 awk sed
+	awk then 2>/dev/null export 'quoted text'
+	2>/dev/null 2>/dev/null export && echo
+grep ${HOME} 'quoted text'
+	-eu /usr/bin grep $(pwd) -eu awk echo grep export then -eu sed
+$(pwd) printf echo -eu 'quoted text' /usr/bin
+	2>/dev/null $(pwd) test --verbose "$1" echo --verbose $(pwd) 2>/dev/null
+	readonly 2>/dev/null --verbose --verbose |
+printf awk test grep ${HOME} --verbose local "$@" sed sed --verbose 2>/dev/null
+	local 'quoted text' | grep echo export && ${HOME} --verbose export
+awk | -eu echo cd && 'quoted text'
+x=1 && | readonly readonly "$@" local done | local
+		--verbose && "$@" readonly readonly export --verbose
+	echo local awk sed sed x=1 x=1 done then "$@" cd ${HOME} "$1"
+readonly done && readonly "$1"
+	--verbose awk then echo "$1" "$@" sed $(pwd) 2>/dev/null
+${HOME} local | printf 'quoted text' $(pwd) awk then "$@" &&
+grep then "$@" readonly 'quoted text' test "$1" "$1" 'quoted text' test then done
+		readonly readonly | cd test
+echo && /usr/bin "$1" awk export ${HOME}
+	cd done 2>/dev/null cd "$1" $(pwd) done
+--verbose 'quoted text' local | readonly test 2>/dev/null
+	'quoted text' "$1" grep printf --verbose
+		'quoted text' readonly "$@" then "$@" done grep "$@" then -eu
+x=1 test grep export && "$@" && 'quoted text'
+| /usr/bin x=1 "$@" $(pwd) sed printf then cd echo "$1" done $(pwd) -eu done
+		export | sed export 'quoted text'
+$(pwd) then sed ${HOME} printf /usr/bin -eu
+		"$1" 'quoted text' $(pwd) sed 'quoted text' x=1 then test export
+x=1 x=1 -eu done | -eu printf /usr/bin readonly awk --verbose && readonly local
+| $(pwd) | sed echo &&
+		"$@" export "$1" x=1 $(pwd) grep "$@" --verbose 'quoted text' readonly
+	"$1" 2>/dev/null grep printf
+		2>/dev/null awk readonly /usr/bin -eu awk 'quoted text'
+	"$1" 2>/dev/null test 'quoted text' awk cd 2>/dev/null $(pwd) -eu cd --verbose
+		"$1" sed 2>/dev/null cd $(pwd) printf
+	'quoted text' export "$@" "$1" --verbose 2>/dev/null
+--verbose then sed 'quoted text' awk grep export "$@" x=1 export printf local
+awk awk 2>/dev/null done then --verbose then ${HOME} && sed -eu 'quoted text' --verbose
+"$@" readonly /usr/bin
+	awk echo | grep readonly echo sed grep $(pwd) -eu ${HOME} sed
+	"$@" echo test && 2>/dev/null export /usr/bin sed export 2>/dev/null x=1
+		then && printf ${HOME} test awk awk local x=1 echo echo grep awk sed /usr/bin
+/usr/bin readonly "$1" sed --verbose x=1 export grep cd then done export sed
+	| grep awk done 2>/dev/null 'quoted text'
+	-eu 2>/dev/null test awk 2>/dev/null
+-eu 2>/dev/null 2>/dev/null "$1" sed
+		2>/dev/null $(pwd) grep && x=1 x=1 -eu printf $(pwd) "$@" | cd /usr/bin 2>/dev/null
+		local readonly 2>/dev/null 'quoted text' printf x=1 awk "$1"
+	local 2>/dev/null printf "$1" done 'quoted text' local "$@" -eu $(pwd) ${HOME}
+		$(pwd) 'quoted text' cd -eu grep export export local "$@" "$1" 2>/dev/null
+${HOME} | --verbose export test x=1 test
+	grep "$1" printf | grep done printf awk | "$@" export echo ${HOME} -eu test
+	readonly readonly --verbose sed echo local
+	sed 'quoted text' readonly "$@" done echo test readonly
+		x=1 /usr/bin readonly "$@" test /usr/bin echo ${HOME} cd test --verbose
+	"$1" sed sed -eu cd /usr/bin 'quoted text' test /usr/bin local
+-eu x=1 2>/dev/null grep "$1" cd 2>/dev/null test done export done
+	sed "$1" | -eu grep ${HOME} x=1 -eu --verbose then 'quoted text' echo
+	"$1" | ${HOME} sed "$1" printf then readonly --verbose grep local done
+	printf test done sed local | awk then cd printf 2>/dev/null done awk "$@" 'quoted text'
+		sed x=1 printf readonly echo done local printf -eu echo |
+	--verbose test $(pwd) sed 2>/dev/null cd | x=1 'quoted text' /usr/bin readonly
+"$@" /usr/bin export readonly test export 2>/dev/null sed cd sed
+	/usr/bin x=1 | readonly sed -eu readonly cd /usr/bin export
+		"$@" local sed grep printf ${HOME} readonly |
+then cd awk x=1 && "$1" local local 2>/dev/null ${HOME} --verbose
+2>/dev/null export local | readonly then grep
+	echo then && 2>/dev/null echo ${HOME} export grep printf done awk "$1" export
+then x=1 && export local
+sed test awk "$@" then local then
+		test x=1 export echo x=1 "$1" && sed
+		awk && echo "$@" | local $(pwd) echo
+		-eu grep $(pwd) | "$1" --verbose ${HOME} | --verbose | sed x=1 ${HOME} "$@" cd 2>/dev/null
+	test export --verbose readonly
+		cd 2>/dev/null 'quoted text'
+$(pwd) x=1 ${HOME} awk 2>/dev/null sed readonly && "$@" ${HOME} local cd
+	grep $(pwd) x=1 cd then x=1 && && 2>/dev/null cd export x=1
+		export then awk 'quoted text' awk printf
+	done printf printf -eu then /usr/bin 'quoted text' local printf $(pwd)
+	-eu done /usr/bin local 'quoted text' printf ${HOME} cd ${HOME} export /usr/bin
+then grep --verbose $(pwd) $(pwd) test "$@" -eu
+	readonly x=1 ${HOME} local sed $(pwd) sed readonly
+	$(pwd) done x=1 /usr/bin "$1"
+done x=1 && then /usr/bin then readonly
+	printf grep sed "$@" echo | local printf cd local
+		sed cd ${HOME} sed "$1" readonly printf --verbose "$1" |
+		then 2>/dev/null local | /usr/bin 'quoted text' readonly
+	--verbose sed "$1" readonly
+		sed && done cd test grep local
+$(pwd) test --verbose | test "$@" done sed
+2>/dev/null && done x=1 done export $(pwd)
+awk awk grep "$@" readonly readonly && grep printf ${HOME}
+		-eu test then 2>/dev/null
+		"$1" | local -eu grep --verbose /usr/bin "$@" -eu
+readonly export -eu ${HOME}
+	2>/dev/null --verbose ${HOME}
+local "$@" echo printf sed | cd "$1" readonly
+	"$1" -eu $(pwd) --verbose && printf "$@" local
+-eu then -eu then echo "$1" readonly
+		"$1" then x=1 --verbose printf /usr/bin readonly sed
+	2>/dev/null $(pwd) awk grep test export --verbose
+echo local local | && printf -eu /usr/bin
+-eu export --verbose 2>/dev/null x=1 | cd printf
+		${HOME} && done sed && x=1 test "$1" /usr/bin echo sed
+printf cd --verbose awk export &&
+	"$1" grep done export export /usr/bin | "$@" | awk "$@" grep --verbose
+	"$@" /usr/bin export sed -eu -eu /usr/bin /usr/bin local awk "$1" sed -eu x=1 printf
+		readonly done $(pwd) awk printf
+	echo && | /usr/bin /usr/bin --verbose x=1
+		then test --verbose 2>/dev/null done | done test | "$1" --verbose
+		test ${HOME} && -eu | $(pwd) -eu grep awk 'quoted text' "$1"
+"$@" -eu local done $(pwd) 2>/dev/null
+	$(pwd) readonly --verbose done 2>/dev/null -eu 2>/dev/null x=1 "$1"
+		/usr/bin cd 'quoted text' -eu then | ${HOME} --verbose local
+'quoted text' done readonly awk echo awk then
+printf echo ${HOME} awk $(pwd) awk 'quoted text' awk x=1 $(pwd) -eu echo
+2>/dev/null then $(pwd) ${HOME} readonly cd export ${HOME} 2>/dev/null
+		grep /usr/bin export x=1 && test "$1" printf
+		| "$@" local awk sed && then awk local ${HOME}
+		echo -eu -eu grep export cd 2>/dev/null $(pwd) local sed sed readonly
+		"$1" then /usr/bin echo sed && | sed 2>/dev/null 2>/dev/null
+${HOME} x=1 printf "$1" printf then
+	${HOME} cd x=1 test --verbose -eu done
+	--verbose $(pwd) test && local $(pwd) awk $(pwd) done 'quoted text'
+2>/dev/null sed readonly $(pwd) done x=1 local -eu |
+		2>/dev/null cd grep -eu | done readonly | "$@" -eu echo sed
+		test readonly -eu 'quoted text' sed printf -eu
+		"$@" -eu then /usr/bin "$@" done then 'quoted text'
+	cd readonly "$@" --verbose && printf
+	export -eu 'quoted text' sed echo "$1" --verbose
+'quoted text' awk && test local 2>/dev/null -eu ${HOME} 2>/dev/null
+	echo /usr/bin /usr/bin done cd "$@" "$@" done | 2>/dev/null | "$1" cd && "$1"
+--verbose $(pwd) sed "$@" test local done done cd readonly "$@" sed ${HOME} test
+		grep --verbose sed sed && echo $(pwd)
+		| && local awk x=1 x=1 then export cd awk readonly
+		readonly 2>/dev/null $(pwd) 'quoted text' then $(pwd)
+	printf printf sed 'quoted text' $(pwd)
+	awk "$1" /usr/bin printf 'quoted text' -eu done printf export | local
@@ -0,0 +1,2001 @@
+		--verbose echo 'quoted text' grep 2>/dev/null test
+&& --verbose then readonly sed echo echo
+		2>/dev/null grep done ${HOME} /usr/bin then -eu export
+	| 2>/dev/null export printf "$@" sed then sed "$1" local then 2>/dev/null
+readonly && /usr/bin x=1 grep "$1"
+		"$@" ${HOME} 'quoted text' test | -eu --verbose
+2>/dev/null readonly $(pwd) export done
+		"$1" cd readonly /usr/bin echo printf 2>/dev/null
+test echo 'quoted text' printf --verbose sed awk
+		export && /usr/bin 2>/dev/null
+awk export printf 2>/dev/null && | x=1 ${HOME} && /usr/bin
+		done "$1" printf --verbose grep awk awk 2>/dev/null
+	cd printf grep && --verbose readonly echo x=1 printf
+awk 'quoted text' printf "$@" export awk --verbose echo local
+sed --verbose cd then 'quoted text'
+/usr/bin "$1" sed printf printf "$1" && sed export then /usr/bin ${HOME}
+	--verbose awk export $(pwd)
+awk /usr/bin -eu 2>/dev/null echo test test "$@" printf local --verbose
+then sed /usr/bin local grep "$@" 2>/dev/null then cd --verbose --verbose grep
+		local "$@" awk done "$1" sed then export x=1 local
+	then /usr/bin $(pwd) echo readonly 2>/dev/null echo -eu test x=1 x=1
+${HOME} $(pwd) sed /usr/bin /usr/bin 'quoted text' 2>/dev/null
+sed local grep echo 'quoted text' readonly printf readonly "$@" 'quoted text'
+		${HOME} | 2>/dev/null $(pwd) x=1 "$@" export x=1 done cd x=1
+x=1 echo done local export 'quoted text' echo /usr/bin sed export
+export "$@" x=1 echo readonly --verbose -eu && printf grep | /usr/bin && echo
+		export "$@" | --verbose readonly ${HOME}
+		export /usr/bin done -eu export | && cd $(pwd) grep | sed sed grep ${HOME}
+		local cd printf done && done --verbose /usr/bin -eu x=1 sed
+		printf ${HOME} "$@" awk && readonly
+cd $(pwd) -eu 'quoted text' && done "$1" -eu --verbose && "$@" 2>/dev/null
+		cd done sed sed then cd -eu x=1 | printf test
+/usr/bin local 2>/dev/null /usr/bin
+		'quoted text' echo cd then printf x=1 "$1" echo
+export awk grep "$1" x=1 local --verbose test then && x=1 | printf | -eu 'quoted text'
+"$1" 'quoted text' sed x=1 "$1" /usr/bin 2>/dev/null
+sed "$1" then 'quoted text' test
+readonly test echo "$@" sed -eu -eu -eu 'quoted text' "$1" awk $(pwd)
+		&& printf readonly awk then && grep grep 2>/dev/null ${HOME} done
+	| printf local -eu /usr/bin | done test /usr/bin "$@" export "$@"
+x=1 ${HOME} && 'quoted text' sed
+		done && 'quoted text' local grep 'quoted text' "$1" sed then && grep /usr/bin
+		readonly $(pwd) -eu local $(pwd)
+		printf x=1 awk x=1 printf /usr/bin readonly test | -eu done
+		test echo printf awk cd cd printf
+	"$@" readonly done readonly $(pwd) local local "$1" -eu 'quoted text'
+		grep $(pwd) $(pwd) export done 'quoted text' /usr/bin test
+		'quoted text' x=1 local then
+		sed | test test echo grep --verbose test -eu cd local sed "$@"
+		"$@" 2>/dev/null && --verbose --verbose 2>/dev/null 2>/dev/null
+-eu && awk export done x=1 ${HOME} done sed printf echo -eu &&
+	2>/dev/null 'quoted text' | echo test test /usr/bin echo "$@" awk then &&
+&& | then && 2>/dev/null /usr/bin
+x=1 ${HOME} readonly local 2>/dev/null -eu cd
+	-eu sed ${HOME} $(pwd) /usr/bin
+	"$@" test awk sed test export local "$1" grep export x=1
+	/usr/bin "$1" export then printf x=1 done x=1 then x=1 printf
+		--verbose $(pwd) local | --verbose
+		awk local test | export cd x=1 grep "$1" | export echo test -eu
+-eu /usr/bin readonly awk
+		${HOME} readonly ${HOME} export /usr/bin "$@" x=1 -eu && $(pwd) export ${HOME}
+		export local printf grep readonly
+		awk --verbose export printf echo "$1" "$@"
+'quoted text' sed /usr/bin
+		-eu ${HOME} grep awk /usr/bin done 'quoted text' test
+		-eu grep "$1" awk local && local 2>/dev/null done readonly
+	export readonly test awk awk cd ${HOME}
+	${HOME} test "$@" 'quoted text' sed && test
+		printf /usr/bin printf ${HOME}
+	cd echo 'quoted text' readonly grep
+	cd --verbose ${HOME} | ${HOME} ${HOME} local ${HOME} printf test $(pwd)
+	awk readonly sed readonly
+done 'quoted text' test "$1" | && && 'quoted text'
+$(pwd) sed ${HOME} && x=1 test
+		| 'quoted text' ${HOME} then export | grep "$@" local test
+		export "$@" ${HOME} | done --verbose "$1" export
+	test local ${HOME} ${HOME} test grep "$@"
+	x=1 test | awk 2>/dev/null
+		echo sed sed printf -eu
+		--verbose "$@" local | export "$1" cd -eu
+		| then 'quoted text' ${HOME} cd
+&& local readonly sed local sed
+		| | $(pwd) "$1" printf grep echo /usr/bin | -eu
+		readonly awk readonly echo echo -eu then "$1" done cd /usr/bin
+	then x=1 $(pwd) done done echo && printf sed echo echo
+		sed cd && x=1 "$@" grep --verbose done local awk grep --verbose &&
+		$(pwd) ${HOME} /usr/bin ${HOME} then done export done printf
+	readonly readonly 2>/dev/null $(pwd) && test printf 'quoted text' cd $(pwd)
+		grep /usr/bin 'quoted text' local awk
+		then | | export x=1 then printf grep | "$1" export --verbose |
+		"$@" $(pwd) /usr/bin echo ${HOME} cd x=1 test "$@" test x=1 && ${HOME} grep
+		${HOME} grep --verbose cd printf x=1 2>/dev/null 'quoted text' --verbose
+		local awk ${HOME} export -eu awk cd echo -eu local "$@"
+cd readonly 'quoted text'
+then grep test /usr/bin --verbose 2>/dev/null sed ${HOME}
+		test then -eu local sed then |
+x=1 "$@" grep 2>/dev/null echo 2>/dev/null export "$1" grep ${HOME} cd
+-eu --verbose -eu --verbose sed 2>/dev/null local --verbose
+'quoted text' local "$@" -eu | -eu /usr/bin -eu
+printf && "$@" then "$@" 'quoted text'
+| awk local $(pwd) /usr/bin
+awk awk ${HOME} "$1" -eu test ${HOME} echo echo grep x=1 --verbose 2>/dev/null
+grep done $(pwd) -eu grep cd "$1" then 'quoted text'
+		grep test "$@" /usr/bin done printf
+	${HOME} 2>/dev/null /usr/bin "$1" -eu x=1 2>/dev/null
+	sed cd echo echo x=1 awk /usr/bin x=1 --verbose local test $(pwd)
+	--verbose "$@" x=1 x=1 /usr/bin $(pwd) cd x=1
+		x=1 done local | cd test "$@" readonly awk cd ${HOME} --verbose --verbose && test
+	&& echo --verbose 'quoted text'
+2>/dev/null -eu grep /usr/bin && export
+		'quoted text' echo $(pwd) /usr/bin test sed --verbose
+"$@" /usr/bin 'quoted text' --verbose awk done "$@" 2>/dev/null
+| && x=1 grep && echo done /usr/bin grep x=1 done 2>/dev/null "$1" | && "$@"
+		/usr/bin echo grep local readonly -eu
+		${HOME} -eu -eu 2>/dev/null $(pwd) printf /usr/bin
+local export echo export cd
+		--verbose grep "$1" 2>/dev/null
+-eu 'quoted text' awk $(pwd) x=1 | test then
+		sed then /usr/bin test sed awk export then "$@" 2>/dev/null
+		-eu echo sed x=1 done
+		done test local readonly local printf
+		| done "$@" echo "$1" cd local awk x=1 cd sed awk
+	sed local $(pwd) $(pwd) readonly awk echo x=1 readonly local readonly
+	"$1" $(pwd) echo readonly local
+cd printf cd ${HOME} readonly
+	| local sed 'quoted text' test && test printf "$1"
+		"$@" then local readonly cd test "$1"
+	&& | | then cd x=1 export "$1" "$@" done sed
+	awk local && "$1" readonly cd && 2>/dev/null && $(pwd) echo x=1 sed "$@" ${HOME}
+		"$1" cd export $(pwd) && cd then
+	2>/dev/null "$@" awk export echo "$1"
+printf $(pwd) cd /usr/bin
+	/usr/bin export && sed --verbose "$1" 2>/dev/null echo && local then local
+	&& done test then done "$@" "$1" local && "$1"
+| done test 'quoted text' then readonly done test
+		"$1" awk --verbose -eu /usr/bin done sed then awk awk --verbose test "$@" && export
+grep cd ${HOME} grep -eu
+		| export grep x=1 printf "$@" export -eu awk echo | --verbose printf 'quoted text'
+		${HOME} "$1" echo printf /usr/bin &&
+		--verbose "$1" | -eu && /usr/bin | sed printf ${HOME} "$1"
+| 'quoted text' x=1 $(pwd) ${HOME} done export /usr/bin done
+		done "$1" export sed printf "$@" test $(pwd) 2>/dev/null printf
+		2>/dev/null then $(pwd) && awk 'quoted text' export done local cd awk
+x=1 "$1" awk ${HOME} "$1" "$1" $(pwd) test -eu -eu cd
+--verbose 'quoted text' sed export -eu 'quoted text' | sed
+		test printf -eu readonly grep
+		sed echo --verbose $(pwd)
+		${HOME} echo x=1 $(pwd) "$@" $(pwd) x=1 printf sed | | awk printf echo
+	--verbose export then | /usr/bin -eu ${HOME} printf
+	sed cd | test /usr/bin "$1" done "$1" && x=1 "$1" --verbose /usr/bin grep printf
+	then readonly readonly local cd printf ${HOME} export awk readonly
+	then ${HOME} readonly 'quoted text'
+		cd cd -eu grep test 'quoted text' cd 'quoted text' && 2>/dev/null $(pwd) && then
+grep $(pwd) grep test 'quoted text' ${HOME} /usr/bin grep
+	awk | ${HOME} ${HOME} done echo 'quoted text' printf 2>/dev/null
+-eu printf /usr/bin export printf readonly sed test grep --verbose
+| /usr/bin 2>/dev/null awk test test sed done && local local
+		readonly --verbose test "$@" readonly
+		local awk && sed cd cd | "$@" "$1" 2>/dev/null readonly export grep && $(pwd) cd
+local local grep local sed cd 2>/dev/null --verbose sed cd "$@" done | then readonly
+'quoted text' $(pwd) "$1"
+"$@" | echo echo ${HOME} echo sed readonly /usr/bin test
+		"$1" --verbose ${HOME} 'quoted text'
+awk cd then -eu test -eu done cd -eu 'quoted text'
+cd $(pwd) ${HOME} -eu 'quoted text' --verbose echo sed 'quoted text'
+	then -eu grep local -eu 2>/dev/null $(pwd) | grep | echo $(pwd) ${HOME}
+--verbose test ${HOME} export then "$1" -eu test
+		&& cd cd awk grep then | readonly
+-eu sed then printf readonly -eu $(pwd) readonly "$@"
+x=1 sed echo -eu 'quoted text'
+readonly test 'quoted text' printf cd local printf export x=1
+printf test readonly "$1" --verbose grep echo 2>/dev/null then test export
+test | export --verbose test ${HOME} -eu printf done -eu
+	&& 2>/dev/null local export test echo sed | test
+	--verbose x=1 x=1 grep ${HOME}
+	"$1" cd "$1" grep 2>/dev/null /usr/bin /usr/bin test
+sed export test 2>/dev/null && | test grep && "$@"
+		x=1 sed export -eu test grep 2>/dev/null awk echo $(pwd) -eu x=1 echo $(pwd) sed
+	readonly $(pwd) | x=1 cd x=1 'quoted text'
+	then "$@" done && "$@" cd "$@" "$@" readonly printf "$@" ${HOME}
+		&& printf export 2>/dev/null test 'quoted text' -eu readonly -eu printf
+local /usr/bin "$@" then sed grep 2>/dev/null && readonly "$@" then ${HOME}
+		done local echo 2>/dev/null then test grep local
+		sed 'quoted text' && "$1" 'quoted text' /usr/bin grep grep grep | 'quoted text'
+		readonly echo --verbose local --verbose done "$1" export 2>/dev/null
+grep | awk local test done test $(pwd) -eu readonly readonly
+&& test grep echo 'quoted text' --verbose $(pwd)
+then x=1 "$1" cd | export echo local
+	local grep "$1" 2>/dev/null --verbose printf printf
+		x=1 "$@" echo | --verbose echo sed cd --verbose "$@" grep
+-eu test cd grep then awk 'quoted text' -eu echo test "$@" local ${HOME}
+then cd /usr/bin export
+	sed $(pwd) local ${HOME} then sed test cd cd export readonly grep local "$@"
+	then done printf ${HOME} && x=1 ${HOME} "$1" ${HOME} --verbose cd export done
+		"$1" cd $(pwd) awk "$1" export cd readonly
+	readonly x=1 "$@" awk && ${HOME} "$@" local
+	export -eu readonly -eu "$@" done 2>/dev/null
+"$@" grep then printf readonly test printf $(pwd)
+	-eu -eu "$1" grep grep grep done sed test | --verbose
+		then --verbose $(pwd) x=1 'quoted text'
+"$1" then ${HOME} awk 'quoted text'
+-eu printf awk printf ${HOME}
+	sed --verbose cd export 2>/dev/null grep 'quoted text' test
+grep --verbose x=1 printf export
+done 'quoted text' awk $(pwd) $(pwd) printf cd readonly grep local 2>/dev/null
+		then "$@" && then export ${HOME} ${HOME} awk echo ${HOME}
+grep "$1" /usr/bin grep "$1" && 2>/dev/null
+readonly $(pwd) | export 2>/dev/null 'quoted text'
+		${HOME} test test $(pwd) awk $(pwd) -eu | grep grep "$1" 2>/dev/null
+test && sed done echo test
+		'quoted text' local echo -eu then sed
+		printf printf | done local "$1"
+	sed cd printf --verbose x=1 local sed "$@"
+	'quoted text' done 'quoted text'
+-eu local ${HOME} /usr/bin done export then "$@" /usr/bin
+	export && "$@" export readonly | ${HOME} readonly
+	"$@" $(pwd) /usr/bin /usr/bin sed cd "$1" | cd awk
+		local awk /usr/bin x=1 && -eu readonly done test
+"$@" sed /usr/bin ${HOME} echo --verbose test
+$(pwd) 'quoted text' --verbose --verbose && awk --verbose grep 2>/dev/null
+		"$@" /usr/bin x=1 'quoted text' | cd $(pwd) -eu "$1" /usr/bin 'quoted text'
+echo export "$@" export -eu
+	local | "$@" "$1" grep $(pwd) 2>/dev/null ${HOME} --verbose
+		"$@" | && echo done echo ${HOME} cd 2>/dev/null "$1"
+	'quoted text' ${HOME} -eu | "$1" export grep && 2>/dev/null --verbose
+		then readonly /usr/bin ${HOME} sed
+		export then -eu x=1 && -eu done 'quoted text' printf 2>/dev/null
+		readonly cd awk then --verbose readonly 2>/dev/null -eu $(pwd)
+	done ${HOME} 'quoted text' printf 2>/dev/null /usr/bin ${HOME}
+2>/dev/null x=1 $(pwd) 2>/dev/null | awk /usr/bin x=1 then $(pwd) /usr/bin
+		/usr/bin awk "$@" test awk 'quoted text' grep && grep then
+		| done -eu -eu cd awk "$1" 'quoted text' readonly && grep
+	/usr/bin sed test readonly "$@" printf "$1" "$@" then $(pwd) && then x=1 ${HOME}
+		export 2>/dev/null ${HOME} x=1 sed cd cd -eu "$@"
+	"$1" cd readonly "$@" done | local cd "$1" $(pwd)
+		sed 2>/dev/null sed x=1 -eu 'quoted text' 'quoted text' x=1
+${HOME} grep awk readonly local --verbose done readonly 'quoted text' &&
+		then then printf ${HOME} -eu --verbose
+	printf 2>/dev/null cd "$@" --verbose && local awk $(pwd) printf test
+		echo grep | /usr/bin /usr/bin echo readonly && 'quoted text' /usr/bin
+printf /usr/bin then -eu cd awk /usr/bin
+		${HOME} echo 'quoted text' grep x=1
+	readonly /usr/bin -eu x=1 grep ${HOME} export echo | test x=1 readonly awk
+	${HOME} -eu ${HOME} readonly local sed | readonly $(pwd) "$1"
+sed ${HOME} then readonly awk
+		${HOME} local sed done cd --verbose grep cd then grep | local
+	x=1 $(pwd) export x=1 'quoted text'
+	echo test ${HOME} echo "$1" grep "$1" done export "$@" cd readonly
+local echo 'quoted text' --verbose "$@" x=1 | "$1" | | test | && /usr/bin readonly
+	readonly $(pwd) test /usr/bin cd 'quoted text' "$1" awk -eu
+		readonly /usr/bin "$@" "$@" cd | --verbose ${HOME} 2>/dev/null
+echo printf sed test then "$@" 'quoted text' sed sed local
+		local awk awk echo then
+		sed | --verbose 'quoted text' grep -eu --verbose test
+cd readonly ${HOME} local cd $(pwd) grep then local && 'quoted text' then --verbose
+2>/dev/null then 2>/dev/null x=1 printf x=1 $(pwd)
+	cd awk printf sed 2>/dev/null export local |
+	export then local -eu "$1" ${HOME} cd "$1" export done sed | sed 2>/dev/null
+"$1" test "$@" export done x=1 $(pwd) --verbose grep export x=1 --verbose
+		test x=1 'quoted text' then grep awk local "$1" awk grep
+	--verbose -eu $(pwd) then 2>/dev/null ${HOME} sed done sed grep test ${HOME}
+export 'quoted text' echo "$1" grep "$@" awk $(pwd) awk done awk test then
+$(pwd) 2>/dev/null "$1" $(pwd) "$@" 2>/dev/null
+	readonly | cd then -eu ${HOME}
+	printf $(pwd) && $(pwd) test -eu grep x=1 grep awk then readonly then 'quoted text'
+		| local $(pwd) cd cd | local "$1" sed local export ${HOME} &&
+		export /usr/bin readonly readonly echo | && ${HOME}
+		cd readonly printf -eu 2>/dev/null
+echo grep -eu export grep x=1 2>/dev/null
+	printf test ${HOME} echo readonly /usr/bin 'quoted text'
+-eu readonly 'quoted text' | echo readonly export readonly
+	sed x=1 local readonly then 2>/dev/null ${HOME}
+	export export 'quoted text' && "$1" done
+	"$@" "$1" --verbose grep && && 'quoted text'
+$(pwd) then $(pwd) 'quoted text' "$@" | "$@" /usr/bin ${HOME} /usr/bin
+	grep test echo done local $(pwd)
+	| $(pwd) 2>/dev/null &&
+	sed cd then echo 2>/dev/null echo then sed $(pwd) echo printf | done
+	&& then readonly done "$1" | 2>/dev/null 'quoted text'
+	test 'quoted text' 2>/dev/null -eu 'quoted text' "$1" -eu -eu x=1
+then /usr/bin export --verbose -eu done test done "$1" readonly
+		export | && --verbose local && | &&
+	-eu then 2>/dev/null "$1" echo echo
+		&& && 'quoted text' sed --verbose 'quoted text' printf -eu /usr/bin
+	-eu cd x=1 then | "$@" "$1" echo grep 2>/dev/null
+	done x=1 echo sed echo then | test echo local | "$1" cd readonly
+		${HOME} local echo /usr/bin done readonly cd local
+		-eu readonly 'quoted text' && readonly echo
+	$(pwd) then readonly $(pwd) then echo echo export ${HOME} sed "$1" printf printf
+sed --verbose && "$1" && echo echo test sed then 2>/dev/null 'quoted text'
+&& "$1" then sed 'quoted text' export echo --verbose then local -eu export
+	/usr/bin | 'quoted text'
+		echo | printf done cd 'quoted text'
+	printf grep "$@" awk $(pwd) test --verbose
+awk then && ${HOME} "$1" 2>/dev/null echo --verbose ${HOME} ${HOME} cd --verbose
+	-eu --verbose export /usr/bin cd -eu "$1" then grep -eu readonly $(pwd)
+	| && && local awk -eu export export -eu then $(pwd) $(pwd) | sed
+		awk done /usr/bin test
+	"$1" sed cd x=1 awk "$@" $(pwd) -eu readonly
+sed x=1 ${HOME} "$@" echo
+		cd | && x=1 awk local grep done printf grep | -eu local -eu /usr/bin export
+2>/dev/null sed 2>/dev/null $(pwd) sed
+sed readonly sed ${HOME} printf done x=1 test && /usr/bin echo awk ${HOME}
+		"$1" printf test printf then ${HOME} x=1 export readonly 'quoted text'
+x=1 done --verbose "$@" --verbose
+awk --verbose && sed /usr/bin grep "$1" -eu --verbose export
+		readonly local readonly export /usr/bin -eu 2>/dev/null readonly
+	local then sed printf | readonly -eu ${HOME} sed | 'quoted text' local -eu
+		"$@" /usr/bin readonly readonly local local
+		echo "$@" awk && --verbose readonly $(pwd) done -eu
+'quoted text' $(pwd) done test "$1" sed local "$1" 'quoted text'
+--verbose 2>/dev/null $(pwd) test done echo awk | local | 'quoted text'
+		"$1" then "$1" awk 'quoted text' readonly 'quoted text' printf && sed done x=1 done
+		cd x=1 && then sed "$@" && echo --verbose cd /usr/bin
+		local sed test | /usr/bin x=1 local
+		cd /usr/bin cd echo 2>/dev/null "$@" 2>/dev/null "$@" 2>/dev/null
+	test done grep printf awk cd local 2>/dev/null 2>/dev/null | ${HOME}
+2>/dev/null sed test /usr/bin /usr/bin
+cd then sed cd test "$@" /usr/bin awk grep 2>/dev/null done
+2>/dev/null --verbose then
+export printf export | 2>/dev/null
+		${HOME} "$1" export readonly then
+		sed done export echo awk done 2>/dev/null test 'quoted text'
+		$(pwd) 2>/dev/null test |
+awk --verbose -eu "$@" printf /usr/bin then ${HOME} 'quoted text' 2>/dev/null
+local awk export local done local local awk -eu |
+	| grep /usr/bin sed ${HOME} local 'quoted text' readonly $(pwd) awk readonly
+test awk sed sed "$1" ${HOME} awk ${HOME} --verbose --verbose
+	x=1 grep ${HOME} && && readonly ${HOME} | local
+done then x=1 'quoted text'
+		grep -eu grep "$@" 2>/dev/null
+	then "$1" --verbose ${HOME} printf
+		&& 'quoted text' echo then $(pwd) then 'quoted text' &&
+	${HOME} then test sed x=1 ${HOME} "$1" | then && test sed
+$(pwd) -eu then | readonly
+	x=1 "$@" "$1" "$1" 'quoted text' "$@"
+	grep echo "$1" -eu then
+		local then 'quoted text' grep && test then 2>/dev/null echo |
+	x=1 export "$1" $(pwd) x=1 then && cd | | 'quoted text' readonly
+		echo done ${HOME} grep 2>/dev/null awk 'quoted text' test 'quoted text'
+local cd "$1" --verbose 'quoted text'
+		x=1 sed "$1" echo /usr/bin "$1" /usr/bin | "$@" "$@" -eu export echo local x=1
+${HOME} x=1 'quoted text'
+		local ${HOME} test printf awk 2>/dev/null
+x=1 && x=1 local readonly then "$1" /usr/bin |
+	"$@" then printf local awk cd -eu "$1"
+	"$@" --verbose cd awk "$1" 2>/dev/null "$@"
+		2>/dev/null sed "$1" sed 2>/dev/null 'quoted text'
+	"$1" echo "$@" awk sed && local done 'quoted text'
+		/usr/bin done echo --verbose then grep done 'quoted text' |
+		awk | && readonly | -eu cd -eu done cd x=1 /usr/bin export -eu export done
+	then echo x=1 done then $(pwd) 2>/dev/null | $(pwd) 'quoted text'
+		sed 2>/dev/null | test "$@" grep cd x=1 | echo 2>/dev/null
+	echo $(pwd) /usr/bin ${HOME} $(pwd) /usr/bin done grep ${HOME} ${HOME}
+	done cd --verbose --verbose
+| "$1" sed done /usr/bin --verbose cd sed "$@" printf done --verbose
+/usr/bin && --verbose then echo 'quoted text' "$@" --verbose --verbose
+awk | ${HOME} x=1 echo && /usr/bin $(pwd) then 2>/dev/null
+export -eu readonly done | echo -eu "$1" -eu ${HOME} && "$1"
+		then "$1" printf $(pwd) awk --verbose then readonly cd
+		"$@" readonly echo local sed export $(pwd)
+	cd "$1" echo ${HOME} readonly echo done cd
+x=1 printf then export printf printf -eu grep done
+	&& sed && "$@" && | grep sed cd x=1 --verbose && ${HOME} $(pwd) grep export
+		| test local "$1" readonly $(pwd) grep | 'quoted text'
+	2>/dev/null then cd awk && sed 'quoted text' --verbose /usr/bin local 'quoted text'
+local && && printf readonly grep 2>/dev/null
+$(pwd) --verbose local readonly
+	&& awk /usr/bin export done 2>/dev/null x=1 $(pwd) -eu /usr/bin
+"$1" | readonly then $(pwd) echo cd "$1"
+&& sed local export 2>/dev/null
+local then sed readonly "$@" readonly
+	2>/dev/null grep echo grep export 2>/dev/null
+		sed awk | ${HOME} && x=1 test "$1" test /usr/bin cd
+echo | && && x=1 'quoted text' then /usr/bin sed "$1" --verbose x=1 awk
+	grep | sed local --verbose awk then /usr/bin
+-eu test readonly && cd local /usr/bin ${HOME} sed printf &&
+		cd 'quoted text' echo 2>/dev/null grep -eu
+'quoted text' cd done done
+		-eu $(pwd) "$1" x=1 -eu local grep readonly readonly 2>/dev/null
+	--verbose then echo "$@" | 2>/dev/null
+	test then test /usr/bin x=1 && awk $(pwd) && export export -eu awk --verbose
+		x=1 --verbose echo 'quoted text'
+export ${HOME} echo local 'quoted text' export cd cd $(pwd)
+	"$1" $(pwd) cd x=1 printf test | --verbose "$@" done
+		sed 2>/dev/null then 2>/dev/null local "$1" export /usr/bin
+		cd cd ${HOME} ${HOME} export test -eu && echo | ${HOME}
+/usr/bin x=1 readonly local sed local test printf /usr/bin
+export && 2>/dev/null readonly "$1" 2>/dev/null && cd && echo printf | echo printf
+	--verbose x=1 readonly && echo /usr/bin | echo cd | sed $(pwd) awk "$1"
+	--verbose readonly 2>/dev/null test export then --verbose export printf
+--verbose 'quoted text' "$@"
+		test 2>/dev/null cd --verbose
+		/usr/bin awk done | then then /usr/bin | && test $(pwd) "$@" local printf
+		echo -eu 2>/dev/null -eu printf sed ${HOME} 2>/dev/null ${HOME} cd x=1 done /usr/bin
+-eu "$@" /usr/bin ${HOME} ${HOME} "$1" export $(pwd) && awk ${HOME}
+		2>/dev/null | sed | "$@" 'quoted text'
+		/usr/bin readonly echo cd /usr/bin 'quoted text'
+test && --verbose && local -eu -eu awk test test test
+| /usr/bin local grep ${HOME}
+		&& && grep grep readonly cd grep "$@" export then export | local
+	"$1" then then -eu -eu
+x=1 cd test ${HOME} "$@" ${HOME} export printf echo
+		'quoted text' "$@" awk done | readonly awk /usr/bin printf sed "$1" printf
+	readonly test readonly test local 2>/dev/null sed sed $(pwd) awk export $(pwd)
+		2>/dev/null | test echo sed echo "$@" && grep
+		sed grep "$@" done "$@" then && test && -eu 2>/dev/null 'quoted text' && --verbose
+then "$@" 2>/dev/null readonly --verbose --verbose 'quoted text' local done
+	-eu | ${HOME} --verbose && export readonly 'quoted text'
+then x=1 printf readonly /usr/bin /usr/bin -eu -eu x=1 'quoted text' local
+	"$1" then ${HOME} then $(pwd) x=1 "$@" sed
+		test export "$1" x=1 2>/dev/null && ${HOME} grep echo 2>/dev/null
+2>/dev/null export done export
+echo /usr/bin awk "$@" -eu $(pwd)
+	-eu local /usr/bin -eu "$@" && printf awk "$1" done echo -eu $(pwd)
+"$1" "$@" local cd grep -eu echo -eu ${HOME} -eu printf cd echo
+	sed -eu -eu 2>/dev/null readonly
+x=1 cd "$@" && then cd 2>/dev/null
+'quoted text' awk | readonly grep /usr/bin "$@" test 'quoted text' $(pwd)
+		"$1" printf | x=1 "$@" sed export done 2>/dev/null ${HOME} ${HOME} $(pwd)
+		printf x=1 /usr/bin test echo /usr/bin
+	done test -eu done 'quoted text' awk local echo 2>/dev/null test -eu 2>/dev/null
+		awk echo x=1 export $(pwd) awk ${HOME} /usr/bin echo 2>/dev/null
+		/usr/bin "$@" test printf "$1" then sed
+readonly echo -eu test 2>/dev/null done
+local /usr/bin --verbose 'quoted text' cd -eu --verbose ${HOME}
+		awk test echo export readonly && test && -eu printf echo --verbose
+		export sed done -eu printf
+		grep echo -eu 2>/dev/null "$1"
+		x=1 local 2>/dev/null
+	local --verbose && readonly ${HOME} -eu $(pwd) test echo done printf -eu test
+	-eu "$1" && then grep && printf local done 2>/dev/null
+		"$@" | ${HOME} readonly printf
+	sed then then 'quoted text' test | grep readonly $(pwd) awk $(pwd)
+	$(pwd) echo 'quoted text' test && && then -eu 2>/dev/null test /usr/bin done
+printf 'quoted text' done "$1" cd then -eu -eu export $(pwd) grep
+"$1" printf ${HOME} | readonly --verbose test && printf && ${HOME} "$1" x=1
+grep done printf --verbose -eu $(pwd) --verbose "$@" $(pwd) then -eu
+	"$1" x=1 "$@" "$@" done local done cd export -eu then | export && -eu
+--verbose 2>/dev/null "$@" && sed $(pwd) $(pwd) $(pwd) done echo && $(pwd)
+		done 'quoted text' printf printf export cd awk readonly
+	2>/dev/null echo export grep "$@" printf ${HOME} /usr/bin
+awk x=1 $(pwd) && echo | 2>/dev/null ${HOME} echo sed
+awk "$@" --verbose local awk --verbose /usr/bin readonly /usr/bin
+		export awk grep --verbose echo 2>/dev/null
+		"$@" /usr/bin 2>/dev/null
+	awk readonly sed -eu 2>/dev/null
+		then && 2>/dev/null cd grep 2>/dev/null /usr/bin done --verbose
+	&& ${HOME} done test printf echo
+'quoted text' readonly -eu printf && -eu export readonly -eu | "$@" 'quoted text'
+		cd local "$1" readonly | local done readonly
+		cd --verbose local && printf x=1 ${HOME} /usr/bin
+		done -eu done awk awk local
+"$@" test ${HOME} 'quoted text' --verbose 2>/dev/null cd printf export x=1
+		-eu 2>/dev/null export /usr/bin && 'quoted text' "$1" readonly
+	awk && 2>/dev/null awk && --verbose sed readonly /usr/bin "$@" awk --verbose
+		echo "$1" ${HOME} "$@" done /usr/bin --verbose
+		grep then grep export $(pwd) sed then $(pwd) ${HOME} "$1" echo done cd awk /usr/bin
+awk awk x=1 "$@" /usr/bin local 'quoted text' ${HOME} grep printf echo --verbose
+		awk sed -eu -eu x=1 sed sed /usr/bin "$1" 'quoted text' then grep then "$1" grep
+		then 2>/dev/null cd test -eu ${HOME} export
+		awk -eu 'quoted text' then readonly grep /usr/bin
+$(pwd) awk done test printf readonly ${HOME}
+		-eu sed sed 2>/dev/null ${HOME}
+		&& printf "$@" then /usr/bin export -eu /usr/bin
+	| sed local -eu grep x=1 printf
+		-eu 'quoted text' "$@" cd local
+	done /usr/bin then awk printf
+printf local readonly "$1" printf 'quoted text' "$1" printf awk | /usr/bin && done
+	${HOME} "$@" echo ${HOME} $(pwd) sed cd "$@" echo awk test
+	awk --verbose | awk x=1 export cd sed export done && 'quoted text'
+grep cd test done printf 'quoted text'
+printf awk x=1 done then 'quoted text' 'quoted text' -eu printf awk
+		sed echo export echo grep --verbose x=1 --verbose local
+		sed "$1" && awk "$@" cd -eu grep cd sed
+	x=1 local 2>/dev/null sed && -eu
+${HOME} 2>/dev/null grep --verbose "$1" local /usr/bin 'quoted text'
+		${HOME} echo ${HOME} "$@" then "$1" then && ${HOME} printf
+	| "$@" /usr/bin && x=1 cd grep | ${HOME} ${HOME}
+		/usr/bin grep sed "$1" --verbose ${HOME} | readonly local test readonly
+	then test awk "$1" --verbose readonly && x=1 export
+| --verbose -eu && --verbose awk
+	"$@" sed done export echo 'quoted text' 'quoted text' && sed
+		${HOME} test "$@" test | awk printf awk export --verbose /usr/bin echo | sed
+$(pwd) cd readonly x=1 then
+/usr/bin printf grep grep sed printf grep
+cd "$1" awk && test then readonly x=1 -eu local 2>/dev/null | export
+	readonly then "$1" -eu ${HOME}
+		&& && /usr/bin sed printf -eu then $(pwd) /usr/bin local sed done readonly
+$(pwd) 'quoted text' echo 'quoted text'
+		"$1" $(pwd) echo printf x=1 test grep local sed "$@" && -eu grep 2>/dev/null
+	/usr/bin export "$1" && sed "$1" local "$@" |
+printf x=1 'quoted text' cd -eu echo export
+	test test "$1" "$@" grep --verbose --verbose
+	&& /usr/bin 2>/dev/null cd | local
+sed export sed 'quoted text' 'quoted text' "$@" then
+		test local local && "$@" && $(pwd) /usr/bin | "$1" grep
+		| readonly export cd sed --verbose
+	/usr/bin -eu export --verbose "$1" 'quoted text' 'quoted text'
+x=1 -eu --verbose cd awk && printf sed x=1 printf
+		printf grep cd /usr/bin --verbose 'quoted text' done done "$1" cd local local
+awk /usr/bin local /usr/bin printf export export echo $(pwd) sed
+		sed test --verbose cd awk && test "$@" readonly export then && --verbose
+	${HOME} then --verbose "$1" -eu | -eu
+		done test grep 'quoted text' --verbose
+"$1" then awk export $(pwd) grep done $(pwd) local local "$@" export export "$1"
+| awk echo ${HOME} readonly readonly grep local -eu /usr/bin awk "$@"
+	/usr/bin local cd awk --verbose "$1" --verbose echo "$@"
+		$(pwd) $(pwd) test /usr/bin
+| | $(pwd) export then
+| export test then echo "$@"
+		printf awk "$1" -eu export
+		x=1 "$1" ${HOME} $(pwd) cd echo -eu 'quoted text' local sed &&
+sed echo then echo 2>/dev/null x=1 --verbose /usr/bin local $(pwd)
+		&& sed local grep 'quoted text'
+local then /usr/bin grep 2>/dev/null grep && sed
+		/usr/bin && /usr/bin --verbose -eu then | test $(pwd) | cd readonly grep
+	"$@" echo 'quoted text' -eu local --verbose && 'quoted text'
+	/usr/bin readonly -eu done then cd 'quoted text' "$1" x=1 sed printf printf
+test x=1 $(pwd) printf /usr/bin echo /usr/bin
+		echo export | 'quoted text' x=1 -eu --verbose
+'quoted text' sed then "$@" | awk x=1 'quoted text'
+	export grep printf x=1
+	${HOME} then 'quoted text' export
+		then -eu "$1" -eu --verbose --verbose
+	cd | 2>/dev/null readonly local cd
+test ${HOME} "$1" ${HOME} then && 2>/dev/null export
+printf | done done $(pwd) 2>/dev/null test
+&& readonly | "$1" /usr/bin then 'quoted text' grep done && x=1
+| /usr/bin /usr/bin awk done "$@" then ${HOME} /usr/bin awk
+done $(pwd) printf 2>/dev/null --verbose export done sed
+	cd "$@" sed awk 'quoted text' export local "$@" 'quoted text' test /usr/bin "$1"
+	| "$1" local cd --verbose
+		"$1" printf --verbose test $(pwd) 'quoted text' sed 'quoted text' "$@" -eu
+/usr/bin export $(pwd) done $(pwd) ${HOME} then printf readonly
+	"$@" | && /usr/bin /usr/bin local printf local export
+		grep /usr/bin x=1 export readonly $(pwd) grep
+		"$@" "$@" && awk echo sed then ${HOME} "$@" /usr/bin
+"$@" sed $(pwd) -eu then readonly
+	&& test "$1" /usr/bin grep sed sed $(pwd)
+'quoted text' 'quoted text' echo done | test sed readonly
+		printf then 'quoted text'
+sed export | grep sed --verbose test "$1" done
+	echo | readonly $(pwd) -eu | "$@" awk $(pwd) echo /usr/bin 'quoted text'
+export test "$1" /usr/bin test "$1" /usr/bin
+		--verbose done cd then local | 'quoted text' echo sed sed 'quoted text' $(pwd)
+		| ${HOME} export printf echo ${HOME} then echo
+	/usr/bin | awk $(pwd) test export -eu $(pwd) export --verbose cd
+	readonly echo x=1 cd
+		| local --verbose 2>/dev/null sed awk | sed 'quoted text' cd
+		test local | grep --verbose | echo cd readonly 2>/dev/null
+		export && awk export cd local test -eu /usr/bin 'quoted text' sed ${HOME} cd "$1"
+		x=1 --verbose x=1 grep -eu
+	local printf x=1 && cd done printf ${HOME} sed -eu test 2>/dev/null
+	${HOME} cd && 2>/dev/null sed sed "$1" done sed && /usr/bin
+		cd local sed grep export --verbose | awk 'quoted text'
+	-eu | $(pwd) local done test test printf sed awk local x=1 && sed --verbose
+		done 2>/dev/null "$1" && sed 'quoted text'
+	-eu x=1 $(pwd) readonly "$@" 2>/dev/null
+2>/dev/null 'quoted text' grep export test cd $(pwd) | 2>/dev/null
+awk "$@" cd local | --verbose grep then grep
+	&& $(pwd) export ${HOME}
+	readonly 2>/dev/null readonly && grep done readonly
+		'quoted text' export /usr/bin "$@" -eu
+	printf ${HOME} echo awk "$@" 'quoted text' cd done
+	"$1" sed | && grep export
+		'quoted text' $(pwd) echo printf printf -eu |
+| sed test | 'quoted text' "$1" ${HOME} grep && cd && -eu grep "$1" printf echo
+		done 2>/dev/null local sed -eu
+	sed 2>/dev/null 'quoted text' 2>/dev/null 2>/dev/null && -eu $(pwd)
+	awk "$@" then echo cd readonly | local 2>/dev/null ${HOME} --verbose then &&
+	readonly -eu readonly | then 'quoted text' | echo printf "$@" sed &&
+--verbose $(pwd) "$@" cd test
+x=1 --verbose 2>/dev/null -eu awk 'quoted text' /usr/bin local
+		| cd export then echo 'quoted text' grep export 2>/dev/null
+	printf readonly echo readonly cd grep -eu grep $(pwd) sed
+	| grep "$@" local && test $(pwd)
+		-eu local --verbose cd "$@" export sed awk readonly 'quoted text' printf done readonly
+grep && && awk --verbose done | readonly | sed 'quoted text'
+then | 2>/dev/null 2>/dev/null test $(pwd) then && export
+	/usr/bin awk && "$@" then /usr/bin
+		then | cd ${HOME} /usr/bin printf export x=1 2>/dev/null
+	| sed echo $(pwd) ${HOME} --verbose printf
+	| "$1" $(pwd) then $(pwd) ${HOME} $(pwd) | awk readonly
+	test awk $(pwd) --verbose "$@" x=1 local readonly cd ${HOME} x=1
+		2>/dev/null $(pwd) cd 2>/dev/null readonly
+'quoted text' then $(pwd) "$1" export test && readonly 2>/dev/null
+	/usr/bin local 'quoted text' grep test ${HOME} 2>/dev/null && /usr/bin cd readonly
+		printf | /usr/bin "$1" "$1" awk /usr/bin && /usr/bin export $(pwd) then
+	x=1 x=1 | echo local && then 'quoted text' export 2>/dev/null
+		| "$@" "$1" --verbose export cd
+	&& --verbose test ${HOME} test test "$@"
+	done done local x=1 /usr/bin readonly -eu grep echo | done then done grep /usr/bin
+	2>/dev/null -eu local x=1 'quoted text' export x=1 local echo grep grep ${HOME}
+	-eu ${HOME} sed | readonly -eu "$@" 'quoted text' | local 2>/dev/null -eu export
+&& awk printf ${HOME} ${HOME} -eu /usr/bin
+		/usr/bin printf /usr/bin --verbose echo echo | "$@" ${HOME}
+| test cd $(pwd) awk | ${HOME} "$1"
+	2>/dev/null --verbose 2>/dev/null echo awk /usr/bin awk ${HOME} echo
+	--verbose readonly echo $(pwd) 2>/dev/null x=1 && "$@" "$@" /usr/bin
+	${HOME} sed echo 2>/dev/null "$1" --verbose cd | echo && local
+local done | cd then --verbose /usr/bin
+export sed export x=1 test printf && 2>/dev/null "$@"
+	"$@" export test "$@" -eu local -eu 'quoted text' 2>/dev/null
+	printf then echo "$1" "$@" /usr/bin export 2>/dev/null then $(pwd) local
+		echo done -eu then -eu grep -eu "$1" sed
+	"$@" export done done then awk
+/usr/bin local $(pwd) awk local -eu /usr/bin grep --verbose
+	x=1 readonly awk 2>/dev/null "$1" then $(pwd) $(pwd) $(pwd)
+	grep -eu 'quoted text' ${HOME} /usr/bin printf then grep ${HOME} echo export
+${HOME} cd printf && "$@" export test 'quoted text' x=1 then echo awk export
+		$(pwd) cd done 2>/dev/null readonly ${HOME} done -eu
+/usr/bin cd done test echo echo ${HOME} && "$1" echo grep ${HOME} sed
+	/usr/bin -eu --verbose awk | done | 'quoted text'
+	${HOME} test --verbose sed | cd | | --verbose echo sed test sed local cd 2>/dev/null
+		--verbose cd /usr/bin /usr/bin
+		then "$1" then grep echo "$1" ${HOME} 2>/dev/null then 'quoted text'
+		sed readonly && x=1 awk test awk ${HOME} 'quoted text' /usr/bin
+echo sed local test /usr/bin readonly
+&& ${HOME} cd cd export
+x=1 "$@" awk && x=1 "$@" x=1 cd /usr/bin
+		test done $(pwd) 2>/dev/null
+		&& test 'quoted text'
+/usr/bin | "$@" 'quoted text'
+	done $(pwd) 'quoted text' 'quoted text'
+	x=1 readonly test && "$1" cd cd "$@" echo /usr/bin grep |
+	"$@" readonly cd test x=1 printf ${HOME}
+echo grep | "$@" -eu --verbose printf /usr/bin --verbose "$@" echo echo
+		local && 'quoted text' /usr/bin grep export "$@"
+	x=1 cd && echo then grep x=1
+	test sed -eu printf 2>/dev/null
+-eu sed test local x=1 $(pwd) x=1 "$1"
+	&& x=1 then x=1 "$1" then /usr/bin sed echo | | readonly awk "$@" done
+	"$1" echo | grep awk ${HOME} readonly
+	test ${HOME} local awk export readonly done readonly
+		then test "$@" printf ${HOME} export local -eu /usr/bin
+	sed /usr/bin sed ${HOME} "$1" "$@" && --verbose -eu "$1" | readonly cd grep
+	'quoted text' x=1 -eu awk && --verbose /usr/bin
+&& grep 2>/dev/null "$@"
+		echo | awk $(pwd) ${HOME} local then $(pwd) printf ${HOME} -eu test 2>/dev/null
+		export "$1" 'quoted text' cd --verbose
+	$(pwd) grep /usr/bin x=1 "$1" local
+		awk $(pwd) $(pwd) sed awk echo
+-eu sed echo cd cd cd | "$@" /usr/bin /usr/bin /usr/bin "$1" /usr/bin && export
+x=1 "$1" | /usr/bin "$@" x=1 ${HOME} | then x=1 local test ${HOME} done -eu
+	-eu local 2>/dev/null grep grep awk then
+	local export export grep cd then | $(pwd) readonly
+$(pwd) printf ${HOME} && awk cd && then export printf -eu --verbose && /usr/bin
+then cd $(pwd) test --verbose
+	&& cd ${HOME} "$@" $(pwd) echo /usr/bin
+	done "$1" local sed done --verbose
+	${HOME} readonly readonly 'quoted text' then export ${HOME} --verbose
+	sed | && printf $(pwd) export echo "$@" printf echo
+		2>/dev/null echo cd local readonly "$@" "$@" --verbose "$1" -eu awk
+	export sed export local
+--verbose cd awk 'quoted text' local then "$@" 'quoted text'
+	test grep awk "$@" --verbose "$1" $(pwd) awk printf export /usr/bin printf
+		echo /usr/bin 'quoted text' echo | 'quoted text'
+	done echo 2>/dev/null printf
+		echo cd grep export test cd $(pwd) -eu grep $(pwd) "$1" 'quoted text'
+	local 'quoted text' readonly echo "$1" 2>/dev/null
+"$1" --verbose $(pwd) cd "$1"
+x=1 echo then cd export 2>/dev/null readonly sed
+	export then 'quoted text' 2>/dev/null "$@" "$1" cd /usr/bin grep | grep echo
+	then export grep && 2>/dev/null
+	done local x=1 echo echo awk test -eu -eu
+		x=1 local local x=1 2>/dev/null ${HOME} && grep --verbose test readonly "$1" printf
+&& ${HOME} "$@" then then
+readonly echo sed -eu $(pwd) grep 2>/dev/null
+/usr/bin ${HOME} export done readonly --verbose then
+	$(pwd) done x=1 echo 2>/dev/null
+"$@" "$1" x=1 --verbose "$@" done && grep --verbose /usr/bin
+	done readonly sed then "$1" -eu $(pwd) awk 'quoted text'
+	echo done awk 2>/dev/null 'quoted text' export
+	awk printf ${HOME} test 'quoted text' "$@" then --verbose awk &&
+		local x=1 done grep /usr/bin awk "$@" 'quoted text' export "$1" -eu echo "$1" echo
+	&& grep readonly "$@" grep --verbose
+$(pwd) echo echo && awk echo awk sed sed then echo cd test awk printf printf
+		done "$1" done printf "$1" sed "$@" cd readonly -eu grep local && /usr/bin
+		${HOME} printf sed $(pwd) $(pwd) "$@" grep
+		printf && awk "$1" "$1" cd awk printf /usr/bin readonly sed
+	-eu 'quoted text' grep test export sed /usr/bin printf "$@" 2>/dev/null
+		local | 2>/dev/null 2>/dev/null | sed -eu "$1" test
+	"$@" 'quoted text' 'quoted text' /usr/bin
+		x=1 'quoted text' 2>/dev/null printf
+then "$@" echo echo export --verbose x=1 awk readonly local &&
+printf && ${HOME} $(pwd) "$@" awk "$1" export
+	awk local export awk x=1 local --verbose sed -eu printf awk ${HOME} ${HOME}
+&& test 2>/dev/null /usr/bin
+		"$1" then done awk local export 2>/dev/null readonly readonly then ${HOME}
+	--verbose "$1" 'quoted text' 2>/dev/null printf awk printf -eu awk readonly "$1"
+		"$1" awk test local "$1" readonly test cd grep x=1 /usr/bin
+	readonly /usr/bin x=1 printf | local readonly
+export printf x=1 test "$@" cd /usr/bin && | "$@" awk echo export cd then readonly
+		${HOME} echo "$1" ${HOME} grep "$@" awk --verbose "$@" readonly sed /usr/bin
+		"$1" test export /usr/bin /usr/bin "$1" test awk 'quoted text'
+		test done export /usr/bin echo grep local ${HOME} export grep --verbose
+	&& /usr/bin grep x=1 "$@" --verbose
+	&& | echo printf 'quoted text' x=1 sed export --verbose --verbose
+	-eu done x=1 $(pwd) && sed 2>/dev/null --verbose
+		printf test --verbose ${HOME} printf grep $(pwd) readonly local export cd /usr/bin
+	"$1" sed ${HOME} ${HOME} 2>/dev/null
+	/usr/bin cd readonly ${HOME} 2>/dev/null "$@" "$1" /usr/bin
+'quoted text' then ${HOME} -eu 'quoted text' cd "$1" grep
+		echo -eu "$@" local readonly --verbose 'quoted text'
+'quoted text' printf grep sed $(pwd) echo echo done "$1" --verbose && $(pwd) grep
+	printf printf local done /usr/bin
+	then local export $(pwd) cd -eu local $(pwd) $(pwd) local
+		$(pwd) "$@" echo sed cd 'quoted text'
+		| then --verbose local /usr/bin export --verbose 'quoted text'
+awk then then cd test "$1" done grep $(pwd) -eu test done cd
+	"$1" test done printf /usr/bin echo "$@"
+	export "$@" done /usr/bin awk readonly
+	$(pwd) grep && | readonly sed cd test then then "$1" && sed done local sed
+readonly && local readonly --verbose
+local then ${HOME} /usr/bin x=1 'quoted text'
+readonly test readonly
+${HOME} "$@" printf readonly
+local grep sed local echo sed 'quoted text' "$1" then $(pwd) awk export /usr/bin
+done export 2>/dev/null x=1 done cd export echo export
+		printf 'quoted text' sed $(pwd) awk -eu printf readonly 'quoted text'
+	-eu x=1 readonly then --verbose grep export | 2>/dev/null --verbose awk export
+		sed printf ${HOME} grep -eu /usr/bin sed
+	done "$@" "$@" export then readonly $(pwd) local "$@" -eu readonly
+$(pwd) done grep awk awk $(pwd)
+		2>/dev/null local | local printf /usr/bin
+	local test export "$1" "$@" --verbose | export awk
+		readonly readonly readonly && x=1
+	$(pwd) done cd | printf x=1 awk printf then "$1" ${HOME} --verbose 'quoted text'
+		awk && cd 'quoted text' "$1" readonly 2>/dev/null export
+		2>/dev/null && sed done test ${HOME} ${HOME}
+		--verbose 'quoted text' done printf
+| 'quoted text' "$1" cd "$1"
+	&& sed grep -eu local export
+	test x=1 /usr/bin "$1" then | test readonly printf
+	2>/dev/null done grep readonly | test readonly local echo --verbose
+	/usr/bin 'quoted text' 'quoted text' cd ${HOME} "$1" readonly
+		x=1 test echo printf readonly && export "$@" grep
+	${HOME} $(pwd) /usr/bin test "$1" printf sed
+		readonly $(pwd) echo export sed done local ${HOME} 2>/dev/null "$1" cd "$1"
+	done $(pwd) -eu 'quoted text' "$@"
+	/usr/bin "$@" grep ${HOME} cd && 2>/dev/null local readonly /usr/bin echo "$1"
+		grep --verbose && x=1 local
+		| sed export ${HOME} x=1 $(pwd) x=1 local awk | local awk export
+		awk -eu 2>/dev/null export
+	cd readonly local "$1" echo then $(pwd) | echo ${HOME} --verbose export
+		2>/dev/null printf cd -eu --verbose && awk export printf -eu /usr/bin then 'quoted text'
+	"$1" grep ${HOME} /usr/bin then local then -eu local "$@"
+&& /usr/bin test readonly
+&& readonly test /usr/bin then /usr/bin $(pwd) cd 2>/dev/null
+/usr/bin test local echo ${HOME} test sed $(pwd) "$1" sed "$@" done &&
+		export echo local | 2>/dev/null local echo readonly
+	then /usr/bin "$@" readonly /usr/bin 'quoted text'
+2>/dev/null -eu && $(pwd) done --verbose x=1 test
+/usr/bin | x=1 $(pwd) echo /usr/bin 'quoted text' then
+$(pwd) $(pwd) 2>/dev/null export readonly
+	$(pwd) x=1 -eu -eu test 2>/dev/null $(pwd)
+'quoted text' "$@" export cd | 'quoted text' done
+	grep cd sed readonly readonly
+done cd grep -eu grep 'quoted text' export ${HOME} printf then 2>/dev/null cd
+	then ${HOME} export printf $(pwd) done x=1 "$1" -eu --verbose "$1" readonly
+		done && export | then test --verbose $(pwd)
+	test cd 2>/dev/null $(pwd) "$1" echo $(pwd)
+export -eu 'quoted text' --verbose 2>/dev/null
+/usr/bin "$@" ${HOME} grep --verbose
+readonly grep x=1 cd | | --verbose grep 'quoted text' x=1 done sed local
+		test export export | x=1 "$1" test $(pwd) 'quoted text' cd
+&& export "$@" awk printf echo
+		then awk grep x=1 "$@" 'quoted text' awk cd
+2>/dev/null awk 'quoted text'
+	| | printf grep test export awk readonly 2>/dev/null
+	sed cd cd "$1" 2>/dev/null $(pwd) cd ${HOME} "$1" grep export
+		2>/dev/null then "$@" readonly /usr/bin local --verbose local 2>/dev/null done
+${HOME} && test /usr/bin export /usr/bin done sed
+2>/dev/null x=1 | 'quoted text' x=1 $(pwd) export export /usr/bin
+		export test done ${HOME} export -eu local sed --verbose -eu "$@"
+		'quoted text' -eu && local sed ${HOME} grep awk then &&
+	local local local --verbose ${HOME} export "$1" test 2>/dev/null x=1
+		"$@" | local -eu /usr/bin x=1 grep echo echo | --verbose 2>/dev/null sed export
+export grep -eu grep "$1" -eu export x=1 "$1" echo test local --verbose local
+then 2>/dev/null readonly echo $(pwd) echo local done
+	| -eu 'quoted text' 2>/dev/null && printf && | awk
+awk && printf awk ${HOME} printf --verbose
+	local ${HOME} echo x=1 export local local then local /usr/bin
+	printf then -eu export 'quoted text'
+sed sed && grep -eu done x=1 export test then readonly | export
+cd 'quoted text' echo test "$1" grep export && /usr/bin $(pwd) grep printf sed
+	$(pwd) /usr/bin echo then | cd --verbose 2>/dev/null 'quoted text' 2>/dev/null 2>/dev/null
+$(pwd) "$@" && ${HOME} x=1 -eu echo sed echo 'quoted text' sed test ${HOME}
+	'quoted text' then local then
+	readonly local && awk && 'quoted text' -eu export ${HOME}
+		'quoted text' -eu printf sed
+	$(pwd) | done done then awk
+	x=1 $(pwd) --verbose cd $(pwd) grep local readonly "$@" 2>/dev/null
+test "$1" awk local sed | grep ${HOME} "$@" then grep 2>/dev/null /usr/bin done
+local ${HOME} readonly export awk then
+	then awk done -eu then "$@"
+		cd readonly --verbose grep cd x=1 local /usr/bin
+		echo local readonly echo test
+then 'quoted text' echo then && export "$1" test x=1 test "$1" && --verbose
+local 'quoted text' 'quoted text' 2>/dev/null then 'quoted text' test
+		then x=1 x=1 /usr/bin && printf grep printf -eu then --verbose echo x=1 --verbose
+	then "$1" echo 2>/dev/null 'quoted text' 'quoted text' awk -eu awk test local
+	local sed ${HOME} $(pwd) x=1 export -eu cd 2>/dev/null printf ${HOME} printf then
+		printf cd 'quoted text' | awk sed "$1" sed $(pwd) 2>/dev/null
+	2>/dev/null ${HOME} sed --verbose "$1" sed | export /usr/bin
+	&& $(pwd) | grep -eu 2>/dev/null then export then --verbose done "$1"
+		readonly test then grep /usr/bin local export cd readonly 'quoted text' "$@"
+--verbose --verbose /usr/bin -eu export awk export "$@" "$1" --verbose
+	printf local $(pwd) cd --verbose readonly echo readonly test grep
+awk | sed 'quoted text' grep
+	grep "$1" "$@" /usr/bin && local "$1" && awk "$1" | | sed /usr/bin
+	awk x=1 export readonly ${HOME} cd "$@" | -eu 2>/dev/null /usr/bin readonly &&
+	'quoted text' then local ${HOME} sed printf cd "$1"
+printf x=1 ${HOME} -eu x=1 local "$@" --verbose --verbose "$@" done 'quoted text'
+awk export cd && printf echo
+'quoted text' ${HOME} local done | "$1" 2>/dev/null --verbose then /usr/bin $(pwd)
+		"$1" "$@" 'quoted text' && 2>/dev/null
+	awk -eu $(pwd) "$1" $(pwd) done "$@" printf --verbose
+/usr/bin grep "$@" --verbose x=1 && readonly awk local readonly
+&& -eu readonly "$@" export /usr/bin test $(pwd) "$@"
+	2>/dev/null "$1" ${HOME}
+export --verbose $(pwd) done -eu cd export /usr/bin sed "$1" done "$1" /usr/bin
+	done "$1" "$@" export readonly 2>/dev/null grep grep
+| /usr/bin awk test ${HOME} 2>/dev/null test local x=1 cd local ${HOME}
+x=1 -eu --verbose done then test $(pwd) x=1
+		awk local "$1" | sed && /usr/bin 2>/dev/null
+	'quoted text' done | local x=1 x=1 grep awk "$1" -eu x=1
+	/usr/bin && test sed |
+${HOME} test local --verbose grep printf 'quoted text' awk readonly
+	test "$@" 'quoted text' /usr/bin x=1 | echo 2>/dev/null grep --verbose
+	then awk echo x=1 --verbose done local $(pwd)
+		awk sed x=1 readonly grep awk -eu grep
+	x=1 export -eu -eu x=1 grep && ${HOME} export 2>/dev/null --verbose echo echo
+| printf | x=1 awk --verbose /usr/bin
+	cd local -eu $(pwd) printf
+cd ${HOME} sed awk ${HOME}
+	grep sed grep /usr/bin /usr/bin local echo ${HOME} local --verbose
+	$(pwd) "$1" test echo /usr/bin
+		$(pwd) cd printf --verbose x=1 then readonly
+		'quoted text' cd $(pwd) "$@" x=1
+	sed readonly test then export then 2>/dev/null cd then
+local test sed echo --verbose then && ${HOME} echo sed $(pwd)
+	--verbose printf test "$1" echo cd sed then export
+	cd -eu $(pwd) test local
+	then /usr/bin "$1" export x=1 ${HOME} "$1" --verbose printf
+	"$1" 2>/dev/null --verbose && printf echo && |
+		readonly sed x=1 done "$1" test
+"$@" export --verbose 2>/dev/null
+&& | echo "$@" echo echo readonly test readonly
+		export 2>/dev/null local -eu | ${HOME} ${HOME}
+		local test cd -eu "$1" x=1 local && "$@" awk
+	--verbose awk printf --verbose 2>/dev/null sed 'quoted text'
+	awk /usr/bin -eu readonly
+	--verbose echo /usr/bin test local echo cd --verbose $(pwd) | readonly
+echo "$@" test /usr/bin --verbose | --verbose "$@" && &&
+	$(pwd) ${HOME} done && sed export $(pwd) x=1 awk && local x=1 local echo
+	printf export readonly grep "$1" "$@" test test 'quoted text' printf
+		sed printf printf "$1" -eu && --verbose done "$@" -eu --verbose /usr/bin
+sed echo readonly 'quoted text' cd done "$@" done grep awk test && x=1 done
+		"$@" | ${HOME} "$1" done done export awk sed printf sed x=1 --verbose
+		echo --verbose done 'quoted text' x=1 cd local -eu readonly
+then done awk then awk then 'quoted text' --verbose
+		x=1 local printf 'quoted text' && done local grep readonly test grep --verbose
+test sed test && grep "$@" "$1" |
+	${HOME} done | 2>/dev/null test x=1 local 2>/dev/null
+cd local x=1 test "$1" 'quoted text' echo then | $(pwd) "$1" export printf --verbose
+		"$@" readonly test echo "$1" /usr/bin local done cd local printf ${HOME}
+	| "$@" sed 2>/dev/null grep "$@" awk "$1" "$@" $(pwd) then local awk test readonly
+	-eu 'quoted text' -eu && ${HOME} awk ${HOME} $(pwd) && test awk readonly 2>/dev/null
+		| echo $(pwd) test sed "$1" ${HOME} --verbose export /usr/bin ${HOME} grep echo
+	then then ${HOME} "$@" cd 2>/dev/null
+		2>/dev/null "$@" "$1" sed awk | test ${HOME}
+&& readonly && /usr/bin x=1 "$@" printf /usr/bin
+| awk /usr/bin "$1" printf "$@" awk ${HOME} -eu local 2>/dev/null awk
+done awk printf then test cd echo --verbose export
+	done then 2>/dev/null cd awk /usr/bin x=1 x=1 test
+	${HOME} local && "$@" done printf /usr/bin
+| -eu | export done | awk test /usr/bin $(pwd)
+		awk 'quoted text' 'quoted text' 'quoted text'
+		"$@" "$1" ${HOME} "$1" &&
+x=1 grep x=1 grep && printf printf readonly echo
+| grep grep export export | cd printf echo x=1 'quoted text' 2>/dev/null echo
+		cd printf echo -eu sed grep | /usr/bin
+		sed sed awk awk 'quoted text' x=1 readonly awk | $(pwd)
+sed grep "$@" awk cd local ${HOME} echo -eu 'quoted text'
+	${HOME} x=1 | ${HOME} readonly then
+	/usr/bin test readonly 'quoted text' $(pwd)
+		local grep $(pwd) -eu export grep grep grep sed ${HOME} export 2>/dev/null printf
+	then ${HOME} /usr/bin ${HOME} ${HOME} cd --verbose x=1 grep local | /usr/bin export
+then grep export -eu awk local local readonly
+then sed sed $(pwd) x=1 grep echo done 2>/dev/null local printf | -eu
+local 2>/dev/null | local && $(pwd) sed
+readonly echo local done --verbose
+local | 'quoted text'
+cd cd awk $(pwd) "$1" | grep "$@"
+grep 2>/dev/null "$1" -eu
+		/usr/bin grep "$@" awk sed | done then x=1 | export x=1 echo
+		done "$@" --verbose --verbose export -eu cd export
+	"$1" | 2>/dev/null "$1" readonly ${HOME} then sed then export readonly && printf
+		| test then done printf -eu 2>/dev/null
+		x=1 | grep | "$@" readonly test && sed "$@"
+grep ${HOME} 2>/dev/null
+	/usr/bin awk "$1" "$1" "$1" --verbose | "$1" echo
+| ${HOME} done $(pwd) 'quoted text' /usr/bin readonly 2>/dev/null
+echo /usr/bin export done done
+		cd 2>/dev/null test then sed grep 'quoted text' "$@" ${HOME} cd awk
+	grep | $(pwd) then 'quoted text' cd && 'quoted text'
+	grep sed 'quoted text' && echo && then local local readonly ${HOME} --verbose printf
+	then "$@" 'quoted text'
+	readonly export 2>/dev/null -eu
+		grep then "$@" | then "$@" -eu echo export
+	'quoted text' && awk grep done ${HOME} x=1 local awk && --verbose
+	${HOME} test export ${HOME} grep cd local grep && then ${HOME} -eu
+	echo test | printf 'quoted text' export "$1"
+		echo $(pwd) 'quoted text' sed echo x=1 cd
+	local cd sed grep && 2>/dev/null $(pwd) | 'quoted text' |
+		&& -eu 2>/dev/null "$1" awk export cd readonly "$1" /usr/bin test
+	grep echo cd printf "$@" cd done | local awk -eu export
+cd done readonly awk
+	awk | awk sed awk test done 2>/dev/null readonly x=1 $(pwd)
+	sed ${HOME} echo printf "$@" && | sed local cd cd $(pwd) local printf && | $(pwd)
+		"$1" $(pwd) grep test
+&& local ${HOME} grep readonly then then
+	$(pwd) $(pwd) local done sed | test local && echo $(pwd)
+	local --verbose x=1 /usr/bin "$@" && sed
+export local awk /usr/bin && then readonly --verbose local
+		"$1" export done 'quoted text' sed
+		&& then test 2>/dev/null 2>/dev/null x=1 "$@" sed done export
+--verbose then --verbose 'quoted text' echo "$@" "$1" echo 'quoted text'
+--verbose "$@" x=1 printf echo echo --verbose -eu grep "$1"
+	--verbose done export --verbose then ${HOME} awk readonly
+2>/dev/null sed export grep "$1" cd /usr/bin 'quoted text' x=1 awk | local then
+	then local ${HOME} export sed
+cd | -eu readonly printf export ${HOME} $(pwd) 2>/dev/null export grep
+		"$1" then /usr/bin /usr/bin
+		sed export 'quoted text' "$1" "$@" "$1" grep $(pwd) && printf printf sed local
+local test awk --verbose grep
+		cd /usr/bin && test ${HOME} x=1 sed
+sed then | 'quoted text'
+		/usr/bin | $(pwd) -eu cd -eu test -eu echo $(pwd) printf
+		echo --verbose 'quoted text'
+	"$1" "$@" sed echo -eu ${HOME}
+readonly 'quoted text' printf ${HOME} 'quoted text' echo export /usr/bin done test
+test /usr/bin cd "$@" "$@" "$@" "$1" printf done $(pwd)
+	done --verbose --verbose "$@" grep $(pwd) awk awk -eu
+	&& then readonly sed ${HOME} x=1 /usr/bin $(pwd)
+2>/dev/null local --verbose export 'quoted text' ${HOME}
+	sed -eu done --verbose export export "$@" test -eu local cd |
+		"$1" local readonly /usr/bin sed 2>/dev/null x=1 test readonly 'quoted text'
+--verbose done "$1" done echo x=1 | 2>/dev/null "$@" && echo printf
+		then "$@" | x=1 $(pwd) ${HOME} readonly printf
+		"$1" 2>/dev/null printf | "$@" sed readonly printf
+		${HOME} printf $(pwd) sed
+	grep awk "$1" "$@" --verbose
+	export -eu sed /usr/bin x=1 awk echo export test && /usr/bin $(pwd)
+&& $(pwd) cd 2>/dev/null 2>/dev/null "$@" readonly echo ${HOME} export
+	awk "$1" x=1 sed awk --verbose --verbose "$@" "$1"
+		$(pwd) && printf grep -eu 2>/dev/null cd $(pwd) printf then
+	readonly grep | grep cd sed echo
+	/usr/bin readonly grep test readonly -eu 'quoted text' cd cd
+	x=1 printf then sed printf && then
+--verbose $(pwd) -eu && cd $(pwd) then test cd x=1 -eu done test && cd echo export
+"$1" 'quoted text' done -eu
+	printf x=1 2>/dev/null 2>/dev/null cd awk "$1" -eu --verbose
+	x=1 2>/dev/null cd --verbose
+		'quoted text' sed "$@" cd ${HOME} grep then x=1 done test awk local
+	"$@" local | -eu echo -eu echo sed test "$@" "$1" 2>/dev/null export
+		-eu sed | "$@" echo test --verbose --verbose 2>/dev/null x=1 | sed test sed then
+cd local 'quoted text' | -eu grep done printf --verbose ${HOME}
+		'quoted text' cd export done /usr/bin test readonly "$1" "$@" readonly
+		| x=1 "$@" printf | 'quoted text'
+"$1" --verbose cd --verbose readonly readonly ${HOME} --verbose 'quoted text'
+		"$1" "$@" awk "$@" ${HOME}
+/usr/bin "$1" ${HOME} test cd $(pwd) -eu && --verbose 'quoted text'
+		'quoted text' "$1" -eu cd grep 'quoted text' ${HOME} test done
+2>/dev/null export --verbose -eu echo
+cd done test awk sed /usr/bin
+	2>/dev/null "$@" grep
+	export --verbose sed echo then
+		${HOME} cd | 2>/dev/null x=1 2>/dev/null local readonly 2>/dev/null
+		echo "$@" then "$1" ${HOME} ${HOME} && then -eu echo printf $(pwd) cd ${HOME}
+2>/dev/null awk x=1 "$1" sed 2>/dev/null $(pwd) echo 2>/dev/null "$1"
+		done ${HOME} && local "$1"
+"$1" -eu then "$1" awk printf && cd grep echo readonly &&
+--verbose export --verbose local sed x=1 && echo done test --verbose then ${HOME}
+echo && cd printf awk 2>/dev/null sed then test $(pwd)
+		| cd | awk readonly test $(pwd) then ${HOME}
+		/usr/bin test cd 2>/dev/null awk done printf then sed && x=1
+		grep export 'quoted text' $(pwd) printf readonly export
+done 'quoted text' "$1" -eu printf $(pwd) readonly
+	"$1" done printf echo x=1
+		2>/dev/null done test --verbose /usr/bin
+	2>/dev/null 2>/dev/null 2>/dev/null
+		| grep 'quoted text' 2>/dev/null
+		-eu x=1 done -eu "$@" grep
+	x=1 test awk readonly test sed test sed test grep grep | "$1" $(pwd) readonly cd
+		"$@" x=1 awk 2>/dev/null | echo
+cd echo echo printf test then done "$@"
+${HOME} test && --verbose ${HOME} ${HOME} --verbose | then awk printf test && grep
+#include c193.sh
+then && 'quoted text' cd && "$@" echo $(pwd) | 'quoted text' -eu
+export x=1 "$@" $(pwd) -eu grep 2>/dev/null 2>/dev/null -eu echo awk /usr/bin
+${HOME} x=1 done then ${HOME} $(pwd) x=1 "$1" -eu
+		--verbose export 2>/dev/null | test x=1 && "$1" --verbose grep then
+	x=1 2>/dev/null x=1 printf printf | export x=1 grep printf local awk then
+	--verbose 2>/dev/null cd echo cd ${HOME}
+--verbose --verbose readonly test awk printf --verbose | sed
+	cd 2>/dev/null grep 2>/dev/null awk --verbose |
+	test sed local then test $(pwd) 'quoted text' readonly
+		/usr/bin x=1 "$@" 2>/dev/null echo
+-eu x=1 grep grep x=1 export --verbose /usr/bin cd -eu --verbose grep test x=1 "$1"
+${HOME} && "$@" test done readonly cd
+	&& 2>/dev/null --verbose --verbose sed export grep printf grep
+		2>/dev/null && awk then test echo local x=1 && |
+cd ${HOME} cd ${HOME}
+grep readonly "$@" "$@" done local x=1 then local local cd local
+then -eu "$1" 'quoted text' then readonly echo grep done done
+		--verbose local grep /usr/bin "$1" grep
+		2>/dev/null done 'quoted text' /usr/bin x=1 grep awk | -eu echo awk x=1 sed | done
+readonly local cd "$@"
+printf export local "$1" | | $(pwd) local test test ${HOME} grep | test
+	| test done && cd x=1 && test
+		then grep | local "$@" local grep
+		export cd 2>/dev/null $(pwd) awk $(pwd) printf
+"$1" done /usr/bin readonly export test $(pwd) x=1 'quoted text'
+	sed $(pwd) readonly awk "$1" awk export
+		sed grep printf | && export test $(pwd)
+		readonly export --verbose
+	then readonly "$@" then readonly printf printf "$1" "$@" --verbose |
+'quoted text' grep | test --verbose local
+		$(pwd) grep grep grep done echo printf awk "$@" echo
+		/usr/bin readonly local test 2>/dev/null test -eu --verbose 2>/dev/null
+	&& export $(pwd) x=1 awk local
+		export awk 2>/dev/null awk then ${HOME} "$@" x=1 cd && 'quoted text'
+		cd --verbose "$1" 2>/dev/null
+		readonly then "$1" "$1" ${HOME} && readonly echo then cd echo
+	readonly /usr/bin "$@" local 'quoted text'
+local --verbose printf grep /usr/bin test local && test ${HOME} echo 2>/dev/null
+cd local /usr/bin -eu 2>/dev/null --verbose && test --verbose grep --verbose
+	awk "$@" ${HOME} | grep then $(pwd) ${HOME}
+	"$@" readonly echo readonly test ${HOME} x=1 $(pwd)
+	local export then grep done 2>/dev/null local ${HOME} test --verbose
+		"$1" ${HOME} grep awk sed "$@" echo readonly
+		--verbose x=1 grep then /usr/bin
+	readonly ${HOME} sed -eu x=1 "$@" local /usr/bin then
+		x=1 --verbose | export 2>/dev/null
+		"$1" printf -eu grep export test grep echo grep readonly echo /usr/bin 'quoted text'
+		test x=1 readonly ${HOME} --verbose
+		--verbose readonly "$@" x=1 "$@" then --verbose --verbose | ${HOME}
+		export --verbose sed echo readonly done "$@" 2>/dev/null local
+	${HOME} 'quoted text' readonly 'quoted text'
+		&& then local done --verbose done -eu awk local 'quoted text' 2>/dev/null ${HOME}
+$(pwd) echo grep awk local done && grep "$1" awk
+	2>/dev/null printf test | 2>/dev/null "$@" export
+		readonly -eu ${HOME} echo --verbose grep printf test awk "$@"
+	${HOME} "$1" $(pwd) x=1 awk done x=1 2>/dev/null
+	-eu | cd | test 2>/dev/null 'quoted text' x=1 "$1"
+		then export export export readonly $(pwd) printf
+test 2>/dev/null ${HOME} done
+local grep "$1" local export local -eu && readonly printf test /usr/bin
+readonly 2>/dev/null grep -eu 2>/dev/null printf done
+	done 'quoted text' 2>/dev/null 'quoted text'
+		| $(pwd) "$@" --verbose local --verbose | test
+	then local && -eu awk grep local
+"$@" && export && done test cd "$1" --verbose printf -eu --verbose readonly
+test "$@" awk export test printf grep -eu 2>/dev/null &&
+sed readonly printf readonly
+	2>/dev/null x=1 readonly echo $(pwd) /usr/bin
+	&& then && export /usr/bin grep sed $(pwd) 'quoted text' done local --verbose
+	&& -eu $(pwd) local printf && printf printf done --verbose then echo grep
+		'quoted text' then readonly && printf -eu local
+then /usr/bin echo test 2>/dev/null done then cd sed x=1 test
+		/usr/bin echo | ${HOME} /usr/bin then 2>/dev/null | then -eu 'quoted text'
+	2>/dev/null -eu test grep grep ${HOME} awk done done
+	--verbose /usr/bin sed -eu test printf test then "$@"
+	/usr/bin local printf /usr/bin --verbose done && "$@"
+$(pwd) -eu 'quoted text' /usr/bin x=1 local export --verbose
+/usr/bin cd then x=1 x=1 --verbose local done export readonly -eu grep
+		/usr/bin local test x=1 test sed $(pwd) echo printf local readonly then test -eu
+	sed "$1" --verbose 'quoted text' then export awk "$1"
+	echo -eu -eu test local "$1" awk | $(pwd)
+		2>/dev/null then --verbose readonly test ${HOME} test cd printf
+		cd $(pwd) echo -eu sed --verbose printf grep test
+	"$@" && 2>/dev/null -eu sed "$@" "$@" ${HOME} local ${HOME} sed
+		| sed echo ${HOME} && "$@" /usr/bin printf x=1 export sed echo export &&
+	done local | awk grep && cd && | test 2>/dev/null
+		test local printf printf 2>/dev/null -eu test awk 2>/dev/null
+		printf -eu local export cd awk readonly $(pwd) /usr/bin
+cd $(pwd) | sed "$@" --verbose grep ${HOME} | 2>/dev/null "$1" --verbose
+echo "$1" grep sed readonly && --verbose 2>/dev/null ${HOME} --verbose grep readonly
+		local local export test "$1" 'quoted text'
+	test printf "$1" awk echo x=1 readonly local awk
+--verbose && test -eu "$@" 2>/dev/null
+	then x=1 ${HOME} $(pwd) printf
+		| --verbose "$1" cd awk grep grep $(pwd) test x=1 export sed cd local | ${HOME}
+--verbose export then | "$@" readonly
+x=1 ${HOME} readonly echo then readonly test ${HOME} ${HOME} export
+sed done awk /usr/bin ${HOME} -eu 2>/dev/null ${HOME} -eu readonly
+'quoted text' awk "$1" | 'quoted text'
+	/usr/bin echo 2>/dev/null -eu then
+		-eu "$1" x=1 ${HOME} done
+awk --verbose awk ${HOME} "$1" printf 2>/dev/null x=1 "$@" x=1 echo "$@"
+		$(pwd) local then 2>/dev/null /usr/bin sed --verbose
+&& printf export export local && printf 'quoted text'
+		test awk --verbose printf done x=1 printf printf local
+		--verbose "$@" printf grep then -eu $(pwd)
+		test "$@" echo grep "$1" export printf ${HOME} && echo local && "$1" export
+x=1 sed | | grep sed test ${HOME} -eu x=1 test
+		--verbose ${HOME} test readonly local -eu done 'quoted text' --verbose test
+	/usr/bin local --verbose x=1 ${HOME} $(pwd) $(pwd) then
+	${HOME} 'quoted text' sed /usr/bin test
+	grep test readonly $(pwd) x=1 "$1" echo ${HOME} test $(pwd) done --verbose
+		2>/dev/null done /usr/bin grep "$@" 2>/dev/null printf | 'quoted text'
+2>/dev/null sed export local && then
+		-eu "$@" x=1 readonly -eu x=1 sed grep local done readonly "$@"
+local export cd 2>/dev/null
+then && "$@" then 'quoted text'
+		local "$1" local sed --verbose 'quoted text' 'quoted text' "$@" export export
+		then test ${HOME} ${HOME} test readonly --verbose local
+	then done --verbose export | printf export -eu
+awk && then /usr/bin x=1 test x=1 2>/dev/null ${HOME} test awk grep
+		-eu test "$1" readonly $(pwd)
+	"$@" readonly printf test awk -eu
+		export x=1 grep grep grep sed $(pwd) echo 'quoted text' -eu
+		| "$@" cd 'quoted text' local "$1" cd /usr/bin -eu --verbose
+test && cd ${HOME} then /usr/bin echo /usr/bin printf cd
+'quoted text' awk grep 'quoted text' grep /usr/bin
+	/usr/bin $(pwd) export test | test $(pwd) -eu
+	readonly $(pwd) local test $(pwd) 'quoted text'
+-eu awk awk && | 'quoted text' sed "$@" $(pwd) 'quoted text'
+		awk test then --verbose
+		&& done local --verbose awk 'quoted text'
+cd readonly local sed
+x=1 awk export x=1 2>/dev/null done && then local
+echo echo -eu sed ${HOME} 'quoted text' sed /usr/bin 2>/dev/null grep cd 2>/dev/null
+		grep ${HOME} local grep 'quoted text' awk grep cd $(pwd)
+${HOME} x=1 "$1" "$@" grep $(pwd) done grep sed then test
+		--verbose | x=1 done sed echo awk grep
+	-eu echo /usr/bin awk /usr/bin test 2>/dev/null
+${HOME} local --verbose /usr/bin export -eu x=1 local /usr/bin readonly
+/usr/bin 2>/dev/null cd | echo done "$1" done --verbose 2>/dev/null
+sed "$@" | then x=1 done echo --verbose export ${HOME} && test /usr/bin awk sed
+local test | printf "$@" echo local
+	local then then -eu $(pwd) --verbose -eu 2>/dev/null && then $(pwd) then readonly
+	test awk 2>/dev/null readonly local grep printf done -eu ${HOME}
+${HOME} local local sed done
+		done ${HOME} 2>/dev/null $(pwd) $(pwd) --verbose
+readonly readonly test 'quoted text'
+		x=1 $(pwd) sed cd done readonly x=1 "$1" export echo
+		"$@" 2>/dev/null && /usr/bin --verbose test awk done test sed -eu test
+	echo "$@" echo "$@" 'quoted text' |
+	done 'quoted text' sed x=1 ${HOME} readonly echo then -eu done -eu --verbose local
+		/usr/bin sed && /usr/bin ${HOME} --verbose --verbose
+grep 2>/dev/null $(pwd) local sed local | 'quoted text' /usr/bin
+awk readonly /usr/bin
+	'quoted text' export 2>/dev/null test | 'quoted text' printf cd test
+then printf echo then && grep 2>/dev/null export printf ${HOME}
+&& test 'quoted text' -eu "$1"
+	readonly --verbose awk $(pwd) "$@" cd 'quoted text'
+	"$@" readonly --verbose export | cd x=1 echo
+printf printf -eu 'quoted text'
+cd local printf readonly done 2>/dev/null x=1 then sed sed sed
+	then && awk local awk "$@" /usr/bin test cd x=1 done "$@" | export 2>/dev/null
+	| | 2>/dev/null && echo "$1" x=1 -eu "$1" | x=1 done readonly
+	awk x=1 done printf $(pwd) -eu /usr/bin
+		&& then "$1" | ${HOME} "$@"
+		sed sed && readonly x=1 /usr/bin done "$1" x=1 $(pwd) 2>/dev/null
+		"$1" --verbose done "$1" test awk readonly cd grep echo ${HOME} printf x=1
+&& printf 'quoted text' -eu /usr/bin x=1
+	2>/dev/null $(pwd) printf test
+		grep -eu sed 'quoted text' sed -eu export cd -eu local -eu $(pwd)
+then export sed readonly 2>/dev/null export
+	--verbose echo | 'quoted text'
+	"$1" $(pwd) echo sed | done /usr/bin /usr/bin grep then 'quoted text' done
+	-eu then sed test export echo echo done test done then local echo then /usr/bin
+--verbose x=1 && grep export | "$1"
+	grep /usr/bin printf awk /usr/bin sed --verbose
+	echo $(pwd) cd | | awk "$1" "$1" readonly $(pwd) then
+	${HOME} done awk x=1 then sed readonly then export cd 2>/dev/null
+		grep 2>/dev/null 'quoted text' echo "$@" readonly
+		local cd echo export "$@" local -eu
+	echo printf "$@" --verbose local export
+"$@" test --verbose then x=1 'quoted text' -eu cd grep
+	export export export "$1" done 2>/dev/null
+	&& done $(pwd) export readonly 2>/dev/null then --verbose test 'quoted text'
+		awk 2>/dev/null /usr/bin ${HOME} -eu 2>/dev/null 'quoted text'
+echo cd sed | cd x=1 then awk
+"$1" cd readonly export "$@" then "$1" local --verbose "$@" sed | done
+	readonly echo done --verbose 'quoted text' printf --verbose test done printf
+		sed "$@" awk local export local $(pwd)
+		readonly $(pwd) /usr/bin -eu grep awk | then "$@"
+done test $(pwd) "$1" then local --verbose printf printf && "$1" $(pwd)
+readonly cd grep "$@" $(pwd)
+--verbose done local local "$1" --verbose cd printf x=1 | test grep | export
+		printf x=1 --verbose "$@" --verbose --verbose
+"$@" 'quoted text' ${HOME} x=1 export local echo printf awk
+2>/dev/null "$1" local then awk
+		cd cd grep -eu ${HOME} | local "$@" sed ${HOME} "$1" sed done readonly printf
+	awk export readonly -eu printf printf echo then
+	"$@" test /usr/bin test export local 2>/dev/null && | done done ${HOME}
+	"$1" && test then test done /usr/bin
+test cd "$1" cd export /usr/bin awk sed x=1 then grep cd
+	${HOME} grep && && ${HOME} sed 2>/dev/null done $(pwd) &&
+"$1" test printf printf done test && test -eu local
+	sed ${HOME} readonly "$1" export "$1" awk x=1 readonly 'quoted text'
+	| done printf awk --verbose 2>/dev/null done grep 2>/dev/null
+x=1 done -eu && local |
+--verbose grep | $(pwd) $(pwd) export &&
+-eu 'quoted text' printf "$1" | local test printf sed "$1"
+	--verbose done local then /usr/bin test "$1" x=1 "$@" export x=1 then awk $(pwd)
+		'quoted text' awk 'quoted text' grep x=1 cd ${HOME} readonly
+--verbose x=1 grep | cd test /usr/bin grep "$@" cd 2>/dev/null
+	readonly && 2>/dev/null echo printf local "$1" done
+printf 2>/dev/null x=1 then
+		readonly cd printf ${HOME} | ${HOME} sed 2>/dev/null
+| echo done readonly awk grep && 2>/dev/null
+		| | "$1" done then readonly x=1 then
+		"$1" local sed sed local test awk awk test -eu then | ${HOME} "$@"
+	-eu test -eu printf "$1" sed then 'quoted text' 2>/dev/null local echo printf -eu
+		export x=1 echo "$@" readonly awk x=1 sed x=1 ${HOME} -eu printf export
+2>/dev/null --verbose 'quoted text'
+		grep printf grep && echo readonly
+export --verbose && echo printf sed awk printf local 'quoted text' /usr/bin
+		printf readonly export test readonly readonly
+	local grep printf && then export x=1 grep sed awk sed | export --verbose
+printf export echo echo "$@" "$@" $(pwd) cd
+then printf grep 'quoted text'
+/usr/bin 2>/dev/null then export /usr/bin done x=1 grep 'quoted text' export -eu
+export x=1 then -eu grep export sed sed ${HOME} ${HOME} awk 'quoted text'
+	awk test x=1 | then awk $(pwd) readonly echo "$@" --verbose
+	sed awk -eu ${HOME} echo 'quoted text' ${HOME} "$@" test readonly ${HOME}
+		local test --verbose then printf grep readonly 2>/dev/null x=1 | local printf
+done awk $(pwd) $(pwd) export
+export sed 'quoted text' sed "$@" "$@"
+	'quoted text' printf printf readonly 'quoted text' export
+	sed then local --verbose 'quoted text' test echo && sed sed awk
+test echo /usr/bin x=1 then sed x=1 "$@"
+		local done then printf readonly grep
+		local ${HOME} awk awk "$1" "$1" local
+&& echo /usr/bin -eu echo readonly x=1 then then echo 2>/dev/null
+		x=1 sed readonly --verbose
+		--verbose grep x=1 "$1" test done grep local 'quoted text' /usr/bin ${HOME}
+	then test grep "$@" local test printf && 2>/dev/null
+		"$1" 2>/dev/null "$1" test cd grep test test -eu | | && ${HOME}
+	then x=1 grep echo export done | test /usr/bin export | sed done
+		${HOME} printf done | echo printf 2>/dev/null -eu echo cd ${HOME} test --verbose
+--verbose readonly -eu 'quoted text' -eu /usr/bin grep "$@"
+		awk test grep 'quoted text' echo $(pwd)
+	local awk -eu grep $(pwd) local -eu /usr/bin done
+	--verbose echo --verbose $(pwd) readonly done then && $(pwd)
+sed 2>/dev/null 'quoted text' | -eu --verbose
+	$(pwd) done readonly awk export awk "$@" 2>/dev/null echo
+	grep cd /usr/bin printf ${HOME} awk readonly 'quoted text' ${HOME} "$1" -eu
+$(pwd) ${HOME} ${HOME} ${HOME} --verbose echo echo 'quoted text'
+/usr/bin cd readonly sed
+	${HOME} 2>/dev/null grep "$@" | $(pwd) echo local x=1 cd export
+		printf ${HOME} $(pwd) sed $(pwd) x=1 sed "$@" "$1" done local
+	'quoted text' /usr/bin done ${HOME} | local
+	/usr/bin echo local | printf export echo "$1" && /usr/bin 2>/dev/null
+		cd cd printf && && --verbose 2>/dev/null "$1"
+		readonly -eu "$@" x=1 grep |
+	grep then -eu sed awk local awk /usr/bin "$1" echo -eu 2>/dev/null echo
+		readonly printf | local "$@" done readonly 2>/dev/null then
+		export | && "$1" done export "$@" 'quoted text' 'quoted text' "$@"
+$(pwd) local -eu && sed awk | -eu | readonly | cd sed --verbose && /usr/bin
+		printf export && awk done grep "$@" grep && readonly 'quoted text'
+		local 2>/dev/null ${HOME} printf x=1 --verbose | test local "$@"
+		$(pwd) x=1 test sed | -eu "$1" printf $(pwd) 2>/dev/null then "$@" grep
+		readonly x=1 local -eu readonly 2>/dev/null
+		readonly printf local --verbose grep grep cd $(pwd)
+echo readonly -eu | -eu printf done | /usr/bin x=1 --verbose
+		cd printf 'quoted text' "$@" readonly sed "$1" done --verbose
+-eu 2>/dev/null -eu -eu local done x=1 echo readonly -eu 'quoted text'
+		--verbose test export then then
+sed echo $(pwd) readonly readonly done x=1 export
+/usr/bin export test grep sed
+	/usr/bin "$@" /usr/bin echo && 'quoted text'
+	grep -eu readonly -eu cd test && $(pwd) 'quoted text' 'quoted text'
+${HOME} done local 'quoted text' grep awk awk 2>/dev/null sed --verbose
+		"$@" | --verbose ${HOME} test local sed && 'quoted text'
+	"$@" | then /usr/bin "$@" awk | ${HOME} 'quoted text' 'quoted text' "$1"
+		done local readonly local $(pwd) test done then 2>/dev/null
+	test x=1 /usr/bin | /usr/bin | readonly /usr/bin awk && ${HOME}
+		--verbose ${HOME} then $(pwd) ${HOME} echo printf | "$@" x=1 $(pwd) then
+$(pwd) 'quoted text' "$@" awk export --verbose echo 2>/dev/null
+		then cd done done local cd && $(pwd) -eu && echo
+		grep grep then local echo 2>/dev/null then
+$(pwd) x=1 readonly readonly && /usr/bin readonly --verbose echo $(pwd) | ${HOME}
+	| readonly sed test "$@" 'quoted text' echo "$1" then then test "$1"
+		$(pwd) echo /usr/bin $(pwd) /usr/bin
+${HOME} grep --verbose 2>/dev/null /usr/bin --verbose test cd x=1
+	cd -eu cd 'quoted text' done echo printf done done done grep done
+	printf printf grep 2>/dev/null awk
+	/usr/bin | $(pwd) cd -eu cd cd awk readonly printf printf /usr/bin sed printf
+	${HOME} printf printf readonly
+then | echo local 'quoted text' 2>/dev/null
+		&& done -eu cd ${HOME}
+		readonly then done sed x=1 local cd /usr/bin local
+	test printf sed "$1" -eu "$@" awk cd local
+	"$@" cd then x=1 2>/dev/null
+	done 2>/dev/null "$@" printf awk "$@" awk 'quoted text' readonly 'quoted text'
+	grep /usr/bin x=1 'quoted text' test /usr/bin x=1
+grep 2>/dev/null x=1 done cd 2>/dev/null
+		&& $(pwd) --verbose "$1" local
+x=1 -eu cd "$@" cd -eu -eu awk x=1 sed grep
+--verbose test -eu 'quoted text' && readonly
+&& 'quoted text' test "$1" cd echo ${HOME} then -eu
+	awk grep awk ${HOME} | && then printf x=1 cd awk $(pwd) then
+--verbose 'quoted text' cd sed
+		-eu cd | export "$@" cd 2>/dev/null --verbose "$1" --verbose local
+then | then "$@" $(pwd) cd -eu local "$1" x=1 cd export echo "$@" echo printf
+	readonly ${HOME} grep export --verbose cd $(pwd) x=1 2>/dev/null /usr/bin
+--verbose -eu printf local && 2>/dev/null awk -eu sed ${HOME} export
+	grep /usr/bin grep -eu --verbose -eu sed local printf $(pwd) && ${HOME}
+		cd printf echo cd awk x=1 readonly readonly test grep cd "$@"
+		"$@" $(pwd) sed "$@" export && export
+		sed sed readonly sed ${HOME} --verbose printf
+printf printf test export x=1 cd then --verbose
+		"$1" $(pwd) grep "$1" sed test grep "$@"
+		--verbose local test x=1 readonly sed -eu readonly "$@" ${HOME} echo
+sed 'quoted text' && "$@" $(pwd) ${HOME} x=1 x=1 readonly | sed ${HOME}
+	local echo sed done "$1" sed awk sed grep 2>/dev/null
+/usr/bin -eu printf printf ${HOME} 2>/dev/null
+	printf cd export export sed readonly ${HOME} | ${HOME} 'quoted text' local then
+	export echo "$1" then done local
+echo grep ${HOME} 2>/dev/null ${HOME} test 'quoted text'
+	"$1" echo sed ${HOME} grep
+-eu x=1 --verbose | "$1" export "$@" ${HOME} 'quoted text' grep ${HOME} | sed "$@"
+	export 'quoted text' printf local && grep then echo echo $(pwd)
+		sed 'quoted text' "$1"
+		then readonly && grep x=1 "$@" "$@" awk readonly local && export | test
+	awk $(pwd) sed readonly
+	grep then sed echo echo printf "$@"
+	sed cd grep /usr/bin echo ${HOME} printf
+		/usr/bin | ${HOME} -eu $(pwd) 'quoted text' --verbose printf
+$(pwd) 2>/dev/null then sed 2>/dev/null
+${HOME} cd "$@" | then x=1 printf 'quoted text' grep $(pwd) "$@" --verbose
+		"$1" | readonly && &&
+x=1 readonly export echo grep cd cd |
+		awk -eu done $(pwd) "$@" 'quoted text' then | test echo
+		&& ${HOME} ${HOME} && local sed sed done /usr/bin
+	cd cd ${HOME} ${HOME} "$@" ${HOME} ${HOME}
+	--verbose --verbose $(pwd) --verbose -eu printf $(pwd)
+		export then echo grep
+-eu 2>/dev/null awk --verbose /usr/bin
+	export printf 'quoted text'
+		echo then done awk awk local local 'quoted text' ${HOME} cd "$@" awk awk
+		&& grep && "$1" $(pwd) "$@" test | cd x=1 printf | /usr/bin cd "$1" readonly export
+	cd cd then echo $(pwd) ${HOME} sed then "$1" 2>/dev/null
+test local /usr/bin then 'quoted text' "$1" done $(pwd)
+		&& -eu /usr/bin ${HOME} -eu "$@" done readonly awk then x=1 -eu
+local cd cd | $(pwd) x=1 export done
+		test "$1" test x=1 $(pwd) then $(pwd) /usr/bin local
+readonly /usr/bin export readonly "$@"
+	done done ${HOME} grep echo
+then ${HOME} sed cd awk grep
+		"$1" done 'quoted text' printf printf 2>/dev/null /usr/bin export
+grep /usr/bin | awk --verbose echo 2>/dev/null readonly echo
+	local awk echo 'quoted text' --verbose cd && && 2>/dev/null
+		local printf "$1" then $(pwd) sed 'quoted text'
+"$1" && then 2>/dev/null sed readonly
+	-eu /usr/bin $(pwd) printf
+		'quoted text' && sed | |
+	then sed | x=1 test export export ${HOME}
+	'quoted text' printf echo --verbose "$1" sed readonly test local sed "$@"
+--verbose readonly ${HOME} -eu export test && "$@" ${HOME}
+readonly | export 'quoted text' --verbose echo test
+	awk done ${HOME} test printf /usr/bin local /usr/bin
+		export $(pwd) | grep test echo done
+"$1" cd done $(pwd) | cd "$1" local test grep ${HOME} grep sed /usr/bin
+	cd ${HOME} sed "$1" export $(pwd) local "$@" echo local then sed sed
+		done 'quoted text' ${HOME} local
+	"$@" 'quoted text' /usr/bin cd awk then x=1 awk export grep cd done
+	local "$@" | /usr/bin readonly
+	--verbose printf printf then sed readonly -eu done done echo grep then readonly
+awk "$1" "$1" 'quoted text'
+		cd $(pwd) /usr/bin awk x=1 -eu export
+--verbose then ${HOME} sed sed | "$1" 2>/dev/null && 2>/dev/null 2>/dev/null
+		awk then cd done cd readonly | 'quoted text' 'quoted text' readonly echo | "$@"
+		sed 2>/dev/null done printf
+		sed "$1" export printf && done --verbose readonly test $(pwd) "$1"
+	2>/dev/null printf cd grep grep && test | | x=1 readonly local
+		local "$@" done echo "$1" echo "$@" test $(pwd) test "$@" then
+		"$@" && done /usr/bin test "$@" | test --verbose $(pwd) /usr/bin "$1" cd "$1"
+	'quoted text' "$1" sed local x=1 readonly sed
+		grep && then | test readonly 'quoted text' awk x=1 done "$1"
+	export test x=1 -eu readonly 2>/dev/null "$@" sed --verbose printf export
+	'quoted text' export done local && $(pwd) ${HOME}
+x=1 cd awk x=1 $(pwd) 2>/dev/null "$@" | test awk awk export cd
+--verbose 'quoted text' awk "$@" /usr/bin -eu grep 2>/dev/null done --verbose
+	$(pwd) local 'quoted text' -eu
+		$(pwd) && 'quoted text' /usr/bin x=1 grep
+2>/dev/null echo printf
+"$1" ${HOME} $(pwd) |
+	echo test "$@" awk -eu then --verbose
+		export $(pwd) 'quoted text'
+	x=1 x=1 /usr/bin grep $(pwd) -eu /usr/bin "$1" then | ${HOME}
+		awk -eu local && | 2>/dev/null
+		/usr/bin readonly readonly grep
+		${HOME} export grep then then /usr/bin
+2>/dev/null cd awk x=1 done then $(pwd) | "$@" "$@"
+readonly readonly $(pwd) --verbose sed 2>/dev/null export "$1" export test
+"$1" echo ${HOME} test /usr/bin /usr/bin
+printf echo 2>/dev/null awk "$1" |
+done x=1 cd "$@" done echo then export 2>/dev/null
+		then done && local --verbose
+	-eu awk "$1" x=1 "$@" -eu awk 'quoted text' grep x=1 --verbose
+		export cd -eu && sed local grep awk then echo printf export /usr/bin ${HOME}
+		&& /usr/bin | | grep export grep done | && grep $(pwd) | then
+done grep local grep "$1" echo "$@" readonly --verbose grep
+awk then -eu awk $(pwd) "$@" && sed "$@" readonly "$1" $(pwd)
+		cd /usr/bin && /usr/bin
+		"$@" "$@" 'quoted text' printf
+$(pwd) then 2>/dev/null echo && local --verbose | grep && ${HOME} "$1" done
+		printf ${HOME} export "$1" export export test -eu export "$1" | 2>/dev/null "$@"
+		--verbose export cd readonly $(pwd) sed
+	--verbose sed 'quoted text' local
+	printf $(pwd) export 'quoted text' -eu --verbose echo -eu "$1" && export /usr/bin
+&& && /usr/bin 'quoted text' echo sed 'quoted text' then
+-eu 'quoted text' $(pwd) then 2>/dev/null grep $(pwd)
+		printf -eu $(pwd) "$1"
+		-eu cd awk x=1 cd 2>/dev/null echo | | test done cd /usr/bin
+		x=1 --verbose "$@" /usr/bin readonly 2>/dev/null
+test awk $(pwd) 2>/dev/null && /usr/bin readonly $(pwd) 'quoted text'
+	${HOME} then x=1 then awk 2>/dev/null
+	'quoted text' x=1 readonly
+		$(pwd) "$1" 2>/dev/null export | sed 'quoted text' &&
+	local awk awk "$1" "$1" echo 2>/dev/null
+		sed -eu 'quoted text' sed
+	2>/dev/null x=1 sed ${HOME} ${HOME} then
+then printf --verbose test grep ${HOME} ${HOME} && | test "$1" -eu echo
+	&& "$@" readonly export /usr/bin ${HOME} awk "$@" | echo
+		${HOME} cd done 2>/dev/null x=1 -eu export sed local awk ${HOME}
+	'quoted text' && cd awk done printf then ${HOME} done grep
+		awk --verbose test 'quoted text' x=1 sed then x=1 test done 2>/dev/null
+sed export printf $(pwd) x=1 $(pwd) grep 'quoted text'
+/usr/bin --verbose -eu "$1" local printf ${HOME} "$1" printf --verbose
+		cd local | cd export -eu ${HOME} local local grep | ${HOME} grep /usr/bin "$@"
+	$(pwd) sed grep ${HOME} test | /usr/bin
+		-eu /usr/bin | local 2>/dev/null
+x=1 x=1 then awk cd echo 2>/dev/null local
+		'quoted text' /usr/bin "$@" "$@" && && 2>/dev/null ${HOME} local
+	grep --verbose cd awk --verbose test readonly export sed $(pwd) x=1 "$@"
+		| $(pwd) && grep && 2>/dev/null 'quoted text' ${HOME} sed ${HOME} ${HOME}
+	"$1" export --verbose local -eu /usr/bin -eu --verbose echo
+	echo -eu readonly done x=1 sed 2>/dev/null 'quoted text' --verbose readonly local
+		${HOME} awk local /usr/bin echo sed local readonly
+${HOME} sed $(pwd) "$1" 2>/dev/null
+-eu done | x=1 local $(pwd) && $(pwd)
+done cd export readonly | awk sed -eu -eu ${HOME} grep $(pwd) /usr/bin
+	local done "$1" 'quoted text' local | 2>/dev/null "$@" | cd export grep
+&& | "$@" "$1" | $(pwd) && then && grep test done && local
+		export echo -eu local sed readonly
+		$(pwd) echo then 2>/dev/null /usr/bin awk 2>/dev/null
+		&& -eu && 2>/dev/null cd then cd ${HOME}
+		echo echo done x=1 "$1" sed | 2>/dev/null
+		printf sed $(pwd) grep 'quoted text' local ${HOME} /usr/bin
+"$@" done awk /usr/bin 'quoted text' ${HOME}
+		echo 'quoted text' cd ${HOME} /usr/bin
+		| ${HOME} --verbose printf /usr/bin echo x=1 ${HOME} awk export --verbose
+	${HOME} "$1" 2>/dev/null sed && "$1" echo
+		${HOME} local export export $(pwd)
+		echo "$@" --verbose /usr/bin --verbose ${HOME} cd /usr/bin
+	cd grep grep 2>/dev/null sed test export --verbose x=1 && sed -eu x=1
+$(pwd) local test done x=1 sed done then $(pwd)
+then --verbose awk test grep /usr/bin cd | printf | sed export ${HOME} --verbose
+	local awk sed "$1" x=1 "$@" 2>/dev/null x=1 /usr/bin 2>/dev/null cd then
+2>/dev/null ${HOME} sed "$@" echo
+		'quoted text' echo "$1" export x=1 printf "$1" && done then --verbose
+	printf awk echo x=1 sed "$1" -eu done
+	echo echo 2>/dev/null done "$1" test printf cd
+local cd $(pwd) -eu done --verbose -eu && then sed -eu
+export | 'quoted text'
+	--verbose done && "$@" echo export "$1" grep ${HOME}
+		awk ${HOME} "$1" --verbose
+		'quoted text' test 'quoted text' printf --verbose x=1 2>/dev/null readonly
+	echo sed awk /usr/bin export 'quoted text' readonly grep export $(pwd)
+| echo grep "$@" -eu --verbose
+		"$1" awk readonly test 2>/dev/null readonly awk test test
+printf --verbose --verbose
+	printf export ${HOME}
+	awk "$1" echo test x=1 'quoted text' test cd $(pwd) done export done
+		local readonly awk local --verbose export
+		/usr/bin printf x=1 && echo local awk export "$@" /usr/bin $(pwd) grep
+	'quoted text' export && && | "$1" printf done local
+		/usr/bin 'quoted text' "$1" /usr/bin x=1 local /usr/bin echo
+readonly echo 'quoted text' "$1" export awk then local
+		&& grep | then "$1" awk cd then | then 'quoted text' 'quoted text'
+	-eu 'quoted text' 'quoted text' local echo -eu printf done /usr/bin
+		test cd /usr/bin --verbose |
+		sed sed 'quoted text' /usr/bin test --verbose
+&& --verbose echo readonly export export ${HOME}
+	-eu test awk local readonly sed local "$1" sed local cd printf
+	printf grep 'quoted text' x=1
+'quoted text' grep awk echo done export readonly 'quoted text' sed printf
+		-eu | /usr/bin --verbose local readonly printf echo
+		/usr/bin $(pwd) printf then /usr/bin x=1 grep /usr/bin "$@" 2>/dev/null
+&& -eu -eu /usr/bin --verbose "$1" /usr/bin awk awk grep $(pwd) readonly -eu
+x=1 done "$@" then awk "$1"
+		| cd awk ${HOME} printf cd && test
+cd -eu "$1" && ${HOME} 2>/dev/null then $(pwd) $(pwd) x=1 2>/dev/null --verbose
+		local export -eu /usr/bin 2>/dev/null
+	"$1" local cd 'quoted text'
+-eu export --verbose /usr/bin echo export local cd /usr/bin
+		x=1 "$1" "$@" awk echo export export --verbose cd -eu awk x=1 local
+	| ${HOME} "$1" cd then readonly then 'quoted text'
+		&& sed test then cd 2>/dev/null
+	local readonly | local cd "$1" export
+	| $(pwd) sed readonly grep x=1 $(pwd) echo /usr/bin grep awk sed awk x=1 local
+readonly test export awk $(pwd) sed
+	$(pwd) cd && readonly $(pwd) readonly "$@" readonly
+"$1" | grep --verbose readonly 2>/dev/null $(pwd) test grep
+		'quoted text' "$@" export "$1" "$1" test x=1 --verbose 'quoted text' /usr/bin
+		done sed "$1" $(pwd) sed echo local --verbose $(pwd)
+	done --verbose ${HOME} && printf awk && sed 'quoted text' 'quoted text'
+		${HOME} --verbose test test printf
+	'quoted text' -eu test
+sed -eu 'quoted text' -eu cd 2>/dev/null ${HOME} readonly | "$1"
+	x=1 2>/dev/null readonly printf x=1 export
+	--verbose echo "$@" "$1" test awk awk --verbose export grep
+awk -eu then test printf
+		-eu -eu "$1" 'quoted text'
+	export cd 2>/dev/null export export grep --verbose sed cd
+	$(pwd) "$@" awk 2>/dev/null cd done && && then | grep sed --verbose
+	local 2>/dev/null echo readonly /usr/bin
+		2>/dev/null then 'quoted text'
+	sed | sed 'quoted text' x=1 cd then then x=1 2>/dev/null cd
+then local test sed | then ${HOME} sed && test "$1" local x=1 "$1" sed /usr/bin
+		echo local test then printf && grep x=1 grep
+"$1" printf $(pwd) "$@"
+awk echo /usr/bin | readonly export | "$1" awk cd 2>/dev/null grep ${HOME}
+		/usr/bin "$@" /usr/bin export
+&& | && x=1 then sed done test readonly -eu --verbose
+	/usr/bin && export then export 'quoted text' 'quoted text'
+	x=1 "$1" printf "$1" -eu awk done sed "$@" x=1
+--verbose awk grep grep x=1 readonly ${HOME}
+	"$@" "$1" | awk export 'quoted text' test printf $(pwd) | | sed
+local --verbose awk "$@" 'quoted text' $(pwd) awk && cd echo
+	sed | x=1 echo echo then "$1" 2>/dev/null done grep 'quoted text' printf "$1"
+	/usr/bin grep ${HOME} awk grep
+test local -eu x=1 | "$@" $(pwd) export readonly readonly --verbose
+		test | sed "$@" 'quoted text'
+	&& | echo done grep 'quoted text' ${HOME}
+/usr/bin printf local --verbose sed -eu
+		test local readonly export local test grep $(pwd) 'quoted text'
+		/usr/bin /usr/bin done echo | local
+	printf 2>/dev/null test sed readonly --verbose test /usr/bin
+	readonly "$1" echo && then echo
+		${HOME} printf then $(pwd) cd ${HOME}
+	echo "$1" sed $(pwd) then readonly awk
+	--verbose echo --verbose then && /usr/bin awk "$1"
+		export cd local ${HOME} && awk local $(pwd) &&
+$(pwd) /usr/bin --verbose ${HOME}
+		&& then && 2>/dev/null then -eu awk readonly $(pwd)
+	&& local && x=1 readonly --verbose local ${HOME} printf -eu && "$@" printf
+	&& x=1 ${HOME} readonly grep local && | -eu && $(pwd) printf readonly grep
+	"$1" export awk sed "$@" done "$1" grep
+		&& echo grep --verbose
+	'quoted text' done && "$@" done readonly sed "$1" --verbose 2>/dev/null 2>/dev/null
+	| $(pwd) done cd done $(pwd) x=1 --verbose && | /usr/bin
+	&& done done 2>/dev/null sed cd cd 2>/dev/null sed sed ${HOME} sed
+	echo done /usr/bin readonly done 2>/dev/null
+-eu cd local export x=1 local done echo done -eu x=1 awk "$@" /usr/bin
+		export printf "$1" ${HOME} awk ${HOME} sed "$1" && "$1"
+sed 'quoted text' "$@" | /usr/bin
+	export then /usr/bin
+		--verbose printf echo $(pwd)
+		sed cd done ${HOME} done && awk readonly
+readonly ${HOME} printf -eu export
+	sed /usr/bin | cd then local
+	cd local printf 'quoted text' --verbose ${HOME} --verbose "$@" test -eu then
+printf done $(pwd) | grep done grep done $(pwd)
+	&& $(pwd) awk && && 'quoted text' awk | local
+	x=1 "$1" x=1 awk export then export 'quoted text'
+echo $(pwd) $(pwd) grep -eu echo
+		sed echo grep readonly readonly printf readonly sed
+		test sed --verbose --verbose then export local local --verbose ${HOME} 'quoted text'
+sed x=1 -eu -eu 'quoted text' printf printf 2>/dev/null grep cd echo
+	export then --verbose x=1 && 'quoted text' echo && sed local $(pwd) 2>/dev/null
+		local 'quoted text' 2>/dev/null cd local 'quoted text'
+sed test ${HOME} 'quoted text'
+	test export sed x=1 printf readonly echo sed grep 2>/dev/null
+readonly test /usr/bin grep
+	| && printf awk && test grep
+cd readonly 2>/dev/null 'quoted text' export done ${HOME} sed cd && ${HOME} local
+	done readonly /usr/bin ${HOME} && && ${HOME} --verbose export $(pwd)
+${HOME} done "$@" "$1" "$@"
+cd done --verbose && 'quoted text' 'quoted text'
+local --verbose echo then awk "$@" then
+${HOME} export echo "$1" done -eu echo | /usr/bin "$@" test printf printf
+		then /usr/bin "$@" "$@" readonly sed 'quoted text' "$@" sed printf cd
+		readonly "$1" /usr/bin | cd "$@"
+		echo then | local cd done export local && echo 'quoted text' "$@" | grep
+		local printf | ${HOME} export test sed sed sed
+		readonly "$1" | then 2>/dev/null local export
+done then then test local grep echo then "$@"
+&& x=1 -eu 'quoted text' "$@" 2>/dev/null
+	/usr/bin | ${HOME} awk printf x=1 2>/dev/null
+awk local grep then test awk awk awk local 'quoted text' | local | test
+printf -eu 'quoted text' done ${HOME} echo export &&
+	&& printf awk x=1 printf readonly grep echo
+	done $(pwd) "$@" "$@" local then sed done export
+$(pwd) local done awk $(pwd)
+		sed ${HOME} ${HOME} | done echo grep --verbose
+	local then local $(pwd) awk && -eu printf 2>/dev/null -eu -eu done x=1
+	&& x=1 -eu then local test printf | "$1"
+	-eu echo sed readonly "$1" 'quoted text'
+	awk test readonly export "$1" echo done sed
+test | -eu 2>/dev/null sed cd $(pwd)
+	'quoted text' echo test printf
+		local 2>/dev/null /usr/bin --verbose cd 2>/dev/null
+	"$@" $(pwd) cd printf readonly | x=1 grep x=1 2>/dev/null $(pwd) --verbose
+	'quoted text' --verbose "$@" printf
+	${HOME} echo printf done "$1" $(pwd) /usr/bin
+		local printf cd x=1 test "$1" /usr/bin ${HOME} grep --verbose
+	then echo printf --verbose
+	then "$@" "$@" --verbose grep awk cd
+	sed then 'quoted text' done export then done | printf sed $(pwd) ${HOME}
+test grep "$1" 'quoted text' -eu "$@" then 2>/dev/null
+		readonly x=1 /usr/bin -eu readonly awk --verbose awk test sed
+x=1 "$@" -eu 2>/dev/null 'quoted text' sed /usr/bin
+'quoted text' 'quoted text' x=1 "$@" 'quoted text'
+		done readonly printf "$@" && -eu echo echo ${HOME} "$@" $(pwd) local done grep
+${HOME} /usr/bin -eu ${HOME} && awk grep echo cd done grep test
+&& 'quoted text' | local cd /usr/bin | awk cd "$1" 2>/dev/null 'quoted text'
+cd "$@" && 2>/dev/null --verbose grep test "$@" local
+	"$@" export cd && $(pwd) /usr/bin ${HOME} grep
+	then /usr/bin then && $(pwd) echo export grep
+test grep && sed "$@" 2>/dev/null test 2>/dev/null
+	readonly --verbose -eu && -eu awk ${HOME} local export readonly
+		export $(pwd) export grep then grep test readonly readonly sed
+grep 'quoted text' x=1 "$1" 'quoted text' ${HOME} $(pwd) $(pwd) /usr/bin
+$(pwd) grep "$@" $(pwd)
+x=1 | && sed readonly then x=1 'quoted text' readonly && sed sed cd export "$1"
+then /usr/bin awk cd cd 2>/dev/null then $(pwd) cd ${HOME} $(pwd) 2>/dev/null
+awk 'quoted text' test
+	test then | local cd x=1 export -eu x=1 awk --verbose
+--verbose "$@" "$@" 'quoted text' awk sed -eu --verbose "$1" awk 'quoted text'
+		${HOME} x=1 x=1 "$@" printf
+test $(pwd) ${HOME} readonly $(pwd) --verbose
+test x=1 "$@" --verbose export
+	readonly --verbose local --verbose printf "$1"
+		awk ${HOME} "$1" $(pwd) grep echo readonly readonly
+		-eu | && "$@" echo 2>/dev/null
+echo ${HOME} /usr/bin x=1 --verbose grep --verbose grep readonly sed --verbose
+	then $(pwd) x=1 local grep echo && --verbose grep sed x=1 "$1" test
+		| -eu /usr/bin cd sed readonly $(pwd) cd && then readonly x=1 echo |
+		then readonly $(pwd) done ${HOME} readonly $(pwd) 'quoted text' printf done printf
+echo sed done /usr/bin readonly done -eu 'quoted text' printf grep export
+readonly test echo done && readonly && "$1"
+x=1 "$@" cd --verbose ${HOME} grep --verbose readonly
+test "$@" grep --verbose "$@" | x=1
+		$(pwd) awk --verbose --verbose done done then /usr/bin /usr/bin
+		export /usr/bin | ${HOME} local
+		x=1 "$1" x=1 2>/dev/null "$1" printf
+		done -eu grep readonly echo printf awk awk done ${HOME}
+	--verbose && $(pwd) grep --verbose "$@" echo sed -eu grep -eu
+		/usr/bin 'quoted text' 'quoted text' done -eu grep | export test
+	awk done 2>/dev/null then done 'quoted text' test && readonly echo then "$@"
+	--verbose --verbose export printf /usr/bin "$1" sed "$1" grep
+		readonly readonly | --verbose 2>/dev/null cd echo /usr/bin
+2>/dev/null echo "$1" -eu "$1" local "$1" export x=1 printf done done
+		&& -eu | | -eu -eu awk then --verbose
+done $(pwd) export $(pwd) -eu awk 2>/dev/null 2>/dev/null | $(pwd)
+	done printf readonly /usr/bin -eu x=1 readonly grep test
+		done sed | awk /usr/bin x=1 && 2>/dev/null echo $(pwd) /usr/bin printf 2>/dev/null
+then export --verbose 'quoted text' then export awk && test ${HOME} /usr/bin
+	test -eu | ${HOME} && awk 'quoted text'
+$(pwd) test && "$@" --verbose cd readonly -eu printf ${HOME} then
+	echo awk && done --verbose export -eu "$@" /usr/bin
+echo --verbose printf "$@" --verbose
+cd -eu then echo test done ${HOME} $(pwd) readonly
+printf --verbose printf /usr/bin then "$@" ${HOME} done sed then 2>/dev/null
+	"$1" then "$@" done cd sed -eu echo awk test then done readonly
+		sed 2>/dev/null cd && grep grep "$@" printf grep 'quoted text' local 'quoted text'
+"$@" && test cd cd cd then local readonly /usr/bin
+x=1 x=1 && sed | done awk sed export x=1 done /usr/bin ${HOME} printf
+then -eu | cd test ${HOME} -eu export | awk $(pwd) cd then 'quoted text'
+		echo local sed "$1" | test cd export
+	/usr/bin -eu --verbose echo && grep readonly && then -eu $(pwd)
+2>/dev/null -eu -eu echo test && /usr/bin sed local
+	$(pwd) -eu local grep local export 2>/dev/null local sed then awk then
+		echo 2>/dev/null printf awk 2>/dev/null && awk --verbose -eu echo test grep
+	readonly readonly test 'quoted text' readonly -eu export
+printf | --verbose /usr/bin grep ${HOME} -eu /usr/bin 2>/dev/null
+		'quoted text' readonly 'quoted text' cd grep && "$1" grep x=1 'quoted text' 'quoted text'
+sed /usr/bin 2>/dev/null x=1 | -eu awk printf test done 2>/dev/null
+		then 2>/dev/null awk ${HOME} sed test "$@" echo
+	--verbose && grep cd "$1" export printf export -eu ${HOME} "$1" ${HOME}
+		then then $(pwd) "$1" awk 2>/dev/null test done -eu printf
+--verbose then "$@" export "$@" readonly
+test $(pwd) "$@" x=1 /usr/bin --verbose
+	printf 2>/dev/null "$1" ${HOME}
+	${HOME} then echo readonly grep /usr/bin "$1" awk sed | x=1 --verbose
+		/usr/bin | echo grep /usr/bin -eu
+	echo echo cd "$1" -eu export "$1" printf done $(pwd) | test | awk x=1
+		printf && "$1" $(pwd) local $(pwd) then /usr/bin x=1
+	awk local grep grep echo then local &&
+		"$1" -eu awk | awk ${HOME} && readonly printf
+		2>/dev/null x=1 export export export $(pwd)
+test ${HOME} && echo -eu $(pwd) grep
+		"$1" 2>/dev/null export --verbose local grep /usr/bin $(pwd) grep
+	awk test --verbose echo grep "$@" | echo
+test /usr/bin -eu /usr/bin /usr/bin /usr/bin
+	--verbose printf readonly 2>/dev/null $(pwd) x=1 "$1" done grep 'quoted text'
+	test grep echo grep /usr/bin
+	then done then done && awk
+		${HOME} -eu 2>/dev/null $(pwd) && echo "$1" $(pwd) $(pwd)
+		| cd -eu "$@" export x=1 cd -eu && awk /usr/bin
+	cd readonly readonly /usr/bin | echo grep test
+	"$1" | 'quoted text' 'quoted text'
+$(pwd) export -eu && ${HOME} && done sed 2>/dev/null --verbose
+	grep /usr/bin | && sed && $(pwd) readonly
+		| | printf readonly "$1"
+		awk -eu | printf printf grep "$1" done /usr/bin -eu echo export --verbose /usr/bin
+		sed export grep echo --verbose
+		then then then /usr/bin 'quoted text' && test echo x=1 && "$1" local
+	"$@" printf test grep echo then ${HOME} 'quoted text' "$@" ${HOME} "$@" awk
+	local export done sed
+&& /usr/bin grep test | "$1" | test export "$@" --verbose "$1" readonly 2>/dev/null
+	2>/dev/null "$@" grep x=1 /usr/bin grep awk printf -eu readonly
+then echo readonly 'quoted text' echo "$1" grep --verbose ${HOME} -eu $(pwd)
+		$(pwd) && /usr/bin readonly $(pwd) awk "$1" grep test sed "$@"
+local --verbose local "$@" awk
+		--verbose | test grep | 'quoted text' awk /usr/bin sed "$1" x=1 "$@"
+		'quoted text' grep export local printf
+$(pwd) export printf /usr/bin printf "$@" /usr/bin grep cd export readonly
+	done --verbose sed readonly done 'quoted text'
+export cd echo grep then 2>/dev/null
+		awk readonly "$@" --verbose
+		done | "$@" done printf /usr/bin "$@" x=1 | printf
+		awk ${HOME} /usr/bin "$1" "$1" $(pwd) /usr/bin "$@" $(pwd)
+${HOME} local "$@" grep readonly -eu "$1" readonly ${HOME}
+	grep local 'quoted text' --verbose export awk readonly
+export -eu then export "$@"
+| grep done x=1 readonly export ${HOME}
+		-eu local --verbose --verbose cd 2>/dev/null cd readonly /usr/bin
+		sed done x=1 printf | 2>/dev/null && printf done 'quoted text' 'quoted text'
+	echo 'quoted text' -eu 'quoted text' x=1 local "$@" /usr/bin echo export
+x=1 printf awk local 2>/dev/null grep printf $(pwd)
+printf grep test awk local then --verbose "$1" grep -eu
+awk sed then then | echo export done awk --verbose x=1 export --verbose test printf
+cd /usr/bin 'quoted text'
+		/usr/bin | local readonly then "$@" && export echo "$1" "$1" ${HOME}
+		readonly readonly | 2>/dev/null export | && done
+		"$1" x=1 ${HOME} printf printf done "$@" 'quoted text'
+		| done then echo | "$@" done x=1 echo awk local done echo grep
+	printf then export test -eu local readonly
+'quoted text' x=1 sed --verbose /usr/bin && --verbose -eu readonly
+		'quoted text' && 2>/dev/null "$1" test 2>/dev/null done readonly -eu -eu
+$(pwd) -eu done x=1 | test cd grep done sed && 'quoted text' 2>/dev/null
+/usr/bin "$@" "$1" test | 2>/dev/null test | printf && ${HOME} |
+		$(pwd) cd "$@" x=1 x=1
+"$1" -eu export "$@" local done x=1
+		echo -eu 'quoted text' ${HOME} echo | local $(pwd) echo 2>/dev/null
+local echo | then done then --verbose 2>/dev/null 2>/dev/null && "$1" --verbose
+	-eu awk sed then 'quoted text' -eu echo awk ${HOME} x=1 cd echo
+then && && ${HOME} "$1" readonly awk x=1 export export
+${HOME} printf cd /usr/bin -eu local readonly
+	| x=1 2>/dev/null local cd echo
+awk | grep local x=1 grep test printf test "$@" local echo 2>/dev/null 'quoted text'
+sed 2>/dev/null "$1" ${HOME} "$1" echo done printf sed x=1 ${HOME}
+--verbose x=1 "$1" grep
+		local cd "$1" 'quoted text'
+	sed "$@" "$1" && test done sed --verbose /usr/bin "$1" "$@"
+	printf 2>/dev/null && ${HOME} cd awk -eu grep --verbose done
+		$(pwd) then sed test "$1" ${HOME} grep readonly 'quoted text' 2>/dev/null done
+	done ${HOME} | $(pwd)
+	cd readonly "$@" awk 'quoted text' 'quoted text' cd echo "$1" cd echo -eu local
+2>/dev/null 'quoted text' awk ${HOME} cd echo readonly
+	awk grep ${HOME} "$@" --verbose awk 'quoted text' echo
+	2>/dev/null done | awk cd | x=1 -eu
+		readonly echo "$1" local readonly export && then
+		$(pwd) cd local echo ${HOME} test 'quoted text' --verbose "$@" awk
+		printf then awk "$@" -eu then readonly "$@" awk cd grep grep --verbose
+	2>/dev/null | "$@" export 'quoted text'
+done x=1 /usr/bin done readonly 2>/dev/null ${HOME} | printf
+awk local printf cd --verbose 2>/dev/null /usr/bin local then printf
+	"$@" cd -eu test printf grep "$1" "$@"
+		printf $(pwd) --verbose -eu echo local
+		grep ${HOME} grep 'quoted text' 'quoted text' awk --verbose
+	"$1" -eu readonly 2>/dev/null awk --verbose ${HOME}
+	cd 2>/dev/null --verbose echo cd "$1" 2>/dev/null sed ${HOME} cd x=1 $(pwd)
+--verbose awk export x=1
+	echo | $(pwd) "$1" export then local printf -eu then local readonly
+		then "$@" | x=1 && 2>/dev/null x=1 awk -eu readonly
+	sed /usr/bin -eu "$@" $(pwd) readonly awk printf 'quoted text'
+	then then --verbose test
+	export | local done grep -eu
+	2>/dev/null ${HOME} $(pwd) | $(pwd) 'quoted text' readonly |
+	test 2>/dev/null grep test grep --verbose 'quoted text' $(pwd) -eu readonly
+	&& | awk | /usr/bin $(pwd) ${HOME} sed grep echo 2>/dev/null
+"$@" then awk /usr/bin test done awk sed 'quoted text' readonly "$1" &&
+		local sed awk test export cd test cd done x=1 readonly 2>/dev/null
+test local cd readonly local grep cd ${HOME}
+		2>/dev/null cd --verbose cd done /usr/bin sed readonly
+	local | cd 'quoted text' /usr/bin
+		sed | -eu "$1" | ${HOME} test grep
+| "$1" local | cd printf x=1 $(pwd) grep -eu -eu
+x=1 $(pwd) /usr/bin "$@" "$@" printf awk 'quoted text' readonly "$1"
+		-eu echo readonly printf cd -eu "$1" 'quoted text' /usr/bin sed cd
+sed ${HOME} done export 2>/dev/null then
+	grep --verbose grep cd grep done local export test 2>/dev/null -eu cd 'quoted text'
+		readonly && export ${HOME} -eu awk echo
+		"$@" $(pwd) "$@" "$@"
+$(pwd) "$1" sed --verbose awk then --verbose | 'quoted text' grep
+		-eu x=1 printf cd /usr/bin printf grep -eu "$@" export export
+	done 'quoted text' 2>/dev/null printf local cd grep $(pwd) /usr/bin cd x=1 && -eu
+| export --verbose 'quoted text' /usr/bin "$1" | cd $(pwd) awk /usr/bin
+		readonly /usr/bin "$1" then 'quoted text' "$@"
+	-eu awk export readonly --verbose "$1" test export printf "$@" awk 2>/dev/null
+	awk ${HOME} local cd
+	"$1" ${HOME} test && /usr/bin
+sed -eu $(pwd) 2>/dev/null
+--verbose export 'quoted text' local
+		&& sed 'quoted text' --verbose 'quoted text' done "$@"
+"$@" 2>/dev/null x=1 --verbose | "$1" test | "$1" x=1 sed cd
+		"$1" "$@" sed done grep then 2>/dev/null 2>/dev/null sed
+	cd test && awk export local "$@"
+/usr/bin export sed x=1 | printf then $(pwd) 2>/dev/null
+		awk $(pwd) 'quoted text' echo $(pwd) |
+export && then | 'quoted text' readonly
+		/usr/bin x=1 echo $(pwd) | export 2>/dev/null
+		-eu /usr/bin local local cd test /usr/bin test $(pwd) test export -eu
+	readonly && "$@" echo x=1 then 2>/dev/null $(pwd) /usr/bin "$1" x=1
+	done grep export then /usr/bin
+2>/dev/null awk then readonly
+test $(pwd) readonly -eu && $(pwd) then -eu sed cd test
+	cd x=1 export ${HOME} | sed printf
+		export export printf -eu test -eu "$@" 'quoted text' /usr/bin && -eu cd test
+	"$1" echo echo then -eu "$@" sed 'quoted text'
+		| cd && test "$1" ${HOME} 'quoted text' $(pwd) echo readonly local
+-eu grep --verbose cd local cd --verbose "$1" $(pwd) $(pwd) x=1 -eu
+/usr/bin && readonly done printf then
+/usr/bin x=1 echo export | --verbose ${HOME} printf
+		done ${HOME} done && printf cd
+	echo /usr/bin ${HOME} echo 'quoted text'
+&& export local printf done 2>/dev/null "$1" x=1 ${HOME} echo ${HOME} then done
+local --verbose /usr/bin && x=1 cd -eu then
+		test "$1" grep test 2>/dev/null --verbose 2>/dev/null
+		-eu && 'quoted text' grep local $(pwd) sed then export
+	&& "$1" --verbose awk && then done echo "$1"
+		readonly ${HOME} 'quoted text' /usr/bin
+&& local printf | --verbose echo 'quoted text'
+		"$@" done done then done
+${HOME} 'quoted text' sed --verbose local --verbose readonly /usr/bin
+		'quoted text' 'quoted text'
+then test then done | printf test $(pwd) -eu echo local cd cd
+-eu --verbose "$1" export 'quoted text' -eu sed export awk && --verbose
+		--verbose readonly 'quoted text' export export sed x=1 --verbose local test local
+		grep sed ${HOME} printf test ${HOME} readonly then then 2>/dev/null 'quoted text'
+		done 2>/dev/null -eu "$@" 2>/dev/null "$@" && -eu && readonly /usr/bin --verbose
+	printf then $(pwd) grep echo | /usr/bin sed export test -eu $(pwd) grep echo echo
+	${HOME} 'quoted text' 2>/dev/null
+	then | readonly 'quoted text' sed test grep done
+		sed grep printf "$1" -eu 2>/dev/null echo local ${HOME} --verbose printf "$1" sed
+	echo readonly awk test local 'quoted text' "$1" /usr/bin
+		'quoted text' x=1 x=1 test echo /usr/bin cd --verbose
+		local local printf x=1 -eu 'quoted text' then local awk cd grep done
+		--verbose -eu then 2>/dev/null export local cd echo readonly "$@" | --verbose
+--verbose awk && grep -eu
+	--verbose export 'quoted text' x=1 grep && x=1 | "$@" -eu done
+		"$@" test --verbose sed -eu
+	cd awk local awk awk printf | test
+	export cd cd 2>/dev/null --verbose | readonly awk && | 'quoted text' "$@" && printf
+		| export $(pwd) export readonly done then sed export /usr/bin
+		test export -eu $(pwd) "$1" export -eu
+	done awk readonly printf readonly
+	"$@" test readonly readonly
+	export sed sed x=1 then /usr/bin --verbose
+	"$1" $(pwd) awk export cd then grep 'quoted text'
+		$(pwd) | local | "$@" done x=1 ${HOME} -eu "$1"
+${HOME} readonly 'quoted text' x=1 $(pwd) echo
+	readonly cd | grep local
+	done test readonly && "$1" done $(pwd) $(pwd) "$1"
+"$@" awk done printf echo done cd --verbose echo
+	${HOME} 2>/dev/null 2>/dev/null ${HOME}
+then printf grep cd -eu /usr/bin
+test "$1" "$@" 'quoted text' export echo 2>/dev/null "$@"
+grep /usr/bin -eu awk -eu then export | /usr/bin
+	$(pwd) local readonly printf test 2>/dev/null
+--verbose sed -eu 'quoted text' local
+	sed local /usr/bin export "$1" grep /usr/bin
+"$1" export "$@" done $(pwd) | echo x=1 "$1" cd && test --verbose done
+/usr/bin awk then readonly readonly
+--verbose "$1" $(pwd) | printf
+"$1" then readonly grep cd 2>/dev/null /usr/bin then 'quoted text'
+		printf local ${HOME} done && "$@" printf
+		x=1 "$1" 'quoted text' 'quoted text' 2>/dev/null echo
+		/usr/bin /usr/bin export $(pwd) 'quoted text' --verbose
+		readonly readonly local x=1 done sed then 'quoted text' echo | test
+	awk done echo | x=1 done export $(pwd) printf x=1 awk cd grep done cd | 'quoted text'
+/usr/bin x=1 local --verbose "$1" --verbose "$@" x=1
+		$(pwd) grep test awk | local "$@" &&
+		test sed then local $(pwd) /usr/bin /usr/bin awk
+/usr/bin cd cd 2>/dev/null local ${HOME} 2>/dev/null $(pwd) grep then grep
+export "$1" && sed printf grep done -eu
+		2>/dev/null printf awk then grep 'quoted text' test then /usr/bin -eu readonly
+cd | "$1" 'quoted text' awk --verbose
+	echo sed local echo 'quoted text' done local grep 2>/dev/null
+done local --verbose cd echo export x=1 echo awk "$@" 2>/dev/null
+--verbose -eu export printf /usr/bin $(pwd)
+	x=1 awk awk readonly 'quoted text' | sed local /usr/bin
+readonly local "$1" awk cd local echo
+	test done -eu sed awk test export x=1 "$@" test ${HOME}
+	| ${HOME} grep 2>/dev/null $(pwd) /usr/bin --verbose export export $(pwd)
+/usr/bin readonly done echo printf "$1" echo done | "$@"
+	readonly /usr/bin --verbose | export grep -eu $(pwd)
+	export local grep done
+$(pwd) awk echo printf printf readonly then | |
+2>/dev/null | 2>/dev/null "$1" awk "$1" 'quoted text' x=1
+	readonly /usr/bin readonly grep | local "$@" sed /usr/bin test -eu /usr/bin awk
+	printf echo x=1 cd && 2>/dev/null local then
+		readonly ${HOME} awk done ${HOME}
+-eu ${HOME} echo export | ${HOME} grep --verbose export x=1
+	readonly -eu awk local x=1 'quoted text'
+	sed awk /usr/bin printf echo
+	local readonly cd sed x=1 cd -eu $(pwd) readonly
+		export $(pwd) export 'quoted text' && x=1 x=1 readonly printf ${HOME} && then
+		echo ${HOME} grep x=1 x=1 $(pwd) printf test test grep
+&& sed readonly test then printf grep -eu ${HOME} awk cd done readonly
+cd sed local /usr/bin
+	x=1 -eu test --verbose grep ${HOME} cd export /usr/bin echo done | && -eu cd
+test export ${HOME} export printf $(pwd) awk local done sed grep 'quoted text'
+	cd "$@" "$@" grep echo ${HOME}
+test grep then cd export sed test sed done readonly printf export then
+		/usr/bin done 2>/dev/null | "$1" "$1" sed /usr/bin /usr/bin --verbose
+	sed 2>/dev/null 2>/dev/null "$@" $(pwd) sed cd sed
+		export grep --verbose "$1" && -eu "$1" ${HOME} grep grep test readonly /usr/bin
+x=1 -eu printf 'quoted text' test "$1" 2>/dev/null echo
+		test /usr/bin readonly
+	sed | | -eu /usr/bin x=1 test done /usr/bin
+awk | "$@" readonly grep && $(pwd) cd -eu
+		$(pwd) readonly printf && local "$1" sed "$1" cd "$@" echo readonly && printf
+		'quoted text' awk $(pwd)
+grep export awk echo done awk local done cd x=1 && && /usr/bin ${HOME} done
+	2>/dev/null --verbose cd echo sed then awk local x=1 printf 2>/dev/null
+	"$1" x=1 done echo readonly ${HOME}
+	test -eu printf local local done x=1 $(pwd) then "$1" echo ${HOME} sed sed awk
+done test /usr/bin done --verbose 'quoted text' grep | echo -eu readonly
+		2>/dev/null printf "$@" x=1
+		${HOME} ${HOME} echo grep
+${HOME} sed x=1 2>/dev/null $(pwd) $(pwd) 'quoted text' grep $(pwd) /usr/bin
+echo done local then readonly readonly $(pwd) then test "$@" ${HOME} && x=1 test
+sed echo $(pwd) printf printf
+	| readonly && 'quoted text' then echo $(pwd) /usr/bin ${HOME}
+	${HOME} then $(pwd) cd echo /usr/bin done --verbose export sed 2>/dev/null
+export sed export x=1 2>/dev/null
+	readonly --verbose 'quoted text' sed cd -eu /usr/bin grep readonly && done
+	x=1 "$@" echo -eu echo
+	--verbose done cd | then --verbose "$1"
+	"$@" 'quoted text' 'quoted text' done sed ${HOME}
+		"$@" done grep echo | printf done -eu then echo then "$1"
+	then printf | local local x=1 awk local done /usr/bin
+	export then cd && then x=1 --verbose readonly | export sed && export grep printf
+		-eu ${HOME} /usr/bin test 2>/dev/null x=1 then export -eu --verbose
+export && /usr/bin | $(pwd) $(pwd) printf
+test && $(pwd) export cd "$@" 2>/dev/null "$1" $(pwd)
+		then done x=1 then && "$@"
+	sed readonly && then x=1 local -eu "$1" -eu awk cd readonly grep export sed printf
+		2>/dev/null x=1 && export then "$@" --verbose then 2>/dev/null export
+		done echo ${HOME} && $(pwd) export awk 'quoted text' &&
+test grep && local test 'quoted text' grep grep && /usr/bin done readonly then 2>/dev/null
+		--verbose $(pwd) then local printf $(pwd)
+test ${HOME} ${HOME} grep readonly && x=1 done printf
+test then $(pwd) ${HOME} export awk && awk readonly "$@" --verbose /usr/bin
+2>/dev/null x=1 test "$1" "$@" | | echo -eu 2>/dev/null
+	"$1" x=1 "$1" grep "$1" /usr/bin -eu then && -eu | -eu export
+	| "$@" done done && | 2>/dev/null done
+		/usr/bin && /usr/bin grep && awk "$1" 'quoted text' && test sed -eu sed awk
+		x=1 local echo --verbose done | && local "$@" x=1
+	awk && ${HOME} sed "$@" cd 2>/dev/null echo readonly
+	${HOME} export then | ${HOME} printf cd
+	sed --verbose && test cd "$1" awk cd -eu cd
+		${HOME} local $(pwd) ${HOME} grep cd -eu
+		export 'quoted text' awk echo /usr/bin $(pwd) && "$@" /usr/bin local
+		echo | x=1 test "$1" "$1" && | then /usr/bin test printf grep | awk "$1" x=1
+		/usr/bin export local "$1" printf then local cd local readonly
+	/usr/bin readonly awk printf | "$1" "$@" ${HOME} && 'quoted text'
+		echo --verbose "$@" 'quoted text' | "$1" grep echo
+		/usr/bin export local printf | "$1" --verbose awk done grep export
+		then -eu test | sed 'quoted text' awk cd | export
+		-eu printf --verbose local "$1" /usr/bin grep printf printf
+		'quoted text' 'quoted text' $(pwd) -eu echo 2>/dev/null
+	| /usr/bin cd echo "$@" && cd -eu local awk x=1 'quoted text' x=1 local then
+		local "$1" awk "$@" local "$@" $(pwd) grep && | awk sed done
+		grep local ${HOME} awk grep cd /usr/bin /usr/bin readonly
+	$(pwd) --verbose && x=1
+		cd -eu cd | "$1" | $(pwd) export grep ${HOME} grep &&
+		"$1" local then grep export echo cd && printf then 2>/dev/null grep echo &&
+	test x=1 ${HOME} local grep "$1" --verbose then "$1" --verbose export printf
+awk --verbose grep $(pwd) then /usr/bin
+		'quoted text' 2>/dev/null export | ${HOME} --verbose /usr/bin readonly 2>/dev/null
+	/usr/bin grep awk | 'quoted text' -eu
+		--verbose done "$1" | local "$@" 'quoted text'
+		-eu -eu local done x=1 $(pwd) ${HOME}
+	| sed 2>/dev/null 'quoted text' x=1 $(pwd) cd done /usr/bin
+	/usr/bin | ${HOME} "$@" test cd sed /usr/bin sed "$@" cd $(pwd) local && printf
+sed -eu then x=1 cd sed sed local cd cd done cd export 2>/dev/null readonly
+'quoted text' "$1" x=1 cd 'quoted text' export x=1 --verbose then
@@ -0,0 +1,2001 @@
+		test grep x=1 local awk "$@" $(pwd) local -eu then | && grep
+local export --verbose readonly printf printf cd 'quoted text' local 'quoted text'
+		${HOME} ${HOME} 'quoted text' cd test "$1" test echo && &&
+--verbose awk awk $(pwd) && local --verbose x=1 ${HOME} "$@"
+&& 'quoted text' local readonly /usr/bin
+	then sed $(pwd) export cd -eu awk && ${HOME}
+		/usr/bin awk test 2>/dev/null && ${HOME}
+$(pwd) x=1 grep 2>/dev/null test ${HOME} --verbose /usr/bin
+	/usr/bin 'quoted text' awk readonly -eu
+$(pwd) && 'quoted text' --verbose "$1" awk --verbose x=1 done
+	&& awk readonly local printf echo --verbose $(pwd) -eu local
+	&& done done local $(pwd) cd test /usr/bin local
+		local "$@" "$@" export export x=1 grep local done test $(pwd) && 'quoted text'
+grep /usr/bin awk && 2>/dev/null --verbose done | && test done
+&& $(pwd) printf | "$1" 'quoted text' /usr/bin readonly 2>/dev/null
+		'quoted text' readonly /usr/bin then sed
+	/usr/bin awk test done 2>/dev/null
+		&& then x=1 test "$1" --verbose grep --verbose export
+	grep then awk /usr/bin | done grep printf x=1 && grep export printf
+	export export grep then echo | local cd cd grep ${HOME} "$1" cd 2>/dev/null
+	readonly $(pwd) /usr/bin test -eu
+printf | grep export -eu done "$@" readonly awk "$1"
+	awk echo export printf 2>/dev/null 2>/dev/null --verbose | /usr/bin
+		2>/dev/null "$@" grep printf
+grep sed --verbose echo then then --verbose readonly grep --verbose
+		x=1 2>/dev/null cd "$@" | $(pwd) && cd 'quoted text'
+		'quoted text' 'quoted text' done echo "$1" awk | && x=1
+	/usr/bin x=1 local cd && export "$1" sed grep
+grep readonly -eu grep "$1" export "$@" echo -eu done sed 2>/dev/null
+&& /usr/bin $(pwd) echo done echo "$@" | printf ${HOME} cd
+		&& export done -eu test export "$@" done && sed test
+	local export sed | ${HOME} /usr/bin sed then |
+	awk "$1" --verbose ${HOME} /usr/bin "$@" $(pwd)
+${HOME} export 2>/dev/null
+/usr/bin sed /usr/bin grep --verbose test --verbose
+		| 'quoted text' "$1" grep ${HOME} $(pwd) x=1 | "$1" done test
+&& 'quoted text' sed cd grep "$1" ${HOME} -eu "$@" done ${HOME} 2>/dev/null
+	done done export /usr/bin 2>/dev/null && $(pwd) && "$1" readonly readonly cd -eu
+		x=1 awk 2>/dev/null test cd echo printf ${HOME} /usr/bin
+echo && 2>/dev/null x=1 test awk && grep ${HOME} grep --verbose grep
+	echo grep done $(pwd) echo then | -eu /usr/bin
+	printf test -eu done /usr/bin ${HOME} echo then "$@" 2>/dev/null
+	printf printf export 'quoted text'
+&& | -eu /usr/bin /usr/bin awk export "$@" "$1" then grep --verbose "$1" sed sed
+"$@" printf 'quoted text' ${HOME} && printf echo
+sed | done 2>/dev/null "$@" 'quoted text' "$@"
+	test awk grep cd "$@" --verbose
+	readonly "$1" echo --verbose readonly
+2>/dev/null 'quoted text' test printf /usr/bin
+	grep 2>/dev/null done "$1" cd sed 2>/dev/null && sed echo |
+		export --verbose sed ${HOME} awk
+		done grep awk export printf cd test cd test local "$1" test done 2>/dev/null
+		export export --verbose sed "$@" local
+	readonly x=1 sed export
+readonly then 2>/dev/null done /usr/bin
+		readonly sed && ${HOME} local grep sed -eu
+	-eu echo $(pwd) "$@" sed test awk
+awk done "$1" cd /usr/bin
+		'quoted text' "$@" "$@" done $(pwd) 'quoted text' ${HOME} "$1" done
+		-eu cd local cd -eu echo awk echo awk readonly
+	x=1 "$1" 2>/dev/null 'quoted text' readonly && "$1" $(pwd) export sed -eu | --verbose
+	then | -eu readonly --verbose | x=1
+	| local echo -eu export && export 'quoted text' grep
+&& cd printf then export $(pwd) readonly --verbose
+	"$@" local done x=1 -eu 'quoted text' "$@" readonly 'quoted text'
+	echo 2>/dev/null export export readonly echo printf
+local echo done sed grep
+		grep | && $(pwd) sed export -eu x=1 && test export sed sed local 'quoted text'
+		printf && cd "$1" "$@" grep readonly
+	printf then local | test printf 2>/dev/null | "$1" awk test
+x=1 export done export "$@" 2>/dev/null cd |
+	awk -eu 'quoted text' "$1" 'quoted text' done export $(pwd)
+${HOME} "$1" ${HOME} echo && x=1 done grep done cd local local -eu 2>/dev/null
+		'quoted text' readonly echo sed && done --verbose && -eu | -eu
+'quoted text' -eu done /usr/bin
+		grep grep printf 'quoted text' grep "$1" --verbose echo x=1 cd local
+'quoted text' awk readonly then --verbose $(pwd) printf 2>/dev/null
+-eu x=1 sed awk x=1 -eu 2>/dev/null /usr/bin grep | && done then
+	-eu | | test "$1" $(pwd) 'quoted text' "$@" echo 'quoted text'
+	grep grep && 'quoted text' "$@" test sed awk echo then awk local $(pwd)
+	sed export sed 'quoted text' local grep --verbose awk 'quoted text' x=1 $(pwd)
+		x=1 readonly done readonly grep done awk grep --verbose /usr/bin
+grep then grep test --verbose done printf
+-eu done grep cd --verbose printf sed 'quoted text'
+	done $(pwd) test echo done export awk readonly done $(pwd)
+	| printf $(pwd) && then "$@" ${HOME} echo x=1 x=1 "$1" done readonly awk "$1"
+${HOME} then done 2>/dev/null x=1 'quoted text' $(pwd) 2>/dev/null --verbose
+/usr/bin printf done "$1" echo export awk local "$1"
+test /usr/bin then --verbose x=1 --verbose
+done export $(pwd) /usr/bin /usr/bin
+export readonly printf x=1 test ${HOME} printf 'quoted text' "$@" test echo cd
+	done echo export cd cd -eu | /usr/bin export 'quoted text'
+/usr/bin sed 2>/dev/null echo /usr/bin done printf cd 2>/dev/null
+	readonly $(pwd) 2>/dev/null
+	export printf | grep sed echo readonly $(pwd) && printf x=1 && cd "$@"
+| $(pwd) sed && 'quoted text' "$1" then /usr/bin
+		-eu "$@" done test cd grep --verbose test ${HOME} then "$1" | /usr/bin "$@"
+		| $(pwd) --verbose x=1 readonly grep awk grep -eu done && awk 'quoted text'
+		'quoted text' test "$1" "$@" /usr/bin /usr/bin "$1" "$1" 'quoted text'
+	readonly && export awk local && then grep then printf then
+local readonly echo test /usr/bin export
+| x=1 export cd -eu printf
+test export sed "$1" done "$1"
+	--verbose x=1 "$1" x=1 "$1" $(pwd)
+	--verbose "$@" awk export printf x=1 "$@" local -eu x=1 done /usr/bin
+		printf echo ${HOME} echo
+		sed export && done "$@" -eu printf
+export "$1" printf grep export 'quoted text' done 'quoted text' sed
+	echo then ${HOME} /usr/bin
+	'quoted text' && local "$@" test then printf && /usr/bin -eu grep done |
+		2>/dev/null "$1" --verbose export echo
+		/usr/bin local --verbose readonly $(pwd) cd export local ${HOME}
+echo /usr/bin x=1 echo grep /usr/bin
+		echo cd test && local printf ${HOME} -eu /usr/bin test && cd --verbose export
+		sed /usr/bin ${HOME} ${HOME} test readonly
+echo x=1 printf awk done readonly --verbose cd "$@" --verbose
+		export --verbose "$1" test ${HOME} test echo sed | cd export
+	-eu test 'quoted text' /usr/bin printf cd done 2>/dev/null "$@" /usr/bin
+		'quoted text' x=1 readonly
+		printf grep then 'quoted text' x=1 /usr/bin export export
+"$1" && $(pwd) "$@" |
+	2>/dev/null /usr/bin -eu 2>/dev/null test local 2>/dev/null awk
+		then | local done echo | done "$@" export
+$(pwd) | printf --verbose local local readonly && 2>/dev/null
+	| printf --verbose cd $(pwd) && ${HOME} | /usr/bin "$@" then awk 2>/dev/null
+then x=1 && export awk
+grep -eu --verbose -eu x=1 printf printf 'quoted text' "$@" then
+		done /usr/bin /usr/bin awk then done --verbose 'quoted text'
+local $(pwd) 'quoted text' printf
+		2>/dev/null sed | test cd echo -eu -eu 'quoted text' "$1" /usr/bin
+		grep grep -eu readonly sed sed readonly "$1" local
+		local 'quoted text' local awk | echo 2>/dev/null | sed --verbose "$1" test
+		'quoted text' "$1" awk echo done grep $(pwd) awk export
+${HOME} 'quoted text' local then awk -eu sed /usr/bin cd
+	grep -eu local sed readonly readonly
+${HOME} done grep cd --verbose | awk export cd grep echo sed $(pwd) local then
+		echo then ${HOME} -eu awk cd awk 'quoted text' -eu "$@" /usr/bin
+	2>/dev/null $(pwd) readonly x=1 awk "$@" --verbose sed export -eu && | |
+	test done $(pwd) x=1 cd && | /usr/bin --verbose "$@" test
+| local export done --verbose | echo
+	"$1" /usr/bin "$1" --verbose then cd && then done "$@" "$1" ${HOME} ${HOME}
+	test /usr/bin 'quoted text'
+	2>/dev/null $(pwd) /usr/bin $(pwd) export
+then --verbose done sed test sed -eu sed awk
+	local cd | done ${HOME} then "$@" "$1"
+		then "$1" "$1" -eu "$1" 2>/dev/null $(pwd)
+"$@" sed done $(pwd) ${HOME} 2>/dev/null "$1" grep test 2>/dev/null
+		"$1" local export local --verbose && "$@" "$@"
+		export 'quoted text' export 2>/dev/null test
+	printf --verbose --verbose | 2>/dev/null x=1 x=1 && grep 2>/dev/null then done done
+	${HOME} /usr/bin "$@" "$@" /usr/bin cd
+		readonly ${HOME} "$1" then 'quoted text' done && cd "$1" then
+		'quoted text' test x=1 && --verbose awk then "$@" done then -eu done | 'quoted text'
+${HOME} grep export "$@" test
+"$@" printf | readonly cd "$1" && printf x=1 printf sed /usr/bin --verbose
+	test /usr/bin sed export printf x=1 awk /usr/bin | x=1 $(pwd) sed done
+	-eu test --verbose test --verbose done grep | echo --verbose readonly
+		local readonly "$@" cd cd 2>/dev/null
+readonly echo 'quoted text' "$@" echo -eu "$1" --verbose
+	x=1 local echo 2>/dev/null export "$1" echo readonly
+		readonly local awk grep ${HOME} ${HOME} "$@" -eu awk x=1 then 2>/dev/null echo
+	then readonly sed sed $(pwd) cd printf done echo test local
+	&& readonly sed cd "$1" /usr/bin test --verbose
+&& test done sed sed /usr/bin readonly readonly && 'quoted text' "$@" x=1
+		--verbose x=1 --verbose readonly printf sed awk printf
+		awk /usr/bin echo 'quoted text' 2>/dev/null -eu test
+		done && --verbose 2>/dev/null ${HOME} awk awk --verbose
+$(pwd) echo "$1" 2>/dev/null test local
+	readonly ${HOME} grep then -eu local export -eu printf readonly awk
+"$1" then local "$@" x=1 /usr/bin /usr/bin && -eu ${HOME}
+2>/dev/null ${HOME} | -eu export
+		| -eu sed export awk | ${HOME} grep awk "$1" grep
+		2>/dev/null local --verbose then sed x=1 grep test local grep --verbose ${HOME}
+	sed readonly sed | x=1 --verbose 2>/dev/null readonly /usr/bin then "$@" "$@"
+		$(pwd) test $(pwd) test && readonly export -eu grep test grep -eu test && cd x=1
+export $(pwd) readonly "$1" then printf test ${HOME} $(pwd)
+awk && sed 2>/dev/null echo test 'quoted text' 2>/dev/null "$@" 'quoted text'
+cd x=1 /usr/bin | printf $(pwd) --verbose printf awk
+	"$@" then awk printf "$1" -eu 2>/dev/null && printf
+	'quoted text' printf test then ${HOME} | /usr/bin printf
+&& local x=1 sed x=1 "$@"
+	-eu 2>/dev/null /usr/bin x=1 cd && $(pwd) export export x=1 awk 2>/dev/null
+	| local printf printf printf x=1 export x=1 -eu ${HOME} export $(pwd) cd then
+		| export then --verbose x=1 cd done "$1" -eu then then 2>/dev/null
+'quoted text' ${HOME} x=1 awk --verbose | x=1 --verbose printf
+		2>/dev/null --verbose ${HOME} | -eu 2>/dev/null
+then test local --verbose "$1" $(pwd) 'quoted text' awk printf | --verbose
+/usr/bin cd "$@" && x=1 /usr/bin | --verbose local then local 2>/dev/null
+	cd x=1 grep then echo ${HOME}
+	then local test awk cd $(pwd) then $(pwd) awk | then
+export ${HOME} done local awk sed awk cd export awk readonly awk ${HOME}
+	'quoted text' readonly echo ${HOME} 2>/dev/null then
+done then "$1" test then "$@" export
+	then grep test local -eu sed sed readonly --verbose
+local done done cd x=1 | awk local --verbose ${HOME} grep ${HOME} /usr/bin
+		/usr/bin && printf awk echo then | export x=1 awk printf x=1 then done /usr/bin
+echo $(pwd) 'quoted text' ${HOME} test
+		export | then "$@" done echo /usr/bin
+	/usr/bin cd then done grep "$@" -eu
+	'quoted text' /usr/bin
+readonly "$@" | /usr/bin "$@" -eu echo ${HOME} "$1" printf
+		sed local done sed done $(pwd) 2>/dev/null /usr/bin 2>/dev/null
+		&& x=1 done 'quoted text' done | then grep awk | 2>/dev/null printf
+sed 'quoted text' $(pwd) then 'quoted text' test x=1 "$@"
+"$1" x=1 sed 2>/dev/null export export "$@"
+	'quoted text' 'quoted text' echo printf 2>/dev/null "$@" export local
+		echo local 2>/dev/null then ${HOME} x=1 local "$@" printf -eu readonly
+		-eu x=1 2>/dev/null sed export readonly 2>/dev/null
+		/usr/bin grep /usr/bin
+"$1" local export test --verbose "$@" sed
+		local echo sed sed --verbose awk then then 'quoted text' x=1 "$1" ${HOME} readonly
+		| /usr/bin cd -eu "$@" done then local grep sed done
+	export printf ${HOME} grep --verbose grep ${HOME}
+	&& "$1" printf grep "$1" awk 2>/dev/null "$@" && sed
+		echo -eu done x=1 local readonly "$1" cd /usr/bin test
+	local -eu echo readonly sed echo then ${HOME} "$@" grep $(pwd) ${HOME}
+		done 2>/dev/null printf | "$@" sed --verbose 2>/dev/null 2>/dev/null
+		-eu grep cd $(pwd) readonly then sed then echo echo echo test /usr/bin 2>/dev/null
+		x=1 sed test --verbose x=1
+		-eu export awk awk printf /usr/bin -eu then $(pwd) sed /usr/bin done done |
+export -eu x=1 ${HOME} export x=1 -eu
+	/usr/bin then printf && echo | export ${HOME} readonly
+2>/dev/null && awk 'quoted text' --verbose "$@" $(pwd) sed then
+--verbose test readonly readonly export 2>/dev/null "$1" done echo "$1"
+		| "$@" done 2>/dev/null grep grep readonly ${HOME} && && cd cd x=1
+x=1 echo done printf readonly test then $(pwd) done cd
+sed -eu readonly cd -eu && x=1 -eu | && --verbose cd echo
+		'quoted text' 2>/dev/null 2>/dev/null | && $(pwd) test "$@"
+	&& echo printf printf local cd then 'quoted text'
+	--verbose $(pwd) sed /usr/bin
+	export --verbose grep echo 2>/dev/null sed --verbose printf readonly grep
+then 2>/dev/null "$1" 2>/dev/null printf x=1 &&
+| cd local "$@" local then local -eu
+	"$1" /usr/bin 'quoted text' "$1" && awk echo printf test
+		"$@" | export && | -eu then export readonly -eu printf printf
+printf sed cd 'quoted text'
+	local "$1" $(pwd) printf 'quoted text' printf sed x=1
+	readonly ${HOME} ${HOME} sed
+	&& --verbose test done && 2>/dev/null cd x=1 export
+	"$1" "$1" awk local done
+--verbose export awk 2>/dev/null awk 2>/dev/null test 'quoted text'
+export echo cd echo done ${HOME} ${HOME} readonly
+export export 'quoted text'
+/usr/bin "$1" x=1 readonly then 2>/dev/null --verbose x=1 ${HOME}
+		/usr/bin "$@" "$1" test done
+		test 2>/dev/null done "$1" | sed -eu sed export $(pwd) awk test then printf
+		2>/dev/null cd 'quoted text' echo grep echo
+awk --verbose ${HOME} $(pwd) /usr/bin test "$@" $(pwd) ${HOME}
+${HOME} awk awk cd awk && printf done
+	grep | ${HOME} /usr/bin x=1 echo local readonly
+	readonly /usr/bin done then grep /usr/bin done cd 2>/dev/null done
+		x=1 export export | done 'quoted text' local then export readonly printf 'quoted text'
+then grep then -eu done test && local done cd "$@" x=1 "$@" 'quoted text' sed
+test 2>/dev/null then $(pwd) x=1
+export test 2>/dev/null then awk
+	2>/dev/null readonly sed ${HOME} awk done export awk done -eu echo --verbose
+	done | 2>/dev/null 'quoted text' then export cd x=1 -eu 2>/dev/null 'quoted text'
+'quoted text' readonly
+	sed 2>/dev/null | 'quoted text' "$1" && grep -eu x=1 cd then
+	x=1 awk grep export then | echo "$1" sed "$1"
+	'quoted text' readonly "$1" 2>/dev/null sed 2>/dev/null done export 'quoted text'
+		test ${HOME} | then grep
+	grep cd export grep /usr/bin --verbose -eu cd echo --verbose readonly local
+	echo cd /usr/bin printf $(pwd) ${HOME} 'quoted text'
+	"$@" sed cd --verbose ${HOME} awk sed "$@" && grep
+grep echo readonly && --verbose
+	/usr/bin ${HOME} 2>/dev/null
+${HOME} $(pwd) ${HOME} test && --verbose /usr/bin 2>/dev/null /usr/bin $(pwd)
+		/usr/bin 2>/dev/null echo then
+		${HOME} ${HOME} 'quoted text' sed done grep
+export cd readonly 2>/dev/null grep test "$@" export -eu
+	-eu printf grep then -eu && grep "$1" 2>/dev/null
+readonly 'quoted text' --verbose then -eu then /usr/bin | --verbose grep done
+/usr/bin "$@" done cd readonly 'quoted text' x=1 /usr/bin -eu
+awk awk printf ${HOME} readonly grep $(pwd) printf sed "$1" && "$@" local
+		test grep export -eu /usr/bin --verbose awk "$1" -eu awk --verbose
+sed readonly printf -eu "$@" awk readonly x=1 $(pwd) readonly "$1" $(pwd) &&
+	grep 'quoted text' $(pwd) printf test
+	grep export then local cd 2>/dev/null cd
+	echo grep ${HOME} local readonly
+		cd 'quoted text' x=1
+grep ${HOME} then ${HOME} | 'quoted text' ${HOME} 2>/dev/null --verbose
+		readonly sed sed awk -eu sed &&
+		"$@" grep && echo done
+		$(pwd) cd sed -eu local local awk $(pwd) test local readonly 2>/dev/null readonly
+	"$@" /usr/bin readonly 2>/dev/null
+	$(pwd) "$1" done grep done 2>/dev/null echo $(pwd) 'quoted text' local
+'quoted text' readonly $(pwd) --verbose then sed done /usr/bin
+		${HOME} -eu -eu && export 2>/dev/null "$1" awk && done 2>/dev/null
+	/usr/bin export "$@" sed
+		done | | x=1 "$1" then "$@" local --verbose printf "$@" && test export
+		/usr/bin grep export printf && -eu sed ${HOME} echo
+awk /usr/bin done local
+		export /usr/bin $(pwd) awk printf readonly x=1 readonly ${HOME} done
+/usr/bin /usr/bin --verbose
+--verbose 'quoted text' grep "$@" --verbose sed 'quoted text' local -eu "$@"
+	'quoted text' awk cd /usr/bin --verbose
+		export "$1" ${HOME} --verbose
+	&& /usr/bin /usr/bin export /usr/bin cd 'quoted text' test 2>/dev/null echo
+		awk export awk --verbose awk && ${HOME} x=1 'quoted text'
+	export /usr/bin then && cd readonly
+| /usr/bin "$@" then test cd sed
+	/usr/bin readonly ${HOME} readonly printf
+		&& grep local && grep done $(pwd) | echo then readonly
+	then /usr/bin then test awk done | cd cd sed $(pwd) ${HOME} printf
+	local | $(pwd) 2>/dev/null printf 'quoted text' sed printf echo $(pwd)
+		test | readonly --verbose && awk && ${HOME} ${HOME} 2>/dev/null ${HOME}
+		readonly local $(pwd) done ${HOME} --verbose 'quoted text' printf /usr/bin "$1"
+awk echo "$1" readonly readonly && "$@" 2>/dev/null
+echo export "$1" grep /usr/bin "$@" --verbose ${HOME} readonly -eu $(pwd)
+		${HOME} export --verbose sed | test echo | test
+	&& test export -eu --verbose readonly "$1" sed export
+	'quoted text' "$1" sed && 'quoted text' 2>/dev/null
+local x=1 sed "$1" 2>/dev/null printf local ${HOME} "$1" readonly
+		sed /usr/bin sed grep /usr/bin cd readonly --verbose printf
+echo x=1 then 2>/dev/null then 2>/dev/null
+sed 2>/dev/null export ${HOME}
+		/usr/bin | && export /usr/bin export sed /usr/bin
+	printf ${HOME} && readonly 2>/dev/null then done export x=1 | awk local | test
+"$1" done | readonly /usr/bin export local $(pwd) | local "$@" local "$@"
+-eu awk | "$1" echo grep awk test export && sed local -eu
+"$@" "$1" printf x=1 echo grep "$1" x=1 done
+	awk readonly readonly "$1" grep grep printf export "$1" ${HOME} export "$@"
+export "$@" then cd | echo cd test ${HOME}
+	export "$@" sed then test cd && echo /usr/bin done awk sed awk $(pwd) x=1 grep
+		local && local -eu -eu awk then then done && --verbose echo --verbose x=1 export
+readonly then local -eu
+	printf && grep /usr/bin ${HOME} test $(pwd) | --verbose
+$(pwd) "$1" x=1 export "$1" sed
+		| echo "$1" done readonly /usr/bin local then
+		done "$1" done ${HOME} test local
+	/usr/bin then 2>/dev/null ${HOME} && awk /usr/bin awk cd 'quoted text' printf cd
+	local then printf echo
+	&& | then cd x=1 && echo export cd
+printf $(pwd) echo local cd 2>/dev/null cd "$1" then then printf
+cd $(pwd) --verbose cd && "$1" echo
+	| sed 'quoted text' awk 2>/dev/null printf
+		2>/dev/null awk "$@" && then
+	x=1 'quoted text' test && test 2>/dev/null sed x=1 test cd echo
+	printf 'quoted text' && "$@" then local cd echo sed -eu
+		readonly printf --verbose printf | $(pwd) export cd "$1" sed then awk
+		-eu awk awk x=1 "$@" |
+${HOME} local x=1 ${HOME}
+	${HOME} grep && 2>/dev/null
+| done done ${HOME} x=1 sed x=1 readonly | grep "$1"
+		then "$1" x=1 local "$@" sed
+	readonly "$1" 2>/dev/null "$1" x=1 'quoted text' --verbose done
+	awk ${HOME} 'quoted text' cd | "$@" echo cd test x=1 sed printf ${HOME} sed sed
+		| 2>/dev/null && test sed /usr/bin readonly
+cd x=1 $(pwd) export then
+	export echo --verbose grep awk ${HOME}
+		"$1" "$@" -eu $(pwd) grep 'quoted text' --verbose done done $(pwd) --verbose
+		cd && x=1 --verbose /usr/bin
+export 'quoted text' readonly x=1
+	grep 2>/dev/null then -eu
+		awk "$1" printf $(pwd) --verbose x=1 'quoted text' -eu 'quoted text'
+readonly "$1" sed 2>/dev/null echo readonly done
+	done export "$1" grep done /usr/bin 2>/dev/null local /usr/bin | | then
+		&& sed awk --verbose cd | sed then
+		2>/dev/null 'quoted text'
+		grep done test "$@" cd --verbose local printf --verbose /usr/bin ${HOME}
+test grep 'quoted text' echo then x=1 -eu grep test x=1 --verbose
+grep readonly -eu export grep done 2>/dev/null --verbose /usr/bin 'quoted text'
+printf | cd -eu export test export grep x=1 "$1" export readonly
+	grep -eu x=1 "$@" readonly readonly readonly
+	test --verbose printf then printf $(pwd)
+		printf -eu 'quoted text' done grep $(pwd)
+	awk "$1" -eu 2>/dev/null "$1" awk -eu echo awk export
+	&& done | awk ${HOME} grep -eu --verbose readonly
+"$@" cd "$@" then 2>/dev/null "$@" -eu printf done then /usr/bin ${HOME} readonly
+		sed -eu done --verbose --verbose
+readonly done --verbose /usr/bin test
+		local "$1" -eu cd $(pwd)
+done then echo done readonly x=1 readonly test --verbose ${HOME}
+"$@" sed $(pwd) sed /usr/bin
+	local | "$@" "$@" sed readonly "$1" 2>/dev/null then /usr/bin
+	--verbose echo readonly sed local 2>/dev/null local
+		/usr/bin printf x=1 | --verbose cd -eu "$@" test "$@"
+${HOME} -eu -eu test 2>/dev/null /usr/bin /usr/bin awk ${HOME} | awk
+-eu awk sed readonly
+done 'quoted text' cd | then printf
+$(pwd) 'quoted text' grep
+		--verbose && "$1" $(pwd) | sed done
+"$1" 'quoted text' then "$@" printf 2>/dev/null 2>/dev/null
+		awk then -eu $(pwd) -eu | export --verbose echo grep 2>/dev/null cd x=1 readonly
+	awk --verbose x=1 | 2>/dev/null 2>/dev/null then && test awk
+	'quoted text' printf grep ${HOME} $(pwd) $(pwd) awk done local 2>/dev/null
+		| "$@" printf done | then grep --verbose "$1" readonly
+		sed && awk --verbose sed --verbose then x=1 $(pwd)
+		export sed /usr/bin ${HOME} --verbose "$1" "$1" $(pwd) $(pwd)
+x=1 ${HOME} grep ${HOME} export then -eu local /usr/bin 2>/dev/null
+	| readonly --verbose local && sed --verbose grep "$@" grep readonly "$@"
+	/usr/bin printf then ${HOME}
+${HOME} then $(pwd) && done sed echo test printf echo
+echo -eu awk $(pwd) 2>/dev/null -eu /usr/bin 'quoted text' printf readonly then
+printf --verbose printf "$1"
+	"$1" grep -eu "$1" export ${HOME} "$@" echo cd awk
+		&& readonly export cd local cd echo readonly
+		printf awk 2>/dev/null printf export test $(pwd) | done
+readonly then | export export -eu /usr/bin echo "$@" | 2>/dev/null
+	2>/dev/null test sed 'quoted text' echo /usr/bin -eu export then grep
+		readonly sed done /usr/bin && grep grep test done readonly
+	printf 2>/dev/null export test local printf export
+		2>/dev/null awk ${HOME} x=1 done then readonly -eu 'quoted text'
+/usr/bin grep --verbose sed "$1" --verbose 'quoted text' readonly printf
+awk 2>/dev/null awk then test $(pwd) $(pwd) grep echo -eu sed readonly
+	/usr/bin sed "$@" done grep "$1" test ${HOME} printf sed test 'quoted text'
+		then /usr/bin readonly 'quoted text'
+	echo readonly -eu test -eu x=1 printf --verbose cd sed
+		cd readonly | test local printf "$@" $(pwd) --verbose --verbose awk awk
+		test sed cd export awk sed x=1 awk -eu 2>/dev/null echo | cd /usr/bin
+	"$@" cd && test awk awk then 2>/dev/null sed ${HOME} cd printf printf
+		printf | local printf then "$1" $(pwd) --verbose /usr/bin export
+	&& --verbose awk readonly awk readonly test test readonly
+		${HOME} printf grep /usr/bin printf echo echo $(pwd) then readonly printf cd test
+	--verbose ${HOME} "$@" then awk awk /usr/bin x=1 cd 'quoted text' --verbose 'quoted text'
+		printf done "$@" export echo --verbose test export
+	done 'quoted text' /usr/bin "$1" local
+	x=1 | -eu test cd "$@" --verbose awk
+printf then 'quoted text' ${HOME} cd grep /usr/bin local printf
+	'quoted text' cd done 'quoted text'
+'quoted text' echo --verbose cd awk x=1 export local sed
+		done /usr/bin grep cd done done
+done then 2>/dev/null /usr/bin 2>/dev/null "$@" export
+x=1 && readonly "$1" | "$@" test grep
+		'quoted text' ${HOME} echo local -eu then
+awk ${HOME} /usr/bin -eu --verbose then 2>/dev/null && printf "$@" 2>/dev/null
+		grep echo "$1" cd test
+	printf "$@" printf local 'quoted text'
+${HOME} 'quoted text' x=1 -eu /usr/bin
+		grep awk then local done readonly $(pwd) 'quoted text' awk $(pwd)
+	/usr/bin 2>/dev/null && echo echo
+	export printf "$1" 2>/dev/null "$@" grep cd cd grep grep done
+/usr/bin printf printf
+		readonly done "$1" x=1 | readonly 'quoted text' done "$@" readonly printf
+	"$@" $(pwd) test then $(pwd) 2>/dev/null readonly x=1 cd && sed
+	--verbose "$1" 'quoted text' done 'quoted text' $(pwd)
+	2>/dev/null echo ${HOME} $(pwd) export grep
+	2>/dev/null $(pwd) "$1" $(pwd) done && echo readonly /usr/bin
+	grep -eu done 2>/dev/null then export readonly
+		/usr/bin "$1" ${HOME} local
+		2>/dev/null then 2>/dev/null 2>/dev/null
+x=1 && /usr/bin -eu ${HOME} | | local $(pwd) ${HOME} 2>/dev/null "$@"
+	grep test ${HOME} cd "$1" export sed local export
+x=1 printf export $(pwd) ${HOME}
+	"$1" | local awk awk then --verbose
+| "$1" cd export --verbose -eu -eu "$@" done $(pwd)
+		2>/dev/null local -eu ${HOME} "$1" echo ${HOME} local 2>/dev/null grep
+| export x=1 awk cd --verbose "$@" printf awk "$1"
+2>/dev/null -eu "$1" /usr/bin local && /usr/bin then --verbose done
+sed test "$1" && --verbose test --verbose
+		printf 'quoted text' grep local ${HOME}
+${HOME} cd 2>/dev/null 2>/dev/null
+		cd "$1" grep -eu x=1 printf -eu cd export
+		"$@" | sed && 2>/dev/null done
+		awk $(pwd) awk done x=1 2>/dev/null x=1 | "$@" readonly | done 'quoted text'
+	"$1" /usr/bin done ${HOME} cd "$1"
+	readonly sed printf sed "$1" $(pwd) sed
+	awk printf x=1 | then ${HOME} done && ${HOME} "$@" local
+&& done sed local /usr/bin 2>/dev/null "$@" export && --verbose 'quoted text'
+test -eu ${HOME} $(pwd) local printf awk "$1" sed x=1 | printf export cd /usr/bin
+x=1 readonly then sed 'quoted text' echo && then
+	&& printf "$@" cd readonly /usr/bin
+	export awk done readonly cd x=1 /usr/bin
+	readonly ${HOME} $(pwd) readonly --verbose
+	export local && $(pwd) then then
+	echo done && "$1" readonly printf test done 2>/dev/null
+	x=1 sed x=1 && ${HOME} $(pwd) /usr/bin | "$@"
+	grep then done sed readonly local "$@"
+		-eu ${HOME} "$@" "$1" awk | awk "$@" --verbose then ${HOME} then readonly then cd
+"$1" echo printf 'quoted text' export 2>/dev/null grep local 'quoted text'
+	--verbose test && | "$@" /usr/bin /usr/bin x=1 --verbose x=1 sed --verbose &&
+| "$1" && x=1 x=1 /usr/bin "$1" echo echo readonly
+done -eu export awk && local local ${HOME} "$@" then x=1 echo ${HOME} echo
+"$1" /usr/bin x=1 ${HOME} && $(pwd) | local $(pwd) && $(pwd) echo "$1" $(pwd)
+	--verbose "$1" grep | awk ${HOME} cd local /usr/bin -eu && printf |
+	cd | x=1 -eu echo /usr/bin --verbose /usr/bin 2>/dev/null test x=1 /usr/bin
+		readonly x=1 | 2>/dev/null
+done sed export x=1 test /usr/bin export ${HOME} 2>/dev/null sed
+then cd awk readonly 'quoted text' | awk 'quoted text' test 2>/dev/null
+	2>/dev/null --verbose x=1 then && x=1 local 'quoted text' x=1 $(pwd)
+	$(pwd) 'quoted text' "$@" cd sed "$@" sed grep test
+then && --verbose | test grep $(pwd) echo
+	test $(pwd) 2>/dev/null then
+	2>/dev/null grep | sed -eu --verbose export "$@" && $(pwd) &&
+		"$1" local export readonly export cd printf readonly
+	cd then awk "$@" ${HOME} printf test then
+	printf awk x=1 ${HOME} awk awk awk test sed && 2>/dev/null printf
+then ${HOME} --verbose export x=1 echo echo 2>/dev/null sed $(pwd) test
+		x=1 local /usr/bin awk "$1" "$1" local printf awk | awk then done | 2>/dev/null
+"$@" 'quoted text' grep "$1" awk sed export export | grep readonly "$1" 'quoted text'
+		--verbose export "$@"
+		sed && ${HOME} "$@" "$1"
+		x=1 $(pwd) printf 2>/dev/null x=1 printf test --verbose -eu cd /usr/bin
+	2>/dev/null ${HOME} ${HOME} ${HOME} export
+test awk "$@" $(pwd) "$@" done 2>/dev/null readonly ${HOME}
+local && x=1 --verbose ${HOME} done -eu -eu cd 2>/dev/null
+grep 2>/dev/null 'quoted text' "$@" ${HOME}
+awk $(pwd) awk x=1 --verbose 2>/dev/null $(pwd) export | readonly readonly | x=1
+		/usr/bin -eu 'quoted text' 2>/dev/null --verbose echo /usr/bin | x=1 grep x=1 x=1
+	test | cd printf -eu 'quoted text' -eu awk /usr/bin local test cd
+cd sed /usr/bin "$1" printf grep | then -eu then awk /usr/bin /usr/bin 2>/dev/null
+		"$@" x=1 cd test grep test local
+test awk readonly echo x=1 'quoted text'
+cd 'quoted text' export printf cd printf $(pwd) "$1" test local
+	then awk done cd && "$@" local test x=1 printf readonly --verbose && sed
+		done done awk ${HOME} /usr/bin
+	printf 'quoted text' 'quoted text' cd /usr/bin test grep "$1" readonly
+		export --verbose $(pwd) --verbose 'quoted text'
+		export 'quoted text' && x=1 readonly /usr/bin 'quoted text' awk ${HOME} ${HOME}
+	test 'quoted text' && awk awk | 2>/dev/null local
+local export grep export
+/usr/bin | then done "$@" then && then cd test | --verbose ${HOME} export awk
+x=1 then then /usr/bin "$1" grep 'quoted text'
+		&& then 'quoted text' cd printf && | /usr/bin
+		then /usr/bin "$@" --verbose echo ${HOME} 2>/dev/null echo /usr/bin echo
+done then cd sed test "$1" | echo grep done -eu /usr/bin | export cd cd
+	${HOME} then $(pwd) then grep 2>/dev/null
+		then awk awk echo local export && local then local 2>/dev/null echo export
+	test awk sed "$@" done "$1"
+	"$1" test 2>/dev/null test readonly ${HOME} ${HOME} && "$1" && ${HOME}
+test export "$@" readonly grep ${HOME} grep ${HOME} readonly grep
+		readonly -eu sed sed test test ${HOME} ${HOME} echo 'quoted text' $(pwd)
+	printf --verbose $(pwd) 2>/dev/null local 2>/dev/null
+		${HOME} "$@" 'quoted text' "$@" sed --verbose local 2>/dev/null
+	then export done "$1" cd printf sed "$@"
+2>/dev/null | printf printf 2>/dev/null
+local "$@" $(pwd) --verbose x=1 | 2>/dev/null echo x=1 "$1" sed done readonly
+cd awk && "$1" ${HOME} $(pwd) done echo -eu test
+grep && /usr/bin test test x=1 sed echo printf $(pwd) ${HOME} /usr/bin
+		echo 'quoted text' && export
+		&& --verbose "$@" export /usr/bin readonly cd sed -eu x=1 local
+&& /usr/bin readonly printf printf grep -eu
+	"$@" ${HOME} awk $(pwd) -eu test "$@" && 'quoted text'
+		2>/dev/null /usr/bin "$@" readonly then 'quoted text'
+	${HOME} grep cd sed cd awk grep "$@" ${HOME}
+		echo printf --verbose sed grep 2>/dev/null printf test | awk 2>/dev/null
+		test sed readonly test x=1 --verbose
+		"$1" grep cd awk $(pwd) "$1" printf readonly --verbose
+		"$@" printf cd 2>/dev/null
+${HOME} x=1 readonly test /usr/bin
+	2>/dev/null sed readonly readonly echo x=1 local local
+	x=1 --verbose readonly | cd --verbose echo readonly
+	x=1 grep $(pwd) $(pwd) cd "$1"
+		"$1" echo -eu x=1 echo readonly sed x=1 then "$1" | printf local
+	printf | printf && then printf sed --verbose "$@" awk
+		--verbose cd local readonly ${HOME} --verbose export local test
+		/usr/bin /usr/bin 'quoted text' --verbose done
+		"$1" /usr/bin 2>/dev/null awk && awk awk sed awk --verbose
+	export 'quoted text' echo test awk done readonly readonly ${HOME}
+2>/dev/null test printf printf test --verbose
+		sed && cd && export awk
+		printf awk "$@" sed $(pwd) done --verbose x=1 awk "$1"
+		/usr/bin echo readonly grep local
+${HOME} $(pwd) readonly $(pwd)
+grep done $(pwd) "$@" 2>/dev/null $(pwd) && done ${HOME} sed $(pwd) |
+		done -eu | then x=1 $(pwd) "$1"
+		"$@" done --verbose then then && "$1" awk printf -eu done test
+	awk 'quoted text' 2>/dev/null test
+test "$@" then 'quoted text'
+-eu | printf ${HOME} && sed printf $(pwd)
+	2>/dev/null awk 'quoted text' test
+echo $(pwd) ${HOME} 2>/dev/null printf local export "$@" "$1" sed
+		/usr/bin x=1 readonly echo x=1 $(pwd) $(pwd) --verbose test -eu ${HOME} test
+export printf /usr/bin grep $(pwd)
+2>/dev/null test local x=1 $(pwd) grep
+		echo export sed /usr/bin /usr/bin --verbose printf
+	sed ${HOME} then x=1 /usr/bin "$@" "$@" export grep 2>/dev/null
+then local -eu done | $(pwd)
+		test awk "$1" sed "$@" $(pwd) then
+	"$1" /usr/bin 2>/dev/null done $(pwd) 'quoted text'
+	$(pwd) done x=1 export 2>/dev/null x=1 "$1" 2>/dev/null "$@" then -eu
+	awk readonly --verbose done readonly --verbose printf 2>/dev/null |
+then "$@" --verbose "$@" done x=1 sed
+echo 'quoted text' $(pwd) "$@" export test
+-eu 2>/dev/null awk cd then ${HOME} export export export awk cd "$@" --verbose
+		| export readonly ${HOME} echo awk "$1" test | -eu
+		awk 'quoted text' echo | "$@" local readonly cd 'quoted text'
+readonly local cd && "$1" "$1" awk /usr/bin 2>/dev/null
+	cd echo 'quoted text' readonly --verbose -eu 'quoted text' sed local
+	2>/dev/null /usr/bin $(pwd) echo export -eu ${HOME} test export local awk then
+		readonly cd | -eu "$1" export ${HOME} then | readonly 'quoted text'
+test ${HOME} export printf test then "$1" local
+	$(pwd) | /usr/bin grep printf 'quoted text' && printf export -eu grep $(pwd)
+		done done awk then cd 2>/dev/null
+		export test done test $(pwd)
+	| sed cd printf test x=1
+		readonly grep done readonly "$1" printf
+		2>/dev/null 2>/dev/null printf -eu /usr/bin
+		&& sed "$1" && ${HOME} 2>/dev/null x=1 /usr/bin
+	awk --verbose | --verbose readonly
+	readonly -eu awk 'quoted text' x=1 --verbose $(pwd) grep
+"$@" --verbose "$@" ${HOME} readonly && readonly
+		export then cd echo "$1" cd then readonly $(pwd) && 2>/dev/null -eu
+${HOME} local test local cd
+	-eu awk readonly -eu grep 'quoted text' 'quoted text' readonly
+-eu awk local grep 'quoted text'
+		sed "$1" x=1 'quoted text' cd x=1 --verbose export x=1 then export -eu ${HOME}
+		'quoted text' 2>/dev/null grep cd echo printf
+	"$1" -eu | test local export
+		/usr/bin awk local $(pwd)
+		"$@" local local awk export awk then ${HOME} x=1 test
+printf test local $(pwd) --verbose ${HOME} then
+		"$1" grep printf printf "$@" "$1" -eu done "$1" | awk "$@" sed
+		| export done /usr/bin cd 'quoted text' grep $(pwd) local
+export local 'quoted text' readonly 'quoted text'
+test awk then ${HOME} echo readonly
+	&& $(pwd) x=1 grep awk grep /usr/bin ${HOME}
+	sed --verbose /usr/bin && --verbose printf 2>/dev/null
+		/usr/bin readonly grep local then /usr/bin $(pwd) /usr/bin awk
+2>/dev/null printf local 2>/dev/null
+	x=1 sed ${HOME} --verbose awk export export cd cd then
+		then -eu ${HOME} "$1" --verbose test $(pwd)
+-eu /usr/bin readonly printf
+		done "$@" -eu printf export sed printf done && export ${HOME} grep 2>/dev/null
+		sed /usr/bin && /usr/bin local readonly done --verbose then 2>/dev/null
+printf x=1 grep x=1 test test export | cd
+		awk | && sed grep "$1" 2>/dev/null
+		2>/dev/null 2>/dev/null --verbose then 2>/dev/null
+		"$@" && grep | local --verbose then local readonly echo "$1" "$1"
+	x=1 local cd export 'quoted text' then /usr/bin "$1" /usr/bin "$1"
+2>/dev/null export grep export "$@" local /usr/bin --verbose
+grep && "$1" && 2>/dev/null
+		| x=1 2>/dev/null local x=1 cd cd --verbose "$1" export ${HOME} "$1" ${HOME}
+	readonly ${HOME} then x=1 awk test
+	| awk local -eu /usr/bin ${HOME} -eu awk export done test awk then echo test 2>/dev/null
+		export x=1 export export $(pwd) ${HOME} local then && cd "$1"
+	/usr/bin -eu printf "$1" "$1" printf echo awk awk awk printf then | export test
+	grep test cd done awk export test --verbose done then
+	--verbose "$1" sed 'quoted text' && 'quoted text' "$@"
+echo 'quoted text' 2>/dev/null
+readonly "$@" -eu then x=1 export then grep $(pwd) sed echo export
+	"$1" 'quoted text' local
+		grep cd local local "$@" awk done "$1" 2>/dev/null
+	'quoted text' sed readonly "$1" local export awk echo done
+done "$@" 2>/dev/null awk cd awk "$1" "$@" test awk awk 'quoted text'
+		"$@" x=1 then local && test export local then | ${HOME}
+	then then -eu echo ${HOME} cd awk
+	export | 'quoted text' cd printf 'quoted text'
+echo cd | done grep then local sed then "$1" 'quoted text' -eu
+"$1" sed local 'quoted text'
+	sed -eu printf 'quoted text' cd ${HOME} export
+test test /usr/bin sed printf test /usr/bin echo awk sed cd && 2>/dev/null
+		awk 'quoted text' echo
+		"$@" && done echo && x=1 export cd grep
+		test echo test | grep test "$1" --verbose /usr/bin
+x=1 done 2>/dev/null 'quoted text'
+		'quoted text' -eu "$1" --verbose
+sed printf && /usr/bin done
+echo readonly readonly "$@" sed "$1" export ${HOME} && readonly
+	cd readonly export 2>/dev/null --verbose local grep --verbose x=1 'quoted text'
+	--verbose 'quoted text' printf done then printf --verbose
+		printf | "$@" readonly test echo cd cd sed
+	awk 'quoted text' sed then test x=1 readonly "$1" readonly then local ${HOME}
+	cd "$1" then "$@" -eu printf awk | x=1 && -eu /usr/bin awk export
+local echo | "$1" awk then grep "$1"
+		x=1 | "$1" -eu | && grep awk ${HOME}
+sed 'quoted text' 2>/dev/null local done ${HOME}
+	$(pwd) awk export cd $(pwd) $(pwd) grep 'quoted text'
+		2>/dev/null | grep "$@" done readonly
+then export done grep 'quoted text' awk x=1 "$@" then /usr/bin
+		local awk readonly ${HOME} sed local 2>/dev/null done
+		grep local export 'quoted text' 'quoted text'
+awk x=1 && export /usr/bin 'quoted text' then 2>/dev/null ${HOME} echo 2>/dev/null
+sed then --verbose export
+--verbose 'quoted text' done /usr/bin
+	| --verbose ${HOME} | echo | printf ${HOME} local "$1" awk test
+	printf --verbose cd then 'quoted text' &&
+	/usr/bin --verbose then awk /usr/bin -eu /usr/bin sed export 'quoted text'
+	sed local 'quoted text' x=1 readonly done export echo done x=1 x=1
+sed x=1 export awk "$1"
+		done printf cd test export local printf 2>/dev/null --verbose echo "$@" /usr/bin
+	test x=1 export then --verbose awk sed printf readonly $(pwd)
+	local x=1 grep export 2>/dev/null done cd
+		&& $(pwd) echo sed "$@" ${HOME} awk done echo x=1 | --verbose
+	grep x=1 ${HOME} printf 'quoted text'
+echo export $(pwd) test $(pwd) sed cd ${HOME}
+awk /usr/bin ${HOME} 'quoted text' export /usr/bin ${HOME}
+		${HOME} 2>/dev/null cd 2>/dev/null
+		cd done x=1 then 2>/dev/null $(pwd) sed ${HOME} sed ${HOME} then echo
+	${HOME} x=1 "$@" done grep -eu test
+-eu 'quoted text' grep printf
+test then -eu awk awk cd grep sed 2>/dev/null then sed sed
+$(pwd) | echo echo 2>/dev/null then "$1" local done x=1 readonly --verbose
+"$@" grep printf test | readonly -eu
+	test done 'quoted text' awk done readonly export grep --verbose local done
+		sed --verbose grep ${HOME} sed readonly "$1" sed export -eu --verbose
+	x=1 --verbose sed readonly test && && sed grep 'quoted text' &&
+		sed | /usr/bin 2>/dev/null
+"$@" cd 2>/dev/null "$@" sed readonly ${HOME} "$@" x=1 echo printf ${HOME} 'quoted text'
+grep -eu awk 'quoted text' $(pwd)
+| readonly export $(pwd) cd readonly 'quoted text' --verbose cd sed "$1"
+	printf sed && done "$@" echo -eu x=1 done
+'quoted text' grep --verbose
+	grep done cd printf "$1" -eu /usr/bin done sed
+'quoted text' awk cd local ${HOME}
+	--verbose local cd --verbose done /usr/bin 2>/dev/null local cd 2>/dev/null
+sed echo then grep ${HOME} then echo 2>/dev/null export grep "$1"
+'quoted text' "$@" 2>/dev/null
+then sed $(pwd) && 'quoted text' && cd echo test cd && test | local grep export
+		${HOME} -eu done test 2>/dev/null printf $(pwd)
+		cd done x=1 test "$@" printf awk && printf printf then then printf test
+	grep "$1" export -eu export "$1" "$1"
+	-eu && test "$1" sed grep local readonly awk x=1
+	local x=1 local cd awk "$@" && /usr/bin $(pwd) sed local
+	local done -eu "$@" readonly sed export cd
+/usr/bin "$1" -eu | "$@" sed
+	printf echo then "$1" | "$1" echo /usr/bin then sed $(pwd)
+		&& export cd export 2>/dev/null x=1 printf readonly test --verbose "$1"
+	x=1 "$1" $(pwd) grep printf x=1 2>/dev/null
+	/usr/bin export cd "$@" 2>/dev/null /usr/bin 'quoted text'
+	sed "$1" export sed | "$1" && awk echo "$@" echo
+&& export --verbose ${HOME} grep cd && printf
+--verbose && export echo
+		local then done awk done 2>/dev/null
+${HOME} then grep $(pwd) test && | echo grep local done "$@" | grep then awk done
+		grep /usr/bin then --verbose $(pwd) "$1" readonly sed $(pwd) && x=1 ${HOME}
+x=1 printf cd --verbose
+x=1 printf grep test --verbose -eu readonly -eu awk echo
+		| ${HOME} x=1 local && cd awk "$1" --verbose printf | printf $(pwd)
+		| done x=1 "$1" "$1" awk --verbose
+		--verbose --verbose 'quoted text' -eu && awk printf x=1 printf --verbose
+-eu sed --verbose /usr/bin test readonly echo echo done test cd then echo && test
+		'quoted text' --verbose readonly
+		export $(pwd) awk "$@"
+then /usr/bin | echo sed grep done && cd test 2>/dev/null ${HOME}
+		--verbose export x=1 "$1" $(pwd) awk x=1 --verbose -eu test -eu | x=1 echo ${HOME}
+	${HOME} --verbose 'quoted text' 2>/dev/null printf ${HOME} printf "$1"
+	cd then "$1" printf -eu done printf export awk x=1 "$@" "$@" printf test 2>/dev/null
+$(pwd) awk 'quoted text' 2>/dev/null -eu
+--verbose done done cd 2>/dev/null 'quoted text'
+		cd readonly "$@" 'quoted text' printf
+done $(pwd) done done readonly && --verbose local cd $(pwd) awk then ${HOME}
+		test -eu readonly sed /usr/bin "$1" readonly | 2>/dev/null
+	/usr/bin grep sed "$1" | awk ${HOME} local /usr/bin cd sed 2>/dev/null
+	then cd test /usr/bin 2>/dev/null "$1" printf -eu ${HOME} printf "$1" 2>/dev/null
+	"$1" echo -eu local awk printf test 'quoted text' sed x=1 -eu echo --verbose
+	printf cd -eu then $(pwd) ${HOME}
+	"$1" $(pwd) printf export then
+		then cd --verbose /usr/bin -eu sed 'quoted text' readonly
+		| test done --verbose $(pwd) cd "$1" awk awk cd cd | | "$@" ${HOME}
+	x=1 --verbose ${HOME} printf 2>/dev/null "$@" | "$@" then export done 2>/dev/null
+-eu export -eu && cd -eu grep printf
+then printf "$@" export
+	"$@" cd && test /usr/bin test awk
+local then x=1 printf
+		echo "$1" grep $(pwd) cd local done sed local | printf
+		done awk --verbose && readonly $(pwd) grep "$1"
+test awk && test x=1 test awk | "$@" -eu "$1" -eu echo grep
+		$(pwd) 2>/dev/null ${HOME} 'quoted text'
+test readonly $(pwd) ${HOME} 2>/dev/null 2>/dev/null $(pwd) sed --verbose
+	"$1" ${HOME} /usr/bin cd ${HOME} local $(pwd) awk awk 'quoted text'
+	sed "$1" cd export export cd local local done
+	test /usr/bin test x=1 -eu sed export "$1" readonly awk "$1"
+readonly -eu then awk export then ${HOME} printf "$1" done && |
+printf sed export cd x=1 "$@" && "$@" then x=1 then echo awk "$@" done
+		x=1 readonly printf "$1" -eu ${HOME}
+		$(pwd) ${HOME} /usr/bin /usr/bin done
+		local printf printf cd -eu echo then awk 2>/dev/null /usr/bin x=1 done cd
+	then awk test echo done test echo
+local "$1" x=1 'quoted text'
+		| printf -eu test && ${HOME} readonly sed && 'quoted text'
+printf sed local grep test readonly && 'quoted text' -eu /usr/bin "$1"
+	awk --verbose && then $(pwd) then 2>/dev/null export done export grep 'quoted text'
+printf sed 2>/dev/null 2>/dev/null test printf 'quoted text' cd 'quoted text'
+grep 2>/dev/null -eu sed 2>/dev/null
+		/usr/bin -eu done awk then | grep printf echo
+	2>/dev/null echo sed then /usr/bin
+printf then --verbose then "$@" printf 2>/dev/null
+	| && sed export then && 2>/dev/null $(pwd) done "$1" "$@" printf
+	-eu sed echo /usr/bin x=1 x=1 local 'quoted text' /usr/bin 2>/dev/null
+	/usr/bin then echo local && grep echo 2>/dev/null x=1
+		local sed cd ${HOME} sed local echo then printf | export test
+printf awk ${HOME} ${HOME} "$1" --verbose ${HOME} -eu sed $(pwd) -eu 'quoted text'
+	then | x=1 $(pwd) ${HOME} | awk readonly local ${HOME} printf ${HOME} "$@"
+	2>/dev/null 2>/dev/null x=1 ${HOME} local -eu | "$1"
+	then then printf $(pwd) readonly /usr/bin echo test ${HOME}
+	awk readonly 'quoted text' 'quoted text'
+	echo awk && printf grep grep sed done $(pwd) 2>/dev/null printf test && cd 'quoted text'
+then --verbose test awk test 'quoted text' && grep local printf export
+		grep | "$@" printf x=1 cd -eu test export
+		$(pwd) "$1" local sed | "$1" printf echo "$@" "$@" cd && printf printf ${HOME}
+&& awk -eu 'quoted text' | ${HOME} |
+"$@" $(pwd) && && -eu $(pwd)
+| "$1" export then echo test test
+	&& $(pwd) "$1" $(pwd) && local "$@" printf grep && readonly 'quoted text'
+		2>/dev/null 2>/dev/null "$@" then --verbose --verbose | && "$@" && readonly readonly
+grep $(pwd) awk grep -eu && -eu grep $(pwd) printf x=1 readonly test readonly
+export done readonly then cd sed ${HOME} | x=1 -eu && done readonly
+		then && 'quoted text' then echo grep -eu /usr/bin
+	| grep cd /usr/bin --verbose grep &&
+export readonly ${HOME} cd printf && sed then $(pwd)
+"$1" done "$1" printf 2>/dev/null test then echo 'quoted text' x=1 sed ${HOME}
+		/usr/bin "$1" | | awk /usr/bin
+	awk local readonly "$@" grep ${HOME} echo 2>/dev/null $(pwd)
+echo readonly then readonly &&
+local "$@" -eu test ${HOME} done 2>/dev/null printf "$1"
+	--verbose -eu cd --verbose local
+		done $(pwd) "$@" then ${HOME} "$@"
+		done test --verbose export "$@" printf
+-eu printf x=1 $(pwd)
+		$(pwd) "$1" x=1 -eu local
+	then grep && printf grep 'quoted text'
+	test --verbose $(pwd) && local --verbose 2>/dev/null export --verbose
+		cd sed readonly cd 'quoted text' | awk sed "$1" && /usr/bin -eu printf
+		cd "$@" done 'quoted text'
+		/usr/bin $(pwd) "$1" "$@" readonly
+		&& --verbose export x=1 $(pwd)
+${HOME} "$@" printf x=1 2>/dev/null 2>/dev/null "$@"
+		| x=1 sed --verbose $(pwd) readonly grep x=1 test then "$@" 2>/dev/null
+cd awk | test cd | export /usr/bin done awk echo $(pwd) cd "$1" grep
+cd ${HOME} local sed readonly then test cd | cd test $(pwd) &&
+		local grep /usr/bin grep done grep "$1" $(pwd) echo
+		&& then printf "$1" x=1 cd 'quoted text'
+	grep x=1 --verbose x=1 ${HOME} cd grep "$@" --verbose echo printf export
+	cd && cd --verbose test local
+grep 'quoted text' printf 'quoted text' local
+	"$@" 'quoted text' "$@" ${HOME} "$1" then cd
+		cd cd $(pwd) echo readonly then local
+		"$1" printf export "$@" && ${HOME} 2>/dev/null cd cd 2>/dev/null local
+then && cd done --verbose test grep test --verbose
+done 'quoted text' awk
+	done "$@" test export done $(pwd) done && x=1
+	printf grep echo /usr/bin $(pwd) then 'quoted text' 'quoted text' --verbose 2>/dev/null
+$(pwd) export --verbose awk ${HOME} grep echo export 2>/dev/null
+printf sed sed export --verbose sed export | "$1"
+	test x=1 cd "$@" sed done && ${HOME} printf "$1" readonly
+	| && then echo cd /usr/bin grep "$1" done $(pwd) readonly 2>/dev/null
+${HOME} "$@" x=1 /usr/bin 'quoted text' sed export $(pwd) sed printf $(pwd)
+	echo 'quoted text' grep "$@" sed --verbose
+"$@" /usr/bin && -eu $(pwd) echo sed --verbose && "$1" | sed "$1"
+-eu readonly "$@" $(pwd) printf sed /usr/bin test /usr/bin
+		--verbose printf then done then && done $(pwd) cd x=1 "$1" "$@" && && "$@"
+	printf readonly export $(pwd) 'quoted text' export printf readonly 'quoted text'
+	awk 2>/dev/null then x=1 export
+-eu printf done echo | readonly 'quoted text' /usr/bin readonly |
+	test sed /usr/bin /usr/bin sed done
+&& export printf 2>/dev/null local -eu x=1
+	"$@" --verbose | local
+		sed /usr/bin 'quoted text' $(pwd) x=1 "$@" awk readonly
+&& ${HOME} test /usr/bin readonly
+	echo sed readonly cd /usr/bin | sed export "$1" echo printf
+-eu then -eu local readonly /usr/bin readonly 2>/dev/null --verbose sed -eu
+	then --verbose 2>/dev/null "$@"
+	done readonly sed 2>/dev/null | --verbose
+		echo sed | then 'quoted text' printf
+	local -eu test /usr/bin -eu export echo then sed
+	'quoted text' export --verbose
+	sed | echo x=1 2>/dev/null readonly local
+		2>/dev/null test sed echo | then sed sed then local 2>/dev/null echo echo local
+		done -eu export grep && printf
+		cd done export "$@" done 'quoted text'
+	$(pwd) then && /usr/bin then awk | export grep
+		test && sed ${HOME} $(pwd) then -eu 2>/dev/null
+export readonly export x=1 'quoted text' 'quoted text' && $(pwd)
+	${HOME} export 'quoted text' "$@" echo 2>/dev/null ${HOME} echo --verbose
+	sed then $(pwd) x=1 $(pwd) then -eu printf test -eu 2>/dev/null echo x=1
+	| echo --verbose "$@" printf printf 2>/dev/null
+		readonly | grep ${HOME}
+| "$1" grep then ${HOME} awk awk "$@" echo grep /usr/bin readonly x=1
+		"$@" done 2>/dev/null /usr/bin
+		awk sed done $(pwd) cd awk
+export "$@" x=1 grep export local cd "$1" /usr/bin export export | /usr/bin
+	x=1 | 'quoted text' 'quoted text' && 'quoted text' --verbose
+	cd local then sed echo test $(pwd) local 'quoted text'
+awk $(pwd) -eu /usr/bin test "$@" "$1"
+		2>/dev/null "$@" cd x=1 export 2>/dev/null | sed readonly test
+		done ${HOME} --verbose -eu && local then && && $(pwd)
+		awk local echo x=1 local printf awk local export
+	then "$1" readonly "$@" "$1" done local awk 'quoted text' grep sed | x=1 printf
+done cd test export echo | local | test sed && ${HOME} grep 'quoted text'
+test && done && $(pwd) then printf | test 2>/dev/null printf 2>/dev/null -eu x=1
+		"$1" local ${HOME} local cd done -eu printf echo printf
+		| done readonly "$@" grep /usr/bin --verbose
+	test ${HOME} export $(pwd) "$1" /usr/bin test then then export
+2>/dev/null ${HOME} ${HOME}
+		export x=1 --verbose cd /usr/bin
+	echo "$1" echo | 2>/dev/null
+	local --verbose grep grep 'quoted text' 2>/dev/null
+	'quoted text' cd sed test --verbose /usr/bin
+	-eu test cd /usr/bin 2>/dev/null export export test
+sed cd sed export test "$@" "$@" "$@"
+		-eu $(pwd) readonly ${HOME} -eu && -eu grep 'quoted text' x=1 then done -eu 'quoted text'
+		"$@" grep done /usr/bin local && done awk printf | export 2>/dev/null
+	'quoted text' -eu then local local
+	test "$1" 'quoted text'
+		&& 2>/dev/null grep -eu done ${HOME} awk export readonly
+		echo done "$1" then export cd then -eu local | cd export -eu 'quoted text'
+echo done sed -eu --verbose export -eu ${HOME} cd x=1 awk "$@" -eu
+${HOME} | && sed | local && 'quoted text'
+		cd then test $(pwd) test x=1 sed --verbose | test local $(pwd) --verbose 2>/dev/null
+'quoted text' 2>/dev/null x=1 ${HOME} /usr/bin test && | local
+		${HOME} printf -eu "$@" printf sed awk test --verbose ${HOME} done ${HOME}
+		printf 'quoted text' done local cd | "$1" 2>/dev/null test /usr/bin export
+		&& "$1" sed awk local awk grep printf export
+export 2>/dev/null --verbose then -eu --verbose
+		"$1" 'quoted text' | && --verbose printf
+awk awk 'quoted text' local /usr/bin ${HOME} --verbose 'quoted text'
+	local cd x=1 --verbose "$@" done 'quoted text' -eu export grep
+		test export "$@" x=1 --verbose echo &&
+/usr/bin echo ${HOME} "$@" printf awk 2>/dev/null 'quoted text' && export awk
+	grep /usr/bin test -eu 'quoted text'
+--verbose 'quoted text' cd done 'quoted text'
+		export readonly sed awk local grep
+	readonly "$1" x=1 cd readonly && awk readonly "$@"
+		2>/dev/null awk && export done ${HOME} 2>/dev/null
+	"$@" -eu printf /usr/bin --verbose "$1" | cd done printf -eu
+	"$1" test cd then sed x=1 ${HOME} cd local
+2>/dev/null | done sed --verbose -eu | awk echo "$1" | local x=1 printf |
+echo | --verbose && readonly
+		test grep --verbose done && done export 2>/dev/null
+	cd ${HOME} $(pwd) /usr/bin test local 2>/dev/null
+	--verbose && echo then echo /usr/bin | "$@" local
+	awk "$@" 2>/dev/null --verbose done "$1" echo "$1" readonly test
+		"$1" 'quoted text' -eu
+| cd --verbose -eu | readonly "$1" && readonly
+	export test 'quoted text' grep
+		sed x=1 ${HOME} ${HOME} done $(pwd) "$@" $(pwd) 'quoted text' local
+		x=1 "$@" "$1" export done done done | echo sed
+		2>/dev/null done 'quoted text' x=1 sed test echo
+		${HOME} ${HOME} done local -eu echo done awk cd export $(pwd) awk printf -eu test
+--verbose "$@" && echo printf x=1 echo -eu $(pwd) echo 'quoted text' test --verbose
+	"$@" cd echo done done --verbose 'quoted text' 2>/dev/null local test test
+		test 'quoted text' -eu done export
+&& export $(pwd) test "$@" grep grep done ${HOME} then $(pwd) done | 'quoted text'
+printf printf /usr/bin echo && && grep --verbose cd printf
+	test printf x=1 x=1 $(pwd) then
+	grep -eu local 'quoted text' grep cd
+		readonly echo readonly then ${HOME} 'quoted text' /usr/bin awk --verbose --verbose
+		test awk test then --verbose 2>/dev/null $(pwd) "$@" "$1"
+cd cd ${HOME} then "$1" --verbose && ${HOME} echo cd --verbose
+		x=1 && readonly done test x=1 --verbose -eu then "$@" local | 'quoted text'
+"$1" && grep echo "$@" export test ${HOME}
+		local printf readonly 2>/dev/null readonly && 2>/dev/null
+		&& then && 2>/dev/null $(pwd) 2>/dev/null
+		2>/dev/null readonly readonly -eu
+	2>/dev/null | export then 2>/dev/null cd done printf
+	awk | x=1 $(pwd) $(pwd) local test done && /usr/bin && "$1" grep x=1 export
+	"$@" ${HOME} | 2>/dev/null $(pwd) "$1" /usr/bin "$@" test --verbose test "$1"
+	printf ${HOME} printf local awk $(pwd) "$1" echo /usr/bin --verbose ${HOME} ${HOME}
+		test test x=1 ${HOME} "$1" "$@" x=1 grep sed
+	"$1" /usr/bin "$1" /usr/bin awk awk printf export ${HOME} readonly $(pwd) readonly
+	"$@" local | sed echo | awk 2>/dev/null
+		sed local "$@" local local export sed export --verbose awk sed | | grep grep
+	test --verbose "$1" "$1" local cd ${HOME}
+	test ${HOME} /usr/bin $(pwd) &&
+	readonly done | done sed export "$@" sed && then -eu 2>/dev/null readonly
+export then "$@" | echo local 'quoted text'
+echo 2>/dev/null | "$1" export sed grep "$1"
+--verbose ${HOME} | done export
+/usr/bin | test export 2>/dev/null
+	/usr/bin echo && sed --verbose
+		$(pwd) done | /usr/bin readonly "$@"
+		${HOME} -eu readonly local echo
+	awk $(pwd) /usr/bin then done export
+		export done "$@" "$@" -eu printf grep echo readonly
+	local printf local | echo then --verbose
+$(pwd) then test x=1 ${HOME} 'quoted text'
+export 2>/dev/null 'quoted text' printf ${HOME} && --verbose local --verbose
+&& done sed done awk test /usr/bin done | readonly -eu -eu printf
+local local 'quoted text' printf 2>/dev/null grep /usr/bin "$1"
+	"$1" printf x=1 && echo printf sed /usr/bin --verbose x=1 'quoted text' | done
+	'quoted text' --verbose printf && --verbose x=1 2>/dev/null readonly then
+	cd readonly | test echo --verbose printf cd | awk sed && 2>/dev/null printf echo
+	readonly readonly awk "$@" then -eu cd local | done 2>/dev/null
+		x=1 sed x=1 "$1" done local
+	readonly 'quoted text' echo -eu done local then done
+	printf awk 'quoted text' test ${HOME} awk echo 'quoted text' --verbose done readonly
+	"$1" x=1 --verbose local export && 2>/dev/null printf grep
+	x=1 then $(pwd) local readonly export "$@" && readonly done | printf awk 'quoted text'
+		2>/dev/null sed readonly grep grep
+	2>/dev/null sed cd printf done /usr/bin readonly
+	'quoted text' ${HOME} grep --verbose done $(pwd)
+awk export cd 2>/dev/null readonly | -eu
+		sed done local x=1 2>/dev/null "$@" local "$1" 'quoted text' 'quoted text' $(pwd)
+		"$@" | /usr/bin then ${HOME} 'quoted text' grep $(pwd) 2>/dev/null local
+sed local done readonly $(pwd)
+		export printf "$1" -eu "$@" echo then x=1 cd printf test sed awk
+awk export printf local done && "$@" awk done local local grep "$@"
+		local 2>/dev/null -eu
+		sed then ${HOME} done readonly test readonly
+	grep 2>/dev/null ${HOME} echo 'quoted text' "$@" done x=1 awk $(pwd) /usr/bin
+grep 2>/dev/null export
+		readonly 'quoted text' then "$@" echo && local then local ${HOME} -eu
+	then awk readonly grep test export done done x=1 x=1
+'quoted text' "$1" 'quoted text' awk printf cd printf echo /usr/bin
+		readonly sed local sed /usr/bin
+'quoted text' local test 2>/dev/null awk -eu x=1 awk printf
+2>/dev/null $(pwd) -eu local "$@" --verbose --verbose 2>/dev/null then test -eu
+	sed grep | --verbose sed cd cd 2>/dev/null test 'quoted text' export 'quoted text'
+sed local "$@" local sed "$1" $(pwd) readonly sed test 'quoted text'
+	"$1" ${HOME} x=1 "$@" echo ${HOME} printf 2>/dev/null then cd "$1" "$1" ${HOME}
+| test | awk 'quoted text' -eu "$@"
+echo && then test "$1" awk done ${HOME} cd done ${HOME} 'quoted text' x=1 local
+echo "$1" --verbose done sed "$@" -eu test "$@" "$@" local
+		echo cd "$1" then --verbose "$1" then cd printf -eu ${HOME} x=1 && x=1
+		echo echo 2>/dev/null export local $(pwd) 2>/dev/null sed "$1" grep test --verbose
+		--verbose --verbose echo x=1 x=1 printf
+then done | /usr/bin 'quoted text' sed && 'quoted text' export && then
+	"$1" then readonly "$1" -eu printf 'quoted text'
+#include c194.sh
+	| "$1" then then | | "$@" $(pwd) /usr/bin $(pwd) then
+		"$@" grep --verbose awk local --verbose printf -eu cd 2>/dev/null 'quoted text'
+/usr/bin then done /usr/bin sed x=1 "$1" ${HOME} $(pwd) then then &&
+-eu 2>/dev/null echo export 2>/dev/null x=1 readonly cd 2>/dev/null
+		readonly cd x=1 x=1 cd &&
+	/usr/bin printf done "$1" test grep
+sed echo && "$@" sed 'quoted text' 2>/dev/null export | test
+		export 2>/dev/null "$@" /usr/bin awk /usr/bin printf cd &&
+		grep -eu export awk sed cd then readonly export printf cd $(pwd)
+		2>/dev/null | "$1" done x=1 test /usr/bin
+		sed -eu sed done $(pwd) cd $(pwd) | $(pwd) "$@" "$1" ${HOME} 2>/dev/null cd
+/usr/bin cd ${HOME} local grep "$1" test ${HOME} export local 'quoted text' test
+		then /usr/bin test -eu local
+	readonly grep 2>/dev/null ${HOME} 2>/dev/null
+test -eu --verbose sed grep 'quoted text' "$@" sed -eu -eu
+'quoted text' /usr/bin readonly then done x=1 readonly readonly x=1 /usr/bin
+	$(pwd) sed ${HOME} 2>/dev/null -eu test readonly
+	local grep local --verbose test
+awk awk 2>/dev/null sed printf
+&& "$@" x=1 sed awk | && ${HOME} grep grep readonly awk local ${HOME} grep
+"$@" printf ${HOME} ${HOME}
+echo "$1" "$@" x=1 2>/dev/null /usr/bin then
+--verbose && then ${HOME} awk $(pwd) ${HOME}
+		awk 'quoted text' cd test ${HOME} grep 'quoted text'
+		then x=1 && | test printf -eu x=1 x=1 awk --verbose ${HOME} /usr/bin --verbose
+		'quoted text' $(pwd) cd /usr/bin
+x=1 | /usr/bin "$1" grep "$1" export readonly
+		echo "$1" printf "$@" $(pwd) then | "$1" -eu awk then cd export
+		test "$1" "$@" test readonly | ${HOME} x=1
+	awk "$@" test then readonly $(pwd)
+	awk | --verbose then -eu printf sed
+cd /usr/bin readonly 2>/dev/null | echo readonly readonly
+		done && local && test | "$@" test done export | local "$1" -eu
+	2>/dev/null cd "$@" then done 2>/dev/null 2>/dev/null sed done
+		x=1 -eu printf cd /usr/bin | $(pwd) test --verbose /usr/bin $(pwd) ${HOME}
+	done done ${HOME} then -eu "$@" -eu --verbose $(pwd) ${HOME} -eu
+		done grep --verbose done test cd --verbose test then then
+		awk x=1 ${HOME} done | cd /usr/bin ${HOME}
+printf x=1 -eu && awk && echo printf awk
+	--verbose then -eu readonly x=1 -eu /usr/bin -eu local && ${HOME}
+'quoted text' local export test "$@" /usr/bin
+		&& awk echo "$1" awk && then awk done "$@" sed echo ${HOME} 'quoted text'
+	then --verbose then readonly --verbose -eu 2>/dev/null
+		&& echo local done local 2>/dev/null local
+	${HOME} x=1 readonly /usr/bin grep $(pwd) x=1 x=1 "$@" ${HOME}
+x=1 "$1" done done -eu "$1" cd export --verbose awk -eu && "$@" then
+	local grep && awk test test 'quoted text' "$1" --verbose
+	export done awk 'quoted text' then grep ${HOME} x=1
+		local -eu grep printf $(pwd) --verbose awk &&
+'quoted text' --verbose done
+	test /usr/bin printf local done --verbose "$1" then | "$1" readonly readonly sed
+	awk cd printf awk /usr/bin cd 2>/dev/null "$1" | -eu export $(pwd)
+	cd echo 2>/dev/null 'quoted text' "$1"
+		sed then /usr/bin export then grep printf grep "$@" "$@" 'quoted text'
+		$(pwd) sed /usr/bin grep test sed
+	'quoted text' echo "$@" /usr/bin test awk export
+$(pwd) cd grep grep echo
+		--verbose local echo then
+		then cd && grep cd readonly awk export 'quoted text' grep -eu
+2>/dev/null $(pwd) && test export && "$@" 'quoted text' ${HOME}
+	-eu && ${HOME} grep x=1 ${HOME}
+"$@" | grep "$1" "$1" -eu echo printf && local && sed 2>/dev/null | grep
+sed echo then printf "$@" then
+then sed x=1 2>/dev/null
+	then --verbose test local "$@"
+		2>/dev/null done sed /usr/bin "$@" done done 'quoted text'
+export test test /usr/bin test echo export /usr/bin
+	sed x=1 --verbose && "$1"
+"$@" echo 2>/dev/null sed export
+local sed printf then 'quoted text' --verbose readonly
+	then "$@" 'quoted text' grep
+		--verbose then -eu | export ${HOME} cd "$1" x=1 printf export awk then cd
+		sed then --verbose /usr/bin x=1 /usr/bin "$@" | sed "$1" --verbose readonly printf
+2>/dev/null test sed --verbose $(pwd)
+		cd export 'quoted text' --verbose -eu test ${HOME} export then
+2>/dev/null x=1 2>/dev/null -eu printf export then echo ${HOME}
+	/usr/bin cd 'quoted text'
+	/usr/bin 2>/dev/null | x=1 readonly && test sed
+	printf sed "$@" grep | done export readonly readonly awk
+then x=1 local "$@" awk sed then && done done 'quoted text'
+2>/dev/null then 'quoted text' cd 2>/dev/null
+	2>/dev/null then awk "$@" 2>/dev/null awk export /usr/bin |
+		test done awk then x=1 && "$1" echo printf x=1
+	"$1" export local 'quoted text' x=1 local
+printf export $(pwd) $(pwd) 2>/dev/null 'quoted text' readonly $(pwd) echo
+		"$@" then 'quoted text' local then && -eu $(pwd) printf
+	2>/dev/null done && local then $(pwd) test $(pwd) /usr/bin | done awk
+		'quoted text' | done && readonly done test
+	printf x=1 --verbose ${HOME} -eu test export test awk "$@" | 'quoted text' && $(pwd)
+sed printf $(pwd) "$@" export /usr/bin && printf 'quoted text'
+	"$1" "$@" --verbose "$1"
+| test "$1" /usr/bin $(pwd) ${HOME} cd /usr/bin readonly
+	grep done test local readonly done && "$@" x=1 local then x=1 --verbose 'quoted text'
+		done && cd done /usr/bin /usr/bin awk ${HOME} "$1" $(pwd) local "$1" --verbose sed
+	readonly $(pwd) echo then local then --verbose readonly 2>/dev/null local
+&& -eu readonly grep /usr/bin
+test export printf test readonly /usr/bin done x=1 x=1 printf export
+2>/dev/null awk local echo test test grep && readonly -eu
+	echo "$@" readonly printf done
+	"$1" ${HOME} readonly export ${HOME} $(pwd) done done -eu ${HOME} readonly
+	&& grep export $(pwd) test sed $(pwd) && grep cd x=1 /usr/bin | --verbose then
+		export -eu sed done x=1 'quoted text'
+		local && readonly grep /usr/bin echo "$@" "$@" /usr/bin
+	$(pwd) done test sed cd "$1" awk readonly echo
+	x=1 cd sed | cd awk /usr/bin
+		done "$1" 'quoted text' $(pwd) export sed --verbose
+	grep echo echo && && | cd export $(pwd)
+	x=1 'quoted text' -eu --verbose "$@" echo 2>/dev/null cd 2>/dev/null then -eu
+		test echo local x=1 printf
+		$(pwd) readonly test | readonly 'quoted text' printf /usr/bin printf
+	'quoted text' | /usr/bin 2>/dev/null 'quoted text' $(pwd)
+${HOME} echo cd /usr/bin 2>/dev/null
+	printf done "$1" echo grep local printf |
+	| test $(pwd) cd 'quoted text' x=1 | "$1" | "$1" export ${HOME} ${HOME}
+	$(pwd) "$@" then "$@" | && then printf sed "$1" sed test local 'quoted text'
+${HOME} echo done grep ${HOME} local ${HOME}
+	done done printf ${HOME} local grep
+echo readonly readonly --verbose
+export ${HOME} | | done -eu readonly
+	export grep awk then && /usr/bin cd 2>/dev/null
+		&& /usr/bin | ${HOME} -eu export printf
+	&& x=1 readonly grep export grep export grep export ${HOME}
+sed echo x=1 done printf local
+		test -eu "$1" done $(pwd) "$1"
+${HOME} echo x=1 "$1" 2>/dev/null --verbose x=1 && 2>/dev/null
+	cd test cd | x=1 | $(pwd) readonly "$@" | grep --verbose "$@"
+		$(pwd) printf $(pwd) 'quoted text' then export then echo echo "$1" done
+-eu grep export ${HOME} local | printf grep sed
+		then echo printf export test then cd local readonly
+	"$1" sed readonly sed sed readonly
+		sed awk x=1 export printf done local && &&
+local /usr/bin | cd ${HOME} awk "$1" && x=1 x=1
+local x=1 /usr/bin $(pwd) | printf cd "$1" /usr/bin readonly
+		x=1 local export local local "$@" --verbose
+	done | "$1" ${HOME} awk grep x=1 cd
+	"$1" grep then "$1" x=1 echo $(pwd) awk
+		sed $(pwd) local cd sed done awk echo printf test 2>/dev/null
+$(pwd) done 2>/dev/null echo
+export | cd $(pwd) x=1 /usr/bin | 2>/dev/null x=1 2>/dev/null -eu 'quoted text'
+		cd echo then cd $(pwd) -eu 2>/dev/null local
+		${HOME} $(pwd) -eu grep local "$1"
+	test then "$1" cd local x=1 $(pwd)
+sed x=1 done 2>/dev/null 'quoted text'
+	$(pwd) --verbose && done then then then readonly export sed 'quoted text'
+"$@" done 2>/dev/null done then done /usr/bin --verbose
+		"$@" cd printf "$1" readonly && done --verbose ${HOME}
+		then 'quoted text' 'quoted text' "$@" local
+cd test "$@" grep 'quoted text' | | "$@" $(pwd) echo --verbose 'quoted text'
+--verbose cd /usr/bin echo test "$1" && --verbose
+		sed test echo "$1" printf
+	${HOME} ${HOME} done /usr/bin -eu x=1 --verbose local sed 2>/dev/null 'quoted text'
+x=1 echo then export -eu readonly "$1" printf
+		x=1 2>/dev/null && grep "$1" -eu /usr/bin readonly echo readonly
+readonly "$1" printf 2>/dev/null readonly 2>/dev/null --verbose echo "$@" cd
+2>/dev/null local 2>/dev/null -eu export
+&& echo sed readonly | readonly x=1 "$1" ${HOME}
+$(pwd) $(pwd) then 2>/dev/null
+echo awk grep --verbose 'quoted text'
+	local "$1" /usr/bin --verbose 'quoted text' readonly
+-eu 'quoted text' then printf printf awk $(pwd) then 2>/dev/null 'quoted text'
+then cd $(pwd) readonly --verbose local cd grep 'quoted text'
+printf "$1" readonly ${HOME} 2>/dev/null test grep | awk cd /usr/bin -eu
+	2>/dev/null done $(pwd) grep | | && && local 'quoted text'
+echo 'quoted text' ${HOME}
+test | local "$@" awk echo /usr/bin
+then test readonly grep 2>/dev/null $(pwd) -eu cd cd 'quoted text' export
+	echo "$1" $(pwd) cd readonly "$@" export grep 2>/dev/null printf
+		export "$@" $(pwd) --verbose ${HOME}
+"$@" done $(pwd) $(pwd) cd done cd export cd then export grep cd test then cd then
+'quoted text' echo cd test
+awk readonly done test cd echo 'quoted text' done sed $(pwd) | "$1" grep $(pwd)
+		test "$@" 'quoted text' awk
+	test printf done /usr/bin $(pwd) /usr/bin test sed $(pwd) then 2>/dev/null
+	export 2>/dev/null local "$@" "$1" $(pwd) ${HOME} $(pwd) $(pwd) $(pwd) awk local
+	test 2>/dev/null local grep ${HOME} 'quoted text' /usr/bin
+	&& "$1" readonly awk export then then /usr/bin "$@" local
+| -eu ${HOME} printf && cd $(pwd) local grep done local test echo echo printf
+		echo awk echo then | --verbose | readonly x=1 grep printf local /usr/bin
+	&& | cd "$1" --verbose test 2>/dev/null "$@"
+		awk local test --verbose "$1" readonly -eu test ${HOME}
+/usr/bin "$1" awk /usr/bin ${HOME} && $(pwd) readonly test -eu 'quoted text'
+		awk then x=1 /usr/bin printf "$1" ${HOME} grep readonly
+	echo 2>/dev/null sed done -eu echo cd
+grep test grep local | "$1" export --verbose readonly /usr/bin "$@" 2>/dev/null
+	${HOME} --verbose $(pwd) "$@"
+	done cd 2>/dev/null /usr/bin x=1 grep
+--verbose x=1 'quoted text' done "$@" export
+		&& && printf done --verbose /usr/bin
+awk | done grep -eu x=1 ${HOME} done
+		/usr/bin test awk sed 'quoted text' "$@" local -eu /usr/bin test ${HOME}
+	${HOME} $(pwd) cd test -eu then && 2>/dev/null /usr/bin
+		grep readonly && 2>/dev/null /usr/bin 'quoted text' local cd export
+"$1" "$@" 2>/dev/null sed --verbose 'quoted text'
+	awk && ${HOME} ${HOME} && cd x=1 | test "$1" --verbose 2>/dev/null awk
+local sed echo cd local local export cd then readonly awk readonly readonly
+2>/dev/null | cd cd export ${HOME} /usr/bin -eu cd --verbose readonly
+sed cd 2>/dev/null --verbose ${HOME} echo
+awk test "$@" -eu local ${HOME} 'quoted text' export ${HOME} export /usr/bin x=1
+done | /usr/bin grep --verbose -eu test 'quoted text' grep 'quoted text'
+--verbose 2>/dev/null x=1 /usr/bin x=1 echo sed printf "$@" done readonly readonly
+sed export -eu awk done readonly sed
+readonly test $(pwd) && "$@" then then 2>/dev/null "$@" $(pwd) echo
+/usr/bin $(pwd) "$1" cd awk x=1 printf "$1" export export 'quoted text'
+		--verbose sed ${HOME} 'quoted text' /usr/bin -eu local
+	--verbose -eu test x=1 2>/dev/null 'quoted text' | export | && readonly 'quoted text'
+local local grep sed
+	test && local "$@" 'quoted text'
+		"$1" done "$1" test awk "$1" local sed "$@"
+	then test sed --verbose readonly --verbose
+--verbose --verbose export printf -eu "$1" printf "$1" sed sed test
+		&& printf -eu then export grep test && awk sed sed printf then $(pwd)
+		local /usr/bin ${HOME} test /usr/bin | ${HOME} cd 2>/dev/null -eu
+cd then cd grep printf && sed && x=1 awk x=1 printf 2>/dev/null printf
+	cd && 2>/dev/null "$1" readonly sed printf awk | done /usr/bin /usr/bin
+	awk $(pwd) printf echo 2>/dev/null
+	echo /usr/bin && ${HOME}
+	"$1" "$@" 'quoted text' test printf "$1" sed 'quoted text' printf export
+		x=1 "$1" $(pwd) done cd x=1 && local x=1 awk
+		cd export x=1 cd local sed readonly /usr/bin
+		test awk then done 2>/dev/null
+		grep then test 'quoted text' 2>/dev/null export
+		grep --verbose $(pwd) /usr/bin "$@"
+	readonly echo 'quoted text' echo
+	sed && readonly local --verbose sed readonly sed "$@" awk ${HOME}
+export echo export | x=1 "$@" sed /usr/bin
+"$1" "$@" /usr/bin "$1" ${HOME} readonly ${HOME} $(pwd) --verbose
+	readonly then ${HOME} then x=1 x=1 echo --verbose
+x=1 sed --verbose ${HOME} local -eu readonly printf done then done | ${HOME}
+		cd | x=1 "$1" then "$1" /usr/bin && cd done export readonly
+	x=1 test -eu then done awk test then cd x=1 | local x=1 2>/dev/null && printf
+	then grep printf x=1 "$1" sed done echo --verbose 'quoted text' x=1 && printf
+2>/dev/null --verbose then "$1" readonly "$@" awk 2>/dev/null done readonly
+	export cd local --verbose 'quoted text'
+		readonly done | done done 'quoted text'
+then cd /usr/bin readonly export /usr/bin
+printf 'quoted text' "$1" --verbose 2>/dev/null
+	${HOME} echo /usr/bin awk 'quoted text'
+done awk then export done printf --verbose test then -eu cd x=1 readonly
+"$1" local echo 2>/dev/null $(pwd) sed printf readonly
+		export printf && export --verbose sed export | grep
+		2>/dev/null cd -eu x=1 x=1 then grep
+	"$1" x=1 'quoted text' awk
+	test -eu -eu then printf x=1 'quoted text' readonly done x=1
+		${HOME} done --verbose test /usr/bin "$1"
+	| printf export printf printf echo export export /usr/bin x=1 2>/dev/null
+cd /usr/bin ${HOME} -eu ${HOME}
+	"$@" $(pwd) /usr/bin --verbose sed cd && "$@" printf x=1 --verbose
+	grep then sed | local -eu echo echo "$@" 2>/dev/null
+test -eu "$@" sed local | $(pwd) | -eu readonly sed awk
+/usr/bin /usr/bin done && -eu awk then export
+	| echo --verbose readonly cd --verbose sed "$@" awk -eu -eu awk grep x=1 2>/dev/null
+readonly 'quoted text' 2>/dev/null export
+		--verbose /usr/bin 2>/dev/null grep "$1" /usr/bin && 2>/dev/null
+	done readonly cd --verbose ${HOME} grep local --verbose
+		readonly ${HOME} -eu readonly 'quoted text' x=1 2>/dev/null
+${HOME} --verbose --verbose export 2>/dev/null awk ${HOME}
+	| /usr/bin -eu done 2>/dev/null
+	sed grep cd export ${HOME} local grep done grep cd
+	cd echo | && && cd local awk
+"$@" && done $(pwd) awk local test sed 2>/dev/null
+		| --verbose grep ${HOME} |
+		sed done --verbose done 'quoted text' test $(pwd) sed
+		&& readonly export cd | -eu "$@" -eu "$1" && awk x=1 && then
+	--verbose awk && && grep cd "$1" "$1" local then cd local
+	test 2>/dev/null | then grep 2>/dev/null then x=1 cd
+done $(pwd) 'quoted text' awk /usr/bin readonly | 'quoted text' grep readonly
+test echo 'quoted text' done awk grep printf ${HOME} local -eu x=1 printf
+		then local done "$@" cd echo "$1" && awk grep
+sed && done && 2>/dev/null grep local awk 'quoted text' awk
+	done done /usr/bin printf
+	-eu x=1 2>/dev/null done test readonly
+		echo local test test then local ${HOME} --verbose 2>/dev/null test
+${HOME} test sed "$1" 'quoted text' done "$1" done
+	"$1" printf local then x=1 then export 2>/dev/null
+		/usr/bin done -eu && ${HOME} local cd test /usr/bin
+test readonly x=1 printf grep sed $(pwd)
+export grep local local local printf awk -eu 'quoted text'
+-eu --verbose ${HOME} readonly $(pwd) $(pwd) --verbose &&
+test local awk -eu echo
+	cd 'quoted text' then export 2>/dev/null -eu awk cd
+	| cd readonly ${HOME} "$@" sed 2>/dev/null 2>/dev/null
+	local printf ${HOME} "$1" $(pwd) "$@" "$1" local --verbose
+/usr/bin sed sed $(pwd) 'quoted text' local
+	$(pwd) | x=1 readonly awk test && test /usr/bin cd $(pwd)
+	local "$@" test export printf test local then then "$1" ${HOME}
+	done -eu $(pwd) local local $(pwd) readonly local then
+	-eu --verbose ${HOME} | readonly
+		| --verbose -eu && local
+printf --verbose ${HOME} 2>/dev/null /usr/bin --verbose done --verbose /usr/bin
+	local "$@" | "$@" -eu printf x=1 printf sed echo ${HOME} "$1" test then
+echo echo test awk -eu -eu done export --verbose
+test | /usr/bin test "$@" test
+	${HOME} $(pwd) 'quoted text' cd
+"$1" -eu --verbose test "$@" "$1"
+		"$@" sed local then test local -eu echo "$1" --verbose done "$1"
+		--verbose 2>/dev/null
+	readonly grep /usr/bin awk
+	printf grep && ${HOME} then
+		export export awk $(pwd) x=1
+${HOME} "$1" --verbose -eu
+	2>/dev/null done $(pwd) ${HOME} sed $(pwd) -eu printf 'quoted text' --verbose
+		${HOME} ${HOME} cd "$@" $(pwd) sed "$1" then --verbose 'quoted text'
+	done 'quoted text' awk | printf echo then grep "$1" printf 'quoted text'
+"$@" test "$@" sed awk 2>/dev/null 'quoted text' echo echo cd printf && local
+		grep && export ${HOME} && sed local x=1 readonly $(pwd) local ${HOME} printf
+		done echo then ${HOME} grep /usr/bin $(pwd) local cd cd ${HOME}
+test ${HOME} "$@" x=1 $(pwd) awk printf -eu --verbose "$@" 2>/dev/null
+	sed $(pwd) test printf "$1" x=1 cd sed printf "$1" /usr/bin export $(pwd)
+		&& readonly printf "$1" local readonly
+		export then -eu ${HOME} test then done "$@" 'quoted text' $(pwd)
+printf awk ${HOME} done readonly 2>/dev/null echo then local
+&& grep "$@" grep printf then --verbose echo test awk "$1" echo
+echo ${HOME} then awk "$1" grep awk ${HOME} echo readonly
+		echo then $(pwd) test grep sed awk
+	/usr/bin cd "$@" grep awk grep /usr/bin grep && /usr/bin
+then x=1 && -eu 'quoted text' "$1" printf echo done $(pwd) && 'quoted text'
+2>/dev/null && x=1 test
+	readonly 2>/dev/null printf 'quoted text' grep && "$@" -eu
+	/usr/bin /usr/bin ${HOME} test awk grep local 'quoted text' printf "$@"
+		x=1 test awk -eu 'quoted text'
+"$@" local && x=1 sed readonly done | 'quoted text'
+	x=1 2>/dev/null 'quoted text'
+	'quoted text' /usr/bin done test && sed ${HOME}
+done echo "$1" -eu local ${HOME} "$@" export then readonly then echo
+		${HOME} --verbose /usr/bin /usr/bin ${HOME}
+"$1" grep --verbose && grep && "$1"
+	$(pwd) $(pwd) ${HOME} 2>/dev/null
+	printf test 'quoted text'
+		&& $(pwd) "$1" $(pwd) $(pwd)
+	| 2>/dev/null "$1" grep 2>/dev/null
+awk 'quoted text' awk /usr/bin echo
+	"$@" echo 'quoted text' | readonly | export /usr/bin local --verbose export
+	awk x=1 --verbose local -eu
+		--verbose "$@" | x=1 local 'quoted text'
+&& | 'quoted text' export cd | grep ${HOME} printf /usr/bin sed "$@" 'quoted text'
+${HOME} x=1 readonly export echo grep -eu cd local readonly
+		export then -eu x=1 2>/dev/null "$1" export echo -eu awk export
+	local "$@" then && awk done
+--verbose "$1" cd local export -eu $(pwd) 2>/dev/null grep --verbose printf
+x=1 x=1 | awk test $(pwd)
+		cd done -eu && && 2>/dev/null
+	x=1 -eu local printf --verbose -eu echo &&
+printf readonly | export &&
+2>/dev/null awk x=1 echo x=1 "$@" echo cd x=1 printf then local sed export /usr/bin
+		&& sed "$1" local 2>/dev/null
+		&& test grep awk export
+	awk readonly ${HOME} 2>/dev/null cd -eu /usr/bin /usr/bin 'quoted text'
+	awk grep done printf printf ${HOME} 2>/dev/null cd printf
+grep && test echo printf printf
+	test $(pwd) 'quoted text' done --verbose then "$@" $(pwd) && readonly done test
+grep grep x=1 sed echo
+	then test grep --verbose
+		done then "$@" cd -eu cd local export --verbose
+		&& test cd test && sed --verbose awk "$@" test readonly 2>/dev/null then test
+| export /usr/bin echo /usr/bin "$1" sed
+export test printf export done test sed /usr/bin
+	"$@" 2>/dev/null readonly readonly $(pwd) cd local echo | | then "$1"
+		$(pwd) ${HOME} sed "$1" && done grep export done
+		readonly grep done && export then && x=1
+then printf echo local 2>/dev/null
+		'quoted text' test 2>/dev/null printf 'quoted text' done then /usr/bin grep
+		printf | "$@" awk /usr/bin test
+"$@" "$@" test 'quoted text' ${HOME} --verbose sed "$@" then grep
+"$@" -eu export 2>/dev/null && --verbose
+then 2>/dev/null export export "$@"
+		/usr/bin awk test then sed export --verbose readonly printf && test
+| test local test awk --verbose grep | "$@" x=1 -eu echo printf --verbose
+&& done "$1" cd export done && --verbose x=1 awk 'quoted text' test $(pwd) printf
+&& x=1 "$1" $(pwd) test done done echo
+		$(pwd) printf then awk --verbose ${HOME} printf ${HOME} -eu printf $(pwd)
+	"$1" 2>/dev/null -eu 'quoted text'
+2>/dev/null export "$@" "$1" | local "$1" --verbose then grep
+cd ${HOME} "$@" printf readonly cd $(pwd) x=1 x=1
+		--verbose then --verbose test -eu "$1" export
+test /usr/bin "$@" 2>/dev/null done 'quoted text'
+	echo 2>/dev/null && printf -eu --verbose then done echo
+echo 'quoted text' ${HOME} grep sed ${HOME} 2>/dev/null
+	awk "$1" awk "$1" && local && && then test done test -eu ${HOME} grep /usr/bin
+$(pwd) && ${HOME} $(pwd) -eu |
+	--verbose printf 2>/dev/null readonly awk cd grep awk
+		'quoted text' 'quoted text' 'quoted text' 2>/dev/null readonly readonly $(pwd)
+	then printf 'quoted text'
+		grep printf printf $(pwd) 2>/dev/null
+		2>/dev/null echo then printf then readonly
+		readonly | sed local grep x=1 /usr/bin
+sed "$@" printf grep --verbose && $(pwd) printf $(pwd) sed 2>/dev/null
+x=1 done x=1 -eu sed test sed --verbose readonly
+		test 2>/dev/null printf awk awk x=1 ${HOME} --verbose && echo export local printf
+local && grep grep test done |
+test -eu --verbose --verbose --verbose export --verbose 'quoted text'
+	$(pwd) 2>/dev/null /usr/bin grep 2>/dev/null awk echo cd then
+	-eu --verbose | done awk grep
+	test sed /usr/bin done -eu "$@" echo readonly | $(pwd) | "$@" awk echo "$1" "$1"
+${HOME} 2>/dev/null "$1" done ${HOME} -eu
+done readonly --verbose | done -eu sed | printf /usr/bin test grep
+done grep cd "$@" cd grep test --verbose 'quoted text' x=1 x=1 echo "$@" 'quoted text'
+		readonly then 2>/dev/null
+test sed && ${HOME} | readonly 2>/dev/null --verbose done cd printf
+test readonly -eu 2>/dev/null "$@" cd --verbose
+		$(pwd) sed | echo 2>/dev/null ${HOME} then cd done $(pwd) | done
+	local sed echo then --verbose && echo --verbose $(pwd) 'quoted text' "$@" readonly
+&& "$@" then ${HOME} done readonly | x=1 grep export 2>/dev/null
+/usr/bin done test /usr/bin printf then --verbose test
+	$(pwd) export 'quoted text' test "$1" 2>/dev/null && awk | readonly
+| test | grep grep awk 2>/dev/null $(pwd) readonly export echo && done echo
+	-eu | local x=1 'quoted text' test printf readonly $(pwd) sed -eu && --verbose
+		printf -eu $(pwd) | "$@" 'quoted text'
+		--verbose --verbose then local cd cd readonly x=1 awk
+then local printf "$@" sed
+		/usr/bin done done "$@" sed
+	"$@" then export printf ${HOME} awk readonly /usr/bin --verbose sed cd "$@"
+/usr/bin --verbose -eu done "$@" --verbose readonly
+	--verbose "$@" readonly "$@" $(pwd) done printf "$@" --verbose
+2>/dev/null && 2>/dev/null readonly "$@" && cd awk /usr/bin
+	grep ${HOME} ${HOME} && && -eu 'quoted text' $(pwd) sed done readonly
+		&& 2>/dev/null x=1 && && grep echo "$1" 2>/dev/null test
+	echo x=1 "$@" "$@" local cd -eu
+	"$1" ${HOME} grep /usr/bin grep --verbose
+		sed export ${HOME} --verbose x=1 -eu then | printf --verbose
+	awk test cd awk --verbose && ${HOME}
+		&& then x=1 | --verbose --verbose -eu && grep | 2>/dev/null
+		--verbose printf grep then echo
+sed | "$1" test local 2>/dev/null printf 2>/dev/null -eu x=1
+	"$1" && && 2>/dev/null sed $(pwd)
+		--verbose awk export readonly
+	x=1 "$1" local "$@" ${HOME} printf 'quoted text'
+		grep grep 2>/dev/null export
+	"$@" then grep /usr/bin cd x=1 2>/dev/null ${HOME} --verbose
+| /usr/bin ${HOME} -eu -eu grep then awk -eu export 'quoted text' done --verbose
+	"$@" readonly export && grep awk "$@" done grep cd
+		$(pwd) 'quoted text' grep cd --verbose
+	test "$1" --verbose -eu && --verbose echo --verbose cd $(pwd)
+${HOME} local sed -eu ${HOME} echo readonly awk 2>/dev/null
+	"$@" printf && $(pwd) 'quoted text'
+		x=1 "$1" printf done local -eu done | $(pwd)
+	| 'quoted text' -eu $(pwd) local sed sed $(pwd) test
+	'quoted text' readonly --verbose "$@" readonly ${HOME} grep -eu && done "$@" sed
+		$(pwd) readonly 2>/dev/null | 'quoted text'
+-eu "$1" grep ${HOME} /usr/bin -eu $(pwd)
+export readonly -eu local | && done grep sed test
+	2>/dev/null cd --verbose 'quoted text' && sed grep && local
+awk done $(pwd) | "$@" $(pwd) | 'quoted text' 'quoted text' | ${HOME} $(pwd)
+	${HOME} 2>/dev/null awk awk cd echo grep
+		"$1" 'quoted text' 'quoted text' "$@" && done sed done
+/usr/bin readonly ${HOME} "$@" test -eu
+	--verbose test --verbose local cd grep | cd local && local export readonly
+	/usr/bin echo awk | echo &&
+		&& 2>/dev/null echo grep
+	| --verbose readonly then grep "$@" readonly cd readonly && readonly $(pwd)
+	"$1" sed x=1 then grep 'quoted text' 2>/dev/null export done sed
+	/usr/bin ${HOME} readonly $(pwd) x=1 /usr/bin 'quoted text' cd "$1"
+		-eu && && then --verbose 'quoted text' local grep --verbose
+"$1" then printf local "$1" test echo
+	&& printf $(pwd) && ${HOME} local | local awk $(pwd)
+		$(pwd) 2>/dev/null printf done then printf x=1 cd 'quoted text'
+	sed x=1 export then awk awk --verbose
+	2>/dev/null --verbose sed grep "$@" ${HOME} readonly printf | ${HOME} ${HOME}
+	awk -eu awk awk printf | 2>/dev/null /usr/bin echo readonly x=1 && export
+		cd test test local grep /usr/bin x=1 done /usr/bin
+	| export then awk test
+		"$@" then --verbose awk sed -eu
+		-eu ${HOME} x=1 done awk | export export
+	-eu done then /usr/bin awk | ${HOME} export | printf
+		x=1 /usr/bin cd ${HOME} /usr/bin printf sed grep cd "$@" test then /usr/bin
+		--verbose sed sed $(pwd) test -eu && ${HOME} printf
+		2>/dev/null local $(pwd) /usr/bin cd awk export export test export "$1"
+		"$1" grep awk readonly echo then
+	local | grep grep local 2>/dev/null done echo readonly
+	then sed cd done grep export test printf awk export sed && && $(pwd)
+	/usr/bin local readonly -eu sed /usr/bin --verbose grep
+x=1 printf x=1 readonly /usr/bin -eu readonly 'quoted text' --verbose "$1"
+"$1" 'quoted text' 2>/dev/null 2>/dev/null awk && export $(pwd) grep printf x=1
+echo sed local 'quoted text' "$@" --verbose test | cd
+		x=1 done | awk $(pwd) && "$1"
+		sed local x=1 | $(pwd) sed grep ${HOME} x=1 'quoted text' --verbose printf
+x=1 --verbose test x=1
+grep && $(pwd) x=1 $(pwd)
+grep $(pwd) | x=1 "$@" test "$1" && && "$@" done grep test ${HOME}
+-eu "$@" 2>/dev/null grep
+${HOME} printf cd export printf local 2>/dev/null | printf
+	done test printf "$@" cd grep echo 'quoted text' $(pwd)
+	sed -eu cd --verbose --verbose /usr/bin "$1" /usr/bin "$1" x=1 "$@" -eu awk then
+	printf x=1 ${HOME} $(pwd) readonly export -eu && "$1" export "$1" printf ${HOME}
+	local printf local -eu readonly done cd $(pwd) export
+	done 2>/dev/null readonly export
+	export export | awk done printf 'quoted text' ${HOME}
+	awk ${HOME} 2>/dev/null | 'quoted text' x=1 done printf 2>/dev/null printf
+		${HOME} echo 'quoted text'
+	local --verbose -eu export test --verbose $(pwd) 2>/dev/null export ${HOME} echo
+		-eu local --verbose /usr/bin export "$1" 2>/dev/null done done /usr/bin
+"$@" /usr/bin local grep export sed /usr/bin printf
+printf && "$1" readonly then x=1
+$(pwd) printf test local $(pwd) /usr/bin done /usr/bin ${HOME} local test
+		local "$@" grep cd --verbose x=1 sed readonly
+printf --verbose $(pwd) sed | test grep echo echo done 2>/dev/null export
+	sed echo sed readonly 'quoted text' then
+-eu --verbose "$@" | -eu printf | "$1" | sed $(pwd) grep export
+	readonly done awk readonly --verbose
+		${HOME} echo x=1 2>/dev/null grep -eu -eu sed
+"$@" local $(pwd) printf /usr/bin x=1 local /usr/bin printf
+		$(pwd) printf "$1" | /usr/bin cd $(pwd) --verbose x=1
+--verbose done grep -eu echo printf && sed grep 'quoted text'
+		| grep sed x=1 local 'quoted text' | grep
+	&& 'quoted text' "$1" grep && | ${HOME} && export awk echo 2>/dev/null x=1 done
+&& x=1 && cd "$@" -eu printf echo ${HOME} export
+	$(pwd) export 2>/dev/null readonly done
+		awk test | "$1" ${HOME} readonly 'quoted text' grep done
+grep test x=1 grep "$@" sed ${HOME} awk "$1" x=1 $(pwd)
+	printf x=1 $(pwd) $(pwd) 'quoted text'
+	${HOME} then export awk export local local
+	/usr/bin readonly done printf x=1 --verbose readonly /usr/bin "$@" --verbose
+local local /usr/bin 2>/dev/null -eu "$@" "$@" "$1"
+	cd awk readonly x=1 cd $(pwd) grep readonly | awk cd
+'quoted text' echo && | && local | $(pwd) sed
+	| --verbose x=1 awk export grep then
+export local "$1" readonly
+		/usr/bin test echo echo then awk local
+		"$1" 2>/dev/null /usr/bin 'quoted text' export | x=1 readonly grep --verbose
+	awk && /usr/bin sed | echo && printf printf /usr/bin echo 'quoted text' x=1 "$1"
+		printf -eu export readonly -eu --verbose 2>/dev/null -eu /usr/bin "$@" $(pwd) |
+	x=1 2>/dev/null && --verbose 'quoted text' -eu /usr/bin done -eu printf
+		export test sed grep local ${HOME}
+local "$@" 'quoted text' cd grep ${HOME} done local "$@" local 'quoted text'
+| | cd /usr/bin 2>/dev/null 2>/dev/null $(pwd) cd awk
+	export export sed test "$1" done test local awk awk 'quoted text'
+		printf awk "$1" test cd local then then ${HOME}
+		--verbose printf "$1" cd 'quoted text' 2>/dev/null printf "$1" | "$@" then
+		/usr/bin export "$@" ${HOME} x=1 "$@" export 'quoted text' | echo cd 2>/dev/null
+	awk then --verbose printf 2>/dev/null awk /usr/bin
+--verbose 2>/dev/null -eu test | 2>/dev/null /usr/bin
+	-eu then cd then x=1 | "$@" echo cd cd "$@" "$@" export export 'quoted text'
+		cd "$1" then then echo local done done grep && cd echo "$1" cd
+		cd done local 2>/dev/null awk /usr/bin export grep
+	awk sed echo readonly local then printf "$1" "$@"
+		printf printf cd awk sed cd /usr/bin ${HOME} "$@" sed readonly echo ${HOME}
+	x=1 x=1 export local ${HOME} --verbose
+	done sed x=1 grep $(pwd) test export ${HOME} && ${HOME} echo readonly grep
+	local $(pwd) 'quoted text' | done 'quoted text' "$@" 'quoted text' "$1" awk
+		test sed /usr/bin $(pwd) local | &&
+	'quoted text' ${HOME} sed $(pwd) ${HOME} x=1 'quoted text' readonly grep printf
+cd ${HOME} local local cd
+		/usr/bin cd --verbose sed "$1" /usr/bin
+--verbose sed done readonly && --verbose grep sed cd grep ${HOME}
+test printf -eu x=1 -eu cd readonly export grep cd sed |
+		/usr/bin printf then local test readonly ${HOME} --verbose grep ${HOME}
+		awk "$1" -eu ${HOME} -eu printf echo 2>/dev/null $(pwd) | && printf
+		--verbose printf --verbose sed readonly sed sed test
+		grep echo done "$@" cd echo x=1
+| test --verbose "$@" | then && --verbose
+test x=1 -eu /usr/bin local && grep cd $(pwd) printf ${HOME}
+$(pwd) test -eu local $(pwd) grep && -eu -eu test
+		x=1 readonly echo $(pwd) "$@" done && $(pwd) printf && then echo --verbose
+--verbose "$1" sed grep then 2>/dev/null local && ${HOME} 2>/dev/null ${HOME}
+/usr/bin && "$@" ${HOME} cd export -eu | readonly export grep local
+	'quoted text' then "$@" cd x=1
+done sed printf sed "$1" ${HOME} "$1" printf
+		sed done 2>/dev/null -eu 'quoted text' | "$@"
+	then grep "$1" /usr/bin -eu -eu "$@" readonly
+/usr/bin "$@" ${HOME} export then -eu readonly -eu -eu local | -eu echo
+	&& "$@" $(pwd) export sed sed $(pwd) x=1 sed
+then export grep --verbose "$1" "$@"
+	"$@" "$1" $(pwd) echo -eu /usr/bin printf then "$@" --verbose
+export printf echo cd printf && x=1 x=1 echo $(pwd) x=1 echo
+done test -eu test x=1 -eu then local readonly
+	grep 'quoted text' done local -eu 'quoted text' export x=1
+/usr/bin --verbose grep
+	-eu && "$@" "$1" sed &&
+	cd echo -eu --verbose test printf /usr/bin then "$@" done 'quoted text'
+/usr/bin grep --verbose awk "$@"
+--verbose "$@" echo $(pwd)
+		&& ${HOME} x=1 2>/dev/null | sed echo "$@" "$@" ${HOME} local cd x=1
+sed | test | 'quoted text'
+	-eu cd cd test grep sed echo ${HOME}
+		/usr/bin grep cd test grep
+		grep readonly export local "$1" readonly $(pwd) then
+		"$1" sed echo ${HOME} cd x=1 "$@" "$1" cd then -eu test -eu "$@" grep done
+	done then echo grep --verbose then && x=1 sed printf awk | "$1"
+-eu $(pwd) /usr/bin echo echo echo cd sed local
+-eu readonly then printf cd && cd $(pwd) /usr/bin -eu $(pwd) test $(pwd) && $(pwd)
+		export ${HOME} printf "$@" cd $(pwd) local |
+	${HOME} $(pwd) $(pwd) /usr/bin export awk "$1" 'quoted text' 2>/dev/null
+test done then echo /usr/bin test 'quoted text' cd sed test "$1" readonly local
+	$(pwd) x=1 echo cd grep 'quoted text' --verbose then test
+		cd cd -eu "$@" sed local printf grep ${HOME} ${HOME} local awk sed
+	-eu export then cd then done 'quoted text' printf sed "$@" /usr/bin &&
+	/usr/bin -eu test "$1" "$@" awk printf
+sed grep 2>/dev/null cd then $(pwd) 'quoted text' done printf cd done echo
+		"$1" cd readonly echo cd test 'quoted text'
+	${HOME} x=1 local "$1" | echo export
+test ${HOME} "$1" $(pwd) | 2>/dev/null awk /usr/bin
+&& then && /usr/bin cd done
+		${HOME} then | "$@" awk "$@" /usr/bin done echo x=1 --verbose awk $(pwd) && cd 2>/dev/null
+then done /usr/bin cd "$1" --verbose local -eu -eu /usr/bin 2>/dev/null
+		${HOME} then "$1" printf ${HOME} grep /usr/bin printf --verbose then cd printf
+$(pwd) | 2>/dev/null 2>/dev/null test export printf export export ${HOME} awk
+		local | ${HOME} awk -eu ${HOME} then 'quoted text' && sed
+	grep sed 'quoted text' done sed "$@" test
+	$(pwd) 2>/dev/null 'quoted text' done
+local 2>/dev/null test ${HOME} readonly done cd test "$1" cd && | ${HOME} &&
+done && 'quoted text' $(pwd) ${HOME} sed && ${HOME}
+	/usr/bin sed 'quoted text'
+		readonly export $(pwd) | readonly
+		test 2>/dev/null "$1"
+	$(pwd) "$@" grep export then sed local $(pwd) x=1 | echo done --verbose
+	"$@" -eu | then ${HOME} ${HOME} done
+readonly ${HOME} export /usr/bin echo cd echo "$1" then ${HOME} /usr/bin test /usr/bin
+export 2>/dev/null test printf cd "$@" export ${HOME}
+	then cd "$@" $(pwd) sed printf cd test printf "$1" then printf "$@" /usr/bin
+	-eu && test ${HOME} /usr/bin sed
+local readonly --verbose local 'quoted text' 'quoted text' readonly
+--verbose && test "$1" cd echo
+	"$1" sed && --verbose export -eu
+		printf cd --verbose test echo "$1" 2>/dev/null export |
+done /usr/bin grep awk export $(pwd) 'quoted text' $(pwd) local /usr/bin
+sed awk -eu x=1 && -eu sed cd printf echo cd printf "$@" done x=1 test printf
+		then "$1" --verbose | export readonly 'quoted text' && --verbose "$1" --verbose
+	${HOME} -eu ${HOME} ${HOME} then
+		test grep /usr/bin sed && /usr/bin --verbose
+readonly cd "$1" local x=1 awk && done 2>/dev/null grep
+		echo echo ${HOME} --verbose 'quoted text'
+export "$1" readonly -eu echo | grep x=1 /usr/bin
+		&& 2>/dev/null grep readonly $(pwd) ${HOME} /usr/bin done awk x=1 export sed readonly
+| local awk local printf sed test grep test --verbose test ${HOME} readonly $(pwd)
+export grep && grep echo export "$@" 2>/dev/null sed
+		$(pwd) then sed readonly grep --verbose
+		$(pwd) && | "$@" local awk grep cd done awk test $(pwd) ${HOME} local
+cd /usr/bin echo test && ${HOME} cd 'quoted text' |
+	${HOME} -eu $(pwd) sed then 'quoted text' "$1"
+	echo "$@" 2>/dev/null then done done local
+		sed ${HOME} "$1" done printf readonly
+export x=1 sed 2>/dev/null local cd local /usr/bin "$@" export readonly sed "$1"
+	test echo echo done -eu ${HOME} then $(pwd) 'quoted text' then
+sed grep sed cd echo 2>/dev/null local x=1 echo readonly | cd ${HOME} awk
+	export local export sed
+		cd printf grep grep x=1 sed $(pwd)
+then export $(pwd) x=1 readonly export | /usr/bin | "$1" ${HOME}
+		grep && -eu export x=1 awk printf 'quoted text' "$1" 'quoted text' 'quoted text'
+		awk local readonly cd test
+	${HOME} export grep /usr/bin echo "$1" then
+		"$1" echo -eu 'quoted text' "$1" $(pwd) then test x=1 cd echo "$@" 2>/dev/null
+	grep -eu 'quoted text' $(pwd) 2>/dev/null $(pwd) --verbose
+	sed then grep cd $(pwd)
+--verbose -eu $(pwd) 'quoted text' grep x=1 export test --verbose
+		-eu ${HOME} done x=1 | printf ${HOME} "$@" $(pwd) /usr/bin printf export
+	--verbose | "$1" echo $(pwd) "$@" 2>/dev/null sed /usr/bin
+		sed 'quoted text' x=1 'quoted text' grep awk
+	2>/dev/null sed local "$1"
+then "$1" /usr/bin cd $(pwd) --verbose awk $(pwd) test | --verbose | awk "$1"
+		$(pwd) printf sed | x=1 readonly
+	--verbose | cd 2>/dev/null test 2>/dev/null
+	--verbose /usr/bin x=1 --verbose done "$1" 'quoted text'
+x=1 | 2>/dev/null 'quoted text' -eu --verbose --verbose then --verbose
+printf export -eu cd /usr/bin --verbose
+--verbose ${HOME} done -eu && readonly 2>/dev/null
+cd readonly export export "$1" | x=1 x=1 -eu awk
+	cd -eu sed ${HOME} readonly | ${HOME} ${HOME} awk && && --verbose cd then export
+		'quoted text' done 2>/dev/null -eu readonly test | -eu --verbose "$1" export awk
+/usr/bin /usr/bin export 2>/dev/null awk sed readonly export ${HOME}
+	$(pwd) grep -eu && 'quoted text' --verbose
+&& -eu "$1" echo "$1" ${HOME} ${HOME} readonly ${HOME} done 2>/dev/null
+--verbose then then printf then && then "$@" test export printf
+grep local | test local test --verbose printf --verbose cd $(pwd) done printf echo
+		/usr/bin then printf printf 'quoted text' && "$1"
+		echo test && --verbose printf
+x=1 2>/dev/null export ${HOME} && "$1" test 2>/dev/null test then local
+&& local readonly cd 'quoted text'
+		export 2>/dev/null awk 'quoted text' grep x=1
+	awk then "$@" "$@" && | export local export /usr/bin then 'quoted text'
+		${HOME} "$@" $(pwd) && ${HOME} grep /usr/bin
+then test cd test $(pwd) x=1 /usr/bin x=1 grep -eu --verbose local
+/usr/bin test echo printf grep --verbose readonly 'quoted text' /usr/bin then
+"$@" -eu echo done then /usr/bin && ${HOME} then | awk
+'quoted text' && /usr/bin
+		export x=1 ${HOME} x=1 then local "$@" | then /usr/bin
+-eu sed | test | $(pwd) -eu "$@" export ${HOME}
+	"$@" done export grep 'quoted text' done local
+&& grep test /usr/bin sed "$@" x=1 /usr/bin
+	grep sed printf x=1 local /usr/bin -eu /usr/bin echo printf
+	test done test --verbose | echo && 'quoted text' then
+	${HOME} cd cd readonly export
+		readonly x=1 local local awk
+		cd && readonly echo cd /usr/bin /usr/bin grep done "$@" printf -eu local grep
+sed --verbose echo ${HOME} $(pwd) local readonly 2>/dev/null "$1" sed
+x=1 $(pwd) "$@" /usr/bin printf ${HOME} x=1 2>/dev/null ${HOME}
+cd x=1 cd /usr/bin awk readonly |
+	local /usr/bin && 2>/dev/null test && sed /usr/bin x=1
+	grep readonly $(pwd) 'quoted text' 'quoted text' grep printf awk -eu
+	local awk sed grep --verbose echo awk 'quoted text' 'quoted text' local
+cd "$@" then --verbose 'quoted text' 'quoted text' readonly x=1
+		printf then then && echo export ${HOME} test local local x=1 done ${HOME}
+x=1 echo export 2>/dev/null export awk ${HOME} echo test test /usr/bin
+		$(pwd) echo | /usr/bin readonly export -eu "$1" cd export
+&& cd x=1 2>/dev/null | ${HOME} ${HOME} | grep x=1 "$@" awk local sed
+	echo echo test done && printf done && echo "$@" then echo $(pwd)
+	sed readonly export "$@" "$@" 'quoted text'
+"$1" 2>/dev/null x=1 echo 'quoted text' --verbose
+x=1 echo cd ${HOME} && awk -eu local
+	then done x=1 | done && export "$@" awk cd
+'quoted text' local sed then echo sed done | && /usr/bin
+	"$@" && -eu then "$@" awk awk && 2>/dev/null
+| export && -eu ${HOME} x=1 /usr/bin awk $(pwd) then
+$(pwd) sed $(pwd) x=1 && 2>/dev/null awk awk $(pwd)
+test export "$@" --verbose awk /usr/bin
+	export done && 2>/dev/null cd $(pwd) "$@" readonly -eu
+	then x=1 ${HOME} readonly 2>/dev/null awk
+| x=1 -eu cd --verbose sed echo && $(pwd) then --verbose then
+	local "$@" /usr/bin 2>/dev/null x=1 --verbose /usr/bin | printf grep printf
+"$1" then "$1" "$1" 2>/dev/null printf 2>/dev/null echo ${HOME}
+	printf local done "$@" "$1" /usr/bin
+		--verbose done printf readonly
+	echo "$1" -eu x=1 export 'quoted text' done
+	test "$1" $(pwd) echo echo "$@"
+grep ${HOME} && test x=1 grep echo cd /usr/bin
+	| then $(pwd) --verbose -eu readonly "$1" awk printf | sed echo then 'quoted text'
+		readonly done 2>/dev/null echo x=1 done printf printf readonly echo && export
+-eu then awk done $(pwd) grep | --verbose local readonly
+		-eu ${HOME} test x=1 'quoted text'
+-eu | readonly ${HOME} $(pwd) 2>/dev/null
+	-eu awk -eu printf x=1 printf && /usr/bin
+		then ${HOME} local then printf "$1" "$@"
+sed | echo readonly 2>/dev/null
+		x=1 sed echo awk && then /usr/bin && then -eu "$1" 2>/dev/null echo awk
+/usr/bin echo export readonly printf $(pwd) echo ${HOME} x=1 grep
+	done grep --verbose cd echo export sed local
+	--verbose && /usr/bin done test readonly && --verbose ${HOME}
+	awk | sed awk sed -eu export echo
+readonly done 'quoted text' test $(pwd) "$@"
+echo test echo then x=1 x=1
+	"$@" "$@" "$1" 'quoted text'
+		test sed sed awk then export grep
+	"$1" 2>/dev/null test $(pwd) grep 2>/dev/null -eu test done awk 'quoted text' sed
+--verbose readonly -eu /usr/bin 2>/dev/null done echo printf
+--verbose test readonly test test --verbose readonly grep
+		$(pwd) sed printf x=1 --verbose then awk /usr/bin then readonly
+$(pwd) "$1" grep 2>/dev/null --verbose
+		x=1 2>/dev/null x=1 readonly grep && 'quoted text'
+test /usr/bin x=1 echo sed printf 'quoted text' "$@" export grep -eu "$@"
+done echo -eu readonly /usr/bin | readonly && grep grep | test echo
+	/usr/bin --verbose -eu 2>/dev/null readonly then "$@"
+		awk then ${HOME} cd 'quoted text' ${HOME}
+	cd done "$@" "$1" then readonly "$1" /usr/bin local 'quoted text' test 'quoted text'
+		| x=1 -eu /usr/bin then
+		export then --verbose "$@" --verbose sed echo 2>/dev/null
+readonly && $(pwd) cd export printf "$1" /usr/bin
+--verbose export 'quoted text' "$@" 2>/dev/null | then done ${HOME}
+/usr/bin local printf readonly grep printf grep
+		| /usr/bin test x=1 2>/dev/null && $(pwd) && echo | cd /usr/bin $(pwd)
+	$(pwd) /usr/bin export ${HOME} readonly grep --verbose &&
+$(pwd) --verbose "$1" printf 'quoted text' readonly cd local
+		--verbose /usr/bin | readonly $(pwd) x=1 /usr/bin $(pwd) "$@" done
+echo printf local /usr/bin readonly ${HOME} then printf
+echo x=1 -eu /usr/bin sed ${HOME}
+		local --verbose test --verbose
+	sed 2>/dev/null grep | then echo /usr/bin && /usr/bin -eu grep printf test sed
+		--verbose && && && readonly
+$(pwd) local then export | x=1 echo printf
+	export $(pwd) 'quoted text' readonly "$1" 'quoted text'
+	test --verbose | 'quoted text' done grep local "$@" | then -eu -eu
+'quoted text' 'quoted text' echo --verbose
+		--verbose --verbose grep 'quoted text' export /usr/bin readonly
+then cd -eu x=1 $(pwd) then grep /usr/bin
+	"$@" then ${HOME} /usr/bin
+&& 2>/dev/null local echo local "$@"
+	echo -eu local echo printf -eu awk sed | /usr/bin /usr/bin
+	/usr/bin && done 'quoted text' test $(pwd) local cd
+		awk local printf awk /usr/bin && export x=1 awk readonly --verbose export awk
+		sed readonly then 'quoted text'
+	2>/dev/null readonly --verbose /usr/bin readonly test readonly printf then
+	readonly x=1 awk test echo --verbose
+"$@" /usr/bin 2>/dev/null 2>/dev/null $(pwd) readonly done
+		then printf "$1" -eu export local echo -eu $(pwd)
+-eu awk $(pwd) local printf export sed --verbose sed "$@" awk && 2>/dev/null
+| grep x=1 echo printf grep sed 'quoted text'
+cd && grep done grep done $(pwd)
+		grep local 2>/dev/null local "$1" -eu x=1 2>/dev/null 'quoted text'
+	cd then 2>/dev/null cd cd 2>/dev/null cd cd "$@"
+		${HOME} "$1" -eu readonly x=1 && ${HOME} test sed "$1" readonly
+/usr/bin $(pwd) local "$@" && x=1
+then local done x=1 /usr/bin $(pwd) echo export then readonly
+		then /usr/bin --verbose ${HOME} ${HOME} x=1 /usr/bin export echo then cd "$@"
+		'quoted text' sed $(pwd) && done done local echo && then then
+export then test cd 2>/dev/null sed "$1"
+	${HOME} --verbose $(pwd) printf cd sed cd x=1
+		'quoted text' 2>/dev/null readonly grep /usr/bin then test printf "$@" -eu
+		awk && printf cd ${HOME} grep /usr/bin --verbose cd then readonly "$@" -eu
+readonly cd local 'quoted text' local -eu done "$1" printf "$1" grep
+	| ${HOME} readonly local then echo export | printf
+	-eu printf sed cd done
+	"$@" 2>/dev/null grep /usr/bin then x=1 'quoted text'
+	"$1" && sed test echo 'quoted text' 'quoted text'
+	x=1 x=1 && x=1 --verbose
+$(pwd) printf "$@" x=1 printf 'quoted text' then 2>/dev/null
+		--verbose "$@" printf test
+		x=1 sed "$1" test echo x=1 x=1
+		sed 2>/dev/null local -eu "$1" local
+		test -eu x=1 cd | export x=1 local
+${HOME} then awk ${HOME} 2>/dev/null
+	local test $(pwd) done
+export printf local | x=1 "$@" && grep 'quoted text' $(pwd) && done test grep done
+then --verbose x=1 grep --verbose $(pwd)
+	sed echo x=1 readonly -eu
+		${HOME} "$1" export local "$@" export then
+		then && 'quoted text' local "$1" "$1" x=1 | then --verbose 'quoted text'
+grep | 'quoted text' cd x=1 /usr/bin cd -eu awk 2>/dev/null "$1" -eu /usr/bin
+	'quoted text' "$1" then export "$@" awk 'quoted text' 2>/dev/null |
+cd done "$@" echo | 'quoted text' then awk sed done done --verbose --verbose local
+	&& echo cd ${HOME} "$1" cd local
+cd grep export done -eu grep
+	/usr/bin grep | echo && /usr/bin
+readonly /usr/bin sed && "$1" 2>/dev/null sed /usr/bin
+readonly done printf "$@" ${HOME} | echo -eu test test
+		/usr/bin "$1" "$1" test echo "$@" "$1" "$@" "$1" test 2>/dev/null
+awk x=1 grep local then sed "$@" --verbose -eu 2>/dev/null cd "$@" && /usr/bin
+		awk "$1" --verbose printf cd printf -eu echo echo
+"$1" /usr/bin echo && && x=1 2>/dev/null export
+x=1 2>/dev/null /usr/bin cd local $(pwd)
+	echo awk 'quoted text' awk /usr/bin
+	echo done "$1" printf | 'quoted text'
+		sed $(pwd) ${HOME} 'quoted text' cd awk done && local ${HOME} /usr/bin export
+		then export 2>/dev/null 2>/dev/null --verbose
+		$(pwd) $(pwd) done export cd awk && grep grep
+		done test $(pwd) grep local echo -eu awk local
+		2>/dev/null test test awk awk then cd
+	"$1" grep 'quoted text' x=1
+		| "$1" local then test "$@" printf test sed && export grep
+	"$@" sed | "$1" cd 2>/dev/null x=1 export export cd cd test test
+		-eu then grep test /usr/bin
+	2>/dev/null && x=1 ${HOME} test
+echo sed --verbose 'quoted text'
+then "$1" then cd then cd sed sed "$1" printf 'quoted text'
+cd 'quoted text' grep grep "$1" then sed && --verbose "$1" cd export readonly
+	2>/dev/null local export readonly test local 'quoted text' "$@" "$1"
+| local cd --verbose readonly x=1 export
+		"$1" test 2>/dev/null "$@" $(pwd) sed && -eu --verbose
+	'quoted text' /usr/bin awk && | && ${HOME}
+	then grep awk /usr/bin 'quoted text' --verbose readonly awk then
+	readonly awk done /usr/bin | "$@" echo --verbose awk printf $(pwd) test 2>/dev/null
+	x=1 "$@" | "$@" test cd done printf cd 'quoted text' grep awk /usr/bin
+then test | && && "$@" test x=1 readonly 'quoted text'
+	sed "$@" printf --verbose | 2>/dev/null 'quoted text' --verbose /usr/bin echo
+	echo "$@" ${HOME} $(pwd)
+	grep "$@" /usr/bin "$1" 'quoted text' "$1" 'quoted text' echo readonly
+		2>/dev/null ${HOME} "$1" && awk test done test --verbose
+sed awk sed export | /usr/bin printf cd 'quoted text' sed | 'quoted text'
+	--verbose local "$@" awk "$1" cd done echo -eu echo
+	-eu "$@" -eu export sed export --verbose awk
+		grep /usr/bin "$@" /usr/bin x=1 'quoted text' cd x=1 test x=1 printf printf cd
+	'quoted text' readonly cd cd cd --verbose readonly then local
+	readonly grep awk export | sed --verbose done ${HOME}
+		2>/dev/null x=1 done
+sed sed ${HOME} echo ${HOME} local -eu /usr/bin echo done
+-eu "$@" "$@" "$@" ${HOME}
+	then /usr/bin printf test $(pwd) --verbose grep test
+		$(pwd) awk awk test -eu awk && test echo done cd x=1 2>/dev/null 2>/dev/null 2>/dev/null
+	cd awk then grep done then local "$1"
+	/usr/bin /usr/bin printf readonly echo sed printf echo cd 'quoted text'
+"$@" $(pwd) | grep cd -eu done then done $(pwd)
+2>/dev/null | /usr/bin awk
+	local sed -eu then -eu 2>/dev/null /usr/bin
+		local | cd --verbose test sed local test done --verbose export test cd
+		cd 'quoted text' --verbose | test
+$(pwd) then cd local "$1" --verbose
+$(pwd) awk readonly then
+		"$@" grep grep echo cd 'quoted text' && ${HOME} "$@" awk then done 2>/dev/null
+	"$@" | printf done | done echo sed --verbose then 'quoted text'
+		sed $(pwd) test x=1 local echo local
+test export readonly "$@" | 2>/dev/null
+-eu && 2>/dev/null export cd | local cd grep then x=1 echo && ${HOME} echo
+		readonly export ${HOME} printf echo 'quoted text'
+${HOME} sed "$1" ${HOME} then /usr/bin cd echo export 'quoted text'
+readonly test sed printf ${HOME} x=1 "$@" | done &&
+		cd ${HOME} printf test ${HOME} ${HOME} ${HOME} grep 'quoted text'
+"$@" 2>/dev/null x=1 local export "$1" /usr/bin awk sed /usr/bin "$1" && 2>/dev/null
+"$@" | done "$@" printf "$1" 2>/dev/null then "$@"
+	"$1" awk "$@" $(pwd) x=1 grep readonly
+		$(pwd) $(pwd) | printf /usr/bin | 'quoted text'
+		echo grep export "$1" $(pwd)
+	x=1 grep 2>/dev/null ${HOME} readonly
+local && --verbose x=1 awk readonly --verbose $(pwd) && -eu printf sed printf
+		${HOME} local sed 'quoted text' grep "$1" $(pwd)
+		local done -eu $(pwd) $(pwd) 'quoted text' echo test "$@" export
+	then readonly x=1 "$@" $(pwd) local printf 'quoted text' | then local export
+cd --verbose printf cd 2>/dev/null grep $(pwd)
+		echo -eu /usr/bin "$1" /usr/bin "$@"
+		done ${HOME} cd awk done
+then readonly | grep ${HOME} readonly then --verbose -eu -eu --verbose local
+		'quoted text' cd 2>/dev/null then
+local export $(pwd) sed "$@" 2>/dev/null /usr/bin "$1" then
+done 2>/dev/null --verbose /usr/bin
+| 'quoted text' "$1" readonly "$1"
+	grep ${HOME} 2>/dev/null echo | $(pwd) && grep /usr/bin -eu "$1" then --verbose
+	done readonly echo /usr/bin "$@" $(pwd) grep
+done printf export then && ${HOME} sed ${HOME} done "$1" $(pwd) $(pwd)
+		printf 2>/dev/null awk sed | echo
+		sed printf "$1" local echo $(pwd) 'quoted text'
+sed done x=1 test "$1" "$1" cd x=1 $(pwd) grep /usr/bin ${HOME}
+| && echo cd grep $(pwd) "$@" 'quoted text'
+then echo printf ${HOME} --verbose -eu awk done readonly awk test | x=1 readonly
+	"$@" "$1" then "$1" | cd export 2>/dev/null
+		local test done test cd ${HOME}
+	"$1" grep && cd 'quoted text' export "$@" $(pwd) /usr/bin /usr/bin 2>/dev/null
+	"$@" $(pwd) x=1 test readonly | 'quoted text' $(pwd) grep readonly
+	local ${HOME} test export done x=1 --verbose --verbose
+2>/dev/null cd test | test -eu "$1" done export && /usr/bin x=1 cd awk "$@" readonly
+	readonly local x=1 then --verbose grep $(pwd) then echo readonly --verbose
+	"$1" x=1 awk cd done test printf printf ${HOME} test done "$@" "$1"
+	${HOME} "$@" -eu test echo && | && | then echo "$@" x=1 printf local $(pwd)
+	$(pwd) /usr/bin echo printf && grep done local
+'quoted text' grep readonly test then 'quoted text' /usr/bin -eu -eu done
+2>/dev/null then local -eu grep --verbose cd -eu grep
+echo echo /usr/bin "$@" "$1" && awk $(pwd)
+		awk && ${HOME} cd "$1" export "$@" 'quoted text' 2>/dev/null
+		export sed /usr/bin $(pwd) -eu
+	/usr/bin "$@" sed done echo then export sed export echo local "$@"
+cd && --verbose test done x=1 2>/dev/null "$1" "$@" printf echo
+	then ${HOME} then grep done done ${HOME}
+/usr/bin then -eu printf
+		awk readonly done local 2>/dev/null
+	&& echo ${HOME} x=1 grep echo done readonly
+&& echo x=1 /usr/bin && /usr/bin "$@" export 'quoted text' "$@" "$@" "$@"
+		/usr/bin 'quoted text' printf | "$@"
+	/usr/bin local "$@" grep ${HOME} $(pwd) export printf
+	printf readonly printf then test local echo local 2>/dev/null readonly | then
+		awk echo awk x=1 readonly echo "$1" x=1 ${HOME} "$@" && $(pwd) export
+	$(pwd) awk local done done then -eu local "$1" then
+-eu cd export grep "$1" |
+2>/dev/null printf test printf && /usr/bin | -eu && x=1 sed readonly | grep local
+		cd 'quoted text' | done $(pwd)
+		readonly export echo printf x=1 && cd local readonly "$1" /usr/bin local
+readonly "$@" grep $(pwd) $(pwd) awk awk
+printf ${HOME} /usr/bin --verbose
+	readonly cd -eu printf grep --verbose 'quoted text'
+		awk 2>/dev/null echo export
+	2>/dev/null echo readonly "$@" x=1 'quoted text' then
+	x=1 export && "$1" && test "$@" | grep $(pwd) then echo $(pwd)
+		'quoted text' -eu sed local
+		readonly awk readonly printf --verbose "$@" ${HOME} done local
+	2>/dev/null then && "$@" readonly
+readonly cd 'quoted text' printf "$1" 'quoted text'
+		-eu | test sed $(pwd) | ${HOME} && x=1 export then sed echo --verbose
+2>/dev/null done sed | 'quoted text' 'quoted text' "$@" printf $(pwd)
+&& export test ${HOME} done awk 'quoted text' -eu
+--verbose echo awk readonly $(pwd) x=1 awk done 'quoted text'
+	$(pwd) test && | 'quoted text' then
+		&& ${HOME} done /usr/bin --verbose done then x=1 export cd sed
+awk test readonly printf | cd readonly grep ${HOME}
+		grep local 2>/dev/null $(pwd)
+--verbose x=1 -eu -eu /usr/bin "$@" --verbose export
+		"$1" then cd ${HOME} /usr/bin done
+	| done then -eu local --verbose export
+	"$@" then then cd echo x=1 | export test $(pwd)
+	grep test echo && awk | && "$@"
+"$1" echo local echo printf cd sed
+	$(pwd) cd readonly /usr/bin ${HOME} then export export
+printf local echo -eu test
+echo readonly /usr/bin | | local /usr/bin then cd x=1 done export "$1" cd ${HOME}
+&& $(pwd) -eu test then readonly &&
+		export printf export "$1" ${HOME} test cd "$@" local "$@"
+		readonly export "$@" | /usr/bin -eu export 'quoted text'
+	/usr/bin export local cd && export cd | /usr/bin
+	test "$@" 'quoted text'
+readonly 2>/dev/null --verbose --verbose then 'quoted text'
+		x=1 2>/dev/null readonly x=1 $(pwd) export sed readonly
+		${HOME} x=1 2>/dev/null 'quoted text' "$@" 2>/dev/null
+		test readonly 2>/dev/null then ${HOME} | --verbose echo echo 2>/dev/null
+	echo sed printf $(pwd) test | cd awk echo --verbose
+	printf | grep 2>/dev/null "$1" readonly
+		test $(pwd) x=1 export test readonly
+2>/dev/null sed 'quoted text' "$@" -eu echo ${HOME} test cd local then
+	printf cd awk | "$1" /usr/bin local ${HOME} echo
+	'quoted text' $(pwd) "$@" "$1" "$@" sed grep 'quoted text'
+		"$1" && ${HOME} --verbose | readonly 2>/dev/null then
+		test -eu 2>/dev/null cd 'quoted text' "$@" printf x=1 | "$@" readonly "$1" sed
+-eu x=1 "$@" | readonly readonly done test done awk export "$@" awk
+	awk export x=1 done "$@" printf done 'quoted text'
+		${HOME} export --verbose then readonly ${HOME} /usr/bin cd cd x=1 $(pwd) 2>/dev/null
+		&& test echo grep echo "$@" "$1" 'quoted text' then
+	sed $(pwd) grep "$1" echo /usr/bin grep sed "$1" ${HOME}
+	readonly /usr/bin local && ${HOME} | echo readonly printf 2>/dev/null sed echo 2>/dev/null
+		grep | printf then | x=1 /usr/bin /usr/bin then | grep export --verbose
+		local cd export $(pwd) | "$@"
+	test 2>/dev/null grep && $(pwd) test echo sed printf && done grep printf
+		test local -eu done && 2>/dev/null done
+	&& readonly $(pwd) "$1" | 'quoted text' printf test 2>/dev/null "$1" "$1" sed
+	awk readonly "$@" 2>/dev/null echo export done test done && ${HOME} then
+		${HOME} "$@" /usr/bin local printf x=1 echo |
+	--verbose awk echo | "$@" ${HOME} then cd && printf echo grep local "$@" then
+		2>/dev/null ${HOME} $(pwd) -eu echo test -eu printf $(pwd) sed --verbose readonly
+		&& done echo readonly printf awk 'quoted text' done "$1" echo printf test
+		export local grep ${HOME} grep then
+${HOME} --verbose sed x=1
+$(pwd) $(pwd) $(pwd) "$@" then sed done 2>/dev/null test test awk /usr/bin local
+		echo local -eu test test readonly ${HOME}
+cd export "$@" ${HOME} $(pwd) echo readonly readonly local $(pwd) then 2>/dev/null
+2>/dev/null done awk export echo cd awk readonly
+local -eu | echo 2>/dev/null export test $(pwd) local echo awk 2>/dev/null /usr/bin
+	printf local cd readonly 'quoted text'
+	done 'quoted text' -eu x=1 local -eu test | cd 'quoted text'
+		| export grep printf "$1" "$@"
+done 2>/dev/null 'quoted text' x=1 cd local /usr/bin printf $(pwd)
@@ -0,0 +1,2001 @@
+	sed grep 2>/dev/null "$@" "$1" grep sed "$1" export 'quoted text' export
+		sed grep cd then export $(pwd)
+		test echo done "$@" "$@" local cd then 'quoted text' 'quoted text'
+		-eu ${HOME} test grep grep then /usr/bin
+	done test awk $(pwd) export grep readonly
+		readonly readonly echo | /usr/bin
+readonly done test sed $(pwd)
+cd printf echo 'quoted text' x=1 2>/dev/null
+grep readonly cd printf
+		sed /usr/bin done awk test $(pwd)
+	readonly -eu x=1 echo 'quoted text'
+		"$1" then | 'quoted text' local
+printf ${HOME} --verbose awk test test /usr/bin
+		awk grep 2>/dev/null readonly cd 'quoted text' local 2>/dev/null sed export
+	local "$1" echo then then done --verbose grep test $(pwd) 'quoted text' "$1"
+"$1" 'quoted text' "$1" /usr/bin test echo awk
+"$1" printf $(pwd) $(pwd) printf sed --verbose echo "$@" sed "$1"
+		${HOME} printf --verbose | sed "$@" sed export | x=1 readonly
+sed 2>/dev/null $(pwd) sed then sed 2>/dev/null
+	"$1" echo done local local then | export x=1 then echo $(pwd) && done readonly
+	/usr/bin awk echo $(pwd) | test then local cd readonly readonly
+	printf awk && export --verbose sed x=1 done sed test
+	-eu export printf awk printf cd test "$1" | && echo export
+		cd --verbose printf ${HOME} test printf test sed sed export
+		printf done "$@" printf x=1 "$1" echo printf
+/usr/bin && ${HOME} x=1 readonly ${HOME} echo -eu
+	-eu echo | cd grep 2>/dev/null --verbose sed
+test 'quoted text' | sed 2>/dev/null export "$@" x=1 |
+		grep --verbose ${HOME} "$1" "$1" 2>/dev/null test cd test /usr/bin
+	--verbose | 'quoted text' $(pwd)
+		&& -eu 'quoted text' -eu "$1" $(pwd) 'quoted text' awk then then then | local
+/usr/bin sed $(pwd) ${HOME} $(pwd)
+		readonly $(pwd) && echo "$@" printf && grep awk && sed "$@" ${HOME} ${HOME}
+		--verbose cd test cd printf
+	printf awk sed && --verbose cd 'quoted text'
+	x=1 x=1 awk "$@" cd "$@" 2>/dev/null
+	awk && cd -eu && echo 2>/dev/null -eu --verbose cd 2>/dev/null then
+		-eu x=1 && && test local local test 'quoted text'
+		grep echo | grep /usr/bin cd /usr/bin readonly x=1 done
+test "$@" | test --verbose -eu /usr/bin done then then $(pwd) awk
+	'quoted text' x=1 "$1" sed cd
+readonly cd --verbose sed readonly
+"$1" 2>/dev/null ${HOME} 2>/dev/null "$1" 'quoted text' -eu then $(pwd) "$@"
+		${HOME} printf -eu 'quoted text' local
+readonly && then local
+	sed then --verbose | 2>/dev/null --verbose export /usr/bin
+	"$1" grep 'quoted text' grep 'quoted text' ${HOME} echo sed && grep test test
+	x=1 'quoted text' x=1 /usr/bin done done
+	readonly "$1" grep sed done 2>/dev/null /usr/bin readonly
+test awk cd /usr/bin then /usr/bin done export "$@" awk test "$1" then awk "$@"
+		test x=1 'quoted text' export sed grep done local $(pwd) "$1" --verbose
+2>/dev/null cd test "$@" grep --verbose done cd echo grep echo && printf local
+	readonly then 'quoted text'
+| 2>/dev/null then sed export "$@" echo ${HOME} && sed awk done awk export
+		awk export awk test awk printf cd &&
+&& /usr/bin then echo test --verbose local printf
+"$1" --verbose echo test 2>/dev/null printf sed grep "$@" cd readonly printf 'quoted text'
+done "$1" --verbose /usr/bin x=1 ${HOME} then awk
+	echo | cd grep && && export export sed "$@"
+| test test "$@" printf echo echo echo printf sed ${HOME} /usr/bin
+	readonly "$@" test cd x=1 | | ${HOME} "$1" awk printf
+		'quoted text' x=1 ${HOME} ${HOME} done ${HOME} -eu $(pwd) --verbose
+	readonly grep /usr/bin printf done printf | --verbose printf awk
+/usr/bin awk "$@" grep "$1" cd test && --verbose then /usr/bin $(pwd) then "$1"
+	sed cd --verbose "$1" --verbose readonly 2>/dev/null
+	&& /usr/bin local "$@" grep then awk printf awk
+echo echo readonly sed 2>/dev/null echo
+		echo "$@" && $(pwd) sed done x=1 sed printf 'quoted text' 'quoted text'
+		/usr/bin printf grep done /usr/bin then cd sed sed 'quoted text' "$1"
+	local done && export cd export printf cd readonly
+		printf export && local -eu "$@" done test awk -eu grep sed
+	grep && $(pwd) done x=1 export | cd | ${HOME} awk | printf done
+sed ${HOME} local 'quoted text' -eu
+echo ${HOME} then "$1" cd 2>/dev/null -eu test readonly awk local 2>/dev/null
+		readonly ${HOME} echo awk "$1" 'quoted text'
+	2>/dev/null x=1 --verbose /usr/bin /usr/bin then $(pwd)
+	echo readonly readonly echo cd test done
+		-eu /usr/bin grep local done 2>/dev/null then awk "$@" "$1" x=1 x=1
+readonly 'quoted text' $(pwd) cd test "$@" -eu "$@" grep 'quoted text' /usr/bin
+local echo ${HOME} 'quoted text' readonly /usr/bin && printf export
+		done cd printf printf 'quoted text' done | -eu | ${HOME} && | done $(pwd) local
+test --verbose awk sed cd x=1 $(pwd) done then echo printf
+-eu sed test 2>/dev/null /usr/bin && --verbose cd echo 'quoted text' test
+	&& test 'quoted text' test x=1 x=1 $(pwd) awk "$1" 'quoted text' | | cd export
+"$@" ${HOME} $(pwd) echo printf readonly printf test export
+	export echo --verbose "$1" $(pwd)
+"$@" printf echo done "$1" printf
+		--verbose grep export --verbose 2>/dev/null
+		readonly grep local $(pwd) | --verbose printf test readonly
+-eu awk $(pwd) awk echo ${HOME} then ${HOME} readonly x=1 --verbose
+	echo "$1" printf 'quoted text' --verbose test 2>/dev/null
+		2>/dev/null | -eu 2>/dev/null printf | && 2>/dev/null
+"$@" printf cd --verbose $(pwd)
+	$(pwd) test | -eu export printf x=1 then /usr/bin --verbose export readonly --verbose
+		| cd "$@" printf readonly readonly 2>/dev/null
+-eu 'quoted text' x=1 $(pwd) 2>/dev/null cd "$1"
+cd echo "$@" local -eu echo
+"$@" 'quoted text' x=1 'quoted text'
+		printf readonly 'quoted text' -eu 2>/dev/null then grep
+	$(pwd) "$1" $(pwd) readonly && $(pwd) /usr/bin 'quoted text' ${HOME} "$1"
+	"$@" /usr/bin | export sed then "$1" grep "$1" echo $(pwd) echo -eu 2>/dev/null
+	cd readonly ${HOME} $(pwd) && ${HOME} echo "$@" readonly "$1" && printf | $(pwd)
+		${HOME} -eu printf /usr/bin 'quoted text' -eu readonly 2>/dev/null
+		&& 'quoted text' --verbose $(pwd) | readonly awk cd printf local |
+	then 'quoted text' "$@" then 'quoted text' 2>/dev/null
+awk readonly 2>/dev/null
+	cd then x=1 && ${HOME} $(pwd) "$1" printf
+		-eu ${HOME} sed | $(pwd) x=1 echo grep export export "$1" "$1" local readonly
+"$@" x=1 echo then $(pwd) local done export /usr/bin
+x=1 test printf echo 2>/dev/null
+		test grep readonly printf 2>/dev/null $(pwd) then printf
+		cd awk | | -eu 2>/dev/null awk | test printf echo cd echo x=1
+	local -eu -eu printf awk "$1" "$1" $(pwd) echo
+| sed test /usr/bin "$@" "$@" && local grep | 'quoted text' local grep && then
+	${HOME} /usr/bin cd printf | --verbose
+		printf | printf sed readonly
+awk cd $(pwd) awk printf awk --verbose
+'quoted text' done -eu then $(pwd) "$1"
+	grep awk grep 2>/dev/null "$1"
+sed printf awk sed "$@" echo
+	2>/dev/null "$1" test local export
+		then "$@" cd 2>/dev/null echo printf
+		awk awk awk /usr/bin && 2>/dev/null cd awk x=1 awk echo printf cd
+	cd ${HOME} 'quoted text' -eu echo | | readonly export
+		awk "$1" done $(pwd) && -eu then x=1 done
+		${HOME} sed --verbose /usr/bin "$1" awk 2>/dev/null export
+then ${HOME} local "$@" cd local export
+	-eu 'quoted text' "$1" printf | x=1 $(pwd) ${HOME}
+grep 2>/dev/null printf x=1 | /usr/bin 'quoted text' awk -eu printf echo
+		/usr/bin export 2>/dev/null done grep then -eu then --verbose
+		${HOME} export local && /usr/bin x=1 "$1" done "$1" | -eu then
+${HOME} ${HOME} && done then && /usr/bin "$@" "$1" --verbose printf |
+		then then | local ${HOME} cd ${HOME} "$1" echo local $(pwd) "$1" export
+		'quoted text' | -eu grep test "$@" sed "$1" 'quoted text' export
+		/usr/bin local local grep sed echo
+	-eu -eu ${HOME} grep grep && "$@" "$1"
+cd echo local local awk 2>/dev/null done
+		'quoted text' done "$@" cd ${HOME} sed 'quoted text'
+echo -eu 2>/dev/null -eu x=1 grep 2>/dev/null --verbose
+		echo $(pwd) export && local 'quoted text' | sed awk ${HOME} -eu 2>/dev/null
+		${HOME} sed awk --verbose echo grep -eu $(pwd) then
+	--verbose done "$@" x=1 local local awk done -eu printf done cd 'quoted text' 'quoted text'
+		readonly -eu /usr/bin 'quoted text' awk | "$1" readonly
+		grep local export grep echo /usr/bin
+	"$@" printf "$1" | "$@" then export sed echo --verbose
+		then cd -eu sed && --verbose readonly sed echo | printf 'quoted text'
+	'quoted text' --verbose
+		/usr/bin && awk ${HOME} sed export ${HOME} cd $(pwd) $(pwd) export sed test
+	printf ${HOME} --verbose "$1" -eu then |
+	--verbose -eu && --verbose local done 'quoted text' | sed
+		local | && /usr/bin sed | --verbose 'quoted text' printf
+		sed && "$1" | echo then 'quoted text' "$@" printf local
+	${HOME} /usr/bin local 'quoted text' printf echo grep awk sed 'quoted text' 2>/dev/null
+done --verbose awk /usr/bin sed /usr/bin test -eu $(pwd) 'quoted text'
+	local sed printf grep readonly echo -eu ${HOME}
+	"$1" && "$@" then "$1" local ${HOME} --verbose printf printf export 'quoted text'
+		readonly sed echo -eu export
+	printf -eu $(pwd) printf | x=1 echo done "$1" sed | && done -eu 2>/dev/null
+2>/dev/null "$@" --verbose | readonly x=1 /usr/bin then done local
+	'quoted text' grep grep done cd grep 2>/dev/null export "$@" cd -eu done
+		"$@" && -eu sed test sed grep -eu done
+	printf 'quoted text' "$@" ${HOME} -eu x=1 "$@" && ${HOME}
+sed local /usr/bin export grep export /usr/bin
+sed -eu test grep $(pwd) export
+		cd x=1 'quoted text' x=1 printf
+local "$@" $(pwd) readonly
+local -eu readonly sed echo then 'quoted text' then test
+	sed 2>/dev/null grep /usr/bin sed awk export echo echo -eu sed
+test export export $(pwd) && 'quoted text' 'quoted text'
+	grep cd done awk 2>/dev/null readonly | test sed "$@" $(pwd) done |
+	grep ${HOME} echo 2>/dev/null && test printf x=1 "$1"
+/usr/bin echo sed $(pwd) "$1" grep done -eu grep test 'quoted text'
+		&& $(pwd) 'quoted text' 2>/dev/null 'quoted text' cd grep
+	"$1" grep -eu /usr/bin "$@" "$1"
+	grep "$1" then x=1 -eu readonly -eu cd printf --verbose
+-eu "$1" test grep then awk
+		echo done done done "$1"
+		"$@" --verbose $(pwd)
+		local | test grep printf $(pwd) | done sed echo
+	-eu printf /usr/bin readonly printf 'quoted text'
+		local grep then /usr/bin ${HOME} ${HOME} cd 2>/dev/null
+x=1 echo export 'quoted text' 2>/dev/null then "$1" then grep && "$1" -eu
+printf /usr/bin then /usr/bin readonly "$1" && grep done 2>/dev/null
+		printf -eu && /usr/bin local sed ${HOME} then readonly
+	/usr/bin "$1" ${HOME} "$1" readonly
+		sed printf sed cd local "$1" "$1" awk $(pwd)
+	grep test | local x=1 export "$@" --verbose
+		readonly /usr/bin $(pwd) awk $(pwd)
+		"$1" sed local && then $(pwd) sed "$1" /usr/bin done grep x=1
+	"$@" | grep cd 2>/dev/null
+		-eu local done x=1 cd readonly
+readonly | cd && && awk x=1 cd test
+	&& export cd "$1" awk then
+		"$1" 'quoted text' /usr/bin /usr/bin export echo local && "$1" ${HOME} "$1" $(pwd)
+--verbose cd /usr/bin ${HOME} ${HOME} /usr/bin -eu echo awk sed
+	"$1" test sed readonly awk then
+		awk test x=1 echo $(pwd) cd
+then local && "$@" $(pwd) printf printf /usr/bin then x=1 export -eu 'quoted text'
+		/usr/bin 'quoted text'
+		--verbose done cd awk grep --verbose /usr/bin
+export then readonly readonly
+printf test sed "$1" /usr/bin echo ${HOME} $(pwd) 'quoted text'
+| "$1" x=1 /usr/bin /usr/bin && echo test 'quoted text'
+--verbose "$1" && export echo
+	'quoted text' && sed awk echo
+		sed test then export cd x=1 && grep | "$1" readonly -eu cd then && $(pwd)
+2>/dev/null test export awk "$1" echo ${HOME} grep &&
+sed /usr/bin "$@" echo "$@" --verbose done echo then done
+then then cd 2>/dev/null "$@" "$@" sed -eu awk done "$1" sed && 'quoted text'
+"$1" | test "$1" done cd x=1
+		'quoted text' -eu sed printf test 2>/dev/null echo awk
+	readonly && export 'quoted text'
+	--verbose /usr/bin 'quoted text'
+echo x=1 grep awk sed --verbose local awk test export export x=1 readonly
+grep --verbose 'quoted text' readonly echo 2>/dev/null echo | local ${HOME} |
+		--verbose sed awk cd -eu | awk done && /usr/bin awk grep local sed test export
+	export && cd cd grep cd grep export && test awk printf echo -eu done cd
+		local done printf export x=1 done ${HOME} export sed "$@" -eu export
+		awk done test local "$@" then "$1" grep grep test "$@"
+	done 'quoted text' test readonly export local
+	done $(pwd) sed --verbose test ${HOME} grep /usr/bin then local | x=1 echo
+export --verbose then local done 2>/dev/null
+	$(pwd) x=1 done echo --verbose readonly
+printf done x=1 local grep
+	| cd done awk awk sed cd local x=1 'quoted text' $(pwd) grep then
+		"$1" done --verbose /usr/bin sed 'quoted text' echo
+-eu printf -eu export 2>/dev/null "$1" "$1" "$@" ${HOME} | --verbose
+		"$1" readonly printf 2>/dev/null
+		"$@" sed ${HOME} /usr/bin readonly $(pwd) local done "$@"
+awk sed && sed ${HOME} echo sed "$@" /usr/bin readonly local "$1"
+		--verbose printf echo
+"$@" x=1 echo $(pwd) && then grep 2>/dev/null echo
+		2>/dev/null x=1 --verbose grep
+"$@" && readonly awk echo cd 2>/dev/null
+		cd 'quoted text' cd -eu cd && sed echo
+| readonly x=1 done done --verbose "$1" "$1" test /usr/bin
+	local then then -eu "$@" echo $(pwd) done "$@" sed readonly 'quoted text'
+	&& /usr/bin done 2>/dev/null
+		&& then then x=1 "$@"
+	cd printf 2>/dev/null cd cd "$@" test then
+done grep --verbose cd cd ${HOME} x=1 --verbose test awk /usr/bin echo
+		x=1 local awk /usr/bin echo /usr/bin sed ${HOME}
+	| sed done && /usr/bin done "$@" --verbose readonly 'quoted text' $(pwd) grep
+	export /usr/bin echo grep --verbose sed --verbose --verbose
+		| awk readonly grep local $(pwd) local -eu | grep local awk grep echo | readonly
+"$@" | test then $(pwd) done cd awk awk then --verbose test && "$@"
+	sed test "$1" export && /usr/bin cd | export grep grep 'quoted text' ${HOME}
+$(pwd) export $(pwd) 'quoted text' printf awk --verbose cd test x=1 "$1"
+	| 'quoted text' grep done $(pwd) done ${HOME} then cd "$1" readonly done
+		test sed --verbose local awk grep --verbose
+		x=1 x=1 ${HOME} /usr/bin
+		printf readonly 'quoted text'
+	export 2>/dev/null echo then done printf ${HOME} grep
+	${HOME} echo /usr/bin -eu
+	$(pwd) test cd $(pwd) --verbose
+		echo && -eu x=1 2>/dev/null printf test
+${HOME} then printf grep readonly sed grep grep "$@" export 'quoted text'
+		"$@" printf && done local 'quoted text' ${HOME} readonly echo
+		sed "$@" grep local -eu "$@" -eu --verbose "$@" export
+	$(pwd) export ${HOME} local
+	$(pwd) ${HOME} "$1" $(pwd) awk then && && done cd "$1" test printf && export 2>/dev/null
+		sed sed | printf cd sed export | echo | -eu readonly grep | echo test | "$@" x=1
+	echo -eu done test && /usr/bin x=1
+x=1 test awk ${HOME} && 2>/dev/null cd "$@" cd echo printf
+$(pwd) export -eu "$@" local readonly export ${HOME}
+		cd ${HOME} grep awk 2>/dev/null ${HOME} "$1" cd 2>/dev/null readonly --verbose
+		test grep local done then then --verbose readonly
+		-eu echo printf 2>/dev/null "$@" /usr/bin readonly x=1 | | && done ${HOME}
+awk && && sed grep test done 2>/dev/null printf export printf
+		--verbose && done sed --verbose awk echo 2>/dev/null
+		export grep sed printf "$1" | | local
+		x=1 && ${HOME} | | grep | --verbose local export -eu
+		awk "$1" export "$@" printf ${HOME} 'quoted text' "$1" --verbose
+	/usr/bin "$1" /usr/bin "$1" printf test awk done echo readonly --verbose
+-eu --verbose -eu printf --verbose ${HOME} cd echo grep --verbose
+	sed $(pwd) /usr/bin "$1" cd 'quoted text' cd | -eu ${HOME} test -eu "$1" x=1 cd
+test then 2>/dev/null -eu local grep done export
+	printf 2>/dev/null && done | grep
+	--verbose "$1" grep && $(pwd) | && done then readonly
+cd && -eu "$1" test --verbose --verbose
+grep sed then test echo --verbose ${HOME} then x=1
+-eu -eu awk x=1 x=1 | cd && grep ${HOME} readonly | done
+	x=1 -eu then then done test "$@" test /usr/bin 'quoted text' "$@" grep local
+		--verbose done /usr/bin
+	export /usr/bin $(pwd) && echo sed x=1 x=1 2>/dev/null
+local -eu export -eu grep cd
+	"$1" /usr/bin grep /usr/bin local 2>/dev/null then $(pwd) $(pwd) "$@" 'quoted text'
+	done printf $(pwd) $(pwd) -eu readonly ${HOME} test --verbose
+		&& export --verbose "$1" | 'quoted text'
+	printf done "$1" local printf
+cd && x=1 export x=1 cd 'quoted text' readonly then echo printf
+		test $(pwd) printf -eu local "$1" x=1 readonly 'quoted text' $(pwd)
+		test test && cd local local test awk sed 'quoted text' "$1" grep echo
+&& echo grep test $(pwd)
+"$@" cd readonly printf --verbose --verbose && -eu 2>/dev/null
+--verbose "$1" then cd awk done export 'quoted text' -eu local
+	$(pwd) test "$@" $(pwd) echo | x=1 "$@" test 'quoted text'
+		echo 2>/dev/null && sed x=1 2>/dev/null grep cd 2>/dev/null export 2>/dev/null
+	--verbose grep --verbose local $(pwd) readonly awk && 2>/dev/null readonly
+		export 2>/dev/null export
+	test then echo "$@" ${HOME} printf local then echo then 'quoted text' printf local
+	export export readonly && "$1" test echo test "$1" awk done
+	export export echo export "$1" | test grep "$@" ${HOME} -eu test then
+"$@" /usr/bin 'quoted text' then echo && sed echo done 2>/dev/null local /usr/bin
+		sed cd "$@" done test "$1" sed
+$(pwd) echo | then sed grep && then cd
+echo 'quoted text' cd done 2>/dev/null && done local
+	${HOME} x=1 readonly export --verbose
+/usr/bin --verbose --verbose awk --verbose 2>/dev/null $(pwd)
+		grep local printf $(pwd) --verbose
+	test done awk local grep | -eu 2>/dev/null --verbose /usr/bin
+x=1 done local 'quoted text' | "$1" 'quoted text' 'quoted text' --verbose
+		grep --verbose -eu 2>/dev/null
+sed "$@" grep test 2>/dev/null --verbose echo && "$1" grep export
+	sed -eu --verbose | /usr/bin x=1 sed "$@" readonly readonly echo local
+	&& test "$1" "$1" /usr/bin $(pwd) "$1" "$@" readonly
+		readonly 2>/dev/null export export readonly readonly printf echo done
+test 2>/dev/null | x=1 cd then
+		$(pwd) 2>/dev/null cd awk awk --verbose export
+		sed grep cd x=1 export "$@" readonly $(pwd) 'quoted text' "$1" && export grep
+		$(pwd) 2>/dev/null x=1 readonly grep 'quoted text' then
+test && awk | export | local x=1
+printf done x=1 x=1 echo "$1" | local ${HOME} --verbose cd | readonly
+x=1 "$1" done awk awk done
+${HOME} /usr/bin local cd grep 2>/dev/null local readonly echo printf | readonly
+	done test | sed then readonly /usr/bin printf then local 'quoted text'
+	sed "$1" sed then readonly 2>/dev/null
+local echo --verbose ${HOME} readonly cd then
+		2>/dev/null sed ${HOME} done && sed export sed sed && | printf /usr/bin --verbose
+sed cd x=1 then done sed /usr/bin export x=1 awk export
+		awk test cd awk 'quoted text' awk x=1 printf $(pwd) && local sed
+		--verbose printf "$1" grep sed
+${HOME} cd readonly grep $(pwd) echo then grep printf /usr/bin x=1 'quoted text'
+	| grep -eu echo printf 'quoted text' ${HOME} | cd x=1 $(pwd) local $(pwd)
+	then export then $(pwd) --verbose then printf /usr/bin cd --verbose then sed
+readonly "$1" "$@" then 'quoted text' "$@"
+	-eu test -eu -eu x=1 then sed local 'quoted text' awk sed sed
+"$@" --verbose -eu test "$1" 2>/dev/null grep 'quoted text'
+cd awk $(pwd) done 'quoted text'
+echo ${HOME} x=1 x=1 $(pwd) && | --verbose
+		then awk -eu sed test local "$@" $(pwd) then
+		printf test 2>/dev/null "$1" && | 'quoted text' local export grep readonly
+		${HOME} awk export test printf -eu printf -eu printf --verbose
+		printf "$@" "$@" readonly then $(pwd) grep export printf echo --verbose
+	sed --verbose -eu done cd "$1" local local
+	--verbose done && done "$@" --verbose
+	done export | && awk /usr/bin echo "$1"
+		| awk -eu -eu done grep done printf
+done echo local | then test "$@" /usr/bin export 'quoted text'
+sed sed local printf --verbose awk sed "$1" echo --verbose local sed
+	readonly cd test "$1" test "$1"
+	local echo export -eu $(pwd) test "$@" readonly cd export $(pwd) 2>/dev/null done
+		cd && done "$1" 'quoted text' test printf grep "$1" x=1 then done echo
+		readonly 'quoted text'
+	done awk test ${HOME} local export grep local export awk awk cd -eu grep
+		export $(pwd) printf printf
+${HOME} "$1" local echo echo done printf 2>/dev/null awk sed x=1 -eu printf
+		readonly /usr/bin readonly then && echo readonly $(pwd) sed
+"$1" grep grep && "$@" cd $(pwd) "$@" "$@" "$1"
+		printf printf 'quoted text' grep "$@" "$@" readonly
+2>/dev/null test x=1 && -eu --verbose cd x=1 printf done "$@" cd 2>/dev/null export
+		local done export "$1" readonly awk -eu --verbose
+		then "$@" readonly local $(pwd) "$@" x=1 ${HOME}
+		"$@" /usr/bin printf printf $(pwd) 2>/dev/null
+		then export grep sed "$@" "$@" test && done
+"$@" /usr/bin 2>/dev/null -eu export 2>/dev/null then test && cd sed echo
+	printf cd export ${HOME} 'quoted text' echo ${HOME} printf cd -eu local
+		$(pwd) --verbose x=1 "$@" done $(pwd) printf export done 'quoted text' |
+	then /usr/bin export readonly then "$1" /usr/bin sed x=1 sed && printf "$1" | x=1
+/usr/bin x=1 done grep
+"$1" grep 2>/dev/null awk | cd sed test /usr/bin ${HOME}
+		-eu then 2>/dev/null /usr/bin 2>/dev/null readonly | readonly test -eu
+	"$1" | 'quoted text' printf readonly grep
+readonly | local x=1 -eu local --verbose printf
+		cd | awk sed /usr/bin "$@" test 2>/dev/null 'quoted text' --verbose
+		2>/dev/null && printf $(pwd) --verbose "$1" && echo x=1 | ${HOME}
+		$(pwd) awk "$@" then "$@" export local 2>/dev/null $(pwd) echo x=1
+		--verbose test 'quoted text' $(pwd) --verbose export printf
+sed /usr/bin cd x=1 | -eu done "$@" done && test test
+	"$1" ${HOME} sed sed -eu "$@" awk echo | "$@"
+		"$1" --verbose $(pwd) | "$1" && awk echo 2>/dev/null echo --verbose
+echo readonly readonly ${HOME} export sed --verbose 'quoted text'
+	done $(pwd) awk test echo 2>/dev/null
+printf test echo grep "$@" local "$@" then && /usr/bin grep test
+local $(pwd) | then sed done export -eu -eu --verbose 2>/dev/null -eu 2>/dev/null
+	-eu echo "$1" echo sed awk | && done $(pwd) ${HOME}
+/usr/bin && --verbose readonly sed awk x=1 "$1" 'quoted text' && printf local
+export ${HOME} x=1 -eu /usr/bin -eu
+	&& printf -eu export cd "$@" x=1 export 2>/dev/null
+export test awk export echo 'quoted text' --verbose ${HOME} done
+&& x=1 --verbose --verbose printf sed test 2>/dev/null printf readonly
+		--verbose then sed && "$@" -eu "$1" $(pwd) export --verbose && printf then printf
+		grep readonly echo && $(pwd) | test "$@" test export /usr/bin readonly test
+	then sed grep --verbose "$1" --verbose test cd then
+	then $(pwd) awk echo "$@" ${HOME} /usr/bin
+	grep && "$@" 'quoted text' 'quoted text'
+	| "$@" "$1" | test /usr/bin | printf ${HOME} ${HOME} awk readonly
+--verbose test "$@" local readonly
+	${HOME} export readonly test
+	2>/dev/null --verbose echo 'quoted text' done grep "$@" 'quoted text' /usr/bin
+cd -eu done awk 'quoted text' local readonly local x=1 test x=1 'quoted text'
+		cd done x=1 "$1" /usr/bin
+		"$1" -eu ${HOME} ${HOME} --verbose
+		echo then then 'quoted text'
+export test "$@" test done "$@" then printf sed sed | then 2>/dev/null echo
+sed x=1 cd x=1 | awk && readonly 'quoted text'
+${HOME} local then x=1 export echo 2>/dev/null ${HOME} ${HOME} $(pwd)
+		then readonly test 'quoted text' cd x=1 echo grep
+2>/dev/null $(pwd) local export printf -eu "$@" --verbose && echo /usr/bin -eu ${HOME}
+		&& | export --verbose readonly
+	--verbose export | local sed test
+-eu done done printf export x=1 printf readonly | /usr/bin
+	x=1 printf 2>/dev/null "$@" export "$1" 'quoted text' 2>/dev/null export
+	cd 'quoted text' ${HOME} 2>/dev/null --verbose test export sed "$@" cd ${HOME}
+		/usr/bin done 'quoted text' done local "$1" /usr/bin | "$1" | "$@" /usr/bin
+&& -eu "$@" "$1" awk /usr/bin "$1" "$1" cd sed "$1" sed readonly ${HOME}
+		| readonly --verbose then cd 'quoted text'
+		sed done "$1" 2>/dev/null $(pwd) "$@" awk sed --verbose done
+$(pwd) cd then 'quoted text' ${HOME} export cd echo
+$(pwd) $(pwd) grep -eu --verbose
+		/usr/bin local $(pwd) printf 2>/dev/null | readonly printf ${HOME}
+		x=1 x=1 readonly --verbose && test $(pwd) ${HOME} /usr/bin 2>/dev/null
+		echo echo "$@" cd sed 2>/dev/null cd test 2>/dev/null
+"$1" readonly "$@" test
+		"$1" 2>/dev/null "$@" cd awk && ${HOME}
+sed && cd x=1 "$@" "$@" "$@" "$@" grep
+	x=1 | /usr/bin && printf ${HOME} readonly sed done && | printf local grep "$1"
+	x=1 then readonly grep done -eu 'quoted text' --verbose awk local readonly ${HOME}
+x=1 "$1" -eu local "$1" grep
+	"$@" x=1 | local --verbose | then |
+		grep "$@" && then 2>/dev/null done -eu test echo
+	"$1" "$1" "$@" awk && "$1" then -eu grep
+"$1" test "$1" cd | printf
+		sed /usr/bin local then local /usr/bin
+	${HOME} awk /usr/bin --verbose --verbose --verbose /usr/bin done test
+"$1" cd grep && x=1 'quoted text' done | -eu
+		readonly | "$1" --verbose export | cd "$1" --verbose ${HOME} ${HOME}
+	-eu readonly && export && --verbose then ${HOME}
+| -eu x=1 sed 2>/dev/null then done "$@"
+		grep && | sed done test echo | -eu $(pwd) sed $(pwd) && then /usr/bin local echo
+	export "$1" cd cd echo done -eu && export export | "$1" x=1 cd
+	'quoted text' sed "$1" 'quoted text'
+	export done then export && ${HOME}
+--verbose cd --verbose awk "$@" x=1 grep test
+--verbose x=1 test echo sed | && && then grep -eu x=1 grep sed
+/usr/bin printf printf --verbose sed printf /usr/bin awk done | -eu
+$(pwd) local cd 2>/dev/null $(pwd) "$1" 2>/dev/null
+&& | | && then x=1 --verbose $(pwd) test $(pwd)
+	-eu "$1" sed $(pwd) echo local local cd 'quoted text'
+		awk test "$@" awk 'quoted text' grep export 'quoted text' export cd | echo
+local printf sed readonly ${HOME} "$1" export export --verbose -eu && /usr/bin
+		| printf cd ${HOME} test test test $(pwd) sed "$1" test grep && sed
+	echo -eu "$1" 2>/dev/null ${HOME} && done export ${HOME} echo 'quoted text' 'quoted text'
+/usr/bin grep "$@" -eu readonly awk local 'quoted text' ${HOME}
+	done --verbose -eu -eu printf
+printf echo "$@" then --verbose
+local local then awk 2>/dev/null /usr/bin x=1 | -eu echo
+	${HOME} x=1 grep 2>/dev/null
+"$1" "$@" 2>/dev/null 'quoted text' readonly 2>/dev/null 2>/dev/null
+		then cd 'quoted text' --verbose cd && grep export test 2>/dev/null
+	2>/dev/null cd readonly --verbose -eu && awk awk 'quoted text' then export done
+		cd sed awk then readonly "$1" $(pwd) local test echo
+	export cd 'quoted text' --verbose grep export awk && readonly
+	--verbose "$1" | sed grep | 2>/dev/null
+		then grep awk cd x=1 | && $(pwd) grep local 'quoted text' x=1 2>/dev/null
+	readonly 2>/dev/null echo "$@" readonly | test /usr/bin awk x=1 'quoted text'
+		&& -eu | done readonly x=1 sed --verbose sed readonly printf ${HOME} printf
+	x=1 "$1" echo x=1 "$1" sed printf 'quoted text' "$1" grep -eu &&
+local awk /usr/bin $(pwd) ${HOME} && awk $(pwd) 2>/dev/null
+		&& awk 2>/dev/null cd done echo
+	-eu local readonly "$@" printf readonly x=1 printf local cd local done sed
+	/usr/bin x=1 /usr/bin done && $(pwd) "$@" test
+	grep /usr/bin printf done local export $(pwd) ${HOME} readonly "$@"
+cd --verbose printf then local readonly readonly && "$1" grep "$@"
+		sed then "$@" | /usr/bin 'quoted text' printf cd grep
+	local echo 'quoted text' "$@" cd done export test then
+		"$1" "$1" x=1 sed cd x=1 grep local x=1 --verbose
+	| 2>/dev/null | printf | echo -eu awk 2>/dev/null
+done grep printf --verbose grep done done -eu done cd -eu export x=1
+		| "$@" 'quoted text' cd awk --verbose /usr/bin /usr/bin sed /usr/bin cd && $(pwd)
+	/usr/bin awk x=1 ${HOME} /usr/bin 2>/dev/null
+-eu printf && test local ${HOME} awk local awk echo
+export done cd export awk sed cd "$@" then local
+then /usr/bin printf test awk 2>/dev/null /usr/bin local printf sed | done
+	-eu -eu | cd "$@" local local then "$1" "$1" export test | echo
+		printf "$@" -eu --verbose | sed sed "$1" export 2>/dev/null /usr/bin local
+		--verbose --verbose "$1" local local --verbose $(pwd) echo
+local echo grep ${HOME} test && /usr/bin done /usr/bin readonly cd | then "$1"
+${HOME} awk sed "$@" && 'quoted text'
+		grep "$1" test sed grep export grep /usr/bin x=1 export ${HOME} grep
+$(pwd) | grep 2>/dev/null "$@" export ${HOME}
+		done test grep | ${HOME} local local then
+$(pwd) --verbose 'quoted text'
+		local local local "$1" "$1" echo x=1 sed printf
+	-eu printf $(pwd) /usr/bin sed echo "$@" ${HOME} local printf
+		&& readonly grep local /usr/bin ${HOME} && $(pwd) ${HOME} export local
+	'quoted text' local readonly "$@" -eu then
+readonly x=1 readonly x=1 "$1" export echo local && && awk local /usr/bin
+done grep then 'quoted text' done /usr/bin awk awk test | --verbose
+		--verbose local /usr/bin 'quoted text' -eu export
+| "$1" sed && 2>/dev/null x=1 "$1" done 2>/dev/null
+	awk "$1" done x=1 sed echo /usr/bin
+	"$@" export 2>/dev/null cd sed printf "$@" then
+cd readonly test done readonly sed 'quoted text' awk awk "$@" export
+		&& export awk readonly printf awk done | export | sed local cd && readonly
+sed test $(pwd) -eu --verbose 2>/dev/null test awk done export readonly
+x=1 -eu local "$@" awk test && export ${HOME} export --verbose
+		x=1 /usr/bin -eu readonly ${HOME} awk 2>/dev/null $(pwd)
+printf $(pwd) sed then | $(pwd) /usr/bin test | readonly
+		${HOME} grep x=1 awk readonly echo 'quoted text'
+	export done awk "$1" | local export then done ${HOME}
+	${HOME} "$@" "$1" sed printf 'quoted text'
+		&& $(pwd) printf 2>/dev/null --verbose
+		${HOME} 2>/dev/null /usr/bin "$1" && grep | readonly && 'quoted text'
+		"$1" then test then echo "$1" $(pwd) echo /usr/bin $(pwd) "$@" $(pwd)
+readonly readonly readonly local ${HOME} printf
+		&& test printf /usr/bin 2>/dev/null && cd printf awk ${HOME} 'quoted text'
+'quoted text' --verbose echo --verbose -eu | cd "$1" grep && -eu 'quoted text'
+	2>/dev/null grep test
+	local local printf export "$@" --verbose cd
+	then printf "$1" && "$1" readonly
+"$@" awk grep "$@" printf --verbose done && "$1" test grep then
+	then "$@" /usr/bin echo printf && ${HOME} cd ${HOME} awk -eu readonly
+export sed -eu "$1" awk -eu |
+"$@" && done export -eu readonly
+		export readonly sed printf -eu -eu ${HOME}
+		'quoted text' ${HOME} 2>/dev/null done 'quoted text' /usr/bin "$1"
+		| readonly --verbose 2>/dev/null "$1" then
+	awk | "$1" printf test x=1 readonly
+		'quoted text' ${HOME} grep export --verbose
+	x=1 grep awk done "$1" $(pwd) echo grep printf /usr/bin readonly 2>/dev/null awk
+readonly printf ${HOME} "$@" ${HOME} ${HOME} "$1" readonly
+| test x=1 "$1" $(pwd) -eu | ${HOME}
+		/usr/bin local grep done "$@" ${HOME} echo test done 2>/dev/null
+		2>/dev/null cd "$@" printf ${HOME} grep export && --verbose -eu awk cd then
+$(pwd) 2>/dev/null cd "$@" export
+		&& awk cd echo printf printf ${HOME}
+done export 'quoted text' done done x=1 $(pwd) echo -eu 'quoted text'
+	"$@" ${HOME} -eu /usr/bin then
+local ${HOME} cd "$@" 2>/dev/null echo printf | awk done
+awk $(pwd) echo sed /usr/bin
+printf "$@" done export $(pwd) then readonly /usr/bin
+	'quoted text' "$1" cd local cd 'quoted text' && readonly 2>/dev/null
+	x=1 sed printf /usr/bin 'quoted text' -eu printf "$@" printf
+	test 2>/dev/null /usr/bin /usr/bin -eu | test ${HOME} grep ${HOME}
+	grep local echo --verbose then echo echo grep then &&
+	local "$@" then readonly x=1 | grep "$1" $(pwd) awk && 2>/dev/null
+readonly printf cd awk test sed 2>/dev/null x=1 --verbose ${HOME}
+		cd -eu done "$@" then | local echo $(pwd) export echo
+	x=1 awk grep 2>/dev/null 'quoted text' --verbose 'quoted text'
+test && --verbose 'quoted text' --verbose grep "$@" "$1" && "$1" export
+		/usr/bin grep ${HOME} done awk cd sed grep
+	readonly printf sed printf awk "$@" | 2>/dev/null | awk done 'quoted text'
+"$1" -eu test | 'quoted text' -eu then then --verbose -eu ${HOME}
+		"$@" export /usr/bin readonly "$1"
+export echo awk export --verbose "$1" test /usr/bin 2>/dev/null 2>/dev/null "$@"
+x=1 'quoted text' readonly --verbose ${HOME} --verbose
+	--verbose cd 2>/dev/null "$@" sed --verbose ${HOME} 2>/dev/null done
+$(pwd) "$@" local then printf grep && test printf sed awk -eu &&
+		${HOME} /usr/bin test echo local local 2>/dev/null grep /usr/bin
+		grep printf "$@" -eu "$@" ${HOME} x=1 cd awk --verbose
+		"$@" awk && cd then 2>/dev/null "$1" $(pwd) printf readonly
+x=1 && | x=1 ${HOME} export $(pwd) "$@" grep /usr/bin printf
+"$@" "$@" "$1" ${HOME} cd && -eu test local local
+		--verbose test ${HOME} $(pwd) "$@" /usr/bin x=1 sed awk cd | done -eu export local
+x=1 printf then grep "$@" ${HOME} echo | "$1" done test $(pwd) "$@"
+		test -eu echo sed printf 2>/dev/null
+	grep -eu readonly x=1 --verbose | local x=1 "$1" && readonly local
+'quoted text' --verbose awk -eu export
+/usr/bin local export
+	readonly then printf grep x=1 ${HOME} awk echo "$@" 2>/dev/null grep printf
+	then sed $(pwd) done ${HOME} local -eu awk --verbose sed awk "$1"
+		/usr/bin done /usr/bin local
+	readonly 'quoted text' printf printf test --verbose
+		/usr/bin $(pwd) /usr/bin done "$@" /usr/bin sed 2>/dev/null
+		| sed then 'quoted text' /usr/bin "$1" -eu x=1 readonly /usr/bin ${HOME} echo local
+grep "$1" 2>/dev/null /usr/bin
+	done sed 2>/dev/null 'quoted text' ${HOME} 2>/dev/null "$1" done done -eu && then
+		/usr/bin 'quoted text' x=1 -eu cd sed awk then echo then $(pwd)
+		2>/dev/null readonly cd "$1" export grep ${HOME} sed && readonly -eu export test
+	"$@" awk 'quoted text' x=1 readonly $(pwd) printf
+printf ${HOME} grep then printf awk done /usr/bin readonly done grep done "$@" x=1
+		${HOME} ${HOME} x=1 2>/dev/null cd sed "$1" -eu export done awk test | cd grep
+		cd sed test x=1 done cd "$1" grep 2>/dev/null test awk x=1 local --verbose
+	cd test cd "$@" /usr/bin 2>/dev/null
+/usr/bin sed "$@" export test cd done test cd && done grep
+		awk | | x=1 -eu cd "$1" "$1" && x=1 printf $(pwd) 'quoted text' echo
+	$(pwd) && local "$@" 2>/dev/null cd test --verbose grep readonly 'quoted text'
+	awk echo done "$1" then export
+		"$@" local printf readonly "$1" 2>/dev/null x=1 export local ${HOME}
+	echo x=1 /usr/bin export 2>/dev/null test --verbose grep "$@"
+/usr/bin $(pwd) 'quoted text' $(pwd) $(pwd)
+	test ${HOME} grep grep /usr/bin x=1 echo
+	printf $(pwd) -eu echo sed sed printf && 'quoted text' test awk "$@" $(pwd) && export
+awk sed echo test x=1 awk cd awk cd /usr/bin grep
+		--verbose cd local test test ${HOME} done local ${HOME}
+${HOME} "$@" local 'quoted text' awk printf --verbose ${HOME} && echo sed local
+	| x=1 cd && /usr/bin export readonly then readonly
+cd then | cd 2>/dev/null 2>/dev/null $(pwd) /usr/bin "$@" 2>/dev/null /usr/bin
+	export $(pwd) readonly printf readonly
+--verbose sed done printf echo local "$1" 2>/dev/null
+export 'quoted text' | | 2>/dev/null awk then echo
+x=1 done test echo export echo awk test printf test x=1 "$@" awk test /usr/bin
+		export /usr/bin && $(pwd) readonly --verbose 2>/dev/null $(pwd) sed export
+		&& then then then /usr/bin 'quoted text' local sed printf --verbose && printf
+		&& grep sed awk local sed cd local done
+		grep $(pwd) $(pwd) export && export test cd
+	${HOME} grep grep --verbose 2>/dev/null "$1" 'quoted text' && ${HOME}
+local "$@" /usr/bin echo cd export echo awk cd ${HOME} grep
+		-eu printf "$1" export && printf "$1" && export
+export 2>/dev/null done
+		-eu 2>/dev/null "$@" printf sed -eu $(pwd) then x=1 echo "$@"
+	2>/dev/null awk cd then local $(pwd) 2>/dev/null -eu x=1 echo
+2>/dev/null local --verbose && sed local done x=1 "$1" export test x=1 "$1" printf
+		&& -eu $(pwd) /usr/bin done grep 'quoted text' awk awk --verbose
+	| export cd "$1" then grep done printf local readonly done
+	cd sed awk /usr/bin && done done then export test readonly local test 'quoted text'
+"$1" 'quoted text' | cd done
+		readonly then awk | 'quoted text'
+	"$@" "$@" done x=1 printf -eu
+		echo test /usr/bin "$@" | "$1" awk test x=1 "$@" | then --verbose
+--verbose x=1 ${HOME} local ${HOME} --verbose "$@" sed |
+	${HOME} export grep printf echo awk && awk export readonly
+	local | "$1" --verbose readonly cd grep 'quoted text' readonly
+export && done | "$1" /usr/bin
+	2>/dev/null sed sed echo x=1 'quoted text' $(pwd) "$@" "$@"
+test export 2>/dev/null -eu --verbose export --verbose
+		&& readonly -eu 2>/dev/null
+readonly x=1 2>/dev/null -eu local /usr/bin "$1"
+		&& 2>/dev/null cd local && 'quoted text'
+/usr/bin test printf readonly echo awk "$1" ${HOME} printf
+	${HOME} awk printf /usr/bin awk -eu x=1 "$1"
+		sed awk && --verbose ${HOME} --verbose
+local awk $(pwd) --verbose x=1 local 2>/dev/null 'quoted text' readonly --verbose
+	readonly 2>/dev/null | 'quoted text' --verbose
+	sed --verbose cd --verbose awk -eu test 2>/dev/null -eu --verbose
+		done test grep cd sed cd -eu export "$@" done
+	local readonly x=1 x=1 "$1" echo "$@" 2>/dev/null
+&& "$1" printf export done export export x=1 'quoted text' printf
+		"$1" "$@" test printf $(pwd) $(pwd) 'quoted text' 'quoted text' readonly
+		2>/dev/null ${HOME} export printf
+local $(pwd) export grep
+sed done test && --verbose echo "$1" | && awk "$@"
+	grep awk readonly cd 2>/dev/null -eu done
+		grep readonly 2>/dev/null
+	x=1 -eu --verbose readonly --verbose 2>/dev/null
+		x=1 2>/dev/null | ${HOME} printf local "$1" cd /usr/bin
+grep readonly printf export grep grep
+test | --verbose x=1 printf && echo ${HOME} | then "$1"
+		'quoted text' -eu readonly -eu
+		&& echo $(pwd) grep sed printf sed local /usr/bin echo | then
+	printf sed x=1 done $(pwd)
+"$1" done grep sed local && sed "$@"
+&& 'quoted text' "$@" printf grep $(pwd) $(pwd)
+	local ${HOME} 'quoted text' echo x=1 grep export -eu test
+		printf test readonly --verbose then sed echo then
+	| $(pwd) local test ${HOME}
+cd "$@" x=1 echo && awk echo 'quoted text' 2>/dev/null grep && | awk
+	echo | ${HOME} cd local ${HOME} sed -eu "$@" test 2>/dev/null
+x=1 echo ${HOME} $(pwd) awk echo ${HOME} export 2>/dev/null 'quoted text'
+sed cd 2>/dev/null "$@" --verbose echo --verbose
+	cd -eu cd done printf x=1 ${HOME}
+	$(pwd) -eu echo echo /usr/bin echo local done test then grep && readonly
+		sed $(pwd) sed cd echo export done /usr/bin && && awk -eu "$@"
+| printf echo then readonly
+		awk | printf echo ${HOME} then readonly
+"$1" -eu printf then ${HOME} && ${HOME}
+	${HOME} $(pwd) --verbose awk done echo grep 2>/dev/null local export
+	cd cd 'quoted text' $(pwd) "$@" export 2>/dev/null -eu
+	-eu echo local awk 2>/dev/null
+		"$1" 2>/dev/null printf then 'quoted text' printf $(pwd) $(pwd) done test
+	$(pwd) then ${HOME} awk local 2>/dev/null
+	awk done test test test printf grep "$@" printf readonly /usr/bin cd grep "$@"
+		-eu echo readonly sed --verbose
+${HOME} done | $(pwd) ${HOME} test "$@" awk /usr/bin | readonly done done
+	readonly $(pwd) test local echo then && ${HOME} local
+	sed awk 2>/dev/null awk
+		${HOME} 2>/dev/null /usr/bin test cd echo grep export echo export grep
+	awk local /usr/bin --verbose --verbose cd awk 'quoted text' local
+cd printf -eu awk cd printf readonly test printf done
+		done --verbose ${HOME} then done
+		--verbose cd ${HOME} sed export | /usr/bin echo
+	sed ${HOME} grep test 2>/dev/null x=1 grep test test x=1
+	| done 2>/dev/null local awk ${HOME} && export sed 2>/dev/null
+	| -eu export 'quoted text' then
+$(pwd) x=1 $(pwd) export printf
+awk 2>/dev/null grep "$@" echo grep sed test local /usr/bin /usr/bin
+local echo "$@" && readonly && $(pwd) sed test local --verbose
+		then 'quoted text' local grep test x=1 local "$@" x=1 done local
+		--verbose $(pwd) --verbose 'quoted text' x=1 then
+	grep grep local x=1 --verbose done grep
+local done 'quoted text' sed cd echo $(pwd)
+done && && then readonly local 2>/dev/null echo grep ${HOME} then /usr/bin &&
+		printf awk cd cd 'quoted text' then 'quoted text'
+		then "$1" grep -eu echo "$@" echo sed x=1 then x=1 /usr/bin "$@"
+	$(pwd) printf -eu $(pwd) local sed grep && done x=1 export
+	-eu -eu "$@" printf --verbose "$@" then grep export
+	done echo printf 'quoted text' && done -eu grep readonly local ${HOME} 'quoted text'
+	then "$1" local local
+printf printf sed 'quoted text'
+	2>/dev/null sed local /usr/bin | cd readonly && test $(pwd)
+		-eu | grep && -eu local sed then
+	awk then sed -eu "$@" awk "$@" awk "$@" cd grep cd 'quoted text' grep
+		'quoted text' "$1" grep $(pwd) "$1" done x=1 -eu ${HOME} x=1 x=1
+done done then printf ${HOME} && done "$@" -eu -eu $(pwd) echo -eu /usr/bin
+		local echo ${HOME} "$@" done -eu /usr/bin 'quoted text'
+	grep 'quoted text' readonly test
+		done grep awk then | cd sed readonly echo awk done sed
+	test "$@" then grep test && ${HOME}
+		sed $(pwd) sed export sed
+		echo done readonly test 2>/dev/null test x=1 2>/dev/null
+"$1" cd awk ${HOME} ${HOME}
+then printf "$@" 2>/dev/null
+	then then local -eu $(pwd) x=1 -eu /usr/bin
+awk grep local cd "$@" 2>/dev/null | then $(pwd)
+		local test "$@" awk test sed test
+printf printf ${HOME} | readonly cd
+	$(pwd) $(pwd) sed test x=1 -eu sed x=1 --verbose printf
+		then sed export test cd grep test /usr/bin
+	/usr/bin "$@" /usr/bin cd --verbose echo && export
+		readonly done 2>/dev/null 'quoted text' then && grep printf
+/usr/bin grep printf then readonly
+		2>/dev/null && $(pwd) then test echo cd local &&
+	cd echo "$1" ${HOME} grep printf "$@" printf --verbose readonly readonly
+		"$@" readonly && echo && readonly
+"$1" done export $(pwd) 2>/dev/null cd "$@" then
+cd --verbose x=1 local done --verbose awk --verbose
+done grep "$1" | --verbose x=1 x=1 printf 'quoted text'
+	&& $(pwd) sed && 'quoted text' echo cd && 'quoted text' test
+		--verbose printf "$@" x=1 'quoted text'
+	$(pwd) 'quoted text' "$1" &&
+&& && grep | cd local | --verbose
+		done sed $(pwd) grep then 2>/dev/null grep "$1" -eu awk readonly cd "$1"
+	local export export sed test test local "$1" done printf cd 'quoted text'
+	cd then echo grep $(pwd) export done /usr/bin readonly 'quoted text'
+	done | export -eu cd $(pwd) export test
+		printf "$1" cd -eu test --verbose
+		test $(pwd) local 'quoted text' "$1" x=1 "$1" $(pwd)
+		"$1" printf awk test $(pwd) done done cd export echo
+	readonly cd awk $(pwd)
+/usr/bin "$@" sed export export "$1" 2>/dev/null local
+x=1 printf test "$1" x=1 readonly "$@" -eu | 'quoted text'
+		--verbose && done sed "$1" 2>/dev/null
+		"$1" "$@" x=1 && sed sed then
+2>/dev/null | | echo awk printf | echo cd x=1 x=1 sed | -eu grep
+done 2>/dev/null && printf "$@" 'quoted text'
+	printf cd test /usr/bin --verbose sed test $(pwd) "$@"
+export cd cd 'quoted text' "$@" /usr/bin printf cd
+		-eu sed echo awk test /usr/bin printf 2>/dev/null sed
+		then done "$@" echo sed cd export test
+		"$@" /usr/bin test "$1" readonly 'quoted text' /usr/bin
+cd --verbose printf printf "$1" "$@" $(pwd) 'quoted text'
+	export $(pwd) sed | --verbose $(pwd) 'quoted text'
+readonly cd "$1" awk sed echo grep 'quoted text' -eu -eu && "$1"
+		"$1" x=1 echo awk local done 2>/dev/null sed /usr/bin
+	grep ${HOME} 'quoted text' echo cd "$@" done /usr/bin then 'quoted text'
+-eu ${HOME} printf echo readonly /usr/bin printf --verbose && --verbose
+		2>/dev/null && export $(pwd) 'quoted text' printf local /usr/bin x=1 readonly
+	printf awk | $(pwd) "$1" 2>/dev/null
+${HOME} 2>/dev/null test echo | printf "$@" -eu
+| "$@" && -eu export local $(pwd) then
+cd && -eu --verbose -eu x=1 test
+	sed -eu then awk export printf ${HOME} readonly grep ${HOME} local readonly
+	local done printf cd $(pwd) x=1 /usr/bin 2>/dev/null ${HOME}
+"$@" "$1" echo echo sed
+		cd --verbose cd echo test then 2>/dev/null done
+		-eu done echo 2>/dev/null local "$@"
+	done "$@" then export cd printf "$@" then echo /usr/bin 2>/dev/null
+		| awk && -eu grep "$@" sed awk "$1" test x=1 then readonly x=1
+	then readonly | "$1" $(pwd) awk 2>/dev/null done printf printf done cd
+	${HOME} 2>/dev/null echo echo
+		grep grep 2>/dev/null
+sed echo "$@" | test grep -eu "$1" /usr/bin awk printf awk 2>/dev/null cd echo
+	"$@" --verbose "$@" "$@"
+		test echo awk local $(pwd) awk "$1" test cd sed
+		--verbose 'quoted text' export awk
+		readonly && 'quoted text' 'quoted text'
+		x=1 "$@" echo echo then awk done
+	| export $(pwd) grep readonly cd 2>/dev/null done x=1
+printf $(pwd) printf sed
+cd $(pwd) ${HOME} | local test &&
+	awk /usr/bin 'quoted text' x=1 echo echo sed ${HOME} &&
+		"$@" ${HOME} awk sed -eu
+	${HOME} ${HOME} test "$@" echo | | ${HOME} cd /usr/bin then cd &&
+sed done $(pwd) local "$1" test
+		sed && -eu sed 'quoted text' then readonly && then
+	"$1" --verbose --verbose 'quoted text'
+echo x=1 "$1" echo then $(pwd) x=1 "$@" x=1
+		--verbose echo && echo "$@" $(pwd) sed awk /usr/bin
+${HOME} awk export then ${HOME}
+--verbose sed --verbose
+local "$@" x=1 echo $(pwd) -eu cd "$1"
+	| | && local grep test sed --verbose grep
+	echo | grep ${HOME} sed sed
+| export "$@" printf -eu | printf
+test /usr/bin then $(pwd) -eu done ${HOME} readonly
+		cd | /usr/bin awk "$@" --verbose /usr/bin
+readonly local done "$1" "$1"
+		x=1 ${HOME} cd /usr/bin grep | 2>/dev/null --verbose
+--verbose "$1" /usr/bin test "$@" ${HOME} "$@" awk x=1 done echo 'quoted text'
+	-eu | awk readonly printf $(pwd) "$@" cd test ${HOME} local then then test $(pwd)
+		x=1 -eu /usr/bin local
+	x=1 && then 'quoted text'
+echo grep local $(pwd) printf /usr/bin "$@" sed /usr/bin -eu && "$1"
+	"$@" /usr/bin echo readonly printf | && local
+		"$1" test test sed && $(pwd) done /usr/bin grep x=1
+| printf 2>/dev/null done "$1" test x=1 printf
+	"$1" /usr/bin done done $(pwd)
+--verbose 2>/dev/null done -eu --verbose && local
+cd then readonly "$1" cd local -eu "$@" sed done echo && cd echo awk echo
+		echo --verbose test done
+		local | readonly cd "$@" $(pwd) printf awk grep
+		-eu sed local printf $(pwd) $(pwd) && printf export "$1" grep | 'quoted text'
+${HOME} readonly grep
+	| local local readonly printf
+		"$1" "$1" printf /usr/bin printf $(pwd) readonly printf ${HOME} cd 'quoted text'
+	printf export export --verbose && $(pwd) readonly export local echo
+		test awk $(pwd) x=1 local -eu local
+		echo ${HOME} 2>/dev/null export local sed cd && "$@" "$1" 'quoted text'
+	then 2>/dev/null export grep "$@" $(pwd) ${HOME} ${HOME} 'quoted text' x=1 -eu
+		x=1 printf x=1 "$@" "$@" printf x=1 sed | local cd then && sed 2>/dev/null
+"$@" awk $(pwd) /usr/bin cd awk printf -eu -eu --verbose
+		$(pwd) test /usr/bin --verbose then grep readonly grep x=1 local
+		2>/dev/null export export cd then /usr/bin "$1" ${HOME} x=1 | awk readonly /usr/bin
+/usr/bin export -eu 2>/dev/null
+	/usr/bin /usr/bin cd /usr/bin x=1 x=1 echo export cd x=1 /usr/bin "$@" export
+		'quoted text' -eu done && test readonly printf /usr/bin cd then cd echo "$@"
+	done 'quoted text' 2>/dev/null awk --verbose test
+'quoted text' "$@" awk echo 2>/dev/null
+	x=1 'quoted text' $(pwd) 'quoted text' "$@" "$1" x=1 readonly 'quoted text'
+--verbose printf ${HOME} printf 2>/dev/null -eu done "$1"
+/usr/bin x=1 readonly x=1 "$@" printf cd printf 'quoted text' | 'quoted text'
+		x=1 awk echo "$1" "$1" --verbose then x=1 'quoted text'
+	'quoted text' cd then done sed grep -eu local ${HOME} "$1"
+		$(pwd) cd -eu test grep readonly -eu ${HOME} && x=1 echo grep x=1 sed "$@" then
+	--verbose done "$@" "$@" test -eu
+	$(pwd) grep "$@" grep local echo done x=1 echo printf "$1" export ${HOME} export
+		test 2>/dev/null readonly
+		&& --verbose awk readonly sed | printf -eu /usr/bin
+	local -eu printf local echo | awk test
+local /usr/bin "$@" readonly printf
+done 'quoted text' "$1" "$1" echo
+	x=1 printf --verbose --verbose | test 'quoted text'
+awk awk then "$1" /usr/bin then printf "$1"
+	&& printf x=1 printf $(pwd) x=1 sed --verbose readonly local | 2>/dev/null
+	sed sed $(pwd) | "$1" -eu grep printf "$@" "$@" cd echo
+x=1 'quoted text' --verbose printf $(pwd) printf x=1 && export "$@"
+		sed cd /usr/bin && x=1 awk
+then /usr/bin echo "$1" done echo then
+-eu | awk then local test /usr/bin | x=1 export "$1"
+		'quoted text' ${HOME} ${HOME} readonly echo $(pwd) export printf "$1" done | then
+		${HOME} "$1" x=1 /usr/bin /usr/bin 2>/dev/null readonly readonly | 2>/dev/null
+		-eu local --verbose awk ${HOME} sed cd ${HOME} /usr/bin --verbose
+readonly "$1" cd | "$@" 2>/dev/null $(pwd) /usr/bin export local $(pwd) awk
+&& cd printf readonly -eu sed "$1" ${HOME} readonly export grep readonly
+		--verbose "$@" export "$@" "$@"
+		sed printf done && echo "$1" done readonly $(pwd) echo cd /usr/bin | && $(pwd)
+| ${HOME} ${HOME} 2>/dev/null local then 'quoted text'
+	local 'quoted text' /usr/bin /usr/bin test 2>/dev/null awk then x=1 $(pwd)
+	-eu /usr/bin $(pwd) then /usr/bin --verbose
+2>/dev/null 2>/dev/null done x=1 $(pwd) -eu
+		"$1" $(pwd) "$1" readonly then cd local x=1 cd
+awk grep awk test -eu echo "$@" readonly then grep
+sed --verbose | printf then x=1 /usr/bin 'quoted text'
+	cd echo cd local "$1" done 'quoted text' --verbose export
+| local echo --verbose done x=1 cd /usr/bin $(pwd) grep
+	cd "$@" export 'quoted text' readonly
+		2>/dev/null test readonly awk $(pwd) readonly
+	printf then -eu then 'quoted text' awk && ${HOME} readonly /usr/bin 'quoted text'
+	--verbose && -eu printf /usr/bin 2>/dev/null /usr/bin echo -eu local | awk cd
+	${HOME} export test grep 2>/dev/null 2>/dev/null "$@" echo
+		/usr/bin "$@" cd local cd "$1" /usr/bin awk 'quoted text'
+export -eu echo x=1 "$@" test $(pwd) echo printf /usr/bin cd x=1 readonly /usr/bin
+${HOME} done done awk 2>/dev/null -eu then 2>/dev/null then grep sed printf
+done "$@" printf | sed grep done --verbose
+cd /usr/bin test x=1 $(pwd) test done sed awk printf readonly awk
+x=1 2>/dev/null printf printf "$@"
+	local grep printf $(pwd) then readonly $(pwd) x=1
+done "$@" "$@" ${HOME} "$1" $(pwd) printf $(pwd)
+cd 'quoted text' printf local && then "$@" done && --verbose -eu readonly echo
+	/usr/bin sed 2>/dev/null 2>/dev/null 2>/dev/null 'quoted text'
+readonly --verbose "$@" | printf done cd "$1" export "$@" /usr/bin
+printf 2>/dev/null x=1 echo $(pwd) "$@"
+&& /usr/bin readonly && 'quoted text'
+	/usr/bin "$1" cd readonly printf local x=1 export local
+	sed then echo grep "$1" done cd "$@" "$@" sed 'quoted text'
+		x=1 2>/dev/null export | done "$1" echo $(pwd) printf then sed grep
+		x=1 "$1" grep echo && 'quoted text' x=1 x=1 'quoted text' "$1" "$1" ${HOME}
+	then 'quoted text' echo awk "$1" --verbose printf
+		sed test 2>/dev/null --verbose cd local | 2>/dev/null echo "$@" cd
+		sed x=1 | awk echo /usr/bin sed
+export 2>/dev/null && ${HOME} /usr/bin ${HOME} -eu echo grep | local grep
+	"$@" | /usr/bin printf $(pwd) grep test "$@"
+	grep readonly sed "$@" x=1 awk local
+export echo 'quoted text' sed ${HOME} $(pwd) awk done | done
+export /usr/bin sed && $(pwd) | local $(pwd) printf awk -eu test 'quoted text'
+	echo done cd grep local | then echo 'quoted text' --verbose cd
+${HOME} grep --verbose && sed ${HOME} readonly
+-eu echo -eu --verbose "$1" "$1" grep && 2>/dev/null
+	| awk --verbose -eu local 2>/dev/null
+echo done | -eu $(pwd) | readonly
+	echo "$@" sed 'quoted text' cd printf
+echo | test awk grep "$@" printf
+		sed && echo awk local "$1" export cd "$@" cd sed export grep
+	"$1" "$1" ${HOME} | 2>/dev/null export -eu echo cd "$1" test then done $(pwd)
+done readonly x=1 grep done cd $(pwd) 2>/dev/null grep $(pwd)
+	sed sed local printf export cd local $(pwd) awk | then done readonly
+"$@" x=1 export readonly ${HOME}
+echo cd echo ${HOME} 2>/dev/null sed x=1 printf sed test awk ${HOME}
+	--verbose readonly ${HOME} test /usr/bin /usr/bin grep
+		local grep export 2>/dev/null && awk | 2>/dev/null awk then awk then printf
+		echo cd printf local readonly x=1 printf cd echo grep awk 'quoted text'
+	cd "$1" grep 'quoted text' "$1" then awk
+		"$1" printf ${HOME} x=1
+	-eu $(pwd) 'quoted text' 'quoted text' grep ${HOME} 2>/dev/null $(pwd) cd --verbose
+		"$@" readonly then export
+export sed readonly then 'quoted text'
+		&& printf echo | ${HOME} "$@" x=1 && grep grep && 2>/dev/null
+	done local done "$@" /usr/bin x=1 "$1" awk 2>/dev/null && 'quoted text' sed done
+local done "$1" | echo $(pwd) local grep awk 2>/dev/null
+	awk cd x=1 awk | -eu && 'quoted text' printf echo -eu 'quoted text'
+		--verbose sed done awk cd
+grep awk then 'quoted text' x=1 echo grep "$@" ${HOME} awk
+"$@" | done "$1" $(pwd) grep echo then
+	--verbose readonly 2>/dev/null x=1 && readonly 2>/dev/null x=1 -eu
+'quoted text' "$1" -eu 'quoted text' awk
+	test "$1" done 'quoted text'
+/usr/bin 'quoted text' x=1 echo done done
+	local "$@" 2>/dev/null then "$@" echo x=1 $(pwd)
+	echo 2>/dev/null /usr/bin grep export 2>/dev/null readonly local
+	test x=1 -eu "$@" done then /usr/bin local done
+2>/dev/null && --verbose grep test cd --verbose "$1" $(pwd) 'quoted text' sed
+	-eu 2>/dev/null "$1" readonly grep readonly local 'quoted text'
+		'quoted text' "$1" printf done -eu local done
+test ${HOME} "$1" $(pwd) echo readonly ${HOME} printf x=1 echo grep readonly
+-eu --verbose test -eu && 'quoted text' then sed --verbose
+then -eu | awk x=1 x=1 2>/dev/null
+	test export -eu echo 'quoted text' export grep &&
+	test | readonly "$1" test sed test readonly readonly
+	--verbose x=1 'quoted text' $(pwd) -eu echo
+	test cd sed sed /usr/bin -eu cd local -eu ${HOME} && local cd x=1 -eu
+	export done | grep readonly echo $(pwd) 2>/dev/null 2>/dev/null "$1" && 2>/dev/null
+then cd echo /usr/bin export sed readonly done /usr/bin x=1 "$1"
+/usr/bin | 2>/dev/null then | done -eu 'quoted text' "$1" test local 'quoted text'
+awk printf echo local cd echo x=1 then ${HOME}
+'quoted text' 2>/dev/null
+		printf readonly $(pwd) $(pwd) then printf x=1 --verbose
+		export echo awk --verbose test "$1" readonly 2>/dev/null && readonly
+	readonly printf sed -eu && "$1" export | echo
+	${HOME} then "$@" done readonly export 'quoted text' && $(pwd) local
+	2>/dev/null cd export local "$@"
+cd "$@" local done -eu export echo export | readonly readonly
+	$(pwd) local grep local cd cd /usr/bin ${HOME} -eu readonly x=1 /usr/bin
+	then $(pwd) ${HOME} grep && printf x=1 awk cd
+cd echo export 2>/dev/null "$@"
+	done && printf then cd readonly -eu /usr/bin
+-eu sed then echo /usr/bin && 2>/dev/null
+	${HOME} echo echo "$@" -eu 'quoted text' export
+	local x=1 --verbose export then echo done --verbose | export
+		-eu readonly cd 2>/dev/null
+	sed -eu 2>/dev/null 'quoted text'
+		then /usr/bin x=1 sed ${HOME} | test 2>/dev/null printf $(pwd) export -eu "$1"
+	local local then local
+		2>/dev/null && /usr/bin | && --verbose export printf
+	local local export ${HOME} local "$1" then awk readonly --verbose -eu done
+	$(pwd) 2>/dev/null printf /usr/bin --verbose $(pwd) "$@" then printf export echo
+	then -eu echo --verbose test 2>/dev/null export && --verbose local done 2>/dev/null
+	2>/dev/null readonly awk readonly x=1 local 'quoted text'
+x=1 | --verbose echo local cd grep --verbose 'quoted text' done $(pwd)
+	grep | "$1" "$@" then grep then /usr/bin export "$@" 2>/dev/null sed | /usr/bin
+		&& $(pwd) && $(pwd) /usr/bin $(pwd) "$@" printf
+		$(pwd) $(pwd) sed "$@" --verbose readonly 2>/dev/null --verbose
+		printf test sed local | awk && x=1 x=1 | ${HOME} $(pwd) local ${HOME} done
+		echo cd test "$@" "$1"
+		2>/dev/null ${HOME} x=1 "$@" readonly x=1 sed
+	'quoted text' && then sed /usr/bin
+		${HOME} local "$1" awk test
+x=1 awk export echo 'quoted text'
+	then $(pwd) printf readonly printf
+	| awk awk done printf awk
+		&& $(pwd) cd then "$@" echo cd then /usr/bin local 2>/dev/null
+	local /usr/bin printf "$1" done
+		$(pwd) 2>/dev/null --verbose then then
+	then sed local then &&
+	sed local echo | -eu test done ${HOME} export export awk then export printf
+	/usr/bin sed awk ${HOME} "$@" readonly
+"$@" sed "$@" export cd echo
+	-eu "$1" "$@" grep | awk -eu 2>/dev/null cd echo "$1" local test "$1" /usr/bin
+2>/dev/null $(pwd) then
+then ${HOME} "$1" "$@" grep -eu "$1" done | echo
+	then && local "$1" x=1 --verbose readonly
+		"$1" local awk done ${HOME} then x=1 printf test /usr/bin
+	-eu x=1 then then $(pwd) export readonly grep -eu local
+		done grep 2>/dev/null --verbose 'quoted text' local
+	-eu /usr/bin printf /usr/bin "$@" sed
+	| readonly $(pwd) "$@" x=1 --verbose "$@" x=1 then "$1" /usr/bin
+		grep export awk --verbose --verbose done grep then local
+	done cd grep x=1 ${HOME} cd && grep grep /usr/bin
+		awk /usr/bin | sed then 2>/dev/null grep | 2>/dev/null ${HOME}
+echo | awk local sed ${HOME}
+#include c195.sh
+${HOME} printf 2>/dev/null | grep
+	"$1" --verbose done /usr/bin $(pwd) cd echo export local 'quoted text'
+awk printf -eu "$@" 2>/dev/null $(pwd) "$@" --verbose "$1" $(pwd) then done 'quoted text'
+		printf | echo --verbose local
+'quoted text' readonly local
+		| export cd "$1" printf 'quoted text' printf $(pwd)
+'quoted text' --verbose /usr/bin "$1" 2>/dev/null
+local 2>/dev/null "$1"
+	cd done cd local "$@" --verbose echo "$@" grep awk && sed "$1" then
+	then ${HOME} --verbose echo $(pwd) && | echo export 'quoted text'
+	readonly export "$1" export cd local export | sed
+	| | /usr/bin /usr/bin sed awk grep printf $(pwd) test export done && readonly
+-eu "$1" "$@" readonly /usr/bin done
+	"$@" x=1 /usr/bin awk 2>/dev/null "$@" grep printf "$1" printf
+awk printf grep sed done
+		x=1 $(pwd) then readonly awk -eu then "$1" then /usr/bin echo
+x=1 grep test grep ${HOME} $(pwd) $(pwd) /usr/bin local cd test printf "$1" export
+		$(pwd) export | "$1" x=1 | "$1" grep cd -eu echo
+		&& 'quoted text' sed
+		local "$1" --verbose readonly cd | 'quoted text' cd x=1 2>/dev/null
+sed x=1 then $(pwd) grep | | ${HOME} 2>/dev/null grep
+	-eu awk 'quoted text' | "$@"
+	-eu local 'quoted text' awk /usr/bin
+readonly done 2>/dev/null grep /usr/bin -eu export then echo printf
+sed ${HOME} && readonly ${HOME} done echo readonly printf awk --verbose
+local echo test /usr/bin echo readonly ${HOME} local $(pwd) sed 'quoted text'
+		$(pwd) cd done /usr/bin "$1"
+	$(pwd) /usr/bin local awk done local "$@" && grep && export printf 'quoted text'
+		awk /usr/bin $(pwd) $(pwd) --verbose ${HOME} ${HOME} printf test
+		echo $(pwd) 2>/dev/null grep echo "$1" 'quoted text' 2>/dev/null x=1 printf echo
+		"$@" then echo -eu export awk echo echo | awk export
+		-eu export /usr/bin done cd export 2>/dev/null ${HOME} /usr/bin test --verbose
+		${HOME} sed sed printf cd "$1" -eu export readonly
+cd echo -eu awk sed 2>/dev/null then
+export cd export printf 'quoted text' | && done test export sed
+	then -eu then grep cd
+test sed "$@" cd -eu done -eu x=1
+	test $(pwd) x=1 readonly $(pwd)
+	"$1" sed then "$@" && ${HOME} -eu done &&
+cd test 2>/dev/null --verbose | 'quoted text' test $(pwd) "$@" readonly
+awk /usr/bin awk "$@" sed ${HOME} printf x=1 then -eu export then cd x=1 then sed
+printf done done done $(pwd) grep -eu "$1" "$1" x=1 /usr/bin test local "$1"
+| "$1" "$1" && sed export && test
+cd -eu export cd --verbose awk | sed x=1 --verbose /usr/bin test done
+	&& awk printf "$1" readonly "$@" echo 2>/dev/null
+	2>/dev/null test x=1 ${HOME} local done 'quoted text'
+	--verbose readonly export grep "$@" awk done /usr/bin
+grep echo | local test sed
+		cd echo "$1" awk "$1" "$1" "$1" && -eu ${HOME} sed export echo sed cd printf
+	grep | --verbose /usr/bin cd && 2>/dev/null echo | 'quoted text' cd $(pwd)
+	awk grep printf "$@" cd local $(pwd) -eu
+		cd -eu test awk | ${HOME} x=1 -eu grep grep awk x=1 echo local cd printf
+--verbose 2>/dev/null readonly 2>/dev/null then export --verbose "$@"
+	grep local done grep awk 2>/dev/null 2>/dev/null local
+		--verbose ${HOME} printf cd echo $(pwd) | x=1 test 'quoted text'
+		${HOME} grep then local "$@" "$@" 2>/dev/null "$1" then then
+		/usr/bin 'quoted text' "$1" 2>/dev/null --verbose
+	${HOME} 'quoted text' x=1 -eu echo && readonly
+x=1 -eu local awk ${HOME} $(pwd) sed "$@" -eu "$@" sed then
+	done then -eu /usr/bin "$1"
+	printf awk --verbose -eu awk && | readonly
+2>/dev/null --verbose $(pwd) &&
+		x=1 'quoted text' done printf awk then "$@" --verbose readonly export ${HOME}
+"$1" --verbose $(pwd) echo --verbose
+	'quoted text' ${HOME} "$1" ${HOME} -eu sed "$1" local test /usr/bin
+	&& done cd test | "$@" local
+		--verbose 'quoted text' then cd sed done cd grep grep x=1 -eu
+	printf $(pwd) local -eu cd grep grep "$@"
+cd --verbose cd --verbose printf && readonly "$1" export
+| export $(pwd) local /usr/bin done local cd
+2>/dev/null 'quoted text' 'quoted text' $(pwd) grep
+	-eu sed done echo "$1" sed 'quoted text' && export 'quoted text' "$1"
+x=1 then awk /usr/bin 2>/dev/null echo then awk export 'quoted text'
+	then printf /usr/bin ${HOME} --verbose ${HOME} sed then $(pwd) -eu done
+		2>/dev/null "$@" cd ${HOME} 2>/dev/null
+	&& echo $(pwd) local $(pwd) ${HOME}
+		awk "$@" sed && x=1 grep cd && 2>/dev/null "$@" $(pwd)
+		export readonly sed export export --verbose --verbose
+		2>/dev/null x=1 cd 'quoted text' echo sed awk done -eu
+	/usr/bin 'quoted text' done x=1 "$1"
+		-eu 2>/dev/null local && ${HOME} done --verbose readonly | echo x=1
+	local "$@" test cd awk grep x=1 x=1 ${HOME}
+		--verbose local done then | echo /usr/bin | test "$@" $(pwd) export readonly x=1
+		/usr/bin x=1 printf then grep $(pwd) && sed
+local -eu local printf | printf awk readonly cd export $(pwd) then grep sed printf
+	sed x=1 /usr/bin "$1" "$@" printf
+	done "$1" export readonly ${HOME} test grep awk then /usr/bin /usr/bin
+	awk echo $(pwd) cd readonly --verbose --verbose readonly test -eu then | sed $(pwd)
+awk local grep "$1" x=1 && printf readonly
+${HOME} test awk sed -eu 'quoted text' awk && "$@"
+		&& done done 'quoted text' test printf /usr/bin local printf sed then echo
+cd "$@" readonly "$@" | && | readonly printf && local cd readonly
+		--verbose test $(pwd) readonly --verbose
+		cd done 2>/dev/null done $(pwd) /usr/bin "$@"
+	export -eu echo export | sed awk x=1 readonly /usr/bin "$1" 'quoted text'
+--verbose readonly --verbose --verbose local then &&
+	-eu 2>/dev/null 'quoted text' readonly local $(pwd) local then
+| export "$@" then readonly
+export awk x=1 sed sed 2>/dev/null
+echo -eu | printf "$1" awk printf
+		2>/dev/null grep done then done cd "$1" local export grep local 2>/dev/null echo
+		test then /usr/bin test then sed sed 'quoted text' && | cd grep echo test
+--verbose sed x=1 grep ${HOME}
+$(pwd) echo | printf grep sed && && test
+echo ${HOME} local -eu /usr/bin 2>/dev/null local grep printf awk
+sed echo && printf "$@" then local export grep --verbose
+sed cd done ${HOME} local ${HOME} cd done printf
+"$1" cd --verbose --verbose --verbose cd local "$1" x=1 -eu $(pwd) printf
+		--verbose && readonly 2>/dev/null
+$(pwd) test x=1 sed 'quoted text' test grep -eu printf done -eu readonly ${HOME}
+		-eu done -eu "$@" "$1"
+		x=1 echo grep export done sed
+	"$@" readonly x=1 "$1" "$1"
+		grep | x=1 sed | && test ${HOME} && 'quoted text' printf "$1"
+	grep 2>/dev/null then cd printf printf test grep echo readonly test printf
+"$1" --verbose printf $(pwd) ${HOME} 2>/dev/null
+		echo 'quoted text' then 2>/dev/null $(pwd) grep
+		grep grep printf --verbose local $(pwd) then echo echo export
+local test "$1" grep grep x=1 printf readonly readonly sed /usr/bin grep done
+${HOME} --verbose test grep "$@" -eu echo && grep then readonly
+	then then $(pwd) sed x=1
+		sed done done /usr/bin 'quoted text' local then
+		"$@" then 2>/dev/null -eu sed && sed -eu cd -eu
+"$@" --verbose readonly cd /usr/bin "$@" | export cd awk printf "$1"
+	sed "$@" "$@" awk done -eu x=1 -eu test --verbose export |
+${HOME} awk sed sed $(pwd) sed -eu cd | && 2>/dev/null && ${HOME} then -eu $(pwd)
+		then 2>/dev/null sed --verbose ${HOME} readonly grep
+		awk x=1 2>/dev/null x=1 'quoted text' done
+		-eu 'quoted text' awk $(pwd)
+local done readonly -eu printf test "$@" ${HOME} local awk "$@"
+/usr/bin echo export |
+		"$@" sed && then awk && local 'quoted text' done $(pwd) /usr/bin
+	done ${HOME} printf done 2>/dev/null 'quoted text'
+		-eu $(pwd) 2>/dev/null
+	local x=1 "$@" "$1" "$@" 'quoted text'
+awk "$1" printf && readonly "$1" "$1" "$1" export sed cd printf -eu
+		local then local | grep sed
+export "$@" "$@" done local 2>/dev/null /usr/bin cd | grep
+		"$@" 2>/dev/null test grep
+		cd /usr/bin awk sed 2>/dev/null /usr/bin export "$@" test
+	&& printf | "$@" && export sed "$@" | ${HOME} done test export
+	--verbose /usr/bin /usr/bin --verbose echo 2>/dev/null x=1 "$@" echo --verbose
+	2>/dev/null ${HOME} echo x=1 "$@" "$@" $(pwd) export ${HOME} cd
+	x=1 --verbose && /usr/bin echo then
+awk x=1 export ${HOME} --verbose | grep --verbose done x=1 cd
+		'quoted text' done ${HOME}
+		printf x=1 "$1" cd printf --verbose sed ${HOME} grep done "$@"
+		cd && test "$@" && x=1 awk test grep /usr/bin printf x=1 "$1"
+	grep 2>/dev/null echo | ${HOME} $(pwd) 2>/dev/null test
+export --verbose then -eu
+&& "$1" /usr/bin /usr/bin && | echo done then then printf local
+	--verbose 'quoted text' ${HOME} 2>/dev/null then readonly sed
+cd grep --verbose printf cd echo
+${HOME} && "$1" "$@" "$1"
+&& grep test x=1 echo && cd local done "$1" ${HOME}
+	readonly sed 2>/dev/null done awk readonly -eu x=1 "$1" --verbose cd
+		export /usr/bin "$@" then export readonly
+		readonly cd 'quoted text' sed sed "$@" && grep
+		echo printf | done --verbose 'quoted text'
+	cd cd "$1" x=1 then sed printf echo 2>/dev/null
+	local -eu echo done export "$1" printf
+/usr/bin then && export ${HOME} done test
+	"$1" done 2>/dev/null $(pwd) $(pwd)
+		${HOME} && "$1" done grep "$1" echo "$@" "$@"
+		| grep echo cd readonly /usr/bin
+		awk 'quoted text' local readonly
+test readonly grep -eu grep cd sed local awk export
+	test local $(pwd) echo ${HOME} $(pwd) /usr/bin done export
+readonly echo echo done awk awk "$@" local x=1 then
+		2>/dev/null "$@" readonly
+		grep "$1" readonly /usr/bin 2>/dev/null
+local -eu done cd x=1 --verbose export
+"$@" cd --verbose --verbose /usr/bin x=1 local local && local
+printf "$1" awk done /usr/bin readonly | echo -eu | grep x=1 x=1
+	echo echo --verbose $(pwd) export printf export $(pwd) x=1 awk "$@"
+		done --verbose "$1" --verbose then /usr/bin test ${HOME} readonly
+	echo readonly -eu | | local done export test -eu local --verbose 'quoted text'
+readonly x=1 then "$@" $(pwd) | ${HOME}
+		then && done /usr/bin "$@" 'quoted text' && done | readonly --verbose then "$1"
+		/usr/bin /usr/bin ${HOME} "$@"
+		printf --verbose awk 2>/dev/null 'quoted text' 'quoted text' "$1" then "$@"
+	--verbose "$@" "$1" 'quoted text' --verbose
+		export grep readonly readonly export done sed "$1" done local sed 2>/dev/null
+--verbose && && x=1 | ${HOME} awk 'quoted text' && "$@" ${HOME} done |
+	${HOME} /usr/bin test x=1 awk | "$1" | export
+	cd 2>/dev/null local export
+	"$@" $(pwd) && awk && | | echo then ${HOME} echo "$@"
+	readonly cd then cd /usr/bin | cd -eu sed $(pwd) x=1 "$1" "$1" test sed
+	'quoted text' sed sed printf sed readonly local && -eu grep && "$@" printf
+		-eu echo $(pwd) 'quoted text' awk then export awk $(pwd)
+cd "$@" --verbose /usr/bin && && then then grep x=1 2>/dev/null printf
+		cd cd local cd /usr/bin done then && /usr/bin test printf echo --verbose "$@"
+then done local "$@" "$@" 2>/dev/null done "$@" ${HOME}
+--verbose $(pwd) 'quoted text' grep | export
+local grep test 'quoted text' awk ${HOME}
+	sed ${HOME} x=1 $(pwd) then "$@"
+		--verbose ${HOME} export awk --verbose /usr/bin
+	done $(pwd) /usr/bin printf sed /usr/bin sed export
+		-eu grep grep export then printf awk printf readonly
+printf local x=1 local /usr/bin -eu printf -eu -eu readonly && sed -eu "$@"
+		&& done -eu sed local --verbose done
+${HOME} "$1" /usr/bin then then cd
+echo cd echo export "$@" export "$1" local && then readonly ${HOME} 2>/dev/null
+	cd echo x=1 export --verbose echo 'quoted text' 2>/dev/null /usr/bin done
+	&& 'quoted text' "$1" awk done local
+		&& then && export -eu ${HOME} readonly -eu test
+cd x=1 then export /usr/bin
+--verbose "$@" x=1 printf /usr/bin
+	sed grep /usr/bin x=1 echo "$1" echo printf done grep echo 2>/dev/null grep done
+readonly | readonly cd
+$(pwd) ${HOME} x=1 --verbose grep sed then sed
+2>/dev/null grep && /usr/bin readonly $(pwd)
+		${HOME} grep x=1 "$1" /usr/bin --verbose && x=1 export 'quoted text' then
+-eu -eu readonly done readonly
+	grep readonly --verbose "$1"
+		local grep printf export test done printf ${HOME} | && && /usr/bin 'quoted text'
+		-eu export export local cd "$@" 2>/dev/null
+		"$1" /usr/bin -eu --verbose && done cd ${HOME}
+		"$@" done ${HOME} readonly ${HOME} x=1
+-eu $(pwd) "$@" && /usr/bin printf local --verbose awk $(pwd) export readonly
+		cd export | grep | test
+test echo then x=1 "$@" x=1 -eu | then 'quoted text' printf
+test /usr/bin -eu 'quoted text' "$1" test
+local readonly readonly && 'quoted text' echo done then --verbose
+	| /usr/bin cd export local
+	readonly printf awk test /usr/bin && printf local | | test printf
+	--verbose x=1 | printf export ${HOME} $(pwd) -eu done then export /usr/bin
+local "$@" grep /usr/bin 'quoted text' export grep export
+/usr/bin 'quoted text' test cd 'quoted text' | /usr/bin /usr/bin
+		&& 2>/dev/null /usr/bin x=1 done printf test
+		export echo sed "$1" --verbose grep /usr/bin -eu printf 2>/dev/null
+		2>/dev/null --verbose export x=1 2>/dev/null /usr/bin x=1 $(pwd)
+	2>/dev/null 'quoted text' 'quoted text' test | echo "$1" echo awk export
+		cd && /usr/bin | "$1"
+"$1" && $(pwd) grep x=1 "$@" | cd "$1" $(pwd) 2>/dev/null printf grep $(pwd)
+		grep readonly then --verbose $(pwd) test cd echo $(pwd) sed -eu --verbose
+	echo x=1 grep "$1" grep "$@" /usr/bin then 2>/dev/null
+awk "$@" cd readonly "$@" export
+	2>/dev/null then $(pwd) &&
+		then local done awk && /usr/bin done x=1 "$@" x=1
+		then "$1" printf x=1 'quoted text'
+	cd && ${HOME} && sed readonly test
+sed 2>/dev/null done | awk export echo "$1" done local done
+		--verbose "$1" ${HOME} cd cd 2>/dev/null sed then /usr/bin -eu
+	"$@" done local test
+	readonly "$1" local x=1 echo printf "$@" && readonly
+		local then x=1 2>/dev/null
+$(pwd) 'quoted text' local export awk && printf done ${HOME}
+		$(pwd) sed awk awk echo sed sed "$@" 2>/dev/null sed test 'quoted text'
+		printf readonly ${HOME} &&
+'quoted text' cd then then
+readonly grep test ${HOME} sed local printf test
+		awk && grep | "$1" export sed && local
+	2>/dev/null "$1" --verbose echo test then
+		cd /usr/bin | -eu local awk &&
+	x=1 done awk test sed echo readonly then --verbose printf "$1" printf printf
+	"$1" /usr/bin 2>/dev/null 'quoted text' done ${HOME} | && echo && cd sed 2>/dev/null
+		-eu cd --verbose ${HOME} sed export local test | grep | | -eu
+	echo done 2>/dev/null "$1" --verbose x=1 "$1" cd export $(pwd)
+$(pwd) cd && --verbose printf ${HOME}
+	-eu --verbose ${HOME} local /usr/bin
+		local sed grep /usr/bin awk "$@" -eu "$@" ${HOME}
+		readonly printf readonly export
+	export "$1" 'quoted text' test 'quoted text' printf
+		local --verbose done "$@" sed
+		| 'quoted text' then | -eu export 'quoted text' test $(pwd)
+	sed ${HOME} readonly | ${HOME} 'quoted text' /usr/bin "$@" | 'quoted text'
+	awk export test readonly -eu grep "$@" --verbose test awk
+		"$1" ${HOME} echo /usr/bin export $(pwd) "$@"
+	echo "$@" | 'quoted text' export -eu then
+		"$@" 'quoted text' 'quoted text' grep 'quoted text' awk local sed then
+printf printf sed ${HOME} "$1" 'quoted text' | --verbose
+		'quoted text' test $(pwd) 'quoted text' /usr/bin sed && 'quoted text'
+	--verbose local test x=1 awk -eu cd --verbose | printf $(pwd) readonly
+	printf done /usr/bin echo grep "$1" 'quoted text' 'quoted text'
+	"$@" export grep export ${HOME} "$@" sed --verbose readonly -eu
+-eu done done $(pwd) test printf grep $(pwd) -eu | -eu printf test then --verbose
+		done | readonly --verbose "$@" printf 'quoted text' "$1" test "$1" grep x=1
+-eu sed --verbose grep "$1" done sed && x=1
+test awk local awk local sed && 'quoted text' --verbose
+test test test $(pwd) "$1" -eu ${HOME} readonly ${HOME}
+	done readonly && export | printf /usr/bin readonly 'quoted text' --verbose
+		'quoted text' /usr/bin cd readonly x=1 printf -eu 2>/dev/null 2>/dev/null export
+	/usr/bin -eu 2>/dev/null cd then "$@" | "$1" grep "$1" && echo readonly sed
+sed 2>/dev/null grep cd cd local
+		&& | export printf && then
+	export done then -eu printf 'quoted text' -eu | "$@" x=1 printf done && /usr/bin
+	/usr/bin done cd "$1" && /usr/bin
+${HOME} $(pwd) "$@" cd
+/usr/bin readonly $(pwd) echo awk
+printf -eu awk awk /usr/bin x=1 test test readonly done 'quoted text'
+		x=1 | export cd --verbose x=1 'quoted text' then 'quoted text' sed awk readonly
+	readonly awk echo "$1" --verbose ${HOME} echo ${HOME} then 2>/dev/null 2>/dev/null
+		echo --verbose 2>/dev/null then
+	export --verbose -eu export x=1 export 'quoted text' && sed export sed 'quoted text'
+		"$@" $(pwd) && grep sed echo readonly
+		then && "$1" | test grep
+	then | test 'quoted text' echo -eu | $(pwd) --verbose
+	sed 'quoted text' -eu | $(pwd) sed grep then local awk
+/usr/bin done echo /usr/bin --verbose printf $(pwd) sed echo "$@" cd 'quoted text'
+		2>/dev/null echo 2>/dev/null grep $(pwd) echo cd /usr/bin $(pwd) && test readonly
+	--verbose cd --verbose cd -eu --verbose test
+sed -eu readonly echo -eu "$@" test x=1 awk $(pwd) ${HOME} && 2>/dev/null
+		sed then -eu --verbose readonly export export "$1" | awk -eu echo test
+	"$1" sed "$@" then export "$@" "$@" sed then export 2>/dev/null grep
+	test grep grep "$@" sed then 2>/dev/null
+"$1" echo cd sed echo echo 2>/dev/null /usr/bin
+cd echo grep readonly then readonly local local awk local x=1 "$1" ${HOME} cd 'quoted text'
+grep /usr/bin 'quoted text'
+	$(pwd) printf local then "$@" grep "$1" -eu readonly cd 'quoted text'
+	x=1 grep local done printf printf sed echo done 2>/dev/null | | "$1"
+		x=1 $(pwd) local /usr/bin done export test |
+	| then "$@" done sed then x=1 /usr/bin sed echo done readonly
+		local cd /usr/bin sed ${HOME} 2>/dev/null |
+	test cd grep && ${HOME} done /usr/bin grep export ${HOME} 'quoted text'
+	cd /usr/bin "$1" test "$1" --verbose /usr/bin
+cd && ${HOME} export -eu
+readonly /usr/bin cd -eu echo
+	cd /usr/bin grep $(pwd)
+--verbose export grep 'quoted text' sed echo
+"$@" "$1" cd | local ${HOME} $(pwd) grep --verbose
+	"$1" sed --verbose readonly 'quoted text' done 2>/dev/null /usr/bin
+		${HOME} -eu local readonly x=1 -eu ${HOME} --verbose /usr/bin
+		/usr/bin awk "$@" awk 2>/dev/null ${HOME} -eu --verbose
+	printf /usr/bin cd local awk cd test sed x=1 -eu
+'quoted text' ${HOME} echo test export "$@" $(pwd) --verbose
+		local && then test 'quoted text' --verbose && 2>/dev/null $(pwd) -eu
+done ${HOME} --verbose readonly cd 'quoted text'
+	'quoted text' 'quoted text' -eu sed $(pwd) local 'quoted text' local -eu 2>/dev/null
+awk 'quoted text' "$@" cd x=1 local
+		printf 2>/dev/null 'quoted text' "$1" cd local sed
+--verbose $(pwd) sed local x=1 test echo 'quoted text' x=1 readonly sed --verbose
+		printf readonly test readonly --verbose 2>/dev/null done readonly ${HOME}
+		$(pwd) printf echo readonly | sed && readonly "$@" done -eu grep
+x=1 /usr/bin 2>/dev/null readonly $(pwd) readonly
+/usr/bin -eu grep -eu | | test --verbose
+x=1 grep x=1 done echo --verbose cd echo readonly awk export sed echo ${HOME}
+	-eu ${HOME} done "$1" export export x=1 | printf echo --verbose sed sed "$@" &&
+		echo -eu /usr/bin done /usr/bin then then then readonly 'quoted text'
+		${HOME} "$@" 'quoted text'
+	cd x=1 readonly "$1" 2>/dev/null sed -eu sed 'quoted text'
+	grep x=1 sed local $(pwd) "$@" cd 'quoted text'
+	/usr/bin awk sed export ${HOME}
+	"$@" cd 2>/dev/null echo
+	sed x=1 then local x=1 -eu
+	sed grep awk "$@" export | --verbose 2>/dev/null x=1
+x=1 | sed -eu printf ${HOME} awk echo local
+	export printf 'quoted text' local --verbose test export readonly 'quoted text' 2>/dev/null
+		awk $(pwd) && awk 'quoted text' $(pwd) test --verbose grep
+/usr/bin -eu grep done 2>/dev/null
+	/usr/bin && printf done echo test test test echo && export 2>/dev/null
+local -eu ${HOME} /usr/bin cd readonly done awk 'quoted text'
+	"$@" && local 'quoted text' grep
+	| ${HOME} grep export -eu /usr/bin export
+		${HOME} ${HOME} sed "$@" 2>/dev/null
+		'quoted text' local /usr/bin "$@" "$1" /usr/bin --verbose
+x=1 'quoted text' -eu then echo /usr/bin "$1" sed
+		/usr/bin done test -eu --verbose x=1 done ${HOME} readonly "$@" 2>/dev/null /usr/bin
+done "$1" local /usr/bin --verbose
+	grep grep $(pwd) "$@" $(pwd) /usr/bin 2>/dev/null &&
+		2>/dev/null export | local printf printf --verbose
+		test --verbose "$1" awk printf -eu $(pwd)
+		2>/dev/null test && 'quoted text' "$@" ${HOME} ${HOME} echo local
+/usr/bin 2>/dev/null | -eu /usr/bin 'quoted text' 'quoted text'
+	2>/dev/null | done &&
+	$(pwd) test -eu echo awk awk test 'quoted text' 2>/dev/null /usr/bin --verbose
+	echo --verbose ${HOME}
+	then then "$1" echo echo local && "$@" &&
+	2>/dev/null /usr/bin test && /usr/bin readonly printf readonly
+cd export "$@" $(pwd) 'quoted text' --verbose then x=1
+	sed then cd && $(pwd) $(pwd) printf
+export ${HOME} awk local
+		export $(pwd) cd export 2>/dev/null readonly ${HOME} done
+	export ${HOME} echo 2>/dev/null --verbose /usr/bin 'quoted text' then 2>/dev/null
+&& /usr/bin echo cd 2>/dev/null done |
+		2>/dev/null | echo printf "$1" ${HOME} sed x=1 export done echo "$@" done
+	2>/dev/null cd -eu readonly readonly readonly "$@" ${HOME} -eu
+		2>/dev/null grep readonly $(pwd) /usr/bin printf
+		--verbose "$1" 2>/dev/null
+x=1 awk $(pwd) awk "$@" ${HOME} | grep grep grep -eu 2>/dev/null
+export sed sed 2>/dev/null 2>/dev/null done local
+	cd then sed 'quoted text' "$1" awk ${HOME} &&
+		--verbose && "$1" | x=1 echo "$@" "$@" readonly && "$@" $(pwd) 'quoted text'
+"$@" 'quoted text' sed printf then then echo --verbose x=1 grep x=1 'quoted text'
+		$(pwd) grep "$@" then ${HOME} x=1 2>/dev/null $(pwd) | $(pwd)
+/usr/bin 2>/dev/null $(pwd) awk
+readonly export x=1 done $(pwd) ${HOME} ${HOME} | --verbose grep
+	"$1" && sed "$@" done "$1" $(pwd) -eu
+	readonly x=1 -eu --verbose /usr/bin -eu then ${HOME}
+		cd awk local done && /usr/bin "$1" $(pwd) test
+		sed echo cd test "$1" x=1
+	| printf 'quoted text' test x=1 then done |
+	test printf printf --verbose "$1" export awk 2>/dev/null printf
+grep | /usr/bin done && test | "$1" "$@" grep $(pwd) /usr/bin
+		local printf "$@" awk 'quoted text' -eu readonly $(pwd) local
+		x=1 $(pwd) "$@" x=1 test then --verbose grep "$@"
+	grep readonly local test && then sed $(pwd) "$@"
+	echo grep "$1" 'quoted text' sed done readonly cd
+2>/dev/null grep x=1 | -eu sed echo /usr/bin
+	local ${HOME} && x=1 x=1 awk readonly 2>/dev/null
+	then local /usr/bin echo /usr/bin "$1" /usr/bin 'quoted text'
+done sed ${HOME} sed readonly | --verbose cd /usr/bin test sed
+	echo /usr/bin | "$@" local 2>/dev/null ${HOME} 2>/dev/null
+	export "$1" done printf local --verbose test
+printf && "$1" readonly -eu "$1" export x=1 grep --verbose
+	echo export --verbose 'quoted text' readonly printf then --verbose
+awk readonly && awk awk x=1 && then --verbose -eu readonly
+test 'quoted text' awk | 'quoted text' export readonly
+		--verbose readonly 'quoted text' | printf "$@" x=1 /usr/bin -eu 'quoted text'
+		| ${HOME} -eu ${HOME} echo 2>/dev/null | "$1" -eu local | $(pwd) test
+2>/dev/null printf export local 'quoted text' sed "$1" "$1" --verbose
+		"$1" "$@" | export export && -eu cd done
+		test export local cd -eu 'quoted text'
+	x=1 export test done --verbose sed $(pwd) awk export x=1 test --verbose
+		"$1" /usr/bin x=1 /usr/bin grep test 2>/dev/null readonly
+then 2>/dev/null grep "$1" ${HOME} /usr/bin | $(pwd) grep "$1" x=1 "$1" done echo
+		| "$@" /usr/bin 'quoted text' x=1 local x=1 --verbose
+	then sed local then printf | -eu printf
+"$1" test awk test && 2>/dev/null x=1 "$@" $(pwd) --verbose awk grep
+		done /usr/bin grep 2>/dev/null 'quoted text' export echo
+	test grep --verbose awk done && "$@"
+	sed echo | x=1 export | awk
+2>/dev/null 2>/dev/null
+"$@" export echo | readonly "$1" sed local x=1 export readonly | grep $(pwd)
+cd sed then done export
+	x=1 export $(pwd) readonly && local "$@" test echo test
+		local && && readonly ${HOME} cd then test && sed -eu --verbose
+		done "$1" grep echo printf
+		grep x=1 ${HOME} printf && sed
+	then done --verbose awk echo local done
+		awk test "$1" then "$1" local | test && /usr/bin
+printf echo | export | 2>/dev/null
+grep /usr/bin export x=1
+	printf sed cd export 2>/dev/null echo && 2>/dev/null
+	/usr/bin readonly | export then test grep
+then readonly test x=1 /usr/bin test | then local export 'quoted text'
+	export 'quoted text' export x=1 grep /usr/bin 2>/dev/null ${HOME}
+printf done sed "$@" x=1
+	"$1" done printf --verbose done local echo then
+		cd $(pwd) grep "$@" done export /usr/bin awk ${HOME}
+	echo readonly readonly export 2>/dev/null
+	sed "$1" $(pwd) sed sed "$@" done 'quoted text'
+'quoted text' && printf test -eu $(pwd) x=1 ${HOME}
+	grep && 2>/dev/null && ${HOME} grep test done
+&& 2>/dev/null 2>/dev/null --verbose
+	echo grep export && done grep | grep | -eu /usr/bin ${HOME}
+		local grep done /usr/bin $(pwd) cd readonly 2>/dev/null sed test
+		"$1" sed done /usr/bin grep --verbose
+	awk echo 2>/dev/null done awk "$1" done --verbose local "$1"
+	test ${HOME} readonly readonly export cd cd "$1" 2>/dev/null export x=1 grep
+done ${HOME} grep "$1" local
+	cd done local echo /usr/bin local printf "$1" "$@" /usr/bin | "$1" grep 2>/dev/null
+	local cd "$1" 2>/dev/null
+	'quoted text' grep cd "$@" "$1" test "$@" 'quoted text' local export && --verbose
+	/usr/bin local "$@" test -eu echo
+	'quoted text' 'quoted text' x=1 echo
+echo export /usr/bin awk "$1"
+		test done | printf x=1 x=1 -eu done -eu awk
+		sed 'quoted text' 'quoted text' done | -eu export test "$1" local
+'quoted text' test test then "$@" local && readonly then 'quoted text'
+grep ${HOME} echo 2>/dev/null 2>/dev/null $(pwd)
+	echo -eu x=1 -eu "$1" /usr/bin
+	--verbose -eu /usr/bin ${HOME} local test cd $(pwd) "$1" 2>/dev/null
+		&& echo local --verbose grep 'quoted text' x=1 grep --verbose readonly
+test readonly $(pwd) test | sed cd $(pwd) cd $(pwd) echo -eu 'quoted text'
+test printf /usr/bin then then
+	"$1" "$@" awk printf sed done grep | grep awk 2>/dev/null echo then
+&& then $(pwd) "$1" cd test grep --verbose sed
+test "$1" echo "$1" "$@" grep 'quoted text' done
+cd test test ${HOME} test "$1" printf grep && 'quoted text' ${HOME} | cd done
+	x=1 cd 2>/dev/null awk
+-eu && x=1 x=1 /usr/bin echo && done && | 'quoted text' && "$1" test | done &&
+	export /usr/bin done |
+		2>/dev/null sed && x=1 /usr/bin cd --verbose
+	sed "$1" awk test test /usr/bin sed readonly "$1" "$1" then
+sed | echo done | done export --verbose
+echo printf --verbose awk && 'quoted text' readonly 2>/dev/null
+"$1" grep $(pwd) awk -eu export awk echo x=1 local /usr/bin readonly grep ${HOME}
+	-eu $(pwd) echo then
+		done sed cd ${HOME} 2>/dev/null "$@" && && printf --verbose $(pwd) done
+		test awk awk local x=1 ${HOME}
+	-eu "$@" "$@" --verbose readonly
+	awk awk 'quoted text' $(pwd) awk 2>/dev/null echo "$@" done 2>/dev/null
+		&& "$@" echo -eu printf awk sed -eu $(pwd)
+	&& ${HOME} local awk grep "$@" | cd "$1" echo && awk | export
+		sed cd test readonly done -eu $(pwd) 'quoted text'
+	'quoted text' | sed x=1 grep "$@" "$1" cd "$@" /usr/bin
+	&& -eu local grep then x=1 local then
+grep done -eu then ${HOME} x=1
+		${HOME} grep cd ${HOME} 2>/dev/null && "$@" -eu -eu echo readonly export ${HOME}
+		"$@" -eu awk then local x=1 local $(pwd) sed echo awk && test cd
+	${HOME} grep "$@" "$@" | "$1" done x=1 sed done ${HOME} test
+/usr/bin awk $(pwd) && $(pwd) done && printf then test cd awk
+	export echo | "$1" x=1 sed sed "$1" readonly x=1 local "$@" "$1"
+/usr/bin | 2>/dev/null printf grep grep 2>/dev/null
+test 'quoted text' echo $(pwd)
+/usr/bin cd echo test echo then awk /usr/bin done export
+	-eu sed -eu cd "$1" ${HOME}
+	'quoted text' $(pwd) -eu 'quoted text' cd 'quoted text' | done 'quoted text'
+test /usr/bin readonly "$@" && test 'quoted text'
+test echo awk sed --verbose sed -eu awk 2>/dev/null
+done readonly 2>/dev/null printf ${HOME} -eu sed x=1
+	grep cd cd sed && echo 2>/dev/null readonly test readonly printf cd
+echo "$@" readonly | local
+		printf sed ${HOME} 2>/dev/null --verbose x=1 then --verbose -eu local
+| readonly sed done ${HOME} test
+	"$1" local 2>/dev/null test $(pwd) readonly awk awk printf grep readonly done then
+$(pwd) /usr/bin test cd -eu
+	awk x=1 $(pwd) "$1" test done ${HOME} awk x=1 done sed done -eu
+grep 'quoted text' | --verbose done 'quoted text' "$@" | | ${HOME} test
+		test --verbose /usr/bin sed
+	then readonly | "$@" "$@"
+	"$1" "$@" "$@" echo test printf -eu readonly --verbose
+"$@" then /usr/bin "$1" 2>/dev/null echo 2>/dev/null
+x=1 awk -eu echo export sed cd && "$@" awk | 'quoted text' | cd
+| export awk --verbose 'quoted text' 'quoted text' test readonly /usr/bin
+	echo | readonly ${HOME} cd test "$1" echo test
+	--verbose cd ${HOME} cd printf $(pwd) done export export
+printf x=1 export && -eu
+	test grep $(pwd) -eu export done --verbose cd ${HOME} cd echo
+export $(pwd) 2>/dev/null "$1" done done
+		${HOME} $(pwd) test readonly sed | "$1" readonly sed done "$1" awk $(pwd)
+		2>/dev/null $(pwd) done "$1" printf grep done $(pwd) sed readonly
+		"$1" sed sed awk grep done 'quoted text' export readonly sed
+		test --verbose x=1 then echo cd x=1 sed
+printf $(pwd) -eu x=1 readonly export 2>/dev/null
+	cd export test /usr/bin && then
+		done echo | ${HOME} $(pwd) local x=1 local /usr/bin sed /usr/bin printf awk
+	done "$1" "$@" then 'quoted text' "$1" sed
+	test "$1" -eu "$@" test /usr/bin | printf x=1 export then x=1 --verbose local
+	x=1 sed "$1" "$1" 'quoted text'
+		local printf printf --verbose
+		export printf "$1" done 2>/dev/null awk $(pwd) "$@" "$1" done /usr/bin
+	test "$1" printf x=1 readonly &&
+	"$1" 2>/dev/null then | then ${HOME}
+		'quoted text' cd /usr/bin test test echo awk sed x=1 "$@" printf sed | readonly
+cd "$@" cd && awk 2>/dev/null
+		then 2>/dev/null sed && cd awk done -eu then && test
+	"$@" /usr/bin x=1 readonly --verbose
+		'quoted text' local ${HOME} "$@" --verbose local "$1" --verbose --verbose
+		"$1" then | 2>/dev/null done local done "$1" readonly then "$1"
+--verbose /usr/bin | echo 'quoted text' ${HOME} | echo --verbose
+		2>/dev/null cd test done
+	grep export grep "$@" test cd cd 'quoted text' | export -eu $(pwd) then
+	'quoted text' sed printf
+	| | "$1" /usr/bin /usr/bin | echo test && sed awk 'quoted text'
+	-eu then sed echo printf then $(pwd) 2>/dev/null awk export -eu "$1" local
+		"$@" test $(pwd) then printf awk printf
+		printf cd then then 2>/dev/null --verbose echo
+		'quoted text' | --verbose 'quoted text' export
+		${HOME} readonly grep export local --verbose $(pwd)
+		--verbose "$1" echo $(pwd) x=1 /usr/bin test && "$@" "$@" awk echo
+		local grep echo done
+echo "$@" awk sed $(pwd) cd printf 2>/dev/null 'quoted text'
+		sed /usr/bin echo /usr/bin grep --verbose ${HOME} x=1 cd readonly sed echo local
+		local -eu test echo grep export ${HOME} 'quoted text' 2>/dev/null
+x=1 --verbose 'quoted text' x=1 grep cd 'quoted text' printf "$1" ${HOME} ${HOME}
+		export ${HOME} && "$@" $(pwd) | 2>/dev/null $(pwd) ${HOME}
+awk grep $(pwd) cd ${HOME} readonly
+done "$@" echo readonly then $(pwd) /usr/bin awk export
+	"$@" grep grep 2>/dev/null --verbose "$@" done "$1" local printf
+		local --verbose local "$1" x=1 awk then printf $(pwd) ${HOME} 2>/dev/null cd
+		-eu x=1 grep 'quoted text' "$@" local --verbose 'quoted text'
+"$@" cd | x=1 "$@" /usr/bin 'quoted text' $(pwd) export sed
+$(pwd) x=1 grep "$@" readonly $(pwd) sed | ${HOME}
+		cd ${HOME} then x=1 'quoted text'
+	printf x=1 --verbose $(pwd) | echo then grep -eu echo "$@" &&
+done printf echo -eu grep grep x=1 ${HOME} $(pwd) test /usr/bin $(pwd) then "$@"
+	printf done test 2>/dev/null readonly readonly /usr/bin cd -eu test /usr/bin
+		2>/dev/null "$@" x=1 echo "$1" --verbose
+		&& then 2>/dev/null 'quoted text' echo sed export export x=1 printf
+2>/dev/null echo | ${HOME} echo "$@" x=1 -eu
+cd | /usr/bin | then awk printf export
+	&& cd local then --verbose "$1" "$1" 2>/dev/null printf then
+then then export /usr/bin test 2>/dev/null done
+cd printf grep -eu --verbose sed test readonly -eu ${HOME} local awk "$1"
+	printf "$1" "$1" "$1" printf && awk ${HOME} cd "$@" done | "$@" 2>/dev/null x=1
+		readonly cd local "$1" printf
+printf && --verbose x=1 echo then -eu | 'quoted text' $(pwd)
+	x=1 'quoted text' $(pwd) echo then
+cd export readonly 2>/dev/null -eu printf 'quoted text'
+		done done --verbose readonly awk done --verbose 2>/dev/null "$1" grep
+		local && then sed awk --verbose grep &&
+		grep -eu /usr/bin "$1" sed readonly cd cd
+"$@" sed awk grep /usr/bin --verbose | echo "$@" "$1" test 'quoted text'
+		'quoted text' 'quoted text'
+		sed then awk grep && local 'quoted text'
+		"$@" cd readonly echo printf --verbose then printf then awk
+	sed | test done --verbose echo && -eu --verbose
+	cd awk "$1" ${HOME} printf | test echo sed 2>/dev/null
+readonly export test echo && x=1 "$@" sed cd "$@" export sed 'quoted text'
+	printf /usr/bin && x=1 sed -eu done printf && export
+	--verbose 2>/dev/null 'quoted text'
+x=1 export export sed sed ${HOME} /usr/bin /usr/bin && "$1"
+	${HOME} done sed done --verbose $(pwd) 2>/dev/null readonly cd done "$@" cd
+	$(pwd) | sed grep printf cd $(pwd) /usr/bin 2>/dev/null local
+		$(pwd) cd export "$@" sed /usr/bin printf
+	echo test 'quoted text'
+		"$@" ${HOME} x=1 then 2>/dev/null $(pwd) | printf ${HOME}
+		printf | 'quoted text' export /usr/bin /usr/bin 2>/dev/null
+"$1" test sed -eu $(pwd) 'quoted text' local /usr/bin local readonly -eu test
+printf readonly $(pwd) test export $(pwd)
+	awk && 'quoted text' -eu cd $(pwd) $(pwd) x=1 $(pwd) $(pwd)
+	/usr/bin -eu | sed export ${HOME} test 2>/dev/null test "$1" printf x=1 done echo
+	"$1" $(pwd) local export
+	printf /usr/bin export "$1" done sed test "$1" "$@" done x=1 printf
+		echo -eu then sed printf 'quoted text' 2>/dev/null awk export
+	"$@" 'quoted text' readonly x=1
+"$@" then sed readonly grep /usr/bin readonly 2>/dev/null awk | ${HOME} printf
+awk $(pwd) --verbose /usr/bin -eu "$1" x=1 $(pwd)
+"$@" ${HOME} test test
+then --verbose done /usr/bin printf sed echo 2>/dev/null ${HOME} then 'quoted text'
+	then awk done | sed echo done awk readonly grep cd x=1
+		cd readonly 'quoted text' $(pwd) echo "$1" readonly 2>/dev/null
+${HOME} export 'quoted text' cd | cd && grep awk sed 'quoted text'
+cd grep sed then done
+	&& printf readonly done test printf
+	export | export -eu 2>/dev/null x=1 -eu
+grep awk cd --verbose x=1 grep && awk awk readonly sed cd 'quoted text' cd | grep
+	--verbose $(pwd) then 'quoted text' printf
+	'quoted text' cd "$1" -eu /usr/bin
+		readonly readonly && "$@" done grep 'quoted text' --verbose x=1 "$@" 'quoted text'
+		-eu --verbose $(pwd) readonly ${HOME} --verbose sed local 'quoted text' "$@"
+	$(pwd) --verbose -eu "$1" $(pwd) export echo echo grep -eu
+	| ${HOME} && 2>/dev/null && "$@" done "$1" -eu cd 2>/dev/null
+test 2>/dev/null && then x=1 export printf 2>/dev/null done
+	local export test $(pwd) "$@" then awk
+	awk "$1" grep "$1" sed | done && /usr/bin -eu x=1 --verbose
+		sed | printf 2>/dev/null 'quoted text' ${HOME} |
+		cd echo then "$@" /usr/bin awk local local then ${HOME} readonly | "$1"
+done readonly grep export "$@" local export --verbose "$1" cd 2>/dev/null
+	grep ${HOME} done && ${HOME} sed then sed printf "$@" && x=1
+readonly $(pwd) echo echo 2>/dev/null readonly --verbose $(pwd) -eu
+	$(pwd) -eu cd /usr/bin sed --verbose export sed "$@" echo && 'quoted text'
+	/usr/bin && x=1 sed x=1 --verbose grep /usr/bin x=1
+"$@" echo --verbose sed printf local && 2>/dev/null cd then | cd then -eu x=1
+		awk readonly local then && --verbose printf then local /usr/bin 2>/dev/null
+	awk ${HOME} done cd 2>/dev/null "$1" -eu
+${HOME} 2>/dev/null sed awk ${HOME} cd -eu cd done
+x=1 then done sed $(pwd) awk ${HOME} "$1" printf
+		/usr/bin echo awk local --verbose 'quoted text' x=1 sed sed export then "$1"
+		x=1 echo sed /usr/bin ${HOME} readonly then 2>/dev/null $(pwd) export
+-eu "$@" export -eu | $(pwd) sed readonly local
+		cd 'quoted text' ${HOME} echo 2>/dev/null && awk readonly "$@" 'quoted text'
+	then | echo $(pwd) echo
+	/usr/bin x=1 "$@" | --verbose 2>/dev/null export
+		cd x=1 $(pwd) && readonly ${HOME} sed printf then
+		local readonly -eu /usr/bin
+	| grep "$@" done $(pwd) printf 'quoted text' ${HOME} grep local test /usr/bin
+	export cd awk -eu --verbose done export | test
+		grep | then sed readonly sed then echo | --verbose
+		2>/dev/null export -eu "$1" grep
+		$(pwd) cd 2>/dev/null --verbose
+echo | -eu awk export printf sed 2>/dev/null echo && x=1 done
+		export 'quoted text' 'quoted text'
+	"$1" grep /usr/bin 'quoted text' test $(pwd) $(pwd) sed "$@" ${HOME}
+		done -eu printf -eu /usr/bin test local local grep readonly
+cd "$1" x=1 echo sed -eu 2>/dev/null 2>/dev/null
+	${HOME} 2>/dev/null printf 2>/dev/null
+		| "$@" export test readonly -eu -eu printf ${HOME} ${HOME}
+		x=1 | --verbose "$1" then x=1
+| cd /usr/bin --verbose local local readonly
+x=1 readonly grep --verbose printf x=1 then test
+"$@" echo printf sed 'quoted text' | done "$@" local 'quoted text' then
+readonly "$@" x=1 && then cd && readonly printf $(pwd) -eu done
+		$(pwd) "$1" export sed printf readonly grep -eu 'quoted text'
+		$(pwd) then awk --verbose test local 'quoted text'
+		x=1 --verbose test | 2>/dev/null ${HOME}
+		/usr/bin echo export export "$@" local "$@" done "$1" awk sed grep
+	grep cd -eu test awk /usr/bin echo x=1 sed then export "$1" then $(pwd) "$@"
+		then grep sed readonly $(pwd) then readonly --verbose grep |
+		--verbose cd readonly then test echo "$1" x=1 readonly
+		sed grep echo echo done sed 2>/dev/null x=1 $(pwd) --verbose
+	--verbose sed "$1" 'quoted text' cd "$@" &&
+		grep local export "$@" echo x=1 export readonly --verbose awk test
+local local printf /usr/bin echo --verbose then 2>/dev/null
+"$1" x=1 then done --verbose /usr/bin 'quoted text' "$@" readonly "$@" |
+cd ${HOME} /usr/bin local export test --verbose 2>/dev/null
+	| grep | "$1" 2>/dev/null local local --verbose $(pwd) then awk export cd --verbose
+&& printf done test local awk && export
+	$(pwd) printf grep -eu sed cd 'quoted text' echo local readonly
+2>/dev/null sed echo local echo 'quoted text'
+		&& --verbose sed export readonly x=1 test
+	$(pwd) test printf ${HOME} grep done --verbose /usr/bin cd grep | ${HOME} cd -eu
+		/usr/bin -eu grep | sed local then then && export
+done x=1 "$@" local 2>/dev/null | done cd 'quoted text'
+	--verbose cd awk grep awk x=1 /usr/bin cd
+		echo export test grep x=1 then echo --verbose readonly local
+		| echo then printf /usr/bin
+	${HOME} done done grep cd ${HOME} echo /usr/bin echo echo "$1" readonly test
+printf readonly --verbose echo /usr/bin local ${HOME}
+		then 'quoted text' x=1 then
+	"$@" "$@" --verbose sed sed
+"$@" 'quoted text' /usr/bin readonly ${HOME}
+	--verbose x=1 $(pwd) grep
+	test x=1 awk awk awk printf cd grep cd | local
+| "$@" "$1" sed readonly 'quoted text' $(pwd) "$1" cd && ${HOME} grep |
+	'quoted text' grep ${HOME}
+grep /usr/bin "$1" readonly /usr/bin
+		readonly local 2>/dev/null && $(pwd) grep $(pwd)
+	cd /usr/bin echo $(pwd) x=1 test readonly sed
+	local export cd test | "$1" 'quoted text'
+${HOME} export 'quoted text' /usr/bin test
+echo echo ${HOME} 'quoted text' echo -eu cd readonly x=1 ${HOME} awk "$1" "$1"
+		readonly $(pwd) then | cd sed awk $(pwd) "$@" local /usr/bin local
+done ${HOME} printf 2>/dev/null
+${HOME} 2>/dev/null done "$@"
+	--verbose awk x=1 "$1" awk cd
+grep printf test test echo "$1" 2>/dev/null awk
+export $(pwd) | ${HOME} 'quoted text' 'quoted text'
+		done && sed 'quoted text' 2>/dev/null ${HOME} --verbose $(pwd) 2>/dev/null export
+		${HOME} local awk 'quoted text'
+	"$@" test | 2>/dev/null printf x=1 2>/dev/null -eu ${HOME}
+	"$@" done export "$1" done --verbose local x=1 cd "$@" /usr/bin
+	"$1" local local awk 'quoted text' 'quoted text' awk $(pwd) -eu
+	2>/dev/null echo local sed
+		${HOME} | done test test $(pwd) echo x=1 then awk x=1
+	echo test readonly x=1 /usr/bin grep sed "$1" sed "$1" "$@"
+		| x=1 "$@" sed | then ${HOME}
+		--verbose done awk 2>/dev/null 2>/dev/null
+done /usr/bin && | readonly --verbose
+	"$@" /usr/bin 'quoted text' cd local
+		-eu printf readonly $(pwd) cd "$@" test ${HOME} && sed printf
+	local $(pwd) x=1 cd export grep ${HOME} grep x=1 sed 'quoted text'
+x=1 --verbose grep ${HOME} $(pwd)
+2>/dev/null ${HOME} echo test
+		| -eu 'quoted text' "$@" -eu ${HOME}
+&& export -eu cd grep then
+		"$1" --verbose && --verbose x=1 done && /usr/bin local readonly
+${HOME} "$1" --verbose
+		readonly done then x=1 | && -eu export
+	-eu then done awk printf /usr/bin awk sed "$@" "$@" && then readonly export
+		&& readonly | x=1 printf 2>/dev/null awk /usr/bin
+export -eu sed local test 'quoted text'
+		readonly then 'quoted text' && "$1" test done export -eu && echo printf grep local
+sed awk --verbose "$@" export cd | -eu 2>/dev/null test
+2>/dev/null then 2>/dev/null ${HOME} "$1" grep sed --verbose 2>/dev/null
+"$@" readonly "$1" ${HOME} x=1 2>/dev/null grep
+	"$@" x=1 "$@" -eu printf local awk
+	"$@" $(pwd) x=1 cd awk "$1" export 2>/dev/null &&
+		$(pwd) export && x=1 done
+2>/dev/null --verbose "$1"
+	"$@" ${HOME} --verbose readonly readonly "$1" sed printf 2>/dev/null x=1
+${HOME} cd awk 2>/dev/null then local 'quoted text' $(pwd) sed cd ${HOME} "$1"
+awk echo "$@" grep 2>/dev/null $(pwd)
+	2>/dev/null sed "$@" 'quoted text' --verbose sed x=1 cd done -eu
+&& readonly local test "$1" then 2>/dev/null x=1 --verbose
+	export test export /usr/bin local x=1 readonly --verbose /usr/bin
+	sed 'quoted text' grep -eu x=1 sed grep --verbose "$@" "$@"
+	-eu --verbose grep printf then awk cd "$@" 2>/dev/null 2>/dev/null
+local | | 2>/dev/null test && $(pwd)
+	| 'quoted text' readonly sed $(pwd) cd grep --verbose
+	grep ${HOME} grep local readonly && | grep $(pwd) local 2>/dev/null
+x=1 "$1" echo 'quoted text' then /usr/bin -eu /usr/bin
+		printf 'quoted text' 'quoted text'
+readonly readonly /usr/bin $(pwd) local printf done cd printf grep
+awk then --verbose 'quoted text' "$1" 'quoted text' sed $(pwd) done x=1 printf
+awk export "$@" local 'quoted text' "$@"
+		${HOME} $(pwd) test 2>/dev/null -eu readonly
+-eu sed cd "$1" awk && | x=1 | done cd test && printf cd -eu awk 'quoted text'
+printf $(pwd) ${HOME} 2>/dev/null --verbose | --verbose
+		grep printf 2>/dev/null sed test --verbose test 'quoted text' grep
+		$(pwd) /usr/bin local -eu -eu && -eu 2>/dev/null
+		x=1 export 2>/dev/null "$1" echo ${HOME} "$1" sed
+readonly test echo ${HOME} awk
+	2>/dev/null grep export test
+		x=1 awk | 'quoted text' echo x=1
+"$1" 'quoted text' done
+		-eu --verbose done grep | cd test done test /usr/bin 'quoted text' x=1 --verbose
+	then "$1" $(pwd) | awk printf --verbose -eu "$@" -eu
+$(pwd) 2>/dev/null && -eu sed 'quoted text' "$1" /usr/bin ${HOME} then then
+export && grep done && printf
+		printf awk printf awk -eu printf $(pwd) --verbose $(pwd) 'quoted text' echo
+	x=1 local $(pwd) export 'quoted text' ${HOME} --verbose
+then | grep $(pwd) then grep sed -eu $(pwd) then
+		then /usr/bin | then local sed export x=1 $(pwd) cd 2>/dev/null test | awk |
+sed cd ${HOME} grep cd ${HOME} | done test local awk test
+	2>/dev/null awk ${HOME} cd test -eu | grep 'quoted text' echo printf printf
+readonly /usr/bin x=1 export | echo export /usr/bin --verbose
+| -eu ${HOME} test -eu && 2>/dev/null readonly grep 2>/dev/null done ${HOME} readonly
+grep 2>/dev/null -eu awk && "$@" --verbose test 2>/dev/null local 2>/dev/null
+local grep | "$1" /usr/bin then && | && ${HOME}
+	$(pwd) 'quoted text' echo local awk local awk done test printf awk --verbose $(pwd)
+grep sed 'quoted text' /usr/bin && ${HOME} | "$1"
+		test awk -eu echo sed
+	&& then "$@" | cd readonly --verbose $(pwd) && 'quoted text'
+	"$@" && /usr/bin 'quoted text' 2>/dev/null 'quoted text' sed grep "$@" grep
+	sed test test $(pwd) --verbose x=1 export awk
+		$(pwd) x=1 "$@" test then | grep readonly
+then awk export | done local x=1 printf grep --verbose | $(pwd)
+		test readonly 'quoted text' $(pwd) done local test test sed
+	echo "$1" $(pwd) | -eu x=1 -eu ${HOME} test "$1" then x=1 awk done "$@" 'quoted text'
+then /usr/bin "$1" local 'quoted text' "$@" export
+	done readonly --verbose export "$@"
+2>/dev/null echo 'quoted text' sed x=1 readonly
+	sed && $(pwd) echo --verbose -eu $(pwd) test printf "$@" 'quoted text'
+$(pwd) grep sed then printf echo
+		/usr/bin sed x=1 then /usr/bin && -eu 2>/dev/null ${HOME} -eu grep -eu export
+-eu test then then -eu test echo printf readonly sed grep export | --verbose
+		test 2>/dev/null export 'quoted text' --verbose
+/usr/bin echo local then printf ${HOME} "$1" ${HOME} then && grep -eu grep
+local 2>/dev/null echo
+		awk echo --verbose printf awk local
+		/usr/bin sed 2>/dev/null 2>/dev/null
+		x=1 readonly 2>/dev/null ${HOME} -eu readonly cd -eu x=1 | 'quoted text' ${HOME}
+		sed sed awk --verbose printf readonly
+		then --verbose | test $(pwd) ${HOME} | readonly && awk "$@"
+	/usr/bin | /usr/bin 2>/dev/null 2>/dev/null sed "$@" echo local 2>/dev/null x=1
+	sed 'quoted text' && grep then | $(pwd) test sed $(pwd) $(pwd) "$@"
+		-eu -eu "$1" x=1 $(pwd) /usr/bin
+	cd "$@" $(pwd) 'quoted text' echo 'quoted text'
+	done cd test 'quoted text' echo 2>/dev/null $(pwd)
+		echo x=1 done readonly /usr/bin x=1 cd readonly ${HOME}
+		local "$1" sed local echo
+	2>/dev/null echo $(pwd) awk echo local awk
+	cd --verbose echo /usr/bin &&
+		&& then | cd 2>/dev/null awk x=1 then local sed
+	cd echo | "$@" "$1" done
+	| && --verbose readonly sed 2>/dev/null 'quoted text'
+awk --verbose -eu 2>/dev/null
+		"$1" /usr/bin 2>/dev/null awk echo sed local ${HOME} printf sed
+	then sed local printf /usr/bin && printf
+	-eu -eu sed done "$@" readonly grep done 2>/dev/null $(pwd) "$@"
+	printf "$1" test echo readonly awk printf cd && readonly
+	'quoted text' 'quoted text' cd /usr/bin export $(pwd) printf "$1" printf then
+		readonly "$@" x=1 'quoted text' awk export then test --verbose
+"$@" --verbose awk then done -eu then 2>/dev/null printf done "$@" local sed
+		grep "$@" echo printf
+$(pwd) local grep readonly then test done echo export grep done 2>/dev/null
+'quoted text' | 'quoted text' ${HOME} 2>/dev/null /usr/bin "$1" local
+	/usr/bin sed 'quoted text' grep ${HOME} x=1 "$1" "$@" echo sed
+&& -eu "$@" && awk export then
+	export "$1" && awk awk sed export awk && then $(pwd) readonly readonly test cd "$@"
+		test $(pwd) 2>/dev/null awk readonly done cd "$@" x=1 export printf && local
+		echo awk "$1" export sed local "$1" $(pwd) --verbose && cd "$@"
+	readonly awk awk test ${HOME} cd echo -eu local "$1" $(pwd) x=1 ${HOME} x=1
+		/usr/bin -eu x=1 "$1" "$@" readonly test
+export /usr/bin 'quoted text'
+		'quoted text' export cd sed awk 'quoted text'
+$(pwd) export echo awk export then -eu cd sed then && 2>/dev/null
+$(pwd) "$1" export -eu local 'quoted text' ${HOME}
+		done printf then done test then sed && ${HOME} x=1 "$@"
+printf export export | 2>/dev/null --verbose "$1" echo x=1 printf awk
+local /usr/bin "$@" && --verbose &&
+${HOME} test -eu test readonly ${HOME}
+cd ${HOME} 'quoted text' | sed 2>/dev/null
+readonly "$1" sed "$@" echo echo
+"$1" export 'quoted text'
+		2>/dev/null | && $(pwd) awk -eu -eu &&
+	2>/dev/null cd done "$@" --verbose --verbose readonly $(pwd)
+	echo then export readonly "$@" /usr/bin grep ${HOME} grep 'quoted text' export
+		'quoted text' printf $(pwd) sed done test test && echo
+grep sed | "$@" 2>/dev/null echo && && -eu -eu "$@" --verbose cd readonly
+	2>/dev/null export x=1 readonly -eu sed 2>/dev/null --verbose
+	cd then $(pwd) readonly /usr/bin test && /usr/bin 2>/dev/null --verbose ${HOME}
+	grep "$@" sed 'quoted text' then $(pwd) export
+		then x=1 "$1" done export $(pwd)
+		printf "$1" $(pwd) sed | 'quoted text' $(pwd) x=1 local "$@" ${HOME} then readonly
+	awk x=1 "$@" test sed local | cd echo awk export test -eu
+"$@" export "$1" --verbose x=1 "$1" $(pwd) cd $(pwd)
+	awk x=1 awk cd -eu done ${HOME} sed 2>/dev/null /usr/bin
+"$@" $(pwd) local && "$1" /usr/bin 2>/dev/null | echo --verbose | -eu done
+		grep printf local --verbose 'quoted text' readonly
+		2>/dev/null done ${HOME} awk then local grep
+		sed | | 2>/dev/null | printf "$1" printf 'quoted text'
+/usr/bin echo $(pwd) sed then echo test -eu
+		test sed | then grep 2>/dev/null awk
+/usr/bin sed ${HOME} cd echo printf |
+		then ${HOME} 'quoted text' 'quoted text' export | echo
+	echo done | "$1" done x=1 2>/dev/null x=1 $(pwd) cd printf printf
+	awk echo done local -eu "$1"
+	cd "$@" ${HOME} | ${HOME} | | ${HOME} sed x=1 2>/dev/null
+		then sed 'quoted text' | awk cd readonly && x=1 cd | cd local
+	&& x=1 "$1" && 2>/dev/null
+		done readonly --verbose $(pwd) awk 'quoted text' --verbose "$@" /usr/bin
+		&& echo ${HOME} "$1" | printf
+		x=1 grep printf done | 2>/dev/null /usr/bin
+readonly "$@" echo test awk --verbose cd done $(pwd) 2>/dev/null echo printf &&
+	export x=1 awk 2>/dev/null awk local 'quoted text' grep export /usr/bin "$@" ${HOME}
+	sed 2>/dev/null grep echo awk 2>/dev/null 2>/dev/null -eu && 2>/dev/null
+		&& grep printf -eu x=1 sed /usr/bin 2>/dev/null "$1" /usr/bin |
+		&& done /usr/bin done 'quoted text' grep 2>/dev/null 2>/dev/null test awk test
+	sed echo $(pwd) ${HOME} echo
+		cd "$1" ${HOME} x=1 readonly cd && | test local "$1" "$1" local done ${HOME} &&
+"$1" awk 2>/dev/null awk grep $(pwd) /usr/bin "$@" /usr/bin
+	${HOME} "$1" awk 2>/dev/null printf
+		2>/dev/null -eu done x=1 "$1" printf /usr/bin readonly /usr/bin
+	export /usr/bin /usr/bin printf
+		sed "$1" echo | then && 2>/dev/null && printf && export --verbose
+		then 2>/dev/null echo export readonly awk | --verbose cd sed echo
+	2>/dev/null printf 2>/dev/null
+$(pwd) x=1 2>/dev/null printf 'quoted text' test && $(pwd) $(pwd) --verbose /usr/bin
+printf awk local && export test grep local awk grep
+export -eu then $(pwd) 2>/dev/null -eu cd test echo
+	awk local "$@" export done export done awk done $(pwd) test
+		export "$1" local --verbose 'quoted text' $(pwd)
+		cd /usr/bin then --verbose
+	echo test grep "$1" ${HOME}
+2>/dev/null readonly "$@" "$@" x=1 sed echo readonly
+	'quoted text' test $(pwd) local -eu 2>/dev/null test printf && sed $(pwd) done
+	-eu --verbose /usr/bin cd /usr/bin echo awk
+		"$@" export -eu readonly 2>/dev/null "$@" cd
+		x=1 done awk test grep echo | awk
+		readonly grep test ${HOME} export done readonly test test cd --verbose
+--verbose awk 2>/dev/null -eu "$1" local x=1 -eu x=1 'quoted text'
+	test 'quoted text' -eu local echo "$1" then done echo awk "$1" cd readonly
+		local awk echo $(pwd) ${HOME} readonly sed -eu sed
+		awk "$@" --verbose "$1" x=1 'quoted text' export -eu grep test
+"$1" test grep 'quoted text' readonly
+	export awk done then printf /usr/bin $(pwd) cd then echo && done
+&& | | printf cd x=1 x=1 x=1 ${HOME}
+done printf /usr/bin printf export readonly grep readonly
+		-eu printf --verbose --verbose sed readonly echo
+'quoted text' x=1 "$1" | sed grep awk printf
+	printf export then /usr/bin 'quoted text'
+	"$1" | cd "$1" $(pwd) cd sed 'quoted text' printf ${HOME} 'quoted text'
+	x=1 grep echo readonly printf
+		grep -eu sed printf test printf grep
+		&& "$@" "$1" readonly test readonly
+	x=1 then echo /usr/bin "$1" printf export awk printf
+		'quoted text' printf 2>/dev/null "$1" $(pwd) ${HOME}
+	readonly cd --verbose echo 'quoted text' test && -eu sed export ${HOME} grep
+&& /usr/bin 2>/dev/null "$@" "$@"
+		${HOME} awk grep $(pwd) /usr/bin $(pwd) 'quoted text' "$@" && x=1 /usr/bin echo
+	readonly x=1 | | readonly $(pwd) /usr/bin sed done 'quoted text'
+		| then readonly "$@" $(pwd) | | "$@" cd 2>/dev/null -eu "$@" done x=1 ${HOME}
+| $(pwd) echo | cd "$@" x=1 test /usr/bin x=1 local | sed && done local done
+	"$@" ${HOME} done echo $(pwd) cd readonly 2>/dev/null awk then echo
+	done "$@" cd local && "$1" "$1" 'quoted text' x=1 "$@" then
+${HOME} 2>/dev/null then $(pwd) --verbose export 2>/dev/null ${HOME}
+	"$1" cd "$@" export ${HOME} test "$1" 'quoted text' then && x=1 x=1 | /usr/bin
+		export readonly done --verbose
+local awk done awk grep done x=1
+	test awk test && then echo -eu && "$@" 'quoted text' awk sed printf awk echo
+then local && x=1 'quoted text' done "$1" 'quoted text' test
+"$1" readonly awk test /usr/bin printf test -eu test test "$1" grep sed echo
+sed cd && then cd && cd done "$@" awk done $(pwd) readonly
+		sed sed && readonly test --verbose
+$(pwd) && sed x=1 /usr/bin "$@" grep cd $(pwd) 2>/dev/null
+'quoted text' | 2>/dev/null grep ${HOME} x=1 "$1" echo | readonly
+	local "$1" "$@" done printf
+	local --verbose local
+printf | echo --verbose && export grep local test 2>/dev/null "$@" | --verbose
+	"$1" && -eu done | grep ${HOME} done sed "$@" | printf
+	readonly && "$1" cd printf sed | sed 2>/dev/null 'quoted text'
+	export --verbose printf 'quoted text' /usr/bin 'quoted text'
+		readonly awk readonly test ${HOME} "$1"
+		printf 2>/dev/null x=1 "$1" --verbose export x=1 2>/dev/null
+	-eu "$1" done awk echo done ${HOME} "$@"
+test awk printf /usr/bin printf test
+		export grep $(pwd) echo done /usr/bin x=1 && cd
+	"$1" /usr/bin grep x=1 done sed
+		"$@" | then | cd --verbose $(pwd) readonly readonly /usr/bin
+		export printf export /usr/bin && done echo printf printf /usr/bin && $(pwd) echo
+sed /usr/bin echo ${HOME} ${HOME} grep sed sed | export $(pwd) test
+	'quoted text' then test export
+	printf awk && -eu local echo test --verbose sed cd echo export "$1" && readonly
+-eu /usr/bin $(pwd) /usr/bin ${HOME} x=1 test export readonly
+	"$1" /usr/bin /usr/bin --verbose
+grep 'quoted text' cd then grep sed "$1" --verbose &&
+	$(pwd) | done $(pwd) done $(pwd)
+	"$1" grep awk sed sed /usr/bin awk && "$@" "$1" printf
+| export --verbose "$@"
+	x=1 local then "$1" printf 2>/dev/null done "$@" $(pwd)
+x=1 readonly && export test done -eu -eu $(pwd) 'quoted text' cd | echo "$@" sed
+	sed --verbose awk printf $(pwd) grep ${HOME} "$1" && echo readonly readonly "$@"
+	&& $(pwd) "$1" done x=1 2>/dev/null export --verbose
+	awk echo cd cd cd "$@" readonly 2>/dev/null cd
+grep ${HOME} x=1 $(pwd) -eu printf cd |
+		echo 'quoted text' then test sed cd | done echo | ${HOME}
+printf test echo awk /usr/bin test local done 2>/dev/null test done printf
+| printf -eu x=1 sed readonly $(pwd) "$1" sed 2>/dev/null "$@" "$@" $(pwd)
+		| sed grep readonly printf 'quoted text' export --verbose -eu --verbose
+	-eu grep ${HOME} -eu grep /usr/bin $(pwd) then $(pwd) "$@" export readonly
+	$(pwd) $(pwd) 2>/dev/null 'quoted text'
+		2>/dev/null done --verbose done echo local then
+	readonly $(pwd) export then
+test readonly grep local
+	x=1 local && local "$1" echo awk local && --verbose local local local
+	readonly && local 2>/dev/null echo awk test /usr/bin readonly done
+2>/dev/null readonly export
+		--verbose "$1" "$@" $(pwd) && ${HOME}
+	"$@" 2>/dev/null ${HOME} grep echo cd export $(pwd)
+		| then export local ${HOME} x=1 export
+	| -eu x=1 done x=1 export /usr/bin "$@" --verbose grep | "$@"
+	test x=1 then grep /usr/bin cd | export "$@"
+		"$@" export cd cd export ${HOME} sed && "$1" echo local
+	"$1" 2>/dev/null 'quoted text' "$@" readonly "$@"
+	awk "$@" test test 'quoted text' 2>/dev/null printf /usr/bin echo --verbose
+test --verbose "$@" ${HOME} cd "$1" readonly /usr/bin | x=1 "$@"
+then grep ${HOME} test ${HOME} 2>/dev/null
+	"$@" local | cd test | "$@" local 2>/dev/null awk
+		--verbose $(pwd) -eu export grep local
+	$(pwd) "$1" test cd grep && $(pwd)
+sed $(pwd) echo -eu "$@" && awk awk test printf awk ${HOME} printf then
+		&& test $(pwd) 'quoted text' readonly test 2>/dev/null 'quoted text' --verbose
+	x=1 2>/dev/null "$@" sed sed
+	/usr/bin 2>/dev/null /usr/bin
+		then cd sed ${HOME} /usr/bin --verbose ${HOME} ${HOME} -eu | /usr/bin export
+awk export | "$@" -eu --verbose | printf printf x=1 "$@"
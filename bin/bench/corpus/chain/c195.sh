@@ -0,0 +1,2001 @@
+"$1" done export /usr/bin cd grep local --verbose $(pwd)
+'quoted text' sed 2>/dev/null $(pwd) grep x=1 | grep sed
+export 2>/dev/null awk awk grep awk 'quoted text' test done --verbose
+	$(pwd) "$@" $(pwd) awk "$@" x=1 export x=1 then printf
+echo --verbose then $(pwd) awk grep -eu echo sed test awk 'quoted text'
+readonly $(pwd) ${HOME} grep
+		awk echo then cd && $(pwd) ${HOME} awk readonly
+		local x=1 ${HOME} echo printf export echo 2>/dev/null
+	test done awk | printf awk -eu
+	echo -eu && readonly x=1 echo done grep then done grep --verbose printf 'quoted text'
+		then then -eu cd sed ${HOME} $(pwd) printf grep 2>/dev/null local 'quoted text'
+		then && export export grep readonly && test --verbose 2>/dev/null
+done ${HOME} -eu echo done
+	x=1 ${HOME} grep local readonly export cd cd then ${HOME} && |
+	export --verbose /usr/bin --verbose | cd $(pwd)
+	echo grep "$@" then $(pwd) 2>/dev/null 'quoted text' "$1" done | "$1"
+test local -eu ${HOME} "$@" done "$1" done then /usr/bin echo echo readonly
+	test /usr/bin export echo 'quoted text'
+	--verbose ${HOME} "$1" cd $(pwd) done readonly /usr/bin done 'quoted text'
+		/usr/bin "$1" printf -eu --verbose export x=1
+local echo readonly ${HOME} awk x=1 $(pwd) /usr/bin &&
+	test test 'quoted text' export
+		${HOME} "$1" export then test done printf --verbose
+		readonly echo 'quoted text' --verbose -eu x=1
+x=1 sed "$@" readonly grep && ${HOME} then test -eu echo echo -eu grep sed then
+		${HOME} -eu local grep sed "$1" /usr/bin "$@" "$@" readonly && -eu | /usr/bin
+--verbose readonly readonly "$@" sed /usr/bin export cd awk
+	then done $(pwd) -eu cd 2>/dev/null done readonly
+		cd cd then && 'quoted text' readonly sed grep test && export "$@"
+2>/dev/null ${HOME} readonly grep printf "$1"
+${HOME} --verbose then $(pwd) 'quoted text' local 2>/dev/null printf "$1" local
+sed x=1 2>/dev/null then awk
+test done -eu grep sed
+	'quoted text' --verbose export
+		readonly readonly ${HOME} then test sed readonly --verbose grep then echo
+local readonly | sed printf then done grep echo /usr/bin local "$1"
+sed --verbose | /usr/bin sed $(pwd) grep echo 'quoted text' test ${HOME}
+x=1 export --verbose local printf
+	then $(pwd) test printf && && export grep x=1 2>/dev/null 2>/dev/null grep --verbose
+-eu "$1" $(pwd) --verbose 'quoted text' then -eu /usr/bin then
+	awk sed awk "$1" readonly cd ${HOME} "$@" grep
+--verbose done test 'quoted text'
+		--verbose local "$@" "$1" $(pwd) 'quoted text'
+"$1" grep /usr/bin --verbose done echo $(pwd) readonly sed awk printf 2>/dev/null
+x=1 x=1 grep $(pwd) "$@" test
+	then && "$1" | cd && x=1
+then /usr/bin export && echo -eu
+	${HOME} 'quoted text' local --verbose test /usr/bin /usr/bin
+	cd printf then 2>/dev/null cd $(pwd) cd $(pwd) test --verbose
+echo printf printf 'quoted text'
+		readonly "$1" --verbose
+		cd then then "$@" --verbose 2>/dev/null | 'quoted text'
+'quoted text' /usr/bin
+		x=1 'quoted text' export echo done echo echo sed then export readonly
+		${HOME} ${HOME} $(pwd) ${HOME} x=1 x=1 ${HOME} printf export done &&
+--verbose readonly awk ${HOME}
+${HOME} echo /usr/bin /usr/bin "$@" x=1 "$1" awk then sed ${HOME} x=1
+		sed x=1 ${HOME} $(pwd) x=1 -eu grep sed awk local $(pwd) "$1" export
+/usr/bin awk test grep done local readonly /usr/bin export printf local --verbose
+	done echo | $(pwd) sed export printf awk "$@" 'quoted text'
+/usr/bin export echo local awk
+	echo | ${HOME} --verbose /usr/bin
+	x=1 cd $(pwd) 2>/dev/null | 2>/dev/null
+		x=1 --verbose printf /usr/bin --verbose
+$(pwd) then 2>/dev/null
+	local && sed readonly $(pwd) done cd 'quoted text'
+grep local && && cd && done then echo then local /usr/bin
+"$@" grep x=1 | awk "$@"
+	cd && readonly grep cd cd $(pwd) "$@" grep readonly printf
+	--verbose grep test test x=1 sed then | 2>/dev/null
+	then x=1 'quoted text' echo done
+	"$1" local test 2>/dev/null done && sed local && echo $(pwd) printf
+		-eu echo && test x=1 cd awk 'quoted text' 'quoted text' $(pwd)
+		| printf "$1" cd done -eu then awk "$@" "$1" done
+		test awk x=1 printf "$@" 'quoted text' then /usr/bin
+done 'quoted text' x=1 echo && done sed 2>/dev/null 2>/dev/null "$1" x=1 echo
+		${HOME} 2>/dev/null test echo
+x=1 2>/dev/null echo readonly $(pwd) test
+"$1" echo -eu local -eu -eu echo x=1 sed awk -eu --verbose echo $(pwd) cd sed
+		export ${HOME} -eu "$1" printf 2>/dev/null && -eu "$@" done test -eu 'quoted text'
+then then grep | then local 'quoted text'
+	x=1 awk /usr/bin ${HOME} /usr/bin 'quoted text'
+		"$1" done local --verbose $(pwd) then then sed 'quoted text' ${HOME} export
+	done | 'quoted text' printf grep test "$@" local done -eu $(pwd) sed "$@"
+	then --verbose ${HOME} /usr/bin sed awk | x=1 /usr/bin && then
+test then grep 2>/dev/null "$1" export
+		-eu 2>/dev/null grep printf "$@" sed x=1 -eu grep done export 2>/dev/null
+	test -eu echo cd "$1" 'quoted text' grep awk sed 2>/dev/null
+&& x=1 ${HOME} "$1" grep --verbose then |
+	/usr/bin awk -eu x=1 local local $(pwd) cd echo
+	local grep echo then sed -eu test && 'quoted text'
+		${HOME} test | cd grep printf echo local test $(pwd) 'quoted text' printf test -eu
+--verbose x=1 "$1" cd x=1 ${HOME}
+	"$1" 2>/dev/null | cd --verbose --verbose test printf
+${HOME} --verbose printf grep done && $(pwd)
+printf sed readonly ${HOME} "$1" |
+printf grep x=1 x=1 echo x=1 -eu echo && done cd export | &&
+	echo 2>/dev/null "$1" awk sed printf done 2>/dev/null
+x=1 printf test done printf -eu
+		cd $(pwd) 2>/dev/null echo awk $(pwd) && && done 2>/dev/null echo
+sed && local test --verbose /usr/bin
+	local printf grep | -eu sed local $(pwd)
+printf local printf "$1"
+	${HOME} /usr/bin export done test x=1 done "$@"
+		done -eu echo echo -eu ${HOME} export export
+		done done | cd 2>/dev/null then $(pwd)
+2>/dev/null awk x=1 cd "$@" x=1 x=1
+${HOME} x=1 export readonly grep && cd sed -eu ${HOME}
+		done grep 2>/dev/null --verbose test printf
+		/usr/bin && done ${HOME}
+printf "$@" readonly -eu --verbose then && cd | cd echo
+		then 2>/dev/null $(pwd) cd /usr/bin -eu $(pwd) --verbose | -eu --verbose
+	/usr/bin 2>/dev/null x=1 $(pwd) readonly -eu export cd test
+&& echo x=1 "$1" grep $(pwd) echo
+	printf cd export test printf export
+then ${HOME} --verbose -eu readonly readonly then echo -eu -eu --verbose
+	sed | && "$@" && printf awk "$@" export | && --verbose awk awk /usr/bin
+x=1 local "$@" export sed && -eu echo $(pwd) printf awk done local x=1
+	2>/dev/null grep "$@" && then export
+--verbose readonly export 'quoted text' sed cd printf grep "$1" echo
+		-eu awk printf ${HOME} grep readonly export local local && 2>/dev/null "$1"
+	export export cd awk done
+${HOME} -eu echo readonly printf export --verbose
+'quoted text' 2>/dev/null printf 'quoted text'
+echo grep --verbose test -eu && readonly
+x=1 "$1" local && test readonly printf then local ${HOME}
+	printf grep echo local then -eu "$1" --verbose cd --verbose readonly sed x=1 x=1
+local grep cd --verbose &&
+		echo "$1" /usr/bin ${HOME} then printf --verbose grep --verbose
+		--verbose "$@" -eu export 'quoted text' grep $(pwd)
+--verbose sed printf | test ${HOME} cd printf grep then cd readonly $(pwd)
+then 2>/dev/null && readonly readonly ${HOME} "$1" printf /usr/bin echo
+cd /usr/bin awk ${HOME} printf
+readonly sed | 'quoted text'
+	"$@" "$@" && then x=1 echo then sed grep -eu cd readonly
+-eu grep -eu echo test "$@" local 2>/dev/null readonly "$1" export
+	"$1" --verbose --verbose grep printf 'quoted text' done && /usr/bin 2>/dev/null
+	export | "$@" sed /usr/bin x=1 'quoted text' "$@" ${HOME}
+	"$@" echo -eu 2>/dev/null /usr/bin awk echo
+	readonly done /usr/bin /usr/bin test
+		echo 'quoted text' "$@" export && x=1
+awk echo grep local then "$@" /usr/bin
+sed $(pwd) ${HOME} printf
+'quoted text' -eu "$1" -eu x=1
+then printf "$@" awk x=1 /usr/bin export local && 'quoted text'
+		local awk && printf printf $(pwd) $(pwd) readonly export printf x=1 --verbose
+then "$@" 'quoted text' sed
+echo readonly ${HOME} | readonly | "$@" sed then
+		echo "$@" then x=1 2>/dev/null
+-eu -eu 'quoted text' $(pwd) /usr/bin export test local sed x=1
+		/usr/bin 2>/dev/null x=1 printf then && /usr/bin
+		"$@" ${HOME} grep printf -eu export $(pwd) && /usr/bin x=1 done $(pwd) grep x=1
+		export export | "$1" then /usr/bin local sed 'quoted text' | cd test export
+		x=1 "$1" then 2>/dev/null 2>/dev/null local "$1" ${HOME} done printf
+then $(pwd) --verbose sed "$1" -eu 'quoted text' "$@"
+	local export | export $(pwd) -eu | cd awk | cd sed && | readonly
+		export 'quoted text' cd printf && "$@"
+	| awk printf /usr/bin /usr/bin ${HOME} printf -eu local -eu export printf
+		export test awk local then "$1" test "$1" "$1"
+2>/dev/null export 'quoted text' /usr/bin awk | 2>/dev/null && 2>/dev/null &&
+		2>/dev/null 'quoted text' echo &&
+		echo /usr/bin cd done sed test 'quoted text'
+		$(pwd) -eu "$@" -eu done printf && | $(pwd) | 'quoted text'
+	local then cd "$@" printf | then --verbose
+		export done "$1" -eu done 2>/dev/null "$1" /usr/bin then readonly "$1" | export
+	-eu /usr/bin grep $(pwd) /usr/bin /usr/bin test printf
+'quoted text' --verbose ${HOME} && && x=1
+	x=1 sed local | local "$@" 2>/dev/null echo done then "$1" done ${HOME}
+	"$1" && 2>/dev/null $(pwd) cd done "$@" export
+		-eu done echo | $(pwd) sed "$@" 'quoted text'
+grep then readonly "$1" readonly printf && 2>/dev/null
+		x=1 export "$@" echo grep local -eu 2>/dev/null 'quoted text'
+		/usr/bin printf --verbose "$@" cd grep readonly
+	readonly then printf "$1" x=1 test echo --verbose
+		| export --verbose x=1 awk local sed ${HOME} && awk -eu cd
+	grep grep then done export
+		"$@" ${HOME} x=1 x=1 sed test cd /usr/bin export printf && grep "$1"
+		grep readonly cd -eu readonly local test grep --verbose x=1 $(pwd)
+		cd 2>/dev/null export echo | x=1
+$(pwd) then && then export "$1" grep "$@" printf "$@" 2>/dev/null
+	awk /usr/bin "$1" export 'quoted text'
+		"$@" 2>/dev/null local --verbose readonly
+		"$1" 'quoted text' export
+"$@" export -eu awk x=1 --verbose
+x=1 readonly && cd echo -eu /usr/bin
+${HOME} echo done printf x=1 --verbose 2>/dev/null "$1" awk readonly echo then
+		"$@" | grep sed done sed --verbose
+$(pwd) -eu test ${HOME}
+| done cd export test test printf | "$@" --verbose test sed readonly readonly
+		local echo then test 'quoted text' x=1 && /usr/bin
+	-eu grep $(pwd) sed export readonly 2>/dev/null && ${HOME} test test readonly printf
+	-eu 'quoted text' readonly export local readonly
+	2>/dev/null /usr/bin printf echo x=1 sed
+awk | && ${HOME} awk sed echo readonly &&
+		| 2>/dev/null $(pwd) awk | echo
+	"$@" /usr/bin --verbose "$1" cd awk --verbose
+	--verbose printf 2>/dev/null x=1 /usr/bin readonly
+$(pwd) sed "$1" 'quoted text' done && | local 2>/dev/null
+	grep export ${HOME} sed
+		local then --verbose 2>/dev/null x=1 'quoted text'
+		--verbose "$1" cd local x=1 sed $(pwd)
+	"$1" local $(pwd) awk sed "$@" && sed "$@" | local && ${HOME} cd
+x=1 grep x=1 echo printf ${HOME} test ${HOME}
+	export 2>/dev/null $(pwd) grep sed /usr/bin x=1 local 2>/dev/null "$1"
+	/usr/bin -eu done export x=1 -eu
+		grep 'quoted text' --verbose test export 2>/dev/null --verbose grep cd --verbose
+'quoted text' grep -eu printf | sed sed awk /usr/bin 'quoted text'
+	sed | 'quoted text' cd 'quoted text' x=1 "$1" export done sed grep 'quoted text'
+${HOME} cd ${HOME} 2>/dev/null --verbose
+awk "$1" export --verbose awk grep && $(pwd)
+		--verbose 2>/dev/null x=1 | local "$@" 'quoted text' export grep
+		printf -eu 2>/dev/null "$1" --verbose then export | readonly $(pwd)
+		grep echo local echo --verbose x=1 readonly
+		2>/dev/null then /usr/bin ${HOME} | local x=1 readonly && awk then -eu
+	cd ${HOME} x=1 local test "$1" ${HOME} 'quoted text' then 'quoted text'
+		cd sed echo export $(pwd) "$@" cd "$1" $(pwd) | 2>/dev/null
+		local echo x=1 ${HOME} awk "$1" echo printf local
+		test && local sed export x=1 x=1
+		cd local cd local $(pwd) | "$@" then
+${HOME} 2>/dev/null 2>/dev/null --verbose 2>/dev/null
+done grep awk /usr/bin "$1" done
+${HOME} $(pwd) "$1" echo | then ${HOME} echo "$@" -eu && /usr/bin 2>/dev/null
+cd awk --verbose grep grep | cd && /usr/bin cd echo test --verbose
+	"$@" | ${HOME} ${HOME} /usr/bin local "$@"
+'quoted text' 'quoted text' sed 2>/dev/null printf printf
+	$(pwd) awk x=1 cd printf "$1" then -eu "$@" done done x=1 then
+printf -eu ${HOME} x=1 --verbose 2>/dev/null cd 2>/dev/null 'quoted text'
+		2>/dev/null $(pwd) readonly cd sed
+		readonly grep cd --verbose sed
+		test $(pwd) x=1 export /usr/bin done
+'quoted text' readonly readonly done
+	done test ${HOME} echo "$@" test
+then local x=1 "$@" export done 2>/dev/null /usr/bin export $(pwd)
+	&& /usr/bin export $(pwd) /usr/bin
+		readonly 2>/dev/null 2>/dev/null && local awk grep test awk echo
+		x=1 awk -eu echo $(pwd) printf -eu sed done test | test $(pwd)
+		sed readonly test echo export printf && export 2>/dev/null "$@"
+	local && 2>/dev/null $(pwd) /usr/bin "$1" | ${HOME} printf
+	--verbose "$@" readonly test test 'quoted text' grep echo && $(pwd) | /usr/bin
+		readonly cd printf 'quoted text' export --verbose
+	readonly sed "$1" local sed &&
+	test echo -eu 2>/dev/null "$1" "$@" /usr/bin grep --verbose export awk
+		readonly grep x=1 "$1" "$@" "$@" x=1 "$@"
+--verbose 'quoted text' awk "$@" && sed
+		${HOME} export readonly
+	sed "$1" sed x=1 then 2>/dev/null ${HOME} "$@" && echo $(pwd) cd
+	-eu awk "$@" 2>/dev/null "$@" ${HOME} awk -eu cd 2>/dev/null grep sed awk
+readonly "$1" $(pwd) && grep then && ${HOME} 2>/dev/null "$1" test
+		echo then -eu --verbose done readonly
+${HOME} && "$@" $(pwd) "$1" then cd then local readonly readonly
+--verbose 2>/dev/null && /usr/bin 'quoted text' then
+	/usr/bin sed ${HOME} printf
+	2>/dev/null then export -eu "$@" $(pwd) readonly 2>/dev/null cd 'quoted text'
+		/usr/bin x=1 test sed grep test --verbose && local &&
+		| && done 2>/dev/null then grep local | grep -eu /usr/bin
+'quoted text' -eu cd local "$@" echo readonly export echo
+"$@" export printf 'quoted text'
+local "$@" 2>/dev/null $(pwd) local local grep x=1 "$@"
+"$@" ${HOME} sed && readonly /usr/bin /usr/bin | awk $(pwd)
+		&& ${HOME} grep then $(pwd) test ${HOME} export | then readonly readonly ${HOME}
+	local export $(pwd) "$@" | readonly 2>/dev/null printf
+"$@" 'quoted text' | ${HOME} local --verbose echo sed cd 'quoted text' ${HOME}
+		/usr/bin local ${HOME} x=1 ${HOME}
+	cd done $(pwd) "$1" export 2>/dev/null echo sed 2>/dev/null
+	echo $(pwd) && "$1" local | sed test local x=1 echo /usr/bin
+	"$1" then | 'quoted text' $(pwd) export readonly
+/usr/bin /usr/bin done /usr/bin ${HOME} --verbose
+	sed "$@" then export && "$@" awk $(pwd)
+		| x=1 readonly /usr/bin
+done awk done --verbose done
+	-eu awk awk $(pwd) sed && then
+	local -eu grep done --verbose "$@" echo test /usr/bin --verbose readonly
+done "$1" awk | $(pwd) awk
+		printf "$1" -eu sed echo readonly awk
+2>/dev/null printf sed --verbose
+"$@" sed local grep awk readonly ${HOME} -eu && 'quoted text' awk printf
+		${HOME} 'quoted text' sed export "$1" && 'quoted text' done "$@" x=1 x=1 --verbose
+$(pwd) | then && /usr/bin test local
+	"$@" | cd done $(pwd) cd cd /usr/bin --verbose sed local -eu grep x=1
+		$(pwd) sed -eu readonly $(pwd) | -eu
+		export x=1 ${HOME} $(pwd) ${HOME} export local --verbose printf awk
+		then grep && 2>/dev/null readonly && /usr/bin /usr/bin /usr/bin
+	| cd then readonly test then -eu "$1" printf /usr/bin "$1"
+	&& test done "$1" grep | $(pwd)
+	2>/dev/null cd x=1 'quoted text' 'quoted text'
+		printf echo sed -eu --verbose sed sed x=1 -eu export --verbose
+local 2>/dev/null test /usr/bin test "$1" awk "$@" done
+	2>/dev/null 'quoted text' grep "$@" readonly -eu 'quoted text' -eu
+	/usr/bin test --verbose /usr/bin 'quoted text' "$1" printf ${HOME} -eu
+--verbose test -eu --verbose done
+	then --verbose "$@" test "$@" done /usr/bin test test export "$@"
+export readonly sed grep --verbose && sed export
+		grep grep then ${HOME} cd readonly x=1 2>/dev/null
+		${HOME} sed "$1" x=1 echo printf ${HOME} "$@" printf x=1 "$1" test printf awk
+		grep && --verbose cd echo && ${HOME} echo | then printf /usr/bin
+	&& /usr/bin $(pwd) test printf local ${HOME} readonly 'quoted text' cd --verbose
+	local && local readonly done grep -eu sed 'quoted text'
+export sed | 'quoted text' "$@" /usr/bin export then "$1" local x=1 &&
+	"$@" 'quoted text' /usr/bin echo local then -eu then
+		${HOME} export "$1" -eu -eu ${HOME} then readonly 'quoted text' then
+	${HOME} --verbose x=1 cd done then -eu awk export test
+		"$1" sed 2>/dev/null awk
+	readonly "$@" 'quoted text'
+		--verbose awk 2>/dev/null awk sed export then local echo
+| --verbose export done x=1 "$1" sed printf awk awk done sed x=1 awk -eu |
+	${HOME} --verbose 2>/dev/null ${HOME}
+cd echo done test local && sed 'quoted text'
+		sed sed test readonly x=1 "$@" awk 'quoted text' | -eu local | | /usr/bin x=1
+	cd sed "$@" sed | --verbose awk cd done then -eu test /usr/bin
+		'quoted text' 2>/dev/null 2>/dev/null
+		cd sed sed then x=1 test 2>/dev/null "$@" grep "$@" awk test echo cd done
+sed --verbose --verbose done done -eu printf
+export local ${HOME} done x=1 awk && sed local 'quoted text' "$1" $(pwd) test
+		"$@" grep export export /usr/bin test export
+		awk /usr/bin grep | 2>/dev/null "$1" export 2>/dev/null $(pwd) echo export
+	"$@" -eu x=1 printf awk 2>/dev/null done cd && sed "$1"
+		"$@" then x=1 then x=1 "$1" "$1" | echo -eu echo readonly
+	"$@" done | 'quoted text' --verbose 2>/dev/null grep readonly
+	awk then ${HOME} test test then
+	/usr/bin readonly -eu sed ${HOME} ${HOME} printf readonly 'quoted text'
+	test -eu readonly local $(pwd)
+		sed "$@" awk "$1" awk 2>/dev/null cd
+	| ${HOME} awk then echo "$@" 2>/dev/null then
+		export x=1 export &&
+		2>/dev/null done printf test printf "$@" ${HOME} --verbose awk readonly /usr/bin
+		printf --verbose ${HOME} /usr/bin printf && /usr/bin $(pwd)
+--verbose echo /usr/bin x=1 printf cd ${HOME}
+2>/dev/null "$@" --verbose -eu export readonly local
+sed grep done -eu ${HOME} export /usr/bin
+x=1 -eu export sed /usr/bin export ${HOME} local x=1 sed readonly | "$1" test /usr/bin
+		| ${HOME} awk readonly echo x=1 && done
+sed then $(pwd) cd readonly done test $(pwd) --verbose sed x=1 then | /usr/bin
+	cd --verbose echo sed && local
+		/usr/bin then readonly printf echo printf -eu
+		/usr/bin sed local echo readonly echo "$@" done --verbose done x=1
+-eu export "$1" "$1" then done sed -eu sed 'quoted text' cd ${HOME} then local |
+	then --verbose | export $(pwd) $(pwd) && $(pwd) 'quoted text'
+| sed then -eu export && then readonly x=1 'quoted text'
+	2>/dev/null /usr/bin | sed && then ${HOME}
+		&& cd cd && cd ${HOME} "$@" /usr/bin /usr/bin $(pwd) sed 'quoted text'
+		&& grep printf 2>/dev/null "$1" $(pwd) sed --verbose $(pwd)
+	grep printf ${HOME} grep test --verbose | "$1" && x=1 && sed
+export local readonly local then test cd && then awk "$@"
+	printf && 'quoted text'
+export grep 2>/dev/null local "$1" 2>/dev/null
+		then -eu grep cd grep awk
+	$(pwd) local sed --verbose
+		${HOME} /usr/bin grep -eu "$@" 2>/dev/null x=1 && sed -eu printf readonly
+		2>/dev/null echo && test | $(pwd) then $(pwd) local done x=1 ${HOME}
+-eu "$1" done test /usr/bin -eu
+	then && && printf local echo 'quoted text' -eu done then sed readonly
+export 'quoted text' --verbose test "$@" 2>/dev/null | 'quoted text'
+local echo /usr/bin | /usr/bin
+"$1" then | --verbose "$1" && printf cd grep printf "$1"
+awk grep test sed export
+-eu sed "$1" grep grep 'quoted text' echo readonly /usr/bin 'quoted text'
+	test 'quoted text' local -eu test test cd --verbose
+	2>/dev/null x=1 $(pwd) sed && x=1 printf ${HOME} ${HOME} 'quoted text' printf &&
+		test local echo grep "$1" readonly awk -eu | done && x=1 "$@" export
+	/usr/bin 'quoted text' --verbose grep
+'quoted text' readonly echo /usr/bin sed echo ${HOME} 'quoted text'
+&& 2>/dev/null x=1 ${HOME} then then test $(pwd) test grep |
+cd x=1 -eu "$1" ${HOME} 2>/dev/null /usr/bin 2>/dev/null
+		&& "$1" sed "$@" --verbose sed grep "$1" ${HOME} export test done
+		"$1" $(pwd) /usr/bin local sed echo export $(pwd) /usr/bin
+		'quoted text' local | ${HOME} local awk export "$@" $(pwd) echo
+"$@" test readonly cd &&
+		x=1 readonly $(pwd) printf sed echo /usr/bin 2>/dev/null test awk export
+cd then $(pwd) test local
+	awk printf done grep export "$@" $(pwd)
+2>/dev/null grep $(pwd)
+--verbose cd done x=1 /usr/bin 'quoted text' readonly -eu
+	readonly readonly /usr/bin | --verbose --verbose
+		printf | local $(pwd) printf readonly 2>/dev/null | 2>/dev/null done export
+done 2>/dev/null x=1 sed |
+		/usr/bin "$1" | test done local
+		'quoted text' cd 'quoted text' x=1 'quoted text' "$@" awk
+grep sed x=1 "$1" 2>/dev/null test cd done && | | then -eu local -eu -eu cd
+awk --verbose echo cd local $(pwd) echo readonly export readonly then $(pwd)
+	'quoted text' "$@" ${HOME} done ${HOME} then cd cd $(pwd) sed $(pwd) -eu
+	local /usr/bin export "$1" cd -eu --verbose
+	${HOME} sed test test then --verbose
+2>/dev/null "$1" cd /usr/bin x=1 echo "$@" awk 2>/dev/null
+		--verbose "$@" /usr/bin echo 'quoted text'
+	export printf sed /usr/bin
+	echo done $(pwd) 'quoted text' local local readonly
+		printf ${HOME} export printf awk $(pwd) --verbose echo export 2>/dev/null
+export "$@" done export --verbose 2>/dev/null export export 'quoted text' local
+'quoted text' "$1" cd | sed then local -eu test sed local readonly
+&& 2>/dev/null grep done readonly test 'quoted text'
+'quoted text' echo -eu readonly
+"$@" /usr/bin cd local $(pwd) awk export x=1 export
+	cd printf $(pwd) then echo
+echo x=1 then printf done cd
+'quoted text' printf 2>/dev/null echo -eu test export 'quoted text' x=1
+"$1" | --verbose grep ${HOME} $(pwd)
+/usr/bin -eu printf test test done
+x=1 printf --verbose test echo printf ${HOME}
+	| printf sed x=1 printf
+		cd sed | export printf | grep
+		-eu then awk readonly
+	export 'quoted text' then | && local
+	&& cd local 'quoted text' 2>/dev/null done
+cd sed grep /usr/bin local test
+	| "$@" | --verbose test $(pwd) grep done x=1
+	-eu $(pwd) printf 'quoted text'
+		test done 2>/dev/null export printf $(pwd) grep | | export sed | echo
+		printf 2>/dev/null test awk x=1 ${HOME} local printf then "$1" --verbose
+	--verbose | ${HOME} $(pwd) "$1" | -eu
+		"$@" then $(pwd) readonly grep sed x=1 | export /usr/bin "$1" grep
+readonly $(pwd) cd 'quoted text' ${HOME}
+"$1" x=1 printf 'quoted text' 'quoted text' echo awk readonly printf
+	readonly "$@" /usr/bin then ${HOME} echo awk done $(pwd) 2>/dev/null
+	cd -eu local grep then export /usr/bin readonly echo x=1 awk x=1 'quoted text'
+		done -eu --verbose /usr/bin x=1 2>/dev/null &&
+	awk x=1 local grep sed test && | sed printf
+		2>/dev/null done 'quoted text' --verbose /usr/bin --verbose
+--verbose && 2>/dev/null grep
+	readonly sed export echo --verbose sed printf done "$@" cd sed
+	--verbose && printf echo
+	"$1" "$1" printf sed sed done x=1 local
+	&& && /usr/bin then -eu &&
+done readonly sed --verbose readonly awk local echo && $(pwd) then cd export
+readonly /usr/bin cd $(pwd) printf x=1 readonly cd 'quoted text'
+	done "$1" export test x=1 echo grep then
+	then echo printf grep | readonly awk "$@" export test
+	--verbose /usr/bin "$@" echo "$@" grep echo export
+grep "$1" | | grep cd done "$1" && -eu 'quoted text' export grep local
+	&& x=1 && ${HOME} local then x=1 readonly x=1 local echo /usr/bin | local readonly
+local awk -eu $(pwd) done cd | local && then cd local awk done ${HOME} local
+		grep printf done printf 'quoted text'
+2>/dev/null ${HOME} test 'quoted text' | ${HOME} -eu /usr/bin test
+		2>/dev/null export readonly cd
+grep ${HOME} "$1" cd then then "$@" "$1" test echo test
+test 2>/dev/null --verbose 2>/dev/null "$1"
+		readonly 2>/dev/null x=1 ${HOME} && readonly x=1 --verbose
+	echo awk "$@" "$1" done
+2>/dev/null $(pwd) local "$1" grep ${HOME} "$1" done test /usr/bin
+		${HOME} readonly /usr/bin --verbose done sed 2>/dev/null | --verbose
+	/usr/bin echo && printf local echo --verbose sed x=1 printf
+-eu grep ${HOME} "$@" 2>/dev/null "$@" -eu ${HOME}
+		readonly cd && cd && "$@" done -eu then 'quoted text'
+	sed readonly done && grep local awk --verbose test awk | local then
+		sed cd done done then "$@" awk x=1 | then cd /usr/bin local then printf local
+		printf -eu local ${HOME} 2>/dev/null cd
+printf grep readonly readonly x=1 ${HOME} "$@" echo awk 'quoted text'
+	${HOME} x=1 -eu printf | local ${HOME} readonly | x=1 cd then x=1 'quoted text'
+		&& then ${HOME} sed && test x=1 'quoted text' /usr/bin /usr/bin
+		export cd done then | printf /usr/bin
+	${HOME} "$1" 'quoted text' "$1" then sed --verbose done printf cd grep
+		awk "$@" test ${HOME} "$1" test && 'quoted text' x=1 && --verbose && cd
+	-eu printf 'quoted text' then
+		"$@" | test grep printf export
+		local $(pwd) sed x=1 cd sed "$1" && /usr/bin "$1" readonly
+	/usr/bin ${HOME} "$@"
+	"$1" "$1" 'quoted text' /usr/bin sed | 2>/dev/null ${HOME} --verbose
+		readonly --verbose grep x=1 "$1"
+	then --verbose "$@" test awk awk readonly test | x=1 'quoted text'
+		"$@" awk $(pwd) --verbose
+		-eu ${HOME} printf "$@" test readonly 2>/dev/null echo | x=1 awk echo export printf
+	grep echo /usr/bin | 2>/dev/null local x=1 local
+		/usr/bin ${HOME} printf echo ${HOME}
+		readonly ${HOME} sed $(pwd)
+	local awk x=1 --verbose cd
+		printf awk done awk /usr/bin && -eu readonly 2>/dev/null "$@" x=1 cd sed ${HOME}
+	"$1" 'quoted text' export echo /usr/bin --verbose
+	grep done 2>/dev/null
+		${HOME} then echo cd x=1 awk printf sed | $(pwd) ${HOME} sed done sed "$1"
+grep && local x=1 grep | $(pwd)
+		2>/dev/null $(pwd) /usr/bin test | x=1 printf done /usr/bin /usr/bin awk printf
+	export --verbose 2>/dev/null local sed $(pwd) --verbose export
+&& 2>/dev/null done ${HOME} local local ${HOME} x=1 printf
+	--verbose | grep /usr/bin --verbose
+		&& /usr/bin "$@" test cd echo local local printf readonly
+cd grep /usr/bin then --verbose readonly
+		test && cd printf x=1 && export local --verbose ${HOME}
+"$@" && 2>/dev/null /usr/bin
+		printf && && "$1" $(pwd) x=1 done cd | echo echo -eu $(pwd) then
+	/usr/bin -eu awk printf 2>/dev/null "$1" grep | --verbose | 'quoted text'
+	"$@" $(pwd) x=1 ${HOME} /usr/bin ${HOME} awk -eu
+		2>/dev/null | "$@" -eu done && sed "$@"
+		${HOME} "$1" echo done printf grep ${HOME} --verbose export awk
+		$(pwd) done -eu awk echo printf x=1 "$1" then ${HOME} then
+		cd local printf ${HOME} && local 2>/dev/null
+	done awk --verbose done test -eu /usr/bin /usr/bin 'quoted text' "$1" 2>/dev/null
+	"$1" local ${HOME} done local readonly -eu "$@" cd sed 2>/dev/null then ${HOME}
+		2>/dev/null 2>/dev/null 'quoted text' local x=1 x=1 "$1" /usr/bin "$@" done
+	'quoted text' then awk local | ${HOME} test printf then export | "$@"
+	done awk ${HOME} x=1 export grep | awk awk grep
+	/usr/bin $(pwd) export test
+	'quoted text' grep awk 2>/dev/null local grep x=1 /usr/bin $(pwd)
+	awk grep echo local readonly
+&& 2>/dev/null | cd test sed cd export echo 2>/dev/null
+	| local && /usr/bin /usr/bin "$@" --verbose
+		-eu then -eu | $(pwd) && --verbose && -eu "$@" sed export && readonly "$@"
+test readonly | ${HOME} printf sed "$@" grep
+readonly grep && /usr/bin "$@"
+	printf sed 2>/dev/null --verbose cd /usr/bin 2>/dev/null grep |
+${HOME} export $(pwd) 2>/dev/null echo cd /usr/bin x=1 grep
+		readonly awk | printf 2>/dev/null
+		$(pwd) printf grep echo awk /usr/bin done awk x=1 && sed test test cd "$@" printf
+done "$1" && grep test export echo /usr/bin readonly -eu /usr/bin "$@" --verbose
+--verbose --verbose "$@"
+done /usr/bin cd x=1 ${HOME}
+2>/dev/null awk /usr/bin export 'quoted text' local export -eu cd 'quoted text'
+		then local sed cd then --verbose "$@" --verbose /usr/bin awk x=1 x=1
+| "$1" -eu done printf grep && x=1 local sed 'quoted text'
+		readonly "$1" "$@" 2>/dev/null then then export "$1" done readonly
+	echo cd 'quoted text' printf done | ${HOME} echo
+	'quoted text' then export -eu echo
+		echo test local local "$@" | "$1"
+		"$@" $(pwd) | readonly printf "$1" x=1 echo 'quoted text' 'quoted text'
+		grep echo $(pwd) "$1" test
+local echo && sed 2>/dev/null | local readonly done 2>/dev/null
+	test test grep done readonly "$1" $(pwd)
+| x=1 --verbose x=1 export -eu 2>/dev/null 2>/dev/null local then x=1
+		| local "$1" && local readonly awk | sed -eu cd cd x=1 $(pwd)
+		then 'quoted text' && /usr/bin awk "$@" x=1 then printf ${HOME}
+"$@" $(pwd) $(pwd) && export --verbose ${HOME} awk ${HOME} done
+done sed done "$1" "$1"
+	"$@" $(pwd) x=1 printf 'quoted text' 'quoted text' grep
+x=1 grep local --verbose $(pwd) --verbose --verbose
+	awk -eu ${HOME} -eu | echo local done local 'quoted text'
+sed grep -eu grep test grep cd
+	-eu printf x=1 readonly local done test && local "$1" --verbose
+test printf cd 'quoted text' then local x=1 sed awk $(pwd) readonly
+"$1" "$@" grep grep cd test cd sed then $(pwd) x=1 readonly -eu
+		${HOME} x=1 cd ${HOME} "$1" 2>/dev/null /usr/bin 'quoted text' awk
+	awk awk "$1" local /usr/bin -eu grep $(pwd) done test grep && 2>/dev/null
+		&& sed "$1" | grep --verbose then --verbose "$@"
+		readonly cd --verbose && sed 'quoted text'
+	readonly done "$@" test x=1 ${HOME} x=1 echo cd export
+echo then --verbose ${HOME}
+		--verbose awk readonly "$@" "$@"
+		awk $(pwd) local then 'quoted text'
+| test && export ${HOME} x=1 export && 'quoted text' printf "$1"
+	sed grep printf sed ${HOME}
+		"$1" x=1 test -eu "$@" sed grep "$@" printf readonly then
+$(pwd) awk cd sed ${HOME} printf "$@" then x=1 local ${HOME} 'quoted text' cd test
+		2>/dev/null done 'quoted text' test printf export printf awk
+${HOME} echo | --verbose sed export ${HOME} $(pwd)
+		${HOME} /usr/bin done sed ${HOME} then done
+		then | ${HOME} && local export printf readonly --verbose "$@" done ${HOME} "$1"
+awk ${HOME} test x=1 echo | /usr/bin && $(pwd) then sed grep --verbose grep &&
+cd export test export -eu grep printf done cd "$1" --verbose
+test local readonly ${HOME} /usr/bin x=1 printf echo sed
+printf x=1 $(pwd) done echo "$1" then $(pwd) local "$1" /usr/bin
+grep cd && readonly readonly 'quoted text' printf then export 'quoted text' cd
+&& then $(pwd) ${HOME} | cd then local cd && "$1" 2>/dev/null test printf 'quoted text'
+local sed "$@" ${HOME}
+	${HOME} ${HOME} cd done awk export
+		-eu /usr/bin awk "$1" | 'quoted text' echo sed && grep readonly x=1 2>/dev/null
+test grep done | export export | 'quoted text' 2>/dev/null printf
+	cd echo done | ${HOME} 'quoted text' x=1 |
+		cd test /usr/bin grep 2>/dev/null grep "$@" echo --verbose printf echo | done
+		/usr/bin cd x=1 done done done printf cd readonly sed readonly /usr/bin awk
+		done /usr/bin x=1 | | grep -eu 'quoted text' local
+	2>/dev/null printf ${HOME} done $(pwd) done -eu printf
+		'quoted text' grep x=1 export cd then awk printf
+		printf "$1" test grep cd 2>/dev/null 'quoted text' echo
+grep awk "$1" && x=1 cd sed local x=1 $(pwd) $(pwd) /usr/bin sed
+		then awk export grep sed 'quoted text'
+		x=1 $(pwd) x=1 "$@" $(pwd) 'quoted text' -eu
+		sed done awk "$1" $(pwd) then
+		x=1 && export -eu -eu /usr/bin $(pwd)
+	--verbose sed done 'quoted text' printf
+	$(pwd) x=1 | && x=1 readonly 'quoted text'
+		2>/dev/null grep export -eu 2>/dev/null
+		printf sed test --verbose export 'quoted text' | test -eu | 'quoted text' 'quoted text'
+printf test "$1" local test then then /usr/bin test printf printf
+		done done && ${HOME} "$@" awk readonly 2>/dev/null test readonly then $(pwd)
+		awk grep cd -eu x=1 local
+--verbose echo export readonly x=1 export --verbose then -eu
+	x=1 2>/dev/null sed test --verbose --verbose printf 'quoted text'
+${HOME} "$@" local echo awk | printf local --verbose 'quoted text'
+'quoted text' sed /usr/bin test cd -eu -eu 'quoted text' test "$@" -eu awk
+		'quoted text' x=1 echo local
+		test cd && local local "$@" local export sed $(pwd) | 'quoted text'
+		${HOME} "$@" /usr/bin printf $(pwd) "$1" awk --verbose cd "$1" export grep --verbose
+grep local ${HOME} local sed "$1" --verbose printf
+"$@" x=1 then grep -eu
+"$@" /usr/bin -eu && test
+| then "$1" readonly 2>/dev/null -eu
+		-eu awk printf awk then 'quoted text' 2>/dev/null
+awk ${HOME} awk $(pwd) test x=1 $(pwd) printf echo test "$1" done echo -eu
+	--verbose grep export --verbose then && ${HOME} grep done ${HOME} | --verbose
+grep 'quoted text' "$1"
+		readonly 'quoted text' sed awk "$@" grep -eu
+		echo local /usr/bin | --verbose
+2>/dev/null local printf "$@"
+		local test 2>/dev/null done then echo printf && test 'quoted text'
+2>/dev/null local "$@" ${HOME}
+		sed grep x=1 echo x=1 cd awk local cd x=1 x=1 sed 2>/dev/null
+		then 2>/dev/null readonly ${HOME} x=1 echo sed
+		done --verbose test sed readonly
+'quoted text' x=1 readonly readonly then "$1" test export export
+readonly test awk done printf
+		"$@" 'quoted text' grep /usr/bin 2>/dev/null cd 2>/dev/null export grep
+		${HOME} "$1" local | 'quoted text' awk x=1 test awk grep printf local /usr/bin
+	awk x=1 done 2>/dev/null done | /usr/bin
+	--verbose --verbose test printf 'quoted text' awk /usr/bin printf sed ${HOME}
+		printf $(pwd) $(pwd) local sed printf awk cd cd 2>/dev/null
+sed 'quoted text' | local ${HOME} cd cd echo export local "$1" "$1" $(pwd) echo
+		echo awk grep done then awk grep done then awk -eu printf then
+	echo readonly "$1" done awk x=1
+	cd done done /usr/bin 2>/dev/null "$@" x=1 echo export x=1 --verbose
+	x=1 "$1" echo local sed "$@"
+local 2>/dev/null export "$@" /usr/bin /usr/bin 'quoted text'
+		test export grep "$1" printf awk "$@"
+export awk 2>/dev/null awk 'quoted text' cd grep grep sed "$@" grep export awk test
+	cd ${HOME} readonly | echo awk echo "$@" ${HOME} grep
+	test 'quoted text' 'quoted text' cd echo | && grep sed x=1
+	${HOME} then sed --verbose local $(pwd) && "$1" 'quoted text' sed local
+echo 'quoted text' 'quoted text'
+	${HOME} x=1 grep export $(pwd) then 'quoted text' echo test
+	2>/dev/null /usr/bin 'quoted text' /usr/bin local /usr/bin
+	"$1" echo test printf echo 'quoted text' "$1" && echo printf cd | x=1 local
+		| "$1" -eu --verbose --verbose && --verbose
+		"$1" "$@" cd "$1" "$@" "$1" grep | test
+'quoted text' "$1" "$@" grep awk done
+		then $(pwd) && done then --verbose local export printf ${HOME} printf cd local
+	/usr/bin then /usr/bin sed local local $(pwd) cd -eu readonly printf
+		| readonly printf done /usr/bin ${HOME} ${HOME}
+		readonly then awk | grep /usr/bin "$@" sed
+		printf -eu -eu export cd && grep sed then 2>/dev/null 'quoted text'
+		x=1 test test readonly done "$@" && awk printf $(pwd) sed test test -eu /usr/bin
+cd --verbose ${HOME} "$@" ${HOME} local "$@" && grep 'quoted text' cd "$@" local
+		export /usr/bin | local
+${HOME} done 2>/dev/null then cd --verbose $(pwd) | done readonly
+test awk -eu -eu test local "$@" ${HOME} test -eu 2>/dev/null done $(pwd)
+		--verbose x=1 --verbose then grep export
+cd | test local "$@" done
+	x=1 && printf x=1 then readonly 'quoted text' local then local then
+		then done ${HOME} test | "$1" | "$@" $(pwd) 2>/dev/null
+	| then printf -eu local done ${HOME} && readonly then sed done
+$(pwd) 2>/dev/null cd ${HOME} -eu && grep "$1" grep | printf
+	grep --verbose $(pwd) $(pwd) test awk awk && 2>/dev/null
+		done $(pwd) --verbose export x=1 then 2>/dev/null x=1 && $(pwd)
+	-eu -eu && readonly export ${HOME}
+then "$@" local ${HOME} printf
+		$(pwd) x=1 printf sed 'quoted text' | echo grep awk /usr/bin -eu then done
+		awk test ${HOME} awk $(pwd) 'quoted text'
+		test export x=1 grep /usr/bin done 'quoted text'
+	| ${HOME} local awk cd /usr/bin "$1" printf x=1 then printf test "$1" then &&
+		then ${HOME} "$1" ${HOME} x=1 $(pwd) readonly ${HOME} x=1 && -eu
+echo --verbose x=1 ${HOME} readonly awk --verbose
+	$(pwd) 'quoted text' local cd /usr/bin x=1 sed awk printf
+		x=1 awk grep ${HOME} done | "$@" 2>/dev/null && $(pwd) 2>/dev/null
+	test | --verbose $(pwd) -eu ${HOME} 2>/dev/null then x=1 cd $(pwd)
+		${HOME} printf sed done "$@" -eu
+then 'quoted text' 2>/dev/null -eu | | local "$@" /usr/bin then grep
+2>/dev/null /usr/bin echo | then then grep cd $(pwd)
+		--verbose /usr/bin readonly
+		"$1" printf --verbose then cd test local local
+cd then export local printf printf export readonly | done awk readonly
+${HOME} done ${HOME} awk x=1 echo echo local cd local sed export $(pwd)
+	then cd then "$@" ${HOME} test x=1 sed test echo ${HOME}
+	2>/dev/null x=1 then "$@" done
+	awk $(pwd) local local export --verbose printf grep
+sed "$@" x=1 local "$1" 2>/dev/null && "$1" /usr/bin && && grep
+export export cd local readonly done printf printf -eu sed 'quoted text' test
+$(pwd) cd 2>/dev/null sed grep cd echo $(pwd) awk sed /usr/bin
+readonly local /usr/bin $(pwd) test test | --verbose cd echo local 2>/dev/null
+	local 2>/dev/null echo readonly echo awk local
+'quoted text' grep 2>/dev/null readonly && printf
+readonly local "$1" export ${HOME} readonly | test 'quoted text'
+$(pwd) ${HOME} sed local done
+		| 2>/dev/null x=1 2>/dev/null printf | printf local grep test x=1 cd sed cd
+		x=1 2>/dev/null "$@" local 'quoted text'
+	"$@" awk printf grep /usr/bin grep then x=1 'quoted text'
+	"$1" local ${HOME} 'quoted text' test grep
+		'quoted text' | "$@" readonly cd readonly sed "$@" printf 2>/dev/null sed | 2>/dev/null
+awk 2>/dev/null $(pwd) then awk local
+	"$@" --verbose test -eu test grep 'quoted text' cd 2>/dev/null
+		done readonly export awk then printf $(pwd) "$@" then readonly sed "$1"
+		/usr/bin then -eu | local local then then export -eu "$@" export then sed
+printf echo cd grep then x=1 export 2>/dev/null | "$1" cd done --verbose
+printf /usr/bin local && 'quoted text' x=1 awk echo local -eu
+done sed --verbose awk --verbose echo /usr/bin
+local "$@" && -eu sed cd local awk cd "$@" local $(pwd)
+	local cd "$1" /usr/bin /usr/bin test printf done "$@" cd local x=1 "$1"
+	"$@" readonly x=1 2>/dev/null "$1" $(pwd) readonly cd
+${HOME} sed local done "$@" printf then printf x=1 export printf
+	printf && -eu /usr/bin printf test grep done --verbose awk --verbose
+	readonly 2>/dev/null done sed /usr/bin 'quoted text'
+		| then --verbose $(pwd) "$@" | && x=1 done -eu printf readonly
+		$(pwd) export local echo awk 'quoted text' 2>/dev/null sed
+	"$@" printf x=1 "$@" sed $(pwd) test sed --verbose done 2>/dev/null export awk
+cd 'quoted text' cd 2>/dev/null 'quoted text'
+readonly | done -eu sed ${HOME} --verbose sed printf 'quoted text' "$1" --verbose
+	echo x=1 && then echo awk "$1" sed "$@" /usr/bin echo
+done x=1 --verbose /usr/bin then x=1 sed test local 'quoted text' --verbose
+readonly export | printf test "$@" done awk cd then $(pwd) done local
+		readonly "$1" --verbose 'quoted text' --verbose 2>/dev/null ${HOME} grep
+&& | --verbose /usr/bin -eu then x=1 --verbose
+	-eu | done then grep $(pwd) /usr/bin sed then 'quoted text'
+export | -eu 2>/dev/null 'quoted text'
+grep cd "$1" then $(pwd) $(pwd) printf 2>/dev/null test local export ${HOME}
+	-eu --verbose $(pwd) ${HOME} x=1 -eu sed 2>/dev/null "$1"
+/usr/bin && 2>/dev/null
+/usr/bin --verbose $(pwd) awk readonly --verbose test echo printf test awk /usr/bin
+		test ${HOME} printf test --verbose
+	done readonly export /usr/bin
+		$(pwd) && ${HOME} echo && export done cd $(pwd)
+	&& test cd 2>/dev/null echo cd | x=1 awk "$@"
+	2>/dev/null sed sed readonly printf ${HOME} $(pwd) local && grep
+local x=1 "$1" readonly --verbose $(pwd) export
+		--verbose -eu done printf sed 2>/dev/null
+	--verbose && test && "$1" done done echo ${HOME} $(pwd) "$1" done
+		&& "$@" --verbose awk | then 2>/dev/null sed
+	cd then "$1" cd 'quoted text' x=1 test then /usr/bin test then done grep
+		awk --verbose awk /usr/bin "$1" $(pwd) readonly /usr/bin
+		--verbose 'quoted text' "$@" export
+	"$@" test done x=1 | 2>/dev/null && readonly --verbose
+		local then cd then /usr/bin "$1" ${HOME} cd printf
+		| && 'quoted text' printf 2>/dev/null && $(pwd) /usr/bin && --verbose
+		/usr/bin cd -eu -eu 'quoted text' ${HOME}
+${HOME} "$1" awk "$1" done && sed x=1 | echo cd awk 'quoted text'
+x=1 /usr/bin grep 'quoted text' test
+	echo --verbose | export x=1 test --verbose "$@" local sed "$@" test 'quoted text'
+		'quoted text' readonly then /usr/bin 'quoted text'
+	awk $(pwd) -eu $(pwd) local then test | "$@" ${HOME} "$1"
+echo | "$@" x=1 test grep $(pwd) 2>/dev/null done export readonly awk "$@"
+		sed 'quoted text' -eu echo 'quoted text'
+echo "$1" grep $(pwd)
+		${HOME} "$@" test /usr/bin grep /usr/bin "$@" 2>/dev/null export printf 2>/dev/null
+cd 2>/dev/null sed done
+		readonly | printf /usr/bin cd "$1" "$1" export readonly -eu | grep sed
+	"$@" 2>/dev/null test printf cd echo --verbose then $(pwd) local
+done printf 2>/dev/null test --verbose /usr/bin && then grep export -eu local "$1"
+	x=1 /usr/bin --verbose x=1 local awk "$1"
+export "$1" ${HOME} sed test test printf echo readonly $(pwd) cd
+		sed "$@" "$1" then sed x=1 grep /usr/bin -eu "$1" grep --verbose
+		"$1" done readonly then test sed && && sed 'quoted text'
+		test -eu --verbose readonly | -eu sed readonly awk readonly "$@" readonly echo then
+	--verbose sed | sed done ${HOME} 2>/dev/null
+	grep -eu --verbose "$@" then awk | export && export
+		export $(pwd) $(pwd) export "$1" done "$@" done grep 2>/dev/null x=1 then
+	${HOME} done -eu "$@" awk grep "$@" printf
+		"$1" x=1 done printf grep ${HOME} export 'quoted text' /usr/bin grep test sed
+	/usr/bin | /usr/bin printf
+'quoted text' 'quoted text' readonly 2>/dev/null
+		/usr/bin then done export 2>/dev/null then
+	'quoted text' readonly export --verbose
+		sed && && printf "$1" sed printf done sed printf $(pwd) "$@" && printf echo
+	"$@" /usr/bin "$@" | done --verbose && local sed
+	2>/dev/null --verbose ${HOME} "$@" awk echo awk readonly
+		test then export /usr/bin 'quoted text' && $(pwd) --verbose
+		local | 'quoted text' sed readonly
+echo && /usr/bin ${HOME} -eu "$1" done local sed grep then $(pwd) "$@" export
+--verbose x=1 && sed grep /usr/bin /usr/bin sed echo | "$1" 2>/dev/null 2>/dev/null
+		$(pwd) readonly done export
+	'quoted text' 'quoted text' test then echo printf awk ${HOME}
+		-eu awk local | x=1 readonly done x=1 readonly x=1
+	"$@" | $(pwd) grep /usr/bin local ${HOME} /usr/bin done then
+'quoted text' --verbose awk echo | test
+"$1" $(pwd) --verbose "$@" --verbose $(pwd) 2>/dev/null done "$@" x=1 /usr/bin
+	echo 'quoted text' --verbose awk sed x=1 && 2>/dev/null local done
+		x=1 "$@" 2>/dev/null "$1" awk |
+		cd 'quoted text' 'quoted text' 2>/dev/null
+cd ${HOME} grep x=1 grep
+$(pwd) grep cd 'quoted text' sed | sed x=1 x=1 "$@" test /usr/bin
+test -eu x=1 then done cd $(pwd)
+	grep done export 'quoted text' 2>/dev/null
+		local "$@" "$1" -eu 2>/dev/null && | awk -eu /usr/bin
+-eu | grep "$1" -eu --verbose
+		'quoted text' echo $(pwd) local
+cd awk $(pwd) done "$@" 2>/dev/null then "$1" awk $(pwd) then
+		$(pwd) | echo && echo sed export export test | test 2>/dev/null cd
+	"$@" $(pwd) 2>/dev/null echo awk cd -eu && |
+readonly 2>/dev/null "$1"
+	x=1 /usr/bin export test
+		-eu x=1 grep grep then /usr/bin $(pwd) x=1 | printf x=1 "$1" export 2>/dev/null
+		x=1 printf && awk then cd readonly $(pwd) 2>/dev/null
+	sed test 2>/dev/null | 2>/dev/null -eu "$1" sed grep "$1" -eu sed "$1"
+| ${HOME} cd grep 2>/dev/null
+	awk 'quoted text' 'quoted text'
+	printf done $(pwd) then then awk
+		${HOME} sed $(pwd) 2>/dev/null
+readonly --verbose printf 'quoted text'
+	-eu /usr/bin export "$1" cd awk awk local -eu done "$1"
+		test && "$@" -eu $(pwd) && "$1" $(pwd) test grep ${HOME} "$@" $(pwd) x=1 &&
+	2>/dev/null && printf readonly $(pwd) cd -eu && local /usr/bin 2>/dev/null 'quoted text'
+		x=1 ${HOME} "$1" "$1" printf 'quoted text'
+done echo /usr/bin x=1 2>/dev/null 'quoted text' echo "$1" done
+	"$@" && local echo "$1" && x=1 x=1 then 2>/dev/null && local readonly done $(pwd)
+		&& then | printf export readonly local echo awk cd awk | ${HOME}
+		cd grep awk local sed readonly cd
+local cd done $(pwd) /usr/bin done sed test && "$1" "$@" 2>/dev/null printf 'quoted text'
+--verbose export -eu then x=1 "$@" "$@" local -eu | test
+test test export readonly echo awk | readonly sed -eu export -eu readonly
+	${HOME} | echo grep --verbose /usr/bin $(pwd) -eu then
+	/usr/bin x=1 awk done -eu grep test "$1"
+	x=1 /usr/bin sed 2>/dev/null then cd sed cd && test 'quoted text' test printf "$@"
+		/usr/bin test "$@" echo local test --verbose --verbose $(pwd) cd
+	x=1 "$1" echo readonly printf | readonly cd echo "$1" "$@" sed grep readonly then
+/usr/bin test local x=1 test -eu | sed export && "$@" $(pwd) sed "$@"
+		&& awk echo --verbose readonly --verbose readonly
+printf readonly cd "$@" "$1" sed export
+		export readonly printf | $(pwd) printf x=1 $(pwd) "$@" -eu readonly
+	${HOME} grep echo $(pwd)
+	&& export | "$1" sed | printf "$@"
+cd local --verbose grep export && readonly x=1 $(pwd)
+readonly "$@" $(pwd) "$@" 2>/dev/null echo
+	done cd 2>/dev/null cd test | | ${HOME} echo | ${HOME}
+-eu awk readonly readonly readonly
+export --verbose | awk sed sed done grep sed cd "$1"
+	cd ${HOME} /usr/bin sed done sed "$@" grep done
+		${HOME} test grep done cd awk --verbose
+sed echo echo && readonly cd $(pwd) local awk readonly 2>/dev/null
+	awk awk $(pwd) export cd echo && $(pwd) ${HOME}
+	then | /usr/bin then 'quoted text' printf
+	"$1" 2>/dev/null cd local readonly done grep awk test /usr/bin
+	echo && printf sed local | "$@"
+	--verbose $(pwd) -eu sed
+	then 2>/dev/null 2>/dev/null then
+2>/dev/null "$1" printf sed
+grep readonly done local
+		export test ${HOME} -eu 2>/dev/null --verbose 'quoted text' | "$@"
+	"$@" local -eu test "$@" $(pwd) $(pwd) | /usr/bin
+	export --verbose "$@" sed
+-eu local grep "$1" printf grep cd export --verbose x=1 --verbose "$1" x=1 cd
+		echo then grep $(pwd) then x=1 ${HOME}
+-eu local | echo echo $(pwd)
+	local "$1" done "$1" | | done sed readonly printf readonly
+"$@" grep test export | grep
+		export sed printf cd $(pwd) --verbose
+| && "$1" -eu readonly grep cd $(pwd) ${HOME} readonly
+/usr/bin test 'quoted text' test
+	awk awk x=1 local grep then local 2>/dev/null
+		test grep sed awk ${HOME} local "$@" ${HOME} /usr/bin printf
+		x=1 "$@" --verbose 2>/dev/null test echo ${HOME} $(pwd) /usr/bin awk $(pwd)
+2>/dev/null export test local "$1" readonly --verbose $(pwd) 'quoted text'
+| local cd -eu && cd -eu then x=1 done awk test 'quoted text'
+		--verbose done test cd grep 'quoted text'
+	"$1" 'quoted text' awk export printf readonly 2>/dev/null
+	then 'quoted text' echo then printf 2>/dev/null "$1" --verbose
+		--verbose done readonly readonly
+		echo export then 2>/dev/null printf -eu sed sed
+	printf local $(pwd) "$1" echo && | readonly 'quoted text' grep | -eu echo grep
+		then cd cd "$1" awk grep $(pwd) | then --verbose export 'quoted text'
+&& cd -eu x=1 --verbose done --verbose "$@" $(pwd) export
+		cd then local ${HOME} readonly | $(pwd) 2>/dev/null 'quoted text'
+/usr/bin test ${HOME} grep "$@" readonly
+	done "$@" 2>/dev/null then test local $(pwd) -eu readonly 2>/dev/null "$@" local
+export export --verbose
+	'quoted text' awk --verbose -eu readonly readonly
+	2>/dev/null export sed test export sed 'quoted text'
+local awk test ${HOME} cd $(pwd) x=1 $(pwd) "$@" "$1" /usr/bin --verbose
+	| then done test 2>/dev/null && sed test 2>/dev/null grep
+		/usr/bin sed $(pwd) echo "$@" | export -eu
+$(pwd) x=1 printf sed printf readonly $(pwd) "$@" /usr/bin grep sed "$@" cd |
+	grep done -eu test $(pwd)
+"$1" sed x=1 && | /usr/bin "$1" local echo $(pwd) awk 2>/dev/null 2>/dev/null
+	${HOME} "$@" grep printf && 'quoted text' sed readonly
+	"$@" 2>/dev/null "$@" grep awk awk ${HOME} 'quoted text' 2>/dev/null
+2>/dev/null test "$1" 2>/dev/null
+		local "$1" -eu "$1" echo export done -eu "$1" sed export
+export export && printf readonly then done $(pwd)
+		-eu then ${HOME} printf echo 'quoted text' 2>/dev/null grep | ${HOME}
+grep 'quoted text' -eu /usr/bin 'quoted text'
+		test export | --verbose "$@" export ${HOME}
+-eu $(pwd) | awk x=1 | readonly | test
+	awk export echo done done done /usr/bin x=1 echo printf | | | test cd && /usr/bin
+	2>/dev/null 2>/dev/null printf -eu done printf -eu | awk
+-eu printf then $(pwd) -eu 'quoted text' sed ${HOME} sed
+		$(pwd) sed done local export echo /usr/bin -eu | | 'quoted text'
+		"$1" sed | x=1 /usr/bin ${HOME} printf echo local
+export ${HOME} local echo /usr/bin | | | && local "$1"
+		done 'quoted text' /usr/bin local --verbose export then x=1 test test cd awk &&
+		-eu then local readonly then x=1 ${HOME} then x=1 readonly printf "$@" sed
+test awk x=1 x=1 2>/dev/null cd
+		local local grep local /usr/bin /usr/bin $(pwd) /usr/bin 'quoted text' sed x=1 "$1"
+		export cd local -eu 2>/dev/null
+		printf $(pwd) "$1" grep cd test --verbose --verbose &&
+		x=1 "$@" --verbose sed cd export
+	| 'quoted text' "$1" test $(pwd) grep cd --verbose awk done local local
+printf local done 'quoted text' cd 'quoted text' printf $(pwd) -eu cd awk sed
+/usr/bin 2>/dev/null $(pwd) | grep export
+echo $(pwd) && $(pwd) | --verbose "$@" 'quoted text' && export -eu export $(pwd)
+${HOME} local $(pwd) /usr/bin
+	readonly /usr/bin then
+		-eu test /usr/bin -eu awk 2>/dev/null && "$1" "$@" ${HOME} && awk ${HOME}
+	echo "$1" done | printf --verbose readonly local $(pwd) | local | echo
+		"$@" then awk | sed -eu $(pwd) test then printf printf --verbose
+		-eu awk grep /usr/bin sed x=1 "$1" cd cd -eu ${HOME} grep
+	awk && export && sed --verbose printf printf printf local echo |
+	'quoted text' awk cd cd $(pwd) x=1 grep ${HOME} readonly done
+local -eu sed /usr/bin test --verbose
+/usr/bin "$1" done | awk printf test "$@" test | then sed grep "$1" ${HOME}
+x=1 then then /usr/bin echo grep local --verbose
+local "$1" sed cd export awk done "$@"
+	export cd | -eu cd sed 2>/dev/null done "$@" && echo ${HOME} printf
+'quoted text' "$@" printf printf then readonly
+	-eu cd awk local $(pwd) /usr/bin readonly "$@" awk awk sed ${HOME} printf export
+"$1" | 'quoted text' 2>/dev/null
+--verbose then x=1 $(pwd) 2>/dev/null local readonly x=1 x=1 sed cd &&
+echo && sed $(pwd) echo local test | done "$@" /usr/bin
+		&& done printf /usr/bin "$1" && 'quoted text' printf 2>/dev/null
+	test then && && done && then then
+	x=1 cd --verbose "$1" local sed && cd 'quoted text' | export 'quoted text'
+awk -eu /usr/bin test done && 'quoted text'
+2>/dev/null awk "$@" grep x=1 local readonly local |
+	2>/dev/null --verbose echo
+	'quoted text' x=1 && 'quoted text' ${HOME} --verbose && -eu
+	grep --verbose echo 2>/dev/null then readonly export
+		"$1" echo -eu | | echo && "$@" $(pwd) then printf grep cd 'quoted text'
+echo readonly x=1 /usr/bin "$1" ${HOME} x=1 sed && test /usr/bin
+	x=1 grep echo 'quoted text' 2>/dev/null export && 2>/dev/null cd then done $(pwd)
+		-eu test "$1" | readonly grep readonly -eu printf test test
+	local | grep then --verbose done -eu echo cd sed --verbose $(pwd) &&
+"$@" awk awk readonly && | --verbose -eu
+	readonly 'quoted text' then /usr/bin echo $(pwd)
+		2>/dev/null | awk grep sed ${HOME}
+--verbose sed printf "$@" local echo
+	echo | grep grep $(pwd) 'quoted text' grep
+		echo readonly ${HOME} --verbose "$@" awk 'quoted text'
+	echo ${HOME} /usr/bin sed --verbose 2>/dev/null
+		${HOME} test 'quoted text' --verbose done export
+		$(pwd) -eu readonly "$@" /usr/bin then
+		local x=1 grep export export done "$@" "$@" sed sed
+test printf test echo local --verbose --verbose export
+	&& local | grep "$@" then 2>/dev/null
+'quoted text' /usr/bin test cd sed --verbose local cd done "$@" echo
+		awk 'quoted text' ${HOME} | | cd echo | | cd readonly $(pwd) local
+		cd 2>/dev/null | $(pwd) cd then ${HOME} x=1 local 'quoted text' 2>/dev/null "$1"
+	/usr/bin sed $(pwd) awk -eu export then "$1" && awk "$@" grep
+grep cd && 'quoted text' local
+		then | test awk 'quoted text' ${HOME} grep -eu
+grep sed awk "$@" cd 2>/dev/null "$1" | done export test
+		grep test printf sed sed | 2>/dev/null
+	cd "$@" -eu "$@" sed export 'quoted text' x=1 cd | && export
+cd && | awk -eu sed sed export $(pwd) printf sed
+	echo awk | cd sed 'quoted text' local test
+		"$1" test -eu "$1" x=1 cd 'quoted text' done printf "$@"
+${HOME} $(pwd) printf readonly awk printf "$@" x=1 'quoted text'
+	'quoted text' export awk
+		echo x=1 readonly "$1" awk cd
+	| cd awk then cd $(pwd) $(pwd) "$1" then sed export sed test
+	"$@" | then then ${HOME} 'quoted text' && test sed $(pwd) echo export ${HOME}
+		test -eu local then grep readonly 2>/dev/null
+done && cd x=1 cd done echo "$1" readonly | export awk grep ${HOME}
+	$(pwd) readonly sed echo cd printf awk awk $(pwd) && sed
+"$@" $(pwd) local done && $(pwd) done x=1
+		grep "$@" echo && export
+	sed grep export grep $(pwd) --verbose
+	cd 'quoted text' then "$1" grep test awk done printf /usr/bin
+x=1 awk echo "$@" export && -eu /usr/bin 2>/dev/null
+	'quoted text' /usr/bin
+		x=1 sed x=1 && 'quoted text' "$@" then grep test test -eu sed ${HOME} 2>/dev/null
+then awk export test "$@" then 2>/dev/null /usr/bin x=1
+/usr/bin awk $(pwd) | "$1"
+	cd 'quoted text' done done echo -eu
+		awk grep local | then cd 2>/dev/null
+		local sed cd --verbose local cd --verbose local done
+x=1 echo && | $(pwd) readonly export export
+-eu then "$1" then ${HOME} echo printf grep "$@" $(pwd)
+	done "$1" echo "$@" grep $(pwd) "$1" "$@" then grep then sed awk 2>/dev/null
+		then grep 2>/dev/null $(pwd) -eu export && readonly
+		then 'quoted text' awk | cd -eu --verbose x=1 $(pwd) echo sed then &&
+"$@" -eu && 2>/dev/null --verbose export x=1 x=1 test 'quoted text' done 2>/dev/null
+-eu printf | | grep --verbose local -eu | printf sed --verbose
+	local --verbose then && "$@" readonly echo -eu
+	/usr/bin export test 2>/dev/null && test /usr/bin "$@" awk && --verbose
+		export cd ${HOME} done
+local | then then done awk
+		2>/dev/null "$@" then && test readonly echo cd && | done "$@"
+	| | --verbose | --verbose grep /usr/bin readonly done local grep 'quoted text'
+echo printf awk && cd printf ${HOME} cd /usr/bin |
+	${HOME} sed grep grep && sed done sed then then echo sed readonly
+	grep local && printf 2>/dev/null &&
+done "$@" "$@" echo /usr/bin done awk ${HOME} done "$1" grep then x=1 $(pwd)
+		2>/dev/null local "$@"
+		"$@" "$1" awk then done test export
+	"$1" && local then -eu 'quoted text' export grep
+grep "$@" test /usr/bin ${HOME} /usr/bin awk "$1"
+"$@" readonly done ${HOME} 'quoted text' sed cd cd cd --verbose readonly
+	"$@" echo grep x=1 grep
+		&& ${HOME} then /usr/bin $(pwd) local
+		then -eu x=1 then --verbose test 2>/dev/null cd
+"$1" printf ${HOME} | && readonly /usr/bin done --verbose export
+		grep echo --verbose sed && -eu x=1 cd sed "$@" "$@" cd awk --verbose
+awk then -eu test cd "$@" |
+		/usr/bin local local local $(pwd) |
+	readonly local then 'quoted text' "$1" export awk test printf export
+	sed test x=1 "$1" $(pwd) 'quoted text' --verbose awk -eu
+$(pwd) "$1" "$1" local "$1"
+	--verbose $(pwd) && echo 'quoted text' /usr/bin then
+		echo local readonly awk 2>/dev/null
+		then "$1" test 'quoted text' ${HOME}
+test echo 'quoted text' printf 'quoted text' $(pwd) printf $(pwd) 2>/dev/null sed
+	test echo echo printf --verbose ${HOME}
+cd then --verbose then local /usr/bin
+	"$1" /usr/bin "$1" test local -eu echo printf $(pwd) then 'quoted text'
+grep "$1" sed | "$@" $(pwd) echo readonly 2>/dev/null
+2>/dev/null "$@" --verbose echo && 'quoted text' 2>/dev/null readonly test
+		-eu /usr/bin 'quoted text' awk echo sed
+		grep --verbose ${HOME} 2>/dev/null | grep done --verbose "$@" x=1 grep 'quoted text'
+	printf grep | readonly "$@" cd | 2>/dev/null x=1 && $(pwd)
+		--verbose x=1 done awk /usr/bin --verbose x=1 printf awk
+#include c196.sh
+		$(pwd) "$1" "$1" printf $(pwd) grep 2>/dev/null done
+-eu done cd local export
+		cd x=1 -eu "$@" cd local
+		echo sed cd 2>/dev/null $(pwd) local done export local -eu
+	sed && grep cd "$@" "$1" grep "$1" $(pwd) && printf
+		then 2>/dev/null printf local printf ${HOME} 'quoted text'
+2>/dev/null awk echo --verbose echo echo test ${HOME} done ${HOME} then echo export
+	&& echo "$1" then x=1 awk readonly
+then awk cd && /usr/bin
+		| cd "$@" | "$1" /usr/bin then local printf awk grep sed local -eu ${HOME} ${HOME}
+echo then --verbose printf then /usr/bin --verbose | &&
+	-eu grep -eu printf 'quoted text' x=1 -eu test local -eu "$1" local export ${HOME}
+		awk done test 'quoted text' /usr/bin --verbose ${HOME} local
+awk | local | /usr/bin ${HOME} then "$@" readonly awk "$@" done sed
+		"$@" awk -eu readonly -eu grep then ${HOME} 'quoted text'
+		local then "$@" $(pwd)
+export /usr/bin grep export -eu readonly
+awk export /usr/bin -eu --verbose
+		| grep | -eu readonly done test export /usr/bin readonly awk readonly ${HOME}
+		2>/dev/null "$1" 2>/dev/null -eu printf
+		&& | then export 2>/dev/null -eu 2>/dev/null grep && awk done cd
+		x=1 printf local | | grep test grep ${HOME} 2>/dev/null
+	2>/dev/null && awk export
+	'quoted text' $(pwd) then 2>/dev/null
+		/usr/bin -eu sed 2>/dev/null
+		then && $(pwd) export printf then "$@" export then $(pwd) export printf
+		grep echo grep export --verbose $(pwd)
+$(pwd) $(pwd) test "$@" -eu /usr/bin
+	"$@" readonly echo cd grep "$@" "$@" "$1" echo -eu echo sed
+	${HOME} local -eu echo 2>/dev/null cd x=1 $(pwd) /usr/bin echo printf test test
+awk && | "$1" sed echo --verbose
+export /usr/bin local x=1 export x=1 cd | ${HOME} /usr/bin export
+	echo awk echo "$@" "$1" ${HOME} cd x=1 2>/dev/null test echo --verbose "$1" printf
+	cd readonly awk then "$@" 2>/dev/null $(pwd) "$@" 2>/dev/null
+		-eu "$1" 2>/dev/null $(pwd) x=1 | test local then done done sed && grep "$@" readonly
+		printf | "$1" awk "$1"
+| 2>/dev/null cd done $(pwd) "$@" printf | "$@" && local test test echo awk
+	readonly 'quoted text' sed test cd 2>/dev/null
+		sed ${HOME} $(pwd) printf "$1" then grep --verbose done then test done
+		awk grep local "$@" cd sed "$1" "$1" awk
+	-eu 'quoted text' --verbose sed --verbose awk --verbose cd
+--verbose -eu readonly "$1" awk grep sed /usr/bin cd echo awk echo readonly
+		2>/dev/null 'quoted text'
+x=1 readonly export 2>/dev/null x=1 'quoted text'
+		2>/dev/null echo local test local
+		grep then /usr/bin awk "$1" then ${HOME}
+		2>/dev/null $(pwd) --verbose ${HOME} $(pwd) export echo readonly
+		&& printf awk 2>/dev/null then -eu && echo awk && readonly | readonly
+		"$@" test x=1 $(pwd) cd ${HOME} 2>/dev/null test
+/usr/bin "$1" | "$1" then test then $(pwd) "$1" local sed grep | grep
+		--verbose --verbose done then /usr/bin local "$@" awk export
+		&& echo local x=1 $(pwd) "$1"
+echo local export "$@" grep printf test --verbose readonly local test
+		sed export "$@" /usr/bin -eu 2>/dev/null export
+		&& sed ${HOME} readonly "$1" awk grep | export &&
+	sed /usr/bin --verbose then -eu "$@" x=1 awk readonly
+		readonly && /usr/bin cd && --verbose echo 2>/dev/null && then local "$@" cd -eu
+		grep -eu 'quoted text' grep local 'quoted text' $(pwd)
+	'quoted text' "$1" echo printf ${HOME} x=1 then && test && export
+&& 'quoted text' 'quoted text' echo
+		grep && done export sed awk | echo grep grep sed && local
+		then --verbose "$1" export -eu cd then
+		cd done $(pwd) then "$@" --verbose
+done "$@" grep then ${HOME} local x=1 && readonly
+		readonly 'quoted text' printf "$1" printf -eu readonly "$1" && 2>/dev/null
+/usr/bin "$1" local sed cd && --verbose cd x=1 export echo
+		2>/dev/null export echo | test
+--verbose x=1 x=1 printf test export "$@" cd test echo --verbose "$1" -eu $(pwd)
+		"$@" printf ${HOME} then $(pwd) test cd $(pwd) "$1"
+x=1 /usr/bin ${HOME} | grep
+cd local done $(pwd) printf
+		-eu /usr/bin grep grep grep awk ${HOME}
+		'quoted text' 2>/dev/null 2>/dev/null awk
+awk printf "$@" grep && echo echo sed test | x=1 --verbose "$@" $(pwd) grep
+echo && printf 'quoted text' grep done
+		x=1 'quoted text' $(pwd) 2>/dev/null printf "$@" "$@"
+		echo --verbose --verbose -eu done cd export | --verbose printf
+		"$@" cd "$@" export printf ${HOME} awk && 2>/dev/null
+grep --verbose 2>/dev/null /usr/bin export test printf
+		echo local echo --verbose x=1 printf
+test --verbose "$1" cd test $(pwd) "$1" "$1" --verbose sed ${HOME}
+-eu 'quoted text' test &&
+"$@" && | local $(pwd) 'quoted text' | printf printf -eu 2>/dev/null sed cd export
+$(pwd) cd readonly printf grep ${HOME} 2>/dev/null
+		${HOME} echo 2>/dev/null ${HOME} "$1" local --verbose "$1" 2>/dev/null
+	awk done 2>/dev/null sed "$@" 'quoted text' cd ${HOME} readonly
+	done "$@" export cd echo echo local cd "$1" test echo echo sed
+		2>/dev/null -eu cd && then test awk | ${HOME}
+export -eu -eu sed /usr/bin sed cd ${HOME} && ${HOME} awk && export "$1"
+		sed grep cd ${HOME} done awk export -eu "$@" | "$@" awk done
+	/usr/bin printf printf ${HOME} /usr/bin && awk | && "$@"
+		local "$1" readonly then sed
+		grep grep local cd && sed x=1 sed -eu readonly readonly -eu
+		then sed ${HOME} echo $(pwd) then --verbose cd | then 'quoted text'
+	printf /usr/bin -eu 'quoted text' 'quoted text'
+	&& awk then $(pwd) printf test
+--verbose | 2>/dev/null /usr/bin
+	readonly test done /usr/bin 'quoted text' -eu 2>/dev/null && readonly
+	echo 'quoted text' 2>/dev/null export export
+		grep x=1 cd | grep "$1" && 'quoted text' local export then ${HOME} -eu
+		cd ${HOME} | --verbose "$@" --verbose --verbose local $(pwd) readonly ${HOME}
+		"$@" cd --verbose | "$1" printf "$1"
+	| 'quoted text' done grep /usr/bin test sed "$1"
+		${HOME} done readonly --verbose export ${HOME} --verbose ${HOME} grep 2>/dev/null
+		printf 2>/dev/null ${HOME} -eu printf export && ${HOME}
+&& /usr/bin sed export "$1" ${HOME} awk "$@" test $(pwd)
+then local "$1" grep local ${HOME} export readonly && ${HOME} ${HOME} export
+	local echo x=1 --verbose | 2>/dev/null echo export && -eu local 'quoted text'
+&& "$1" $(pwd) && /usr/bin 'quoted text' then ${HOME} export /usr/bin && -eu then
+		&& --verbose --verbose export "$1"
+local awk awk then $(pwd) export echo grep echo local echo readonly "$@"
+grep $(pwd) test sed 2>/dev/null then && test ${HOME} -eu done /usr/bin
+		done $(pwd) $(pwd) | /usr/bin printf echo "$@" -eu --verbose
+	done 2>/dev/null sed export -eu printf test
+'quoted text' then && && readonly x=1 --verbose $(pwd) && "$@" 'quoted text'
+	/usr/bin --verbose test sed "$1" x=1 awk cd cd printf
+		then 'quoted text' && then --verbose printf
+	then ${HOME} ${HOME} grep cd 'quoted text' ${HOME} test done sed x=1
+&& "$@" printf then "$@" test test
+--verbose $(pwd) && -eu /usr/bin 2>/dev/null grep local |
+$(pwd) --verbose | $(pwd) export export | x=1 $(pwd) | then printf
+		--verbose "$1" export then echo $(pwd) && "$@" then sed -eu grep sed x=1 local
+	--verbose 'quoted text' test done test
+		grep $(pwd) done printf x=1 grep $(pwd)
+	"$@" && cd /usr/bin 'quoted text' $(pwd) export done printf 'quoted text'
+--verbose awk cd test "$@"
+		-eu local sed awk && echo
+"$1" printf grep 2>/dev/null /usr/bin
+	grep done ${HOME} 2>/dev/null
+	--verbose --verbose ${HOME} printf cd grep test
+		export test /usr/bin readonly ${HOME} -eu export "$1" then $(pwd) "$@" "$@"
+		&& awk printf awk awk awk --verbose done -eu printf printf
+readonly grep ${HOME} "$1" test done echo | echo x=1 readonly -eu
+printf printf printf cd export /usr/bin grep && -eu "$@" export $(pwd)
+		&& -eu x=1 $(pwd) && test 2>/dev/null readonly awk sed /usr/bin $(pwd) 2>/dev/null
+then "$1" "$@" printf --verbose readonly awk 2>/dev/null &&
+		--verbose grep --verbose --verbose ${HOME} readonly "$1"
+		&& $(pwd) test done "$1" 2>/dev/null echo 2>/dev/null readonly awk
+"$1" grep x=1 2>/dev/null
+export done awk cd $(pwd) export done
+	sed test printf done local export x=1
+		/usr/bin test -eu $(pwd) x=1 echo ${HOME}
+	test grep grep export 'quoted text' && echo 'quoted text'
+	2>/dev/null local export awk /usr/bin
+	${HOME} done echo 2>/dev/null echo awk
+	--verbose --verbose cd /usr/bin awk sed | $(pwd) "$@" 2>/dev/null printf 2>/dev/null
+cd ${HOME} "$@" "$@" awk x=1 readonly 'quoted text'
+		local /usr/bin done awk /usr/bin printf && cd cd ${HOME}
+		--verbose done "$@" | --verbose local readonly readonly printf
+		&& sed awk $(pwd) && /usr/bin grep -eu grep 2>/dev/null then then readonly
+readonly 2>/dev/null /usr/bin 2>/dev/null
+test && sed readonly && -eu "$@" grep grep local
+	export grep export awk | local test then 2>/dev/null ${HOME} done && awk
+${HOME} export ${HOME} readonly /usr/bin /usr/bin done
+		"$1" echo -eu done "$1" -eu
+	x=1 cd sed ${HOME} echo local done && x=1 'quoted text'
+	export /usr/bin 'quoted text' --verbose /usr/bin
+	| test sed | cd done -eu --verbose
+		export grep sed | test $(pwd)
+done "$1" 2>/dev/null then awk -eu grep local grep then
+		test x=1 | export /usr/bin readonly ${HOME} printf "$1" 'quoted text'
+export local local test local --verbose done sed done done grep "$1" local
+		"$1" test -eu x=1 echo ${HOME} && 'quoted text' --verbose
+	done sed && local export cd "$1" echo sed printf awk "$1" x=1 --verbose
+export "$@" awk local done cd
+"$@" "$@" 'quoted text' sed /usr/bin done -eu /usr/bin
+		-eu /usr/bin done cd done
+		2>/dev/null "$1" cd $(pwd)
+		'quoted text' cd readonly printf "$1" cd 2>/dev/null | sed export --verbose
+	$(pwd) 'quoted text' 2>/dev/null -eu echo sed x=1 grep printf export 2>/dev/null
+	/usr/bin && /usr/bin && awk -eu sed test done
+	--verbose echo $(pwd) cd cd -eu done echo awk 2>/dev/null
+		2>/dev/null echo done sed && sed printf awk
+		cd echo done echo -eu grep sed ${HOME} $(pwd) | x=1
+printf "$@" export grep then $(pwd)
+cd -eu awk $(pwd) sed cd $(pwd) "$@" --verbose --verbose echo awk then --verbose
+		sed 2>/dev/null 'quoted text' --verbose 'quoted text'
+		sed sed sed /usr/bin | -eu printf
+		sed | echo ${HOME} -eu ${HOME}
+	"$@" -eu cd awk 2>/dev/null done "$1" then then ${HOME} local done /usr/bin
+		sed /usr/bin | | cd | | 2>/dev/null export
+&& awk --verbose grep test -eu && readonly ${HOME}
+then 'quoted text' ${HOME} | 'quoted text' grep && &&
+	x=1 --verbose 'quoted text' test 2>/dev/null --verbose 'quoted text' printf
+sed grep sed "$@" -eu --verbose ${HOME} x=1 -eu ${HOME} -eu -eu test
+	grep x=1 printf then /usr/bin --verbose sed then --verbose cd x=1 export
+		| --verbose "$1" printf ${HOME} /usr/bin
+done grep echo grep $(pwd) && local "$@"
+		test echo "$1" test 'quoted text' done 'quoted text' readonly
+2>/dev/null cd local echo /usr/bin "$1" 2>/dev/null awk then
+		grep grep "$1" echo "$@" -eu 2>/dev/null readonly export
+		cd | grep echo ${HOME} /usr/bin 2>/dev/null awk then printf --verbose done grep
+		export | printf ${HOME} awk echo "$@" cd echo
+	2>/dev/null awk 'quoted text' --verbose done --verbose then then done --verbose
+		sed -eu x=1 sed x=1 cd 'quoted text' -eu export | /usr/bin
+	| readonly cd export printf awk test --verbose && $(pwd) 'quoted text' "$1"
+		"$@" awk 2>/dev/null $(pwd) awk x=1 awk export
+sed 2>/dev/null readonly
+	then export grep export |
+	export then "$1" | local 'quoted text' "$@" export awk x=1
+local readonly cd printf
+	2>/dev/null | test ${HOME} grep local "$1" 'quoted text' then
+export echo done && test 'quoted text'
+	then && echo && $(pwd) sed awk x=1 echo
+sed printf $(pwd) 'quoted text' readonly readonly local ${HOME}
+		2>/dev/null -eu --verbose done printf $(pwd) ${HOME} 'quoted text'
+		"$1" then ${HOME} ${HOME} -eu done grep $(pwd) done "$1" "$@"
+"$@" grep readonly cd echo -eu done then then sed readonly "$@" echo
+local then | then printf && done
+	"$1" export 'quoted text' done awk awk $(pwd) "$@" 'quoted text'
+	&& cd printf 2>/dev/null /usr/bin 'quoted text' printf echo | readonly
+	local awk -eu --verbose "$@" echo then 'quoted text' echo test then
+	awk "$@" x=1 /usr/bin | -eu export test "$@" test | $(pwd) then cd $(pwd)
+	done -eu sed x=1 2>/dev/null echo echo "$1" export awk grep /usr/bin printf
+		echo done /usr/bin test
+	then printf then done | local local local export /usr/bin
+		local grep readonly 2>/dev/null
+		'quoted text' -eu grep 2>/dev/null local | local /usr/bin done
+		local readonly grep echo test -eu
+	$(pwd) grep sed then x=1 /usr/bin readonly readonly
+sed cd /usr/bin x=1 2>/dev/null /usr/bin
+		x=1 "$1" grep /usr/bin awk then echo echo test cd local "$@"
+printf readonly ${HOME} && test sed /usr/bin awk 2>/dev/null --verbose &&
+		grep then ${HOME} export "$1" 'quoted text'
+	then $(pwd) readonly done printf
+x=1 && readonly grep local then &&
+		cd "$1" printf "$1" cd done then -eu /usr/bin printf echo
+	done readonly test "$1" 'quoted text'
+echo -eu printf /usr/bin -eu cd done sed printf export 'quoted text'
+sed ${HOME} /usr/bin export grep 'quoted text'
+"$1" "$1" /usr/bin 'quoted text' $(pwd) cd $(pwd) | 'quoted text'
+2>/dev/null --verbose x=1 cd 2>/dev/null
+	"$1" 2>/dev/null | /usr/bin &&
+		echo cd -eu ${HOME} 'quoted text' -eu --verbose --verbose ${HOME} --verbose
+"$@" ${HOME} x=1 sed && export /usr/bin awk "$1" $(pwd) && $(pwd) echo
+		sed "$@" 2>/dev/null /usr/bin
+/usr/bin awk "$@" cd 'quoted text'
+--verbose echo 2>/dev/null cd --verbose
+2>/dev/null | "$1" --verbose readonly grep awk
+local printf local readonly export "$1"
+2>/dev/null then x=1 echo x=1 "$1" 2>/dev/null
+		export then sed ${HOME} --verbose $(pwd) export && $(pwd) then done test
+	sed "$1" local ${HOME} readonly -eu /usr/bin
+		test test "$@" x=1 echo printf 2>/dev/null done awk
+		--verbose ${HOME} local 'quoted text' 'quoted text'
+		printf awk /usr/bin -eu | "$@" echo --verbose 'quoted text'
+		${HOME} 2>/dev/null /usr/bin "$@" then grep | 'quoted text'
+		local echo && then readonly echo "$1" ${HOME} grep -eu
+		sed | ${HOME} 'quoted text' 'quoted text' $(pwd) test cd x=1 done then
+--verbose /usr/bin -eu
+		x=1 printf test "$1" then readonly
+	sed x=1 then --verbose awk readonly 2>/dev/null | ${HOME}
+		'quoted text' grep cd --verbose export done
+		echo && echo awk ${HOME} && test | then sed done
+		-eu --verbose then ${HOME} cd sed | && $(pwd) awk awk export test --verbose
+	x=1 printf /usr/bin echo $(pwd)
+"$@" | | 2>/dev/null $(pwd) export echo
+$(pwd) && then local printf then export grep 'quoted text'
+| 'quoted text' $(pwd) ${HOME} awk done
+		done then 'quoted text' awk
+		export | /usr/bin printf grep | 'quoted text' 2>/dev/null $(pwd) --verbose
+x=1 | 'quoted text' /usr/bin "$@" then export "$@" && | "$@" $(pwd)
+		sed printf "$1" -eu 2>/dev/null
+	| awk && echo awk 'quoted text'
+	sed cd && done "$@" -eu
+		/usr/bin && grep 'quoted text'
+${HOME} ${HOME} /usr/bin x=1 local local then -eu && ${HOME} readonly
+done cd "$1" "$@" --verbose
+		'quoted text' test sed --verbose
+	readonly ${HOME} grep "$@"
+	grep "$1" ${HOME} x=1 readonly test && export printf
+/usr/bin echo && ${HOME} local x=1 readonly $(pwd) 'quoted text' | -eu --verbose
+		test readonly "$1" export "$1" ${HOME} export && then awk
+	2>/dev/null test | "$@" 'quoted text' local readonly /usr/bin awk done local done
+		${HOME} | --verbose done -eu test printf test
+		--verbose printf readonly then 2>/dev/null ${HOME} then &&
+sed local done echo "$@" done --verbose -eu sed done -eu
+	x=1 then printf "$1" then awk done awk export x=1 2>/dev/null grep
+	x=1 /usr/bin | $(pwd) -eu ${HOME} then done 2>/dev/null export
+	/usr/bin printf cd cd "$1" 'quoted text'
+x=1 then 'quoted text' ${HOME} x=1 && --verbose
+		then export "$@" printf && -eu then "$1" | && echo
+	grep -eu awk ${HOME} "$@" | local
+	printf awk sed sed | printf x=1
+	-eu 'quoted text' --verbose -eu && 'quoted text' sed 2>/dev/null sed
+		"$1" test printf done 2>/dev/null 'quoted text' then test test x=1 export $(pwd)
+cd /usr/bin ${HOME} printf done cd sed readonly $(pwd) ${HOME} "$1"
+	export --verbose export ${HOME} "$1"
+		done test printf 'quoted text' | echo --verbose export x=1
+	--verbose awk grep sed local cd "$@" x=1 | "$1" x=1 /usr/bin ${HOME}
+		--verbose sed 2>/dev/null && done --verbose
+		then test 2>/dev/null printf sed | sed
+	${HOME} sed cd sed x=1 2>/dev/null && --verbose x=1 echo "$1" /usr/bin export done
+-eu -eu awk -eu --verbose local echo done
+$(pwd) local cd cd --verbose then x=1 test "$1" "$@"
+		x=1 "$1" ${HOME} grep "$1" $(pwd) -eu echo "$@" $(pwd) then --verbose
+&& "$@" cd export $(pwd) sed sed x=1 $(pwd) x=1 local then printf
+echo "$@" 'quoted text' test x=1 'quoted text'
+sed --verbose "$@" test echo printf cd x=1 ${HOME} grep awk $(pwd)
+		test 2>/dev/null -eu --verbose
+		local /usr/bin x=1 x=1 awk "$1" readonly done | then 'quoted text' && "$@" grep
+then 2>/dev/null echo then
+| -eu test done sed --verbose
+		--verbose x=1 ${HOME} grep 2>/dev/null && readonly echo
+		"$@" 2>/dev/null x=1 sed local "$1" printf
+cd echo | && "$1" readonly -eu export
+printf -eu --verbose readonly cd readonly sed export 'quoted text'
+	--verbose awk done /usr/bin printf x=1
+	done "$1" "$1" --verbose export grep /usr/bin
+		/usr/bin ${HOME} test "$@" 2>/dev/null | then
+		awk && --verbose local 'quoted text' cd && printf ${HOME} ${HOME} local grep
+	'quoted text' test sed | ${HOME} echo && $(pwd) 2>/dev/null test && awk "$1" x=1
+	grep then x=1 'quoted text' awk cd test --verbose
+		${HOME} /usr/bin readonly cd --verbose "$@" readonly
+readonly export "$@" printf -eu 'quoted text' ${HOME} readonly export test "$@"
+	done | printf -eu export 2>/dev/null printf $(pwd) echo
+		&& $(pwd) $(pwd) test && x=1
+grep "$1" local echo done readonly then && test grep sed readonly 'quoted text'
+	| readonly echo export cd 'quoted text' 'quoted text' done -eu local $(pwd)
+&& | 2>/dev/null ${HOME} grep sed $(pwd)
+"$1" local "$@" ${HOME} test echo cd sed local done ${HOME}
+readonly printf then --verbose
+		| printf cd then grep 'quoted text' done cd $(pwd) "$1" -eu cd sed local |
+	export $(pwd) -eu 2>/dev/null readonly local "$@" "$@" /usr/bin
+readonly done && done local printf ${HOME} then awk /usr/bin test printf /usr/bin
+		x=1 --verbose -eu "$@" "$1" && printf "$1" sed sed
+		${HOME} -eu "$1" awk -eu done /usr/bin x=1 ${HOME} test awk
+		&& done test echo grep /usr/bin awk printf
+2>/dev/null ${HOME} x=1 export awk
+done $(pwd) x=1 x=1 2>/dev/null sed --verbose local --verbose "$1"
+		done echo -eu -eu grep then done
+grep grep cd --verbose -eu local export
+	$(pwd) test | cd "$@" -eu x=1 && ${HOME} "$1" $(pwd) -eu "$@" grep 'quoted text'
+	readonly && awk /usr/bin 'quoted text'
+	x=1 2>/dev/null awk 'quoted text'
+	export "$1" test "$1" printf awk then
+		export echo "$1" sed echo -eu echo grep
+x=1 --verbose "$1" $(pwd) ${HOME} local && printf
+local x=1 "$@" grep readonly
+		export echo awk --verbose 'quoted text' export cd && sed grep cd $(pwd) cd
+	| echo printf && then grep && x=1 cd -eu /usr/bin
+	x=1 --verbose | echo 'quoted text' awk sed cd
+	"$1" export export x=1 x=1 sed done "$@"
+--verbose awk | -eu "$@" 2>/dev/null
+		'quoted text' echo printf --verbose
+	echo | && export awk | echo test echo readonly
+		cd /usr/bin printf ${HOME} /usr/bin awk 2>/dev/null grep ${HOME}
+		sed --verbose local --verbose "$@" | export test awk "$@"
+$(pwd) done /usr/bin 2>/dev/null then /usr/bin ${HOME}
+	${HOME} && test done /usr/bin x=1 sed then
+		grep printf 2>/dev/null done cd | | "$@"
+	/usr/bin "$1" "$@" done $(pwd) sed
+local -eu awk /usr/bin done readonly -eu | "$1" "$@" grep local export awk
+		x=1 local /usr/bin "$@" "$1" then sed readonly
+	then readonly readonly ${HOME} "$@" x=1 grep sed ${HOME}
+		'quoted text' echo "$@" /usr/bin "$@" echo 'quoted text' test ${HOME}
+	/usr/bin x=1 printf printf && --verbose printf sed grep local
+		--verbose && then 'quoted text'
+		x=1 test && done local /usr/bin 2>/dev/null
+	echo sed 'quoted text' printf done done test
+		--verbose local printf grep 2>/dev/null
+/usr/bin done | | cd then awk -eu sed local echo echo
+export awk 'quoted text' 2>/dev/null "$@"
+	&& "$@" echo printf echo "$@" export echo | then readonly local "$1" test 'quoted text'
+		2>/dev/null done | $(pwd) cd
+echo export printf $(pwd) awk local 'quoted text' cd /usr/bin
+	printf | && && done then
+	echo readonly 'quoted text' done test --verbose
+	x=1 "$@" && local cd sed x=1 cd grep
+	cd --verbose ${HOME} local done 2>/dev/null
+	sed /usr/bin test | printf printf -eu | && echo 2>/dev/null
+		local -eu 'quoted text' test awk test done /usr/bin
+	readonly x=1 $(pwd) --verbose then readonly printf then && printf "$1" done local
+		printf | "$1" readonly export -eu done readonly sed echo $(pwd)
+$(pwd) 'quoted text' sed ${HOME} local
+&& local test grep 'quoted text' | 2>/dev/null && local -eu "$1"
+		readonly "$@" sed sed readonly
+"$@" $(pwd) 2>/dev/null "$@" awk | 'quoted text' ${HOME} -eu done sed
+		echo --verbose then -eu readonly "$@" $(pwd)
+		--verbose 2>/dev/null "$1" test ${HOME} test
+2>/dev/null | "$1" $(pwd) cd cd 2>/dev/null then "$@" local
+	cd grep readonly 2>/dev/null
+		echo local ${HOME} --verbose sed cd test -eu -eu ${HOME} $(pwd) $(pwd)
+	local && $(pwd) readonly 'quoted text' ${HOME} x=1 awk 2>/dev/null x=1 $(pwd)
+$(pwd) ${HOME} --verbose
+	export x=1 ${HOME} -eu
+	local awk | "$1" /usr/bin local sed readonly grep "$1" sed then
+	--verbose /usr/bin | echo /usr/bin $(pwd) | grep export x=1 then
+	printf ${HOME} awk awk test sed export then cd cd
+done 'quoted text' $(pwd) && "$@" done | 2>/dev/null done "$@"
+		"$@" ${HOME} 'quoted text' && "$@" && --verbose /usr/bin
+"$1" sed "$1" printf echo $(pwd) test
+	&& printf && x=1 /usr/bin 'quoted text' sed /usr/bin
+		sed 2>/dev/null && awk 'quoted text' readonly -eu | printf echo 'quoted text'
+cd local cd echo test grep
+readonly local printf readonly cd grep "$1" --verbose -eu grep 2>/dev/null then
+sed /usr/bin then sed cd -eu x=1 && awk ${HOME}
+		readonly 2>/dev/null
+	x=1 grep && && export test | sed
+export "$1" 2>/dev/null local awk sed done x=1 test local
+		$(pwd) sed echo && -eu sed
+sed echo grep grep /usr/bin 'quoted text'
+awk awk -eu && /usr/bin sed awk ${HOME} export
+done grep && local && export
+		echo readonly test printf test -eu echo awk sed "$@" ${HOME}
+	echo done printf printf ${HOME} cd then local readonly readonly /usr/bin
+	/usr/bin then && /usr/bin -eu /usr/bin $(pwd) readonly /usr/bin cd export --verbose
+awk sed && done local sed "$@" then echo /usr/bin readonly
+	$(pwd) -eu -eu echo echo
+grep ${HOME} -eu 'quoted text'
+'quoted text' done "$@" export --verbose cd 'quoted text'
+	&& --verbose ${HOME} --verbose test then echo "$@" &&
+	sed $(pwd) | awk "$1" local done awk 'quoted text' "$@"
+		readonly 'quoted text' ${HOME} sed 2>/dev/null "$@" export test
+	${HOME} | grep grep printf /usr/bin cd "$1" &&
+$(pwd) | readonly 'quoted text' ${HOME} awk readonly
+&& grep --verbose echo
+		done x=1 -eu /usr/bin $(pwd) $(pwd) x=1 2>/dev/null "$@" 'quoted text' x=1
+		printf sed "$@" ${HOME} done ${HOME} --verbose $(pwd) grep sed
+		&& "$@" /usr/bin cd x=1 | cd && done test echo readonly
+		cd --verbose cd -eu && awk echo ${HOME} then -eu readonly &&
+$(pwd) /usr/bin echo x=1 x=1 "$1" ${HOME} "$1" then | cd
+		echo sed ${HOME} -eu cd echo "$@" test 'quoted text' sed "$1" $(pwd)
+2>/dev/null sed /usr/bin 2>/dev/null 'quoted text'
+/usr/bin done x=1 --verbose test -eu | -eu 'quoted text' && 2>/dev/null $(pwd)
+		readonly local echo readonly $(pwd) local "$1" 2>/dev/null readonly echo
+		| /usr/bin readonly x=1 awk sed sed echo echo | grep 2>/dev/null | sed local
+&& echo test then readonly grep x=1 local "$@" -eu -eu 2>/dev/null -eu
+		${HOME} "$1" --verbose
+		awk -eu then | readonly ${HOME} ${HOME} local --verbose grep readonly printf
+		export cd $(pwd) test sed "$1" --verbose
+		echo x=1 /usr/bin && "$@" awk --verbose done readonly local
+		| done 2>/dev/null then done echo done local local
+		grep 2>/dev/null then x=1 export "$@" cd grep echo 2>/dev/null -eu
+--verbose "$1" export "$@" awk grep
+"$1" printf awk 'quoted text' test
+then | grep "$@" --verbose readonly then sed && local awk -eu then then $(pwd)
+	| --verbose /usr/bin printf --verbose ${HOME}
+		&& then x=1 sed printf --verbose 'quoted text' test && grep $(pwd)
+		x=1 export sed local 'quoted text'
+		cd test "$@" 2>/dev/null --verbose 2>/dev/null /usr/bin 2>/dev/null sed
+		"$@" echo 'quoted text' test printf x=1 printf
+		test 'quoted text' /usr/bin awk printf export local |
+	export test echo ${HOME} then local | ${HOME} 'quoted text' test 2>/dev/null
+	done sed $(pwd) | 2>/dev/null
+	echo $(pwd) --verbose x=1
+	awk 2>/dev/null x=1 x=1
+'quoted text' 2>/dev/null /usr/bin cd -eu --verbose
+	| cd | -eu done then /usr/bin then awk then "$@" cd --verbose "$@"
+x=1 "$1" readonly -eu $(pwd) cd ${HOME} && "$1" && printf awk "$@"
+	"$@" ${HOME} ${HOME} "$@" /usr/bin /usr/bin | local readonly |
+	echo test && "$1" echo 2>/dev/null ${HOME} | "$1" cd 2>/dev/null 'quoted text'
+		sed --verbose 2>/dev/null local sed local x=1 export readonly local 2>/dev/null
+		cd | then printf local && --verbose "$@" "$@"
+	"$@" local sed $(pwd) ${HOME} /usr/bin
+		then && x=1 $(pwd) && echo done cd x=1 --verbose printf
+${HOME} | awk "$@" "$1" echo ${HOME}
+		| "$@" $(pwd) test ${HOME} $(pwd)
+'quoted text' then "$@" awk 2>/dev/null
+		&& 'quoted text' readonly
+	$(pwd) 'quoted text' -eu export export awk
+-eu done 'quoted text' && echo /usr/bin | --verbose local cd
+	&& && /usr/bin /usr/bin cd --verbose then test "$1" readonly
+/usr/bin /usr/bin grep
+	$(pwd) /usr/bin ${HOME} echo /usr/bin --verbose local | printf then |
+&& | readonly && then done x=1 | then 2>/dev/null export awk local $(pwd) test
+then readonly sed -eu ${HOME} x=1 awk sed && grep
+sed "$1" echo -eu printf awk -eu && awk 2>/dev/null cd 'quoted text'
+sed | 'quoted text' x=1 grep test 2>/dev/null ${HOME} printf /usr/bin
+done 2>/dev/null awk test done local done $(pwd) sed grep local
+printf sed local grep -eu sed sed --verbose readonly | | --verbose readonly
+done then "$@" test x=1 | awk 2>/dev/null readonly local && echo done awk "$@" 2>/dev/null
+		-eu test export done "$1" "$1" x=1 local export 'quoted text'
+		export printf readonly 'quoted text' 2>/dev/null readonly
+"$@" -eu x=1 && then --verbose --verbose awk /usr/bin | cd readonly ${HOME}
+	then 2>/dev/null /usr/bin $(pwd)
+		done && awk readonly 2>/dev/null awk then 'quoted text' grep readonly
+	readonly "$@" test /usr/bin $(pwd) 2>/dev/null && /usr/bin
+"$1" then 'quoted text' sed ${HOME} export | /usr/bin 2>/dev/null ${HOME}
+		cd test cd then --verbose grep readonly
+export 'quoted text' --verbose grep
+awk done printf 'quoted text'
+printf ${HOME} ${HOME} done -eu "$1"
+/usr/bin printf | --verbose grep -eu "$@" echo printf
+local local grep then export done --verbose local ${HOME}
+	2>/dev/null "$@" 'quoted text' export --verbose
+echo | echo readonly done echo test cd x=1 done
+	-eu grep grep | done awk && $(pwd) done
+	$(pwd) grep && grep echo
+grep $(pwd) && local "$@" printf "$@"
+then local echo 'quoted text' printf x=1 x=1 && export export printf printf echo
+'quoted text' local -eu readonly | grep cd ${HOME} -eu echo grep then
+test then "$1" readonly awk 2>/dev/null readonly done "$1" |
+	readonly ${HOME} | then 'quoted text' 'quoted text'
+	| test "$@" echo && "$1" --verbose "$1" 2>/dev/null echo | "$1" /usr/bin
+readonly cd | /usr/bin done | test -eu test cd /usr/bin 2>/dev/null
+/usr/bin done x=1 x=1 readonly readonly
+| readonly awk --verbose | sed "$@" 2>/dev/null sed
+	${HOME} cd sed $(pwd) 'quoted text' x=1 ${HOME} done then sed --verbose export
+	$(pwd) $(pwd) --verbose then /usr/bin "$1"
+		awk cd /usr/bin export "$1" export | --verbose
+	-eu printf cd /usr/bin x=1 "$1" test done ${HOME} printf done
+		"$1" && cd --verbose sed $(pwd) && ${HOME} "$@" done test 2>/dev/null
+		${HOME} $(pwd) $(pwd) local readonly sed local ${HOME} | done
+awk $(pwd) readonly 'quoted text'
+	"$@" --verbose -eu ${HOME} 'quoted text' $(pwd) echo ${HOME} done local
+		sed x=1 grep done export readonly cd 2>/dev/null
+test sed $(pwd) ${HOME} sed local printf 2>/dev/null test echo
+/usr/bin cd "$1" readonly echo printf export printf
+		export ${HOME} "$1" |
+	sed --verbose "$1" readonly "$@" echo local && && cd x=1 readonly printf then
+	then awk /usr/bin readonly /usr/bin $(pwd) test then $(pwd) printf sed 'quoted text'
+-eu then test --verbose -eu then local
+		2>/dev/null printf && $(pwd) "$@" grep
+	-eu 2>/dev/null -eu test 2>/dev/null cd "$@" "$@" local "$@" readonly then
+		-eu --verbose && $(pwd) && x=1 x=1 sed | ${HOME} test --verbose
+		-eu local -eu --verbose --verbose $(pwd) ${HOME}
+	readonly awk /usr/bin test | && "$@" printf echo
+	$(pwd) test echo 'quoted text' x=1 echo 'quoted text'
+	"$@" readonly local sed --verbose sed
+		printf "$@" then 'quoted text' local 2>/dev/null
+		--verbose sed sed readonly $(pwd)
+		awk printf cd grep printf x=1 echo test then awk printf
+		$(pwd) -eu grep done awk awk echo
+	sed printf && | /usr/bin 2>/dev/null readonly sed
+		--verbose readonly sed | $(pwd) awk test --verbose then 'quoted text'
+		"$@" | x=1 | ${HOME} $(pwd) done /usr/bin --verbose cd awk
+		x=1 --verbose 'quoted text' test "$1" "$1" then "$@"
+	grep export /usr/bin sed --verbose 'quoted text' cd readonly
+		${HOME} | x=1 echo /usr/bin cd --verbose
+then awk cd done 'quoted text' ${HOME}
+		&& 'quoted text' 'quoted text' readonly /usr/bin && then cd local awk done
+readonly | local grep && readonly /usr/bin awk 'quoted text' -eu printf
+	printf x=1 /usr/bin done sed printf
+		| local then "$1" "$1" "$1" -eu done /usr/bin then
+		"$1" && sed readonly x=1 echo cd "$@" | done | echo awk | grep
+		"$1" /usr/bin grep sed
+		x=1 then && cd 2>/dev/null x=1 sed then 2>/dev/null --verbose test
+	$(pwd) ${HOME} then sed | /usr/bin -eu readonly -eu awk -eu | echo printf
+	printf local done awk test 'quoted text' --verbose
+		cd $(pwd) test then x=1 --verbose 'quoted text' | --verbose
+	2>/dev/null awk readonly -eu printf 'quoted text'
+		| -eu $(pwd) 'quoted text' 'quoted text' ${HOME} test $(pwd)
+	'quoted text' 2>/dev/null ${HOME} /usr/bin --verbose 2>/dev/null -eu export /usr/bin
+		'quoted text' cd awk export /usr/bin $(pwd) | /usr/bin local
+&& /usr/bin | printf 'quoted text' echo
+2>/dev/null sed ${HOME} "$@" --verbose printf sed x=1 done local sed 2>/dev/null
+	$(pwd) $(pwd) 'quoted text' x=1 $(pwd) && x=1 done /usr/bin /usr/bin export
+	grep readonly $(pwd) --verbose ${HOME} /usr/bin | 'quoted text'
+	grep $(pwd) 'quoted text' /usr/bin && 'quoted text' then x=1 sed && done readonly
+-eu "$@" && /usr/bin printf awk x=1
+-eu 2>/dev/null grep && test
+	cd local $(pwd) done && && readonly ${HOME} 'quoted text' $(pwd)
+	"$@" ${HOME} /usr/bin --verbose
+		/usr/bin then done "$@" printf readonly sed 2>/dev/null --verbose
+${HOME} $(pwd) readonly --verbose grep grep cd
+		"$@" test printf $(pwd) printf cd grep | done cd 2>/dev/null cd readonly
+		--verbose 'quoted text' $(pwd) done grep awk x=1 local
+		echo done printf -eu done cd cd "$1" -eu -eu echo x=1 local /usr/bin echo --verbose
+	&& --verbose echo done /usr/bin 'quoted text' printf -eu x=1 done "$@"
+		$(pwd) readonly && -eu |
+	"$@" sed readonly echo | && "$@" export done local $(pwd) /usr/bin done
+		2>/dev/null 2>/dev/null -eu
+/usr/bin "$@" echo --verbose
+	"$1" "$@" then x=1 | export "$1"
+test readonly sed -eu 'quoted text' printf ${HOME} -eu grep /usr/bin $(pwd)
+		grep awk echo -eu -eu cd local 'quoted text' test export awk done "$1" cd &&
+		local test awk 'quoted text' test echo 'quoted text' && echo export | -eu 2>/dev/null
+	awk x=1 export export then 'quoted text' then local grep
+		| -eu 'quoted text' "$1" && readonly && cd | "$@" test done awk
+	'quoted text' 'quoted text' export then grep /usr/bin sed
+		readonly x=1 echo $(pwd) sed
+		$(pwd) test $(pwd) 'quoted text' | 2>/dev/null --verbose "$1"
+printf test local local test "$1" "$@" 'quoted text'
+sed cd sed sed 'quoted text'
+	'quoted text' echo test cd /usr/bin "$@" ${HOME} test awk /usr/bin
+	readonly done $(pwd) --verbose "$1" export 'quoted text' done then ${HOME}
+export ${HOME} $(pwd) done then awk sed -eu echo "$1"
+		test echo local awk sed grep printf && /usr/bin $(pwd) sed awk sed $(pwd) echo
+		export | printf echo x=1 /usr/bin test awk export && &&
+	sed export -eu -eu x=1 readonly
+export sed awk cd $(pwd) -eu local /usr/bin done && 'quoted text' ${HOME}
+	done sed "$1" ${HOME} ${HOME} awk done printf --verbose
+--verbose ${HOME} then -eu readonly local test grep | cd
+	awk done ${HOME} "$1" sed
+		local sed readonly x=1 sed "$@" --verbose
+printf test ${HOME} | --verbose printf 2>/dev/null
+	--verbose x=1 && export local
+		"$@" $(pwd) local x=1 2>/dev/null --verbose /usr/bin &&
+"$1" $(pwd) then done && 2>/dev/null /usr/bin
+/usr/bin local grep then | grep 2>/dev/null
+		cd $(pwd) && /usr/bin -eu "$1" "$1" -eu then test x=1 "$@" awk
+	export awk -eu awk "$@" awk local ${HOME} "$@" done then --verbose
+'quoted text' local "$1" 'quoted text' -eu grep readonly && -eu export
+	echo && | awk local cd -eu sed done
+"$1" test echo test grep readonly export local --verbose
+done export sed done echo echo && 'quoted text'
+	readonly /usr/bin readonly test cd sed -eu awk sed 'quoted text' 'quoted text'
+done ${HOME} local "$@" x=1 done "$1" "$1" awk
+		echo then test then done /usr/bin
+grep && 'quoted text'
+	echo awk && -eu test awk 2>/dev/null -eu done readonly 'quoted text'
+done "$1" cd awk sed echo grep x=1 export -eu awk --verbose then readonly awk
+		export ${HOME} 2>/dev/null
+		--verbose sed --verbose grep readonly --verbose done readonly
+		2>/dev/null 2>/dev/null cd 'quoted text'
+--verbose export 2>/dev/null
+grep "$1" test echo sed echo 'quoted text'
+&& ${HOME} /usr/bin then done | then export
+	test echo printf "$@" echo 'quoted text' 'quoted text'
+	cd && --verbose printf readonly -eu sed -eu -eu
+/usr/bin echo echo awk /usr/bin grep readonly then "$@" echo done
+	-eu readonly done /usr/bin test echo | awk grep 2>/dev/null
+export $(pwd) echo done ${HOME} printf local "$1" local then readonly
+	done readonly && | readonly printf export x=1 readonly awk then printf
+test 2>/dev/null && printf && export then
+	$(pwd) echo grep 2>/dev/null
+/usr/bin echo export && test $(pwd) ${HOME} "$1" local
+readonly printf then $(pwd) ${HOME} local test
+sed ${HOME} sed export sed grep then done "$1" export
+	cd test cd grep | sed "$@"
+grep local "$@" $(pwd) --verbose echo cd echo
+		'quoted text' "$@" readonly then --verbose --verbose 'quoted text'
+	/usr/bin sed && test && | test --verbose sed --verbose ${HOME}
+		"$1" /usr/bin "$1" 2>/dev/null
+	readonly "$1" echo echo $(pwd) test export sed "$@" ${HOME} then
+	local cd cd readonly | printf $(pwd) && echo
+"$@" $(pwd) printf cd 'quoted text' 'quoted text'
+	done done && ${HOME} grep awk x=1
+		done awk export cd echo
+-eu "$@" "$@" then $(pwd) | sed grep "$@" -eu $(pwd)
+	echo | echo done 'quoted text' /usr/bin | echo | "$1"
+done done ${HOME} && "$1"
+		"$@" --verbose --verbose export /usr/bin
+x=1 'quoted text' 'quoted text' ${HOME} ${HOME} printf echo awk awk readonly
+		${HOME} readonly cd -eu grep $(pwd) $(pwd) done 'quoted text' then done
+		printf sed | awk && then sed readonly ${HOME}
+		test done | --verbose sed x=1 cd printf ${HOME}
+	'quoted text' && cd | echo "$1"
+		'quoted text' 2>/dev/null $(pwd) -eu then && $(pwd) /usr/bin --verbose
+'quoted text' then readonly | --verbose cd then x=1 done 2>/dev/null
+	$(pwd) export | awk 'quoted text' sed && test
+		printf echo local | x=1 readonly awk 2>/dev/null | cd 2>/dev/null
+	awk export -eu x=1 "$@" grep --verbose $(pwd) $(pwd) local done grep
+		&& -eu --verbose 'quoted text' x=1 | done readonly x=1
+		$(pwd) -eu awk -eu readonly "$@" /usr/bin && test export
+		$(pwd) readonly -eu done x=1
+-eu 2>/dev/null x=1 done && 'quoted text' "$1" "$1" "$@" grep sed --verbose
+	awk /usr/bin cd 2>/dev/null readonly
+		local "$@" ${HOME} -eu printf ${HOME} | ${HOME} -eu x=1 awk test $(pwd)
+		printf done echo echo then && echo then -eu
+		| | echo -eu "$@" local | cd readonly -eu test && readonly done /usr/bin
+"$1" $(pwd) readonly readonly sed x=1 done
+--verbose then export "$@" cd -eu awk --verbose
+readonly then test && test /usr/bin
+sed sed --verbose "$@" printf /usr/bin 2>/dev/null test test --verbose /usr/bin
+${HOME} "$@" cd x=1 ${HOME} local export | --verbose ${HOME} export x=1 then
+		--verbose $(pwd) -eu ${HOME} sed readonly $(pwd) "$@" -eu
+	-eu | | echo test echo x=1 x=1
+	${HOME} /usr/bin /usr/bin test local | "$1" readonly
+	"$@" 2>/dev/null -eu --verbose x=1 "$@" -eu /usr/bin | cd x=1 test printf
+		cd done --verbose $(pwd) -eu | sed grep grep && $(pwd) 'quoted text'
+2>/dev/null | ${HOME} 2>/dev/null | -eu && -eu then echo awk printf
+	&& "$1" 2>/dev/null $(pwd) "$1"
+		'quoted text' echo awk --verbose
+	2>/dev/null $(pwd) awk ${HOME} 'quoted text' /usr/bin local
+&& | sed ${HOME} grep
+	"$@" -eu awk echo readonly ${HOME} $(pwd) printf "$1" x=1 ${HOME}
+-eu readonly "$1" /usr/bin
+${HOME} local "$@" -eu x=1 ${HOME} test -eu export ${HOME}
+	"$1" export | then echo $(pwd) grep then && sed cd "$@" x=1 echo -eu then
+test --verbose | grep $(pwd) /usr/bin echo local "$1" 'quoted text' test
+		export then "$@" "$1" /usr/bin export readonly $(pwd) && grep "$@"
+		'quoted text' test 2>/dev/null "$@" sed 2>/dev/null local
+'quoted text' cd && "$1" ${HOME} /usr/bin && then -eu 'quoted text'
+		2>/dev/null done 2>/dev/null ${HOME} local 'quoted text' ${HOME} readonly printf
+		sed export && /usr/bin grep
+awk grep --verbose local then | export
+	"$@" grep /usr/bin ${HOME} printf
+		grep --verbose export | grep $(pwd) readonly
+cd export awk printf "$@" readonly grep && "$1" --verbose
+		"$@" export then printf /usr/bin && sed then sed export --verbose $(pwd) local ${HOME}
+		cd printf x=1 awk -eu /usr/bin local
+	sed 2>/dev/null 2>/dev/null 2>/dev/null x=1 grep -eu "$1"
+	cd test 2>/dev/null $(pwd) test $(pwd)
+	"$1" 'quoted text' "$@" awk echo ${HOME} -eu $(pwd) x=1 /usr/bin "$@"
+		test sed done awk --verbose echo local
+	2>/dev/null test ${HOME} readonly | cd cd
+	export grep cd /usr/bin awk test
+	then local 'quoted text' readonly test printf --verbose /usr/bin grep done /usr/bin
+	printf $(pwd) x=1 --verbose then test -eu done 2>/dev/null 'quoted text' done grep
+		| grep /usr/bin ${HOME} export --verbose -eu --verbose 2>/dev/null "$1"
+		--verbose readonly 2>/dev/null sed readonly echo 'quoted text'
+$(pwd) x=1 printf cd export readonly awk "$@" x=1 $(pwd) /usr/bin
+grep 'quoted text' done awk | && x=1 cd "$1"
+		"$@" ${HOME} then "$1" cd "$@" printf ${HOME}
+	-eu printf readonly ${HOME} x=1 -eu 'quoted text' test | | test 'quoted text'
+grep readonly 2>/dev/null 2>/dev/null
+${HOME} 'quoted text' then sed export local local cd then done /usr/bin -eu
+| --verbose "$@" done ${HOME}
+sed --verbose && cd 'quoted text' 2>/dev/null --verbose
+	awk --verbose && done x=1
+	export "$1" ${HOME} grep cd done readonly /usr/bin --verbose 2>/dev/null --verbose
+		&& -eu "$@" 'quoted text' x=1 grep | "$@" test grep /usr/bin
+awk 'quoted text' export
+		&& export x=1 done && cd 2>/dev/null --verbose $(pwd) --verbose
+		'quoted text' | $(pwd) 2>/dev/null 2>/dev/null
+then readonly grep $(pwd) grep 2>/dev/null then $(pwd) echo
+		sed echo 'quoted text' --verbose sed -eu | 'quoted text'
+echo $(pwd) sed export x=1 done
+	2>/dev/null then $(pwd) --verbose ${HOME} && test sed $(pwd) --verbose
+	sed ${HOME} 2>/dev/null local 'quoted text' --verbose echo
+		| sed x=1 | cd local grep grep sed awk
+"$@" grep ${HOME} $(pwd) export cd x=1 test /usr/bin | 2>/dev/null
+	"$@" -eu test grep done test readonly
+		awk 'quoted text' grep local 'quoted text' "$@" $(pwd) test 'quoted text'
+		printf cd && cd readonly awk /usr/bin cd ${HOME} done done
+'quoted text' $(pwd) sed --verbose grep $(pwd) cd $(pwd) cd awk
+/usr/bin $(pwd) readonly "$1" -eu $(pwd)
+	${HOME} "$@" "$@" readonly test && readonly printf printf ${HOME} ${HOME}
+	"$1" 'quoted text' x=1 done && x=1 local then then grep sed
+	sed grep done readonly /usr/bin | echo /usr/bin export $(pwd) "$1"
+		-eu printf printf | cd /usr/bin
+local printf x=1 sed -eu
+		--verbose local awk 'quoted text'
+		export test $(pwd) $(pwd) sed
+	done done export 'quoted text'
+test grep readonly ${HOME} printf /usr/bin 'quoted text' then 2>/dev/null
+	| | 2>/dev/null done && echo && sed x=1 cd cd printf echo grep /usr/bin
+	grep "$@" --verbose 2>/dev/null echo x=1 then sed 2>/dev/null cd export
+grep export "$1" grep /usr/bin
+	x=1 cd -eu cd 2>/dev/null "$@" x=1 2>/dev/null "$1" awk done && "$@"
+test cd && then /usr/bin --verbose x=1 echo grep --verbose
+	cd awk sed sed awk sed 'quoted text' grep awk x=1
+printf $(pwd) ${HOME} $(pwd)
+		x=1 cd then grep sed
+		2>/dev/null printf --verbose done sed done 2>/dev/null awk local local -eu
+x=1 done export export --verbose ${HOME} echo 'quoted text'
+		awk then /usr/bin | x=1 --verbose -eu
+	echo x=1 && readonly ${HOME} done local && --verbose then | ${HOME} 'quoted text'
+	then test /usr/bin awk ${HOME} x=1 echo cd readonly 2>/dev/null
+		echo --verbose sed sed $(pwd) x=1 ${HOME} --verbose x=1 $(pwd) /usr/bin
+export 2>/dev/null done sed --verbose export 'quoted text'
+done grep $(pwd) 2>/dev/null ${HOME} 'quoted text'
+	--verbose x=1 cd sed | echo "$@" readonly local cd x=1 "$1" done 'quoted text'
+		/usr/bin && export local sed
+		echo local 'quoted text' -eu printf echo 'quoted text' local "$1" /usr/bin
+		readonly /usr/bin --verbose grep -eu 2>/dev/null cd test test "$1" --verbose readonly
+		-eu readonly test && awk "$1" &&
+	then --verbose "$@" grep test --verbose /usr/bin awk done "$@" ${HOME} x=1
+	done /usr/bin export printf $(pwd) x=1 awk 'quoted text' -eu "$@" then cd | 'quoted text'
+		--verbose && | awk ${HOME} --verbose
+	"$1" then sed printf cd | awk ${HOME} -eu export export
+		grep "$@" then cd "$@" export "$1" -eu
+	/usr/bin $(pwd) "$1" echo echo
+		printf 'quoted text' "$@" cd readonly -eu /usr/bin sed then $(pwd) export
+x=1 test readonly local export printf local | done -eu printf -eu "$@" --verbose
+	$(pwd) 'quoted text' "$@" sed cd | echo printf $(pwd) readonly 2>/dev/null
+	$(pwd) export "$@" local local printf test readonly
+	"$1" test | then then "$1" ${HOME} --verbose $(pwd) then sed then sed printf
+	awk readonly 2>/dev/null test
+		then echo grep && echo $(pwd) cd printf
+		-eu export cd ${HOME} local | --verbose readonly 'quoted text' && "$1" ${HOME}
+	local done local --verbose cd && ${HOME} 'quoted text'
+		-eu then sed 'quoted text' 2>/dev/null | $(pwd) sed readonly
+		grep readonly sed echo printf 'quoted text' 2>/dev/null /usr/bin done echo
+--verbose then awk ${HOME}
+grep $(pwd) ${HOME} then echo printf done 'quoted text' grep "$@"
+		| echo grep $(pwd) cd x=1 "$@" | ${HOME} /usr/bin "$1" sed -eu
+	'quoted text' && grep
+x=1 x=1 printf printf awk /usr/bin /usr/bin "$1" readonly printf
+	grep cd then grep done 'quoted text' local ${HOME} local then grep done
+	grep | grep export sed 'quoted text'
+		echo && echo test awk export export --verbose --verbose
+		x=1 ${HOME} echo cd && x=1 local test "$@" -eu then "$@" done "$@"
+		grep done "$1" test 2>/dev/null --verbose then 2>/dev/null
+echo local readonly echo -eu then 2>/dev/null | cd "$1" echo 'quoted text' then
+		sed local export echo --verbose 'quoted text' 'quoted text'
+$(pwd) ${HOME} cd ${HOME} readonly /usr/bin --verbose
+	printf test then printf --verbose sed test printf "$1" grep /usr/bin $(pwd)
+		"$@" && "$1" | /usr/bin x=1 /usr/bin 2>/dev/null readonly cd export
+printf test then export | export ${HOME}
+		cd --verbose grep ${HOME} 2>/dev/null then export awk --verbose
+printf export --verbose | $(pwd) "$1" 'quoted text' echo
+	local && export x=1 x=1 --verbose echo echo
+		done sed ${HOME} then ${HOME}
+		export readonly && echo --verbose test test printf
+		test $(pwd) "$@" export readonly
+		local x=1 export echo test 2>/dev/null grep awk test
+	"$@" done /usr/bin echo 2>/dev/null then
+	2>/dev/null cd $(pwd) && 'quoted text'
+"$@" 'quoted text' grep then x=1 test grep test readonly 2>/dev/null
+	done grep printf -eu echo "$1" local test then -eu $(pwd) && ${HOME}
+"$@" | done readonly grep "$@" test printf readonly done
+grep echo x=1 local grep awk 'quoted text' /usr/bin
+grep test -eu then printf 'quoted text' -eu x=1 --verbose cd readonly 'quoted text'
+--verbose readonly local readonly sed -eu grep x=1 awk echo
+		readonly /usr/bin --verbose readonly readonly printf echo "$1" cd
+		'quoted text' -eu printf | sed awk x=1 && test ${HOME}
+		grep test readonly sed |
+export "$1" 'quoted text' /usr/bin cd $(pwd) 'quoted text'
+&& "$1" "$1" && test grep then done export ${HOME}
+		export $(pwd) /usr/bin "$1" && local printf "$@" 'quoted text' --verbose x=1 then
+	done 'quoted text' /usr/bin 'quoted text' grep grep -eu --verbose
+awk cd x=1 'quoted text' awk awk x=1 readonly 'quoted text' 'quoted text' 'quoted text'
+| /usr/bin | "$@" readonly echo $(pwd) echo 2>/dev/null
+"$@" awk | echo "$1" $(pwd) --verbose /usr/bin 2>/dev/null /usr/bin x=1 local
+		then -eu 2>/dev/null "$1"
+	printf readonly test
+sed 'quoted text' 2>/dev/null | 2>/dev/null "$@" printf export $(pwd)
+		export echo ${HOME} $(pwd) 'quoted text' grep "$1" sed
+awk --verbose 'quoted text' printf "$@" 2>/dev/null
+		export done $(pwd) | awk test | export x=1 ${HOME} 'quoted text' awk ${HOME}
+--verbose -eu test cd x=1 && "$1" test
+		| -eu /usr/bin done -eu printf export && && 2>/dev/null 2>/dev/null
+	--verbose sed 2>/dev/null 2>/dev/null x=1 --verbose "$@" | sed awk readonly
+export "$@" readonly awk readonly /usr/bin test --verbose $(pwd)
+		local sed && awk -eu readonly cd 2>/dev/null --verbose 2>/dev/null
+&& 2>/dev/null | echo sed $(pwd) readonly test echo readonly cd && cd grep
+echo export awk -eu $(pwd) "$1" "$1" /usr/bin readonly
+	&& cd 2>/dev/null "$@" local echo --verbose --verbose
+local 'quoted text' |
+'quoted text' cd x=1 sed && export then local 2>/dev/null readonly done
+&& /usr/bin echo 2>/dev/null printf 'quoted text' local echo ${HOME}
+	x=1 x=1 export -eu 2>/dev/null
+test 'quoted text' x=1 printf "$1" awk
+		awk grep local grep /usr/bin cd 'quoted text' grep "$@" then grep 2>/dev/null
+awk cd && then echo done x=1 then test $(pwd) printf
+printf awk | grep --verbose | cd x=1 export "$@" && | | printf &&
+	2>/dev/null --verbose -eu -eu readonly
+		${HOME} x=1 echo grep 2>/dev/null "$1" readonly ${HOME} cd
+	echo /usr/bin awk 'quoted text'
+	x=1 sed sed | && $(pwd) test grep 2>/dev/null echo cd cd then
+	x=1 2>/dev/null cd done grep $(pwd) echo done "$@" sed
+	sed | local /usr/bin | -eu
+		echo 'quoted text' 'quoted text' readonly /usr/bin
+readonly readonly printf readonly
+		&& printf $(pwd) grep x=1 ${HOME} cd 'quoted text' done 'quoted text'
+done x=1 /usr/bin --verbose
+	local test $(pwd) done echo -eu printf "$1" $(pwd) $(pwd) 2>/dev/null
+		2>/dev/null done $(pwd) 2>/dev/null done local /usr/bin
+	then $(pwd) -eu ${HOME}
+	&& done test test "$@" test echo test test done --verbose ${HOME} sed awk
+$(pwd) export local /usr/bin
+grep readonly --verbose
+	$(pwd) "$@" cd 2>/dev/null $(pwd) | then cd local x=1
+-eu 'quoted text' printf echo 'quoted text' && local printf echo | x=1 --verbose
+	'quoted text' 2>/dev/null "$@" echo test test local
+${HOME} printf local && test awk $(pwd) export
+		then readonly -eu sed awk grep echo "$@" 2>/dev/null -eu local "$@" then
+		awk | x=1 && sed "$@" export export 2>/dev/null
+		test done x=1 export awk | 'quoted text'
+local -eu /usr/bin echo test | ${HOME} x=1 | test test | export ${HOME} -eu --verbose
+	&& test readonly /usr/bin cd "$@" awk sed echo ${HOME} $(pwd)
+		$(pwd) grep readonly $(pwd) "$@" then printf
+	-eu printf && sed cd $(pwd) export --verbose
+	then -eu local x=1 echo | "$@" test
+echo local then cd awk grep
+--verbose "$1" /usr/bin export
+		cd "$@" printf /usr/bin
+	| --verbose printf readonly export
+	"$1" --verbose && cd x=1 -eu | grep | 2>/dev/null $(pwd)
+		cd && 'quoted text' -eu "$@" done echo -eu | cd printf echo --verbose printf
+	x=1 awk local ${HOME} x=1 readonly
+awk sed | printf 'quoted text' printf $(pwd) &&
+&& $(pwd) echo "$1" test --verbose then ${HOME} | x=1 export 'quoted text'
+	2>/dev/null printf 2>/dev/null ${HOME} "$1" $(pwd) echo cd ${HOME} --verbose
+		&& export && printf grep 2>/dev/null /usr/bin echo
+2>/dev/null then "$@" && 'quoted text'
+grep 'quoted text' 'quoted text' --verbose "$@" --verbose ${HOME} sed cd
+export cd ${HOME} ${HOME} echo export awk && | test awk
+		x=1 --verbose cd awk x=1 printf 2>/dev/null
+		--verbose ${HOME} $(pwd) $(pwd) ${HOME}
+		--verbose $(pwd) cd echo
+		sed awk echo x=1 export echo printf readonly 'quoted text'
+&& then grep --verbose x=1 && echo -eu -eu cd local /usr/bin "$1" export
+	awk && && && x=1 grep 2>/dev/null
+		'quoted text' then "$1" --verbose && grep readonly printf
+	$(pwd) && 2>/dev/null readonly then printf
+	sed ${HOME} grep "$1" "$1" done --verbose --verbose 'quoted text' --verbose
+	"$@" /usr/bin && export sed printf export echo -eu
+echo grep --verbose then printf /usr/bin
+		2>/dev/null printf done cd /usr/bin --verbose 2>/dev/null printf /usr/bin sed
+	cd /usr/bin readonly $(pwd) cd readonly ${HOME} printf readonly echo cd -eu
+		echo test export && -eu $(pwd) readonly 'quoted text' grep 2>/dev/null done
+&& then "$1" echo ${HOME} export done done
+--verbose 2>/dev/null test && echo x=1 cd export export ${HOME} done /usr/bin
+		readonly $(pwd) echo export | done done test done awk "$1" 'quoted text'
+		"$1" -eu && 'quoted text' 'quoted text' && 'quoted text' 2>/dev/null /usr/bin
+	| done grep 'quoted text' 'quoted text' echo
+		/usr/bin && /usr/bin "$1" && cd && test x=1 2>/dev/null test
+	$(pwd) ${HOME} grep local readonly
+	test x=1 export awk grep x=1 local x=1 2>/dev/null sed /usr/bin
+--verbose && x=1 && x=1 sed "$@" grep && x=1 test
+		then /usr/bin /usr/bin 'quoted text' then x=1 printf
+		"$1" "$@" 2>/dev/null --verbose | --verbose awk | ${HOME} -eu sed "$1" "$1" x=1
+done test done readonly sed --verbose
+then "$@" | | test grep 2>/dev/null then /usr/bin /usr/bin export ${HOME}
+sed local printf readonly awk cd "$1" then done
+	$(pwd) /usr/bin printf awk "$@" test awk --verbose readonly -eu
+	done export printf 'quoted text' then --verbose
+		| -eu printf export "$@" "$@" $(pwd) printf "$1" grep 2>/dev/null
+		2>/dev/null echo echo cd $(pwd) --verbose printf 'quoted text'
+	readonly x=1 "$@" then test sed 2>/dev/null "$1" "$@" ${HOME}
+printf grep then $(pwd)
+	export $(pwd) ${HOME} grep
+		then local 'quoted text' ${HOME} local
+	export /usr/bin local 2>/dev/null
+		grep cd 2>/dev/null 'quoted text'
+		done test test "$1" then done 'quoted text' x=1 "$@" ${HOME} --verbose -eu
+echo --verbose local readonly 'quoted text' $(pwd) grep
+	echo then cd /usr/bin export
+| cd grep $(pwd) cd 'quoted text' --verbose grep --verbose "$1" | -eu printf ${HOME}
+		| ${HOME} 'quoted text' x=1 && --verbose export | printf
+	| done awk grep grep -eu 'quoted text' echo
+	printf done $(pwd) && --verbose "$1" -eu
+2>/dev/null grep export echo $(pwd)
+	/usr/bin readonly test then "$@" 'quoted text' --verbose
+&& 'quoted text' echo x=1 sed done echo /usr/bin
+		then /usr/bin printf sed | | $(pwd) printf
+	&& /usr/bin local cd "$@" printf 'quoted text' /usr/bin --verbose
+	2>/dev/null test "$1" x=1 cd -eu "$1"
+		echo -eu sed sed "$@" && grep $(pwd) $(pwd) printf readonly --verbose
+local done 2>/dev/null printf echo ${HOME} 'quoted text' test grep 2>/dev/null
+		sed then test && grep local sed awk echo local "$1" export
+	readonly printf "$@" "$1" awk $(pwd)
+	-eu then awk then ${HOME} test ${HOME} | --verbose --verbose ${HOME} "$1" --verbose
+		cd grep sed ${HOME} -eu --verbose printf "$@"
+	/usr/bin echo /usr/bin export awk 2>/dev/null
+	${HOME} export done 2>/dev/null done && echo export
+	x=1 | done done test then local /usr/bin export readonly sed sed
+	x=1 cd sed printf printf then "$@" awk test done $(pwd) /usr/bin
+	'quoted text' 2>/dev/null sed
+		test printf cd local echo readonly then printf printf echo readonly
+		then test /usr/bin printf grep $(pwd) sed sed grep "$1" "$@" x=1 -eu --verbose
+	"$@" $(pwd) done done test test awk | "$@" && sed export
+&& readonly grep | -eu --verbose /usr/bin awk "$@"
+readonly done readonly /usr/bin sed cd
+		| /usr/bin readonly $(pwd) export ${HOME} printf 2>/dev/null
+		--verbose export test 2>/dev/null 'quoted text'
+		awk 'quoted text' test $(pwd) && sed x=1 'quoted text' --verbose
+		"$1" | local grep --verbose --verbose printf
+echo printf ${HOME} 2>/dev/null export 2>/dev/null
+	export echo x=1 2>/dev/null sed grep sed && echo done test echo
+		--verbose -eu readonly 2>/dev/null printf test awk | done awk -eu done
+x=1 "$@" sed | test export readonly | "$@"
+/usr/bin local "$@" "$@" --verbose sed --verbose --verbose "$@" | export
+		cd cd readonly awk $(pwd) awk test --verbose -eu "$1" "$@" -eu done
+	echo readonly sed $(pwd) cd done -eu cd $(pwd) "$1" "$1" awk awk then local
+	test 2>/dev/null x=1 'quoted text' x=1 "$1" done export grep "$@"
+printf | local test x=1 local 'quoted text'
+	/usr/bin x=1 test local test echo then /usr/bin done
+${HOME} ${HOME} x=1 x=1 sed "$1" done readonly test $(pwd) 2>/dev/null
+		grep x=1 readonly /usr/bin x=1 export 2>/dev/null
+grep "$@" readonly 'quoted text'
+	"$@" awk -eu ${HOME} && --verbose
+readonly ${HOME} --verbose test --verbose -eu sed grep -eu 'quoted text' grep 2>/dev/null
+	printf done echo awk readonly grep printf ${HOME} cd cd
+export 2>/dev/null && /usr/bin "$1" awk awk export
+	2>/dev/null local $(pwd) ${HOME} done cd done "$@" readonly cd readonly
+		&& -eu --verbose && awk test test readonly
+		awk | /usr/bin then sed ${HOME} printf x=1 &&
+	done printf local readonly $(pwd) local $(pwd)
+	2>/dev/null cd printf | -eu x=1 | "$1" printf sed done then echo 2>/dev/null
+	grep grep && x=1 x=1 'quoted text' grep 'quoted text'
+		${HOME} grep readonly test
+	x=1 ${HOME} 2>/dev/null /usr/bin export 2>/dev/null export 'quoted text'
+grep cd --verbose 2>/dev/null $(pwd) x=1
+		sed awk $(pwd) /usr/bin 2>/dev/null
+	test then awk cd done --verbose local --verbose
+$(pwd) test --verbose export
+		'quoted text' /usr/bin 2>/dev/null /usr/bin echo
+x=1 --verbose export 2>/dev/null done sed awk echo readonly --verbose readonly
+		| done done | export -eu test printf
+		test -eu test -eu readonly "$1" awk /usr/bin export --verbose cd cd
+	printf test --verbose export "$1"
+		cd then && grep | echo ${HOME} sed 'quoted text' export then awk /usr/bin --verbose
+grep done cd printf $(pwd) $(pwd) sed 'quoted text' local then cd test done printf
+		awk && export $(pwd) printf | ${HOME} readonly && ${HOME} ${HOME}
+	'quoted text' awk /usr/bin grep sed
+	done $(pwd) 2>/dev/null awk "$@" test grep awk grep | | $(pwd) x=1 "$1" /usr/bin
+		$(pwd) awk grep test cd --verbose readonly sed
+	${HOME} $(pwd) cd local 2>/dev/null $(pwd) x=1 printf | "$@"
+echo --verbose 2>/dev/null export $(pwd) export then done "$1" sed cd | "$@" |
+		2>/dev/null local local ${HOME} done test then test && x=1
+2>/dev/null /usr/bin echo /usr/bin ${HOME} readonly grep
+	export -eu grep printf printf local 2>/dev/null then
+	cd sed ${HOME} 'quoted text' then -eu readonly
+awk /usr/bin $(pwd) ${HOME} ${HOME} export 2>/dev/null ${HOME}
+		awk export local --verbose local && ${HOME} export && echo && export
+grep "$@" done sed sed | then local /usr/bin sed done && then awk
+	x=1 cd grep export test local then awk
+		printf | x=1 then "$@" test $(pwd)
+cd printf $(pwd) echo x=1 test grep -eu 'quoted text'
+		then --verbose awk export ${HOME} 2>/dev/null test done "$1" echo 'quoted text'
+		x=1 --verbose grep test done test readonly
+		printf | -eu export sed -eu
+x=1 x=1 awk "$1" "$@" sed ${HOME} | "$@" ${HOME} 'quoted text' readonly
+		"$@" 2>/dev/null done &&
+		2>/dev/null sed $(pwd) /usr/bin
@@ -0,0 +1,2001 @@
+		'quoted text' && grep local readonly test export && "$1"
+-eu -eu local | awk "$1" echo sed ${HOME} &&
+readonly && 2>/dev/null
+		'quoted text' cd ${HOME} 'quoted text' test 2>/dev/null then && local x=1 2>/dev/null
+	test 2>/dev/null printf grep x=1 && && printf -eu printf then echo | awk
+	/usr/bin cd then test sed test echo sed then cd ${HOME} && cd grep $(pwd)
+		"$@" x=1 $(pwd) awk echo echo | "$@" /usr/bin grep
+	export done | test test printf sed export cd export cd echo export ${HOME} readonly
+	"$@" awk sed $(pwd) "$1" && | 2>/dev/null
+test /usr/bin 'quoted text'
+	/usr/bin sed -eu sed $(pwd) | done "$@" done "$@" then |
+	2>/dev/null | "$1" 'quoted text'
+then printf echo $(pwd) readonly
+export 2>/dev/null x=1 /usr/bin export awk
+sed export readonly echo $(pwd) ${HOME} then sed
+		export export grep printf /usr/bin "$@" 'quoted text' /usr/bin /usr/bin sed
+		2>/dev/null /usr/bin x=1 "$1" cd /usr/bin awk "$@" readonly
+		/usr/bin 2>/dev/null printf ${HOME} 'quoted text' "$@" then "$1" "$1" local &&
+		printf export then $(pwd)
+		echo printf -eu then --verbose
+		2>/dev/null ${HOME} | readonly readonly cd printf awk test | readonly "$@" awk 2>/dev/null
+2>/dev/null echo $(pwd) readonly printf
+		--verbose done ${HOME} grep echo x=1 then readonly
+		test readonly $(pwd) test "$1"
+-eu cd printf 2>/dev/null $(pwd) test echo &&
+cd cd --verbose export awk grep "$@" x=1 cd readonly ${HOME}
+		$(pwd) printf local "$1" readonly awk local ${HOME} 'quoted text' cd
+awk --verbose $(pwd) && test grep printf
+		done && then printf echo echo printf local printf /usr/bin sed awk awk && x=1
+cd printf ${HOME} printf then x=1 readonly echo "$@" "$@" "$@" --verbose echo done
+		x=1 'quoted text' "$1" echo printf x=1 readonly sed then
+readonly cd done 2>/dev/null x=1 x=1 then && awk --verbose | export
+		grep printf && readonly $(pwd) 2>/dev/null export
+	local done 2>/dev/null /usr/bin then printf local 2>/dev/null export
+		-eu ${HOME} test 'quoted text' $(pwd)
+echo && --verbose -eu done cd /usr/bin x=1 then /usr/bin ${HOME} "$1" 'quoted text'
+	x=1 grep done local /usr/bin awk -eu
+		cd 'quoted text' x=1 && && export export done awk "$1" export echo "$1" x=1 awk
+	sed printf then local readonly ${HOME}
+		x=1 test 'quoted text' grep $(pwd) 2>/dev/null
+| cd printf $(pwd) --verbose && grep awk 2>/dev/null test echo cd ${HOME}
+	&& 'quoted text' grep x=1
+		'quoted text' x=1 awk echo
+	cd /usr/bin done cd then "$@" awk printf $(pwd) x=1 ${HOME} awk done "$1" | --verbose
+		${HOME} $(pwd) "$@" --verbose -eu x=1 'quoted text'
+$(pwd) /usr/bin "$@" sed done && readonly "$1" "$@"
+${HOME} "$@" test "$1" test then printf grep readonly export
+	/usr/bin test echo -eu "$1" local "$1" 'quoted text' cd done readonly
+--verbose "$1" | done "$@" sed 2>/dev/null "$@" then sed grep "$@" x=1 "$@" printf
+	readonly /usr/bin test export
+"$@" ${HOME} "$1" -eu export cd grep x=1 --verbose then -eu test x=1 "$1" "$@" printf
+	local $(pwd) "$1" /usr/bin sed $(pwd)
+	export 2>/dev/null sed x=1 done 2>/dev/null /usr/bin 'quoted text'
+2>/dev/null test cd 2>/dev/null
+-eu export 2>/dev/null
+	grep $(pwd) readonly readonly && echo readonly echo
+	cd | cd -eu 2>/dev/null readonly echo && "$1" ${HOME} awk x=1
+| /usr/bin ${HOME} printf $(pwd) -eu sed echo export grep 2>/dev/null
+	x=1 'quoted text' done --verbose grep export test "$@" | grep readonly echo
+--verbose sed && then "$1" test | $(pwd) $(pwd) | sed 2>/dev/null
+"$1" grep -eu done echo
+printf printf 2>/dev/null /usr/bin "$@" $(pwd) $(pwd) ${HOME}
+		sed awk test $(pwd) then
+	x=1 "$@" printf "$1" | sed && then done
+	$(pwd) printf "$1" grep printf /usr/bin done done x=1 /usr/bin
+		&& awk 2>/dev/null done
+		readonly then ${HOME} sed export sed grep done 2>/dev/null
+--verbose awk /usr/bin sed local 2>/dev/null
+	readonly x=1 'quoted text'
+		'quoted text' 'quoted text' $(pwd) 2>/dev/null --verbose
+printf --verbose printf cd export ${HOME} "$@"
+	done 2>/dev/null /usr/bin
+2>/dev/null sed local echo 'quoted text' 2>/dev/null
+echo && -eu local "$1" echo printf cd 'quoted text' 'quoted text' cd ${HOME}
+		x=1 echo then done 2>/dev/null echo readonly | printf
+	test cd -eu --verbose grep $(pwd) awk then /usr/bin grep $(pwd) -eu "$@" cd 'quoted text'
+	done ${HOME} "$1" && "$1"
+2>/dev/null x=1 printf x=1 2>/dev/null sed && --verbose
+printf /usr/bin grep x=1 readonly 'quoted text' 2>/dev/null readonly | cd ${HOME}
+	/usr/bin grep "$1" then | echo $(pwd)
+		cd --verbose local printf done echo grep echo 'quoted text'
+awk 2>/dev/null "$1" grep awk x=1 'quoted text' export echo
+export local test ${HOME} 2>/dev/null
+cd $(pwd) local echo -eu 'quoted text'
+		echo done --verbose sed awk echo | ${HOME} -eu "$1" printf cd export --verbose
+		2>/dev/null | readonly "$1" sed && /usr/bin /usr/bin
+	$(pwd) ${HOME} -eu echo 2>/dev/null test /usr/bin cd /usr/bin
+readonly cd --verbose -eu /usr/bin --verbose echo local | echo
+	&& grep done printf export awk grep | readonly 'quoted text'
+		x=1 'quoted text' done done local local
+x=1 test printf printf "$1" ${HOME} cd echo ${HOME}
+		/usr/bin awk then -eu "$@" && x=1 sed | cd x=1 && -eu cd -eu
+"$@" local readonly export
+	sed then -eu export && export && |
+		export sed "$1" readonly readonly x=1 x=1 | x=1 && 'quoted text'
+		| printf readonly && awk then awk && -eu grep | /usr/bin
+	echo local "$@" 'quoted text' test 2>/dev/null printf test cd awk readonly
+awk awk --verbose 2>/dev/null /usr/bin
+done printf "$@" $(pwd) ${HOME} echo test local /usr/bin
+	sed "$1" done printf export -eu printf $(pwd)
+	readonly --verbose echo grep /usr/bin -eu "$1"
+		2>/dev/null local && readonly && x=1 ${HOME} done "$1" 2>/dev/null /usr/bin
+	then ${HOME} done 'quoted text' then ${HOME} 2>/dev/null $(pwd) --verbose
+	cd "$@" "$1" -eu && x=1 "$1" then
+	&& -eu $(pwd) printf local local ${HOME} -eu "$1" awk | 'quoted text'
+	local x=1 x=1 2>/dev/null sed 'quoted text' cd | 2>/dev/null -eu grep grep
+	readonly "$1" "$1" then $(pwd) -eu
+		grep /usr/bin then -eu --verbose sed test awk "$@" sed printf
+done printf printf "$@" | && $(pwd) cd grep local --verbose local then
+"$1" then awk "$@" echo "$@" 2>/dev/null
+'quoted text' printf 'quoted text' && readonly export
+	/usr/bin /usr/bin awk test && done 'quoted text' cd 2>/dev/null | readonly readonly
+local $(pwd) local "$1" local 2>/dev/null && export
+		| --verbose $(pwd) "$@" x=1
+	readonly local grep 'quoted text' --verbose
+	"$@" -eu "$@" x=1 printf then 2>/dev/null && | "$1" grep $(pwd)
+awk $(pwd) sed printf awk "$1"
+echo ${HOME} -eu awk export awk awk
+	2>/dev/null cd awk then -eu --verbose
+		| awk ${HOME} && test x=1 "$1" local 'quoted text' grep && sed local
+	$(pwd) | test export "$1"
+		local x=1 $(pwd) sed then $(pwd)
+		${HOME} cd $(pwd) x=1 done "$@" 'quoted text' 'quoted text'
+x=1 --verbose -eu awk /usr/bin 'quoted text' done --verbose
+	printf awk sed then then done
+		cd | ${HOME} "$1" test && 2>/dev/null export test $(pwd) /usr/bin $(pwd) test
+		/usr/bin $(pwd) 'quoted text' echo grep sed then ${HOME} then 'quoted text'
+"$@" 2>/dev/null awk &&
+	readonly "$1" then "$1" $(pwd) "$1" -eu grep
+	then --verbose -eu /usr/bin --verbose export 2>/dev/null test $(pwd) echo 2>/dev/null
+		grep ${HOME} 'quoted text'
+	--verbose ${HOME} sed test 2>/dev/null cd local | local
+		x=1 export test /usr/bin --verbose | 'quoted text'
+	-eu export "$1" "$1" printf then x=1 x=1 local x=1 awk 'quoted text'
+		test ${HOME} --verbose $(pwd)
+		| && | 'quoted text' && /usr/bin local then | awk cd "$@"
+done grep test x=1 cd | $(pwd) export sed | "$@" "$1" done x=1 --verbose
+$(pwd) 'quoted text' done | /usr/bin export
+		awk readonly ${HOME} printf grep export awk -eu x=1 --verbose
+	local cd grep test $(pwd) ${HOME} --verbose local local local x=1 printf export
+cd echo $(pwd) cd echo x=1 ${HOME} | grep sed $(pwd) "$1" then test "$1" test cd
+2>/dev/null sed && test "$@" awk "$1"
+cd then "$@" "$@" --verbose && -eu "$@" /usr/bin --verbose x=1 export
+		&& "$1" -eu grep | cd 'quoted text' x=1 sed cd "$@" $(pwd) done
+	sed printf "$@" "$1" printf -eu local printf --verbose
+	local x=1 then local x=1 "$1" 2>/dev/null
+		export | -eu $(pwd) && ${HOME} test awk cd done test -eu test readonly grep
+	grep /usr/bin 2>/dev/null -eu ${HOME} 'quoted text'
+test -eu printf ${HOME} --verbose readonly test
+		readonly export --verbose --verbose cd done printf readonly $(pwd) | then export
+	2>/dev/null "$@" 'quoted text' 2>/dev/null 2>/dev/null && awk grep $(pwd) cd test
+		then echo printf ${HOME} sed && grep 'quoted text' test
+echo export done local test ${HOME} "$1" $(pwd) then readonly
+		local | /usr/bin awk printf
+	"$1" export $(pwd) cd grep readonly
+		x=1 --verbose /usr/bin local cd | | done | readonly ${HOME} printf
+		${HOME} | /usr/bin 2>/dev/null "$1" "$@" echo cd
+	&& echo export --verbose export && export sed awk --verbose /usr/bin readonly printf
+		awk readonly /usr/bin --verbose --verbose readonly $(pwd)
+	--verbose && /usr/bin /usr/bin "$1" $(pwd) local 2>/dev/null grep readonly
+	| export awk 2>/dev/null sed done /usr/bin readonly "$@" "$1" && cd ${HOME} x=1
+'quoted text' readonly then "$@" grep
+"$1" export $(pwd) x=1 grep sed local
+cd then "$@" sed export local x=1 x=1 "$@" grep sed /usr/bin
+awk cd test then -eu -eu /usr/bin 2>/dev/null /usr/bin done x=1 awk "$@" readonly
+		$(pwd) $(pwd) sed cd -eu | grep 2>/dev/null "$1"
+	| "$1" --verbose cd printf && ${HOME} export
+	"$@" awk grep ${HOME} x=1 --verbose
+		$(pwd) done echo grep "$@" | done local 'quoted text' awk
+	"$1" -eu "$1" -eu local done local awk ${HOME} ${HOME} awk test $(pwd)
+		"$1" grep 2>/dev/null echo awk -eu && x=1 done local sed
+		&& 'quoted text' done then then /usr/bin | then "$1"
+--verbose | /usr/bin "$1" | local printf ${HOME} export
+cd ${HOME} done $(pwd) "$1" ${HOME} awk "$@" --verbose ${HOME} cd "$@" then done
+"$1" echo then | done cd && readonly local
+		done "$1" -eu awk awk $(pwd) 'quoted text' readonly x=1
+"$1" 'quoted text' sed && /usr/bin $(pwd) readonly | readonly sed | sed 'quoted text'
+		&& awk grep printf echo echo then "$@" "$1" "$1"
+		&& done cd x=1 sed -eu 'quoted text'
+		cd "$1" | done 'quoted text' |
+		export x=1 ${HOME} then --verbose x=1
+${HOME} local ${HOME} 2>/dev/null 2>/dev/null grep 2>/dev/null "$1" 2>/dev/null
+x=1 "$1" $(pwd) local sed done "$@" cd "$1"
+	done local sed && && $(pwd) 2>/dev/null
+/usr/bin printf echo --verbose
+-eu 'quoted text' "$1" "$@" cd 2>/dev/null 2>/dev/null export
+		readonly 2>/dev/null
+x=1 test test sed grep printf
+	awk local test awk local export "$1" done export grep ${HOME} $(pwd) then $(pwd)
+		printf -eu -eu "$1" && --verbose export
+	/usr/bin awk test 2>/dev/null "$@" export
+cd "$1" /usr/bin grep 2>/dev/null && && echo
+	readonly x=1 grep /usr/bin "$1" x=1 --verbose -eu
+	echo x=1 -eu cd | 2>/dev/null readonly
+	local done test x=1 then echo 'quoted text' grep /usr/bin test 2>/dev/null
+printf readonly sed /usr/bin echo "$@" -eu echo local 'quoted text'
+	cd "$@" x=1 'quoted text' ${HOME} then 'quoted text' local
+		2>/dev/null echo done then
+		local $(pwd) --verbose
+	&& cd "$@" sed echo --verbose awk "$1" | -eu
+		$(pwd) ${HOME} x=1 printf /usr/bin done test
+"$@" $(pwd) "$@" 2>/dev/null --verbose && test /usr/bin
+	| x=1 ${HOME} cd sed printf --verbose awk $(pwd) test "$@" | readonly "$@" cd 2>/dev/null
+	test export echo grep export $(pwd)
+		local printf /usr/bin && /usr/bin test
+readonly test $(pwd) 2>/dev/null /usr/bin echo -eu x=1 local | test
+		"$1" awk echo ${HOME} printf export | $(pwd)
+		then awk 'quoted text' && done awk x=1 -eu -eu x=1 then sed "$1"
+	"$@" 2>/dev/null grep local 2>/dev/null sed test "$@" grep printf
+		export printf test x=1 done 2>/dev/null && 2>/dev/null printf /usr/bin readonly
+	-eu 2>/dev/null readonly printf readonly --verbose export $(pwd)
+	export x=1 'quoted text' then cd
+"$@" grep export -eu --verbose /usr/bin
+	cd "$@" "$@" "$1" && awk x=1 printf "$@" printf /usr/bin 2>/dev/null && 'quoted text'
+	grep test x=1 x=1 cd "$1" cd ${HOME} --verbose "$@" x=1 /usr/bin x=1 awk
+test && --verbose 'quoted text' | then "$1" -eu $(pwd) && then $(pwd)
+	then ${HOME} --verbose export "$1" 2>/dev/null test local ${HOME}
+		"$@" done sed "$1" done "$@" $(pwd)
+		| "$@" 2>/dev/null sed "$@" | --verbose $(pwd) | "$1"
+		-eu cd "$1" then grep cd $(pwd)
+	readonly "$@" test cd 2>/dev/null 2>/dev/null
+sed 'quoted text' grep 2>/dev/null
+		/usr/bin grep then "$@" cd 2>/dev/null /usr/bin $(pwd) x=1 2>/dev/null cd "$1"
+grep test echo sed "$1" 'quoted text' "$1" 'quoted text'
+sed ${HOME} readonly "$1" grep 2>/dev/null
+x=1 cd echo /usr/bin "$1" done sed printf readonly
+	--verbose test --verbose /usr/bin /usr/bin ${HOME} /usr/bin $(pwd)
+	'quoted text' 'quoted text' && "$1" $(pwd) -eu echo x=1 local done readonly
+	${HOME} sed grep --verbose done export
+		&& ${HOME} x=1 export printf && | -eu "$@" "$1" "$@" 'quoted text'
+	awk printf /usr/bin && readonly ${HOME} 2>/dev/null then
+readonly /usr/bin 2>/dev/null $(pwd) then sed sed done 'quoted text' x=1 export
+		&& test readonly export 'quoted text' grep x=1 awk 'quoted text'
+		$(pwd) cd && "$@" ${HOME} test then x=1 done "$1" readonly awk -eu sed
+		export x=1 /usr/bin "$@" "$1" grep
+	test "$@" -eu "$@" "$@" -eu "$@" echo test then awk cd --verbose local cd
+		"$1" echo && readonly 2>/dev/null sed echo
+echo test $(pwd) sed readonly cd then awk
+/usr/bin /usr/bin done
+sed ${HOME} test awk readonly readonly -eu /usr/bin then
+		local 2>/dev/null $(pwd) | printf awk "$@" test 2>/dev/null
+		then awk then export awk export x=1 then echo grep cd x=1 awk -eu export
+		awk test -eu /usr/bin done grep /usr/bin 'quoted text'
+		echo /usr/bin | x=1 2>/dev/null
+then ${HOME} $(pwd) echo printf
+		sed local grep --verbose then local sed grep cd 'quoted text'
+| readonly then then $(pwd) "$@" "$@" 'quoted text'
+	then readonly /usr/bin sed | ${HOME} /usr/bin local 2>/dev/null --verbose -eu |
+		cd | --verbose export test cd | readonly 2>/dev/null /usr/bin
+awk ${HOME} done export then $(pwd)
+	x=1 awk "$1" grep /usr/bin grep "$@" /usr/bin x=1 done -eu 'quoted text'
+		echo $(pwd) test "$1" export export awk | $(pwd) 'quoted text'
+| export && grep 'quoted text' done --verbose echo
+	awk awk local && && test export done awk printf "$1" done done printf /usr/bin test
+test cd --verbose test ${HOME} -eu 2>/dev/null readonly
+echo 2>/dev/null printf "$@" 2>/dev/null local -eu --verbose 'quoted text'
+"$1" 2>/dev/null done readonly /usr/bin 2>/dev/null printf && done echo
+grep grep echo -eu cd $(pwd) done 2>/dev/null "$@" awk "$1" cd
+		sed export $(pwd) 'quoted text' 'quoted text'
+	echo -eu $(pwd) local echo then $(pwd)
+		x=1 export ${HOME} | export done x=1 cd test /usr/bin awk
+| local done local x=1 local ${HOME} x=1 --verbose echo readonly -eu grep sed
+		printf echo echo readonly sed "$@" 2>/dev/null readonly
+		2>/dev/null 'quoted text' "$1" test x=1 test
+awk $(pwd) --verbose awk "$@" 'quoted text' grep ${HOME} 2>/dev/null
+	awk then $(pwd) then 'quoted text' /usr/bin x=1 printf printf ${HOME} --verbose
+	${HOME} -eu echo sed "$1" $(pwd) $(pwd) awk $(pwd) done sed export
+		${HOME} test printf x=1 x=1 sed export local x=1 cd export cd
+		/usr/bin readonly | 'quoted text'
+"$@" /usr/bin grep local -eu then cd export
+	&& -eu "$@" done 2>/dev/null && --verbose done && 2>/dev/null x=1 awk --verbose
+		2>/dev/null -eu test | cd /usr/bin x=1 2>/dev/null 'quoted text' "$1" readonly
+	&& done grep $(pwd) "$1" 'quoted text' grep
+	readonly $(pwd) then -eu -eu | printf && cd /usr/bin 'quoted text' --verbose
+		done 2>/dev/null /usr/bin $(pwd) x=1 cd then test printf "$1" && 'quoted text'
+"$1" done printf --verbose
+	test done "$@" test && | printf
+		echo test grep /usr/bin "$@" readonly /usr/bin "$1" | && |
+		'quoted text' export
+	"$1" ${HOME} ${HOME} export awk then && "$1" -eu "$1" awk
+	| "$1" done readonly cd "$@" 'quoted text' test &&
+	'quoted text' && 'quoted text' done -eu local && awk readonly /usr/bin
+$(pwd) export done | "$@" "$@"
+		'quoted text' $(pwd) awk readonly ${HOME} grep sed ${HOME} -eu local echo awk
+	grep then -eu then sed 'quoted text' sed local sed test
+		grep -eu then printf then awk grep done "$@" done readonly
+		&& | then --verbose sed done test 'quoted text'
+		readonly printf done local | awk readonly /usr/bin printf
+	'quoted text' && printf local done
+/usr/bin readonly sed grep done $(pwd) sed x=1 $(pwd) local
+	| && ${HOME} printf x=1
+	x=1 test echo $(pwd) x=1 test export export
+--verbose /usr/bin --verbose readonly then 'quoted text'
+		| --verbose ${HOME} done awk /usr/bin ${HOME} 2>/dev/null $(pwd) ${HOME}
+	test 2>/dev/null $(pwd) printf ${HOME} cd awk /usr/bin awk
+	awk -eu "$@" ${HOME} ${HOME} then export --verbose done awk sed 2>/dev/null
+	then awk "$@" 'quoted text' ${HOME} sed local echo export readonly echo test
+	${HOME} | 'quoted text' then cd | local "$@" echo && x=1 then
+		done done --verbose x=1 "$@" done awk export done /usr/bin
+		'quoted text' -eu --verbose then done local -eu 2>/dev/null printf 'quoted text'
+		test --verbose "$@" then grep /usr/bin cd --verbose awk grep local /usr/bin
+		${HOME} test -eu test ${HOME} --verbose awk -eu export | $(pwd) /usr/bin
+		"$1" 'quoted text' && echo
+local local && -eu x=1 then sed "$1" x=1 /usr/bin
+		grep grep ${HOME} "$1" "$1" local
+		/usr/bin $(pwd) cd awk grep ${HOME} readonly export export | cd | grep
+		done | awk echo awk cd && printf
+&& && x=1 done 2>/dev/null | -eu -eu cd printf
+	x=1 export x=1 "$@" local then test
+cd --verbose | "$@" -eu local sed x=1 awk -eu echo printf readonly "$1"
+	"$@" test "$1" "$1" printf sed ${HOME} $(pwd) && --verbose
+		'quoted text' export 2>/dev/null grep /usr/bin 'quoted text'
+		2>/dev/null ${HOME} &&
+	${HOME} 2>/dev/null --verbose printf test && x=1 sed cd echo test "$1"
+	echo cd readonly then 2>/dev/null grep then sed echo readonly "$@" ${HOME} && then
+	${HOME} 'quoted text' "$@" grep "$1" /usr/bin 2>/dev/null
+export /usr/bin --verbose echo --verbose grep export sed 'quoted text' test done
+		export done $(pwd) 'quoted text' printf awk sed 'quoted text' && x=1
+		/usr/bin cd x=1 2>/dev/null
+		--verbose ${HOME} 'quoted text' local printf cd sed grep readonly readonly
+echo done ${HOME} 2>/dev/null $(pwd) ${HOME} export
+printf printf test && $(pwd) -eu --verbose then export echo sed done
+awk "$1" export sed "$@" 'quoted text' | test then cd x=1 'quoted text'
+-eu echo "$1" cd ${HOME} ${HOME} grep
+	2>/dev/null sed done
+	echo local echo "$1" |
+/usr/bin -eu printf && export
+	echo export x=1 --verbose readonly && sed "$@" cd "$@" -eu /usr/bin cd
+$(pwd) | then x=1 && awk
+readonly done awk awk readonly then done readonly x=1 ${HOME} /usr/bin
+"$@" && done export | x=1 -eu sed export "$@"
+	'quoted text' echo -eu then -eu awk done ${HOME} local
+then export done printf ${HOME} ${HOME} grep done export printf
+		| printf test cd ${HOME} ${HOME}
+	x=1 echo sed ${HOME} "$1" readonly 'quoted text' /usr/bin
+		'quoted text' echo "$@" $(pwd) $(pwd) /usr/bin done readonly readonly export
+	$(pwd) export sed x=1 awk x=1 $(pwd) && 2>/dev/null
+done "$1" export readonly local cd printf &&
+| "$1" sed -eu printf 2>/dev/null "$1" --verbose
+cd 'quoted text' echo "$1"
+		| test export x=1 then test printf ${HOME} grep x=1 readonly
+		'quoted text' ${HOME} && 2>/dev/null
+	local -eu local echo echo -eu "$@" grep 'quoted text'
+	&& /usr/bin sed "$1" $(pwd)
+		| grep sed export readonly
+	| export 2>/dev/null done awk "$@" "$@" test | x=1 echo /usr/bin "$@"
+local /usr/bin "$@" readonly && sed echo $(pwd) sed 2>/dev/null x=1 2>/dev/null
+	"$@" 'quoted text' done && export "$1"
+		${HOME} "$@" local -eu grep 'quoted text' echo ${HOME} export echo echo local
+		then 'quoted text' ${HOME} && awk 'quoted text'
+	sed grep 'quoted text' | sed echo && x=1 local $(pwd) grep awk awk
+		--verbose -eu echo && "$1" ${HOME} 2>/dev/null readonly
+echo x=1 test grep then | echo -eu
+	/usr/bin 2>/dev/null /usr/bin readonly 'quoted text'
+cd done && readonly $(pwd) then |
+		x=1 --verbose printf 'quoted text' grep
+	printf 2>/dev/null done $(pwd) $(pwd) -eu "$1" done awk
+${HOME} | echo echo awk -eu $(pwd) sed
+		local printf grep "$1" x=1 /usr/bin /usr/bin cd "$@" export then 'quoted text'
+		| ${HOME} $(pwd) sed sed done && /usr/bin sed && then then
+${HOME} /usr/bin local done then local && && local &&
+		grep 2>/dev/null 'quoted text' awk && readonly
+printf $(pwd) test awk x=1 /usr/bin -eu
+	local done | 2>/dev/null x=1 /usr/bin grep 2>/dev/null x=1 "$1" | grep printf
+grep "$1" cd | then cd sed readonly sed readonly done 'quoted text'
+		${HOME} $(pwd) cd 2>/dev/null --verbose awk test printf
+		&& 2>/dev/null done then x=1 cd then && grep grep sed "$1" echo cd ${HOME} |
+sed $(pwd) 'quoted text' then "$1" grep x=1 x=1 | readonly /usr/bin ${HOME} /usr/bin
+	local cd then done local export "$1" ${HOME} 2>/dev/null then "$@" x=1 export
+		| export && 'quoted text' done then echo
+		&& test done export printf | sed test | done cd "$@" /usr/bin
+	| local --verbose readonly /usr/bin | local
+	export readonly 2>/dev/null ${HOME} ${HOME} "$1" x=1 cd awk cd
+	printf sed local awk ${HOME} sed local awk then sed test $(pwd) "$@"
+		export | -eu readonly printf done done sed && x=1 x=1
+	export ${HOME} then local && grep 'quoted text' then $(pwd) $(pwd) test --verbose
+'quoted text' 'quoted text'
+	cd ${HOME} echo export printf then done
+readonly -eu grep printf sed "$@"
+-eu grep sed "$@" | 'quoted text' cd --verbose
+local readonly awk --verbose readonly export export 2>/dev/null
+echo | 2>/dev/null then 'quoted text'
+	echo echo 'quoted text' ${HOME} export "$@" $(pwd) local grep
+		--verbose sed && printf then | test
+		"$@" ${HOME} readonly grep --verbose
+| "$1" -eu export ${HOME} cd ${HOME} $(pwd) && sed $(pwd)
+	echo 'quoted text' "$1" done then && &&
+	$(pwd) --verbose sed then printf export sed test "$1" "$@" 2>/dev/null
+"$1" $(pwd) awk 'quoted text' && readonly
+2>/dev/null -eu local "$@" x=1 -eu -eu 2>/dev/null
+$(pwd) 'quoted text' awk ${HOME} --verbose
+		'quoted text' echo echo awk cd ${HOME} test "$1" x=1 then x=1 cd done local
+	readonly -eu sed /usr/bin x=1 done done then
+'quoted text' 'quoted text' --verbose export
+		x=1 /usr/bin && 'quoted text'
+	grep test x=1 x=1 local echo
+	cd grep && -eu && test awk grep then grep x=1 ${HOME} -eu cd echo cd /usr/bin
+	/usr/bin 'quoted text' export
+"$1" && then --verbose grep x=1 printf then && grep export echo
+local x=1 $(pwd) -eu 'quoted text' && printf
+	grep | echo grep then 'quoted text' $(pwd) local "$@" readonly test
+		done x=1 | 'quoted text'
+		/usr/bin ${HOME} test then then ${HOME} grep
+	printf 'quoted text' $(pwd) --verbose ${HOME} readonly "$1" ${HOME}
+awk awk /usr/bin 'quoted text' 'quoted text' /usr/bin 2>/dev/null --verbose grep
+	&& export sed x=1 grep -eu test $(pwd)
+		${HOME} echo done test $(pwd) awk "$@" "$1"
+		done local export && &&
+		echo cd sed && /usr/bin && -eu ${HOME}
+	readonly grep done awk then then export done
+	x=1 2>/dev/null | grep done done sed ${HOME} echo
+&& && "$1" 'quoted text' cd local done |
+		-eu ${HOME} test 2>/dev/null cd export
+		-eu -eu "$1" readonly 2>/dev/null 2>/dev/null grep
+		/usr/bin awk export -eu then local local 2>/dev/null
+		echo ${HOME} "$1" awk -eu awk export
+	then printf x=1 ${HOME} "$1" ${HOME} /usr/bin test --verbose
+&& grep readonly cd sed sed then printf | local sed 2>/dev/null 'quoted text'
+	printf "$@" echo test printf readonly cd
+	x=1 done /usr/bin "$@" test x=1 grep awk sed export "$1" readonly echo
+	'quoted text' 'quoted text' local
+	x=1 | "$1" done sed /usr/bin 2>/dev/null "$1" | x=1
+done 2>/dev/null $(pwd) grep local sed
+readonly /usr/bin "$1" sed test then grep done echo cd -eu then
+"$1" x=1 echo test export local $(pwd) echo 'quoted text' printf sed &&
+	-eu awk sed echo printf sed x=1 ${HOME} readonly -eu --verbose awk && test test
+	${HOME} grep $(pwd) 'quoted text' | --verbose cd
+		grep local "$@" /usr/bin 2>/dev/null awk test "$@" /usr/bin ${HOME}
+local readonly $(pwd) grep
+2>/dev/null done $(pwd) --verbose --verbose "$1"
+	2>/dev/null sed done --verbose echo &&
+awk done grep --verbose $(pwd) $(pwd)
+		&& done && "$@" "$@" readonly --verbose echo then
+test "$@" -eu | printf && done
+	2>/dev/null 'quoted text' 'quoted text' done && 2>/dev/null
+	/usr/bin done /usr/bin then grep awk done | echo ${HOME} 'quoted text'
+-eu x=1 awk grep test --verbose
+'quoted text' test /usr/bin ${HOME} local grep readonly && | export
+		cd --verbose cd readonly test
+		done "$1" --verbose 2>/dev/null && "$1" ${HOME}
+$(pwd) export printf awk export
+printf awk ${HOME} "$@"
+export awk 'quoted text' cd --verbose printf done
+		echo grep -eu export $(pwd) local local
+		"$1" cd done "$@" -eu sed grep | done --verbose
+${HOME} | local awk ${HOME} && export
+	"$@" local cd | awk grep && --verbose -eu echo printf grep -eu test cd 2>/dev/null
+		'quoted text' echo readonly grep ${HOME} && "$@" $(pwd) done 2>/dev/null
+	/usr/bin done awk awk "$@" | sed printf echo --verbose "$@" echo cd cd 'quoted text'
+		2>/dev/null $(pwd) --verbose test readonly "$@" test
+	then done test grep && 2>/dev/null cd export readonly then awk
+		x=1 test x=1 "$@" "$1" awk cd printf 'quoted text' --verbose
+	cd test "$@" x=1 grep readonly /usr/bin sed
+		-eu 2>/dev/null ${HOME} && cd then -eu x=1 /usr/bin x=1 done
+"$1" grep "$@" cd --verbose echo export then "$@" -eu $(pwd) cd test ${HOME}
+	--verbose echo awk --verbose readonly export "$1" cd 'quoted text'
+	grep cd awk local sed then readonly 'quoted text'
+		$(pwd) | "$1" sed grep --verbose ${HOME}
+	awk "$@" readonly $(pwd) /usr/bin x=1 | ${HOME} grep | "$@"
+	sed | cd printf echo ${HOME} 2>/dev/null
+	/usr/bin printf printf | echo sed
+		-eu cd cd 2>/dev/null awk | x=1 then printf ${HOME} local
+		readonly printf echo printf $(pwd) test sed local cd echo
+readonly --verbose sed then sed then
+	test "$1" done --verbose
+grep "$1" -eu --verbose then "$1" cd sed -eu ${HOME} ${HOME} 'quoted text'
+	/usr/bin | --verbose ${HOME}
+		printf /usr/bin awk 2>/dev/null local
+--verbose -eu /usr/bin -eu "$@" 'quoted text' "$@" sed then done local local
+	--verbose readonly test x=1 $(pwd) "$@" cd $(pwd)
+		export cd /usr/bin /usr/bin 'quoted text' -eu
+	| export test local "$@" x=1 $(pwd)
+		x=1 'quoted text' then /usr/bin then x=1 sed 2>/dev/null test
+		| test awk /usr/bin x=1 sed "$@" -eu && awk done printf export "$1"
+	x=1 awk --verbose x=1 -eu test | done && test 2>/dev/null then $(pwd)
+printf export x=1 test sed --verbose echo && awk 'quoted text' cd test --verbose
+${HOME} awk x=1 sed readonly done $(pwd)
+export "$1" --verbose -eu cd sed $(pwd) --verbose "$@" then
+export "$@" ${HOME} /usr/bin export 'quoted text' -eu ${HOME} readonly
+	"$1" && "$1" done printf /usr/bin 'quoted text' --verbose 2>/dev/null printf
+		grep sed awk sed readonly cd printf
+		"$1" 2>/dev/null echo cd
+		"$@" local 'quoted text'
+	awk awk printf cd test 2>/dev/null
+	"$@" local ${HOME} grep "$1" && ${HOME} grep "$1" --verbose done 'quoted text'
+'quoted text' printf sed local
+		| "$@" then --verbose x=1 printf sed "$1" 2>/dev/null
+		&& $(pwd) done sed then readonly done grep sed /usr/bin local done then --verbose
+		-eu && cd printf echo test echo "$1"
+		cd cd "$@" printf x=1 --verbose awk then --verbose
+| "$1" local echo echo export --verbose $(pwd) cd sed awk /usr/bin ${HOME} cd |
+		$(pwd) export ${HOME} readonly printf
+		/usr/bin "$1" then && test
+echo "$1" local | echo -eu $(pwd)
+local sed | export export cd readonly | echo done 'quoted text'
+cd test echo ${HOME} export "$@"
+		-eu /usr/bin x=1 readonly "$1" then 2>/dev/null printf /usr/bin ${HOME} local echo
+		&& x=1 grep && ${HOME} readonly && $(pwd) /usr/bin sed local "$@" test && local
+	done | --verbose --verbose
+/usr/bin 'quoted text' printf sed cd
+		done echo --verbose -eu readonly && cd && readonly readonly printf printf local
+		done cd ${HOME} -eu awk printf 'quoted text' printf
+| local ${HOME} 'quoted text' done "$@"
+	"$1" local cd $(pwd) sed && local && &&
+	&& printf 2>/dev/null sed done printf --verbose
+		2>/dev/null x=1 "$@" done awk | 2>/dev/null x=1 done /usr/bin grep x=1 "$@" then
+		--verbose grep printf "$1" done && export
+		printf local grep awk grep then local "$1" local $(pwd) local export
+		grep local ${HOME} local x=1 sed grep local && printf x=1
+	awk ${HOME} printf grep ${HOME} "$1" && grep printf
+		sed -eu /usr/bin "$1" 'quoted text' -eu $(pwd) printf then
+		"$1" then /usr/bin 2>/dev/null local export 2>/dev/null 'quoted text'
+		then -eu printf sed 'quoted text'
+	/usr/bin readonly export -eu -eu | sed done "$@" && test readonly printf | |
+	${HOME} "$@" $(pwd) then
+x=1 'quoted text' printf
+	done grep test "$1" grep echo
+		&& sed | && export export
+		x=1 awk -eu "$1" $(pwd) grep ${HOME} awk ${HOME} awk cd $(pwd) --verbose local
+	$(pwd) sed printf echo $(pwd) -eu $(pwd) 'quoted text'
+		echo 'quoted text' grep && 'quoted text' sed export sed 'quoted text' "$@"
+${HOME} printf done ${HOME}
+		printf && && test "$@" "$1" "$@" sed then
+	cd 'quoted text' grep then
+test then export grep --verbose | --verbose done awk done x=1 2>/dev/null
+		'quoted text' cd readonly printf x=1 &&
+	--verbose ${HOME} local done
+	"$1" 2>/dev/null "$@" | /usr/bin printf then && readonly "$1"
+	/usr/bin -eu grep /usr/bin && awk
+		${HOME} | then && done 2>/dev/null readonly 'quoted text' --verbose
+awk "$1" 2>/dev/null -eu test export readonly printf 2>/dev/null
+x=1 sed /usr/bin awk 'quoted text' -eu sed "$@" grep
+		${HOME} readonly "$1" && && /usr/bin | -eu cd sed | then ${HOME} printf $(pwd) export
+		export echo sed -eu local | grep test /usr/bin -eu cd x=1
+		'quoted text' --verbose then local grep
+	| "$@" done --verbose 2>/dev/null awk printf cd -eu echo x=1 printf
+export local test 2>/dev/null --verbose test cd then | sed grep $(pwd)
+${HOME} local then | /usr/bin /usr/bin -eu test done test
+	| 'quoted text' $(pwd) awk /usr/bin done local 'quoted text'
+		"$@" done "$@" ${HOME} done x=1 /usr/bin -eu sed ${HOME} ${HOME}
+		cd 2>/dev/null /usr/bin ${HOME} readonly sed "$@"
+		2>/dev/null test awk awk 2>/dev/null 2>/dev/null sed 2>/dev/null
+	--verbose cd | ${HOME} /usr/bin x=1 x=1 "$@" done 'quoted text'
+		/usr/bin cd awk grep "$1" /usr/bin | x=1 ${HOME} then printf
+cd | export cd echo test awk ${HOME} ${HOME} awk awk grep
+grep echo 2>/dev/null
+awk export done done cd x=1 2>/dev/null
+x=1 local "$@" test "$@" 2>/dev/null echo 2>/dev/null
+-eu grep test echo ${HOME} 2>/dev/null -eu -eu ${HOME} echo
+-eu done | export echo -eu
+/usr/bin echo awk x=1 readonly 'quoted text' $(pwd) export ${HOME} $(pwd) /usr/bin
+cd test cd then test local cd 2>/dev/null && export done -eu sed echo $(pwd)
+	then done "$1" "$@" --verbose 'quoted text'
+	&& /usr/bin $(pwd) local grep printf ${HOME} ${HOME} echo 'quoted text' 2>/dev/null
+		local $(pwd) sed local test 'quoted text'
+		export $(pwd) --verbose "$@" sed local export ${HOME} 2>/dev/null export awk printf
+		grep /usr/bin 2>/dev/null && cd printf export readonly 'quoted text'
+	local $(pwd) x=1 ${HOME} ${HOME} $(pwd) /usr/bin $(pwd) ${HOME} 2>/dev/null
+	"$1" --verbose $(pwd) --verbose | "$@" test 2>/dev/null cd local | test
+readonly awk grep && local awk awk local
+		cd "$@" local grep 2>/dev/null readonly "$@" -eu printf test sed && readonly grep
+${HOME} x=1 /usr/bin printf --verbose test echo 2>/dev/null --verbose test grep
+		done readonly 2>/dev/null "$@" awk cd test 2>/dev/null
+cd done $(pwd) ${HOME} awk "$1" && local awk sed printf -eu ${HOME} "$@" printf
+	"$1" $(pwd) $(pwd) echo echo export awk 'quoted text' $(pwd)
+	export && then $(pwd) 2>/dev/null done "$@" |
+	${HOME} $(pwd) cd -eu then "$@" grep 2>/dev/null grep export && local --verbose
+		printf grep done 2>/dev/null test "$@" --verbose done
+		"$1" done grep $(pwd) readonly
+grep 2>/dev/null awk 'quoted text' -eu $(pwd)
+		-eu --verbose 2>/dev/null local readonly readonly
+	${HOME} sed && && printf 'quoted text' cd awk x=1
+$(pwd) /usr/bin test /usr/bin x=1 $(pwd) cd printf echo awk
+readonly printf then $(pwd)
+test test grep ${HOME} | /usr/bin
+		grep grep "$1" -eu ${HOME} export done grep $(pwd) x=1 ${HOME} | && local
+x=1 "$@" x=1 x=1 && awk sed $(pwd) cd sed cd local
+echo printf sed test x=1 "$@" export "$@" | "$@" sed
+		cd cd && done done awk done x=1
+	export done echo then -eu
+/usr/bin grep 'quoted text' local x=1
+/usr/bin ${HOME} echo readonly printf grep --verbose $(pwd)
+		cd awk "$@" echo $(pwd)
+		"$@" && && awk cd "$1" cd export then readonly export -eu -eu 2>/dev/null
+		printf "$1" -eu $(pwd) /usr/bin done awk && local grep | local --verbose 2>/dev/null
+		done 'quoted text' | --verbose | 2>/dev/null then
+	cd grep local test ${HOME} printf x=1 printf 'quoted text'
+	test 2>/dev/null then local "$@" ${HOME} done --verbose then done x=1
+"$1" && --verbose sed cd grep 2>/dev/null sed readonly
+$(pwd) "$@" -eu awk ${HOME}
+echo -eu --verbose x=1 echo awk printf $(pwd) then && "$1" sed 2>/dev/null
+'quoted text' printf x=1 $(pwd) sed export --verbose local 2>/dev/null
+done then $(pwd) $(pwd) printf
+$(pwd) grep sed && sed readonly test
+		x=1 then "$1" done && -eu sed && 'quoted text' 2>/dev/null done readonly
+echo awk | /usr/bin done export grep --verbose x=1 export
+	-eu export --verbose "$@" $(pwd) done cd ${HOME} $(pwd) readonly
+		| 'quoted text' test 'quoted text' /usr/bin 'quoted text'
+		"$1" cd /usr/bin grep --verbose x=1 | 'quoted text' done then
+then "$1" x=1 grep cd
+		grep echo ${HOME} readonly x=1 awk -eu && | local "$@" awk local export
+--verbose | -eu test local done readonly echo && "$@" ${HOME}
+	echo -eu test | ${HOME} done x=1 "$1" $(pwd) test "$@" && $(pwd) sed ${HOME}
+	awk grep echo x=1 echo export
+		x=1 $(pwd) sed printf done grep cd
+		$(pwd) /usr/bin | -eu grep local sed "$@" $(pwd)
+		'quoted text' ${HOME} --verbose ${HOME} awk
+		| readonly echo awk 'quoted text' "$@" sed "$@" export
+	awk cd then && && export cd /usr/bin then "$1" -eu readonly then test --verbose
+		-eu grep sed cd then x=1 && /usr/bin "$1" readonly
+	-eu 2>/dev/null /usr/bin sed ${HOME} | | "$@"
+	done && && sed local done grep grep /usr/bin cd x=1 printf 'quoted text' x=1
+	${HOME} done | 'quoted text' "$@" readonly -eu local
+		echo | awk -eu test cd -eu ${HOME} "$@" 2>/dev/null
+--verbose -eu local export export
+		grep --verbose grep export $(pwd) sed 'quoted text' test
+cd awk local echo 'quoted text'
+		${HOME} then | test done "$@"
+printf /usr/bin echo ${HOME} readonly cd printf test awk 'quoted text' done readonly
+/usr/bin then "$@" grep test "$1" ${HOME} cd "$@" readonly cd printf
+	$(pwd) sed cd $(pwd) cd awk 'quoted text' awk $(pwd) test ${HOME} /usr/bin "$@"
+		local ${HOME} done x=1 $(pwd)
+	/usr/bin done cd && x=1
+x=1 "$1" export done local grep
+		$(pwd) | | done local cd && export && | grep then
+		echo "$1" then && -eu 2>/dev/null $(pwd)
+/usr/bin 2>/dev/null then 2>/dev/null --verbose --verbose sed readonly
+	&& "$1" x=1 2>/dev/null | grep echo export $(pwd) ${HOME} /usr/bin 'quoted text'
+	x=1 then export --verbose cd awk -eu export $(pwd) x=1 | 2>/dev/null | -eu ${HOME}
+		| "$1" x=1 | --verbose
+	then $(pwd) test 2>/dev/null ${HOME}
+		| | /usr/bin export 'quoted text' export ${HOME} "$@" echo x=1 && $(pwd)
+	printf grep /usr/bin $(pwd) local grep | x=1 "$@" --verbose local
+sed printf export cd test "$1" awk local -eu 'quoted text'
+	export && | ${HOME} echo export /usr/bin sed awk -eu && readonly
+		-eu | -eu -eu "$@" sed printf export test test then x=1 test "$1" &&
+		then "$@" sed local ${HOME} --verbose ${HOME} 2>/dev/null
+		test 'quoted text' "$@" readonly printf
+'quoted text' readonly
+	'quoted text' 2>/dev/null grep $(pwd) ${HOME} x=1 readonly
+sed cd readonly then 2>/dev/null grep readonly 2>/dev/null -eu grep "$1" x=1
+&& awk readonly "$1" grep "$1" awk && $(pwd) 'quoted text'
+		cd $(pwd) /usr/bin test x=1 export done export printf
+		'quoted text' --verbose local 2>/dev/null /usr/bin -eu readonly
+		local local && 'quoted text' printf 2>/dev/null cd printf sed
+	--verbose "$1" cd sed $(pwd) export then done local awk grep export
+	grep ${HOME} awk ${HOME} $(pwd) done sed test readonly
+export local done cd test cd && "$1" | -eu echo -eu echo grep && then local
+&& printf grep $(pwd) && test sed /usr/bin | x=1 awk awk "$@" x=1 readonly
+	| printf && echo | done test $(pwd) | export then local export readonly export
+echo x=1 'quoted text' $(pwd) 2>/dev/null -eu | /usr/bin
+	"$1" cd cd cd ${HOME} cd test && test echo printf sed
+		then awk "$1" echo | $(pwd) "$@"
+sed -eu sed local /usr/bin && test cd readonly awk 'quoted text' readonly
+-eu --verbose && cd test sed "$1" readonly
+	echo x=1 readonly local 'quoted text' local $(pwd)
+		${HOME} grep echo 2>/dev/null /usr/bin -eu test "$@" then -eu
+x=1 sed -eu --verbose 'quoted text'
+"$@" $(pwd) "$1" -eu echo sed echo $(pwd) --verbose then $(pwd)
+		cd /usr/bin --verbose 2>/dev/null $(pwd)
+echo ${HOME} readonly sed "$1" 2>/dev/null cd ${HOME}
+${HOME} export --verbose echo x=1 "$1" grep readonly cd -eu
+cd sed echo | local "$@" "$@" export 'quoted text'
+"$@" -eu 2>/dev/null x=1 -eu awk 2>/dev/null
+		x=1 done readonly | && --verbose
+		-eu | | 'quoted text' --verbose echo
+		awk "$1" export 'quoted text' readonly
+	test | echo "$@" "$1" -eu x=1 && test then
+		"$1" sed "$@" x=1 --verbose $(pwd) export echo
+	readonly "$@" -eu grep printf awk printf export
+	${HOME} export /usr/bin printf -eu 'quoted text' export
+		'quoted text' test export
+		"$@" export sed "$@" 'quoted text' awk && "$@"
+	&& 'quoted text' 2>/dev/null awk | test printf
+		${HOME} && 2>/dev/null ${HOME} --verbose ${HOME} awk
+-eu sed "$1" echo && | 2>/dev/null
+	-eu printf cd ${HOME} test --verbose grep cd done test
+/usr/bin $(pwd) grep printf | cd cd 'quoted text' $(pwd) "$@" ${HOME} export
+/usr/bin "$@" printf "$@" printf
+	"$@" /usr/bin x=1 echo printf
+	-eu x=1 -eu | 2>/dev/null ${HOME} done 2>/dev/null -eu x=1 test x=1
+"$1" ${HOME} cd x=1 then -eu echo && "$1" test -eu | printf
+awk "$1" readonly export "$@" sed sed
+		| echo sed 2>/dev/null sed readonly test echo -eu local done grep
+		then x=1 --verbose sed |
+		awk x=1 ${HOME} grep awk then done done $(pwd)
+	cd done then x=1 sed readonly awk then printf then
+awk grep --verbose "$1" printf "$1" local x=1 --verbose
+	&& "$@" $(pwd) $(pwd) | test then readonly 2>/dev/null echo done 2>/dev/null
+	done awk /usr/bin sed --verbose /usr/bin | local /usr/bin x=1 --verbose sed
+test export sed export -eu ${HOME} $(pwd) cd "$1" && printf grep -eu
+	sed local cd "$@" --verbose test
+	$(pwd) x=1 "$1" cd done local -eu ${HOME} readonly --verbose test local
+		sed echo readonly 'quoted text' ${HOME} printf echo 2>/dev/null printf
+		readonly "$1" echo grep 2>/dev/null cd && "$@" 'quoted text'
+		readonly test awk grep
+readonly export cd readonly
+grep ${HOME} printf --verbose
+echo cd echo printf awk sed cd 2>/dev/null $(pwd) done echo readonly
+	&& "$@" then ${HOME} "$1" readonly printf cd ${HOME}
+		export sed printf readonly
+	grep ${HOME} /usr/bin ${HOME} "$1" then echo ${HOME} cd
+"$1" then 'quoted text' x=1 && printf then 2>/dev/null local grep
+		grep ${HOME} 'quoted text' readonly echo 2>/dev/null cd test
+"$@" echo awk /usr/bin then ${HOME} cd printf | grep --verbose test $(pwd) test
+	${HOME} awk 2>/dev/null then x=1 then 'quoted text'
+		/usr/bin x=1 awk grep | done echo awk readonly /usr/bin export ${HOME} | x=1 grep
+	awk "$@" 2>/dev/null 'quoted text' x=1 | readonly test readonly
+test ${HOME} echo echo /usr/bin | awk done readonly --verbose "$@" 2>/dev/null
+echo readonly export && 2>/dev/null ${HOME} printf
+&& awk grep cd && echo && | 'quoted text' readonly test cd "$1" local then
+		sed local cd export done 2>/dev/null local export
+	'quoted text' sed && printf | 'quoted text' local export export printf
+	readonly 'quoted text' awk readonly "$1" "$1" x=1 cd -eu -eu
+	&& ${HOME} awk && -eu $(pwd) printf printf
+awk export then echo cd 'quoted text' ${HOME} &&
+	local local $(pwd) | x=1 export /usr/bin $(pwd)
+	2>/dev/null 'quoted text' local
+		export | awk done && sed awk "$@"
+'quoted text' sed "$@" && x=1 awk /usr/bin awk awk 'quoted text'
+	awk "$@" export awk -eu "$@"
+2>/dev/null printf x=1 x=1 --verbose echo grep x=1 echo
+		readonly local x=1 $(pwd)
+"$1" readonly && "$@"
+		2>/dev/null export x=1 printf x=1 /usr/bin
+		x=1 "$1" then echo "$@" | /usr/bin then sed
+"$@" readonly --verbose awk awk test cd $(pwd) -eu local sed x=1 cd
+		export export sed 'quoted text' --verbose -eu -eu echo done readonly printf cd echo
+		$(pwd) && "$@" done cd 2>/dev/null /usr/bin printf export grep awk -eu local /usr/bin
+		then | "$1" test sed sed
+| ${HOME} --verbose export then x=1 ${HOME}
+		$(pwd) $(pwd) printf 2>/dev/null
+		done awk cd echo 'quoted text' sed "$1" 'quoted text' | 2>/dev/null x=1 && sed x=1
+	cd && "$@" 2>/dev/null
+		&& done "$@" 2>/dev/null $(pwd) | x=1 cd readonly then "$@"
+		then && --verbose cd test 'quoted text'
+--verbose test "$1" local "$@"
+		"$1" "$1" grep test echo done cd grep test local readonly x=1 grep
+		readonly sed test export export ${HOME} echo x=1 -eu "$@" x=1 local /usr/bin
+		export echo cd | readonly readonly sed awk x=1 export local readonly
+	grep "$@" done readonly /usr/bin 'quoted text' $(pwd) --verbose readonly
+	| | 'quoted text' test readonly | |
+	cd export grep grep test sed test test echo done
+"$@" "$1" grep echo local echo grep awk printf cd grep
+grep 2>/dev/null 2>/dev/null "$@" 'quoted text'
+	local local local grep readonly --verbose
+		${HOME} | $(pwd) 'quoted text' then | /usr/bin && 2>/dev/null
+done then readonly -eu export "$@" echo -eu test awk then grep
+		-eu "$@" readonly done ${HOME} awk | x=1 -eu 2>/dev/null test
+then && test $(pwd) /usr/bin local done 2>/dev/null
+-eu && sed export 2>/dev/null -eu /usr/bin readonly
+	echo echo done 2>/dev/null
+	grep awk awk printf readonly ${HOME} printf ${HOME} awk
+-eu x=1 then x=1 x=1 then echo then readonly x=1 "$@" "$1" x=1
+then grep /usr/bin 2>/dev/null readonly
+	sed 2>/dev/null 'quoted text' $(pwd) /usr/bin
+	-eu export | | ${HOME} local
+		"$@" 2>/dev/null && $(pwd) ${HOME} && --verbose
+test "$@" /usr/bin printf cd | done | 'quoted text'
+"$@" test $(pwd) "$@" $(pwd) "$1"
+		--verbose 'quoted text' ${HOME} readonly local awk readonly awk x=1 2>/dev/null
+		then | printf cd /usr/bin && test printf
+	-eu "$1" && done cd local test -eu then | awk
+	$(pwd) "$@" $(pwd) --verbose cd | x=1 done 'quoted text' done "$1" then export
+	2>/dev/null 2>/dev/null x=1 cd && "$1" export echo && awk
+	--verbose /usr/bin echo local "$1" printf grep
+		x=1 "$@" printf echo cd x=1 then ${HOME} then test export grep then /usr/bin export
+		-eu sed -eu then export | /usr/bin local
+		awk && then --verbose /usr/bin && "$@" test local 2>/dev/null
+echo awk done 2>/dev/null done x=1 cd ${HOME}
+	&& 2>/dev/null $(pwd) done -eu
+		echo --verbose sed "$1" printf done x=1 sed --verbose
+	awk local cd x=1 | echo 2>/dev/null 'quoted text'
+x=1 x=1 "$@" "$1" readonly test x=1 grep then /usr/bin
+$(pwd) export grep test grep printf
+		'quoted text' x=1 test ${HOME}
+		echo cd grep then sed cd then
+awk readonly $(pwd) -eu 'quoted text' local ${HOME} sed |
+		| x=1 echo x=1 "$1" done --verbose
+	test grep export then "$@" export && awk x=1 export && && echo --verbose "$1"
+printf x=1 done export x=1 $(pwd) local --verbose "$@" $(pwd) echo awk
+	export cd && local then export --verbose done 'quoted text' /usr/bin
+		then local local $(pwd) printf -eu "$1" readonly
+&& then && echo 'quoted text' -eu "$1"
+		sed 2>/dev/null echo
+"$@" 2>/dev/null export "$1" echo x=1 x=1 then done echo -eu readonly export
+$(pwd) x=1 cd "$@" && grep && readonly ${HOME} done echo then readonly
+		--verbose $(pwd) && x=1 done export --verbose ${HOME}
+		local --verbose /usr/bin awk echo then "$1" cd | "$@" grep
+	/usr/bin x=1 cd 2>/dev/null local then test echo /usr/bin grep && then cd
+	then cd $(pwd) -eu && local /usr/bin cd 'quoted text' then | /usr/bin local |
+		x=1 $(pwd) --verbose x=1 --verbose 'quoted text' printf
+	test -eu /usr/bin grep $(pwd) ${HOME} $(pwd) 2>/dev/null done "$1" awk
+grep printf x=1 awk done readonly export local ${HOME} /usr/bin
+	x=1 sed test local awk "$@" cd local awk done "$@" "$1" echo x=1 "$1" "$@" ${HOME}
+grep -eu "$1" done printf 2>/dev/null "$@" $(pwd) "$@" echo --verbose
+		${HOME} 2>/dev/null done "$@" | sed then $(pwd) "$1"
+		export && test 'quoted text' "$1" done 2>/dev/null local 2>/dev/null grep local
+		2>/dev/null sed awk cd grep echo echo test
+	2>/dev/null /usr/bin printf
+'quoted text' 2>/dev/null
+| printf | then local then test printf echo then then ${HOME} | "$@" -eu
+		grep awk -eu x=1 grep
+		${HOME} --verbose readonly echo grep readonly then --verbose
+$(pwd) --verbose echo /usr/bin 2>/dev/null -eu awk | export
+	$(pwd) test "$@" | then x=1 --verbose then x=1 awk then
+--verbose /usr/bin x=1 done grep -eu
+		${HOME} --verbose 'quoted text' 2>/dev/null export export
+	-eu 2>/dev/null -eu echo printf
+		test cd then done echo /usr/bin printf grep then grep test 'quoted text'
+		2>/dev/null echo --verbose | && cd awk
+readonly awk 'quoted text' sed
+	"$@" grep then awk "$@" sed
+		&& echo x=1 done | $(pwd) test printf $(pwd) test x=1 export
+		"$@" done $(pwd) && --verbose /usr/bin awk sed "$1" export test "$@" cd /usr/bin
+	local test && done | && -eu $(pwd) && printf sed ${HOME} sed
+		'quoted text' ${HOME} /usr/bin local --verbose
+printf then readonly sed | && "$@" grep cd awk --verbose readonly /usr/bin
+	${HOME} readonly && awk --verbose | --verbose echo grep 'quoted text'
+		cd /usr/bin local readonly readonly
+	test --verbose echo then readonly
+	echo export && grep x=1 awk test test echo ${HOME} export 2>/dev/null local
+cd test && "$@" then x=1 then readonly | /usr/bin "$1" 2>/dev/null 'quoted text'
+	2>/dev/null "$@" ${HOME} && export --verbose printf /usr/bin cd --verbose x=1 $(pwd)
+$(pwd) 2>/dev/null sed printf && awk x=1 readonly "$1" then | sed
+		grep "$@" export awk $(pwd) | && | export /usr/bin readonly ${HOME}
+		/usr/bin export test local --verbose x=1 echo /usr/bin readonly printf cd
+	local "$@" && --verbose done printf $(pwd) echo echo | --verbose
+	"$@" /usr/bin x=1 "$@" ${HOME} done && $(pwd) -eu -eu then
+	cd sed && printf "$1" awk x=1 /usr/bin "$@"
+local ${HOME} test then readonly
+	grep "$1" -eu -eu $(pwd) then then then && $(pwd) $(pwd) 'quoted text' "$1" export
+local then && awk done $(pwd) awk readonly
+		test 2>/dev/null | $(pwd)
+		$(pwd) 'quoted text' done && 2>/dev/null echo done echo -eu export
+		| "$1" echo /usr/bin ${HOME} grep
+	-eu done "$@" && "$@" "$1" readonly awk /usr/bin test sed -eu x=1 'quoted text'
+		/usr/bin export $(pwd) export $(pwd) 2>/dev/null readonly
+done ${HOME} then && then "$@" echo test printf ${HOME} cd printf cd $(pwd)
+	'quoted text' sed --verbose grep 2>/dev/null cd then
+	sed --verbose grep "$1" local
+	cd local done "$@" then awk local local
+	x=1 local 2>/dev/null cd ${HOME} | printf | "$1" readonly
+	x=1 export --verbose echo cd $(pwd) 2>/dev/null | then sed
+| | sed local --verbose "$1" test then test local
+"$1" export -eu /usr/bin done test -eu echo then echo test
+		"$1" cd test | "$1" sed x=1 -eu sed local && printf |
+		then /usr/bin printf printf && export "$@" $(pwd)
+	printf x=1 then | --verbose | "$1" echo echo | awk 2>/dev/null
+2>/dev/null /usr/bin $(pwd) /usr/bin
+	sed test 'quoted text' awk printf 'quoted text' done /usr/bin cd x=1 cd 2>/dev/null
+	"$1" /usr/bin done x=1 test 2>/dev/null 'quoted text' local "$1"
+--verbose done printf --verbose
+2>/dev/null sed /usr/bin done $(pwd) echo printf local 2>/dev/null echo then /usr/bin
+	-eu printf then /usr/bin && "$@"
+cd then done export ${HOME} echo cd local x=1
+	printf readonly printf export test cd | 2>/dev/null
+	awk ${HOME} /usr/bin ${HOME} sed --verbose $(pwd)
+		$(pwd) done grep $(pwd) $(pwd) echo sed then /usr/bin test "$1" sed /usr/bin cd
+	'quoted text' 2>/dev/null /usr/bin local 2>/dev/null
+		awk then --verbose sed sed sed local /usr/bin /usr/bin test "$1" test then
+	readonly --verbose local test 'quoted text' ${HOME} done /usr/bin
+then grep --verbose done local | done cd $(pwd)
+2>/dev/null echo readonly
+local awk "$1" test | -eu printf readonly && awk done awk then awk --verbose
+awk export -eu grep && -eu printf ${HOME} done
+"$@" export cd | 2>/dev/null grep 2>/dev/null local 2>/dev/null
+		done "$1" done /usr/bin ${HOME} 'quoted text' then -eu $(pwd) echo
+$(pwd) /usr/bin | x=1 done done printf --verbose
+	/usr/bin echo /usr/bin "$1" export
+	then readonly local x=1 "$1" "$1" test
+-eu awk "$1" then printf
+		then done sed /usr/bin -eu 'quoted text' cd 'quoted text' 'quoted text'
+	--verbose grep local 'quoted text' awk cd
+	'quoted text' printf sed sed readonly local $(pwd) | printf 'quoted text'
+		'quoted text' "$1" local --verbose echo done cd done
+		"$1" local x=1 "$@" printf cd x=1 x=1 test | test echo
+	readonly done -eu readonly x=1 local then then | test
+${HOME} grep -eu grep && "$@" done echo && && cd readonly | "$1" && --verbose
+--verbose local sed test 'quoted text' export ${HOME} x=1 x=1 ${HOME}
+local /usr/bin grep "$@" export --verbose export printf $(pwd) 'quoted text'
+${HOME} sed printf ${HOME} /usr/bin
+		test printf "$@" 2>/dev/null printf
+	printf ${HOME} grep ${HOME} --verbose "$1" done
+	-eu local sed $(pwd) x=1 test echo "$1" then && readonly cd x=1
+		x=1 done printf done echo sed ${HOME} cd | cd
+local ${HOME} printf && echo echo echo --verbose
+	| x=1 x=1 echo sed awk -eu -eu printf readonly "$1" readonly then readonly printf
+awk ${HOME} $(pwd) echo | && sed
+		| 'quoted text' readonly 2>/dev/null x=1 'quoted text' && ${HOME}
+	readonly cd cd awk local "$@" sed --verbose echo --verbose awk cd export readonly
+	test "$@" $(pwd) | grep readonly | $(pwd) export grep
+	| "$1" -eu && test 'quoted text' export printf --verbose x=1 then
+		${HOME} ${HOME} then | 'quoted text' $(pwd) 'quoted text' echo | readonly
+		"$1" $(pwd) export cd -eu x=1 awk "$@" 'quoted text' "$@" x=1 "$1" awk /usr/bin
+	echo printf awk readonly x=1 printf then local
+	echo ${HOME} "$1" /usr/bin
+		echo "$@" 2>/dev/null local readonly "$1" readonly "$@"
+		awk ${HOME} $(pwd) printf $(pwd) --verbose ${HOME}
+printf printf /usr/bin test 'quoted text' awk $(pwd) test awk -eu 2>/dev/null
+export "$1" 'quoted text' echo 2>/dev/null awk then /usr/bin
+echo printf grep readonly sed local x=1 x=1 "$@"
+	/usr/bin echo 'quoted text' printf x=1
+| grep $(pwd) 'quoted text' x=1 test 'quoted text' local done export 2>/dev/null
+		export "$@" | echo 'quoted text'
+	"$1" done awk awk -eu printf --verbose test
+	done "$1" awk grep then $(pwd) awk cd $(pwd) -eu | "$1"
+		$(pwd) 2>/dev/null done cd -eu | "$1" export /usr/bin x=1 local then
+		&& -eu sed | && 'quoted text' "$1" x=1 /usr/bin then 2>/dev/null ${HOME}
+/usr/bin && cd "$@" awk ${HOME} sed then sed grep && 2>/dev/null sed test readonly
+	awk local awk sed printf sed readonly $(pwd) "$@" --verbose local
+	--verbose awk --verbose grep done 'quoted text'
+	"$1" export readonly -eu then local "$@" ${HOME}
+	sed grep 'quoted text' "$1" /usr/bin then then "$1" test /usr/bin 2>/dev/null $(pwd)
+		${HOME} ${HOME} readonly test done sed 'quoted text' x=1 'quoted text'
+	&& sed /usr/bin "$@" 'quoted text'
+	--verbose cd -eu echo echo
+printf cd /usr/bin then /usr/bin ${HOME} then awk printf
+		echo -eu 'quoted text' | && printf 'quoted text'
+| then | cd && cd --verbose x=1
+		| grep $(pwd) --verbose cd ${HOME} echo
+		&& local echo readonly awk $(pwd) readonly
+	&& x=1 "$@" "$@" then
+	/usr/bin "$@" /usr/bin local | | 2>/dev/null
+grep | "$@" test then cd awk grep cd "$@" echo
+		| printf echo done local cd /usr/bin done done awk
+	export x=1 "$1" test --verbose
+		echo done export /usr/bin
+		${HOME} test $(pwd) awk --verbose test -eu ${HOME} grep local -eu "$1" "$1" sed
+	test awk 'quoted text' -eu 'quoted text' &&
+	"$@" readonly $(pwd) | echo ${HOME} 'quoted text' "$@" local
+$(pwd) "$1" | local | --verbose 'quoted text' 2>/dev/null x=1 test grep awk /usr/bin
+	sed 2>/dev/null "$1" done awk /usr/bin cd grep "$1" sed
+		| grep cd export x=1 export
+	"$@" -eu x=1 && grep /usr/bin "$@" echo sed x=1 --verbose
+		$(pwd) cd grep "$1" && /usr/bin
+	--verbose | 2>/dev/null /usr/bin ${HOME} echo export printf "$@"
+	sed then readonly "$@" x=1 test && 2>/dev/null && -eu export
+| export /usr/bin -eu -eu
+	local echo /usr/bin echo | then awk cd done /usr/bin export "$1" && echo local
+		&& done awk export $(pwd) local "$@" ${HOME} cd && 2>/dev/null grep
+		local && | x=1 done --verbose echo echo grep printf x=1 printf | test awk
+2>/dev/null awk grep && && && echo
+		printf readonly $(pwd) local
+	export test /usr/bin "$@" 2>/dev/null then test
+		--verbose "$1" echo x=1 grep local 2>/dev/null export 2>/dev/null
+--verbose echo | x=1 | "$1" --verbose
+	$(pwd) printf echo then readonly awk |
+		--verbose && /usr/bin 'quoted text'
+"$@" x=1 /usr/bin echo local then export readonly ${HOME} /usr/bin
+cd cd printf --verbose "$@" echo awk ${HOME} readonly then
+		-eu local 'quoted text' && cd -eu -eu then ${HOME}
+	test 'quoted text' 2>/dev/null sed export done -eu --verbose
+grep -eu awk $(pwd) "$1" then "$@" then echo "$@" 2>/dev/null export
+printf local ${HOME} /usr/bin then && local
+x=1 then sed | readonly then 'quoted text' done "$@" "$@"
+	/usr/bin x=1 ${HOME} done x=1 2>/dev/null x=1 then ${HOME} ${HOME} | 2>/dev/null
+	/usr/bin | "$1" | export /usr/bin sed && readonly sed
+	$(pwd) ${HOME} printf cd
+readonly /usr/bin printf ${HOME} "$@" -eu then "$1" -eu done grep 2>/dev/null
+	'quoted text' | readonly sed echo test x=1 -eu /usr/bin
+	done 2>/dev/null -eu ${HOME}
+		grep local ${HOME} grep
+&& "$1" grep "$1" test sed /usr/bin
+	2>/dev/null printf x=1 ${HOME} then
+	/usr/bin cd ${HOME} && local "$@" local $(pwd) awk
+x=1 export then awk && sed ${HOME}
+		x=1 'quoted text' then 2>/dev/null
+		| then x=1 x=1 cd 'quoted text' /usr/bin local /usr/bin
+		-eu && --verbose | local --verbose printf
+		/usr/bin --verbose /usr/bin echo readonly
+		x=1 x=1 printf ${HOME} "$@" cd sed cd export
+	done && /usr/bin echo test "$1" readonly | readonly
+printf grep --verbose ${HOME} sed | 'quoted text'
+	printf 2>/dev/null ${HOME} x=1 "$1" 2>/dev/null readonly
+		test $(pwd) "$@" grep export 2>/dev/null 'quoted text'
+test $(pwd) 2>/dev/null --verbose sed | done local 'quoted text'
+		--verbose grep "$@" then sed sed
+		-eu "$1" "$@" 'quoted text'
+	"$1" 2>/dev/null | done local cd "$1" "$1" x=1 printf 'quoted text'
+		then ${HOME} grep $(pwd) $(pwd) "$1" --verbose
+'quoted text' readonly ${HOME} /usr/bin grep export awk "$@" "$@" | sed done
+		then x=1 x=1 local /usr/bin 'quoted text' sed
+	printf grep readonly $(pwd) then sed echo grep test printf done awk readonly
+		/usr/bin done done /usr/bin awk echo $(pwd) ${HOME} -eu
+"$1" sed local "$1" -eu grep -eu "$1" sed
+	x=1 2>/dev/null printf sed export
+		&& 'quoted text' cd awk /usr/bin 'quoted text'
+2>/dev/null then local sed grep
+	readonly ${HOME} 'quoted text' local echo -eu
+test "$@" export ${HOME} export echo then awk test 2>/dev/null test --verbose
+		cd 'quoted text' then grep | readonly grep
+		cd export "$@" done /usr/bin printf awk local 'quoted text'
+		echo 'quoted text' then done grep awk --verbose done "$@" ${HOME} then
+	2>/dev/null | awk cd -eu --verbose && printf x=1 awk sed --verbose cd $(pwd) 'quoted text'
+		"$@" --verbose | printf /usr/bin "$@" cd
+	x=1 printf $(pwd) sed local /usr/bin && cd export local 2>/dev/null done
+/usr/bin $(pwd) export local sed --verbose
+	'quoted text' 'quoted text' 2>/dev/null 'quoted text' | grep grep
+	readonly sed then sed -eu $(pwd) --verbose test
+#include c197.sh
+	printf 2>/dev/null ${HOME}
+	${HOME} readonly ${HOME} && local
+"$@" | 'quoted text' -eu sed grep sed | /usr/bin
+		awk readonly cd /usr/bin --verbose x=1 awk test | local echo readonly echo
+	echo 2>/dev/null "$1" "$@"
+		done -eu -eu && 2>/dev/null local readonly 2>/dev/null && -eu | x=1 grep
+		$(pwd) --verbose "$1" printf cd -eu 'quoted text' /usr/bin sed sed then
+test 'quoted text' sed export printf
+		"$1" export grep readonly 2>/dev/null cd then cd x=1 /usr/bin "$1" printf local
+		echo 2>/dev/null $(pwd) x=1
+	local && sed /usr/bin printf
+	2>/dev/null -eu && 2>/dev/null cd /usr/bin readonly
+	/usr/bin sed "$1" x=1 | grep done readonly awk
+	"$1" && | "$@" --verbose cd "$1" | echo sed -eu --verbose --verbose
+		--verbose 'quoted text' $(pwd) done ${HOME} "$@" grep "$@"
+	sed test /usr/bin "$1" echo printf local && 'quoted text' 'quoted text'
+	--verbose grep ${HOME} done -eu then && sed awk
+done && 2>/dev/null && --verbose cd grep 'quoted text'
+local | /usr/bin then 2>/dev/null x=1 "$@" x=1 sed
+$(pwd) export grep x=1 2>/dev/null "$@" --verbose -eu && echo then
+		echo export && readonly echo test 2>/dev/null | cd
+	/usr/bin sed done local sed export --verbose
+echo echo local printf awk --verbose sed
+		| test x=1 echo 'quoted text' sed x=1 then awk --verbose sed --verbose then
+	done sed -eu /usr/bin -eu printf 2>/dev/null done -eu ${HOME}
+		export -eu --verbose readonly
+	--verbose ${HOME} | | test && 'quoted text'
+		${HOME} cd --verbose --verbose printf grep grep x=1 sed | export grep $(pwd) then
+	2>/dev/null ${HOME} && && x=1 /usr/bin x=1 grep readonly
+		$(pwd) cd then $(pwd) done 2>/dev/null
+test printf grep readonly --verbose --verbose && 'quoted text'
+		--verbose ${HOME} printf done && readonly "$@" --verbose done ${HOME} printf readonly
+export 'quoted text' echo test local readonly --verbose | sed
+	readonly $(pwd) "$@" then --verbose
+cd "$1" "$@" local "$1" grep test printf
+"$1" readonly "$1" 'quoted text' awk test awk | cd done echo
+'quoted text' local printf
+		readonly $(pwd) echo -eu export "$@" readonly then /usr/bin echo x=1
+		local done grep echo --verbose done ${HOME}
+		&& x=1 export sed $(pwd) x=1 sed sed
+	/usr/bin sed 'quoted text' x=1 --verbose x=1 "$@" "$1" x=1 ${HOME} "$@" cd 2>/dev/null
+		test --verbose "$@" echo
+readonly ${HOME} local local local $(pwd) printf
+test cd readonly 'quoted text' 2>/dev/null 2>/dev/null printf
+		then cd $(pwd) "$@" test "$1" x=1 2>/dev/null -eu
+	-eu local cd | echo /usr/bin "$1" printf test 2>/dev/null
+	2>/dev/null test awk --verbose then | --verbose ${HOME} grep grep
+		export printf then printf done --verbose export
+	| ${HOME} done $(pwd) readonly
+	"$@" cd /usr/bin ${HOME} readonly local
+/usr/bin local awk ${HOME} 'quoted text' "$1" cd cd x=1 readonly sed && readonly
+/usr/bin /usr/bin grep -eu /usr/bin -eu grep readonly awk 'quoted text'
+	| "$@" ${HOME} grep echo | export x=1 grep local
+	$(pwd) test readonly echo x=1 then done | 2>/dev/null
+		${HOME} -eu ${HOME} $(pwd) printf printf "$1" 2>/dev/null 'quoted text' | local
+		local -eu done printf cd x=1 readonly grep cd /usr/bin | ${HOME} "$@"
+	echo "$@" --verbose -eu awk awk test export x=1 ${HOME} printf "$1" echo sed
+		printf local -eu readonly -eu "$@" "$@" local printf --verbose --verbose grep
+	cd printf ${HOME} ${HOME} x=1 local test 2>/dev/null export 'quoted text' ${HOME}
+| then grep "$1" && local printf
+	export --verbose -eu test 'quoted text' readonly cd local then
+		done cd export done "$@" grep 'quoted text' awk ${HOME} x=1 $(pwd) sed --verbose
+		/usr/bin cd --verbose && readonly local -eu -eu
+	awk sed "$1" x=1 x=1 $(pwd) $(pwd) done sed test ${HOME}
+	$(pwd) export sed awk local 2>/dev/null test && printf
+2>/dev/null -eu done then readonly
+&& x=1 echo "$@" 'quoted text'
+$(pwd) printf ${HOME} local x=1 then local "$@" awk readonly done readonly
+"$@" -eu "$1" export
+		| ${HOME} --verbose done 2>/dev/null 2>/dev/null readonly 2>/dev/null test echo
+printf printf readonly readonly ${HOME} local && sed local
+		x=1 "$1" readonly /usr/bin awk export awk
+test --verbose --verbose test sed ${HOME} export "$@"
+	${HOME} grep export "$1" --verbose && /usr/bin x=1 "$1" echo 'quoted text'
+	x=1 /usr/bin "$@" && "$1"
+		printf grep 'quoted text' readonly local export /usr/bin then then -eu sed
+done sed x=1 'quoted text' ${HOME} "$@" -eu
+	'quoted text' --verbose done export awk done | export "$@" -eu echo x=1 ${HOME}
+		export export grep "$1" "$1" printf printf grep cd grep echo
+		"$@" x=1 local cd 2>/dev/null "$1" then "$1" x=1 then "$1" sed
+"$@" local ${HOME} "$1" test printf "$@" -eu x=1 awk awk export ${HOME} readonly
+		export cd "$1" "$@" echo ${HOME} "$1" done readonly "$@"
+	x=1 "$@" 'quoted text' done test
+		printf local | && x=1
+/usr/bin | "$@" ${HOME} "$1" ${HOME} printf
+/usr/bin $(pwd) 'quoted text' sed export
+--verbose done "$1" /usr/bin sed 2>/dev/null local 'quoted text' readonly done
+-eu sed "$1" -eu done 2>/dev/null
+		2>/dev/null export grep -eu done x=1 | sed test readonly x=1 --verbose
+		sed echo sed 2>/dev/null &&
+x=1 local readonly readonly
+	'quoted text' $(pwd) "$1" local 'quoted text'
+	export 'quoted text' readonly
+		$(pwd) -eu echo local export grep sed readonly "$@" then "$1" export
+readonly --verbose &&
+		grep | 'quoted text' done x=1
+		${HOME} grep ${HOME} "$@" "$@" export sed
+"$@" readonly "$@" ${HOME} ${HOME} test sed echo "$1" 'quoted text'
+		cd $(pwd) printf awk &&
+local cd readonly x=1
+/usr/bin awk "$@" 2>/dev/null && -eu
+sed | printf printf export local /usr/bin "$1" $(pwd) export "$1" cd $(pwd) test
+2>/dev/null && awk 'quoted text' && cd test | 'quoted text' $(pwd)
+/usr/bin 2>/dev/null printf
+cd && x=1 2>/dev/null $(pwd) cd cd --verbose x=1 -eu cd -eu && local --verbose
+awk printf export awk /usr/bin
+	/usr/bin sed test && 2>/dev/null sed then
+printf x=1 ${HOME} /usr/bin readonly local "$@" | 'quoted text' ${HOME} test
+		/usr/bin "$@" export grep awk 'quoted text'
+	"$1" grep test then | -eu 2>/dev/null test x=1 echo readonly readonly
+| --verbose sed cd ${HOME}
+readonly readonly ${HOME} | && awk && readonly | -eu "$1" echo $(pwd) cd sed test
+	| "$@" "$@" -eu echo cd x=1 && sed
+		&& test then && --verbose echo awk cd sed 'quoted text' -eu
+		${HOME} then --verbose export echo export /usr/bin readonly 'quoted text'
+		"$1" test grep local readonly sed echo awk && echo
+	-eu printf cd | 2>/dev/null 'quoted text' x=1 done "$@" awk grep "$@" sed "$@"
+		/usr/bin | printf cd --verbose export grep "$@" cd sed grep -eu ${HOME}
+${HOME} /usr/bin | done "$@" ${HOME} $(pwd) test test | --verbose sed "$@"
+	awk then x=1 && x=1 "$1" 2>/dev/null export x=1 $(pwd) x=1 cd -eu | x=1
+	printf "$1" 2>/dev/null 2>/dev/null /usr/bin awk sed printf
+"$1" 'quoted text' done | -eu 'quoted text' -eu ${HOME} grep ${HOME} && ${HOME}
+	then 2>/dev/null cd readonly grep
+| readonly 2>/dev/null -eu && then export readonly printf x=1 -eu readonly local
+		&& 'quoted text' $(pwd) export echo sed done && awk grep -eu export awk printf
+then done awk test then local
+cd echo sed "$1" sed 2>/dev/null /usr/bin cd "$@" local 'quoted text'
+	--verbose echo x=1 grep test ${HOME}
+		/usr/bin && awk --verbose printf
+		"$1" printf sed -eu grep export --verbose
+		test 2>/dev/null export local export readonly 2>/dev/null
+--verbose $(pwd) grep | && $(pwd) | grep grep && done then export test
+	${HOME} /usr/bin done awk grep cd sed printf
+		"$@" readonly then test ${HOME} done echo then
+| $(pwd) --verbose /usr/bin done 'quoted text' x=1 then | then -eu
+${HOME} $(pwd) && sed x=1 cd --verbose echo && |
+		cd 'quoted text' ${HOME} then "$1"
+x=1 2>/dev/null 'quoted text' -eu x=1 done sed -eu test cd /usr/bin
+		local "$@" grep -eu readonly x=1 grep echo test
+	${HOME} grep "$@" done && readonly then 2>/dev/null
+		&& awk export sed cd export cd echo /usr/bin awk sed
+	$(pwd) sed test | cd /usr/bin echo sed readonly readonly export
+$(pwd) --verbose echo $(pwd)
+x=1 x=1 awk && $(pwd) && 2>/dev/null cd done
+test /usr/bin export local then ${HOME} cd then grep
+	$(pwd) | ${HOME} | ${HOME}
+		echo | x=1 awk export echo done then local /usr/bin 'quoted text'
+--verbose -eu x=1 'quoted text' sed readonly
+		then local 'quoted text' local && done
+		/usr/bin printf grep export awk awk local && 'quoted text' test x=1 cd ${HOME}
+		export local readonly --verbose export test export 2>/dev/null "$@" 2>/dev/null
+		readonly echo --verbose echo
+cd /usr/bin done test done awk
+	export local awk test /usr/bin
+printf --verbose printf -eu "$@" awk "$1" x=1 echo test x=1 2>/dev/null
+"$@" 'quoted text' "$1" "$@" x=1 local then
+		x=1 --verbose test echo sed echo then
+export && 2>/dev/null sed echo && echo sed --verbose then done readonly awk
+		cd ${HOME} then then -eu ${HOME} test | $(pwd) && && /usr/bin
+${HOME} $(pwd) printf awk cd 2>/dev/null
+	-eu $(pwd) sed then sed /usr/bin
+	$(pwd) printf -eu 'quoted text' grep export |
+	2>/dev/null && ${HOME} $(pwd) 'quoted text' $(pwd) ${HOME} grep sed $(pwd) ${HOME}
+		echo printf ${HOME} then $(pwd) ${HOME} export then echo
+	$(pwd) ${HOME} sed 2>/dev/null awk && done x=1 $(pwd) echo -eu "$1" grep
+	cd grep readonly done local local 'quoted text'
+export $(pwd) 2>/dev/null | /usr/bin local awk "$1" grep
+	cd test cd readonly local --verbose done $(pwd) "$@" echo /usr/bin x=1 -eu
+| | && test grep && x=1 local done local ${HOME} grep
+		'quoted text' then ${HOME} cd -eu export
+		grep "$1" done && done "$@"
+	test "$@" then ${HOME} /usr/bin awk sed grep printf 2>/dev/null
+	printf readonly && done test /usr/bin echo && $(pwd) test sed
+	export | | sed && test x=1 export
+		grep "$1" /usr/bin readonly done "$@" local readonly
+	local sed "$@" grep 2>/dev/null -eu
+&& "$@" --verbose 2>/dev/null /usr/bin && -eu local sed "$@" /usr/bin
+		${HOME} echo 2>/dev/null x=1 echo /usr/bin echo cd echo -eu &&
+	/usr/bin local readonly echo x=1 "$@" /usr/bin
+	readonly x=1 done test --verbose echo printf 2>/dev/null
+	"$@" done x=1 grep cd /usr/bin test local readonly 'quoted text' --verbose "$1"
+x=1 "$@" 'quoted text' x=1 readonly readonly | --verbose
+		-eu readonly local $(pwd) printf awk 2>/dev/null x=1 grep export test
+	grep -eu $(pwd) export awk | readonly 'quoted text' x=1 2>/dev/null
+grep test | 'quoted text' 2>/dev/null
+	x=1 awk ${HOME} local -eu | 2>/dev/null printf
+2>/dev/null then 2>/dev/null sed /usr/bin then && /usr/bin readonly
+		-eu --verbose --verbose grep printf echo done
+	cd done --verbose $(pwd) "$@" printf && && echo ${HOME} readonly local
+	| echo && /usr/bin sed printf readonly done printf test "$1" 'quoted text' 'quoted text'
+		2>/dev/null && then readonly echo | awk
+		export awk x=1 --verbose $(pwd)
+	local x=1 export awk awk | readonly | && "$@" $(pwd)
+		printf sed cd awk "$1" export export && | readonly printf
+		"$1" 'quoted text' x=1 2>/dev/null
+cd test readonly done "$1" --verbose awk 2>/dev/null export "$1" && "$1"
+grep --verbose 'quoted text' then "$@" test echo cd 2>/dev/null then done grep
+	cd printf && then "$1" ${HOME} "$1" | printf then
+echo cd local --verbose echo /usr/bin "$@" | grep export $(pwd) --verbose
+	x=1 echo echo -eu /usr/bin "$@" 2>/dev/null readonly local
+	--verbose then readonly /usr/bin && ${HOME} sed readonly local && ${HOME} x=1 --verbose
+		--verbose awk sed test then --verbose -eu 'quoted text' printf ${HOME} | -eu readonly
+		${HOME} $(pwd) | x=1 -eu printf && $(pwd) ${HOME}
+	sed cd ${HOME} "$1" --verbose /usr/bin | 2>/dev/null
+/usr/bin export $(pwd) | x=1 x=1 echo 2>/dev/null ${HOME} -eu x=1 cd
+/usr/bin readonly then awk sed test cd --verbose ${HOME} grep then
+grep grep | --verbose --verbose $(pwd) --verbose
+	awk "$1" done -eu grep export
+${HOME} echo ${HOME} local -eu $(pwd) grep
+x=1 sed x=1 grep then --verbose cd "$@" done
+	"$1" --verbose ${HOME} printf /usr/bin $(pwd) -eu readonly -eu
+	awk /usr/bin ${HOME} printf ${HOME} readonly "$@" 2>/dev/null
+		export test done awk printf local sed | --verbose
+		$(pwd) grep "$@" done local $(pwd) x=1 ${HOME} x=1
+	-eu awk --verbose export awk
+		| --verbose | then printf done cd echo done local test ${HOME} -eu local grep
+printf && "$1" grep cd grep done --verbose
+	--verbose export 2>/dev/null cd export echo cd ${HOME} "$@"
+		--verbose echo 'quoted text' -eu && local
+		--verbose --verbose grep grep echo local $(pwd) done
+		$(pwd) sed /usr/bin cd $(pwd) export 'quoted text'
+	2>/dev/null && -eu sed local done "$1" local done
+"$@" && local 'quoted text' export "$1" sed export $(pwd) printf x=1
+	'quoted text' 2>/dev/null test 'quoted text' test -eu ${HOME} "$@" readonly -eu
+		awk cd then cd 2>/dev/null 2>/dev/null 'quoted text'
+awk local | export | printf $(pwd)
+local | then "$1" printf then x=1 "$@" local grep x=1
+--verbose "$1" && 'quoted text'
+		cd "$@" awk "$1" local
+	/usr/bin $(pwd) awk | | cd --verbose grep readonly readonly
+		done sed ${HOME} printf echo
+	printf test test ${HOME} && $(pwd)
+		-eu ${HOME} grep grep export
+	"$1" printf --verbose done export local /usr/bin
+	"$1" done readonly echo printf export then ${HOME} "$1" /usr/bin x=1 test
+	"$1" $(pwd) ${HOME} ${HOME} readonly done
+	export | && local test ${HOME} awk 'quoted text' -eu x=1 printf -eu
+	"$@" -eu done /usr/bin --verbose grep "$@" x=1 $(pwd)
+		export 2>/dev/null 2>/dev/null x=1 readonly done && sed sed |
+	x=1 cd local echo --verbose cd export local sed cd && /usr/bin $(pwd) "$1"
+'quoted text' x=1 ${HOME} $(pwd) --verbose "$@" /usr/bin |
+		test $(pwd) export -eu 2>/dev/null export then 'quoted text'
+	test ${HOME} x=1 local
+	-eu readonly -eu 'quoted text' printf printf printf -eu
+awk x=1 /usr/bin grep --verbose
+	echo ${HOME} echo "$1" "$1" 2>/dev/null && && done done done /usr/bin then $(pwd)
+local readonly -eu printf -eu /usr/bin printf export "$@"
+	--verbose 'quoted text' printf ${HOME}
+		--verbose ${HOME} $(pwd) "$1" | --verbose printf printf export x=1 then sed awk
+		-eu awk -eu export $(pwd) ${HOME} then
+		--verbose 2>/dev/null ${HOME} 'quoted text' echo && $(pwd) "$1" echo grep --verbose
+		test 2>/dev/null "$@" awk readonly echo "$@"
+	'quoted text' readonly 'quoted text' echo test then "$@" test readonly x=1 x=1
+	export $(pwd) local export awk "$1" && done export
+		test echo export export echo export then done export
+		| "$1" --verbose echo "$@" ${HOME} then test cd printf 'quoted text' --verbose export
+	${HOME} awk done "$1" echo done cd cd $(pwd) printf 'quoted text'
+	/usr/bin sed | ${HOME} grep sed
+		then ${HOME} 2>/dev/null
+	| 'quoted text' 'quoted text' $(pwd) echo $(pwd) x=1 --verbose
+| --verbose readonly then x=1 readonly awk sed echo && export
+		printf 2>/dev/null readonly done 2>/dev/null then 2>/dev/null "$1" echo
+	local ${HOME} export | readonly /usr/bin echo echo 'quoted text'
+export echo grep 'quoted text' && $(pwd) | $(pwd) done done /usr/bin local
+cd ${HOME} echo sed | /usr/bin printf done && 2>/dev/null
+grep ${HOME} then 'quoted text' "$@" && 'quoted text'
+		| local awk 2>/dev/null && awk /usr/bin then local
+		awk | /usr/bin x=1 'quoted text' export awk "$@"
+echo "$1" 2>/dev/null 2>/dev/null
+	-eu -eu printf cd "$1" && local export grep --verbose ${HOME} "$1" then -eu readonly
+		awk | "$1" 2>/dev/null "$1" readonly test "$1" x=1 /usr/bin sed -eu test
+test done 'quoted text' local readonly --verbose /usr/bin "$@" readonly
+readonly | -eu 2>/dev/null 2>/dev/null /usr/bin 2>/dev/null
+		then export | test "$@" readonly printf --verbose
+		cd x=1 /usr/bin x=1 --verbose
+	cd then echo test local 2>/dev/null ${HOME} then export 2>/dev/null
+readonly local local ${HOME} grep then | --verbose 2>/dev/null | export done
+		&& done sed 2>/dev/null "$1" awk -eu /usr/bin | | 2>/dev/null cd grep readonly
+	$(pwd) echo $(pwd) && | echo printf
+	awk then /usr/bin && 2>/dev/null done ${HOME} printf readonly done ${HOME}
+	| 2>/dev/null awk --verbose /usr/bin
+		/usr/bin test "$1" awk
+		export /usr/bin $(pwd) done x=1 && done $(pwd)
+		x=1 printf printf -eu 'quoted text' done "$1" "$1" ${HOME} local -eu $(pwd)
+		local "$1" --verbose 'quoted text' -eu export x=1 then printf cd $(pwd) x=1
+		$(pwd) test local && readonly 2>/dev/null x=1 /usr/bin
+		cd grep "$1" --verbose --verbose done then sed test export
+printf echo readonly | echo -eu done awk readonly --verbose 2>/dev/null
+		cd | readonly --verbose && grep "$1" grep ${HOME}
+	-eu export ${HOME} --verbose
+	$(pwd) test 2>/dev/null grep $(pwd) awk "$@" --verbose then "$1" awk test
+"$@" local ${HOME} --verbose sed x=1 "$@" /usr/bin && x=1
+	printf --verbose cd /usr/bin $(pwd) /usr/bin test printf printf awk printf
+	echo export "$@" $(pwd) printf sed | x=1 done echo ${HOME} "$1"
+		grep x=1 2>/dev/null -eu export export -eu /usr/bin echo test $(pwd) ${HOME}
+awk "$1" ${HOME} sed done then test readonly
+$(pwd) test "$@" $(pwd) printf -eu then -eu echo printf test && printf
+done test --verbose sed printf readonly test
+--verbose ${HOME} 'quoted text'
+| printf awk $(pwd) -eu 2>/dev/null
+--verbose grep ${HOME} awk export --verbose x=1
+"$@" 'quoted text' ${HOME} 2>/dev/null
+local /usr/bin sed --verbose
+		$(pwd) test printf /usr/bin done 2>/dev/null grep done sed local test | 2>/dev/null
+done export done then sed && then done ${HOME} cd "$1" awk 2>/dev/null
+		sed grep && echo $(pwd) awk
+	&& 'quoted text' "$1" echo readonly ${HOME} --verbose
+grep 2>/dev/null $(pwd) cd
+	echo then /usr/bin --verbose -eu "$@" $(pwd)
+		-eu readonly $(pwd) "$1" -eu export sed x=1 /usr/bin --verbose
+-eu && cd then --verbose sed | | $(pwd) x=1 "$@" echo test | && readonly test
+-eu "$1" local $(pwd) | done
+printf then sed | ${HOME} 2>/dev/null "$1" ${HOME} $(pwd)
+		"$1" test --verbose /usr/bin -eu --verbose x=1 then | export
+	${HOME} echo $(pwd) "$@" sed sed x=1 grep grep sed test echo echo printf
+		awk -eu 2>/dev/null export $(pwd) | 'quoted text'
+	cd -eu 2>/dev/null && sed done 2>/dev/null
+/usr/bin readonly "$1" awk
+	echo printf sed -eu 'quoted text' "$1" export && cd printf grep && -eu | export
+	--verbose printf local cd printf "$1" export
+		| readonly awk echo ${HOME} "$1" -eu cd awk | 2>/dev/null
+/usr/bin export | "$@" export ${HOME} -eu printf done "$@" export -eu "$@"
+		grep | && echo 'quoted text' x=1 /usr/bin "$@" local
+		test -eu cd /usr/bin readonly done ${HOME} 2>/dev/null "$1" echo test
+		&& 2>/dev/null printf "$1" local | readonly
+/usr/bin "$1" test 'quoted text' $(pwd)
+printf 'quoted text' 2>/dev/null "$1" cd done
+		'quoted text' sed export local "$@" ${HOME} local export 'quoted text' && readonly
+		/usr/bin "$1" 'quoted text'
+	cd echo /usr/bin 2>/dev/null -eu && "$@"
+local "$1" "$@" 'quoted text' x=1 sed x=1 awk 'quoted text' done local
+		test /usr/bin done -eu | then printf -eu ${HOME}
+		echo ${HOME} $(pwd) "$1" export export
+		&& cd ${HOME} printf readonly
+sed --verbose "$@" test "$1" 'quoted text'
+-eu awk --verbose test && "$@" export | sed export then readonly ${HOME}
+	readonly echo /usr/bin 'quoted text'
+		-eu -eu echo done done test /usr/bin
+		--verbose --verbose $(pwd) grep /usr/bin 2>/dev/null cd then echo
+	then 2>/dev/null | && export 'quoted text' 'quoted text' readonly
+	2>/dev/null "$1" awk && cd 'quoted text'
+then | "$@" | -eu echo done | x=1 /usr/bin readonly
+		then x=1 test cd 'quoted text' "$@" then --verbose | local awk
+	done printf 'quoted text' readonly
+	then --verbose "$@" grep export "$@" x=1 readonly export
+'quoted text' "$1" $(pwd) /usr/bin sed /usr/bin awk
+		'quoted text' -eu then
+		done 2>/dev/null --verbose "$@" grep /usr/bin --verbose
+"$1" echo $(pwd) awk test test awk 'quoted text' "$@" local readonly --verbose
+		x=1 x=1 ${HOME} 'quoted text' test done --verbose printf done sed
+		x=1 $(pwd) awk then export ${HOME} $(pwd)
+		awk 'quoted text' test test 'quoted text' test then -eu export | readonly echo
+local ${HOME} -eu /usr/bin
+cd awk awk test sed awk /usr/bin 2>/dev/null
+		awk 2>/dev/null /usr/bin 'quoted text' awk && printf --verbose 2>/dev/null
+	"$@" /usr/bin test readonly
+		2>/dev/null echo done ${HOME} echo 'quoted text' $(pwd) test sed
+sed /usr/bin && -eu && && | cd && local local readonly
+sed then then cd 'quoted text' echo printf readonly cd done printf sed cd $(pwd)
+then "$@" then ${HOME} grep sed 'quoted text' | cd "$1" export --verbose
+	then then "$@" awk local readonly test 2>/dev/null awk export
+"$@" 'quoted text' cd && done local ${HOME} cd ${HOME} $(pwd) /usr/bin
+		&& /usr/bin "$@" "$1" local echo cd export printf "$@" sed local
+echo test local local local 2>/dev/null awk "$@"
+done "$1" test echo 'quoted text' test ${HOME} sed local
+	echo readonly then x=1 | 2>/dev/null cd then local "$1" ${HOME} ${HOME}
+	&& 'quoted text' export local "$1"
+	--verbose sed | sed echo export sed echo 2>/dev/null && | --verbose
+test 'quoted text' -eu x=1 sed -eu && cd /usr/bin
+printf 'quoted text' "$@" test ${HOME} ${HOME} readonly $(pwd) && 'quoted text'
+		| readonly printf | x=1 export "$@" $(pwd) $(pwd)
+grep "$@" | local "$1" "$1" printf readonly &&
+echo readonly done $(pwd) "$1" $(pwd)
+"$@" x=1 awk cd test then -eu $(pwd) local
+	done done -eu -eu ${HOME} && printf
+/usr/bin grep then export
+	export --verbose grep sed
+		local && local awk 'quoted text' -eu 2>/dev/null 2>/dev/null
+	&& $(pwd) | --verbose
+		$(pwd) --verbose echo then readonly readonly echo test done cd x=1
+grep echo grep -eu $(pwd) 'quoted text' "$@" then sed cd -eu awk
+		"$@" grep local x=1 x=1 && then done printf x=1 2>/dev/null x=1 echo
+x=1 $(pwd) done | 'quoted text' echo && "$1" $(pwd) grep 'quoted text'
+/usr/bin 2>/dev/null x=1 && ${HOME} awk
+${HOME} 2>/dev/null printf 'quoted text'
+		printf sed -eu /usr/bin test "$@" test export local done "$1" $(pwd) grep 2>/dev/null
+export ${HOME} then test x=1 local
+		readonly export "$@" awk | -eu test sed export $(pwd)
+	-eu && done test $(pwd) 'quoted text' /usr/bin cd test
+grep && 2>/dev/null x=1 | $(pwd) export printf
+		cd sed "$@" "$@" "$@" then cd | grep sed test test grep && 2>/dev/null "$@" local
+	cd cd 'quoted text' awk then done export x=1 "$@"
+	done 'quoted text' awk local done readonly then awk --verbose
+	test cd export test 2>/dev/null && then awk then
+		then 'quoted text' then ${HOME} 2>/dev/null readonly "$@" local
+		x=1 local cd 2>/dev/null grep grep --verbose
+		export grep 2>/dev/null cd test "$@" 2>/dev/null sed awk then
+		$(pwd) export then /usr/bin -eu /usr/bin export 2>/dev/null $(pwd) | 'quoted text'
+	echo --verbose -eu done sed echo
+local /usr/bin cd 'quoted text' "$@" 'quoted text' --verbose ${HOME} /usr/bin then
+		export echo local && -eu -eu sed 'quoted text'
+local $(pwd) local /usr/bin printf
+		"$1" "$@" export grep "$@" export "$@" /usr/bin "$@" && $(pwd) done | /usr/bin
+2>/dev/null | then echo readonly x=1 readonly
+	readonly test "$1" ${HOME} sed
+test x=1 done 'quoted text' grep 'quoted text' echo && echo /usr/bin
+		2>/dev/null sed 2>/dev/null && printf awk
+sed x=1 | x=1 cd done then readonly && /usr/bin /usr/bin | --verbose
+printf grep local "$1" export sed "$1" 'quoted text' /usr/bin awk
+	readonly $(pwd) ${HOME} $(pwd) local x=1
+	then 'quoted text' 2>/dev/null | | local sed && then
+local then /usr/bin /usr/bin ${HOME} grep | readonly sed sed test readonly
+"$@" ${HOME} cd export ${HOME} "$1" "$@" /usr/bin printf grep 2>/dev/null local
+		local --verbose then 2>/dev/null
+		cd grep local "$@" cd readonly
+printf -eu /usr/bin awk ${HOME} test
+"$@" cd | local sed "$@" awk printf
+		$(pwd) sed | 2>/dev/null && | -eu | && ${HOME} | 2>/dev/null --verbose "$@"
+	${HOME} printf awk echo 2>/dev/null sed export done /usr/bin 'quoted text'
+then "$1" ${HOME} $(pwd) x=1 ${HOME} done done
+		-eu grep 'quoted text' cd test echo --verbose export local printf 2>/dev/null
+		2>/dev/null printf sed local | $(pwd) cd grep x=1
+	test then -eu 'quoted text' | "$@" ${HOME} 2>/dev/null local
+awk /usr/bin awk readonly && readonly "$1" printf 'quoted text' awk
+	${HOME} 'quoted text' "$1" -eu done
+2>/dev/null cd x=1 awk cd "$@" done local echo
+	then "$@" --verbose sed sed "$@" /usr/bin test | grep "$1" 2>/dev/null
+		-eu 2>/dev/null readonly readonly | && ${HOME} "$@"
+	"$@" && done "$1" $(pwd) /usr/bin -eu printf 'quoted text' 2>/dev/null
+	'quoted text' --verbose export -eu echo readonly
+printf grep awk /usr/bin then | readonly test grep echo && x=1
+		local then "$@" && test x=1 cd printf x=1 test local test ${HOME}
+-eu -eu --verbose then done $(pwd)
+	printf "$@" --verbose then sed | | test ${HOME}
+readonly | 2>/dev/null awk echo done local grep --verbose
+		cd && local --verbose 2>/dev/null ${HOME} "$@" sed cd sed
+echo --verbose && local test echo awk /usr/bin printf grep $(pwd) grep --verbose
+	/usr/bin readonly | awk /usr/bin test "$1" awk echo cd x=1 echo
+awk echo local ${HOME} grep grep 2>/dev/null x=1
+		| printf "$1" --verbose test
+then cd grep 2>/dev/null local awk x=1 && then grep export
+--verbose 2>/dev/null printf then 2>/dev/null "$@"
+	$(pwd) ${HOME} sed test x=1 "$1" x=1 done x=1 echo "$1"
+	sed sed cd && /usr/bin export
+export 'quoted text' 2>/dev/null 2>/dev/null done "$@" readonly 'quoted text'
+	x=1 'quoted text' "$1" && cd ${HOME} cd export local done done 'quoted text' 2>/dev/null
+test cd /usr/bin "$@" export
+		awk export export echo x=1 'quoted text' --verbose sed x=1
+	| "$@" /usr/bin 'quoted text'
+		sed -eu "$1" -eu local 'quoted text' --verbose awk grep readonly "$1" printf
+	done /usr/bin /usr/bin ${HOME} grep printf
+		2>/dev/null "$1" echo $(pwd)
+		2>/dev/null awk 2>/dev/null x=1 --verbose
+&& 'quoted text' --verbose readonly "$@" export local /usr/bin
+		cd echo /usr/bin test "$1" readonly
+		test /usr/bin && cd test /usr/bin | cd "$1" grep --verbose cd 'quoted text'
+	printf ${HOME} export export test
+	readonly then && cd printf 'quoted text' --verbose test echo local
+awk then then 2>/dev/null then then printf
+echo echo echo then printf readonly grep --verbose
+		grep done --verbose && cd && && x=1 export
+	"$@" test printf printf
+	${HOME} ${HOME} x=1 --verbose 'quoted text' && -eu | 2>/dev/null
+	| readonly test then printf
+		"$@" 2>/dev/null sed then ${HOME} "$@" && awk awk -eu 'quoted text' ${HOME}
+	/usr/bin 2>/dev/null done | -eu "$@" ${HOME} awk -eu -eu printf then then
+	echo export /usr/bin awk /usr/bin
+then cd echo && test printf | /usr/bin then /usr/bin 2>/dev/null
+sed --verbose && "$@" -eu awk sed local 'quoted text' awk
+	x=1 export echo /usr/bin "$@" printf 2>/dev/null
+		$(pwd) 2>/dev/null grep 2>/dev/null local | awk awk readonly
+	cd "$1" echo 'quoted text' && "$1" x=1 grep grep readonly $(pwd)
+	$(pwd) "$1" done printf done printf awk echo
+"$@" && 'quoted text' local
+local grep "$1" test readonly
+	$(pwd) | grep readonly readonly 'quoted text'
+		grep ${HOME} cd ${HOME} 'quoted text' sed
+'quoted text' readonly local 'quoted text' done readonly
+	printf then readonly x=1 2>/dev/null done
+	"$@" awk grep --verbose "$1"
+	| | cd $(pwd) ${HOME} grep echo x=1 'quoted text' sed 'quoted text'
+$(pwd) local test x=1 echo test echo ${HOME} local
+$(pwd) /usr/bin x=1 'quoted text'
+	"$@" done | local grep x=1 "$@" printf local test echo "$1" --verbose sed $(pwd)
+'quoted text' --verbose export --verbose && && readonly done readonly /usr/bin
+then awk cd 2>/dev/null awk test "$@" local x=1 then grep local ${HOME}
+printf $(pwd) -eu /usr/bin $(pwd)
+printf cd $(pwd) 2>/dev/null done local -eu local ${HOME} -eu 2>/dev/null
+export --verbose 2>/dev/null 'quoted text' then export ${HOME}
+		x=1 readonly 2>/dev/null -eu cd --verbose cd awk 'quoted text'
+		${HOME} x=1 then test export test grep && -eu | echo readonly export
+		done | -eu | readonly cd -eu | then echo sed ${HOME}
+		printf grep cd ${HOME} && sed cd 2>/dev/null "$1" "$1" then $(pwd)
+		grep 2>/dev/null awk local -eu | x=1 local sed export && $(pwd)
+		${HOME} /usr/bin /usr/bin
+-eu test -eu export | export
+	/usr/bin && $(pwd) export ${HOME} readonly "$@" /usr/bin echo
+	local printf export "$@" 'quoted text' grep -eu local
+	/usr/bin ${HOME} echo echo readonly
+	x=1 "$1" grep | awk $(pwd) readonly "$1" awk ${HOME} |
+	echo 'quoted text' cd 'quoted text'
+		"$@" cd grep sed -eu grep then export readonly grep -eu readonly
+local ${HOME} grep sed done | | echo "$1" "$@" -eu | then | "$@"
+		then | done grep 2>/dev/null | done export local "$@" grep 'quoted text' cd
+		readonly printf "$1" then readonly x=1
+	then && test "$@" x=1 readonly sed "$@" -eu ${HOME} --verbose x=1 sed
+sed /usr/bin /usr/bin done sed done export printf "$@" $(pwd) export 'quoted text'
+		"$1" "$@" echo cd 'quoted text' $(pwd) grep
+		cd grep ${HOME} $(pwd) -eu &&
+	sed "$1" local grep grep $(pwd) -eu
+		x=1 local $(pwd) printf sed x=1 echo done then $(pwd) --verbose
+x=1 -eu && awk $(pwd) && ${HOME} --verbose local "$1" then ${HOME} echo -eu /usr/bin
+	local test x=1 2>/dev/null awk "$@" --verbose printf "$@"
+	/usr/bin readonly x=1
+	test && grep printf x=1 /usr/bin test
+		grep awk | 'quoted text' $(pwd) printf echo awk /usr/bin
+	cd x=1 printf export | echo --verbose
+		x=1 done $(pwd) local printf sed
+	sed 2>/dev/null "$1" grep test sed
+	${HOME} export echo "$1" && local x=1 echo local then | && | export export
+		'quoted text' $(pwd) 2>/dev/null
+		sed "$1" "$@" printf done export printf cd cd cd /usr/bin -eu | /usr/bin
+	grep grep /usr/bin test test done grep && cd echo export 2>/dev/null x=1 printf
+		grep cd /usr/bin $(pwd) echo --verbose then "$@" --verbose sed done awk "$1"
+	printf 2>/dev/null 'quoted text' "$1" 2>/dev/null awk test x=1 echo export
+		$(pwd) ${HOME} grep export -eu 'quoted text' grep
+		local cd done awk "$@" ${HOME} 'quoted text'
+		x=1 then -eu && 'quoted text' export 'quoted text' echo local done then sed
+	done $(pwd) printf ${HOME} ${HOME} 'quoted text'
+		x=1 grep /usr/bin /usr/bin x=1 "$1" &&
+	echo echo ${HOME} then && 'quoted text'
+then local then "$1" then grep readonly -eu export echo "$1"
+x=1 readonly && readonly sed test echo 2>/dev/null
+		&& done $(pwd) 2>/dev/null -eu readonly printf "$1" export | grep export "$@" 2>/dev/null
+	"$@" "$@" ${HOME} then readonly --verbose local cd grep -eu "$@" readonly
+		"$@" 'quoted text' export "$1" awk test 2>/dev/null "$@" 2>/dev/null
+		x=1 echo sed printf 2>/dev/null x=1 $(pwd) readonly
+	$(pwd) --verbose $(pwd) | 2>/dev/null cd 2>/dev/null "$@" echo
+printf done test "$1" --verbose -eu --verbose -eu x=1 ${HOME} -eu echo
+	echo readonly readonly "$@" local
+	$(pwd) test 2>/dev/null "$@" "$@" local done echo
+	echo && printf && export x=1 printf -eu printf "$@" printf sed /usr/bin
+2>/dev/null x=1 grep -eu $(pwd)
+		--verbose x=1 2>/dev/null echo then $(pwd)
+		/usr/bin cd cd -eu test | readonly echo
+awk awk local ${HOME} &&
+	${HOME} x=1 cd /usr/bin $(pwd) "$@" cd | done grep cd --verbose echo
+	grep x=1 -eu awk cd done ${HOME}
+echo awk --verbose x=1 test --verbose -eu
+		done 'quoted text' "$1" export --verbose then awk && done local
+		"$@" "$1" --verbose readonly --verbose 2>/dev/null echo "$@" readonly
+readonly readonly export
+	| --verbose grep echo awk sed && grep && -eu | test
+	awk $(pwd) test $(pwd) export echo -eu /usr/bin ${HOME}
+'quoted text' readonly readonly 2>/dev/null then done export 'quoted text'
+printf $(pwd) 2>/dev/null -eu sed grep -eu 'quoted text'
+"$@" test && done 2>/dev/null
+		"$1" readonly done ${HOME} printf grep | export
+		echo x=1 test sed x=1 printf cd export readonly x=1 | "$@" 2>/dev/null
+		readonly printf 'quoted text' test "$1" readonly "$@" "$@" awk
+'quoted text' "$@" export local $(pwd)
+		cd --verbose readonly sed grep echo
+	printf && sed done grep printf echo && && -eu --verbose ${HOME} awk sed
+		echo grep "$1" done sed echo --verbose x=1 local awk x=1 'quoted text'
+		printf "$1" --verbose echo 'quoted text'
+	2>/dev/null && && --verbose local 2>/dev/null
+		test sed done export then sed 'quoted text' printf
+	"$@" $(pwd) done "$@" | done /usr/bin
+printf test echo echo sed export -eu sed then echo then cd --verbose
+	$(pwd) grep then grep 2>/dev/null
+		${HOME} then x=1 x=1 export readonly /usr/bin
+	grep printf /usr/bin awk | awk --verbose printf echo then ${HOME} 2>/dev/null
+$(pwd) done "$@" /usr/bin "$@" readonly readonly 2>/dev/null -eu sed /usr/bin
+	grep --verbose x=1 | test readonly
+	$(pwd) 2>/dev/null readonly -eu then $(pwd) then awk && ${HOME} $(pwd) then && grep
+		grep done cd done echo --verbose sed && sed --verbose
+	local cd /usr/bin printf "$@" "$1" x=1 done sed | grep export | then
+	"$1" then then then | local --verbose cd test sed
+${HOME} -eu cd export 2>/dev/null ${HOME} 'quoted text' 2>/dev/null done readonly
+	sed -eu /usr/bin "$@" 'quoted text' sed export --verbose done "$@" "$1" sed $(pwd)
+then "$@" ${HOME} $(pwd) /usr/bin && 2>/dev/null cd readonly
+	${HOME} 2>/dev/null awk /usr/bin echo x=1 grep awk test
+	then sed local "$1" export && | readonly echo local | test
+		x=1 'quoted text' && ${HOME}
+		$(pwd) -eu local && 2>/dev/null 2>/dev/null test "$@" ${HOME}
+		| | -eu cd grep echo --verbose readonly sed --verbose "$1" sed
+		awk 'quoted text' /usr/bin && 'quoted text'
+	readonly 'quoted text' export "$@" grep 2>/dev/null "$1" "$@" echo awk test
+		"$1" cd sed x=1 then && local ${HOME} printf done test
+	&& --verbose then $(pwd) printf
+		/usr/bin 2>/dev/null 'quoted text' test readonly grep && done awk "$1"
+		&& && export readonly &&
+local ${HOME} awk x=1 /usr/bin sed test test done then then --verbose
+$(pwd) then 'quoted text' ${HOME}
+		cd "$1" local cd cd "$1" grep "$@" local
+		local $(pwd) -eu printf local printf cd --verbose ${HOME} "$1" then
+awk && done 'quoted text' 'quoted text' awk ${HOME} "$@"
+"$@" readonly /usr/bin ${HOME} readonly export $(pwd) --verbose && awk grep then
+"$1" 2>/dev/null 2>/dev/null 2>/dev/null ${HOME} ${HOME}
+test -eu test --verbose cd --verbose echo 'quoted text' 'quoted text'
+	"$@" "$@" grep sed "$@" 2>/dev/null 'quoted text' cd awk 2>/dev/null readonly
+	done echo done "$@" | export ${HOME} && $(pwd) grep
+	done cd --verbose export awk && awk test --verbose grep done cd printf
+		| 'quoted text' 'quoted text' -eu 'quoted text' readonly
+	test echo --verbose awk readonly "$1" printf --verbose then x=1
+		$(pwd) grep test x=1 then "$1" 2>/dev/null
+		-eu awk 'quoted text' ${HOME} $(pwd) grep $(pwd) readonly sed echo
+		then --verbose x=1 local awk done ${HOME} 2>/dev/null 2>/dev/null -eu 'quoted text'
+echo then cd awk grep awk $(pwd) echo "$1" "$@" && $(pwd) printf
+		cd test then x=1 test done then export export export 'quoted text'
+		| 'quoted text' cd done printf cd 'quoted text' local readonly done -eu grep
+		grep cd $(pwd) then 'quoted text' $(pwd) | --verbose /usr/bin
+	echo awk grep test x=1 /usr/bin
+		test then done local sed printf
+	'quoted text' | sed "$@" awk 'quoted text' then | /usr/bin
+		| && readonly --verbose
+		| readonly readonly && echo | x=1 'quoted text' /usr/bin -eu 2>/dev/null
+		printf awk then "$1" --verbose cd done local "$1" printf sed 2>/dev/null sed
+done x=1 sed -eu x=1 grep readonly local
+	-eu local 2>/dev/null then /usr/bin
+		"$@" done echo local
+		cd export then 2>/dev/null "$1" ${HOME} $(pwd) awk /usr/bin $(pwd) --verbose /usr/bin
+		"$1" then test printf awk ${HOME} then then $(pwd) export
+		'quoted text' sed test 2>/dev/null cd then then sed export readonly
+	&& local then 'quoted text' awk echo done
+		"$@" && --verbose done /usr/bin
+printf test export grep cd cd 2>/dev/null
+$(pwd) done readonly done "$@" -eu $(pwd) cd | --verbose x=1 "$@" test | test 2>/dev/null
+echo awk "$@" "$1" export 2>/dev/null local --verbose
+	"$@" grep --verbose echo local cd echo cd
+export -eu then $(pwd) 2>/dev/null "$@" $(pwd) | | printf readonly
+	then 2>/dev/null sed echo
+	--verbose done export readonly local | /usr/bin
+export $(pwd) x=1 grep printf x=1 cd | awk "$1" /usr/bin
+	"$@" test "$@" printf "$@" grep --verbose done -eu local -eu "$@" then -eu
+	${HOME} grep local then readonly /usr/bin | sed x=1
+		test awk readonly -eu -eu "$1" export 2>/dev/null ${HOME} /usr/bin
+	cd then cd export 'quoted text' readonly /usr/bin local 'quoted text' ${HOME}
+${HOME} && awk "$1" x=1 printf ${HOME} -eu --verbose done printf "$1" test
+	echo grep 2>/dev/null 'quoted text' "$@" $(pwd) ${HOME} export test
+		readonly printf readonly sed && awk sed printf
+		sed && && "$@" /usr/bin $(pwd) | then local | 'quoted text' /usr/bin
+export readonly x=1 printf x=1 awk
+		'quoted text' -eu | ${HOME} readonly printf then echo x=1 sed local
+readonly --verbose sed grep awk --verbose cd cd cd && export sed
+		2>/dev/null "$1" then && echo then $(pwd) ${HOME} ${HOME} done
+sed | ${HOME} x=1 /usr/bin done
+	| printf "$@" "$1" --verbose | local echo --verbose export cd cd $(pwd) printf
+	'quoted text' -eu --verbose $(pwd) readonly
+	test 'quoted text' | then done /usr/bin cd sed sed readonly
+	readonly x=1 then && export ${HOME}
+'quoted text' local 'quoted text'
+		test printf "$@" export && $(pwd) $(pwd)
+		"$@" export && readonly $(pwd) awk && 2>/dev/null 'quoted text' /usr/bin
+	${HOME} | sed test then 'quoted text' awk && /usr/bin done 'quoted text' x=1
+| local sed cd export echo then /usr/bin readonly
+		| "$1" echo done printf 'quoted text'
+	'quoted text' cd readonly --verbose "$1" 'quoted text'
+	readonly 2>/dev/null local | "$@" /usr/bin x=1
+local x=1 local printf echo | local
+2>/dev/null --verbose local grep ${HOME} done awk "$1" awk "$1" -eu
+		&& $(pwd) grep 'quoted text' cd /usr/bin grep awk
+		x=1 && local done sed "$1" 2>/dev/null
+	-eu $(pwd) x=1 2>/dev/null "$1" $(pwd) "$@" /usr/bin then 2>/dev/null
+		readonly readonly 'quoted text' x=1 2>/dev/null -eu done
+grep $(pwd) cd "$1" "$1" && test && local printf export grep
+	cd grep "$1" 'quoted text' $(pwd)
+		"$@" "$1" awk "$1" | ${HOME} sed test then grep sed x=1 done ${HOME}
+/usr/bin "$1" 'quoted text' "$1" -eu grep x=1
+grep --verbose ${HOME} done && sed | grep cd then echo grep done
+	--verbose test cd "$1" grep printf ${HOME} 2>/dev/null export x=1 export
+	done then $(pwd) cd printf local /usr/bin readonly --verbose echo awk done local
+		$(pwd) "$1" then "$1" "$@" test 'quoted text' local && export && grep && export
+/usr/bin then "$@" ${HOME} "$@" grep echo printf
+	-eu 'quoted text' /usr/bin sed && sed /usr/bin ${HOME} local x=1
+	&& done "$@" 2>/dev/null && 2>/dev/null local "$@" | /usr/bin
+	sed awk --verbose test local
+	${HOME} cd --verbose then | | then 'quoted text' printf then | export
+sed sed awk 2>/dev/null printf printf && x=1 export echo && grep 'quoted text'
+		&& cd readonly local 2>/dev/null cd ${HOME} export
+	echo printf | --verbose -eu 2>/dev/null && grep done grep "$@"
+${HOME} 'quoted text' test -eu grep done echo grep test local
+	&& local 'quoted text'
+readonly cd /usr/bin "$1"
+-eu 2>/dev/null --verbose printf then export --verbose "$1" export echo
+$(pwd) echo $(pwd) local readonly --verbose /usr/bin
+	-eu --verbose sed printf 2>/dev/null -eu export test
+	${HOME} /usr/bin $(pwd) "$1" local
+		$(pwd) readonly /usr/bin | -eu
+		grep test export /usr/bin ${HOME} 2>/dev/null 2>/dev/null
+	x=1 then && ${HOME} printf && awk | $(pwd) /usr/bin 'quoted text'
+		echo grep awk awk readonly readonly "$@" x=1 "$@" local then local grep
+	sed grep $(pwd) local 2>/dev/null
+export $(pwd) $(pwd) readonly readonly awk && done /usr/bin awk "$@" done /usr/bin
+${HOME} "$@" /usr/bin export readonly /usr/bin cd 2>/dev/null
+	then sed local --verbose sed done awk 'quoted text' | $(pwd) readonly local cd
+	export grep $(pwd) 'quoted text'
+"$@" awk 'quoted text' cd x=1 echo ${HOME} $(pwd) test $(pwd) -eu /usr/bin
+	cd x=1 cd cd "$@" sed /usr/bin grep /usr/bin 'quoted text'
+		readonly done echo $(pwd) echo "$@" sed local sed echo | x=1 "$1" 2>/dev/null
+	grep printf sed grep "$1"
+cd "$1" readonly --verbose test test awk -eu awk /usr/bin local "$@"
+awk local x=1 2>/dev/null | readonly echo grep --verbose then sed export
+$(pwd) -eu then sed awk printf 'quoted text' grep $(pwd) && cd --verbose echo
+grep 'quoted text' awk printf --verbose -eu cd then then
+		'quoted text' -eu awk 'quoted text' ${HOME} --verbose done then | echo grep
+printf test readonly printf grep grep ${HOME} | --verbose "$1" x=1 2>/dev/null
+		-eu 'quoted text' -eu awk --verbose "$1" "$1" done "$@" then sed local export
+	--verbose | 2>/dev/null 2>/dev/null
+	awk echo sed sed printf -eu printf
+	"$@" "$1" test $(pwd) x=1 printf printf grep echo cd echo local --verbose
+		echo grep sed grep readonly readonly | "$1" test --verbose | | test export
+		2>/dev/null sed grep done "$@" && done x=1 then x=1 "$1"
+export $(pwd) printf local done printf /usr/bin -eu readonly echo done grep
+		'quoted text' awk $(pwd) printf && x=1 --verbose then
+&& local "$@" printf --verbose 2>/dev/null cd /usr/bin --verbose && export x=1 grep
+done grep printf | cd "$1" export export -eu && then
+	"$@" 'quoted text' /usr/bin "$1" $(pwd)
+		export export && | "$1" --verbose "$1" 2>/dev/null x=1
+cd ${HOME} /usr/bin && -eu x=1
+		local "$@" "$1" /usr/bin $(pwd) export x=1 awk 'quoted text' "$@" ${HOME} echo sed
+x=1 cd readonly then -eu done done /usr/bin "$1" sed 2>/dev/null
+		echo && -eu /usr/bin "$@" 'quoted text' -eu $(pwd) awk
+	"$1" then cd "$@" $(pwd) --verbose --verbose cd ${HOME} cd 2>/dev/null --verbose
+"$1" "$@" cd readonly "$1" export ${HOME}
+		test printf printf "$1" /usr/bin echo /usr/bin awk --verbose
+export then --verbose -eu
+		export sed ${HOME} readonly readonly sed sed echo readonly | done
+	grep sed "$1" && then done done ${HOME} echo done ${HOME}
+	'quoted text' && --verbose 2>/dev/null "$@"
+		${HOME} cd cd /usr/bin 2>/dev/null /usr/bin -eu then awk $(pwd) | -eu printf
+&& readonly -eu /usr/bin "$1" grep test /usr/bin
+	x=1 sed 2>/dev/null /usr/bin local then "$1" ${HOME} grep
+2>/dev/null "$@" awk then && then then printf
+		readonly cd 'quoted text' echo | "$1" readonly "$@"
+$(pwd) --verbose grep cd "$1" test $(pwd) cd
+	done --verbose x=1 printf "$1" --verbose local x=1 | printf local "$@" awk awk --verbose
+	local cd --verbose x=1 x=1
+x=1 then done -eu | 'quoted text' x=1
+		local ${HOME} -eu "$@" "$@" && then
+	export "$@" $(pwd) && "$@" then -eu grep done then test 'quoted text'
+		x=1 printf echo -eu /usr/bin 'quoted text'
+"$@" sed test local | 2>/dev/null grep grep sed ${HOME} test sed --verbose
+	cd then readonly | ${HOME} readonly "$@" export awk printf
+	'quoted text' export printf awk $(pwd) /usr/bin
+		echo -eu 2>/dev/null printf "$@" export
+		export 2>/dev/null $(pwd) $(pwd) ${HOME} -eu test readonly
+	local x=1 $(pwd) 'quoted text' awk 'quoted text' 2>/dev/null
+--verbose printf then "$1" local 2>/dev/null "$1" test test grep printf 'quoted text'
+grep /usr/bin --verbose | awk "$@" -eu then sed "$@" ${HOME}
+	--verbose --verbose 'quoted text' | x=1 "$1" readonly done 'quoted text'
+done cd export ${HOME}
+-eu 2>/dev/null local readonly $(pwd) export 'quoted text' ${HOME} "$@" --verbose
+		awk 2>/dev/null 2>/dev/null | 2>/dev/null export awk done 2>/dev/null 'quoted text'
+	$(pwd) && 2>/dev/null |
+test grep printf then cd grep
+	done echo local "$@" | $(pwd) printf /usr/bin | echo "$1" cd
+	${HOME} cd && -eu echo grep printf
+		grep export | cd export 'quoted text' sed "$1" local "$@"
+	x=1 cd $(pwd) test grep -eu sed export local ${HOME} sed 2>/dev/null
+		awk x=1 $(pwd) grep ${HOME} ${HOME} done "$@"
+x=1 awk sed && then "$@" "$@" then printf grep export "$1" export done awk
+done local export echo $(pwd) --verbose x=1 --verbose ${HOME} awk $(pwd)
+	cd cd -eu then 'quoted text' --verbose export /usr/bin | /usr/bin done -eu
+	test then local x=1 printf --verbose 'quoted text'
+		test && "$@" test local && /usr/bin $(pwd) done local 'quoted text' -eu
+		done /usr/bin --verbose printf printf ${HOME} ${HOME} -eu 'quoted text'
+		awk | "$1" --verbose /usr/bin test sed "$1" done ${HOME} 'quoted text'
+grep x=1 then readonly local test && -eu /usr/bin | printf
+	x=1 then --verbose && $(pwd) && x=1 printf -eu "$1"
+	x=1 sed test awk "$@" 2>/dev/null local x=1 $(pwd) $(pwd) test
+&& cd local printf local && then printf ${HOME} then printf
+x=1 export "$@" "$1" test echo && 2>/dev/null
+$(pwd) $(pwd) then done "$@" $(pwd) sed done --verbose 'quoted text'
+test awk export /usr/bin readonly $(pwd) test then done test && cd
+	"$1" printf then sed grep $(pwd) "$1" awk awk sed sed export cd
+/usr/bin test ${HOME} 'quoted text' test readonly readonly
+		printf "$1" $(pwd) printf $(pwd) grep --verbose
+local export readonly printf
+		${HOME} grep export done $(pwd)
+		export 'quoted text' --verbose cd test ${HOME}
+grep sed readonly | 'quoted text' then
+		'quoted text' /usr/bin ${HOME} printf export test x=1 cd ${HOME}
+		"$@" 2>/dev/null local x=1 $(pwd) 'quoted text' ${HOME}
+		/usr/bin echo "$1" -eu "$@" x=1 --verbose
+		| 2>/dev/null x=1 sed sed readonly sed 'quoted text'
+	${HOME} local then --verbose awk 2>/dev/null 2>/dev/null ${HOME}
+	x=1 'quoted text' awk $(pwd)
+		test --verbose then echo sed echo "$1" 2>/dev/null cd grep export
+	printf sed --verbose ${HOME} local ${HOME} awk
+	printf -eu $(pwd) ${HOME} export
+-eu | x=1 test --verbose $(pwd) awk cd export && test x=1 printf && --verbose
+	echo "$@" "$1" then local x=1 awk test
+--verbose done test awk local printf echo
+	local 2>/dev/null then sed
+	/usr/bin awk 2>/dev/null "$1" export readonly --verbose
+grep awk -eu then done sed export printf readonly test export
+	local readonly sed /usr/bin awk awk echo printf export && "$1" awk test
+--verbose awk x=1 && readonly
+	export 2>/dev/null test echo local sed export local sed x=1 2>/dev/null
+cd 2>/dev/null test 'quoted text' --verbose export export x=1 ${HOME} readonly 2>/dev/null
+| && test done printf local sed local grep
+	echo awk echo /usr/bin x=1 'quoted text'
+readonly && local then /usr/bin
+echo x=1 "$1" grep x=1 grep readonly then sed grep grep then /usr/bin
+echo $(pwd) printf awk | local echo -eu /usr/bin printf awk then
+		--verbose --verbose sed "$@" ${HOME} 'quoted text' && | awk
+	2>/dev/null 'quoted text' cd grep -eu awk grep local then echo
+		grep | -eu --verbose x=1 "$1" $(pwd)
+	$(pwd) awk printf test awk printf $(pwd) 'quoted text' echo "$1" readonly
+		&& $(pwd) "$@" /usr/bin "$@" then sed grep then echo done "$@"
+x=1 /usr/bin "$@" "$@" grep
+		&& cd 2>/dev/null readonly "$@" -eu
+		$(pwd) "$1" --verbose done then sed x=1 then
+	2>/dev/null /usr/bin /usr/bin
+		${HOME} x=1 awk export done
+	$(pwd) -eu echo readonly echo 'quoted text' export echo "$@"
+"$1" $(pwd) then awk 2>/dev/null then && done readonly --verbose
+		$(pwd) $(pwd) then readonly | grep echo export &&
+/usr/bin local --verbose export && awk 2>/dev/null
+	printf grep "$@" export ${HOME} | 2>/dev/null 'quoted text' ${HOME} grep
+&& awk cd then && --verbose -eu local
+		done local -eu printf 'quoted text' test readonly then local 2>/dev/null
+/usr/bin test cd then printf
+		echo 'quoted text' readonly echo ${HOME} then "$@" && /usr/bin sed -eu | $(pwd)
+then grep "$@" -eu x=1 printf "$@" readonly readonly sed local
+then 'quoted text' $(pwd)
+cd /usr/bin ${HOME} done "$1" -eu done x=1 ${HOME} "$@" --verbose sed &&
+then && test x=1 /usr/bin then cd "$1" local --verbose $(pwd) printf
+		--verbose $(pwd) grep export 2>/dev/null test
+	sed x=1 "$1" sed cd "$@" printf then 2>/dev/null readonly then -eu printf
+		cd echo "$@" --verbose done readonly
+		"$@" printf "$1" sed done "$1" done ${HOME} /usr/bin cd -eu x=1 export
+printf x=1 "$1" x=1 'quoted text'
+	${HOME} done export && grep | done "$1" | "$1" -eu
+"$@" | $(pwd) test done
+		'quoted text' -eu | 'quoted text' cd -eu
+'quoted text' printf 'quoted text' local "$1" sed printf test ${HOME} -eu
+then local "$1" x=1 then --verbose
+		x=1 sed ${HOME} grep ${HOME} 'quoted text'
+	echo awk x=1 'quoted text' cd grep /usr/bin -eu export
+	done readonly && local export test readonly /usr/bin test
+then -eu export then echo export "$@" 2>/dev/null
+-eu && echo sed $(pwd) | cd test
+		&& | 'quoted text' cd --verbose x=1 then "$1" | printf done export "$@" --verbose
+	2>/dev/null awk grep then awk --verbose
+		${HOME} 'quoted text' | --verbose cd sed
+--verbose readonly readonly sed && "$@" /usr/bin done done /usr/bin
+	$(pwd) printf /usr/bin "$@" x=1 2>/dev/null grep | "$@" "$@" "$1" done -eu sed "$1"
+	awk 'quoted text' -eu $(pwd) x=1 grep
+		$(pwd) printf ${HOME} export then ${HOME} local ${HOME}
+		export then | -eu cd printf ${HOME}
+2>/dev/null done readonly --verbose
+	-eu printf cd --verbose awk 2>/dev/null
+local x=1 -eu $(pwd) $(pwd) | printf "$1" /usr/bin ${HOME} sed done --verbose
+cd printf test readonly grep local export 'quoted text' then export "$@"
+echo sed cd && ${HOME} "$@"
+readonly --verbose x=1 ${HOME} awk $(pwd) test | -eu && && /usr/bin
+	sed "$1" readonly then cd printf cd --verbose then then grep sed $(pwd)
+	then 2>/dev/null local then cd export awk local
+		echo done 2>/dev/null readonly 'quoted text' echo readonly | echo readonly
+		done $(pwd) echo export 'quoted text'
+	sed local printf 2>/dev/null done x=1 echo readonly printf local readonly test grep
+"$1" sed 'quoted text' cd
+	| printf 2>/dev/null | && readonly local grep --verbose sed printf -eu 'quoted text'
+	/usr/bin sed "$1" x=1 done local sed grep 'quoted text' "$1" ${HOME} x=1
+2>/dev/null awk sed && | "$1" export 2>/dev/null local
+	-eu -eu then | grep export test test 'quoted text' sed
+	x=1 cd test grep printf local local && export export sed cd /usr/bin x=1 && grep
+printf grep sed local echo | local grep export printf cd printf export readonly
+	local $(pwd) ${HOME} -eu awk 'quoted text' sed printf cd ${HOME} local
+$(pwd) "$@" --verbose readonly then 'quoted text' ${HOME}
+		done && ${HOME} echo 'quoted text' "$1" /usr/bin grep
+		grep 2>/dev/null --verbose $(pwd) $(pwd) grep
+test cd export grep -eu && $(pwd) /usr/bin cd --verbose readonly
+		local /usr/bin /usr/bin $(pwd) "$1" x=1 /usr/bin
+		/usr/bin local --verbose grep /usr/bin -eu export "$@" cd local readonly
+		done $(pwd) grep local
+		cd grep grep then test printf
+	readonly awk 2>/dev/null
+test -eu local echo awk echo then --verbose
+printf sed echo 'quoted text'
+		awk test 'quoted text' && && x=1 | echo | awk printf -eu
+		export /usr/bin 'quoted text' grep
+	| export export local done sed 'quoted text'
+	cd then readonly /usr/bin export test | --verbose 2>/dev/null
+		readonly cd 2>/dev/null | "$@" printf /usr/bin --verbose
+export cd /usr/bin readonly /usr/bin
+-eu /usr/bin x=1 | echo /usr/bin export grep "$@" test 'quoted text' /usr/bin
+	echo readonly then echo 'quoted text'
+awk readonly awk printf done done x=1 sed x=1 "$1" test awk
+		awk 'quoted text' 2>/dev/null
+	export 'quoted text' echo
+		printf test "$@" --verbose grep sed readonly echo local echo export
+printf x=1 cd grep 2>/dev/null done
+-eu --verbose --verbose local x=1 local grep awk
+then readonly x=1 printf 2>/dev/null ${HOME} $(pwd) $(pwd)
+readonly cd $(pwd) /usr/bin sed then 'quoted text'
+local | printf --verbose
+	printf | awk 'quoted text' /usr/bin -eu readonly
+	export sed 2>/dev/null ${HOME} --verbose ${HOME} test readonly
+x=1 sed cd /usr/bin "$@" --verbose 'quoted text' done test sed export
+printf x=1 local readonly $(pwd) $(pwd) /usr/bin export "$1" export
+		$(pwd) sed grep "$@" 'quoted text' done 2>/dev/null && 'quoted text'
+	printf printf x=1 export "$1" 'quoted text'
+		then && cd printf readonly echo | $(pwd)
+	done x=1 awk $(pwd) |
+		"$@" --verbose "$@" readonly
+${HOME} then export $(pwd) echo /usr/bin /usr/bin
+		2>/dev/null | $(pwd) 2>/dev/null && ${HOME} 2>/dev/null then x=1 sed -eu cd "$1"
+	-eu 'quoted text' 2>/dev/null test done "$1" sed -eu |
+		| $(pwd) | test grep /usr/bin
+awk $(pwd) ${HOME} printf export --verbose | | --verbose sed "$1" grep -eu
+		"$1" grep | $(pwd) $(pwd) ${HOME} "$1" --verbose grep $(pwd) printf
+		export readonly readonly export grep
+		--verbose ${HOME} local then | sed -eu
+printf local local -eu grep "$1" then export
+	grep awk && /usr/bin cd sed $(pwd) 2>/dev/null ${HOME} done ${HOME}
+		-eu then local ${HOME} ${HOME} then echo | "$1" local export && readonly
+	test "$1" done done ${HOME} -eu ${HOME} done grep && test && "$@" grep export
+${HOME} --verbose export awk ${HOME} cd "$@" /usr/bin $(pwd) "$@"
+	echo grep grep 2>/dev/null 2>/dev/null 2>/dev/null sed echo
+		echo --verbose && echo awk test readonly
+local 'quoted text' printf done /usr/bin done done grep test x=1 done echo
+		'quoted text' "$@" 'quoted text' "$1" 'quoted text' done ${HOME} /usr/bin
+		"$1" "$1" cd 'quoted text' grep && printf | | echo awk
+sed export | echo /usr/bin ${HOME} 2>/dev/null
+	awk local "$1" done && "$@" readonly
+	sed awk sed done 'quoted text' 'quoted text'
+		awk $(pwd) echo grep x=1 /usr/bin readonly printf test && "$@" $(pwd)
+"$1" done /usr/bin --verbose 2>/dev/null local 2>/dev/null test x=1
+	awk done x=1 sed awk "$1" done cd ${HOME} cd local grep readonly |
+		${HOME} 2>/dev/null echo grep 2>/dev/null
+		| cd 'quoted text' -eu 'quoted text'
+	readonly then 2>/dev/null test echo 'quoted text' /usr/bin ${HOME}
+		readonly export 'quoted text' -eu "$1" test local echo && echo local "$1"
+	printf | 'quoted text' export --verbose then && test $(pwd) /usr/bin -eu &&
+'quoted text' readonly
+then "$1" "$@" "$@" -eu --verbose grep sed
+		'quoted text' awk test ${HOME} /usr/bin cd x=1 cd | ${HOME} local
+	| 2>/dev/null echo | printf printf "$1" --verbose test then
+-eu sed echo && --verbose test "$1" grep sed | /usr/bin
+-eu export grep export echo $(pwd) readonly done ${HOME} test
+		awk | cd --verbose 'quoted text' echo awk | /usr/bin x=1 --verbose
+		printf ${HOME} /usr/bin "$@" test 2>/dev/null
+grep | done done awk sed grep grep 'quoted text' printf printf done &&
+	awk cd 2>/dev/null 'quoted text' awk --verbose && sed
+		| 'quoted text' | printf grep --verbose "$1" "$@" cd grep grep echo && "$@"
+	$(pwd) sed printf cd /usr/bin x=1 local | --verbose
+		grep --verbose 'quoted text' test cd ${HOME} readonly printf ${HOME} test
+echo "$1" "$1" readonly /usr/bin -eu ${HOME} && grep
+awk "$1" | | export && test then then 2>/dev/null
+		"$@" local grep printf awk x=1 --verbose
+		--verbose then grep readonly awk printf cd grep cd readonly | "$1"
+/usr/bin "$1" /usr/bin awk then -eu then $(pwd) /usr/bin -eu "$1" /usr/bin
+/usr/bin test local readonly printf 2>/dev/null
+		--verbose grep test export ${HOME} 2>/dev/null -eu "$1" && echo | done readonly
+	test echo "$@" -eu readonly done $(pwd) readonly test cd 2>/dev/null | -eu
+&& 'quoted text' ${HOME} 2>/dev/null 'quoted text'
+		$(pwd) "$1" readonly 2>/dev/null | $(pwd) then cd ${HOME} local
+		$(pwd) echo -eu done "$@" 'quoted text' | cd test "$1" export /usr/bin
+$(pwd) export "$1" x=1 echo /usr/bin local echo ${HOME} /usr/bin
+		then && test printf readonly grep --verbose | 2>/dev/null sed
+		readonly done then /usr/bin cd x=1
+		"$1" ${HOME} x=1 local echo then done /usr/bin
+	-eu /usr/bin readonly local
+	test printf local && x=1 echo cd ${HOME} $(pwd)
+	${HOME} printf grep 'quoted text'
+sed /usr/bin then -eu /usr/bin
+		'quoted text' echo ${HOME} -eu sed | echo sed
+		local "$1" awk 'quoted text' 2>/dev/null cd test $(pwd) done local local $(pwd)
+		sed sed --verbose local "$@" /usr/bin printf grep "$1" "$1" printf
+awk export "$1" sed /usr/bin
+		| ${HOME} echo echo cd awk 2>/dev/null awk done $(pwd) --verbose awk awk | export
+		"$1" sed 2>/dev/null awk /usr/bin local /usr/bin grep -eu then
+"$@" then sed local readonly
+sed --verbose $(pwd) /usr/bin /usr/bin /usr/bin
+| 2>/dev/null x=1 && awk x=1 done export $(pwd) x=1
+	"$@" done then ${HOME} && readonly
+		"$@" awk && --verbose then then 2>/dev/null grep grep | /usr/bin --verbose
+	then -eu && awk done 'quoted text' && /usr/bin 2>/dev/null x=1 awk -eu grep
+		then --verbose -eu test grep ${HOME} 'quoted text'
+	"$1" 'quoted text' readonly awk 2>/dev/null echo 'quoted text' -eu grep
+	readonly then -eu then local $(pwd) cd --verbose cd readonly "$@" $(pwd) test
+export && test local
+	/usr/bin 2>/dev/null "$@" awk sed /usr/bin local /usr/bin --verbose 'quoted text'
+		done "$1" && awk /usr/bin 2>/dev/null
+		echo echo printf cd -eu cd "$1"
+x=1 local --verbose "$@" awk x=1 | x=1 grep ${HOME} ${HOME} local
+${HOME} /usr/bin test done -eu && /usr/bin printf
+	done --verbose $(pwd) sed && "$1" awk local
+| 'quoted text' cd 2>/dev/null sed done
+${HOME} /usr/bin --verbose --verbose --verbose -eu readonly
+	export test awk 2>/dev/null --verbose readonly awk /usr/bin done
+		awk 'quoted text' "$@" done echo /usr/bin
+		test grep then 'quoted text' && /usr/bin x=1 echo --verbose 2>/dev/null 'quoted text'
+export sed printf printf then test export && $(pwd)
+	then -eu ${HOME} sed test echo /usr/bin
+--verbose awk --verbose && "$@" ${HOME} echo export --verbose x=1 grep sed $(pwd)
+		then -eu readonly "$1" /usr/bin /usr/bin test test sed
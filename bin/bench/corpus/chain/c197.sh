@@ -0,0 +1,2001 @@
+		"$1" local awk export sed && 2>/dev/null | -eu readonly export
+		&& 'quoted text' 'quoted text' | "$1" x=1
+	cd 'quoted text' echo --verbose
+	| awk -eu then readonly
+		echo then awk sed printf grep then cd /usr/bin sed $(pwd) local ${HOME}
+		$(pwd) 2>/dev/null x=1 "$@"
+	then printf "$1" -eu local | readonly
+	done local 'quoted text' local | then "$1" awk |
+		/usr/bin ${HOME} echo "$@" grep x=1 local ${HOME} && grep
+	&& done local | printf
+"$1" $(pwd) $(pwd) -eu 2>/dev/null
+		${HOME} cd done echo 2>/dev/null ${HOME} 'quoted text' /usr/bin ${HOME} ${HOME}
+"$1" "$1" 'quoted text' ${HOME} | cd sed ${HOME} 'quoted text'
+		cd echo x=1 cd ${HOME} "$1" readonly echo /usr/bin
+	$(pwd) $(pwd) awk done -eu
+	&& "$@" 2>/dev/null printf --verbose grep "$@" x=1 $(pwd) 'quoted text'
+--verbose export local 'quoted text'
+	$(pwd) then test test echo 'quoted text' cd then cd -eu "$@" | local -eu && sed
+x=1 | "$1" "$1" /usr/bin | --verbose -eu ${HOME} sed 'quoted text'
+	readonly local /usr/bin awk export local export /usr/bin ${HOME} x=1 then
+	"$@" test sed | --verbose echo --verbose "$1" export ${HOME} test
+readonly 'quoted text' "$@" x=1 cd export export test
+		sed x=1 grep --verbose "$1" $(pwd) awk test x=1 then
+--verbose -eu grep local 'quoted text' | ${HOME} | x=1 "$1"
+$(pwd) /usr/bin --verbose "$1" x=1 echo $(pwd) "$1" --verbose
+export sed test printf local $(pwd)
+		"$1" "$@" cd | awk awk export -eu x=1 -eu "$1" x=1 /usr/bin -eu
+	${HOME} 2>/dev/null /usr/bin -eu 2>/dev/null
+local /usr/bin echo --verbose
+	grep done cd -eu printf -eu sed sed "$1" x=1 $(pwd) sed
+		"$1" awk --verbose then awk $(pwd) | export sed $(pwd) "$1" && --verbose
+		test printf readonly --verbose "$1" echo 'quoted text' then
+		&& $(pwd) "$1" echo sed done
+'quoted text' printf test -eu $(pwd) local sed /usr/bin done "$@" "$@"
+		'quoted text' | /usr/bin done "$1" readonly "$@" awk "$1" done
+		--verbose awk then 2>/dev/null 'quoted text'
+	--verbose cd sed then echo && && /usr/bin "$@" done 'quoted text'
+"$@" then | printf ${HOME}
+	| grep echo --verbose then test -eu awk sed $(pwd) export x=1
+	printf local x=1 'quoted text' /usr/bin "$1" awk done awk done done ${HOME} export
+"$1" grep $(pwd) done cd echo -eu | 'quoted text'
+	$(pwd) printf awk -eu $(pwd) awk "$@" -eu 2>/dev/null echo readonly
+		--verbose export | 2>/dev/null local sed then 'quoted text'
+	grep echo readonly then -eu
+	awk x=1 printf test grep | "$1" |
+awk /usr/bin && | --verbose awk 2>/dev/null sed | printf | local cd ${HOME} readonly
+		local x=1 /usr/bin cd ${HOME}
+		awk grep export sed printf
+	/usr/bin grep | && "$1" && "$@" done local x=1 /usr/bin
+		| "$@" 2>/dev/null grep then $(pwd) x=1 2>/dev/null /usr/bin awk
+		/usr/bin "$@" printf &&
+/usr/bin | test export $(pwd) --verbose local --verbose
+	cd "$1" printf ${HOME} sed $(pwd) local | readonly sed --verbose x=1 ${HOME}
+	"$@" local then awk then | --verbose cd printf x=1 /usr/bin then
+echo $(pwd) 'quoted text' /usr/bin $(pwd) -eu then sed
+		local $(pwd) | sed cd ${HOME} export && -eu echo test grep local "$@"
+echo -eu $(pwd) export | $(pwd) -eu awk readonly
+		sed "$1" && then sed /usr/bin printf
+		done x=1 ${HOME} /usr/bin local awk
+local test 2>/dev/null local -eu echo test
+-eu "$1" 2>/dev/null then ${HOME} export then awk 2>/dev/null
+	echo sed /usr/bin cd x=1 sed
+| done 2>/dev/null sed cd
+sed done export grep done local done
+echo $(pwd) /usr/bin && /usr/bin echo done printf awk printf test
+2>/dev/null cd then grep
+	2>/dev/null x=1 local | awk && && done then
+	-eu "$@" /usr/bin ${HOME} ${HOME} && local /usr/bin local then then 'quoted text'
+local sed awk x=1 then readonly && export 'quoted text'
+	| /usr/bin | printf test
+	cd --verbose 2>/dev/null awk sed cd echo local echo
+	sed printf 'quoted text' -eu -eu $(pwd) readonly 'quoted text' export "$1" -eu
+		"$@" local sed /usr/bin local grep awk "$1" sed local
+awk export sed done echo ${HOME} && $(pwd)
+&& "$@" /usr/bin test "$@" local "$@" export x=1 'quoted text' $(pwd)
+	printf --verbose echo done printf
+	2>/dev/null awk 2>/dev/null ${HOME} 'quoted text' 'quoted text' 'quoted text' echo
+${HOME} "$@" then test
+		local test done "$1" readonly readonly ${HOME} printf cd then $(pwd)
+		grep /usr/bin | cd local done x=1 test readonly
+"$1" && test local --verbose grep "$1" ${HOME} -eu awk
+awk /usr/bin local then && cd ${HOME} echo ${HOME}
+&& cd awk x=1 $(pwd) ${HOME} test "$1"
+	export --verbose --verbose
+	done echo 2>/dev/null done done "$1" "$@" done --verbose echo "$@" done then 2>/dev/null
+		--verbose 2>/dev/null "$1" 'quoted text' printf done "$1" sed grep "$@"
+		then export 2>/dev/null local readonly done
+cd --verbose cd "$@" ${HOME} "$1" && /usr/bin
+local "$1" /usr/bin test local "$@" ${HOME}
+${HOME} --verbose "$@" echo
+		printf then test && done printf cd $(pwd) done 2>/dev/null local | then
+		then ${HOME} local readonly -eu 2>/dev/null
+	awk echo grep local then ${HOME} $(pwd) local awk printf && && cd
+sed sed "$@" awk cd "$1" awk export awk x=1
+	export local test done done | export "$1" "$@" 'quoted text' && x=1
+-eu then local printf -eu 'quoted text' ${HOME} --verbose "$@" test && -eu
+		| --verbose readonly done
+		export then "$@" echo "$@" done -eu 'quoted text'
+	printf -eu echo /usr/bin 2>/dev/null export grep /usr/bin printf
+"$1" echo echo $(pwd) then printf local
+	echo printf cd "$1" readonly -eu done sed echo && && 2>/dev/null readonly x=1
+		readonly && "$@" -eu --verbose ${HOME} then | ${HOME}
+		'quoted text' printf cd x=1 test test
+	export 'quoted text' export && awk sed
+x=1 export sed sed test sed
+		'quoted text' && done awk sed readonly --verbose done
+cd ${HOME} cd grep 2>/dev/null done awk && 2>/dev/null 'quoted text' /usr/bin
+		test | awk readonly test 'quoted text' readonly $(pwd)
+	"$1" /usr/bin sed echo "$@" 'quoted text'
+	grep ${HOME} sed "$@" then then export $(pwd) ${HOME} awk echo "$1"
+		| -eu "$1" cd awk "$1" grep | local x=1
+		x=1 printf readonly x=1 readonly "$1" /usr/bin
+x=1 2>/dev/null $(pwd) 'quoted text' printf awk cd test awk && 2>/dev/null
+		'quoted text' "$@" --verbose "$1"
+	"$1" && $(pwd) ${HOME} echo --verbose && awk "$1" && && awk grep test
+	grep $(pwd) test local --verbose
+then printf ${HOME} printf sed cd x=1 echo printf awk grep
+		"$@" | printf && test done done 'quoted text' readonly sed cd 'quoted text'
+	export grep $(pwd) $(pwd) sed 2>/dev/null readonly
+		printf then local $(pwd) cd readonly export 2>/dev/null "$@"
+done local x=1 done $(pwd) then 'quoted text' "$@" done
+		2>/dev/null export && | && | ${HOME} readonly printf awk export "$1" --verbose ${HOME}
+	readonly ${HOME} test 2>/dev/null done 'quoted text'
+		x=1 sed readonly done local
+'quoted text' "$1" 'quoted text'
+		grep /usr/bin then | awk -eu echo /usr/bin /usr/bin cd export ${HOME} cd grep
+		"$1" "$@" "$@" --verbose
+	awk ${HOME} /usr/bin cd | -eu "$@" 2>/dev/null /usr/bin
+	"$1" 'quoted text' awk -eu cd sed test printf sed
+		&& -eu done export "$1" x=1 readonly --verbose
+	grep /usr/bin done 'quoted text'
+		export "$1" done sed test "$@" readonly
+local then then x=1 export 'quoted text' sed $(pwd) && "$1" local readonly --verbose
+		'quoted text' | printf awk cd "$1" --verbose sed sed local -eu
+		$(pwd) | cd | then done
+	-eu local /usr/bin sed "$1" then
+		'quoted text' 'quoted text'
+grep test printf && && 'quoted text'
+	2>/dev/null x=1 awk | x=1 'quoted text' printf -eu "$1"
+		x=1 | /usr/bin sed grep awk export test echo then |
+		local test printf cd export export && "$1" ${HOME} readonly grep
+	--verbose sed sed cd --verbose
+	$(pwd) -eu x=1 local $(pwd) done
+cd then "$1" sed readonly
+		local then 2>/dev/null /usr/bin
+"$@" done $(pwd) -eu echo printf -eu "$1" sed x=1 grep done | test "$@"
+	${HOME} "$@" $(pwd) awk 'quoted text' -eu export cd cd
+		then ${HOME} awk && && | printf readonly /usr/bin | ${HOME}
+		local 2>/dev/null | --verbose $(pwd) --verbose then 2>/dev/null /usr/bin local
+		&& test 2>/dev/null printf /usr/bin test test test printf -eu |
+grep cd && export ${HOME} x=1 export echo export awk x=1 -eu done
+local --verbose x=1 $(pwd)
+	sed readonly ${HOME} 2>/dev/null
+		x=1 test test $(pwd) done cd && /usr/bin echo test $(pwd)
+		"$@" sed local 2>/dev/null awk
+&& echo grep export && echo ${HOME} export grep --verbose
+test -eu cd "$@" ${HOME} sed sed "$@" ${HOME} then x=1 $(pwd)
+&& done /usr/bin $(pwd) echo --verbose test ${HOME} 'quoted text'
+		awk printf x=1 awk awk --verbose | test && local x=1
+2>/dev/null local | --verbose grep done "$@" echo | && x=1 -eu "$1"
+grep "$1" local readonly local 'quoted text' && -eu &&
+readonly cd echo test export
+	printf done local local $(pwd)
+x=1 | printf test export /usr/bin --verbose
+$(pwd) 2>/dev/null local "$@" readonly | && x=1 | ${HOME}
+	then export $(pwd) 'quoted text' -eu 2>/dev/null
+		${HOME} export "$1" readonly 'quoted text' x=1 export
+grep readonly readonly $(pwd) awk -eu | ${HOME} $(pwd)
+| export local test ${HOME} $(pwd) done
+		"$1" echo ${HOME} "$@" test $(pwd)
+		--verbose /usr/bin local readonly echo export grep test && local export
+readonly awk cd local $(pwd) "$@" -eu -eu | 'quoted text'
+		cd ${HOME} /usr/bin ${HOME}
+x=1 && && sed "$1" 'quoted text' done
+		2>/dev/null export test "$1" readonly
+	done --verbose cd $(pwd) export 2>/dev/null test "$@" 2>/dev/null $(pwd)
+	&& cd 'quoted text' test echo $(pwd) readonly x=1 && local
+		grep then "$1" readonly done $(pwd) $(pwd) cd 'quoted text'
+	&& readonly echo readonly "$@" export x=1 && ${HOME} local --verbose
+-eu sed echo x=1 then done
+export -eu "$1" /usr/bin export 2>/dev/null "$@" local export awk awk -eu /usr/bin
+		awk sed cd && && local ${HOME}
+		export printf /usr/bin done test printf -eu | printf ${HOME} export test
+		sed "$1" echo | sed done --verbose 'quoted text' local
+		-eu sed /usr/bin printf then then awk --verbose 2>/dev/null /usr/bin test done printf
+	'quoted text' x=1 done awk
+		test x=1 grep ${HOME} sed "$1" cd /usr/bin x=1 && export /usr/bin
+	readonly -eu "$@" sed test then printf cd done printf /usr/bin
+		done then && && printf /usr/bin done
+	| 'quoted text' | x=1 test x=1 x=1 -eu $(pwd) awk printf "$1" /usr/bin -eu "$1"
+		then done printf local then sed 'quoted text' -eu echo
+echo sed && printf then echo ${HOME} ${HOME} printf
+		"$@" local awk 2>/dev/null printf /usr/bin x=1
+	grep printf "$@" 'quoted text'
+	-eu export /usr/bin cd echo sed "$1" echo echo printf printf done export 'quoted text'
+	${HOME} ${HOME} -eu printf sed
+		'quoted text' then cd then 2>/dev/null cd --verbose "$1" 2>/dev/null
+		| test --verbose $(pwd) local then "$1"
+	done export cd sed 2>/dev/null 2>/dev/null ${HOME} x=1 local grep
+		"$@" awk test printf x=1 $(pwd) -eu done
+'quoted text' --verbose 2>/dev/null
+		grep "$1" grep export sed -eu sed done | 'quoted text' cd 'quoted text' "$@" "$1"
+awk 2>/dev/null $(pwd) $(pwd) "$1" -eu
+printf && done sed local -eu sed |
+		| | printf test $(pwd) | 'quoted text' awk /usr/bin echo x=1
+${HOME} sed printf --verbose && awk x=1 &&
+cd -eu | then && "$1" /usr/bin $(pwd) readonly echo local "$1" local
+	printf cd ${HOME} "$1" awk sed | | awk then "$@" grep --verbose awk export
+	then | readonly ${HOME} 'quoted text'
+		/usr/bin | "$1" $(pwd) local done printf awk -eu test $(pwd)
+	${HOME} 'quoted text' && --verbose local export grep && grep grep printf
+	printf readonly $(pwd) sed $(pwd) then cd awk | 'quoted text'
+"$@" echo | 'quoted text' echo "$@" readonly done local "$1"
+		printf done cd 'quoted text' local x=1 2>/dev/null 'quoted text'
+sed export export 2>/dev/null x=1 local /usr/bin cd /usr/bin
+	/usr/bin sed "$1" done && | x=1 "$1" echo
+awk x=1 echo x=1 then export "$@" && "$@"
+	--verbose 2>/dev/null printf then export
+		awk /usr/bin "$1" readonly done "$1" cd "$@" ${HOME} -eu x=1 then grep
+-eu export $(pwd) cd local sed ${HOME} "$1"
+		${HOME} "$@" && awk 2>/dev/null readonly awk 'quoted text' 'quoted text'
+		${HOME} /usr/bin awk awk x=1 /usr/bin $(pwd)
+		grep 'quoted text' 'quoted text'
+printf printf "$@" local awk export -eu export printf "$1" "$@" awk then
+done 'quoted text' x=1 "$1" -eu done && done then sed 'quoted text' sed
+	${HOME} "$1" "$@" printf sed -eu /usr/bin export "$1" x=1 printf
+$(pwd) done printf 'quoted text' -eu 'quoted text'
+	test ${HOME} cd grep then x=1 ${HOME}
+readonly /usr/bin grep done 2>/dev/null grep "$1" local ${HOME} "$@"
+		then sed readonly && export -eu 'quoted text' local
+	cd x=1 -eu | local export 2>/dev/null echo && local done test export "$@"
+	printf test echo x=1 echo export printf --verbose sed 'quoted text'
+	export && readonly readonly sed $(pwd) "$@" 2>/dev/null
+		printf test awk grep awk -eu 'quoted text' readonly "$1" export
+awk echo sed 2>/dev/null cd "$1" readonly x=1 done
+	readonly printf "$1" printf export sed "$@" local -eu cd echo readonly done | printf
+	grep done local 2>/dev/null echo
+		grep /usr/bin awk done
+-eu -eu sed "$@" echo done export
+	local grep --verbose x=1 echo cd "$1" export export awk -eu $(pwd) local "$1"
+${HOME} printf 2>/dev/null export && "$@" echo done test "$1"
+then done cd "$@" $(pwd) 'quoted text' cd cd "$@" | echo echo export 'quoted text'
+grep "$1" && local grep local then && --verbose
+		'quoted text' 'quoted text' readonly && | && --verbose -eu printf test | echo
+	&& -eu && echo export printf 'quoted text' 'quoted text'
+| -eu && /usr/bin | export
+awk ${HOME} && x=1 "$1" local cd 2>/dev/null
+		&& /usr/bin /usr/bin grep -eu printf export 'quoted text' grep -eu ${HOME}
+		&& then "$@" 'quoted text' local test ${HOME} 'quoted text'
+$(pwd) export "$@" awk "$@" printf sed "$1" 2>/dev/null done
+	2>/dev/null done "$@" test "$@"
+		cd --verbose test -eu --verbose test grep
+echo sed && --verbose echo $(pwd) local /usr/bin readonly "$1"
+	--verbose --verbose grep done local echo $(pwd) local readonly printf
+	then local cd then 2>/dev/null
+		then sed readonly readonly export 'quoted text' x=1 'quoted text' | export export
+	${HOME} echo $(pwd) 2>/dev/null | -eu then awk echo -eu x=1 local && -eu
+		cd then --verbose export then local 2>/dev/null "$1" printf
+--verbose --verbose readonly sed then echo x=1 awk x=1 && local
+		local echo test -eu | 2>/dev/null 'quoted text'
+"$1" printf export --verbose export export done
+readonly then 2>/dev/null readonly x=1 -eu local -eu --verbose $(pwd) ${HOME}
+	awk cd grep x=1 x=1 ${HOME} export
+	grep test $(pwd) grep | sed x=1 'quoted text' && ${HOME}
+		${HOME} awk && echo "$1"
+"$1" cd 'quoted text' x=1 && "$@" export 2>/dev/null "$1"
+"$1" "$@" ${HOME} printf export export x=1 local printf test "$@" export
+--verbose echo local echo test | test ${HOME} grep "$1" 2>/dev/null "$1" -eu --verbose
+	readonly /usr/bin cd test -eu sed /usr/bin cd grep --verbose
+		$(pwd) -eu 2>/dev/null test local export grep /usr/bin
+	awk readonly echo then printf export -eu --verbose sed --verbose
+	grep local sed done local
+	2>/dev/null export $(pwd) 2>/dev/null x=1 "$1"
+		export printf "$@" --verbose printf cd export export printf
+		x=1 then local x=1 x=1 "$@" --verbose $(pwd) readonly then done --verbose
+	then --verbose done test then done readonly
+	"$1" ${HOME} x=1 readonly && -eu "$@" test && | readonly ${HOME}
+	${HOME} readonly readonly && done sed grep export ${HOME} 'quoted text' test
+then printf -eu awk grep
+	--verbose "$@" 2>/dev/null x=1 x=1 -eu /usr/bin | local awk cd | 2>/dev/null
+	2>/dev/null -eu local export --verbose
+	local ${HOME} x=1 "$@" done
+	"$@" --verbose local /usr/bin --verbose --verbose --verbose
+		| -eu && export /usr/bin printf
+sed export x=1 then done "$@" --verbose -eu /usr/bin
+		done sed printf "$@" | && awk x=1 printf $(pwd) /usr/bin done then 'quoted text'
+		/usr/bin cd && ${HOME} x=1 | printf echo -eu then printf
+x=1 | 2>/dev/null echo x=1 sed | | 'quoted text' local local --verbose
+		"$@" grep 'quoted text' awk readonly echo echo cd
+awk done "$1" test x=1 -eu -eu
+	test "$1" | --verbose $(pwd) done export 'quoted text'
+	cd $(pwd) --verbose "$1" "$1" grep local
+-eu "$1" cd --verbose
+	'quoted text' --verbose --verbose test "$1" && cd 'quoted text'
+'quoted text' local $(pwd)
+		${HOME} local echo done export "$@" sed --verbose cd ${HOME} $(pwd)
+		$(pwd) 'quoted text' then | "$1" x=1 | "$1" -eu ${HOME} ${HOME}
+local x=1 readonly then --verbose ${HOME} then x=1
+	&& grep | --verbose test 2>/dev/null $(pwd) "$1"
+awk echo cd local && awk test && -eu printf cd cd /usr/bin
+echo cd then done && x=1 cd "$@" /usr/bin
+	done && ${HOME} export local "$@" done 2>/dev/null
+		| "$1" "$1" awk ${HOME} cd | grep x=1 then 'quoted text'
+	local x=1 awk "$1" sed && printf
+		--verbose $(pwd) && done
+		sed $(pwd) 'quoted text' "$1" cd 2>/dev/null
+	awk && then ${HOME} | then 2>/dev/null
+	-eu awk local 2>/dev/null
+	| cd $(pwd) $(pwd) | export done "$1" local "$@" local then local -eu grep
+	test local test "$1" echo readonly readonly export sed x=1 x=1 | then 2>/dev/null
+		-eu x=1 done 2>/dev/null local then sed grep /usr/bin && local then x=1 /usr/bin
+printf local --verbose --verbose --verbose sed -eu
+${HOME} echo -eu cd "$@" "$@" $(pwd) --verbose "$@"
+local readonly echo && grep readonly -eu "$@" readonly
+	x=1 $(pwd) x=1 cd then awk $(pwd) && test 2>/dev/null awk readonly
+		| "$1" readonly | --verbose awk --verbose
+		$(pwd) echo sed && "$@" local /usr/bin export grep export echo --verbose echo
+sed done 'quoted text' "$1" && test cd "$1" "$@" $(pwd)
+	export grep 2>/dev/null ${HOME} "$@" /usr/bin | --verbose
+	cd cd awk local x=1 && grep --verbose "$1" readonly --verbose
+		done | -eu 2>/dev/null
+then sed printf 2>/dev/null sed 'quoted text' -eu
+		export "$@" /usr/bin grep $(pwd) ${HOME} sed "$1" awk readonly /usr/bin
+echo printf && | echo local
+	test $(pwd) "$1" awk export "$1" readonly echo
+		${HOME} local --verbose ${HOME} sed printf local ${HOME} echo ${HOME} -eu
+	"$1" ${HOME} -eu test && done grep test "$@" 2>/dev/null
+		'quoted text' && grep "$1" "$@" --verbose readonly
+	--verbose --verbose -eu sed "$1" | export --verbose echo && done awk then grep cd
+		sed export --verbose readonly local && 2>/dev/null
+		$(pwd) done awk awk echo awk then
+	-eu "$@" | test then && then
+done /usr/bin printf /usr/bin 'quoted text' $(pwd) printf 2>/dev/null
+x=1 awk awk -eu local /usr/bin test grep 2>/dev/null
+		cd cd local 2>/dev/null "$1"
+		$(pwd) --verbose local | echo readonly "$1" export
+/usr/bin && 2>/dev/null then $(pwd) 'quoted text' readonly ${HOME}
+		awk "$1" cd | cd x=1 readonly test printf awk cd then sed ${HOME} export
+	&& echo x=1 "$1" local | awk | |
+	'quoted text' test local cd && cd && awk done
+done -eu | && export --verbose awk /usr/bin grep cd local "$1" echo
+	-eu x=1 $(pwd) then export
+	then cd local echo printf ${HOME}
+		echo && "$@" echo test awk ${HOME}
+then $(pwd) $(pwd) local local done echo export printf "$@"
+	--verbose 2>/dev/null $(pwd) then --verbose "$1" --verbose
+&& echo $(pwd) ${HOME} 2>/dev/null "$@" 'quoted text'
+"$@" done readonly awk sed && cd
+		"$@" cd local "$1" cd echo --verbose "$1" test | then printf echo /usr/bin grep
+awk test ${HOME} 'quoted text' printf echo awk readonly $(pwd)
+		then "$1" readonly echo ${HOME}
+printf grep export readonly local printf then sed local && printf awk 2>/dev/null
+		grep sed then printf awk --verbose cd awk echo
+		printf -eu export | 2>/dev/null echo awk echo x=1 test 2>/dev/null ${HOME}
+		'quoted text' $(pwd) | /usr/bin cd grep && 'quoted text' printf
+	${HOME} /usr/bin ${HOME} x=1 local $(pwd) --verbose test
+	printf then readonly echo grep
+	2>/dev/null readonly echo then "$@" ${HOME} | then /usr/bin echo
+		x=1 echo sed -eu "$1" && 'quoted text' then x=1
+	"$@" | /usr/bin "$1" && && ${HOME} /usr/bin -eu printf "$@" ${HOME} local awk
+	grep test local export "$@" 2>/dev/null
+	done --verbose test local local $(pwd) printf && then ${HOME} test awk --verbose
+		"$1" --verbose printf x=1 sed done grep export
+	cd awk printf test printf ${HOME} grep sed ${HOME} grep
+printf cd test 2>/dev/null 2>/dev/null "$1"
+done test then ${HOME} && "$@" sed printf then readonly "$@" -eu local echo
+	cd sed then awk /usr/bin "$1" awk printf cd awk done /usr/bin "$1" ${HOME} &&
+--verbose x=1 "$@" readonly --verbose $(pwd) export local readonly 2>/dev/null
+-eu 'quoted text' "$1" cd grep grep cd echo
+	'quoted text' "$@" grep sed x=1 "$@" ${HOME} "$1" ${HOME} cd local test ${HOME}
+	readonly | local -eu awk /usr/bin cd awk $(pwd) ${HOME} "$1" /usr/bin test $(pwd)
+		/usr/bin export echo local "$@" $(pwd) export
+		&& 2>/dev/null ${HOME} x=1 done "$@" $(pwd) "$1" | | readonly && && -eu | --verbose
+	echo awk "$@" ${HOME} then cd | test grep export cd ${HOME} x=1 export ${HOME}
+sed | grep done echo done local grep 'quoted text' echo
+	done printf ${HOME} | cd /usr/bin then
+		then "$@" done ${HOME} local $(pwd)
+	then sed /usr/bin grep /usr/bin then readonly 2>/dev/null &&
+"$1" 2>/dev/null "$@" x=1 readonly
+		echo printf --verbose 'quoted text' "$@" | test /usr/bin awk grep | --verbose
+		'quoted text' readonly readonly awk
+		'quoted text' 'quoted text' readonly x=1 && -eu test
+awk echo readonly printf export echo $(pwd) "$@" | echo local sed then test
+		2>/dev/null test test then 'quoted text' ${HOME} local $(pwd) done local
+	sed && grep "$@" /usr/bin
+2>/dev/null && awk $(pwd) ${HOME} local printf awk
+local test done sed x=1 -eu sed awk -eu sed ${HOME}
+--verbose test test cd 2>/dev/null 'quoted text'
+"$@" --verbose /usr/bin done done done export | "$@"
+	$(pwd) test "$@" "$@" "$@" 'quoted text'
+	"$1" --verbose export /usr/bin 2>/dev/null --verbose export
+		| && sed echo export local
+		grep readonly grep sed 2>/dev/null
+		&& then /usr/bin grep grep cd
+		echo awk readonly awk 2>/dev/null $(pwd) -eu /usr/bin x=1 "$1" x=1 /usr/bin
+${HOME} then done export
+${HOME} grep "$@" grep then -eu then local then "$1" 'quoted text'
+		grep && --verbose $(pwd) grep export ${HOME} "$@" "$1" done "$@" "$@" "$@" /usr/bin
+		done "$@" $(pwd) local "$@" test cd x=1 $(pwd)
+"$@" done --verbose test readonly test sed
+| && awk 2>/dev/null readonly printf printf ${HOME} test x=1 -eu
+		"$1" "$1" sed && grep "$1" done "$1" -eu local
+	echo sed awk test | printf | cd local
+--verbose 2>/dev/null readonly done 2>/dev/null
+"$1" printf cd echo ${HOME} "$1" export
+	2>/dev/null -eu /usr/bin --verbose awk x=1 $(pwd) grep
+	-eu /usr/bin | grep | awk
+		sed /usr/bin /usr/bin | done readonly then /usr/bin && 2>/dev/null 2>/dev/null
+		echo grep done --verbose local done "$1" -eu printf && test &&
+done test 'quoted text' readonly && "$1" cd echo then test --verbose | printf
+		echo test grep x=1 && ${HOME} readonly "$1" $(pwd)
+cd "$@" test then | /usr/bin | ${HOME}
+-eu 'quoted text' test export x=1 cd awk sed then --verbose
+		printf $(pwd) | 'quoted text' x=1 2>/dev/null
+		'quoted text' readonly | 2>/dev/null readonly x=1 --verbose 2>/dev/null
+	--verbose 2>/dev/null done
+| /usr/bin ${HOME} && 'quoted text' "$@" echo && export
+	--verbose readonly | readonly export echo --verbose x=1 done 2>/dev/null then
+	awk then readonly 'quoted text' "$1" echo printf
+"$1" test export cd -eu awk local 2>/dev/null x=1 2>/dev/null "$1" 2>/dev/null
+		${HOME} $(pwd) done /usr/bin cd --verbose
+	test ${HOME} /usr/bin test "$1" local -eu 'quoted text' export "$1" cd
+		'quoted text' sed 2>/dev/null grep /usr/bin
+printf printf grep /usr/bin then
+printf /usr/bin --verbose x=1 awk echo 2>/dev/null 2>/dev/null $(pwd) 2>/dev/null
+echo 'quoted text' --verbose readonly printf "$1" $(pwd)
+	local "$1" grep | local awk "$@" then | x=1 cd 2>/dev/null
+	x=1 export cd x=1 $(pwd) --verbose cd
+		x=1 $(pwd) cd && test cd --verbose && local then 'quoted text' done echo 'quoted text'
+then x=1 && readonly grep done 2>/dev/null awk $(pwd) then && |
+--verbose local awk local x=1 printf | "$1" then 2>/dev/null
+		done cd awk /usr/bin grep readonly $(pwd) /usr/bin test --verbose cd x=1
+		| /usr/bin echo echo --verbose awk "$1" 'quoted text' /usr/bin ${HOME} done
+	--verbose "$1" --verbose
+export echo test --verbose -eu export "$@" local test test sed echo
+'quoted text' printf export --verbose -eu readonly readonly --verbose
+	--verbose then x=1 done cd && test cd sed echo local "$1" $(pwd) /usr/bin 2>/dev/null
+		echo readonly grep export grep printf
+	--verbose local "$1" test done sed export ${HOME} && test echo done awk "$@"
+echo ${HOME} 'quoted text' sed && local echo export cd grep sed done cd
+		local cd | /usr/bin 'quoted text' local done $(pwd) echo
+		2>/dev/null "$1" 2>/dev/null ${HOME}
+$(pwd) sed printf echo | awk readonly x=1
+readonly readonly cd x=1 done grep readonly
+-eu done 2>/dev/null done awk ${HOME} 2>/dev/null readonly
+	sed --verbose --verbose ${HOME} sed then ${HOME} cd
+readonly export "$1" sed /usr/bin $(pwd) && /usr/bin
+		--verbose then 'quoted text' cd readonly 'quoted text' "$1"
+	$(pwd) -eu readonly awk x=1 local done ${HOME} readonly --verbose done sed export
+	"$@" test done export
+	sed ${HOME} export awk 2>/dev/null export
+	--verbose --verbose && | readonly "$1" -eu $(pwd)
+	x=1 export ${HOME} grep sed --verbose -eu
+/usr/bin ${HOME} printf done grep $(pwd) local readonly ${HOME} cd
+'quoted text' --verbose awk 2>/dev/null -eu grep ${HOME}
+	readonly awk /usr/bin 2>/dev/null local 'quoted text' test ${HOME}
+	"$1" awk /usr/bin "$1" --verbose -eu export
+	readonly sed ${HOME} export 'quoted text' && x=1 ${HOME}
+		${HOME} "$1" | ${HOME} x=1 2>/dev/null printf 2>/dev/null "$@" 2>/dev/null
+		"$@" ${HOME} echo local /usr/bin && 'quoted text'
+		printf awk x=1 then -eu && export
+	'quoted text' printf grep
+	"$@" then readonly printf | echo -eu | export test 'quoted text' -eu grep
+		sed printf echo local ${HOME}
+		export | then awk -eu x=1 /usr/bin
+then then -eu 'quoted text' awk --verbose cd ${HOME} grep 'quoted text'
+		/usr/bin -eu "$@" $(pwd) export done cd /usr/bin
+	then local local sed 2>/dev/null $(pwd) awk then echo grep export $(pwd) x=1
+"$@" "$@" local /usr/bin /usr/bin x=1 "$@" echo
+	printf awk echo then cd grep 2>/dev/null cd test sed
+		printf echo test test "$1"
+		| test /usr/bin /usr/bin "$1" test "$1" 2>/dev/null && -eu 'quoted text'
+	readonly export "$@" export &&
+	${HOME} --verbose $(pwd) then echo | test 'quoted text' printf
+		x=1 sed && echo awk 'quoted text' -eu "$@" /usr/bin
+	'quoted text' --verbose sed then export 2>/dev/null "$@" grep
+	sed -eu ${HOME} export 2>/dev/null "$@" ${HOME}
+		/usr/bin readonly export $(pwd) done grep | printf export
+export | awk done "$@" -eu printf x=1 echo echo awk sed x=1 ${HOME} --verbose
+done done "$1" readonly /usr/bin grep test
+	readonly ${HOME} local
+awk --verbose && grep ${HOME} "$1" cd x=1 --verbose then "$1" $(pwd) 'quoted text'
+		readonly 2>/dev/null "$@" --verbose --verbose "$1" "$1" sed
+readonly awk export && "$1" sed export $(pwd) local local | x=1 && $(pwd)
+$(pwd) -eu sed local sed echo ${HOME} sed "$@" "$@" printf --verbose && &&
+	grep && sed awk done 2>/dev/null x=1 done cd x=1 | sed | readonly awk
+		grep 2>/dev/null printf local printf grep ${HOME} && && echo grep "$@" grep
+	awk then $(pwd) 2>/dev/null 'quoted text' 2>/dev/null
+	test grep printf $(pwd) 2>/dev/null ${HOME} && sed ${HOME}
+		test $(pwd) "$@" "$@" ${HOME} then
+echo cd /usr/bin awk sed local done readonly
+	/usr/bin ${HOME} -eu x=1 "$@" local
+--verbose echo --verbose | && $(pwd)
+	echo $(pwd) printf | grep x=1 local export done test test printf
+		/usr/bin awk then 2>/dev/null grep sed readonly
+		| | | $(pwd) sed ${HOME} local "$@" | ${HOME}
+	export 2>/dev/null then ${HOME} $(pwd) echo awk local | printf 2>/dev/null
+sed x=1 "$1" printf export
+/usr/bin grep /usr/bin readonly grep && | export export $(pwd) then then $(pwd)
+		test -eu awk --verbose readonly "$1" /usr/bin test cd printf test 'quoted text'
+	/usr/bin done then printf | | echo sed export test && $(pwd) | && export /usr/bin
+		$(pwd) --verbose cd echo $(pwd) ${HOME} /usr/bin readonly $(pwd) export then done
+sed ${HOME} $(pwd) awk "$@" x=1 | "$@" then
+then "$1" cd awk readonly
+		readonly done readonly test then grep grep done "$1" x=1 printf -eu $(pwd) --verbose
+		x=1 'quoted text' export test awk -eu local grep 2>/dev/null "$1" $(pwd)
+	-eu readonly | x=1 'quoted text'
+sed $(pwd) printf readonly /usr/bin cd then export export printf "$1" local readonly
+		done x=1 export readonly x=1 x=1 awk --verbose
+"$1" 2>/dev/null local "$1" then test ${HOME} awk "$1" test cd echo --verbose test
+		grep printf -eu export cd --verbose "$@" then printf "$@" awk "$1" cd --verbose
+	'quoted text' test && ${HOME} echo --verbose x=1 -eu
+${HOME} && readonly printf ${HOME} | echo test
+export test readonly x=1 then cd
+		test grep && /usr/bin -eu
+done sed echo cd 'quoted text' && awk
+printf $(pwd) export cd echo /usr/bin ${HOME}
+grep grep readonly sed
+		"$1" echo "$1" | "$@" printf | -eu done done "$1" printf
+		"$@" local awk test grep | grep printf cd cd readonly "$1" readonly | local
+		"$@" 2>/dev/null /usr/bin echo ${HOME} && echo -eu /usr/bin -eu
+		--verbose 'quoted text' echo --verbose "$1" --verbose
+	2>/dev/null awk echo sed "$@" printf
+	awk cd echo "$@" ${HOME} "$@" printf 2>/dev/null
+	local local -eu test cd
+	/usr/bin echo readonly 2>/dev/null
+echo done "$@" printf then ${HOME} --verbose
+	readonly -eu cd grep | local --verbose 2>/dev/null readonly
+| grep sed local | export readonly local done test then &&
+	$(pwd) 2>/dev/null "$@" /usr/bin x=1 -eu --verbose
+	cd done "$1" 2>/dev/null sed sed then ${HOME} readonly /usr/bin ${HOME} "$@"
+	done sed && "$1" ${HOME} $(pwd) "$1" awk printf done /usr/bin
+x=1 "$@" $(pwd) done local printf -eu test cd awk && printf export
+2>/dev/null echo | 2>/dev/null done $(pwd)
+$(pwd) x=1 -eu test echo cd ${HOME} done && cd grep
+'quoted text' 2>/dev/null echo printf
+--verbose $(pwd) cd printf sed test | export sed
+		done local 2>/dev/null test local ${HOME} --verbose printf awk 'quoted text' awk
+	x=1 -eu 'quoted text' "$1" cd ${HOME} sed export && echo "$@"
+		test /usr/bin sed | done local then x=1 'quoted text' printf
+		readonly 'quoted text' $(pwd) test export 2>/dev/null
+		| printf /usr/bin local 'quoted text' echo
+/usr/bin "$1" printf x=1 --verbose --verbose /usr/bin grep echo done
+		--verbose 'quoted text' /usr/bin $(pwd) ${HOME} && then test
+	x=1 ${HOME} x=1 $(pwd) test "$1" --verbose -eu "$1" readonly cd &&
+		'quoted text' ${HOME} local local grep "$@" ${HOME} 'quoted text' --verbose
+		$(pwd) -eu sed printf x=1 awk 2>/dev/null
+	/usr/bin 'quoted text' "$@" export grep 2>/dev/null "$1" grep
+	2>/dev/null echo --verbose 'quoted text'
+then -eu export 'quoted text' done --verbose cd -eu ${HOME} "$@"
+		"$1" awk grep readonly printf "$1" then -eu test echo
+2>/dev/null | local ${HOME} done -eu && | awk sed x=1 "$@" ${HOME} sed "$1" then
+		&& test local -eu echo -eu printf --verbose awk test && /usr/bin awk 'quoted text'
+	2>/dev/null ${HOME} && done then 'quoted text'
+		awk x=1 2>/dev/null --verbose
+sed -eu $(pwd) 'quoted text' printf "$1" 2>/dev/null
+"$@" export export sed
+		"$1" echo && | --verbose 2>/dev/null && -eu $(pwd)
+	x=1 x=1 x=1 /usr/bin x=1 local local test done -eu echo 'quoted text'
+	'quoted text' /usr/bin 2>/dev/null
+		done readonly export "$1" 'quoted text'
+		x=1 && test grep $(pwd) readonly done x=1 sed
+		sed printf local x=1 export | export cd && sed 2>/dev/null echo 2>/dev/null
+	-eu export 'quoted text' then /usr/bin cd 2>/dev/null
+		/usr/bin then /usr/bin echo -eu --verbose then ${HOME}
+		x=1 local | cd cd 2>/dev/null "$1" "$@" ${HOME}
+		cd | printf awk grep x=1 2>/dev/null
+		x=1 cd echo done export | /usr/bin
+	"$@" local printf awk | "$@" | /usr/bin export printf echo
+2>/dev/null grep 2>/dev/null done $(pwd) ${HOME} "$1" echo | | --verbose
+		x=1 export sed "$1" "$@" "$@" readonly 'quoted text' |
+grep /usr/bin x=1 awk local
+${HOME} 2>/dev/null awk "$1" --verbose
+"$1" local $(pwd) $(pwd) "$@" x=1 && cd "$1" sed --verbose
+sed x=1 2>/dev/null grep
+		${HOME} then sed export /usr/bin grep then "$@" 2>/dev/null && readonly
+	readonly sed awk done printf
+		local test local readonly done done export
+		| ${HOME} printf then 2>/dev/null /usr/bin local then "$@"
+		--verbose local $(pwd) x=1 2>/dev/null
+2>/dev/null done "$1" export cd "$1" $(pwd) awk 'quoted text' test done 2>/dev/null
+	"$1" $(pwd) --verbose --verbose 'quoted text' /usr/bin "$@"
+		test done export local export sed awk $(pwd) && 'quoted text'
+		echo $(pwd) echo x=1 export cd 2>/dev/null -eu
+	cd -eu done ${HOME} cd awk export
+$(pwd) -eu export 'quoted text' -eu readonly ${HOME} 'quoted text'
+	awk /usr/bin && test && local && export /usr/bin
+then echo x=1 | --verbose export x=1 "$1" done "$@"
+cd 2>/dev/null readonly printf "$@" readonly | --verbose $(pwd) echo awk local
+grep test /usr/bin echo
+	done test grep x=1 /usr/bin echo
+	sed | --verbose done local "$@" export then /usr/bin test awk cd
+		${HOME} && | printf printf local x=1 readonly local --verbose
+		/usr/bin awk done x=1 $(pwd)
+	$(pwd) /usr/bin $(pwd) done --verbose 2>/dev/null
+		then then then local readonly /usr/bin done && cd readonly
+		local echo done 'quoted text' && "$@" sed | 2>/dev/null -eu grep
+	readonly printf then -eu sed -eu "$1" export test | "$1" test sed /usr/bin "$@"
+-eu sed /usr/bin ${HOME}
+		$(pwd) /usr/bin "$1" 2>/dev/null
+		then local 'quoted text' $(pwd)
+	cd "$@" x=1 cd readonly grep && export "$@" "$1" 2>/dev/null
+	"$1" echo export echo done "$1" readonly export && readonly
+		awk sed test && then --verbose then | --verbose
+		cd --verbose printf | cd x=1 ${HOME} "$1" sed /usr/bin
+	then awk then test echo local 2>/dev/null "$@" $(pwd) "$1" local /usr/bin
+		"$@" "$1" "$@" export
+	local awk 2>/dev/null 2>/dev/null sed readonly readonly
+		--verbose echo echo && printf "$1" grep awk readonly 2>/dev/null ${HOME} grep
+		then printf export | cd printf printf test printf 'quoted text' -eu
+	x=1 cd $(pwd) then x=1 cd export $(pwd) export readonly test
+	local echo then done done | ${HOME} sed -eu local && /usr/bin x=1 awk
+	echo done /usr/bin test | $(pwd) then "$1" "$1" sed
+sed && export "$1" "$1" readonly
+cd --verbose /usr/bin then readonly x=1 "$@" printf | "$1"
+local && printf then export x=1 ${HOME} cd --verbose
+		${HOME} test 'quoted text' x=1 then local 'quoted text'
+grep cd "$@" echo 'quoted text' 'quoted text' /usr/bin "$1" echo |
+-eu ${HOME} | awk echo export
+${HOME} ${HOME} | printf awk && grep test && && awk -eu test
+then --verbose && local 'quoted text' awk -eu x=1
+	readonly x=1 | local -eu done
+	"$1" export echo ${HOME} "$@" awk
+${HOME} | echo $(pwd) sed awk -eu
+done && then /usr/bin awk ${HOME} local done awk then grep 'quoted text'
+		x=1 | -eu export sed -eu
+grep && /usr/bin 2>/dev/null 'quoted text' sed done echo readonly readonly
+		export grep readonly $(pwd) local /usr/bin | echo -eu x=1 && printf
+--verbose /usr/bin x=1 grep awk sed | sed x=1 /usr/bin
+	-eu | awk readonly "$1" export --verbose
+$(pwd) /usr/bin local && "$1" printf
+		| 2>/dev/null && /usr/bin "$1"
+	then readonly grep export $(pwd) --verbose grep "$1" awk $(pwd) "$@" /usr/bin
+		printf readonly sed "$@" && printf "$@" $(pwd) echo "$@" printf then -eu
+	local 'quoted text' x=1 x=1 readonly "$@" -eu cd done | echo local
+		&& local -eu printf $(pwd) "$@" readonly local sed 2>/dev/null export test local
+	grep -eu grep test printf readonly | --verbose grep ${HOME} echo
+	readonly done x=1 2>/dev/null awk
+	readonly "$@" echo export
+		local awk -eu 2>/dev/null x=1 | x=1 /usr/bin then readonly
+cd -eu && done done /usr/bin /usr/bin echo printf awk x=1 printf test --verbose
+echo $(pwd) 'quoted text'
+		| /usr/bin "$1" x=1 /usr/bin "$1" readonly
+	grep printf grep then x=1 then readonly grep
+readonly $(pwd) "$1" grep x=1 "$1" test local 2>/dev/null awk $(pwd) 'quoted text'
+echo 2>/dev/null local -eu echo "$1" local &&
+	awk "$@" sed x=1 then "$@" && awk done
+		export readonly export 'quoted text' test local export done $(pwd) readonly
+	readonly export awk 2>/dev/null then local test
+	&& "$@" ${HOME} /usr/bin export "$1"
+2>/dev/null printf cd | awk then "$1" 'quoted text' x=1 | echo export
+		then 2>/dev/null "$1" local | 'quoted text'
+'quoted text' grep $(pwd) done --verbose grep printf cd cd
+		${HOME} --verbose x=1 done "$@" awk then "$@" export "$@" --verbose --verbose
+	done -eu done -eu local 'quoted text' grep test done && echo cd readonly awk printf
+--verbose echo cd "$@" 'quoted text' /usr/bin test done "$1" 'quoted text' "$@"
+printf $(pwd) test local done then && cd
+test 'quoted text' echo test echo test echo -eu "$1" readonly awk
+		-eu /usr/bin -eu "$@" "$@" sed
+	cd readonly "$@" local cd done && printf x=1 grep
+	done $(pwd) grep "$@" sed readonly done sed readonly local |
+		printf done sed test | grep -eu && 'quoted text' awk local
+'quoted text' grep awk echo "$@" echo export --verbose x=1 2>/dev/null
+	"$@" export 'quoted text' test sed ${HOME} cd echo cd done
+	${HOME} /usr/bin x=1 cd echo /usr/bin x=1 'quoted text'
+	sed -eu | export sed -eu cd --verbose
+	'quoted text' done cd local awk /usr/bin local $(pwd) done && test readonly
+		printf export /usr/bin "$@" ${HOME} 'quoted text' /usr/bin
+		$(pwd) printf readonly echo && -eu "$1" test
+		awk && "$@" awk readonly --verbose --verbose -eu sed x=1 grep
+	'quoted text' 2>/dev/null cd x=1 done done $(pwd) && | /usr/bin
+	${HOME} readonly && -eu then | then && printf test
+		cd awk done local printf x=1 test && --verbose awk "$1" ${HOME}
+cd && /usr/bin | 'quoted text' x=1 && x=1 then 'quoted text' awk awk
+awk 'quoted text' then x=1 cd
+"$1" cd x=1 $(pwd) sed test
+--verbose 2>/dev/null -eu "$1" then printf export -eu
+	printf $(pwd) test readonly 'quoted text'
+"$1" readonly readonly done echo && ${HOME} readonly
+		done done /usr/bin | 'quoted text' grep $(pwd) local
+	'quoted text' ${HOME} $(pwd) cd then 'quoted text' x=1 then sed test |
+"$@" export then "$@" printf "$1" echo awk export echo /usr/bin 2>/dev/null
+	"$@" local 2>/dev/null printf
+| | echo printf x=1 test then $(pwd) export
+then && -eu grep $(pwd) "$1" then "$1" 'quoted text' local done then -eu readonly
+printf "$1" awk 'quoted text' --verbose ${HOME} done
+		${HOME} cd 'quoted text'
+2>/dev/null cd awk 'quoted text'
+export 'quoted text' 2>/dev/null x=1 readonly x=1
+readonly && | x=1 && --verbose "$@" "$1" /usr/bin
+echo printf grep "$@" $(pwd) /usr/bin ${HOME} echo
+grep test --verbose x=1 /usr/bin echo -eu | "$@" 2>/dev/null | --verbose x=1
+		${HOME} "$1" echo /usr/bin awk "$@" awk then local $(pwd) echo
+	done 2>/dev/null printf 'quoted text' done readonly test 'quoted text'
+printf /usr/bin $(pwd) echo grep x=1 done grep echo echo "$@"
+2>/dev/null ${HOME} |
+	readonly cd echo --verbose "$1" test
+	2>/dev/null grep $(pwd) /usr/bin 2>/dev/null 'quoted text'
+then printf sed "$@" test cd sed test
+| && local printf grep | $(pwd) test x=1 echo awk cd "$1"
+		printf $(pwd) /usr/bin done 2>/dev/null test && then printf /usr/bin export readonly
+	-eu export done x=1 grep 'quoted text' grep "$@" local
+		"$@" 2>/dev/null && 'quoted text' sed test sed test
+	'quoted text' sed printf "$1" x=1 grep
+"$@" -eu then "$@" test echo
+	${HOME} then test then sed --verbose
+		${HOME} sed $(pwd) x=1 done sed "$1" then
+		done 'quoted text' printf $(pwd)
+'quoted text' ${HOME} 'quoted text' -eu /usr/bin readonly done export
+	done 2>/dev/null --verbose sed /usr/bin awk "$1" test sed
+		$(pwd) printf --verbose export
+	-eu sed $(pwd) x=1 awk readonly "$@" then $(pwd) && readonly done local
+	then grep grep -eu printf
+	then awk 'quoted text' | export done test then 2>/dev/null done 2>/dev/null
+${HOME} /usr/bin readonly local -eu export grep
+sed 2>/dev/null "$@" --verbose export then export /usr/bin
+		"$1" ${HOME} sed x=1 done printf -eu then done -eu "$1" done printf
+		export 'quoted text' | grep && export /usr/bin
+		export awk grep --verbose -eu x=1 -eu -eu /usr/bin grep sed
+		grep $(pwd) "$@" 'quoted text' then 'quoted text' grep export "$1" -eu |
+sed readonly test done $(pwd) x=1 | sed 'quoted text' export "$1"
+		done awk local 2>/dev/null cd 'quoted text'
+		awk "$1" $(pwd) $(pwd) 'quoted text' 'quoted text' $(pwd) printf --verbose local
+x=1 then readonly && && then local
+	local ${HOME} grep echo grep /usr/bin sed ${HOME} --verbose printf --verbose readonly
+	readonly && 'quoted text'
+local 'quoted text' -eu readonly --verbose grep 2>/dev/null 2>/dev/null
+		"$1" 'quoted text' awk | then echo sed
+| 'quoted text' $(pwd) test export
+		$(pwd) | -eu -eu $(pwd) test "$@" -eu 2>/dev/null local && "$@" && printf
+	local "$@" 'quoted text' echo printf awk 'quoted text'
+		printf "$1" && sed 'quoted text' sed "$@" /usr/bin
+		&& done then test export done done
+test && --verbose done ${HOME}
+2>/dev/null && readonly local then --verbose 'quoted text' done
+		cd local $(pwd) then 'quoted text' -eu 2>/dev/null && -eu
+	sed done done -eu done "$@" --verbose done "$@" readonly
+		"$@" export test test sed ${HOME} 2>/dev/null --verbose test test $(pwd)
+	-eu "$1" test 2>/dev/null /usr/bin "$@" 'quoted text' $(pwd)
+'quoted text' echo test cd test 2>/dev/null
+	2>/dev/null --verbose 2>/dev/null
+readonly 2>/dev/null x=1 echo $(pwd)
+awk "$1" local cd local "$1"
+${HOME} "$1" "$1" local x=1 x=1 export local ${HOME} && readonly
+done local x=1 $(pwd) --verbose /usr/bin local "$@"
+		awk then readonly local awk ${HOME}
+		/usr/bin then test export readonly
+"$1" ${HOME} ${HOME} done export $(pwd) $(pwd) ${HOME} echo 2>/dev/null
+		| --verbose cd awk 2>/dev/null | | local then --verbose
+	${HOME} /usr/bin x=1 -eu -eu "$@" --verbose && ${HOME} $(pwd)
+${HOME} awk sed --verbose
+"$@" cd local ${HOME} awk 'quoted text' |
+	--verbose "$1" done "$1" then x=1 export
+done 2>/dev/null readonly /usr/bin
+	sed 'quoted text' -eu "$@" --verbose | x=1 awk printf && sed | done "$@"
+	"$1" done printf grep local readonly grep printf local ${HOME} echo -eu test
+	'quoted text' then ${HOME} export && "$@" cd export && test printf echo cd cd
+readonly test $(pwd) /usr/bin "$@" | "$@" "$1" sed
+| sed | awk 'quoted text'
+	&& printf "$1" test local export -eu test $(pwd) readonly
+	awk ${HOME} x=1 && 'quoted text'
+x=1 --verbose echo x=1
+		grep test "$@" -eu awk
+printf "$@" grep printf readonly 2>/dev/null 'quoted text'
+	"$@" ${HOME} then local done awk echo /usr/bin local "$@" grep ${HOME}
+grep sed local echo grep $(pwd) $(pwd) --verbose 2>/dev/null
+	&& printf export --verbose --verbose | sed export
+&& cd --verbose /usr/bin ${HOME} done export ${HOME} && | printf -eu /usr/bin
+"$1" then sed "$1" done export done --verbose /usr/bin cd /usr/bin sed && grep echo
+	--verbose printf then 'quoted text' test
+&& "$1" local x=1 "$@" "$1" local
+	2>/dev/null printf then readonly cd test
+		local echo readonly "$1" local readonly
+$(pwd) -eu /usr/bin && export sed local readonly
+grep x=1 echo --verbose awk $(pwd) && x=1 echo then /usr/bin
+${HOME} export "$@" readonly done ${HOME} echo --verbose readonly cd 'quoted text'
+'quoted text' grep test && done /usr/bin $(pwd) test "$1" 2>/dev/null 'quoted text'
+		-eu && x=1 ${HOME} -eu $(pwd) then $(pwd) /usr/bin 2>/dev/null ${HOME} --verbose
+readonly cd export cd ${HOME} ${HOME} sed 2>/dev/null
+"$@" local | done sed grep /usr/bin
+2>/dev/null then "$@" printf x=1 test cd
+test local sed 2>/dev/null export
+	/usr/bin grep awk local /usr/bin printf "$1" --verbose |
+		2>/dev/null "$@" done && "$@" ${HOME} /usr/bin then "$@" ${HOME}
+"$1" ${HOME} ${HOME} --verbose ${HOME} ${HOME} readonly
+2>/dev/null /usr/bin readonly | grep ${HOME}
+then --verbose local export cd printf /usr/bin grep $(pwd) "$@" --verbose x=1 cd
+done readonly "$1" done ${HOME} $(pwd)
+sed local printf | echo local test -eu
+-eu echo awk "$1" cd "$@"
+export test "$@" --verbose test 'quoted text' then /usr/bin
+'quoted text' grep export /usr/bin grep done local
+readonly printf x=1 /usr/bin echo readonly test --verbose && 'quoted text'
+awk "$1" ${HOME} && -eu &&
+awk "$@" 'quoted text' $(pwd) local --verbose
+		then $(pwd) ${HOME} -eu
+		"$@" /usr/bin x=1 printf test done | ${HOME} cd "$@" awk sed --verbose local
+local 'quoted text' 2>/dev/null
+	cd /usr/bin "$1" sed echo x=1 printf $(pwd) local
+		"$@" test "$@" then | 2>/dev/null export 'quoted text'
+		"$@" | && sed /usr/bin done echo x=1 $(pwd)
+--verbose $(pwd) export cd export local printf done sed x=1 printf sed
+/usr/bin done /usr/bin
+readonly && awk x=1 2>/dev/null cd readonly 2>/dev/null
+'quoted text' test | awk printf then |
+		--verbose sed 2>/dev/null /usr/bin
+	/usr/bin awk export /usr/bin $(pwd) export && done | 'quoted text' | 2>/dev/null
+	local awk local local 'quoted text' done 'quoted text'
+	'quoted text' then echo sed echo readonly "$@" readonly && test awk |
+	x=1 echo 2>/dev/null && local "$@" awk "$@" then grep
+printf test test $(pwd) ${HOME} then && printf $(pwd) $(pwd)
+	sed --verbose awk echo -eu readonly export cd export 'quoted text' awk --verbose
+grep $(pwd) local $(pwd) printf done x=1 test x=1 local
+		local "$1" ${HOME} x=1 cd && "$@" x=1 printf
+local 2>/dev/null --verbose | /usr/bin readonly -eu /usr/bin x=1
+		&& cd awk && -eu | sed 'quoted text' test --verbose cd export | "$@" ${HOME} then
+	echo -eu then "$@" /usr/bin
+	readonly readonly grep test cd x=1 'quoted text' export 'quoted text' | $(pwd)
+	local printf /usr/bin then local cd printf x=1 awk x=1 "$@" 2>/dev/null
+echo cd done && -eu ${HOME} printf 'quoted text' && local
+'quoted text' ${HOME} printf then |
+local --verbose 'quoted text' grep then cd
+	'quoted text' x=1 "$@" |
+	readonly echo | && ${HOME}
+	${HOME} | sed "$@" echo && ${HOME} | echo done 2>/dev/null
+		--verbose | -eu local cd $(pwd) grep
+		| "$1" 'quoted text' echo -eu test --verbose -eu grep readonly
+		grep --verbose 2>/dev/null $(pwd) awk done grep /usr/bin then | "$@" /usr/bin -eu
+		grep printf then grep awk done echo | export
+	printf grep 'quoted text' "$1" ${HOME} | test | local | 2>/dev/null sed -eu
+sed x=1 | test echo | ${HOME} then "$@" && "$@" "$1" test /usr/bin && &&
+	local done ${HOME} ${HOME} | cd local cd $(pwd) ${HOME} sed "$@"
+then awk 2>/dev/null awk
+	2>/dev/null export then grep done "$@" awk ${HOME} awk sed done "$@" $(pwd)
+--verbose awk | ${HOME} export then readonly | export "$@" $(pwd) awk ${HOME} 2>/dev/null
+"$1" "$@" 'quoted text' printf --verbose "$@" x=1 printf
+		sed $(pwd) "$1" printf 'quoted text'
+		2>/dev/null export printf export cd "$1" $(pwd)
+		--verbose --verbose cd local readonly sed done printf grep 'quoted text'
+		awk done export export cd export then echo readonly readonly
+	/usr/bin awk && awk test printf printf local printf /usr/bin then 2>/dev/null
+--verbose $(pwd) done sed
+$(pwd) printf $(pwd) 2>/dev/null sed echo && then awk local "$1" sed done $(pwd)
+	echo | grep sed /usr/bin x=1 'quoted text' x=1 && test
+		| 'quoted text' && "$1" /usr/bin /usr/bin then awk ${HOME} | export test
+	'quoted text' awk /usr/bin -eu done x=1 | done 'quoted text'
+'quoted text' && export
+export readonly grep printf x=1 /usr/bin
+"$1" 'quoted text' 'quoted text'
+echo "$1" awk printf export awk && export grep "$@" awk sed ${HOME} export
+		grep grep ${HOME} x=1 test 2>/dev/null sed | printf local grep
+	cd readonly "$1" done local | local export readonly -eu readonly /usr/bin
+readonly ${HOME} sed "$@" sed awk ${HOME} export ${HOME} local
+	echo local export /usr/bin "$@" $(pwd) -eu echo local export grep | 'quoted text'
+	x=1 2>/dev/null grep /usr/bin &&
+		&& "$1" local readonly -eu local $(pwd) 'quoted text' |
+export x=1 readonly grep awk awk done local 'quoted text'
+'quoted text' "$@" --verbose then grep
+	$(pwd) local "$@" then echo 'quoted text'
+		awk export 2>/dev/null | done test "$1" $(pwd) then cd /usr/bin readonly
+"$@" /usr/bin export done |
+		--verbose echo local --verbose
+awk && grep ${HOME} echo -eu --verbose /usr/bin local test 'quoted text'
+		test readonly "$1" x=1 && $(pwd) export
+		then x=1 then x=1 export readonly
+'quoted text' readonly /usr/bin export --verbose
+		done local 'quoted text' readonly
+	"$1" cd export "$1" ${HOME} awk "$1" done awk /usr/bin -eu 2>/dev/null printf
+	--verbose --verbose awk /usr/bin "$1" echo ${HOME} /usr/bin
+awk then sed done /usr/bin 2>/dev/null $(pwd) /usr/bin $(pwd) ${HOME} readonly
+		local local printf local 2>/dev/null 2>/dev/null --verbose /usr/bin --verbose
+${HOME} 'quoted text' x=1 2>/dev/null printf -eu $(pwd) 2>/dev/null
+readonly done | && sed 'quoted text' $(pwd) local done echo test /usr/bin printf
+		-eu 2>/dev/null x=1 then grep
+		export echo grep x=1 ${HOME} "$1" x=1 ${HOME} awk grep then -eu readonly "$1"
+	sed printf awk ${HOME} --verbose readonly local grep readonly
+	done awk "$@" then /usr/bin export "$@" 2>/dev/null /usr/bin
+"$1" --verbose | export 2>/dev/null done then && --verbose --verbose
+		-eu --verbose then "$@" $(pwd) done -eu "$@" cd test x=1 then --verbose
+		export grep export && --verbose
+sed readonly done test
+		sed $(pwd) "$@" --verbose then then readonly $(pwd) &&
+-eu echo "$@" ${HOME} local "$1" grep $(pwd) test
+	| awk $(pwd) "$@" echo grep then /usr/bin printf printf
+		printf cd export "$1" ${HOME} 2>/dev/null &&
+		export echo 2>/dev/null $(pwd) "$1" /usr/bin 2>/dev/null ${HOME}
+local readonly export echo grep echo grep test local test x=1
+	local local awk $(pwd) local echo sed
+		/usr/bin then -eu && 2>/dev/null ${HOME} x=1 test grep 2>/dev/null sed
+		export | readonly readonly $(pwd) 2>/dev/null "$@" done then sed grep
+	local 2>/dev/null && sed --verbose "$1" echo grep cd readonly then 'quoted text'
+	&& test export ${HOME} printf
+		/usr/bin sed done "$1" cd
+--verbose --verbose && printf 2>/dev/null awk test then "$@" && --verbose
+	"$1" readonly "$@" x=1 echo test -eu && export --verbose x=1 cd
+	-eu ${HOME} -eu then readonly
+		| "$1" then test "$1" $(pwd) grep 2>/dev/null x=1 then awk
+readonly $(pwd) readonly awk $(pwd) then done ${HOME} awk printf ${HOME}
+	2>/dev/null --verbose &&
+export x=1 printf grep 'quoted text' grep $(pwd) awk
+		awk sed 2>/dev/null test local sed | /usr/bin cd printf 'quoted text' "$1"
+	cd ${HOME} grep "$1" grep x=1 -eu readonly && awk sed /usr/bin echo "$@"
+	x=1 /usr/bin cd --verbose
+		awk done -eu readonly "$1" "$1" "$1" grep "$1" awk &&
+	test 2>/dev/null then && test local grep $(pwd) done | sed awk 'quoted text' 2>/dev/null
+x=1 test sed printf cd sed echo 'quoted text' /usr/bin && 'quoted text' grep local
+		then readonly then printf sed local $(pwd) x=1 then /usr/bin
+		| readonly "$@" 'quoted text' /usr/bin echo awk echo x=1 readonly $(pwd) awk done
+${HOME} echo /usr/bin readonly
+readonly then /usr/bin echo sed ${HOME} ${HOME} -eu |
+	then test --verbose sed echo awk printf /usr/bin printf && then x=1
+	${HOME} readonly && test test --verbose grep grep readonly local
+		test $(pwd) && then readonly 2>/dev/null
+		sed done /usr/bin x=1
+	cd $(pwd) local ${HOME}
+/usr/bin then "$@" | && "$1" awk
+awk sed test grep --verbose && /usr/bin -eu echo cd && printf "$@" -eu --verbose
+2>/dev/null printf test test sed done ${HOME} grep && echo local | -eu
+then export x=1 printf ${HOME} x=1 /usr/bin then done
+		"$@" test 'quoted text' $(pwd) 'quoted text'
+sed -eu "$1" ${HOME} printf grep "$1" export
+/usr/bin export /usr/bin grep -eu
+		&& sed --verbose "$@" ${HOME} | | readonly sed export awk sed then test sed
+	-eu ${HOME} test -eu cd echo "$1" $(pwd) $(pwd)
+'quoted text' | x=1 echo grep
+	test "$1" then printf cd /usr/bin
+		then awk $(pwd) printf "$1" test cd ${HOME}
+		readonly x=1 local export test grep echo ${HOME}
+echo /usr/bin test | x=1 $(pwd)
+	printf 'quoted text' 2>/dev/null done "$1" cd cd readonly -eu local
+	sed --verbose 2>/dev/null grep $(pwd) readonly
+2>/dev/null -eu awk test && && 'quoted text'
+		| "$1" local done local local && $(pwd) done
+	$(pwd) awk && /usr/bin x=1 'quoted text' ${HOME} "$@"
+	| --verbose local done echo && echo -eu && "$1" "$@" readonly | readonly
+'quoted text' then sed "$1" readonly awk 2>/dev/null echo --verbose
+		printf 2>/dev/null /usr/bin awk ${HOME} 'quoted text' 2>/dev/null then printf
+		readonly local ${HOME} && /usr/bin export readonly test -eu "$@" done
+		sed $(pwd) | sed cd done cd x=1 | "$1"
+		/usr/bin 2>/dev/null /usr/bin
+		printf && export /usr/bin -eu $(pwd) printf
+$(pwd) /usr/bin grep 'quoted text' && export sed sed test cd test "$@"
+		| 2>/dev/null grep "$@" done 'quoted text' 2>/dev/null --verbose $(pwd) local
+		grep export --verbose readonly printf readonly $(pwd) done
+		'quoted text' awk | "$@" test $(pwd) local readonly 2>/dev/null
+		test awk then echo --verbose echo ${HOME} -eu cd local
+		/usr/bin local awk 2>/dev/null x=1 grep done x=1
+	-eu x=1 sed then ${HOME}
+		awk export 2>/dev/null -eu local grep "$1" readonly printf awk cd 'quoted text'
+		local 2>/dev/null && cd 2>/dev/null
+		sed -eu ${HOME} test | sed 2>/dev/null done sed sed ${HOME} printf 2>/dev/null
+		grep && | ${HOME} x=1 "$1" test local && "$@" export
+x=1 cd echo awk x=1 local | grep
+&& && "$@" export echo test 'quoted text' local
+printf 2>/dev/null cd readonly 'quoted text' readonly x=1
+	'quoted text' readonly /usr/bin
+		'quoted text' --verbose | /usr/bin "$1" 'quoted text' sed export
+	--verbose 'quoted text' echo cd echo --verbose
+	local 2>/dev/null awk local x=1 'quoted text'
+	grep sed done --verbose 'quoted text' local cd $(pwd)
+		--verbose grep cd 'quoted text' done "$1" && | | "$1"
+--verbose $(pwd) -eu printf 2>/dev/null $(pwd) awk "$@" done awk sed done
+2>/dev/null 'quoted text' --verbose ${HOME} $(pwd) printf
+2>/dev/null sed /usr/bin local test x=1 && /usr/bin
+		/usr/bin printf echo && ${HOME} awk "$1" done
+		2>/dev/null sed -eu done sed
+		/usr/bin && local test
+	readonly awk then done --verbose export printf local -eu -eu "$1"
+	/usr/bin local readonly
+awk export awk --verbose 2>/dev/null
+	${HOME} | /usr/bin x=1 echo readonly 2>/dev/null then cd /usr/bin $(pwd) "$1"
+local $(pwd) done $(pwd) local /usr/bin ${HOME}
+	2>/dev/null 'quoted text' sed awk then "$@" x=1
+		then readonly export cd x=1 test
+	test grep -eu then cd
+awk && -eu -eu sed ${HOME} 'quoted text' x=1 "$@" awk printf x=1 cd local /usr/bin
+test then --verbose &&
+	awk /usr/bin readonly x=1 2>/dev/null sed grep --verbose "$1"
+	"$@" "$1" -eu "$1" 2>/dev/null |
+		cd | 2>/dev/null sed --verbose "$1" local printf /usr/bin
+printf x=1 "$@" awk /usr/bin 'quoted text' $(pwd) done echo sed awk awk
+		/usr/bin $(pwd) readonly printf
+	2>/dev/null echo sed && then 2>/dev/null -eu readonly
+	done local x=1 printf cd grep | 'quoted text' /usr/bin grep local printf test
+		${HOME} then grep awk
+2>/dev/null done local cd ${HOME} /usr/bin cd awk awk && then 2>/dev/null
+	local export done | "$@" test | grep cd && local 'quoted text'
+	awk local /usr/bin awk then x=1 /usr/bin $(pwd) x=1 readonly
+		--verbose ${HOME} then local awk "$1"
+	"$@" printf sed | echo export ${HOME} 2>/dev/null
+	readonly echo sed --verbose && then sed sed awk 2>/dev/null 'quoted text'
+	2>/dev/null "$@" sed /usr/bin "$@" cd cd cd test
+'quoted text' ${HOME} awk -eu export grep -eu | cd then then
+	-eu "$1" --verbose && 'quoted text' test printf sed cd
+2>/dev/null readonly -eu "$1" --verbose $(pwd)
+	printf grep readonly "$1" export | local
+then awk x=1 readonly
+	${HOME} | $(pwd) | "$@" echo 'quoted text' grep "$1"
+	/usr/bin printf $(pwd) x=1 done export
+	grep "$1" /usr/bin local grep ${HOME} 'quoted text'
+#include c198.sh
+		'quoted text' x=1 "$@" x=1 grep local 2>/dev/null /usr/bin awk echo --verbose $(pwd)
+		grep ${HOME} export --verbose ${HOME} awk && printf echo grep done
+		"$@" -eu readonly printf /usr/bin 2>/dev/null
+		2>/dev/null export && && $(pwd) printf &&
+| echo -eu 2>/dev/null && -eu then x=1 'quoted text'
+		done grep sed x=1 --verbose local "$@" readonly 'quoted text' printf
+		echo && --verbose /usr/bin export 'quoted text'
+2>/dev/null printf sed local test test grep ${HOME} then $(pwd) grep
+then ${HOME} /usr/bin ${HOME} && | cd echo --verbose
+	x=1 ${HOME} $(pwd) "$1" 2>/dev/null
+		-eu 'quoted text' && echo 'quoted text' cd "$@" --verbose readonly --verbose
+grep /usr/bin then 'quoted text' 2>/dev/null
+		2>/dev/null local sed "$1" readonly awk 2>/dev/null
+x=1 /usr/bin /usr/bin --verbose then echo grep $(pwd) "$1" then test
+	--verbose x=1 readonly cd grep awk test $(pwd) grep cd test
+	-eu | -eu /usr/bin printf readonly grep -eu "$1" export
+	grep test local -eu 'quoted text' $(pwd) ${HOME}
+	"$1" 2>/dev/null && printf $(pwd) | 2>/dev/null && export "$1"
+	export ${HOME} export test
+	done grep printf -eu x=1 'quoted text' printf --verbose x=1 2>/dev/null
+sed "$1" "$1" awk done echo ${HOME}
+printf 2>/dev/null | $(pwd) test ${HOME} /usr/bin --verbose | x=1 |
+	--verbose x=1 "$1" -eu 2>/dev/null
+		| test | then done export
+$(pwd) export 2>/dev/null cd $(pwd) 2>/dev/null ${HOME} grep --verbose done test
+export "$@" 'quoted text' x=1 /usr/bin
+	'quoted text' && awk readonly readonly -eu x=1 cd export
+	readonly export export ${HOME} sed test echo 'quoted text' 2>/dev/null -eu
+test "$1" grep readonly "$@" -eu local sed readonly && grep done grep
+	printf | /usr/bin ${HOME} 'quoted text'
+${HOME} | printf ${HOME} 'quoted text' echo $(pwd) /usr/bin
+		local done test readonly && then printf -eu awk
+		echo --verbose 'quoted text' "$1" echo readonly printf | 2>/dev/null
+	"$@" done cd /usr/bin cd $(pwd) grep awk export echo grep
+	"$1" 2>/dev/null then /usr/bin "$@" && "$1" --verbose $(pwd) 2>/dev/null 'quoted text'
+export local "$@" test printf cd export printf test -eu ${HOME}
+done --verbose awk --verbose readonly grep then awk export $(pwd)
+	| awk | 2>/dev/null local x=1 export $(pwd) sed -eu --verbose
+		x=1 "$@" ${HOME} x=1 --verbose cd readonly x=1 grep
+		grep "$@" /usr/bin done --verbose
+		then --verbose "$1" "$@" echo awk
+	local x=1 echo grep /usr/bin then export readonly sed test ${HOME}
+		x=1 sed readonly grep --verbose "$@" printf /usr/bin ${HOME} done awk
+	readonly "$1" --verbose 'quoted text' $(pwd) export x=1 $(pwd) test --verbose
+		printf | x=1 printf --verbose ${HOME} test cd /usr/bin export cd "$1" echo -eu
+		cd -eu sed --verbose 'quoted text'
+		echo export grep 'quoted text' 2>/dev/null
+	--verbose grep printf done ${HOME}
+		readonly "$@" x=1 x=1 /usr/bin $(pwd) printf | cd /usr/bin ${HOME}
+	"$@" echo ${HOME} printf x=1 cd echo -eu sed echo $(pwd) "$1" local -eu
+	awk ${HOME} /usr/bin sed sed | test done && $(pwd)
+	printf -eu test cd | 2>/dev/null readonly readonly /usr/bin
+		"$1" "$1" awk sed --verbose sed && then x=1 printf 2>/dev/null
+readonly readonly | 2>/dev/null 'quoted text' "$1" $(pwd)
+		local "$@" readonly ${HOME} 2>/dev/null awk printf -eu 2>/dev/null | --verbose
+		'quoted text' "$@" grep readonly readonly x=1 ${HOME} "$@" readonly --verbose
+	"$@" export --verbose 'quoted text' 2>/dev/null | export test
+	local cd $(pwd) "$1" "$@"
+&& x=1 grep test $(pwd) export then local test
+		--verbose export $(pwd) done --verbose echo then echo ${HOME} test /usr/bin
+grep printf awk | echo export done | readonly done ${HOME} "$@" ${HOME}
+${HOME} grep grep --verbose local /usr/bin sed sed printf
+		export ${HOME} x=1 grep readonly "$@" printf test "$@" x=1 2>/dev/null
+	test /usr/bin test grep | sed then printf echo "$@" echo
+	--verbose ${HOME} sed done echo "$@" readonly "$1" cd awk --verbose
+cd done "$1" echo echo 'quoted text' "$1" --verbose /usr/bin printf
+$(pwd) export 2>/dev/null "$@" sed then 2>/dev/null -eu /usr/bin
+2>/dev/null /usr/bin
+grep export "$@" local x=1 ${HOME} 2>/dev/null /usr/bin
+		$(pwd) printf grep && /usr/bin "$@" cd cd && "$@" x=1 export grep
+grep local x=1 readonly "$@" 'quoted text' 'quoted text' && grep
+done awk && 'quoted text' && cd readonly local $(pwd) | /usr/bin 'quoted text'
+	/usr/bin --verbose export
+		echo grep export 'quoted text' --verbose done local
+	'quoted text' export /usr/bin 'quoted text' test echo echo --verbose
+	"$1" 'quoted text' x=1 printf "$@" x=1 $(pwd) grep $(pwd) --verbose test printf
+		printf -eu --verbose --verbose
+echo ${HOME} readonly "$1" test x=1 x=1 --verbose
+		test "$@" x=1 "$@" printf printf "$1" readonly printf local
+		| test test --verbose --verbose ${HOME} 'quoted text' readonly
+2>/dev/null $(pwd) "$@" && awk | --verbose
+	export awk --verbose 'quoted text' export printf grep test /usr/bin echo
+	awk "$@" sed $(pwd) cd local "$@" grep awk --verbose awk /usr/bin 'quoted text'
+		cd awk 'quoted text' readonly x=1
+		echo then 2>/dev/null local -eu test test cd
+'quoted text' done readonly readonly --verbose -eu test
+	"$1" x=1 export test test export x=1 awk && test 'quoted text'
+done local --verbose readonly /usr/bin
+then grep cd done done --verbose grep export ${HOME}
+		grep x=1 sed local readonly
+	"$@" /usr/bin | x=1 printf ${HOME} ${HOME} grep sed ${HOME} test grep test echo
+test && 2>/dev/null local "$@" 2>/dev/null 'quoted text' export
+		-eu "$1" local -eu export --verbose --verbose cd sed sed readonly $(pwd)
+"$1" --verbose test "$@" printf then then $(pwd) cd ${HOME} 2>/dev/null done
+		sed test local export then && echo "$1" test local done "$@"
+	| && awk done export 'quoted text' readonly --verbose ${HOME} awk "$1" && "$@"
+then awk local readonly sed cd readonly /usr/bin
+		then readonly --verbose /usr/bin local ${HOME} test /usr/bin sed | printf test
+		$(pwd) $(pwd) ${HOME} local
+	2>/dev/null done test done test ${HOME} /usr/bin printf printf printf test
+	local x=1 echo test --verbose $(pwd) echo then x=1 --verbose
+	"$1" "$1" && grep awk | local -eu awk printf grep cd 'quoted text' | "$1"
+		readonly awk x=1 sed ${HOME} then test
+		"$@" x=1 sed | 2>/dev/null ${HOME} && /usr/bin readonly awk test 2>/dev/null
+		awk done -eu ${HOME} sed | "$@" cd readonly done readonly test -eu awk $(pwd) "$1"
+/usr/bin cd && --verbose export 2>/dev/null grep 'quoted text' printf 2>/dev/null
+	local ${HOME} && cd 2>/dev/null | && grep test printf 2>/dev/null
+	| | /usr/bin then done test $(pwd) readonly
+$(pwd) x=1 printf /usr/bin | -eu -eu done $(pwd) | done sed && sed
+	-eu 2>/dev/null readonly
+'quoted text' awk readonly readonly echo readonly
+		printf 'quoted text' done $(pwd) done
+		awk echo readonly --verbose sed then then done readonly
+		'quoted text' $(pwd) export
+	readonly ${HOME} done ${HOME}
+	done | then cd local /usr/bin sed cd "$1" export "$1" echo "$1" x=1 | readonly export
+		awk done grep && | 'quoted text' x=1 /usr/bin test ${HOME} ${HOME} -eu
+	then 2>/dev/null local --verbose
+	done | awk sed echo ${HOME} --verbose test -eu | export | grep awk
+		/usr/bin ${HOME} awk --verbose
+		x=1 readonly echo | done then x=1 local export cd cd 'quoted text' $(pwd)
+	${HOME} "$@" then 2>/dev/null test then local awk sed "$@" export /usr/bin
+export grep | awk export echo awk --verbose echo | ${HOME} -eu echo "$1"
+local test done then "$1" && readonly test test local
+	done | x=1 cd grep printf 'quoted text' grep 2>/dev/null awk /usr/bin
+	| /usr/bin printf "$@" awk && 2>/dev/null export then cd 2>/dev/null 'quoted text'
+		local && --verbose -eu printf echo sed readonly test $(pwd) local grep grep printf
+		awk $(pwd) readonly x=1 --verbose && then local export done
+echo test awk ${HOME} --verbose $(pwd) ${HOME} readonly 'quoted text' x=1 done
+		sed awk readonly echo "$1" 2>/dev/null -eu /usr/bin local | sed
+	&& then readonly /usr/bin "$1"
+	$(pwd) /usr/bin echo | -eu readonly
+echo && cd ${HOME} echo readonly test cd 2>/dev/null "$1" grep
+then ${HOME} "$@" sed -eu 'quoted text' "$@" done --verbose && echo 2>/dev/null
+	export local ${HOME} ${HOME} cd grep | done x=1 ${HOME} then x=1 | "$@" printf
+		2>/dev/null awk export && local awk ${HOME}
+	awk "$1" cd ${HOME} && "$@"
+sed done --verbose echo echo "$1" grep printf echo 2>/dev/null
+	'quoted text' test && "$1" printf /usr/bin /usr/bin "$@" done test --verbose
+cd 'quoted text' /usr/bin readonly
+	grep "$@" echo sed /usr/bin awk 2>/dev/null -eu && | local /usr/bin
+	$(pwd) -eu awk printf readonly then
+	--verbose x=1 done --verbose
+		2>/dev/null "$@" cd export
+	2>/dev/null 'quoted text' readonly sed done
+	readonly /usr/bin grep $(pwd) -eu ${HOME} && "$@" "$@" readonly 'quoted text'
+		--verbose done 'quoted text' then cd then /usr/bin && local ${HOME}
+	${HOME} local awk cd $(pwd) 2>/dev/null /usr/bin |
+		'quoted text' x=1 local local test
+		done then /usr/bin test readonly
+/usr/bin readonly 'quoted text' | "$@" echo echo "$@" "$@"
+		-eu | readonly echo "$1" done export -eu echo grep 2>/dev/null x=1 "$1" x=1
+		printf then --verbose local then 'quoted text' |
+2>/dev/null awk printf "$1" "$@" x=1 'quoted text' 2>/dev/null done printf
+	done && $(pwd) test "$1" grep grep export -eu x=1 /usr/bin sed | 2>/dev/null export
+	2>/dev/null 2>/dev/null x=1 2>/dev/null
+	cd | printf "$1" "$@" grep "$@" $(pwd) 2>/dev/null
+test readonly local "$@" $(pwd)
+		--verbose "$@" export export echo printf export -eu
+done export done awk printf export test -eu done test -eu && printf
+		cd ${HOME} awk readonly done local grep awk export
+		-eu done grep grep /usr/bin printf $(pwd) 'quoted text' "$1" -eu cd &&
+export then printf echo export /usr/bin readonly
+	sed /usr/bin ${HOME} local sed 'quoted text' awk local --verbose && echo 2>/dev/null
+	"$1" grep -eu && "$1" printf ${HOME} sed ${HOME}
+		--verbose printf "$1" -eu echo awk $(pwd)
+"$@" && sed "$@" local "$1" printf
+grep && echo x=1 local echo cd 2>/dev/null readonly test awk |
+		sed "$@" ${HOME} && sed $(pwd)
+test cd /usr/bin 'quoted text' x=1 ${HOME} && cd "$1" 'quoted text' grep
+--verbose ${HOME} /usr/bin --verbose printf printf 2>/dev/null
+	grep cd test $(pwd) "$1" "$1"
+	"$@" export sed sed echo 2>/dev/null
+		$(pwd) | test 2>/dev/null -eu
+'quoted text' local then --verbose awk awk readonly "$1" grep grep test awk
+		"$@" echo cd --verbose sed grep test --verbose
+		readonly && /usr/bin done export -eu -eu 2>/dev/null export echo test x=1 echo
+	"$1" grep readonly x=1 export export cd echo sed then 2>/dev/null
+$(pwd) cd echo awk "$1" cd x=1 'quoted text' awk awk -eu "$1" /usr/bin test
+		-eu 2>/dev/null | -eu --verbose readonly
+		'quoted text' printf | $(pwd) && test /usr/bin cd done | ${HOME} x=1 &&
+--verbose $(pwd) --verbose printf awk then 'quoted text'
+	"$@" test "$@" --verbose | awk | readonly test local local then
+		"$@" $(pwd) export export "$@"
+--verbose ${HOME} ${HOME} --verbose done $(pwd) 2>/dev/null 2>/dev/null
+	test | "$1" && 2>/dev/null 'quoted text'
+readonly --verbose "$1"
+$(pwd) --verbose "$1" $(pwd) local ${HOME} export readonly test export 'quoted text'
+	$(pwd) local -eu cd 'quoted text' awk test -eu echo
+cd && -eu $(pwd) "$1" x=1 then /usr/bin then /usr/bin
+	| done test sed --verbose
+sed "$@" | "$1" export export --verbose --verbose "$1" /usr/bin 2>/dev/null
+/usr/bin export /usr/bin /usr/bin echo
+&& 'quoted text' cd echo "$1" --verbose | readonly "$@" done sed cd 'quoted text'
+		--verbose $(pwd) grep export --verbose x=1 ${HOME} $(pwd) cd -eu printf 'quoted text'
+	echo "$@" readonly "$1" grep 2>/dev/null "$1" "$@" 2>/dev/null done printf
+2>/dev/null -eu awk /usr/bin && x=1 /usr/bin
+	/usr/bin printf echo $(pwd) -eu "$1" "$1"
+	| readonly "$1" awk readonly cd | printf "$@" awk "$1"
+	x=1 done sed "$@" x=1 $(pwd) local local done ${HOME}
+		awk $(pwd) -eu "$@" 'quoted text' "$1" && awk $(pwd) echo local
+--verbose x=1 readonly /usr/bin printf -eu export
+then echo export /usr/bin done 2>/dev/null -eu grep && 2>/dev/null && 2>/dev/null
+&& sed /usr/bin -eu done then local | sed "$@" -eu
+	-eu sed done export x=1 echo done "$@"
+	readonly ${HOME} --verbose && readonly "$@" -eu /usr/bin
+local /usr/bin 2>/dev/null export sed
+		'quoted text' 2>/dev/null
+		x=1 cd -eu echo test x=1 export
+		done done && "$1" grep grep sed printf cd test "$@"
+2>/dev/null x=1 readonly echo local 'quoted text' 2>/dev/null
+grep "$@" done 'quoted text' && ${HOME} "$1" awk "$1" ${HOME} --verbose --verbose
+		sed /usr/bin local "$@" grep "$1" then export /usr/bin test "$@"
+		grep 'quoted text' test echo then ${HOME} /usr/bin grep ${HOME}
+		echo && x=1 test "$1" then "$1" awk x=1 then sed
+done /usr/bin sed sed printf then export 2>/dev/null x=1 local 2>/dev/null
+readonly test cd sed "$@" "$@" "$1" local
+		awk test then x=1 grep awk done test $(pwd)
+echo cd printf "$1" local "$@" --verbose local echo
+	sed local 2>/dev/null ${HOME} x=1 done done
+		sed $(pwd) export readonly |
+		x=1 "$1" then done readonly | then done export /usr/bin
+		"$@" 'quoted text' grep export
+sed "$@" $(pwd) | --verbose export $(pwd) cd grep 'quoted text' printf
+awk /usr/bin test echo sed
+	&& -eu grep grep echo local sed 'quoted text' sed
+		sed --verbose "$1" cd export cd export && local 'quoted text' "$@"
+		2>/dev/null grep then && export /usr/bin grep then "$@" test --verbose
+	export cd grep ${HOME} --verbose ${HOME} -eu $(pwd) "$@"
+		sed sed sed sed readonly --verbose
+test | grep && "$1" $(pwd) "$1" "$1" printf --verbose
+| | export ${HOME} export --verbose && test export x=1 /usr/bin
+export 'quoted text' readonly x=1 sed ${HOME} 'quoted text' echo readonly
+	export export local readonly readonly done "$1"
+&& done $(pwd) 'quoted text' "$@" sed /usr/bin awk "$1" then | test
+	sed --verbose --verbose x=1 readonly cd -eu
+		sed -eu /usr/bin ${HOME}
+	test cd ${HOME} ${HOME} sed -eu grep grep
+| "$@" sed 2>/dev/null echo sed "$1" 2>/dev/null test | 'quoted text'
+printf 2>/dev/null then ${HOME} grep 'quoted text'
+		"$@" awk "$1" local export --verbose export done
+		local x=1 --verbose grep --verbose "$1" echo && "$1" cd done "$@"
+then cd sed 'quoted text' cd sed echo readonly awk "$1" && sed local ${HOME}
+	readonly -eu test --verbose
+		/usr/bin echo sed -eu 'quoted text' local export cd readonly done
+	sed "$@" cd awk "$@" test
+	awk local cd readonly then | readonly | --verbose echo
+	'quoted text' /usr/bin test
+		$(pwd) echo x=1 -eu then "$1"
+	test grep 2>/dev/null "$1" --verbose readonly export | /usr/bin
+&& | test 2>/dev/null local ${HOME} local grep "$@" test sed cd
+	| $(pwd) awk -eu sed done printf
+		--verbose | test readonly test then local sed "$@" --verbose readonly
+	local then readonly "$1" test echo cd done
+"$1" export 'quoted text' "$@" && "$1" awk local
+sed local $(pwd) test sed export x=1 ${HOME} x=1
+local sed | then /usr/bin $(pwd) cd /usr/bin "$1" export $(pwd) "$1" ${HOME}
+		sed test local export printf grep "$1" 'quoted text' export then "$1" done
+		${HOME} done awk cd echo && local done done |
+		"$1" x=1 /usr/bin then $(pwd) $(pwd) readonly /usr/bin
+$(pwd) -eu "$1" awk "$@" | "$@" "$@" test readonly printf
+		then x=1 echo done done printf "$1"
+	x=1 cd && awk then then 'quoted text' then done && ${HOME} ${HOME} echo | /usr/bin
+cd 2>/dev/null | local && export export
+echo -eu local $(pwd) && "$1" "$1" printf --verbose readonly
+		-eu readonly echo 'quoted text'
+x=1 grep readonly 2>/dev/null
+local done cd "$1" readonly /usr/bin x=1 then test -eu /usr/bin /usr/bin
+		| printf local $(pwd) 2>/dev/null
+/usr/bin $(pwd) readonly cd $(pwd) export --verbose local --verbose ${HOME} test
+		${HOME} /usr/bin --verbose readonly done then $(pwd)
+	"$@" && && cd readonly && --verbose
+		&& done --verbose | grep then then && x=1 $(pwd)
+	cd "$1" echo readonly export
+export test "$@" | echo --verbose then $(pwd) test printf awk | echo export 'quoted text'
+&& "$1" awk "$@" then $(pwd) readonly /usr/bin
+2>/dev/null local "$@" readonly --verbose sed printf printf "$@"
+echo 2>/dev/null /usr/bin && $(pwd) && test readonly 'quoted text' then awk
+	test local x=1 then ${HOME} 'quoted text' done 'quoted text'
+--verbose cd then awk test x=1 export export /usr/bin then test $(pwd) ${HOME}
+		"$@" test --verbose x=1 --verbose
+/usr/bin | readonly readonly local printf x=1
+done --verbose "$@" then done done test --verbose done "$@"
+		test sed test 2>/dev/null sed /usr/bin
+	then "$1" echo export grep --verbose then awk printf ${HOME} local "$1"
+$(pwd) readonly export readonly awk 'quoted text'
+		-eu readonly 2>/dev/null 2>/dev/null echo grep --verbose ${HOME}
+		"$1" ${HOME} readonly ${HOME} /usr/bin cd ${HOME}
+2>/dev/null export "$1" "$1" 'quoted text'
+export test 'quoted text' $(pwd) | grep grep done "$@" && --verbose /usr/bin test
+		cd local echo readonly 'quoted text' "$@" ${HOME}
+	readonly "$@" "$@" awk printf /usr/bin 2>/dev/null 2>/dev/null &&
+echo "$@" && done export -eu sed "$1" readonly readonly readonly
+		grep test 2>/dev/null echo sed local echo export export local then local readonly
+	'quoted text' then grep printf grep echo "$1" printf echo test
+		readonly cd cd test sed grep readonly test local test test "$@" | $(pwd) awk
+then $(pwd) && sed then 'quoted text' && readonly printf
+local echo 2>/dev/null -eu -eu cd test cd readonly local then local printf
+		"$@" ${HOME} export test readonly printf &&
+		2>/dev/null $(pwd) export test --verbose
+/usr/bin test ${HOME} "$@" grep awk sed "$@"
+		then awk ${HOME} ${HOME}
+		$(pwd) echo awk "$@" printf
+x=1 2>/dev/null ${HOME} then --verbose cd | grep "$@" echo readonly $(pwd)
+"$1" | then grep awk | awk 2>/dev/null done "$1" 'quoted text' "$@" sed
+echo --verbose $(pwd) 2>/dev/null cd --verbose x=1 x=1 -eu grep
+		cd echo export x=1 local
+		test cd test then 2>/dev/null -eu printf grep local
+	${HOME} awk local $(pwd) && x=1 printf grep readonly x=1 | && then awk
+done echo 2>/dev/null /usr/bin test awk done "$@" export
+done printf "$@" | -eu awk test 'quoted text' then --verbose cd -eu "$@" | ${HOME}
+		readonly | local $(pwd) sed ${HOME} ${HOME} awk && local then /usr/bin
+readonly | sed $(pwd) && done then
+printf then then -eu --verbose printf local ${HOME} && cd
+cd --verbose ${HOME} "$@" && grep 'quoted text'
+		then printf readonly "$@" readonly 2>/dev/null export x=1 local 'quoted text'
+awk printf then sed -eu cd then 2>/dev/null awk 2>/dev/null | sed 'quoted text'
+		| readonly "$1" test 2>/dev/null 2>/dev/null
+then -eu echo | echo -eu && --verbose -eu grep | && "$@" "$@" export
+	&& then grep "$1" cd "$@" | && && local -eu |
+	grep export cd export 'quoted text' 'quoted text' cd |
+printf readonly done && printf test | 2>/dev/null 'quoted text' test /usr/bin
+cd printf "$1" /usr/bin test awk awk ${HOME} readonly ${HOME} grep test
+	| sed local "$@" -eu then "$1" awk --verbose "$@" ${HOME} -eu
+		x=1 sed "$@" 2>/dev/null "$@" echo 2>/dev/null $(pwd)
+"$@" 2>/dev/null && cd
+	--verbose then && && -eu grep $(pwd) then done "$1"
+awk ${HOME} done x=1 grep export /usr/bin readonly
+		grep "$1" $(pwd) cd | local export && --verbose
+		local $(pwd) "$@" awk x=1 local then $(pwd) done "$1" "$@" grep 'quoted text'
+sed awk sed printf sed done done done "$@" "$1" echo --verbose
+	x=1 x=1 'quoted text' /usr/bin test "$1" echo ${HOME} 2>/dev/null
+sed "$1" x=1 readonly
+awk /usr/bin && cd sed ${HOME} 2>/dev/null "$1" cd 2>/dev/null grep
+done "$@" "$1" 'quoted text' $(pwd)
+local 'quoted text' | 2>/dev/null readonly x=1 -eu --verbose
+local ${HOME} 'quoted text' -eu $(pwd) --verbose done ${HOME} echo
+	--verbose test -eu export --verbose done local "$@" 2>/dev/null $(pwd)
+	-eu grep ${HOME} "$1" "$@" echo sed readonly "$1" local 'quoted text'
+	"$@" -eu test test ${HOME} local echo sed
+		2>/dev/null 2>/dev/null awk /usr/bin awk | echo && "$@"
+		then 2>/dev/null x=1 && "$1" --verbose readonly sed local grep sed printf
+	'quoted text' grep $(pwd) done echo -eu
+		/usr/bin && | echo test printf "$@" /usr/bin local printf
+test --verbose then --verbose
+	${HOME} "$1" readonly ${HOME} x=1 --verbose cd sed done echo /usr/bin 2>/dev/null
+sed /usr/bin -eu readonly cd "$1" cd x=1 x=1 then $(pwd) export
+done awk sed done && /usr/bin awk x=1 done -eu $(pwd) | $(pwd) -eu /usr/bin
+	--verbose sed awk 'quoted text'
+-eu sed export 'quoted text' $(pwd) cd /usr/bin | x=1 local 2>/dev/null
+/usr/bin done /usr/bin export export | /usr/bin echo /usr/bin x=1 awk export
+awk done sed done grep awk ${HOME} 2>/dev/null then /usr/bin then sed echo &&
+	test done | /usr/bin ${HOME} awk &&
+done -eu test grep grep
+$(pwd) echo readonly local
+		'quoted text' readonly "$@" && -eu --verbose && grep
+$(pwd) readonly printf local 'quoted text'
+${HOME} done export local done $(pwd) -eu -eu printf
+'quoted text' awk /usr/bin export --verbose grep
+		sed readonly test "$@" "$1" echo test 'quoted text'
+readonly local | ${HOME} readonly 'quoted text' export && grep
+		grep --verbose 'quoted text' ${HOME} awk test $(pwd)
+	/usr/bin ${HOME} awk | -eu echo $(pwd)
+awk "$@" ${HOME} printf x=1 "$@" "$1" /usr/bin sed awk cd 2>/dev/null
+		grep | then readonly -eu done 'quoted text' -eu done | -eu export --verbose x=1
+	-eu export export 'quoted text' cd x=1 2>/dev/null test
+		| | local $(pwd) grep 'quoted text' /usr/bin 2>/dev/null echo ${HOME} "$@"
+	${HOME} readonly 2>/dev/null | grep printf -eu readonly
+	${HOME} -eu printf echo | /usr/bin readonly test /usr/bin awk echo -eu cd
+		test "$@" "$@" sed /usr/bin then && sed | | $(pwd) "$1" x=1
+	grep ${HOME} readonly readonly readonly export export
+		&& /usr/bin then x=1 cd grep test awk
+--verbose 'quoted text' done
+		--verbose local /usr/bin 2>/dev/null readonly printf
+		cd awk x=1 sed done | grep local export cd $(pwd) readonly 'quoted text'
+	awk local printf grep echo grep then $(pwd) sed awk then /usr/bin
+| local echo awk readonly local local cd then 2>/dev/null "$@" /usr/bin export
+	$(pwd) && -eu export "$@" x=1 sed local export $(pwd) sed cd "$1" test
+/usr/bin echo --verbose cd --verbose
+	x=1 ${HOME} -eu printf /usr/bin sed && then /usr/bin readonly
+		"$@" /usr/bin "$@" x=1 sed grep | && awk
+	| sed grep ${HOME} test ${HOME} cd
+	test echo readonly "$1" cd 2>/dev/null done export cd --verbose x=1
+	2>/dev/null "$@" ${HOME} grep sed 2>/dev/null
+	awk "$1" sed 2>/dev/null
+		&& then 2>/dev/null -eu 2>/dev/null local
+done "$1" grep 2>/dev/null $(pwd) local printf /usr/bin
+	export -eu 'quoted text' cd | ${HOME} /usr/bin "$1" /usr/bin
+	echo "$@" then test export $(pwd) --verbose
+		--verbose printf /usr/bin then local -eu local && x=1 done printf
+	export /usr/bin sed test "$1" -eu cd --verbose | $(pwd) grep cd | done ${HOME}
+		"$1" --verbose then grep --verbose 2>/dev/null
+sed "$1" sed x=1 /usr/bin --verbose awk
+	"$1" then x=1 local local $(pwd) local local 'quoted text'
+&& ${HOME} | | echo export local local cd "$1"
+	export ${HOME} cd sed sed printf local
+		&& echo && ${HOME} readonly --verbose printf
+		readonly && local "$@"
+"$1" -eu x=1 readonly grep "$@" "$1" printf echo $(pwd) $(pwd) &&
+| export echo grep x=1 'quoted text' "$1" x=1 cd
+-eu 2>/dev/null then && test
+"$1" awk echo --verbose 2>/dev/null 'quoted text'
+		printf -eu awk $(pwd) cd --verbose 2>/dev/null local ${HOME} ${HOME} readonly
+	"$@" 2>/dev/null && done
+		/usr/bin cd grep readonly awk --verbose "$@" cd local
+sed awk "$1" local /usr/bin
+--verbose echo done readonly /usr/bin awk
+		export -eu test readonly "$1" test /usr/bin
+&& ${HOME} -eu && "$1" $(pwd) printf then
+		/usr/bin "$@" | | printf cd sed test awk "$1" local
+	2>/dev/null grep "$@" grep ${HOME}
+		${HOME} cd "$@" | 2>/dev/null then cd && x=1 --verbose
+		done awk then -eu awk then sed x=1 awk grep awk ${HOME}
+grep | grep && grep && grep -eu awk grep x=1 "$1"
+	then test ${HOME} x=1 && done
+x=1 test ${HOME} done ${HOME} -eu then | readonly cd test done cd
+		awk "$1" awk test ${HOME} sed 2>/dev/null test done grep -eu --verbose
+${HOME} -eu test x=1 -eu echo sed local readonly "$@" printf
+		grep grep "$1" then --verbose ${HOME} export cd "$1" grep /usr/bin
+	export $(pwd) -eu sed cd readonly /usr/bin grep grep done $(pwd) 2>/dev/null
+		export ${HOME} readonly -eu /usr/bin "$@" ${HOME} grep -eu then sed local |
+	sed $(pwd) -eu 'quoted text' /usr/bin printf
+	local $(pwd) "$@" grep "$1" 'quoted text'
+&& test readonly "$1" export test done 'quoted text' "$1" then
+'quoted text' echo echo ${HOME} printf
+		then | ${HOME} $(pwd) ${HOME} "$@" awk 2>/dev/null $(pwd) -eu 2>/dev/null -eu
+$(pwd) | ${HOME} echo grep grep 'quoted text'
+	"$1" grep grep 'quoted text' $(pwd) ${HOME} export 'quoted text'
+done done awk x=1 ${HOME} cd x=1 2>/dev/null local /usr/bin sed --verbose
+x=1 sed sed local 'quoted text' awk
+readonly printf grep x=1 --verbose
+test readonly -eu then done x=1 -eu echo done then
+		"$1" $(pwd) awk | "$1" x=1 "$@"
+$(pwd) "$1" printf 'quoted text'
+		grep cd echo test && 'quoted text' then x=1 sed echo "$1" --verbose
+'quoted text' test awk grep 'quoted text' test done
+test x=1 "$@" "$@" && local readonly
+		2>/dev/null export x=1 awk sed && readonly test "$@" 2>/dev/null
+		echo "$1" readonly --verbose x=1 done test printf test sed 2>/dev/null 'quoted text'
+$(pwd) test "$1" grep "$1" 2>/dev/null 2>/dev/null
+		echo $(pwd) ${HOME} "$@" "$1" readonly
+		sed printf "$@" echo local $(pwd) done cd x=1 && awk | grep cd readonly
+	x=1 test readonly echo awk $(pwd) -eu test x=1 awk echo ${HOME} -eu then
+		done 'quoted text' --verbose ${HOME} | "$@" --verbose 'quoted text'
+/usr/bin sed 2>/dev/null
+		| test done $(pwd) 'quoted text' echo readonly readonly
+'quoted text' sed "$1" test "$@" x=1 grep $(pwd) cd echo export "$1" local
+	grep export sed printf /usr/bin
+'quoted text' 'quoted text' x=1 && done ${HOME} printf /usr/bin echo echo
+		readonly ${HOME} done printf "$@" | readonly
+printf export $(pwd) printf grep
+echo 'quoted text' local /usr/bin && "$@" 'quoted text' -eu readonly printf
+		&& "$@" "$1" local test readonly $(pwd)
+sed && printf --verbose local 'quoted text'
+		local -eu readonly 'quoted text' "$@" grep 2>/dev/null
+		cd echo $(pwd) test done $(pwd) done $(pwd) local 2>/dev/null test
+	x=1 --verbose $(pwd) export
+		-eu test 'quoted text' echo export
+readonly ${HOME} && export | --verbose --verbose 2>/dev/null echo
+		| | 2>/dev/null cd then 2>/dev/null $(pwd) awk
+-eu -eu done awk export local sed x=1 echo ${HOME}
+	printf $(pwd) printf $(pwd) then x=1 test done --verbose readonly
+	cd export -eu then local
+		export /usr/bin readonly cd | /usr/bin sed ${HOME} awk export --verbose
+	'quoted text' test echo 'quoted text' printf export grep
+x=1 2>/dev/null test test "$1" export x=1 cd
+sed "$@" && | | /usr/bin ${HOME} local
+		--verbose cd local cd printf awk
+&& && awk then readonly && grep
+	sed | grep local 2>/dev/null sed awk && x=1 -eu awk x=1 /usr/bin cd
+		printf cd "$1" "$1" test then -eu 'quoted text'
+	echo test awk local $(pwd) done "$1" /usr/bin "$1" done cd readonly "$1" printf
+	awk awk then --verbose
+	'quoted text' echo awk cd ${HOME} --verbose
+${HOME} | /usr/bin export
+		'quoted text' x=1 export -eu "$@" "$@" ${HOME} local ${HOME} 2>/dev/null
+"$@" readonly ${HOME} printf $(pwd) | 'quoted text'
+	sed local "$@" --verbose ${HOME} local cd local readonly --verbose local
+		| --verbose "$@" "$1"
+	--verbose awk cd test 'quoted text' x=1 "$@" -eu
+	&& sed test "$@" printf 'quoted text' && echo
+printf && 2>/dev/null then
+	--verbose /usr/bin awk then local "$@" export echo
+local awk /usr/bin && && done /usr/bin --verbose sed "$1" ${HOME}
+export readonly printf "$1"
+echo test --verbose then ${HOME} && local
+	local --verbose export "$1" done printf -eu -eu sed "$@" $(pwd) 'quoted text'
+		"$1" then sed -eu | -eu "$@" /usr/bin 'quoted text'
+	| | "$1" awk grep sed export
+		$(pwd) echo && -eu cd "$1" cd echo awk grep export --verbose sed | echo /usr/bin
+	readonly echo $(pwd) done -eu then
+	echo 'quoted text' awk local echo grep
+printf | ${HOME} cd then "$1" --verbose
+&& printf printf --verbose ${HOME} "$@"
+		awk echo 'quoted text' /usr/bin "$@"
+		local cd --verbose echo "$@" sed | "$1" local test $(pwd) cd cd
+		x=1 x=1 && echo readonly test done echo then
+awk 2>/dev/null test printf "$@" awk done
+		awk sed x=1 echo then 2>/dev/null then
+		"$1" /usr/bin readonly | test 2>/dev/null "$@" sed x=1 -eu grep $(pwd) --verbose
+	done awk | "$1" grep "$1" --verbose "$@" $(pwd)
+		"$1" echo grep "$@" test ${HOME} | local export -eu --verbose
+--verbose 'quoted text' local
+| 'quoted text' done "$1"
+	'quoted text' && export "$@" export ${HOME}
+		-eu cd 'quoted text' --verbose awk $(pwd) /usr/bin
+test | "$1" "$@" cd export then && "$@" "$1" grep --verbose then && export $(pwd)
+'quoted text' local | "$1" awk then $(pwd) $(pwd)
+test done ${HOME} --verbose test && ${HOME} cd then local readonly
+		cd export && 'quoted text' then ${HOME} sed echo sed |
+	readonly sed local awk sed awk --verbose
+		'quoted text' grep printf printf && 'quoted text' | /usr/bin printf
+		sed cd printf readonly
+	done grep done "$1" "$@" && -eu /usr/bin "$@" awk
+done | awk cd --verbose echo cd export echo x=1 | export --verbose test printf
+	-eu $(pwd) 2>/dev/null awk && x=1 then printf cd test --verbose sed
+${HOME} "$@" | "$@" | echo "$@" sed
+	test then | printf ${HOME} cd /usr/bin x=1 'quoted text' "$@" printf ${HOME}
+		sed grep local 'quoted text' test echo export grep printf
+"$1" sed printf --verbose ${HOME}
+		-eu test 'quoted text' "$@" x=1 test awk echo
+	&& local -eu /usr/bin done
+		then /usr/bin $(pwd) ${HOME} test 'quoted text'
+		"$@" test $(pwd) echo echo echo x=1 'quoted text' --verbose 2>/dev/null
+		echo ${HOME} echo | printf done export echo printf $(pwd) sed --verbose "$1"
+export $(pwd) echo awk && ${HOME}
+	done grep ${HOME} "$@"
+	| cd grep ${HOME} echo ${HOME} readonly
+		test /usr/bin | --verbose
+${HOME} 2>/dev/null ${HOME} local && | && x=1 printf -eu "$@" done /usr/bin |
+	"$@" done -eu done done local done echo "$@"
+		"$1" x=1 printf $(pwd) then done test export cd grep | grep "$@" 'quoted text'
+	&& test printf x=1 ${HOME} then
+		${HOME} printf done cd echo && $(pwd) local x=1 'quoted text' sed done "$1"
+	cd "$1" done /usr/bin ${HOME} test local /usr/bin "$1" --verbose /usr/bin
+		grep sed then grep grep sed done 'quoted text' 2>/dev/null done --verbose test
+&& echo then 'quoted text'
+	then echo awk cd "$1" done 2>/dev/null "$@" export cd then export ${HOME}
+		sed $(pwd) ${HOME} readonly --verbose --verbose grep "$1"
+done cd x=1 done printf then sed 2>/dev/null export then x=1
+	sed 'quoted text' awk x=1 test $(pwd) "$@" export $(pwd) export done ${HOME} --verbose
+2>/dev/null printf && && "$1" 'quoted text'
+	test done cd readonly "$1" grep --verbose | 2>/dev/null | -eu -eu
+done then && test echo | -eu echo readonly && "$1" readonly then export
+	2>/dev/null | $(pwd) awk local && test "$@" --verbose ${HOME} test
+	then echo /usr/bin grep
+test && 2>/dev/null && echo -eu 'quoted text' local ${HOME} "$1" ${HOME}
+		-eu "$@" echo then sed printf
+$(pwd) export sed 'quoted text' sed readonly
+	"$1" -eu readonly $(pwd) readonly
+$(pwd) then sed test 2>/dev/null cd export export -eu
+	cd awk awk && readonly && "$1" --verbose printf awk cd grep
+	$(pwd) then awk test 'quoted text' grep export echo grep awk
+	/usr/bin 'quoted text' echo export echo "$@"
+		/usr/bin readonly && grep export x=1 local then
+		x=1 && ${HOME} then --verbose done echo 'quoted text' export
+	echo "$@" $(pwd) --verbose ${HOME} local $(pwd) --verbose 'quoted text'
+		awk $(pwd) export done done /usr/bin local sed
+x=1 $(pwd) printf test "$1" readonly -eu sed "$1" done
+	"$@" 'quoted text' local done $(pwd) export printf
+"$@" "$@" then --verbose done grep cd export done cd local
+2>/dev/null local grep 2>/dev/null
+'quoted text' --verbose x=1
+		2>/dev/null readonly -eu 'quoted text' awk | -eu done sed
+"$@" readonly test grep "$1" $(pwd) grep
+	then $(pwd) cd --verbose --verbose readonly $(pwd)
+	${HOME} grep $(pwd) grep then
+	-eu sed --verbose test grep sed grep /usr/bin "$@" x=1 -eu
+${HOME} echo /usr/bin ${HOME} grep && /usr/bin -eu echo grep sed then | -eu --verbose
+printf local printf 2>/dev/null $(pwd) && printf /usr/bin cd echo
+	"$1" readonly --verbose $(pwd) export sed | | grep
+		/usr/bin readonly x=1 cd awk 2>/dev/null awk x=1 x=1 $(pwd) readonly
+		sed printf done sed sed /usr/bin awk
+	2>/dev/null /usr/bin awk 'quoted text' printf awk $(pwd) --verbose done sed echo
+		sed && test echo --verbose awk | x=1 awk export test readonly "$@"
+	/usr/bin "$@" | grep done $(pwd) && 2>/dev/null done $(pwd) cd ${HOME} --verbose
+	/usr/bin 2>/dev/null printf awk ${HOME} done printf then ${HOME}
+readonly 2>/dev/null awk
+	--verbose | then then ${HOME} | /usr/bin x=1 sed test sed $(pwd)
+		local grep sed | "$@" done printf grep local 'quoted text'
+		| echo cd | $(pwd) test $(pwd) 'quoted text' printf grep -eu sed ${HOME}
+	&& awk x=1 cd local done
+	x=1 then echo && then test ${HOME} echo && awk awk awk readonly sed
+		echo cd ${HOME} 'quoted text' grep test awk -eu grep printf
+--verbose 'quoted text' awk | cd local /usr/bin
+		grep $(pwd) $(pwd) 'quoted text' 2>/dev/null cd x=1 printf done "$1" | test
+	/usr/bin echo x=1 cd | "$@" printf readonly awk $(pwd) -eu
+		grep /usr/bin /usr/bin x=1 echo --verbose $(pwd) printf --verbose
+		local --verbose cd | grep
+readonly -eu 'quoted text' | awk then -eu awk awk echo "$1"
+awk "$1" test echo test /usr/bin "$1" | "$@"
+		x=1 grep /usr/bin local -eu readonly --verbose grep 2>/dev/null export | grep
+		&& | "$1" x=1 $(pwd) readonly 2>/dev/null echo --verbose | done
+		cd -eu cd 'quoted text' cd --verbose
+		test && export awk export echo sed "$1" test
+		awk && test printf 2>/dev/null cd --verbose
+		"$@" then printf /usr/bin echo printf sed x=1
+		/usr/bin printf x=1 test echo echo echo && readonly sed && done
+		$(pwd) cd sed | | 2>/dev/null
+cd | | done export done $(pwd) /usr/bin local done echo awk
+	cd /usr/bin done printf "$1" awk
+sed 2>/dev/null export cd awk && local
+	/usr/bin $(pwd) /usr/bin printf
+readonly readonly $(pwd) test local $(pwd)
+		--verbose local 'quoted text' "$1" "$1" x=1 && sed --verbose x=1
+	x=1 then | ${HOME} /usr/bin
+	echo readonly test "$1" echo
+	local -eu /usr/bin then awk
+		"$1" $(pwd) x=1 test && && awk "$1"
+	--verbose -eu awk 2>/dev/null local /usr/bin
+	local x=1 grep --verbose "$@"
+then then && export --verbose $(pwd) grep "$1" local echo done test done then export
+grep printf readonly local readonly sed
+		--verbose done readonly /usr/bin "$@" ${HOME} test x=1 then && readonly
+2>/dev/null "$1" then | printf --verbose export local export
+${HOME} echo ${HOME} x=1 awk 'quoted text' 'quoted text'
+		then "$@" cd test "$@" sed "$@" echo cd 'quoted text' $(pwd) --verbose
+$(pwd) printf | local local x=1 "$1" done
+	done 'quoted text' printf export -eu printf test echo ${HOME}
+	local $(pwd) test "$@" x=1 x=1 && 'quoted text' cd
+&& readonly sed 'quoted text' $(pwd) sed | grep
+/usr/bin echo "$1" "$1" -eu 'quoted text'
+	"$@" done sed $(pwd) echo cd local -eu ${HOME} then
+	cd awk $(pwd) then grep echo "$1" readonly x=1 local test cd sed
+"$@" | -eu cd /usr/bin echo grep /usr/bin x=1 2>/dev/null
+		x=1 awk -eu $(pwd) awk test printf printf
+		export "$1" grep export echo "$@" x=1 "$1" -eu
+	awk readonly local echo --verbose -eu ${HOME} "$1" cd -eu -eu ${HOME} echo
+		'quoted text' --verbose
+&& done export grep awk printf sed
+		x=1 2>/dev/null printf readonly awk
+		grep "$@" sed test && x=1 'quoted text' then && grep --verbose local
+		cd $(pwd) -eu x=1 x=1 --verbose printf done local 'quoted text' /usr/bin
+		| export "$@" /usr/bin --verbose
+		x=1 local ${HOME} "$@" local /usr/bin grep sed --verbose 2>/dev/null
+	export awk $(pwd) cd ${HOME} 2>/dev/null --verbose
+		awk local --verbose local
+		test 'quoted text' sed "$@" 'quoted text' awk echo 'quoted text' |
+'quoted text' done export readonly
+2>/dev/null test awk printf --verbose 'quoted text' cd x=1 ${HOME} local &&
+	${HOME} -eu "$1" "$1" "$@" export cd $(pwd)
+		printf --verbose sed readonly export cd /usr/bin done /usr/bin
+		"$@" | grep /usr/bin ${HOME} cd
+--verbose printf test x=1 'quoted text'
+cd then printf done awk 2>/dev/null readonly printf echo $(pwd) x=1
+		"$1" $(pwd) local 'quoted text'
+		&& cd ${HOME} printf export /usr/bin printf && "$@" ${HOME}
+	$(pwd) "$@" export readonly sed x=1 "$1" printf 2>/dev/null then "$@" local
+		grep 'quoted text' --verbose export --verbose grep --verbose --verbose done printf
+	then 2>/dev/null -eu x=1 ${HOME} /usr/bin done --verbose
+	then && export test printf "$1"
+done then printf readonly
+		awk && cd "$@" readonly ${HOME} local
+		-eu then /usr/bin test "$@"
+x=1 cd --verbose "$@" done /usr/bin grep | cd grep x=1 $(pwd)
+		readonly ${HOME} x=1 cd 2>/dev/null cd printf | /usr/bin done ${HOME} sed "$@"
+-eu echo -eu done export done "$@" "$@" readonly test --verbose x=1 grep
+| | /usr/bin test readonly
+		readonly --verbose export echo $(pwd) done export
+		x=1 x=1 -eu && 2>/dev/null | printf done ${HOME} 2>/dev/null done $(pwd)
+		test local 'quoted text' export echo 2>/dev/null "$1" 2>/dev/null $(pwd)
+echo 'quoted text' cd "$@" | echo | readonly
+then "$@" && | test echo cd done cd done
+x=1 cd 'quoted text' awk && then $(pwd)
+		awk "$@" --verbose sed then then cd awk -eu then "$1" grep
+		"$@" test test test ${HOME} cd readonly local --verbose grep | done |
+"$@" $(pwd) grep readonly printf --verbose 2>/dev/null
+		printf /usr/bin -eu then printf x=1 'quoted text' done local "$@"
+-eu x=1 "$@" 2>/dev/null done "$1" "$1" "$@" export "$1" 'quoted text' 'quoted text'
+		local local "$@" grep --verbose 2>/dev/null
+		local && "$1" "$@" "$@" "$@" $(pwd) --verbose
+readonly test | "$@" cd sed readonly
+		'quoted text' && ${HOME}
+sed -eu "$@" done export readonly
+	--verbose local echo test --verbose
+	'quoted text' "$1" "$@" 'quoted text' "$@" readonly then grep test test 2>/dev/null
+		/usr/bin readonly -eu printf ${HOME}
+		done "$@" cd x=1 --verbose cd cd $(pwd) && then readonly x=1 "$@" done "$@" --verbose
+	--verbose 2>/dev/null "$1" x=1 sed done "$@" /usr/bin printf echo -eu "$@" local
+		done "$1" grep "$1" 'quoted text' 'quoted text'
+	&& && done "$@" then ${HOME} readonly cd && && cd | sed then $(pwd)
+	2>/dev/null 'quoted text'
+		test then | echo $(pwd) "$@" "$@" ${HOME}
+	export $(pwd) awk grep sed local "$@" awk -eu | /usr/bin
+		export 'quoted text' cd $(pwd) | /usr/bin local printf
+		grep printf x=1 "$@" x=1 readonly grep ${HOME}
+		| done grep echo export
+	echo 'quoted text' export | 'quoted text' $(pwd) x=1 $(pwd)
+/usr/bin 'quoted text' && /usr/bin then x=1
+	-eu readonly "$@" 2>/dev/null
+${HOME} grep -eu 'quoted text' x=1 $(pwd) | x=1 export x=1 2>/dev/null
+		cd readonly "$1" test $(pwd)
+		$(pwd) ${HOME} echo 'quoted text' 'quoted text' test
+&& x=1 test then 'quoted text' | done
+	-eu sed $(pwd) --verbose && sed "$1" awk x=1 $(pwd) && echo local
+		| --verbose test export then 2>/dev/null --verbose && export &&
+		sed ${HOME} x=1 2>/dev/null export | done awk sed 'quoted text' ${HOME} /usr/bin
+		sed && "$1" 2>/dev/null test then sed "$@" test grep /usr/bin sed && readonly /usr/bin
+grep awk grep awk test 'quoted text' 2>/dev/null -eu /usr/bin --verbose
+/usr/bin readonly readonly
+"$1" done printf /usr/bin awk cd 'quoted text'
+cd then --verbose grep "$1" local then "$@"
+	&& x=1 $(pwd) export ${HOME} printf
+		awk --verbose 2>/dev/null && "$1"
+-eu grep echo test then --verbose
+		'quoted text' "$1" done | printf grep $(pwd) $(pwd) -eu | --verbose test
+		$(pwd) 'quoted text' done $(pwd) local $(pwd) x=1 done "$1" x=1 "$@" | echo
+	readonly 2>/dev/null "$@"
+	-eu -eu export grep 2>/dev/null readonly "$@" $(pwd)
+		echo ${HOME} test "$1" "$1" done 2>/dev/null ${HOME} x=1 "$1" | $(pwd)
+		$(pwd) grep && $(pwd) test done --verbose awk | then readonly --verbose
+then x=1 awk --verbose --verbose -eu /usr/bin x=1 printf
+	test export cd && echo then done then sed grep x=1 local | x=1 export
+test x=1 && then && -eu | --verbose local --verbose local then awk
+	&& "$@" cd | 'quoted text'
+		| cd /usr/bin && /usr/bin 2>/dev/null grep
+		x=1 sed test test export 'quoted text' $(pwd) 'quoted text' export
+awk --verbose then awk sed done printf
+		${HOME} test 'quoted text' then sed cd
+&& then "$1" echo "$1" test "$@" /usr/bin && readonly printf /usr/bin export 'quoted text'
+awk ${HOME} && 'quoted text' $(pwd) then done
+		then sed $(pwd) printf --verbose | then cd sed /usr/bin export "$1"
+		| printf done then export --verbose && cd "$@" -eu && x=1 echo grep
+2>/dev/null export -eu export sed "$@"
+		awk local done 'quoted text'
+		awk 'quoted text' done awk printf echo readonly -eu done
+		"$1" && "$1" sed | "$1" /usr/bin echo 'quoted text' --verbose
+		"$1" -eu readonly | "$1" $(pwd) --verbose "$@" test 'quoted text'
+-eu 2>/dev/null awk done ${HOME} then --verbose -eu ${HOME}
+		readonly export "$@" 'quoted text' printf | -eu
+		/usr/bin echo grep local done grep export 2>/dev/null then sed 2>/dev/null
+		x=1 cd --verbose awk done echo 2>/dev/null then x=1
+		local 2>/dev/null "$@" 2>/dev/null $(pwd) sed x=1 /usr/bin x=1 sed "$@" local
+		echo --verbose ${HOME} echo readonly 'quoted text' --verbose sed grep -eu --verbose
+	export "$@" local | | -eu "$1" --verbose grep 2>/dev/null -eu -eu && 'quoted text'
+	test 2>/dev/null | ${HOME} "$1" 2>/dev/null /usr/bin --verbose local 'quoted text'
+		awk test done $(pwd) "$@" then x=1 echo x=1 /usr/bin awk
+	--verbose grep sed cd then test local x=1 export $(pwd) 'quoted text'
+	printf readonly | grep readonly "$@" | && x=1 x=1 ${HOME}
+		readonly -eu test local done local test then
+		--verbose cd -eu "$@" local cd echo done --verbose readonly sed printf then
+	export 2>/dev/null /usr/bin
+| -eu then echo local cd grep "$@" /usr/bin
+		test local /usr/bin then awk --verbose 2>/dev/null
+local "$@" /usr/bin cd export -eu 'quoted text' sed local "$1"
+${HOME} | grep /usr/bin $(pwd) printf && "$1" | -eu test then /usr/bin
+	then "$1" echo cd /usr/bin 2>/dev/null readonly
+	| 2>/dev/null readonly x=1 x=1 cd cd | "$1" ${HOME}
+		grep --verbose | cd done done grep "$1" 2>/dev/null then 2>/dev/null && echo
+	echo test echo local $(pwd) grep /usr/bin printf 'quoted text'
+	echo grep cd "$1" readonly "$1" && $(pwd)
+x=1 'quoted text' /usr/bin x=1 /usr/bin /usr/bin ${HOME} "$@" sed sed
+		"$@" -eu cd /usr/bin $(pwd) -eu x=1 "$@" /usr/bin --verbose -eu sed
+		printf grep ${HOME} "$1" awk awk done -eu x=1 'quoted text'
+	done 'quoted text' 2>/dev/null cd test 'quoted text' then echo ${HOME} 'quoted text'
+local /usr/bin then "$1" ${HOME} export printf $(pwd) sed
+	awk then local echo test printf x=1 printf readonly
+	then --verbose 2>/dev/null printf ${HOME}
+	&& done ${HOME} awk cd -eu test && readonly awk awk then
+		export printf && sed 'quoted text' cd
+| 'quoted text' 'quoted text' test "$1" test -eu $(pwd) x=1
+	"$1" then done readonly ${HOME} 2>/dev/null 'quoted text'
+"$1" printf export echo "$1"
+	done readonly x=1 then awk "$@" sed "$1" echo $(pwd) sed "$1" "$1" $(pwd)
+sed cd then 2>/dev/null grep
+awk x=1 --verbose --verbose x=1 2>/dev/null "$@" "$1" cd readonly --verbose
+awk x=1 echo test /usr/bin "$@" test --verbose echo && grep local 2>/dev/null
+-eu test test grep 2>/dev/null -eu test readonly "$1" grep test
+		"$1" readonly printf ${HOME} | ${HOME}
+	-eu test export x=1 ${HOME} sed $(pwd) awk sed $(pwd) then
+	readonly cd printf | | done /usr/bin sed "$@" --verbose /usr/bin
+printf awk /usr/bin x=1 "$1" | |
+		--verbose test export readonly grep
+	$(pwd) "$@" --verbose printf "$1" printf cd $(pwd)
+	${HOME} "$1" -eu readonly --verbose test readonly local readonly && 2>/dev/null
+		done test sed && ${HOME} done grep "$@" --verbose grep -eu "$@"
+	printf awk x=1 grep "$1" sed -eu export then printf 'quoted text'
+	--verbose 'quoted text' grep grep sed ${HOME}
+		printf awk x=1 "$1" "$@" echo | -eu "$1" $(pwd) 2>/dev/null
+x=1 test test sed then 'quoted text' local 'quoted text' /usr/bin |
+		sed export echo ${HOME} $(pwd) -eu readonly sed
+	readonly 'quoted text' && echo
+	x=1 $(pwd) local local "$@" export &&
+		printf -eu then -eu export x=1 | 2>/dev/null
+		2>/dev/null 2>/dev/null /usr/bin
+		sed test | --verbose --verbose "$@" awk echo grep local x=1 readonly x=1
+echo ${HOME} export 'quoted text' --verbose cd "$@" | local 2>/dev/null cd export
+	2>/dev/null "$@" -eu awk 'quoted text' done "$@" cd done
+	sed /usr/bin readonly
+export && ${HOME} "$@" && sed echo 'quoted text' awk readonly "$@" export --verbose
+		&& "$1" test printf "$1" && printf sed && sed "$@" local done
+	then "$1" "$1" /usr/bin -eu x=1 /usr/bin | printf
+		"$@" echo readonly -eu done cd -eu "$@" grep local x=1 'quoted text'
+sed | -eu done ${HOME} done |
+"$@" awk cd export awk local -eu 'quoted text'
+	sed test x=1 awk "$1" echo printf $(pwd) then local --verbose
+	"$1" 2>/dev/null $(pwd) ${HOME} grep printf && $(pwd) -eu
+	"$@" then "$1" test then "$1" --verbose ${HOME} && "$@" "$@" ${HOME} x=1 echo &&
+	"$@" printf ${HOME} then "$1" done /usr/bin
+	x=1 readonly "$@" "$@" 'quoted text'
+		awk x=1 "$1" cd ${HOME} printf echo ${HOME} x=1 cd "$1" cd
+| local -eu readonly 2>/dev/null
+		local local 2>/dev/null 2>/dev/null local x=1 test /usr/bin done sed
+		cd "$1" 'quoted text' readonly $(pwd) "$1" local readonly --verbose $(pwd)
+		/usr/bin | x=1 test "$1" /usr/bin "$1"
+then "$@" 2>/dev/null test --verbose ${HOME}
+		readonly export x=1 printf && | export grep
+		'quoted text' $(pwd) done $(pwd) then echo local 2>/dev/null 2>/dev/null 2>/dev/null
+	2>/dev/null sed done awk export sed export export
+	export cd "$1" awk 'quoted text' "$@" done "$1" ${HOME} && x=1
+x=1 sed --verbose readonly 'quoted text'
+local test | $(pwd) local readonly test -eu "$1" $(pwd) x=1 cd sed
+		awk "$1" 'quoted text' "$@" grep sed 2>/dev/null
+		&& echo && $(pwd) && readonly $(pwd) test -eu test && done export -eu 'quoted text'
+'quoted text' grep readonly && && echo
+	local echo readonly cd awk "$1" awk 2>/dev/null cd | test 2>/dev/null
+	"$1" -eu "$1" 2>/dev/null local
+		--verbose 'quoted text' | --verbose awk $(pwd) local echo 'quoted text'
+	sed readonly x=1 x=1 cd awk cd test export | --verbose x=1
+		| | 'quoted text' /usr/bin && ${HOME} sed printf done then readonly $(pwd)
+	echo local cd "$@" x=1 sed readonly /usr/bin done
+		&& x=1 then sed --verbose echo done readonly "$1" 'quoted text'
+		then "$@" && sed "$1" | done -eu "$@" sed local
+		printf awk cd cd test echo
+		$(pwd) $(pwd) test cd local done grep $(pwd) test
+		2>/dev/null cd "$1" | then | -eu "$1" awk ${HOME}
+		printf sed ${HOME} --verbose ${HOME} 2>/dev/null
+	"$@" test printf 'quoted text' --verbose printf ${HOME}
+		'quoted text' export /usr/bin "$1" readonly x=1 cd done /usr/bin
+'quoted text' -eu grep export readonly sed 2>/dev/null cd export
+sed -eu test grep "$1" | $(pwd) echo 2>/dev/null sed -eu sed done
+	local 'quoted text' $(pwd) sed "$@" ${HOME}
+	'quoted text' $(pwd) export -eu "$@" "$@" /usr/bin "$1" 2>/dev/null
+	echo "$1" echo -eu readonly
+$(pwd) /usr/bin export ${HOME} ${HOME} awk && printf && cd 'quoted text'
+local echo "$1" printf then cd $(pwd) | printf && ${HOME} local | ${HOME}
+	done printf readonly cd readonly
+2>/dev/null readonly "$@" then printf 2>/dev/null /usr/bin
+printf then ${HOME} /usr/bin | echo 2>/dev/null
+/usr/bin echo sed awk export test done
+	sed 'quoted text' printf readonly cd printf cd echo -eu -eu $(pwd) done sed local
+	readonly cd cd printf echo 'quoted text' --verbose --verbose
+--verbose ${HOME} sed 2>/dev/null 'quoted text' done test
+-eu "$1" 2>/dev/null grep "$1" readonly readonly
+	$(pwd) printf sed readonly sed
+	x=1 'quoted text' grep echo cd "$1" $(pwd) | awk echo
+--verbose -eu cd 2>/dev/null echo ${HOME} sed -eu /usr/bin cd "$1" readonly
+	| -eu $(pwd) --verbose ${HOME} | && then local
+/usr/bin x=1 $(pwd) "$@" awk ${HOME} then export
+		awk awk readonly x=1 'quoted text' "$@" done local
+/usr/bin done && "$1" --verbose awk then x=1 export test $(pwd) awk test
+		done export awk "$@" awk readonly "$@" /usr/bin 2>/dev/null
+	awk ${HOME} 'quoted text' 2>/dev/null awk && printf -eu export test
+	x=1 readonly grep 2>/dev/null "$1" printf echo --verbose
+	'quoted text' done "$@" test then test sed test "$1" && readonly printf local
+'quoted text' && grep -eu $(pwd) grep test 2>/dev/null cd readonly
+		'quoted text' /usr/bin /usr/bin -eu |
+		test echo echo 'quoted text' then done $(pwd) | printf
+		${HOME} sed x=1 awk "$@" x=1
+		&& && | readonly printf | readonly "$1" -eu "$1" echo test ${HOME} /usr/bin
+$(pwd) done 'quoted text' awk printf | | export --verbose && $(pwd)
+	then 'quoted text' | "$1" ${HOME} printf echo readonly
+| printf -eu -eu done 'quoted text'
+		test awk done readonly sed then x=1 grep test ${HOME}
+	awk 2>/dev/null 2>/dev/null done local export
+cd x=1 then x=1 printf --verbose && sed ${HOME} export -eu readonly
+test test done "$1" echo "$@" done cd 'quoted text'
+	"$1" "$@" grep local ${HOME} readonly "$1" awk | 2>/dev/null
+		-eu grep then printf grep local | && ${HOME} 2>/dev/null
+		grep $(pwd) 2>/dev/null | 'quoted text' ${HOME} ${HOME}
+	sed test "$@" done done | cd | cd then 'quoted text'
+	x=1 x=1 test then "$@" local export
+		x=1 ${HOME} -eu cd grep "$1" echo grep
+	awk 'quoted text' printf grep "$@" test -eu "$1" local export "$1"
+		x=1 printf export export | then awk echo $(pwd)
+	echo | --verbose cd awk -eu /usr/bin echo test 2>/dev/null test then
+		sed && x=1 then done readonly $(pwd) ${HOME} printf
+	${HOME} | --verbose ${HOME} ${HOME} --verbose printf /usr/bin
+	"$@" done printf awk cd && /usr/bin readonly printf export &&
+printf done "$1" export 2>/dev/null ${HOME} done grep "$1" done
+		sed grep 'quoted text'
+	&& && 2>/dev/null && sed && "$1"
+	echo "$@" ${HOME} 2>/dev/null readonly ${HOME}
+		grep echo /usr/bin --verbose /usr/bin then cd test 'quoted text'
+		'quoted text' done export sed test then | then $(pwd) /usr/bin echo | "$1" | readonly
+	done awk 'quoted text' --verbose
+grep done sed printf done "$1" "$1" export $(pwd)
+--verbose local && test /usr/bin cd export echo
+	cd ${HOME} local 'quoted text'
+		&& done readonly -eu test echo
+export grep 2>/dev/null printf local awk readonly /usr/bin /usr/bin
+		${HOME} --verbose test cd test | printf "$1" printf awk readonly
+	2>/dev/null awk | echo && | local "$1" 'quoted text' 2>/dev/null
+		awk test && awk sed -eu sed
+sed | && $(pwd) local sed /usr/bin --verbose readonly
+		cd x=1 'quoted text' && -eu --verbose test
+		printf sed sed ${HOME} export readonly x=1 x=1
+test --verbose cd "$@" | export $(pwd) x=1 'quoted text' -eu done
+| $(pwd) x=1 'quoted text' test test ${HOME} 'quoted text'
+	'quoted text' sed awk echo test "$1" local $(pwd) sed ${HOME} printf cd echo ${HOME}
+		/usr/bin cd sed "$@" sed done --verbose | "$1" $(pwd)
+	-eu x=1 x=1 --verbose ${HOME} test echo then 2>/dev/null 'quoted text'
+	then export sed cd 2>/dev/null awk 'quoted text' grep ${HOME} --verbose
+awk "$@" "$@" /usr/bin
+then grep "$1" /usr/bin --verbose
+		export test export export /usr/bin 'quoted text'
+	${HOME} printf | "$@" $(pwd) echo 2>/dev/null cd then /usr/bin echo x=1 "$@"
+		sed "$@" local --verbose | echo
+		cd ${HOME} done /usr/bin local "$1" && local $(pwd) test x=1 x=1 "$@" | |
+sed done cd $(pwd) "$1" x=1 echo sed && 'quoted text'
+	2>/dev/null | test sed
+	grep --verbose -eu then test printf ${HOME} 2>/dev/null
+	awk local cd cd test && 'quoted text'
+		export $(pwd) test readonly && export awk printf sed awk 2>/dev/null test then
+		echo sed test test -eu sed readonly
+		&& "$1" | printf local then sed sed "$1" echo sed 2>/dev/null
+		$(pwd) "$1" export sed done sed 2>/dev/null | 'quoted text'
+	${HOME} ${HOME} 'quoted text' done && ${HOME} | x=1 export
+		&& $(pwd) -eu sed done
+	"$1" readonly $(pwd) awk ${HOME} export done
+sed --verbose --verbose test /usr/bin then 'quoted text'
+| --verbose done test $(pwd)
+test cd "$1" local /usr/bin grep awk echo /usr/bin
+echo done "$1" done done -eu "$@" 'quoted text'
+	${HOME} | | --verbose local sed x=1 $(pwd) cd
+		/usr/bin then sed grep grep local local grep
+| grep done then -eu --verbose -eu 'quoted text'
+	&& && /usr/bin && echo echo x=1 "$@"
+	export -eu x=1 "$@" echo 'quoted text' ${HOME} --verbose | && export
+	/usr/bin test && x=1 'quoted text' local x=1
+	2>/dev/null export then $(pwd) 'quoted text'
+	test printf done | -eu local "$@" local 'quoted text' "$@" cd |
+	sed "$1" printf readonly 'quoted text'
+	cd -eu sed then $(pwd) $(pwd) -eu printf --verbose sed 2>/dev/null 2>/dev/null
+export /usr/bin echo && 'quoted text' printf 2>/dev/null ${HOME}
+	&& | grep 2>/dev/null
+		2>/dev/null export 2>/dev/null cd /usr/bin readonly test
+		$(pwd) -eu /usr/bin cd ${HOME} grep grep printf sed readonly
+	awk grep then x=1 $(pwd)
+2>/dev/null --verbose grep x=1 -eu /usr/bin local echo
+readonly sed $(pwd) 2>/dev/null grep
+	test local readonly cd cd 2>/dev/null
+		2>/dev/null x=1 --verbose echo 2>/dev/null && sed $(pwd)
+then ${HOME} $(pwd) cd "$1" local "$@" "$@" 2>/dev/null sed
+/usr/bin then 'quoted text' /usr/bin sed && export
+		cd readonly x=1 grep
+then sed "$1" cd printf awk && test
+	--verbose readonly 2>/dev/null --verbose sed done x=1 | /usr/bin local
+	awk grep cd /usr/bin test -eu local $(pwd) x=1 | grep
+-eu && && ${HOME} grep "$1" awk "$@" ${HOME}
+		"$@" awk "$@" x=1 then cd -eu printf export
+	local export export $(pwd)
+	&& 2>/dev/null local 2>/dev/null local x=1 export then "$1" export && test "$1"
+--verbose && printf /usr/bin -eu echo readonly /usr/bin grep
+| "$1" && done ${HOME} /usr/bin /usr/bin x=1 grep $(pwd) 2>/dev/null &&
+	"$@" | test 'quoted text' "$1" | $(pwd) && "$@" $(pwd) "$@" then awk -eu export
+		printf readonly x=1 ${HOME}
+	&& | "$@" | test ${HOME} sed "$@" ${HOME}
+	--verbose --verbose && && 2>/dev/null sed local grep /usr/bin -eu 2>/dev/null
+	local readonly echo awk awk
+test ${HOME} grep sed local printf && 'quoted text' && "$1" echo done
+		$(pwd) --verbose | -eu
+		x=1 cd done echo done x=1 readonly then awk readonly && sed $(pwd)
+	done $(pwd) done cd --verbose 'quoted text' "$1"
+	test 2>/dev/null ${HOME} --verbose -eu "$1" -eu readonly $(pwd) ${HOME} "$1"
+	printf "$@" readonly grep done awk /usr/bin
+	/usr/bin test sed | export "$1" export 'quoted text' 'quoted text' done /usr/bin
+		awk awk sed sed "$1" x=1 local export
+readonly test then grep echo $(pwd) && sed cd awk awk
+'quoted text' "$1" awk local "$1" awk cd done awk "$@" ${HOME}
+	/usr/bin sed 2>/dev/null awk "$@" test done done then cd ${HOME} echo
+	awk done export $(pwd) sed 2>/dev/null sed echo /usr/bin local then 2>/dev/null
+		local 'quoted text' local cd ${HOME} /usr/bin
+	/usr/bin /usr/bin ${HOME} 2>/dev/null
+	-eu -eu && /usr/bin test
+		local export $(pwd) /usr/bin 'quoted text'
+		grep "$1" ${HOME} export --verbose && | --verbose
+'quoted text' echo echo "$@" awk 2>/dev/null grep sed awk
+/usr/bin then --verbose "$@" readonly test export sed
+done -eu 'quoted text' | printf "$1" cd sed readonly -eu "$1" $(pwd) 2>/dev/null
+sed sed ${HOME} && $(pwd) cd --verbose
+test --verbose $(pwd) sed "$1" "$@" printf echo
+	readonly ${HOME} awk done ${HOME} local local export
+		-eu x=1 | "$1" /usr/bin
+	${HOME} -eu readonly "$@" echo "$1" 2>/dev/null "$1" | test --verbose "$1"
+		done done test grep /usr/bin --verbose sed
+		echo sed "$1" echo x=1 cd echo
+		&& x=1 2>/dev/null --verbose 'quoted text' 'quoted text'
+	grep sed --verbose 'quoted text' | awk local |
+		-eu && | ${HOME} --verbose "$@" 2>/dev/null 'quoted text' 'quoted text'
+		${HOME} "$@" | | then /usr/bin "$1" readonly
+/usr/bin && $(pwd) then grep export 2>/dev/null awk 'quoted text' -eu printf
+local --verbose --verbose local sed printf
+	local 'quoted text' "$1" "$@" ${HOME} printf |
+	test readonly "$1" done 'quoted text' echo test export | sed | then
+		| 'quoted text' printf "$@" "$1"
+		echo readonly printf sed awk done awk "$@"
+	awk sed done readonly 'quoted text'
+sed done ${HOME} 'quoted text' readonly
+		readonly local /usr/bin /usr/bin $(pwd) done
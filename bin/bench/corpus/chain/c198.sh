@@ -0,0 +1,2001 @@
+done "$1" ${HOME} ${HOME} 'quoted text' echo && printf readonly x=1 "$@"
+	awk grep awk -eu "$1" readonly sed printf done 'quoted text' readonly grep
+	then readonly -eu export grep cd -eu done cd readonly && readonly
+		| sed grep -eu grep export cd -eu printf -eu && | cd sed "$1" 2>/dev/null
+	cd -eu "$1" ${HOME} | sed printf grep
+test local ${HOME} && /usr/bin $(pwd) "$@"
+${HOME} /usr/bin printf then --verbose 2>/dev/null awk ${HOME}
+		| x=1 echo "$1" 2>/dev/null /usr/bin grep then $(pwd) 2>/dev/null
+test test readonly "$1" "$1" "$@" export $(pwd) --verbose export
+	awk then && sed -eu printf
+	--verbose | done ${HOME}
+'quoted text' ${HOME} cd "$@" export awk export --verbose sed printf x=1 $(pwd)
+&& grep 'quoted text' test "$@" local |
+		-eu "$1" export /usr/bin $(pwd) export printf ${HOME} export $(pwd) && sed $(pwd)
+		echo "$1" printf "$1" 'quoted text' "$@" then
+		2>/dev/null echo ${HOME} ${HOME} done && "$1"
+	then ${HOME} sed | 'quoted text' "$1" export /usr/bin && local cd && then
+		test --verbose "$1" --verbose 'quoted text' $(pwd) readonly -eu
+	/usr/bin export /usr/bin $(pwd) "$@" $(pwd)
+grep "$1" /usr/bin x=1 done cd 'quoted text'
+	| /usr/bin echo /usr/bin 'quoted text' cd -eu
+| awk x=1 ${HOME} printf awk && grep 'quoted text' --verbose local 'quoted text'
+	| 2>/dev/null ${HOME}
+${HOME} cd test printf grep 'quoted text' local echo cd ${HOME} local | 2>/dev/null
+	"$@" grep local "$1" | awk "$@"
+	'quoted text' -eu awk && sed --verbose && | done readonly
+		"$1" /usr/bin $(pwd) 'quoted text' "$@" "$@" awk -eu "$1" echo -eu grep 2>/dev/null
+	local "$1" $(pwd) "$@" awk | echo && cd awk
+"$@" awk -eu local ${HOME} | 'quoted text'
+	x=1 x=1 $(pwd) "$1" then grep readonly
+--verbose awk x=1 export then done grep "$@" export "$@" "$1" /usr/bin
+	| $(pwd) readonly sed local
+		then /usr/bin 2>/dev/null sed test readonly && test readonly
+x=1 $(pwd) x=1 printf "$1" | test test "$1" $(pwd) $(pwd)
+	x=1 readonly done then readonly sed echo "$@"
+	then cd export echo $(pwd) $(pwd) readonly local ${HOME} | ${HOME} $(pwd) --verbose
+		then grep readonly awk done then && awk ${HOME} cd grep local $(pwd) sed 'quoted text'
+2>/dev/null printf /usr/bin sed 2>/dev/null "$@" $(pwd) echo x=1 grep done &&
+	2>/dev/null then export sed export done $(pwd) echo test local printf 2>/dev/null
+		-eu -eu -eu printf printf /usr/bin && readonly
+		printf test export awk -eu printf 2>/dev/null "$@" readonly local
+--verbose --verbose --verbose then $(pwd) sed done then awk
+	awk then cd test printf --verbose -eu sed x=1 --verbose local
+cd sed sed /usr/bin 2>/dev/null /usr/bin grep
+		sed ${HOME} /usr/bin echo -eu -eu "$@" test ${HOME} export 'quoted text'
+		done done "$@" then ${HOME} cd echo x=1 "$@" 'quoted text'
+		printf sed "$@" export local /usr/bin local printf test
+	--verbose export readonly readonly $(pwd)
+${HOME} done | grep ${HOME} export 'quoted text' && x=1 printf test "$1"
+readonly 'quoted text'
+	printf test local ${HOME} sed done $(pwd) ${HOME} && | 2>/dev/null done then
+	-eu "$1" 'quoted text' test sed awk
+	echo $(pwd) sed "$1" 2>/dev/null
+--verbose | x=1 $(pwd) x=1 && readonly /usr/bin grep ${HOME} 'quoted text'
+	echo "$1" --verbose sed -eu 2>/dev/null printf
+	export export readonly
+		then /usr/bin export && export --verbose export | --verbose then awk
+		echo grep then --verbose printf
+/usr/bin 2>/dev/null local x=1 ${HOME}
+	then 2>/dev/null && export "$@" "$@" |
+	cd "$@" | | /usr/bin x=1 -eu x=1
+-eu | cd then -eu ${HOME} "$1" local /usr/bin 'quoted text' x=1 2>/dev/null sed
+		"$@" "$@" 2>/dev/null 2>/dev/null x=1 $(pwd) -eu $(pwd) awk sed |
+		echo x=1 x=1 printf /usr/bin "$1" --verbose grep cd cd -eu
+test $(pwd) export then |
+readonly local $(pwd) export 'quoted text' ${HOME} ${HOME}
+	done 'quoted text' 2>/dev/null 2>/dev/null
+"$@" ${HOME} -eu x=1 x=1 --verbose
+	printf | local 'quoted text' | ${HOME} readonly ${HOME} -eu awk
+local test "$1" ${HOME} "$1" x=1 --verbose --verbose x=1 -eu local export
+		cd x=1 then test 'quoted text' cd test grep readonly done $(pwd)
+done done sed | -eu 2>/dev/null /usr/bin export
+local ${HOME} x=1 && grep "$1" cd test echo x=1 | then cd
+then test done cd --verbose "$@" sed local export readonly echo sed ${HOME} /usr/bin
+cd 2>/dev/null test readonly grep && | ${HOME}
+		test && export echo && --verbose x=1 printf awk local cd | x=1 | cd readonly x=1
+| sed printf test printf $(pwd) --verbose printf export export
+	then -eu test sed done "$@" 2>/dev/null sed sed 2>/dev/null
+$(pwd) "$@" x=1 "$@" sed sed echo local
+	--verbose awk 'quoted text' /usr/bin 2>/dev/null
+'quoted text' then test
+		"$1" --verbose test x=1 -eu "$@" ${HOME} x=1 export x=1 sed then
+	export $(pwd) then then done ${HOME} local sed | "$1" | export printf | -eu
+echo /usr/bin 2>/dev/null readonly
+printf then 'quoted text' "$@" | -eu then 'quoted text'
+-eu -eu echo ${HOME} | --verbose && then x=1 done
+--verbose cd awk 2>/dev/null 'quoted text'
+$(pwd) 2>/dev/null -eu
+local && /usr/bin "$1"
+	"$1" local sed 2>/dev/null sed ${HOME} then
+	sed | 2>/dev/null /usr/bin readonly && sed /usr/bin && local echo
+		${HOME} "$@" sed done | then 2>/dev/null /usr/bin "$@" && awk $(pwd) 'quoted text'
+		2>/dev/null echo /usr/bin | $(pwd) "$1"
+		--verbose --verbose -eu test sed
+	cd awk $(pwd) test printf x=1 "$1" local --verbose /usr/bin --verbose echo x=1 |
+		sed 'quoted text' export ${HOME} then local local
+		${HOME} "$@" local then grep done local test then cd &&
+		"$1" --verbose "$1" && ${HOME} && awk sed
+done readonly echo export "$1" 'quoted text' "$@" then
+		grep && "$1" sed echo export grep printf awk && x=1 2>/dev/null
+		cd export $(pwd) export readonly x=1 2>/dev/null sed done
+	readonly x=1 'quoted text' grep | local "$1" export local "$@" ${HOME} sed grep
+${HOME} 'quoted text' grep "$1" readonly && && sed --verbose
+		awk ${HOME} "$@" --verbose 'quoted text' /usr/bin ${HOME} x=1 done
+	&& -eu "$@" 'quoted text' $(pwd) test 2>/dev/null printf
+	${HOME} 'quoted text' "$1" "$1" --verbose
+		local readonly $(pwd) /usr/bin readonly
+	-eu $(pwd) sed ${HOME} | "$@" awk awk ${HOME} -eu cd awk $(pwd) --verbose
+	sed "$1" readonly printf echo grep grep awk "$1" $(pwd) done "$@" "$@"
+	readonly /usr/bin ${HOME} printf printf "$1" 2>/dev/null 'quoted text' x=1 readonly
+		awk x=1 sed readonly x=1 && readonly export printf grep test
+	--verbose sed printf $(pwd) --verbose
+2>/dev/null readonly && 'quoted text'
+sed sed x=1 "$@" echo local $(pwd) sed -eu printf
+"$1" /usr/bin local --verbose test local done "$@"
+		local /usr/bin --verbose then grep -eu
+"$@" x=1 awk cd x=1 "$@" $(pwd) 2>/dev/null done x=1 /usr/bin
+	&& && export printf then awk 2>/dev/null
+	2>/dev/null /usr/bin sed then grep sed "$1" | echo | cd local awk test printf
+cd ${HOME} printf cd printf test --verbose -eu -eu --verbose
+test done -eu x=1 local -eu -eu local
+	local then grep readonly | $(pwd) then then $(pwd)
+		test cd awk | awk "$1" x=1
+	/usr/bin readonly && "$@" | then local export done | done sed grep local
+	local local grep 'quoted text' ${HOME} cd echo | printf cd readonly test |
+local | -eu -eu "$@" readonly && cd /usr/bin cd -eu sed then then cd
+		done 'quoted text' grep "$1" echo local "$1"
+		done | then -eu cd && "$1"
+	"$@" grep printf printf readonly cd | sed awk $(pwd)
+x=1 then grep $(pwd) sed --verbose
+readonly 'quoted text' echo "$1" 2>/dev/null grep && | test --verbose export
+	cd test -eu -eu "$@" x=1 export
+	--verbose local echo "$1" "$1" export done |
+	--verbose | sed && "$1" --verbose grep
+done --verbose export cd x=1 printf local -eu then
+done test -eu | "$1" sed local /usr/bin | readonly 2>/dev/null
+	readonly echo readonly /usr/bin sed $(pwd) x=1 export grep
+readonly 'quoted text' local 2>/dev/null done $(pwd) readonly
+		cd 2>/dev/null test x=1 -eu "$@" "$1" x=1 --verbose 'quoted text' 'quoted text'
+	readonly "$@" printf | && x=1 -eu ${HOME} --verbose -eu $(pwd)
+		then awk cd printf export
+x=1 'quoted text' test cd --verbose 'quoted text'
+--verbose export x=1 export local 'quoted text' | && | local && 2>/dev/null
+"$@" --verbose --verbose "$1" /usr/bin 2>/dev/null awk grep
+		$(pwd) | $(pwd) echo sed export test cd printf sed x=1 -eu grep ${HOME}
+		local ${HOME} readonly readonly /usr/bin --verbose "$1" then -eu test grep
+local printf echo && "$1" "$1" readonly
+		/usr/bin done readonly 'quoted text' | ${HOME} sed grep local cd x=1 test
+then 2>/dev/null ${HOME} --verbose && /usr/bin echo "$@"
+		grep grep test x=1 'quoted text' printf 'quoted text' x=1 local
+-eu && echo "$@" local sed readonly ${HOME} 2>/dev/null x=1 done done && --verbose
+		"$1" $(pwd) sed awk "$1" "$1" awk --verbose
+test 'quoted text' x=1 "$1" $(pwd) "$1"
+	cd /usr/bin local readonly -eu x=1 $(pwd) && 'quoted text' "$1" x=1 "$@" echo
+printf local done awk "$@" cd then ${HOME} /usr/bin
+	&& "$@" -eu | local awk 2>/dev/null awk readonly x=1 then --verbose export
+printf printf test 2>/dev/null ${HOME} && sed -eu sed ${HOME} done test && x=1
+$(pwd) readonly readonly readonly
+		printf "$@" echo ${HOME} readonly /usr/bin test
+		then printf local readonly /usr/bin $(pwd) grep printf local ${HOME} $(pwd)
+x=1 "$1" printf test x=1 $(pwd) x=1 awk && readonly && cd
+		cd | then then echo grep
+'quoted text' --verbose
+local 'quoted text' test awk x=1 export done readonly
+&& $(pwd) cd x=1 local sed readonly -eu /usr/bin test -eu -eu "$@" test
+	--verbose 'quoted text' grep then --verbose -eu awk echo | then echo echo echo
+		then --verbose export local
+sed echo && awk | 'quoted text' test
+		done && readonly grep then x=1 readonly "$@" $(pwd) && --verbose
+grep printf test done 2>/dev/null -eu local 'quoted text' "$1" 2>/dev/null local
+	2>/dev/null /usr/bin --verbose echo --verbose --verbose && test 2>/dev/null
+echo && -eu echo -eu "$@" 2>/dev/null
+		"$@" grep -eu 2>/dev/null $(pwd) echo 'quoted text' /usr/bin x=1 test -eu readonly
+sed /usr/bin ${HOME} test ${HOME} "$@"
+&& test printf readonly "$1" x=1 ${HOME} && "$1"
+		grep 2>/dev/null | printf local ${HOME} $(pwd)
+		/usr/bin "$1" x=1 && x=1 ${HOME} readonly local && --verbose 'quoted text'
+		export export export 'quoted text'
+	local "$@" -eu done sed /usr/bin readonly awk local printf done "$@"
+export x=1 --verbose
+done "$1" then x=1 printf done 'quoted text' --verbose done
+printf -eu "$1" -eu /usr/bin "$1" /usr/bin done x=1 'quoted text'
+x=1 awk then && /usr/bin echo readonly readonly grep cd printf then local done x=1
+		x=1 readonly printf local -eu awk 2>/dev/null
+	x=1 -eu x=1 "$@" sed sed && sed --verbose awk grep readonly "$@" test | local
+		/usr/bin readonly | local "$@" done 2>/dev/null
+		x=1 "$@" grep --verbose local x=1
+	--verbose then "$@" && done done sed
+		echo x=1 && export -eu readonly printf "$@" cd test $(pwd) printf /usr/bin
+readonly ${HOME} 'quoted text' test awk 2>/dev/null awk done
+		readonly sed --verbose sed 2>/dev/null --verbose
+		-eu && cd x=1 --verbose sed --verbose sed awk && /usr/bin 2>/dev/null awk then
+		| then -eu ${HOME} printf $(pwd) && "$@" 'quoted text' $(pwd) ${HOME} ${HOME}
+--verbose export x=1 cd | awk printf "$1" printf | sed | "$@"
+'quoted text' readonly $(pwd)
+readonly then "$@" 'quoted text' /usr/bin $(pwd)
+		${HOME} | readonly /usr/bin cd sed
+	export "$@" cd "$1" 'quoted text' echo /usr/bin awk test | | --verbose test
+		local && $(pwd) | printf /usr/bin "$1"
+	-eu grep local readonly -eu $(pwd) "$1" 'quoted text'
+	grep sed x=1 ${HOME} "$@" then echo
+		readonly then "$@" cd 2>/dev/null awk local printf
+sed $(pwd) "$@" -eu export done /usr/bin
+export local awk 'quoted text' sed export | then sed
+'quoted text' "$@" x=1 $(pwd) 2>/dev/null /usr/bin grep test /usr/bin done
+	--verbose --verbose && $(pwd) 'quoted text' x=1 "$@" 'quoted text'
+	| x=1 'quoted text' sed
+	echo 2>/dev/null ${HOME} --verbose /usr/bin
+2>/dev/null && "$1" x=1 "$1" awk 2>/dev/null /usr/bin
+-eu grep /usr/bin 'quoted text' awk readonly
+"$@" "$1" -eu echo x=1 then -eu readonly local
+'quoted text' done then x=1 $(pwd) 'quoted text'
+		test "$@" | awk then 2>/dev/null done sed then | local ${HOME}
+/usr/bin awk echo local printf then x=1 test 2>/dev/null done | && -eu echo
+		${HOME} done readonly "$@" 2>/dev/null $(pwd) --verbose sed test
+	then local awk | x=1 local 'quoted text' 'quoted text'
+	-eu 2>/dev/null "$@" $(pwd) x=1 --verbose
+awk ${HOME} ${HOME} 2>/dev/null --verbose awk --verbose
+	grep test printf then --verbose printf $(pwd) export | ${HOME} /usr/bin
+$(pwd) $(pwd) sed export 'quoted text' x=1 awk 2>/dev/null x=1 test
+		| readonly test "$@" 'quoted text'
+		awk cd ${HOME} "$1" "$@"
+		| | readonly test done grep /usr/bin $(pwd) $(pwd) export --verbose
+	${HOME} export 'quoted text' "$@" -eu && "$1" sed readonly grep --verbose
+"$1" --verbose sed 'quoted text'
+local 2>/dev/null printf readonly 2>/dev/null
+	x=1 ${HOME} --verbose printf readonly done printf -eu test
+	"$@" done "$@" x=1 done /usr/bin && sed readonly
+printf 'quoted text' grep
+	echo $(pwd) cd 'quoted text' --verbose
+	done sed then 2>/dev/null
+awk "$1" 2>/dev/null $(pwd) |
+then printf sed export readonly cd "$1" echo
+	local ${HOME} | 2>/dev/null -eu
+		export x=1 | 'quoted text'
+awk /usr/bin test local export "$@" 'quoted text' cd printf /usr/bin done sed
+		${HOME} 2>/dev/null readonly 'quoted text' /usr/bin -eu "$1" then "$1"
+	${HOME} ${HOME} echo local cd export
+		"$@" test echo awk sed printf && awk
+awk x=1 'quoted text' sed | readonly
+cd readonly printf done "$1" then "$@" export x=1 | $(pwd) cd
+		-eu && -eu "$1" ${HOME} done ${HOME} awk test /usr/bin
+	export sed printf grep ${HOME} grep "$1" 'quoted text'
+	cd ${HOME} then sed && done ${HOME} printf test grep -eu echo 'quoted text'
+		'quoted text' cd awk sed awk x=1 printf --verbose $(pwd) test $(pwd)
+	/usr/bin --verbose readonly /usr/bin printf "$1" export awk
+		done $(pwd) done local sed ${HOME} ${HOME} export readonly -eu
+	export && test then &&
+	echo printf export awk 'quoted text' "$@" --verbose
+readonly export local | /usr/bin done $(pwd) 2>/dev/null "$@" echo /usr/bin
+	sed /usr/bin done awk cd printf | local
+	${HOME} test 'quoted text' done -eu --verbose test readonly 2>/dev/null
+	echo /usr/bin && then | &&
+		readonly printf && grep "$1" printf readonly cd readonly --verbose
+	x=1 "$@" printf "$@" -eu awk printf grep 'quoted text' grep
+	sed -eu printf grep sed | echo --verbose
+	&& grep local cd ${HOME} awk export x=1 ${HOME} grep x=1
+	grep export local -eu echo printf test -eu --verbose local
+	/usr/bin | "$@" -eu ${HOME} cd printf local
+		&& done ${HOME} $(pwd) &&
+	'quoted text' test /usr/bin test sed readonly -eu echo local
+/usr/bin grep export local /usr/bin 2>/dev/null x=1 "$1"
+		then -eu "$@" x=1 /usr/bin | $(pwd) then local sed x=1 | "$@" export readonly
+then /usr/bin local sed grep
+		readonly grep /usr/bin echo grep export awk --verbose
+done readonly /usr/bin -eu /usr/bin | sed cd --verbose
+	"$@" echo | "$@" test /usr/bin then test /usr/bin 'quoted text' 2>/dev/null
+&& printf "$@" echo "$1" --verbose /usr/bin
+2>/dev/null then 2>/dev/null "$@" /usr/bin x=1 echo -eu "$1" readonly
+	test export $(pwd) -eu "$1" awk ${HOME} echo --verbose
+| then 'quoted text' --verbose 'quoted text' 2>/dev/null --verbose
+		"$@" echo "$@" "$@" local echo then grep done
+		sed awk test grep "$@" printf export 2>/dev/null
+		$(pwd) "$@" then printf awk export && cd readonly printf 'quoted text' 'quoted text'
+echo "$1" /usr/bin then "$1" done
+	awk | "$@" -eu -eu ${HOME} ${HOME} sed ${HOME} x=1 grep test
+	--verbose ${HOME} done && cd echo awk "$@" export 2>/dev/null 'quoted text'
+printf 'quoted text' printf done
+readonly local sed awk awk x=1 sed 'quoted text' cd echo 'quoted text'
+export cd && --verbose 'quoted text' awk /usr/bin sed test test printf grep
+	local done x=1 readonly 'quoted text' printf
+		cd printf export sed
+	readonly ${HOME} sed echo sed grep "$@" --verbose 2>/dev/null
+		x=1 then sed $(pwd) "$@" &&
+	done then grep "$1" "$1" then sed 'quoted text' x=1 local done && ${HOME}
+local 'quoted text' $(pwd) grep cd "$1"
+	${HOME} test $(pwd) cd -eu $(pwd) --verbose /usr/bin $(pwd)
+-eu printf ${HOME} -eu
+readonly export -eu 2>/dev/null "$@" 2>/dev/null 2>/dev/null
+	done /usr/bin "$1" grep grep --verbose printf $(pwd) "$1" /usr/bin --verbose
+x=1 -eu test $(pwd) && && x=1 export --verbose then awk cd
+${HOME} readonly done 'quoted text'
+	echo /usr/bin awk 2>/dev/null cd 'quoted text'
+local --verbose 2>/dev/null test readonly test | test "$@" done --verbose done
+	"$@" readonly 'quoted text' $(pwd) && local /usr/bin export
+	"$1" printf "$@" x=1 test export -eu $(pwd) sed "$1" "$1" -eu ${HOME} 2>/dev/null
+	echo /usr/bin sed grep 2>/dev/null -eu
+	then cd echo test echo ${HOME} 'quoted text' | test readonly cd /usr/bin 'quoted text'
+| done "$@" sed then -eu $(pwd) sed --verbose && --verbose 'quoted text'
+/usr/bin done grep printf grep done
+	-eu && --verbose export 'quoted text'
+	2>/dev/null done local awk | echo
+	test readonly test -eu "$1" echo printf local /usr/bin printf --verbose
+readonly -eu ${HOME} test cd local /usr/bin 'quoted text' 'quoted text' printf
+		printf "$@" && && 2>/dev/null && export echo "$1" "$1" export /usr/bin --verbose
+		local $(pwd) $(pwd) awk | printf | sed
+	readonly ${HOME} printf then done /usr/bin then echo
+		--verbose -eu "$1" "$1" | ${HOME} && x=1 sed && done
+${HOME} printf test readonly
+		$(pwd) sed ${HOME} readonly 2>/dev/null
+	echo $(pwd) -eu -eu done -eu 2>/dev/null
+then | local "$1" $(pwd) --verbose 2>/dev/null | ${HOME} cd -eu 2>/dev/null
+		grep printf export local grep awk "$@" x=1
+		awk $(pwd) sed $(pwd) ${HOME} | 2>/dev/null ${HOME} local grep 2>/dev/null
+/usr/bin $(pwd) "$@" $(pwd) echo test && "$1"
+sed grep 2>/dev/null printf ${HOME} grep grep ${HOME} echo grep grep 'quoted text'
+		&& && -eu x=1 then x=1
+"$@" "$@" --verbose done local $(pwd) 2>/dev/null test
+	-eu 2>/dev/null $(pwd) cd printf 2>/dev/null
+		"$@" x=1 "$1" ${HOME} done awk awk -eu "$1" ${HOME}
+done then -eu 2>/dev/null local x=1 'quoted text' --verbose x=1 grep && ${HOME}
+		grep "$1" local then then export printf readonly "$1" ${HOME} printf
+	test awk x=1 printf | 2>/dev/null "$1" ${HOME} && then
+	test sed grep -eu ${HOME} "$@" 2>/dev/null
+'quoted text' /usr/bin "$1" "$1" cd sed --verbose echo sed done
+		x=1 test x=1 cd export cd -eu sed awk 'quoted text'
+local x=1 cd && 2>/dev/null sed x=1 export --verbose printf |
+		"$1" test "$1" sed ${HOME} 'quoted text'
+	-eu printf /usr/bin readonly cd test test x=1 test
+test $(pwd) then 2>/dev/null local | | | x=1
+	2>/dev/null readonly |
+test 'quoted text' done 'quoted text'
+test "$@" done x=1 "$@" && && /usr/bin sed printf printf /usr/bin --verbose
+| export $(pwd) sed 2>/dev/null $(pwd) x=1 done printf awk --verbose printf
+	grep then export then 2>/dev/null 'quoted text'
+		$(pwd) && printf "$@" done test done echo done "$1"
+		echo | printf 'quoted text' && local 2>/dev/null
+"$@" cd done --verbose "$@" test "$1"
+'quoted text' awk awk ${HOME} test
+$(pwd) 2>/dev/null readonly
+	&& && test 2>/dev/null grep sed "$@" readonly test done readonly --verbose
+	readonly export done printf
+		| $(pwd) grep done 'quoted text' 'quoted text' $(pwd) cd export "$@" | local
+x=1 awk | /usr/bin then --verbose "$@" readonly grep ${HOME} && printf echo
+then ${HOME} --verbose 2>/dev/null then readonly
+		&& "$@" "$@" local then --verbose x=1 2>/dev/null
+--verbose && readonly sed "$1" $(pwd) | awk -eu echo echo awk && export grep
+	printf test --verbose awk "$1" readonly "$1" 'quoted text'
+	grep ${HOME} | "$1" && cd test x=1 export
+	cd echo | "$@" "$1" sed cd -eu then | cd readonly sed test 2>/dev/null
+&& "$@" local cd 'quoted text'
+	x=1 test then then awk -eu | ${HOME}
+	sed local export readonly | ${HOME} "$@" printf done &&
+	then export && test 2>/dev/null export test $(pwd)
+	"$1" grep cd echo printf
+		"$1" | awk local "$@" then --verbose cd done /usr/bin
+		export "$@" printf done -eu local local test cd --verbose
+sed -eu && printf 2>/dev/null /usr/bin ${HOME} cd sed
+	then /usr/bin x=1 awk grep echo | /usr/bin export
+	'quoted text' $(pwd) -eu then /usr/bin then echo
+		/usr/bin "$1" $(pwd) echo readonly done "$1" "$@" "$1" -eu -eu
+		"$1" done printf done | awk 2>/dev/null test test done && x=1 x=1 "$@" export ${HOME}
+		then export readonly x=1 awk local echo $(pwd)
+	"$1" then 'quoted text' /usr/bin grep
+echo awk done "$@" && "$@"
+"$1" ${HOME} && | then done test
+		-eu export readonly --verbose ${HOME} && "$1" readonly /usr/bin then --verbose
+"$1" sed ${HOME} | 2>/dev/null
+done --verbose test /usr/bin ${HOME} awk readonly /usr/bin x=1 |
+		${HOME} -eu ${HOME} && printf
+awk 'quoted text' $(pwd) then echo test /usr/bin x=1
+		cd done then -eu grep | export "$1" 'quoted text'
+	--verbose export export "$@" x=1 2>/dev/null
+cd 2>/dev/null then x=1 "$1" sed "$1" /usr/bin local cd --verbose
+	--verbose /usr/bin 'quoted text' done 'quoted text'
+	readonly | done && ${HOME} "$@" /usr/bin /usr/bin
+		${HOME} "$1" --verbose awk ${HOME} echo "$1" "$@"
+export x=1 /usr/bin awk "$@"
+	printf --verbose test -eu "$1" done --verbose /usr/bin then then $(pwd)
+	${HOME} ${HOME} printf printf 'quoted text' test /usr/bin cd "$@"
+		local --verbose "$1" sed "$1" 'quoted text' export awk export readonly
+&& 'quoted text' "$1" "$1"
+		done local "$@" awk echo export | $(pwd) cd test $(pwd) test /usr/bin
+	done && export test test | done 2>/dev/null ${HOME} 'quoted text' done
+	-eu printf sed test cd export export awk test test echo | "$@" export -eu
+	grep --verbose "$@" done export
+echo printf ${HOME} cd x=1 x=1 && printf printf /usr/bin readonly awk "$1" printf
+--verbose 'quoted text' $(pwd) cd local done
+	--verbose x=1 echo echo done export printf readonly $(pwd) /usr/bin awk 'quoted text'
+export cd grep then local --verbose | --verbose
+		$(pwd) /usr/bin done | cd test
+		done printf export sed | && && --verbose
+		2>/dev/null then printf sed export
+	${HOME} export local 'quoted text'
+	local done ${HOME} export x=1 local 2>/dev/null "$1" | x=1 && grep 'quoted text'
+	"$@" 'quoted text' local "$@" -eu cd
+/usr/bin 2>/dev/null readonly test $(pwd) ${HOME} test
+		-eu printf /usr/bin printf readonly echo 2>/dev/null readonly "$@" /usr/bin --verbose
+		$(pwd) 'quoted text' "$@" | x=1
+	$(pwd) sed done x=1 | local readonly export sed
+	grep export export x=1 grep $(pwd)
+| sed export && sed awk local |
+/usr/bin x=1 'quoted text' printf | test cd && sed "$1" /usr/bin
+		-eu awk cd readonly echo then 'quoted text' grep printf $(pwd)
+	--verbose $(pwd) cd 'quoted text' $(pwd)
+	test && sed && sed test
+	cd done --verbose printf then "$1" -eu readonly
+	test x=1 "$1" --verbose && | cd sed cd grep then x=1 readonly
+		--verbose printf then grep readonly --verbose
+	-eu awk test -eu then echo | export export --verbose
+	x=1 local echo "$1" readonly /usr/bin -eu echo cd export test awk
+	then ${HOME} x=1 cd ${HOME} done &&
+		echo sed --verbose 'quoted text' "$@" printf sed ${HOME} -eu
+	--verbose && /usr/bin export
+$(pwd) /usr/bin printf echo 'quoted text' ${HOME} sed printf done
+		--verbose "$@" awk readonly local printf "$1" export
+	grep "$@" export | $(pwd) -eu local | awk x=1 $(pwd) printf sed echo "$1"
+-eu && readonly 2>/dev/null awk readonly test
+export test echo export
+		/usr/bin | x=1 awk --verbose 'quoted text' export sed ${HOME} /usr/bin $(pwd)
+	awk "$@" /usr/bin readonly 'quoted text' echo test |
+${HOME} local printf 2>/dev/null local 'quoted text'
+		then 2>/dev/null -eu export && readonly done awk echo then
+	"$1" 2>/dev/null test && x=1 awk | "$@" "$1" printf readonly awk awk
+	then "$1" "$1" | sed echo $(pwd) sed sed && "$1"
+	"$@" "$@" grep | "$1" 'quoted text' 2>/dev/null x=1
+echo $(pwd) test x=1 |
+		${HOME} x=1 grep ${HOME} then printf done --verbose x=1 sed
+		"$@" local cd $(pwd) sed ${HOME} $(pwd) ${HOME}
+		-eu 2>/dev/null "$1" export -eu && 'quoted text'
+	echo | then awk local grep -eu $(pwd) ${HOME}
+	x=1 grep echo "$@" readonly awk sed "$@" -eu grep && grep /usr/bin readonly
+'quoted text' export /usr/bin cd grep echo test
+	then x=1 done echo printf "$1"
+printf && --verbose readonly $(pwd) cd 'quoted text' ${HOME}
+	printf --verbose done grep
+then local x=1 $(pwd) x=1 echo && 'quoted text' && 'quoted text' awk 2>/dev/null
+"$@" then printf 'quoted text'
+| echo -eu -eu ${HOME} then export --verbose
+		/usr/bin | 'quoted text' x=1 "$1" && x=1 | ${HOME}
+	"$1" cd done x=1 done local -eu sed /usr/bin local
+"$@" local 'quoted text' && ${HOME} x=1 printf "$@"
+		&& $(pwd) test done sed 2>/dev/null echo grep cd ${HOME} export
+${HOME} awk printf && sed "$1" then test export -eu sed grep
+-eu "$1" 'quoted text' ${HOME} && "$1" "$1" printf
+grep echo ${HOME} grep local && grep 2>/dev/null -eu /usr/bin
+printf "$@" "$1" $(pwd) && "$@" echo test test sed sed
+		x=1 | -eu 2>/dev/null local | local x=1 local echo printf echo
+	export done printf printf grep local ${HOME} then x=1 --verbose --verbose grep
+		printf ${HOME} -eu /usr/bin awk 'quoted text' "$1" local printf 'quoted text'
+awk export 2>/dev/null then /usr/bin test /usr/bin "$1" sed done echo
+	'quoted text' test awk grep then cd sed awk --verbose done then then 'quoted text'
+grep "$@" $(pwd) | "$1" x=1 2>/dev/null
+| test 'quoted text' grep && /usr/bin -eu done cd awk readonly readonly &&
+	grep grep grep 2>/dev/null then 2>/dev/null "$@" -eu && --verbose
+test 2>/dev/null echo readonly 2>/dev/null then | && sed echo "$@" then then --verbose
+		cd && awk readonly $(pwd) printf 2>/dev/null 2>/dev/null sed local $(pwd)
+	printf then 'quoted text' sed | 'quoted text' -eu && /usr/bin /usr/bin ${HOME}
+&& "$@" export 'quoted text' 2>/dev/null
+	"$1" | awk then then printf | grep test echo readonly -eu && printf
+echo echo done grep &&
+	test 2>/dev/null ${HOME} awk 'quoted text' | $(pwd) then echo 'quoted text'
+/usr/bin x=1 readonly | "$@" "$@" grep awk 'quoted text'
+awk ${HOME} test done $(pwd) x=1 then printf $(pwd) grep grep 'quoted text'
+	cd export 'quoted text' export -eu | echo
+	done | test "$@" test /usr/bin awk ${HOME}
+grep /usr/bin cd -eu "$@" --verbose
+		&& done -eu --verbose 2>/dev/null ${HOME}
+		x=1 2>/dev/null "$1" 'quoted text' test then
+export grep && /usr/bin readonly x=1 export x=1 'quoted text'
+	printf "$@" 'quoted text' ${HOME} "$1" /usr/bin export $(pwd) --verbose /usr/bin
+-eu /usr/bin $(pwd) $(pwd) sed ${HOME} 'quoted text'
+		awk local awk awk 'quoted text' --verbose
+/usr/bin "$@" grep ${HOME} "$1" echo $(pwd)
+	readonly --verbose -eu cd "$@" -eu readonly grep sed --verbose readonly ${HOME}
+		awk --verbose awk $(pwd) export $(pwd)
+	grep sed test cd then && cd 2>/dev/null
+		local sed ${HOME} --verbose export $(pwd) printf grep && --verbose then --verbose
+x=1 && ${HOME} sed local local &&
+		/usr/bin $(pwd) /usr/bin cd test "$1" cd printf grep 'quoted text'
+done /usr/bin 'quoted text' "$1" done | sed 'quoted text'
+	| local -eu readonly -eu local local cd grep && then readonly --verbose
+		$(pwd) done local cd awk | ${HOME} test && cd x=1 $(pwd) printf -eu sed export --verbose
+		awk sed -eu | -eu export grep
+		test cd ${HOME} | printf cd | 'quoted text' && local "$1" test
+x=1 /usr/bin test export 2>/dev/null done printf sed -eu then "$@" cd
+sed ${HOME} $(pwd) echo 2>/dev/null
+		local 'quoted text' local printf awk echo echo -eu && -eu export x=1 /usr/bin
+		$(pwd) --verbose cd x=1 'quoted text' then &&
+		printf test echo /usr/bin x=1 /usr/bin $(pwd) x=1 x=1 cd printf readonly
+		printf && done 'quoted text' /usr/bin cd awk | grep 'quoted text' awk | readonly
+"$1" | "$1" test done 'quoted text' local cd export -eu $(pwd) readonly done
+	echo awk local awk x=1 && test local cd local local -eu
+		done awk && 'quoted text' then && /usr/bin test readonly
+		test && awk --verbose echo --verbose |
+x=1 awk echo test local 'quoted text' printf | readonly echo
+		--verbose then && | printf 2>/dev/null 2>/dev/null grep sed sed
+| /usr/bin 'quoted text' local $(pwd) ${HOME} local
+	test 2>/dev/null /usr/bin readonly export printf readonly then sed echo | awk
+	done cd 2>/dev/null printf "$@" "$1" then echo printf "$@" readonly grep -eu done
+2>/dev/null -eu readonly -eu /usr/bin
+test awk 2>/dev/null then echo awk sed 'quoted text' local printf grep 'quoted text'
+	"$1" x=1 sed 2>/dev/null ${HOME}
+	${HOME} grep --verbose awk awk test "$1" cd then -eu sed echo x=1 sed sed readonly
+		"$@" done | --verbose 2>/dev/null sed echo $(pwd) ${HOME} done && -eu then
+	${HOME} test /usr/bin local
+		echo printf /usr/bin printf awk readonly sed /usr/bin grep
+		readonly "$1" 2>/dev/null local
+	/usr/bin $(pwd) /usr/bin local | grep | grep --verbose
+	sed grep sed x=1 grep --verbose export readonly local local 2>/dev/null
+		printf && | cd then "$@" export --verbose x=1 printf test echo
+-eu 'quoted text' $(pwd)
+		/usr/bin ${HOME} 2>/dev/null cd printf --verbose "$1" 'quoted text'
+	&& "$1" && awk ${HOME} grep ${HOME} $(pwd)
+sed done printf x=1 ${HOME} grep /usr/bin test /usr/bin cd grep
+		&& "$@" x=1 export export then && 2>/dev/null
+		$(pwd) done printf ${HOME} export sed readonly sed printf | then
+	awk /usr/bin printf --verbose cd ${HOME} "$@" test readonly 'quoted text' -eu -eu
+	echo local "$1" /usr/bin 'quoted text'
+	| "$@" --verbose "$@" 2>/dev/null ${HOME} | local echo sed local test
+&& 2>/dev/null && 2>/dev/null ${HOME} export &&
+		sed -eu | printf readonly 'quoted text' ${HOME} x=1 readonly cd /usr/bin local
+		export ${HOME} -eu then 2>/dev/null readonly local | -eu "$1" 'quoted text'
+readonly test then grep cd then then awk readonly "$@" 'quoted text'
+		done local $(pwd) | x=1 2>/dev/null then | printf
+readonly "$1" echo awk export test "$@" local "$@" sed printf 2>/dev/null
+		sed 'quoted text' awk then readonly sed | x=1 echo cd printf local ${HOME}
+	$(pwd) x=1 test /usr/bin printf grep done sed cd cd export readonly
+		test printf cd grep "$1" $(pwd) cd
+	test 2>/dev/null $(pwd) x=1 awk "$1" --verbose
+local "$1" -eu 2>/dev/null "$@"
+		"$@" && then test export
+--verbose ${HOME} sed sed --verbose echo readonly echo
+	$(pwd) x=1 readonly -eu --verbose done x=1 ${HOME} local /usr/bin $(pwd)
+'quoted text' x=1 then x=1 printf then local sed
+		x=1 then --verbose $(pwd)
+test readonly 'quoted text'
+	local export export local
+grep done ${HOME} && echo 2>/dev/null | local && grep &&
+	2>/dev/null 'quoted text'
+		-eu x=1 "$@" $(pwd) && 'quoted text' local echo awk -eu readonly
+local && then | then local x=1 2>/dev/null cd | "$@" x=1 "$@" grep grep
+$(pwd) && done readonly --verbose /usr/bin grep
+		printf awk sed test grep local test printf sed |
+		2>/dev/null -eu "$1" then && $(pwd) x=1 | grep ${HOME} x=1 -eu readonly then
+	grep 2>/dev/null then | && ${HOME}
+cd $(pwd) "$@" then /usr/bin
+	2>/dev/null readonly cd $(pwd) "$@" export sed
+printf $(pwd) ${HOME} /usr/bin
+		"$@" "$1" readonly $(pwd) -eu local done "$@" echo grep test 2>/dev/null done &&
+"$1" && 2>/dev/null cd x=1 $(pwd) awk x=1 cd test test then export "$1" "$@" local
+	x=1 && "$@" done 2>/dev/null -eu | done $(pwd) printf readonly
+awk "$@" -eu "$@" sed then done
+		echo local ${HOME} -eu done x=1
+		export --verbose export sed done
+		local printf x=1 /usr/bin local 2>/dev/null printf && local | local
+		x=1 && export echo awk
+grep printf -eu grep --verbose test cd 2>/dev/null printf 2>/dev/null "$@"
+		$(pwd) "$@" cd /usr/bin echo cd done | ${HOME} echo /usr/bin 2>/dev/null
+	echo 'quoted text' cd "$@" $(pwd) awk x=1 "$1" echo
+cd local "$1" $(pwd) done done ${HOME} cd "$@" /usr/bin ${HOME}
+echo readonly "$1" readonly x=1 export done then 2>/dev/null done then --verbose
+		$(pwd) | awk && /usr/bin readonly 'quoted text' then readonly
+cd "$@" | done "$1" 'quoted text' then cd awk
+&& grep "$@" x=1 'quoted text' $(pwd) echo then
+		/usr/bin && awk local $(pwd) local x=1 --verbose echo --verbose
+done && $(pwd) $(pwd) sed cd && local
+local /usr/bin 'quoted text' sed "$@" printf
+	printf -eu then cd export test then test test local then test | 'quoted text'
+	--verbose 'quoted text' 'quoted text' then --verbose
+		${HOME} && grep /usr/bin export
+		then export $(pwd) x=1 then readonly --verbose
+		'quoted text' -eu awk "$@"
+done awk ${HOME} echo && 2>/dev/null test cd "$@" printf grep
+sed export && sed readonly --verbose
+		--verbose | printf sed readonly grep
+	grep && x=1 ${HOME} readonly done | && done
+		$(pwd) grep "$@" echo cd 2>/dev/null then x=1 && "$1" | printf
+&& "$1" "$1" then local 'quoted text' local 2>/dev/null | export | export
+	${HOME} sed x=1 && --verbose $(pwd) grep
+2>/dev/null ${HOME} readonly | 'quoted text'
+		&& "$@" sed 'quoted text' $(pwd) then ${HOME} 'quoted text' cd /usr/bin
+		then 'quoted text' $(pwd) ${HOME} test cd "$@" | grep cd | 2>/dev/null
+	-eu then export 'quoted text' && awk -eu cd 2>/dev/null awk x=1 "$@"
+	| "$1" grep printf --verbose done awk then 2>/dev/null sed 'quoted text'
+test cd printf x=1 'quoted text' -eu then local &&
+test ${HOME} "$@" printf "$1" "$@" x=1 then grep x=1
+awk done then "$1" $(pwd) readonly
+		awk export grep awk grep x=1 | "$@" $(pwd) /usr/bin done readonly awk | then
+-eu readonly then "$1" printf -eu printf "$@" grep echo
+		/usr/bin $(pwd) $(pwd) "$1" cd
+		x=1 then /usr/bin readonly "$@" | ${HOME} sed && -eu 2>/dev/null "$@"
+	export "$@" sed "$@" echo printf ${HOME}
+		readonly awk 2>/dev/null && sed
+		'quoted text' 'quoted text'
+		export && $(pwd) test -eu grep ${HOME} cd cd /usr/bin cd "$@" awk export
+		done "$@" "$@" ${HOME} grep readonly
+		done cd grep "$1" readonly ${HOME} /usr/bin
+	"$1" "$@" -eu readonly echo ${HOME} export $(pwd) 2>/dev/null x=1 done
+/usr/bin export then && --verbose done echo -eu test /usr/bin
+	sed sed local -eu ${HOME} x=1 --verbose export x=1 local readonly awk "$1" x=1
+	echo test grep && then then /usr/bin echo
+'quoted text' "$1" echo local test printf x=1 sed "$@" printf sed 'quoted text'
+cd local 'quoted text' 2>/dev/null /usr/bin sed test "$@" readonly $(pwd)
+		printf "$1" done done sed 2>/dev/null "$1" && done grep
+	&& ${HOME} echo "$1" /usr/bin cd awk local /usr/bin /usr/bin
+	'quoted text' -eu --verbose --verbose cd && cd grep
+	-eu readonly grep | --verbose readonly 2>/dev/null x=1 "$@" /usr/bin echo
+		${HOME} cd $(pwd) --verbose echo done local
+	local 'quoted text' test
+	printf awk done test | "$@" "$1" echo $(pwd) -eu "$1"
+	printf export "$@" 2>/dev/null $(pwd) x=1 printf "$@"
+		printf readonly x=1 /usr/bin
+		readonly cd -eu grep "$@"
+-eu awk 'quoted text' 2>/dev/null $(pwd) -eu -eu "$@" printf done
+local done "$1" printf echo readonly
+		readonly ${HOME} 2>/dev/null printf readonly 'quoted text' echo printf local
+	awk && sed --verbose then done sed then awk 2>/dev/null then && printf sed
+$(pwd) awk local 'quoted text' x=1 readonly $(pwd) -eu printf
+	printf local awk sed grep 2>/dev/null readonly readonly test local $(pwd)
+-eu echo done readonly --verbose && echo
+	echo sed grep --verbose test x=1
+done -eu grep local --verbose x=1 awk awk done $(pwd)
+	x=1 sed && sed sed --verbose --verbose 'quoted text' sed ${HOME}
+		then "$@" --verbose ${HOME} |
+		-eu -eu --verbose --verbose "$@" export readonly echo ${HOME}
+readonly readonly --verbose cd 'quoted text' 'quoted text'
+		test --verbose 2>/dev/null "$1"
+x=1 done done sed x=1 grep
+		--verbose done done | | awk /usr/bin export 2>/dev/null /usr/bin
+--verbose readonly ${HOME}
+${HOME} --verbose sed sed --verbose x=1 -eu -eu $(pwd) | -eu then "$@" awk ${HOME}
+		done ${HOME} 2>/dev/null ${HOME}
+		--verbose export readonly echo /usr/bin
+"$1" ${HOME} x=1 printf x=1 -eu echo -eu --verbose
+	"$@" awk then readonly echo test ${HOME} echo done echo then echo grep
+		local readonly done "$@" export x=1 done $(pwd)
+	${HOME} 2>/dev/null && 'quoted text'
+	$(pwd) -eu | --verbose | --verbose && export then local local "$1" x=1
+		cd $(pwd) "$1" printf grep
+export $(pwd) $(pwd) export $(pwd)
+grep cd x=1 export then
+test 'quoted text' x=1 -eu done awk x=1 ${HOME} test local
+	export && ${HOME} done readonly
+then then cd sed --verbose "$@" printf "$@" /usr/bin done
+		test x=1 printf x=1 $(pwd) "$1" x=1 --verbose ${HOME} printf grep $(pwd)
+		x=1 export cd cd done printf
+		2>/dev/null /usr/bin local sed && /usr/bin cd sed 2>/dev/null
+/usr/bin x=1 $(pwd) 'quoted text' /usr/bin awk ${HOME} 'quoted text' 2>/dev/null
+		"$1" 'quoted text' "$@" x=1 ${HOME} cd "$@" printf
+		"$@" echo test | printf awk $(pwd) -eu done $(pwd) "$1" && sed sed 2>/dev/null
+/usr/bin $(pwd) "$@" 'quoted text' done echo test /usr/bin
+		then $(pwd) cd echo "$1" local
+		"$1" 2>/dev/null "$1" | 'quoted text'
+		| --verbose readonly "$@" echo sed
+		--verbose then sed /usr/bin grep cd --verbose && then cd test printf
+'quoted text' cd local 'quoted text' cd
+echo 2>/dev/null done sed 2>/dev/null
+-eu printf sed awk "$1"
+awk "$1" --verbose awk && 'quoted text' done done local ${HOME} export
+		| echo x=1 --verbose "$@" readonly --verbose local ${HOME} | ${HOME} cd "$@"
+	printf echo then "$1" sed local --verbose && done sed then
+	printf 2>/dev/null echo done test awk | --verbose done --verbose
+		/usr/bin x=1 'quoted text' --verbose test --verbose
+${HOME} x=1 2>/dev/null /usr/bin && $(pwd) x=1 local 'quoted text'
+	test grep cd -eu 'quoted text' 2>/dev/null
+		&& $(pwd) ${HOME} | |
+test grep | 2>/dev/null x=1 grep export "$1" /usr/bin
+--verbose test printf done export x=1 grep 'quoted text' grep && 'quoted text'
+		grep -eu ${HOME} --verbose --verbose 2>/dev/null sed cd --verbose
+	readonly | echo && $(pwd) printf
+		&& done sed x=1 readonly then /usr/bin test |
+echo grep export -eu sed done test printf $(pwd) local test --verbose "$@"
+	$(pwd) $(pwd) echo local test | | 2>/dev/null && readonly
+	'quoted text' x=1 printf 'quoted text' $(pwd) $(pwd)
+test "$1" readonly printf sed done test cd --verbose
+		cd grep cd local --verbose
+	printf then grep sed ${HOME} ${HOME} grep -eu
+	local export --verbose 2>/dev/null cd cd | "$1" done 'quoted text' readonly
+		-eu "$1" sed then grep "$@" readonly sed "$1"
+	printf printf "$@" /usr/bin test grep /usr/bin
+	--verbose echo local | ${HOME} grep readonly then grep $(pwd)
+then | ${HOME} -eu -eu x=1 | printf /usr/bin printf
+		"$1" cd ${HOME} cd awk
+	done test sed ${HOME} local test x=1 | local awk
+		echo cd | x=1 test && -eu awk && test
+		/usr/bin readonly readonly ${HOME} $(pwd) $(pwd) /usr/bin && test
+/usr/bin | done 2>/dev/null done -eu echo test "$1" then $(pwd) x=1 2>/dev/null
+	'quoted text' readonly --verbose
+		echo --verbose "$@" | "$1" local sed ${HOME} "$@" "$@" echo
+		| awk local 2>/dev/null echo test local
+	local 'quoted text' cd grep "$@" && -eu readonly && --verbose
+	"$@" local "$1" sed "$1" /usr/bin 'quoted text' $(pwd) | ${HOME}
+	"$1" /usr/bin export done awk printf readonly readonly "$@" printf
+	printf done echo readonly test --verbose cd test
+		| $(pwd) "$@" then --verbose local "$@" "$1" x=1 awk then echo
+		test printf /usr/bin ${HOME} -eu
+	export $(pwd) then $(pwd) readonly readonly
+	-eu "$@" 'quoted text' | x=1 $(pwd) test awk /usr/bin printf
+"$@" done grep then /usr/bin ${HOME}
+		cd awk "$1" awk sed 'quoted text' /usr/bin x=1 &&
+${HOME} sed test readonly -eu cd 2>/dev/null cd
+'quoted text' -eu "$1" 2>/dev/null &&
+		| then "$@" && /usr/bin && | -eu
+then -eu test awk $(pwd) printf export
+test 2>/dev/null sed echo $(pwd) grep export grep 2>/dev/null local | then
+cd test "$1" $(pwd) echo $(pwd) grep "$1" "$1" 'quoted text'
+x=1 then awk cd sed | local && echo test -eu echo echo
+		$(pwd) printf 'quoted text' grep ${HOME} "$1"
+		| readonly awk local echo export echo
+awk then ${HOME} echo "$1" then awk
+done printf test readonly -eu --verbose $(pwd) readonly "$@"
+$(pwd) printf && /usr/bin then printf --verbose
+	cd sed cd --verbose awk test test x=1 test export done -eu
+		cd "$1" ${HOME} /usr/bin awk export local sed "$@" sed
+		test sed --verbose export 2>/dev/null cd grep echo
+		readonly /usr/bin grep local
+	'quoted text' "$@" 2>/dev/null /usr/bin "$1"
+export "$@" | grep /usr/bin | sed export
+local printf /usr/bin "$@" test x=1 cd && sed x=1 ${HOME} /usr/bin | readonly sed
+	grep printf readonly && | /usr/bin x=1 x=1 sed local && readonly
+	local --verbose x=1 ${HOME} readonly ${HOME} 2>/dev/null readonly
+		awk awk 2>/dev/null readonly
+	| test --verbose -eu echo local x=1 "$1" | done 2>/dev/null x=1 printf
+	"$@" printf awk done x=1 "$1" cd readonly grep grep printf then -eu grep
+"$1" done x=1 readonly $(pwd) 'quoted text' echo export
+	${HOME} "$1" export 2>/dev/null ${HOME} readonly && --verbose ${HOME} sed
+	--verbose -eu | "$1" sed -eu cd $(pwd)
+		&& grep ${HOME} ${HOME} "$@" cd awk then /usr/bin
+done export readonly 2>/dev/null "$@"
+		local $(pwd) done | $(pwd) /usr/bin 'quoted text' "$1" x=1 test 2>/dev/null cd
+		| cd $(pwd) && $(pwd) test cd | readonly test echo local
+		${HOME} printf "$@" readonly done export --verbose 'quoted text' cd then printf
+	readonly | && $(pwd) 2>/dev/null grep -eu local "$1" 2>/dev/null
+	readonly -eu readonly 'quoted text' export -eu printf "$1" 'quoted text' echo
+| "$@" grep ${HOME} grep sed cd /usr/bin "$1" "$@" sed echo -eu | export
+	test /usr/bin local sed done printf awk
+		echo test "$@" local --verbose readonly
+		2>/dev/null printf then cd x=1 $(pwd) $(pwd) cd cd printf test
+-eu echo | local printf local "$@" readonly printf printf awk -eu grep
+'quoted text' 2>/dev/null 'quoted text' | "$@" && -eu readonly && "$@" cd | cd
+	export done && cd x=1 sed --verbose awk readonly --verbose echo /usr/bin
+		x=1 readonly export grep /usr/bin $(pwd) ${HOME} export | local
+'quoted text' 2>/dev/null | -eu -eu cd grep test readonly grep
+grep grep /usr/bin | 'quoted text'
+	sed awk readonly cd cd "$1" ${HOME}
+/usr/bin x=1 sed test cd then -eu
+cd --verbose 2>/dev/null echo echo then /usr/bin
+	${HOME} && 'quoted text' /usr/bin "$@" then export
+	--verbose printf "$1" | sed --verbose /usr/bin then | grep then done sed
+/usr/bin readonly cd --verbose && echo --verbose x=1 printf awk --verbose
+	grep readonly awk printf 'quoted text' grep test printf -eu echo done /usr/bin
+	x=1 test && 'quoted text' -eu ${HOME} | --verbose
+		$(pwd) | then --verbose && --verbose local done
+		2>/dev/null --verbose awk 2>/dev/null /usr/bin "$1" printf && 'quoted text'
+	printf | grep sed -eu /usr/bin
+	then | 2>/dev/null "$@" sed export printf 'quoted text' x=1
+$(pwd) ${HOME} readonly 2>/dev/null && export then $(pwd) grep 'quoted text' local
+readonly | | readonly then readonly done sed $(pwd) cd readonly echo "$@"
+	grep done then readonly printf readonly -eu 'quoted text' x=1 | | readonly
+	cd 'quoted text' test cd grep test x=1 --verbose awk export
+		| -eu cd "$@" --verbose grep $(pwd) $(pwd) 'quoted text'
+then -eu grep local local "$@" cd sed grep done x=1 'quoted text'
+	"$@" "$1" sed echo cd readonly cd echo readonly --verbose -eu 'quoted text'
+		"$@" && 'quoted text' 2>/dev/null grep awk echo 2>/dev/null
+		awk -eu x=1 printf then readonly awk ${HOME} then -eu "$@" -eu
+/usr/bin 2>/dev/null readonly export readonly grep "$1" echo awk local local grep
+		test export --verbose printf 2>/dev/null printf echo grep --verbose readonly &&
+		&& $(pwd) && --verbose printf echo awk
+		awk test printf --verbose
+		awk $(pwd) grep "$1" test /usr/bin echo grep
+cd --verbose 2>/dev/null printf "$1" test ${HOME} --verbose local
+		then export /usr/bin && cd cd /usr/bin x=1 readonly
+${HOME} && /usr/bin /usr/bin -eu awk done local then $(pwd) sed done | printf 'quoted text'
+		"$1" export $(pwd) && printf $(pwd) readonly 'quoted text'
+awk grep export "$@" cd
+	--verbose test "$1" && $(pwd) readonly 'quoted text' --verbose then
+	--verbose x=1 grep sed sed awk 2>/dev/null
+		${HOME} "$1" x=1 local ${HOME} then --verbose -eu grep test echo |
+		export 2>/dev/null sed done export "$@" local echo $(pwd) | export 2>/dev/null
+printf grep --verbose ${HOME} printf awk "$1" --verbose local x=1 $(pwd) "$@"
+		test --verbose done export test "$@" --verbose 'quoted text' "$@"
+done x=1 && grep --verbose $(pwd) readonly -eu $(pwd) readonly then /usr/bin
+		sed awk "$@" local "$@" x=1 ${HOME} export | && ${HOME} "$@"
+		x=1 local done cd 'quoted text' readonly x=1 -eu 2>/dev/null
+	"$1" awk -eu /usr/bin done echo awk sed printf cd ${HOME} --verbose
+	--verbose 'quoted text' -eu && 'quoted text' then ${HOME} &&
+		/usr/bin "$1" 'quoted text' -eu export --verbose -eu -eu /usr/bin local
+	2>/dev/null sed "$@" readonly 2>/dev/null
+	$(pwd) 'quoted text' "$1" grep local
+		export sed 2>/dev/null "$@" local ${HOME} test | -eu echo printf cd export
+"$@" "$@" 2>/dev/null then sed ${HOME} test ${HOME} export
+sed ${HOME} && export printf --verbose
+	export done x=1 -eu awk sed test | && echo grep "$@" ${HOME}
+		$(pwd) then ${HOME} export
+test sed "$1" printf done 2>/dev/null grep
+echo "$@" "$1" done grep sed 'quoted text' export $(pwd)
+awk 'quoted text' local "$1" 'quoted text' x=1 awk grep
+	printf printf done grep test then | && printf export echo "$@" done awk
+	2>/dev/null readonly && 2>/dev/null
+test export local export 'quoted text' export local
+test $(pwd) readonly "$@" 'quoted text' grep --verbose test
+	| cd echo "$1" awk printf sed readonly
+	printf cd $(pwd) 'quoted text'
+	then 2>/dev/null test && done "$1" awk $(pwd) then test test 2>/dev/null "$@"
+readonly echo /usr/bin x=1 export echo $(pwd)
+$(pwd) 2>/dev/null x=1 | awk 2>/dev/null
+then x=1 'quoted text' then awk export export
+sed awk then done "$@" $(pwd) ${HOME} "$1" done && 2>/dev/null
+		export 'quoted text' sed --verbose printf $(pwd) done --verbose 2>/dev/null echo
+	-eu readonly "$@" then sed sed sed then
+		$(pwd) | cd $(pwd) awk -eu ${HOME} then ${HOME} export
+	| "$@" && $(pwd) x=1 test
+		printf echo printf echo 'quoted text' then awk
+	&& readonly $(pwd) sed echo awk && awk
+export --verbose then then 2>/dev/null export local && grep awk | echo
+/usr/bin done x=1 x=1 test
+cd test "$1" -eu then "$1" "$1" "$@" /usr/bin readonly done test
+echo readonly printf ${HOME} | x=1 readonly then
+		${HOME} sed x=1 test local -eu
+2>/dev/null then grep cd export && | awk 2>/dev/null then "$1" /usr/bin readonly
+	${HOME} export test 2>/dev/null then echo $(pwd)
+		| awk readonly export -eu "$1" printf
+	x=1 readonly then local
+		2>/dev/null then "$@" ${HOME}
+	test | -eu && 'quoted text'
+		'quoted text' printf local
+printf 2>/dev/null ${HOME}
+		$(pwd) --verbose 'quoted text' 2>/dev/null -eu test
+		printf | done $(pwd) 'quoted text'
+$(pwd) ${HOME} 2>/dev/null then 'quoted text'
+	printf echo "$@" sed /usr/bin ${HOME} cd x=1 -eu readonly done awk 'quoted text'
+echo | "$1" echo cd grep ${HOME} -eu 2>/dev/null then
+		2>/dev/null printf && sed 2>/dev/null $(pwd) done 2>/dev/null export cd export grep
+	| local -eu && "$@" export --verbose sed cd echo export 'quoted text'
+awk 2>/dev/null cd 'quoted text'
+		printf readonly awk "$1" $(pwd) 'quoted text' sed -eu local then
+'quoted text' test 2>/dev/null "$@" /usr/bin test
+	/usr/bin x=1 awk cd printf $(pwd) 2>/dev/null echo grep --verbose 'quoted text'
+	&& local cd readonly cd local readonly printf cd
+2>/dev/null awk cd | "$@" awk && test $(pwd) x=1 awk awk "$@"
+	printf "$1" 2>/dev/null grep x=1 "$1" done done done
+	"$1" "$@" /usr/bin done cd $(pwd) done --verbose printf --verbose
+	echo cd --verbose awk sed 2>/dev/null && awk "$1"
+		| export && && sed export readonly
+awk x=1 ${HOME} $(pwd) x=1 cd $(pwd) "$@" $(pwd) ${HOME} test ${HOME}
+		sed local x=1 x=1 /usr/bin local readonly x=1 && -eu /usr/bin done -eu 'quoted text'
+done test grep && ${HOME} 2>/dev/null done
+	cd grep readonly then "$@" $(pwd) then
+		| grep -eu && awk x=1 ${HOME}
+		'quoted text' && | /usr/bin "$@" awk ${HOME} readonly
+		export done x=1 $(pwd) $(pwd) --verbose $(pwd) then 'quoted text'
+		local $(pwd) grep echo
+2>/dev/null 'quoted text' then $(pwd) 2>/dev/null local 2>/dev/null
+test grep x=1 cd test 'quoted text' local x=1 sed "$1" sed sed test
+${HOME} test /usr/bin $(pwd) ${HOME} --verbose 'quoted text' readonly
+		export | echo export 'quoted text' ${HOME} 2>/dev/null
+&& readonly /usr/bin -eu x=1 /usr/bin readonly | echo cd echo $(pwd)
+	"$1" echo && cd 'quoted text' echo -eu /usr/bin
+${HOME} grep readonly done then /usr/bin
+	local test echo "$1" then "$@" cd sed
+		printf "$@" echo test | --verbose echo --verbose -eu 'quoted text' 2>/dev/null
+'quoted text' 'quoted text' export grep printf /usr/bin
+	&& -eu awk x=1 awk ${HOME}
+&& test sed --verbose local export 'quoted text'
+	2>/dev/null | readonly $(pwd) | $(pwd) | "$@" | "$1" sed x=1 ${HOME}
+/usr/bin grep && /usr/bin && | readonly $(pwd) x=1 'quoted text' printf done
+		local --verbose echo export then printf | 'quoted text' /usr/bin
+echo $(pwd) 'quoted text' x=1 readonly
+${HOME} /usr/bin cd && 'quoted text' --verbose test ${HOME}
+		cd x=1 ${HOME} grep export sed
+		'quoted text' 2>/dev/null | local export /usr/bin done x=1 x=1 2>/dev/null
+&& ${HOME} readonly then readonly ${HOME} -eu | done 'quoted text'
+		cd -eu /usr/bin readonly local test 'quoted text' sed
+cd && cd readonly local echo "$1" grep
+		| | --verbose | --verbose local cd /usr/bin ${HOME} cd cd $(pwd) $(pwd)
+	test 'quoted text' grep "$@" && sed ${HOME} -eu -eu grep --verbose -eu sed then
+local readonly | local "$1" /usr/bin local grep grep then 2>/dev/null
+	test awk $(pwd) "$1" printf ${HOME} 2>/dev/null export
+	$(pwd) then local -eu -eu grep printf
+	/usr/bin --verbose x=1 ${HOME} /usr/bin grep "$1"
+	x=1 "$@" $(pwd) local -eu 2>/dev/null done
+grep readonly 'quoted text' "$1" cd x=1 done x=1
+	cd && x=1 printf 2>/dev/null echo /usr/bin x=1
+	cd local readonly echo 2>/dev/null | "$@" 2>/dev/null
+		"$1" -eu /usr/bin --verbose
+		"$1" done && $(pwd) export echo $(pwd) then 2>/dev/null | --verbose
+		then x=1 cd "$1" $(pwd) --verbose && $(pwd) done -eu echo 'quoted text'
+"$@" echo export 2>/dev/null --verbose 2>/dev/null && x=1 sed readonly
+		printf cd echo && ${HOME} && cd "$1" "$@"
+--verbose export awk 2>/dev/null | x=1 | "$@" printf cd cd local
+grep "$1" 'quoted text' export -eu --verbose then
+echo x=1 && cd | local x=1 awk -eu printf |
+test then -eu readonly
+echo x=1 ${HOME} then x=1 'quoted text' grep "$1" ${HOME} && | export
+x=1 cd ${HOME} echo echo "$@"
+		awk "$1" "$1" done grep test done
+	export printf export grep awk x=1 | export sed then done 2>/dev/null
+test && $(pwd) ${HOME} printf "$@" $(pwd) | 'quoted text'
+then echo export grep "$1"
+--verbose test /usr/bin then && local 2>/dev/null printf
+		sed grep sed /usr/bin -eu 2>/dev/null
+-eu done readonly awk awk readonly
+	"$@" 'quoted text' "$@" $(pwd) $(pwd) $(pwd) "$1" -eu done printf
+	"$@" awk $(pwd) awk $(pwd) /usr/bin /usr/bin $(pwd) sed $(pwd)
+	-eu && 'quoted text' grep "$1" x=1 test export
+	"$@" x=1 "$@" -eu sed export $(pwd) grep printf x=1 --verbose sed printf 'quoted text'
+	export cd sed | cd test && "$@" local
+	export $(pwd) 'quoted text' cd
+/usr/bin readonly | done export "$1"
+	${HOME} printf awk echo 'quoted text'
+		"$@" "$@" /usr/bin sed -eu $(pwd) $(pwd)
+cd x=1 "$1" /usr/bin -eu grep $(pwd)
+		printf 2>/dev/null $(pwd) echo $(pwd) cd test cd sed ${HOME} printf echo local
+	sed x=1 'quoted text' --verbose printf test | readonly "$@" "$@" awk printf
+		"$1" x=1 2>/dev/null test && 'quoted text'
+2>/dev/null cd 2>/dev/null "$@" "$@" grep test test printf 'quoted text'
+		test local test $(pwd) $(pwd) test
+		local cd printf --verbose done -eu x=1 | then x=1 --verbose
+awk && ${HOME} sed 2>/dev/null echo | ${HOME} echo grep --verbose
+then "$1" then local readonly /usr/bin export ${HOME} awk --verbose
+	test 'quoted text' "$@" $(pwd) cd ${HOME} 2>/dev/null
+echo | 2>/dev/null && x=1 "$1" x=1 $(pwd) "$@" then | done
+		test | "$1" "$@" "$1" "$@" 2>/dev/null grep test &&
+/usr/bin && readonly /usr/bin then ${HOME} -eu readonly --verbose
+		x=1 done printf done 2>/dev/null echo /usr/bin cd readonly
+| awk x=1 "$1" printf | export | /usr/bin "$1" readonly x=1 /usr/bin "$@"
+	sed export done "$1" ${HOME} readonly
+		test cd ${HOME} local cd grep 2>/dev/null sed done
+	grep "$1" grep "$@" ${HOME} x=1 sed grep echo test $(pwd) x=1 "$1"
+/usr/bin x=1 export $(pwd) test --verbose | test printf
+		printf awk echo -eu 2>/dev/null echo cd cd && $(pwd) printf done $(pwd) -eu
+		cd local | | | echo --verbose awk cd then grep awk then echo $(pwd)
+&& | && 'quoted text' readonly
+grep echo test grep test readonly local x=1 local | -eu 2>/dev/null test
+		"$@" awk then x=1 local "$1" echo $(pwd) printf 2>/dev/null
+	printf export && -eu "$1" echo test local printf "$@" sed $(pwd) && awk
+	$(pwd) sed local 2>/dev/null --verbose readonly
+	-eu /usr/bin awk $(pwd) --verbose x=1 local awk x=1 "$1" /usr/bin 'quoted text'
+		awk then ${HOME} awk | cd x=1 echo done && ${HOME} ${HOME} readonly --verbose
+${HOME} && $(pwd) cd ${HOME} local
+"$@" grep ${HOME} $(pwd) "$1" /usr/bin printf readonly cd &&
+		--verbose done "$1" $(pwd) export test && sed $(pwd) /usr/bin
+	printf readonly done cd --verbose /usr/bin done -eu local --verbose
+		$(pwd) local readonly -eu --verbose -eu sed export echo printf /usr/bin
+		then "$@" $(pwd) cd "$@" cd "$@" awk sed | awk grep 2>/dev/null
+	cd printf printf x=1 $(pwd) ${HOME} && --verbose export /usr/bin ${HOME}
+	| /usr/bin printf --verbose $(pwd)
+		readonly done 'quoted text' awk $(pwd) local --verbose then awk printf
+	local -eu sed 2>/dev/null test
+local | "$@" done 'quoted text' -eu then && | -eu
+"$1" 'quoted text' | local done | test readonly grep -eu "$@" x=1
+	-eu readonly sed -eu "$@" then /usr/bin export | | cd --verbose
+	printf awk cd 2>/dev/null echo 'quoted text' "$@" $(pwd) done done -eu local $(pwd)
+	test && export done awk local awk done
+		awk "$@" /usr/bin /usr/bin -eu 'quoted text' | grep then -eu ${HOME}
+	&& 'quoted text' grep awk | echo ${HOME} local "$1" | -eu
+	sed /usr/bin export 'quoted text'
+&& /usr/bin cd -eu export && /usr/bin test | readonly grep echo then local
+		'quoted text' awk -eu && then $(pwd)
+		export $(pwd) 'quoted text' printf x=1 cd --verbose test "$@" ${HOME} |
+printf 'quoted text' x=1 && awk then awk | then cd export export $(pwd) awk "$@"
+		sed | /usr/bin x=1 test local export printf
+		grep local && && 2>/dev/null then then "$@"
+printf $(pwd) echo awk x=1 echo awk | cd --verbose cd ${HOME}
+		--verbose printf ${HOME} then && 'quoted text' && ${HOME} x=1 done 2>/dev/null
+	${HOME} local export -eu ${HOME} --verbose "$@" then "$@" | then -eu
+		printf -eu test printf done ${HOME} export awk 'quoted text' 2>/dev/null
+	echo | then printf awk sed "$1" readonly test
+	export export awk | /usr/bin then printf
+		cd local test "$@" 'quoted text' /usr/bin sed x=1 2>/dev/null test /usr/bin
+		printf cd "$1" sed awk awk "$@"
+		${HOME} --verbose 2>/dev/null sed /usr/bin cd echo "$@"
+echo awk printf $(pwd) awk cd readonly "$@" printf --verbose cd export
+done ${HOME} ${HOME} --verbose
+export "$@" $(pwd) --verbose --verbose grep cd sed -eu readonly 'quoted text'
+	done --verbose sed sed grep --verbose "$1" --verbose $(pwd) && --verbose -eu /usr/bin
+		cd && $(pwd) "$@" local "$1" printf 2>/dev/null done readonly 'quoted text'
+		--verbose ${HOME} x=1 local printf 'quoted text' then x=1 awk done "$@"
+x=1 x=1 "$1" --verbose "$1"
+printf awk 'quoted text' && sed $(pwd) local ${HOME} 2>/dev/null awk test then
+	local 'quoted text' printf "$@" test -eu && test x=1 --verbose
+grep then -eu cd $(pwd) awk awk && sed export local done printf done | awk sed
+		awk then grep --verbose awk -eu ${HOME} "$1" echo /usr/bin test printf local
+		-eu -eu printf 2>/dev/null 2>/dev/null sed | grep --verbose 'quoted text'
+x=1 /usr/bin ${HOME} 2>/dev/null echo $(pwd) x=1 export --verbose $(pwd) ${HOME}
+		| echo | export -eu | then 2>/dev/null "$@" $(pwd) | /usr/bin "$@" local
+		cd then /usr/bin then cd awk readonly | local echo test export export cd ${HOME}
+"$1" 2>/dev/null "$@" then "$@"
+	-eu $(pwd) local local done
+	-eu -eu sed done awk ${HOME} done local grep
+	export ${HOME} x=1 --verbose done
+sed test printf --verbose echo "$1" /usr/bin local $(pwd) /usr/bin cd | $(pwd) &&
+--verbose awk | local
+		awk cd awk awk export echo cd | readonly echo local --verbose x=1 then ${HOME}
+		readonly then && readonly test local printf readonly
+		'quoted text' $(pwd) then test
+		--verbose --verbose test test $(pwd) export | /usr/bin
+x=1 readonly ${HOME} && printf done "$@" readonly x=1 && --verbose
+	sed sed sed | 2>/dev/null /usr/bin export local "$1" export then cd then
+#include c199.sh
+		$(pwd) sed && $(pwd) 2>/dev/null /usr/bin $(pwd) grep printf $(pwd) /usr/bin
+cd echo printf --verbose done grep
+	"$1" done readonly "$1" export sed "$@" test 'quoted text'
+printf awk /usr/bin done
+	"$1" 'quoted text' && -eu local 2>/dev/null
+		"$@" sed awk && cd && ${HOME} && grep /usr/bin $(pwd)
+	2>/dev/null "$1" /usr/bin "$@" done sed 'quoted text'
+		readonly --verbose cd local /usr/bin awk then test export &&
+		| test awk test && grep | 'quoted text' done test | "$1" /usr/bin "$@"
+		| awk -eu $(pwd) done x=1 printf sed --verbose | echo
+	done readonly test test export x=1 $(pwd)
+		export then sed grep /usr/bin --verbose ${HOME} $(pwd) export
+		local grep "$1" export | sed local grep cd done cd
+	printf 2>/dev/null grep | printf /usr/bin 'quoted text' sed
+--verbose then local printf then export 2>/dev/null -eu -eu echo --verbose ${HOME}
+		$(pwd) export done grep local awk
+		-eu export local | --verbose sed "$@" "$1" readonly $(pwd) export
+then --verbose "$@" /usr/bin done awk test ${HOME}
+		$(pwd) && "$@" sed 2>/dev/null
+	&& local cd && done "$@" --verbose sed grep
+		printf export ${HOME} /usr/bin /usr/bin 2>/dev/null "$@" printf
+/usr/bin awk x=1 2>/dev/null "$@" then sed && grep export /usr/bin 'quoted text'
+grep "$1" done -eu export grep "$@" x=1 "$@" export "$@" awk "$1" awk local
+export /usr/bin done awk grep "$1" then "$@" ${HOME} 'quoted text' done ${HOME}
+		'quoted text' -eu local cd
+		| cd readonly cd cd sed awk -eu /usr/bin done ${HOME} "$@" echo --verbose
+	awk | "$1" local /usr/bin cd x=1 export && 'quoted text' grep x=1 then
+export "$1" grep 2>/dev/null sed printf /usr/bin x=1 sed test -eu grep
+		sed readonly sed "$@" sed --verbose -eu 'quoted text'
+		test x=1 "$@" local -eu --verbose
+done echo "$1" /usr/bin x=1 test -eu export | $(pwd) echo x=1 x=1
+		done && --verbose -eu -eu echo then x=1 /usr/bin
+grep "$@" x=1 printf /usr/bin echo echo $(pwd) done
+2>/dev/null "$1" --verbose "$@" readonly && then readonly readonly
+		grep grep "$@" /usr/bin x=1 "$1" | local grep grep grep
+		&& $(pwd) /usr/bin done then printf --verbose
+	done $(pwd) | "$@" readonly "$1" "$1" && readonly -eu awk | 2>/dev/null cd $(pwd)
+	readonly awk grep ${HOME} "$1" printf then grep 2>/dev/null x=1 printf
+		x=1 'quoted text' then awk grep cd
+test | test awk -eu then readonly --verbose
+	x=1 then 2>/dev/null ${HOME} --verbose
+cd 2>/dev/null readonly printf "$1" --verbose sed export && "$1" 2>/dev/null
+awk $(pwd) "$@" "$@" $(pwd) then | | ${HOME} done 2>/dev/null
+	awk "$@" 'quoted text' --verbose sed
+sed x=1 local && then "$1" echo local x=1 cd -eu export done cd cd /usr/bin
+		readonly /usr/bin | grep | readonly /usr/bin x=1
+	/usr/bin -eu grep /usr/bin sed then export
+grep grep 2>/dev/null x=1 awk sed export --verbose then ${HOME} export
+	$(pwd) /usr/bin "$1" test echo sed test test
+	done $(pwd) echo echo printf -eu readonly readonly
+		readonly 'quoted text' then
+-eu printf ${HOME} "$1" readonly 'quoted text' grep grep /usr/bin
+	cd local 'quoted text' readonly x=1 x=1 awk --verbose -eu $(pwd)
+readonly printf --verbose sed printf
+		grep sed $(pwd) "$1" && && 2>/dev/null then test readonly
+	-eu x=1 "$1" "$1" ${HOME} readonly $(pwd) echo "$@" test export done
+	sed done /usr/bin export
+		$(pwd) sed cd -eu export 2>/dev/null
+		local sed 2>/dev/null x=1
+	local $(pwd) sed /usr/bin "$@"
+		-eu grep | $(pwd) cd x=1 grep readonly awk done sed done cd 'quoted text' sed
+	&& ${HOME} readonly ${HOME} echo "$@" -eu local echo
+	&& done 'quoted text'
+	-eu -eu printf "$1" cd then $(pwd) export then awk awk
+	then readonly x=1 'quoted text' local 2>/dev/null $(pwd) local cd -eu /usr/bin readonly
+grep awk --verbose $(pwd) $(pwd) 2>/dev/null
+	done /usr/bin /usr/bin
+	grep sed readonly readonly "$1" /usr/bin cd 'quoted text' | && done export "$@"
+		then x=1 awk /usr/bin 'quoted text' grep "$@" "$@" cd done export x=1 local
+awk export printf test "$1" $(pwd) 2>/dev/null -eu $(pwd)
+		grep awk cd sed 2>/dev/null -eu echo /usr/bin local sed sed "$1" | --verbose
+	x=1 $(pwd) cd then cd cd test | awk grep grep
+	-eu done test | echo local export ${HOME} export $(pwd) echo cd /usr/bin
+		2>/dev/null | then cd $(pwd) local echo export
+		'quoted text' done sed
+	&& ${HOME} readonly 2>/dev/null
+	| grep export cd && 'quoted text'
+--verbose ${HOME} sed /usr/bin x=1 then local export 'quoted text'
+		/usr/bin "$1" -eu -eu x=1 -eu --verbose readonly done awk x=1 printf awk "$@"
+		local 2>/dev/null ${HOME} then "$1" "$@" x=1 echo readonly
+	2>/dev/null "$@" printf x=1 2>/dev/null echo export done test
+		x=1 readonly grep | /usr/bin -eu | printf test | then "$@" local
+	export && "$1" done test grep --verbose $(pwd)
+	$(pwd) grep grep then local awk
+		| "$@" 'quoted text' "$@" then local
+		echo readonly echo x=1 $(pwd)
+		printf ${HOME} -eu | printf grep done
+test done | $(pwd) awk x=1 test local export ${HOME} printf awk local -eu then
+		x=1 awk printf $(pwd) ${HOME}
+		export -eu && "$1" 'quoted text' 2>/dev/null awk && printf x=1 "$1" printf
+/usr/bin | ${HOME} --verbose
+done $(pwd) printf then "$1" "$1"
+		| sed grep done sed sed local
+		${HOME} $(pwd) "$@" 'quoted text'
+echo | cd local 2>/dev/null
+	"$1" local /usr/bin sed "$@" done echo grep /usr/bin sed 'quoted text'
+	"$1" | then local test sed local $(pwd) readonly grep cd && local "$1"
+		done "$@" x=1 x=1 sed "$@" echo --verbose | | 'quoted text'
+2>/dev/null test | done
+	$(pwd) test echo printf local && "$@" x=1 local printf
+	/usr/bin grep "$@" $(pwd) && --verbose 'quoted text' | echo x=1
+		${HOME} sed $(pwd) "$1" sed then printf readonly $(pwd) readonly printf
+"$@" awk 2>/dev/null "$1" local printf done
+"$1" 2>/dev/null awk "$@" local cd ${HOME} -eu | 'quoted text'
+'quoted text' printf "$@" "$1" awk /usr/bin cd sed $(pwd) ${HOME} export && awk
+'quoted text' printf "$@" echo grep export awk --verbose
+	readonly done && x=1 && printf printf x=1 2>/dev/null "$@" readonly then x=1
+		| local ${HOME} | printf 'quoted text'
+then $(pwd) "$@" sed test && --verbose "$1" awk sed -eu cd 'quoted text'
+	$(pwd) grep -eu x=1 'quoted text' 'quoted text' 'quoted text' sed
+		then export /usr/bin printf x=1 readonly
+		cd awk x=1 "$1" cd 2>/dev/null cd x=1 readonly | ${HOME} local sed done
+	"$@" "$1" test readonly /usr/bin printf
+		local 'quoted text' && -eu x=1 local && then "$@" 'quoted text'
+| /usr/bin /usr/bin export ${HOME} done done ${HOME}
+		printf $(pwd) sed /usr/bin sed 2>/dev/null
+	x=1 x=1 /usr/bin && cd readonly test "$1" readonly -eu -eu | 2>/dev/null &&
+		grep echo readonly 2>/dev/null printf
+	done test sed echo | "$1" /usr/bin awk ${HOME} local | test --verbose
+		sed "$@" then /usr/bin 'quoted text' awk readonly then
+/usr/bin -eu cd "$1"
+export && 'quoted text' cd "$@" printf grep -eu "$@" local cd done -eu
+		/usr/bin 2>/dev/null
+-eu printf --verbose --verbose awk sed echo printf grep sed
+| -eu x=1 echo awk export ${HOME} done test "$1" 2>/dev/null readonly
+		${HOME} "$@" x=1 echo x=1 $(pwd) "$@" | done export sed $(pwd)
+	sed then --verbose test grep export | done awk
+/usr/bin 2>/dev/null then grep export sed 'quoted text' awk -eu
+		awk readonly x=1 printf local done
+printf echo $(pwd) export $(pwd) local done readonly
+	echo then then echo done /usr/bin "$@" test x=1 'quoted text' grep
+then "$1" printf | grep --verbose ${HOME} 'quoted text'
+		${HOME} 'quoted text' && --verbose --verbose
+	--verbose done grep awk ${HOME} printf printf 2>/dev/null
+	2>/dev/null cd export done done
+		local --verbose then awk awk printf cd
+'quoted text' sed test readonly 'quoted text'
+		-eu printf printf readonly "$@" 'quoted text' && "$1"
+	then /usr/bin $(pwd) awk grep $(pwd) test -eu
+2>/dev/null grep then
+printf done local "$@" cd
+	done then cd readonly export echo
+		'quoted text' /usr/bin | "$1" export
+awk grep export printf 2>/dev/null
+		test 2>/dev/null 2>/dev/null $(pwd) awk 'quoted text' x=1 ${HOME}
+	printf sed echo $(pwd) $(pwd) done 2>/dev/null
+		$(pwd) --verbose $(pwd)
+2>/dev/null -eu --verbose sed done readonly grep awk "$@" /usr/bin "$1" cd cd
+	x=1 'quoted text' | 'quoted text' "$@" echo
+		2>/dev/null --verbose 2>/dev/null -eu 2>/dev/null 'quoted text'
+/usr/bin test then awk
+then ${HOME} awk "$1" | local $(pwd) local export export -eu 'quoted text'
+		"$@" printf grep local "$1"
+		'quoted text' "$@" echo done "$1" $(pwd) then "$1"
+done echo awk "$@" sed 2>/dev/null then grep test echo x=1 export grep
+&& 2>/dev/null export ${HOME}
+cd export then awk printf 'quoted text' done 'quoted text'
+	awk grep ${HOME} awk awk sed
+	2>/dev/null 'quoted text'
+	printf 2>/dev/null readonly test then "$@" --verbose readonly /usr/bin grep test
+	export cd export readonly done /usr/bin printf 'quoted text'
+		awk -eu done "$@" x=1 export /usr/bin -eu done readonly sed
+export echo -eu --verbose --verbose
+		-eu awk ${HOME} && 'quoted text' grep "$@" cd $(pwd) grep local "$1" /usr/bin
+	2>/dev/null readonly cd 'quoted text' cd echo done --verbose grep -eu echo x=1 grep
+	test --verbose export local /usr/bin "$1"
+	then readonly export ${HOME} sed
+printf "$1" readonly done cd "$1" 'quoted text' readonly
+	$(pwd) 2>/dev/null printf
+	${HOME} ${HOME} grep then
+done printf $(pwd) then /usr/bin
+"$@" test | export -eu 2>/dev/null $(pwd) "$1" export export -eu local | 'quoted text'
+		"$@" cd export x=1 local
+awk awk "$@" 2>/dev/null grep
+		readonly sed "$@" 'quoted text' cd echo printf ${HOME}
+		cd ${HOME} $(pwd) | export -eu
+&& -eu printf --verbose readonly printf "$@"
+| sed local x=1 test | "$@" ${HOME} ${HOME} -eu then | --verbose local ${HOME}
+		${HOME} printf readonly cd --verbose "$1" | -eu echo printf -eu echo then -eu
+		then ${HOME} ${HOME} "$@" 2>/dev/null "$1" cd echo grep 'quoted text'
+	grep then $(pwd) cd awk "$@" then 'quoted text' /usr/bin echo then
+	/usr/bin && | sed cd "$1" --verbose echo ${HOME} 'quoted text'
+${HOME} 'quoted text' test /usr/bin "$1" printf export then readonly && /usr/bin
+	then test "$@" ${HOME} 'quoted text'
+sed printf echo /usr/bin grep grep done --verbose 2>/dev/null test then 2>/dev/null
+--verbose /usr/bin 2>/dev/null 2>/dev/null ${HOME} -eu ${HOME} then test 'quoted text'
+		sed local 2>/dev/null awk --verbose sed local test ${HOME} echo x=1 --verbose local
+		--verbose $(pwd) -eu awk export export grep /usr/bin x=1
+	test cd local /usr/bin 2>/dev/null | export /usr/bin
+		${HOME} ${HOME} && 2>/dev/null "$@" x=1 $(pwd) readonly grep
+		-eu "$@" grep "$@" export ${HOME}
+&& readonly printf echo echo test 'quoted text'
+		&& 2>/dev/null && --verbose /usr/bin awk then
+test awk 'quoted text' -eu sed local cd echo
+	| export readonly echo awk "$1" local readonly | awk awk grep | --verbose
+	sed $(pwd) export "$1" export printf 'quoted text' done cd /usr/bin
+	x=1 2>/dev/null then grep --verbose local
+printf printf --verbose printf 2>/dev/null | echo x=1 &&
+		"$@" then 2>/dev/null local grep /usr/bin /usr/bin ${HOME} "$1" done cd
+		printf awk ${HOME} readonly --verbose 'quoted text'
+	/usr/bin "$@" -eu export 2>/dev/null printf
+	cd /usr/bin $(pwd) then then export
+	"$@" 2>/dev/null 'quoted text' ${HOME} then sed export
+		awk readonly awk printf "$1" x=1 sed local "$@" /usr/bin /usr/bin then printf
+	done printf 'quoted text' x=1 2>/dev/null
+		-eu ${HOME} "$@" -eu test 'quoted text' "$1" "$@" echo /usr/bin
+	readonly $(pwd) | printf "$@" "$1" printf 2>/dev/null export awk && "$@" printf
+2>/dev/null done x=1 readonly local "$1" printf
+	x=1 printf cd "$1" "$@" readonly local
+		x=1 then && 'quoted text'
+cd awk printf "$@" --verbose
+$(pwd) sed $(pwd) | readonly
+		$(pwd) --verbose readonly --verbose then
+	x=1 x=1 /usr/bin --verbose then "$@" "$@" ${HOME} "$@" cd
+		'quoted text' "$@" /usr/bin awk 2>/dev/null
+	local then done ${HOME} /usr/bin local sed readonly
+	test local printf && x=1 'quoted text'
+	&& "$1" x=1 echo "$@" 'quoted text' cd "$@"
+	${HOME} | /usr/bin grep sed ${HOME} x=1 awk -eu | done x=1
+local export test readonly -eu && cd grep /usr/bin done
+		&& echo /usr/bin "$@" awk readonly "$1"
+	-eu echo x=1 readonly x=1 "$@" cd /usr/bin
+done printf && $(pwd) awk readonly readonly 2>/dev/null
+		--verbose "$1" done cd readonly local printf export export --verbose
+	$(pwd) -eu awk echo "$1" export sed --verbose local grep
+'quoted text' readonly 'quoted text' printf "$1" readonly --verbose
+		test cd --verbose | && x=1 done "$1" then echo &&
+	sed printf x=1 done --verbose 'quoted text'
+	sed printf && printf grep | "$@" cd | local | awk --verbose grep cd local
+	| then /usr/bin cd ${HOME} awk -eu done
+	done && $(pwd) && "$@" -eu ${HOME} /usr/bin done |
+		/usr/bin ${HOME} printf $(pwd) test
+		local | $(pwd) awk "$@" 2>/dev/null
+		"$@" sed ${HOME} -eu && ${HOME} --verbose -eu sed x=1 "$@" x=1 | "$1"
+	echo awk $(pwd) local /usr/bin 'quoted text' -eu awk readonly && done echo
+test grep "$@" export "$@" readonly "$@" local /usr/bin 'quoted text' $(pwd)
+	$(pwd) export 2>/dev/null awk readonly
+done echo echo "$@" grep 'quoted text' -eu awk "$1" | grep
+local local 2>/dev/null sed "$@" done then 'quoted text' 2>/dev/null 'quoted text'
+	done local $(pwd) "$1" test
+local printf | 2>/dev/null test x=1 --verbose
+		cd grep echo | --verbose awk
+--verbose && "$1" ${HOME} grep then 'quoted text'
+	&& echo 'quoted text' x=1 2>/dev/null "$@" /usr/bin ${HOME}
+	/usr/bin done -eu x=1 local "$1" sed
+-eu | | ${HOME} "$@" done && echo done "$@" ${HOME}
+	$(pwd) test cd grep done export awk cd && test awk then grep sed grep echo
+test 2>/dev/null test export $(pwd) 'quoted text' 'quoted text'
+sed cd readonly -eu export
+	cd -eu then $(pwd) then export
+	--verbose cd ${HOME} readonly
+cd then printf done local -eu sed -eu | then
+--verbose sed "$1" "$1" sed grep /usr/bin cd sed grep test cd test x=1 x=1 awk
+	${HOME} $(pwd) export then readonly 2>/dev/null -eu && then
+		done 'quoted text' "$1" $(pwd) "$@" -eu --verbose
+		cd 2>/dev/null cd echo local $(pwd) 2>/dev/null 2>/dev/null
+		&& export then | "$@" --verbose |
+'quoted text' export -eu -eu 'quoted text' done
+"$1" local then 'quoted text' test done local readonly then 2>/dev/null test
+		'quoted text' "$@" | grep --verbose echo sed sed /usr/bin
+sed -eu && cd "$1" then export readonly local -eu
+/usr/bin 'quoted text' --verbose cd "$1" --verbose | ${HOME} cd $(pwd)
+		export then "$1" /usr/bin
+		-eu awk readonly grep "$@" ${HOME} echo
+		&& done | export test $(pwd) done echo $(pwd) 'quoted text'
+printf done $(pwd) 'quoted text' export
+-eu printf x=1 local ${HOME} $(pwd) readonly "$@" awk --verbose
+cd cd grep --verbose --verbose test -eu -eu $(pwd) | 2>/dev/null
+"$1" -eu printf | ${HOME} "$1" && "$1" then readonly "$@" "$@" -eu then
+&& --verbose ${HOME} x=1 | then && sed cd "$1" 'quoted text'
+		"$1" test "$1" cd 2>/dev/null awk export done --verbose readonly awk /usr/bin
+	readonly -eu sed /usr/bin $(pwd) sed sed x=1 x=1 cd sed
+readonly echo "$@" readonly | $(pwd) echo /usr/bin test --verbose /usr/bin /usr/bin
+	'quoted text' && --verbose 'quoted text' test local
+	"$1" 2>/dev/null "$1" | $(pwd) "$@"
+		2>/dev/null /usr/bin | x=1 readonly
+$(pwd) 'quoted text' local "$@" done local local --verbose --verbose grep then
+	x=1 export awk cd $(pwd) --verbose printf --verbose sed |
+		2>/dev/null awk done /usr/bin --verbose then echo echo sed
+		${HOME} --verbose test sed ${HOME} sed echo export ${HOME} --verbose
+"$@" local 2>/dev/null
+	readonly "$1" readonly 'quoted text' done $(pwd) sed readonly then test && /usr/bin
+"$@" awk then ${HOME} test --verbose 2>/dev/null x=1
+		test 'quoted text' export done printf
+	awk then 2>/dev/null sed ${HOME} /usr/bin done local done
+--verbose cd --verbose grep sed x=1 /usr/bin awk $(pwd)
+--verbose "$1" $(pwd) -eu | cd "$@" readonly && --verbose $(pwd)
+		grep grep | local printf "$1" cd ${HOME} "$1"
+'quoted text' grep "$1" grep
+		--verbose -eu $(pwd) ${HOME} done echo cd export echo export sed
+		echo 'quoted text' awk && cd 2>/dev/null
+	"$@" --verbose $(pwd) 'quoted text'
+	done ${HOME} awk awk printf x=1 grep ${HOME} 'quoted text'
+	then cd local grep "$1" test $(pwd) echo
+"$@" ${HOME} /usr/bin grep --verbose ${HOME} -eu awk --verbose x=1 "$1" done
+		sed "$@" | x=1 printf "$1"
+		export grep sed ${HOME} done 2>/dev/null
+	readonly grep /usr/bin readonly grep ${HOME} "$@" "$1" "$1" "$@" local grep --verbose
+-eu export export done ${HOME} --verbose
+$(pwd) export -eu "$1" export 2>/dev/null -eu && export sed awk --verbose
+test printf ${HOME} $(pwd) then echo
+echo --verbose echo "$1" done grep
+		&& grep export printf sed printf printf awk -eu -eu -eu "$@" "$@" "$@"
+2>/dev/null | 2>/dev/null && then ${HOME} "$@" 2>/dev/null echo
+readonly done 'quoted text' 'quoted text' local printf "$1" awk done
+		"$1" "$1" 2>/dev/null readonly && done && export then | |
+	then "$1" cd grep && echo /usr/bin $(pwd) echo
+		awk sed 'quoted text' test readonly local $(pwd)
+$(pwd) --verbose cd awk sed "$1" local sed -eu test
+		x=1 "$@" local then awk sed sed && 'quoted text'
+	printf && readonly local 'quoted text' | "$@" &&
+		${HOME} test "$1" grep --verbose awk && /usr/bin -eu then 2>/dev/null test
+"$@" $(pwd) echo readonly echo echo $(pwd)
+		"$@" "$1" echo export then export local echo "$@" -eu done /usr/bin
+	'quoted text' awk /usr/bin local ${HOME} ${HOME} $(pwd) done -eu cd "$@"
+done "$@" x=1 sed done /usr/bin
+	| x=1 test x=1 | --verbose $(pwd) done local $(pwd) --verbose test "$@" done done
+-eu done "$@" && | printf sed
+	-eu local then grep $(pwd) 'quoted text' | done cd 'quoted text'
+		| printf export /usr/bin test export
+printf local test ${HOME} -eu ${HOME}
+		cd $(pwd) echo local test readonly then -eu && --verbose readonly ${HOME}
+test "$1" ${HOME} --verbose test
+| | cd done sed then x=1 cd x=1 then cd --verbose echo printf
+	/usr/bin readonly echo done /usr/bin done && "$@" "$1" /usr/bin -eu && 2>/dev/null
+readonly printf grep readonly echo local "$@" done cd x=1 printf
+		export && export test cd grep grep test awk x=1 /usr/bin && then printf
+local readonly /usr/bin --verbose grep echo
+	${HOME} then readonly
+		local local 'quoted text' $(pwd) -eu done
+		echo printf 'quoted text'
+	echo grep local 'quoted text' done awk
+${HOME} x=1 ${HOME} | "$1" /usr/bin echo cd "$@" x=1 cd -eu test awk && 'quoted text'
+	"$1" x=1 2>/dev/null sed echo "$@" 2>/dev/null $(pwd) cd x=1 local --verbose
+2>/dev/null "$@" local printf && "$1" 'quoted text' x=1 echo
+	echo 'quoted text' export
+2>/dev/null cd readonly x=1 test && | done cd "$@"
+printf test echo && "$1" printf
+		readonly printf ${HOME} | local $(pwd) | local printf test
+| 'quoted text' x=1 | grep done echo $(pwd) then local "$1" export test "$@" 'quoted text'
+	/usr/bin /usr/bin "$@" 'quoted text'
+	echo local x=1 then readonly -eu -eu local | awk "$@"
+	grep sed | /usr/bin grep x=1 | printf test echo /usr/bin ${HOME} x=1 echo x=1 printf
+	readonly local local -eu done 2>/dev/null test /usr/bin $(pwd)
+	"$1" export sed && cd --verbose $(pwd) local echo x=1 x=1
+2>/dev/null local printf echo printf
+		test done echo ${HOME} /usr/bin sed
+test | sed then grep x=1 grep | readonly
+		local then x=1 $(pwd) printf printf export
+		$(pwd) --verbose grep ${HOME}
+		"$1" readonly --verbose "$1" -eu awk -eu | 2>/dev/null
+awk printf awk -eu cd $(pwd) 2>/dev/null
+printf ${HOME} readonly 'quoted text' && sed awk then test 2>/dev/null | readonly
+	readonly | --verbose && done --verbose grep --verbose cd then "$@" local |
+		-eu -eu local test readonly | $(pwd) | then /usr/bin readonly
+		| -eu /usr/bin | grep grep done grep
+		x=1 | 2>/dev/null awk ${HOME}
+		echo done /usr/bin -eu $(pwd) ${HOME} cd then done
+test sed awk ${HOME} -eu export "$@" ${HOME} done grep -eu grep ${HOME}
+	local /usr/bin --verbose x=1 --verbose sed readonly --verbose awk
+		/usr/bin done printf | "$1" $(pwd) readonly
+	test echo echo $(pwd) sed cd grep local sed
+		awk done awk cd && export 'quoted text' test sed export
+		test "$@" printf sed $(pwd) done | test --verbose then
+then export sed "$1" "$1" test grep awk /usr/bin "$1" printf
+local done echo readonly then && cd echo test
+		sed $(pwd) --verbose echo 2>/dev/null printf then sed export
+&& "$1" "$1" awk --verbose && printf "$1" sed export export
+		export ${HOME} export x=1 | "$@" 'quoted text' --verbose ${HOME}
+	local x=1 | awk | $(pwd) --verbose | | then ${HOME} readonly
+		&& echo printf grep 'quoted text' /usr/bin $(pwd)
+		grep --verbose && readonly sed cd -eu test $(pwd) readonly && then echo
+	sed export grep "$@" $(pwd) 'quoted text'
+	$(pwd) done echo done | awk printf echo export 'quoted text' cd "$@" readonly
+		printf ${HOME} | "$1" --verbose "$1" /usr/bin -eu export export x=1 test sed export
+"$@" grep --verbose printf cd -eu echo grep local grep 2>/dev/null
+	x=1 awk && test "$@" echo 2>/dev/null printf 'quoted text' local
+		$(pwd) /usr/bin done printf
+/usr/bin cd ${HOME} x=1 -eu --verbose | x=1 cd
+		| -eu then export 2>/dev/null
+echo --verbose export grep /usr/bin cd readonly "$1" export readonly
+		--verbose printf awk --verbose readonly ${HOME} && then
+		"$@" then --verbose $(pwd) && "$1" readonly
+test then | /usr/bin grep awk --verbose
+export "$@" test readonly done "$1" cd done -eu
+		cd x=1 | ${HOME} "$@" --verbose
+		printf "$1" $(pwd) "$1" -eu --verbose
+	${HOME} --verbose cd "$@" export ${HOME} local /usr/bin echo
+	then local "$1" 'quoted text' "$@" readonly
+	&& 'quoted text' then 2>/dev/null $(pwd)
+	${HOME} "$1" printf grep $(pwd) test echo "$@" 'quoted text' test 2>/dev/null
+		printf $(pwd) ${HOME} awk -eu awk sed then "$1" "$1"
+	x=1 "$@" "$@" 'quoted text' then export
+	export && && 2>/dev/null test awk echo printf
+	${HOME} x=1 ${HOME} test done cd awk then -eu --verbose
+$(pwd) local export 2>/dev/null grep && && && export awk printf
+'quoted text' && echo --verbose awk grep then local "$@" printf
+	&& then "$1" | sed ${HOME} grep sed -eu ${HOME} -eu /usr/bin 2>/dev/null
+grep x=1 grep ${HOME} grep printf echo done printf export
+echo echo grep readonly && awk x=1 printf
+	x=1 $(pwd) export local 'quoted text' 2>/dev/null | /usr/bin -eu echo 2>/dev/null
+		/usr/bin done 2>/dev/null "$1" readonly $(pwd) $(pwd) "$1" then -eu
+&& readonly $(pwd) awk /usr/bin local done "$1" echo echo 2>/dev/null
+test grep --verbose export awk "$@" local && "$@" "$1" -eu
+	cd cd test awk cd "$1" test printf local awk -eu 2>/dev/null printf
+x=1 && "$@" echo 'quoted text' local printf local | grep
+		awk ${HOME} test grep x=1 "$@"
+	grep --verbose awk export local 'quoted text'
+		"$1" echo && | cd cd export "$1" /usr/bin
+cd test printf ${HOME} ${HOME} --verbose 'quoted text' echo
+	&& local grep grep | then ${HOME} "$1" echo | x=1 readonly 'quoted text' local test
+	awk local awk -eu then printf 2>/dev/null done ${HOME} "$1" grep sed ${HOME}
+export | $(pwd) export /usr/bin readonly
+	test readonly test $(pwd) ${HOME} grep x=1 $(pwd) "$1" readonly export local
+		export printf sed /usr/bin then "$1" ${HOME} 2>/dev/null cd --verbose sed export
+cd readonly grep export "$1" "$1" | awk done then then awk echo then then cd
+		--verbose readonly awk 2>/dev/null && | ${HOME} "$@"
+$(pwd) | --verbose then | test printf ${HOME}
+	readonly /usr/bin 'quoted text' test then printf "$@" cd done -eu $(pwd) sed &&
+	'quoted text' $(pwd) | 2>/dev/null
+printf && $(pwd) sed echo -eu then
+		${HOME} "$@" 'quoted text' && awk grep done ${HOME} --verbose 2>/dev/null 2>/dev/null
+		$(pwd) awk x=1 cd done /usr/bin
+		| sed grep $(pwd) 2>/dev/null test then test "$1" echo
+	readonly sed cd test then readonly done x=1 grep test &&
+		export $(pwd) grep 'quoted text' done local awk --verbose
+x=1 "$@" awk && done export $(pwd) ${HOME} test
+| -eu $(pwd) "$@" ${HOME} sed grep /usr/bin readonly test
+cd | --verbose grep printf -eu sed /usr/bin export && /usr/bin
+		readonly echo printf done test test | grep
+		echo printf ${HOME} local then done done x=1 test echo export
+$(pwd) done ${HOME} && -eu 'quoted text' cd grep --verbose readonly
+		/usr/bin done export 2>/dev/null --verbose
+		test --verbose readonly
+	"$1" 'quoted text' sed readonly grep local echo "$1" &&
+		cd /usr/bin && x=1 awk done export ${HOME} && awk 2>/dev/null && echo
+	"$@" cd 2>/dev/null sed local "$@" then done "$1" test
+		'quoted text' 2>/dev/null | /usr/bin "$1" | "$1" 'quoted text'
+		"$@" grep 'quoted text' export "$@" $(pwd) local && then export --verbose
+	&& 2>/dev/null 'quoted text' sed
+		${HOME} printf && 'quoted text' -eu readonly
+--verbose /usr/bin sed x=1 -eu
+		2>/dev/null printf then /usr/bin local "$@" then | cd x=1 'quoted text'
+	sed 2>/dev/null "$1" /usr/bin test "$1" "$@" | test readonly && x=1
+	readonly ${HOME} /usr/bin export then x=1
+	local awk grep -eu -eu printf
+		2>/dev/null $(pwd) test grep $(pwd) readonly echo -eu export awk "$@" done
+		readonly 2>/dev/null /usr/bin 'quoted text' local && done sed cd then
+readonly /usr/bin done test export local ${HOME}
+	local /usr/bin "$@" grep 'quoted text'
+$(pwd) printf done && readonly
+		sed x=1 && && --verbose cd sed local echo
+	${HOME} && $(pwd) echo echo awk 'quoted text'
+	export export 2>/dev/null awk | && -eu -eu sed && /usr/bin test awk
+--verbose then "$@" $(pwd) && sed cd | 2>/dev/null then sed
+$(pwd) then && then x=1 readonly && /usr/bin | local | awk then -eu readonly
+then cd then "$@" export cd "$1" grep readonly "$1" | awk readonly
+${HOME} then 2>/dev/null then 2>/dev/null
+	sed printf -eu --verbose /usr/bin local awk ${HOME} done 'quoted text'
+	awk -eu 2>/dev/null && -eu /usr/bin sed $(pwd)
+	x=1 done then export printf "$1" /usr/bin
+	done -eu | sed local grep readonly
+	cd grep -eu echo "$@" /usr/bin cd ${HOME}
+	export ${HOME} local test 'quoted text' "$@" && sed "$1" "$1" done cd /usr/bin
+cd 2>/dev/null then --verbose ${HOME} 2>/dev/null "$@"
+	-eu ${HOME} /usr/bin 2>/dev/null
+		printf "$1" test printf export printf $(pwd)
+	&& sed 2>/dev/null 'quoted text'
+then | "$@" awk awk && "$1" 2>/dev/null $(pwd) "$@" 'quoted text'
+cd echo "$@" local --verbose
+"$@" sed local awk sed echo then printf export
+	printf -eu /usr/bin done done sed $(pwd)
+	readonly ${HOME} 'quoted text' done export then
+	printf $(pwd) then $(pwd) | --verbose /usr/bin
+	printf /usr/bin cd readonly
+-eu --verbose printf readonly awk echo test x=1 $(pwd) 'quoted text' "$1"
+		done /usr/bin 'quoted text'
+${HOME} --verbose 'quoted text' && sed readonly cd printf
+2>/dev/null | ${HOME} -eu /usr/bin 2>/dev/null "$@" -eu $(pwd) $(pwd)
+readonly echo export "$1" test "$@" $(pwd) 2>/dev/null grep x=1
+		export echo "$1" "$1" "$1" 'quoted text' grep && 2>/dev/null "$@" sed echo cd
+	test grep done echo $(pwd) cd echo 'quoted text'
+&& --verbose /usr/bin test --verbose | local sed | export && local 2>/dev/null
+		"$@" test done grep | grep 'quoted text'
+		${HOME} --verbose 2>/dev/null done
+grep "$@" local ${HOME} 'quoted text'
+| sed local then then ${HOME} cd grep
+		awk 'quoted text' 2>/dev/null cd 2>/dev/null export cd done ${HOME}
+	| && local x=1 'quoted text' "$@"
+	then sed done test | -eu "$@" --verbose
+		x=1 readonly then export sed x=1 sed /usr/bin export | grep export
+		--verbose printf export export grep printf local local
+	then "$1" test $(pwd) -eu
+	sed $(pwd) then --verbose then -eu grep 'quoted text' $(pwd) then test sed
+	-eu printf done /usr/bin
+	done 'quoted text' x=1 --verbose /usr/bin echo readonly local ${HOME}
+	cd /usr/bin echo grep 2>/dev/null
+		| test --verbose grep test x=1 'quoted text' export
+	export local /usr/bin grep readonly
+	| echo $(pwd) "$1" grep awk printf | ${HOME} then "$1" then
+"$1" $(pwd) cd export export awk $(pwd) readonly "$1" grep -eu $(pwd) x=1
+		| then | done sed readonly export --verbose done test 'quoted text' awk
+		export printf 2>/dev/null readonly done x=1 'quoted text' $(pwd)
+then -eu ${HOME} cd export && 2>/dev/null done "$@" /usr/bin
+	export awk cd /usr/bin local grep grep then grep echo then $(pwd) "$1" cd
+$(pwd) printf local x=1 | && echo echo grep && sed local readonly /usr/bin
+		then 2>/dev/null "$@" export
+x=1 ${HOME} -eu ${HOME} | printf export
+	awk sed $(pwd) readonly ${HOME} --verbose "$@" | x=1 then -eu done then "$@"
+		done && /usr/bin 2>/dev/null 2>/dev/null --verbose && 2>/dev/null
+		"$@" 2>/dev/null $(pwd) | awk then done cd sed --verbose local
+	${HOME} sed 2>/dev/null "$@" test --verbose | ${HOME} && done done awk $(pwd)
+	/usr/bin && then "$1" local
+	-eu local 'quoted text' local grep "$1" echo local grep sed | $(pwd) test
+	done test echo 'quoted text' test
+test | 2>/dev/null grep /usr/bin readonly && | -eu test sed /usr/bin
+		awk grep 'quoted text' | -eu $(pwd) local done 2>/dev/null x=1 $(pwd)
+x=1 cd --verbose ${HOME} export | local echo cd | done test 2>/dev/null
+	$(pwd) awk "$1" -eu sed local
+		| /usr/bin 'quoted text' "$1" cd 'quoted text' $(pwd) /usr/bin
+x=1 "$1" ${HOME} /usr/bin export cd cd
+	| x=1 grep && ${HOME} then printf "$1" readonly printf &&
+		printf "$@" awk 'quoted text' /usr/bin --verbose ${HOME}
+		grep test 2>/dev/null && /usr/bin 'quoted text'
+	cd 2>/dev/null awk grep
+		then x=1 /usr/bin awk /usr/bin grep ${HOME}
+		printf then --verbose -eu export awk test
+	local done done --verbose then then 'quoted text' awk
+&& readonly 'quoted text' 2>/dev/null | $(pwd) export done then 2>/dev/null
+export && done $(pwd) $(pwd) export printf echo ${HOME} |
+		printf done /usr/bin awk awk awk echo
+		export readonly readonly "$@" awk "$1" export "$1" 2>/dev/null "$1" x=1 then
+		${HOME} export cd export done export grep awk test
+x=1 echo x=1 printf done --verbose printf "$1" 'quoted text'
+		awk export $(pwd) "$1" export cd "$@" "$@" printf awk -eu test cd -eu awk
+		--verbose /usr/bin && && awk --verbose
+printf 2>/dev/null grep then 2>/dev/null ${HOME} export cd
+		${HOME} 'quoted text' echo test test sed cd printf printf 2>/dev/null
+	readonly then "$1" grep && "$1" 'quoted text' grep -eu echo --verbose
+	grep -eu ${HOME} | readonly $(pwd) sed
+		--verbose test awk ${HOME} 2>/dev/null ${HOME} 'quoted text'
+export 'quoted text' cd echo awk
+	awk test test test /usr/bin "$1" echo -eu "$1" cd
+		sed cd x=1 then 2>/dev/null export "$1" sed && -eu ${HOME} cd "$1" awk
+2>/dev/null ${HOME} -eu 2>/dev/null && cd && printf
+${HOME} | "$1" 2>/dev/null then
+${HOME} 'quoted text' export ${HOME} && echo "$@"
+2>/dev/null cd -eu grep | ${HOME}
+grep done | x=1 done "$@" /usr/bin
+		"$@" grep test | -eu && --verbose
+	x=1 | && -eu sed awk && $(pwd) 'quoted text'
+	2>/dev/null "$1" ${HOME} $(pwd)
+		-eu cd then --verbose local echo grep -eu cd
+	x=1 test sed 'quoted text'
+		"$1" 2>/dev/null grep then "$1" cd
+		--verbose test && readonly echo printf local echo grep 2>/dev/null then
+		/usr/bin cd && "$@" printf --verbose -eu printf
+		--verbose "$@" export cd sed sed done "$1" "$1" "$1"
+x=1 /usr/bin && awk "$1" "$@" cd export x=1 sed --verbose
+	"$@" && "$1" 'quoted text' cd then cd export export printf echo grep
+		-eu /usr/bin echo printf echo export printf -eu --verbose cd "$1"
+	export local printf echo cd export
+echo local done done then -eu "$@" $(pwd) test && --verbose grep
+	printf && echo | | "$1" echo 'quoted text' cd "$1" done -eu
+x=1 then -eu test done echo awk sed 'quoted text' "$1" readonly done echo
+	/usr/bin -eu /usr/bin -eu printf /usr/bin grep then readonly 2>/dev/null
+	local $(pwd) ${HOME} sed then "$@"
+		grep awk | 'quoted text' awk sed $(pwd) readonly printf /usr/bin
+sed | 'quoted text' done && sed $(pwd)
+		| -eu x=1 --verbose awk $(pwd) -eu then done cd then
+	export ${HOME} cd && | &&
+x=1 then 2>/dev/null echo --verbose && -eu /usr/bin cd awk /usr/bin
+	awk grep sed 'quoted text' "$@" printf | -eu
+		&& then then | 2>/dev/null done && && "$1"
+"$@" grep done test export sed && ${HOME} --verbose cd x=1 done 'quoted text'
+-eu readonly && x=1 awk export /usr/bin --verbose cd "$@" --verbose
+	done ${HOME} grep -eu "$1" cd
+	cd export && -eu readonly && --verbose done 2>/dev/null
+readonly 2>/dev/null export --verbose -eu export printf readonly printf -eu
+-eu awk | && "$1" $(pwd) | $(pwd) -eu x=1 ${HOME} then cd $(pwd) printf && local
+	test awk -eu "$@" $(pwd) test x=1
+	readonly "$@" export ${HOME} "$1" | $(pwd) echo cd && sed local cd 2>/dev/null
+		/usr/bin echo printf test done 'quoted text' "$@" echo
+	grep awk local test 'quoted text' then
+awk printf /usr/bin x=1 echo local done -eu sed done
+	| 2>/dev/null 2>/dev/null awk then done /usr/bin local readonly
+local -eu readonly local test readonly ${HOME}
+	printf 2>/dev/null then x=1 sed "$@" then -eu
+2>/dev/null | export "$1" awk 'quoted text' 2>/dev/null /usr/bin x=1 cd /usr/bin
+		'quoted text' readonly ${HOME} 'quoted text' then x=1 2>/dev/null test test readonly
+&& /usr/bin printf 'quoted text' 'quoted text'
+	"$@" | --verbose /usr/bin $(pwd) /usr/bin then printf "$1"
+	| -eu export echo /usr/bin test grep done 'quoted text' x=1 sed
+		sed 'quoted text' awk "$@" then done --verbose
+echo 'quoted text' readonly
+	"$1" done 2>/dev/null $(pwd) cd test | $(pwd) grep export
+		then 'quoted text' /usr/bin /usr/bin done | printf export ${HOME}
+&& -eu 'quoted text' awk cd ${HOME} cd "$1" cd 'quoted text'
+test 2>/dev/null sed grep
+		2>/dev/null $(pwd) 'quoted text'
+| "$@" done export then sed echo "$1" then export local awk
+	/usr/bin echo -eu sed x=1 printf grep --verbose 'quoted text' grep then /usr/bin
+done export && ${HOME} | ${HOME} readonly 'quoted text'
+		grep /usr/bin ${HOME} $(pwd) grep
+	x=1 local ${HOME} local test /usr/bin $(pwd)
+		'quoted text' | export --verbose grep cd "$1" $(pwd) readonly
+cd done readonly echo readonly
+		"$1" -eu 'quoted text' then
+readonly $(pwd) $(pwd) done grep
+		then 2>/dev/null --verbose sed test x=1 test && /usr/bin | printf -eu
+		&& echo readonly $(pwd) --verbose
+local -eu export done sed x=1 --verbose
+export 2>/dev/null "$@" grep "$1" 'quoted text' | export printf
+		$(pwd) awk "$@" sed done
+done test | grep grep sed test "$1" &&
+	awk ${HOME} then "$@" cd "$@" /usr/bin test sed 'quoted text' printf
+	test --verbose | printf -eu 2>/dev/null --verbose test echo
+then awk -eu /usr/bin awk 'quoted text' && 2>/dev/null | && printf
+	/usr/bin awk --verbose test $(pwd) /usr/bin && --verbose $(pwd) then readonly
+		test x=1 x=1 readonly ${HOME} awk $(pwd) --verbose
+	"$1" local export 'quoted text' test | | cd "$@" then
+/usr/bin 2>/dev/null printf
+		done -eu 2>/dev/null "$@"
+x=1 "$@" x=1 "$@" "$1" 'quoted text' x=1 /usr/bin readonly "$@"
+done test $(pwd) local /usr/bin -eu -eu done 2>/dev/null cd echo
+	export then | export | readonly local awk ${HOME}
+	x=1 local | 'quoted text' --verbose done ${HOME} $(pwd) awk echo cd --verbose
+	awk awk "$1" then /usr/bin | export "$1" | export grep local -eu test cd | test
+	sed | test done cd 2>/dev/null
+	then grep x=1 then 2>/dev/null --verbose -eu $(pwd) -eu && --verbose "$@"
+		"$@" sed /usr/bin $(pwd) --verbose ${HOME} -eu x=1 local
+	"$1" local --verbose ${HOME} cd "$1" --verbose
+		done 'quoted text' export
+	| $(pwd) $(pwd) test ${HOME} cd --verbose ${HOME} printf x=1 echo sed test
+then && echo -eu local /usr/bin then 2>/dev/null sed awk done -eu local
+		sed /usr/bin && "$@" 'quoted text' && cd sed && --verbose sed x=1
+		awk 'quoted text' --verbose readonly -eu -eu cd
+done readonly grep done awk 2>/dev/null printf
+		'quoted text' done -eu 'quoted text' echo /usr/bin
+${HOME} "$@" --verbose $(pwd)
+		grep | local /usr/bin /usr/bin && done printf test
+done "$@" 'quoted text' echo awk echo 'quoted text' local /usr/bin && readonly
+		2>/dev/null local | sed "$1" /usr/bin $(pwd) 2>/dev/null && cd 2>/dev/null
+		-eu | echo ${HOME} done
+		&& done 2>/dev/null done 2>/dev/null test 2>/dev/null
+	local 'quoted text' sed awk echo done
+		cd readonly $(pwd) /usr/bin then /usr/bin 'quoted text' done 2>/dev/null
+		awk cd then "$@" then local local 'quoted text'
+test -eu cd sed cd ${HOME} printf | x=1 && then sed -eu ${HOME} $(pwd) --verbose
+	$(pwd) ${HOME} /usr/bin --verbose
+	then grep ${HOME} ${HOME} && readonly printf /usr/bin
+	sed -eu 'quoted text' | export sed readonly then readonly
+printf sed grep /usr/bin
+		awk cd sed -eu && "$@" $(pwd) test 2>/dev/null printf cd
+--verbose sed 'quoted text' cd test readonly "$1"
+"$1" printf grep $(pwd) 2>/dev/null local local $(pwd)
+		awk --verbose --verbose grep done | --verbose ${HOME}
+		/usr/bin test "$1" cd "$1" --verbose
+	grep | awk ${HOME} /usr/bin 2>/dev/null test && && grep "$@" local |
+		then $(pwd) | export awk sed done awk /usr/bin "$@" 2>/dev/null sed
+	echo && then readonly local ${HOME} -eu sed | ${HOME}
+		x=1 'quoted text' done ${HOME}
+		$(pwd) grep ${HOME} /usr/bin readonly readonly
+/usr/bin local then 2>/dev/null
+		${HOME} done printf readonly &&
+		export && "$1" $(pwd) cd sed test awk $(pwd) grep 2>/dev/null
+	grep "$1" x=1 'quoted text' "$@" ${HOME} "$@" && /usr/bin done done x=1 $(pwd)
+		test then -eu printf -eu ${HOME} cd $(pwd) then sed "$1" -eu
+		export "$@" cd cd done "$1" sed ${HOME} grep -eu -eu && --verbose
+	awk -eu $(pwd) printf -eu "$@"
+local readonly && printf done
+		done echo cd "$1" then then 2>/dev/null printf "$@" 'quoted text'
+&& then x=1 export 'quoted text' sed x=1 then
+		| printf cd done x=1 ${HOME} test -eu 'quoted text' sed -eu cd test local
+awk export cd && printf /usr/bin echo export && 2>/dev/null -eu sed then
+	then sed sed 'quoted text'
+	/usr/bin ${HOME} ${HOME} test ${HOME} "$1"
+printf awk --verbose && test "$@" "$@" test done $(pwd) test 2>/dev/null
+	sed echo | printf ${HOME} 2>/dev/null awk printf printf | test
+	export && -eu && ${HOME} "$@" echo grep local 2>/dev/null
+	"$1" --verbose 2>/dev/null --verbose awk -eu x=1 | cd --verbose
+		--verbose then done --verbose then local ${HOME} 2>/dev/null
+		"$1" 'quoted text' x=1 x=1 "$1" cd $(pwd)
+	readonly sed ${HOME} 'quoted text'
+| && -eu then $(pwd) --verbose done x=1 done | readonly export awk "$@"
+		${HOME} readonly "$@" echo 'quoted text' cd readonly done then grep grep
+	$(pwd) 2>/dev/null echo export x=1
+| local printf /usr/bin && sed printf export then
+	then $(pwd) readonly && | readonly
+		"$@" ${HOME} printf then --verbose
+"$@" done grep -eu cd echo
+		grep x=1 echo $(pwd) && readonly ${HOME} export $(pwd) printf x=1 "$1"
+export x=1 test $(pwd) then -eu cd sed -eu printf 2>/dev/null
+		echo grep -eu "$1" echo local then /usr/bin
+		done && cd --verbose $(pwd) done test x=1 /usr/bin awk echo "$@" cd /usr/bin
+		--verbose "$@" then done && --verbose then then cd x=1 /usr/bin local
+echo done echo awk ${HOME} sed then && --verbose /usr/bin
+	echo echo echo | sed echo echo 'quoted text' x=1
+		${HOME} "$1" 'quoted text' local "$@" "$1" readonly test
+| test cd $(pwd) test test
+${HOME} -eu $(pwd) test 2>/dev/null readonly
+		-eu printf cd cd "$1" --verbose cd local grep awk && $(pwd) then
+${HOME} test sed "$1" "$1" echo
+	grep test -eu | grep then 'quoted text' -eu export --verbose grep ${HOME} | sed
+		export readonly sed 'quoted text' ${HOME} then
+	grep printf $(pwd) "$@" cd "$1" grep --verbose export test ${HOME} cd done
+		grep echo 'quoted text' /usr/bin x=1 /usr/bin
+	x=1 sed ${HOME} printf 'quoted text' printf awk "$@"
+		x=1 awk done --verbose test grep echo /usr/bin echo /usr/bin
+	"$@" 'quoted text' -eu /usr/bin 2>/dev/null | local awk sed ${HOME} -eu awk $(pwd)
+echo echo /usr/bin x=1 $(pwd)
+| export printf 'quoted text' 'quoted text' printf sed export local |
+		export /usr/bin $(pwd) grep done ${HOME} | done 'quoted text' readonly ${HOME}
+	$(pwd) local x=1 "$@" x=1 2>/dev/null
+'quoted text' export awk
+$(pwd) "$1" 'quoted text' /usr/bin --verbose sed printf then cd
+		printf "$@" then grep cd echo | then
+	--verbose ${HOME} --verbose sed done ${HOME} grep "$1" grep "$1" /usr/bin /usr/bin
+		-eu | local printf $(pwd) $(pwd) grep echo local local test
+	sed 2>/dev/null awk && /usr/bin
+	--verbose cd $(pwd) cd && test test $(pwd) x=1
+2>/dev/null printf awk
+		/usr/bin -eu cd 'quoted text' --verbose "$1" && done $(pwd) ${HOME}
+		done | cd printf /usr/bin 2>/dev/null /usr/bin ${HOME} ${HOME} sed && /usr/bin
+	${HOME} export grep test printf echo grep
+		grep -eu local awk x=1 2>/dev/null local then
+		grep grep "$1" test | x=1 "$@" /usr/bin 'quoted text'
+	local | -eu cd $(pwd) done ${HOME} /usr/bin "$1" sed --verbose grep
+readonly cd 'quoted text'
+/usr/bin export x=1 -eu --verbose echo "$1" 2>/dev/null x=1 2>/dev/null
+		readonly "$@" export "$@" ${HOME}
+&& --verbose ${HOME} printf --verbose
+"$1" test /usr/bin sed x=1 2>/dev/null "$1"
+		then /usr/bin $(pwd) awk 'quoted text' then echo done awk x=1
+		printf readonly "$1" && export && /usr/bin local --verbose readonly
+	"$@" readonly cd printf readonly | "$@" test sed
+	"$@" --verbose 2>/dev/null -eu local
+	'quoted text' 2>/dev/null && /usr/bin done 2>/dev/null then | printf awk
+grep && then 2>/dev/null -eu awk --verbose --verbose
+export 2>/dev/null --verbose
+x=1 then $(pwd) echo 2>/dev/null "$1"
+		--verbose 2>/dev/null readonly -eu /usr/bin -eu -eu "$@" --verbose "$@"
+		/usr/bin "$1" 'quoted text'
+local awk sed then test x=1 -eu
+	-eu sed 2>/dev/null printf "$1" cd awk "$@" sed x=1 &&
+	printf /usr/bin "$1" $(pwd) grep printf
+	x=1 done local 2>/dev/null printf
+	then then 2>/dev/null readonly done echo && --verbose
+	local 'quoted text' /usr/bin grep export export
+	"$1" grep --verbose cd 'quoted text'
+	grep done done "$@" test done local ${HOME} cd test sed $(pwd) done /usr/bin 2>/dev/null
+		cd awk done grep | "$1"
+	$(pwd) cd 'quoted text' -eu --verbose cd readonly &&
+local sed sed --verbose x=1 -eu "$@"
+	echo done ${HOME} then
+		-eu $(pwd) printf --verbose local "$1" /usr/bin
+	'quoted text' grep export ${HOME} readonly
+		"$@" echo --verbose 2>/dev/null echo /usr/bin done "$1" $(pwd) sed
+$(pwd) ${HOME} 2>/dev/null
+	--verbose echo "$1" x=1 | sed sed -eu grep $(pwd) sed then
+		then printf ${HOME} sed local sed -eu export echo "$@" $(pwd) | 2>/dev/null
+	local export cd ${HOME} "$@"
+		export 2>/dev/null local grep printf 'quoted text'
+		export -eu echo x=1 'quoted text' -eu then
+	2>/dev/null cd ${HOME} | done test export echo ${HOME} x=1 awk $(pwd) then readonly
+		x=1 echo sed 'quoted text' done "$1" test
+/usr/bin done $(pwd) --verbose | -eu $(pwd)
+	awk x=1 awk test done export done export cd
+		x=1 --verbose /usr/bin export $(pwd) export 2>/dev/null
+/usr/bin printf | /usr/bin cd "$@" 'quoted text' then
+	--verbose sed sed | done 'quoted text' test sed 2>/dev/null --verbose readonly
+		echo readonly export $(pwd) /usr/bin -eu export "$@" "$@" sed
+	test 'quoted text' printf
+		--verbose test then awk 'quoted text' -eu | readonly ${HOME} export
+	${HOME} cd && 2>/dev/null --verbose "$@" x=1 then x=1 sed
+	printf $(pwd) | /usr/bin /usr/bin 'quoted text' printf local
+sed done done && "$@" done "$@" printf /usr/bin
+		"$@" printf $(pwd) test printf done "$@" printf $(pwd) done
+	'quoted text' && "$1" cd test "$@" -eu "$1" test /usr/bin then awk
+	/usr/bin | --verbose "$1" 2>/dev/null && /usr/bin
+printf printf 'quoted text' export 'quoted text'
+		sed && export -eu "$@" then export -eu /usr/bin x=1 'quoted text'
+	'quoted text' grep local awk 2>/dev/null done done test
+		x=1 done -eu && x=1 readonly awk
+		/usr/bin local readonly "$1" cd then grep grep
+&& then $(pwd) test sed test "$@" ${HOME} x=1 done readonly export
+export && "$@" x=1 done | /usr/bin /usr/bin
+		"$@" local sed "$1" 2>/dev/null test ${HOME}
+x=1 printf awk readonly | --verbose test awk 'quoted text' echo -eu echo /usr/bin
+		'quoted text' export cd done local
+		${HOME} && 2>/dev/null then "$@" -eu
+	'quoted text' 2>/dev/null -eu | "$@" sed cd cd done "$1" $(pwd) 'quoted text'
+		&& printf printf x=1 echo "$1" then $(pwd)
+		2>/dev/null grep local $(pwd) x=1 && echo then 2>/dev/null readonly
+		awk readonly cd awk test "$1" then awk --verbose local done $(pwd) x=1 sed
+--verbose --verbose echo readonly
+2>/dev/null "$@" /usr/bin $(pwd)
+	/usr/bin x=1 "$@" sed test readonly | "$@" cd "$1" --verbose
+${HOME} /usr/bin cd cd $(pwd) local "$@" "$1" printf -eu "$@"
+export x=1 /usr/bin done echo readonly --verbose local awk printf echo
+		awk x=1 test "$@" && x=1 sed grep then cd 'quoted text' grep x=1 done printf
+${HOME} local --verbose readonly cd ${HOME}
+	-eu --verbose --verbose --verbose grep
+| 'quoted text' -eu test --verbose done --verbose 2>/dev/null --verbose grep
+	echo "$@" "$1" awk && | test /usr/bin x=1 $(pwd) 'quoted text'
+awk printf 'quoted text' sed && /usr/bin 'quoted text'
+		export printf 'quoted text'
+-eu readonly awk grep /usr/bin
+awk echo then local "$1" awk sed --verbose
+	then then | test sed /usr/bin -eu /usr/bin
+cd done printf "$@" done 'quoted text' echo printf printf | done
+readonly "$@" "$1" grep readonly
+	$(pwd) "$@" local printf --verbose echo cd x=1 $(pwd) echo sed
+x=1 2>/dev/null "$@" 2>/dev/null 2>/dev/null
+	-eu echo sed $(pwd) sed local sed then "$1" && export x=1 && export $(pwd)
+	then $(pwd) /usr/bin printf grep local x=1 && | printf /usr/bin sed
+then done then /usr/bin && --verbose $(pwd)
+x=1 | 'quoted text' && -eu echo && -eu then
+done grep then x=1 2>/dev/null
+	echo readonly 2>/dev/null local grep local then test "$@" local ${HOME} 2>/dev/null
+"$@" | then x=1 2>/dev/null 'quoted text' 2>/dev/null grep "$1" readonly "$1"
+"$1" $(pwd) && done 'quoted text' 2>/dev/null && readonly $(pwd) "$1"
+	| --verbose && awk | export x=1 /usr/bin
+	"$@" done 'quoted text' awk /usr/bin $(pwd) then grep
+	test cd echo test "$@" | grep 'quoted text' readonly echo && ${HOME} /usr/bin then
+test export && | test -eu grep echo echo /usr/bin readonly && awk echo
+"$1" /usr/bin "$@" test done 2>/dev/null sed grep echo x=1 test
+	$(pwd) 2>/dev/null x=1 ${HOME} awk test -eu
+	echo /usr/bin "$1" grep
+/usr/bin x=1 local echo -eu 2>/dev/null printf readonly printf printf sed then
+then $(pwd) 'quoted text'
+&& then done -eu | cd | "$@" /usr/bin cd done awk 2>/dev/null
+		local --verbose done done --verbose sed ${HOME} echo
+	local awk sed "$1" 'quoted text' "$1" && 'quoted text' sed printf export "$@" readonly
+		2>/dev/null 2>/dev/null cd test "$@" $(pwd) 'quoted text'
+		echo && x=1 x=1 "$@" && ${HOME} -eu readonly | "$@" /usr/bin /usr/bin
+awk cd "$1" printf ${HOME} grep --verbose
+	printf local 'quoted text' -eu echo 2>/dev/null
+		--verbose cd 2>/dev/null readonly test "$1" done "$1" grep done "$@"
+		then cd | x=1 awk grep /usr/bin --verbose "$1" then 'quoted text' sed /usr/bin
+printf echo export sed local done | export
+| sed done done $(pwd) "$@" x=1 ${HOME} /usr/bin
+/usr/bin && /usr/bin && "$@" done local printf awk printf
+	2>/dev/null grep then awk "$1" test echo test sed readonly $(pwd) printf
+2>/dev/null done ${HOME} sed then sed grep echo "$@" local done
+	${HOME} readonly grep done printf && /usr/bin
+"$@" cd readonly awk readonly | $(pwd) local x=1 awk "$1" cd printf /usr/bin
+		test $(pwd) printf | --verbose grep /usr/bin printf --verbose --verbose
+	cd /usr/bin /usr/bin
+	/usr/bin 'quoted text' "$@" && then local local grep "$@" && "$@"
+		$(pwd) $(pwd) 2>/dev/null $(pwd) 'quoted text' && -eu
+	$(pwd) then x=1 grep echo && export ${HOME} test 'quoted text' "$1" export
+export $(pwd) "$@" printf sed -eu then echo awk cd test | then cd
+		| readonly 'quoted text' test 'quoted text'
+		${HOME} cd test echo export 'quoted text' ${HOME}
+		$(pwd) --verbose grep done sed ${HOME} echo
+	${HOME} readonly awk test readonly x=1 awk printf
+	export cd $(pwd) ${HOME} ${HOME} $(pwd) then 'quoted text'
+	--verbose awk /usr/bin awk grep echo echo
+	local ${HOME} printf export -eu grep sed x=1 test then
+	done "$@" $(pwd) /usr/bin x=1 done readonly ${HOME} cd readonly awk ${HOME} cd
+grep ${HOME} done $(pwd) sed 2>/dev/null
+		${HOME} "$1" ${HOME}
+	then "$@" done $(pwd) printf -eu readonly test grep ${HOME}
+	| readonly sed cd readonly --verbose
+printf -eu && 2>/dev/null cd x=1 /usr/bin
+2>/dev/null ${HOME} awk "$@" export
+$(pwd) x=1 readonly | $(pwd) -eu test
+readonly ${HOME} export local $(pwd) /usr/bin test grep sed
+		then done x=1 2>/dev/null sed ${HOME} sed 'quoted text' awk ${HOME} local local
+	cd 2>/dev/null printf grep $(pwd) "$@" $(pwd) printf --verbose cd cd grep grep
+readonly local export done
+		sed done $(pwd) && && then
+		readonly cd $(pwd) local then test grep && /usr/bin "$@" | then printf
+	--verbose && | done $(pwd) "$1" echo export 'quoted text' echo -eu 'quoted text'
+local 'quoted text' x=1 awk awk sed "$@" echo grep
+	done done && echo local sed "$@" "$@" $(pwd) printf
+then readonly --verbose --verbose then ${HOME} --verbose test | /usr/bin
+	/usr/bin | | -eu $(pwd) 2>/dev/null /usr/bin printf 'quoted text'
+		local /usr/bin export /usr/bin grep $(pwd) 'quoted text'
+	| local test printf sed --verbose test local readonly then 2>/dev/null
+local readonly | --verbose -eu
+	export "$1" ${HOME} 'quoted text'
+'quoted text' 2>/dev/null then export $(pwd) -eu "$1" x=1 | 2>/dev/null $(pwd)
+	local 2>/dev/null echo 'quoted text' printf
+		'quoted text' ${HOME} && export x=1
+		/usr/bin echo 'quoted text' 'quoted text'
+		sed sed 2>/dev/null sed && readonly 2>/dev/null && export
+readonly 'quoted text'
+grep -eu --verbose then -eu cd
+	readonly | cd export --verbose x=1 then grep
+	x=1 then 'quoted text' x=1 export "$@" grep cd 'quoted text'
+	readonly -eu "$@" ${HOME} local "$@" 'quoted text' then grep sed 'quoted text'
+-eu 'quoted text' local ${HOME} then readonly grep 2>/dev/null then
+		--verbose cd test 'quoted text' $(pwd) "$@" sed test "$@" x=1 awk then printf
+	--verbose echo printf printf 'quoted text'
+	awk echo printf /usr/bin awk then printf cd echo grep --verbose x=1 cd test
+	then "$@" x=1 ${HOME} readonly
+	grep echo 2>/dev/null done $(pwd) cd
+	| 'quoted text' printf export echo grep printf export
+	/usr/bin test x=1 sed /usr/bin grep awk "$@" "$@" cd export echo ${HOME}
+		local test -eu sed "$1" 'quoted text' /usr/bin awk test export && --verbose
+	local echo x=1 --verbose 2>/dev/null local then
+	test --verbose /usr/bin x=1
+	echo $(pwd) printf "$1" | "$@" $(pwd) grep
+	&& "$1" then | -eu ${HOME} x=1 grep
+	"$1" 2>/dev/null "$@" cd /usr/bin readonly $(pwd) --verbose x=1
+	-eu awk printf && echo -eu sed sed cd x=1 | --verbose "$1" "$1" ${HOME}
+"$1" /usr/bin printf ${HOME} sed ${HOME} awk x=1 'quoted text' &&
+	-eu "$1" --verbose readonly then /usr/bin && "$@" grep && echo sed 2>/dev/null
+echo printf awk "$@" 'quoted text' /usr/bin cd --verbose /usr/bin
+		sed -eu local ${HOME} then local cd sed
+	2>/dev/null printf --verbose $(pwd) cd local readonly
+	printf -eu $(pwd) ${HOME}
+-eu /usr/bin "$1" --verbose x=1 "$1" done 'quoted text' "$1"
+export $(pwd) grep x=1 export test local local done
+		&& -eu && --verbose 2>/dev/null done printf 2>/dev/null
+"$@" 2>/dev/null echo grep -eu --verbose
+		sed printf "$@" local "$1" $(pwd) then && /usr/bin
+	printf --verbose test awk then --verbose
+	'quoted text' $(pwd) grep ${HOME} 2>/dev/null
+	2>/dev/null then echo printf grep 'quoted text'
+		${HOME} grep echo 'quoted text'
+x=1 "$@" echo readonly /usr/bin cd export
+readonly ${HOME} cd -eu 'quoted text' awk ${HOME} echo echo done
+"$1" | cd 2>/dev/null $(pwd) printf
+		"$@" export then x=1 then /usr/bin 'quoted text' cd && && $(pwd) -eu 'quoted text'
+	grep $(pwd) export test -eu -eu done grep readonly export grep "$@" -eu
+test echo /usr/bin cd x=1 sed $(pwd) echo /usr/bin /usr/bin
+	grep cd "$@" export sed 2>/dev/null
+		| readonly echo | export "$1" 'quoted text' /usr/bin
+	sed test $(pwd) --verbose
+	'quoted text' /usr/bin x=1 ${HOME} "$@" then grep test
+		export /usr/bin | --verbose export printf
+		-eu /usr/bin echo "$@" cd $(pwd) done
+		local && done awk 'quoted text' x=1 --verbose $(pwd) readonly
+		sed $(pwd) done local 'quoted text'
+done printf grep echo
+		done "$1" && "$@" awk cd 2>/dev/null
+		&& awk /usr/bin "$@" -eu printf cd /usr/bin
+		readonly "$@" grep --verbose "$1" cd done printf x=1 /usr/bin -eu readonly
+${HOME} readonly "$@" echo printf echo printf ${HOME} done echo export
+	grep local export echo && export sed -eu $(pwd) cd 2>/dev/null
+	printf cd x=1 2>/dev/null "$@" ${HOME} awk export
+		cd done x=1 "$@" x=1 "$@" x=1 'quoted text'
+export $(pwd) | && done then readonly then test x=1 $(pwd) cd
+&& ${HOME} export | | x=1 "$@" $(pwd)
+'quoted text' awk "$1" /usr/bin ${HOME} then
+	'quoted text' && "$@" then --verbose grep
+	then sed 'quoted text' printf export printf awk readonly then readonly
+2>/dev/null 2>/dev/null | local -eu /usr/bin -eu "$@" then 2>/dev/null readonly
+done sed $(pwd) export grep then "$@"
+		awk cd awk | -eu readonly && ${HOME}
+	"$1" sed test x=1 test "$@" test ${HOME} test export "$@" local x=1 awk test
+test test x=1 | ${HOME}
+grep test x=1 "$@" sed /usr/bin /usr/bin readonly | ${HOME} x=1 ${HOME} "$1"
+	grep awk readonly echo "$1" export "$@" done then
+		"$@" && --verbose test "$@" echo grep "$@" ${HOME} then --verbose printf | ${HOME}
+		local $(pwd) printf then ${HOME} x=1
+	&& printf test test /usr/bin then /usr/bin x=1 --verbose sed done -eu ${HOME}
+		"$@" printf cd awk readonly ${HOME} local | done printf readonly sed sed
+export local test && grep then local test
+	printf x=1 2>/dev/null export /usr/bin | then printf
+${HOME} readonly "$1" /usr/bin $(pwd) && | 'quoted text' local 'quoted text'
+	&& grep local --verbose x=1 -eu "$1" echo readonly done then then 'quoted text'
+then 2>/dev/null 2>/dev/null "$1" grep x=1 done -eu echo
+	awk readonly awk $(pwd) "$@" then "$@" readonly
+		--verbose test printf then awk awk grep $(pwd) x=1 readonly
+	echo echo printf | 'quoted text' sed x=1 x=1 x=1 /usr/bin readonly
+--verbose /usr/bin grep cd done then sed done x=1 done 2>/dev/null sed
+		-eu printf "$1" cd test 2>/dev/null cd printf
+	"$@" export grep $(pwd) "$@" export --verbose grep $(pwd) 2>/dev/null "$@"
+		"$1" "$1" | 2>/dev/null test "$1" cd $(pwd)
+		'quoted text' "$1" x=1 $(pwd) 2>/dev/null /usr/bin test echo export
+	grep && export echo cd done awk done ${HOME} readonly 'quoted text'
+-eu ${HOME} then readonly cd grep x=1 -eu -eu | 'quoted text' "$@" 'quoted text'
+$(pwd) readonly "$1" $(pwd) /usr/bin x=1 2>/dev/null printf readonly -eu -eu 'quoted text'
+	--verbose && 'quoted text'
+	--verbose readonly readonly printf local export export $(pwd) 2>/dev/null
+	then done export /usr/bin x=1 cd -eu echo 2>/dev/null
+	printf awk done readonly sed
+		printf cd then local --verbose export sed
+	${HOME} grep echo test printf test cd | -eu -eu "$1" -eu 'quoted text'
+	then $(pwd) x=1 then $(pwd)
+	${HOME} export --verbose 'quoted text' /usr/bin /usr/bin
+| && done 'quoted text' printf
+	'quoted text' export then "$@" export sed
+		sed echo readonly -eu 2>/dev/null ${HOME}
+test "$@" local export ${HOME} 2>/dev/null grep then
+		then 'quoted text' $(pwd) echo /usr/bin awk "$@" local grep
+		cd $(pwd) echo grep 'quoted text' x=1 $(pwd) --verbose | /usr/bin -eu export printf
+	"$@" readonly 'quoted text'
+test "$1" --verbose test grep awk then 'quoted text'
+	cd "$@" $(pwd) cd awk local
+export printf 'quoted text' "$1" x=1 "$@" cd x=1 | "$1" test then done
+	$(pwd) printf test readonly $(pwd) x=1 readonly cd export 2>/dev/null
+	${HOME} readonly $(pwd) /usr/bin
+		--verbose export test echo
+	done echo "$@" grep x=1 ${HOME} sed && 'quoted text' 'quoted text' grep -eu
+'quoted text' cd echo x=1 -eu x=1 done
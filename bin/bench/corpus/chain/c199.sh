@@ -0,0 +1,2001 @@
+done then "$@" && --verbose readonly export local -eu 2>/dev/null
+		export | --verbose "$1" -eu then grep done then "$@" && cd sed
+	printf done echo /usr/bin "$1" test x=1 2>/dev/null
+done && "$@" printf "$@" local && local awk sed $(pwd) x=1 readonly
+		| -eu "$1" 2>/dev/null export 'quoted text' echo x=1 && test cd "$1" then cd $(pwd)
+	| -eu then sed 2>/dev/null && grep --verbose x=1
+&& ${HOME} 2>/dev/null sed -eu
+		--verbose done cd $(pwd) 'quoted text' /usr/bin 'quoted text' 'quoted text'
+/usr/bin readonly ${HOME} then
+	$(pwd) readonly $(pwd) 2>/dev/null
+	"$1" export sed "$@" readonly && 'quoted text' && done
+	/usr/bin x=1 local echo local | local echo
+		export then /usr/bin echo 2>/dev/null printf $(pwd) test
+	local "$1" sed echo readonly | 'quoted text'
+		awk echo echo --verbose
+--verbose grep $(pwd) | readonly export "$@" ${HOME} echo "$@" local && readonly
+	&& 'quoted text' && && echo | /usr/bin "$@" 2>/dev/null grep
+test export --verbose cd "$1" /usr/bin --verbose local then -eu
+	readonly ${HOME} done done
+| export done done local printf "$1" local $(pwd) &&
+	echo grep awk && then readonly && local echo test then then --verbose
+	x=1 sed "$1" then echo "$@" readonly test cd x=1 echo then export export
+	then readonly 'quoted text' ${HOME} x=1 grep && echo sed local ${HOME}
+		2>/dev/null grep ${HOME} done grep -eu local sed /usr/bin | | cd grep local
+test x=1 test $(pwd) then x=1 readonly local export
+echo readonly grep -eu echo printf test echo export | grep "$@" sed readonly
+	x=1 local 'quoted text' sed "$@" cd cd printf test echo awk
+	x=1 then "$@" --verbose local then /usr/bin x=1 test 'quoted text'
+		--verbose 'quoted text'
+	sed awk -eu --verbose then
+--verbose awk --verbose --verbose done export
+		$(pwd) then x=1 printf 'quoted text' 'quoted text'
+		x=1 | 'quoted text' printf
+local --verbose $(pwd)
+	| export x=1 && | sed 'quoted text' "$1" cd cd
+		--verbose printf grep -eu | "$@" grep 'quoted text' x=1 echo
+	${HOME} $(pwd) cd echo "$@" "$@" 'quoted text'
+	x=1 -eu -eu test /usr/bin "$@" done "$@" 2>/dev/null sed "$@" "$1" grep x=1
+'quoted text' --verbose done cd ${HOME} echo readonly
+-eu ${HOME} 'quoted text' export cd $(pwd) 2>/dev/null
+then cd ${HOME} $(pwd) 'quoted text' $(pwd)
+	"$@" x=1 awk done export --verbose $(pwd)
+	done test 'quoted text' | then "$1" 'quoted text' sed
+awk cd ${HOME} $(pwd) printf | echo --verbose
+		echo export echo | |
+	2>/dev/null readonly sed cd | ${HOME} sed "$1" grep "$@" "$@" 2>/dev/null export
+	cd then 2>/dev/null then -eu grep sed awk ${HOME} 'quoted text'
+	${HOME} done done x=1 sed 2>/dev/null "$1" cd echo "$1" x=1 grep printf
+	x=1 && --verbose | 'quoted text' | then --verbose local /usr/bin test 2>/dev/null
+	/usr/bin awk -eu test && grep $(pwd) x=1 $(pwd)
+done done 'quoted text' readonly echo printf grep cd grep $(pwd) awk then
+	export $(pwd) test readonly
+	printf x=1 2>/dev/null printf grep export && then then readonly 2>/dev/null
+	test 'quoted text' sed | x=1 cd then cd /usr/bin 'quoted text'
+		"$@" "$@" export done --verbose "$1" grep readonly cd sed "$@" done then --verbose
+		'quoted text' "$@" grep
+${HOME} cd 'quoted text' -eu "$1" export sed
+$(pwd) "$1" --verbose "$@" export --verbose
+		then "$@" test "$1" --verbose awk printf | export x=1 done echo
+	"$1" sed then local 'quoted text'
+	"$@" $(pwd) then readonly grep ${HOME} sed /usr/bin then echo export local
+done $(pwd) "$@" && ${HOME} then awk "$@" export echo done grep
+	"$@" sed cd "$@" cd && --verbose export awk local export test
+		'quoted text' export
+cd cd cd export "$@" sed printf /usr/bin then test awk echo /usr/bin 2>/dev/null
+printf test test cd local done $(pwd) echo test awk ${HOME} readonly local ${HOME}
+		"$@" sed | done export readonly
+then then readonly sed cd && | "$@" done 'quoted text' $(pwd)
+	local grep 'quoted text' sed cd readonly printf
+		"$@" readonly $(pwd) export local readonly -eu
+	"$1" grep cd echo 2>/dev/null local "$1" printf local test awk && test
+		$(pwd) -eu echo "$@" 2>/dev/null awk "$1" done sed
+		cd awk sed x=1 "$1" echo 2>/dev/null | sed ${HOME} "$1" 2>/dev/null x=1
+		printf grep /usr/bin awk grep "$@" awk /usr/bin -eu local then 'quoted text'
+		then 'quoted text' "$@" 2>/dev/null ${HOME} export 2>/dev/null 2>/dev/null test
+		&& -eu echo 2>/dev/null done 2>/dev/null
+x=1 then done $(pwd) sed awk sed echo echo x=1
+	export && $(pwd) sed cd local "$1" ${HOME} "$1" printf
+"$@" /usr/bin local local test x=1 test printf &&
+		/usr/bin cd /usr/bin -eu printf
+		printf 'quoted text' sed "$@" ${HOME}
+		export echo -eu --verbose && cd
+		'quoted text' | | "$@" sed | --verbose $(pwd) -eu done x=1 ${HOME}
+		cd grep grep "$@" echo | | cd -eu cd /usr/bin readonly && $(pwd) "$@" | echo
+		"$1" test 'quoted text' export awk echo /usr/bin -eu printf ${HOME}
+		echo -eu cd $(pwd) cd /usr/bin --verbose
+printf $(pwd) awk 2>/dev/null /usr/bin $(pwd)
+test /usr/bin export test echo 2>/dev/null printf
+echo && x=1 ${HOME} local /usr/bin cd "$1" $(pwd) printf echo | -eu
+awk then sed -eu export printf sed then local sed 'quoted text'
+'quoted text' x=1 "$1" "$1"
+		echo echo && cd ${HOME} "$@" grep then
+awk "$1" then | --verbose printf cd --verbose
+	sed -eu $(pwd) sed grep awk x=1 -eu sed readonly awk --verbose && readonly
+	${HOME} 2>/dev/null sed 2>/dev/null
+--verbose awk sed 2>/dev/null && --verbose readonly
+	2>/dev/null x=1 grep "$1"
+	echo awk --verbose grep 2>/dev/null
+		| echo printf | 2>/dev/null
+		-eu 'quoted text' test | local done printf local echo
+	'quoted text' $(pwd) echo
+		--verbose printf && 2>/dev/null echo then export readonly
+done awk awk ${HOME} readonly cd echo | sed then 'quoted text'
+		${HOME} && "$1" x=1 2>/dev/null awk cd awk sed grep 2>/dev/null
+local local printf x=1 cd -eu 2>/dev/null 2>/dev/null |
+'quoted text' readonly 'quoted text' "$@" "$1" -eu /usr/bin ${HOME} --verbose
+		done local printf echo then printf then awk $(pwd) && readonly /usr/bin sed
+		echo 2>/dev/null awk --verbose local -eu x=1 readonly 'quoted text' awk "$1" done
+${HOME} echo readonly --verbose
+	echo "$1" sed --verbose | readonly ${HOME} printf
+local local readonly "$@" grep
+		&& && $(pwd) sed x=1 awk 'quoted text' /usr/bin "$@" &&
+	local "$@" x=1 export awk | | ${HOME} $(pwd) grep -eu ${HOME}
+'quoted text' awk test ${HOME} cd $(pwd) --verbose local -eu
+	then -eu $(pwd) cd | cd printf "$1" readonly x=1
+		echo x=1 echo sed $(pwd) --verbose printf test && local grep
+	| && readonly sed "$@" done readonly "$@" echo
+		sed cd "$@" local then /usr/bin done readonly && readonly
+'quoted text' grep /usr/bin --verbose sed |
+	cd "$1" /usr/bin test 2>/dev/null echo $(pwd) "$1"
+/usr/bin 'quoted text' x=1 2>/dev/null 'quoted text'
+	&& local --verbose 'quoted text' "$@" sed 'quoted text' | awk -eu
+		export "$1" done grep x=1
+--verbose test test grep 2>/dev/null printf -eu readonly --verbose grep | 2>/dev/null
+		done "$@" done test cd export
+	readonly test printf "$@" && grep $(pwd) printf test local export
+local x=1 export 2>/dev/null 2>/dev/null done "$1" | 'quoted text'
+awk "$@" 'quoted text' 2>/dev/null printf "$@" && "$1" cd sed local && printf
+	$(pwd) grep printf ${HOME} readonly test && | 'quoted text'
+sed | "$1" -eu x=1 --verbose sed test done test done 'quoted text'
+		test && printf "$@" ${HOME} done printf
+	&& then 'quoted text' cd --verbose
+	/usr/bin /usr/bin 2>/dev/null $(pwd)
+done local | "$@" --verbose sed export /usr/bin 'quoted text' && test done
+	test /usr/bin awk echo | then -eu readonly
+		"$1" export sed | awk "$@" grep
+	--verbose test | printf then
+/usr/bin "$1" done echo done && done sed && echo sed awk export 'quoted text'
+	"$1" done x=1 cd export && ${HOME} -eu readonly export "$@" 2>/dev/null
+| grep && ${HOME} echo ${HOME} export x=1
+cd $(pwd) x=1 local grep grep -eu /usr/bin /usr/bin readonly
+		${HOME} $(pwd) $(pwd) done 'quoted text'
+'quoted text' then cd then $(pwd) test x=1 ${HOME} local ${HOME} done
+local sed awk awk grep cd echo /usr/bin done $(pwd) ${HOME} test
+	echo export "$1" x=1 -eu then
+		printf sed 2>/dev/null /usr/bin -eu done awk $(pwd) 'quoted text'
+	test printf $(pwd) && echo cd printf
+		&& done | test && -eu "$1" cd "$@" 2>/dev/null echo ${HOME} grep export ${HOME}
+-eu local test then ${HOME}
+	test readonly done awk grep local | --verbose
+		test readonly "$@" 'quoted text'
+	echo then awk cd awk | readonly ${HOME} local | export
+	/usr/bin x=1 grep sed then export local && 'quoted text' grep awk --verbose &&
+		'quoted text' --verbose done "$@" --verbose
+/usr/bin --verbose test export
+		readonly done done x=1 done 'quoted text' 2>/dev/null sed
+awk /usr/bin local test 2>/dev/null
+| "$1" 2>/dev/null sed | --verbose echo
+		"$@" x=1 grep | printf grep x=1 "$1" then "$1" "$1" ${HOME} grep /usr/bin
+	printf x=1 ${HOME} local readonly 2>/dev/null "$1" && "$1" 'quoted text'
+printf $(pwd) readonly && printf -eu awk -eu readonly readonly awk export
+		'quoted text' /usr/bin ${HOME} 2>/dev/null awk sed && grep /usr/bin
+		$(pwd) local test 2>/dev/null cd grep grep -eu "$@"
+then readonly export "$1" cd && awk awk test "$@" done
+		"$1" $(pwd) local $(pwd) done "$1" --verbose | grep echo
+		| 2>/dev/null && test local "$1" done ${HOME}
+	test local then "$1" cd done && echo --verbose
+'quoted text' 2>/dev/null $(pwd)
+	${HOME} x=1 cd awk then printf then local /usr/bin local
+'quoted text' test then
+	export export --verbose 2>/dev/null printf ${HOME}
+local echo readonly 'quoted text' | printf done cd "$1" 2>/dev/null then grep
+--verbose export export then x=1 && "$@" cd
+readonly export cd 'quoted text' "$@" cd ${HOME} readonly
+	then readonly 'quoted text' -eu -eu 2>/dev/null --verbose ${HOME} "$@" $(pwd)
+| && 'quoted text' export $(pwd)
+		2>/dev/null $(pwd) echo 2>/dev/null done "$1"
+		done x=1 && test --verbose echo 'quoted text'
+export && 'quoted text' 'quoted text' awk local "$@" ${HOME}
+		done "$@" then cd readonly ${HOME} then 2>/dev/null
+	-eu sed awk done 'quoted text' /usr/bin export ${HOME}
+sed && readonly $(pwd) 2>/dev/null | echo --verbose
+cd local /usr/bin | sed sed /usr/bin --verbose cd "$@"
+	echo 'quoted text' && $(pwd) -eu test export
+		local readonly "$@" grep "$@" sed "$@" /usr/bin grep sed
+"$@" --verbose grep ${HOME} export /usr/bin 'quoted text'
+${HOME} readonly then 'quoted text' -eu -eu grep export cd $(pwd) export readonly
+		awk -eu $(pwd) ${HOME}
+		--verbose $(pwd) 2>/dev/null
+awk $(pwd) sed then ${HOME} -eu ${HOME}
+	"$@" 2>/dev/null sed /usr/bin ${HOME} $(pwd) "$@" readonly
+		x=1 test export x=1 grep done ${HOME} awk test
+		sed awk local export "$@" ${HOME} readonly
+test -eu 'quoted text' "$1" awk 'quoted text' 'quoted text' | sed 'quoted text'
+	then test local local --verbose x=1 2>/dev/null 'quoted text' local
+		readonly cd | 2>/dev/null && readonly sed $(pwd) $(pwd)
+	--verbose awk printf 'quoted text' then $(pwd) readonly sed ${HOME} cd ${HOME}
+sed readonly readonly && && readonly grep x=1 x=1 local | done -eu printf local
+	| 'quoted text' sed sed local awk
+	2>/dev/null $(pwd) readonly then then 'quoted text'
+	grep readonly local readonly then "$1" $(pwd) --verbose | export readonly ${HOME}
+		echo 'quoted text' sed sed sed
+export "$1" printf grep --verbose 'quoted text' -eu | then test
+		echo echo readonly awk local 'quoted text' echo "$@" sed ${HOME} echo printf
+echo test grep awk sed --verbose grep 2>/dev/null -eu grep grep echo
+	"$@" && readonly ${HOME} awk awk
+	'quoted text' --verbose --verbose readonly
+awk && done /usr/bin then local 2>/dev/null
+		local then then --verbose cd /usr/bin --verbose x=1 readonly $(pwd) then
+		done export echo readonly /usr/bin awk printf
+	echo /usr/bin | --verbose readonly x=1 grep sed grep test "$1" then then
+sed 2>/dev/null x=1 then readonly "$1" --verbose
+		grep /usr/bin done | export sed readonly /usr/bin --verbose local "$@" "$1" |
+local sed "$@" echo printf
+	printf "$1" --verbose printf x=1 export
+	"$1" readonly echo ${HOME} sed local | local /usr/bin $(pwd) $(pwd) printf
+	then && export grep echo sed | printf cd "$1" && && local
+done ${HOME} $(pwd) export grep
+then done printf readonly
+x=1 | test then $(pwd) done echo -eu test echo test -eu $(pwd) printf -eu $(pwd)
+		awk local readonly "$1" "$@" grep grep local sed && ${HOME} readonly
+	printf cd /usr/bin --verbose grep && awk "$@" "$1" done --verbose 'quoted text'
+		$(pwd) ${HOME} "$1" test echo readonly && local local cd "$@"
+	&& then export grep awk test echo sed export x=1 then ${HOME} then && $(pwd)
+	local awk 2>/dev/null awk "$1" done cd "$@" 2>/dev/null then "$1" printf
+		done awk done /usr/bin done
+		"$@" printf local echo grep local local printf -eu grep "$@" readonly
+		printf grep && printf --verbose readonly then done done --verbose
+'quoted text' cd printf ${HOME} test /usr/bin "$1" grep test
+--verbose && && "$@" /usr/bin
+	export x=1 ${HOME} | echo --verbose "$1" printf then export
+grep ${HOME} -eu /usr/bin echo
+/usr/bin && | -eu /usr/bin test done -eu ${HOME} local "$1" ${HOME}
+		2>/dev/null ${HOME} 2>/dev/null
+test "$@" local printf readonly export test $(pwd) then export ${HOME}
+"$@" "$1" x=1 x=1 2>/dev/null
+	2>/dev/null grep 2>/dev/null printf 'quoted text' $(pwd)
+	2>/dev/null then export ${HOME} awk 2>/dev/null --verbose /usr/bin --verbose 'quoted text'
+&& 2>/dev/null -eu sed grep -eu 2>/dev/null --verbose && --verbose 'quoted text'
+	test | && 'quoted text' 'quoted text' -eu awk | export | ${HOME} grep sed
+		echo test cd -eu echo cd cd test cd -eu done grep readonly /usr/bin then
+		grep cd /usr/bin 'quoted text' echo readonly
+--verbose grep local test
+sed export export done then --verbose "$@" export 'quoted text'
+		2>/dev/null "$@" echo local x=1 /usr/bin
+		-eu then "$@" readonly test awk
+then -eu | 'quoted text'
+	x=1 grep awk awk done && x=1
+	"$1" readonly "$1" cd /usr/bin awk x=1 /usr/bin cd && "$@" $(pwd) x=1 $(pwd)
+cd 2>/dev/null test $(pwd) awk sed x=1 2>/dev/null readonly test x=1
+		grep readonly /usr/bin | readonly then then ${HOME} --verbose cd awk "$1" "$1" export
+		--verbose 2>/dev/null done local readonly readonly grep -eu x=1 then 2>/dev/null
+		grep export $(pwd) ${HOME} | awk grep awk "$@" done echo readonly grep
+cd echo | cd 2>/dev/null 2>/dev/null /usr/bin -eu ${HOME} then
+	x=1 /usr/bin local export grep done | && readonly
+		printf grep echo readonly | readonly $(pwd) $(pwd) $(pwd) -eu
+		local x=1 local cd --verbose export && grep printf $(pwd) 2>/dev/null $(pwd)
+		echo printf "$1" --verbose done
+	"$@" && echo local && ${HOME} ${HOME}
+	&& $(pwd) done local -eu cd sed x=1 /usr/bin
+		x=1 --verbose grep "$1"
+	then local test then sed then echo then
+		2>/dev/null sed export export "$1" printf printf /usr/bin --verbose
+	&& test test x=1 local -eu cd "$@" cd --verbose --verbose done
+	echo then local "$1" awk /usr/bin -eu $(pwd) "$1" "$1" 2>/dev/null /usr/bin cd
+		sed -eu -eu sed test 2>/dev/null
+-eu then echo cd 2>/dev/null then | /usr/bin grep | readonly
+/usr/bin /usr/bin then sed "$1" "$1" && --verbose 2>/dev/null sed
+		"$1" "$@" -eu then x=1 "$1" "$@" test && && x=1 export export ${HOME} "$@"
+grep 2>/dev/null ${HOME} cd printf done awk "$@" sed /usr/bin
+		sed 2>/dev/null printf x=1 ${HOME} 2>/dev/null 'quoted text' "$1" -eu ${HOME}
+"$@" export local echo --verbose "$@" "$1" | --verbose echo readonly /usr/bin
+then readonly && "$@" -eu cd readonly /usr/bin x=1 'quoted text' test
+	test --verbose x=1 x=1
+	-eu readonly done "$@" && local /usr/bin readonly grep x=1 export grep
+${HOME} local -eu ${HOME} | --verbose $(pwd) && -eu "$@"
+		grep done ${HOME} readonly grep ${HOME} --verbose
+		readonly && "$1" "$@" "$@" | grep
+"$1" ${HOME} 2>/dev/null -eu sed printf awk 'quoted text' -eu "$@" sed 'quoted text'
+		&& && /usr/bin export "$@" sed echo sed export
+	--verbose export /usr/bin 2>/dev/null awk --verbose done --verbose x=1 -eu ${HOME}
+-eu "$@" 2>/dev/null x=1 test readonly -eu "$@" awk readonly cd | ${HOME}
+	x=1 local 'quoted text' sed "$1" then local "$1"
+	awk /usr/bin printf readonly 2>/dev/null cd x=1 then | x=1 | x=1 $(pwd) 'quoted text'
+	local test -eu x=1 local awk echo grep readonly echo 'quoted text'
+	printf /usr/bin x=1 echo "$1" export grep sed 2>/dev/null /usr/bin | done
+$(pwd) local 'quoted text' then x=1
+${HOME} echo /usr/bin 2>/dev/null "$@" /usr/bin 'quoted text' 'quoted text'
+done readonly grep $(pwd) local x=1 sed "$@" test sed then --verbose "$@"
+| echo $(pwd) x=1 done readonly grep
+	local local "$@" $(pwd) cd /usr/bin
+	2>/dev/null /usr/bin --verbose export local cd readonly -eu -eu
+-eu echo then $(pwd) 2>/dev/null
+then export && -eu echo printf export local then awk x=1 'quoted text' $(pwd)
+&& sed | grep $(pwd) grep
+2>/dev/null -eu export -eu printf | -eu done then 'quoted text' cd
+	'quoted text' awk /usr/bin "$@" export "$1" grep grep --verbose then
+	printf cd | local "$1" 2>/dev/null $(pwd) "$1" 'quoted text' $(pwd)
+	test $(pwd) readonly echo local | readonly --verbose readonly /usr/bin done export
+		| /usr/bin 2>/dev/null echo grep $(pwd) export sed
+export local done "$@" test --verbose
+	2>/dev/null /usr/bin 2>/dev/null
+2>/dev/null /usr/bin grep --verbose
+	--verbose echo printf grep 'quoted text' && printf export &&
+		'quoted text' then 'quoted text' sed echo echo
+		done "$1" x=1 /usr/bin grep "$@" export awk
+		${HOME} "$@" cd echo cd done 2>/dev/null then done cd awk /usr/bin test test
+	sed export "$@" "$1" cd awk grep local grep then
+then 'quoted text' echo -eu
+		sed grep /usr/bin echo
+	echo | awk sed test --verbose $(pwd) | export "$1" done local printf x=1 2>/dev/null
+		readonly then --verbose cd --verbose
+${HOME} | then test "$1" --verbose x=1 export done /usr/bin 2>/dev/null
+	| "$1" test export then then readonly
+sed x=1 "$1" && "$@" -eu "$1" "$@" ${HOME}
+		grep grep -eu "$1" echo sed readonly test done | grep echo 'quoted text' /usr/bin
+export export 2>/dev/null printf | awk
+done "$1" $(pwd) test "$1" done ${HOME} && awk done
+$(pwd) -eu awk x=1 then test 2>/dev/null --verbose "$@" done
+		echo ${HOME} /usr/bin | grep readonly 2>/dev/null
+grep export done test printf /usr/bin
+	-eu sed 'quoted text' -eu $(pwd) "$1" --verbose -eu readonly grep -eu $(pwd)
+		done ${HOME} ${HOME} | && -eu
+	awk export && /usr/bin 'quoted text' 2>/dev/null "$@" done /usr/bin --verbose
+awk done -eu local "$1" -eu | | then printf done export && awk /usr/bin sed
+local test /usr/bin && echo "$1" export 2>/dev/null $(pwd) 2>/dev/null
+printf /usr/bin local $(pwd) export grep awk "$1" -eu --verbose done test $(pwd)
+	readonly -eu $(pwd) echo grep "$@" done done cd export export
+		printf awk sed /usr/bin echo "$@" $(pwd) -eu 'quoted text' --verbose
+		awk x=1 "$1" 'quoted text' -eu 2>/dev/null grep 2>/dev/null 2>/dev/null
+	printf ${HOME} ${HOME} done readonly | 2>/dev/null
+		/usr/bin 2>/dev/null local
+| ${HOME} grep echo echo x=1 export "$1"
+	cd 2>/dev/null export grep
+	--verbose grep -eu grep "$@" ${HOME}
+cd printf -eu cd 'quoted text' grep grep awk cd test cd grep $(pwd) && cd readonly
+	test export echo echo "$@"
+${HOME} x=1 local done | printf
+-eu /usr/bin sed x=1 2>/dev/null readonly 'quoted text' "$@" test
+export --verbose test "$@" grep | && --verbose /usr/bin printf awk readonly awk
+| /usr/bin awk done awk && "$1" "$@" ${HOME} printf
+	--verbose "$1" 'quoted text'
+	local test test then printf local then ${HOME} | "$@" awk awk -eu export $(pwd)
+printf --verbose /usr/bin 2>/dev/null 2>/dev/null then
+		then 'quoted text' local "$@"
+sed ${HOME} x=1 sed export done echo ${HOME} "$1" && cd printf && x=1 readonly cd
+	echo grep --verbose $(pwd) export "$1" "$1" --verbose
+2>/dev/null printf local --verbose $(pwd) local "$@" 2>/dev/null
+	then /usr/bin test -eu
+		done -eu "$@" then printf readonly
+	cd done -eu -eu -eu && local cd | echo readonly && sed done export
+		printf cd printf test ${HOME} --verbose 'quoted text' grep --verbose
+	awk | grep awk && 'quoted text' --verbose $(pwd) -eu cd test then --verbose done
+		readonly then | done sed grep local --verbose -eu local sed
+		printf "$@" printf | /usr/bin done
+	"$@" printf -eu local export /usr/bin $(pwd)
+		/usr/bin $(pwd) "$@" 2>/dev/null printf -eu "$@" 2>/dev/null test -eu
+	&& ${HOME} "$@" then awk && local printf /usr/bin 2>/dev/null
+	awk then 'quoted text' cd | && then && done grep printf cd local sed
+	echo printf 2>/dev/null "$1" "$1" sed done
+	cd export x=1 -eu then 'quoted text' --verbose then awk readonly
+${HOME} export echo $(pwd)
+		2>/dev/null cd readonly sed --verbose test --verbose done
+		awk ${HOME} $(pwd) export | 'quoted text' readonly
+${HOME} test grep export "$1" | sed 2>/dev/null && local | && done done && done
+		--verbose export x=1 $(pwd) sed 'quoted text' 'quoted text'
+		${HOME} awk "$1" readonly cd echo x=1 printf done 2>/dev/null
+'quoted text' ${HOME} then awk x=1 printf 'quoted text' sed /usr/bin
+		printf "$@" readonly readonly sed echo cd done grep --verbose sed
+2>/dev/null then awk ${HOME} -eu echo awk awk 2>/dev/null
+--verbose 'quoted text' done x=1
+"$1" awk | ${HOME} | grep $(pwd) readonly echo readonly 2>/dev/null
+		cd 2>/dev/null "$@" test | test test 2>/dev/null
+"$@" cd echo && awk awk then -eu local
+	export --verbose awk x=1 2>/dev/null
+	&& grep awk "$@" -eu awk
+		| --verbose echo x=1 done
+&& grep | 'quoted text' "$@" export grep "$1"
+-eu "$@" echo 2>/dev/null $(pwd) done 2>/dev/null --verbose -eu
+	&& sed $(pwd) /usr/bin then then 'quoted text' x=1 then "$@" readonly grep ${HOME}
+	grep test printf done
+	${HOME} -eu then 'quoted text' local
+--verbose test && -eu grep x=1 'quoted text' "$1" cd awk 'quoted text'
+	test x=1 cd -eu 2>/dev/null printf test -eu
+		grep -eu done | ${HOME} ${HOME} "$@"
+	done $(pwd) && 'quoted text'
+		printf local "$@" "$@" | $(pwd)
+		local "$1" 'quoted text' test --verbose
+'quoted text' -eu test && export cd 'quoted text' awk test test
+	test sed test 2>/dev/null done -eu done "$@" test done cd 'quoted text' echo
+	'quoted text' ${HOME} && done 'quoted text' done done
+		--verbose test | awk sed --verbose
+	2>/dev/null 2>/dev/null --verbose awk --verbose 2>/dev/null
+done test done --verbose test test --verbose grep "$1" export export
+	grep export ${HOME} done sed grep "$@" --verbose
+		| --verbose "$1" /usr/bin
+	"$@" sed --verbose --verbose sed
+test 'quoted text' --verbose sed done
+	readonly 2>/dev/null readonly local /usr/bin readonly && echo
+	printf 'quoted text' "$1" "$@" done ${HOME} "$@" 'quoted text' local awk then
+		then /usr/bin $(pwd) "$1" local "$@" | "$@"
+		x=1 -eu done $(pwd) test then -eu sed sed local
+	2>/dev/null --verbose
+	'quoted text' && "$1" grep done local then
+	&& --verbose "$1" awk | -eu --verbose done "$@" $(pwd) --verbose x=1 "$1"
+	| awk $(pwd) 2>/dev/null && done x=1 done ${HOME} 2>/dev/null "$@"
+	x=1 sed export ${HOME} export readonly
+		local 'quoted text' $(pwd) printf | 'quoted text' -eu
+	2>/dev/null ${HOME} 2>/dev/null
+		&& x=1 "$@" && export "$@" && | 'quoted text' export readonly cd printf
+	&& $(pwd) /usr/bin --verbose --verbose "$1" local grep readonly export grep "$@"
+	readonly && -eu then local export "$1" ${HOME} awk awk
+$(pwd) "$@" cd "$@" export /usr/bin echo "$1" then
+		sed done ${HOME} 2>/dev/null -eu x=1 printf "$@" printf
+	printf ${HOME} readonly x=1 2>/dev/null 2>/dev/null x=1 "$1" then ${HOME}
+| done 'quoted text' test cd $(pwd) cd cd && 'quoted text' grep
+	echo | sed && echo then $(pwd)
+	&& export | awk --verbose 'quoted text' 'quoted text' 2>/dev/null
+		then | 'quoted text' grep then awk ${HOME} "$@" -eu /usr/bin ${HOME} test
+	$(pwd) && grep sed 2>/dev/null x=1 local printf 'quoted text'
+		/usr/bin 2>/dev/null /usr/bin
+		export $(pwd) local 2>/dev/null local && $(pwd) && test local | ${HOME} | then
+cd && awk echo echo "$@" /usr/bin
+export done $(pwd) --verbose echo 2>/dev/null -eu test 'quoted text' cd export grep
+	--verbose test done && cd 2>/dev/null 2>/dev/null --verbose awk local awk
+&& echo x=1 ${HOME} then | /usr/bin 2>/dev/null | | --verbose then
+cd cd awk awk | -eu -eu && x=1 -eu && test | then printf x=1
+	| && && | "$@" cd done ${HOME} "$@" | "$1" local /usr/bin
+	-eu grep sed -eu -eu grep --verbose local && 'quoted text' $(pwd)
+		"$@" "$1" "$@" local sed /usr/bin 'quoted text' readonly echo
+	then | | grep -eu printf ${HOME}
+		${HOME} awk awk --verbose x=1 grep $(pwd) x=1 awk echo
+		x=1 readonly $(pwd) 2>/dev/null x=1 $(pwd) sed
+done sed cd readonly cd ${HOME} local -eu grep readonly -eu readonly test echo
+cd readonly --verbose $(pwd)
+	"$@" 2>/dev/null local 2>/dev/null
+then ${HOME} --verbose echo /usr/bin /usr/bin awk readonly
+then readonly test local && $(pwd) export x=1 $(pwd) 2>/dev/null
+	done sed 2>/dev/null && -eu grep cd 'quoted text' ${HOME} $(pwd) $(pwd)
+x=1 awk echo x=1 test "$@" $(pwd) "$1" readonly local grep then cd done printf
+	grep test "$1" --verbose grep grep "$1" && cd --verbose x=1 -eu test -eu
+grep printf printf readonly $(pwd) 2>/dev/null --verbose x=1 sed ${HOME} /usr/bin
+	export /usr/bin echo "$1" awk then | readonly | grep
+	grep grep printf 2>/dev/null echo
+	--verbose "$1" $(pwd) grep export
+$(pwd) x=1 ${HOME} && echo | test echo export echo | then 2>/dev/null local echo
+		export -eu then ${HOME} cd awk awk -eu ${HOME} done "$@"
+	$(pwd) 'quoted text' done | local export test -eu done ${HOME} -eu readonly
+		local local x=1 && "$1" "$1" /usr/bin readonly cd ${HOME} echo
+	| done readonly sed | $(pwd) done
+	awk cd | | x=1 cd then ${HOME} --verbose local done
+	"$@" 2>/dev/null sed printf readonly
+		--verbose echo export x=1 local "$1" 'quoted text' done
+	test "$1" cd 2>/dev/null --verbose | printf | "$1" 2>/dev/null printf
+x=1 'quoted text' --verbose test local
+	echo cd echo ${HOME} "$1" cd
+	/usr/bin echo 2>/dev/null "$@" /usr/bin awk --verbose x=1 cd echo $(pwd) 'quoted text'
+	"$@" $(pwd) readonly then done "$1" --verbose "$@" /usr/bin 'quoted text'
+	2>/dev/null -eu local /usr/bin
+	then "$1" -eu "$1" printf --verbose grep export grep done
+		done | cd 2>/dev/null echo --verbose x=1 -eu /usr/bin 2>/dev/null -eu ${HOME}
+/usr/bin awk ${HOME} echo $(pwd) awk then then echo cd readonly --verbose
+		then awk ${HOME} awk && "$1" 'quoted text' ${HOME} --verbose sed readonly
+readonly export $(pwd) done then "$1" 2>/dev/null export export sed ${HOME} done
+		export readonly $(pwd) readonly readonly export local "$@" readonly grep /usr/bin
+		2>/dev/null export $(pwd) 'quoted text' grep
+done ${HOME} && sed 2>/dev/null "$1" | sed 'quoted text'
+		/usr/bin printf "$@" -eu grep printf
+	${HOME} printf echo grep readonly sed sed then x=1 /usr/bin
+	echo then $(pwd) printf | --verbose done /usr/bin
+	grep | local "$1" awk --verbose echo done -eu ${HOME} readonly done
+		&& | echo echo /usr/bin sed echo && 'quoted text'
+x=1 done grep x=1 -eu && local -eu /usr/bin echo done /usr/bin
+then export cd export "$1" $(pwd) done
+/usr/bin local 2>/dev/null
+	'quoted text' local test export "$@" x=1 export && | cd && printf $(pwd) --verbose
+	'quoted text' && "$@" local cd readonly "$@" 2>/dev/null
+	-eu -eu sed "$1" && 2>/dev/null "$1" sed echo 'quoted text' | 'quoted text'
+| "$@" test "$@" --verbose
+		cd /usr/bin echo 2>/dev/null $(pwd)
+sed x=1 "$1" readonly $(pwd)
+	--verbose 'quoted text' -eu export local done ${HOME} && grep
+	cd --verbose local done readonly printf -eu sed 2>/dev/null
+2>/dev/null "$1" local printf done local cd ${HOME}
+	echo sed awk local export "$1" export sed
+		echo 'quoted text' sed done printf && export
+		'quoted text' -eu export
+	printf then cd 'quoted text' readonly 2>/dev/null x=1 | then | x=1 grep grep echo
+cd local && then "$@" ${HOME} echo awk --verbose readonly export 2>/dev/null
+		sed ${HOME} echo done printf 2>/dev/null printf 2>/dev/null local "$1"
+		'quoted text' -eu cd export x=1 'quoted text' echo "$1" 'quoted text'
+		| done x=1 done grep $(pwd) awk -eu $(pwd) sed echo | readonly done sed then cd
+	then sed 'quoted text' local readonly sed printf "$1" grep x=1 x=1 | x=1 ${HOME}
+		"$1" && then x=1 sed printf sed $(pwd)
+		printf | 'quoted text' readonly sed echo /usr/bin then && "$@" local /usr/bin
+		'quoted text' 2>/dev/null test grep done 2>/dev/null
+	x=1 ${HOME} local "$@" "$@" ${HOME} done 2>/dev/null sed test -eu
+		/usr/bin $(pwd) --verbose echo --verbose echo awk export awk -eu
+		-eu $(pwd) awk "$1" && && 'quoted text' ${HOME} && local test --verbose export local
+'quoted text' /usr/bin then grep
+		printf then 'quoted text' sed --verbose cd $(pwd) && --verbose echo ${HOME}
+"$@" ${HOME} /usr/bin then export ${HOME} && 'quoted text' test printf x=1 printf
+		$(pwd) cd test export /usr/bin "$@" --verbose export
+	-eu "$@" && done echo && readonly readonly
+		-eu "$@" cd awk | local && x=1
+/usr/bin readonly "$1"
+	then printf ${HOME} /usr/bin readonly && ${HOME} x=1 |
+		test cd echo export 'quoted text' echo cd then export
+'quoted text' | done "$1" $(pwd) -eu /usr/bin echo local 'quoted text'
+grep test ${HOME} cd $(pwd) | && echo printf && 2>/dev/null x=1
+awk /usr/bin --verbose "$1" -eu echo /usr/bin
+--verbose test cd done /usr/bin --verbose readonly -eu local --verbose awk grep
+		--verbose 2>/dev/null -eu echo && done 2>/dev/null readonly x=1
+	--verbose -eu --verbose 2>/dev/null x=1 local -eu local echo done
+	&& done done /usr/bin --verbose cd printf export $(pwd) awk grep then local
+local "$1" test && echo readonly
+	"$@" test x=1 test /usr/bin sed cd sed printf readonly cd
+		readonly then done /usr/bin "$1" printf -eu $(pwd) grep && echo $(pwd) grep 'quoted text'
+$(pwd) "$@" cd printf test
+&& local "$@" 'quoted text' &&
+	cd export -eu export && | x=1 "$@" 2>/dev/null export ${HOME} readonly $(pwd)
+	"$1" then 'quoted text' x=1 printf
+		-eu done --verbose ${HOME} awk awk export local | then "$@"
+		-eu printf $(pwd) -eu "$1" readonly
+		cd awk --verbose readonly test test grep ${HOME} then test $(pwd)
+	export done "$@" "$1"
+	&& readonly "$@" -eu export "$@" echo
+export export && export grep --verbose $(pwd) test export
+	awk /usr/bin "$@" -eu test
+		"$@" -eu | | printf export && local
+"$@" x=1 local readonly cd 'quoted text'
+	printf "$1" echo && && printf
+	--verbose cd done 'quoted text' cd done printf | test "$1" -eu --verbose
+	done --verbose 2>/dev/null grep export printf
+	then done 'quoted text' "$1" | ${HOME} export ${HOME} --verbose $(pwd) $(pwd)
+		x=1 2>/dev/null | test "$@" $(pwd) --verbose x=1 2>/dev/null cd
+	then 2>/dev/null --verbose printf $(pwd) --verbose then then done sed x=1
+"$@" -eu 2>/dev/null echo readonly ${HOME} ${HOME} 'quoted text'
+awk "$@" | --verbose printf grep sed $(pwd) "$@" cd printf 2>/dev/null
+${HOME} $(pwd) ${HOME} grep local --verbose
+		"$@" export then then "$1" && then grep test --verbose
+then | grep then done /usr/bin | ${HOME}
+	| -eu grep | awk "$@" $(pwd) && local
+test 'quoted text' "$1" awk then /usr/bin printf "$1" sed $(pwd) -eu
+	awk $(pwd) -eu x=1 awk readonly
+export "$@" sed ${HOME} sed "$1" |
+-eu 2>/dev/null cd -eu
+	then test export --verbose export echo export | echo local grep $(pwd) done
+		printf local then 'quoted text' local "$@" test
+	${HOME} "$1" 'quoted text' --verbose printf readonly local x=1 printf echo
+"$@" done "$1" 2>/dev/null /usr/bin x=1 grep awk
+		$(pwd) cd 2>/dev/null $(pwd)
+		/usr/bin sed "$@" $(pwd) $(pwd) cd $(pwd) export
+	test awk test awk $(pwd) local --verbose
+		done x=1 2>/dev/null done sed awk awk done local --verbose readonly
+/usr/bin grep echo awk then grep grep && grep -eu ${HOME} sed | "$1" cd "$@"
+&& $(pwd) then && ${HOME} x=1 "$@" "$1" /usr/bin 2>/dev/null -eu
+&& sed printf then local x=1 local | cd export $(pwd) export
+cd local local "$1" cd
+sed export 'quoted text' printf "$@"
+$(pwd) --verbose && | x=1 ${HOME} awk sed echo
+	"$1" then readonly local ${HOME} cd export | printf awk awk ${HOME} /usr/bin
+	$(pwd) echo 2>/dev/null then && readonly
+		sed grep cd | ${HOME} local x=1 export printf
+		2>/dev/null 2>/dev/null | then done
+		grep 2>/dev/null then done --verbose "$1" readonly
+x=1 | && && echo sed cd | echo
+		cd cd test echo 'quoted text' -eu done 'quoted text' 'quoted text'
+$(pwd) echo "$@" export "$1" 'quoted text' /usr/bin "$@" export $(pwd)
+x=1 'quoted text' | 'quoted text'
+--verbose --verbose 'quoted text' /usr/bin echo $(pwd) awk 2>/dev/null
+	cd export printf --verbose /usr/bin grep grep $(pwd) grep
+		readonly done done test ${HOME}
+		/usr/bin $(pwd) sed export
+export | 2>/dev/null test x=1 'quoted text'
+	printf local -eu x=1 'quoted text'
+test /usr/bin x=1 | readonly 2>/dev/null then
+	grep $(pwd) -eu echo -eu /usr/bin sed grep sed echo awk --verbose
+sed readonly test printf local
+		--verbose test printf "$@" "$@" readonly echo 'quoted text'
+		x=1 | awk 'quoted text'
+printf sed grep x=1 echo "$1" cd export "$1"
+		-eu /usr/bin sed x=1 cd done sed awk test | then 'quoted text'
+		"$1" awk && -eu done | sed "$@" export
+		echo sed then 2>/dev/null "$@" 2>/dev/null && grep "$@"
+x=1 local x=1 && test then grep
+export grep 2>/dev/null /usr/bin && ${HOME} --verbose
+"$1" then "$@" grep local export "$1" ${HOME} then cd then done "$1" echo sed
+	printf "$@" --verbose | -eu /usr/bin
+		echo readonly $(pwd) test readonly 2>/dev/null cd "$1" "$1" | cd -eu 'quoted text'
+then 'quoted text' 'quoted text' $(pwd) --verbose
+		export --verbose awk then readonly cd $(pwd) echo x=1 test /usr/bin
+		local 'quoted text' grep grep $(pwd)
+-eu /usr/bin test awk ${HOME}
+2>/dev/null readonly then $(pwd) ${HOME} grep "$@" x=1 sed
+${HOME} readonly export local x=1 'quoted text' grep -eu
+printf then export cd local | -eu && ${HOME}
+	2>/dev/null export readonly
+		${HOME} cd --verbose readonly
+	$(pwd) -eu --verbose printf export sed local
+	'quoted text' grep printf
+		echo x=1 | -eu sed x=1 'quoted text' /usr/bin && echo && 2>/dev/null sed
+		2>/dev/null echo "$1" /usr/bin then printf --verbose /usr/bin 'quoted text'
+	"$1" done grep local printf test local echo $(pwd) printf test test cd --verbose
+export then x=1 | echo awk -eu -eu export export
+export x=1 cd --verbose local "$@" done 'quoted text' awk x=1 test -eu awk done
+		cd readonly grep sed /usr/bin cd ${HOME} echo cd echo grep export |
+		| "$1" --verbose test readonly
+	export 'quoted text' echo sed export then x=1 local echo grep "$1" "$@" export
+	awk ${HOME} --verbose grep $(pwd) echo "$1" ${HOME} printf test | done
+--verbose 'quoted text' local /usr/bin
+| echo ${HOME} $(pwd) awk local && ${HOME} then "$1" ${HOME} sed --verbose --verbose
+| readonly && -eu local echo && echo --verbose "$@" | && && $(pwd) readonly grep
+	"$@" && awk "$@" --verbose printf echo readonly ${HOME} ${HOME}
+"$1" --verbose readonly && echo echo
+		done 'quoted text' test && readonly printf | readonly export
+	echo grep echo echo export then "$1"
+		cd done x=1 export 2>/dev/null
+	${HOME} cd -eu "$1" then local export -eu 'quoted text' local local 2>/dev/null
+		${HOME} "$1" /usr/bin local 'quoted text' readonly $(pwd)
+	sed test && echo && $(pwd) | then --verbose "$1" 'quoted text' test awk
+		grep 2>/dev/null && done "$@" -eu
+cd "$1" cd then awk ${HOME}
+--verbose /usr/bin $(pwd) 'quoted text' $(pwd) --verbose sed 'quoted text'
+	awk 'quoted text' ${HOME} printf echo x=1 local "$@" echo
+| x=1 ${HOME} cd readonly "$1" cd awk cd $(pwd) ${HOME} cd local x=1 -eu grep
+		$(pwd) local test 2>/dev/null x=1 | 'quoted text'
+	cd ${HOME} /usr/bin | awk local grep done cd then $(pwd) --verbose test awk "$1"
+then cd export sed | 2>/dev/null then then echo /usr/bin
+	done done ${HOME} awk cd /usr/bin
+grep grep $(pwd) sed /usr/bin && ${HOME} ${HOME} x=1 $(pwd) grep -eu
+"$1" && test /usr/bin | ${HOME} -eu "$@"
+	export test grep cd readonly grep | awk &&
+export | echo 'quoted text' echo x=1 readonly "$@" 'quoted text'
+		test readonly --verbose grep 'quoted text'
+	/usr/bin export sed cd then printf "$@" sed
+		cd local sed --verbose awk local /usr/bin
+local ${HOME} && local "$1" "$@" readonly x=1 sed echo "$1" export
+		--verbose local printf local echo ${HOME} 2>/dev/null
+		grep local 2>/dev/null sed awk "$@" test -eu printf |
+		2>/dev/null "$@" ${HOME} && awk printf then $(pwd)
+		"$@" export test $(pwd) sed awk done printf --verbose echo /usr/bin
+	printf 2>/dev/null grep $(pwd) $(pwd) 2>/dev/null
+done | sed local "$@" $(pwd) "$@" readonly
+		export sed --verbose ${HOME} printf /usr/bin
+	export ${HOME} | sed local ${HOME} $(pwd) $(pwd) && $(pwd) local --verbose x=1
+cd grep | local && grep -eu 'quoted text' 2>/dev/null 2>/dev/null test
+	'quoted text' $(pwd) cd 2>/dev/null sed grep x=1 awk cd local
+	"$1" awk && x=1 printf grep /usr/bin && sed then grep 'quoted text' &&
+sed echo grep x=1 printf grep grep local ${HOME} "$1" export then sed
+	"$1" && x=1 readonly "$@" $(pwd) $(pwd) printf export
+	"$1" /usr/bin then "$1" && echo test awk 2>/dev/null
+	printf 2>/dev/null done awk cd --verbose && echo local echo
+		$(pwd) grep 'quoted text' printf | sed
+"$1" export --verbose echo 'quoted text' "$1" --verbose "$1" -eu printf awk done
+	then cd printf --verbose cd ${HOME} grep "$@" $(pwd) 2>/dev/null | $(pwd) sed
+${HOME} "$1" 2>/dev/null cd /usr/bin 'quoted text' cd readonly
+	then ${HOME} ${HOME} ${HOME} sed export test
+		${HOME} | /usr/bin --verbose
+		--verbose readonly cd | "$1"
+	export /usr/bin ${HOME} readonly $(pwd) x=1 | done "$1" then grep echo readonly
+		--verbose --verbose done local awk
+		done --verbose then echo export
+	"$1" -eu "$@" grep ${HOME} awk 2>/dev/null
+	export 'quoted text' "$@" awk "$1" x=1
+	${HOME} export local $(pwd) && x=1
+		"$@" test local readonly --verbose "$1" --verbose
+		printf echo ${HOME} done | -eu x=1 -eu 2>/dev/null
+		awk awk "$@" local ${HOME} ${HOME} x=1 | cd $(pwd) &&
+		readonly $(pwd) done test 2>/dev/null local /usr/bin ${HOME} && readonly readonly
+		export "$@" -eu export grep "$1" then /usr/bin x=1 sed $(pwd)
+		--verbose cd /usr/bin export
+	readonly echo $(pwd) awk echo "$1" $(pwd) printf -eu done --verbose
+printf done | then -eu -eu 2>/dev/null
+2>/dev/null | "$1" test echo test /usr/bin && printf
+		awk 'quoted text' 2>/dev/null | | --verbose
+		'quoted text' ${HOME} "$1" readonly
+		sed -eu cd printf && "$1"
+		/usr/bin readonly "$1" $(pwd)
+x=1 printf /usr/bin x=1 $(pwd) -eu /usr/bin /usr/bin
+readonly $(pwd) grep test then
+	"$1" | cd then echo sed | && && && printf | "$1" -eu sed $(pwd) readonly
+	printf "$@" x=1 grep "$@" | "$@" export then x=1 then then
+		cd -eu done "$1" 2>/dev/null "$@" $(pwd) /usr/bin x=1 export "$@" cd then
+	/usr/bin /usr/bin "$1" ${HOME} 'quoted text' done local
+	2>/dev/null then && sed | test echo awk grep cd
+'quoted text' $(pwd) $(pwd) 2>/dev/null $(pwd) then "$@"
+		cd grep readonly | | x=1
+		sed readonly ${HOME} "$@" echo awk echo -eu "$1"
+	test /usr/bin 'quoted text' done "$1" -eu export cd printf
+	cd echo $(pwd) && $(pwd) local 2>/dev/null && readonly 2>/dev/null
+-eu echo grep /usr/bin test | printf cd $(pwd) -eu
+--verbose "$@" 2>/dev/null
+	echo readonly "$@" echo done 2>/dev/null
+	&& awk echo $(pwd) /usr/bin 'quoted text' 2>/dev/null local
+	$(pwd) "$1" then awk ${HOME} 'quoted text' "$1" grep 'quoted text'
+	local && echo && test --verbose then
+		2>/dev/null 2>/dev/null "$1" 'quoted text' done
+/usr/bin x=1 printf echo awk -eu printf readonly
+	${HOME} readonly "$@" -eu
+	sed | 'quoted text' 2>/dev/null cd local | && $(pwd) && test echo x=1 --verbose
+echo 2>/dev/null x=1 2>/dev/null done "$@" cd
+-eu ${HOME} awk "$1" test $(pwd) grep local -eu then
+--verbose x=1 | | | readonly $(pwd) sed "$@" x=1 grep readonly
+		awk echo "$1" "$@" export "$1" awk --verbose
+export 'quoted text' export sed --verbose
+	"$1" test awk cd 2>/dev/null export "$1"
+		| --verbose -eu | 'quoted text'
+	printf export cd --verbose cd test done && "$1"
+	| "$1" -eu -eu -eu local readonly
+-eu printf && test --verbose x=1
+	awk 2>/dev/null "$1" cd
+	/usr/bin local cd done
+	2>/dev/null sed done export
+2>/dev/null x=1 x=1 $(pwd) readonly
+		-eu "$1" --verbose -eu x=1 /usr/bin
+test local awk then "$@" then test echo awk export
+	'quoted text' ${HOME} then "$1" && cd echo /usr/bin
+	/usr/bin 2>/dev/null done done && "$1" ${HOME}
+'quoted text' | then --verbose then $(pwd) awk cd sed
+grep 'quoted text' done $(pwd) echo --verbose cd && sed echo
+	2>/dev/null /usr/bin | awk x=1 -eu test readonly grep grep && /usr/bin
+		"$@" then --verbose -eu grep "$1" "$1" 2>/dev/null export done test readonly "$1"
+		grep readonly then 'quoted text' awk && x=1 echo /usr/bin cd readonly && -eu test
+'quoted text' | "$@" "$1" printf export $(pwd) printf "$@" done "$1" "$1" cd $(pwd)
+export then export -eu --verbose local done ${HOME} "$@" /usr/bin readonly then
+	sed --verbose /usr/bin printf export && export ${HOME} 'quoted text'
+	2>/dev/null | && $(pwd) 'quoted text' 'quoted text' grep
+		cd readonly echo test awk x=1 done
+readonly 'quoted text' done x=1 grep echo export
+test readonly "$@" printf
+		| grep grep /usr/bin 2>/dev/null export sed /usr/bin readonly
+		--verbose export "$@" local printf ${HOME} grep
+		"$1" grep echo $(pwd) -eu local
+then test export awk readonly
+		then test "$1" echo printf "$1" 2>/dev/null test
+printf 2>/dev/null local ${HOME} local
+	echo export export && "$1" readonly && echo 2>/dev/null
+sed then done grep ${HOME} awk $(pwd) --verbose local then "$@" done awk
+	x=1 ${HOME} ${HOME} echo grep | export --verbose
+	grep && awk echo grep echo | | readonly
+	${HOME} | then /usr/bin | --verbose export sed grep
+	then 'quoted text' readonly 'quoted text' /usr/bin cd -eu
+		readonly local cd 2>/dev/null 'quoted text'
+cd && export export done "$1" && sed printf "$@" grep
+		echo $(pwd) readonly grep /usr/bin echo awk local test awk grep readonly
+echo ${HOME} ${HOME} --verbose
+		"$@" readonly /usr/bin && 2>/dev/null 2>/dev/null
+export done --verbose export local
+	| echo done export cd local $(pwd) "$1" then --verbose | readonly readonly
+	"$1" cd | x=1 readonly awk 'quoted text' /usr/bin -eu
+echo 2>/dev/null -eu local --verbose
+	done /usr/bin grep readonly grep cd test done ${HOME} $(pwd) ${HOME}
+		then sed grep | --verbose 'quoted text' | readonly && | cd "$1" printf | x=1 "$1"
+		x=1 "$@" x=1 test readonly 2>/dev/null cd grep sed echo ${HOME}
+grep 'quoted text' printf
+		sed readonly "$1" echo
+		sed readonly cd cd 2>/dev/null grep grep | "$@" "$1" -eu local | /usr/bin 2>/dev/null
+		x=1 echo ${HOME} cd 2>/dev/null
+	sed grep | ${HOME} readonly grep awk | ${HOME} | awk | awk readonly export
+		then --verbose echo local cd sed then grep && export
+		then cd 2>/dev/null ${HOME}
+		'quoted text' done grep printf awk | "$@" ${HOME} sed "$@"
+		"$@" awk -eu grep local ${HOME} 'quoted text' ${HOME} then
+'quoted text' export && "$1" done grep 'quoted text' -eu 'quoted text' test awk
+	'quoted text' $(pwd) --verbose $(pwd) sed --verbose sed then
+		${HOME} $(pwd) | && "$1"
+"$@" 'quoted text' sed --verbose $(pwd)
+		&& /usr/bin echo done $(pwd)
+		export "$@" export /usr/bin export | 2>/dev/null grep && ${HOME} cd cd
+		export cd echo echo test test cd printf "$@" "$1" ${HOME} &&
+	--verbose test | ${HOME} | awk local test awk local printf
+		then ${HOME} /usr/bin -eu $(pwd) /usr/bin
+	--verbose sed 2>/dev/null
+then readonly cd export then test /usr/bin --verbose
+	--verbose export "$1" && printf -eu test export x=1 printf --verbose | readonly
+printf x=1 printf 'quoted text' 'quoted text' 2>/dev/null
+		local cd --verbose && && ${HOME} test printf sed
+${HOME} readonly x=1 export x=1 local test x=1 && local && export
+		-eu cd --verbose then grep && 'quoted text' x=1 readonly x=1
+$(pwd) && done -eu ${HOME}
+printf $(pwd) 'quoted text'
+		test sed 2>/dev/null "$1" 'quoted text' --verbose printf
+		echo | cd && -eu -eu "$1" local printf
+	&& sed -eu export test 'quoted text' printf sed printf
+cd echo grep cd 2>/dev/null readonly --verbose then then
+	&& cd "$1" 2>/dev/null "$1" "$1" | 2>/dev/null
+		export local export "$@" local x=1 printf grep 2>/dev/null export "$1"
+	then 2>/dev/null printf x=1
+		| cd "$@" export then x=1 sed | && && 2>/dev/null | test /usr/bin readonly
+	export "$1" printf | grep $(pwd) export
+	/usr/bin | $(pwd) cd x=1 done sed /usr/bin test "$1" && export "$1"
+x=1 && test /usr/bin sed &&
+then ${HOME} $(pwd) printf
+-eu awk -eu x=1 $(pwd) test --verbose
+	${HOME} "$1" /usr/bin cd cd sed "$1" "$1" cd /usr/bin "$@" done test
+	"$1" awk done && | awk x=1 cd x=1
+		/usr/bin cd echo then 'quoted text' grep x=1 /usr/bin local -eu
+--verbose 'quoted text' x=1 -eu test 2>/dev/null
+"$@" test printf /usr/bin "$1" -eu
+	readonly then export cd grep x=1 export then readonly && "$1" ${HOME} local
+"$1" "$1" cd 2>/dev/null x=1 export echo echo && --verbose local
+	| export test "$@" awk then && readonly "$1" /usr/bin --verbose $(pwd)
+test -eu test ${HOME} 2>/dev/null --verbose | "$1" export "$@" done "$1" "$@"
+readonly | grep -eu cd cd echo grep "$1" /usr/bin sed
+		sed grep test "$1" test then echo | export
+		$(pwd) export awk "$@" readonly grep $(pwd) "$1" local && | /usr/bin
+		--verbose printf && /usr/bin then "$1" echo printf "$1" 'quoted text'
+	cd sed $(pwd) cd sed sed "$1" test echo 'quoted text' readonly
+	test local $(pwd) "$1" grep /usr/bin grep --verbose export export "$@" grep done
+	x=1 printf printf "$@" sed && "$1" echo awk $(pwd) && 2>/dev/null $(pwd) readonly
+		| sed sed done readonly local
+2>/dev/null export $(pwd) | 2>/dev/null
+2>/dev/null export /usr/bin cd -eu "$@" --verbose x=1 -eu
+	-eu 'quoted text' /usr/bin ${HOME} done
+$(pwd) done /usr/bin -eu test test test /usr/bin done
+2>/dev/null 'quoted text' awk x=1 export awk 'quoted text'
+	2>/dev/null $(pwd) done sed echo ${HOME} x=1
+	awk local cd readonly awk sed 'quoted text'
+done grep | awk $(pwd)
+	-eu "$@" $(pwd) local /usr/bin local 2>/dev/null "$1" 'quoted text'
+		export test 2>/dev/null grep sed && x=1 x=1 done test -eu 2>/dev/null
+	awk then local "$@" awk 2>/dev/null echo | -eu echo readonly "$@"
+		cd ${HOME} "$1" sed cd $(pwd) $(pwd) ${HOME}
+		printf cd done local | grep echo && export readonly done printf $(pwd) printf
+	then x=1 /usr/bin | readonly test then grep then
+sed done -eu && awk --verbose echo grep
+	2>/dev/null then 2>/dev/null
+	then "$1" readonly $(pwd) local grep grep echo ${HOME} /usr/bin ${HOME}
+	local sed done --verbose -eu
+		readonly grep export grep
+local then 2>/dev/null export echo grep --verbose "$1" && printf sed "$1"
+| awk 'quoted text' $(pwd)
+	'quoted text' sed readonly --verbose
+		cd 2>/dev/null done grep "$@" /usr/bin 'quoted text' then readonly local
+x=1 "$@" "$@" /usr/bin cd local --verbose "$@" | then sed done then cd awk
+export "$1" cd local echo /usr/bin cd test export echo grep x=1 "$1" printf
+	$(pwd) test printf "$1" sed && "$@" /usr/bin
+export then 'quoted text' export 'quoted text'
+		test readonly "$1" export 'quoted text' -eu done $(pwd) readonly ${HOME}
+		export 2>/dev/null 2>/dev/null
+then ${HOME} local test then awk readonly test cd
+	grep "$@" echo test local ${HOME} "$1" test
+local echo /usr/bin "$1"
+		&& "$1" $(pwd) "$@" /usr/bin -eu done grep --verbose -eu -eu
+'quoted text' /usr/bin printf -eu local --verbose done --verbose "$@" readonly
+	done sed readonly readonly --verbose && /usr/bin echo "$@" "$@" grep
+	$(pwd) 'quoted text' test | local readonly sed test ${HOME} "$1" grep test x=1
+		x=1 -eu x=1 cd "$1" "$1" echo local grep "$1" then ${HOME}
+		$(pwd) 2>/dev/null | -eu local 2>/dev/null x=1 'quoted text'
+	/usr/bin /usr/bin sed x=1 /usr/bin 2>/dev/null export
+	export then $(pwd) done
+then then readonly then && && -eu cd
+awk awk 2>/dev/null echo grep then "$@" grep ${HOME} x=1 local
+then "$1" done then "$1" --verbose | "$1"
+		${HOME} | --verbose -eu ${HOME} "$@" 2>/dev/null x=1 "$1" && 'quoted text'
+		'quoted text' then printf readonly -eu grep "$1" test test local then test
+	grep sed local --verbose cd /usr/bin $(pwd) then x=1 "$@" $(pwd) && test
+printf export && "$1" -eu
+		local 2>/dev/null -eu "$1" /usr/bin "$1"
+$(pwd) readonly && sed /usr/bin awk readonly "$1" 'quoted text'
+	-eu sed $(pwd) ${HOME} cd /usr/bin then
+	test | local then export sed cd x=1 && printf sed && | test readonly readonly
+		printf -eu then awk "$1" && $(pwd) ${HOME} "$@" --verbose | 2>/dev/null
+&& printf && 2>/dev/null local
+	awk printf | local "$@" /usr/bin x=1 printf cd sed
+	local export 2>/dev/null | | grep && echo done grep /usr/bin --verbose
+done "$1" "$@" "$@" awk /usr/bin
+echo "$1" grep x=1 awk then "$@" echo readonly -eu cd --verbose /usr/bin
+x=1 -eu printf 'quoted text' local local readonly
+		&& export then "$@" "$1" /usr/bin 'quoted text' sed echo && then readonly
+		local x=1 | export x=1 echo grep -eu cd readonly /usr/bin export test
+		--verbose 'quoted text' cd then local -eu grep readonly 2>/dev/null
+		&& awk echo && 'quoted text' local local $(pwd) $(pwd) x=1 | cd echo
+		"$1" /usr/bin then local $(pwd) $(pwd)
+		x=1 printf -eu | test printf "$@"
+-eu && local cd && 'quoted text'
+"$@" "$1" sed export test "$@" 'quoted text' "$1" /usr/bin then && cd --verbose
+	/usr/bin then cd grep cd cd test /usr/bin ${HOME} $(pwd) done
+		'quoted text' 2>/dev/null test 2>/dev/null
+&& printf test printf test --verbose /usr/bin local /usr/bin /usr/bin -eu
+		local --verbose "$1" awk 2>/dev/null readonly readonly ${HOME} "$1" 2>/dev/null
+	then readonly | then --verbose /usr/bin "$@" printf | -eu
+local -eu /usr/bin /usr/bin /usr/bin
+	--verbose && "$@" ${HOME} readonly | then cd export 2>/dev/null
+	readonly printf --verbose "$1" /usr/bin
+	local awk $(pwd) "$1" 2>/dev/null cd x=1 cd 'quoted text' cd printf
+	test echo 2>/dev/null && x=1 2>/dev/null test "$@"
+	cd $(pwd) -eu sed export echo sed grep then done 2>/dev/null --verbose
+		&& 2>/dev/null | printf $(pwd) readonly "$1" printf grep
+export echo 2>/dev/null cd 2>/dev/null echo ${HOME} then local --verbose
+echo echo cd printf && ${HOME} "$@" 2>/dev/null readonly -eu x=1 x=1 printf then
+"$1" local "$1" 'quoted text' "$1" sed then test --verbose
+		local echo readonly -eu "$1" then "$1" echo local --verbose -eu
+| then readonly sed --verbose &&
+${HOME} "$@" --verbose done then x=1 $(pwd) x=1 done printf printf readonly then
+test "$@" grep local test 2>/dev/null "$1" --verbose sed test test 2>/dev/null
+x=1 grep "$@" --verbose printf cd "$@" sed --verbose
+		readonly "$@" 2>/dev/null
+	printf 'quoted text' --verbose |
+export local export printf $(pwd) "$@" | "$1" grep "$1" then
+	'quoted text' x=1 test 2>/dev/null test /usr/bin
+echo --verbose sed $(pwd)
+	export --verbose | grep printf && done x=1 then sed printf -eu /usr/bin
+		then --verbose export $(pwd) && && "$1" grep "$@" x=1 ${HOME} | local && | then
+		cd | done && 'quoted text' awk | test export awk && "$@"
+done printf && test sed readonly
+${HOME} sed x=1 -eu local $(pwd) "$@" done ${HOME} -eu 'quoted text'
+test && 2>/dev/null awk awk
+		done /usr/bin 2>/dev/null done | "$@" /usr/bin sed 2>/dev/null local "$@" echo
+		export readonly 'quoted text' $(pwd) export then ${HOME}
+	"$1" readonly ${HOME} --verbose
+test local -eu then printf x=1 cd --verbose "$1" cd x=1 then
+		echo $(pwd) --verbose "$@" --verbose then 'quoted text' "$@" printf 'quoted text'
+${HOME} $(pwd) awk "$1" test test
+x=1 && && then x=1 x=1 local | grep 2>/dev/null "$1" local /usr/bin
+		-eu readonly echo && "$@" export &&
+	--verbose export 2>/dev/null sed 2>/dev/null $(pwd) && done
+	sed x=1 local sed readonly --verbose 'quoted text'
+'quoted text' sed ${HOME} readonly "$@"
+		echo echo echo "$1" export 2>/dev/null then then grep readonly
+/usr/bin grep | grep $(pwd) && $(pwd) -eu --verbose awk then 2>/dev/null cd
+&& export printf 'quoted text' awk printf | $(pwd) --verbose then test then local
+		$(pwd) /usr/bin local x=1 done ${HOME} grep x=1 --verbose cd export
+	sed export cd test | x=1 test export export /usr/bin $(pwd) grep done
+	done test printf printf "$@" done
+sed done sed -eu /usr/bin awk 'quoted text'
+		"$@" /usr/bin "$1" grep && "$@" export local printf test sed cd ${HOME} awk x=1
+		awk sed --verbose | -eu -eu
+	'quoted text' $(pwd) readonly /usr/bin --verbose && readonly
+	&& "$1" local "$@" "$@" readonly
+	2>/dev/null test 2>/dev/null
+	-eu 2>/dev/null "$1" local then then && -eu "$@"
+	echo $(pwd) test export |
+	export awk 2>/dev/null "$@" grep "$@" "$@" $(pwd) ${HOME}
+	awk echo /usr/bin 2>/dev/null "$1" done sed ${HOME}
+"$1" -eu -eu local --verbose "$@" "$@" 2>/dev/null /usr/bin
+&& local -eu ${HOME} /usr/bin -eu $(pwd) "$1" --verbose awk awk 'quoted text'
+		--verbose | export echo 2>/dev/null "$@" done
+test grep local grep echo done printf ${HOME}
+	test awk export "$1" "$@" 2>/dev/null local 2>/dev/null
+	--verbose readonly cd readonly echo then
+	printf export $(pwd) grep --verbose test readonly grep 2>/dev/null
+	grep echo 2>/dev/null cd local 2>/dev/null $(pwd) 2>/dev/null echo x=1
+	echo export $(pwd) sed "$@" ${HOME} local cd grep 2>/dev/null
+| 2>/dev/null /usr/bin echo $(pwd) then grep echo
+/usr/bin 2>/dev/null local 'quoted text' printf export ${HOME} | $(pwd)
+$(pwd) && printf $(pwd) done export $(pwd) /usr/bin && done --verbose
+		/usr/bin --verbose cd ${HOME} echo sed $(pwd) then x=1 --verbose awk grep grep
+		$(pwd) local $(pwd) --verbose | 2>/dev/null cd
+| grep echo readonly | test printf ${HOME} echo -eu echo awk
+		sed ${HOME} readonly export $(pwd) awk /usr/bin x=1 then 2>/dev/null
+	done readonly sed | "$1" 'quoted text' -eu /usr/bin
+		grep $(pwd) -eu && 'quoted text' local /usr/bin /usr/bin readonly $(pwd) export
+2>/dev/null /usr/bin $(pwd) "$@" local
+${HOME} $(pwd) "$1" cd printf ${HOME} cd "$1" sed $(pwd) && -eu && /usr/bin
+x=1 && test ${HOME} ${HOME} /usr/bin
+| printf test then local && grep echo && -eu echo $(pwd) readonly x=1 test readonly
+test ${HOME} sed $(pwd) ${HOME}
+		| export "$1" test cd "$@" | x=1 cd then echo awk x=1 'quoted text'
+then | 2>/dev/null -eu awk local then cd printf export grep done
+		2>/dev/null readonly -eu then echo
+		| 'quoted text' cd $(pwd) && local | $(pwd) cd export
+"$1" echo local 2>/dev/null cd readonly x=1 'quoted text' local 'quoted text'
+		$(pwd) "$@" test 'quoted text'
+	&& --verbose local printf done printf grep test -eu 2>/dev/null
+readonly /usr/bin cd local 'quoted text' awk awk /usr/bin readonly
+		then -eu $(pwd) 2>/dev/null ${HOME} test sed test export
+	test 'quoted text' 'quoted text' sed ${HOME} && /usr/bin
+readonly readonly "$@" --verbose $(pwd) /usr/bin grep --verbose echo
+		$(pwd) test export "$1" ${HOME} x=1
+'quoted text' 'quoted text' done local echo readonly awk
+		'quoted text' test done x=1 cd test awk x=1 echo local --verbose 2>/dev/null
+x=1 local $(pwd) -eu 'quoted text' $(pwd) test export && -eu awk && cd
+"$@" cd then done 2>/dev/null 2>/dev/null
+| local --verbose readonly | then && echo export -eu
+		"$1" sed cd 2>/dev/null --verbose -eu "$@" test sed test $(pwd)
+| && then test awk awk ${HOME} /usr/bin $(pwd) -eu x=1 test echo
+cd $(pwd) then sed && cd 2>/dev/null readonly 2>/dev/null awk echo ${HOME} --verbose
+		--verbose && then ${HOME} 2>/dev/null $(pwd) local
+$(pwd) echo local "$1" x=1 -eu done "$@" readonly sed grep export
+x=1 /usr/bin sed -eu sed cd $(pwd) "$1" --verbose sed local /usr/bin ${HOME}
+&& && awk 2>/dev/null $(pwd)
+grep done && then /usr/bin $(pwd) --verbose 'quoted text'
+		$(pwd) && "$1" 'quoted text' cd ${HOME}
+	sed export test grep grep awk -eu cd awk 2>/dev/null
+&& 'quoted text' x=1 x=1 $(pwd) readonly local x=1 then "$@" "$@"
+		2>/dev/null && --verbose done then ${HOME} readonly export $(pwd)
+awk done awk x=1 printf
+&& awk done cd /usr/bin test
+	sed readonly 2>/dev/null export test && 2>/dev/null -eu done "$1" grep 2>/dev/null
+x=1 awk && local printf "$1" readonly grep -eu awk local ${HOME} 'quoted text' cd
+		${HOME} /usr/bin done ${HOME}
+export then cd export done sed echo 2>/dev/null awk ${HOME} then 2>/dev/null
+	"$@" done && printf local ${HOME} printf ${HOME} "$1" "$@" | -eu "$@"
+		/usr/bin echo 'quoted text'
+cd | local cd 'quoted text'
+		sed echo "$1" 2>/dev/null printf readonly export ${HOME} readonly local
+	--verbose 'quoted text' 2>/dev/null cd
+		grep x=1 sed $(pwd) local "$1" "$1"
+#include c200.sh
+		cd "$1" | x=1 printf ${HOME} done printf then awk then done 2>/dev/null
+echo cd 'quoted text' "$@" | grep --verbose cd sed
+	test /usr/bin && grep cd
+	sed x=1 done test test 'quoted text' $(pwd) -eu
+grep readonly export "$@" $(pwd)
+	done then 2>/dev/null readonly awk
+		grep local | "$1" "$@" &&
+${HOME} readonly ${HOME} "$1" 2>/dev/null export awk | x=1 then 'quoted text'
+	$(pwd) grep grep 2>/dev/null /usr/bin --verbose
+	awk echo --verbose readonly $(pwd) $(pwd) grep echo && awk ${HOME} 'quoted text'
+/usr/bin x=1 test "$@" sed echo --verbose 2>/dev/null export 'quoted text' done
+	&& x=1 readonly echo then && /usr/bin --verbose ${HOME} $(pwd) readonly local
+"$@" echo 2>/dev/null
+		"$@" ${HOME} && cd awk 2>/dev/null --verbose export && && 'quoted text' /usr/bin
+	done 'quoted text' cd | $(pwd) | awk grep then
+		done "$1" ${HOME} cd ${HOME}
+		export $(pwd) sed sed |
+	-eu printf $(pwd) export readonly awk "$1" sed "$1" 'quoted text' "$@"
+		'quoted text' /usr/bin sed --verbose
+sed x=1 sed 2>/dev/null then local echo && cd && $(pwd) x=1 /usr/bin
+	done $(pwd) | $(pwd) --verbose
+	-eu echo export 'quoted text' printf
+		&& && /usr/bin | cd $(pwd) "$1" 2>/dev/null
+&& grep && then | cd
+	cd 2>/dev/null echo 'quoted text' test cd && 2>/dev/null | x=1 $(pwd) --verbose
+	awk $(pwd) printf then cd sed 2>/dev/null --verbose local | echo && readonly
+"$1" "$@" -eu local x=1 test local --verbose $(pwd) then done
+		--verbose --verbose readonly | --verbose grep then | awk local "$@" local --verbose
+x=1 printf x=1 /usr/bin $(pwd) 2>/dev/null $(pwd) local local && /usr/bin
+$(pwd) "$1" echo local test
+"$@" -eu then 2>/dev/null done && ${HOME} readonly echo 2>/dev/null then x=1
+	--verbose $(pwd) grep x=1 readonly grep sed -eu echo echo
+cd test "$1" readonly cd export 'quoted text' "$1" readonly
+		"$@" | readonly "$1" cd && awk $(pwd) && "$1" ${HOME} awk
+	$(pwd) "$1" --verbose "$@" awk printf 2>/dev/null
+readonly local | awk "$@" "$@" ${HOME} "$1"
+	/usr/bin then --verbose |
+		grep "$@" then x=1 'quoted text'
+	"$@" /usr/bin 'quoted text' "$@" "$1" export
+sed 'quoted text' /usr/bin | awk ${HOME} "$@" cd
+		readonly | 'quoted text' cd printf cd "$@" export && cd readonly export
+sed ${HOME} ${HOME} done
+	sed && then export sed "$1" then $(pwd)
+$(pwd) ${HOME} local $(pwd) ${HOME} x=1 export
+	export test then $(pwd) ${HOME} -eu "$@" grep "$@" -eu
+sed --verbose test x=1 --verbose 2>/dev/null && cd grep awk -eu
+	--verbose --verbose awk grep echo -eu x=1 printf printf done --verbose grep local
+"$1" readonly then test $(pwd) 'quoted text' | grep
+		"$1" "$1" then local printf && "$@" -eu readonly /usr/bin
+grep 'quoted text' awk done then sed --verbose awk ${HOME} cd
+'quoted text' export $(pwd) sed /usr/bin && ${HOME} 'quoted text'
+		echo export /usr/bin 'quoted text' then sed printf test export
+	done ${HOME} "$@" awk "$1" export ${HOME}
+		"$@" -eu printf cd 2>/dev/null "$1" then sed readonly then printf then
+	&& grep done && "$1" echo -eu /usr/bin printf && done awk
+"$@" $(pwd) export && "$@" &&
+	test readonly echo readonly
+	grep 'quoted text' sed echo done 2>/dev/null
+		cd && 2>/dev/null done awk $(pwd) /usr/bin ${HOME} "$@" then awk | readonly
+export | --verbose test test 'quoted text' --verbose
+		&& $(pwd) $(pwd) sed -eu 2>/dev/null "$1" --verbose echo $(pwd) local
+then | sed x=1 2>/dev/null 2>/dev/null readonly export -eu $(pwd)
+2>/dev/null x=1 done /usr/bin
+printf "$1" grep /usr/bin
+$(pwd) && && -eu done -eu $(pwd) cd | x=1 export 2>/dev/null
+x=1 readonly awk echo then echo 2>/dev/null ${HOME} "$@"
+		done 'quoted text' | cd "$@" x=1 "$1" then && grep
+readonly awk --verbose done then awk -eu test export "$1" printf x=1 --verbose
+		&& && -eu sed printf
+	/usr/bin 'quoted text' 'quoted text' $(pwd) /usr/bin | printf --verbose
+	sed --verbose done | printf &&
+		grep export export test then readonly awk 'quoted text'
+cd ${HOME} -eu then ${HOME}
+	test "$1" readonly /usr/bin printf "$@" --verbose readonly
+		x=1 ${HOME} echo grep -eu awk readonly readonly grep sed sed then
+-eu ${HOME} --verbose readonly sed export sed -eu
+	export cd $(pwd) -eu "$1"
+		2>/dev/null done export cd test grep grep sed ${HOME} sed 'quoted text' local
+local --verbose grep "$1" | x=1 cd then then done
+printf echo x=1 2>/dev/null awk echo
+'quoted text' local | test x=1 --verbose awk export awk echo grep
+	export printf local sed "$1" printf echo grep echo cd
+	&& done $(pwd) done --verbose "$1" 'quoted text' cd 2>/dev/null |
+		$(pwd) && awk x=1 'quoted text' test then --verbose ${HOME}
+	done export echo 'quoted text' ${HOME} "$@" done "$@" cd test cd "$1" -eu | "$1"
+	"$@" && 2>/dev/null --verbose grep | echo "$@" /usr/bin
+	test grep test ${HOME} local echo --verbose x=1 'quoted text' && echo "$1"
+	then sed readonly export "$@" "$@" awk readonly
+		cd then 2>/dev/null printf then then
+x=1 $(pwd) 'quoted text' printf export | cd && test -eu export
+	--verbose 'quoted text' echo
+-eu ${HOME} awk then "$@" 'quoted text' awk 2>/dev/null
+	${HOME} "$@" x=1 -eu -eu done "$1" awk sed "$1" "$@" awk x=1 x=1 echo awk x=1
+cd printf /usr/bin && sed local "$@" $(pwd) 'quoted text' ${HOME} -eu test ${HOME}
+-eu local local export $(pwd) | done "$1" "$@" awk done -eu test grep "$1"
+		'quoted text' awk export cd 'quoted text' --verbose
+	-eu awk then test test $(pwd) $(pwd) --verbose cd | 2>/dev/null
+	"$@" 'quoted text' cd "$1" readonly test printf cd awk /usr/bin
+		$(pwd) printf && grep --verbose export -eu $(pwd) export awk test
+printf -eu x=1 && done $(pwd)
+	export /usr/bin export done awk local "$1" "$@" readonly export test x=1 "$1" awk
+/usr/bin | /usr/bin "$1" test -eu then -eu --verbose /usr/bin "$1" ${HOME} x=1
+		x=1 "$@" ${HOME} printf
+		"$@" && readonly $(pwd) test test 'quoted text'
+		--verbose printf readonly readonly local x=1 'quoted text' readonly then export
+		local 2>/dev/null x=1 readonly awk local export ${HOME} cd done done readonly printf
+	readonly cd echo awk then 'quoted text' -eu && done -eu test --verbose
+	test 2>/dev/null printf readonly echo readonly sed done grep --verbose readonly
+	local export "$@" export ${HOME} ${HOME} | then -eu awk $(pwd) "$1"
+		&& -eu "$@" ${HOME} grep -eu grep "$@" local readonly -eu grep
+test cd test done test readonly 2>/dev/null $(pwd) /usr/bin
+done then x=1 'quoted text' local
+		printf "$@" "$@" grep -eu | | grep -eu readonly readonly
+		${HOME} done readonly done echo awk 'quoted text' awk cd readonly -eu
+"$1" local grep cd | done sed echo
+	| --verbose sed | export "$@" cd printf cd awk cd ${HOME} $(pwd)
+"$@" $(pwd) then echo && grep
+		grep && test done sed then ${HOME} "$1" test 'quoted text'
+	sed sed $(pwd) cd echo grep "$1" $(pwd) readonly sed export
+	done export 2>/dev/null $(pwd) readonly | grep $(pwd) --verbose -eu && test | then
+	grep --verbose $(pwd) $(pwd)
+		| readonly then local --verbose readonly awk local
+'quoted text' done grep ${HOME} && -eu readonly && $(pwd) /usr/bin test
+	local export | test "$@" $(pwd)
+	cd "$1" readonly export 'quoted text' /usr/bin
+	readonly | x=1 2>/dev/null then
+	"$@" done --verbose then --verbose awk $(pwd)
+		grep awk $(pwd) echo -eu "$1" grep awk then test echo | test done
+		readonly 2>/dev/null local x=1 "$1" -eu 'quoted text' "$1"
+		done then "$1" grep ${HOME}
+	readonly echo | then local grep readonly
+		x=1 local echo grep $(pwd) --verbose
+export 'quoted text' /usr/bin done ${HOME} "$@" x=1 echo test then echo ${HOME}
+		sed done $(pwd) -eu cd && sed |
+sed --verbose "$@" awk x=1 cd printf local "$@" /usr/bin 'quoted text' awk
+then readonly test printf x=1 'quoted text' cd ${HOME} &&
+		readonly then ${HOME} then
+		/usr/bin printf $(pwd) x=1 ${HOME} echo "$@" echo export "$1" grep 'quoted text'
+		$(pwd) ${HOME} echo export && export then $(pwd) grep 'quoted text'
+| test "$@" -eu --verbose
+sed export "$1" local 2>/dev/null
+	then grep /usr/bin export $(pwd) test export
+		"$@" export /usr/bin | --verbose printf 2>/dev/null
+export ${HOME} ${HOME} then 'quoted text' $(pwd) 'quoted text'
+echo -eu test grep echo "$@" printf 2>/dev/null | "$@" /usr/bin
+local printf local -eu $(pwd) x=1 then grep readonly
+cd grep $(pwd) && 2>/dev/null echo && export done --verbose local test x=1
+	-eu ${HOME} awk ${HOME} export
+	grep /usr/bin echo readonly readonly echo export
+	--verbose then ${HOME} cd echo -eu echo "$@" --verbose awk 'quoted text' awk $(pwd)
+	-eu 2>/dev/null sed awk then test
+		cd cd echo "$1" && /usr/bin then echo $(pwd) "$1" sed x=1 x=1 "$1" && then echo
+		2>/dev/null done --verbose --verbose readonly
+x=1 "$1" local "$1" 'quoted text' printf local printf
+	export then | $(pwd) local grep done 2>/dev/null awk 'quoted text' --verbose
+		done "$@" -eu grep export "$@" "$@" 'quoted text' local |
+&& done $(pwd) done export echo $(pwd) x=1 awk
+-eu "$@" readonly 'quoted text' && done test echo x=1 readonly x=1 test
+		done /usr/bin --verbose cd 2>/dev/null done awk local export
+	&& "$1" test "$1" then /usr/bin awk && "$@" cd "$1" 2>/dev/null awk export
+then 2>/dev/null | 'quoted text' /usr/bin test cd
+sed $(pwd) local printf grep test done x=1 test printf grep --verbose 2>/dev/null
+		then cd readonly test 'quoted text' export local ${HOME} ${HOME} awk /usr/bin
+	x=1 readonly sed "$@" then /usr/bin sed printf | && readonly "$@" && printf
+	awk /usr/bin cd | "$1" 2>/dev/null 2>/dev/null cd 'quoted text'
+	test "$@" then echo ${HOME} && $(pwd) | grep -eu $(pwd) done
+echo x=1 grep && "$@" test "$@" 2>/dev/null 2>/dev/null
+		${HOME} local echo test ${HOME} printf
+	&& | awk cd && echo --verbose
+x=1 "$1" -eu 2>/dev/null readonly grep "$@" |
+	cd test -eu done readonly
+		${HOME} && 2>/dev/null 2>/dev/null
+"$@" "$1" x=1 | 'quoted text' -eu awk ${HOME}
+local 2>/dev/null test ${HOME} export ${HOME} -eu -eu x=1 | printf sed
+	cd | "$@" echo /usr/bin /usr/bin
+	awk echo x=1 $(pwd) then --verbose cd awk then awk then -eu export
+	sed /usr/bin printf cd |
+	-eu awk sed then printf readonly readonly 2>/dev/null export $(pwd)
+		then 2>/dev/null /usr/bin echo "$1" readonly test "$1" $(pwd) awk $(pwd) local
+	readonly printf readonly | "$1" --verbose cd --verbose --verbose export
+| 'quoted text' --verbose
+	readonly | -eu | | export /usr/bin awk printf then -eu grep readonly export export
+		done && $(pwd) test 2>/dev/null cd -eu $(pwd) echo ${HOME} test /usr/bin
+	sed printf && --verbose awk 'quoted text'
+		test "$@" echo sed --verbose printf "$@" -eu test && then "$1" | "$@" --verbose
+		"$@" 2>/dev/null /usr/bin printf -eu cd printf local sed --verbose
+	done /usr/bin $(pwd) done | then --verbose x=1 $(pwd) grep
+		--verbose --verbose 2>/dev/null
+/usr/bin echo then "$@" local awk then test --verbose grep readonly
+	'quoted text' ${HOME} done then "$@"
+-eu done ${HOME} done readonly test awk | printf 2>/dev/null
+	&& "$@" test export echo printf -eu echo --verbose "$@" | x=1
+		/usr/bin sed done readonly export awk grep /usr/bin /usr/bin awk "$@" "$1" sed
+export /usr/bin 2>/dev/null printf
+		-eu && -eu ${HOME} 'quoted text' 'quoted text' test
+	/usr/bin 'quoted text' -eu done x=1 $(pwd) ${HOME} x=1
+printf export echo "$@" cd export then printf ${HOME} $(pwd) x=1 /usr/bin local
+		"$1" cd $(pwd) then done | ${HOME} done "$@" --verbose --verbose ${HOME}
+		&& | && x=1 printf "$@" local
+--verbose then cd export
+awk 2>/dev/null x=1 cd done "$1" local "$1" "$1" "$1" test
+	done readonly 'quoted text' && export --verbose $(pwd) | done
+	awk x=1 cd readonly $(pwd) $(pwd) && then local | | && readonly
+		$(pwd) /usr/bin "$1" --verbose
+	$(pwd) "$1" && awk cd "$1"
+-eu echo 2>/dev/null 'quoted text' x=1 export awk
+	2>/dev/null "$1" -eu export | printf
+		then "$1" local local local | test cd "$@" ${HOME} /usr/bin grep export local
+	readonly $(pwd) 'quoted text' 2>/dev/null done 'quoted text' then printf ${HOME}
+		then x=1 then done done "$@" awk readonly printf printf sed &&
+	grep x=1 cd x=1 readonly $(pwd) then readonly /usr/bin done readonly
+&& export "$@" test "$1" done local $(pwd)
+		done export "$1" 'quoted text' && awk local --verbose
+		$(pwd) /usr/bin done sed x=1 grep /usr/bin
+		$(pwd) awk x=1 2>/dev/null 'quoted text' /usr/bin
+	readonly sed "$1" done "$1" printf readonly
+printf "$1" "$1" test "$1" then $(pwd) local 2>/dev/null sed local "$1" done
+	sed 2>/dev/null cd awk "$1" cd 2>/dev/null
+	| local && printf /usr/bin
+&& --verbose "$@" sed
+printf | x=1 cd local grep && "$@"
+		-eu | ${HOME} 'quoted text'
+2>/dev/null 2>/dev/null "$@" 'quoted text' local grep
+		echo "$@" && test then sed | readonly --verbose then done
+	printf grep local cd local test then && done local printf
+/usr/bin x=1 $(pwd) -eu /usr/bin
+	done 2>/dev/null --verbose
+	| --verbose 'quoted text' "$1" "$1" then sed local /usr/bin
+--verbose && && 'quoted text' done --verbose cd readonly
+	${HOME} 'quoted text' readonly
+		cd x=1 ${HOME} echo $(pwd) "$@" $(pwd) then ${HOME} x=1
+		-eu /usr/bin $(pwd) done sed | --verbose printf export then -eu ${HOME} cd
+	$(pwd) test grep printf 2>/dev/null
+		sed 2>/dev/null readonly $(pwd) echo 'quoted text' --verbose --verbose
+readonly 'quoted text' $(pwd) 'quoted text' /usr/bin
+/usr/bin readonly ${HOME} grep --verbose cd
+		cd cd sed done grep "$1" cd 'quoted text' readonly
+${HOME} done ${HOME} /usr/bin
+	"$@" /usr/bin && cd x=1 x=1 local
+		| test printf -eu grep ${HOME} "$@" readonly $(pwd) readonly $(pwd) awk | $(pwd)
+		awk --verbose done --verbose export
+	-eu export ${HOME} printf echo | $(pwd) printf done &&
+grep 2>/dev/null echo ${HOME} x=1
+awk local --verbose ${HOME} cd awk
+		grep 2>/dev/null sed 'quoted text'
+	| /usr/bin "$@" && --verbose local ${HOME} 'quoted text' x=1
+	${HOME} readonly then sed printf
+sed -eu grep local "$1" export x=1 ${HOME} then -eu "$1" then
+grep && awk 'quoted text' export
+		then /usr/bin cd then ${HOME} $(pwd) 2>/dev/null -eu
+		sed --verbose cd done printf export
+		readonly | "$1" "$@" "$@" echo /usr/bin cd $(pwd) sed awk 'quoted text'
+readonly x=1 echo /usr/bin ${HOME}
+$(pwd) printf && && "$@" "$@"
+		done x=1 then echo -eu | x=1 then local
+printf --verbose "$1"
+"$1" cd x=1 "$1" 2>/dev/null printf 2>/dev/null cd cd local
+	printf x=1 | cd x=1 x=1 --verbose done done export 2>/dev/null done
+		&& done $(pwd) readonly sed awk echo $(pwd) ${HOME} awk export x=1 "$@" |
+	2>/dev/null done 2>/dev/null 2>/dev/null
+	grep echo /usr/bin "$@"
+	"$@" x=1 sed test 'quoted text' readonly 'quoted text'
+	$(pwd) 'quoted text' "$1" grep --verbose x=1 sed export printf
+	export $(pwd) echo echo -eu done readonly x=1 x=1 then printf printf --verbose
+		'quoted text' printf readonly printf grep --verbose /usr/bin awk then
+export /usr/bin then | /usr/bin
+	local x=1 test readonly export cd done then 2>/dev/null
+cd 'quoted text' export -eu "$1" export done readonly cd awk
+&& /usr/bin echo && 'quoted text' /usr/bin ${HOME} test local
+	export then then grep readonly
+	--verbose "$@" ${HOME} echo printf sed && ${HOME}
+readonly && export export $(pwd) /usr/bin
+	--verbose then grep -eu echo "$@" --verbose /usr/bin echo
+done cd 2>/dev/null ${HOME} $(pwd) 'quoted text'
+done cd done cd done awk -eu sed printf "$@" 'quoted text' export then &&
+| && done awk 2>/dev/null ${HOME}
+		&& export 2>/dev/null -eu /usr/bin cd test sed test then $(pwd) ${HOME}
+"$@" x=1 'quoted text' "$@" cd 'quoted text' export test "$1" readonly
+		echo x=1 readonly sed test --verbose then --verbose "$@"
+grep grep local then printf test 'quoted text' echo --verbose "$1" x=1
+	grep 2>/dev/null awk ${HOME} "$@" "$1" sed
+-eu then printf local export --verbose /usr/bin cd --verbose test printf &&
+$(pwd) && export 'quoted text' $(pwd) | sed done
+	$(pwd) && grep sed /usr/bin --verbose --verbose && "$@" -eu $(pwd) grep
+x=1 printf test cd | export test /usr/bin done "$1" cd awk export
+		"$1" printf cd "$1" && | $(pwd) --verbose $(pwd) local x=1 local
+export 2>/dev/null -eu 'quoted text' "$1" -eu 'quoted text' && test
+		test printf 2>/dev/null "$@" readonly -eu /usr/bin local printf "$1" test
+		| local 'quoted text' readonly awk then readonly
+	readonly readonly -eu local "$@" 2>/dev/null
+$(pwd) then done sed 'quoted text' $(pwd) grep "$@" export /usr/bin printf test
+		2>/dev/null -eu 2>/dev/null --verbose $(pwd) --verbose readonly awk
+	&& | then done ${HOME} cd export 2>/dev/null
+		2>/dev/null then $(pwd)
+cd done && && export x=1 --verbose test printf ${HOME}
+x=1 && echo grep | ${HOME} cd local --verbose -eu printf 2>/dev/null
+	done ${HOME} 'quoted text' then ${HOME} cd sed
+/usr/bin sed done ${HOME}
+		cd grep x=1 awk sed /usr/bin && local && && export x=1
+	&& printf "$1" --verbose 2>/dev/null /usr/bin && grep printf sed $(pwd) test
+		echo "$@" && test printf "$1" awk test 'quoted text' && ${HOME} awk -eu x=1
+		export "$@" x=1 "$@" sed export then local ${HOME} local test echo 'quoted text'
+	"$1" readonly cd --verbose
+		"$@" test printf printf -eu x=1 -eu grep local 2>/dev/null echo local grep done
+readonly /usr/bin done 'quoted text' readonly $(pwd) cd echo awk test readonly
+		cd export echo readonly x=1 -eu readonly
+	x=1 printf $(pwd) ${HOME} test x=1 && --verbose
+'quoted text' cd "$1" /usr/bin 2>/dev/null cd printf then 2>/dev/null
+test readonly test -eu ${HOME} -eu awk local "$@" export x=1 x=1 x=1 echo
+		-eu grep && | "$1" done printf $(pwd) export && awk printf
+/usr/bin test printf sed printf "$1" export /usr/bin then
+export test ${HOME} local done $(pwd) -eu done awk cd then && cd grep
+		export export done done
+grep 2>/dev/null /usr/bin --verbose cd echo "$@" | /usr/bin awk $(pwd)
+'quoted text' then cd 'quoted text' /usr/bin export -eu x=1 then && ${HOME} awk
+	readonly | cd sed 'quoted text' test $(pwd) &&
+	then | done && $(pwd) then printf $(pwd)
+	/usr/bin "$1" | done ${HOME} && && sed 'quoted text' readonly
+	"$@" test "$1" readonly 2>/dev/null --verbose $(pwd) /usr/bin /usr/bin
+		/usr/bin then 'quoted text' awk
+		-eu x=1 readonly && --verbose 2>/dev/null done printf | ${HOME}
+then -eu --verbose 2>/dev/null && -eu awk 2>/dev/null
+		${HOME} /usr/bin awk local grep 'quoted text' local grep
+	printf cd && --verbose "$@" "$1" | cd local
+	$(pwd) x=1 cd awk $(pwd) cd awk readonly ${HOME}
+		${HOME} echo grep cd readonly | done local cd $(pwd) 'quoted text' readonly
+	"$1" readonly "$@" then
+	2>/dev/null | cd echo done
+	test "$1" 2>/dev/null "$@" readonly
+	cd && awk echo 2>/dev/null printf && x=1 export
+		2>/dev/null done readonly && ${HOME} local readonly -eu
+		x=1 ${HOME} $(pwd) export
+| readonly echo "$@" /usr/bin
+2>/dev/null $(pwd) x=1 awk | &&
+printf done && 'quoted text' then
+		test "$1" then printf --verbose $(pwd) cd x=1 sed grep printf
+		test grep x=1 $(pwd) ${HOME} printf "$1" ${HOME}
+$(pwd) printf done x=1 /usr/bin && "$@" ${HOME} then then local
+local 'quoted text' 2>/dev/null x=1 ${HOME} test "$@" /usr/bin sed then -eu
+-eu && awk "$@" local $(pwd) 'quoted text'
+	printf "$@" && then "$1" awk awk && | ${HOME} echo grep /usr/bin 2>/dev/null test
+	awk x=1 test local sed done "$1" then then export "$1" local
+/usr/bin export "$@" --verbose echo done && done done grep then --verbose
+echo then x=1 && -eu x=1 awk grep cd test 2>/dev/null awk
+	"$1" cd /usr/bin "$1" /usr/bin printf cd 'quoted text' && ${HOME} $(pwd)
+'quoted text' printf /usr/bin done -eu 'quoted text' "$@" awk cd /usr/bin
+	&& "$@" export && cd then --verbose test "$@" readonly
+echo | done then && 2>/dev/null /usr/bin test then grep awk | -eu && grep
+	x=1 test export cd printf printf x=1 cd awk export ${HOME} "$1" local 2>/dev/null
+"$@" local 'quoted text' printf --verbose test then -eu
+sed test x=1 --verbose cd readonly ${HOME} echo then 'quoted text'
+		printf "$@" ${HOME} test $(pwd) test
+"$1" awk echo x=1 export cd
+	$(pwd) export "$@" ${HOME} $(pwd)
+	test cd grep -eu ${HOME} ${HOME} "$@" && -eu $(pwd) $(pwd) grep x=1 && --verbose
+	local then cd local "$@" test | grep echo test "$1"
+	test 2>/dev/null done -eu --verbose echo export done
+	&& ${HOME} "$@" readonly grep awk | local 'quoted text' -eu sed then
+	2>/dev/null test "$@" --verbose "$1" export
+sed ${HOME} readonly sed "$1" "$@" ${HOME} echo sed awk "$@" x=1 -eu ${HOME} cd
+sed x=1 ${HOME} "$1" | local
+	${HOME} | x=1 -eu 2>/dev/null printf export x=1 2>/dev/null /usr/bin grep
+		test 2>/dev/null awk "$@" test
+2>/dev/null $(pwd) x=1 echo 2>/dev/null $(pwd) done sed
+&& awk ${HOME} export && cd | readonly /usr/bin cd
+done export 'quoted text' -eu local
+	awk ${HOME} grep printf | $(pwd) awk 2>/dev/null $(pwd) grep "$@"
+		/usr/bin grep 'quoted text' export local test grep printf cd | 2>/dev/null
+		${HOME} && done --verbose echo echo 2>/dev/null ${HOME} ${HOME} /usr/bin
+	-eu /usr/bin cd -eu then printf
+	"$1" echo "$1" printf --verbose && 'quoted text'
+then 'quoted text' "$1" && $(pwd) 2>/dev/null
+grep -eu | printf 2>/dev/null && sed
+		-eu cd && local echo "$@" x=1 echo export
+grep 2>/dev/null cd printf awk 'quoted text'
+		echo sed && grep && | sed grep -eu cd done test grep test -eu x=1
+	"$@" echo /usr/bin awk 'quoted text'
+		--verbose readonly $(pwd) grep x=1 local grep x=1 then 2>/dev/null awk
+	then | 'quoted text' -eu export "$@" echo echo 2>/dev/null
+		sed local $(pwd) printf -eu then echo 2>/dev/null done
+		--verbose readonly x=1 $(pwd) printf export && grep | | test
+	2>/dev/null grep echo x=1 /usr/bin awk sed 2>/dev/null $(pwd) ${HOME} echo x=1
+x=1 readonly cd local echo
+grep | awk | test test --verbose cd awk
+	printf "$@" done $(pwd) ${HOME} export grep --verbose then echo
+	grep /usr/bin local echo readonly export readonly local export cd
+grep ${HOME} then "$1" then test "$@" cd printf
+		"$@" $(pwd) local sed done 2>/dev/null 2>/dev/null then "$1" | $(pwd) done
+		readonly export cd x=1
+	$(pwd) echo --verbose | /usr/bin 'quoted text' cd awk
+	sed | --verbose x=1 done cd "$1" test ${HOME} printf then "$1" awk "$@"
+		/usr/bin /usr/bin echo && sed && | | done printf readonly --verbose
+	readonly -eu grep "$@" -eu awk -eu 2>/dev/null
+		export grep x=1 done "$1" echo printf cd $(pwd) $(pwd) | cd 'quoted text' $(pwd)
+x=1 then awk then printf
+		echo done "$@" x=1 $(pwd) x=1 export && $(pwd) local awk
+	/usr/bin "$1" cd "$1" -eu
+then readonly 2>/dev/null export export "$@"
+	grep x=1 printf $(pwd) ${HOME} grep sed then echo ${HOME} $(pwd)
+	2>/dev/null | readonly 2>/dev/null
+"$1" --verbose ${HOME} "$@" local "$@" "$@" ${HOME} 2>/dev/null
+| sed -eu readonly cd "$1" printf export "$@" -eu readonly
+test | ${HOME} -eu echo grep echo 2>/dev/null | 'quoted text' x=1 then ${HOME}
+cd --verbose local sed export
+export done grep sed && | ${HOME} "$@" readonly --verbose -eu "$@" &&
+$(pwd) readonly 'quoted text' ${HOME} -eu export grep
+&& /usr/bin printf ${HOME} /usr/bin -eu -eu export | --verbose done
+	&& printf printf cd -eu && && done cd ${HOME} grep 2>/dev/null
+test --verbose ${HOME} local printf "$@" 2>/dev/null 2>/dev/null test x=1 done
+${HOME} $(pwd) test echo sed /usr/bin ${HOME} 'quoted text' cd && x=1
+then local then readonly local $(pwd) /usr/bin echo 'quoted text'
+awk printf test export ${HOME} "$1" sed /usr/bin grep sed then x=1 /usr/bin
+	cd printf readonly readonly readonly --verbose
+		then "$1" -eu -eu 'quoted text' sed | readonly | then readonly
+		test "$1" sed echo done then | printf
+echo then 2>/dev/null awk -eu test $(pwd) 2>/dev/null
+	'quoted text' && readonly && export "$1"
+		grep readonly 'quoted text'
+'quoted text' && then --verbose /usr/bin 2>/dev/null grep | 'quoted text' echo
+		awk export 2>/dev/null "$@" sed "$@" local local
+	local cd /usr/bin cd test /usr/bin
+	x=1 printf $(pwd) export $(pwd) cd ${HOME} $(pwd) echo 'quoted text'
+&& /usr/bin 2>/dev/null
+	cd && -eu $(pwd) 'quoted text' printf test cd -eu | 2>/dev/null
+	"$@" printf "$@" local && export sed "$1" --verbose $(pwd)
+${HOME} test sed "$1"
+		printf 'quoted text' then sed then echo then $(pwd) 2>/dev/null $(pwd) ${HOME}
+| x=1 $(pwd) local export export awk x=1 'quoted text'
+		awk "$@" $(pwd) sed grep done grep then export
+		--verbose ${HOME} printf
+		test readonly export echo "$1" 'quoted text' 2>/dev/null awk cd && && x=1
+x=1 "$1" --verbose then ${HOME}
+	readonly printf | && "$1" $(pwd)
+	local echo sed then -eu $(pwd) grep
+		echo awk --verbose awk readonly 'quoted text'
+		readonly x=1 test 'quoted text' --verbose --verbose $(pwd) ${HOME} "$1" readonly
+	grep /usr/bin | cd then /usr/bin export -eu -eu 'quoted text'
+sed grep x=1 2>/dev/null echo printf |
+		${HOME} test 'quoted text' readonly ${HOME}
+		2>/dev/null local cd echo readonly cd "$1"
+${HOME} -eu test test sed | x=1 then readonly "$1" 2>/dev/null
+	local grep then awk 'quoted text'
+local readonly done done local
+/usr/bin && /usr/bin "$@" && /usr/bin
+		echo --verbose test -eu cd done 2>/dev/null printf /usr/bin "$1" $(pwd)
+	2>/dev/null $(pwd) "$1" done
+	grep ${HOME} echo cd printf grep printf export ${HOME} "$1" export ${HOME} &&
+cd ${HOME} echo --verbose && grep | then readonly local
+$(pwd) /usr/bin -eu export | readonly
+		"$@" 2>/dev/null "$1" cd 'quoted text'
+	awk "$@" cd && cd 2>/dev/null $(pwd) && local "$1" $(pwd) grep test
+	-eu --verbose | "$@" sed "$1" | 'quoted text' --verbose
+		&& | x=1 "$1" | sed 'quoted text' echo -eu 'quoted text'
+		| then printf echo export printf 'quoted text' "$@" 2>/dev/null sed
+x=1 readonly "$1" export && /usr/bin test ${HOME}
+		-eu /usr/bin then /usr/bin /usr/bin grep grep
+	export 'quoted text' local "$1" then echo grep test -eu printf -eu ${HOME}
+	sed test -eu && test && 2>/dev/null cd export "$1" "$1" 2>/dev/null
+		"$@" done done grep ${HOME} ${HOME} grep awk then grep
+		then export /usr/bin printf readonly "$1" ${HOME} export x=1 awk grep $(pwd) $(pwd)
+x=1 done ${HOME} done 2>/dev/null grep $(pwd) echo "$@" test 2>/dev/null
+	--verbose sed local awk export
+		x=1 readonly 2>/dev/null readonly cd "$@" readonly x=1 x=1 --verbose cd awk printf
+		'quoted text' --verbose done /usr/bin printf grep
+	awk 'quoted text' | local 2>/dev/null
+local $(pwd) -eu $(pwd) /usr/bin sed 2>/dev/null
+	-eu then --verbose && sed && 'quoted text'
+'quoted text' test -eu
+readonly local done export | 'quoted text' x=1 readonly 'quoted text'
+		local export then readonly
+2>/dev/null readonly "$1" $(pwd) -eu
+		printf ${HOME} grep export local export
+echo x=1 cd "$1" sed
+	'quoted text' local | cd awk $(pwd) readonly $(pwd) x=1 2>/dev/null test "$1"
+	done sed "$@" sed -eu ${HOME} cd 'quoted text' test then awk && cd
+	-eu ${HOME} awk "$@" x=1 x=1 "$@" ${HOME} 'quoted text'
+'quoted text' test test && "$1" export ${HOME} &&
+	printf grep done /usr/bin && done sed grep | export export 'quoted text'
+		printf "$1" $(pwd) local awk local $(pwd)
+		-eu -eu export test /usr/bin done
+test | echo sed readonly /usr/bin
+		grep -eu printf done cd ${HOME} readonly
+printf 2>/dev/null done cd done done
+		echo sed echo sed cd 'quoted text' && 2>/dev/null
+printf "$@" /usr/bin test test readonly export /usr/bin
+	| echo && test | readonly local x=1 /usr/bin then echo local
+cd echo $(pwd) cd local "$1"
+		'quoted text' cd | 2>/dev/null awk "$1" 'quoted text' test
+test "$@" -eu ${HOME} local local /usr/bin /usr/bin
+x=1 -eu echo "$@" sed -eu
+"$1" -eu "$1" sed ${HOME} | printf 2>/dev/null
+&& "$1" grep "$@" /usr/bin echo 'quoted text' cd --verbose
+cd $(pwd) | echo printf x=1 "$@" --verbose awk cd readonly grep awk 'quoted text'
+2>/dev/null readonly readonly cd && "$@" "$@" sed x=1
+		2>/dev/null export readonly && local export readonly -eu -eu grep 'quoted text'
+	"$@" readonly --verbose | done x=1 local done $(pwd)
+	"$@" echo then grep sed "$@" cd awk grep -eu -eu echo |
+	sed test x=1 export test 2>/dev/null "$@" cd $(pwd) | 'quoted text' local
+$(pwd) /usr/bin 2>/dev/null -eu then --verbose then --verbose --verbose local
+		&& /usr/bin --verbose done && done grep readonly
+		-eu ${HOME} 'quoted text' ${HOME} awk -eu awk 'quoted text'
+	done local "$@" echo && cd sed readonly
+	printf printf cd | awk
+		then -eu test "$1" x=1 sed cd -eu export done readonly "$@" export && x=1 "$@"
+-eu -eu 2>/dev/null "$@" x=1 x=1 x=1
+		readonly sed x=1 | grep 'quoted text' awk sed 2>/dev/null echo then && printf
+	done awk ${HOME} cd "$1"
+local readonly "$@" $(pwd) 'quoted text' grep | && printf
+done "$@" then 2>/dev/null local readonly test readonly /usr/bin
+$(pwd) | local -eu cd -eu echo export $(pwd) ${HOME} printf --verbose
+		awk test "$1" done export "$@" 'quoted text' then x=1 'quoted text' local awk
+		--verbose local x=1 awk test cd --verbose
+local && grep grep awk test local | printf sed "$1" -eu | local ${HOME}
+	test 'quoted text' "$@" done
+		$(pwd) -eu "$@" then printf x=1 | sed $(pwd) then printf -eu cd awk then readonly
+$(pwd) "$@" && local /usr/bin done 'quoted text' done sed cd then
+	done cd echo printf x=1 && readonly readonly awk ${HOME} -eu
+		awk $(pwd) x=1 sed --verbose
+&& | ${HOME} /usr/bin "$1" 'quoted text'
+awk | && local && 'quoted text' x=1 ${HOME} cd 'quoted text'
+	2>/dev/null /usr/bin export x=1 grep $(pwd) then "$@" --verbose
+		local cd "$@" awk echo 2>/dev/null --verbose x=1 /usr/bin
+2>/dev/null readonly test 2>/dev/null
+"$1" x=1 done test cd printf 2>/dev/null
+test export then printf x=1 x=1 done | export -eu
+	printf local && | "$1" --verbose
+then -eu "$@" cd then readonly
+	| test then printf -eu test
+cd 2>/dev/null /usr/bin x=1 x=1 printf $(pwd) then then x=1 && grep
+	2>/dev/null readonly then export x=1 x=1 awk sed | --verbose printf
+		awk export x=1 && local sed ${HOME} printf grep -eu done x=1 awk
+		readonly | local readonly
+	x=1 'quoted text' --verbose | sed 'quoted text' && grep
+		local 'quoted text' then local then printf
+		then sed then $(pwd) && done "$@" 2>/dev/null export --verbose
+		readonly test done done
+test cd | grep "$@" "$@" ${HOME} cd awk readonly sed local test x=1
+	printf x=1 readonly local grep x=1 test /usr/bin /usr/bin done
+	cd $(pwd) | awk 'quoted text' | readonly cd /usr/bin echo printf && export x=1
+	done sed cd && local grep
+	echo && cd sed 2>/dev/null local printf
+		x=1 then printf "$1" --verbose --verbose 2>/dev/null printf
+		local ${HOME} local done && readonly sed ${HOME} cd /usr/bin
+| 'quoted text' test sed "$@" 2>/dev/null "$1" local && local then
+		readonly ${HOME} x=1 awk echo && | "$@" | /usr/bin /usr/bin
+	$(pwd) local x=1 "$1" --verbose x=1 && --verbose "$1" ${HOME}
+	-eu readonly local --verbose then "$1" export export "$@" | test ${HOME}
+	$(pwd) --verbose awk && x=1 2>/dev/null local && --verbose
+		${HOME} --verbose then && then local
+	--verbose grep cd done sed done sed | export --verbose $(pwd)
+	'quoted text' done $(pwd) "$@" sed 2>/dev/null
+		"$1" done $(pwd) 2>/dev/null 'quoted text'
+	/usr/bin | 'quoted text' && local
+/usr/bin "$1" /usr/bin done printf ${HOME} printf test
+		"$1" 2>/dev/null echo ${HOME} test
+		| | printf echo ${HOME} test ${HOME} /usr/bin
+		grep | cd x=1 test | "$1" x=1 "$1" printf test -eu echo x=1 "$@" echo
+--verbose | "$@" && awk -eu
+		printf readonly done done awk awk then printf export echo sed then
+	${HOME} 2>/dev/null "$@" grep then export echo test
+local grep cd export export echo
+	2>/dev/null && readonly export | cd
+		printf 2>/dev/null printf "$@" local && echo ${HOME} 'quoted text' readonly awk
+cd --verbose | export then then
+		2>/dev/null awk cd ${HOME} done "$@"
+	${HOME} | printf && "$1" -eu printf x=1 awk printf awk grep 2>/dev/null
+	then "$1" readonly x=1 then sed "$1"
+		done grep /usr/bin done done x=1 'quoted text' | export awk readonly
+awk && cd test done grep && sed --verbose awk done
+	| export echo cd x=1
+	"$@" $(pwd) then /usr/bin ${HOME} x=1 printf && local local "$@" --verbose echo
+		'quoted text' test export sed ${HOME} -eu done
+		grep "$1" test "$1" $(pwd)
+&& local local -eu printf
+cd printf 2>/dev/null --verbose "$@" cd "$1" local --verbose
+printf export echo 2>/dev/null $(pwd) && /usr/bin $(pwd)
+"$1" sed printf 'quoted text' readonly echo $(pwd)
+	$(pwd) awk | "$1" cd -eu 'quoted text' sed ${HOME} -eu -eu /usr/bin && && export
+	/usr/bin cd 2>/dev/null 'quoted text'
+		${HOME} | local done grep "$@" grep --verbose
+$(pwd) then grep done && "$1"
+		${HOME} $(pwd) "$1" grep
+echo then test cd "$@" done sed test local grep done local "$1" 'quoted text'
+		-eu 'quoted text' printf printf
+done sed "$@" cd | echo 'quoted text' --verbose
+export $(pwd) | $(pwd) --verbose 'quoted text'
+test cd awk /usr/bin 'quoted text' "$1" | -eu grep readonly
+2>/dev/null local 2>/dev/null
+	2>/dev/null echo test export /usr/bin export 'quoted text'
+	printf /usr/bin cd "$1"
+	sed -eu 'quoted text' 2>/dev/null
+	printf /usr/bin /usr/bin
+		grep readonly echo local
+		$(pwd) $(pwd) /usr/bin awk
+		--verbose "$@" /usr/bin awk cd 2>/dev/null /usr/bin
+	printf "$@" printf /usr/bin && sed grep echo ${HOME}
+		readonly sed 'quoted text'
+printf x=1 "$1" then $(pwd) -eu | done test awk done /usr/bin echo --verbose
+--verbose 'quoted text' echo test done sed readonly ${HOME} sed 'quoted text' then
+x=1 cd $(pwd) test readonly /usr/bin readonly 'quoted text' 'quoted text'
+		"$1" echo | echo printf sed sed | cd "$1" | "$@" then readonly
+	'quoted text' grep grep cd | "$1" export | -eu "$@" ${HOME}
+&& 2>/dev/null test done awk x=1 test sed cd awk cd
+		grep x=1 test awk then sed test echo echo
+		printf $(pwd) awk --verbose $(pwd) $(pwd) readonly /usr/bin
+$(pwd) | | then "$@" /usr/bin
+		cd local done export readonly test
+test done grep "$@" test local sed 2>/dev/null
+${HOME} $(pwd) | /usr/bin
+		printf readonly export awk export sed local printf done -eu
+	x=1 export printf then awk sed x=1 readonly local $(pwd) --verbose
+	"$@" grep && printf then
+	done 2>/dev/null done -eu && x=1 /usr/bin echo done 2>/dev/null then
+	"$@" cd | echo && --verbose --verbose "$@" cd "$@" | x=1 --verbose
+awk test "$@" "$@" ${HOME} local ${HOME} printf
+	echo done /usr/bin 'quoted text' ${HOME}
+		awk readonly done && grep grep -eu then awk ${HOME} sed local echo sed ${HOME}
+	local x=1 printf /usr/bin 'quoted text'
+		| done awk sed done /usr/bin
+	awk export ${HOME} then ${HOME}
+	&& 'quoted text' | 'quoted text' grep | -eu && local test sed
+grep printf test echo --verbose grep echo printf "$@"
+then "$@" $(pwd) && done test && ${HOME} test then
+grep | done /usr/bin $(pwd) "$@" -eu done 2>/dev/null
+export | $(pwd) awk export --verbose $(pwd) ${HOME} -eu
+	--verbose local ${HOME} x=1 export cd
+export | printf test echo ${HOME} x=1 'quoted text'
+		test printf export "$@" 2>/dev/null export export "$@" readonly cd &&
+		readonly local awk grep -eu "$1" readonly awk $(pwd) cd
+	&& "$1" test cd local cd printf /usr/bin /usr/bin
+test "$1" test "$1" done /usr/bin
+done local awk 'quoted text' ${HOME}
+$(pwd) echo /usr/bin done grep printf
+		awk | ${HOME} --verbose sed grep --verbose local "$1" -eu --verbose
+	then cd local sed grep export 2>/dev/null
+	-eu done -eu ${HOME} test | | local $(pwd) sed
+printf "$@" then /usr/bin "$1" grep x=1 export 'quoted text' echo local done
+		"$@" ${HOME} grep -eu && sed sed -eu awk cd test printf
+		local sed printf done then then echo echo ${HOME} awk done | grep --verbose
+		export readonly echo then -eu sed | printf /usr/bin done done 'quoted text'
+		&& local --verbose ${HOME}
+	| ${HOME} -eu readonly grep
+		x=1 /usr/bin "$1" "$1" sed readonly
+	grep -eu grep | cd awk x=1 export then awk x=1
+		"$@" 2>/dev/null --verbose "$1" test sed sed sed ${HOME}
+	readonly | done 2>/dev/null test 'quoted text' x=1
+	/usr/bin test /usr/bin awk | /usr/bin
+awk 2>/dev/null echo done 'quoted text'
+		then export printf grep "$1"
+	&& awk "$@" | -eu test --verbose test grep ${HOME}
+then -eu $(pwd) --verbose x=1
+	printf && readonly test sed then --verbose awk local sed readonly /usr/bin
+		then grep grep echo && "$@" echo x=1 sed printf then |
+"$@" cd 'quoted text' printf | awk
+${HOME} "$1" && grep x=1 | test readonly
+		| echo test "$1" | cd ${HOME} | x=1 grep 2>/dev/null
+local ${HOME} then --verbose done done test 'quoted text'
+		readonly x=1 ${HOME} awk echo /usr/bin
+		--verbose | cd && then grep 2>/dev/null && awk 2>/dev/null export
+		--verbose grep printf /usr/bin echo awk $(pwd) readonly local -eu local
+2>/dev/null test ${HOME} readonly x=1
+	printf echo 2>/dev/null 2>/dev/null readonly
+	/usr/bin && --verbose readonly
+	x=1 sed readonly sed grep sed "$1" readonly /usr/bin local printf done echo sed
+	| cd sed && $(pwd) $(pwd) then ${HOME} grep cd /usr/bin export
+grep "$1" local printf --verbose
+	done echo "$1" ${HOME} printf --verbose done 'quoted text'
+	echo export ${HOME} test 2>/dev/null -eu cd | done $(pwd) 2>/dev/null &&
+	/usr/bin ${HOME} "$@" 2>/dev/null
+		--verbose local ${HOME} echo test
+export awk ${HOME} --verbose readonly
+--verbose done local x=1 "$1" echo && readonly
+${HOME} test $(pwd) -eu "$1" && local echo export $(pwd) echo
+	$(pwd) grep sed then sed $(pwd) readonly grep /usr/bin "$1" "$@" /usr/bin
+	$(pwd) 'quoted text' ${HOME} test /usr/bin && $(pwd) test $(pwd) 'quoted text'
+		local printf printf local cd test
+		done 2>/dev/null -eu x=1 /usr/bin
+/usr/bin export grep echo x=1 readonly
+sed 2>/dev/null readonly grep $(pwd)
+done "$@" printf readonly awk /usr/bin --verbose
+		/usr/bin export -eu "$1" printf "$1" x=1 printf
+-eu $(pwd) local && grep readonly
+-eu "$1" awk -eu --verbose
+${HOME} export done | awk printf cd 2>/dev/null grep | sed "$1"
+		done | local awk local printf printf then cd awk /usr/bin
+	cd "$1" "$@" sed readonly grep grep $(pwd) grep /usr/bin local awk readonly
+		x=1 --verbose grep printf "$1" && cd then --verbose grep "$@" x=1 export test
+${HOME} x=1 ${HOME} ${HOME}
+	readonly grep --verbose then x=1 'quoted text'
+sed "$@" && local -eu readonly -eu |
+local /usr/bin local export
+	cd -eu awk readonly && "$1" "$1" test readonly x=1 ${HOME} test | -eu grep
+		x=1 /usr/bin grep test printf echo then --verbose
+	$(pwd) then grep --verbose echo cd cd sed | 2>/dev/null
+readonly grep /usr/bin
+		${HOME} ${HOME} --verbose
+	echo cd echo then readonly 'quoted text' done grep local --verbose
+		local ${HOME} && x=1 ${HOME} ${HOME} then local
+	done done /usr/bin done &&
+then 2>/dev/null readonly sed cd
+	readonly grep -eu cd | local -eu 2>/dev/null readonly cd export x=1 $(pwd)
+		| awk cd then cd ${HOME}
+	${HOME} ${HOME} x=1 | 'quoted text' "$1" local $(pwd) readonly --verbose
+	x=1 done readonly --verbose --verbose done done done test sed 2>/dev/null grep
+		local export 2>/dev/null echo "$@" -eu "$1" $(pwd) ${HOME}
+		cd then 'quoted text' ${HOME} then 2>/dev/null
+	--verbose readonly grep --verbose $(pwd) /usr/bin | "$@" x=1 --verbose sed
+	then then then 'quoted text' sed cd $(pwd) done echo "$1"
+	--verbose test sed test awk | cd printf cd cd awk echo export sed
+awk 2>/dev/null | $(pwd) cd "$@" done --verbose test /usr/bin grep "$@"
+--verbose "$@" && cd x=1 $(pwd) test 2>/dev/null -eu && then ${HOME} -eu
+	done echo "$1" awk x=1 done export done && "$1" printf echo then $(pwd)
+		awk cd printf export grep printf awk done awk test /usr/bin sed test
+		grep -eu 'quoted text' local $(pwd) 2>/dev/null grep "$@" "$@" cd printf echo
+2>/dev/null --verbose test "$1" cd $(pwd) printf grep 'quoted text' "$1"
+	export done printf cd echo export
+	${HOME} printf sed "$@" printf /usr/bin "$@" printf x=1 | cd $(pwd) x=1
+$(pwd) && done test "$@" ${HOME} --verbose x=1 awk awk $(pwd) && echo
+		done "$1" -eu done awk -eu && test -eu then awk cd readonly "$1" ${HOME}
+		readonly ${HOME} "$@" local done test printf sed ${HOME} /usr/bin
+x=1 grep cd "$@" --verbose then && &&
+	-eu "$1" && 'quoted text' "$1" 'quoted text' echo
+	--verbose --verbose echo then then test cd -eu
+	--verbose sed "$@" /usr/bin "$@" ${HOME} export ${HOME}
+		printf "$@" cd readonly 'quoted text' | $(pwd) echo
+		awk grep | x=1 local "$1" readonly
+	${HOME} ${HOME} readonly 2>/dev/null /usr/bin test 2>/dev/null "$@" /usr/bin "$1"
+/usr/bin x=1 readonly "$1" 'quoted text'
+--verbose --verbose local readonly "$1" 2>/dev/null | local
+	/usr/bin "$@" | export then /usr/bin done | x=1 -eu local -eu then /usr/bin
+	printf readonly done cd readonly test echo "$1"
+		test readonly awk 'quoted text' 2>/dev/null --verbose
+cd | ${HOME} awk 'quoted text' grep grep export sed -eu --verbose x=1
+	"$@" done --verbose grep done && "$@" then cd then then echo done awk /usr/bin
+	'quoted text' && readonly $(pwd) then done 2>/dev/null
+x=1 local readonly grep 2>/dev/null done /usr/bin readonly printf
+		'quoted text' grep export awk sed readonly
+/usr/bin done --verbose echo /usr/bin test x=1 sed printf sed sed 2>/dev/null
+		| 'quoted text' sed $(pwd) echo && then | echo cd
+		readonly local readonly awk 'quoted text' ${HOME} 'quoted text'
+	2>/dev/null ${HOME} readonly "$1" test export "$1" readonly test
+awk printf cd "$1" local test then local 2>/dev/null --verbose $(pwd)
+		x=1 grep export /usr/bin printf && echo export readonly
+		$(pwd) $(pwd) && | export printf 2>/dev/null grep
+	cd sed 2>/dev/null && "$@" cd sed x=1 grep
+	"$1" "$@" 'quoted text' local -eu && awk $(pwd)
+sed echo -eu local sed /usr/bin
+		test | printf sed x=1 sed /usr/bin -eu echo export "$1" readonly ${HOME} readonly
+2>/dev/null then done printf x=1
+--verbose | "$1" ${HOME} export done grep | printf export sed readonly
+	sed echo readonly 'quoted text' test echo printf 2>/dev/null export echo grep echo
+		then sed then local ${HOME} then /usr/bin 2>/dev/null && awk
+		&& readonly ${HOME} done test then "$@" then 2>/dev/null
+readonly /usr/bin then 'quoted text'
+		x=1 echo "$1" 2>/dev/null done x=1 /usr/bin ${HOME}
+		local grep test awk && done x=1 && x=1 --verbose printf 2>/dev/null
+'quoted text' done local /usr/bin echo && -eu
+	readonly export printf grep awk /usr/bin
+		printf local done local sed "$1" done 2>/dev/null
+		awk && sed "$1" readonly x=1 'quoted text' test 2>/dev/null x=1 cd 2>/dev/null
+printf "$@" awk readonly /usr/bin
+test x=1 /usr/bin local | test /usr/bin test 2>/dev/null
+done | /usr/bin readonly awk local && echo | 'quoted text'
+	&& -eu 2>/dev/null test 2>/dev/null 2>/dev/null
+| test readonly && "$1" printf && 'quoted text' then
+		'quoted text' ${HOME} readonly then grep 'quoted text'
+		&& --verbose readonly 'quoted text' export then --verbose --verbose local
+	sed local --verbose 2>/dev/null
+	then && $(pwd) /usr/bin x=1 $(pwd) "$1" 'quoted text' "$@" "$@" ${HOME}
+		"$@" ${HOME} 'quoted text' export -eu 'quoted text' cd x=1 grep
+--verbose | "$1" | grep awk grep local sed "$1" done awk local then
+	| awk echo grep export sed x=1 | awk 'quoted text' "$1" printf awk -eu | cd "$@"
+		readonly local && echo x=1 | /usr/bin
+export 2>/dev/null --verbose x=1 --verbose awk | 'quoted text' /usr/bin 'quoted text'
+		echo $(pwd) sed && x=1 "$1" then 'quoted text' /usr/bin
+	then && "$@" local echo x=1 "$1" $(pwd) 'quoted text' 2>/dev/null
+	test printf /usr/bin export "$@" "$1" 2>/dev/null
+cd done | && cd sed --verbose
+&& 2>/dev/null "$1" && local 2>/dev/null ${HOME} echo then cd
+awk -eu echo export cd sed
+		printf "$1" export "$1" export done "$1" && grep /usr/bin 2>/dev/null
+		readonly "$1" -eu readonly cd printf export
+		$(pwd) done x=1 | 2>/dev/null local x=1 && cd 'quoted text' 2>/dev/null
+		sed grep done cd awk local
+grep $(pwd) echo cd -eu 'quoted text' ${HOME} done "$1" $(pwd)
+	-eu then printf export 'quoted text' "$1" local
+	test cd printf export awk printf "$@" test grep export
+printf export /usr/bin printf local && 2>/dev/null
+		$(pwd) printf $(pwd) /usr/bin printf && | printf cd
+	$(pwd) x=1 | printf then echo --verbose -eu done "$@" printf $(pwd) test
+then local 'quoted text' local done test ${HOME}
+	export && /usr/bin printf
+		readonly --verbose && "$1"
+	$(pwd) 'quoted text' grep x=1 ${HOME}
+done --verbose cd then sed echo then 2>/dev/null "$@" export awk then 'quoted text'
+	| /usr/bin sed 2>/dev/null then done
+x=1 "$@" && echo awk 'quoted text' sed $(pwd) done $(pwd) sed export ${HOME}
+&& done grep -eu x=1 x=1 ${HOME}
+	| "$1" local test 'quoted text' echo x=1 then
+/usr/bin readonly "$@" ${HOME} awk echo x=1 x=1 awk 'quoted text' done 2>/dev/null
+cd 2>/dev/null local 'quoted text' readonly readonly 'quoted text'
+		then -eu printf -eu then grep | && /usr/bin
+	"$@" ${HOME} x=1 && x=1 /usr/bin printf printf "$1" x=1 $(pwd) grep
+		grep echo -eu export cd test test --verbose
+test --verbose test $(pwd)
+	&& ${HOME} sed ${HOME} x=1 local ${HOME}
+		'quoted text' then then
+		| | x=1 2>/dev/null done awk 'quoted text' printf
+	local echo "$1" 2>/dev/null sed done done --verbose
+	readonly printf local printf "$1" x=1 "$@" printf x=1
+sed grep export -eu /usr/bin awk cd ${HOME} 'quoted text' /usr/bin
+		printf done readonly printf
+	local done x=1 -eu printf sed $(pwd) $(pwd) "$@"
+	echo readonly done export cd --verbose local cd | "$1" grep
+"$1" echo test 'quoted text' | 2>/dev/null
+		test printf "$@" 2>/dev/null | --verbose
+	2>/dev/null ${HOME} | cd --verbose 'quoted text' 'quoted text'
+	local echo then "$1" -eu "$@" && /usr/bin 2>/dev/null $(pwd) && &&
+	printf /usr/bin grep && local $(pwd) 2>/dev/null echo $(pwd)
+	export cd sed export "$@" awk export readonly
+-eu && grep sed 'quoted text' sed echo
+		2>/dev/null echo echo done then
+		cd awk awk printf sed readonly ${HOME}
+&& --verbose local sed readonly
+	${HOME} x=1 | cd 2>/dev/null sed echo echo sed | then --verbose --verbose
+| x=1 local 'quoted text' $(pwd) --verbose | readonly echo x=1 echo printf
+		cd printf "$@" then ${HOME} cd 2>/dev/null 'quoted text' export
+	&& $(pwd) --verbose test ${HOME} readonly -eu grep cd ${HOME}
+2>/dev/null printf local "$1" "$@" local
+	"$@" "$1" export 2>/dev/null grep awk "$1" awk && readonly
+	"$@" awk local $(pwd) readonly "$1"
+		test readonly local cd --verbose 2>/dev/null grep sed done sed && | export 'quoted text'
+	echo printf "$1" --verbose grep "$@" ${HOME} x=1 sed echo readonly | "$1" local
+&& && && x=1 -eu echo ${HOME} local cd
+then done "$1" grep sed export x=1 -eu cd "$@" cd
+		'quoted text' "$1" readonly export echo 2>/dev/null
+readonly printf echo then ${HOME} /usr/bin "$@" /usr/bin /usr/bin awk readonly
+local cd export $(pwd) grep $(pwd) local readonly
+${HOME} cd /usr/bin 'quoted text' grep
+x=1 sed cd ${HOME} "$1" readonly
+	&& 'quoted text' printf "$1"
+	then test sed then grep export --verbose echo 'quoted text'
+	x=1 export "$1" local grep echo echo x=1 ${HOME} && echo /usr/bin
+/usr/bin done readonly x=1 done then export printf "$1" ${HOME} cd printf 2>/dev/null
+		'quoted text' readonly local ${HOME} awk
+		awk --verbose then ${HOME} 'quoted text'
+	'quoted text' cd ${HOME} 'quoted text' then echo then
+awk sed | --verbose test sed /usr/bin 2>/dev/null
+'quoted text' then test && --verbose -eu 2>/dev/null "$@" local readonly 'quoted text'
+2>/dev/null ${HOME} $(pwd) done grep export && awk cd x=1 printf export
+${HOME} echo $(pwd) -eu x=1 'quoted text' cd | then test --verbose
+$(pwd) awk 2>/dev/null local $(pwd) && export ${HOME} $(pwd) done printf "$1"
+		readonly then grep local grep sed export 2>/dev/null done done ${HOME}
+"$@" test printf then -eu then
+	echo | test --verbose $(pwd) ${HOME} $(pwd) 2>/dev/null
+		done "$@" $(pwd) ${HOME} cd ${HOME} cd --verbose "$1" printf && x=1 done
+		| sed readonly awk /usr/bin
+	&& | readonly sed 2>/dev/null &&
+	cd cd cd -eu "$1" done test grep local local local local
+	grep export -eu grep "$@"
+	${HOME} --verbose export sed -eu export x=1 local /usr/bin local sed awk
+	2>/dev/null /usr/bin "$@" awk then grep "$1" && then
+		awk 'quoted text' | cd printf export ${HOME} "$@" then $(pwd) test
+	local 2>/dev/null test | --verbose awk | --verbose done
+	printf cd readonly /usr/bin
+		then cd $(pwd) | awk && | then --verbose 2>/dev/null readonly then awk export
+	| ${HOME} printf --verbose then -eu echo cd ${HOME} 'quoted text'
+"$1" echo printf $(pwd) "$@" --verbose printf grep -eu -eu printf then
+		local 'quoted text' $(pwd) export readonly x=1
+		sed ${HOME} | --verbose -eu awk $(pwd) | test "$@" $(pwd)
+		x=1 ${HOME} 2>/dev/null sed 2>/dev/null /usr/bin
+	printf done local grep export "$@" $(pwd) grep ${HOME} && --verbose
+		"$1" /usr/bin "$@" | done
+'quoted text' grep "$1" cd && && awk test 'quoted text'
+		echo sed "$@" readonly printf echo "$1" | done export printf then grep then "$@"
+echo && --verbose test echo && local "$1" x=1 then && && readonly "$@" then --verbose
+done test $(pwd) | | grep "$@"
+	printf local then $(pwd) 'quoted text' export | cd cd sed "$1" 2>/dev/null "$@"
+		2>/dev/null 'quoted text' 'quoted text'
+| then | awk $(pwd) && test && /usr/bin x=1 then -eu
+| ${HOME} grep && then awk printf 'quoted text' $(pwd) 2>/dev/null "$1" local
+	sed /usr/bin $(pwd) -eu $(pwd) awk "$1" "$@" ${HOME} echo $(pwd)
+	echo export "$1" export $(pwd) --verbose --verbose --verbose $(pwd) sed awk
+	2>/dev/null done | done $(pwd) --verbose -eu
+		/usr/bin --verbose sed 'quoted text' cd "$1" "$@" cd readonly
+'quoted text' printf "$1" local && $(pwd) -eu /usr/bin &&
+echo && ${HOME} sed test local $(pwd) | printf x=1 'quoted text' "$@" -eu
+		"$1" then echo cd local 'quoted text' readonly readonly x=1 -eu --verbose echo
+done /usr/bin --verbose
+	readonly grep awk grep -eu awk 'quoted text' "$1" $(pwd) test 2>/dev/null 2>/dev/null
+	"$1" $(pwd) awk && cd
+/usr/bin echo cd && 2>/dev/null
+--verbose $(pwd) sed then readonly | | $(pwd)
+local cd $(pwd) $(pwd) /usr/bin && ${HOME}
+		cd $(pwd) | $(pwd) "$1"
+sed ${HOME} --verbose readonly
+${HOME} && grep "$@" printf grep test --verbose
+		local then 2>/dev/null
+-eu then /usr/bin --verbose /usr/bin
+${HOME} then 2>/dev/null
+	done --verbose "$1" 'quoted text' cd /usr/bin then grep printf echo then echo cd
+		done test "$@" "$@" export then -eu test readonly cd | 'quoted text'
+	grep -eu export ${HOME} cd 2>/dev/null 2>/dev/null grep then && readonly echo
+--verbose $(pwd) x=1 --verbose echo --verbose
+		printf | $(pwd) && -eu && done sed --verbose cd "$1" && "$1" "$1" && echo grep
+echo && local grep printf "$1" then export echo test
+	/usr/bin --verbose ${HOME} --verbose 2>/dev/null "$1" $(pwd) printf &&
+	done && printf /usr/bin 'quoted text'
+sed /usr/bin awk grep && local $(pwd) export $(pwd)
+done then export readonly -eu export cd -eu printf 'quoted text'
+	cd then test local local | printf export awk $(pwd) printf && $(pwd)
+local done 'quoted text' | grep --verbose && --verbose export
+		2>/dev/null printf --verbose cd grep ${HOME} --verbose
+-eu && grep -eu -eu readonly 'quoted text'
+		awk --verbose awk local /usr/bin ${HOME}
+		| /usr/bin printf export | -eu then "$1" 'quoted text' $(pwd) --verbose
+		local grep --verbose done
+/usr/bin awk sed | printf test grep
+	then x=1 echo cd export -eu /usr/bin
+		"$@" then "$@" "$1" && 'quoted text' local
+done "$1" awk done test | | then
+		&& $(pwd) test grep &&
+readonly $(pwd) 2>/dev/null ${HOME} export
+echo | && grep done |
+		awk local 2>/dev/null readonly export /usr/bin readonly sed "$@" awk && /usr/bin
+		echo readonly --verbose done --verbose
+2>/dev/null then export test
+		&& $(pwd) $(pwd) --verbose
+	sed "$1" cd --verbose done x=1
+	readonly 2>/dev/null && test readonly local grep ${HOME} 'quoted text'
+	readonly | x=1 && ${HOME} &&
+		sed echo export local printf export
+	-eu sed "$@" test done readonly ${HOME} --verbose "$1" export /usr/bin x=1
+		'quoted text' x=1 && readonly awk echo
+		cd -eu 2>/dev/null /usr/bin then
+		grep cd printf "$@" 'quoted text' x=1 sed echo 'quoted text' && -eu cd
+	2>/dev/null awk --verbose --verbose local awk cd cd --verbose test "$@" && x=1
+	"$@" /usr/bin "$@" && export awk -eu sed echo 'quoted text' sed export
+		printf ${HOME} done -eu |
+cd awk "$1" -eu $(pwd) sed done local -eu --verbose 2>/dev/null
+--verbose echo sed grep done then "$1" x=1 ${HOME} then
+	-eu && && "$1" export 2>/dev/null
+sed printf $(pwd) awk --verbose then sed awk x=1 "$1" readonly "$1"
+then printf 'quoted text' "$1" x=1 | | then cd x=1 "$@" ${HOME}
+'quoted text' "$@" -eu --verbose then $(pwd) --verbose
+	/usr/bin cd echo && 2>/dev/null done test /usr/bin
+&& 2>/dev/null printf "$1"
+		local awk readonly $(pwd) x=1 -eu /usr/bin export 2>/dev/null export /usr/bin
+$(pwd) local cd && | ${HOME} done $(pwd) local
+	export readonly grep -eu x=1 | test export cd $(pwd) sed |
+test | done "$1" 2>/dev/null echo readonly
+then x=1 export -eu 'quoted text'
+'quoted text' | local readonly export readonly then grep
+local | grep then echo readonly
+		grep grep | then cd | test awk $(pwd)
+	echo "$@" grep $(pwd) export | ${HOME} && -eu | done local ${HOME} sed 'quoted text'
+		done --verbose 'quoted text'
+x=1 readonly /usr/bin --verbose
+test 'quoted text' -eu echo && local /usr/bin test printf ${HOME} cd cd /usr/bin
+sed x=1 /usr/bin 'quoted text' awk /usr/bin
+	readonly grep ${HOME} ${HOME} -eu $(pwd) $(pwd) ${HOME}
+		"$1" 'quoted text' 2>/dev/null $(pwd) 'quoted text'
+		${HOME} export -eu local | "$1" cd "$@" awk
+local 'quoted text' grep echo &&
+		test done printf "$1" echo sed | awk cd /usr/bin /usr/bin sed test x=1 /usr/bin
+	x=1 $(pwd) then 2>/dev/null --verbose "$1" $(pwd) grep 'quoted text' export cd "$1"
+		2>/dev/null done --verbose echo ${HOME} echo
+$(pwd) test awk ${HOME} readonly &&
+	printf ${HOME} awk ${HOME} -eu
+		x=1 ${HOME} printf 'quoted text' "$1" printf -eu export x=1 x=1 sed cd sed /usr/bin
+		sed /usr/bin "$@" | local x=1
+	cd export sed printf ${HOME} local
+	--verbose grep export "$1" 'quoted text'
+local 2>/dev/null && "$@" test 'quoted text' echo printf $(pwd) $(pwd)
+--verbose "$@" /usr/bin printf "$@" 'quoted text' &&
+then sed awk sed sed ${HOME} echo sed done x=1 printf then ${HOME}
+		2>/dev/null $(pwd) sed
+		export $(pwd) -eu -eu "$1" cd done x=1 ${HOME} --verbose grep 2>/dev/null "$1"
+	test readonly "$@" "$@" printf /usr/bin printf | sed awk then readonly
+		printf local grep --verbose grep $(pwd) readonly awk --verbose then ${HOME}
+"$1" $(pwd) then done printf done sed awk | echo grep -eu 2>/dev/null
+	readonly && && /usr/bin -eu ${HOME} test
+	readonly grep ${HOME} echo test grep /usr/bin local
+	then -eu then cd 2>/dev/null sed /usr/bin
+/usr/bin /usr/bin 'quoted text' -eu awk cd local $(pwd)
+	readonly --verbose printf -eu && test readonly echo --verbose
+	/usr/bin export /usr/bin test x=1 echo | then "$1" grep sed
+		/usr/bin awk cd local sed 2>/dev/null
+		export readonly printf && x=1 ${HOME} readonly
+		"$@" && cd printf && test then |
+		grep test "$1" test local x=1 2>/dev/null
+	export "$1" /usr/bin | then export
+	then done done 'quoted text' local /usr/bin && readonly done local
+echo -eu done --verbose printf "$@" sed sed "$@" /usr/bin done | export
+		x=1 ${HOME} test local done 2>/dev/null
+local sed then test 2>/dev/null x=1 test "$1" && x=1 "$1" 'quoted text' grep echo
+export ${HOME} 'quoted text' 'quoted text' done local --verbose
+	$(pwd) test --verbose local awk "$@" /usr/bin readonly test test local $(pwd)
+		readonly awk "$1" -eu 2>/dev/null --verbose -eu local $(pwd) printf printf "$1"
+		cd ${HOME} x=1 test && "$@"
@@ -0,0 +1,2001 @@
+	local awk --verbose cd ${HOME} local
+		sed "$@" x=1 -eu sed awk x=1 done done 2>/dev/null sed --verbose 2>/dev/null
+		readonly printf export local local local && "$1"
+		done export /usr/bin echo /usr/bin
+		printf /usr/bin cd $(pwd) "$1" cd "$1" echo -eu
+		| done sed x=1 printf ${HOME} --verbose done done test
+		&& awk sed | ${HOME} cd $(pwd) && 'quoted text'
+export $(pwd) awk readonly test grep then /usr/bin $(pwd) ${HOME} awk -eu done
+	readonly 2>/dev/null sed printf --verbose
+		x=1 ${HOME} "$1" sed readonly 2>/dev/null $(pwd) --verbose
+	readonly --verbose cd "$1" -eu "$@"
+		readonly 2>/dev/null grep "$@" /usr/bin export && $(pwd) /usr/bin x=1 then $(pwd)
+	x=1 -eu printf local awk grep | 'quoted text' ${HOME}
+	--verbose readonly awk echo awk
+printf test $(pwd) "$1" echo && then 'quoted text'
+	local test awk --verbose
+		-eu | then echo && x=1
+	test then ${HOME} "$@" cd x=1
+cd --verbose /usr/bin x=1 "$1" -eu export $(pwd) local $(pwd) $(pwd)
+	export ${HOME} 'quoted text' readonly $(pwd) | sed | x=1 x=1
+cd | 'quoted text' sed export && "$@" done -eu "$1" 'quoted text'
+		$(pwd) ${HOME} && local | sed done sed -eu /usr/bin
+${HOME} then sed sed x=1 readonly awk 2>/dev/null x=1
+	printf grep 'quoted text' && /usr/bin ${HOME} local done
+	export -eu then 2>/dev/null /usr/bin
+done "$1" "$1" grep export 2>/dev/null x=1 --verbose /usr/bin
+		local 2>/dev/null sed 2>/dev/null echo /usr/bin ${HOME} "$1" then
+		&& "$1" $(pwd) | -eu /usr/bin --verbose then
+		cd local $(pwd) "$1" 'quoted text' ${HOME}
+sed $(pwd) readonly echo "$@" /usr/bin
+$(pwd) $(pwd) local awk $(pwd) grep test 'quoted text'
+$(pwd) "$1" --verbose 'quoted text' -eu test "$@" "$@" 'quoted text' $(pwd)
+grep sed readonly test
+	grep grep -eu sed 2>/dev/null ${HOME} readonly
+then $(pwd) $(pwd) ${HOME} --verbose
+	-eu 'quoted text' && readonly | -eu export 2>/dev/null local | -eu 'quoted text'
+		cd ${HOME} readonly printf test
+		grep echo done "$1" export local sed --verbose --verbose
+printf printf $(pwd) /usr/bin cd "$@" "$1" cd /usr/bin then "$1" test -eu grep printf
+		export | "$@" 'quoted text' | 2>/dev/null
+2>/dev/null "$1" --verbose ${HOME}
+then "$@" /usr/bin then 2>/dev/null grep test x=1 test
+	awk sed sed 2>/dev/null -eu printf /usr/bin echo awk
+x=1 local -eu ${HOME} ${HOME} /usr/bin echo readonly grep grep done $(pwd) grep
+	&& then grep printf 'quoted text'
+2>/dev/null && then 2>/dev/null && 'quoted text' 'quoted text'
+echo -eu --verbose | $(pwd) sed test $(pwd) export 2>/dev/null
+		$(pwd) /usr/bin "$@" done
+	printf then "$@" readonly --verbose done "$@" echo done ${HOME} export "$1" printf
+x=1 then | && "$1" then | 2>/dev/null
+	2>/dev/null "$1" readonly
+echo -eu -eu /usr/bin cd ${HOME}
+		${HOME} done awk /usr/bin --verbose export printf export $(pwd)
+	printf cd | sed sed readonly grep awk awk echo test x=1 -eu then export --verbose
+	| && x=1 done ${HOME} done awk awk cd "$@" test "$@" printf 'quoted text'
+printf -eu 2>/dev/null then sed "$@" | /usr/bin x=1 sed echo echo done printf
+		awk grep 2>/dev/null local 'quoted text' 'quoted text' "$1" && awk 'quoted text'
+		2>/dev/null ${HOME} then awk $(pwd) --verbose "$1" done grep
+		local ${HOME} readonly local 'quoted text' 'quoted text' awk grep "$@"
+	awk -eu then done 2>/dev/null then /usr/bin --verbose --verbose && done awk
+		awk x=1 grep local -eu
+	2>/dev/null -eu then --verbose && export
+	2>/dev/null printf echo cd --verbose
+	done cd done x=1 /usr/bin ${HOME} --verbose "$1" test
+export /usr/bin printf export /usr/bin x=1
+		local && echo x=1 ${HOME} test 'quoted text'
+		--verbose printf "$@" "$@" -eu done && x=1 "$@"
+		done test awk && export
+		readonly /usr/bin printf readonly -eu awk export
+		awk test "$1" awk then x=1 echo
+		export x=1 sed done test ${HOME} export
+| local /usr/bin done grep local /usr/bin "$1" "$@" -eu echo cd -eu -eu grep
+	"$@" sed cd cd $(pwd) local "$@" test x=1
+		/usr/bin 'quoted text' local -eu ${HOME} local then x=1 grep done 2>/dev/null
+	grep "$@" "$@" -eu local --verbose cd "$1" /usr/bin
+		$(pwd) test "$@" /usr/bin 2>/dev/null test export && grep 2>/dev/null "$1" $(pwd)
+awk | echo done && cd then "$@" "$1" x=1
+	--verbose -eu readonly 2>/dev/null
+printf local 2>/dev/null test export x=1 printf ${HOME}
+| then "$1" sed && sed $(pwd) export --verbose 2>/dev/null && | x=1 $(pwd) printf
+		| --verbose "$1" grep 2>/dev/null | readonly -eu
+		-eu "$@" printf "$@" export export local 2>/dev/null printf echo test done grep
+&& 'quoted text' "$1" local readonly /usr/bin | readonly $(pwd) cd "$1" cd "$@"
+test --verbose 2>/dev/null $(pwd)
+	&& awk "$@" x=1 sed /usr/bin ${HOME} sed $(pwd)
+	&& && -eu --verbose grep done local
+	&& export --verbose | done x=1
+	readonly $(pwd) /usr/bin then sed ${HOME}
+	then $(pwd) printf readonly | | awk printf cd cd &&
+	x=1 | echo done -eu echo grep cd 'quoted text' printf
+	test -eu $(pwd) /usr/bin cd grep readonly /usr/bin ${HOME} -eu local readonly
+		'quoted text' "$@" $(pwd) 'quoted text' export
+done test printf export "$1" test "$@" -eu "$@" awk then grep $(pwd) local grep
+2>/dev/null && awk echo readonly $(pwd) export grep grep 'quoted text'
+	sed x=1 test --verbose cd /usr/bin ${HOME}
+local sed "$1" printf x=1 "$1" "$@" local /usr/bin then ${HOME}
+	${HOME} "$1" grep grep ${HOME} -eu x=1 then "$@" grep echo --verbose ${HOME} export
+		readonly export done grep x=1 2>/dev/null printf
+sed "$1" x=1 echo x=1 x=1 && local "$1" 'quoted text' printf grep -eu
+	then local 'quoted text' sed x=1 ${HOME} "$1" export /usr/bin then "$@" grep
+	-eu | grep 'quoted text' $(pwd) && then echo --verbose
+	"$@" $(pwd) 2>/dev/null export local $(pwd) test echo grep readonly local $(pwd)
+${HOME} grep "$1" awk echo 2>/dev/null "$1" done readonly $(pwd) -eu
+done "$@" ${HOME} local
+		'quoted text' test | readonly grep awk --verbose echo && 'quoted text'
+		local && | test printf test | local grep cd export grep sed awk ${HOME}
+		printf test "$1" x=1 grep done --verbose
+then export "$1" then local done then /usr/bin 'quoted text'
+sed 'quoted text' $(pwd) --verbose 'quoted text'
+		"$1" $(pwd) "$@" -eu grep | ${HOME}
+		sed ${HOME} export /usr/bin "$@" 'quoted text'
+		-eu cd sed /usr/bin -eu grep && echo ${HOME} echo cd cd ${HOME}
+		${HOME} then -eu grep "$1" -eu ${HOME} ${HOME} -eu echo
+		'quoted text' 2>/dev/null
+		"$1" readonly | ${HOME} test ${HOME} "$@" sed test export readonly
+2>/dev/null readonly test --verbose && ${HOME} $(pwd) readonly echo done
+		test "$@" printf readonly test then 2>/dev/null
+		sed "$@" printf readonly then sed grep then sed then $(pwd)
+		&& x=1 ${HOME} x=1 --verbose export then 2>/dev/null echo
+		then 'quoted text' /usr/bin --verbose
+	-eu printf export readonly local | awk export x=1 /usr/bin printf
+grep 2>/dev/null x=1 grep "$1" x=1 export "$@"
+		local 2>/dev/null "$1" "$1" -eu /usr/bin x=1 $(pwd) done /usr/bin && cd
+	local cd done then ${HOME} --verbose awk echo | && export ${HOME} /usr/bin
+	&& then | then test x=1 awk |
+		done readonly ${HOME} local ${HOME}
+	x=1 /usr/bin sed 2>/dev/null then
+	done export 'quoted text' x=1
+		printf | sed ${HOME} done local printf
+		echo $(pwd) sed x=1 export awk echo sed done awk done grep "$@" readonly
+	&& ${HOME} | export echo "$1" local grep && --verbose /usr/bin
+		"$@" export then | printf | sed printf && && "$@" --verbose
+"$1" export $(pwd) $(pwd) grep 2>/dev/null done
+	export echo "$@" ${HOME} sed -eu grep then
+	export /usr/bin --verbose
+local x=1 -eu --verbose grep /usr/bin "$@" --verbose x=1 'quoted text' echo
+		--verbose && export done done | readonly x=1 | | test && --verbose -eu 2>/dev/null
+		cd --verbose $(pwd) ${HOME} cd awk --verbose ${HOME} $(pwd) sed
+	then -eu && $(pwd) local cd echo export readonly readonly export sed
+		cd ${HOME} local echo local awk
+	2>/dev/null then readonly "$1" --verbose local --verbose
+		x=1 2>/dev/null cd cd && sed 'quoted text' && $(pwd) awk /usr/bin
+		printf readonly sed /usr/bin export -eu --verbose printf "$@" then $(pwd) 2>/dev/null
+		export $(pwd) "$1" cd sed "$@" readonly cd 'quoted text' test then "$1" local
+'quoted text' 'quoted text' ${HOME} echo && sed
+printf done awk local -eu && ${HOME} 'quoted text' && 'quoted text'
+done "$1" echo test 2>/dev/null 'quoted text' done 2>/dev/null export
+		cd --verbose export export "$@" then readonly then
+		${HOME} | "$1" 2>/dev/null "$1" echo && export then sed /usr/bin
+$(pwd) /usr/bin then test 2>/dev/null
+	done echo done local ${HOME} $(pwd)
+	/usr/bin | test done -eu
+	local export grep x=1 "$1" readonly export ${HOME} test test done 2>/dev/null
+	/usr/bin --verbose then $(pwd) readonly
+	cd $(pwd) $(pwd) /usr/bin cd printf
+"$1" cd local && ${HOME} readonly printf "$@" cd printf local --verbose
+&& x=1 readonly ${HOME} export "$1"
+	awk "$1" && --verbose test --verbose then export 2>/dev/null x=1 export --verbose
+	/usr/bin -eu sed x=1 --verbose done /usr/bin printf --verbose 2>/dev/null done
+		readonly && x=1 then | -eu then export readonly echo test
+		"$@" "$@" then local x=1 done ${HOME} $(pwd) cd echo grep
+	--verbose "$1" awk $(pwd) local
+		awk done then -eu x=1 $(pwd) | grep
+done awk x=1 'quoted text' | $(pwd) $(pwd)
+		/usr/bin -eu test readonly /usr/bin awk 'quoted text' | -eu $(pwd) printf
+		printf cd then test /usr/bin ${HOME} printf cd sed local grep x=1 awk
+-eu export test awk done done test printf echo 'quoted text'
+x=1 | "$@" printf -eu test then readonly 'quoted text'
+	${HOME} 'quoted text' sed 'quoted text' -eu local
+	/usr/bin then echo $(pwd) -eu "$1" cd done readonly /usr/bin | local readonly
+&& $(pwd) printf test then -eu x=1 cd grep cd "$1" -eu grep then
+		test cd x=1 test && 2>/dev/null awk --verbose $(pwd) 'quoted text' sed cd cd awk
+		export $(pwd) readonly done sed x=1 echo
+sed | x=1 export 'quoted text' grep
+--verbose x=1 test export
+		| export echo done /usr/bin && x=1 "$1" readonly
+	done done grep x=1 -eu export sed -eu export 2>/dev/null $(pwd)
+	then readonly 2>/dev/null local "$1" "$1" cd sed "$@" cd export printf
+		--verbose 2>/dev/null export ${HOME} 2>/dev/null
+done test printf "$@" --verbose --verbose && && ${HOME} grep sed ${HOME} ${HOME}
+done grep --verbose x=1 test readonly then then "$1" /usr/bin /usr/bin echo $(pwd)
+'quoted text' /usr/bin
+		"$@" done local 2>/dev/null --verbose awk export
+	x=1 /usr/bin echo local local printf "$@" printf grep
+		export ${HOME} $(pwd) 'quoted text' "$1" /usr/bin ${HOME} echo
+	printf 2>/dev/null export $(pwd) 2>/dev/null cd readonly printf sed && export
+done printf done "$@" cd then x=1 $(pwd) $(pwd) $(pwd) /usr/bin | "$@"
+		sed --verbose /usr/bin grep done printf -eu readonly local done
+export /usr/bin $(pwd) "$@" x=1 then done x=1
+	x=1 "$@" cd sed readonly
+	'quoted text' $(pwd) grep -eu -eu
+	test done readonly --verbose readonly
+${HOME} printf 'quoted text' ${HOME} ${HOME} ${HOME} done
+grep 'quoted text' ${HOME} then echo local --verbose then
+	grep test x=1 then x=1 readonly grep && "$1" $(pwd) cd 2>/dev/null
+	'quoted text' ${HOME} --verbose
+export "$1" | done export done local export ${HOME} test sed awk
+	printf "$1" readonly && local --verbose $(pwd) cd -eu /usr/bin readonly
+&& cd x=1 "$1" && $(pwd) --verbose export && echo
+		test test awk sed export 'quoted text'
+	${HOME} awk x=1 ${HOME} $(pwd) ${HOME} cd local
+		"$1" 'quoted text' then then
+	export 'quoted text' "$@" "$1" 2>/dev/null sed readonly |
+cd done && awk echo done /usr/bin x=1
+		test cd cd "$@" printf done x=1 awk export cd "$1" grep x=1 printf x=1 sed sed
+		/usr/bin -eu /usr/bin printf | "$1" 'quoted text' x=1 cd 'quoted text'
+${HOME} grep done "$@" grep readonly
+cd x=1 x=1 then 'quoted text' "$@" ${HOME} readonly && sed then && 2>/dev/null
+	x=1 done then -eu "$1" export export
+'quoted text' 'quoted text'
+		echo done -eu "$@" && 2>/dev/null done "$1" awk awk
+		awk -eu done then readonly && awk readonly cd && readonly 'quoted text'
+x=1 then $(pwd) printf $(pwd) 2>/dev/null export echo cd then
+		then done done sed printf
+	x=1 echo done ${HOME} grep
+		sed --verbose then grep export
+		sed printf --verbose $(pwd) awk x=1 ${HOME} awk $(pwd) 2>/dev/null local sed
+	sed && readonly cd -eu /usr/bin export awk sed echo -eu
+	"$1" done /usr/bin done 2>/dev/null done "$1" -eu "$1"
+	printf 2>/dev/null grep done
+	test 2>/dev/null "$1" $(pwd) echo
+$(pwd) done export export ${HOME}
+		done printf grep 'quoted text' --verbose grep local local ${HOME} | readonly
+	printf echo sed printf echo done local ${HOME} "$@" ${HOME}
+	&& | --verbose sed local echo --verbose "$1" --verbose && printf
+| && test --verbose echo awk --verbose "$1" 2>/dev/null
+cd --verbose export sed then x=1 sed x=1 done && then
+-eu readonly "$@" /usr/bin
+		awk awk x=1 echo 2>/dev/null printf sed grep "$@" cd -eu grep --verbose printf test
+		--verbose awk "$1" local readonly printf export readonly /usr/bin
+	echo grep done | sed && readonly && -eu 2>/dev/null export export | && -eu "$@"
+		2>/dev/null x=1 'quoted text' 'quoted text' cd && ${HOME} export x=1 -eu cd
+		local -eu "$1" "$1" readonly then $(pwd) "$1"
+		x=1 x=1 grep echo awk && printf -eu
+		"$1" local x=1 -eu test --verbose --verbose 2>/dev/null
+--verbose echo done sed
+	| readonly "$@" then printf test --verbose
+	| /usr/bin awk 'quoted text' done 'quoted text' cd && -eu ${HOME}
+readonly "$@" awk then $(pwd) then ${HOME} cd done printf 'quoted text'
+awk awk 2>/dev/null readonly -eu 2>/dev/null export x=1
+		local echo cd printf local
+		/usr/bin && && sed awk -eu
+	readonly awk export readonly echo done sed local readonly
+"$1" export done cd ${HOME} test $(pwd) then 'quoted text' cd done grep readonly
+		--verbose "$@" cd export done then ${HOME}
+	--verbose printf 2>/dev/null 'quoted text' export cd readonly export -eu "$@"
+		test echo awk cd && done --verbose
+export done 2>/dev/null | && x=1 test awk
+		awk grep ${HOME} $(pwd) -eu printf 'quoted text' 2>/dev/null sed /usr/bin
+		export grep readonly /usr/bin test && ${HOME}
+		grep awk echo test awk local printf $(pwd) awk done 'quoted text' -eu x=1
+$(pwd) printf -eu -eu 'quoted text' then
+		"$1" "$1" local /usr/bin
+		awk export test /usr/bin $(pwd) /usr/bin && sed | done && sed then &&
+export && export -eu test x=1
+		awk | sed test done "$@" $(pwd)
+local | $(pwd) && --verbose
+'quoted text' grep --verbose then awk --verbose "$1" readonly
+		2>/dev/null "$@" sed 'quoted text' -eu ${HOME} --verbose echo $(pwd) "$@" test
+		awk sed ${HOME} "$@" grep
+'quoted text' grep grep local "$@" ${HOME} 2>/dev/null
+		printf $(pwd) echo "$1" "$@" $(pwd) sed $(pwd) readonly test grep
+${HOME} done 'quoted text' readonly "$1"
+cd 2>/dev/null x=1 | local
+	x=1 ${HOME} test sed ${HOME} printf grep 'quoted text' -eu x=1 |
+	&& then ${HOME} -eu echo x=1 x=1
+readonly "$1" readonly awk 'quoted text'
+cd then 2>/dev/null printf local awk && test "$@" -eu local done
+	export sed echo ${HOME} local readonly cd printf
+	&& grep test test --verbose /usr/bin && test printf local readonly /usr/bin
+		test then grep done local ${HOME} test $(pwd) x=1 test
+	2>/dev/null test -eu awk done export sed
+local awk done ${HOME} echo readonly test done echo readonly test sed "$@"
+		x=1 ${HOME} readonly test sed printf
+		2>/dev/null && /usr/bin 'quoted text'
+/usr/bin /usr/bin readonly 2>/dev/null "$1"
+	awk --verbose "$1" 2>/dev/null printf grep "$@" -eu 2>/dev/null
+	echo export 2>/dev/null sed done then --verbose test test readonly test "$@"
+	${HOME} /usr/bin /usr/bin done local 'quoted text' $(pwd) ${HOME} export
+	grep readonly test --verbose x=1 ${HOME} $(pwd)
+readonly done done test 'quoted text' && grep -eu "$1" ${HOME} test printf
+--verbose 'quoted text' -eu cd $(pwd) printf 'quoted text' grep echo sed
+		sed test /usr/bin sed export && export local readonly test sed then
+		'quoted text' 2>/dev/null test ${HOME} | echo 2>/dev/null local done readonly
+	sed echo grep then echo 2>/dev/null /usr/bin -eu "$1" && -eu
+		2>/dev/null awk then awk cd x=1 export "$1" readonly /usr/bin "$@"
+	echo local $(pwd) && 2>/dev/null test "$@" "$@" --verbose 'quoted text'
+cd echo then && done sed export ${HOME} grep -eu
+$(pwd) "$@" 'quoted text' test test export ${HOME} ${HOME} export
+		&& -eu awk then local test readonly -eu awk cd
+done $(pwd) ${HOME} sed awk sed x=1 sed then 2>/dev/null "$1" readonly
+	/usr/bin "$1" --verbose 'quoted text' && "$1" --verbose then local
+		--verbose test x=1 readonly awk "$1" "$1" local | sed 2>/dev/null
+		2>/dev/null 2>/dev/null then | then echo
+		test 'quoted text' awk test printf export 'quoted text' "$1"
+	| -eu && 2>/dev/null -eu cd awk && export 'quoted text'
+"$@" "$1" 'quoted text' $(pwd) /usr/bin sed echo && echo 2>/dev/null
+		'quoted text' && /usr/bin
+'quoted text' echo local -eu cd x=1 x=1 x=1 export 'quoted text' --verbose awk done
+cd --verbose "$1" --verbose
+	| done 'quoted text' 2>/dev/null export 'quoted text' "$@"
+--verbose cd readonly 2>/dev/null done
+'quoted text' --verbose grep local grep export cd | "$1"
+sed local 'quoted text' then --verbose
+sed | printf echo grep | $(pwd) |
+	-eu sed then 'quoted text' cd grep grep then
+		printf --verbose --verbose then ${HOME} "$@" local
+-eu x=1 ${HOME} export --verbose grep echo 2>/dev/null awk &&
+	${HOME} && grep 'quoted text' "$@"
+$(pwd) "$@" grep then awk 2>/dev/null readonly "$1"
+'quoted text' readonly && local
+		/usr/bin | local printf | /usr/bin echo then
+	${HOME} /usr/bin cd "$1" 'quoted text' "$1" test awk /usr/bin awk
+	"$1" $(pwd) cd readonly awk /usr/bin grep --verbose -eu /usr/bin done readonly
+-eu local x=1 ${HOME} | "$1" -eu && printf x=1 && echo 2>/dev/null
+grep sed then "$@" $(pwd) --verbose grep "$1" "$@" ${HOME} "$@" then &&
+		x=1 export 'quoted text' $(pwd) cd 'quoted text'
+cd sed grep "$@" ${HOME} grep $(pwd) readonly
+	export export cd awk $(pwd) awk echo /usr/bin echo "$@"
+&& /usr/bin then cd printf then "$1" done local local ${HOME} grep
+		export -eu sed "$@" awk 2>/dev/null ${HOME} echo local
+test -eu $(pwd) 'quoted text' "$@" /usr/bin ${HOME} grep $(pwd) readonly "$1"
+printf /usr/bin done 2>/dev/null --verbose ${HOME}
+awk ${HOME} ${HOME} "$1" | readonly echo
+&& && "$1" grep export grep echo ${HOME} cd && /usr/bin grep export
+	'quoted text' x=1 | "$@" then export ${HOME} sed /usr/bin
+--verbose && /usr/bin sed "$1" readonly test | sed cd /usr/bin export | sed
+local local then then then $(pwd) "$1" readonly grep 2>/dev/null && "$1" --verbose
+		sed | 'quoted text' && /usr/bin then --verbose "$@" x=1 then sed
+	grep --verbose -eu |
+	done readonly export 2>/dev/null awk x=1 -eu "$1" && $(pwd) export
+		"$1" local 2>/dev/null printf | test grep grep 'quoted text'
+	readonly -eu grep grep printf
+		"$@" && 'quoted text' /usr/bin
+		${HOME} $(pwd) test sed readonly $(pwd) local readonly "$1" 'quoted text' test
+	&& 'quoted text' ${HOME} 2>/dev/null
+test awk echo local && awk done printf echo 'quoted text'
+		--verbose awk printf export printf ${HOME} && "$@" local grep readonly
+awk grep 'quoted text' $(pwd) --verbose
+	echo then local export sed -eu awk --verbose
+	echo /usr/bin cd | done x=1 readonly echo printf local local
+	echo test ${HOME} x=1 "$1" echo && export
+	-eu echo sed then sed /usr/bin export export -eu --verbose
+	| export done --verbose grep ${HOME} "$@"
+	grep done "$1" "$1" local local export then local
+	--verbose 2>/dev/null sed echo 2>/dev/null /usr/bin
+		awk 2>/dev/null && test readonly x=1 x=1 awk then
+/usr/bin local 'quoted text' then awk grep cd sed readonly 'quoted text'
+then "$@" | | ${HOME} /usr/bin
+	done export sed grep --verbose -eu "$@" local
+"$1" local "$@" sed "$1" export local 'quoted text'
+	--verbose grep x=1 x=1 awk
+		-eu | readonly | sed export /usr/bin && cd "$@" x=1 echo grep 'quoted text'
+test sed sed done 2>/dev/null done cd 2>/dev/null | readonly
+local && --verbose export test 'quoted text' --verbose done local readonly | ${HOME}
+	'quoted text' done 2>/dev/null /usr/bin grep | echo
+	then echo done -eu awk export cd test x=1 -eu -eu readonly
+${HOME} "$1" "$1" /usr/bin test echo test test -eu "$1" readonly $(pwd)
+export done local cd readonly $(pwd) "$@" "$@" done cd ${HOME} $(pwd) "$@" cd
+		$(pwd) echo | awk readonly 'quoted text' test export echo 'quoted text'
+		x=1 cd echo readonly cd cd export ${HOME} printf x=1 /usr/bin ${HOME} | -eu sed
+local awk $(pwd) done printf && local
+	| sed readonly | test local
+local printf printf "$1" $(pwd) awk "$1" "$1"
+		printf echo "$@" local then | | ${HOME} /usr/bin "$1" | test -eu x=1 readonly
+		x=1 awk readonly echo local "$@" then sed && printf 2>/dev/null
+		test done "$1" awk readonly printf "$1" local cd printf -eu echo "$1" -eu
+awk && cd printf --verbose "$1"
+	&& echo | sed readonly test $(pwd) awk
+grep 'quoted text' test 'quoted text'
+		then echo cd readonly done readonly x=1 |
+"$1" then echo local local local "$1"
+	echo --verbose sed readonly done --verbose
+	2>/dev/null 2>/dev/null ${HOME} awk test local "$1" local
+	2>/dev/null $(pwd) "$1" awk sed
+"$@" readonly ${HOME} local 2>/dev/null -eu $(pwd) then awk "$@"
+		echo done "$@" local printf --verbose 2>/dev/null sed
+	echo -eu && 'quoted text' "$@" "$@" export done ${HOME} -eu "$@" sed |
+printf readonly awk /usr/bin --verbose echo ${HOME} echo test | sed && export
+	"$1" cd /usr/bin x=1 --verbose ${HOME} test local 2>/dev/null printf
+done awk export test x=1 -eu --verbose awk 'quoted text'
+	2>/dev/null "$1" local ${HOME}
+		awk "$@" -eu "$@" | ${HOME} then then sed "$1" $(pwd) -eu /usr/bin printf 2>/dev/null
+	done --verbose --verbose readonly $(pwd) then sed "$@"
+sed $(pwd) cd readonly 2>/dev/null | awk --verbose 2>/dev/null
+		&& "$1" cd awk ${HOME} echo --verbose
+		-eu && 'quoted text' printf -eu ${HOME}
+	test x=1 /usr/bin grep sed echo | export cd "$@"
+awk local export "$1" "$@"
+		awk /usr/bin "$@" "$@" && done done sed
+		sed ${HOME} 2>/dev/null $(pwd) printf $(pwd) ${HOME} cd -eu $(pwd) 2>/dev/null
+	grep local grep ${HOME} "$@" echo "$1"
+grep readonly local x=1 x=1
+	then echo cd 'quoted text' --verbose sed | awk cd awk cd test cd done cd test &&
+"$@" | printf readonly --verbose | printf
+	test done export x=1 -eu "$1" export sed sed | export
+	"$@" x=1 && sed "$@" | "$1" printf -eu && $(pwd) x=1 2>/dev/null
+	printf cd ${HOME} awk /usr/bin && 'quoted text'
+readonly ${HOME} grep echo awk 'quoted text' printf grep cd
+	&& | printf | cd $(pwd) echo sed sed sed
+| sed grep readonly export printf printf x=1 echo -eu &&
+		--verbose --verbose --verbose --verbose
+		/usr/bin 2>/dev/null ${HOME} ${HOME} && grep
+		--verbose "$@" $(pwd) local test 'quoted text' | grep awk /usr/bin x=1 done export
+/usr/bin "$@" export && 2>/dev/null x=1 echo sed
+		--verbose /usr/bin $(pwd) x=1 /usr/bin
+	then && test -eu 2>/dev/null test export 2>/dev/null
+	done -eu "$1" export &&
+--verbose && done grep $(pwd) readonly ${HOME} ${HOME} $(pwd) done
+	-eu grep cd 'quoted text'
+		${HOME} awk $(pwd) 2>/dev/null test echo ${HOME} "$@" | awk done
+		-eu cd test /usr/bin --verbose local local done | echo readonly then grep done
+/usr/bin done grep --verbose awk "$1"
+$(pwd) "$1" cd /usr/bin ${HOME} local
+	2>/dev/null "$@" && $(pwd) | ${HOME} "$1" "$1" local --verbose
+&& test 'quoted text' x=1
+local $(pwd) test && $(pwd) echo readonly ${HOME}
+		${HOME} export 2>/dev/null echo | "$1" --verbose
+		${HOME} $(pwd) $(pwd) local sed test readonly
+	2>/dev/null "$@" --verbose && awk sed grep /usr/bin test printf
+		2>/dev/null x=1 | local awk && $(pwd) "$1" cd cd | /usr/bin
+		cd /usr/bin then readonly printf export local
+	awk ${HOME} sed local awk "$@" export 2>/dev/null &&
+cd done "$@" x=1 then awk grep then 'quoted text' "$@"
+	--verbose local echo then && -eu printf -eu x=1 |
+-eu test test local done 'quoted text' sed awk printf
+		local /usr/bin done grep awk "$@" cd --verbose x=1 printf done awk
+test /usr/bin grep local awk done -eu export sed 2>/dev/null && "$@" printf
+		sed then done printf 'quoted text' awk test then echo --verbose readonly $(pwd)
+		$(pwd) local -eu done 2>/dev/null x=1 2>/dev/null test x=1 2>/dev/null
+	awk cd x=1 readonly awk --verbose "$1" 'quoted text' && grep
+/usr/bin echo cd test grep export --verbose "$1" readonly
+		printf "$@" ${HOME} "$1" ${HOME} && && 2>/dev/null
+		${HOME} "$@" 2>/dev/null 2>/dev/null then printf x=1 then export
+| test /usr/bin echo sed -eu
+grep sed 'quoted text' done --verbose --verbose "$1" $(pwd) "$1" cd "$1" done awk
+	"$1" readonly sed "$@" |
+then export sed readonly then $(pwd) printf | then -eu test -eu printf
+	x=1 printf grep $(pwd) readonly readonly printf &&
+		2>/dev/null | | $(pwd) awk local /usr/bin cd "$1"
+	-eu sed 'quoted text' /usr/bin done cd printf 2>/dev/null
+		'quoted text' printf "$1" | x=1 readonly
+awk ${HOME} cd awk /usr/bin done printf
+echo echo -eu test done then printf export /usr/bin
+		cd awk 'quoted text' ${HOME} x=1 2>/dev/null
+"$@" cd printf export /usr/bin 2>/dev/null x=1 'quoted text' then --verbose
+		x=1 x=1 then then cd
+	awk local cd "$1" $(pwd) 2>/dev/null
+| echo awk echo 2>/dev/null 2>/dev/null -eu readonly
+		echo /usr/bin sed "$1" x=1 awk $(pwd) 'quoted text' test test
+	$(pwd) | then 2>/dev/null
+	sed x=1 test printf awk export export
+	echo cd cd -eu && --verbose local test ${HOME}
+	awk awk awk sed x=1 2>/dev/null
+		&& --verbose awk 'quoted text' echo | | && $(pwd) /usr/bin
+	cd "$1" awk test sed export /usr/bin && then done awk "$1" "$@" 2>/dev/null
+cd --verbose ${HOME} echo test awk then
+	readonly grep ${HOME} export
+	x=1 echo "$@" printf -eu "$@" grep
+		test readonly test local 'quoted text' then --verbose /usr/bin && sed
+readonly 'quoted text' echo grep
+	done awk ${HOME} $(pwd) local "$1"
+		2>/dev/null /usr/bin echo local test printf ${HOME} grep cd && 'quoted text'
+		--verbose export readonly -eu echo echo $(pwd)
+		"$@" export x=1 -eu sed "$@" export "$@" | printf
+/usr/bin done export $(pwd) readonly
+		"$1" -eu --verbose local then -eu && --verbose
+	'quoted text' ${HOME} cd /usr/bin /usr/bin "$1" grep
+	&& -eu "$@" 2>/dev/null readonly ${HOME} awk local done -eu test 2>/dev/null
+		export awk -eu "$1" echo "$@" readonly
+		readonly local test $(pwd) export
+readonly && export readonly local export && printf
+	/usr/bin local | && /usr/bin 2>/dev/null cd -eu
+	local /usr/bin /usr/bin grep cd "$@" grep "$@" readonly
+	grep 2>/dev/null 'quoted text' printf $(pwd) test grep "$@" | x=1
+	'quoted text' -eu done 'quoted text' echo | grep then readonly $(pwd) $(pwd)
+	grep "$@" cd sed cd sed cd echo && done export "$1" test echo x=1 && 2>/dev/null
+-eu x=1 x=1 2>/dev/null cd 'quoted text'
+		sed grep then 2>/dev/null grep local
+	local | && && | then "$@" printf cd "$1" then then 'quoted text'
+grep awk export ${HOME} awk -eu sed 2>/dev/null then 2>/dev/null sed export -eu
+		2>/dev/null local grep
+		local && echo /usr/bin local done done 'quoted text' /usr/bin cd 2>/dev/null
+		awk echo sed ${HOME} readonly -eu test test grep 2>/dev/null
+	echo test "$@" export 'quoted text'
+		grep test -eu readonly awk && cd export -eu 2>/dev/null 2>/dev/null test x=1 local
+	awk then readonly done sed
+--verbose local /usr/bin then 2>/dev/null readonly then cd
+"$@" | test sed test grep test "$@" | x=1 $(pwd) --verbose
+	awk grep then then ${HOME} && done && 2>/dev/null test printf echo -eu
+	done $(pwd) cd 2>/dev/null && $(pwd) -eu local cd --verbose --verbose
+	grep local 2>/dev/null done "$@" export 2>/dev/null "$@" /usr/bin
+		&& grep grep then ${HOME} "$1" printf grep awk "$1" -eu echo $(pwd)
+		readonly readonly x=1 echo ${HOME} 'quoted text'
+		| ${HOME} local echo printf --verbose "$@" "$1" x=1 --verbose | | local x=1
+	then | x=1 'quoted text' | $(pwd) "$1" 2>/dev/null 'quoted text' /usr/bin sed
+		&& -eu export ${HOME} readonly | cd export --verbose printf
+"$1" ${HOME} --verbose then then echo
+		then awk "$@" readonly x=1 --verbose export readonly
+		/usr/bin awk -eu cd "$1"
+&& echo x=1 test local /usr/bin /usr/bin test x=1 export /usr/bin --verbose
+		${HOME} 2>/dev/null grep export -eu /usr/bin
+| && x=1 sed | then sed /usr/bin export test $(pwd) 2>/dev/null test $(pwd)
+/usr/bin local -eu 2>/dev/null grep $(pwd) done
+		| done local | test echo cd awk && $(pwd) test done then grep readonly
+		test export done local test x=1 'quoted text' readonly
+	export | /usr/bin printf sed "$@" echo -eu readonly
+		sed && /usr/bin printf export sed "$@" local awk /usr/bin local 2>/dev/null
+x=1 $(pwd) ${HOME} awk echo printf "$@" | | 'quoted text'
+		export x=1 | x=1 'quoted text' | | printf echo ${HOME}
+	"$@" sed awk test "$@" sed echo "$@"
+		local export printf && && test 'quoted text'
+		&& x=1 x=1 local 'quoted text' "$@"
+	then printf cd x=1 awk then "$@" x=1 sed test --verbose export 2>/dev/null
+awk printf $(pwd) printf "$1" test --verbose /usr/bin
+		| echo --verbose test sed 2>/dev/null ${HOME} done
+	/usr/bin test | sed x=1 echo ${HOME} sed printf sed grep
+	grep -eu awk 2>/dev/null test "$1" "$1" echo then printf export grep
+	/usr/bin cd $(pwd) --verbose -eu printf sed
+		export "$1" 2>/dev/null $(pwd) -eu "$1" grep done 2>/dev/null awk && x=1
+	$(pwd) "$@" "$1" done sed "$1" sed ${HOME} ${HOME}
+	"$@" echo local $(pwd) -eu local "$@" /usr/bin /usr/bin --verbose 'quoted text'
+		local printf cd x=1 cd test local 2>/dev/null && readonly "$@" && sed --verbose
+&& done "$1" printf test cd local && cd echo $(pwd) 2>/dev/null 'quoted text'
+		&& grep $(pwd) cd --verbose grep $(pwd)
+grep ${HOME} awk grep -eu printf 2>/dev/null cd sed echo awk $(pwd) ${HOME} 2>/dev/null
+printf echo "$@" readonly "$@" then x=1 && grep && awk awk
+		printf /usr/bin cd awk then cd grep | export 'quoted text'
+local awk sed 2>/dev/null local && local awk && 'quoted text'
+		-eu export cd cd x=1 | printf export cd $(pwd) test cd -eu readonly export
+	&& x=1 --verbose then export
+"$1" sed printf export "$@" test test printf ${HOME} $(pwd) 'quoted text'
+	&& | ${HOME} --verbose local grep printf 'quoted text' then awk awk export
+	awk 'quoted text' | 2>/dev/null "$1" &&
+		readonly readonly ${HOME}
+	cd 2>/dev/null 'quoted text' /usr/bin cd -eu export local readonly ${HOME}
+		'quoted text' export export export
+		printf x=1 readonly echo ${HOME} "$@" x=1 x=1 test --verbose
+	grep readonly && done 'quoted text'
+	| done 'quoted text' | "$@" grep printf
+		grep then printf $(pwd) x=1 echo local
+	x=1 readonly --verbose cd echo test -eu then done &&
+		grep --verbose 2>/dev/null readonly "$@" -eu --verbose
+		readonly cd "$@" $(pwd) --verbose then done echo /usr/bin printf ${HOME} -eu
+		-eu "$@" $(pwd) printf "$@" printf printf cd
+"$1" done grep /usr/bin -eu awk x=1 sed readonly readonly -eu test
+	| && awk then cd printf local ${HOME} grep 2>/dev/null then then sed readonly sed
+		sed local "$1" ${HOME} "$1" echo printf then echo local
+	${HOME} local "$@" printf 2>/dev/null 2>/dev/null $(pwd) awk
+		export cd printf sed --verbose
+	-eu test sed sed 2>/dev/null export
+sed && done "$1" $(pwd) sed cd 2>/dev/null 'quoted text' printf printf
+		$(pwd) printf "$1" && export local -eu
+	"$1" "$1" x=1 done 2>/dev/null sed then printf sed done $(pwd)
+		-eu 2>/dev/null echo printf && | local 'quoted text' awk | then grep
+		then /usr/bin sed sed export $(pwd) 2>/dev/null
+		x=1 ${HOME} then grep | 2>/dev/null "$1" ${HOME} && cd -eu then
+	&& readonly 'quoted text' printf echo sed 'quoted text' local sed cd "$@" $(pwd)
+"$1" $(pwd) | && echo "$@" "$1" test --verbose "$@"
+--verbose "$@" "$@" grep ${HOME} 2>/dev/null readonly $(pwd) | | local sed
+	$(pwd) | cd 2>/dev/null done awk readonly ${HOME}
+		printf awk $(pwd) ${HOME} sed then -eu then
+echo /usr/bin test && echo printf cd test export then readonly cd |
+done ${HOME} ${HOME} grep
+awk | grep sed "$@" "$1" local "$1" "$@" local echo done /usr/bin printf echo
+	'quoted text' then "$1" test --verbose sed 2>/dev/null -eu | cd 'quoted text' |
+	"$@" 'quoted text' readonly | ${HOME} printf awk
+	'quoted text' 2>/dev/null
+	${HOME} sed | done --verbose done
+"$1" "$1" x=1 export export done ${HOME} 'quoted text' test awk
+	-eu printf test then ${HOME} "$1" cd
+		export | --verbose printf then export test readonly
+		test test /usr/bin test x=1 x=1 && -eu test /usr/bin then
+readonly local "$@" readonly | awk
+	x=1 "$@" "$1" $(pwd) 'quoted text' "$@" --verbose && $(pwd) "$1" -eu
+local readonly "$1" 2>/dev/null $(pwd) readonly --verbose
+| local $(pwd) -eu ${HOME} 2>/dev/null then
+		test then echo ${HOME} done echo test /usr/bin /usr/bin awk && /usr/bin
+sed "$1" && $(pwd) sed local /usr/bin local /usr/bin awk ${HOME} grep export printf
+		/usr/bin | x=1 && export "$1" "$@" /usr/bin ${HOME} then ${HOME} printf
+-eu "$@" printf local sed echo printf done /usr/bin readonly echo grep
+x=1 "$@" export 2>/dev/null ${HOME} export done $(pwd) ${HOME}
+&& grep | | local then local
+	&& grep $(pwd) | local done -eu -eu
+		${HOME} ${HOME} -eu | local grep
+"$@" ${HOME} -eu ${HOME}
+/usr/bin done grep -eu done awk ${HOME} | cd 2>/dev/null
+		"$@" cd ${HOME} echo export 'quoted text' export "$1"
+"$@" -eu "$@" 'quoted text'
+		"$@" readonly cd ${HOME} export ${HOME}
+sed 'quoted text' awk test done cd awk echo "$1" sed ${HOME} grep 2>/dev/null
+		awk grep done --verbose --verbose | $(pwd) 2>/dev/null -eu
+test 2>/dev/null -eu | grep sed sed "$1" x=1 awk then local then x=1 'quoted text'
+	printf | --verbose done | readonly
+readonly 2>/dev/null test -eu echo ${HOME} x=1 awk 'quoted text'
+		| cd test 2>/dev/null 'quoted text' done 'quoted text' --verbose "$1"
+	then cd local /usr/bin "$@" "$@" grep -eu echo printf awk done local --verbose
+		then export $(pwd) sed 'quoted text' | "$1" readonly
+	test sed done -eu "$@" x=1 grep local echo awk
+	printf awk ${HOME} cd x=1 2>/dev/null readonly /usr/bin 2>/dev/null
+readonly export test cd x=1 local
+		local readonly 'quoted text' sed
+	then "$1" sed ${HOME} then "$@" export printf
+	/usr/bin 'quoted text' "$1" local test
+		"$@" $(pwd) "$@" local "$@"
+		readonly /usr/bin test test "$1" cd readonly && cd
+	'quoted text' && awk x=1 | local && x=1 readonly $(pwd) 'quoted text' 2>/dev/null
+		--verbose "$@" -eu -eu local $(pwd) x=1 local export printf awk cd
+		test grep readonly then echo "$@" sed
+	'quoted text' | awk -eu ${HOME} && --verbose && export "$@" echo readonly
+		then local 2>/dev/null -eu awk -eu echo awk local $(pwd) grep
+	${HOME} && "$@" sed sed cd grep ${HOME} | then ${HOME}
+$(pwd) echo | grep ${HOME}
+	'quoted text' printf grep $(pwd) x=1 x=1 && printf && done ${HOME}
+		sed -eu ${HOME} -eu | then "$1"
+		export && x=1 awk cd "$@" "$@" --verbose --verbose grep 'quoted text'
+local /usr/bin readonly echo && local 2>/dev/null $(pwd) | ${HOME} then then
+	printf -eu done test /usr/bin test test local
+		local 2>/dev/null export | /usr/bin
+	cd printf cd ${HOME} 'quoted text' x=1 "$@" export
+	${HOME} local then "$@" "$1" 'quoted text' 2>/dev/null local cd
+2>/dev/null local readonly x=1 local cd
+	done ${HOME} sed then 2>/dev/null then
+"$1" printf "$@" awk "$1" export done awk done
+	x=1 "$@" && export $(pwd)
+'quoted text' /usr/bin done 'quoted text'
+	'quoted text' cd then x=1 | done readonly
+${HOME} readonly sed ${HOME} export && ${HOME} /usr/bin then "$1"
+"$1" "$@" printf --verbose ${HOME} 'quoted text' | && 'quoted text'
+	$(pwd) --verbose then
+&& done readonly done local -eu "$1" awk && then 2>/dev/null -eu export
+	then sed echo /usr/bin done --verbose
+then grep | awk ${HOME} awk
+	$(pwd) grep printf && export readonly
+		done local done ${HOME} /usr/bin x=1 readonly sed echo $(pwd) -eu echo --verbose
+		cd x=1 x=1 x=1 readonly
+		printf -eu --verbose echo cd $(pwd) then "$@"
+		done && then export && printf
+		local echo "$@" --verbose $(pwd) test 2>/dev/null /usr/bin && 2>/dev/null
+		echo done 2>/dev/null grep readonly -eu then 2>/dev/null
+--verbose echo "$@" cd echo grep local
+		grep /usr/bin | x=1 printf -eu done 2>/dev/null | grep -eu $(pwd)
+	echo --verbose export 'quoted text' /usr/bin /usr/bin x=1 --verbose && /usr/bin
+		/usr/bin cd printf sed 'quoted text'
+	done -eu 'quoted text' "$1" done
+readonly x=1 x=1 cd grep 2>/dev/null local
+		$(pwd) -eu grep 'quoted text' /usr/bin $(pwd)
+	"$@" -eu $(pwd) then done export
+local export | "$@" | readonly | x=1 echo
+then readonly x=1 test $(pwd)
+	2>/dev/null printf -eu $(pwd)
+	"$@" readonly && 'quoted text' --verbose readonly
+	${HOME} cd 'quoted text' sed awk export test /usr/bin
+		done "$1" then export ${HOME} -eu && test printf
+$(pwd) grep --verbose
+--verbose local --verbose test export $(pwd) | x=1 ${HOME} ${HOME} --verbose
+done echo local cd x=1 done local then sed x=1 readonly cd test then -eu awk cd
+	cd 'quoted text' local "$@" 'quoted text'
+		test test && grep "$@" ${HOME} 2>/dev/null
+export -eu done ${HOME} readonly grep -eu
+'quoted text' x=1 printf awk ${HOME} grep
+		/usr/bin && test /usr/bin -eu cd local --verbose
+"$@" --verbose 'quoted text' then
+	| then | -eu ${HOME} printf x=1 /usr/bin $(pwd)
+	&& export test export $(pwd) echo test "$1" $(pwd)
+	x=1 test 'quoted text' && sed /usr/bin export readonly
+		2>/dev/null export "$@" x=1 2>/dev/null ${HOME} awk
+| sed echo -eu && && test cd $(pwd) x=1
+		local readonly /usr/bin && | grep sed test | --verbose
+		x=1 ${HOME} | export then grep
+		/usr/bin "$@" sed $(pwd) "$1" ${HOME}
+	'quoted text' local then test then x=1 $(pwd) $(pwd) local export
+export --verbose export && /usr/bin local --verbose awk ${HOME} x=1 awk
+		then export -eu "$@" test /usr/bin readonly
+"$1" export "$1" done "$@" "$@" x=1 "$@" --verbose done sed local awk ${HOME} --verbose
+		readonly awk && cd echo -eu --verbose local
+		2>/dev/null printf 'quoted text' sed printf sed sed local grep 'quoted text'
+		grep 2>/dev/null x=1 x=1 test && --verbose --verbose $(pwd)
+awk --verbose x=1 -eu && cd cd 2>/dev/null local | 'quoted text' -eu 2>/dev/null
+		test readonly x=1 ${HOME} ${HOME}
+	${HOME} export readonly then 'quoted text' "$@" readonly
+export $(pwd) -eu --verbose
+	| readonly sed 'quoted text'
+	-eu export 2>/dev/null $(pwd) local x=1 "$1" awk local awk /usr/bin 'quoted text'
+--verbose "$1" local readonly
+		2>/dev/null | sed "$@"
+		printf export --verbose local then echo --verbose ${HOME}
+		2>/dev/null echo 'quoted text'
+		/usr/bin local grep ${HOME}
+	printf 'quoted text'
+x=1 2>/dev/null done
+then ${HOME} export x=1 test $(pwd) awk $(pwd) test
+		${HOME} local "$1" grep
+	done cd --verbose "$@" cd done export && printf | --verbose
+		test awk export 'quoted text' test "$1" readonly echo -eu "$@"
+	&& echo --verbose $(pwd) /usr/bin
+	awk grep awk -eu then
+	readonly readonly test grep x=1
+awk --verbose local $(pwd) local $(pwd) done awk cd printf 'quoted text'
+done x=1 export && "$1" "$@" grep | "$1" done printf
+"$@" --verbose $(pwd) | readonly done local
+	"$1" x=1 "$1" --verbose local && export grep awk "$1" printf
+--verbose 2>/dev/null x=1
+		/usr/bin printf && local local ${HOME} done ${HOME}
+cd "$@" awk "$1" done x=1 sed export printf -eu done
+	test "$@" -eu local ${HOME} printf
+	"$1" ${HOME} "$@" 2>/dev/null then x=1 "$1" done local "$1" local cd
+		x=1 export local echo cd local sed
+echo x=1 2>/dev/null sed readonly printf done done sed readonly "$@" done
+	done then $(pwd) test echo $(pwd) local ${HOME} echo cd 'quoted text' && done
+	echo local cd /usr/bin x=1 sed "$@"
+sed cd then && "$@" x=1 sed 2>/dev/null && test cd
+	readonly printf test then "$1" grep 'quoted text' -eu done readonly x=1 /usr/bin
+	awk && 'quoted text' --verbose echo $(pwd) /usr/bin
+readonly cd --verbose printf &&
+"$@" printf local x=1 readonly cd && $(pwd) export
+	--verbose printf local 2>/dev/null
+		done readonly --verbose -eu "$1" 'quoted text' 2>/dev/null ${HOME} sed --verbose
+		awk /usr/bin echo /usr/bin
+	/usr/bin $(pwd) cd | sed sed ${HOME} && --verbose done readonly then -eu
+printf 2>/dev/null "$@" local
+		"$1" echo ${HOME} readonly | x=1 x=1 test
+"$@" cd "$@" echo $(pwd) then ${HOME} export echo readonly "$@" 2>/dev/null
+	x=1 -eu x=1 cd 'quoted text' printf done -eu sed awk 2>/dev/null
+		grep then awk --verbose printf grep export | awk 2>/dev/null
+	--verbose 2>/dev/null echo "$1" export then printf 2>/dev/null
+		'quoted text' --verbose done /usr/bin /usr/bin
+printf cd | | && --verbose /usr/bin "$@" local readonly test test then 2>/dev/null
+'quoted text' --verbose grep ${HOME} then --verbose sed "$1" local local awk grep
+	--verbose awk 2>/dev/null sed
+	'quoted text' test "$1" printf readonly
+	2>/dev/null readonly 'quoted text' x=1 test printf done local /usr/bin
+awk 'quoted text' export cd 'quoted text'
+		"$@" "$@" --verbose 'quoted text' export
+		$(pwd) readonly $(pwd) -eu | done sed 'quoted text' awk -eu
+		x=1 && 'quoted text' "$1" -eu | awk x=1 cd printf export local test
+printf readonly | --verbose 2>/dev/null $(pwd) 2>/dev/null
+	--verbose test readonly | /usr/bin
+		readonly -eu export cd --verbose
+		&& x=1 && local x=1 -eu &&
+	then ${HOME} awk then local /usr/bin echo
+then printf echo --verbose echo /usr/bin
+	| ${HOME} done local --verbose readonly
+		printf done grep awk "$@" $(pwd) cd readonly -eu "$1" done echo 2>/dev/null
+	"$@" cd echo test /usr/bin grep | x=1 $(pwd)
+cd awk readonly "$1" /usr/bin
+| 2>/dev/null /usr/bin readonly sed printf local "$@" readonly
+	readonly awk ${HOME} awk sed export test $(pwd) test done 'quoted text'
+	done awk x=1 cd export readonly --verbose x=1 'quoted text' echo sed 2>/dev/null
+	echo $(pwd) awk x=1 export "$@"
+done grep local x=1 $(pwd) echo awk echo --verbose
+		then "$@" awk local x=1 --verbose 'quoted text' then
+	awk echo x=1 echo sed 2>/dev/null
+	sed && && printf echo cd --verbose export ${HOME} grep 'quoted text'
+&& then ${HOME} /usr/bin | sed -eu test "$@" awk then awk readonly sed
+	local x=1 /usr/bin grep x=1 2>/dev/null cd $(pwd) awk cd printf ${HOME}
+	done export test awk "$1" done grep "$@" test grep cd
+	&& && $(pwd) grep export awk $(pwd) sed test x=1 -eu cd /usr/bin echo $(pwd) "$1"
+cd grep done | local --verbose ${HOME} echo local echo then
+	'quoted text' ${HOME} grep grep then $(pwd) awk echo awk test
+'quoted text' 2>/dev/null 'quoted text' $(pwd)
+	test x=1 echo /usr/bin x=1 echo x=1 test "$1"
+local echo 2>/dev/null done | -eu awk awk 2>/dev/null then ${HOME}
+	sed -eu ${HOME} "$@" "$1"
+		grep then | ${HOME} "$@" cd | grep printf /usr/bin 2>/dev/null
+test awk -eu $(pwd) && printf then sed x=1 --verbose done then printf
+		'quoted text' sed 2>/dev/null 'quoted text' grep printf $(pwd) ${HOME} printf
+	"$@" /usr/bin x=1 | done -eu | test export "$1" export sed
+		${HOME} cd $(pwd) -eu /usr/bin grep "$1" -eu local "$1" && x=1 awk /usr/bin
+	"$@" $(pwd) printf local test export printf printf test then grep
+		-eu test --verbose test --verbose
+	"$@" local done export $(pwd) $(pwd) readonly echo $(pwd) 'quoted text' /usr/bin
+		'quoted text' | local grep test /usr/bin && readonly && then 2>/dev/null
+awk /usr/bin grep awk x=1 /usr/bin --verbose /usr/bin awk "$1" cd "$@"
+		cd --verbose grep 'quoted text'
+		'quoted text' local echo grep printf
+&& cd echo done printf sed 'quoted text' then then readonly awk 'quoted text'
+x=1 readonly 2>/dev/null sed 'quoted text' local x=1 | grep echo
+	'quoted text' 'quoted text' -eu local test cd awk awk "$1"
+	"$1" local printf printf "$1" export then "$1" echo -eu local 'quoted text'
+		&& && cd 2>/dev/null --verbose && --verbose
+		test local $(pwd) "$@" 2>/dev/null cd sed awk sed
+		export done then then -eu local /usr/bin cd "$1"
+		readonly -eu local x=1 test local /usr/bin awk
+	-eu && export cd $(pwd) awk $(pwd) awk local -eu echo done 'quoted text'
+		&& echo "$1" "$1" $(pwd) then "$1" 2>/dev/null | /usr/bin 2>/dev/null local &&
+$(pwd) | "$1" export 2>/dev/null readonly
+| 'quoted text' --verbose | awk -eu printf done 2>/dev/null echo
+	"$1" readonly /usr/bin ${HOME} /usr/bin && awk
+	printf -eu test then && printf grep /usr/bin x=1 echo local
+	| $(pwd) "$@" x=1 && sed readonly $(pwd) echo "$1" --verbose
+	local /usr/bin $(pwd) done 2>/dev/null
+		${HOME} --verbose test local export $(pwd) x=1 | /usr/bin 'quoted text'
+		"$@" readonly --verbose cd test then $(pwd)
+		local readonly "$1" cd | grep done cd "$@" x=1 /usr/bin readonly 'quoted text'
+		2>/dev/null ${HOME} --verbose x=1
+then echo "$@" export local | $(pwd) ${HOME} --verbose printf
+		echo 2>/dev/null grep printf
+	grep test then printf 'quoted text' ${HOME} | 2>/dev/null 'quoted text' grep &&
+${HOME} then cd export grep local x=1 grep 2>/dev/null ${HOME} 'quoted text' "$1"
+then -eu sed export awk | x=1 awk $(pwd) done 'quoted text' /usr/bin cd
+"$1" ${HOME} -eu $(pwd) sed readonly $(pwd)
+		printf grep "$1" then "$@" "$1" /usr/bin | echo export export "$1" echo "$@"
+cd /usr/bin 2>/dev/null --verbose
+	| && grep test export then
+readonly awk printf readonly "$1" "$1" 'quoted text' "$@" -eu
+	"$@" printf --verbose test x=1
+		$(pwd) sed 'quoted text'
+		"$@" local awk 'quoted text' $(pwd) && && $(pwd) done
+		grep -eu 2>/dev/null "$@" printf 2>/dev/null printf then readonly 2>/dev/null
+		'quoted text' cd | | "$1" && /usr/bin
+grep ${HOME} --verbose ${HOME} awk grep |
+	"$1" export | $(pwd) /usr/bin test export grep 2>/dev/null readonly local
+${HOME} "$@" echo cd --verbose
+--verbose 'quoted text' test
+	$(pwd) 2>/dev/null 'quoted text'
+	--verbose export local cd /usr/bin export
+	/usr/bin readonly printf --verbose printf then "$1" /usr/bin then 'quoted text'
+	| readonly export local $(pwd)
+		then readonly grep 2>/dev/null readonly local local 2>/dev/null
+		$(pwd) sed local "$@" x=1 then echo --verbose
+	-eu echo awk grep | then then "$@" printf local 2>/dev/null
+		"$@" cd sed test "$@" "$1" sed "$@"
+		echo "$@" "$@" /usr/bin
+		done awk && ${HOME} && /usr/bin done | --verbose
+		local export then printf 2>/dev/null printf readonly
+'quoted text' /usr/bin ${HOME} "$@" then | done
+	--verbose 2>/dev/null 'quoted text' -eu sed 2>/dev/null
+		"$1" | "$@" 2>/dev/null then
+grep readonly $(pwd) ${HOME} 'quoted text'
+		&& awk 2>/dev/null --verbose && echo 2>/dev/null -eu -eu test x=1
+"$1" readonly $(pwd) sed export
+	test sed | local done "$@" ${HOME} $(pwd) -eu
+	$(pwd) | local export echo x=1 --verbose echo x=1 x=1
+		"$@" | grep "$1" printf readonly x=1 sed sed awk /usr/bin --verbose
+	"$@" "$1" 2>/dev/null readonly readonly local
+		"$@" grep printf sed $(pwd) local /usr/bin printf
+	sed /usr/bin -eu 2>/dev/null sed /usr/bin
+		"$@" grep 'quoted text' grep ${HOME} $(pwd) then "$@" | /usr/bin then local |
+	| then "$@" -eu echo -eu "$1" grep x=1 echo $(pwd) readonly
+${HOME} && export sed awk | echo && awk printf sed 2>/dev/null "$1"
+-eu local --verbose 2>/dev/null ${HOME} /usr/bin sed
+/usr/bin && /usr/bin test $(pwd) local done --verbose echo
+${HOME} printf -eu x=1 ${HOME}
+${HOME} printf $(pwd) ${HOME} && done && local 2>/dev/null readonly cd 2>/dev/null
+	export 'quoted text' /usr/bin local export printf then ${HOME} awk
+		&& 2>/dev/null && && | x=1 printf local cd export export then 'quoted text' &&
+	${HOME} export then sed readonly "$1" cd local grep cd 2>/dev/null
+	${HOME} done --verbose echo sed --verbose cd /usr/bin x=1 local && cd
+		${HOME} --verbose export 2>/dev/null "$1" grep
+	2>/dev/null "$@" --verbose
+	cd then /usr/bin printf "$@" ${HOME} awk readonly done
+		2>/dev/null | grep /usr/bin readonly
+"$1" 2>/dev/null local readonly "$1" | done --verbose grep export /usr/bin
+/usr/bin "$@" $(pwd) && local $(pwd) test printf
+		x=1 local local x=1 awk 2>/dev/null readonly printf printf -eu local
+readonly readonly ${HOME} done grep 2>/dev/null then "$1" $(pwd) 2>/dev/null
+${HOME} "$1" test grep x=1 then sed && $(pwd)
+		local | sed "$@" /usr/bin then export printf echo then 'quoted text' x=1 $(pwd)
+		| local $(pwd) ${HOME} 2>/dev/null export --verbose
+cd then --verbose readonly grep cd --verbose && cd then then grep
+| readonly readonly awk done
+		/usr/bin echo cd $(pwd) "$1" 'quoted text' cd $(pwd) then "$@" | && --verbose
+		readonly sed sed test local grep export ${HOME} export x=1 cd sed "$@" sed printf
+-eu -eu local $(pwd) echo --verbose 2>/dev/null 2>/dev/null
+	grep "$@" echo 'quoted text' 2>/dev/null 2>/dev/null
+"$@" "$1" x=1 | readonly echo
+local -eu cd then local then cd | awk
+	local test -eu 'quoted text' awk printf 2>/dev/null
+${HOME} done $(pwd) grep $(pwd) awk local && done 'quoted text' x=1 grep echo
+		printf then sed 'quoted text' sed
+2>/dev/null done printf | && && "$@" printf 'quoted text' $(pwd) export
+		'quoted text' && $(pwd) 2>/dev/null test local local
+&& sed 2>/dev/null export printf awk
+	echo readonly --verbose echo "$1" sed done 2>/dev/null "$1" ${HOME}
+	awk 'quoted text' ${HOME} $(pwd) done ${HOME} && x=1 "$1" "$@"
+		x=1 then && ${HOME} echo && | "$@" 'quoted text'
+printf 2>/dev/null $(pwd) "$@" awk test
+printf done echo test "$@" grep
+	$(pwd) /usr/bin "$1" done done awk
+	grep done awk ${HOME} cd export printf ${HOME} test sed sed grep local done
+	sed export awk grep 2>/dev/null then awk && done | printf
+--verbose export done 'quoted text'
+${HOME} | printf awk | 2>/dev/null test x=1 x=1 grep --verbose readonly "$1"
+		echo -eu printf ${HOME} sed 'quoted text' export
+--verbose readonly export cd readonly
+	"$@" | grep sed grep readonly ${HOME} grep sed x=1
+x=1 && local "$@" | echo 2>/dev/null local sed 2>/dev/null local
+awk grep ${HOME} awk local printf
+	test | awk then "$1" test then export sed echo && x=1 done -eu
+	readonly $(pwd) test 2>/dev/null 'quoted text'
+	"$1" export export local done 2>/dev/null printf readonly sed done sed export
+		echo "$@" --verbose awk awk local done "$@" --verbose export | awk printf
+		sed grep grep then && export -eu echo $(pwd) local grep $(pwd)
+	sed test echo done ${HOME} local local awk 'quoted text' /usr/bin
+	then printf readonly awk awk 'quoted text'
+		"$@" sed cd echo 'quoted text' /usr/bin echo echo
+export && $(pwd) 'quoted text' awk grep -eu done 'quoted text'
+	test cd test grep --verbose && cd test local echo | then printf && awk
+	'quoted text' --verbose local $(pwd) readonly local "$@" x=1 export echo
+"$1" local test x=1 x=1
+	| /usr/bin 2>/dev/null --verbose
+--verbose grep $(pwd) echo -eu 2>/dev/null "$1" export grep | x=1 /usr/bin
+	cd | then | | $(pwd) readonly -eu done "$@" "$@" x=1 "$1" then
+echo readonly 'quoted text' 'quoted text'
+	cd ${HOME} x=1 test x=1 "$@" x=1 export
+		| grep echo "$@" grep 2>/dev/null
+		"$@" x=1 cd readonly done readonly export --verbose done done 'quoted text'
+local test readonly done "$@" /usr/bin cd "$@" &&
+sed "$1" --verbose awk x=1 --verbose printf 'quoted text' | x=1 2>/dev/null
+		&& awk 'quoted text' then echo echo export readonly local "$1"
+	| 2>/dev/null sed x=1 /usr/bin
+x=1 done 'quoted text' echo
+"$@" then -eu grep echo grep | export
+		cd x=1 then cd readonly readonly
+	grep /usr/bin sed --verbose cd | x=1 /usr/bin ${HOME} x=1 "$@" "$1" echo &&
+	readonly echo $(pwd) then x=1 | x=1 then local test --verbose "$@"
+	then | && ${HOME} "$@" sed && export $(pwd) printf readonly local echo ${HOME}
+printf readonly $(pwd)
+		--verbose cd sed grep "$@" done then sed then cd done readonly "$@" grep "$@"
+		local && "$1" | done "$1"
+'quoted text' --verbose cd sed
+"$1" local "$@" local then test --verbose ${HOME} "$@" grep | export
+sed then -eu echo 2>/dev/null
+		sed echo --verbose awk x=1 "$@" test x=1 echo awk "$1" then $(pwd) then
+		test awk sed x=1 'quoted text' printf done ${HOME} /usr/bin -eu local && export
+		x=1 $(pwd) printf /usr/bin
+printf readonly -eu printf done 2>/dev/null test local x=1 $(pwd)
+	local test ${HOME} -eu --verbose test x=1 && echo
+printf awk sed && $(pwd) ${HOME}
+export grep awk ${HOME} | 'quoted text' ${HOME} done printf grep
+	cd cd readonly 2>/dev/null && local
+		2>/dev/null --verbose grep printf
+		-eu grep "$@" x=1 export $(pwd) test 'quoted text' "$@" "$@"
+2>/dev/null 'quoted text' cd readonly
+/usr/bin test test readonly then ${HOME}
+		cd readonly export awk printf
+sed $(pwd) x=1 | "$1" --verbose printf && 'quoted text' cd then readonly
+		echo echo local ${HOME}
+	2>/dev/null local local && $(pwd) 'quoted text' export 2>/dev/null done --verbose
+		'quoted text' test && grep grep && $(pwd)
+-eu 2>/dev/null 2>/dev/null echo "$@" 'quoted text' x=1 "$@" ${HOME} printf readonly
+2>/dev/null 2>/dev/null sed local readonly ${HOME} --verbose grep | $(pwd) x=1
+	grep "$@" export done 'quoted text' -eu x=1 cd --verbose export ${HOME} test
+done sed $(pwd) awk $(pwd) test readonly echo
+		| --verbose --verbose x=1 | cd local |
+cd 2>/dev/null done && "$@" done
+	awk ${HOME} x=1 export export
+		sed awk 2>/dev/null ${HOME}
+		/usr/bin awk awk ${HOME} "$1" export sed echo "$@" readonly ${HOME}
+	'quoted text' grep cd cd --verbose done cd echo
+2>/dev/null 'quoted text' grep awk $(pwd) sed local x=1 done "$1" awk 'quoted text'
+${HOME} | -eu test 'quoted text' test echo export /usr/bin awk echo done
+	${HOME} "$1" -eu export 'quoted text' printf cd ${HOME}
+		| 'quoted text' printf
+		/usr/bin $(pwd) ${HOME} echo awk x=1 export local export
+		--verbose && | cd printf --verbose printf
+	done x=1 printf test --verbose then readonly awk $(pwd) "$@"
+	awk awk "$1" done then local printf --verbose export 2>/dev/null
+	sed ${HOME} "$@" done echo /usr/bin | "$@" cd local done
+		"$@" readonly --verbose local /usr/bin x=1 "$@" grep done 'quoted text'
+		cd then readonly echo --verbose printf x=1 x=1 sed readonly "$1"
+		grep grep printf /usr/bin "$@" x=1 cd awk sed | echo sed echo awk 'quoted text'
+	export then -eu done && x=1 ${HOME} && "$@" cd && && local && /usr/bin
+	/usr/bin sed sed /usr/bin readonly local ${HOME}
+	then "$@" /usr/bin && /usr/bin export -eu ${HOME} "$1" x=1 $(pwd) /usr/bin
+		printf -eu echo export
+x=1 sed printf ${HOME} export awk --verbose
+	--verbose $(pwd) then
+	local --verbose "$1" printf printf x=1 done sed echo | readonly done ${HOME}
+		printf test echo local && grep sed cd printf
+	-eu 2>/dev/null -eu /usr/bin export 2>/dev/null
+		sed sed done /usr/bin awk export then done cd done x=1
+	local printf $(pwd) 2>/dev/null
+		2>/dev/null then "$1" 2>/dev/null test && grep done done done test
+		2>/dev/null 2>/dev/null
+		&& then ${HOME} sed "$@" "$@" 2>/dev/null cd export x=1 2>/dev/null
+$(pwd) awk 'quoted text' | --verbose local -eu | printf --verbose
+	cd then export ${HOME} export
+"$@" -eu x=1 grep grep then export "$1"
+	&& echo awk grep local 2>/dev/null echo echo $(pwd) done /usr/bin
+		then ${HOME} /usr/bin | cd test test sed && readonly | printf -eu then then
+		echo 'quoted text' $(pwd) cd x=1
+/usr/bin ${HOME} sed awk --verbose /usr/bin done test "$1"
+	export $(pwd) 'quoted text' local 2>/dev/null echo cd sed echo grep /usr/bin
+		awk export /usr/bin --verbose test local /usr/bin 2>/dev/null | && cd
+echo echo echo sed grep cd grep grep ${HOME} then local ${HOME} test printf x=1
+		"$1" printf done 'quoted text' /usr/bin
+	&& echo grep 'quoted text' test then -eu echo local 2>/dev/null /usr/bin
+	'quoted text' echo $(pwd) grep "$@" -eu export /usr/bin
+	"$@" && ${HOME} | | x=1 | "$1"
+	echo done grep | test | && awk /usr/bin echo local
+		'quoted text' done printf done "$@" printf echo
+	| cd && then $(pwd) readonly 2>/dev/null local echo then --verbose echo awk
+then 'quoted text' printf "$1" then awk echo 2>/dev/null grep cd "$1"
+	x=1 cd -eu done export done sed then cd test &&
+'quoted text' export "$1" /usr/bin awk awk done | 'quoted text'
+		--verbose grep "$@" "$1" "$1" readonly export
+		grep ${HOME} sed "$@" export export x=1 2>/dev/null readonly test ${HOME}
+then /usr/bin then "$1" --verbose 'quoted text'
+#include c3.sh
+	export 'quoted text' readonly export 2>/dev/null echo echo | --verbose echo
+	then test /usr/bin then | /usr/bin
+	&& 2>/dev/null | then local sed local "$@" cd "$@" awk local $(pwd)
+		2>/dev/null -eu $(pwd) $(pwd) "$@" grep && x=1 -eu && local | cd "$1" printf
+| && cd && grep grep awk
+		cd "$1" "$1" "$@" ${HOME}
+		local readonly cd grep then 'quoted text' && 'quoted text'
+	${HOME} sed cd 'quoted text' cd cd readonly
+		sed | cd $(pwd) cd local ${HOME} /usr/bin
+'quoted text' test ${HOME} readonly printf "$@" test grep -eu done printf 2>/dev/null
+/usr/bin then "$@" done "$@" test -eu |
+x=1 /usr/bin awk local export awk awk
+	/usr/bin sed export --verbose /usr/bin ${HOME} "$@"
+	local 'quoted text' export readonly sed -eu export 'quoted text' grep /usr/bin export
+	-eu printf readonly cd cd grep test printf done sed $(pwd) sed echo done printf
+'quoted text' local echo
+then echo done grep 'quoted text' 'quoted text' sed --verbose export
+	awk --verbose ${HOME} 'quoted text' test 'quoted text' -eu readonly echo
+		&& printf printf 'quoted text' sed x=1 x=1 ${HOME} export x=1 then echo
+	"$@" --verbose --verbose
+"$1" echo $(pwd) -eu readonly export && local | then test "$@" "$1"
+		-eu | "$1" sed echo -eu done "$1" awk readonly && -eu printf
+/usr/bin $(pwd) then then done then done then cd --verbose export test
+	2>/dev/null $(pwd) && cd "$@" cd export cd sed printf export cd done
+	printf 'quoted text' sed local "$@" export
+		done x=1 printf test x=1 "$1" 2>/dev/null && && | sed
+	&& then readonly -eu grep 2>/dev/null echo 2>/dev/null
+'quoted text' echo 2>/dev/null -eu readonly
+echo "$@" test grep $(pwd) -eu
+		"$1" awk awk --verbose $(pwd) printf | 2>/dev/null sed x=1 $(pwd) | test sed
+		sed sed "$1" export local grep x=1 readonly
+	export /usr/bin test cd 2>/dev/null 'quoted text'
+done cd local grep grep done printf && 'quoted text' ${HOME} local
+	"$@" done done && then "$@" $(pwd) /usr/bin local |
+	export "$1" 'quoted text' 2>/dev/null done local export "$@" --verbose test
+done --verbose /usr/bin --verbose export $(pwd) local 'quoted text' x=1 'quoted text'
+${HOME} local -eu awk "$@" | sed "$1" 2>/dev/null export
+	cd | $(pwd) readonly local $(pwd) awk | awk
+	readonly 'quoted text' sed 'quoted text' echo && printf /usr/bin sed -eu
+$(pwd) done awk printf sed grep && then $(pwd) printf 'quoted text'
+-eu local | readonly "$1" awk x=1
+		'quoted text' then /usr/bin export && local
+		cd && printf 2>/dev/null 2>/dev/null
+test cd sed && printf grep $(pwd) 2>/dev/null awk && && /usr/bin printf
+	grep -eu local && 'quoted text' export local awk ${HOME} awk local | ${HOME}
+/usr/bin | -eu readonly grep | cd "$@" ${HOME} readonly $(pwd)
+		x=1 'quoted text' sed $(pwd)
+		test grep && $(pwd) ${HOME} /usr/bin then "$1" echo printf "$@" then
+		cd 'quoted text' printf 2>/dev/null -eu sed | printf awk
+	printf "$@" echo cd ${HOME} cd 'quoted text' && readonly test grep local printf
+		$(pwd) sed printf grep export "$1" export cd test ${HOME}
+local /usr/bin "$@" printf awk "$@" | done sed sed done 'quoted text' echo
+		awk printf "$1" 'quoted text' /usr/bin
+		then echo printf done cd export "$1" $(pwd)
+${HOME} "$1" "$@" cd then --verbose x=1 done "$1" then awk -eu --verbose
+		cd --verbose grep awk cd awk /usr/bin "$1" ${HOME} sed /usr/bin
+	$(pwd) $(pwd) $(pwd) | $(pwd) $(pwd)
+	then awk then awk 'quoted text' $(pwd) echo
+	readonly /usr/bin export then done | -eu "$@" x=1 sed x=1 readonly 2>/dev/null
+		${HOME} then readonly sed sed 2>/dev/null
+	cd | x=1 $(pwd) test -eu sed "$1" cd "$1" awk /usr/bin local | --verbose
+"$1" then export sed readonly
+		"$1" --verbose --verbose awk | local echo x=1 x=1 | done
+awk ${HOME} done "$@" sed cd && /usr/bin --verbose cd 2>/dev/null | awk ${HOME}
+	--verbose printf grep ${HOME} "$1" sed "$@" export x=1 ${HOME} | x=1
+		2>/dev/null awk x=1 && 2>/dev/null
+sed cd export cd ${HOME} "$1" printf ${HOME} grep "$@" done
+$(pwd) "$1" x=1 printf "$1" awk "$@"
+		$(pwd) then readonly && test "$1" test && | printf then
+sed "$@" 2>/dev/null sed 'quoted text' 'quoted text' awk $(pwd) done
+		/usr/bin cd ${HOME} export awk local --verbose /usr/bin
+then "$@" $(pwd) /usr/bin test ${HOME} $(pwd)
+"$@" then cd "$@" -eu sed then "$@"
+	'quoted text' echo cd "$@" $(pwd) ${HOME}
+x=1 done "$@" --verbose x=1 2>/dev/null export sed
+		grep --verbose cd done grep && /usr/bin sed -eu then
+		$(pwd) local readonly readonly --verbose readonly cd | printf 'quoted text'
+	$(pwd) | echo 'quoted text' --verbose then 'quoted text' grep /usr/bin readonly
+	&& readonly local sed done local x=1 echo readonly local printf 'quoted text'
+	/usr/bin test test x=1 echo $(pwd) sed test "$1" "$1"
+2>/dev/null /usr/bin done && readonly local grep
+| test --verbose $(pwd) cd cd grep "$@" -eu export readonly sed 'quoted text'
+	readonly --verbose | readonly
+		then then then sed cd readonly "$1" echo readonly readonly readonly
+| "$@" 'quoted text' local then --verbose && 'quoted text' cd $(pwd)
+		"$@" && done 'quoted text' "$1" export test x=1 awk "$1" |
+	x=1 2>/dev/null grep local ${HOME}
+cd $(pwd) $(pwd) "$1" ${HOME} printf test 'quoted text' done done readonly
+2>/dev/null grep 'quoted text' && cd --verbose export ${HOME} cd local
+	2>/dev/null cd local --verbose 2>/dev/null printf | && 'quoted text'
+	local 'quoted text' 'quoted text' then 2>/dev/null cd
+		"$@" printf "$1" && $(pwd) sed "$@" 2>/dev/null grep "$@" ${HOME}
+		&& readonly done | done export $(pwd) readonly readonly then
+2>/dev/null /usr/bin && 'quoted text' && local local "$@"
+done x=1 then done | 2>/dev/null then 2>/dev/null | export
+	--verbose printf export
+		local done "$1" export readonly local done
+		--verbose export /usr/bin
+test 2>/dev/null "$@" then readonly local x=1 sed && grep 'quoted text'
+		"$1" x=1 awk -eu "$@" then cd && 2>/dev/null 'quoted text'
+	${HOME} -eu && sed && cd $(pwd) printf ${HOME} 'quoted text' cd | grep
+		"$@" done test sed readonly "$@" grep printf x=1 readonly
+sed cd 'quoted text' | && x=1 --verbose local "$@" sed x=1 'quoted text'
+| "$@" sed && | readonly grep | cd cd | test done 2>/dev/null "$1"
+	test sed "$1" grep x=1 sed
+		"$1" "$@" sed grep then cd "$1" grep printf test -eu grep printf export && sed
+	then x=1 test && $(pwd) printf awk /usr/bin
+	&& 'quoted text' cd done awk "$1" export grep 2>/dev/null | echo
+export grep "$1" | && --verbose ${HOME}
+then printf done --verbose export printf export && export grep readonly
+		/usr/bin && $(pwd) echo test && sed -eu --verbose sed $(pwd)
+		grep 2>/dev/null 2>/dev/null then --verbose --verbose sed ${HOME}
+	done sed then export printf "$1" "$@" done printf awk 2>/dev/null "$1"
+		cd "$1" "$@" "$@" export readonly "$1"
+		grep x=1 awk readonly x=1 printf
+| 'quoted text' "$@" 2>/dev/null "$@" -eu cd local local
+awk sed | 2>/dev/null sed --verbose 2>/dev/null
+		awk $(pwd) -eu printf test ${HOME} x=1 "$1" $(pwd) awk export 'quoted text'
+		--verbose 'quoted text' local "$1" "$@" -eu test local
+	awk 2>/dev/null "$@" $(pwd)
+		sed x=1 'quoted text' $(pwd) && 'quoted text'
+x=1 | | "$1" 2>/dev/null && | --verbose awk done /usr/bin x=1 printf
+		2>/dev/null /usr/bin 2>/dev/null grep printf
+		--verbose "$1" readonly echo local grep local cd
+		awk sed printf "$@" "$@" printf $(pwd) -eu 2>/dev/null local cd
+		-eu sed 2>/dev/null test
+		echo ${HOME} local 'quoted text' local -eu test ${HOME}
+		&& printf x=1 printf "$1" /usr/bin /usr/bin export /usr/bin
+		sed test local test printf awk awk "$@" local "$@" grep ${HOME} | ${HOME} --verbose
+$(pwd) x=1 grep x=1 --verbose -eu --verbose
+$(pwd) --verbose ${HOME} 'quoted text'
+awk done 2>/dev/null readonly "$1" grep --verbose printf 'quoted text' test "$1"
+		then then /usr/bin echo test done export sed $(pwd) local grep 2>/dev/null --verbose
+grep $(pwd) grep grep "$1" export 2>/dev/null
+"$@" then --verbose echo sed | x=1 $(pwd) awk ${HOME} done $(pwd) 2>/dev/null
+	-eu echo test ${HOME} local ${HOME} readonly 2>/dev/null && -eu |
+		&& cd awk local grep printf echo readonly "$1" export awk "$@" grep
+	--verbose && /usr/bin ${HOME}
+		x=1 printf "$1" echo /usr/bin local $(pwd) --verbose
+printf done x=1 --verbose 'quoted text'
+	| "$1" readonly ${HOME} grep export export local
+		2>/dev/null "$@" && readonly awk | 2>/dev/null -eu 2>/dev/null
+then && -eu x=1 export cd "$1"
+	grep cd | export x=1 /usr/bin echo --verbose x=1 grep 2>/dev/null printf awk
+	done then then then "$@" readonly readonly echo local /usr/bin | 'quoted text' export
+&& 2>/dev/null ${HOME} "$@" | done
+	then printf test | printf printf
+	export then done | awk sed cd awk "$@" -eu local -eu 'quoted text' "$@" grep
+x=1 cd "$1" export --verbose
+	| local /usr/bin /usr/bin done awk readonly printf "$@"
+'quoted text' test && done echo
+readonly x=1 'quoted text' then grep "$@" | -eu awk x=1 readonly && done test
+	readonly echo cd echo cd 'quoted text' 2>/dev/null export done grep 2>/dev/null
+	local /usr/bin "$@" -eu
+test readonly | awk export
+		test -eu "$1" x=1 echo /usr/bin export
+	printf && test sed echo awk echo awk readonly done
+		sed test cd then then then then x=1 2>/dev/null export test ${HOME}
+${HOME} done export test
+	echo $(pwd) then readonly $(pwd)
+'quoted text' sed ${HOME} awk local "$1"
+"$@" x=1 | export | ${HOME} echo --verbose cd awk export -eu ${HOME}
+done $(pwd) && "$1" ${HOME} cd export $(pwd)
+	/usr/bin ${HOME} printf export 2>/dev/null 2>/dev/null printf awk
+	done x=1 "$@" done export test printf readonly "$@" $(pwd) ${HOME} export awk x=1
+printf awk -eu 'quoted text' awk
+export test sed then awk -eu x=1 x=1 done | ${HOME} --verbose
+		readonly "$@" --verbose | export echo ${HOME} printf grep
+		&& ${HOME} "$1" then 'quoted text' then x=1 ${HOME}
+-eu cd | local awk x=1 x=1 | done
+	-eu | 2>/dev/null -eu x=1 "$@" $(pwd) -eu grep grep
+local 'quoted text' ${HOME} awk then test x=1 export sed grep | $(pwd)
+	"$1" /usr/bin x=1 cd -eu "$1" printf $(pwd)
+		echo x=1 cd --verbose echo -eu -eu /usr/bin done | -eu
+	/usr/bin --verbose $(pwd) /usr/bin echo grep 2>/dev/null export done echo
+		printf "$1" grep ${HOME} grep grep --verbose "$1" -eu 'quoted text' ${HOME}
+local cd "$1" local readonly export && "$@" grep sed export
+	| | local 'quoted text' sed readonly sed &&
+	"$1" --verbose "$1" local /usr/bin then x=1 echo cd
+readonly "$1" done done local grep 'quoted text' -eu cd printf
+"$1" sed echo /usr/bin "$1" ${HOME} then $(pwd) $(pwd) $(pwd) 2>/dev/null
+	test echo echo /usr/bin cd sed printf
+| -eu printf then /usr/bin done
+		/usr/bin "$@" && 2>/dev/null grep ${HOME} "$1" --verbose test grep /usr/bin |
+	local test echo printf -eu &&
+		local test then | awk done test 'quoted text'
+		awk x=1 "$@" test -eu $(pwd) cd $(pwd) then printf --verbose "$1" | done
+	grep cd "$@" x=1 "$@" cd export then | 2>/dev/null cd awk test
+	--verbose && --verbose export then --verbose then
+	x=1 readonly -eu 2>/dev/null printf grep --verbose cd 'quoted text' test &&
+cd cd test sed /usr/bin done sed | local then -eu
+		'quoted text' "$1" printf test | && test ${HOME} | $(pwd) test | awk
+		cd readonly --verbose awk && x=1 2>/dev/null done cd 2>/dev/null
+	export "$@" export grep export /usr/bin readonly
+		'quoted text' && ${HOME} printf awk 'quoted text' echo /usr/bin printf
+cd x=1 && cd done grep x=1 done printf then
+	/usr/bin /usr/bin | export printf "$1" readonly cd local test
+		local && readonly awk cd grep then --verbose done test grep "$1"
+	2>/dev/null -eu done /usr/bin "$1" 'quoted text' export test
+		"$1" export | done ${HOME} 'quoted text'
+		local awk test done && test local sed --verbose sed sed x=1
+cd 'quoted text' | -eu test cd printf 2>/dev/null 'quoted text' "$1"
+	then | 'quoted text' export awk x=1 /usr/bin 'quoted text' test
+		"$1" echo "$@" grep $(pwd) && grep x=1 cd printf cd then export && done
+test test /usr/bin 'quoted text' sed ${HOME} 2>/dev/null
+		-eu then "$@" readonly "$1" ${HOME} ${HOME} cd ${HOME}
+"$@" sed x=1 --verbose echo export local grep test awk --verbose grep then -eu
+	readonly | ${HOME} readonly && grep echo then awk done then echo 'quoted text'
+		local 2>/dev/null sed -eu echo "$@" ${HOME} && test awk
+	cd $(pwd) local printf $(pwd)
+echo -eu -eu test | $(pwd) /usr/bin readonly awk
+		-eu printf done local awk readonly && echo then
+awk /usr/bin done grep --verbose
+		'quoted text' --verbose then awk readonly echo printf printf ${HOME} test $(pwd)
+	"$@" awk 'quoted text' $(pwd) "$1" awk
+		readonly && -eu | echo
+		2>/dev/null grep test | then x=1 awk 2>/dev/null awk ${HOME}
+	"$@" 2>/dev/null awk echo printf --verbose grep test | done x=1 && x=1 $(pwd)
+	'quoted text' --verbose -eu test test sed
+		x=1 local export ${HOME} local "$1" then then "$1" printf /usr/bin
+	then cd test awk --verbose /usr/bin --verbose echo
+		"$@" done 'quoted text' echo 2>/dev/null test done awk && --verbose export $(pwd)
+| && x=1 export cd test "$@" /usr/bin printf --verbose | then && grep --verbose
+		2>/dev/null grep && awk test readonly && | readonly
+	| -eu test /usr/bin readonly $(pwd) export done | then awk $(pwd) export local
+		"$1" --verbose 'quoted text' grep --verbose -eu "$1" grep 2>/dev/null test printf
+	grep awk sed sed ${HOME} /usr/bin $(pwd) -eu ${HOME} "$1" export readonly && sed
+	done 'quoted text' local test
+		$(pwd) x=1 cd -eu then echo "$@" /usr/bin 2>/dev/null export printf
+&& -eu -eu -eu 'quoted text' done
+x=1 && sed export done cd -eu x=1 --verbose
+	done then grep test "$@" test then ${HOME}
+		done /usr/bin -eu local && 'quoted text' printf 'quoted text'
+		readonly 2>/dev/null -eu ${HOME} 2>/dev/null readonly
+'quoted text' 2>/dev/null -eu readonly | ${HOME} sed
+		printf test sed test done x=1
+then && echo printf --verbose && && local export export echo && export grep
+	grep readonly --verbose /usr/bin test 2>/dev/null /usr/bin grep --verbose
+-eu -eu readonly && readonly awk echo 'quoted text' test x=1 readonly grep
+		test && local | $(pwd) $(pwd) | ${HOME} -eu
+| 2>/dev/null $(pwd) done grep 2>/dev/null --verbose -eu && cd sed "$@"
+awk done done readonly "$1" ${HOME} cd "$1" "$1" done grep
+		readonly "$1" && grep x=1 && "$@" /usr/bin then $(pwd) "$@" /usr/bin -eu export
+		${HOME} then x=1 local $(pwd)
+	${HOME} "$@" done && done export x=1 sed /usr/bin
+		echo local test local
+		&& "$@" -eu 2>/dev/null done "$@" 2>/dev/null sed test
+		cd $(pwd) readonly grep -eu cd 2>/dev/null x=1 awk echo test then then 'quoted text'
+	'quoted text' 2>/dev/null readonly printf local sed grep -eu grep grep
+		&& x=1 readonly grep local cd --verbose
+--verbose sed then x=1 ${HOME} -eu 2>/dev/null
+		${HOME} printf $(pwd) x=1 --verbose "$@" awk sed cd cd awk local
+		2>/dev/null x=1 && done grep
+		--verbose test 2>/dev/null local
+grep test && then grep then done 'quoted text' "$1" x=1 test |
+then then awk "$1" cd x=1 sed echo 2>/dev/null
+cd 'quoted text' "$1" "$1" awk $(pwd) local awk /usr/bin
+done "$@" "$@" printf grep "$1" sed | cd sed "$1" printf test ${HOME} 'quoted text'
+	export $(pwd) sed export readonly done -eu awk ${HOME} readonly done printf -eu
+		awk export grep "$1" -eu ${HOME} readonly local x=1 2>/dev/null awk
+awk --verbose then awk $(pwd) ${HOME} echo echo
+local printf ${HOME} 2>/dev/null
+"$1" export grep 'quoted text' readonly then "$1" export printf cd
+then ${HOME} -eu -eu echo export done echo
+	| done cd 'quoted text' readonly local 'quoted text' sed
+-eu cd -eu --verbose awk
+	x=1 sed awk printf x=1
+| readonly && /usr/bin "$@" $(pwd) sed export 'quoted text'
+	$(pwd) export test grep $(pwd) 2>/dev/null /usr/bin local
+	--verbose readonly ${HOME} test x=1 | echo cd local sed sed sed --verbose 'quoted text'
+	"$1" /usr/bin --verbose $(pwd) x=1 done x=1 cd test awk 'quoted text'
+x=1 $(pwd) "$@" 'quoted text' ${HOME} done 2>/dev/null
+		${HOME} $(pwd) "$1" 'quoted text' 2>/dev/null
+	--verbose -eu cd printf 2>/dev/null "$1" export $(pwd)
+		done readonly printf 'quoted text' local -eu then && -eu
+${HOME} grep x=1 'quoted text' -eu sed | grep 2>/dev/null
+	2>/dev/null local cd ${HOME}
+		"$1" "$@" ${HOME} $(pwd) then 'quoted text'
+	cd cd printf printf x=1 cd cd $(pwd) /usr/bin readonly
+-eu ${HOME} then x=1 readonly test -eu readonly $(pwd) export ${HOME} printf "$1"
+		done readonly done | 2>/dev/null $(pwd) awk grep |
+		&& grep /usr/bin test grep x=1 | -eu test ${HOME} && awk cd
+	done export "$1" $(pwd)
+	-eu -eu awk $(pwd) grep printf sed "$1" echo $(pwd) printf ${HOME} printf
+	export | cd cd && test /usr/bin cd && x=1 export ${HOME} --verbose readonly done
+		"$@" readonly x=1 then 2>/dev/null local
+		| $(pwd) cd echo grep sed grep "$@" && 2>/dev/null sed
+-eu local test 2>/dev/null -eu readonly -eu ${HOME} && done printf
+readonly -eu | test echo done
+sed printf printf && awk awk ${HOME} awk echo test local /usr/bin
+		sed 'quoted text' sed sed done $(pwd) -eu $(pwd) awk then printf
+	&& $(pwd) then $(pwd) sed grep grep then test "$@" "$@" "$1" readonly $(pwd) then
+"$@" "$1" awk && awk test awk done test then readonly readonly
+${HOME} 2>/dev/null test local ${HOME} | cd $(pwd) && cd $(pwd) x=1 echo --verbose
+grep -eu cd echo "$1"
+	&& /usr/bin then echo "$@" 'quoted text' test && && sed --verbose
+	&& export done printf --verbose "$@"
+"$1" 2>/dev/null printf
+		--verbose "$1" test && local $(pwd) local | cd ${HOME} "$1" grep --verbose
+readonly "$1" "$1" $(pwd) --verbose local -eu
+| --verbose x=1 && grep awk 'quoted text' sed printf -eu test --verbose -eu | printf
+		done $(pwd) local x=1 "$1" --verbose -eu grep $(pwd) "$@" -eu "$1" printf
+		export /usr/bin "$1" printf then then ${HOME} sed then | x=1
+	echo | x=1 awk export x=1 awk && -eu
+	-eu 2>/dev/null --verbose 'quoted text' 'quoted text'
+		"$@" && 2>/dev/null -eu 'quoted text'
+		cd test -eu readonly done | printf readonly
+awk export test 'quoted text' -eu --verbose local && then then echo /usr/bin
+	--verbose 2>/dev/null -eu awk readonly
+	export /usr/bin | 'quoted text' test 2>/dev/null
+		2>/dev/null export | 'quoted text' /usr/bin "$@" "$@" ${HOME}
+	'quoted text' awk "$@" 2>/dev/null
+	done /usr/bin sed /usr/bin grep grep export | "$@" --verbose test local awk $(pwd)
+		'quoted text' done grep echo
+		${HOME} -eu 2>/dev/null printf cd awk awk local $(pwd) && "$@"
+	x=1 && echo --verbose printf printf export grep && done $(pwd) &&
+&& test x=1 local ${HOME} $(pwd) ${HOME} "$@" readonly ${HOME} "$1" | 2>/dev/null
+		'quoted text' local grep --verbose local $(pwd) "$1" export cd sed x=1
+	"$@" x=1 local printf 'quoted text' 'quoted text' echo
+	done | export grep done --verbose echo export grep /usr/bin done
+-eu local printf cd cd grep grep then local
+		export then | local then $(pwd)
+"$1" done | $(pwd) awk "$1" && ${HOME} awk printf
+/usr/bin done local export cd awk x=1 'quoted text' test
+		"$1" $(pwd) | && cd "$@" then printf | -eu | awk ${HOME} ${HOME}
+		"$@" readonly readonly 'quoted text'
+		${HOME} 2>/dev/null echo readonly x=1 cd
+	/usr/bin sed ${HOME}
+	"$1" then | -eu ${HOME} && $(pwd) -eu local printf awk --verbose 2>/dev/null
+"$1" $(pwd) echo echo echo --verbose "$1" test --verbose
+		2>/dev/null local "$1" | "$@" --verbose --verbose
+	export test done /usr/bin test "$1" then "$@"
+		done -eu && ${HOME} /usr/bin sed x=1 -eu done cd && "$@" "$@" && printf
+		sed cd $(pwd) test ${HOME} printf done local grep
+	-eu awk echo "$@" sed x=1 then readonly export
+		'quoted text' printf printf ${HOME} | test local test x=1 echo
+		--verbose | export export 2>/dev/null
+		then done 2>/dev/null printf $(pwd) sed cd | --verbose
+	export 2>/dev/null /usr/bin -eu export "$1" local "$1" local then grep test cd
+	cd awk awk "$@" readonly --verbose --verbose 2>/dev/null echo
+		readonly local 2>/dev/null --verbose export
+		--verbose grep done | sed -eu sed x=1 awk 2>/dev/null local x=1 -eu
+&& cd test done printf && "$@" echo export then readonly --verbose then export
+	2>/dev/null --verbose test && ${HOME} done cd ${HOME} x=1 echo --verbose "$@" grep
+&& grep 2>/dev/null then sed done $(pwd) 2>/dev/null /usr/bin --verbose
+		x=1 | | | readonly $(pwd) readonly /usr/bin sed
+x=1 local local ${HOME} sed $(pwd) readonly test /usr/bin | $(pwd) 'quoted text'
+		${HOME} printf "$1" | printf done | && /usr/bin $(pwd)
+	${HOME} cd | awk test
+		-eu done grep $(pwd) awk sed local $(pwd) x=1 awk local -eu
+		then done $(pwd) 'quoted text'
+	readonly 'quoted text' grep
+	printf then printf $(pwd) && 'quoted text' local then sed x=1 done --verbose
+		x=1 -eu echo cd grep cd test && done $(pwd) readonly
+| cd --verbose -eu ${HOME} done awk /usr/bin export
+		| readonly && $(pwd) then "$@" sed sed /usr/bin test --verbose && "$@"
+		/usr/bin | $(pwd) local local --verbose grep
+readonly test && x=1
+	readonly -eu -eu awk cd awk 'quoted text' 'quoted text' "$1" readonly &&
+	readonly "$@" 'quoted text' then -eu --verbose
+--verbose -eu cd ${HOME} test
+	test export export export | "$1" local export
+		/usr/bin printf 2>/dev/null sed echo readonly done -eu x=1 $(pwd)
+cd | 2>/dev/null && 2>/dev/null cd /usr/bin done
+	awk /usr/bin -eu done awk "$1" local x=1 done echo
+	$(pwd) done test /usr/bin grep x=1 readonly "$1" echo -eu && x=1 -eu -eu test
+	printf --verbose --verbose cd --verbose 2>/dev/null --verbose
+		echo x=1 local -eu ${HOME} -eu --verbose done readonly awk | echo && sed x=1
+&& export -eu done "$@" /usr/bin awk x=1 echo export
+x=1 -eu 2>/dev/null printf printf export "$@"
+		--verbose "$@" test printf cd grep test done
+echo | grep cd readonly test done grep x=1 then x=1 x=1 2>/dev/null
+	'quoted text' printf -eu awk -eu --verbose export then &&
+echo | --verbose | "$1" sed /usr/bin | echo awk -eu "$1" export local
+	$(pwd) -eu /usr/bin $(pwd) "$1" printf --verbose "$@"
+		test 2>/dev/null done then "$1" cd x=1 test "$@" local ${HOME} 2>/dev/null
+	-eu && test then local 'quoted text' cd --verbose 2>/dev/null cd 'quoted text'
+--verbose test -eu /usr/bin test
+"$@" sed echo local echo awk
+		test local done "$1" 'quoted text' --verbose 'quoted text' /usr/bin
+		'quoted text' sed readonly 'quoted text' awk cd $(pwd) export done readonly
+sed echo 2>/dev/null --verbose -eu 2>/dev/null "$1" --verbose -eu done "$@" echo
+		x=1 local ${HOME} --verbose "$@" -eu 2>/dev/null cd --verbose then
+sed 2>/dev/null echo "$@" local
+echo cd local ${HOME} "$1" test 2>/dev/null awk done
+	&& "$@" ${HOME} grep grep grep
+	printf local && awk ${HOME} grep 2>/dev/null x=1 "$@" x=1
+local awk done && 2>/dev/null then
+		cd done | -eu awk export sed then
+2>/dev/null --verbose export awk
+		test 2>/dev/null $(pwd) local test cd then then /usr/bin 'quoted text' "$1" -eu
+${HOME} ${HOME} export then
+	readonly $(pwd) export echo
+		'quoted text' 2>/dev/null export
+		sed echo cd local then 2>/dev/null ${HOME} grep sed $(pwd) /usr/bin
+		$(pwd) ${HOME} local export
+then --verbose cd grep grep 2>/dev/null echo --verbose
+	test awk 'quoted text' then
+	awk readonly done && cd grep
+		-eu export && test printf sed $(pwd) export
+"$1" -eu && done --verbose
+		cd sed readonly && ${HOME} ${HOME} --verbose "$@" --verbose
+then cd ${HOME} x=1 then export --verbose -eu /usr/bin sed 'quoted text'
+		awk 2>/dev/null echo test "$@" then printf
+"$@" | --verbose cd export 'quoted text'
+	export echo && x=1 readonly awk printf
+		export export local echo done && sed test 2>/dev/null
+	cd cd local "$1" printf export local local
+	local "$@" done 'quoted text'
+		$(pwd) $(pwd) 'quoted text' -eu --verbose
+		then then done "$@" --verbose then local cd awk x=1 done printf -eu ${HOME} export
+		grep "$@" export test x=1 then readonly sed
+	${HOME} test /usr/bin "$@" -eu ${HOME} cd readonly --verbose 'quoted text' "$1"
+	"$@" x=1 awk echo printf &&
+		2>/dev/null grep 2>/dev/null test cd /usr/bin grep grep export
+	--verbose -eu $(pwd) | done "$@" local &&
+	'quoted text' $(pwd) -eu local | --verbose test &&
+"$@" x=1 cd $(pwd) /usr/bin x=1 then $(pwd) grep echo 'quoted text' 'quoted text'
+		"$@" sed x=1 printf "$@" printf export readonly test export 'quoted text'
+	cd x=1 printf $(pwd) $(pwd) readonly readonly echo --verbose "$1" x=1 'quoted text'
+readonly export --verbose echo cd --verbose /usr/bin
+		export sed echo awk ${HOME} --verbose
+		| && done readonly "$1"
+$(pwd) done 'quoted text' readonly grep printf
+		done grep --verbose grep awk grep awk | "$@" 'quoted text' local
+	"$1" "$1" test $(pwd) --verbose cd test ${HOME}
+	export printf export x=1
+	/usr/bin echo ${HOME} | -eu local export "$@" cd
+		-eu ${HOME} printf "$@" grep test ${HOME} done cd x=1 2>/dev/null
+	sed grep awk -eu --verbose 2>/dev/null
+'quoted text' grep then 'quoted text'
+		awk export cd echo --verbose
+2>/dev/null "$@" done 2>/dev/null 'quoted text' "$1" -eu
+		sed grep printf readonly readonly "$@" && -eu then export "$1" $(pwd) 2>/dev/null
+	sed done "$@" && && done then sed && done export then 'quoted text' echo --verbose
+'quoted text' "$@" test x=1 sed local done "$1"
+"$1" cd 2>/dev/null sed 'quoted text' 2>/dev/null --verbose ${HOME} /usr/bin -eu
+printf 2>/dev/null && --verbose
+		'quoted text' grep readonly export && export --verbose
+done cd awk --verbose
+local | "$1" | 'quoted text' ${HOME} "$1"
+		$(pwd) then 'quoted text' awk && then cd ${HOME} 2>/dev/null awk && echo "$1"
+done && x=1 echo | "$1" $(pwd) local "$@"
+readonly echo local sed x=1 printf done cd &&
+	'quoted text' printf x=1 --verbose && grep --verbose /usr/bin
+	sed | then test awk x=1 $(pwd) readonly export x=1 export
+		test /usr/bin "$@" then then readonly "$1" readonly local /usr/bin &&
+		echo && | echo x=1 --verbose readonly 'quoted text'
+		local cd && awk /usr/bin
+"$1" test 'quoted text' "$@"
+--verbose 'quoted text' x=1 done awk done
+		awk "$1" grep readonly printf $(pwd) printf local grep awk | printf "$1"
+	$(pwd) 2>/dev/null | then &&
+-eu grep sed readonly
+test $(pwd) awk cd sed echo readonly then /usr/bin
+		'quoted text' "$@" readonly grep $(pwd) echo 2>/dev/null
+		-eu awk done done x=1 'quoted text' "$1" grep sed sed awk "$@"
+"$@" "$1" export local x=1 test
+		test 'quoted text' sed echo grep local grep readonly then readonly x=1
+		${HOME} echo export 'quoted text' grep then /usr/bin 'quoted text'
+		2>/dev/null | $(pwd) "$@" done ${HOME} | export && then "$@" awk
+		"$@" ${HOME} awk 'quoted text' x=1 export echo 2>/dev/null &&
+	2>/dev/null cd grep cd printf sed $(pwd) | readonly test --verbose cd 2>/dev/null
+		cd printf printf grep awk /usr/bin 'quoted text' /usr/bin | awk local /usr/bin sed
+$(pwd) x=1 -eu ${HOME} test ${HOME} $(pwd) done --verbose "$1" 'quoted text'
+-eu test ${HOME} $(pwd) sed "$@" done
+	${HOME} awk | export awk cd -eu | && printf &&
+"$@" 'quoted text' && cd local && grep then local 2>/dev/null
+		-eu 'quoted text' ${HOME} $(pwd) "$1" ${HOME} 'quoted text'
+	done --verbose | then /usr/bin
+	-eu local /usr/bin 'quoted text' -eu echo
+		export sed "$1" x=1 -eu awk done -eu --verbose echo cd grep echo 2>/dev/null
+export --verbose $(pwd) sed cd /usr/bin -eu $(pwd)
+		then 'quoted text' && echo then cd | -eu readonly echo readonly /usr/bin
+awk "$@" local printf x=1
+"$@" ${HOME} "$1" && x=1 "$@" printf "$1" sed $(pwd) export ${HOME}
+		${HOME} awk | ${HOME} /usr/bin
+	"$@" "$@" export printf /usr/bin "$@"
+-eu awk 2>/dev/null awk export awk | && then cd -eu 2>/dev/null cd export
+| test local | echo $(pwd) && | $(pwd) --verbose sed test
+		test then $(pwd) 2>/dev/null 2>/dev/null | && --verbose "$1" 'quoted text'
+$(pwd) ${HOME} 'quoted text' -eu 2>/dev/null
+		| grep grep 'quoted text'
+	'quoted text' grep 'quoted text' local 'quoted text' test $(pwd) --verbose ${HOME}
+cd -eu x=1 2>/dev/null done -eu -eu --verbose -eu 2>/dev/null
+		x=1 grep --verbose | awk /usr/bin x=1 "$1" printf
+	2>/dev/null echo printf "$@"
+		'quoted text' sed 2>/dev/null local export test export | sed
+	echo printf local printf /usr/bin
+		done /usr/bin cd cd then printf $(pwd) --verbose grep x=1 local grep awk x=1
+--verbose awk done | |
+then cd grep grep cd /usr/bin awk "$1" printf readonly export ${HOME}
+		readonly | local --verbose test && | awk
+		-eu sed 'quoted text' -eu then -eu done export 2>/dev/null echo readonly 2>/dev/null
+	2>/dev/null -eu /usr/bin sed test 'quoted text'
+test local /usr/bin 'quoted text' grep echo "$1"
+cd "$1" $(pwd) test awk test -eu
+		"$1" x=1 grep "$1" readonly "$@" grep ${HOME} export echo
+		sed -eu 2>/dev/null $(pwd) "$@" cd test done && "$1" readonly --verbose
+		then done && awk awk | "$@"
+		cd "$@" awk "$@" sed local echo sed readonly cd 'quoted text' printf |
+$(pwd) | $(pwd) export /usr/bin
+		readonly then sed echo test awk x=1
+		grep 'quoted text' local |
+		-eu "$@" grep export "$1" x=1 $(pwd) --verbose
+		test readonly --verbose /usr/bin cd then
+	x=1 grep | sed echo cd "$@" test local && /usr/bin cd then -eu grep "$1"
+&& grep echo $(pwd) export then 'quoted text'
+	-eu $(pwd) $(pwd) -eu awk --verbose
+	grep "$1" cd sed export 2>/dev/null -eu echo --verbose done awk 'quoted text'
+x=1 ${HOME} x=1 done export readonly grep && local ${HOME} -eu && done readonly
+		x=1 'quoted text' --verbose --verbose 'quoted text' then readonly
+	&& 'quoted text' printf && x=1 | test
+cd x=1 && /usr/bin local local sed $(pwd) export printf grep
+"$1" 'quoted text' awk export x=1 sed done --verbose
+	"$@" ${HOME} sed export printf | done | grep printf
+"$@" sed "$1" "$@" cd | && ${HOME}
+		grep -eu /usr/bin grep
+	awk x=1 export ${HOME} test test "$1"
+	grep awk -eu "$1" grep /usr/bin $(pwd) $(pwd) | readonly printf echo --verbose
+	local echo x=1 awk export done awk x=1 printf
+	grep done local | "$@" $(pwd) 2>/dev/null
+cd local done && sed /usr/bin && -eu /usr/bin ${HOME} "$1" sed grep "$@" $(pwd)
+then done printf echo ${HOME} "$@" sed x=1 'quoted text' readonly
+	2>/dev/null test awk 'quoted text' -eu test done --verbose
+		${HOME} x=1 printf "$@" && && "$1" export ${HOME} 'quoted text' "$@" printf
+		2>/dev/null echo local grep then --verbose test |
+		-eu x=1 x=1 readonly local done --verbose
+		then printf done && echo /usr/bin sed test readonly 2>/dev/null /usr/bin "$@"
+	"$1" ${HOME} test then grep sed /usr/bin && local 'quoted text'
+		"$@" test "$@" done $(pwd) ${HOME} export ${HOME} 2>/dev/null awk
+"$1" export printf readonly sed echo
+		cd 'quoted text' "$1" printf -eu awk cd "$1" ${HOME} awk
+done "$@" awk --verbose ${HOME} printf awk ${HOME} $(pwd)
+		"$@" readonly --verbose readonly -eu printf
+&& sed ${HOME} --verbose cd export
+		/usr/bin "$1" 2>/dev/null $(pwd) "$@" test 'quoted text' readonly
+"$1" ${HOME} /usr/bin printf echo sed ${HOME} ${HOME}
+sed -eu awk /usr/bin | local printf sed $(pwd) cd readonly
+readonly && -eu ${HOME}
+&& x=1 -eu sed readonly "$@" awk
+2>/dev/null sed x=1 awk readonly "$@" done && readonly
+	done sed "$@" awk 'quoted text' && ${HOME} /usr/bin done x=1 "$1" --verbose
+		cd /usr/bin readonly then "$@" x=1 printf echo ${HOME} 2>/dev/null
+		&& "$@" local cd "$1"
+x=1 2>/dev/null /usr/bin x=1 test
+	--verbose ${HOME} 'quoted text'
+	x=1 | done "$@" 'quoted text'
+export $(pwd) export echo export ${HOME} then echo
+	awk | 'quoted text' echo
+		echo grep | $(pwd) "$1" test export
+		then "$1" echo printf local x=1 test
+	'quoted text' $(pwd) ${HOME} x=1 grep "$@" local
+		$(pwd) ${HOME} cd /usr/bin ${HOME} "$@" test x=1 --verbose done cd "$1" printf
+$(pwd) 2>/dev/null printf
+		readonly echo printf export
+${HOME} -eu "$1" readonly awk ${HOME} x=1 "$@" /usr/bin ${HOME} --verbose
+	readonly done x=1 -eu test
+	cd readonly export then 'quoted text' /usr/bin 2>/dev/null
+	"$1" --verbose ${HOME}
+		awk test readonly && readonly done --verbose 2>/dev/null x=1 $(pwd)
+"$@" ${HOME} done ${HOME} local export "$1" x=1 grep
+		printf awk local readonly "$1" cd test export local awk local then 'quoted text'
+		awk -eu --verbose "$@" 2>/dev/null --verbose export grep readonly
+		/usr/bin "$@" grep echo 2>/dev/null "$@" grep done cd awk done 'quoted text'
+		done x=1 'quoted text'
+		$(pwd) grep test ${HOME} cd printf | local "$@" export | $(pwd) "$@" printf
+	readonly local ${HOME} "$@" local export -eu done grep ${HOME}
+		${HOME} "$@" echo "$@" /usr/bin $(pwd) done ${HOME} --verbose 2>/dev/null
+readonly 'quoted text' 'quoted text' grep local local echo /usr/bin
+		$(pwd) test echo echo export --verbose
+		'quoted text' x=1 ${HOME} export /usr/bin x=1 done | printf awk export readonly
+	| grep 'quoted text' "$1" | $(pwd) -eu printf
+&& sed then x=1 local /usr/bin sed echo printf grep
+test grep 2>/dev/null export ${HOME} x=1 local
+test grep && grep 2>/dev/null ${HOME}
+		/usr/bin "$1" awk $(pwd) then ${HOME} export && 'quoted text'
+		"$1" && | cd done cd --verbose awk 2>/dev/null x=1 echo $(pwd) $(pwd) grep && then
+		local cd done readonly local cd awk 2>/dev/null /usr/bin
+		x=1 cd | sed "$@" x=1 done 2>/dev/null sed
+then "$1" | readonly printf ${HOME} /usr/bin test test then
+		$(pwd) readonly --verbose x=1 "$@" --verbose awk
+		/usr/bin | $(pwd) --verbose "$1"
+	local awk export test ${HOME}
+	cd export test sed /usr/bin
+	x=1 cd && && | $(pwd) then then readonly x=1 local | "$1" echo x=1 cd 'quoted text'
+/usr/bin then export "$1" export ${HOME}
+		sed echo "$1" local local echo "$1" /usr/bin
+then export export 2>/dev/null export $(pwd) ${HOME} x=1 "$@"
+${HOME} awk -eu done -eu done $(pwd)
+		-eu -eu cd && ${HOME} "$1" local grep 'quoted text'
+	"$1" $(pwd) export 'quoted text' /usr/bin
+2>/dev/null && ${HOME} ${HOME} ${HOME} --verbose test grep -eu "$1" x=1 grep
+	sed test echo done echo
+	test x=1 "$@" export /usr/bin echo done $(pwd)
+		&& "$1" ${HOME} x=1 /usr/bin 'quoted text' cd "$@" 'quoted text'
+	done echo export 'quoted text' test readonly "$@" awk printf $(pwd)
+then 2>/dev/null 2>/dev/null sed ${HOME} 2>/dev/null cd 'quoted text'
+		grep $(pwd) readonly readonly | local
+test export ${HOME} 2>/dev/null done then 2>/dev/null
+	done 'quoted text' x=1 printf awk 'quoted text'
+then x=1 printf grep local ${HOME} -eu export /usr/bin cd | $(pwd)
+		echo -eu sed -eu readonly ${HOME} | echo
+printf "$@" cd done sed 'quoted text' readonly 2>/dev/null sed
+		awk $(pwd) x=1 "$1" echo export local done $(pwd) local then grep grep ${HOME}
+		$(pwd) then printf echo sed awk echo | then 'quoted text' ${HOME} sed
+readonly done -eu export "$@" 'quoted text' echo
+| 2>/dev/null cd x=1 "$1" "$1" awk "$@" cd "$1" then then -eu $(pwd) ${HOME}
+	printf /usr/bin ${HOME} test | awk sed $(pwd) -eu
+	local sed "$1" "$@" echo test "$@" awk readonly export sed echo
+	--verbose readonly awk local --verbose test sed cd -eu
+	then && export readonly export "$@" 2>/dev/null readonly 'quoted text' export
+$(pwd) --verbose "$1" "$@" -eu ${HOME}
+then ${HOME} printf ${HOME}
+	echo ${HOME} export then then ${HOME} ${HOME} 'quoted text'
+	--verbose && "$1" readonly test ${HOME} $(pwd) "$1" cd
+	sed done done | --verbose
+	/usr/bin local awk -eu -eu x=1 "$1" grep printf printf x=1 test then readonly
+		"$1" grep echo -eu && "$1" printf
+	awk echo sed awk test sed | cd | then export local --verbose
+2>/dev/null 'quoted text' 'quoted text' export x=1 /usr/bin cd local 2>/dev/null
+	'quoted text' "$1" cd -eu x=1 |
+		"$1" /usr/bin 'quoted text' $(pwd) printf sed x=1 "$@" /usr/bin
+${HOME} "$@" echo awk readonly && "$1" -eu sed -eu | printf echo readonly
+		$(pwd) sed "$1" | sed cd 'quoted text'
+	x=1 printf export -eu && then && $(pwd) x=1 2>/dev/null cd cd && 'quoted text'
+		&& sed printf awk awk awk 2>/dev/null $(pwd) && test ${HOME} 2>/dev/null "$@"
+$(pwd) "$@" grep then printf $(pwd) echo ${HOME} 'quoted text'
+		cd readonly x=1 echo
+	echo sed sed echo -eu echo 2>/dev/null x=1 cd export grep sed && x=1 echo test
+		sed 'quoted text' 'quoted text' export export
+	"$@" echo "$@" printf "$1" | --verbose 'quoted text' 2>/dev/null --verbose
+		2>/dev/null readonly done x=1 done "$1" sed -eu ${HOME} readonly
+		/usr/bin $(pwd) "$1" "$1" grep cd && local
+		$(pwd) x=1 sed | --verbose sed cd printf "$1" | export local sed then /usr/bin 'quoted text'
+	local sed && 'quoted text' /usr/bin
+	-eu | then done 2>/dev/null then grep
+x=1 | 'quoted text' echo
+		"$1" test echo | test printf echo readonly cd /usr/bin "$@" done test
+	done printf echo test
+readonly export --verbose sed x=1 done && export $(pwd)
+readonly -eu local 'quoted text' echo $(pwd) grep test then 2>/dev/null "$@"
+		sed $(pwd) /usr/bin && --verbose
+	"$1" /usr/bin export 2>/dev/null
+/usr/bin done printf printf
+		"$1" && readonly test test 'quoted text'
+		grep | | "$@" echo sed x=1 -eu 'quoted text' done cd
+	--verbose 'quoted text' $(pwd) printf cd x=1
+		&& ${HOME} then awk -eu ${HOME} ${HOME} export
+		readonly && cd printf export done $(pwd) export then /usr/bin --verbose 2>/dev/null
+		test then /usr/bin && test 'quoted text' cd cd &&
+printf "$@" export echo --verbose cd 'quoted text' printf
+	sed /usr/bin printf 2>/dev/null
+	| /usr/bin 'quoted text'
+		--verbose -eu 2>/dev/null $(pwd) grep
+		sed $(pwd) "$1" awk grep | test awk "$1" echo local done
+	"$1" printf && x=1 /usr/bin printf ${HOME}
+	grep ${HOME} awk sed done --verbose
+readonly "$1" cd -eu | && readonly printf readonly && awk grep 'quoted text'
+	local readonly && export awk done local cd x=1 "$1" && --verbose grep
+		then ${HOME} echo echo export then sed
+	awk $(pwd) then "$@" then then -eu 2>/dev/null
+"$@" -eu local ${HOME} ${HOME} | sed ${HOME} then ${HOME} && $(pwd)
+'quoted text' export ${HOME}
+		"$@" printf export export local done "$1" $(pwd) cd | then
+		local then export sed cd | sed
+	awk "$1" export then 2>/dev/null local | && "$@" echo
+		x=1 x=1 2>/dev/null -eu local
+	then $(pwd) awk 2>/dev/null ${HOME}
+	awk export ${HOME} -eu readonly 'quoted text' && readonly
+		/usr/bin $(pwd) 'quoted text' --verbose
+	&& && -eu -eu export $(pwd) x=1 done /usr/bin
+		/usr/bin --verbose export 2>/dev/null
+	x=1 export x=1 cd echo awk "$1"
+	&& local 2>/dev/null test done --verbose done done readonly local "$1"
+		'quoted text' grep awk 2>/dev/null sed --verbose awk | | | then
+printf 'quoted text' export test --verbose 2>/dev/null export
+cd x=1 awk test && readonly && awk export --verbose "$@"
+'quoted text' echo test "$1" local cd export ${HOME} awk local /usr/bin -eu --verbose
+	--verbose printf "$@" done "$@" /usr/bin echo printf --verbose
+	readonly local echo done
+-eu done done local printf
+		sed cd x=1 test then ${HOME} export echo
+		"$1" then 'quoted text' awk && echo 'quoted text'
+		"$@" done /usr/bin "$1" awk done readonly echo printf /usr/bin
+		local ${HOME} -eu done export /usr/bin done test |
+sed grep 2>/dev/null --verbose
+		--verbose test cd 2>/dev/null $(pwd) done ${HOME}
+	$(pwd) x=1 readonly --verbose
+echo | export -eu export && awk export awk "$1" $(pwd) echo readonly
+-eu "$@" 'quoted text' then awk export "$@" /usr/bin /usr/bin
+	&& 'quoted text' x=1 'quoted text' export readonly awk "$@" "$1"
+		--verbose /usr/bin "$@" $(pwd) echo grep --verbose ${HOME} "$1"
+done grep readonly ${HOME} done
+	cd cd sed readonly then echo
+		"$1" export "$@" local echo ${HOME} export -eu 'quoted text' --verbose
+$(pwd) readonly | 2>/dev/null then echo done
+	/usr/bin --verbose echo 'quoted text' x=1 test --verbose 'quoted text'
+x=1 readonly x=1 readonly 'quoted text' awk
+		--verbose ${HOME} echo | "$@" && test done ${HOME}
+	/usr/bin printf printf grep -eu | grep -eu
+		local echo ${HOME} local done 'quoted text' ${HOME} echo sed
+echo local printf 2>/dev/null ${HOME} echo -eu cd --verbose --verbose cd x=1
+	printf export $(pwd) done -eu "$@"
+	"$@" printf printf x=1 cd x=1 2>/dev/null -eu printf test
+		echo | ${HOME} then printf x=1
+echo echo | printf x=1 x=1 | x=1 grep local 'quoted text' "$@" | readonly
+	$(pwd) x=1 grep printf -eu --verbose
+		printf 2>/dev/null "$@"
+		-eu cd export && local echo | local test sed -eu export ${HOME} done
+		/usr/bin ${HOME} printf /usr/bin done sed
+		"$1" echo printf $(pwd) done | cd
+local x=1 -eu echo 2>/dev/null test $(pwd) awk export printf
+		&& --verbose && && then | 2>/dev/null export
+$(pwd) -eu /usr/bin done "$1" /usr/bin && printf readonly
+		$(pwd) awk cd local echo x=1 /usr/bin readonly --verbose $(pwd)
+'quoted text' sed | awk
+		$(pwd) "$@" 'quoted text' cd "$@" then 2>/dev/null
+		'quoted text' export done /usr/bin
+		/usr/bin export done --verbose /usr/bin done
+		/usr/bin "$1" readonly /usr/bin done --verbose
+/usr/bin awk "$1" readonly x=1 "$@" awk --verbose
+/usr/bin "$1" printf -eu export awk ${HOME}
+printf /usr/bin 2>/dev/null x=1 | awk done
+awk x=1 sed "$@" local
+	-eu -eu x=1 x=1 awk 'quoted text' awk /usr/bin -eu && export | 'quoted text'
+	done x=1 "$@" echo $(pwd) sed ${HOME} grep then grep cd echo then /usr/bin done
+		printf test 'quoted text' /usr/bin cd done "$1" x=1 x=1 sed /usr/bin --verbose
+		${HOME} x=1 cd ${HOME} "$@"
+	'quoted text' | printf "$@" test 'quoted text' ${HOME}
+		done export printf printf awk && done x=1 x=1 "$@" echo echo && then local "$@"
+		done ${HOME} grep printf && && x=1
+	x=1 sed $(pwd) --verbose echo printf awk then ${HOME} grep 'quoted text'
+&& x=1 cd x=1 2>/dev/null test done test readonly /usr/bin | 2>/dev/null "$1"
+		sed readonly $(pwd) -eu && "$1" x=1 awk readonly "$1" &&
+		-eu x=1 awk done echo -eu ${HOME} x=1 done export printf done grep test awk
+		grep --verbose sed test awk echo done -eu readonly
+cd | then 2>/dev/null printf readonly grep printf printf
+	"$@" awk cd cd readonly sed awk done && local local && then test
+		export awk then 2>/dev/null 2>/dev/null 2>/dev/null x=1 cd --verbose
+		'quoted text' "$@" | local grep test cd 'quoted text' cd "$1" echo echo
+	${HOME} ${HOME} x=1 'quoted text'
+	echo x=1 ${HOME} "$@" done "$@" done /usr/bin sed --verbose awk
+	${HOME} ${HOME} then 2>/dev/null $(pwd) cd awk cd then 2>/dev/null
+	readonly printf echo && x=1 grep 'quoted text'
+		then && 2>/dev/null readonly "$@" export
+		"$@" cd local && && local grep $(pwd) done local -eu awk 2>/dev/null
+	"$@" 'quoted text' 'quoted text' awk done -eu grep cd
+	"$@" $(pwd) ${HOME} | 2>/dev/null grep --verbose sed
+grep echo sed ${HOME} && x=1 grep then done "$1"
+		cd local export "$@" "$@" 2>/dev/null
+		readonly ${HOME} && echo echo then "$@"
+	readonly test awk test -eu sed "$@" cd
+		-eu local cd "$1" ${HOME} 'quoted text' grep "$@" | "$1" 2>/dev/null done
+		export ${HOME} then awk && printf
+	done printf /usr/bin
+--verbose readonly $(pwd) 2>/dev/null
+	then 'quoted text' printf 'quoted text' $(pwd)
+${HOME} $(pwd) --verbose done --verbose $(pwd) /usr/bin then then x=1 then readonly
+	-eu cd export local test $(pwd) $(pwd)
+	echo && x=1 2>/dev/null awk ${HOME} local "$1" && export "$@" echo echo 'quoted text'
+	${HOME} | x=1 2>/dev/null printf cd -eu /usr/bin && | x=1 $(pwd) 'quoted text'
+		--verbose x=1 && sed "$1" cd
+	local readonly readonly printf
+		${HOME} 'quoted text' local
+-eu sed export done /usr/bin 2>/dev/null 'quoted text' ${HOME}
+		sed done "$@" 2>/dev/null done 'quoted text'
+printf awk awk && "$@" cd | ${HOME} cd "$1" done x=1 --verbose done &&
+"$1" "$1" echo sed x=1 /usr/bin
+${HOME} readonly "$1" && echo printf local "$1" x=1 'quoted text'
+		x=1 --verbose -eu readonly && export -eu awk readonly ${HOME}
+		printf && ${HOME} test "$@" readonly awk
+		| ${HOME} local done sed printf $(pwd) echo "$@" export 'quoted text'
+		/usr/bin awk -eu x=1 awk 2>/dev/null echo
+	awk echo $(pwd) local awk awk | sed -eu x=1 local --verbose
+		'quoted text' grep awk --verbose 2>/dev/null test "$@" export "$@" 2>/dev/null
+export local awk && "$1" test sed
+/usr/bin "$1" 2>/dev/null echo
+		then echo ${HOME} then --verbose 'quoted text' ${HOME} | 'quoted text'
+'quoted text' cd "$@" done awk $(pwd) $(pwd) grep done then $(pwd)
+	/usr/bin "$@" then export printf | 'quoted text' done printf $(pwd) export sed
+'quoted text' ${HOME} then -eu $(pwd) printf done "$@" sed ${HOME} cd x=1 ${HOME}
+	readonly /usr/bin echo /usr/bin "$@" -eu | x=1 export printf readonly /usr/bin
+/usr/bin printf sed -eu awk | echo test readonly /usr/bin
+		'quoted text' awk test x=1 export 2>/dev/null cd local
+		| readonly cd printf -eu grep 'quoted text'
+	$(pwd) done $(pwd) x=1 echo -eu ${HOME}
+/usr/bin test 'quoted text' cd test readonly
+		--verbose awk echo then local then echo cd test
+/usr/bin -eu sed readonly | --verbose export
+	sed x=1 test -eu && echo export export ${HOME} 'quoted text' "$1" x=1
+test "$@" "$1" -eu "$1" then grep && export && awk sed -eu
+	/usr/bin export "$@" export $(pwd) cd /usr/bin "$1" cd done readonly echo
+		local | /usr/bin sed sed sed then | && ${HOME}
+		| done 2>/dev/null echo | --verbose
+		awk "$@" "$@" ${HOME} x=1 | cd "$1" "$1" "$1" x=1 'quoted text'
+	grep -eu $(pwd) test x=1 "$@" /usr/bin "$@" awk export echo $(pwd)
+		--verbose "$@" done "$@" | && "$@" | --verbose done sed ${HOME} cd
+printf "$1" printf x=1 "$@" local export printf
+	&& -eu done ${HOME} 'quoted text'
+sed $(pwd) --verbose /usr/bin export "$1" --verbose then --verbose -eu -eu
+${HOME} 'quoted text' readonly
+		2>/dev/null then 2>/dev/null
+		-eu "$1" -eu "$@" 'quoted text'
+	&& && "$1" /usr/bin /usr/bin /usr/bin "$1" local
+		--verbose test then local printf cd awk -eu awk export then | "$@" "$1"
+/usr/bin done "$@" && 2>/dev/null /usr/bin export
+	export export echo grep "$@" ${HOME} cd then done printf | ${HOME}
+	grep x=1 "$@" x=1 /usr/bin "$@" /usr/bin | "$1"
+&& awk cd "$1" "$@" "$@" sed grep grep --verbose
+export grep readonly ${HOME}
+		done && "$1" x=1 sed printf x=1 local echo sed 'quoted text' /usr/bin
+		"$@" readonly done readonly $(pwd) 2>/dev/null
+echo done cd awk && then readonly 2>/dev/null sed "$1"
+	done grep then && printf $(pwd) x=1 awk grep
+		${HOME} local export
+		&& then "$@" test && --verbose then cd "$@" grep x=1 x=1 "$@" sed printf
+'quoted text' readonly
+	done awk then local x=1 grep local
+x=1 $(pwd) 2>/dev/null "$1" then cd | done "$1" 'quoted text' awk /usr/bin
+		printf done -eu printf sed grep "$@" -eu awk && grep ${HOME} "$@" cd
+	export x=1 "$@" awk 'quoted text' "$@" $(pwd) then cd 'quoted text'
+local awk local /usr/bin && | then "$1" awk "$@" "$@"
+		cd sed --verbose local grep export then x=1 export
+cd ${HOME} "$1" "$1" echo 2>/dev/null --verbose && 2>/dev/null "$1" local
+		local "$1" -eu printf sed then x=1 export /usr/bin echo
+	/usr/bin readonly test grep export echo 'quoted text'
+		awk sed 'quoted text' export ${HOME} $(pwd) done then printf
+		then echo 2>/dev/null $(pwd) cd then
+--verbose x=1 grep cd then local awk --verbose -eu test --verbose sed test test
+		awk grep export -eu x=1 export ${HOME} cd cd export cd "$1" ${HOME} test
+$(pwd) export printf awk readonly cd | /usr/bin
+	/usr/bin 'quoted text' 2>/dev/null
+local echo /usr/bin done grep done 'quoted text' export done awk done
+		done export --verbose | sed x=1 done then then $(pwd) readonly ${HOME}
+"$@" test printf sed | x=1 "$@" --verbose test
+		$(pwd) cd 2>/dev/null cd 'quoted text' ${HOME}
+		&& -eu done sed --verbose done test awk x=1 | && ${HOME} test echo | export
+	--verbose 'quoted text' local cd "$@" awk 'quoted text' local readonly
+		/usr/bin "$1" 'quoted text' 2>/dev/null then
+		grep local 'quoted text' echo -eu x=1 'quoted text' --verbose
+echo -eu /usr/bin cd /usr/bin
+		echo 'quoted text' awk echo "$@" $(pwd) --verbose then echo sed
+	2>/dev/null 'quoted text' readonly done "$1" && sed /usr/bin local
+	export "$@" readonly 'quoted text' 2>/dev/null --verbose local test
+		x=1 printf local 2>/dev/null 2>/dev/null x=1 && -eu printf
+		--verbose grep && export awk /usr/bin printf cd "$1" ${HOME}
+printf grep "$@" 2>/dev/null grep -eu readonly /usr/bin
+		--verbose ${HOME} 'quoted text' local -eu cd grep "$@" /usr/bin
+awk /usr/bin readonly && test ${HOME}
+		done local echo sed ${HOME} --verbose echo export
+/usr/bin grep "$1" $(pwd) --verbose printf echo awk test local echo
+export 'quoted text' | 'quoted text' 'quoted text'
+"$1" 2>/dev/null sed echo x=1 sed cd readonly test sed /usr/bin /usr/bin test
+cd export x=1 done grep echo ${HOME} printf ${HOME}
+done 2>/dev/null "$@" sed grep
+	2>/dev/null "$1" readonly echo awk ${HOME}
+		2>/dev/null x=1 sed local echo sed --verbose sed grep "$1" $(pwd) readonly
+x=1 && printf done "$@" -eu then echo readonly awk 2>/dev/null
+	sed done printf ${HOME} 2>/dev/null
+	printf cd -eu /usr/bin cd grep -eu local export printf test
+		x=1 awk grep $(pwd) sed "$1" ${HOME}
+		${HOME} local ${HOME} /usr/bin
+		-eu done awk /usr/bin /usr/bin cd /usr/bin --verbose test -eu "$@" |
+	| grep grep 'quoted text' cd then
+	printf "$@" test echo "$1" "$1" /usr/bin
+		'quoted text' sed && export && |
+		local && local readonly awk awk
+	echo cd grep $(pwd) | awk x=1 && 2>/dev/null | export readonly local
+| test then 2>/dev/null
+		printf grep cd && cd
+		--verbose /usr/bin x=1 awk cd sed
+-eu "$1" --verbose /usr/bin && echo 2>/dev/null -eu $(pwd) -eu --verbose --verbose
+grep cd awk "$1" printf "$1" done /usr/bin --verbose local x=1 -eu grep printf
+x=1 /usr/bin awk sed readonly "$1" | cd readonly
+		${HOME} --verbose cd readonly 2>/dev/null sed ${HOME}
+	&& local -eu -eu && then sed echo 2>/dev/null test ${HOME}
+&& && test /usr/bin --verbose
+	/usr/bin $(pwd) x=1 printf done "$1" --verbose echo 'quoted text' $(pwd)
+"$1" $(pwd) && then cd "$@" /usr/bin | export "$1" $(pwd) $(pwd)
+readonly --verbose then 2>/dev/null 2>/dev/null local printf echo x=1 /usr/bin
+	awk readonly then grep | 'quoted text'
+printf --verbose awk --verbose test "$1" ${HOME} grep cd 2>/dev/null
+	"$@" | export export --verbose /usr/bin echo -eu
+		| done cd --verbose 'quoted text' sed test | local 'quoted text'
+		grep printf test readonly x=1 test awk
+	local test echo "$@" cd /usr/bin cd -eu
+	readonly && then "$1" echo -eu then /usr/bin 2>/dev/null printf $(pwd) echo
+"$@" -eu printf printf
+"$@" "$@" && export && "$1" /usr/bin export sed local "$@" --verbose ${HOME}
+2>/dev/null -eu grep 'quoted text'
+	awk x=1 then "$1" | test x=1 echo echo
+		echo 2>/dev/null echo local -eu readonly 2>/dev/null
+	test && 'quoted text' awk $(pwd) sed then /usr/bin cd done | sed export
+		&& x=1 test 'quoted text'
+	'quoted text' ${HOME} readonly ${HOME} cd
+-eu ${HOME} grep x=1 --verbose echo done
+awk ${HOME} test awk 2>/dev/null 2>/dev/null x=1 cd
+"$@" then awk test grep | 2>/dev/null
+		readonly done 'quoted text' -eu 'quoted text' -eu export echo readonly export
+export && ${HOME} sed readonly
+		cd /usr/bin local awk ${HOME}
+local sed x=1 2>/dev/null 2>/dev/null $(pwd) $(pwd)
+'quoted text' then $(pwd) && export | done -eu grep
+| -eu grep "$1" then sed
+		--verbose export ${HOME} "$@" ${HOME} 'quoted text' | done sed x=1
+		${HOME} /usr/bin ${HOME} $(pwd) grep readonly --verbose $(pwd) | 'quoted text'
+	${HOME} export -eu echo --verbose
+echo --verbose -eu "$@" echo
+	| done cd done test printf sed "$@" awk $(pwd)
+	/usr/bin done printf -eu done 'quoted text'
+		x=1 "$1" test $(pwd) sed /usr/bin
+done "$@" $(pwd) 2>/dev/null sed readonly grep test x=1
+"$1" 2>/dev/null | echo | | | --verbose --verbose awk
+	--verbose done && sed done then cd
+		&& test then x=1 printf done awk cd /usr/bin readonly
+	--verbose "$1" 2>/dev/null ${HOME}
+		local readonly test printf export | --verbose done readonly "$1" readonly --verbose
+	/usr/bin && "$1" awk --verbose printf sed "$@" /usr/bin --verbose
+	$(pwd) "$@" --verbose 2>/dev/null sed $(pwd)
+cd 'quoted text' local
+	"$@" echo echo 'quoted text' x=1 &&
+	grep test echo ${HOME} 2>/dev/null echo cd awk printf
+	test grep then grep && test x=1
+done sed 2>/dev/null 2>/dev/null
+		then -eu sed test "$1" && sed "$1" "$@" /usr/bin /usr/bin
+x=1 --verbose done "$1" readonly echo && "$1" --verbose && printf
+		"$@" awk local 2>/dev/null grep grep
+2>/dev/null then && 'quoted text'
+		awk done --verbose cd test x=1 |
+		2>/dev/null local x=1 'quoted text' done sed ${HOME} local local cd awk
+x=1 $(pwd) 2>/dev/null 'quoted text' then 'quoted text' --verbose -eu 'quoted text'
+		${HOME} printf echo | echo "$@" $(pwd) ${HOME} sed x=1 $(pwd) echo /usr/bin /usr/bin
+		$(pwd) 2>/dev/null then && cd then sed $(pwd) test --verbose
+		| 'quoted text' $(pwd) grep 'quoted text' "$1" 'quoted text'
+	x=1 2>/dev/null then x=1 export then readonly --verbose printf "$@"
+		local /usr/bin cd then "$@" /usr/bin -eu echo test done $(pwd) -eu "$1"
+	export -eu "$1" --verbose done done
+		cd 'quoted text' /usr/bin $(pwd) ${HOME}
+		printf "$@" 'quoted text' 'quoted text' "$@" readonly -eu "$1" awk
+	printf echo --verbose local done done then /usr/bin -eu $(pwd)
+		readonly "$@" then x=1
+x=1 $(pwd) /usr/bin 2>/dev/null local ${HOME} cd readonly "$1" local
+awk readonly 2>/dev/null cd done -eu $(pwd) export 'quoted text'
+	$(pwd) export test done x=1 cd x=1 "$1" sed && && "$@"
+		local 2>/dev/null $(pwd) echo "$@" | $(pwd) readonly
+'quoted text' awk then --verbose
+$(pwd) 'quoted text' printf 'quoted text' "$@" -eu grep ${HOME} "$1" 'quoted text'
+local test 'quoted text' export ${HOME} /usr/bin
+		x=1 $(pwd) grep /usr/bin then -eu &&
+"$@" --verbose cd && $(pwd)
+	grep --verbose --verbose 2>/dev/null
+	printf 2>/dev/null /usr/bin
+	awk $(pwd) grep -eu 'quoted text' ${HOME} && | sed test echo
+"$@" sed "$1" cd awk "$1"
+		"$1" -eu 'quoted text' echo cd then /usr/bin x=1 'quoted text' $(pwd)
+		readonly awk /usr/bin readonly sed
+	"$@" awk echo /usr/bin "$@" -eu "$1" local cd 2>/dev/null 2>/dev/null awk readonly
+		test local 'quoted text' awk "$1" cd awk "$@" x=1 2>/dev/null local | /usr/bin
+	"$1" 'quoted text' sed 2>/dev/null "$@" x=1 readonly
+&& -eu $(pwd) "$@" export "$@" then $(pwd) $(pwd)
+		--verbose sed && local "$@" 'quoted text' cd 2>/dev/null
+		export && sed done export "$1" readonly
+grep "$1" -eu test export done $(pwd) -eu printf
+		&& "$@" /usr/bin test "$@" "$1" 'quoted text'
+	done sed "$1" | && echo cd echo | readonly "$1" cd $(pwd)
+	x=1 -eu 'quoted text' then export --verbose printf awk | $(pwd)
+sed readonly then /usr/bin $(pwd) x=1 x=1 "$@" awk
+printf 'quoted text' 'quoted text' x=1
+	"$@" x=1 && cd local echo 'quoted text' export
+		--verbose $(pwd) test local readonly x=1
+		| $(pwd) /usr/bin awk cd cd $(pwd) awk cd
+		$(pwd) --verbose local awk readonly test cd export
+	-eu -eu /usr/bin && /usr/bin local -eu x=1 "$@" grep /usr/bin ${HOME}
+	awk test done 2>/dev/null cd done readonly then | done ${HOME}
+grep "$@" && grep grep
+done test --verbose export then export done --verbose | done done
+		-eu && 2>/dev/null "$@" export --verbose sed awk $(pwd) local sed | echo local
+	then local $(pwd) test "$@" export
+		echo && "$1" printf && $(pwd) | 2>/dev/null "$1" export awk && printf "$1" then
+		done && grep test printf $(pwd) then && echo export "$@"
+		/usr/bin --verbose 'quoted text' local --verbose sed
+		echo "$@" && grep echo "$@" && ${HOME}
+then ${HOME} /usr/bin test
+	awk printf 'quoted text' 'quoted text' then --verbose
+"$1" done $(pwd) /usr/bin then echo printf --verbose --verbose
+		cd test done echo "$1" ${HOME} -eu grep -eu
+	test then -eu local &&
+		printf 2>/dev/null /usr/bin readonly
+	${HOME} "$@" "$@" x=1 export done && then 2>/dev/null
+		| -eu x=1 && -eu test awk "$@" ${HOME} $(pwd) awk sed echo x=1 'quoted text'
+	echo grep echo then "$1" /usr/bin ${HOME} done x=1 grep printf then
+"$1" $(pwd) then readonly -eu grep 2>/dev/null | local ${HOME}
+	2>/dev/null awk echo sed 'quoted text' awk $(pwd)
+	"$@" printf && | $(pwd)
+	echo "$@" readonly sed local "$1" then local echo then ${HOME} done done done
+	then readonly then test "$@"
+| local sed cd cd export -eu 2>/dev/null done | x=1 then /usr/bin
+	readonly echo "$@" --verbose ${HOME}
+	test test -eu test sed test printf then printf "$1" && export $(pwd) local 2>/dev/null
@@ -0,0 +1,2001 @@
+	grep sed awk cd echo test local && sed local
+	x=1 ${HOME} "$@" -eu cd then awk /usr/bin cd local 2>/dev/null printf -eu done
+x=1 -eu ${HOME} --verbose "$1" test done /usr/bin x=1 awk local
+$(pwd) -eu then readonly export test x=1 $(pwd) printf echo && 'quoted text'
+		sed printf local echo echo echo done --verbose
+	test then -eu then -eu | test readonly
+		test 2>/dev/null | ${HOME} --verbose --verbose ${HOME} --verbose printf "$1"
+		echo export 2>/dev/null done test done grep | "$@" ${HOME}
+		$(pwd) "$@" awk local grep printf local grep
+		"$1" ${HOME} then awk sed
+	done x=1 --verbose then
+	x=1 -eu then export printf test
+'quoted text' | 'quoted text'
+		'quoted text' readonly readonly "$@" printf sed | 2>/dev/null readonly
+		printf awk -eu | 2>/dev/null && grep
+echo then && x=1 ${HOME} 'quoted text' echo
+		echo sed test 'quoted text' -eu then ${HOME} 'quoted text' grep cd local
+printf /usr/bin && | ${HOME} 2>/dev/null ${HOME} -eu | "$1" export
+	$(pwd) grep grep "$1" --verbose
+		test $(pwd) /usr/bin 2>/dev/null grep local "$1"
+2>/dev/null $(pwd) x=1 -eu sed printf /usr/bin --verbose /usr/bin sed "$@" readonly
+local done "$@" "$1" "$@" echo awk readonly sed sed grep "$1" awk done local x=1
+		2>/dev/null "$@" awk && 2>/dev/null |
+		grep $(pwd) export local then /usr/bin sed then -eu "$1" grep test && done &&
+-eu "$@" x=1 printf grep | local
+	test export cd x=1 echo "$1" test sed readonly
+		done "$@" 'quoted text'
+		sed "$1" test | awk x=1 'quoted text'
+	${HOME} x=1 x=1 2>/dev/null "$1" | cd sed done test -eu
+export --verbose "$@" printf --verbose | then x=1 "$@" "$@" $(pwd) export
+	| awk | cd echo ${HOME} /usr/bin ${HOME}
+| -eu local cd 2>/dev/null echo $(pwd)
+		done 'quoted text' "$@" x=1 | sed 'quoted text' cd done cd sed sed && then
+		awk export awk "$1" "$@" "$1" | cd /usr/bin test sed /usr/bin
+		| test "$1" ${HOME} "$@" local printf done "$@" 'quoted text' $(pwd)
+	| "$@" awk echo "$@" then x=1 "$@" 'quoted text' grep sed sed ${HOME}
+awk local -eu 2>/dev/null readonly "$@" printf printf then "$1"
+--verbose /usr/bin --verbose "$1" x=1
+	$(pwd) x=1 printf sed $(pwd) ${HOME} && -eu cd then
+		printf -eu export && /usr/bin then
+		'quoted text' printf grep && | "$@" ${HOME} local local test awk "$1" 2>/dev/null
+		/usr/bin echo printf 2>/dev/null
+	| | ${HOME} local readonly "$1" --verbose done -eu printf export /usr/bin
+		readonly grep $(pwd) printf
+	2>/dev/null -eu export printf
+		&& 2>/dev/null 2>/dev/null --verbose grep "$@" test -eu local x=1 &&
+/usr/bin "$@" /usr/bin /usr/bin cd sed /usr/bin echo local -eu $(pwd)
+	awk readonly $(pwd) awk
+	--verbose x=1 2>/dev/null $(pwd) test $(pwd) && x=1
+local 2>/dev/null printf readonly && ${HOME}
+		2>/dev/null awk x=1 -eu awk test --verbose "$@" 2>/dev/null
+/usr/bin --verbose $(pwd) awk -eu
+		done "$1" awk printf x=1 | ${HOME} local awk export $(pwd) readonly test
+sed --verbose sed "$1" readonly sed
+cd local test then ${HOME} -eu 'quoted text' -eu $(pwd) test x=1 /usr/bin
+	&& awk | printf ${HOME} /usr/bin x=1 printf
+	$(pwd) grep --verbose 'quoted text'
+	done $(pwd) | "$1" && done sed test test $(pwd) export test /usr/bin test 2>/dev/null
+	$(pwd) "$1" "$1" sed x=1 2>/dev/null "$1" /usr/bin && awk printf
+cd "$@" readonly export local -eu ${HOME}
+		/usr/bin ${HOME} then | | then
+		2>/dev/null | cd printf awk
+	cd test 2>/dev/null /usr/bin then awk /usr/bin ${HOME} "$1" /usr/bin
+		export --verbose done export grep cd -eu done
+		$(pwd) x=1 test done 2>/dev/null then local ${HOME}
+sed | local ${HOME} then x=1 $(pwd) "$@" $(pwd) -eu printf printf
+	done $(pwd) sed readonly "$@" test then sed sed then && && grep test && /usr/bin
+-eu && readonly --verbose awk 'quoted text'
+	readonly then cd printf x=1 done test
+		"$1" export then echo 2>/dev/null then export cd local test && sed
+"$@" grep | local done x=1 && $(pwd) -eu --verbose cd printf
+		cd sed local 'quoted text' test readonly -eu
+then 'quoted text' --verbose && ${HOME} local /usr/bin awk /usr/bin ${HOME} awk
+		&& x=1 -eu done --verbose grep grep ${HOME} sed readonly ${HOME} "$1" cd
+	2>/dev/null cd sed then x=1 $(pwd) $(pwd) "$1"
+	local echo && echo | && "$1" /usr/bin done then grep && x=1 2>/dev/null
+		then $(pwd) grep local && cd "$@" 'quoted text'
+	'quoted text' ${HOME} grep grep 2>/dev/null local | 2>/dev/null "$@" x=1 &&
+	then local done 2>/dev/null && "$1" "$@" echo --verbose done readonly printf
+		awk -eu | awk awk && readonly | --verbose | $(pwd) -eu cd /usr/bin 'quoted text'
+$(pwd) done x=1 printf | awk echo readonly test readonly local -eu cd grep readonly
+	local 'quoted text' x=1 $(pwd) then 2>/dev/null
+	$(pwd) export -eu --verbose "$@" awk sed local x=1 awk 'quoted text'
+	printf awk readonly test cd
+	done "$@" --verbose local 2>/dev/null
+	then export "$@" 2>/dev/null "$@" --verbose $(pwd)
+		"$@" local "$@" /usr/bin grep /usr/bin | "$@" x=1 x=1 then cd -eu -eu grep
+then /usr/bin && && ${HOME} cd "$@" $(pwd)
+	sed | cd $(pwd) cd | "$@" && printf x=1 test
+"$@" && 'quoted text' readonly 2>/dev/null
+"$1" | grep local test 'quoted text' 2>/dev/null
+		export $(pwd) "$@" && then
+		-eu readonly "$1" awk cd test 'quoted text' -eu echo test test /usr/bin
+	done $(pwd) then "$@" export done -eu && local && | 'quoted text'
+	awk $(pwd) done && --verbose awk 'quoted text' then then readonly test sed echo
+2>/dev/null /usr/bin awk | x=1 x=1 --verbose done x=1 --verbose && cd 2>/dev/null
+		"$@" cd echo && printf /usr/bin
+		&& && printf -eu done echo ${HOME} x=1 grep ${HOME} then
+		2>/dev/null readonly readonly export test then echo test local /usr/bin
+	grep sed -eu "$@" 2>/dev/null | grep -eu x=1
+	&& done /usr/bin --verbose -eu done x=1 readonly done printf && awk sed
+| 'quoted text' grep local --verbose | /usr/bin sed
+	2>/dev/null printf export cd "$1" done sed then -eu x=1 export "$@" | /usr/bin
+		${HOME} -eu /usr/bin "$1"
+export grep ${HOME} 2>/dev/null
+	then --verbose sed readonly x=1 'quoted text' "$1" -eu
+	grep ${HOME} export printf done printf test then
+	cd done export then "$@" "$@" grep "$1" "$@" sed export 2>/dev/null "$@" ${HOME}
+	$(pwd) sed $(pwd) cd && test /usr/bin "$@"
+	cd test cd then ${HOME} | /usr/bin $(pwd) | printf /usr/bin
+	export readonly grep && 'quoted text' done test awk printf $(pwd) 'quoted text'
+		sed /usr/bin printf x=1 "$1" 2>/dev/null printf sed done -eu
+	test done 2>/dev/null awk sed local | 2>/dev/null then
+	sed test /usr/bin x=1 --verbose local "$1" x=1 done printf --verbose
+grep "$@" readonly done test && && printf && $(pwd) sed grep $(pwd)
+	2>/dev/null --verbose /usr/bin printf 'quoted text' $(pwd) "$1"
+test awk "$@" awk 2>/dev/null grep test /usr/bin x=1 sed
+	cd x=1 cd | awk cd readonly /usr/bin "$1"
+$(pwd) done 2>/dev/null test ${HOME} 2>/dev/null
+		'quoted text' test $(pwd) local x=1 local test ${HOME} $(pwd) && 2>/dev/null
+	awk awk sed export && x=1 test awk then local x=1 printf done 2>/dev/null
+	then /usr/bin 'quoted text' x=1 readonly then grep
+		awk "$@" && readonly local printf export x=1 echo readonly 'quoted text' printf
+-eu "$1" 2>/dev/null readonly 'quoted text' printf ${HOME} test ${HOME} 2>/dev/null
+		local x=1 then ${HOME} --verbose
+export /usr/bin "$@" "$@" cd export x=1 local done awk
+cd awk done "$1" echo readonly $(pwd) awk done
+		sed && cd awk export readonly grep cd echo cd grep readonly done x=1 export
+	&& done readonly ${HOME} "$1" ${HOME} awk $(pwd) echo
+	--verbose cd 2>/dev/null
+	sed "$1" export "$@" awk "$1" "$@" sed ${HOME} ${HOME} then
+	readonly --verbose sed echo awk then
+		sed $(pwd) ${HOME} $(pwd) "$1" then echo "$@" "$1" readonly
+		/usr/bin cd grep && readonly grep "$@" sed local
+"$@" echo --verbose sed echo "$@"
+-eu printf awk | --verbose ${HOME} sed x=1 2>/dev/null echo 2>/dev/null --verbose
+test export && local --verbose "$1"
+printf echo grep printf -eu sed cd test
+sed 'quoted text' local awk --verbose local --verbose && then test
+		${HOME} sed export && sed ${HOME} | local
+| local x=1 'quoted text' -eu ${HOME} awk --verbose
+$(pwd) -eu ${HOME} -eu cd
+	2>/dev/null done "$1" local printf 'quoted text' "$1" then && awk
+	echo sed "$1" -eu test | done then | x=1 && cd awk
+		"$1" ${HOME} ${HOME} readonly /usr/bin
+		"$1" echo "$1" grep | -eu /usr/bin "$@" readonly x=1 cd 'quoted text'
+	2>/dev/null readonly echo
+echo 2>/dev/null cd sed -eu x=1 ${HOME} sed | local awk
+		-eu export x=1 cd 'quoted text' done $(pwd)
+cd grep awk awk 2>/dev/null -eu -eu readonly /usr/bin sed -eu --verbose then
+awk -eu awk export | test /usr/bin done -eu $(pwd) 'quoted text' 'quoted text' test
+		/usr/bin readonly 'quoted text' --verbose ${HOME} x=1 "$@"
+	readonly /usr/bin readonly $(pwd) | "$1" then
+		local cd /usr/bin readonly then "$@" $(pwd) grep $(pwd) 2>/dev/null | 2>/dev/null
+		&& test "$@" done then export 'quoted text'
+	grep && | "$@" export cd x=1 then cd -eu local sed $(pwd) echo echo grep done
+	sed test --verbose printf $(pwd) readonly
+"$@" $(pwd) export ${HOME} "$@" awk echo --verbose grep awk local "$1" test awk
+		sed cd -eu -eu export x=1 grep --verbose
+	test --verbose ${HOME} cd -eu grep | 'quoted text' "$1" echo 2>/dev/null
+		&& local local done 2>/dev/null ${HOME} local /usr/bin | local cd
+"$@" awk echo sed 'quoted text' 2>/dev/null then "$@" --verbose test echo "$1"
+		cd ${HOME} export x=1 ${HOME} $(pwd) then $(pwd) grep | && | x=1 --verbose
+	| 2>/dev/null cd "$1" && test "$@" local x=1 2>/dev/null sed | cd | /usr/bin
+		local printf ${HOME} | grep | -eu printf x=1 'quoted text' 'quoted text'
+		readonly readonly grep "$1" $(pwd) echo
+-eu "$1" 2>/dev/null "$@" test 'quoted text'
+	local | local $(pwd) printf "$@" "$1" ${HOME} && --verbose echo
+	echo /usr/bin cd 'quoted text' local done $(pwd)
+"$@" done && awk /usr/bin echo local "$1" --verbose echo printf
+readonly grep && local local && test | /usr/bin readonly
+	--verbose -eu x=1 --verbose ${HOME} "$1"
+	local && && cd "$@" && local echo
+		echo readonly local cd awk "$@" test then ${HOME}
+	local echo awk /usr/bin done
+	| cd test grep "$@" sed | printf then done | test sed ${HOME} readonly
+		${HOME} x=1 ${HOME} cd export grep cd awk then
+	| test "$1" sed -eu /usr/bin
+		cd 2>/dev/null done --verbose
+	"$1" | $(pwd) 2>/dev/null "$1" then local 'quoted text' x=1 "$@" 'quoted text'
+		-eu sed done echo cd awk grep export 2>/dev/null && ${HOME} local cd test
+	$(pwd) "$1" grep echo local
+export -eu 2>/dev/null grep | --verbose echo 2>/dev/null
+	test printf readonly printf done
+	'quoted text' x=1 ${HOME} test | 'quoted text' ${HOME} printf &&
+	$(pwd) $(pwd) -eu printf cd awk ${HOME} printf test sed 2>/dev/null export
+		/usr/bin readonly ${HOME} | ${HOME} readonly then local -eu
+	&& export x=1 && test --verbose awk readonly test 'quoted text'
+		"$1" test grep 'quoted text'
+		"$1" -eu awk --verbose /usr/bin "$@" grep && 'quoted text'
+&& && test grep grep printf export "$@"
+--verbose ${HOME} local echo sed -eu 'quoted text'
+printf echo --verbose awk ${HOME} echo export then
+		cd cd export x=1 x=1 cd grep "$1" x=1 "$@" sed readonly
+	&& 'quoted text' "$@" /usr/bin /usr/bin 2>/dev/null
+	'quoted text' sed test && | 2>/dev/null printf 'quoted text'
+${HOME} echo grep --verbose sed | --verbose ${HOME} ${HOME} x=1 test
+		"$@" echo echo --verbose --verbose /usr/bin 2>/dev/null
+	'quoted text' done sed --verbose
+	--verbose && | test done "$1" then then sed "$@" -eu export local done local done
+export 'quoted text' local sed printf
+		| done x=1 x=1 sed then "$1" x=1 && -eu "$1" done "$@" test $(pwd)
+		$(pwd) then then printf printf test 2>/dev/null cd -eu
+readonly 2>/dev/null echo 'quoted text' && readonly echo cd --verbose
+	'quoted text' echo awk sed $(pwd) local 'quoted text'
+	$(pwd) local "$1" | cd && && cd /usr/bin awk -eu local grep grep echo awk /usr/bin
+		export cd test 2>/dev/null /usr/bin export | x=1 printf --verbose
+printf "$1" echo && -eu echo
+&& test "$1" "$@" cd test printf export export printf /usr/bin 2>/dev/null
+		local grep sed local done "$@" awk sed 'quoted text'
+	cd /usr/bin done --verbose sed ${HOME}
+	--verbose /usr/bin 2>/dev/null
+		awk awk readonly -eu x=1
+	grep cd $(pwd) local export 'quoted text'
+		awk readonly 2>/dev/null "$1" "$@" cd then 2>/dev/null
+test then printf "$@" export readonly 'quoted text' /usr/bin awk 2>/dev/null
+	$(pwd) export "$@" $(pwd) awk /usr/bin 2>/dev/null | awk
+		printf "$1" readonly local "$1" grep local sed | 2>/dev/null local
+		-eu then | awk grep awk "$1" sed $(pwd) echo test && x=1 printf
+	done && test grep readonly sed --verbose printf printf then $(pwd) printf | sed
+		awk $(pwd) cd $(pwd) 'quoted text' "$1" then done local echo test sed sed
+then 2>/dev/null export local grep export done
+	awk x=1 awk -eu -eu | done readonly
+	test local /usr/bin && 'quoted text' printf cd -eu --verbose sed --verbose
+		"$@" local "$@" sed /usr/bin test grep done | /usr/bin local printf echo readonly
+	printf 2>/dev/null done && readonly awk
+	cd test printf "$@" test done export "$@" "$1" 2>/dev/null
+x=1 $(pwd) export "$1" awk readonly "$1" "$1" then "$@" export readonly
+		echo | "$@" echo -eu grep
+	-eu grep 'quoted text' printf -eu "$1" && 'quoted text' -eu
+		"$@" echo 2>/dev/null --verbose
+	sed printf cd done 2>/dev/null local "$1" echo /usr/bin
+	"$1" 2>/dev/null --verbose echo done && -eu
+		2>/dev/null "$1" awk cd "$1" 'quoted text' $(pwd) printf
+	${HOME} done then printf awk awk -eu echo local
+	readonly cd -eu echo -eu -eu done "$@" grep x=1 printf /usr/bin printf
+	-eu | 2>/dev/null awk done local printf "$@" cd
+sed printf test printf x=1 sed awk "$@" sed --verbose printf
+		grep ${HOME} -eu -eu 2>/dev/null done --verbose awk "$@" test "$1" then
+	$(pwd) grep cd /usr/bin test printf 2>/dev/null grep
+	'quoted text' export 2>/dev/null sed echo awk 'quoted text' "$1" done local
+| printf && export cd echo "$1" cd
+		test grep printf cd | local test awk ${HOME} then local readonly
+-eu export | then 2>/dev/null
+	echo test ${HOME} --verbose cd printf awk done 2>/dev/null -eu done 2>/dev/null
+	${HOME} then cd && done "$1" x=1
+		cd --verbose --verbose /usr/bin then -eu awk test local sed
+	then awk && 2>/dev/null export done /usr/bin
+	done echo $(pwd) test && && grep /usr/bin && | awk $(pwd) && awk readonly
+| local test awk x=1 ${HOME} && -eu export
+done | x=1 --verbose "$@" readonly sed 2>/dev/null /usr/bin
+printf /usr/bin "$@" |
+		sed printf 'quoted text' /usr/bin awk
+		"$1" printf sed 2>/dev/null && local --verbose printf sed $(pwd) grep "$1"
+		&& --verbose export x=1 -eu awk grep 2>/dev/null printf
+		/usr/bin export "$1" grep readonly cd && awk test cd
+		then readonly readonly echo grep -eu awk export done "$1" /usr/bin | echo
+echo /usr/bin x=1 -eu echo cd 2>/dev/null printf --verbose then cd
+		--verbose && done "$1" --verbose
+		"$@" local x=1 ${HOME} $(pwd) -eu test x=1 'quoted text' --verbose $(pwd) x=1
+	sed export echo --verbose done cd printf x=1 'quoted text' readonly ${HOME}
+	-eu /usr/bin 2>/dev/null --verbose echo "$1"
+	x=1 awk x=1 --verbose local grep export "$1"
+	/usr/bin 'quoted text' readonly && ${HOME} && && "$@" "$1" echo
+		grep ${HOME} sed export then "$@" "$@" readonly x=1 printf then
+	'quoted text' x=1 awk /usr/bin cd 'quoted text' /usr/bin grep x=1
+	-eu ${HOME} 'quoted text' 'quoted text' -eu $(pwd) 'quoted text' &&
+	x=1 x=1 $(pwd) then --verbose then sed $(pwd) test /usr/bin then then
+		-eu -eu $(pwd) --verbose local then grep sed
+cd local local && "$1" "$1" awk "$@" /usr/bin done x=1 done
+'quoted text' "$1" | done export 'quoted text' $(pwd) 'quoted text' $(pwd) "$@"
+$(pwd) "$1" test local test | && /usr/bin echo awk
+		/usr/bin awk export 2>/dev/null test x=1 awk test /usr/bin printf
+	2>/dev/null /usr/bin 2>/dev/null done x=1 done | done
+	export echo readonly test /usr/bin "$1" export --verbose echo 'quoted text'
+		x=1 --verbose done && export ${HOME} -eu
+	${HOME} then && 2>/dev/null readonly
+done export then grep 'quoted text' x=1 readonly grep readonly x=1 awk sed readonly
+awk ${HOME} "$@" test awk local 'quoted text'
+	then 'quoted text' /usr/bin $(pwd) -eu awk /usr/bin ${HOME} "$@" echo $(pwd) 'quoted text'
+		"$@" | "$@" 'quoted text' --verbose
+	2>/dev/null test --verbose printf grep ${HOME} done | sed then awk 'quoted text'
+	${HOME} ${HOME} printf ${HOME} cd | echo local "$@" && x=1 cd awk grep cd
+export printf echo /usr/bin
+	| 2>/dev/null then $(pwd) cd -eu test done --verbose echo awk
+printf then 'quoted text' | x=1 test "$@" x=1 'quoted text' $(pwd) sed
+	test "$1" /usr/bin && then
+	"$@" $(pwd) x=1 local test "$@" test /usr/bin test 2>/dev/null
+2>/dev/null awk then echo "$@"
+	then test 2>/dev/null ${HOME} then printf test "$1" cd awk awk
+awk echo sed x=1 x=1 cd "$@" grep /usr/bin then readonly export export -eu &&
+		readonly "$1" cd -eu x=1
+grep grep then then grep grep echo $(pwd) echo && "$@" /usr/bin $(pwd) $(pwd)
+	x=1 cd done readonly sed cd $(pwd) done grep --verbose ${HOME} | -eu
+"$@" x=1 grep --verbose "$1" && $(pwd)
+cd grep 'quoted text' x=1 "$1" echo ${HOME} /usr/bin echo sed
+--verbose local && /usr/bin
+	${HOME} x=1 $(pwd) 2>/dev/null sed readonly readonly done export x=1 sed echo
+		test 'quoted text' -eu printf && && export ${HOME}
+		local 'quoted text' echo x=1 cd
+		then then ${HOME} $(pwd) cd then "$1"
+		--verbose $(pwd) $(pwd) x=1 grep printf && grep 'quoted text' printf "$1" --verbose
+		cd --verbose cd $(pwd) 'quoted text' --verbose done && sed readonly
+"$1" then local "$@" local local
+cd ${HOME} ${HOME} /usr/bin "$1" echo cd sed "$@" export grep grep x=1
+	/usr/bin awk export --verbose --verbose cd grep $(pwd)
+	awk 'quoted text' printf local test "$1"
+	cd "$@" sed "$1" awk $(pwd) readonly cd $(pwd) awk
+cd 2>/dev/null printf readonly cd local && readonly awk done ${HOME} /usr/bin
+	awk "$@" sed | cd done cd $(pwd) "$1" && awk && cd "$1" 'quoted text'
+		local done readonly echo x=1
+grep "$1" | printf local -eu 2>/dev/null $(pwd) test export
+x=1 cd done printf done done readonly
+&& echo x=1 2>/dev/null sed ${HOME} "$@"
+'quoted text' "$@" && | --verbose -eu $(pwd) readonly
+'quoted text' test readonly cd | ${HOME} "$1" cd awk
+&& --verbose sed readonly --verbose | printf --verbose ${HOME} x=1
+		test ${HOME} cd x=1 local x=1 done 'quoted text' grep cd "$@" cd then "$@"
+done grep "$1" export "$1"
+cd local $(pwd) $(pwd) && cd echo -eu x=1 done sed | x=1 "$@" readonly
+	local echo done 2>/dev/null
+		sed x=1 test then --verbose awk echo test ${HOME} printf
+${HOME} --verbose | awk readonly local -eu | $(pwd) done local cd printf --verbose
+	done -eu awk grep ${HOME}
+	export awk awk sed 'quoted text' --verbose
+		readonly /usr/bin | $(pwd) | | echo ${HOME}
+/usr/bin cd 'quoted text' export cd then awk grep "$1" $(pwd) test 2>/dev/null
+		echo printf && test export grep $(pwd) x=1 local "$1" grep --verbose done
+		--verbose && ${HOME} awk readonly echo ${HOME} export "$@" local -eu /usr/bin
+test /usr/bin readonly 2>/dev/null x=1 echo awk
+	2>/dev/null $(pwd) ${HOME} ${HOME} export --verbose ${HOME}
+		--verbose readonly | sed local local 'quoted text'
+		grep export "$@" test echo $(pwd)
+	--verbose readonly 'quoted text'
+	/usr/bin ${HOME} printf | --verbose /usr/bin awk done local test printf /usr/bin
+		x=1 'quoted text' "$@" $(pwd) -eu
+	echo local | 2>/dev/null awk && /usr/bin
+/usr/bin readonly export 'quoted text' readonly
+sed --verbose sed sed ${HOME} 'quoted text'
+		then "$1" then $(pwd) export printf 'quoted text' x=1 | cd -eu "$1" awk 'quoted text'
+	printf local awk local local then $(pwd) awk $(pwd) "$1" /usr/bin
+		readonly "$1" printf awk grep test x=1 printf 'quoted text'
+		--verbose grep 'quoted text' echo done done cd -eu grep then $(pwd) printf
+	export then -eu awk cd && readonly
+		"$@" sed ${HOME} done printf readonly done $(pwd) printf local
+	done readonly sed --verbose --verbose 2>/dev/null /usr/bin
+		'quoted text' 'quoted text' grep 'quoted text'
+		'quoted text' sed 'quoted text' export 2>/dev/null
+		printf test --verbose grep local 'quoted text' test then echo | awk echo
+awk cd && --verbose --verbose grep
+	--verbose ${HOME} | &&
+		-eu | --verbose 2>/dev/null test sed printf cd
+		| "$1" sed 2>/dev/null | /usr/bin cd &&
+		2>/dev/null ${HOME} && then
+		cd export /usr/bin then /usr/bin grep done readonly
+	sed echo --verbose 2>/dev/null -eu -eu 'quoted text'
+2>/dev/null && awk x=1 2>/dev/null cd 2>/dev/null
+		--verbose -eu "$@" | then x=1 echo x=1 awk && readonly
+	readonly echo $(pwd) --verbose --verbose
+	awk export "$1" /usr/bin -eu echo local export
+"$@" done sed && | then && && | then -eu cd "$@" export x=1 && ${HOME} done export
+	"$1" 2>/dev/null "$@" cd local sed -eu export printf done 2>/dev/null
+	x=1 "$@" done $(pwd) cd | awk 2>/dev/null grep echo ${HOME} "$1"
+"$1" local readonly 2>/dev/null /usr/bin $(pwd) done cd
+	printf 2>/dev/null then x=1 then | local cd grep grep | "$1" test ${HOME}
+		| printf --verbose | export echo "$1" -eu awk printf cd && readonly 'quoted text'
+	cd printf $(pwd) test export local cd test "$1" x=1 && printf
+		then readonly && -eu export
+	export test export 'quoted text'
+	grep ${HOME} && then --verbose /usr/bin test cd printf $(pwd) readonly
+	'quoted text' then test $(pwd) "$@" readonly "$1" then $(pwd)
+		-eu 'quoted text' local then -eu && awk local printf ${HOME} -eu 'quoted text'
+		done $(pwd) grep 2>/dev/null
+x=1 'quoted text' $(pwd) /usr/bin "$1" cd cd done "$@" 2>/dev/null
+		$(pwd) 2>/dev/null ${HOME} readonly && 'quoted text' /usr/bin
+readonly ${HOME} export /usr/bin "$@" -eu "$1"
+$(pwd) done done test $(pwd) 'quoted text' readonly local awk
+	/usr/bin readonly --verbose "$1" /usr/bin --verbose done then "$@" 2>/dev/null
+awk done cd grep && "$1" /usr/bin 2>/dev/null cd
+		$(pwd) cd x=1 "$1" awk "$@" test | done /usr/bin awk /usr/bin
+		awk | sed $(pwd) readonly echo "$1" "$@" --verbose --verbose
+	/usr/bin sed ${HOME} 2>/dev/null 'quoted text' then local sed echo
+		test test cd test then local grep done /usr/bin grep done $(pwd) done /usr/bin then
+	"$1" --verbose 'quoted text'
+'quoted text' | 'quoted text' then -eu --verbose grep grep -eu && sed readonly
+	&& "$1" readonly --verbose
+		--verbose local /usr/bin
+		--verbose "$1" awk "$1" && $(pwd) --verbose printf echo
+		done | echo "$@" && export $(pwd) printf | 2>/dev/null printf -eu 2>/dev/null
+	-eu sed grep echo /usr/bin -eu export readonly grep echo -eu $(pwd)
+echo done --verbose done
+grep 'quoted text' local | sed && echo readonly test printf
+"$1" 2>/dev/null "$@" export /usr/bin | then readonly
+		| 2>/dev/null awk echo "$1" "$1" 2>/dev/null
+		cd grep && $(pwd) cd done 'quoted text' ${HOME} echo | printf test -eu
+		cd $(pwd) local readonly 2>/dev/null --verbose && x=1 /usr/bin x=1
+awk cd x=1 done echo awk then
+awk readonly sed readonly printf ${HOME} && grep cd
+x=1 x=1 then 'quoted text' printf readonly done /usr/bin --verbose then export
+	"$1" 2>/dev/null /usr/bin "$1" --verbose "$1" then sed
+/usr/bin | /usr/bin 'quoted text' grep
+| test --verbose cd done && then && done x=1 readonly echo test export
+--verbose local sed | --verbose 'quoted text' --verbose echo | |
+		echo 2>/dev/null cd ${HOME} "$@"
+	test done 'quoted text' x=1 ${HOME} "$@"
+	$(pwd) x=1 | readonly -eu 'quoted text' "$@" | then printf
+$(pwd) printf "$@" --verbose
+	awk | "$@" test sed 'quoted text' $(pwd)
+		&& ${HOME} awk done awk local $(pwd) ${HOME} /usr/bin -eu "$1" grep 'quoted text'
+sed awk sed x=1 done done then | 2>/dev/null readonly
+	2>/dev/null x=1 /usr/bin then "$@" ${HOME} /usr/bin
+	awk $(pwd) "$1" echo awk 2>/dev/null printf printf
+--verbose /usr/bin readonly -eu
+-eu -eu /usr/bin done local echo ${HOME} printf grep && then
+	| cd sed /usr/bin 'quoted text' | ${HOME}
+		then 'quoted text' test sed test printf export 2>/dev/null sed --verbose x=1
+		sed "$@" export test "$1" 2>/dev/null 'quoted text' echo $(pwd) export --verbose
+		-eu -eu readonly | grep readonly ${HOME}
+		"$1" ${HOME} sed grep printf 'quoted text' export
+"$@" -eu "$1" test /usr/bin echo grep echo "$1" printf && done echo $(pwd)
+	readonly readonly printf
+		-eu && local test --verbose
+	awk ${HOME} awk x=1 awk | -eu --verbose --verbose
+-eu then "$1" 'quoted text' && done --verbose $(pwd) done sed echo cd test x=1 -eu
+	grep 2>/dev/null local grep && echo cd grep "$@" done
+| 2>/dev/null /usr/bin sed export -eu | printf cd
+	then grep then grep local --verbose readonly
+	${HOME} ${HOME} grep /usr/bin done printf ${HOME}
+	| test "$1" cd sed /usr/bin /usr/bin
+	-eu sed echo | sed cd then /usr/bin
+	2>/dev/null then "$@" cd local 'quoted text' -eu then then --verbose
+		&& -eu $(pwd) $(pwd) export awk readonly
+"$@" "$1" then | cd 'quoted text' "$@" && test readonly
+	--verbose done 2>/dev/null "$@" test --verbose
+&& ${HOME} test --verbose -eu "$1" done printf export ${HOME} test
+cd test 'quoted text' then --verbose
+		local test test /usr/bin && 'quoted text'
+grep export --verbose test 2>/dev/null local local
+		/usr/bin printf "$1" "$@" grep printf export x=1 done $(pwd) printf local export
+sed 'quoted text' -eu "$@" --verbose echo "$1"
+$(pwd) printf --verbose sed echo -eu readonly x=1
+	test -eu 2>/dev/null done export
+cd awk done cd ${HOME} $(pwd) cd 2>/dev/null /usr/bin $(pwd) readonly local
+	2>/dev/null cd local | -eu /usr/bin /usr/bin 2>/dev/null /usr/bin $(pwd)
+'quoted text' test /usr/bin grep echo echo cd then awk ${HOME} "$1"
+"$1" "$1" awk export readonly sed && echo -eu grep done | -eu grep -eu
+grep --verbose 'quoted text' cd local awk then "$1"
+		x=1 echo readonly && 2>/dev/null test sed grep
+local "$@" $(pwd) "$1" local -eu x=1 export "$1" /usr/bin readonly 'quoted text'
+${HOME} --verbose local then -eu awk ${HOME} /usr/bin printf sed x=1 awk
+		local "$1" sed test echo cd echo 'quoted text' local sed printf echo test readonly
+		awk readonly 'quoted text' 2>/dev/null x=1 x=1 echo --verbose local sed x=1 test
+		printf printf readonly export echo "$1" ${HOME} printf readonly sed echo
+	--verbose export 2>/dev/null "$@" "$@" then | export test
+	$(pwd) local readonly test -eu
+/usr/bin then $(pwd) 2>/dev/null
+	cd x=1 --verbose /usr/bin x=1 then done grep x=1 "$1" then done ${HOME} cd
+		test test then awk ${HOME} "$@" echo printf done test
+	grep -eu then export sed ${HOME} /usr/bin cd && echo echo then awk --verbose
+		x=1 "$1" done /usr/bin done grep
+		"$@" echo sed then local | && $(pwd) test x=1 && local local $(pwd)
+	| 2>/dev/null "$@" x=1 local
+	&& readonly --verbose readonly --verbose
+	local "$1" test test awk then
+	awk 2>/dev/null grep local printf awk echo local 'quoted text' x=1
+		done 'quoted text' 2>/dev/null /usr/bin done echo
+test ${HOME} --verbose 2>/dev/null 'quoted text' | sed x=1
+--verbose grep "$1" cd && echo test sed echo
+	${HOME} printf x=1 /usr/bin ${HOME} readonly $(pwd) $(pwd)
+	readonly echo -eu "$1" awk readonly local sed then grep
+printf sed /usr/bin cd awk --verbose cd $(pwd) ${HOME} x=1 /usr/bin
+		| ${HOME} x=1 $(pwd) /usr/bin
+done ${HOME} then cd x=1 2>/dev/null --verbose && test "$1"
+export | 'quoted text' 2>/dev/null sed ${HOME} sed | export -eu local
+		"$1" echo readonly export
+	"$1" then --verbose "$@" test printf
+sed 'quoted text' "$1" test test printf 'quoted text'
+	&& printf cd 2>/dev/null --verbose grep 'quoted text'
+		'quoted text' -eu --verbose /usr/bin then 2>/dev/null grep 2>/dev/null awk printf
+"$1" 'quoted text' /usr/bin -eu cd | $(pwd) --verbose sed awk cd /usr/bin
+	grep 'quoted text' cd | "$@" sed "$1" test | printf
+grep && | local 2>/dev/null x=1 'quoted text' local
+"$@" then grep && /usr/bin /usr/bin cd test awk -eu 'quoted text' printf
+	grep -eu -eu cd "$1" 'quoted text' && --verbose readonly
+		export test && then 2>/dev/null x=1 printf $(pwd)
+		done then cd $(pwd) | "$@" && "$@" cd awk done awk -eu echo "$@" test && cd
+		cd awk x=1 | --verbose 2>/dev/null cd local awk grep
+		$(pwd) echo done && /usr/bin 'quoted text' $(pwd) awk local cd "$1" "$1" readonly
+		-eu /usr/bin x=1 awk "$@" awk $(pwd)
+	| x=1 awk cd | printf ${HOME} 'quoted text'
+		grep cd export | done done /usr/bin echo echo done done ${HOME} $(pwd) -eu printf
+		$(pwd) grep $(pwd) done ${HOME} local $(pwd) -eu local readonly
+		local "$1" | awk $(pwd) cd export echo echo grep -eu ${HOME} test cd then local
+	done cd x=1 ${HOME} cd awk awk 2>/dev/null "$@" -eu 'quoted text' $(pwd)
+then readonly export awk "$@" test sed && export -eu "$@" echo -eu x=1 echo
+		2>/dev/null x=1 --verbose
+	readonly test done && x=1 done | && grep awk
+		sed echo readonly echo $(pwd) local /usr/bin local ${HOME} 2>/dev/null grep
+grep export 2>/dev/null 'quoted text' --verbose
+"$1" && echo -eu echo printf |
+${HOME} done "$1" cd cd && cd 'quoted text' then
+	/usr/bin test -eu "$1" $(pwd) test
+	local export ${HOME} grep grep
+	grep 2>/dev/null ${HOME} then && 'quoted text' printf readonly &&
+		cd --verbose grep grep $(pwd)
+		cd 'quoted text' awk | echo /usr/bin done $(pwd) echo x=1 2>/dev/null -eu
+		"$@" grep cd $(pwd) printf local /usr/bin /usr/bin sed && $(pwd) awk done
+test /usr/bin test cd test | readonly export then cd test awk 2>/dev/null
+		"$@" sed "$1" "$@" /usr/bin 'quoted text' grep printf -eu -eu 'quoted text' ${HOME}
+sed | export sed printf then sed done $(pwd) "$1" --verbose local --verbose
+		"$@" done 'quoted text' then then 'quoted text' "$1" then echo awk
+cd "$1" ${HOME} readonly local test test --verbose grep done
+		x=1 "$1" local ${HOME} awk cd -eu readonly
+-eu then done 'quoted text' --verbose "$1" | done "$@" then x=1 printf
+local test "$@" cd "$@" grep ${HOME} 2>/dev/null "$1" x=1 2>/dev/null $(pwd)
+		&& | | "$1" cd grep $(pwd) sed cd then $(pwd)
+	&& && export printf readonly cd sed cd cd ${HOME} -eu echo && "$@"
+	readonly 'quoted text' test | done "$@" test | 2>/dev/null
+'quoted text' && export "$@" | 'quoted text'
+	echo -eu && | test ${HOME} "$1"
+	'quoted text' "$1" echo printf --verbose -eu /usr/bin 'quoted text'
+	echo ${HOME} "$1" x=1 then 'quoted text'
+		grep "$1" "$1" --verbose 'quoted text'
+	--verbose cd --verbose sed grep sed export then | "$1"
+		cd "$@" ${HOME} | local 'quoted text'
+		/usr/bin echo && | "$1" export
+2>/dev/null grep echo "$1"
+local "$1" "$@" local done
+	test -eu | sed readonly readonly export test awk sed export
+		sed /usr/bin --verbose grep export "$1" --verbose
+		"$1" "$@" echo ${HOME} local readonly grep && test
+	"$@" $(pwd) "$1" export export printf echo awk local ${HOME} 'quoted text'
+grep /usr/bin awk done readonly $(pwd) echo
+		2>/dev/null then echo "$@" x=1 $(pwd)
+	--verbose $(pwd) 2>/dev/null x=1 echo
+"$1" | --verbose "$1" test readonly --verbose /usr/bin ${HOME} printf "$@"
+	--verbose local $(pwd) sed export done $(pwd) 'quoted text' readonly export
+		"$1" awk x=1 echo x=1 'quoted text' test export 2>/dev/null awk
+sed awk "$@" awk cd -eu test "$1" test $(pwd) --verbose
+	done echo grep echo done
+sed echo awk x=1 -eu readonly 'quoted text' awk | ${HOME} 2>/dev/null local
+		test x=1 awk export ${HOME} x=1 && /usr/bin && /usr/bin echo done | $(pwd)
+"$1" && 2>/dev/null 'quoted text' readonly 'quoted text'
+		"$1" test readonly export | awk done awk "$@" --verbose | awk printf
+		/usr/bin printf ${HOME} sed awk && then local local
+local | echo ${HOME} awk then | then grep | grep $(pwd) x=1 ${HOME} local 2>/dev/null
+${HOME} "$1" /usr/bin ${HOME} done
+		local -eu local grep /usr/bin local printf | export | grep &&
+		export echo x=1 done -eu sed x=1 "$1" "$@" printf test
+/usr/bin grep x=1 x=1
+		printf readonly awk test | local $(pwd) test cd then then $(pwd) readonly
+	x=1 x=1 done export done "$1" 'quoted text' sed && --verbose
+	readonly "$@" "$1" printf export -eu cd sed grep "$@"
+		&& -eu 2>/dev/null $(pwd) 'quoted text' cd
+$(pwd) readonly cd echo -eu x=1 --verbose "$1" cd sed test then export
+	--verbose readonly $(pwd) test && $(pwd) 'quoted text' "$@" echo | | x=1 done
+	-eu local -eu -eu readonly 'quoted text' printf printf awk x=1 echo 'quoted text'
+		grep local export cd 'quoted text' echo /usr/bin
+	local 2>/dev/null sed -eu readonly /usr/bin 2>/dev/null && done
+| && grep 2>/dev/null /usr/bin /usr/bin sed ${HOME}
+		local && local export x=1
+		&& awk | echo x=1 sed local && export
+		readonly && sed -eu && --verbose ${HOME} /usr/bin cd /usr/bin $(pwd) 'quoted text'
+cd 'quoted text' 'quoted text' && done | /usr/bin 2>/dev/null "$1" printf
+awk cd then grep readonly 2>/dev/null $(pwd) awk printf then | ${HOME}
+	/usr/bin done "$1" 2>/dev/null export
+		readonly -eu export sed test test "$@" 2>/dev/null
+		cd echo awk && "$@" 'quoted text' done ${HOME} grep x=1 ${HOME} "$@" grep
+		${HOME} -eu local 'quoted text'
+		'quoted text' awk -eu cd done $(pwd)
+	"$1" awk then "$@" readonly ${HOME}
+		| echo x=1 "$1" && echo test x=1 cd export
+		"$@" $(pwd) -eu test 2>/dev/null echo echo ${HOME} $(pwd) $(pwd) local export
+		-eu 2>/dev/null cd "$@" printf -eu -eu
+	"$1" test awk cd 'quoted text' $(pwd) $(pwd) 'quoted text'
+then done done printf sed local $(pwd) printf
+/usr/bin sed then ${HOME} echo 'quoted text'
+	$(pwd) 'quoted text' x=1 2>/dev/null /usr/bin 2>/dev/null
+	echo grep test printf done x=1 local cd test sed local /usr/bin
+	"$1" --verbose ${HOME} --verbose
+		/usr/bin grep grep readonly | 2>/dev/null
+		export echo | ${HOME} "$@" readonly export "$1"
+	"$1" grep | test && x=1 2>/dev/null ${HOME} -eu 2>/dev/null && sed 2>/dev/null
+	readonly 'quoted text' | $(pwd) --verbose "$@" --verbose
+done 2>/dev/null -eu cd done printf 2>/dev/null
+export && ${HOME} done printf readonly 2>/dev/null --verbose --verbose
+		local grep x=1 $(pwd) then readonly grep cd
+		-eu sed ${HOME} then && done /usr/bin 2>/dev/null "$1" test && 'quoted text'
+		"$@" awk /usr/bin $(pwd) x=1 -eu
+"$@" $(pwd) awk /usr/bin echo awk -eu "$@" echo /usr/bin
+awk test local done "$@" ${HOME} grep -eu
+		x=1 --verbose done readonly && readonly
+	export cd 2>/dev/null awk -eu local export
+/usr/bin printf printf sed --verbose done
+	$(pwd) cd x=1 awk --verbose test local test readonly | | grep
+		"$@" awk awk sed && printf x=1 export $(pwd) | x=1 | grep awk
+	local cd local grep cd "$1" awk &&
+cd && done grep printf /usr/bin
+		x=1 -eu && export sed awk sed readonly printf done
+		'quoted text' cd "$1" done -eu | -eu -eu /usr/bin
+	$(pwd) "$1" local readonly readonly
+"$1" 2>/dev/null done
+	local cd test x=1 readonly "$1" /usr/bin
+	readonly echo test printf $(pwd) test export done 'quoted text' test done 2>/dev/null
+	awk export readonly export sed then /usr/bin -eu -eu && echo test 'quoted text'
+test printf $(pwd) $(pwd) local x=1 awk test
+		sed sed --verbose 2>/dev/null echo then 'quoted text' $(pwd) readonly
+		test x=1 export grep -eu && x=1 readonly echo --verbose sed
+2>/dev/null 'quoted text' x=1 echo | 2>/dev/null awk grep readonly ${HOME}
+		done done readonly cd done ${HOME} -eu readonly | then --verbose 2>/dev/null
+$(pwd) echo 2>/dev/null /usr/bin done && export
+		echo awk ${HOME} --verbose export "$@" /usr/bin then cd /usr/bin
+		local export ${HOME} local test
+		grep x=1 then export echo local readonly readonly
+		test 'quoted text' done
+test 2>/dev/null -eu --verbose "$1" --verbose
+		'quoted text' "$@" test done 'quoted text' printf readonly local /usr/bin 'quoted text'
+$(pwd) export x=1 | "$1" --verbose
+	| grep && x=1 && export --verbose grep local
+$(pwd) local | $(pwd) && "$1"
+"$1" cd grep done done $(pwd)
+		'quoted text' grep done
+		2>/dev/null "$1" "$@" $(pwd) done 'quoted text' test "$@" --verbose
+echo readonly --verbose echo then $(pwd) local awk ${HOME} 2>/dev/null
+		printf -eu --verbose 'quoted text' ${HOME} | cd "$@" /usr/bin -eu readonly
+-eu -eu then | cd | readonly "$@" /usr/bin
+	&& -eu local cd readonly ${HOME} export sed
+echo 2>/dev/null local test test awk cd sed /usr/bin sed awk 'quoted text' |
+	"$1" then "$@" then -eu
+-eu grep test --verbose | export test
+2>/dev/null export echo printf && -eu 2>/dev/null then $(pwd) && &&
+x=1 "$@" ${HOME} echo sed local --verbose sed test
+2>/dev/null | "$@" grep x=1 | local
+export printf local awk export printf test x=1 export local ${HOME}
+awk 2>/dev/null "$1" done echo 2>/dev/null ${HOME} 'quoted text'
+	done -eu -eu readonly readonly $(pwd) 2>/dev/null echo printf
+grep then then -eu /usr/bin printf 'quoted text' sed readonly
+local awk 2>/dev/null 2>/dev/null ${HOME} cd local
+		local sed test && $(pwd) "$@" | -eu cd 2>/dev/null ${HOME}
+	readonly echo local -eu cd | | test 2>/dev/null
+	readonly then $(pwd) grep
+	grep "$1" 'quoted text' "$@" readonly test then --verbose grep 2>/dev/null
+then sed "$1" local && sed /usr/bin x=1 local grep local
+readonly 2>/dev/null $(pwd)
+		printf 2>/dev/null && $(pwd) printf "$1" -eu 2>/dev/null local awk -eu
+local readonly grep sed 'quoted text' -eu grep /usr/bin grep grep 'quoted text'
+		test 'quoted text' --verbose "$1" then "$@" cd echo cd ${HOME} grep then export
+	grep -eu && -eu x=1 "$@" sed done ${HOME} | $(pwd) then cd 'quoted text'
+'quoted text' awk grep /usr/bin && 2>/dev/null "$1" 2>/dev/null
+printf test /usr/bin ${HOME} && echo "$1" then
+	done && readonly sed "$@" grep "$1" then x=1 x=1 echo awk done
+then ${HOME} 'quoted text' readonly && x=1 "$1" sed then --verbose 'quoted text'
+		| "$@" 2>/dev/null 2>/dev/null --verbose "$@"
+	grep test local -eu awk
+	/usr/bin readonly 'quoted text' sed awk cd then test "$@" /usr/bin x=1
+		readonly awk sed then && done
+done "$@" $(pwd) ${HOME} local echo sed $(pwd) readonly
+	echo ${HOME} && ${HOME} sed test
+	test | "$@" export x=1 /usr/bin export
+cd printf 2>/dev/null ${HOME}
+	echo local done $(pwd) readonly 'quoted text' | -eu grep readonly test export echo
+	"$@" done grep test "$@" test 2>/dev/null readonly
+printf local /usr/bin && sed | "$1"
+'quoted text' "$@" ${HOME} --verbose
+		cd "$@" sed sed 'quoted text'
+		-eu test 'quoted text' && 2>/dev/null "$@" grep ${HOME}
+printf grep /usr/bin readonly
+		printf --verbose printf 'quoted text' local --verbose
+	printf export sed cd /usr/bin && "$1" then
+export ${HOME} --verbose echo -eu | awk $(pwd) 2>/dev/null
+/usr/bin readonly then done done | cd -eu 2>/dev/null ${HOME}
+		x=1 printf /usr/bin done 'quoted text' printf echo $(pwd)
+"$@" --verbose then grep -eu 2>/dev/null
+	awk "$1" cd test ${HOME} local cd readonly printf
+x=1 echo then "$1" $(pwd) done
+		export "$1" echo && | printf sed sed && printf then x=1 cd 'quoted text'
+	grep done sed 'quoted text' local ${HOME} test $(pwd) 'quoted text'
+		grep local | done then grep export 2>/dev/null
+test echo && done done printf awk local 'quoted text' /usr/bin readonly ${HOME}
+		2>/dev/null && ${HOME} awk 2>/dev/null x=1 printf x=1 'quoted text'
+		"$@" sed cd then echo 2>/dev/null echo sed sed then "$1" readonly
+	cd --verbose --verbose then "$1" "$1" --verbose
+		echo cd test $(pwd) then printf
+	echo export printf test | x=1 $(pwd) awk "$@" --verbose
+	sed "$1" "$1" awk 'quoted text' /usr/bin sed sed sed "$@"
+readonly done ${HOME} cd $(pwd)
+local "$1" then grep then ${HOME} |
+export x=1 grep then awk "$1" sed echo 2>/dev/null sed 'quoted text'
+		'quoted text' test "$@" 'quoted text' &&
+local echo -eu awk local -eu "$@"
+		-eu "$1" "$1" then x=1 2>/dev/null
+	"$@" --verbose sed printf done --verbose awk readonly test
+awk && --verbose $(pwd) echo 'quoted text' "$@" printf | done test
+	export 2>/dev/null sed printf | grep printf
+	local 2>/dev/null 2>/dev/null export "$1" sed /usr/bin
+	export x=1 readonly && -eu
+		"$@" && awk echo && x=1
+	x=1 test | /usr/bin 'quoted text' grep -eu --verbose
+		&& | ${HOME} printf --verbose "$1" export 'quoted text'
+test x=1 then && awk "$@" awk export done export 'quoted text'
+	cd readonly local "$@" | printf 2>/dev/null
+	&& "$1" -eu sed readonly | --verbose echo -eu export readonly
+$(pwd) x=1 echo --verbose $(pwd)
+		printf sed $(pwd) 'quoted text'
+	/usr/bin 'quoted text' 'quoted text'
+'quoted text' "$@" done | done "$1" cd echo -eu "$@" && 'quoted text' echo $(pwd)
+	local cd awk done cd $(pwd) test then printf x=1 then | | x=1 printf /usr/bin
+2>/dev/null sed local readonly 'quoted text' then export readonly
+		cd done awk x=1 local export test
+	--verbose done x=1 --verbose 'quoted text' -eu x=1 "$1" x=1 $(pwd) echo
+then readonly sed export readonly
+		then 'quoted text' /usr/bin printf printf && local readonly
+		--verbose echo 2>/dev/null -eu -eu && sed export "$@" then awk done sed
+	&& then grep printf | local && readonly /usr/bin -eu
+export then cd cd echo grep ${HOME} && | "$1" test "$@" readonly printf -eu readonly
+readonly x=1 awk printf readonly readonly echo ${HOME} cd -eu x=1 then ${HOME}
+		"$@" local "$1" && sed && test -eu then $(pwd) grep 2>/dev/null done local /usr/bin
+$(pwd) grep "$@" | test echo
+		grep printf readonly && "$@" /usr/bin
+		local x=1 /usr/bin export cd "$1" readonly "$@" awk then $(pwd) sed 2>/dev/null
+		/usr/bin x=1 cd grep grep then grep |
+	printf $(pwd) /usr/bin export
+	printf 2>/dev/null ${HOME} readonly
+		| 2>/dev/null local done x=1
+		readonly /usr/bin x=1 test test then cd sed export ${HOME} | "$@" awk x=1
+| /usr/bin 2>/dev/null printf ${HOME} echo echo done then 2>/dev/null done cd
+sed done && --verbose ${HOME} "$1" test 2>/dev/null
+		cd then printf 'quoted text' sed /usr/bin "$1" x=1 readonly -eu cd
+	$(pwd) sed 'quoted text' sed awk | sed echo export echo then && x=1 "$1" 2>/dev/null
+-eu $(pwd) x=1 --verbose awk $(pwd) grep /usr/bin local /usr/bin
+	/usr/bin --verbose done test && -eu 2>/dev/null
+	test 2>/dev/null cd "$@" "$1" sed "$1"
+	| --verbose "$1" | readonly readonly
+		then awk done "$@" $(pwd) "$@" | echo $(pwd) "$1" "$1"
+	echo then && then echo test test local
+| --verbose grep --verbose x=1 /usr/bin --verbose /usr/bin
+cd awk export && && 2>/dev/null readonly /usr/bin echo 'quoted text' echo
+	done && 2>/dev/null "$1" sed ${HOME} then export
+	| --verbose $(pwd) | local | grep sed /usr/bin ${HOME}
+		$(pwd) "$1" x=1 local ${HOME} --verbose --verbose -eu readonly
+		then test $(pwd) --verbose --verbose
+		-eu --verbose done echo readonly export then local sed "$@"
+2>/dev/null -eu cd 2>/dev/null 2>/dev/null test
+		sed ${HOME} $(pwd) sed -eu 'quoted text' echo
+	"$@" | awk 2>/dev/null echo done cd 'quoted text' local /usr/bin grep | ${HOME}
+then awk done -eu printf x=1 x=1 export "$@" 'quoted text' 'quoted text' ${HOME}
+		export printf $(pwd) readonly $(pwd) /usr/bin local echo printf ${HOME}
+/usr/bin $(pwd) then | local readonly export x=1 test printf awk x=1 | "$@" "$@"
+grep /usr/bin $(pwd) cd grep done readonly ${HOME} /usr/bin "$@" 'quoted text'
+		--verbose ${HOME} done /usr/bin | 2>/dev/null grep cd
+		--verbose | awk 2>/dev/null "$1" local
+	local "$1" then readonly "$1" done
+then sed | then "$1" printf |
+		${HOME} export cd printf printf -eu readonly ${HOME} 'quoted text'
+		export echo echo | readonly --verbose "$@" && "$1" ${HOME}
+	test awk awk 'quoted text' 2>/dev/null
+	export x=1 x=1 cd | local 2>/dev/null printf readonly
+	"$@" printf ${HOME} "$1" test test printf -eu 'quoted text'
+sed "$1" awk "$1" "$1" printf $(pwd) test --verbose cd ${HOME} then
+then local | test ${HOME} --verbose echo 2>/dev/null
+		export 2>/dev/null cd cd echo sed $(pwd) x=1 -eu echo --verbose grep $(pwd)
+	then export sed | printf | awk local then grep cd export | ${HOME}
+then && echo /usr/bin cd 'quoted text'
+| echo export "$@" echo sed "$1" "$1" echo && && readonly
+		$(pwd) && 'quoted text' ${HOME} 2>/dev/null "$@"
+		cd grep ${HOME} $(pwd) export test sed --verbose readonly 'quoted text'
+	readonly 'quoted text' /usr/bin $(pwd) sed
+		test then printf | && grep $(pwd) ${HOME}
+		awk "$1" export grep local | awk --verbose "$@" /usr/bin readonly readonly
+grep cd "$1" cd echo cd then -eu "$@" grep
+		echo sed export sed 2>/dev/null
+then sed then test sed 'quoted text' 2>/dev/null
+grep awk /usr/bin $(pwd) ${HOME} printf cd echo x=1 ${HOME}
+awk ${HOME} grep -eu /usr/bin then test readonly local
+		local x=1 2>/dev/null "$1" "$@" then "$@" export then && sed ${HOME}
+		then "$@" 'quoted text' 'quoted text' readonly && "$1" export cd cd grep -eu
+	local 2>/dev/null grep -eu then
+'quoted text' --verbose grep /usr/bin -eu readonly &&
+		'quoted text' done export export then "$@" "$@"
+		--verbose /usr/bin 2>/dev/null grep 2>/dev/null
+	test printf awk grep test
+		readonly echo awk printf readonly 2>/dev/null then /usr/bin "$1" readonly
+		done cd done local 2>/dev/null -eu && x=1 readonly printf test local "$1"
+	export test 'quoted text' "$1" $(pwd) done local 'quoted text' 2>/dev/null
+		echo test /usr/bin then
+		export --verbose then 2>/dev/null 'quoted text'
+		'quoted text' && test then echo grep grep &&
+&& readonly printf "$1"
+	readonly -eu $(pwd) 'quoted text' -eu
+"$@" "$1" export 'quoted text' 2>/dev/null | | readonly then
+	echo then 2>/dev/null cd sed "$1" awk grep
+		echo && sed awk test awk done && -eu cd awk
+	printf sed export export -eu export /usr/bin echo
+	2>/dev/null --verbose then &&
+		| local "$@" then 2>/dev/null -eu grep 'quoted text' $(pwd) printf
+	&& -eu ${HOME} -eu export "$@" then grep "$1" | readonly $(pwd)
+-eu export "$@" x=1 x=1
+sed local then local -eu
+| then printf | readonly x=1 /usr/bin
+	cd /usr/bin 2>/dev/null && sed -eu sed 2>/dev/null
+		"$@" --verbose test "$@" readonly readonly --verbose
+export done | && cd 'quoted text'
+		${HOME} then $(pwd) awk cd awk then 'quoted text' grep then --verbose
+	2>/dev/null /usr/bin readonly /usr/bin && done readonly 2>/dev/null
+		done cd --verbose cd done --verbose --verbose /usr/bin 2>/dev/null
+	printf ${HOME} echo done readonly
+		"$@" 'quoted text' echo &&
+	${HOME} export export then
+		echo "$1" readonly echo "$@" --verbose then && 'quoted text' then local
+test awk local x=1 $(pwd) "$1" awk ${HOME} local
+then printf export && 2>/dev/null awk "$@" local ${HOME}
+-eu -eu awk | then then export sed test ${HOME}
+/usr/bin readonly ${HOME} ${HOME} /usr/bin $(pwd) -eu done sed test $(pwd)
+	then printf test 'quoted text' readonly /usr/bin local -eu "$@" local
+grep readonly -eu -eu /usr/bin
+	awk x=1 local | --verbose test "$@" /usr/bin
+		export -eu test | test test done export /usr/bin
+		| | test printf sed then && /usr/bin /usr/bin
+	&& "$@" readonly export
+	"$1" done done echo "$1"
+		--verbose $(pwd) -eu done ${HOME} "$1" done export
+	printf x=1 | export --verbose $(pwd)
+done $(pwd) export | test export
+export | -eu done done readonly grep grep export local -eu readonly printf
+-eu echo export -eu x=1 $(pwd)
+	local export /usr/bin export 2>/dev/null echo cd done cd --verbose x=1 cd
+	echo then echo 2>/dev/null
+		echo printf ${HOME} --verbose sed x=1 grep test -eu
+	/usr/bin then && then export echo awk echo
+readonly x=1 export local /usr/bin "$@"
+| printf x=1 "$1" $(pwd) -eu test then echo --verbose "$1" && "$@" /usr/bin
+	${HOME} | grep awk --verbose sed x=1 printf ${HOME}
+	printf 2>/dev/null "$1" "$@"
+	cd test x=1 then awk
+sed && then readonly "$1" readonly printf && -eu grep
+	echo export $(pwd) printf export | awk sed export
+		2>/dev/null /usr/bin && "$1" done $(pwd) echo local
+		export grep done 'quoted text'
+export 'quoted text' "$@" cd ${HOME} sed -eu | echo x=1 test echo
+	$(pwd) && done test "$1" /usr/bin local $(pwd) export | then readonly "$1" awk
+	--verbose && echo test cd | export export
+'quoted text' && $(pwd) done 'quoted text'
+--verbose cd x=1 then echo export && then export sed printf
+	readonly awk awk then awk then echo ${HOME} sed export "$@" -eu | "$1" "$1"
+done echo export --verbose ${HOME} $(pwd)
+	2>/dev/null test x=1
+then readonly done $(pwd) && "$1" | awk
+		"$1" /usr/bin "$@" 'quoted text'
+	printf ${HOME} test ${HOME}
+		test ${HOME} 'quoted text' echo -eu test sed sed x=1 local
+grep grep test then local $(pwd) local grep done echo readonly then x=1
+	echo -eu /usr/bin sed cd done awk ${HOME} $(pwd) awk "$1"
+export test local echo && then x=1 awk ${HOME} local then x=1
+	sed /usr/bin | sed ${HOME} readonly 'quoted text'
+	x=1 --verbose printf grep readonly --verbose $(pwd)
+	printf /usr/bin 'quoted text'
+test printf "$@" && 'quoted text' grep
+		readonly --verbose printf
+&& && /usr/bin "$1" export test $(pwd) --verbose export --verbose echo | && x=1
+x=1 then echo ${HOME} --verbose | cd test cd awk --verbose
+2>/dev/null done awk 2>/dev/null --verbose $(pwd) -eu test "$@"
+'quoted text' local /usr/bin
+	"$@" && x=1 -eu $(pwd) printf ${HOME}
+	"$@" sed ${HOME} test x=1 done then printf ${HOME} test 'quoted text'
+	cd ${HOME} readonly sed then /usr/bin sed "$1" test -eu cd readonly
+		2>/dev/null | 'quoted text' cd export
+	test grep && readonly | -eu printf
+x=1 $(pwd) $(pwd) readonly && "$1" 'quoted text' cd && | | ${HOME}
+	test ${HOME} $(pwd) | $(pwd) /usr/bin
+| && echo done local --verbose ${HOME} x=1 then --verbose test "$@" cd
+	test | cd /usr/bin sed 'quoted text' grep /usr/bin
+	&& | 2>/dev/null echo test readonly x=1 -eu "$1" -eu printf
+	echo ${HOME} && "$@" ${HOME}
+	sed readonly && /usr/bin 'quoted text' /usr/bin 'quoted text' awk x=1 /usr/bin
+2>/dev/null && export sed printf cd awk | then -eu echo awk
+		${HOME} && echo done
+grep export echo test 2>/dev/null x=1 echo done cd test then then cd /usr/bin |
+		export export /usr/bin /usr/bin awk $(pwd) cd sed && 2>/dev/null $(pwd)
+	$(pwd) then "$1" "$@" export 2>/dev/null done 2>/dev/null cd sed
+	-eu | awk export --verbose /usr/bin grep -eu 'quoted text' $(pwd) ${HOME} "$@"
+echo test -eu -eu echo --verbose grep --verbose
+	'quoted text' "$@" | /usr/bin "$1" local $(pwd) -eu "$1"
+	$(pwd) readonly then grep then
+		echo && cd $(pwd) "$@" then readonly
+		x=1 $(pwd) export export printf awk "$1" && "$@" test
+		echo cd readonly test awk $(pwd) readonly echo sed awk
+		'quoted text' export echo /usr/bin
+readonly printf -eu test && grep grep printf
+	"$1" then | ${HOME} then grep test sed local "$1" grep readonly
+printf "$1" | awk test | cd "$@" awk printf -eu | cd $(pwd) readonly grep
+grep && printf $(pwd) -eu test cd awk 2>/dev/null cd test $(pwd) export
+echo echo awk -eu | "$1" $(pwd) export -eu grep ${HOME} local sed 'quoted text'
+	/usr/bin 'quoted text' "$1" sed $(pwd) sed "$@" 'quoted text'
+		sed readonly cd | echo -eu x=1
+		/usr/bin local ${HOME} test -eu /usr/bin done awk
+	then readonly 'quoted text' echo echo done echo grep ${HOME} --verbose
+"$1" --verbose "$1" done export ${HOME} $(pwd)
+		then local test echo -eu 'quoted text' x=1 sed
+"$@" 2>/dev/null 'quoted text'
+	awk grep /usr/bin | 2>/dev/null -eu done $(pwd) done
+awk $(pwd) readonly ${HOME} $(pwd) awk /usr/bin "$@" $(pwd) && 2>/dev/null
+	$(pwd) -eu 2>/dev/null x=1 export
+printf test | echo sed export "$@" sed --verbose 'quoted text' cd "$1" | test
+&& ${HOME} grep export printf "$@" --verbose sed then $(pwd) awk
+	export grep echo -eu 'quoted text'
+	export echo export ${HOME} | done "$@" awk cd sed sed | "$1" --verbose
+'quoted text' done awk test
+then /usr/bin echo echo test test export -eu "$@" cd && printf
+	| local 'quoted text' local printf awk "$1" export test readonly $(pwd) -eu
+		x=1 then | --verbose sed readonly "$1"
+readonly ${HOME} sed "$1" cd 2>/dev/null echo grep sed awk | 2>/dev/null
+		"$@" ${HOME} "$1" && then "$1" --verbose cd echo /usr/bin then
+		&& local $(pwd) local $(pwd) 2>/dev/null
+	$(pwd) cd done "$@" printf sed -eu --verbose 2>/dev/null
+		local -eu "$@" sed && printf
+		test | --verbose $(pwd) "$@" cd
+		test $(pwd) then --verbose awk echo printf --verbose | grep printf sed x=1 readonly
+	then export printf --verbose x=1
+		-eu cd export then /usr/bin test done awk local
+	x=1 echo /usr/bin "$@" 2>/dev/null /usr/bin
+	2>/dev/null readonly done --verbose -eu 'quoted text' awk printf echo /usr/bin -eu
+		&& cd local --verbose then 2>/dev/null
+		| grep 'quoted text' grep --verbose local local | cd echo x=1 printf && grep
+		sed $(pwd) awk /usr/bin x=1 readonly
+		/usr/bin done grep 'quoted text' ${HOME} sed awk export cd -eu && x=1 -eu then
+	&& done printf awk | awk -eu --verbose | printf && ${HOME} export -eu | readonly
+		local -eu test | test test x=1 export /usr/bin
+	$(pwd) grep x=1 'quoted text' && "$1" --verbose ${HOME} 'quoted text'
+	local echo printf local | then
+grep ${HOME} | printf && 'quoted text' | done
+	done "$@" && && "$1" awk then x=1 grep "$@" x=1 done readonly export done readonly
+--verbose cd printf sed /usr/bin ${HOME} 'quoted text'
+	&& | readonly /usr/bin "$@" "$@" done x=1
+		| ${HOME} $(pwd) /usr/bin 'quoted text' x=1 local echo -eu "$@" ${HOME} cd --verbose
+		readonly grep x=1 grep cd test done /usr/bin -eu sed x=1 2>/dev/null local
+		printf cd /usr/bin echo then then local echo done "$@" -eu then $(pwd) 'quoted text'
+		${HOME} then ${HOME} "$1" | export /usr/bin
+	/usr/bin local | then && local -eu --verbose
+		--verbose $(pwd) cd 2>/dev/null && sed then ${HOME} &&
+	local then test && && printf
+/usr/bin cd export | test ${HOME} -eu
+	printf 2>/dev/null && readonly awk
+	then grep -eu -eu echo "$1" sed -eu $(pwd) ${HOME} echo
+export printf readonly sed done -eu awk 'quoted text' cd test test
+		awk $(pwd) echo local && x=1 -eu "$@"
+	printf printf x=1 test awk grep "$@" "$1" 'quoted text' | && sed grep
+		printf awk --verbose $(pwd) readonly awk ${HOME} then sed cd | local
+	| --verbose 2>/dev/null ${HOME} awk ${HOME} &&
+	cd grep cd sed --verbose $(pwd)
+		"$@" /usr/bin /usr/bin ${HOME} && | --verbose printf &&
+	echo done readonly test x=1
+		x=1 /usr/bin test done 2>/dev/null
+		grep ${HOME} echo export done
+&& 2>/dev/null ${HOME} 2>/dev/null then done
+	cd ${HOME} -eu test then && cd | /usr/bin then &&
+		/usr/bin cd awk printf
+		$(pwd) export "$1" export done --verbose $(pwd) then done "$1" test readonly
+	&& test test /usr/bin sed
+		cd sed done grep then awk x=1 $(pwd) local sed done grep 'quoted text' "$@"
+	test export x=1 -eu | | then | done
+cd $(pwd) 'quoted text' grep x=1 "$@" "$@" --verbose
+	echo done awk awk echo ${HOME} -eu "$@" /usr/bin printf /usr/bin /usr/bin then
+	2>/dev/null 2>/dev/null awk done grep test 'quoted text' $(pwd) $(pwd) --verbose
+		echo readonly "$1" then grep "$@" ${HOME} | ${HOME} export && && "$1" echo
+"$@" ${HOME} export "$1" done "$@" readonly && echo
+done cd ${HOME} ${HOME} 2>/dev/null 2>/dev/null echo && -eu x=1 x=1 local sed
+	cd readonly echo 2>/dev/null grep $(pwd) local
+then sed done done then "$@" ${HOME} local "$@"
+		grep "$1" echo then /usr/bin done printf && | "$1" | ${HOME}
+		/usr/bin 'quoted text' awk readonly 'quoted text' | "$1"
+	2>/dev/null awk -eu "$@" grep --verbose test export
+		cd "$1" && $(pwd) && "$@" 'quoted text' export awk test
+-eu cd printf readonly && -eu x=1 $(pwd) grep "$1" $(pwd) 2>/dev/null ${HOME}
+	then 2>/dev/null ${HOME} --verbose cd then /usr/bin ${HOME} local
+		awk readonly 'quoted text' "$@" && 2>/dev/null done x=1
+--verbose | local "$1" "$@" ${HOME}
+		/usr/bin "$1" done local printf printf
+echo local x=1 "$1" local echo echo printf /usr/bin "$@" "$@" "$@" export
+		-eu x=1 2>/dev/null 'quoted text' sed && 'quoted text' sed printf test printf x=1
+		/usr/bin /usr/bin echo | awk -eu ${HOME} /usr/bin x=1 "$@" done grep
+| sed "$@" printf -eu sed test grep printf
+	"$@" grep "$@" "$@" /usr/bin 2>/dev/null printf cd x=1 "$@"
+	${HOME} 'quoted text' grep $(pwd) x=1 local
+&& printf | local ${HOME} --verbose "$1" &&
+	${HOME} then done ${HOME} grep awk readonly then /usr/bin
+	then readonly readonly awk
+readonly | export -eu /usr/bin then -eu local
+		"$@" echo readonly printf printf then
+		readonly "$@" "$1" printf ${HOME} 'quoted text' printf grep ${HOME}
+		test && "$@" && -eu echo $(pwd) ${HOME} then "$1" $(pwd) | "$@" && printf
+&& done then cd ${HOME} local "$1" grep grep printf then test &&
+		| x=1 export x=1 ${HOME} | grep sed --verbose
+$(pwd) | 'quoted text' printf echo export
+&& 2>/dev/null then x=1 "$@" sed local "$@" awk grep ${HOME}
+		/usr/bin --verbose 'quoted text' --verbose readonly -eu
+		local echo "$@" ${HOME} 'quoted text' done /usr/bin
+		then awk grep $(pwd) cd test 'quoted text' cd
+sed then local grep ${HOME} awk grep cd
+	sed cd /usr/bin grep "$1"
+	--verbose -eu readonly printf local awk ${HOME} 2>/dev/null ${HOME} export awk
+#include c21.sh
+	printf test test "$1" done
+		'quoted text' cd printf printf cd && "$1" 2>/dev/null readonly printf "$@"
+		awk | /usr/bin local awk sed | grep "$@"
+		x=1 grep --verbose export
+local awk --verbose && test export x=1 --verbose awk --verbose 'quoted text'
+	readonly echo --verbose x=1 done --verbose $(pwd)
+	$(pwd) test --verbose "$1" then local "$1" "$@" "$@" x=1 local awk
+	2>/dev/null test sed sed --verbose echo echo export
+	local test --verbose echo "$1" 2>/dev/null
+local sed -eu printf local done x=1 --verbose grep done "$1" cd --verbose done
+	"$1" $(pwd) "$1" local && $(pwd)
+		"$1" awk -eu then /usr/bin then "$1" "$1" printf sed $(pwd) --verbose x=1
+		grep then grep grep sed export | ${HOME} /usr/bin | readonly cd | "$@" $(pwd)
+	export awk export ${HOME} printf readonly export grep local then awk "$@" | "$@"
+		test 2>/dev/null awk x=1 && printf
+	&& then echo "$@" grep "$1" ${HOME} 2>/dev/null
+		"$@" "$@" echo /usr/bin "$@"
+${HOME} ${HOME} echo export
+done printf ${HOME} export "$@"
+	&& && -eu printf grep local
+		-eu grep readonly awk 'quoted text' x=1 'quoted text'
+		readonly test x=1 then done done echo export x=1 /usr/bin 2>/dev/null
+	grep 'quoted text' test &&
+	then done -eu awk echo "$@" echo
+		"$1" printf | --verbose done echo echo test printf then
+		"$1" test ${HOME} "$@" printf test | printf x=1 x=1
+	2>/dev/null | awk sed export --verbose awk cd /usr/bin sed
+		2>/dev/null 2>/dev/null done printf $(pwd) && test | x=1 -eu $(pwd)
+	done done --verbose cd awk readonly export $(pwd) done done x=1 printf 2>/dev/null
+export x=1 done | --verbose ${HOME} --verbose cd grep
+grep test sed 'quoted text' local test --verbose 'quoted text' x=1 --verbose
+		&& 2>/dev/null "$1" --verbose sed --verbose /usr/bin 'quoted text' cd export sed
+printf | "$1" --verbose --verbose readonly export 2>/dev/null -eu
+	local grep /usr/bin "$1" x=1 2>/dev/null
+--verbose "$1" 2>/dev/null echo sed --verbose ${HOME} sed $(pwd) sed sed
+| /usr/bin -eu printf | /usr/bin
+		&& | export "$@" done 2>/dev/null 'quoted text'
+	$(pwd) echo then | /usr/bin
+		done --verbose && test 2>/dev/null then
+		echo readonly grep readonly
+	export && readonly cd | echo "$@" | "$@" awk && readonly ${HOME} local done
+	echo -eu ${HOME} done 2>/dev/null test 'quoted text' 2>/dev/null
+		$(pwd) done cd sed sed done sed cd ${HOME} test sed 'quoted text' echo
+		${HOME} readonly sed 'quoted text' export /usr/bin
+		printf | printf && echo awk | 'quoted text' $(pwd) && /usr/bin export
+		sed && "$@" sed $(pwd) awk printf 2>/dev/null test grep && |
+2>/dev/null grep x=1 then printf test
+	${HOME} /usr/bin export
+		"$@" "$1" export sed done awk cd -eu then then readonly $(pwd) --verbose
+		sed && 'quoted text' "$1" /usr/bin "$@" 2>/dev/null cd echo 'quoted text'
+test -eu -eu 'quoted text' ${HOME} cd echo cd x=1 2>/dev/null echo
+		| printf | then "$1" export then
+		| 2>/dev/null grep ${HOME} awk grep 2>/dev/null sed done 2>/dev/null
+	echo "$@" $(pwd) /usr/bin test && test export export
+		${HOME} 'quoted text' /usr/bin local test then | cd
+		local cd && then done awk -eu printf && ${HOME} grep sed export
+	sed printf && -eu awk local export | readonly grep 'quoted text'
+local 2>/dev/null | cd
+export x=1 "$1" /usr/bin && $(pwd) --verbose "$1" cd "$@"
+		cd done x=1 $(pwd) export --verbose export 'quoted text' 'quoted text' "$@"
+2>/dev/null && printf | 'quoted text'
+	local local then done test "$1" ${HOME} ${HOME}
+/usr/bin awk && ${HOME} local ${HOME} grep grep readonly then --verbose
+		readonly cd echo echo -eu export done x=1 grep
+$(pwd) printf then --verbose then 'quoted text' $(pwd) "$@" --verbose local $(pwd)
+		"$@" $(pwd) local | -eu -eu awk && "$1" grep $(pwd) ${HOME} test then "$1" echo
+	$(pwd) "$1" x=1 $(pwd)
+&& 'quoted text' done 2>/dev/null readonly "$@" && && local grep "$@"
+	printf done awk && echo | echo "$@" 2>/dev/null readonly -eu done -eu "$1" "$1"
+		echo then echo awk "$1" readonly cd
+${HOME} local "$1" x=1 awk grep echo 'quoted text' 2>/dev/null && then && "$1"
+| --verbose 'quoted text' 2>/dev/null && /usr/bin sed
+	echo done echo | /usr/bin |
+"$1" --verbose 'quoted text' export -eu printf echo x=1 export
+	"$1" "$1" printf /usr/bin
+cd awk done readonly export then export echo done x=1
+sed cd && --verbose 'quoted text' cd | | 2>/dev/null awk export "$@" done
+	"$@" local cd echo then --verbose local $(pwd) printf sed "$1" echo readonly
+$(pwd) export 2>/dev/null grep && printf | echo cd sed printf x=1 sed echo &&
+$(pwd) -eu done 2>/dev/null grep then echo
+	$(pwd) sed /usr/bin readonly -eu export "$@" sed --verbose sed then
+	${HOME} "$1" -eu echo grep && readonly printf printf export grep done
+$(pwd) sed then then cd export printf local awk | 2>/dev/null export
+	local local "$1" sed cd awk --verbose | export "$1" local
+echo export awk then "$1" readonly
+	grep echo test printf test readonly && | "$1" export cd "$1" "$1"
+		&& $(pwd) $(pwd) 'quoted text' local x=1 && $(pwd) /usr/bin 'quoted text' export
+		${HOME} 2>/dev/null sed "$@" grep --verbose 2>/dev/null
+	| done cd done echo | export printf done "$1" local local x=1 printf
+		printf readonly test export --verbose && then sed -eu && printf 2>/dev/null
+		done --verbose then 'quoted text' && && && sed readonly echo done local | |
+		x=1 && -eu done local
+	done cd /usr/bin /usr/bin printf export "$@" 2>/dev/null
+	cd 2>/dev/null cd readonly "$1"
+		export cd export echo grep export
+	awk 2>/dev/null -eu printf cd local test 2>/dev/null cd export 2>/dev/null
+		test /usr/bin test 2>/dev/null printf
+		2>/dev/null test --verbose --verbose test then | grep test
+	local local x=1 "$1" ${HOME} | x=1 --verbose && grep 2>/dev/null --verbose
+		local --verbose awk | -eu -eu
+	cd $(pwd) 2>/dev/null cd awk -eu -eu cd local
+cd ${HOME} x=1 2>/dev/null -eu 'quoted text' /usr/bin
+x=1 grep readonly grep $(pwd) printf
+	x=1 2>/dev/null && 'quoted text' -eu echo
+		"$1" x=1 "$@" ${HOME} "$@" echo readonly
+	grep local printf && | echo "$1" local "$1" x=1 done local echo then -eu &&
+		done printf echo grep test $(pwd) printf grep test done $(pwd)
+test $(pwd) x=1 then sed test
+	"$1" --verbose echo -eu test ${HOME} done local 'quoted text'
+cd /usr/bin 'quoted text' then -eu
+	"$1" grep --verbose export done awk then cd "$@" printf grep cd printf "$1" "$@"
+test /usr/bin 'quoted text' awk export test
+grep $(pwd) grep | done readonly x=1 'quoted text' 'quoted text' grep
+local x=1 'quoted text' $(pwd) 2>/dev/null
+| cd --verbose | awk sed echo --verbose
+		done local test then done grep cd 2>/dev/null
+x=1 ${HOME} ${HOME} test /usr/bin sed export 'quoted text' awk x=1 sed grep cd
+	--verbose "$@" grep $(pwd) --verbose
+		cd /usr/bin then export "$1" && printf
+	2>/dev/null done "$@" done done readonly "$@" | x=1 --verbose
+	/usr/bin $(pwd) echo printf x=1 printf "$@"
+2>/dev/null test done grep
+		done && --verbose local local awk /usr/bin x=1 "$1" && -eu printf /usr/bin
+		test ${HOME} echo "$@" echo && | local cd ${HOME} --verbose
+x=1 "$@" 'quoted text' /usr/bin cd --verbose echo done /usr/bin $(pwd)
+		test test -eu readonly printf sed
+	| echo --verbose test sed ${HOME} -eu --verbose | 2>/dev/null
+${HOME} "$1" $(pwd) export sed -eu
+		/usr/bin grep grep then ${HOME} 'quoted text' 2>/dev/null
+echo 2>/dev/null /usr/bin cd ${HOME} -eu done cd 'quoted text'
+		-eu echo local x=1 "$1" grep awk
+		export local local grep /usr/bin 'quoted text' test && $(pwd) --verbose
+'quoted text' grep | /usr/bin -eu x=1 awk | 2>/dev/null
+	/usr/bin /usr/bin 2>/dev/null "$1" && cd "$1" | awk ${HOME} -eu
+	--verbose sed 'quoted text' cd export echo && done
+	sed cd ${HOME} "$1" readonly
+		$(pwd) x=1 grep $(pwd) 'quoted text' x=1 awk
+	local awk then "$@" --verbose "$@" x=1 cd x=1 test ${HOME} awk local
+		cd ${HOME} printf --verbose ${HOME} cd awk printf echo $(pwd) sed cd echo
+	grep "$@" "$@" export sed grep 2>/dev/null -eu cd x=1 done test
+	done then /usr/bin awk sed ${HOME} && /usr/bin
+		echo test -eu "$@" sed echo $(pwd) done echo done
+| test "$@" grep sed echo awk export | cd x=1 "$@" echo export then
+		"$1" ${HOME} x=1 x=1 /usr/bin sed echo local "$@"
+export cd -eu echo printf --verbose
+"$1" sed --verbose $(pwd) echo | $(pwd) /usr/bin printf ${HOME} readonly
+grep grep printf -eu -eu
+		$(pwd) -eu "$@" export local readonly -eu test local 'quoted text'
+	| -eu --verbose cd cd 'quoted text' grep local done
+	printf ${HOME} "$1" && && && echo $(pwd) export then && echo then
+		test echo "$@" | echo readonly 2>/dev/null 'quoted text' echo export
+		| export readonly readonly test
+awk ${HOME} cd --verbose readonly awk export sed && grep echo grep --verbose local
+	test grep "$1" awk 2>/dev/null done
+local 'quoted text' && && "$@" 'quoted text'
+'quoted text' awk | printf then x=1 echo /usr/bin x=1 /usr/bin echo export
+	&& "$@" --verbose "$@" | done
+	awk -eu echo done x=1 'quoted text' | printf --verbose "$1" printf
+	&& echo done x=1 cd export grep echo /usr/bin
+/usr/bin --verbose export then
+	printf /usr/bin then 'quoted text' sed export cd test readonly 'quoted text'
+		then readonly /usr/bin "$1"
+2>/dev/null -eu $(pwd) grep test "$@" /usr/bin --verbose "$@" test
+	cd ${HOME} test echo 'quoted text' 2>/dev/null "$1" cd --verbose
+readonly | grep grep printf ${HOME} 'quoted text' 2>/dev/null test printf
+	'quoted text' "$1" && 2>/dev/null cd grep /usr/bin sed cd x=1 export awk sed grep
+printf 2>/dev/null -eu cd /usr/bin then 'quoted text' -eu
+	"$1" grep export done awk then --verbose ${HOME} local
+&& && /usr/bin printf ${HOME} 'quoted text' done ${HOME} x=1 test $(pwd) /usr/bin
+	-eu sed 2>/dev/null cd
+$(pwd) -eu export readonly --verbose $(pwd) done done then "$1" cd
+	test "$@" done x=1 readonly $(pwd) echo "$1" "$1" grep
+	/usr/bin readonly ${HOME} echo
+	x=1 done then awk -eu grep test x=1 2>/dev/null ${HOME}
+		&& export export then sed export
+		sed ${HOME} --verbose done export echo 'quoted text'
+	awk printf awk readonly --verbose
+done then then ${HOME} 'quoted text' /usr/bin printf ${HOME} local
+		printf then --verbose 'quoted text' awk "$1" readonly
+	x=1 "$1" 2>/dev/null done local ${HOME} sed | | 'quoted text' 'quoted text'
+export then printf then $(pwd) x=1 local done | 2>/dev/null
+"$@" 'quoted text' awk
+grep grep grep echo awk printf 'quoted text' --verbose ${HOME}
+sed -eu && cd awk grep "$1" 'quoted text' grep then test export
+	&& && test printf ${HOME} export
+		sed export done echo export
+local printf 2>/dev/null ${HOME} echo ${HOME} 'quoted text'
+		done awk local "$1" 2>/dev/null && done echo
+		echo "$1" "$1" 2>/dev/null x=1 $(pwd) awk
+${HOME} --verbose x=1 readonly 'quoted text' --verbose $(pwd) "$1" local "$@"
+grep ${HOME} echo readonly then x=1
+		done ${HOME} && ${HOME} readonly 'quoted text'
+local /usr/bin done && readonly /usr/bin /usr/bin --verbose
+		test "$@" cd printf $(pwd) && && --verbose
+echo "$@" | readonly grep done local ${HOME} | test
+	local local done test 'quoted text' done -eu local sed 'quoted text' readonly "$1"
+"$@" "$1" ${HOME} export echo local then ${HOME} readonly grep export then | echo
+	echo "$1" readonly local "$1" && echo | awk then "$1"
+	export 'quoted text' grep "$1" echo echo test printf x=1 grep
+	cd test 'quoted text' 2>/dev/null -eu && sed awk done then local "$1"
+		done sed -eu then grep "$1" printf "$1"
+done printf "$1" 2>/dev/null --verbose ${HOME} | local ${HOME} export
+/usr/bin done "$@" x=1 -eu /usr/bin printf
+	&& && | sed printf sed
+	--verbose readonly ${HOME} ${HOME}
+	cd && "$1" "$1" sed $(pwd) readonly /usr/bin
+		$(pwd) -eu --verbose sed | "$@"
+		echo -eu grep && 'quoted text' test $(pwd) "$1" done
+		export then awk cd readonly done | test /usr/bin /usr/bin export
+	awk 'quoted text' /usr/bin test awk test -eu grep then "$1" echo export $(pwd)
+		"$1" "$@" echo "$1" test && export done sed ${HOME} | /usr/bin
+/usr/bin local --verbose "$1" /usr/bin --verbose | export done local /usr/bin
+	echo && then /usr/bin "$@" | test
+test cd /usr/bin && | -eu
+		--verbose ${HOME} $(pwd) readonly done export test readonly
+	x=1 printf printf local
+	grep ${HOME} readonly cd 'quoted text' 2>/dev/null sed x=1 $(pwd) then test ${HOME}
+		test x=1 /usr/bin --verbose "$@" grep /usr/bin
+		"$@" ${HOME} --verbose export grep
+export $(pwd) /usr/bin printf awk printf test grep done
+	grep && -eu "$1" cd "$1"
+awk done readonly echo sed 2>/dev/null local
+grep test done printf "$@" cd readonly printf --verbose test then /usr/bin --verbose
+		"$1" then cd grep 2>/dev/null echo | 2>/dev/null
+		${HOME} "$1" readonly -eu 2>/dev/null | 2>/dev/null test sed printf x=1
+	-eu export printf | 'quoted text'
+		then -eu export /usr/bin then local then
+	cd grep cd export ${HOME} sed test
+	| readonly awk readonly grep | | readonly 'quoted text' grep local done 'quoted text'
+		/usr/bin done awk -eu test cd export local &&
+$(pwd) ${HOME} $(pwd) then cd -eu done echo | | grep
+	&& done readonly | --verbose printf sed done 'quoted text' /usr/bin ${HOME}
+local "$@" cd --verbose /usr/bin
+${HOME} done export 2>/dev/null readonly /usr/bin | -eu done echo done
+	local awk && "$1" /usr/bin awk | readonly echo "$1" --verbose x=1 -eu |
+then 'quoted text' echo x=1 test "$1" test awk | done then $(pwd) 2>/dev/null
+	test test local then grep
+2>/dev/null 'quoted text' "$1" echo
+		local done echo | local x=1 then "$@" then
+	&& /usr/bin grep /usr/bin then sed x=1 'quoted text' "$@" 2>/dev/null cd then
+		readonly test 2>/dev/null | ${HOME} printf
+	x=1 cd test ${HOME} -eu | | -eu $(pwd)
+	done export x=1 printf sed export -eu -eu printf "$1" "$1"
+		echo 2>/dev/null && export
+	'quoted text' export printf then printf ${HOME} then grep && local awk | |
+	grep /usr/bin sed awk 'quoted text'
+	done grep --verbose readonly $(pwd) && grep readonly ${HOME} $(pwd)
+	2>/dev/null echo then export readonly
+		"$1" --verbose | --verbose && && awk ${HOME} then $(pwd) export
+	"$@" x=1 local done done done &&
+		cd | grep $(pwd) x=1 export sed && done && test
+	/usr/bin echo then && then "$@" 'quoted text'
+		echo echo printf cd -eu 'quoted text' grep "$1" printf ${HOME}
+	${HOME} test 2>/dev/null then echo printf -eu export sed | --verbose
+&& /usr/bin grep "$@" $(pwd) && /usr/bin && grep $(pwd)
+'quoted text' printf grep ${HOME}
+	cd printf local done && test readonly grep x=1 test 2>/dev/null
+		-eu cd -eu /usr/bin then | export test
+local "$1" 'quoted text' "$@" ${HOME} test cd printf export && | "$1" x=1 "$1"
+local sed ${HOME} "$1" $(pwd) sed grep ${HOME} && export | export export
+$(pwd) /usr/bin then -eu echo cd printf local $(pwd) x=1 local grep && && | echo
+$(pwd) 'quoted text' && -eu --verbose test cd done ${HOME} grep local
+	echo local cd cd "$@" | done
+	--verbose test test readonly local awk done printf export echo
+	echo test export "$@" sed ${HOME} awk "$1" --verbose test
+		sed sed test $(pwd) grep && export local awk
+	'quoted text' test x=1 'quoted text'
+printf /usr/bin echo done
+		| then 'quoted text' --verbose && "$@"
+--verbose export "$1" export awk printf
+	echo "$@" grep "$@" ${HOME} x=1 --verbose echo "$1" then -eu
+then readonly -eu "$1" "$1" sed && local printf "$@" 'quoted text'
+"$@" grep sed done $(pwd) $(pwd) echo grep export
+2>/dev/null "$@" x=1 done 'quoted text'
+	awk "$1" local test echo
+printf sed 'quoted text' sed grep cd awk x=1 | done local | then echo
+export /usr/bin export /usr/bin awk cd --verbose grep done readonly 'quoted text'
+	2>/dev/null 'quoted text' grep export ${HOME}
+grep done 'quoted text' sed test "$@" --verbose --verbose 'quoted text'
+sed --verbose "$1" awk -eu | local -eu "$@" done && $(pwd) $(pwd) done sed 2>/dev/null
+	'quoted text' x=1 printf | cd cd ${HOME} awk "$1" local cd
+		-eu --verbose && $(pwd) awk -eu export x=1
+sed readonly | 2>/dev/null "$1" /usr/bin -eu | echo done
+	then export x=1 'quoted text' echo | awk done echo 2>/dev/null /usr/bin export
+grep "$@" sed local cd
+	cd $(pwd) then readonly | x=1 local done done test grep
+printf then "$1" export local grep echo /usr/bin
+		test $(pwd) export ${HOME} $(pwd) -eu --verbose 2>/dev/null
+	'quoted text' grep sed readonly /usr/bin local
+--verbose test --verbose /usr/bin local export "$@" -eu
+		then /usr/bin export 2>/dev/null grep
+printf printf $(pwd) done && printf | then cd local | test grep awk 2>/dev/null
+	x=1 ${HOME} x=1 printf done -eu test test test 'quoted text'
+	readonly --verbose $(pwd) grep /usr/bin "$1" "$1" ${HOME} done
+readonly readonly "$1" $(pwd)
+readonly -eu --verbose $(pwd) printf $(pwd)
+		cd $(pwd) grep $(pwd) -eu done echo then 'quoted text'
+	cd local sed done 2>/dev/null "$1" readonly export --verbose 2>/dev/null
+		awk export sed grep "$@" then local test -eu /usr/bin sed x=1
+		/usr/bin $(pwd) test done echo readonly
+		&& --verbose 'quoted text' --verbose "$@" $(pwd)
+x=1 ${HOME} grep test -eu
+-eu sed "$@" /usr/bin $(pwd) grep test printf 2>/dev/null echo -eu
+printf | grep "$@" x=1 2>/dev/null
+done --verbose | --verbose printf "$@" cd -eu
+"$@" cd readonly ${HOME} 'quoted text'
+	-eu test "$1" echo /usr/bin sed cd awk echo export 'quoted text'
+/usr/bin -eu 2>/dev/null 2>/dev/null grep sed x=1 ${HOME} then 2>/dev/null
+		export done && ${HOME} | readonly then sed x=1 ${HOME} x=1 sed export
+		"$@" && printf && ${HOME} printf -eu && --verbose
+		done printf | printf "$1" test awk echo 'quoted text' done printf
+	x=1 grep -eu /usr/bin ${HOME} echo done && test $(pwd) local
+		2>/dev/null local test export
+readonly local test 2>/dev/null
+	/usr/bin 2>/dev/null "$@" 2>/dev/null
+	2>/dev/null export export | 'quoted text' --verbose sed 'quoted text'
+	"$1" x=1 2>/dev/null done then sed local --verbose echo "$@" "$@" --verbose
+		echo then 'quoted text' | then && x=1 local "$1" sed cd -eu 2>/dev/null && echo
+/usr/bin echo && /usr/bin printf echo local test
+	export x=1 --verbose /usr/bin done echo sed /usr/bin printf then
+export sed x=1 awk -eu grep /usr/bin readonly "$@"
+x=1 test ${HOME} 'quoted text'
+		awk x=1 && "$@" test $(pwd) | sed 2>/dev/null "$1" "$1" "$1" 'quoted text'
+	'quoted text' then export local 2>/dev/null -eu printf
+		x=1 readonly && ${HOME} /usr/bin --verbose echo done
+		$(pwd) readonly "$@" test ${HOME} && $(pwd) -eu ${HOME} then
+	x=1 x=1 printf "$1" then export ${HOME} -eu "$1"
+		$(pwd) /usr/bin echo $(pwd) $(pwd) && echo --verbose "$1" printf local printf
+		done local awk 2>/dev/null done /usr/bin
+local && done | $(pwd) local sed cd --verbose
+		printf local readonly cd "$1" --verbose /usr/bin /usr/bin
+		$(pwd) export 'quoted text' awk $(pwd) local sed x=1 && --verbose
+"$@" && local | "$@" awk
+2>/dev/null cd awk --verbose sed export /usr/bin --verbose /usr/bin
+		cd sed -eu ${HOME} "$1" -eu --verbose cd ${HOME} 2>/dev/null
+		sed readonly && grep /usr/bin readonly echo local 2>/dev/null then "$1" awk
+		grep done ${HOME} test ${HOME} 2>/dev/null local "$@" 'quoted text'
+local 2>/dev/null --verbose then "$1" $(pwd)
+		then -eu --verbose local --verbose grep $(pwd) "$1" 'quoted text' | x=1 then
+		echo grep | done /usr/bin sed done then
+	local --verbose test export
+done then echo -eu "$@" x=1 test "$1" printf test awk
+	"$@" 'quoted text' printf
+		export then awk awk "$1" /usr/bin cd /usr/bin
+		$(pwd) -eu done printf awk printf x=1 --verbose
+$(pwd) "$@" | grep readonly grep 'quoted text' "$@" x=1 echo then
+		| | "$@" --verbose -eu grep
+	--verbose sed && readonly awk /usr/bin
+local export sed echo x=1 awk printf test
+grep --verbose x=1 $(pwd) awk then /usr/bin "$1" /usr/bin export /usr/bin test
+${HOME} cd 2>/dev/null 2>/dev/null /usr/bin 2>/dev/null
+then cd grep cd awk echo readonly
+		cd echo local -eu grep && 'quoted text' 'quoted text' ${HOME} done 'quoted text'
+readonly "$1" then readonly printf grep "$@" | ${HOME} "$1" -eu x=1 printf
+	2>/dev/null readonly $(pwd) grep echo then x=1 cd echo
+		-eu echo grep "$1" /usr/bin x=1 cd "$@" /usr/bin ${HOME} done
+	test then /usr/bin "$1" "$1" ${HOME} "$@" printf then local
+		-eu x=1 && ${HOME} "$1"
+	'quoted text' cd echo x=1 grep sed ${HOME} && printf sed then 'quoted text' | ${HOME}
+printf echo awk printf $(pwd) "$@"
+	echo awk grep $(pwd) awk awk
+	echo 'quoted text' 2>/dev/null
+local sed -eu --verbose printf
+	$(pwd) $(pwd) grep test printf ${HOME} test ${HOME} local echo && test 'quoted text'
+		"$@" --verbose 'quoted text' readonly readonly "$@" /usr/bin
+	cd echo echo printf then $(pwd)
+export x=1 sed && then
+	--verbose --verbose sed "$1" cd sed test | done && /usr/bin
+echo export test "$@" done
+		| awk grep x=1 export cd 2>/dev/null sed printf sed $(pwd) done x=1
+test local 'quoted text' then local test sed && "$1"
+2>/dev/null 2>/dev/null grep then
+	readonly export echo grep echo cd 2>/dev/null /usr/bin cd then grep
+		x=1 && | then grep printf --verbose x=1 "$@" && then echo 'quoted text'
+	x=1 then ${HOME} export "$@" && grep && local grep then
+	echo $(pwd) awk && ${HOME} local echo
+		printf echo "$@" && local
+		export awk --verbose x=1 sed
+	2>/dev/null && then | ${HOME} cd test "$@" "$1" printf
+	2>/dev/null grep grep cd | 'quoted text' echo
+awk "$@" cd readonly printf
+printf then cd then "$@" then sed cd test readonly
+	then 'quoted text' awk test $(pwd)
+printf --verbose "$@" awk export test 2>/dev/null 'quoted text'
+'quoted text' test ${HOME} local $(pwd) "$1" export awk readonly grep
+		-eu printf "$@" "$@" local local ${HOME} awk export test | export then 2>/dev/null
+		printf cd 2>/dev/null grep local && 'quoted text' printf /usr/bin
+		${HOME} $(pwd) /usr/bin && 2>/dev/null "$@" $(pwd) grep local test --verbose then
+		x=1 ${HOME} x=1 2>/dev/null ${HOME}
+		then --verbose x=1 readonly done | x=1
+		cd --verbose --verbose test /usr/bin echo local test then 2>/dev/null "$@" printf
+"$1" -eu | grep sed | grep -eu cd x=1 "$@" export x=1
+	export sed "$@" printf then sed done
+echo "$1" readonly -eu cd readonly x=1 && "$1" done cd readonly $(pwd) local
+printf /usr/bin readonly $(pwd) cd readonly
+--verbose awk /usr/bin local then --verbose
+		echo readonly 'quoted text' "$1" cd ${HOME}
+		cd printf test 2>/dev/null | readonly test test done ${HOME}
+	readonly | readonly then $(pwd) export 2>/dev/null printf printf
+	readonly --verbose $(pwd) cd readonly -eu then grep
+		local done local $(pwd) ${HOME} sed
+		"$1" --verbose /usr/bin
+done "$1" readonly grep then echo sed
+	&& readonly local done 2>/dev/null
+		${HOME} export && --verbose printf x=1 then
+		&& ${HOME} $(pwd) grep --verbose ${HOME} ${HOME} | /usr/bin readonly cd test
+local sed $(pwd) -eu 2>/dev/null -eu 2>/dev/null $(pwd) | awk &&
+	"$1" "$@" sed done -eu "$@" --verbose "$@" readonly grep
+	"$1" cd ${HOME} 2>/dev/null "$@" 2>/dev/null $(pwd)
+sed printf printf readonly grep --verbose x=1 export 2>/dev/null sed
+		"$1" --verbose /usr/bin readonly ${HOME}
+	${HOME} "$@" | readonly local -eu test /usr/bin test
+	--verbose $(pwd) sed "$@" && | 'quoted text' done
+		--verbose && 2>/dev/null "$1" $(pwd)
+	test | --verbose sed "$1" grep cd local then
+	local $(pwd) /usr/bin 2>/dev/null x=1 && printf
+| "$@" done 2>/dev/null
+		test ${HOME} 2>/dev/null 2>/dev/null done | then "$@" "$1" export 2>/dev/null
+		&& done printf local | --verbose cd | then /usr/bin readonly /usr/bin
+	"$@" test readonly echo readonly "$@" export test readonly | ${HOME} "$@"
+		--verbose 'quoted text' readonly && grep test cd sed
+	done test local cd grep done "$@" then local
+local "$@" && "$1" sed grep cd 'quoted text' printf 'quoted text' awk then test
+${HOME} export local 'quoted text' awk -eu
+		2>/dev/null 'quoted text'
+${HOME} done sed | x=1 readonly test grep printf "$@" $(pwd) readonly
+	| "$1" && "$1" "$@" readonly local x=1 echo 'quoted text' cd export export
+		readonly && /usr/bin sed local ${HOME} x=1 cd 'quoted text' x=1 awk echo
+	export awk echo /usr/bin 2>/dev/null printf /usr/bin then
+awk local export /usr/bin
+export printf --verbose x=1 --verbose grep && printf /usr/bin
+--verbose readonly | then | sed | /usr/bin awk then test
+	printf then --verbose test 'quoted text' test sed 2>/dev/null grep -eu local
+	$(pwd) done -eu test | cd x=1 done
+/usr/bin "$1" /usr/bin then cd /usr/bin awk "$@" ${HOME} x=1
+		sed then local done | awk 2>/dev/null then
+then export grep "$1" grep then --verbose ${HOME} x=1 readonly
+	echo -eu done echo sed then -eu 2>/dev/null printf "$1" test
+2>/dev/null then grep | "$1" ${HOME} /usr/bin printf /usr/bin printf
+		2>/dev/null $(pwd) $(pwd) "$1" printf $(pwd) cd 2>/dev/null ${HOME}
+		"$@" -eu "$1" export printf
+grep "$@" -eu export printf
+	cd test awk -eu readonly $(pwd) 'quoted text' test readonly done local
+	test "$1" readonly cd awk --verbose
+		2>/dev/null sed && sed cd | readonly export --verbose
+		readonly local "$1" readonly "$1"
+		/usr/bin "$@" 2>/dev/null $(pwd) export test echo -eu export
+		test "$@" ${HOME} local /usr/bin test awk $(pwd) 'quoted text'
+		cd grep /usr/bin --verbose 2>/dev/null "$@" printf done printf
+	then then "$1" sed ${HOME} 2>/dev/null export grep grep
+	test $(pwd) "$@" sed readonly echo printf "$1" -eu -eu awk readonly done && cd
+		${HOME} -eu grep 'quoted text' -eu awk
+		done 2>/dev/null ${HOME} export $(pwd) 'quoted text' x=1 "$@"
+"$@" export echo "$@" export grep export
+		local ${HOME} export -eu cd
+	| ${HOME} --verbose 2>/dev/null then awk "$1" "$1" 'quoted text'
+awk ${HOME} | printf ${HOME} $(pwd) awk then readonly /usr/bin "$1"
+	-eu local grep then echo export
+readonly -eu && done readonly x=1 then x=1 2>/dev/null then ${HOME}
+		/usr/bin readonly $(pwd) | 2>/dev/null
+	"$1" 2>/dev/null local x=1 export
+		readonly then sed echo $(pwd) ${HOME}
+		done readonly "$1" local "$1" && test done grep printf local awk cd x=1
+	echo /usr/bin | && && && "$@" x=1 test awk test grep
+"$1" ${HOME} 2>/dev/null echo --verbose "$1" --verbose
+	export local awk 2>/dev/null
+		test "$1" readonly && then /usr/bin ${HOME} local && awk grep 2>/dev/null
+-eu grep awk echo sed readonly
+	local printf export | "$1" export -eu /usr/bin
+		cd readonly done printf test && ${HOME} 'quoted text' readonly
+		| test 'quoted text' "$@" 2>/dev/null 2>/dev/null printf ${HOME}
+	export --verbose 'quoted text' then grep printf
+export test readonly ${HOME} printf
+	${HOME} x=1 then 'quoted text' $(pwd) awk
+		/usr/bin 2>/dev/null
+	| then grep printf local -eu sed 'quoted text' test export echo x=1 cd awk
+		| sed x=1 2>/dev/null cd "$1" grep then
+		&& sed "$1" "$1" $(pwd) printf grep awk --verbose x=1 &&
+	'quoted text' done -eu sed "$@" awk export 2>/dev/null "$1" readonly ${HOME} x=1
+/usr/bin /usr/bin x=1 sed "$@" /usr/bin
+	echo && ${HOME} grep 2>/dev/null
+'quoted text' ${HOME} printf
+${HOME} cd done 'quoted text'
+		${HOME} readonly test
+| cd grep 'quoted text' --verbose awk
+	readonly ${HOME} -eu -eu test echo sed sed 2>/dev/null
+printf /usr/bin x=1 awk "$1" "$@" grep && test "$@" x=1 "$1" sed
+		'quoted text' /usr/bin 'quoted text' $(pwd) --verbose
+		-eu grep test test sed "$@" -eu ${HOME} local $(pwd) then $(pwd)
+		${HOME} /usr/bin "$1" $(pwd) &&
+then grep grep test cd && && then
+	export 'quoted text' --verbose "$@" "$@" $(pwd) awk export grep test export echo
+	local sed test x=1 2>/dev/null "$1" | "$1"
+cd readonly -eu /usr/bin printf ${HOME} awk -eu test
+export --verbose | 2>/dev/null
+		2>/dev/null | echo local grep printf echo "$1" cd local echo 2>/dev/null
+		/usr/bin --verbose | local then awk | then
+		"$1" echo x=1 cd export awk $(pwd)
+cd test && 2>/dev/null $(pwd) x=1 readonly
+		"$@" export grep cd --verbose sed 'quoted text'
+	readonly -eu awk readonly -eu echo done ${HOME} export
+	x=1 echo ${HOME} 'quoted text' cd x=1 2>/dev/null $(pwd) echo cd "$@" ${HOME}
+	/usr/bin "$@" awk readonly export 'quoted text' | cd printf readonly "$1" readonly
+		x=1 && cd $(pwd) sed then ${HOME} echo local echo "$@" ${HOME} printf local
+		-eu ${HOME} awk && && ${HOME} /usr/bin
+'quoted text' awk sed done then test 2>/dev/null | x=1 2>/dev/null cd local
+		sed awk --verbose 2>/dev/null
+		then test export 'quoted text' grep local ${HOME} then 'quoted text'
+	printf ${HOME} /usr/bin -eu printf echo cd 2>/dev/null ${HOME} --verbose
+export /usr/bin $(pwd) cd -eu echo --verbose && /usr/bin done export ${HOME} -eu
+sed /usr/bin 'quoted text' sed ${HOME} local | 'quoted text' readonly cd cd done
+/usr/bin export 2>/dev/null ${HOME} local
+--verbose export echo printf then | $(pwd) x=1 "$@"
+2>/dev/null /usr/bin $(pwd) "$@"
+		sed ${HOME} sed | && printf $(pwd) 2>/dev/null local /usr/bin | then
+	-eu 'quoted text' echo
+done x=1 sed -eu /usr/bin | cd echo -eu test export export | 'quoted text' "$@"
+	2>/dev/null done | ${HOME}
+		'quoted text' ${HOME} x=1 local "$1" then ${HOME} then --verbose
+	"$1" /usr/bin x=1 2>/dev/null printf -eu awk sed 'quoted text'
+	${HOME} | awk sed sed cd test then -eu test ${HOME} awk then grep
+		local then readonly x=1 2>/dev/null readonly
+	grep local | && 'quoted text' 2>/dev/null export --verbose then "$@" done "$1"
+	local && "$@" local && /usr/bin readonly readonly
+		-eu readonly echo -eu awk ${HOME} $(pwd) "$1" readonly
+	readonly x=1 done "$1" grep -eu printf readonly && echo /usr/bin -eu
+	cd $(pwd) then cd x=1 $(pwd) 2>/dev/null && export /usr/bin grep
+	-eu sed test local $(pwd) ${HOME}
+cd then -eu then -eu export && printf /usr/bin
+"$1" done $(pwd) ${HOME} $(pwd) export 2>/dev/null cd 2>/dev/null ${HOME} cd
+	printf --verbose grep --verbose cd && readonly local printf x=1
+${HOME} echo 'quoted text' x=1 2>/dev/null /usr/bin local local "$1" cd /usr/bin
+&& $(pwd) awk printf grep cd grep
+	'quoted text' /usr/bin "$@" then -eu export
+done /usr/bin echo echo printf | | 'quoted text' echo 2>/dev/null sed
+		'quoted text' cd cd -eu 2>/dev/null printf ${HOME} sed | cd
+"$1" readonly awk cd printf -eu 2>/dev/null /usr/bin && "$@" awk export
+| | 2>/dev/null | "$1" grep 'quoted text' awk export $(pwd)
+	awk 2>/dev/null "$1" --verbose then ${HOME} "$@" 'quoted text'
+	test local | && && $(pwd) | sed 2>/dev/null "$@" x=1 ${HOME} grep $(pwd) "$1"
+	/usr/bin && "$1" "$1" grep echo
+		test --verbose sed 'quoted text' readonly
+test x=1 done test | test local readonly readonly then | 'quoted text'
+x=1 "$1" /usr/bin | $(pwd)
+	--verbose 'quoted text' /usr/bin ${HOME} x=1 cd -eu then then "$1" 'quoted text'
+	&& then 2>/dev/null -eu sed "$1" --verbose export
+		cd readonly && test "$@" 'quoted text'
+	done export grep then cd test --verbose
+	--verbose cd "$1" -eu 2>/dev/null && then
+		awk awk "$@" test test 2>/dev/null | sed "$1"
+		-eu | awk $(pwd) grep
+		$(pwd) /usr/bin "$@" 'quoted text'
+	"$@" then ${HOME} then 'quoted text' $(pwd) awk "$@" | "$1" cd awk export then
+		/usr/bin readonly then -eu
+		sed --verbose export /usr/bin "$1" cd printf $(pwd) readonly echo $(pwd) --verbose
+	&& cd $(pwd) -eu local && then awk 'quoted text'
+	then awk then 'quoted text' --verbose 2>/dev/null &&
+x=1 && -eu -eu -eu local echo 2>/dev/null
+		x=1 $(pwd) done | test "$1" readonly && export && local grep
+		cd /usr/bin $(pwd) test export export x=1 | ${HOME} x=1 -eu
+	awk echo test x=1 ${HOME} "$1" done test done /usr/bin
+		"$@" x=1 && done awk /usr/bin && | export awk readonly grep cd |
+	local && 'quoted text' grep
+export | local /usr/bin then awk x=1 2>/dev/null test --verbose readonly "$1"
+		test && -eu grep readonly
+	echo cd -eu done $(pwd) export
+		export 2>/dev/null /usr/bin awk /usr/bin awk "$1" | ${HOME}
+	&& readonly cd -eu 2>/dev/null && cd test grep "$1" 'quoted text'
+x=1 $(pwd) awk && | "$1" awk 'quoted text' readonly local /usr/bin sed grep
+		readonly | echo test then "$@" /usr/bin cd x=1 sed awk x=1 --verbose
+		local readonly "$1" && "$@"
+	local | | --verbose local done -eu
+echo printf | ${HOME} -eu awk local
+	-eu test 2>/dev/null 2>/dev/null && cd 2>/dev/null x=1 | grep
+		"$1" printf x=1 'quoted text' cd 'quoted text' local
+		export "$@" export -eu local 'quoted text' ${HOME} grep x=1 test x=1 cd -eu | "$@"
+	cd done awk $(pwd) cd 'quoted text'
+		"$1" awk | local x=1 then done
+	-eu echo x=1 awk --verbose | local grep test awk 'quoted text' 2>/dev/null
+	sed echo "$1" awk && sed
+sed && "$@" --verbose 2>/dev/null && export $(pwd)
+		'quoted text' ${HOME} $(pwd) local printf x=1 readonly ${HOME} then "$@" export
+echo local 2>/dev/null grep
+&& grep 2>/dev/null echo 'quoted text'
+	'quoted text' sed printf && grep sed readonly 'quoted text'
+printf awk awk cd -eu
+'quoted text' --verbose
+		2>/dev/null 'quoted text' && -eu --verbose
+then $(pwd) "$1" readonly test "$@" && x=1 awk $(pwd) --verbose /usr/bin cd
+	test echo x=1 test done local cd sed
+/usr/bin --verbose then test echo done
+		export --verbose then | done export cd sed done "$1" echo --verbose
+sed -eu --verbose export --verbose x=1
+		$(pwd) readonly test cd --verbose echo printf -eu
+		local $(pwd) then 'quoted text' then && then awk "$@" export -eu
+		&& done grep 2>/dev/null done then | x=1 x=1 export echo done 2>/dev/null ${HOME}
+cd "$1" x=1 -eu /usr/bin
+x=1 readonly 'quoted text' export && ${HOME} then cd
+		sed done done done && cd $(pwd) sed --verbose 'quoted text' 'quoted text'
+	"$1" test test test local export
+	printf 'quoted text' then grep local then local $(pwd) "$1" | "$@" cd done export
+		"$@" grep readonly awk /usr/bin then /usr/bin echo printf
+--verbose cd cd /usr/bin 2>/dev/null printf printf awk readonly export "$@"
+		sed then 'quoted text' 2>/dev/null then test $(pwd) "$@" echo
+	awk /usr/bin 2>/dev/null -eu -eu sed then export
+test cd x=1 grep | readonly done "$@" printf
+		grep -eu done --verbose 2>/dev/null
+	"$@" cd 2>/dev/null -eu export export test --verbose 2>/dev/null readonly readonly
+cd sed "$1" | echo grep x=1 x=1 && grep printf ${HOME} local "$@" cd
+	"$@" | | | sed sed echo done awk echo export
+awk grep | 'quoted text' echo /usr/bin
+		--verbose x=1 && x=1 && "$@"
+		/usr/bin awk printf cd && "$@" awk test ${HOME} /usr/bin 'quoted text' $(pwd)
+/usr/bin grep printf | grep done test sed ${HOME}
+	test echo printf awk "$@" export /usr/bin
+	awk 2>/dev/null awk /usr/bin sed printf then awk
+/usr/bin done cd sed 2>/dev/null
+test grep readonly printf then x=1 "$@" 'quoted text'
+		/usr/bin awk readonly 2>/dev/null -eu local
+'quoted text' sed local then done "$1" readonly grep sed
+		"$@" 2>/dev/null 2>/dev/null $(pwd) grep sed printf done
+-eu echo sed cd "$@" cd sed sed x=1 /usr/bin cd readonly
+	2>/dev/null export export -eu cd export cd x=1 $(pwd) x=1 echo && local --verbose
+echo "$@" then then echo awk "$1" 2>/dev/null
+		"$1" cd echo ${HOME} awk export grep $(pwd)
+		x=1 "$@" grep sed | 'quoted text' ${HOME} $(pwd) | /usr/bin
+		"$1" cd test "$1" local
+"$@" 2>/dev/null --verbose /usr/bin cd 2>/dev/null
+	&& echo && -eu grep readonly ${HOME} ${HOME} /usr/bin $(pwd) printf
+	readonly -eu awk "$1" ${HOME} cd --verbose x=1 grep then printf test done "$1"
+printf export --verbose /usr/bin export then 'quoted text'
+		export && echo "$@" sed 'quoted text' echo &&
+echo awk "$@" test /usr/bin then then then export "$1" "$1" cd -eu
+		local awk "$1" sed done export awk
+"$@" 'quoted text' echo | --verbose sed awk
+		readonly 'quoted text' /usr/bin cd "$1"
+	"$@" | -eu ${HOME} done /usr/bin $(pwd) export -eu export local 2>/dev/null
+	then sed printf export $(pwd) grep then awk then 'quoted text'
+		x=1 local $(pwd) /usr/bin echo "$@" 'quoted text' awk "$@" x=1 && export 2>/dev/null
+-eu | x=1 test && done readonly done echo export
+		$(pwd) export -eu /usr/bin -eu -eu export --verbose sed "$1" x=1
+	cd "$1" echo local awk echo "$1" "$@" --verbose
+		grep readonly printf echo export /usr/bin export local test export echo export
+		export then grep --verbose && 2>/dev/null readonly ${HOME}
+	$(pwd) sed --verbose export printf local 2>/dev/null 2>/dev/null -eu
+		local echo 2>/dev/null local
+	| export awk then "$1" --verbose "$@"
+--verbose --verbose printf sed 'quoted text' then echo echo
+	printf ${HOME} ${HOME} /usr/bin cd then -eu "$@" ${HOME} awk
+export "$@" -eu awk "$@" printf
+$(pwd) readonly awk 'quoted text' /usr/bin x=1 then | ${HOME} -eu "$1"
+	--verbose readonly ${HOME} awk 'quoted text'
+${HOME} $(pwd) local && grep | -eu export
+done x=1 export --verbose grep | /usr/bin "$@" x=1
+'quoted text' local $(pwd) | then ${HOME}
+local then x=1 2>/dev/null echo sed --verbose sed export -eu ${HOME} "$1" 2>/dev/null
+		readonly 2>/dev/null -eu "$1" readonly then "$@" grep printf cd
+	echo test printf 2>/dev/null && $(pwd)
+		export grep awk 2>/dev/null printf printf x=1 cd then x=1 echo
+		'quoted text' grep then awk $(pwd) 'quoted text' grep
+	--verbose export ${HOME}
+	--verbose grep $(pwd) "$1" test sed then awk -eu export "$1" "$@"
+"$@" x=1 readonly ${HOME} "$1" then 'quoted text' local ${HOME} && awk grep sed
+export readonly --verbose --verbose awk && readonly 2>/dev/null
+		-eu 'quoted text' 2>/dev/null cd export local done readonly 2>/dev/null
+	grep done cd printf $(pwd) grep
+		| echo sed echo local x=1 done "$1" /usr/bin readonly
+	echo "$@" local sed "$@" local local grep x=1 ${HOME} awk "$@" "$1" export
+		-eu local x=1 grep cd -eu $(pwd) /usr/bin "$1" awk && 2>/dev/null export
+printf done && && export then ${HOME}
+	readonly 2>/dev/null sed awk "$@" awk echo --verbose export export
+	export cd x=1 "$1" $(pwd) then x=1 done 'quoted text' ${HOME}
+	cd grep printf 'quoted text'
+/usr/bin 'quoted text' ${HOME} then 2>/dev/null 'quoted text'
+		then echo && readonly "$@" awk grep readonly /usr/bin -eu echo &&
+	then | -eu --verbose done readonly
+		local sed local x=1 | then 2>/dev/null
+done /usr/bin x=1 then x=1 --verbose cd printf echo && 2>/dev/null
+export printf ${HOME} sed readonly "$1"
+		grep && test "$@" "$@" --verbose
+	done 'quoted text' $(pwd) x=1 cd grep $(pwd) "$@" ${HOME}
+	-eu readonly sed --verbose then "$@" &&
+	-eu /usr/bin export -eu ${HOME} sed awk readonly readonly local
+	done then ${HOME} grep 2>/dev/null readonly | grep then ${HOME} done export
+		'quoted text' | --verbose --verbose test readonly awk awk export awk | awk then
+	done export -eu ${HOME} test export sed export 'quoted text' test printf
+	--verbose "$1" "$1" done "$@"
+	test printf && grep awk $(pwd) cd printf ${HOME} echo 'quoted text' | sed
+awk 2>/dev/null ${HOME}
+	printf printf local "$1" awk x=1 /usr/bin readonly export
+		readonly --verbose test /usr/bin /usr/bin export
+--verbose cd "$1" $(pwd) $(pwd) local $(pwd) cd 'quoted text'
+export done printf then cd 2>/dev/null && $(pwd)
+	&& grep $(pwd) "$1" test grep 2>/dev/null test
+		done printf | awk 'quoted text'
+	${HOME} | grep x=1 "$@" "$1" awk -eu done done -eu 2>/dev/null --verbose printf
+	export cd awk readonly $(pwd) done 2>/dev/null export
+		-eu | cd local 'quoted text' && --verbose then grep "$1" $(pwd)
+		local printf echo ${HOME}
+	done export sed sed --verbose 2>/dev/null export
+		then cd then $(pwd) local
+	--verbose | --verbose awk sed ${HOME} printf "$1"
+	"$1" ${HOME} export then $(pwd) then
+	2>/dev/null printf echo
+	/usr/bin "$@" awk --verbose --verbose 'quoted text'
+	awk 2>/dev/null /usr/bin awk done done --verbose then "$1" 2>/dev/null
+readonly export --verbose cd $(pwd) /usr/bin
+		--verbose printf local x=1 local readonly x=1 -eu /usr/bin
+	x=1 readonly done "$1" $(pwd) awk "$@" "$1" -eu -eu
+		| /usr/bin then done test done test /usr/bin | done x=1 $(pwd) sed "$@" |
+		${HOME} && readonly done test echo ${HOME}
+	sed local done 'quoted text' x=1 2>/dev/null local /usr/bin
+		cd cd printf test | "$@"
+	done $(pwd) 2>/dev/null sed 'quoted text' 2>/dev/null 2>/dev/null
+		printf && ${HOME} x=1 readonly -eu "$@" && cd local cd x=1 sed awk local then $(pwd)
+	"$@" export done /usr/bin grep done awk done
+	grep ${HOME} printf cd --verbose && echo then ${HOME} "$@"
+		test awk ${HOME} echo then cd printf 2>/dev/null
+		| -eu readonly grep cd test grep test "$@" done cd "$1" ${HOME} export x=1 --verbose
+		printf sed "$1" | awk --verbose
+	export | cd then local test grep ${HOME} readonly done sed x=1 printf
+	"$@" 'quoted text' && export local 'quoted text' 'quoted text' done
+	x=1 "$@" && done grep done /usr/bin ${HOME}
+--verbose 'quoted text' then 'quoted text' awk x=1 sed && /usr/bin
+	"$1" local awk grep 2>/dev/null x=1
+	readonly ${HOME} "$@" 2>/dev/null
+	export then x=1 echo | "$1"
+		printf then --verbose ${HOME}
+	2>/dev/null --verbose /usr/bin /usr/bin sed --verbose x=1 then -eu 2>/dev/null
+"$1" echo 2>/dev/null "$@"
+	${HOME} test cd done "$@" | then ${HOME} /usr/bin -eu
+	export /usr/bin && | x=1 && "$@" export $(pwd) done readonly /usr/bin done export
+export then --verbose "$1" cd -eu echo --verbose
+| "$1" sed awk done done awk grep done $(pwd) printf $(pwd) "$1" "$1" x=1 $(pwd)
+	awk sed ${HOME} cd | done 2>/dev/null --verbose done
+		| && test "$@" "$@" printf x=1 x=1 --verbose ${HOME} awk
+cd --verbose export printf | then cd && then
+	sed awk x=1 | 2>/dev/null done grep
+	&& printf -eu then x=1 -eu readonly export x=1 "$1" 'quoted text'
+	&& grep 'quoted text' /usr/bin $(pwd) "$1" printf done sed
+	/usr/bin /usr/bin "$1"
+${HOME} printf --verbose sed -eu
+		grep local grep done -eu export grep done local echo --verbose 2>/dev/null
+$(pwd) x=1 2>/dev/null test "$1" 'quoted text'
+&& then "$@" -eu /usr/bin 'quoted text' --verbose
+		"$1" /usr/bin --verbose x=1 "$1" echo done 'quoted text'
+	x=1 export cd test readonly ${HOME}
+	"$1" 2>/dev/null 'quoted text' -eu $(pwd) done then then cd /usr/bin &&
+	/usr/bin 'quoted text' | 'quoted text' sed sed then
+	'quoted text' then grep "$1" then && -eu -eu $(pwd) grep | export done ${HOME}
+		sed --verbose export --verbose sed x=1 2>/dev/null local test readonly
+	'quoted text' export /usr/bin && grep readonly then then awk awk sed
+	/usr/bin "$1" ${HOME} sed 'quoted text' then -eu then 2>/dev/null
+	awk local -eu echo test 2>/dev/null -eu grep 2>/dev/null $(pwd) "$@" && awk -eu
+	/usr/bin grep cd echo 'quoted text' then echo local "$1" cd --verbose 'quoted text'
+	2>/dev/null "$1" "$@" sed && echo printf sed -eu local done sed
+	"$@" awk "$@" 2>/dev/null &&
+	-eu 2>/dev/null cd then export then sed sed sed readonly
+	sed && -eu -eu "$@" "$1" sed --verbose "$@" echo grep "$1" && cd
+		grep printf "$@" 2>/dev/null x=1 && awk then sed readonly
+	$(pwd) --verbose sed awk -eu then && && 2>/dev/null printf cd
+"$@" && done sed echo /usr/bin
+		sed | $(pwd) /usr/bin $(pwd)
+"$@" "$1" readonly cd $(pwd) grep echo export "$1" export
+		2>/dev/null && -eu && "$@" grep readonly printf | && /usr/bin "$@" export
+x=1 sed && printf test x=1 grep 2>/dev/null local 'quoted text' |
+$(pwd) grep echo 2>/dev/null
+/usr/bin -eu x=1 "$@"
+-eu sed local --verbose done $(pwd) --verbose /usr/bin grep sed echo done /usr/bin
+$(pwd) readonly then $(pwd) grep x=1 awk | readonly test "$1" echo ${HOME}
+cd | --verbose "$1" printf test -eu test /usr/bin
+	${HOME} echo $(pwd) $(pwd) 2>/dev/null "$@" readonly "$1" printf sed echo /usr/bin
+		${HOME} 2>/dev/null local x=1 test sed "$@" &&
+	printf export echo $(pwd)
+--verbose local echo 'quoted text' export ${HOME}
+		--verbose export grep done local
+		cd then readonly test | --verbose awk "$1" $(pwd) printf && sed readonly
+		export 'quoted text' printf "$1" grep
+readonly 'quoted text' awk /usr/bin export export grep "$1" 'quoted text'
+2>/dev/null | && readonly test grep | then export export --verbose local
+		test printf done test test readonly
+	&& x=1 done | "$1" printf /usr/bin local "$@" -eu -eu cd
+$(pwd) then then $(pwd) -eu test ${HOME} sed $(pwd) done
+		local 2>/dev/null grep x=1 -eu echo "$@" echo 'quoted text'
+	grep && then | | sed "$@" cd /usr/bin 2>/dev/null readonly
+	-eu cd sed awk done 'quoted text'
+awk -eu | then printf local && $(pwd) && 2>/dev/null
+		sed 2>/dev/null printf /usr/bin printf
+-eu "$1" sed | grep cd readonly 2>/dev/null
+	done --verbose local readonly
+		"$1" then then sed grep cd $(pwd) x=1
+		cd echo "$1" readonly &&
+	-eu "$1" sed | /usr/bin grep x=1 x=1 /usr/bin
+printf printf "$@" awk 2>/dev/null
+	| "$@" echo export printf
+	--verbose ${HOME} 'quoted text' local sed /usr/bin ${HOME}
+&& echo test then test done local
+local && ${HOME} local printf "$@" 2>/dev/null readonly
+		/usr/bin local local | 'quoted text' cd awk
+	sed "$1" printf | /usr/bin &&
+grep x=1 awk 'quoted text'
+		sed echo test /usr/bin &&
+then x=1 2>/dev/null | awk done readonly local readonly
+grep "$1" --verbose cd -eu then ${HOME} /usr/bin
+$(pwd) "$1" ${HOME} 2>/dev/null test "$@" -eu local cd && printf --verbose
+awk "$@" --verbose grep test sed 'quoted text' readonly && done grep readonly
+		--verbose echo export readonly && "$1" printf "$1" test printf
+	-eu "$1" x=1 "$1" $(pwd) -eu test --verbose 'quoted text' 'quoted text'
+'quoted text' 'quoted text' export /usr/bin readonly
+local "$@" cd done then readonly sed done x=1 test then local export ${HOME} ${HOME}
+	sed echo 'quoted text' "$1"
+done then --verbose ${HOME} && printf local /usr/bin 'quoted text'
+	then && | ${HOME} test ${HOME} readonly grep readonly cd | done 'quoted text'
+		&& ${HOME} cd cd /usr/bin $(pwd) sed test "$@" ${HOME} sed cd | sed $(pwd) export
+		grep && done readonly cd ${HOME} grep | cd done --verbose test ${HOME}
+${HOME} "$1" && readonly | sed 2>/dev/null cd 2>/dev/null readonly
+	readonly then local readonly $(pwd) 2>/dev/null
+		sed awk echo printf --verbose $(pwd)
+then 2>/dev/null --verbose "$1" -eu done echo $(pwd) 'quoted text'
+2>/dev/null "$1" local && printf
+${HOME} cd ${HOME} "$@" && cd cd then local -eu -eu -eu /usr/bin sed local export
+	$(pwd) sed test x=1 "$1" -eu && readonly done test ${HOME} export "$1" local
+${HOME} 'quoted text' grep done 'quoted text'
+	x=1 $(pwd) readonly done x=1 grep --verbose
+	export -eu sed then then readonly x=1 printf
+readonly export awk && /usr/bin $(pwd) echo
+2>/dev/null && "$@" cd 2>/dev/null done local ${HOME}
+		$(pwd) -eu --verbose 2>/dev/null grep awk done done "$1" then awk grep "$1"
+		sed /usr/bin awk ${HOME} test | readonly --verbose echo export "$@" then
+		"$@" echo --verbose "$1" | "$@" then 'quoted text' | sed local 2>/dev/null
+	"$1" $(pwd) -eu grep sed 'quoted text' x=1 echo ${HOME}
+		test grep test local | then |
+then $(pwd) echo "$@" 2>/dev/null echo sed grep --verbose printf
+"$@" done awk then echo sed $(pwd) sed export grep | x=1 local readonly grep
+		| ${HOME} echo "$1" local cd /usr/bin "$@" x=1
+x=1 $(pwd) $(pwd) echo --verbose
+/usr/bin "$1" awk grep done x=1 cd readonly readonly awk grep
+		-eu x=1 "$@" /usr/bin --verbose echo "$@" /usr/bin
+	&& | && 2>/dev/null test
+		${HOME} awk export cd /usr/bin
+		readonly x=1 x=1 readonly then echo export test
+	2>/dev/null --verbose --verbose -eu cd 2>/dev/null "$@" /usr/bin x=1
+	-eu 2>/dev/null local ${HOME} "$@" --verbose x=1 'quoted text' printf
+	sed awk readonly test $(pwd) then
+		"$@" 2>/dev/null --verbose --verbose grep echo
+'quoted text' cd printf
+${HOME} -eu sed sed "$@"
+		--verbose local awk awk ${HOME} x=1 --verbose echo | local 2>/dev/null printf
+printf then | echo local 2>/dev/null 'quoted text' printf
+		done test -eu sed $(pwd) test 2>/dev/null "$@" done 2>/dev/null "$1" -eu
+		local "$1" 2>/dev/null /usr/bin --verbose ${HOME}
+		"$@" "$1" --verbose printf test then sed --verbose echo grep export -eu test
+local && /usr/bin echo then "$@" done readonly ${HOME}
+"$@" test $(pwd) grep x=1 done 'quoted text' 2>/dev/null 'quoted text'
+	awk ${HOME} echo awk /usr/bin test ${HOME} echo sed --verbose cd
+	$(pwd) | --verbose ${HOME} ${HOME} /usr/bin test "$1" /usr/bin 2>/dev/null
+		readonly x=1 --verbose && done cd done x=1 -eu /usr/bin
+		local cd grep cd then export
+printf then /usr/bin 'quoted text'
+		'quoted text' 2>/dev/null local export export printf export local
+--verbose && awk && then done test
+	&& -eu echo 2>/dev/null $(pwd) cd
+	2>/dev/null cd test cd --verbose readonly -eu printf "$@" -eu 'quoted text'
+"$1" -eu && ${HOME} cd 'quoted text' local 2>/dev/null "$@" local
+		'quoted text' "$1" -eu done
+		'quoted text' 'quoted text' ${HOME} && 'quoted text' --verbose x=1 echo done
+echo --verbose test readonly cd x=1 | $(pwd) "$1"
+${HOME} readonly "$@" 2>/dev/null export sed test 2>/dev/null
+"$1" test test done 'quoted text' printf local | local cd printf
+		then local $(pwd) ${HOME} readonly cd cd readonly test && local /usr/bin
+	-eu sed /usr/bin "$1" && sed /usr/bin local cd "$@" done awk "$@" then $(pwd)
+	"$1" x=1 'quoted text' printf test local then test readonly
+	then /usr/bin $(pwd) sed test 2>/dev/null /usr/bin
+${HOME} export ${HOME} /usr/bin readonly grep echo sed x=1 |
+awk then "$@" 'quoted text' -eu export printf done "$@" local echo
+2>/dev/null sed ${HOME} $(pwd) echo "$1" test printf 'quoted text'
+readonly awk awk "$@" awk /usr/bin cd /usr/bin grep --verbose cd export -eu "$1"
+grep "$1" local awk ${HOME} ${HOME} readonly test ${HOME} && done 2>/dev/null
+"$@" -eu ${HOME} "$@" -eu ${HOME}
+		then done --verbose test done | /usr/bin | export
+	${HOME} sed test && cd readonly grep cd awk "$@" ${HOME} ${HOME} x=1 local
+export cd && $(pwd) 'quoted text' cd
+readonly sed sed -eu && --verbose then export ${HOME} && cd "$@" 2>/dev/null |
+		"$@" /usr/bin 'quoted text' x=1
+grep | -eu "$1" cd "$@" export -eu --verbose "$1" cd echo sed
+		2>/dev/null printf awk local sed grep echo --verbose done cd echo echo test
+	$(pwd) local done cd printf then grep ${HOME} echo export then grep awk
+		local x=1 "$1" done -eu export -eu x=1 'quoted text'
+	| readonly 'quoted text' "$1" ${HOME}
+"$1" $(pwd) cd grep sed awk 'quoted text'
+then | /usr/bin /usr/bin awk "$@" "$1"
+export --verbose readonly --verbose awk -eu "$@" grep printf | export
+		x=1 /usr/bin sed -eu readonly echo sed | -eu --verbose "$1"
+	'quoted text' printf $(pwd)
+--verbose local "$1" && cd | ${HOME}
+-eu "$@" "$1" --verbose "$1" sed $(pwd) "$@" ${HOME} readonly
+		done --verbose && -eu printf
+		cd echo then /usr/bin ${HOME}
+	local echo | awk then ${HOME} grep "$1" && x=1 -eu
+	awk test x=1 'quoted text'
+| -eu sed then x=1 awk
+	grep test "$1" --verbose --verbose printf export --verbose printf
+	$(pwd) ${HOME} | -eu /usr/bin readonly
+	done ${HOME} grep ${HOME}
+printf test /usr/bin echo 'quoted text' "$@" x=1 'quoted text' local | ${HOME}
+	"$@" "$1" && | then -eu echo /usr/bin grep 2>/dev/null
+done grep | local awk 'quoted text' cd && done
+&& then 'quoted text' /usr/bin done sed test
+	$(pwd) -eu awk "$@" -eu --verbose grep done "$@"
+'quoted text' printf --verbose | readonly readonly
+test /usr/bin && cd local 2>/dev/null cd "$@" sed "$@" grep x=1 2>/dev/null cd 'quoted text'
+	x=1 grep readonly ${HOME} ${HOME} grep cd test /usr/bin
+		"$1" sed x=1 sed done 2>/dev/null cd printf && done printf
+then export readonly "$1"
+then --verbose $(pwd) ${HOME} local printf 'quoted text' grep cd awk
+		/usr/bin test -eu sed done 2>/dev/null grep sed export local cd echo
+	-eu "$1" $(pwd) | | --verbose
+--verbose test export ${HOME} cd then "$@" awk 'quoted text'
+		-eu then $(pwd) cd /usr/bin "$@" sed &&
+'quoted text' then sed echo local then echo /usr/bin | "$@" ${HOME} "$@"
+--verbose "$@" awk | then readonly ${HOME} export readonly
+echo readonly grep "$1" && && export
+		"$@" --verbose awk then cd echo -eu sed $(pwd) && &&
+	${HOME} x=1 cd $(pwd) readonly $(pwd)
+		export x=1 | test -eu awk -eu readonly grep then /usr/bin
+		&& --verbose "$@" "$@" 2>/dev/null "$1" ${HOME}
+		test echo then --verbose
+/usr/bin then awk --verbose readonly 'quoted text' /usr/bin 2>/dev/null
+	local /usr/bin cd --verbose ${HOME} --verbose then -eu ${HOME} | sed x=1
+--verbose test readonly grep then x=1 printf readonly
+		done cd grep awk $(pwd) echo test printf -eu /usr/bin
+	x=1 2>/dev/null | readonly local
+grep ${HOME} printf -eu
+| printf local $(pwd) | /usr/bin sed "$1" export grep "$1" echo
+		printf printf sed "$@" readonly -eu x=1 && readonly awk x=1 "$1" 2>/dev/null
+		-eu test awk "$1" printf && 'quoted text' 2>/dev/null grep local
+"$1" local x=1 local "$1" /usr/bin
+${HOME} cd test done local
+	test && local awk x=1 x=1 $(pwd)
+	awk local readonly done done grep
+		| export x=1 | cd cd test cd cd awk readonly "$@" --verbose 'quoted text'
+--verbose sed "$1" grep export /usr/bin awk ${HOME}
+"$1" x=1 echo --verbose x=1 'quoted text' $(pwd)
+grep ${HOME} grep readonly
+&& echo awk --verbose
+		echo /usr/bin then -eu local
+		done 2>/dev/null readonly /usr/bin "$1" --verbose printf && printf
+local && $(pwd) export -eu $(pwd) "$1" grep done export -eu test -eu test $(pwd)
+readonly then /usr/bin x=1 | --verbose
+sed | then awk && ${HOME} then cd printf /usr/bin
+echo test && --verbose
+	"$1" sed local && "$@" export export "$@" $(pwd) local cd $(pwd) export
+		then printf $(pwd) test sed 2>/dev/null readonly printf ${HOME} readonly 2>/dev/null
+	&& "$1" "$@" done export && then
+		--verbose then test done "$@" x=1 printf
+		echo "$@" grep grep && local && printf 2>/dev/null grep grep echo
+		export 'quoted text' done | cd 2>/dev/null "$1" --verbose
+cd test done && then readonly then export printf grep
+		/usr/bin 'quoted text' sed 2>/dev/null && "$@" test printf
+		"$1" $(pwd) $(pwd) awk -eu $(pwd) printf "$1" --verbose
+		readonly test done 2>/dev/null 'quoted text' test && printf printf
+	done done cd export "$@"
+		-eu | echo awk export local /usr/bin "$@" x=1 awk "$@" test 'quoted text'
+printf echo "$1" "$1" "$@" | --verbose -eu sed then | local grep -eu 2>/dev/null
+	then $(pwd) then "$1" && done then awk --verbose x=1
+readonly echo then done done printf 'quoted text'
+	test awk "$1" awk test export grep local /usr/bin 'quoted text'
+echo 'quoted text' local 2>/dev/null --verbose
+"$1" 2>/dev/null --verbose done readonly x=1 x=1 "$1" awk export
+$(pwd) 2>/dev/null test 2>/dev/null | then awk done done grep echo test cd then
+	/usr/bin "$1" x=1 awk readonly
+	echo 2>/dev/null test done then awk -eu printf done
+x=1 $(pwd) then | "$@" $(pwd) --verbose echo $(pwd)
+	| "$@" readonly --verbose export cd && printf
+	sed readonly local awk awk 'quoted text'
+		echo done then cd && awk --verbose
+		-eu sed awk local 2>/dev/null export
+done 'quoted text' cd "$1" sed "$1"
+		awk && 'quoted text' printf readonly
+export ${HOME} test /usr/bin test local --verbose "$@" then -eu readonly then
+		/usr/bin done && export ${HOME} 'quoted text' ${HOME} echo sed $(pwd) cd
+	printf done printf echo 'quoted text' ${HOME}
+	then x=1 $(pwd) test && awk cd sed ${HOME} awk "$@" echo "$1" test test echo local
+	$(pwd) sed then x=1 sed readonly -eu /usr/bin
+		readonly readonly /usr/bin && -eu
+		readonly grep readonly sed readonly
+	echo x=1 x=1 done then awk
+		grep "$@" 2>/dev/null && export then echo then -eu "$1"
+	--verbose ${HOME} then "$@" local ${HOME} printf then cd echo
+export --verbose 'quoted text' then
+	${HOME} then printf &&
+	sed readonly export --verbose local 'quoted text' x=1 export 'quoted text'
+		done grep && sed export readonly done ${HOME}
+		echo grep export "$@" | echo awk | -eu && /usr/bin /usr/bin readonly 'quoted text'
+	&& awk local cd 'quoted text' | ${HOME}
+		export && local 2>/dev/null sed $(pwd)
+	local | echo printf cd export "$1" "$1" $(pwd)
+	sed $(pwd) printf cd cd $(pwd) test 'quoted text' echo | 2>/dev/null "$@" sed
+		/usr/bin /usr/bin then cd awk /usr/bin done
+		${HOME} export | 2>/dev/null --verbose echo local && "$1" | 2>/dev/null
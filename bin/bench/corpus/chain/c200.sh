@@ -0,0 +1,2001 @@
+	cd grep readonly x=1
+		readonly echo 2>/dev/null printf "$1" "$1" 'quoted text' 2>/dev/null
+		local && grep -eu then done
+		then then cd "$@" then local echo done "$@" done "$1"
+		local awk done echo 2>/dev/null ${HOME} readonly "$@" local 2>/dev/null awk 'quoted text'
+x=1 /usr/bin awk "$1" echo ${HOME} 2>/dev/null /usr/bin | /usr/bin
+		x=1 "$1" /usr/bin test grep 'quoted text'
+		echo && test echo awk /usr/bin local done /usr/bin test "$1" local done printf
+&& echo export sed "$1" done 2>/dev/null
+then && export ${HOME} echo grep 2>/dev/null
+${HOME} x=1 $(pwd) echo --verbose && "$@" $(pwd) readonly
+		printf echo $(pwd) $(pwd) test --verbose sed "$1" && echo readonly ${HOME}
+		grep echo "$1" -eu sed && 'quoted text' sed printf
+"$1" "$@" test $(pwd) && cd "$1" /usr/bin sed then ${HOME} sed
+		printf readonly "$1" export grep
+		grep | /usr/bin then printf then cd x=1 ${HOME} 2>/dev/null grep -eu sed
+readonly | "$@" cd readonly x=1 done && local done ${HOME}
+	sed grep "$1" grep echo --verbose awk x=1 echo
+		awk export done grep "$1" /usr/bin printf ${HOME} export 2>/dev/null test
+	x=1 && 2>/dev/null --verbose local ${HOME} awk
+		"$@" cd awk test export done "$@" done local
+		"$1" 2>/dev/null done x=1 export --verbose x=1 echo local grep printf
+	awk local sed ${HOME} cd --verbose export printf $(pwd) then readonly
+	local -eu 2>/dev/null &&
+	/usr/bin /usr/bin test local echo $(pwd)
+		readonly sed done then printf "$1" local awk $(pwd) 'quoted text' | awk
+| cd done sed awk 'quoted text'
+cd "$1" readonly cd export 2>/dev/null --verbose printf readonly
+printf local 'quoted text' local | 'quoted text'
+	"$1" 'quoted text' grep echo awk /usr/bin
+	-eu export printf /usr/bin 2>/dev/null echo local /usr/bin
+	awk then cd grep grep printf then 2>/dev/null echo awk
+	cd "$@" && test /usr/bin "$@" /usr/bin 'quoted text' awk
+		then readonly echo local -eu test test ${HOME} /usr/bin "$@"
+		echo --verbose echo && export 'quoted text' readonly 'quoted text'
+printf 'quoted text' x=1 cd $(pwd) "$1" then cd x=1 sed sed awk then --verbose
+	local then "$1" /usr/bin done x=1
+		| cd export printf done --verbose done x=1 ${HOME} -eu printf && export then
+cd readonly cd local --verbose $(pwd) 2>/dev/null
+		local printf local then then | -eu -eu grep /usr/bin --verbose
+export /usr/bin ${HOME} | 2>/dev/null && cd printf readonly "$@" | "$@" grep
+		cd --verbose && ${HOME} 'quoted text' local $(pwd) readonly
+&& $(pwd) "$1" $(pwd) then sed -eu "$@" then --verbose sed readonly
+"$1" export echo "$1"
+x=1 --verbose export then readonly printf done /usr/bin echo awk echo &&
+	| && "$1" 2>/dev/null "$1" awk readonly done | $(pwd) /usr/bin ${HOME}
+		printf --verbose grep cd ${HOME} x=1 -eu grep readonly
+		$(pwd) then test | && cd local cd grep readonly
+	/usr/bin awk cd && "$@" -eu && 'quoted text' local done ${HOME} then "$1"
+		${HOME} printf local x=1 echo done echo grep cd grep
+		--verbose x=1 done grep echo 'quoted text' "$1" sed "$@"
+	done sed 'quoted text' 2>/dev/null awk -eu then 'quoted text' --verbose
+	x=1 --verbose test $(pwd) done done echo grep
+		2>/dev/null export x=1 sed awk x=1 "$1" test $(pwd) $(pwd) x=1 awk echo
+		&& sed cd sed $(pwd) done printf
+	'quoted text' echo ${HOME} "$@" "$1" "$1" echo readonly 'quoted text'
+		local --verbose grep $(pwd) -eu $(pwd) "$@" echo test test
+"$@" grep -eu test "$@" $(pwd) awk test awk -eu
+	grep "$1" | grep 2>/dev/null local sed 2>/dev/null printf done grep &&
+	'quoted text' grep && x=1 cd echo done test done export
+export ${HOME} ${HOME} awk x=1 export readonly export x=1 awk $(pwd) export
+	x=1 grep "$1" then printf sed -eu -eu export done && test
+		--verbose test 2>/dev/null cd
+readonly sed sed test "$@" local $(pwd) "$@" test &&
+x=1 /usr/bin export 'quoted text' printf -eu x=1
+		printf ${HOME} test x=1 test
+test sed && done then awk export ${HOME} 2>/dev/null then "$1" awk /usr/bin printf
+		"$1" sed echo | then --verbose "$@" then export
+		"$1" | | && export -eu x=1 grep sed printf "$1" -eu cd
+	'quoted text' -eu | x=1 grep local | readonly ${HOME} readonly x=1
+	&& printf "$1" ${HOME} grep "$@" echo 2>/dev/null
+	x=1 cd $(pwd) then $(pwd) | $(pwd) "$1" | readonly grep cd ${HOME} done done |
+echo -eu done $(pwd) "$1" test $(pwd) done 'quoted text' awk local
+		"$1" | readonly local x=1 "$1" sed 'quoted text' cd grep "$1" "$@" 'quoted text'
+&& -eu done "$1" | grep printf | -eu "$@"
+	test test echo 'quoted text' 2>/dev/null echo 'quoted text' done $(pwd)
+		grep /usr/bin 'quoted text'
+echo printf $(pwd) x=1 "$1" -eu "$@" -eu
+	/usr/bin test && /usr/bin
+	awk && x=1 test awk sed
+awk sed && test export test readonly then local $(pwd) readonly --verbose done grep
+		cd then export ${HOME} awk --verbose
+		"$1" $(pwd) --verbose readonly test printf export "$@" "$@" |
+		readonly && echo awk sed printf export echo then
+local /usr/bin ${HOME} x=1 | sed then cd cd --verbose cd "$@" 'quoted text'
+	local done export export "$@" echo 2>/dev/null
+	export sed cd 2>/dev/null printf "$@" awk cd readonly x=1 ${HOME}
+readonly cd test done readonly /usr/bin local cd "$@" awk --verbose test $(pwd)
+		| x=1 /usr/bin && "$1" 2>/dev/null 'quoted text' ${HOME} then
+grep /usr/bin cd awk "$1" | 2>/dev/null
+grep | then local --verbose test then grep x=1 then --verbose
+'quoted text' -eu "$@" 2>/dev/null grep 'quoted text' $(pwd) awk && "$1" -eu
+		-eu "$@" awk "$@" $(pwd) x=1 grep
+-eu /usr/bin then then test | echo echo export
+	-eu | echo awk 'quoted text' -eu ${HOME} x=1 -eu export "$1" local export test
+		2>/dev/null test | /usr/bin sed
+	'quoted text' 'quoted text' local x=1
+		sed echo 'quoted text' --verbose test then ${HOME} readonly --verbose export
+	readonly --verbose /usr/bin
+	| cd sed /usr/bin test
+		"$@" "$@" readonly ${HOME} readonly
+		cd "$@" grep /usr/bin 'quoted text' --verbose
+2>/dev/null echo x=1 printf readonly cd x=1 x=1 readonly
+	awk cd sed then "$1" "$@" && ${HOME} grep then 'quoted text'
+		--verbose /usr/bin test export echo grep && sed x=1 "$1" done grep grep
+done grep ${HOME} /usr/bin 'quoted text' readonly
+${HOME} /usr/bin readonly /usr/bin --verbose readonly
+	-eu readonly "$1" -eu "$@" printf "$@" echo -eu && "$@" cd "$1" sed | x=1
+		-eu printf done printf x=1 export echo
+	${HOME} test 2>/dev/null cd echo sed then local local && | "$@"
+--verbose grep && then ${HOME} -eu done "$1" then echo "$1" done "$1" grep
+sed grep sed 'quoted text'
+		-eu echo export "$@" done /usr/bin 2>/dev/null printf sed awk grep test readonly
+	-eu awk done $(pwd) done grep ${HOME} | awk --verbose "$1" sed then export
+		'quoted text' "$1" readonly then done --verbose /usr/bin local -eu --verbose
+2>/dev/null awk echo printf readonly
+done -eu 2>/dev/null echo
+| "$@" | awk printf echo --verbose | done export ${HOME} --verbose awk | printf
+	readonly && local -eu readonly $(pwd) done
+2>/dev/null sed local && $(pwd) "$1" | done
+	local awk && awk 2>/dev/null
+awk --verbose export --verbose | cd x=1 --verbose
+${HOME} "$1" && /usr/bin echo 2>/dev/null
+"$@" sed ${HOME} done &&
+		"$1" | local && cd x=1 'quoted text' export grep 2>/dev/null
+	test awk "$1" local "$1" sed local $(pwd) ${HOME} awk
+		| then readonly 'quoted text' grep export | cd awk $(pwd)
+	&& sed export cd --verbose --verbose "$1" |
+	export test grep x=1 /usr/bin
+		done -eu x=1 printf 2>/dev/null --verbose 2>/dev/null && echo --verbose readonly
+"$@" sed --verbose && $(pwd) test 2>/dev/null local
+	&& --verbose local x=1 readonly 'quoted text' cd test ${HOME} --verbose x=1
+		| $(pwd) readonly $(pwd) test /usr/bin echo "$@" cd && readonly
+		| "$1" -eu test local local then /usr/bin | "$1" grep $(pwd) 2>/dev/null 2>/dev/null
+	echo test sed ${HOME} test "$1" && | "$@" --verbose
+	local sed echo --verbose x=1 cd /usr/bin "$1" local /usr/bin done printf cd then
+2>/dev/null "$1" grep printf | test cd && grep
+		awk awk "$@" local 2>/dev/null then "$@" sed done printf $(pwd) local test
+	local 'quoted text' local 2>/dev/null export readonly $(pwd) local | &&
+"$1" x=1 ${HOME} awk export grep local
+	test grep readonly test then done
+	readonly then sed sed -eu --verbose --verbose /usr/bin ${HOME} echo cd
+then export x=1 x=1 export awk x=1 echo "$1" /usr/bin sed local $(pwd) sed
+cd --verbose "$1" export export local
+	printf printf export export ${HOME} cd 2>/dev/null 2>/dev/null sed export
+	awk cd printf printf x=1
+	echo | export done sed $(pwd) local readonly
+${HOME} /usr/bin sed grep x=1 cd awk printf
+	cd grep x=1 cd 'quoted text' readonly ${HOME} cd printf 'quoted text'
+		printf ${HOME} readonly cd
+		local -eu 2>/dev/null then
+	2>/dev/null cd test ${HOME} 'quoted text' grep
+grep grep awk cd sed then awk cd
+		then then --verbose export local
+	sed then sed local 'quoted text' ${HOME} --verbose export
+	cd $(pwd) | awk /usr/bin /usr/bin awk 2>/dev/null printf
+$(pwd) then readonly $(pwd)
+		${HOME} x=1 cd "$1" $(pwd) grep /usr/bin readonly cd "$@" | export awk /usr/bin
+	| x=1 then cd test done x=1 $(pwd) 2>/dev/null local x=1 export &&
+		then -eu | export 'quoted text' export
+		cd -eu $(pwd) test export 'quoted text' grep done test done grep 2>/dev/null local
+done 2>/dev/null "$@" "$1" -eu export cd 'quoted text'
+	printf done && --verbose | local then then test
+awk $(pwd) done printf | /usr/bin export grep -eu echo export grep
+	'quoted text' $(pwd) -eu "$@" local sed x=1 sed
+x=1 sed x=1 done -eu ${HOME} then /usr/bin --verbose grep
+		test cd cd -eu cd | ${HOME}
+		--verbose sed then awk printf "$1" "$@" /usr/bin && $(pwd) ${HOME}
+$(pwd) -eu $(pwd) awk 2>/dev/null | awk $(pwd) then && done
+2>/dev/null x=1 ${HOME} printf readonly then awk "$1" && x=1 echo readonly
+	cd printf printf 'quoted text' && then sed sed done --verbose test printf readonly
+then test -eu test -eu done --verbose $(pwd) | x=1 /usr/bin | "$@"
+	done "$@" && cd echo 'quoted text' && "$@" x=1 "$@" --verbose sed done "$@" ${HOME}
+&& sed echo echo then 'quoted text' "$@" then done
+"$1" -eu cd 2>/dev/null | ${HOME} export --verbose
+/usr/bin echo && ${HOME} "$@" x=1 --verbose then then awk done export && 'quoted text'
+	/usr/bin test readonly then grep --verbose cd awk && awk awk "$1"
+sed done ${HOME} then "$1" --verbose printf && awk done
+	'quoted text' export printf
+	sed cd | ${HOME} && cd "$@" done
+		echo 2>/dev/null $(pwd) test x=1 "$1" export cd test /usr/bin ${HOME}
+done then ${HOME} /usr/bin then awk -eu test
+	then 2>/dev/null "$1" -eu echo done local cd
+	done ${HOME} export 2>/dev/null readonly sed ${HOME} 2>/dev/null
+		cd echo test x=1 --verbose /usr/bin x=1 "$1" cd test cd awk printf
+		printf && | grep done local local | then && printf
+		"$1" "$1" echo && ${HOME} local "$@" && 2>/dev/null
+		then --verbose done ${HOME}
+	local /usr/bin && ${HOME}
+cd export printf | /usr/bin $(pwd) done
+		grep --verbose $(pwd) then -eu "$@" x=1 'quoted text' cd cd | export local
+		sed /usr/bin grep --verbose sed
+		"$@" "$1" 2>/dev/null readonly export echo readonly $(pwd) export --verbose
+then cd $(pwd) 'quoted text' && awk cd echo readonly
+	test echo readonly "$1" printf x=1 2>/dev/null
+		echo /usr/bin && cd export && test echo "$1" 2>/dev/null cd "$1" 'quoted text'
+readonly --verbose done printf readonly sed $(pwd) 'quoted text'
+	grep echo x=1 readonly awk --verbose printf done awk -eu done
+		| --verbose then done export done grep x=1
+	| sed printf && cd test -eu echo echo sed awk
+printf then then sed ${HOME} ${HOME} x=1 echo x=1 -eu grep 2>/dev/null 'quoted text'
+	echo local cd 'quoted text' | x=1 2>/dev/null "$1" -eu local
+	/usr/bin $(pwd) /usr/bin export ${HOME} export | && ${HOME}
+echo cd export grep "$@" export
+done grep && local sed done
+x=1 test grep "$@" ${HOME} printf local test
+	| "$@" $(pwd) | /usr/bin && then cd
+local grep 2>/dev/null "$@" x=1 'quoted text'
+x=1 export -eu done /usr/bin sed --verbose ${HOME} --verbose echo
+	${HOME} then done 'quoted text' test export | "$@" printf ${HOME} then 'quoted text'
+$(pwd) "$1" readonly "$1" export --verbose export $(pwd) "$@" readonly
+	cd local grep then ${HOME}
+sed $(pwd) $(pwd) | /usr/bin 'quoted text' export $(pwd) sed &&
+		grep -eu ${HOME} test sed done
+		| $(pwd) awk done | ${HOME}
+		-eu done "$1" echo cd 2>/dev/null -eu printf cd 'quoted text'
+x=1 cd x=1 $(pwd) --verbose | "$1" awk local
+grep done export local "$@" printf sed local cd && -eu
+export test awk awk done "$@" --verbose x=1 'quoted text' | "$@" &&
+	cd done export echo local sed "$@" printf grep readonly /usr/bin test -eu sed
+		x=1 sed test cd local "$1" -eu done grep readonly x=1 echo echo
+printf printf readonly awk then readonly grep
+done --verbose then grep sed echo "$1" 2>/dev/null export done export ${HOME} then
+	export done printf printf grep --verbose local "$1" && test sed
+		-eu $(pwd) "$@" export printf /usr/bin printf "$@" 2>/dev/null readonly
+| readonly awk "$1" readonly then printf && local printf --verbose
+| ${HOME} -eu echo ${HOME} printf test local -eu --verbose
+	test "$1" local cd echo x=1 test /usr/bin
+	'quoted text' x=1 grep "$1" readonly /usr/bin printf export | ${HOME} -eu
+x=1 2>/dev/null cd sed echo printf
+done /usr/bin "$@" -eu ${HOME} test $(pwd) "$@" -eu awk -eu $(pwd) 'quoted text'
+$(pwd) 'quoted text' --verbose export x=1 sed
+	done test export sed 'quoted text' && --verbose cd --verbose
+	awk grep local test "$1" local $(pwd) cd 2>/dev/null -eu ${HOME}
+&& x=1 --verbose "$1" --verbose "$1"
+		&& cd --verbose "$1" cd -eu export
+		local grep "$@" | local $(pwd)
+	$(pwd) --verbose test "$1" "$1" grep
+	sed echo printf "$1" test sed then --verbose echo
+	"$1" cd test --verbose printf sed $(pwd) | echo local /usr/bin x=1 "$@" awk
+	sed export printf cd printf -eu -eu
+		"$1" grep --verbose local local then 2>/dev/null 2>/dev/null --verbose
+'quoted text' -eu test then readonly --verbose --verbose then -eu "$@" 2>/dev/null
+		&& echo "$@" && 2>/dev/null --verbose grep ${HOME} 'quoted text'
+		grep "$1" "$@" printf 2>/dev/null printf
+		$(pwd) 2>/dev/null | cd x=1 echo && sed cd echo 'quoted text'
+	test x=1 "$1" sed "$@" readonly awk printf cd &&
+	awk done | echo awk && 'quoted text' awk test
+		--verbose then local --verbose local awk export sed /usr/bin export
+| "$@" echo "$1" echo "$1" grep $(pwd) ${HOME} grep local grep 2>/dev/null
+	cd printf test echo -eu "$1" readonly
+local 'quoted text' printf local "$@" 'quoted text' printf export echo test
+local 'quoted text' /usr/bin readonly local | echo ${HOME} local cd "$@"
+	$(pwd) cd 'quoted text' /usr/bin -eu x=1 echo local
+done echo export ${HOME} 'quoted text' | test readonly test sed done echo
+	grep echo done then export test printf test
+	grep | test ${HOME} x=1 -eu 2>/dev/null
+		'quoted text' && awk local printf x=1 --verbose $(pwd)
+then && | | printf export awk | /usr/bin "$1"
+echo /usr/bin done readonly
+		${HOME} $(pwd) /usr/bin && sed
+		local local test printf done done "$1" readonly printf 2>/dev/null test ${HOME}
+grep awk | --verbose printf grep export | --verbose awk 'quoted text' cd
+	echo | echo "$1" 2>/dev/null && && && awk done export then 'quoted text'
+		2>/dev/null sed done cd --verbose /usr/bin --verbose $(pwd) sed export
+	done grep printf then readonly
+		"$1" grep awk readonly 'quoted text' | $(pwd) printf local 'quoted text'
+		test printf cd then grep -eu printf --verbose export export | export then
+	done readonly done cd /usr/bin test then printf && printf readonly | --verbose
+	/usr/bin -eu x=1 $(pwd) ${HOME} readonly cd readonly
+	printf "$@" -eu --verbose cd ${HOME} | echo "$1" && $(pwd) -eu
+${HOME} 'quoted text' export x=1 cd
+		| $(pwd) local /usr/bin "$1" echo sed awk && awk 2>/dev/null grep grep
+	&& export grep && export awk then && printf then printf x=1 echo ${HOME}
+"$1" readonly test 2>/dev/null | "$1" ${HOME} readonly echo -eu grep | "$@" 'quoted text'
+done cd $(pwd) echo -eu awk test echo awk && ${HOME} printf
+cd x=1 cd readonly export grep | "$1" "$1" export ${HOME} echo test $(pwd) export
+	done export cd export 2>/dev/null then then local
+	&& /usr/bin "$@" 2>/dev/null ${HOME} 'quoted text' ${HOME} printf &&
+	--verbose "$1" x=1 | sed readonly echo sed /usr/bin
+		x=1 'quoted text' then $(pwd)
+		test awk test && cd $(pwd) export 'quoted text' $(pwd)
+	awk cd /usr/bin --verbose "$@" local
+cd echo --verbose | test 2>/dev/null
+		"$1" && done "$@" $(pwd) "$@" -eu $(pwd) readonly
+		test 'quoted text' x=1 && local --verbose
+		local then 'quoted text' x=1 then
+"$1" --verbose | then awk
+	${HOME} done then printf ${HOME} sed done && then grep $(pwd) cd && --verbose awk
+		export "$1" x=1 2>/dev/null /usr/bin
+		grep export x=1 export && cd local
+	printf awk done $(pwd) then "$1" echo -eu cd test x=1
+/usr/bin cd awk cd --verbose 2>/dev/null ${HOME}
+		sed 'quoted text' --verbose echo $(pwd) /usr/bin
+		2>/dev/null | readonly cd --verbose sed
+		cd /usr/bin awk "$@" grep 2>/dev/null "$@" test local
+2>/dev/null ${HOME} ${HOME} cd ${HOME} ${HOME} grep
+readonly local test sed 'quoted text' awk grep cd local |
+"$@" -eu $(pwd) then | grep test export
+cd "$1" sed ${HOME} -eu 2>/dev/null cd -eu ${HOME} printf $(pwd) 2>/dev/null
+	sed grep echo readonly | readonly && -eu && sed grep printf readonly && readonly
+	done grep echo ${HOME} printf done ${HOME} 'quoted text' then -eu printf
+		2>/dev/null 'quoted text'
+	awk done test "$1" 'quoted text' 'quoted text' | "$1" awk && --verbose
+		/usr/bin ${HOME} done grep done readonly readonly cd "$@" awk $(pwd)
+	printf | local && --verbose
+	x=1 awk 'quoted text'
+		test awk x=1 cd /usr/bin done grep $(pwd) /usr/bin
+	test echo $(pwd) -eu test printf test test | ${HOME} sed cd
+	grep echo "$@" && --verbose
+echo then x=1 export "$1" grep "$1" then grep
+		export then readonly done then
+		/usr/bin | echo sed grep done
+	"$1" --verbose "$@" x=1 | -eu test
+	cd awk | done && local "$1" local
+		printf done export test done --verbose test 2>/dev/null -eu awk
+		local "$@" done grep | /usr/bin 'quoted text'
+	--verbose then printf readonly
+	/usr/bin ${HOME} export 2>/dev/null "$@" local echo grep ${HOME}
+		2>/dev/null local x=1 /usr/bin cd sed cd 'quoted text'
+		2>/dev/null "$@" /usr/bin && /usr/bin x=1 test
+&& echo sed --verbose x=1 awk x=1 printf awk --verbose grep
+	-eu test $(pwd) printf then | --verbose printf "$1" test && test grep 'quoted text'
+readonly 'quoted text' cd "$1" readonly "$1" readonly
+	"$@" ${HOME} local x=1 "$@" then awk local ${HOME}
+		local grep export printf export "$@" printf | 'quoted text'
+	done --verbose /usr/bin "$1" grep
+	| /usr/bin cd 2>/dev/null
+		| export $(pwd) awk readonly -eu
+		$(pwd) x=1 && && cd 2>/dev/null export done /usr/bin export $(pwd) sed 2>/dev/null
+		echo then 'quoted text' echo | sed cd && awk -eu grep printf $(pwd) 2>/dev/null
+	done readonly sed | readonly export done test then printf echo
+		$(pwd) -eu done done grep | "$1" | readonly test export export then ${HOME} -eu
+${HOME} export /usr/bin | 'quoted text' x=1 awk readonly cd 'quoted text'
+"$1" ${HOME} && awk 2>/dev/null local
+	done then readonly done
+"$1" echo && done grep test local
+		done echo local 2>/dev/null
+	echo 2>/dev/null /usr/bin readonly && /usr/bin
+printf ${HOME} | echo && 'quoted text'
+		| 2>/dev/null then $(pwd) cd "$1" local $(pwd) "$@" done
+&& export done then 'quoted text'
+		"$@" then printf awk sed "$@"
+	then sed readonly echo && then awk awk readonly
+		"$@" "$@" sed local && test "$1" sed awk 2>/dev/null echo -eu test 'quoted text'
+		"$1" readonly echo grep
+		x=1 "$@" $(pwd) grep "$@" sed
+		test sed ${HOME} echo echo export ${HOME} export x=1
+	&& then $(pwd) $(pwd) echo && "$@" --verbose -eu
+test printf export "$1" "$1" "$1" cd "$@" -eu done --verbose grep && | cd 2>/dev/null
+		readonly printf x=1 "$1" awk grep "$1" 'quoted text' ${HOME} then | | |
+		${HOME} && echo --verbose
+"$1" /usr/bin echo "$1" cd 2>/dev/null
+		printf test export cd local sed && awk cd
+		${HOME} "$1" readonly printf "$@" echo done test printf done
+export && then -eu local ${HOME}
+	local /usr/bin sed 'quoted text' "$@"
+-eu sed echo grep sed 'quoted text' --verbose
+"$@" printf readonly "$@" $(pwd) export local then --verbose cd grep local /usr/bin
+		/usr/bin x=1 2>/dev/null export done export
+		x=1 $(pwd) echo local 2>/dev/null
+		export cd echo local /usr/bin echo sed 2>/dev/null x=1 | done done
+		sed "$1" export x=1 ${HOME} printf | -eu x=1 2>/dev/null
+		local export | done -eu 2>/dev/null
+--verbose $(pwd) readonly 2>/dev/null export readonly readonly "$@" x=1 && 2>/dev/null
+	readonly $(pwd) 2>/dev/null then
+	sed --verbose sed x=1
+		cd done $(pwd) cd "$@" sed /usr/bin "$1" printf then
+		| --verbose 2>/dev/null cd awk --verbose export awk local local
+		local /usr/bin grep -eu 2>/dev/null done export
+--verbose && 'quoted text' 2>/dev/null cd | done "$1" echo cd awk done
+	"$1" $(pwd) local then --verbose then 2>/dev/null && printf
+	-eu local readonly "$1" "$1" 2>/dev/null export export then 'quoted text' "$1"
+cd then && export printf awk test --verbose printf | cd 2>/dev/null cd | 'quoted text'
+		2>/dev/null grep local ${HOME} grep echo 2>/dev/null sed
+	${HOME} done "$@" | --verbose ${HOME} 'quoted text' /usr/bin echo
+"$@" "$@" printf ${HOME} "$@"
+		${HOME} echo x=1 'quoted text' printf local | "$1" export grep x=1 ${HOME}
+	awk echo x=1 /usr/bin $(pwd) export "$@"
+	/usr/bin $(pwd) "$@" export 2>/dev/null
+		readonly "$1" awk done cd cd "$@" local "$1" readonly echo && |
+		2>/dev/null x=1 awk | done 'quoted text' 2>/dev/null
+		| done ${HOME} grep /usr/bin export | x=1 printf "$@" --verbose printf
+	/usr/bin "$@" --verbose --verbose grep grep test
+	&& && sed export 2>/dev/null readonly cd x=1 -eu 'quoted text'
+		test /usr/bin 2>/dev/null "$@" echo "$@" -eu readonly
+		"$@" echo grep /usr/bin awk sed readonly | 'quoted text'
+	awk sed local sed $(pwd) && sed test
+		readonly sed --verbose printf && "$1" --verbose | printf 'quoted text' test "$@"
+	export cd local done local
+		/usr/bin test 'quoted text' "$1" sed
+		--verbose export export 2>/dev/null
+		done 'quoted text' | printf "$1" cd awk 'quoted text'
+$(pwd) local awk cd "$1" export | export && local export
+then echo cd printf --verbose
+	awk local then $(pwd) x=1
+done done && 2>/dev/null x=1 done "$@" ${HOME} 2>/dev/null
+		awk 2>/dev/null readonly --verbose export --verbose
+	2>/dev/null echo local test awk ${HOME}
+test then ${HOME} $(pwd) done 'quoted text'
+		${HOME} /usr/bin then export readonly x=1
+	"$1" then x=1 grep cd readonly printf printf
+		x=1 then 2>/dev/null grep /usr/bin then $(pwd) | local printf grep
+	"$1" $(pwd) 'quoted text' echo 2>/dev/null "$1" grep echo
+	then && sed cd sed grep printf $(pwd) 2>/dev/null
+	grep done 2>/dev/null $(pwd) export 'quoted text' && "$@" grep x=1 readonly
+${HOME} export "$@" && "$@" $(pwd)
+"$1" grep $(pwd) echo awk
+		$(pwd) export /usr/bin $(pwd) "$@" printf
+grep "$@" | printf | test local && 2>/dev/null export | export printf 'quoted text'
+-eu printf echo cd done /usr/bin && readonly awk readonly | "$1"
+'quoted text' sed test --verbose x=1 done then export && --verbose
+		"$1" | "$@" --verbose /usr/bin --verbose echo "$1" done -eu awk 2>/dev/null
+"$1" && cd sed test grep echo ${HOME} cd sed x=1 --verbose ${HOME}
+		awk $(pwd) && awk then sed && export $(pwd) && readonly
+cd ${HOME} cd $(pwd) grep readonly --verbose
+		2>/dev/null -eu awk "$@" &&
+		awk awk "$@" export 2>/dev/null 2>/dev/null "$@" ${HOME} 'quoted text'
+		awk grep $(pwd) sed readonly cd cd "$1" grep awk && sed 'quoted text'
+	'quoted text' then then
+	local ${HOME} awk printf && -eu test cd echo --verbose
+	--verbose | sed local && -eu "$1" -eu x=1 export 'quoted text'
+"$1" "$@" test done cd
+&& 2>/dev/null readonly test x=1 --verbose test local
+		printf grep /usr/bin 'quoted text'
+		&& $(pwd) sed cd sed echo readonly
+	echo 'quoted text' then $(pwd) $(pwd) readonly /usr/bin -eu
+	--verbose export 'quoted text' ${HOME} printf x=1 sed cd sed sed sed
+	done ${HOME} test && awk --verbose -eu "$1"
+		export -eu then echo printf test -eu /usr/bin test local | /usr/bin $(pwd) &&
+		"$1" $(pwd) then 'quoted text'
+	local readonly "$1" 2>/dev/null --verbose
+cd && then --verbose 2>/dev/null
+${HOME} ${HOME} readonly ${HOME} x=1 "$1" "$1" --verbose then then
+		--verbose local "$1" then sed | --verbose
+grep "$@" local readonly | x=1 sed sed export ${HOME} sed ${HOME}
+$(pwd) printf "$@" x=1 /usr/bin "$@" sed 'quoted text' printf printf
+	${HOME} cd cd "$@" test test 'quoted text' echo grep ${HOME} 'quoted text'
+	"$@" "$@" awk /usr/bin $(pwd) awk echo then
+		${HOME} --verbose "$@" x=1 grep "$@" $(pwd)
+then test local cd 2>/dev/null x=1 ${HOME}
+echo done --verbose ${HOME} $(pwd) --verbose local
+	done cd && echo ${HOME} grep
+		awk $(pwd) grep 'quoted text' export then x=1 done sed $(pwd)
+	test then "$@" export && printf "$@" readonly ${HOME} $(pwd) grep
+$(pwd) cd export ${HOME} echo | "$@" then ${HOME} --verbose ${HOME}
+--verbose grep awk | /usr/bin test x=1 local
+		x=1 then printf readonly readonly
+		cd 'quoted text' done && printf "$1" done x=1 local -eu echo
+		$(pwd) printf $(pwd) /usr/bin /usr/bin 2>/dev/null | -eu "$@" && export
+--verbose && 'quoted text' "$@" export 'quoted text'
+	&& 2>/dev/null grep local "$@" cd printf printf sed awk $(pwd) --verbose
+		"$@" ${HOME} readonly local --verbose /usr/bin | awk done | | "$1" --verbose x=1
+	grep echo 'quoted text' export
+	/usr/bin done | ${HOME} readonly local local then sed then "$@" then -eu "$@" sed
+	local 'quoted text' $(pwd) ${HOME} sed x=1 sed local export -eu x=1
+		grep | cd -eu 2>/dev/null | readonly $(pwd) 2>/dev/null
+	printf -eu --verbose /usr/bin then 'quoted text' --verbose echo
+	readonly echo --verbose | --verbose printf echo 2>/dev/null local
+	2>/dev/null $(pwd) ${HOME}
+		readonly | x=1 done sed -eu && | sed /usr/bin 'quoted text'
+	printf "$1" awk cd "$@" $(pwd) sed local readonly
+	local printf done x=1 /usr/bin "$@" awk then /usr/bin sed done test local &&
+		&& | /usr/bin 2>/dev/null grep "$@" && local ${HOME} "$@" done test
+		/usr/bin $(pwd) cd export $(pwd) /usr/bin "$@" -eu -eu echo readonly
+		$(pwd) then grep $(pwd) && echo done cd cd ${HOME} local
+	printf "$1" local awk sed --verbose
+	"$@" readonly ${HOME}
+echo --verbose export done "$1" 'quoted text'
+then echo "$@" --verbose "$@" 2>/dev/null readonly --verbose sed -eu
+		${HOME} echo --verbose "$@"
+$(pwd) ${HOME} grep printf done then "$1" --verbose
+2>/dev/null ${HOME} && ${HOME} printf
+		printf grep /usr/bin "$1" done | grep grep $(pwd) $(pwd)
+		awk 'quoted text' printf x=1 sed -eu export "$@" then -eu
+		/usr/bin done ${HOME} | -eu | "$@" echo -eu "$1" echo export x=1 "$@" 2>/dev/null
+		local -eu then --verbose test awk
+2>/dev/null x=1 local cd readonly test cd /usr/bin --verbose local --verbose /usr/bin
+		local 2>/dev/null "$@" -eu export /usr/bin -eu printf echo export
+readonly x=1 grep --verbose grep grep 2>/dev/null done 'quoted text'
+	/usr/bin /usr/bin readonly readonly awk awk /usr/bin echo done sed then
+"$1" "$1" --verbose awk sed 'quoted text' /usr/bin echo 'quoted text'
+		printf | export -eu readonly
+		export printf readonly readonly 'quoted text' local done $(pwd) test && | "$@"
+	printf test printf sed echo 2>/dev/null readonly "$@" |
+done --verbose /usr/bin test && "$@" $(pwd) awk "$1"
+export x=1 "$@" sed export $(pwd)
+	"$1" "$1" test then done
+	grep && cd grep awk local test
+	/usr/bin then --verbose test readonly
+cd /usr/bin | done | $(pwd) export "$1"
+	&& test sed sed 2>/dev/null
+	${HOME} echo test "$@" 'quoted text' readonly -eu local done
+	| 2>/dev/null echo echo awk
+	readonly printf cd grep cd "$1" 'quoted text'
+		x=1 -eu done then $(pwd) ${HOME} local 'quoted text' then
+"$1" --verbose done echo --verbose 2>/dev/null --verbose grep sed sed 'quoted text'
+		grep /usr/bin then export local awk then "$1"
+		echo readonly /usr/bin grep cd local "$@"
+export /usr/bin export x=1 local then 'quoted text' --verbose cd readonly
+awk done done 'quoted text' --verbose awk | awk ${HOME} echo echo test |
+	export grep ${HOME} sed
+done ${HOME} grep && x=1 ${HOME} x=1 awk export done --verbose ${HOME} grep
+cd -eu /usr/bin ${HOME} x=1 'quoted text'
+		$(pwd) local "$1" awk echo printf && test local $(pwd) test echo awk 'quoted text'
+		then done readonly && x=1 awk 'quoted text' local readonly "$1"
+		echo --verbose done grep 'quoted text' printf "$1"
+	2>/dev/null readonly --verbose readonly local && 'quoted text'
+		-eu x=1 $(pwd) export ${HOME} -eu test 2>/dev/null
+		echo readonly "$1" grep cd
+	&& && && --verbose export ${HOME}
+		"$@" $(pwd) /usr/bin "$1" -eu then 2>/dev/null sed
+$(pwd) /usr/bin sed printf cd
+		echo done echo grep -eu ${HOME} done ${HOME}
+echo sed awk sed x=1 awk test then | export echo test ${HOME} -eu /usr/bin
+"$1" then "$1" then "$@" && echo --verbose awk export export sed
+		local sed 'quoted text' export ${HOME} | x=1 then $(pwd)
+	printf echo cd printf --verbose done 2>/dev/null printf ${HOME} printf
+	done 'quoted text' awk && --verbose printf export x=1 grep printf
+	cd "$1" grep -eu 2>/dev/null && $(pwd)
+	x=1 --verbose cd ${HOME} 'quoted text'
+	-eu x=1 "$@" && awk cd "$1" awk test readonly cd sed --verbose echo
+	grep /usr/bin | readonly "$@" sed printf x=1 grep x=1 "$@"
+		-eu sed grep 2>/dev/null export then /usr/bin
+	x=1 && printf local sed 2>/dev/null
+'quoted text' /usr/bin -eu done readonly grep grep 2>/dev/null
+	x=1 cd readonly x=1 && /usr/bin ${HOME} awk then test && export
+grep --verbose readonly /usr/bin && export
+	test -eu cd sed | cd local test x=1 done "$1" done 2>/dev/null
+		echo -eu | awk $(pwd) sed export
+		$(pwd) grep printf cd $(pwd) sed x=1 | test -eu echo $(pwd) /usr/bin
+		export sed test local sed "$@" 'quoted text'
+sed && readonly -eu readonly 'quoted text'
+	x=1 awk grep | -eu then printf test export --verbose /usr/bin 'quoted text'
+	${HOME} export local 2>/dev/null readonly
+	$(pwd) ${HOME} -eu export then awk echo x=1 --verbose done grep x=1
+echo x=1 cd | /usr/bin sed grep
+		awk readonly ${HOME} /usr/bin
+		| 'quoted text' export $(pwd) x=1 readonly
+		"$@" /usr/bin /usr/bin /usr/bin
+		&& printf local sed "$@" x=1 | then 'quoted text'
+		${HOME} export cd then echo | awk awk && sed printf
+	grep /usr/bin awk "$@" echo export /usr/bin readonly
+grep | grep export | "$1" echo x=1 x=1 ${HOME} "$@" local
+/usr/bin ${HOME} done "$1" x=1 "$1" local x=1 grep "$1" "$1" local "$@" /usr/bin
+		done echo /usr/bin printf sed $(pwd) 2>/dev/null echo awk echo local | readonly
+cd 'quoted text' awk echo 'quoted text' | sed ${HOME} test | readonly $(pwd)
+		export "$@" printf && test --verbose
+	/usr/bin export -eu | sed "$1" cd | -eu sed local
+	'quoted text' then x=1 /usr/bin cd echo --verbose export /usr/bin
+	echo then test --verbose $(pwd) readonly /usr/bin
+	$(pwd) /usr/bin done 'quoted text' export sed 'quoted text'
+		printf awk | grep $(pwd) /usr/bin
+	echo sed x=1 sed /usr/bin --verbose sed x=1 awk ${HOME} /usr/bin "$1" local
+	grep then sed x=1 /usr/bin printf printf grep --verbose $(pwd) done
+		&& $(pwd) x=1 --verbose --verbose $(pwd) && /usr/bin awk $(pwd) $(pwd)
+		$(pwd) test "$1" | grep echo
+		x=1 cd awk 'quoted text' | "$1" printf /usr/bin
+		x=1 readonly ${HOME}
+sed $(pwd) && && cd -eu readonly local cd done grep --verbose $(pwd) --verbose
+readonly grep done sed export
+'quoted text' done /usr/bin "$@" ${HOME} "$@" && x=1 2>/dev/null
+		printf echo && printf x=1 local grep "$@" awk $(pwd) readonly grep && && "$@" "$1"
+grep export cd "$@" 2>/dev/null /usr/bin test echo $(pwd) ${HOME}
+	| -eu "$@" awk cd printf
+	"$1" /usr/bin local -eu sed cd grep /usr/bin 2>/dev/null done && | x=1 "$1" done
+	cd --verbose "$@" awk awk 2>/dev/null "$@" ${HOME} 2>/dev/null
+	cd grep "$1" 'quoted text'
+/usr/bin -eu /usr/bin sed test x=1 && sed test 2>/dev/null done --verbose
+		'quoted text' export local then export /usr/bin
+	| "$@" x=1 2>/dev/null && echo cd readonly --verbose echo "$1" && awk x=1 "$@"
+		awk export local 'quoted text' -eu sed grep ${HOME} awk -eu ${HOME}
+		"$@" ${HOME} export 'quoted text'
+grep awk --verbose local readonly
+		${HOME} printf done ${HOME} x=1 'quoted text'
+readonly "$@" done --verbose export "$1" export
+	| "$1" && "$1" /usr/bin ${HOME} echo && sed
+awk "$1" readonly printf
+	export grep then && export local ${HOME}
+	printf then && "$@" "$@" -eu local x=1 /usr/bin 2>/dev/null
+"$1" 2>/dev/null test 2>/dev/null && && test $(pwd) &&
+		printf export test echo $(pwd) readonly 2>/dev/null readonly 2>/dev/null
+	"$1" then $(pwd) awk then
+/usr/bin grep sed "$@" $(pwd) sed then then | done test --verbose
+x=1 ${HOME} sed printf echo 2>/dev/null --verbose "$1" ${HOME} /usr/bin
+	"$@" && ${HOME} x=1 test && sed "$@" local
+grep echo then "$@" echo ${HOME} ${HOME}
+test -eu 'quoted text' 'quoted text' printf export "$1" printf
+		2>/dev/null then sed grep "$1" then sed
+/usr/bin | local cd done | && then echo x=1 echo "$1"
+	-eu awk /usr/bin --verbose 'quoted text'
+		-eu sed sed grep export export sed export "$1"
+		awk then ${HOME} test test test awk awk 2>/dev/null test sed 2>/dev/null
+sed x=1 | export /usr/bin x=1
+cd test readonly /usr/bin "$1" 2>/dev/null
+	done 'quoted text' -eu -eu sed export -eu sed done export $(pwd)
+	grep 'quoted text' | /usr/bin "$@" 'quoted text' -eu /usr/bin echo
+'quoted text' "$1" "$@" && cd printf
+		| ${HOME} test grep export
+	cd test -eu cd 2>/dev/null test echo $(pwd) echo 2>/dev/null
+		grep export 'quoted text' readonly
+	x=1 done readonly $(pwd) x=1 -eu "$1" awk sed | "$1" | "$1" echo -eu done
+		printf printf cd awk printf awk readonly cd && awk grep && cd then local
+	"$@" export "$@" x=1 | "$@" "$@" awk $(pwd) grep
+		readonly --verbose /usr/bin export x=1 local
+		$(pwd) ${HOME} done awk printf -eu grep 'quoted text' then
+	export && sed | --verbose readonly --verbose && "$1" /usr/bin 'quoted text'
+		--verbose done awk grep local echo | x=1 done --verbose
+	export done 2>/dev/null ${HOME} | "$@" done
+	x=1 sed readonly /usr/bin awk export awk /usr/bin
+	${HOME} "$1" test /usr/bin && test 'quoted text' 2>/dev/null readonly test /usr/bin
+		x=1 ${HOME} -eu "$1" --verbose && --verbose
+	'quoted text' then awk --verbose cd ${HOME} "$1" "$@" "$1" then
+then && printf printf x=1 readonly printf /usr/bin 2>/dev/null
+		&& 'quoted text' "$@" --verbose printf printf --verbose sed done
+&& test && cd -eu 2>/dev/null x=1 2>/dev/null
+	export 'quoted text' local /usr/bin grep x=1 export "$1" cd && ${HOME}
+		/usr/bin echo cd | /usr/bin test printf echo test 'quoted text'
+	export "$@" "$@" readonly then readonly /usr/bin 'quoted text' sed 2>/dev/null
+		printf done test 'quoted text' test
+'quoted text' awk && | local ${HOME} ${HOME} cd readonly ${HOME} ${HOME}
+		-eu cd done then "$1" /usr/bin printf cd 'quoted text'
+	x=1 "$@" readonly cd printf | echo then export then | done
+	awk test echo then /usr/bin
+		/usr/bin readonly | --verbose /usr/bin echo local
+--verbose | test local readonly
+		readonly printf $(pwd) x=1 /usr/bin awk then echo
+		sed --verbose test grep "$@" "$@" && ${HOME} awk 'quoted text'
+	${HOME} 2>/dev/null grep | cd &&
+	--verbose $(pwd) | readonly then 'quoted text'
+		then /usr/bin | export 'quoted text'
+	done ${HOME} "$@" echo && ${HOME} $(pwd) "$@"
+${HOME} export ${HOME} cd local readonly --verbose 2>/dev/null test grep "$@" then
+sed 'quoted text' readonly ${HOME} readonly "$1" ${HOME} 'quoted text'
+		2>/dev/null export "$1" /usr/bin export readonly done
+		| readonly sed /usr/bin "$1" local --verbose 2>/dev/null 2>/dev/null ${HOME}
+		"$@" readonly awk local grep 2>/dev/null
+	done export local --verbose
+		-eu "$1" cd | 'quoted text' awk
+"$@" done test test cd -eu x=1 -eu $(pwd) sed "$1" x=1 | awk then /usr/bin
+		awk readonly --verbose "$@" sed /usr/bin 2>/dev/null
+2>/dev/null local awk readonly "$@" grep $(pwd)
+	2>/dev/null /usr/bin --verbose && echo printf grep "$@"
+		| 2>/dev/null export then
+	grep -eu echo x=1 "$@" 'quoted text' export then then echo
+		$(pwd) then --verbose then ${HOME} "$@" echo 'quoted text'
+	readonly "$@" sed done | | ${HOME} cd done awk | awk printf "$@"
+awk /usr/bin sed local done $(pwd) --verbose export
+		grep "$@" done readonly readonly | done export done sed readonly
+		export printf awk -eu
+'quoted text' echo --verbose cd 'quoted text' /usr/bin
+readonly "$1" then --verbose | --verbose
+	done done then done --verbose
+	then done 'quoted text' "$1" -eu "$1" | sed && "$1"
+readonly test ${HOME} grep printf readonly $(pwd) echo then 'quoted text'
+	sed then readonly 'quoted text' -eu awk
+		readonly ${HOME} export $(pwd) test printf test then export 'quoted text'
+awk echo test grep x=1 | awk
+	"$1" "$@" ${HOME} -eu --verbose && sed readonly grep readonly -eu done grep
+		test 'quoted text' ${HOME} -eu /usr/bin readonly then export
+		--verbose 'quoted text' $(pwd) "$1" awk 'quoted text' test cd $(pwd) echo
+		readonly 2>/dev/null done --verbose x=1 readonly
+		$(pwd) /usr/bin echo echo 'quoted text' 2>/dev/null
+	"$1" cd $(pwd) /usr/bin ${HOME} sed /usr/bin $(pwd) test printf sed
+	sed -eu 'quoted text' readonly printf x=1 ${HOME} done local 'quoted text'
+readonly done 'quoted text' "$1" && | awk printf "$@" ${HOME} --verbose
+	export ${HOME} then awk test readonly && && |
+-eu grep "$@" "$1" awk then done printf -eu cd /usr/bin done test -eu
+		'quoted text' sed --verbose 'quoted text' x=1 grep | grep printf test awk
+	printf 2>/dev/null export $(pwd) test done 'quoted text'
+awk readonly local $(pwd) local $(pwd) $(pwd) /usr/bin 2>/dev/null sed 'quoted text'
+	| done --verbose done /usr/bin local
+	done sed && --verbose 2>/dev/null export x=1 done sed
+	${HOME} local echo grep ${HOME}
+	then $(pwd) awk 2>/dev/null
+		export printf "$1" sed grep && sed x=1 then sed local
+	awk | ${HOME} | ${HOME} sed 'quoted text' /usr/bin "$1"
+		test printf awk cd echo x=1 x=1 export "$@"
+		sed then sed cd | 'quoted text' then then ${HOME} -eu x=1 printf readonly
+		local export grep && "$1" $(pwd) grep "$@" awk -eu export export x=1 awk
+printf "$1" printf "$1" "$1" --verbose /usr/bin
+done readonly "$1" readonly x=1 grep --verbose -eu echo export /usr/bin local
+		x=1 then printf 'quoted text' then grep export done 'quoted text' done
+	test ${HOME} 'quoted text' readonly
+		grep x=1 cd local export local export $(pwd) then export -eu
+readonly sed $(pwd) grep then "$@" export | 2>/dev/null test ${HOME} $(pwd) --verbose
+		$(pwd) -eu ${HOME} local sed echo
+		echo printf export sed
+		done done "$@" $(pwd) "$@" --verbose readonly |
+		cd /usr/bin cd | /usr/bin | local | cd -eu 2>/dev/null cd
+		cd "$1" local x=1 'quoted text' -eu $(pwd) "$@" | x=1 printf
+	sed "$@" -eu 2>/dev/null x=1 echo done
+done cd test test cd grep sed test then grep sed done /usr/bin ${HOME}
+local done printf printf x=1 cd 'quoted text' 'quoted text'
+awk test awk /usr/bin awk grep 2>/dev/null "$1" test done test
+	done grep | local printf cd "$1" -eu local
+	-eu then done $(pwd) /usr/bin
+		printf && readonly done then grep printf
+		${HOME} awk x=1 -eu 2>/dev/null done | sed x=1 "$1" export sed export "$@" $(pwd)
+	"$@" 2>/dev/null local ${HOME} then /usr/bin echo x=1 2>/dev/null
+done "$1" done -eu -eu x=1 export
+		readonly -eu -eu 2>/dev/null cd export grep $(pwd) done done local echo "$@" awk
+'quoted text' echo printf
+local x=1 'quoted text' local "$1" 'quoted text'
+-eu 'quoted text' $(pwd) /usr/bin readonly
+	cd /usr/bin printf "$@" x=1 'quoted text' sed done /usr/bin
+export && local /usr/bin export awk -eu "$1" sed cd "$@" && -eu sed cd
+	then "$1" && "$1" test "$@" x=1 "$1" ${HOME} 'quoted text' then test x=1 sed
+local -eu /usr/bin /usr/bin 2>/dev/null export /usr/bin grep x=1
+	local sed --verbose export cd
+		${HOME} --verbose sed ${HOME} then --verbose
+	local 'quoted text' ${HOME} | "$@" && test 'quoted text'
+		| printf test "$@" local test /usr/bin test x=1 done "$1" --verbose 2>/dev/null
+-eu ${HOME} $(pwd) && echo "$@" readonly $(pwd) printf sed --verbose
+	then && -eu ${HOME} then cd "$@" cd 2>/dev/null 'quoted text'
+-eu sed | 2>/dev/null /usr/bin echo grep echo /usr/bin x=1
+		readonly x=1 "$1" $(pwd) grep readonly
+		| cd awk readonly then readonly
+	| | grep readonly "$1" grep cd && local local export | && cd 'quoted text'
+	echo grep grep "$@" grep && sed "$1" sed 'quoted text' 2>/dev/null
+		readonly 2>/dev/null then && 'quoted text' readonly $(pwd) 2>/dev/null
+"$1" 2>/dev/null readonly cd --verbose x=1 sed x=1
+${HOME} 2>/dev/null local printf done 'quoted text'
+		cd done sed then sed done | -eu
+		-eu local ${HOME} /usr/bin awk 2>/dev/null
+readonly grep "$@" && export $(pwd) then test "$@" 2>/dev/null ${HOME}
+done then export 2>/dev/null | done cd export sed local
+done printf awk export | local awk x=1 ${HOME}
+		echo $(pwd) "$1" done grep 'quoted text' done
+		--verbose then "$@" echo --verbose | grep ${HOME} then readonly
+export && --verbose local "$1" sed printf echo ${HOME} export sed
+		&& grep readonly cd grep export | ${HOME} readonly then && 'quoted text'
+	${HOME} cd | echo "$@" awk grep then export then
+		${HOME} cd /usr/bin echo | $(pwd) sed printf 'quoted text'
+done x=1 echo local done
+	| echo "$@" -eu /usr/bin cd printf $(pwd) printf "$1" -eu "$@" "$@" "$1" export
+		${HOME} "$@" printf test ${HOME} grep grep then sed
+		grep cd -eu cd then $(pwd) | --verbose "$1" readonly | done test then 2>/dev/null
+'quoted text' local test -eu --verbose && readonly
+	--verbose | echo | | readonly "$@" grep done then test | --verbose
+		export sed $(pwd) "$1" "$@" printf echo
+export x=1 echo echo /usr/bin /usr/bin readonly
+local && "$@" then && $(pwd) done | readonly -eu local readonly | 'quoted text'
+	grep x=1 test grep awk printf echo $(pwd) test /usr/bin awk local -eu $(pwd) ${HOME}
+	grep then export && grep "$@" "$@" local done /usr/bin local printf
+readonly test $(pwd) cd "$1" export echo /usr/bin --verbose
+		--verbose grep test $(pwd) && 'quoted text' "$@" $(pwd) /usr/bin
+		x=1 $(pwd) 2>/dev/null
+		cd /usr/bin -eu export /usr/bin --verbose readonly $(pwd) done /usr/bin readonly
+	&& && export local local echo done $(pwd) echo "$@" -eu 'quoted text' -eu
+| "$@" ${HOME} test "$@" "$1" grep ${HOME} -eu local
+	local 'quoted text' test awk awk 2>/dev/null -eu awk ${HOME}
+	cd /usr/bin "$1" --verbose sed done 'quoted text' && && 2>/dev/null
+	${HOME} test sed readonly grep printf then
+	done sed grep then done "$1" cd ${HOME} done "$1" done
+x=1 "$@" echo test readonly grep
+done ${HOME} sed 2>/dev/null printf -eu x=1
+grep -eu --verbose awk test -eu local echo "$1"
+2>/dev/null $(pwd) local "$@" echo "$1" && cd 2>/dev/null
+test local x=1 ${HOME} export 2>/dev/null sed x=1 sed x=1 "$1" readonly
+		$(pwd) cd export 2>/dev/null
+	printf "$1" /usr/bin "$1" --verbose | printf local
+	awk --verbose readonly readonly echo | "$1" cd ${HOME} readonly
+		local local awk -eu sed "$@" | sed -eu 'quoted text' /usr/bin
+		local cd -eu awk /usr/bin printf --verbose printf printf test /usr/bin printf
+	&& test ${HOME} export cd printf "$@" /usr/bin awk test "$@" echo ${HOME}
+		/usr/bin done then export sed 2>/dev/null $(pwd) local printf
+	x=1 printf -eu export export readonly
+	"$@" printf x=1 ${HOME}
+test && printf "$1" echo 2>/dev/null
+	"$1" readonly ${HOME} 2>/dev/null
+echo && readonly | $(pwd) --verbose local echo 'quoted text' awk export && 'quoted text'
+	readonly -eu -eu awk done "$1" done done cd printf test 2>/dev/null
+	printf x=1 awk local && readonly 'quoted text' $(pwd) "$@" 'quoted text'
+	$(pwd) test x=1 "$1" --verbose awk grep x=1 "$@" local /usr/bin cd local sed
+x=1 grep /usr/bin done sed --verbose grep ${HOME} printf
+&& && local $(pwd) $(pwd) done "$@" | sed "$@" printf printf 2>/dev/null
+echo export grep test "$@" 2>/dev/null 2>/dev/null "$@" local awk grep $(pwd)
+	sed done x=1 | grep x=1 "$1" done $(pwd) awk $(pwd) readonly
+		grep printf --verbose -eu "$1" --verbose local printf then export
+$(pwd) ${HOME} test echo ${HOME}
+echo | cd /usr/bin --verbose "$1" done sed printf export
+		/usr/bin --verbose local "$1" cd $(pwd) "$@" -eu cd printf
+	then export | printf /usr/bin | ${HOME}
+		grep && readonly done $(pwd) && x=1 | sed 'quoted text' -eu cd then $(pwd)
+	${HOME} then x=1 'quoted text' done
+	grep x=1 "$1" | done /usr/bin x=1 ${HOME} echo
+&& 'quoted text' x=1 local then export ${HOME} sed readonly | 2>/dev/null
+then echo x=1 && echo --verbose readonly local /usr/bin && 2>/dev/null
+done "$@" "$@" echo -eu printf -eu cd export export
+--verbose ${HOME} done printf $(pwd) local
+		/usr/bin /usr/bin sed cd ${HOME} grep printf done -eu $(pwd)
+		export -eu --verbose | export $(pwd) $(pwd) sed | --verbose
+	/usr/bin | --verbose "$1" printf "$@" x=1
+		readonly echo --verbose 'quoted text' $(pwd) echo 'quoted text' "$@" x=1
+"$1" ${HOME} cd sed x=1 /usr/bin && "$1" "$1" readonly
+	&& awk awk awk x=1 | grep ${HOME} test printf /usr/bin
+local grep test && then printf readonly "$@" readonly ${HOME} 2>/dev/null sed --verbose
+		readonly --verbose grep 2>/dev/null done "$@" "$1" ${HOME} done "$1" --verbose
+	-eu -eu printf echo && 'quoted text' echo "$1" export $(pwd) && grep
+	| grep then ${HOME} done ${HOME} ${HOME} grep echo export
+		readonly 2>/dev/null -eu awk sed cd --verbose
+		grep -eu done test --verbose test x=1 /usr/bin done
+		cd x=1 readonly cd grep export --verbose ${HOME} "$@" echo
+"$1" $(pwd) sed x=1 export -eu -eu cd echo $(pwd)
+		awk awk readonly then 2>/dev/null $(pwd) grep "$1" "$1" sed then cd cd 'quoted text'
+		grep readonly awk --verbose echo "$1" sed $(pwd) 2>/dev/null -eu && then
+		"$1" ${HOME} x=1 'quoted text' then
+		then done ${HOME} test -eu grep x=1 grep grep 'quoted text' local 'quoted text'
+-eu /usr/bin ${HOME} echo cd echo --verbose | then done awk grep printf
+		2>/dev/null printf awk readonly local | grep grep export test grep
+		--verbose -eu "$@" -eu | grep test
+	echo echo | export sed sed grep echo $(pwd) /usr/bin done local cd
+		grep awk sed --verbose && 'quoted text' echo "$@" 2>/dev/null && "$@"
+	'quoted text' -eu grep /usr/bin test
+"$1" local cd -eu /usr/bin | /usr/bin 'quoted text'
+		x=1 'quoted text' | /usr/bin test
+	/usr/bin -eu awk echo awk readonly
+awk printf -eu grep --verbose readonly printf --verbose /usr/bin ${HOME} /usr/bin
+	test export /usr/bin | && echo readonly ${HOME} grep echo
+	"$@" export ${HOME} ${HOME}
+	echo ${HOME} printf sed 'quoted text'
+		readonly local | then export export $(pwd)
+	"$1" cd x=1 x=1 "$1" 2>/dev/null test "$@" done && && readonly printf
+		&& done -eu test "$@" "$1" then grep /usr/bin test $(pwd) x=1 then &&
+		"$1" --verbose printf echo test readonly $(pwd) printf --verbose
+'quoted text' sed then $(pwd) $(pwd) sed -eu sed 'quoted text' cd done 2>/dev/null
+	'quoted text' then awk && done done export printf done "$@"
+		cd printf done then 2>/dev/null cd readonly --verbose readonly echo | |
+	local grep 'quoted text' printf printf
+awk "$@" sed x=1 readonly grep /usr/bin | cd "$@" "$@" printf cd --verbose
+	'quoted text' readonly x=1 2>/dev/null /usr/bin then $(pwd)
+		'quoted text' 'quoted text' echo readonly
+--verbose "$1" | "$1"
+		sed "$1" done then 2>/dev/null test echo && awk 2>/dev/null
+'quoted text' done cd grep done -eu --verbose
+		cd && readonly -eu cd local 'quoted text' export x=1 2>/dev/null
+	'quoted text' cd then "$@" done
+		grep --verbose awk printf --verbose echo
+		-eu 2>/dev/null local awk /usr/bin
+| ${HOME} ${HOME} /usr/bin local export /usr/bin x=1 local 'quoted text'
+		export ${HOME} && printf export done | ${HOME} /usr/bin 'quoted text' $(pwd)
+	local /usr/bin x=1 x=1 readonly | awk /usr/bin --verbose echo x=1
+${HOME} && awk "$@" 'quoted text' x=1 export "$@" x=1 'quoted text' /usr/bin local
+test /usr/bin --verbose x=1 ${HOME} /usr/bin "$1" &&
+		then export $(pwd) awk $(pwd) local && "$@" printf -eu "$1"
+$(pwd) awk "$1" awk test --verbose export readonly grep "$@" 2>/dev/null cd
+	printf cd then 'quoted text' $(pwd) "$@" ${HOME} x=1 readonly
+	--verbose && | 'quoted text' export export printf echo "$1" --verbose -eu | 'quoted text'
+		readonly awk echo x=1 && 2>/dev/null awk done --verbose "$1" "$@" printf
+export cd awk grep | cd 2>/dev/null "$@" && && ${HOME}
+		| done sed cd export echo -eu test /usr/bin --verbose --verbose local 2>/dev/null
+&& -eu $(pwd) cd grep "$@" /usr/bin 'quoted text' grep --verbose done
+		echo printf readonly echo && done $(pwd) x=1 readonly | 'quoted text' local
+-eu x=1 cd ${HOME} cd $(pwd) ${HOME} local test done done readonly "$@" "$1" export
+		-eu then local awk --verbose grep printf $(pwd) ${HOME} readonly
+	"$1" | ${HOME} test test printf $(pwd) local 2>/dev/null &&
+		x=1 cd export readonly "$@" local sed 2>/dev/null
+	$(pwd) local /usr/bin test 'quoted text'
+printf local readonly sed sed grep x=1 $(pwd)
+		then x=1 'quoted text' then 'quoted text' ${HOME} sed
+done sed $(pwd) -eu then then done 'quoted text' 2>/dev/null grep readonly
+${HOME} "$1" then "$@" "$@" 2>/dev/null export 2>/dev/null echo -eu
+		cd cd cd ${HOME} /usr/bin grep export && 2>/dev/null "$@" 'quoted text'
+		local sed x=1 grep $(pwd) awk printf done -eu export readonly export | -eu x=1
+| $(pwd) done 'quoted text' echo then ${HOME} done then
+	/usr/bin && cd cd | then local printf 'quoted text' ${HOME} done /usr/bin /usr/bin
+-eu awk /usr/bin readonly
+		"$1" printf x=1 "$@" sed /usr/bin test
+/usr/bin sed /usr/bin 2>/dev/null /usr/bin ${HOME} echo local export $(pwd) done
+		export 2>/dev/null $(pwd) 'quoted text'
+	/usr/bin | printf cd awk awk
+"$1" cd printf x=1 --verbose "$1" then local echo
+-eu --verbose -eu "$@" grep test --verbose sed export ${HOME}
+	then 2>/dev/null local "$1" local local grep test "$1" --verbose "$@" test
+readonly sed "$@" && $(pwd) --verbose printf local then export
+	then ${HOME} "$1" done $(pwd)
+	export grep done readonly echo "$1" /usr/bin |
+	readonly 'quoted text' |
+-eu 2>/dev/null 'quoted text' test printf $(pwd) echo export test
+		$(pwd) 'quoted text' $(pwd) printf grep test 'quoted text' test cd
+	$(pwd) test "$@" x=1 local -eu test awk then 2>/dev/null $(pwd)
+		sed && /usr/bin "$1" --verbose done
+		export /usr/bin done
+		readonly test grep "$1" printf grep done "$@"
+		export then export 'quoted text' 2>/dev/null done local done "$1" readonly
+	printf done echo printf local --verbose "$1"
+"$1" /usr/bin export && readonly && --verbose 'quoted text' 2>/dev/null
+		x=1 x=1 local ${HOME} grep x=1 /usr/bin 2>/dev/null
+		/usr/bin && "$@" x=1 | echo test test | "$@" readonly then 2>/dev/null "$@" then
+		x=1 readonly x=1 done -eu 'quoted text' ${HOME} printf awk
+| ${HOME} -eu "$@" test
+	done --verbose /usr/bin
+2>/dev/null export "$1" "$1" 2>/dev/null cd 2>/dev/null /usr/bin
+	/usr/bin "$@" "$@" then /usr/bin
+	2>/dev/null printf /usr/bin sed -eu readonly | "$@" readonly
+| 2>/dev/null awk test grep /usr/bin --verbose printf x=1 | cd
+| sed export --verbose local
+	local cd --verbose done readonly -eu awk then grep "$@" | -eu local cd readonly
+		then 2>/dev/null awk readonly test printf cd printf cd done sed x=1 ${HOME} readonly
+	test 2>/dev/null done ${HOME} echo awk done && "$1" ${HOME}
+"$@" test then "$1" done $(pwd) done
+"$@" export test -eu readonly echo -eu x=1
+		${HOME} | echo grep x=1 $(pwd) test && printf local
+		2>/dev/null then sed cd then printf readonly echo
+$(pwd) test awk "$@" echo $(pwd) done -eu 'quoted text'
+x=1 && export cd then x=1 test sed $(pwd) printf -eu cd | grep | cd &&
+	echo awk export $(pwd) | ${HOME} "$1" /usr/bin
+		then printf /usr/bin | sed sed | | ${HOME} sed $(pwd) awk printf
+		export echo "$1" 'quoted text'
+		local echo sed readonly 'quoted text'
+	/usr/bin "$@" 'quoted text' "$1" printf -eu /usr/bin readonly test export
+readonly "$@" awk 'quoted text' cd printf readonly grep | test
+echo sed -eu echo grep readonly "$1" sed
+	test && test ${HOME} 2>/dev/null echo 2>/dev/null local test
+		"$@" readonly "$@" awk test done then
+		sed 2>/dev/null ${HOME} local $(pwd)
+		${HOME} readonly cd --verbose | && "$1" test ${HOME} cd
+2>/dev/null 'quoted text'
+		--verbose && grep /usr/bin readonly 'quoted text'
+		&& cd export x=1 awk $(pwd) then ${HOME}
+printf && printf test 2>/dev/null ${HOME} ${HOME} grep printf
+		local && --verbose done -eu readonly 2>/dev/null readonly test --verbose --verbose
+${HOME} printf export grep
+		$(pwd) -eu "$@" | "$1" /usr/bin ${HOME} cd | | 2>/dev/null
+		cd then x=1 'quoted text'
+		x=1 local local readonly /usr/bin 'quoted text'
+	local local done 2>/dev/null -eu
+&& ${HOME} /usr/bin printf grep -eu printf --verbose
+		$(pwd) export "$1" "$@" readonly echo sed readonly
+'quoted text' $(pwd) /usr/bin local "$@"
+	'quoted text' $(pwd) awk "$1" grep | "$@" printf
+--verbose export 'quoted text' 2>/dev/null then | ${HOME} "$1" export
+	$(pwd) --verbose "$@" "$@" "$1" $(pwd) "$1" --verbose printf echo export
+		$(pwd) readonly grep cd x=1 readonly $(pwd) $(pwd) --verbose
+then -eu local grep echo
+	readonly /usr/bin /usr/bin echo readonly $(pwd) then test 2>/dev/null
+	$(pwd) local 2>/dev/null cd export
+awk readonly awk ${HOME} /usr/bin
+	x=1 grep "$1" then x=1 /usr/bin x=1 sed
+cd sed awk echo "$1" "$@" /usr/bin | "$@"
+		/usr/bin sed sed test local export sed test --verbose &&
+printf then test 'quoted text' 'quoted text' readonly 2>/dev/null
+2>/dev/null cd local 2>/dev/null ${HOME} /usr/bin awk "$1" --verbose "$@"
+		'quoted text' local printf readonly readonly -eu awk "$1" printf
+		| "$1" | grep 'quoted text' test done grep $(pwd) $(pwd)
+		printf ${HOME} awk -eu test -eu then 2>/dev/null --verbose
+	${HOME} test "$1" local local 'quoted text' awk 2>/dev/null --verbose cd x=1 | export
+	awk local -eu | $(pwd) --verbose export
+	sed cd local "$@" then printf test
+		2>/dev/null $(pwd) cd awk readonly 2>/dev/null
+		| test x=1 grep -eu export
+		printf sed export awk x=1 | done test awk done
+		export x=1 x=1 && test done -eu "$1" -eu $(pwd) 2>/dev/null readonly
+		| && local readonly x=1 awk "$1" x=1 --verbose x=1
+		printf /usr/bin awk awk | -eu then
+"$@" $(pwd) readonly "$@" export done /usr/bin then local
+test "$1" | awk export
+	awk x=1 cd && then "$1" 2>/dev/null && then --verbose done
+test cd -eu /usr/bin ${HOME} x=1 printf done 'quoted text' export
+local sed "$@" | && 2>/dev/null readonly done printf
+	| export /usr/bin sed local echo
+	done local --verbose x=1 $(pwd) 'quoted text' 2>/dev/null "$1"
+$(pwd) readonly x=1 /usr/bin -eu x=1 then "$@" cd awk grep && printf export
+		grep grep x=1 sed ${HOME} local $(pwd)
+		'quoted text' then "$1" ${HOME} local --verbose && then done
+	test /usr/bin --verbose
+	'quoted text' export echo 2>/dev/null 'quoted text'
+	${HOME} 2>/dev/null then echo -eu
+$(pwd) local -eu awk done "$@" then /usr/bin export --verbose ${HOME} "$@" readonly
+"$1" local readonly printf awk grep "$1" 'quoted text' awk "$1" -eu -eu 2>/dev/null
+&& | awk "$@" "$@" then -eu sed grep local 2>/dev/null "$1"
+| x=1 then x=1 grep && readonly ${HOME} ${HOME} cd local cd echo
+then ${HOME} x=1 "$@" echo cd x=1 echo grep awk "$1" "$@" awk
+	--verbose printf done test
+echo echo grep cd x=1 sed | x=1 ${HOME} x=1 readonly done readonly
+	'quoted text' test | $(pwd) awk ${HOME} ${HOME} x=1 awk awk sed /usr/bin readonly
+| test && then cd cd x=1 "$1" --verbose echo then && $(pwd) x=1
+		export readonly cd readonly
+	then export export --verbose /usr/bin 2>/dev/null $(pwd)
+	&& 2>/dev/null $(pwd) 2>/dev/null
+		cd done test "$@" sed --verbose
+-eu then $(pwd) sed sed then $(pwd) x=1 done $(pwd)
+	"$@" local printf && && "$@"
+awk ${HOME} ${HOME} sed awk $(pwd)
+		$(pwd) 'quoted text' export grep
+		echo ${HOME} echo 'quoted text'
+		printf /usr/bin sed test then $(pwd)
+$(pwd) done grep echo
+	"$@" && local cd local -eu cd grep local export
+then local $(pwd) grep x=1 x=1 sed export awk test local
+	'quoted text' 'quoted text' printf && 'quoted text'
+cd x=1 awk | done done readonly 2>/dev/null "$@" done grep
+/usr/bin awk "$@" awk
+		'quoted text' cd grep sed /usr/bin readonly export --verbose export "$1"
+"$@" awk readonly grep "$1" readonly /usr/bin then grep then
+	| test done export echo then grep --verbose && done grep x=1 /usr/bin
+local printf 'quoted text' readonly test
+--verbose --verbose x=1
+grep grep export echo test local --verbose x=1
+#include c201.sh
+echo | done sed x=1 awk "$@" /usr/bin
+	grep && export awk && local awk local x=1 printf export cd
+	cd | sed printf cd echo test then cd sed readonly /usr/bin
+	/usr/bin awk 'quoted text' readonly echo grep 2>/dev/null sed
+	local echo ${HOME} 'quoted text' sed 2>/dev/null /usr/bin readonly
+grep readonly $(pwd) --verbose
+	--verbose 'quoted text' cd grep 2>/dev/null /usr/bin test
+		readonly x=1 cd awk sed x=1 2>/dev/null echo sed grep test then | done
+		awk ${HOME} "$@" grep readonly "$1" $(pwd) && test echo $(pwd) x=1
+then printf && cd --verbose
+	/usr/bin /usr/bin 'quoted text' --verbose
+"$1" awk readonly readonly 'quoted text' "$1" --verbose then done echo
+		export /usr/bin printf && 'quoted text' -eu --verbose 2>/dev/null
+		'quoted text' -eu ${HOME} done readonly | 2>/dev/null "$@" $(pwd) -eu -eu export
+		--verbose export readonly sed printf "$@" then | x=1
+		done && && awk echo 'quoted text'
+		readonly $(pwd) "$@" /usr/bin ${HOME} -eu awk ${HOME}
+sed ${HOME} x=1 --verbose | sed x=1 printf && awk | readonly $(pwd) |
+-eu done && echo --verbose
+		grep /usr/bin && export && -eu printf readonly sed awk
+	awk grep printf x=1 $(pwd) | && printf sed printf sed /usr/bin sed awk readonly
+"$@" 2>/dev/null then "$1" --verbose 'quoted text' sed printf sed 2>/dev/null
+	| 'quoted text' "$@" "$1" test sed 'quoted text' ${HOME} sed -eu readonly
+	"$1" local | --verbose export "$@" readonly
+		cd --verbose "$@" 2>/dev/null printf printf
+		awk -eu cd test echo &&
+printf sed test done $(pwd) ${HOME}
+"$1" then 'quoted text'
+		export sed -eu then "$@" done 'quoted text' $(pwd) export echo 'quoted text'
+		"$@" done ${HOME} && --verbose | && grep echo | | 2>/dev/null
+		printf "$1" x=1 awk grep echo test
+		'quoted text' readonly /usr/bin awk cd sed sed
+		readonly awk | export $(pwd)
+| ${HOME} cd ${HOME} readonly -eu printf x=1 awk ${HOME} done then test
+		test && cd $(pwd) awk awk sed export 'quoted text' done 'quoted text'
+	2>/dev/null export "$@" echo /usr/bin /usr/bin && "$@" grep readonly echo test
+	cd done "$@" -eu then && ${HOME}
+local grep echo "$1" local
+	$(pwd) grep test $(pwd) readonly --verbose
+		x=1 -eu | export readonly grep printf | x=1 2>/dev/null grep 'quoted text'
+		"$@" done "$1" $(pwd) --verbose -eu sed && 2>/dev/null
+$(pwd) export && | echo | local
+	cd then echo awk $(pwd) echo $(pwd)
+	&& 2>/dev/null 2>/dev/null "$1" x=1 /usr/bin
+	2>/dev/null && readonly --verbose awk 'quoted text' "$1" echo x=1
+local $(pwd) printf && done echo readonly x=1 -eu &&
+		$(pwd) readonly | readonly done --verbose -eu
+		"$@" grep "$@" ${HOME} printf cd && sed 2>/dev/null --verbose printf &&
+		then readonly 2>/dev/null local x=1 sed grep readonly 2>/dev/null "$1" --verbose
+&& x=1 printf && "$1" /usr/bin then $(pwd) awk ${HOME} --verbose
+	| | cd local done printf 'quoted text' echo "$@" printf
+${HOME} printf "$1" test 'quoted text' export sed "$1" && test ${HOME}
+		grep readonly 'quoted text' 'quoted text' local && export
+	"$1" cd --verbose /usr/bin awk | && export
+		awk awk printf echo /usr/bin
+		sed echo printf grep sed test --verbose grep 'quoted text' local 'quoted text'
+done cd x=1 /usr/bin printf ${HOME} -eu then --verbose grep x=1 'quoted text'
+		/usr/bin "$@" then "$1" /usr/bin /usr/bin sed grep $(pwd)
+		grep /usr/bin done sed 2>/dev/null 'quoted text' /usr/bin awk --verbose
+sed "$@" export local readonly export "$1" cd
+readonly done printf grep 2>/dev/null done
+	"$1" sed echo export -eu -eu cd then grep x=1 then 2>/dev/null grep 'quoted text'
+/usr/bin then done then test 'quoted text'
+	done && /usr/bin && then x=1 cd | 2>/dev/null
+/usr/bin 'quoted text' $(pwd) test test | local $(pwd) grep
+		done done sed | test local local cd test "$@" | ${HOME} awk && cd ${HOME}
+		'quoted text' --verbose export
+sed grep 2>/dev/null && local test
+		--verbose "$1" --verbose x=1 readonly grep
+		awk $(pwd) test then 2>/dev/null | | "$1" $(pwd)
+	readonly sed $(pwd) x=1 x=1 --verbose printf done export sed local
+		"$1" ${HOME} 'quoted text'
+| awk awk "$1" sed ${HOME} echo
+		2>/dev/null | echo | ${HOME} readonly -eu -eu
+		"$1" 2>/dev/null 2>/dev/null $(pwd) local test export
+		awk && x=1 readonly $(pwd) cd x=1 test printf done grep cd
+	echo ${HOME} export 'quoted text' ${HOME} /usr/bin
+		sed --verbose test printf
+		-eu readonly grep readonly grep local && $(pwd) then export
+x=1 /usr/bin "$@" grep done
+printf echo awk readonly readonly awk "$@" awk grep --verbose -eu awk echo test
+	2>/dev/null "$1" readonly --verbose printf then -eu echo grep ${HOME}
+		test 'quoted text' local --verbose ${HOME} local cd
+	done cd -eu printf test export
+	done done done | local echo local readonly done
+		printf grep awk $(pwd) 'quoted text' local --verbose x=1
+	2>/dev/null --verbose ${HOME} cd printf awk local echo -eu --verbose done
+		local local sed export /usr/bin readonly "$1" $(pwd) grep printf
+awk export grep "$@" then $(pwd) ${HOME} sed sed done 2>/dev/null local 'quoted text'
+		export ${HOME} grep | test awk "$@" 2>/dev/null
+	test readonly readonly "$@" 'quoted text' export -eu "$1" -eu test printf done
+		$(pwd) && && && && 'quoted text' $(pwd) /usr/bin
+	sed --verbose -eu sed test export /usr/bin 'quoted text' grep done
+export /usr/bin test x=1 | && --verbose grep && "$@" ${HOME} readonly
+'quoted text' awk cd awk echo "$1" grep grep $(pwd) x=1 x=1
+		--verbose test "$1" | printf export cd "$1" 'quoted text' awk
+	readonly /usr/bin -eu 'quoted text' "$1" --verbose
+		"$1" readonly test readonly local --verbose grep
+	sed 'quoted text' "$1" printf export
+	--verbose | readonly 'quoted text' readonly awk
+		then local printf export awk awk 2>/dev/null --verbose -eu
+		2>/dev/null cd cd export 'quoted text'
+$(pwd) ${HOME} printf 2>/dev/null
+	/usr/bin ${HOME} /usr/bin test 2>/dev/null
+local "$1" x=1 $(pwd) 'quoted text' --verbose
+local 2>/dev/null "$1" grep echo "$@"
+	"$@" readonly local cd grep --verbose sed ${HOME} -eu then export
+	--verbose --verbose && --verbose | sed && "$@" sed
+	echo | /usr/bin "$@" --verbose test ${HOME} "$@" | -eu
+		test ${HOME} readonly test test && /usr/bin $(pwd) awk --verbose
+| --verbose ${HOME} /usr/bin "$1" sed
+printf test 2>/dev/null
+	x=1 local cd "$@" local test done test printf
+		test readonly --verbose awk 2>/dev/null sed | ${HOME}
+local $(pwd) export then 'quoted text' grep
+		sed --verbose $(pwd) local then |
+	&& echo awk ${HOME} readonly then echo grep --verbose
+		$(pwd) | awk sed 'quoted text' | echo -eu cd --verbose 'quoted text' 'quoted text'
+		-eu export /usr/bin local -eu ${HOME} cd "$1" printf done done grep "$1" -eu
+cd cd then grep --verbose --verbose then "$@" done 'quoted text' "$1" /usr/bin
+	| /usr/bin | awk echo awk && readonly
+$(pwd) sed awk then test done
+x=1 cd sed local "$@" && grep $(pwd) test printf ${HOME} done "$@"
+		cd ${HOME} test printf -eu 2>/dev/null --verbose "$@" grep echo
+	export --verbose sed local sed readonly x=1 done ${HOME} $(pwd) then
+awk cd /usr/bin -eu "$1" readonly done grep test sed echo sed
+		| | cd cd --verbose 2>/dev/null && then then $(pwd) test ${HOME} x=1 | x=1
+		--verbose "$@" -eu $(pwd) 2>/dev/null
+grep x=1 --verbose x=1 cd ${HOME} $(pwd) -eu local | /usr/bin
+export /usr/bin cd then
+$(pwd) $(pwd) ${HOME} grep "$@" 'quoted text' ${HOME} |
+		done $(pwd) x=1 "$1" done -eu export grep | ${HOME} done awk
+test --verbose 2>/dev/null --verbose
+then export printf $(pwd)
+$(pwd) --verbose | x=1 "$1" -eu test "$1" test ${HOME} "$1" "$@" then done readonly
+'quoted text' cd readonly -eu printf $(pwd) "$@" --verbose
+	cd -eu then done awk /usr/bin
+	test awk done x=1 export echo
+-eu /usr/bin done readonly /usr/bin awk ${HOME} -eu export
+	--verbose readonly $(pwd) done && local $(pwd) --verbose x=1 grep --verbose 'quoted text'
+readonly /usr/bin ${HOME} export
+2>/dev/null x=1 /usr/bin test 2>/dev/null then then $(pwd) |
+awk local -eu printf readonly
+$(pwd) && -eu test 2>/dev/null /usr/bin
+		local printf "$1" local ${HOME} awk echo then awk --verbose
+local && echo -eu then $(pwd) $(pwd) 2>/dev/null 2>/dev/null cd test
+		export cd local awk $(pwd) sed sed "$1" | readonly $(pwd) export "$1" "$1" $(pwd)
+		-eu test "$1" printf -eu echo --verbose "$@" test ${HOME} 'quoted text'
+	done cd "$@" && -eu sed "$1" "$@" test awk "$1" readonly
+	2>/dev/null local cd sed "$@" "$1" echo 'quoted text' done grep
+		&& | sed test sed test printf ${HOME} && done $(pwd) -eu echo && local &&
+--verbose local echo 2>/dev/null awk 2>/dev/null 2>/dev/null
+		'quoted text' "$@" echo /usr/bin cd "$1" awk
+		/usr/bin printf cd local sed done "$@" --verbose sed done "$@"
+		"$1" awk awk readonly x=1 "$1" "$@" |
+&& /usr/bin readonly printf sed | echo printf
+-eu --verbose then -eu then x=1 export
+		sed 'quoted text' test printf /usr/bin test export x=1 -eu $(pwd) && x=1 --verbose
+	done printf cd then then "$@" local "$@" local ${HOME}
+local --verbose test ${HOME}
+		&& -eu -eu 'quoted text' local local
+		cd export "$1" readonly "$1" ${HOME} export test "$1" | awk printf /usr/bin
+	$(pwd) cd | export "$1" /usr/bin readonly sed $(pwd) grep sed 2>/dev/null
+	-eu "$1" "$1" --verbose test "$1" 'quoted text'
+		done | cd printf $(pwd) export 2>/dev/null
+	"$@" /usr/bin done /usr/bin echo then grep sed -eu grep 'quoted text'
+	-eu "$1" | export awk 2>/dev/null 2>/dev/null cd readonly --verbose
+cd export | echo done test && echo export grep grep then 'quoted text'
+		"$@" echo && $(pwd) grep x=1
+then x=1 ${HOME} x=1 echo -eu 2>/dev/null | 'quoted text' 2>/dev/null
+export && ${HOME} sed local "$@" cd | readonly && ${HOME}
+		done 'quoted text' readonly readonly printf x=1 /usr/bin 'quoted text' -eu
+		cd done /usr/bin 2>/dev/null
+		"$1" && then ${HOME} | "$1" "$1"
+		cd 2>/dev/null echo then && --verbose
+		"$1" ${HOME} printf -eu
+echo readonly x=1 readonly "$@" "$1" | "$1"
+	awk $(pwd) --verbose -eu printf -eu test awk then
+cd export awk "$@" -eu $(pwd) "$1" sed then 2>/dev/null export cd --verbose
+	grep sed 2>/dev/null echo test echo done "$1" done echo printf x=1 x=1
+	| echo $(pwd) 2>/dev/null --verbose ${HOME}
+${HOME} local test printf "$@" printf printf x=1 -eu x=1 grep
+--verbose x=1 sed then "$@" $(pwd) echo local && x=1 $(pwd) -eu "$1"
+	echo ${HOME} cd /usr/bin export -eu 'quoted text' 'quoted text'
+	readonly /usr/bin $(pwd) -eu /usr/bin test "$@" "$@" awk sed --verbose
+cd readonly awk /usr/bin | echo --verbose done
+	2>/dev/null awk then -eu | x=1 awk "$1" "$@"
+		"$@" echo "$@" 'quoted text' -eu cd export local echo ${HOME} then grep
+sed echo readonly cd && awk done | 2>/dev/null ${HOME} readonly $(pwd) test
+/usr/bin sed && cd /usr/bin awk --verbose export done
+		"$1" grep /usr/bin cd ${HOME}
+	&& 2>/dev/null printf echo test --verbose
+		done 2>/dev/null 2>/dev/null 2>/dev/null
+"$1" printf local then --verbose /usr/bin
+		${HOME} "$1" -eu export then 'quoted text' ${HOME} echo printf grep readonly readonly
+		$(pwd) x=1 -eu then $(pwd) export "$@" readonly
+		local grep grep echo export --verbose "$1"
+	"$1" 2>/dev/null cd readonly done then export | "$1" /usr/bin
+		echo then x=1 | x=1 done then 2>/dev/null
+	printf x=1 | -eu export "$1" 'quoted text'
+--verbose "$@" --verbose readonly grep done | test |
+awk | && 2>/dev/null local sed 'quoted text' /usr/bin cd -eu
+	local sed printf echo ${HOME} 'quoted text' -eu echo local $(pwd) ${HOME}
+	x=1 /usr/bin --verbose && done
+		export readonly x=1 grep "$@" local
+		cd --verbose readonly then 'quoted text' printf /usr/bin 'quoted text'
+"$@" awk 2>/dev/null echo grep "$@" readonly local readonly
+readonly "$1" | | /usr/bin printf | printf
+	2>/dev/null grep done 'quoted text' 'quoted text' readonly -eu
+	test "$@" grep && cd ${HOME} done echo readonly
+	echo $(pwd) test && 2>/dev/null export sed ${HOME} sed export awk
+	/usr/bin done test readonly x=1 "$@" readonly $(pwd) ${HOME}
+x=1 readonly -eu local awk readonly --verbose
+	&& echo /usr/bin done awk "$1" /usr/bin awk then readonly
+	printf sed -eu x=1 | printf awk readonly "$1" echo | | && 'quoted text' 'quoted text'
+	export awk done then $(pwd) && | ${HOME} --verbose
+	awk done | test sed 'quoted text' /usr/bin ${HOME} test readonly
+readonly grep done && done 'quoted text' 2>/dev/null cd --verbose
+		x=1 test -eu done | readonly
+		done awk --verbose $(pwd) printf 2>/dev/null 2>/dev/null
+		export echo test --verbose x=1 | 'quoted text' $(pwd) | then echo "$@" cd sed awk
+		echo "$1" ${HOME} local echo local "$1" export grep -eu 2>/dev/null "$@"
+"$1" then /usr/bin && awk "$1" awk "$@"
+	-eu grep 'quoted text' cd echo export export local echo
+		awk --verbose readonly 2>/dev/null readonly 'quoted text' --verbose "$1"
+	local x=1 'quoted text' done cd awk -eu "$1" grep /usr/bin ${HOME}
+$(pwd) ${HOME} "$1" awk
+		${HOME} x=1 done done test $(pwd) 2>/dev/null
+&& "$1" $(pwd) grep cd then then
+	$(pwd) readonly "$1" && echo && --verbose
+		$(pwd) local test readonly ${HOME} done printf readonly
+$(pwd) awk test x=1 readonly 2>/dev/null awk
+local "$1" ${HOME} "$@" | done
+		--verbose -eu then x=1 readonly grep done printf
+		--verbose done done cd cd | /usr/bin -eu 2>/dev/null grep cd cd | readonly readonly
+	--verbose printf | $(pwd)
+"$@" $(pwd) "$@" then | done sed local && "$@" echo 'quoted text'
+		cd $(pwd) --verbose && --verbose "$@" done readonly grep "$1"
+then $(pwd) done && | export -eu
+		then x=1 then sed "$1" export 'quoted text' /usr/bin echo 2>/dev/null
+		done x=1 awk 2>/dev/null /usr/bin grep ${HOME}
+		grep $(pwd) -eu test --verbose ${HOME} printf printf "$1" x=1 cd cd |
+	"$@" then cd 2>/dev/null
+	| export export awk echo "$1" --verbose test sed | x=1 2>/dev/null
+	readonly echo x=1 && "$@" local test export ${HOME} readonly $(pwd)
+		readonly "$1" 'quoted text' ${HOME}
+	&& echo test "$1" 'quoted text' local cd
+	--verbose awk "$1" -eu sed | $(pwd) cd $(pwd) local local grep
+/usr/bin --verbose local printf | echo printf && awk
+		--verbose -eu printf "$@" "$1" done /usr/bin "$1" 'quoted text'
+		grep grep sed /usr/bin readonly readonly 2>/dev/null local
+	echo && test x=1 readonly test 'quoted text' x=1
+cd then ${HOME} "$@" --verbose echo 'quoted text' echo sed cd ${HOME} local
+		sed awk ${HOME} test "$1" then | $(pwd) local /usr/bin local 'quoted text' "$@"
+		grep done test 2>/dev/null x=1 printf done
+		$(pwd) printf echo | -eu x=1 cd "$@" cd awk sed awk $(pwd) && --verbose
+		| grep then "$1" && x=1 export echo cd test --verbose export grep $(pwd)
+		then 'quoted text' --verbose
+	test printf done /usr/bin --verbose "$1" 2>/dev/null echo grep 'quoted text'
+		grep export then -eu export x=1
+2>/dev/null 'quoted text' | export 'quoted text' 2>/dev/null printf done "$@"
+		&& --verbose 'quoted text'
+	cd $(pwd) --verbose local /usr/bin
+grep awk grep sed local local readonly
+awk printf -eu x=1 && ${HOME} "$@" export
+	test then readonly test
+	test 2>/dev/null "$@" readonly | readonly "$@" $(pwd) -eu && 'quoted text'
+then then x=1 done then test x=1 cd sed -eu echo "$@"
+	x=1 awk printf $(pwd) --verbose && x=1 "$@" --verbose
+	--verbose sed printf echo "$@" 'quoted text' $(pwd) cd echo 'quoted text'
+	test 'quoted text' then
+done grep readonly awk -eu --verbose done grep -eu /usr/bin
+	sed local echo done 'quoted text' -eu awk readonly 2>/dev/null "$@" 2>/dev/null
+--verbose then local && 'quoted text' export x=1
+		$(pwd) export printf sed "$@" --verbose
+	&& echo cd $(pwd) sed echo test &&
+export sed 'quoted text' then local
+		local "$@" | 'quoted text' cd then 2>/dev/null | test grep | printf export
+	echo readonly awk x=1 sed sed | sed 2>/dev/null cd x=1 && cd cd --verbose grep
+grep test "$@" $(pwd) $(pwd) test "$@" 'quoted text'
+printf && $(pwd) local sed ${HOME} grep echo done
+'quoted text' test /usr/bin export $(pwd) awk 2>/dev/null
+	then readonly echo && cd grep awk x=1 then
+		readonly then grep 'quoted text' test cd ${HOME} then $(pwd)
+		cd local 2>/dev/null test readonly -eu export then x=1 local $(pwd)
+	sed $(pwd) --verbose local
+	echo 'quoted text' 2>/dev/null printf export awk
+awk | --verbose local
+		&& done 2>/dev/null done x=1 awk export 2>/dev/null --verbose -eu x=1 export 2>/dev/null
+	2>/dev/null readonly sed "$@" ${HOME}
+2>/dev/null "$@" printf test "$1" cd test sed printf |
+${HOME} "$1" x=1 test export --verbose done then 2>/dev/null -eu sed
+	&& printf 'quoted text' $(pwd) x=1
+--verbose "$@" cd /usr/bin local 'quoted text' -eu then grep "$1"
+	/usr/bin -eu sed $(pwd) local sed local /usr/bin
+readonly | printf && grep cd
+		readonly /usr/bin && done
+${HOME} "$1" cd printf done done x=1 grep $(pwd) $(pwd) -eu
+		cd sed printf readonly 'quoted text'
+	$(pwd) test local grep echo $(pwd) | $(pwd) readonly local ${HOME}
+	$(pwd) -eu /usr/bin then export done 'quoted text' 2>/dev/null
+&& x=1 grep ${HOME} "$@" ${HOME} "$1" -eu printf export local printf | --verbose
+'quoted text' 2>/dev/null "$@" 2>/dev/null 2>/dev/null
+		'quoted text' && | echo $(pwd) $(pwd) "$@"
+	-eu --verbose test 2>/dev/null
+echo printf awk x=1 && 2>/dev/null
+2>/dev/null cd x=1 export
+test awk "$1" -eu -eu && 2>/dev/null | "$1" ${HOME} 'quoted text' 2>/dev/null
+	2>/dev/null ${HOME} printf | local ${HOME} ${HOME}
+		--verbose export local "$1" then
+		export cd printf "$1" test then && readonly export $(pwd)
+		printf 'quoted text' awk ${HOME} 2>/dev/null export x=1 awk readonly
+	done echo readonly "$@" cd --verbose /usr/bin | --verbose 2>/dev/null
+		awk echo sed grep local && 2>/dev/null test readonly
+--verbose "$@" test --verbose /usr/bin local ${HOME} done 2>/dev/null /usr/bin
+		x=1 'quoted text' 2>/dev/null printf test grep && 2>/dev/null
+	-eu sed -eu "$@" awk printf 2>/dev/null "$@" 'quoted text'
+grep && /usr/bin "$@" grep export ${HOME}
+	2>/dev/null x=1 awk ${HOME} /usr/bin cd $(pwd) x=1 then echo
+	/usr/bin printf printf "$1" readonly sed -eu x=1 cd awk --verbose readonly
+	printf 'quoted text'
+test 2>/dev/null awk $(pwd) export cd $(pwd) "$1" grep test local awk
+x=1 printf /usr/bin sed | "$1" "$1" -eu readonly $(pwd) export
+		awk cd then local -eu readonly done then then ${HOME}
+		/usr/bin 2>/dev/null 2>/dev/null
+		"$1" readonly done echo
+	--verbose done cd export 2>/dev/null
+sed sed /usr/bin x=1 ${HOME} export $(pwd)
+		readonly sed echo then test done then "$1" -eu test --verbose
+		readonly printf done x=1 test cd -eu export 2>/dev/null
+		done x=1 printf readonly cd export | ${HOME} $(pwd) local
+		test awk then ${HOME} export sed printf --verbose then | /usr/bin sed "$@"
+	--verbose test | local readonly cd test "$1" x=1 -eu cd 'quoted text'
+		done 2>/dev/null done $(pwd) export then | grep
+2>/dev/null "$@" -eu x=1 -eu export
+&& $(pwd) x=1 "$1" awk $(pwd) sed 2>/dev/null done export /usr/bin && echo
+	'quoted text' "$1" awk "$@" ${HOME} -eu then sed grep
+		--verbose /usr/bin then awk 'quoted text' awk readonly echo grep 2>/dev/null -eu
+	printf "$1" | 'quoted text' awk "$1" 2>/dev/null -eu --verbose test -eu
+	/usr/bin echo done ${HOME} x=1 ${HOME} "$1"
+		export --verbose "$1" printf ${HOME} --verbose readonly
+	"$1" sed test test && printf x=1 then echo | -eu sed test
+	awk grep awk $(pwd) && --verbose
+	2>/dev/null $(pwd) | sed test $(pwd) 'quoted text' ${HOME} $(pwd) /usr/bin
+	/usr/bin local echo --verbose awk done grep done ${HOME}
+awk ${HOME} done | -eu echo printf $(pwd) sed "$@" done 2>/dev/null $(pwd)
+sed "$1" sed | 'quoted text' then local | test 2>/dev/null sed
+		&& sed "$1" then echo readonly
+		--verbose $(pwd) "$@" awk done printf printf x=1 "$1" done export x=1 grep printf
+		local /usr/bin "$1" "$1" -eu "$1" then done sed "$@" printf export "$1" test |
+grep cd readonly local $(pwd)
+	readonly cd printf | cd "$@" /usr/bin | | 2>/dev/null
+${HOME} readonly 'quoted text' cd /usr/bin | && local printf
+	grep printf "$1" readonly | "$1" x=1 sed
+	${HOME} printf 'quoted text' sed -eu -eu export export echo echo | ${HOME}
+		test done "$1" done "$1"
+	export /usr/bin $(pwd) export awk
+cd | test printf local export x=1 echo --verbose test 'quoted text'
+		-eu export readonly awk local /usr/bin readonly local /usr/bin
+		done grep local 2>/dev/null | cd x=1 grep -eu awk local "$@"
+		-eu local $(pwd) export grep
+		"$1" /usr/bin cd readonly
+		$(pwd) 2>/dev/null 'quoted text' "$@" test cd --verbose ${HOME} "$@"
+"$1" sed 'quoted text' | readonly
+readonly | && grep 2>/dev/null |
+local grep cd sed | "$@" "$1" x=1 $(pwd)
+printf ${HOME} done local -eu -eu readonly printf | ${HOME}
+x=1 --verbose | | 2>/dev/null && $(pwd) readonly
+	&& readonly then echo ${HOME} printf then cd readonly test export readonly awk
+"$@" grep cd echo printf -eu 2>/dev/null export
+$(pwd) test export 'quoted text' cd "$@" then --verbose "$1"
+	cd grep sed readonly /usr/bin "$1" then
+	x=1 done ${HOME} awk && /usr/bin test cd | x=1 test
+printf $(pwd) test ${HOME}
+		local /usr/bin grep ${HOME} -eu /usr/bin 2>/dev/null --verbose
+		then awk export ${HOME} then 2>/dev/null echo 'quoted text' --verbose
+		/usr/bin cd "$@" then -eu "$1" echo x=1 readonly && "$@" | $(pwd) done
+		sed grep 2>/dev/null $(pwd)
+	x=1 local --verbose x=1 2>/dev/null
+	| grep readonly && |
+test && sed && && | /usr/bin awk printf -eu /usr/bin --verbose ${HOME}
+	${HOME} x=1 | 2>/dev/null ${HOME} sed local export awk
+	then ${HOME} echo awk cd local
+/usr/bin local then echo then cd grep awk grep readonly local x=1 "$1"
+	test ${HOME} then && ${HOME} $(pwd) readonly --verbose
+	printf 'quoted text' printf --verbose
+sed readonly ${HOME} cd readonly 'quoted text' done
+	cd /usr/bin 2>/dev/null done | readonly awk "$1" local x=1 printf test -eu
+	${HOME} awk "$1" cd | $(pwd) 2>/dev/null "$1" --verbose
+		&& sed export then export ${HOME} awk readonly $(pwd) "$@" test
+	cd test grep readonly | $(pwd) then ${HOME} grep x=1
+	test awk readonly done /usr/bin $(pwd)
+-eu export 'quoted text' | | 'quoted text' cd cd then then /usr/bin --verbose
+export 'quoted text' && 2>/dev/null && "$@" done test sed -eu --verbose awk --verbose
+	then echo then local /usr/bin 'quoted text' done
+	'quoted text' "$@" "$@" awk echo printf sed $(pwd)
+"$@" x=1 --verbose "$@" then done 'quoted text' --verbose readonly then | done
+	then ${HOME} $(pwd) local -eu
+		export test "$@" sed $(pwd)
+	grep local done awk done done local 'quoted text' -eu sed "$1" $(pwd)
+	grep -eu done printf ${HOME}
+done awk x=1 readonly local echo 'quoted text' "$1" x=1 readonly
+	local then /usr/bin ${HOME}
+	&& echo "$@" "$@" -eu grep "$1" $(pwd) 'quoted text'
+		cd | done && local printf 2>/dev/null x=1 "$@" ${HOME} printf local -eu "$@" "$1"
+	&& "$@" awk "$1" export --verbose && --verbose awk grep test done
+		export printf sed sed done readonly 2>/dev/null
+	done local readonly | echo x=1 2>/dev/null readonly x=1 readonly printf ${HOME}
+cd grep --verbose done 'quoted text' && printf export cd awk && then sed awk
+		"$1" awk -eu x=1 'quoted text' readonly
+	/usr/bin 2>/dev/null test local 'quoted text' $(pwd) ${HOME} export awk
+$(pwd) x=1 "$1" cd x=1 'quoted text'
+	echo awk local printf sed "$@" echo export --verbose sed then | "$1" /usr/bin
+readonly cd test test printf then then printf
+		-eu readonly -eu -eu grep local 2>/dev/null export 2>/dev/null 2>/dev/null
+&& | readonly echo && /usr/bin 'quoted text' x=1 printf sed
+	'quoted text' local $(pwd) cd $(pwd) grep readonly
+	"$@" --verbose x=1 grep test then sed awk export | "$@" printf
+done && then test readonly -eu $(pwd) "$@" readonly "$1" then "$@" "$@" 2>/dev/null
+"$1" --verbose && printf -eu && ${HOME}
+		$(pwd) local /usr/bin printf
+	-eu x=1 "$@" printf | test echo x=1 'quoted text'
+	$(pwd) export done echo "$1"
+		'quoted text' awk 'quoted text' printf readonly x=1
+/usr/bin sed export 'quoted text'
+		cd "$1" then $(pwd) /usr/bin printf ${HOME} local readonly then
+		-eu -eu ${HOME} 2>/dev/null readonly
+	done local then readonly $(pwd)
+		export "$@" 'quoted text' echo test
+	export x=1 cd cd awk local $(pwd) printf
+		echo && "$@" cd awk && test local | awk /usr/bin "$@"
+	sed | -eu --verbose x=1 /usr/bin
+	test && readonly then local sed -eu
+	-eu printf printf sed 'quoted text' /usr/bin
+| | "$1" "$@" 'quoted text' 2>/dev/null -eu export readonly $(pwd) x=1 x=1
+	/usr/bin awk ${HOME} x=1 test local "$1" && -eu local
+		readonly cd done /usr/bin
+	export 'quoted text' $(pwd) readonly echo grep awk && && $(pwd) "$1" readonly
+| | "$1" ${HOME} --verbose grep "$1" && cd 'quoted text' cd test then export
+	$(pwd) "$@" cd "$1" done
+printf test 'quoted text' "$1" "$1" grep -eu /usr/bin $(pwd) grep printf $(pwd)
+		printf sed local local "$@"
+| ${HOME} local | | grep echo /usr/bin then
+--verbose /usr/bin | --verbose sed /usr/bin
+		2>/dev/null local grep "$1" --verbose ${HOME}
+'quoted text' "$1" done echo ${HOME} then $(pwd) 'quoted text' done
+	then test cd then readonly --verbose local "$@" 'quoted text' printf done local
+		--verbose ${HOME} $(pwd) $(pwd) readonly --verbose --verbose
+readonly sed "$@" ${HOME} grep && -eu /usr/bin 2>/dev/null
+	$(pwd) && && printf 2>/dev/null
+cd printf && && "$1" readonly sed --verbose
+	echo x=1 ${HOME} readonly && grep x=1 readonly
+| "$@" ${HOME} printf grep done "$1" awk readonly
+"$@" local test readonly test && x=1 readonly 'quoted text'
+/usr/bin ${HOME} then grep sed
+	"$1" "$@" grep awk then "$1" cd echo then -eu awk echo
+	grep 2>/dev/null x=1 echo 2>/dev/null grep
+	&& 2>/dev/null -eu --verbose
+awk export $(pwd) ${HOME} export readonly
+&& export $(pwd) awk export sed echo readonly sed printf echo && "$1" local
+	$(pwd) $(pwd) /usr/bin printf echo ${HOME} /usr/bin
+	'quoted text' printf done "$@" done /usr/bin cd readonly
+	echo sed done cd "$@" then test sed readonly ${HOME}
+grep export --verbose local && --verbose export
+		then grep x=1 grep test x=1 | "$1" /usr/bin local
+		export ${HOME} cd done local | -eu --verbose
+		readonly readonly export printf export "$@" "$@"
+	"$@" readonly /usr/bin "$1" 2>/dev/null cd ${HOME} && then cd sed
+	grep grep -eu --verbose local /usr/bin echo "$@" readonly cd
+	'quoted text' export 2>/dev/null test | x=1 | 2>/dev/null
+then sed done --verbose then printf "$1" --verbose readonly
+		2>/dev/null 'quoted text'
+	awk 'quoted text' 'quoted text'
+	local && -eu done test printf && printf readonly echo --verbose | sed printf "$@"
+cd test echo cd 'quoted text' --verbose && ${HOME} export /usr/bin printf
+awk 2>/dev/null "$1" && printf
+	'quoted text' "$@" printf echo "$1" $(pwd) readonly
+"$@" --verbose 2>/dev/null "$@" local 'quoted text'
+		cd x=1 test $(pwd) --verbose local grep sed $(pwd) 'quoted text'
+awk /usr/bin awk export awk sed sed "$1" /usr/bin
+&& done then x=1 && test $(pwd) awk local | -eu
+awk cd awk "$@" x=1 grep local "$1" printf "$@" readonly cd awk test --verbose
+		| readonly printf local cd sed readonly "$@" then export grep test printf
+--verbose awk | readonly readonly sed && -eu -eu 'quoted text' 2>/dev/null
+"$1" ${HOME} "$1" -eu sed echo /usr/bin test
+	printf 'quoted text' test done awk export
+		awk x=1 && echo printf done && /usr/bin cd /usr/bin ${HOME} sed test
+| "$@" then awk cd echo && echo "$@" -eu x=1 /usr/bin && "$1" --verbose
+		&& -eu readonly --verbose 'quoted text'
+"$1" grep sed test printf
+		| echo "$@" sed -eu 2>/dev/null | "$1" echo awk 'quoted text'
+2>/dev/null then readonly ${HOME}
+		then "$1" sed x=1 $(pwd) "$@" "$1" export -eu done ${HOME}
+		printf -eu && && ${HOME} echo sed grep $(pwd) then /usr/bin --verbose
+	test ${HOME} sed echo --verbose grep $(pwd) x=1 grep "$1" readonly echo "$1" $(pwd)
+	awk grep then "$1" 2>/dev/null sed export printf --verbose
+	echo test 2>/dev/null && awk
+		$(pwd) /usr/bin test sed local export export 2>/dev/null done "$@"
+-eu export done local awk "$@" 'quoted text' /usr/bin x=1
+${HOME} printf done && printf
+awk 'quoted text' then /usr/bin printf "$@" "$1" | readonly "$1" export x=1
+		x=1 echo 2>/dev/null 'quoted text'
+printf 2>/dev/null && $(pwd) printf 'quoted text' --verbose local
+	sed x=1 /usr/bin cd echo $(pwd) $(pwd) 'quoted text' readonly
+		$(pwd) /usr/bin /usr/bin grep x=1 | "$@" echo cd 2>/dev/null /usr/bin
+	printf cd export /usr/bin
+test "$@" done && printf grep test && x=1 export /usr/bin
+		printf sed /usr/bin -eu $(pwd) "$@" cd ${HOME} ${HOME} export ${HOME}
+		&& readonly --verbose -eu done && export echo x=1 /usr/bin sed $(pwd) grep |
+printf grep done 'quoted text'
+	printf "$1" /usr/bin awk test "$@"
+printf -eu "$@" "$@" sed
+		${HOME} then cd -eu "$1" "$@" done cd && "$@" 2>/dev/null x=1
+	x=1 echo x=1 "$@" done --verbose "$@" 2>/dev/null
+$(pwd) 2>/dev/null "$1" local done --verbose then "$@"
+		export /usr/bin | grep awk cd -eu cd --verbose then | done ${HOME} "$1" && sed
+	local cd ${HOME} && "$1" ${HOME}
+	export "$@" printf test
+		"$1" echo ${HOME} grep sed "$1" 2>/dev/null ${HOME} sed $(pwd)
+done ${HOME} 2>/dev/null cd printf $(pwd) then
+printf readonly sed then x=1 ${HOME} grep grep
+'quoted text' printf
+	$(pwd) | ${HOME} local then x=1 'quoted text'
+	grep "$1" /usr/bin echo printf -eu cd 'quoted text'
+	--verbose "$@" awk test 2>/dev/null local "$@" 'quoted text' sed
+	test export "$@" && test $(pwd) echo then readonly |
+		"$1" $(pwd) awk && "$1" echo -eu test
+awk -eu 'quoted text' printf
+		export done grep local sed cd 'quoted text'
+export grep | "$@" "$1" grep cd 2>/dev/null "$@" "$1" "$1"
+awk export -eu awk "$@" | x=1 --verbose
+readonly export /usr/bin
+		echo local 2>/dev/null test then local --verbose
+2>/dev/null x=1 'quoted text' printf x=1 awk $(pwd) ${HOME} cd --verbose
+	${HOME} local ${HOME} /usr/bin ${HOME} readonly "$1" readonly test echo
+	${HOME} done local /usr/bin --verbose
+	--verbose printf "$1" awk test "$1" "$1" $(pwd)
+	"$@" export ${HOME} echo
+	export /usr/bin x=1 "$@" && --verbose | && done echo
+	done awk 'quoted text' awk echo grep --verbose
+echo local test local
+		"$1" --verbose "$@" /usr/bin --verbose awk /usr/bin cd 'quoted text' then
+printf $(pwd) export 2>/dev/null ${HOME} ${HOME}
+	done then printf grep cd 'quoted text' "$@" x=1 "$1" -eu "$1" test echo
+'quoted text' grep then x=1 then &&
+printf x=1 x=1 x=1 local | export test | $(pwd) echo local /usr/bin sed export ${HOME}
+		--verbose ${HOME} -eu cd && done local sed 2>/dev/null
+	-eu && /usr/bin 'quoted text' export
+sed /usr/bin sed "$@" "$1" done local $(pwd) awk ${HOME} ${HOME} -eu
+| test awk $(pwd) sed echo ${HOME}
+-eu "$1" test "$1" test echo "$@" grep -eu | readonly
+"$@" 'quoted text' x=1 --verbose x=1 ${HOME} export grep
+cd 2>/dev/null ${HOME} test 2>/dev/null test grep "$@" done readonly
+	"$@" $(pwd) | readonly
+	| done --verbose test awk export echo cd export "$@" x=1 cd awk | /usr/bin
+test "$@" "$@" printf grep test export
+	export -eu x=1 test sed echo printf export ${HOME} "$@" -eu then
+	local 'quoted text' awk && awk readonly "$@" readonly && done sed "$1"
+		'quoted text' done "$1" ${HOME} -eu cd | --verbose
+	local awk cd | export readonly local 'quoted text' "$1" grep
+/usr/bin done grep then 'quoted text' done
+done export done && ${HOME} test cd && done grep 2>/dev/null grep --verbose ${HOME}
+		--verbose && /usr/bin then export local
+		local | then $(pwd) sed then && awk readonly cd
+		printf "$1" readonly readonly ${HOME}
+x=1 --verbose x=1 local done export 'quoted text'
+	printf then local grep echo then done echo sed -eu 'quoted text' awk --verbose
+		test 'quoted text' readonly readonly local $(pwd) 2>/dev/null
+		done "$@" 2>/dev/null $(pwd) && "$1" /usr/bin -eu export sed
+--verbose readonly -eu "$1" sed sed "$@" grep
+-eu printf local x=1 $(pwd) x=1 then 'quoted text'
+	| printf local /usr/bin local -eu echo 'quoted text' local test
+	$(pwd) local cd done /usr/bin cd --verbose 'quoted text'
+	then "$1" local && && --verbose done grep printf awk cd grep awk cd
+	export then | | done sed --verbose ${HOME} sed &&
+		done awk then --verbose /usr/bin then grep "$@" x=1 2>/dev/null awk awk done
+	echo done sed -eu test 2>/dev/null | export awk 'quoted text' sed "$@"
+	-eu /usr/bin 2>/dev/null 2>/dev/null
+		export 'quoted text' export
+| sed /usr/bin x=1 -eu && done -eu cd printf then cd awk done | && sed
+	test local sed grep local 2>/dev/null local test local "$@" test
+		readonly && test awk awk
+	printf printf then echo awk x=1 && sed && 2>/dev/null
+	awk printf echo --verbose -eu export echo cd && cd -eu sed 'quoted text' then echo
+	local sed export "$@" cd "$@" sed -eu
+| test sed echo -eu sed sed printf 'quoted text'
+${HOME} -eu then x=1 printf export | 2>/dev/null
+	--verbose grep echo echo "$@" | local && /usr/bin x=1 awk
+		done then x=1 "$@" export export "$@" awk ${HOME} | x=1 printf test
+		echo then then 'quoted text' x=1 readonly test
+		sed ${HOME} printf local local $(pwd) 'quoted text'
+-eu echo readonly 'quoted text'
+		2>/dev/null -eu grep "$1" printf ${HOME} "$1" local cd 'quoted text' echo
+		printf /usr/bin -eu export $(pwd) "$1" /usr/bin
+/usr/bin test awk test export "$@" grep sed "$1" echo then
+"$@" | 'quoted text' 'quoted text' x=1 cd done "$1" done
+| $(pwd) "$1" printf $(pwd) | 'quoted text' $(pwd) $(pwd) then | | export
+'quoted text' -eu readonly ${HOME} "$1" "$1" cd x=1 cd ${HOME} awk "$@" export
+	then | export done echo test -eu "$@" cd --verbose grep x=1 cd done
+		then local printf 2>/dev/null printf "$1" "$1" "$1"
+		done $(pwd) sed --verbose "$@" && $(pwd) sed 2>/dev/null "$@" /usr/bin echo ${HOME}
+printf "$@" printf done "$1"
+		sed "$1" printf --verbose grep $(pwd) awk 2>/dev/null cd cd then cd 'quoted text'
+&& | readonly 'quoted text' | done 2>/dev/null then -eu cd "$1"
+		'quoted text' test 2>/dev/null local $(pwd)
+	sed echo test 2>/dev/null -eu
+		test readonly local --verbose cd
+	x=1 cd test --verbose --verbose test
+	echo awk "$1" "$@" "$@" readonly
+cd && -eu 'quoted text' 2>/dev/null
+-eu readonly --verbose -eu grep export && ${HOME} readonly 'quoted text'
+2>/dev/null readonly then readonly printf awk "$@"
+printf grep export $(pwd)
+	readonly --verbose "$1" cd -eu
+"$@" then -eu then local "$1" done 2>/dev/null test
+"$@" && grep && awk /usr/bin cd "$1" echo 2>/dev/null
+		export --verbose "$1" --verbose 2>/dev/null | "$@" local "$1" --verbose
+		2>/dev/null --verbose grep "$1" ${HOME} "$1"
+echo x=1 cd sed grep ${HOME}
+		2>/dev/null echo "$@" /usr/bin export test printf --verbose then 2>/dev/null
+	x=1 cd $(pwd) "$1" --verbose
+x=1 done echo readonly then "$1" done local |
+		readonly echo sed export /usr/bin printf | echo
+	'quoted text' test && cd readonly
+local /usr/bin export ${HOME} test then -eu "$@" cd /usr/bin
+	&& cd grep test awk 2>/dev/null echo $(pwd) test "$@" readonly "$@" done
+	local x=1 printf 'quoted text'
+		printf $(pwd) awk readonly
+-eu "$@" then 'quoted text' "$@" test "$@" grep ${HOME} export
+$(pwd) local readonly x=1 "$1" ${HOME} /usr/bin --verbose sed local 2>/dev/null
+sed 'quoted text' $(pwd) "$@" 'quoted text'
+then echo export done done export printf echo awk $(pwd)
+		${HOME} /usr/bin done
+		&& ${HOME} x=1 echo "$@" --verbose readonly local -eu grep export -eu readonly printf
+	printf /usr/bin -eu test export $(pwd)
+	local "$@" readonly grep done test && awk "$1" && 'quoted text' ${HOME}
+done export grep readonly test readonly 2>/dev/null -eu "$1" 2>/dev/null "$1"
+	test echo -eu | ${HOME}
+		sed then test printf awk x=1 printf 'quoted text'
+	x=1 then sed /usr/bin then
+		done x=1 readonly && then
+export awk echo sed -eu local export --verbose "$1" local
+2>/dev/null $(pwd) done 2>/dev/null
+readonly readonly sed cd "$@"
+		x=1 readonly local && -eu -eu && /usr/bin /usr/bin "$1" "$@" echo
+then | awk readonly printf local -eu grep local printf awk --verbose
+		-eu | && -eu --verbose awk export awk sed
+	awk printf export x=1 2>/dev/null && test && | echo done $(pwd) --verbose
+		2>/dev/null echo 'quoted text' export ${HOME} grep 'quoted text'
+	"$1" readonly ${HOME} "$1" export echo /usr/bin
+printf sed export x=1 echo cd sed "$@" "$1" x=1 cd export $(pwd) --verbose --verbose
+${HOME} sed x=1 $(pwd) ${HOME} awk && awk done printf
+		echo | export ${HOME} test $(pwd) /usr/bin ${HOME} -eu --verbose
+printf readonly echo --verbose "$1" export 'quoted text' awk printf
+		--verbose sed awk readonly x=1 sed ${HOME}
+	grep printf 'quoted text'
+export -eu --verbose "$@" -eu /usr/bin done awk && -eu test grep
+cd done grep | $(pwd) 2>/dev/null cd | then printf export then echo 'quoted text'
+export | "$@" done /usr/bin x=1 "$1" x=1 'quoted text'
+		&& then awk "$1" /usr/bin local cd --verbose x=1 awk "$@" --verbose
+readonly "$@" local --verbose --verbose test sed 2>/dev/null && test
+	x=1 "$1" cd cd | $(pwd) test done --verbose export
+x=1 local cd $(pwd) printf sed sed printf
+cd ${HOME} export sed && 'quoted text'
+	| test export && grep readonly
+	${HOME} -eu sed "$1" grep done "$1" printf
+	$(pwd) $(pwd) awk 'quoted text' awk export grep -eu printf x=1 $(pwd)
+		"$1" readonly done 2>/dev/null done
+		export 2>/dev/null $(pwd)
+		"$@" local /usr/bin ${HOME} "$1" /usr/bin x=1 $(pwd) x=1 /usr/bin
+	2>/dev/null grep cd export $(pwd) /usr/bin --verbose -eu awk readonly 2>/dev/null
+		--verbose then 'quoted text' sed -eu /usr/bin grep done x=1 2>/dev/null
+-eu "$1" $(pwd) done echo sed | "$1"
+	--verbose | /usr/bin |
+/usr/bin "$@" awk | "$1" 'quoted text' ${HOME} -eu --verbose
+	"$@" | 'quoted text' export 'quoted text' cd then | grep printf && && printf
+		-eu "$1" && -eu 2>/dev/null -eu -eu ${HOME}
+then local local done sed 2>/dev/null
+echo --verbose -eu | | echo done awk x=1 ${HOME} -eu "$@" --verbose ${HOME}
+done then grep cd x=1 printf
+sed -eu --verbose --verbose
+	2>/dev/null "$1" "$@" awk 2>/dev/null test local
+echo done /usr/bin printf "$@" printf 2>/dev/null readonly
+'quoted text' -eu --verbose local sed ${HOME} "$@" export
+		sed /usr/bin 2>/dev/null sed ${HOME} then readonly
+	local grep ${HOME} -eu && then then sed --verbose export | echo ${HOME} "$1" 'quoted text'
+cd cd done 2>/dev/null export -eu
+	export echo "$@" printf awk awk grep x=1 awk |
+	2>/dev/null cd -eu "$@" /usr/bin && |
+then local -eu echo && awk
+	$(pwd) export then sed export "$@" awk /usr/bin cd grep local 'quoted text' &&
+	'quoted text' x=1 printf echo $(pwd) grep export then readonly
+	test grep local /usr/bin cd && local then
+	-eu cd awk grep awk "$@" then ${HOME} $(pwd) 2>/dev/null "$@" printf 'quoted text'
+		2>/dev/null local cd 'quoted text' 'quoted text'
+		-eu $(pwd) 2>/dev/null -eu printf export 2>/dev/null $(pwd) 2>/dev/null awk local
+grep awk readonly | local ${HOME} 2>/dev/null then readonly "$1" 2>/dev/null
+done printf echo 2>/dev/null 'quoted text' 'quoted text' $(pwd) "$1" done readonly
+	| | sed 'quoted text' sed cd ${HOME}
+readonly export 2>/dev/null then
+&& local x=1 cd export ${HOME} readonly | echo && local
+		${HOME} readonly local readonly ${HOME} $(pwd) && test test test --verbose
+		then "$1" export readonly && cd printf grep /usr/bin echo
+		&& printf ${HOME} /usr/bin export then "$1" && printf printf
+	${HOME} sed done --verbose then "$@" export readonly awk test "$@" awk
+		sed then sed echo echo then cd grep echo
+	sed $(pwd) "$@" cd printf "$1" && cd cd -eu grep 2>/dev/null
+		local then test 2>/dev/null sed /usr/bin
+	2>/dev/null cd then --verbose done echo test --verbose awk "$@" done
+printf awk printf awk x=1 grep echo export 2>/dev/null printf local test ${HOME}
+	printf && sed 'quoted text'
+readonly local done && local $(pwd) then cd local /usr/bin | readonly
+		x=1 local 2>/dev/null /usr/bin 2>/dev/null
+		"$1" echo then readonly readonly -eu $(pwd) printf printf export --verbose cd sed
+	test awk && readonly x=1 && then 'quoted text' test
+		awk "$1" export awk $(pwd)
+		2>/dev/null local 'quoted text' ${HOME}
+	--verbose | grep -eu cd echo export --verbose
+	done awk | ${HOME} | "$1" awk export cd -eu
+		| --verbose "$1" "$1" local "$@" 2>/dev/null cd export sed && echo
+		$(pwd) | -eu done readonly printf test $(pwd) "$@" 2>/dev/null then --verbose
+	"$1" sed awk | /usr/bin ${HOME} echo test x=1 cd echo "$@" echo
+		awk 'quoted text' --verbose done "$1" x=1 then echo x=1 /usr/bin
+		readonly | awk then --verbose $(pwd)
+test --verbose awk && 2>/dev/null cd --verbose | "$1" --verbose awk printf
+		-eu "$@" && $(pwd) test 2>/dev/null export x=1 && readonly "$1" done $(pwd)
+		--verbose export sed echo 2>/dev/null $(pwd) "$1"
+readonly then sed sed
+	'quoted text' then printf grep | test "$1" "$@"
+	cd cd local sed export readonly readonly ${HOME} sed printf done then && local
+done awk then $(pwd) test export &&
+| "$1" test /usr/bin cd -eu readonly readonly readonly printf local
+		grep x=1 -eu sed done x=1 export 'quoted text' "$1" | "$1" "$@" awk
+		"$@" awk readonly local /usr/bin && printf x=1 export
+export sed done "$1" readonly cd cd --verbose -eu then local then 'quoted text'
+2>/dev/null echo done && -eu -eu grep cd && "$@" local -eu "$1" &&
+	$(pwd) local && --verbose done /usr/bin then -eu -eu then x=1
+awk awk readonly echo x=1 cd $(pwd) printf 2>/dev/null then -eu | readonly
+export export | "$1" readonly
+		${HOME} awk done then
+	'quoted text' printf && /usr/bin /usr/bin readonly
+--verbose test /usr/bin "$@" --verbose awk echo 2>/dev/null
+	| export echo sed | $(pwd) 2>/dev/null -eu $(pwd) done echo
+		--verbose done echo echo --verbose $(pwd) --verbose --verbose awk readonly printf
+	printf local readonly -eu -eu printf echo printf test local
+	awk && --verbose sed then $(pwd) "$@" --verbose -eu ${HOME}
+"$1" done x=1 'quoted text' --verbose
+${HOME} $(pwd) -eu x=1 &&
+		'quoted text' 'quoted text' 2>/dev/null
+		printf grep --verbose awk then echo "$1" readonly /usr/bin done then echo
+		test awk then x=1 'quoted text' test --verbose "$1" echo
+		$(pwd) "$1" ${HOME} -eu x=1 done readonly done awk cd then 2>/dev/null $(pwd)
+	$(pwd) $(pwd) test | 2>/dev/null --verbose "$@"
+readonly "$@" echo $(pwd) done -eu x=1 -eu 2>/dev/null x=1 export
+		2>/dev/null cd /usr/bin readonly
+	printf 2>/dev/null x=1 local awk "$@" echo cd readonly test
+	printf && sed && "$1" printf --verbose x=1
+		grep "$@" | export printf readonly
+		test test done $(pwd) ${HOME} grep cd | export "$1" x=1 && $(pwd) grep ${HOME}
+		$(pwd) 2>/dev/null 2>/dev/null 2>/dev/null printf | | | readonly && && "$@" echo
+	cd echo x=1 done done export done 2>/dev/null ${HOME} printf local cd "$@"
+echo $(pwd) export --verbose | awk && test local && 'quoted text' awk $(pwd)
+	"$@" readonly -eu readonly 2>/dev/null export
+		grep 2>/dev/null cd $(pwd)
+		"$1" local $(pwd) 2>/dev/null
+${HOME} readonly "$1" --verbose
+	| done x=1 x=1 "$@" /usr/bin | ${HOME} $(pwd) printf -eu && awk
+		$(pwd) test | cd test $(pwd) 'quoted text' readonly
+	done awk "$@" x=1 sed then local "$1" echo "$1" local printf x=1
+	2>/dev/null echo "$@" cd echo cd /usr/bin echo test -eu | readonly
+		printf test echo readonly 'quoted text' && printf export
+done $(pwd) 2>/dev/null "$@" readonly 2>/dev/null x=1 -eu awk grep printf
+	${HOME} cd "$@" echo --verbose -eu done cd then --verbose 'quoted text'
+"$1" && export readonly -eu
+/usr/bin cd "$@" echo echo export awk | 2>/dev/null 'quoted text'
+/usr/bin "$1" "$1" done -eu printf
+		readonly --verbose grep 'quoted text'
+		"$@" --verbose | 2>/dev/null -eu /usr/bin local
+		local echo then readonly x=1 cd export x=1 sed 2>/dev/null
+	-eu done 2>/dev/null readonly
+		test "$@" /usr/bin "$@" x=1 done 'quoted text' $(pwd) "$1" -eu cd
+test export $(pwd) "$@" -eu /usr/bin sed printf 'quoted text'
+-eu sed done grep export sed echo done "$1" printf "$1" /usr/bin 2>/dev/null "$@"
+2>/dev/null $(pwd) x=1 export 'quoted text' && && cd x=1 readonly
+	export -eu -eu cd done local cd sed -eu sed 'quoted text' 'quoted text'
+		&& readonly --verbose -eu awk 'quoted text' then
+x=1 x=1 sed export | done 'quoted text'
+	-eu x=1 "$1" "$1" | && x=1 readonly local --verbose 'quoted text' /usr/bin 'quoted text'
+		"$@" 'quoted text' cd local
+/usr/bin sed sed "$@" cd --verbose
+"$1" 'quoted text' test awk 'quoted text'
+	echo awk -eu awk done 2>/dev/null
+		"$@" | sed x=1 cd $(pwd) local local readonly printf "$1"
+local printf "$1" echo "$@" local then awk readonly x=1 'quoted text'
+		done "$@" ${HOME} echo readonly x=1 done "$1" && test readonly
+"$@" "$@" test local $(pwd)
+$(pwd) /usr/bin | then grep
+	&& awk /usr/bin 'quoted text' readonly --verbose local "$1" x=1 export sed ${HOME}
+		readonly $(pwd) /usr/bin
+		test readonly then printf done "$1" awk --verbose grep "$1" ${HOME}
+		export grep /usr/bin $(pwd) && export test grep /usr/bin
+	--verbose grep echo ${HOME}
+		/usr/bin /usr/bin -eu cd cd then && sed then
+	&& | local awk 'quoted text' then readonly
+		sed /usr/bin "$1" cd grep $(pwd) printf local cd 'quoted text' x=1 "$1" $(pwd)
+readonly echo done then printf sed "$@" "$1" done sed cd | "$1" cd && export /usr/bin
+awk $(pwd) ${HOME} readonly "$1" /usr/bin ${HOME}
+		readonly readonly /usr/bin done x=1 then --verbose
+		--verbose "$1" export grep readonly | done grep "$1"
+		2>/dev/null local readonly $(pwd) "$@" "$@" "$1"
+sed -eu then cd test grep x=1 2>/dev/null printf printf echo sed "$@" cd ${HOME}
+		"$1" grep echo && /usr/bin export
+	"$@" export && --verbose grep sed $(pwd) | cd readonly
+2>/dev/null cd $(pwd) "$@" readonly /usr/bin local
+		${HOME} local /usr/bin 2>/dev/null /usr/bin
+		--verbose -eu readonly done
+$(pwd) printf 'quoted text' | "$@" sed && $(pwd)
+local "$@" local readonly done && -eu 2>/dev/null
+		${HOME} export then 2>/dev/null cd
+	$(pwd) local test x=1 "$1" then then -eu echo 'quoted text'
+"$@" printf done grep -eu /usr/bin --verbose export -eu echo "$1" export
+		${HOME} test $(pwd) &&
+	echo /usr/bin local echo 2>/dev/null ${HOME} -eu printf echo /usr/bin
+		readonly done && awk local echo --verbose --verbose
+	echo 2>/dev/null 2>/dev/null --verbose x=1 grep echo 'quoted text'
+	2>/dev/null x=1 ${HOME} "$@"
+		"$1" printf 'quoted text' --verbose ${HOME} && x=1 --verbose $(pwd)
+printf readonly export "$1" local sed
+${HOME} /usr/bin readonly export readonly 'quoted text' echo --verbose --verbose
+		&& x=1 --verbose local | 'quoted text' echo printf done 2>/dev/null
+		| $(pwd) printf --verbose done /usr/bin awk done printf
+		grep awk local grep then local done | echo -eu done
+		awk "$1" then "$1" done && /usr/bin $(pwd) /usr/bin
+test && "$1" echo grep readonly ${HOME}
+	cd test awk then export awk --verbose &&
+	readonly "$1" && ${HOME} ${HOME}
+		| /usr/bin awk readonly grep readonly /usr/bin done printf then ${HOME}
+	/usr/bin && sed && 2>/dev/null export readonly
+done test grep "$@" "$@" /usr/bin cd 2>/dev/null done done
+		| done /usr/bin echo --verbose /usr/bin readonly test
+	2>/dev/null done echo
+	${HOME} readonly export grep | ${HOME} awk printf
+	--verbose cd 2>/dev/null "$@" ${HOME} $(pwd) ${HOME} export printf readonly x=1
+	echo grep test then $(pwd)
+	export echo echo local && $(pwd) x=1 'quoted text' 2>/dev/null
+		${HOME} && "$1" --verbose done readonly 2>/dev/null
+x=1 x=1 x=1 "$@" local then grep cd
+		/usr/bin "$1" awk test $(pwd) "$1" $(pwd) awk /usr/bin
+	/usr/bin awk $(pwd) grep && awk done --verbose
+	then then x=1 -eu grep /usr/bin "$@" /usr/bin
+| local && sed done grep done x=1 sed grep && then x=1 && x=1 ${HOME} export
+	-eu grep done sed x=1 -eu | && ${HOME} export printf --verbose
+		awk && $(pwd) done printf x=1 cd && $(pwd) done --verbose done grep
+		-eu 'quoted text' sed -eu awk 2>/dev/null printf
+		sed --verbose && | && cd readonly --verbose then test printf printf export
+	/usr/bin x=1 -eu "$@" -eu test
+| --verbose 'quoted text' ${HOME} printf --verbose
+awk | /usr/bin "$@" echo /usr/bin ${HOME} -eu done
+		"$@" done test export sed printf
+	'quoted text' x=1 printf "$@" echo && export echo ${HOME} x=1 echo
+		local ${HOME} "$1" local cd 'quoted text'
+export done "$@" "$1" readonly && -eu local 2>/dev/null "$1" readonly
+readonly && $(pwd) local export 'quoted text' | cd grep test
+		readonly grep && printf export awk test -eu ${HOME}
+	echo 2>/dev/null /usr/bin $(pwd)
+printf echo local ${HOME} grep $(pwd)
+	export "$@" --verbose grep
+		printf readonly /usr/bin grep -eu $(pwd) export "$1"
+	local grep cd then 2>/dev/null
+		then -eu -eu grep && | cd && --verbose --verbose done "$1" 'quoted text' /usr/bin
+sed awk && x=1 /usr/bin "$@" grep $(pwd) /usr/bin "$@" && "$@" -eu echo $(pwd) done
+	echo echo local printf | "$@" sed "$1" /usr/bin awk && --verbose && 'quoted text'
+	test ${HOME} readonly done
+| ${HOME} cd echo && sed ${HOME} -eu done
+	awk printf -eu cd echo --verbose
+	$(pwd) --verbose printf | test echo x=1 x=1 x=1
+		readonly ${HOME} printf /usr/bin ${HOME}
+readonly -eu printf | local echo x=1 done $(pwd) | "$1" export
+		-eu done then --verbose && then && "$1" /usr/bin --verbose cd echo
+local && "$@" done done --verbose | "$@" ${HOME}
+x=1 then printf /usr/bin printf then "$1" &&
+	'quoted text' /usr/bin awk "$1" 2>/dev/null x=1 then
+$(pwd) ${HOME} done done readonly 'quoted text'
+		export done "$@" ${HOME} /usr/bin ${HOME} local /usr/bin
+	2>/dev/null cd echo test /usr/bin x=1 done cd local then done readonly test "$@"
+	export then $(pwd) awk done && "$@" then then x=1 local
+		'quoted text' sed | /usr/bin grep
+		echo | 2>/dev/null 2>/dev/null
+		'quoted text' $(pwd) done && then echo "$@" export grep test $(pwd)
+		x=1 done 2>/dev/null --verbose printf
+	printf test grep $(pwd) "$1" --verbose "$1" 2>/dev/null export awk done test
+		--verbose grep grep x=1 | done ${HOME} ${HOME} cd then -eu readonly
+		| -eu "$1" --verbose grep readonly
+		echo echo awk --verbose readonly local 'quoted text'
+	"$@" readonly ${HOME} ${HOME}
+done 2>/dev/null x=1 then local x=1 /usr/bin echo "$1" "$1" grep printf
+		"$1" -eu export --verbose done | "$1" grep x=1 export
+		sed local | 'quoted text' awk --verbose "$@" done | test ${HOME}
+	&& then readonly test /usr/bin grep awk && test export local ${HOME} x=1
+		2>/dev/null /usr/bin local -eu ${HOME} then ${HOME}
+'quoted text' local -eu sed --verbose echo sed $(pwd) && grep $(pwd)
+	cd --verbose x=1 -eu then
+	then readonly grep && x=1 "$@"
+	"$@" printf $(pwd) sed --verbose echo
+		'quoted text' sed "$1" 2>/dev/null 'quoted text' echo "$1"
+		| "$@" test awk 2>/dev/null "$@"
+	| 2>/dev/null printf export cd cd --verbose x=1 |
+		readonly && && --verbose
+	export 'quoted text' printf test -eu export done done /usr/bin ${HOME}
+done $(pwd) grep x=1 local cd | grep -eu -eu export $(pwd) | test
+--verbose 2>/dev/null grep ${HOME} ${HOME} echo "$1" x=1 test
+$(pwd) 2>/dev/null then --verbose /usr/bin local done /usr/bin | 2>/dev/null
+--verbose | | && $(pwd) export test "$1" done 'quoted text' echo readonly
+'quoted text' readonly 'quoted text'
+		${HOME} -eu cd x=1 --verbose /usr/bin printf x=1 readonly
+		awk 2>/dev/null echo "$@" x=1 sed && && export
+	-eu -eu cd test ${HOME} cd then printf --verbose printf then $(pwd)
+	x=1 grep -eu sed readonly cd "$1" cd echo then cd x=1 --verbose export
+x=1 ${HOME} -eu "$1" 2>/dev/null awk | 'quoted text' grep 'quoted text'
+		awk local grep | echo 2>/dev/null $(pwd) then --verbose
+test sed 2>/dev/null local echo test /usr/bin 2>/dev/null ${HOME} | then
+"$@" local 'quoted text' grep readonly
+	readonly then | ${HOME} -eu $(pwd) grep
+	test --verbose export ${HOME} grep test 2>/dev/null ${HOME} | /usr/bin grep "$1"
+		done && local local $(pwd) local sed ${HOME} ${HOME}
+	&& $(pwd) test then -eu
+	2>/dev/null then ${HOME} /usr/bin $(pwd) "$@" grep test /usr/bin
+local readonly --verbose grep --verbose readonly | --verbose "$1"
+"$@" && cd awk 2>/dev/null printf -eu && "$@" readonly $(pwd) "$@" 2>/dev/null readonly
+--verbose test test echo 'quoted text' -eu
+	--verbose "$1" ${HOME} 'quoted text' test then then -eu echo $(pwd)
+	-eu ${HOME} ${HOME} done local sed echo done echo
+2>/dev/null /usr/bin then cd grep printf then 2>/dev/null cd "$@"
+&& cd readonly test test sed cd --verbose
+awk "$@" x=1 $(pwd) x=1 echo 'quoted text' -eu
+/usr/bin /usr/bin readonly --verbose
+grep printf x=1 'quoted text' awk awk test
+		"$1" test cd && "$@" grep | 'quoted text' /usr/bin
+	"$@" local sed then done done "$@" readonly /usr/bin | test
+		awk grep ${HOME} ${HOME} "$1" /usr/bin echo test
+$(pwd) test | $(pwd) awk 'quoted text' ${HOME} 'quoted text' grep done
+	local test --verbose awk grep | cd "$@" done readonly
+then test 'quoted text' "$1" grep && readonly test /usr/bin
+		${HOME} local export "$1" 'quoted text' awk then export
+		-eu done done then echo "$@" readonly
+	2>/dev/null ${HOME} export test cd 2>/dev/null
+	${HOME} 'quoted text' "$@" readonly "$1"
+		"$@" awk && | test x=1 2>/dev/null && && && --verbose
+		"$1" export readonly test then | local grep
+&& /usr/bin "$@" $(pwd) -eu $(pwd) /usr/bin readonly done cd then
+	grep export "$@" echo
+	local -eu export sed --verbose echo "$1" done readonly
+		readonly done awk "$@" "$1" && readonly
+	'quoted text' x=1 echo && printf awk
+	printf export -eu -eu /usr/bin "$@" 'quoted text'
+2>/dev/null test 'quoted text' 'quoted text'
+done "$1" readonly export sed ${HOME} test export 2>/dev/null
+awk $(pwd) sed readonly $(pwd) then 'quoted text' printf
+-eu -eu readonly awk /usr/bin awk ${HOME} 'quoted text'
+	"$@" done awk echo readonly test -eu echo readonly $(pwd) "$@" grep
+2>/dev/null awk --verbose local $(pwd) /usr/bin x=1 'quoted text'
+local echo x=1 'quoted text' "$@"
+		/usr/bin && | sed | sed $(pwd) /usr/bin $(pwd) readonly grep
+		printf $(pwd) done x=1 -eu | export
+	${HOME} echo x=1 printf "$@" then 'quoted text' /usr/bin
+test 'quoted text' && cd awk x=1 ${HOME} sed --verbose
+printf sed | grep "$@" --verbose printf /usr/bin -eu 2>/dev/null echo printf
+'quoted text' echo 'quoted text' readonly grep
+export then x=1 x=1 ${HOME} x=1 export echo | $(pwd) "$1"
+2>/dev/null && "$1" then test awk 'quoted text' $(pwd) sed
+x=1 'quoted text' ${HOME} echo -eu sed --verbose
+		printf local grep x=1 test --verbose ${HOME} ${HOME} x=1 -eu
+		"$1" sed cd grep 'quoted text' "$@" "$@" 2>/dev/null test local
+	awk printf readonly --verbose printf grep /usr/bin && "$1" awk --verbose
+| x=1 grep cd sed --verbose grep echo x=1 test /usr/bin | printf done grep | "$1"
+--verbose $(pwd) local 'quoted text'
+		grep local export /usr/bin -eu ${HOME} "$1"
+		export 'quoted text' 'quoted text' "$@" /usr/bin readonly grep
+		grep /usr/bin 'quoted text' 2>/dev/null grep 'quoted text' cd local -eu
+		cd 2>/dev/null done test "$@"
+	${HOME} grep test x=1 -eu -eu echo "$@" export /usr/bin "$1" "$1" &&
+		then x=1 readonly 'quoted text' 2>/dev/null grep test 2>/dev/null
+'quoted text' ${HOME} 2>/dev/null | 'quoted text'
+		test --verbose test $(pwd) 2>/dev/null local readonly sed && done awk
+		&& export sed grep /usr/bin printf local
+	x=1 "$1" sed 2>/dev/null
+	test -eu cd printf done ${HOME} local then
+	grep sed "$@" done test x=1 awk 2>/dev/null $(pwd) cd ${HOME}
+		local grep grep ${HOME} --verbose
+		&& awk sed grep $(pwd) $(pwd) "$1"
+	$(pwd) sed echo /usr/bin --verbose /usr/bin echo awk export
+	done export $(pwd) echo "$1" x=1 "$@" --verbose "$@" x=1 'quoted text' echo | export
+"$1" awk echo grep sed ${HOME}
+		grep /usr/bin | done done 2>/dev/null readonly
+	$(pwd) export sed "$1" local then readonly
+		/usr/bin printf readonly
+		export local readonly ${HOME} cd export export
+readonly --verbose -eu && export local | -eu printf
+		"$1" /usr/bin && local 'quoted text' grep readonly
+	"$@" "$@" then sed awk -eu printf "$1" readonly |
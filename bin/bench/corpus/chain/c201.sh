@@ -0,0 +1,2001 @@
+		"$@" readonly echo /usr/bin export --verbose /usr/bin 2>/dev/null
+		&& --verbose 'quoted text' printf local --verbose local awk $(pwd) test awk export
+then export cd awk "$@" /usr/bin
+done -eu "$1" $(pwd) readonly "$1" export "$1" awk -eu local sed
+| $(pwd) then sed | local /usr/bin 2>/dev/null
+		"$1" readonly awk local printf
+	printf printf local awk 'quoted text'
+readonly readonly /usr/bin | export export readonly
+		then /usr/bin awk grep test sed --verbose
+	/usr/bin cd x=1 export awk ${HOME} export "$@" | "$@" $(pwd) echo
+		grep ${HOME} $(pwd) readonly grep echo ${HOME} done "$@" sed printf local -eu
+test --verbose echo sed x=1 sed "$1" "$@" && "$@" /usr/bin
+		x=1 export /usr/bin $(pwd) awk 2>/dev/null --verbose local x=1 "$@" local
+	&& grep 2>/dev/null "$@" $(pwd) "$1" 2>/dev/null
+	2>/dev/null $(pwd) -eu -eu printf
+		local sed grep /usr/bin x=1 | export local --verbose awk readonly $(pwd)
+	sed echo test printf -eu ${HOME} readonly
+	readonly export export "$1" /usr/bin done echo --verbose echo ${HOME} | local
+done readonly then sed export export -eu ${HOME}
+/usr/bin printf 'quoted text' done && 2>/dev/null --verbose printf
+		/usr/bin 'quoted text' 'quoted text' /usr/bin "$1" ${HOME} readonly
+		"$1" "$1" local "$@" cd | then cd x=1 then readonly
+	sed 2>/dev/null && --verbose awk readonly | cd -eu
+		| && export sed x=1 /usr/bin printf done readonly printf ${HOME}
+	/usr/bin "$1" test done
+	readonly 2>/dev/null then "$@" local
+	&& /usr/bin grep awk local echo echo /usr/bin /usr/bin 'quoted text' cd echo echo
+${HOME} then readonly &&
+done --verbose $(pwd)
+		done sed grep cd 2>/dev/null local export 2>/dev/null
+grep "$@" export $(pwd) x=1 ${HOME}
+	${HOME} local test cd cd $(pwd) local
+		"$@" test 'quoted text' ${HOME} 'quoted text' && ${HOME} readonly ${HOME} printf
+		local cd grep test then test test 2>/dev/null readonly
+cd grep cd /usr/bin done readonly
+grep && done "$1" -eu
+	then ${HOME} /usr/bin &&
+	-eu --verbose x=1 grep "$@" readonly "$@" sed cd "$@" ${HOME}
+	awk ${HOME} 2>/dev/null ${HOME}
+export cd echo /usr/bin && test then
+		${HOME} sed -eu 2>/dev/null $(pwd) ${HOME} "$@" | $(pwd)
+		| local "$1" $(pwd) "$@"
+--verbose then sed && "$1" 2>/dev/null 'quoted text' -eu sed cd /usr/bin ${HOME}
+then echo x=1 && | ${HOME} 2>/dev/null then &&
+-eu x=1 echo awk -eu 2>/dev/null export
+	awk awk && && -eu | local 2>/dev/null
+--verbose "$1" local "$1" readonly $(pwd) "$@" readonly
+	test 'quoted text' local && done $(pwd) | then
+	local 'quoted text' cd sed "$1" awk echo && test local cd done 2>/dev/null
+| -eu echo cd grep local readonly -eu && "$@" x=1 echo test x=1 "$@"
+readonly "$@" && x=1 sed && "$1" "$@"
+	export && "$@" readonly /usr/bin
+		printf local -eu cd | awk | && 'quoted text' sed cd "$1" export local export then
+		printf "$@" echo local local printf export | -eu -eu $(pwd) printf cd export
+2>/dev/null $(pwd) 'quoted text' ${HOME}
+		readonly 2>/dev/null --verbose x=1 2>/dev/null -eu
+2>/dev/null 2>/dev/null $(pwd) done echo test readonly local /usr/bin export
+		then echo done && 2>/dev/null ${HOME} $(pwd) export awk $(pwd) export /usr/bin
+cd $(pwd) --verbose readonly
+		cd test ${HOME} 2>/dev/null x=1 'quoted text' -eu
+		&& readonly awk x=1 --verbose -eu local x=1 awk printf
+	test readonly readonly -eu echo $(pwd)
+		then local x=1 2>/dev/null
+		-eu cd local awk && -eu | echo done && --verbose /usr/bin
+	| grep -eu x=1 && then 2>/dev/null
+	awk 2>/dev/null test 2>/dev/null
+		printf awk then echo /usr/bin then -eu sed
+		done "$@" 'quoted text' printf ${HOME}
+	${HOME} awk && /usr/bin | x=1
+		&& /usr/bin 'quoted text' local &&
+&& local "$@" test 'quoted text'
+		then grep && awk "$1" export "$1" x=1 local
+	$(pwd) "$1" printf export 'quoted text' $(pwd) export /usr/bin ${HOME}
+	&& readonly readonly -eu export "$1" 2>/dev/null local
+	"$1" "$@" --verbose "$@" ${HOME}
+&& done export | -eu "$1" readonly /usr/bin readonly cd x=1 test
+	&& readonly 2>/dev/null
+		"$@" cd | export printf export
+	"$@" sed export echo 2>/dev/null printf && "$1"
+		local printf local 2>/dev/null /usr/bin local export --verbose "$@" ${HOME} cd
+--verbose $(pwd) "$1" x=1
+		/usr/bin ${HOME} readonly awk printf x=1 done sed && printf $(pwd) ${HOME}
+| x=1 test x=1 sed x=1 printf done --verbose awk sed $(pwd) /usr/bin done ${HOME}
+--verbose awk "$@" | ${HOME} | printf 'quoted text' sed
+	test readonly 'quoted text' then && export
+test printf export x=1 --verbose 'quoted text' x=1 readonly &&
+	test export | && grep grep
+echo sed --verbose awk readonly /usr/bin | done /usr/bin
+		x=1 local /usr/bin grep -eu
+		readonly readonly then ${HOME}
+$(pwd) "$1" grep sed x=1 ${HOME} | test -eu x=1
+	x=1 'quoted text' echo cd grep echo x=1 sed x=1
+--verbose done done $(pwd) awk done echo /usr/bin
+		export "$@" --verbose x=1 --verbose "$1" | && -eu local awk then test && then then
+	grep 2>/dev/null "$1" sed readonly readonly ${HOME} -eu --verbose |
+		done then $(pwd) 2>/dev/null
+-eu "$1" --verbose "$@" && --verbose sed
+		export 'quoted text' | /usr/bin printf sed sed printf readonly | grep
+		grep echo done $(pwd) grep -eu cd local ${HOME} export then
+	2>/dev/null sed -eu 'quoted text' "$1" readonly
+	done readonly local $(pwd) sed $(pwd) -eu printf done
+		'quoted text' cd echo test echo grep printf
+	awk cd ${HOME} $(pwd) export "$1" echo local x=1 awk printf "$1" done "$@"
+	grep export test 2>/dev/null x=1 echo export
+		cd "$1" x=1 grep "$1" readonly ${HOME} export -eu sed test cd
+		'quoted text' done export
+	test /usr/bin readonly "$@" && && grep echo awk done printf
+		grep ${HOME} readonly 'quoted text'
+then $(pwd) "$1" && "$1" test readonly
+		done && then export ${HOME}
+		done "$1" done --verbose then
+printf test done local printf test printf cd && printf
+2>/dev/null 'quoted text' /usr/bin "$1"
+done readonly 'quoted text'
+readonly echo awk test sed readonly
+	'quoted text' -eu done ${HOME}
+&& --verbose export awk
+--verbose "$1" grep --verbose grep /usr/bin local done x=1 awk 'quoted text'
+	"$@" test --verbose local -eu then test readonly
+		"$@" ${HOME} sed "$@" /usr/bin echo x=1 cd then awk then grep readonly
+		"$@" grep awk done then then
+	local && && awk grep export test done sed export
+		${HOME} && test x=1 ${HOME} "$@"
+	$(pwd) ${HOME} local "$@" echo
+	sed cd && then then local x=1 2>/dev/null
+		echo then sed readonly test "$@" test printf readonly grep grep
+echo ${HOME} $(pwd) x=1 readonly awk export "$1" $(pwd) -eu export
+		then test | "$@" printf && | grep --verbose then then done printf | -eu local
+		x=1 /usr/bin x=1 x=1 readonly $(pwd) 2>/dev/null readonly "$@" "$1" printf
+awk /usr/bin test $(pwd) "$@"
+&& printf ${HOME} | awk done && 2>/dev/null
+	2>/dev/null "$1" "$@"
+test printf 'quoted text' 2>/dev/null | readonly
+	printf done awk then sed x=1 grep export $(pwd)
+	&& | sed $(pwd) "$@" x=1 2>/dev/null && --verbose 2>/dev/null 2>/dev/null
+readonly && 'quoted text' 'quoted text' $(pwd) readonly
+awk awk echo && -eu cd cd test test $(pwd) awk echo $(pwd)
+		done /usr/bin && 2>/dev/null printf then "$@"
+		$(pwd) test x=1 done then readonly
+	grep --verbose 2>/dev/null $(pwd) x=1 "$@" awk
+echo /usr/bin && --verbose && cd 2>/dev/null then then grep echo done test 2>/dev/null
+	2>/dev/null awk x=1 readonly 2>/dev/null
+echo "$@" "$@" "$@" "$@" && /usr/bin readonly -eu | sed ${HOME} x=1 2>/dev/null
+	cd 'quoted text' sed /usr/bin echo | | echo x=1 x=1 'quoted text'
+	"$@" export | --verbose sed sed echo "$@" && 'quoted text' printf -eu --verbose
+printf $(pwd) /usr/bin
+		cd echo cd test done echo printf test ${HOME} local x=1 'quoted text' grep
+	${HOME} | && test x=1 --verbose echo cd cd
+"$1" local grep $(pwd) grep ${HOME} grep done local
+	done echo cd echo "$@" "$@" echo sed "$@" export /usr/bin | x=1 awk test /usr/bin
+done -eu readonly done local | echo x=1 done && done
+	grep printf && ${HOME} --verbose readonly --verbose | then done 'quoted text'
+echo export ${HOME} $(pwd) && --verbose 'quoted text' "$1" /usr/bin cd "$@" &&
+readonly done ${HOME} 2>/dev/null -eu sed 2>/dev/null /usr/bin grep sed --verbose
+	'quoted text' 2>/dev/null -eu $(pwd) "$1" done test
+printf /usr/bin 2>/dev/null && | test then /usr/bin &&
+		${HOME} export | then x=1
+local $(pwd) /usr/bin
+	done sed awk printf /usr/bin then 'quoted text' "$@" local readonly
+	then $(pwd) grep /usr/bin ${HOME} -eu grep export $(pwd) | printf "$@"
+		$(pwd) printf sed grep grep export test ${HOME} grep x=1 printf test
+		--verbose /usr/bin sed 'quoted text' local export -eu "$1" readonly
+		&& readonly echo readonly echo --verbose then printf then x=1 readonly /usr/bin
+'quoted text' awk done -eu "$1" sed cd
+	| 'quoted text' cd 'quoted text'
+'quoted text' cd 2>/dev/null sed "$1" echo test 'quoted text'
+		| 2>/dev/null awk /usr/bin /usr/bin 2>/dev/null -eu --verbose
+		| cd printf export 'quoted text' echo echo readonly test
+		echo awk test x=1 | local grep --verbose 'quoted text' cd test export
+	printf $(pwd) export /usr/bin echo "$@"
+		"$1" "$1" printf export local --verbose
+readonly then ${HOME} "$1" grep && ${HOME} echo --verbose done
+| | "$@" done /usr/bin |
+export 2>/dev/null echo then ${HOME} "$1" -eu echo
+		| then awk x=1 --verbose | printf echo ${HOME} && $(pwd) /usr/bin
+2>/dev/null echo then local
+printf $(pwd) local "$1" local
+	grep && $(pwd) "$@" export
+		'quoted text' x=1 ${HOME} test 2>/dev/null
+then done "$1" cd sed | cd cd sed x=1 ${HOME} && x=1 $(pwd) "$@" awk "$@"
+x=1 export 'quoted text' 'quoted text' 'quoted text'
+then x=1 test --verbose local grep 2>/dev/null
+		--verbose -eu $(pwd) "$1" "$@" -eu 2>/dev/null --verbose 'quoted text' grep
+	then printf export "$@" 2>/dev/null echo
+	/usr/bin sed /usr/bin test /usr/bin echo cd $(pwd) 2>/dev/null && -eu ${HOME}
+		&& printf done x=1 'quoted text' -eu done local 2>/dev/null printf
+	printf /usr/bin local -eu echo
+then "$1" "$1" 'quoted text' echo /usr/bin -eu $(pwd) 'quoted text'
+		| test /usr/bin grep
+	awk then "$@" ${HOME} done echo 'quoted text' --verbose readonly "$1" x=1 "$1"
+	2>/dev/null sed awk cd "$1" ${HOME} grep grep -eu echo echo -eu printf
+test sed /usr/bin readonly ${HOME} test
+		printf echo sed local then
+/usr/bin export readonly printf "$1" ${HOME} | echo echo printf grep echo ${HOME}
+	export "$1" && then "$1" printf echo && grep 2>/dev/null /usr/bin 2>/dev/null
+	export awk readonly then
+	-eu -eu export then echo 'quoted text' echo --verbose /usr/bin readonly "$@" then
+echo 2>/dev/null "$@" 'quoted text' "$@" | x=1 2>/dev/null -eu cd test $(pwd)
+| && printf x=1 readonly ${HOME} export readonly
+&& export --verbose grep "$@" && echo sed "$1" done $(pwd) "$@" cd awk
+echo test 2>/dev/null ${HOME} /usr/bin
+		sed "$@" local echo x=1 --verbose test ${HOME} test done -eu 'quoted text'
+		x=1 "$@" echo export "$@" awk test printf --verbose 'quoted text'
+	/usr/bin then awk local then | readonly x=1 then | $(pwd) sed ${HOME} echo --verbose
+2>/dev/null printf test --verbose export x=1 sed x=1 | test "$@" $(pwd)
+	printf test "$@" /usr/bin $(pwd) | && done grep export sed then
+		-eu printf "$1" --verbose test grep printf $(pwd)
+		$(pwd) --verbose -eu x=1 x=1 'quoted text'
+	2>/dev/null ${HOME} "$@" --verbose
+		test "$1" test x=1 -eu echo | done x=1 export export ${HOME}
+	$(pwd) | x=1 test grep x=1 export 'quoted text' grep --verbose grep
+	2>/dev/null -eu $(pwd) done --verbose x=1 test awk 2>/dev/null sed
+readonly /usr/bin ${HOME} /usr/bin $(pwd) "$1" readonly awk 2>/dev/null awk $(pwd)
+		'quoted text' local | "$1" grep export export "$@" awk echo -eu readonly -eu printf
+| "$1" test local echo "$1" test
+--verbose --verbose done
+	test local then && --verbose
+	test sed grep "$@" test echo "$1" && x=1 export -eu --verbose echo
+	grep grep cd local | echo "$1" done $(pwd) grep
+&& grep "$1" $(pwd) $(pwd) echo then --verbose
+	sed local "$@" cd ${HOME} $(pwd)
+x=1 /usr/bin ${HOME} "$@" export
+	printf local /usr/bin test
+readonly printf 2>/dev/null echo export
+	then /usr/bin then grep | then grep sed sed cd cd export 'quoted text' /usr/bin
+	awk local | /usr/bin echo --verbose awk 2>/dev/null
+		done 2>/dev/null 'quoted text' $(pwd) -eu && cd --verbose printf x=1 -eu
+printf grep printf && readonly --verbose
+		then local done then --verbose grep readonly readonly
+${HOME} $(pwd) export 'quoted text'
+'quoted text' then | echo local echo -eu done then
+		$(pwd) "$1" test | grep grep sed "$1" readonly printf /usr/bin
+	then "$@" | x=1 2>/dev/null
+test 2>/dev/null then x=1 "$1" done /usr/bin "$@" awk /usr/bin | grep $(pwd)
+test --verbose then "$@" $(pwd) sed done
+-eu grep export sed echo ${HOME} 2>/dev/null 'quoted text'
+		x=1 printf "$@" echo "$1" --verbose /usr/bin $(pwd) grep local /usr/bin readonly
+	$(pwd) /usr/bin echo export && -eu test "$@" ${HOME} "$@" | $(pwd) 2>/dev/null
+done "$1" 'quoted text' sed && sed && grep 2>/dev/null
+	/usr/bin x=1 echo "$1"
+| | -eu && local grep | export readonly /usr/bin printf x=1 grep
+grep cd && cd cd $(pwd) "$@" done
+		--verbose "$@" awk | 2>/dev/null then local 2>/dev/null export echo | /usr/bin
+	&& echo 2>/dev/null -eu /usr/bin awk "$@" "$@"
+	awk && -eu grep grep local
+	test 'quoted text' echo $(pwd) echo sed --verbose
+		-eu export export echo printf -eu
+		awk readonly 2>/dev/null | 'quoted text' readonly --verbose awk local | && done
+	grep echo && grep 2>/dev/null
+		cd cd export grep awk readonly awk "$@" -eu cd "$@" awk export
+		-eu /usr/bin printf x=1 x=1 "$@" /usr/bin awk
+		"$1" cd "$@" "$1" printf "$@" cd 2>/dev/null
+"$1" --verbose printf ${HOME} --verbose
+	export x=1 | | cd test local awk 2>/dev/null x=1
+local cd readonly test grep
+		awk "$@" "$1" && local "$1" && $(pwd) grep "$1" 'quoted text'
+	${HOME} grep done local test x=1 ${HOME} grep printf -eu sed |
+	grep local local cd echo ${HOME} test local ${HOME} x=1 done
+grep x=1 readonly | test sed done && then
+	"$1" /usr/bin "$1" -eu &&
+		echo grep awk local $(pwd) 'quoted text' then grep readonly --verbose then
+		printf --verbose test done awk -eu echo export | grep awk printf
+cd 2>/dev/null $(pwd) awk $(pwd) "$1" && 'quoted text'
+	grep | "$@" done local "$@"
+readonly local sed 'quoted text' done test awk --verbose
+		${HOME} readonly && sed --verbose "$@" local 2>/dev/null /usr/bin export
+		cd 2>/dev/null sed done x=1 printf sed cd ${HOME} x=1 grep
+		/usr/bin /usr/bin "$@" grep sed --verbose
+		done local export | x=1 awk export
+	-eu "$1" then printf -eu
+export readonly | echo "$1"
+then -eu --verbose printf 'quoted text' done then
+	readonly export local cd sed sed "$1" 2>/dev/null 'quoted text'
+	cd x=1 x=1 && sed "$@" "$1" done
+		then /usr/bin readonly "$1" $(pwd) test x=1 cd | | 2>/dev/null --verbose test
+		test $(pwd) "$1" | x=1 x=1 && x=1 | ${HOME} export ${HOME}
+printf $(pwd) sed "$1" done sed
+grep && readonly | 'quoted text' 'quoted text'
+	--verbose -eu done export printf 2>/dev/null
+		2>/dev/null printf $(pwd) cd 'quoted text'
+sed 2>/dev/null "$1" echo echo readonly x=1 export
+	--verbose --verbose /usr/bin
+2>/dev/null done sed "$1"
+	local 2>/dev/null local && sed x=1 && grep printf /usr/bin done sed
+		"$1" ${HOME} -eu grep printf readonly "$1" done done cd /usr/bin
+	echo /usr/bin /usr/bin 2>/dev/null 'quoted text' $(pwd) sed cd test
+		local 2>/dev/null "$@" done echo echo then done "$1" printf
+	&& sed "$1" --verbose cd local done printf "$1" ${HOME} cd -eu 2>/dev/null
+export local -eu x=1 test grep done
+		/usr/bin --verbose awk cd echo done x=1 awk echo echo && "$1"
+	readonly -eu "$@" /usr/bin /usr/bin sed $(pwd) --verbose /usr/bin $(pwd)
+		done then "$@" --verbose awk test local
+		"$1" readonly -eu "$1" /usr/bin grep test local --verbose
+${HOME} "$1" cd $(pwd) grep grep && /usr/bin local
+	local then then printf sed sed x=1 x=1 cd --verbose 2>/dev/null
+	test ${HOME} awk cd "$1" echo 'quoted text'
+x=1 done test readonly echo -eu local grep readonly
+		${HOME} /usr/bin | grep "$1" done done -eu x=1
+	local 2>/dev/null awk sed readonly && ${HOME} sed -eu ${HOME}
+		--verbose local then x=1 grep done --verbose local
+2>/dev/null echo /usr/bin "$@" "$1" && ${HOME}
+		'quoted text' 'quoted text' -eu
+	x=1 | --verbose && $(pwd) 2>/dev/null cd --verbose sed x=1
+	"$@" local 2>/dev/null done cd awk -eu "$@"
+		-eu then test --verbose then ${HOME} echo echo x=1 export /usr/bin
+	cd awk 'quoted text' done then export grep grep cd echo /usr/bin
+then && 2>/dev/null echo && cd && ${HOME}
+	${HOME} 2>/dev/null local -eu
+		&& test cd awk test "$@" x=1
+${HOME} test test local "$@" x=1 && echo then | sed -eu 2>/dev/null /usr/bin
+	sed awk printf printf && cd $(pwd) cd sed sed then "$@" awk then x=1
+		2>/dev/null "$@" --verbose
+awk echo | done 2>/dev/null 2>/dev/null /usr/bin 'quoted text' readonly
+		done | export export --verbose printf test --verbose printf echo grep
+echo then $(pwd) "$@" cd cd
+		test $(pwd) done cd sed grep awk 'quoted text'
+done $(pwd) "$@" export && test then "$@" test
+	$(pwd) sed x=1 ${HOME} test sed local -eu printf 'quoted text' 'quoted text'
+		&& local "$1" -eu cd 'quoted text'
+test $(pwd) export cd local cd grep --verbose /usr/bin export x=1 readonly
+--verbose 2>/dev/null $(pwd) 2>/dev/null x=1 --verbose "$@" readonly
+sed x=1 /usr/bin local local grep "$@" test 2>/dev/null
+		&& -eu sed ${HOME} awk then "$@" then sed ${HOME} printf
+	'quoted text' readonly "$@" cd "$@" cd awk test echo x=1
+&& -eu $(pwd) printf x=1
+	then ${HOME} echo printf awk /usr/bin ${HOME} local done "$1" printf
+	local readonly ${HOME} 'quoted text'
+grep sed then echo "$1" -eu done -eu
+"$@" ${HOME} cd readonly -eu echo done printf readonly
+		x=1 printf ${HOME} "$@"
+| $(pwd) 'quoted text' 'quoted text'
+| test "$@" local -eu | readonly | ${HOME} test
+	local local "$1" ${HOME} local test
+		'quoted text' local -eu ${HOME} export local test
+2>/dev/null "$1" sed awk $(pwd) --verbose test --verbose
+	cd ${HOME} done grep sed "$1"
+		'quoted text' 2>/dev/null readonly cd then -eu "$1"
+		"$@" "$@" /usr/bin test test 'quoted text' awk x=1 export
+	grep export --verbose then /usr/bin test /usr/bin cd cd
+		then grep export 'quoted text'
+/usr/bin test awk && 'quoted text' "$@"
+--verbose sed printf
+	readonly test -eu done -eu "$1" "$@" sed && grep test --verbose done 'quoted text'
+		x=1 && then x=1 /usr/bin /usr/bin 2>/dev/null sed -eu grep ${HOME} --verbose
+		/usr/bin test $(pwd) awk readonly --verbose
+		"$1" x=1 /usr/bin && "$@" readonly | cd done grep grep test readonly
+		then done --verbose x=1 cd | grep | test local echo test cd $(pwd)
+	cd $(pwd) "$1" "$@" cd ${HOME} | readonly | grep | "$1" "$@" echo 2>/dev/null
+	| done echo 'quoted text'
+		"$1" cd cd --verbose done "$@" 2>/dev/null printf 'quoted text'
+	done && grep x=1 --verbose
+readonly test cd done && "$@" 'quoted text' x=1 done "$1" test ${HOME} $(pwd)
+grep ${HOME} $(pwd) then grep /usr/bin
+		grep grep && done --verbose printf sed -eu "$@"
+	awk test $(pwd) awk -eu
+	done x=1 printf readonly 2>/dev/null then test --verbose grep done awk
+	test && && printf sed cd
+		'quoted text' done export
+	sed echo x=1 'quoted text' "$@" -eu echo --verbose
+sed ${HOME} printf echo 2>/dev/null
+	cd then sed test cd /usr/bin -eu x=1 | -eu readonly test then ${HOME}
+2>/dev/null x=1 awk cd -eu cd readonly
+/usr/bin $(pwd) grep then then export 2>/dev/null
+-eu -eu test ${HOME} printf -eu cd
+		&& printf && --verbose
+		/usr/bin printf local local awk export local done ${HOME} sed local test 'quoted text'
+	${HOME} awk echo -eu export --verbose && 'quoted text' x=1 cd 'quoted text' $(pwd)
+local awk test test local awk /usr/bin /usr/bin $(pwd) sed printf
+	test export test sed cd done
+&& sed "$@" readonly cd export -eu $(pwd) x=1
+		"$@" 2>/dev/null awk | --verbose && | 'quoted text' sed /usr/bin then
+readonly echo --verbose
+/usr/bin x=1 $(pwd) | ${HOME} awk "$@" "$1" 2>/dev/null printf --verbose done
+		readonly x=1 ${HOME} 'quoted text' local
+	--verbose x=1 awk export /usr/bin test /usr/bin printf
+export "$@" 'quoted text' local grep grep ${HOME}
+	$(pwd) readonly 2>/dev/null
+	grep -eu echo cd readonly grep "$@" echo test /usr/bin | then
+		cd readonly ${HOME} test && "$1" local "$1" | $(pwd) -eu then && 2>/dev/null
+	echo export 'quoted text' -eu |
+	| local echo then | "$1" printf
+		sed $(pwd) sed ${HOME} then export "$1" | readonly
+		"$@" 2>/dev/null test /usr/bin x=1 x=1 echo done /usr/bin echo && 'quoted text'
+| test printf 2>/dev/null /usr/bin printf --verbose "$1" export
+	test 2>/dev/null -eu readonly grep | grep test export done
+"$1" "$1" "$1" local --verbose "$@"
+$(pwd) $(pwd) "$@" "$@" sed grep --verbose -eu readonly done export
+"$@" cd cd $(pwd) export cd $(pwd) cd | sed $(pwd) "$1" local local "$@"
+	then "$@" test 2>/dev/null x=1 grep echo 2>/dev/null local "$1" test grep /usr/bin
+	${HOME} /usr/bin ${HOME} x=1 'quoted text' done test
+2>/dev/null 'quoted text'
+		2>/dev/null sed "$1" test ${HOME} $(pwd) --verbose grep x=1 test "$@"
+	local done cd 'quoted text' then cd then 'quoted text'
+awk $(pwd) then | cd /usr/bin "$@" sed echo test local grep cd
+		test grep printf awk test 'quoted text' local sed readonly
+	done "$@" then echo 2>/dev/null test "$1" readonly ${HOME} then awk
+		awk && --verbose readonly export readonly
+		"$@" | test "$@" x=1 'quoted text'
+test readonly --verbose "$@" "$1" | 2>/dev/null cd "$@" local echo
+"$@" "$1" sed echo sed test readonly awk cd && /usr/bin local "$@" | && test
+		2>/dev/null export 2>/dev/null local
+	$(pwd) -eu then 'quoted text' readonly sed done export && /usr/bin grep awk
+	awk echo | readonly readonly awk
+export "$@" cd $(pwd) | readonly && then awk grep
+	"$1" printf x=1 sed grep echo cd ${HOME}
+		| done 'quoted text' ${HOME} $(pwd) -eu local "$@" "$1" --verbose readonly "$@"
+	"$@" /usr/bin readonly readonly | local grep "$1" 'quoted text'
+	printf $(pwd) 2>/dev/null $(pwd) "$1" done -eu done 2>/dev/null sed --verbose
+	${HOME} echo ${HOME} "$@" -eu --verbose -eu
+/usr/bin /usr/bin local awk /usr/bin "$1" 2>/dev/null readonly
+$(pwd) ${HOME} printf 2>/dev/null
+	| -eu | $(pwd) --verbose
+| /usr/bin sed echo ${HOME} -eu -eu sed $(pwd)
+grep sed then ${HOME} done 'quoted text' $(pwd) $(pwd) && local $(pwd) local
+		readonly awk cd readonly /usr/bin then test done grep
+printf printf x=1 grep cd | 'quoted text' ${HOME} awk test $(pwd)
+"$1" 2>/dev/null --verbose x=1 /usr/bin -eu sed "$@" done grep
+| cd --verbose 'quoted text' grep cd "$1" "$1" ${HOME}
+then && grep local then grep cd "$@"
+		cd export readonly && then "$1" -eu echo 2>/dev/null 'quoted text'
+	${HOME} /usr/bin export && "$@" cd /usr/bin ${HOME}
+		2>/dev/null local --verbose "$1" | awk local 'quoted text' local --verbose
+	printf then test grep done export cd then export export "$@"
+	grep | x=1 readonly "$@" done grep ${HOME} test then "$1" cd done done
+	'quoted text' x=1 cd | export
+"$@" "$@" then x=1 readonly then /usr/bin --verbose
+$(pwd) ${HOME} --verbose x=1 2>/dev/null test --verbose | readonly grep then awk
+	printf printf --verbose then x=1 readonly /usr/bin
+${HOME} awk local cd readonly echo export
+	grep export export test
+	grep --verbose awk && ${HOME} grep "$1" test done printf done $(pwd)
+		test done test printf --verbose printf local sed x=1 readonly 2>/dev/null
+		/usr/bin "$@" "$@" $(pwd) cd then 'quoted text' echo then awk
+	x=1 ${HOME} awk && 2>/dev/null
+		grep readonly --verbose | readonly "$1" grep test
+	-eu then then -eu 2>/dev/null $(pwd)
+	grep --verbose local sed test export
+	-eu 'quoted text' "$1" 2>/dev/null /usr/bin /usr/bin
+x=1 $(pwd) "$1" | test | done readonly 'quoted text'
+grep $(pwd) x=1 | local "$1" /usr/bin 'quoted text' 'quoted text'
+cd /usr/bin -eu then | echo echo 'quoted text' -eu cd
+		done ${HOME} && done $(pwd) && then | awk x=1 "$@" export
+		2>/dev/null /usr/bin | awk export then ${HOME} export test $(pwd) printf /usr/bin
+		printf ${HOME} local x=1 awk 2>/dev/null then $(pwd) export echo
+		then test readonly $(pwd) x=1 grep | export printf $(pwd) grep |
+	sed readonly done -eu "$@" awk | /usr/bin | 'quoted text' --verbose
+	x=1 | local --verbose ${HOME} echo test awk test /usr/bin
+		awk grep ${HOME} "$@" --verbose cd | echo
+	then awk "$1" /usr/bin "$@" sed export
+	export ${HOME} x=1 2>/dev/null 'quoted text'
+		awk readonly test echo | grep then -eu sed | | sed && sed -eu | | 'quoted text'
+sed then "$@" 2>/dev/null then then "$1"
+"$@" && grep | grep sed export --verbose $(pwd)
+x=1 --verbose grep local ${HOME} cd done done 2>/dev/null
+		then x=1 ${HOME} 2>/dev/null
+local ${HOME} 'quoted text' ${HOME} x=1 cd x=1 export done grep grep
+	local -eu grep cd ${HOME} export sed -eu
+		echo --verbose --verbose awk $(pwd) done
+		${HOME} test printf /usr/bin x=1 echo local printf
+/usr/bin && --verbose --verbose done
+		${HOME} 2>/dev/null export --verbose | grep "$@"
+	awk printf then cd echo sed "$1" /usr/bin --verbose awk awk readonly
+	-eu ${HOME} printf ${HOME} -eu --verbose export | cd sed 2>/dev/null
+		&& then ${HOME} x=1 done "$@" -eu ${HOME} then
+	test ${HOME} /usr/bin "$1" "$1"
+readonly | ${HOME} "$@" cd cd local --verbose
+	2>/dev/null && sed then awk then $(pwd) $(pwd) readonly 'quoted text' local
+		then awk $(pwd) local "$1" ${HOME} readonly
+	"$1" sed -eu printf -eu 2>/dev/null | 'quoted text'
+	readonly -eu printf grep 2>/dev/null grep test 2>/dev/null 'quoted text'
+grep cd 'quoted text' grep local --verbose
+		"$@" x=1 sed "$1" readonly readonly export
+	--verbose readonly then grep
+		then && cd cd sed -eu readonly readonly local
+	&& then readonly "$1" awk export --verbose ${HOME} local awk "$@" | echo
+		readonly /usr/bin 'quoted text' sed awk /usr/bin --verbose test | grep -eu --verbose
+	grep -eu | x=1 --verbose /usr/bin export printf "$@" --verbose
+	cd $(pwd) -eu && --verbose
+	$(pwd) grep "$@" 'quoted text' /usr/bin
+		then done /usr/bin 2>/dev/null "$@" readonly sed cd -eu $(pwd) grep echo |
+-eu export -eu grep 2>/dev/null -eu x=1 printf local
+		done printf /usr/bin test echo sed export grep awk "$1" grep "$@"
+		/usr/bin --verbose printf printf "$1" then "$1" 2>/dev/null 'quoted text'
+		"$1" printf ${HOME} ${HOME}
+/usr/bin readonly export local
+		2>/dev/null --verbose readonly test "$1" | grep test 2>/dev/null
+	done 'quoted text' then cd printf local cd &&
+	${HOME} | ${HOME} echo grep
+sed $(pwd) sed readonly /usr/bin awk ${HOME}
+		sed readonly "$1" local && && echo --verbose awk printf echo 'quoted text'
+	then /usr/bin readonly then 'quoted text' echo awk
+	export cd then x=1 cd "$@" cd x=1 "$1"
+local -eu awk sed x=1 echo
+		2>/dev/null && cd && "$1" printf | cd awk local awk x=1 "$1" "$1" awk
+2>/dev/null grep 2>/dev/null cd then 2>/dev/null test /usr/bin cd "$@" echo
+	x=1 ${HOME} && then x=1 echo cd | grep --verbose
+	test printf then 'quoted text' echo x=1 'quoted text' --verbose 2>/dev/null
+--verbose "$@" --verbose printf done sed done
+		/usr/bin test test x=1 ${HOME} local export local local "$1" /usr/bin then -eu
+		"$1" local && $(pwd) awk then 2>/dev/null /usr/bin awk "$1" awk 'quoted text'
+	export readonly echo -eu 'quoted text'
+		export readonly "$1" sed printf /usr/bin local
+		grep readonly && grep echo
+	/usr/bin -eu local 'quoted text' "$@" printf export test
+		2>/dev/null grep then && test done 2>/dev/null 'quoted text' echo readonly 'quoted text'
+/usr/bin grep $(pwd) -eu /usr/bin sed awk $(pwd)
+		cd cd "$@" ${HOME} "$1" | | then
+	--verbose grep --verbose "$1" sed
+| 2>/dev/null && awk 'quoted text' test
+	local --verbose --verbose echo export $(pwd) ${HOME} test
+	then -eu -eu readonly 2>/dev/null then local -eu sed local echo ${HOME} sed
+		/usr/bin | cd local 2>/dev/null -eu sed export readonly then $(pwd) ${HOME}
+--verbose ${HOME} grep /usr/bin
+		"$@" 'quoted text' readonly
+&& cd ${HOME} $(pwd) echo export readonly "$1" ${HOME} awk
+printf "$1" --verbose printf $(pwd) x=1 'quoted text'
+$(pwd) echo export export /usr/bin 'quoted text' 'quoted text'
+		/usr/bin printf $(pwd) printf cd cd 2>/dev/null 'quoted text'
+		--verbose sed grep echo "$1" echo printf
+	x=1 /usr/bin | ${HOME} $(pwd) done sed 2>/dev/null |
+	done readonly awk ${HOME} 2>/dev/null | printf
+		done done test "$1" --verbose 2>/dev/null |
+	awk /usr/bin export --verbose awk done $(pwd) /usr/bin 2>/dev/null done "$@"
+		"$1" --verbose ${HOME} -eu readonly readonly
+	printf cd awk awk printf then 'quoted text' | grep | 'quoted text' test done
+	-eu | -eu $(pwd) readonly $(pwd) done grep x=1 && cd test sed
+'quoted text' -eu awk -eu 2>/dev/null
+"$1" printf cd "$1" -eu export done 'quoted text'
+		local | $(pwd) sed readonly "$1" grep 2>/dev/null
+	/usr/bin done grep then 'quoted text' --verbose
+		cd | cd $(pwd) ${HOME} x=1 local "$1" ${HOME} cd test done sed 'quoted text'
+	export local "$1" x=1 && then awk 'quoted text' | 2>/dev/null
+		readonly done && echo cd export --verbose "$@" printf awk grep then echo local
+&& -eu $(pwd) $(pwd) | -eu local /usr/bin && x=1 local export printf
+	grep 'quoted text' done printf /usr/bin test grep /usr/bin 2>/dev/null
+then local x=1 grep ${HOME} --verbose | | 2>/dev/null
+/usr/bin test then echo -eu && local export && readonly
+	/usr/bin ${HOME} awk test cd && printf /usr/bin &&
+	| sed 'quoted text' sed
+awk sed cd cd done test awk /usr/bin
+		/usr/bin $(pwd) 2>/dev/null then awk -eu sed 2>/dev/null
+"$@" cd export && local | local echo test test ${HOME} 'quoted text' readonly
+		done "$1" x=1 $(pwd) -eu export ${HOME} 'quoted text'
+		x=1 awk --verbose ${HOME} cd echo test && 2>/dev/null
+	readonly x=1 awk 'quoted text' done printf export 2>/dev/null "$@"
+	&& 'quoted text' awk && printf cd sed sed then ${HOME}
+	export 'quoted text' echo $(pwd) -eu then $(pwd) | &&
+"$1" export "$@" 'quoted text' done
+grep grep 2>/dev/null 'quoted text' export export "$@" 'quoted text'
+"$@" $(pwd) export printf $(pwd)
+		grep --verbose "$@" readonly then then local test --verbose cd /usr/bin
+&& test awk test -eu -eu cd $(pwd) local 2>/dev/null -eu "$@" $(pwd)
+	readonly then then test
+		${HOME} sed x=1 "$1" grep printf ${HOME}
+	printf echo export export $(pwd) cd done |
+	'quoted text' test done printf $(pwd) -eu grep local | sed ${HOME}
+	done echo /usr/bin printf 'quoted text' export -eu grep ${HOME}
+	2>/dev/null 2>/dev/null $(pwd) -eu $(pwd) | local sed && then export export
+	/usr/bin sed echo readonly "$@" then /usr/bin test --verbose local sed local
+	&& export then export local test awk "$1"
+		done x=1 | --verbose sed /usr/bin
+	echo ${HOME} test "$1" 2>/dev/null then export
+		test done $(pwd) echo readonly sed 'quoted text' 'quoted text'
+		x=1 awk | 2>/dev/null && | ${HOME}
+--verbose "$@" printf && 'quoted text'
+	done grep cd sed "$@" "$1"
+		'quoted text' "$@" awk /usr/bin grep sed 2>/dev/null
+	${HOME} && readonly $(pwd) | export done
+	awk awk && | readonly $(pwd)
+		'quoted text' readonly
+		awk 'quoted text' $(pwd)
+	then sed awk sed awk /usr/bin awk grep -eu test
+cd 'quoted text' sed ${HOME} printf /usr/bin grep ${HOME} "$@" --verbose
+		sed export then "$@" 'quoted text' cd -eu
+&& local --verbose grep "$1" grep grep && "$1" test done "$@" | /usr/bin
+		echo 'quoted text' -eu x=1 x=1 done --verbose
+	export 'quoted text' /usr/bin 'quoted text'
+		then $(pwd) export sed printf test &&
+	echo -eu x=1 echo echo readonly sed /usr/bin grep --verbose printf awk
+	printf | export --verbose ${HOME} "$@"
+-eu local /usr/bin cd cd echo 2>/dev/null
+	then readonly test 2>/dev/null -eu then export sed "$1" "$@" awk -eu 2>/dev/null
+x=1 test | echo --verbose cd readonly 2>/dev/null awk cd done grep
+	echo --verbose grep awk awk sed readonly /usr/bin printf awk --verbose
+sed then echo /usr/bin x=1 | ${HOME}
+readonly 'quoted text' echo --verbose export | "$1" sed $(pwd) printf local
+awk 2>/dev/null sed export printf test "$1" -eu local $(pwd) | sed $(pwd)
+	| export "$1" then /usr/bin cd -eu grep 2>/dev/null
+printf sed | "$@" export local && cd "$@" x=1 sed && | printf sed test printf printf
+&& readonly /usr/bin /usr/bin "$1" echo -eu local ${HOME} echo "$1" test awk /usr/bin
+	-eu printf -eu 2>/dev/null test cd printf awk &&
+		'quoted text' ${HOME} ${HOME} readonly 'quoted text'
+	export 'quoted text' then
+local grep grep echo local "$1" && done sed |
+then sed 2>/dev/null $(pwd) ${HOME} test export "$@" sed "$1" readonly echo
+	$(pwd) sed 'quoted text'
+	echo then "$1" "$@" grep echo
+		local export test then sed export printf 2>/dev/null "$@"
+/usr/bin $(pwd) local x=1 && && printf sed echo "$@" readonly done
+"$1" done --verbose awk ${HOME}
+	/usr/bin sed 'quoted text' then && readonly then --verbose
+	| readonly grep 2>/dev/null
+2>/dev/null printf 2>/dev/null ${HOME} awk --verbose x=1 test
+'quoted text' ${HOME} sed then test test --verbose /usr/bin done
+2>/dev/null echo /usr/bin ${HOME} "$@"
+		$(pwd) "$@" "$1" $(pwd) /usr/bin --verbose done grep test sed ${HOME}
+		| grep local | 2>/dev/null export then printf -eu local cd echo
+	sed 2>/dev/null then test x=1 awk | --verbose then "$1" ${HOME}
+printf && "$@" && then test then echo "$1" then "$@" $(pwd) done 2>/dev/null
+readonly cd -eu 'quoted text' readonly then --verbose "$@" --verbose x=1 x=1 &&
+	x=1 awk readonly "$1" 'quoted text'
+	${HOME} grep -eu grep readonly
+$(pwd) cd echo ${HOME} ${HOME} | then then
+	test echo ${HOME} -eu sed local then 2>/dev/null test then then $(pwd) "$1"
+--verbose x=1 test local then done && export grep &&
+readonly sed ${HOME} 2>/dev/null ${HOME} local --verbose
+		then echo ${HOME} && test cd -eu &&
+	2>/dev/null sed "$1" printf then && --verbose
+		local "$1" && local awk "$1" printf
+&& awk "$@" /usr/bin test
+sed sed readonly sed "$1" awk then export --verbose local --verbose
+		then "$1" -eu && /usr/bin readonly grep then done -eu test readonly &&
+	2>/dev/null "$@" "$1" export printf 'quoted text' ${HOME} export done grep
+test awk test /usr/bin local "$@" sed -eu local "$1"
+	test /usr/bin 2>/dev/null |
+		--verbose local test printf sed then local "$@" "$1" $(pwd) test export $(pwd)
+	readonly 'quoted text' done export $(pwd) export ${HOME} &&
+	sed readonly "$@" ${HOME} && "$1" 2>/dev/null -eu
+	--verbose 'quoted text' --verbose
+		| local 'quoted text' grep awk
+awk local cd | --verbose printf
+		-eu --verbose grep test
+cd && local ${HOME} ${HOME}
+	export -eu then done then done $(pwd) "$@" local
+	grep cd done /usr/bin x=1 then "$@" echo x=1 printf ${HOME} local awk sed
+		test ${HOME} then grep awk -eu sed then readonly readonly
+		printf cd ${HOME} "$@" "$1" 'quoted text' grep 'quoted text'
+	sed then then $(pwd) sed grep 'quoted text' then echo
+cd 2>/dev/null export local --verbose
+	2>/dev/null && done --verbose awk export "$1" -eu -eu printf test --verbose
+		&& ${HOME} | | echo sed --verbose export x=1 cd --verbose 2>/dev/null
+	$(pwd) $(pwd) ${HOME} test
+then printf then && cd local local | ${HOME}
+		grep $(pwd) cd /usr/bin && readonly
+	test && cd -eu "$1" "$1" "$1" grep
+readonly && then local printf 'quoted text' | echo done sed
+	done awk sed $(pwd) sed sed --verbose export /usr/bin
+then done printf readonly "$@" echo | echo "$@" | "$@" awk grep
+	sed local sed ${HOME} sed printf 'quoted text' 'quoted text' printf 2>/dev/null
+/usr/bin "$1" --verbose 2>/dev/null 'quoted text' echo export export
+then readonly -eu printf grep sed test grep cd grep x=1
+$(pwd) x=1 cd local 2>/dev/null && printf
+awk && then ${HOME} export ${HOME}
+then grep -eu test test
+$(pwd) x=1 -eu printf then
+	${HOME} printf grep export readonly done
+		printf done done && 'quoted text' grep cd $(pwd) grep printf x=1 test awk
+		| sed sed sed "$1" awk echo 'quoted text' readonly 'quoted text'
+		2>/dev/null awk local 'quoted text'
+		local x=1 ${HOME} sed | /usr/bin local --verbose "$1" $(pwd) "$1"
+${HOME} echo cd then "$@" "$@" local printf && /usr/bin
+		echo awk local /usr/bin test 2>/dev/null
+		--verbose then done -eu then then grep echo 2>/dev/null local
+"$1" && test | --verbose grep test
+		"$@" done sed then local test ${HOME}
+-eu cd x=1 'quoted text' "$@" 2>/dev/null awk -eu x=1 test done && grep
+	x=1 "$@" test x=1 readonly readonly printf -eu $(pwd) printf
+printf /usr/bin && -eu /usr/bin $(pwd) x=1 readonly printf
+	${HOME} sed "$@" 'quoted text' && 2>/dev/null
+		$(pwd) sed cd sed "$1" --verbose
+		sed "$1" 'quoted text' && test | /usr/bin -eu then x=1 --verbose && $(pwd)
+echo readonly done done then --verbose awk -eu test 'quoted text'
+test cd "$1" echo 'quoted text' ${HOME} && ${HOME} export
+	export test grep 'quoted text' 2>/dev/null 2>/dev/null ${HOME} awk $(pwd)
+		--verbose done test | local "$1" then readonly grep -eu 2>/dev/null
+		x=1 && "$@" && x=1 2>/dev/null 2>/dev/null test cd
+		x=1 "$1" test /usr/bin then -eu --verbose 2>/dev/null cd grep
+		local 'quoted text' export | then "$1" grep awk "$1" "$@" ${HOME}
+	'quoted text' test "$1" "$1" /usr/bin
+	grep 2>/dev/null "$1" test then done export cd cd 2>/dev/null
+	test /usr/bin ${HOME} 2>/dev/null then awk printf && "$@" cd local
+	printf -eu --verbose -eu --verbose --verbose
+test export 'quoted text' --verbose readonly x=1 grep 'quoted text'
+	x=1 printf sed grep /usr/bin 2>/dev/null
+awk sed test /usr/bin $(pwd) "$1" awk local sed && test x=1 readonly
+echo local echo && x=1 printf awk cd $(pwd) sed && -eu "$1" 2>/dev/null
+"$1" sed --verbose -eu && -eu awk &&
+		printf $(pwd) done "$1" then | "$@" echo cd 2>/dev/null echo sed -eu x=1
+	${HOME} 2>/dev/null printf echo
+		"$@" "$@" "$@" export printf local
+"$1" -eu sed awk $(pwd) && $(pwd) /usr/bin test "$@" local echo local ${HOME} grep
+local ${HOME} "$1" /usr/bin 2>/dev/null
+${HOME} local $(pwd) -eu export $(pwd) echo "$@" export x=1 -eu echo 2>/dev/null
+		&& 2>/dev/null --verbose /usr/bin "$@" echo x=1 | 2>/dev/null sed
+	-eu export local sed ${HOME} "$@" cd awk && --verbose grep
+		/usr/bin awk sed x=1 'quoted text' awk then "$1" readonly --verbose echo 'quoted text'
+local "$@" sed /usr/bin 2>/dev/null "$@" -eu echo
+cd "$1" cd x=1 $(pwd) done x=1
+		-eu 2>/dev/null "$1" readonly ${HOME}
+		'quoted text' -eu --verbose printf
+	grep 'quoted text' 2>/dev/null
+	export 2>/dev/null "$1"
+/usr/bin local local export | cd cd export printf ${HOME} ${HOME} done export grep
+	sed readonly -eu x=1 /usr/bin echo grep test
+&& local done test printf
+x=1 local grep grep -eu echo -eu "$1" 2>/dev/null --verbose /usr/bin test 'quoted text'
+		&& done 'quoted text' &&
+test /usr/bin ${HOME} awk test -eu
+	${HOME} 'quoted text' -eu "$1" x=1 readonly awk sed local test 2>/dev/null
+		then ${HOME} then $(pwd) && "$@" sed "$@" /usr/bin --verbose x=1 echo cd
+sed printf $(pwd) readonly sed test
+		test sed --verbose x=1 &&
+"$@" $(pwd) -eu awk export ${HOME} test done && | printf $(pwd) ${HOME} done
+&& local local readonly then echo /usr/bin
+awk "$@" sed awk cd local "$@" cd grep readonly done "$1"
+'quoted text' -eu $(pwd) && && "$1" | | x=1 -eu -eu /usr/bin
+		&& awk printf echo echo readonly ${HOME} cd /usr/bin sed $(pwd) awk awk
+	| local test test awk --verbose cd printf | 2>/dev/null
+--verbose $(pwd) $(pwd) ${HOME} test local | ${HOME} 'quoted text' done
+		| readonly "$1" printf | /usr/bin echo grep -eu x=1
+		echo readonly | 'quoted text' $(pwd) export | then x=1 ${HOME}
+	test export printf --verbose done
+		cd -eu export 'quoted text' "$1" cd local | 2>/dev/null awk x=1 grep grep
+	2>/dev/null ${HOME} | cd test | $(pwd) then 'quoted text' && x=1 2>/dev/null "$1"
+'quoted text' local x=1 && grep awk
+		x=1 $(pwd) ${HOME} | "$@" readonly export
+		test "$1" | && --verbose 'quoted text' printf
+2>/dev/null grep echo echo done && sed "$@" "$1" /usr/bin
+	x=1 printf sed ${HOME}
+	--verbose echo printf /usr/bin grep
+&& /usr/bin && local && $(pwd) test "$@"
+	${HOME} 2>/dev/null /usr/bin -eu local export -eu done
+	&& ${HOME} | "$1" sed echo x=1 cd export --verbose ${HOME}
+echo cd cd $(pwd) ${HOME} x=1
+	cd "$@" grep | | then sed | && awk x=1 x=1 grep done | export | export
+2>/dev/null --verbose printf grep "$1"
+		grep printf echo "$1" "$1" echo local | readonly echo | done x=1 $(pwd)
+	done 2>/dev/null local 'quoted text' x=1
+	local test /usr/bin "$@" echo
+then export printf echo | echo && -eu awk cd ${HOME} $(pwd) cd ${HOME} sed
+'quoted text' grep 'quoted text' grep printf 'quoted text'
+		x=1 && "$1" --verbose ${HOME} 'quoted text' ${HOME} local grep echo
+| | "$@" ${HOME} 'quoted text'
+		--verbose sed printf local "$1" | -eu $(pwd) then $(pwd) | printf
+"$1" readonly awk awk done /usr/bin -eu --verbose
+	awk readonly 'quoted text' | 2>/dev/null
+		-eu local /usr/bin cd sed --verbose sed "$@" $(pwd) -eu grep
+	/usr/bin echo --verbose --verbose readonly "$1" then grep readonly
+		$(pwd) | $(pwd) 2>/dev/null /usr/bin done x=1 'quoted text'
+		printf echo && echo echo local echo readonly sed ${HOME} done done "$@" --verbose
+x=1 /usr/bin export then "$1" done printf readonly $(pwd) export awk
+		/usr/bin "$@" readonly grep export
+	echo "$1" "$1" && done --verbose | "$1" cd && /usr/bin
+		&& cd cd $(pwd) --verbose test test test export awk done -eu "$1" done
+	'quoted text' sed local done readonly --verbose $(pwd)
+cd done awk /usr/bin $(pwd) x=1 local ${HOME}
+	"$@" --verbose x=1 "$1"
+	'quoted text' sed grep x=1 | local done readonly cd test readonly
+	awk export local grep 'quoted text' --verbose export then | && 'quoted text' $(pwd)
+/usr/bin "$@" readonly "$1" -eu 'quoted text' cd "$1" "$@" printf printf
+	sed -eu echo | | 2>/dev/null
+	--verbose ${HOME} 2>/dev/null test && 'quoted text'
+	cd done sed cd done then done echo then cd && && "$1" local done echo
+		/usr/bin 2>/dev/null "$@" then printf -eu /usr/bin
+"$@" x=1 grep "$1" echo 'quoted text' "$@" printf readonly export sed
+		grep "$@" "$@" $(pwd) awk export grep sed
+local -eu local 2>/dev/null export 'quoted text' 2>/dev/null $(pwd) | test cd
+--verbose 2>/dev/null cd "$@" $(pwd) && sed $(pwd)
+	"$1" printf /usr/bin printf
+	${HOME} "$1" --verbose /usr/bin
+	readonly --verbose 2>/dev/null then test readonly
+		awk "$1" | "$1" $(pwd) $(pwd) grep "$1" cd sed sed x=1 awk ${HOME} readonly
+	2>/dev/null test awk x=1 'quoted text'
+echo done then awk printf ${HOME} "$1" --verbose "$1" printf --verbose $(pwd)
+$(pwd) test export -eu --verbose --verbose ${HOME} sed
+	| x=1 grep sed | readonly -eu && echo export 2>/dev/null test awk cd grep done
+		echo done "$@" sed --verbose --verbose awk ${HOME}
+		readonly readonly --verbose grep
+		awk | && /usr/bin "$@" /usr/bin done grep ${HOME}
+	awk && 'quoted text' sed x=1 -eu $(pwd) --verbose
+		| cd $(pwd) grep && export && "$@" test "$1" && printf sed cd && --verbose
+	export "$1" $(pwd) printf --verbose --verbose
+	echo export /usr/bin --verbose
+	$(pwd) export readonly "$@" export
+"$@" test && echo 2>/dev/null 2>/dev/null && readonly
+test --verbose local x=1
+	readonly && --verbose test echo "$@" 'quoted text' readonly /usr/bin
+	readonly x=1 then echo readonly && 2>/dev/null && -eu then x=1
+then 2>/dev/null --verbose
+local -eu /usr/bin local export printf -eu | export sed $(pwd) /usr/bin
+	export $(pwd) --verbose --verbose ${HOME}
+	"$1" test sed grep readonly cd --verbose 'quoted text'
+	test ${HOME} awk ${HOME} "$1"
+'quoted text' --verbose awk readonly
+	done ${HOME} | sed | readonly && echo sed sed printf
+		then $(pwd) local then && sed --verbose --verbose
+		echo | --verbose cd then x=1 test x=1 cd && awk local then then cd x=1 "$1" cd
+	done "$1" then "$@" test /usr/bin $(pwd) 2>/dev/null "$1"
+		sed printf -eu printf -eu x=1 local sed --verbose
+	local then && sed printf printf test export local $(pwd)
+		grep local $(pwd) done readonly x=1 ${HOME} test local | x=1 ${HOME}
+	printf "$1" done export export 2>/dev/null
+	"$1" echo local printf 2>/dev/null -eu grep "$@" readonly
+then /usr/bin x=1 export $(pwd)
+test ${HOME} -eu test echo echo grep
+	then then ${HOME} "$@" awk printf "$1"
+x=1 "$@" -eu done -eu x=1 local awk local "$1" "$1" readonly /usr/bin printf printf
+	"$1" "$1" /usr/bin printf
+		2>/dev/null local then ${HOME} --verbose --verbose
+-eu cd test test "$@" printf
+		-eu done test x=1 -eu | echo | local x=1 printf awk /usr/bin grep $(pwd)
+sed 'quoted text' cd then echo test echo printf
+then 2>/dev/null readonly "$1" x=1 ${HOME} printf 'quoted text' 'quoted text'
+	"$@" "$1" | cd x=1 && ${HOME} grep
+		grep then awk x=1 --verbose
+		done "$@" then export "$1" echo
+grep export ${HOME} sed grep done && awk done |
+	'quoted text' cd ${HOME} export -eu then ${HOME} printf "$1" done grep 'quoted text'
+	/usr/bin local cd x=1 local && awk /usr/bin ${HOME} grep done --verbose readonly
+		-eu 2>/dev/null -eu printf 'quoted text' --verbose
+awk -eu done 'quoted text' | echo 'quoted text'
+	done | && "$@" cd echo done 'quoted text' ${HOME} $(pwd) 'quoted text'
+	&& && 2>/dev/null ${HOME} awk /usr/bin local grep cd --verbose -eu 2>/dev/null
+		printf export grep ${HOME} && 'quoted text'
+	${HOME} local then "$1" "$1" 2>/dev/null $(pwd)
+export x=1 --verbose 'quoted text' grep export $(pwd) | ${HOME} "$1" ${HOME}
+'quoted text' 2>/dev/null ${HOME} 2>/dev/null sed then echo
+	"$@" sed 2>/dev/null echo sed /usr/bin | "$1" "$1" local /usr/bin
+'quoted text' x=1 awk x=1 /usr/bin --verbose export 'quoted text' | printf
+	/usr/bin local "$1" echo | readonly | "$@" test readonly /usr/bin 2>/dev/null ${HOME}
+		local cd /usr/bin printf readonly awk --verbose 2>/dev/null
+printf x=1 grep echo cd 2>/dev/null then -eu cd echo $(pwd) -eu &&
+| local sed 2>/dev/null awk printf cd awk cd printf ${HOME}
+local ${HOME} sed && 2>/dev/null readonly then
+	x=1 echo /usr/bin cd cd test /usr/bin done export 2>/dev/null grep awk ${HOME}
+		sed test printf done "$1" /usr/bin
+cd ${HOME} 2>/dev/null &&
+		-eu echo x=1 "$1" --verbose
+		readonly grep readonly 2>/dev/null done "$1" test sed "$@" && ${HOME} done
+printf | grep | export x=1 cd readonly readonly ${HOME}
+		then /usr/bin grep -eu awk grep | 'quoted text' sed local then -eu export
+	cd then ${HOME} then $(pwd) awk
+		-eu cd ${HOME} echo then
+--verbose && local then printf readonly printf |
+	printf && 'quoted text'
+	awk $(pwd) 2>/dev/null "$@" 'quoted text' local x=1 && /usr/bin ${HOME} -eu awk
+2>/dev/null "$1" x=1 local then grep echo && cd "$@" export ${HOME}
+		"$1" ${HOME} sed x=1 x=1 awk 'quoted text'
+grep "$1" && "$1" 'quoted text' -eu
+	| sed | ${HOME} test done awk test /usr/bin local ${HOME} "$1" ${HOME}
+		sed local awk --verbose $(pwd) "$@" -eu "$1"
+		"$1" $(pwd) cd x=1 "$@" $(pwd)
+	grep then done -eu 2>/dev/null cd test done
+	local readonly local 2>/dev/null && awk $(pwd) --verbose ${HOME} readonly
+	printf test "$@" --verbose readonly -eu cd x=1 | then /usr/bin test ${HOME} --verbose
+	--verbose /usr/bin done grep awk 2>/dev/null grep | ${HOME}
+	"$@" x=1 awk done $(pwd) ${HOME} echo cd
+	local "$@" test test awk x=1 ${HOME} | && "$1" printf sed &&
+	"$1" awk awk export | cd awk
+${HOME} done x=1 2>/dev/null 'quoted text' --verbose
+test then x=1 local $(pwd) "$@" 'quoted text' | 2>/dev/null x=1
+	--verbose x=1 "$1" --verbose | | printf
+	-eu export done printf grep 'quoted text' export --verbose
+		echo -eu local grep ${HOME} test /usr/bin && cd "$@" && sed 'quoted text'
+	then cd --verbose then /usr/bin export cd | "$@" 2>/dev/null "$@"
+		then export 'quoted text'
+		-eu cd && && | printf test grep -eu cd readonly | 2>/dev/null /usr/bin
+		2>/dev/null -eu export test then grep grep
+		2>/dev/null /usr/bin x=1 $(pwd) 2>/dev/null
+		&& readonly printf local --verbose
+	/usr/bin export --verbose
+--verbose 2>/dev/null then done local readonly "$1" /usr/bin
+		| "$@" ${HOME} ${HOME} ${HOME} 'quoted text' 2>/dev/null
+x=1 2>/dev/null cd cd $(pwd) echo | local 2>/dev/null readonly export | "$1"
+		"$@" ${HOME} sed cd --verbose /usr/bin x=1 /usr/bin
+"$@" readonly $(pwd) ${HOME} $(pwd) | test -eu
+	echo sed "$@" --verbose readonly "$1" ${HOME} cd printf
+		/usr/bin grep done "$@" echo export test echo 'quoted text' $(pwd) | --verbose
+'quoted text' grep ${HOME} "$@" test printf && /usr/bin
+	grep echo sed --verbose export done echo
+		$(pwd) x=1 "$@" 'quoted text'
+	sed export done sed /usr/bin sed --verbose "$1" then echo grep x=1 echo export
+	x=1 test cd grep then test test cd export $(pwd) $(pwd) cd
+	"$1" ${HOME} export ${HOME} "$@" echo x=1 sed export
+--verbose grep "$1" x=1 printf then x=1 $(pwd) $(pwd) $(pwd) 2>/dev/null
+	then cd 'quoted text' | -eu sed cd "$@"
+		grep readonly -eu x=1 printf 'quoted text' export echo
+${HOME} x=1 printf then printf test test "$@" && grep "$1"
+${HOME} readonly "$1" readonly readonly && -eu printf
+		export /usr/bin grep grep grep | "$@" done /usr/bin && -eu local
+		"$@" echo x=1 "$1" /usr/bin
+'quoted text' /usr/bin export echo
+		then --verbose echo /usr/bin sed local echo
+	sed readonly && x=1 local $(pwd) | then | 'quoted text'
+		sed done done -eu done | && "$1" | sed test && "$1" grep test "$1" x=1
+		-eu --verbose --verbose export awk local --verbose
+printf local cd --verbose | 'quoted text' sed && -eu grep sed then "$1"
+test local "$1" | --verbose test
+	-eu then readonly 'quoted text' x=1 "$1" $(pwd) readonly -eu x=1 "$@"
+		echo export --verbose sed
+		echo "$1" grep then grep /usr/bin printf sed then "$1"
+	test 'quoted text' --verbose x=1 test x=1 export done export
+-eu 2>/dev/null local | sed printf 'quoted text'
+		2>/dev/null export grep ${HOME} -eu cd && && 'quoted text' --verbose | /usr/bin
+	$(pwd) "$1" sed test /usr/bin echo awk grep
+	grep test /usr/bin cd x=1 readonly --verbose ${HOME}
+	$(pwd) echo "$@" export then test x=1 printf export
+	$(pwd) cd printf --verbose
+	/usr/bin local 'quoted text' test $(pwd) $(pwd) --verbose 2>/dev/null
+		${HOME} && sed /usr/bin
+cd grep --verbose export | "$@" readonly "$@" "$@" $(pwd) sed local "$@"
+		&& export && "$@" done sed echo export ${HOME} grep
+		'quoted text' local /usr/bin local "$@" awk /usr/bin printf -eu ${HOME}
+	"$@" 'quoted text' "$1" cd cd -eu cd | && "$@" cd | "$1" sed done && done ${HOME}
+		readonly grep x=1 printf --verbose
+	cd ${HOME} readonly sed $(pwd) local
+sed "$1" "$1" -eu readonly readonly printf 'quoted text'
+		'quoted text' done -eu local 'quoted text'
+local awk "$@" export /usr/bin ${HOME} done $(pwd) export 2>/dev/null echo
+		echo ${HOME} x=1 sed $(pwd)
+	--verbose | | done export "$1" x=1 /usr/bin "$@" local cd && 'quoted text'
+		/usr/bin then sed x=1 echo grep /usr/bin
+	$(pwd) -eu ${HOME} && -eu echo "$1" ${HOME}
+	$(pwd) done local /usr/bin && awk $(pwd) --verbose | && 2>/dev/null -eu /usr/bin
+		-eu cd cd readonly awk && echo 'quoted text' "$1" |
+		sed -eu printf awk && /usr/bin readonly 'quoted text' cd grep readonly
+	| printf 'quoted text' awk local cd 2>/dev/null
+		--verbose then | /usr/bin -eu 'quoted text' grep
+	${HOME} "$@" 2>/dev/null cd readonly 'quoted text' 'quoted text'
+	-eu printf $(pwd) sed test 2>/dev/null -eu done ${HOME} 2>/dev/null
+	then -eu cd /usr/bin
+sed done 'quoted text' $(pwd) done "$1" then | then && "$@"
+${HOME} ${HOME} | 2>/dev/null done export awk --verbose "$1" done &&
+	echo then readonly awk export /usr/bin && $(pwd)
+	&& ${HOME} 2>/dev/null test done local ${HOME} printf readonly
+	echo && cd 2>/dev/null awk && cd x=1 && $(pwd) then test awk grep
+test cd readonly echo test grep 'quoted text' awk --verbose 2>/dev/null then
+	grep export | readonly export ${HOME} | && /usr/bin readonly cd -eu done
+		cd echo --verbose test test --verbose /usr/bin
+		'quoted text' x=1 -eu export export | echo readonly /usr/bin -eu x=1 -eu cd
+		printf done test | 'quoted text'
+		&& then sed ${HOME} echo 'quoted text'
+test "$@" then && --verbose -eu readonly awk local sed $(pwd) "$1"
+		grep "$1" local awk 2>/dev/null then printf test then grep /usr/bin
+	$(pwd) export grep local
+--verbose then ${HOME} printf echo printf test local
+	-eu local echo 2>/dev/null test /usr/bin "$@" 2>/dev/null test sed cd done sed
+--verbose sed /usr/bin "$@"
+		-eu export x=1 /usr/bin export done done then test x=1 local cd then "$1" -eu
+	printf echo ${HOME} | test "$1" ${HOME} then | test echo test -eu grep awk
+		awk local local echo $(pwd) local local && 2>/dev/null -eu | -eu readonly
+-eu && "$@" then readonly ${HOME} sed test done "$@" awk echo test echo local
+printf then echo | | awk 'quoted text' --verbose x=1
+		${HOME} "$1" 'quoted text' readonly echo awk 'quoted text' /usr/bin
+2>/dev/null then then local | /usr/bin sed local
+	${HOME} -eu ${HOME} grep | grep "$1" then 2>/dev/null ${HOME} sed
+		x=1 "$@" awk $(pwd) -eu /usr/bin done 'quoted text'
+2>/dev/null export /usr/bin then $(pwd)
+awk local then && $(pwd) && --verbose
+export awk 'quoted text' done readonly
+then 'quoted text' /usr/bin --verbose
+| $(pwd) | cd "$@" 2>/dev/null
+	| x=1 ${HOME} "$1" | test "$1" $(pwd) | grep
+done 'quoted text' /usr/bin cd local cd "$1" 'quoted text' awk echo export
+sed echo && "$1" --verbose 'quoted text' done $(pwd)
+awk $(pwd) /usr/bin cd x=1 grep local sed -eu local local $(pwd)
+'quoted text' ${HOME} cd 2>/dev/null 2>/dev/null
+		-eu /usr/bin grep $(pwd)
+	'quoted text' 'quoted text' test sed local awk "$1"
+		then test /usr/bin 'quoted text' local -eu done "$1" cd awk sed grep sed done
+		2>/dev/null sed x=1 grep -eu export awk -eu
+		then "$1" done test --verbose ${HOME} -eu test --verbose
+		2>/dev/null ${HOME} "$1" && ${HOME} readonly readonly local grep --verbose
+	then /usr/bin /usr/bin done sed "$@" printf printf "$@" /usr/bin test
+x=1 | done cd | $(pwd) ${HOME} readonly echo 'quoted text'
+	$(pwd) sed /usr/bin done printf "$@" readonly
+		$(pwd) $(pwd) sed printf then test -eu &&
+x=1 "$1" /usr/bin export then && /usr/bin --verbose local sed export grep
+	/usr/bin && test export "$@" 2>/dev/null printf printf $(pwd) "$1" "$1" 2>/dev/null
+		$(pwd) | test | echo | x=1 --verbose test && awk printf
+		'quoted text' local readonly --verbose /usr/bin then 'quoted text' awk
+	export | test export
+-eu 2>/dev/null sed test readonly
+local done readonly grep awk test printf printf
+	printf "$@" grep && awk "$1" test "$@" && --verbose "$@" sed cd "$@" then 2>/dev/null
+		done export $(pwd) $(pwd) awk test x=1 printf
+		${HOME} test export done && "$1" "$@" echo x=1 sed cd awk 2>/dev/null local awk
+printf 2>/dev/null local ${HOME} sed x=1 cd then
+		2>/dev/null $(pwd) local printf echo 'quoted text' 2>/dev/null then export
+	--verbose && done done
+		--verbose export 'quoted text' then cd | local readonly -eu | 'quoted text'
+"$@" awk cd done $(pwd) export | test done awk ${HOME} --verbose -eu local
+	test "$@" ${HOME} readonly done awk printf
+		done x=1 printf export 'quoted text'
+done "$@" cd export --verbose echo "$@" sed x=1 cd local && then export
+	test local local 2>/dev/null x=1 && local "$@"
+/usr/bin --verbose local
+| export "$1" && done readonly readonly
+		x=1 2>/dev/null --verbose export
+'quoted text' awk echo sed "$1" ${HOME} awk | --verbose
+#include c202.sh
+grep ${HOME} "$@" -eu $(pwd) $(pwd) then local grep /usr/bin awk
+printf --verbose test "$1" $(pwd) && -eu
+sed | test $(pwd) /usr/bin /usr/bin "$@" cd awk grep
+test readonly "$@" 'quoted text' ${HOME} sed
+		$(pwd) x=1 'quoted text' --verbose --verbose
+done -eu echo 2>/dev/null cd --verbose grep /usr/bin 2>/dev/null local "$@"
+/usr/bin -eu x=1 done cd sed awk 'quoted text' && grep "$@"
+	awk 'quoted text' $(pwd) -eu readonly x=1 test then x=1 done then
+	x=1 $(pwd) cd -eu then readonly && /usr/bin && $(pwd) $(pwd) 2>/dev/null readonly
+	sed -eu | then then local &&
+$(pwd) "$@" -eu 2>/dev/null 2>/dev/null export
+test awk cd grep --verbose printf -eu awk readonly
+		grep 'quoted text' -eu 'quoted text' /usr/bin test | /usr/bin x=1 "$@"
+local 'quoted text' readonly && -eu export
+"$@" cd && cd "$@" awk 'quoted text'
+	2>/dev/null cd sed "$1" then
+		sed then && | readonly printf --verbose export
+then ${HOME} 'quoted text' --verbose then && awk $(pwd) export awk "$@" --verbose
+		printf printf export && test "$@" echo /usr/bin echo 2>/dev/null -eu
+	--verbose sed $(pwd) cd | ${HOME} then 2>/dev/null 'quoted text'
+--verbose && sed done $(pwd) echo printf printf "$1" | printf export /usr/bin
+	export awk printf test export grep readonly /usr/bin
+done 2>/dev/null export local ${HOME} echo done
+sed -eu /usr/bin cd ${HOME} ${HOME} x=1 export printf x=1 --verbose | awk -eu
+		${HOME} local $(pwd) done $(pwd) "$@" printf /usr/bin export | -eu done
+'quoted text' awk "$1"
+	/usr/bin --verbose done x=1 $(pwd) printf done test "$@" echo "$@" test
+	/usr/bin 2>/dev/null x=1 export echo local printf
+	sed grep export printf grep x=1 x=1 | && | $(pwd) printf $(pwd) $(pwd)
+	$(pwd) --verbose -eu x=1 export
+2>/dev/null cd "$@" $(pwd) export done echo $(pwd) done echo export "$1"
+x=1 "$1" grep cd grep 2>/dev/null
+local && ${HOME} awk /usr/bin
+		x=1 $(pwd) local "$1" grep printf | echo "$1" readonly
+--verbose x=1 local 'quoted text' cd x=1 awk 2>/dev/null
+	cd printf local $(pwd) done echo |
+| -eu "$@" grep done /usr/bin done "$@"
+	readonly && 2>/dev/null awk local readonly "$1" --verbose 'quoted text'
+		"$@" 2>/dev/null done cd done $(pwd)
+${HOME} x=1 echo cd cd 2>/dev/null local ${HOME}
+	then 2>/dev/null sed "$@" "$1" local readonly echo "$@" /usr/bin
+readonly sed ${HOME} sed echo echo sed cd 2>/dev/null 2>/dev/null "$1"
+-eu export ${HOME} done -eu | -eu local 2>/dev/null | x=1 ${HOME} cd
+		sed | $(pwd) echo printf -eu echo sed awk "$@" && test awk "$1" "$1"
+	&& x=1 $(pwd) awk awk readonly ${HOME} /usr/bin 'quoted text'
+--verbose grep done | --verbose echo 2>/dev/null echo sed "$@" $(pwd)
+then ${HOME} export "$@" readonly $(pwd) sed "$1" 'quoted text'
+	/usr/bin then export done cd /usr/bin 2>/dev/null
+	&& "$1" -eu --verbose "$@" 2>/dev/null export 2>/dev/null 2>/dev/null then awk |
+		"$1" /usr/bin "$1" $(pwd)
+	echo done cd $(pwd) x=1 x=1 --verbose ${HOME} | grep local x=1 | "$@" x=1 2>/dev/null
+${HOME} -eu cd /usr/bin x=1
+	'quoted text' -eu -eu | done test -eu local test cd "$@" ${HOME} readonly "$1"
+2>/dev/null test $(pwd) local done readonly "$1" x=1 -eu $(pwd)
+	echo | /usr/bin /usr/bin && sed sed echo echo 2>/dev/null then echo then "$1"
+	--verbose -eu "$1" --verbose x=1 echo printf cd local then export readonly "$@"
+		-eu x=1 "$1" cd --verbose grep ${HOME} "$1" printf
+	printf grep printf ${HOME} awk cd awk then
+echo --verbose cd --verbose /usr/bin |
+		${HOME} 2>/dev/null 'quoted text' printf printf local
+	$(pwd) 'quoted text' && 2>/dev/null grep /usr/bin local "$1" $(pwd) readonly
+		export /usr/bin sed /usr/bin sed
+		awk /usr/bin "$1" "$1" ${HOME} $(pwd) -eu printf x=1 sed test grep grep
+	sed done && readonly "$@" export "$1" 2>/dev/null $(pwd) echo && awk
+	readonly /usr/bin 'quoted text' $(pwd) cd && "$1" &&
+		export "$1" --verbose x=1 ${HOME} -eu done && export local --verbose "$@"
+		| 2>/dev/null --verbose -eu 2>/dev/null --verbose x=1 ${HOME} export
+		| /usr/bin printf | ${HOME} export ${HOME} --verbose
+awk echo x=1 echo export echo local ${HOME} readonly ${HOME} "$@" 2>/dev/null
+	-eu cd awk local x=1 export "$1" done && "$1" readonly cd printf cd /usr/bin ${HOME}
+'quoted text' done local done "$1" printf $(pwd) --verbose /usr/bin readonly
+	done done ${HOME} test ${HOME} then then
+grep && sed ${HOME} x=1 printf && done | "$@" awk "$1" ${HOME} export
+	-eu -eu cd 'quoted text' readonly printf
+		echo local test test local cd "$@"
+		--verbose 'quoted text' export local then 2>/dev/null sed x=1 /usr/bin -eu --verbose
+		echo | then 'quoted text' readonly | | test awk -eu done x=1 test $(pwd) readonly
+	${HOME} 'quoted text' && cd done awk grep printf 'quoted text'
+		sed x=1 --verbose printf
+	| grep sed test "$1" /usr/bin ${HOME} then $(pwd) 'quoted text' done readonly
+'quoted text' printf | ${HOME}
+test "$1" "$@" awk done then printf | "$1" local ${HOME} local $(pwd) local "$1"
+| --verbose -eu 2>/dev/null test $(pwd) && sed sed "$1" done sed 2>/dev/null "$1"
+sed "$@" printf 2>/dev/null printf sed 'quoted text' | "$1" ${HOME} test
+		&& awk "$@" test grep -eu cd --verbose printf export
+		2>/dev/null local x=1 $(pwd) sed echo cd 'quoted text' done awk
+		--verbose $(pwd) | cd then
+		&& echo $(pwd) 2>/dev/null -eu awk cd --verbose
+	grep && && printf done readonly ${HOME} sed 2>/dev/null test "$1" | readonly
+	readonly 2>/dev/null "$@" --verbose | echo then export
+--verbose --verbose $(pwd) --verbose 'quoted text' export
+		2>/dev/null awk 2>/dev/null cd ${HOME} readonly
+	echo --verbose && ${HOME} test
+	echo awk /usr/bin grep && "$@" "$1" 2>/dev/null /usr/bin local && $(pwd)
+		&& test $(pwd) grep ${HOME} cd -eu && ${HOME} 'quoted text'
+	echo $(pwd) sed 2>/dev/null ${HOME} readonly "$@" local echo
+		grep readonly "$@" done
+awk --verbose printf export 'quoted text' ${HOME} cd | $(pwd)
+		/usr/bin "$@" echo echo -eu x=1 local echo readonly
+		printf sed awk export readonly 2>/dev/null echo echo /usr/bin readonly
+| readonly cd ${HOME} awk echo printf printf
+		done printf 'quoted text' test sed done export printf sed
+export --verbose /usr/bin sed grep "$@" readonly local --verbose
+		| /usr/bin readonly echo $(pwd) ${HOME} printf cd x=1 && ${HOME}
+		export 2>/dev/null x=1 -eu readonly
+test $(pwd) && cd "$@" && grep printf --verbose grep ${HOME} echo x=1 -eu -eu
+2>/dev/null echo cd printf printf "$@" /usr/bin
+"$@" cd 2>/dev/null readonly x=1 ${HOME} $(pwd) x=1 --verbose x=1 sed grep then
+	--verbose x=1 test export --verbose "$@" $(pwd) ${HOME}
+		/usr/bin then grep grep printf local -eu && -eu
+	sed readonly $(pwd) --verbose "$1"
+		"$@" $(pwd) grep sed echo done export "$@" --verbose $(pwd) | $(pwd) local
+		"$@" x=1 "$1" && "$@" test "$@" grep printf && readonly -eu grep /usr/bin
+$(pwd) -eu "$@" local cd printf $(pwd) ${HOME}
+	cd $(pwd) 2>/dev/null done done /usr/bin grep $(pwd)
+x=1 "$@" "$@" then && awk "$1"
+		readonly cd $(pwd) echo done cd -eu && | sed awk
+/usr/bin /usr/bin test export x=1 done local ${HOME} /usr/bin
+| then test -eu local ${HOME}
+awk cd 2>/dev/null "$1"
+-eu then test cd done done -eu -eu
+--verbose awk "$1" && sed --verbose printf export done sed | /usr/bin
+readonly /usr/bin && awk test printf $(pwd)
+	${HOME} /usr/bin then local printf -eu readonly
+	/usr/bin $(pwd) grep export /usr/bin echo
+		"$1" && 2>/dev/null x=1 readonly awk ${HOME} done then readonly
+test printf cd test awk sed cd /usr/bin
+--verbose printf | cd /usr/bin done $(pwd) && cd cd then done x=1 "$1" | | local
+x=1 echo done then echo -eu
+readonly $(pwd) 2>/dev/null -eu cd /usr/bin then grep 2>/dev/null test -eu
+	sed then "$@" test cd export 'quoted text' 2>/dev/null readonly
+"$@" -eu test $(pwd) --verbose 'quoted text' /usr/bin grep grep
+	-eu done x=1 -eu done test --verbose x=1 printf sed $(pwd)
+		local -eu ${HOME} printf then
+		test readonly printf 2>/dev/null x=1 2>/dev/null 'quoted text'
+		"$1" && && | -eu awk x=1 readonly
+		then local --verbose 'quoted text' cd "$1" cd
+		$(pwd) /usr/bin /usr/bin 2>/dev/null export
+"$@" 2>/dev/null local 2>/dev/null grep /usr/bin
+	then sed export test cd -eu 'quoted text'
+		| ${HOME} 2>/dev/null ${HOME} 'quoted text' 2>/dev/null export
+test sed echo echo grep | sed x=1
+	then && "$@" /usr/bin readonly "$1" && then grep x=1 2>/dev/null && "$@" then sed
+	then printf done then 2>/dev/null
+	-eu local printf sed local local
+		sed ${HOME} 2>/dev/null ${HOME} awk local
+	-eu | "$1" local awk | awk | /usr/bin ${HOME} then
+	export grep $(pwd) sed readonly sed 2>/dev/null $(pwd) test | $(pwd)
+echo /usr/bin test x=1 2>/dev/null
+	-eu "$@" -eu done ${HOME} awk test done local local "$@" ${HOME} -eu printf
+	test ${HOME} echo 'quoted text' "$1" done awk local x=1 printf local /usr/bin
+	awk printf $(pwd) done 2>/dev/null --verbose sed export && 'quoted text' -eu awk
+	&& && then | x=1 grep ${HOME} cd | "$1" && | "$1" printf echo sed sed
+readonly x=1 && 'quoted text' echo cd done 2>/dev/null
+$(pwd) ${HOME} test local 2>/dev/null x=1 awk /usr/bin
+	$(pwd) local "$@" done "$1" 'quoted text'
+	readonly grep 'quoted text' /usr/bin
+		"$1" "$@" --verbose export 2>/dev/null grep && ${HOME} "$@" sed ${HOME} awk
+	done cd 'quoted text' done sed $(pwd) local awk awk awk sed
+echo awk "$@" cd sed 2>/dev/null -eu readonly 2>/dev/null local && "$1"
+		--verbose /usr/bin && done echo "$@" 'quoted text' 'quoted text'
+	echo export local grep 2>/dev/null $(pwd) 'quoted text' 'quoted text' 2>/dev/null
+		export x=1 x=1 'quoted text' | "$@" x=1 x=1 echo "$1" cd printf then
+		| readonly local done export local grep test test
+awk test echo cd "$1" export local local x=1 -eu done 'quoted text'
+		x=1 $(pwd) sed | -eu "$@" ${HOME} echo $(pwd) then "$1" $(pwd)
+		$(pwd) sed done echo | "$@" $(pwd) awk done sed printf 'quoted text' sed "$1" --verbose
+	"$1" 2>/dev/null x=1 --verbose "$@" && local cd ${HOME}
+sed printf done export grep then local
+sed test grep test grep $(pwd) 2>/dev/null
+&& ${HOME} && $(pwd) 2>/dev/null local x=1 2>/dev/null ${HOME} cd "$@" 'quoted text'
+local "$1" awk test $(pwd) cd --verbose
+		test "$1" ${HOME} --verbose | sed cd x=1 x=1 "$@"
+	x=1 'quoted text' 2>/dev/null
+	cd --verbose && /usr/bin local test sed sed
+	echo x=1 echo cd then grep sed | | cd $(pwd) -eu readonly grep
+	$(pwd) printf grep -eu 2>/dev/null 'quoted text' test --verbose
+		cd done 'quoted text' 2>/dev/null
+		"$1" then cd ${HOME} then sed export sed | 2>/dev/null "$@"
+		-eu done /usr/bin cd 2>/dev/null awk "$1" && printf | "$1"
+		${HOME} printf local "$@" "$1" 'quoted text' echo --verbose export
+'quoted text' /usr/bin "$1" grep 2>/dev/null echo cd echo
+2>/dev/null 'quoted text' /usr/bin --verbose local
+		"$1" /usr/bin printf ${HOME} printf $(pwd) cd 'quoted text'
+	-eu test printf 'quoted text' grep /usr/bin
+		local 2>/dev/null test "$@" done then
+-eu printf local ${HOME} sed x=1 awk /usr/bin "$@" printf awk && then
+local local echo 'quoted text' "$1" cd -eu "$1" awk "$1" 'quoted text'
+		x=1 x=1 /usr/bin then echo export /usr/bin ${HOME} then local export --verbose
+		printf | local "$@" -eu
+grep sed echo cd grep -eu | -eu printf
+	x=1 printf ${HOME} awk done x=1 -eu local echo
+	'quoted text' grep echo 2>/dev/null then test $(pwd) grep grep printf
+		${HOME} then awk awk ${HOME} grep readonly
+	/usr/bin cd echo grep | local then /usr/bin -eu "$@"
+	| test $(pwd) echo ${HOME} /usr/bin && --verbose |
+	echo ${HOME} printf "$1" ${HOME} printf sed readonly awk
+	| /usr/bin | 'quoted text' ${HOME} -eu "$@" test awk x=1 /usr/bin /usr/bin ${HOME}
+	| ${HOME} readonly ${HOME} /usr/bin $(pwd) cd grep test grep "$1" 'quoted text'
+		export export then /usr/bin
+awk then --verbose -eu echo sed sed --verbose sed readonly export "$@" |
+		-eu test test cd ${HOME} 2>/dev/null /usr/bin export
+test /usr/bin "$1" sed "$@" export 'quoted text' && echo 2>/dev/null
+		${HOME} printf "$@" grep grep
+		local | export test then local "$1" /usr/bin printf 2>/dev/null x=1 done
+	x=1 done printf 'quoted text' ${HOME} done ${HOME} "$1" 'quoted text' test
+	echo "$1" done -eu local -eu readonly | $(pwd)
+/usr/bin awk 'quoted text' grep sed "$1" export
+	$(pwd) awk "$1" grep 'quoted text' 2>/dev/null readonly ${HOME} x=1
+		--verbose printf ${HOME} "$@" cd && readonly export -eu test sed 2>/dev/null
+		--verbose $(pwd) cd awk cd /usr/bin then echo then done echo
+-eu sed local cd grep
+		grep "$@" $(pwd) sed readonly /usr/bin
+		/usr/bin | && $(pwd) $(pwd) printf test 2>/dev/null printf
+local done 2>/dev/null
+"$1" export awk export printf awk export ${HOME} $(pwd) then 'quoted text'
+		test x=1 test | then done cd | && "$@" grep /usr/bin
+	${HOME} sed printf | "$1" local export printf cd 'quoted text' local -eu
+		$(pwd) && local x=1 ${HOME} local ${HOME} sed test && "$@" 'quoted text'
+	&& /usr/bin ${HOME} x=1 x=1 'quoted text' x=1 sed done sed then awk printf printf
+	/usr/bin ${HOME} cd sed grep x=1 grep $(pwd) -eu "$@" local 2>/dev/null
+local sed -eu grep "$@" && "$1" 2>/dev/null
+	cd 'quoted text' 'quoted text' 'quoted text' grep --verbose awk "$@" test -eu --verbose
+x=1 $(pwd) done "$@" /usr/bin readonly
+		| awk export && sed printf $(pwd)
+		| sed export ${HOME} 'quoted text' done export printf 'quoted text'
+	${HOME} 2>/dev/null cd then sed grep && cd | | test cd && ${HOME} | | &&
+	local /usr/bin 'quoted text' sed echo
+	-eu ${HOME} test local test $(pwd) /usr/bin export readonly $(pwd) grep grep done
+		grep -eu cd local 2>/dev/null export echo printf export 'quoted text'
+		$(pwd) $(pwd) -eu | readonly readonly --verbose 'quoted text'
+	echo ${HOME} --verbose 2>/dev/null printf -eu 'quoted text' "$@" --verbose /usr/bin
+		sed "$@" "$1" local 2>/dev/null x=1 readonly "$@"
+	${HOME} sed awk /usr/bin "$@" printf --verbose x=1 done echo /usr/bin done
+		-eu grep test $(pwd) echo done 'quoted text'
+		&& /usr/bin --verbose cd cd x=1
+		readonly local 2>/dev/null 2>/dev/null grep -eu then && |
+		printf test --verbose
+		readonly /usr/bin echo echo 2>/dev/null done
+	test | export grep /usr/bin grep done grep done 'quoted text' "$@" /usr/bin
+	&& "$@" cd echo export printf grep -eu
+	| cd 2>/dev/null 'quoted text' --verbose | --verbose --verbose
+		awk -eu echo export ${HOME} ${HOME} "$1" "$1" cd x=1
+		printf x=1 2>/dev/null cd -eu /usr/bin
+readonly echo "$1" test test echo cd --verbose echo "$@" x=1
+	export readonly --verbose --verbose grep --verbose
+		x=1 /usr/bin x=1 awk && $(pwd) export cd && cd 2>/dev/null local awk local export
+	x=1 awk done ${HOME} sed readonly 'quoted text' "$1" $(pwd) -eu readonly
+		x=1 cd "$1" 2>/dev/null local && -eu printf ${HOME} sed ${HOME} "$@" printf readonly
+		'quoted text' cd 'quoted text'
+	${HOME} /usr/bin /usr/bin | test ${HOME} /usr/bin -eu 2>/dev/null
+awk local export | sed $(pwd) test /usr/bin "$@" echo echo done 2>/dev/null
+test "$1" --verbose grep
+		then local 2>/dev/null "$1" | cd awk awk /usr/bin && "$@" ${HOME}
+cd "$@" "$1" echo 2>/dev/null "$@" cd then
+echo x=1 awk readonly then then | sed cd 'quoted text'
+		echo sed export | readonly | 2>/dev/null test --verbose -eu sed local
+	then x=1 printf x=1 "$1"
+	/usr/bin -eu echo sed ${HOME} sed 2>/dev/null echo $(pwd) $(pwd) sed
+x=1 ${HOME} then grep "$1" ${HOME} local readonly "$1" && "$1"
+		${HOME} cd sed grep -eu && echo 'quoted text' local test readonly
+	${HOME} awk sed local 2>/dev/null $(pwd) export test --verbose
+"$@" printf readonly $(pwd) "$@" "$@" "$@" done local 'quoted text'
+	test then "$1" x=1 test -eu done readonly
+"$@" ${HOME} x=1 ${HOME} 'quoted text' /usr/bin test done "$1" | | -eu
+awk | echo readonly ${HOME} printf "$@" 2>/dev/null --verbose
+		"$1" && printf local && printf && done "$1"
+		test "$@" -eu readonly && 2>/dev/null
+		$(pwd) $(pwd) test local | | sed /usr/bin done grep cd -eu
+	local done -eu grep -eu test printf && $(pwd) "$1" 2>/dev/null export
+printf 2>/dev/null ${HOME}
+	-eu awk x=1 2>/dev/null "$1"
+		echo local local cd $(pwd) "$@" sed done then local done | grep local
+		$(pwd) grep printf cd grep /usr/bin grep --verbose 2>/dev/null
+/usr/bin readonly 'quoted text' done done 2>/dev/null "$1" cd cd -eu "$@"
+		awk cd export $(pwd) grep ${HOME} --verbose cd /usr/bin cd then
+	"$1" echo awk "$1" sed /usr/bin then 2>/dev/null ${HOME}
+		$(pwd) "$1" export && test grep --verbose "$@" /usr/bin local
+		/usr/bin cd && local awk readonly echo cd done grep 2>/dev/null /usr/bin 'quoted text'
+		| sed --verbose ${HOME} done "$1"
+&& "$@" "$1" | -eu done 'quoted text'
+	printf readonly local done 2>/dev/null printf echo && ${HOME}
+then echo local /usr/bin printf 2>/dev/null
+sed test test 'quoted text' local sed $(pwd) 2>/dev/null --verbose
+"$@" awk 2>/dev/null 2>/dev/null readonly test sed test "$1" 'quoted text'
+	then sed export done grep readonly
+		'quoted text' /usr/bin "$1" "$1"
+	--verbose readonly then ${HOME} test 2>/dev/null "$1"
+	-eu echo && printf && 'quoted text'
+		x=1 then -eu --verbose 2>/dev/null /usr/bin 2>/dev/null
+	awk readonly local 'quoted text' printf x=1 grep "$@" "$@" |
+		done ${HOME} 'quoted text' --verbose
+	x=1 readonly | test ${HOME} printf done "$@" 'quoted text'
+test x=1 cd "$@" && | && "$@" export $(pwd) echo --verbose then
+		done $(pwd) test done grep test cd x=1
+&& x=1 test "$@" echo 'quoted text'
+	readonly echo export echo then
+export 'quoted text' -eu "$1"
+		/usr/bin -eu then local readonly 2>/dev/null sed local local test sed ${HOME} sed
+		export | | x=1 "$@" export "$@"
+		$(pwd) 2>/dev/null && echo -eu done printf readonly
+| awk awk grep readonly cd "$@" x=1 printf | && done | awk done sed then
+		2>/dev/null readonly 2>/dev/null -eu x=1 done test 'quoted text'
+		x=1 2>/dev/null 'quoted text' sed -eu awk
+local && grep "$1" test sed readonly awk cd "$@" then && && 2>/dev/null -eu
+		cd $(pwd) x=1 echo test readonly
+	test echo /usr/bin $(pwd) readonly | 'quoted text' 'quoted text' -eu done -eu
+	$(pwd) then readonly
+		$(pwd) /usr/bin "$@" awk -eu done then then awk | then /usr/bin 2>/dev/null
+cd test x=1 then printf 'quoted text'
+		'quoted text' export cd then x=1 x=1 | export -eu done awk grep "$1" cd
+sed 2>/dev/null && -eu grep
+x=1 cd printf cd export cd 2>/dev/null 2>/dev/null "$1" --verbose echo /usr/bin
+		/usr/bin x=1 "$1" "$1" x=1 -eu --verbose && done && done printf grep 'quoted text'
+printf local sed then && done | then --verbose
+		--verbose grep echo &&
+	echo /usr/bin "$1" awk printf echo 2>/dev/null x=1 echo "$1" echo ${HOME} 'quoted text'
+		&& awk echo readonly 'quoted text' /usr/bin
+	printf export local /usr/bin 'quoted text' x=1 | 'quoted text'
+		2>/dev/null 'quoted text' ${HOME}
+		2>/dev/null && "$1" test $(pwd) $(pwd) -eu | awk awk sed readonly --verbose $(pwd)
+| test then x=1 sed -eu then sed 'quoted text'
+$(pwd) export done grep -eu then
+"$1" $(pwd) "$@" awk then sed then cd export /usr/bin | cd echo --verbose
+--verbose test $(pwd) 'quoted text' test export readonly then
+		grep then "$@" grep $(pwd) $(pwd) | | | export awk echo -eu sed grep
+		x=1 echo --verbose && 'quoted text' "$1" awk "$1" 'quoted text'
+x=1 && export $(pwd) test grep export
+	local cd 2>/dev/null readonly then --verbose done
+		then printf "$@" test | /usr/bin export
+	sed && readonly "$1" done $(pwd) 'quoted text' /usr/bin ${HOME} -eu then
+	sed readonly -eu printf grep local --verbose "$1" grep $(pwd) "$1" grep
+	printf 'quoted text' && "$1" $(pwd) then -eu
+2>/dev/null test x=1 | done export && 2>/dev/null
+x=1 sed "$@" export -eu ${HOME} $(pwd) readonly export $(pwd)
+	${HOME} -eu export $(pwd)
+		export local echo echo "$@" -eu echo echo awk "$@" ${HOME} $(pwd) /usr/bin
+readonly && 'quoted text' "$1" readonly x=1 'quoted text' &&
+		${HOME} && printf /usr/bin $(pwd) printf 2>/dev/null 'quoted text'
+	cd 2>/dev/null export sed local grep x=1 local readonly awk local awk
+x=1 | awk && printf -eu x=1 "$@"
+		local | $(pwd) x=1 grep done 2>/dev/null $(pwd)
+"$@" grep "$@" x=1 grep ${HOME}
+		printf echo x=1 readonly "$@"
+	local 'quoted text' awk export echo local 2>/dev/null readonly
+	awk $(pwd) then done readonly
+	readonly --verbose cd readonly "$@" /usr/bin printf 2>/dev/null
+	-eu && | echo 'quoted text' done readonly sed x=1 2>/dev/null
+done && printf -eu "$@" readonly "$1" cd then
+2>/dev/null done x=1 ${HOME} 'quoted text' readonly 'quoted text' awk x=1 'quoted text'
+	done export "$@" awk "$1" printf | x=1 readonly
+		'quoted text' done echo ${HOME} ${HOME} then done local test
+		done echo grep sed readonly ${HOME} 'quoted text'
+		awk sed | sed $(pwd) awk --verbose -eu "$1" 2>/dev/null 'quoted text' then cd
+grep local done cd then local
+&& "$@" $(pwd) 2>/dev/null export export -eu done cd ${HOME} awk && printf
+		/usr/bin /usr/bin "$@" cd readonly then export x=1 readonly "$@" then
+--verbose local -eu ${HOME} "$@" "$@" 2>/dev/null
+		"$@" x=1 x=1 cd 2>/dev/null
+	echo test /usr/bin /usr/bin printf printf -eu
+		then test -eu && $(pwd) "$1" --verbose readonly -eu local awk
+${HOME} 2>/dev/null cd done
+	readonly /usr/bin 2>/dev/null "$@" $(pwd) awk "$1" echo done printf "$1"
+		-eu export ${HOME} /usr/bin test --verbose 2>/dev/null
+		'quoted text' $(pwd) /usr/bin -eu "$@" test /usr/bin
+	local sed x=1 echo /usr/bin grep local done printf export grep sed
+	2>/dev/null echo | done x=1 "$@" then x=1 2>/dev/null /usr/bin x=1 sed done "$1"
+readonly local readonly export echo echo /usr/bin 'quoted text'
+	printf export cd "$@" then
+local export local echo printf export done ${HOME} export
+/usr/bin done --verbose printf done printf test echo then x=1 ${HOME}
+	2>/dev/null "$@" awk done local echo "$@" 'quoted text' cd
+then ${HOME} local cd test $(pwd)
+test 2>/dev/null 2>/dev/null | echo grep done local sed | cd printf | | 'quoted text'
+	-eu | "$@" && 'quoted text'
+		| local sed done 'quoted text'
+		readonly cd 'quoted text' awk "$1" /usr/bin /usr/bin --verbose readonly -eu
+	"$@" sed grep test grep done echo x=1 "$1" && local
+test 'quoted text' test
+		/usr/bin grep echo grep $(pwd)
+	sed | 'quoted text' cd printf grep
+	| && 'quoted text' 2>/dev/null cd && grep /usr/bin && test test export
+	&& echo -eu --verbose --verbose /usr/bin 'quoted text'
+		cd echo --verbose && echo && "$1" done --verbose
+	2>/dev/null printf /usr/bin --verbose printf --verbose /usr/bin export
+	sed 'quoted text' ${HOME} x=1 grep --verbose -eu then x=1 readonly "$@" printf
+		-eu $(pwd) printf awk sed && done
+| 2>/dev/null awk sed export then grep local sed readonly
+	--verbose $(pwd) echo sed
+		test echo "$1" then ${HOME} sed sed cd export && done
+	readonly | 2>/dev/null "$1" readonly local readonly 2>/dev/null
+printf sed 2>/dev/null | /usr/bin $(pwd) 2>/dev/null
+	"$1" readonly printf --verbose
+-eu printf cd cd | 2>/dev/null export
+		grep test $(pwd) sed 'quoted text' /usr/bin 'quoted text' | cd "$@" cd cd awk
+	/usr/bin $(pwd) echo cd local "$@" local /usr/bin
+"$1" then /usr/bin -eu test x=1 /usr/bin "$@" test cd /usr/bin
+	then | -eu printf awk | grep awk && done
+	awk awk -eu /usr/bin 'quoted text' then test "$@" sed
+export printf | "$1" readonly grep --verbose test local test 2>/dev/null
+$(pwd) awk | then grep --verbose
+/usr/bin 2>/dev/null 'quoted text' cd export ${HOME} done $(pwd) $(pwd)
+		| echo test --verbose cd 2>/dev/null done printf then printf
+		printf 'quoted text' --verbose ${HOME} 2>/dev/null grep echo awk grep
+		echo --verbose test -eu ${HOME} printf local
+	readonly $(pwd) --verbose -eu printf && 'quoted text' local "$1"
+	x=1 -eu && -eu readonly export printf cd readonly echo awk echo local
+"$1" | test "$1" | grep ${HOME} -eu "$@" grep /usr/bin done then ${HOME}
+		grep local 'quoted text' --verbose readonly "$1"
+		local | sed local then then
+$(pwd) readonly readonly done grep cd -eu
+	sed then local awk | x=1 then "$1" then x=1 cd && readonly
+x=1 x=1 ${HOME} printf 2>/dev/null awk -eu cd readonly /usr/bin export
+	cd test -eu -eu test cd echo && export cd cd "$1" echo
+	grep cd ${HOME} /usr/bin --verbose $(pwd) cd 'quoted text'
+2>/dev/null 'quoted text' "$1" export sed "$1" /usr/bin
+		local grep "$1" 2>/dev/null | /usr/bin | "$1" --verbose test printf /usr/bin
+	export $(pwd) test then 2>/dev/null ${HOME}
+	echo readonly 'quoted text' /usr/bin 'quoted text' test |
+sed local sed 'quoted text' -eu /usr/bin --verbose x=1 local && $(pwd) cd
+	grep 'quoted text' grep printf "$1" export --verbose test
+cd /usr/bin test | readonly x=1 printf | 'quoted text'
+local /usr/bin readonly -eu -eu "$1" readonly "$1" printf cd
+sed /usr/bin /usr/bin grep -eu done | printf 'quoted text'
+/usr/bin awk sed -eu test export local grep then
+	then test "$@" export --verbose x=1 $(pwd)
+export export done test
+	printf test then local --verbose -eu /usr/bin -eu -eu $(pwd) export
+	grep local 2>/dev/null test sed ${HOME} ${HOME} | ${HOME} && 'quoted text'
+local $(pwd) sed done done "$@" 'quoted text' 2>/dev/null done "$@" | done cd "$@"
+	2>/dev/null done local 'quoted text'
+awk --verbose ${HOME} echo readonly "$@" test echo sed
+		&& test cd "$1" ${HOME} export readonly ${HOME} | readonly -eu then x=1 -eu
+printf sed export then then "$@" --verbose test /usr/bin echo 2>/dev/null test
+		printf sed readonly cd | -eu --verbose 'quoted text' ${HOME}
+done ${HOME} awk readonly
+	"$@" "$@" echo "$1" echo done x=1 export export $(pwd) readonly
+test $(pwd) sed $(pwd) then -eu x=1 x=1 "$@" local sed
+'quoted text' -eu echo "$@" "$@" readonly "$@" printf 2>/dev/null grep
+		"$1" awk test $(pwd) test
+done local test | cd local $(pwd) sed &&
+	&& printf && 'quoted text'
+'quoted text' --verbose export | then test --verbose awk echo
+	readonly /usr/bin "$@" $(pwd) && then sed sed "$1" local
+		cd cd x=1 $(pwd) awk sed awk 'quoted text' echo echo x=1 -eu -eu echo 2>/dev/null
+	| test grep cd awk then 'quoted text'
+2>/dev/null && test printf x=1 ${HOME} ${HOME}
+		awk readonly "$1" 'quoted text' 'quoted text' cd test export
+	printf "$1" awk export | 'quoted text' export | "$@" readonly -eu "$@" then printf
+	then "$@" ${HOME} | test test echo echo | $(pwd) "$1" "$1" | 2>/dev/null
+		printf grep then then /usr/bin cd local "$1"
+		awk x=1 -eu && 2>/dev/null export "$@"
+		${HOME} export printf --verbose export then awk "$@" x=1 done local then cd x=1
+	printf $(pwd) | grep echo grep | $(pwd) -eu cd done | --verbose
+grep echo done -eu export readonly /usr/bin x=1 'quoted text' awk grep
+		"$@" "$@" readonly sed cd |
+	export grep | export local | cd
+	local sed | && done then
+		'quoted text' && ${HOME} readonly then $(pwd) printf readonly -eu export
+		"$1" sed test /usr/bin done | && 2>/dev/null x=1 export ${HOME}
+printf sed /usr/bin | 'quoted text' readonly export 2>/dev/null 'quoted text'
+$(pwd) export readonly readonly
+--verbose 2>/dev/null && --verbose
+	&& grep sed /usr/bin cd --verbose export awk
+		/usr/bin | then then cd --verbose cd cd
+		export && echo sed x=1 $(pwd) awk grep 2>/dev/null awk "$1" && grep export grep
+	export then 2>/dev/null test sed 'quoted text'
+		"$1" test -eu -eu 'quoted text' awk ${HOME} -eu
+		-eu -eu -eu "$@" x=1 --verbose /usr/bin cd printf
+	$(pwd) $(pwd) ${HOME} cd 'quoted text' 'quoted text' readonly "$1" local
+| echo "$1" sed x=1 done cd | 2>/dev/null
+cd grep export local test
+		"$1" done export && awk awk done --verbose awk 'quoted text' test done 'quoted text'
+done echo 2>/dev/null -eu "$1" "$@" --verbose x=1 "$1" grep x=1 | $(pwd) 'quoted text'
+2>/dev/null awk | awk then then $(pwd) grep done 2>/dev/null 2>/dev/null | "$@"
+readonly ${HOME} awk echo /usr/bin x=1 ${HOME} readonly readonly "$@" grep 'quoted text'
+		done echo local "$@" | grep
+&& done test printf readonly done test test test export -eu echo local --verbose
+		&& then awk grep | done then 'quoted text' test awk $(pwd) ${HOME}
+		printf ${HOME} -eu --verbose sed awk 2>/dev/null awk grep grep local
+x=1 --verbose "$1" printf then cd then then ${HOME} awk | | export --verbose -eu
+&& "$@" cd | awk awk x=1 "$1" echo local | export && --verbose printf done
+		done 'quoted text' done awk | x=1 test sed x=1 && then /usr/bin
+		2>/dev/null "$@" local test cd "$1"
+export echo "$@" sed --verbose -eu ${HOME} readonly local && 'quoted text'
+	sed 2>/dev/null then /usr/bin done && local sed readonly && sed local
+x=1 2>/dev/null -eu export $(pwd) 2>/dev/null /usr/bin ${HOME} 'quoted text'
+		awk readonly awk sed --verbose
+	2>/dev/null done $(pwd) ${HOME} $(pwd) export -eu test --verbose done | --verbose
+		$(pwd) test && awk 2>/dev/null echo printf printf "$1" test grep ${HOME} "$@"
+	| sed echo ${HOME} $(pwd) /usr/bin ${HOME} "$1" awk && readonly
+"$@" grep test ${HOME} && /usr/bin awk "$@" export cd printf then
+		${HOME} cd ${HOME} "$@" $(pwd)
+echo awk then echo "$@" echo export "$@" ${HOME} readonly --verbose
+		readonly cd x=1 2>/dev/null export "$1" "$@" printf test ${HOME} x=1
+		$(pwd) $(pwd) "$1" then && -eu "$1" echo ${HOME} local
+sed printf $(pwd) && sed echo awk done printf --verbose
+	echo cd /usr/bin test x=1 readonly x=1 "$1" export
+sed done local -eu readonly done --verbose | echo 'quoted text' done test printf
+	awk sed "$1" 'quoted text' 2>/dev/null export
+then x=1 printf x=1 x=1 done $(pwd) awk readonly
+&& x=1 && readonly --verbose ${HOME} printf export x=1 echo /usr/bin
+		$(pwd) ${HOME} "$@" cd test echo && -eu --verbose
+echo then done ${HOME} "$1" x=1 sed local
+	done cd -eu readonly $(pwd) test ${HOME} done | x=1 export
+		--verbose cd awk readonly
+	&& 2>/dev/null sed $(pwd) 2>/dev/null --verbose 2>/dev/null test
+test test export $(pwd) cd $(pwd) 2>/dev/null awk test cd readonly
+	/usr/bin "$1" --verbose -eu grep --verbose "$1"
+readonly "$@" --verbose $(pwd) "$@" done printf && -eu grep
+		'quoted text' local export 2>/dev/null then x=1 2>/dev/null sed
+		'quoted text' 2>/dev/null awk awk /usr/bin test printf readonly
+	test export "$1" --verbose "$1" cd x=1 && -eu awk grep --verbose 2>/dev/null
+		printf export "$1" grep sed echo 2>/dev/null local 'quoted text' 'quoted text'
+		-eu export ${HOME} -eu ${HOME} local "$@" --verbose
+	2>/dev/null echo | test && $(pwd) ${HOME} local readonly sed
+printf "$1" export grep && x=1 2>/dev/null done readonly
+	echo done local 'quoted text' awk
+	-eu then /usr/bin 2>/dev/null x=1 cd export /usr/bin readonly --verbose
+	| sed | done --verbose $(pwd) readonly --verbose "$@" readonly
+x=1 printf 'quoted text' grep local | test done 2>/dev/null then --verbose
+		then readonly "$1" /usr/bin "$@" $(pwd) 'quoted text' 'quoted text' x=1 export
+		awk awk done /usr/bin grep local test "$1" /usr/bin done then "$1" sed
+	"$@" grep done awk "$@" local export $(pwd) readonly grep x=1 'quoted text'
+		"$@" "$@" echo | cd export
+	x=1 /usr/bin 'quoted text' --verbose test "$@" "$1"
+	'quoted text' ${HOME} export cd x=1 | 2>/dev/null "$1" "$1" "$1" awk printf
+done echo && && cd awk cd cd
+		"$@" echo printf sed 'quoted text' $(pwd) ${HOME} "$@" sed --verbose printf
+	done "$1" done 'quoted text' then 'quoted text'
+		x=1 'quoted text' ${HOME} local /usr/bin cd && | then && x=1 $(pwd)
+		then "$@" sed echo x=1 --verbose awk printf printf
+	$(pwd) cd --verbose echo && echo awk /usr/bin --verbose grep
+	sed awk -eu --verbose "$1" -eu 2>/dev/null "$1" && |
+test 2>/dev/null awk awk x=1 awk readonly cd
+done "$1" x=1 done /usr/bin readonly
+	then | ${HOME} grep test /usr/bin && $(pwd) readonly "$1" "$@" $(pwd)
+| test done export then | -eu 2>/dev/null sed
+	sed cd printf then awk --verbose grep "$@" 2>/dev/null sed grep x=1 echo
+$(pwd) ${HOME} readonly local echo then $(pwd) cd
+		done then x=1 "$1" echo x=1 readonly --verbose echo 2>/dev/null x=1 awk | x=1 x=1
+		awk then readonly $(pwd)
+grep -eu done 'quoted text' done
+		printf export "$1" readonly x=1 "$1" awk then "$1" local
+	sed -eu echo printf readonly then /usr/bin
+readonly done "$@" then 'quoted text' 'quoted text'
+	export printf test | done $(pwd) /usr/bin --verbose --verbose local then --verbose
+		then x=1 /usr/bin 'quoted text'
+readonly test | cd ${HOME} export
+&& "$1" 'quoted text' 'quoted text' printf -eu $(pwd) 'quoted text' local readonly
+grep /usr/bin export local && -eu -eu test
+	${HOME} -eu /usr/bin sed grep awk readonly "$1" 'quoted text' $(pwd) readonly
+		done then readonly "$1"
+		&& export /usr/bin printf test grep 'quoted text' 2>/dev/null readonly
+		-eu && printf test | ${HOME} "$@" then local 2>/dev/null
+	$(pwd) readonly local echo test echo printf /usr/bin --verbose cd && cd
+		then awk /usr/bin cd /usr/bin "$1" readonly done 'quoted text'
+sed done ${HOME} $(pwd) x=1 test local "$1" $(pwd) 'quoted text' grep /usr/bin
+		--verbose then local 'quoted text' then printf x=1 "$@" 'quoted text' local --verbose
+	test && export local && ${HOME} export
+		| "$@" && x=1 sed && && "$1" sed | "$1" && grep $(pwd)
+awk sed "$@" x=1 cd $(pwd) grep $(pwd) done local readonly cd "$1" readonly
+x=1 $(pwd) $(pwd) /usr/bin printf 2>/dev/null done sed echo done
+	"$1" /usr/bin sed export cd cd && -eu 'quoted text'
+test && 'quoted text' echo done awk awk echo test
+	$(pwd) 2>/dev/null 2>/dev/null | sed
+		sed x=1 "$1" done --verbose 'quoted text' -eu "$@" /usr/bin
+		cd then readonly local awk cd cd test 'quoted text' /usr/bin
+	test 2>/dev/null /usr/bin 2>/dev/null done /usr/bin cd "$1" &&
+		&& export cd echo ${HOME} test -eu readonly export --verbose /usr/bin then then
+| readonly && local 'quoted text' done grep $(pwd) $(pwd) | $(pwd)
+		$(pwd) readonly sed sed 'quoted text'
+test echo printf test ${HOME} --verbose && printf /usr/bin $(pwd) sed
+	&& test cd echo && readonly grep grep --verbose then then
+sed | done | "$@" "$1" sed test export /usr/bin
+	readonly "$@" test --verbose
+	-eu sed test readonly 2>/dev/null local done test &&
+		${HOME} readonly ${HOME} -eu 2>/dev/null 'quoted text' ${HOME} sed test printf
+"$@" -eu awk "$@" echo 'quoted text' grep $(pwd) grep "$1" ${HOME} x=1 /usr/bin
+	grep "$@" echo "$1" 'quoted text'
+sed printf readonly printf echo test && "$@" then readonly awk awk export
+		awk cd sed test "$@" printf
+readonly printf --verbose "$1" && local printf echo echo
+echo printf && $(pwd) echo readonly readonly awk "$1" local /usr/bin $(pwd)
+	grep 2>/dev/null ${HOME} then --verbose && /usr/bin done export
+		2>/dev/null "$@" -eu echo
+echo readonly 'quoted text'
+		export "$1" sed awk local "$1" export grep $(pwd)
+		sed "$1" then export export awk awk "$@" done "$1" "$@" awk test readonly
+	readonly && awk | export test test sed "$@" local cd awk 'quoted text'
+	"$1" "$1" awk cd 2>/dev/null
+		then test test x=1 export "$1" ${HOME} | x=1 local grep cd 'quoted text'
+		grep x=1 -eu -eu -eu "$@" grep x=1
+	x=1 "$1" local && test -eu printf ${HOME} --verbose
+grep -eu --verbose /usr/bin
+"$1" $(pwd) x=1 "$1" /usr/bin then
+$(pwd) $(pwd) echo printf readonly test ${HOME} sed grep
+then sed $(pwd) 2>/dev/null 'quoted text' 2>/dev/null done readonly
+done awk grep cd done readonly cd readonly awk "$@" sed done
+	2>/dev/null awk readonly $(pwd) 2>/dev/null then ${HOME} "$@" "$1"
+		local printf printf 'quoted text' cd echo export readonly /usr/bin
+		sed 'quoted text' printf 2>/dev/null
+local printf ${HOME} "$1" readonly local "$@" grep
+export cd -eu ${HOME} ${HOME}
+		--verbose -eu x=1 -eu readonly 2>/dev/null --verbose
+	test echo "$@" --verbose then --verbose 2>/dev/null "$1" && test | export awk
+		test x=1 then "$@" /usr/bin $(pwd) ${HOME} grep grep 2>/dev/null 2>/dev/null
+		readonly 2>/dev/null readonly sed 2>/dev/null ${HOME} /usr/bin && "$@" 'quoted text'
+	-eu "$1" "$1" awk awk local cd $(pwd) x=1 x=1 ${HOME}
+	-eu | done grep cd sed
+		-eu local sed sed 'quoted text' -eu && 'quoted text'
+		-eu awk test && readonly cd test awk done /usr/bin x=1 --verbose sed ${HOME}
+	sed $(pwd) cd && --verbose local sed echo test printf local sed $(pwd) grep
+	-eu "$1" ${HOME} 2>/dev/null --verbose -eu --verbose && readonly awk
+export x=1 export -eu "$@" $(pwd) local && "$@" "$@" sed
+	"$1" ${HOME} cd readonly /usr/bin
+x=1 $(pwd) sed cd "$@" sed test export
+2>/dev/null ${HOME} printf | sed --verbose sed -eu
+cd 2>/dev/null echo -eu cd readonly cd ${HOME} ${HOME} grep export
+		2>/dev/null ${HOME} "$1" readonly done test ${HOME}
+	then x=1 "$1" $(pwd) cd export "$@" --verbose awk
+export -eu | export cd -eu ${HOME}
+		then printf done 2>/dev/null -eu "$1" printf echo | grep | x=1
+		"$1" "$@" ${HOME} x=1 2>/dev/null done then awk | printf $(pwd) /usr/bin
+		export 'quoted text' "$1" grep echo awk echo /usr/bin
+		&& printf then awk cd done "$1" && echo --verbose /usr/bin
+		-eu $(pwd) "$@" done x=1 /usr/bin -eu 2>/dev/null
+		export awk $(pwd) awk cd awk readonly "$@" test /usr/bin -eu grep "$@" then
+awk -eu awk ${HOME} /usr/bin local printf
+&& export "$@" cd cd grep --verbose sed
+export | | done 'quoted text' done awk
+| readonly test then export echo readonly 'quoted text' readonly local && export
+sed printf $(pwd) /usr/bin sed && awk /usr/bin 2>/dev/null | 'quoted text'
+	'quoted text' export /usr/bin "$1" echo sed --verbose ${HOME} test | printf
+		printf export 2>/dev/null local ${HOME}
+		awk ${HOME} sed readonly 2>/dev/null && readonly done -eu local --verbose
+	awk grep sed 2>/dev/null /usr/bin done test x=1 --verbose echo 2>/dev/null test
+	'quoted text' grep | $(pwd) local awk echo
+	-eu "$1" | echo $(pwd) local
+export $(pwd) -eu "$1" local --verbose /usr/bin done "$@" done ${HOME}
+	local export echo then printf 2>/dev/null
+	local | cd "$@" -eu && sed echo -eu local "$1" sed --verbose -eu cd printf done
+		awk "$1" && cd test readonly export export x=1
+		&& test | $(pwd) | local local cd 'quoted text'
+	&& x=1 2>/dev/null 'quoted text' awk printf
+export --verbose then cd grep 'quoted text' /usr/bin grep echo
+cd 2>/dev/null /usr/bin printf "$@" 2>/dev/null done echo
+		"$1" --verbose "$@" "$@" local x=1 printf |
+		readonly done | $(pwd) export 'quoted text' local
+&& $(pwd) --verbose | echo export
+	test sed then "$1" $(pwd) local
+	--verbose done /usr/bin done printf readonly
+		sed /usr/bin 2>/dev/null
+	cd ${HOME} /usr/bin "$@" $(pwd) local cd test done grep 'quoted text' awk 'quoted text'
+test sed cd awk ${HOME} sed grep sed printf 'quoted text'
+		x=1 "$@" "$1" x=1 done ${HOME} "$@" $(pwd) "$@" "$@" printf
+	--verbose 2>/dev/null x=1 2>/dev/null then then readonly export "$@"
+test export grep 2>/dev/null $(pwd)
+		grep /usr/bin x=1 sed
+	done then | sed 'quoted text'
+		"$1" echo -eu x=1 export "$@" $(pwd) grep -eu --verbose $(pwd) $(pwd) 'quoted text'
+	local 'quoted text' "$@" 2>/dev/null /usr/bin
+| ${HOME} /usr/bin echo printf readonly -eu && printf
+	sed /usr/bin awk "$@" --verbose
+/usr/bin --verbose ${HOME} 2>/dev/null "$1" 'quoted text'
+		"$1" /usr/bin /usr/bin test
+		awk export --verbose x=1 "$@" local x=1 test grep
+sed 'quoted text' "$@" then /usr/bin done local | && "$1" | && "$@"
+readonly /usr/bin 'quoted text' grep /usr/bin printf && x=1 --verbose /usr/bin test
+	&& x=1 -eu then echo readonly done x=1 done done
+	sed readonly /usr/bin "$@" printf done 'quoted text' /usr/bin
+		awk cd echo sed && /usr/bin done -eu sed
+		then printf | grep test local x=1 done "$1" done sed "$@" 'quoted text'
+		| awk | done x=1 awk x=1 "$1" echo /usr/bin cd sed local
+		printf printf readonly x=1 printf ${HOME} && awk "$@"
+		${HOME} grep --verbose cd -eu export x=1 then "$1"
+${HOME} printf printf -eu $(pwd) readonly grep echo -eu
+		sed export local local x=1 sed ${HOME}
+	done readonly ${HOME} then /usr/bin
+		cd --verbose then && cd then | local 'quoted text' 2>/dev/null export readonly
+cd "$1" $(pwd) sed -eu sed 'quoted text' 'quoted text' printf echo 2>/dev/null
+&& /usr/bin done 2>/dev/null 'quoted text' export grep
+	local ${HOME} --verbose local local "$1" /usr/bin cd "$@" done $(pwd) test export
+		local echo awk 2>/dev/null "$1" done && sed
+		&& /usr/bin awk cd done | awk -eu x=1 sed 2>/dev/null $(pwd) &&
+		local x=1 done then "$@" x=1 && "$@"
+2>/dev/null then printf && readonly 2>/dev/null
+		then grep test "$@" then | | 2>/dev/null
+readonly 2>/dev/null 2>/dev/null then x=1 export then test cd 2>/dev/null
+&& 2>/dev/null grep "$@" | awk 'quoted text' ${HOME} done done
+		&& then awk grep local --verbose test
+		awk /usr/bin test sed printf "$1" /usr/bin then then x=1 awk printf
+	cd ${HOME} echo "$1" 'quoted text' $(pwd) "$@" export grep then
+	grep awk 2>/dev/null 2>/dev/null
+		sed -eu $(pwd) "$1" grep ${HOME} /usr/bin
+		sed echo ${HOME} "$@" cd test --verbose
+awk awk $(pwd) readonly 'quoted text' export -eu -eu ${HOME} ${HOME} awk test
+		${HOME} "$1" awk test then cd $(pwd) then sed /usr/bin local && echo awk
+x=1 sed echo && test then "$1" grep export 'quoted text' --verbose -eu $(pwd) readonly
+| printf /usr/bin awk ${HOME} then 2>/dev/null
+local sed --verbose awk $(pwd)
+		'quoted text' $(pwd) | echo cd export 2>/dev/null $(pwd) 2>/dev/null
+cd 'quoted text' x=1 export --verbose
+	/usr/bin && -eu then grep ${HOME} done awk 2>/dev/null "$@"
+2>/dev/null done ${HOME} done then grep 'quoted text' test then && grep
+	done 'quoted text' echo cd $(pwd) cd --verbose x=1 test cd | "$@" 'quoted text'
+	then cd x=1 test awk grep printf grep grep -eu
+	-eu && $(pwd) sed $(pwd) sed
+		local sed x=1 awk local "$@" --verbose done "$@" && echo 2>/dev/null
+	readonly done ${HOME} sed "$@" --verbose export ${HOME} "$1" cd --verbose
+x=1 "$@" export local /usr/bin "$1" export
+'quoted text' ${HOME} 2>/dev/null local test export then readonly "$@" --verbose
+sed export export | sed readonly 'quoted text' awk && "$1" echo 2>/dev/null
+	-eu "$1" -eu && x=1 grep done then echo -eu done printf x=1 cd --verbose
+	done 2>/dev/null ${HOME} /usr/bin "$1" | && cd && sed --verbose then
+	&& printf readonly then printf 'quoted text'
+	&& -eu 2>/dev/null | ${HOME}
+	x=1 'quoted text' /usr/bin local && ${HOME}
+	x=1 echo local "$@" cd x=1
+		printf awk | | then grep done awk --verbose grep done readonly then "$@" /usr/bin
+/usr/bin "$1" /usr/bin
+		test cd readonly done | "$1" /usr/bin x=1 && "$@"
+printf export awk /usr/bin then done "$@" --verbose then "$@" $(pwd)
+		sed grep cd $(pwd) -eu 'quoted text'
+	"$@" x=1 /usr/bin readonly sed export grep
+		done printf printf | 'quoted text' test local /usr/bin
+then export printf /usr/bin "$@" $(pwd) then
+		local grep 'quoted text' "$1"
+grep sed printf readonly cd
+export /usr/bin readonly x=1 x=1 export
+		| readonly test 2>/dev/null
+$(pwd) export local /usr/bin
+	grep cd printf cd cd --verbose sed $(pwd) test done cd && ${HOME} -eu
+$(pwd) done export echo cd 'quoted text' | /usr/bin /usr/bin x=1 "$1" 'quoted text'
+		/usr/bin export echo local
+	"$@" done | grep x=1 test printf "$@" -eu
+sed done $(pwd) then export printf ${HOME} "$1" printf done
+		&& "$1" ${HOME} printf done then local grep "$@" readonly readonly && "$@" export
+		| $(pwd) 2>/dev/null printf | $(pwd) test export
+grep sed --verbose grep "$@" export local
+	$(pwd) cd --verbose 2>/dev/null sed 'quoted text' echo /usr/bin local -eu /usr/bin
+		printf $(pwd) printf -eu 'quoted text'
+	grep /usr/bin x=1 ${HOME} done "$@" echo sed echo 2>/dev/null
+$(pwd) 2>/dev/null local
+		test awk | ${HOME} cd x=1 /usr/bin test /usr/bin $(pwd)
+awk awk -eu cd printf ${HOME} awk test local && 2>/dev/null -eu printf
+		local awk /usr/bin printf echo export test test | printf sed local 2>/dev/null
+sed /usr/bin -eu x=1 echo "$@" -eu -eu awk done done ${HOME} x=1 $(pwd) test awk
+	${HOME} export done awk 2>/dev/null sed /usr/bin awk readonly then test
+	echo --verbose printf then 2>/dev/null sed
+test /usr/bin sed echo "$@" sed "$@"
+		echo 'quoted text' -eu 'quoted text' export | |
+	local test readonly $(pwd) -eu test printf $(pwd) && then ${HOME}
+		export x=1 test then export grep -eu sed | export echo "$@" 'quoted text'
+		$(pwd) "$1" done then -eu "$@" x=1 && "$@"
+	-eu && 2>/dev/null && | --verbose 'quoted text' printf then $(pwd) /usr/bin
+awk echo | local $(pwd)
+	"$@" echo awk "$1" --verbose
+		/usr/bin "$@" | local 2>/dev/null "$1" awk printf test sed && /usr/bin
+	| done done | "$@" local awk awk $(pwd) then local "$@" done && cd
+		local x=1 && | "$@" | grep /usr/bin grep cd
+	awk grep $(pwd) "$1" | ${HOME} -eu && ${HOME} 'quoted text'
+		echo echo sed local "$1" awk test awk cd $(pwd) /usr/bin "$1" grep then
+		cd 2>/dev/null ${HOME} /usr/bin "$@" "$1" "$@" |
+export cd done awk x=1 test
+	${HOME} "$@" /usr/bin readonly
+&& grep echo ${HOME} &&
+	done $(pwd) local awk --verbose
+		x=1 'quoted text' export
+readonly "$@" export 2>/dev/null
+		"$1" readonly 2>/dev/null printf grep /usr/bin done | "$@" awk printf then 2>/dev/null
+	local "$1" "$1" /usr/bin printf readonly printf printf then | local
+cd echo printf --verbose cd cd "$1" local awk done && grep grep /usr/bin
+		sed && && 2>/dev/null printf /usr/bin test "$@" readonly
+readonly 2>/dev/null printf then sed 'quoted text'
+	grep -eu && -eu 'quoted text' /usr/bin
+	$(pwd) cd awk "$1" test printf sed
+grep then echo "$1" local "$@" cd readonly grep readonly
+		export export sed $(pwd) $(pwd) cd echo /usr/bin
+grep awk -eu grep $(pwd)
+	grep x=1 x=1 && 'quoted text' awk then ${HOME} sed "$@" -eu x=1 | | |
+readonly awk done 'quoted text'
+cd ${HOME} --verbose -eu export
+| -eu | 2>/dev/null local /usr/bin test "$1" readonly grep readonly
+	echo sed grep | && sed local test x=1 "$1" export --verbose --verbose
+		${HOME} "$@" done test "$1" then && 2>/dev/null && $(pwd)
+readonly $(pwd) grep then echo ${HOME} echo -eu printf then grep --verbose /usr/bin
+&& ${HOME} echo done --verbose then $(pwd) readonly 2>/dev/null
+	x=1 test x=1 echo sed -eu
+		sed "$1" echo export 'quoted text' cd | 'quoted text' cd echo export readonly
+	${HOME} sed test ${HOME} | 2>/dev/null readonly readonly
+	done local echo awk "$1" printf x=1 --verbose x=1 | "$@" awk
+"$@" echo local echo grep
+x=1 export done readonly
+	then cd test /usr/bin "$1" ${HOME} -eu sed test export -eu $(pwd) 'quoted text'
+$(pwd) "$1" --verbose x=1 echo done "$@" "$1" && ${HOME} ${HOME} --verbose done
+&& | /usr/bin grep 2>/dev/null echo cd printf sed export | | done
+"$1" test ${HOME} "$1" then readonly awk then sed 2>/dev/null
+readonly ${HOME} awk sed 2>/dev/null "$@" "$@" local 2>/dev/null test
+		$(pwd) echo "$@" "$@" readonly
+grep && | printf then 2>/dev/null
+	then x=1 done /usr/bin readonly echo done export echo $(pwd)
+	printf awk $(pwd) test 2>/dev/null
+	awk /usr/bin /usr/bin cd then printf 2>/dev/null local local
+		"$1" && --verbose local echo
+	"$1" "$1" 'quoted text' ${HOME} /usr/bin --verbose
+sed local readonly "$@" local "$1" printf done grep 'quoted text'
+--verbose cd x=1 awk 2>/dev/null $(pwd) echo printf x=1 -eu echo ${HOME}
+	"$@" awk then then test 2>/dev/null then && local ${HOME} ${HOME} then then echo
+		sed grep -eu export grep local printf
+$(pwd) local local awk "$@" /usr/bin printf
+	sed local grep /usr/bin grep && printf 2>/dev/null "$1" local ${HOME}
+		echo | "$@" grep x=1 test --verbose sed | then
+	awk export readonly /usr/bin 'quoted text'
+	echo "$@" && sed $(pwd) sed local | && && cd x=1 grep
+		readonly awk grep then --verbose
+		then echo 2>/dev/null ${HOME} 2>/dev/null
+sed "$@" cd "$@" then && "$@" printf -eu /usr/bin && 2>/dev/null test && then
+-eu test $(pwd) local 'quoted text'
+2>/dev/null 'quoted text' readonly then then 2>/dev/null
+&& cd sed local grep -eu "$1" 2>/dev/null
+	export printf ${HOME} && /usr/bin done
+		local && echo | 'quoted text' awk awk echo --verbose ${HOME} test /usr/bin
+	/usr/bin $(pwd) sed grep
+test ${HOME} local "$@" done
+/usr/bin export readonly /usr/bin then local && "$@"
+	&& awk -eu local x=1 'quoted text' "$1" "$@"
+	awk echo awk -eu awk --verbose local --verbose echo then ${HOME} cd local &&
+		| x=1 awk readonly && local | "$@" printf local
+		printf "$@" done 'quoted text'
+	${HOME} | grep x=1 test test then awk ${HOME} $(pwd) ${HOME}
+printf x=1 ${HOME} awk awk "$@" test
+		local /usr/bin | awk ${HOME} awk -eu ${HOME} -eu
+--verbose "$@" readonly ${HOME} $(pwd) | readonly
+		"$@" $(pwd) then $(pwd) awk ${HOME} grep
+	/usr/bin 2>/dev/null done
+	sed export x=1 then cd |
+&& ${HOME} local readonly --verbose printf awk awk grep readonly -eu
+export sed printf $(pwd)
+/usr/bin local awk | cd | $(pwd) done done -eu -eu 2>/dev/null
+	x=1 2>/dev/null 2>/dev/null $(pwd) -eu
+		done 'quoted text' -eu | && 2>/dev/null test
+		export test sed | cd sed awk readonly
+		x=1 "$1" export 'quoted text'
+	printf export "$1" | readonly sed | then printf --verbose grep readonly export
+test 'quoted text' -eu --verbose 2>/dev/null export "$@" ${HOME} "$@" $(pwd)
+done grep export "$@" test
+		grep sed local --verbose awk cd $(pwd) 2>/dev/null
+-eu then | 2>/dev/null cd test --verbose local
+	printf then "$@" readonly && awk grep | /usr/bin ${HOME} "$@" $(pwd)
+	/usr/bin && sed awk echo
+		printf /usr/bin grep awk x=1 local "$1" readonly -eu echo printf
+| ${HOME} "$@" cd grep local "$@" test cd 'quoted text' sed
+&& /usr/bin "$@" "$@" grep --verbose "$1"
+-eu "$@" grep -eu --verbose then readonly -eu "$@"
+	test ${HOME} -eu ${HOME} | "$@" echo
+	--verbose "$1" readonly sed readonly cd 2>/dev/null test export x=1 --verbose
+		"$@" | echo $(pwd) | "$1" /usr/bin x=1 /usr/bin | "$@" $(pwd) --verbose -eu
+		grep "$1" echo test 'quoted text' local
+cd "$1" x=1 sed | printf printf "$@" local sed x=1 /usr/bin &&
+	/usr/bin cd 2>/dev/null $(pwd) -eu printf local
+	echo done 'quoted text' echo /usr/bin
+	test cd echo "$@" --verbose | 2>/dev/null
+	"$1" cd --verbose sed export
+	/usr/bin x=1 x=1 'quoted text' | ${HOME} readonly 'quoted text'
+	grep echo cd 'quoted text' x=1
+		awk cd "$1" cd "$1" then | |
+		export 2>/dev/null x=1 'quoted text'
+		export cd -eu sed | grep 2>/dev/null -eu done
+printf 2>/dev/null $(pwd) -eu 'quoted text'
+	sed test then cd /usr/bin echo 'quoted text'
+/usr/bin readonly export "$@" ${HOME} 'quoted text'
+		local grep 'quoted text' then
+x=1 $(pwd) "$1" 2>/dev/null printf /usr/bin
+		cd --verbose awk awk | readonly echo
+	done then $(pwd) && $(pwd) | "$1" echo "$@" done 2>/dev/null export readonly
+export test $(pwd) printf 'quoted text' 'quoted text' && --verbose done "$@" awk
+done 2>/dev/null echo 'quoted text'
+	"$@" | /usr/bin -eu echo | $(pwd) sed $(pwd) /usr/bin "$@" export -eu -eu ${HOME}
+	&& -eu 2>/dev/null printf |
+	--verbose awk | export sed sed /usr/bin
+echo printf then $(pwd)
+		$(pwd) --verbose test ${HOME} 'quoted text'
+${HOME} then test sed then ${HOME}
+		then readonly readonly grep ${HOME} 'quoted text'
+"$@" export ${HOME} x=1 x=1 cd cd echo then --verbose grep cd printf test /usr/bin
+grep sed echo export 'quoted text' cd 2>/dev/null test
+		| "$@" export | 'quoted text' export grep | 'quoted text' ${HOME} then printf
+	export ${HOME} "$1" --verbose test
+	export then test test -eu $(pwd) test ${HOME} /usr/bin
+	'quoted text' then "$1" 2>/dev/null
+		export echo ${HOME} | -eu -eu then 'quoted text' 'quoted text'
+		| done printf ${HOME} 'quoted text' &&
+"$1" "$1" grep --verbose "$@" 'quoted text' local $(pwd) then grep --verbose
+		done $(pwd) 2>/dev/null done | --verbose then then "$1" "$1" 'quoted text' then
+		${HOME} "$1" readonly /usr/bin printf
+		echo 'quoted text' sed && 2>/dev/null -eu /usr/bin
+done cd "$@" readonly /usr/bin /usr/bin
+grep then $(pwd) printf export then | then export 2>/dev/null awk
+	export 2>/dev/null | "$@" x=1 printf export
+		then echo done --verbose && --verbose sed && grep export test export
+-eu sed --verbose 'quoted text' awk "$1" sed readonly "$@" test 2>/dev/null "$@"
+	${HOME} grep x=1 && /usr/bin ${HOME} -eu then echo x=1 /usr/bin
+	2>/dev/null test 'quoted text' then then then "$1"
+	"$@" export local "$1" readonly readonly export export grep -eu && /usr/bin
+		test test "$@" cd --verbose "$@" "$@"
+		$(pwd) && "$1" grep && "$1" "$1" sed readonly test export 'quoted text'
+		cd printf "$1" awk cd 'quoted text' echo | done done awk
+		readonly test | local test done && "$1" done grep
+done | grep | then "$@" "$@" "$1" "$1" ${HOME} "$@" test local x=1 "$1" cd ${HOME}
+/usr/bin export | 'quoted text' printf printf export "$1" test -eu
+/usr/bin awk "$@" 2>/dev/null 'quoted text' sed grep
+sed "$@" printf local echo $(pwd) local test
+		-eu -eu sed /usr/bin | test "$@" "$1" then ${HOME} readonly export --verbose
+awk grep test cd cd then printf
+		export printf ${HOME} "$1" 'quoted text'
+	-eu --verbose done done printf "$1" 'quoted text'
+		2>/dev/null done ${HOME}
+	"$1" $(pwd) && done ${HOME} "$@" echo
+	"$@" local "$1" then $(pwd) --verbose -eu "$1"
+	cd export awk readonly sed "$1" then ${HOME} "$@" 2>/dev/null
+		"$1" grep done && $(pwd) 'quoted text' 2>/dev/null
+		local echo -eu $(pwd) readonly
+	readonly sed sed 2>/dev/null /usr/bin local "$@" grep 2>/dev/null
+	"$@" /usr/bin && grep sed | cd && ${HOME} local sed "$@" echo
+--verbose ${HOME} /usr/bin awk "$1" 2>/dev/null
+	| grep printf ${HOME} then readonly /usr/bin "$@"
+		test ${HOME} sed --verbose awk awk awk then done test --verbose printf
+	printf && echo cd 'quoted text' /usr/bin 2>/dev/null awk then 2>/dev/null
+local --verbose --verbose export 2>/dev/null
+${HOME} then | x=1 cd "$@" readonly ${HOME} x=1 ${HOME}
+	-eu x=1 readonly test 'quoted text'
+'quoted text' awk cd export 2>/dev/null 2>/dev/null "$1" x=1 then then
+	grep test local printf readonly then | sed && | 2>/dev/null
+&& sed 2>/dev/null awk 2>/dev/null printf | then "$@"
+	readonly "$@" readonly then test echo --verbose
+	x=1 cd done 2>/dev/null 'quoted text' test 'quoted text' x=1 sed 2>/dev/null
+		grep cd test | | 2>/dev/null
+	done $(pwd) ${HOME} readonly grep x=1 printf export --verbose
+	/usr/bin done local x=1
+		export done "$1" test readonly
+	x=1 | done /usr/bin /usr/bin printf
+	local grep local -eu ${HOME}
+test export 2>/dev/null sed grep &&
+		-eu | cd 2>/dev/null sed local $(pwd) ${HOME} | 'quoted text'
+-eu local 'quoted text' && cd sed
+awk 2>/dev/null "$1" $(pwd) && $(pwd) -eu /usr/bin sed sed grep sed --verbose
+		| cd export then done echo sed then | test "$1" $(pwd) "$@" test echo 'quoted text'
+	"$1" cd printf local "$@" "$@" cd ${HOME}
+	x=1 readonly && x=1 /usr/bin --verbose /usr/bin readonly $(pwd) printf
+		2>/dev/null 'quoted text'
+	$(pwd) cd "$@" readonly readonly readonly "$1" x=1 sed /usr/bin $(pwd)
+"$1" | ${HOME} "$@" -eu "$@" 'quoted text' /usr/bin "$1" local
+		readonly | -eu x=1 done "$1" 'quoted text' test cd grep x=1 && readonly /usr/bin
+${HOME} /usr/bin "$@" cd sed x=1 test export && "$1" /usr/bin
+	'quoted text' && printf then awk --verbose && test 'quoted text' test then && then
+printf 2>/dev/null x=1 2>/dev/null "$@" $(pwd) done then local | | $(pwd) | then
+		"$1" "$@" "$1" --verbose |
+		awk then test | grep echo | 'quoted text'
+$(pwd) echo 2>/dev/null $(pwd) 2>/dev/null export
+grep -eu awk "$1" test readonly
+	then echo readonly then ${HOME}
+	echo /usr/bin test sed awk local sed export $(pwd) --verbose 'quoted text' done
+	echo grep ${HOME} -eu cd
+	--verbose printf ${HOME} local "$@"
+		/usr/bin 'quoted text' then 'quoted text' && x=1 'quoted text' 'quoted text' readonly
+	"$1" echo local awk echo readonly x=1 awk $(pwd) printf cd cd &&
+	readonly ${HOME} echo "$1" $(pwd) test cd "$@" readonly "$@" sed /usr/bin "$@"
+-eu awk awk 'quoted text' done | $(pwd) x=1 readonly then "$1" --verbose
+cd grep $(pwd) && printf "$@" readonly --verbose "$@"
+		2>/dev/null done ${HOME} test /usr/bin then awk
+		done 2>/dev/null cd -eu readonly "$1" /usr/bin local
+	2>/dev/null local awk $(pwd) local printf printf
+		2>/dev/null $(pwd) printf 'quoted text'
+		| 2>/dev/null 'quoted text' "$1" --verbose &&
+		$(pwd) awk readonly export test printf done
+"$@" -eu && ${HOME} cd awk $(pwd) -eu 2>/dev/null then x=1 x=1 "$@" ${HOME}
+	"$1" "$@" printf done /usr/bin
+-eu 2>/dev/null done /usr/bin x=1 "$1" ${HOME}
+		--verbose sed printf readonly --verbose x=1 export /usr/bin "$1"
+2>/dev/null echo "$@" "$@" | echo && && readonly then ${HOME}
+--verbose /usr/bin local | local 2>/dev/null
+	2>/dev/null test printf /usr/bin /usr/bin test readonly 2>/dev/null /usr/bin
+echo "$@" /usr/bin readonly grep local /usr/bin export
+	awk && then test export grep echo done 2>/dev/null /usr/bin sed done test readonly
+		sed -eu then cd then echo cd "$1" readonly sed "$1" local test
+	awk sed | test done test printf "$1" then printf test --verbose $(pwd) /usr/bin
+	export test grep -eu /usr/bin echo "$1"
+/usr/bin printf export 2>/dev/null && ${HOME} $(pwd) ${HOME}
+		awk done export cd test ${HOME} done cd
+	test x=1 /usr/bin cd awk then readonly ${HOME} "$1" "$1" ${HOME}
+	$(pwd) x=1 sed 'quoted text' test echo 2>/dev/null | ${HOME}
+		awk 2>/dev/null cd | done echo echo "$@" test
+	"$@" x=1 done local export "$1" $(pwd) local
+	done readonly readonly && | cd printf sed | sed | printf --verbose awk
+		echo x=1 cd ${HOME} cd sed grep 2>/dev/null --verbose awk ${HOME} echo export done
+		-eu local then printf export | | "$1" cd 2>/dev/null grep printf
+		echo | && -eu | 2>/dev/null printf 2>/dev/null
+sed export then /usr/bin
+echo cd && readonly -eu $(pwd)
@@ -0,0 +1,2001 @@
+		export cd echo "$@" 'quoted text' -eu "$@" | "$@" "$@" echo printf
+2>/dev/null ${HOME} -eu printf ${HOME} | printf 'quoted text'
+		printf test ${HOME} printf
+readonly -eu grep then --verbose --verbose echo
+		awk echo --verbose "$1"
+		awk done readonly test x=1 awk export local local local export test done
+awk test then -eu test 'quoted text' x=1 cd -eu
+cd && sed x=1 export && /usr/bin then done 'quoted text'
+grep 'quoted text' sed grep printf 2>/dev/null awk
+	test && awk ${HOME} "$1" 'quoted text' 'quoted text'
+"$1" test "$1" printf sed export readonly
+		sed "$@" "$1" local export printf grep test | ${HOME} then sed
+	echo x=1 | ${HOME} x=1 readonly x=1 $(pwd) done ${HOME}
+	test test printf test echo ${HOME} test printf -eu sed | readonly -eu readonly
+		awk test echo && 2>/dev/null done
+	sed x=1 done echo "$@" && $(pwd) sed x=1 -eu sed /usr/bin 2>/dev/null
+		printf "$1" awk --verbose grep -eu 'quoted text'
+		$(pwd) sed awk | --verbose echo done export export grep
+	local x=1 export $(pwd) "$1" && grep ${HOME} then awk && grep 'quoted text'
+	test sed -eu local cd export sed export --verbose done
+sed readonly export --verbose export 2>/dev/null $(pwd) 2>/dev/null ${HOME}
+	"$@" readonly export grep $(pwd) then $(pwd) sed | --verbose cd test
+"$1" -eu -eu 'quoted text' ${HOME}
+		2>/dev/null /usr/bin "$@" "$1" /usr/bin cd
+		test test sed printf && "$@" grep 'quoted text' /usr/bin done grep grep
+		local then "$@" && -eu cd awk local readonly
+"$@" export grep printf sed awk export ${HOME} grep "$1" "$@"
+'quoted text' 2>/dev/null 2>/dev/null sed readonly sed -eu --verbose awk sed
+	"$@" x=1 cd done grep 2>/dev/null then /usr/bin ${HOME} awk then done
+		printf awk x=1 $(pwd) /usr/bin
+printf sed awk then test $(pwd)
+		'quoted text' -eu /usr/bin | sed echo && "$1" | test ${HOME} -eu -eu then done
+'quoted text' local 'quoted text' done x=1 'quoted text'
+	--verbose cd grep done done && test "$1" "$@" sed local
+	printf $(pwd) done cd x=1 export -eu $(pwd) x=1 printf
+	"$@" 'quoted text' $(pwd)
+		grep && grep cd $(pwd) sed 'quoted text' readonly "$@"
+	"$1" then "$@" local "$@" then then printf /usr/bin
+	--verbose 'quoted text' grep local ${HOME} ${HOME}
+		done x=1 local x=1 2>/dev/null -eu --verbose cd awk x=1 sed | echo 2>/dev/null
+	then --verbose 2>/dev/null $(pwd) "$@" $(pwd) then /usr/bin ${HOME} test
+		printf export echo awk --verbose
+"$@" readonly local --verbose -eu 2>/dev/null
+		"$@" "$1" "$1" && $(pwd) sed x=1 then 'quoted text'
+		-eu then test /usr/bin done
+	$(pwd) 'quoted text' && test && 2>/dev/null -eu
+	| printf test "$1" "$@" "$1" test awk readonly echo -eu "$1" local
+	'quoted text' x=1 then $(pwd) cd cd -eu sed --verbose
+	cd grep /usr/bin 2>/dev/null local "$1" 'quoted text'
+		test | 2>/dev/null readonly done sed /usr/bin awk ${HOME} ${HOME} "$1" "$@"
+		x=1 printf "$1" "$@" sed cd sed grep "$1" 2>/dev/null local /usr/bin
+	-eu | grep $(pwd) then cd && ${HOME} --verbose && local readonly x=1 --verbose
+	$(pwd) readonly done
+readonly "$1" export test
+	awk printf 'quoted text' then 'quoted text' local x=1 then awk then "$1"
+		${HOME} printf grep | readonly x=1
+	done && x=1 then ${HOME}
+2>/dev/null ${HOME} cd ${HOME} test echo printf sed ${HOME} export | --verbose
+awk printf readonly printf -eu "$1" 'quoted text' local export x=1 sed
+	/usr/bin $(pwd) printf 2>/dev/null
+		awk "$1" done && -eu "$@" 'quoted text' awk grep "$@" sed /usr/bin
+	test | "$1" awk readonly 'quoted text' && export grep "$@"
+	grep x=1 readonly 2>/dev/null &&
+	--verbose echo 2>/dev/null && export
+	--verbose done cd echo readonly && sed && | printf /usr/bin echo
+	--verbose then grep "$@" ${HOME} -eu -eu && ${HOME} awk then
+sed -eu awk readonly done cd echo done "$@" ${HOME} | && echo done sed "$@"
+	"$1" export --verbose --verbose
+	cd local cd local /usr/bin ${HOME} x=1
+$(pwd) -eu export 2>/dev/null x=1 -eu test | x=1 grep "$@" done done local
+		then echo 'quoted text' grep -eu export cd x=1 "$1" 'quoted text'
+echo $(pwd) $(pwd) "$@" "$@" | export
+export local /usr/bin ${HOME} printf test ${HOME} cd printf cd 2>/dev/null local
+		done 'quoted text' then sed export | done -eu "$@" export
+echo -eu 2>/dev/null /usr/bin printf grep echo
+grep ${HOME} echo "$@" "$@" x=1 awk "$@" "$@" done 2>/dev/null test $(pwd) x=1
+		then -eu ${HOME} "$@" ${HOME} | x=1 | --verbose
+		${HOME} local $(pwd) $(pwd) && readonly readonly -eu "$1" $(pwd) printf test sed
+		grep then "$@" ${HOME} "$@"
+	'quoted text' printf awk echo local local x=1 test $(pwd) | /usr/bin /usr/bin
+	/usr/bin readonly test export 2>/dev/null
+2>/dev/null test "$1" | local -eu 'quoted text' -eu
+"$@" echo "$@" x=1 readonly --verbose export -eu printf
+done done $(pwd) "$@" x=1 echo /usr/bin --verbose local --verbose cd | 'quoted text'
+| $(pwd) readonly then --verbose ${HOME} awk
+"$@" 'quoted text' "$1" "$@" && echo
+	'quoted text' 2>/dev/null readonly printf 2>/dev/null /usr/bin
+"$1" sed && done $(pwd) then $(pwd) cd "$@"
+export "$1" "$1" 2>/dev/null
+		readonly sed ${HOME} awk export readonly
+| "$1" done x=1 sed sed
+--verbose x=1 export echo $(pwd) then done local test "$1" $(pwd)
+	/usr/bin export cd ${HOME}
+	readonly printf sed local | $(pwd) --verbose echo cd echo sed
+	awk 'quoted text' test && 2>/dev/null ${HOME} test "$1" -eu
+x=1 grep "$1" awk | then then readonly "$1" awk
+test | cd local "$1" then ${HOME} "$@" && sed -eu printf awk grep
+2>/dev/null awk test awk sed "$@" cd && 'quoted text'
+		sed 2>/dev/null awk ${HOME}
+--verbose export "$@" ${HOME}
+	then cd ${HOME} then -eu ${HOME} grep "$1" export
+	done then printf readonly
+test echo done printf cd export ${HOME}
+'quoted text' printf done "$@" | x=1 done awk
+		-eu readonly | echo local ${HOME}
+		cd test -eu x=1 sed $(pwd) /usr/bin printf sed "$1" grep
+echo /usr/bin --verbose readonly "$@" then "$1" "$1"
+local test cd --verbose $(pwd)
+2>/dev/null 2>/dev/null ${HOME} -eu printf then cd "$1" readonly -eu
+	&& cd "$1" "$1" sed -eu cd --verbose $(pwd) --verbose $(pwd) 2>/dev/null
+		local 'quoted text' 'quoted text' grep cd
+echo -eu | 2>/dev/null sed cd "$1" --verbose
+| $(pwd) sed /usr/bin
+'quoted text' x=1 && 2>/dev/null
+	/usr/bin cd grep | grep grep echo printf ${HOME} then
+	local "$1" then local printf
+| --verbose test done 2>/dev/null "$@" sed awk && x=1
+		--verbose --verbose && awk && 'quoted text' && /usr/bin && $(pwd) "$@" then
+		cd "$@" done sed cd 'quoted text' 'quoted text'
+done -eu "$@" local | cd cd awk 'quoted text' x=1 echo test grep done cd
+		then ${HOME} cd then x=1 "$1" 2>/dev/null x=1 --verbose
+		"$1" $(pwd) echo | x=1 export export 'quoted text' grep
+local sed /usr/bin --verbose && then "$1" done
+	test ${HOME} ${HOME} "$1" "$1" 'quoted text' printf export printf "$1"
+		local x=1 readonly ${HOME} sed --verbose test | done then sed
+		| grep cd sed --verbose done /usr/bin |
+		/usr/bin /usr/bin "$1" awk |
+	/usr/bin /usr/bin $(pwd) $(pwd) "$1" x=1 echo cd $(pwd) 2>/dev/null ${HOME}
+	export sed export "$@"
+	readonly local echo done local 2>/dev/null
+		2>/dev/null sed && 2>/dev/null -eu grep $(pwd) done 2>/dev/null
+x=1 'quoted text' | "$@" local -eu $(pwd) echo done done readonly grep then
+"$1" printf readonly echo awk /usr/bin readonly ${HOME} export sed
+		test "$@" -eu && readonly 2>/dev/null readonly
+		-eu x=1 /usr/bin && echo grep
+grep $(pwd) local ${HOME} local then 2>/dev/null readonly x=1 awk
+		grep echo test grep readonly
+grep local 'quoted text'
+readonly export done export /usr/bin export sed && | && readonly printf
+	${HOME} "$1" | && -eu 2>/dev/null grep |
+	sed then | done export
+&& local sed awk && cd sed export printf sed awk /usr/bin then && awk
+		done echo x=1 printf echo ${HOME}
+	${HOME} ${HOME} && test 'quoted text' 2>/dev/null sed 2>/dev/null
+	x=1 done -eu readonly && awk echo export -eu awk -eu
+	$(pwd) && echo x=1 $(pwd)
+		${HOME} | grep x=1 "$@" sed /usr/bin --verbose $(pwd)
+		2>/dev/null echo x=1 2>/dev/null x=1
+		grep test && test --verbose grep test grep grep
+printf && "$@" ${HOME} test sed "$1" cd printf "$1" ${HOME} 2>/dev/null
+readonly local local --verbose 'quoted text'
+	done export | "$1" echo x=1 "$1" awk done then printf
+--verbose cd readonly --verbose x=1 /usr/bin | readonly test $(pwd)
+&& x=1 && "$1" then x=1 local --verbose --verbose
+		-eu -eu export printf && "$@" && printf 2>/dev/null
+local -eu export test 2>/dev/null /usr/bin "$1" --verbose
+&& $(pwd) test x=1 awk done readonly --verbose printf 2>/dev/null echo cd then
+&& then 'quoted text' $(pwd) 'quoted text' 'quoted text'
+	printf local printf /usr/bin && "$1" sed sed export "$1" &&
+	cd local x=1 -eu $(pwd) local export
+awk local printf awk readonly grep awk 'quoted text' && done
+		"$1" | | "$1" readonly printf done -eu sed -eu printf printf ${HOME} printf
+		$(pwd) | readonly $(pwd) done cd 2>/dev/null 'quoted text' 'quoted text'
+"$1" x=1 grep done 'quoted text' "$1"
+done grep readonly "$1" local
+	-eu printf readonly $(pwd)
+test done ${HOME} printf
+	-eu sed 2>/dev/null local /usr/bin 'quoted text' $(pwd)
+x=1 awk awk "$@" | export /usr/bin
+	x=1 x=1 test test --verbose ${HOME}
+grep | ${HOME} echo && | then echo then printf readonly
+	awk done local export | test /usr/bin then | readonly $(pwd) echo test /usr/bin
+| -eu done sed export "$@" grep && cd printf 2>/dev/null && $(pwd) test x=1
+	grep then cd then readonly
+| cd echo printf cd "$1" "$1" |
+then cd sed $(pwd) 'quoted text' "$1" --verbose
+		printf echo readonly export
+	--verbose $(pwd) x=1 2>/dev/null "$@" /usr/bin 'quoted text' export
+	2>/dev/null | then grep then export "$1"
+-eu "$1" "$@" cd $(pwd) 2>/dev/null echo "$@" --verbose echo export
+-eu then done test | 2>/dev/null
+		printf cd grep printf sed | 2>/dev/null echo export ${HOME} test printf awk
+		$(pwd) && "$@" printf --verbose then then readonly echo | 'quoted text'
+&& "$@" $(pwd) "$@" -eu export then
+		local /usr/bin 2>/dev/null local printf sed then -eu "$1" | | -eu
+	--verbose readonly ${HOME} 'quoted text'
+		readonly done grep -eu test done echo |
+	$(pwd) export 2>/dev/null && "$1" echo /usr/bin sed readonly "$1" x=1
+		export | "$1" then cd "$@" 'quoted text'
+	done sed /usr/bin printf --verbose | printf | done sed awk local
+	'quoted text' test "$@" "$1" /usr/bin -eu $(pwd) && test $(pwd) test
+	-eu cd awk --verbose awk cd export sed grep readonly echo
+export sed readonly local /usr/bin done "$@"
+$(pwd) --verbose readonly export x=1 --verbose printf --verbose && /usr/bin awk
+x=1 ${HOME} "$1" x=1 ${HOME}
+	2>/dev/null $(pwd) awk "$@" --verbose
+		&& /usr/bin sed then | && export ${HOME}
+		readonly then local readonly 'quoted text'
+then cd /usr/bin sed | grep | --verbose
+	sed then && /usr/bin then ${HOME} "$1" "$@"
+		printf $(pwd) cd local 'quoted text' local --verbose && cd sed $(pwd)
+		local 2>/dev/null --verbose 2>/dev/null grep echo sed then | cd
+		x=1 && /usr/bin awk local cd /usr/bin then && | sed "$@" "$@"
+	local awk -eu 2>/dev/null then sed
+		export done printf | then $(pwd) done -eu | && 'quoted text' awk done /usr/bin
+2>/dev/null then | local 2>/dev/null echo x=1
+	| 'quoted text' grep test awk && /usr/bin sed ${HOME} printf
+printf export sed printf -eu && $(pwd)
+	grep readonly export echo -eu | then
+		sed | ${HOME} 2>/dev/null --verbose /usr/bin sed printf
+then -eu "$1" x=1 awk sed -eu sed
+	&& -eu done cd | -eu local test "$@" then grep readonly
+		/usr/bin "$@" grep echo $(pwd) ${HOME} ${HOME} readonly "$1"
+$(pwd) 2>/dev/null readonly cd /usr/bin 2>/dev/null done "$@" "$1" echo
+	local ${HOME} readonly sed -eu
+		&& $(pwd) --verbose x=1 cd 2>/dev/null
+		printf /usr/bin printf 'quoted text' 2>/dev/null $(pwd)
+	local test test 'quoted text' export "$1" echo test echo x=1 -eu ${HOME} then
+	echo /usr/bin sed echo printf echo --verbose 2>/dev/null -eu echo
+	then echo ${HOME} ${HOME} cd && sed awk readonly done sed printf local local
+	done grep then printf awk done --verbose awk test awk awk "$1"
+'quoted text' ${HOME} "$@" $(pwd) cd local sed grep local x=1 2>/dev/null ${HOME}
+$(pwd) echo 'quoted text' printf
+		&& awk --verbose -eu $(pwd) | awk printf readonly test readonly echo /usr/bin
+	done /usr/bin sed x=1 printf | cd sed ${HOME} 'quoted text'
+	local printf && "$@" 2>/dev/null grep awk then /usr/bin "$@" 2>/dev/null
+		x=1 readonly then cd x=1 && x=1
+	$(pwd) 2>/dev/null awk sed | local grep && readonly $(pwd) echo awk 'quoted text'
+		--verbose cd readonly export 2>/dev/null sed
+test --verbose test 'quoted text' echo local awk --verbose
+	printf "$1" x=1 printf -eu x=1 readonly "$1" 2>/dev/null awk $(pwd) printf
+	sed then x=1 done cd 2>/dev/null echo x=1 -eu grep export awk test
+		--verbose echo echo readonly local 'quoted text'
+	sed echo test export $(pwd) done -eu | --verbose -eu cd sed "$1"
+sed test cd done sed /usr/bin export | export "$1" sed done
+		x=1 awk done then test awk export export
+	"$@" grep | cd cd 2>/dev/null x=1 /usr/bin 2>/dev/null grep | local -eu export
+	"$1" awk echo 2>/dev/null && grep echo awk export
+		"$1" done awk echo "$1" --verbose x=1 local test /usr/bin "$1" $(pwd) awk test
+		cd readonly test ${HOME} -eu then "$@" "$1"
+		x=1 sed "$@" grep $(pwd) echo then awk
+	done x=1 ${HOME} 'quoted text'
+x=1 -eu 2>/dev/null "$@" test $(pwd) local
+	done ${HOME} "$@" /usr/bin
+	&& 2>/dev/null cd -eu awk && | awk then local "$1" done /usr/bin --verbose
+		readonly done && "$1" readonly grep awk then -eu sed --verbose 'quoted text'
+	test echo cd cd 2>/dev/null grep --verbose
+cd "$@" /usr/bin done --verbose local 'quoted text' grep grep /usr/bin $(pwd)
+printf --verbose export local $(pwd) readonly sed -eu done export then 'quoted text'
+awk x=1 grep test "$@" 'quoted text' grep cd && 2>/dev/null
+		echo 'quoted text' done
+	${HOME} readonly --verbose then | local awk
+$(pwd) grep sed export done --verbose /usr/bin cd "$1"
+		| && x=1 && "$@" $(pwd) grep $(pwd) test | then x=1 export "$1"
+		&& done test && $(pwd) | 2>/dev/null then
+		$(pwd) ${HOME} done && && && 'quoted text' then local
+		export 2>/dev/null echo x=1 $(pwd) grep echo readonly | ${HOME} --verbose
+2>/dev/null awk test /usr/bin /usr/bin
+done test sed local test cd 2>/dev/null
+	${HOME} && x=1 then grep "$1" ${HOME} printf
+	$(pwd) ${HOME} grep $(pwd) then readonly "$1" printf x=1 done
+		readonly printf 'quoted text'
+| | x=1 test readonly echo sed -eu 'quoted text' export
+		printf then "$1" sed local --verbose
+	readonly then /usr/bin | echo local x=1 x=1 printf awk sed export | then "$1" "$1"
+	-eu printf echo x=1 && 2>/dev/null
+printf -eu then "$@" "$@" ${HOME} export
+x=1 local $(pwd) grep ${HOME} "$1" /usr/bin x=1 awk 2>/dev/null
+	&& then then x=1 | echo readonly then 'quoted text' printf
+		cd "$@" echo test awk done "$1"
+	"$@" echo 'quoted text' then
+'quoted text' readonly awk /usr/bin ${HOME} | echo 2>/dev/null readonly export
+		-eu test 2>/dev/null sed printf awk "$1" --verbose ${HOME} "$@" $(pwd) awk $(pwd)
+	| $(pwd) cd awk --verbose | grep
+		| awk awk /usr/bin done local | 2>/dev/null
+then x=1 local --verbose
+sed --verbose then awk && x=1 x=1 echo awk readonly "$@" &&
+		then then 2>/dev/null done then 'quoted text' $(pwd) local -eu 'quoted text'
+awk printf x=1 cd awk test | grep "$1" awk done
+		sed done export $(pwd) x=1 -eu /usr/bin
+	| awk readonly export x=1 -eu awk 2>/dev/null local sed printf --verbose cd awk
+	'quoted text' /usr/bin --verbose cd export --verbose local cd export
+	readonly /usr/bin -eu x=1 | printf 2>/dev/null x=1 --verbose printf
+test then | $(pwd) grep x=1 "$1"
+done "$@" printf --verbose printf /usr/bin echo $(pwd) readonly
+		x=1 done then && x=1 then readonly /usr/bin ${HOME} 'quoted text' readonly x=1
+		grep --verbose export test -eu "$1" $(pwd) --verbose
+	${HOME} echo test awk --verbose export printf 2>/dev/null
+		awk printf "$1" awk test grep ${HOME}
+		readonly grep export grep && | --verbose echo local /usr/bin local cd |
+cd -eu then test ${HOME} 2>/dev/null readonly --verbose
+		&& sed 2>/dev/null local /usr/bin
+	printf && then awk then local x=1 then && export export done local readonly
+x=1 'quoted text' then |
+	grep awk test "$1" ${HOME} printf done
+	| export /usr/bin && "$@" 2>/dev/null
+		${HOME} 2>/dev/null "$@" readonly --verbose
+		"$1" cd $(pwd) export readonly /usr/bin 2>/dev/null cd export
+		local 2>/dev/null "$1" done $(pwd) awk /usr/bin test sed export
+$(pwd) "$@" readonly x=1 /usr/bin test local /usr/bin "$@"
+| then printf sed | echo && echo then 'quoted text' 'quoted text'
+	grep "$@" done readonly 2>/dev/null && $(pwd) done test --verbose done
+		test "$@" | x=1 'quoted text' -eu sed sed readonly grep | then cd cd export
+		local readonly test $(pwd) && grep done test local
+readonly --verbose cd readonly | awk printf && --verbose &&
+printf | sed printf test printf --verbose sed | export echo
+	done && sed ${HOME} | ${HOME}
+	&& sed 2>/dev/null local then --verbose then --verbose /usr/bin 'quoted text'
+	"$@" "$1" done sed cd then local done
+	echo -eu grep done "$@" /usr/bin
+		--verbose x=1 awk 'quoted text' cd -eu /usr/bin
+		2>/dev/null then ${HOME} printf "$@" 'quoted text' --verbose
+| 2>/dev/null 'quoted text' -eu cd test 2>/dev/null
+		&& then && then x=1 printf printf test ${HOME} local awk then local -eu "$1"
+	"$1" sed printf ${HOME} "$1" then awk awk awk
+		2>/dev/null grep readonly 2>/dev/null
+test x=1 local awk echo && done printf test sed "$@" echo printf echo printf
+	"$@" readonly cd "$@" "$@" sed echo test grep
+	sed 2>/dev/null --verbose printf echo cd
+	/usr/bin -eu ${HOME} x=1 "$1"
+	2>/dev/null /usr/bin grep printf test
+		sed grep x=1 $(pwd) && $(pwd)
+		--verbose then ${HOME} then 'quoted text' readonly
+		"$1" && 2>/dev/null awk done printf 'quoted text' 2>/dev/null
+	awk --verbose local ${HOME} local local readonly
+		&& x=1 ${HOME} 'quoted text' export -eu $(pwd) && test printf cd
+test && 2>/dev/null then $(pwd) -eu
+'quoted text' cd -eu test grep $(pwd) --verbose --verbose printf x=1
+"$@" awk printf grep test done local 2>/dev/null then "$@" grep "$1" "$@"
+${HOME} "$@" awk ${HOME} ${HOME} $(pwd) | 2>/dev/null local echo x=1 "$1"
+x=1 then "$@" x=1 then --verbose $(pwd)
+	awk && 2>/dev/null --verbose awk readonly 2>/dev/null test grep then cd --verbose
+	local readonly then readonly grep 'quoted text' "$@"
+		export x=1 && "$@" printf echo | sed | readonly
+printf "$@" local export cd /usr/bin 2>/dev/null
+test | "$1" grep -eu then export echo sed grep echo $(pwd) done then | sed --verbose
+test ${HOME} export done cd "$@" echo cd "$@" export 2>/dev/null
+		sed cd --verbose awk /usr/bin "$1" "$@" export test printf | --verbose &&
+	'quoted text' /usr/bin echo 2>/dev/null | | 2>/dev/null
+		-eu echo sed ${HOME} awk $(pwd) "$@" awk then
+		2>/dev/null cd ${HOME} /usr/bin | done printf 2>/dev/null "$@" &&
+		$(pwd) 2>/dev/null x=1 readonly then 2>/dev/null local local echo done grep
+	${HOME} export then ${HOME} 'quoted text' 'quoted text' then ${HOME} readonly
+		--verbose x=1 awk export /usr/bin local 2>/dev/null test
+	readonly sed test "$@" then sed export local
+		export x=1 test -eu 2>/dev/null echo readonly x=1 --verbose
+		'quoted text' local | && $(pwd)
+	| printf "$1" grep printf readonly local "$@" readonly
+export $(pwd) --verbose -eu readonly
+	then done "$@" readonly
+		| test 2>/dev/null $(pwd) &&
+-eu done done x=1 2>/dev/null && 2>/dev/null $(pwd)
+		local | x=1 sed "$1" /usr/bin 'quoted text' 'quoted text' done -eu x=1 "$1"
+		done /usr/bin "$1" done 2>/dev/null printf
+&& x=1 "$1" readonly 2>/dev/null --verbose && 'quoted text'
+${HOME} "$@" awk then 2>/dev/null ${HOME} readonly
+	readonly ${HOME} "$@" && grep --verbose -eu "$1" readonly "$1" test -eu local
+		sed awk export grep awk "$1" export cd
+	'quoted text' printf readonly "$@" sed printf sed done "$@"
+echo | $(pwd) awk --verbose done then cd -eu ${HOME}
+		x=1 echo sed local "$1" local 'quoted text' && -eu -eu readonly
+	done readonly 2>/dev/null local && | ${HOME} 2>/dev/null ${HOME}
+	"$@" && then printf local sed
+"$1" x=1 "$@" 2>/dev/null test sed --verbose "$@" "$1"
+done "$1" export --verbose -eu readonly $(pwd) /usr/bin | echo export
+	/usr/bin test readonly "$@" && "$1" ${HOME} then cd 2>/dev/null $(pwd) awk --verbose
+local echo x=1 cd /usr/bin
+local sed 2>/dev/null awk local cd | sed local export "$@" readonly x=1 readonly
+		'quoted text' | && --verbose ${HOME} printf /usr/bin echo grep sed ${HOME}
+	readonly export | 2>/dev/null 2>/dev/null "$@"
+done local cd 'quoted text' cd local
+local cd awk $(pwd) local done then $(pwd)
+	test echo then | ${HOME} "$1"
+		"$@" /usr/bin done export 'quoted text'
+	x=1 'quoted text' 2>/dev/null -eu -eu /usr/bin printf
+	readonly -eu -eu printf then
+	then $(pwd) x=1 "$@" /usr/bin local sed --verbose | --verbose
+	printf sed | awk 'quoted text' 'quoted text' done $(pwd) | readonly echo test
+--verbose local --verbose ${HOME} printf done -eu "$1" awk && "$@" /usr/bin
+		then "$@" $(pwd) --verbose then && cd 2>/dev/null
+	"$1" $(pwd) $(pwd) -eu 2>/dev/null | 2>/dev/null "$@"
+cd /usr/bin --verbose -eu | sed | then awk export printf sed awk 2>/dev/null
+	2>/dev/null "$1" test | done -eu sed ${HOME} /usr/bin grep printf printf local
+		local done "$@" "$1" sed awk done then local "$1" -eu $(pwd) readonly x=1 test
+	grep 'quoted text' readonly "$@" echo x=1 --verbose done
+		--verbose local export export sed echo
+	cd cd test cd then -eu
+	--verbose done export $(pwd) done grep printf local $(pwd) "$1" 2>/dev/null
+printf readonly awk readonly ${HOME} | 'quoted text'
+	/usr/bin export grep grep && grep then && cd local "$1" cd /usr/bin
+		&& local test done && awk test grep printf
+	--verbose "$@" local x=1 x=1 then $(pwd)
+	"$@" -eu echo grep x=1 "$1" && ${HOME} && awk "$1" cd | "$1" awk /usr/bin
+	cd x=1 /usr/bin done 'quoted text' readonly $(pwd) test --verbose
+		&& awk 'quoted text' sed && "$1" local --verbose --verbose done
+"$1" x=1 done "$@" export x=1 printf $(pwd)
+readonly /usr/bin cd grep test cd then then 'quoted text'
+		--verbose --verbose -eu local 'quoted text'
+		'quoted text' cd export 'quoted text'
+local local "$@" x=1 "$1" -eu --verbose printf $(pwd) "$1" 2>/dev/null
+		| --verbose export sed && then | -eu /usr/bin awk /usr/bin 'quoted text'
+	--verbose $(pwd) ${HOME}
+		x=1 "$@" x=1 cd --verbose local
+	done 2>/dev/null "$@" export export test cd 2>/dev/null grep
+	"$@" 2>/dev/null readonly
+	grep "$@" 2>/dev/null done 2>/dev/null x=1 -eu
+		echo readonly sed --verbose then "$1"
+	'quoted text' "$1" cd x=1 $(pwd) /usr/bin test && grep
+		readonly x=1 x=1 export
+echo | $(pwd) --verbose $(pwd) readonly sed local echo echo readonly --verbose
+	then sed awk "$1" -eu | 2>/dev/null
+	grep -eu cd cd -eu x=1 x=1 $(pwd) readonly x=1
+cd grep sed x=1 && | awk x=1 'quoted text' sed awk printf echo /usr/bin then
+"$1" printf 2>/dev/null sed "$@" 'quoted text'
+	2>/dev/null local sed test | -eu grep x=1 x=1 cd "$1" | x=1 echo $(pwd)
+		done $(pwd) "$1" done grep
+$(pwd) 2>/dev/null x=1 sed 2>/dev/null
+	echo && then "$@" test --verbose 'quoted text' printf awk test --verbose
+	x=1 test --verbose echo "$@" --verbose readonly cd then
+then $(pwd) 'quoted text' readonly -eu x=1 'quoted text' | then test
+		2>/dev/null then printf
+		${HOME} cd printf local echo
+echo test $(pwd) "$@" x=1 $(pwd) --verbose test 2>/dev/null "$@" /usr/bin
+	"$1" export && sed readonly echo ${HOME}
+		local "$1" readonly grep $(pwd) readonly
+		$(pwd) awk /usr/bin cd -eu awk local && "$@" grep 'quoted text' "$@" /usr/bin cd
+	x=1 /usr/bin | -eu -eu --verbose
+		-eu --verbose test 'quoted text' "$1"
+	test "$1" export local 'quoted text' $(pwd) printf export | "$@" test done -eu
+local sed export awk test test "$1" /usr/bin x=1 grep "$@"
+export --verbose $(pwd) -eu && | && 2>/dev/null sed "$1" echo
+	then grep local --verbose cd && "$@" readonly "$@"
+	${HOME} /usr/bin export 'quoted text'
+	cd --verbose readonly x=1 ${HOME} "$@" export && --verbose
+	test done sed ${HOME} readonly grep sed done -eu && printf cd
+"$1" /usr/bin | done x=1
+readonly awk ${HOME} "$@" | | export && export
+	--verbose | local echo printf grep x=1 --verbose "$@" echo x=1
+&& -eu && sed | cd printf "$@" "$1" readonly echo readonly ${HOME} cd
+	grep echo sed "$1" printf echo readonly done && sed echo "$1" done ${HOME} local
+	"$@" -eu cd readonly readonly -eu /usr/bin then "$1" printf | -eu
+--verbose 'quoted text' test sed && cd --verbose sed
+	--verbose -eu local done
+2>/dev/null export export echo test 2>/dev/null readonly ${HOME} done
+		export | then echo awk test --verbose cd sed printf 2>/dev/null /usr/bin readonly
+cd "$@" | cd grep && && 'quoted text'
+2>/dev/null echo | export done "$1" "$@" printf 'quoted text' x=1
+		x=1 && "$1" printf -eu grep then
+&& x=1 ${HOME} cd export /usr/bin then then cd ${HOME} 'quoted text' 'quoted text'
+	test echo printf ${HOME} -eu --verbose
+		2>/dev/null done --verbose | test $(pwd) then ${HOME} sed printf
+		${HOME} && echo ${HOME} sed 'quoted text'
+		"$@" "$1" cd test --verbose echo awk
+		grep then cd grep printf awk then echo 2>/dev/null
+"$1" test printf sed cd readonly printf cd "$1" export /usr/bin
+	| 'quoted text' -eu | ${HOME} 'quoted text' 2>/dev/null --verbose printf
+	readonly echo then $(pwd)
+		| readonly $(pwd) $(pwd) export /usr/bin && echo
+	x=1 awk && echo ${HOME} 2>/dev/null
+		2>/dev/null cd local grep echo done printf ${HOME} "$1" readonly test --verbose
+		printf cd awk | grep --verbose printf "$1" cd echo 'quoted text'
+		-eu export echo echo 'quoted text' $(pwd)
+		${HOME} 2>/dev/null sed $(pwd) "$@" x=1
+${HOME} 2>/dev/null -eu awk -eu echo done then "$1" sed
+	local test test -eu && --verbose x=1 2>/dev/null
+	test && "$1" sed awk /usr/bin 2>/dev/null readonly awk | x=1 2>/dev/null 2>/dev/null
+cd then 2>/dev/null | && --verbose export 'quoted text'
+	| echo echo x=1 "$1" readonly cd echo local
+	-eu echo && "$1" && local -eu 'quoted text' readonly --verbose printf
+'quoted text' done sed -eu ${HOME} test awk "$@" test 'quoted text'
+test ${HOME} --verbose
+		&& cd export readonly 'quoted text' cd test -eu
+	readonly awk && sed -eu readonly 'quoted text' --verbose "$1" sed
+		test done --verbose test --verbose
+	x=1 ${HOME} ${HOME} --verbose
+	$(pwd) then "$1" awk grep
+	x=1 "$@" echo done && printf grep
+grep grep 'quoted text' ${HOME} awk readonly awk x=1 printf
+local cd && grep local
+"$1" local test echo 'quoted text'
+	--verbose export ${HOME} grep export printf ${HOME} grep grep
+		printf ${HOME} /usr/bin echo "$@"
+$(pwd) grep /usr/bin local 2>/dev/null done awk printf
+		/usr/bin local --verbose then awk | export 'quoted text'
+readonly grep then cd printf cd export grep sed
+		2>/dev/null local && printf echo export
+	then export $(pwd) cd export /usr/bin
+	/usr/bin && cd ${HOME} test export && && grep awk test readonly "$@" awk printf
+		-eu test --verbose done cd $(pwd) export printf awk 'quoted text'
+		printf 2>/dev/null test echo awk then /usr/bin echo then && sed then
+		-eu $(pwd) echo "$1" local done x=1 echo test 'quoted text' export
+2>/dev/null 2>/dev/null readonly $(pwd) printf
+		${HOME} 'quoted text' "$@" export test "$@"
+		then 'quoted text' "$1" "$1" 2>/dev/null cd echo 'quoted text' printf --verbose
+--verbose x=1 done readonly grep test | ${HOME} | && 'quoted text'
+$(pwd) cd export $(pwd) | | 'quoted text'
+"$@" "$1" test "$1" ${HOME} /usr/bin test x=1 x=1 export local cd awk printf 'quoted text'
+export "$@" export sed local | test readonly test local local
+		printf readonly -eu sed cd echo then awk "$1" cd local "$@" done done sed 'quoted text'
+		echo ${HOME} --verbose then 'quoted text' "$@" export /usr/bin
+		readonly -eu "$@" -eu printf cd done
+/usr/bin export test cd 'quoted text'
+-eu done test grep | echo test
+		cd "$@" && echo /usr/bin "$@" ${HOME} $(pwd) -eu awk
+		readonly $(pwd) then awk then /usr/bin awk
+		then then 'quoted text' /usr/bin x=1 awk | local awk 2>/dev/null echo /usr/bin
+	${HOME} local test && test 'quoted text'
+		--verbose "$1" cd $(pwd) "$1" awk export && grep &&
+	-eu ${HOME} grep export $(pwd) readonly then 'quoted text'
+		export | grep x=1 x=1 --verbose test
+	/usr/bin printf -eu grep x=1
+echo 2>/dev/null test $(pwd) sed cd sed --verbose then then echo | ${HOME}
+printf 2>/dev/null && --verbose x=1 export ${HOME} printf
+		&& echo --verbose local --verbose
+		--verbose "$1" 'quoted text' -eu && awk grep "$@" | cd 2>/dev/null -eu then
+	awk grep 2>/dev/null | readonly | local x=1 sed | 2>/dev/null grep
+"$1" -eu grep done local readonly "$@" grep
+		$(pwd) then --verbose /usr/bin
+	"$@" cd -eu readonly "$@" export "$@" /usr/bin cd "$1" --verbose test
+"$@" $(pwd) then readonly then echo && 2>/dev/null
+		${HOME} echo local 2>/dev/null
+		echo | grep --verbose 'quoted text' -eu grep sed && ${HOME} test test
+		sed test | sed awk --verbose /usr/bin "$1" -eu | printf && readonly
+		readonly 'quoted text' /usr/bin 2>/dev/null export readonly
+		/usr/bin test x=1 x=1 printf sed -eu /usr/bin /usr/bin printf test
+	export "$@" -eu --verbose then
+	${HOME} 2>/dev/null "$@" printf
+grep then export local --verbose "$@" "$1" && done
+	/usr/bin then awk echo done /usr/bin --verbose | awk -eu test "$1" printf
+		| $(pwd) "$@" -eu test "$1" /usr/bin ${HOME} 'quoted text' -eu
+		2>/dev/null awk awk --verbose -eu "$@" then export $(pwd)
+cd grep readonly $(pwd) x=1 test --verbose export "$1" x=1 2>/dev/null
+cd /usr/bin awk 2>/dev/null
+-eu done done echo then grep awk x=1 &&
+	/usr/bin x=1 "$@" 2>/dev/null then $(pwd) && 2>/dev/null
+done printf && 'quoted text' x=1 grep /usr/bin "$1" | "$@" 'quoted text'
+		"$@" export ${HOME} 'quoted text' local -eu printf test x=1 $(pwd) /usr/bin
+		cd done 'quoted text' -eu local grep sed test 2>/dev/null $(pwd)
+		${HOME} 'quoted text' x=1
+	grep export echo /usr/bin $(pwd) | | readonly ${HOME} printf
+		done export sed readonly local echo /usr/bin cd readonly "$1" then ${HOME} done
+grep printf "$@" ${HOME} grep -eu && $(pwd)
+		${HOME} local && done
+		'quoted text' 2>/dev/null then
+	${HOME} sed x=1 $(pwd) readonly test
+printf $(pwd) "$1" ${HOME} echo cd then "$1"
+	x=1 2>/dev/null grep 2>/dev/null | /usr/bin --verbose && && awk test
+awk done sed "$@" --verbose cd && 2>/dev/null
+	echo then sed --verbose cd $(pwd)
+then 'quoted text' printf x=1 echo awk -eu "$1" sed
+		echo cd | -eu /usr/bin awk echo -eu x=1 --verbose sed ${HOME} cd --verbose
+		local | --verbose grep "$1" local local done readonly sed then | | done "$@"
+echo | awk "$1" then test "$1" -eu then echo then printf --verbose 'quoted text'
+		sed && readonly 'quoted text' ${HOME} printf printf cd then export then
+cd "$@" done cd echo then "$1" printf --verbose local
+	then done grep --verbose sed printf 'quoted text'
+export /usr/bin x=1 --verbose export local local --verbose /usr/bin --verbose
+		local then && "$@" /usr/bin awk local ${HOME}
+| "$@" | done ${HOME} grep test
+&& grep export -eu x=1 printf x=1 done "$@" ${HOME} 'quoted text'
+x=1 --verbose export grep
+"$1" ${HOME} 2>/dev/null echo x=1 echo
+printf awk cd test local
+	readonly /usr/bin /usr/bin echo | $(pwd) x=1 | test cd local -eu "$1" "$@"
+	readonly local -eu echo
+-eu $(pwd) && $(pwd) readonly 'quoted text'
+done /usr/bin | cd x=1 printf cd 2>/dev/null -eu cd
+	-eu grep --verbose test | x=1 printf
+	| grep cd local printf -eu cd && x=1 && echo --verbose --verbose
+done grep && -eu grep -eu local sed sed /usr/bin --verbose cd /usr/bin
+	done sed printf echo printf /usr/bin echo 'quoted text'
+-eu grep /usr/bin "$@" "$1" --verbose
+grep $(pwd) /usr/bin grep grep --verbose ${HOME} test x=1 2>/dev/null
+		'quoted text' -eu export cd then sed readonly -eu awk /usr/bin 2>/dev/null
+		2>/dev/null then "$1" | awk export
+		sed local "$@" local local -eu ${HOME}
+	&& "$@" "$@" && 'quoted text'
+/usr/bin $(pwd) export done local sed then grep grep | grep &&
+awk awk x=1 printf /usr/bin done
+	$(pwd) awk "$1" | test /usr/bin "$1" readonly
+	echo && awk printf awk awk export grep test && local local
+	/usr/bin sed printf /usr/bin readonly x=1 test
+	"$1" sed grep 'quoted text' -eu -eu then cd 'quoted text' printf x=1 $(pwd)
+then local done local && echo sed cd sed echo --verbose test local
+$(pwd) ${HOME} test /usr/bin "$1" /usr/bin --verbose
+	then "$@" export test "$@" "$1" "$1" sed awk ${HOME} -eu echo
+export && "$1" then -eu test printf /usr/bin
+	'quoted text' test $(pwd) --verbose --verbose export "$1" local -eu echo /usr/bin
+$(pwd) 2>/dev/null echo
+		| ${HOME} -eu $(pwd) /usr/bin awk $(pwd) 'quoted text'
+	grep sed 'quoted text' cd
+local readonly 'quoted text' test x=1 done /usr/bin
+		readonly 'quoted text' then grep -eu -eu x=1 ${HOME} 'quoted text'
+	2>/dev/null sed 2>/dev/null $(pwd) --verbose then local
+'quoted text' test "$@" export grep "$@" grep | -eu x=1
+export test done export readonly --verbose
+		2>/dev/null echo printf 'quoted text' | | /usr/bin && local export --verbose
+	readonly "$@" readonly export /usr/bin test export test export
+	test cd | /usr/bin 'quoted text' | -eu done | |
+--verbose export "$1" test | done then cd sed ${HOME}
+		/usr/bin -eu printf x=1 "$1" x=1 sed local sed
+	sed cd 2>/dev/null local
+local 'quoted text' cd cd "$@" readonly then cd awk
+"$@" 'quoted text' grep x=1 "$1" /usr/bin | "$1" done done printf readonly readonly
+	local && 'quoted text'
+		&& ${HOME} && sed echo "$@"
+test local echo ${HOME} /usr/bin
+		printf /usr/bin "$@" --verbose printf readonly readonly
+	sed -eu /usr/bin echo then -eu ${HOME} grep readonly && "$1"
+| printf printf -eu x=1 ${HOME} awk -eu printf "$1" then "$1" -eu
+-eu | && local /usr/bin echo export local
+echo readonly --verbose 2>/dev/null && x=1 2>/dev/null
+		cd $(pwd) printf /usr/bin test grep
+	2>/dev/null x=1 export 2>/dev/null done readonly "$@"
+		| | "$@" $(pwd) cd && echo && cd printf
+	${HOME} awk test test "$@" then local readonly done $(pwd) done local
+	--verbose --verbose grep readonly && done 2>/dev/null x=1 2>/dev/null sed echo
+	awk echo then readonly | 2>/dev/null done 'quoted text' test local
+	x=1 --verbose printf printf --verbose done 'quoted text'
+then && readonly 'quoted text' echo local --verbose readonly local --verbose
+		export 2>/dev/null local && awk && | 'quoted text'
+| sed printf && readonly
+		printf grep ${HOME} ${HOME} 2>/dev/null then done printf
+	grep | 'quoted text' cd 2>/dev/null
+$(pwd) 'quoted text' sed 2>/dev/null 2>/dev/null x=1 "$1"
+/usr/bin && $(pwd) readonly awk
+&& "$1" "$1" "$@" cd && -eu "$@"
+/usr/bin "$@" --verbose -eu -eu export && /usr/bin && $(pwd)
+		2>/dev/null then | cd -eu test -eu
+		grep grep "$@" x=1 2>/dev/null readonly /usr/bin readonly
+	"$1" done awk then 'quoted text'
+"$1" cd printf | $(pwd) grep
+		| "$@" printf readonly then test printf awk /usr/bin ${HOME} $(pwd) $(pwd)
+	'quoted text' test --verbose
+		--verbose then "$1" x=1 "$1" grep test done readonly
+	"$1" sed && --verbose local readonly export $(pwd) x=1 'quoted text'
+readonly awk grep sed
+/usr/bin local x=1 "$1"
+	$(pwd) echo then done "$1" readonly "$1"
+		"$@" done 2>/dev/null sed echo readonly export "$1" echo
+	2>/dev/null ${HOME} "$1" --verbose x=1 readonly $(pwd)
+		| sed done -eu -eu "$@"
+2>/dev/null cd readonly 2>/dev/null "$@" test
+${HOME} then "$1" sed "$1" sed cd test cd cd $(pwd) ${HOME} local printf
+-eu printf cd --verbose $(pwd) grep ${HOME} local "$@" ${HOME}
+		local --verbose sed ${HOME} | "$@" grep $(pwd) awk echo readonly printf sed "$@"
+echo echo sed local then --verbose echo -eu local grep done 'quoted text'
+	&& | sed grep sed then --verbose grep
+		export /usr/bin grep local | ${HOME} grep
+		--verbose done cd /usr/bin $(pwd) awk cd && /usr/bin "$1" 'quoted text'
+then then 2>/dev/null sed then -eu cd -eu | printf /usr/bin echo
+$(pwd) && /usr/bin echo "$1" ${HOME}
+	/usr/bin sed export --verbose printf sed done && echo 'quoted text' $(pwd) grep
+then $(pwd) -eu /usr/bin $(pwd) then | "$@" printf export /usr/bin test awk $(pwd)
+		${HOME} && awk awk -eu
+	'quoted text' --verbose readonly ${HOME} echo local x=1 local export
+${HOME} echo awk /usr/bin && then -eu readonly
+		echo x=1 2>/dev/null grep done --verbose
+"$1" awk 'quoted text' 2>/dev/null 2>/dev/null sed echo 'quoted text'
+		2>/dev/null && echo printf awk x=1
+done $(pwd) local 'quoted text' local sed then "$@" -eu
+	-eu "$1" | then $(pwd) done then x=1 'quoted text' -eu x=1
+readonly --verbose "$1" $(pwd) printf
+		echo /usr/bin | grep sed | sed awk 2>/dev/null $(pwd) export ${HOME}
+		test $(pwd) 2>/dev/null sed sed grep /usr/bin readonly --verbose printf ${HOME}
+--verbose /usr/bin sed sed export --verbose then 'quoted text' --verbose x=1 local
+	$(pwd) --verbose then $(pwd) echo ${HOME} "$1" -eu --verbose 2>/dev/null
+	| local "$1" readonly local done ${HOME} printf echo && "$@" awk --verbose &&
+printf -eu test -eu "$1" --verbose printf --verbose "$@" printf $(pwd) sed
+	done && done 2>/dev/null | -eu /usr/bin 2>/dev/null
+		local readonly cd done "$@" ${HOME} x=1 x=1 | readonly 'quoted text'
+${HOME} done 'quoted text' grep /usr/bin readonly && x=1 cd "$@" 2>/dev/null
+		awk "$@" 2>/dev/null cd 2>/dev/null cd | then grep -eu local
+		"$1" --verbose done 2>/dev/null
+	printf && test local 2>/dev/null $(pwd) readonly
+	${HOME} /usr/bin grep "$1" readonly awk $(pwd) "$1" ${HOME} --verbose
+		"$1" grep "$1" done | readonly $(pwd) grep awk awk
+	export readonly done readonly -eu readonly export sed "$@"
+	local /usr/bin "$1" echo test -eu 'quoted text' sed "$1" then test readonly
+done export x=1 ${HOME} 'quoted text' export sed 2>/dev/null awk
+		echo && ${HOME} test --verbose x=1 cd test /usr/bin
+grep export | test ${HOME} /usr/bin "$1" sed printf && echo cd then ${HOME}
+cd readonly && readonly awk then /usr/bin
+	grep "$@" /usr/bin then awk then then -eu cd &&
+test 2>/dev/null ${HOME}
+	readonly sed /usr/bin 'quoted text' then "$1" cd then sed -eu && printf local
+awk 2>/dev/null readonly $(pwd) $(pwd) $(pwd) readonly readonly "$1" readonly
+| readonly printf printf grep /usr/bin
+2>/dev/null sed grep export echo -eu sed export x=1 awk
+grep "$@" -eu /usr/bin cd 'quoted text' $(pwd) "$@" x=1 export cd cd $(pwd)
+		awk test $(pwd) ${HOME} done readonly done then then then "$1" "$@" $(pwd)
+"$@" sed ${HOME} then $(pwd) --verbose readonly
+	export grep then test x=1 "$1" local --verbose $(pwd) test 2>/dev/null
+	test awk -eu printf sed $(pwd) test readonly
+		$(pwd) echo | local 'quoted text'
+&& done "$@" readonly --verbose awk /usr/bin /usr/bin -eu printf && ${HOME}
+	readonly --verbose sed readonly "$1" | printf sed ${HOME} grep cd sed $(pwd) then
+		awk && $(pwd) export then awk 'quoted text' $(pwd) "$1" test sed --verbose
+echo echo "$@" /usr/bin echo $(pwd) then $(pwd) "$@" test sed /usr/bin
+	--verbose sed grep then grep $(pwd)
+	'quoted text' | awk && awk /usr/bin test x=1 readonly
+done cd 'quoted text' cd "$1" grep 2>/dev/null export echo $(pwd) | echo "$1"
+readonly printf -eu 'quoted text'
+	${HOME} cd printf awk cd local "$1" readonly
+		awk "$1" "$@" echo 2>/dev/null ${HOME} echo $(pwd)
+	cd export && "$@" then --verbose
+		done "$1" printf readonly export test 'quoted text' --verbose $(pwd) "$1"
+cd printf printf ${HOME} 'quoted text' x=1
+	${HOME} then sed local export then -eu 2>/dev/null readonly "$1"
+x=1 $(pwd) ${HOME} 'quoted text' cd --verbose --verbose readonly echo $(pwd) printf
+then /usr/bin "$@" --verbose test test
+		export -eu test sed cd export cd | local done awk ${HOME} then export grep readonly
+$(pwd) "$1" sed awk -eu sed "$1" "$@" | grep -eu done 2>/dev/null then done
+	--verbose "$@" sed x=1 done -eu "$1" then "$1" test
+		/usr/bin echo test 'quoted text' /usr/bin $(pwd)
+		| sed "$1" /usr/bin printf 2>/dev/null
+	test printf "$1" local | sed readonly /usr/bin "$@" done
+	| | echo sed $(pwd) 'quoted text' awk && cd 'quoted text'
+"$@" then $(pwd) "$@" -eu | awk ${HOME}
+	done cd done printf readonly "$@" grep printf 2>/dev/null
+2>/dev/null ${HOME} /usr/bin
+		--verbose 'quoted text' export sed "$1" | echo printf
+		export /usr/bin --verbose readonly x=1 readonly cd grep
+-eu -eu ${HOME} -eu x=1 $(pwd)
+		'quoted text' readonly then test export "$1" readonly cd && && 'quoted text' readonly
+		then readonly | grep x=1 /usr/bin
+	&& --verbose | printf local export echo
+	readonly done "$@" -eu &&
+	--verbose -eu $(pwd) --verbose done 2>/dev/null awk echo ${HOME}
+sed local && && grep "$@" echo printf $(pwd) test
+	then grep -eu cd grep | ${HOME} $(pwd) | | sed /usr/bin grep local done
+/usr/bin --verbose && --verbose
+		-eu "$1" export test awk | && "$@" "$@" echo -eu readonly cd 'quoted text' then
+	2>/dev/null "$1" $(pwd)
+readonly 2>/dev/null | -eu ${HOME}
+	-eu then local -eu "$1" awk export sed ${HOME} test $(pwd)
+		export --verbose awk grep x=1 | "$1" "$@" $(pwd) sed echo $(pwd) awk printf 2>/dev/null
+-eu export /usr/bin 2>/dev/null
+export 2>/dev/null printf && awk $(pwd) $(pwd) "$@" x=1 printf done 'quoted text'
+x=1 "$1" "$1" readonly export | echo 2>/dev/null
+	local local printf awk x=1 && done echo export test /usr/bin grep printf
+	&& export printf echo done test
+		export ${HOME} 2>/dev/null local then | readonly
+	local sed cd 'quoted text' printf && ${HOME} $(pwd)
+	x=1 local 2>/dev/null "$1" grep then x=1 export export
+export -eu awk ${HOME} 'quoted text' awk test -eu /usr/bin x=1 echo x=1 'quoted text'
+	2>/dev/null awk awk -eu $(pwd) $(pwd) sed
+	| --verbose sed printf 2>/dev/null
+| 2>/dev/null awk grep test grep /usr/bin
+		grep test "$1" cd "$1"
+	"$1" local 2>/dev/null && --verbose "$@" "$@" awk | grep "$1"
+	'quoted text' x=1 ${HOME} readonly
+		'quoted text' awk $(pwd)
+2>/dev/null awk cd && x=1 'quoted text' "$@" test cd "$1" cd ${HOME}
+${HOME} local | grep cd "$@" printf awk 'quoted text' awk 'quoted text'
+	'quoted text' export "$1" readonly 2>/dev/null
+		$(pwd) 2>/dev/null /usr/bin then sed | -eu awk awk test awk ${HOME} export "$1"
+		${HOME} echo echo "$1" 2>/dev/null then /usr/bin printf sed
+		cd then | 2>/dev/null grep awk --verbose local
+--verbose x=1 && cd 'quoted text' printf
+${HOME} sed && test 2>/dev/null
+		/usr/bin --verbose /usr/bin then $(pwd) echo awk x=1 x=1 'quoted text' "$@" /usr/bin
+--verbose cd sed -eu ${HOME} | test "$@" $(pwd) ${HOME} grep export /usr/bin then
+	export done -eu awk local cd test && echo local then readonly -eu grep
+	echo export "$@" readonly printf local
+		x=1 echo done echo /usr/bin echo printf
+		&& x=1 "$1" | --verbose grep x=1 local "$@" sed /usr/bin readonly printf ${HOME}
+	x=1 ${HOME} awk sed export x=1 cd export 'quoted text'
+		x=1 sed --verbose readonly then ${HOME} | printf ${HOME} awk local /usr/bin
+		-eu "$@" printf sed test
+	printf then "$1" 2>/dev/null
+		done | | "$@" readonly 'quoted text' local then grep then cd test
+	x=1 awk then | x=1 'quoted text' cd $(pwd)
+	export local "$@" echo grep export awk grep cd $(pwd) 'quoted text' /usr/bin
+	cd export test local /usr/bin -eu local /usr/bin echo -eu cd
+/usr/bin test --verbose readonly cd 'quoted text' echo export echo
+	&& -eu grep && local "$@" 2>/dev/null done /usr/bin "$1"
+local $(pwd) $(pwd) && printf awk then 2>/dev/null sed -eu
+	&& awk $(pwd) /usr/bin export "$1" sed echo
+	| test then grep $(pwd) |
+		/usr/bin cd $(pwd) done ${HOME} $(pwd)
+	awk "$@" readonly local done readonly
+		readonly then "$1" "$1" $(pwd) ${HOME} printf grep local export |
+		cd x=1 'quoted text' sed ${HOME} then 'quoted text' --verbose /usr/bin local
+test printf done | -eu cd ${HOME}
+		&& $(pwd) "$1" "$@" sed echo
+		&& sed printf printf --verbose
+&& export export "$@" "$@" -eu && "$@" test cd awk
+		printf $(pwd) grep export ${HOME} "$1" 'quoted text'
+2>/dev/null && then "$1" | -eu ${HOME} echo x=1 printf
+done ${HOME} export echo 2>/dev/null test 2>/dev/null local /usr/bin && |
+		2>/dev/null --verbose printf 'quoted text'
+	/usr/bin /usr/bin export awk ${HOME} readonly local x=1 local export
+then export printf sed ${HOME} done sed /usr/bin ${HOME} done && &&
+		"$1" awk --verbose --verbose && printf export local
+		awk done /usr/bin then x=1 && ${HOME}
+test readonly x=1 export $(pwd) echo export test export "$1" sed printf
+/usr/bin 'quoted text' ${HOME} 2>/dev/null printf 2>/dev/null done 'quoted text'
+	local 'quoted text' /usr/bin echo
+&& printf cd cd awk local -eu awk 2>/dev/null -eu printf --verbose done
+awk cd -eu $(pwd) 'quoted text' printf then ${HOME} ${HOME}
+x=1 --verbose | printf test cd cd then ${HOME}
+| awk readonly export -eu /usr/bin then | grep export ${HOME}
+		${HOME} local "$@" then printf 'quoted text' "$1" grep ${HOME} printf
+		sed cd x=1 cd ${HOME} local readonly --verbose ${HOME} local echo
+&& grep cd "$@" awk "$1" local --verbose /usr/bin export awk then readonly
+		/usr/bin /usr/bin local ${HOME} --verbose done x=1 /usr/bin
+grep 'quoted text' -eu grep cd "$@" /usr/bin awk "$1" local cd --verbose
+$(pwd) sed ${HOME} test 'quoted text' sed --verbose
+done export then "$@" export $(pwd) x=1 "$1" && /usr/bin ${HOME} 'quoted text'
+	${HOME} cd "$@" test
+	--verbose then "$@" -eu export printf readonly local
+local 'quoted text' --verbose done awk done "$1" local
+	cd then 2>/dev/null export && && readonly && grep
+		sed local local then "$@" 'quoted text' | /usr/bin echo done "$@" --verbose
+	awk grep 'quoted text' | x=1 local
+	local && x=1 "$1" && /usr/bin
+		awk test awk 'quoted text' test "$@" && /usr/bin test then $(pwd) sed "$@" --verbose
+		cd grep /usr/bin echo done 2>/dev/null printf test 'quoted text' 2>/dev/null
+	${HOME} -eu ${HOME} x=1 then "$@" local cd -eu ${HOME} sed "$@"
+	$(pwd) ${HOME} done -eu echo export
+	local --verbose then awk x=1 local $(pwd)
+	$(pwd) local x=1 echo local echo
+	--verbose done echo export
+x=1 ${HOME} "$@" --verbose "$@" $(pwd) | /usr/bin && test
+		"$1" grep x=1 test echo 2>/dev/null "$@" $(pwd) sed && grep --verbose
+	-eu sed 'quoted text' x=1 export
+2>/dev/null $(pwd) && 'quoted text'
+"$@" printf sed printf echo awk && 2>/dev/null
+	${HOME} "$@" export ${HOME} --verbose /usr/bin "$1" export "$1" readonly local
+readonly && x=1 then "$@" grep done | cd awk export
+		-eu -eu readonly ${HOME}
+		then done then 'quoted text' 2>/dev/null
+then done && "$@" /usr/bin 2>/dev/null
+readonly 2>/dev/null awk 'quoted text' printf -eu -eu 2>/dev/null
+-eu && && cd --verbose 'quoted text'
+		/usr/bin then local $(pwd) readonly -eu /usr/bin && 2>/dev/null grep --verbose
+	"$1" -eu 2>/dev/null && 'quoted text' grep echo grep
+local 2>/dev/null cd 'quoted text'
+	"$@" cd --verbose $(pwd) "$1" sed 'quoted text' export grep /usr/bin sed export
+		cd done 'quoted text' readonly
+		sed readonly then -eu $(pwd) $(pwd) -eu cd
+	"$1" export | echo echo "$@" grep -eu x=1 cd -eu
+	| "$1" printf --verbose cd 'quoted text' done
+readonly cd grep $(pwd) | ${HOME} --verbose
+cd readonly printf --verbose test sed readonly /usr/bin
+	echo done printf && && grep awk test --verbose --verbose sed awk && cd "$1"
+--verbose x=1 export $(pwd) x=1 | "$@" --verbose ${HOME} -eu 2>/dev/null
+	&& test --verbose sed -eu echo --verbose
+	-eu -eu awk "$@" 2>/dev/null grep local && local --verbose awk export
+/usr/bin ${HOME} 'quoted text'
+		grep 'quoted text' test printf "$@"
+	done export && "$@" export x=1 then local then printf | | x=1 test 'quoted text'
+$(pwd) 2>/dev/null printf export "$1" ${HOME} x=1 -eu $(pwd)
+export readonly local ${HOME} local $(pwd) export readonly
+awk then --verbose "$1" cd && local sed -eu export x=1
+		"$@" echo export then ${HOME} --verbose -eu readonly -eu export grep echo "$@"
+	done && $(pwd) $(pwd) "$1" --verbose sed $(pwd) /usr/bin -eu &&
+	grep $(pwd) x=1 "$1" cd then ${HOME} readonly printf echo /usr/bin then readonly
+	done 2>/dev/null printf export echo readonly test printf
+	'quoted text' -eu export test x=1
+-eu /usr/bin 'quoted text'
+	'quoted text' grep local $(pwd) ${HOME} export done 'quoted text'
+--verbose $(pwd) readonly local export --verbose local "$@" printf &&
+		/usr/bin echo /usr/bin done local sed done /usr/bin && printf "$@" 'quoted text'
+	cd --verbose cd done done | cd --verbose local 2>/dev/null grep sed $(pwd) grep
+	done grep --verbose $(pwd) cd /usr/bin "$@" awk printf done 2>/dev/null local export
+		${HOME} --verbose cd "$@"
+		sed ${HOME} $(pwd) 'quoted text' && grep done printf "$@" grep "$1"
+		cd /usr/bin grep x=1 test | "$@" -eu
+		x=1 printf 2>/dev/null | awk done awk 'quoted text' cd cd test
+	x=1 && then sed local /usr/bin --verbose | echo awk /usr/bin
+		grep done cd "$@" $(pwd)
+		| printf $(pwd) local && 2>/dev/null
+	printf awk export ${HOME} readonly $(pwd) awk && printf | local readonly
+"$@" printf readonly readonly export 2>/dev/null
+		test --verbose 'quoted text' cd test echo export /usr/bin "$@" then "$@"
+		readonly readonly ${HOME} then echo
+	--verbose $(pwd) x=1 --verbose then /usr/bin export
+printf | readonly /usr/bin | export x=1 test grep printf
+	--verbose cd --verbose -eu then -eu | printf 'quoted text'
+	/usr/bin -eu readonly "$@" export sed "$1" --verbose
+	echo "$@" "$1" readonly cd $(pwd) awk sed ${HOME} echo /usr/bin awk
+		awk "$@" then readonly sed 2>/dev/null grep then
+sed x=1 echo "$@" 2>/dev/null readonly awk readonly
+cd 'quoted text' $(pwd) printf then awk 'quoted text' 2>/dev/null
+/usr/bin cd grep --verbose && && -eu printf awk echo "$@"
+		"$@" && grep grep done cd then then then 'quoted text'
+sed "$@" /usr/bin -eu "$@" "$@" then awk readonly /usr/bin --verbose
+&& --verbose sed && export
+	then test 'quoted text'
+		test export ${HOME} ${HOME} "$@" then "$@" printf
+/usr/bin printf --verbose
+		then done ${HOME} --verbose
+		printf && /usr/bin then "$@" $(pwd) ${HOME}
+printf local export test grep
+	x=1 /usr/bin "$@" && x=1 --verbose awk then sed /usr/bin cd
+		export cd local $(pwd) 2>/dev/null
+	${HOME} test echo ${HOME}
+"$@" | echo export test && /usr/bin
+--verbose $(pwd) done done 'quoted text' then sed readonly printf done
+	x=1 && readonly --verbose x=1 /usr/bin
+	$(pwd) sed echo done export printf x=1 'quoted text'
+		/usr/bin printf | test done then "$1" awk done done export
+	then test /usr/bin done && local | -eu "$@" "$1" 2>/dev/null
+		--verbose /usr/bin then export 'quoted text' && awk "$1" $(pwd) -eu |
+done "$1" export grep export local "$@" 2>/dev/null
+	$(pwd) | && $(pwd) then 'quoted text'
+	readonly && "$@" && export
+&& -eu 'quoted text' sed local then
+	-eu && 'quoted text' then -eu echo --verbose test printf
+"$@" 2>/dev/null then && readonly | done &&
+		sed /usr/bin "$1" cd ${HOME} local awk cd grep awk local test -eu then printf local
+		/usr/bin sed && x=1 local 'quoted text'
+		awk echo echo | local cd local done cd awk
+done readonly --verbose && && --verbose awk x=1 $(pwd) test --verbose --verbose
+$(pwd) $(pwd) /usr/bin readonly sed --verbose test && $(pwd) sed grep
+	printf sed cd --verbose && --verbose | awk --verbose then -eu x=1
+	"$@" ${HOME} export awk test
+echo --verbose then readonly $(pwd) 2>/dev/null export -eu && sed "$@"
+	then test local awk readonly grep
+'quoted text' awk cd printf
+	"$1" 'quoted text' x=1
+	2>/dev/null x=1 done && cd -eu
+	"$1" then export x=1 "$@" --verbose 'quoted text'
+"$@" export "$@" then sed grep 2>/dev/null
+		2>/dev/null test echo x=1 x=1 --verbose
+		done local x=1 readonly echo cd ${HOME} -eu $(pwd) then readonly then && done
+echo 2>/dev/null grep 2>/dev/null && x=1 test 2>/dev/null "$1" done "$@" && -eu
+"$1" awk sed $(pwd) printf
+		&& echo awk "$@" test then 'quoted text' readonly echo 2>/dev/null && x=1 &&
+	"$@" | "$1" grep "$1" ${HOME} | grep --verbose test /usr/bin
+		cd ${HOME} export x=1 -eu | "$@" | 'quoted text' then /usr/bin echo done
+		x=1 | grep export $(pwd) --verbose "$@" ${HOME} local 'quoted text' -eu cd export
+		echo sed ${HOME} ${HOME}
+		/usr/bin then | && 2>/dev/null -eu && local readonly
+		2>/dev/null 'quoted text' && && /usr/bin
+		grep sed /usr/bin then 2>/dev/null --verbose sed
+		${HOME} x=1 cd 2>/dev/null done cd "$1" export && | sed x=1 /usr/bin
+		--verbose then printf 2>/dev/null /usr/bin "$1" echo sed | -eu echo printf awk
+		/usr/bin ${HOME} --verbose 2>/dev/null ${HOME} export sed grep readonly sed
+	2>/dev/null && -eu cd grep /usr/bin cd /usr/bin
+x=1 /usr/bin && done readonly x=1 "$1" && test && grep printf
+test export then 'quoted text' x=1 x=1 'quoted text' local test readonly test
+| -eu done export $(pwd) 2>/dev/null "$1" test then local
+		test local "$@" test && then && $(pwd) "$1" done local done x=1 "$1" printf local
+	x=1 && x=1 local $(pwd) && echo 2>/dev/null /usr/bin -eu ${HOME} | -eu 2>/dev/null
+		export 'quoted text' | sed cd $(pwd) 'quoted text' $(pwd) cd
+	$(pwd) export done /usr/bin "$1" "$1" test
+	test x=1 test x=1 'quoted text' cd | test test --verbose 'quoted text'
+	/usr/bin "$@" printf then local -eu awk done export
+"$1" export awk then sed grep local $(pwd) then readonly printf $(pwd)
+	echo echo done -eu ${HOME}
+	| /usr/bin awk readonly sed "$1"
+"$@" $(pwd) -eu && test "$1" 2>/dev/null cd then $(pwd) $(pwd) 'quoted text'
+	printf "$@" test /usr/bin awk then export cd && printf grep sed echo -eu awk
+		x=1 2>/dev/null $(pwd) awk
+cd 'quoted text' | "$@" printf -eu echo readonly test local cd --verbose
+| "$@" -eu local done 2>/dev/null $(pwd) echo "$@" "$1"
+${HOME} "$@" readonly "$@" then local sed done --verbose export "$@"
+	printf printf 'quoted text' && /usr/bin | $(pwd) then | sed echo
+${HOME} "$1" 'quoted text' readonly
+export echo done echo local readonly done
+	x=1 sed grep test echo
+	2>/dev/null x=1 x=1 printf x=1
+	/usr/bin 2>/dev/null
+		x=1 | | done echo x=1 'quoted text' --verbose $(pwd) 'quoted text' printf sed
+		-eu then && echo done sed "$1" sed 'quoted text' 2>/dev/null | cd $(pwd) cd | readonly
+grep grep 'quoted text' export
+		"$@" sed x=1 echo then "$1" done "$@" "$1" "$1" "$@" readonly
+	-eu && 2>/dev/null grep x=1 "$1" export grep
+		2>/dev/null | 'quoted text' --verbose done 2>/dev/null -eu --verbose | local
+		&& 'quoted text' grep local $(pwd) | $(pwd) echo
+"$1" x=1 local sed awk ${HOME} ${HOME} readonly printf 2>/dev/null -eu ${HOME}
+		printf -eu "$@" x=1 local then local readonly && --verbose echo echo echo
+		cd 'quoted text' printf local
+printf "$1" ${HOME} readonly test 2>/dev/null
+| sed $(pwd) cd | done sed printf "$@" sed
+	printf ${HOME} readonly x=1 cd /usr/bin --verbose printf 2>/dev/null 2>/dev/null
+--verbose ${HOME} printf x=1 test "$@" ${HOME}
+awk | grep then done -eu $(pwd) $(pwd) $(pwd) $(pwd)
+awk "$1" awk export test export test "$1" awk
+echo --verbose test -eu printf sed -eu local done sed local $(pwd) readonly 2>/dev/null
+then "$@" grep 2>/dev/null sed "$@" 2>/dev/null printf x=1 x=1 awk cd --verbose
+	awk sed printf /usr/bin readonly
+		&& $(pwd) awk "$@" export readonly --verbose then -eu readonly -eu
+grep && sed readonly "$@" printf readonly then
+"$@" test export x=1 readonly local && $(pwd) sed cd export
+		'quoted text' printf "$@" $(pwd) done | local done && then "$1" /usr/bin
+	sed x=1 -eu test awk 2>/dev/null | 'quoted text' 'quoted text' sed
+awk then awk awk sed 2>/dev/null | $(pwd) sed -eu echo && sed 'quoted text'
+/usr/bin readonly ${HOME} x=1 grep
+	'quoted text' grep done done grep test "$@" done awk local
+	&& -eu export echo /usr/bin then cd test -eu grep
+	$(pwd) "$1" 2>/dev/null readonly
+	$(pwd) ${HOME} 'quoted text' done readonly then
+		readonly awk | echo | printf 'quoted text' test $(pwd) 'quoted text'
+		$(pwd) --verbose ${HOME} test "$1" test readonly then
+		&& done done grep -eu local export "$@" "$@" sed "$@" readonly 2>/dev/null done
+	awk | printf sed -eu done && 2>/dev/null sed --verbose grep --verbose && ${HOME}
+#include c203.sh
+	| test | x=1 then readonly --verbose local grep && export "$1" awk
+"$@" 2>/dev/null cd x=1 readonly -eu sed grep $(pwd) "$@" ${HOME}
+	sed --verbose --verbose | done test
+		$(pwd) awk "$1" local "$1" ${HOME} 'quoted text'
+		then x=1 local export 2>/dev/null
+		sed test "$1" export -eu awk -eu then "$1"
+	readonly && /usr/bin echo --verbose printf
+printf ${HOME} then | && export local "$@" done | "$1"
+		local "$@" then awk readonly -eu && sed grep awk "$1"
+	x=1 x=1 | 'quoted text' export /usr/bin readonly
+	| local $(pwd) "$@" 2>/dev/null && printf
+		/usr/bin local "$1" /usr/bin 'quoted text'
+	x=1 -eu | x=1 done echo | grep
+${HOME} /usr/bin ${HOME} "$@" ${HOME} "$@" && x=1 test done test
+&& | test done --verbose grep awk test
+	$(pwd) cd 2>/dev/null 'quoted text' readonly ${HOME} done local 2>/dev/null
+"$@" awk grep readonly "$1" readonly cd readonly
+&& /usr/bin ${HOME} then printf | grep 2>/dev/null /usr/bin awk 'quoted text'
+	/usr/bin && "$1" $(pwd) readonly
+	then sed && 'quoted text'
+sed cd sed awk cd && test
+		local done echo local printf export ${HOME} 2>/dev/null
+	x=1 printf $(pwd) "$@" /usr/bin test -eu && && echo |
+	$(pwd) 2>/dev/null then x=1 then
+	local /usr/bin /usr/bin sed then /usr/bin "$1" 2>/dev/null | && sed &&
+| "$@" ${HOME} sed x=1 x=1 cd ${HOME}
+	| -eu awk echo local /usr/bin x=1 && 'quoted text' grep -eu ${HOME}
+done | done test | local $(pwd) && && done $(pwd) local $(pwd) "$1" 'quoted text'
+		readonly x=1 export --verbose cd -eu x=1 /usr/bin | readonly
+	x=1 readonly "$1" test x=1 'quoted text' | echo done
+	printf awk x=1 ${HOME} export | printf export echo && 'quoted text'
+	sed sed && | local then /usr/bin "$@" --verbose echo sed 2>/dev/null local
+&& done sed export 'quoted text' && printf /usr/bin $(pwd) printf
+	sed $(pwd) done sed | --verbose test readonly grep
+		2>/dev/null --verbose && done
+-eu 2>/dev/null readonly ${HOME} ${HOME} awk done then 2>/dev/null
+&& $(pwd) printf test readonly "$1" x=1 --verbose awk "$1" local sed
+awk ${HOME} 2>/dev/null done 2>/dev/null -eu
+		${HOME} ${HOME} | printf readonly $(pwd) /usr/bin ${HOME} cd export cd
+		${HOME} 2>/dev/null "$1" /usr/bin readonly awk cd "$@" /usr/bin x=1
+	| local "$@" -eu sed "$1" --verbose 2>/dev/null local "$@" --verbose sed local
+	awk "$@" readonly echo done 'quoted text' test done | ${HOME}
+		export && readonly $(pwd) sed
+printf 'quoted text' 'quoted text'
+	printf 2>/dev/null export test /usr/bin readonly x=1
+		cd then local $(pwd) $(pwd) -eu printf | $(pwd) readonly grep ${HOME} x=1
+		cd -eu && x=1 && then readonly then sed sed printf "$1" $(pwd)
+		'quoted text' echo ${HOME} readonly
+done ${HOME} 2>/dev/null /usr/bin then
+| printf 'quoted text' 'quoted text' readonly cd grep grep x=1 local done x=1
+	export cd readonly | readonly /usr/bin
+		awk $(pwd) $(pwd) echo done "$@" $(pwd) readonly x=1 sed 'quoted text'
+awk done /usr/bin then 2>/dev/null "$1"
+then local "$@" echo -eu
+		2>/dev/null $(pwd) 'quoted text' export printf awk export --verbose local
+		x=1 sed readonly ${HOME} cd printf echo $(pwd) $(pwd) ${HOME} echo
+export sed test 2>/dev/null grep --verbose grep "$1" 2>/dev/null ${HOME}
+		$(pwd) done "$@" $(pwd) -eu 2>/dev/null awk -eu 'quoted text'
+		sed $(pwd) $(pwd) 'quoted text' /usr/bin
+		grep -eu echo 2>/dev/null then -eu ${HOME} awk cd readonly
+	local $(pwd) && awk --verbose cd test grep grep --verbose done
+local grep echo --verbose readonly printf "$1" echo
+		grep then done grep 'quoted text' ${HOME} awk sed printf x=1
+		${HOME} sed && sed sed x=1 "$1" sed done --verbose | | 2>/dev/null done $(pwd) "$1"
+done --verbose --verbose ${HOME} awk local local --verbose
+readonly test grep "$@" printf echo /usr/bin test readonly 'quoted text'
+local && printf x=1 2>/dev/null done test awk | 'quoted text'
+	readonly cd grep --verbose cd echo sed done "$@"
+printf export "$1" "$@" cd "$@" awk export && readonly "$@" ${HOME}
+	then awk -eu | awk export --verbose
+	test 'quoted text' && printf cd --verbose --verbose
+2>/dev/null export x=1 ${HOME} grep && && | $(pwd)
+"$@" --verbose test export printf "$@" | echo
+		| then | cd ${HOME} 'quoted text' x=1 && "$@" && printf local test readonly
+		printf 'quoted text' -eu ${HOME} done && local
+x=1 "$@" 2>/dev/null 'quoted text'
+	local local awk readonly ${HOME} sed grep readonly done echo 'quoted text' 'quoted text'
+/usr/bin export sed cd grep grep | local "$@" local
+readonly awk --verbose $(pwd) "$1"
+&& -eu $(pwd) --verbose /usr/bin
+local done ${HOME} 2>/dev/null
+		-eu 2>/dev/null done sed "$1"
+grep --verbose test local $(pwd) printf awk test readonly
+export cd 'quoted text' 2>/dev/null grep grep readonly -eu | cd /usr/bin
+		readonly local export test $(pwd) sed 2>/dev/null cd "$1"
+printf readonly ${HOME} then
+export grep echo sed 2>/dev/null ${HOME} test $(pwd) done export ${HOME} /usr/bin
+		$(pwd) cd | printf $(pwd)
+		printf printf 2>/dev/null
+"$1" "$@" 'quoted text' grep sed sed $(pwd) | awk | grep then
+'quoted text' /usr/bin done 2>/dev/null local awk x=1 echo
+		local "$1" readonly /usr/bin sed $(pwd) 2>/dev/null
+	&& awk awk "$1" printf printf test then "$1" awk awk
+		$(pwd) sed $(pwd) $(pwd) export $(pwd) done && "$@" | echo | $(pwd) test then readonly
+printf test export local ${HOME} ${HOME} --verbose
+		local $(pwd) grep awk test local then 2>/dev/null "$@" printf | local
+printf 'quoted text' local
+| cd done readonly ${HOME}
+	2>/dev/null $(pwd) echo echo cd x=1
+		echo 'quoted text' ${HOME} then test printf
+x=1 && echo local export "$1" "$@" --verbose done sed then -eu awk "$@" --verbose
+'quoted text' | "$1" grep 2>/dev/null
+	x=1 grep local | x=1 printf readonly readonly awk 2>/dev/null x=1 local ${HOME}
+	-eu 'quoted text' $(pwd) cd then local --verbose echo
+-eu "$@" "$1" readonly test test test sed 2>/dev/null $(pwd) 'quoted text'
+$(pwd) cd x=1 sed printf | readonly --verbose ${HOME} test done --verbose
+$(pwd) local echo "$@" --verbose cd test x=1 $(pwd)
+printf $(pwd) ${HOME} | awk sed /usr/bin sed done /usr/bin --verbose then echo
+		then printf && --verbose cd printf "$1" export cd test done printf 'quoted text'
+	readonly -eu --verbose
+--verbose "$1" "$@" /usr/bin awk x=1 2>/dev/null
+	sed echo | export local -eu done
+grep awk export done printf --verbose
+then /usr/bin && | awk && ${HOME}
+		&& then grep printf grep export "$1" "$1"
+		"$1" awk x=1 test /usr/bin test printf && test ${HOME} "$1" ${HOME} awk
+		echo --verbose echo cd | then 2>/dev/null done awk /usr/bin
+		then done awk local export /usr/bin "$1" -eu --verbose then local
+$(pwd) 2>/dev/null "$1" test cd && --verbose && then 2>/dev/null /usr/bin
+	export printf && | ${HOME} then "$@" -eu done sed "$1" -eu -eu /usr/bin
+		-eu readonly | "$1" && done export x=1 printf
+		grep --verbose sed -eu echo cd sed
+		readonly && sed && echo printf cd export /usr/bin && $(pwd)
+then echo --verbose x=1 2>/dev/null printf $(pwd) then
+		$(pwd) && ${HOME} awk | readonly test export done test -eu 2>/dev/null then 'quoted text'
+echo --verbose test awk
+grep done local readonly && then printf grep ${HOME} $(pwd) $(pwd)
+		--verbose printf echo | done 'quoted text'
+export test grep && echo done printf
+${HOME} 2>/dev/null sed test sed test echo printf 'quoted text' x=1 --verbose
+then grep awk /usr/bin x=1 echo awk && 'quoted text' | done --verbose
+"$1" $(pwd) ${HOME} sed "$1" cd "$1" then awk
+	echo /usr/bin readonly echo ${HOME}
+sed /usr/bin echo "$1" done 'quoted text' then
+	grep "$@" ${HOME} awk cd local export ${HOME} local ${HOME}
+		/usr/bin ${HOME} grep $(pwd)
+		-eu "$1" $(pwd) readonly | sed x=1
+		"$@" 2>/dev/null then -eu | printf sed local readonly readonly test | awk /usr/bin
+readonly sed readonly awk sed grep --verbose cd $(pwd) -eu
+--verbose test echo echo local
+		done "$@" -eu --verbose $(pwd) "$1" done --verbose
+		-eu echo export "$@" | 'quoted text' x=1 /usr/bin then --verbose
+	readonly && && $(pwd) sed cd awk $(pwd) sed "$@" | ${HOME} 'quoted text'
+	-eu "$1" "$@" ${HOME} grep done | then echo | $(pwd) local test local grep done
+	test printf --verbose "$1" "$1" "$@" && --verbose awk awk cd grep && /usr/bin grep
+		echo | ${HOME} $(pwd) "$1" ${HOME} 'quoted text' |
+cd printf cd readonly local echo cd -eu $(pwd) grep ${HOME}
+export test "$1" printf sed grep export test 'quoted text' 2>/dev/null
+		readonly printf cd | --verbose export grep printf -eu /usr/bin 'quoted text'
+		--verbose sed ${HOME} x=1 local "$@" x=1 test printf sed --verbose grep $(pwd)
+${HOME} done export 2>/dev/null /usr/bin x=1 2>/dev/null then awk then
+		readonly then sed ${HOME} 2>/dev/null then cd | "$@" echo $(pwd) local
+	readonly then -eu x=1 2>/dev/null && echo awk ${HOME} "$1" readonly
+sed local x=1 local export sed export
+done 2>/dev/null echo ${HOME} then then
+	"$1" awk done -eu local cd | | then awk -eu x=1 test "$@" $(pwd)
+printf -eu echo cd readonly export
+	| ${HOME} && grep -eu export cd local -eu
+		local "$1" echo x=1 then export readonly ${HOME} "$@"
+		--verbose cd -eu then export |
+	test 'quoted text' done grep "$1" $(pwd) "$@" && sed readonly -eu && 'quoted text'
+		2>/dev/null 'quoted text' ${HOME} "$@" readonly x=1 awk echo
+		sed $(pwd) 'quoted text' -eu sed --verbose
+	| export readonly "$1" echo 'quoted text'
+		done x=1 2>/dev/null export readonly
+awk && sed grep /usr/bin && printf cd ${HOME} && done awk 'quoted text'
+		local && "$1" $(pwd) ${HOME} cd sed awk echo "$@" echo local 2>/dev/null
+done ${HOME} ${HOME} test cd test
+x=1 cd -eu sed sed 'quoted text' ${HOME} /usr/bin grep sed cd
+	--verbose cd test -eu readonly
+		cd sed "$1" local ${HOME} --verbose
+sed "$@" | readonly ${HOME} "$@"
+		"$1" local ${HOME} then export | local echo local done local
+$(pwd) /usr/bin && done x=1 echo test awk done ${HOME} "$1" printf test awk echo
+	$(pwd) readonly local then --verbose
+		'quoted text' | ${HOME} local 2>/dev/null
+	echo then "$@" test readonly 2>/dev/null /usr/bin 2>/dev/null
+		| "$1" 'quoted text' test cd
+	2>/dev/null readonly && /usr/bin then then 2>/dev/null cd sed
+		"$@" local echo ${HOME} ${HOME} 'quoted text' "$1" ${HOME}
+		&& done sed printf then --verbose sed 2>/dev/null done 'quoted text' && test
+	grep -eu -eu 'quoted text' /usr/bin local | "$1" sed 'quoted text'
+"$@" done printf $(pwd) then
+		readonly local && local local awk test printf
+		printf sed awk test printf "$@" --verbose sed local sed -eu grep x=1 awk cd
+		&& --verbose 'quoted text' --verbose ${HOME} "$@"
+		| sed -eu $(pwd) printf done awk printf
+local "$@" /usr/bin | test awk printf && | test -eu local 2>/dev/null 'quoted text'
+		-eu "$@" x=1 x=1 sed
+	local printf readonly export echo x=1 test "$@" grep "$1" "$@" cd ${HOME}
+		x=1 x=1 echo && 2>/dev/null 2>/dev/null
+	$(pwd) export /usr/bin export test x=1 test
+2>/dev/null -eu readonly /usr/bin /usr/bin printf export export readonly -eu
+		sed test "$1" cd cd grep "$1" printf sed --verbose grep ${HOME} x=1 awk sed grep
+	"$@" && --verbose /usr/bin
+	/usr/bin -eu "$1" readonly /usr/bin /usr/bin echo grep ${HOME} grep then sed
+--verbose local "$@" echo printf
+		/usr/bin grep test ${HOME} export sed awk && x=1 "$@" | cd
+'quoted text' ${HOME} "$1" "$1" then readonly $(pwd) done then x=1 ${HOME} "$@"
+echo export && export printf x=1 grep done && "$@" --verbose
+-eu && /usr/bin cd export -eu echo /usr/bin -eu --verbose
+	grep 'quoted text' $(pwd) $(pwd) then test
+awk --verbose cd readonly test 'quoted text' local -eu echo "$1" grep awk
+		printf "$1" printf sed echo readonly grep test export "$@"
+	x=1 ${HOME} grep --verbose
+	local test test && test printf awk --verbose export awk awk grep --verbose sed
+	--verbose $(pwd) printf done export 2>/dev/null -eu printf $(pwd)
+		| /usr/bin grep ${HOME} cd "$1" sed test local done echo /usr/bin -eu grep --verbose
+/usr/bin $(pwd) export echo $(pwd) awk && --verbose sed readonly readonly
+echo then local sed sed done readonly
+		x=1 then sed readonly done
+		x=1 echo "$@" /usr/bin 'quoted text'
+	export && "$1" grep && "$1" export awk readonly then readonly printf cd then
+grep 'quoted text' then test ${HOME} then --verbose awk x=1 x=1 'quoted text'
+awk sed x=1 "$@" ${HOME}
+		echo export readonly sed $(pwd) cd printf readonly /usr/bin x=1 | /usr/bin printf
+		local readonly echo $(pwd) grep awk $(pwd) export
+printf then then then --verbose /usr/bin
+| grep readonly /usr/bin
+	cd | export 'quoted text' test grep -eu cd "$@" test
+grep cd x=1 then readonly 2>/dev/null local /usr/bin "$@"
+	local $(pwd) /usr/bin printf grep done then -eu echo -eu
+		-eu sed --verbose export 'quoted text' awk local then ${HOME}
+then printf "$1" "$1" && local
+		-eu && grep --verbose echo echo local ${HOME} printf && cd test
+cd echo x=1 awk export echo 'quoted text' then 'quoted text' awk local printf
+local x=1 ${HOME} /usr/bin done -eu done
+	"$1" sed echo printf && sed awk | /usr/bin | test && &&
+"$@" grep 'quoted text' then awk "$1" 2>/dev/null
+	$(pwd) x=1 --verbose | test cd readonly /usr/bin test awk
+		export $(pwd) sed --verbose
+sed "$@" x=1 printf done awk /usr/bin /usr/bin readonly 2>/dev/null awk
+	2>/dev/null --verbose "$@" /usr/bin test --verbose cd x=1 "$1" 'quoted text'
+	sed done local printf awk ${HOME} $(pwd) done $(pwd) export sed $(pwd)
+		${HOME} --verbose echo awk ${HOME} x=1 /usr/bin "$@" "$1"
+	'quoted text' readonly local 2>/dev/null cd
+		echo printf local x=1 "$1" printf echo cd
+sed ${HOME} readonly done --verbose $(pwd) test awk "$1" | &&
+${HOME} 'quoted text' readonly
+export export then $(pwd) grep done /usr/bin echo /usr/bin $(pwd) cd
+	echo grep /usr/bin local printf local grep printf ${HOME}
+	sed "$1" grep 2>/dev/null done test grep --verbose 2>/dev/null x=1 cd grep
+		then "$1" "$@" printf test
+| readonly done printf echo
+	readonly "$1" cd local awk ${HOME} echo done $(pwd) x=1
+	"$@" $(pwd) done /usr/bin ${HOME} then --verbose
+	x=1 printf -eu export done printf
+		cd then $(pwd) --verbose /usr/bin
+	then local sed x=1 echo done
+	printf 2>/dev/null ${HOME} done echo
+		printf /usr/bin local echo export cd local
+"$@" "$@" /usr/bin /usr/bin grep -eu printf awk &&
+	'quoted text' readonly cd -eu echo --verbose
+		then local printf done test sed 2>/dev/null 2>/dev/null ${HOME}
+		cd cd "$1" grep local x=1 done
+	export grep 2>/dev/null local /usr/bin grep
+		grep --verbose x=1 -eu sed printf "$1" "$@" export | -eu
+	readonly grep then 'quoted text' -eu
+		then grep "$@" echo 'quoted text'
+"$@" --verbose "$1" grep $(pwd) local local 2>/dev/null readonly grep sed sed
+	then -eu then "$1" done export
+	local done x=1 awk "$@" x=1 'quoted text' --verbose echo 2>/dev/null
+		awk local echo -eu grep export x=1
+	grep export awk 'quoted text' --verbose
+	cd 'quoted text' "$@" x=1 echo local cd "$@" 2>/dev/null awk $(pwd)
+	awk printf "$@" "$1" local echo -eu $(pwd) sed sed awk
+| awk | /usr/bin x=1 local && | sed cd "$1" 2>/dev/null grep cd && 'quoted text'
+		awk $(pwd) then ${HOME} ${HOME} grep "$@" export local local
+local printf done -eu && test cd "$@" "$@" -eu ${HOME} "$@"
+		echo echo 2>/dev/null echo -eu "$1" -eu -eu test
+	x=1 done --verbose 2>/dev/null echo x=1 x=1 && done test local 'quoted text' then
+	then test sed ${HOME} -eu cd x=1 sed export | /usr/bin cd /usr/bin
+'quoted text' && /usr/bin printf $(pwd) &&
+		${HOME} && /usr/bin done grep awk readonly "$@" awk /usr/bin "$1" | cd then
+		local echo printf -eu printf x=1 cd echo export local
+		"$@" /usr/bin x=1 awk awk done
+"$1" sed --verbose test 2>/dev/null awk $(pwd) 2>/dev/null sed printf
+		cd "$1" 2>/dev/null grep
+		'quoted text' cd export 'quoted text' $(pwd) --verbose test "$@"
+	echo 'quoted text' done 2>/dev/null
+'quoted text' readonly &&
+		export "$1" echo local echo test /usr/bin 2>/dev/null grep cd -eu $(pwd) readonly
+	done $(pwd) export printf readonly readonly 2>/dev/null sed then x=1 "$@" printf
+		sed 2>/dev/null -eu x=1 done | /usr/bin
+		$(pwd) -eu printf then awk ${HOME} /usr/bin x=1 --verbose --verbose
+| sed 'quoted text' /usr/bin readonly -eu -eu $(pwd) x=1 "$@" ${HOME} echo
+/usr/bin grep then | "$@" printf "$@" x=1 printf $(pwd) then | "$1" "$@" local --verbose
+	test x=1 grep local grep then /usr/bin x=1 2>/dev/null grep export
+		$(pwd) -eu --verbose /usr/bin ${HOME} "$1" --verbose "$1" export ${HOME}
+	local local echo awk "$1"
+	grep readonly test $(pwd) cd done awk | export
+local done local printf "$@" "$@" "$@" && x=1
+		${HOME} /usr/bin ${HOME} test 'quoted text' printf
+		'quoted text' test readonly done 2>/dev/null 2>/dev/null
+local --verbose export printf -eu echo done --verbose
+		awk "$@" ${HOME} "$@" --verbose printf 2>/dev/null "$1" | --verbose
+	printf cd 'quoted text' echo ${HOME} then local grep
+	$(pwd) ${HOME} -eu 'quoted text' "$@" -eu "$@"
+		'quoted text' done "$@" $(pwd) --verbose local
+		'quoted text' echo readonly
+	"$@" test /usr/bin x=1 grep grep && /usr/bin readonly
+&& readonly $(pwd) "$@" printf sed $(pwd)
+"$@" -eu "$@" "$1" ${HOME}
+${HOME} "$@" x=1 "$@" printf printf awk awk "$1"
+readonly done done sed x=1 local $(pwd)
+		sed readonly | 2>/dev/null ${HOME} "$1" && x=1
+		done cd $(pwd) "$@" | x=1 | x=1 export | /usr/bin x=1 printf ${HOME} -eu 2>/dev/null
+| sed /usr/bin /usr/bin test export 2>/dev/null x=1 cd readonly
+	'quoted text' local $(pwd)
+	test echo "$1" ${HOME} local local "$@" cd test
+		echo | grep "$@" done x=1 'quoted text' /usr/bin cd -eu ${HOME} x=1 grep
+'quoted text' awk done
+		readonly x=1 then && readonly done $(pwd) then local then /usr/bin
+2>/dev/null && $(pwd) sed cd done
+		readonly "$@" awk export test local then 'quoted text' sed export $(pwd)
+		2>/dev/null sed readonly ${HOME} ${HOME} -eu
+	awk | export readonly printf awk -eu
+	x=1 printf "$1" $(pwd) --verbose
+cd -eu printf grep awk test /usr/bin done ${HOME} printf && $(pwd) grep 'quoted text'
+		readonly $(pwd) | | sed printf export 2>/dev/null
+	/usr/bin --verbose test printf 'quoted text' $(pwd) x=1 printf echo /usr/bin
+	echo test awk cd $(pwd) then test echo test 'quoted text'
+	export -eu then done x=1 echo echo
+done ${HOME} echo --verbose --verbose sed
+		--verbose 'quoted text' "$1"
+/usr/bin grep | ${HOME} cd printf "$1" --verbose
+${HOME} readonly readonly 2>/dev/null
+${HOME} 2>/dev/null --verbose "$1" export awk "$@" ${HOME} awk && awk
+		awk done readonly done sed
+"$@" printf && -eu then "$1" $(pwd)
+awk -eu x=1 readonly 'quoted text' "$@" --verbose local 2>/dev/null -eu 'quoted text'
+		printf local $(pwd) awk /usr/bin then $(pwd)
+	"$@" echo | awk x=1 then $(pwd) --verbose --verbose
+		local | export -eu "$1" | | awk readonly "$1"
+	| "$1" sed -eu -eu export 2>/dev/null
+	| "$@" $(pwd) $(pwd) printf echo test && $(pwd) echo echo ${HOME} then "$@"
+		printf then grep ${HOME} awk x=1 | printf done -eu export sed local awk
+-eu then test -eu 2>/dev/null /usr/bin $(pwd) printf readonly --verbose
+	2>/dev/null && sed cd && sed "$@" /usr/bin && sed done then printf $(pwd)
+${HOME} done && awk -eu cd --verbose ${HOME} local --verbose
+		"$@" "$@" test sed awk printf test --verbose
+		$(pwd) printf ${HOME} awk grep
+		2>/dev/null ${HOME} then echo sed --verbose readonly -eu
+	awk $(pwd) "$1" 2>/dev/null $(pwd)
+	'quoted text' "$@" -eu 2>/dev/null sed ${HOME} readonly printf "$1" x=1 readonly
+		${HOME} cd test local sed 2>/dev/null x=1 sed --verbose
+		awk --verbose echo grep ${HOME} ${HOME} && echo test ${HOME} printf $(pwd)
+		'quoted text' done sed --verbose && test ${HOME} "$@" "$@" /usr/bin export
+		"$@" && /usr/bin local local --verbose sed done
+	| export test echo ${HOME} | "$@" | /usr/bin done "$@" test x=1 then
+export /usr/bin && then "$1" done readonly x=1 "$1" test 2>/dev/null "$@" readonly
+awk test -eu /usr/bin test | grep test sed x=1 ${HOME}
+		echo export done test $(pwd)
+		&& printf "$1" 'quoted text' local && "$1" -eu
+	then "$1" test local grep x=1 test "$@" $(pwd) then | ${HOME} -eu cd x=1 then
+		sed export export && sed ${HOME} 'quoted text' | then | "$1" 2>/dev/null readonly
+sed "$@" && | $(pwd) 'quoted text'
+		'quoted text' awk "$1"
+x=1 test export /usr/bin --verbose /usr/bin 'quoted text' sed readonly --verbose
+$(pwd) then "$@" grep -eu ${HOME}
+| local $(pwd) printf 'quoted text'
+		done | local sed ${HOME}
+		-eu 'quoted text' x=1 then test
+	then then -eu -eu grep cd -eu x=1 done test "$1" && local | /usr/bin -eu &&
+x=1 -eu grep "$1" test "$@" export
+		test /usr/bin then "$@" done "$@" test awk test | grep
+	local then local -eu 2>/dev/null
+then && "$@" grep && "$1" $(pwd) test 'quoted text'
+	export sed 2>/dev/null local local done sed
+awk cd ${HOME} awk local /usr/bin
+	-eu local && then printf 'quoted text'
+	grep local 'quoted text' 'quoted text'
+	readonly cd sed ${HOME} --verbose x=1 export | "$1" cd
+		--verbose grep cd echo /usr/bin
+	${HOME} 2>/dev/null | x=1 -eu cd $(pwd) && sed "$@" 'quoted text' local
+printf printf "$@" x=1 done ${HOME} /usr/bin grep printf readonly ${HOME}
+		'quoted text' readonly grep "$@" export
+		/usr/bin awk then && && --verbose
+	grep readonly x=1 echo 2>/dev/null sed ${HOME} "$@"
+		test "$@" | 'quoted text' $(pwd) && -eu "$1" done
+readonly then 'quoted text' grep echo test
+		$(pwd) awk grep grep -eu test $(pwd) cd "$1" /usr/bin -eu --verbose $(pwd)
+'quoted text' "$@" printf awk "$1"
+	/usr/bin -eu printf awk 2>/dev/null
+	readonly sed "$@" awk | "$@" sed -eu grep 'quoted text' then
+		/usr/bin "$@" /usr/bin local ${HOME} 2>/dev/null
+2>/dev/null grep $(pwd) -eu ${HOME} 2>/dev/null
+	"$1" --verbose $(pwd) /usr/bin echo sed awk
+	readonly cd then x=1 test && cd $(pwd) -eu "$@" local | then
+test done done "$@" readonly -eu sed test 'quoted text'
+		&& test test x=1 2>/dev/null
+	/usr/bin done sed $(pwd) && $(pwd) --verbose
+${HOME} export $(pwd) readonly
+		then x=1 echo printf "$1"
+	local /usr/bin test x=1 "$1" sed 'quoted text' -eu awk test "$1"
+/usr/bin test x=1 test local awk /usr/bin readonly ${HOME} local "$1" cd --verbose
+	sed cd sed 2>/dev/null /usr/bin cd x=1 ${HOME}
+	&& $(pwd) echo grep local
+	"$@" export /usr/bin done ${HOME} && cd echo test sed /usr/bin
+"$@" /usr/bin printf sed ${HOME}
+	"$1" 2>/dev/null then "$1" export 2>/dev/null
+	cd && grep /usr/bin && ${HOME} && test local local export -eu sed /usr/bin export
+		x=1 test 'quoted text'
+	done printf --verbose echo "$@" $(pwd) $(pwd) "$@" -eu grep ${HOME} -eu
+		local awk /usr/bin local awk export readonly
+		readonly awk && "$@" /usr/bin readonly local 2>/dev/null
+	done then && sed "$1" "$1" then done done printf 'quoted text' "$@" sed "$@"
+		then export $(pwd) | | -eu "$1" | export then echo grep export
+"$@" readonly local | && 2>/dev/null /usr/bin x=1 printf awk
+		cd test | export done 2>/dev/null "$1" && "$1"
+		&& 2>/dev/null x=1 readonly test $(pwd)
+grep $(pwd) printf cd awk echo
+--verbose $(pwd) local test export echo test test cd | echo 2>/dev/null
+	test "$1" /usr/bin awk grep printf awk export then test $(pwd)
+		echo --verbose ${HOME} echo grep local -eu then 'quoted text' echo -eu /usr/bin
+		x=1 "$1" test then echo local cd grep "$1"
+		done cd cd $(pwd) | printf sed local ${HOME} | then grep
+	$(pwd) local --verbose 'quoted text' x=1
+		done awk grep x=1 'quoted text' && awk "$1" sed 'quoted text' readonly
+		readonly && printf 2>/dev/null --verbose
+		readonly grep then awk 2>/dev/null awk 2>/dev/null | ${HOME} awk "$@"
+		awk echo -eu echo sed export $(pwd)
+	-eu local awk | /usr/bin x=1 $(pwd) 'quoted text' "$@" test done
+		then cd sed x=1 then local awk /usr/bin sed sed
+		"$@" readonly x=1 sed test sed
+	$(pwd) /usr/bin printf 'quoted text' then test $(pwd)
+sed 2>/dev/null readonly
+	grep awk export x=1 -eu awk sed | then done printf printf 'quoted text' local x=1
+${HOME} done then export -eu 'quoted text' 2>/dev/null -eu $(pwd) --verbose
+x=1 $(pwd) test "$@" x=1 2>/dev/null /usr/bin
+awk sed awk sed /usr/bin readonly
+	x=1 echo sed test --verbose awk "$1" --verbose | sed export
+	printf $(pwd) 2>/dev/null -eu printf && -eu cd cd awk grep
+	test grep -eu | export echo export export ${HOME} | -eu
+		${HOME} --verbose /usr/bin /usr/bin x=1 && local "$@"
+	/usr/bin "$@" --verbose /usr/bin "$1" "$1" done --verbose &&
+| $(pwd) done 'quoted text' $(pwd) ${HOME}
+	"$1" 2>/dev/null readonly
+"$1" -eu x=1 readonly && readonly
+	test ${HOME} -eu then 2>/dev/null "$@"
+--verbose $(pwd) 2>/dev/null grep done && ${HOME} done readonly then
+local test --verbose ${HOME} grep && /usr/bin export
+		| x=1 2>/dev/null readonly --verbose awk
+		--verbose then ${HOME} $(pwd) "$@" awk "$1"
+		| printf awk sed --verbose export x=1 "$@" 'quoted text' test readonly --verbose
+	-eu ${HOME} /usr/bin local ${HOME} x=1 -eu /usr/bin x=1 && then awk readonly
+then 2>/dev/null | | printf
+		test ${HOME} && && | 'quoted text' $(pwd) x=1 ${HOME} grep awk x=1 x=1 | --verbose
+		local then test done "$1" $(pwd) ${HOME} | awk readonly "$@" /usr/bin
+		"$@" /usr/bin -eu ${HOME} printf printf local echo cd x=1 |
+$(pwd) | | sed ${HOME} local "$1"
+-eu sed $(pwd) readonly && test cd echo && $(pwd)
+	x=1 "$@" --verbose 2>/dev/null printf printf sed
+		done awk grep awk "$1" --verbose ${HOME} test
+'quoted text' test --verbose x=1 done x=1 readonly awk
+	export echo printf grep x=1 --verbose $(pwd) cd local test | local cd | printf
+		grep 2>/dev/null && $(pwd) "$1" then
+awk && -eu --verbose | /usr/bin
+	then grep -eu readonly "$1" test
+		awk /usr/bin cd grep 'quoted text' -eu --verbose echo 2>/dev/null $(pwd)
+done x=1 'quoted text' "$@" done export readonly ${HOME} local | x=1 then test
+		/usr/bin 'quoted text' sed && printf cd test $(pwd) awk test readonly
+printf then ${HOME} && done echo awk test readonly ${HOME} echo
+"$1" "$@" && ${HOME} cd
+done -eu grep grep sed "$@" | x=1 done /usr/bin export
+$(pwd) && && ${HOME} local --verbose
+		&& then 'quoted text' "$@" -eu -eu test --verbose local export sed local
+| 2>/dev/null --verbose test 'quoted text' 2>/dev/null sed && cd ${HOME} test grep
+	-eu sed && "$@" grep local 'quoted text' -eu grep | local echo grep then 'quoted text'
+readonly "$1" x=1 grep ${HOME} awk "$@" | readonly ${HOME}
+		printf /usr/bin echo cd ${HOME}
+	'quoted text' export $(pwd)
+		-eu ${HOME} readonly grep --verbose then local sed | "$@" 2>/dev/null echo
+$(pwd) cd sed test --verbose x=1 --verbose readonly then
+	echo 'quoted text' awk local 2>/dev/null printf echo ${HOME} printf test
+		test "$@" echo | sed readonly
+	| then echo cd "$1" /usr/bin grep readonly cd --verbose readonly ${HOME} -eu
+		sed $(pwd) ${HOME} awk done export 'quoted text'
+test --verbose grep export grep cd export local "$@"
+2>/dev/null awk local printf "$@" $(pwd) echo -eu | /usr/bin
+cd cd "$1" ${HOME} "$@" local printf ${HOME} && sed ${HOME}
+${HOME} 'quoted text' && grep readonly --verbose /usr/bin 'quoted text'
+		cd echo $(pwd) test readonly test awk
+cd 2>/dev/null -eu 'quoted text' printf echo grep
+		| done test "$1" echo then test done done "$1" "$@" $(pwd) done --verbose
+	readonly | --verbose -eu cd
+	echo && ${HOME} ${HOME} -eu awk test awk && test
+&& printf 2>/dev/null then -eu "$1" ${HOME} grep
+grep 'quoted text' /usr/bin "$@" --verbose 'quoted text' local "$@" printf awk
+x=1 2>/dev/null 2>/dev/null x=1 -eu x=1 local x=1
+local | readonly -eu cd $(pwd) "$@" done "$@" export local | 2>/dev/null /usr/bin
+then test sed grep "$@" readonly x=1 $(pwd) "$@" printf /usr/bin awk --verbose sed
+&& | cd "$1" cd readonly awk "$1" readonly && 2>/dev/null local done
+		'quoted text' awk "$1" ${HOME} test -eu "$1" awk awk export 2>/dev/null
+		done echo then ${HOME} "$1"
+cd export "$1" then readonly /usr/bin
+		echo grep printf sed then readonly export echo && test export
+		2>/dev/null ${HOME} --verbose $(pwd) sed done -eu
+awk local "$@" done export cd grep && 'quoted text' $(pwd) "$@"
+		local && x=1 $(pwd) "$1"
+2>/dev/null -eu /usr/bin --verbose done cd -eu ${HOME} done
+	cd export "$1" awk /usr/bin /usr/bin "$@" 'quoted text' printf export
+		sed local 'quoted text' then awk | && test "$1" awk
+	| printf test $(pwd) sed test ${HOME} $(pwd) x=1 cd then
+	"$@" $(pwd) grep local x=1 'quoted text' readonly local -eu grep "$@" | printf
+		awk cd ${HOME} "$1" /usr/bin
+	local cd echo $(pwd) sed && /usr/bin then --verbose /usr/bin
+	done ${HOME} printf ${HOME} readonly
+		awk $(pwd) 'quoted text' local echo ${HOME} "$@" --verbose x=1 printf -eu "$1"
+printf x=1 printf cd && echo grep local && --verbose | -eu $(pwd) printf readonly
+| echo sed --verbose cd "$1" --verbose 2>/dev/null
+$(pwd) ${HOME} $(pwd) echo "$1" sed | "$1" grep export /usr/bin
+done $(pwd) 'quoted text' cd printf grep
+	printf sed /usr/bin export
+&& done readonly readonly export test echo printf --verbose awk printf x=1 -eu
+	--verbose done 2>/dev/null echo awk 'quoted text' test --verbose then
+"$1" then ${HOME} -eu sed 'quoted text'
+&& "$@" awk echo | "$@" printf -eu done "$@" /usr/bin done
+	test x=1 export cd readonly 2>/dev/null
+		test 2>/dev/null grep test
+		done "$@" cd ${HOME} ${HOME} "$@" export
+		/usr/bin test 2>/dev/null readonly export grep cd --verbose $(pwd) printf "$1"
+		test "$1" $(pwd) | "$@" ${HOME} -eu printf ${HOME} sed done x=1
+/usr/bin /usr/bin && sed grep local "$1" sed "$1" x=1 echo done cd
+	done | | test cd -eu "$1" local test done 2>/dev/null done "$1"
+		${HOME} 2>/dev/null test echo -eu readonly ${HOME} echo local "$1" --verbose
+	grep -eu awk ${HOME} $(pwd) readonly test then local "$1"
+		awk export echo 'quoted text' 2>/dev/null
+		&& 2>/dev/null sed readonly $(pwd) sed "$@"
+	${HOME} sed printf "$@"
+		'quoted text' ${HOME} sed awk /usr/bin "$1" done x=1 'quoted text'
+		awk 2>/dev/null $(pwd) "$@" "$@" | -eu
+	printf /usr/bin grep test && done sed && cd test
+then "$1" export $(pwd) && test
+		cd export && done "$@" --verbose cd cd "$1"
+local local x=1 x=1 /usr/bin grep 'quoted text' x=1 then cd | 'quoted text'
+x=1 "$@" sed echo cd ${HOME} 'quoted text'
+		then cd sed readonly printf
+	| x=1 test /usr/bin "$@"
+	"$1" "$1" readonly $(pwd) --verbose printf 'quoted text' cd cd ${HOME}
+	/usr/bin cd printf export test export ${HOME} test grep x=1 awk readonly
+		'quoted text' $(pwd) local ${HOME}
+		| $(pwd) && readonly "$@" printf readonly local
+		| grep /usr/bin readonly /usr/bin
+		"$@" "$1" cd x=1 2>/dev/null -eu "$1" done done local
+	'quoted text' && test 'quoted text'
+readonly printf /usr/bin echo done "$@" $(pwd) awk && 'quoted text'
+	export export && | -eu x=1 && printf /usr/bin /usr/bin
+then 2>/dev/null export -eu | | local grep | ${HOME}
+	-eu echo then cd readonly cd --verbose "$1" | $(pwd)
+		printf sed echo "$1" 2>/dev/null printf grep 2>/dev/null
+printf 'quoted text' test then then -eu && grep "$@" done
+	sed x=1 then --verbose done sed awk x=1 local export ${HOME} $(pwd)
+	cd local && /usr/bin --verbose "$@" test
+	x=1 | 'quoted text' export local --verbose grep $(pwd) --verbose then local
+		test readonly then awk $(pwd) 'quoted text' "$@" "$@" 2>/dev/null
+		awk "$1" ${HOME} 2>/dev/null "$@" export printf then && -eu printf awk
+	x=1 then echo | $(pwd) echo --verbose
+	2>/dev/null && -eu ${HOME} x=1 sed test | local /usr/bin
+echo echo test printf 'quoted text' cd sed
+	2>/dev/null cd /usr/bin ${HOME} 'quoted text' done done local grep done ${HOME}
+local export cd | $(pwd) x=1 readonly --verbose then ${HOME}
+readonly printf --verbose "$@" echo "$1" "$@" grep
+		'quoted text' local $(pwd) --verbose cd x=1 readonly done cd 2>/dev/null
+printf grep local readonly 2>/dev/null
+--verbose /usr/bin --verbose 2>/dev/null grep
+&& sed --verbose $(pwd) | done
+'quoted text' ${HOME} --verbose /usr/bin grep printf ${HOME} --verbose
+-eu awk then 2>/dev/null
+		-eu grep done x=1 awk done export cd | -eu 'quoted text'
+		2>/dev/null cd echo $(pwd) test --verbose | test /usr/bin | test
+	printf 2>/dev/null "$@" $(pwd)
+		"$@" -eu awk x=1 grep | 'quoted text' done | sed echo awk "$1" | $(pwd) then
+		grep export then --verbose awk "$1" grep readonly -eu test $(pwd)
+--verbose local readonly "$1" printf
+		test readonly echo grep
+	test -eu readonly --verbose && | -eu
+	| | -eu readonly cd x=1 && "$1" local /usr/bin export grep | x=1
+		printf sed --verbose -eu export /usr/bin then x=1 local
+sed test grep /usr/bin 2>/dev/null
+local -eu $(pwd) x=1 /usr/bin test x=1 readonly grep ${HOME} $(pwd) sed echo done
+2>/dev/null local awk
+cd "$1" grep cd readonly "$@" local test echo 2>/dev/null ${HOME}
+	cd ${HOME} export done $(pwd) sed readonly | readonly
+"$1" awk done /usr/bin --verbose -eu printf
+cd && export "$1" "$1" cd -eu "$1" done $(pwd) export x=1 echo $(pwd) grep awk export
+		sed $(pwd) test -eu && | done grep echo cd $(pwd) printf awk export export
+		sed $(pwd) 'quoted text' $(pwd) "$@" -eu sed local
+		sed | printf x=1 then cd then /usr/bin printf test /usr/bin
+	/usr/bin -eu ${HOME} sed x=1 x=1 "$@" echo --verbose $(pwd) awk awk
+		echo test grep | ${HOME} local awk then 'quoted text' test awk --verbose
+local --verbose x=1 "$@" test awk x=1 ${HOME} "$1" /usr/bin "$1"
+		test awk sed | "$1" export grep test export 2>/dev/null cd
+	"$1" /usr/bin x=1 cd grep && sed ${HOME} cd cd then done "$@" 2>/dev/null grep
+	cd "$@" ${HOME} 'quoted text' sed /usr/bin test test awk cd awk export grep 2>/dev/null
+sed local grep | 2>/dev/null /usr/bin && --verbose -eu && printf test readonly
+		printf x=1 echo 2>/dev/null awk /usr/bin awk | then | | grep | x=1 --verbose |
+	then $(pwd) done printf -eu then 'quoted text' x=1 echo && x=1 -eu -eu echo
+/usr/bin printf local
+	grep ${HOME} grep then /usr/bin local grep "$1" readonly --verbose
+	"$1" 2>/dev/null local $(pwd) done done
+	-eu then "$1" x=1 grep grep local $(pwd) cd x=1 test export
+awk cd printf readonly -eu $(pwd)
+		done $(pwd) x=1 cd 2>/dev/null test grep "$1" --verbose 'quoted text' "$@"
+	echo --verbose readonly x=1 export $(pwd) sed "$@" echo readonly readonly grep export
+	${HOME} readonly sed grep done printf test printf done then -eu 2>/dev/null
+	awk $(pwd) "$@" | awk echo export && "$@" ${HOME}
+	/usr/bin "$1" cd local echo ${HOME} &&
+		local awk test done "$1" && ${HOME} $(pwd) &&
+sed grep test then sed x=1 export x=1 test 'quoted text' 'quoted text'
+		test $(pwd) cd 2>/dev/null
+printf "$@" | echo "$1" cd grep sed $(pwd) --verbose
+2>/dev/null ${HOME} grep $(pwd) 2>/dev/null -eu readonly
+x=1 ${HOME} cd | /usr/bin export "$@" grep -eu "$@"
+	awk "$@" cd | test awk ${HOME}
+sed ${HOME} && awk awk "$1" readonly export done test grep "$1" -eu "$@" --verbose
+	sed test test "$1" grep $(pwd)
+	awk $(pwd) cd "$1" sed test local cd ${HOME} $(pwd) export done $(pwd) sed /usr/bin
+"$@" "$@" --verbose "$@" sed -eu export printf x=1 test cd readonly readonly
+	sed printf grep "$@" test --verbose readonly local 'quoted text' readonly 2>/dev/null
+	"$1" --verbose x=1 && test then /usr/bin ${HOME} 2>/dev/null ${HOME} sed done /usr/bin
+done test export echo printf "$1" -eu x=1 | "$1" grep
+	${HOME} "$@" 2>/dev/null printf sed 2>/dev/null "$@"
+	readonly "$1" | -eu then "$@" |
+readonly echo && awk "$@" then then x=1 cd readonly then -eu && -eu printf
+		'quoted text' export /usr/bin cd then grep "$@" | x=1 "$1"
+	$(pwd) local export | grep $(pwd) "$1" export && echo printf $(pwd) ${HOME}
+	$(pwd) ${HOME} "$1" printf export cd done ${HOME} grep
+	--verbose cd 'quoted text' -eu 'quoted text' 'quoted text' awk printf printf 'quoted text'
+printf /usr/bin echo echo $(pwd)
+		readonly "$@" done test && 2>/dev/null ${HOME} ${HOME} cd -eu 2>/dev/null
+	printf local sed cd export
+${HOME} "$1" then $(pwd) ${HOME} 2>/dev/null /usr/bin awk x=1 echo readonly
+&& | local done x=1 echo then ${HOME} 'quoted text'
+$(pwd) cd --verbose done printf $(pwd) ${HOME} local "$@" --verbose cd readonly
+'quoted text' 2>/dev/null /usr/bin then --verbose "$@" local
+local /usr/bin "$@" printf /usr/bin --verbose export local cd && "$@"
+		"$1" 'quoted text' local /usr/bin readonly done | 'quoted text'
+	&& printf cd "$1" | echo test export 2>/dev/null
+		| cd test -eu /usr/bin cd sed cd /usr/bin awk "$1" $(pwd) export | -eu
+then "$@" grep 'quoted text' awk printf
+	test readonly local x=1 x=1 --verbose printf --verbose
+	&& done export done test $(pwd) echo && awk "$@"
+	cd "$@" $(pwd) done ${HOME} cd local x=1 /usr/bin ${HOME} printf | grep cd
+	export echo ${HOME} printf "$@" $(pwd) -eu then 'quoted text'
+		x=1 done --verbose && sed printf cd printf
+		grep test export awk "$1" | readonly test sed ${HOME} echo
+		done printf readonly grep
+	sed 'quoted text' ${HOME} then && cd x=1 done local
+--verbose ${HOME} printf done | "$@" $(pwd) "$@"
+		then done echo | echo done 'quoted text' readonly
+	done 2>/dev/null then awk $(pwd) export sed -eu grep "$@" export readonly --verbose
+sed /usr/bin local x=1 local then
+	&& --verbose x=1 then awk done sed --verbose "$1" export "$@" awk | then
+cd && --verbose cd "$1" readonly echo && x=1 2>/dev/null local
+local done 'quoted text' printf 'quoted text' $(pwd) "$@" 'quoted text'
+	| readonly awk "$@" awk /usr/bin printf --verbose -eu
+		2>/dev/null readonly ${HOME}
+then test grep grep local /usr/bin test /usr/bin
+'quoted text' --verbose ${HOME} local 2>/dev/null cd $(pwd)
+	test x=1 "$1" readonly ${HOME} 2>/dev/null 'quoted text' --verbose -eu readonly
+"$1" 2>/dev/null readonly 2>/dev/null "$@" sed 2>/dev/null
+		readonly x=1 -eu grep local && sed /usr/bin grep
+export 2>/dev/null "$@" echo | /usr/bin
+	$(pwd) $(pwd) "$1" cd grep awk --verbose export export ${HOME} awk local
+		sed grep export "$@" awk x=1 -eu echo -eu
+printf "$1" grep /usr/bin $(pwd) done printf "$@" "$@" test echo
+		export readonly 2>/dev/null x=1 -eu "$@" /usr/bin then | "$@" && | 'quoted text'
+		local $(pwd) 2>/dev/null then awk | sed done 2>/dev/null -eu export sed 'quoted text'
+| /usr/bin export printf /usr/bin cd x=1 export awk
+local then awk 'quoted text' done --verbose test 2>/dev/null
+echo x=1 && printf && test x=1 "$1" x=1 sed cd &&
+test awk 'quoted text' $(pwd) echo 'quoted text' | test "$@" echo export
+test local 'quoted text' printf export sed export cd
+"$@" 2>/dev/null && local
+		readonly readonly && --verbose
+		'quoted text' "$@" -eu -eu 2>/dev/null /usr/bin printf
+export && "$@" awk | then cd echo x=1 $(pwd)
+--verbose printf 'quoted text' x=1
+		echo 2>/dev/null 2>/dev/null export test ${HOME} -eu x=1 export 'quoted text'
+		sed done | "$@" x=1 grep export cd | x=1 | 'quoted text'
+	then done && "$@" 2>/dev/null done $(pwd)
+		/usr/bin ${HOME} test | | "$@" "$@" test test "$1" "$@" "$@" readonly ${HOME}
+	$(pwd) x=1 --verbose "$1" done
+	awk && 'quoted text' awk readonly
+	sed -eu local echo "$1"
+	awk grep "$1" ${HOME} done export && printf
+printf && export done echo "$1" grep $(pwd) then x=1 "$1" --verbose local && grep
+		$(pwd) then "$@" --verbose $(pwd) sed cd sed cd $(pwd) $(pwd) then
+		| && "$1" /usr/bin 'quoted text' "$@" "$@" 'quoted text' 2>/dev/null
+	"$1" grep --verbose awk
+	readonly "$@" test x=1 |
+"$@" sed x=1 readonly 'quoted text' ${HOME} printf && echo export $(pwd) "$1"
+	"$@" ${HOME} echo x=1 "$@" cd && 'quoted text' local
+		"$1" done sed grep export "$@" /usr/bin
+	$(pwd) "$@" ${HOME} test test awk
+done sed "$@" x=1 done readonly printf local readonly export /usr/bin 2>/dev/null
+/usr/bin echo "$@" "$@" cd local readonly 'quoted text' | 2>/dev/null
+	2>/dev/null | printf test then grep readonly cd awk 2>/dev/null
+	$(pwd) grep echo 2>/dev/null
+	--verbose | then local 2>/dev/null "$1" grep
+		"$@" "$1" test sed "$1" /usr/bin local test
+	done "$@" then "$@" x=1 --verbose local
+		test "$@" -eu -eu sed x=1 awk $(pwd) && ${HOME} "$@" --verbose readonly --verbose
+	awk echo grep -eu $(pwd) awk -eu x=1 grep awk $(pwd) 2>/dev/null
+		done "$1" export printf done $(pwd) /usr/bin local readonly
+	sed then cd printf echo sed awk 'quoted text'
+sed cd 2>/dev/null "$1" sed && /usr/bin
+printf ${HOME} cd | echo 2>/dev/null && sed -eu export
+x=1 then grep sed --verbose --verbose then x=1
+${HOME} then ${HOME} export done readonly 2>/dev/null &&
+	test then | grep ${HOME} x=1 done then grep /usr/bin && $(pwd) sed local --verbose
+		test "$1" $(pwd) sed -eu --verbose readonly "$@" printf 2>/dev/null
+echo printf /usr/bin sed
+		sed local ${HOME} $(pwd) 2>/dev/null done ${HOME} --verbose /usr/bin
+sed 2>/dev/null && ${HOME} |
+echo "$@" -eu -eu /usr/bin sed then x=1
+		done done x=1 awk --verbose "$1" echo readonly grep
+	then x=1 /usr/bin local printf then $(pwd) awk awk printf $(pwd)
+	| then "$@" cd 'quoted text' $(pwd)
+	${HOME} x=1 sed printf $(pwd) | then echo ${HOME} x=1 ${HOME} 2>/dev/null done
+		--verbose "$@" readonly echo then echo -eu 2>/dev/null
+		/usr/bin echo /usr/bin 'quoted text' x=1 'quoted text' "$1" sed cd awk export
+"$@" /usr/bin local echo grep x=1 $(pwd) echo -eu done sed sed
+	readonly $(pwd) 'quoted text' -eu --verbose test printf awk && printf sed
+	x=1 done test cd awk ${HOME}
+		test local awk export 2>/dev/null
+done "$@" "$1" export grep "$@" test x=1 echo export
+	| "$@" readonly $(pwd) 'quoted text' local "$@" "$@" then echo | sed ${HOME}
+	${HOME} /usr/bin 'quoted text' --verbose done sed
+	printf echo export printf cd echo x=1 printf $(pwd) && x=1
+		export "$@" done then echo
+	then ${HOME} --verbose export 'quoted text' echo
+	test readonly export /usr/bin test
+/usr/bin -eu 'quoted text' /usr/bin local then -eu && awk
+		"$@" /usr/bin test echo 2>/dev/null echo cd --verbose 2>/dev/null
+| "$1" cd 2>/dev/null
+		/usr/bin 'quoted text' --verbose 2>/dev/null
+	readonly --verbose 'quoted text'
+		-eu 'quoted text' "$@" "$1" printf local 'quoted text'
+		"$1" -eu then && 2>/dev/null then done x=1 export
+$(pwd) sed local -eu "$@" done
+		"$@" 'quoted text' then ${HOME} /usr/bin "$1" 2>/dev/null
+	export x=1 2>/dev/null ${HOME} printf --verbose -eu /usr/bin
+	export "$1" && 'quoted text' awk "$1" 'quoted text' sed export
+grep "$1" cd "$1" ${HOME}
+		local "$@" ${HOME} /usr/bin export && -eu -eu echo test "$@" x=1 readonly /usr/bin
+	readonly test "$1" /usr/bin then printf sed | ${HOME} test &&
+	then $(pwd) --verbose --verbose printf "$1" then "$1" cd 2>/dev/null "$@"
+	export | --verbose 'quoted text' "$1" sed 'quoted text'
+		export test local $(pwd) "$1" printf x=1 'quoted text' echo test ${HOME}
+then ${HOME} --verbose sed export then echo "$@"
+		readonly echo 2>/dev/null x=1 readonly test
+	&& awk "$1" readonly -eu done export ${HOME} readonly /usr/bin /usr/bin
+		readonly --verbose local cd export "$@" test awk --verbose echo
+	2>/dev/null grep awk awk -eu cd awk export
+	readonly then echo | && grep | done test test "$1" printf
+/usr/bin x=1 2>/dev/null "$1" done
+	sed --verbose "$@" printf "$1" 'quoted text' readonly done "$@"
+	sed /usr/bin done export "$1" cd sed printf grep 2>/dev/null /usr/bin &&
+awk grep ${HOME} ${HOME} awk -eu /usr/bin readonly cd "$1" $(pwd) ${HOME} 2>/dev/null
+		-eu done echo readonly printf --verbose "$@" sed "$1"
+		echo printf 2>/dev/null readonly "$1" /usr/bin
+then export && then /usr/bin readonly awk printf /usr/bin
+	${HOME} $(pwd) 'quoted text'
+	2>/dev/null then then echo ${HOME}
+		echo && grep local 'quoted text' $(pwd) test printf | awk
+		-eu printf readonly /usr/bin
+/usr/bin readonly --verbose
+		grep "$1" awk $(pwd) ${HOME}
+		"$1" then 'quoted text' 2>/dev/null /usr/bin 2>/dev/null awk --verbose echo
+		-eu x=1 && 2>/dev/null awk && test done | x=1 2>/dev/null echo export then done
+	&& | && | grep readonly x=1 x=1
+	/usr/bin grep | $(pwd) x=1
+"$1" -eu | grep readonly local readonly && ${HOME} echo readonly
+-eu printf x=1 awk readonly awk | export sed export
+	grep --verbose $(pwd) export cd
+		echo grep 2>/dev/null awk "$@" test echo "$@" readonly
+	export && readonly && local ${HOME}
+-eu local sed readonly && grep awk echo printf /usr/bin $(pwd)
+	$(pwd) /usr/bin sed sed grep $(pwd) x=1 printf --verbose awk x=1 cd 'quoted text'
+		/usr/bin | --verbose grep $(pwd) done && readonly
+		x=1 sed && sed "$1" then | | "$1" awk $(pwd) then 2>/dev/null ${HOME} "$1" /usr/bin
+sed sed 2>/dev/null echo awk "$@" grep
+sed test 2>/dev/null echo test
+${HOME} 'quoted text' 2>/dev/null --verbose /usr/bin /usr/bin --verbose
+	"$@" x=1 cd x=1 grep test export ${HOME} ${HOME} "$@" 'quoted text' 'quoted text'
+		${HOME} then -eu echo done
+	then grep test x=1 grep export echo then echo --verbose
+	done test && local $(pwd) local readonly then
+awk echo sed then printf awk "$@" test 2>/dev/null
+	readonly ${HOME} export
+	'quoted text' | && $(pwd) done test echo done awk /usr/bin printf cd sed
+		echo readonly $(pwd) 'quoted text' | cd /usr/bin readonly "$1" printf
+	${HOME} test grep "$@" export done then sed readonly "$1" 'quoted text'
+		export sed readonly export cd cd done grep
+&& | cd cd 'quoted text' 2>/dev/null then /usr/bin awk && awk sed test sed then
+		cd && readonly export --verbose
+		done ${HOME} then echo echo |
+-eu awk printf printf printf -eu done
+		local grep 2>/dev/null 'quoted text' test "$1" readonly ${HOME}
+	awk /usr/bin "$@" --verbose 'quoted text' awk 'quoted text'
+	awk 'quoted text' $(pwd) $(pwd) --verbose grep local grep readonly
+	x=1 $(pwd) "$@" 'quoted text' /usr/bin /usr/bin export 'quoted text'
+	--verbose then printf /usr/bin
+	readonly 'quoted text' -eu -eu
+		&& printf x=1 "$@" "$@" "$@" awk /usr/bin sed readonly printf | --verbose
+	&& $(pwd) sed then 'quoted text' "$1" /usr/bin grep 2>/dev/null &&
+	sed 2>/dev/null /usr/bin local /usr/bin 'quoted text'
+grep -eu 'quoted text' awk
+	x=1 export "$@" local local "$1" 2>/dev/null
+		"$1" "$1" --verbose ${HOME} cd -eu && && -eu then /usr/bin
+then done local "$@" local "$1"
+		test local -eu x=1 export 'quoted text' awk 'quoted text' then sed
+then ${HOME} test ${HOME} local cd 2>/dev/null
+		x=1 $(pwd) && cd printf
+&& echo sed echo done -eu 'quoted text' local sed $(pwd)
+		export 'quoted text' ${HOME} readonly /usr/bin echo && awk "$@" -eu $(pwd)
+	${HOME} grep awk cd readonly /usr/bin
+		x=1 --verbose -eu 'quoted text' | readonly test && 'quoted text'
+		done sed done 'quoted text' echo cd
+test -eu printf 'quoted text' cd $(pwd)
+		cd /usr/bin -eu 2>/dev/null 'quoted text' 'quoted text' sed done "$@" done
+	readonly && -eu done "$@"
+	$(pwd) $(pwd) ${HOME} then --verbose echo export export
+awk then 'quoted text' 'quoted text' $(pwd) readonly --verbose
+	awk awk "$1" -eu "$1" test
+		"$@" printf --verbose -eu readonly | echo 'quoted text' test readonly sed grep
+		2>/dev/null x=1 | echo echo 2>/dev/null local "$1" "$@" 2>/dev/null "$1" readonly
+		cd 2>/dev/null ${HOME} && sed $(pwd) && ${HOME}
+	done $(pwd) readonly readonly done && echo local printf "$1" $(pwd) cd
+--verbose "$1" $(pwd) ${HOME} export 'quoted text'
+		x=1 readonly x=1 ${HOME} awk 'quoted text' 'quoted text' grep
+		2>/dev/null test | test cd 'quoted text'
+echo sed $(pwd) "$@" 'quoted text' cd -eu && grep
+		${HOME} "$@" awk --verbose cd
+	${HOME} "$@" then test then printf then awk 2>/dev/null
+	local /usr/bin awk "$@" then &&
+	${HOME} -eu test && printf $(pwd) | then
+		$(pwd) 2>/dev/null --verbose | $(pwd) sed x=1 printf grep && 2>/dev/null
+		awk ${HOME} /usr/bin export x=1 2>/dev/null -eu /usr/bin
+cd x=1 then x=1 -eu awk done local
+--verbose 2>/dev/null export export
+	echo 'quoted text' /usr/bin sed x=1 'quoted text' local 2>/dev/null --verbose
+	-eu /usr/bin /usr/bin 'quoted text'
+		done local cd local --verbose && printf 2>/dev/null
+		| echo sed --verbose ${HOME} echo test done test
+	echo "$@" --verbose awk $(pwd) grep $(pwd) "$1" 'quoted text'
+		cd readonly -eu readonly readonly then
+awk done printf --verbose 'quoted text'
+	then 'quoted text' grep awk 2>/dev/null export
+	&& cd $(pwd) | ${HOME} printf awk "$1" then /usr/bin "$@"
+		/usr/bin grep -eu ${HOME} echo grep printf | done printf
+		grep test echo echo "$@" x=1 "$@" sed -eu sed 'quoted text'
+2>/dev/null test ${HOME} x=1 local readonly then
+sed "$1" /usr/bin "$@" x=1 export echo | "$@" sed -eu awk grep
+grep /usr/bin 2>/dev/null x=1 | $(pwd)
+		echo | done readonly 'quoted text' $(pwd) sed "$1"
+done awk -eu 2>/dev/null printf -eu test 2>/dev/null
+'quoted text' readonly export
+	| local ${HOME} cd done $(pwd) $(pwd) readonly /usr/bin cd 'quoted text'
+	export awk cd ${HOME} | cd -eu /usr/bin x=1 local 'quoted text'
+		x=1 done /usr/bin sed then -eu -eu done $(pwd)
+cd printf x=1 "$1" test then sed "$1" ${HOME} echo $(pwd) $(pwd) /usr/bin
+	--verbose 'quoted text' ${HOME} -eu &&
+readonly cd cd grep /usr/bin x=1
+		cd readonly "$@" | readonly -eu sed $(pwd) awk /usr/bin cd export sed "$1" && ${HOME}
+	| local export done then sed local awk readonly "$1" x=1
+		done grep sed && export x=1 local grep -eu printf echo /usr/bin && x=1 "$@"
+	--verbose then --verbose
+		export awk then "$1" test -eu 'quoted text' cd --verbose cd && awk local ${HOME}
+		cd ${HOME} local /usr/bin local && $(pwd) 'quoted text' 'quoted text' x=1
+	local done ${HOME} export awk readonly 'quoted text'
+		export "$@" | readonly 2>/dev/null
+	echo cd x=1 sed | printf readonly
+awk test /usr/bin -eu $(pwd) "$1" printf test readonly x=1 sed cd "$1" --verbose
+		grep awk && -eu sed sed readonly echo 'quoted text'
+		/usr/bin readonly readonly grep
+x=1 x=1 /usr/bin then readonly echo cd
+		echo -eu 'quoted text' test readonly $(pwd) "$@" grep
+	echo "$@" && ${HOME} --verbose grep printf done /usr/bin readonly local done
+		grep "$1" | | sed cd x=1 "$@" | awk printf readonly then export 'quoted text'
+		sed ${HOME} then sed printf readonly then |
+		grep /usr/bin readonly "$@" test "$1" sed -eu export then "$1" $(pwd) --verbose
+echo 2>/dev/null cd local 2>/dev/null "$1"
+	| 2>/dev/null $(pwd) test awk "$1" 2>/dev/null
+		then ${HOME} x=1 done export "$@" "$@" sed
+local echo --verbose local ${HOME} | -eu "$@" local then awk readonly 'quoted text'
+		test 2>/dev/null printf 'quoted text' printf /usr/bin cd then sed
+x=1 --verbose && "$1" | printf
+	/usr/bin printf "$@" /usr/bin test sed local
+echo awk echo "$@" readonly
+	$(pwd) sed -eu x=1 ${HOME} printf "$@"
+	grep --verbose export then "$1" export
+		awk | awk "$@" sed readonly cd test ${HOME} -eu --verbose local echo test
+		sed /usr/bin grep awk ${HOME} echo awk readonly
+		/usr/bin readonly $(pwd) done | -eu sed && done "$1" && done "$1"
+		| sed printf ${HOME} -eu "$1" && /usr/bin echo sed
+2>/dev/null test then grep awk done sed sed cd then grep
+		echo local cd readonly awk 2>/dev/null --verbose &&
+		grep local awk | export done $(pwd) ${HOME} 2>/dev/null
+		$(pwd) cd then x=1 printf "$@" ${HOME} done readonly then awk done local echo 2>/dev/null
+grep awk -eu x=1 -eu export -eu local "$1" export test export sed 'quoted text'
+	"$@" cd echo | then 2>/dev/null export "$1" ${HOME}
+cd export export 'quoted text'
+	readonly printf "$@" echo | &&
+		grep printf 'quoted text' test local
+		local /usr/bin | sed then 'quoted text'
+	sed then 'quoted text' printf local printf 2>/dev/null awk -eu 2>/dev/null
+printf done "$@" sed then awk 2>/dev/null awk ${HOME} -eu local "$1"
+		printf ${HOME} grep echo && printf readonly cd ${HOME} $(pwd)
+done echo echo /usr/bin 2>/dev/null echo $(pwd) "$1" 'quoted text' "$1" awk "$@"
+		awk --verbose grep echo cd "$1" printf
+		--verbose && sed local echo local printf sed
+	then done test --verbose
+		--verbose echo done x=1 && -eu readonly
+	"$@" export x=1 cd x=1 2>/dev/null "$@" echo 2>/dev/null readonly
+-eu "$@" /usr/bin done sed "$1"
+	| sed --verbose "$@" | "$@" ${HOME} x=1 --verbose local 'quoted text' "$@" sed
+	"$1" cd ${HOME} ${HOME} -eu test | ${HOME}
+	2>/dev/null -eu printf echo && "$@" ${HOME} ${HOME} 2>/dev/null ${HOME}
+grep x=1 sed awk "$@" -eu printf local grep cd "$@" ${HOME} echo ${HOME}
+--verbose done 'quoted text' ${HOME} ${HOME}
+	done -eu local cd -eu "$@" awk printf $(pwd) sed | -eu export && sed "$@" /usr/bin
+	x=1 x=1 /usr/bin echo "$1" "$@" $(pwd) "$1" 2>/dev/null
+		2>/dev/null test 2>/dev/null x=1 local 'quoted text' done awk
+		sed local local readonly cd ${HOME} $(pwd) /usr/bin
+		| -eu sed ${HOME} printf export local "$1" --verbose done ${HOME} --verbose export
+		&& export $(pwd) printf grep x=1 "$1" then /usr/bin "$1" echo
+		grep done export then awk "$@"
+x=1 x=1 local local awk echo echo done $(pwd) test test -eu echo
+		awk readonly "$1" x=1 sed then readonly printf local /usr/bin printf --verbose
+	export echo x=1 -eu | awk cd 'quoted text' awk done && sed x=1 then local grep 2>/dev/null
+		cd local ${HOME} test "$@" echo -eu echo ${HOME} export printf | readonly
+-eu then -eu readonly /usr/bin "$@" --verbose
+	then | $(pwd) 2>/dev/null cd grep done 2>/dev/null sed "$1" sed
+	cd --verbose $(pwd) echo printf && -eu && "$1" export $(pwd)
+sed | printf export $(pwd) export
+'quoted text' | grep echo test
+		&& 'quoted text' echo test $(pwd) ${HOME} | grep 2>/dev/null 'quoted text'
+	awk /usr/bin printf x=1 printf && ${HOME} readonly --verbose echo "$1" $(pwd)
+sed /usr/bin awk && x=1 readonly
+		&& awk awk then x=1 then done done then grep export --verbose
+	then 2>/dev/null "$1" sed -eu export 'quoted text' x=1 && -eu
+"$1" ${HOME} | export 'quoted text' sed && echo && x=1 | sed echo "$1"
+| local /usr/bin export cd "$@" printf "$1" ${HOME} -eu -eu
+local cd 2>/dev/null | /usr/bin
+	sed printf echo awk -eu export
+		x=1 test x=1 --verbose "$1" | then
+	/usr/bin $(pwd) ${HOME} -eu && then --verbose
+	${HOME} cd 'quoted text' --verbose 'quoted text' /usr/bin --verbose
+		echo printf 'quoted text' $(pwd) $(pwd) sed | echo cd 'quoted text' grep local
+${HOME} sed done sed export
+		sed done local --verbose local grep local then
+done x=1 ${HOME} 'quoted text' -eu 'quoted text'
+test 'quoted text' readonly "$@" export then test /usr/bin "$1" sed ${HOME} readonly
+		-eu | awk "$@" readonly && | grep
+		$(pwd) then && "$@" readonly printf $(pwd) | "$1" /usr/bin 2>/dev/null
+		x=1 2>/dev/null local 'quoted text' --verbose
+	sed --verbose grep printf echo --verbose x=1
+		echo echo "$@" ${HOME} export
+	cd $(pwd) ${HOME} done "$@" cd ${HOME} $(pwd) export --verbose
+	$(pwd) | --verbose test echo printf -eu x=1 "$@" done awk export grep export
+		-eu sed "$1" grep cd ${HOME} /usr/bin 'quoted text' 'quoted text' "$1" printf
+	x=1 echo export export
+		&& --verbose cd export cd export readonly
+		/usr/bin cd export export | 2>/dev/null 'quoted text' echo
+	readonly test grep readonly ${HOME} readonly awk $(pwd) x=1
+		awk --verbose /usr/bin awk awk readonly
+local && readonly -eu readonly &&
+	printf $(pwd) then $(pwd) 'quoted text' --verbose
+		2>/dev/null export sed done grep /usr/bin && && cd &&
+"$@" awk -eu printf ${HOME} $(pwd) | $(pwd) | /usr/bin
+"$@" echo "$@" sed | printf awk export x=1
+| local local then printf echo /usr/bin done /usr/bin x=1 grep sed "$@"
+	/usr/bin awk /usr/bin x=1 grep && ${HOME} local "$@"
+	2>/dev/null local $(pwd) x=1 -eu
+		cd | 2>/dev/null ${HOME} printf x=1 then -eu export | --verbose
+local local "$@" sed --verbose "$1" 2>/dev/null 2>/dev/null export "$@" "$1" --verbose
+		/usr/bin "$@" printf readonly "$1" ${HOME} cd --verbose -eu "$@" readonly readonly
+		local --verbose test -eu 2>/dev/null readonly
+		awk export && | cd "$1" cd then "$@" done ${HOME} readonly && echo done
+	awk then then cd x=1 | 2>/dev/null
+		--verbose export 2>/dev/null "$1" 2>/dev/null export
+	/usr/bin -eu local done 2>/dev/null cd ${HOME} done local grep x=1 echo
+		2>/dev/null grep grep test local
+		| x=1 /usr/bin sed sed --verbose export
+		local done $(pwd) done && printf awk readonly -eu x=1 awk cd && && test "$@" cd
+	export ${HOME} $(pwd) printf
+		sed $(pwd) --verbose test done readonly awk | && printf
+	&& "$1" export readonly | -eu /usr/bin readonly echo 'quoted text'
+	-eu ${HOME} awk ${HOME} sed
+		done echo grep && grep grep printf awk
+readonly printf cd printf sed sed then | ${HOME}
+then done sed 'quoted text'
+	readonly done "$@" export test test echo sed awk "$1" done test printf
+	readonly --verbose sed --verbose 2>/dev/null 'quoted text' --verbose awk -eu local
+	| readonly | $(pwd) "$@" /usr/bin /usr/bin cd && $(pwd) "$@"
+	test && 'quoted text' awk done printf --verbose $(pwd) cd awk $(pwd)
+	test | -eu x=1 -eu awk test $(pwd) readonly | grep then echo 2>/dev/null
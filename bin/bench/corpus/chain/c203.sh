@@ -0,0 +1,2001 @@
+		&& --verbose x=1 -eu 'quoted text' printf ${HOME} test $(pwd)
+	2>/dev/null $(pwd) export 'quoted text' awk
+	&& 2>/dev/null awk done test /usr/bin -eu "$@"
+		grep --verbose awk | then $(pwd)
+	"$1" then "$@" x=1 && awk printf "$@" -eu 2>/dev/null export $(pwd) export
+| readonly sed 'quoted text' /usr/bin --verbose ${HOME} x=1 cd echo test cd
+"$1" printf sed "$1" export --verbose local printf /usr/bin | x=1 export
+	"$@" echo 'quoted text' grep
+	/usr/bin | $(pwd) 'quoted text' readonly awk x=1 sed test x=1
+		test "$1" 2>/dev/null /usr/bin 2>/dev/null
+		sed ${HOME} && export then
+'quoted text' x=1 ${HOME} then "$@" --verbose "$@" 'quoted text'
+	&& done sed then | "$1" then ${HOME} ${HOME} $(pwd) test awk | sed
+then sed ${HOME} printf then 2>/dev/null
+	/usr/bin "$@" -eu 2>/dev/null readonly grep done 2>/dev/null | test "$@" "$@" then
+		| -eu then grep $(pwd) test $(pwd) x=1 $(pwd) ${HOME} local
+		then $(pwd) awk sed $(pwd) printf
+		/usr/bin x=1 -eu && done x=1 done
+test /usr/bin /usr/bin /usr/bin "$@" ${HOME}
+done local --verbose grep -eu readonly readonly x=1 local /usr/bin then sed
+-eu done "$1" 2>/dev/null 'quoted text'
+2>/dev/null done grep done grep test grep awk readonly $(pwd) echo 2>/dev/null
+printf | sed 'quoted text' readonly local test done | "$@" test
+		2>/dev/null 'quoted text'
+&& export 2>/dev/null ${HOME} | /usr/bin awk | local cd 2>/dev/null
+"$1" --verbose /usr/bin readonly
+		$(pwd) printf | local done "$1" printf 'quoted text' export --verbose x=1 cd grep
+then local cd export 2>/dev/null local --verbose export
+	then --verbose test printf ${HOME} printf sed 'quoted text'
+printf export local 2>/dev/null "$1" 'quoted text'
+	&& 2>/dev/null awk echo -eu then printf test local "$@" grep -eu sed
+	local $(pwd) export x=1 x=1 ${HOME} x=1 done "$1"
+	--verbose ${HOME} -eu echo -eu $(pwd) &&
+	test 'quoted text' ${HOME} --verbose
+grep grep $(pwd) sed 'quoted text'
+		&& -eu "$1" "$1" readonly && readonly done 2>/dev/null sed awk "$@"
+		then echo local "$1" "$@" test grep printf then then x=1 then 'quoted text'
+readonly printf /usr/bin $(pwd) --verbose 2>/dev/null echo /usr/bin "$1"
+	readonly -eu grep awk 2>/dev/null export | export ${HOME} local done /usr/bin
+--verbose --verbose $(pwd) /usr/bin
+/usr/bin 'quoted text' ${HOME} --verbose export $(pwd)
+grep local --verbose done
+export cd local awk grep /usr/bin $(pwd) sed
+'quoted text' then cd grep done --verbose $(pwd) x=1 x=1 $(pwd) x=1 2>/dev/null
+then 2>/dev/null ${HOME} local
+	done sed --verbose && ${HOME} 'quoted text'
+		sed echo $(pwd) readonly "$@" grep cd test x=1 export 2>/dev/null
+		printf x=1 "$@" awk x=1 2>/dev/null 'quoted text' "$@"
+	2>/dev/null 'quoted text' echo export --verbose 2>/dev/null --verbose -eu |
+		"$1" | local export cd export $(pwd)
+		echo ${HOME} sed --verbose && ${HOME} && 'quoted text' local
+		${HOME} 2>/dev/null readonly $(pwd) 2>/dev/null ${HOME} && export /usr/bin
+		"$1" sed grep ${HOME} /usr/bin local sed sed 'quoted text'
+	echo then grep sed $(pwd) awk readonly "$1" "$@" 2>/dev/null
+	export readonly test --verbose then export test grep
+	readonly $(pwd) 2>/dev/null export sed readonly grep | /usr/bin printf 'quoted text'
+x=1 "$@" export then cd -eu ${HOME}
+| then x=1 ${HOME} printf done awk echo $(pwd)
+	echo cd export "$@" printf $(pwd) export 2>/dev/null local
+	2>/dev/null awk readonly $(pwd) 'quoted text' test 2>/dev/null
+test "$1" printf printf ${HOME} 2>/dev/null local 2>/dev/null "$@" echo printf
+	x=1 "$@" "$@" grep readonly cd
+/usr/bin then 'quoted text' 'quoted text' cd cd local && |
+		"$@" /usr/bin then 'quoted text' "$1"
+awk | ${HOME} local printf
+	echo "$1" printf x=1 | sed | 'quoted text'
+cd && local sed --verbose local -eu
+grep 'quoted text' then test 2>/dev/null export "$@" sed sed sed && | printf &&
+	| --verbose readonly done printf && "$@" sed printf "$@" then then "$@" ${HOME}
+		sed && $(pwd) test "$1" 2>/dev/null printf export local
+		"$1" cd readonly awk "$1" done
+		$(pwd) awk && x=1 --verbose x=1 printf printf done --verbose
+		cd readonly 'quoted text' -eu readonly readonly
+-eu -eu $(pwd) export x=1 /usr/bin printf 'quoted text' -eu sed "$@"
+echo | | "$@" /usr/bin test ${HOME}
+		--verbose 2>/dev/null local test x=1 /usr/bin x=1 -eu sed --verbose 2>/dev/null
+	done "$@" local 'quoted text'
+	| sed awk awk readonly test $(pwd) "$@"
+cd | grep done export $(pwd)
+	then cd awk cd /usr/bin 'quoted text'
+	| ${HOME} 'quoted text' ${HOME} readonly -eu "$1" ${HOME} /usr/bin
+		x=1 -eu && readonly 'quoted text' 2>/dev/null
+		"$@" export then cd local && test | printf x=1 2>/dev/null 'quoted text'
+	"$@" $(pwd) done grep ${HOME} 2>/dev/null "$1" sed sed "$1" -eu
+		then then readonly && "$1"
+	x=1 printf ${HOME} ${HOME} ${HOME} 2>/dev/null x=1 "$1" then
+then export 2>/dev/null then 2>/dev/null readonly cd test
+readonly /usr/bin 'quoted text' /usr/bin echo local && ${HOME} ${HOME} ${HOME}
+echo echo && readonly echo -eu then $(pwd) printf 'quoted text' /usr/bin
+readonly local export
+	export awk 'quoted text' /usr/bin printf done
+then test 'quoted text' sed ${HOME} sed grep local
+	&& printf cd printf cd printf 2>/dev/null --verbose
+		'quoted text' test awk local test readonly && $(pwd) printf &&
+		local echo then done "$@" printf 'quoted text' --verbose ${HOME}
+2>/dev/null export "$@" local sed sed | && then then $(pwd)
+printf local awk 'quoted text' cd then x=1
+		"$@" ${HOME} "$@" -eu --verbose test printf
+then test done sed done 2>/dev/null awk -eu 2>/dev/null
+		local printf | "$@" 2>/dev/null 2>/dev/null $(pwd) grep
+		local $(pwd) cd printf echo sed "$1" printf awk /usr/bin grep x=1 && sed
+		"$1" -eu readonly && && sed awk export sed 'quoted text' sed --verbose
+		grep "$1" awk "$@" done x=1 && echo "$@" 'quoted text'
+grep test && awk printf export done grep sed then done sed then
+$(pwd) export /usr/bin readonly 'quoted text' -eu --verbose "$@" sed x=1 -eu
+	--verbose -eu awk cd /usr/bin test test 2>/dev/null readonly
+	$(pwd) local cd "$@" grep awk awk -eu sed
+		/usr/bin /usr/bin local echo
+		sed $(pwd) echo "$@" /usr/bin sed echo sed -eu $(pwd) | "$1" done
+		export grep done --verbose awk echo | && awk $(pwd) printf "$1" 'quoted text'
+		$(pwd) && /usr/bin then then
+	'quoted text' 'quoted text' grep --verbose && awk x=1
+	'quoted text' then readonly "$@" printf
+	test cd echo export -eu export local "$1" /usr/bin x=1 printf | echo
+		sed "$@" sed /usr/bin awk grep $(pwd) local test sed
+readonly test printf test readonly awk test export
+	&& printf "$@" "$1" 2>/dev/null
+/usr/bin readonly x=1 ${HOME} grep cd && export
+		readonly echo sed printf $(pwd) cd echo 'quoted text' then /usr/bin ${HOME}
+	echo export awk export $(pwd) 'quoted text'
+	test then test 'quoted text' 2>/dev/null test
+	$(pwd) test x=1 export /usr/bin $(pwd) 'quoted text' x=1 export echo --verbose
+		x=1 --verbose export local 2>/dev/null x=1
+		2>/dev/null 'quoted text' -eu
+		"$@" --verbose 'quoted text'
+		sed grep export readonly done x=1 "$1"
+		/usr/bin export --verbose echo awk local | echo "$@" then
+readonly /usr/bin /usr/bin ${HOME}
+		2>/dev/null done readonly awk
+		| "$1" cd /usr/bin 2>/dev/null echo then
+		local awk readonly printf ${HOME}
+| /usr/bin ${HOME} awk test && /usr/bin --verbose $(pwd) "$1"
+		cd /usr/bin /usr/bin /usr/bin readonly echo
+		readonly done test "$@" ${HOME} /usr/bin then then --verbose awk --verbose
+local -eu --verbose -eu done
+		done --verbose 2>/dev/null
+2>/dev/null | test test "$1" "$@" cd local cd sed && awk
+	export test cd sed awk readonly /usr/bin
+	"$1" --verbose /usr/bin cd awk 'quoted text' 'quoted text'
+		local "$@" 2>/dev/null -eu sed test
+		echo "$@" $(pwd) -eu test
+		local && grep -eu --verbose test cd readonly "$@" $(pwd) export
+	| "$1" -eu printf grep then then && --verbose done "$@" cd /usr/bin done
+-eu x=1 --verbose printf readonly
+| "$1" awk "$@" 2>/dev/null grep
+	$(pwd) && printf x=1 local
+	echo test test 2>/dev/null && cd grep local then local
+local cd then printf 2>/dev/null
+		--verbose "$@" 'quoted text' $(pwd) then "$1" -eu 'quoted text' then
+	done --verbose -eu done -eu echo 'quoted text'
+		grep cd echo done export /usr/bin ${HOME} printf ${HOME} 2>/dev/null
+		readonly "$1" 2>/dev/null /usr/bin ${HOME} -eu readonly
+		echo ${HOME} grep export ${HOME}
+	done 2>/dev/null done local export
+	$(pwd) cd | test local sed /usr/bin echo
+		test "$1" 2>/dev/null 'quoted text'
+x=1 then && 'quoted text' cd | grep ${HOME}
+x=1 readonly 2>/dev/null /usr/bin 2>/dev/null readonly -eu then | ${HOME}
+--verbose x=1 "$@" grep readonly "$@" -eu 2>/dev/null grep -eu 2>/dev/null
+		--verbose awk --verbose x=1 -eu then sed
+		&& | ${HOME} | done readonly
+"$1" $(pwd) grep ${HOME} cd && done grep
+2>/dev/null local then grep then
+grep awk then /usr/bin sed
+		--verbose then x=1 printf done "$@" ${HOME} test awk then "$1"
+		then readonly test sed local cd grep -eu | 'quoted text'
+	x=1 $(pwd) test 'quoted text' echo local
+		local test | grep printf | x=1 $(pwd) --verbose ${HOME} test
+/usr/bin printf --verbose $(pwd) cd | $(pwd)
+x=1 --verbose test grep export 'quoted text'
+		awk && then readonly ${HOME}
+$(pwd) $(pwd) /usr/bin "$@" awk then --verbose
+		awk grep --verbose x=1 test $(pwd) sed grep then test
+		export echo | then test $(pwd)
+'quoted text' sed done awk readonly awk
+	echo cd test printf sed grep -eu && sed 'quoted text'
+echo awk ${HOME} $(pwd) --verbose "$1" x=1 x=1 --verbose $(pwd)
+/usr/bin /usr/bin ${HOME} x=1 grep "$1" && local "$@" x=1 && --verbose
+		-eu echo && ${HOME} sed grep cd grep ${HOME} 2>/dev/null
+		sed /usr/bin then sed | sed ${HOME} 2>/dev/null test
+		| readonly export cd grep x=1 export grep readonly awk --verbose grep ${HOME}
+		printf local grep echo /usr/bin
+	| 'quoted text' done 2>/dev/null done cd readonly ${HOME} cd --verbose
+	export "$1" awk "$1" "$1" sed test ${HOME} local 'quoted text'
+echo && 2>/dev/null "$1"
+		2>/dev/null 2>/dev/null x=1 /usr/bin printf --verbose | "$1"
+		${HOME} readonly printf printf
+then $(pwd) "$1" export 'quoted text' | readonly awk local 'quoted text'
+sed test 'quoted text' --verbose sed 2>/dev/null x=1
+		"$@" --verbose 2>/dev/null printf echo "$1" readonly ${HOME} ${HOME} -eu 2>/dev/null
+	done -eu sed /usr/bin grep printf done 2>/dev/null /usr/bin
+	readonly "$@" readonly -eu echo /usr/bin /usr/bin printf cd /usr/bin x=1
+echo 2>/dev/null --verbose local ${HOME} x=1 ${HOME} sed then echo awk
+	grep grep -eu export export x=1
+		"$@" export awk grep cd awk x=1 'quoted text' local
+		export echo -eu done readonly then && awk x=1 /usr/bin ${HOME} -eu $(pwd)
+		echo then --verbose x=1 x=1 $(pwd) "$1" "$@" done readonly && export
+		grep grep /usr/bin 2>/dev/null done -eu x=1 printf test
+-eu test then 'quoted text' 2>/dev/null awk x=1 && | && && readonly /usr/bin --verbose
+		test readonly 2>/dev/null grep --verbose test ${HOME} then 2>/dev/null |
+	cd awk /usr/bin readonly $(pwd) local export $(pwd)
+	echo then local sed sed cd done awk | export readonly
+then && readonly 'quoted text' readonly ${HOME}
+		--verbose readonly done
+		done && done | printf | /usr/bin readonly && awk local 2>/dev/null
+		local 'quoted text' --verbose x=1 --verbose
+	done local "$1" | $(pwd) cd --verbose "$@" test -eu
+	-eu sed echo then /usr/bin readonly | 'quoted text' then "$@" --verbose 2>/dev/null
+		test printf cd | export --verbose printf | ${HOME} | printf "$1" | done ${HOME}
+"$1" cd sed "$@" $(pwd) $(pwd) export
+		2>/dev/null done cd -eu /usr/bin x=1 sed local ${HOME} test 2>/dev/null
+-eu grep "$1" x=1 printf "$@"
+	&& sed ${HOME} printf $(pwd) local --verbose cd cd 2>/dev/null readonly then printf
+		2>/dev/null echo awk echo printf x=1 -eu ${HOME}
+awk sed then printf "$@" sed test /usr/bin grep grep $(pwd)
+readonly /usr/bin local echo test export -eu && /usr/bin awk awk | 'quoted text'
+		&& ${HOME} 2>/dev/null cd grep -eu printf awk $(pwd)
+x=1 /usr/bin --verbose awk --verbose
+		readonly test done done cd echo done echo ${HOME} --verbose 'quoted text' $(pwd)
+	done --verbose export local --verbose grep /usr/bin sed export | export --verbose
+	2>/dev/null readonly cd awk sed | -eu | echo -eu export | ${HOME} export
+	"$1" export done | then $(pwd) "$1"
+		&& local grep export then
+		"$@" echo ${HOME} export ${HOME} grep
+		"$1" done --verbose awk printf --verbose
+$(pwd) && ${HOME} | /usr/bin local awk 'quoted text' -eu local -eu ${HOME}
+done 'quoted text' -eu cd 'quoted text' cd | 'quoted text'
+grep --verbose test ${HOME} 'quoted text' --verbose grep
+		x=1 awk -eu readonly
+--verbose test "$@" 2>/dev/null --verbose --verbose x=1 done export
+	grep export ${HOME} | x=1 x=1 awk awk cd --verbose --verbose ${HOME}
+'quoted text' done test test local x=1 sed awk done
+${HOME} /usr/bin "$1" echo -eu /usr/bin echo -eu sed "$1" awk "$@" $(pwd) export
+local -eu printf $(pwd) then "$1" ${HOME} | "$@" && $(pwd) export export
+	cd ${HOME} && printf then done 2>/dev/null
+		| "$1" -eu readonly then 'quoted text'
+	'quoted text' 'quoted text' grep "$@"
+	${HOME} x=1 ${HOME} x=1 done grep export awk grep grep
+export grep local "$1" test 2>/dev/null
+	&& $(pwd) export then "$@" test printf
+		test 'quoted text' $(pwd) && && 2>/dev/null 'quoted text' readonly then
+	sed test "$@" /usr/bin -eu $(pwd) /usr/bin printf
+		2>/dev/null local awk --verbose echo
+		2>/dev/null echo "$1" -eu && --verbose local ${HOME} /usr/bin
+	'quoted text' -eu && --verbose
+-eu $(pwd) echo sed x=1 $(pwd) -eu --verbose --verbose
+	x=1 local && -eu ${HOME} export 'quoted text'
+	grep --verbose "$@" readonly printf "$@"
+&& then printf cd done cd ${HOME} 2>/dev/null
+		"$@" x=1 ${HOME} | then | 2>/dev/null
+${HOME} export printf awk sed test
+		echo --verbose awk 2>/dev/null /usr/bin $(pwd) test awk "$@" /usr/bin
+grep x=1 test awk x=1 $(pwd)
+	| awk export grep /usr/bin awk cd "$@" printf awk 'quoted text'
+x=1 sed "$1" then readonly export awk awk awk -eu | grep -eu
+readonly --verbose "$1" $(pwd) grep awk export readonly
+local readonly grep x=1 --verbose -eu | "$1" $(pwd) then test done local
+cd "$1" $(pwd) printf "$1" /usr/bin
+'quoted text' cd then | /usr/bin "$@" done test export "$@" grep awk done 2>/dev/null
+	x=1 "$1" "$@" "$@" 'quoted text' grep echo cd cd done awk
+export cd cd "$@" ${HOME} printf /usr/bin then echo $(pwd) sed export 'quoted text'
+		grep | 2>/dev/null then test "$@" readonly $(pwd) "$@" done | && x=1
+	printf sed readonly done
+	${HOME} cd $(pwd) && 'quoted text' awk
+		done grep done --verbose done
+	2>/dev/null local test -eu "$1" ${HOME} && x=1 readonly
+	then 'quoted text' readonly $(pwd) --verbose sed &&
+x=1 done --verbose then done --verbose
+	$(pwd) 2>/dev/null && sed then test test | awk readonly -eu local echo x=1 done
+-eu cd "$1" /usr/bin "$1" | cd "$@" local /usr/bin grep $(pwd) echo $(pwd) awk
+		'quoted text' $(pwd) echo /usr/bin -eu local printf
+	'quoted text' --verbose grep -eu --verbose
+	local 'quoted text' grep 'quoted text' export x=1 | /usr/bin "$1" 'quoted text'
+		export awk then awk printf 2>/dev/null
+		done then readonly printf test 2>/dev/null done readonly awk && "$1" echo cd
+		2>/dev/null --verbose then readonly cd sed sed 'quoted text'
+		done "$1" export --verbose
+		| grep awk 'quoted text'
+| x=1 | | /usr/bin then "$1" then
+	-eu -eu /usr/bin | test && cd -eu printf local cd | "$@" 'quoted text'
+		local $(pwd) test cd ${HOME} ${HOME}
+cd then local -eu readonly "$1" /usr/bin ${HOME}
+		local 'quoted text' done grep export && then printf $(pwd) test done "$@" "$1"
+	local local -eu export --verbose && printf sed cd --verbose /usr/bin
+export "$1" export printf 'quoted text' &&
+	x=1 "$@" && awk x=1 'quoted text'
+awk ${HOME} --verbose done readonly | cd 2>/dev/null
+2>/dev/null cd export grep export sed /usr/bin
+-eu --verbose export ${HOME} /usr/bin then
+	$(pwd) awk done 2>/dev/null && done done printf -eu x=1
+x=1 'quoted text' echo
+	done grep export $(pwd) $(pwd)
+		sed /usr/bin sed export x=1 'quoted text' | ${HOME} ${HOME} | /usr/bin "$1"
+	export | grep printf then awk 'quoted text' awk
+test --verbose printf echo export cd | x=1 "$1" printf "$@"
+	-eu printf && /usr/bin printf "$@" grep 2>/dev/null
+		&& awk "$1" readonly
+	echo printf ${HOME} | printf test awk
+		cd echo "$@" "$1" 'quoted text' x=1 echo cd test "$1" "$1" 2>/dev/null
+	printf echo local /usr/bin cd grep && printf /usr/bin local | | "$1" 2>/dev/null
+sed sed sed done echo -eu readonly test export readonly 2>/dev/null "$1" /usr/bin
+		"$1" && "$@" then test
+grep readonly cd then 2>/dev/null 'quoted text' "$@" local x=1 | && test 'quoted text'
+	/usr/bin grep awk $(pwd) "$@" 2>/dev/null echo printf /usr/bin
+		-eu awk /usr/bin readonly test x=1 printf | grep ${HOME} "$@"
+test sed "$@" sed sed done "$@" printf x=1 awk ${HOME} sed 'quoted text' awk
+	&& done local /usr/bin ${HOME}
+x=1 local export 'quoted text' x=1 done test cd printf --verbose cd printf
+then printf | test ${HOME} 2>/dev/null then sed then $(pwd)
+		export printf x=1 2>/dev/null printf readonly
+export then then x=1 cd $(pwd)
+readonly done ${HOME} test x=1 2>/dev/null test
+	awk -eu readonly printf done
+--verbose local && export printf then awk "$1" printf done | printf /usr/bin
+${HOME} 'quoted text' test $(pwd) sed ${HOME} awk local readonly done test 'quoted text'
+		test cd echo sed 2>/dev/null
+	| printf $(pwd) test readonly sed "$@" test --verbose ${HOME}
+		"$1" -eu "$@" awk "$@" awk | done printf cd 2>/dev/null
+		x=1 test echo then sed sed && --verbose awk -eu readonly done -eu local $(pwd)
+--verbose | local then -eu readonly ${HOME} x=1 2>/dev/null x=1 then awk "$@"
+		echo /usr/bin x=1 ${HOME} | local -eu readonly sed local x=1
+	local "$@" x=1 readonly $(pwd)
+		then readonly echo test sed && export
+	sed "$@" x=1 export readonly $(pwd) awk | $(pwd) /usr/bin /usr/bin x=1
+cd x=1 | awk readonly 'quoted text'
+		test then /usr/bin $(pwd) -eu 2>/dev/null
+sed | $(pwd) sed printf then awk 2>/dev/null then
+		readonly "$1" && x=1 readonly export
+--verbose then sed readonly test cd cd -eu grep grep /usr/bin
+	awk $(pwd) then grep export /usr/bin 2>/dev/null
+	"$@" grep test test ${HOME} printf ${HOME} printf "$1" export -eu local "$1" ${HOME}
+		readonly && grep && -eu | awk
+	'quoted text' awk test 2>/dev/null && echo export cd 'quoted text'
+	'quoted text' echo local awk x=1
+		awk 2>/dev/null echo /usr/bin
+		echo awk ${HOME} --verbose 'quoted text' awk /usr/bin "$@"
+"$@" "$@" awk -eu readonly grep cd awk local export
+	$(pwd) -eu && echo /usr/bin test done | then then printf
+	| ${HOME} --verbose -eu | awk | test
+		x=1 export | ${HOME} grep x=1
+-eu 'quoted text' | echo sed "$@" printf then 2>/dev/null
+	-eu | ${HOME} $(pwd) done "$@" "$@"
+cd grep 2>/dev/null grep awk
+		echo /usr/bin local done cd printf sed $(pwd) "$@" test 'quoted text'
+	awk sed /usr/bin 'quoted text' test x=1 cd x=1 -eu
+local x=1 /usr/bin grep export | --verbose -eu | cd readonly test
+/usr/bin cd local then then printf
+echo "$@" --verbose $(pwd) $(pwd) local grep "$1" /usr/bin
+	readonly | sed "$@" awk | ${HOME} done echo then
+export awk printf 'quoted text' then $(pwd) "$1" cd -eu
+local printf local sed x=1 x=1 'quoted text' "$@"
+cd --verbose /usr/bin done ${HOME} echo test "$1" export readonly then readonly
+		cd echo /usr/bin 'quoted text' cd /usr/bin local
+	'quoted text' ${HOME} export printf awk printf -eu ${HOME} echo
+		grep then echo && $(pwd) 'quoted text' export -eu local readonly
+readonly local grep "$1" x=1 /usr/bin "$@" printf done echo
+	${HOME} done -eu "$@" ${HOME} && grep readonly /usr/bin local
+x=1 echo 'quoted text' test "$@" printf 2>/dev/null test readonly
+	done then /usr/bin sed done /usr/bin test /usr/bin ${HOME} && printf printf
+		--verbose test "$1" cd test local x=1 sed awk cd ${HOME} export "$1" sed
+cd test awk readonly echo $(pwd)
+	printf awk awk --verbose local $(pwd) --verbose 'quoted text'
+	grep done 2>/dev/null --verbose
+printf test awk /usr/bin
+	local test printf sed sed done
+		2>/dev/null then "$@" cd local ${HOME} x=1 sed printf
+then printf --verbose 2>/dev/null
+-eu --verbose sed grep x=1
+readonly "$1" /usr/bin && done
+	then --verbose && && "$@" export ${HOME} echo
+awk sed readonly export grep 'quoted text'
+--verbose x=1 /usr/bin $(pwd) printf | then readonly then done 'quoted text'
+	${HOME} ${HOME} echo /usr/bin printf grep sed --verbose ${HOME}
+		test echo | "$1" cd /usr/bin cd local test "$1"
+		echo && $(pwd) "$1" printf sed && | $(pwd)
+		x=1 readonly /usr/bin "$@" "$1" ${HOME} "$1" 2>/dev/null "$1"
+	'quoted text' $(pwd) "$@" "$@" "$@" /usr/bin --verbose
+		-eu awk 2>/dev/null x=1
+	local local grep local ${HOME} /usr/bin | grep test export /usr/bin
+	grep 2>/dev/null done /usr/bin x=1 local --verbose $(pwd) done test &&
+	2>/dev/null 'quoted text' grep then echo "$@"
+		| "$@" awk 'quoted text' --verbose awk "$1" "$1" readonly
+	local "$@" $(pwd) 2>/dev/null x=1 printf readonly cd done export
+	x=1 local cd "$@" echo readonly | sed "$1" done
+	${HOME} readonly test grep
+	$(pwd) export | $(pwd) printf ${HOME} grep awk echo readonly
+	-eu "$@" x=1 "$1" grep x=1 sed x=1 ${HOME} grep
+grep | then cd 'quoted text' ${HOME} test
+	echo awk test grep awk $(pwd) 2>/dev/null /usr/bin | && 'quoted text' sed
+$(pwd) readonly ${HOME} ${HOME} | printf x=1 export "$@" 2>/dev/null "$1" | done
+	"$1" echo echo cd done local /usr/bin local "$@" local readonly
+		export "$@" x=1 x=1 | then -eu 'quoted text' done $(pwd)
+	&& readonly | "$1" x=1 printf --verbose
+		/usr/bin "$1" cd then /usr/bin "$1" &&
+awk then then then $(pwd) ${HOME}
+	x=1 grep 2>/dev/null "$1" && | sed done local sed "$1" readonly
+		'quoted text' x=1 "$@" awk cd /usr/bin awk -eu x=1 /usr/bin
+	| "$@" cd export 'quoted text' then --verbose 2>/dev/null
+		local x=1 done "$@" sed $(pwd) echo export x=1 -eu
+	/usr/bin cd "$@" readonly ${HOME} printf grep | printf
+		done "$1" && 2>/dev/null then | ${HOME} awk "$1" --verbose
+		2>/dev/null local && echo 'quoted text' | test awk local 2>/dev/null
+	&& local readonly echo --verbose -eu $(pwd) "$1"
+		-eu export $(pwd) echo "$@" then 2>/dev/null awk export --verbose "$@"
+		-eu 'quoted text' /usr/bin "$@" 'quoted text' x=1 "$@"
+		test --verbose 2>/dev/null x=1 && printf $(pwd) $(pwd)
+		2>/dev/null export done -eu 'quoted text' -eu test "$@" cd $(pwd) $(pwd) &&
+		'quoted text' local local -eu local cd
+${HOME} readonly 2>/dev/null /usr/bin test ${HOME} grep x=1 awk test export
+${HOME} 'quoted text' echo 2>/dev/null cd 'quoted text' test 'quoted text'
+	echo 'quoted text' readonly local
+	done && then test local
+		$(pwd) test ${HOME} readonly "$1" --verbose
+then cd --verbose /usr/bin -eu cd then
+readonly | printf local grep 'quoted text'
+	x=1 export done "$@" awk --verbose | x=1 && printf local "$@" readonly awk --verbose
+		readonly done echo readonly && readonly test "$@" | done printf $(pwd)
+		&& local echo "$1" ${HOME} echo | -eu --verbose ${HOME}
+sed | $(pwd) readonly cd -eu x=1 /usr/bin --verbose $(pwd) test awk x=1 x=1 &&
+cd test ${HOME} ${HOME}
+readonly export $(pwd) && | local 'quoted text' /usr/bin
+		cd 2>/dev/null -eu echo then test grep cd sed 'quoted text' "$@" local
+"$1" -eu --verbose 2>/dev/null
+	sed export "$1" awk printf x=1 sed | export $(pwd) 2>/dev/null test "$@" done
+'quoted text' readonly 'quoted text' done
+	2>/dev/null 'quoted text'
+x=1 cd && test grep then "$1" local 2>/dev/null cd export done done 2>/dev/null
+	echo "$@" grep 2>/dev/null "$1"
+		--verbose local printf ${HOME} | local /usr/bin
+	'quoted text' readonly
+/usr/bin cd test printf "$@" && export readonly
+		&& $(pwd) --verbose "$1"
+	local printf export /usr/bin ${HOME} $(pwd) local /usr/bin echo
+		export /usr/bin sed 2>/dev/null export 2>/dev/null &&
+		echo x=1 grep --verbose --verbose local &&
+	grep cd export sed "$1" grep -eu 'quoted text' export
+	test local awk export 2>/dev/null
+grep | readonly --verbose then readonly grep test x=1 cd 2>/dev/null sed
+awk 2>/dev/null && && 2>/dev/null -eu /usr/bin 2>/dev/null export printf grep
+| 'quoted text' 'quoted text' readonly awk sed
+	awk x=1 'quoted text' && readonly
+	readonly x=1 then done ${HOME} cd grep echo && x=1 echo | x=1
+	'quoted text' grep cd
+	-eu /usr/bin 'quoted text' | test then 2>/dev/null local ${HOME}
+	done sed then 2>/dev/null export 'quoted text'
+readonly 'quoted text'
+sed $(pwd) "$@" done 2>/dev/null echo awk then && /usr/bin then
+	cd "$1" printf local local cd | | echo -eu sed awk local $(pwd) local
+--verbose "$1" export 'quoted text' sed "$@" "$1" -eu "$@" awk awk -eu --verbose
+	cd "$1" 2>/dev/null ${HOME} "$@" test && --verbose done
+"$@" "$1" ${HOME} test
+		printf --verbose -eu $(pwd) cd printf -eu readonly printf ${HOME} --verbose
+"$1" grep ${HOME} "$@" 'quoted text' then grep -eu x=1 --verbose
+2>/dev/null ${HOME} then test echo 2>/dev/null test local "$@" echo "$1" x=1
+	| --verbose "$1" -eu done && echo && -eu
+	readonly awk 'quoted text' --verbose "$@" sed
+"$@" done echo awk awk && /usr/bin
+		export 2>/dev/null echo test export 2>/dev/null
+		2>/dev/null then $(pwd) cd readonly awk local echo && readonly --verbose /usr/bin
+		done grep grep 'quoted text' 'quoted text' x=1 'quoted text' --verbose &&
+-eu export readonly x=1 export cd 'quoted text' ${HOME} awk "$@"
+	printf done ${HOME} local
+$(pwd) local && "$@" printf awk test export grep 2>/dev/null $(pwd) sed /usr/bin
+	"$@" cd "$1" --verbose 2>/dev/null echo --verbose export export grep
+	/usr/bin export grep test readonly echo
+	/usr/bin "$@" "$1" 2>/dev/null echo 'quoted text'
+export 2>/dev/null 2>/dev/null -eu awk $(pwd) cd "$1" cd cd --verbose
+	2>/dev/null --verbose 2>/dev/null
+	test test && /usr/bin
+		"$1" x=1 && printf done printf "$1" && cd readonly
+		cd --verbose local then cd -eu "$1" | x=1
+	readonly -eu | local | && echo $(pwd) && "$@" done export
+		grep 2>/dev/null echo
+	2>/dev/null ${HOME} -eu -eu
+readonly 2>/dev/null /usr/bin cd && 'quoted text'
+	echo && 2>/dev/null sed | "$1" x=1 test $(pwd) x=1 export -eu "$1"
+echo "$1" awk local done ${HOME} | sed /usr/bin test
+cd local test 'quoted text'
+	2>/dev/null "$@" /usr/bin "$1"
+echo test readonly $(pwd) -eu echo $(pwd) | local
+done 2>/dev/null -eu x=1 "$@" printf
+	| printf sed printf x=1 cd then cd /usr/bin | printf local "$@" echo ${HOME}
+local "$@" then $(pwd) awk then && echo grep then 'quoted text'
+		sed "$1" cd then x=1 printf echo done 'quoted text' export export
+	test ${HOME} "$@" $(pwd) grep 'quoted text'
+		sed readonly 'quoted text' "$@"
+	&& sed grep export then export --verbose "$@" "$1" awk
+"$1" readonly 2>/dev/null && done awk grep | "$1"
+echo x=1 echo export "$1" done then x=1
+		x=1 export awk done awk test $(pwd) test printf printf printf --verbose
+	readonly export x=1 sed echo printf cd grep grep 'quoted text'
+awk /usr/bin | "$@" awk -eu
+	grep local cd --verbose -eu grep $(pwd)
+'quoted text' grep done
+		echo "$1" x=1 awk | local x=1 x=1 done "$1" test ${HOME}
+${HOME} -eu grep then printf grep
+test && done export then export local awk $(pwd)
+test x=1 export readonly readonly done printf readonly
+		${HOME} -eu test awk 'quoted text'
+		-eu && "$1" awk | $(pwd) cd export $(pwd) | --verbose -eu echo test test x=1 $(pwd)
+	grep awk && 'quoted text' test
+	"$@" export printf -eu "$1" test x=1 awk 'quoted text' 2>/dev/null
+	'quoted text' export x=1 --verbose -eu done "$@" /usr/bin awk x=1 &&
+		local test done test awk 'quoted text' "$@" $(pwd)
+		&& test 'quoted text' echo -eu sed --verbose cd cd ${HOME}
+		local test "$1" awk 'quoted text' 'quoted text'
+	$(pwd) local 'quoted text' local printf then done x=1 ${HOME}
+		"$@" ${HOME} "$@" echo export then sed "$@" -eu | /usr/bin
+		--verbose $(pwd) done -eu cd readonly test | --verbose 'quoted text'
+		${HOME} readonly /usr/bin /usr/bin done 'quoted text' export && --verbose
+		/usr/bin "$1" 'quoted text' cd cd | grep test done cd && 'quoted text'
+grep "$@" test export local "$1" test && printf ${HOME} readonly export local $(pwd)
+		awk echo "$@" 2>/dev/null
+	--verbose readonly && --verbose $(pwd) test "$1" 'quoted text' && /usr/bin
+		echo readonly printf 'quoted text' done && | /usr/bin | then echo $(pwd) ${HOME}
+	-eu ${HOME} 'quoted text' "$1"
+	-eu --verbose awk test "$1" done awk done 2>/dev/null $(pwd) $(pwd)
+	local --verbose printf cd "$1" echo ${HOME}
+		awk ${HOME} ${HOME} printf test 'quoted text'
+		'quoted text' "$@" printf 2>/dev/null echo done x=1 awk test printf
+readonly printf $(pwd) -eu local
+	x=1 'quoted text' && grep printf ${HOME} grep cd local ${HOME}
+${HOME} printf sed && && grep readonly --verbose "$1" x=1 then
+$(pwd) /usr/bin printf -eu export 2>/dev/null done "$1" &&
+		-eu awk readonly grep local grep 2>/dev/null | echo /usr/bin
+		--verbose "$1" | && awk /usr/bin "$1" 'quoted text' grep sed x=1
+	-eu 2>/dev/null test --verbose then
+		done awk local echo 2>/dev/null |
+grep $(pwd) 2>/dev/null -eu grep grep local 'quoted text' "$@"
+	"$@" && --verbose "$@" done && test 'quoted text'
+test sed -eu done -eu sed | sed printf
+/usr/bin echo -eu "$@" sed $(pwd) "$1" ${HOME} && printf then "$@"
+export test /usr/bin ${HOME} $(pwd) export echo | | grep sed then then test
+		done --verbose test /usr/bin
+done sed sed then export | then cd x=1 test echo "$@" sed printf "$@" echo "$@"
+| awk 'quoted text' test awk local --verbose
+${HOME} "$@" echo then 2>/dev/null grep local echo test done then
+	'quoted text' 2>/dev/null grep local | cd "$@" 2>/dev/null --verbose
+${HOME} awk ${HOME} done cd
+		then | awk printf export echo cd -eu test readonly awk awk export 2>/dev/null
+	-eu "$1" printf $(pwd) 'quoted text' /usr/bin 'quoted text' cd --verbose $(pwd)
+		'quoted text' cd export awk local | 'quoted text' cd | cd done
+		echo export echo /usr/bin 2>/dev/null grep echo echo cd 2>/dev/null awk 'quoted text'
+"$1" | sed echo then | awk then 'quoted text' "$@" $(pwd) 'quoted text'
+	/usr/bin sed echo echo local grep /usr/bin awk
+		local 2>/dev/null grep then --verbose readonly && | 2>/dev/null done grep sed
+	export sed then 'quoted text' test grep
+	local ${HOME} local grep 2>/dev/null awk test && cd /usr/bin
+		"$1" readonly cd $(pwd)
+--verbose 2>/dev/null $(pwd) cd --verbose readonly
+		'quoted text' local export /usr/bin printf then $(pwd) printf
+	${HOME} readonly then $(pwd) sed grep
+--verbose ${HOME} -eu /usr/bin --verbose -eu "$@" ${HOME}
+$(pwd) ${HOME} echo done test echo grep x=1 local -eu 'quoted text' export
+		x=1 local readonly --verbose cd cd ${HOME}
+grep readonly 2>/dev/null local cd
+printf export $(pwd) "$@"
+	awk --verbose awk "$@" ${HOME} -eu then
+2>/dev/null then "$@" done grep
+		echo grep cd --verbose printf -eu awk export awk printf "$@" done echo
+		/usr/bin cd then x=1 awk ${HOME}
+echo 2>/dev/null export --verbose "$@"
+	2>/dev/null "$1" awk "$@" $(pwd) printf ${HOME}
+		test -eu | sed /usr/bin test "$1" ${HOME} --verbose readonly readonly "$@"
+awk ${HOME} echo -eu /usr/bin /usr/bin -eu "$@" grep then
+2>/dev/null | test sed
+		-eu cd test $(pwd) grep x=1 2>/dev/null "$@" test "$@" | grep "$@" grep export
+	| "$1" then /usr/bin "$1" local
+	| | echo --verbose --verbose done -eu then && 'quoted text'
+	--verbose done grep --verbose ${HOME} done then done
+readonly $(pwd) done awk 2>/dev/null && then ${HOME} x=1 export
+export --verbose 'quoted text' "$1" /usr/bin
+	"$@" x=1 awk --verbose then local 2>/dev/null 2>/dev/null
+		&& $(pwd) ${HOME} | then && local $(pwd) printf ${HOME} | local "$@"
+"$@" "$1" && then done test test test printf 'quoted text' /usr/bin cd local
+	awk then --verbose "$1" "$1" 2>/dev/null
+sed then | 'quoted text' | then export sed -eu then ${HOME} readonly readonly
+	cd && --verbose sed cd readonly 'quoted text' readonly test "$@" sed
+	readonly sed grep then &&
+"$1" printf "$1" "$@" /usr/bin done /usr/bin --verbose "$@" 2>/dev/null
+	test 'quoted text' echo export | sed local 2>/dev/null && 2>/dev/null
+	test "$@" 2>/dev/null local /usr/bin local cd && cd echo test "$@"
+readonly grep "$1" --verbose
+	2>/dev/null 'quoted text' export | 'quoted text' x=1 grep sed
+		readonly --verbose readonly x=1 local awk then "$1" done then x=1 grep readonly
+${HOME} then then --verbose export && 2>/dev/null
+		'quoted text' local 2>/dev/null done test "$@" 'quoted text' $(pwd)
+		readonly awk 'quoted text' /usr/bin export awk readonly
+	echo "$1" ${HOME} cd x=1 sed local --verbose
+export x=1 grep readonly printf printf echo readonly $(pwd) local done ${HOME}
+sed 'quoted text' --verbose readonly export
+		done export sed "$1" -eu cd
+cd awk 2>/dev/null ${HOME}
+| echo ${HOME} local /usr/bin export 'quoted text'
+		'quoted text' 2>/dev/null x=1 export x=1 "$@" && | 2>/dev/null $(pwd) /usr/bin
+	export 2>/dev/null echo "$1" grep $(pwd)
+test "$1" cd $(pwd) 2>/dev/null && test echo "$@"
+		'quoted text' readonly | 'quoted text' x=1 x=1 cd 2>/dev/null sed ${HOME}
+"$@" awk -eu 2>/dev/null then export
+	test "$@" /usr/bin cd echo awk --verbose
+$(pwd) ${HOME} readonly local && "$@" cd local test
+		x=1 -eu echo done | export
+cd | local echo test /usr/bin $(pwd) -eu grep "$@" /usr/bin readonly "$@" ${HOME}
+"$@" then sed echo printf -eu export -eu readonly 'quoted text'
+	awk awk awk $(pwd) awk -eu cd
+sed --verbose x=1 && readonly export then awk "$@" sed 2>/dev/null
+	&& 'quoted text' export readonly grep ${HOME} sed | sed "$@"
+		cd then x=1 "$1" ${HOME} done printf x=1 | then && | grep sed
+	awk "$@" done done | "$1" test "$@" sed readonly printf
+grep local test cd printf then
+	sed then 2>/dev/null 'quoted text' 'quoted text' awk ${HOME} local export sed
+export sed "$@" local grep x=1 'quoted text' 2>/dev/null export test printf export
+export test /usr/bin "$1" $(pwd) ${HOME} sed -eu sed | export awk && test
+	2>/dev/null printf -eu $(pwd) awk "$1" printf
+	${HOME} -eu echo 2>/dev/null && $(pwd) --verbose /usr/bin awk
+	| 'quoted text' done sed -eu printf x=1 echo cd test then
+--verbose --verbose local sed export -eu awk readonly
+	--verbose x=1 ${HOME} "$1" test "$1" "$1" grep -eu local 2>/dev/null
+	'quoted text' "$@" export -eu
+	then | "$@" test x=1 cd -eu sed 'quoted text' $(pwd)
+	-eu --verbose /usr/bin "$1"
+		/usr/bin done ${HOME} "$@" -eu ${HOME} ${HOME} --verbose local readonly
+		${HOME} $(pwd) --verbose test cd local done 2>/dev/null local
+	/usr/bin $(pwd) && grep "$@" -eu local $(pwd)
+		local | test cd && /usr/bin | -eu -eu readonly done
+| -eu $(pwd) sed $(pwd) 'quoted text'
+		sed printf readonly | $(pwd) grep grep 'quoted text' | test test readonly awk
+cd cd x=1 | ${HOME} ${HOME}
+/usr/bin | "$1" "$1" "$1" test then then -eu readonly export echo /usr/bin
+	export -eu done "$1" export sed local export 'quoted text' "$@" ${HOME}
+x=1 grep echo export awk export grep grep test && readonly
+		x=1 x=1 ${HOME} cd cd /usr/bin done printf --verbose x=1 && readonly
+		/usr/bin printf "$@" awk echo |
+		"$@" echo test ${HOME} $(pwd) x=1 $(pwd) | local
+		/usr/bin test /usr/bin printf echo echo cd grep readonly
+	'quoted text' test grep readonly "$@" --verbose then "$1" echo
+export printf "$1" /usr/bin export grep
+"$@" $(pwd) done local "$@" readonly "$1" cd $(pwd) -eu ${HOME} --verbose
+	printf --verbose x=1 cd echo "$@" | test | "$1" 'quoted text'
+2>/dev/null && printf "$@" $(pwd) cd readonly --verbose
+	"$1" "$1" readonly cd "$@" done --verbose ${HOME} x=1 grep
+'quoted text' x=1 awk echo awk printf cd local | grep --verbose
+		readonly x=1 then awk | /usr/bin test -eu | echo && -eu cd -eu echo
+then && "$@" printf ${HOME}
+awk awk grep printf test "$1" -eu 'quoted text' export 2>/dev/null echo
+readonly --verbose test local x=1 -eu local printf x=1
+		sed && "$1" test grep cd done readonly
+"$1" export done "$1" done done 2>/dev/null ${HOME}
+	local --verbose --verbose then local printf "$1" && cd awk cd local test --verbose
+printf done grep | done test local
+		| /usr/bin done "$1" export
+	-eu 'quoted text' ${HOME} printf x=1
+	x=1 grep local readonly --verbose "$@" -eu local grep
+		grep local printf done --verbose readonly readonly /usr/bin | "$@"
+echo export 2>/dev/null
+readonly awk test done echo export printf 'quoted text'
+		"$1" "$@" --verbose $(pwd)
+	--verbose sed $(pwd) local | export then x=1 /usr/bin done done -eu export -eu
+	then awk 'quoted text' /usr/bin /usr/bin echo test && && "$1" && test -eu sed
+		test then export | | printf | readonly
+awk grep ${HOME} test readonly awk "$@" | "$1"
+test awk "$1" && readonly | -eu --verbose grep awk 2>/dev/null
+		cd then printf awk readonly local /usr/bin grep x=1 echo
+	/usr/bin "$1" ${HOME} grep readonly
+	export done readonly x=1 echo 2>/dev/null cd --verbose sed 'quoted text'
+		test done x=1 awk readonly then done
+		| local ${HOME} printf then /usr/bin 2>/dev/null sed then | "$1"
+	awk ${HOME} 'quoted text' readonly
+done /usr/bin && cd readonly done cd 2>/dev/null --verbose cd
+&& $(pwd) "$1" grep ${HOME} 'quoted text'
+	awk 2>/dev/null "$1"
+then /usr/bin sed "$@" then awk test /usr/bin ${HOME}
+		then -eu test sed -eu echo sed grep "$@" grep
+grep --verbose test 'quoted text' | && cd 'quoted text'
+		"$1" grep done 2>/dev/null --verbose ${HOME} echo
+		done echo awk "$1" awk grep echo cd "$@" then
+		local $(pwd) $(pwd) local /usr/bin x=1
+	'quoted text' then awk "$1" && ${HOME} /usr/bin echo
+	x=1 then then printf $(pwd) 'quoted text' --verbose -eu printf x=1 | then echo
+local "$1" echo sed $(pwd) sed --verbose /usr/bin printf done awk /usr/bin
+	${HOME} sed "$@" printf | 2>/dev/null
+		-eu /usr/bin echo "$@" readonly x=1 && then --verbose awk --verbose
+	--verbose -eu -eu local grep grep 'quoted text'
+		-eu ${HOME} grep -eu cd x=1 "$1" 2>/dev/null 2>/dev/null done
+		local --verbose cd "$1" local 2>/dev/null x=1 && | -eu readonly
+	$(pwd) grep readonly ${HOME} /usr/bin export printf $(pwd) /usr/bin ${HOME}
+	/usr/bin cd 'quoted text' local sed
+	"$@" "$1" /usr/bin test then 'quoted text' /usr/bin
+		done "$@" done $(pwd) printf | echo
+		sed -eu readonly /usr/bin readonly | 2>/dev/null "$@" test echo && then test
+		done -eu --verbose "$@" readonly
+	cd | export --verbose local done local awk awk
+"$@" && readonly x=1 printf test
+	| local export cd awk ${HOME} cd x=1 awk "$1" --verbose $(pwd) local
+test && printf 'quoted text' "$1" 2>/dev/null /usr/bin local echo
+		cd readonly -eu && printf readonly
+"$1" awk readonly local | ${HOME} 2>/dev/null -eu | && 'quoted text'
+"$1" export "$1" ${HOME} printf "$@" echo | local readonly readonly "$1"
+		printf grep local cd x=1 done && "$@" echo --verbose export
+${HOME} printf | /usr/bin
+${HOME} "$1" "$1" 'quoted text'
+	'quoted text' echo 2>/dev/null /usr/bin then cd 'quoted text' "$1" then echo
+	-eu --verbose | readonly "$1" then $(pwd)
+	cd "$1" done then | /usr/bin
+		-eu echo awk -eu sed grep $(pwd) | x=1 done
+	grep 'quoted text' "$@" ${HOME} /usr/bin 'quoted text'
+	"$1" ${HOME} -eu cd printf export
+	"$1" "$@" local local test done && | awk printf test | echo
+		x=1 local grep then x=1 -eu
+done 'quoted text' /usr/bin then --verbose 2>/dev/null x=1 local local test
+/usr/bin "$@" /usr/bin --verbose local -eu printf
+		test cd 2>/dev/null sed | cd echo readonly x=1 cd &&
+	2>/dev/null | test sed /usr/bin -eu x=1 ${HOME} local cd cd local printf
+	| done | then 2>/dev/null echo 'quoted text'
+		$(pwd) done "$@" export then sed grep | done printf sed --verbose
+	test echo "$@" -eu $(pwd) $(pwd) awk --verbose
+	then ${HOME} local | test grep grep awk done --verbose readonly
+		'quoted text' done printf readonly local $(pwd) /usr/bin cd ${HOME} awk
+printf 'quoted text' | grep /usr/bin 'quoted text' printf "$1" test
+	--verbose awk /usr/bin cd $(pwd) ${HOME} 'quoted text'
+&& cd done cd x=1 local sed done ${HOME} test test readonly
+		export cd | cd 2>/dev/null "$1"
+	local x=1 --verbose --verbose && awk printf
+--verbose "$@" "$1" "$@" -eu awk printf 'quoted text' "$1" awk "$@"
+		'quoted text' x=1 'quoted text' "$1"
+	then 'quoted text' done -eu && test grep "$1" test done x=1 grep x=1 -eu done
+		-eu cd x=1 awk ${HOME} then printf test -eu
+		2>/dev/null readonly then "$1" /usr/bin "$1" sed awk /usr/bin && cd -eu
+		$(pwd) cd $(pwd) "$@" printf export "$1" export readonly "$@"
+		grep 2>/dev/null x=1 x=1 "$1" ${HOME} then x=1 printf $(pwd) --verbose | readonly
+	cd ${HOME} cd awk 2>/dev/null "$@" 'quoted text'
+"$1" 'quoted text' cd echo awk
+		done then done /usr/bin grep readonly x=1 printf echo
+"$1" | --verbose test && grep "$1" local grep readonly &&
+x=1 "$1" printf done && --verbose grep /usr/bin $(pwd) /usr/bin
+cd local export /usr/bin readonly
+		done --verbose -eu ${HOME} --verbose local cd awk | x=1 x=1 then x=1 echo export
+		echo readonly sed x=1 2>/dev/null grep "$@" grep --verbose printf "$@"
+readonly done ${HOME} then 2>/dev/null
+	echo --verbose && 2>/dev/null
+	printf "$1" | export test $(pwd) | readonly -eu test readonly local local done
+		"$1" $(pwd) grep $(pwd) --verbose
+	${HOME} done --verbose readonly sed export test printf
+	-eu test then grep then done cd 'quoted text' echo
+		then "$1" -eu $(pwd) /usr/bin -eu 2>/dev/null awk readonly then --verbose 'quoted text'
+		-eu 'quoted text' "$1" -eu then
+test test local | "$1" test $(pwd)
+x=1 readonly "$@" done 'quoted text' local --verbose --verbose done
+export 2>/dev/null done x=1 then "$1" test
+	awk /usr/bin done -eu "$@" 'quoted text' echo test $(pwd) sed done
+cd export -eu printf done
+	then test && 'quoted text' 'quoted text'
+&& 'quoted text' | cd "$@" "$1" "$1" awk printf readonly "$@"
+"$1" 2>/dev/null $(pwd) /usr/bin | ${HOME} /usr/bin
+	printf x=1 test done ${HOME} grep
+		2>/dev/null && done 'quoted text' sed readonly /usr/bin cd -eu
+		sed $(pwd) && && -eu -eu "$@" "$@" then ${HOME} awk -eu -eu 'quoted text' sed
+		2>/dev/null grep ${HOME} $(pwd) | sed --verbose "$@" awk cd readonly 2>/dev/null
+"$1" export x=1 echo test ${HOME}
+	"$@" --verbose "$1" cd 2>/dev/null "$@" done 2>/dev/null
+	local --verbose $(pwd) done echo local then | x=1 "$1" test /usr/bin --verbose
+	"$@" local done done readonly done echo done cd
+"$1" -eu awk | then done | 2>/dev/null $(pwd) -eu 2>/dev/null "$1" x=1 2>/dev/null
+	local ${HOME} 2>/dev/null
+		${HOME} grep 'quoted text'
+	x=1 echo grep ${HOME} $(pwd) 'quoted text' 'quoted text'
+		test x=1 "$@" | /usr/bin local $(pwd) --verbose
+	'quoted text' then test local --verbose -eu
+		/usr/bin 2>/dev/null "$1" "$1" awk test x=1 printf then local
+	${HOME} 2>/dev/null x=1 /usr/bin && test && "$@" sed done
+	grep grep "$1" x=1 | -eu echo export 'quoted text' 'quoted text' 2>/dev/null
+		cd readonly "$@" $(pwd) cd x=1 | printf echo export
+cd "$@" ${HOME} done sed echo "$1" | 2>/dev/null
+		awk | local export 'quoted text' awk x=1 -eu ${HOME} -eu local
+| --verbose --verbose awk readonly grep && sed then /usr/bin
+		"$1" export && local test 2>/dev/null
+then | 2>/dev/null && "$1" 2>/dev/null --verbose export -eu echo echo
+		'quoted text' /usr/bin export awk && sed readonly 2>/dev/null done export "$1"
+awk printf readonly cd test | test && "$@" ${HOME}
+		export cd "$@" cd sed local export export $(pwd)
+done /usr/bin echo echo echo
+		test x=1 | awk then 'quoted text' readonly awk
+	/usr/bin awk x=1 --verbose $(pwd) -eu --verbose cd
+	/usr/bin done /usr/bin echo export x=1 echo x=1 cd && printf -eu grep
+		${HOME} grep --verbose
+		"$@" then 2>/dev/null | ${HOME} export export | --verbose printf
+	printf sed sed local test $(pwd) awk | ${HOME}
+	test echo /usr/bin 'quoted text'
+	readonly export | "$1" grep readonly 'quoted text' "$1" 'quoted text'
+local $(pwd) local x=1 "$@" -eu local test sed echo && echo echo then x=1
+	done done $(pwd) "$1" | readonly test readonly readonly readonly
+	"$@" 'quoted text' $(pwd) $(pwd) && "$@" --verbose echo
+echo readonly then local 2>/dev/null
+	'quoted text' /usr/bin $(pwd) "$1" done readonly local 'quoted text'
+$(pwd) | echo 2>/dev/null && "$@" "$@" "$@" echo /usr/bin | ${HOME} grep 2>/dev/null
+	done grep "$1" sed -eu done "$@" x=1 export then $(pwd) test local
+	readonly export | --verbose grep
+	readonly && grep "$@" done 'quoted text' export
+	export awk export done /usr/bin sed local cd 'quoted text' export readonly
+		x=1 then export 'quoted text' "$1" grep && x=1 printf
+awk "$1" test export --verbose && /usr/bin echo awk | -eu | then sed ${HOME}
+	'quoted text' local --verbose --verbose cd grep ${HOME} readonly
+	x=1 -eu test local "$@" test /usr/bin
+		awk local sed then readonly /usr/bin local echo 2>/dev/null
+		done | && --verbose && x=1 grep echo awk then
+	'quoted text' echo cd export echo "$@"
+	export readonly readonly grep --verbose
+sed "$@" then -eu export local printf 2>/dev/null test | "$1" -eu echo
+	done -eu grep sed then -eu /usr/bin && sed printf awk local $(pwd)
+	x=1 echo -eu | then "$1" "$1" x=1 -eu awk "$@" local sed echo echo echo
+test "$1" grep cd -eu readonly $(pwd) ${HOME}
+	-eu /usr/bin /usr/bin local echo $(pwd) printf -eu 'quoted text'
+	done ${HOME} && readonly
+		"$@" readonly test ${HOME}
+		printf then && grep x=1 done awk printf test then done /usr/bin
+	x=1 x=1 "$@" sed sed x=1 echo test -eu 'quoted text' | awk --verbose
+--verbose sed 'quoted text' done x=1 awk 'quoted text' ${HOME}
+2>/dev/null cd grep export then printf readonly awk readonly 2>/dev/null
+	printf | cd sed test 'quoted text'
+$(pwd) && $(pwd) -eu awk "$@" | echo 2>/dev/null "$@" grep
+		${HOME} | done printf -eu && "$1" | -eu export test 2>/dev/null export echo
+printf cd $(pwd) && done export cd 2>/dev/null --verbose 'quoted text'
+		x=1 "$@" then awk readonly awk export cd | export export -eu
+	&& done done test export awk awk grep cd -eu done "$1" "$@"
+	printf export sed sed -eu 'quoted text' | $(pwd)
+'quoted text' readonly test | --verbose awk /usr/bin printf
+		2>/dev/null readonly test
+then done /usr/bin $(pwd) && export -eu cd x=1 awk $(pwd) sed | grep
+	readonly && && done "$1" awk 'quoted text' $(pwd) readonly readonly local
+/usr/bin $(pwd) "$@" export
+awk | 2>/dev/null then -eu cd sed awk
+	then local printf grep ${HOME} -eu
+		-eu test /usr/bin echo ${HOME} | test echo then -eu /usr/bin then
+	awk cd then 'quoted text' sed -eu printf "$@" "$1" "$1" "$1" printf then
+--verbose export --verbose 2>/dev/null awk -eu then --verbose
+		grep cd done 2>/dev/null $(pwd) x=1 test "$@" && x=1 printf awk then done done
+	test $(pwd) && grep --verbose x=1
+readonly local 'quoted text' test export awk grep readonly
+		readonly test export test grep sed
+		'quoted text' then | "$1" ${HOME} $(pwd) cd echo | printf sed readonly
+	printf | "$@" test export ${HOME} awk /usr/bin awk /usr/bin awk readonly readonly
+		then readonly readonly ${HOME} $(pwd) awk
+${HOME} 'quoted text' && /usr/bin awk export test printf awk done
+export readonly /usr/bin printf
+		done --verbose "$@" echo "$1" echo ${HOME} awk echo grep --verbose
+| local /usr/bin ${HOME} 'quoted text' 2>/dev/null export
+		"$@" done export -eu then | |
+		echo grep "$1" && readonly cd cd local 'quoted text' 2>/dev/null
+		export -eu grep ${HOME} --verbose ${HOME} -eu $(pwd) "$1" 2>/dev/null then
+/usr/bin grep "$@" printf export cd && /usr/bin done ${HOME}
+	-eu 2>/dev/null readonly readonly 'quoted text'
+'quoted text' printf cd | grep --verbose grep done
+export export && echo 'quoted text' local | 'quoted text' /usr/bin done
+	'quoted text' then x=1 | test cd "$1" ${HOME} "$@" | echo
+		readonly printf --verbose "$1" /usr/bin
+	"$1" awk -eu && | x=1 $(pwd) grep grep sed $(pwd) -eu
+readonly 2>/dev/null grep local
+	'quoted text' printf --verbose --verbose $(pwd) echo done x=1 export | export
+		${HOME} | -eu local "$@"
+x=1 done x=1 $(pwd) local printf printf echo
+		"$1" && test 2>/dev/null x=1 -eu ${HOME} echo grep test "$1"
+		cd sed awk grep sed /usr/bin ${HOME} cd &&
+	printf x=1 awk x=1 done $(pwd) "$@" x=1 sed echo "$1" readonly 'quoted text'
+		/usr/bin "$@" grep test "$@" test awk export | then --verbose /usr/bin done x=1
+$(pwd) ${HOME} x=1 'quoted text' --verbose test 2>/dev/null | cd
+		local $(pwd) echo 2>/dev/null "$1" readonly readonly awk ${HOME} | local
+	test ${HOME} awk ${HOME} x=1 test 2>/dev/null awk test
+	$(pwd) echo then readonly 2>/dev/null -eu -eu "$1"
+export test cd then x=1 grep | cd readonly local
+		export x=1 $(pwd) ${HOME} done --verbose $(pwd) 'quoted text' /usr/bin
+readonly echo $(pwd) "$@" /usr/bin
+	then --verbose readonly printf "$@" awk 2>/dev/null
+| sed 'quoted text' /usr/bin
+	test test then test | local printf /usr/bin export sed
+		test 'quoted text' --verbose x=1 ${HOME} cd && grep then then
+		local printf 2>/dev/null local local x=1
+/usr/bin 2>/dev/null 2>/dev/null export printf echo awk
+		then then grep sed ${HOME} && 'quoted text' 'quoted text' cd awk done 'quoted text'
+	test test awk readonly readonly readonly --verbose /usr/bin local
+		export x=1 ${HOME} x=1
+		sed readonly local export | 'quoted text' 2>/dev/null
+	"$@" done test | "$1" "$@" && then awk --verbose
+"$@" $(pwd) printf /usr/bin "$@" && 'quoted text' echo
+"$@" 2>/dev/null sed x=1
+		done "$1" local test 'quoted text'
+local x=1 -eu x=1 2>/dev/null done done
+	grep x=1 'quoted text' echo ${HOME} "$1" 2>/dev/null
+	2>/dev/null "$1" | $(pwd) printf local
+x=1 echo echo awk /usr/bin
+	done cd local echo $(pwd) $(pwd) -eu awk
+	${HOME} sed readonly -eu awk x=1 echo done /usr/bin 2>/dev/null "$1" | 'quoted text'
+		"$@" grep awk && readonly cd awk --verbose readonly readonly 2>/dev/null
+		then readonly cd echo readonly
+	cd -eu | then local readonly ${HOME} printf ${HOME} "$@" then grep
+	2>/dev/null 2>/dev/null "$@" "$@"
+readonly --verbose | echo local /usr/bin -eu printf 'quoted text'
+2>/dev/null local 'quoted text' 2>/dev/null
+	echo 2>/dev/null local "$1" grep printf "$1"
+$(pwd) 'quoted text' "$@" ${HOME} --verbose
+test readonly -eu readonly 2>/dev/null "$@" -eu then printf
+		&& awk && printf && $(pwd)
+		x=1 echo ${HOME} readonly grep 'quoted text' export x=1 printf
+	-eu --verbose export /usr/bin echo local 'quoted text' "$1" cd local then
+	sed test done /usr/bin
+awk sed printf test --verbose $(pwd) | | 'quoted text' /usr/bin
+awk export x=1 awk --verbose 2>/dev/null readonly "$@" $(pwd) -eu echo &&
+		echo grep /usr/bin 2>/dev/null | x=1 2>/dev/null | 'quoted text' cd "$1" 2>/dev/null
+		| -eu | export readonly test 2>/dev/null done "$@" printf echo local readonly
+	/usr/bin "$@" export readonly
+	${HOME} -eu done "$1" $(pwd) then export
+$(pwd) "$1" cd printf echo readonly awk test export -eu x=1 readonly "$1"
+	| local 2>/dev/null && x=1 readonly sed sed sed -eu
+readonly sed echo $(pwd) awk "$@" 'quoted text'
+export | 'quoted text' | echo --verbose echo |
+sed local $(pwd) then $(pwd) cd | test
+	"$@" ${HOME} "$1" ${HOME} | 'quoted text'
+	echo -eu sed printf 2>/dev/null done grep cd test |
+echo export "$1" $(pwd) done echo -eu
+		done 'quoted text' "$1" printf -eu export
+printf 'quoted text' --verbose $(pwd) then /usr/bin test 2>/dev/null
+		2>/dev/null $(pwd) then sed 2>/dev/null
+		then test x=1 export printf ${HOME} then $(pwd) ${HOME} x=1 'quoted text'
+	2>/dev/null test 'quoted text' export
+		local local x=1 then awk echo sed grep -eu /usr/bin 2>/dev/null awk done
+		readonly -eu readonly 2>/dev/null
+		2>/dev/null export 2>/dev/null
+then "$1" local | "$1" done done && echo x=1 x=1 "$@"
+$(pwd) ${HOME} ${HOME} echo sed
+		"$@" export cd /usr/bin printf readonly test && /usr/bin $(pwd) test && test &&
+		grep awk | | awk -eu awk /usr/bin
+	--verbose readonly ${HOME} grep echo grep | $(pwd) | cd ${HOME} "$1" grep -eu
+done readonly 2>/dev/null "$1" readonly
+		printf x=1 awk x=1 test ${HOME} awk
+	sed grep --verbose test
+readonly export && "$@" 'quoted text' export
+	-eu local grep done export export printf "$1" "$1" 2>/dev/null 2>/dev/null
+export export | readonly readonly done then grep && grep "$1"
+	echo printf then local printf test /usr/bin ${HOME} && && local echo
+		--verbose cd sed cd --verbose ${HOME} test done /usr/bin -eu "$1" --verbose
+	done sed local "$1" "$1"
+"$1" echo done && cd x=1 then printf printf grep /usr/bin sed /usr/bin "$1"
+		printf readonly "$@" awk
+	cd done 2>/dev/null | --verbose -eu x=1 $(pwd) echo --verbose
+		&& cd 'quoted text' export awk done "$1" "$1" local "$@" x=1 'quoted text' "$1"
+		$(pwd) local done "$@"
+'quoted text' --verbose | ${HOME}
+'quoted text' && awk --verbose x=1 x=1 x=1 export
+		/usr/bin x=1 && && echo grep "$@"
+2>/dev/null then local then
+2>/dev/null awk | 2>/dev/null sed x=1 readonly 'quoted text' "$@" 2>/dev/null
+		x=1 $(pwd) printf done --verbose
+	local test && "$@" /usr/bin -eu readonly /usr/bin "$@" 'quoted text'
+		test local x=1 readonly $(pwd) "$@" 'quoted text' ${HOME} readonly awk
+'quoted text' printf && readonly
+| /usr/bin && ${HOME} then -eu $(pwd)
+		echo --verbose local | 'quoted text'
+| x=1 test && done export /usr/bin "$1" -eu then "$1" echo
+awk | then echo x=1 "$@"
+&& printf export "$@" printf | 'quoted text' "$1" $(pwd) | sed $(pwd)
+		local 'quoted text' "$1" 'quoted text' sed test
+	readonly echo then echo grep printf echo echo local
+		test then "$@" test -eu export ${HOME}
+	2>/dev/null $(pwd) | -eu $(pwd) cd "$1" done -eu export echo "$@"
+readonly local "$@" "$@" cd awk -eu "$@" 2>/dev/null test printf
+	grep readonly grep "$@" printf readonly "$@"
+printf grep "$@" /usr/bin && ${HOME} printf
+	/usr/bin | sed x=1 && local printf
+	sed sed $(pwd) $(pwd) sed sed 'quoted text' sed --verbose echo local --verbose
+$(pwd) echo export sed export "$@" 'quoted text' echo grep cd grep /usr/bin
+x=1 cd export 'quoted text' export 'quoted text' local -eu done cd test "$1" printf
+	grep local x=1 then sed done then $(pwd)
+		"$1" then grep $(pwd) sed printf $(pwd)
+		export -eu cd /usr/bin "$1" /usr/bin echo --verbose
+	done 2>/dev/null printf cd
+"$@" printf x=1 sed cd --verbose
+		"$@" x=1 test "$@" cd echo awk 'quoted text' 2>/dev/null $(pwd) cd awk sed
+	readonly sed /usr/bin done "$1" then /usr/bin && readonly sed done "$1" grep sed
+	local /usr/bin local export export "$@" /usr/bin sed
+grep | -eu --verbose readonly local && cd x=1 local
+	"$1" printf --verbose readonly readonly | readonly cd 2>/dev/null export
+	| | export sed ${HOME} readonly grep 2>/dev/null
+	${HOME} | /usr/bin export then export cd echo grep readonly
+	readonly then 2>/dev/null && 'quoted text'
+	printf -eu printf --verbose && readonly $(pwd) 'quoted text'
+		'quoted text' | | -eu /usr/bin ${HOME} x=1 cd export -eu local awk local "$@" --verbose
+		&& awk $(pwd) readonly | done && readonly ${HOME} grep done "$@" grep && $(pwd)
+		x=1 awk done && awk && then 2>/dev/null "$@" readonly grep
+${HOME} x=1 then | "$@"
+		$(pwd) ${HOME} awk echo echo 2>/dev/null 2>/dev/null sed local ${HOME} sed 2>/dev/null
+$(pwd) printf readonly readonly then 2>/dev/null test cd "$1" grep readonly | awk
+		x=1 done "$1" test x=1 test 2>/dev/null && sed --verbose
+'quoted text' "$@" && printf readonly
+	${HOME} 'quoted text' sed
+"$1" awk /usr/bin /usr/bin "$1" ${HOME} -eu echo | "$@"
+		local done local then test
+		printf $(pwd) /usr/bin done printf export
+	$(pwd) done awk sed x=1 $(pwd) | && sed awk readonly printf
+&& cd test readonly test echo | grep 2>/dev/null "$@"
+export /usr/bin readonly echo "$1" && test /usr/bin ${HOME} -eu
+	-eu then /usr/bin then then export grep readonly
+#include c204.sh
+		echo printf ${HOME} then ${HOME} cd "$@" echo | done echo
+--verbose 2>/dev/null | "$1" printf | grep
+	'quoted text' $(pwd) ${HOME} readonly -eu /usr/bin test echo
+		readonly local grep local ${HOME} "$1" grep x=1 -eu x=1 done ${HOME} test
+	sed readonly echo 2>/dev/null /usr/bin cd export
+	export -eu export x=1 readonly then x=1 ${HOME} done -eu
+		export "$1" "$1" ${HOME} test
+		printf printf readonly sed
+"$1" echo | ${HOME} done local cd cd /usr/bin grep 2>/dev/null
+		--verbose | "$@" $(pwd) x=1 export export --verbose "$1" x=1
+	x=1 echo sed "$@" -eu awk printf 'quoted text'
+awk "$1" sed grep test printf then done awk 2>/dev/null 'quoted text' -eu 2>/dev/null
+done | && then awk $(pwd) /usr/bin
+		sed "$1" ${HOME} readonly 2>/dev/null echo
+	export awk ${HOME} -eu ${HOME} /usr/bin
+		echo awk 'quoted text' then |
+export done "$@" ${HOME}
+		test echo ${HOME} "$@" readonly
+cd grep | 'quoted text'
+	$(pwd) "$1" test printf && 2>/dev/null "$1" cd $(pwd) 'quoted text'
+"$@" done ${HOME} grep sed echo $(pwd) /usr/bin test
+		cd $(pwd) then printf local readonly /usr/bin $(pwd) done grep "$@" /usr/bin
+	cd 2>/dev/null echo --verbose | --verbose --verbose grep awk readonly | export
+		export echo printf | local local "$@" sed readonly "$@" cd ${HOME}
+	$(pwd) cd export local
+		export printf export "$1" cd
+		/usr/bin cd x=1 -eu "$1" readonly awk export grep then sed then grep
+	"$1" /usr/bin "$1" && && done 'quoted text' grep 2>/dev/null sed --verbose
+		"$1" 2>/dev/null awk cd test
+${HOME} echo done local 'quoted text' grep
+		grep /usr/bin then grep grep x=1
+	grep && done ${HOME} sed awk cd cd cd then
+		2>/dev/null export 'quoted text' cd /usr/bin --verbose
+	-eu ${HOME} 2>/dev/null --verbose --verbose
+		readonly echo export local -eu 'quoted text' --verbose "$1" grep -eu x=1
+2>/dev/null printf done --verbose printf done /usr/bin awk printf && x=1 "$@" export
+	"$@" 'quoted text' cd cd ${HOME} /usr/bin && echo 'quoted text'
+		export awk "$@" 2>/dev/null 2>/dev/null -eu "$1" | | --verbose echo
+${HOME} /usr/bin ${HOME} echo $(pwd) ${HOME} "$@" sed && local then ${HOME}
+	echo $(pwd) grep "$1" readonly
+"$1" local $(pwd) done x=1 echo done --verbose cd then 2>/dev/null
+	echo $(pwd) awk 2>/dev/null echo done /usr/bin local /usr/bin && 2>/dev/null
+$(pwd) ${HOME} -eu readonly grep 'quoted text'
+	&& --verbose "$1" 2>/dev/null 'quoted text' local /usr/bin sed /usr/bin
+		test /usr/bin done sed && then grep x=1 export 'quoted text'
+"$1" x=1 $(pwd) then && -eu -eu printf
+$(pwd) export "$@" cd test $(pwd) && "$1" readonly grep "$1" grep && --verbose
+echo then --verbose then awk echo export echo done | | cd |
+sed /usr/bin "$@" "$1" 'quoted text'
+	"$@" x=1 then local "$1" awk -eu $(pwd) test awk cd /usr/bin test printf
+test $(pwd) readonly awk
+		x=1 | export "$1" echo 2>/dev/null printf x=1 /usr/bin "$1" "$@" "$1" printf --verbose
+then printf printf 'quoted text' "$@" && local /usr/bin local cd && && then
+	printf --verbose then printf local --verbose then then sed ${HOME}
+	awk "$1" | | | -eu 'quoted text' x=1 -eu readonly printf
+${HOME} cd $(pwd) done --verbose
+grep -eu x=1 && | then "$1" export awk
+	| /usr/bin test test echo 'quoted text' --verbose local export
+		x=1 | awk 'quoted text' $(pwd)
+--verbose | sed | $(pwd) "$@" test "$@" local -eu ${HOME} /usr/bin done sed
+		cd -eu --verbose cd awk 'quoted text' printf then 2>/dev/null
+cd export ${HOME} "$1"
+--verbose && cd ${HOME}
+"$@" local test | cd cd test "$@" readonly printf done $(pwd) && then | "$1" export
+		| test /usr/bin /usr/bin readonly printf local | && | printf
+then ${HOME} 2>/dev/null sed "$1"
+	-eu printf cd x=1 'quoted text' grep 'quoted text' awk $(pwd) local readonly
+	awk 2>/dev/null export export cd --verbose | "$1" then | printf then
+	"$@" --verbose awk grep | sed $(pwd)
+		local awk 'quoted text' 2>/dev/null test awk echo cd "$@" test export
+	test && /usr/bin grep ${HOME} echo cd --verbose
+test 2>/dev/null --verbose -eu $(pwd) -eu --verbose -eu
+		--verbose test awk test /usr/bin done ${HOME} -eu 'quoted text' ${HOME}
+| && local $(pwd) grep ${HOME} "$@" && readonly --verbose x=1 printf test /usr/bin
+		-eu && done cd then export readonly x=1 'quoted text'
+then done $(pwd) test $(pwd) then echo -eu test cd cd sed then $(pwd) grep done
+| | then awk --verbose export then then ${HOME} x=1 "$@" grep export awk done
+		then 2>/dev/null x=1 export && x=1 "$1" awk awk sed "$@" | sed done "$1"
+export then $(pwd) readonly awk test export "$1" "$1" ${HOME} -eu cd sed x=1 |
+	--verbose done test 2>/dev/null
+	"$@" 2>/dev/null cd done
+		${HOME} readonly then printf sed 'quoted text' test grep
+x=1 readonly then 2>/dev/null
+	--verbose awk cd "$@" then sed printf -eu export x=1 "$@" -eu test done echo
+		awk test | x=1 x=1 && /usr/bin done local grep readonly
+	echo test echo $(pwd) cd test ${HOME} grep test export
+		cd test x=1 "$1" test 2>/dev/null 'quoted text' readonly $(pwd)
+		cd done readonly grep --verbose "$@" sed --verbose echo ${HOME} "$@" local
+${HOME} then --verbose 'quoted text' awk printf
+	'quoted text' 2>/dev/null sed -eu test then local x=1 cd --verbose sed printf
+	| x=1 $(pwd) grep cd readonly sed 'quoted text' /usr/bin echo $(pwd) "$@" -eu
+		"$@" grep "$1" awk then -eu $(pwd) sed x=1 test export ${HOME} "$1" export
+		--verbose awk awk $(pwd) $(pwd) -eu
+		done cd | 2>/dev/null --verbose && awk --verbose
+	/usr/bin /usr/bin awk echo local readonly /usr/bin ${HOME} ${HOME} x=1
+	done grep x=1 local "$@" "$@" grep echo 'quoted text'
+	${HOME} -eu export printf sed -eu
+		local local done "$1" --verbose -eu sed readonly awk grep awk
+cd /usr/bin /usr/bin "$1" 'quoted text' grep awk awk awk export -eu /usr/bin &&
+		grep local local && /usr/bin ${HOME} 'quoted text' test "$@" 2>/dev/null export
+		'quoted text' local $(pwd) 'quoted text'
+		export $(pwd) awk ${HOME} $(pwd) 'quoted text' sed $(pwd)
+		awk x=1 | test echo /usr/bin "$1" -eu 2>/dev/null 'quoted text'
+		export awk cd -eu -eu test then "$1" | test then printf echo /usr/bin done 2>/dev/null
+	echo x=1 "$@" awk then "$1" -eu
+readonly 'quoted text' 2>/dev/null --verbose 'quoted text'
+	--verbose $(pwd) x=1 x=1 sed test -eu sed printf cd && export then
+	sed "$@" done grep then local
+	awk $(pwd) x=1 export -eu then ${HOME} local $(pwd) "$1" cd
+		grep x=1 "$@" done 2>/dev/null
+		then awk -eu echo --verbose then --verbose echo export local echo | cd -eu
+	"$1" then ${HOME} 2>/dev/null done "$1" local grep "$@" -eu printf
+	test awk export printf awk grep
+	done readonly cd grep
+awk -eu test echo grep /usr/bin test -eu && printf "$@" local
+	export $(pwd) /usr/bin then "$1" awk local x=1
+x=1 /usr/bin | cd 2>/dev/null "$1" sed export
+		"$1" test readonly then grep done echo export done done ${HOME} done
+		/usr/bin done echo "$@" -eu printf readonly x=1 "$@"
+sed test -eu | 2>/dev/null 'quoted text' done x=1 $(pwd) | grep 'quoted text'
+		local | ${HOME} test 'quoted text' $(pwd) grep "$1"
+	readonly 'quoted text'
+then /usr/bin local ${HOME} sed test 'quoted text' export 'quoted text'
+	awk --verbose /usr/bin sed ${HOME} done "$@" 2>/dev/null export 2>/dev/null --verbose
+		echo echo export && 2>/dev/null printf done 'quoted text' x=1 ${HOME}
+	then export local 'quoted text' "$1" cd && 2>/dev/null done cd /usr/bin
+	$(pwd) | export sed x=1 -eu sed done local test && test readonly x=1 printf ${HOME}
+"$@" $(pwd) sed readonly local 2>/dev/null local cd /usr/bin local
+"$@" awk grep && $(pwd) --verbose --verbose $(pwd) then 2>/dev/null
+		2>/dev/null then -eu sed test ${HOME} && test "$1" 2>/dev/null "$1" --verbose
+		echo done done ${HOME} grep local | readonly && cd 2>/dev/null sed local
+awk printf /usr/bin /usr/bin readonly 2>/dev/null cd printf /usr/bin
+		sed /usr/bin grep 'quoted text' then -eu test
+	awk ${HOME} && local then | awk awk -eu | printf $(pwd) x=1 x=1 done --verbose
+		awk 2>/dev/null 'quoted text' export echo test --verbose echo sed done sed
+		$(pwd) echo awk -eu "$1" printf sed readonly
+	2>/dev/null sed export echo 'quoted text' && printf export
+		&& echo readonly test readonly --verbose awk awk 'quoted text' grep -eu
+export /usr/bin sed printf sed /usr/bin 2>/dev/null
+-eu test printf 'quoted text'
+		export readonly 2>/dev/null test cd cd /usr/bin /usr/bin ${HOME}
+	"$@" export --verbose
+	then "$@" "$1" cd export $(pwd) x=1 printf 2>/dev/null | x=1 "$@" awk
+local && then readonly cd 2>/dev/null /usr/bin printf /usr/bin readonly grep
+then then cd local x=1 $(pwd) test ${HOME} ${HOME} done echo awk -eu done
+		'quoted text' export echo awk echo export awk "$1" --verbose awk then $(pwd)
+	"$@" printf echo -eu "$1" cd $(pwd) ${HOME} awk awk grep 2>/dev/null
+		cd -eu printf printf 2>/dev/null local 2>/dev/null $(pwd) export 2>/dev/null sed
+	"$@" printf sed ${HOME} readonly readonly done --verbose $(pwd) export
+		"$1" cd readonly --verbose echo awk 2>/dev/null |
+		local ${HOME} readonly -eu
+		--verbose --verbose grep grep x=1 printf
+x=1 sed 'quoted text' printf printf export local cd "$@"
+${HOME} test -eu ${HOME} test cd test 2>/dev/null "$1" | ${HOME} ${HOME}
+	"$1" export awk -eu "$@" grep echo echo 'quoted text' --verbose
+x=1 export printf echo then local then -eu ${HOME} sed
+		done test grep export ${HOME}
+		awk echo then ${HOME} local test 2>/dev/null cd awk /usr/bin "$1" done sed sed
+		x=1 cd sed ${HOME} 2>/dev/null | /usr/bin $(pwd) | --verbose && local
+| && 2>/dev/null "$1" "$1" x=1 && awk then test
+		sed && test && test then "$@" "$1" sed "$@"
+${HOME} sed -eu | "$1" cd x=1 export "$1" ${HOME} | cd /usr/bin x=1 $(pwd)
+		| echo ${HOME} x=1 2>/dev/null
+	--verbose cd | 'quoted text' ${HOME}
+	-eu "$@" export x=1 done $(pwd) cd -eu then 2>/dev/null echo printf
+local 2>/dev/null echo 2>/dev/null export x=1 echo --verbose
+printf $(pwd) awk sed /usr/bin done
+	| readonly cd then 2>/dev/null
+done local echo then done readonly -eu ${HOME} && cd "$1" test local 'quoted text'
+		--verbose sed awk cd 2>/dev/null --verbose --verbose 'quoted text' -eu 2>/dev/null
+		printf done && ${HOME} awk /usr/bin | /usr/bin && $(pwd)
+	'quoted text' readonly | /usr/bin -eu --verbose 'quoted text' awk
+	printf 'quoted text' printf "$1" cd --verbose printf readonly ${HOME} grep echo
+	sed "$1" local ${HOME} readonly x=1 x=1 "$@" sed | ${HOME} export
+done -eu export done 'quoted text'
+	readonly local 'quoted text' printf "$@" grep x=1 local
+awk "$1" 2>/dev/null | local awk -eu export "$@" then ${HOME}
+local echo -eu /usr/bin sed "$1" export | "$@"
+	"$1" then /usr/bin 'quoted text' printf
+	/usr/bin echo printf /usr/bin test -eu export --verbose |
+		done /usr/bin ${HOME} | printf cd grep then --verbose then ${HOME} 2>/dev/null
+	test done local 2>/dev/null
+	printf test readonly test cd $(pwd) 2>/dev/null 'quoted text' "$1"
+		export readonly | cd "$1" ${HOME} test printf | sed && done sed printf
+	grep test "$1" && done printf
+| 'quoted text' grep ${HOME} printf --verbose echo x=1 test 2>/dev/null
+/usr/bin $(pwd) | echo $(pwd) $(pwd) awk &&
+readonly | cd "$@" sed printf cd grep "$1" echo -eu && export --verbose printf grep
+--verbose done -eu x=1 sed cd $(pwd) $(pwd) $(pwd) $(pwd) cd /usr/bin
+'quoted text' 'quoted text' | 'quoted text'
+x=1 local -eu local done "$1"
+--verbose grep "$@" readonly /usr/bin then --verbose test
+		2>/dev/null ${HOME} "$@" printf /usr/bin 2>/dev/null export $(pwd)
+export "$@" readonly readonly x=1 'quoted text' 2>/dev/null sed $(pwd)
+	printf "$@" x=1 printf cd test export export sed ${HOME} grep grep | x=1
+		export ${HOME} sed done 2>/dev/null readonly && printf
+grep --verbose local readonly printf 'quoted text' "$1" ${HOME} done
+	&& printf 'quoted text' done | cd awk local cd readonly export ${HOME}
+	${HOME} cd x=1 local -eu echo -eu local "$@" echo "$1" && test $(pwd) awk
+	&& /usr/bin | then ${HOME} ${HOME} done "$@"
+	grep ${HOME} cd ${HOME} "$@" 'quoted text' cd grep /usr/bin
+	| --verbose done 'quoted text' && /usr/bin 'quoted text'
+	'quoted text' ${HOME} -eu sed "$@" --verbose
+	-eu x=1 local 'quoted text' && test local
+		$(pwd) then "$@" 2>/dev/null | awk --verbose
+	awk done "$@" -eu local sed awk /usr/bin grep 'quoted text'
+export | x=1 test "$1" 2>/dev/null
+-eu x=1 ${HOME} readonly "$1" $(pwd) done
+		test test "$@" done /usr/bin cd awk --verbose x=1 printf ${HOME} readonly x=1
+echo ${HOME} sed awk sed awk
+		readonly grep 'quoted text' $(pwd)
+		x=1 x=1 /usr/bin test x=1 'quoted text' done "$@" test cd sed awk | 'quoted text'
+		"$1" 'quoted text' && local /usr/bin -eu local cd -eu then &&
+	cd && printf readonly /usr/bin
+"$1" test x=1 x=1 export cd 'quoted text' ${HOME} 2>/dev/null
+	export cd x=1 grep | /usr/bin
+then | local done --verbose echo echo awk
+	$(pwd) export --verbose local readonly
+	x=1 && then "$1" x=1 done readonly ${HOME} then then export -eu export awk local
+		grep local export export /usr/bin
+		-eu readonly cd "$@" ${HOME} /usr/bin test $(pwd) sed
+	cd ${HOME} then local 2>/dev/null
+"$1" printf $(pwd) "$1" --verbose $(pwd) local "$@" --verbose test sed grep
+	export "$@" x=1 && awk "$@" 'quoted text' export printf ${HOME} local
+		| readonly then ${HOME} --verbose $(pwd) awk 2>/dev/null awk $(pwd) grep -eu /usr/bin
+		local ${HOME} 'quoted text'
+		cd sed "$@" readonly $(pwd) awk "$@" ${HOME} -eu readonly
+		'quoted text' readonly 'quoted text' x=1 cd export printf /usr/bin -eu "$1" "$1"
+sed ${HOME} --verbose ${HOME} $(pwd) /usr/bin && done $(pwd) "$@" export
+	cd then then "$1" then then sed readonly
+		"$1" awk $(pwd) local grep then echo local "$1" -eu |
+	done 'quoted text' then "$@"
+	sed readonly echo $(pwd) sed done && "$@" then local
+		local && export sed x=1 'quoted text' | sed "$1"
+x=1 ${HOME} done sed local | 2>/dev/null awk "$1" local -eu "$1" $(pwd)
+	"$@" test awk printf $(pwd) | && $(pwd) awk ${HOME} export test
+		printf cd /usr/bin sed local grep --verbose grep grep --verbose && | printf
+		local cd sed readonly
+	sed | ${HOME} 2>/dev/null local
+		/usr/bin grep ${HOME} && cd readonly | printf --verbose
+"$1" export x=1 local printf export ${HOME} sed
+	/usr/bin /usr/bin $(pwd) -eu export printf done ${HOME} --verbose -eu "$@"
+echo done "$@" | "$1" 2>/dev/null "$@" readonly printf grep | sed
+		"$@" cd sed ${HOME} export ${HOME}
+	printf then sed x=1 local cd "$@" grep -eu && "$1" echo
+	sed "$@" then printf sed grep sed awk ${HOME}
+local sed "$@" ${HOME} | /usr/bin then /usr/bin
+		2>/dev/null 2>/dev/null 2>/dev/null export /usr/bin
+		$(pwd) cd 2>/dev/null echo $(pwd)
+	$(pwd) "$1" x=1 2>/dev/null --verbose
+	readonly | "$@" "$1" readonly sed && --verbose
+		local ${HOME} --verbose $(pwd) "$@" ${HOME} readonly
+		printf "$1" 'quoted text' -eu readonly 'quoted text' local echo "$1" printf export
+	"$@" readonly grep then test test /usr/bin printf "$1" $(pwd)
+	done echo awk echo test then 2>/dev/null "$1"
+	| -eu cd "$1" grep ${HOME} | | ${HOME} awk
+		then -eu ${HOME} sed then 'quoted text' "$@" then
+printf x=1 grep then grep
+	x=1 $(pwd) ${HOME} 'quoted text' sed -eu readonly --verbose export && /usr/bin
+	'quoted text' 2>/dev/null done echo 2>/dev/null ${HOME} echo readonly readonly
+	"$1" --verbose grep echo local cd -eu echo sed x=1 cd "$@" x=1 local
+${HOME} 2>/dev/null grep test sed "$1" "$1" && awk /usr/bin ${HOME} echo
+	'quoted text' "$@" ${HOME} cd $(pwd) x=1 awk ${HOME} ${HOME} test 2>/dev/null
+&& | "$1" /usr/bin --verbose 'quoted text'
+		done awk $(pwd) then x=1 "$@" sed 'quoted text'
+		'quoted text' readonly x=1 -eu local 2>/dev/null printf 'quoted text' | printf
+		done && local ${HOME} 'quoted text'
+	export done | export export --verbose test test -eu
+	readonly local test awk x=1 2>/dev/null
+	${HOME} x=1 -eu "$@" export $(pwd) echo awk awk
+	$(pwd) echo ${HOME} -eu && | export "$@"
+sed done x=1 2>/dev/null cd 'quoted text' grep readonly 'quoted text'
+	test 2>/dev/null --verbose "$1" done
+		then done grep -eu grep && printf grep
+		2>/dev/null $(pwd) 'quoted text' 2>/dev/null | test && done printf
+		local --verbose ${HOME} 'quoted text' test cd export x=1 done printf test &&
+--verbose local export echo sed -eu && sed $(pwd)
+		sed 'quoted text' x=1 x=1 readonly
+awk then export "$@" && echo done --verbose done
+	cd done done -eu --verbose -eu export export readonly cd done test
+	grep printf test 2>/dev/null 2>/dev/null printf test | test ${HOME}
+	cd 2>/dev/null "$1" awk done $(pwd) $(pwd)
+	printf && "$1" "$1" echo then cd readonly cd && then
+--verbose --verbose grep export test cd 2>/dev/null "$1" cd
+	| echo sed local readonly ${HOME} x=1 echo then ${HOME}
+		x=1 2>/dev/null sed --verbose cd 2>/dev/null | test ${HOME}
+2>/dev/null then | /usr/bin local 'quoted text'
+		$(pwd) && cd /usr/bin 2>/dev/null export sed done
+		echo sed -eu && --verbose
+		export 2>/dev/null /usr/bin /usr/bin grep
+grep cd | test awk && sed readonly "$@" $(pwd) "$1"
+	$(pwd) $(pwd) printf readonly export
+	echo readonly "$@" readonly "$1" sed 2>/dev/null done readonly "$1"
+		$(pwd) ${HOME} x=1 -eu
+	x=1 awk awk && 'quoted text'
+test awk /usr/bin | local /usr/bin 'quoted text' done grep --verbose done &&
+	/usr/bin | --verbose $(pwd) && printf printf grep
+		awk ${HOME} export 'quoted text' awk /usr/bin export
+		"$1" cd $(pwd) $(pwd) sed export grep $(pwd) sed
+grep readonly ${HOME} export 'quoted text' 2>/dev/null
+then sed local /usr/bin x=1 "$@" ${HOME} local echo grep
+cd "$@" "$@" sed 2>/dev/null ${HOME} && done x=1
+	then printf cd awk 'quoted text' ${HOME} export && echo printf
+local "$@" $(pwd) local 2>/dev/null --verbose
+	--verbose /usr/bin -eu cd ${HOME} awk x=1 printf sed
+	'quoted text' -eu "$1" ${HOME} "$1" 'quoted text' printf -eu done
+		grep grep sed grep cd echo printf done
+	echo test "$1" readonly /usr/bin printf
+${HOME} cd printf grep printf ${HOME} local
+grep $(pwd) echo sed echo cd -eu | && x=1 $(pwd) readonly
+	echo --verbose done x=1 --verbose x=1 2>/dev/null
+	export $(pwd) export x=1 grep "$1" awk --verbose x=1 x=1 "$@" 'quoted text'
+		awk test && test && grep ${HOME} printf --verbose
+	-eu then && local x=1 sed 'quoted text' &&
+		"$@" done done printf readonly -eu echo done && echo --verbose && x=1 'quoted text'
+--verbose "$1" awk awk $(pwd) --verbose local ${HOME} cd "$1" then --verbose
+		test $(pwd) "$1" then "$@" cd sed 'quoted text' 2>/dev/null
+local export --verbose
+		"$@" export 2>/dev/null 2>/dev/null sed export "$1" cd then done
+		&& printf sed export printf then test "$@" done ${HOME} x=1 "$@" | /usr/bin sed
+echo --verbose | 'quoted text' --verbose grep then grep
+&& "$1" x=1 2>/dev/null export 'quoted text' ${HOME} x=1 then
+| $(pwd) local test $(pwd) | local awk $(pwd) --verbose test
+then /usr/bin ${HOME} export grep
+		$(pwd) $(pwd) "$1" sed 'quoted text' local $(pwd) local 'quoted text'
+	&& sed 2>/dev/null $(pwd) then cd && "$1" && readonly done -eu x=1 printf 'quoted text'
+		local then echo --verbose "$@" grep cd then --verbose | sed --verbose --verbose
+	echo cd sed 'quoted text' | printf ${HOME} readonly 'quoted text'
+	2>/dev/null $(pwd) "$1" readonly sed test 2>/dev/null awk "$1" readonly 'quoted text'
+printf "$1" grep grep printf -eu awk export test ${HOME}
+printf local readonly test ${HOME}
+cd readonly --verbose grep "$1" readonly readonly
+		'quoted text' x=1 sed -eu -eu 'quoted text' --verbose "$@" export &&
+		test local --verbose export
+	export cd readonly "$@" --verbose local ${HOME} done -eu echo
+sed local 2>/dev/null readonly | export awk /usr/bin cd 'quoted text'
+"$1" 2>/dev/null 'quoted text' then x=1
+	/usr/bin && | 2>/dev/null
+	"$1" "$@" printf export printf export awk local cd sed
+		export grep 'quoted text' readonly
+		sed "$1" printf -eu readonly local x=1 done readonly
+2>/dev/null then then awk awk done -eu test readonly cd "$1" sed sed local &&
+		${HOME} $(pwd) -eu "$1" ${HOME} cd grep grep && test ${HOME} readonly -eu |
+	awk | readonly sed printf 'quoted text' then echo cd x=1 ${HOME}
+		export --verbose "$@" ${HOME} grep
+	/usr/bin 'quoted text' grep $(pwd) | then
+awk 'quoted text' sed cd test local "$@" sed then
+sed ${HOME} $(pwd) | done "$1" test | grep test local then ${HOME}
+		2>/dev/null printf grep 2>/dev/null sed
+export sed awk awk ${HOME}
+	local done "$1" export 2>/dev/null | 2>/dev/null grep local test
+		done printf local 'quoted text' --verbose export
+'quoted text' "$@" && ${HOME} 'quoted text' "$1" && readonly then done x=1
+grep $(pwd) --verbose grep $(pwd) | 'quoted text'
+	printf $(pwd) local x=1 then
+		export then ${HOME} 2>/dev/null echo -eu | export export | "$1" x=1 ${HOME}
+		echo 'quoted text' 2>/dev/null readonly "$1" ${HOME}
+then && -eu export x=1 "$1" cd readonly awk printf /usr/bin echo done
+		readonly then grep 2>/dev/null --verbose done 2>/dev/null /usr/bin | awk readonly
+&& $(pwd) "$1" "$1" export "$@" --verbose test test cd 2>/dev/null
+local grep awk echo -eu sed --verbose
+local local done && test x=1 2>/dev/null --verbose
+	--verbose $(pwd) /usr/bin awk | printf readonly /usr/bin "$1" && "$@"
+sed readonly echo test export
+		printf --verbose ${HOME} cd cd sed "$1" && then "$1" 2>/dev/null
+		sed ${HOME} grep grep export
+readonly | printf export 'quoted text' && export 2>/dev/null
+		grep ${HOME} then && then echo cd "$1" sed ${HOME} echo export --verbose done
+	/usr/bin /usr/bin "$@" done
+	local && /usr/bin test $(pwd) export printf 2>/dev/null "$1"
+/usr/bin /usr/bin readonly sed "$@" "$@" |
+	$(pwd) export local $(pwd) echo 2>/dev/null 2>/dev/null && export
+		awk --verbose -eu readonly
+'quoted text' 2>/dev/null local "$@" "$1" done readonly "$1" local printf grep
+	local /usr/bin && export $(pwd) readonly | done "$@" export readonly ${HOME}
+	test ${HOME} awk $(pwd) | printf | /usr/bin
+		awk "$1" test grep echo x=1 "$@" $(pwd) /usr/bin "$@" /usr/bin
+	'quoted text' $(pwd) 'quoted text' && echo done
+		2>/dev/null "$1" 'quoted text' sed 2>/dev/null
+		awk $(pwd) done printf "$@" printf $(pwd) export export
+done ${HOME} /usr/bin readonly readonly awk readonly sed x=1 x=1 --verbose
+		-eu export | echo cd readonly
+cd printf awk /usr/bin /usr/bin sed && cd sed 2>/dev/null test $(pwd)
+x=1 | 2>/dev/null export cd local cd awk 'quoted text' ${HOME} && 'quoted text'
+echo readonly $(pwd) printf --verbose printf echo x=1
+	&& grep printf done cd ${HOME} then
+		/usr/bin grep export done
+&& printf test | /usr/bin export sed 'quoted text'
+	x=1 | 2>/dev/null readonly awk grep readonly
+		awk awk readonly $(pwd) x=1 then sed && 2>/dev/null
+	grep "$1" "$1" 'quoted text' readonly "$1" echo /usr/bin
+x=1 done -eu printf 'quoted text' 2>/dev/null printf $(pwd) 2>/dev/null then
+	| -eu 'quoted text' ${HOME}
+		export sed then sed then -eu -eu grep readonly done local echo export
+	${HOME} done awk export grep awk readonly
+		awk $(pwd) then sed && grep |
+	-eu test awk test awk then test awk export local printf 2>/dev/null
+	"$@" sed "$@" $(pwd) 'quoted text' awk done ${HOME} && cd local
+		test echo then export
+| then && export 'quoted text'
+"$@" $(pwd) sed 2>/dev/null /usr/bin awk echo printf --verbose x=1 echo then
+-eu done export local 'quoted text' readonly
+		cd -eu -eu | cd readonly grep ${HOME}
+		readonly | printf x=1
+echo readonly readonly local then readonly
+	done --verbose x=1 echo "$@" echo /usr/bin /usr/bin
+grep 2>/dev/null "$1" done x=1 ${HOME} -eu
+	2>/dev/null local "$1" $(pwd) printf readonly --verbose x=1
+printf ${HOME} 'quoted text'
+	done sed then echo | local | /usr/bin "$1"
+		"$1" grep echo printf local done export $(pwd) x=1 printf echo printf
+/usr/bin | && sed cd printf cd cd "$1" 'quoted text'
+cd sed readonly | /usr/bin "$1" echo cd "$1" echo "$1" test | 2>/dev/null x=1
+		then sed done printf 2>/dev/null test cd 'quoted text' --verbose sed
+		--verbose local then "$1" test then /usr/bin printf test
+	x=1 'quoted text' local echo && -eu local
+	x=1 awk export ${HOME} && then local && local x=1 $(pwd) test sed export
+		export -eu export test --verbose cd local local
+	export | ${HOME} ${HOME} "$1" --verbose x=1 done awk echo
+${HOME} grep readonly && grep
+		cd --verbose -eu echo
+awk $(pwd) 2>/dev/null | sed
+${HOME} done printf test export printf echo sed cd
+-eu printf printf done then sed cd cd -eu /usr/bin echo grep awk 'quoted text'
+/usr/bin echo then test 2>/dev/null && export
+	"$1" /usr/bin awk 2>/dev/null grep cd x=1 $(pwd) 'quoted text'
+	awk | --verbose awk cd readonly "$@" awk && "$@"
+done grep "$@" done grep cd local grep ${HOME} done
+	${HOME} sed test -eu $(pwd) then printf sed
+$(pwd) -eu "$1" --verbose -eu $(pwd) $(pwd) x=1 /usr/bin | /usr/bin 2>/dev/null
+printf then x=1 cd 'quoted text' | cd --verbose readonly sed && echo done
+-eu local cd cd 2>/dev/null then -eu awk --verbose done && echo sed
+		x=1 then then done export $(pwd) test done export x=1
+test echo | 2>/dev/null /usr/bin export /usr/bin 'quoted text' echo /usr/bin
+		export "$1" | done 'quoted text' sed --verbose $(pwd) printf readonly awk then printf
+		cd done printf awk echo awk "$1" readonly 'quoted text'
+	$(pwd) $(pwd) 2>/dev/null local 2>/dev/null sed sed --verbose x=1 sed done
+		export && && printf $(pwd) x=1 export
+	echo | readonly /usr/bin "$1" readonly then $(pwd)
+then readonly 2>/dev/null -eu --verbose echo printf awk && printf echo test
+	then echo -eu printf grep printf 2>/dev/null "$1" sed x=1 awk grep local printf
+'quoted text' 'quoted text'
+		local export | /usr/bin && 'quoted text' ${HOME} /usr/bin /usr/bin
+printf ${HOME} -eu -eu test | test cd $(pwd)
+		printf | echo sed && 2>/dev/null printf then awk && echo echo
+		/usr/bin readonly echo cd readonly sed "$1" echo -eu done sed done --verbose
+local awk cd done readonly 'quoted text' grep
+local test sed export && readonly
+	"$1" "$1" "$1" test printf cd 2>/dev/null "$1" $(pwd) x=1 grep cd sed | 'quoted text'
+	grep $(pwd) /usr/bin sed sed 2>/dev/null -eu 2>/dev/null
+"$@" cd "$@" then /usr/bin --verbose "$1" "$@" && then then then echo "$1" "$@"
+'quoted text' local 'quoted text' | /usr/bin awk &&
+grep test sed printf cd ${HOME} | grep then
+		x=1 done "$@" 2>/dev/null --verbose test echo ${HOME} printf grep
+	printf readonly sed done $(pwd) printf --verbose $(pwd) 2>/dev/null
+"$@" x=1 sed echo awk && echo printf 'quoted text' readonly export --verbose
+		${HOME} grep sed done ${HOME} && cd
+local --verbose && test
+	then printf && test 'quoted text'
+	$(pwd) awk && | x=1 echo "$1" 'quoted text' sed x=1 ${HOME} 'quoted text'
+awk -eu then -eu x=1 'quoted text'
+	${HOME} /usr/bin | "$@" local -eu echo ${HOME} 'quoted text' cd done
+	"$@" awk "$1" $(pwd) grep && printf /usr/bin
+	--verbose echo done awk awk $(pwd) --verbose test "$1" cd "$@" sed -eu 'quoted text'
+echo readonly --verbose export local $(pwd) export test
+printf 'quoted text' x=1 awk /usr/bin done export test grep $(pwd)
+		2>/dev/null export "$1"
+		grep "$@" then local grep /usr/bin /usr/bin cd export test "$@" export x=1
+-eu sed local cd done "$1" $(pwd) "$1" echo &&
+		/usr/bin done ${HOME} printf export
+	| sed && readonly 'quoted text' printf $(pwd) $(pwd) --verbose then
+-eu printf x=1 test cd awk 'quoted text' grep | export test test printf sed
+echo then test && export x=1 printf $(pwd) x=1 --verbose 2>/dev/null x=1
+echo local "$@" cd echo awk grep awk done && 2>/dev/null
+cd export 2>/dev/null --verbose "$@" cd grep | x=1 echo echo
+	echo cd -eu x=1 printf ${HOME} && done
+	readonly 'quoted text' $(pwd) readonly
+	$(pwd) awk --verbose ${HOME} printf then done awk grep export done --verbose
+	cd ${HOME} --verbose cd cd then | then printf done export awk sed local test
+$(pwd) && then "$@" readonly | $(pwd) $(pwd) local 2>/dev/null then export --verbose
+	-eu sed "$1" readonly readonly printf
+	export 'quoted text' -eu ${HOME} echo readonly local $(pwd) 2>/dev/null
+	sed x=1 -eu test sed | "$1" $(pwd) -eu sed done sed -eu
+	/usr/bin x=1 echo sed --verbose x=1 sed grep "$@"
+		x=1 done "$1" readonly then local grep $(pwd)
+		-eu cd --verbose readonly printf --verbose
+		then --verbose 'quoted text' "$1"
+	awk x=1 --verbose | echo echo $(pwd) echo
+		| 2>/dev/null ${HOME} test readonly "$@" export && x=1 "$1" echo ${HOME} readonly
+--verbose "$@" "$@" && sed $(pwd) "$1" && x=1 sed | export
+awk cd readonly x=1 then test grep ${HOME} | 'quoted text'
+local export cd "$1" --verbose 2>/dev/null sed -eu grep ${HOME} awk | sed
+		readonly awk done --verbose /usr/bin cd
+		export done echo awk readonly x=1 $(pwd) 2>/dev/null
+	local "$@" "$@" readonly done x=1 awk sed done && sed grep
+		'quoted text' ${HOME} 2>/dev/null && done && /usr/bin
+		2>/dev/null grep 'quoted text' cd /usr/bin then readonly
+${HOME} 'quoted text' test export | local readonly test "$1" grep export
+"$@" $(pwd) echo "$@" | grep /usr/bin "$@" echo --verbose -eu test && -eu awk cd
+		grep x=1 test done cd "$1" | done cd 2>/dev/null | && readonly
+echo local "$@" 'quoted text'
+"$1" && readonly --verbose printf $(pwd) awk awk ${HOME} && grep "$1" test cd /usr/bin
+		| done $(pwd) test local x=1 2>/dev/null done 2>/dev/null echo ${HOME}
+		cd export cd printf then grep 2>/dev/null
+local "$1" grep --verbose grep done /usr/bin
+done sed /usr/bin echo readonly 'quoted text'
+	x=1 -eu /usr/bin export | test export readonly echo /usr/bin grep
+	cd export echo echo then
+	x=1 sed ${HOME} --verbose export then test cd && done --verbose
+		${HOME} export "$@" grep x=1 | grep test -eu && -eu grep local "$@" -eu /usr/bin
+		-eu "$@" 2>/dev/null echo export sed && then then done ${HOME} test
+sed grep 'quoted text' | | 2>/dev/null -eu sed local
+test "$1" -eu "$1" | cd grep local | "$@" $(pwd) test -eu -eu
+	readonly ${HOME} done 2>/dev/null | local -eu
+	export awk | --verbose $(pwd) /usr/bin echo grep cd awk test /usr/bin
+	sed readonly grep 2>/dev/null --verbose
+	grep /usr/bin printf export done 2>/dev/null 2>/dev/null ${HOME} ${HOME} cd
+"$@" 2>/dev/null echo awk printf "$@" ${HOME}
+	test x=1 -eu echo sed | cd sed awk ${HOME}
+cd local --verbose && 'quoted text'
+	local done export 'quoted text' 'quoted text'
+		-eu export awk 'quoted text' -eu ${HOME} 'quoted text' "$@" ${HOME}
+	"$@" && readonly printf echo --verbose | ${HOME} awk x=1
+| awk grep readonly 'quoted text' readonly && test printf "$1" test "$@" "$1" printf
+		then sed "$@" /usr/bin /usr/bin "$@" sed
+readonly grep done export test ${HOME} $(pwd) -eu awk && $(pwd)
+awk awk export x=1 echo -eu "$1" local echo sed "$1" grep 'quoted text'
+		/usr/bin --verbose test 2>/dev/null "$@" local | --verbose awk x=1 then
+		--verbose x=1 done export $(pwd) export readonly
+		${HOME} grep | /usr/bin local then echo /usr/bin "$1" printf --verbose "$1"
+		$(pwd) ${HOME} sed local awk /usr/bin /usr/bin echo
+		done 'quoted text' echo | /usr/bin grep 'quoted text'
+done 2>/dev/null ${HOME} local $(pwd)
+| echo ${HOME} | then 'quoted text' | 2>/dev/null
+2>/dev/null grep test export test
+"$1" 2>/dev/null local readonly then && /usr/bin then /usr/bin "$@" --verbose
+	cd sed 'quoted text' && $(pwd) cd grep --verbose readonly
+	/usr/bin 'quoted text' readonly readonly test
+	cd "$@" sed then done --verbose 2>/dev/null test
+	-eu awk -eu "$@" done -eu sed --verbose
+"$@" sed printf "$1" test "$1" 'quoted text' ${HOME} ${HOME} test readonly ${HOME}
+		awk -eu 'quoted text' printf
+	x=1 grep done test && ${HOME} ${HOME} 2>/dev/null 'quoted text' cd 'quoted text'
+		grep --verbose x=1 x=1 x=1 readonly x=1
+${HOME} test 'quoted text'
+	'quoted text' awk "$@" echo --verbose | sed && /usr/bin --verbose x=1
+		"$1" -eu ${HOME} printf -eu 'quoted text' done ${HOME} x=1 | "$@"
+		"$1" readonly test export then printf
+then test --verbose awk then && awk cd x=1
+"$1" 2>/dev/null cd && --verbose 2>/dev/null 2>/dev/null -eu test
+		export cd printf awk done grep
+awk grep local "$@" x=1 ${HOME} "$@" --verbose $(pwd)
+		2>/dev/null 2>/dev/null local x=1 local 2>/dev/null -eu local
+export 'quoted text' sed && --verbose x=1 awk export "$1" "$1" "$1" | sed
+	grep done done $(pwd) "$1" then && echo -eu
+x=1 echo "$1" "$1" cd
+	local 'quoted text' 'quoted text' grep "$@"
+sed 2>/dev/null then && local printf cd local 'quoted text' test readonly
+	test done done "$@" "$1" local test sed 'quoted text' x=1 $(pwd) ${HOME}
+	-eu | "$@" | 'quoted text'
+local grep $(pwd) | --verbose readonly 'quoted text' local
+		x=1 awk /usr/bin ${HOME} readonly "$@" 2>/dev/null
+"$@" printf | 'quoted text' done
+&& "$@" awk 'quoted text' ${HOME} printf | "$1"
+	&& test printf "$@" -eu then -eu
+	printf export /usr/bin && /usr/bin then export "$@" ${HOME} export
+done awk awk x=1 awk "$1" readonly test done printf
+	export grep test x=1 && test test echo $(pwd) echo 'quoted text' $(pwd) cd readonly
+echo awk --verbose readonly test /usr/bin test | --verbose $(pwd) awk export
+&& && done then --verbose echo | awk $(pwd) $(pwd)
+	'quoted text' done done x=1 done done done /usr/bin 2>/dev/null readonly
+--verbose --verbose "$1" --verbose | $(pwd) ${HOME} grep
+	grep --verbose "$1" /usr/bin
+	sed ${HOME} x=1 export printf local
+		grep cd --verbose "$1"
+&& printf printf $(pwd)
+echo && x=1 test cd --verbose
+	grep awk -eu export -eu ${HOME} ${HOME} then local $(pwd) x=1 "$@" done $(pwd)
+		printf test printf readonly "$1" awk cd --verbose
+	--verbose then grep grep -eu grep printf done x=1 x=1 cd grep &&
+		printf 'quoted text' sed local x=1 test
+		export -eu "$@" local
+		then test sed sed "$@"
+		"$@" 'quoted text' 'quoted text'
+	done 2>/dev/null export echo local printf $(pwd) export
+	grep -eu --verbose echo "$1" printf
+		| 'quoted text' export grep | printf "$1" -eu ${HOME} && 'quoted text' then
+		awk && 2>/dev/null 'quoted text' sed 2>/dev/null printf
+cd export local && --verbose test done export then x=1 done
+&& /usr/bin ${HOME} test then x=1 printf awk local cd "$@" sed
+	awk "$1" local sed done
+		${HOME} test "$@" then sed "$1" export
+test "$@" /usr/bin | test | local 2>/dev/null $(pwd)
+"$@" 2>/dev/null 2>/dev/null cd local local local local 2>/dev/null sed x=1 'quoted text'
+&& && local echo /usr/bin 'quoted text'
+echo 'quoted text' /usr/bin awk "$1" done | then && -eu 'quoted text'
+	sed ${HOME} && echo $(pwd) grep local "$@" x=1 printf -eu sed -eu "$@" then
+-eu ${HOME} --verbose sed 2>/dev/null
+	awk test test && && --verbose
+	| | awk 'quoted text' && $(pwd) grep test test
+		'quoted text' ${HOME} | $(pwd) local printf
+	echo ${HOME} ${HOME} grep "$@" | echo grep
+	sed test "$@" sed 'quoted text' readonly --verbose "$1"
+	cd then 2>/dev/null -eu 2>/dev/null
+	cd -eu && $(pwd) x=1 grep printf sed printf && --verbose
+	2>/dev/null ${HOME} local cd "$1" sed 2>/dev/null 'quoted text' && readonly
+	printf local export local echo | 2>/dev/null
+	$(pwd) | -eu -eu --verbose | "$1"
+		readonly | done test grep export "$1" /usr/bin "$@" &&
+		'quoted text' ${HOME} awk printf
+"$1" $(pwd) "$@" grep then $(pwd) export
+		$(pwd) 'quoted text' test "$@" x=1 done --verbose local export &&
+		awk -eu local 2>/dev/null /usr/bin /usr/bin /usr/bin | cd 2>/dev/null x=1 2>/dev/null
+		/usr/bin /usr/bin "$1" /usr/bin -eu test awk readonly "$1"
+		'quoted text' awk 2>/dev/null /usr/bin test
+		printf then 2>/dev/null && awk local 'quoted text' cd x=1
+	printf "$1" awk done "$@" done "$@" printf "$@"
+echo && "$@" /usr/bin awk printf | export -eu &&
+	"$@" export "$@" sed $(pwd) ${HOME} echo 'quoted text' x=1 grep ${HOME} --verbose
+$(pwd) echo --verbose test
+grep export then readonly awk awk x=1 grep |
+	x=1 "$1" test echo echo printf --verbose --verbose
+		cd "$1" sed /usr/bin grep | sed -eu x=1 $(pwd) local | readonly
+	-eu "$1" local cd done -eu
+	cd then readonly echo "$@" "$@" sed then --verbose | then -eu 2>/dev/null $(pwd)
+x=1 local then 'quoted text' printf awk
+	$(pwd) x=1 export | test test sed --verbose
+grep /usr/bin readonly 'quoted text'
+		export "$1" --verbose then --verbose $(pwd) done 2>/dev/null cd 2>/dev/null
+		$(pwd) x=1 then -eu export test $(pwd) 2>/dev/null echo $(pwd) printf cd
+		then sed "$1" echo 2>/dev/null echo && ${HOME} sed done
+		"$1" ${HOME} | $(pwd) readonly cd export grep
+then ${HOME} grep 2>/dev/null test done -eu grep -eu /usr/bin
+	"$@" local readonly then x=1 x=1 grep 'quoted text' ${HOME} x=1 sed -eu echo
+		&& && printf local awk export "$@" cd export x=1 2>/dev/null
+		readonly then ${HOME} sed readonly echo "$@" sed grep done readonly
+test cd "$@" x=1 x=1 --verbose test && cd
+	echo sed local printf x=1 sed &&
+		--verbose then cd awk grep echo | awk --verbose
+-eu -eu awk && --verbose -eu echo readonly --verbose sed "$@" x=1 awk
+-eu /usr/bin | ${HOME} awk /usr/bin x=1 /usr/bin
+	echo ${HOME} echo local test export "$1" x=1 /usr/bin 'quoted text'
+		--verbose sed readonly "$1" done /usr/bin 2>/dev/null done then | x=1 printf test
+	done export awk readonly local then 2>/dev/null /usr/bin echo then echo | then
+awk -eu --verbose printf ${HOME} --verbose export cd x=1 "$1" export
+--verbose ${HOME} done grep "$1" $(pwd) export readonly sed printf
+	"$@" -eu cd printf -eu --verbose | readonly -eu grep sed
+		then export x=1 'quoted text' ${HOME} $(pwd) cd "$@"
+	'quoted text' 2>/dev/null local grep cd readonly "$@"
+grep export && local "$@" -eu ${HOME} "$@" then | printf local awk
+"$@" awk -eu test cd awk $(pwd) |
+x=1 "$@" --verbose "$@"
+	"$1" | readonly "$1" done $(pwd) x=1 -eu export local --verbose 2>/dev/null
+-eu cd && readonly readonly ${HOME} 2>/dev/null readonly 'quoted text' done
+grep local $(pwd) readonly readonly printf "$1" --verbose echo echo cd printf echo
+	echo --verbose cd /usr/bin
+done grep -eu grep awk "$@" 'quoted text' then done ${HOME}
+		sed sed 'quoted text' local $(pwd)
+		awk done done readonly readonly "$@" awk readonly x=1 echo cd /usr/bin
+		$(pwd) echo test test then 2>/dev/null "$@" -eu && local "$@" --verbose | export
+local --verbose ${HOME} readonly awk echo grep then | done
+		/usr/bin /usr/bin x=1 sed awk sed | sed --verbose "$1" "$@" grep | sed export
+done /usr/bin sed local $(pwd)
+| /usr/bin 2>/dev/null | local 'quoted text' ${HOME} "$1" 'quoted text'
+	local cd "$@" && /usr/bin test cd echo readonly sed then local
+		'quoted text' export local ${HOME}
+echo x=1 export 'quoted text'
+	echo $(pwd) && "$@" 'quoted text' awk
+	test $(pwd) "$@" ${HOME}
+		printf x=1 grep echo then "$@" echo --verbose | local ${HOME} local printf
+		"$1" cd "$@" /usr/bin x=1 sed test "$@" then readonly ${HOME}
+then test awk grep --verbose
+		| "$1" 2>/dev/null sed /usr/bin --verbose /usr/bin "$@" x=1 test sed &&
+		awk echo echo test ${HOME}
+		| --verbose 'quoted text' "$1" done
+	done grep ${HOME} sed ${HOME} && grep /usr/bin cd done | x=1 ${HOME} test export
+		--verbose test awk | --verbose done sed x=1 done
+	"$@" grep readonly "$1" printf 'quoted text' "$@" x=1 then then 2>/dev/null
+		readonly && done done --verbose "$1" test done local awk
+		$(pwd) && printf --verbose | awk --verbose "$@"
+grep --verbose printf 'quoted text' && readonly
+test "$1" then "$1" 2>/dev/null
+sed --verbose echo test && $(pwd) sed "$1" then 'quoted text' echo
+test awk && -eu readonly export && grep grep export
+/usr/bin awk && readonly readonly sed
+	--verbose awk sed printf && test $(pwd) awk awk /usr/bin 2>/dev/null $(pwd)
+		echo --verbose test "$@" local ${HOME} |
+| "$@" | test "$1" then then test -eu echo 2>/dev/null cd then readonly -eu x=1
+		-eu x=1 $(pwd) $(pwd) "$@" test $(pwd) local readonly
+		x=1 printf -eu "$@" ${HOME} $(pwd) done then --verbose "$1" awk /usr/bin
+	/usr/bin cd | -eu cd done $(pwd)
+	then grep test /usr/bin | readonly "$@" done grep /usr/bin done
+		x=1 | awk sed "$1" readonly | && echo sed && export cd && cd readonly then &&
+	&& awk ${HOME} echo grep sed ${HOME} -eu "$1" test -eu readonly then
+		done 'quoted text' && test && then done test && x=1 2>/dev/null readonly
+	-eu "$@" && --verbose test awk grep x=1 --verbose local x=1 "$@" --verbose
+sed && "$@" printf awk ${HOME} readonly /usr/bin -eu local
+	sed -eu then echo | awk /usr/bin awk ${HOME} printf
+		local --verbose local -eu
+2>/dev/null grep x=1 sed printf /usr/bin
+	| cd readonly printf export "$@" local awk && grep grep --verbose && "$1"
+		"$1" cd "$1" && | echo /usr/bin 'quoted text'
+done local /usr/bin |
+	echo 'quoted text' local export sed local && awk then
+${HOME} sed "$@" "$@" cd
+cd "$1" && "$@" /usr/bin && x=1
+	test local && export grep | x=1 | --verbose && test export export /usr/bin
+	done export 'quoted text' grep test $(pwd)
+	'quoted text' readonly done $(pwd) ${HOME} readonly test
+sed -eu "$@" then "$@" export /usr/bin 2>/dev/null
+	grep --verbose ${HOME} local
+	'quoted text' 2>/dev/null readonly 2>/dev/null $(pwd) sed sed awk x=1
+	2>/dev/null $(pwd) printf 'quoted text' readonly "$@" printf && then printf
+readonly grep echo | printf sed echo export printf grep --verbose
+echo cd local "$@" local test -eu "$1" test echo export --verbose
+export test "$1" x=1 done test done cd then export echo cd "$@" sed
+		printf 2>/dev/null 2>/dev/null -eu export
+		&& grep 2>/dev/null local 'quoted text' printf echo export
+		2>/dev/null grep echo "$@" 2>/dev/null
+awk 2>/dev/null then local "$@"
+"$@" "$@" x=1 /usr/bin | then then then | export && test
+'quoted text' echo 2>/dev/null --verbose ${HOME} && done export /usr/bin /usr/bin
+		-eu grep && 2>/dev/null x=1 printf test sed export export echo $(pwd)
+		"$1" 'quoted text' local "$1"
+printf --verbose "$1" "$1"
+printf echo 2>/dev/null readonly
+		-eu grep /usr/bin export grep test export --verbose awk
+	cd "$1" done $(pwd) "$@" cd test 'quoted text'
+-eu readonly grep echo printf
+/usr/bin 'quoted text' printf "$1" x=1 cd $(pwd) $(pwd) --verbose printf
+2>/dev/null -eu && sed then "$1"
+${HOME} done -eu $(pwd) -eu readonly "$@" /usr/bin 'quoted text'
+/usr/bin printf printf "$@" awk $(pwd)
+	done x=1 'quoted text' echo /usr/bin
+	"$1" x=1 "$1" then grep -eu
+		printf done /usr/bin $(pwd) awk -eu printf -eu then -eu
+	done $(pwd) grep then test sed $(pwd) then then done then --verbose cd --verbose
+printf grep done "$1" test $(pwd) -eu awk echo printf -eu $(pwd) ${HOME}
+grep sed then 2>/dev/null export /usr/bin export
+		export done /usr/bin awk && printf sed done | test /usr/bin
+grep 'quoted text' echo awk cd -eu x=1 -eu done 2>/dev/null
+printf $(pwd) printf sed readonly cd $(pwd) --verbose ${HOME}
+/usr/bin "$@" 'quoted text' cd printf 2>/dev/null
+/usr/bin /usr/bin --verbose -eu x=1 2>/dev/null "$1" local ${HOME}
+		&& | "$1" printf x=1 --verbose test ${HOME} readonly x=1 local
+		x=1 printf awk 2>/dev/null echo ${HOME} test echo "$@" grep then $(pwd) grep
+		local test ${HOME} test x=1 local && && echo
+		"$1" done export grep "$1" x=1 done echo export x=1 -eu --verbose test
+		printf readonly local export
+	&& && && then x=1 done $(pwd) | export sed ${HOME}
+	test awk | local sed test
+	grep && -eu local echo test "$1" && then | x=1 /usr/bin
+/usr/bin -eu test printf
+		then grep cd test grep done | "$1" | local x=1
+grep --verbose cd done "$@" 2>/dev/null readonly x=1 'quoted text' &&
+&& | "$1" sed readonly export -eu cd echo printf --verbose cd x=1
+		local x=1 "$1" local printf
+	--verbose --verbose then --verbose test 'quoted text'
+	cd printf -eu done -eu awk export --verbose then local printf grep
+	readonly "$1" 'quoted text' test "$@" printf "$@" | ${HOME} done
+		| then done then -eu && 'quoted text' "$@" test x=1 cd --verbose && x=1 2>/dev/null
+	2>/dev/null /usr/bin export x=1 readonly then 2>/dev/null
+		test grep --verbose 2>/dev/null grep $(pwd) printf test readonly
+	echo done "$@" 'quoted text' ${HOME} then
+	sed "$1" ${HOME} -eu -eu $(pwd) $(pwd) $(pwd) done -eu cd x=1 /usr/bin test sed
+	readonly awk test | $(pwd) 'quoted text' "$1" printf test /usr/bin
+readonly export --verbose cd readonly local "$@" local cd 2>/dev/null
+	local -eu "$1" printf -eu "$1" -eu local sed /usr/bin
+		printf x=1 sed x=1 cd 'quoted text' 2>/dev/null
+		&& $(pwd) && cd printf printf done
+$(pwd) then done local
+${HOME} -eu then "$@"
+	readonly --verbose --verbose $(pwd) "$1" | 'quoted text' /usr/bin cd
+	grep "$1" then 'quoted text' grep cd test "$@" 2>/dev/null -eu readonly
+		printf /usr/bin | $(pwd) "$1" $(pwd) test -eu "$1" printf sed printf local &&
+cd $(pwd) done then --verbose | --verbose then
+		done printf export local awk done cd
+		/usr/bin $(pwd) sed ${HOME}
+test ${HOME} readonly "$1" test x=1 --verbose && export x=1 local 'quoted text'
+	/usr/bin export --verbose
+cd cd --verbose sed x=1 &&
+	echo grep $(pwd) readonly && $(pwd) -eu readonly cd | echo "$@" then printf
+		"$1" local local --verbose "$@" done --verbose
+2>/dev/null echo then grep echo
+		readonly 2>/dev/null -eu test
+	export echo readonly export --verbose readonly && "$1" ${HOME} 2>/dev/null
+x=1 "$@" "$@" && $(pwd) local --verbose test "$@" test readonly awk export
+		| $(pwd) ${HOME} -eu "$1" x=1 --verbose
+		echo local done local -eu grep test grep echo grep /usr/bin --verbose cd &&
+-eu "$1" "$1" grep --verbose |
+		local printf awk awk done --verbose "$@" ${HOME} readonly --verbose
+		echo printf --verbose /usr/bin
+local x=1 ${HOME} ${HOME} ${HOME}
+	| -eu /usr/bin awk cd grep export "$1" awk 'quoted text'
+		then grep && echo 2>/dev/null test $(pwd) export cd
+"$1" cd -eu x=1 "$1" "$1" grep readonly sed done "$@" | ${HOME}
+	export grep 'quoted text' $(pwd) awk
+	/usr/bin x=1 grep --verbose x=1 readonly "$1"
+export "$1" $(pwd) sed 'quoted text' "$@"
+	"$@" local awk /usr/bin "$1"
+	done done grep --verbose 'quoted text' export readonly readonly then ${HOME} --verbose
+	/usr/bin echo test x=1 then test | sed sed
+&& x=1 "$1" printf cd 'quoted text' readonly &&
+	readonly $(pwd) -eu -eu "$@" grep test
+		done echo sed grep /usr/bin readonly 2>/dev/null
+	test -eu test "$1" --verbose cd printf
+grep echo x=1 "$1" x=1 2>/dev/null 2>/dev/null 2>/dev/null test sed
+	--verbose local 2>/dev/null && ${HOME}
+local 'quoted text' "$1" readonly | then 'quoted text'
+	/usr/bin printf "$@" 'quoted text' -eu "$@" 'quoted text'
+	grep cd test echo export $(pwd) | | -eu grep
+		readonly cd | "$@" 'quoted text'
+	| && grep -eu test test $(pwd) x=1 printf /usr/bin then
+		cd done -eu x=1 | && cd readonly "$@" done "$@" --verbose "$1" export x=1 then
+		--verbose readonly cd printf 'quoted text' 'quoted text' "$1" done ${HOME}
+		cd export then cd grep done done 2>/dev/null
+	-eu x=1 test grep $(pwd)
+	${HOME} && && export test 2>/dev/null awk printf done printf awk
+cd local local printf test local awk sed echo
+		then then echo awk grep sed awk
+	'quoted text' then done "$@" export $(pwd) /usr/bin x=1 && printf x=1 && awk
+	awk echo --verbose "$1" "$@" "$1" x=1 -eu readonly ${HOME} test /usr/bin
+printf -eu --verbose -eu awk -eu then ${HOME} sed
+"$@" $(pwd) grep "$@" sed -eu 'quoted text'
+	export 'quoted text' sed cd sed export local
+		${HOME} sed && local
+	grep printf ${HOME} then -eu -eu local $(pwd) cd | ${HOME} -eu export |
+	| /usr/bin "$@" 'quoted text' ${HOME} --verbose "$1" | test
+sed readonly $(pwd) awk sed sed /usr/bin "$@" grep &&
+then 2>/dev/null | /usr/bin 'quoted text' -eu done awk
+	| && test | $(pwd) | awk done cd grep $(pwd) |
+		grep sed local x=1 ${HOME}
+		done 2>/dev/null done readonly printf && cd done cd "$1" 'quoted text'
+export ${HOME} "$@" grep printf then --verbose 'quoted text' export local
+${HOME} sed cd cd grep printf cd && /usr/bin -eu -eu grep then
+	&& "$1" && awk grep /usr/bin
+		test test -eu ${HOME} readonly | && printf echo
+	awk --verbose | printf "$@" 2>/dev/null export export -eu | readonly
+	"$1" | ${HOME} export | |
+	echo /usr/bin /usr/bin ${HOME} "$@" /usr/bin grep done done grep test "$1" grep
+	-eu 'quoted text' --verbose x=1 echo && done 2>/dev/null awk done | ${HOME} test
+		readonly export echo /usr/bin -eu 2>/dev/null
+printf /usr/bin local test
+cd && 2>/dev/null printf x=1 echo
+	awk printf then then
+sed local echo echo sed "$@" --verbose x=1 x=1 local
+	test | ${HOME} | printf local ${HOME} /usr/bin then echo done -eu sed
+	done ${HOME} sed x=1 sed cd ${HOME} "$@" --verbose
+		local 'quoted text' done -eu | -eu ${HOME} sed echo then test
+	local 2>/dev/null -eu "$@" ${HOME} -eu ${HOME} cd readonly x=1 'quoted text'
+then x=1 "$1" test local done echo && ${HOME} echo export -eu && awk awk &&
+	grep 'quoted text' then test
+		export readonly 'quoted text'
+readonly export "$@" | "$1" x=1 2>/dev/null cd test "$1"
+	/usr/bin 'quoted text' sed --verbose readonly printf $(pwd)
+printf $(pwd) echo "$1" readonly ${HOME} -eu $(pwd) echo x=1
+	"$1" printf export "$1" /usr/bin ${HOME} test
+	sed --verbose then done "$@" 2>/dev/null 2>/dev/null "$@" readonly
+--verbose | "$1" ${HOME} ${HOME} 'quoted text' "$1" $(pwd) local export
+		echo export --verbose "$1" x=1 -eu $(pwd) "$@" -eu export then && 'quoted text'
+		echo && echo && test --verbose export --verbose 2>/dev/null &&
+		test sed awk export "$@" $(pwd) readonly
+		done /usr/bin 2>/dev/null local ${HOME}
+		echo /usr/bin printf done /usr/bin 'quoted text'
+sed -eu && local 2>/dev/null
+readonly local x=1 "$@" 'quoted text' ${HOME} then
+cd done then grep readonly sed $(pwd) "$1" --verbose | | 2>/dev/null
+cd 2>/dev/null done -eu echo | then export
+sed awk $(pwd) echo 2>/dev/null x=1 sed local $(pwd) cd 'quoted text' local "$@"
+		done readonly 'quoted text' cd 'quoted text' export
+/usr/bin readonly $(pwd) cd printf
+		echo x=1 export done 2>/dev/null sed 'quoted text'
+		'quoted text' --verbose export --verbose 2>/dev/null --verbose && then grep
+	awk local /usr/bin | && done ${HOME} then cd /usr/bin x=1
+		sed "$1" 2>/dev/null test 2>/dev/null printf --verbose awk
+	test then 2>/dev/null "$@" 'quoted text' x=1 /usr/bin --verbose awk grep
+		${HOME} "$@" then /usr/bin -eu /usr/bin
+	cd 2>/dev/null awk $(pwd) --verbose awk done /usr/bin
+${HOME} | 2>/dev/null -eu -eu export echo readonly /usr/bin echo test
+		done x=1 grep cd local 'quoted text' 'quoted text' && test "$@" | /usr/bin $(pwd)
+	$(pwd) --verbose /usr/bin
+${HOME} grep --verbose readonly x=1 ${HOME}
+	${HOME} "$1" ${HOME} printf test x=1 echo
+/usr/bin sed printf ${HOME} local | ${HOME} echo
+	grep done ${HOME} --verbose printf cd printf --verbose cd 2>/dev/null
+		readonly 'quoted text' "$@" echo --verbose -eu export --verbose
+		awk awk /usr/bin sed done grep -eu
+		sed -eu | "$1" && sed ${HOME} test then ${HOME} local | x=1
+		"$@" sed printf readonly done local cd then done echo x=1
+	local x=1 | "$@" "$1" echo
+		"$1" && | cd /usr/bin echo x=1 then sed 2>/dev/null then
+local sed printf --verbose 'quoted text' "$1" grep printf
+		"$@" export "$@" | printf 2>/dev/null
+		done sed 2>/dev/null printf
+${HOME} --verbose cd awk
+	local grep done $(pwd) export test grep readonly x=1 'quoted text' sed echo 'quoted text'
+"$1" "$@" echo cd /usr/bin
+		done done && 2>/dev/null awk printf 'quoted text'
+readonly 'quoted text' printf x=1 grep sed ${HOME} echo awk "$@" ${HOME} sed --verbose
+		test && local export readonly test sed | test
+		-eu readonly 2>/dev/null sed ${HOME} ${HOME} "$1"
+| "$@" export echo then | test awk $(pwd) grep local
+	"$@" grep cd "$@" -eu
+2>/dev/null local 2>/dev/null "$@" -eu x=1
+awk echo ${HOME} --verbose 'quoted text' 2>/dev/null --verbose
+		cd -eu 2>/dev/null then "$@"
+$(pwd) awk cd done echo cd echo x=1 ${HOME} ${HOME} /usr/bin readonly
+		--verbose readonly $(pwd) done x=1 --verbose | --verbose -eu printf cd 2>/dev/null
+--verbose printf -eu x=1 test export cd test ${HOME} 2>/dev/null
+	$(pwd) --verbose 2>/dev/null sed sed $(pwd) ${HOME} $(pwd) ${HOME} cd ${HOME} awk
+	| export printf awk && printf grep --verbose 'quoted text' /usr/bin /usr/bin
+	readonly readonly x=1 /usr/bin echo --verbose | $(pwd) cd then -eu printf readonly
+	| ${HOME} -eu export printf export
+		grep local ${HOME} awk ${HOME}
+/usr/bin echo "$@" then -eu -eu $(pwd) done cd echo "$@" sed
+&& then "$@" -eu ${HOME} 'quoted text'
+	printf 2>/dev/null x=1 x=1 done $(pwd) done 2>/dev/null grep
+		test readonly local /usr/bin "$@"
+	sed && 2>/dev/null -eu /usr/bin x=1 --verbose
+	${HOME} export test "$1" x=1 local cd test ${HOME} awk
+$(pwd) export | cd printf awk sed | -eu -eu ${HOME} echo
+	done 'quoted text' 'quoted text' cd ${HOME} done readonly done test ${HOME} awk
+${HOME} grep echo --verbose cd test --verbose test "$1" export grep "$1" $(pwd)
+/usr/bin readonly printf ${HOME} export then grep
+		readonly x=1 done test sed --verbose
+&& --verbose | local printf && && --verbose "$1" --verbose ${HOME} readonly
+		$(pwd) export /usr/bin && test /usr/bin awk --verbose done readonly
+		$(pwd) test awk sed printf "$@" --verbose then x=1 x=1
+		grep export test grep grep x=1 | /usr/bin
+${HOME} echo cd | readonly "$@" "$1" 'quoted text' ${HOME}
+	printf "$1" echo /usr/bin /usr/bin ${HOME} then "$@" export "$1"
+		sed export ${HOME} done 'quoted text'
+sed printf cd export grep && 2>/dev/null done
+		| test /usr/bin grep 2>/dev/null awk x=1 done cd sed readonly -eu grep
+		done "$@" ${HOME} x=1 export 'quoted text' readonly
+	&& printf then --verbose 'quoted text' sed
+		cd cd sed sed readonly awk done local
+	-eu /usr/bin /usr/bin grep then 2>/dev/null
+${HOME} echo 'quoted text' 'quoted text' | --verbose echo sed
+printf && readonly $(pwd) -eu -eu done "$@" export export && | -eu &&
+		cd awk printf /usr/bin local echo local local
+&& | -eu 2>/dev/null --verbose ${HOME}
+grep "$1" then echo export
+		done 2>/dev/null then test | -eu --verbose $(pwd) grep test "$1" then sed local
+		printf --verbose cd then "$1" x=1 awk 'quoted text'
+		sed && awk cd readonly export printf local $(pwd) grep && 2>/dev/null
+	echo printf grep readonly --verbose
+		${HOME} "$1" test 'quoted text' 'quoted text' done export readonly local x=1 &&
+	awk test "$@" "$@" export | echo ${HOME} --verbose export
+		export && grep --verbose awk sed /usr/bin x=1 2>/dev/null
+		cd echo cd grep done ${HOME}
+		'quoted text' 'quoted text' readonly "$@" readonly -eu 'quoted text' export printf
+		export "$@" x=1 cd -eu 'quoted text' cd readonly "$1" sed awk grep
+${HOME} | sed echo ${HOME} printf test grep local "$@" grep echo x=1
+--verbose test && x=1 --verbose 'quoted text' local grep "$1" "$1" | cd
+	"$@" then test 2>/dev/null test /usr/bin
+echo awk local grep "$@" x=1 && -eu readonly export readonly test $(pwd)
+done then $(pwd) echo "$@" cd ${HOME} awk readonly sed
+	sed "$1" -eu printf cd $(pwd) "$1" awk printf
+-eu local x=1 $(pwd) x=1 test readonly then test then readonly x=1 /usr/bin
+		printf /usr/bin /usr/bin "$@" echo
+	cd echo awk && $(pwd) -eu done
+		done $(pwd) awk /usr/bin /usr/bin then sed local $(pwd)
+-eu local && $(pwd) 'quoted text'
+		'quoted text' x=1 awk /usr/bin sed cd grep x=1 $(pwd) && export 'quoted text'
+		readonly awk --verbose && ${HOME} | $(pwd) "$1" x=1 "$@" $(pwd) sed $(pwd)
+	printf grep done export "$@" 'quoted text'
+		printf 2>/dev/null test --verbose awk ${HOME}
+	--verbose --verbose export echo test export
+"$@" awk "$1" sed sed "$@"
+	cd 'quoted text' 2>/dev/null readonly && 2>/dev/null $(pwd) grep
+export sed $(pwd) 'quoted text' -eu 2>/dev/null
+/usr/bin ${HOME} /usr/bin sed x=1 done local 'quoted text'
+		test cd $(pwd) export awk readonly test cd ${HOME} -eu
+	x=1 sed export local export | printf awk "$1" echo cd | then
+	cd --verbose $(pwd) $(pwd) "$1" grep ${HOME} ${HOME} echo "$@" printf -eu -eu
+cd "$@" printf "$@" 2>/dev/null test -eu test "$1" echo /usr/bin
+local x=1 /usr/bin echo x=1 x=1 test --verbose 2>/dev/null -eu -eu --verbose
+--verbose ${HOME} | grep local
+	local readonly -eu | /usr/bin
+readonly sed readonly $(pwd) --verbose
+echo grep printf -eu test -eu readonly printf readonly
+		x=1 local awk readonly cd && grep "$1" printf local ${HOME} /usr/bin awk
+$(pwd) test done x=1 awk then x=1 x=1 awk
+grep 2>/dev/null "$1" awk test "$@"
+	printf 2>/dev/null printf
+	printf echo grep local | done echo local then && awk echo 2>/dev/null -eu |
+		'quoted text' grep x=1 cd printf printf && test && && 2>/dev/null | cd printf sed
+x=1 export cd "$@" $(pwd) /usr/bin "$1" -eu awk "$@" | && sed
+	awk "$1" export 'quoted text'
+		then 'quoted text' x=1 readonly then "$1" done x=1 x=1 local local done --verbose
+	done readonly sed awk --verbose export awk awk
+		x=1 -eu export echo $(pwd) 2>/dev/null "$1"
+		grep "$@" grep x=1 then "$@" "$@" test done x=1 awk && printf ${HOME}
+	$(pwd) -eu local /usr/bin cd export -eu local -eu --verbose
+		$(pwd) $(pwd) "$1" readonly 2>/dev/null test printf 2>/dev/null /usr/bin x=1 |
+	"$1" test grep done test test -eu readonly readonly
+| done local then && && $(pwd) /usr/bin x=1
+	-eu /usr/bin /usr/bin local test done
+		echo "$@" 'quoted text' test
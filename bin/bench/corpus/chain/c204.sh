@@ -0,0 +1,2001 @@
+		"$@" awk printf awk ${HOME} local cd /usr/bin readonly 'quoted text'
+		'quoted text' "$@" printf export test readonly
+--verbose --verbose /usr/bin ${HOME} test sed && then readonly && 'quoted text'
+&& ${HOME} readonly awk
+		"$@" then cd 2>/dev/null echo local -eu 2>/dev/null test
+		done done "$@" done /usr/bin
+		sed sed "$1" export ${HOME} done awk
+		x=1 echo awk -eu done --verbose printf local cd $(pwd) test grep printf 2>/dev/null
+"$@" | ${HOME} "$1" done $(pwd)
+${HOME} local echo awk echo test x=1 echo 'quoted text'
+		sed 2>/dev/null local --verbose grep | export
+	"$@" && export | test 'quoted text'
+	--verbose 2>/dev/null done printf export awk | sed cd test ${HOME}
+echo export cd test -eu readonly ${HOME} | cd then grep then grep /usr/bin done
+test --verbose "$@" $(pwd) -eu | printf
+	"$1" test | ${HOME} cd grep sed readonly -eu "$1" sed | echo ${HOME} /usr/bin
+grep -eu then cd --verbose "$@" --verbose "$1"
+		local 'quoted text' export sed $(pwd) ${HOME} sed x=1 then done ${HOME} $(pwd)
+then -eu "$1" echo then then ${HOME} | local ${HOME} --verbose
+sed 'quoted text' grep cd cd | "$1" /usr/bin
+		$(pwd) 'quoted text' awk echo readonly "$@" | 2>/dev/null -eu readonly
+		2>/dev/null ${HOME} sed printf test awk | /usr/bin
+	&& 2>/dev/null echo sed -eu /usr/bin test printf grep echo cd
+&& grep printf "$1" && 2>/dev/null local awk
+		${HOME} 'quoted text' ${HOME}
+		--verbose grep readonly awk && --verbose readonly grep
+	-eu "$1" done done 2>/dev/null
+	2>/dev/null -eu local done && then export x=1 sed readonly sed awk && "$@" --verbose
+		'quoted text' "$1" sed -eu $(pwd) $(pwd) awk grep "$@" -eu test
+		then echo export "$@" | export awk test awk --verbose 'quoted text'
+		then "$@" sed local "$@" done -eu | "$1" &&
+sed x=1 x=1 -eu ${HOME} export grep then
+	x=1 -eu --verbose ${HOME} export
+&& echo --verbose test grep done echo x=1 sed awk -eu ${HOME}
+/usr/bin 'quoted text' cd cd test awk --verbose "$1" echo export
+	&& /usr/bin | then 'quoted text'
+		'quoted text' ${HOME} printf echo && && sed ${HOME} --verbose | x=1 /usr/bin &&
+		2>/dev/null sed /usr/bin 2>/dev/null printf /usr/bin
+		grep then 2>/dev/null done /usr/bin x=1 "$@" echo -eu grep echo
+	grep cd export -eu | -eu cd && export printf $(pwd) cd $(pwd) &&
+		sed readonly 2>/dev/null $(pwd) test "$1" export done && $(pwd) /usr/bin
+		| && grep -eu "$1" echo /usr/bin 2>/dev/null
+	${HOME} "$@" | sed $(pwd) --verbose && done then awk 'quoted text' &&
+		${HOME} | done sed 'quoted text' awk /usr/bin done cd readonly -eu done
+	-eu -eu "$1" export $(pwd) ${HOME}
+		echo /usr/bin | cd 2>/dev/null -eu 'quoted text'
+'quoted text' | $(pwd) 'quoted text' 2>/dev/null /usr/bin -eu
+	echo local x=1 awk && cd
+		2>/dev/null grep "$@" $(pwd) printf cd local 'quoted text'
+readonly 'quoted text' "$1" 'quoted text' x=1 2>/dev/null x=1 sed awk
+		-eu export cd sed -eu local ${HOME} "$@" --verbose 2>/dev/null
+awk printf sed 'quoted text'
+	x=1 echo awk cd $(pwd) -eu cd --verbose | | grep sed done 'quoted text'
+		sed test 2>/dev/null then export cd | grep
+printf readonly /usr/bin done 'quoted text' /usr/bin $(pwd)
+-eu /usr/bin | "$@" echo && && export /usr/bin
+		grep cd readonly printf grep 2>/dev/null awk awk --verbose "$@" sed
+'quoted text' export printf awk x=1 && export sed
+	then && $(pwd) readonly && echo "$1" local -eu cd
+	$(pwd) sed local x=1 echo done
+done x=1 awk export 2>/dev/null $(pwd) readonly 'quoted text' local grep
+-eu -eu sed grep x=1 /usr/bin --verbose "$@" done sed done 'quoted text'
+	readonly $(pwd) readonly test readonly x=1 cd cd --verbose "$@" export done printf
+readonly then /usr/bin -eu readonly "$@" readonly grep
+export sed ${HOME} sed readonly then readonly
+	cd -eu then awk test sed test grep cd $(pwd) "$1" $(pwd) /usr/bin 'quoted text'
+		/usr/bin printf --verbose test x=1 'quoted text'
+'quoted text' sed export
+		test echo ${HOME} x=1 "$@" grep "$@" awk 'quoted text'
+		local then export ${HOME}
+	/usr/bin export sed sed ${HOME} $(pwd) -eu 2>/dev/null "$@" && printf
+${HOME} ${HOME} | local cd 'quoted text' printf && x=1 2>/dev/null 2>/dev/null
+	--verbose x=1 awk done "$@" && test --verbose -eu -eu
+	"$@" /usr/bin /usr/bin 2>/dev/null $(pwd) --verbose
+	test --verbose $(pwd) local
+		${HOME} then export "$@" 'quoted text'
+sed ${HOME} | cd sed 2>/dev/null echo /usr/bin /usr/bin
+		printf 2>/dev/null echo $(pwd) ${HOME} /usr/bin -eu export grep ${HOME} readonly
+		export awk cd x=1 /usr/bin -eu 'quoted text'
+	--verbose then && "$1" done x=1 then &&
+		${HOME} /usr/bin echo sed then sed grep
+		done awk | export "$1" ${HOME} local "$@" printf "$@"
+		'quoted text' export && local
+	'quoted text' printf cd grep printf x=1 'quoted text' ${HOME} "$@" --verbose
+	done -eu 2>/dev/null test test -eu -eu "$@"
+done grep x=1 ${HOME} | ${HOME} ${HOME} ${HOME} local done /usr/bin 'quoted text'
+cd -eu --verbose echo sed 'quoted text' printf sed done
+awk 'quoted text' then then 'quoted text' readonly grep echo then done &&
+		/usr/bin && test -eu done sed readonly
+	&& then export done "$1" -eu 'quoted text' --verbose test grep
+	cd x=1 -eu sed ${HOME} && 'quoted text' awk --verbose done test
+		x=1 "$@" -eu x=1 2>/dev/null x=1 'quoted text' export then then
+		&& "$1" /usr/bin printf
+	then && export readonly && then && sed readonly x=1 done 'quoted text' local
+	echo && && cd local "$1" local "$@" awk 'quoted text' grep --verbose
+		readonly "$1" then printf done export
+		export | $(pwd) then awk export sed "$@" sed cd done | | 'quoted text'
+cd awk | /usr/bin -eu --verbose 2>/dev/null 2>/dev/null /usr/bin
+		grep local printf --verbose echo local readonly 2>/dev/null
+		local cd "$1" printf $(pwd) $(pwd) ${HOME} --verbose
+		--verbose 'quoted text' ${HOME} local
+	then cd 2>/dev/null 2>/dev/null && && readonly done -eu
+		cd 2>/dev/null grep 2>/dev/null /usr/bin /usr/bin printf 2>/dev/null awk printf
+		--verbose awk local then test -eu printf "$1" grep ${HOME} grep export 2>/dev/null
+	2>/dev/null local $(pwd) | printf echo cd --verbose "$1"
+		export echo test awk sed test grep
+		echo $(pwd) echo sed --verbose 2>/dev/null printf readonly echo "$@"
+local x=1 ${HOME} echo && sed x=1 x=1 local 2>/dev/null $(pwd)
+	&& done 2>/dev/null "$1" && echo x=1 printf awk local "$@" ${HOME} local
+		2>/dev/null -eu grep 'quoted text' printf 'quoted text' "$@" printf test cd readonly
+	&& printf $(pwd) awk /usr/bin "$@" "$1" -eu export "$1" done -eu echo
+	-eu readonly sed "$1" echo cd sed test && cd && 'quoted text'
+| done --verbose test grep 2>/dev/null $(pwd) "$@" then
+		printf local 'quoted text' done cd printf "$@" cd readonly x=1 'quoted text'
+		--verbose grep sed then 2>/dev/null "$@" "$1" /usr/bin
+		2>/dev/null cd $(pwd) /usr/bin $(pwd) && | echo local 'quoted text'
+		"$1" x=1 ${HOME} 'quoted text'
+		| ${HOME} $(pwd) ${HOME} test /usr/bin 'quoted text' x=1 sed 2>/dev/null "$1"
+	x=1 readonly 2>/dev/null test -eu echo grep
+	"$1" readonly sed export sed /usr/bin --verbose 'quoted text' 'quoted text'
+	/usr/bin echo sed grep local "$1" cd
+	done echo | 2>/dev/null export 'quoted text' x=1 -eu ${HOME}
+	grep test 'quoted text' cd /usr/bin awk cd
+		sed local x=1 printf readonly grep "$1"
+'quoted text' -eu printf sed grep test && "$1" echo 2>/dev/null local
+		printf then && then printf 'quoted text' "$1" $(pwd) echo done /usr/bin then
+		export awk | "$1" cd && readonly ${HOME}
+		"$@" "$1" | echo export /usr/bin 2>/dev/null awk local -eu /usr/bin ${HOME}
+		2>/dev/null grep | echo /usr/bin awk
+		"$@" x=1 && done ${HOME} awk local test "$1" "$@" x=1 x=1 "$@" "$1"
+	-eu then awk && /usr/bin /usr/bin awk export 2>/dev/null $(pwd)
+	done /usr/bin && && ${HOME} --verbose /usr/bin test cd done
+	2>/dev/null local test test /usr/bin "$@"
+		${HOME} printf awk readonly ${HOME} then 2>/dev/null
+		'quoted text' --verbose then local x=1 sed | awk
+	test grep echo 'quoted text' readonly local readonly echo x=1 awk grep local
+	2>/dev/null printf export 2>/dev/null 'quoted text' ${HOME} export $(pwd)
+	"$@" /usr/bin export done -eu "$1" $(pwd) awk $(pwd) local "$1"
+grep echo ${HOME} "$@" --verbose x=1 -eu "$1" "$@" 'quoted text'
+	printf printf readonly 2>/dev/null /usr/bin --verbose 2>/dev/null cd && /usr/bin
+	2>/dev/null /usr/bin then
+$(pwd) export export && export cd awk local ${HOME} ${HOME} x=1 ${HOME} local
+		${HOME} 'quoted text' /usr/bin /usr/bin "$1" export 'quoted text'
+	then -eu grep readonly printf local "$@"
+/usr/bin then printf cd local grep
+		2>/dev/null grep 'quoted text' readonly -eu
+cd printf "$1" grep export
+		local printf then -eu | && local
+	local done ${HOME} test "$1" sed -eu then
+		readonly ${HOME} ${HOME} && ${HOME}
+awk /usr/bin && echo "$1" /usr/bin x=1 | export grep "$1"
+	"$1" export /usr/bin awk printf export ${HOME} export ${HOME} export $(pwd) x=1
+	export then echo && --verbose /usr/bin 'quoted text' ${HOME} 'quoted text'
+printf && 'quoted text' export $(pwd)
+	'quoted text' "$1" local cd then readonly
+		local grep "$@" ${HOME} done | echo -eu 'quoted text'
+		then && 2>/dev/null export cd -eu done $(pwd) sed /usr/bin
+	echo --verbose "$@" export then then $(pwd) 2>/dev/null
+		-eu 2>/dev/null /usr/bin awk echo 'quoted text' "$@"
+	readonly echo awk "$1" readonly $(pwd)
+		"$@" awk /usr/bin 'quoted text' cd 2>/dev/null
+		"$1" echo local test cd then then readonly
+	sed ${HOME} cd && 2>/dev/null
+		cd --verbose export local done then -eu "$@"
+		local sed && sed | done |
+		"$@" sed 'quoted text' ${HOME} --verbose
+-eu && export done echo sed awk $(pwd) cd "$1" readonly readonly readonly
+readonly local awk -eu test echo cd
+		| sed "$1" "$@" 'quoted text' awk &&
+'quoted text' grep "$1" export $(pwd) ${HOME} grep echo ${HOME} -eu grep
+		${HOME} local "$1" export /usr/bin
+	x=1 printf then test readonly sed done 'quoted text'
+	then | grep done awk ${HOME} test grep "$@" awk then export then printf 2>/dev/null
+		${HOME} test -eu awk /usr/bin x=1 sed printf echo
+		grep export -eu done $(pwd)
+		awk && -eu echo 'quoted text' | grep 2>/dev/null cd sed /usr/bin 2>/dev/null sed
+done awk --verbose "$1" "$@" 'quoted text'
+${HOME} /usr/bin local export $(pwd) readonly && export && local grep
+done 2>/dev/null then | test 2>/dev/null -eu $(pwd) awk export sed 2>/dev/null
+		then /usr/bin grep grep sed "$@" test "$@" export awk "$@" | cd 'quoted text'
+		${HOME} 2>/dev/null sed then -eu $(pwd) local export
+readonly cd echo awk x=1 then readonly 'quoted text'
+	2>/dev/null grep ${HOME} printf cd -eu echo awk done --verbose
+	readonly | "$1" | "$@"
+"$1" -eu local x=1 readonly x=1 echo && awk $(pwd)
+		&& 'quoted text' grep sed awk $(pwd) done
+	test echo sed 'quoted text'
+		sed /usr/bin export x=1 | --verbose
+		cd ${HOME} --verbose grep awk then local "$1" cd "$1" -eu -eu cd printf export
+		&& echo --verbose --verbose awk ${HOME} $(pwd) &&
+		"$@" -eu readonly test $(pwd) export export && | sed
+	echo done printf done sed /usr/bin && ${HOME} awk "$@" | ${HOME}
+	-eu --verbose | && /usr/bin
+		export sed x=1 echo printf grep -eu --verbose x=1 test
+x=1 "$@" printf test 2>/dev/null
+	--verbose awk | cd test "$@" sed grep done ${HOME}
+	$(pwd) awk readonly cd echo 2>/dev/null
+&& sed grep done "$1" 'quoted text'
+		"$@" awk export --verbose echo "$@" readonly ${HOME} |
+	printf test "$1" | grep test
+		/usr/bin done printf grep -eu && ${HOME} done echo --verbose grep -eu
+readonly x=1 readonly done --verbose then
+		"$@" x=1 awk done grep ${HOME} /usr/bin awk printf
+	--verbose export then sed test "$@" test sed sed grep cd x=1 printf
+	2>/dev/null --verbose export grep ${HOME} 2>/dev/null export sed
+	printf --verbose /usr/bin printf |
+		then then x=1 | /usr/bin
+	export printf done /usr/bin $(pwd)
+		"$@" "$1" ${HOME} test /usr/bin awk &&
+	echo 'quoted text' -eu $(pwd) echo
+	2>/dev/null sed awk -eu /usr/bin export ${HOME} printf 'quoted text'
+	'quoted text' readonly "$1" 'quoted text' "$@" "$1" && sed readonly x=1 done
+		&& cd | printf sed -eu 2>/dev/null "$1" ${HOME} readonly
+$(pwd) ${HOME} 'quoted text' printf local "$1" echo local awk echo ${HOME} then
+		'quoted text' -eu /usr/bin
+		test | --verbose cd test --verbose export grep 2>/dev/null export
+	done x=1 "$@" grep 2>/dev/null done | "$@" echo "$1"
+		'quoted text' export $(pwd) 'quoted text' 'quoted text' | cd done 'quoted text'
+	cd | x=1 cd ${HOME} --verbose
+		"$1" echo local --verbose done readonly
+		readonly echo printf readonly $(pwd) printf awk echo "$@" cd x=1 grep echo ${HOME}
+test /usr/bin | ${HOME} readonly sed printf $(pwd) awk export export
+	--verbose --verbose local 2>/dev/null ${HOME} local
+awk x=1 local test awk test awk | test "$1" export | local awk
+--verbose export /usr/bin then cd -eu | then /usr/bin &&
+sed x=1 2>/dev/null -eu then $(pwd) $(pwd) | test 'quoted text' -eu $(pwd) && --verbose
+		export echo readonly done ${HOME} echo awk | awk && 'quoted text' 'quoted text'
+then export /usr/bin echo
+		&& x=1 test readonly 'quoted text' && x=1
+	cd export x=1 sed /usr/bin && grep ${HOME} $(pwd)
+	test cd local awk ${HOME} 2>/dev/null grep $(pwd)
+export done ${HOME} export 2>/dev/null then ${HOME} done grep x=1
+		${HOME} echo | test 'quoted text' /usr/bin x=1 | done
+then export done then "$1" export cd grep -eu | "$@" x=1 echo export then /usr/bin
+	then x=1 local $(pwd) local "$1" export grep ${HOME} | "$1" echo "$@"
+		--verbose cd 2>/dev/null cd test local
+	test ${HOME} /usr/bin awk 2>/dev/null 'quoted text'
+		/usr/bin | $(pwd) printf 2>/dev/null printf x=1 printf |
+		local x=1 && done ${HOME} done "$1" ${HOME} ${HOME}
+	test readonly 'quoted text' --verbose "$@" grep test grep
+	x=1 /usr/bin local && printf --verbose sed grep 2>/dev/null --verbose
+		awk 'quoted text' then /usr/bin test "$1" printf
+sed 2>/dev/null then local ${HOME} "$@"
+"$1" --verbose "$@" export grep test test printf readonly
+	test cd grep sed -eu ${HOME} --verbose
+	--verbose sed echo $(pwd) sed "$@" test "$@" done
+&& grep test sed "$1" "$@"
+	&& 'quoted text' echo 2>/dev/null cd 'quoted text'
+	awk $(pwd) export then "$1" local test export "$1"
+	sed 2>/dev/null test printf cd
+		echo then 2>/dev/null 2>/dev/null printf cd 'quoted text'
+	&& test --verbose 'quoted text' local export && done readonly test done local
+		sed readonly echo export 'quoted text' awk
+		--verbose done sed sed | then
+	| done then test local grep "$@" awk x=1 awk 'quoted text' /usr/bin
+-eu --verbose readonly -eu sed awk grep && 'quoted text'
+done x=1 $(pwd) "$1" printf printf sed x=1 /usr/bin local -eu grep && $(pwd) printf
+awk done && x=1 x=1 "$@" test grep done readonly
+	$(pwd) done 'quoted text' "$1" done /usr/bin 'quoted text' test
+	"$@" "$1" "$1" sed "$@" /usr/bin local awk sed then ${HOME}
+2>/dev/null ${HOME} | printf |
+		done test local echo x=1 --verbose 'quoted text' x=1
+	then x=1 $(pwd) printf "$@" /usr/bin
+	/usr/bin 2>/dev/null printf then sed sed echo export printf test
+2>/dev/null "$@" echo local cd |
+	| "$1" "$@" test --verbose then 2>/dev/null "$@" local then done
+		printf | printf cd export "$1" ${HOME} readonly -eu $(pwd) ${HOME}
+		$(pwd) sed export --verbose export | sed then "$@" 'quoted text'
+	/usr/bin export awk test ${HOME}
+		| readonly readonly 'quoted text' printf readonly x=1 echo ${HOME}
+		"$@" local $(pwd) export
+		cd && 2>/dev/null && printf printf test "$1" done $(pwd) awk 'quoted text'
+		echo /usr/bin $(pwd) | cd /usr/bin cd echo local cd local --verbose
+	echo sed cd readonly "$@" export printf then 'quoted text' -eu /usr/bin
+		printf | x=1 x=1 ${HOME} $(pwd) local done cd export
+	grep | printf --verbose done awk /usr/bin &&
+		/usr/bin 2>/dev/null | local x=1 -eu awk --verbose printf grep sed awk echo test
+local | then readonly export 'quoted text'
+		cd then ${HOME} $(pwd)
+'quoted text' --verbose -eu sed sed
+| /usr/bin $(pwd) --verbose export | sed 'quoted text' readonly --verbose
+		echo local printf --verbose -eu $(pwd) grep grep cd done echo
+awk 'quoted text' -eu /usr/bin "$1" readonly
+		$(pwd) readonly export awk | printf export grep
+	"$@" | printf printf -eu &&
+	2>/dev/null grep --verbose 'quoted text'
+/usr/bin then && /usr/bin then $(pwd) sed | echo --verbose
+	$(pwd) test /usr/bin sed 2>/dev/null readonly
+awk && x=1 local "$1" -eu "$@" then cd done ${HOME} then 'quoted text'
+		--verbose $(pwd) "$@" then "$1" $(pwd) printf "$1" --verbose sed && readonly
+		grep cd cd cd sed done -eu awk
+		sed readonly 'quoted text' awk ${HOME} 2>/dev/null then --verbose |
+${HOME} sed $(pwd) $(pwd) echo cd -eu awk /usr/bin
+		$(pwd) "$1" printf x=1 | done grep then "$@" x=1 "$@" "$@" ${HOME} x=1 export
+awk 2>/dev/null ${HOME} --verbose
+	| then readonly export local x=1 ${HOME} grep 'quoted text' grep
+readonly awk $(pwd) sed /usr/bin && awk
+	export awk done printf export -eu test local && then "$@" -eu local
+cd /usr/bin /usr/bin 2>/dev/null export "$1" -eu readonly local
+		$(pwd) /usr/bin readonly done export x=1 /usr/bin then grep /usr/bin cd
+		export --verbose $(pwd) awk
+done export x=1 done done test x=1 export -eu "$@"
+grep then --verbose /usr/bin | readonly cd then x=1 2>/dev/null
+	local x=1 'quoted text' printf -eu readonly
+		--verbose done echo -eu printf --verbose test done test 'quoted text'
+	| ${HOME} /usr/bin -eu && "$1" &&
+echo grep readonly echo 'quoted text' 2>/dev/null 'quoted text'
+		/usr/bin 2>/dev/null grep readonly
+sed | "$1" cd test awk awk && awk && cd
+-eu "$@" awk 2>/dev/null /usr/bin -eu | echo echo "$1" -eu "$1" printf --verbose
+	--verbose /usr/bin done then "$@"
+-eu x=1 ${HOME} --verbose /usr/bin
+		echo "$@" test local 'quoted text' 'quoted text' test
+"$@" -eu export done grep readonly 'quoted text' local ${HOME} --verbose
+	-eu cd printf && && $(pwd)
+x=1 'quoted text' grep local grep --verbose test local 2>/dev/null &&
+		-eu test -eu printf then "$1" 'quoted text' grep grep printf done
+${HOME} /usr/bin --verbose /usr/bin 'quoted text' awk sed sed 'quoted text'
+	'quoted text' cd "$1" sed test sed sed then cd
+		awk cd then done "$@" export awk "$@" printf local ${HOME} test readonly
+	printf grep "$@" "$@" x=1 readonly
+	local printf cd done -eu ${HOME} "$1" 2>/dev/null echo
+echo "$@" ${HOME} cd awk export test
+		"$1" printf ${HOME} export
+		local ${HOME} "$@" sed test readonly printf done printf "$1" && test local
+	2>/dev/null "$1" -eu x=1 printf cd -eu test local export readonly test
+		-eu then sed echo cd echo echo x=1 $(pwd) 'quoted text' x=1 x=1 then
+	sed export echo awk "$1" 2>/dev/null local cd 2>/dev/null
+	"$@" x=1 sed ${HOME} x=1
+	export done then echo export echo
+	&& --verbose cd cd $(pwd) /usr/bin --verbose cd
+printf "$@" printf x=1 /usr/bin --verbose
+| && test --verbose | 2>/dev/null /usr/bin ${HOME} "$@" x=1
+	${HOME} printf x=1 done readonly 2>/dev/null
+	&& -eu sed ${HOME} awk x=1 -eu awk export
+		then sed 2>/dev/null done test done readonly
+	test awk && test --verbose 2>/dev/null grep echo local 'quoted text'
+		awk $(pwd) grep cd | echo grep readonly printf 2>/dev/null
+		2>/dev/null awk echo
+	done ${HOME} grep awk awk $(pwd)
+	--verbose -eu 2>/dev/null "$@" readonly readonly cd x=1 test local ${HOME}
+cd echo printf x=1 echo --verbose
+awk "$@" 'quoted text' | test 'quoted text' awk test test --verbose grep
+	2>/dev/null readonly --verbose
+		2>/dev/null test printf grep "$@" "$1" local | readonly
+	/usr/bin echo "$@" 'quoted text' 2>/dev/null
+		cd "$@" sed then 2>/dev/null
+		test x=1 test /usr/bin printf 2>/dev/null /usr/bin grep && done --verbose
+	"$@" readonly printf local ${HOME} $(pwd) cd echo
+	grep 2>/dev/null awk export /usr/bin "$1" "$@" awk local x=1 test /usr/bin
+		cd $(pwd) "$@" readonly ${HOME} -eu 2>/dev/null -eu 2>/dev/null
+/usr/bin x=1 x=1 --verbose cd ${HOME} && printf done
+	--verbose printf awk echo
+	export local readonly /usr/bin
+	readonly -eu then printf local grep 2>/dev/null test export
+	test echo $(pwd) then echo && local local 'quoted text' --verbose printf
+		printf test local cd $(pwd) then
+	echo sed "$1" $(pwd) sed -eu done "$@" "$1" echo $(pwd)
+	"$@" done cd sed 2>/dev/null cd grep done $(pwd)
+		then x=1 local 'quoted text' "$1" grep readonly "$@" test "$1" 'quoted text' done
+'quoted text' local printf 'quoted text' printf
+	local readonly 2>/dev/null printf | x=1 export grep local sed then "$@" --verbose
+		export export --verbose -eu grep cd export -eu echo sed grep echo test
+		${HOME} $(pwd) 2>/dev/null 2>/dev/null done x=1
+		test --verbose then test -eu awk then
+		grep "$1" local x=1 printf --verbose --verbose printf done && && export
+	export done -eu echo 2>/dev/null
+	--verbose readonly 2>/dev/null ${HOME}
+	grep && local ${HOME} -eu awk cd grep "$@" 'quoted text' export then
+'quoted text' export /usr/bin local export |
+test echo readonly && readonly local echo && test "$@" "$1" 'quoted text' | export
+	printf 'quoted text' local printf echo 2>/dev/null
+	cd -eu | ${HOME} test done 2>/dev/null /usr/bin x=1 x=1 cd printf && readonly |
+/usr/bin cd "$1" 'quoted text'
+		grep readonly awk readonly "$1"
+		awk "$@" /usr/bin then sed export
+	readonly readonly local echo "$1" readonly /usr/bin -eu local &&
+		/usr/bin && grep readonly printf 'quoted text'
+	cd -eu /usr/bin --verbose /usr/bin | "$@"
+		grep local export local
+		"$1" printf export awk export grep ${HOME} | grep readonly readonly
+/usr/bin done sed 'quoted text'
+	/usr/bin readonly /usr/bin cd echo "$1" local test then then test
+		export 2>/dev/null ${HOME}
+		'quoted text' "$1" cd x=1 done printf 'quoted text'
+| readonly | "$1" done "$1" 2>/dev/null && /usr/bin
+	awk done printf 2>/dev/null
+		${HOME} /usr/bin && $(pwd) x=1 export
+"$1" echo readonly ${HOME} x=1 -eu echo --verbose /usr/bin ${HOME}
+		${HOME} printf 2>/dev/null -eu test cd --verbose
+		| grep ${HOME} grep 2>/dev/null sed 2>/dev/null -eu "$@" test local "$@" -eu "$@"
+	sed x=1 'quoted text' x=1 test printf $(pwd)
+	printf ${HOME} "$1" export printf ${HOME} "$@" ${HOME} awk awk then readonly echo
+		'quoted text' /usr/bin ${HOME}
+	/usr/bin $(pwd) cd $(pwd) x=1 readonly sed "$@" -eu 'quoted text' test readonly
+/usr/bin "$@" grep |
+	local readonly grep /usr/bin test export x=1 "$@" -eu
+		$(pwd) echo && cd -eu export readonly "$@" 'quoted text' $(pwd) printf
+$(pwd) printf test && x=1 "$@" /usr/bin && then readonly echo local
+	echo /usr/bin | then sed export
+grep printf export 'quoted text' awk cd
+		| 'quoted text' readonly sed 'quoted text'
+		printf grep 2>/dev/null
+sed grep "$@" echo ${HOME}
+		test $(pwd) && -eu printf echo && grep done ${HOME} x=1 printf
+	local then grep printf then then
+test awk /usr/bin cd -eu grep then done test $(pwd)
+	done cd /usr/bin /usr/bin && printf 'quoted text'
+then done --verbose /usr/bin | "$1" awk --verbose awk echo
+		2>/dev/null x=1 'quoted text' $(pwd) "$1" test
+grep local ${HOME} | done sed | /usr/bin x=1 "$1" 2>/dev/null /usr/bin
+		${HOME} 2>/dev/null export echo ${HOME} sed -eu 'quoted text'
+		printf local awk echo sed /usr/bin "$1" printf 2>/dev/null
+	readonly echo $(pwd) --verbose local export local export echo "$@" "$1"
+		export printf x=1 2>/dev/null export then grep && $(pwd) ${HOME}
+	awk /usr/bin local awk --verbose && 'quoted text' "$1" readonly local ${HOME}
+		$(pwd) grep /usr/bin ${HOME} | readonly test
+	"$1" | then -eu echo grep awk && 2>/dev/null
+		test 'quoted text' --verbose then "$1"
+	${HOME} echo done x=1 readonly local sed sed "$1" $(pwd) 2>/dev/null grep "$@"
+		x=1 --verbose $(pwd) local test test 2>/dev/null readonly
+2>/dev/null grep && | /usr/bin sed local export test ${HOME} grep
+local echo sed 2>/dev/null echo awk /usr/bin
+2>/dev/null "$@" export test ${HOME}
+'quoted text' grep readonly echo ${HOME} done "$1" local grep && $(pwd) local
+	${HOME} cd grep cd /usr/bin then awk --verbose
+		-eu grep echo && ${HOME} ${HOME} readonly $(pwd) "$@" x=1 done
+		--verbose --verbose --verbose ${HOME} awk test echo && test
+2>/dev/null sed $(pwd) sed test
+		x=1 $(pwd) then "$1" awk test local then "$1"
+		then echo --verbose sed export grep x=1 export grep awk ${HOME} then $(pwd)
+grep sed cd $(pwd) then 2>/dev/null && readonly --verbose "$@" "$1" x=1 $(pwd)
+sed -eu /usr/bin 2>/dev/null 2>/dev/null /usr/bin ${HOME} echo 2>/dev/null done
+	echo grep --verbose 2>/dev/null
+	printf --verbose 2>/dev/null printf
+		'quoted text' /usr/bin
+x=1 'quoted text' cd local
+"$1" grep 2>/dev/null readonly awk then local "$@" then local $(pwd)
+		"$1" && printf awk -eu readonly cd awk awk export test --verbose x=1 'quoted text'
+x=1 readonly test x=1 awk
+	'quoted text' done 'quoted text' cd "$1" cd x=1 --verbose
+		| /usr/bin x=1 x=1 sed --verbose
+		cd sed readonly "$@" echo 'quoted text' awk 2>/dev/null ${HOME} && printf
+x=1 test && -eu 'quoted text' --verbose ${HOME}
+		test -eu --verbose printf /usr/bin readonly echo then
+	&& "$1" "$@" 'quoted text' -eu done sed test export ${HOME} ${HOME} grep ${HOME}
+	2>/dev/null 2>/dev/null 'quoted text'
+	cd $(pwd) export done 'quoted text' export
+		${HOME} ${HOME} 2>/dev/null ${HOME} -eu | done export test $(pwd)
+	&& "$@" awk readonly --verbose 'quoted text' $(pwd) then
+then echo done done 'quoted text' && local && done 2>/dev/null $(pwd) -eu local
+| printf -eu echo local "$@" 2>/dev/null
+		| echo printf x=1 2>/dev/null echo
+echo | $(pwd) then "$@" printf $(pwd) printf
+		local 2>/dev/null /usr/bin grep cd 2>/dev/null echo "$@" /usr/bin export 'quoted text'
+		done x=1 cd grep done echo local done /usr/bin -eu /usr/bin
+		x=1 local echo /usr/bin then local 'quoted text' "$@" then --verbose local awk /usr/bin
+	printf 2>/dev/null --verbose readonly sed test grep -eu --verbose ${HOME} "$1" &&
+		| && sed && ${HOME} x=1 'quoted text' awk test "$1" /usr/bin -eu
+"$1" export printf ${HOME} done $(pwd)
+		export then "$@" | grep export ${HOME} done ${HOME}
+		then /usr/bin readonly grep 'quoted text' 'quoted text' then sed local ${HOME}
+x=1 /usr/bin then export local -eu awk x=1
+--verbose cd 'quoted text' /usr/bin -eu "$@" --verbose
+		done done | done 'quoted text' -eu | awk x=1 ${HOME} cd --verbose
+		'quoted text' echo $(pwd) readonly | -eu $(pwd) $(pwd) export -eu sed test
+		awk sed grep x=1 readonly done /usr/bin 'quoted text'
+-eu printf "$1" -eu test /usr/bin "$1" "$1" echo x=1 "$@" "$1" export --verbose
+		printf cd "$1" done /usr/bin ${HOME} test
+/usr/bin test sed 'quoted text'
+		printf grep grep then ${HOME} 2>/dev/null "$@" && | export && /usr/bin test test
+		'quoted text' 2>/dev/null
+		-eu -eu local sed sed ${HOME} 'quoted text'
+--verbose x=1 --verbose && sed --verbose "$1" printf
+		printf 2>/dev/null ${HOME} 2>/dev/null -eu ${HOME} | cd && readonly grep | |
+cd $(pwd) 'quoted text' local test test
+$(pwd) export 2>/dev/null 2>/dev/null
+	printf done echo -eu readonly export export grep
+	&& readonly printf $(pwd) $(pwd) $(pwd) sed sed "$1"
+		"$1" export done 2>/dev/null
+grep 2>/dev/null test | echo $(pwd) -eu export readonly awk &&
+awk cd 'quoted text' done readonly -eu readonly
+local | $(pwd) readonly ${HOME} then done test | "$1" sed done x=1 local --verbose
+| export "$@" -eu then --verbose readonly awk then $(pwd) export
+sed --verbose cd x=1 "$1" sed x=1 --verbose
+	sed && test export awk done sed x=1 "$1" then
+	export echo "$1" local grep ${HOME} test done 'quoted text'
+	/usr/bin && | done done 'quoted text' export
+	printf then "$@" ${HOME} local -eu 2>/dev/null echo
+readonly export sed -eu /usr/bin --verbose $(pwd) printf 'quoted text'
+	$(pwd) echo "$@" done grep
+printf echo x=1 done done ${HOME} export then done readonly printf "$1"
+printf /usr/bin grep ${HOME} --verbose done
+echo done /usr/bin then 2>/dev/null &&
+		'quoted text' export cd 'quoted text' ${HOME} -eu && echo 'quoted text'
+	export local test 2>/dev/null -eu printf cd "$1" echo sed $(pwd) cd | /usr/bin
+		test "$@" grep local cd then ${HOME} done "$1" echo awk echo | "$@" /usr/bin
+		test && "$1" export ${HOME} awk -eu
+		&& ${HOME} printf readonly readonly $(pwd) done 2>/dev/null sed
+"$1" test export printf awk test local echo -eu done cd
+cd && /usr/bin sed x=1 x=1 x=1 echo 2>/dev/null grep sed | -eu $(pwd) grep local
+		local "$@" "$@" then 'quoted text' 2>/dev/null
+	$(pwd) /usr/bin echo sed
+		done echo 'quoted text' $(pwd)
+		sed -eu sed && readonly && cd sed x=1 cd ${HOME}
+	then export "$1" local "$@" 2>/dev/null
+	then ${HOME} --verbose "$@" export ${HOME} export echo && |
+	readonly && && /usr/bin $(pwd) x=1 | "$1" && && |
+		export && printf export -eu grep local awk
+	cd | | 2>/dev/null -eu 2>/dev/null "$1" && | /usr/bin 2>/dev/null
+then && readonly echo export | grep x=1 $(pwd)
+		grep local "$@" export printf
+done test awk export x=1 -eu sed local done /usr/bin "$1" x=1 grep
+		awk grep echo 2>/dev/null && printf
+	echo grep -eu && x=1 'quoted text' -eu export | echo cd
+		echo -eu export echo printf cd -eu x=1 --verbose /usr/bin
+		cd local echo sed export | "$1" && $(pwd) test printf cd awk echo
+	${HOME} test 2>/dev/null cd
+	&& printf done local sed printf echo grep sed done sed
+	"$1" grep sed export local done grep && ${HOME}
+		-eu /usr/bin cd done awk x=1 awk done echo echo x=1 awk --verbose
+		printf printf | cd --verbose 2>/dev/null cd echo sed echo $(pwd) awk ${HOME}
+	export "$@" readonly "$@" echo x=1 echo printf done awk export "$1"
+	awk export --verbose "$1" | then 'quoted text'
+		--verbose export then 'quoted text'
+	"$@" --verbose /usr/bin readonly then export && done local
+		| export cd done | grep grep
+awk echo | "$1" cd "$@" "$@" local printf
+	printf test 'quoted text' $(pwd) grep -eu awk $(pwd) grep /usr/bin cd x=1
+	test done awk --verbose /usr/bin "$1" grep done
+	"$@" echo x=1 2>/dev/null ${HOME} echo export
+	then cd && /usr/bin /usr/bin local then
+awk --verbose sed "$1" -eu echo 2>/dev/null local
+sed -eu ${HOME} then grep sed "$1" then printf
+awk x=1 "$@" 2>/dev/null
+-eu cd export --verbose &&
+	/usr/bin "$1" "$1" sed $(pwd) 2>/dev/null cd grep "$@" $(pwd) awk &&
+readonly ${HOME} echo $(pwd) x=1 --verbose done export --verbose awk cd
+		"$1" awk -eu /usr/bin && --verbose ${HOME} | grep /usr/bin
+		sed "$1" && cd 2>/dev/null 'quoted text'
+export -eu local local ${HOME} export
+	readonly && readonly then cd
+	/usr/bin done readonly grep 2>/dev/null ${HOME} -eu test cd echo $(pwd)
+/usr/bin export readonly --verbose readonly sed
+	cd -eu --verbose local
+test sed && "$1" 'quoted text' 2>/dev/null "$@" printf test awk "$1" "$1" grep
+		done printf /usr/bin test -eu
+	"$1" local test ${HOME} --verbose echo awk done grep export
+echo "$@" ${HOME} x=1 test 2>/dev/null
+readonly x=1 -eu 'quoted text'
+	${HOME} --verbose && awk sed grep done ${HOME}
+	local -eu x=1 "$@" "$@" -eu && 2>/dev/null --verbose awk /usr/bin
+${HOME} && printf readonly -eu --verbose echo $(pwd) --verbose
+x=1 awk "$@" sed -eu $(pwd) echo test $(pwd) $(pwd) | 2>/dev/null
+echo 2>/dev/null --verbose export awk "$@" sed /usr/bin done
+		readonly echo && --verbose -eu
+test "$@" -eu | sed test grep 'quoted text' "$@" sed -eu
+		| export ${HOME} --verbose then x=1
+'quoted text' && /usr/bin --verbose x=1 $(pwd) /usr/bin
+		&& awk -eu export printf "$1" cd local 'quoted text' grep
+	awk printf -eu awk grep sed | 'quoted text' awk export "$1" echo 2>/dev/null
+	x=1 test 'quoted text' $(pwd)
+'quoted text' done ${HOME}
+		printf test awk "$1" then export 2>/dev/null "$1" -eu 'quoted text'
+	-eu /usr/bin x=1 $(pwd) sed then readonly "$1" readonly printf
+		printf sed sed ${HOME} test 'quoted text'
+echo x=1 awk $(pwd) grep done ${HOME} "$@" local "$1" -eu
+test done test printf && "$@"
+		grep echo "$@" echo readonly printf 'quoted text' "$@" test
+$(pwd) then x=1 x=1 local /usr/bin
+		$(pwd) "$1" local export sed &&
+		awk cd --verbose 2>/dev/null --verbose /usr/bin "$@" --verbose echo
+done "$@" cd local --verbose --verbose
+	export x=1 2>/dev/null readonly 'quoted text'
+	$(pwd) cd && "$1" 2>/dev/null printf "$@" $(pwd) printf --verbose printf sed
+		${HOME} "$1" then then done then -eu cd echo export && local sed 'quoted text'
+		/usr/bin | export "$1" done && printf x=1 && printf printf /usr/bin
+		"$@" echo x=1 ${HOME} 'quoted text' | sed export 2>/dev/null test
+cd printf "$@" && local export awk done x=1 test && 'quoted text'
+	readonly -eu awk ${HOME} /usr/bin ${HOME}
+"$@" export awk grep 'quoted text' cd -eu -eu
+		2>/dev/null && && | printf echo ${HOME} cd --verbose
+"$1" readonly -eu 2>/dev/null /usr/bin
+		"$@" --verbose "$@" printf awk printf then sed export cd
+		readonly then 'quoted text' done grep cd
+		"$@" readonly test echo local done | x=1 -eu local printf
+sed "$1" test /usr/bin
+		done readonly cd | 'quoted text' $(pwd) grep ${HOME} sed
+		"$1" /usr/bin readonly export local "$1"
+&& sed -eu echo -eu local cd grep 'quoted text' then done sed awk export
+'quoted text' echo ${HOME}
+		readonly "$1" | && readonly x=1
+	test && && done ${HOME} local --verbose && printf "$1"
+		local x=1 done then done x=1 readonly
+${HOME} $(pwd) --verbose | export --verbose grep readonly --verbose
+		local export readonly -eu echo awk grep echo echo | done
+"$@" /usr/bin --verbose printf 2>/dev/null test export
+		&& 2>/dev/null export --verbose grep
+	${HOME} x=1 'quoted text' printf
+	$(pwd) test awk /usr/bin /usr/bin /usr/bin /usr/bin grep | --verbose 2>/dev/null
+		then 2>/dev/null readonly | export "$@" --verbose /usr/bin /usr/bin local 'quoted text'
+	echo 2>/dev/null | 'quoted text'
+$(pwd) grep grep done done && --verbose ${HOME}
+-eu "$@" 2>/dev/null --verbose sed | test /usr/bin
+	-eu then "$1" ${HOME} done then ${HOME} ${HOME} grep local -eu
+echo x=1 "$@" test && awk readonly 'quoted text' x=1 printf ${HOME} cd -eu cd
+	grep 2>/dev/null x=1 echo awk && local grep $(pwd) test
+local x=1 echo done 'quoted text' 2>/dev/null
+export 2>/dev/null printf printf ${HOME} x=1 sed
+	test export done x=1 done export grep readonly "$@"
+	--verbose done /usr/bin x=1 sed printf
+	-eu local "$@" done -eu awk $(pwd) test /usr/bin then local test | &&
+	cd x=1 then local x=1 sed printf
+		then "$1" "$@" done readonly 2>/dev/null ${HOME} -eu ${HOME} done cd x=1 then grep
+		--verbose && awk 'quoted text' && -eu -eu 'quoted text'
+grep sed "$@" readonly $(pwd) cd awk local -eu echo test
+		--verbose echo x=1 local done cd echo
+	--verbose && x=1 'quoted text' $(pwd) awk "$@" done -eu $(pwd) 'quoted text' readonly
+	"$1" -eu && ${HOME} && /usr/bin 'quoted text' local --verbose ${HOME}
+	printf x=1 $(pwd) 2>/dev/null sed local "$1" test --verbose --verbose
+		then | -eu grep /usr/bin done | x=1 "$1" "$@" printf echo cd $(pwd) "$1" "$@" awk
+		sed /usr/bin then printf 2>/dev/null "$@" "$1" /usr/bin
+		export printf done sed 2>/dev/null --verbose
+		$(pwd) grep cd awk ${HOME} /usr/bin
+-eu grep local 'quoted text' 2>/dev/null
+		done ${HOME} cd printf 2>/dev/null | done $(pwd) "$1" export --verbose ${HOME}
+		x=1 $(pwd) 'quoted text' export readonly "$1" export local -eu cd
+"$@" ${HOME} readonly grep 'quoted text' grep grep -eu x=1 | "$@" 'quoted text'
+	done sed printf local sed "$@"
+cd && printf -eu && /usr/bin sed "$@" then | $(pwd) done awk $(pwd)
+"$1" grep && sed printf then test 'quoted text' "$@" 2>/dev/null
+	'quoted text' "$@" grep 2>/dev/null 2>/dev/null -eu awk "$@"
+local done readonly /usr/bin done cd grep -eu "$@" 'quoted text'
+echo awk "$@" "$1" local readonly -eu cd printf awk "$1" /usr/bin |
+	printf && -eu sed then "$@" --verbose readonly readonly --verbose
+	echo export done export 2>/dev/null
+	echo /usr/bin then then test $(pwd) cd --verbose
+	/usr/bin grep then then awk ${HOME}
+		--verbose cd -eu 'quoted text' test "$@" --verbose -eu "$@" export ${HOME}
+test then --verbose sed local "$1" -eu && $(pwd) sed "$@" printf 2>/dev/null
+	| "$1" readonly ${HOME} -eu export "$1" "$1" awk
+	"$1" "$1" $(pwd) $(pwd) --verbose
+		awk 2>/dev/null /usr/bin -eu | && 'quoted text' -eu awk
+/usr/bin grep readonly --verbose grep --verbose | sed 2>/dev/null
+2>/dev/null then /usr/bin 'quoted text' ${HOME} 2>/dev/null
+		${HOME} 'quoted text' -eu export -eu sed 2>/dev/null
+		--verbose && "$@" -eu done printf -eu test --verbose "$@" local
+/usr/bin grep export readonly export
+2>/dev/null | awk /usr/bin awk x=1 export
+		2>/dev/null x=1 readonly awk "$1" printf
+	| sed ${HOME} 'quoted text' done
+		sed cd | readonly 'quoted text' readonly 'quoted text'
+	-eu ${HOME} ${HOME} sed awk grep $(pwd) | && grep -eu $(pwd) $(pwd) then x=1
+	grep && "$1" grep /usr/bin &&
+		done sed local -eu "$@" 2>/dev/null
+		/usr/bin 'quoted text' | readonly test local readonly "$1" export sed done
+	then ${HOME} sed $(pwd) test test $(pwd) echo "$1" grep $(pwd) "$1"
+&& | 'quoted text' $(pwd) | $(pwd) awk -eu readonly "$1" /usr/bin
+x=1 export ${HOME} | "$@" 2>/dev/null x=1 printf x=1 x=1 awk /usr/bin ${HOME}
+	export local 2>/dev/null | sed --verbose
+	grep --verbose "$@" && x=1 done test 'quoted text' 2>/dev/null export then then
+	&& sed sed 'quoted text' $(pwd) 'quoted text' "$1" -eu awk local
+		local cd | "$1" && | "$1" --verbose sed then --verbose ${HOME} cd readonly
+echo --verbose then then
+readonly awk ${HOME} "$1" /usr/bin 2>/dev/null sed x=1 cd sed then
+	sed && readonly echo test readonly
+	-eu /usr/bin "$1" export
+		/usr/bin && && --verbose
+	--verbose then export $(pwd)
+printf export export readonly $(pwd) x=1
+	export echo test -eu local
+"$1" -eu printf readonly printf x=1 "$@" "$@" printf test
+	| local then 2>/dev/null /usr/bin done done ${HOME} export --verbose
+then 'quoted text' local
+	-eu /usr/bin -eu sed local done export printf 2>/dev/null printf
+echo && $(pwd) -eu x=1 grep local && /usr/bin 'quoted text' "$1" echo done
+		/usr/bin /usr/bin 'quoted text' && x=1 cd sed | export then test
+		test ${HOME} readonly $(pwd) done 2>/dev/null
+	"$@" -eu done "$@" | /usr/bin $(pwd) export
+		2>/dev/null readonly /usr/bin test test x=1 2>/dev/null
+	$(pwd) cd cd test then printf x=1 ${HOME} "$@" done ${HOME}
+		-eu ${HOME} /usr/bin export /usr/bin 'quoted text' grep x=1 echo
+		test test 'quoted text' sed -eu cd
+	${HOME} $(pwd) "$@" $(pwd) | ${HOME} "$1"
+		'quoted text' 2>/dev/null "$1" -eu cd 2>/dev/null readonly -eu ${HOME}
+		&& export /usr/bin 2>/dev/null
+	readonly local 'quoted text' readonly echo cd test -eu echo $(pwd)
+		$(pwd) cd cd 'quoted text' 'quoted text'
+${HOME} readonly --verbose ${HOME} echo local | 2>/dev/null awk
+	"$1" printf echo printf export x=1 printf ${HOME}
+	awk "$@" 'quoted text' printf done sed readonly 'quoted text' then cd x=1
+	sed echo local /usr/bin readonly local cd --verbose
+		readonly x=1 /usr/bin ${HOME} local x=1 "$@" cd awk local cd cd ${HOME}
+		printf 2>/dev/null readonly cd $(pwd) readonly export echo
+awk readonly x=1 ${HOME} "$@" echo ${HOME} echo echo "$@" /usr/bin
+	$(pwd) echo export cd test ${HOME} sed
+		cd 'quoted text' cd --verbose "$1" -eu x=1 "$1" echo awk printf
+		&& grep test sed grep done && awk --verbose local ${HOME} awk test echo grep
+x=1 sed done -eu | --verbose printf --verbose local x=1 done
+		then ${HOME} $(pwd) cd readonly | grep readonly /usr/bin -eu test --verbose
+	echo then printf test 2>/dev/null awk
+	'quoted text' echo --verbose
+export export /usr/bin --verbose "$@"
+echo x=1 then ${HOME} "$1" && sed cd && "$@" grep done "$1" | awk 'quoted text'
+		${HOME} | test echo "$@" ${HOME} then 2>/dev/null
+	"$1" local export | sed export | "$@" then "$@" | "$@"
+		export printf done printf ${HOME} grep sed
+	printf sed echo --verbose sed $(pwd) /usr/bin test echo $(pwd) x=1 /usr/bin cd &&
+	| x=1 && awk --verbose awk --verbose
+	done done ${HOME} done && ${HOME} && awk 2>/dev/null export printf local printf
+		$(pwd) $(pwd) 2>/dev/null then && awk
+	-eu cd 2>/dev/null test $(pwd) export && | $(pwd)
+	printf ${HOME} local test
+		"$1" x=1 && sed readonly 'quoted text'
+readonly test sed echo 'quoted text' ${HOME} export "$1"
+&& 2>/dev/null && && 'quoted text'
+		2>/dev/null then local | -eu
+		${HOME} echo /usr/bin 'quoted text' && /usr/bin echo printf grep export
+	$(pwd) then grep 2>/dev/null export readonly readonly export "$@" echo /usr/bin
+		awk -eu test test | test cd && readonly x=1 && cd "$@" readonly
+	'quoted text' ${HOME} export "$1" 2>/dev/null /usr/bin
+	--verbose local test done && ${HOME} done "$@" | "$@" $(pwd) readonly
+/usr/bin local echo readonly -eu 'quoted text'
+	| sed printf ${HOME} --verbose then /usr/bin test test cd /usr/bin export
+	'quoted text' awk /usr/bin
+&& local export local --verbose printf /usr/bin
+	2>/dev/null -eu x=1 printf -eu local && && 'quoted text'
+		$(pwd) test grep "$1" awk ${HOME} "$@" "$1" grep 'quoted text'
+		| readonly 2>/dev/null --verbose /usr/bin x=1
+		test /usr/bin "$@" 'quoted text' /usr/bin then
+		test ${HOME} cd grep readonly | /usr/bin 'quoted text' export grep test
+	/usr/bin && | | "$1" cd -eu -eu -eu sed grep
+echo 2>/dev/null echo export x=1 $(pwd) readonly done 'quoted text'
+	printf then grep 'quoted text' /usr/bin local ${HOME} local grep
+-eu $(pwd) 'quoted text' && && "$@" then "$1" && sed --verbose printf done --verbose
+export grep -eu "$@" "$@" cd awk
+'quoted text' /usr/bin -eu x=1 then "$@" done readonly --verbose $(pwd) then
+	cd cd cd printf 'quoted text' grep local -eu readonly
+		cd printf then -eu cd echo echo && /usr/bin &&
+		awk -eu 'quoted text' test test &&
+test cd 2>/dev/null --verbose done
+	export | grep -eu | -eu x=1 && then "$1" 'quoted text' local done
+local $(pwd) "$1" awk -eu sed then x=1 grep /usr/bin 2>/dev/null awk "$1" --verbose
+done --verbose /usr/bin $(pwd) readonly
+		--verbose "$@" then local readonly
+	readonly 'quoted text'
+	sed 2>/dev/null x=1 readonly --verbose then /usr/bin
+	cd cd --verbose grep --verbose "$1"
+		then test sed 2>/dev/null done test x=1 | export /usr/bin readonly grep &&
+	x=1 x=1 done awk x=1 $(pwd) x=1 local 'quoted text' grep ${HOME} x=1 then then
+	'quoted text' --verbose "$@" awk then done "$@" cd | 2>/dev/null 2>/dev/null
+		echo sed -eu ${HOME} "$1" export && ${HOME} 2>/dev/null /usr/bin grep
+		echo ${HOME} export printf then --verbose | /usr/bin
+		${HOME} sed "$1" readonly
+		$(pwd) -eu printf local && $(pwd) ${HOME} "$1"
+		readonly "$@" echo local then export "$@" done
+printf 2>/dev/null -eu /usr/bin | awk awk $(pwd) readonly x=1
+		printf x=1 'quoted text' sed then
+sed awk sed | | "$@" ${HOME} cd 'quoted text' x=1 grep x=1 x=1
+	x=1 && "$@" 2>/dev/null $(pwd) x=1 x=1 'quoted text'
+		export --verbose echo
+--verbose test "$@" -eu sed export
+		echo awk sed grep 2>/dev/null
+export then | export grep /usr/bin sed "$@" then | cd test
+		then printf local printf sed 'quoted text' local &&
+		&& ${HOME} ${HOME} x=1 readonly echo then 2>/dev/null cd | && "$1" readonly then
+	awk ${HOME} printf 2>/dev/null cd 'quoted text' "$1" done && cd cd ${HOME} x=1
+printf -eu awk "$1" ${HOME} export ${HOME} /usr/bin
+	printf echo /usr/bin readonly cd "$1" --verbose x=1 export $(pwd)
+"$@" $(pwd) local grep export awk
+	local printf then 'quoted text' readonly awk "$@" "$1" export
+	then export /usr/bin grep
+local readonly $(pwd) echo grep readonly readonly test 2>/dev/null
+		&& cd grep /usr/bin then
+	--verbose $(pwd) echo done x=1 --verbose echo | 2>/dev/null 2>/dev/null
+	sed 2>/dev/null 2>/dev/null "$@"
+cd $(pwd) local done "$@" local echo 2>/dev/null
+"$1" awk | printf 'quoted text'
+readonly local export printf awk
+${HOME} --verbose && 2>/dev/null
+	test local test x=1 | local "$@" readonly -eu /usr/bin
+	$(pwd) "$1" awk 'quoted text' test 'quoted text'
+		"$@" ${HOME} -eu export awk grep | 'quoted text' readonly sed local
+		grep $(pwd) 2>/dev/null /usr/bin
+	x=1 grep "$1" export -eu x=1 "$@" awk "$@" cd && | local && 2>/dev/null 'quoted text'
+| -eu readonly --verbose && 2>/dev/null printf sed -eu
+		$(pwd) then x=1 cd printf awk "$@" x=1 2>/dev/null echo 2>/dev/null
+export printf done done --verbose x=1 "$@" sed "$@" export echo local test
+		printf grep readonly printf -eu /usr/bin export
+	test $(pwd) readonly readonly 'quoted text'
+done printf sed then "$@" grep sed local cd printf -eu /usr/bin
+	awk -eu cd "$1" awk cd readonly export sed && then
+printf test /usr/bin -eu "$1" then echo echo grep $(pwd) done awk "$1" sed $(pwd)
+x=1 echo printf then "$@"
+cd test $(pwd) | /usr/bin test awk $(pwd)
+$(pwd) ${HOME} then && then readonly
+	2>/dev/null "$@" done grep cd "$1" test "$@" export /usr/bin
+	cd then grep | export grep 2>/dev/null
+		echo grep test | awk "$@" sed echo ${HOME} test readonly $(pwd) done then
+	x=1 | grep grep cd readonly /usr/bin
+	x=1 readonly && readonly export grep test test "$1" 2>/dev/null done echo done
+done 'quoted text' $(pwd) "$1" "$@" "$@" && $(pwd) grep printf
+	"$1" --verbose --verbose x=1 then && x=1 'quoted text' 2>/dev/null /usr/bin
+	&& | export "$@" && done 2>/dev/null "$1" $(pwd) echo then "$@" 2>/dev/null done
+sed test "$1" /usr/bin ${HOME}
+"$@" "$1" | && sed sed echo printf echo ${HOME} awk $(pwd) $(pwd) ${HOME} | export
+/usr/bin then awk "$@" sed done $(pwd) readonly | ${HOME} done --verbose
+	readonly "$@" | | /usr/bin printf done | /usr/bin local printf
+	grep x=1 sed echo done -eu ${HOME} export
+	$(pwd) -eu export grep && x=1
+test echo --verbose 2>/dev/null readonly | "$1" "$@" -eu done echo
+	printf export awk -eu echo x=1 -eu test awk 2>/dev/null /usr/bin --verbose --verbose
+	export $(pwd) echo x=1 /usr/bin
+done 2>/dev/null test /usr/bin printf
+		${HOME} then grep readonly
+grep 2>/dev/null | awk 'quoted text' 'quoted text' local "$1"
+	"$@" cd sed sed "$1" grep awk "$1" done echo -eu ${HOME} readonly
+$(pwd) --verbose done && sed && -eu
+	local $(pwd) --verbose | cd test
+	"$@" "$1" awk then | local grep local "$@" then sed then "$@"
+	"$@" $(pwd) test local echo "$1" test echo printf done ${HOME} export ${HOME}
+export /usr/bin $(pwd) export echo done x=1 printf x=1 cd printf
+		grep x=1 'quoted text' awk export grep readonly readonly then 'quoted text' 2>/dev/null
+		test $(pwd) -eu | cd grep
+	local $(pwd) readonly && -eu
+	printf $(pwd) cd local x=1 printf "$@" then printf 'quoted text'
+		readonly 'quoted text' cd && readonly local 'quoted text' cd $(pwd)
+		$(pwd) test sed then echo x=1 sed
+--verbose done awk x=1 then printf
+		x=1 cd then ${HOME} grep 'quoted text' -eu $(pwd) | sed sed cd -eu 'quoted text'
+	test sed | 2>/dev/null echo &&
+&& done --verbose grep /usr/bin
+		--verbose 2>/dev/null sed --verbose
+	--verbose awk done ${HOME} echo local "$1" 2>/dev/null echo
+	--verbose "$1" ${HOME} test echo
+	readonly && /usr/bin awk export $(pwd) "$1" done "$1" then "$@" printf cd 2>/dev/null
+"$1" && test done --verbose local && local
+	done local && printf $(pwd) grep done echo test echo awk x=1
+awk local x=1 echo --verbose /usr/bin
+sed 'quoted text' local readonly 'quoted text' awk ${HOME}
+awk export 2>/dev/null done "$@" | ${HOME} /usr/bin -eu echo && echo && -eu
+		2>/dev/null export test $(pwd) "$1" "$@" "$1" | &&
+sed readonly $(pwd) 'quoted text' "$@" export then then then cd cd grep echo
+${HOME} ${HOME} printf readonly readonly x=1 then --verbose awk local /usr/bin
+	grep x=1 then | --verbose 2>/dev/null done
+/usr/bin 'quoted text' ${HOME} done "$1"
+export local test local
+	export printf 'quoted text' /usr/bin printf /usr/bin grep
+'quoted text' --verbose "$1" local
+	echo export $(pwd) awk "$@" | --verbose ${HOME} ${HOME} 2>/dev/null
+		test $(pwd) --verbose /usr/bin -eu printf
+		--verbose 'quoted text' "$1" /usr/bin x=1 test sed then | export local -eu "$@"
+	"$1" | local $(pwd) echo && printf -eu cd echo test x=1 grep "$@" grep
+		done printf $(pwd) ${HOME}
+export | "$1" printf export $(pwd) $(pwd) then
+		'quoted text' --verbose grep printf then test sed awk grep then
+	grep done grep "$1" "$@" x=1 grep /usr/bin "$1" awk
+		done /usr/bin "$@" "$@" grep export local 2>/dev/null /usr/bin && test
+		export x=1 2>/dev/null echo printf done && cd && echo $(pwd)
+	cd && -eu export x=1 sed awk cd "$1" 'quoted text'
+-eu echo 2>/dev/null -eu export "$1" | "$1" done export
+		printf echo sed | --verbose
+		| "$1" export /usr/bin x=1 readonly --verbose ${HOME} ${HOME} grep awk x=1 && |
+awk x=1 x=1 export 2>/dev/null x=1 && cd printf local
+		&& export "$@" "$@" printf $(pwd) done local done awk
+	echo test then grep export x=1 readonly local export
+	sed && "$@" "$1" /usr/bin local "$@" -eu cd test
+		"$@" export "$1" /usr/bin echo
+		test ${HOME} | --verbose export | local
+		| x=1 readonly readonly awk
+	export ${HOME} grep && then
+	sed grep --verbose "$@" sed awk 'quoted text' | 'quoted text' test 'quoted text'
+		local sed grep | echo 'quoted text' | echo then --verbose
+		&& x=1 export awk "$@" 2>/dev/null ${HOME} test $(pwd) export "$1"
+	echo x=1 local 'quoted text'
+		export /usr/bin -eu $(pwd) echo && printf printf "$@"
+		-eu x=1 grep /usr/bin sed "$@" && then 2>/dev/null export printf -eu | -eu local
+&& export 'quoted text' /usr/bin echo /usr/bin 2>/dev/null local -eu
+	then -eu "$1" local echo $(pwd) grep export readonly awk awk done
+-eu "$@" then 'quoted text'
+	awk /usr/bin "$@" /usr/bin then $(pwd) "$1" then export
+| readonly "$@" printf $(pwd) local grep -eu readonly done
+x=1 && $(pwd) "$@" export sed awk
+		'quoted text' then "$1" | readonly local 2>/dev/null awk 'quoted text'
+--verbose && cd echo awk export
+	'quoted text' test --verbose
+	readonly then 2>/dev/null "$@" then local /usr/bin sed readonly
+	| then x=1 $(pwd) --verbose /usr/bin
+/usr/bin grep export echo /usr/bin | grep 2>/dev/null 2>/dev/null
+	${HOME} $(pwd) test 2>/dev/null "$@" 'quoted text' "$@" echo ${HOME}
+	local "$1" cd | "$1" 2>/dev/null then awk cd then test /usr/bin "$1" ${HOME}
+	export /usr/bin -eu grep "$@" "$@"
+	awk | grep "$1" cd /usr/bin
+	x=1 2>/dev/null local done done $(pwd) --verbose 'quoted text' 'quoted text'
+		done "$1" export echo done 'quoted text' ${HOME} done printf | sed x=1 test ${HOME}
+&& | /usr/bin done printf test grep "$1" local
+"$1" -eu "$1" done "$@" sed export grep test grep x=1 |
+	-eu local local 'quoted text' cd $(pwd) | readonly
+		readonly local 2>/dev/null "$1"
+local done "$1" printf --verbose readonly test sed cd -eu ${HOME} done $(pwd)
+then /usr/bin 'quoted text' grep readonly
+		test export cd -eu printf /usr/bin export
+		sed sed awk cd readonly "$1"
+		-eu 'quoted text' done cd
+	&& /usr/bin local ${HOME} sed ${HOME} "$@" 'quoted text'
+		2>/dev/null printf export
+	$(pwd) $(pwd) /usr/bin
+		printf local local sed "$@" grep
+$(pwd) 2>/dev/null 2>/dev/null $(pwd) | -eu
+cd printf -eu awk x=1 'quoted text'
+		2>/dev/null sed cd grep awk echo done cd test "$1" ${HOME} printf --verbose
+		local && cd --verbose 'quoted text' "$1"
+	done x=1 then 2>/dev/null --verbose -eu && -eu x=1 awk done local "$1" /usr/bin
+		/usr/bin then echo 2>/dev/null | | test ${HOME} cd echo
+		then awk sed 'quoted text' printf grep grep 'quoted text' grep
+	cd echo test sed cd x=1 local
+	sed "$1" done grep sed && -eu ${HOME} sed printf 'quoted text' "$1" 2>/dev/null
+	/usr/bin ${HOME} grep x=1 sed "$1"
+	done 'quoted text' 2>/dev/null 2>/dev/null done local 'quoted text' "$1"
+	done --verbose && $(pwd) test 'quoted text' readonly echo readonly echo
+test && x=1 'quoted text' done 'quoted text' -eu awk "$1"
+	grep | export cd local printf awk
+		grep local --verbose 2>/dev/null $(pwd) x=1 2>/dev/null "$@" "$1" ${HOME}
+		awk "$1" $(pwd) printf export x=1 "$1" printf done --verbose echo | test
+		echo done cd cd test ${HOME}
+2>/dev/null 2>/dev/null && grep cd x=1 awk done /usr/bin && cd 'quoted text'
+	sed | test 'quoted text' && ${HOME}
+		$(pwd) /usr/bin "$1" 2>/dev/null "$1" x=1 'quoted text' 2>/dev/null x=1
+		$(pwd) done $(pwd) $(pwd) test then 2>/dev/null -eu /usr/bin grep printf
+		awk --verbose local export grep --verbose
+		local 'quoted text' "$1" export
+		--verbose 'quoted text' "$@" then && then 'quoted text'
+${HOME} 2>/dev/null readonly
+&& 2>/dev/null | && x=1 --verbose
+	grep local readonly awk local "$1" printf | sed readonly awk $(pwd) export --verbose
+	cd -eu export /usr/bin "$@" export 2>/dev/null then --verbose done export "$@"
+	then export printf -eu && | export grep grep grep grep sed awk "$@" /usr/bin
+		test export grep -eu 'quoted text' grep test done then
+		-eu then "$@" readonly sed 2>/dev/null --verbose test
+&& 'quoted text' cd then export | printf printf --verbose
+sed then /usr/bin then ${HOME} then "$@" export --verbose --verbose
+		grep $(pwd) 'quoted text'
+-eu cd printf local export --verbose done echo grep then done done &&
+	printf then /usr/bin readonly
+	"$@" awk -eu 'quoted text' -eu | local cd export grep grep /usr/bin "$1" readonly
+awk sed --verbose readonly local --verbose 2>/dev/null
+		local /usr/bin awk local ${HOME} printf
+		'quoted text' ${HOME} awk --verbose ${HOME} then
+/usr/bin /usr/bin /usr/bin
+	done cd --verbose grep printf x=1 -eu
+| grep cd && test "$@" awk export awk
+'quoted text' then x=1 $(pwd) |
+		2>/dev/null test ${HOME} sed echo sed ${HOME} local ${HOME}
+	"$@" | echo ${HOME} /usr/bin export x=1 sed 'quoted text' 2>/dev/null
+		${HOME} sed readonly "$@" --verbose "$@"
+		${HOME} grep | echo /usr/bin
+x=1 "$@" export export x=1 |
+'quoted text' /usr/bin printf $(pwd) done local 2>/dev/null sed ${HOME} x=1
+		awk -eu grep sed then 2>/dev/null awk grep /usr/bin -eu
+		sed ${HOME} grep $(pwd) test grep awk ${HOME} x=1
+awk 'quoted text' echo --verbose
+		done 2>/dev/null 2>/dev/null done
+	-eu "$@" | -eu -eu local "$1" test cd ${HOME} awk x=1 2>/dev/null
+		-eu /usr/bin --verbose readonly | && | | local
+		grep 'quoted text' "$1" $(pwd) $(pwd) export
+	x=1 | && 'quoted text' done export | cd --verbose local done export "$@"
+	'quoted text' ${HOME} ${HOME} --verbose "$@" export grep local
+	echo printf then awk --verbose done sed grep
+		x=1 --verbose done | /usr/bin | export
+	grep printf awk | x=1 "$1" "$@" /usr/bin --verbose export $(pwd) done cd printf
+		then printf ${HOME} | awk $(pwd) export
+"$1" && --verbose $(pwd) test done && then
+	printf sed test grep ${HOME} ${HOME} $(pwd)
+echo /usr/bin test "$@" done "$@" printf 2>/dev/null
+	-eu cd && printf awk 'quoted text' "$@" grep export "$@" cd export -eu
+--verbose x=1 -eu cd -eu echo
+readonly --verbose && "$1" readonly local |
+"$1" | grep $(pwd) "$@" && local cd /usr/bin local cd sed done
+	"$@" x=1 then && "$@"
+		--verbose "$@" 'quoted text' 'quoted text' 'quoted text' 'quoted text' && 2>/dev/null
+echo ${HOME} "$1" /usr/bin done
+	readonly "$@" --verbose -eu x=1 cd "$1" local done grep "$1"
+'quoted text' "$1" cd $(pwd) readonly
+	$(pwd) $(pwd) sed test printf
+cd echo echo local local ${HOME} echo ${HOME} sed
+		test 'quoted text' done test --verbose
+readonly ${HOME} 2>/dev/null done
+&& "$@" -eu 2>/dev/null cd printf 2>/dev/null sed
+		2>/dev/null 'quoted text' | done readonly 'quoted text'
+local test readonly test done "$1" test local 2>/dev/null export printf
+		-eu | readonly "$@" done -eu | sed ${HOME}
+2>/dev/null 'quoted text' done /usr/bin sed grep "$@"
+		cd then sed --verbose
+	| then cd 2>/dev/null 'quoted text' readonly $(pwd) x=1 export
+		--verbose /usr/bin readonly $(pwd) "$@" --verbose
+	--verbose local readonly awk then "$@" &&
+	then grep 2>/dev/null "$@" 2>/dev/null local local $(pwd) "$@" local "$@" ${HOME}
+readonly && ${HOME} awk printf
+		$(pwd) 'quoted text' "$@" && ${HOME}
+	printf export $(pwd) 'quoted text'
+#include c205.sh
+	"$1" cd sed /usr/bin export /usr/bin /usr/bin ${HOME}
+		readonly && $(pwd) done export
+sed echo "$1" grep done export sed printf -eu --verbose
+	local local | grep export
+		"$@" echo echo 'quoted text' echo awk readonly ${HOME} grep then
+	x=1 test grep awk grep readonly x=1 -eu test 'quoted text' && grep
+		echo test x=1 'quoted text' echo && "$@" echo
+&& awk awk echo awk 'quoted text'
+		| awk local sed test local $(pwd) grep -eu $(pwd) local ${HOME}
+	'quoted text' 'quoted text' export export grep x=1 && grep grep "$@" 2>/dev/null
+	awk ${HOME} then readonly ${HOME} sed test && printf then x=1 "$1" export
+"$1" ${HOME} done ${HOME} export
+		'quoted text' "$1" done done echo awk 2>/dev/null cd "$1"
+done awk 'quoted text' sed then $(pwd) awk echo
+	grep readonly 2>/dev/null x=1 printf $(pwd)
+$(pwd) awk 'quoted text' readonly | test -eu /usr/bin 'quoted text'
+	printf -eu readonly "$1" test cd | 'quoted text' readonly -eu
+grep && $(pwd) done grep 'quoted text' "$@" echo
+	"$1" "$1" $(pwd) 'quoted text'
+	then /usr/bin x=1 then 'quoted text' | local cd "$1" awk --verbose readonly
+&& x=1 $(pwd) x=1 ${HOME} && -eu -eu then -eu readonly ${HOME} cd
+2>/dev/null local -eu /usr/bin echo &&
+sed printf done $(pwd) export
+	2>/dev/null --verbose
+'quoted text' 2>/dev/null && x=1 --verbose grep readonly readonly export readonly
+/usr/bin export done ${HOME} done ${HOME}
+	"$@" x=1 ${HOME} && cd x=1
+cd sed awk grep done export $(pwd) export | $(pwd) 2>/dev/null cd && local
+grep 2>/dev/null x=1 --verbose && cd --verbose "$@" 'quoted text'
+		x=1 grep | test $(pwd) | test export then sed then then ${HOME}
+| export sed grep printf done local test grep 'quoted text'
+	done 2>/dev/null && grep sed printf x=1 2>/dev/null &&
+sed printf cd echo | sed ${HOME} printf && --verbose "$1" -eu awk readonly cd
+	then awk 'quoted text' test -eu
+		'quoted text' ${HOME} printf && echo printf && awk sed 'quoted text'
+	-eu awk readonly /usr/bin cd $(pwd) -eu ${HOME}
+	"$@" "$@" sed readonly sed readonly --verbose -eu 'quoted text'
+"$1" && ${HOME} /usr/bin grep $(pwd) /usr/bin x=1 sed ${HOME} sed
+awk /usr/bin 'quoted text'
+sed -eu | cd cd /usr/bin | done cd | --verbose readonly -eu awk readonly "$1" "$@"
+		readonly 2>/dev/null printf export done local /usr/bin export test sed | && 'quoted text'
+		${HOME} grep | "$@" readonly grep awk $(pwd) sed
+		${HOME} readonly /usr/bin 'quoted text' sed grep test -eu done "$1" grep 'quoted text'
+	awk done printf test echo 2>/dev/null "$@" /usr/bin sed cd "$@" printf 'quoted text'
+/usr/bin $(pwd) 2>/dev/null && x=1 "$@" printf local export -eu then
+		${HOME} x=1 sed awk grep
+		"$1" sed printf readonly 2>/dev/null &&
+cd x=1 && "$@" sed 2>/dev/null printf echo /usr/bin
+--verbose done printf "$1" printf /usr/bin local 'quoted text' test
+		printf then --verbose test $(pwd) cd -eu
+	x=1 export done test --verbose && cd "$@" /usr/bin local
+		"$1" -eu done sed /usr/bin readonly $(pwd) local readonly
+		| "$1" --verbose 'quoted text' --verbose "$1" 'quoted text'
+		2>/dev/null "$@" export printf | grep cd printf --verbose cd echo --verbose
+	test "$@" && local then export grep done
+	then 2>/dev/null | -eu test "$1" done
+		sed echo done "$1" 'quoted text' 'quoted text' done sed readonly then grep /usr/bin
+echo cd awk x=1 && then cd
+	sed 'quoted text' -eu done readonly
+--verbose ${HOME} "$1" ${HOME} /usr/bin
+done readonly "$1" "$@"
+	local test $(pwd) "$@" done awk 'quoted text' && "$1" readonly $(pwd)
+	--verbose cd echo grep 'quoted text' awk x=1
+	readonly | /usr/bin sed /usr/bin readonly x=1 awk ${HOME}
+	/usr/bin test readonly /usr/bin
+		export -eu cd done && echo 'quoted text'
+	"$@" export done --verbose cd test done grep sed --verbose grep "$1" 2>/dev/null
+echo && /usr/bin local readonly "$@" && $(pwd)
+		${HOME} printf /usr/bin 2>/dev/null "$1" test -eu local "$1"
+		/usr/bin "$@" export done echo awk --verbose && awk printf && x=1 'quoted text'
+cd awk awk | echo test printf $(pwd) printf
+/usr/bin | awk then 'quoted text' awk $(pwd) echo done awk -eu printf
+local readonly readonly printf "$1" $(pwd) grep
+&& "$@" cd local grep readonly | test then x=1 local
+echo x=1 ${HOME} printf local "$@" local --verbose
+	x=1 grep test cd awk then | "$1" printf
+		$(pwd) 'quoted text' && echo /usr/bin test then | $(pwd) cd "$1" 2>/dev/null local
+		test grep $(pwd) x=1 $(pwd) printf then "$@" 'quoted text' | 2>/dev/null x=1
+		&& cd echo x=1 -eu $(pwd) local 2>/dev/null
+		export test $(pwd) && readonly cd 'quoted text' 2>/dev/null "$@" local ${HOME}
+	2>/dev/null 2>/dev/null then x=1 cd ${HOME}
+	"$@" x=1 2>/dev/null export --verbose cd cd echo
+		cd -eu 2>/dev/null local 'quoted text'
+		printf | grep x=1 ${HOME} --verbose local | export
+	/usr/bin printf echo readonly grep grep "$1"
+		then -eu -eu --verbose grep done then echo 2>/dev/null 'quoted text'
+	"$@" done test sed ${HOME} ${HOME} cd x=1 cd 'quoted text'
+	then | awk "$1" printf printf printf echo /usr/bin export
+export $(pwd) then ${HOME} x=1 | test --verbose awk --verbose
+		then /usr/bin x=1 --verbose "$@"
+		$(pwd) done "$@" cd 2>/dev/null
+x=1 --verbose && | readonly
+		sed --verbose --verbose readonly readonly grep
+		cd test test cd test local /usr/bin && &&
+		echo done && local 2>/dev/null
+	sed -eu && "$@" 'quoted text' && ${HOME} --verbose local grep
+		| grep && grep then &&
+		--verbose local --verbose printf "$1" local printf then "$@" cd "$@"
+--verbose awk $(pwd) /usr/bin 2>/dev/null | local test /usr/bin sed done readonly
+		cd done | 'quoted text' "$1" readonly "$@" printf 2>/dev/null
+export --verbose && awk then export test awk $(pwd) /usr/bin /usr/bin x=1
+		&& /usr/bin ${HOME} $(pwd) /usr/bin printf awk /usr/bin export grep then
+'quoted text' 2>/dev/null && cd then then "$1" test && test done /usr/bin local
+		awk && | then echo -eu done done echo done cd
+--verbose /usr/bin $(pwd) readonly then
+| "$1" x=1 local awk grep printf sed grep done "$@" then /usr/bin test
+		'quoted text' awk grep test "$1" cd 2>/dev/null 'quoted text'
+grep | $(pwd) 2>/dev/null echo --verbose awk
+readonly && printf readonly
+		cd done $(pwd) x=1 ${HOME} awk /usr/bin awk x=1 ${HOME}
+		done && && /usr/bin $(pwd) readonly awk done &&
+	then then x=1 2>/dev/null
+	--verbose echo "$@" local ${HOME} local
+/usr/bin local grep x=1 sed
+grep -eu export 2>/dev/null x=1
+-eu readonly "$@" x=1
+	export then then grep $(pwd) printf | /usr/bin 2>/dev/null
+	test export cd test test --verbose ${HOME} printf test done
+		sed ${HOME} printf then | x=1 2>/dev/null local echo 'quoted text'
+	&& grep x=1 "$@" x=1 readonly sed -eu
+		x=1 printf 'quoted text'
+	--verbose echo echo done 'quoted text' && test "$1"
+		cd echo -eu awk | readonly
+		--verbose local | export | /usr/bin echo echo 'quoted text'
+&& /usr/bin 'quoted text'
+	grep 'quoted text' echo ${HOME} | 'quoted text'
+	| 2>/dev/null -eu then ${HOME} /usr/bin awk sed cd --verbose grep done test
+	${HOME} export $(pwd) &&
+cd ${HOME} test echo --verbose
+		/usr/bin test readonly printf 'quoted text'
+/usr/bin "$1" $(pwd) 'quoted text'
+	'quoted text' | -eu sed grep --verbose
+grep cd readonly ${HOME} /usr/bin printf
+		local --verbose 'quoted text' then sed x=1 x=1 2>/dev/null
+		sed cd "$1" && printf sed x=1 cd /usr/bin /usr/bin sed -eu local awk echo
+cd echo local test "$1" 'quoted text' test done | --verbose
+		export /usr/bin | | local readonly sed echo test "$@" local echo then cd awk ${HOME}
+grep $(pwd) 'quoted text' "$1" -eu
+	local done "$1" | && "$1" then "$@" grep export
+	printf "$1" x=1 grep readonly sed done local grep /usr/bin done cd -eu | echo
+		$(pwd) && sed export --verbose export
+${HOME} done $(pwd) 'quoted text' | sed cd test "$1"
+	grep && printf awk export printf cd 'quoted text'
+x=1 | 'quoted text' done x=1 done --verbose grep grep $(pwd) printf
+	x=1 echo | && test sed done
+	test readonly /usr/bin sed done --verbose
+		cd ${HOME} 2>/dev/null cd done "$1" ${HOME} done cd export
+	grep 'quoted text' echo -eu done | 2>/dev/null 2>/dev/null && --verbose
+done local --verbose printf && export 2>/dev/null
+		export x=1 grep cd 2>/dev/null
+x=1 /usr/bin ${HOME} 2>/dev/null
+		readonly ${HOME} "$@" local ${HOME} then echo --verbose --verbose
+		"$@" $(pwd) --verbose printf export done | readonly grep /usr/bin readonly test
+	/usr/bin && export 'quoted text' local test then 'quoted text'
+done -eu printf local export ${HOME} done readonly
+		echo -eu readonly grep echo echo --verbose cd ${HOME} x=1 sed && sed
+	"$@" grep sed && test
+	readonly ${HOME} test ${HOME} printf |
+	| "$1" 2>/dev/null then grep cd done sed cd "$@" "$1"
+		"$1" done ${HOME} test $(pwd) awk $(pwd) export --verbose export awk "$1" then
+	&& readonly /usr/bin done then local cd
+		| --verbose && 'quoted text' /usr/bin -eu $(pwd) awk -eu ${HOME}
+	2>/dev/null readonly "$@" 2>/dev/null $(pwd) awk ${HOME}
+	done $(pwd) | printf test
+	"$1" && | "$1" "$1" -eu grep grep
+		"$1" cd && cd readonly cd
+		| && && local printf $(pwd)
+done "$1" sed echo test x=1 --verbose /usr/bin x=1 && readonly printf
+	| "$1" ${HOME} then echo local "$@" 'quoted text' local x=1 "$@" cd x=1 grep
+		$(pwd) then $(pwd) then | then printf awk --verbose sed && local echo
+	$(pwd) x=1 printf test | "$1" 2>/dev/null 'quoted text'
+	then x=1 grep && $(pwd) then local && $(pwd) | && "$@" printf
+		awk grep 'quoted text' awk ${HOME} echo local export
+-eu then readonly && sed test "$1" && then export $(pwd) 2>/dev/null
+	'quoted text' $(pwd) | && $(pwd) sed "$@" 'quoted text' $(pwd)
+readonly echo local && grep export && /usr/bin "$1" ${HOME}
+	/usr/bin -eu cd 'quoted text' --verbose sed "$1"
+	test printf && sed echo printf "$1" awk x=1 then | && && sed
+		'quoted text' "$1" test "$@"
+		&& -eu local readonly && ${HOME} test /usr/bin then
+${HOME} awk readonly printf export 'quoted text'
+	"$@" ${HOME} export export "$@" && -eu grep cd "$1" "$1" ${HOME} -eu
+done export awk awk x=1 printf --verbose 2>/dev/null 2>/dev/null
+	echo printf test 'quoted text' /usr/bin awk then ${HOME} $(pwd) 'quoted text'
+grep export -eu "$1"
+	test && grep done 2>/dev/null
+	readonly $(pwd) printf "$1" /usr/bin -eu $(pwd) 2>/dev/null done
+		cd export 2>/dev/null cd cd && grep readonly
+	&& --verbose cd export cd 'quoted text' test $(pwd) done
+	2>/dev/null --verbose "$1" && export && done printf
+	'quoted text' 2>/dev/null export sed awk -eu readonly then x=1 && /usr/bin printf
+	cd | x=1 && "$1" then awk cd 'quoted text' readonly cd $(pwd)
+grep && "$1" cd export ${HOME} /usr/bin sed
+$(pwd) -eu 'quoted text' awk /usr/bin sed export 'quoted text' then $(pwd)
+	"$1" /usr/bin && /usr/bin
+x=1 ${HOME} x=1 | x=1 awk echo | 'quoted text' $(pwd) local -eu "$@" -eu
+	done grep 'quoted text' 'quoted text' 2>/dev/null
+x=1 readonly awk grep 'quoted text'
+		sed echo echo $(pwd) x=1 local 'quoted text' test && then readonly local
+| printf export awk readonly awk -eu sed sed
+	grep local printf awk test
+	/usr/bin "$@" echo local -eu | sed echo
+	grep export "$@" export sed 'quoted text' echo "$1" cd awk
+	"$@" cd local "$1" then "$1" ${HOME} /usr/bin
+		"$1" local 2>/dev/null && ${HOME} "$1" readonly 'quoted text' then grep -eu
+	grep $(pwd) "$@" test "$1" /usr/bin x=1 cd 2>/dev/null 'quoted text'
+		${HOME} readonly done "$1" then | sed
+| /usr/bin grep export && $(pwd) test "$1" local | -eu $(pwd)
+| cd /usr/bin ${HOME} cd export test
+	&& | printf --verbose --verbose && |
+	then cd "$1" test "$@" --verbose printf echo then test done awk
+awk --verbose "$1" --verbose test echo local $(pwd) x=1 export done "$@"
+	| done x=1 "$1" $(pwd) | 'quoted text' --verbose
+	grep done then $(pwd) /usr/bin
+done local export /usr/bin done readonly done
+		readonly grep echo /usr/bin --verbose "$@" echo x=1 | awk sed "$@" local
+		echo test 'quoted text' 'quoted text' "$1" | | test $(pwd)
+		export -eu test --verbose cd sed awk then --verbose
+		export -eu awk test grep "$@" sed | "$@" readonly
+	echo echo awk readonly
+		"$@" /usr/bin readonly /usr/bin test local readonly then test
+	cd export | cd sed sed ${HOME} | done x=1 && readonly | grep test
+		"$1" awk cd test echo "$@" /usr/bin readonly awk then
+		local --verbose x=1 && "$1" -eu cd awk && local
+		-eu x=1 ${HOME} then test && export
+		$(pwd) -eu awk local done done --verbose | echo | printf | -eu sed $(pwd)
+local && sed sed x=1 -eu export awk cd x=1 awk 'quoted text'
+		local sed | export readonly 'quoted text'
+awk $(pwd) "$1" ${HOME} then 2>/dev/null && "$1" awk | sed sed sed done 'quoted text'
+local cd $(pwd) sed cd awk && then 'quoted text' sed export echo awk
+		awk | 'quoted text' --verbose
+		"$1" 2>/dev/null && $(pwd) then readonly done
+'quoted text' export ${HOME} readonly
+test done export ${HOME} | /usr/bin
+	test grep printf 'quoted text'
+| | --verbose "$@" | ${HOME}
+	readonly sed "$1" printf cd echo 2>/dev/null "$@" $(pwd) /usr/bin 'quoted text'
+export x=1 x=1 echo | "$1" test grep local
+&& test done test 'quoted text' --verbose 2>/dev/null ${HOME} -eu
+		readonly "$1" /usr/bin ${HOME} "$1"
+	done "$1" cd $(pwd) 'quoted text'
+		"$@" $(pwd) test cd export
+then "$@" "$1" 'quoted text' && sed grep readonly
+	grep cd "$1" readonly echo
+		done 'quoted text' | 2>/dev/null test local printf printf
+		$(pwd) $(pwd) $(pwd) sed awk awk awk cd "$@" readonly sed
+		done grep --verbose && local awk -eu "$@" echo readonly then
+&& export grep awk grep local 2>/dev/null then x=1 test cd awk "$@" then
+then x=1 done x=1 awk sed -eu then test
+	"$@" echo grep /usr/bin
+"$@" echo done cd printf x=1 export readonly
+-eu printf done done "$1" 2>/dev/null cd "$@" local $(pwd) export
+	printf awk && grep /usr/bin
+		awk "$@" ${HOME} then --verbose $(pwd) done printf
+&& $(pwd) -eu --verbose /usr/bin /usr/bin "$@" 2>/dev/null test grep
+		x=1 printf test 2>/dev/null export
+		cd $(pwd) "$@" "$1" -eu | awk /usr/bin then ${HOME}
+		'quoted text' grep --verbose ${HOME} $(pwd) grep readonly && export ${HOME} awk
+	done awk local readonly local
+		/usr/bin 2>/dev/null echo --verbose 2>/dev/null cd done "$1"
+	x=1 x=1 --verbose --verbose cd $(pwd)
+"$@" "$@" done && ${HOME} then "$@" local then
+	awk ${HOME} export $(pwd) printf ${HOME}
+sed 'quoted text' 2>/dev/null local
+printf /usr/bin cd export done /usr/bin | "$@"
+		"$@" "$1" test ${HOME} "$@" | | readonly "$@" /usr/bin
+x=1 "$1" echo export export
+		/usr/bin --verbose -eu "$1" printf -eu sed --verbose
+		x=1 then echo ${HOME} sed sed 'quoted text' $(pwd) --verbose
+'quoted text' test cd | cd then $(pwd) 'quoted text' "$1" && | $(pwd) export
+printf readonly --verbose -eu readonly printf /usr/bin local "$1" x=1 |
+"$@" "$1" && sed $(pwd) awk $(pwd) 2>/dev/null $(pwd)
+	then "$@" printf "$1"
+/usr/bin cd ${HOME} echo then ${HOME} awk --verbose x=1 2>/dev/null
+		"$1" 2>/dev/null sed $(pwd)
+'quoted text' local readonly awk /usr/bin cd 2>/dev/null readonly ${HOME}
+	readonly cd -eu printf echo awk export -eu x=1 readonly printf "$@"
+	${HOME} local local done readonly 'quoted text'
+	test awk done $(pwd) export
+sed /usr/bin grep printf -eu x=1 | -eu /usr/bin printf sed /usr/bin $(pwd) &&
+		&& done done "$1" "$@" 2>/dev/null
+		local printf $(pwd) sed && 'quoted text' printf 2>/dev/null
+		printf 'quoted text' x=1 test echo /usr/bin "$@" /usr/bin $(pwd) &&
+	sed test done readonly $(pwd)
+cd 2>/dev/null printf $(pwd) | grep awk x=1 then | "$1" then echo
+	| echo printf 'quoted text' then done local export printf 2>/dev/null $(pwd) "$1"
+"$@" x=1 awk sed 'quoted text' test && sed "$1" x=1 done
+-eu "$1" /usr/bin printf && 2>/dev/null printf /usr/bin
+echo echo /usr/bin 2>/dev/null
+test 2>/dev/null cd -eu
+		-eu sed done awk 2>/dev/null sed $(pwd)
+		local $(pwd) /usr/bin /usr/bin awk 2>/dev/null awk "$1" done
+echo readonly local |
+		echo printf local x=1 | sed x=1 -eu /usr/bin -eu readonly
+		"$1" export then x=1 'quoted text' "$1" sed $(pwd) --verbose then
+		"$@" 2>/dev/null && printf "$1"
+-eu && | export export | ${HOME} ${HOME} 2>/dev/null sed
+		echo echo local "$1" grep sed |
+	cd /usr/bin awk then "$1" cd "$@" "$@" 'quoted text' | -eu 2>/dev/null printf
+		cd "$@" echo "$1" /usr/bin sed /usr/bin $(pwd) /usr/bin
+		/usr/bin "$@" 2>/dev/null grep test 2>/dev/null
+	x=1 ${HOME} $(pwd) local sed 2>/dev/null x=1 |
+		-eu ${HOME} printf done $(pwd) | readonly "$@" grep "$@" && /usr/bin test export
+'quoted text' 2>/dev/null /usr/bin awk "$1" grep 2>/dev/null grep "$@" --verbose
+	cd x=1 done export then x=1 && --verbose --verbose | ${HOME} | | 'quoted text'
+		$(pwd) -eu --verbose awk then echo readonly
+		'quoted text' test /usr/bin "$@" awk -eu
+	awk 2>/dev/null awk awk && && then "$@"
+		"$1" $(pwd) readonly -eu cd test -eu 'quoted text'
+	cd echo --verbose 2>/dev/null printf sed test cd /usr/bin printf /usr/bin
+		&& printf $(pwd) | echo -eu readonly ${HOME} awk
+	| && -eu printf sed grep ${HOME} sed then sed "$1" 2>/dev/null sed awk /usr/bin
+		$(pwd) "$1" cd ${HOME} x=1 x=1 printf printf
+| echo -eu $(pwd) "$@" awk /usr/bin done local $(pwd)
+	done x=1 /usr/bin awk ${HOME} | local 2>/dev/null 'quoted text' cd readonly
+echo ${HOME} readonly --verbose
+x=1 2>/dev/null local /usr/bin "$1" "$1"
+		'quoted text' ${HOME} x=1 test done
+$(pwd) 2>/dev/null "$@" awk test local cd then local 2>/dev/null
+	x=1 cd grep -eu printf export readonly awk then
+	grep "$1" test ${HOME} then sed then
+| readonly readonly export then then sed
+		local -eu /usr/bin | test
+		test sed then $(pwd) "$1" echo grep -eu
+	echo echo 2>/dev/null x=1 2>/dev/null test $(pwd) ${HOME} sed
+/usr/bin -eu && 2>/dev/null /usr/bin
+/usr/bin readonly echo x=1 x=1 echo 2>/dev/null
+		&& printf -eu test 2>/dev/null sed "$@" then
+		-eu ${HOME} printf $(pwd) "$@" done 2>/dev/null printf && 'quoted text'
+		&& 2>/dev/null export && 2>/dev/null "$1" && cd then | local
+| awk && x=1 local $(pwd) $(pwd) "$1" 'quoted text'
+	"$1" | test then done $(pwd)
+	"$1" --verbose ${HOME} "$@" printf && "$1" readonly done --verbose && && sed export
+	${HOME} cd | -eu echo 2>/dev/null -eu test "$1" cd "$@" grep printf
+	2>/dev/null printf && then --verbose
+		sed export $(pwd) grep sed printf "$@" local
+		${HOME} then awk export 2>/dev/null /usr/bin /usr/bin local ${HOME} /usr/bin
+	awk "$1" done --verbose -eu 'quoted text' awk "$1" "$1" | | then -eu
+		${HOME} echo printf x=1 grep -eu readonly readonly &&
+	2>/dev/null sed printf test | local ${HOME} 'quoted text' && grep
+	test x=1 done 'quoted text' awk echo cd echo local
+"$@" | export sed $(pwd) then test local done awk --verbose
+--verbose echo cd sed done -eu 'quoted text' "$1" 'quoted text'
+grep x=1 cd cd grep -eu x=1 --verbose
+	test readonly && grep printf 2>/dev/null "$@" x=1 "$1" test
+		sed echo cd printf 2>/dev/null $(pwd) readonly cd
+	then x=1 x=1 test "$@" printf done printf test readonly
+	cd then | $(pwd) "$1" | ${HOME} --verbose x=1 readonly --verbose awk &&
+		$(pwd) grep "$1" local 2>/dev/null && local -eu && readonly readonly
+		then | echo test printf 2>/dev/null cd 2>/dev/null
+2>/dev/null then ${HOME} sed readonly "$1" then
+	printf 2>/dev/null 2>/dev/null then && done cd then echo local grep
+sed "$1" ${HOME} /usr/bin
+		done done local printf test sed then ${HOME} local local then readonly
+		local test export test cd x=1 then done "$1" -eu awk "$1" sed 'quoted text' x=1
+		awk echo local 'quoted text' local $(pwd)
+	"$1" readonly | | cd grep awk grep |
+printf cd 2>/dev/null export --verbose local | -eu
+-eu done "$@" 'quoted text' test ${HOME} "$1" "$1"
+test local x=1 && --verbose /usr/bin --verbose cd then printf
+printf /usr/bin $(pwd) echo echo 2>/dev/null ${HOME}
+	readonly export done && export sed then test
+	"$@" 2>/dev/null $(pwd) awk done test "$1" && | "$@" export "$@" ${HOME}
+	readonly printf | export grep grep 2>/dev/null 'quoted text'
+		"$@" && local awk sed printf "$@" cd x=1
+		&& export grep export -eu "$@" $(pwd) cd $(pwd) 'quoted text'
+		${HOME} 2>/dev/null done local export test echo
+${HOME} x=1 | && sed 2>/dev/null
+then $(pwd) -eu cd $(pwd) done 'quoted text' done 2>/dev/null ${HOME} -eu
+		grep export export awk test done 2>/dev/null --verbose -eu then "$@" cd printf
+--verbose ${HOME} cd /usr/bin 2>/dev/null test && "$@" --verbose awk readonly
+		"$@" /usr/bin --verbose x=1 test ${HOME}
+	&& awk /usr/bin -eu export --verbose awk awk $(pwd) "$@" cd then "$1"
+$(pwd) printf sed "$1" then $(pwd) ${HOME} printf sed /usr/bin
+		grep then test /usr/bin done x=1 $(pwd) sed awk readonly
+		--verbose x=1 export grep && echo 'quoted text' "$1" "$1" --verbose
+"$@" ${HOME} cd cd $(pwd) printf $(pwd)
+${HOME} $(pwd) && done cd 'quoted text'
+	sed x=1 "$@" test -eu done 'quoted text' echo then | "$1" 'quoted text'
+$(pwd) cd echo export cd export && readonly cd echo | ${HOME}
+"$1" readonly --verbose ${HOME}
+'quoted text' local -eu /usr/bin then readonly $(pwd) | awk done grep done
+		local x=1 x=1 && then /usr/bin grep sed -eu echo export sed export --verbose done
+	&& awk 2>/dev/null && $(pwd) test export $(pwd)
+	x=1 -eu export test export x=1 readonly test printf 2>/dev/null
+		&& -eu grep "$1" -eu "$1" readonly local sed x=1
+		printf local --verbose "$1"
+	${HOME} test "$@" "$@" test done done sed grep test ${HOME} | /usr/bin export
+		2>/dev/null x=1 "$@" local done $(pwd) then then 'quoted text'
+		2>/dev/null 2>/dev/null && then grep then
+then x=1 readonly test | --verbose awk printf awk cd awk $(pwd) x=1
+	test 'quoted text' ${HOME} ${HOME} echo then
+		-eu x=1 printf "$1" test $(pwd) x=1 && && printf printf printf 'quoted text'
+| readonly local done grep && "$@" cd awk done cd sed -eu
+	cd x=1 2>/dev/null test --verbose
+cd "$@" --verbose readonly "$1" readonly sed printf x=1 'quoted text'
+		| sed grep readonly done local echo
+"$1" -eu | 2>/dev/null 'quoted text' readonly | local test printf done
+		test 'quoted text' grep grep
+		/usr/bin printf $(pwd) x=1 cd export 'quoted text'
+awk ${HOME} test printf && done sed --verbose cd
+		2>/dev/null printf sed
+		"$1" grep $(pwd) printf | "$@"
+2>/dev/null 'quoted text' ${HOME} done grep sed
+	printf echo 'quoted text' readonly
+	| x=1 then done ${HOME} "$@" local awk awk
+printf | $(pwd) 'quoted text' ${HOME}
+grep sed then 2>/dev/null 'quoted text' export done $(pwd) readonly
+		sed "$1" test /usr/bin "$@" -eu test awk done grep readonly x=1 ${HOME} x=1 local
+	'quoted text' ${HOME} x=1 awk echo && echo test 2>/dev/null
+		sed ${HOME} | && -eu 'quoted text' x=1 | export /usr/bin then x=1
+| /usr/bin "$1" local 2>/dev/null local sed export ${HOME} ${HOME} "$@" echo grep
+local local && printf cd | 'quoted text' 'quoted text' awk awk
+		${HOME} export x=1 -eu sed -eu export cd
+		then 'quoted text' awk x=1 echo echo then readonly x=1 printf echo cd $(pwd)
+2>/dev/null cd printf "$@"
+"$1" then ${HOME} done test done $(pwd) "$1" "$1" then /usr/bin --verbose local
+	/usr/bin readonly && grep echo
+	/usr/bin 'quoted text' 'quoted text' -eu "$@" cd sed done /usr/bin x=1
+	&& "$1" echo /usr/bin sed 2>/dev/null echo && "$@"
+export 'quoted text' readonly readonly 'quoted text' --verbose
+		x=1 'quoted text' done --verbose
+	local 2>/dev/null "$1" grep cd
+	export export $(pwd) then cd "$@" x=1 "$1" -eu test
+	&& cd sed /usr/bin readonly "$@" /usr/bin test
+export awk -eu then --verbose 2>/dev/null 'quoted text'
+	grep local export 'quoted text' && $(pwd) /usr/bin
+	done --verbose readonly export /usr/bin export local done "$1" /usr/bin sed
+	'quoted text' -eu "$1" "$1" --verbose -eu export | cd grep
+| --verbose "$1" local done && sed sed grep x=1 awk local
+		test && ${HOME} "$1" export local
+		test 'quoted text' local | cd printf
+		/usr/bin readonly --verbose $(pwd) && cd local
+	'quoted text' x=1 cd test sed printf export then test local readonly "$1" --verbose
+	local $(pwd) sed ${HOME} $(pwd) && x=1 local
+--verbose /usr/bin grep export test echo awk -eu /usr/bin awk export export
+		| sed then /usr/bin "$1" | readonly
+		| 'quoted text' $(pwd) export $(pwd) --verbose $(pwd)
+awk 2>/dev/null done then 2>/dev/null 'quoted text' -eu printf
+		${HOME} then done | && then /usr/bin echo x=1 x=1 echo
+	cd export "$1" "$1" readonly $(pwd) readonly /usr/bin
+	echo | ${HOME} | then awk "$1" local done done && && sed done && echo local
+		x=1 echo && sed local export | echo local printf local echo readonly && test
+readonly ${HOME} | | local -eu "$1" 'quoted text' readonly readonly
+	"$1" 2>/dev/null cd ${HOME} 2>/dev/null
+		${HOME} export printf local printf 2>/dev/null local
+awk test 2>/dev/null export "$1" "$1" 'quoted text'
+export then echo test "$@" $(pwd) "$@" done readonly
+	grep local --verbose printf
+	local export local $(pwd) cd local && /usr/bin export printf --verbose
+		"$1" done grep cd /usr/bin && /usr/bin "$@" export && echo -eu
+	done | -eu 2>/dev/null then local awk sed then && grep "$@" readonly -eu
+echo /usr/bin test ${HOME} --verbose
+		2>/dev/null "$1" test sed /usr/bin awk 2>/dev/null
+		cd --verbose -eu /usr/bin "$1" done
+&& --verbose sed "$@" local then
+"$@" awk 2>/dev/null done /usr/bin readonly --verbose
+	test --verbose cd local test
+2>/dev/null local printf test done cd --verbose cd local -eu local "$1" --verbose
+		| awk /usr/bin done export awk -eu local readonly ${HOME} x=1 "$@" done
+		done --verbose "$1" "$1" done grep --verbose | $(pwd) awk $(pwd)
+		sed awk printf grep awk $(pwd) --verbose readonly sed then "$1" ${HOME}
+then export x=1 export "$1" cd $(pwd) sed cd | "$@" grep
+then "$@" --verbose then readonly ${HOME} cd echo
+local export readonly cd local printf echo
+		local grep ${HOME} readonly echo readonly --verbose /usr/bin sed $(pwd) &&
+	echo awk local $(pwd) then
+		&& readonly readonly x=1 test test export 2>/dev/null -eu -eu
+"$1" then printf ${HOME} echo && "$@" cd echo x=1 printf cd x=1 x=1
+		x=1 grep awk awk readonly sed printf | sed
+	local grep 'quoted text' -eu then x=1 export x=1 awk
+/usr/bin x=1 /usr/bin
+		printf local $(pwd) --verbose 2>/dev/null 2>/dev/null sed
+	echo done "$1" export 2>/dev/null grep $(pwd) x=1 $(pwd)
+		echo $(pwd) --verbose done sed ${HOME} && printf -eu $(pwd) local cd /usr/bin
+"$@" /usr/bin x=1 -eu test
+	test echo | export $(pwd) | ${HOME} && && test printf && 2>/dev/null echo "$1"
+		2>/dev/null 2>/dev/null cd | local x=1
+	cd sed x=1 'quoted text' then
+		$(pwd) test readonly 'quoted text' awk local -eu $(pwd) 2>/dev/null
+		'quoted text' "$1" echo test && awk local "$@" test cd test readonly
+	test awk /usr/bin /usr/bin /usr/bin && && printf printf
+"$1" /usr/bin printf grep | && $(pwd) && local
+$(pwd) | done $(pwd) -eu awk
+"$@" echo -eu -eu | $(pwd) --verbose /usr/bin cd /usr/bin
+--verbose then && grep
+	x=1 "$1" x=1 done /usr/bin cd ${HOME} --verbose $(pwd) x=1 done && ${HOME} awk
+	$(pwd) -eu awk 2>/dev/null printf 2>/dev/null test x=1 /usr/bin printf
+	readonly -eu --verbose echo 2>/dev/null
+		x=1 ${HOME} --verbose "$@" 2>/dev/null | --verbose && awk awk
+	| x=1 x=1 sed "$1" printf done test done cd sed sed ${HOME} awk export 'quoted text'
+| -eu grep then grep x=1 'quoted text' echo local cd grep cd | --verbose "$@" --verbose
+		'quoted text' -eu local done grep "$@" --verbose
+		cd cd then $(pwd) sed test /usr/bin test sed "$1" readonly
+	| $(pwd) -eu /usr/bin test echo readonly x=1 ${HOME}
+	export ${HOME} | -eu echo local
+x=1 | readonly done |
+		printf grep 'quoted text' 'quoted text'
+done done x=1 sed printf x=1 | done test ${HOME} readonly grep export
+		x=1 2>/dev/null -eu "$@" && 2>/dev/null
+grep then cd readonly printf printf grep 2>/dev/null export $(pwd)
+	&& local test 'quoted text' readonly x=1 "$@" 'quoted text'
+		echo 'quoted text' then ${HOME} echo echo done done then ${HOME} then done
+		x=1 local x=1 | | grep "$1" done 'quoted text'
+		local echo "$1" awk 2>/dev/null
+	echo -eu && awk readonly test -eu x=1 --verbose "$1"
+$(pwd) awk printf then
+		x=1 grep ${HOME} local && && done -eu test echo cd awk echo $(pwd) /usr/bin
+		'quoted text' then /usr/bin ${HOME} export "$1" | sed 2>/dev/null
+		test && grep readonly $(pwd) "$1" "$@" --verbose local "$1" | local
+	test -eu done 2>/dev/null echo test done
+	/usr/bin then /usr/bin echo readonly "$@" /usr/bin cd printf printf $(pwd) ${HOME}
+		sed export cd then local ${HOME} readonly test
+		export --verbose cd readonly $(pwd) 2>/dev/null readonly -eu -eu "$1"
+then done ${HOME} cd cd /usr/bin x=1 | sed "$@" && done | -eu
+	'quoted text' x=1 then -eu 2>/dev/null cd awk && readonly --verbose grep --verbose
+	| && done sed "$@" done sed 2>/dev/null
+--verbose ${HOME} "$1" $(pwd) readonly local readonly sed local sed ${HOME}
+		x=1 ${HOME} | test --verbose
+		x=1 | awk | | done --verbose
+		&& grep | export sed
+	'quoted text' local -eu "$1" | x=1 -eu awk local sed readonly
+		$(pwd) x=1 local printf then "$1" --verbose -eu
+	cd | && -eu local "$1" ${HOME} test then &&
+		"$@" test done export done grep /usr/bin local --verbose
+awk 'quoted text' x=1 "$@" 'quoted text' local awk "$1" cd x=1 grep echo test
+&& then cd /usr/bin awk local local | grep done
+		sed --verbose export "$@" awk done --verbose 'quoted text'
+	sed export test local printf then cd cd awk -eu cd export grep
+	test 'quoted text' cd | --verbose "$1" readonly export printf "$1" sed printf
+		"$1" | "$1" $(pwd) "$@" "$@" 2>/dev/null then test export
+	$(pwd) 'quoted text' local ${HOME} done readonly
+	local export test $(pwd) grep $(pwd) done 2>/dev/null done test printf 'quoted text'
+	done "$@" done | --verbose /usr/bin
+cd awk awk cd 'quoted text' "$1"
+/usr/bin && && local sed local test sed $(pwd) 'quoted text' $(pwd)
+	sed export x=1 "$@" && done -eu grep --verbose && ${HOME} echo test
+		awk printf printf "$@" then 2>/dev/null then printf done
+	${HOME} x=1 echo && test ${HOME} ${HOME} | ${HOME} /usr/bin
+printf x=1 done sed $(pwd) readonly && echo
+	"$@" /usr/bin 2>/dev/null | 'quoted text' -eu awk export
+		'quoted text' sed "$@" 2>/dev/null 2>/dev/null readonly -eu "$1"
+		$(pwd) 'quoted text' export done x=1 cd sed $(pwd)
+		echo readonly export | export 2>/dev/null --verbose awk echo /usr/bin done x=1
+local && "$1" "$@" "$1" --verbose && $(pwd) && && awk local && x=1 "$@" awk $(pwd)
+done awk 'quoted text' "$1" /usr/bin awk /usr/bin ${HOME} grep local |
+	then readonly && && done sed x=1 /usr/bin ${HOME} | sed then 2>/dev/null $(pwd)
+	x=1 local grep then "$@" grep "$@" then --verbose 'quoted text' export "$1" export
+	test then -eu -eu x=1 export ${HOME} $(pwd) 2>/dev/null echo readonly && /usr/bin
+done printf then "$@" sed then
+		then done x=1 test awk sed 2>/dev/null local && echo $(pwd)
+	/usr/bin grep && 2>/dev/null $(pwd) readonly 2>/dev/null
+		${HOME} x=1 $(pwd) awk cd 2>/dev/null echo then done
+"$1" ${HOME} readonly readonly -eu 2>/dev/null test /usr/bin
+		then export | "$@" -eu awk ${HOME} -eu x=1 && x=1 x=1 ${HOME}
+		${HOME} --verbose 2>/dev/null
+		"$@" done local printf 'quoted text' local $(pwd) 2>/dev/null awk -eu x=1 /usr/bin
+		2>/dev/null readonly export ${HOME} then x=1 'quoted text'
+		echo local | $(pwd) ${HOME}
+awk 2>/dev/null export 'quoted text' $(pwd) local awk 2>/dev/null
+awk $(pwd) ${HOME} test --verbose ${HOME} "$@" awk readonly /usr/bin
+		x=1 export printf test "$1" "$1" printf --verbose "$@" grep
+	'quoted text' "$@" export -eu --verbose
+2>/dev/null "$1" "$@" --verbose
+	&& /usr/bin done /usr/bin && done 'quoted text' grep
+/usr/bin readonly echo 'quoted text'
+	sed test -eu 2>/dev/null local /usr/bin export echo done ${HOME} 'quoted text'
+		printf awk | $(pwd) local readonly export /usr/bin x=1 grep
+awk done -eu --verbose "$1" done sed export
+		printf -eu sed x=1 /usr/bin ${HOME} echo
+--verbose /usr/bin | export
+awk local -eu printf --verbose grep export "$1" ${HOME} sed 2>/dev/null
+local "$1" /usr/bin done 2>/dev/null &&
+		2>/dev/null readonly 2>/dev/null export test 2>/dev/null local -eu readonly
+"$@" sed -eu $(pwd) awk grep grep printf then printf "$1" done 2>/dev/null
+		&& /usr/bin "$@" awk ${HOME} 2>/dev/null | grep
+		"$1" x=1 export -eu && $(pwd) "$@" &&
+		x=1 | && done local then grep "$1" -eu awk
+		--verbose printf /usr/bin "$@" "$@" cd ${HOME}
+		printf 2>/dev/null local grep && echo --verbose "$@" -eu grep cd 2>/dev/null
+		-eu $(pwd) echo 'quoted text' "$@" local export echo 'quoted text'
+		done echo export export export readonly && test
+${HOME} then done 2>/dev/null export 2>/dev/null
+export printf "$@" 2>/dev/null $(pwd) $(pwd)
+	| printf echo "$1" 2>/dev/null --verbose
+awk /usr/bin "$@" readonly echo && | "$1" awk sed done x=1 | grep
+test ${HOME} readonly export grep "$1" $(pwd) grep -eu cd 'quoted text'
+	$(pwd) "$1" cd "$1" "$@" then --verbose && | cd "$@" "$1" then sed sed
+		echo 2>/dev/null awk done | sed "$1" sed ${HOME} ${HOME} done "$@" && | ${HOME}
+		then sed $(pwd) printf --verbose
+	x=1 grep readonly ${HOME} "$1" "$1" /usr/bin grep $(pwd) /usr/bin
+then echo cd "$@" | 2>/dev/null local --verbose |
+		'quoted text' && grep -eu x=1 | | sed
+		awk cd test printf --verbose -eu 2>/dev/null
+'quoted text' && ${HOME} --verbose printf then awk done ${HOME} 'quoted text'
+then x=1 && sed $(pwd) ${HOME} then 'quoted text'
+		done | readonly x=1 -eu ${HOME}
+export test printf readonly -eu | sed then "$1" local readonly
+$(pwd) printf ${HOME} --verbose -eu 'quoted text'
+	then grep $(pwd) readonly $(pwd) readonly test echo test done 2>/dev/null
+--verbose done done -eu 'quoted text' awk | then x=1 done
+		| cd /usr/bin --verbose && printf
+--verbose 'quoted text' awk readonly --verbose "$@" "$@"
+		local 'quoted text' -eu
+test | x=1 "$1" $(pwd) done cd -eu $(pwd) "$@" 'quoted text' test
+	-eu --verbose --verbose $(pwd) sed sed | awk export
+-eu x=1 'quoted text' --verbose x=1 2>/dev/null -eu 'quoted text'
+	printf x=1 "$1" && x=1 -eu readonly test
+	cd cd export then x=1 local 2>/dev/null 2>/dev/null done "$@"
+		awk 2>/dev/null | cd export 2>/dev/null
+	export "$1" 'quoted text' $(pwd) 'quoted text'
+	test 'quoted text' --verbose then then | $(pwd)
+		export $(pwd) readonly | 'quoted text' export
+--verbose -eu cd test local --verbose export ${HOME}
+		then printf then then local -eu local 'quoted text' readonly
+done local export done readonly 'quoted text'
+test export | $(pwd) -eu "$1" -eu
+	then cd && "$1" readonly && export readonly then awk awk echo "$1" echo &&
+	readonly readonly $(pwd) then awk -eu -eu export x=1 sed && x=1 -eu test -eu
+		cd --verbose "$@" 2>/dev/null /usr/bin -eu --verbose
+cd cd $(pwd) cd $(pwd) && test /usr/bin
+		sed "$1" x=1 done "$1" | cd $(pwd) ${HOME} readonly grep echo sed /usr/bin test
+	$(pwd) ${HOME} | then printf 'quoted text' grep $(pwd)
+	local readonly 'quoted text' --verbose ${HOME}
+	'quoted text' readonly cd 2>/dev/null grep done x=1 ${HOME}
+	"$1" readonly echo then
+		cd then x=1 $(pwd) ${HOME} sed awk 2>/dev/null cd 2>/dev/null
+	sed 'quoted text' -eu 'quoted text'
+--verbose printf awk grep then local && grep 2>/dev/null -eu 'quoted text'
+	awk 'quoted text' ${HOME} -eu $(pwd) done export --verbose
+-eu x=1 export "$@" printf grep "$@" done echo 2>/dev/null done
+		then "$@" "$1" cd local
+		done grep grep --verbose grep echo awk local readonly export $(pwd)
+	grep local x=1 test export cd $(pwd) awk x=1 local echo echo "$1" cd local done
+		printf 'quoted text' /usr/bin local local $(pwd) $(pwd)
+&& ${HOME} readonly $(pwd) 'quoted text' grep sed ${HOME} done export
+	cd local 2>/dev/null grep export && "$1"
+		${HOME} 'quoted text' sed "$1" then then &&
+	| --verbose /usr/bin "$@" "$1" local "$@" then x=1 done grep -eu awk readonly done
+${HOME} readonly $(pwd) done "$1" then
+	&& | --verbose && 2>/dev/null test awk --verbose
+		&& export then --verbose x=1 done 2>/dev/null
+		'quoted text' 'quoted text' --verbose /usr/bin then then cd
+"$@" readonly readonly x=1 printf sed --verbose sed grep cd awk "$@" | grep readonly
+echo x=1 printf echo ${HOME} local --verbose grep test ${HOME} && 2>/dev/null
+		done local done && done $(pwd) "$@" $(pwd) test "$@" $(pwd) done 2>/dev/null grep
+	local x=1 done awk then -eu cd /usr/bin /usr/bin awk | test then
+	done test printf -eu printf x=1 export x=1 -eu echo $(pwd) test
+	printf x=1 /usr/bin /usr/bin done /usr/bin && printf
+"$@" grep && && 2>/dev/null test done | grep cd grep readonly "$@" cd readonly
+${HOME} done x=1 grep && test &&
+cd local && 'quoted text' grep grep -eu readonly && "$1" export "$1" x=1
+	printf | /usr/bin ${HOME} export
+	${HOME} 2>/dev/null readonly done
+'quoted text' echo | done grep test
+then done printf && ${HOME} ${HOME} then "$@" cd
+	then then grep -eu awk "$@" printf
+/usr/bin cd x=1 sed x=1 /usr/bin $(pwd) printf
+		done -eu done done grep test 2>/dev/null
+	--verbose 2>/dev/null && /usr/bin --verbose "$@" --verbose cd 2>/dev/null
+done then 'quoted text' 2>/dev/null awk
+	echo test "$1" awk ${HOME} 'quoted text' 'quoted text' done local 'quoted text'
+		local -eu x=1 grep && done cd "$1" "$1" echo 2>/dev/null grep --verbose done
+then x=1 export awk export awk awk $(pwd) test export
+	cd /usr/bin -eu readonly then local
+	'quoted text' sed | x=1 "$@" printf x=1 && 'quoted text'
+| test -eu --verbose readonly export awk
+		--verbose grep -eu awk cd test test sed readonly done --verbose
+		| -eu echo 'quoted text' x=1 test | /usr/bin
+&& printf -eu sed test readonly printf cd awk awk export
+	sed local printf test $(pwd) readonly printf --verbose then sed
+	sed | test x=1 'quoted text' && readonly echo
+		$(pwd) x=1 readonly "$1" then "$1" ${HOME} cd 2>/dev/null then && awk
+		test local awk sed 'quoted text' grep && test 'quoted text'
+	echo && cd 'quoted text' "$1" done x=1 export cd readonly
+	$(pwd) $(pwd) $(pwd) 2>/dev/null "$@" $(pwd) export "$1" readonly echo local
+-eu local /usr/bin then echo --verbose "$@" cd "$1" "$1" -eu
+	local awk grep 2>/dev/null | readonly "$1" -eu $(pwd)
+	local $(pwd) ${HOME} && /usr/bin 'quoted text' test
+$(pwd) 'quoted text' then then --verbose
+	done -eu ${HOME} 2>/dev/null -eu --verbose
+done cd --verbose readonly then -eu x=1 | x=1 local cd grep /usr/bin /usr/bin
+	then done "$@" readonly local x=1 test readonly
+	2>/dev/null awk ${HOME} && $(pwd) 'quoted text' /usr/bin readonly /usr/bin -eu
+	done sed 'quoted text'
+	--verbose "$@" local /usr/bin test cd && printf cd "$@" export
+	--verbose $(pwd) "$1" done ${HOME} grep
+/usr/bin 'quoted text' echo ${HOME} 2>/dev/null done
+	&& echo | cd x=1 "$@" done 2>/dev/null | grep printf x=1 awk cd sed then
+		cd $(pwd) "$1" export "$1" test 2>/dev/null "$1" readonly
+'quoted text' readonly && printf | echo ${HOME} test /usr/bin test "$1" export
+		echo 'quoted text' | local | awk | && --verbose | $(pwd) local
+$(pwd) ${HOME} echo test test && "$1" sed test 'quoted text'
+		printf grep readonly sed $(pwd) awk test --verbose grep echo -eu &&
+test then cd | "$@" done "$1" $(pwd) awk
+	awk printf "$1" 2>/dev/null --verbose then x=1
+	readonly awk then readonly | 'quoted text'
+--verbose echo -eu test test grep local "$@" printf | "$1" "$@" sed grep
+		echo $(pwd) then ${HOME} "$@"
+	"$1" "$1" "$@" && ${HOME} awk x=1 printf
+awk local "$@" 2>/dev/null then | grep echo test 2>/dev/null local
+echo /usr/bin ${HOME} awk export awk done done --verbose $(pwd) readonly
+		then test && $(pwd) export echo -eu local |
+"$@" awk ${HOME} cd cd && done "$1" awk --verbose /usr/bin
+| readonly sed sed 2>/dev/null local ${HOME}
+		done printf printf cd printf "$@" "$1" done x=1 "$@" /usr/bin
+&& $(pwd) "$1" sed --verbose 2>/dev/null export printf grep done
+	"$@" /usr/bin done cd 2>/dev/null
+	test then --verbose --verbose -eu | then awk cd awk "$1"
+cd sed cd && $(pwd) readonly "$@" grep /usr/bin
+	${HOME} readonly && awk
+| -eu && printf sed "$1" --verbose 'quoted text'
+	&& | | | then "$@" export && "$@" test $(pwd) --verbose
+	awk local grep 2>/dev/null export
+		done printf printf x=1 printf then local
+export 'quoted text' $(pwd) | echo $(pwd) 'quoted text' x=1 printf echo
+		2>/dev/null 2>/dev/null then
+		"$1" /usr/bin 2>/dev/null printf /usr/bin 2>/dev/null
+	printf "$@" done export -eu printf sed echo $(pwd) then awk done --verbose echo
+local sed then printf export
+		test x=1 x=1 grep done /usr/bin x=1 x=1 | grep
+		"$@" test x=1 "$1" &&
+		'quoted text' "$@" sed done sed done then done
+echo "$@" echo done done /usr/bin
+		then readonly then ${HOME}
+		x=1 --verbose done "$1" local printf ${HOME} sed &&
+		-eu "$@" | -eu --verbose 'quoted text'
+	sed "$1" printf done export local printf x=1 sed echo export x=1
+	local grep then readonly ${HOME} cd 'quoted text' ${HOME} 2>/dev/null
+	${HOME} x=1 -eu grep -eu "$1" && readonly
+		${HOME} /usr/bin printf "$1" | sed printf --verbose ${HOME} /usr/bin
+		awk --verbose 'quoted text' then sed echo
+printf export x=1 cd printf printf readonly $(pwd) local
+"$@" | readonly test -eu then grep sed grep then cd readonly awk readonly
+done export printf x=1 echo "$@" 2>/dev/null awk /usr/bin sed --verbose
+	"$1" readonly cd sed echo x=1 2>/dev/null
+		--verbose printf "$@" 2>/dev/null sed cd sed $(pwd)
+		local ${HOME} -eu done awk "$@" sed "$@" grep
+/usr/bin awk 'quoted text' /usr/bin | test echo grep $(pwd) awk
+grep "$@" x=1 test /usr/bin printf 'quoted text' test export ${HOME}
+		local /usr/bin x=1 test echo x=1 x=1 grep -eu --verbose ${HOME} "$1" sed /usr/bin
+	then x=1 ${HOME} x=1 sed printf then /usr/bin readonly && /usr/bin
+readonly $(pwd) /usr/bin 'quoted text' then 'quoted text' x=1 export | $(pwd)
+/usr/bin -eu cd export && 2>/dev/null awk --verbose
+echo | /usr/bin --verbose echo -eu /usr/bin x=1 then
+&& cd cd x=1 --verbose awk test 2>/dev/null
+	done cd then done "$@" x=1 "$1" x=1 -eu done 2>/dev/null
+&& export readonly sed then readonly
+awk | /usr/bin done /usr/bin $(pwd) -eu readonly awk readonly
+		done /usr/bin -eu $(pwd) $(pwd) 'quoted text' $(pwd) ${HOME}
+		| cd | /usr/bin ${HOME} grep export test done printf done /usr/bin then
+	cd ${HOME} -eu "$@" grep echo test | 'quoted text' x=1 done 2>/dev/null /usr/bin
+	cd "$1" -eu readonly && --verbose | $(pwd) then export --verbose
+-eu -eu "$@" echo $(pwd) awk /usr/bin export grep 2>/dev/null
+		export then x=1 export
+test sed done | "$1" readonly --verbose awk 'quoted text'
+sed then done ${HOME} printf then done local | test && cd cd
+		echo && sed test ${HOME} awk readonly && echo x=1 "$@" echo && sed
+		/usr/bin x=1 grep 2>/dev/null
+		done && readonly local done x=1 printf -eu export --verbose done "$1" |
+		readonly export && x=1 printf
+	-eu $(pwd) done test grep local cd readonly sed sed | then
+2>/dev/null readonly cd && then /usr/bin /usr/bin then x=1 then awk cd
+${HOME} echo test && sed --verbose && 2>/dev/null
+${HOME} /usr/bin $(pwd)
+echo /usr/bin printf "$1" /usr/bin awk test 'quoted text' 2>/dev/null ${HOME}
+	--verbose cd 2>/dev/null
+readonly ${HOME} local done | then /usr/bin "$1" 2>/dev/null
+sed /usr/bin grep 'quoted text' /usr/bin | printf export ${HOME} && | cd then |
+	done done export && $(pwd) $(pwd) test done | printf export echo
+x=1 then then "$@" "$1" then ${HOME} printf &&
+export "$@" /usr/bin && sed x=1 --verbose -eu /usr/bin
+then && "$1" readonly readonly then -eu --verbose then export done echo export
+		"$@" sed awk awk grep echo sed cd sed -eu readonly "$1" echo /usr/bin x=1
+		printf grep | cd | sed awk done $(pwd) "$@" && sed "$@" "$1" "$1" local
+	${HOME} awk done echo readonly test /usr/bin grep /usr/bin awk sed && ${HOME}
+	$(pwd) && done /usr/bin x=1 test --verbose "$1" /usr/bin
+		2>/dev/null sed /usr/bin done awk --verbose printf "$1" -eu cd 'quoted text'
+	/usr/bin --verbose && echo | ${HOME} --verbose
+readonly --verbose export $(pwd)
+	readonly "$1" ${HOME} done sed readonly
+		export -eu export 2>/dev/null done && "$@" cd echo awk then -eu echo done
+	${HOME} "$1" /usr/bin "$@" local cd "$@" $(pwd) | awk cd grep 2>/dev/null
+		readonly local 'quoted text' readonly done test
+awk --verbose "$1" x=1 --verbose
+		"$1" ${HOME} echo done done && printf ${HOME} "$@" local cd
+${HOME} | x=1 2>/dev/null "$1" "$@" awk local echo
+		done | test cd done --verbose &&
+	local -eu $(pwd) test ${HOME} export local
+	cd "$1" 'quoted text' cd cd export 2>/dev/null /usr/bin
+--verbose && then 2>/dev/null -eu
+-eu x=1 x=1 && export --verbose export 'quoted text' | "$@" $(pwd)
+	printf printf && sed | && cd
+		$(pwd) printf then x=1 /usr/bin "$1" 2>/dev/null --verbose | ${HOME}
+	${HOME} test && sed ${HOME} "$1" && cd then
+		printf ${HOME} -eu sed cd
+awk && test 2>/dev/null 'quoted text' /usr/bin
+-eu awk "$1" test 2>/dev/null printf ${HOME} readonly ${HOME} "$@" test done
+	test 2>/dev/null /usr/bin "$1"
+		readonly -eu && printf test grep local
+		local cd echo | ${HOME} echo x=1 export $(pwd) export readonly /usr/bin
+'quoted text' export local grep x=1
+test --verbose x=1 -eu test --verbose then ${HOME} sed x=1 done cd printf
+/usr/bin done | "$1" echo 2>/dev/null echo x=1 grep grep printf "$@" $(pwd)
+	${HOME} 'quoted text' x=1 -eu x=1 export
+--verbose local "$@" done --verbose
+awk && cd | export 2>/dev/null ${HOME}
+x=1 echo echo -eu && awk -eu && test -eu ${HOME}
+		then ${HOME} export --verbose | "$@" test ${HOME} then --verbose ${HOME} ${HOME}
+	then local sed readonly 'quoted text' -eu
+		sed test sed readonly export readonly 2>/dev/null cd "$1"
+		sed x=1 printf then ${HOME} && done then "$@"
+	| | readonly sed "$1" && awk
+	$(pwd) ${HOME} done printf
+${HOME} "$@" -eu grep ${HOME} echo done export local awk cd printf done
+		$(pwd) readonly export done
+'quoted text' x=1 && && 2>/dev/null grep /usr/bin
+export $(pwd) done cd then printf /usr/bin test echo $(pwd)
+'quoted text' sed && $(pwd) --verbose x=1 awk
+export awk sed echo 2>/dev/null /usr/bin done export $(pwd)
+		test 2>/dev/null ${HOME} echo 2>/dev/null
+		grep 'quoted text' --verbose local x=1 export $(pwd)
+printf $(pwd) "$@" "$1" then
+	2>/dev/null 2>/dev/null 'quoted text' 2>/dev/null readonly &&
+	2>/dev/null sed "$1" -eu && ${HOME}
+-eu && x=1 /usr/bin awk --verbose -eu grep sed cd -eu sed | done cd && /usr/bin
+		-eu echo test "$@" done "$@" $(pwd)
+	then test ${HOME} "$1" sed readonly then ${HOME}
+		| /usr/bin /usr/bin $(pwd) printf -eu done export | echo 2>/dev/null local
+"$1" sed grep then -eu "$1" "$1" "$1" export 'quoted text' "$@" cd 2>/dev/null
+		"$@" "$1" then readonly /usr/bin test sed local printf $(pwd) cd
+	then "$@" readonly --verbose
+--verbose 'quoted text' export /usr/bin sed
+	--verbose readonly 'quoted text' x=1 ${HOME} $(pwd) echo grep
+printf readonly readonly 2>/dev/null "$1" local 2>/dev/null "$1" test $(pwd) readonly
+| "$1" 2>/dev/null done 2>/dev/null "$@" test | $(pwd)
+	-eu then $(pwd) && done cd local
+	awk grep /usr/bin "$@" 'quoted text'
+		&& /usr/bin /usr/bin local "$@" cd --verbose sed
+	grep x=1 "$@" "$1" /usr/bin -eu then done 2>/dev/null "$1" ${HOME} --verbose
+	$(pwd) x=1 2>/dev/null test printf cd && -eu 'quoted text'
+		x=1 echo && "$1" --verbose sed local then "$@" --verbose test sed "$1" export -eu
+export 'quoted text' export done done $(pwd) local --verbose then awk printf echo
+	-eu 2>/dev/null export done cd --verbose
+		/usr/bin export grep | "$@"
+		"$@" awk -eu --verbose x=1 then cd | then "$1" && printf sed | printf awk export
+		awk ${HOME} cd printf "$1"
+done && test /usr/bin local
+		"$1" readonly test sed ${HOME} $(pwd) then x=1 2>/dev/null && -eu "$1" 'quoted text'
+printf "$1" then printf x=1 printf "$@" 2>/dev/null
+--verbose grep grep && then 2>/dev/null
+	echo printf -eu printf --verbose local local
+		"$1" printf then | awk echo 2>/dev/null grep done && done export
+	$(pwd) awk x=1 "$1" 'quoted text' then 2>/dev/null
+/usr/bin /usr/bin awk | grep "$1" 'quoted text' x=1
+		printf x=1 sed "$1" --verbose ${HOME} "$1" $(pwd) -eu ${HOME} export --verbose
+| then grep "$1" ${HOME} --verbose
+		${HOME} grep printf ${HOME} x=1
+		/usr/bin "$1" cd awk local test done
+	&& --verbose test sed "$@" && && test $(pwd) "$1" ${HOME}
+	"$@" ${HOME} $(pwd) 'quoted text' done "$1" --verbose printf "$@"
+	readonly local grep ${HOME} "$1" awk test test --verbose then grep
+&& local test "$1" test /usr/bin "$@" "$@" 'quoted text' /usr/bin /usr/bin cd
+		&& $(pwd) local cd printf | echo --verbose cd awk test grep -eu $(pwd) ${HOME}
+		done test export && -eu awk "$1" test $(pwd)
+	x=1 then export test ${HOME} local --verbose readonly
+		"$@" grep 2>/dev/null 'quoted text'
+	&& grep test test | && export -eu readonly && local grep
+printf awk -eu awk local /usr/bin "$@" $(pwd) printf --verbose
+	grep then then test sed
+readonly then export awk echo $(pwd) local --verbose && echo
+		echo local done local "$1" && local "$1" grep local --verbose 'quoted text'
+		"$1" "$@" | /usr/bin --verbose
+	sed done && test done --verbose awk done readonly
+		cd | -eu "$@" --verbose echo "$1" then test -eu cd
+		/usr/bin done readonly then ${HOME} | /usr/bin echo && readonly x=1 'quoted text'
+x=1 x=1 awk 2>/dev/null local $(pwd) grep -eu cd printf done printf export
+test 2>/dev/null "$1" local awk 'quoted text' 'quoted text' grep -eu -eu echo
+	then local local echo 2>/dev/null export then /usr/bin x=1
+local 'quoted text' 2>/dev/null done done awk x=1 'quoted text'
+	echo $(pwd) | printf readonly
+echo ${HOME} -eu "$@" printf done "$1" awk "$1" awk "$1" "$1"
+		| x=1 local "$@" readonly grep
+		readonly | -eu && printf --verbose test then sed ${HOME}
+		| "$1" $(pwd) local "$@" printf 2>/dev/null --verbose readonly printf awk /usr/bin
+		&& && | && "$1" local grep --verbose readonly 2>/dev/null 'quoted text'
+		printf echo "$@" /usr/bin readonly export $(pwd) sed x=1 awk x=1 &&
+		readonly local grep x=1 "$@" awk -eu then done && printf grep "$@" local
+	export | cd export awk test -eu test export
+		${HOME} then printf readonly grep sed &&
+"$1" done ${HOME} readonly then
+		| /usr/bin done 'quoted text'
+${HOME} 'quoted text' "$@" -eu then then cd test -eu then printf echo grep awk
+	/usr/bin awk done | | 'quoted text' x=1 export ${HOME} "$@"
+		&& x=1 awk && ${HOME} cd
+	-eu cd -eu && | -eu /usr/bin
+	"$@" export ${HOME} then x=1 awk x=1 2>/dev/null export |
+	cd | then 2>/dev/null "$@" | sed sed test "$@" awk && x=1 readonly export
+then | 2>/dev/null awk cd echo | readonly -eu readonly | test | x=1 readonly
+		cd sed x=1 $(pwd) 2>/dev/null readonly then readonly printf
+	sed $(pwd) 'quoted text' grep /usr/bin 'quoted text' awk cd
+	grep | readonly 'quoted text' ${HOME} done $(pwd) ${HOME}
+	-eu "$@" echo 2>/dev/null
+	${HOME} 2>/dev/null x=1 x=1 2>/dev/null printf 2>/dev/null
+		awk 2>/dev/null -eu test "$1" --verbose sed $(pwd) 'quoted text' cd test "$@" printf
+	readonly sed local && export --verbose readonly export
+		sed $(pwd) 2>/dev/null "$1" sed -eu grep | -eu
+		awk test test awk readonly /usr/bin readonly -eu
+		test /usr/bin "$1" echo | sed --verbose
+		done $(pwd) 'quoted text' then x=1 | done "$@" awk readonly 2>/dev/null readonly
+--verbose 2>/dev/null ${HOME} printf $(pwd) "$1" readonly
+		| sed "$@" 'quoted text' &&
+	awk sed local printf then then sed readonly
+"$@" | done -eu "$@" 'quoted text' export readonly
+	printf --verbose x=1 x=1 then echo printf export awk awk 2>/dev/null test sed
+done awk grep $(pwd) printf ${HOME} readonly test export --verbose sed
+		/usr/bin readonly -eu sed readonly export 'quoted text'
+	readonly 2>/dev/null ${HOME} ${HOME}
+-eu cd sed && export x=1 done "$@" "$@" sed test
+		--verbose done ${HOME} "$1" echo done 2>/dev/null echo test "$1" test x=1 x=1 sed
+		test grep "$@" ${HOME} then && "$1" export echo done then local sed test --verbose
+"$@" cd /usr/bin -eu
+	-eu printf 2>/dev/null sed -eu
+	test echo then cd test awk "$@" printf | cd "$@" local export 2>/dev/null
+	export export echo && x=1 "$1" x=1 -eu sed done 'quoted text'
+	&& "$@" then then printf grep && "$1"
+	$(pwd) "$1" | "$1" printf export | awk --verbose ${HOME}
+		local done done && --verbose local /usr/bin x=1 "$1" "$1" x=1 --verbose test sed
+		readonly sed readonly 'quoted text' readonly
+'quoted text' export -eu -eu awk export && export
+		printf cd readonly printf ${HOME}
+	| done --verbose then && readonly x=1 cd cd x=1 echo && then awk x=1 "$@" 'quoted text'
+grep awk && awk $(pwd) local $(pwd) export x=1 && test --verbose
+test sed /usr/bin 'quoted text' printf echo -eu "$@" "$@"
+${HOME} sed --verbose grep 'quoted text'
+&& cd /usr/bin sed /usr/bin --verbose
+grep local grep then 'quoted text' x=1
+2>/dev/null export | ${HOME}
+	readonly 'quoted text' export then
+		test export test ${HOME} "$@" grep | 'quoted text' grep done awk done
+	grep then done awk ${HOME} cd local
+local cd /usr/bin $(pwd) && && x=1 done "$@" 'quoted text'
+	printf 'quoted text' "$1" 2>/dev/null && && /usr/bin printf 'quoted text'
+local /usr/bin then ${HOME} 'quoted text' x=1 test export $(pwd) readonly grep
+		test && ${HOME} x=1 readonly "$@" --verbose
+		export | grep readonly awk sed done echo export ${HOME}
+		'quoted text' readonly 2>/dev/null "$@" local | grep export $(pwd)
+		echo "$@" printf grep && then echo then 'quoted text' readonly awk && printf
+'quoted text' ${HOME} export -eu "$1" then test
+		export local then cd test printf test done x=1 'quoted text'
+		sed done ${HOME} /usr/bin "$@" | cd printf | printf $(pwd) cd sed "$@" then
+x=1 -eu && export awk local awk $(pwd) readonly
+readonly grep printf local ${HOME} sed
+		done cd test && "$@" x=1 test awk x=1 && echo
+then 'quoted text' readonly
+printf "$1" done local then export -eu local grep test
+	local $(pwd) ${HOME} x=1 readonly
+	x=1 2>/dev/null $(pwd) export awk cd && done 2>/dev/null export
+		--verbose /usr/bin grep --verbose local x=1 grep grep echo printf | test
+	-eu 2>/dev/null readonly && 2>/dev/null | -eu sed echo "$1" awk export /usr/bin
+		2>/dev/null printf awk ${HOME} cd "$@" echo sed ${HOME} done -eu ${HOME} local
+		readonly $(pwd) 'quoted text' sed printf sed "$1" readonly
+		echo grep x=1 echo --verbose --verbose
+	'quoted text' "$@" x=1 --verbose local test export
+		local then printf /usr/bin "$@" 2>/dev/null /usr/bin "$@" && "$1"
+		/usr/bin awk awk && test /usr/bin 2>/dev/null 2>/dev/null local awk printf awk
+	local 2>/dev/null local export export | export sed x=1
+	test readonly sed readonly x=1 --verbose $(pwd) && sed
+	/usr/bin local $(pwd) 'quoted text' 'quoted text' done ${HOME} x=1
+	then sed local export ${HOME} cd 'quoted text' done 2>/dev/null
+	&& sed /usr/bin then /usr/bin echo $(pwd) cd 2>/dev/null $(pwd)
+readonly sed local local $(pwd) echo printf $(pwd) then -eu 2>/dev/null
+test $(pwd) -eu && printf 2>/dev/null readonly
+/usr/bin 'quoted text' x=1 then readonly
+		readonly sed "$1" | "$@" cd 'quoted text' then $(pwd) 2>/dev/null x=1 && then
+	local awk echo readonly 2>/dev/null echo local | echo ${HOME}
+		readonly export echo && "$1" local
+		'quoted text' test awk "$1" "$1" ${HOME} ${HOME} 'quoted text' sed awk readonly
+	sed grep 2>/dev/null cd ${HOME}
+	'quoted text' ${HOME} export /usr/bin -eu /usr/bin -eu $(pwd)
+-eu test x=1 | | local readonly sed
+${HOME} "$1" "$1" echo | "$1" test ${HOME} grep --verbose
+	local cd local done "$@" |
+grep ${HOME} && | readonly 'quoted text'
+	test done ${HOME} test echo ${HOME}
+		| local "$1" $(pwd) test printf then awk && printf readonly done && --verbose
+	readonly awk && sed 2>/dev/null x=1 sed $(pwd)
+	done awk "$1" sed local sed | /usr/bin echo -eu grep echo local
+	$(pwd) ${HOME} test && 'quoted text' grep sed
+		sed grep --verbose 'quoted text' x=1 /usr/bin 2>/dev/null "$1"
+		$(pwd) 2>/dev/null 'quoted text' | awk | 2>/dev/null
+	| then export | "$1" local awk printf x=1 --verbose export ${HOME} 2>/dev/null
+		then readonly test "$@" $(pwd) test
+	x=1 'quoted text' local --verbose -eu test -eu readonly
+	then export test ${HOME} echo export 'quoted text'
+	readonly echo local test readonly 'quoted text' && "$1" 2>/dev/null ${HOME} ${HOME}
+/usr/bin "$@" "$@" -eu sed /usr/bin
+'quoted text' && done $(pwd) export $(pwd) /usr/bin echo --verbose --verbose
+		sed readonly && echo --verbose
+		readonly grep grep "$@" -eu local "$1"
@@ -0,0 +1,2001 @@
+&& export -eu ${HOME} 2>/dev/null printf | local
+	done $(pwd) "$1" $(pwd) done cd 2>/dev/null local ${HOME} 'quoted text' done ${HOME}
+		sed cd awk -eu --verbose readonly echo
+"$@" $(pwd) x=1 local -eu $(pwd) -eu readonly cd local && ${HOME} readonly -eu
+		test -eu local printf
+	2>/dev/null ${HOME} echo grep "$@"
+		grep | sed $(pwd) then $(pwd) printf readonly local cd echo printf 'quoted text'
+	export | x=1 | -eu --verbose $(pwd) test $(pwd) --verbose -eu then ${HOME}
+/usr/bin readonly readonly --verbose done echo done 'quoted text'
+	"$@" readonly awk printf export ${HOME} printf | readonly
+		printf 'quoted text' cd | --verbose /usr/bin
+$(pwd) then then awk "$1" grep --verbose /usr/bin 2>/dev/null
+$(pwd) 2>/dev/null grep 2>/dev/null local ${HOME} "$@"
+		readonly sed "$1" done readonly 2>/dev/null cd && test test x=1
+test printf $(pwd) --verbose 2>/dev/null -eu 'quoted text'
+	${HOME} /usr/bin echo "$@" cd local readonly export sed done
+grep done local | awk export then 'quoted text' awk echo readonly awk cd --verbose
+awk "$1" then ${HOME} 'quoted text'
+	${HOME} $(pwd) 'quoted text' 2>/dev/null /usr/bin sed export readonly cd
+		cd cd -eu readonly then echo done /usr/bin printf && done echo
+echo done --verbose readonly | && local export then && $(pwd) "$@" awk local printf
+export printf -eu done 'quoted text' echo && | cd export export $(pwd) $(pwd)
+		"$1" local | echo 2>/dev/null "$1" ${HOME} grep --verbose echo export
+	export awk printf readonly "$@" sed
+		2>/dev/null local "$1" sed | && -eu 'quoted text' /usr/bin ${HOME} 2>/dev/null
+	-eu 2>/dev/null /usr/bin awk $(pwd) | /usr/bin "$@" cd awk printf
+"$@" test "$@" printf done x=1 x=1 readonly test ${HOME} done awk
+		then awk && printf | --verbose then readonly export done test awk $(pwd) test
+		sed x=1 $(pwd) "$1" --verbose "$@" --verbose -eu
+		$(pwd) test readonly export --verbose done "$1" --verbose local && "$@" then
+	awk | --verbose done done test test -eu printf
+	test then echo "$1" printf "$1" local awk --verbose ${HOME} sed 'quoted text'
+	done "$1" awk cd echo "$@" && grep $(pwd)
+		local && echo done "$1"
+-eu echo "$1" /usr/bin "$@" cd --verbose done $(pwd) done
+		--verbose 2>/dev/null 2>/dev/null cd then export printf --verbose
+	export cd echo sed then grep -eu sed done x=1 && printf && grep "$1" /usr/bin
+		-eu export x=1 test /usr/bin "$1" test x=1
+		| "$@" test export awk
+	"$1" "$@" grep "$@" sed | export echo "$@" echo
+	cd -eu local x=1 local $(pwd) /usr/bin test ${HOME}
+	| local grep then test printf 'quoted text' 'quoted text' /usr/bin
+		/usr/bin 'quoted text' | ${HOME} readonly 'quoted text'
+		cd export sed /usr/bin awk readonly -eu echo cd
+	"$1" x=1 x=1 awk x=1 -eu grep -eu then
+"$1" x=1 "$1" "$@" ${HOME} -eu readonly
+"$@" done done -eu done cd $(pwd) 2>/dev/null /usr/bin
+"$1" "$@" 2>/dev/null "$1" echo awk && "$1" cd $(pwd) ${HOME} /usr/bin
+	local awk /usr/bin then
+		awk local --verbose /usr/bin printf done $(pwd) readonly echo -eu --verbose
+	then sed x=1 --verbose $(pwd)
+| echo | ${HOME} $(pwd) x=1 echo local cd then
+	sed export printf /usr/bin
+	$(pwd) x=1 cd printf test done "$@" ${HOME} $(pwd) -eu --verbose printf
+	/usr/bin -eu echo local 2>/dev/null
+	local && 'quoted text' printf x=1 x=1 printf export | 2>/dev/null
+| test 'quoted text' 2>/dev/null $(pwd) "$@" cd
+	done export x=1 test grep test echo readonly
+		local /usr/bin then test sed --verbose 2>/dev/null then
+		grep $(pwd) export local /usr/bin cd test readonly then "$@" cd echo
+		$(pwd) test && printf cd cd && then awk 'quoted text' sed awk echo test
+"$@" then 2>/dev/null "$1" 'quoted text' 2>/dev/null -eu /usr/bin done printf
+-eu export readonly --verbose printf test 2>/dev/null
+		${HOME} local ${HOME} $(pwd) then export then --verbose
+		"$1" cd "$@" echo awk 2>/dev/null readonly /usr/bin -eu grep readonly "$1" && /usr/bin
+	&& 'quoted text' sed grep "$1" test cd then export
+	2>/dev/null x=1 local grep
+grep export ${HOME} "$@" local test "$@" 2>/dev/null done "$1" $(pwd) sed
+		${HOME} readonly x=1 then local test "$1" --verbose export x=1 echo 2>/dev/null
+		${HOME} test awk ${HOME} export --verbose 2>/dev/null /usr/bin
+	cd && x=1 echo export done "$1" cd "$1" && /usr/bin
+		export "$1" sed export "$1" echo x=1 "$@" ${HOME} awk |
+	/usr/bin $(pwd) echo export "$1" export awk test
+| done 'quoted text' "$@" then "$@" | | && awk sed cd printf --verbose 'quoted text'
+	sed local x=1 done test "$@" export "$@" grep
+		cd readonly export grep done awk && --verbose /usr/bin grep
+		${HOME} $(pwd) done sed cd "$@" sed cd --verbose && awk done 2>/dev/null x=1
+$(pwd) | sed then echo test --verbose cd 'quoted text' echo
+"$1" /usr/bin grep cd 'quoted text' grep readonly grep sed grep
+		grep "$@" sed test | -eu && $(pwd) 2>/dev/null 2>/dev/null
+		/usr/bin local readonly "$1" 2>/dev/null && | ${HOME} && "$@" ${HOME} && printf
+		grep then 'quoted text' /usr/bin printf | | cd "$@" awk
+	x=1 echo | printf done /usr/bin grep && echo awk local && --verbose -eu
+		printf /usr/bin grep ${HOME} | local 2>/dev/null 2>/dev/null
+	${HOME} /usr/bin awk echo local readonly sed 2>/dev/null --verbose export
+2>/dev/null --verbose export grep local
+'quoted text' 2>/dev/null grep printf grep export "$1" ${HOME} done
+		$(pwd) 'quoted text' x=1 2>/dev/null
+"$@" /usr/bin export cd done "$1" test done /usr/bin cd 2>/dev/null test cd sed
+		done grep grep "$1" | 2>/dev/null 'quoted text' $(pwd) then then 2>/dev/null
+	local test local "$@" printf 'quoted text'
+	readonly echo 2>/dev/null then "$1" test
+printf "$@" | awk 'quoted text' "$@"
+		| printf awk | readonly /usr/bin /usr/bin | x=1 "$@" && cd readonly "$1"
+sed then ${HOME} --verbose then export readonly
+		$(pwd) printf 'quoted text' cd echo awk x=1 printf && --verbose ${HOME} local
+$(pwd) $(pwd) echo printf export local $(pwd) -eu /usr/bin grep readonly
+	'quoted text' printf sed
+		'quoted text' && export printf "$1" printf echo -eu then
+"$1" 2>/dev/null $(pwd) sed x=1 "$1" printf export
+echo 'quoted text' awk test readonly && /usr/bin
+'quoted text' "$@" echo local then test then test && "$@" done --verbose
+		-eu $(pwd) sed $(pwd) readonly 'quoted text' cd && x=1 sed 'quoted text' | -eu
+x=1 printf then "$1" grep local export x=1 grep 2>/dev/null sed 'quoted text'
+		echo awk then sed readonly readonly "$1" "$1" cd readonly $(pwd)
+awk 'quoted text' | done /usr/bin local grep
+	x=1 2>/dev/null then --verbose && echo grep local -eu grep $(pwd)
+--verbose ${HOME} | && && then cd $(pwd) /usr/bin
+	&& --verbose echo -eu ${HOME} $(pwd) $(pwd) local
+	local grep ${HOME} grep export "$@"
+local -eu ${HOME} -eu /usr/bin done then local
+grep "$1" ${HOME} sed
+		${HOME} done sed /usr/bin ${HOME} -eu "$@" ${HOME} readonly cd "$1" sed "$@"
+--verbose export then "$@" 2>/dev/null
+		${HOME} sed export local local 'quoted text' "$1" then -eu echo done x=1
+grep echo then readonly done sed $(pwd) && cd ${HOME} &&
+		'quoted text' test local -eu awk done --verbose ${HOME} cd export
+		grep printf sed export "$1" awk printf awk echo
+	${HOME} then done echo readonly cd
+grep sed -eu sed 2>/dev/null | /usr/bin
+		readonly sed x=1 "$@" awk $(pwd) "$1" "$1" --verbose
+	echo test /usr/bin done 2>/dev/null test 2>/dev/null "$@" "$1" cd test sed "$@"
+2>/dev/null test readonly "$1" 'quoted text' "$1" "$1"
+	--verbose test ${HOME} then done
+	awk && -eu /usr/bin 2>/dev/null done export echo echo -eu sed 2>/dev/null
+	cd awk readonly && -eu done x=1 local &&
+	-eu printf then ${HOME} sed grep grep x=1 test ${HOME} done
+$(pwd) grep export done $(pwd)
+'quoted text' done 'quoted text'
+	/usr/bin 2>/dev/null echo printf 2>/dev/null
+/usr/bin 2>/dev/null grep grep "$@" "$@" sed awk ${HOME} awk
+	readonly test done printf readonly readonly 'quoted text' done ${HOME}
+--verbose local "$1" grep x=1
+		sed /usr/bin 'quoted text' done -eu 'quoted text'
+&& -eu awk ${HOME} 'quoted text' $(pwd) done cd "$1" "$1" done ${HOME}
+		&& /usr/bin done && sed test | "$@" cd --verbose awk printf "$1" $(pwd)
+	local --verbose grep && cd echo echo && x=1 local sed ${HOME} "$@" test awk
+readonly cd $(pwd) local
+	"$1" $(pwd) local ${HOME} done $(pwd) "$1"
+cd "$@" "$1" "$@" "$@" local
+		awk "$1" -eu /usr/bin ${HOME} | cd sed 'quoted text' printf
+		| "$@" x=1 ${HOME} | test sed -eu
+test echo x=1 export export cd echo
+"$@" -eu test awk sed test
+		/usr/bin local then local | 'quoted text' x=1 test test -eu
+test local 2>/dev/null "$1" /usr/bin
+	readonly 'quoted text' cd then && 'quoted text' cd /usr/bin 'quoted text' "$@"
+		test x=1 awk "$1" 'quoted text'
+		--verbose $(pwd) x=1 x=1 echo ${HOME} echo /usr/bin -eu
+/usr/bin "$1" --verbose grep && && "$@" 2>/dev/null test awk test -eu $(pwd)
+	$(pwd) then x=1 test $(pwd) sed printf /usr/bin /usr/bin cd done
+	"$1" 'quoted text' "$1" ${HOME} "$@" "$1" $(pwd) readonly then sed awk printf
+$(pwd) awk readonly "$1" echo --verbose /usr/bin printf echo 2>/dev/null
+x=1 awk | awk ${HOME} awk "$@" ${HOME}
+&& 'quoted text' readonly 'quoted text' echo "$1"
+		${HOME} then cd /usr/bin && echo "$1" grep
+${HOME} printf ${HOME} && echo then test printf printf cd "$@" $(pwd) then
+		local grep readonly /usr/bin | "$1" readonly grep sed cd grep ${HOME}
+"$1" grep 'quoted text' awk readonly
+	2>/dev/null awk -eu printf printf
+/usr/bin cd then done "$1" "$@" /usr/bin local sed 2>/dev/null -eu then "$1" &&
+	x=1 export /usr/bin "$1"
+/usr/bin "$@" $(pwd) echo && 'quoted text' x=1 test echo done awk /usr/bin
+'quoted text' /usr/bin readonly readonly readonly
+/usr/bin -eu x=1 awk export
+	sed $(pwd) $(pwd) "$@" /usr/bin "$@" local "$1" grep echo done sed --verbose
+		sed x=1 && readonly export local grep grep readonly ${HOME} echo cd awk printf
+		echo awk local && echo
+x=1 /usr/bin -eu sed printf cd && --verbose
+	done x=1 cd && ${HOME} printf export -eu 2>/dev/null cd ${HOME} awk x=1 then
+		cd 'quoted text' /usr/bin -eu 'quoted text' $(pwd) echo /usr/bin
+printf readonly local printf printf sed
+	&& cd "$@" echo echo readonly --verbose printf /usr/bin
+printf echo cd printf done "$1" export "$1" awk export $(pwd) | | 2>/dev/null
+local | 2>/dev/null 'quoted text'
+		"$@" /usr/bin -eu -eu 2>/dev/null then export | cd $(pwd) -eu
+then ${HOME} x=1 grep 2>/dev/null awk export --verbose export
+		/usr/bin done 2>/dev/null 'quoted text' sed x=1 readonly $(pwd) ${HOME}
+test x=1 test && export "$@" awk echo ${HOME} echo && 'quoted text'
+	$(pwd) sed && then test readonly
+	cd x=1 /usr/bin -eu readonly /usr/bin done ${HOME}
+	local | "$@" printf printf 2>/dev/null cd $(pwd) cd "$@" -eu then && printf
+	--verbose -eu test done | readonly | | cd ${HOME}
+		sed cd sed /usr/bin | ${HOME}
+	readonly /usr/bin local echo && sed
+"$@" cd done --verbose printf $(pwd) x=1 test done awk
+		done readonly ${HOME} done
+awk sed cd then /usr/bin echo done 'quoted text' export "$1" awk
+		&& then | grep /usr/bin
+local readonly /usr/bin --verbose
+grep echo && 'quoted text' awk ${HOME} 'quoted text'
+	local --verbose printf
+	2>/dev/null $(pwd) "$1" /usr/bin sed test "$@" -eu &&
+	/usr/bin "$1" $(pwd) grep -eu x=1 echo /usr/bin local local readonly
+/usr/bin -eu grep export ${HOME} 2>/dev/null
+test local $(pwd) echo "$1" grep -eu readonly --verbose local
+&& local 2>/dev/null test
+	echo cd awk done done test printf | "$1" && sed $(pwd) sed grep
+		test | printf export export x=1 readonly "$@" test
+&& test cd | export cd -eu cd cd ${HOME} local sed /usr/bin cd --verbose
+		export --verbose printf cd "$1" printf
+		local cd sed grep done grep 'quoted text' ${HOME}
+	x=1 done "$@" $(pwd) then awk ${HOME}
+	2>/dev/null "$@" awk done echo 'quoted text' -eu
+		cd $(pwd) 'quoted text' awk awk x=1 && local test
+	${HOME} "$1" readonly | --verbose test export ${HOME}
+	done ${HOME} -eu 2>/dev/null 2>/dev/null cd done $(pwd)
+		| grep x=1 awk --verbose test --verbose --verbose export
+		| awk $(pwd) -eu | "$1" then then -eu "$@" awk sed readonly
+	x=1 readonly sed $(pwd) "$1" /usr/bin echo "$@" "$@" done awk local done --verbose
+-eu /usr/bin local echo $(pwd) -eu 2>/dev/null done sed local | grep x=1 -eu
+		"$@" $(pwd) awk ${HOME} cd echo -eu --verbose
+grep && test | cd 'quoted text' -eu grep $(pwd)
+	awk echo local x=1 | x=1
+		-eu test "$1" echo "$1" x=1 'quoted text'
+	${HOME} -eu local local awk /usr/bin cd printf 'quoted text' "$@" 'quoted text'
+	2>/dev/null $(pwd) "$1" "$@"
+${HOME} then sed echo && "$@" "$@" --verbose sed x=1 $(pwd)
+cd ${HOME} readonly echo "$@"
+		&& test grep /usr/bin export -eu --verbose
+		/usr/bin "$@" grep -eu | "$1" -eu sed /usr/bin "$@" -eu
+"$1" $(pwd) -eu export echo && awk 2>/dev/null
+		then cd echo /usr/bin export local echo
+| echo 'quoted text' "$1" /usr/bin
+		/usr/bin -eu test ${HOME}
+| awk "$@" test 'quoted text'
+		done "$1" export done cd grep
+&& grep then sed -eu printf test echo done -eu $(pwd) $(pwd) echo readonly
+	'quoted text' | -eu sed cd ${HOME} grep ${HOME} --verbose printf then "$1" /usr/bin
+		readonly ${HOME} x=1 | export done
+	test local && -eu echo "$@" test -eu echo
+x=1 done sed 2>/dev/null done -eu grep readonly
+| --verbose /usr/bin 'quoted text' | cd
+	-eu sed "$@" $(pwd) export grep then x=1 awk 2>/dev/null export
+		'quoted text' 'quoted text' -eu cd "$@" test
+awk /usr/bin grep printf done done local "$@"
+	-eu then 2>/dev/null sed echo echo readonly /usr/bin ${HOME}
+	'quoted text' x=1 then printf cd test /usr/bin /usr/bin && 'quoted text'
+		&& sed then export -eu sed done local --verbose
+done --verbose $(pwd) local 'quoted text'
+	"$@" awk "$1" -eu awk readonly done "$1" cd readonly cd
+	"$1" -eu --verbose awk 2>/dev/null grep "$1" echo
+		x=1 then $(pwd) -eu awk /usr/bin local | 2>/dev/null 'quoted text' -eu
+	printf readonly -eu $(pwd) printf done grep sed awk export export && --verbose
+		grep 2>/dev/null 'quoted text' export grep /usr/bin done local -eu done x=1 'quoted text'
+		sed local sed "$@" 'quoted text' && | cd ${HOME} 'quoted text' --verbose
+		${HOME} readonly "$@" test 2>/dev/null "$@"
+		${HOME} x=1 x=1 --verbose
+	echo printf 'quoted text' "$@" /usr/bin x=1 | done --verbose
+'quoted text' grep && readonly local
+	awk done printf "$@" x=1 --verbose grep local sed sed test
+		export | $(pwd) ${HOME} $(pwd) --verbose grep readonly awk local "$1"
+sed x=1 && x=1 && cd done echo | grep done readonly echo sed "$@" /usr/bin
+	echo 'quoted text' readonly 2>/dev/null -eu 2>/dev/null sed
+2>/dev/null && 2>/dev/null echo 'quoted text' /usr/bin printf
+	sed awk local "$1" --verbose test && 2>/dev/null
+	sed ${HOME} local readonly | echo then then then test test echo
+	printf "$@" "$@" | test | sed | readonly grep readonly -eu readonly 2>/dev/null
+	awk cd printf | $(pwd) sed --verbose /usr/bin 2>/dev/null 'quoted text'
+	-eu export grep echo $(pwd) "$1" then && echo $(pwd)
+		printf x=1 cd test && /usr/bin $(pwd) grep | printf
+		test printf x=1 ${HOME} 2>/dev/null local
+	cd 'quoted text' done printf test 2>/dev/null cd ${HOME} 2>/dev/null readonly printf
+	local then echo local local awk printf done
+	${HOME} ${HOME} x=1 echo local export sed sed "$1" "$1" test cd readonly
+		x=1 ${HOME} ${HOME} 2>/dev/null echo
+grep | printf && $(pwd) echo cd grep local $(pwd) awk printf test
+		$(pwd) sed "$1" printf -eu done 2>/dev/null local $(pwd)
+then --verbose grep && && test x=1 awk /usr/bin
+		export readonly cd then 2>/dev/null test -eu | grep awk $(pwd)
+		then x=1 test local x=1 cd 'quoted text' x=1 readonly done export
+x=1 && awk x=1 ${HOME} "$@" grep 2>/dev/null
+test cd done $(pwd) readonly export export | awk
+	grep 'quoted text' printf -eu x=1 "$@" then awk ${HOME} /usr/bin echo
+	awk test "$@" "$1" /usr/bin /usr/bin
+--verbose readonly export then $(pwd) && local echo | -eu 'quoted text'
+		cd printf $(pwd) cd ${HOME} readonly 'quoted text' echo grep /usr/bin
+"$1" | printf printf x=1 cd done "$1" $(pwd) readonly | test x=1 -eu x=1 ${HOME}
+		"$1" sed /usr/bin export printf test then "$1"
+sed done | sed printf then "$1" | x=1 readonly ${HOME}
+	2>/dev/null $(pwd) /usr/bin
+grep sed export export $(pwd) /usr/bin awk
+--verbose "$1" | "$1" then then
+		&& --verbose grep awk export /usr/bin
+	2>/dev/null local 'quoted text'
+--verbose grep "$1" x=1 -eu
+	awk 2>/dev/null test && cd export export test "$@" printf | 2>/dev/null
+		readonly sed | awk printf echo then $(pwd) done export printf
+		$(pwd) | x=1 sed sed echo grep -eu grep
+cd && local && sed 2>/dev/null /usr/bin 2>/dev/null
+	-eu "$@" test echo x=1 "$@" grep cd "$@" readonly test -eu then -eu echo awk
+	local awk $(pwd) export readonly export done "$1" /usr/bin
+	-eu $(pwd) sed /usr/bin 'quoted text' 2>/dev/null
+x=1 test done -eu test readonly then --verbose cd /usr/bin awk readonly /usr/bin
+'quoted text' test local done && then
+	2>/dev/null done readonly /usr/bin 2>/dev/null $(pwd) test grep
+	done test 2>/dev/null 2>/dev/null printf $(pwd)
+	2>/dev/null local ${HOME} sed $(pwd) x=1 awk
+		"$@" "$@" test x=1 $(pwd) 2>/dev/null
+	$(pwd) readonly && done awk then
+		done "$1" printf sed readonly $(pwd) $(pwd)
+cd readonly ${HOME} export
+echo 2>/dev/null --verbose 'quoted text' cd test
+	sed -eu readonly x=1 then test readonly "$@" echo sed export
+		${HOME} && /usr/bin ${HOME}
+	cd x=1 then $(pwd) --verbose export local printf then
+echo 2>/dev/null done -eu readonly done done local
+&& awk then --verbose then --verbose
+/usr/bin readonly 2>/dev/null --verbose then test sed then printf "$@" local
+		| $(pwd) test sed "$1" -eu "$1" "$@" readonly "$@"
+2>/dev/null /usr/bin cd cd
+		$(pwd) then readonly && sed -eu echo printf cd x=1 ${HOME} /usr/bin 2>/dev/null
+	| sed -eu grep echo -eu --verbose printf "$1" cd cd
+grep export printf local printf x=1 "$@" test printf test test
+		readonly $(pwd) awk 'quoted text'
+&& 'quoted text' --verbose then ${HOME} test | /usr/bin
+echo sed test export x=1 local sed | --verbose 'quoted text' /usr/bin "$@" printf
+	"$@" -eu test echo 2>/dev/null "$1" --verbose $(pwd)
+'quoted text' 'quoted text' local 2>/dev/null --verbose "$1" then
+	sed done 'quoted text' export -eu | /usr/bin local $(pwd) then 'quoted text'
+	grep && ${HOME} sed ${HOME} awk cd | done --verbose test done
+		x=1 awk test /usr/bin done -eu readonly export /usr/bin
+test -eu cd sed 'quoted text'
+export readonly -eu then then printf && sed "$@" local awk export
+	local echo echo "$@" test local | done /usr/bin awk then local 'quoted text' 2>/dev/null
+	then awk readonly then "$@" "$1" sed -eu /usr/bin export 'quoted text' 'quoted text'
+	"$@" readonly done $(pwd) readonly test awk $(pwd) 2>/dev/null grep $(pwd) "$@"
+		-eu x=1 2>/dev/null printf
+		"$@" grep "$@" then test --verbose cd printf
+	sed --verbose awk cd echo sed x=1 | && --verbose
+-eu ${HOME} 2>/dev/null printf then
+	'quoted text' $(pwd) done 'quoted text' awk /usr/bin test 'quoted text' export
+		readonly /usr/bin x=1 | "$1" printf readonly
+		| local 'quoted text' then printf ${HOME}
+x=1 "$@" && grep printf -eu --verbose 'quoted text' -eu readonly
+	| awk x=1 cd then "$@" "$1"
+--verbose readonly awk ${HOME} /usr/bin then test --verbose
+	-eu ${HOME} "$1" test 'quoted text' export
+		$(pwd) ${HOME} readonly echo
+		cd local local && ${HOME} "$@" "$1" readonly "$1" grep --verbose
+printf then 'quoted text' export
+--verbose local -eu "$@" ${HOME} printf --verbose printf
+		${HOME} then echo 'quoted text' --verbose /usr/bin printf
+		cd grep ${HOME} local done
+cd "$1" x=1 "$@" --verbose export 2>/dev/null
+		export /usr/bin | 'quoted text' readonly export grep x=1 'quoted text'
+	printf echo && readonly x=1 "$@" test export export sed ${HOME}
+		then cd ${HOME} && 2>/dev/null $(pwd) | grep readonly | echo echo printf sed
+&& grep grep 'quoted text' && export echo x=1 -eu $(pwd) -eu
+then sed awk sed export readonly && then printf export && done export export
+		printf awk $(pwd) test x=1 local sed
+		awk "$1" --verbose printf 'quoted text'
+		"$1" printf $(pwd) --verbose -eu "$1" ${HOME} done
+export 'quoted text' --verbose
+echo ${HOME} 2>/dev/null -eu then local printf && && 'quoted text' ${HOME} grep
+2>/dev/null printf "$1" cd sed ${HOME} export cd ${HOME}
+--verbose -eu grep readonly test test awk && && done
+	printf "$1" cd test done "$@" 2>/dev/null local printf cd
+	printf grep sed readonly 'quoted text' readonly
+	echo ${HOME} "$@" | awk grep grep sed $(pwd)
+		done sed 2>/dev/null export x=1 $(pwd) --verbose
+	"$1" /usr/bin done echo
+-eu awk local echo 2>/dev/null
+--verbose && awk -eu printf
+		2>/dev/null ${HOME} --verbose "$@"
+	$(pwd) test "$1" test 2>/dev/null x=1 && done /usr/bin $(pwd) test export test
+		$(pwd) -eu | export | sed $(pwd) local sed "$@" then
+		done "$@" x=1 grep readonly cd "$@" printf
+grep ${HOME} x=1 $(pwd) 'quoted text'
+	'quoted text' $(pwd) cd "$@" grep x=1
+	readonly "$1" then cd then /usr/bin echo
+		/usr/bin && -eu -eu /usr/bin -eu x=1 2>/dev/null sed /usr/bin local readonly
+export grep "$@" | sed readonly
+--verbose ${HOME} "$1" test
+	$(pwd) echo sed export | "$1" cd test | ${HOME} --verbose
+$(pwd) export readonly cd cd && 'quoted text' $(pwd) | ${HOME} export --verbose
+grep then echo x=1 export -eu cd
+		printf | | -eu echo export
+'quoted text' then && awk $(pwd) readonly readonly grep x=1 2>/dev/null
+| 2>/dev/null && awk $(pwd) readonly x=1
+"$1" test grep test x=1 'quoted text' echo done done "$1"
+		${HOME} | "$@" -eu sed done --verbose "$@" awk "$@" echo readonly
+local local && printf printf $(pwd) && x=1 grep && echo
+	echo cd /usr/bin sed x=1 then 'quoted text' $(pwd) -eu /usr/bin
+		${HOME} cd x=1 then &&
+		done printf && printf | done local local
+	local 2>/dev/null 'quoted text' export done --verbose
+printf "$@" sed --verbose echo /usr/bin sed $(pwd) then -eu
+	grep $(pwd) x=1 echo export export ${HOME}
+		| $(pwd) cd readonly test done local readonly
+		--verbose sed --verbose
+'quoted text' grep grep echo "$1" awk 'quoted text'
+	grep && done --verbose sed awk local && sed 'quoted text' test printf then &&
+	--verbose --verbose echo
+		/usr/bin /usr/bin x=1 && cd
+		grep printf "$@" 'quoted text'
+		test --verbose test done echo export
+	awk --verbose --verbose export 'quoted text'
+	cd cd echo -eu && x=1 2>/dev/null 'quoted text' awk $(pwd) --verbose --verbose
+	readonly echo sed 'quoted text' $(pwd)
+		"$@" awk export echo x=1 cd echo $(pwd) && | export
+printf -eu $(pwd) export cd cd export printf echo $(pwd) ${HOME} $(pwd)
+		'quoted text' --verbose
+export grep then awk printf export test printf
+	'quoted text' 2>/dev/null ${HOME} grep cd done echo local export grep
+	export export export done echo done done sed && test /usr/bin --verbose
+		x=1 2>/dev/null --verbose | -eu /usr/bin /usr/bin echo export local 'quoted text'
+"$@" && done local cd -eu readonly 'quoted text'
+done --verbose $(pwd) local sed export cd
+		x=1 -eu /usr/bin readonly $(pwd) "$1" test "$1" grep printf test
+		local 2>/dev/null -eu x=1 "$1" sed printf $(pwd) ${HOME}
+	"$1" "$1" --verbose test then "$@" "$1" 2>/dev/null /usr/bin 'quoted text'
+	export /usr/bin export echo readonly printf
+		&& | test "$@" && test /usr/bin test awk ${HOME} then local
+	printf grep local then && $(pwd) test
+		2>/dev/null export /usr/bin /usr/bin 2>/dev/null
+"$@" "$@" readonly -eu then | grep | 'quoted text' /usr/bin readonly
+	sed --verbose then cd x=1 'quoted text' 2>/dev/null | export
+	grep $(pwd) readonly grep cd awk | awk cd "$1" cd 'quoted text' "$1" $(pwd)
+sed then sed cd export 2>/dev/null
+	awk export local done /usr/bin readonly readonly
+echo 2>/dev/null -eu awk awk sed $(pwd) "$1" test grep $(pwd) 'quoted text'
+"$1" test awk sed x=1 echo sed done -eu readonly
+	&& then test | readonly echo |
+		x=1 echo -eu echo awk grep $(pwd) awk cd "$@" 2>/dev/null
+-eu ${HOME} awk echo sed cd
+		x=1 awk export ${HOME} ${HOME} --verbose ${HOME}
+		grep grep /usr/bin test | && test $(pwd) test readonly
+| grep awk --verbose /usr/bin "$1" && cd 'quoted text' awk && -eu -eu 2>/dev/null
+		echo /usr/bin "$@" 'quoted text' then grep ${HOME}
+	2>/dev/null "$@" printf readonly ${HOME} cd --verbose
+	2>/dev/null echo test echo sed -eu "$1" grep local cd /usr/bin grep "$1" $(pwd)
+test then --verbose printf
+	done "$@" x=1 then && test echo done x=1 $(pwd)
+cd test awk sed cd echo export "$1" local printf
+"$1" --verbose then && $(pwd) readonly test then |
+&& 2>/dev/null ${HOME} "$@" && readonly x=1 readonly "$1"
+--verbose ${HOME} ${HOME} ${HOME} /usr/bin "$1" x=1
+		readonly | sed grep then "$1" sed "$1" readonly
+| -eu local done -eu 2>/dev/null export cd export printf
+'quoted text' grep ${HOME} grep | then done then "$@"
+local export --verbose /usr/bin ${HOME} &&
+		| "$1" awk echo ${HOME} awk grep grep grep
+"$1" done /usr/bin grep 'quoted text' ${HOME} cd cd
+	'quoted text' 2>/dev/null cd printf awk export -eu /usr/bin printf
+--verbose x=1 $(pwd) cd && /usr/bin && | $(pwd)
+echo "$1" cd test local && -eu done export printf cd sed --verbose
+then done grep sed awk -eu ${HOME} readonly sed /usr/bin $(pwd) printf export
+readonly grep awk 'quoted text' done local local grep "$1" x=1 -eu awk
+		--verbose ${HOME} 2>/dev/null printf local done
+--verbose echo export grep echo 2>/dev/null 2>/dev/null --verbose --verbose &&
+	export "$@" export ${HOME} && printf
+		echo "$1" 'quoted text' | -eu ${HOME} | then /usr/bin | export test export
+&& readonly -eu done
+		| export local 'quoted text' readonly && printf | x=1 /usr/bin sed "$@" -eu /usr/bin
+2>/dev/null -eu local readonly printf --verbose cd awk x=1 -eu printf
+$(pwd) -eu && cd 2>/dev/null printf "$@" 'quoted text' then
+	awk cd done /usr/bin grep $(pwd) local readonly local $(pwd)
+	"$1" /usr/bin grep "$1" --verbose
+"$@" x=1 x=1 $(pwd) test echo $(pwd)
+/usr/bin 'quoted text' && readonly 'quoted text' awk 2>/dev/null
+	grep test local local $(pwd) "$@" ${HOME} "$@" --verbose readonly
+	grep --verbose cd test && printf done readonly awk grep 2>/dev/null -eu 2>/dev/null
+	cd printf sed then grep test
+x=1 --verbose awk echo export 2>/dev/null
+	done export && sed readonly
+		2>/dev/null printf test "$1" "$1" cd ${HOME} | $(pwd) | --verbose grep /usr/bin
+	"$1" export then | ${HOME} printf test export
+	export -eu ${HOME} echo grep "$1" x=1 cd printf ${HOME} local
+	printf x=1 ${HOME} awk -eu cd $(pwd) local grep awk export
+then 'quoted text' local test 'quoted text' /usr/bin /usr/bin 'quoted text' readonly
+	printf grep && "$@" /usr/bin printf
+		echo done ${HOME} ${HOME} ${HOME} echo sed "$@" cd echo awk "$1" test ${HOME} 'quoted text'
+	echo readonly 'quoted text'
+	echo echo 'quoted text' | sed echo sed printf cd | awk 'quoted text' 'quoted text'
+		"$@" --verbose test | grep
+		"$@" | test cd export awk $(pwd) 2>/dev/null 'quoted text'
+readonly ${HOME} 2>/dev/null 2>/dev/null test /usr/bin cd readonly --verbose
+	local cd local x=1 done grep --verbose sed printf ${HOME} then 2>/dev/null
+	cd $(pwd) readonly x=1 ${HOME} grep 'quoted text' printf x=1
+	awk $(pwd) x=1 echo readonly "$1" 2>/dev/null
+	test && 2>/dev/null cd readonly
+	-eu printf /usr/bin then echo cd && && done ${HOME} export
+	"$@" printf test | echo 2>/dev/null
+--verbose printf "$@" 'quoted text' then
+echo -eu test "$1" sed local "$1" ${HOME}
+		'quoted text' $(pwd) echo 'quoted text' /usr/bin done test local
+${HOME} awk printf 2>/dev/null cd && &&
+		echo readonly awk ${HOME} && /usr/bin grep 'quoted text' --verbose /usr/bin 'quoted text'
+		awk 'quoted text' echo grep ${HOME} "$@" && done -eu
+	$(pwd) local | grep export grep
+	cd 'quoted text' 2>/dev/null
+		echo export 2>/dev/null then grep cd
+		$(pwd) cd test grep then ${HOME} export /usr/bin done
+	--verbose grep --verbose 'quoted text' | /usr/bin $(pwd) then
+		| -eu x=1 cd readonly cd readonly awk grep 2>/dev/null
+readonly readonly export
+		local echo 'quoted text' sed 2>/dev/null export x=1
+-eu grep | done && | "$@" grep "$1" 'quoted text' export then $(pwd) echo $(pwd)
+&& | echo printf export local "$1" export && /usr/bin echo "$@"
+	awk test export awk cd && sed printf export
+		printf /usr/bin awk x=1 sed ${HOME}
+x=1 done printf /usr/bin --verbose
+	-eu export sed $(pwd) printf readonly 'quoted text'
+	-eu 'quoted text' printf "$@" grep | echo && local grep && test awk
+	${HOME} done | done sed grep && grep /usr/bin
+		printf sed then grep test
+	echo awk grep $(pwd) 'quoted text' --verbose --verbose awk cd
+	| cd readonly readonly awk
+		'quoted text' sed "$@" 'quoted text' "$@" cd readonly --verbose
+		2>/dev/null -eu sed 2>/dev/null
+		printf $(pwd) ${HOME} then cd /usr/bin -eu grep export
+test echo grep test sed ${HOME}
+	sed readonly echo readonly --verbose readonly done "$1" then
+	grep /usr/bin 2>/dev/null | && --verbose && x=1 'quoted text' sed --verbose
+"$@" local x=1 && ${HOME} echo readonly printf "$@" done echo
+	export /usr/bin test -eu cd then sed then --verbose --verbose | awk
+	then --verbose sed /usr/bin
+'quoted text' grep 2>/dev/null && test local awk | $(pwd) --verbose
+		readonly 2>/dev/null readonly --verbose awk $(pwd)
+	/usr/bin printf done then $(pwd) grep readonly cd x=1 && export x=1 &&
+	x=1 export echo -eu "$1" "$1" test
+	'quoted text' awk awk grep echo export --verbose /usr/bin sed 'quoted text'
+		grep grep cd printf grep local -eu
+test -eu x=1 && export cd -eu | && cd --verbose grep ${HOME} local printf $(pwd)
+	2>/dev/null && test done /usr/bin /usr/bin cd printf 'quoted text' printf
+done grep awk -eu "$@" && 2>/dev/null test 'quoted text' -eu grep
+	done x=1 test then local -eu then cd ${HOME} 'quoted text' && -eu awk
+	readonly 'quoted text' 'quoted text' printf readonly "$1" "$1"
+	sed cd printf 'quoted text' awk echo x=1 done grep "$@" then x=1
+| 'quoted text' done x=1 then -eu && sed readonly --verbose $(pwd) x=1 "$@"
+/usr/bin readonly then ${HOME} x=1 && /usr/bin $(pwd)
+then test $(pwd) $(pwd) echo readonly
+done | 2>/dev/null test x=1 sed
+test 'quoted text' sed
+		| test done /usr/bin "$@" done done test $(pwd) /usr/bin echo |
+		--verbose | $(pwd) sed local ${HOME} awk --verbose readonly && --verbose
+		"$1" awk sed test x=1 local cd | "$@" then | $(pwd) printf ${HOME} done test done
+		'quoted text' printf export
+test printf local sed grep | 'quoted text' sed test 2>/dev/null
+	'quoted text' "$@" --verbose local /usr/bin | && "$@" /usr/bin
+2>/dev/null ${HOME} test export awk readonly 2>/dev/null then 2>/dev/null
+		/usr/bin ${HOME} -eu local /usr/bin | readonly grep local "$1" sed
+	export x=1 | /usr/bin | && local /usr/bin then --verbose
+local done echo grep x=1 ${HOME} echo done export
+		echo 'quoted text' "$1" "$1" $(pwd) x=1 echo then
+		done ${HOME} printf printf x=1 done /usr/bin
+	awk done grep printf grep
+		--verbose awk echo --verbose
+		-eu export test "$@" grep 'quoted text' done
+printf "$@" awk -eu --verbose -eu
+		then readonly x=1 cd local test sed $(pwd) 'quoted text'
+--verbose $(pwd) | | -eu ${HOME}
+x=1 2>/dev/null && $(pwd) readonly -eu x=1 readonly "$1" -eu --verbose awk "$@"
+	'quoted text' awk -eu "$1" | -eu
+"$1" done printf awk awk 2>/dev/null 'quoted text' printf done
+		printf readonly local ${HOME} 'quoted text' && && ${HOME} done
+		done ${HOME} test --verbose
+'quoted text' -eu cd echo local && readonly
+		2>/dev/null sed "$1" then "$@" then local -eu
+		${HOME} awk printf grep local export done "$@" test local printf readonly
+| printf awk done 'quoted text' -eu && /usr/bin awk test done && && --verbose
+		grep $(pwd) echo && grep 'quoted text' cd done /usr/bin readonly "$@" x=1 test
+	readonly awk | then then awk export echo x=1 done
+	| cd "$1" cd $(pwd) "$1" then 2>/dev/null
+awk then $(pwd) -eu "$@" export
+	"$@" x=1 /usr/bin /usr/bin
+"$1" 'quoted text' grep $(pwd) /usr/bin /usr/bin 'quoted text'
+		awk --verbose readonly && printf readonly --verbose readonly && then test &&
+	done grep "$@" awk readonly | /usr/bin then 2>/dev/null test "$1" cd
+| sed 2>/dev/null printf grep test awk done 'quoted text'
+--verbose printf grep export "$@" local x=1 -eu printf awk $(pwd) test "$1"
+	grep -eu local --verbose awk -eu done --verbose echo sed export "$1" ${HOME} | local
+	2>/dev/null -eu --verbose grep "$@" cd done test
+		2>/dev/null done "$1" "$@" $(pwd) printf
+	printf 2>/dev/null grep && 'quoted text' sed
+		readonly "$@" printf | && && done
+		"$1" | then 'quoted text' ${HOME}
+		export "$@" /usr/bin then echo grep /usr/bin sed --verbose
+		x=1 done done local --verbose printf then printf
+--verbose grep echo $(pwd) done
+		"$@" --verbose /usr/bin export 'quoted text' sed printf then | -eu --verbose
+x=1 ${HOME} local $(pwd) -eu
+		"$1" sed | test test $(pwd) printf
+		x=1 readonly then export then && local printf -eu export
+		-eu export sed then -eu
+		test ${HOME} then cd awk -eu /usr/bin | $(pwd) --verbose && sed test
+	printf test test printf done "$@" awk x=1 && "$@" done "$@" readonly
+2>/dev/null then echo "$1"
+	/usr/bin printf 2>/dev/null 'quoted text' then $(pwd) test local then cd 'quoted text'
+	local ${HOME} sed 'quoted text' x=1 readonly "$1" awk 'quoted text' local sed
+	/usr/bin "$1" printf test x=1 export readonly then readonly ${HOME}
+	then awk 2>/dev/null export ${HOME} then sed local | echo
+	awk "$1" --verbose ${HOME} readonly
+${HOME} grep | cd "$1" cd then export && 'quoted text'
+sed readonly && then $(pwd) "$1" grep printf done "$1" test ${HOME}
+	awk local printf export echo then --verbose echo printf then x=1 2>/dev/null
+"$1" local | cd /usr/bin readonly
+/usr/bin echo then "$1" local
+		then "$@" -eu 2>/dev/null readonly then ${HOME}
+	2>/dev/null local | x=1 grep "$@" grep printf
+		readonly echo /usr/bin done then "$1" awk -eu /usr/bin ${HOME} export
+	export echo -eu cd sed local "$@" 'quoted text' test --verbose cd
+cd local echo printf $(pwd)
+cd done sed "$1" awk sed | -eu && awk $(pwd) export cd awk cd cd
+		"$@" printf 'quoted text' && 2>/dev/null then 'quoted text' &&
+${HOME} awk local done cd --verbose 'quoted text' grep then
+		'quoted text' x=1 "$1" -eu 'quoted text'
+local /usr/bin sed "$1" awk test sed 'quoted text' "$1" echo then 'quoted text'
+&& done | local sed done echo 'quoted text' x=1 && ${HOME}
+	local local 'quoted text' && done
+	x=1 readonly test --verbose
+	&& -eu $(pwd) 2>/dev/null echo "$1" | test -eu local | cd "$1" x=1 cd export
+		'quoted text' ${HOME} sed -eu done export x=1 test --verbose -eu -eu grep
+		export "$1" sed sed test local
+	${HOME} | /usr/bin x=1
+		test done awk test $(pwd) | printf grep x=1 done 2>/dev/null sed 2>/dev/null
+	'quoted text' --verbose && $(pwd) 2>/dev/null sed readonly
+	"$1" echo $(pwd) "$@" | --verbose && ${HOME} grep test sed --verbose | then /usr/bin
+		test readonly echo printf printf
+	"$1" ${HOME} /usr/bin sed "$1"
+	&& readonly cd grep | echo 'quoted text' printf 'quoted text' && x=1 'quoted text'
+	test "$1" test x=1 test printf echo 'quoted text'
+		'quoted text' $(pwd) ${HOME} | 'quoted text' readonly readonly -eu
+		"$1" cd ${HOME} readonly sed /usr/bin grep sed x=1 printf printf /usr/bin
+	sed printf cd "$1" 'quoted text'
+		2>/dev/null cd test "$1" ${HOME} cd readonly
+printf && --verbose "$@"
+	-eu awk 'quoted text' x=1 | done /usr/bin "$1" ${HOME}
+		test "$@" local export grep printf export
+'quoted text' readonly grep
+	done $(pwd) echo 'quoted text' local "$@" readonly
+awk -eu | grep export then --verbose awk printf
+	| export sed 2>/dev/null cd "$1" $(pwd)
+		${HOME} /usr/bin echo $(pwd)
+	sed $(pwd) test --verbose printf | test
+		readonly grep echo local test 2>/dev/null
+	done echo awk && /usr/bin sed --verbose
+| --verbose test cd | local "$@" printf 2>/dev/null
+sed awk test test grep
+	grep grep awk x=1 readonly sed $(pwd) 'quoted text'
+		&& readonly sed export -eu echo printf
+--verbose ${HOME} 'quoted text' echo ${HOME} test grep printf
+		readonly x=1 printf then ${HOME} | "$1" cd grep sed
+	local echo test printf ${HOME} --verbose
+test ${HOME} /usr/bin cd export then
+	"$1" | test ${HOME} export /usr/bin readonly ${HOME} ${HOME}
+		$(pwd) awk x=1 local awk 'quoted text' x=1 awk | | $(pwd) ${HOME}
+		${HOME} && sed "$@" cd readonly readonly done 'quoted text' -eu
+		'quoted text' printf cd -eu grep grep "$@" printf 2>/dev/null then --verbose
+2>/dev/null 'quoted text' 'quoted text' x=1 "$@" && && -eu
+&& --verbose ${HOME} test
+		printf then echo local test awk ${HOME} export then -eu
+		/usr/bin | sed readonly x=1 printf done && done printf |
+2>/dev/null export readonly -eu "$@"
+	${HOME} /usr/bin x=1 | readonly then readonly
+		-eu $(pwd) grep -eu && sed
+		done done grep sed done --verbose ${HOME} sed done cd "$1"
+${HOME} 'quoted text' sed
+	done test echo && --verbose 2>/dev/null x=1 "$@" echo 'quoted text' export 2>/dev/null
+	${HOME} x=1 | test awk $(pwd) done x=1 && 'quoted text'
+	awk sed echo 'quoted text' --verbose | --verbose 'quoted text'
+		readonly --verbose sed "$1" grep --verbose done -eu echo awk
+		&& && then test readonly 2>/dev/null
+	| /usr/bin awk "$1" awk done then "$1" "$1" echo cd /usr/bin done cd
+awk | $(pwd) printf grep && "$@" x=1 /usr/bin
+'quoted text' sed "$@" then && awk 'quoted text' "$1" | &&
+		grep test x=1 cd --verbose 'quoted text' ${HOME} -eu done 2>/dev/null --verbose
+printf /usr/bin /usr/bin ${HOME}
+		local ${HOME} export sed "$1" -eu -eu && test then 'quoted text' awk grep
+"$@" $(pwd) --verbose cd "$@" then test ${HOME}
+	grep awk grep x=1 /usr/bin done $(pwd) grep printf -eu cd export
+	&& cd then printf readonly export $(pwd) x=1 awk | printf local ${HOME}
+		sed 'quoted text' awk && x=1 readonly awk /usr/bin echo "$1"
+| export /usr/bin /usr/bin
+	cd awk $(pwd) export test echo done 2>/dev/null x=1 -eu test grep "$1" then x=1
+2>/dev/null -eu "$@" export printf && echo sed "$@" sed 2>/dev/null awk export
+		'quoted text' x=1 readonly --verbose then --verbose
+local echo grep cd readonly --verbose
+	x=1 $(pwd) "$1" grep export && -eu grep done local awk 'quoted text'
+	export x=1 /usr/bin echo ${HOME} x=1 --verbose /usr/bin /usr/bin
+sed $(pwd) -eu x=1 | printf ${HOME} test x=1 export
+		--verbose then "$@" export "$1" local && cd grep local
+"$@" readonly -eu $(pwd)
+	2>/dev/null 2>/dev/null grep | echo 'quoted text' cd ${HOME} sed sed readonly
+		printf done printf "$1" 2>/dev/null 'quoted text' grep "$@" x=1 'quoted text' /usr/bin
+	x=1 readonly local && test "$@" sed printf
+	then then --verbose ${HOME} test
+		${HOME} "$1" x=1 ${HOME} -eu --verbose
+	"$1" ${HOME} sed awk test ${HOME}
+		awk && grep readonly $(pwd) 'quoted text' ${HOME}
+		sed test ${HOME} sed | grep "$1" && printf grep --verbose "$@" "$@" "$1" && && |
+		-eu then sed && printf --verbose /usr/bin "$1" then | x=1 sed $(pwd) export test
+		$(pwd) -eu grep readonly local
+	--verbose "$1" sed printf awk awk test grep 2>/dev/null sed "$@"
+	'quoted text' ${HOME} ${HOME} $(pwd) then readonly export "$1" 'quoted text'
+		cd test "$1" /usr/bin 'quoted text' then ${HOME} sed ${HOME} /usr/bin --verbose
+'quoted text' /usr/bin test
+'quoted text' /usr/bin /usr/bin x=1 "$@" cd readonly grep 2>/dev/null readonly
+		grep then then local "$@" ${HOME} grep local readonly -eu printf /usr/bin "$@"
+	export "$1" export -eu export --verbose
+x=1 ${HOME} /usr/bin readonly export x=1 awk 2>/dev/null "$@" export 'quoted text'
+		"$@" -eu x=1 awk -eu echo done 2>/dev/null "$1" awk "$@" | printf ${HOME} "$@"
+"$1" | awk awk -eu grep
+		/usr/bin echo test "$1" 2>/dev/null
+	"$1" "$1" ${HOME} /usr/bin 'quoted text' then && -eu export && export
+	| awk local done local done ${HOME} "$1" --verbose awk | x=1
+-eu readonly "$1" echo /usr/bin
+test sed -eu "$1" ${HOME} done cd printf
+	awk printf 'quoted text' | x=1
+/usr/bin done && $(pwd) readonly ${HOME}
+	/usr/bin printf cd sed export ${HOME} "$@" 'quoted text' $(pwd)
+	cd ${HOME} test "$@" "$@" awk ${HOME} export echo "$1" then
+		"$1" local $(pwd) --verbose /usr/bin /usr/bin ${HOME} sed "$1"
+		readonly /usr/bin grep | cd ${HOME} then grep "$@" awk --verbose | | cd test
+test 2>/dev/null local 'quoted text' test export /usr/bin then
+	"$1" local local test "$@" echo printf awk
+	$(pwd) | export export sed --verbose | echo ${HOME} /usr/bin then "$1"
+		$(pwd) -eu sed grep test echo local "$1" cd readonly
+grep --verbose ${HOME} 'quoted text' test grep export 'quoted text' x=1 echo test
+	printf && ${HOME} sed x=1 ${HOME} --verbose "$1" 2>/dev/null
+${HOME} done $(pwd) x=1 printf | 2>/dev/null -eu readonly awk
+	then 2>/dev/null printf | sed printf
+	${HOME} readonly printf ${HOME} $(pwd) local $(pwd) ${HOME} awk | "$@" local
+	--verbose x=1 -eu | -eu export 2>/dev/null printf
+	done test then | sed /usr/bin
+	2>/dev/null awk local "$@" /usr/bin
+"$@" sed printf /usr/bin printf awk local --verbose 2>/dev/null echo
+	readonly grep 2>/dev/null then local x=1 echo ${HOME}
+		grep test awk 'quoted text' cd local done /usr/bin export export "$@"
+	grep && 'quoted text' grep done -eu 'quoted text' test
+grep grep && 'quoted text' then
+	2>/dev/null local export echo $(pwd) -eu sed ${HOME} then local
+| 2>/dev/null -eu ${HOME} x=1 test "$@" ${HOME} printf done "$@"
+"$@" x=1 "$@" "$1" awk local sed printf then awk
+		awk local "$1" test && cd awk --verbose "$1" awk &&
+	test $(pwd) -eu cd 'quoted text' /usr/bin echo | "$@" /usr/bin
+		/usr/bin x=1 cd && "$1"
+echo then printf x=1
+		"$@" cd 2>/dev/null ${HOME} && 2>/dev/null && export
+		export local export sed 2>/dev/null -eu "$1" export test ${HOME} 2>/dev/null
+		${HOME} test "$1" done $(pwd) done done sed then
+--verbose readonly grep export then
+		grep /usr/bin local --verbose 'quoted text' printf /usr/bin "$1"
+	grep local local $(pwd) 'quoted text' test ${HOME} sed x=1 export sed --verbose
+x=1 printf | ${HOME} "$1" 2>/dev/null export printf /usr/bin local --verbose
+done done grep && grep
+		-eu echo /usr/bin ${HOME} /usr/bin
+/usr/bin local local cd done grep then sed awk echo -eu ${HOME}
+sed "$1" -eu awk done export
+	x=1 printf done grep readonly && grep -eu --verbose
+		done readonly printf && $(pwd) x=1 local echo then /usr/bin
+	$(pwd) | "$1" then printf local readonly sed done readonly echo
+	'quoted text' printf -eu grep
+		/usr/bin /usr/bin printf "$@" test ${HOME} 'quoted text'
+sed printf sed echo ${HOME} echo sed printf readonly echo then ${HOME} && test x=1
+		test | 'quoted text' --verbose done then test 'quoted text' cd awk cd printf ${HOME}
+		x=1 export sed x=1 export grep /usr/bin $(pwd) done local && done "$@" done
+	-eu local sed | cd local cd && echo 'quoted text' x=1 $(pwd) /usr/bin
+"$1" /usr/bin grep ${HOME} printf x=1 | echo --verbose local cd readonly then "$1"
+	done readonly printf x=1 'quoted text' export 'quoted text' --verbose
+	--verbose awk printf sed "$@" sed "$@" /usr/bin
+	printf export export done test -eu $(pwd) $(pwd) | done
+		awk cd then $(pwd) | done /usr/bin local 'quoted text' x=1
+		$(pwd) "$@" awk cd local sed sed sed sed && && printf /usr/bin
+	export export --verbose test sed ${HOME}
+	done "$1" grep && $(pwd) ${HOME}
+	-eu printf -eu local /usr/bin cd grep awk then ${HOME} 2>/dev/null x=1 grep -eu
+	x=1 readonly readonly then local -eu 'quoted text'
+		readonly | -eu sed done /usr/bin
+	then -eu ${HOME} --verbose sed done --verbose
+	test echo export test cd sed sed export echo done local export
+		--verbose echo ${HOME} /usr/bin local echo ${HOME} test && -eu 'quoted text'
+	'quoted text' $(pwd) grep
+		then ${HOME} 2>/dev/null --verbose local awk done x=1 $(pwd) ${HOME} &&
+		grep 'quoted text' sed awk awk /usr/bin
+--verbose "$@" /usr/bin $(pwd)
+		${HOME} export sed | sed export
+	export readonly test sed --verbose --verbose test awk x=1 readonly
+		/usr/bin /usr/bin readonly readonly | then "$1" grep cd
+	| 'quoted text' -eu x=1 x=1 awk readonly && -eu done "$@" && readonly -eu | export
+	${HOME} | done $(pwd) then ${HOME} cd then test /usr/bin --verbose $(pwd)
+	sed 'quoted text' grep sed
+cd awk readonly "$1" readonly 'quoted text' export echo
+awk printf cd export test test 'quoted text' --verbose grep /usr/bin cd
+export ${HOME} $(pwd) ${HOME} grep -eu export export
+	--verbose | && --verbose sed done --verbose
+		/usr/bin export readonly /usr/bin done 2>/dev/null awk awk --verbose
+grep local 'quoted text' x=1 export echo
+		awk | export export -eu x=1 done awk 'quoted text' export
+	| export printf 2>/dev/null cd echo
+		grep awk "$1" cd x=1 'quoted text' awk echo /usr/bin /usr/bin test export
+	grep cd printf then grep export $(pwd) grep printf
+"$@" ${HOME} export cd sed -eu
+		test local | sed -eu sed
+	-eu "$@" 'quoted text' "$1" x=1 --verbose sed test 2>/dev/null | echo
+		cd --verbose ${HOME} /usr/bin local printf done local
+		"$1" ${HOME} ${HOME} | local local
+x=1 "$1" done /usr/bin | done export export printf local "$@" done export
+	done ${HOME} awk --verbose test | /usr/bin
+		grep awk "$1" 2>/dev/null
+		done | "$1" export printf $(pwd) awk awk 'quoted text' sed grep local
+	done awk echo test /usr/bin cd 2>/dev/null test ${HOME} cd local
+/usr/bin /usr/bin echo && && "$@" then x=1 sed cd
+	grep /usr/bin test -eu /usr/bin && awk
+cd export && export | "$1" "$1" ${HOME} x=1 "$@" export ${HOME}
+		cd test --verbose echo ${HOME} | x=1 -eu sed
+	| "$1" sed 2>/dev/null 2>/dev/null awk "$@"
+${HOME} readonly awk "$@" | "$@" -eu 2>/dev/null 'quoted text' printf
+	cd | grep export 'quoted text' awk
+		printf 2>/dev/null $(pwd) test printf cd | /usr/bin
+${HOME} "$1" export local $(pwd) ${HOME} "$@"
+		awk printf | sed | --verbose $(pwd) awk sed
+		cd -eu $(pwd) 2>/dev/null printf && export "$@" "$@" "$@"
+2>/dev/null --verbose
+readonly | done --verbose sed
+cd printf 2>/dev/null test done | ${HOME} /usr/bin test --verbose
+		x=1 $(pwd) printf "$@" 2>/dev/null -eu cd
+'quoted text' then x=1 && readonly export x=1
+export test --verbose "$@" -eu 'quoted text'
+	--verbose x=1 printf echo local then test --verbose $(pwd) --verbose
+		&& $(pwd) grep printf sed
+		--verbose local awk done 'quoted text' printf done awk done
+		/usr/bin "$1" /usr/bin /usr/bin 'quoted text'
+	awk test grep grep cd x=1 -eu done sed /usr/bin
+		x=1 x=1 "$@" -eu 2>/dev/null
+		--verbose $(pwd) 'quoted text' "$@" --verbose cd then && --verbose
+	x=1 -eu done ${HOME} --verbose ${HOME} ${HOME} /usr/bin
+		&& ${HOME} done test export local | && export cd x=1 grep
+	echo | -eu then test --verbose $(pwd) cd cd "$1" test "$@" 'quoted text'
+		export printf echo 'quoted text' "$@" --verbose
+		awk grep x=1 'quoted text'
+		| cd 'quoted text' 2>/dev/null printf readonly readonly ${HOME} "$1" | -eu
+	awk export "$@" $(pwd) && cd ${HOME} export local cd done cd then local
+	local 'quoted text' $(pwd) x=1 test "$@"
+	test cd --verbose cd grep test "$1" awk "$@" readonly
+	done done readonly done -eu grep readonly 2>/dev/null && 2>/dev/null
+		test local "$1" local "$1" 'quoted text' sed
+cd done "$1" "$@" x=1
+		2>/dev/null local 2>/dev/null /usr/bin sed export 'quoted text'
+		then export test ${HOME} export
+		| /usr/bin 'quoted text' x=1 then "$1" sed
+	test --verbose "$@" $(pwd) export
+		sed x=1 "$@" -eu grep "$@" readonly test export --verbose /usr/bin -eu printf
+	grep ${HOME} test then ${HOME} grep --verbose done printf
+'quoted text' awk cd "$1" done local -eu ${HOME} sed /usr/bin cd awk $(pwd) cd
+		export "$@" test | awk "$1" export test --verbose then echo 'quoted text' echo
+		x=1 then | /usr/bin sed echo 'quoted text'
+		2>/dev/null /usr/bin echo grep cd "$1" sed 'quoted text'
+	"$1" done done 2>/dev/null $(pwd) 'quoted text'
+local cd test ${HOME} $(pwd) sed ${HOME} sed printf awk
+	local echo then awk done grep ${HOME} cd --verbose then printf ${HOME} cd
+	then 2>/dev/null test && 2>/dev/null "$@" "$1" readonly then $(pwd) /usr/bin local
+	/usr/bin "$@" 2>/dev/null sed /usr/bin readonly
+		awk "$1" export -eu done done -eu sed -eu -eu echo ${HOME}
+	2>/dev/null printf then export export readonly export 'quoted text' sed | -eu
+local "$@" "$1" test "$1" test grep ${HOME}
+cd echo -eu -eu export && grep -eu cd 2>/dev/null "$1" awk 2>/dev/null
+cd && --verbose grep -eu
+	awk --verbose | cd x=1 -eu
+then 'quoted text' then --verbose readonly /usr/bin awk readonly $(pwd)
+${HOME} test done | printf done local 'quoted text'
+		cd ${HOME} echo | echo
+printf printf awk "$1" echo | 2>/dev/null --verbose printf
+		echo printf test x=1 2>/dev/null "$1" done --verbose echo 'quoted text' -eu local
+	done local awk 2>/dev/null test "$1" printf local grep
+	"$1" 2>/dev/null 'quoted text' && echo "$@" | local
+"$@" export test grep $(pwd) grep --verbose awk test "$@" export
+	awk printf $(pwd) /usr/bin cd sed --verbose
+grep 'quoted text' "$1" "$1" 2>/dev/null test x=1 export
+		"$@" 2>/dev/null && /usr/bin awk awk grep printf
+	x=1 2>/dev/null "$@" export
+${HOME} 'quoted text' "$1" "$1" 2>/dev/null sed echo export 'quoted text'
+cd "$@" "$1" x=1 "$@" sed echo | awk test 'quoted text' grep readonly
+	| /usr/bin sed awk "$@" awk test 'quoted text' ${HOME} "$@" done
+		printf 2>/dev/null then cd local "$@" && local x=1 local
+		2>/dev/null | grep sed && "$1" done readonly grep && /usr/bin grep sed then
+2>/dev/null printf grep
+	&& $(pwd) x=1 done echo echo $(pwd)
+	$(pwd) "$@" awk /usr/bin then grep /usr/bin export grep -eu "$@" ${HOME}
+		/usr/bin 'quoted text' readonly awk "$1" sed awk cd 2>/dev/null
+	export printf test cd echo cd then test && done test grep && done
+		export --verbose printf printf 'quoted text' cd x=1 printf "$1" done test
+--verbose && -eu echo local
+		then printf /usr/bin "$@" /usr/bin test --verbose
+awk 2>/dev/null then printf done "$@" -eu sed "$1" && $(pwd) echo "$1" $(pwd)
+		"$1" then export grep cd
+	--verbose printf done | echo | cd local cd
+	test "$1" 'quoted text' /usr/bin --verbose $(pwd)
+		export awk x=1 done printf && --verbose export -eu ${HOME} $(pwd) printf
+		"$1" sed test then test -eu
+local -eu ${HOME} | ${HOME}
+		local cd $(pwd) cd done test readonly sed export -eu done readonly cd ${HOME}
+		"$1" done /usr/bin /usr/bin sed
+printf 'quoted text' "$@" cd ${HOME} "$@" echo "$1" cd
+		local cd done ${HOME} local ${HOME} | sed "$1"
+grep local then grep -eu "$@" "$@" x=1 | test
+	export | -eu awk x=1 printf 2>/dev/null grep printf grep /usr/bin export done
+		| x=1 --verbose -eu /usr/bin awk /usr/bin && -eu
+		2>/dev/null echo 'quoted text' $(pwd) then readonly local done
+"$1" x=1 echo echo $(pwd) --verbose then echo "$@" -eu test /usr/bin "$1"
+		grep sed done grep awk $(pwd) /usr/bin "$@" --verbose /usr/bin
+export sed awk 'quoted text' cd test sed "$@"
+		-eu 2>/dev/null cd --verbose export x=1 then done cd 'quoted text'
+echo awk ${HOME} echo readonly
+done && echo then && grep done $(pwd) cd echo awk
+		"$1" -eu -eu export && 2>/dev/null 2>/dev/null then
+	cd awk /usr/bin done "$1" --verbose awk x=1 $(pwd) -eu grep printf
+		cd readonly 'quoted text' 'quoted text' done
+		'quoted text' then $(pwd) ${HOME}
+	'quoted text' | test | ${HOME} local done awk 'quoted text' x=1 2>/dev/null
+then 'quoted text' then | "$1" done "$@" done "$@" --verbose
+test $(pwd) export sed
+	'quoted text' done $(pwd) sed test awk $(pwd) echo test
+	export then -eu && done cd awk -eu "$@" "$@" done 2>/dev/null test
+		x=1 'quoted text' export
+		readonly | --verbose -eu awk local
+"$@" | awk done readonly readonly test | --verbose $(pwd)
+		&& 2>/dev/null then export readonly "$1" && 2>/dev/null printf
+		test grep "$@" && --verbose 2>/dev/null awk echo /usr/bin
+	2>/dev/null grep sed "$1" x=1 echo 2>/dev/null echo | local test awk ${HOME}
+		then readonly done "$@" $(pwd) x=1 | sed grep 2>/dev/null
+	"$@" -eu printf echo sed "$1" cd echo echo | && /usr/bin sed 'quoted text'
+	sed readonly $(pwd) && echo done then 2>/dev/null
+	-eu /usr/bin | echo test local && "$@" readonly then "$@" sed local 'quoted text'
+		"$1" -eu export "$@" echo 2>/dev/null cd cd | done printf 'quoted text'
+		cd awk sed local done -eu $(pwd) --verbose
+x=1 | | 2>/dev/null sed "$1" export
+local 2>/dev/null export x=1 2>/dev/null --verbose printf sed
+	2>/dev/null 'quoted text' done
+		--verbose $(pwd) x=1 ${HOME} cd --verbose $(pwd) export
+	-eu | -eu readonly done | && done ${HOME} /usr/bin readonly --verbose awk
+--verbose echo readonly readonly local printf then
+		${HOME} sed done local 'quoted text' ${HOME} "$@" 2>/dev/null "$1" sed local
+		readonly export && /usr/bin readonly ${HOME} 'quoted text'
+	grep 2>/dev/null printf printf readonly
+sed ${HOME} local export
+		--verbose x=1 readonly -eu sed --verbose && cd cd export
+	$(pwd) --verbose done local -eu done ${HOME} | ${HOME} 2>/dev/null ${HOME} | &&
+		printf $(pwd) "$1" "$1" test sed local test -eu readonly grep cd export
+	readonly readonly --verbose 2>/dev/null
+echo readonly export grep sed && sed ${HOME} $(pwd) ${HOME} && 2>/dev/null
+then test awk && printf /usr/bin 2>/dev/null x=1 "$1" export local "$1" ${HOME}
+export awk then x=1 then "$1" readonly test test
+		echo awk awk 2>/dev/null --verbose 'quoted text' x=1 | grep --verbose echo
+		'quoted text' ${HOME} local echo && export "$@" "$@" ${HOME} -eu -eu
+		then -eu 'quoted text' --verbose test awk sed printf awk
+echo -eu cd cd local readonly done echo readonly
+		printf "$1" echo 2>/dev/null
+/usr/bin /usr/bin $(pwd) 2>/dev/null && done cd
+	done $(pwd) grep cd echo readonly
+		awk awk "$1" x=1 -eu awk -eu $(pwd) awk
+$(pwd) "$1" sed done then echo /usr/bin
+		test --verbose grep && "$1" 2>/dev/null readonly -eu /usr/bin
+	printf then done sed ${HOME} test && grep
+	${HOME} printf $(pwd) ${HOME} grep x=1 "$1" "$@" cd export readonly
+	-eu "$@" | sed x=1 local $(pwd) ${HOME} --verbose sed && awk ${HOME}
+	export grep echo grep --verbose x=1 then then ${HOME} -eu | local
+	"$1" grep then 2>/dev/null test "$1" then $(pwd)
+	then $(pwd) | export
+	export "$1" "$@" sed cd local cd
+	echo test echo -eu -eu | $(pwd) grep x=1 local ${HOME} 'quoted text'
+		'quoted text' printf 'quoted text'
+		"$@" x=1 done && -eu then -eu readonly sed sed $(pwd)
+	echo 'quoted text' | "$@"
+		--verbose local local grep cd cd && "$1" readonly "$1" sed then
+x=1 --verbose 2>/dev/null && cd | 2>/dev/null
+	'quoted text' readonly test export readonly then then cd
+	--verbose "$@" "$1" "$1" "$1" 'quoted text' | printf -eu ${HOME} then /usr/bin 2>/dev/null
+		"$1" export grep echo export "$@" local then cd done awk grep ${HOME}
+	sed printf done printf "$1" test ${HOME}
+	echo "$1" grep "$@" test 'quoted text' --verbose x=1 awk -eu grep /usr/bin done
+${HOME} /usr/bin readonly | local printf /usr/bin grep x=1 then
+then printf && cd 2>/dev/null $(pwd)
+		--verbose sed && sed /usr/bin && echo sed readonly "$@"
+	cd -eu | local /usr/bin awk readonly cd
+	then printf "$1" -eu "$1" then
+	echo sed && "$@" ${HOME}
+	readonly -eu done readonly 2>/dev/null | "$1" test then sed 2>/dev/null /usr/bin
+	grep done 'quoted text' readonly readonly then done test local
+local cd awk printf sed awk 2>/dev/null "$1" echo "$1" && /usr/bin 'quoted text'
+	"$@" readonly awk && cd sed 'quoted text' "$@" 'quoted text' grep
+	cd ${HOME} export "$1" $(pwd) done grep cd "$1" then ${HOME} "$@" export
+	echo done local 2>/dev/null
+		sed test /usr/bin echo 'quoted text' grep && export | 'quoted text' -eu
+	"$@" printf --verbose 'quoted text' echo 'quoted text' "$@" sed cd grep export
+	'quoted text' echo awk awk "$1"
+		test local x=1 local then local awk
+		sed && local x=1 local 'quoted text'
+	'quoted text' then "$1" 'quoted text'
+		"$1" | test awk then local echo "$1" | cd test
+		local ${HOME} x=1 done grep then --verbose echo awk ${HOME} -eu
+		-eu test x=1 $(pwd) "$@" printf /usr/bin -eu x=1 "$@" -eu --verbose
+		sed 'quoted text' -eu
+		test grep sed -eu x=1 2>/dev/null "$1" /usr/bin awk /usr/bin local | then awk
+		2>/dev/null echo cd done $(pwd) cd sed $(pwd) x=1 printf sed "$@" printf sed
+	| grep "$1" | ${HOME} awk "$1" cd sed x=1
+		cd sed sed test -eu 'quoted text' -eu --verbose $(pwd) "$1" ${HOME}
+		--verbose local 'quoted text'
+	-eu printf cd ${HOME} done grep "$1" cd | grep awk -eu | "$1" done export
+#include c206.sh
+	2>/dev/null "$@" local sed "$@"
+printf local echo echo readonly $(pwd) sed 'quoted text' | -eu && test
+"$1" echo -eu done cd export 2>/dev/null x=1 cd cd echo ${HOME} cd | then awk
+		cd /usr/bin cd | 'quoted text' | local cd test readonly test 'quoted text'
+	&& x=1 done x=1 'quoted text' /usr/bin printf $(pwd) $(pwd) printf cd $(pwd)
+2>/dev/null local readonly local 2>/dev/null
+	x=1 | 'quoted text' /usr/bin "$@" && grep -eu && test
+	${HOME} export grep "$1" sed then grep readonly local x=1 &&
+done "$1" test awk test 'quoted text' 2>/dev/null cd && && printf
+	awk sed x=1 export echo test sed | then | 2>/dev/null local
+	2>/dev/null awk x=1 "$@"
+local awk grep --verbose cd && then awk readonly 'quoted text'
+export readonly sed 'quoted text' --verbose sed
+printf && && ${HOME} 2>/dev/null export
+| && -eu local grep local "$1" 2>/dev/null x=1 'quoted text' done local 2>/dev/null
+readonly -eu cd then test export sed -eu "$@" x=1 local && awk /usr/bin printf
+	--verbose ${HOME} --verbose $(pwd) printf 'quoted text' --verbose
+	"$1" echo 'quoted text' $(pwd)
+		grep 2>/dev/null echo "$1" 2>/dev/null
+2>/dev/null cd export $(pwd) printf
+		${HOME} grep then sed local export export
+cd then $(pwd) echo readonly --verbose
+	export then 'quoted text'
+	then sed /usr/bin readonly done awk --verbose && cd | 'quoted text'
+echo export then 'quoted text' export -eu export --verbose
+		$(pwd) -eu local x=1 "$1" "$@" done test
+		local cd ${HOME} local "$@" printf grep cd /usr/bin 'quoted text' grep ${HOME}
+	export sed printf echo ${HOME} x=1 cd |
+	$(pwd) 2>/dev/null && export cd local
+	--verbose then local x=1 x=1 local 'quoted text' export && grep local
+2>/dev/null done readonly readonly 'quoted text'
+	$(pwd) grep echo readonly done then | | "$1" export ${HOME} echo test readonly
+		"$@" x=1 && "$1" cd --verbose then
+		${HOME} "$@" $(pwd) | "$1" printf "$@" | | done | | 'quoted text' printf awk 'quoted text'
+		sed echo ${HOME} cd 'quoted text'
+--verbose "$@" 2>/dev/null "$1" local
+/usr/bin /usr/bin --verbose then awk 'quoted text'
+--verbose ${HOME} then cd 'quoted text' local $(pwd) printf sed sed echo
+		${HOME} export sed -eu /usr/bin grep
+		local "$@" cd --verbose sed -eu echo "$@" readonly --verbose export echo sed readonly
+sed --verbose --verbose | 2>/dev/null
+	sed cd awk 2>/dev/null --verbose echo done cd && local local export
+		'quoted text' awk -eu /usr/bin local x=1 && done printf
+export && sed grep /usr/bin sed /usr/bin /usr/bin "$@" "$1" test 2>/dev/null
+	then grep printf then
+test export $(pwd) /usr/bin /usr/bin local echo "$1" "$@" printf test printf sed
+	readonly "$1" echo x=1 x=1 ${HOME} "$@" | $(pwd) 'quoted text' 2>/dev/null
+	| 'quoted text' grep ${HOME} export readonly x=1 'quoted text' /usr/bin done $(pwd)
+	readonly readonly /usr/bin -eu export cd | "$1" "$@" test 'quoted text'
+cd && -eu $(pwd) $(pwd) 2>/dev/null echo | then | /usr/bin x=1 done grep ${HOME}
+	cd "$1" sed printf test "$@" done test awk "$1" /usr/bin -eu
+x=1 x=1 /usr/bin readonly "$@" printf awk
+		cd "$1" export readonly "$1" grep x=1 grep sed ${HOME} -eu awk printf
+		2>/dev/null 2>/dev/null x=1 grep readonly cd
+	"$@" 2>/dev/null test cd |
+	x=1 ${HOME} | done ${HOME} $(pwd) readonly /usr/bin -eu x=1 export $(pwd)
+		done ${HOME} "$1" /usr/bin ${HOME} printf sed |
+printf x=1 grep done | sed && echo $(pwd)
+	echo "$1" grep "$1" | cd
+${HOME} printf && "$1" | "$@" x=1 done export
+		sed "$@" "$@" awk /usr/bin 'quoted text' sed echo export 'quoted text'
+	x=1 echo x=1 2>/dev/null test $(pwd) local
+x=1 /usr/bin sed ${HOME} ${HOME} sed cd ${HOME} printf awk
+		sed -eu sed x=1 grep sed echo sed done then awk ${HOME} -eu
+		done -eu local ${HOME} x=1 awk
+		sed export readonly | x=1 awk printf cd sed --verbose ${HOME} cd
+		"$@" "$1" 2>/dev/null | ${HOME} 2>/dev/null awk done printf $(pwd)
+	'quoted text' grep echo 2>/dev/null
+	done local "$@" cd grep --verbose done
+	x=1 local | local | "$@" grep 'quoted text' | local awk then ${HOME}
+then && then x=1 cd | local cd echo 2>/dev/null
+	$(pwd) awk "$1" /usr/bin grep local awk --verbose awk sed printf x=1 sed
+"$1" readonly --verbose sed /usr/bin -eu export grep
+		echo $(pwd) export echo grep ${HOME} --verbose cd --verbose && echo cd local
+		"$@" done $(pwd) export test export -eu -eu sed printf
+	test done cd export x=1 && then done 2>/dev/null local /usr/bin
+sed test cd local 2>/dev/null "$@" done -eu grep $(pwd) echo printf
+	printf export readonly done ${HOME} cd --verbose
+'quoted text' 'quoted text' test 'quoted text'
+sed sed then --verbose $(pwd) --verbose awk echo x=1 echo readonly awk 2>/dev/null
+	grep && printf $(pwd) x=1
+		test -eu x=1 echo printf sed test local "$@" test local sed ${HOME}
+		grep -eu then export x=1 done "$1" 2>/dev/null echo |
+		| 2>/dev/null cd $(pwd) "$@" $(pwd) && $(pwd) x=1 2>/dev/null x=1
+		x=1 | local /usr/bin echo "$1" x=1 | awk /usr/bin --verbose
+	grep sed "$@" grep done
+readonly grep "$@" -eu echo readonly ${HOME} ${HOME} ${HOME} ${HOME} printf
+	printf | readonly done $(pwd) "$@"
+	"$1" "$@" --verbose | echo && /usr/bin printf 'quoted text' awk
+	'quoted text' local test 2>/dev/null && cd "$1" export test --verbose
+	-eu sed 2>/dev/null --verbose x=1 echo | export printf
+		2>/dev/null x=1 printf /usr/bin
+	${HOME} readonly local "$1" test x=1 echo
+$(pwd) /usr/bin then sed "$1" ${HOME} $(pwd) "$1" 2>/dev/null
+readonly awk /usr/bin echo /usr/bin && | 'quoted text' -eu done "$@"
+-eu 'quoted text' printf ${HOME} 2>/dev/null "$@" --verbose grep cd done
+	"$@" printf x=1 awk echo awk --verbose then --verbose 'quoted text' ${HOME} export
+2>/dev/null 'quoted text' | cd
+	"$1" done export | sed 2>/dev/null --verbose export echo 'quoted text' | --verbose
+sed grep grep echo cd ${HOME}
+local "$@" ${HOME} local | printf printf printf
+		"$@" "$1" readonly $(pwd) ${HOME} cd $(pwd) then local 'quoted text'
+2>/dev/null /usr/bin cd /usr/bin 2>/dev/null
+	-eu done readonly x=1 $(pwd) "$@" "$1"
+		printf "$@" sed then sed
+		${HOME} grep test printf
+	'quoted text' printf cd cd 'quoted text' $(pwd) awk "$@" done readonly then awk
+	| awk 2>/dev/null readonly local 2>/dev/null ${HOME} 'quoted text'
+sed 'quoted text' && done
+	grep cd grep && export local cd readonly test --verbose "$@" "$@" /usr/bin
+export ${HOME} -eu export awk 'quoted text' then | awk printf "$1" "$@"
+-eu echo then printf x=1 | | echo awk then | 'quoted text'
+		/usr/bin done then && then test
+	x=1 && then 'quoted text'
+	"$@" 2>/dev/null "$1" "$@" -eu echo $(pwd) test -eu 'quoted text'
+		"$@" test grep awk test grep
+done done /usr/bin && export &&
+'quoted text' then export "$@" printf ${HOME} "$1" local x=1
+	/usr/bin echo && "$1" printf 'quoted text'
+		/usr/bin ${HOME} readonly
+		/usr/bin sed cd "$@" "$1" ${HOME} x=1 -eu 2>/dev/null
+export | echo then -eu "$@" && done | test 2>/dev/null --verbose &&
+then export printf ${HOME} then echo test x=1 done 2>/dev/null
+	done 2>/dev/null done x=1
+		/usr/bin then readonly && echo
+	cd local readonly -eu printf
+		x=1 sed echo grep then --verbose
+		| "$1" --verbose && "$@" /usr/bin
+	local x=1 $(pwd) --verbose done 'quoted text' --verbose
+	"$1" && local sed then ${HOME} --verbose -eu
+	x=1 echo --verbose x=1 echo "$@" $(pwd) printf
+"$@" awk local && $(pwd) sed "$1" printf cd readonly printf
+sed ${HOME} printf /usr/bin "$1" test 'quoted text' 2>/dev/null | --verbose
+	grep readonly local 2>/dev/null ${HOME} x=1 --verbose awk x=1
+		--verbose "$1" 'quoted text'
+		local readonly export | awk "$1"
+		then $(pwd) awk && 'quoted text' "$1" awk cd "$@" 'quoted text' -eu export grep
+	'quoted text' local "$1" printf awk | --verbose /usr/bin | | /usr/bin test
+	2>/dev/null done --verbose grep printf
+${HOME} readonly printf && "$@" export /usr/bin printf --verbose
+x=1 | x=1 ${HOME} 'quoted text'
+		readonly -eu awk /usr/bin awk printf sed
+	done printf cd then x=1 --verbose ${HOME} printf "$@" "$1" $(pwd) -eu "$1"
+printf --verbose "$1" test local echo "$@" printf
+	&& grep done -eu ${HOME} 2>/dev/null ${HOME} then --verbose
+	export -eu sed echo readonly readonly -eu echo then
+done awk printf x=1 readonly readonly && then cd test awk awk "$@" awk 2>/dev/null
+	"$@" local 'quoted text' echo awk
+--verbose local ${HOME} grep && --verbose export 2>/dev/null | $(pwd) x=1 then
+	'quoted text' then local 'quoted text' awk /usr/bin | ${HOME}
+		sed "$@" -eu x=1 sed x=1
+	cd 'quoted text' echo test "$@" "$@" && cd ${HOME} --verbose
+"$@" cd printf | --verbose $(pwd) --verbose "$1" 'quoted text' export done
+	echo test && export x=1 "$1" grep 'quoted text' x=1 cd awk export printf 'quoted text'
+	then cd "$1" 'quoted text' local local readonly /usr/bin
+		${HOME} "$1" | grep "$@" local
+"$@" && sed $(pwd) sed then 2>/dev/null awk $(pwd) /usr/bin --verbose
+	$(pwd) printf x=1 grep awk grep awk then awk 2>/dev/null awk sed
+		-eu local x=1 local 2>/dev/null ${HOME} /usr/bin 2>/dev/null "$@" | export
+		--verbose readonly printf awk -eu test && ${HOME} $(pwd)
+$(pwd) x=1 "$@" $(pwd) && 2>/dev/null echo --verbose
+		"$1" && /usr/bin done | local "$@" sed
+	done 'quoted text' $(pwd)
+		2>/dev/null echo "$@" awk test 'quoted text' done x=1 local then
+done --verbose then -eu done --verbose $(pwd) awk 2>/dev/null
+	local printf "$1" -eu $(pwd) x=1 --verbose $(pwd) --verbose
+		then done x=1 done --verbose awk local done cd $(pwd) printf "$@" "$1" "$@"
+		"$@" "$@" -eu done readonly printf export -eu && 'quoted text' cd
+		export export local grep sed
+		/usr/bin test "$1" -eu -eu | ${HOME}
+	awk awk $(pwd) then ${HOME} done done /usr/bin 2>/dev/null done | test
+		"$@" -eu "$@" grep done cd export /usr/bin --verbose export cd
+		done $(pwd) then printf export
+	grep readonly export printf x=1 printf && "$1" awk
+	${HOME} cd grep done export 2>/dev/null echo x=1
+-eu readonly x=1 x=1 local && sed grep local sed test grep readonly
+	| | local cd awk /usr/bin ${HOME} local test && local test grep -eu 'quoted text'
+	sed local export test x=1 cd x=1 readonly 'quoted text' | -eu done -eu --verbose
+printf ${HOME} awk test printf done 'quoted text'
+	/usr/bin echo local && grep readonly /usr/bin --verbose
+	/usr/bin test sed 'quoted text' then
+	--verbose --verbose 'quoted text'
+		done 'quoted text' awk then /usr/bin -eu -eu printf -eu -eu 2>/dev/null echo
+		sed "$1" | grep printf done then readonly cd local grep "$@" $(pwd) export
+	cd | ${HOME} done 'quoted text' printf "$1" /usr/bin test /usr/bin local awk &&
+printf done "$1" -eu ${HOME} sed && "$1" "$@" 2>/dev/null
+	echo 'quoted text' cd test /usr/bin x=1 readonly 2>/dev/null export then echo readonly
+	test && sed -eu /usr/bin "$1" grep --verbose
+cd grep $(pwd) x=1 "$1" cd ${HOME}
+	2>/dev/null echo | echo awk then x=1 readonly "$@" cd printf 'quoted text'
+	local x=1 'quoted text' then export ${HOME}
+/usr/bin echo /usr/bin echo then test --verbose
+x=1 x=1 /usr/bin x=1 cd readonly
+sed echo local sed | done "$1" -eu
+		x=1 test local && "$@" "$1" export done test $(pwd) $(pwd) done then
+		readonly cd test readonly awk grep awk then export -eu
+		&& "$@" then "$@" export 2>/dev/null 2>/dev/null local ${HOME}
+		x=1 x=1 export $(pwd) --verbose cd x=1 done done | "$1" && awk /usr/bin
+done export local export echo 2>/dev/null
+2>/dev/null awk x=1 2>/dev/null ${HOME}
+printf export test 2>/dev/null
+test --verbose 2>/dev/null export
+--verbose echo "$@" cd printf printf x=1 awk
+"$1" ${HOME} && 2>/dev/null done done export readonly 2>/dev/null awk $(pwd)
+${HOME} cd echo -eu ${HOME} export | | /usr/bin "$@" echo
+	sed export && grep ${HOME} -eu echo && awk
+	grep echo | ${HOME} 2>/dev/null grep local --verbose
+	local 2>/dev/null local /usr/bin local 'quoted text'
+echo awk --verbose | echo printf
+		awk ${HOME} readonly && ${HOME} -eu then ${HOME} export done -eu then echo sed
+echo printf local ${HOME} ${HOME} 2>/dev/null 2>/dev/null x=1 --verbose
+	printf $(pwd) --verbose local echo echo && export local --verbose 'quoted text'
+		| sed then $(pwd) readonly "$1" cd readonly $(pwd) 'quoted text' 2>/dev/null
+	-eu -eu "$1" "$1" "$@" x=1 export ${HOME} readonly x=1 "$@" --verbose
+	| then ${HOME} ${HOME} printf | /usr/bin | awk local x=1 /usr/bin
+sed x=1 cd $(pwd) --verbose
+	$(pwd) 'quoted text' | ${HOME} export --verbose then local cd local export
+	/usr/bin x=1 cd $(pwd) sed $(pwd) printf readonly x=1
+awk ${HOME} --verbose x=1 $(pwd) then then grep export test echo grep -eu done
+	done | local sed sed local grep
+printf local sed 'quoted text' export echo awk 2>/dev/null
+-eu | then /usr/bin then awk && | "$1" | 'quoted text'
+		sed 2>/dev/null cd "$@" $(pwd) awk test "$@" "$@" test 2>/dev/null readonly
+printf grep 2>/dev/null "$@" cd "$@" readonly -eu printf grep
+	"$@" | "$1" then $(pwd) x=1 | cd
+x=1 sed then export local export -eu --verbose ${HOME} 2>/dev/null local echo
+	$(pwd) 'quoted text' readonly "$1" ${HOME} cd printf
+		'quoted text' echo local then export then readonly
+-eu 'quoted text' printf --verbose
+	"$@" "$1" $(pwd) readonly ${HOME}
+echo "$1" x=1 local echo sed export grep /usr/bin
+${HOME} && cd "$@" -eu /usr/bin
+		test 2>/dev/null then awk /usr/bin awk /usr/bin done local printf
+x=1 'quoted text' grep ${HOME} echo
+awk $(pwd) export "$@" sed export
+2>/dev/null --verbose $(pwd) local x=1 local ${HOME}
+x=1 readonly grep local ${HOME} export 2>/dev/null ${HOME} -eu local -eu
+&& "$@" 'quoted text' grep then 'quoted text' readonly
+	--verbose "$1" /usr/bin sed $(pwd) echo "$@" test export && local /usr/bin
+		echo readonly $(pwd) export local grep ${HOME}
+		grep export -eu 'quoted text' -eu -eu done $(pwd) echo --verbose -eu --verbose
+		| done done $(pwd) printf sed x=1 x=1 $(pwd) x=1 readonly local done 'quoted text'
+		&& sed printf | grep done local awk echo x=1 ${HOME} && grep ${HOME}
+		awk awk export local && --verbose printf
+awk "$1" --verbose "$@" $(pwd) readonly "$1" /usr/bin local x=1
+	local ${HOME} 'quoted text' ${HOME} grep x=1 ${HOME} ${HOME} then "$@" cd then
+		done x=1 sed local | -eu echo --verbose readonly awk
+		then $(pwd) | --verbose $(pwd)
+		printf readonly "$1" && x=1 x=1 -eu "$1"
+		x=1 | echo cd 2>/dev/null "$@" "$1" local test done ${HOME} /usr/bin
+		then test | local awk awk $(pwd) test "$1" sed 'quoted text' then
+$(pwd) sed test sed awk /usr/bin | 'quoted text' export
+	done $(pwd) local test cd cd $(pwd) "$1" "$1" export done $(pwd)
+then awk done local ${HOME}
+then 2>/dev/null "$@"
+		done grep 'quoted text' "$@" grep local --verbose $(pwd)
+		grep ${HOME} x=1 cd grep awk awk readonly
+	"$1" printf && 2>/dev/null cd awk
+'quoted text' $(pwd) grep done sed x=1 "$@" ${HOME}
+	'quoted text' --verbose printf | awk
+		cd printf 2>/dev/null export -eu ${HOME} grep --verbose
+	echo test then && cd && "$@" -eu /usr/bin readonly
+test x=1 local export cd "$1"
+		done ${HOME} sed grep "$1" x=1 "$1" $(pwd) sed "$@" &&
+	grep 'quoted text' -eu "$@" cd local done readonly --verbose x=1 grep --verbose
+		"$1" $(pwd) "$@" awk ${HOME} test test /usr/bin "$1" "$@" then
+	$(pwd) awk awk /usr/bin "$1"
+	2>/dev/null -eu -eu export 'quoted text' ${HOME} /usr/bin
+		$(pwd) --verbose then printf readonly 2>/dev/null cd "$@"
+		then export x=1 "$1" 2>/dev/null x=1 "$1" "$@" then --verbose
+		sed echo export -eu done x=1 sed -eu 'quoted text' $(pwd) then 'quoted text'
+	2>/dev/null /usr/bin done cd --verbose sed grep $(pwd)
+		printf then done x=1 2>/dev/null test /usr/bin cd
+	| done readonly test $(pwd) --verbose /usr/bin --verbose then
+	test cd export export sed test
+		/usr/bin local | local ${HOME} cd ${HOME} "$1" local ${HOME} awk
+${HOME} grep --verbose grep done && then cd /usr/bin
+		$(pwd) --verbose "$1" 'quoted text'
+	grep printf local export local done --verbose
+		$(pwd) "$1" $(pwd) readonly --verbose -eu grep
+test local readonly --verbose x=1 x=1 ${HOME} --verbose cd "$@" "$1"
+	'quoted text' $(pwd) -eu $(pwd) local 2>/dev/null "$@" --verbose done ${HOME}
+done 'quoted text' sed -eu test x=1 done export ${HOME} /usr/bin --verbose "$@"
+	then -eu -eu "$1" sed | echo awk local cd export x=1 'quoted text'
+x=1 -eu echo --verbose local echo
+	| readonly x=1 cd printf printf
+then readonly $(pwd) $(pwd) ${HOME} export awk 2>/dev/null cd grep && x=1 &&
+	--verbose local awk -eu | cd 2>/dev/null readonly x=1 sed 'quoted text'
+x=1 awk $(pwd) /usr/bin -eu awk "$@" then --verbose x=1 -eu --verbose printf $(pwd)
+		export "$1" "$1" echo readonly $(pwd) | && done readonly /usr/bin -eu then 2>/dev/null
+		then x=1 && grep readonly readonly -eu cd sed
+	done readonly done done "$@" export
+	-eu -eu printf "$@" "$1" "$@" -eu /usr/bin ${HOME} test
+		readonly ${HOME} x=1 done
+	2>/dev/null done 2>/dev/null test
+&& 'quoted text' awk local
+		/usr/bin local printf $(pwd)
+	local -eu --verbose x=1 sed printf test readonly printf -eu 2>/dev/null
+	x=1 grep | export local "$1" cd
+	cd "$@" printf /usr/bin $(pwd) 'quoted text' cd sed -eu test sed x=1 | readonly
+		sed readonly -eu echo && then "$1" done --verbose readonly && "$@"
+	-eu 2>/dev/null 'quoted text' "$@"
+	local ${HOME} readonly 'quoted text'
+		'quoted text' x=1 cd "$@" && then 2>/dev/null
+local $(pwd) /usr/bin && $(pwd) done then | /usr/bin "$@" readonly -eu
+		echo ${HOME} "$@" 2>/dev/null | -eu ${HOME} "$@" local
+		sed echo readonly grep 2>/dev/null
+		local /usr/bin "$@" local grep ${HOME} $(pwd) x=1 -eu "$1" "$@" grep grep
+		done x=1 export cd readonly /usr/bin && grep | echo test cd
+"$@" cd sed grep done readonly test done ${HOME} "$1"
+	grep export -eu 'quoted text' test "$@" local 'quoted text'
+local then echo x=1 "$@" printf
+		awk cd echo && readonly $(pwd) test awk sed "$@" printf --verbose
+${HOME} sed -eu test export 'quoted text' ${HOME}
+	export x=1 $(pwd) | --verbose
+		awk done printf sed printf sed "$1" printf | "$1" awk awk
+	done grep 2>/dev/null test
+		readonly test awk "$@" awk
+"$1" $(pwd) then done && "$@" export done /usr/bin |
+		echo 'quoted text' echo awk then | readonly sed 2>/dev/null && then
+-eu readonly 2>/dev/null "$1" grep x=1 then
+x=1 printf cd readonly ${HOME} export test /usr/bin printf
+		$(pwd) 'quoted text' "$@" "$@" printf sed awk done
+		printf cd -eu readonly | sed "$@" ${HOME} ${HOME}
+$(pwd) "$@" x=1 cd awk 'quoted text' cd && 2>/dev/null -eu /usr/bin 2>/dev/null
+		then done && printf x=1 x=1 "$@" ${HOME} "$1"
+	"$1" sed ${HOME} sed echo done printf then
+&& local --verbose echo then then && awk then grep ${HOME} then cd done
+'quoted text' 2>/dev/null printf
+		cd echo readonly printf export | cd x=1 readonly "$@" 'quoted text'
+		"$@" cd local awk echo then && test | local cd --verbose --verbose cd ${HOME} ${HOME}
+		test -eu local $(pwd) awk local echo | local grep done grep then | "$1" export "$1"
+		sed ${HOME} --verbose 'quoted text' printf printf /usr/bin --verbose printf
+		&& export sed test printf echo 2>/dev/null readonly awk $(pwd) 2>/dev/null
+readonly grep grep --verbose printf $(pwd) export
+		echo "$1" cd "$1" $(pwd) local local
+test --verbose | 'quoted text' | readonly -eu && echo done ${HOME} -eu then
+sed printf export 2>/dev/null 'quoted text' "$1" && | cd grep sed "$1" local
+		--verbose readonly readonly grep local sed awk $(pwd)
+	$(pwd) | $(pwd) x=1 ${HOME} cd done --verbose --verbose
+		/usr/bin && echo local --verbose $(pwd)
+		2>/dev/null done test awk export sed x=1 readonly $(pwd) grep echo x=1 export
+	awk test x=1 && "$@" ${HOME} export local readonly
+	'quoted text' $(pwd) printf then && sed export 'quoted text'
+	-eu -eu $(pwd) cd local && | "$@"
+done | readonly echo echo 2>/dev/null | readonly ${HOME}
+		x=1 awk sed "$@" awk --verbose readonly | grep 2>/dev/null local
+		export then x=1 local -eu export "$1" then --verbose
+sed local x=1 -eu cd cd printf 'quoted text' awk | 2>/dev/null
+		cd sed && -eu | cd "$1" then sed "$@"
+		done test awk local x=1 cd
+	x=1 printf sed /usr/bin
+	/usr/bin 2>/dev/null grep done then && then sed ${HOME} echo cd
+--verbose && done done echo ${HOME} cd | x=1
+	&& awk done x=1 sed readonly test local "$@"
+	awk then --verbose awk $(pwd) grep $(pwd) local
+${HOME} x=1 done 2>/dev/null /usr/bin grep --verbose grep 2>/dev/null "$@" local
+	then cd | /usr/bin --verbose && -eu printf
+		-eu printf "$@" echo test cd test
+echo grep "$@" -eu local -eu "$@" printf --verbose "$@" echo
+		sed cd grep export export 2>/dev/null
+	--verbose then && --verbose done done local awk local
+test then echo local
+	${HOME} | -eu x=1 grep /usr/bin
+${HOME} cd -eu awk $(pwd) then
+		&& local ${HOME} test x=1 test && test
+	export printf $(pwd) 'quoted text' $(pwd) done printf
+		echo $(pwd) "$@" test x=1 then -eu cd readonly 'quoted text'
+		cd "$@" grep then "$@" sed && done
+x=1 cd 2>/dev/null export --verbose --verbose readonly &&
+awk ${HOME} echo --verbose printf
+		/usr/bin 'quoted text' 'quoted text' -eu
+		grep then export --verbose | "$1" | /usr/bin
+	printf readonly --verbose export local sed echo done readonly ${HOME} /usr/bin
+		$(pwd) readonly /usr/bin -eu sed readonly grep -eu ${HOME} local
+		done 'quoted text' printf done test then "$@" readonly
+	echo cd export "$@" --verbose export readonly ${HOME} 'quoted text'
+	'quoted text' echo grep $(pwd) $(pwd) ${HOME} export sed 'quoted text' && "$1" -eu
+	/usr/bin local local "$@" x=1
+		awk local $(pwd) --verbose cd 'quoted text'
+		cd "$1" cd echo readonly
+echo "$@" x=1 'quoted text' 2>/dev/null
+	| /usr/bin sed printf ${HOME}
+		done 2>/dev/null readonly $(pwd) 2>/dev/null awk
+awk "$@" cd /usr/bin ${HOME} --verbose grep $(pwd) $(pwd) cd x=1 "$@"
+awk ${HOME} ${HOME} export export export then done then && "$1" done local export
+&& | $(pwd) $(pwd) -eu -eu $(pwd) x=1
+		| | readonly /usr/bin | x=1 local 'quoted text' ${HOME}
+	then printf /usr/bin ${HOME} done "$1" then $(pwd) sed export cd &&
+		/usr/bin done awk export && 2>/dev/null
+	${HOME} echo then test "$@" --verbose echo awk x=1 x=1 --verbose
+	'quoted text' -eu export "$@" test
+	/usr/bin 2>/dev/null /usr/bin ${HOME} export
+	| 2>/dev/null then readonly cd x=1 printf x=1
+	echo ${HOME} readonly cd | awk export --verbose $(pwd) local sed readonly
+	then 2>/dev/null -eu printf /usr/bin
+		sed "$@" awk /usr/bin local && "$1"
+	"$1" /usr/bin awk cd 'quoted text'
+		awk echo cd then /usr/bin cd local cd test export printf done
+	then | ${HOME} "$@" readonly
+		$(pwd) /usr/bin readonly cd test test then "$1" readonly then
+		awk grep awk ${HOME} cd | export export /usr/bin
+		echo test awk readonly 2>/dev/null && x=1 | 'quoted text'
+| /usr/bin local "$1" x=1 "$1" x=1 -eu 2>/dev/null export "$1" x=1 echo
+	done test ${HOME} --verbose export cd "$@" done 2>/dev/null
+		x=1 awk $(pwd) ${HOME} 'quoted text' printf sed
+| sed ${HOME} done "$@" readonly cd awk echo -eu x=1
+	'quoted text' export 2>/dev/null "$1" then 'quoted text'
+		done cd | 2>/dev/null export export echo then $(pwd) echo "$@" "$1" 2>/dev/null
+x=1 cd then -eu awk --verbose "$1" x=1 echo
+/usr/bin $(pwd) echo cd done -eu readonly "$@" echo $(pwd) grep test --verbose
+"$@" done test | 'quoted text' echo
+	"$1" $(pwd) printf --verbose "$@" done
+	${HOME} --verbose $(pwd)
+test awk $(pwd) local awk "$@" $(pwd)
+&& 2>/dev/null done ${HOME} echo done | -eu /usr/bin
+		then "$1" test printf
+		${HOME} grep -eu export local grep ${HOME} 'quoted text'
+		| --verbose readonly done printf 2>/dev/null
+x=1 | sed cd done /usr/bin /usr/bin test echo local grep awk grep local /usr/bin
+	$(pwd) done test readonly local grep | cd export 'quoted text' 'quoted text'
+		grep then readonly 'quoted text'
+echo readonly export -eu 2>/dev/null export | done cd then export cd "$@" $(pwd)
+		'quoted text' export echo cd
+	-eu grep cd | "$@" -eu readonly awk
+export local cd ${HOME} ${HOME} test cd /usr/bin
+		--verbose "$@" sed 'quoted text' /usr/bin awk readonly
+		printf "$1" $(pwd) then "$@" grep -eu x=1 done "$@" sed printf $(pwd) local
+	cd then "$1" 2>/dev/null /usr/bin $(pwd) 'quoted text' printf
+	grep echo printf 2>/dev/null awk done /usr/bin
+	$(pwd) x=1 then readonly "$1" echo printf
+	then test local awk then | then
+"$@" $(pwd) test | 'quoted text' readonly x=1 |
+| awk | done done x=1 2>/dev/null
+	test echo done awk "$1" readonly
+		echo cd && 'quoted text' grep "$1" local && done /usr/bin
+	readonly -eu 'quoted text' test
+		-eu ${HOME} ${HOME} x=1 $(pwd) | --verbose
+		${HOME} 'quoted text' done && x=1 awk done sed 'quoted text' "$1" sed
+| x=1 -eu ${HOME} 'quoted text' 'quoted text'
+	x=1 2>/dev/null grep awk | then | test "$1" echo
+readonly --verbose sed then
+	$(pwd) then /usr/bin export -eu 2>/dev/null sed $(pwd) "$1"
+		2>/dev/null sed cd && /usr/bin $(pwd) x=1 printf local
+	awk export x=1 && test test 'quoted text' "$@"
+		"$1" cd /usr/bin -eu x=1 then -eu
+	done cd && | echo printf ${HOME} 2>/dev/null echo awk "$@" "$1" -eu
+		| "$1" then local then "$1"
+	cd && 'quoted text' -eu && ${HOME}
+readonly && test export echo 'quoted text' 'quoted text' sed
+readonly export /usr/bin x=1 "$@" local $(pwd) local test 2>/dev/null
+		done x=1 'quoted text' | done x=1 printf ${HOME} printf $(pwd)
+	local 2>/dev/null readonly && "$1" "$@" echo readonly echo grep && "$1" "$1"
+	${HOME} cd -eu grep "$@"
+${HOME} x=1 export awk sed cd "$1" 2>/dev/null
+sed 2>/dev/null x=1 readonly
+	sed cd echo --verbose $(pwd) 'quoted text' --verbose readonly readonly
+		${HOME} printf && -eu --verbose -eu printf "$1" ${HOME} /usr/bin
+	${HOME} sed grep ${HOME} -eu ${HOME} test awk export
+		grep 'quoted text' readonly cd readonly | grep
+	sed --verbose awk readonly "$@" local printf
+echo --verbose x=1 echo 'quoted text' --verbose grep export
+	$(pwd) printf $(pwd) local grep && grep -eu printf then && done --verbose
+		readonly printf ${HOME} /usr/bin readonly then x=1 | done sed && -eu
+	--verbose grep local done export echo
+	awk 2>/dev/null ${HOME} printf && done awk --verbose $(pwd) grep ${HOME} local
+	2>/dev/null /usr/bin x=1 2>/dev/null
+sed printf grep "$@" 'quoted text' /usr/bin local grep /usr/bin then local -eu
+		readonly local printf readonly "$1" cd -eu
+	x=1 readonly x=1 "$1" --verbose | sed /usr/bin local echo grep /usr/bin
+	/usr/bin sed 'quoted text'
+	cd ${HOME} sed readonly "$@" 'quoted text' echo grep test local done grep
+2>/dev/null then /usr/bin /usr/bin x=1 'quoted text' test ${HOME} --verbose
+	local /usr/bin -eu done then local x=1 $(pwd)
+		| local $(pwd) test | test $(pwd) $(pwd) printf
+		local then readonly "$1" printf $(pwd) && local -eu x=1 readonly $(pwd) printf
+&& test | sed "$@" 2>/dev/null /usr/bin sed printf
+		x=1 $(pwd) "$@" cd export echo "$1" --verbose -eu && readonly readonly sed sed
+'quoted text' local grep x=1 cd && x=1 | done 'quoted text'
+$(pwd) $(pwd) 'quoted text' then "$1" $(pwd) done
+	awk | 2>/dev/null "$@" then export "$1" readonly test done x=1 awk /usr/bin
+"$@" /usr/bin ${HOME} ${HOME} 2>/dev/null
+	x=1 grep 'quoted text' export cd 'quoted text' cd local
+export && -eu export -eu x=1 --verbose sed readonly
+| /usr/bin readonly printf /usr/bin
+--verbose done sed | export grep /usr/bin 'quoted text'
+${HOME} readonly -eu /usr/bin grep
+		grep --verbose | ${HOME} cd local sed
+&& "$@" awk -eu local x=1 && echo 2>/dev/null
+	"$1" awk sed 'quoted text' sed "$@" readonly ${HOME} awk | x=1
+	"$@" done && then | ${HOME} /usr/bin local | ${HOME} test then then export x=1 grep
+/usr/bin $(pwd) | test
+	2>/dev/null /usr/bin sed grep echo ${HOME} readonly echo test then cd
+	-eu -eu -eu 2>/dev/null "$@" "$1" printf "$@" $(pwd) printf | then /usr/bin
+		${HOME} readonly printf /usr/bin readonly
+	test local local "$@"
+		export printf "$1" export 2>/dev/null awk cd $(pwd) awk cd
+	'quoted text' x=1 done /usr/bin
+grep export "$@" awk "$@" cd
+then echo "$@" local grep test ${HOME} ${HOME} /usr/bin echo then 'quoted text'
+		"$1" "$@" x=1 "$@" /usr/bin
+	grep "$1" export "$1" grep
+	'quoted text' sed x=1 ${HOME} |
+	test "$@" readonly 'quoted text' awk then then | awk x=1 local awk readonly
+		${HOME} done grep x=1 then /usr/bin --verbose 2>/dev/null x=1
+grep then | -eu sed sed 'quoted text'
+	/usr/bin ${HOME} printf
+	echo test then awk x=1 | x=1
+		2>/dev/null --verbose 'quoted text' 'quoted text' 2>/dev/null awk echo x=1
+		sed ${HOME} && --verbose -eu | awk /usr/bin test ${HOME} cd done then
+then ${HOME} export grep grep sed
+	cd test -eu $(pwd) x=1 --verbose
+	echo x=1 echo echo ${HOME} /usr/bin sed export test cd -eu echo 'quoted text'
+2>/dev/null readonly 'quoted text'
+${HOME} "$1" done then then awk && cd -eu 'quoted text'
+		awk then 2>/dev/null test 2>/dev/null ${HOME} "$@" x=1 readonly x=1 sed printf cd
+	printf awk "$@" $(pwd)
+test local 2>/dev/null export echo local
+		test 2>/dev/null echo "$1" "$@"
+printf local 'quoted text'
+		export done && cd local then "$1" $(pwd) then 2>/dev/null grep awk "$1"
+	sed printf ${HOME} done ${HOME} 2>/dev/null --verbose && "$1" "$@" then test
+		/usr/bin test local /usr/bin
+	cd export --verbose x=1 ${HOME} sed /usr/bin printf
+		awk | echo done local "$1" printf
+	| $(pwd) && 'quoted text' then local
+done | /usr/bin local
+	printf ${HOME} x=1 export export then done done sed ${HOME} x=1 readonly
+	"$@" "$@" /usr/bin -eu sed readonly
+	sed cd then grep && echo "$@" local 'quoted text'
+"$@" $(pwd) grep -eu -eu echo x=1 cd "$1" grep test -eu "$1"
+"$1" ${HOME} 'quoted text' local "$1" 2>/dev/null 'quoted text' --verbose
+-eu export "$1" test && | local 2>/dev/null /usr/bin cd 'quoted text' ${HOME} sed
+		grep | awk printf "$1" | then "$1" | awk x=1 then cd "$1" ${HOME}
+	$(pwd) cd && /usr/bin && echo local "$@" then echo "$1" sed
+echo x=1 awk 'quoted text' "$@" -eu -eu ${HOME}
+	--verbose echo --verbose cd | && ${HOME} test /usr/bin
+&& 'quoted text' 2>/dev/null
+$(pwd) 'quoted text' grep cd
+echo grep readonly 'quoted text'
+		-eu sed test done 2>/dev/null -eu
+		-eu -eu -eu awk 2>/dev/null readonly ${HOME} -eu echo
+--verbose "$1" printf 'quoted text' printf local
+		'quoted text' echo ${HOME} | awk && --verbose grep done
+| 2>/dev/null --verbose 2>/dev/null test 'quoted text' ${HOME} -eu then
+	printf --verbose /usr/bin ${HOME} ${HOME} echo 2>/dev/null readonly /usr/bin
+	local | "$1" done "$1" ${HOME}
+		"$1" local echo grep --verbose
+	sed 'quoted text' | ${HOME} --verbose | local local
+	| echo x=1 readonly "$@" $(pwd) | 'quoted text' "$@" local export 2>/dev/null
+sed done readonly "$1" awk "$1" export cd cd export "$@" x=1 "$@" ${HOME}
+	| /usr/bin echo done test "$1" 'quoted text' test
+		'quoted text' -eu readonly && export
+	"$@" "$@" -eu sed local ${HOME}
+--verbose awk sed "$@" grep "$1" 'quoted text' 'quoted text' readonly /usr/bin
+		printf x=1 ${HOME} -eu --verbose "$1" local awk ${HOME} then
+sed export ${HOME} then && && && x=1 done
+	"$1" && -eu /usr/bin awk -eu grep /usr/bin
+		grep | -eu 'quoted text' "$@" test $(pwd) echo "$@" "$@" | printf 'quoted text'
+	'quoted text' x=1 cd x=1 printf
+		--verbose ${HOME} -eu "$@" ${HOME} export printf echo $(pwd) export done "$@"
+		"$1" grep done then --verbose -eu --verbose "$1" --verbose
+	"$1" -eu "$@" "$@" then cd grep done && "$1" awk test done $(pwd)
+--verbose grep local $(pwd) cd echo && local echo /usr/bin then
+	'quoted text' local sed cd -eu cd done local then cd printf $(pwd)
+		'quoted text' "$1" 2>/dev/null printf 'quoted text' cd "$@" printf /usr/bin /usr/bin
+		readonly -eu printf export && $(pwd) 2>/dev/null then local ${HOME}
+cd "$1" 'quoted text' export | done echo ${HOME} 2>/dev/null -eu "$@" "$@"
+	'quoted text' done readonly done then /usr/bin printf ${HOME} | --verbose
+export local -eu 'quoted text' local x=1 then
+| done $(pwd) sed ${HOME} 2>/dev/null
+	&& --verbose "$@" export --verbose
+	--verbose -eu 2>/dev/null
+echo then awk then cd readonly readonly printf ${HOME} --verbose
+	${HOME} 'quoted text' awk
+printf local ${HOME} -eu sed sed done
+| && 'quoted text' export cd then && $(pwd) local x=1 echo
+		/usr/bin $(pwd) grep readonly
+		test readonly ${HOME} && --verbose printf -eu $(pwd)
+	cd $(pwd) local 2>/dev/null 2>/dev/null "$@" awk export "$@" "$@"
+then /usr/bin done cd printf "$1" then $(pwd) grep then
+	${HOME} awk grep then && | | cd $(pwd) then local export 2>/dev/null "$1"
+	local ${HOME} "$@" printf done
+		readonly "$@" readonly x=1 echo cd test then -eu
+done x=1 printf && /usr/bin && 'quoted text' 'quoted text' export readonly
+	${HOME} /usr/bin printf /usr/bin
+then /usr/bin | | 2>/dev/null then "$@" sed echo test
+	printf sed sed awk 'quoted text' -eu -eu 'quoted text'
+		readonly --verbose awk 2>/dev/null | x=1
+$(pwd) local -eu cd cd readonly 2>/dev/null export
+-eu -eu -eu 2>/dev/null ${HOME} "$@" cd $(pwd) export test && -eu ${HOME}
+readonly test test awk -eu 2>/dev/null ${HOME} done echo readonly x=1 "$1" printf
+x=1 printf awk -eu readonly
+		echo done -eu printf grep "$@"
+printf $(pwd) cd /usr/bin 2>/dev/null printf x=1 test x=1 x=1 echo | grep export
+	--verbose 'quoted text' sed --verbose
+		${HOME} $(pwd) cd grep x=1
+$(pwd) 'quoted text' test sed export test sed --verbose
+		cd x=1 echo readonly -eu export test "$1" grep test readonly |
+	"$1" cd awk "$1" && export test
+	'quoted text' "$1" 2>/dev/null grep grep cd cd sed
+	-eu 2>/dev/null printf readonly 'quoted text' grep done 'quoted text'
+sed echo done 'quoted text' local $(pwd) 2>/dev/null then
+		cd --verbose printf awk x=1 "$1" sed grep
+	cd | "$1" local "$1" $(pwd) test 2>/dev/null then export /usr/bin
+	echo -eu then "$@" local "$@" "$@" 'quoted text'
+		local awk grep "$1" 2>/dev/null done x=1 export
+local $(pwd) local grep && sed sed local && echo /usr/bin
+done export test -eu echo test
+		sed echo test x=1 test 'quoted text' /usr/bin awk --verbose printf export
+		-eu -eu local grep $(pwd) "$@"
+	cd sed local "$@" $(pwd) &&
+		| "$1" grep /usr/bin awk echo test echo | "$1" readonly printf
+${HOME} 2>/dev/null "$@" "$1" x=1 -eu echo
+	readonly --verbose --verbose
+${HOME} /usr/bin "$@" $(pwd) 'quoted text'
+| -eu echo export $(pwd) --verbose cd export
+		sed ${HOME} $(pwd) local 2>/dev/null
+/usr/bin -eu cd sed cd done /usr/bin done printf grep /usr/bin /usr/bin test
+		done echo awk | "$1" x=1 export local local echo 'quoted text'
+		sed 'quoted text' done sed
+x=1 export echo local sed grep -eu && awk $(pwd) sed local x=1
+	--verbose export 'quoted text' ${HOME}
+		-eu echo --verbose --verbose cd export printf 'quoted text' "$@" /usr/bin
+		"$1" | done sed | local then && test readonly grep | ${HOME} printf then done echo
+	done | grep x=1 ${HOME} cd
+		awk 2>/dev/null done then awk test | |
+		x=1 2>/dev/null sed test
+	echo "$1" 2>/dev/null export /usr/bin test /usr/bin done | | sed ${HOME}
+		/usr/bin -eu "$@" 'quoted text'
+		export --verbose export --verbose /usr/bin
+		grep "$1" && 'quoted text' --verbose && | 'quoted text' | readonly
+local && "$@" grep printf then readonly cd echo echo done awk $(pwd)
+cd export 2>/dev/null x=1 'quoted text' echo 2>/dev/null
+readonly "$1" grep readonly && x=1 2>/dev/null
+	2>/dev/null 'quoted text' 'quoted text' 2>/dev/null
+${HOME} awk ${HOME} | done
+	/usr/bin done done "$1"
+	export --verbose echo $(pwd) | /usr/bin
+export && ${HOME} "$@" "$@" local --verbose grep grep "$@" cd "$@" $(pwd)
+/usr/bin 'quoted text' cd | export $(pwd) sed "$@" -eu && grep /usr/bin
+local export && $(pwd) cd ${HOME} export readonly awk /usr/bin printf
+export "$1" readonly test readonly awk readonly sed
+		/usr/bin sed "$1" echo sed echo local export local 2>/dev/null export "$@" local
+		export test $(pwd) echo then && sed awk then && test 'quoted text'
+-eu ${HOME} && grep readonly
+		sed /usr/bin x=1 grep printf then /usr/bin
+		local "$1" awk -eu done test -eu
+done x=1 ${HOME} "$1" | 'quoted text' && 2>/dev/null
+	grep -eu local --verbose grep
+cd cd x=1 $(pwd) grep echo then "$@"
+then echo test --verbose echo test local x=1 'quoted text' printf
+	awk readonly && 2>/dev/null cd sed 'quoted text' printf cd local
+local 2>/dev/null 'quoted text' sed then
+	x=1 printf done sed readonly
+"$1" sed && test printf /usr/bin --verbose
+		printf 2>/dev/null --verbose done | readonly
+echo --verbose readonly then cd 'quoted text' "$@" 'quoted text'
+awk | test -eu && done 'quoted text' ${HOME} grep | done $(pwd)
+&& 'quoted text' awk $(pwd) readonly cd $(pwd) then
+	${HOME} && "$1" local 2>/dev/null ${HOME} grep x=1
+		sed | test awk awk printf x=1 grep sed 2>/dev/null
+	echo "$@" local x=1 printf echo done --verbose awk local
+--verbose -eu $(pwd) x=1 $(pwd) /usr/bin 'quoted text'
+	--verbose local then done | | "$1" test 'quoted text'
+grep -eu readonly && "$1" awk printf grep /usr/bin then awk echo
+"$1" cd readonly | done /usr/bin ${HOME} printf awk grep x=1 2>/dev/null printf
+		echo done /usr/bin /usr/bin && /usr/bin then "$1" "$1" 'quoted text' "$@" cd echo
+		${HOME} printf readonly
+awk -eu sed echo 'quoted text' 'quoted text' readonly test then 2>/dev/null "$1"
+	"$1" -eu done readonly /usr/bin test 'quoted text' "$@" sed awk
+		2>/dev/null 2>/dev/null cd "$@" ${HOME} echo $(pwd) /usr/bin echo then /usr/bin
+		awk awk --verbose printf 2>/dev/null echo cd local 'quoted text' --verbose
+		test printf export /usr/bin $(pwd) "$@" awk /usr/bin cd grep printf
+| echo --verbose && export x=1 awk done $(pwd) cd ${HOME} -eu printf echo test
+2>/dev/null printf 'quoted text' 'quoted text' awk awk cd
+		/usr/bin awk echo 2>/dev/null
+		&& | done grep readonly echo $(pwd)
+awk echo export local cd -eu --verbose
+		'quoted text' --verbose echo readonly done export ${HOME} readonly
+test done done awk readonly $(pwd)
+	sed /usr/bin test test cd readonly 'quoted text' test test
+		x=1 /usr/bin cd printf | x=1 readonly echo
+	--verbose cd $(pwd) /usr/bin printf -eu -eu | printf
+	/usr/bin 2>/dev/null export grep cd 2>/dev/null sed echo "$@" x=1 x=1
+		--verbose 2>/dev/null readonly | readonly grep $(pwd) then cd
+done local | --verbose export local x=1 then "$@" -eu done "$@" 'quoted text'
+	export readonly --verbose test
+done local export sed -eu grep echo cd "$@" -eu test
+		-eu grep --verbose grep grep test awk local --verbose
+then --verbose sed -eu readonly
+test test /usr/bin 'quoted text' "$1" /usr/bin
+		done export echo awk x=1 ${HOME} /usr/bin && echo test $(pwd) test &&
+	'quoted text' printf local then awk test
+	2>/dev/null --verbose awk test awk local | 'quoted text'
+'quoted text' local sed -eu && 'quoted text' "$@"
+		/usr/bin printf printf x=1 $(pwd) then 2>/dev/null
+	'quoted text' test "$@" "$1" 2>/dev/null awk cd then
+		echo && "$1" ${HOME} awk x=1 x=1 x=1 cd
+	--verbose /usr/bin test /usr/bin test readonly local then ${HOME} readonly
+export grep && readonly ${HOME} |
+		${HOME} /usr/bin /usr/bin awk sed "$@" readonly cd
+cd "$@" sed sed "$@" then $(pwd) export 2>/dev/null done cd $(pwd)
+		"$@" echo cd readonly /usr/bin
+	readonly local then --verbose
+	done -eu | 2>/dev/null awk
+${HOME} ${HOME} printf ${HOME} grep
+"$@" then printf | -eu x=1 "$@" cd sed --verbose | "$@" $(pwd)
+	"$@" done "$@" 2>/dev/null grep -eu $(pwd) 'quoted text' x=1 'quoted text' echo
+		/usr/bin local "$@" /usr/bin --verbose /usr/bin /usr/bin
+printf ${HOME} then then readonly "$@" ${HOME} local sed printf export
+	cd --verbose cd 'quoted text' export then "$@"
+	local done "$@" printf cd local && done --verbose -eu
+$(pwd) cd printf 'quoted text' echo -eu readonly "$1" -eu 2>/dev/null
+"$@" printf then awk --verbose test /usr/bin "$1" | then then | echo echo | 'quoted text'
+		printf local local export "$1" --verbose echo readonly
+printf 'quoted text' done echo test readonly
+	$(pwd) $(pwd) readonly --verbose grep awk then ${HOME} "$1" done
+		'quoted text' 'quoted text' done awk -eu then && export grep test local test
+printf test then 2>/dev/null /usr/bin echo done | 'quoted text'
+${HOME} grep printf printf | ${HOME} | "$@" cd ${HOME} awk "$1" x=1
+	grep --verbose ${HOME} grep 'quoted text' -eu "$1" | awk | "$1" test then test then
+local grep --verbose 2>/dev/null export readonly --verbose -eu 'quoted text'
+--verbose printf echo $(pwd) x=1 "$@" export test --verbose printf export
+$(pwd) export then export then --verbose printf 'quoted text' $(pwd) x=1 export
+--verbose readonly 'quoted text' cd readonly printf
+cd sed -eu printf awk "$1" readonly --verbose cd awk echo /usr/bin sed test readonly
+"$1" printf --verbose && "$@" sed --verbose --verbose x=1 cd 2>/dev/null
+	/usr/bin | readonly echo then 2>/dev/null sed "$@" sed test
+	printf | export test x=1 "$1" cd -eu /usr/bin printf 2>/dev/null "$@" | &&
+cd cd test then readonly x=1 'quoted text' && "$@"
+		test grep test readonly sed sed "$1" sed echo
+then 'quoted text' -eu /usr/bin local sed echo $(pwd) x=1 x=1
+		"$@" test grep then echo then "$1" done
+		test --verbose done x=1 && "$@" test x=1 -eu printf test 2>/dev/null
+	readonly "$1" then local sed --verbose then --verbose
+		grep awk sed -eu "$1" cd printf
+	done ${HOME} ${HOME} awk echo echo | printf test sed $(pwd) $(pwd) 'quoted text'
+--verbose $(pwd) test 'quoted text' ${HOME} test
+		'quoted text' awk "$1"
+		readonly $(pwd) export then "$1" test && awk cd readonly --verbose
+		printf x=1 then | printf --verbose grep
+	${HOME} "$1" test x=1 sed grep | "$@" echo 2>/dev/null then echo
+		cd $(pwd) x=1 cd $(pwd) test | grep sed -eu /usr/bin
+'quoted text' sed done done grep printf ${HOME}
+		sed readonly awk printf printf | grep awk -eu echo done --verbose --verbose echo
+readonly 'quoted text' && done grep cd "$@" 2>/dev/null
+		then export then | 'quoted text'
+	awk -eu printf $(pwd) "$1" cd sed then 'quoted text' done 2>/dev/null test
+	local "$1" grep 'quoted text' readonly -eu then | done readonly awk done
+${HOME} 2>/dev/null cd then grep export --verbose /usr/bin -eu
+	$(pwd) 2>/dev/null $(pwd) 2>/dev/null cd --verbose
+		export /usr/bin readonly | |
+grep x=1 2>/dev/null done 2>/dev/null test local && done sed ${HOME} test x=1 grep
+	then grep x=1 export echo awk grep readonly grep readonly /usr/bin
+-eu && x=1 $(pwd) 2>/dev/null readonly test test /usr/bin && x=1 cd x=1
+echo local "$@" grep /usr/bin grep | local --verbose /usr/bin
+	-eu awk test "$1" test /usr/bin --verbose sed /usr/bin /usr/bin
+cd local "$1" 'quoted text' grep awk /usr/bin then "$@" test sed then grep "$@"
+		x=1 grep --verbose /usr/bin printf "$1" -eu
+local awk $(pwd) -eu 2>/dev/null ${HOME}
+/usr/bin x=1 'quoted text' test local /usr/bin
+		--verbose awk grep ${HOME} grep printf then awk "$@" "$1" grep "$@" export
+	awk awk && ${HOME} "$@" | x=1 then $(pwd)
+echo test | local x=1 sed && /usr/bin --verbose local 2>/dev/null
+		then 'quoted text' x=1 --verbose sed "$1" | sed 2>/dev/null export $(pwd) -eu export
+export echo 2>/dev/null 2>/dev/null export 2>/dev/null 2>/dev/null
+echo awk grep --verbose | x=1 'quoted text'
+	'quoted text' --verbose 2>/dev/null done grep && export
+		then 'quoted text' echo local test export && grep
+test readonly export test "$1" local
+2>/dev/null "$1" test test awk && $(pwd) sed then | ${HOME} "$1" test export
+		2>/dev/null awk done then --verbose test awk | -eu 'quoted text' -eu -eu
+		$(pwd) | $(pwd) "$@" printf ${HOME} local export &&
+&& "$@" printf /usr/bin cd done then then printf | test export
+	grep x=1 "$@" sed sed export export "$1" awk ${HOME} /usr/bin test printf
+		${HOME} -eu then "$1" then --verbose readonly -eu printf "$@"
+then echo $(pwd) readonly sed /usr/bin
+		awk ${HOME} --verbose | | awk "$@" printf $(pwd) ${HOME}
+		local cd "$1" $(pwd) export sed ${HOME} printf local --verbose awk | -eu |
+		2>/dev/null 'quoted text' grep $(pwd) "$@" cd echo | /usr/bin
+	then cd "$1" then -eu sed grep /usr/bin -eu echo then
+done sed x=1 "$@" --verbose done cd "$1" /usr/bin local printf -eu readonly /usr/bin
+then local x=1 grep /usr/bin readonly | "$1" done
+		"$1" /usr/bin "$1" 2>/dev/null grep grep
+'quoted text' x=1 local 'quoted text' echo "$@" 2>/dev/null x=1 | --verbose /usr/bin
+'quoted text' readonly ${HOME} && /usr/bin export /usr/bin &&
+		&& /usr/bin then readonly $(pwd) /usr/bin grep
+		test cd "$@" | echo readonly export echo "$1" grep x=1 $(pwd) awk 2>/dev/null
+		done /usr/bin printf cd $(pwd) -eu
+'quoted text' local -eu done printf x=1 'quoted text' x=1 sed "$1" done
+		-eu && sed local -eu then then local then x=1 printf
+	printf grep $(pwd) test 'quoted text' awk
+grep grep 'quoted text'
+	-eu 2>/dev/null | cd local ${HOME} $(pwd) test export
+	2>/dev/null export readonly -eu readonly | x=1 /usr/bin && printf sed echo grep
+$(pwd) $(pwd) ${HOME} x=1 then awk sed awk $(pwd) readonly 'quoted text' readonly
+| export /usr/bin cd sed ${HOME} ${HOME} 2>/dev/null
+	&& 'quoted text' $(pwd) test test test ${HOME} $(pwd) readonly -eu done
+		x=1 then ${HOME} "$1" printf then grep sed $(pwd) cd test && export then 'quoted text'
+	${HOME} -eu "$@" /usr/bin grep "$@" awk awk $(pwd) -eu echo then then awk
+		${HOME} awk grep ${HOME} --verbose
+	--verbose ${HOME} x=1 grep /usr/bin export |
+	sed echo --verbose -eu 2>/dev/null 2>/dev/null test /usr/bin -eu done
+awk export /usr/bin sed && ${HOME} "$1" test
+	"$1" cd sed 'quoted text' | | test && done echo 'quoted text' | then echo readonly
+/usr/bin 2>/dev/null export
+	${HOME} -eu /usr/bin export
+	&& "$1" "$1" -eu printf "$1" 'quoted text' cd "$@" readonly
+grep readonly printf echo /usr/bin export grep then
+		'quoted text' "$@" awk readonly "$1" done done test test
+	2>/dev/null /usr/bin 2>/dev/null ${HOME} ${HOME} 2>/dev/null && && 2>/dev/null
+		grep --verbose $(pwd)
+		/usr/bin "$1" 'quoted text' ${HOME} 'quoted text' x=1
+	/usr/bin --verbose echo /usr/bin then awk grep readonly &&
+readonly -eu ${HOME} sed echo
+		| then | cd | "$1" echo -eu echo 'quoted text'
+	'quoted text' cd cd printf then test --verbose 'quoted text'
+		| test | cd -eu /usr/bin ${HOME} | ${HOME} $(pwd) echo local awk done
+		2>/dev/null then 'quoted text'
+	cd done -eu -eu 2>/dev/null grep --verbose
+readonly | "$1" x=1 test 2>/dev/null --verbose sed "$1" grep test --verbose
+	x=1 && grep "$@" 2>/dev/null --verbose /usr/bin 2>/dev/null test -eu done
+	"$1" $(pwd) sed --verbose $(pwd) sed readonly | $(pwd)
+		then "$@" && && | 'quoted text' -eu && then awk then
+| export | 2>/dev/null printf /usr/bin
+"$@" ${HOME} | /usr/bin then readonly
+${HOME} && local -eu readonly echo done --verbose
+		cd grep -eu --verbose "$@" sed readonly 'quoted text' then $(pwd) awk ${HOME}
+		--verbose 2>/dev/null /usr/bin readonly readonly x=1 "$@" test sed /usr/bin
+		"$1" "$@" local readonly local printf --verbose
+	echo --verbose -eu awk grep test /usr/bin done | ${HOME} sed $(pwd) /usr/bin
+"$1" grep 'quoted text' | done "$@" --verbose local then sed
+		"$@" x=1 printf local $(pwd) sed export
+	-eu -eu 2>/dev/null /usr/bin then $(pwd)
+| export | /usr/bin test sed "$1" test -eu /usr/bin $(pwd) cd
+		sed "$@" cd --verbose "$1" && cd "$@" sed grep export ${HOME} /usr/bin
+	local | printf 'quoted text'
+'quoted text' ${HOME} done | ${HOME} grep && test echo 2>/dev/null | cd "$1" "$1"
+	| && export x=1 awk echo x=1 "$@" awk 'quoted text' readonly
+	grep echo printf $(pwd) sed echo $(pwd) export sed
+readonly export -eu local 'quoted text'
+	${HOME} "$1" && -eu export
+	"$1" 'quoted text' --verbose cd local test printf ${HOME} done 'quoted text'
+	printf printf 2>/dev/null printf "$1" x=1 'quoted text' test 'quoted text'
+-eu cd -eu 'quoted text' done --verbose
+	cd && x=1 then "$@" readonly printf ${HOME} echo ${HOME} export
+--verbose local "$@" $(pwd)
+sed 2>/dev/null -eu awk printf then && local $(pwd) sed &&
+		${HOME} printf && x=1 export echo -eu
+	export grep x=1 printf awk -eu printf then echo x=1 readonly readonly
+		${HOME} sed --verbose $(pwd) 'quoted text' test "$@" readonly readonly
+		grep 'quoted text' test | awk export
+		&& export "$1" $(pwd) x=1 && grep export printf done cd x=1 "$1" test local
+readonly 'quoted text' awk 2>/dev/null sed && export ${HOME} --verbose
+		&& ${HOME} echo test awk 2>/dev/null echo "$@" ${HOME} cd /usr/bin
+	x=1 printf | && then echo && echo local
+x=1 cd && 'quoted text' awk printf $(pwd) local printf awk -eu x=1
+	done 'quoted text' 'quoted text' ${HOME}
+${HOME} | then "$1" cd grep "$@" 'quoted text' then done export
+	cd printf awk grep printf && readonly | local x=1 done x=1 test
+		export awk $(pwd) 2>/dev/null export readonly cd echo readonly export
+		${HOME} test && $(pwd) cd /usr/bin awk --verbose
+"$1" then --verbose then
+	$(pwd) | awk $(pwd) | grep "$@" $(pwd) --verbose grep test echo awk local
+echo printf "$@" 2>/dev/null 'quoted text' done test done printf export
+printf readonly cd readonly 2>/dev/null
+	x=1 export /usr/bin x=1 awk test
+	test grep && "$1" $(pwd) export "$@" 'quoted text' local 'quoted text'
+		cd 2>/dev/null 'quoted text' "$1" "$1" then /usr/bin local 'quoted text'
+then x=1 sed "$@" 'quoted text'
+		cd 2>/dev/null /usr/bin x=1 awk awk grep | printf local printf then
+	2>/dev/null 2>/dev/null $(pwd) printf 2>/dev/null
+cd local --verbose && echo awk && export export 'quoted text'
+		| 'quoted text' && local x=1 | "$1" --verbose
+	export grep test done export "$1" grep 'quoted text' "$@" && 'quoted text'
+		/usr/bin x=1 'quoted text' -eu --verbose export sed "$1"
+		grep && 2>/dev/null 'quoted text'
+	2>/dev/null then sed 2>/dev/null printf grep
+		&& export local printf $(pwd)
+"$@" test test export test ${HOME} printf
+	| "$@" "$@" && 'quoted text' && sed local sed cd awk 2>/dev/null
+grep x=1 'quoted text' && local
+"$1" test local local -eu -eu done 2>/dev/null --verbose ${HOME}
+		test 2>/dev/null export --verbose
+	grep awk awk printf "$@" "$1" $(pwd)
+	local echo export x=1 grep x=1 awk | done readonly
+	&& | x=1 $(pwd) 2>/dev/null x=1 then ${HOME} then 'quoted text' local 2>/dev/null
+		cd done sed | "$1" test readonly 'quoted text' 'quoted text' 2>/dev/null
+		x=1 test x=1 test && "$1" local test echo | | -eu local -eu /usr/bin readonly test
+	then printf printf 'quoted text' readonly export echo echo 2>/dev/null
+local awk test --verbose awk printf local --verbose
+		$(pwd) ${HOME} ${HOME} 'quoted text' --verbose ${HOME} 2>/dev/null
+	&& echo && sed -eu readonly 2>/dev/null 'quoted text' --verbose "$1" done
+	-eu --verbose awk then awk 2>/dev/null && 'quoted text'
+	'quoted text' -eu --verbose test | grep --verbose /usr/bin && test 'quoted text'
+export -eu 2>/dev/null readonly cd
+	cd ${HOME} printf grep -eu
+/usr/bin $(pwd) /usr/bin grep x=1 "$1" grep $(pwd) sed --verbose |
+export grep --verbose awk "$@" 'quoted text' $(pwd) cd cd local
+		$(pwd) 2>/dev/null done export done done test done --verbose
+	"$1" /usr/bin sed --verbose echo
+		awk printf -eu echo cd readonly 'quoted text'
+		/usr/bin $(pwd) "$@" sed 'quoted text'
+	export x=1 | | && -eu
+	printf x=1 | local local -eu done "$@" x=1 readonly
+	-eu x=1 $(pwd) local -eu echo $(pwd) && /usr/bin --verbose export
+2>/dev/null export test $(pwd) test
+		x=1 readonly x=1 'quoted text' -eu test done test
+	--verbose echo "$1" cd 'quoted text'
+grep ${HOME} --verbose 'quoted text' 'quoted text' x=1 test
+	readonly echo cd local local awk test | && $(pwd) 'quoted text' "$1"
+&& done done -eu $(pwd) grep ${HOME} | ${HOME} -eu | local echo
+test printf then then -eu export echo echo 2>/dev/null test
+	"$1" $(pwd) ${HOME} cd grep "$@" --verbose $(pwd) 2>/dev/null
+	"$1" local "$1" "$@" cd 'quoted text' x=1 sed | done local
+		${HOME} echo --verbose
+		"$1" $(pwd) x=1 then test printf "$1" sed printf "$1" cd then --verbose
+	${HOME} "$1" && test
+		&& then local printf export awk local test
+		done export 2>/dev/null then ${HOME} sed
+test | -eu readonly readonly ${HOME} sed x=1
+2>/dev/null printf done 2>/dev/null ${HOME} x=1 export | sed
+		2>/dev/null grep echo printf readonly | 2>/dev/null /usr/bin
+	&& x=1 grep | | 'quoted text' grep
+		$(pwd) && ${HOME} echo -eu sed grep grep --verbose
+${HOME} grep test $(pwd) -eu readonly printf $(pwd) export && test "$1" --verbose
+then then cd -eu 2>/dev/null "$@" echo sed awk
+		test --verbose then 2>/dev/null then export ${HOME} test
+		test 2>/dev/null | sed "$1" /usr/bin x=1 printf export 'quoted text' "$@" $(pwd)
+		$(pwd) test --verbose --verbose echo
+"$@" grep | readonly ${HOME} sed 2>/dev/null printf ${HOME}
+	'quoted text' readonly ${HOME} $(pwd) | --verbose
+printf sed 2>/dev/null /usr/bin cd x=1 test test 'quoted text'
+	x=1 "$1" readonly x=1 echo | | --verbose
+--verbose x=1 cd --verbose grep /usr/bin x=1 2>/dev/null 'quoted text'
+cd local /usr/bin "$1" cd | ${HOME} 'quoted text' && echo then 2>/dev/null
+	awk $(pwd) "$@" | readonly && test ${HOME} -eu | | 2>/dev/null 'quoted text'
+done -eu test --verbose ${HOME} --verbose 'quoted text' sed 2>/dev/null
+${HOME} ${HOME} --verbose --verbose $(pwd) /usr/bin cd test
+	echo x=1 | "$@" 'quoted text' $(pwd) "$@" sed 2>/dev/null $(pwd) "$@" "$@"
+		export && local --verbose $(pwd) done done /usr/bin -eu awk done | x=1
+		awk local 'quoted text' awk && export
+		export cd 'quoted text' readonly grep done 2>/dev/null readonly
+	then cd grep grep local
+awk $(pwd) $(pwd) test /usr/bin test sed $(pwd) local -eu done then
+	x=1 -eu "$@" -eu local done 2>/dev/null awk grep "$1" 'quoted text' echo /usr/bin
+		done grep grep $(pwd) /usr/bin 2>/dev/null x=1 cd -eu echo awk cd cd readonly
+${HOME} -eu ${HOME} awk 2>/dev/null --verbose
+printf "$@" && readonly local test 2>/dev/null "$1"
+	| && | -eu x=1 "$1" /usr/bin export $(pwd) | test sed local --verbose readonly
+echo ${HOME} readonly printf | && | local cd "$@" echo
+/usr/bin readonly 2>/dev/null 'quoted text' 'quoted text' export awk cd "$@" 'quoted text'
+| $(pwd) test x=1 'quoted text'
+		${HOME} --verbose ${HOME}
+		"$@" -eu readonly grep export x=1
+	2>/dev/null echo 'quoted text' x=1 "$1" 2>/dev/null cd export
+		2>/dev/null x=1 -eu x=1 then -eu "$1" --verbose
+awk ${HOME} echo 2>/dev/null local then grep readonly "$@"
+	"$@" grep done | sed && 'quoted text' ${HOME}
+	--verbose printf then local
+"$1" then echo --verbose then awk done test x=1 "$1" grep readonly
+		printf then awk | awk | -eu $(pwd) 'quoted text' cd local cd sed
+		"$@" $(pwd) export done 'quoted text'
+	| local --verbose $(pwd) echo sed awk 2>/dev/null test readonly
+	/usr/bin 2>/dev/null done 'quoted text' grep grep
+		local ${HOME} test local ${HOME} x=1 | readonly "$1" echo /usr/bin /usr/bin "$@"
+		-eu 'quoted text' 2>/dev/null then test -eu test "$@" done test -eu x=1 cd then
+awk $(pwd) x=1 && echo readonly --verbose
+		then "$@" readonly done /usr/bin -eu --verbose 'quoted text'
+then sed cd printf awk --verbose
+&& ${HOME} -eu sed $(pwd) then 2>/dev/null printf sed printf
+		'quoted text' x=1 readonly x=1 printf sed test && 'quoted text' then
+		readonly 2>/dev/null test export local done "$1" --verbose
+		"$1" && done sed test "$@" /usr/bin
+/usr/bin then then printf /usr/bin
+		then $(pwd) ${HOME} ${HOME} 2>/dev/null | cd echo echo sed $(pwd) then ${HOME}
+2>/dev/null printf "$@" | then printf export grep -eu echo
+	&& --verbose then readonly
+		done $(pwd) $(pwd) done awk test "$@" export
+		sed sed readonly && --verbose awk sed sed 2>/dev/null local x=1
+"$1" 'quoted text' awk x=1 export readonly echo "$@" ${HOME} done export
+		| $(pwd) cd --verbose local test ${HOME} 'quoted text' grep
+$(pwd) awk export "$1" /usr/bin export 2>/dev/null echo "$@" /usr/bin
+--verbose echo echo printf echo echo "$1"
+	/usr/bin x=1 grep printf -eu ${HOME} cd test test ${HOME} 2>/dev/null export
+readonly 2>/dev/null 'quoted text' echo -eu /usr/bin -eu printf sed ${HOME}
+readonly awk echo awk x=1 then x=1 sed then -eu ${HOME} --verbose
+printf echo test "$@"
+	x=1 x=1 grep printf awk
+	"$1" sed test grep "$1" test -eu export && local sed export test cd 'quoted text'
+		then 2>/dev/null awk awk 'quoted text'
+		then sed printf awk "$@" "$@" --verbose local "$@" export
+	-eu | && test $(pwd) "$@" x=1 then echo $(pwd)
+	printf echo /usr/bin "$@" sed | sed local test 2>/dev/null | local --verbose
+export && then readonly awk grep readonly /usr/bin export "$@"
+	grep $(pwd) readonly then -eu sed grep
+	test | cd local sed /usr/bin /usr/bin "$1"
+	echo x=1 readonly 'quoted text'
+		&& $(pwd) export done x=1 "$1" echo test 'quoted text' $(pwd) printf x=1 ${HOME}
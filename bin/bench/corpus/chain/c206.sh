@@ -0,0 +1,2001 @@
+		done && printf echo done printf
+then && /usr/bin local $(pwd) ${HOME} $(pwd)
+	local && test echo -eu cd printf local && /usr/bin sed 2>/dev/null
+awk sed | --verbose sed readonly && done /usr/bin local grep printf
+	printf | sed && | | test "$@" ${HOME} ${HOME}
+/usr/bin "$@" grep 'quoted text' "$@" printf
+&& sed 2>/dev/null 'quoted text' echo printf
+	"$@" readonly then awk sed | | $(pwd)
+		export /usr/bin awk printf 'quoted text' --verbose
+	"$1" && ${HOME} export sed echo /usr/bin awk 2>/dev/null readonly cd "$@" sed
+		&& ${HOME} echo then then x=1 && sed grep /usr/bin $(pwd) 2>/dev/null
+		echo && cd grep done local $(pwd)
+		"$1" then export 2>/dev/null test readonly -eu --verbose
+&& x=1 "$1" readonly "$1" | awk 2>/dev/null export && done local awk test
+		local awk printf printf "$@" "$1" grep local export "$1" cd
+		"$1" $(pwd) ${HOME} readonly then $(pwd) export /usr/bin
+		x=1 --verbose --verbose x=1 grep 'quoted text' "$@" | cd then
+	local cd "$@" then readonly
+	2>/dev/null -eu sed && printf --verbose grep
+	printf done | printf cd | grep /usr/bin done local printf
+${HOME} local $(pwd) export -eu 'quoted text' local done readonly
+		&& readonly /usr/bin echo then 2>/dev/null export --verbose awk $(pwd) done
+	-eu grep local readonly printf printf grep sed echo
+/usr/bin printf -eu local cd local test echo "$@" grep
+		local readonly printf 2>/dev/null local done readonly
+	cd sed x=1 && export grep 'quoted text'
+${HOME} readonly test 'quoted text'
+	${HOME} printf export cd grep cd --verbose && ${HOME} printf local 2>/dev/null
+		"$1" awk grep export $(pwd) && test | --verbose awk
+x=1 local /usr/bin readonly
+		cd done awk done | test ${HOME} readonly cd -eu cd local printf "$@" /usr/bin
+	local test readonly echo $(pwd) "$@" "$1" x=1 x=1 2>/dev/null readonly
+		printf && local 'quoted text' export -eu awk "$@" local cd
+$(pwd) x=1 "$1" echo readonly sed && "$@" then
+/usr/bin printf ${HOME} cd local export readonly x=1 "$1" export -eu x=1
+	done test "$1" "$1" echo
+	/usr/bin test local done sed 2>/dev/null 'quoted text' test
+		export readonly cd ${HOME} readonly local grep sed
+	done readonly 2>/dev/null -eu | "$1" sed /usr/bin 2>/dev/null awk 2>/dev/null &&
+		local sed "$@" awk "$1" echo | sed
+--verbose --verbose readonly $(pwd) local awk sed
+		| then printf echo | $(pwd) ${HOME} echo --verbose && export 'quoted text'
+&& /usr/bin /usr/bin 'quoted text' -eu sed ${HOME} readonly 'quoted text' export
+	| readonly awk echo then "$1" "$1"
+		export 2>/dev/null cd sed 'quoted text' x=1 && && $(pwd) readonly awk sed --verbose
+		/usr/bin $(pwd) cd echo sed "$1" && 'quoted text' done local
+		local 2>/dev/null 2>/dev/null cd awk x=1 echo local awk local readonly &&
+	grep done x=1 then sed --verbose
+		$(pwd) echo | done test ${HOME}
+		done "$@" --verbose sed x=1 done grep cd --verbose
+		grep done export echo export "$1" printf $(pwd) awk done
+		grep export ${HOME} printf printf 2>/dev/null
+		awk printf --verbose "$@" 'quoted text'
+grep grep done test x=1 "$1" awk "$1" -eu /usr/bin
+readonly && cd local done printf
+	done 2>/dev/null awk && 'quoted text' echo echo ${HOME} | readonly "$1"
+	printf then | printf 2>/dev/null | x=1 --verbose
+echo test awk $(pwd)
+		"$1" 'quoted text' test -eu -eu
+	"$@" export --verbose 'quoted text' 'quoted text' grep export
+		printf /usr/bin test test ${HOME} "$@" awk ${HOME}
+printf done ${HOME} cd "$1" "$@" $(pwd) echo awk printf printf
+		then 'quoted text' sed test grep -eu 2>/dev/null sed printf
+done sed echo cd printf | -eu awk then && echo --verbose
+printf done echo sed printf | 2>/dev/null
+		test --verbose | /usr/bin x=1 "$1" && &&
+	"$@" -eu readonly awk cd 'quoted text' --verbose cd test
+2>/dev/null "$1" -eu readonly printf echo echo awk
+sed $(pwd) && 2>/dev/null cd -eu sed "$1" "$1" grep |
+cd "$1" grep && done 'quoted text' $(pwd) && echo local /usr/bin printf grep
+	readonly printf echo awk 2>/dev/null && x=1 ${HOME} done
+echo -eu --verbose "$1" sed readonly "$@" done echo
+		| 'quoted text' 2>/dev/null "$@" ${HOME}
+export printf -eu export ${HOME} awk x=1 'quoted text' --verbose "$@" | printf
+		then ${HOME} test readonly 2>/dev/null | --verbose
+	awk 2>/dev/null --verbose then export
+| /usr/bin ${HOME} /usr/bin export
+done local cd test cd printf ${HOME} readonly -eu grep 2>/dev/null readonly x=1
+		echo then 'quoted text' awk &&
+	export test -eu -eu done done
+		-eu | ${HOME} grep grep export ${HOME} --verbose "$1" printf $(pwd) cd
+	echo 2>/dev/null grep /usr/bin "$@" /usr/bin then x=1 x=1 && awk done |
+	then done export printf $(pwd) x=1 awk 2>/dev/null grep
+		| cd awk echo && then "$@"
+	x=1 local x=1 cd -eu /usr/bin
+	$(pwd) x=1 readonly /usr/bin test then 2>/dev/null
+	'quoted text' x=1 sed readonly | -eu sed && cd local 'quoted text' 2>/dev/null printf
+	&& 2>/dev/null cd "$@" local ${HOME}
+"$1" x=1 "$@" "$1" /usr/bin -eu --verbose -eu 'quoted text' "$1" 2>/dev/null
+export "$@" readonly "$1" local cd done cd --verbose /usr/bin test /usr/bin
+	x=1 ${HOME} --verbose $(pwd) -eu grep 2>/dev/null
+		${HOME} "$@" 'quoted text' done sed grep done && --verbose $(pwd)
+	export local | test printf grep then local awk | test "$1" ${HOME}
+--verbose x=1 awk 2>/dev/null --verbose x=1 'quoted text' 'quoted text' x=1
+		| echo x=1 export "$@" cd "$1" readonly && done
+-eu echo && | "$1" test export export --verbose "$1" "$1" local local printf x=1
+	test "$1" /usr/bin sed then --verbose
+cd printf local "$1" | x=1 sed -eu | 'quoted text' 'quoted text'
+	printf /usr/bin ${HOME} then then export
+	/usr/bin ${HOME} echo export && x=1 test && test "$@" test awk "$1"
+	awk cd grep --verbose
+		grep | --verbose $(pwd) test done x=1 cd sed ${HOME} readonly $(pwd)
+'quoted text' printf x=1 test grep
+	2>/dev/null awk 'quoted text'
+	awk readonly sed test "$1" "$@" 2>/dev/null "$1" readonly
+x=1 | && then x=1 x=1 "$@" echo /usr/bin
+	cd -eu --verbose ${HOME} x=1 'quoted text' ${HOME} 2>/dev/null export "$@"
+	local local /usr/bin echo $(pwd) | readonly ${HOME} 2>/dev/null
+	echo && | cd readonly export readonly ${HOME} sed sed --verbose readonly
+	echo 2>/dev/null && "$@" $(pwd)
+/usr/bin $(pwd) | printf test echo /usr/bin
+echo --verbose test -eu readonly
+	local /usr/bin test "$1" 2>/dev/null awk "$@" | done
+		cd sed then printf $(pwd)
+		"$1" x=1 awk $(pwd) printf 'quoted text'
+	grep printf cd x=1 --verbose test done
+sed --verbose then "$@" local
+'quoted text' --verbose
+"$1" 2>/dev/null printf awk x=1 "$1"
+	-eu x=1 test done $(pwd) export
+		--verbose -eu /usr/bin 2>/dev/null
+local cd export cd readonly export "$@" then && 2>/dev/null grep awk | 'quoted text'
+x=1 readonly $(pwd) local && 'quoted text' ${HOME} -eu x=1 then readonly
+$(pwd) export "$1" "$@" | --verbose
+cd readonly $(pwd) echo done "$1" -eu echo sed
+	echo -eu local 'quoted text' "$1" 2>/dev/null local --verbose /usr/bin ${HOME}
+		--verbose printf then test grep printf printf awk local readonly then
+		--verbose 2>/dev/null | --verbose done 'quoted text' && then x=1
+		export /usr/bin awk 'quoted text' "$@" awk
+	'quoted text' printf 2>/dev/null then printf 'quoted text'
+		2>/dev/null readonly -eu
+&& grep cd then cd grep then
+	&& | "$@" done sed "$@" 2>/dev/null x=1 awk /usr/bin 'quoted text' ${HOME}
+	--verbose sed "$1" export sed echo | done cd test -eu local echo /usr/bin
+	cd awk 2>/dev/null && -eu then 2>/dev/null then "$1" $(pwd) grep
+x=1 readonly --verbose grep done readonly -eu -eu then export x=1 awk
+2>/dev/null -eu x=1 sed then 'quoted text' "$@"
+		x=1 x=1 "$1" then cd printf
+	'quoted text' "$1" && local
+		-eu export $(pwd) local 'quoted text'
+local 'quoted text' -eu --verbose echo done printf "$1" sed $(pwd) /usr/bin
+	x=1 echo export echo test /usr/bin grep /usr/bin --verbose printf
+		-eu -eu x=1 && export "$1" awk --verbose 'quoted text' 2>/dev/null test
+		--verbose --verbose | -eu then awk export readonly "$1" x=1 -eu 'quoted text'
+		&& 2>/dev/null echo /usr/bin echo then /usr/bin /usr/bin export "$1"
+echo then --verbose sed echo echo grep $(pwd) awk local 2>/dev/null -eu awk
+"$1" local x=1 printf && printf local local sed
+${HOME} printf grep "$@" $(pwd) test $(pwd)
+		grep 2>/dev/null test done readonly
+| done then export && x=1 x=1 printf | "$1" | --verbose
+export && "$@" $(pwd) ${HOME} 2>/dev/null then "$@"
+	x=1 printf $(pwd) done ${HOME} /usr/bin grep x=1 $(pwd) awk local awk
+	&& printf 2>/dev/null 2>/dev/null cd "$1" then /usr/bin
+	"$1" | local cd -eu 'quoted text' | export
+		&& && printf grep cd /usr/bin -eu /usr/bin | then
+	grep x=1 echo "$@" sed "$@" awk && done printf 'quoted text'
+		printf cd echo export export export -eu x=1 grep | "$1" sed cd --verbose
+then echo $(pwd) export sed sed 2>/dev/null export
+awk 2>/dev/null readonly awk $(pwd) x=1 printf ${HOME} /usr/bin
+	--verbose echo 2>/dev/null local printf then export
+	local && cd export readonly cd then "$@" && ${HOME}
+	$(pwd) sed && /usr/bin | 2>/dev/null cd readonly | "$1" export awk
+	$(pwd) export --verbose | done 2>/dev/null "$@" export
+		test then ${HOME} printf | sed sed done ${HOME} /usr/bin --verbose cd x=1 local
+then && 2>/dev/null echo 'quoted text' 'quoted text'
+		done 'quoted text' "$1" awk x=1 readonly
+cd sed done x=1 x=1 /usr/bin
+	/usr/bin --verbose printf awk cd cd "$@" && done grep /usr/bin sed x=1 readonly
+then | awk | ${HOME} "$@" printf local --verbose grep awk x=1
+		'quoted text' | "$@" && 'quoted text'
+sed echo | echo "$1" 'quoted text' export printf test test /usr/bin local
+		/usr/bin done "$@" "$1" | then -eu ${HOME} readonly
+		then local then printf --verbose "$1"
+readonly done /usr/bin ${HOME} done --verbose | |
+	done readonly -eu echo
+${HOME} export -eu done done
+	readonly && $(pwd) "$@" awk readonly ${HOME} test done 'quoted text'
+export test $(pwd) grep test echo
+		${HOME} done "$1" ${HOME} && | "$1" export x=1 export "$@" export grep
+	local x=1 && printf test 'quoted text' 'quoted text'
+"$1" 'quoted text' 'quoted text' "$@" awk local
+awk cd local ${HOME} echo && printf test grep 2>/dev/null readonly
+printf x=1 ${HOME} x=1 ${HOME} 2>/dev/null
+	readonly echo && | readonly then -eu cd local export export grep
+done readonly readonly cd x=1 && readonly
+echo printf "$@" && 2>/dev/null 2>/dev/null 2>/dev/null $(pwd) -eu 2>/dev/null
+	cd /usr/bin done then $(pwd) -eu "$@" | | done printf
+	--verbose echo "$@" | "$@" grep export /usr/bin
+sed x=1 -eu sed x=1 /usr/bin
+	&& local readonly "$@" echo done local | "$@" grep "$@" ${HOME} readonly
+	| cd then grep 'quoted text' | test then done
+	cd then grep x=1 grep
+readonly readonly --verbose --verbose awk awk test "$@" export echo test
+		echo "$1" $(pwd) sed x=1 && --verbose -eu test export "$@" && | &&
+cd sed ${HOME} "$@" cd 2>/dev/null "$@" --verbose $(pwd)
+	sed --verbose test /usr/bin
+${HOME} then ${HOME} sed local $(pwd) $(pwd) "$@" 'quoted text' -eu
+	cd --verbose awk -eu local sed export x=1 'quoted text' "$1" local x=1 local
+${HOME} then "$@" --verbose test x=1 export
+printf local printf --verbose cd cd && sed then test grep | sed export ${HOME}
+		${HOME} "$@" 'quoted text' readonly
+	${HOME} then awk sed /usr/bin 2>/dev/null ${HOME} printf ${HOME} -eu echo 'quoted text'
+"$@" "$1" | printf "$1" /usr/bin done ${HOME} 'quoted text' grep 'quoted text'
+		&& grep local && readonly grep "$@"
+		${HOME} readonly $(pwd)
+readonly cd ${HOME} 'quoted text' export cd test
+		$(pwd) export export x=1 2>/dev/null /usr/bin 'quoted text' 2>/dev/null
+		local 2>/dev/null -eu -eu -eu cd -eu local
+	'quoted text' -eu 'quoted text' 2>/dev/null readonly x=1
+	"$1" $(pwd) readonly 'quoted text' awk 2>/dev/null grep "$1" -eu
+		grep "$@" $(pwd) export test 'quoted text' 2>/dev/null -eu awk
+		echo echo 'quoted text' done /usr/bin ${HOME}
+		done test local $(pwd) --verbose
+	&& printf export ${HOME} then printf
+sed 2>/dev/null /usr/bin $(pwd) readonly
+	"$@" export done --verbose export | readonly ${HOME}
+		$(pwd) done 'quoted text'
+$(pwd) export printf export
+echo export -eu --verbose then
+${HOME} export grep -eu
+	x=1 cd then ${HOME} then /usr/bin $(pwd) test test --verbose test
+	$(pwd) printf 2>/dev/null | x=1
+printf && "$1" then | | x=1 readonly local "$1" x=1 | $(pwd)
+		echo 'quoted text' --verbose printf
+		sed then | echo local cd "$1" && | ${HOME} "$1"
+test 2>/dev/null readonly test "$@" sed 2>/dev/null then 'quoted text' done test
+export printf echo /usr/bin
+		2>/dev/null cd --verbose local ${HOME}
+	awk --verbose printf local sed readonly -eu "$1"
+		done x=1 then printf "$@" | "$1" test grep readonly awk printf cd $(pwd)
+		sed printf && echo export printf echo echo ${HOME} echo 2>/dev/null
+		x=1 printf local test | "$1" 2>/dev/null echo local printf printf -eu then x=1
+'quoted text' 2>/dev/null readonly /usr/bin local readonly "$1" /usr/bin | echo
+--verbose grep echo cd test /usr/bin $(pwd)
+	test && grep x=1 awk --verbose printf -eu -eu -eu
+		'quoted text' x=1 printf done local cd echo "$1"
+		readonly && grep echo awk -eu test printf awk then
+	export "$1" | | /usr/bin && $(pwd) printf local 'quoted text'
+	echo /usr/bin ${HOME} 'quoted text' export "$@" /usr/bin x=1
+		local && && export "$@" cd x=1 export export
+"$@" "$1" x=1 ${HOME} done test awk 'quoted text' printf -eu x=1 "$@"
+		2>/dev/null x=1 awk && grep echo x=1 && readonly $(pwd)
+$(pwd) readonly echo && echo cd then "$1" cd local test
+readonly 'quoted text'
+		-eu 2>/dev/null echo && && done 'quoted text' sed cd
+		echo | local cd /usr/bin done printf
+		'quoted text' --verbose sed done | echo test x=1
+-eu && $(pwd) cd test
+"$1" -eu | && 2>/dev/null ${HOME} "$1" "$@" test "$1" printf 2>/dev/null
+cd then ${HOME} then ${HOME}
+		"$@" ${HOME} echo sed 2>/dev/null
+		readonly "$@" | --verbose --verbose | readonly
+	export && cd | then "$@"
+	readonly cd 'quoted text' then
+	'quoted text' grep x=1 awk sed x=1 echo | /usr/bin test --verbose
+		printf 'quoted text' ${HOME} $(pwd) --verbose awk -eu readonly then "$1"
+readonly /usr/bin readonly -eu grep sed
+		| export ${HOME} -eu --verbose -eu $(pwd) cd
+then test readonly 'quoted text' /usr/bin | grep ${HOME} awk export export x=1
+cd | done cd printf 2>/dev/null awk 'quoted text' "$1" test echo
+| then printf --verbose echo echo readonly -eu "$1"
+grep test printf --verbose $(pwd) 2>/dev/null printf done ${HOME}
+	'quoted text' /usr/bin 2>/dev/null | done cd echo then printf && test printf
+readonly && -eu $(pwd) ${HOME} echo x=1 awk then -eu local export then test awk
+		cd ${HOME} local cd 'quoted text'
+	--verbose "$@" && done "$@" done $(pwd) readonly ${HOME} && -eu ${HOME} x=1 |
+		local readonly | --verbose $(pwd) export awk ${HOME} sed -eu x=1 'quoted text'
+'quoted text' grep local && "$1" /usr/bin readonly readonly
+		x=1 readonly echo then readonly
+'quoted text' | readonly | "$1" $(pwd) cd grep -eu ${HOME}
+'quoted text' then echo readonly done test "$1" done && x=1 awk export x=1
+		printf readonly 2>/dev/null 'quoted text' 2>/dev/null
+	echo test --verbose export | /usr/bin sed echo $(pwd) "$@" && | "$1" local
+		| "$@" cd readonly -eu echo && --verbose then
+	printf echo export --verbose
+		&& "$1" $(pwd) 2>/dev/null 2>/dev/null /usr/bin "$@"
+x=1 local /usr/bin done && "$@" -eu local
+echo sed export printf awk awk
+	local --verbose -eu printf $(pwd) awk /usr/bin export ${HOME} cd
+local /usr/bin "$1" cd 'quoted text' /usr/bin ${HOME}
+sed sed grep test echo awk 'quoted text'
+		-eu /usr/bin 'quoted text' ${HOME} --verbose x=1 'quoted text' test export
+&& --verbose $(pwd) -eu then 'quoted text' ${HOME} 2>/dev/null "$@" then x=1 --verbose
+	awk export then cd then "$1" 'quoted text' grep
+		cd | "$@" echo 2>/dev/null 'quoted text' export sed ${HOME} "$@" ${HOME}
+'quoted text' && /usr/bin test | sed cd --verbose && "$1" "$@"
+	awk "$1" grep test "$@" 'quoted text'
+	/usr/bin 'quoted text' "$@" sed | cd export
+| "$1" cd awk "$1" export local echo printf "$1" x=1 $(pwd) done cd test
+test export "$@" then x=1 grep | && "$@"
+		x=1 ${HOME} sed ${HOME} then local printf then
+&& && --verbose 2>/dev/null done grep 'quoted text'
+		--verbose "$@" ${HOME} done
+		| /usr/bin "$1" cd ${HOME} printf awk export x=1 test sed done 2>/dev/null
+	'quoted text' test echo --verbose
+	-eu local --verbose echo local "$@"
+$(pwd) awk grep 2>/dev/null
+--verbose 'quoted text' "$1" | 2>/dev/null && cd $(pwd) done
+		&& awk "$@" 'quoted text' --verbose echo && x=1 /usr/bin
+| awk sed "$@" x=1 "$@" 2>/dev/null printf "$1" 'quoted text'
+	"$1" --verbose "$1" -eu export cd sed 'quoted text' "$1"
+	-eu echo done "$@" ${HOME}
+		"$@" done cd cd /usr/bin awk 2>/dev/null "$1" $(pwd) cd "$@"
+	-eu then 'quoted text' then | printf done export
+	then $(pwd) printf $(pwd) readonly cd awk ${HOME} then 2>/dev/null then
+	grep printf cd && readonly test
+		x=1 local awk sed ${HOME} /usr/bin grep |
+		/usr/bin printf ${HOME} export | printf
+	| ${HOME} 2>/dev/null
+		cd 'quoted text' $(pwd) sed test --verbose then /usr/bin
+	sed /usr/bin local printf /usr/bin "$@" -eu ${HOME} x=1 "$@"
+		readonly --verbose grep local grep $(pwd) &&
+done ${HOME} /usr/bin 'quoted text' | ${HOME} test
+	'quoted text' | printf "$@"
+| echo /usr/bin && --verbose --verbose
+then readonly local 'quoted text' grep awk test awk
+	/usr/bin x=1 && 'quoted text' readonly awk readonly
+		sed -eu export then /usr/bin readonly local /usr/bin
+		--verbose then sed "$@" -eu && | printf local "$1" test echo 2>/dev/null
+	awk done awk ${HOME} done "$@" | | local export readonly | sed && x=1 printf
+		2>/dev/null local | awk /usr/bin echo echo cd
+"$1" --verbose ${HOME} $(pwd) --verbose
+	test --verbose "$@" "$@" echo x=1 $(pwd) -eu awk echo -eu sed echo -eu cd
+	local | grep done done "$@" export
+x=1 /usr/bin test export 2>/dev/null
+/usr/bin awk printf local then | local grep
+&& done sed then echo then then local local
+		"$1" ${HOME} readonly /usr/bin &&
+"$1" grep local 2>/dev/null awk local echo readonly --verbose x=1 'quoted text'
+cd $(pwd) ${HOME} done sed --verbose x=1 | /usr/bin
+		cd x=1 then local $(pwd)
+	readonly --verbose --verbose
+awk echo local ${HOME} export /usr/bin
+	cd awk then sed "$@" "$@" x=1 /usr/bin "$1" sed "$@" done $(pwd) then -eu
+/usr/bin sed 'quoted text' --verbose awk | | local
+	${HOME} echo "$@" ${HOME} -eu "$1" done export cd $(pwd) sed
+echo && grep --verbose awk ${HOME} ${HOME} $(pwd) ${HOME} printf
+	test printf echo cd local
+		done done /usr/bin x=1 cd test grep echo && grep awk printf "$1" && /usr/bin
+		$(pwd) local 'quoted text' local ${HOME} | x=1 then then --verbose
+	-eu $(pwd) echo then done awk --verbose x=1 awk -eu
+	$(pwd) grep -eu cd 'quoted text' awk 2>/dev/null
+		/usr/bin -eu ${HOME} grep "$@" --verbose done
+	export $(pwd) | then /usr/bin grep echo "$@" --verbose test /usr/bin ${HOME}
+${HOME} done local 'quoted text' "$1" test /usr/bin sed echo sed test $(pwd) "$1"
+| ${HOME} -eu then sed "$@" "$1" cd printf grep done $(pwd) cd /usr/bin local
+		--verbose --verbose echo 2>/dev/null export --verbose
+export /usr/bin sed -eu "$1" --verbose 'quoted text'
+		cd printf sed x=1 /usr/bin /usr/bin "$@" then
+		awk sed "$@" ${HOME} cd test then ${HOME} local grep "$1"
+	test echo awk x=1 test /usr/bin "$@" cd /usr/bin done
+	grep 'quoted text' ${HOME} done
+	--verbose 2>/dev/null && done $(pwd) | echo | ${HOME}
+		"$@" local "$1" | --verbose x=1 ${HOME} cd "$1" export
+		cd 'quoted text' -eu then cd then test x=1 printf test
+echo $(pwd) done | cd x=1 x=1 echo awk "$1" readonly
+		cd ${HOME} export --verbose 'quoted text' done test && export
+		'quoted text' test export awk
+		then cd | ${HOME} export -eu readonly | test 2>/dev/null
+grep printf 2>/dev/null /usr/bin grep grep
+	"$1" cd && awk -eu -eu && awk cd 2>/dev/null
+		${HOME} ${HOME} readonly /usr/bin 'quoted text'
+	&& $(pwd) ${HOME} sed local then x=1
+done -eu | then export | && 'quoted text' "$1" test export -eu "$@" export grep
+	echo "$@" printf sed --verbose $(pwd) --verbose 'quoted text'
+		then grep -eu 2>/dev/null "$@" local cd readonly done then 2>/dev/null "$1"
+	grep --verbose "$1" --verbose readonly awk --verbose
+		sed cd then "$@" done test
+echo | | local "$1" test 2>/dev/null grep readonly x=1 2>/dev/null grep x=1
+	&& | readonly printf ${HOME} && ${HOME} echo then "$1" local | then
+grep test ${HOME} ${HOME} $(pwd) -eu local 'quoted text' sed grep /usr/bin
+-eu readonly "$1" sed "$1"
+		/usr/bin | && echo then ${HOME} "$@" | echo
+	$(pwd) then $(pwd) cd done 2>/dev/null grep x=1 done awk cd --verbose
+&& && grep readonly awk grep then sed /usr/bin grep echo $(pwd) grep test grep done
+"$1" | "$@" awk sed x=1 local readonly 'quoted text' readonly
+		"$@" cd | readonly done echo --verbose export x=1 sed "$@" "$1" -eu sed 'quoted text'
+		${HOME} cd --verbose echo cd --verbose awk sed
+		x=1 sed "$1" cd | "$1"
+	cd -eu printf /usr/bin echo printf /usr/bin
+	--verbose readonly --verbose && then 'quoted text'
+		cd sed 'quoted text' /usr/bin
+		export printf readonly readonly ${HOME} test then local test export done --verbose
+	local x=1 cd sed then $(pwd) test /usr/bin --verbose awk "$1" /usr/bin
+		"$1" sed $(pwd) readonly test cd test echo "$1" x=1 awk
+		--verbose --verbose then | --verbose "$@" test $(pwd) 'quoted text'
+cd test cd 'quoted text' "$@" --verbose export 'quoted text' 2>/dev/null
+		'quoted text' then | export | cd sed ${HOME}
+readonly echo cd echo export awk export grep then done grep echo -eu -eu $(pwd)
+	awk echo x=1 readonly | cd ${HOME} | grep
+	"$1" && test then | /usr/bin printf | test 2>/dev/null -eu printf test echo 2>/dev/null
+		--verbose export /usr/bin then test local grep printf local
+x=1 /usr/bin "$1" "$1" cd && then "$1"
+		export export test && x=1 done local
+| export export "$@" --verbose
+	'quoted text' done printf
+	printf grep /usr/bin "$@" export readonly "$1" echo
+		'quoted text' $(pwd) && done awk "$@" test "$@" awk | done 'quoted text'
+		grep x=1 "$1" then 2>/dev/null sed
+		local echo ${HOME} 'quoted text' done $(pwd) x=1 echo -eu ${HOME} "$1" $(pwd)
+awk $(pwd) export x=1 'quoted text'
+	awk 2>/dev/null local --verbose --verbose -eu 2>/dev/null cd then
+sed then sed done awk "$@"
+	${HOME} export cd grep "$1" test done test
+	done local readonly -eu 'quoted text' ${HOME} export x=1 2>/dev/null $(pwd) --verbose
+2>/dev/null sed readonly then && printf 2>/dev/null
+		"$1" ${HOME} then $(pwd) done done grep -eu readonly ${HOME} $(pwd)
+		readonly --verbose && 'quoted text' echo
+	&& | export "$@" "$@" local && $(pwd) 'quoted text' | awk
+"$1" cd && test echo | printf ${HOME} grep local 2>/dev/null
+printf done grep done test x=1
+local then ${HOME} /usr/bin /usr/bin test grep export readonly
+-eu grep 2>/dev/null /usr/bin cd ${HOME}
+	echo $(pwd) local echo ${HOME} && grep x=1 cd 'quoted text' then awk "$@" 'quoted text'
+awk 2>/dev/null --verbose cd /usr/bin
+		grep then test 2>/dev/null $(pwd) local 'quoted text'
+	test /usr/bin sed awk
+printf && export cd && -eu && sed ${HOME} | readonly readonly
+		${HOME} printf -eu printf | /usr/bin echo --verbose
+"$@" 'quoted text' ${HOME} readonly cd /usr/bin
+	/usr/bin done 'quoted text' --verbose -eu
+		'quoted text' local -eu --verbose 2>/dev/null -eu echo "$@" "$@" 2>/dev/null
+		$(pwd) x=1 test then then
+		sed then export && "$@" 'quoted text' | local $(pwd) local export 2>/dev/null
+echo export | && printf echo
+		-eu 2>/dev/null printf test -eu /usr/bin export "$1"
+awk 2>/dev/null | done && -eu local && grep &&
+		export grep ${HOME} ${HOME} cd grep done /usr/bin export awk awk then
+	done export echo local readonly
+		printf "$@" readonly /usr/bin /usr/bin x=1 ${HOME} done /usr/bin
+cd done printf ${HOME} grep --verbose
+"$1" then echo "$@" sed sed printf awk local grep readonly then "$1" export
+echo local local test | -eu cd grep
+-eu printf cd "$1" done export && "$@" 2>/dev/null sed sed
+| x=1 "$1" 2>/dev/null readonly then
+	sed && export local grep 'quoted text' printf cd "$1" sed $(pwd)
+awk echo "$@" sed x=1 echo export then grep 'quoted text' &&
+		--verbose x=1 grep x=1 sed | "$1" $(pwd) sed 'quoted text'
+	| echo x=1 grep | --verbose /usr/bin 'quoted text' awk "$1" export grep
+${HOME} ${HOME} x=1 /usr/bin readonly grep 'quoted text' then cd 'quoted text'
+	then then -eu --verbose "$1" 'quoted text'
+		"$@" export $(pwd) export /usr/bin local export done && 'quoted text'
+		sed /usr/bin x=1 awk 'quoted text'
+		"$1" echo done export x=1 $(pwd) /usr/bin "$1"
+		&& 'quoted text' awk awk -eu printf done 'quoted text' && test
+		/usr/bin test /usr/bin echo echo "$@" x=1 local "$@" ${HOME} sed export
+printf && /usr/bin awk --verbose echo && cd export test -eu && sed awk sed
+"$@" readonly done "$@" test "$@" --verbose
+"$1" printf /usr/bin "$@" x=1 ${HOME} sed echo 'quoted text' awk printf local ${HOME}
+	&& "$1" 'quoted text' printf readonly ${HOME} $(pwd)
+		printf "$@" local | $(pwd) 'quoted text' /usr/bin "$1"
+	printf x=1 readonly grep export cd
+"$@" grep cd cd export $(pwd) then done sed
+done export $(pwd) sed "$@" echo /usr/bin done done
+		test "$@" then done done --verbose "$@" x=1 'quoted text' echo readonly awk
+	/usr/bin --verbose printf --verbose sed printf then $(pwd) && "$1" done then 2>/dev/null
+		2>/dev/null $(pwd) --verbose /usr/bin -eu awk echo readonly test echo
+		-eu | cd awk "$1" readonly | "$1" --verbose $(pwd)
+	x=1 done $(pwd) 2>/dev/null 2>/dev/null "$1" "$@" ${HOME}
+	sed cd export ${HOME} readonly done "$@" local
+done printf echo printf cd /usr/bin --verbose ${HOME}
+		${HOME} --verbose --verbose grep 2>/dev/null printf /usr/bin
+	$(pwd) readonly export local echo test /usr/bin
+		test sed "$1" ${HOME} grep done test "$@" --verbose
+	cd printf sed cd -eu | 'quoted text' | x=1 export 'quoted text'
+		readonly 'quoted text' then done test done $(pwd) && "$@"
+	${HOME} "$@" then ${HOME}
+	--verbose --verbose test export x=1 test -eu then cd echo test export done
+		| readonly /usr/bin readonly
+		local sed 2>/dev/null export -eu -eu test --verbose
+		cd done awk /usr/bin "$1" "$1" && 'quoted text' grep awk && echo
+		test test "$1" readonly test ${HOME}
+	'quoted text' local sed -eu done sed
+test $(pwd) done then printf local printf export 'quoted text' 2>/dev/null printf
+&& export export done "$@" local printf
+| grep ${HOME} readonly done sed | &&
+		cd /usr/bin then "$1" echo awk && 'quoted text'
+		${HOME} | "$@" echo then --verbose ${HOME}
+		echo printf "$@" "$@" export && | grep cd
+		-eu then export then 'quoted text' cd && local x=1 local 'quoted text'
+	/usr/bin x=1 sed local test test | local test -eu cd -eu -eu "$@" "$@" sed "$@"
+&& x=1 printf sed --verbose echo -eu test
+		cd grep cd "$1" | -eu printf
+$(pwd) then printf x=1 | 2>/dev/null && ${HOME} test | printf done echo then
+		&& printf "$@" 'quoted text' test sed 'quoted text' echo
+	done done sed "$1" export 2>/dev/null
+export "$@" x=1 test "$1" "$@"
+	-eu test --verbose /usr/bin $(pwd)
+	printf 'quoted text' "$1" printf grep ${HOME} done $(pwd) test $(pwd)
+		local --verbose echo 'quoted text' done /usr/bin done awk awk "$@" export test 'quoted text'
+	"$@" x=1 | then readonly x=1 awk 'quoted text' cd x=1 2>/dev/null
+		$(pwd) export ${HOME} && then --verbose
+	x=1 ${HOME} export ${HOME} | --verbose echo "$@" readonly x=1 awk && /usr/bin
+	'quoted text' /usr/bin local $(pwd) "$1" local printf | /usr/bin 2>/dev/null
+	$(pwd) ${HOME} export | "$1" | cd --verbose && cd 'quoted text' sed printf /usr/bin
+awk sed --verbose readonly 2>/dev/null && 2>/dev/null local
+		&& 'quoted text' /usr/bin "$1" local cd "$@" then
+		cd sed 'quoted text' printf 'quoted text' | && "$@" /usr/bin local
+	$(pwd) | test "$1" awk $(pwd)
+	echo grep && "$@" grep test sed sed done
+/usr/bin --verbose && printf awk grep /usr/bin
+| "$1" awk printf sed printf ${HOME} readonly x=1 "$@"
+	printf readonly grep "$@" grep printf $(pwd) done readonly
+	--verbose $(pwd) 'quoted text' ${HOME} x=1 'quoted text' --verbose /usr/bin
+-eu x=1 done /usr/bin 2>/dev/null "$1" "$@" awk export
+	awk && export cd ${HOME} -eu echo export 2>/dev/null
+	cd | /usr/bin cd 2>/dev/null -eu 2>/dev/null
+-eu $(pwd) test then sed printf x=1 grep -eu
+	echo 2>/dev/null export cd 2>/dev/null readonly $(pwd) "$@" ${HOME}
+		grep printf printf then readonly 'quoted text' x=1 done -eu /usr/bin
+	${HOME} | awk | export 'quoted text'
+	done readonly cd cd printf readonly export
+	then ${HOME} sed test then 'quoted text' $(pwd) then then cd cd sed grep awk
+		then "$1" printf test ${HOME} /usr/bin "$1" --verbose grep sed 2>/dev/null echo
+	--verbose test done done | 2>/dev/null && | grep
+	sed | printf 'quoted text' x=1 | readonly && test then then sed 2>/dev/null
+	/usr/bin --verbose && export $(pwd) | | grep x=1 "$1" awk $(pwd) printf
+		x=1 'quoted text' local readonly -eu printf
+grep ${HOME} sed /usr/bin ${HOME} test ${HOME} awk readonly grep /usr/bin sed $(pwd)
+$(pwd) 2>/dev/null --verbose export && -eu printf then grep
+		$(pwd) "$1" -eu && && test readonly | grep | done
+2>/dev/null 'quoted text'
+	grep 2>/dev/null "$1" --verbose x=1 $(pwd) 2>/dev/null then printf --verbose
+		/usr/bin 'quoted text' readonly grep $(pwd) export done -eu sed then --verbose
+		$(pwd) x=1 readonly cd awk readonly local -eu then
+	sed -eu cd $(pwd) done "$@" --verbose then | "$1" grep --verbose awk local sed
+		cd $(pwd) && local printf /usr/bin readonly printf --verbose readonly
+grep x=1 awk cd x=1 local test awk "$@" x=1 ${HOME} -eu echo --verbose
+	awk x=1 sed awk echo local | $(pwd) && && 'quoted text' x=1
+	done then sed export x=1 /usr/bin
+printf ${HOME} && done printf
+	-eu grep -eu x=1 'quoted text'
+		x=1 local ${HOME} ${HOME} echo && awk x=1 ${HOME} awk
+2>/dev/null printf -eu -eu && then echo test && sed x=1 --verbose cd x=1 export
+		printf export done readonly --verbose then
+		"$@" test -eu --verbose readonly /usr/bin
+		echo local awk | printf
+		local "$@" "$@" echo test sed 2>/dev/null && printf -eu -eu ${HOME} export
+$(pwd) 'quoted text' 2>/dev/null
+	export grep sed | cd then $(pwd) ${HOME} x=1 | awk cd "$@" -eu
+	export awk --verbose readonly x=1
+	export awk "$1" | && "$@" sed --verbose grep sed 2>/dev/null local --verbose -eu
+grep export | /usr/bin ${HOME} 'quoted text' 2>/dev/null test test --verbose echo
+		x=1 test local | test printf readonly "$@" awk "$@" && export --verbose
+export x=1 cd echo test
+	$(pwd) 'quoted text' && export local
+x=1 "$1" echo --verbose cd sed grep ${HOME} --verbose then 'quoted text'
+		grep x=1 echo echo $(pwd) /usr/bin 'quoted text' ${HOME} --verbose then local awk
+--verbose $(pwd) export test ${HOME} local echo -eu cd --verbose
+	${HOME} 'quoted text' cd /usr/bin grep sed sed
+done ${HOME} then readonly 2>/dev/null export && 'quoted text'
+		echo then readonly printf
+cd awk printf | cd | echo --verbose
+	| awk export local then 2>/dev/null
+	awk test "$@" printf
+readonly 'quoted text' "$1" x=1 sed && export
+-eu /usr/bin awk /usr/bin | then then | ${HOME} local | sed done 'quoted text'
+local printf x=1 echo local local awk "$1" printf done -eu then printf
+	sed awk "$1" 2>/dev/null ${HOME}
+sed printf --verbose local && 'quoted text' awk | awk "$1" grep
+	test ${HOME} /usr/bin ${HOME} export "$1" $(pwd)
+cd cd /usr/bin | printf 'quoted text' 2>/dev/null sed
+	readonly grep sed printf ${HOME} then local x=1 "$@" 2>/dev/null readonly
+		test 'quoted text' sed 'quoted text' grep export
+	'quoted text' test local awk "$1"
+		local -eu done | readonly "$1" ${HOME} 2>/dev/null x=1 x=1 sed /usr/bin awk
+'quoted text' export | | 'quoted text' -eu "$1" sed $(pwd) echo done echo "$@"
+	"$1" readonly --verbose && "$@" && grep readonly echo
+echo "$@" then $(pwd) "$@" local $(pwd) awk ${HOME} awk | printf && sed
+	/usr/bin --verbose "$1" echo grep readonly "$@" cd "$1"
+		readonly grep test && "$@" test /usr/bin $(pwd) cd printf "$1" then 2>/dev/null
+	printf test echo sed $(pwd) cd done --verbose test echo
+	then export awk cd cd readonly 2>/dev/null export awk 'quoted text'
+		2>/dev/null -eu sed readonly done then | readonly awk awk $(pwd) cd x=1 export
+local grep 2>/dev/null ${HOME} "$@" x=1
+	grep export 'quoted text' done printf test export
+		/usr/bin test done x=1 ${HOME} test && local grep && local | echo
+| test "$1" x=1 grep "$1" "$1" "$@" local printf
+		local && "$1" export export done "$1" -eu export local
+	/usr/bin x=1 then "$1" ${HOME} $(pwd) printf then
+	sed cd $(pwd) -eu printf
+		readonly then "$1" sed export $(pwd) --verbose done printf printf readonly
+export done ${HOME} && readonly
+2>/dev/null /usr/bin ${HOME} && | && test -eu local cd done
+	x=1 export printf test grep echo
+sed awk test readonly /usr/bin cd echo
+	| done "$1" then readonly 2>/dev/null echo x=1 grep 2>/dev/null local cd 'quoted text'
+	export awk awk printf 'quoted text'
+	grep 'quoted text' echo awk "$1" ${HOME} printf "$@" sed done grep
+"$@" "$1" "$1" 2>/dev/null done readonly local x=1 $(pwd) sed done
+	sed export && -eu /usr/bin cd grep --verbose --verbose done done awk grep awk |
+/usr/bin | ${HOME} awk echo "$@" done -eu
+sed export | -eu x=1 "$@" export "$@" 'quoted text'
+	${HOME} "$@" -eu echo x=1
+	test $(pwd) cd sed "$@" printf "$1" local | local "$@" cd x=1
+export 2>/dev/null done && printf "$1" export 'quoted text' readonly x=1 readonly
+		'quoted text' /usr/bin local "$1" "$@" cd printf
+		then "$@" local export ${HOME} printf --verbose printf
+export -eu printf printf readonly "$1" echo 'quoted text' done
+		awk && $(pwd) -eu test cd
+		--verbose ${HOME} ${HOME} --verbose export local
+	/usr/bin ${HOME} readonly $(pwd) 'quoted text' /usr/bin ${HOME}
+x=1 echo /usr/bin echo echo "$@" && export 'quoted text' x=1 2>/dev/null
+"$@" then test --verbose x=1 cd --verbose -eu then readonly
+test --verbose then export /usr/bin
+	grep test "$1" | /usr/bin | sed grep test echo sed | export "$1" cd
+	done /usr/bin x=1 && && done grep 'quoted text' printf 'quoted text'
+	test sed | "$@" cd export "$1" -eu &&
+	export done cd echo sed test readonly x=1 /usr/bin grep $(pwd)
+	export test x=1 --verbose x=1 x=1 test && awk grep /usr/bin 2>/dev/null
+	/usr/bin local 'quoted text' "$@" readonly sed readonly --verbose
+export "$1" --verbose then export local
+	'quoted text' export local then 2>/dev/null
+awk then $(pwd) sed -eu && readonly test 2>/dev/null 2>/dev/null "$@" && sed
+	--verbose printf "$1" "$@" 2>/dev/null 2>/dev/null done "$@" /usr/bin -eu |
+	"$@" echo export /usr/bin
+	printf grep --verbose /usr/bin && then | 2>/dev/null
+		"$1" "$@" x=1 sed awk cd grep | then ${HOME} 2>/dev/null
+	awk --verbose printf sed 2>/dev/null cd 2>/dev/null "$1" echo
+"$@" && /usr/bin cd "$@" done awk printf "$1" | "$@"
+export grep grep cd "$1"
+		/usr/bin | cd cd cd ${HOME} awk "$1" "$@" then awk "$1" sed echo --verbose
+readonly cd printf "$@" cd &&
+	sed then test x=1 2>/dev/null | 'quoted text'
+		echo test ${HOME} /usr/bin "$1" $(pwd) grep readonly awk local && done readonly
+	echo "$1" $(pwd) local --verbose test echo awk grep awk
+${HOME} echo && printf echo 'quoted text' | readonly -eu sed $(pwd) 'quoted text'
+	${HOME} export local x=1 --verbose 2>/dev/null && && --verbose
+readonly then 'quoted text' grep
+	/usr/bin awk awk sed cd -eu && 2>/dev/null --verbose x=1 grep 'quoted text'
+--verbose local /usr/bin | $(pwd) printf ${HOME} awk /usr/bin
+	printf "$1" printf x=1 done test ${HOME} -eu | -eu
+		readonly grep x=1 $(pwd) cd test | --verbose sed grep && cd awk --verbose
+		--verbose done | sed $(pwd) 2>/dev/null /usr/bin
+	then 'quoted text' | --verbose x=1 then x=1 done ${HOME} && && printf /usr/bin
+readonly --verbose done "$1" | && -eu 2>/dev/null "$@" "$@" -eu x=1 local
+	local awk "$1" test printf export done /usr/bin 'quoted text'
+	'quoted text' sed cd -eu --verbose
+	"$1" cd && /usr/bin printf grep grep 'quoted text' 'quoted text' printf
+export $(pwd) 2>/dev/null sed printf 2>/dev/null printf /usr/bin
+	"$1" grep grep done /usr/bin
+		echo printf echo x=1 | grep --verbose cd ${HOME} cd --verbose echo grep
+		${HOME} readonly 2>/dev/null test then ${HOME} printf "$@" awk ${HOME}
+	&& test readonly local 'quoted text'
+test test "$1" export -eu then
+		grep && 2>/dev/null awk cd /usr/bin sed /usr/bin
+| -eu "$1" grep "$@" echo
+	x=1 then 2>/dev/null grep export sed 2>/dev/null | && x=1
+		$(pwd) export test $(pwd) test x=1 sed awk local /usr/bin 2>/dev/null export
+		grep done ${HOME} then printf "$@" "$@" "$1"
+	--verbose /usr/bin 2>/dev/null 'quoted text' x=1
+	cd export echo && 2>/dev/null grep export && && 2>/dev/null
+		grep export local printf && --verbose cd "$@"
+	${HOME} test export test grep readonly
+		echo readonly /usr/bin x=1 done done ${HOME} then 2>/dev/null awk
+		done then 2>/dev/null && "$1" --verbose && && sed -eu 'quoted text' "$1"
+done x=1 'quoted text' 'quoted text' echo 2>/dev/null
+	--verbose 'quoted text' "$1" --verbose 'quoted text' done export
+awk "$@" --verbose done sed 'quoted text' local
+	x=1 $(pwd) x=1 ${HOME} export "$1" --verbose grep cd cd readonly
+		export grep 'quoted text' --verbose local cd
+&& readonly readonly test local && "$1" grep && sed ${HOME} 2>/dev/null
+		${HOME} test export done $(pwd) $(pwd) sed &&
+--verbose export --verbose grep printf | done awk awk && grep then
+$(pwd) then sed && --verbose cd && awk && "$@" then local awk echo "$@" awk echo
+local printf | x=1 awk ${HOME} 'quoted text' printf && x=1 then -eu | readonly
+	'quoted text' /usr/bin printf
+		${HOME} ${HOME} 'quoted text' 'quoted text' sed ${HOME} export 2>/dev/null sed test
+/usr/bin sed test 'quoted text' sed export readonly ${HOME} $(pwd) --verbose
+		"$@" "$@" $(pwd) -eu 2>/dev/null test local cd 'quoted text'
+	done | readonly | awk test awk local echo -eu
+'quoted text' cd then /usr/bin "$@" test printf &&
+		&& 2>/dev/null cd export test readonly --verbose
+${HOME} x=1 | && readonly "$@"
+	-eu ${HOME} cd "$@" readonly then -eu 2>/dev/null printf
+		2>/dev/null $(pwd) printf 2>/dev/null grep local && readonly
+		"$1" local $(pwd) export sed readonly done test sed printf $(pwd) 'quoted text'
+	cd x=1 /usr/bin cd then grep "$1" --verbose then then sed local grep export
+		test && export then echo --verbose 'quoted text' sed printf ${HOME}
+done cd echo 'quoted text'
+cd && sed && "$@" awk $(pwd) export $(pwd)
+cd | done /usr/bin test $(pwd)
+	'quoted text' ${HOME} readonly "$@" "$@" cd "$@" --verbose
+local test -eu printf 2>/dev/null echo
+local cd export --verbose readonly then && awk $(pwd)
+		cd test /usr/bin awk local "$1" && ${HOME} | "$@" then
+"$@" local ${HOME} /usr/bin export sed test
+${HOME} test /usr/bin /usr/bin | "$1" sed $(pwd) && -eu 'quoted text'
+	-eu local awk "$1" then then cd readonly cd /usr/bin ${HOME}
+'quoted text' "$@" printf --verbose
+		"$1" then readonly --verbose awk cd export awk sed ${HOME} local -eu then
+	cd echo cd "$1" export && readonly test test && local cd local
+	-eu grep sed printf readonly 2>/dev/null -eu 'quoted text' cd done
+		echo export --verbose awk test
+	cd export printf sed cd && readonly
+	2>/dev/null export "$1" readonly "$1"
+$(pwd) export "$@" --verbose
+sed 'quoted text' 'quoted text' x=1 export ${HOME} done
+cd | test /usr/bin then --verbose done cd -eu && ${HOME} ${HOME} export ${HOME}
+--verbose cd /usr/bin cd echo x=1 ${HOME} done export 'quoted text' sed
+	printf /usr/bin readonly --verbose
+	then "$1" cd x=1 echo $(pwd) local
+	sed "$1" $(pwd) /usr/bin awk then ${HOME}
+		sed && sed | readonly awk 'quoted text' test /usr/bin x=1 grep "$@"
+local --verbose | -eu readonly
+test cd /usr/bin $(pwd) && test 2>/dev/null
+		-eu export sed | 2>/dev/null 'quoted text' --verbose sed 'quoted text'
+	"$1" printf --verbose && grep printf
+	${HOME} /usr/bin /usr/bin readonly echo 2>/dev/null -eu | -eu export
+		cd readonly export /usr/bin export then
+		printf printf && sed test awk
+"$@" "$@" cd -eu -eu ${HOME} x=1 /usr/bin 2>/dev/null printf
+awk -eu sed 'quoted text' done local "$@"
+test 'quoted text' awk "$@" done printf printf
+	"$1" readonly "$@" ${HOME} x=1 -eu /usr/bin ${HOME} export readonly &&
+		export printf done printf "$1" -eu then readonly 'quoted text'
+	cd printf test "$@" cd ${HOME} then
+		${HOME} ${HOME} done 2>/dev/null
+sed | echo test "$1" "$@" 'quoted text' cd done ${HOME} && && done --verbose
+		done awk ${HOME} readonly && "$@" -eu printf
+	"$1" done && ${HOME} && test printf echo "$@" export ${HOME} grep local
+&& $(pwd) awk printf readonly cd awk
+"$@" printf "$@" printf x=1 --verbose grep ${HOME} test printf 'quoted text'
+	test -eu grep "$1" $(pwd) grep ${HOME} grep | $(pwd) 'quoted text'
+export cd awk "$1" printf 2>/dev/null && --verbose
+	printf 'quoted text' cd grep sed readonly $(pwd) ${HOME} then ${HOME} | awk sed
+		export "$1" awk $(pwd) test local $(pwd) -eu 2>/dev/null -eu
+	x=1 grep awk test export 2>/dev/null
+done done $(pwd) --verbose && test $(pwd) | echo 2>/dev/null
+readonly ${HOME} then awk && echo | 2>/dev/null
+	test printf echo 'quoted text' cd && "$@" echo
+done grep "$1" x=1 && "$@" -eu
+sed echo grep | 'quoted text'
+/usr/bin -eu "$1" cd "$1" done printf 'quoted text'
+	$(pwd) done readonly && printf && ${HOME} $(pwd) cd | $(pwd)
+	x=1 grep done -eu "$1" echo 'quoted text' done "$1" local
+	2>/dev/null then --verbose test 'quoted text' | cd /usr/bin then echo
+	2>/dev/null --verbose awk 'quoted text' grep local /usr/bin
+		-eu then "$1" printf ${HOME}
+	| readonly 2>/dev/null sed awk printf
+		echo export done local printf echo local "$@" --verbose -eu
+	"$@" && then /usr/bin readonly
+readonly --verbose grep cd
+	grep readonly 'quoted text' ${HOME} then -eu /usr/bin --verbose awk 2>/dev/null
+		cd awk 2>/dev/null local local
+		then awk -eu local x=1 'quoted text' 2>/dev/null readonly
+| && done x=1 $(pwd) | | cd awk $(pwd) 'quoted text' printf && test printf "$1"
+		echo $(pwd) --verbose done $(pwd) | readonly
+"$1" sed /usr/bin awk 2>/dev/null
+| $(pwd) export awk ${HOME} ${HOME} | printf done cd /usr/bin
+cd awk grep --verbose then x=1 local -eu
+	'quoted text' grep printf | 2>/dev/null x=1 --verbose
+	--verbose printf /usr/bin ${HOME} readonly local 'quoted text' 2>/dev/null
+		sed local && | $(pwd) test test
+	awk printf 2>/dev/null x=1 && --verbose | --verbose
+		cd local -eu export 2>/dev/null "$@" 'quoted text' export cd echo ${HOME}
+echo ${HOME} local 'quoted text' 'quoted text' && local readonly
+		--verbose printf "$@" export | done local
+		${HOME} -eu export grep $(pwd) done local cd local
+		readonly 'quoted text' && grep && echo -eu export && awk grep
+	local done awk test local export echo
+		readonly 2>/dev/null grep x=1 readonly awk "$1" 2>/dev/null
+		grep printf "$1" x=1 cd x=1
+		${HOME} sed 2>/dev/null
+	printf && grep sed /usr/bin then x=1 then
+	${HOME} 'quoted text' -eu -eu x=1 -eu -eu ${HOME} 2>/dev/null
+		test export local printf | awk 2>/dev/null readonly && then 2>/dev/null
+done "$1" printf /usr/bin $(pwd) -eu | test x=1 printf -eu local "$@"
+		-eu 'quoted text' 'quoted text' export "$1" grep sed -eu -eu sed
+		local test 'quoted text' --verbose
+	echo cd "$@" 2>/dev/null --verbose done export && 2>/dev/null 2>/dev/null local
+	awk && 2>/dev/null -eu printf grep local 2>/dev/null
+test | x=1 && "$1" echo
+${HOME} /usr/bin printf cd done $(pwd) && x=1 "$@" $(pwd) sed echo then grep
+printf --verbose local && /usr/bin "$@"
+		cd echo export && awk printf "$1" then ${HOME} cd "$@" --verbose
+x=1 local && x=1 echo local -eu 'quoted text'
+	2>/dev/null grep && done | "$@" then test /usr/bin && done
+2>/dev/null export $(pwd) export awk then -eu $(pwd) x=1
+then "$1" test then && x=1 x=1 "$1" sed -eu "$@" x=1 |
+x=1 done done && | readonly echo
+&& local -eu test echo readonly 2>/dev/null test
+	| "$@" ${HOME} $(pwd) /usr/bin done awk
+		"$@" "$1" printf "$@" then done export local done grep local ${HOME}
+		$(pwd) 'quoted text' then "$1" echo readonly test readonly x=1 "$1" ${HOME}
+	done awk local awk readonly printf ${HOME} done && readonly ${HOME}
+"$@" $(pwd) x=1 readonly /usr/bin
+	| grep "$@" -eu readonly
+'quoted text' sed $(pwd)
+		export readonly export export
+$(pwd) "$1" test sed then /usr/bin local printf test &&
+-eu printf | "$1" -eu | 'quoted text' -eu $(pwd) sed awk x=1 -eu | local then
+		export x=1 test "$1" 'quoted text'
+then /usr/bin "$@" export echo echo | grep test local printf sed
+	$(pwd) export /usr/bin /usr/bin done x=1 "$@" readonly 'quoted text'
+${HOME} "$@" then sed done export $(pwd) done 2>/dev/null
+"$@" echo then /usr/bin -eu local | grep echo /usr/bin "$1" ${HOME}
+	"$1" grep sed -eu test "$@" 'quoted text' done "$1" export &&
+sed && ${HOME} printf && 'quoted text' --verbose done
+awk "$@" | then "$1" -eu | -eu $(pwd) 'quoted text' 'quoted text'
+	test test readonly readonly done &&
+	sed "$@" "$1" && && /usr/bin readonly 'quoted text' done test done grep echo
+	printf printf x=1 && echo printf 'quoted text' ${HOME} done test /usr/bin $(pwd)
+	--verbose grep done awk sed export grep /usr/bin -eu test
+		then test --verbose -eu awk $(pwd) echo done && | echo "$@" 2>/dev/null
+	sed ${HOME} export echo cd /usr/bin then
+local "$@" export echo done "$1"
+	test "$1" $(pwd) ${HOME} && readonly done 2>/dev/null $(pwd) | done
+	awk 'quoted text' --verbose "$@"
+&& 2>/dev/null "$@" local export 2>/dev/null 2>/dev/null
+	${HOME} ${HOME} /usr/bin awk ${HOME} then $(pwd) printf local /usr/bin
+	printf /usr/bin printf && $(pwd) printf ${HOME}
+		$(pwd) x=1 cd | && readonly cd 2>/dev/null
+	local -eu && echo local $(pwd) grep export --verbose | $(pwd)
+		--verbose export /usr/bin 'quoted text'
+then x=1 export && cd test -eu --verbose
+cd done "$@" cd 2>/dev/null test 'quoted text' 'quoted text' ${HOME}
+		grep then --verbose x=1 'quoted text' sed done ${HOME} "$@" printf 'quoted text'
+		--verbose 2>/dev/null 2>/dev/null
+	"$@" echo readonly readonly ${HOME} "$@" -eu x=1 printf 'quoted text' && then
+	sed local --verbose printf test -eu 2>/dev/null
+--verbose printf sed echo test done
+then test cd local x=1 --verbose
+	printf x=1 ${HOME} export "$@" printf readonly grep sed local then $(pwd) "$@"
+	test $(pwd) 'quoted text' /usr/bin done export && done
+	awk grep | x=1 readonly cd export done export 2>/dev/null | done "$@" | $(pwd)
+		then "$1" && $(pwd) readonly test then local /usr/bin then x=1 ${HOME}
+awk /usr/bin then && done done echo
+	cd | "$@" readonly grep then --verbose "$1"
+		echo && printf then /usr/bin
+"$1" && printf /usr/bin
+	echo export awk /usr/bin /usr/bin x=1
+done /usr/bin sed 'quoted text' readonly
+		export "$1" "$1" ${HOME} awk --verbose "$1" test test
+'quoted text' local cd "$1" | printf cd 2>/dev/null "$@" "$1" && -eu awk local
+x=1 local $(pwd) grep /usr/bin | then awk awk "$@" "$1" --verbose
+	"$1" grep export sed local awk export printf 2>/dev/null test
+	readonly $(pwd) 2>/dev/null
+$(pwd) then --verbose 2>/dev/null
+done test 2>/dev/null readonly "$@" then
+	then then /usr/bin | | grep grep x=1 | test grep 2>/dev/null && export
+		| "$@" sed awk then ${HOME} sed ${HOME}
+export export | echo "$1" readonly 2>/dev/null -eu sed x=1
+		echo -eu "$1" 'quoted text' $(pwd)
+		sed printf local "$1" cd | 'quoted text' done printf 'quoted text' local
+"$@" ${HOME} 'quoted text' $(pwd) 'quoted text' echo
+printf readonly printf | export
+	"$1" "$@" readonly "$@" readonly awk && awk export
+	printf "$@" readonly echo "$@" /usr/bin ${HOME}
+		--verbose printf x=1 --verbose /usr/bin
+cd then test | local cd -eu -eu local export awk done awk "$@"
+test && x=1 "$@" | grep printf -eu | "$1" ${HOME} done
+		cd cd awk grep -eu | then sed "$@" readonly "$@" 2>/dev/null --verbose |
+		--verbose --verbose done
+		x=1 ${HOME} grep 'quoted text' local test readonly
+"$1" x=1 /usr/bin | $(pwd) -eu awk export awk sed export then awk local
+	echo done printf test ${HOME}
+echo /usr/bin awk export cd printf awk done done x=1 ${HOME}
+		/usr/bin -eu local test test echo /usr/bin echo cd grep --verbose 2>/dev/null
+${HOME} test grep x=1 /usr/bin sed readonly done --verbose 2>/dev/null
+	-eu export cd 2>/dev/null 'quoted text'
+		2>/dev/null $(pwd) then && grep 'quoted text' "$1" &&
+&& $(pwd) printf sed /usr/bin awk done $(pwd) "$@" "$1" "$@"
+	-eu 2>/dev/null --verbose sed
+	grep 'quoted text' ${HOME}
+	cd test cd test test /usr/bin -eu grep done
+2>/dev/null sed cd --verbose /usr/bin
+		2>/dev/null x=1 local 2>/dev/null echo "$1" sed echo
+&& $(pwd) awk export export --verbose
+	&& | --verbose --verbose echo done && awk then cd && then
+		test awk local done $(pwd)
+"$@" echo "$1" awk readonly ${HOME} then && echo then readonly ${HOME}
+cd sed "$1" sed done then ${HOME} local
+sed ${HOME} export "$@" "$1" | $(pwd)
+		&& sed $(pwd) sed sed -eu grep ${HOME}
+	echo | $(pwd) printf then "$@" done "$1" then awk "$@"
+		x=1 | printf $(pwd) $(pwd) sed grep &&
+--verbose grep 2>/dev/null --verbose export "$1"
+	&& sed -eu readonly done local --verbose awk echo echo --verbose echo
+		2>/dev/null grep "$@" export --verbose echo export
+		"$@" -eu awk x=1 "$@" grep /usr/bin grep done cd
+2>/dev/null "$@" -eu done printf readonly sed | --verbose test $(pwd) 'quoted text'
+		echo "$1" printf printf && echo 'quoted text' grep readonly
+	$(pwd) done --verbose -eu --verbose
+	echo "$1" --verbose $(pwd) --verbose
+		$(pwd) $(pwd) && $(pwd) ${HOME} done /usr/bin | test
+&& grep -eu echo ${HOME} -eu local /usr/bin readonly export $(pwd)
+		grep && ${HOME} test then 2>/dev/null test --verbose 'quoted text' local then
+		awk x=1 readonly $(pwd) x=1 readonly
+awk 'quoted text' readonly 2>/dev/null
+		${HOME} printf /usr/bin 'quoted text' -eu test && echo printf | /usr/bin
+cd $(pwd) 2>/dev/null $(pwd) readonly && --verbose x=1 done sed --verbose
+-eu awk /usr/bin cd cd x=1 2>/dev/null printf
+		echo "$@" local x=1 "$1" export && export -eu echo
+	sed --verbose && echo then awk cd echo "$1" 'quoted text' grep sed "$@" |
+		"$1" | "$@" readonly /usr/bin echo x=1 sed --verbose $(pwd) /usr/bin readonly
+	${HOME} cd then /usr/bin && then --verbose cd awk
+		--verbose sed | cd test -eu cd $(pwd) local ${HOME} awk "$@" local --verbose
+&& awk "$@" x=1 cd && 'quoted text' ${HOME} sed 'quoted text' x=1
+	readonly ${HOME} test awk grep /usr/bin local awk readonly /usr/bin
+		-eu --verbose 2>/dev/null local export test "$@" 'quoted text'
+		x=1 x=1 "$1" --verbose --verbose && local -eu -eu local export
+done test export x=1 local
+		cd 'quoted text' --verbose /usr/bin
+	x=1 export x=1 x=1 done 'quoted text'
+$(pwd) readonly sed | done cd /usr/bin 2>/dev/null
+		sed 2>/dev/null 'quoted text' readonly --verbose | grep $(pwd)
+	sed cd $(pwd) local 2>/dev/null "$1"
+| "$1" local --verbose x=1 | "$@" x=1 "$1" 'quoted text'
+	local export sed 'quoted text' printf && echo "$@" $(pwd) 'quoted text' | local
+	test $(pwd) -eu printf /usr/bin printf 'quoted text' local
+test -eu x=1 "$@" then readonly
+		x=1 | echo printf then "$@" ${HOME} --verbose && /usr/bin
+	local cd test done export readonly then
+	x=1 'quoted text' test x=1 2>/dev/null readonly done cd echo "$@"
+	readonly 2>/dev/null local 2>/dev/null /usr/bin export then /usr/bin --verbose
+		-eu 'quoted text' x=1 sed test cd --verbose readonly cd echo
+	printf grep 'quoted text' grep cd done echo $(pwd) /usr/bin
+		| /usr/bin done 2>/dev/null awk --verbose done && grep then readonly readonly
+	sed then awk readonly
+		printf -eu /usr/bin "$1"
+		| grep --verbose echo then
+	&& /usr/bin "$@" awk "$1" x=1 x=1
+	local then test x=1 sed
+echo echo x=1 readonly local
+"$1" echo cd echo "$@" sed awk ${HOME} x=1
+${HOME} 'quoted text' && -eu 2>/dev/null ${HOME} "$@" grep x=1 printf &&
+--verbose $(pwd) sed 2>/dev/null
+		--verbose "$@" echo readonly && test export test export
+"$1" echo grep --verbose "$@" printf | 'quoted text' 2>/dev/null local done
+printf && then /usr/bin "$@" test grep $(pwd) export echo --verbose
+"$1" done awk awk grep $(pwd) cd local
+		$(pwd) echo --verbose local x=1 $(pwd) -eu test 2>/dev/null printf 'quoted text'
+		then printf ${HOME} x=1 | "$1" then $(pwd) | 2>/dev/null
+"$@" -eu 'quoted text' --verbose | x=1 --verbose printf then x=1
+		local local grep -eu ${HOME} printf
+-eu --verbose done done awk printf echo 2>/dev/null && export /usr/bin cd "$1"
+		then 'quoted text' cd
+	$(pwd) "$@" 2>/dev/null | printf
+		"$1" awk x=1 awk cd done --verbose
+		$(pwd) cd printf x=1 /usr/bin cd cd /usr/bin ${HOME} | | --verbose
+grep then done readonly && printf export printf --verbose
+$(pwd) "$@" readonly ${HOME}
+	awk printf -eu sed /usr/bin | export "$1"
+	$(pwd) 'quoted text' echo ${HOME} && sed "$1" export "$1" $(pwd) ${HOME}
+/usr/bin 'quoted text' local $(pwd) cd export echo ${HOME}
+		x=1 "$@" 2>/dev/null
+done x=1 printf && echo readonly readonly
+| local "$@" readonly awk readonly
+cd awk cd /usr/bin "$@" cd 'quoted text'
+-eu $(pwd) 2>/dev/null --verbose && local "$@" | awk x=1 $(pwd) done printf
+		then awk && x=1 sed sed x=1 x=1 sed cd x=1 $(pwd) local 'quoted text'
+	readonly -eu grep grep readonly echo /usr/bin readonly "$@"
+${HOME} 2>/dev/null then 2>/dev/null
+	'quoted text' | 2>/dev/null echo
+	$(pwd) "$1" 'quoted text'
+then && then ${HOME} then $(pwd) 'quoted text' echo "$1" x=1 then cd 2>/dev/null
+		-eu local readonly --verbose
+echo && sed | 2>/dev/null test echo sed export test grep local test
+	2>/dev/null "$@" test cd sed /usr/bin sed 'quoted text'
+		test grep && awk readonly cd
+	&& readonly cd awk grep x=1 cd --verbose
+		${HOME} 'quoted text' done "$@" 2>/dev/null 'quoted text' --verbose sed "$@" local
+		grep local | awk export ${HOME} ${HOME} local
+--verbose local $(pwd) 2>/dev/null
+	readonly ${HOME} echo export then
+		--verbose cd /usr/bin "$1"
+-eu sed 2>/dev/null 'quoted text'
+readonly ${HOME} && echo sed done local --verbose 2>/dev/null sed printf grep sed
+		echo $(pwd) done sed test readonly sed 'quoted text' x=1 'quoted text'
+cd test done done "$@" then grep && "$1"
+		/usr/bin -eu awk readonly | export --verbose cd done local
+readonly /usr/bin 'quoted text' test
+	/usr/bin 2>/dev/null export local
+		printf $(pwd) x=1 printf readonly export readonly grep
+	-eu echo --verbose cd echo && -eu export printf /usr/bin export echo
+	grep printf then ${HOME} then
+	"$@" | /usr/bin ${HOME} && sed x=1 cd -eu cd export printf sed
+	grep /usr/bin "$@" sed
+		"$1" --verbose ${HOME} grep "$@" $(pwd) "$@" printf awk echo cd /usr/bin test
+		/usr/bin 'quoted text' 'quoted text' echo then | sed 'quoted text' | grep done
+sed 2>/dev/null x=1 test awk
+		awk | && 2>/dev/null $(pwd) export awk "$@" grep 2>/dev/null --verbose --verbose
+		x=1 /usr/bin readonly echo
+	"$@" sed 2>/dev/null "$@" && then 'quoted text' cd x=1 &&
+	printf --verbose done 'quoted text' "$@" "$@" test cd echo test "$1"
+done -eu $(pwd) awk awk -eu /usr/bin
+	sed printf awk x=1 then /usr/bin | sed "$1"
+grep cd grep && export grep x=1
+	"$@" export then cd --verbose /usr/bin export done && | readonly "$1"
+		--verbose $(pwd) -eu sed
+	readonly /usr/bin export /usr/bin sed 'quoted text'
+		"$1" readonly && sed test awk echo readonly
+	-eu $(pwd) readonly awk echo printf /usr/bin done -eu
+export x=1 sed "$1" awk "$1" $(pwd)
+		/usr/bin --verbose /usr/bin | -eu 'quoted text' sed
+test cd /usr/bin $(pwd) echo --verbose
+		printf awk "$1" readonly
+		--verbose "$@" echo readonly | /usr/bin sed x=1 --verbose sed --verbose local
+--verbose local 2>/dev/null awk then && && cd $(pwd)
+#include c207.sh
+sed ${HOME} echo cd export "$@" -eu
+		readonly 'quoted text'
+		test grep ${HOME} echo -eu awk cd
+echo $(pwd) 'quoted text' 2>/dev/null test then printf
+echo && 2>/dev/null /usr/bin sed -eu | export printf
+		local readonly $(pwd) -eu 'quoted text' --verbose x=1 echo -eu "$@"
+		echo "$1" export cd | --verbose "$1"
+then 2>/dev/null then grep 2>/dev/null local
+/usr/bin && printf export && /usr/bin grep grep cd
+		echo && x=1 | grep $(pwd) cd | export local test && echo
+${HOME} sed printf -eu x=1 --verbose 2>/dev/null
+| printf printf "$@" x=1 x=1 "$1" sed -eu sed 2>/dev/null
+echo /usr/bin 2>/dev/null export then "$1" echo then --verbose --verbose /usr/bin
+readonly "$1" ${HOME} && "$1" ${HOME} /usr/bin 2>/dev/null
+		local export cd -eu "$1" export /usr/bin
+		--verbose sed "$@" readonly grep 'quoted text' --verbose && x=1
+		$(pwd) "$@" 'quoted text' readonly $(pwd)
+	"$1" | test cd local x=1 x=1 'quoted text' x=1 "$@"
+	-eu done -eu printf done awk then then done 'quoted text' done grep | "$@"
+		x=1 /usr/bin 2>/dev/null $(pwd) echo echo export done && && printf 'quoted text'
+	readonly x=1 'quoted text' "$1" x=1 ${HOME} awk 2>/dev/null $(pwd)
+		export local /usr/bin && 2>/dev/null ${HOME}
+x=1 sed | 2>/dev/null export echo echo /usr/bin done x=1 2>/dev/null
+	2>/dev/null ${HOME} echo && local grep grep
+/usr/bin --verbose echo 2>/dev/null printf sed echo 'quoted text'
+	"$1" readonly then -eu $(pwd) 'quoted text' sed readonly /usr/bin $(pwd) /usr/bin
+		readonly ${HOME} export then cd -eu sed $(pwd) "$@" export local export $(pwd)
+		test local cd export grep export cd echo | 2>/dev/null
+		/usr/bin ${HOME} local echo | awk ${HOME}
+	then grep test readonly export "$1" 2>/dev/null grep cd
+grep 2>/dev/null x=1 && local 2>/dev/null "$1"
+grep -eu 2>/dev/null local $(pwd) 2>/dev/null cd grep cd echo
+&& 2>/dev/null --verbose 2>/dev/null printf
+echo echo -eu local printf "$1" local | cd 'quoted text' local --verbose
+| /usr/bin then /usr/bin echo sed ${HOME}
+		done ${HOME} "$@" awk echo then echo
+	/usr/bin /usr/bin sed "$1" grep readonly
+		'quoted text' ${HOME} export /usr/bin echo $(pwd)
+awk $(pwd) echo --verbose /usr/bin 'quoted text'
+		readonly echo && x=1 "$1" readonly "$1" echo sed $(pwd)
+	test --verbose ${HOME} /usr/bin
+&& grep sed grep export cd "$1" readonly --verbose
+	"$1" x=1 'quoted text' export test | --verbose test 2>/dev/null then -eu "$1"
+awk /usr/bin then export test "$@" cd export | $(pwd) readonly done 'quoted text'
+export test 2>/dev/null 2>/dev/null /usr/bin
+	| printf sed && && --verbose x=1 'quoted text' cd && && then test
+		sed | "$@" local grep local awk 'quoted text' export ${HOME} "$1" "$@" $(pwd) /usr/bin
+$(pwd) echo /usr/bin | x=1 2>/dev/null echo echo --verbose "$@"
+	"$@" printf x=1 then /usr/bin then cd -eu done x=1 test export 2>/dev/null
+		-eu done grep awk test
+	| "$1" 'quoted text' | printf local then local "$@" test awk 'quoted text'
+	x=1 done "$1" --verbose -eu x=1 then "$1" 'quoted text' x=1
+		local cd echo "$@" test x=1 cd /usr/bin && sed test x=1 -eu echo && grep
+	done | -eu --verbose | && then test awk
+	/usr/bin 2>/dev/null 2>/dev/null sed -eu export
+done cd --verbose x=1 $(pwd) grep cd && local | --verbose
+		${HOME} --verbose "$1" local &&
+	$(pwd) x=1 | sed ${HOME} -eu 'quoted text'
+		--verbose sed --verbose cd -eu 2>/dev/null x=1 then
+x=1 echo "$@" local 'quoted text'
+	local cd grep export --verbose echo readonly done readonly
+	--verbose $(pwd) x=1 awk grep export $(pwd) 'quoted text'
+local /usr/bin x=1 "$1" && then && readonly $(pwd) printf then export
+/usr/bin printf sed $(pwd) "$@" -eu /usr/bin printf
+	export grep grep --verbose 'quoted text'
+	$(pwd) grep ${HOME} --verbose done echo && "$1" awk --verbose -eu printf
+echo && x=1 cd $(pwd) printf | export awk cd $(pwd) sed done
+		awk -eu then && test cd "$@" sed local ${HOME} x=1 'quoted text'
+	--verbose $(pwd) readonly 'quoted text' | readonly 2>/dev/null done /usr/bin $(pwd)
+		printf "$1" then && 'quoted text' $(pwd) export echo && /usr/bin ${HOME} then
+		&& sed test /usr/bin echo cd x=1 "$1" local printf
+	sed --verbose echo --verbose --verbose readonly
+local | local grep | cd 'quoted text' "$@"
+	'quoted text' awk echo "$1" export local $(pwd) "$1" cd $(pwd) --verbose
+	awk --verbose | echo echo test done local printf && readonly x=1
+		awk awk 'quoted text' 'quoted text' export local readonly --verbose --verbose
+	/usr/bin echo -eu 2>/dev/null sed | "$1" test $(pwd) printf
+		$(pwd) 'quoted text' | export test readonly done x=1 then
+		2>/dev/null "$@" 'quoted text' then -eu $(pwd) | && readonly --verbose test echo
+/usr/bin 2>/dev/null export export test sed x=1 done readonly
+		test | "$1" | done readonly printf cd "$1"
+	/usr/bin sed $(pwd) echo -eu "$1"
+		grep ${HOME} -eu sed grep /usr/bin grep done done
+	$(pwd) local /usr/bin grep sed local | x=1 grep local 2>/dev/null
+		awk "$@" "$1" /usr/bin readonly 'quoted text'
+	grep awk "$1" -eu "$@" export printf then
+cd sed test --verbose awk export cd $(pwd) $(pwd) cd echo "$1"
+"$@" | -eu cd x=1 export "$@" --verbose export /usr/bin x=1 echo 2>/dev/null
+	sed cd $(pwd) /usr/bin then test -eu
+	test -eu 'quoted text' test "$1" done echo echo
+	${HOME} awk x=1 printf then /usr/bin && 'quoted text' test 2>/dev/null
+printf readonly "$1" 'quoted text' printf 2>/dev/null
+		${HOME} readonly ${HOME}
+$(pwd) -eu cd | test readonly 2>/dev/null ${HOME} export $(pwd) cd export
+		done x=1 echo sed x=1 export then 2>/dev/null "$1" "$@" "$1" $(pwd) cd
+	/usr/bin --verbose awk "$@" cd done then $(pwd) | "$@" awk && && x=1
+	awk export x=1 -eu export "$@" grep
+	"$1" cd export 2>/dev/null ${HOME} x=1 && awk |
+printf x=1 -eu then local x=1
+		readonly ${HOME} local sed | "$1" then && $(pwd) 'quoted text'
+		then sed ${HOME} 2>/dev/null /usr/bin | grep /usr/bin
+		then done | local sed printf -eu "$1" local done echo --verbose
+	${HOME} "$1" printf --verbose 2>/dev/null
+		2>/dev/null local echo -eu cd "$1" done awk $(pwd) echo readonly
+&& cd sed 2>/dev/null printf $(pwd) cd cd -eu awk "$@"
+		/usr/bin -eu x=1 echo --verbose export local local | local --verbose then
+		${HOME} "$@" --verbose done $(pwd) "$@" && export cd then /usr/bin "$1" done
+		/usr/bin local grep --verbose x=1 -eu awk | grep
+sed | done /usr/bin cd done "$@" $(pwd) awk "$1" then cd
+		grep "$1" x=1 "$1" "$1" x=1 x=1 echo /usr/bin 2>/dev/null
+	echo done /usr/bin done --verbose
+echo 2>/dev/null && --verbose
+	sed sed -eu test awk echo local cd test "$1" | "$@" ${HOME}
+echo 2>/dev/null && x=1 export sed | 'quoted text' ${HOME} export awk
+$(pwd) && test test local test sed x=1
+		--verbose $(pwd) "$@" done ${HOME} x=1 cd -eu /usr/bin 'quoted text' sed local
+		printf ${HOME} "$1" echo --verbose echo x=1 && "$@" | printf
+		--verbose /usr/bin sed 2>/dev/null 'quoted text'
+	"$@" && cd | awk 2>/dev/null sed --verbose 'quoted text'
+awk sed -eu && | awk /usr/bin sed test local /usr/bin --verbose local
+2>/dev/null grep ${HOME} printf readonly echo readonly 2>/dev/null done && | grep
+		then x=1 grep export --verbose 'quoted text' readonly
+	2>/dev/null $(pwd) ${HOME} export 'quoted text' | 'quoted text' then /usr/bin
+	printf grep printf "$@" sed x=1 | export grep x=1 then x=1 x=1 "$@" 2>/dev/null
+		done --verbose echo x=1 then
+	'quoted text' then test done "$@" test 'quoted text' done
+	&& "$@" awk awk -eu 'quoted text' 2>/dev/null readonly x=1
+		'quoted text' grep printf echo readonly "$@" printf done --verbose
+	-eu then test local "$1" | then $(pwd) cd ${HOME} -eu awk && x=1
+	test x=1 export 2>/dev/null
+/usr/bin readonly "$1" echo then export printf && && test sed local sed test echo
+local cd /usr/bin sed /usr/bin sed done 2>/dev/null $(pwd) 'quoted text'
+	done then 'quoted text' awk sed ${HOME} grep
+then x=1 readonly echo && 'quoted text'
+	local 2>/dev/null ${HOME} --verbose 'quoted text'
+&& cd "$@" sed done "$@" cd 2>/dev/null cd "$@" awk 2>/dev/null
+		x=1 | grep local ${HOME} echo readonly cd cd awk sed 2>/dev/null
+	| grep /usr/bin grep done $(pwd) x=1 cd && /usr/bin
+2>/dev/null test export 'quoted text' ${HOME} --verbose --verbose "$1" cd then readonly
+$(pwd) --verbose $(pwd) | 2>/dev/null 'quoted text' echo cd
+	$(pwd) /usr/bin local local grep printf cd
+-eu printf export ${HOME} printf && local ${HOME} local test ${HOME}
+/usr/bin && && 2>/dev/null --verbose && ${HOME} echo grep
+	&& ${HOME} --verbose -eu test | echo --verbose readonly "$@" local done
+'quoted text' awk --verbose $(pwd) -eu --verbose
+grep printf test /usr/bin 2>/dev/null
+-eu 2>/dev/null 2>/dev/null
+		'quoted text' && awk done grep export | sed 2>/dev/null
+	done then | $(pwd) cd then $(pwd) -eu sed
+"$1" export export "$@" --verbose && /usr/bin
+x=1 test done 'quoted text' grep cd awk readonly
+		local readonly "$@" "$1" awk
+		grep awk test && export
+cd then x=1 echo readonly grep 2>/dev/null ${HOME} printf -eu test
+	local 'quoted text' && cd cd then done 2>/dev/null echo 2>/dev/null
+	export local echo "$@" /usr/bin
+		${HOME} done local readonly $(pwd) sed cd $(pwd) 2>/dev/null echo
+	test x=1 "$@" awk cd -eu && ${HOME} sed sed printf
+'quoted text' && readonly
+		grep -eu awk printf $(pwd) && 'quoted text' "$@" then readonly test awk sed
+		${HOME} -eu export 'quoted text' --verbose echo |
+	awk sed x=1 /usr/bin $(pwd)
+		${HOME} test && $(pwd) sed "$@" -eu /usr/bin
+	sed && export | 'quoted text' "$1" 2>/dev/null echo -eu && -eu "$@" /usr/bin done
+	$(pwd) printf readonly echo && --verbose printf done
+cd 2>/dev/null /usr/bin done awk cd ${HOME} --verbose
+		then --verbose $(pwd) cd ${HOME} cd export done
+		/usr/bin done $(pwd) readonly readonly
+	awk export local "$@" grep x=1 "$1" && 2>/dev/null done --verbose
+	sed printf ${HOME} ${HOME} done awk
+	"$1" "$@" done printf 'quoted text' -eu && /usr/bin
+${HOME} printf --verbose x=1 test /usr/bin printf
+	done /usr/bin local grep grep ${HOME} then x=1 x=1 export $(pwd) -eu readonly
+		"$1" cd echo $(pwd) "$@" && done awk 2>/dev/null
+	-eu grep x=1 done ${HOME} then done test export
+	--verbose cd 'quoted text' export /usr/bin printf test test cd | test $(pwd)
+-eu test sed 'quoted text' then printf ${HOME} "$1" ${HOME} 'quoted text'
+	awk printf done -eu /usr/bin "$1" x=1 awk readonly
+		-eu readonly printf -eu 2>/dev/null "$1" printf /usr/bin
+printf 'quoted text' "$1" printf test && 2>/dev/null done export "$@"
+		sed ${HOME} | test readonly done &&
+		-eu ${HOME} && printf x=1 "$1" readonly echo echo then sed x=1 export 'quoted text'
+	done --verbose readonly --verbose local then grep $(pwd) awk echo export
+		then then done echo -eu ${HOME}
+cd local 'quoted text' printf test
+		cd done done grep sed local "$1" local cd ${HOME} "$@"
+	awk $(pwd) -eu $(pwd) 2>/dev/null cd echo --verbose ${HOME} 'quoted text'
+	sed test -eu sed awk $(pwd)
+export ${HOME} cd 2>/dev/null cd x=1 echo | sed $(pwd) readonly
+"$@" --verbose cd --verbose export then then then sed then | sed
+	sed 2>/dev/null sed "$@" /usr/bin done
+		"$@" awk | cd --verbose test ${HOME} -eu
+	${HOME} && export && printf | 2>/dev/null readonly awk x=1 awk done sed
+echo ${HOME} --verbose echo "$@" ${HOME} /usr/bin -eu && ${HOME}
+sed local readonly cd cd test awk done
+		local && readonly ${HOME}
+x=1 2>/dev/null x=1 "$@"
+/usr/bin then && | awk 2>/dev/null test cd echo --verbose
+		2>/dev/null test $(pwd)
+		readonly "$@" awk echo cd then awk "$1" test
+	test | test $(pwd) cd ${HOME} test done x=1 readonly awk -eu grep x=1
+		| cd grep test then ${HOME} "$@" $(pwd) "$@" readonly $(pwd)
+		awk sed echo ${HOME} -eu $(pwd) test readonly test sed printf $(pwd) then grep
+	"$1" cd test ${HOME} 2>/dev/null
+		'quoted text' /usr/bin awk export awk sed 2>/dev/null
+--verbose --verbose export awk test $(pwd) ${HOME} cd readonly "$1" cd cd ${HOME}
+--verbose && printf "$1" test cd awk -eu ${HOME} | then -eu 'quoted text'
+		readonly export sed printf "$1" printf grep sed "$1"
+		${HOME} local x=1 cd --verbose
+	'quoted text' $(pwd) x=1 test echo echo 'quoted text'
+		echo echo export "$1" ${HOME} -eu --verbose echo echo sed awk test
+done $(pwd) x=1 "$@" 'quoted text' local grep test echo 'quoted text'
+		grep done then 2>/dev/null $(pwd) $(pwd) -eu /usr/bin | | -eu 'quoted text'
+	echo --verbose export test 2>/dev/null --verbose
+		/usr/bin readonly test local local done 'quoted text' ${HOME} ${HOME}
+		sed /usr/bin /usr/bin --verbose done "$1" /usr/bin cd x=1 /usr/bin
+/usr/bin x=1 printf -eu readonly export test && "$1" /usr/bin -eu
+	cd 2>/dev/null printf done readonly done awk && done
+/usr/bin | printf readonly "$@" done $(pwd) $(pwd) | -eu "$1"
+	| $(pwd) -eu done done "$@" /usr/bin
+	test readonly readonly --verbose -eu ${HOME} 2>/dev/null
+	then "$1" test && readonly 'quoted text' awk awk local test ${HOME} cd done
+		readonly awk --verbose test test sed $(pwd)
+&& sed test "$@" export && awk local 2>/dev/null
+grep done -eu export 2>/dev/null done echo printf
+	export export sed echo -eu then 2>/dev/null then sed
+| ${HOME} && readonly printf | -eu awk cd readonly 'quoted text'
+	--verbose ${HOME} cd local "$1" "$1" 2>/dev/null
+	"$1" grep --verbose "$1" printf 'quoted text' sed grep | readonly
+	-eu /usr/bin echo sed cd "$1" done cd sed readonly printf -eu printf export
+printf ${HOME} grep then "$1"
+		test --verbose $(pwd) readonly -eu "$1" readonly -eu
+		| "$1" awk then sed awk | local
+	test x=1 done && readonly "$1" | done export then done --verbose
+		| -eu ${HOME} printf printf printf
+export sed awk && export $(pwd) sed --verbose echo -eu -eu $(pwd) --verbose "$1"
+grep | 2>/dev/null "$1" 'quoted text' x=1 && "$1"
+| test ${HOME} export ${HOME} "$@"
+		-eu local $(pwd) 2>/dev/null awk local grep readonly 'quoted text'
+		/usr/bin echo -eu | awk export done printf /usr/bin 'quoted text' sed echo
+		cd awk 2>/dev/null "$@" x=1 echo 'quoted text'
+		printf sed readonly then echo 'quoted text' -eu x=1 -eu 'quoted text' sed
+| export --verbose readonly export ${HOME} awk cd && && /usr/bin grep echo 2>/dev/null
+-eu | export export echo cd "$1" 2>/dev/null
+	readonly x=1 done -eu 'quoted text' && $(pwd) export export readonly cd test &&
+	then && done test done readonly "$1" 2>/dev/null ${HOME} /usr/bin readonly
+printf 2>/dev/null 'quoted text' && x=1 && grep | done -eu
+local awk 'quoted text' -eu sed cd
+| && x=1 printf cd sed printf grep done printf -eu 2>/dev/null
+	&& ${HOME} 'quoted text' --verbose echo /usr/bin && /usr/bin readonly
+		$(pwd) && done done 'quoted text' --verbose $(pwd)
+	--verbose 'quoted text' --verbose "$1" echo grep sed "$1" ${HOME} -eu "$1"
+'quoted text' 2>/dev/null 2>/dev/null export done --verbose sed && grep
+then x=1 | then cd done readonly -eu
+	cd x=1 readonly x=1 -eu 'quoted text' awk then
+		done echo test | printf
+		export 2>/dev/null x=1 2>/dev/null then test && "$1" printf -eu
+	done | printf "$@" -eu local awk 2>/dev/null
+awk local readonly export | 2>/dev/null awk grep $(pwd) /usr/bin awk
+	then ${HOME} local then local 'quoted text'
+then 'quoted text' ${HOME} x=1 ${HOME} 2>/dev/null
+	local export | $(pwd) | cd done x=1
+		grep awk x=1 2>/dev/null readonly
+	test readonly grep /usr/bin done sed grep export done x=1 cd done grep --verbose
+	echo awk local awk | | 2>/dev/null grep "$1" test local export
+		echo then grep local local --verbose export grep awk cd ${HOME}
+		done /usr/bin "$1" test --verbose && done --verbose awk | sed
+sed && && echo | grep test
+		done then awk | readonly /usr/bin /usr/bin echo echo export 2>/dev/null
+/usr/bin export export local /usr/bin | -eu
+x=1 "$@" /usr/bin -eu readonly ${HOME} $(pwd) export test export ${HOME}
+		done ${HOME} export ${HOME} ${HOME} | test local
+"$1" awk local | cd cd --verbose done awk local "$1" awk printf awk echo
+		"$1" export sed awk done cd /usr/bin readonly && echo && done done
+		done && "$@" "$1" grep printf --verbose done --verbose cd printf $(pwd) 'quoted text'
+	printf readonly --verbose then 'quoted text'
+		local readonly "$1" "$@" --verbose then
+test printf test 2>/dev/null awk
+	&& $(pwd) printf x=1 "$1" $(pwd) /usr/bin awk cd x=1 test
+x=1 && $(pwd) ${HOME} then 'quoted text' readonly readonly ${HOME} echo 'quoted text'
+&& echo echo 2>/dev/null
+		test ${HOME} sed cd cd -eu echo awk export
+		/usr/bin "$1" $(pwd)
+	awk printf ${HOME} printf awk then 'quoted text' export
+		-eu 2>/dev/null cd cd printf "$@" awk done && then
+sed -eu done local then "$@" 2>/dev/null local sed
+	$(pwd) --verbose awk cd readonly 'quoted text' test "$@" echo printf then ${HOME}
+grep then echo echo awk 2>/dev/null $(pwd) | x=1 "$@" && "$@"
+2>/dev/null awk cd grep "$@" done sed awk --verbose 'quoted text' readonly
+	| awk 'quoted text' "$1" awk && $(pwd) "$1" done
+		readonly 'quoted text' grep export echo grep grep awk readonly
+printf 'quoted text' awk /usr/bin cd then echo done then done --verbose
+then && awk "$@" local $(pwd)
+done 2>/dev/null local /usr/bin -eu echo && awk grep "$@"
+	"$1" && "$@" "$@" /usr/bin test
+	cd local /usr/bin printf echo sed 'quoted text' | done local $(pwd) local test export
+test && | -eu /usr/bin readonly $(pwd) awk readonly ${HOME}
+'quoted text' /usr/bin
+cd sed "$@" | echo 'quoted text'
+		readonly $(pwd) echo /usr/bin --verbose
+		$(pwd) 2>/dev/null "$1" "$@" printf echo then && --verbose export $(pwd) $(pwd)
+		cd done $(pwd) sed sed --verbose -eu && 'quoted text' readonly && done -eu
+		2>/dev/null --verbose done
+	awk grep "$1" then cd "$1" local printf grep echo awk 'quoted text'
+	echo sed printf local $(pwd) test "$@" test export -eu printf local grep local
+	2>/dev/null ${HOME} | | grep export && local cd | "$@"
+	/usr/bin printf --verbose "$@" --verbose
+-eu export x=1 printf
+'quoted text' -eu local ${HOME} done | "$@" 'quoted text'
+	$(pwd) 2>/dev/null export && done
+--verbose test x=1 2>/dev/null | printf
+	test test sed grep /usr/bin grep done /usr/bin export --verbose
+	--verbose test done --verbose $(pwd) --verbose export /usr/bin export
+${HOME} $(pwd) cd done
+"$1" sed test awk grep "$@" "$1" cd readonly sed sed /usr/bin -eu test 2>/dev/null
+		echo 'quoted text' "$@" readonly export awk
+		&& test 2>/dev/null 2>/dev/null readonly
+then echo export /usr/bin $(pwd) --verbose readonly /usr/bin
+		| export awk | && "$1" "$@" /usr/bin -eu local 'quoted text' "$1"
+"$1" | ${HOME} export && cd done x=1 && readonly printf ${HOME}
+		-eu echo awk awk -eu 'quoted text' sed done
+"$1" export export cd cd 2>/dev/null | echo local --verbose
+x=1 test local printf /usr/bin 'quoted text' x=1 /usr/bin x=1 x=1
+$(pwd) then readonly echo 'quoted text' x=1 done $(pwd) /usr/bin cd x=1
+	cd 'quoted text' printf "$1" then then && echo cd 'quoted text' readonly
+		| -eu cd test x=1 2>/dev/null --verbose "$@" 2>/dev/null
+	/usr/bin x=1 /usr/bin test local cd echo --verbose cd $(pwd) $(pwd)
+	${HOME} /usr/bin cd $(pwd) x=1 local && done export -eu local
+		'quoted text' test $(pwd) "$1" --verbose export
+	readonly -eu -eu 'quoted text' done ${HOME} then -eu local
+awk 2>/dev/null grep awk --verbose 2>/dev/null done done awk
+then cd test $(pwd) | export awk x=1 -eu echo "$1" | printf $(pwd) && --verbose
+	-eu cd test /usr/bin | $(pwd) local sed --verbose /usr/bin "$@" x=1 cd test
+export 2>/dev/null && && export awk 2>/dev/null grep local test
+	&& awk /usr/bin "$@" printf "$1"
+	$(pwd) ${HOME} "$@" ${HOME} $(pwd) 2>/dev/null | -eu
+		local printf sed "$@" -eu export export /usr/bin local "$1" |
+"$@" test awk export then $(pwd) grep printf && /usr/bin "$1" then
+export then readonly cd awk echo test awk export cd export /usr/bin
+sed awk && then | /usr/bin "$1" && ${HOME} "$1" /usr/bin
+	then cd export 2>/dev/null
+	x=1 export --verbose /usr/bin test printf
+test cd readonly export && echo cd readonly "$1"
+		awk readonly printf awk done cd x=1 grep test x=1
+done echo test ${HOME} sed export cd 2>/dev/null done x=1 cd "$1" "$1" 'quoted text'
+	done cd cd cd test cd then --verbose
+	/usr/bin done 'quoted text' | awk echo && test test local grep export
+$(pwd) sed done readonly
+"$1" /usr/bin -eu local printf "$@" sed && ${HOME} readonly
+		'quoted text' test ${HOME} cd then | "$@" ${HOME} grep grep x=1 echo sed x=1
+	test 'quoted text' test
+export && done sed | -eu
+"$@" local -eu cd done printf
+	cd readonly export /usr/bin echo echo | "$1"
+		--verbose 'quoted text' $(pwd) printf "$1" echo | printf -eu sed grep | printf
+	&& 2>/dev/null printf "$@" then cd grep $(pwd)
+	"$1" cd grep /usr/bin
+echo local -eu x=1 'quoted text' cd cd echo | printf "$1"
+	x=1 awk 'quoted text' $(pwd) local
+		awk sed local test x=1 $(pwd) awk local
+		${HOME} echo local x=1 'quoted text' sed
+grep -eu export export printf $(pwd) then local && 'quoted text' |
+		2>/dev/null grep 'quoted text'
+		"$@" $(pwd) test then printf -eu /usr/bin printf test --verbose
+printf /usr/bin x=1 && test
+"$@" cd export done 'quoted text' done $(pwd) && -eu | && &&
+"$1" "$1" ${HOME} 'quoted text' "$@" 'quoted text' $(pwd) done
+	local 2>/dev/null readonly test then done printf 2>/dev/null /usr/bin "$@"
+readonly x=1 "$@" grep 'quoted text' | sed 2>/dev/null
+		| $(pwd) 'quoted text' |
+	sed test "$@" then cd awk export export /usr/bin
+		readonly export printf then readonly awk && export
+test done && test printf printf local cd cd --verbose
+"$1" x=1 && sed sed awk
+		/usr/bin x=1 && | $(pwd) then && "$@" x=1 && --verbose 'quoted text' ${HOME}
+printf export grep test x=1 && ${HOME} test ${HOME} x=1
+		| --verbose -eu awk readonly echo $(pwd) done
+		'quoted text' && "$1" awk ${HOME} done test 'quoted text'
+		$(pwd) x=1 /usr/bin local readonly -eu echo $(pwd) local readonly printf 'quoted text'
+		awk cd "$@" $(pwd) "$1" echo --verbose && grep test sed /usr/bin "$@" "$@" /usr/bin
+		| echo ${HOME} sed $(pwd) printf printf sed test "$1" x=1 grep && sed cd test done
+	/usr/bin cd echo local then -eu -eu sed 2>/dev/null then test local
+		done && printf local grep --verbose cd | | -eu /usr/bin readonly then grep printf
+	cd | | && "$@" echo && /usr/bin cd "$1" $(pwd)
+"$@" then local test test awk 'quoted text'
+	readonly "$1" sed /usr/bin test 'quoted text'
+done "$@" test then ${HOME} x=1 then /usr/bin export sed cd ${HOME}
+		-eu -eu "$1" sed 2>/dev/null then "$@" echo | local grep grep
+	"$@" "$@" local grep echo
+		then --verbose printf readonly "$1" export ${HOME} $(pwd) export printf cd local
+readonly then local "$1" grep -eu printf && --verbose ${HOME} sed
+		| sed "$@" --verbose | local export /usr/bin local echo readonly test
+&& 2>/dev/null "$@" cd sed &&
+--verbose sed sed x=1 readonly --verbose cd export | && sed
+	done cd cd x=1 $(pwd) cd --verbose grep "$1" 'quoted text'
+	'quoted text' $(pwd) printf 'quoted text' export awk 'quoted text'
+	grep "$1" done export | | "$1" then -eu done
+	test /usr/bin sed readonly sed -eu /usr/bin --verbose ${HOME} &&
+	| 2>/dev/null awk x=1 /usr/bin cd -eu done test
+	${HOME} 2>/dev/null "$@" echo printf echo
+		-eu then $(pwd) sed awk sed ${HOME} local grep "$1" ${HOME} done ${HOME} $(pwd)
+	export readonly printf printf done export | awk grep
+	-eu done printf "$@" "$@" /usr/bin
+		${HOME} -eu 'quoted text' local done echo cd echo 'quoted text' sed awk && then
+	| echo 'quoted text' 2>/dev/null echo cd $(pwd) ${HOME} && then && $(pwd)
+printf printf && /usr/bin
+	-eu "$1" awk grep "$@" cd x=1 readonly $(pwd)
+export printf local awk done "$@" grep printf --verbose sed x=1
+local x=1 test /usr/bin
+export echo printf x=1 2>/dev/null readonly "$@" x=1 cd
+	readonly test /usr/bin test x=1 2>/dev/null /usr/bin
+&& done local "$1" -eu
+	local export cd test then 'quoted text' | then sed x=1
+		$(pwd) export readonly ${HOME} then export grep
+		-eu readonly echo 'quoted text' local --verbose "$1" "$@" readonly
+		test -eu 2>/dev/null grep 'quoted text' $(pwd)
+	test && "$@" ${HOME} ${HOME} -eu readonly grep x=1 -eu
+	-eu readonly x=1 && printf x=1 test printf "$@" printf "$1" -eu awk
+	local then readonly | local cd $(pwd) 2>/dev/null --verbose
+sed cd awk readonly && /usr/bin 'quoted text' --verbose
+		$(pwd) /usr/bin cd then export --verbose
+	&& test 'quoted text' --verbose awk grep done "$1"
+	done then grep cd sed echo | readonly 'quoted text'
+		--verbose grep done x=1 /usr/bin
+	x=1 awk --verbose | "$@" then done 2>/dev/null grep test sed ${HOME} sed
+		${HOME} -eu | cd $(pwd) ${HOME} | -eu cd grep grep && $(pwd)
+		"$@" sed "$1" readonly | 'quoted text' | echo "$@" $(pwd) done --verbose
+		--verbose done && x=1 then 2>/dev/null printf done sed "$1"
+	"$@" x=1 awk test printf cd awk local cd
+	${HOME} && done echo echo "$@" /usr/bin cd printf local x=1 local echo -eu
+	| sed cd "$@" ${HOME} test test
+		then test printf cd then done $(pwd) -eu
+local grep local done && 'quoted text' sed
+sed export done -eu echo export | grep
+done awk echo test x=1 local 'quoted text' awk printf 2>/dev/null cd 'quoted text'
+	printf echo "$@" echo local ${HOME} echo /usr/bin local grep --verbose |
+	$(pwd) -eu grep 'quoted text' |
+		&& 2>/dev/null readonly local cd echo
+	$(pwd) x=1 --verbose then
+	"$1" /usr/bin /usr/bin "$@" then then export -eu export export "$@" awk $(pwd)
+		done --verbose cd --verbose
+	"$@" readonly /usr/bin printf grep "$1" printf && "$1"
+	/usr/bin 2>/dev/null readonly "$@" "$@" $(pwd) test done echo 'quoted text' readonly
+		--verbose cd grep export local readonly
+	printf echo awk printf -eu test && /usr/bin
+	test && local then ${HOME} && $(pwd) "$@" echo -eu printf cd
+--verbose /usr/bin "$@" && printf $(pwd) x=1 $(pwd)
+		sed local echo ${HOME} --verbose sed 'quoted text' local $(pwd) done test
+sed | printf local x=1 echo "$@" ${HOME} readonly | cd --verbose ${HOME}
+-eu awk "$1" --verbose done export awk x=1 "$1"
+	| $(pwd) && then test "$1" awk ${HOME} awk awk
+	"$1" then $(pwd) readonly local | $(pwd) --verbose
+/usr/bin | /usr/bin printf then 'quoted text'
+--verbose && 2>/dev/null export 2>/dev/null then "$@" sed --verbose
+local && "$1" sed awk ${HOME}
+${HOME} awk echo then echo /usr/bin "$@"
+printf sed export awk done cd $(pwd)
+	${HOME} "$1" grep | printf then x=1 awk echo
+		$(pwd) awk x=1 test x=1 ${HOME} local cd "$@" echo printf /usr/bin | "$@"
+		x=1 | sed --verbose | grep 2>/dev/null
+		-eu "$@" "$@" test sed ${HOME} -eu $(pwd) test /usr/bin readonly then awk -eu
+| grep readonly test grep done /usr/bin then "$@" 2>/dev/null
+	-eu sed awk sed && awk | export 'quoted text' $(pwd)
+done 'quoted text' "$1" test cd done sed 2>/dev/null "$1" /usr/bin export
+	local readonly /usr/bin cd | "$@" awk test test $(pwd) printf awk | && -eu export
+		"$@" ${HOME} awk cd $(pwd) printf x=1 ${HOME}
+| cd -eu done printf 'quoted text' grep /usr/bin done --verbose
+		then printf printf done && &&
+	&& x=1 | echo 2>/dev/null local readonly | ${HOME} /usr/bin ${HOME}
+	done x=1 2>/dev/null ${HOME} 2>/dev/null done --verbose && /usr/bin "$1" x=1 -eu
+	"$1" ${HOME} && local | done x=1 --verbose /usr/bin test "$1" grep
+		"$1" grep 2>/dev/null
+	"$@" $(pwd) grep $(pwd) -eu
+"$1" ${HOME} test local x=1 sed done --verbose export x=1 then "$1" --verbose awk
+local && grep 2>/dev/null --verbose -eu done echo
+2>/dev/null cd test awk cd then 'quoted text' awk ${HOME}
+	${HOME} sed -eu printf
+"$1" && export x=1 export printf echo $(pwd) /usr/bin -eu echo done
+readonly test echo x=1 | test printf | $(pwd) sed 2>/dev/null
+-eu --verbose 'quoted text' export echo "$@" local 2>/dev/null --verbose
+| x=1 $(pwd) ${HOME} x=1 test 'quoted text' -eu "$@" local local echo $(pwd)
+done && | 'quoted text' && grep then
+	grep awk sed local /usr/bin /usr/bin ${HOME} done export printf export printf
+	readonly && && done readonly printf "$1" $(pwd) awk "$@" 2>/dev/null /usr/bin
+		readonly sed sed then local then
+export && awk done readonly echo -eu done 'quoted text' "$@"
+-eu | done export sed "$@" | sed grep readonly
+	then done sed readonly echo -eu sed sed x=1 test local "$1" "$@" | cd "$@"
+"$1" x=1 local 'quoted text' && printf "$@" 2>/dev/null x=1 awk
+		test 2>/dev/null && printf readonly -eu "$@" echo export 2>/dev/null
+		done printf x=1 | && readonly 'quoted text'
+	--verbose printf --verbose awk
+echo then sed "$@" --verbose /usr/bin
+printf echo 2>/dev/null && ${HOME} ${HOME}
+		export x=1 && done readonly --verbose echo cd printf readonly
+	export sed test printf $(pwd) done readonly
+export ${HOME} test echo /usr/bin done 2>/dev/null "$@" local printf x=1
+		then --verbose readonly readonly ${HOME}
+		'quoted text' local then grep echo | awk grep /usr/bin done then cd $(pwd)
+readonly | sed export
+	sed "$@" cd awk --verbose local "$@" --verbose "$1"
+		$(pwd) test export cd grep | readonly then 'quoted text'
+	2>/dev/null export local awk ${HOME} local 'quoted text'
+		awk 'quoted text' | x=1 $(pwd) ${HOME} grep $(pwd) && /usr/bin && then
+"$1" -eu 'quoted text' -eu echo --verbose echo 'quoted text'
+		sed local readonly 'quoted text' grep
+local "$@" /usr/bin export sed readonly sed 'quoted text'
+		$(pwd) done awk readonly 2>/dev/null
+2>/dev/null printf ${HOME} ${HOME} "$1" sed local $(pwd)
+		x=1 $(pwd) 'quoted text' /usr/bin test
+	export 'quoted text' test echo $(pwd) ${HOME} && $(pwd)
+		&& /usr/bin cd readonly
+		grep readonly "$@" done sed --verbose
+		--verbose then "$1" $(pwd) awk grep cd then local -eu
+		-eu --verbose "$1" && local awk && $(pwd)
+	readonly "$1" 2>/dev/null /usr/bin
+	then local test -eu 'quoted text' "$1" 2>/dev/null "$1" awk 'quoted text'
+		awk readonly | x=1 -eu export cd grep printf --verbose
+	grep test -eu done 'quoted text' echo /usr/bin 'quoted text'
+$(pwd) $(pwd) $(pwd) "$1"
+		| test awk readonly $(pwd) | done awk "$@" /usr/bin /usr/bin --verbose sed done
+test then export printf readonly "$@" readonly
+	export then /usr/bin sed cd "$@" cd cd 'quoted text' ${HOME} "$1" /usr/bin
+		2>/dev/null printf grep done $(pwd) $(pwd) then 2>/dev/null && local $(pwd)
+	"$@" 'quoted text' ${HOME} ${HOME}
+test && grep echo sed 'quoted text' echo -eu ${HOME} local $(pwd) $(pwd) awk
+	x=1 && "$@" then "$1" /usr/bin grep -eu readonly 2>/dev/null x=1 test
+		2>/dev/null printf done done
+		done "$@" local && export && "$1" sed printf export
+	printf export sed x=1 | export | sed 2>/dev/null
+--verbose | export ${HOME} sed x=1 "$@" done echo readonly awk "$@" readonly "$1"
+		'quoted text' done cd local echo local 'quoted text' readonly $(pwd)
+awk ${HOME} printf /usr/bin printf "$1" -eu /usr/bin awk
+		x=1 2>/dev/null "$@" then readonly 'quoted text' readonly
+	printf printf done 'quoted text' local test awk
+then done ${HOME} --verbose printf grep | --verbose sed cd
+		local test "$1" "$@" printf --verbose
+		2>/dev/null test readonly && 2>/dev/null 2>/dev/null
+		| --verbose awk "$@" export then awk done grep -eu
+	test local awk --verbose export then sed && 2>/dev/null 'quoted text'
+	2>/dev/null x=1 $(pwd) ${HOME} /usr/bin | ${HOME} x=1 grep readonly
+		-eu --verbose /usr/bin --verbose && $(pwd) "$1" -eu printf
+	x=1 local test x=1 readonly grep done local test /usr/bin done export
+$(pwd) ${HOME} echo done echo "$@" grep export ${HOME} test x=1 sed grep
+		sed | --verbose done grep "$@" done "$1" "$1" grep 2>/dev/null
+	"$@" readonly sed local 'quoted text' 'quoted text' sed readonly readonly cd
+test done export readonly export ${HOME} $(pwd) $(pwd) export /usr/bin -eu
+		grep x=1 && local && x=1 grep -eu 2>/dev/null $(pwd) cd && "$@" "$1" 'quoted text'
+	test printf local -eu $(pwd) "$1" export 'quoted text' "$@" /usr/bin --verbose
+		"$@" && cd readonly test /usr/bin 2>/dev/null 2>/dev/null
+cd cd --verbose echo printf
+	local "$@" awk ${HOME} export /usr/bin readonly /usr/bin cd printf "$@" && sed
+		/usr/bin grep 'quoted text' /usr/bin ${HOME} $(pwd)
+-eu -eu 'quoted text' done ${HOME} | "$@"
+		local -eu printf grep local done test ${HOME}
+	readonly --verbose grep ${HOME} grep --verbose readonly
+		'quoted text' export test
+cd "$1" test x=1 readonly
+		/usr/bin --verbose 2>/dev/null sed
+		readonly 2>/dev/null ${HOME}
+/usr/bin -eu "$1" local readonly /usr/bin -eu ${HOME} ${HOME}
+		then readonly sed done ${HOME} "$@" 2>/dev/null then --verbose --verbose
+		cd 'quoted text' 2>/dev/null then readonly --verbose 'quoted text'
+test x=1 $(pwd) then -eu readonly
+		printf --verbose echo
+		${HOME} grep readonly then then /usr/bin echo | then readonly --verbose -eu
+$(pwd) local test awk "$@" && echo printf
+	echo | "$@" done --verbose printf sed
+printf -eu $(pwd) | "$1" 'quoted text' && 2>/dev/null && test --verbose cd "$@"
+		"$1" -eu sed echo ${HOME} echo --verbose
+	done && | 'quoted text' test cd /usr/bin
+	awk 'quoted text' readonly echo readonly test printf done "$1"
+		x=1 -eu awk x=1 done
+		x=1 local sed | then $(pwd) -eu ${HOME} then /usr/bin
+		x=1 cd x=1 x=1 echo test ${HOME} echo /usr/bin
+		$(pwd) --verbose /usr/bin "$@" /usr/bin cd sed "$@" cd test echo test
+	readonly x=1 cd 'quoted text' "$1" --verbose done cd "$@" | test
+/usr/bin /usr/bin echo export test then
+	-eu 'quoted text' printf "$@" $(pwd) -eu awk --verbose cd
+printf /usr/bin cd 'quoted text' 2>/dev/null "$1" grep | | "$@" test then $(pwd)
+printf test --verbose printf awk -eu
+/usr/bin done grep 'quoted text' cd sed "$@" "$1" printf test export echo
+	2>/dev/null awk export awk sed
+	local --verbose /usr/bin 'quoted text' echo 2>/dev/null
+--verbose -eu x=1 --verbose x=1 test then cd cd test 'quoted text' x=1 ${HOME}
+--verbose "$@" "$1" 2>/dev/null -eu readonly && --verbose -eu printf && printf
+	| --verbose /usr/bin sed export 'quoted text' x=1 grep done
+/usr/bin --verbose /usr/bin echo $(pwd) "$@" && done cd sed cd ${HOME} 'quoted text'
+		awk "$@" echo awk printf 'quoted text'
+	then sed echo 2>/dev/null | awk printf test
+$(pwd) local "$1" cd ${HOME} 2>/dev/null local readonly 2>/dev/null
+		cd "$1" local "$@" cd awk && | "$@"
+local echo local | grep && awk readonly sed $(pwd) ${HOME} &&
+		'quoted text' 'quoted text' cd readonly cd $(pwd) ${HOME} && 'quoted text'
+		test "$1" printf --verbose /usr/bin x=1 done x=1 export -eu ${HOME} export --verbose
+| awk /usr/bin then 2>/dev/null sed done "$1" readonly
+/usr/bin 2>/dev/null test /usr/bin "$@" && sed 'quoted text' export sed
+sed export ${HOME} readonly printf /usr/bin /usr/bin
+	done ${HOME} | cd test |
+x=1 readonly grep ${HOME} test sed cd local x=1 2>/dev/null then --verbose
+	$(pwd) then awk cd test "$@" test export done then
+	/usr/bin -eu 2>/dev/null printf
+	"$1" cd local "$1" echo "$1" done local cd export -eu
+		local local /usr/bin ${HOME} --verbose 2>/dev/null
+		-eu "$1" "$@" && grep test readonly test local export done
+		readonly done "$1" cd cd
+	/usr/bin /usr/bin ${HOME} $(pwd) awk awk done ${HOME}
+		export test readonly test readonly
+		sed readonly ${HOME} 'quoted text' echo --verbose --verbose
+	&& grep cd "$1" export local local readonly $(pwd)
+	test /usr/bin echo ${HOME} "$1"
+		done 'quoted text' "$1" 2>/dev/null readonly
+	"$1" sed test && export sed $(pwd) echo test awk test
+	grep sed /usr/bin test --verbose
+		'quoted text' export ${HOME} readonly ${HOME} local x=1 done cd /usr/bin grep
+then "$1" grep cd --verbose echo "$1" then /usr/bin
+	then test /usr/bin /usr/bin export x=1 test x=1 'quoted text' echo --verbose
+echo echo "$@" /usr/bin | && 'quoted text'
+grep done awk | echo cd &&
+${HOME} 2>/dev/null | sed echo 'quoted text' x=1 grep /usr/bin x=1 local
+	test export export 'quoted text' grep awk "$@" printf -eu
+-eu && local "$1" $(pwd) x=1 -eu ${HOME} ${HOME}
+		test "$1" 'quoted text' "$1" --verbose -eu readonly
+	| && --verbose "$1" --verbose cd sed "$@" grep --verbose 'quoted text'
+then ${HOME} echo grep printf grep echo $(pwd)
+'quoted text' 'quoted text'
+local printf /usr/bin ${HOME} awk
+	sed 'quoted text' local ${HOME} local /usr/bin local $(pwd)
+	"$@" 2>/dev/null readonly sed local --verbose echo "$1" 2>/dev/null $(pwd) "$@"
+	local local printf test grep 2>/dev/null awk awk
+sed ${HOME} echo x=1 "$@" printf sed x=1 printf cd awk ${HOME}
+${HOME} /usr/bin sed readonly --verbose export $(pwd) "$@" | export 'quoted text'
+2>/dev/null cd then done --verbose && local done ${HOME} done && 'quoted text'
+		test echo local $(pwd) then /usr/bin sed x=1 /usr/bin "$1" --verbose sed 2>/dev/null
+	&& then x=1 /usr/bin done --verbose 2>/dev/null
+		export | cd echo 2>/dev/null x=1 readonly "$@" grep $(pwd) test then ${HOME} local
+-eu then /usr/bin "$1" --verbose "$@" grep "$1"
+test ${HOME} echo "$1" ${HOME} | readonly echo ${HOME}
+	${HOME} ${HOME} -eu cd awk cd
+		awk 'quoted text' export
+		awk then done export $(pwd) sed echo "$1" cd "$@" test echo export
+	echo $(pwd) local done -eu "$1" 'quoted text' --verbose readonly && grep /usr/bin
+	"$1" done "$1" "$1" "$@" ${HOME} /usr/bin test printf "$@"
+		2>/dev/null | test printf /usr/bin grep readonly readonly printf
+		export 2>/dev/null ${HOME} export local then cd "$@"
+x=1 export local "$1" x=1 awk "$1" && ${HOME} awk | grep /usr/bin "$1" sed
+2>/dev/null test x=1 sed 'quoted text' $(pwd) awk then
+	${HOME} "$@" local readonly
+	sed sed "$1" export | readonly
+	grep then 'quoted text' x=1 export --verbose
+cd echo ${HOME} ${HOME} $(pwd) test sed awk $(pwd) && printf awk test cd sed
+	&& printf 'quoted text' grep test x=1 sed cd | then local | printf x=1 readonly
+		$(pwd) 2>/dev/null cd grep echo printf then
+readonly grep "$@" then
+		'quoted text' $(pwd) && "$1" sed ${HOME} test printf | --verbose done
+		'quoted text' /usr/bin done |
+local 2>/dev/null | $(pwd) 'quoted text' --verbose
+grep printf -eu printf grep $(pwd) readonly
+cd then -eu && done cd x=1 x=1 then ${HOME} ${HOME} printf 'quoted text' |
+	-eu done export -eu cd test 2>/dev/null && --verbose
+	readonly -eu grep $(pwd) 'quoted text' "$@" 'quoted text'
+"$1" readonly export export 'quoted text'
+local grep x=1 grep grep $(pwd) | test 2>/dev/null
+	test $(pwd) then -eu export sed ${HOME} done $(pwd) "$1"
+	&& readonly export sed 'quoted text'
+sed grep 'quoted text' && readonly -eu 2>/dev/null ${HOME} cd /usr/bin
+'quoted text' awk export x=1 | test done awk
+		grep --verbose printf && "$1" ${HOME}
+cd export readonly grep -eu test 'quoted text' cd | x=1 $(pwd)
+		export local grep 2>/dev/null /usr/bin printf test
+	-eu then readonly readonly echo 2>/dev/null echo
+"$@" -eu grep grep -eu 2>/dev/null sed done local --verbose -eu cd printf
+	'quoted text' ${HOME} | 'quoted text'
+	/usr/bin then awk /usr/bin then "$1" readonly sed printf
+/usr/bin then readonly readonly 'quoted text' x=1 | --verbose echo cd
+	awk awk $(pwd) printf --verbose -eu $(pwd) then --verbose printf /usr/bin
+	sed x=1 /usr/bin ${HOME} done awk && cd export ${HOME} && && "$@" grep
+		done -eu export grep test ${HOME}
+sed awk -eu --verbose $(pwd) grep ${HOME} -eu "$1" awk --verbose
+grep awk test x=1 'quoted text' -eu | ${HOME} done then
+		${HOME} 2>/dev/null awk local "$1" ${HOME} x=1 printf awk printf 2>/dev/null
+		/usr/bin readonly 2>/dev/null "$@" grep | && awk | awk 'quoted text' -eu
+--verbose 2>/dev/null 2>/dev/null test test cd | 'quoted text' export export awk
+	| "$1" export done | ${HOME} export $(pwd) grep "$@" "$@" test readonly 2>/dev/null
+	local readonly --verbose && ${HOME} then 2>/dev/null
+	-eu grep cd $(pwd) ${HOME} echo | export cd cd /usr/bin --verbose printf
+		echo 'quoted text' awk readonly | x=1 printf 'quoted text' test cd --verbose
+${HOME} 'quoted text' -eu "$1" "$@" grep 2>/dev/null printf -eu export "$1"
+$(pwd) "$@" echo awk readonly then then 'quoted text'
+		${HOME} awk echo echo then readonly printf readonly export test sed sed "$1"
+		sed sed --verbose "$@" then $(pwd) x=1 2>/dev/null "$@" -eu test
+		&& $(pwd) "$1" --verbose test sed | then -eu export cd local /usr/bin export
+	${HOME} x=1 then cd -eu $(pwd) test readonly "$1" 'quoted text' && export
+	done readonly export printf local "$@" ${HOME} echo then && ${HOME}
+		-eu x=1 -eu done awk printf /usr/bin test
+		'quoted text' export -eu /usr/bin -eu sed grep awk
+&& test /usr/bin x=1 cd awk cd && "$@"
+printf 2>/dev/null | sed 'quoted text' x=1 local /usr/bin "$1" "$@" then
+		/usr/bin grep $(pwd) local printf && echo x=1 sed /usr/bin
+	'quoted text' then | --verbose | x=1 done ${HOME} echo test x=1 grep --verbose
+cd x=1 2>/dev/null x=1 | -eu echo 2>/dev/null x=1 readonly
+		&& cd printf readonly cd echo awk /usr/bin
+		| 2>/dev/null cd sed grep "$@" readonly && 'quoted text' $(pwd) sed grep sed
+	&& 'quoted text' /usr/bin 2>/dev/null
+	x=1 readonly sed export "$1"
+		then x=1 echo x=1 readonly --verbose 2>/dev/null awk /usr/bin awk ${HOME} "$@" $(pwd)
+		x=1 printf x=1 cd 'quoted text' -eu
+	done then export export local printf local test awk
+--verbose awk -eu echo
+		/usr/bin cd x=1 done $(pwd) printf printf /usr/bin /usr/bin
+		${HOME} 'quoted text' awk $(pwd) x=1 && readonly $(pwd) "$@"
+	local 2>/dev/null local --verbose test "$1" 'quoted text'
+grep cd cd cd x=1 /usr/bin 'quoted text'
+"$1" echo ${HOME} ${HOME} sed 'quoted text'
+'quoted text' echo && awk cd -eu "$@" cd 'quoted text' then "$@"
+export $(pwd) x=1 printf 'quoted text' | $(pwd) local test grep done printf echo
+cd "$@" awk sed 'quoted text' grep echo x=1 ${HOME} export test /usr/bin
+${HOME} 2>/dev/null x=1 "$@" grep awk 2>/dev/null printf
+$(pwd) -eu cd "$1" /usr/bin ${HOME} --verbose "$@" | x=1 | $(pwd) local sed
+	export sed cd readonly awk cd x=1 then test test -eu readonly 2>/dev/null
+"$@" | 2>/dev/null 'quoted text' then -eu printf 2>/dev/null test
+printf $(pwd) $(pwd) grep local grep 2>/dev/null &&
+		done 2>/dev/null 'quoted text' "$@" $(pwd) printf | readonly && "$1" readonly
+		done 'quoted text' then
+		cd "$1" printf export local grep
+		local /usr/bin echo then && test awk |
+then -eu export awk /usr/bin readonly
+"$@" --verbose cd ${HOME} ${HOME} --verbose echo "$@" $(pwd) -eu "$1" -eu echo
+grep sed /usr/bin export --verbose
+	printf cd && local | $(pwd)
+	/usr/bin export "$@" sed then cd && local x=1 test cd /usr/bin sed x=1 'quoted text'
+/usr/bin done 'quoted text' printf then test export --verbose
+		local "$@" /usr/bin ${HOME}
+		-eu grep cd "$@" 'quoted text' echo
+	test sed grep ${HOME} then
+	grep 2>/dev/null 2>/dev/null
+		"$@" cd -eu readonly x=1 cd 2>/dev/null /usr/bin ${HOME} | --verbose sed
+		--verbose 2>/dev/null export -eu local "$@" echo
+test "$@" grep export awk 'quoted text' readonly then cd local done
+		2>/dev/null then "$@" && echo grep 2>/dev/null printf | awk "$1"
+test && 2>/dev/null awk grep $(pwd) -eu test printf
+	&& && --verbose "$@" echo "$@" && /usr/bin echo printf printf x=1 && test
+"$@" ${HOME} 'quoted text' local local grep
+		2>/dev/null awk "$1" 2>/dev/null export 2>/dev/null x=1 "$1" "$@" done
+| grep readonly grep "$1" printf awk 2>/dev/null
+&& sed $(pwd) local echo cd /usr/bin -eu readonly /usr/bin done
+	'quoted text' "$1" printf 2>/dev/null
+	readonly test "$@" printf $(pwd) awk readonly /usr/bin then "$1" grep ${HOME}
+"$@" done $(pwd) /usr/bin
+		-eu cd sed 2>/dev/null awk -eu && grep /usr/bin
+	&& "$@" cd -eu "$@" -eu sed export readonly 'quoted text' then x=1 | printf readonly
+sed test "$@" --verbose then local
+readonly --verbose -eu sed sed echo 'quoted text' && x=1 --verbose export readonly
+	done then cd test -eu 2>/dev/null "$@"
+	local readonly && 'quoted text' readonly
+	'quoted text' /usr/bin export 2>/dev/null
+printf printf -eu | local grep ${HOME} cd 2>/dev/null x=1 ${HOME} printf awk ${HOME}
+readonly echo | ${HOME} test -eu grep grep && x=1 && printf && done
+		${HOME} test 'quoted text'
+	sed && --verbose readonly /usr/bin && sed "$@" grep
+	'quoted text' && readonly --verbose && printf $(pwd) /usr/bin done 2>/dev/null
+then done "$1" readonly | sed then /usr/bin 'quoted text' awk 'quoted text'
+	&& "$@" 'quoted text' "$@" /usr/bin test awk cd sed done x=1 ${HOME} grep local
+		"$@" && ${HOME} then "$1" "$1" x=1
+		'quoted text' then "$@" && done awk readonly cd done
+'quoted text' grep && "$@" "$@" ${HOME} sed x=1 "$1" $(pwd) sed cd | "$1" && 2>/dev/null
+	then /usr/bin readonly ${HOME} export
+		2>/dev/null test && grep -eu test echo local x=1
+		export 2>/dev/null then $(pwd) then "$@" -eu local --verbose
+		--verbose $(pwd) "$@" done x=1 test
+&& cd local 'quoted text' && grep -eu
+	| $(pwd) && "$@" | sed test awk x=1 2>/dev/null printf export
+'quoted text' 'quoted text' then sed --verbose "$1" readonly "$@" | 2>/dev/null
+done ${HOME} | echo echo "$@" "$1" "$@" echo "$1"
+-eu local | echo "$@" echo | sed sed test then ${HOME} test "$1" done
+x=1 grep printf x=1 awk
+		"$1" -eu test sed x=1 readonly ${HOME} export --verbose 'quoted text'
+	'quoted text' /usr/bin done readonly grep
+		$(pwd) --verbose awk cd then -eu local "$1" then test
+	cd "$@" /usr/bin 'quoted text' ${HOME} grep local --verbose
+	&& printf test | readonly sed "$@" x=1 done test 2>/dev/null "$1" printf test |
+	'quoted text' sed test 2>/dev/null local && 2>/dev/null && test test
+	--verbose ${HOME} 2>/dev/null
+		echo export --verbose cd 2>/dev/null echo printf "$@"
+	$(pwd) readonly --verbose test | "$@" printf export /usr/bin test
+/usr/bin echo -eu "$@" cd readonly "$@" | done
+		awk awk readonly --verbose | sed cd $(pwd) then cd test x=1 test echo /usr/bin
+printf readonly ${HOME}
+--verbose test $(pwd) /usr/bin /usr/bin echo
+readonly $(pwd) readonly "$1" -eu -eu done awk grep --verbose
+	grep then then test done /usr/bin
+	&& --verbose done sed readonly --verbose && /usr/bin then printf local -eu "$@"
+'quoted text' export 'quoted text' 'quoted text'
+		local readonly cd | cd 2>/dev/null
+	$(pwd) readonly grep x=1 then 'quoted text' x=1 "$@" then printf
+	grep x=1 x=1 && x=1 --verbose 2>/dev/null /usr/bin 'quoted text' x=1 "$@" |
+test grep local x=1 "$@" sed -eu --verbose export printf cd --verbose
+| printf done cd printf "$1"
+	$(pwd) /usr/bin ${HOME} printf --verbose
+	done export grep readonly printf then done "$1" cd grep export grep ${HOME}
+		/usr/bin "$@" awk readonly "$1" readonly
+		'quoted text' | "$@" awk 'quoted text' echo then /usr/bin test
+	| ${HOME} export sed sed "$@" grep readonly --verbose then
+	readonly echo awk 2>/dev/null test export sed test 'quoted text'
+	x=1 awk readonly awk readonly ${HOME} sed /usr/bin && test grep
+	export -eu "$@" then 'quoted text' x=1 sed cd 'quoted text' x=1 local
+	sed done -eu "$@" printf done "$@" "$1" cd local
+"$1" ${HOME} -eu /usr/bin | local grep 'quoted text' cd sed readonly printf
+'quoted text' ${HOME} export 'quoted text' test x=1 done printf $(pwd)
+"$@" echo sed --verbose "$1" $(pwd) $(pwd) printf done $(pwd) 'quoted text'
+		local -eu grep test "$1" awk sed awk 'quoted text' /usr/bin
+	2>/dev/null /usr/bin sed "$@" echo -eu then "$@" cd test | test then
+readonly /usr/bin grep then x=1 readonly ${HOME}
+readonly "$@" "$1" sed -eu readonly
+		test test && export then x=1
+	readonly && "$@" -eu grep test then
+		"$1" printf readonly cd echo -eu export "$@" x=1
+	"$1" | test | readonly 'quoted text' ${HOME} grep "$1" local sed && x=1 |
+	done -eu /usr/bin $(pwd) then --verbose
+	sed 'quoted text' printf then test x=1 local export 'quoted text'
+-eu "$@" | "$@" 'quoted text' "$1" test echo
+	readonly grep 'quoted text'
+		-eu sed 'quoted text' ${HOME} echo
+		--verbose "$@" sed 'quoted text' | 'quoted text'
+		"$1" 2>/dev/null | && echo ${HOME} grep | echo
+		readonly then ${HOME} "$@" $(pwd) ${HOME} echo ${HOME}
+"$@" && awk done --verbose "$@" ${HOME} sed && /usr/bin ${HOME}
+		"$1" "$@" printf --verbose readonly
+		/usr/bin $(pwd) 2>/dev/null
+"$@" sed readonly 2>/dev/null
+readonly printf readonly ${HOME} --verbose && sed --verbose ${HOME}
+	-eu -eu 2>/dev/null 'quoted text' && printf -eu --verbose
+		local echo awk ${HOME} && && $(pwd) then cd cd $(pwd) test "$@" $(pwd)
+		sed "$@" then then "$@" "$@" --verbose
+then && test grep | done cd "$1" $(pwd) ${HOME}
+	readonly "$1" "$1" echo done 2>/dev/null
+	then cd --verbose 2>/dev/null then printf cd /usr/bin
+		printf -eu readonly ${HOME} && | x=1 test 'quoted text'
+	"$@" && /usr/bin x=1 --verbose 'quoted text' sed echo 2>/dev/null grep
+readonly 'quoted text' x=1 && done export test
+	sed 'quoted text' | readonly sed "$@" then && sed
+| x=1 export awk $(pwd)
+		awk && printf "$@" 2>/dev/null printf && echo
+/usr/bin printf /usr/bin -eu 'quoted text' test cd && printf printf awk readonly
+		export export x=1 /usr/bin grep then printf
+		sed 2>/dev/null then "$1" export grep grep test test
+		done local export /usr/bin -eu readonly x=1
+		${HOME} done sed ${HOME} then -eu echo export --verbose
+-eu printf grep | --verbose ${HOME}
+x=1 export 2>/dev/null x=1 sed sed
+awk echo readonly done $(pwd) --verbose
+grep done awk "$1" -eu test /usr/bin readonly "$@" "$@" grep "$1"
+	echo awk cd done cd | $(pwd) readonly local awk && | then
+	x=1 -eu --verbose -eu x=1 readonly sed /usr/bin cd test 2>/dev/null export
+		then -eu export -eu printf && /usr/bin test "$1" && then "$1" | | echo
+	cd -eu "$1" | then 2>/dev/null ${HOME} cd readonly ${HOME} $(pwd) "$1" cd
+printf test x=1 grep "$1" /usr/bin echo
+	$(pwd) cd echo awk sed cd "$@" 2>/dev/null
+2>/dev/null ${HOME} x=1 readonly 'quoted text' 2>/dev/null "$1"
+		x=1 /usr/bin grep awk /usr/bin readonly
+	'quoted text' ${HOME} done
+		sed then sed "$1" "$@" --verbose | awk awk local | then sed "$1" echo then
+		$(pwd) grep export && done
+		export "$1" export | sed
+done sed 2>/dev/null --verbose then printf
+		test "$@" awk local /usr/bin done "$1" done ${HOME} test
+		x=1 | ${HOME} local then /usr/bin readonly awk
+		'quoted text' test "$1" then && local readonly $(pwd) 2>/dev/null
+&& test ${HOME} -eu 'quoted text' readonly /usr/bin printf export local $(pwd)
+		"$@" cd printf x=1 then $(pwd) cd x=1 export --verbose cd $(pwd)
+		x=1 printf sed echo /usr/bin x=1 grep test 'quoted text' --verbose
+&& /usr/bin 2>/dev/null x=1 test "$@" $(pwd) --verbose printf "$1" 2>/dev/null
+test "$1" printf export export awk /usr/bin cd
+	awk test 2>/dev/null cd x=1 local printf done --verbose readonly done 2>/dev/null
+		--verbose --verbose cd local done printf done x=1 'quoted text'
+		awk echo 2>/dev/null $(pwd) printf cd && then local readonly && then echo
+printf echo sed sed readonly ${HOME} awk 'quoted text' "$@"
+		done printf sed grep readonly 'quoted text'
+	sed cd --verbose export printf echo /usr/bin done x=1 readonly
+	'quoted text' awk /usr/bin export local echo export readonly /usr/bin
+local done ${HOME} $(pwd) $(pwd) -eu test --verbose -eu then printf
+		readonly $(pwd) -eu "$@" /usr/bin
+${HOME} grep done grep 'quoted text' 2>/dev/null
+	printf local then sed readonly export -eu echo awk 2>/dev/null | then grep
+		local awk done export echo
+done test test ${HOME} x=1 grep 2>/dev/null echo awk done "$1" then
+		$(pwd) /usr/bin --verbose done sed /usr/bin done local done
+		"$1" /usr/bin test sed 2>/dev/null "$@"
+sed printf 2>/dev/null ${HOME} cd
+done done cd 'quoted text' export
+		x=1 x=1 'quoted text' ${HOME} | sed export /usr/bin
+	"$1" ${HOME} && ${HOME} test
+'quoted text' grep ${HOME} && x=1 local
+printf -eu "$@" test sed && | 'quoted text' done export "$@" sed | --verbose
+&& 'quoted text' && 2>/dev/null
+		$(pwd) "$1" printf $(pwd) sed then cd /usr/bin -eu then
+/usr/bin 2>/dev/null | echo then awk local grep
+2>/dev/null echo awk ${HOME} /usr/bin printf "$1" | "$@" export ${HOME} readonly
+	-eu ${HOME} "$@" cd cd x=1 readonly done 2>/dev/null then grep then
+2>/dev/null sed printf sed echo "$@"
+	readonly test sed 'quoted text' 2>/dev/null grep "$1" then export
+$(pwd) sed 2>/dev/null
+		'quoted text' --verbose 2>/dev/null "$@" then echo echo "$@" /usr/bin grep /usr/bin
+2>/dev/null then local export export
+	export export then awk "$@" ${HOME}
+		&& ${HOME} grep ${HOME} printf then --verbose x=1 && --verbose /usr/bin
+	grep done then $(pwd) done 2>/dev/null test
+		"$@" "$1" printf done awk --verbose printf done
+then then 2>/dev/null
+	echo awk readonly awk -eu
+	| done 2>/dev/null awk $(pwd)
+	-eu "$@" 2>/dev/null && x=1 local
+		"$1" awk local 'quoted text' cd | printf sed readonly test
+	x=1 done printf done readonly --verbose grep export test ${HOME}
+x=1 x=1 ${HOME} grep then 'quoted text' awk sed
+		&& x=1 awk then "$@" -eu grep && awk 2>/dev/null done -eu local --verbose
+		/usr/bin grep $(pwd) local cd && 'quoted text'
+	$(pwd) then --verbose "$@" local | printf 2>/dev/null $(pwd) local
+cd "$1" -eu readonly "$@" x=1 x=1 "$@" readonly --verbose printf cd printf
+test then printf 'quoted text' sed "$1" "$@"
+		/usr/bin readonly export
+		cd -eu 'quoted text' then then
+	"$1" | x=1 ${HOME} local echo done local done printf ${HOME} x=1 echo 'quoted text'
+"$1" awk --verbose 'quoted text' sed $(pwd) "$@" echo echo "$@" $(pwd) | --verbose
+		readonly sed export ${HOME} && ${HOME} readonly printf
+	$(pwd) "$@" && $(pwd) 'quoted text' "$1" sed grep readonly echo printf
+	$(pwd) "$1" export && /usr/bin grep x=1 "$1"
+	"$1" local test grep
+	${HOME} --verbose 'quoted text'
+	--verbose | done | --verbose local "$1" /usr/bin
+		${HOME} x=1 "$@" done echo
+readonly --verbose done "$@" $(pwd) test echo /usr/bin x=1 then 'quoted text'
+	test /usr/bin printf "$@" readonly cd then
+then echo /usr/bin "$@" export local
+	then awk then readonly readonly /usr/bin
+cd cd echo test printf -eu echo export 'quoted text' $(pwd) 'quoted text'
+local then grep sed "$1" readonly "$1" ${HOME} readonly
+		then && /usr/bin readonly export grep
+		cd awk 'quoted text' x=1 readonly "$@"
+/usr/bin grep test x=1 readonly test "$1" --verbose /usr/bin "$@"
+awk | cd done grep test 2>/dev/null readonly
+	then 2>/dev/null readonly -eu
+		test readonly --verbose "$1" echo grep "$@" $(pwd) /usr/bin cd then then local
+	done awk local grep sed 2>/dev/null /usr/bin "$1" x=1 "$@" 2>/dev/null /usr/bin
+		export export test then local sed --verbose 2>/dev/null echo
+grep 2>/dev/null 'quoted text' readonly && "$@" && done
+local printf done export printf | done cd then export local x=1
+		test 'quoted text' | then /usr/bin $(pwd)
+	done -eu done then x=1 readonly
+	2>/dev/null cd then export --verbose sed | /usr/bin done && test "$1" /usr/bin
+printf printf 'quoted text' 2>/dev/null /usr/bin printf "$@" "$@" && local
+		then local 'quoted text'
+		awk 2>/dev/null printf export readonly --verbose "$1" printf
+cd 2>/dev/null grep done "$1" && sed ${HOME} grep
+	-eu done grep done --verbose readonly && sed --verbose cd echo
+	export printf test sed | $(pwd) sed
+	export cd then then printf echo $(pwd) test -eu local 2>/dev/null | 'quoted text'
+	then local ${HOME} && -eu test printf
+cd done | "$@" awk awk 2>/dev/null export sed 2>/dev/null
+${HOME} local cd "$@" && 'quoted text' printf grep readonly
+		grep "$@" 2>/dev/null "$@" local test "$1" $(pwd) echo $(pwd) then x=1 "$@"
+&& done test /usr/bin export | then readonly
+	&& $(pwd) 'quoted text' x=1 awk 2>/dev/null
+	local readonly test "$@" 'quoted text' /usr/bin then export local -eu
+	'quoted text' grep test 2>/dev/null x=1 local cd ${HOME}
+		echo export then printf && x=1 "$@" cd && "$@" echo
+'quoted text' then awk ${HOME} |
+readonly echo 'quoted text' grep | --verbose local awk awk | ${HOME}
+	/usr/bin "$@" -eu readonly /usr/bin 'quoted text'
+		test test "$@" grep /usr/bin local "$1" sed echo
+${HOME} $(pwd) --verbose 2>/dev/null 'quoted text'
+	done local test export
+awk $(pwd) test x=1 local /usr/bin | sed x=1 done sed 'quoted text'
+awk "$@" sed awk done done --verbose -eu local
+then "$1" /usr/bin $(pwd) test /usr/bin "$@" export then readonly
+x=1 'quoted text' awk -eu 2>/dev/null 'quoted text'
+		-eu "$@" awk 2>/dev/null grep then local cd && sed "$@" then done "$@" /usr/bin
+		then test readonly $(pwd) $(pwd) sed export
+export awk awk /usr/bin 'quoted text' | $(pwd) test -eu /usr/bin $(pwd)
+	| export && done "$@" "$1" then x=1 2>/dev/null test then echo ${HOME} local
+	grep done && grep grep then ${HOME} --verbose x=1 2>/dev/null
+	| printf readonly | printf 'quoted text'
+	"$1" export awk 'quoted text' "$@" $(pwd)
+	x=1 2>/dev/null --verbose /usr/bin cd -eu "$@" awk $(pwd) ${HOME} 2>/dev/null --verbose
+		"$1" test x=1 printf --verbose 'quoted text'
+	readonly "$@" test awk -eu 2>/dev/null cd "$@" grep test local done ${HOME}
+awk cd | $(pwd) test cd then local echo printf
+		export printf awk "$1" then printf cd ${HOME} 2>/dev/null ${HOME}
+	echo ${HOME} local cd cd $(pwd) /usr/bin -eu done && sed "$@" x=1 2>/dev/null
+	awk 2>/dev/null echo awk echo $(pwd)
+		cd awk && x=1 printf awk | sed sed ${HOME} x=1 $(pwd) then | done readonly -eu
+then 'quoted text' | readonly sed "$1" "$@" 2>/dev/null x=1
+sed 2>/dev/null then test
+		--verbose printf x=1 --verbose x=1 x=1 $(pwd) /usr/bin
+		awk /usr/bin -eu && x=1 sed printf printf
+printf 2>/dev/null ${HOME} "$1" $(pwd) then x=1 grep --verbose /usr/bin echo
+sed /usr/bin export echo -eu cd 2>/dev/null -eu x=1 && echo
+		then awk awk readonly --verbose 'quoted text' echo done "$@" ${HOME}
+sed $(pwd) /usr/bin x=1 export | awk && "$1" "$1" 2>/dev/null ${HOME} ${HOME}
+printf then /usr/bin printf --verbose /usr/bin
@@ -0,0 +1,2001 @@
+		--verbose test /usr/bin | "$1" sed ${HOME}
+${HOME} 'quoted text' done "$@" cd awk done cd $(pwd) awk --verbose --verbose
+done awk x=1 local -eu 'quoted text' $(pwd) then cd printf
+		test sed /usr/bin 2>/dev/null awk local
+	| export --verbose -eu printf
+		local echo local /usr/bin export | sed readonly 2>/dev/null cd 'quoted text'
+$(pwd) "$@" $(pwd) x=1 readonly local | $(pwd) printf sed "$@" "$1" awk 'quoted text'
+	printf cd "$1" "$1" --verbose | /usr/bin 'quoted text'
+done local cd sed 'quoted text' export ${HOME} ${HOME} printf 'quoted text' readonly
+		| /usr/bin printf x=1 then then cd readonly --verbose grep
+2>/dev/null awk && test cd grep 'quoted text' $(pwd)
+| $(pwd) --verbose printf && $(pwd) ${HOME} | x=1 export awk x=1 -eu
+		awk $(pwd) grep readonly ${HOME} sed 2>/dev/null -eu 'quoted text' local sed
+	readonly $(pwd) 2>/dev/null readonly awk cd printf done -eu local readonly
+	done --verbose 2>/dev/null test -eu readonly 'quoted text'
+2>/dev/null test -eu |
+	grep export cd done echo /usr/bin ${HOME} x=1 grep | test -eu
+	${HOME} $(pwd) then | awk sed | -eu | --verbose export printf done echo local
+	cd printf printf $(pwd) --verbose
+	x=1 grep awk && | x=1 ${HOME} then x=1 ${HOME} | ${HOME}
+		${HOME} && ${HOME} "$@" local 2>/dev/null 'quoted text'
+	export local $(pwd) awk $(pwd) export
+grep "$1" printf /usr/bin done awk test
+	then "$1" sed export --verbose "$@" /usr/bin local echo /usr/bin
+	then local -eu export local /usr/bin x=1 ${HOME}
+		$(pwd) grep x=1 'quoted text' /usr/bin 'quoted text'
+--verbose "$@" cd 'quoted text'
+		sed /usr/bin sed x=1 printf
+	done export --verbose -eu sed export | local 'quoted text' test "$@" then /usr/bin
+	2>/dev/null "$@" x=1 test sed $(pwd) cd "$@" $(pwd) grep done export
+printf done done then readonly done 'quoted text'
+-eu "$1" "$1" export readonly "$1" grep then && "$@" sed $(pwd)
+&& -eu 2>/dev/null 2>/dev/null 2>/dev/null
+cd echo echo cd --verbose --verbose "$1" | 'quoted text'
+local -eu printf 2>/dev/null grep echo sed sed "$@" export readonly
+	readonly 2>/dev/null 2>/dev/null && sed 2>/dev/null sed sed then readonly
+printf | test "$1" test export readonly /usr/bin done
+	"$1" printf printf --verbose
+		"$1" ${HOME} echo readonly grep --verbose echo printf test
+sed grep sed && ${HOME}
+then 'quoted text' awk $(pwd) 'quoted text' done ${HOME}
+		"$@" awk ${HOME} export then -eu /usr/bin x=1 2>/dev/null
+	"$@" awk grep local test --verbose
+	then "$1" && --verbose 2>/dev/null
+		local export | done | | x=1 ${HOME} ${HOME} 2>/dev/null sed test local
+local then echo 2>/dev/null echo printf cd --verbose
+		cd 2>/dev/null "$@" 'quoted text' $(pwd) then test "$1" export then done export
+printf /usr/bin "$1" then "$@" x=1 export $(pwd)
+	'quoted text' awk 'quoted text'
+		export "$@" 2>/dev/null readonly sed -eu $(pwd) x=1 "$@" readonly ${HOME}
+	local ${HOME} "$1" grep | cd $(pwd) printf echo test
+then local x=1 "$@" cd test export -eu
+	x=1 && "$1" export /usr/bin "$@" --verbose
+'quoted text' && ${HOME} then ${HOME} -eu ${HOME} 'quoted text' grep "$1"
+2>/dev/null echo sed grep export $(pwd) "$1" x=1
+	cd then sed | done x=1 echo cd $(pwd) sed && printf -eu 2>/dev/null
+		then printf awk ${HOME} x=1 x=1 cd done x=1
+	2>/dev/null cd /usr/bin export -eu 'quoted text' 2>/dev/null local $(pwd)
+		then ${HOME} && /usr/bin
+	x=1 2>/dev/null test printf export printf --verbose
+		done $(pwd) -eu printf export export 'quoted text' done then
+	/usr/bin export && awk /usr/bin done echo test
+	printf cd "$@" -eu "$@" grep echo x=1 then readonly sed ${HOME} $(pwd) done
+		$(pwd) $(pwd) export $(pwd) | "$1" 2>/dev/null 'quoted text'
+	echo then sed sed done && "$1" $(pwd) then sed --verbose printf printf local
+		test export local grep sed cd test --verbose
+		sed | sed grep awk 'quoted text' /usr/bin grep -eu then sed local awk test cd
+		echo awk test 2>/dev/null readonly | "$@"
+		export "$1" done then done "$@" sed /usr/bin && export awk x=1 'quoted text' "$@"
+		cd "$@" done readonly /usr/bin 'quoted text'
+&& local && | && "$@" x=1 -eu 'quoted text' 'quoted text' test done
+	'quoted text' done "$1" printf
+	2>/dev/null test readonly readonly local printf readonly cd awk grep echo
+	-eu && printf $(pwd) local export
+		&& | $(pwd) printf $(pwd) x=1 x=1 'quoted text' echo | cd --verbose --verbose
+sed | then 2>/dev/null --verbose printf -eu | -eu /usr/bin echo $(pwd) $(pwd)
+--verbose test echo readonly grep test echo
+echo "$@" printf 2>/dev/null x=1 cd --verbose 2>/dev/null
+		&& test sed test "$1" sed grep printf readonly test | echo $(pwd)
+x=1 awk awk awk printf cd 'quoted text' done && then awk && && "$1" done ${HOME}
+		local --verbose sed x=1 printf cd grep cd sed "$1" "$@" ${HOME}
+grep "$@" --verbose "$@" 2>/dev/null | "$@"
+		$(pwd) | && done echo readonly echo cd "$@" grep ${HOME} "$1" | x=1 grep
+		printf --verbose ${HOME}
+then --verbose "$1" --verbose
+		local && cd $(pwd) cd then export
+	grep export printf test "$@" cd then "$@" echo -eu ${HOME} cd then
+&& --verbose printf && /usr/bin |
+	awk | done $(pwd) | /usr/bin "$@" then echo | done --verbose 2>/dev/null
+	export "$1" ${HOME} 2>/dev/null -eu done x=1 --verbose
+	printf echo done test printf readonly $(pwd) test awk echo && local sed
+	$(pwd) 2>/dev/null grep x=1 --verbose export then printf /usr/bin --verbose
+		done "$@" x=1 echo "$1" cd awk x=1 | --verbose
+	local export local cd
+		awk 'quoted text' echo 'quoted text'
+	-eu ${HOME} export then export
+	export sed | "$@" done "$1" local 'quoted text' "$1" -eu
+-eu 2>/dev/null "$1" local export ${HOME} done 2>/dev/null
+		| export -eu x=1 --verbose && | $(pwd) | x=1 --verbose
+		done sed printf awk ${HOME} cd export
+		--verbose -eu grep export grep
+echo cd cd export "$@" echo "$1" "$@" "$1" cd ${HOME} && printf local
+		awk 'quoted text' ${HOME} awk then export readonly
+2>/dev/null /usr/bin printf local
+'quoted text' x=1 x=1 x=1 test echo readonly "$@" -eu export -eu
+	grep done awk /usr/bin --verbose | |
+'quoted text' -eu -eu test grep awk | done awk local
+		--verbose cd readonly && echo then printf then $(pwd)
+		x=1 /usr/bin done sed /usr/bin /usr/bin 'quoted text' 2>/dev/null
+	${HOME} test test done "$@" awk && readonly
+	echo done done --verbose "$@" && printf --verbose local 'quoted text'
+	${HOME} && printf awk && "$@" sed ${HOME} echo ${HOME} awk
+	printf x=1 && "$1" awk grep | readonly "$@" local "$@" sed | test cd
+	x=1 awk $(pwd) -eu sed 'quoted text' "$@" grep ${HOME}
+	local test | --verbose cd then readonly test export sed /usr/bin
+		"$1" | && then /usr/bin then -eu then /usr/bin &&
+		printf -eu then test local
+		test $(pwd) "$@" 2>/dev/null grep printf test
+		"$@" 'quoted text' grep | $(pwd) then
+local cd grep local -eu grep 2>/dev/null "$@"
+	-eu "$@" "$1" && export && "$@" local cd echo test grep --verbose awk grep
+	printf ${HOME} sed --verbose 2>/dev/null then $(pwd) export then
+"$@" test 'quoted text' -eu "$1" cd done export
+grep then local "$1" sed 2>/dev/null ${HOME} awk |
+export x=1 local cd local
+		$(pwd) $(pwd) 2>/dev/null
+	${HOME} readonly echo cd x=1
+		cd x=1 cd done echo "$@"
+awk cd "$@" $(pwd) local && 2>/dev/null 2>/dev/null "$1"
+		$(pwd) 2>/dev/null && readonly awk | 'quoted text' ${HOME}
+"$@" sed grep -eu sed /usr/bin && 'quoted text' test done "$1" echo &&
+	test printf | /usr/bin --verbose $(pwd) ${HOME}
+		$(pwd) cd --verbose test "$1" $(pwd) 'quoted text' done /usr/bin
+		readonly -eu "$1" done
+	grep awk $(pwd) -eu printf x=1 'quoted text'
+"$1" test printf "$@" sed printf 2>/dev/null /usr/bin 2>/dev/null
+| 2>/dev/null | export
+	local "$@" /usr/bin readonly
+local awk cd test x=1 printf awk awk | readonly /usr/bin
+	"$@" -eu local sed x=1
+	"$@" readonly cd -eu cd && 2>/dev/null grep local && grep echo $(pwd)
+		'quoted text' export --verbose 2>/dev/null "$@" && 2>/dev/null printf |
+	sed "$@" echo grep | printf export export echo "$@" test
+		${HOME} --verbose test local printf export test ${HOME} local readonly done
+cd -eu printf -eu printf 2>/dev/null
+		readonly grep grep done local grep sed 'quoted text'
+	readonly sed $(pwd) printf /usr/bin test readonly sed ${HOME}
+2>/dev/null | "$1" | grep readonly awk /usr/bin
+		"$@" "$1" export x=1 test export 2>/dev/null
+	'quoted text' echo /usr/bin grep readonly then then
+	&& 'quoted text' && then ${HOME} done 'quoted text'
+		cd cd printf local --verbose awk ${HOME} awk /usr/bin grep 2>/dev/null
+	"$1" printf --verbose x=1 sed -eu /usr/bin local | cd cd awk grep test 2>/dev/null
+done local --verbose /usr/bin
+	echo 'quoted text' local printf --verbose cd sed 2>/dev/null grep printf
+	x=1 && "$@" printf awk /usr/bin done then awk --verbose x=1 2>/dev/null
+		"$@" 2>/dev/null export sed --verbose -eu test -eu awk grep
+readonly test /usr/bin
+grep -eu | then done test echo export "$@" local sed /usr/bin $(pwd)
+"$1" /usr/bin printf export && echo echo 2>/dev/null
+		--verbose --verbose && ${HOME} "$@" -eu cd grep /usr/bin "$1" x=1 awk grep
+	echo x=1 $(pwd) 2>/dev/null 2>/dev/null
+		cd x=1 sed grep ${HOME} "$1" export x=1 awk
+| awk printf grep local $(pwd) test && test -eu 'quoted text' export
+	then awk | printf readonly --verbose 2>/dev/null local 'quoted text' ${HOME}
+	readonly cd cd sed | ${HOME} test /usr/bin sed 2>/dev/null 2>/dev/null
+/usr/bin ${HOME} sed 'quoted text' sed "$1"
+		awk readonly awk $(pwd) | $(pwd) sed grep $(pwd) -eu readonly done done awk
+	echo grep sed --verbose 'quoted text'
+		"$@" done local local 2>/dev/null
+	local sed echo local 'quoted text' -eu /usr/bin | done sed x=1 test
+		/usr/bin grep ${HOME} done 2>/dev/null test readonly awk echo test
+		--verbose -eu | test -eu /usr/bin 'quoted text' "$@" printf ${HOME} "$1" ${HOME}
+cd echo awk x=1 | cd done
+${HOME} readonly --verbose
+		then $(pwd) cd awk cd done
+sed && 2>/dev/null && awk awk cd sed cd ${HOME} sed
+		$(pwd) readonly awk printf -eu awk 'quoted text' readonly export 2>/dev/null
+	&& --verbose && done $(pwd) ${HOME}
+		"$1" local readonly x=1 "$@" export x=1 export ${HOME} | printf $(pwd)
+		2>/dev/null awk done 2>/dev/null local
+x=1 "$1" ${HOME} $(pwd) cd local then export -eu echo
+	${HOME} sed --verbose $(pwd)
+	'quoted text' printf --verbose --verbose then printf readonly readonly
+	$(pwd) | --verbose export | -eu awk /usr/bin /usr/bin && --verbose 2>/dev/null
+	done printf "$1" $(pwd) x=1 x=1 | /usr/bin
+		sed echo 2>/dev/null sed x=1 test 2>/dev/null test then /usr/bin test | grep
+then x=1 export && "$@" "$1" /usr/bin
+	done test $(pwd) 2>/dev/null $(pwd) echo sed test cd sed ${HOME} test
+		done 'quoted text' test printf 'quoted text'
+		cd done 2>/dev/null grep ${HOME} readonly | 'quoted text' cd grep grep printf
+	--verbose 'quoted text' "$@" test then
+then "$1" "$@" -eu printf sed 'quoted text'
+/usr/bin --verbose then echo /usr/bin readonly
+	"$1" -eu readonly | printf
+		printf printf awk 2>/dev/null readonly then --verbose x=1 x=1 test readonly
+		printf echo test export test "$@" 2>/dev/null
+	printf grep local test -eu readonly export x=1 2>/dev/null cd "$1"
+		grep $(pwd) echo ${HOME} test echo printf echo readonly local
+	/usr/bin | awk && "$@" test done
+	readonly | then awk 2>/dev/null $(pwd) test export echo export --verbose then 2>/dev/null
+| export then local export sed "$@" /usr/bin --verbose
+		test "$1" -eu -eu local | ${HOME}
+		| | done sed readonly x=1 sed 2>/dev/null --verbose export
+		x=1 ${HOME} awk && test /usr/bin
+test "$@" export awk 2>/dev/null echo echo 2>/dev/null "$1" sed local echo cd
+		"$@" then x=1 "$1" x=1 echo -eu then ${HOME} && /usr/bin then
+export grep echo sed 'quoted text' "$@" grep cd done done
+	echo then echo cd 2>/dev/null readonly readonly
+test cd x=1 'quoted text' echo --verbose then cd local 2>/dev/null | awk readonly
+		&& done echo "$@" sed cd readonly export -eu 'quoted text'
+		export test /usr/bin local
+		awk awk echo awk --verbose local printf ${HOME} x=1 test
+x=1 then 'quoted text' done printf 2>/dev/null readonly then
+	/usr/bin echo x=1 awk /usr/bin test awk done -eu && -eu then
+cd readonly readonly export $(pwd)
+grep 2>/dev/null "$1" 2>/dev/null "$@" test sed /usr/bin
+	printf grep "$1" then then cd ${HOME} printf
+--verbose -eu echo export && "$@" cd readonly test 2>/dev/null
+		&& && $(pwd) sed test test awk readonly local sed grep
+	| 'quoted text' $(pwd) 'quoted text' awk echo &&
+	done echo test | ${HOME} echo grep done $(pwd) --verbose
+		'quoted text' -eu awk grep 2>/dev/null
+		x=1 readonly export done | test export "$1" && | "$1"
+	&& /usr/bin grep && export ${HOME} local awk -eu sed /usr/bin --verbose 'quoted text'
+	-eu -eu export local grep grep | 'quoted text'
+		-eu && sed test done --verbose --verbose sed /usr/bin | 2>/dev/null
+&& "$@" test readonly then /usr/bin
+	/usr/bin ${HOME} | ${HOME}
+		cd 2>/dev/null done "$1" $(pwd)
+	sed grep "$1" "$@" $(pwd) ${HOME} grep
+	--verbose echo readonly "$1" sed && done echo "$@" --verbose echo ${HOME}
+	${HOME} then cd "$@" x=1 x=1 awk awk sed $(pwd) test /usr/bin 'quoted text'
+	| ${HOME} export /usr/bin cd then x=1 cd then printf ${HOME} ${HOME}
+		awk $(pwd) echo echo readonly grep then ${HOME} awk done -eu printf sed export
+test readonly x=1 done echo --verbose "$@" "$1" x=1 $(pwd) printf
+"$@" "$@" awk x=1 'quoted text' test readonly test ${HOME} sed $(pwd) export
+	test "$1" cd -eu | "$1" export 'quoted text' ${HOME} done awk sed
+sed && then echo sed done done test --verbose && test $(pwd) x=1 printf
+		-eu 2>/dev/null export /usr/bin /usr/bin 2>/dev/null readonly
+	export printf --verbose local /usr/bin export 2>/dev/null
+	-eu && cd echo sed /usr/bin
+--verbose | "$1" echo echo then printf "$@"
+"$1" /usr/bin then grep sed /usr/bin grep export test
+readonly --verbose ${HOME} readonly 2>/dev/null
+"$@" done sed grep cd echo cd
+		'quoted text' 'quoted text'
+	done && 'quoted text' test printf sed test readonly cd done
+		export done awk then readonly done sed ${HOME} 'quoted text'
+	| "$@" then sed 'quoted text' 'quoted text' done --verbose
+	export sed $(pwd) readonly | readonly -eu
+/usr/bin "$1" "$1" --verbose grep local printf sed export awk grep then printf --verbose
+	export 2>/dev/null x=1 printf 'quoted text'
+done 'quoted text' awk export $(pwd) --verbose | /usr/bin
+then export printf export /usr/bin export
+--verbose x=1 -eu cd --verbose
+	"$@" echo "$1" $(pwd) readonly "$@" 'quoted text'
+		grep /usr/bin 2>/dev/null export --verbose
+export /usr/bin local "$@" then
+/usr/bin export "$@" sed x=1
+	2>/dev/null -eu readonly /usr/bin --verbose x=1 "$1"
+test "$@" && done export sed $(pwd)
+	&& 2>/dev/null | then
+awk 'quoted text' "$@" test done 'quoted text' export
+	sed export $(pwd) | awk 2>/dev/null then "$1" echo 2>/dev/null grep "$1" readonly
+	test printf "$@" readonly 2>/dev/null ${HOME} "$@" echo | cd ${HOME}
+	2>/dev/null echo && then printf export /usr/bin 2>/dev/null test
+		'quoted text' then sed --verbose
+		echo ${HOME} --verbose done -eu echo 2>/dev/null $(pwd)
+		then "$@" $(pwd) test grep | "$@" printf export printf --verbose cd test
+		local printf -eu grep /usr/bin export echo /usr/bin "$1" cd grep sed sed
+/usr/bin awk export "$1" | $(pwd) sed 'quoted text' x=1 local printf /usr/bin
+	local done $(pwd) "$1" -eu awk "$@" --verbose done && --verbose
+	local done printf echo echo 'quoted text' done x=1 then 'quoted text'
+	/usr/bin | /usr/bin | echo 'quoted text' then ${HOME} then echo -eu
+		| test 2>/dev/null local awk 'quoted text'
+		/usr/bin test grep ${HOME} awk x=1 | && printf "$1" "$1"
+		${HOME} sed x=1 $(pwd) $(pwd) "$@" export export grep x=1 2>/dev/null
+grep $(pwd) grep test ${HOME} done sed awk then test sed then && /usr/bin
+		awk "$1" then sed && && "$1" awk "$@" $(pwd) test awk 'quoted text'
+		--verbose sed echo x=1 "$@" printf /usr/bin
+echo then sed ${HOME} ${HOME} test "$@" "$1" $(pwd) /usr/bin "$1" cd -eu &&
+	export && cd 'quoted text' /usr/bin test && printf /usr/bin cd
+${HOME} grep -eu "$@" "$1" "$@" $(pwd)
+		echo 2>/dev/null | -eu "$@"
+	cd $(pwd) $(pwd) ${HOME} awk $(pwd) cd $(pwd) 'quoted text'
+		printf local --verbose then readonly -eu printf "$@" awk done "$1" 2>/dev/null
+-eu export grep echo readonly echo test printf local ${HOME} 2>/dev/null
+&& x=1 && local $(pwd) --verbose ${HOME} grep awk 2>/dev/null
+	&& ${HOME} grep grep $(pwd) printf -eu printf
+	"$1" echo test ${HOME} echo
+	&& $(pwd) $(pwd) test done echo readonly "$1" /usr/bin 2>/dev/null
+sed $(pwd) sed 'quoted text' $(pwd) sed echo cd ${HOME} test cd
+	readonly $(pwd) /usr/bin sed echo 2>/dev/null
+	readonly $(pwd) export sed readonly
+	awk awk $(pwd) test then local sed cd readonly | | 'quoted text' awk && $(pwd)
+	awk readonly "$@" "$1" awk | awk echo
+test -eu -eu sed cd 'quoted text' | echo test echo readonly
+done done /usr/bin done export printf $(pwd) "$1"
+	${HOME} x=1 done 2>/dev/null
+		echo ${HOME} done x=1 'quoted text' awk
+| $(pwd) cd echo test local echo
+$(pwd) ${HOME} then echo sed 'quoted text'
+		then $(pwd) done awk ${HOME} | export && 2>/dev/null awk "$@" echo awk sed
+	"$@" ${HOME} then "$@" $(pwd) printf -eu | --verbose "$1" ${HOME} export
+	| readonly $(pwd) /usr/bin -eu
+2>/dev/null export | ${HOME} sed echo readonly
+/usr/bin | "$@" $(pwd) $(pwd) echo /usr/bin sed export && printf 2>/dev/null
+		grep x=1 --verbose 2>/dev/null && /usr/bin
+x=1 'quoted text' echo test x=1 |
+${HOME} --verbose echo 2>/dev/null | ${HOME}
+"$@" test "$1" export readonly /usr/bin then echo then done then ${HOME} | 2>/dev/null
+	awk | printf 'quoted text' /usr/bin printf
+	readonly local cd 'quoted text'
+	--verbose 'quoted text' ${HOME}
+	done 2>/dev/null 'quoted text' | | && ${HOME} | -eu x=1 'quoted text'
+$(pwd) export "$@" readonly 2>/dev/null ${HOME} test echo
+	${HOME} 2>/dev/null x=1 printf $(pwd) readonly readonly | awk
+test export printf 'quoted text' test done test done &&
+	"$1" grep echo && then --verbose ${HOME} then 2>/dev/null -eu sed readonly
+	| awk "$1" /usr/bin --verbose done /usr/bin 2>/dev/null
+x=1 /usr/bin | "$@" $(pwd) "$@" local $(pwd) "$@" readonly sed 2>/dev/null
+		echo test /usr/bin $(pwd)
+	local readonly ${HOME} ${HOME} --verbose done
+	grep printf -eu 'quoted text' "$1" local | && local
+		awk "$@" /usr/bin ${HOME} printf grep
+	"$1" export "$@" -eu export "$1"
+test ${HOME} ${HOME} sed 'quoted text' --verbose test done printf && cd cd
+		test "$1" 2>/dev/null test --verbose then /usr/bin
+		local echo /usr/bin cd then echo $(pwd) "$@" done 2>/dev/null /usr/bin | local
+-eu ${HOME} grep /usr/bin x=1 --verbose
+cd "$@" cd "$1" local --verbose ${HOME} done /usr/bin awk readonly
+	&& grep -eu && awk "$1" readonly local 'quoted text' grep
+		readonly "$1" grep done /usr/bin
+		/usr/bin --verbose "$1" 'quoted text'
+	${HOME} /usr/bin test export local export printf grep
+--verbose cd then 2>/dev/null printf done "$@" sed /usr/bin
+		sed readonly printf local printf /usr/bin done
+		test echo --verbose "$1" sed 2>/dev/null 'quoted text' && then
+		&& grep done awk --verbose ${HOME} then done 'quoted text' printf
+"$@" echo /usr/bin export grep --verbose readonly 'quoted text' done
+		'quoted text' $(pwd) test printf printf x=1 export -eu | "$1" local
+2>/dev/null grep awk && "$@" "$@" "$1" printf ${HOME} ${HOME} | 2>/dev/null && &&
+	printf $(pwd) done done then | -eu "$@" cd then ${HOME}
+		${HOME} -eu ${HOME} "$1" -eu export test
+then then printf done $(pwd) export
+	grep 'quoted text' sed /usr/bin && && --verbose cd sed 2>/dev/null | | printf
+	/usr/bin cd 'quoted text' && "$1" "$1" 2>/dev/null
+&& done export printf cd x=1 'quoted text' done 'quoted text' sed && sed grep 'quoted text'
+	done awk | printf $(pwd) echo -eu
+		'quoted text' cd "$1"
+		local -eu | 2>/dev/null printf | test /usr/bin local --verbose export x=1
+| export printf 2>/dev/null
+awk ${HOME} ${HOME} cd printf readonly
+	"$1" then grep 'quoted text'
+awk awk done grep awk cd then /usr/bin &&
+	/usr/bin echo -eu awk test echo cd 'quoted text' $(pwd) | "$1"
+		"$@" -eu | export printf && "$@" test readonly awk export
+		| -eu done --verbose export
+	&& x=1 grep cd grep --verbose
+		echo -eu awk -eu echo "$1" then export done test test /usr/bin printf
+done && echo then done test
+	| --verbose --verbose /usr/bin /usr/bin | | grep && local | 2>/dev/null
+x=1 ${HOME} cd export 'quoted text'
+	test ${HOME} local sed grep grep sed grep /usr/bin ${HOME}
+		then | ${HOME} local done $(pwd) 2>/dev/null
+	sed sed grep $(pwd) then echo -eu test &&
+x=1 readonly --verbose test $(pwd) ${HOME} done /usr/bin test grep local -eu
+	-eu printf --verbose 'quoted text' echo $(pwd) echo 'quoted text'
+cd echo "$@" then $(pwd)
+		echo && -eu grep echo then local awk test | awk x=1 "$1" 2>/dev/null
+	&& 'quoted text' awk x=1 2>/dev/null printf --verbose &&
+x=1 test test echo test grep --verbose
+		local x=1 2>/dev/null cd
+		local && readonly awk awk cd local grep -eu done
+	cd "$1" /usr/bin && readonly x=1 && test 'quoted text' printf "$@" done
+	| "$1" then x=1 printf -eu done echo done test $(pwd) 'quoted text'
+		${HOME} awk readonly 'quoted text' readonly awk | test
+	/usr/bin printf done export 'quoted text' cd x=1 export cd ${HOME}
+echo $(pwd) --verbose then -eu export test 'quoted text' local awk
+	-eu done --verbose /usr/bin 2>/dev/null
+	${HOME} /usr/bin -eu 2>/dev/null sed echo echo -eu export done /usr/bin
+/usr/bin | cd local export sed sed "$1" test grep -eu | |
+	cd 2>/dev/null awk 'quoted text' sed
+-eu && /usr/bin awk local 'quoted text' local export done printf /usr/bin
+then export x=1 export echo /usr/bin
+		-eu readonly awk export $(pwd) cd x=1 grep echo $(pwd) |
+	&& then grep echo 2>/dev/null x=1 -eu test cd ${HOME} x=1 echo
+	then printf $(pwd) 2>/dev/null local ${HOME} done
+		done /usr/bin $(pwd) -eu 2>/dev/null done &&
+"$@" && x=1 sed done /usr/bin "$@" | sed && ${HOME} -eu 'quoted text'
+		--verbose -eu local $(pwd) "$1" test && ${HOME} "$1"
+	${HOME} sed readonly awk x=1 'quoted text' then /usr/bin 2>/dev/null "$1"
+${HOME} echo readonly -eu done test x=1 local printf | export x=1 readonly
+		-eu then ${HOME} done x=1 && awk 'quoted text' "$@" local
+	then x=1 test ${HOME} printf printf "$@" printf && sed local awk sed "$@"
+		| export $(pwd) --verbose awk x=1 -eu grep export x=1
+		printf cd -eu ${HOME} /usr/bin
+		2>/dev/null export sed && ${HOME} echo /usr/bin
+	&& && cd cd $(pwd) local $(pwd) 2>/dev/null test "$@"
+	then ${HOME} readonly sed grep $(pwd) local /usr/bin 'quoted text' $(pwd)
+x=1 && grep ${HOME} export readonly
+--verbose "$1" && grep sed grep export --verbose
+echo grep echo "$@" then echo done echo
+	echo export $(pwd) awk $(pwd)
+		grep done sed export 2>/dev/null local grep --verbose grep export
+		"$@" -eu cd readonly export done $(pwd) cd && then --verbose $(pwd) $(pwd)
+		printf done done grep "$1" sed && $(pwd) --verbose readonly
+	--verbose ${HOME} | && -eu grep /usr/bin test
+		'quoted text' printf x=1 "$1" ${HOME} grep "$@" local
+		grep test done export -eu -eu then x=1 --verbose
+	&& 'quoted text' sed printf cd cd /usr/bin export grep
+x=1 && && awk echo readonly $(pwd) --verbose echo | 2>/dev/null "$1"
+		"$@" | && readonly export grep /usr/bin readonly export
+		-eu local -eu "$@" /usr/bin x=1 sed cd test $(pwd) "$@" 2>/dev/null $(pwd) cd ${HOME}
+	"$1" export readonly "$1" 2>/dev/null awk awk | 2>/dev/null test ${HOME} -eu
+		"$1" --verbose local printf 2>/dev/null && /usr/bin printf
+		echo -eu echo export $(pwd) cd | local awk 'quoted text'
+		$(pwd) x=1 /usr/bin printf $(pwd) then 'quoted text' | export test export grep
+		-eu "$@" local test readonly grep /usr/bin 2>/dev/null -eu
+export then export awk readonly printf $(pwd)
+	export | 2>/dev/null readonly echo grep /usr/bin && /usr/bin ${HOME} | "$1"
+	done cd 2>/dev/null printf printf && sed export
+	awk sed then x=1 2>/dev/null "$@" /usr/bin ${HOME} "$1" 2>/dev/null | local
+	"$1" cd readonly "$@" 2>/dev/null
+	done && awk x=1 'quoted text'
+		/usr/bin echo export && test grep cd | x=1 /usr/bin "$@" done /usr/bin then
+		cd awk cd "$@" && | $(pwd)
+'quoted text' x=1 --verbose /usr/bin -eu && sed echo 'quoted text' -eu awk export
+--verbose done then 'quoted text'
+		then printf && "$1" "$@"
+	--verbose --verbose local "$1"
+		-eu | --verbose /usr/bin 'quoted text' cd export awk readonly --verbose export test
+"$1" done -eu done then x=1 done then ${HOME} export
+	--verbose export printf x=1 x=1 "$1" "$@" echo printf /usr/bin export
+	${HOME} printf printf 2>/dev/null
+		local ${HOME} "$1" sed echo then export done grep grep echo readonly grep $(pwd)
+		printf awk then export ${HOME} "$1" readonly /usr/bin awk sed
+	local sed readonly export done 'quoted text' local echo ${HOME}
+then "$@" export -eu && printf
+		/usr/bin x=1 echo sed $(pwd) local echo local printf local readonly
+	'quoted text' then 2>/dev/null export "$1" $(pwd) | && done x=1 2>/dev/null local
+	done awk 'quoted text'
+		printf awk && 'quoted text' -eu "$@" 2>/dev/null
+	-eu sed then export /usr/bin cd awk "$1" $(pwd) ${HOME}
+echo "$@" echo sed ${HOME} /usr/bin
+		test readonly echo local
+	test | grep --verbose sed ${HOME} sed
+		--verbose | | cd "$1" sed test printf x=1 sed 'quoted text' cd 'quoted text'
+$(pwd) export | && /usr/bin
+	test 'quoted text' -eu awk | | then "$@" grep local $(pwd) done
+grep $(pwd) /usr/bin $(pwd)
+cd ${HOME} export grep printf then $(pwd)
+echo sed grep done "$@" 'quoted text'
+	echo echo 'quoted text' 2>/dev/null ${HOME} awk /usr/bin export test
+		x=1 echo ${HOME} | x=1 -eu "$1"
+2>/dev/null echo test grep "$@" local x=1 grep 'quoted text' readonly sed &&
+		$(pwd) awk 'quoted text' /usr/bin printf "$1" grep
+		then "$1" awk cd "$1" /usr/bin "$1" --verbose
+		| -eu ${HOME} sed echo 'quoted text' sed grep printf cd done
+		x=1 -eu ${HOME} grep cd echo "$1" sed "$@" | -eu
+	then "$@" local test --verbose
+	2>/dev/null && "$1" local --verbose ${HOME}
+/usr/bin $(pwd) readonly && /usr/bin echo --verbose ${HOME}
+export x=1 readonly 'quoted text' ${HOME} ${HOME}
+		printf printf test x=1 --verbose ${HOME}
+	x=1 | --verbose "$@" test
+		"$1" | awk readonly done $(pwd) --verbose
+	x=1 --verbose then printf test grep 'quoted text'
+printf "$1" then 'quoted text'
+	echo /usr/bin echo grep | ${HOME} test readonly 2>/dev/null printf readonly
+		printf grep x=1 grep ${HOME} "$@" | readonly readonly -eu 2>/dev/null /usr/bin
+	${HOME} --verbose cd then printf /usr/bin
+	sed grep /usr/bin readonly "$1" export printf ${HOME} cd sed ${HOME}
+		x=1 grep done 2>/dev/null readonly 'quoted text' done local readonly
+		test test "$@" done 'quoted text' --verbose
+	&& sed "$1" "$@" x=1 export --verbose && && /usr/bin grep
+	x=1 sed echo x=1 --verbose "$1" ${HOME} export readonly done 'quoted text'
+awk export echo $(pwd) awk &&
+		$(pwd) 2>/dev/null && | export awk done x=1 echo
+		cd "$1" export echo local "$1" -eu echo
+	local "$@" && sed local export --verbose local 'quoted text' local
+		"$1" "$@" echo done echo test
+"$1" awk test then echo sed 2>/dev/null "$1" done awk "$@"
+		then echo awk x=1 && readonly sed
+	| grep cd sed sed export sed | test -eu -eu test grep | grep /usr/bin
+	&& -eu grep /usr/bin $(pwd) grep /usr/bin $(pwd) grep | grep x=1 grep sed
+2>/dev/null 'quoted text' x=1 grep done --verbose 'quoted text' "$1"
+test | /usr/bin 'quoted text' grep sed | sed cd
+/usr/bin test readonly ${HOME} "$@" export $(pwd) grep done -eu 2>/dev/null -eu
+	grep && 2>/dev/null "$1" readonly ${HOME} grep done local "$@" $(pwd)
+	done 2>/dev/null cd echo
+-eu export echo grep then readonly 2>/dev/null export
+	2>/dev/null -eu 'quoted text' 2>/dev/null
+	export sed printf ${HOME} readonly $(pwd) x=1 export then --verbose
+test /usr/bin 'quoted text' local awk /usr/bin cd cd ${HOME} && cd 'quoted text'
+${HOME} --verbose 2>/dev/null && /usr/bin 2>/dev/null
+"$1" then $(pwd) -eu readonly x=1 cd -eu --verbose
+	printf "$1" done echo echo | done done "$1"
+	${HOME} | cd sed readonly echo 'quoted text'
+	2>/dev/null sed sed "$1" --verbose "$1" -eu local done test printf cd then then
+		printf $(pwd) echo printf sed 'quoted text' ${HOME}
+printf $(pwd) "$@" local ${HOME} | "$@" printf sed
+		"$1" echo | readonly x=1 awk grep -eu sed cd -eu
+		"$1" sed done grep 'quoted text' cd 2>/dev/null
+	awk -eu then x=1 echo "$@" local readonly && cd then readonly /usr/bin $(pwd) /usr/bin
+		$(pwd) test cd export
+		local | "$@" readonly "$@" --verbose readonly $(pwd) readonly -eu grep grep
+	${HOME} "$1" cd awk test
+	printf sed printf /usr/bin
+		local 2>/dev/null test 2>/dev/null echo
+		sed test cd awk readonly
+--verbose test printf | awk export x=1 -eu | done
+echo readonly $(pwd) local echo ${HOME} readonly
+readonly then 2>/dev/null && 'quoted text'
+	${HOME} --verbose grep done /usr/bin x=1 -eu echo test echo && 2>/dev/null
+		--verbose -eu cd 'quoted text' local ${HOME} "$@" echo
+	local echo --verbose local --verbose
+grep done x=1 sed grep done $(pwd) | | -eu cd export $(pwd) local readonly
+	| then sed --verbose ${HOME}
+		export readonly then sed export echo
+	x=1 | cd "$1" readonly cd /usr/bin awk done local 'quoted text' printf
+local done "$1" export local /usr/bin sed grep "$@" /usr/bin test
+		then | && /usr/bin | ${HOME} x=1 && export then ${HOME}
+--verbose echo /usr/bin test "$@" -eu grep | $(pwd) x=1 | 2>/dev/null
+	${HOME} && $(pwd) local local done $(pwd)
+printf -eu | done cd && test local -eu cd $(pwd) grep "$@" printf export
+		'quoted text' && export cd local
+	| | "$@" printf export "$1" /usr/bin readonly cd --verbose
+&& export done ${HOME} echo | $(pwd) --verbose test echo 2>/dev/null --verbose
+	&& -eu grep 'quoted text' && --verbose 2>/dev/null /usr/bin cd test
+		/usr/bin 2>/dev/null readonly
+	2>/dev/null local | readonly
+	| grep --verbose 'quoted text' | printf | ${HOME}
+		sed --verbose local -eu --verbose then awk x=1 x=1
+	| then local 2>/dev/null cd ${HOME} "$1" awk local export 'quoted text'
+printf readonly sed awk then | /usr/bin &&
+		2>/dev/null "$1" x=1 "$@" export --verbose --verbose
+		/usr/bin then -eu done 'quoted text' 'quoted text' "$1"
+	2>/dev/null export export readonly "$1" && 'quoted text' "$1" test echo -eu
+	${HOME} "$1" then grep grep echo echo "$1"
+printf echo 2>/dev/null /usr/bin
+	then awk cd grep ${HOME} grep $(pwd) grep then sed $(pwd) printf
+	&& | test $(pwd) then readonly
+	/usr/bin cd echo awk "$@" | x=1 export 2>/dev/null test && printf test
+printf | sed test $(pwd)
+		local awk x=1 "$@" test done
+		test -eu --verbose 2>/dev/null echo grep --verbose | export
+		export awk awk x=1 ${HOME} x=1 test awk done grep 'quoted text'
+	-eu awk && grep printf && then ${HOME} echo "$1" done ${HOME} --verbose sed ${HOME}
+x=1 printf export local readonly done export -eu 2>/dev/null
+	local cd --verbose awk | awk ${HOME} grep cd grep local then echo
+		2>/dev/null /usr/bin "$@" cd ${HOME} ${HOME} $(pwd) echo test done awk local
+test test done readonly
+	readonly printf ${HOME} export awk /usr/bin
+		2>/dev/null $(pwd) printf -eu
+		echo readonly grep "$1" x=1 printf readonly sed x=1
+		test 'quoted text' /usr/bin
+		--verbose | $(pwd) | readonly /usr/bin "$@" /usr/bin echo test sed sed
+export awk 2>/dev/null sed /usr/bin "$@" -eu local
+	x=1 export sed x=1 local local x=1 "$@" done 2>/dev/null | $(pwd)
+	-eu done cd echo "$1" local && awk printf | grep readonly then
+--verbose export -eu test
+		"$@" -eu grep $(pwd) "$@" --verbose grep && export -eu export 'quoted text'
+$(pwd) --verbose --verbose grep $(pwd)
+	-eu && export awk local printf grep 'quoted text'
+		echo $(pwd) "$1" done sed local 'quoted text' ${HOME}
+x=1 local "$1" cd /usr/bin
+$(pwd) cd --verbose sed | test && grep local $(pwd) readonly
+		then ${HOME} done -eu export | "$1" x=1 test printf
+	x=1 done 'quoted text'
+	${HOME} x=1 export grep "$@" test grep then
+	test /usr/bin 'quoted text' $(pwd)
+awk sed export --verbose test 2>/dev/null export echo "$1" x=1
+	then | "$1" sed printf $(pwd)
+		export 2>/dev/null "$1" -eu $(pwd) readonly test |
+test cd printf 2>/dev/null -eu done /usr/bin "$1" /usr/bin $(pwd)
+		"$@" awk && ${HOME} --verbose "$1" && cd test $(pwd) sed "$@" done
+local cd --verbose awk sed x=1 && | grep $(pwd) echo x=1 ${HOME} x=1
+		/usr/bin printf /usr/bin grep cd readonly | awk grep 2>/dev/null "$1"
+&& done grep grep $(pwd) 2>/dev/null
+/usr/bin -eu | && "$1" export done 2>/dev/null local
+	"$@" grep $(pwd) test | "$1" 2>/dev/null -eu "$1" 'quoted text' x=1 cd 'quoted text'
+	"$@" "$1" 'quoted text' readonly
+		${HOME} sed done | local readonly && /usr/bin grep $(pwd) ${HOME}
+	&& export test --verbose echo && sed echo ${HOME} printf
+--verbose | grep /usr/bin
+		done $(pwd) test awk awk sed -eu
+		awk cd sed echo then done "$@" --verbose local awk -eu grep cd export local
+then cd local readonly awk "$1"
+	printf echo $(pwd) "$1" | then /usr/bin printf && /usr/bin export
+'quoted text' $(pwd)
+-eu local "$1" x=1 sed export "$1" readonly /usr/bin readonly ${HOME} -eu
+		then grep ${HOME} /usr/bin cd $(pwd) test ${HOME}
+		"$@" 'quoted text' "$1" -eu awk then ${HOME} grep export
+$(pwd) done cd "$1" done done awk printf awk sed echo -eu /usr/bin
+		x=1 sed /usr/bin $(pwd) then $(pwd) 2>/dev/null
+	&& $(pwd) cd x=1 then $(pwd)
+	"$@" x=1 $(pwd) printf --verbose $(pwd) cd | && "$1" --verbose cd awk echo
+| test test && ${HOME} ${HOME} awk $(pwd) "$@" export -eu then test test ${HOME}
+2>/dev/null "$@" | --verbose awk | && /usr/bin awk
+	awk grep --verbose export |
+		awk $(pwd) printf $(pwd) local cd ${HOME} /usr/bin x=1 2>/dev/null awk cd readonly
+		${HOME} test | | "$1" 'quoted text' test
+		${HOME} grep x=1 "$1" "$1" | x=1 done 'quoted text'
+	awk x=1 | sed then sed && test 'quoted text' && x=1 then | local
+		x=1 cd 2>/dev/null && awk | printf sed export | cd -eu ${HOME}
+	echo 2>/dev/null echo sed "$1"
+local "$@" sed x=1 --verbose test $(pwd) test | $(pwd) cd printf then $(pwd)
+		$(pwd) "$1" 'quoted text' test awk then $(pwd)
+		test printf | "$@" grep && awk export printf 2>/dev/null done
+| awk | export echo test awk 2>/dev/null awk export
+	| done "$@" 'quoted text' $(pwd) /usr/bin
+		export export readonly printf printf --verbose -eu ${HOME}
+sed then cd /usr/bin printf 'quoted text' ${HOME}
+	export echo sed sed echo readonly 'quoted text' export --verbose "$@" local
+		--verbose --verbose cd
+"$@" "$@" echo cd local && -eu | -eu then local grep printf grep
+	"$@" grep /usr/bin local --verbose
+	'quoted text' ${HOME} test --verbose 'quoted text' /usr/bin
+'quoted text' sed done echo /usr/bin done && ${HOME} "$@"
+	printf echo done done echo
+	printf done 'quoted text' ${HOME} "$1" --verbose cd local && $(pwd) done awk -eu
+	| x=1 2>/dev/null local ${HOME} "$@" 2>/dev/null
+x=1 -eu export "$1" -eu echo test
+		${HOME} $(pwd) 2>/dev/null export ${HOME}
+	$(pwd) done --verbose test x=1 local grep cd x=1 then 'quoted text'
+local 'quoted text' echo sed then x=1 cd 'quoted text' cd sed printf x=1 x=1
+readonly "$@" "$@" cd printf $(pwd) export "$1"
+then 'quoted text' printf 2>/dev/null
+readonly "$1" && $(pwd) awk awk then echo $(pwd)
+		sed -eu x=1 --verbose readonly -eu x=1 export export "$@" awk then local x=1
+/usr/bin sed -eu echo $(pwd) && ${HOME} export cd export --verbose
+	then sed "$@" echo ${HOME} | export && test readonly export ${HOME}
+		test local x=1 awk $(pwd)
+$(pwd) readonly 2>/dev/null awk echo "$@" cd
+		2>/dev/null echo && then local cd && /usr/bin
+		then export "$@" && ${HOME} test test sed 2>/dev/null /usr/bin -eu
+		cd cd 2>/dev/null cd | x=1 cd "$@" /usr/bin
+	awk /usr/bin ${HOME} 2>/dev/null x=1 cd awk "$@" echo
+'quoted text' test 2>/dev/null grep printf sed ${HOME} "$@" awk --verbose x=1 "$1"
+then x=1 awk then x=1 ${HOME} test echo "$@" -eu grep awk /usr/bin done | awk
+	echo 'quoted text' 'quoted text' sed 'quoted text'
+		'quoted text' export readonly then test
+	x=1 ${HOME} $(pwd) "$@" cd &&
+"$1" x=1 $(pwd) readonly echo grep 'quoted text' printf
+	"$1" printf 'quoted text' readonly |
+export cd 2>/dev/null then 'quoted text'
+	"$1" 2>/dev/null awk sed
+	done then | sed 'quoted text'
+'quoted text' export "$1" done x=1 awk
+		"$1" awk cd awk then export cd && 'quoted text' "$1" x=1 "$@" cd
+--verbose printf sed 'quoted text' then awk echo --verbose
+	awk sed echo 'quoted text' awk /usr/bin grep then sed $(pwd) then test
+		-eu /usr/bin then "$@" test -eu -eu ${HOME} | &&
+grep sed ${HOME} "$1" x=1 x=1 && ${HOME}
+		$(pwd) export "$@" "$@" printf "$1"
+	"$@" local sed done /usr/bin ${HOME} cd --verbose local cd export cd 2>/dev/null
+	printf x=1 x=1 done /usr/bin done local x=1 then "$@" -eu 2>/dev/null
+		--verbose | "$@" "$@"
+	&& sed echo | | 'quoted text' echo sed 2>/dev/null
+-eu 2>/dev/null x=1 then x=1 then test
+x=1 echo grep done grep test | x=1 then
+then grep awk echo cd readonly then echo --verbose readonly $(pwd)
+	x=1 && "$@" /usr/bin 2>/dev/null x=1 -eu readonly sed awk ${HOME}
+echo /usr/bin sed ${HOME} -eu then printf --verbose sed "$@" &&
+awk awk local cd $(pwd) "$1" | export
+	${HOME} awk 'quoted text' echo then "$1" echo &&
+	"$@" x=1 printf sed done -eu "$1" ${HOME} "$@" export printf
+	local export -eu grep readonly sed printf test "$@" --verbose
+		grep cd done --verbose "$@" -eu printf /usr/bin local -eu
+grep | local cd done "$@" /usr/bin &&
+	local --verbose "$1" sed export export grep /usr/bin x=1 -eu then /usr/bin readonly
+$(pwd) cd /usr/bin printf readonly "$@" x=1 readonly echo 'quoted text' printf ${HOME}
+	$(pwd) export -eu echo then
+		sed "$1" x=1 local awk
+		readonly local x=1 --verbose -eu then cd sed $(pwd)
+	printf "$1" then -eu | "$@" x=1 $(pwd) -eu $(pwd) $(pwd)
+	/usr/bin ${HOME} "$@" 'quoted text' 2>/dev/null 2>/dev/null
+x=1 test --verbose readonly grep
+	&& "$@" $(pwd) "$@" /usr/bin "$@" done
+		/usr/bin cd done "$@" -eu readonly 'quoted text'
+printf sed $(pwd) /usr/bin awk 2>/dev/null cd -eu x=1
+--verbose $(pwd) sed 'quoted text'
+echo readonly printf readonly
+		"$@" -eu readonly done export sed "$@" export local
+sed --verbose "$@" echo
+/usr/bin /usr/bin "$1" cd then x=1 --verbose echo
+echo 'quoted text' $(pwd) /usr/bin && readonly x=1 grep grep
+grep | echo done | awk echo
+		| printf "$1" 2>/dev/null local cd awk readonly
+	2>/dev/null cd local sed awk sed ${HOME}
+		/usr/bin -eu readonly then export echo 'quoted text' export
+	$(pwd) ${HOME} x=1 --verbose sed
+2>/dev/null 'quoted text' "$@" readonly test
+	-eu && 2>/dev/null x=1 x=1 sed x=1 | $(pwd) $(pwd) 2>/dev/null
+		$(pwd) awk grep ${HOME} 'quoted text' -eu test test "$1" && printf
+"$@" grep 'quoted text' grep cd then
+	printf $(pwd) sed awk "$@" export test then -eu printf --verbose
+		x=1 && 2>/dev/null "$1" sed export /usr/bin sed export x=1
+		readonly && sed awk done && local local && --verbose "$@"
+&& then done then "$@" test sed $(pwd) sed ${HOME}
+		readonly printf cd 2>/dev/null -eu "$1"
+	$(pwd) then local export
+	printf && | echo done printf then --verbose local 'quoted text' test
+then readonly printf | grep done cd export cd && /usr/bin
+	echo printf awk test "$@"
+	done | sed then printf -eu | $(pwd) then $(pwd) awk "$1" local x=1 awk
+readonly "$1" | printf /usr/bin x=1 export $(pwd) /usr/bin "$1" /usr/bin
+printf --verbose -eu --verbose readonly -eu "$@" "$1" cd 2>/dev/null $(pwd)
+	cd echo --verbose ${HOME} x=1 2>/dev/null
+&& x=1 awk printf test /usr/bin done done test
+		&& echo cd | then then 2>/dev/null x=1 "$@" ${HOME}
+	export test "$1" && sed "$1" awk x=1 ${HOME} "$@" $(pwd)
+		| grep local done then && awk printf then echo | --verbose
+	"$@" "$1" 2>/dev/null grep cd
+then x=1 x=1 "$1" echo $(pwd)
+${HOME} /usr/bin cd "$@" then $(pwd) /usr/bin "$1" x=1 -eu grep done $(pwd)
+		'quoted text' readonly sed $(pwd) readonly local "$1" echo 'quoted text' printf
+cd sed then "$1" export x=1 "$1" awk sed cd readonly
+	test echo "$1" then local ${HOME}
+echo -eu sed printf then test $(pwd) test
+		${HOME} readonly done && sed ${HOME} "$@" cd --verbose sed --verbose
+local cd sed done echo echo grep ${HOME} local local local "$1" | local "$@"
+$(pwd) "$@" local "$@" "$1" sed awk then readonly --verbose readonly grep 2>/dev/null
+	| export 'quoted text' readonly 2>/dev/null 'quoted text'
+readonly then "$@" then
+	done | -eu x=1 awk done export
+&& then echo -eu test ${HOME} echo 2>/dev/null /usr/bin x=1 cd local
+	printf cd export "$@" printf --verbose test --verbose then $(pwd)
+		-eu done x=1 | awk sed export && export grep "$@" echo 2>/dev/null echo /usr/bin
+then "$1" /usr/bin | done $(pwd) awk done "$@" "$@" done cd then /usr/bin
+cd echo && x=1 echo done
+	grep readonly test && 'quoted text' 'quoted text' 2>/dev/null local awk --verbose
+/usr/bin test $(pwd) cd cd "$@" printf export --verbose cd echo readonly -eu grep
+	"$@" && done "$@" "$@" printf sed done /usr/bin --verbose
+		| -eu /usr/bin 2>/dev/null awk
+		then export then test printf then -eu test
+		$(pwd) | grep "$1" 2>/dev/null x=1 'quoted text' sed /usr/bin export | 2>/dev/null
+	'quoted text' then cd done awk echo
+		echo awk echo sed local then
+		&& grep ${HOME} -eu done done && -eu $(pwd) "$@" 2>/dev/null | echo 'quoted text'
+		${HOME} 2>/dev/null 'quoted text'
+	2>/dev/null sed test x=1 x=1 awk --verbose
+	cd then | echo $(pwd) test | /usr/bin local export 2>/dev/null
+		awk awk /usr/bin "$@"
+	${HOME} local printf export local | then ${HOME} local local --verbose
+readonly 2>/dev/null test | done grep done awk awk grep "$1" 'quoted text' x=1 printf
+	--verbose test x=1 awk --verbose "$@" then --verbose && ${HOME} &&
+sed ${HOME} echo grep --verbose readonly done x=1 awk 'quoted text' printf
+echo grep | printf && then $(pwd)
+	-eu cd && -eu x=1 export | 'quoted text'
+	then echo | then && echo 'quoted text' "$1" grep grep done
+	${HOME} readonly cd ${HOME} grep ${HOME} test then ${HOME} --verbose 2>/dev/null
+	done 'quoted text' local ${HOME} /usr/bin grep 2>/dev/null cd sed /usr/bin
+		done "$@" then awk test
+	--verbose grep local x=1 -eu readonly -eu grep
+	"$@" /usr/bin grep 'quoted text' export done 'quoted text'
+${HOME} done echo x=1 test then readonly grep $(pwd) done local
+export 2>/dev/null printf
+"$1" test sed && ${HOME} ${HOME} cd local 'quoted text' export | --verbose export
+	-eu "$1" test test && cd test && test /usr/bin x=1 done test --verbose
+	x=1 "$@" x=1 printf echo printf "$1" done "$1" readonly
+	cd grep && | then x=1 2>/dev/null --verbose | -eu then
+	local export && cd export done done sed /usr/bin
+	grep /usr/bin echo --verbose echo export awk local -eu sed grep $(pwd)
+		awk local "$@" local export export $(pwd) && cd awk readonly sed test
+/usr/bin grep done cd "$1" sed sed local then then --verbose
+	echo "$@" readonly --verbose cd x=1 test "$@" export && test "$1" 'quoted text'
+	readonly printf test | then awk
+grep ${HOME} sed export
+	awk x=1 ${HOME} awk "$1" ${HOME} 2>/dev/null grep local 'quoted text'
+	x=1 2>/dev/null 2>/dev/null test --verbose
+	echo grep 2>/dev/null printf sed --verbose done 'quoted text' /usr/bin
+		/usr/bin --verbose /usr/bin test --verbose
+		printf "$@" grep printf grep && awk done done -eu ${HOME} readonly
+	&& /usr/bin --verbose ${HOME} "$@"
+	done grep echo cd "$@" ${HOME} "$@"
+test test /usr/bin | "$@" 'quoted text' local local 2>/dev/null sed done --verbose
+	&& awk test cd then readonly --verbose grep
+test then readonly grep $(pwd) sed
+--verbose test 'quoted text' echo --verbose $(pwd) done
+	'quoted text' 'quoted text' 'quoted text' -eu "$@" done grep
+		cd "$@" echo test printf done done awk 2>/dev/null 2>/dev/null 'quoted text'
+	grep readonly $(pwd) 'quoted text' export done --verbose --verbose export
+	echo export --verbose echo export
+done echo printf /usr/bin done local
+test 'quoted text' ${HOME}
+		${HOME} "$1" "$1" done 'quoted text'
+test export echo 'quoted text' sed readonly 'quoted text' 'quoted text' echo ${HOME}
+	echo then 2>/dev/null 2>/dev/null x=1 sed test
+		-eu grep && then /usr/bin echo 2>/dev/null -eu sed awk sed $(pwd) x=1 local
+--verbose printf readonly "$@" /usr/bin test --verbose awk /usr/bin cd awk |
+	${HOME} x=1 readonly local 'quoted text' then ${HOME} cd "$1" x=1 printf ${HOME}
+		&& echo --verbose x=1 -eu "$@" --verbose | export printf then "$1" local | then
+	"$1" "$1" printf "$1" --verbose cd test echo
+		/usr/bin local ${HOME} | "$1" 'quoted text' done
+	| | awk /usr/bin test printf 'quoted text' && sed
+		test -eu echo readonly ${HOME} local cd export /usr/bin | echo then local
+	-eu done cd 2>/dev/null
+	"$1" printf printf "$@" grep --verbose 2>/dev/null "$@" && test local done
+	'quoted text' then sed then export "$1" local
+	readonly x=1 && /usr/bin
+	done && 'quoted text' export sed && printf | done then 2>/dev/null | done
+${HOME} | export then export
+	test | test grep readonly
+	$(pwd) "$@" then /usr/bin "$1" $(pwd) readonly sed x=1 export
+		test ${HOME} ${HOME} /usr/bin -eu -eu -eu 'quoted text' $(pwd) "$1"
+then then --verbose "$1" && printf "$@" -eu readonly export "$@" /usr/bin
+	grep export printf 2>/dev/null
+	"$@" $(pwd) echo x=1 local test test --verbose && 'quoted text'
+	--verbose readonly readonly --verbose 2>/dev/null
+then "$1" x=1 $(pwd) echo $(pwd) local echo
+	-eu sed "$@" then then "$1" awk | local awk local awk 'quoted text' 'quoted text'
+2>/dev/null /usr/bin echo then -eu &&
+		grep grep cd "$@" "$1" -eu 2>/dev/null --verbose sed 2>/dev/null
+$(pwd) sed $(pwd) && 2>/dev/null echo done local "$1" then -eu 2>/dev/null
+	| grep export echo | local echo readonly "$@" /usr/bin $(pwd) printf
+	| printf "$@" ${HOME} "$1" x=1 grep export printf sed
+printf 2>/dev/null --verbose echo && export
+	"$1" --verbose grep /usr/bin 2>/dev/null cd printf | | export printf | x=1 local
+local x=1 x=1 export echo echo 2>/dev/null ${HOME} "$1" 'quoted text' done
+test 2>/dev/null "$1" export 2>/dev/null /usr/bin
+		echo | | echo readonly then "$@" export printf grep --verbose "$@" grep
+		export 2>/dev/null --verbose echo sed
+	grep test readonly && x=1
+	grep grep && 'quoted text' x=1
+	'quoted text' awk | printf ${HOME} done x=1 'quoted text' "$@" 2>/dev/null
+| 'quoted text' && readonly
+	${HOME} x=1 ${HOME} cd 'quoted text'
+| then 2>/dev/null local /usr/bin test | -eu --verbose local
+		test $(pwd) grep sed cd x=1 ${HOME} local -eu export then "$1" 2>/dev/null
+		'quoted text' "$@" awk local "$@" "$1" /usr/bin -eu
+| "$1" test $(pwd) "$@" printf local export cd /usr/bin --verbose
+	cd done export test export
+cd && grep "$@" && 2>/dev/null
+		${HOME} export sed 2>/dev/null then 2>/dev/null
+	"$@" grep test sed && $(pwd) --verbose 2>/dev/null
+		printf -eu echo grep readonly && x=1 $(pwd) test readonly
+	${HOME} local export x=1 sed sed cd printf x=1 x=1 then awk 2>/dev/null
+		local 'quoted text' 2>/dev/null sed "$1"
+	awk 2>/dev/null x=1 done $(pwd) echo "$@" then echo test test "$1" readonly
+x=1 grep 'quoted text' printf && -eu grep printf readonly test
+		export sed grep cd "$1" grep && -eu grep "$1" test | && awk done
+		test $(pwd) x=1 $(pwd) -eu "$@" then "$1" x=1 export cd cd readonly grep readonly
+cd grep 'quoted text' 2>/dev/null export local test test local then
+awk 2>/dev/null done /usr/bin 2>/dev/null done -eu "$1"
+	awk "$1" awk "$@" done local "$@" "$@" ${HOME}
+		${HOME} test /usr/bin "$@" && --verbose cd 'quoted text' echo printf grep
+--verbose test && readonly x=1 -eu $(pwd) | | then readonly
+		&& test awk then "$@" sed readonly readonly cd export --verbose
+--verbose export --verbose /usr/bin local cd cd echo sed x=1 $(pwd) "$@" export
+	-eu /usr/bin awk echo -eu printf | | "$@" grep ${HOME} sed
+		--verbose grep $(pwd) export grep echo printf "$1" ${HOME} then
+${HOME} awk export x=1 printf printf done test readonly
+$(pwd) $(pwd) export echo awk export then echo x=1 $(pwd) local
+	done | && ${HOME} /usr/bin | readonly test sed
+	cd printf 2>/dev/null -eu export sed /usr/bin
+		&& printf 2>/dev/null && awk grep then export x=1 grep -eu done
+		| | awk done -eu && "$1" export echo grep /usr/bin echo 'quoted text' sed | "$@"
+readonly /usr/bin 2>/dev/null --verbose export "$1" echo done ${HOME}
+		"$@" sed local ${HOME} awk sed /usr/bin cd && --verbose printf readonly
+	x=1 && done && test "$@" ${HOME} | local ${HOME} /usr/bin
+"$1" cd --verbose "$1" && then /usr/bin $(pwd)
+done local x=1 test /usr/bin cd "$@"
+	grep /usr/bin printf --verbose | /usr/bin $(pwd) echo /usr/bin cd -eu
+		echo export grep echo then
+		&& | printf 2>/dev/null then $(pwd) test /usr/bin -eu done --verbose
+		then /usr/bin && printf readonly $(pwd) /usr/bin
+"$@" 'quoted text' grep "$1" /usr/bin /usr/bin | cd 'quoted text' cd 'quoted text'
+	2>/dev/null readonly then echo printf "$@" "$1" then 2>/dev/null /usr/bin awk
+		"$1" 2>/dev/null done x=1 echo test done done
+	echo $(pwd) "$@" cd export sed --verbose test ${HOME} ${HOME} printf
+	cd printf && /usr/bin "$@"
+2>/dev/null test /usr/bin "$1" ${HOME} sed sed x=1 printf && then
+local /usr/bin echo && printf readonly
+done "$1" /usr/bin awk done awk sed grep
+	x=1 -eu cd --verbose echo /usr/bin done /usr/bin -eu | 'quoted text'
+	then grep sed then 2>/dev/null && sed sed --verbose "$1" | cd printf local
+	"$@" echo -eu 'quoted text' local x=1 -eu sed $(pwd) echo -eu 'quoted text'
+local -eu export cd -eu "$@" export ${HOME} awk awk printf sed readonly x=1 printf
+		/usr/bin then $(pwd) sed readonly --verbose echo printf
+test printf sed local /usr/bin local "$1"
+cd sed x=1 awk 2>/dev/null printf && --verbose
+	sed 2>/dev/null done /usr/bin
+		awk && test $(pwd) 2>/dev/null grep printf
+		2>/dev/null --verbose cd export
+$(pwd) cd grep ${HOME} printf ${HOME} ${HOME}
+	cd echo --verbose "$1" done -eu -eu && done --verbose
+&& grep $(pwd) sed done cd -eu readonly readonly ${HOME}
+		local awk 'quoted text' -eu echo sed sed && x=1 then printf /usr/bin 2>/dev/null
+		"$1" /usr/bin "$@" "$1" 2>/dev/null --verbose cd then x=1 readonly
+readonly export then echo echo cd local /usr/bin then awk then -eu
+	echo --verbose cd sed ${HOME}
+		test 'quoted text' local echo $(pwd) $(pwd) test "$@" sed export
+	${HOME} readonly awk echo done "$@" sed awk "$@" 2>/dev/null done readonly
+	x=1 | grep -eu --verbose export test readonly done printf
+	'quoted text' echo then export printf $(pwd) export printf local && 'quoted text'
+cd "$1" | local 2>/dev/null "$1" grep
+		"$@" echo done /usr/bin | /usr/bin x=1 "$@" readonly
+readonly echo grep $(pwd) test | "$@" export /usr/bin done printf
+$(pwd) 2>/dev/null echo done done --verbose && local local test then
+		${HOME} /usr/bin printf | --verbose
+2>/dev/null then -eu readonly readonly local "$1"
+awk awk readonly done 2>/dev/null echo awk x=1 | x=1 &&
+	then test 'quoted text' 2>/dev/null export done sed done export 'quoted text'
+		2>/dev/null readonly -eu local echo $(pwd) -eu done done test grep x=1
+done --verbose "$1" 'quoted text' --verbose done | ${HOME} local cd ${HOME}
+		cd /usr/bin readonly local && done cd echo printf 'quoted text' awk readonly
+"$@" cd -eu echo cd grep export awk printf "$@" grep grep echo x=1 x=1
+		export local "$1" grep then | ${HOME} echo local 2>/dev/null && sed ${HOME}
+| local printf local 2>/dev/null | done echo -eu
+-eu 2>/dev/null export local test printf --verbose cd 2>/dev/null cd "$@"
+		-eu printf $(pwd) grep ${HOME} export /usr/bin then readonly local export
+		$(pwd) test x=1 "$@" local "$1" sed done "$@"
+then export echo cd local sed printf x=1 then local 'quoted text'
+	grep cd export /usr/bin "$1"
+		&& && readonly test done test
+	echo awk readonly sed awk cd readonly
+		sed $(pwd) printf ${HOME} --verbose x=1 'quoted text' cd export
+	readonly export export readonly then $(pwd) -eu then
+test ${HOME} export "$@" -eu 'quoted text' grep echo /usr/bin ${HOME} |
+		${HOME} --verbose test echo sed test 2>/dev/null
+sed echo awk test 'quoted text' export
+		-eu "$@" then "$@" grep sed | awk sed 'quoted text'
+awk export x=1 ${HOME} done x=1 --verbose then
+		export sed -eu 2>/dev/null "$@"
+		-eu 2>/dev/null export 2>/dev/null && export printf export grep
+readonly export && printf
+		| echo export printf then
+test --verbose then test test cd printf test x=1 cd | $(pwd)
+${HOME} cd 'quoted text' $(pwd) awk then "$1" --verbose -eu echo
+readonly awk export sed x=1 cd printf && echo grep -eu $(pwd)
+	export && awk -eu 2>/dev/null
+sed export then then "$@" $(pwd) local "$1" printf then 2>/dev/null then
+	readonly echo awk "$1" test $(pwd) local
+$(pwd) done $(pwd) && && ${HOME} grep 2>/dev/null then echo local sed | test
+readonly | test cd done printf done awk printf
+	awk 'quoted text' -eu
+	echo 2>/dev/null 'quoted text' test then echo
+		${HOME} "$1" sed /usr/bin ${HOME}
+	"$@" readonly x=1 cd done x=1 --verbose awk grep "$@" && "$@"
+		| 2>/dev/null echo test 'quoted text'
+		cd 2>/dev/null test ${HOME} x=1 x=1 printf test &&
+		"$1" "$1" grep | "$1" printf x=1 echo local export sed
+&& -eu --verbose $(pwd) grep 2>/dev/null "$1" | "$1" 2>/dev/null $(pwd) --verbose
+		&& | ${HOME} export ${HOME} && x=1 export grep test
+	awk /usr/bin 2>/dev/null /usr/bin echo |
+		then | x=1 | then -eu "$1"
+		awk "$1" --verbose awk "$1"
+local 2>/dev/null && "$@" done echo "$1" "$1" | done | grep && awk local
+	echo sed grep awk local -eu "$1" /usr/bin
+	/usr/bin /usr/bin done local export -eu done x=1 awk | 2>/dev/null --verbose "$@"
+	| ${HOME} echo readonly -eu
+		grep /usr/bin && awk $(pwd) 'quoted text' sed "$1" readonly
+	"$@" && sed 'quoted text' export /usr/bin && 2>/dev/null /usr/bin local sed then
+local local cd --verbose readonly grep
+		local "$1" awk export readonly
+		| readonly x=1 readonly --verbose 'quoted text' -eu "$@" && then
+	echo --verbose "$1" | -eu ${HOME}
+	grep cd ${HOME} "$@" | "$1" x=1 | sed grep
+	awk sed x=1 2>/dev/null grep echo $(pwd) | --verbose && | awk ${HOME}
+'quoted text' grep readonly grep --verbose then cd ${HOME}
+		| sed "$1" 2>/dev/null awk "$1" /usr/bin x=1 $(pwd) -eu
+	-eu /usr/bin done test then sed grep "$@" grep grep awk local 'quoted text'
+	$(pwd) 'quoted text' 2>/dev/null cd
+		echo local --verbose awk ${HOME} then $(pwd) readonly 'quoted text' && -eu -eu
+	${HOME} grep x=1 export /usr/bin "$@" export | readonly /usr/bin | "$@"
+		"$1" grep awk "$@" 2>/dev/null -eu 2>/dev/null /usr/bin && test local |
+	--verbose sed $(pwd) "$@"
+	done "$1" test printf awk $(pwd) echo --verbose grep
+done done $(pwd) -eu x=1 2>/dev/null | ${HOME} && && 'quoted text'
+		echo $(pwd) --verbose cd awk /usr/bin && sed x=1 'quoted text' x=1 'quoted text'
+		"$@" test ${HOME} x=1 2>/dev/null /usr/bin -eu printf printf /usr/bin 'quoted text'
+echo test then -eu ${HOME} 2>/dev/null
+		local local done x=1 done x=1 | cd done then ${HOME} 2>/dev/null 2>/dev/null
+	test then test test done test x=1 "$@" && 'quoted text'
+"$1" cd --verbose cd local then $(pwd)
+		--verbose sed echo sed | echo echo readonly
+"$@" printf cd cd echo grep done done 2>/dev/null local done && test echo -eu
+local x=1 ${HOME} -eu then cd readonly "$1" echo && awk 'quoted text' cd -eu 'quoted text'
+	awk echo echo export x=1 && then -eu local done
+	-eu 'quoted text' printf 2>/dev/null x=1 "$@" awk
+then sed grep echo awk
+	sed ${HOME} echo "$1" -eu && /usr/bin awk done grep grep $(pwd)
+	local test "$@" local readonly then x=1 "$1" | test echo x=1 ${HOME} &&
+		--verbose awk /usr/bin then grep export "$@" export then then cd done 2>/dev/null
+/usr/bin x=1 x=1 /usr/bin
+		/usr/bin ${HOME} awk printf
+	2>/dev/null /usr/bin awk --verbose done 2>/dev/null grep "$1" --verbose
+	local && 'quoted text' && x=1 then readonly
+| /usr/bin $(pwd) 'quoted text' 2>/dev/null "$1" | | ${HOME} local -eu local
+		${HOME} -eu -eu | readonly "$@" awk 'quoted text'
+	awk sed --verbose | --verbose && /usr/bin echo grep printf ${HOME}
+| "$1" echo ${HOME} && 2>/dev/null "$@" then
+/usr/bin cd then then test | readonly then
+		grep cd done test -eu && export done then printf --verbose "$1"
+		/usr/bin && echo echo then
+	-eu test readonly "$1" local -eu ${HOME}
+	cd x=1 sed cd local awk
+#include c208.sh
+	'quoted text' done done
+	| $(pwd) awk then echo then test awk /usr/bin "$@" export /usr/bin
+		cd --verbose -eu printf local -eu printf "$@" echo "$1" grep awk ${HOME} local --verbose
+	&& done echo && readonly done 'quoted text' grep printf awk readonly
+		"$1" "$1" ${HOME} $(pwd) awk $(pwd) $(pwd) ${HOME} then x=1
+		&& readonly export | test test readonly done cd cd x=1 x=1 echo && -eu $(pwd)
+local /usr/bin $(pwd) "$@" sed
+/usr/bin echo readonly /usr/bin x=1
+		grep 2>/dev/null done done readonly "$1" $(pwd) export
+test cd -eu --verbose export then 2>/dev/null "$1"
+readonly cd "$@" /usr/bin --verbose awk awk --verbose export
+grep export echo awk cd readonly
+-eu x=1 2>/dev/null local
+		awk echo awk x=1 then "$@" grep then grep local local grep
+		${HOME} -eu 'quoted text' grep 'quoted text' x=1 printf
+	"$1" "$@" 2>/dev/null readonly ${HOME} echo echo
+sed | --verbose then printf "$1" 'quoted text' readonly --verbose export sed
+${HOME} local done "$@" cd x=1 echo $(pwd) then readonly "$1"
+		then echo 'quoted text' x=1 readonly
+		"$1" export then x=1 local
+local then ${HOME} readonly x=1 readonly grep sed
+--verbose cd awk sed /usr/bin local cd ${HOME} -eu export echo done && "$@" printf
+	cd 'quoted text' awk &&
+x=1 test $(pwd) test 2>/dev/null 'quoted text' local 2>/dev/null
+sed readonly $(pwd) && --verbose -eu cd then readonly "$1"
+	readonly export ${HOME} echo "$1" sed then export x=1 "$1" export --verbose
+		'quoted text' sed x=1 sed cd then "$@" cd | sed printf
+test $(pwd) --verbose cd
+export grep export $(pwd) sed
+| local "$1" export "$@" ${HOME} | awk done export "$@"
+		then awk | 'quoted text' local printf x=1 /usr/bin --verbose
+/usr/bin /usr/bin then /usr/bin echo cd
+x=1 /usr/bin --verbose test sed echo ${HOME} 'quoted text'
+local test done 'quoted text' export local --verbose
+		'quoted text' awk x=1 --verbose readonly cd printf
+then "$1" export echo export && ${HOME} local $(pwd) echo -eu "$@" local
+| 'quoted text' grep cd /usr/bin "$@" done /usr/bin 2>/dev/null "$1" 2>/dev/null
+/usr/bin echo echo printf printf
+		2>/dev/null $(pwd) -eu --verbose local "$1" && -eu grep 2>/dev/null x=1 "$1"
+grep then /usr/bin ${HOME} --verbose -eu then
+	${HOME} done /usr/bin
+	test 2>/dev/null /usr/bin
+		awk -eu --verbose echo local cd local
+	| -eu x=1 echo awk echo readonly grep && --verbose then "$1" && ${HOME}
+export test 'quoted text' x=1 &&
+awk local sed cd -eu "$@" x=1
+2>/dev/null 'quoted text' && done export test awk local ${HOME} ${HOME}
+		printf printf cd echo && grep done readonly awk test
+	echo awk | cd 2>/dev/null
+	/usr/bin -eu && done --verbose
+then "$1" done -eu awk readonly "$1" x=1 ${HOME} then "$1" 'quoted text' grep
+	local && echo export -eu "$@" -eu test test awk $(pwd)
+		"$@" grep "$@" cd printf grep x=1 local
+echo 'quoted text' readonly
+		grep test then awk local export ${HOME} -eu x=1 sed "$@" | x=1
+	${HOME} local local /usr/bin "$1"
+-eu 'quoted text' -eu x=1 local readonly | --verbose then
+2>/dev/null echo "$@" local export sed readonly
+		printf export echo "$1"
+	/usr/bin ${HOME} sed printf printf sed ${HOME} then echo echo
+	${HOME} echo awk 'quoted text'
+	echo "$1" cd --verbose grep readonly &&
+	readonly x=1 "$1" echo 2>/dev/null
+		then -eu printf then 'quoted text'
+		&& $(pwd) -eu 'quoted text'
+${HOME} x=1 ${HOME} local cd echo export
+		-eu x=1 awk local $(pwd) awk awk echo echo grep test local | export then export
+then export "$1" x=1 'quoted text'
+readonly "$1" "$@" grep readonly
+	awk "$1" ${HOME} -eu $(pwd)
+| test -eu printf cd --verbose then test printf --verbose local x=1
+	printf test grep x=1 -eu readonly ${HOME} | $(pwd) sed printf
+2>/dev/null && /usr/bin && sed readonly export
+sed 'quoted text' | ${HOME} /usr/bin awk grep readonly awk echo -eu | ${HOME}
+	test printf x=1 -eu then printf
+	${HOME} echo /usr/bin $(pwd) /usr/bin done
+		cd && | grep done 2>/dev/null "$@" done local -eu
+	then 2>/dev/null | export /usr/bin $(pwd) cd x=1 ${HOME} && "$1" grep "$@"
+		echo local ${HOME} | -eu "$@" | grep awk -eu /usr/bin "$@" $(pwd) printf 2>/dev/null
+	test sed echo x=1 "$@" then "$1" done 'quoted text' printf
+test export | "$@" ${HOME} echo sed cd | awk x=1 readonly awk | --verbose
+		cd 'quoted text' "$1" awk x=1 local /usr/bin ${HOME} then
+	"$@" --verbose && test export export 2>/dev/null 2>/dev/null done
+readonly && 'quoted text' awk
+	done "$1" 'quoted text' local "$1"
+	export $(pwd) /usr/bin ${HOME} 2>/dev/null printf grep
+		sed | done done "$@" cd local printf 'quoted text' done |
+		echo cd "$@" ${HOME} then local local x=1 awk "$@" printf 2>/dev/null "$1"
+		export export "$1" "$1" "$@" grep 'quoted text' 2>/dev/null printf readonly $(pwd)
+		--verbose "$@" x=1 echo --verbose 2>/dev/null | awk local /usr/bin --verbose
+	x=1 cd 'quoted text' export then sed && done -eu then sed "$1" echo export | &&
+	${HOME} test grep cd &&
+		readonly "$1" "$@" grep "$1" -eu /usr/bin done
+--verbose awk test echo /usr/bin test local --verbose sed done done export
+	-eu "$@" grep printf && && export 'quoted text'
+&& --verbose x=1 done /usr/bin readonly
+cd "$1" done /usr/bin awk &&
+	x=1 /usr/bin export awk echo x=1 printf -eu printf grep --verbose "$@"
+	test 'quoted text' ${HOME} 'quoted text' cd test awk printf awk
+	readonly readonly then export cd grep --verbose | $(pwd)
+awk 'quoted text' --verbose test
+		awk done 2>/dev/null awk printf --verbose local local
+		grep ${HOME} | local --verbose
+	--verbose echo -eu test "$@"
+		then sed $(pwd) -eu cd | 2>/dev/null "$@" printf -eu | 'quoted text'
+	2>/dev/null | printf $(pwd) test ${HOME} | test && | awk sed
+	| local cd echo echo sed then done --verbose grep -eu -eu -eu
+	| | 2>/dev/null 'quoted text' cd echo readonly $(pwd) export
+"$1" "$1" ${HOME} echo | printf echo
+		x=1 | && printf awk then 'quoted text' --verbose /usr/bin
+	/usr/bin 'quoted text' $(pwd)
+	--verbose "$@" x=1 'quoted text' then test -eu --verbose export | grep
+"$@" $(pwd) test echo 'quoted text'
+	-eu 2>/dev/null --verbose done
+		x=1 echo | cd 2>/dev/null 2>/dev/null | local
+local $(pwd) --verbose -eu /usr/bin
+		then ${HOME} awk /usr/bin "$1" --verbose then
+		--verbose local x=1 readonly
+| readonly awk grep "$@" x=1 awk -eu readonly
+awk grep echo "$1" echo grep "$@" grep sed -eu printf echo awk /usr/bin "$1"
+		--verbose sed "$@" echo awk grep
+	"$1" export $(pwd) /usr/bin "$1" cd /usr/bin
+echo export export sed | $(pwd) -eu && echo then export 'quoted text' then
+printf 'quoted text' readonly && $(pwd) export then printf && "$@" && |
+--verbose ${HOME} echo $(pwd) ${HOME} awk cd "$1"
+	local "$@" sed 'quoted text' -eu export | test $(pwd)
+		awk "$@" readonly 2>/dev/null /usr/bin sed local -eu grep grep
+	printf echo -eu sed |
+$(pwd) awk "$1" grep local test ${HOME} 'quoted text' local
+2>/dev/null sed "$1" "$1"
+		local local -eu x=1 sed awk "$1" test x=1
+		readonly printf "$@" echo | echo 'quoted text'
+		'quoted text' ${HOME} grep awk && -eu export --verbose
+		| awk ${HOME} && 'quoted text'
+local | echo ${HOME}
+		export 2>/dev/null | "$@" test then 2>/dev/null
+	--verbose 2>/dev/null 2>/dev/null
+	printf "$1" && "$1" | test readonly --verbose readonly then
+$(pwd) printf done "$1"
+printf cd local export echo "$@" done && local done
+	'quoted text' && then readonly 'quoted text' test 'quoted text'
+	x=1 "$@" local printf 2>/dev/null $(pwd) -eu "$@" "$1" readonly export
+		/usr/bin sed done "$@" export awk grep "$@" $(pwd) echo cd 'quoted text'
+		/usr/bin test then then test echo echo "$1" "$@" echo
+	local -eu /usr/bin echo
+readonly /usr/bin /usr/bin $(pwd) 'quoted text' local done printf $(pwd)
+	x=1 sed echo then ${HOME} ${HOME} ${HOME} -eu cd 'quoted text'
+	$(pwd) -eu local awk --verbose 2>/dev/null export then awk -eu echo sed
+	export cd echo test done $(pwd) -eu --verbose done -eu sed | | sed readonly echo
+	done "$1" | "$1" cd cd $(pwd) -eu --verbose echo local printf x=1
+'quoted text' 'quoted text' test export $(pwd) /usr/bin x=1 export -eu "$@"
+	done awk ${HOME} test | /usr/bin --verbose
+		test "$@" then cd cd ${HOME} then -eu x=1 --verbose | && && /usr/bin 'quoted text'
+	&& export then "$1" ${HOME} $(pwd) &&
+	then "$1" printf | && "$1" "$@" x=1 then -eu /usr/bin 'quoted text' | readonly
+| --verbose | $(pwd) echo readonly then 'quoted text'
+printf | ${HOME} echo "$@" local
+x=1 --verbose "$1" readonly readonly test sed printf export ${HOME} --verbose
+printf test | then sed then
+&& sed x=1 then /usr/bin export
+	"$1" | then && && grep printf
+		&& awk grep "$1" awk cd 'quoted text' && && x=1 --verbose
+		cd local printf x=1 $(pwd) $(pwd) ${HOME}
+	awk test $(pwd) "$1" x=1
+		echo awk then && --verbose 2>/dev/null done awk
+	2>/dev/null 'quoted text' 2>/dev/null
+	local "$@" $(pwd) | -eu sed && ${HOME} "$1" local cd readonly -eu grep --verbose
+		"$1" local local grep x=1 printf awk sed ${HOME}
+	sed awk ${HOME} readonly readonly echo -eu awk "$1" 2>/dev/null | awk echo then
+	cd cd local done ${HOME} cd
+done -eu cd x=1 | done /usr/bin
+		done ${HOME} 2>/dev/null $(pwd) --verbose && cd awk local 'quoted text'
+	-eu 'quoted text' && 'quoted text' awk export 'quoted text' -eu then $(pwd)
+--verbose local grep "$1" test ${HOME} ${HOME}
+	x=1 test /usr/bin test test "$1" export awk
+	local local | x=1 -eu local cd export 'quoted text' 'quoted text'
+	sed done "$@" echo x=1 sed $(pwd)
+	&& | 2>/dev/null "$1" readonly
+	${HOME} x=1 && x=1 $(pwd) done $(pwd) awk 2>/dev/null 'quoted text'
+		${HOME} x=1 readonly sed 'quoted text'
+		echo printf /usr/bin x=1 | echo export done test grep 2>/dev/null
+	echo /usr/bin "$1" | ${HOME} &&
+2>/dev/null done readonly "$1" done "$1" x=1 readonly awk | 'quoted text'
+'quoted text' grep cd then x=1 -eu awk printf local then awk then sed "$@"
+-eu | x=1 awk 'quoted text' readonly
+local --verbose printf "$@" -eu
+		echo 'quoted text' "$@" grep ${HOME} awk grep awk | /usr/bin 2>/dev/null $(pwd)
+	local && | 2>/dev/null 'quoted text' x=1
+		2>/dev/null awk x=1 grep "$1" sed "$1"
+	export grep printf readonly -eu sed |
+		--verbose 'quoted text' 2>/dev/null x=1
+	echo $(pwd) && $(pwd) cd readonly 'quoted text'
+	"$1" "$@" local readonly export grep && test readonly --verbose && && && done
+test 'quoted text' --verbose --verbose
+${HOME} sed ${HOME} cd then ${HOME} awk grep ${HOME} -eu | test awk $(pwd)
+echo grep awk /usr/bin ${HOME} && "$@" then test 2>/dev/null 'quoted text' test
+		--verbose sed local readonly export echo export -eu echo sed readonly 2>/dev/null
+		echo -eu readonly local grep awk cd readonly grep
+		| -eu "$1" local -eu "$1"
+	2>/dev/null && cd && 2>/dev/null
+	test done && --verbose ${HOME} test readonly readonly
+${HOME} readonly x=1 readonly readonly sed 2>/dev/null
+		2>/dev/null local cd | readonly | local export "$@" -eu 2>/dev/null --verbose
+		export then $(pwd) | x=1 "$1" | printf | done export export "$1" test
+	"$1" printf 2>/dev/null grep test grep echo | /usr/bin x=1 done 'quoted text' "$@"
+		local --verbose 'quoted text' && done "$@" /usr/bin "$1" "$1" "$@" ${HOME} --verbose
+	echo done local ${HOME} "$1" "$@" local "$1" sed /usr/bin
+&& test awk x=1 cd x=1 /usr/bin "$1" echo 'quoted text'
+&& grep | cd $(pwd) local local local
+	x=1 -eu awk readonly export
+		then --verbose && 2>/dev/null
+	then 2>/dev/null --verbose ${HOME} && -eu awk local
+"$1" awk && $(pwd) done printf ${HOME} export echo grep
+		then --verbose readonly $(pwd)
+	then then then then awk && && x=1
+		test 'quoted text' cd $(pwd) ${HOME}
+sed export /usr/bin awk $(pwd) x=1 | done x=1 'quoted text' --verbose 2>/dev/null
+	$(pwd) --verbose done done printf
+readonly test x=1 | test 'quoted text'
+		| && -eu sed sed && "$1" && printf 2>/dev/null done && /usr/bin sed local | |
+	awk test "$1" local awk readonly readonly $(pwd) 2>/dev/null x=1 x=1 "$1" -eu test
+		sed printf sed "$@" -eu
+-eu printf && done awk
+		readonly 'quoted text' sed sed
+		printf -eu cd export x=1 cd grep readonly x=1
+-eu $(pwd) readonly local
+	sed ${HOME} then test test ${HOME} x=1 echo awk --verbose printf
+${HOME} 'quoted text' readonly
+&& "$@" cd ${HOME} --verbose printf
+export export 'quoted text' ${HOME} /usr/bin done readonly echo
+	then ${HOME} cd | done $(pwd) echo printf
+	/usr/bin local export export test 2>/dev/null export export $(pwd) ${HOME} cd
+readonly export cd then | -eu /usr/bin
+"$@" --verbose echo then && printf
+${HOME} | -eu local awk 'quoted text' readonly
+done echo awk export "$1" grep --verbose && /usr/bin $(pwd)
+cd awk cd grep printf "$1" export
+	2>/dev/null $(pwd) 2>/dev/null --verbose local "$@" -eu 2>/dev/null
+	"$1" "$1" 'quoted text' awk "$@" "$1"
+		"$@" awk --verbose "$1" 'quoted text' | local "$@"
+		'quoted text' $(pwd) "$@" "$1" export | | readonly
+		&& grep && "$1" awk 2>/dev/null x=1 test -eu 2>/dev/null readonly echo test
+	then x=1 printf 2>/dev/null echo 2>/dev/null
+	test /usr/bin export /usr/bin test test
+		export echo test local 'quoted text' ${HOME} "$@"
+	'quoted text' printf $(pwd) "$1" done --verbose sed /usr/bin sed printf x=1
+	"$1" printf export done --verbose
+	grep cd test "$@" export /usr/bin $(pwd) then cd 'quoted text'
+	done echo ${HOME} ${HOME} $(pwd) 2>/dev/null then awk ${HOME} done
+		"$1" local 'quoted text' done sed "$1" readonly ${HOME} 2>/dev/null 2>/dev/null
+x=1 -eu local ${HOME} 2>/dev/null local 'quoted text' ${HOME} "$@" ${HOME} awk
+	sed then /usr/bin then then then 'quoted text' sed "$1"
+awk $(pwd) -eu | "$1" readonly export cd "$@"
+		echo --verbose --verbose 2>/dev/null $(pwd) $(pwd) awk readonly && "$@" && echo
+x=1 printf $(pwd) grep grep | cd x=1 local readonly ${HOME} export local
+	sed 'quoted text' /usr/bin printf "$@" && && $(pwd) readonly 2>/dev/null --verbose
+echo local echo export printf | test /usr/bin
+local -eu && 2>/dev/null export "$1" echo done sed "$@" /usr/bin
+cd --verbose then -eu done test done echo grep x=1 then readonly "$@" test
+readonly ${HOME} awk 2>/dev/null then "$@" done "$@" && | "$1" | "$1" printf then
+readonly sed cd -eu --verbose
+awk ${HOME} readonly x=1 "$@" 'quoted text' | local
+		then then | x=1 2>/dev/null readonly /usr/bin
+	--verbose | "$@" test local awk then && x=1 "$@" done 'quoted text' local
+	local && ${HOME} --verbose 'quoted text' local /usr/bin 'quoted text' printf echo
+printf done echo x=1 2>/dev/null ${HOME} cd --verbose local
+		&& x=1 "$@" awk $(pwd) -eu sed /usr/bin
+		cd echo grep then then export cd 'quoted text' readonly then $(pwd) /usr/bin
+&& "$@" "$@" done local $(pwd) | | "$@" echo $(pwd)
+		"$@" awk readonly --verbose export && && sed 'quoted text' && grep
+		${HOME} ${HOME} cd echo grep "$1"
+	sed ${HOME} && local local x=1 "$1" 2>/dev/null
+		cd && -eu /usr/bin ${HOME} 2>/dev/null --verbose
+| done done test | "$@" echo awk awk done grep $(pwd) /usr/bin done
+		| echo "$1" done done test
+	x=1 local awk --verbose awk done printf
+/usr/bin | sed sed | ${HOME} cd done printf --verbose echo done done "$@" $(pwd)
+	"$1" | $(pwd) $(pwd) cd
+		-eu /usr/bin sed && cd
+		printf 'quoted text' 'quoted text' cd --verbose test then local -eu done
+		&& ${HOME} && $(pwd) && grep 2>/dev/null && local 'quoted text'
+'quoted text' 2>/dev/null 2>/dev/null | | 2>/dev/null awk "$@" "$@"
+		readonly cd /usr/bin --verbose readonly
+--verbose --verbose sed sed export sed cd
+		| local x=1 echo then awk cd export test grep -eu awk echo "$@" export
+		"$1" /usr/bin -eu 'quoted text' done awk 'quoted text'
+export x=1 'quoted text' local /usr/bin done sed readonly
+-eu 2>/dev/null sed && --verbose $(pwd) "$@" "$@" ${HOME} "$@"
+'quoted text' readonly | && cd printf /usr/bin
+'quoted text' readonly 'quoted text'
+	-eu echo then test | 2>/dev/null sed && --verbose
+		-eu done 2>/dev/null
+	/usr/bin printf done /usr/bin | | --verbose /usr/bin
+		x=1 test printf 'quoted text'
+local $(pwd) done --verbose x=1 && awk test
+	then "$1" awk -eu awk local done "$1" $(pwd) printf x=1 printf
+	echo "$1" "$@" export /usr/bin -eu /usr/bin
+test $(pwd) readonly $(pwd) && && /usr/bin echo ${HOME} ${HOME} echo awk
+	${HOME} --verbose grep printf -eu awk /usr/bin x=1 "$1" then
+grep && readonly done
+		2>/dev/null awk -eu sed x=1 export
+		x=1 | grep x=1 test ${HOME} --verbose
+	/usr/bin printf /usr/bin "$1" sed -eu /usr/bin test 'quoted text' local
+		printf local -eu -eu echo grep export readonly printf test local
+"$@" 2>/dev/null printf test x=1 -eu grep local local
+/usr/bin cd /usr/bin done then echo "$@" 'quoted text' --verbose
+${HOME} echo then local done x=1 readonly | 2>/dev/null "$1" "$@" local
+		grep -eu $(pwd) printf "$@" grep readonly grep | --verbose
+"$@" sed "$@" $(pwd) echo 'quoted text' cd "$@" cd x=1 'quoted text'
+	done grep | "$@" $(pwd) ${HOME} printf "$1" -eu done test
+done -eu 2>/dev/null done "$1" readonly ${HOME} cd sed readonly ${HOME}
+	$(pwd) /usr/bin | export done --verbose x=1 then 'quoted text' done
+cd printf test ${HOME} "$1" /usr/bin awk grep
+/usr/bin cd "$@" local printf test && echo done grep readonly cd x=1 x=1 --verbose
+	-eu grep "$1" test $(pwd) test "$1" $(pwd) printf $(pwd)
+"$1" then grep readonly "$1" export export echo sed -eu grep x=1
+"$1" done awk "$@" printf ${HOME} export
+	"$1" --verbose echo --verbose 2>/dev/null
+grep /usr/bin printf then $(pwd) "$@" &&
+		${HOME} cd sed local local
+		"$1" /usr/bin local "$@" awk cd echo -eu "$1" /usr/bin then && "$1" cd
+		/usr/bin "$1" readonly $(pwd) test x=1 sed test readonly
+--verbose 2>/dev/null /usr/bin /usr/bin 'quoted text' x=1 | ${HOME}
+		${HOME} test "$1" "$1" x=1 then awk
+	x=1 'quoted text' test | && "$1" 2>/dev/null test "$@" -eu | ${HOME} --verbose
+	x=1 echo --verbose && grep then | readonly then /usr/bin
+export printf /usr/bin awk | $(pwd) --verbose test --verbose
+test echo test sed echo x=1 $(pwd) then then | done x=1 x=1 export | grep -eu
+		sed export printf done cd x=1 "$1" cd echo then sed printf ${HOME} /usr/bin
+	export "$1" | $(pwd) --verbose $(pwd) "$1" readonly 2>/dev/null
+readonly then sed ${HOME} echo -eu 'quoted text' readonly echo export readonly
+then 'quoted text' test cd && $(pwd) awk grep
+	$(pwd) readonly test "$@" /usr/bin readonly --verbose done then | awk
+"$1" awk grep /usr/bin | 2>/dev/null local export
+	awk 2>/dev/null /usr/bin "$@"
+	export && cd readonly printf | awk export 'quoted text' --verbose
+test sed grep readonly "$@" && grep grep ${HOME} /usr/bin --verbose "$@" --verbose
+	$(pwd) "$1" awk x=1 then -eu --verbose done
+		--verbose && ${HOME} sed -eu 2>/dev/null grep then awk
+		2>/dev/null | then 2>/dev/null | grep --verbose
+export 'quoted text' 'quoted text' 2>/dev/null
+		local then x=1 export --verbose export awk ${HOME} --verbose ${HOME}
+	test echo x=1 cd cd "$@"
+		2>/dev/null -eu --verbose
+'quoted text' "$1" then &&
+		echo | sed test | 'quoted text'
+	done 'quoted text' x=1 cd x=1 test /usr/bin readonly export
+done readonly -eu test echo /usr/bin
+	| awk then local done ${HOME} local cd && sed printf local done export echo
+echo x=1 printf awk sed then export test 'quoted text' then cd then -eu
+test then "$1" awk ${HOME} -eu
+	--verbose -eu cd 'quoted text' x=1 ${HOME}
+"$1" readonly sed 2>/dev/null $(pwd) | grep export && "$1" 'quoted text'
+/usr/bin awk /usr/bin sed grep --verbose sed $(pwd) cd export 2>/dev/null
+	${HOME} printf /usr/bin printf echo echo -eu 2>/dev/null
+echo "$@" | --verbose 'quoted text' done sed then $(pwd) |
+		&& cd ${HOME} then cd 2>/dev/null /usr/bin cd grep
+grep /usr/bin cd sed "$1" "$1" x=1 echo "$@" test printf readonly
+		| ${HOME} printf printf echo then -eu |
+	local "$@" done export echo grep grep /usr/bin --verbose test
+		printf $(pwd) -eu sed cd 2>/dev/null 2>/dev/null done "$1" sed readonly
+	readonly readonly echo printf 2>/dev/null then
+done && done -eu grep test | cd x=1 | "$1" "$@" $(pwd) --verbose awk -eu local
+	printf /usr/bin local 'quoted text' export "$1" 2>/dev/null &&
+		test cd readonly done ${HOME} "$1"
+		echo "$1" -eu $(pwd) 2>/dev/null
+readonly then && $(pwd) awk cd
+| 'quoted text' | -eu export echo && /usr/bin then cd 'quoted text'
+$(pwd) echo done printf ${HOME} && |
+		sed ${HOME} | | "$1" /usr/bin 'quoted text' "$@"
+	test /usr/bin "$@" /usr/bin /usr/bin awk readonly /usr/bin
+--verbose printf then cd && "$1" grep
+	done /usr/bin "$1" printf then printf /usr/bin ${HOME} export test
+--verbose -eu $(pwd) ${HOME} 2>/dev/null && && awk $(pwd)
+	/usr/bin export x=1 sed awk x=1 --verbose ${HOME}
+		--verbose ${HOME} --verbose 'quoted text'
+		${HOME} /usr/bin awk "$@" $(pwd) x=1 x=1 test test
+	local cd | grep awk "$1" sed then -eu
+	"$1" readonly "$1" test -eu echo ${HOME} then -eu "$1" ${HOME} "$@" && -eu $(pwd)
+cd $(pwd) printf printf test
+	local ${HOME} then echo 2>/dev/null test && echo -eu export
+	cd 'quoted text' -eu && local cd $(pwd) awk
+	${HOME} awk then grep sed cd | "$1"
+		export local cd echo &&
+	test grep "$@" 'quoted text'
+	local 'quoted text' done echo sed test "$@" /usr/bin x=1 2>/dev/null
+2>/dev/null 2>/dev/null sed test && 2>/dev/null echo
+'quoted text' "$@" "$1" && then awk | /usr/bin -eu sed local
+		awk 2>/dev/null | -eu | && echo
+/usr/bin ${HOME} sed 2>/dev/null
+		x=1 /usr/bin cd /usr/bin ${HOME} printf awk cd x=1 sed
+printf "$@" done test cd local -eu $(pwd) --verbose
+		-eu | "$1" grep echo "$@" | then x=1 local -eu -eu then awk local done
+	2>/dev/null ${HOME} x=1 then grep 2>/dev/null printf cd ${HOME}
+	then test 'quoted text' echo 'quoted text' --verbose
+local 'quoted text' export ${HOME} x=1 then readonly x=1 cd $(pwd) 'quoted text'
+echo export awk cd && then then readonly --verbose "$@" echo /usr/bin done sed "$@"
+	| && 'quoted text' "$@" test awk
+echo test then "$@" -eu export cd ${HOME} then grep cd "$1"
+	local readonly test test readonly $(pwd)
+	-eu readonly /usr/bin echo $(pwd) -eu "$@" --verbose
+	"$1" "$1" --verbose cd then | -eu 'quoted text' "$@"
+	&& done test done 2>/dev/null cd printf then | "$@"
+| local echo --verbose | /usr/bin
+	/usr/bin | readonly -eu sed local grep 'quoted text' ${HOME} && 2>/dev/null
+"$1" then readonly then local -eu && sed ${HOME} test sed | local -eu
+'quoted text' local echo
+readonly -eu ${HOME} echo done awk ${HOME} grep test "$@" sed done cd
+	done --verbose export ${HOME} sed printf awk
+	awk readonly $(pwd) 2>/dev/null
+	"$@" done 'quoted text' x=1
+$(pwd) readonly -eu /usr/bin export done cd
+'quoted text' "$1" then done grep then "$1" cd export echo local /usr/bin done
+		"$@" sed printf | done
+		/usr/bin sed x=1 done grep export |
+done readonly "$1" echo awk awk export 2>/dev/null
+"$@" 'quoted text' /usr/bin "$1"
+done printf cd test readonly 2>/dev/null $(pwd) then awk 2>/dev/null then
+	-eu /usr/bin x=1 /usr/bin
+		echo "$@" grep sed then grep sed --verbose test local export 'quoted text'
+test x=1 /usr/bin 2>/dev/null then
+		| printf /usr/bin local
+	grep done export -eu "$@" ${HOME} readonly echo 'quoted text' export 'quoted text'
+	$(pwd) "$@" "$@" then echo grep readonly && x=1 export done --verbose
+		x=1 then sed ${HOME} test |
+cd -eu cd ${HOME} readonly $(pwd)
+		x=1 "$1" x=1 && sed x=1 $(pwd) 2>/dev/null --verbose -eu
+		test printf && test $(pwd) local test x=1 sed "$1" "$@" cd /usr/bin
+	cd echo x=1 x=1 x=1 sed $(pwd)
+	done 'quoted text' "$@" ${HOME} x=1 done grep 'quoted text' export echo
+	grep ${HOME} sed ${HOME} cd test
+	"$1" printf /usr/bin echo echo 2>/dev/null awk done | then 'quoted text'
+		--verbose 'quoted text' $(pwd) then /usr/bin "$@"
+	then /usr/bin "$1" echo "$@" /usr/bin
+	x=1 then printf echo readonly
+		export -eu | done | sed done
+	$(pwd) grep "$1" readonly 'quoted text' && printf 2>/dev/null
+	/usr/bin | done then | && test sed && then /usr/bin grep /usr/bin grep 2>/dev/null
+-eu x=1 /usr/bin export printf local grep
+	2>/dev/null then test 'quoted text' done ${HOME} && awk
+	| && 'quoted text' | done grep readonly
+		then cd sed printf printf export "$@"
+		printf local then grep $(pwd) cd test /usr/bin done x=1
+		test /usr/bin printf printf /usr/bin "$@" /usr/bin
+"$@" ${HOME} 2>/dev/null 2>/dev/null
+	echo export | "$1" /usr/bin sed done -eu then
+echo readonly awk grep awk "$@" sed
+readonly printf sed printf 'quoted text'
+		--verbose /usr/bin awk "$@" ${HOME} "$@" /usr/bin export done 2>/dev/null
+		'quoted text' sed export && && 2>/dev/null
+		2>/dev/null 'quoted text' grep 'quoted text'
+	printf /usr/bin export --verbose
+readonly ${HOME} -eu export | export
+	readonly awk printf grep 'quoted text' | && readonly -eu export $(pwd)
+		cd -eu test export readonly "$1" | awk readonly
+2>/dev/null echo done then x=1 export then $(pwd) ${HOME} -eu ${HOME} done x=1
+	-eu awk then export export && awk then 2>/dev/null
+	--verbose then grep echo echo "$@" local local --verbose
+		"$1" ${HOME} "$1" --verbose -eu -eu ${HOME}
+printf done echo "$1" export x=1 -eu
+		sed -eu sed export -eu then 'quoted text' test cd readonly awk 2>/dev/null
+	&& test local 'quoted text' "$@" "$1" ${HOME} /usr/bin then export
+	/usr/bin 2>/dev/null
+	echo printf cd done "$1" awk grep sed 2>/dev/null grep cd x=1 2>/dev/null
+	"$1" cd awk local awk 2>/dev/null export cd
+		sed -eu 2>/dev/null cd 'quoted text' local awk cd /usr/bin 2>/dev/null
+		"$1" export x=1 "$1" grep /usr/bin echo awk test then echo 2>/dev/null
+	readonly --verbose done readonly 'quoted text' echo
+then 'quoted text' done "$@" done
+	sed 2>/dev/null then x=1 $(pwd) /usr/bin sed export grep 2>/dev/null
+2>/dev/null 'quoted text' sed "$@" grep 2>/dev/null then --verbose printf |
+	"$@" printf grep && export printf done --verbose /usr/bin export
+grep then printf export grep
+${HOME} ${HOME} --verbose
+&& test -eu export "$@" local "$@" ${HOME} awk && then echo "$@"
+	| -eu done grep /usr/bin echo $(pwd) x=1
+2>/dev/null -eu 'quoted text'
+local /usr/bin --verbose 'quoted text'
+	test "$@" "$1" "$@" "$1"
+awk test $(pwd) local --verbose then "$1" && && sed 2>/dev/null sed local cd
+		/usr/bin printf echo local done 'quoted text' local printf sed printf sed cd x=1
+		| ${HOME} 2>/dev/null cd "$@" 'quoted text' 'quoted text' && --verbose
+		grep local then /usr/bin grep 'quoted text' test && cd 2>/dev/null
+done awk awk -eu grep then then
+		echo echo -eu | -eu readonly "$@"
+		$(pwd) printf && $(pwd) grep then | test x=1 | test |
+		sed cd 2>/dev/null "$1" 2>/dev/null awk && echo "$1" printf
+		local echo then "$@" 'quoted text' --verbose $(pwd) readonly local
+		&& $(pwd) && sed 2>/dev/null awk readonly echo ${HOME} awk
+then awk /usr/bin "$1" | | printf printf | | --verbose awk "$@" done | grep
+	test 'quoted text' 2>/dev/null "$@" "$@" then /usr/bin
+	export printf | export printf cd /usr/bin cd sed awk /usr/bin local 'quoted text'
+		grep done readonly echo ${HOME} printf local && --verbose && printf 'quoted text'
+	readonly awk done "$@"
+		test 2>/dev/null printf | echo "$@" awk -eu printf ${HOME} awk ${HOME} readonly
+sed sed readonly --verbose local awk awk printf
+&& && --verbose readonly
+&& echo "$@" --verbose test export echo cd readonly test
+	export && readonly ${HOME} ${HOME} cd local x=1
+sed x=1 export 'quoted text' export 'quoted text' $(pwd) $(pwd) export
+&& local done cd printf grep cd printf 'quoted text' test export printf
+sed readonly readonly $(pwd)
+		awk /usr/bin printf --verbose done done x=1 awk "$@" "$@" | sed awk awk -eu local
+"$1" done echo -eu echo --verbose "$1" 'quoted text' export
+&& $(pwd) ${HOME} 2>/dev/null
+echo then then local sed
+		test $(pwd) sed $(pwd) 2>/dev/null --verbose test -eu test x=1 "$@" local
+"$1" "$1" "$1" local $(pwd) cd 2>/dev/null ${HOME} printf
+		$(pwd) ${HOME} echo --verbose export readonly
+		-eu readonly $(pwd) local && printf readonly
+sed /usr/bin readonly /usr/bin 2>/dev/null export local -eu --verbose -eu
+	| cd done awk && echo local
+		2>/dev/null awk x=1 ${HOME} -eu test 'quoted text' x=1 x=1
+	"$@" ${HOME} export echo echo | "$1" cd sed "$1" ${HOME} awk echo export
+		then grep 'quoted text' done test -eu grep 'quoted text'
+		then readonly then then x=1 | then readonly sed then
+		test awk "$@" sed local local cd ${HOME} done grep && readonly &&
+	'quoted text' "$@" 'quoted text' -eu 'quoted text' x=1 x=1 cd echo 2>/dev/null
+	then then export "$1" echo export cd /usr/bin sed 'quoted text'
+		| ${HOME} done 2>/dev/null test
+printf sed --verbose
+-eu | grep cd then x=1 grep "$@" "$@" && test then
+		'quoted text' test cd cd /usr/bin
+	sed $(pwd) then cd | && 'quoted text' awk 2>/dev/null
+	cd echo awk $(pwd) test /usr/bin cd 2>/dev/null
+		$(pwd) && test echo /usr/bin awk 2>/dev/null test
+	awk test x=1 2>/dev/null 'quoted text' ${HOME} 'quoted text' 'quoted text'
+	-eu done x=1 grep local cd export sed export "$1" awk && sed grep readonly 2>/dev/null
+	"$1" echo 'quoted text' readonly
+	printf -eu test /usr/bin test echo | "$1" $(pwd) ${HOME} done "$@"
+		/usr/bin -eu test done cd awk 2>/dev/null 2>/dev/null
+	"$1" && $(pwd) 2>/dev/null awk && | 'quoted text' ${HOME} && sed
+	readonly && | grep cd readonly test grep "$1" test grep x=1 grep $(pwd) x=1 cd
+"$@" --verbose -eu $(pwd) cd /usr/bin sed /usr/bin
+	-eu && && echo awk grep /usr/bin grep 'quoted text' 2>/dev/null 2>/dev/null
+		export readonly awk /usr/bin /usr/bin "$1" cd 2>/dev/null /usr/bin
+		readonly 2>/dev/null done
+	| printf sed "$1" | 'quoted text'
+	cd grep "$1" x=1 then cd x=1 awk -eu test
+	x=1 done /usr/bin 'quoted text' --verbose
+		awk && then "$@" "$1" echo local 2>/dev/null export
+		awk ${HOME} awk test /usr/bin sed grep ${HOME} $(pwd) 'quoted text' --verbose
+done done printf 2>/dev/null sed cd ${HOME} local $(pwd) -eu export /usr/bin local
+	cd grep readonly local grep done sed test "$1" 2>/dev/null echo | local
+		readonly $(pwd) x=1 2>/dev/null ${HOME} ${HOME} $(pwd) | x=1 then local done export
+'quoted text' cd "$1" 2>/dev/null
+"$1" echo echo done -eu "$1" "$1" 'quoted text' "$@" grep $(pwd)
+	x=1 export then export ${HOME} ${HOME} export ${HOME} readonly
+	--verbose local echo 'quoted text' -eu && then
+		"$@" --verbose local done awk 2>/dev/null then && 2>/dev/null "$1" | awk --verbose
+	&& then printf | sed test "$@" x=1 | -eu sed readonly
+then sed echo then --verbose /usr/bin -eu local "$1" done
+		local $(pwd) sed -eu sed && sed echo local
+		printf printf && grep printf | export awk awk --verbose
+		-eu printf then | export ${HOME} "$1" echo readonly echo awk --verbose "$@"
+	/usr/bin | /usr/bin local test test test awk done | -eu grep done cd --verbose
+		"$1" x=1 x=1 "$1" /usr/bin && readonly
+	printf done "$@" --verbose "$1" 'quoted text' test
+		-eu x=1 readonly then 2>/dev/null
+then readonly | /usr/bin /usr/bin ${HOME} grep "$1" local 'quoted text'
+--verbose x=1 | test /usr/bin
+		local awk test echo local
+		&& $(pwd) -eu then sed printf local --verbose then readonly printf grep --verbose
+		test "$@" test awk --verbose
+done 2>/dev/null done cd | grep $(pwd) x=1 awk echo
+	sed 2>/dev/null cd --verbose /usr/bin 'quoted text' $(pwd) |
+		/usr/bin "$1" 2>/dev/null
+	printf echo readonly | /usr/bin $(pwd)
+	printf -eu then grep "$@" | readonly
+	'quoted text' then && 'quoted text'
+sed -eu "$1" 'quoted text' then test printf /usr/bin
+	$(pwd) local sed | ${HOME}
+	x=1 cd printf x=1 --verbose
+printf "$@" | echo local 2>/dev/null "$@" awk echo cd ${HOME} done local && /usr/bin
+awk -eu ${HOME} x=1 "$@" 2>/dev/null
+	grep | /usr/bin $(pwd) local local 'quoted text' ${HOME} grep local x=1 'quoted text'
+$(pwd) test | --verbose ${HOME} awk $(pwd) ${HOME}
+	-eu cd ${HOME} grep sed awk awk | export /usr/bin | 2>/dev/null
+	export "$1" echo export export local --verbose 2>/dev/null /usr/bin
+	/usr/bin ${HOME} | done echo /usr/bin | done export cd /usr/bin done
+| | "$@" grep -eu test && ${HOME} -eu done done done then
+	test && --verbose sed 'quoted text' "$@" printf
+&& export sed ${HOME} ${HOME} 2>/dev/null -eu
+		printf export x=1 then grep cd ${HOME}
+| ${HOME} --verbose awk 'quoted text' readonly
+| local "$1" -eu 'quoted text' sed
+	${HOME} local readonly /usr/bin | done cd
+		"$@" -eu grep 'quoted text' 'quoted text' --verbose export
+	x=1 $(pwd) $(pwd) echo "$1" local readonly x=1 $(pwd) 'quoted text' local export
+${HOME} x=1 $(pwd) &&
+	printf x=1 && --verbose $(pwd) cd && export "$1"
+	export done echo test export readonly printf sed $(pwd) readonly && "$1" local
+		"$1" then readonly ${HOME} sed done "$@"
+export done readonly local ${HOME} 'quoted text' "$1"
+	$(pwd) local grep awk && ${HOME} printf && cd x=1 awk printf 'quoted text' grep
+		2>/dev/null ${HOME} --verbose --verbose x=1 cd awk 2>/dev/null
+		then awk "$1" echo 'quoted text' echo echo 'quoted text'
+	${HOME} 2>/dev/null awk 'quoted text' done test test export echo ${HOME}
+cd | "$@" "$1" $(pwd) cd echo /usr/bin ${HOME} && readonly export
+	2>/dev/null x=1 printf 2>/dev/null /usr/bin "$1" | test readonly && && ${HOME}
+| local -eu -eu printf "$@" grep 2>/dev/null --verbose $(pwd) | "$1" export cd
+		grep grep x=1 --verbose $(pwd) awk grep echo "$@" 2>/dev/null -eu --verbose
+awk then awk $(pwd) test cd 2>/dev/null
+		x=1 && local | printf sed --verbose then
+local && readonly sed ${HOME} then echo done "$@" | -eu done awk | awk cd x=1 /usr/bin
+	local grep x=1 grep ${HOME}
+local printf cd done "$1"
+		export awk /usr/bin cd "$1" printf --verbose export echo local echo 'quoted text'
+printf then x=1 awk echo echo
+| printf "$1" "$@" then echo done x=1 |
+		awk export $(pwd) "$@" /usr/bin 2>/dev/null -eu then |
+		awk printf && 2>/dev/null test | echo x=1 /usr/bin
+	"$@" done grep | "$1" x=1 cd echo x=1 && grep awk local
+| 2>/dev/null export 2>/dev/null
+test printf then cd then 'quoted text'
+		-eu local $(pwd) "$1" sed /usr/bin readonly echo $(pwd) sed readonly then cd
+cd 2>/dev/null 'quoted text' && local ${HOME} -eu test && export
+awk sed && x=1 export readonly | done cd "$@" $(pwd)
+	cd x=1 --verbose echo awk "$@" sed grep then echo -eu readonly done x=1 'quoted text'
+	awk sed --verbose x=1 --verbose local local grep ${HOME} | local -eu 2>/dev/null
+	-eu && readonly done -eu done sed ${HOME} && local | "$1" then readonly test --verbose
+		done "$1" grep then local then
+		then awk --verbose readonly echo 2>/dev/null test "$1" cd x=1 test cd export
+		x=1 | cd -eu printf test cd | printf sed readonly 2>/dev/null "$@" ${HOME} 2>/dev/null
+		awk /usr/bin printf printf --verbose export x=1 readonly printf export export
+		&& $(pwd) done ${HOME} readonly && local
+&& cd | "$1" x=1 -eu done local grep awk cd awk awk awk /usr/bin awk echo /usr/bin
+	grep $(pwd) "$1" grep local && cd done
+		"$1" x=1 2>/dev/null 2>/dev/null done sed &&
+done /usr/bin x=1 2>/dev/null done $(pwd) && /usr/bin
+"$@" readonly done echo
+	"$1" awk sed local readonly $(pwd) /usr/bin
+	awk readonly test readonly grep local ${HOME} /usr/bin grep cd grep $(pwd)
+	grep && --verbose readonly grep && awk readonly readonly
+printf done test sed then grep ${HOME} --verbose --verbose done local
+| echo $(pwd) && ${HOME} --verbose local awk cd test
+		echo -eu $(pwd) printf awk x=1 export cd cd ${HOME}
+export local awk $(pwd) test awk cd printf
+awk echo x=1 cd -eu --verbose "$@"
+	cd /usr/bin export $(pwd) cd awk grep 2>/dev/null 'quoted text'
+	--verbose readonly x=1 echo cd
+		${HOME} "$@" grep x=1
+	2>/dev/null | awk 'quoted text' 'quoted text' then /usr/bin "$@" "$@" grep echo
+test /usr/bin test /usr/bin
+	'quoted text' grep x=1 | x=1 export export awk readonly local
+		awk 2>/dev/null "$1" cd sed echo local && 'quoted text' && echo then sed export
+"$@" 2>/dev/null then --verbose
+	-eu test /usr/bin ${HOME}
+export readonly 2>/dev/null
+		local 2>/dev/null echo then | test done done x=1 printf test test
+		sed ${HOME} readonly done echo sed 'quoted text' awk export local sed | $(pwd)
+	$(pwd) readonly awk -eu 2>/dev/null local $(pwd) 'quoted text'
+x=1 && | echo echo x=1 --verbose sed sed x=1 echo && /usr/bin test
+		&& x=1 2>/dev/null test awk | echo 'quoted text' readonly --verbose
+"$@" echo $(pwd) export local printf && test "$@" "$1" local
+	readonly | "$1" done echo /usr/bin cd
+		cd readonly then readonly done ${HOME} then /usr/bin
+		cd && test "$1" /usr/bin export export $(pwd)
+readonly "$@" x=1 printf -eu x=1 /usr/bin ${HOME} "$1"
+	done 'quoted text' --verbose $(pwd) /usr/bin printf done x=1 2>/dev/null
+--verbose then printf export cd x=1 sed grep 2>/dev/null
+	2>/dev/null -eu echo local /usr/bin
+		--verbose then --verbose echo cd "$1" cd
+		&& ${HOME} sed readonly grep -eu then awk $(pwd) test awk
+	cd | export "$@" 'quoted text' x=1 printf cd 'quoted text' x=1
+	&& printf ${HOME} ${HOME} cd 2>/dev/null "$1" 'quoted text'
+	grep -eu export sed echo --verbose then
+${HOME} && sed ${HOME} && | -eu "$@" then |
+${HOME} done then then test | 'quoted text' done "$@" readonly
+	$(pwd) ${HOME} test $(pwd) | -eu printf 'quoted text' echo readonly cd
+		"$1" cd echo 'quoted text' done printf then
+		sed echo $(pwd) "$1" grep sed 2>/dev/null echo /usr/bin
+		echo --verbose cd --verbose
+2>/dev/null local done awk printf local
+test printf 2>/dev/null $(pwd) --verbose | local "$1" echo grep --verbose ${HOME}
+echo test export readonly "$1" ${HOME} then
+		echo echo cd | --verbose ${HOME}
+	/usr/bin printf grep | cd local && printf export
+	2>/dev/null && 'quoted text'
+'quoted text' local grep echo x=1 $(pwd) /usr/bin "$1" local echo /usr/bin
+		printf export 'quoted text' -eu $(pwd) /usr/bin local -eu
+	cd sed "$1" printf then awk /usr/bin 'quoted text'
+	printf "$@" then | -eu | then
+	${HOME} printf printf readonly x=1 --verbose 2>/dev/null --verbose
+cd ${HOME} grep 2>/dev/null --verbose /usr/bin -eu
+		cd readonly grep -eu printf awk test $(pwd)
+printf echo && ${HOME} awk && echo ${HOME}
+		-eu readonly "$@" awk | local $(pwd) "$1" readonly && "$1" done export
+printf | awk grep echo then --verbose sed
+		${HOME} then export /usr/bin then -eu grep export
+		| grep export cd -eu "$1" readonly
+		${HOME} then done x=1 'quoted text' ${HOME}
+-eu done "$1" printf $(pwd) readonly x=1 --verbose test "$@" export
+| -eu x=1 ${HOME} cd | awk sed awk $(pwd) 'quoted text' ${HOME} cd cd echo export
+		/usr/bin 'quoted text' | local sed export grep sed cd && && printf
+/usr/bin then cd && /usr/bin
+		-eu sed "$@" grep "$@" 2>/dev/null
+	local echo "$1" $(pwd) 'quoted text'
+		cd local "$@" grep export "$@"
+		x=1 ${HOME} ${HOME} export test
+		readonly ${HOME} --verbose --verbose readonly
+		2>/dev/null -eu 'quoted text' grep && readonly cd
+| | cd cd /usr/bin --verbose cd sed sed grep /usr/bin | --verbose
+done test grep awk $(pwd) -eu local "$@" echo x=1 test $(pwd) "$@" x=1 -eu export
+		2>/dev/null 'quoted text'
+${HOME} && 'quoted text' export test
+		test grep -eu printf cd local grep then cd printf local 2>/dev/null
+	${HOME} /usr/bin --verbose
+	2>/dev/null readonly then $(pwd) && local then ${HOME} $(pwd)
+readonly then /usr/bin
+	awk export | --verbose 2>/dev/null
+"$@" test export -eu then 'quoted text' test done x=1 -eu printf
+	sed grep grep ${HOME} printf
+	| test 'quoted text' /usr/bin --verbose grep "$1" "$1" echo printf
+		local "$1" -eu echo export "$1" "$@" then && $(pwd) sed export
+	export && 2>/dev/null local
+	$(pwd) cd $(pwd) 'quoted text' echo 2>/dev/null export then
+	awk ${HOME} awk /usr/bin $(pwd) && --verbose cd printf
+printf $(pwd) x=1 | 'quoted text' echo
+$(pwd) printf | sed grep ${HOME} x=1 "$@" ${HOME} grep x=1 && grep "$1" printf "$@"
+	--verbose local | done && printf done "$@" done "$@" test && sed
+		sed then grep then 2>/dev/null ${HOME} sed "$1" printf
+	printf "$@" sed $(pwd) test sed grep 'quoted text' awk 'quoted text'
+		/usr/bin ${HOME} sed readonly printf done 'quoted text' printf "$1"
+--verbose echo export done 'quoted text'
+	awk && echo awk grep awk -eu local "$@" cd /usr/bin grep -eu
+		"$1" printf sed --verbose done local 'quoted text' && awk --verbose
+readonly local /usr/bin
+awk 2>/dev/null 2>/dev/null export 2>/dev/null echo
+	sed then test echo grep local echo then echo local test echo 'quoted text'
+		&& sed -eu sed test export $(pwd) export
+then export cd printf done cd grep cd | sed sed done then 2>/dev/null
+&& ${HOME} | grep sed done "$1" awk then x=1 ${HOME} local readonly
+		printf cd export echo grep
+	sed printf "$1" x=1 sed test test printf ${HOME} "$@" x=1 then
+		x=1 cd echo | /usr/bin test 'quoted text'
+	x=1 done printf --verbose 'quoted text'
+then done | then awk test | "$1" readonly
+		/usr/bin then -eu awk "$1" "$1"
+	"$@" /usr/bin $(pwd) "$1" x=1 "$1" | "$@" cd $(pwd) "$@" awk /usr/bin export
+cd cd then awk printf then test echo printf --verbose echo ${HOME}
+	'quoted text' "$@" printf "$1" sed "$1" 2>/dev/null
+grep readonly readonly done
+then "$1" cd --verbose cd sed local printf local 'quoted text'
+awk sed local && cd done | grep $(pwd) x=1 x=1 | 2>/dev/null
+		"$@" "$1" test x=1 done cd then local x=1
+	export echo then | 2>/dev/null
+		local "$1" x=1 | sed x=1 && $(pwd) | x=1 "$1" awk echo awk -eu ${HOME}
+		local "$1" /usr/bin --verbose ${HOME} sed cd
+		'quoted text' "$@" --verbose x=1 'quoted text' "$1" | -eu && grep
+awk 'quoted text' readonly grep /usr/bin cd -eu awk printf export
+		'quoted text' test awk echo sed test local echo readonly
+	echo -eu awk && readonly export | awk echo 'quoted text'
+	&& export grep done "$1" -eu --verbose $(pwd) grep grep ${HOME} test
+		test && cd cd awk echo export -eu done awk
+	x=1 /usr/bin "$1" test 'quoted text' x=1 echo
+x=1 done "$1" export --verbose
+	| -eu printf then 'quoted text' then printf awk 'quoted text'
+done x=1 "$1" grep grep | | readonly echo "$@" readonly 2>/dev/null
+	&& awk done local -eu 'quoted text' ${HOME} 2>/dev/null printf | ${HOME}
+	grep 2>/dev/null /usr/bin readonly ${HOME} grep sed export done --verbose
+cd export test -eu | | "$@" $(pwd) /usr/bin cd "$@" $(pwd) then --verbose
+export | 'quoted text' --verbose --verbose
+$(pwd) "$1" cd /usr/bin $(pwd)
+-eu --verbose --verbose ${HOME} -eu /usr/bin /usr/bin x=1 2>/dev/null
+	$(pwd) 2>/dev/null --verbose 2>/dev/null then test --verbose sed $(pwd)
+	sed ${HOME} cd readonly 'quoted text' cd $(pwd) printf sed ${HOME} $(pwd)
+cd ${HOME} && done export
+		export | grep "$@" --verbose "$1" export /usr/bin
+		printf && 2>/dev/null "$@" then 2>/dev/null cd printf readonly -eu export
+		done done -eu local grep local "$@" awk &&
+	awk echo done /usr/bin | awk test -eu
+		export x=1 grep test export 2>/dev/null 2>/dev/null
+export readonly export 'quoted text' $(pwd) -eu /usr/bin local cd
+cd 'quoted text' ${HOME} grep | -eu grep /usr/bin printf ${HOME}
+	done done grep grep readonly && grep -eu printf sed echo ${HOME} && sed printf
+awk cd && "$@" 2>/dev/null && printf && | | -eu "$@" ${HOME} printf
+		2>/dev/null readonly x=1 local printf printf test "$1"
+'quoted text' /usr/bin grep export
+echo ${HOME} cd --verbose /usr/bin
+		"$1" then sed cd x=1 printf
+	/usr/bin --verbose sed "$1" sed x=1 --verbose --verbose | "$@" 2>/dev/null
+		test x=1 cd $(pwd) x=1 ${HOME} test printf | ${HOME} echo
+cd --verbose test 2>/dev/null
+$(pwd) local local grep printf x=1 test
+		grep $(pwd) export -eu export local grep then test 'quoted text'
+	awk readonly cd export --verbose cd then
+--verbose grep echo -eu $(pwd) export cd grep 'quoted text' printf
+export "$@" 2>/dev/null
+-eu test sed done 2>/dev/null /usr/bin
+		done 'quoted text' export cd readonly local $(pwd) --verbose "$1"
+		"$@" /usr/bin done /usr/bin export --verbose cd sed $(pwd) grep then local
+	x=1 'quoted text' "$1"
+		"$1" export | then done && "$1" "$1" printf 'quoted text'
+		--verbose awk --verbose sed awk /usr/bin -eu cd printf $(pwd)
+		2>/dev/null | printf 'quoted text' x=1 local
+done $(pwd) "$@" 'quoted text' && $(pwd) cd sed "$@" sed test $(pwd)
+local then | awk $(pwd) "$@" -eu 2>/dev/null | --verbose
+		"$1" echo readonly done "$1" x=1 done cd --verbose
+	&& printf test printf done -eu then && sed printf
+		then grep cd readonly && cd -eu sed done cd /usr/bin /usr/bin
+		"$@" done then export awk done && "$1" echo /usr/bin cd "$@" printf done
+		-eu awk ${HOME} x=1 sed | x=1 awk readonly local
+--verbose sed test grep
+printf test readonly cd echo local $(pwd)
+$(pwd) $(pwd) $(pwd) "$@" x=1 cd --verbose
+	done awk test local cd cd echo $(pwd) local /usr/bin 2>/dev/null x=1 done
+"$1" then local printf
+printf awk readonly /usr/bin -eu | readonly
+		"$1" $(pwd) printf "$@" local $(pwd) | |
+2>/dev/null -eu | 'quoted text' && readonly printf "$@" cd grep "$1"
+	awk | awk --verbose "$1" local x=1 $(pwd) && grep ${HOME}
+$(pwd) test cd test "$1" $(pwd) | x=1 $(pwd)
+${HOME} local echo "$1" x=1 readonly done 2>/dev/null
+		2>/dev/null /usr/bin test --verbose printf x=1 sed && $(pwd)
+test && cd printf ${HOME} done export then test "$1" -eu
+	cd then echo export test | 2>/dev/null --verbose echo then ${HOME}
+		/usr/bin cd printf printf 2>/dev/null ${HOME}
+-eu awk && done ${HOME}
+	${HOME} export done && --verbose then 2>/dev/null && printf
+	--verbose -eu echo "$1" $(pwd) cd ${HOME} cd -eu "$1" 2>/dev/null
+cd test --verbose readonly export "$1"
+	--verbose -eu 'quoted text' printf
+		x=1 --verbose /usr/bin then
+		$(pwd) test x=1 printf done "$1" test readonly
+		-eu --verbose && 'quoted text' && $(pwd) --verbose
+export awk cd echo local
+		--verbose && | /usr/bin --verbose test $(pwd) echo | grep test
+&& then printf x=1 ${HOME} export done
+-eu ${HOME} --verbose $(pwd) ${HOME} 'quoted text'
+${HOME} readonly && && echo readonly printf then sed "$1" -eu sed x=1 done
+	awk export 'quoted text' $(pwd) export
+		grep sed export readonly sed test done "$@"
+	$(pwd) sed && 'quoted text' then sed done local --verbose test then awk
+	--verbose /usr/bin readonly -eu then sed 'quoted text' grep 'quoted text'
+	x=1 awk $(pwd) | done awk x=1 2>/dev/null grep
+sed echo --verbose export "$@" local printf
+	awk $(pwd) echo "$@" 2>/dev/null -eu awk x=1 readonly then local
+	readonly cd export /usr/bin test echo $(pwd) cd --verbose && 'quoted text'
+		-eu ${HOME} local test grep printf
+	-eu "$1" /usr/bin x=1 "$@" local
+"$@" 2>/dev/null done readonly local $(pwd) sed
+sed x=1 sed echo x=1 x=1 echo done 'quoted text' grep 'quoted text'
+		&& --verbose then 'quoted text' export echo $(pwd) && done 'quoted text' echo /usr/bin
+	/usr/bin 'quoted text' printf
+	/usr/bin echo -eu ${HOME} "$1" export ${HOME}
+	"$@" x=1 readonly "$@" "$1" "$1" grep 'quoted text' sed | echo
+		done test --verbose $(pwd) grep && 2>/dev/null && --verbose
+	-eu x=1 echo 'quoted text' x=1
+	${HOME} local | done awk /usr/bin
+		x=1 done "$1" test "$1" "$1"
+	x=1 --verbose 'quoted text'
+	printf export 2>/dev/null --verbose then x=1 done grep done $(pwd) cd
+$(pwd) "$@" echo export local export 'quoted text' awk awk /usr/bin grep 2>/dev/null
+"$1" x=1 "$@" 2>/dev/null
+"$1" then /usr/bin test echo cd && grep awk | printf "$1" /usr/bin
+sed local "$1" 2>/dev/null x=1 grep 2>/dev/null "$1" "$1" --verbose | |
+	"$@" $(pwd) "$@" awk then then test echo | echo ${HOME} 2>/dev/null
+		then test ${HOME} then x=1
+		2>/dev/null "$1" x=1 && sed 2>/dev/null -eu $(pwd) -eu then awk x=1
+		done local echo ${HOME} echo readonly /usr/bin -eu | awk "$@" done /usr/bin grep
+echo --verbose test local 'quoted text'
+		--verbose 'quoted text' grep | $(pwd) readonly then done "$@" x=1 sed
+&& sed test && "$1" sed grep | readonly echo "$@" echo "$@" cd printf
+		sed awk 2>/dev/null -eu |
+awk --verbose sed local export | -eu done
+done grep 2>/dev/null --verbose ${HOME} "$1" 2>/dev/null
+		/usr/bin export export "$1" 2>/dev/null
+		sed awk 'quoted text' && test then "$@" | grep export grep echo
+		&& awk then sed && x=1 test sed export
+	echo export 'quoted text' cd test printf test x=1 ${HOME}
+		grep && -eu "$1" done && test && -eu awk sed
+sed "$1" local grep done && x=1 'quoted text' readonly 'quoted text'
+	2>/dev/null "$@" local export
+echo -eu export done then local 'quoted text' cd $(pwd) export ${HOME}
+cd ${HOME} ${HOME} awk done local cd x=1 /usr/bin | cd ${HOME} "$@" grep
+"$@" readonly 'quoted text' x=1 awk "$1" awk done -eu done "$1" echo sed
+	local | -eu && -eu echo --verbose -eu readonly x=1 echo echo
+		/usr/bin "$@" "$@" --verbose export
+		${HOME} grep $(pwd) -eu export cd x=1 'quoted text' --verbose awk
+		2>/dev/null $(pwd) | test --verbose test
+	then --verbose grep "$1" awk echo cd sed && x=1 ${HOME}
+		grep done "$1" $(pwd) readonly
+	"$1" awk grep && export 2>/dev/null "$@" && /usr/bin "$1"
+	local local "$@" echo done
+"$@" "$1" done ${HOME}
+then printf test awk 2>/dev/null -eu printf x=1
+	then x=1 /usr/bin local test
+awk x=1 readonly export --verbose -eu 'quoted text' 'quoted text'
+		2>/dev/null ${HOME} grep
+	x=1 $(pwd) then grep printf /usr/bin -eu "$@" export "$@" local printf printf
+grep 'quoted text' echo readonly
+	echo then echo $(pwd) printf "$@" $(pwd)
+	&& echo 'quoted text' grep awk ${HOME} | then "$1" "$1" echo cd ${HOME}
+cd /usr/bin "$@" && --verbose readonly then
+"$@" then "$@" local | grep --verbose "$1" 2>/dev/null
+		export "$1" then awk /usr/bin export test
+awk echo $(pwd) local 'quoted text' done 2>/dev/null
+		x=1 readonly /usr/bin test echo ${HOME} ${HOME} local --verbose -eu ${HOME} test
+2>/dev/null --verbose /usr/bin printf printf -eu 2>/dev/null ${HOME} x=1
+		then then grep /usr/bin | "$@" export -eu /usr/bin echo awk
+	local && $(pwd) test readonly && export export export awk
+		--verbose && ${HOME} | --verbose printf 2>/dev/null |
+--verbose done printf && 'quoted text' 'quoted text'
+	readonly readonly done -eu done /usr/bin | "$1" cd ${HOME} -eu 'quoted text' test
+	grep | grep readonly && x=1 $(pwd) done /usr/bin printf
+/usr/bin 'quoted text' ${HOME} | done done done | awk /usr/bin then ${HOME} ${HOME}
+sed "$1" --verbose cd printf "$1" export cd sed echo ${HOME} | local
+	2>/dev/null then done printf echo && | echo
+		awk done && $(pwd) export && 2>/dev/null
+local ${HOME} sed x=1 "$@" then && 2>/dev/null 'quoted text'
+	${HOME} ${HOME} && "$@" readonly $(pwd) && -eu export x=1
+		cd | "$1" | -eu "$1" printf awk
+		readonly -eu -eu sed $(pwd) printf /usr/bin x=1 grep done
+		&& "$1" ${HOME} $(pwd) -eu && -eu local awk done
+	'quoted text' /usr/bin readonly test ${HOME} echo
+		&& cd awk then | ${HOME} local 2>/dev/null grep
+	cd $(pwd) grep x=1 "$@" $(pwd) done grep sed printf awk 2>/dev/null
+"$@" 2>/dev/null test
+"$1" then done "$1" /usr/bin grep | grep echo echo printf test -eu
+printf test sed && readonly
+awk local 2>/dev/null grep 'quoted text' /usr/bin cd cd
+	local done sed then && export ${HOME} done export x=1 readonly readonly
+then /usr/bin "$@" cd grep printf echo ${HOME} &&
+awk "$1" echo | echo 'quoted text'
+	${HOME} test "$1" -eu x=1 "$1" test export test x=1 "$@" grep grep 'quoted text'
+/usr/bin printf 2>/dev/null /usr/bin $(pwd) test 'quoted text' --verbose export
+	printf test $(pwd) readonly "$1" -eu x=1 && printf --verbose local | --verbose
+"$1" /usr/bin awk && grep --verbose export test test 'quoted text'
+	echo 2>/dev/null ${HOME} -eu export
+	${HOME} /usr/bin x=1 done && -eu printf x=1 test export then
+echo export done /usr/bin local local sed -eu then "$@"
+	| "$1" 'quoted text' export -eu printf
+		printf awk echo test x=1 test export test /usr/bin | -eu done 'quoted text'
+grep $(pwd) -eu --verbose x=1 2>/dev/null /usr/bin readonly then -eu echo
+		grep export --verbose awk echo "$@"
+	&& "$@" "$@" -eu -eu grep x=1 $(pwd)
+done "$@" sed | awk --verbose done --verbose export "$1" 2>/dev/null
+		/usr/bin export | grep "$@" echo x=1
+		2>/dev/null /usr/bin cd printf /usr/bin 'quoted text'
+sed | export echo readonly "$@" "$@" -eu export test then 2>/dev/null readonly
+&& then ${HOME} && done grep | readonly readonly
+		x=1 test "$1" echo --verbose $(pwd) -eu export "$1" "$1" grep test -eu grep
+		/usr/bin awk && sed | then then 2>/dev/null && grep --verbose --verbose
+	sed x=1 test awk -eu test --verbose
+echo "$1" readonly ${HOME} test readonly
+	--verbose grep | --verbose sed /usr/bin "$@" 2>/dev/null
+$(pwd) cd "$1" readonly "$@" sed $(pwd) local cd "$@" /usr/bin export local
+		| sed cd -eu local "$@" 'quoted text'
+	'quoted text' /usr/bin awk x=1 |
+| x=1 local cd 'quoted text' --verbose 2>/dev/null export $(pwd)
+	$(pwd) sed -eu /usr/bin
+	$(pwd) $(pwd) export export test ${HOME} $(pwd) "$1" sed $(pwd) readonly
+		"$1" printf 'quoted text' "$@" local done readonly /usr/bin $(pwd)
+&& cd ${HOME} 2>/dev/null local grep --verbose /usr/bin grep /usr/bin
+		test /usr/bin $(pwd) then x=1 cd | x=1 readonly echo 'quoted text'
+		done "$@" "$1" | printf readonly export 2>/dev/null echo
+		echo && cd local printf 'quoted text' then export "$@" "$@" "$@" readonly 'quoted text'
+		done x=1 test export cd "$@" "$1" done local
+	then $(pwd) 2>/dev/null "$1" | 'quoted text'
+	"$@" awk | x=1 "$@" echo local $(pwd) sed done grep x=1 2>/dev/null
+/usr/bin grep -eu cd sed echo $(pwd) done "$1"
+	--verbose | "$@" "$1" cd done
+cd --verbose && | printf -eu && | printf awk then echo --verbose 'quoted text'
+		readonly $(pwd) $(pwd) 2>/dev/null done | --verbose
+		| awk grep | /usr/bin 2>/dev/null /usr/bin local then echo 2>/dev/null |
+		x=1 ${HOME} then --verbose x=1 && && local -eu 2>/dev/null
+then echo "$1" | local "$@" "$1" 'quoted text' cd readonly cd
+	grep -eu $(pwd) $(pwd) done awk printf $(pwd)
+--verbose done grep -eu 2>/dev/null --verbose echo 2>/dev/null grep $(pwd) local
+echo then --verbose "$@" | grep "$@" 2>/dev/null echo $(pwd)
+-eu then done sed -eu x=1 --verbose -eu cd --verbose cd cd
+	2>/dev/null sed /usr/bin "$1" grep 'quoted text' --verbose 'quoted text' then local
+	'quoted text' test sed local done "$1"
+		"$@" $(pwd) ${HOME} done cd x=1 x=1 ${HOME} "$1"
+		printf | -eu sed printf --verbose /usr/bin local /usr/bin cd --verbose
+&& test sed /usr/bin sed "$@" x=1 then awk printf readonly x=1
+export local 2>/dev/null
+done awk cd local then && printf && readonly 2>/dev/null x=1 | --verbose
+	2>/dev/null grep readonly sed readonly cd cd printf ${HOME} "$1" cd test test
+		--verbose "$@" grep -eu export x=1 test awk test 'quoted text' 2>/dev/null
+		cd ${HOME} $(pwd) readonly "$@"
+/usr/bin sed -eu /usr/bin
+		&& ${HOME} then | grep test done printf $(pwd) -eu 2>/dev/null grep grep
+$(pwd) --verbose then "$@" ${HOME} sed | cd echo export | sed sed
+	${HOME} then "$@" -eu done cd printf
+grep /usr/bin 2>/dev/null 2>/dev/null done test awk test $(pwd) x=1 grep x=1 done
+		/usr/bin "$1" "$1" --verbose done --verbose x=1 printf
+	-eu then echo then x=1 ${HOME} 'quoted text' printf 2>/dev/null export
+test 'quoted text' readonly
+| && echo cd x=1 local awk readonly
+	"$1" $(pwd) "$1" grep $(pwd) readonly $(pwd) readonly
+		sed "$1" sed sed sed then 2>/dev/null
+	export && cd ${HOME} ${HOME} x=1 then
+${HOME} awk export printf 2>/dev/null
+	awk 'quoted text' ${HOME} done sed
+		${HOME} local "$1" grep -eu $(pwd) echo && ${HOME}
+/usr/bin readonly 'quoted text' 2>/dev/null
+	printf x=1 && done echo grep grep export 2>/dev/null ${HOME} then
+		${HOME} x=1 grep -eu "$@" sed "$1"
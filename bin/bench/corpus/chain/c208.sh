@@ -0,0 +1,2001 @@
+		'quoted text' "$1" test
+	x=1 -eu grep awk -eu 'quoted text' 'quoted text'
+	done "$@" x=1 test export export readonly then grep echo awk cd awk echo $(pwd)
+	x=1 x=1 cd -eu echo ${HOME} cd readonly --verbose /usr/bin cd | &&
+&& local echo "$@" x=1 | "$@" && | cd grep export x=1 ${HOME}
+	cd then ${HOME} then cd test then
+		x=1 awk printf "$1" --verbose done grep
+	"$1" grep -eu x=1 sed 2>/dev/null "$1" | 'quoted text'
+	printf echo awk | sed ${HOME}
+	x=1 local done awk local sed cd cd test ${HOME} 'quoted text'
+		-eu 'quoted text' readonly grep sed awk /usr/bin
+echo $(pwd) cd sed grep sed export
+local "$1" ${HOME} 'quoted text' done then 'quoted text' grep
+	then 'quoted text' ${HOME} -eu echo cd grep
+'quoted text' readonly done done grep
+	&& $(pwd) echo sed $(pwd) ${HOME} cd local --verbose echo
+${HOME} $(pwd) sed echo then 'quoted text' printf | local "$1" sed ${HOME} x=1
+	test "$1" 'quoted text' $(pwd)
+2>/dev/null --verbose local -eu $(pwd) /usr/bin done printf 2>/dev/null
+x=1 local x=1 "$@" grep --verbose ${HOME} 2>/dev/null cd
+	&& && --verbose "$@" -eu
+		2>/dev/null x=1 then | | then done x=1
+	echo --verbose cd cd "$1" /usr/bin 'quoted text' /usr/bin
+		cd --verbose grep "$@" test printf printf local ${HOME}
+	'quoted text' sed export
+$(pwd) x=1 "$@" done local echo 'quoted text' ${HOME} then export
+	${HOME} printf --verbose printf done --verbose local echo --verbose
+done /usr/bin echo | --verbose cd
+	done export /usr/bin x=1 ${HOME} 2>/dev/null done "$@" $(pwd)
+	awk then echo local $(pwd) printf $(pwd) echo | echo sed echo
+	2>/dev/null ${HOME} export ${HOME} printf 'quoted text'
+&& test "$1" ${HOME} 'quoted text' local 2>/dev/null then cd sed /usr/bin test
+	grep $(pwd) && | local --verbose done ${HOME} awk
+		"$@" && done 2>/dev/null --verbose && cd done --verbose printf then
+	export test done then grep local && ${HOME} sed printf && -eu "$1"
+	$(pwd) /usr/bin awk local
+'quoted text' export cd awk && test
+sed $(pwd) echo "$1" && readonly "$@" local
+		test 'quoted text' awk export cd printf printf test then readonly x=1
+		${HOME} echo grep sed && readonly | readonly --verbose "$1"
+		-eu x=1 'quoted text' x=1 sed | grep
+-eu "$1" && grep 2>/dev/null echo export /usr/bin
+"$1" then readonly awk ${HOME} 'quoted text' export
+		--verbose 'quoted text' echo readonly /usr/bin cd
+"$1" 'quoted text' -eu readonly grep readonly
+	--verbose sed /usr/bin sed --verbose cd
+printf | 'quoted text' $(pwd) then /usr/bin |
+		${HOME} ${HOME} sed then readonly -eu echo -eu "$@" 2>/dev/null "$@" /usr/bin
+&& sed 2>/dev/null -eu | --verbose 'quoted text' sed 2>/dev/null awk export | then
+		done | echo 'quoted text' readonly awk readonly
+		then "$@" | && "$@" sed --verbose x=1 export done | local -eu x=1
+| cd "$1" echo cd "$@" awk printf done sed local 2>/dev/null
+	${HOME} 'quoted text' done grep echo | /usr/bin export cd $(pwd) "$@"
+test awk readonly local /usr/bin
+grep readonly grep "$@" 2>/dev/null grep test
+		"$1" /usr/bin awk -eu ${HOME} awk test && cd sed && ${HOME} /usr/bin test
+	/usr/bin $(pwd) grep -eu local sed "$1" "$@" test x=1 && cd && then
+	local done /usr/bin export echo "$1" --verbose grep export "$@"
+test 2>/dev/null test test "$1"
+/usr/bin /usr/bin $(pwd) /usr/bin export ${HOME} cd awk --verbose
+		sed sed --verbose | local readonly awk sed test local grep
+		/usr/bin done "$@" local test awk printf && /usr/bin printf "$@" $(pwd) readonly
+	x=1 printf local test | printf /usr/bin "$1" ${HOME}
+	--verbose awk $(pwd) sed test "$@" | | then
+		--verbose && "$1" 'quoted text' x=1
+	"$@" 2>/dev/null echo && --verbose echo readonly sed 'quoted text'
+export sed 'quoted text' done printf awk
+		sed x=1 $(pwd) readonly $(pwd) -eu x=1 printf
+		printf awk | && grep --verbose
+cd x=1 grep && ${HOME} export && export "$1" done ${HOME} --verbose test
+		"$1" /usr/bin sed echo test awk && export awk echo grep x=1 printf done
+	printf sed printf x=1 done | 2>/dev/null grep 'quoted text'
+		x=1 sed 'quoted text' awk then readonly grep sed "$@" then
+		awk test grep grep && x=1 -eu cd
+		$(pwd) printf "$1" cd $(pwd) done grep sed grep grep -eu
+	then | "$1" --verbose ${HOME} awk awk $(pwd) "$1" 'quoted text' "$@" then then
+		'quoted text' | done echo -eu then echo test $(pwd)
+		sed $(pwd) --verbose echo "$1" "$@"
+		readonly test ${HOME} /usr/bin export x=1 x=1 2>/dev/null
+		echo cd --verbose x=1 done --verbose sed done grep ${HOME}
+/usr/bin x=1 cd grep 2>/dev/null x=1 x=1 grep x=1 |
+		awk grep readonly $(pwd) local $(pwd) x=1 /usr/bin test
+	--verbose x=1 readonly then 2>/dev/null
+		/usr/bin x=1 sed local then x=1 | && $(pwd) ${HOME} && sed done 'quoted text'
+		/usr/bin echo sed 2>/dev/null
+		/usr/bin "$1" 2>/dev/null cd test --verbose printf done
+	/usr/bin local | | local grep readonly && 2>/dev/null sed awk cd
+	readonly local printf echo "$1" $(pwd) local --verbose --verbose done x=1 test local
+		--verbose "$@" x=1 "$1" -eu local grep export
+"$@" | -eu --verbose $(pwd)
+		echo test -eu --verbose && export "$@" x=1 && awk sed $(pwd) x=1 readonly 'quoted text'
+done ${HOME} "$@" --verbose cd
+		&& then -eu cd local done && readonly awk test -eu && awk 2>/dev/null x=1 x=1 /usr/bin
+| done grep export $(pwd) "$@" --verbose export -eu
+		readonly ${HOME} sed cd 2>/dev/null
+awk x=1 /usr/bin test printf 2>/dev/null printf
+		| --verbose export /usr/bin test printf x=1
+		2>/dev/null sed export ${HOME} cd --verbose
+	printf 2>/dev/null "$1" then
+'quoted text' then echo echo /usr/bin /usr/bin cd done done
+${HOME} awk done sed ${HOME} "$@" && 'quoted text'
+then grep | printf export grep "$1" 2>/dev/null test printf 'quoted text'
+	echo "$1" /usr/bin 'quoted text' printf test /usr/bin done 2>/dev/null 'quoted text'
+		test 2>/dev/null awk | grep export ${HOME} -eu echo ${HOME} echo $(pwd)
+	local | --verbose export export && "$@"
+		printf 2>/dev/null awk --verbose
+		awk local test "$@" printf ${HOME} awk ${HOME} $(pwd) awk local test awk
+$(pwd) $(pwd) export sed grep x=1 awk awk local x=1 export local
+	test done x=1 export "$1" -eu test test grep local 'quoted text'
+	echo printf "$@" export
+		export then printf "$1" x=1 readonly 2>/dev/null x=1 echo echo $(pwd)
+		$(pwd) --verbose | awk sed $(pwd) then test grep echo
+	&& $(pwd) sed 2>/dev/null ${HOME}
+--verbose ${HOME} | then 2>/dev/null | --verbose
+x=1 | echo "$@" 'quoted text' ${HOME} /usr/bin 2>/dev/null | readonly x=1 2>/dev/null
+	--verbose local | cd "$1" 'quoted text' printf grep grep --verbose ${HOME}
+		grep export x=1 "$1"
+"$1" then printf export "$@" /usr/bin 'quoted text'
+		${HOME} awk x=1 x=1 --verbose | | then "$@" done --verbose test awk "$1"
+	done 2>/dev/null -eu "$1" readonly "$@" cd ${HOME}
+		local local awk echo 'quoted text'
+x=1 $(pwd) cd ${HOME} export done sed sed x=1 readonly 2>/dev/null echo "$@"
+	test | --verbose cd local $(pwd)
+sed 2>/dev/null | printf 'quoted text' && -eu cd
+"$1" echo 'quoted text' test awk 2>/dev/null $(pwd) grep sed readonly
+$(pwd) test readonly printf readonly 2>/dev/null grep &&
+		&& 2>/dev/null done --verbose -eu -eu -eu test
+$(pwd) x=1 local -eu awk test ${HOME} local export done /usr/bin cd $(pwd) x=1
+"$1" "$@" "$@" "$1" sed $(pwd) /usr/bin then awk $(pwd) sed --verbose &&
+-eu 'quoted text' $(pwd) -eu -eu "$1" local 'quoted text' /usr/bin
+printf cd done then x=1 ${HOME}
+		test | sed printf printf then cd then 2>/dev/null done
+${HOME} then && 'quoted text'
+"$@" 'quoted text' $(pwd) local && && echo printf /usr/bin ${HOME} then then
+	done awk printf awk /usr/bin /usr/bin |
+	"$@" then test echo then $(pwd) 'quoted text' awk 'quoted text' cd ${HOME} export
+		cd "$@" awk readonly cd $(pwd) "$1" cd | 2>/dev/null
+		test "$1" 'quoted text' grep "$@" ${HOME} --verbose --verbose "$@" && 'quoted text'
+		"$1" printf echo test printf /usr/bin "$1" ${HOME} --verbose local sed grep &&
+	export 'quoted text' "$1" export -eu cd && -eu "$1"
+--verbose && x=1 test x=1 "$1" test sed test ${HOME} then awk "$1" 'quoted text'
+"$1" -eu local "$1" --verbose $(pwd) x=1 x=1 cd readonly $(pwd) export -eu 'quoted text'
+	'quoted text' then echo 2>/dev/null
+'quoted text' export && printf cd ${HOME} readonly
+		| && 2>/dev/null 'quoted text' "$1" 'quoted text' test "$@"
+	&& 2>/dev/null export -eu done "$1" readonly ${HOME}
+	sed "$1" test -eu "$@" "$@" "$@" "$1" /usr/bin 'quoted text'
+--verbose cd /usr/bin echo echo && |
+readonly 2>/dev/null done 2>/dev/null grep ${HOME}
+	2>/dev/null ${HOME} x=1 ${HOME} cd "$@" export test
+	echo "$@" readonly export done 2>/dev/null then && awk test $(pwd)
+cd 2>/dev/null | printf "$@" -eu /usr/bin export x=1 "$@" cd
+	${HOME} 2>/dev/null readonly cd $(pwd)
+		sed $(pwd) test x=1 $(pwd) -eu cd
+awk $(pwd) cd export 'quoted text'
+${HOME} $(pwd) 'quoted text' export --verbose
+		"$1" cd done 2>/dev/null
+	grep printf $(pwd) /usr/bin
+		x=1 2>/dev/null | ${HOME} printf readonly $(pwd) sed sed export |
+local then "$1" echo "$@" "$1" | readonly ${HOME} "$@" 'quoted text'
+x=1 && printf printf export ${HOME} 'quoted text' "$1" | x=1 awk awk
+cd "$1" 'quoted text' local
+-eu 'quoted text' --verbose grep then sed cd printf then echo /usr/bin
+		sed /usr/bin sed "$1" printf --verbose
+	| && test printf export sed /usr/bin
+		/usr/bin "$@" local export | --verbose "$1" --verbose
+		echo $(pwd) readonly 2>/dev/null ${HOME} test && && x=1 "$@"
+		then readonly done local /usr/bin && done /usr/bin sed x=1
+	echo $(pwd) export readonly done sed printf local | $(pwd) --verbose export
+	readonly | awk && printf 2>/dev/null
+	export | then "$1" 2>/dev/null ${HOME} sed --verbose
+$(pwd) && local test "$@" && sed sed awk x=1 /usr/bin 2>/dev/null
+readonly -eu cd --verbose x=1 /usr/bin -eu local
+	'quoted text' && test sed sed then x=1 'quoted text' -eu ${HOME}
+	sed readonly test grep readonly then awk grep local --verbose
+		printf export echo readonly
+		readonly "$1" "$1" -eu "$1" --verbose "$@" --verbose
+export | --verbose printf done
+		&& && | ${HOME} export 'quoted text' readonly then test
+&& test $(pwd) local 'quoted text'
+		test printf $(pwd) 2>/dev/null x=1 done test /usr/bin then "$1" test 'quoted text'
+		'quoted text' -eu readonly printf grep 2>/dev/null
+	echo grep printf x=1 readonly && awk cd /usr/bin export 'quoted text'
+	echo "$@" ${HOME} then then | sed grep "$1" -eu
+		&& x=1 local awk done awk
+		awk --verbose | && && test "$@" | "$1" test export cd test export $(pwd)
+		grep local 'quoted text' $(pwd) 2>/dev/null sed "$@" $(pwd) -eu
+		&& ${HOME} --verbose awk grep grep "$@"
+then echo $(pwd) 'quoted text' 'quoted text'
+	| local test --verbose | echo | $(pwd)
+done test readonly | | /usr/bin 2>/dev/null --verbose grep readonly
+		done | grep sed 2>/dev/null
+		printf && --verbose | $(pwd) grep "$@" export "$@" | sed printf sed then
+sed x=1 x=1 'quoted text' echo readonly sed done --verbose then "$@" awk "$@"
+	done readonly done test ${HOME} then local && done --verbose
+cd && ${HOME} 'quoted text' done 'quoted text' local
+"$@" echo grep export | --verbose
+		--verbose -eu local --verbose echo awk cd | test test "$@" $(pwd) -eu --verbose
+x=1 "$@" -eu test x=1 'quoted text' printf
+	readonly --verbose cd local grep sed awk printf --verbose then readonly
+	$(pwd) then | grep test /usr/bin && test sed test $(pwd) 2>/dev/null awk
+		local then test done awk test grep cd "$@" /usr/bin && "$1" export awk
+--verbose ${HOME} /usr/bin
+		${HOME} done ${HOME} printf awk ${HOME} 'quoted text'
+	grep printf local test ${HOME} x=1 export |
+readonly echo then test grep
+		'quoted text' "$@" "$1" cd export local done /usr/bin
+	/usr/bin echo echo 2>/dev/null "$1" --verbose echo readonly readonly
+		then 2>/dev/null --verbose export --verbose | local && | test
+		"$@" 'quoted text' then
+		echo && -eu done done x=1 -eu awk -eu echo test done --verbose
+		"$@" printf done "$@" -eu x=1 done
+		x=1 export "$1" export cd -eu printf awk
+	local | done done ${HOME} echo | printf ${HOME} then "$@" readonly -eu export
+2>/dev/null done -eu sed --verbose export then ${HOME}
+grep cd grep done ${HOME} ${HOME} $(pwd)
+	grep x=1 echo cd 'quoted text' grep
+		readonly awk grep --verbose "$@" "$1" sed --verbose grep 'quoted text'
+		done grep ${HOME} && echo cd grep done awk then "$@" cd ${HOME} grep then
+done readonly 2>/dev/null sed printf cd "$@" && sed export echo "$@" 'quoted text'
+awk export done export --verbose /usr/bin
+		export | x=1 sed cd && -eu export $(pwd) sed then x=1 then
+		sed readonly local &&
+	${HOME} -eu -eu then $(pwd) done cd grep awk then
+		awk test -eu --verbose readonly "$@" export
+	${HOME} cd awk cd "$1" | grep export --verbose sed readonly &&
+cd -eu x=1 sed printf /usr/bin export
+local && then && 2>/dev/null /usr/bin -eu awk local printf /usr/bin 'quoted text'
+	local test /usr/bin echo "$1" /usr/bin
+echo "$@" sed 2>/dev/null "$1" test $(pwd)
+	local printf sed "$1" echo printf "$@"
+	/usr/bin | grep "$1" done cd $(pwd)
+test then x=1 local 'quoted text' export $(pwd) /usr/bin
+	$(pwd) grep | /usr/bin ${HOME} $(pwd) test cd 'quoted text' 2>/dev/null export
+	sed "$@" ${HOME} x=1 readonly /usr/bin awk -eu echo echo -eu -eu | local -eu -eu
+	x=1 export grep ${HOME} done
+	grep --verbose grep test 'quoted text'
+		2>/dev/null ${HOME} ${HOME} -eu --verbose echo ${HOME} x=1 $(pwd) local
+readonly | then 'quoted text'
+	echo sed grep $(pwd) --verbose --verbose test
+	&& ${HOME} x=1 'quoted text' local
+printf -eu "$1" 'quoted text' && then ${HOME} grep | x=1 done then --verbose readonly
+	$(pwd) "$1" local export
+		local export x=1 readonly && echo --verbose /usr/bin
+	-eu 2>/dev/null then printf --verbose "$@" readonly x=1 "$@" -eu cd echo /usr/bin
+	"$@" 2>/dev/null 'quoted text' echo export && test -eu
+		&& export 'quoted text' readonly 'quoted text' readonly
+	echo export ${HOME} "$1" done 2>/dev/null
+	echo readonly grep 'quoted text'
+		awk then printf "$1" ${HOME} "$@" printf cd /usr/bin sed
+/usr/bin | printf | "$1" x=1 "$@" printf 2>/dev/null ${HOME} awk -eu -eu "$1"
+grep test printf printf -eu -eu then test $(pwd) "$@" $(pwd)
+"$1" done | "$1" test | x=1 x=1 then -eu
+		readonly -eu "$1" echo x=1 grep grep
+		$(pwd) readonly "$@"
+	printf ${HOME} sed "$1" /usr/bin then test "$1" 2>/dev/null
+export | printf cd -eu /usr/bin awk ${HOME} awk sed 'quoted text' echo
+		sed echo 'quoted text' readonly printf
+	$(pwd) awk done 'quoted text' 2>/dev/null
+--verbose export 'quoted text' test -eu sed -eu then
+	echo ${HOME} 2>/dev/null done export grep "$1" 'quoted text'
+		cd "$@" $(pwd) "$@" local done cd then "$1" grep cd --verbose
+	x=1 printf | local 'quoted text' --verbose printf
+&& readonly ${HOME} 'quoted text' x=1 x=1
+"$1" grep ${HOME} readonly export export
+	printf x=1 then echo 'quoted text'
+		${HOME} sed "$1" /usr/bin readonly
+	${HOME} 2>/dev/null | readonly local awk x=1 x=1 cd export x=1 2>/dev/null | export
+x=1 printf --verbose done | 'quoted text' test ${HOME} echo awk printf
+	awk readonly printf /usr/bin
+	| -eu local export printf | echo sed 'quoted text' sed grep 'quoted text'
+	--verbose && done --verbose ${HOME} then "$@" export
+	2>/dev/null x=1 then done cd local
+	| echo sed sed awk --verbose awk
+cd && 2>/dev/null && "$1" awk ${HOME}
+		sed sed export "$1" ${HOME} echo x=1 x=1
+	export 2>/dev/null local
+/usr/bin /usr/bin done x=1 | --verbose local grep 2>/dev/null sed printf
+	echo "$@" "$1" | 2>/dev/null
+	"$@" $(pwd) $(pwd) test x=1 local readonly readonly
+sed cd grep test ${HOME} /usr/bin 2>/dev/null 2>/dev/null "$1" --verbose
+	"$1" test "$1" sed printf grep cd then grep
+	sed test x=1 sed --verbose --verbose --verbose
+		sed printf sed readonly /usr/bin
+		2>/dev/null echo $(pwd) cd ${HOME} test /usr/bin && "$@" done then --verbose
+		| done /usr/bin echo && 'quoted text' "$1" echo ${HOME}
+		printf --verbose printf
+		export export -eu local "$1" ${HOME} --verbose $(pwd) 'quoted text' test -eu
+		"$1" test cd export done readonly /usr/bin /usr/bin /usr/bin sed printf
+	/usr/bin then -eu /usr/bin "$@"
+	done sed x=1 && 2>/dev/null test | local --verbose $(pwd) /usr/bin done then --verbose
+2>/dev/null cd then echo ${HOME} ${HOME} then -eu readonly --verbose
+		-eu local then --verbose cd done echo "$1" 2>/dev/null
+-eu test cd ${HOME} --verbose awk /usr/bin echo readonly
+		test "$@" x=1 printf then readonly export -eu cd $(pwd) sed printf | "$1" 2>/dev/null
+	--verbose /usr/bin export --verbose test --verbose
+${HOME} awk | "$@" printf export 'quoted text'
+	| x=1 2>/dev/null "$@" printf readonly
+grep "$1" local ${HOME} printf "$@" export "$1" $(pwd)
+	done 'quoted text' ${HOME} export local -eu
+	$(pwd) test /usr/bin then
+		done awk cd grep 2>/dev/null "$@" cd /usr/bin then &&
+		&& "$@" printf 2>/dev/null test export "$1" "$1" ${HOME} "$@" "$1" && 2>/dev/null
+		x=1 | "$@" cd 'quoted text' ${HOME}
+		--verbose test then grep 2>/dev/null
+	done done "$@" done awk done ${HOME} /usr/bin local /usr/bin
+${HOME} x=1 x=1 | x=1 "$@" printf
+local done cd "$@" --verbose 2>/dev/null 'quoted text' x=1 $(pwd)
+	awk | sed printf /usr/bin grep cd /usr/bin local then export cd
+test grep && grep local -eu cd grep printf && -eu
+$(pwd) --verbose ${HOME} test done grep ${HOME} echo ${HOME} test awk $(pwd)
+		"$1" "$@" grep done 'quoted text' -eu ${HOME}
+$(pwd) test export awk local --verbose "$@" export
+&& export /usr/bin 'quoted text' test printf test test export $(pwd)
+	/usr/bin ${HOME} readonly && --verbose
+export sed awk cd done
+"$@" cd $(pwd) | echo ${HOME} $(pwd) && /usr/bin
+| sed then grep export
+	x=1 local awk test awk "$1" grep -eu | grep /usr/bin export "$@" -eu 'quoted text'
+	"$1" | printf done echo
+cd done /usr/bin sed && && ${HOME} | readonly printf 'quoted text'
+readonly $(pwd) 'quoted text' echo $(pwd) sed 2>/dev/null
+		--verbose "$@" /usr/bin ${HOME} --verbose readonly /usr/bin
+	${HOME} grep $(pwd) done
+| sed echo "$@" then 'quoted text'
+	cd awk local awk 'quoted text' | | cd -eu /usr/bin /usr/bin
+		'quoted text' --verbose -eu 2>/dev/null cd local && "$@" && /usr/bin "$@" awk then
+'quoted text' ${HOME}
+$(pwd) 2>/dev/null local sed local "$1"
+	-eu cd readonly --verbose $(pwd) grep readonly 'quoted text' $(pwd) test
+	echo 'quoted text' echo --verbose awk then export
+	'quoted text' echo 2>/dev/null sed grep cd
+	&& "$@" awk "$@" $(pwd) grep test readonly
+-eu local export then /usr/bin cd /usr/bin --verbose /usr/bin sed x=1
+		-eu awk local ${HOME} grep --verbose cd --verbose
+local done local | "$1" "$1" | ${HOME} "$@"
+		${HOME} --verbose printf $(pwd) local grep
+| && && cd | $(pwd) --verbose test test
+		then grep printf done test
+	local $(pwd) grep readonly local export
+		readonly readonly then export ${HOME} 'quoted text' && awk export
+	2>/dev/null printf "$@" local "$@" done done grep && readonly
+		2>/dev/null $(pwd) ${HOME} "$1" $(pwd) "$1" readonly test echo "$@" $(pwd)
+		readonly "$1" 2>/dev/null "$1" then | x=1 | ${HOME} sed grep cd awk && echo 'quoted text'
+		x=1 then "$1" --verbose /usr/bin "$@" echo
+	local "$@" then && && readonly && | readonly sed ${HOME} /usr/bin "$@"
+grep && $(pwd) | ${HOME} printf 2>/dev/null "$@" -eu 2>/dev/null cd done "$1"
+	${HOME} $(pwd) echo readonly local "$@" $(pwd) $(pwd)
+		done --verbose $(pwd) sed export 2>/dev/null "$1" readonly /usr/bin sed $(pwd)
+--verbose "$@" | awk
+	&& echo /usr/bin done cd done
+test readonly "$1" --verbose "$1" then 'quoted text'
+		sed printf sed /usr/bin printf
+		&& ${HOME} 'quoted text' /usr/bin export readonly
+	${HOME} ${HOME} ${HOME} local printf "$@" /usr/bin printf printf grep printf
+		awk $(pwd) ${HOME} cd 'quoted text'
+		&& sed /usr/bin printf | x=1 cd "$1" 'quoted text' export
+		test local | && -eu --verbose "$1" export export test echo
+		'quoted text' done x=1 done export grep ${HOME} "$1" export /usr/bin
+"$@" local ${HOME} then awk awk awk readonly readonly then
+	grep export "$1" printf printf
+$(pwd) awk then 2>/dev/null && export
+--verbose && 'quoted text' ${HOME} 'quoted text'
+	grep readonly && $(pwd) done local export -eu /usr/bin -eu "$1"
+printf | x=1 awk local sed $(pwd) 'quoted text'
+		echo then ${HOME} readonly -eu done echo echo x=1 echo
+--verbose local --verbose printf sed -eu sed done readonly | then done grep
+	grep echo test --verbose sed
+	'quoted text' | -eu "$1" cd --verbose printf 'quoted text'
+	grep -eu ${HOME} awk --verbose grep && readonly "$@" awk 2>/dev/null /usr/bin
+grep "$@" "$@" awk printf export "$1" "$@" --verbose 2>/dev/null readonly
+readonly then | 'quoted text' awk ${HOME} "$@" && export -eu readonly awk
+	${HOME} 2>/dev/null /usr/bin test 'quoted text' -eu -eu -eu awk "$1"
+		${HOME} then x=1 2>/dev/null
+	$(pwd) "$1" cd then ${HOME} then -eu echo awk 2>/dev/null "$1" awk awk awk
+	sed grep local 2>/dev/null | local x=1 x=1 "$1" grep done 'quoted text'
+		awk x=1 -eu echo grep --verbose local 2>/dev/null
+echo "$1" cd test printf --verbose done export echo "$1" && echo printf --verbose
+export | 2>/dev/null readonly awk readonly done sed echo local echo local readonly
+	-eu "$@" --verbose && --verbose --verbose readonly 2>/dev/null
+		local readonly grep test cd echo printf done "$@" export cd cd ${HOME}
+	done $(pwd) local grep test
+		x=1 done done /usr/bin awk sed --verbose echo $(pwd) awk then
+	grep 'quoted text' printf cd -eu "$@" 2>/dev/null
+echo readonly --verbose sed && --verbose | sed
+grep readonly then echo test echo "$1" echo "$@" local && /usr/bin awk | echo
+	done 'quoted text' $(pwd) "$@" done | "$1"
+	-eu grep && echo echo | readonly awk $(pwd) 'quoted text' "$@"
+sed 'quoted text' awk x=1 awk 2>/dev/null export printf printf cd cd
+	--verbose 2>/dev/null x=1 "$1" grep test awk ${HOME} "$@" readonly readonly done
+	$(pwd) x=1 sed $(pwd) 'quoted text' x=1 grep 2>/dev/null
+		/usr/bin readonly 2>/dev/null /usr/bin export && awk readonly "$1" cd readonly
+	then then 2>/dev/null && $(pwd) ${HOME} cd ${HOME} 2>/dev/null then "$@" 'quoted text'
+2>/dev/null x=1 'quoted text' cd x=1 'quoted text'
+2>/dev/null readonly export test cd then 2>/dev/null "$@" grep /usr/bin
+	sed x=1 local sed 'quoted text' sed 2>/dev/null
+sed then --verbose | awk $(pwd) "$1" ${HOME} -eu 'quoted text'
+	printf ${HOME} export | 'quoted text' sed "$@"
+test $(pwd) test --verbose && /usr/bin test export readonly "$1" readonly then
+	local && -eu 'quoted text'
+&& /usr/bin "$1" | cd 'quoted text' -eu | "$1" "$@" readonly
+awk echo echo --verbose /usr/bin ${HOME} export done 2>/dev/null
+		test | awk grep cd 'quoted text' "$@" test grep
+	done "$@" "$@" grep "$@" "$1" then /usr/bin echo "$1" then printf local readonly
+	done /usr/bin $(pwd) --verbose test ${HOME} $(pwd) /usr/bin 2>/dev/null
+	-eu readonly local ${HOME} test test x=1 --verbose readonly
+sed ${HOME} && -eu cd echo "$1" grep echo && local /usr/bin -eu x=1 -eu
+		cd x=1 && -eu | export --verbose -eu then 'quoted text' grep printf /usr/bin
+	then local -eu sed export echo grep --verbose
+		/usr/bin && "$@" x=1 x=1 readonly echo x=1 test done --verbose | done /usr/bin
+		/usr/bin awk echo grep
+/usr/bin $(pwd) $(pwd) readonly echo --verbose
+		done "$@" "$@" "$1" 2>/dev/null sed
+		'quoted text' sed cd --verbose $(pwd) x=1 done cd /usr/bin
+then grep echo && done "$@" x=1 cd export ${HOME} -eu | cd 2>/dev/null test awk
+	grep 'quoted text' "$@" cd $(pwd) 2>/dev/null | x=1 printf x=1
+/usr/bin 'quoted text' x=1 awk test printf done 2>/dev/null done printf
+		-eu -eu "$1" done grep test -eu --verbose grep export
+		--verbose export export ${HOME} 'quoted text' "$1" then grep done export test
+--verbose -eu local | cd readonly "$@" sed && "$@" 2>/dev/null grep cd cd awk
+	sed printf awk echo awk
+x=1 cd | sed /usr/bin "$1" ${HOME} | && x=1 grep done done printf echo
+		'quoted text' test 2>/dev/null ${HOME} && 2>/dev/null
+		| export | -eu --verbose "$@" sed $(pwd) grep then "$1"
+grep ${HOME} 2>/dev/null -eu test local export sed test done -eu printf
+$(pwd) local echo done then "$@" ${HOME} echo local x=1 readonly && done 2>/dev/null
+		"$@" -eu --verbose cd grep
+cd x=1 ${HOME} x=1 export
+&& -eu x=1 readonly local sed
+2>/dev/null cd readonly local then /usr/bin awk test test "$1" ${HOME}
+	sed readonly 2>/dev/null test done --verbose printf
+"$1" --verbose cd done $(pwd) printf then then $(pwd)
+	| --verbose sed --verbose grep --verbose local export -eu
+	'quoted text' 'quoted text' awk $(pwd) done awk /usr/bin ${HOME} grep readonly
+		-eu sed && local then 'quoted text' export --verbose export "$@" echo test
+cd x=1 -eu $(pwd) && x=1 x=1 $(pwd) 2>/dev/null
+grep awk sed export x=1 --verbose printf
+&& 'quoted text' "$1" --verbose "$1" then 'quoted text' test x=1
+	then -eu grep readonly 2>/dev/null -eu | 'quoted text' export
+printf -eu x=1 local | "$1" x=1 ${HOME} echo 2>/dev/null local "$1" local
+test cd grep --verbose sed | awk then
+	$(pwd) done readonly x=1 | local done --verbose $(pwd) test | | x=1 "$@"
+		awk ${HOME} /usr/bin readonly printf
+		export x=1 /usr/bin --verbose x=1 | "$1" grep done cd 'quoted text'
+$(pwd) test 'quoted text' echo $(pwd) $(pwd) then "$1" sed
+		awk $(pwd) cd readonly sed
+printf readonly export sed "$1" grep cd export printf cd export --verbose &&
+		2>/dev/null readonly -eu export done export &&
+		then -eu sed then readonly
+	test $(pwd) 2>/dev/null && sed
+	"$@" | done export $(pwd) x=1 --verbose | $(pwd) printf done $(pwd) 'quoted text'
+		$(pwd) $(pwd) printf x=1 -eu && echo awk /usr/bin x=1 awk cd "$@" printf 'quoted text'
+	then then && sed 2>/dev/null local 2>/dev/null
+		grep "$1" | 'quoted text' done && cd readonly x=1 && done
+2>/dev/null -eu -eu && done /usr/bin --verbose export /usr/bin
+--verbose local cd x=1 --verbose --verbose 2>/dev/null -eu x=1 test
+	${HOME} awk 2>/dev/null 'quoted text' local 'quoted text' | /usr/bin
+	--verbose printf sed printf x=1 -eu "$1" readonly local "$@" && readonly x=1
+	local grep 2>/dev/null done then | /usr/bin | "$@" done printf --verbose
+	'quoted text' local readonly "$1" "$1" sed done
+printf /usr/bin /usr/bin "$1" test x=1 local sed echo
+		cd x=1 -eu grep sed $(pwd) x=1 printf grep grep "$@" 'quoted text' --verbose ${HOME}
+-eu -eu /usr/bin sed "$@" then readonly test --verbose test --verbose
+		export local awk $(pwd) 2>/dev/null --verbose
+		sed && | awk readonly
+test && export --verbose 'quoted text' -eu local export awk sed grep test |
+| "$1" 2>/dev/null local | /usr/bin -eu x=1 done readonly && awk sed cd cd && echo
+	/usr/bin export awk printf grep
+		test then cd local && printf
+	echo --verbose && --verbose local | --verbose
+	then done awk 2>/dev/null done awk local 'quoted text' --verbose "$1" test
+local grep sed cd readonly done awk
+	"$@" cd -eu echo cd grep "$@" export
+--verbose "$@" x=1 export echo then export
+	2>/dev/null && $(pwd) sed -eu printf
+readonly test --verbose export local
+awk -eu x=1 test /usr/bin $(pwd) ${HOME} $(pwd) echo "$@" | --verbose
+printf 'quoted text' readonly 'quoted text'
+	/usr/bin grep export ${HOME} 'quoted text' | done awk
+	export sed x=1 echo ${HOME} | local "$1" echo grep
+	${HOME} readonly local awk "$@"
+		echo x=1 readonly 'quoted text' export done readonly ${HOME} 'quoted text' && |
+		export x=1 && "$1" awk | "$1" /usr/bin x=1
+	-eu awk $(pwd) done printf export $(pwd) | local printf $(pwd)
+		printf 2>/dev/null 2>/dev/null done
+		sed printf /usr/bin 'quoted text' cd --verbose -eu
+		-eu done printf grep --verbose printf "$@" -eu printf grep | cd ${HOME} 2>/dev/null
+"$1" ${HOME} sed x=1 $(pwd) done cd && cd printf -eu readonly ${HOME} 'quoted text'
+	$(pwd) -eu ${HOME} && /usr/bin test readonly readonly
+		grep awk readonly printf "$@" 'quoted text'
+	readonly then echo echo x=1 cd readonly && x=1
+	${HOME} done | local
+awk local export "$@" grep && echo sed $(pwd)
+		&& done -eu "$@" done 2>/dev/null
+		local "$@" awk printf cd grep
+readonly "$@" echo readonly
+	&& | then grep 2>/dev/null ${HOME} 'quoted text'
+$(pwd) done then echo then printf echo "$@" then test then
+printf "$1" cd && then echo --verbose ${HOME} export printf
+		then 'quoted text' -eu && done ${HOME} "$@" 2>/dev/null then grep grep 2>/dev/null
+		cd /usr/bin /usr/bin grep "$@" $(pwd)
+/usr/bin ${HOME} ${HOME} && x=1 2>/dev/null sed x=1 cd -eu 2>/dev/null
+export cd && done echo cd local --verbose x=1 ${HOME}
+	done done | then printf then x=1 && && | && 'quoted text'
+	cd /usr/bin && "$@" local && $(pwd) done printf /usr/bin | test echo ${HOME}
+	local test ${HOME} 2>/dev/null ${HOME} cd awk -eu readonly readonly sed
+	x=1 echo done local cd cd cd 'quoted text'
+		local 2>/dev/null done && grep
+awk /usr/bin -eu cd test test readonly "$@" test "$1"
+export echo sed /usr/bin grep x=1 printf --verbose ${HOME} 2>/dev/null
+done awk test x=1 x=1 test grep "$1" grep $(pwd) sed "$@" grep done then awk -eu
+printf "$1" -eu $(pwd) 2>/dev/null
+		| awk test --verbose /usr/bin $(pwd)
+2>/dev/null sed local awk then
+	readonly test echo sed $(pwd) | 2>/dev/null /usr/bin ${HOME} ${HOME}
+printf "$@" /usr/bin --verbose readonly local 2>/dev/null echo
+	/usr/bin $(pwd) && cd $(pwd) 'quoted text' done readonly
+		/usr/bin awk $(pwd) then 2>/dev/null /usr/bin sed ${HOME} --verbose readonly
+		/usr/bin readonly | 2>/dev/null /usr/bin then "$1" | cd grep "$1" then
+grep --verbose export x=1 local grep x=1
+	| && && 2>/dev/null | && && echo then export
+done 'quoted text' sed
+	then test --verbose 2>/dev/null echo test
+test sed cd "$@" 2>/dev/null --verbose cd then --verbose local --verbose
+		test --verbose cd export
+	x=1 then 'quoted text' awk --verbose x=1 sed
+"$1" "$1" && x=1 ${HOME} | 'quoted text'
+		cd awk then sed test export cd then --verbose local ${HOME} "$1"
+	&& "$1" sed cd grep $(pwd) --verbose --verbose
+'quoted text' ${HOME} local | local "$1" 2>/dev/null
+	readonly done sed grep | awk printf --verbose export && 2>/dev/null
+		2>/dev/null cd "$1" "$1" sed 'quoted text' /usr/bin "$1" ${HOME} echo
+&& 2>/dev/null /usr/bin | awk "$@" grep then 2>/dev/null printf
+echo readonly printf 'quoted text' $(pwd) -eu local 'quoted text'
+	done 2>/dev/null 'quoted text' printf ${HOME} then 2>/dev/null
+| awk grep then && "$@" 'quoted text' then readonly "$@" -eu awk
+		readonly test 'quoted text' 2>/dev/null "$@"
+		&& test export /usr/bin sed $(pwd)
+	then 'quoted text' cd readonly $(pwd) --verbose ${HOME} 'quoted text' test 'quoted text'
+&& readonly export then $(pwd) x=1 $(pwd) "$1" "$@" printf awk /usr/bin grep
+		sed export /usr/bin "$1" ${HOME} echo && -eu -eu 'quoted text' printf cd
+'quoted text' | local 2>/dev/null local done
+	"$@" /usr/bin $(pwd) readonly
+export printf awk export cd sed then | echo done local test /usr/bin
+		/usr/bin && /usr/bin readonly local /usr/bin | /usr/bin
+		grep done awk "$@" ${HOME} awk awk sed --verbose sed --verbose
+export ${HOME} then 'quoted text'
+	"$@" then echo cd grep readonly
+export readonly echo x=1 x=1 local cd grep "$1"
+-eu readonly sed done --verbose then grep
+	local | export awk done ${HOME} done export && 'quoted text'
+	test | --verbose "$@" awk "$@" x=1 test && "$1" then printf done $(pwd) $(pwd)
+${HOME} -eu local echo $(pwd) echo sed done "$@" sed
+	sed cd then sed echo then --verbose
+'quoted text' -eu grep sed cd 'quoted text' grep
+test sed test -eu "$1" ${HOME}
+	done local x=1 /usr/bin 'quoted text' grep | sed done
+	"$1" awk ${HOME} | then "$@" 2>/dev/null $(pwd) grep test x=1
+printf | --verbose grep 2>/dev/null 'quoted text' then
+	local "$1" echo local printf "$1" readonly then --verbose 2>/dev/null export readonly
+	grep --verbose $(pwd) "$@" -eu 'quoted text' local && 'quoted text' 'quoted text'
+done 2>/dev/null cd 'quoted text' test printf ${HOME} echo && $(pwd) export
+-eu local --verbose -eu --verbose grep grep
+export printf cd awk sed grep sed printf awk
+		"$@" --verbose --verbose | then printf readonly test grep 'quoted text' readonly
+	${HOME} then 'quoted text' local /usr/bin -eu | $(pwd) readonly
+${HOME} echo printf printf echo --verbose ${HOME} done $(pwd) --verbose &&
+	/usr/bin 2>/dev/null /usr/bin 'quoted text' "$@" ${HOME} --verbose "$1" local
+	"$1" then x=1 | done -eu "$1" $(pwd) cd "$@" && 'quoted text'
+'quoted text' 2>/dev/null
+	${HOME} -eu then -eu x=1 awk local test -eu ${HOME} export | awk ${HOME} --verbose
+		x=1 local export done sed --verbose sed export grep ${HOME} x=1 'quoted text'
+	--verbose done --verbose -eu echo echo /usr/bin cd local
+		"$@" -eu then /usr/bin 2>/dev/null
+		local then x=1 echo --verbose
+		export $(pwd) ${HOME} echo test readonly && then /usr/bin "$1" 'quoted text'
+	readonly /usr/bin printf | | awk /usr/bin export
+| echo $(pwd) "$@" --verbose "$1" echo
+--verbose x=1 test export && /usr/bin grep done && /usr/bin done cd "$1"
+	sed sed then printf grep x=1 readonly --verbose | x=1
+		printf x=1 test --verbose 2>/dev/null $(pwd) "$1" sed test 'quoted text'
+sed -eu awk printf awk grep done cd 2>/dev/null "$1" --verbose
+	"$1" test export /usr/bin echo $(pwd) --verbose awk
+	-eu $(pwd) "$1" cd echo && x=1 echo ${HOME} /usr/bin printf awk local
+	/usr/bin done 2>/dev/null cd | ${HOME} --verbose done awk test test && "$@" readonly
+"$@" && 'quoted text' export local test local "$1" $(pwd)
+	local sed x=1 test grep export echo then awk awk
+		-eu printf cd local test && && x=1 cd -eu x=1 2>/dev/null cd
+	readonly /usr/bin awk x=1 grep | echo grep | "$1" awk -eu export
+readonly done test done grep printf then --verbose
+		echo export "$@" $(pwd) $(pwd) local /usr/bin then local printf "$@" "$@"
+then x=1 export echo && then awk awk readonly test /usr/bin
+		sed test --verbose ${HOME} awk --verbose done --verbose -eu /usr/bin cd grep
+		awk && -eu && then ${HOME} done echo ${HOME} x=1 x=1 "$1" done --verbose "$1" cd
+		/usr/bin printf "$1" | /usr/bin | echo $(pwd)
+2>/dev/null local x=1 2>/dev/null
+		"$@" -eu --verbose grep 'quoted text'
+	$(pwd) ${HOME} && readonly "$1" -eu | cd "$1" "$@" printf $(pwd)
+grep cd test local 'quoted text' awk
+	2>/dev/null printf "$1" cd awk echo
+		x=1 then sed 'quoted text' $(pwd) "$1" test
+		export 'quoted text' cd "$@"
+readonly -eu sed awk readonly
+		done /usr/bin done | echo x=1 local -eu -eu /usr/bin
+test local local then "$@" readonly | $(pwd) export
+		grep done local sed test done
+	printf && --verbose | cd 2>/dev/null "$@"
+	echo done local -eu printf done ${HOME} | done
+	/usr/bin $(pwd) echo | "$1" export
+		readonly done grep readonly sed then done cd done ${HOME}
+	'quoted text' grep done | && -eu --verbose
+readonly 'quoted text' 2>/dev/null "$1" -eu $(pwd) x=1 then printf
+	cd readonly "$1" export printf then grep
+		grep then | grep "$@" 2>/dev/null 2>/dev/null done cd /usr/bin cd 2>/dev/null
+	grep "$1" cd printf "$@" then echo $(pwd) --verbose |
+		readonly /usr/bin grep $(pwd) sed done "$@" grep grep /usr/bin local echo
+	export export "$1" cd /usr/bin printf && ${HOME} --verbose $(pwd) test
+&& 2>/dev/null local "$@" printf then /usr/bin
+export && done /usr/bin then test /usr/bin done then ${HOME} test ${HOME} readonly
+test /usr/bin awk export echo cd echo -eu sed
+then cd 'quoted text' export | x=1 export grep -eu 'quoted text'
+		export "$@" x=1 -eu export /usr/bin $(pwd) && --verbose --verbose grep "$1"
+	--verbose x=1 sed | printf grep --verbose ${HOME} local echo
+"$@" "$1" $(pwd) printf -eu readonly
+awk echo 2>/dev/null "$1"
+	grep --verbose cd /usr/bin 2>/dev/null x=1
+		awk ${HOME} local x=1 | grep grep ${HOME}
+awk export 2>/dev/null sed x=1 printf local && && x=1 --verbose ${HOME} then x=1
+		test $(pwd) "$1" readonly "$1" && readonly 2>/dev/null -eu sed
+export $(pwd) then readonly
+		$(pwd) awk echo && $(pwd) --verbose readonly $(pwd)
+	&& 2>/dev/null test 2>/dev/null cd echo echo done x=1
+	--verbose 'quoted text' awk readonly -eu x=1 test local --verbose "$@" test -eu
+cd grep 2>/dev/null cd awk "$1"
+--verbose export local | readonly cd export then -eu ${HOME}
+		awk done $(pwd) | sed ${HOME} readonly cd printf
+		&& /usr/bin local sed echo ${HOME} export -eu local sed awk grep && 'quoted text'
+grep readonly && export test | test done /usr/bin
+	"$@" "$@" printf test &&
+-eu sed awk --verbose readonly printf 2>/dev/null
+	local cd grep --verbose --verbose /usr/bin sed 2>/dev/null ${HOME}
+local | local --verbose && /usr/bin awk echo ${HOME} -eu cd
+		readonly cd awk echo cd ${HOME} sed
+$(pwd) export printf sed then 'quoted text' "$1" awk sed
+		--verbose -eu | local sed -eu done 'quoted text' sed && then readonly
+'quoted text' 'quoted text' cd cd x=1 | done local sed | 'quoted text'
+		test "$1" printf --verbose awk echo $(pwd) export
+-eu done $(pwd) readonly done cd ${HOME} --verbose
+--verbose x=1 echo awk $(pwd) $(pwd)
+cd -eu sed -eu readonly test x=1 test test done 'quoted text' "$1" -eu /usr/bin
+	test cd -eu 'quoted text' local "$1" awk $(pwd) /usr/bin --verbose
+		echo "$@" ${HOME} "$1" && test readonly sed $(pwd) && -eu $(pwd) echo --verbose
+&& then readonly ${HOME}
+grep then local | grep --verbose awk 2>/dev/null x=1 /usr/bin
+	test test readonly ${HOME} printf cd test grep
+	$(pwd) then grep ${HOME} --verbose
+test 2>/dev/null printf echo ${HOME} --verbose then "$@" printf
+	'quoted text' export && export 'quoted text' "$@"
+	sed test awk echo 2>/dev/null readonly then
+--verbose test ${HOME} | -eu grep test --verbose "$1" sed && && -eu
+		test 2>/dev/null --verbose sed then local done done -eu && -eu echo then $(pwd)
+		readonly export "$@" 'quoted text'
+sed readonly cd "$1" awk done | awk local
+		awk grep local echo printf 2>/dev/null
+	printf export echo then echo grep readonly ${HOME} grep printf echo printf
+'quoted text' local /usr/bin awk then -eu readonly "$@" $(pwd) export done
+/usr/bin "$1" cd ${HOME} && echo
+		$(pwd) && done then "$@" export grep
+$(pwd) readonly -eu printf /usr/bin 'quoted text' && && "$@" sed /usr/bin
+		then done sed done cd export 'quoted text' 2>/dev/null | ${HOME} | "$1" -eu
+		test x=1 then awk && $(pwd) sed sed $(pwd) | 'quoted text'
+then done cd 'quoted text' cd cd export export 2>/dev/null test
+		cd "$@" readonly readonly done
+		x=1 readonly readonly /usr/bin && 2>/dev/null export test | then ${HOME}
+export --verbose cd then test export local
+-eu printf then then
+	/usr/bin 'quoted text' ${HOME} ${HOME}
+		echo readonly --verbose test cd done sed
+2>/dev/null local printf readonly awk $(pwd) | "$@"
+grep /usr/bin grep && /usr/bin --verbose ${HOME} local && 'quoted text' sed ${HOME}
+	&& -eu "$1" x=1 cd sed
+	"$@" 'quoted text' ${HOME} "$1" readonly sed x=1 | $(pwd) export sed cd
+	printf x=1 x=1 readonly /usr/bin echo echo 'quoted text'
+--verbose --verbose 'quoted text' done -eu readonly "$@" ${HOME} done x=1
+	| -eu && then 'quoted text'
+		| && "$1" "$@" /usr/bin cd awk -eu test /usr/bin x=1 readonly
+	| echo readonly done && $(pwd) done printf | local
+		&& "$1" cd cd /usr/bin --verbose | -eu 'quoted text' 2>/dev/null
+printf && -eu x=1 cd $(pwd) -eu grep printf $(pwd) "$@"
+		x=1 --verbose grep -eu printf
+		grep export "$@" $(pwd) echo awk local done
+		echo local "$@" 2>/dev/null 2>/dev/null
+then /usr/bin && grep 'quoted text' -eu "$@" x=1 readonly 2>/dev/null /usr/bin
+/usr/bin then cd local grep 'quoted text' | grep $(pwd) grep done x=1 'quoted text'
+/usr/bin | x=1 done readonly grep local test echo sed && grep
+	readonly /usr/bin 2>/dev/null test export
+readonly | local export x=1 awk echo echo $(pwd) "$1"
+		done printf then echo ${HOME} done 'quoted text'
+"$@" | && && echo "$@" -eu --verbose
+"$@" awk $(pwd) 2>/dev/null export | readonly then sed echo sed then
+	sed echo cd /usr/bin ${HOME}
+	echo "$1" && printf 2>/dev/null readonly printf cd
+	'quoted text' | test $(pwd) $(pwd) /usr/bin
+		x=1 'quoted text' "$@" done cd readonly
+		test | "$@" ${HOME} -eu "$1" printf ${HOME} done ${HOME}
+		"$1" then | ${HOME} "$@" awk
+then /usr/bin ${HOME} -eu
+	printf ${HOME} cd $(pwd) "$1" echo 'quoted text' && printf "$1"
+	cd /usr/bin --verbose "$@" "$1" export "$1" cd && grep x=1 local
+		sed printf test export "$@" printf 'quoted text' grep sed $(pwd)
+done printf then --verbose local
+	sed "$@" sed x=1 sed -eu ${HOME} cd /usr/bin "$1" local x=1
+	done cd && /usr/bin 2>/dev/null "$@"
+		then x=1 'quoted text' then done export -eu echo /usr/bin | grep then
+	"$@" 'quoted text' cd -eu echo $(pwd) "$@" ${HOME} export echo echo readonly echo
+	test awk echo -eu x=1 local
+	readonly awk done 'quoted text' cd printf && echo echo then "$1"
+		export "$1" "$@" done grep test --verbose
+	"$@" done readonly /usr/bin printf
+	then x=1 x=1 'quoted text'
+		-eu local && grep $(pwd) --verbose local x=1
+		--verbose 2>/dev/null | "$1" | --verbose grep printf local readonly
+		local $(pwd) awk "$@" 'quoted text'
+	cd && sed awk "$@" readonly x=1 && "$@" printf ${HOME} done local awk
+	| -eu export grep done done
+		-eu $(pwd) grep export
+		'quoted text' cd "$@" done --verbose
+	sed "$1" x=1 cd "$1" /usr/bin --verbose
+		printf "$1" awk 2>/dev/null --verbose
+then echo "$1" test 'quoted text' awk x=1 2>/dev/null
+	&& local readonly export x=1 "$@" then 2>/dev/null 'quoted text'
+		test local "$@" && done &&
+		echo 'quoted text' --verbose readonly grep then --verbose -eu "$1" "$@" "$@"
+		"$@" awk printf export local readonly
+	x=1 cd printf readonly 2>/dev/null ${HOME} export test done | export -eu
+		"$1" printf && x=1 readonly x=1 cd
+	done --verbose -eu sed
+'quoted text' sed | -eu export /usr/bin grep --verbose local 2>/dev/null awk
+		sed local export 'quoted text' --verbose test then then
+		local $(pwd) printf &&
+		x=1 then x=1 --verbose
+		cd export sed | then | && export echo local --verbose awk awk done
+	'quoted text' sed x=1 | sed "$@" echo export $(pwd)
+"$1" sed && printf test 'quoted text' cd done sed local readonly awk
+	cd "$1" test 'quoted text' ${HOME} "$1" awk awk sed "$@" 'quoted text'
+	"$1" | 'quoted text' -eu x=1 -eu then x=1 cd then -eu && test test echo
+	--verbose export export
+		2>/dev/null done x=1 cd "$1" 2>/dev/null -eu && && 'quoted text' 2>/dev/null
+		"$1" sed sed done -eu grep export cd | cd --verbose ${HOME} "$1" printf awk /usr/bin
+grep $(pwd) local awk "$@" test
+done && /usr/bin printf local "$1" grep
+		awk ${HOME} x=1 awk printf echo
+	x=1 "$1" -eu --verbose $(pwd) && printf x=1 then $(pwd)
+awk 2>/dev/null "$@" cd -eu sed grep && 2>/dev/null /usr/bin sed ${HOME} readonly
+		$(pwd) done grep && printf sed 'quoted text' then readonly x=1 "$@" cd --verbose
+/usr/bin echo cd && cd -eu x=1 export -eu ${HOME} printf readonly
+		readonly local export sed awk cd readonly cd "$@"
+	local 'quoted text' done x=1 printf -eu /usr/bin
+	echo readonly 'quoted text' | -eu --verbose "$@"
+cd ${HOME} then local |
+	"$1" "$@" ${HOME} /usr/bin -eu done grep &&
+&& readonly echo x=1
+		cd readonly /usr/bin 'quoted text'
+		| /usr/bin "$1" $(pwd) awk test "$@" done export
+		test | sed 'quoted text' /usr/bin "$1" "$@" && export
+"$@" cd --verbose local x=1
+$(pwd) then 'quoted text' && "$@" ${HOME} test export
+| test && 'quoted text' export cd export x=1 --verbose | /usr/bin export awk -eu
+		cd x=1 readonly /usr/bin /usr/bin cd 'quoted text' x=1 && cd 'quoted text'
+| "$@" ${HOME} | then test local readonly
+--verbose readonly 2>/dev/null --verbose grep x=1
+	'quoted text' then export /usr/bin 2>/dev/null printf | local /usr/bin
+		${HOME} && awk then x=1 /usr/bin && "$@" printf $(pwd) | local test grep
+sed "$1" grep --verbose 'quoted text' "$@" cd awk && test | | readonly
+local x=1 && cd test export cd ${HOME} -eu 'quoted text' x=1 2>/dev/null
+local cd test echo "$1" sed export -eu
+		2>/dev/null printf /usr/bin && done "$@" awk --verbose
+	awk 'quoted text' 'quoted text' done x=1 cd grep 2>/dev/null --verbose local
+cd ${HOME} $(pwd) grep
+"$@" grep x=1 echo /usr/bin
+	2>/dev/null echo sed grep $(pwd) $(pwd) echo local grep readonly readonly x=1 /usr/bin
+		then then sed 2>/dev/null 'quoted text' x=1
+--verbose "$@" "$1" sed && grep x=1 'quoted text' awk done
+		'quoted text' ${HOME} echo $(pwd) | export awk done --verbose "$1"
+	--verbose then local "$1"
+"$@" sed readonly printf printf done $(pwd) then local test
+		then ${HOME} 'quoted text' done grep test --verbose
+	'quoted text' $(pwd) done export export
+	cd /usr/bin awk -eu sed grep cd grep done grep echo grep export cd
+	test && then x=1 cd x=1 | /usr/bin
+		export 2>/dev/null ${HOME} test
+		x=1 && done cd done grep && readonly awk done 2>/dev/null x=1 echo printf
+readonly 'quoted text' "$@" x=1 --verbose local readonly
+		sed "$@" x=1 done | "$@" "$1" && sed
+	$(pwd) | echo && done printf readonly | cd export local
+printf 2>/dev/null export cd x=1 -eu x=1 local
+	${HOME} readonly local | echo local "$@" echo $(pwd) $(pwd)
+		${HOME} 2>/dev/null 2>/dev/null then
+--verbose sed export /usr/bin local
+/usr/bin 2>/dev/null printf export x=1 readonly export ${HOME} x=1 x=1
+		2>/dev/null /usr/bin x=1 test echo $(pwd) export readonly readonly
+x=1 ${HOME} 2>/dev/null sed echo -eu done -eu && cd && sed
+printf awk test 2>/dev/null && $(pwd) printf cd awk $(pwd)
+		export printf then test printf printf x=1
+		printf /usr/bin grep grep --verbose
+		test grep readonly printf "$1" 2>/dev/null
+		readonly $(pwd) then ${HOME} readonly export
+	-eu echo -eu 2>/dev/null echo echo done done | | -eu | local readonly test
+test echo /usr/bin "$@" printf
+	echo done | printf "$1" local readonly 2>/dev/null "$1" ${HOME} ${HOME}
+		--verbose "$1" $(pwd) done sed printf export done printf ${HOME} 2>/dev/null "$1"
+	2>/dev/null echo --verbose local sed then awk 'quoted text' readonly
+		grep 2>/dev/null -eu x=1 done x=1 then
+readonly readonly grep x=1 awk && ${HOME} readonly $(pwd) test
+		--verbose --verbose test cd done -eu 'quoted text' sed
+	awk echo x=1 test | cd && export
+		2>/dev/null ${HOME} test sed | cd awk cd then 'quoted text'
+'quoted text' ${HOME} "$@" "$@" 'quoted text'
+done && /usr/bin grep | sed cd grep
+| readonly 'quoted text' echo "$1" then 'quoted text' x=1 local grep
+$(pwd) "$1" 2>/dev/null sed | -eu
+echo done grep then /usr/bin
+x=1 $(pwd) then "$@" export
+	--verbose cd 'quoted text' && sed
+	${HOME} /usr/bin done x=1 cd -eu
+		readonly 2>/dev/null cd local
+		awk test local readonly done awk
+test done "$1" ${HOME} grep
+	cd 2>/dev/null readonly "$@" | then "$1" printf done 2>/dev/null "$1"
+${HOME} sed cd "$@" readonly "$1" local
+export "$@" sed "$@" grep ${HOME} "$1"
+		echo 2>/dev/null ${HOME} /usr/bin then "$1"
+done "$1" done && 'quoted text' then printf | --verbose ${HOME} cd
+	2>/dev/null export -eu && --verbose && then
+		awk sed "$@" printf done then sed then echo "$1" sed /usr/bin sed ${HOME}
+'quoted text' && /usr/bin
+/usr/bin --verbose cd | /usr/bin test /usr/bin
+grep echo && 'quoted text' "$1" awk awk "$1" then then then
+test | x=1 "$@" && "$1" 'quoted text' sed grep
+		"$@" awk local awk grep ${HOME}
+local then /usr/bin -eu readonly "$@" then done 2>/dev/null
+	readonly "$@" 'quoted text' local -eu sed cd done printf
+		test $(pwd) $(pwd) grep
+	"$@" printf -eu echo readonly /usr/bin local
+		--verbose printf local then awk done --verbose echo grep echo $(pwd)
+	$(pwd) test 'quoted text' cd "$@" | then grep --verbose /usr/bin "$@"
+${HOME} /usr/bin echo /usr/bin | --verbose
+		--verbose -eu sed cd 'quoted text' cd ${HOME}
+		'quoted text' export test 'quoted text' -eu echo awk 2>/dev/null
+	x=1 "$@" $(pwd) test 'quoted text' "$1" /usr/bin | sed printf "$@"
+local 'quoted text' export /usr/bin 'quoted text' 'quoted text'
+	$(pwd) 'quoted text' grep ${HOME} | printf --verbose 2>/dev/null local
+		cd 'quoted text' "$@" x=1 readonly ${HOME} && --verbose printf 'quoted text'
+	test ${HOME} grep export echo done && readonly | | "$1"
+		readonly $(pwd) cd x=1 test 'quoted text'
+	grep export && && cd grep
+&& test $(pwd) | | /usr/bin 2>/dev/null 2>/dev/null --verbose grep $(pwd)
+		2>/dev/null test echo 2>/dev/null -eu then && ${HOME} $(pwd)
+export awk 2>/dev/null 2>/dev/null then x=1 awk --verbose
+printf | /usr/bin 2>/dev/null && printf echo echo
+	--verbose done printf awk
+		printf printf awk && |
+		/usr/bin readonly --verbose /usr/bin 2>/dev/null 2>/dev/null --verbose
+cd echo test printf && $(pwd) ${HOME} local 2>/dev/null 'quoted text'
+	awk echo export awk "$@" then readonly sed readonly cd awk -eu
+		sed done -eu cd "$1" ${HOME} export readonly sed done grep "$1" then && done
+	"$@" ${HOME} "$@" "$@" --verbose awk echo $(pwd) cd -eu readonly
+	x=1 awk sed test "$1" sed export
+		| -eu readonly echo grep readonly -eu -eu
+	done export test ${HOME} "$@" --verbose -eu ${HOME} test export /usr/bin
+"$@" export 'quoted text' -eu /usr/bin
+	export done awk sed 2>/dev/null
+		&& /usr/bin echo readonly "$1" export 2>/dev/null
+	readonly test printf echo 'quoted text' then readonly /usr/bin | x=1 $(pwd)
+x=1 local awk ${HOME} awk
+then sed /usr/bin test "$1" awk grep cd local -eu test
+		test export awk export | awk readonly "$@" then
+x=1 $(pwd) grep printf /usr/bin
+	/usr/bin echo /usr/bin 'quoted text' "$@" --verbose then ${HOME}
+	sed "$1" echo cd grep 2>/dev/null
+$(pwd) "$@" awk --verbose export | grep export sed printf ${HOME}
+	printf && awk done readonly --verbose export awk $(pwd) --verbose echo local
+echo test -eu done sed "$1" "$1" awk -eu | readonly test done test --verbose
+readonly "$1" awk $(pwd) x=1 x=1 then grep grep "$@" -eu then
+'quoted text' x=1 local cd --verbose "$1"
+		local printf grep grep 'quoted text' grep | awk sed sed awk printf export
+	&& sed "$@" test x=1 --verbose echo --verbose x=1 done
+readonly | /usr/bin grep done ${HOME} printf -eu ${HOME}
+export x=1 then $(pwd) readonly local $(pwd) test 2>/dev/null 2>/dev/null
+		then sed awk "$@" local &&
+cd 2>/dev/null done done 2>/dev/null --verbose sed /usr/bin
+export export "$1" "$1" $(pwd) cd readonly cd grep
+		"$1" /usr/bin export && &&
+'quoted text' && 'quoted text'
+		readonly -eu x=1 /usr/bin $(pwd) 'quoted text' echo x=1 "$@" export printf
+cd -eu grep then grep sed ${HOME} /usr/bin
+	"$@" readonly grep 2>/dev/null
+x=1 local $(pwd) cd 'quoted text'
+	awk x=1 /usr/bin "$1" test 'quoted text'
+	/usr/bin "$@" "$1" && done --verbose && export grep "$@" done local --verbose awk
+		${HOME} done then --verbose x=1 then then readonly "$1" then ${HOME}
+| /usr/bin ${HOME} && export 2>/dev/null then readonly
+--verbose done test export sed
+		export done printf grep grep
+	printf done "$1" grep readonly
+		'quoted text' export awk then export x=1
+	--verbose 2>/dev/null echo -eu "$1" awk test ${HOME} --verbose
+		${HOME} test --verbose grep /usr/bin then echo 2>/dev/null ${HOME}
+	"$@" local $(pwd) printf then 2>/dev/null
+		cd readonly | cd sed local | local grep echo | -eu /usr/bin --verbose
+	/usr/bin x=1 sed test grep printf export 2>/dev/null | | ${HOME} readonly
+	sed $(pwd) /usr/bin -eu export ${HOME} sed 'quoted text' readonly awk "$@" cd
+	${HOME} 2>/dev/null test 2>/dev/null x=1 "$1" local cd grep $(pwd) done
+cd readonly "$1" -eu export
+		done ${HOME} ${HOME} printf
+$(pwd) -eu then -eu echo -eu 2>/dev/null readonly $(pwd)
+	$(pwd) --verbose grep x=1 $(pwd) 2>/dev/null export
+		cd cd export done x=1 printf "$@" && export echo "$1" local
+		cd grep --verbose 2>/dev/null | readonly done cd --verbose
+		${HOME} then /usr/bin grep cd done $(pwd) awk test 2>/dev/null echo echo
+	test then 2>/dev/null
+$(pwd) then cd printf sed $(pwd) 2>/dev/null
+local readonly --verbose echo echo "$1" printf | readonly
+	${HOME} -eu 2>/dev/null grep $(pwd)
+	"$1" $(pwd) awk 2>/dev/null echo echo
+		readonly done x=1 x=1 then printf sed export sed readonly && | done printf
+grep done export local 2>/dev/null 2>/dev/null "$1" && /usr/bin
+grep local | readonly ${HOME} awk done cd ${HOME} echo x=1
+		"$1" sed x=1 --verbose readonly printf export $(pwd)
+"$1" $(pwd) --verbose 'quoted text' /usr/bin
+	"$@" grep x=1 echo -eu -eu
+		2>/dev/null awk /usr/bin sed
+		awk printf --verbose 'quoted text'
+grep cd printf echo ${HOME} && cd local sed cd sed cd
+	readonly cd 'quoted text' ${HOME} | /usr/bin export readonly
+	${HOME} then printf $(pwd) "$1" local | --verbose --verbose printf
+test "$@" "$@" cd cd then readonly grep ${HOME} "$@" 2>/dev/null cd printf
+done && "$1" $(pwd) 'quoted text' sed /usr/bin local sed cd /usr/bin then "$@"
+	local $(pwd) -eu echo done --verbose done
+2>/dev/null cd 'quoted text' local done --verbose
+	local cd && /usr/bin 2>/dev/null grep readonly -eu test readonly
+x=1 'quoted text' printf sed then ${HOME} 2>/dev/null
+export done && awk "$1" -eu cd test grep 2>/dev/null
+	&& grep x=1 -eu $(pwd) |
+	done | printf readonly local --verbose 'quoted text' echo printf
+		export awk test | printf --verbose
+		x=1 /usr/bin awk "$@" "$@" local "$1" awk done
+	&& --verbose grep ${HOME} sed echo -eu 'quoted text' -eu "$1" awk
+	echo ${HOME} ${HOME} grep
+		/usr/bin readonly | test /usr/bin
+	--verbose && /usr/bin --verbose
+	'quoted text' /usr/bin then
+printf local then sed "$@" | local 2>/dev/null x=1 && | ${HOME} "$1"
+$(pwd) -eu "$@" readonly grep 'quoted text' -eu /usr/bin sed printf
+export && sed "$@" "$@"
+	'quoted text' readonly --verbose --verbose --verbose 2>/dev/null readonly local
+		"$1" printf awk "$1" -eu --verbose --verbose ${HOME}
+sed export "$1" 'quoted text' done /usr/bin -eu export ${HOME}
+		${HOME} printf $(pwd) --verbose "$@" export
+		sed export local grep --verbose printf echo export && | test export 'quoted text'
+	awk grep readonly done test grep x=1 2>/dev/null "$1" -eu | |
+		'quoted text' printf x=1 export
+	awk sed local ${HOME} $(pwd) | grep done && && echo --verbose "$@" awk /usr/bin
+		-eu cd export local echo x=1 x=1 done x=1 done -eu cd grep && cd ${HOME}
+| awk "$1" 'quoted text' export /usr/bin | /usr/bin test x=1 grep
+$(pwd) -eu $(pwd) local local readonly local local echo "$1"
+export readonly /usr/bin 2>/dev/null readonly | test 2>/dev/null
+	readonly sed -eu | grep readonly "$1"
+	"$1" "$@" --verbose awk "$@" /usr/bin $(pwd) test "$1"
+		/usr/bin readonly done export grep
+| | readonly then /usr/bin awk "$1" sed cd 'quoted text'
+	'quoted text' awk "$@" "$1" $(pwd) 2>/dev/null "$@" $(pwd)
+&& x=1 grep && cd readonly
+	done x=1 ${HOME} export $(pwd) export cd ${HOME} /usr/bin
+		2>/dev/null | printf 'quoted text' $(pwd) then "$1" $(pwd) awk $(pwd) readonly
+local --verbose grep done cd sed ${HOME} printf | then "$1" cd -eu echo /usr/bin
+	export /usr/bin 'quoted text' 2>/dev/null awk 2>/dev/null then
+	echo 2>/dev/null local 'quoted text' grep
+	${HOME} readonly then 2>/dev/null
+		-eu "$1" cd done "$1" grep
+then awk readonly "$@" "$1" /usr/bin awk && readonly printf $(pwd) "$1" x=1
+	echo ${HOME} sed x=1 ${HOME} cd printf 'quoted text'
+		awk && "$@" 2>/dev/null readonly
+	-eu cd "$1" -eu 'quoted text' cd -eu --verbose sed done then -eu 2>/dev/null local
+		"$@" | readonly $(pwd) grep && echo --verbose | done readonly
+	-eu test then echo | x=1 cd "$@" $(pwd) $(pwd) "$@" awk --verbose -eu printf
+done then cd 'quoted text' done -eu
+	test | sed echo --verbose 'quoted text' cd 2>/dev/null local printf
+		cd done ${HOME} && | cd "$@" $(pwd) grep local x=1
+cd 'quoted text' echo 'quoted text'
+	grep grep cd "$1" -eu | sed local
+${HOME} readonly local grep awk grep sed
+	"$@" 'quoted text' "$1" echo | cd local 2>/dev/null
+&& readonly /usr/bin "$1" local cd
+sed local then | grep
+		then export sed test --verbose export sed /usr/bin cd /usr/bin "$1" /usr/bin
+local local ${HOME} && $(pwd) $(pwd) -eu ${HOME} ${HOME}
+-eu test grep -eu done ${HOME} export ${HOME} then awk $(pwd) --verbose -eu done
+	x=1 then grep /usr/bin /usr/bin $(pwd) /usr/bin grep local ${HOME} printf awk |
+		x=1 -eu echo export then
+#include c209.sh
+echo sed sed -eu /usr/bin
+cd printf export test sed --verbose
+		cd echo | export 'quoted text' local && export sed 'quoted text' ${HOME} $(pwd)
+		awk | local cd then printf ${HOME} && && "$1" cd
+		2>/dev/null cd /usr/bin -eu x=1 test cd sed printf local export /usr/bin
+		cd "$@" && test | $(pwd) 'quoted text' done sed && printf && $(pwd)
+		"$@" readonly 'quoted text' readonly readonly x=1 x=1
+		"$1" | ${HOME} x=1 awk test x=1 grep
+	grep ${HOME} printf 'quoted text'
+		sed printf export awk test "$1"
+awk local cd -eu | x=1 then sed cd | readonly export export "$@"
+	printf | grep readonly done test grep export
+		/usr/bin --verbose export sed then
+export && ${HOME} awk
+	awk 'quoted text' sed -eu cd printf ${HOME} then done local 'quoted text' 'quoted text'
+	| then then ${HOME} /usr/bin 2>/dev/null
+		cd test $(pwd) --verbose x=1
+		'quoted text' 'quoted text' echo --verbose readonly
+	-eu "$@" test then $(pwd)
+	"$@" test grep cd awk export awk grep sed && 2>/dev/null echo "$@" test
+		"$1" $(pwd) readonly export grep x=1 awk | grep readonly echo | printf 2>/dev/null
+	export printf | 2>/dev/null -eu 'quoted text' awk 2>/dev/null --verbose
+		x=1 | x=1 export echo
+sed /usr/bin printf export
+"$@" "$1" --verbose cd echo readonly
+	-eu ${HOME} ${HOME} ${HOME} test local grep export printf export
+	test /usr/bin readonly x=1 sed -eu test /usr/bin /usr/bin
+	export grep -eu printf $(pwd) && done done "$1"
+cd "$1" test "$1" "$@" readonly echo "$@" local cd
+	printf /usr/bin awk ${HOME} -eu $(pwd) ${HOME} awk -eu test /usr/bin && "$1" --verbose
+'quoted text' "$@" && cd local printf
+		| ${HOME} printf local test test cd sed -eu $(pwd) /usr/bin
+--verbose x=1 grep "$@" awk grep readonly x=1 "$@" "$1" test /usr/bin
+| readonly x=1 awk then echo && test printf grep printf awk --verbose
+	printf awk --verbose --verbose && /usr/bin 2>/dev/null export $(pwd) echo --verbose
+x=1 x=1 printf && "$@"
+| $(pwd) $(pwd) -eu done "$@" awk 'quoted text' --verbose "$1" export -eu
+	printf grep 'quoted text' /usr/bin "$1" echo printf "$@" && 'quoted text' | local
+	then 2>/dev/null done cd $(pwd) grep --verbose "$1" x=1 local
+grep && 'quoted text'
+	grep 2>/dev/null grep awk export
+	readonly test $(pwd) printf grep
+		"$1" /usr/bin sed cd grep -eu -eu sed && awk done
+	cd local 'quoted text' -eu ${HOME} /usr/bin 'quoted text' test sed --verbose
+--verbose awk then cd export then readonly
+2>/dev/null --verbose export sed ${HOME} ${HOME}
+&& | local 'quoted text' "$@" | cd done $(pwd) awk --verbose sed $(pwd)
+		$(pwd) 'quoted text' cd x=1 ${HOME} echo local 2>/dev/null
+"$@" then local then sed "$@" echo /usr/bin ${HOME} "$1"
+	grep printf | cd x=1 2>/dev/null "$@" ${HOME} awk
+printf readonly x=1 | && | printf
+	"$1" | awk x=1 test export export $(pwd) awk local echo -eu "$1" readonly
+	&& /usr/bin 2>/dev/null "$1" local cd --verbose export --verbose
+		test -eu grep test awk ${HOME} cd /usr/bin sed | export "$@"
+		| done "$@" -eu awk awk | ${HOME} export printf
+		readonly echo cd readonly awk then awk
+	${HOME} cd readonly x=1 test cd 'quoted text'
+"$1" then "$@" echo printf done x=1 done && local
+| $(pwd) -eu --verbose ${HOME} local export then grep
+/usr/bin 2>/dev/null ${HOME}
+		'quoted text' x=1 --verbose printf then ${HOME} $(pwd) /usr/bin /usr/bin echo awk
+awk && readonly $(pwd) x=1 then && "$@"
+'quoted text' done -eu grep test && export --verbose test awk
+	echo local test echo awk /usr/bin | then "$@" --verbose x=1 printf 'quoted text'
+done export --verbose ${HOME} | grep && | | ${HOME} cd awk readonly export
+readonly test "$1" echo --verbose | | --verbose &&
+&& | 2>/dev/null awk readonly test | sed test
+	/usr/bin export | cd export echo readonly /usr/bin "$@" /usr/bin
+2>/dev/null ${HOME} "$@" printf sed && x=1 && sed ${HOME} /usr/bin done | printf
+	-eu then x=1 sed grep local then -eu "$@"
+	test test 'quoted text' | echo | cd cd
+	test | "$1" ${HOME} cd export
+		--verbose "$1" x=1 ${HOME} export /usr/bin "$@" test "$1"
+	grep test echo then -eu local readonly | readonly -eu
+-eu test $(pwd) grep readonly
+sed awk 'quoted text' grep printf echo /usr/bin "$@"
+		done sed done awk | x=1 && /usr/bin awk local export && printf /usr/bin done |
+		/usr/bin x=1 && x=1 --verbose grep ${HOME}
+	local echo x=1 done -eu 2>/dev/null done "$1" export /usr/bin
+	readonly echo echo && ${HOME} 2>/dev/null awk "$@" --verbose
+		-eu x=1 cd test done -eu test --verbose $(pwd) ${HOME} --verbose
+	cd -eu "$@" test && ${HOME} done
+		$(pwd) local | 2>/dev/null | grep
+	cd | "$@" -eu sed --verbose grep printf done
+	grep 'quoted text' local cd awk readonly | 2>/dev/null
+| done ${HOME} grep test
+		cd sed x=1 cd grep readonly
+printf done test cd -eu test then /usr/bin
+	cd 'quoted text' | 2>/dev/null export local done /usr/bin export
+| 2>/dev/null 2>/dev/null readonly 2>/dev/null
+		x=1 then 'quoted text' "$1" readonly | printf -eu test | x=1 && sed
+	| /usr/bin 2>/dev/null awk | then cd then
+grep export --verbose x=1 /usr/bin 'quoted text'
+done "$@" readonly done
+	$(pwd) echo /usr/bin then
+done /usr/bin readonly | readonly | "$1" sed echo local && local 'quoted text'
+		-eu ${HOME} test /usr/bin then test export && printf
+readonly grep -eu readonly then --verbose --verbose 2>/dev/null echo /usr/bin
+test | $(pwd) x=1 ${HOME} $(pwd) echo printf then
+		--verbose test printf /usr/bin local local export | 2>/dev/null
+$(pwd) then export ${HOME} --verbose echo readonly
+	local test 'quoted text' ${HOME} test export readonly "$@"
+cd sed readonly readonly $(pwd) awk
+	grep ${HOME} awk /usr/bin -eu cd 2>/dev/null 'quoted text'
+printf ${HOME} "$@" test printf "$1" sed /usr/bin | && /usr/bin export
+		awk "$1" test | 2>/dev/null then --verbose "$@" && test then
+	--verbose -eu local "$@" printf then test 'quoted text' --verbose
+	x=1 cd echo grep local
+		"$1" ${HOME} then "$@" local $(pwd) printf && /usr/bin then grep
+		| "$1" done printf grep --verbose 2>/dev/null -eu -eu awk echo
+	done -eu grep 2>/dev/null export done && local then local ${HOME} done sed
+	test done then awk sed echo done 'quoted text' export
+		"$@" "$1" awk sed ${HOME} "$1" echo && sed "$1"
+		test then echo export sed && $(pwd) done export cd sed export local
+/usr/bin 2>/dev/null "$1" x=1 sed awk export
+		cd cd ${HOME} grep test x=1 -eu local
+--verbose /usr/bin local $(pwd) readonly sed awk echo ${HOME}
+	done --verbose export export local
+	2>/dev/null --verbose | then $(pwd) printf 'quoted text' $(pwd) -eu sed "$1"
+'quoted text' && "$1" -eu && | | -eu 'quoted text' cd cd printf printf
+	echo -eu export export && -eu x=1 sed test | $(pwd) x=1 done test /usr/bin "$@"
+	"$@" done && "$1" | x=1 /usr/bin done echo ${HOME} readonly
+		"$@" printf 2>/dev/null 'quoted text' then
+	${HOME} /usr/bin 2>/dev/null then $(pwd)
+test ${HOME} sed "$1" printf && export && | test 2>/dev/null printf "$1"
+$(pwd) export 'quoted text' -eu x=1 printf && printf
+		printf -eu then grep "$1" grep | done test grep cd x=1
+"$@" 'quoted text' $(pwd) local
+	grep -eu sed export sed /usr/bin "$1" 'quoted text'
+	${HOME} -eu ${HOME} 2>/dev/null --verbose
+	export then readonly 2>/dev/null test grep awk x=1 grep local 2>/dev/null done
+x=1 -eu grep $(pwd) 'quoted text' 'quoted text' /usr/bin
+		x=1 --verbose export x=1 "$@" awk 2>/dev/null $(pwd) local
+		/usr/bin $(pwd) then 'quoted text' $(pwd) local $(pwd)
+	readonly printf ${HOME} test && then local grep printf local /usr/bin
+printf -eu | then readonly
+'quoted text' | "$@" done then export readonly then then echo 'quoted text'
+		-eu then x=1 /usr/bin --verbose cd done x=1 done grep 'quoted text'
+		grep cd ${HOME} export local done then $(pwd) readonly | awk /usr/bin local
+local 'quoted text' local ${HOME} 'quoted text'
+	$(pwd) | sed local "$1"
+		'quoted text' ${HOME} $(pwd) sed 'quoted text'
+echo | grep grep awk 2>/dev/null awk $(pwd) export
+-eu 2>/dev/null cd x=1 "$@" x=1 ${HOME} test 'quoted text' local
+	done then 2>/dev/null $(pwd)
+	"$1" x=1 export && echo test --verbose
+		grep export 2>/dev/null then readonly readonly ${HOME} local cd --verbose
+	&& printf && 'quoted text' done ${HOME}
+sed local | ${HOME} export && awk printf 2>/dev/null && export /usr/bin
+		--verbose -eu sed then sed echo cd | "$1"
+printf 2>/dev/null cd -eu -eu $(pwd) cd echo readonly local "$1" sed
+		readonly export sed awk done grep sed done ${HOME} grep 2>/dev/null /usr/bin
+		2>/dev/null test "$@" then | readonly $(pwd)
+	printf 2>/dev/null | grep
+	${HOME} readonly sed then printf 'quoted text' grep | 2>/dev/null --verbose
+-eu grep "$@" 'quoted text'
+	"$1" 'quoted text' "$@" readonly test export echo $(pwd) awk test test
+${HOME} awk readonly test x=1 "$@" grep "$@" &&
+| $(pwd) 2>/dev/null then && $(pwd) /usr/bin && then
+	--verbose echo $(pwd) x=1 -eu sed 'quoted text' done x=1 grep /usr/bin echo x=1
+		-eu --verbose "$@" -eu grep 'quoted text' then test -eu awk
+		sed "$1" echo && 2>/dev/null test cd $(pwd) readonly awk 2>/dev/null
+		"$@" --verbose cd $(pwd) sed printf && sed sed 2>/dev/null --verbose local
+awk done "$@" printf readonly readonly "$1" x=1
+test printf done test printf -eu export local x=1 awk done -eu grep 'quoted text'
+sed x=1 /usr/bin awk 'quoted text' sed 'quoted text' | ${HOME} cd cd then
+		local $(pwd) cd 'quoted text' readonly
+sed "$@" sed "$1" && 'quoted text' sed "$@" local done export readonly echo echo
+	export $(pwd) x=1 test $(pwd) then --verbose cd awk echo cd cd sed ${HOME} awk
+export export /usr/bin printf /usr/bin "$1" grep grep "$1" readonly
+	--verbose | cd cd 'quoted text' 'quoted text' --verbose local && -eu
+export done $(pwd) ${HOME} 2>/dev/null -eu printf 'quoted text' "$@" readonly
+then | x=1 $(pwd) export
+		"$1" done $(pwd) grep test && printf export 'quoted text' x=1 grep
+x=1 done cd sed awk /usr/bin 2>/dev/null readonly 2>/dev/null then test && ${HOME}
+		export awk && x=1 then echo local cd 'quoted text'
+readonly 'quoted text' echo readonly export printf | sed "$1" export
+	'quoted text' "$@" 2>/dev/null | x=1 awk printf --verbose ${HOME} echo awk
+		readonly "$@" "$@" then printf -eu done
+	| printf export then printf
+		&& "$@" cd 'quoted text' $(pwd) printf
+"$1" | -eu local 2>/dev/null 'quoted text' cd /usr/bin
+local awk cd ${HOME} 2>/dev/null
+		cd "$1" -eu printf sed export readonly /usr/bin grep echo "$1" "$1" local done
+		then | sed export x=1 2>/dev/null -eu cd awk 2>/dev/null
+printf 2>/dev/null local cd "$@" x=1 then export "$@" 'quoted text'
+$(pwd) printf $(pwd) -eu done
+then "$@" cd grep awk ${HOME}
+x=1 then then /usr/bin cd grep then export printf
+	export echo 'quoted text' x=1 "$@" ${HOME} local /usr/bin
+		grep "$@" grep | $(pwd) export
+		export 'quoted text' | -eu
+	| 'quoted text' printf 2>/dev/null --verbose --verbose
+2>/dev/null awk sed grep 'quoted text' ${HOME} && test
+test 2>/dev/null /usr/bin echo $(pwd) | awk 2>/dev/null export
+	cd cd echo readonly && printf echo done
+	${HOME} done readonly export local "$1" x=1 done echo printf local && &&
+	${HOME} then cd ${HOME} printf readonly "$@" export
+	/usr/bin then awk then
+local && sed x=1 local --verbose $(pwd) $(pwd) done /usr/bin
+		&& readonly && grep echo readonly && cd echo echo "$1" /usr/bin $(pwd)
+		/usr/bin readonly test -eu | ${HOME} readonly
+		&& export 'quoted text' printf test echo && then "$1" --verbose $(pwd)
+	awk /usr/bin sed awk sed 2>/dev/null grep ${HOME} x=1 grep readonly $(pwd) -eu
+	'quoted text' /usr/bin -eu then then 'quoted text' echo test then printf &&
+then "$1" -eu test local -eu echo "$@" cd export | 'quoted text'
+	${HOME} x=1 ${HOME} sed export then cd && printf --verbose awk local
+	2>/dev/null 2>/dev/null readonly
+		local then -eu export export sed --verbose local | export
+"$@" awk --verbose printf cd -eu test "$@" export "$1" x=1 -eu $(pwd) sed &&
+readonly 2>/dev/null readonly "$@" echo x=1 awk echo 2>/dev/null export echo
+		done 'quoted text' x=1
+--verbose | x=1 cd "$1" && | readonly x=1 'quoted text' export "$1" local
+		"$@" sed | awk "$@" sed ${HOME} echo /usr/bin done grep local test -eu
+		readonly echo done grep
+	local $(pwd) x=1 'quoted text' x=1 awk
+		2>/dev/null "$@" grep x=1 ${HOME} export 'quoted text'
+	cd "$1" cd local -eu readonly printf /usr/bin sed $(pwd) local grep "$1" /usr/bin
+grep test local 'quoted text' readonly awk awk then sed export cd "$@" -eu echo
+		'quoted text' test /usr/bin -eu export done then readonly $(pwd) 'quoted text'
+'quoted text' grep | printf x=1 readonly && grep sed /usr/bin
+		/usr/bin x=1 -eu export awk --verbose x=1 /usr/bin --verbose /usr/bin $(pwd) --verbose
+/usr/bin test done $(pwd) printf readonly done
+grep done export sed local test then -eu
+$(pwd) local x=1 sed grep then done sed --verbose printf $(pwd) "$@" test awk --verbose
+${HOME} awk local 2>/dev/null then sed ${HOME} 2>/dev/null
+cd 2>/dev/null readonly echo grep echo "$@" &&
+2>/dev/null /usr/bin readonly
+		"$@" export echo | then echo printf then ${HOME} -eu local 'quoted text' awk
+		"$@" then 'quoted text' | ${HOME} grep
+/usr/bin local sed 2>/dev/null
+cd | grep | x=1 /usr/bin -eu && cd $(pwd) $(pwd) | export awk | then sed
+awk "$1" | export local echo -eu | --verbose && && "$@" readonly
+	awk | 2>/dev/null -eu cd cd done printf "$@" printf 'quoted text' awk
+	readonly sed echo "$@" 'quoted text' 'quoted text' then "$@"
+	local readonly -eu local
+	awk then cd $(pwd) x=1 printf sed "$1" --verbose $(pwd) 'quoted text' export
+2>/dev/null "$@" "$1" /usr/bin -eu "$1" test readonly awk echo 'quoted text'
+		${HOME} printf export export x=1 cd && /usr/bin local | then export x=1 test
+	test export 2>/dev/null --verbose done cd "$1"
+		test test -eu done $(pwd) echo $(pwd) readonly /usr/bin
+		$(pwd) readonly /usr/bin echo sed export
+		echo then awk "$1" 'quoted text' done --verbose sed grep "$1"
+cd echo sed readonly test grep local | grep awk /usr/bin
+	2>/dev/null export 'quoted text'
+	x=1 /usr/bin test x=1 grep sed "$1"
+"$@" --verbose sed "$@" done export x=1 2>/dev/null
+export export awk 2>/dev/null then
+	echo 2>/dev/null grep cd echo 'quoted text' done $(pwd) cd --verbose grep
+2>/dev/null export 2>/dev/null then sed export sed 'quoted text'
+done echo readonly test "$1" awk -eu then then 2>/dev/null then test echo local
+		sed "$@" then x=1 awk test awk /usr/bin 'quoted text'
+		x=1 done 'quoted text' "$1" | /usr/bin test awk $(pwd) 2>/dev/null
+	2>/dev/null local cd 'quoted text' x=1 $(pwd) export $(pwd)
+		grep echo test cd then done &&
+		grep done 2>/dev/null &&
+	$(pwd) /usr/bin -eu x=1 -eu "$1" && $(pwd) grep export "$@" x=1 local printf
+	2>/dev/null then ${HOME} grep cd local
+		local | done printf x=1 && && sed grep 'quoted text' -eu /usr/bin local 2>/dev/null
+&& sed --verbose cd 'quoted text' --verbose test
+		x=1 /usr/bin cd test --verbose /usr/bin cd /usr/bin test
+printf --verbose && readonly grep && printf x=1 2>/dev/null /usr/bin /usr/bin sed
+		-eu grep export echo readonly printf awk /usr/bin "$@" local
+export ${HOME} --verbose
+		"$@" echo sed grep sed local test local | $(pwd) "$1" printf
+'quoted text' cd sed grep --verbose "$@" && printf
+done readonly test readonly awk printf echo
+local $(pwd) 2>/dev/null export && sed printf 2>/dev/null | $(pwd) "$@" grep "$@"
+export && done export local done 'quoted text' "$@" grep
+		${HOME} then cd /usr/bin printf
+	grep --verbose awk -eu printf cd "$1" test
+		sed $(pwd) && local "$@" 'quoted text' export done 'quoted text'
+	$(pwd) /usr/bin grep 'quoted text' && local
+	readonly done ${HOME} 'quoted text' grep test "$@" test "$@"
+		&& then -eu /usr/bin printf
+	grep export -eu awk -eu
+		printf test echo done echo local 2>/dev/null
+		awk 'quoted text' -eu /usr/bin ${HOME} ${HOME} echo
+-eu /usr/bin awk "$@" export printf -eu 'quoted text' test
+2>/dev/null printf "$@" /usr/bin readonly sed export sed export -eu
+	echo x=1 --verbose echo done x=1 'quoted text' && done | /usr/bin "$@"
+	printf -eu 'quoted text' /usr/bin awk test /usr/bin then "$@" /usr/bin /usr/bin
+-eu sed local 'quoted text' echo readonly $(pwd)
+	'quoted text' /usr/bin ${HOME} -eu -eu 'quoted text' $(pwd) grep done "$1"
+	/usr/bin local readonly printf
+	$(pwd) $(pwd) && /usr/bin readonly export
+	done local printf x=1 2>/dev/null -eu export && test "$@" grep -eu grep x=1
+		"$@" cd && && /usr/bin local readonly printf x=1 printf echo
+		printf && cd ${HOME} /usr/bin export awk 2>/dev/null printf -eu
+"$@" test && awk $(pwd) awk cd done then 'quoted text' "$1" then
+	echo grep cd 'quoted text' --verbose cd awk printf "$1" ${HOME}
+	grep local readonly && export 'quoted text' grep | ${HOME} "$@"
+		sed sed done echo 2>/dev/null readonly grep ${HOME} --verbose ${HOME} "$@" sed
+cd --verbose "$@" export "$1" done then readonly && readonly test
+		readonly "$1" echo ${HOME} readonly test --verbose local
+		${HOME} printf /usr/bin 'quoted text'
+	then 2>/dev/null cd | awk export && sed ${HOME} done local "$1" echo local local
+		$(pwd) --verbose && done
+	--verbose then done printf readonly ${HOME}
+		x=1 done sed grep /usr/bin 'quoted text' /usr/bin x=1 awk 'quoted text' ${HOME}
+	done -eu then 2>/dev/null readonly /usr/bin printf awk awk | test cd $(pwd)
+	awk "$@" done awk && /usr/bin readonly cd ${HOME}
+	x=1 awk | readonly cd sed
+done "$@" then --verbose test $(pwd) grep --verbose && |
+grep sed x=1 sed --verbose awk 2>/dev/null sed | export | echo
+		printf grep then | printf test --verbose grep -eu
+	'quoted text' done $(pwd) export cd grep "$1"
+local readonly ${HOME} readonly "$1" local | --verbose 'quoted text'
+	printf /usr/bin echo "$@" grep 2>/dev/null
+		2>/dev/null printf ${HOME} cd grep --verbose |
+	readonly "$@" awk echo "$@" readonly | "$@" echo 'quoted text'
+	echo 2>/dev/null 'quoted text' local done 2>/dev/null -eu && --verbose $(pwd)
+local echo 'quoted text' readonly echo printf | 2>/dev/null
+	"$@" 2>/dev/null -eu done x=1 local grep -eu
+		'quoted text' ${HOME} -eu
+		-eu | echo export $(pwd)
+	"$@" 'quoted text' "$@" ${HOME} sed grep
+echo "$@" | echo "$@" $(pwd) local echo -eu readonly grep grep
+sed "$1" then then local
+	test readonly $(pwd) cd && && export
+		then export then 2>/dev/null
+	local then --verbose -eu readonly
+	export -eu then awk local "$1" printf | then ${HOME} test 'quoted text'
+cd local --verbose printf awk sed "$1" local test
+	'quoted text' sed echo && done printf 'quoted text' local --verbose && done |
+then -eu awk | sed echo /usr/bin &&
+	awk then "$@" grep 2>/dev/null then x=1 /usr/bin grep "$1" 2>/dev/null
+		cd echo export readonly -eu
+	x=1 && then done test done awk 'quoted text'
+${HOME} x=1 -eu -eu $(pwd) test sed ${HOME} done && test 'quoted text'
+		&& -eu grep /usr/bin then cd 'quoted text' && grep
+		then export done | local 2>/dev/null
+"$1" "$@" && 2>/dev/null /usr/bin awk echo done done done then awk &&
+	--verbose sed "$1" grep "$@" awk echo "$@" -eu test readonly "$1" "$@" cd local
+then then export printf done grep |
+	"$1" cd | test readonly | 2>/dev/null awk "$@" readonly
+2>/dev/null "$@" -eu x=1 sed echo printf "$1" readonly local
+		-eu printf readonly awk printf export grep -eu "$@" x=1 awk
+		then -eu 2>/dev/null "$1" awk -eu local 2>/dev/null cd "$1"
+| --verbose local export done --verbose
+		x=1 export | echo cd cd test
+		test --verbose ${HOME} 'quoted text' ${HOME} awk 'quoted text'
+	2>/dev/null -eu && readonly printf | 'quoted text' -eu 2>/dev/null readonly readonly
+	awk test --verbose local local export | | /usr/bin
+&& 2>/dev/null done printf $(pwd)
+	readonly grep ${HOME} awk sed echo && echo
+		| 2>/dev/null /usr/bin 2>/dev/null
+done echo echo && "$@" cd 2>/dev/null done /usr/bin test
+		&& && "$1" then 2>/dev/null /usr/bin | $(pwd)
+	awk sed "$1" x=1 'quoted text' awk grep "$@" readonly test
+"$1" ${HOME} sed "$1" then ${HOME} test export 'quoted text' | echo && readonly
+	grep then awk echo x=1 "$1" export
+		awk "$@" x=1 --verbose cd "$1" export $(pwd) --verbose x=1 && "$1" awk --verbose
+		sed test echo x=1 | done
+		export "$@" "$1" --verbose --verbose x=1 -eu 2>/dev/null --verbose
+	then cd readonly x=1 2>/dev/null /usr/bin /usr/bin sed | done
+	${HOME} export echo | readonly && "$@"
+	awk -eu test done echo
+		grep | cd readonly then -eu
+	$(pwd) "$1" "$@" "$1" echo /usr/bin grep grep "$@" --verbose
+	--verbose done cd 'quoted text' | done "$1" ${HOME} --verbose
+sed --verbose done "$1" echo test printf $(pwd) ${HOME}
+	-eu grep ${HOME} export && readonly
+	&& $(pwd) /usr/bin readonly "$@" grep $(pwd) done && echo $(pwd) /usr/bin "$1"
+	x=1 test then then -eu && 'quoted text' sed /usr/bin
+		${HOME} readonly /usr/bin /usr/bin ${HOME} && done test x=1 cd | && && then
+	--verbose && export --verbose 2>/dev/null done "$@" test "$1" && "$1" &&
+		readonly && x=1 && && done $(pwd) | test then "$@"
+	$(pwd) then 'quoted text' "$@" awk
+	$(pwd) "$@" x=1 /usr/bin | readonly x=1 sed --verbose -eu "$@" test
+	--verbose $(pwd) "$@" "$1" test $(pwd) x=1
+		/usr/bin test --verbose sed sed cd | grep &&
+		x=1 awk test $(pwd) done local sed echo awk | 2>/dev/null
+	test export export grep cd echo printf test
+	printf cd 2>/dev/null && local test "$1" "$@" x=1 ${HOME} "$1" cd
+		$(pwd) sed sed "$@" awk ${HOME} export local "$1" && --verbose
+"$@" 2>/dev/null local printf awk cd awk $(pwd) "$@" echo
+		echo && 2>/dev/null grep x=1 x=1 echo && done $(pwd)
+		2>/dev/null 2>/dev/null readonly $(pwd)
+	awk /usr/bin --verbose then "$@" ${HOME} sed done readonly 2>/dev/null
+		sed cd cd 2>/dev/null --verbose cd "$@" printf sed printf --verbose
+	$(pwd) ${HOME} printf cd ${HOME} echo grep printf | then echo && 2>/dev/null
+	--verbose grep 2>/dev/null test --verbose "$@" cd test "$1"
+	printf $(pwd) $(pwd) ${HOME} --verbose cd grep grep awk $(pwd)
+		"$@" ${HOME} sed | /usr/bin
+	--verbose then ${HOME} 2>/dev/null awk grep | "$@" test 2>/dev/null
+'quoted text' 'quoted text' "$1" 'quoted text'
+/usr/bin "$1" $(pwd) | sed
+"$1" readonly then sed readonly --verbose awk -eu echo "$@" cd then test
+		grep local ${HOME} sed readonly
+	done $(pwd) cd /usr/bin /usr/bin grep done 2>/dev/null -eu printf x=1 |
+	2>/dev/null -eu "$1" test export -eu grep awk echo echo cd x=1
+	| printf sed ${HOME} then
+		| | ${HOME} done | "$@" 2>/dev/null cd then 'quoted text'
+done x=1 -eu sed awk 'quoted text' export --verbose && -eu export
+		x=1 echo "$@" cd test then echo "$1" $(pwd) | then echo 'quoted text' $(pwd)
+--verbose x=1 x=1 --verbose then then 2>/dev/null -eu done --verbose 'quoted text'
+		"$@" /usr/bin readonly --verbose /usr/bin 'quoted text'
+	| local $(pwd) 'quoted text'
+	'quoted text' grep /usr/bin printf ${HOME} -eu "$@" "$1" printf
+	awk $(pwd) /usr/bin "$@" local "$@" printf | echo readonly then sed readonly
+grep "$1" awk "$1" | -eu ${HOME} | local "$@" 2>/dev/null sed readonly sed
+export readonly test readonly
+	awk sed export $(pwd) -eu awk "$@" && awk printf 'quoted text' test --verbose cd
+		echo local "$@" done done x=1 2>/dev/null
+export cd readonly $(pwd) && done
+		awk $(pwd) -eu echo printf --verbose test &&
+	${HOME} done grep test then
+&& then awk readonly 'quoted text' 'quoted text' "$@" && test
+done grep printf awk awk &&
+		then 2>/dev/null x=1 "$1" 'quoted text'
+		| echo "$1" awk cd "$1" x=1 "$@" then ${HOME} sed $(pwd) 'quoted text' "$1"
+	printf ${HOME} /usr/bin
+	$(pwd) "$1" awk 2>/dev/null export
+	grep $(pwd) cd echo ${HOME} readonly grep /usr/bin echo cd done printf readonly
+		'quoted text' test ${HOME} "$@"
+grep done done echo | --verbose
+	&& x=1 /usr/bin x=1 'quoted text' test -eu x=1
+		x=1 sed --verbose readonly -eu $(pwd) grep sed test /usr/bin x=1
+	-eu -eu -eu test done "$1" awk export | && sed local local
+		| "$1" --verbose $(pwd) awk then then x=1 "$@" grep echo cd "$@" && export
+		x=1 | /usr/bin done ${HOME} then cd awk x=1 printf
+echo "$1" "$1" printf ${HOME} grep ${HOME} test cd
+		"$1" readonly awk printf printf printf local local
+	'quoted text' readonly local echo /usr/bin awk export /usr/bin && 'quoted text'
+		done readonly | readonly export 'quoted text' done then | readonly
+		2>/dev/null /usr/bin export sed /usr/bin ${HOME} readonly done $(pwd) local local
+test readonly export export -eu done
+x=1 "$@" printf export export -eu "$1" 2>/dev/null grep printf local awk export
+		export readonly readonly --verbose "$@" /usr/bin ${HOME} /usr/bin 2>/dev/null printf
+		printf 2>/dev/null readonly 'quoted text' awk
+		test "$1" awk cd ${HOME} then "$@" $(pwd) awk awk printf printf
+	&& x=1 printf "$1" "$@" then --verbose -eu --verbose export
+	"$@" --verbose test -eu done x=1 export grep cd x=1 test test
+${HOME} | /usr/bin x=1 x=1 'quoted text' local cd -eu -eu 2>/dev/null
+	awk grep x=1 grep "$@" $(pwd) --verbose printf "$@" --verbose 'quoted text'
+	$(pwd) && then --verbose readonly echo /usr/bin test /usr/bin --verbose
+	then "$1" then awk readonly x=1 'quoted text'
+	$(pwd) printf && x=1 $(pwd) grep local
+		x=1 done -eu cd "$@" cd 'quoted text'
+	local sed cd grep --verbose printf echo /usr/bin
+	readonly grep done && readonly
+		$(pwd) | local done x=1 --verbose 2>/dev/null echo "$@" | local
+		/usr/bin 'quoted text' printf local "$1" local -eu echo "$1" test printf
+awk 2>/dev/null export done ${HOME} "$@"
+	done && export 2>/dev/null "$1" export | ${HOME} printf
+	done -eu $(pwd) test x=1
+export cd "$@" awk export printf local /usr/bin "$1"
+	x=1 --verbose awk sed done | 'quoted text' export x=1 $(pwd) readonly printf /usr/bin
+	${HOME} readonly x=1 grep x=1 export
+		test 2>/dev/null sed ${HOME} 2>/dev/null grep
+		&& "$@" local grep ${HOME} 'quoted text' grep && ${HOME} grep echo ${HOME}
+	${HOME} test echo readonly --verbose cd && local -eu ${HOME}
+		"$@" cd | grep $(pwd) --verbose --verbose done test readonly
+'quoted text' local /usr/bin test | | 'quoted text' grep 'quoted text' $(pwd)
+	/usr/bin 2>/dev/null then 'quoted text' export sed echo echo local 2>/dev/null
+	done then "$@" 2>/dev/null
+	local printf sed $(pwd) -eu -eu sed awk 2>/dev/null 2>/dev/null
+	"$@" then local && printf local cd sed readonly
+test "$1" test -eu cd done awk grep done &&
+		cd grep local $(pwd) then -eu then cd | $(pwd) "$@" sed echo --verbose
+local 2>/dev/null | readonly "$1"
+	echo -eu "$1" && x=1 /usr/bin grep sed export "$1" | 'quoted text' readonly
+&& "$1" $(pwd) awk cd export 2>/dev/null 'quoted text'
+readonly 2>/dev/null export -eu awk cd cd echo 2>/dev/null
+cd readonly ${HOME} export $(pwd) printf printf done "$@" printf
+	2>/dev/null ${HOME} | done local
+-eu x=1 $(pwd) "$@" readonly 2>/dev/null 2>/dev/null
+	echo export local local "$1" awk x=1 ${HOME} grep readonly
+		done -eu | export ${HOME} sed "$@" "$@" done
+	test /usr/bin ${HOME} then then cd x=1 "$@" cd -eu "$@" && echo local
+	-eu awk awk ${HOME} && readonly sed && readonly && local ${HOME}
+		| readonly done done cd export 'quoted text' /usr/bin grep grep $(pwd)
+	grep then done local "$1" /usr/bin 'quoted text' echo
+$(pwd) x=1 cd awk 2>/dev/null export x=1 grep grep awk && then test
+	/usr/bin printf --verbose local printf 2>/dev/null x=1 export done echo
+&& export 2>/dev/null sed printf 'quoted text'
+		sed awk -eu /usr/bin
+"$@" "$@" awk echo "$1" 'quoted text' "$1" /usr/bin
+	local --verbose /usr/bin
+	"$@" grep "$@" && 'quoted text' awk then cd sed
+-eu printf 'quoted text' | /usr/bin --verbose 'quoted text' /usr/bin x=1
+		--verbose then --verbose "$1" awk 'quoted text' sed
+	/usr/bin "$1" then 2>/dev/null
+${HOME} x=1 then $(pwd) |
+	-eu x=1 printf test sed done
+sed cd $(pwd) echo sed "$@" sed 2>/dev/null grep grep -eu "$@"
+2>/dev/null printf local "$1" printf $(pwd) "$@" /usr/bin
+cd /usr/bin "$@" test grep done test | && && | "$1"
+${HOME} done 2>/dev/null test "$@" ${HOME} sed && ${HOME} readonly cd
+test && sed 2>/dev/null readonly echo --verbose grep done echo local
+then printf "$@" ${HOME} sed echo x=1 && ${HOME} echo grep
+	echo "$1" $(pwd) awk local awk local
+		| 2>/dev/null done | x=1
+	then echo done cd echo local
+	$(pwd) ${HOME} awk sed local then ${HOME} 2>/dev/null
+test export x=1 echo printf x=1 printf /usr/bin $(pwd) 2>/dev/null awk -eu |
+		awk local --verbose export "$@" export --verbose -eu | done grep | done
+	export /usr/bin test ${HOME}
+		&& grep local readonly echo grep
+sed cd --verbose --verbose --verbose
+		--verbose -eu "$1" 'quoted text' readonly then cd awk test done
+	| echo then printf readonly done cd cd printf local echo x=1 && 'quoted text'
+		test awk awk ${HOME} --verbose "$@"
+	test | printf local grep echo 'quoted text' printf readonly -eu test printf test
+test awk "$1" sed 'quoted text' --verbose "$1" export printf "$1"
+		x=1 echo x=1 $(pwd) | printf sed export
+	x=1 test cd "$@" "$1" 'quoted text' x=1 2>/dev/null
+		${HOME} x=1 then $(pwd) grep then --verbose ${HOME}
+	"$@" readonly x=1 then && x=1 sed "$1" --verbose
+	/usr/bin local test export then cd ${HOME} | sed readonly
+	-eu test readonly "$1" printf "$@" "$@" 2>/dev/null -eu printf sed | grep
+'quoted text' sed -eu done printf 'quoted text' "$1" echo
+	"$@" --verbose awk printf $(pwd) /usr/bin sed echo grep
+done local 2>/dev/null sed && readonly then -eu
+	export then awk "$1" sed local /usr/bin x=1 export then printf -eu
+	printf -eu && export done local test export | && echo printf 2>/dev/null --verbose
+	&& sed grep test 'quoted text' sed cd 'quoted text'
+'quoted text' grep | 'quoted text' ${HOME} export echo --verbose "$1" export done
+		"$1" done --verbose --verbose done 'quoted text'
+	x=1 done ${HOME} "$@" --verbose /usr/bin then 2>/dev/null --verbose awk sed grep
+2>/dev/null readonly test ${HOME} test echo sed --verbose
+		"$1" $(pwd) && done && awk readonly 'quoted text'
+	grep awk -eu $(pwd) && sed $(pwd) $(pwd) export echo && | 2>/dev/null
+	local local test "$@" | --verbose "$1" local
+		readonly /usr/bin "$1" echo $(pwd) sed x=1 printf --verbose
+export printf grep && then 2>/dev/null ${HOME} 'quoted text' readonly
+	/usr/bin $(pwd) x=1 "$1" && 2>/dev/null x=1 printf ${HOME} x=1 test $(pwd)
+		awk /usr/bin $(pwd) printf && awk printf sed local && local
+		printf && "$@" echo --verbose
+		x=1 | 2>/dev/null done
+	--verbose --verbose 'quoted text' 'quoted text' grep printf /usr/bin readonly x=1
+2>/dev/null local done -eu test "$@" && 2>/dev/null $(pwd) export
+		echo && test && 'quoted text' sed test local | "$1" local /usr/bin
+	--verbose | && /usr/bin $(pwd)
+		$(pwd) "$@" cd done /usr/bin
+	export "$@" then /usr/bin done | cd printf -eu local then awk grep 'quoted text'
+$(pwd) sed --verbose grep echo grep /usr/bin
+		/usr/bin done sed export awk grep x=1 local cd test
+test export local "$@" local test
+	echo -eu test grep $(pwd) grep 2>/dev/null
+	x=1 test ${HOME} printf export export -eu done
+		&& 2>/dev/null echo echo 'quoted text' sed ${HOME} local "$@"
+		${HOME} readonly /usr/bin sed && && readonly
+	| export "$@" awk echo "$@"
+| echo printf | printf printf grep "$1" grep printf done 2>/dev/null awk && then
+	export awk done sed -eu -eu
+-eu $(pwd) 'quoted text' -eu grep test --verbose
+	local echo readonly readonly x=1 awk readonly
+cd $(pwd) ${HOME} ${HOME} grep 2>/dev/null /usr/bin --verbose x=1 && done 2>/dev/null
+		printf echo test local "$1" "$1" "$1" ${HOME}
+export --verbose x=1 "$@" sed awk export test grep --verbose echo
+	'quoted text' && grep 'quoted text' echo ${HOME}
+	test | cd 2>/dev/null grep "$@" |
+	echo export local grep "$@"
+	done ${HOME} "$@" && awk 'quoted text'
+echo awk /usr/bin test
+&& done "$1" then 2>/dev/null
+then /usr/bin /usr/bin $(pwd)
+	awk cd echo grep x=1 x=1 sed
+	/usr/bin grep ${HOME} /usr/bin export done cd done | then cd x=1 local --verbose
+		'quoted text' 2>/dev/null awk done export -eu printf | export
+grep 2>/dev/null awk cd echo local "$1" 2>/dev/null echo awk 'quoted text' /usr/bin
+		&& $(pwd) test test "$@" --verbose |
+-eu && then 'quoted text' x=1 --verbose 2>/dev/null
+		done awk 2>/dev/null awk ${HOME} x=1 readonly awk 2>/dev/null grep ${HOME}
+	grep local ${HOME} x=1 x=1
+done printf cd echo sed &&
+	$(pwd) then "$1" local 2>/dev/null cd "$1" -eu --verbose grep done "$1"
+	then printf x=1 | grep test then local -eu printf | sed
+		$(pwd) sed echo 2>/dev/null x=1 "$1" printf 2>/dev/null $(pwd) export --verbose
+	--verbose test x=1 test |
+		$(pwd) "$1" $(pwd) --verbose awk local grep x=1 local
+-eu --verbose x=1 export cd echo readonly ${HOME} /usr/bin awk && ${HOME}
+x=1 $(pwd) grep --verbose sed readonly sed done 'quoted text' grep
+	test | 2>/dev/null grep done --verbose then grep grep echo local done echo /usr/bin
+		grep 2>/dev/null local cd -eu 2>/dev/null --verbose x=1 cd local
+		local sed test printf 'quoted text' "$@" test $(pwd) printf echo "$1" export
+awk test then test then grep | sed cd /usr/bin
+		"$@" && done "$@" "$@" "$1" && cd echo grep ${HOME} "$1"
+	grep local grep -eu ${HOME} -eu test "$@"
+	${HOME} awk grep && 'quoted text' "$1" then
+	sed then 'quoted text' "$1" done -eu awk 'quoted text'
+2>/dev/null cd x=1 | local -eu "$1" sed
+/usr/bin done readonly 'quoted text' printf 'quoted text' test -eu -eu echo "$1"
+		| 'quoted text' then readonly done printf local x=1 "$1" readonly
+grep cd --verbose cd "$@" --verbose /usr/bin "$@" local "$@" -eu done echo
+	&& -eu export printf x=1 x=1 'quoted text'
+then readonly done echo --verbose "$@" /usr/bin && test awk $(pwd)
+		"$1" readonly awk 2>/dev/null readonly test --verbose
+		| export local cd test | then x=1 done echo awk ${HOME} grep test ${HOME}
+		echo /usr/bin | cd done 'quoted text' awk -eu grep local
+	"$@" printf 'quoted text' readonly grep 2>/dev/null -eu sed ${HOME} 2>/dev/null
+local x=1 readonly $(pwd) cd grep -eu 'quoted text'
+"$1" sed test /usr/bin "$@" awk test "$@" ${HOME} | x=1 test "$@" done
+-eu test "$1" then && export | grep readonly
+		$(pwd) export sed done | printf awk 2>/dev/null x=1 local $(pwd) "$@"
+| "$1" then then done export test
+"$1" ${HOME} --verbose -eu 'quoted text' sed export grep cd
+	grep test "$1" "$1" /usr/bin printf printf readonly
+		"$@" "$@" readonly then "$1" "$@" test sed then
+		test && awk 'quoted text' grep
+	"$@" /usr/bin "$@" x=1 | cd /usr/bin 'quoted text'
+		$(pwd) 2>/dev/null "$@"
+sed echo "$@" readonly readonly echo awk /usr/bin
+		sed | 'quoted text' --verbose then export grep printf --verbose "$1" then
+		awk printf --verbose readonly awk echo /usr/bin cd cd 2>/dev/null
+	&& -eu local -eu 'quoted text' x=1 "$1" then ${HOME} -eu done -eu
+	readonly ${HOME} && readonly awk grep --verbose cd && printf --verbose
+		2>/dev/null export awk grep grep 'quoted text'
+test test 'quoted text' export done ${HOME} echo x=1 export "$@" export
+	| $(pwd) | 2>/dev/null
+	grep x=1 sed awk 'quoted text' /usr/bin sed && local export
+		2>/dev/null 2>/dev/null &&
+done grep grep test --verbose
+-eu test 'quoted text' $(pwd) then export cd printf
+-eu | && local cd printf --verbose
+$(pwd) local /usr/bin printf -eu && /usr/bin cd sed cd 'quoted text' awk readonly
+'quoted text' ${HOME} done x=1 echo --verbose test
+	export then grep "$@" cd sed
+	2>/dev/null then ${HOME} "$1" 'quoted text' x=1 echo /usr/bin | "$@"
+		$(pwd) && done | 2>/dev/null grep awk && awk grep "$@" "$@"
+	local 2>/dev/null --verbose | x=1 local
+	awk --verbose ${HOME} 'quoted text'
+grep x=1 x=1 then 2>/dev/null -eu 2>/dev/null echo then ${HOME} cd export
+| --verbose readonly test
+x=1 printf "$1" --verbose --verbose sed "$1" sed done -eu
+/usr/bin "$@" | | sed | "$1" printf done test | awk x=1 readonly then done 2>/dev/null
+		-eu $(pwd) --verbose test x=1 cd cd test $(pwd) $(pwd) /usr/bin local
+		$(pwd) cd awk cd --verbose awk | &&
+export | local then test -eu then echo "$1"
+sed echo "$@" 2>/dev/null && then readonly echo done printf done grep test export
+		| 'quoted text' x=1 |
+	| printf local ${HOME} readonly export
+		--verbose test readonly done | then
+		sed ${HOME} x=1 grep x=1 readonly | then | 'quoted text' /usr/bin local grep
+sed x=1 2>/dev/null 2>/dev/null $(pwd) then --verbose | /usr/bin
+		'quoted text' test export --verbose awk 2>/dev/null x=1 ${HOME}
+	done /usr/bin | "$1" x=1 && printf
+	printf "$1" echo $(pwd)
+echo done printf -eu ${HOME} test grep grep --verbose done
+		2>/dev/null sed done "$1" grep export && then done cd
+sed 'quoted text' 2>/dev/null x=1 awk local
+	cd $(pwd) x=1 'quoted text' local 'quoted text' --verbose echo sed -eu readonly
+		local done 'quoted text' "$1" 2>/dev/null $(pwd) $(pwd) /usr/bin
+	awk sed cd echo ${HOME} && done 2>/dev/null "$@" readonly --verbose "$@" export
+		/usr/bin local -eu |
+"$1" /usr/bin sed done $(pwd) $(pwd) export local x=1 2>/dev/null
+	$(pwd) x=1 $(pwd) test
+then /usr/bin local -eu grep --verbose --verbose
+&& cd export done cd printf test -eu x=1 then local "$1" then 'quoted text'
+		"$@" cd ${HOME} ${HOME} && | export
+test grep "$@" x=1 "$1" /usr/bin
+grep $(pwd) /usr/bin "$@" "$1"
+${HOME} test printf sed --verbose
+		--verbose printf x=1 --verbose readonly printf
+export x=1 awk "$@" "$1" readonly
+		$(pwd) then awk "$1" 2>/dev/null printf && -eu ${HOME} readonly
+		awk printf /usr/bin --verbose 'quoted text'
+$(pwd) test export && && /usr/bin test x=1
+		--verbose sed && | printf echo 2>/dev/null
+	local grep cd export /usr/bin export done export test echo x=1 echo |
+		/usr/bin export local x=1 ${HOME}
+awk $(pwd) 'quoted text' local readonly
+&& export sed done /usr/bin --verbose test export test cd export
+test -eu printf printf "$@" cd export "$1" printf cd x=1 export
+	cd && "$1" /usr/bin sed export sed x=1 test /usr/bin printf
+	export readonly 2>/dev/null -eu "$1" x=1 "$1" grep done then | sed local
+	-eu readonly 'quoted text' --verbose
+		done 'quoted text' x=1 "$1" 2>/dev/null "$@" --verbose ${HOME}
+		$(pwd) /usr/bin -eu local ${HOME} $(pwd)
+	--verbose then -eu /usr/bin export 'quoted text'
+	sed && local cd "$1" -eu grep local then
+	cd awk then then -eu $(pwd) x=1 'quoted text' x=1 cd export
+readonly done && "$@" 2>/dev/null
+"$1" printf -eu "$1" 'quoted text' test $(pwd)
+		--verbose /usr/bin cd /usr/bin done cd | printf readonly
+	local ${HOME} -eu done export | printf && printf
+	then ${HOME} ${HOME} done echo /usr/bin sed local export
+		$(pwd) ${HOME} $(pwd) x=1 -eu 'quoted text' grep $(pwd) awk printf
+	test --verbose /usr/bin echo awk echo ${HOME} echo x=1 'quoted text' "$1" -eu
+		x=1 local printf test
+${HOME} sed echo $(pwd)
+&& 'quoted text' sed ${HOME} && ${HOME} $(pwd) --verbose done $(pwd) echo cd
+echo $(pwd) "$@" then && done /usr/bin
+done x=1 2>/dev/null 'quoted text'
+&& | "$1" $(pwd) readonly printf local "$1" --verbose /usr/bin $(pwd) /usr/bin
+	sed | printf | export printf export readonly --verbose /usr/bin "$1" /usr/bin
+export cd ${HOME} printf 'quoted text'
+then readonly grep 2>/dev/null cd readonly && cd x=1 cd sed sed done 2>/dev/null
+echo then test x=1 done local -eu export done local test | echo printf done
+		-eu ${HOME} test local grep printf done grep done done printf done
+	done sed --verbose printf echo cd 'quoted text'
+	&& "$1" awk then test local x=1 test && 2>/dev/null "$1" readonly
+	x=1 then sed then echo
+--verbose x=1 local sed awk test readonly test export
+	local $(pwd) $(pwd) x=1 "$1" printf export local $(pwd) readonly "$1" cd 2>/dev/null
+	$(pwd) && then local awk awk export test --verbose printf
+${HOME} grep local "$@" $(pwd) | then --verbose cd grep
+		&& awk /usr/bin sed && 2>/dev/null && x=1 test "$@" 'quoted text'
+	grep $(pwd) sed && "$@" $(pwd) printf
+		/usr/bin /usr/bin 2>/dev/null 2>/dev/null
+	--verbose printf "$@" $(pwd) 2>/dev/null sed awk then local cd
+grep --verbose grep grep
+	readonly awk "$1" 'quoted text' && "$1" "$@" && "$@" "$1" $(pwd)
+done "$1" printf echo done | /usr/bin "$1"
+		2>/dev/null local /usr/bin export ${HOME} grep test $(pwd) test --verbose
+| | -eu 'quoted text' 2>/dev/null 'quoted text'
+	"$@" then ${HOME} x=1 export /usr/bin 'quoted text'
+awk 'quoted text' | cd then awk -eu x=1 $(pwd) 'quoted text' done "$@"
+	"$1" grep --verbose grep grep echo cd 2>/dev/null printf grep --verbose sed
+		grep local && /usr/bin done | awk export export 2>/dev/null
+grep && then echo export local && "$@" ${HOME} cd | done sed export 'quoted text'
+		${HOME} readonly awk 'quoted text'
+printf test echo 2>/dev/null "$@" printf | done test --verbose
+		x=1 | $(pwd) /usr/bin then
+	${HOME} then done 2>/dev/null | then "$@" "$@" "$@" cd grep echo | done test
+	done sed x=1 --verbose ${HOME}
+'quoted text' cd cd "$@" grep printf "$@"
+	awk then | printf then -eu then awk "$@" --verbose
+/usr/bin $(pwd) export 2>/dev/null sed sed readonly
+printf then grep 'quoted text' then readonly readonly $(pwd) readonly printf
+		"$1" done --verbose x=1 --verbose 2>/dev/null done "$@" done sed 2>/dev/null
+printf readonly $(pwd) ${HOME} echo -eu 2>/dev/null awk x=1 sed 2>/dev/null "$@"
+export printf awk export
+		test && echo then grep export x=1 awk -eu /usr/bin export && printf
+	${HOME} $(pwd) then readonly done 2>/dev/null ${HOME}
+readonly "$@" | printf 'quoted text' awk local sed then printf -eu done $(pwd)
+	"$1" && local local sed
+	2>/dev/null readonly | done && readonly -eu sed $(pwd)
+	&& --verbose local /usr/bin x=1 -eu
+	done /usr/bin && && export readonly
+		readonly echo then cd | x=1 'quoted text' 'quoted text'
+	cd grep sed | --verbose $(pwd) printf | --verbose awk 'quoted text' grep export
+	&& then --verbose printf "$1" 'quoted text' sed local done
+then 'quoted text' --verbose awk "$@" x=1 'quoted text'
+"$1" sed --verbose grep --verbose 2>/dev/null
+		echo x=1 ${HOME} sed $(pwd) 2>/dev/null
+		then local x=1 cd test cd grep "$@" --verbose "$1"
+export sed "$1" sed export sed printf awk printf done
+	echo x=1 "$1" printf printf export $(pwd) done test awk awk 2>/dev/null
+"$@" echo && readonly && sed ${HOME} 2>/dev/null readonly ${HOME} readonly
+		&& "$@" readonly readonly 2>/dev/null /usr/bin "$1" awk grep export done readonly
+cd /usr/bin printf "$@" then printf done --verbose "$1" test sed
+		readonly $(pwd) "$@" then "$1" done readonly awk printf
+readonly echo printf done local
+	x=1 $(pwd) cd 'quoted text' -eu x=1 awk grep local sed "$@" done cd
+	| sed grep sed "$1" printf readonly --verbose ${HOME}
+	awk local done cd readonly x=1 2>/dev/null "$@" printf done && then && local
+done x=1 2>/dev/null $(pwd) 'quoted text' | grep cd 'quoted text' sed
+	"$@" "$@" printf $(pwd) ${HOME} $(pwd)
+	readonly grep test echo readonly printf
+		readonly 'quoted text' 2>/dev/null
+	${HOME} "$1" "$1" export 2>/dev/null export
+		-eu | grep cd printf ${HOME} cd grep sed readonly ${HOME} 2>/dev/null "$@"
+	'quoted text' readonly then awk cd | sed export then readonly
+x=1 && -eu cd local local sed "$1" local x=1 test test local done sed grep &&
+2>/dev/null "$@" then x=1 ${HOME}
+		echo --verbose -eu local test cd printf cd
+	--verbose readonly echo "$@" ${HOME} /usr/bin readonly done awk 'quoted text'
+		awk x=1 'quoted text' "$1" ${HOME} export -eu -eu done awk
+"$1" test echo 2>/dev/null readonly | done --verbose
+		2>/dev/null test ${HOME} grep "$@" --verbose --verbose sed x=1 -eu
+	-eu /usr/bin | $(pwd) | /usr/bin awk sed ${HOME} "$1" "$1" test 2>/dev/null
+		/usr/bin local $(pwd) 2>/dev/null -eu export "$@"
+	test "$@" && "$@" printf test && /usr/bin 2>/dev/null printf 'quoted text' then
+	${HOME} cd done 'quoted text' /usr/bin echo ${HOME} sed printf
+cd done echo 2>/dev/null test readonly
+		test sed x=1 export echo then local grep -eu "$1" awk test $(pwd)
+	${HOME} "$1" awk sed "$@" awk 'quoted text' cd printf x=1 ${HOME}
+		done echo /usr/bin sed -eu readonly 2>/dev/null $(pwd) sed
+		printf grep x=1 "$1" -eu then awk cd export "$@" readonly export $(pwd) printf
+grep x=1 test && --verbose
+	$(pwd) printf /usr/bin printf --verbose awk readonly
+${HOME} printf 2>/dev/null test 'quoted text'
+		sed awk && sed --verbose x=1 grep cd sed && local
+"$@" --verbose test done "$@" "$@" ${HOME} 2>/dev/null --verbose readonly readonly
+test awk 'quoted text' local printf
+		local "$1" /usr/bin "$@" 2>/dev/null printf "$@" /usr/bin | done
+${HOME} done $(pwd) -eu "$@" --verbose grep $(pwd)
+	2>/dev/null done sed local
+		/usr/bin | x=1 sed grep then 2>/dev/null -eu | test ${HOME} 2>/dev/null export
+		awk "$@" readonly | "$@"
+		then local && test x=1 "$1" --verbose cd ${HOME} $(pwd) cd "$1" && done 'quoted text'
+	then $(pwd) awk grep grep cd 2>/dev/null && export "$1"
+		cd grep x=1 echo | /usr/bin test $(pwd)
+"$1" sed --verbose "$1" /usr/bin cd "$@" cd "$@" then "$1" 2>/dev/null
+	$(pwd) test sed sed ${HOME} readonly cd $(pwd)
+awk then cd x=1 sed $(pwd)
+/usr/bin done done cd awk test 'quoted text'
+		then then -eu then $(pwd) /usr/bin echo x=1 cd x=1 then grep ${HOME} sed
+		echo | grep "$1" awk "$@"
+		done readonly -eu x=1 && cd printf | "$@"
+		printf | --verbose awk ${HOME} export printf /usr/bin 2>/dev/null
+		'quoted text' test x=1 printf export --verbose
+	"$1" /usr/bin local test --verbose
+		grep && "$@" -eu grep && 2>/dev/null $(pwd) local grep export
+$(pwd) grep echo "$@" echo $(pwd)
+	$(pwd) 2>/dev/null "$1" echo ${HOME}
+	| && awk -eu test "$1" -eu 'quoted text' printf cd sed ${HOME}
+"$@" then "$1" cd local x=1
+	/usr/bin "$1" printf sed "$@" done export
+cd ${HOME} $(pwd) printf done 2>/dev/null /usr/bin cd echo echo "$@" -eu x=1
+		cd echo echo then x=1 then test echo | local "$1" sed local local $(pwd)
+then /usr/bin done ${HOME}
+	then local grep test 'quoted text' echo /usr/bin
+		-eu echo "$@" $(pwd) readonly
+		done "$1" done -eu local sed then grep -eu /usr/bin export readonly "$@"
+		-eu printf ${HOME} local $(pwd)
+	export | printf printf "$@" x=1 | | local "$1" "$@" && 'quoted text' cd
+test 2>/dev/null done local grep done 2>/dev/null ${HOME}
+		--verbose "$@" 'quoted text' "$@" grep "$1" done cd ${HOME} readonly local cd
+		/usr/bin test printf
+		awk then x=1 done local --verbose export
+		test cd 'quoted text' --verbose && done then 2>/dev/null awk then /usr/bin cd ${HOME}
+		&& cd then && awk awk "$1" grep export cd | x=1 && echo test x=1 /usr/bin
+		local awk export && echo ${HOME} test x=1 printf /usr/bin /usr/bin 2>/dev/null
+		"$@" --verbose local -eu x=1 "$@" /usr/bin local
+"$1" printf ${HOME} -eu test cd $(pwd)
+/usr/bin $(pwd) | --verbose /usr/bin cd grep echo x=1 awk
+	/usr/bin echo readonly
+printf grep ${HOME} "$1" -eu done ${HOME} printf printf local
+		printf ${HOME} --verbose local 2>/dev/null "$@" 2>/dev/null && ${HOME} ${HOME}
+printf 'quoted text' printf
+done "$@" 'quoted text' x=1 $(pwd) done awk "$1" cd local
+/usr/bin | 'quoted text' local printf then done
+awk awk /usr/bin done sed && /usr/bin ${HOME} done 'quoted text' "$@" $(pwd)
+	grep x=1 grep /usr/bin 2>/dev/null then cd --verbose /usr/bin local "$@" -eu grep
+	${HOME} -eu "$1" awk "$1" grep --verbose
+&& "$1" -eu --verbose && then "$1" "$1"
+2>/dev/null "$@" $(pwd) x=1 export "$@" && then -eu
+		cd | 'quoted text' 'quoted text' export /usr/bin echo
+--verbose grep done local
+cd export then cd $(pwd) cd ${HOME} grep export "$@" 'quoted text' echo then sed
+	grep "$1" readonly local 2>/dev/null
+&& $(pwd) 2>/dev/null "$@" $(pwd)
+		--verbose && "$1" | x=1 cd sed awk | test
+	cd && printf done 'quoted text' done echo local printf
+		awk ${HOME} && test sed printf ${HOME} -eu sed done 'quoted text' ${HOME}
+	2>/dev/null printf $(pwd)
+	done $(pwd) "$@" "$1" test "$@" 'quoted text' sed && "$1" --verbose
+grep /usr/bin local done echo done -eu done readonly x=1 echo && test
+	cd printf local test 2>/dev/null
+	2>/dev/null sed local --verbose grep export
+&& cd && "$1" readonly 'quoted text'
+		echo echo grep cd local --verbose local sed "$@" printf local local $(pwd) 'quoted text'
+	export | ${HOME} && "$@" printf then x=1 "$1" echo grep readonly
+	sed export then echo printf done
+	-eu echo local echo cd x=1 done echo | x=1 then 2>/dev/null awk echo export local
+		local 2>/dev/null "$1" sed ${HOME} cd "$@" then | awk local local
+	cd awk | cd 'quoted text' test ${HOME} grep --verbose local x=1 "$@" $(pwd)
+		/usr/bin -eu --verbose ${HOME} then awk 2>/dev/null awk
+$(pwd) x=1 2>/dev/null "$1" -eu readonly | && readonly
+	readonly cd grep ${HOME} then -eu -eu sed "$1" grep -eu grep
+	'quoted text' done x=1 $(pwd) test test 2>/dev/null export
+	sed printf ${HOME} /usr/bin x=1 /usr/bin cd grep printf readonly cd "$1" cd 'quoted text'
+	readonly $(pwd) /usr/bin && done && echo printf /usr/bin
+	printf export sed export --verbose
+export echo && grep 2>/dev/null
+		--verbose export test sed
+	--verbose $(pwd) -eu awk then echo 2>/dev/null echo /usr/bin
+	-eu $(pwd) local $(pwd) export --verbose
+	--verbose printf /usr/bin local 2>/dev/null ${HOME} cd x=1 readonly grep
+		cd "$@" sed export local sed "$1" $(pwd) $(pwd) -eu && -eu
+	/usr/bin sed "$1" x=1 printf ${HOME}
+	export 2>/dev/null 2>/dev/null
+		awk printf grep awk export "$1" x=1 ${HOME} --verbose "$1" x=1 printf --verbose
+	done /usr/bin test cd export then local --verbose
+cd x=1 -eu 'quoted text' x=1 awk 'quoted text'
+	grep && | /usr/bin cd --verbose --verbose 'quoted text' ${HOME} | export 'quoted text'
+| x=1 "$1" ${HOME} readonly -eu | printf
+	"$@" readonly $(pwd) grep local echo $(pwd) x=1 export ${HOME} 2>/dev/null
+	"$1" | test printf -eu "$@" ${HOME}
+	export -eu x=1 awk && done readonly "$@" ${HOME} export
+		--verbose 'quoted text' done 'quoted text' echo "$1"
+		-eu && local -eu "$1" printf then local "$@" then
+	cd "$@" $(pwd) | then test printf x=1 'quoted text'
+sed /usr/bin | echo echo local $(pwd) readonly
+&& cd /usr/bin local -eu /usr/bin
+"$@" /usr/bin grep awk printf 2>/dev/null x=1 -eu --verbose ${HOME}
+		&& export echo "$@" --verbose awk
+		sed "$1" grep "$1" awk 'quoted text' local -eu
+echo ${HOME} then done "$@" && "$@" cd echo local x=1 printf
+$(pwd) /usr/bin then | 2>/dev/null sed x=1 done ${HOME} grep readonly echo
+		--verbose /usr/bin readonly -eu then $(pwd)
+sed printf grep 'quoted text' grep awk test export |
+		readonly then ${HOME} ${HOME} | printf grep
+done cd export sed ${HOME} done 'quoted text' test $(pwd) x=1 --verbose 2>/dev/null
+	readonly awk printf echo 2>/dev/null awk echo "$1"
+	2>/dev/null cd printf echo cd test --verbose
+	'quoted text' grep 2>/dev/null | cd
+awk | export | sed x=1 x=1
+		&& done | ${HOME} echo "$1" done done test then grep grep "$@" "$@" ${HOME} --verbose
+	printf sed 2>/dev/null readonly
+		'quoted text' --verbose --verbose -eu && grep /usr/bin then sed readonly 'quoted text'
+	&& grep ${HOME} 2>/dev/null ${HOME}
+		${HOME} /usr/bin -eu 'quoted text' done cd "$@" test sed /usr/bin
+printf x=1 ${HOME} grep grep "$1" done 'quoted text' echo export done done echo
+	readonly test && "$@" readonly | export &&
+		local sed "$1" | --verbose done
+	then test local done then "$1" 'quoted text' && 'quoted text' echo
+	awk 2>/dev/null local $(pwd) test
+| test echo awk done | echo test
+	local local /usr/bin cd printf -eu "$@" | readonly && && |
+	/usr/bin "$@" printf 2>/dev/null
+	/usr/bin 'quoted text' done "$@" && "$@" echo
+	done -eu "$@" -eu sed "$@" sed printf readonly done then "$@"
+/usr/bin && && done echo then local export
+then cd awk 'quoted text'
+cd sed cd ${HOME} 'quoted text' export grep "$1" $(pwd) ${HOME}
+		grep awk export && sed "$1" 'quoted text' echo $(pwd)
+		cd /usr/bin printf echo export local && test awk
+	$(pwd) -eu done "$@" then cd -eu local
+		sed echo export /usr/bin echo "$@" &&
+		--verbose readonly then grep awk x=1 test done readonly ${HOME} done sed --verbose
+		$(pwd) -eu test then local --verbose export $(pwd) then export && printf 2>/dev/null
+cd | "$@" done cd && echo then ${HOME} sed test $(pwd) | test "$1" $(pwd) cd ${HOME}
+'quoted text' -eu -eu awk printf grep "$1" /usr/bin
+		x=1 | awk printf printf x=1 readonly --verbose then | "$1" export "$@" "$1"
+		-eu ${HOME} awk 2>/dev/null readonly printf readonly 2>/dev/null then local sed
+		grep 'quoted text' export --verbose "$@" | readonly
+		/usr/bin ${HOME} cd readonly local done done && && cd done
+		grep printf "$1" /usr/bin echo
+grep test awk && then then awk | test then grep then "$1" -eu then "$1" 'quoted text'
+&& then then $(pwd) then readonly sed local test x=1 "$1" readonly local
+		&& 'quoted text' x=1
+		"$@" $(pwd) /usr/bin readonly cd awk | "$1" "$@" cd -eu /usr/bin test
+	cd grep awk && export test | x=1 --verbose sed "$1" 2>/dev/null awk && cd awk echo
+		x=1 awk --verbose | 2>/dev/null
+	${HOME} "$@" grep test ${HOME} 2>/dev/null then /usr/bin local && "$1"
+	2>/dev/null --verbose local readonly echo test printf then grep sed then done
+	then printf $(pwd) printf 'quoted text' cd 2>/dev/null
+		done echo "$@" done "$@"
+	"$1" echo x=1 grep ${HOME} -eu readonly readonly 2>/dev/null
+echo readonly "$@" sed x=1 then x=1 2>/dev/null readonly 'quoted text' readonly
+	--verbose 'quoted text' readonly $(pwd)
+awk grep echo test 2>/dev/null "$1" readonly test cd /usr/bin
+test awk -eu $(pwd) test sed "$1" readonly x=1 cd $(pwd) test grep 2>/dev/null
+		x=1 done -eu readonly
+	x=1 then -eu x=1 x=1 && cd | -eu /usr/bin $(pwd) /usr/bin 2>/dev/null x=1
+		awk 2>/dev/null /usr/bin "$1" $(pwd) awk && "$1" done 'quoted text'
+echo cd readonly ${HOME} local --verbose
+		2>/dev/null done local test
+awk 2>/dev/null "$@" /usr/bin local
+		echo cd $(pwd) 'quoted text'
+awk echo ${HOME} && && --verbose done 2>/dev/null then "$1" "$@" /usr/bin
+'quoted text' ${HOME} 2>/dev/null awk $(pwd) readonly readonly x=1 -eu
+		"$1" $(pwd) 2>/dev/null echo
+	$(pwd) /usr/bin /usr/bin
+-eu echo sed test && "$@" sed
+		local sed test ${HOME} then 'quoted text' | done printf && done local 'quoted text'
+	x=1 -eu done done cd grep printf | 'quoted text'
+		'quoted text' --verbose --verbose then awk "$@" printf x=1
+		"$1" echo local 'quoted text' local local sed -eu -eu echo readonly test done grep
+		then echo local sed echo ${HOME} echo
+printf && printf export && echo then ${HOME} local local sed export | ${HOME}
+		readonly && 'quoted text' sed awk then printf && test /usr/bin echo "$@"
+--verbose awk echo done /usr/bin
+	/usr/bin local "$1" awk cd echo /usr/bin $(pwd)
+		2>/dev/null 'quoted text' 2>/dev/null 2>/dev/null awk | done readonly
+grep ${HOME} echo grep export 2>/dev/null $(pwd) 'quoted text'
+		awk awk $(pwd) echo local test awk ${HOME} readonly && export
+	$(pwd) awk --verbose 'quoted text' "$1" 'quoted text'
+	"$@" -eu done readonly &&
+readonly /usr/bin 'quoted text' -eu test cd export sed "$@" cd "$1" done sed
+		x=1 test --verbose echo x=1 grep awk /usr/bin sed "$1" $(pwd) ${HOME} /usr/bin
+awk 2>/dev/null x=1 --verbose $(pwd) printf
+local -eu test ${HOME} /usr/bin
+		${HOME} --verbose && /usr/bin sed export ${HOME}
+		2>/dev/null sed --verbose echo readonly printf export printf
+		echo cd && $(pwd) -eu sed 'quoted text' test
+		| && x=1 awk printf "$@" sed awk awk 'quoted text' "$1"
+	-eu | 2>/dev/null local sed $(pwd) 2>/dev/null
+		"$@" printf ${HOME} "$@" echo printf readonly /usr/bin "$1" --verbose export
+		sed ${HOME} && | local x=1 2>/dev/null $(pwd) ${HOME}
+	echo $(pwd) --verbose x=1
+echo && /usr/bin export && --verbose then 2>/dev/null
+	printf readonly 'quoted text' then sed ${HOME} "$1" $(pwd) sed done
+export awk --verbose $(pwd) sed "$@"
+		awk "$@" done sed /usr/bin
+--verbose "$1" 2>/dev/null awk "$1"
+done test cd awk printf "$@" done sed grep printf /usr/bin --verbose "$@" printf
+		grep local printf export cd echo then -eu awk cd export sed 2>/dev/null
+&& && -eu test done "$@" then grep
+| 'quoted text' test export printf $(pwd) echo sed cd x=1 ${HOME} && done
+--verbose cd 'quoted text' awk x=1 x=1 -eu cd 'quoted text' export &&
+		echo export x=1 -eu awk local "$1" 'quoted text' printf
+--verbose && printf "$@" sed 2>/dev/null
+	--verbose /usr/bin sed grep cd $(pwd) &&
+		'quoted text' "$1" cd local echo cd test -eu -eu "$@"
+	x=1 test -eu sed echo | then && export then
+	awk done -eu 2>/dev/null local --verbose printf x=1 $(pwd)
+		awk cd then readonly |
+"$1" test sed -eu x=1 done sed sed "$1" awk /usr/bin
+		local /usr/bin cd local grep done grep grep readonly printf
+	echo echo local then "$1" then -eu local sed "$@"
+x=1 'quoted text' ${HOME} --verbose
+	test awk echo 2>/dev/null 'quoted text' 'quoted text' awk /usr/bin
+-eu awk export test /usr/bin $(pwd)
+	printf x=1 ${HOME} ${HOME} -eu grep local readonly
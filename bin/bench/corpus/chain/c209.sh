@@ -0,0 +1,2001 @@
+	${HOME} echo /usr/bin "$@" "$@" export
+	then export | && --verbose sed $(pwd)
+printf echo then awk ${HOME} "$@" -eu grep x=1 export cd "$@" echo awk readonly
+	'quoted text' local local grep local "$@"
+/usr/bin grep ${HOME} export 'quoted text' 2>/dev/null printf local readonly
+		local /usr/bin x=1 2>/dev/null 'quoted text' "$1" | printf --verbose --verbose
+		${HOME} | "$1" then ${HOME} 2>/dev/null
+		sed $(pwd) x=1 "$1" x=1 awk printf cd done x=1 x=1 "$@"
+awk 'quoted text' --verbose awk cd echo
+		/usr/bin readonly --verbose --verbose done $(pwd)
+	test awk readonly "$1" grep 'quoted text' test ${HOME} done
+	readonly then awk /usr/bin test
+2>/dev/null cd printf printf && x=1 then 'quoted text' done test sed done /usr/bin
+	| ${HOME} cd | cd 'quoted text' cd printf sed echo "$@" 2>/dev/null |
+"$@" /usr/bin "$1" /usr/bin "$@" cd test readonly readonly && ${HOME}
+		done then export printf ${HOME}
+x=1 cd x=1 sed sed printf && 2>/dev/null 2>/dev/null
+2>/dev/null cd awk awk
+export test --verbose cd x=1 local 'quoted text' done grep readonly 'quoted text'
+		/usr/bin --verbose ${HOME} readonly
+	"$@" test then grep awk $(pwd) done printf
+		${HOME} awk local sed echo -eu && grep printf
+	--verbose test sed echo | printf 'quoted text' cd export local "$1"
+		done 2>/dev/null $(pwd) ${HOME} x=1 'quoted text' $(pwd) printf "$1" 2>/dev/null
+		/usr/bin local grep test && local "$@" 'quoted text' 2>/dev/null 'quoted text'
+	/usr/bin grep /usr/bin awk ${HOME} grep echo x=1 -eu -eu "$@" "$@" awk sed test
+cd test -eu && x=1 | awk sed sed -eu "$@" | ${HOME}
+		"$@" $(pwd) cd echo --verbose /usr/bin
+"$1" "$@" /usr/bin test ${HOME} ${HOME} grep | x=1 -eu ${HOME} | printf cd --verbose
+	--verbose "$1" then $(pwd) readonly then && "$1" export x=1 && | 'quoted text'
+		cd 2>/dev/null sed && then local
+	${HOME} export local printf local echo echo && 'quoted text' && &&
+	done -eu sed then local
+	"$@" test 2>/dev/null printf readonly "$1" local sed x=1 x=1 ${HOME} printf
+		then done && readonly $(pwd) x=1 && -eu local cd then echo
+	-eu 2>/dev/null awk local ${HOME} -eu sed -eu
+echo readonly local done -eu | done awk "$@"
+	local | "$1" ${HOME} ${HOME} then 2>/dev/null 2>/dev/null done
+awk done echo awk "$1" ${HOME} awk local "$@" 2>/dev/null
+	/usr/bin "$1" export done ${HOME} printf
+${HOME} /usr/bin test grep sed /usr/bin 2>/dev/null then | echo then 'quoted text'
+"$@" readonly export ${HOME} awk readonly then cd $(pwd) printf | && grep
+/usr/bin 2>/dev/null export && | awk | grep 2>/dev/null
+		export --verbose readonly echo awk
+	/usr/bin "$@" 'quoted text'
+-eu && done export --verbose export "$@" /usr/bin "$1" awk echo then 'quoted text'
+		-eu then && "$1" then
+'quoted text' -eu 'quoted text' ${HOME} export 2>/dev/null echo && awk
+		local grep /usr/bin "$@" done /usr/bin
+		| 'quoted text' /usr/bin readonly printf then
+	-eu then cd | && readonly then echo printf ${HOME}
+	readonly "$@" 2>/dev/null
+/usr/bin local "$@" awk local ${HOME} 2>/dev/null | then cd test then cd printf
+${HOME} x=1 && | done
+test sed echo | --verbose local grep ${HOME} $(pwd)
+	&& then test ${HOME} sed
+	'quoted text' "$1" then | cd x=1 -eu sed local x=1 then "$1" -eu && printf
+		cd export "$1" export readonly done sed sed readonly export awk
+test echo echo echo | -eu 2>/dev/null
+	local local && echo $(pwd) local ${HOME} "$@" && -eu export grep test echo
+/usr/bin sed "$1" then --verbose sed $(pwd) echo $(pwd) "$1" printf
+test test sed $(pwd) grep echo "$@" --verbose ${HOME}
+		"$@" echo readonly $(pwd) 2>/dev/null
+	export then echo done sed grep /usr/bin
+echo ${HOME} readonly cd
+		echo readonly done ${HOME} 'quoted text' $(pwd)
+	awk awk awk $(pwd) test sed printf export test /usr/bin readonly
+		--verbose echo test ${HOME} grep done local x=1 export cd "$1" awk
+		cd 'quoted text' done local then local export test printf x=1 -eu 'quoted text'
+	done grep "$1" x=1 export x=1 "$1" grep printf | /usr/bin x=1 "$1" "$@"
+	"$1" cd sed && export printf sed x=1 -eu awk 2>/dev/null $(pwd) -eu sed "$@"
+	sed 2>/dev/null awk "$@" "$@" --verbose x=1 done
+	readonly export grep --verbose local sed ${HOME} printf local 'quoted text'
+	test test x=1 then export $(pwd) grep 'quoted text'
+'quoted text' done sed export printf
+'quoted text' grep awk /usr/bin 'quoted text'
+then ${HOME} && test cd printf "$@" test "$1" 'quoted text'
+		awk /usr/bin cd readonly && printf 'quoted text' sed
+| "$1" x=1 /usr/bin awk ${HOME} x=1 export $(pwd) sed test "$1" cd
+		done readonly export done done 'quoted text'
+		then && sed export awk awk /usr/bin test test
+		readonly test ${HOME}
+		then printf grep local printf "$@" then 'quoted text' "$@" && echo
+		printf x=1 -eu 2>/dev/null readonly --verbose
+		awk -eu /usr/bin 2>/dev/null && ${HOME} test echo $(pwd) /usr/bin
+'quoted text' readonly readonly 2>/dev/null ${HOME} sed readonly
+		'quoted text' export $(pwd) ${HOME}
+local cd done 'quoted text' /usr/bin x=1 then x=1 ${HOME}
+	'quoted text' test printf awk
+		then local /usr/bin 'quoted text' | | "$1" test printf
+		'quoted text' sed done test echo printf && done /usr/bin $(pwd) test export
+	printf then cd -eu export 'quoted text' sed awk sed --verbose echo ${HOME}
+		readonly ${HOME} export x=1 awk -eu
+	export $(pwd) echo echo && && awk "$1" sed "$@" $(pwd) export
+		test "$1" | local "$@" sed "$1" /usr/bin --verbose $(pwd) sed "$1" -eu
+export 'quoted text' --verbose /usr/bin --verbose 'quoted text' "$1"
+"$@" then && --verbose x=1 awk "$1" test x=1 sed ${HOME} local ${HOME} grep
+		readonly /usr/bin && readonly awk
+	${HOME} test sed awk ${HOME} x=1 "$@" cd then 2>/dev/null local 2>/dev/null
+	done ${HOME} export | awk -eu -eu export done readonly local local
+done -eu && "$@" "$1" -eu x=1 echo "$1" /usr/bin 'quoted text'
+-eu printf then --verbose done local readonly
+	printf echo printf cd echo "$1"
+	&& test && then grep -eu 'quoted text' cd cd /usr/bin
+		done grep | /usr/bin readonly /usr/bin && "$@" test "$1" readonly
+	sed local sed ${HOME} then -eu 'quoted text' ${HOME}
+	${HOME} | x=1 ${HOME} "$@" printf awk grep && $(pwd) grep sed -eu awk then test
+		-eu grep /usr/bin $(pwd) sed "$@" x=1 'quoted text' test printf
+--verbose 2>/dev/null test grep -eu then x=1 --verbose | &&
+	${HOME} local && echo readonly | | printf sed
+		-eu grep sed "$@" grep "$@" printf
+		local --verbose echo test 'quoted text' readonly x=1 $(pwd) printf
+${HOME} printf done echo awk && | /usr/bin
+	&& "$@" export done readonly 'quoted text' done local then | awk $(pwd) --verbose
+	--verbose done test x=1 -eu ${HOME} "$@"
+		'quoted text' 2>/dev/null "$@"
+		/usr/bin /usr/bin | /usr/bin test awk echo sed 'quoted text'
+	&& x=1 -eu export printf then "$@" /usr/bin $(pwd) done export export
+/usr/bin then readonly readonly test && echo then sed -eu
+	printf 'quoted text' readonly printf awk 'quoted text'
+2>/dev/null 2>/dev/null
+	test test then then then
+	-eu printf cd "$@" "$1" 'quoted text' 2>/dev/null -eu "$@" awk local
+		echo local grep "$@" | --verbose sed $(pwd) readonly 2>/dev/null
+&& awk 'quoted text' cd 'quoted text' 'quoted text' 2>/dev/null 'quoted text' "$1"
+'quoted text' awk grep 2>/dev/null
+		grep done "$@" "$1" "$@"
+/usr/bin $(pwd) $(pwd) 'quoted text' local export cd "$@" && -eu --verbose
+export $(pwd) grep test | test printf | local && /usr/bin
+		awk 2>/dev/null 'quoted text'
+then done awk export -eu grep grep done printf
+		/usr/bin "$@" export 'quoted text' printf cd test 2>/dev/null
+		then 2>/dev/null "$@" cd printf && "$@" done grep 'quoted text' export
+	/usr/bin local $(pwd) cd sed ${HOME}
+$(pwd) ${HOME} test test
+--verbose local 'quoted text' grep cd "$@" | /usr/bin
+x=1 readonly export local ${HOME} awk
+	then "$1" echo 'quoted text' "$@" x=1 2>/dev/null
+	$(pwd) done --verbose /usr/bin $(pwd) local x=1 done 'quoted text'
+	done ${HOME} awk grep --verbose local -eu cd "$@"
+		-eu | 'quoted text' "$1" ${HOME} -eu grep 2>/dev/null &&
+		readonly "$@" ${HOME} "$1" export -eu test export x=1 2>/dev/null --verbose
+		readonly && export sed test done then x=1
+cd && "$1" echo printf 2>/dev/null x=1
+		sed && -eu x=1 x=1 --verbose then done readonly 2>/dev/null
+echo readonly "$1" "$@"
+	printf && /usr/bin "$@" done readonly sed 2>/dev/null 2>/dev/null
+		printf /usr/bin | $(pwd) local $(pwd) then x=1 /usr/bin printf $(pwd) "$1" grep
+		"$@" $(pwd) done x=1 x=1 x=1 ${HOME}
+| sed readonly printf done
+	--verbose done done 'quoted text' x=1 cd local
+cd && test test "$1" grep printf local --verbose cd grep ${HOME} 2>/dev/null
+/usr/bin --verbose test sed then
+		-eu echo 2>/dev/null "$@" done cd "$@" done grep awk 2>/dev/null /usr/bin
+printf "$@" grep && grep sed x=1 "$1" echo echo x=1 grep awk printf
+	'quoted text' test echo echo 2>/dev/null 'quoted text' printf
+		then 'quoted text' export | awk "$1" --verbose 'quoted text' done echo test test
+grep printf test "$1" "$@" $(pwd) -eu | local awk && x=1
+		then then "$@" grep readonly sed x=1 2>/dev/null cd
+		export echo sed echo echo local && x=1 done readonly $(pwd) 2>/dev/null |
+	x=1 'quoted text' | sed --verbose local --verbose export
+		readonly "$@" awk cd 2>/dev/null | && sed "$1" --verbose sed ${HOME}
+cd 2>/dev/null then 2>/dev/null
+	$(pwd) --verbose then --verbose printf
+		local && && sed -eu local 'quoted text'
+"$@" -eu export sed 'quoted text' "$1" done
+	printf done $(pwd) awk 'quoted text' && sed $(pwd) x=1 2>/dev/null
+		then then 'quoted text' 2>/dev/null echo done done echo
+done local ${HOME} cd then
+		export printf test --verbose | /usr/bin | $(pwd) done ${HOME}
+		'quoted text' export /usr/bin printf && printf grep ${HOME} then
+x=1 then cd -eu "$@" 'quoted text' --verbose test done
+	${HOME} --verbose grep local 2>/dev/null "$@" ${HOME} $(pwd)
+	2>/dev/null 'quoted text' cd -eu -eu ${HOME} ${HOME} --verbose sed then -eu --verbose
+"$@" 2>/dev/null sed printf done local --verbose
+&& printf awk readonly cd --verbose readonly $(pwd) cd echo
+then /usr/bin && echo readonly 2>/dev/null
+${HOME} cd 2>/dev/null ${HOME}
+	--verbose ${HOME} grep "$1" test grep sed sed /usr/bin "$@" then 'quoted text'
+		echo "$@" "$@" 'quoted text' 'quoted text' test done then cd sed sed 2>/dev/null
+	printf readonly awk test done -eu && | readonly cd "$@" echo echo export $(pwd)
+2>/dev/null $(pwd) ${HOME} echo sed test &&
+${HOME} grep "$1" export test grep "$@" "$@" awk | | -eu ${HOME}
+	then test x=1 -eu readonly readonly 'quoted text' then 'quoted text' local $(pwd)
+		"$1" then "$@" $(pwd) | | --verbose /usr/bin grep sed local
+		--verbose export && awk export readonly sed
+2>/dev/null done grep cd done awk 'quoted text' | export printf
+		--verbose sed grep --verbose
+printf $(pwd) test --verbose then cd | awk
+	done then 'quoted text'
+	| "$@" printf && -eu echo export 'quoted text' --verbose "$1" 2>/dev/null
+		2>/dev/null $(pwd) readonly /usr/bin "$@"
+		-eu printf "$1" /usr/bin echo echo test readonly $(pwd) cd "$@" echo
+		then printf then "$1" $(pwd) printf readonly
+		&& | "$1" grep 'quoted text'
+${HOME} sed "$@" done local
+x=1 | then "$@" sed export && export echo cd --verbose "$@"
+		'quoted text' sed printf test test
+		"$1" -eu 2>/dev/null $(pwd) test
+		cd --verbose --verbose awk readonly
+done grep 'quoted text' "$1" ${HOME} printf
+${HOME} grep /usr/bin && | readonly test
+	| $(pwd) && | 2>/dev/null $(pwd)
+"$@" then "$@" --verbose x=1 readonly
+	export sed cd awk then sed local
+| local 'quoted text' --verbose export
+&& $(pwd) /usr/bin /usr/bin awk && ${HOME} && printf
+local -eu | "$1" grep then echo | awk
+"$1" "$@" 'quoted text' |
+	readonly grep cd test sed ${HOME} awk echo readonly ${HOME}
+	"$@" done && x=1 && grep then ${HOME} "$1" cd done readonly 'quoted text' /usr/bin
+echo 2>/dev/null x=1 local cd -eu export echo /usr/bin
+		"$1" export --verbose /usr/bin sed $(pwd)
+		"$1" "$@" -eu x=1 | cd 'quoted text'
+	-eu printf "$1" /usr/bin export --verbose "$1" && printf
+	| "$@" done cd local 'quoted text' awk "$1" 2>/dev/null "$@"
+		export local "$@" done 'quoted text' "$1" | done readonly |
+		$(pwd) -eu local cd "$1" | echo "$1" 2>/dev/null export awk cd
+	"$1" x=1 printf cd "$@" test "$1" sed cd echo x=1 --verbose $(pwd) echo
+	done awk "$@" awk x=1 printf /usr/bin readonly
+sed x=1 x=1 | | test done echo
+	-eu $(pwd) 'quoted text' sed x=1 export readonly cd grep test local x=1 awk ${HOME}
+	| 2>/dev/null export sed readonly ${HOME} readonly /usr/bin 'quoted text'
+local grep "$@" then awk 'quoted text' sed local
+	"$1" 'quoted text' "$1"
+	export "$1" "$1" then sed x=1 "$1" "$@"
+-eu 2>/dev/null 'quoted text' "$1" ${HOME} echo 'quoted text' 'quoted text'
+		done && cd "$@" x=1 sed local x=1 echo printf /usr/bin
+2>/dev/null "$1" test cd then | /usr/bin readonly test -eu sed $(pwd) awk cd x=1
+		x=1 && then test --verbose 2>/dev/null "$@" /usr/bin 2>/dev/null sed readonly 'quoted text'
+		done && readonly printf $(pwd) 2>/dev/null | printf "$@" printf awk --verbose x=1
+	readonly --verbose sed cd --verbose
+		local printf && 2>/dev/null printf
+local 2>/dev/null && test export awk /usr/bin ${HOME} export
+&& x=1 --verbose printf awk sed readonly x=1 "$@" echo 'quoted text'
+	$(pwd) local cd "$1" readonly export 'quoted text' | grep && ${HOME} cd cd sed
+| /usr/bin x=1 done /usr/bin --verbose
+/usr/bin awk export ${HOME} && done "$@" printf
+	done /usr/bin | test "$@" export && | && --verbose 2>/dev/null local local | cd
+"$@" then | local 'quoted text' 2>/dev/null printf | -eu
+then $(pwd) "$@" cd ${HOME} awk cd grep | readonly 'quoted text' 2>/dev/null printf
+	x=1 then $(pwd) /usr/bin
+	awk test echo 'quoted text' $(pwd)
+	cd sed x=1 echo echo test "$1" 2>/dev/null
+		'quoted text' 2>/dev/null | echo grep awk done local
+		grep && cd 'quoted text' local x=1 "$@" echo "$@" x=1 | export x=1
+${HOME} 'quoted text' awk "$@" "$@" --verbose /usr/bin
+	awk test /usr/bin "$1" "$@" 2>/dev/null ${HOME}
+	| ${HOME} then local awk -eu done ${HOME} echo $(pwd) 'quoted text' printf
+	'quoted text' printf local then then awk export $(pwd)
+	--verbose then "$@" "$1" test local x=1 -eu local 2>/dev/null -eu awk grep x=1
+	/usr/bin awk ${HOME} printf x=1 cd x=1 test 'quoted text' done sed
+$(pwd) cd export --verbose
+		--verbose awk printf ${HOME} export echo
+		"$@" local echo /usr/bin x=1 2>/dev/null local echo cd /usr/bin
+$(pwd) | cd readonly -eu sed "$1"
+$(pwd) readonly done && readonly awk $(pwd)
+	printf sed "$1" "$@" then x=1
+local && $(pwd) readonly cd export done 'quoted text' readonly
+done 2>/dev/null export test -eu grep && /usr/bin
+	readonly 'quoted text' readonly 2>/dev/null then printf 'quoted text' "$@" "$@"
+	readonly echo readonly --verbose awk && --verbose done sed 2>/dev/null
+		-eu awk test done | then test sed
+		'quoted text' /usr/bin 2>/dev/null | x=1 | cd grep then | done 2>/dev/null
+	sed echo echo done 'quoted text' -eu && local then cd ${HOME} "$1" && printf
+	awk 'quoted text' local && done && awk | then awk echo grep $(pwd) x=1 grep
+	"$@" awk test | 2>/dev/null grep echo
+	cd local test grep echo echo
+		done -eu /usr/bin echo "$1" echo printf && $(pwd)
+		'quoted text' local $(pwd) cd /usr/bin | echo 'quoted text'
+	grep --verbose && sed awk done 'quoted text' printf grep -eu --verbose sed
+--verbose grep ${HOME} echo "$1" ${HOME}
+	local --verbose printf awk then "$@" echo cd echo "$1" --verbose
+	local printf -eu | --verbose readonly local -eu sed local $(pwd)
+		grep awk "$1" echo -eu grep grep readonly echo 2>/dev/null -eu "$1"
+		echo 2>/dev/null awk $(pwd) awk test awk 'quoted text'
+		$(pwd) export /usr/bin ${HOME} 'quoted text'
+echo export grep 2>/dev/null x=1 --verbose --verbose &&
+		'quoted text' done awk 2>/dev/null --verbose cd then /usr/bin
+'quoted text' ${HOME} export && x=1
+done /usr/bin echo "$1" done then
+		grep && --verbose 'quoted text' local
+	readonly printf export awk readonly
+		--verbose && && readonly ${HOME}
+readonly printf done readonly | cd cd done local -eu grep | cd
+-eu export $(pwd) local 2>/dev/null done cd 2>/dev/null grep
+--verbose readonly awk then then
+2>/dev/null x=1 echo done printf "$@" 'quoted text' printf ${HOME}
+local && sed --verbose export x=1 cd printf | awk "$@" readonly
+/usr/bin sed readonly x=1 then local local printf && export echo
+		sed "$1" 2>/dev/null printf x=1 x=1 cd sed x=1 | -eu
+	x=1 | readonly 'quoted text' --verbose 2>/dev/null
+echo export ${HOME} done echo --verbose | printf -eu | "$@" done
+awk 2>/dev/null "$1" cd grep "$@" x=1 cd /usr/bin then echo awk "$1" then awk
+	local then grep ${HOME} export printf export --verbose /usr/bin 'quoted text'
+	test test x=1 readonly && 2>/dev/null
+	echo $(pwd) grep "$1" readonly ${HOME} cd echo ${HOME}
+	awk 'quoted text' awk sed awk done local && -eu
+		cd --verbose sed export readonly grep done awk grep "$1" x=1 --verbose
+	2>/dev/null done 'quoted text' then printf --verbose $(pwd) /usr/bin
+$(pwd) echo awk "$@" | export
+	local ${HOME} ${HOME} $(pwd) 2>/dev/null cd printf sed 2>/dev/null
+		/usr/bin grep sed awk local && -eu x=1 --verbose export x=1 /usr/bin
+		then 'quoted text' sed "$1" 'quoted text' sed test && awk | done sed /usr/bin done
+x=1 && -eu echo 'quoted text' && /usr/bin --verbose sed && cd printf ${HOME}
+		grep --verbose grep $(pwd) echo printf
+		-eu ${HOME} $(pwd) done "$1" "$@"
+		"$1" export export "$@" $(pwd) | export 2>/dev/null echo sed readonly $(pwd)
+	/usr/bin done sed local then awk -eu &&
+printf export $(pwd) && export
+		'quoted text' grep test local /usr/bin export cd sed test 2>/dev/null done
+	--verbose then cd && readonly
+	&& $(pwd) printf local && "$1" && local grep -eu
+readonly grep echo /usr/bin
+&& readonly "$@" then printf "$1"
+		&& cd test printf then "$1" grep
+-eu $(pwd) printf cd --verbose
+		done export test then then readonly local echo
+	then /usr/bin "$@" "$@" sed test "$@" ${HOME} | "$@"
+echo "$@" echo echo && | && export then export "$@" && sed /usr/bin readonly -eu
+		awk --verbose done &&
+	readonly awk printf echo 'quoted text' ${HOME} local --verbose export local
+local 'quoted text' /usr/bin
+	awk sed x=1 'quoted text' test printf ${HOME} 2>/dev/null printf echo printf
+		grep awk "$1" echo "$@" printf export grep "$1" $(pwd)
+	echo echo ${HOME} -eu 2>/dev/null 'quoted text'
+	grep -eu cd done ${HOME} export --verbose && local export && echo
+	"$@" cd --verbose 'quoted text' grep 'quoted text' --verbose
+		awk "$@" then | $(pwd) /usr/bin then | done "$1" done --verbose
+		printf local "$1" readonly
+-eu done cd | echo $(pwd) && -eu readonly
+	test --verbose x=1 printf --verbose cd done
+readonly echo sed | grep 'quoted text' cd awk /usr/bin then awk printf 2>/dev/null
+	local test sed -eu printf
+$(pwd) done echo done x=1 | /usr/bin sed export 2>/dev/null readonly
+echo x=1 printf then $(pwd) /usr/bin test readonly /usr/bin && 'quoted text'
+test printf printf --verbose test readonly grep 2>/dev/null cd -eu x=1
+	local echo "$@" $(pwd) "$@" x=1 "$@" x=1 local ${HOME} x=1 local done local done
+/usr/bin "$@" && then export then test 'quoted text' readonly
+		done then awk && 'quoted text'
+grep 'quoted text' test
+	$(pwd) grep export cd -eu 'quoted text' -eu printf test --verbose
+	printf $(pwd) export "$1" test echo ${HOME}
+grep readonly 'quoted text' then sed -eu cd 'quoted text'
+		${HOME} awk "$@" export ${HOME} printf grep "$@" sed &&
+"$1" "$@" done $(pwd) x=1 export && then "$@"
+	grep /usr/bin 2>/dev/null test | then | cd
+	echo --verbose awk grep && cd "$@" x=1 echo "$1" done grep echo grep
+local readonly export grep --verbose grep "$1" "$@" local sed "$1"
+	"$@" readonly ${HOME} test $(pwd) cd
+sed sed /usr/bin test test then "$@" local "$1" ${HOME} cd | local sed
+		&& readonly awk local 2>/dev/null
+'quoted text' readonly test readonly "$1" sed echo done 2>/dev/null "$@" cd grep
+	/usr/bin "$@" test 'quoted text'
+'quoted text' awk --verbose sed test 2>/dev/null
+export readonly $(pwd) grep done echo x=1 /usr/bin
+		"$@" && cd awk /usr/bin test export cd /usr/bin --verbose "$@" echo done done
+		2>/dev/null "$1" local $(pwd) | "$@" test
+		-eu test $(pwd) /usr/bin echo then x=1 printf test "$1" "$1" grep | &&
+	done grep && "$@" /usr/bin grep echo ${HOME} ${HOME} -eu cd
+		/usr/bin ${HOME} ${HOME} | $(pwd) printf
+	'quoted text' echo && -eu local "$@" cd && then
+	cd cd sed && --verbose cd && 2>/dev/null --verbose
+	"$@" $(pwd) sed 2>/dev/null | "$@"
+		done then "$@" $(pwd) --verbose echo ${HOME} 2>/dev/null printf local
+		x=1 x=1 cd --verbose -eu sed cd sed done "$@" readonly | -eu local export echo
+--verbose printf printf $(pwd) grep $(pwd) /usr/bin grep then grep
+| /usr/bin echo && done done grep
+printf "$1" local then | 'quoted text'
+cd --verbose echo awk test 'quoted text' export $(pwd) -eu 2>/dev/null
+		2>/dev/null test readonly
+$(pwd) sed sed x=1 /usr/bin
+		echo 2>/dev/null local echo readonly
+done -eu 2>/dev/null cd && done printf 'quoted text' $(pwd) -eu test
+	printf then test --verbose /usr/bin -eu export 2>/dev/null "$@" -eu
+		test echo sed cd x=1 test
+'quoted text' ${HOME} done local then
+	sed | export -eu echo | cd --verbose
+	/usr/bin readonly cd test "$@" | export 2>/dev/null -eu cd printf
+	-eu "$@" done sed echo cd 'quoted text' then then echo "$@" | -eu --verbose
+done && && sed 2>/dev/null && /usr/bin local
+	--verbose -eu --verbose --verbose | 2>/dev/null && && awk echo local
+test printf awk -eu "$1" -eu ${HOME} test then done $(pwd)
+	export echo readonly $(pwd) export
+		| && local done "$1" grep ${HOME} readonly readonly "$@" 2>/dev/null /usr/bin
+	&& export x=1 export awk echo x=1 grep | local printf
+$(pwd) "$@" 2>/dev/null |
+		awk printf x=1 printf done
+	${HOME} test echo "$1" | x=1
+	2>/dev/null 2>/dev/null ${HOME} 2>/dev/null echo $(pwd) sed && grep x=1
+		done test -eu local then "$1" --verbose && export "$1" 2>/dev/null
+done $(pwd) test "$1" 2>/dev/null --verbose && then echo $(pwd) cd sed cd awk ${HOME}
+grep done awk /usr/bin readonly test
+	"$1" sed "$@" 'quoted text' && "$1" local export test grep then sed "$@" printf
+	'quoted text' 'quoted text' 2>/dev/null && cd 'quoted text' awk test
+	"$@" "$@" grep echo cd printf cd awk export | readonly
+	$(pwd) x=1 "$@" done "$1" done echo then | | grep readonly
+		-eu echo done export sed test grep export done /usr/bin local
+	echo grep awk 'quoted text' export /usr/bin local echo cd export awk &&
+		local | grep then awk
+	"$1" cd --verbose x=1 "$@" echo $(pwd)
+		$(pwd) then test local $(pwd) done
+	grep 2>/dev/null 2>/dev/null && then done echo -eu echo awk | --verbose grep --verbose
+-eu -eu sed "$1" $(pwd)
+"$1" readonly 2>/dev/null awk printf -eu x=1 done
+	/usr/bin /usr/bin x=1 test "$@" test cd local -eu test
+echo && /usr/bin -eu $(pwd) export
+${HOME} "$@" -eu cd x=1 /usr/bin
+--verbose x=1 "$1" awk --verbose 2>/dev/null /usr/bin echo then | printf
+	--verbose ${HOME} done echo echo done export && --verbose sed echo test
+/usr/bin then -eu printf echo 2>/dev/null printf
+	cd 2>/dev/null echo done ${HOME} /usr/bin 'quoted text' --verbose $(pwd) awk echo
+"$1" && sed cd printf echo -eu export export grep printf cd "$@" then && -eu
+		--verbose cd done /usr/bin sed x=1 awk | awk | ${HOME} done
+	done | x=1 | "$@" 2>/dev/null --verbose export 2>/dev/null
+		awk "$@" 2>/dev/null sed printf readonly printf
+	$(pwd) awk awk readonly done done then grep echo "$1" x=1 local grep grep
+		'quoted text' sed then cd echo
+-eu awk 'quoted text' | done $(pwd) grep -eu done && && export
+sed /usr/bin done test $(pwd) grep sed "$@"
+"$@" awk x=1 x=1 -eu "$1" echo --verbose printf done test 2>/dev/null
+	${HOME} && x=1 "$1" |
+	export ${HOME} then sed x=1 awk test $(pwd) sed -eu cd local -eu test | then
+		done test awk then | then
+done && echo done grep && "$@" done echo $(pwd) printf printf
+--verbose readonly "$@" | printf ${HOME}
+"$1" x=1 | "$1" grep "$@" ${HOME} -eu done -eu grep "$@" "$@" grep |
+	cd awk cd | "$1" | grep printf | sed /usr/bin $(pwd) readonly
+	"$1" $(pwd) test x=1 printf sed echo local echo grep done
+sed test done printf 'quoted text' test local "$1"
+		--verbose --verbose ${HOME} ${HOME} && awk "$@" && local 2>/dev/null
+	2>/dev/null then echo test sed "$@" && $(pwd) test ${HOME} $(pwd) sed
+	local "$1" "$1" printf ${HOME} sed /usr/bin done
+-eu 2>/dev/null test sed "$1" printf $(pwd) | then awk /usr/bin
+$(pwd) export | -eu /usr/bin $(pwd) && /usr/bin x=1
+	export cd done 2>/dev/null echo x=1 ${HOME} "$1" x=1 export && awk &&
+	awk -eu sed awk local cd /usr/bin awk "$1" test export
+	cd x=1 'quoted text' readonly ${HOME}
+then 'quoted text' cd x=1 echo | "$1" 2>/dev/null awk readonly /usr/bin ${HOME}
+	readonly && | awk local 'quoted text' | ${HOME} "$1" cd $(pwd) then sed export
+test echo grep $(pwd) && 'quoted text' 2>/dev/null "$@" $(pwd)
+		then x=1 local printf /usr/bin sed x=1 sed printf -eu x=1 "$1"
+		done test ${HOME} readonly echo
+		"$1" then "$1" awk "$1" awk | 'quoted text' grep export "$1" grep | sed sed
+		export grep -eu 2>/dev/null
+readonly && "$@" readonly "$@" -eu local cd
+awk awk --verbose readonly grep test test "$@" awk "$@"
+	--verbose local echo test 'quoted text'
+	export printf ${HOME} awk "$1" $(pwd) test sed local ${HOME} cd
+&& 'quoted text' grep && awk "$1" | test done done sed
+		done cd x=1 local --verbose | x=1 test sed grep x=1 $(pwd)
+		test echo && "$1" test grep echo "$1" cd test
+then ${HOME} -eu "$@" export done 'quoted text' --verbose 2>/dev/null --verbose
+		"$1" "$@" /usr/bin then echo -eu sed export test --verbose cd | then "$1" ${HOME}
+		cd readonly readonly readonly /usr/bin "$1"
+x=1 readonly grep awk then -eu "$@" ${HOME}
+		grep awk test $(pwd) 2>/dev/null awk done
+		| | "$1" printf /usr/bin
+	awk sed readonly export "$@"
+	grep cd ${HOME} --verbose $(pwd) echo
+		readonly local then -eu 'quoted text' printf echo 'quoted text'
+	cd && then /usr/bin -eu grep && $(pwd)
+echo $(pwd) test 2>/dev/null then done /usr/bin printf 'quoted text' test
+	local | --verbose local --verbose ${HOME} grep sed echo | readonly echo /usr/bin
+	local 'quoted text' --verbose cd export awk sed sed echo ${HOME}
+	cd cd export $(pwd) test | &&
+	2>/dev/null x=1 echo && -eu sed grep 2>/dev/null -eu printf awk -eu && && test
+		printf "$@" local --verbose then local readonly "$1" && cd --verbose
+		grep readonly $(pwd) $(pwd) "$@" 2>/dev/null ${HOME} /usr/bin
+	export 'quoted text' local | cd $(pwd) then 'quoted text' -eu printf 2>/dev/null
+		then /usr/bin "$1" | sed "$1" --verbose
+${HOME} cd --verbose cd grep 'quoted text'
+sed "$1" -eu ${HOME} cd --verbose "$@" x=1 -eu export then --verbose
+	test && cd readonly awk readonly
+	grep grep printf "$1" echo
+/usr/bin 2>/dev/null ${HOME}
+		"$@" -eu grep -eu ${HOME} done && cd "$1"
+	test grep cd test -eu local export "$1" done $(pwd) ${HOME} test ${HOME} ${HOME}
+--verbose cd then $(pwd) done | done | export done -eu
+&& printf echo 'quoted text' /usr/bin 'quoted text'
+		done sed cd grep 2>/dev/null echo done cd $(pwd) "$1" 2>/dev/null
+	| "$@" 'quoted text' awk cd | "$1" then sed
+	awk local && printf x=1 echo local /usr/bin --verbose grep then
+sed "$1" cd awk export && local done "$1"
+| | --verbose awk cd 2>/dev/null
+	/usr/bin "$@" then done $(pwd) ${HOME} export then done && /usr/bin
+printf 2>/dev/null "$@" awk local "$@" then
+		"$1" 2>/dev/null 2>/dev/null awk awk cd export readonly grep sed
+		"$1" | awk cd local $(pwd) "$1" echo then cd awk local 2>/dev/null then then
+	$(pwd) done printf 2>/dev/null &&
+x=1 x=1 $(pwd) test then test | /usr/bin then
+	done --verbose test sed 2>/dev/null
+then /usr/bin "$@" "$1" cd $(pwd) ${HOME}
+		--verbose test done then done readonly -eu test $(pwd)
+&& then local $(pwd) -eu local ${HOME}
+		"$@" local --verbose test "$@" &&
+	2>/dev/null --verbose test "$1" local --verbose printf local awk awk echo
+$(pwd) $(pwd) 2>/dev/null && -eu -eu ${HOME} --verbose
+		sed export && "$1" -eu 'quoted text' export sed
+		${HOME} x=1 grep done export done x=1 test
+		&& awk --verbose x=1 && sed sed export "$@" export $(pwd) sed
+		local "$1" "$@" /usr/bin | x=1 awk x=1 test then printf cd $(pwd) |
+$(pwd) 'quoted text' test
+readonly readonly done && export awk done $(pwd) awk | then && $(pwd) grep echo
+$(pwd) sed 2>/dev/null cd grep awk then
+	| done awk | && test export done
+/usr/bin 'quoted text' /usr/bin printf --verbose -eu "$@" "$@" -eu grep "$@"
+2>/dev/null grep done then then -eu ${HOME} ${HOME}
+	"$1" export "$@" done $(pwd)
+	-eu 'quoted text' test 2>/dev/null
+$(pwd) x=1 awk 'quoted text' $(pwd) test | | sed test 2>/dev/null local echo
+printf | --verbose "$1"
+	grep test "$@" ${HOME} printf ${HOME} local export ${HOME}
+2>/dev/null sed -eu then $(pwd) then x=1 2>/dev/null 2>/dev/null ${HOME} awk
+		local sed local -eu done readonly -eu 'quoted text' | awk awk awk ${HOME} cd
+		test --verbose "$1" "$@" -eu
+	'quoted text' "$1" printf
+		'quoted text' ${HOME} readonly && cd -eu /usr/bin echo readonly 2>/dev/null | &&
+	"$1" awk 2>/dev/null awk then
+| -eu sed && export local && "$1" 2>/dev/null
+		${HOME} grep cd test echo x=1 $(pwd) printf && $(pwd) /usr/bin x=1 awk /usr/bin
+		$(pwd) 'quoted text' awk sed done
+		${HOME} && x=1 done ${HOME} grep printf -eu echo local grep export done | local
+		2>/dev/null grep then done "$@" ${HOME} test printf | cd cd sed ${HOME} $(pwd)
+		${HOME} export "$@" -eu cd $(pwd) cd cd test --verbose test awk
+		$(pwd) /usr/bin readonly cd grep "$@" | grep
+	sed && && then && export
+"$1" test ${HOME} done --verbose cd then cd then test 2>/dev/null
+test "$@" ${HOME} ${HOME} x=1 "$@" 2>/dev/null echo grep
+		awk readonly local | && | $(pwd) test cd sed cd -eu cd grep test
+		sed grep ${HOME} then && "$1" sed local /usr/bin
+		x=1 $(pwd) readonly 2>/dev/null | | /usr/bin
+	2>/dev/null ${HOME} | awk export -eu x=1 ${HOME} export | "$@" "$@"
+local awk sed 'quoted text' echo | ${HOME} x=1 test
+	cd then /usr/bin export /usr/bin awk --verbose cd done cd -eu && -eu echo
+cd | then "$@" 'quoted text' 'quoted text'
+	done --verbose then grep "$@" ${HOME}
+	readonly done $(pwd) /usr/bin x=1 awk /usr/bin sed $(pwd) echo echo
+	${HOME} echo 'quoted text' x=1 cd local printf export local
+local local --verbose "$1"
+	test $(pwd) /usr/bin sed "$@" $(pwd) cd done "$1"
+readonly -eu then sed -eu
+export readonly && then "$1" && readonly
+-eu then ${HOME} 'quoted text' && then
+awk $(pwd) /usr/bin test echo then grep && "$@" 'quoted text'
+grep export && x=1 ${HOME} && -eu echo cd readonly test
+		"$@" echo | /usr/bin printf grep then -eu 2>/dev/null printf then printf "$@"
+	echo done && && /usr/bin | && --verbose readonly
+		2>/dev/null && "$@" && done sed grep done
+		/usr/bin 2>/dev/null
+		cd sed -eu | "$@" echo $(pwd) printf sed
+		$(pwd) ${HOME} export readonly
+		"$@" "$@" -eu "$@" then 2>/dev/null readonly x=1 readonly ${HOME} --verbose
+		echo test awk then echo export then x=1 then printf
+	| awk "$@" /usr/bin | ${HOME} echo 'quoted text'
+test test 'quoted text' export then cd -eu export echo echo
+printf cd --verbose awk cd 'quoted text' --verbose x=1 sed sed /usr/bin cd
+		&& --verbose done cd /usr/bin test readonly
+		sed printf awk "$1" $(pwd) 2>/dev/null
+	then awk local grep export "$1" $(pwd) awk --verbose /usr/bin done done
+		echo && done then export x=1 done export
+		done && then export --verbose "$1" 2>/dev/null local && printf
+		grep 'quoted text' $(pwd) x=1 $(pwd) grep 'quoted text' 'quoted text' --verbose
+local 2>/dev/null echo 2>/dev/null | -eu -eu $(pwd)
+${HOME} done $(pwd) && echo 2>/dev/null ${HOME} $(pwd) local local echo sed
+	readonly "$@" done done | export cd printf --verbose sed local readonly
+		'quoted text' cd export awk then grep "$1" --verbose sed awk grep
+	$(pwd) "$1" test ${HOME} 2>/dev/null x=1 grep -eu echo $(pwd) $(pwd) && $(pwd)
+		--verbose printf echo grep then 'quoted text'
+	grep test then 2>/dev/null echo ${HOME}
+		&& /usr/bin --verbose x=1 $(pwd) && $(pwd) readonly done
+	"$1" 'quoted text' export $(pwd)
+	readonly ${HOME} | sed $(pwd)
+	test "$1" awk /usr/bin --verbose --verbose
+	$(pwd) echo 'quoted text' ${HOME} readonly sed test $(pwd) 'quoted text' echo cd
+	export cd ${HOME} awk awk printf
+	/usr/bin cd 'quoted text' 2>/dev/null 'quoted text' awk
+	grep then local echo cd | done then "$@" $(pwd) | test && 'quoted text' $(pwd)
+		2>/dev/null x=1 then && done && grep | 'quoted text'
+	done | $(pwd) ${HOME} "$1" -eu echo "$1" echo awk --verbose
+readonly --verbose cd x=1 export "$1" $(pwd) awk ${HOME}
+		2>/dev/null x=1 "$@" test echo done
+	"$1" echo --verbose awk printf --verbose
+		awk x=1 2>/dev/null cd export
+		'quoted text' 'quoted text' cd export printf cd sed $(pwd) -eu test printf printf
+"$1" "$@" then printf --verbose
+		cd /usr/bin sed awk /usr/bin printf local local local awk cd cd test 'quoted text'
+"$@" echo readonly printf test cd local echo local 2>/dev/null readonly
+		test awk "$1" "$@" 'quoted text' then cd ${HOME} ${HOME} awk -eu ${HOME} export
+	grep $(pwd) grep && test 2>/dev/null -eu sed test grep cd
+grep | "$1" | then grep test ${HOME}
+	export echo "$@" local x=1 2>/dev/null --verbose local test x=1
+	echo sed $(pwd) --verbose cd printf
+	readonly grep export awk export echo
+	"$1" grep sed grep grep $(pwd) /usr/bin -eu x=1 'quoted text' -eu
+	-eu -eu awk /usr/bin /usr/bin
+	awk 2>/dev/null printf | ${HOME}
+	2>/dev/null local --verbose "$1" $(pwd) ${HOME} x=1 "$1"
+		awk local echo echo local | local -eu
+"$@" grep /usr/bin $(pwd) --verbose
+${HOME} printf readonly then
+	'quoted text' then awk awk /usr/bin
+printf test printf && $(pwd) test 2>/dev/null
+cd ${HOME} -eu export && x=1 "$1" done done && test "$1"
+		awk "$@" "$@" /usr/bin grep x=1 && done "$1" sed readonly then cd $(pwd)
+		echo --verbose 'quoted text' $(pwd) echo ${HOME} 2>/dev/null
+	'quoted text' then export
+	awk /usr/bin export echo grep "$1" 2>/dev/null readonly
+		test then echo "$1" echo sed -eu grep $(pwd) sed grep echo 2>/dev/null
+echo then echo done "$1" ${HOME} $(pwd)
+		then "$1" awk done echo ${HOME} 2>/dev/null awk "$1" echo then
+	export done done echo 2>/dev/null cd
+	"$1" "$@" echo test "$@" test 2>/dev/null
+grep ${HOME} "$@" done grep
+		export awk done /usr/bin && cd --verbose printf local /usr/bin export
+"$@" /usr/bin 'quoted text' x=1 test ${HOME}
+then echo done -eu grep 2>/dev/null | $(pwd) sed local then
+grep awk sed 'quoted text' cd 'quoted text' --verbose
+		local then ${HOME} | -eu /usr/bin 'quoted text' done 2>/dev/null
+		export grep 'quoted text' awk grep "$1" done
+		echo && "$1" echo cd sed "$@" /usr/bin awk 2>/dev/null
+		&& local /usr/bin awk /usr/bin local 2>/dev/null
+		cd readonly "$@" printf --verbose echo local done sed
+		"$1" /usr/bin awk cd -eu sed then readonly
+	x=1 done 'quoted text' then export
+	"$1" sed && local sed sed "$1" sed grep printf "$1"
+		"$1" 'quoted text' export awk then sed && | && sed awk grep
+	grep local "$1" echo export test ${HOME} done /usr/bin x=1 | cd local
+	| x=1 local cd | grep then 'quoted text'
+x=1 then sed -eu ${HOME} sed
+printf --verbose local -eu cd | 2>/dev/null test done export --verbose --verbose
+printf 2>/dev/null grep then 'quoted text' readonly x=1 cd
+		export printf | then grep done && /usr/bin ${HOME}
+awk 'quoted text' x=1 readonly --verbose
+	printf "$1" sed "$1" printf readonly
+	&& grep echo grep echo test "$1" awk cd
+	'quoted text' "$@" ${HOME} "$@" x=1
+${HOME} awk && 2>/dev/null 'quoted text' export "$1" 2>/dev/null
+/usr/bin done test printf | "$1" test 'quoted text' test echo
+"$@" && --verbose cd readonly echo then readonly
+		"$@" printf $(pwd) --verbose cd awk printf 'quoted text'
+	sed 2>/dev/null printf test cd
+		then done /usr/bin ${HOME} x=1 /usr/bin
+	sed printf export -eu "$1" awk 'quoted text' -eu done -eu then sed 2>/dev/null
+	/usr/bin ${HOME} test -eu $(pwd)
+	awk --verbose awk awk printf "$1" --verbose /usr/bin "$@" awk test printf ${HOME}
+	'quoted text' 2>/dev/null ${HOME} done "$1" cd printf 'quoted text' && then x=1
+	&& 'quoted text' ${HOME} local --verbose ${HOME} printf -eu sed export grep test
+grep -eu echo /usr/bin && "$1" --verbose /usr/bin cd export ${HOME} && /usr/bin
+		"$1" | cd awk "$@" test export echo /usr/bin
+		-eu --verbose then --verbose sed local && grep 2>/dev/null "$1" "$@" && $(pwd)
+		local grep | then $(pwd) x=1 2>/dev/null
+		&& 'quoted text' grep awk /usr/bin printf /usr/bin
+echo sed -eu | -eu awk
+		awk /usr/bin cd x=1 printf export sed test readonly grep
+printf 2>/dev/null test local grep "$@" "$@" x=1 "$1" sed export printf
+sed "$@" echo test | "$1" done "$1" grep export awk 2>/dev/null
+		test done 'quoted text' sed echo 2>/dev/null "$1" test 2>/dev/null echo
+	x=1 "$@" $(pwd) export done readonly "$@" /usr/bin echo export
+	'quoted text' 'quoted text' echo done printf
+	x=1 "$@" sed echo 2>/dev/null awk 2>/dev/null done readonly --verbose /usr/bin
+	awk ${HOME} local ${HOME}
+	"$@" | then printf grep ${HOME} done export then printf
+	grep --verbose -eu 2>/dev/null local readonly ${HOME}
+		| "$@" | cd awk 2>/dev/null local awk sed --verbose grep
+	"$@" local ${HOME} "$@" readonly "$@" grep echo
+/usr/bin "$@" x=1 /usr/bin ${HOME} --verbose echo
+	"$1" readonly --verbose readonly 'quoted text'
+	sed --verbose export $(pwd) /usr/bin
+		local | 2>/dev/null /usr/bin printf 'quoted text' cd then
+	/usr/bin done printf printf -eu cd -eu export then ${HOME}
+echo 2>/dev/null --verbose then && then then /usr/bin test ${HOME} | readonly
+local export awk && | "$1" 2>/dev/null x=1 --verbose ${HOME} /usr/bin awk
+	'quoted text' 'quoted text' done done sed readonly | "$@" /usr/bin awk export
+-eu grep cd 2>/dev/null grep
+	2>/dev/null "$@" local --verbose | export local 'quoted text' export
+${HOME} awk local export | done test local "$1"
+		| readonly local printf && 'quoted text' /usr/bin $(pwd) &&
+grep | local done awk x=1 local "$1" grep done "$1"
+/usr/bin 2>/dev/null 2>/dev/null 'quoted text' ${HOME} done &&
+		local $(pwd) local 'quoted text' "$@" /usr/bin sed ${HOME} "$1" && local
+		local -eu -eu done "$@" | cd -eu 2>/dev/null
+	'quoted text' /usr/bin test
+x=1 "$1" /usr/bin grep $(pwd) sed "$@" printf
+echo ${HOME} $(pwd) "$@" then "$@" /usr/bin awk | grep
+		$(pwd) $(pwd) && local
+		x=1 x=1 --verbose --verbose -eu ${HOME} 'quoted text'
+		${HOME} | x=1 export "$@" grep done && ${HOME} export x=1 2>/dev/null export
+	cd echo ${HOME} x=1 cd echo --verbose local printf ${HOME} printf
+&& local "$1" --verbose | grep $(pwd) awk grep cd x=1 && ${HOME}
+"$1" printf ${HOME} export sed printf then local
+awk sed export awk -eu grep local
+	grep local grep | && -eu printf -eu x=1 --verbose
+	'quoted text' grep | 'quoted text' $(pwd) ${HOME}
+| "$@" done test cd "$1" export awk done printf -eu printf 'quoted text'
+local local "$@" ${HOME} test
+		local export 'quoted text' then local sed 2>/dev/null then
+	$(pwd) local /usr/bin done 'quoted text'
+sed printf $(pwd) printf local /usr/bin
+		2>/dev/null done then readonly x=1 local | done grep echo done /usr/bin
+		"$1" ${HOME} -eu /usr/bin sed sed readonly -eu then /usr/bin printf
+		echo 2>/dev/null readonly cd local /usr/bin sed readonly awk export --verbose
+done grep ${HOME} printf local "$@" done
+2>/dev/null printf 'quoted text'
+		sed local x=1 sed | 'quoted text' "$1" export local
+	2>/dev/null awk sed | 'quoted text' ${HOME} grep printf export ${HOME} printf
+2>/dev/null --verbose awk local ${HOME} && sed awk "$1" done cd
+		sed x=1 cd sed then done "$1" -eu "$1" awk printf done x=1 sed --verbose
+		2>/dev/null grep 2>/dev/null printf local 'quoted text'
+		$(pwd) /usr/bin local readonly export local printf test then test /usr/bin "$1"
+	readonly 'quoted text' sed -eu "$@" /usr/bin "$1" echo --verbose export export
+		local --verbose 'quoted text' awk --verbose --verbose printf
+		grep | 'quoted text' | ${HOME} done then printf test sed -eu
+		-eu | /usr/bin printf 2>/dev/null 2>/dev/null echo
+	--verbose then -eu 'quoted text' readonly | export
+		| $(pwd) /usr/bin then grep
+done "$@" cd $(pwd) --verbose "$@" local export readonly | --verbose 2>/dev/null
+	echo x=1 'quoted text' && "$@" "$@" --verbose readonly | test cd printf
+		printf awk x=1 done then sed readonly
+x=1 | echo "$@" -eu readonly test ${HOME} awk awk cd test
+		local && "$@" sed && echo test sed awk 'quoted text'
+		awk awk 2>/dev/null cd
+&& readonly /usr/bin --verbose $(pwd) --verbose awk $(pwd)
+&& cd echo then readonly $(pwd) export
+-eu sed 2>/dev/null /usr/bin ${HOME} printf | test readonly 2>/dev/null
+	${HOME} "$@" $(pwd) echo ${HOME} "$@" $(pwd) && echo cd 2>/dev/null "$@" "$@"
+	readonly done awk export local readonly done -eu && cd
+		awk done "$@" | 'quoted text' --verbose
+		"$@" cd x=1 local cd echo sed "$1" cd ${HOME} --verbose
+"$@" 2>/dev/null "$1" && -eu "$1"
+export -eu "$@" "$@" test 'quoted text' readonly sed 2>/dev/null then
+cd grep echo grep local 'quoted text' local
+		readonly cd | printf done -eu cd ${HOME}
+--verbose 'quoted text' grep grep export awk
+	x=1 "$1" grep x=1 echo printf done && /usr/bin --verbose 2>/dev/null
+		done | "$@" /usr/bin "$1"
+		--verbose 2>/dev/null printf export
+	awk local "$@" grep done | 2>/dev/null readonly local $(pwd)
+		x=1 $(pwd) "$@" grep /usr/bin 'quoted text'
+		cd test --verbose /usr/bin -eu
+	local $(pwd) test done $(pwd) cd "$1" "$@" grep cd x=1 &&
+	readonly -eu awk done echo awk "$1" ${HOME}
+		${HOME} 'quoted text' -eu ${HOME} done
+"$1" awk then cd ${HOME} -eu ${HOME} $(pwd) printf echo x=1 "$1" readonly | cd
+	echo --verbose done then -eu printf then then "$@" /usr/bin done | 'quoted text'
+	-eu 2>/dev/null ${HOME}
+		"$@" local --verbose grep done grep echo 'quoted text' 'quoted text'
+	$(pwd) && grep echo 2>/dev/null local "$1" --verbose ${HOME} readonly
+2>/dev/null "$@" export echo
+	x=1 echo -eu ${HOME} 2>/dev/null then test then 2>/dev/null sed --verbose
+		awk grep ${HOME} cd cd "$1" && printf export $(pwd)
+	awk export 2>/dev/null cd x=1 sed
+		/usr/bin readonly -eu awk awk 'quoted text' 'quoted text'
+readonly 2>/dev/null 'quoted text' export && readonly done
+"$@" 2>/dev/null cd 2>/dev/null
+	printf readonly awk "$@" 2>/dev/null && awk grep --verbose sed 'quoted text'
+		/usr/bin done | awk && test 2>/dev/null
+		local awk 2>/dev/null | done export x=1 x=1 $(pwd)
+		-eu 'quoted text' 'quoted text' echo then /usr/bin export "$@"
+	--verbose -eu awk -eu readonly 2>/dev/null test $(pwd) echo done -eu --verbose
+		done export && /usr/bin
+		done && export -eu printf echo test cd $(pwd) "$1"
+		&& then ${HOME} 'quoted text' | printf printf
+		${HOME} "$1" local && /usr/bin test awk local echo grep
+${HOME} $(pwd) 2>/dev/null test ${HOME} 'quoted text'
+export local awk cd 'quoted text' echo sed
+	-eu grep then local x=1 'quoted text' echo && | | ${HOME} "$1" --verbose test
+echo grep grep cd local x=1 awk 2>/dev/null /usr/bin readonly
+--verbose export test done test "$1" 'quoted text' /usr/bin readonly
+		local x=1 done x=1 --verbose test 2>/dev/null /usr/bin
+export --verbose awk && cd -eu 2>/dev/null printf -eu printf
+sed -eu done cd done cd test 2>/dev/null x=1 && | then grep /usr/bin grep
+		$(pwd) export $(pwd) && test && -eu printf then ${HOME} local
+	awk $(pwd) export && "$@" $(pwd) then printf && readonly 2>/dev/null
+	&& echo cd sed readonly sed | echo sed then -eu --verbose -eu
+		--verbose cd $(pwd) -eu printf printf test then printf awk | 2>/dev/null
+		local sed /usr/bin printf && | cd grep 'quoted text'
+	'quoted text' printf printf 2>/dev/null sed
+	done then "$1" x=1 cd
+	$(pwd) $(pwd) awk readonly x=1 grep then then export "$@" sed grep x=1 $(pwd) echo
+	"$@" 'quoted text' awk | ${HOME} readonly 2>/dev/null
+		2>/dev/null | 2>/dev/null readonly
+		2>/dev/null x=1 awk awk
+		-eu test done echo --verbose echo then -eu --verbose |
+	grep cd done test readonly 2>/dev/null x=1 --verbose printf grep
+	readonly printf grep "$1" "$@" x=1 'quoted text'
+		cd "$@" "$@" test | then 2>/dev/null
+		'quoted text' then export printf --verbose 'quoted text' export
+		export "$1" -eu then /usr/bin && export sed /usr/bin echo
+$(pwd) sed ${HOME} && 'quoted text' echo cd printf ${HOME} local
+	grep 'quoted text' printf test | x=1 sed done
+		2>/dev/null && sed awk "$@" echo | "$1" $(pwd) echo 'quoted text'
+$(pwd) && "$@" 2>/dev/null then "$1" export sed readonly /usr/bin
+	&& 2>/dev/null readonly
+-eu | readonly -eu cd export readonly export grep echo test export /usr/bin $(pwd)
+		then ${HOME} -eu x=1 echo 'quoted text' awk readonly done export printf ${HOME}
+		$(pwd) awk cd --verbose 2>/dev/null readonly ${HOME} done
+	--verbose --verbose "$@" 2>/dev/null /usr/bin done test --verbose /usr/bin
+		grep readonly test local && echo 'quoted text' printf | &&
+	printf grep grep test $(pwd) 2>/dev/null test --verbose readonly
+		2>/dev/null 'quoted text' cd cd awk -eu echo ${HOME} cd test readonly | 'quoted text'
+		export echo done grep 'quoted text'
+	then "$@" && "$@" grep ${HOME} sed echo cd 'quoted text' printf x=1 'quoted text'
+printf export echo cd done
+		sed -eu local "$@" then
+export $(pwd) | then cd then x=1
+		&& "$1" -eu "$1" --verbose -eu 'quoted text'
+${HOME} "$@" grep -eu local cd
+done local printf export /usr/bin -eu
+&& | test sed printf 'quoted text' ${HOME} sed | | sed 'quoted text'
+local 'quoted text' 'quoted text' test sed export local 2>/dev/null /usr/bin
+		done cd "$@" 'quoted text' 2>/dev/null then && -eu printf grep
+test "$@" x=1 "$@" x=1 grep cd && 'quoted text' 'quoted text'
+		then then echo /usr/bin | $(pwd)
+		-eu -eu export cd echo x=1 "$1" test readonly sed
+	then | readonly 'quoted text' printf && sed
+sed 'quoted text' sed "$1" grep && --verbose readonly local echo grep awk
+	"$1" local -eu awk echo awk /usr/bin --verbose local "$1" "$1" x=1 /usr/bin
+	local cd | "$1" local 'quoted text' cd -eu printf "$@" test && then --verbose
+	awk && "$1" done echo awk && && x=1 awk $(pwd) sed "$1" awk
+done awk "$1" ${HOME} "$@" $(pwd) done export 2>/dev/null printf test echo /usr/bin
+x=1 'quoted text' 2>/dev/null export | readonly "$1" "$@" printf
+		sed cd echo x=1 ${HOME} -eu local awk 'quoted text' sed export | then
+		${HOME} "$@" grep -eu printf readonly | then ${HOME}
+		then && $(pwd) cd ${HOME} -eu readonly 2>/dev/null then
+	test awk sed && awk --verbose echo done --verbose printf x=1 then grep
+		"$@" printf export x=1
+	'quoted text' $(pwd) --verbose done local printf readonly cd && cd sed /usr/bin
+then ${HOME} "$@" 'quoted text' -eu awk sed "$@" 'quoted text'
+		-eu then "$1" echo awk readonly export done | echo 'quoted text' test 'quoted text'
+	awk /usr/bin ${HOME} local | "$@"
+/usr/bin 2>/dev/null export printf "$@" | "$@"
+	x=1 && readonly | grep grep grep local --verbose
+		2>/dev/null printf $(pwd) grep -eu then export test -eu
+"$1" test sed /usr/bin printf awk && echo x=1 -eu | | "$@"
+		printf grep grep && 2>/dev/null x=1 --verbose
+		printf export 'quoted text' "$@" awk x=1 cd -eu sed done
+	x=1 then then printf && local -eu | cd | "$@"
+	local readonly 2>/dev/null done 'quoted text' readonly --verbose
+		export readonly ${HOME} cd echo | done readonly echo | 2>/dev/null
+	| -eu -eu && && cd echo export | "$1" local -eu x=1 awk "$@" --verbose
+		--verbose 2>/dev/null awk done printf
+	done printf local local test && cd local readonly
+	'quoted text' grep readonly local --verbose "$@"
+grep grep echo done local $(pwd) grep test export
+done && printf | | x=1 local && /usr/bin "$@" done "$@"
+then "$1" cd /usr/bin | then "$@" printf awk 2>/dev/null
+		"$@" --verbose local "$1" sed "$1" -eu 2>/dev/null ${HOME} /usr/bin
+	sed 'quoted text' cd readonly local x=1 sed then awk $(pwd) printf
+		${HOME} readonly grep
+		--verbose then sed then export echo "$@" x=1 -eu ${HOME} then "$@" awk /usr/bin
+		&& local | x=1 "$@" x=1 'quoted text' local grep -eu echo cd
+		then /usr/bin "$1" "$1" /usr/bin x=1 $(pwd) "$@"
+	test sed 2>/dev/null "$1" grep
+	${HOME} test awk ${HOME} $(pwd) grep local export export "$1" echo /usr/bin test
+'quoted text' done x=1 'quoted text' sed grep "$@" |
+	then grep "$@" then printf done ${HOME} grep echo x=1 then then printf export 2>/dev/null
+	sed then --verbose awk ${HOME}
+	done "$1" grep "$@" export && done readonly $(pwd) -eu 2>/dev/null "$1"
+	local export sed local /usr/bin local
+		'quoted text' && local sed sed x=1 done then /usr/bin && grep done "$1" 'quoted text'
+	${HOME} echo $(pwd) && ${HOME} export printf grep
+		x=1 -eu | printf printf x=1 export then sed echo cd -eu
+		-eu | grep "$1" -eu | 'quoted text' cd && then grep local local && export
+	"$@" "$@" "$1" test echo awk readonly awk --verbose
+local printf -eu sed -eu local
+	awk readonly then | echo "$@" export "$@" cd "$1" awk done /usr/bin
+	awk grep "$@" awk $(pwd) grep
+	| sed test && echo done done | sed echo -eu printf echo x=1 "$1"
+	awk readonly cd $(pwd) 'quoted text' local
+	x=1 echo 'quoted text' cd $(pwd) -eu printf test --verbose --verbose $(pwd)
+done "$1" grep cd export ${HOME} grep test x=1 -eu cd awk -eu
+x=1 grep readonly /usr/bin x=1 x=1 --verbose ${HOME} x=1 | awk awk export done
+	${HOME} --verbose cd -eu printf ${HOME} test "$1" cd sed echo sed done
+${HOME} then ${HOME} | ${HOME} printf | printf | export ${HOME}
+2>/dev/null grep export "$@" /usr/bin printf x=1 2>/dev/null -eu
+	export | && grep local | printf && "$1" $(pwd) awk | "$1" export
+	echo --verbose sed test 2>/dev/null "$1" then --verbose x=1 readonly &&
+test done cd sed ${HOME} grep "$@" awk ${HOME} | 2>/dev/null cd cd "$@"
+sed local echo done sed /usr/bin | | grep /usr/bin ${HOME} && test
+sed awk done export readonly "$@" "$@" local /usr/bin
+		-eu | readonly && x=1 awk cd | sed export grep -eu readonly
+		done awk x=1 sed ${HOME} awk then readonly
+		"$@" -eu x=1 grep $(pwd) --verbose
+2>/dev/null then /usr/bin test local awk grep grep "$1" /usr/bin done awk test
+	x=1 "$1" readonly export export | -eu done -eu export awk local
+	2>/dev/null "$@" local $(pwd) /usr/bin 2>/dev/null
+		awk echo printf | export
+		cd && ${HOME} | | cd -eu $(pwd) ${HOME} --verbose cd --verbose
+	then printf 2>/dev/null |
+	awk | ${HOME} cd awk then grep awk cd awk local 'quoted text' test 'quoted text'
+		echo 2>/dev/null x=1 readonly
+| local cd --verbose cd local echo $(pwd) 'quoted text'
+		echo $(pwd) 'quoted text' echo sed cd grep printf "$@" "$1" echo
+		test "$@" export printf done local sed readonly
+	&& "$1" | | export done -eu --verbose && echo echo -eu export then sed "$@" grep
+		-eu grep 2>/dev/null echo test /usr/bin
+export --verbose test --verbose "$1" &&
+		echo x=1 local local | 2>/dev/null printf
+	"$@" local grep ${HOME} local
+		readonly && done echo printf
+	cd /usr/bin $(pwd) $(pwd) cd
+cd --verbose done done --verbose done local "$@" then grep echo
+		'quoted text' local echo "$1" -eu 'quoted text' echo --verbose 'quoted text'
+	--verbose then local cd "$@" echo && awk cd local local --verbose $(pwd)
+		grep sed grep then test local cd "$@" $(pwd) export local
+'quoted text' awk 'quoted text' 2>/dev/null
+	${HOME} $(pwd) echo done --verbose --verbose
+	-eu grep printf echo 'quoted text'
+	2>/dev/null "$@" test | | "$1" "$@" awk export -eu done | | -eu readonly
+	| "$@" 'quoted text' readonly then
+		"$@" export cd local | x=1 && -eu 2>/dev/null printf export printf
+		echo | 2>/dev/null 2>/dev/null $(pwd) /usr/bin printf readonly x=1 2>/dev/null
+	done /usr/bin ${HOME} printf
+then | /usr/bin readonly 2>/dev/null $(pwd) -eu "$@"
+		x=1 /usr/bin "$1" x=1 /usr/bin awk printf x=1 cd /usr/bin ${HOME} -eu
+grep sed local 'quoted text' test "$@" done --verbose /usr/bin local done
+grep readonly grep /usr/bin printf readonly
+		--verbose $(pwd) ${HOME} 2>/dev/null
+	printf -eu | -eu echo local local
+	then 2>/dev/null grep "$1" cd readonly "$1" readonly
+	"$1" --verbose --verbose local x=1 ${HOME} 2>/dev/null x=1
+		cd "$1" | && $(pwd) "$@" local done "$@" "$@" 2>/dev/null done x=1
+	sed 'quoted text' 2>/dev/null ${HOME} printf grep sed 'quoted text' x=1 then 'quoted text'
+	${HOME} "$1" ${HOME} printf && && | done "$@" awk grep printf
+	grep cd cd "$@" export awk /usr/bin test then ${HOME} /usr/bin 2>/dev/null readonly
+2>/dev/null | local 'quoted text'
+		/usr/bin test sed readonly 'quoted text'
+		"$@" 2>/dev/null -eu awk |
+	--verbose local x=1 echo /usr/bin --verbose readonly
+-eu export | done --verbose sed x=1 --verbose
+2>/dev/null grep awk echo awk $(pwd) --verbose 'quoted text'
+		"$1" echo grep 2>/dev/null 'quoted text' printf "$@" grep cd 'quoted text'
+		test local done $(pwd) && --verbose $(pwd) sed grep "$@" --verbose
+		'quoted text' $(pwd) && printf local --verbose
+then "$@" 'quoted text' export $(pwd) test "$@" $(pwd)
+	2>/dev/null 2>/dev/null 2>/dev/null
+local "$1" then 2>/dev/null cd then 2>/dev/null
+		${HOME} "$1" local "$1" sed | 2>/dev/null "$1" local --verbose
+		local "$@" readonly --verbose $(pwd) sed sed "$@"
+		local "$1" printf cd done export /usr/bin x=1 ${HOME} "$1" export ${HOME} test
+x=1 /usr/bin test echo readonly export 'quoted text' cd printf
+		${HOME} printf done "$@" ${HOME} sed awk $(pwd) done $(pwd)
+test "$@" local && readonly done x=1 $(pwd) "$1"
+2>/dev/null then $(pwd) local printf 'quoted text'
+	local sed "$@" 2>/dev/null /usr/bin
+then sed test | "$@" "$@" test awk "$1" && printf 'quoted text'
+	&& printf sed -eu grep printf export test grep
+"$1" grep readonly x=1 cd && test
+	"$1" printf test && -eu 'quoted text' 'quoted text' ${HOME} x=1
+	sed 'quoted text' local then local -eu grep $(pwd) && "$@" echo --verbose
+		printf readonly --verbose
+	${HOME} cd sed --verbose grep 'quoted text'
+	test done $(pwd) then --verbose
+'quoted text' 2>/dev/null
+"$@" grep /usr/bin local
+sed --verbose test "$@"
+		readonly test "$@" local sed done local test cd x=1 2>/dev/null -eu | grep printf
+	${HOME} readonly "$1" printf x=1 then | --verbose -eu printf readonly
+		then 'quoted text' "$1" ${HOME} printf printf export && 2>/dev/null -eu
+	| "$@" awk cd echo "$1" sed /usr/bin 'quoted text' local readonly x=1 local
+'quoted text' "$1" 'quoted text' cd awk ${HOME} && x=1 export --verbose local grep
+	export awk /usr/bin sed -eu awk "$1" "$@" printf | x=1 test
+		done then "$1" readonly --verbose printf ${HOME} "$@" sed local && ${HOME} cd &&
+	readonly $(pwd) cd echo export -eu $(pwd) ${HOME} sed then sed 'quoted text'
+	done export "$1" grep 'quoted text'
+"$1" awk local printf "$1" local export
+	| printf export "$1" 2>/dev/null && && echo cd awk printf local echo done |
+$(pwd) x=1 "$1" "$1" awk | test echo ${HOME} printf echo grep done
+	awk "$1" "$@" | x=1 x=1 export printf export --verbose local export
+grep export done $(pwd) "$1" export local test local x=1 "$@"
+		test | printf then local local export "$@" $(pwd)
+		2>/dev/null -eu readonly | readonly 2>/dev/null && "$@" ${HOME} "$1" && awk x=1
+		'quoted text' ${HOME} printf printf "$1" cd test
+"$1" 2>/dev/null grep done test grep ${HOME} --verbose 2>/dev/null --verbose
+		readonly ${HOME} "$1" printf
+	/usr/bin --verbose printf cd then "$@" cd x=1 --verbose x=1 grep done
+	export ${HOME} -eu 'quoted text'
+	--verbose 'quoted text' printf grep 'quoted text' readonly sed
+done awk readonly 'quoted text' | /usr/bin 'quoted text'
+test printf then 'quoted text' $(pwd) cd grep export | ${HOME} /usr/bin
+	$(pwd) sed grep readonly --verbose -eu
+	x=1 ${HOME} awk -eu -eu echo -eu x=1 export export awk /usr/bin $(pwd)
+		| then 'quoted text' | export -eu | -eu cd test
+	then && sed awk grep printf
+x=1 echo cd awk test && && cd | done local
+	-eu echo | grep -eu "$@" cd && readonly -eu
+		$(pwd) cd x=1 local /usr/bin && x=1
+		$(pwd) local 2>/dev/null sed $(pwd)
+		2>/dev/null && $(pwd) printf | awk readonly awk $(pwd) ${HOME} awk grep
+		"$@" test then echo local 2>/dev/null printf awk test $(pwd)
+	'quoted text' echo grep printf printf sed printf awk cd "$1"
+	test readonly readonly --verbose $(pwd) x=1 && 'quoted text' then printf /usr/bin
+"$1" "$@" $(pwd) "$@" printf && "$1" sed cd then local | sed printf
+		awk readonly readonly test "$@" "$@" 2>/dev/null "$@" done
+"$@" $(pwd) awk printf cd | awk sed test readonly awk readonly
+done test cd local printf "$@" 'quoted text' cd local
+		sed printf echo grep | then --verbose sed then x=1
+"$1" export test readonly
+	sed awk cd export -eu "$@" x=1 && "$@" --verbose
+#include c210.sh
+printf export /usr/bin cd ${HOME} | | readonly
+	printf awk then ${HOME} readonly | "$@"
+echo "$@" 2>/dev/null then then && test cd test && test "$@" local awk
+		${HOME} x=1 export $(pwd) "$1" --verbose
+		| -eu sed --verbose $(pwd) export 'quoted text' /usr/bin 2>/dev/null ${HOME}
+		cd sed "$@" ${HOME} local awk cd | "$@" x=1
+echo local then grep --verbose printf 2>/dev/null x=1
+		echo "$1" test then "$1" then "$@" $(pwd)
+'quoted text' --verbose ${HOME} export then printf cd printf
+$(pwd) export ${HOME} echo readonly 'quoted text' echo && 'quoted text'
+	/usr/bin | echo export /usr/bin "$@" grep --verbose
+readonly local "$@" 2>/dev/null | cd --verbose 'quoted text'
+		| && export local -eu sed /usr/bin ${HOME} && ${HOME} then sed --verbose awk
+		"$1" ${HOME} | /usr/bin ${HOME} -eu awk | "$@" printf grep
+	awk grep grep "$1" ${HOME} | -eu cd && 2>/dev/null -eu -eu "$@" sed |
+	done test printf /usr/bin 2>/dev/null awk
+		then "$@" echo "$1" awk awk && && printf "$@" sed -eu
+	"$1" /usr/bin | export | x=1 "$1" 2>/dev/null readonly --verbose --verbose
+		| | then cd x=1 "$@" cd && 2>/dev/null 'quoted text' echo -eu -eu awk
+'quoted text' "$1" echo printf grep | sed --verbose "$@" x=1 readonly
+	readonly --verbose ${HOME} ${HOME} 2>/dev/null sed sed printf
+		printf echo ${HOME} readonly
+x=1 grep | $(pwd) awk local --verbose awk
+'quoted text' /usr/bin then grep /usr/bin printf printf cd
+		"$1" awk echo && 'quoted text' test
+		printf ${HOME} awk 'quoted text'
+	--verbose local cd awk 2>/dev/null ${HOME} done | 'quoted text' then x=1 then
+	'quoted text' -eu | /usr/bin
+		printf printf echo $(pwd)
+	echo cd "$@" "$@" test $(pwd) ${HOME} --verbose && $(pwd) local readonly
+	-eu | export && --verbose
+grep --verbose printf sed
+	printf "$1" "$1" "$@" x=1 --verbose
+local --verbose export /usr/bin readonly "$@"
+printf sed local awk $(pwd)
+	"$@" then test | cd export 'quoted text'
+		cd sed echo readonly then printf && export && && grep grep
+	${HOME} readonly ${HOME} && 'quoted text' && printf sed printf
+		cd "$@" local then then
+	cd sed | echo readonly $(pwd) --verbose echo && then "$@"
+cd 2>/dev/null "$@" ${HOME} cd test --verbose $(pwd)
+-eu cd && then export && --verbose --verbose
+		$(pwd) "$@" echo done && export "$@" grep done local done then sed |
+echo -eu ${HOME} done /usr/bin done export local "$@" x=1 cd printf
+		$(pwd) local cd --verbose -eu 'quoted text' test -eu readonly echo | done
+	test sed test then -eu ${HOME} 'quoted text'
+| done 2>/dev/null | cd done printf printf 2>/dev/null --verbose
+	"$@" "$1" --verbose 'quoted text' local ${HOME} 2>/dev/null export
+done /usr/bin awk done && x=1 ${HOME} done x=1 "$1" $(pwd) local awk | export ${HOME}
+	export 2>/dev/null 2>/dev/null --verbose echo "$@" --verbose
+2>/dev/null 2>/dev/null export -eu grep export
+${HOME} /usr/bin --verbose
+	done 'quoted text' readonly local
+		test then readonly "$@" /usr/bin cd "$@" printf $(pwd)
+	| /usr/bin x=1 grep "$1"
+	then --verbose 'quoted text' "$@" $(pwd) 'quoted text' done | then ${HOME}
+	readonly "$1" 2>/dev/null cd "$1"
+		awk cd sed | --verbose ${HOME} local | test printf then sed 2>/dev/null
+then 2>/dev/null x=1 cd done | "$@" readonly --verbose test export
+x=1 2>/dev/null test --verbose && /usr/bin done sed
+	--verbose x=1 test sed ${HOME} readonly local x=1 "$@" test 2>/dev/null
+		"$1" && local /usr/bin then | "$1" printf
+sed done printf | && printf $(pwd) echo
+done "$1" "$1" cd /usr/bin readonly |
+		test export printf 'quoted text' --verbose test then "$@" "$@" -eu
+		local cd printf printf 2>/dev/null 2>/dev/null "$1"
+		awk 2>/dev/null test --verbose echo awk printf printf readonly
+--verbose /usr/bin local printf 'quoted text'
+	done grep cd "$@" --verbose 2>/dev/null -eu | -eu
+		then cd | -eu $(pwd) done export
+	-eu sed cd --verbose && grep test --verbose export local local $(pwd)
+"$1" && local export printf
+		-eu grep sed 'quoted text' | "$@" awk awk -eu printf && local printf
+	awk cd test cd /usr/bin done x=1 awk 'quoted text' x=1 then grep -eu | "$@" ${HOME}
+readonly /usr/bin 'quoted text'
+	export export done done "$1" printf grep 2>/dev/null echo -eu echo && cd local
+$(pwd) sed "$@" test && | test --verbose
+		awk printf echo /usr/bin --verbose -eu /usr/bin && -eu
+"$@" "$@" readonly grep 2>/dev/null "$1" readonly
+	readonly sed 'quoted text' -eu
+| "$1" 2>/dev/null ${HOME} echo 2>/dev/null -eu x=1 /usr/bin
+	| 'quoted text' /usr/bin
+	$(pwd) x=1 cd -eu printf readonly
+		"$@" 2>/dev/null 2>/dev/null cd x=1 "$1" test printf awk "$@"
+echo grep echo then /usr/bin "$@" echo
+		awk done done cd printf
+$(pwd) test 2>/dev/null 2>/dev/null "$@"
+readonly --verbose local grep 'quoted text'
+	| | "$1" x=1 then export "$@" then 2>/dev/null
+	--verbose echo x=1 sed | "$1" then then done then test then
+		${HOME} "$@" done /usr/bin /usr/bin export export "$1" test local && | "$@" ${HOME}
+		| 2>/dev/null test grep test test x=1 test
+		cd cd ${HOME} "$@" local
+	/usr/bin awk readonly &&
+&& cd echo | sed /usr/bin grep x=1 'quoted text' 2>/dev/null
+	local then then "$1" /usr/bin test sed | cd 2>/dev/null
+	--verbose x=1 then /usr/bin 'quoted text' then 'quoted text' /usr/bin
+${HOME} test $(pwd) echo readonly sed done -eu test "$1"
+		/usr/bin "$@" local test 'quoted text'
+export echo awk $(pwd) printf then /usr/bin | then --verbose
+		"$@" 'quoted text' 2>/dev/null
+	test x=1 readonly $(pwd) then sed | && local x=1 && cd "$1"
+		| echo printf cd 2>/dev/null test test grep grep 2>/dev/null
+		&& | done cd -eu && -eu cd grep printf awk awk
+	/usr/bin 'quoted text' done 'quoted text' then "$@" echo
+/usr/bin 2>/dev/null sed "$1" | grep ${HOME} 2>/dev/null -eu && grep &&
+		${HOME} $(pwd) 2>/dev/null grep $(pwd) 'quoted text' export x=1 'quoted text'
+| "$@" -eu sed local $(pwd) /usr/bin awk printf
+	-eu && grep ${HOME} && $(pwd) cd 'quoted text' sed /usr/bin /usr/bin
+		then -eu printf && "$1" export readonly && 'quoted text' test cd -eu
+		grep local "$@" 'quoted text'
+		/usr/bin test local awk && ${HOME} 'quoted text' grep sed "$1" 2>/dev/null
+test $(pwd) printf awk "$1" grep readonly
+"$1" /usr/bin | grep -eu 'quoted text' /usr/bin x=1 "$@" 'quoted text'
+	local local readonly local then /usr/bin "$1" /usr/bin |
+local --verbose --verbose echo grep then readonly x=1 export -eu
+	sed | x=1 2>/dev/null awk cd x=1 ${HOME} | "$1" sed awk export
+		${HOME} sed local local local printf | local "$@" grep done /usr/bin
+	$(pwd) export && done 2>/dev/null export ${HOME} test | "$1" "$1" awk sed echo
+local $(pwd) "$@" 'quoted text' -eu | "$@" done | done | done cd "$@"
+"$1" --verbose $(pwd) local
+		local --verbose "$1" test grep done sed awk 'quoted text' | "$1" "$1"
+	done $(pwd) 2>/dev/null "$1" $(pwd) then &&
+--verbose 2>/dev/null export "$1" echo "$@" echo /usr/bin test
+		readonly x=1 -eu "$1" ${HOME} 'quoted text' "$@" x=1
+		2>/dev/null "$1" | grep /usr/bin
+	/usr/bin 'quoted text' done "$@" && test
+	printf 'quoted text' then -eu /usr/bin -eu sed export done
+		then then 2>/dev/null "$1" sed "$1" awk printf
+		awk local $(pwd) then --verbose ${HOME} $(pwd) export test ${HOME}
+$(pwd) printf 'quoted text' 'quoted text' awk x=1 -eu 'quoted text' cd
+	sed readonly export 2>/dev/null
+		"$1" sed && --verbose then | -eu then echo ${HOME} echo "$@" $(pwd)
+		awk echo 2>/dev/null "$1"
+--verbose -eu "$@" $(pwd) "$@" 'quoted text' then --verbose local then
+	${HOME} local ${HOME} -eu grep
+		awk "$1" export "$@" local local grep
+${HOME} sed done awk grep ${HOME} $(pwd) | echo
+export printf printf && echo "$@" sed local grep sed test grep
+| then "$@" readonly echo export -eu
+		--verbose --verbose | readonly export export -eu && && 2>/dev/null 2>/dev/null
+		2>/dev/null test then readonly cd "$@" grep echo && 2>/dev/null "$@"
+| grep export readonly
+	"$@" --verbose --verbose && readonly | test test | echo echo echo --verbose
+	echo /usr/bin | && export cd 'quoted text' test test
+		'quoted text' 2>/dev/null "$1" "$1" awk ${HOME}
+done cd awk test done "$@" test -eu done ${HOME} -eu cd then
+	printf && export | && sed done --verbose
+printf 2>/dev/null test grep sed echo ${HOME} 2>/dev/null
+		awk "$@" awk cd $(pwd) -eu
+		2>/dev/null /usr/bin test readonly
+		/usr/bin export "$@" -eu printf 'quoted text' ${HOME} grep echo
+		grep local done then export $(pwd) echo
+	$(pwd) readonly | done "$@" readonly export printf export
+-eu printf echo test then
+		awk local -eu awk && readonly "$@" | awk grep $(pwd) readonly /usr/bin
+	export grep 2>/dev/null $(pwd) readonly
+	&& 2>/dev/null then printf && $(pwd) local readonly
+		test --verbose local | 2>/dev/null local printf x=1 sed 'quoted text'
+	sed "$1" -eu printf --verbose "$@" "$1" 2>/dev/null
+sed -eu cd export awk x=1 done awk x=1 x=1 'quoted text'
+		printf cd --verbose printf local cd "$1" "$@" ${HOME} then x=1 local
+echo ${HOME} 'quoted text'
+done grep cd grep sed grep ${HOME} | -eu | $(pwd) awk then 2>/dev/null
+		${HOME} "$@" done echo -eu /usr/bin export 'quoted text' cd
+${HOME} done sed local then -eu
+echo test && local cd $(pwd) $(pwd) export | && cd done done
+	${HOME} awk "$1" then && $(pwd) && && /usr/bin cd && printf local cd
+	2>/dev/null awk export -eu local $(pwd)
+	printf grep done 2>/dev/null ${HOME} "$1" | printf /usr/bin
+local done done local cd | then 2>/dev/null cd
+		"$@" $(pwd) /usr/bin export
+		"$1" $(pwd) then local awk sed | --verbose printf done --verbose --verbose
+	export && test local
+		local sed local export test 'quoted text'
+	$(pwd) /usr/bin awk sed ${HOME} printf echo local awk /usr/bin
+then | sed -eu echo test -eu ${HOME} && printf "$@" export readonly x=1
+		local | awk --verbose "$@" | "$@" | sed readonly awk local
+	| "$1" test cd echo grep "$@" | | -eu cd 'quoted text'
+	'quoted text' local x=1 x=1 && readonly
+		done 'quoted text' export && ${HOME} | 2>/dev/null done export
+&& grep local $(pwd) x=1 "$@" "$@" "$@" 2>/dev/null ${HOME} sed "$1"
+	${HOME} grep "$1" echo && echo
+awk printf grep 2>/dev/null done --verbose export "$@"
+	grep /usr/bin then then 'quoted text' grep ${HOME}
+		| 2>/dev/null "$@" "$@" "$@"
+		then grep readonly test --verbose --verbose 2>/dev/null local grep done "$@" 'quoted text'
+	cd done local cd "$1" $(pwd) readonly ${HOME} "$1" printf grep awk &&
+	cd test ${HOME} done /usr/bin awk printf printf --verbose /usr/bin
+		2>/dev/null echo 'quoted text' export local
+		"$@" $(pwd) x=1 readonly 2>/dev/null
+export export "$@" -eu grep sed | local cd "$@" cd x=1 done -eu "$@" test
+	done /usr/bin ${HOME} cd grep --verbose sed
+	done -eu printf "$1" test /usr/bin export awk echo
+	'quoted text' /usr/bin cd 'quoted text' /usr/bin then "$1"
+		"$@" 2>/dev/null ${HOME} grep && then 'quoted text' 2>/dev/null
+awk ${HOME} $(pwd) "$1" cd test -eu
+readonly readonly | /usr/bin local echo -eu printf printf 2>/dev/null 2>/dev/null
+export printf echo 'quoted text' /usr/bin -eu echo done && -eu test | readonly
+		"$@" export x=1 "$1" && 2>/dev/null -eu --verbose then
+	--verbose 2>/dev/null grep cd cd sed "$1" export test awk local
+		-eu cd test 'quoted text'
+		test echo awk test -eu awk x=1 printf && printf
+	"$@" && 'quoted text' && printf test ${HOME} then 'quoted text' 'quoted text'
+	echo && --verbose test export done done $(pwd) awk --verbose $(pwd)
+-eu "$@" then ${HOME}
+	| x=1 done /usr/bin && sed export $(pwd) 'quoted text' done
+		| --verbose grep export printf "$@"
+		export 2>/dev/null 'quoted text' export
+	export x=1 x=1 export $(pwd)
+$(pwd) | && "$@" x=1 sed grep cd /usr/bin "$@" done then awk grep
+	cd then $(pwd) local printf && cd | 2>/dev/null --verbose x=1 test
+	echo sed 'quoted text' | cd 2>/dev/null
+		export 2>/dev/null "$1" test export test "$1" && "$1"
+		"$@" printf $(pwd) then readonly readonly test
+		readonly then x=1 cd /usr/bin printf x=1 grep -eu -eu x=1 local -eu done
+	&& && readonly 2>/dev/null awk x=1 then | cd then
+	&& | then local export $(pwd) x=1 $(pwd) cd --verbose
+'quoted text' /usr/bin readonly | awk done export test ${HOME}
+		test 'quoted text' local then sed "$1" test printf local 2>/dev/null
+		"$@" test 'quoted text' echo --verbose awk | x=1 done "$@" export local cd 'quoted text'
+	echo printf "$@" /usr/bin printf ${HOME} x=1 ${HOME} sed ${HOME}
+	then done x=1 sed readonly x=1 2>/dev/null test
+	--verbose 'quoted text' test -eu --verbose $(pwd) echo && test "$@" test
+x=1 -eu local 'quoted text' "$1" readonly test awk
+	&& "$@" export echo -eu && local
+		'quoted text' echo local 'quoted text' ${HOME} -eu --verbose
+		echo | --verbose grep done echo local done echo 2>/dev/null -eu sed cd 'quoted text'
+	$(pwd) then $(pwd) readonly readonly then "$1" 2>/dev/null then "$1" --verbose
+	sed "$@" test x=1 echo
+printf 'quoted text' 'quoted text' x=1
+		"$1" 'quoted text' "$1" ${HOME} | sed "$1"
+	local grep sed && awk /usr/bin
+		2>/dev/null export readonly then echo && /usr/bin echo printf /usr/bin ${HOME} -eu
+printf | done ${HOME} --verbose 2>/dev/null
+readonly --verbose awk | readonly "$@" 2>/dev/null sed ${HOME}
+		-eu --verbose local -eu /usr/bin
+		"$1" readonly printf test grep |
+		--verbose 'quoted text' ${HOME}
+test readonly cd echo readonly local cd then x=1 echo
+		readonly grep 2>/dev/null awk test test "$1" done "$1" grep awk awk
+${HOME} && 'quoted text' ${HOME} && $(pwd) done local "$1" /usr/bin echo grep
+readonly 'quoted text' awk 'quoted text' done
+$(pwd) && then awk echo -eu ${HOME}
+	'quoted text' grep test cd --verbose awk "$@" done
+	done 'quoted text' local /usr/bin cd $(pwd)
+		x=1 readonly $(pwd) -eu ${HOME} export sed "$1" -eu printf 'quoted text' "$1"
+		export x=1 2>/dev/null awk
+	cd printf local test /usr/bin grep 'quoted text' readonly
+		&& $(pwd) cd $(pwd) grep done local 2>/dev/null 2>/dev/null | grep --verbose
+	"$@" test local /usr/bin then done done | printf
+		x=1 "$1" "$1" then printf cd x=1 done -eu readonly readonly 'quoted text'
+		local sed cd export --verbose && then sed test echo
+done "$1" /usr/bin done | | && | cd "$@" awk done test echo
+		local ${HOME} echo sed sed "$1" readonly x=1 ${HOME}
+	printf && 2>/dev/null "$1" /usr/bin -eu x=1 export cd done --verbose awk
+		"$@" test x=1 -eu then printf && x=1 grep $(pwd) x=1
+		printf local then 'quoted text'
+		sed "$1" cd printf then $(pwd) -eu "$@" local "$@" export printf
+x=1 -eu local printf printf "$1" 2>/dev/null
+	sed "$@" sed && $(pwd) | test ${HOME} -eu awk awk then && ${HOME} "$@"
+		| -eu "$@" done "$1" sed awk export $(pwd) 'quoted text' -eu ${HOME} && x=1
+	--verbose then && sed
+	&& "$1" done && cd done local --verbose
+	${HOME} && "$1" awk 2>/dev/null local cd export awk local /usr/bin
+grep then -eu --verbose
+export 'quoted text' then ${HOME}
+		cd printf "$@" ${HOME}
+'quoted text' echo ${HOME} /usr/bin then $(pwd) grep --verbose
+awk 2>/dev/null grep /usr/bin local test test | ${HOME} | sed grep /usr/bin --verbose
+| ${HOME} local /usr/bin && "$@" /usr/bin
+	export printf ${HOME} echo echo export /usr/bin /usr/bin
+		/usr/bin && /usr/bin ${HOME} printf sed then
+then awk echo "$@" cd x=1 && /usr/bin "$@" /usr/bin local readonly
+	test readonly readonly /usr/bin -eu x=1
+	--verbose cd then x=1 readonly 2>/dev/null && printf then echo "$@" test
+	done -eu printf then export
+/usr/bin | then "$@" printf ${HOME} && 'quoted text'
+		${HOME} readonly "$1" export
+	'quoted text' printf local | test export 'quoted text'
+	cd awk | then done echo cd | --verbose "$1" ${HOME} test done /usr/bin test
+	'quoted text' 2>/dev/null then printf printf
+		'quoted text' sed grep grep x=1 "$@"
+x=1 grep && cd --verbose printf printf ${HOME}
+	sed printf | "$1" done x=1 ${HOME} "$1" --verbose "$1" export
+		echo x=1 test 2>/dev/null 2>/dev/null --verbose
+		&& -eu | export -eu 'quoted text' done --verbose then echo sed ${HOME} test
+		&& -eu $(pwd) && test ${HOME} && 2>/dev/null
+	/usr/bin 2>/dev/null printf 2>/dev/null
+export 'quoted text' | sed 2>/dev/null sed 'quoted text'
+sed "$@" -eu --verbose && --verbose | ${HOME} local ${HOME} && ${HOME} 2>/dev/null
+	"$1" awk && cd | cd -eu sed grep grep sed then cd x=1 sed grep then
+	sed "$@" grep test "$@" $(pwd) --verbose
+--verbose ${HOME} $(pwd) echo sed done x=1 /usr/bin echo "$@" cd -eu done then
+		sed x=1 cd $(pwd) | | ${HOME} done grep sed ${HOME} $(pwd) -eu
+		done && then /usr/bin readonly test
+		cd then /usr/bin "$1" 'quoted text' readonly
+	-eu then 2>/dev/null awk printf
+sed done then /usr/bin | local ${HOME} -eu readonly echo printf -eu x=1 $(pwd)
+		test awk | "$@" x=1 "$1"
+	local ${HOME} done 'quoted text' export "$@"
+	x=1 2>/dev/null | ${HOME} done "$@" 2>/dev/null $(pwd) --verbose done --verbose
+		'quoted text' 2>/dev/null $(pwd) "$@" | then ${HOME} then --verbose
+	done cd 'quoted text' /usr/bin
+x=1 echo -eu x=1 -eu readonly "$1" $(pwd)
+awk 2>/dev/null local awk then cd && 2>/dev/null | local
+$(pwd) 2>/dev/null && echo ${HOME} sed --verbose local 'quoted text' /usr/bin
+		grep test cd then done export sed | 2>/dev/null $(pwd) $(pwd) readonly then 'quoted text'
+awk 2>/dev/null echo $(pwd) then grep export sed -eu
+		"$1" x=1 cd printf /usr/bin readonly sed grep 2>/dev/null
+	'quoted text' ${HOME} local "$1" 2>/dev/null $(pwd) ${HOME} $(pwd) | echo
+		grep done 'quoted text' printf --verbose ${HOME}
+	local 'quoted text' printf sed /usr/bin && $(pwd) x=1 export readonly
+	&& 2>/dev/null printf && grep local --verbose ${HOME} readonly test
+2>/dev/null /usr/bin | 'quoted text' readonly ${HOME} sed
+	test 2>/dev/null "$1" local $(pwd) local awk echo | /usr/bin "$1" printf
+		printf awk test readonly /usr/bin "$@" | | export test /usr/bin
+"$1" local && awk sed export printf /usr/bin 'quoted text' &&
+		cd -eu local cd 'quoted text' 'quoted text' 2>/dev/null
+		${HOME} "$@" test sed readonly grep then
+2>/dev/null awk /usr/bin cd then && x=1 cd --verbose x=1 test export 2>/dev/null
+awk 2>/dev/null echo "$1" 2>/dev/null test sed readonly
+printf /usr/bin then | 'quoted text' test /usr/bin
+	local done export /usr/bin echo --verbose $(pwd) then printf test --verbose --verbose
+		"$@" echo 2>/dev/null $(pwd) "$@" "$1" export
+	awk && echo done awk 2>/dev/null
+	--verbose cd then "$@" --verbose echo done local /usr/bin 'quoted text'
+		then sed echo readonly "$1" | awk | | done local done sed done then "$@"
+echo x=1 $(pwd) "$@" 2>/dev/null ${HOME} echo --verbose
+printf printf --verbose /usr/bin "$@" echo && export
+	"$@" echo "$@" 2>/dev/null done awk "$@" 'quoted text'
+		sed -eu grep && test test "$1" export printf
+		sed && ${HOME} test local "$@" local $(pwd)
+	2>/dev/null x=1 awk grep test /usr/bin readonly
+		"$1" done 'quoted text' test grep local
+	readonly readonly | printf 2>/dev/null &&
+	--verbose /usr/bin $(pwd) then readonly test -eu readonly x=1 readonly 2>/dev/null
+cd x=1 export 2>/dev/null export
+printf done ${HOME} 2>/dev/null sed -eu "$1" done --verbose echo x=1 grep
+	&& test -eu awk printf test ${HOME} x=1 "$@" grep x=1 local "$@"
+		${HOME} readonly local grep awk export echo done | export sed done
+		echo awk ${HOME} sed $(pwd) ${HOME} sed awk /usr/bin
+readonly && printf awk printf
+	/usr/bin test -eu export ${HOME}
+	local 2>/dev/null /usr/bin | -eu sed printf export "$@" ${HOME} test "$1"
+done then && 'quoted text'
+x=1 --verbose done grep local $(pwd) ${HOME} 'quoted text' | cd awk
+		$(pwd) test && 'quoted text' echo --verbose local --verbose
+&& cd "$@" export /usr/bin /usr/bin --verbose "$@" $(pwd)
+		"$1" grep awk local local
+	"$1" x=1 export awk $(pwd) && && cd -eu test readonly /usr/bin 2>/dev/null
+	&& awk | /usr/bin "$@" &&
+		done "$@" && export /usr/bin -eu 2>/dev/null /usr/bin readonly grep echo $(pwd)
+		cd $(pwd) then cd "$@" export done echo grep 'quoted text' cd "$1"
+2>/dev/null | --verbose sed cd ${HOME} x=1 then 2>/dev/null echo
+		--verbose export sed $(pwd) ${HOME}
+		&& --verbose local "$@" --verbose awk ${HOME} "$@" 2>/dev/null /usr/bin cd then
+		2>/dev/null x=1 | export readonly
+/usr/bin local 'quoted text' grep test x=1 awk
+	"$1" 'quoted text' done then x=1 -eu $(pwd)
+sed grep "$@" ${HOME} 2>/dev/null
+		done "$@" done then grep x=1 x=1 sed test done --verbose grep sed grep awk
+	2>/dev/null then export
+readonly -eu grep readonly readonly done test 'quoted text' echo "$1"
+cd "$1" --verbose ${HOME} readonly grep test | cd /usr/bin
+	'quoted text' && grep | local grep 'quoted text'
+$(pwd) grep 'quoted text' --verbose cd test -eu then x=1
+	2>/dev/null -eu test then x=1 then ${HOME} "$1" $(pwd) export 'quoted text'
+	${HOME} --verbose ${HOME} 2>/dev/null then $(pwd) test --verbose
+'quoted text' test -eu -eu 2>/dev/null grep x=1 then local awk done "$1"
+	printf /usr/bin echo readonly "$1" local "$@" ${HOME} readonly
+		printf grep echo test readonly readonly printf grep --verbose
+		local done local export 'quoted text' 2>/dev/null
+		local -eu printf /usr/bin "$1"
+sed "$1" $(pwd) test readonly then cd --verbose x=1
+		export 'quoted text' echo 'quoted text' done
+-eu "$1" "$@" -eu echo readonly awk 2>/dev/null awk "$1" test 2>/dev/null
+	grep done && test sed "$1" 'quoted text' done local grep
+		test | sed awk "$@" sed export readonly 'quoted text'
+		| grep 'quoted text' local printf
+	&& --verbose /usr/bin --verbose printf then printf
+readonly grep ${HOME} done
+	then grep x=1 cd "$1" done "$1" 2>/dev/null 2>/dev/null test ${HOME}
+-eu echo test cd sed
+		cd /usr/bin readonly x=1 test x=1 -eu 'quoted text' 'quoted text' "$@" then
+		cd grep /usr/bin printf export $(pwd)
+		--verbose x=1 grep done x=1 local sed "$@" test then -eu $(pwd) | local test
+	printf sed printf grep "$@" grep /usr/bin && | done cd test -eu readonly
+	export test grep test && awk then readonly -eu 2>/dev/null 2>/dev/null --verbose
+2>/dev/null cd ${HOME} awk -eu $(pwd) readonly test $(pwd) local ${HOME}
+	export /usr/bin sed 2>/dev/null "$@" echo awk /usr/bin
+sed /usr/bin | -eu cd awk test -eu /usr/bin
+		| x=1 then readonly readonly test 'quoted text'
+	-eu then then -eu local done local --verbose 2>/dev/null local readonly local
+echo readonly export 2>/dev/null then export ${HOME} then 2>/dev/null
+then then "$1" sed test "$1" ${HOME} then echo -eu -eu then
+awk echo echo sed echo -eu ${HOME}
+local test printf ${HOME} grep --verbose echo test && test local ${HOME}
+$(pwd) grep x=1 export then --verbose sed local "$@" --verbose
+	test 'quoted text' cd && | then --verbose
+		2>/dev/null | echo echo 2>/dev/null
+then grep $(pwd) sed local
+	cd test sed echo awk sed --verbose --verbose --verbose grep -eu 'quoted text'
+	-eu "$1" grep then then | | printf 'quoted text' | 2>/dev/null
+printf export readonly awk 'quoted text' printf -eu $(pwd) "$1" cd grep grep
+		readonly local then readonly local "$@" done 2>/dev/null && "$@" export
+	x=1 /usr/bin then $(pwd)
+readonly && | export export 2>/dev/null done readonly /usr/bin
+	awk cd printf then cd export echo
+		$(pwd) echo --verbose
+	grep | awk "$@" && -eu | "$1" | "$1" --verbose $(pwd) echo 2>/dev/null
+		awk grep printf ${HOME} export readonly x=1 done --verbose local | 2>/dev/null
+		printf done echo "$1" grep done 2>/dev/null printf cd cd 'quoted text'
+'quoted text' /usr/bin printf --verbose -eu awk --verbose echo
+export test /usr/bin test ${HOME} then $(pwd) then
+	echo sed "$@" then && echo ${HOME} "$@"
+		&& $(pwd) readonly echo awk cd | --verbose
+--verbose "$1" /usr/bin 'quoted text'
+printf then 2>/dev/null x=1 printf sed && /usr/bin then local
+		2>/dev/null "$1" grep echo grep "$1" -eu readonly printf "$@" printf then
+		printf 'quoted text' echo 'quoted text' -eu
+		-eu "$1" grep sed --verbose echo 'quoted text'
+-eu test | cd -eu "$1" ${HOME} ${HOME}
+${HOME} then 'quoted text'
+"$@" 'quoted text' ${HOME}
+${HOME} -eu local awk "$@" $(pwd) x=1 && /usr/bin
+		&& --verbose "$1" done && -eu x=1 x=1 export /usr/bin echo export | "$@"
+		$(pwd) $(pwd) $(pwd) --verbose printf
+grep grep /usr/bin x=1
+		export local then "$1" $(pwd) done export echo --verbose $(pwd) ${HOME}
+	sed $(pwd) export 'quoted text'
+		$(pwd) cd "$1" /usr/bin readonly local "$@" done --verbose readonly /usr/bin
+	sed then local test | && "$@"
+test "$1" echo "$1" "$@" echo | ${HOME} "$1" test local 'quoted text' "$1"
+		"$1" printf local echo export cd 2>/dev/null
+	x=1 done -eu "$@" 'quoted text' --verbose cd test export
+${HOME} test $(pwd) local export
+	/usr/bin | "$1" ${HOME} export awk $(pwd)
+		&& | export "$@" then "$1" "$@" ${HOME}
+	then local $(pwd) sed 'quoted text' ${HOME} --verbose readonly readonly /usr/bin
+		local --verbose 2>/dev/null
+	test && $(pwd) awk x=1 /usr/bin /usr/bin ${HOME} $(pwd) $(pwd) "$@" echo export
+2>/dev/null /usr/bin ${HOME}
+done printf sed "$@" | /usr/bin grep
+	printf export /usr/bin grep /usr/bin
+"$1" test "$@" awk 'quoted text' /usr/bin x=1 --verbose "$@" 2>/dev/null
+		test "$@" 'quoted text'
+	then "$1" ${HOME} done readonly "$@" awk && --verbose | echo -eu readonly test "$1"
+		-eu export grep export sed --verbose 2>/dev/null
+2>/dev/null export done done && && x=1 2>/dev/null --verbose then
+readonly grep $(pwd) sed echo echo
+		echo /usr/bin local echo $(pwd) x=1 sed 2>/dev/null
+	$(pwd) then 2>/dev/null then test "$@" /usr/bin
+	/usr/bin -eu ${HOME} local "$@" && grep done
+	cd printf --verbose /usr/bin && ${HOME} "$@" x=1 $(pwd) | $(pwd)
+		cd "$1" && readonly cd grep $(pwd) 2>/dev/null x=1 ${HOME} 'quoted text'
+$(pwd) 2>/dev/null -eu cd $(pwd)
+		2>/dev/null && | && -eu then "$@" awk x=1 | $(pwd) export done then ${HOME} "$@"
+readonly 'quoted text' then x=1 "$1" printf x=1 sed test 'quoted text' 2>/dev/null
+--verbose "$@" x=1 ${HOME} sed
+--verbose x=1 local | 2>/dev/null
+		readonly export test local
+		echo test | x=1 awk --verbose "$1" test printf
+	| done then ${HOME} && x=1 "$1" 2>/dev/null x=1
+	cd printf 2>/dev/null
+		"$@" cd test test "$@" awk cd x=1 test then awk x=1 --verbose ${HOME}
+	echo "$1" 2>/dev/null awk ${HOME} export
+export cd | 'quoted text' ${HOME} | --verbose then
+test then ${HOME} done "$1" $(pwd) /usr/bin /usr/bin cd test grep awk ${HOME}
+		"$1" -eu -eu 'quoted text' echo /usr/bin local --verbose readonly then test
+local "$@" grep 'quoted text' cd "$@" then 2>/dev/null "$1" then done
+		--verbose "$@" readonly local "$@" awk "$1" "$1" && then printf readonly
+local cd 2>/dev/null local readonly grep
+	/usr/bin $(pwd) 2>/dev/null done 2>/dev/null
+		${HOME} awk ${HOME} test test then /usr/bin && $(pwd)
+${HOME} test --verbose test $(pwd) then | local $(pwd) local grep
+grep cd "$1" "$1" -eu $(pwd) -eu && then "$1" $(pwd) printf cd --verbose then
+test test 2>/dev/null grep $(pwd) "$1" done "$@" "$@" sed
+	/usr/bin readonly awk 2>/dev/null cd cd 2>/dev/null readonly
+	"$@" awk cd -eu x=1 then awk readonly readonly grep && "$@" -eu /usr/bin
+	x=1 2>/dev/null awk export printf then 2>/dev/null cd then
+		local "$1" && awk 2>/dev/null printf $(pwd) ${HOME}
+'quoted text' --verbose cd "$1" then -eu 2>/dev/null "$@" sed printf
+done cd done then sed 'quoted text'
+		cd x=1 "$1" grep sed cd readonly cd cd | 2>/dev/null
+sed --verbose cd $(pwd)
+		test export readonly local echo awk ${HOME} readonly --verbose
+	$(pwd) /usr/bin x=1 | printf ${HOME}
+done export then x=1 cd | -eu local
+	/usr/bin local --verbose then /usr/bin awk then awk test
+	"$@" "$1" && ${HOME} --verbose printf printf local x=1 x=1 && && cd
+		-eu echo grep ${HOME} export x=1
+		"$@" grep 'quoted text' ${HOME} then test $(pwd) sed | -eu export && "$1" $(pwd)
+test ${HOME} cd local test "$1" test export test 2>/dev/null --verbose
+		/usr/bin printf "$@" "$@" awk local export
+	"$@" && local sed x=1 /usr/bin
+then "$1" cd "$1" cd grep readonly export done done
+		/usr/bin $(pwd) x=1 echo awk cd 'quoted text' awk printf /usr/bin sed /usr/bin
+		$(pwd) "$@" awk grep | echo
+		2>/dev/null "$1" x=1 sed cd ${HOME}
+		test test then x=1 grep | readonly awk ${HOME} -eu x=1 && && $(pwd) export export
+	"$@" cd awk local $(pwd) && sed local
+--verbose $(pwd) then /usr/bin ${HOME} grep && $(pwd)
+	echo local done printf test --verbose awk 'quoted text' "$@" --verbose local
+	| 'quoted text' x=1 'quoted text' -eu /usr/bin
+		-eu -eu 'quoted text' /usr/bin awk --verbose && -eu ${HOME} then 'quoted text'
+	"$@" grep export "$1" export -eu 'quoted text' local
+$(pwd) export local "$1" -eu then /usr/bin done -eu -eu |
+		-eu readonly "$1" ${HOME} then sed "$@" sed test
+	"$@" printf | /usr/bin "$@" x=1 $(pwd)
+		&& grep export ${HOME} $(pwd) ${HOME} awk sed "$@" /usr/bin x=1 local
+	then test export && grep /usr/bin
+	sed x=1 && "$@" | cd awk "$@" sed 'quoted text'
+	${HOME} -eu test "$1" 'quoted text' grep done
+	test 2>/dev/null echo "$@"
+2>/dev/null 2>/dev/null test awk && 2>/dev/null
+x=1 2>/dev/null done export cd && -eu --verbose printf "$@" grep "$1" "$1"
+		local && x=1 echo awk 'quoted text' ${HOME} 'quoted text' --verbose
+	| then "$@" test 'quoted text'
+	--verbose local ${HOME} sed 'quoted text'
+		${HOME} cd ${HOME} ${HOME} $(pwd) done x=1 local then local --verbose
+		"$@" 'quoted text' local --verbose 2>/dev/null readonly readonly
+$(pwd) cd awk readonly && 2>/dev/null
+		${HOME} && "$@" $(pwd) grep $(pwd) then
+	"$@" x=1 export grep 'quoted text' export "$1"
+2>/dev/null done "$1" -eu sed awk ${HOME} test awk "$1" "$1" export ${HOME}
+awk printf | local local /usr/bin echo test /usr/bin echo $(pwd) readonly
+&& done $(pwd) sed test -eu grep then readonly 'quoted text' echo awk | local --verbose
+2>/dev/null export then | && $(pwd) cd printf awk --verbose x=1 -eu
+local echo echo x=1 sed cd --verbose awk "$@" $(pwd) --verbose
+		/usr/bin readonly x=1 awk export "$1" export $(pwd) readonly sed local x=1 test
+		$(pwd) echo "$1" grep && "$@" ${HOME} test echo "$1"
+		export -eu && then ${HOME} done sed --verbose local awk sed sed sed x=1
+	-eu "$1" sed -eu printf 'quoted text'
+	${HOME} local done 2>/dev/null done x=1 sed echo && grep export ${HOME}
+2>/dev/null done | cd
+	2>/dev/null -eu "$1" sed sed sed readonly awk "$@" | | --verbose 'quoted text'
+		x=1 /usr/bin --verbose awk local export "$1" printf done grep done
+		-eu && echo export $(pwd) then grep grep && 2>/dev/null
+sed 'quoted text' awk readonly 2>/dev/null echo awk 'quoted text' ${HOME}
+		--verbose && cd | | done done | x=1 local done
+		sed "$1" then --verbose echo && local x=1 awk grep ${HOME} then
+printf --verbose 2>/dev/null
+		echo awk "$1" awk x=1
+		${HOME} then 2>/dev/null cd then /usr/bin grep cd "$1" grep "$1" test echo readonly
+	x=1 awk --verbose grep 2>/dev/null --verbose /usr/bin echo "$1" --verbose
+	export printf --verbose awk grep local local cd /usr/bin 2>/dev/null
+x=1 ${HOME} printf test done ${HOME}
+awk | printf test | local
+	grep -eu ${HOME} printf x=1 && test cd x=1 local awk export
+cd readonly test grep -eu sed ${HOME}
+		printf && $(pwd) readonly export -eu cd "$1" grep readonly
+local awk echo /usr/bin -eu
+		'quoted text' local cd
+	-eu printf then $(pwd) export ${HOME} "$1" -eu then "$1"
+	--verbose printf $(pwd) $(pwd) x=1
+	printf done readonly --verbose
+		done ${HOME} x=1 readonly awk x=1 local readonly
+"$@" grep $(pwd) echo done | ${HOME} local $(pwd) && export && cd -eu echo
+		&& 'quoted text' then local sed done $(pwd) local && "$@" echo /usr/bin
+sed cd grep x=1 readonly $(pwd) awk -eu
+export $(pwd) printf && then x=1
+		-eu | --verbose && $(pwd) local sed -eu "$@" && awk grep 2>/dev/null
+		| | /usr/bin 2>/dev/null done done sed x=1 sed "$@" printf readonly sed cd
+	test cd x=1 2>/dev/null readonly && /usr/bin 2>/dev/null $(pwd) sed local
+		awk ${HOME} ${HOME} cd awk awk --verbose export
+		awk local ${HOME} -eu --verbose export $(pwd) printf -eu 2>/dev/null
+		2>/dev/null -eu 'quoted text' echo printf readonly
+grep test ${HOME} "$1" grep echo x=1 /usr/bin 'quoted text'
+echo grep /usr/bin x=1 awk then printf
+		then && test --verbose "$@" local 'quoted text' test export
+done $(pwd) grep x=1 --verbose test x=1 cd test && cd --verbose "$@"
+		2>/dev/null "$@" ${HOME} -eu
+local cd local export ${HOME} && echo export "$1" x=1 awk sed
+		/usr/bin printf | /usr/bin test readonly test -eu -eu /usr/bin
+	printf then 2>/dev/null x=1 awk grep done cd /usr/bin awk 'quoted text' cd export
+	--verbose export $(pwd) then x=1 test 2>/dev/null --verbose &&
+&& sed 'quoted text' $(pwd) printf done then grep grep local --verbose export
+	echo 2>/dev/null 'quoted text' then then 'quoted text' | printf
+		awk cd done $(pwd) "$@" printf "$@" x=1 --verbose local
+$(pwd) done x=1 | echo "$@" sed 'quoted text'
+	'quoted text' cd "$@" export | export x=1 then readonly grep 'quoted text'
+	${HOME} x=1 "$1" $(pwd) readonly test | then sed "$@" awk -eu 2>/dev/null
+		$(pwd) test ${HOME} /usr/bin -eu "$@" "$1"
+done done /usr/bin cd echo echo printf | readonly
+export ${HOME} -eu echo
+		printf && done grep "$@" --verbose x=1 then
+	done x=1 grep && readonly
+local x=1 && "$@" "$1" sed export ${HOME} && "$@"
+'quoted text' sed then && && 'quoted text'
+	"$1" ${HOME} "$@" "$@" test | then then 'quoted text' /usr/bin sed awk "$@" --verbose
+${HOME} | printf 2>/dev/null | x=1 /usr/bin
+		sed awk printf local readonly x=1 && grep --verbose awk then then ${HOME}
+"$1" "$@" grep printf "$@" /usr/bin 'quoted text' ${HOME} sed local then $(pwd)
+	sed "$@" then awk export "$1" x=1 local
+		/usr/bin x=1 --verbose local echo test then local echo done ${HOME} | local 2>/dev/null
+	-eu local done local test $(pwd) printf awk grep
+-eu --verbose --verbose --verbose /usr/bin local printf
+-eu test then -eu then local | sed export 'quoted text' $(pwd)
+'quoted text' ${HOME} 'quoted text' cd | readonly echo x=1 done
+cd $(pwd) printf grep && cd then | awk
+x=1 done /usr/bin ${HOME} awk
+		| sed readonly echo | grep sed awk grep test local awk 2>/dev/null
+	grep && test 2>/dev/null printf
+		--verbose | -eu export -eu grep then
+		sed printf test then x=1 done readonly
+done --verbose local echo cd readonly --verbose
+test && readonly echo readonly /usr/bin sed
+		2>/dev/null $(pwd) $(pwd) /usr/bin
+x=1 $(pwd) export grep /usr/bin -eu export readonly readonly --verbose
+		2>/dev/null test awk --verbose local $(pwd) done then awk
+		x=1 2>/dev/null && $(pwd)
+/usr/bin test printf echo "$1" x=1 x=1 done
+		/usr/bin awk | readonly ${HOME} | ${HOME} readonly x=1
+	--verbose grep then "$1" printf -eu && "$@" "$@" 2>/dev/null sed done
+2>/dev/null x=1 cd sed awk /usr/bin readonly
+printf local test /usr/bin test test --verbose
+printf 2>/dev/null printf then $(pwd) | printf
+	echo && x=1 | "$1" 2>/dev/null && /usr/bin echo "$1" "$@" grep
+then | --verbose local $(pwd) done -eu awk
+	cd printf test echo printf done printf --verbose 'quoted text' "$@" /usr/bin -eu
+	2>/dev/null grep printf export awk "$1" readonly -eu readonly -eu test "$1"
+	--verbose ${HOME} readonly x=1 "$1" then then "$1" test
+2>/dev/null done $(pwd) ${HOME} /usr/bin
+		echo && 'quoted text' printf -eu local /usr/bin
+echo printf readonly export readonly cd awk x=1 ${HOME} x=1 | $(pwd) test
+		&& && cd ${HOME} sed readonly then test sed "$1" "$1" | done printf cd --verbose
+	"$1" -eu $(pwd) /usr/bin cd printf export
+		--verbose test then && printf "$@" | local test sed export
+	sed echo cd sed "$1" printf awk x=1 awk "$@" printf /usr/bin | --verbose
+	/usr/bin $(pwd) awk then grep 2>/dev/null | | 'quoted text'
+		awk then awk then 2>/dev/null -eu "$1" readonly /usr/bin /usr/bin | grep | printf
+	2>/dev/null readonly 2>/dev/null export /usr/bin | then grep
+	2>/dev/null test then awk local grep /usr/bin
+		2>/dev/null $(pwd) sed 2>/dev/null echo "$1" 2>/dev/null
+	local sed printf 'quoted text' sed
+	cd --verbose echo then && | then
+&& sed /usr/bin then printf local
+${HOME} -eu local $(pwd) ${HOME} test x=1 x=1 "$1" echo
+sed readonly x=1 x=1 grep sed echo test then "$1" printf
+x=1 -eu /usr/bin | done export x=1 readonly
+		awk -eu echo && sed sed then "$@" /usr/bin x=1 "$1" then
+sed && 2>/dev/null printf done readonly
+	| 2>/dev/null awk printf test
+	"$@" then test /usr/bin local export sed grep
+	test 2>/dev/null | printf grep then "$@" cd echo x=1 grep then
+		'quoted text' 2>/dev/null export -eu done
+x=1 --verbose grep echo /usr/bin --verbose "$1" 'quoted text' grep
+	then x=1 && grep test "$1" 2>/dev/null cd cd echo
+"$1" $(pwd) 2>/dev/null echo
+		grep sed "$@" 2>/dev/null x=1 -eu done export test "$1" --verbose /usr/bin /usr/bin
+		done sed sed then grep test | $(pwd) readonly printf printf "$1" && --verbose
+	"$@" cd test 2>/dev/null "$1" readonly ${HOME} grep "$@" sed local ${HOME}
+		/usr/bin 2>/dev/null export --verbose
+| done ${HOME} 2>/dev/null "$1" "$@" then awk |
+done readonly then grep /usr/bin sed 2>/dev/null
+		then done then awk "$@" grep
+	--verbose sed ${HOME} export sed readonly && | x=1
+	2>/dev/null echo cd then readonly
+		done cd | | | echo "$1" -eu echo x=1 awk 2>/dev/null 'quoted text' test
+	--verbose "$@" $(pwd) cd "$@" grep sed --verbose sed "$@" && -eu "$@"
+		| "$@" sed test local -eu then sed --verbose
+		sed 2>/dev/null done --verbose 2>/dev/null
+	--verbose test awk x=1 cd "$1" grep "$1" then 2>/dev/null | 'quoted text'
+printf cd export /usr/bin "$1" echo | "$1" x=1 awk /usr/bin
+		printf | sed "$1" test
+printf then grep then
+	sed awk $(pwd) -eu cd "$1" "$1" done | /usr/bin 'quoted text'
+	x=1 "$@" -eu cd export printf sed /usr/bin
+		sed x=1 "$@" printf done sed --verbose
+	$(pwd) && --verbose readonly grep sed cd echo $(pwd)
+x=1 export grep readonly ${HOME} echo -eu done "$@" printf echo cd
+	"$1" -eu --verbose "$@" echo --verbose x=1 sed awk printf && awk awk test
+	'quoted text' "$@" --verbose 'quoted text' -eu awk readonly
+		export -eu && $(pwd) then echo
+		-eu grep "$@" x=1 then done /usr/bin ${HOME} ${HOME} test printf "$@"
+| 'quoted text' echo cd 'quoted text'
+	grep "$1" export && 'quoted text' | -eu $(pwd) /usr/bin
+		x=1 sed && then local |
+	"$@" readonly grep ${HOME} && cd 2>/dev/null
+	export local "$@" sed 2>/dev/null local 2>/dev/null |
+		"$@" -eu awk cd awk local export && | printf /usr/bin
+		| test 'quoted text' readonly
+	then sed x=1 done readonly | echo export
+		export x=1 ${HOME} sed ${HOME}
+	'quoted text' grep grep "$@" export && awk $(pwd) 2>/dev/null cd printf 'quoted text'
+	awk 'quoted text' cd $(pwd) readonly
+awk then /usr/bin /usr/bin 2>/dev/null
+		local --verbose echo sed $(pwd) grep printf
+"$1" 'quoted text' | readonly export sed ${HOME} --verbose then $(pwd) test cd
+	&& "$@" 'quoted text' then 'quoted text' "$1" 'quoted text'
+		then sed -eu test 2>/dev/null sed printf cd $(pwd) cd $(pwd) printf then echo
+	2>/dev/null local -eu -eu readonly
+	"$@" 'quoted text' echo "$1" /usr/bin grep export
+done sed local then 2>/dev/null cd /usr/bin
+	echo "$1" sed && $(pwd)
+'quoted text' printf 2>/dev/null $(pwd) x=1 2>/dev/null cd sed /usr/bin
+		| grep awk cd printf grep test awk | $(pwd) grep sed "$1" 'quoted text' echo
+		/usr/bin then sed grep export cd test x=1 done readonly then awk
+sed ${HOME} x=1 | printf grep -eu export $(pwd) awk 2>/dev/null
+x=1 cd $(pwd) /usr/bin -eu 'quoted text' --verbose 2>/dev/null readonly
+		$(pwd) -eu 2>/dev/null -eu && export cd printf ${HOME} cd echo "$1" printf
+	awk $(pwd) test local ${HOME} "$1" local grep
+readonly cd && --verbose ${HOME}
+		grep /usr/bin | /usr/bin local && readonly && $(pwd) "$@" test -eu $(pwd) x=1
+	done "$@" export x=1 -eu echo 'quoted text' cd 2>/dev/null -eu done test
+printf -eu local ${HOME} x=1
+		--verbose --verbose -eu $(pwd) ${HOME} test /usr/bin echo printf
+	${HOME} --verbose --verbose "$1" | sed done grep
+		-eu -eu 'quoted text' sed 'quoted text'
+echo x=1 awk grep readonly test sed done then
+		x=1 'quoted text' | readonly
+-eu printf test export --verbose export | ${HOME} $(pwd) ${HOME} readonly
+		test test 2>/dev/null printf $(pwd)
+	$(pwd) /usr/bin sed --verbose
+	readonly awk local "$@" x=1 local local done x=1 /usr/bin
+| local readonly echo echo
+		2>/dev/null local readonly
+	local grep readonly echo echo
+	cd test 2>/dev/null local ${HOME}
+sed readonly export printf $(pwd)
+		-eu done export | | x=1 /usr/bin grep printf
+local /usr/bin && "$1" $(pwd)
+	&& then echo ${HOME} "$1" 'quoted text' $(pwd) x=1 "$1" done sed
+2>/dev/null test && | x=1 local && | x=1 $(pwd) local -eu x=1 'quoted text'
+&& "$@" printf 'quoted text' "$1" local x=1 | -eu echo x=1 'quoted text' $(pwd)
+		"$1" 2>/dev/null && x=1 && &&
+	x=1 grep | x=1 sed readonly readonly 'quoted text' cd "$1" then
+	"$1" "$1" x=1 local then /usr/bin done 'quoted text' 'quoted text' --verbose
+--verbose echo awk -eu sed | x=1 then
+	"$1" | then x=1 "$1" readonly readonly test echo ${HOME} grep && /usr/bin
+	cd export done grep 2>/dev/null export echo x=1 ${HOME} echo printf
+test echo export export "$1" grep printf
+		x=1 grep cd export ${HOME} done -eu 'quoted text'
+then $(pwd) --verbose x=1 awk export export -eu && test
+		then printf ${HOME} printf --verbose export 'quoted text' && sed |
+	/usr/bin export awk cd "$@" readonly grep --verbose
+	done ${HOME} "$@" sed local && $(pwd) test echo 2>/dev/null
+--verbose x=1 awk cd grep cd $(pwd) 'quoted text'
+grep | -eu cd sed x=1 grep 2>/dev/null export && --verbose cd ${HOME} local 2>/dev/null
+	'quoted text' ${HOME} then echo done |
+		awk "$@" /usr/bin then "$1" readonly
+	"$1" -eu | /usr/bin ${HOME} cd grep done
+'quoted text' | cd then | "$1" /usr/bin 2>/dev/null
+	grep -eu local export /usr/bin
+		2>/dev/null awk done 2>/dev/null
+sed readonly ${HOME} | then awk -eu 'quoted text' x=1 then awk done
+		"$@" local "$@" local /usr/bin local grep 'quoted text'
+grep $(pwd) $(pwd) --verbose | --verbose
+	$(pwd) printf printf local && printf && awk ${HOME} ${HOME} awk
+&& done done grep $(pwd)
+	export sed local local grep test echo readonly && | cd --verbose sed printf
+		"$@" readonly "$@" readonly "$1"
+	| $(pwd) 2>/dev/null test "$@" | awk readonly
+	local "$1" export /usr/bin
+-eu test test awk printf grep test -eu "$@" 'quoted text'
+	then "$@" done then cd 'quoted text' awk local | 'quoted text' sed /usr/bin
+echo readonly then 2>/dev/null then "$@" sed ${HOME} echo
+		sed $(pwd) echo "$@" echo "$1" -eu x=1 local cd then
+		$(pwd) /usr/bin | | && printf --verbose local
+test x=1 printf sed printf test | done
+	2>/dev/null test 'quoted text' export
+		x=1 && awk echo then readonly "$1" local local ${HOME}
+	cd -eu x=1 done local && printf test 'quoted text' sed /usr/bin local "$1" --verbose
+	sed local && sed 2>/dev/null grep /usr/bin $(pwd) 2>/dev/null
+		export --verbose readonly local grep local "$@" local
+		&& x=1 local test cd sed "$@" 2>/dev/null -eu sed grep then $(pwd) |
+	awk --verbose done --verbose export
+then 2>/dev/null then x=1 --verbose | /usr/bin "$@" test $(pwd) sed sed done
+	| sed done then done local readonly local export awk && awk echo
+x=1 $(pwd) printf ${HOME} --verbose
+cd sed done && printf test 'quoted text'
+		'quoted text' 2>/dev/null 'quoted text' grep grep then $(pwd) && export local
+		then test --verbose "$@" --verbose -eu $(pwd) | "$1"
+sed grep 'quoted text' | done
+		readonly $(pwd) awk grep test "$@" awk $(pwd) then "$@" 'quoted text' export
+	/usr/bin sed export awk test x=1 grep 'quoted text'
+		x=1 -eu local && grep "$@" export grep "$1" $(pwd) "$1"
+| then export awk local | -eu done echo cd printf 2>/dev/null
+		then --verbose -eu printf
+| cd "$1" x=1 ${HOME} grep test | --verbose x=1 then
+	-eu export --verbose awk "$@" export --verbose 'quoted text' |
+echo "$1" echo && done test "$@" "$@"
+	&& --verbose local "$1" printf done awk test
+local printf 2>/dev/null $(pwd) 2>/dev/null done ${HOME} $(pwd)
+		-eu 'quoted text' test then test 'quoted text' --verbose readonly then
+		readonly x=1 printf "$@" export --verbose cd then readonly
+		readonly sed echo export /usr/bin $(pwd) "$@" && export local $(pwd) grep test
+	2>/dev/null local -eu echo && "$1" /usr/bin | test /usr/bin | then
+x=1 "$@" readonly "$@" && $(pwd) -eu awk awk local | echo grep awk
+	${HOME} local ${HOME} cd awk /usr/bin
+	-eu echo printf && "$1" 'quoted text' "$@" awk x=1
+	"$@" sed 'quoted text' --verbose x=1 echo $(pwd)
+		readonly then ${HOME} test test --verbose -eu /usr/bin $(pwd) && "$1"
+done cd grep awk 2>/dev/null
+--verbose readonly echo /usr/bin sed 2>/dev/null printf $(pwd) local
+then awk readonly "$@" --verbose
+--verbose $(pwd) -eu readonly grep sed cd sed then
+&& 2>/dev/null && sed
+	awk ${HOME} cd export export -eu --verbose x=1 grep readonly grep --verbose
+		echo printf "$1" done ${HOME} test cd ${HOME} /usr/bin test
+		--verbose "$@" /usr/bin
+	/usr/bin && /usr/bin 'quoted text' 'quoted text'
+	local export $(pwd) export "$1" export sed 'quoted text'
+		export | readonly x=1 "$@"
+echo && x=1 --verbose local done local readonly $(pwd) -eu 2>/dev/null
+	export | | then $(pwd) export "$@" readonly "$@" readonly
+		| "$@" local /usr/bin "$@" /usr/bin cd x=1 done --verbose | grep then
+		${HOME} /usr/bin | then && sed $(pwd) 2>/dev/null | done done
+--verbose "$@" ${HOME}
+		grep test /usr/bin x=1 -eu export export $(pwd) grep "$@" 2>/dev/null
+	x=1 then then readonly 'quoted text' readonly "$@" 2>/dev/null
+		"$1" "$1" cd $(pwd) "$@" $(pwd)
+cd && echo readonly --verbose 'quoted text'
+		x=1 export done -eu awk "$@" test ${HOME} echo then cd | local --verbose done &&
+		2>/dev/null $(pwd) printf awk then 'quoted text' then test then
+${HOME} readonly ${HOME} test grep $(pwd) awk awk printf awk ${HOME} | printf
+	| 'quoted text' sed echo then ${HOME} readonly && cd grep test readonly
+x=1 $(pwd) 'quoted text' printf "$1" awk test readonly
+		printf "$1" export 2>/dev/null "$@" done grep "$1"
+	readonly awk sed /usr/bin cd then | echo /usr/bin
+		'quoted text' sed export --verbose done sed
+		${HOME} export cd cd echo && 2>/dev/null ${HOME} ${HOME} then x=1 -eu sed printf
+$(pwd) test printf 'quoted text' export cd test echo "$1" --verbose export
+readonly ${HOME} --verbose cd && /usr/bin
+		&& sed printf cd --verbose test then sed | sed readonly awk readonly
+		cd --verbose readonly "$1" 2>/dev/null | test export local x=1 --verbose
+	-eu done -eu echo "$1" test
+		then done ${HOME} -eu test 'quoted text' --verbose awk $(pwd) $(pwd) export && "$1"
+2>/dev/null 2>/dev/null ${HOME} -eu | done done "$1" local && "$1"
+	-eu readonly 'quoted text' 'quoted text' sed
+		grep sed "$1" $(pwd) export
+	$(pwd) local "$@" printf | "$1" -eu "$@" echo cd printf
+	printf printf export printf export "$@"
+	&& -eu then x=1 -eu sed printf ${HOME} readonly -eu test echo "$@"
+"$@" "$1" && x=1 export --verbose sed && && x=1 printf -eu x=1 --verbose
+		grep awk then ${HOME} grep --verbose | "$@" then
+2>/dev/null /usr/bin /usr/bin grep printf ${HOME} echo
+		test 2>/dev/null "$1" -eu done local 'quoted text' 'quoted text' test | readonly
+2>/dev/null printf printf
+	x=1 "$1" -eu | "$1" echo 'quoted text' cd done readonly
+${HOME} | ${HOME} echo "$@" done ${HOME} 2>/dev/null readonly grep awk
+grep export sed echo done /usr/bin $(pwd) && |
+		"$1" /usr/bin x=1 then $(pwd) "$1" local sed echo 2>/dev/null
+	local export && grep local "$@" --verbose
+		readonly "$1" awk "$1" &&
+		done cd echo 2>/dev/null export "$1" then --verbose local
+		$(pwd) echo awk local printf x=1 2>/dev/null 'quoted text'
+then readonly /usr/bin /usr/bin 'quoted text' grep test ${HOME} test
+cd test ${HOME} then "$@" export 'quoted text' echo then ${HOME} 2>/dev/null sed
+	"$1" then "$@" done $(pwd) /usr/bin local
+readonly 2>/dev/null /usr/bin printf awk 2>/dev/null --verbose
+		--verbose readonly /usr/bin 2>/dev/null grep grep done ${HOME} grep grep grep
+		local sed printf export readonly echo $(pwd) grep "$1" printf done grep
+		2>/dev/null grep local 'quoted text' --verbose "$1" then sed printf && test
+	then awk export awk -eu grep 'quoted text' 'quoted text'
+		-eu done printf cd test | ${HOME}
+awk -eu done -eu $(pwd) export done /usr/bin -eu
+		local /usr/bin && awk /usr/bin test printf sed export local
+	&& echo /usr/bin sed echo echo ${HOME} --verbose | $(pwd) 'quoted text'
+		-eu sed printf then local x=1 'quoted text' export sed export
+		grep awk grep export cd grep
+/usr/bin && echo /usr/bin sed 'quoted text' /usr/bin /usr/bin
+	--verbose | 'quoted text' done 2>/dev/null export sed export done printf then
+test local "$1" 2>/dev/null 'quoted text' readonly
+		grep -eu local readonly "$@" 2>/dev/null readonly x=1 awk readonly readonly grep
+echo export "$@" $(pwd) && grep export --verbose /usr/bin "$1" awk --verbose
+/usr/bin --verbose export ${HOME} x=1 "$@"
+		export export /usr/bin 2>/dev/null $(pwd) -eu
+/usr/bin test cd sed 'quoted text' | readonly -eu readonly "$@" | done
+		$(pwd) "$1" "$1" done echo ${HOME}
+	x=1 readonly 'quoted text' /usr/bin done printf ${HOME} $(pwd)
+	local 'quoted text' test export done readonly then local
+'quoted text' export export 'quoted text' printf "$1" test ${HOME} sed "$1"
+${HOME} "$@" echo echo 'quoted text' && /usr/bin | export test grep sed -eu
+| awk test /usr/bin grep test -eu done export
+	readonly 'quoted text' "$1" readonly --verbose
+		&& test cd then cd sed local "$@" test export printf ${HOME}
+then ${HOME} done x=1 'quoted text' test printf
+		awk 'quoted text' ${HOME} grep grep printf done done 2>/dev/null ${HOME}
+		readonly "$@" $(pwd) && export local done "$@" 2>/dev/null local --verbose
+then | ${HOME} 'quoted text' /usr/bin 2>/dev/null --verbose export awk
+	awk readonly /usr/bin readonly echo $(pwd) readonly
+&& && --verbose local -eu --verbose export
+"$@" && /usr/bin $(pwd) echo && sed "$1" "$1" then readonly
+cd --verbose then 2>/dev/null local printf echo 2>/dev/null export awk "$@" readonly
+		"$1" test readonly local cd
+cd readonly && | test grep && 'quoted text' /usr/bin
+		sed sed printf export && readonly export readonly x=1 x=1 cd 2>/dev/null
+		awk echo readonly | cd then x=1
+		sed --verbose local -eu then --verbose
+		$(pwd) 2>/dev/null sed /usr/bin | && "$1" cd "$1" then 'quoted text' --verbose
+	2>/dev/null -eu x=1 2>/dev/null export cd test test awk cd grep cd
+export readonly x=1 ${HOME} awk -eu && test awk grep awk
+cd 2>/dev/null -eu ${HOME} export -eu
+readonly sed 2>/dev/null export awk grep --verbose ${HOME}
+sed awk x=1 local then printf done grep readonly /usr/bin test echo echo
+		printf cd then /usr/bin local
+$(pwd) x=1 local then /usr/bin $(pwd) x=1 local ${HOME} $(pwd)
+/usr/bin awk export 'quoted text' /usr/bin
+		grep | $(pwd) grep "$@" -eu "$1" test 'quoted text' -eu done grep test
+	local printf sed /usr/bin
+	test /usr/bin && ${HOME} "$1" awk grep sed test /usr/bin -eu printf
+	local "$@" then export ${HOME} -eu readonly
+	x=1 "$1" "$1" then printf 2>/dev/null export export awk local 2>/dev/null
+	echo $(pwd) export test awk 'quoted text' 'quoted text' ${HOME}
+printf && printf x=1 /usr/bin
+		grep /usr/bin test awk printf local echo local
+		done ${HOME} | cd ${HOME} test export "$1" readonly done $(pwd) readonly done
+"$@" --verbose && cd "$@" readonly done awk readonly export awk && then
+		test awk --verbose && cd /usr/bin $(pwd) /usr/bin test && local printf ${HOME} 'quoted text'
+/usr/bin local grep -eu && "$@" 'quoted text' ${HOME} /usr/bin
+	$(pwd) awk x=1 /usr/bin local sed readonly export
+		${HOME} export local readonly printf readonly cd
+local export /usr/bin local printf done awk export sed 'quoted text'
+-eu done 2>/dev/null -eu done local 2>/dev/null
+	| then /usr/bin "$1" "$1" readonly
+	sed readonly export x=1 -eu "$1" x=1
+	then | | export 2>/dev/null readonly done ${HOME}
+${HOME} && ${HOME} | && &&
+	${HOME} && ${HOME} -eu x=1 test grep x=1 && "$1" grep grep
+	| done echo grep -eu x=1 done export echo grep && sed "$@" echo &&
+		awk ${HOME} export --verbose $(pwd) then $(pwd) printf "$1" $(pwd)
+	/usr/bin "$@" echo printf printf echo --verbose
+	printf readonly export --verbose -eu export ${HOME} -eu
+		printf ${HOME} cd 2>/dev/null cd ${HOME} readonly then 2>/dev/null awk awk &&
+	2>/dev/null -eu && --verbose then
+	-eu 'quoted text' echo export export echo 'quoted text' "$@"
+local ${HOME} "$@" 'quoted text'
+		--verbose /usr/bin /usr/bin awk echo test done ${HOME}
+		echo export printf echo $(pwd) | "$1" 2>/dev/null 'quoted text' x=1
+		readonly echo x=1 | printf 2>/dev/null echo local readonly done
+cd --verbose readonly printf readonly "$@" && 2>/dev/null export
+		cd 'quoted text' cd | | -eu "$@" printf
+$(pwd) && -eu && "$1" && --verbose | ${HOME} awk &&
+		--verbose && export && done
+/usr/bin "$1" | "$1" test local ${HOME} test done awk 2>/dev/null awk readonly
+echo "$1" echo local ${HOME}
+	echo $(pwd) ${HOME} local grep $(pwd) x=1 2>/dev/null done
+		-eu local then | && /usr/bin grep && 'quoted text' cd 'quoted text' --verbose
+		awk "$1" --verbose 2>/dev/null $(pwd) sed
+x=1 local x=1 2>/dev/null "$1" echo x=1 --verbose printf export grep && local
+		local then echo export --verbose | | sed 2>/dev/null cd | test local
+| /usr/bin local awk local --verbose sed cd $(pwd) cd export /usr/bin
+	echo done then 'quoted text' 2>/dev/null
+		'quoted text' cd cd --verbose --verbose 'quoted text' readonly
+"$@" 'quoted text' awk printf && -eu then 'quoted text' cd export cd && --verbose
+	cd 2>/dev/null "$1" local && --verbose 'quoted text' $(pwd)
+		then x=1 "$1" awk test
+test printf | grep awk -eu
+		--verbose test readonly test printf test echo cd export ${HOME} x=1
+$(pwd) test 2>/dev/null --verbose grep sed
+		| -eu grep done "$@" readonly
+		cd done readonly test $(pwd) sed then printf -eu printf "$1"
+		| ${HOME} test done echo readonly
+then -eu 2>/dev/null "$1" | --verbose "$@" cd sed readonly cd |
+	$(pwd) | 'quoted text' export | "$@" "$@" export grep /usr/bin | /usr/bin
+"$1" then 'quoted text' | done ${HOME} sed then && -eu test 2>/dev/null
+2>/dev/null 'quoted text' sed readonly /usr/bin --verbose awk echo -eu then 2>/dev/null
+test ${HOME} sed sed "$@" "$@" | done
+local $(pwd) 2>/dev/null --verbose
+	export test done | done done
+readonly && $(pwd) done ${HOME} -eu readonly
+	echo test "$@" readonly echo local echo grep export
+		local cd $(pwd) readonly test awk awk x=1 && then readonly
+		done ${HOME} cd $(pwd) ${HOME} sed ${HOME} readonly "$1" cd readonly
+		${HOME} x=1 && awk grep && local /usr/bin /usr/bin
+		/usr/bin "$@" awk /usr/bin echo
+		/usr/bin -eu "$@" test local grep "$@" echo
+awk cd printf done export then printf | 'quoted text' 2>/dev/null local
+		printf done then 2>/dev/null "$1" /usr/bin
+	x=1 "$1" 'quoted text' x=1 && $(pwd) cd local && && done
+done cd "$@" && && 2>/dev/null done local && readonly
+x=1 printf cd grep "$1" 'quoted text' readonly readonly --verbose local done 2>/dev/null
+| done done "$1" test 'quoted text'
+	| x=1 $(pwd) $(pwd) grep done awk 'quoted text' x=1 | printf cd export
+	test export $(pwd) $(pwd) grep "$1" sed /usr/bin export --verbose
+'quoted text' ${HOME} sed sed cd /usr/bin "$@" grep "$1" "$@" printf "$1"
+		done printf then --verbose done done x=1 cd test
+		2>/dev/null local readonly local "$@" grep sed -eu grep "$@" /usr/bin "$@"
+	done && && done printf
+	printf "$1" awk | local | echo /usr/bin "$1" "$@"
+	-eu grep "$1" --verbose awk 'quoted text'
+	then done -eu echo then "$@" local export echo "$1" echo
+		local test "$@" sed test 2>/dev/null
+		readonly then "$1" done awk cd grep /usr/bin $(pwd) x=1 awk test sed "$@" awk
+	-eu readonly | awk printf 'quoted text' local awk sed local "$@" "$@" $(pwd)
+&& "$@" 2>/dev/null test local done $(pwd) cd printf echo --verbose "$1"
+		echo cd sed --verbose done x=1 sed local -eu 'quoted text' cd then local 'quoted text'
+		local readonly 2>/dev/null $(pwd) | awk --verbose readonly 2>/dev/null
+	test ${HOME} readonly x=1 x=1 x=1 -eu "$@" "$1" awk | "$@"
+	then | "$1" awk ${HOME} local $(pwd) 2>/dev/null export done | done local --verbose
+	${HOME} 2>/dev/null cd x=1 readonly printf x=1 readonly ${HOME} ${HOME} echo
+	2>/dev/null awk then --verbose then then /usr/bin echo awk then
+		$(pwd) cd | test echo done 2>/dev/null 'quoted text' --verbose x=1
+		'quoted text' ${HOME} cd local export && done $(pwd) then done | sed then
+	done "$@" grep echo printf
+awk grep export x=1 $(pwd) export 2>/dev/null
+		&& export local then readonly "$@" "$@" cd awk 2>/dev/null 2>/dev/null "$1" done
+| -eu && /usr/bin local readonly done "$@" export test "$1"
@@ -0,0 +1,2001 @@
+	export sed echo --verbose /usr/bin "$1"
+	export done 'quoted text' /usr/bin && /usr/bin | x=1 | "$@"
+		-eu | cd 2>/dev/null printf $(pwd) then && ${HOME}
+		x=1 x=1 local awk 'quoted text' | "$@" | test sed sed local $(pwd) awk cd
+	printf "$1" $(pwd) readonly export 'quoted text' test
+		cd sed local x=1 printf && && grep local
+		test sed readonly /usr/bin
+	| cd done done && | "$1" readonly done ${HOME} 2>/dev/null
+	"$@" readonly $(pwd) 'quoted text'
+awk awk printf "$1" "$@"
+	"$1" 2>/dev/null && echo echo $(pwd)
+		-eu echo grep x=1 "$@" "$1" "$@" done --verbose | test
+		done sed export --verbose 'quoted text' | echo readonly cd | "$@"
+		sed done && awk | 'quoted text' export "$@" x=1 "$@" readonly &&
+	2>/dev/null -eu 'quoted text' local local -eu
+	sed test 2>/dev/null /usr/bin 2>/dev/null
+		"$1" printf && && done x=1 grep done echo cd export cd then
+echo /usr/bin | readonly 'quoted text' done --verbose $(pwd) &&
+awk awk local 2>/dev/null cd cd | $(pwd) echo 2>/dev/null --verbose ${HOME}
+	&& x=1 /usr/bin grep printf awk sed test $(pwd) then 2>/dev/null
+		${HOME} /usr/bin readonly "$@" --verbose
+awk 2>/dev/null echo | local cd export test | local sed done
+	grep echo "$@" ${HOME} --verbose echo /usr/bin local --verbose grep done "$@" sed
+		then x=1 test --verbose printf export test 2>/dev/null
+	local $(pwd) printf && readonly printf 2>/dev/null
+		readonly grep 2>/dev/null ${HOME} grep | cd done test
+		$(pwd) grep ${HOME} grep x=1 test && test ${HOME} ${HOME} x=1 -eu
+		test readonly export "$1" done "$1" cd -eu printf
+	$(pwd) 2>/dev/null /usr/bin ${HOME} -eu -eu
+	test done sed readonly grep cd 'quoted text'
+	${HOME} grep && awk awk awk then && test && awk "$1" && awk readonly
+		$(pwd) sed then && then local /usr/bin test 'quoted text' cd test --verbose
+awk "$1" ${HOME} $(pwd) readonly "$@" 'quoted text' local echo echo
+	'quoted text' --verbose
+| local echo /usr/bin echo done awk readonly | /usr/bin x=1 cd
+	done -eu $(pwd) done $(pwd) 'quoted text' local printf
+export && test $(pwd) | echo
+		"$@" 2>/dev/null "$1" $(pwd) "$@" x=1 local
+		$(pwd) test $(pwd) ${HOME} -eu grep
+	export cd test "$1" export export awk test "$1" x=1
+		"$@" done "$1" 'quoted text' -eu export --verbose printf
+		2>/dev/null x=1 cd | | 'quoted text' cd x=1
+		then readonly export | ${HOME} /usr/bin
+then done --verbose | /usr/bin /usr/bin test done
+	cd -eu $(pwd) done ${HOME} "$1"
+| test /usr/bin local "$@" done test readonly --verbose
+		done then test x=1 "$@" sed local test /usr/bin $(pwd) local
+"$1" readonly awk x=1 done $(pwd) x=1 x=1 sed "$1" $(pwd) then $(pwd) /usr/bin
+2>/dev/null 'quoted text'
+	test sed test -eu then sed "$@" grep "$1" printf test echo export done awk
+	x=1 x=1 "$@" done $(pwd) grep && && "$1" test ${HOME}
+	x=1 x=1 'quoted text' && readonly readonly test "$1"
+-eu sed ${HOME} readonly cd $(pwd) $(pwd)
+echo && sed 2>/dev/null -eu
+		printf -eu 2>/dev/null x=1 | "$1" $(pwd) export 2>/dev/null "$1" done $(pwd) grep
+x=1 "$1" && cd cd 'quoted text' echo | readonly $(pwd) -eu
+		then $(pwd) echo export echo /usr/bin cd
+	2>/dev/null readonly done 'quoted text' done "$@" printf export
+cd -eu --verbose echo && cd export /usr/bin
+${HOME} printf 2>/dev/null
+	--verbose /usr/bin x=1 cd 'quoted text' 'quoted text' sed -eu 2>/dev/null
+		export 'quoted text' readonly
+	awk x=1 echo "$@" 'quoted text' awk then -eu test then
+	readonly echo x=1 printf then -eu $(pwd) -eu $(pwd) done then printf awk
+	/usr/bin sed 'quoted text' local --verbose
+then local done "$1" sed local test
+-eu --verbose -eu /usr/bin export test && awk printf export "$1" --verbose echo
+		echo awk -eu | 2>/dev/null "$1" x=1 export sed done ${HOME} cd -eu echo local
+'quoted text' cd cd && grep awk
+	-eu x=1 test x=1 'quoted text' printf grep
+	${HOME} ${HOME} --verbose "$@"
+	local 2>/dev/null awk printf $(pwd) cd
+		-eu "$@" "$1" done done | export awk grep printf done --verbose printf | local |
+		sed awk sed -eu -eu awk awk
+	then -eu "$@" done awk "$@" sed test printf done "$1" "$@" done --verbose
+cd && readonly sed && local && awk /usr/bin
+	'quoted text' 'quoted text' ${HOME}
+| readonly cd cd | $(pwd) | printf "$@" | sed
+export printf | awk "$1" grep done -eu done /usr/bin --verbose cd /usr/bin
+	x=1 export -eu 2>/dev/null export
+		-eu echo test && sed x=1
+--verbose then --verbose
+printf grep x=1 && grep cd echo $(pwd) awk && --verbose | 'quoted text' echo cd
+	/usr/bin echo | grep echo readonly 'quoted text'
+$(pwd) | sed readonly grep awk /usr/bin $(pwd) then &&
+	'quoted text' local -eu -eu echo test
+	| then /usr/bin readonly printf sed ${HOME} /usr/bin local local "$@"
+	"$1" "$@" grep readonly local done "$@" export 2>/dev/null
+	grep grep --verbose awk
+	grep cd /usr/bin "$1" -eu
+		$(pwd) local "$@" 2>/dev/null echo ${HOME} && --verbose local grep
+&& export ${HOME} 'quoted text' | export done
+		echo readonly echo $(pwd) export printf | -eu cd && 2>/dev/null echo
+x=1 $(pwd) export /usr/bin "$1" echo --verbose x=1 "$1" $(pwd) $(pwd)
+		awk then "$1" done ${HOME}
+-eu local -eu test x=1 ${HOME} --verbose
+		then test && && -eu then awk sed export -eu x=1 'quoted text' printf
+	awk /usr/bin local "$1" test sed
+		$(pwd) cd /usr/bin test test export then -eu
+	readonly cd ${HOME} local 2>/dev/null printf
+	readonly echo awk then --verbose 'quoted text'
+	"$1" --verbose grep /usr/bin sed "$1" $(pwd) echo "$1" | ${HOME}
+		"$@" sed done 2>/dev/null -eu sed local export "$@" "$1"
+	awk local 2>/dev/null "$1" -eu "$@" "$1" awk 2>/dev/null grep ${HOME} printf
+		printf export $(pwd) then "$@" grep sed export "$@" then
+		sed && "$@" sed grep $(pwd)
+		| echo grep printf ${HOME} readonly 'quoted text' sed --verbose
+2>/dev/null readonly local export 2>/dev/null export then | 2>/dev/null
+	readonly echo sed export $(pwd) awk awk
+${HOME} local echo "$@" "$@" $(pwd) --verbose cd x=1 awk printf x=1 | /usr/bin
+	| local done echo printf &&
+-eu 2>/dev/null "$1" local | local 2>/dev/null echo readonly done then 'quoted text'
+test ${HOME} export local done --verbose | local
+		export && /usr/bin "$1"
+	${HOME} ${HOME} --verbose ${HOME} -eu -eu grep && --verbose /usr/bin
+local local sed sed echo "$1" grep
+${HOME} echo ${HOME}
+done cd printf ${HOME} then printf --verbose
+		then x=1 $(pwd) grep --verbose
+		${HOME} ${HOME} printf /usr/bin local printf done x=1 -eu && 'quoted text'
+		--verbose cd 2>/dev/null export 2>/dev/null
+test $(pwd) x=1 awk export test "$@"
+${HOME} test awk "$@" | /usr/bin $(pwd) $(pwd) cd awk "$1" done awk "$1" 'quoted text'
+		test /usr/bin ${HOME} /usr/bin "$1" local x=1 done sed done x=1
+local /usr/bin x=1 && $(pwd) cd
+	-eu x=1 2>/dev/null grep echo $(pwd) readonly done done "$1" /usr/bin local
+		local local done ${HOME} "$@" local --verbose printf then $(pwd)
+awk 'quoted text' printf 'quoted text'
+		x=1 -eu local done | grep ${HOME}
+		| 'quoted text' printf test && test then -eu ${HOME} /usr/bin
+		-eu printf printf && export | "$@" | readonly 'quoted text'
+		then readonly && "$@" 'quoted text' -eu test
+	--verbose then "$1" cd
+${HOME} export echo done cd export sed "$1" x=1 grep
+		printf ${HOME} /usr/bin test | printf done --verbose then && then x=1
+x=1 echo test grep "$@" echo done done 2>/dev/null ${HOME}
+		sed | x=1 --verbose 2>/dev/null --verbose -eu readonly
+	/usr/bin ${HOME} --verbose &&
+printf $(pwd) x=1 export printf echo test cd --verbose test | then grep
+		readonly -eu grep -eu "$@" && $(pwd) ${HOME} && awk done
+"$1" awk printf cd /usr/bin awk "$1" then echo grep then awk then grep
+&& /usr/bin awk $(pwd) echo --verbose | -eu printf $(pwd)
+		echo --verbose "$@" -eu $(pwd) 'quoted text' then "$1" /usr/bin
+		printf 'quoted text' local | x=1 /usr/bin readonly "$1" test 'quoted text' -eu -eu
+		'quoted text' printf x=1 &&
+		&& ${HOME} then | "$1" printf /usr/bin "$@" grep test x=1 'quoted text' readonly
+export "$@" && readonly 'quoted text' printf -eu --verbose done 'quoted text'
+	local then x=1 /usr/bin test
+	awk done done -eu /usr/bin test "$@" 'quoted text' then ${HOME}
+		-eu $(pwd) readonly 'quoted text'
+		--verbose export "$1"
+	${HOME} awk printf sed test local "$@" x=1 readonly "$1" echo local
+grep printf $(pwd) cd local
+		then sed test printf "$@" awk then local
+readonly readonly export grep printf 2>/dev/null /usr/bin
+	grep "$1" ${HOME} && cd x=1 readonly $(pwd) awk $(pwd) 2>/dev/null local
+"$1" --verbose sed sed "$1" printf 2>/dev/null 2>/dev/null &&
+	cd && test /usr/bin printf -eu
+	done awk x=1 export readonly $(pwd) awk echo export $(pwd) "$@" cd awk awk sed
+done export x=1 cd "$1" then ${HOME} 'quoted text' sed done cd
+	printf 'quoted text' awk x=1
+	| local printf test cd readonly
+	export --verbose local x=1 grep cd ${HOME} /usr/bin "$@" local
+	&& 'quoted text' grep /usr/bin --verbose
+	then then $(pwd) cd x=1
+		${HOME} export --verbose /usr/bin echo | -eu
+export cd awk cd 2>/dev/null test "$@" "$@" done -eu printf
+x=1 | 'quoted text' readonly ${HOME} 'quoted text' done x=1 /usr/bin
+2>/dev/null test "$1" 'quoted text' --verbose
+		"$@" && -eu sed test local && readonly ${HOME} "$@" -eu ${HOME}
+export $(pwd) | -eu export printf test --verbose then "$1" ${HOME} "$1"
+	grep && readonly grep 'quoted text' && local "$@" && echo echo x=1 cd
+		| echo "$@" ${HOME} readonly sed -eu readonly done "$1" "$@" "$@" readonly
+		&& readonly then | "$@" "$1" && ${HOME} "$1" | 'quoted text' local
+	&& x=1 readonly export then test then sed cd done awk test local
+		awk 'quoted text' awk | 2>/dev/null local done -eu export 'quoted text'
+		readonly /usr/bin ${HOME} ${HOME} -eu -eu 'quoted text' x=1 then /usr/bin
+2>/dev/null && --verbose awk done $(pwd) |
+		-eu readonly "$1" test $(pwd)
+	x=1 cd grep "$@" readonly && 2>/dev/null
+		printf && -eu done sed readonly grep -eu
+		${HOME} x=1 then 'quoted text' && export sed readonly readonly 'quoted text'
+		done printf x=1 -eu | test x=1 -eu awk 2>/dev/null
+	"$@" done -eu sed done ${HOME}
+cd printf "$@" "$@" test /usr/bin
+-eu test echo /usr/bin "$1" "$@" | ${HOME}
+		test 2>/dev/null && x=1 printf grep test awk local
+--verbose local x=1 --verbose "$@" cd | echo export -eu local local -eu export
+	local then | cd printf
+'quoted text' echo ${HOME}
+		cd then 'quoted text' sed x=1 -eu cd --verbose "$1" x=1
+local printf x=1 done test 2>/dev/null done
+	'quoted text' && done "$1" -eu x=1 2>/dev/null
+test "$@" done | test done --verbose
+echo "$@" then "$@" then && 2>/dev/null ${HOME}
+		awk readonly -eu "$1" grep grep then ${HOME} ${HOME} export /usr/bin 'quoted text'
+		--verbose export local done export ${HOME} sed printf $(pwd) readonly
+done $(pwd) ${HOME} "$@"
+		| then test /usr/bin && echo then "$@"
+	sed cd 'quoted text' -eu | ${HOME} done -eu | 'quoted text' echo
+	cd export done grep echo then echo | /usr/bin done ${HOME} export 2>/dev/null
+awk readonly export && ${HOME} test readonly cd 'quoted text' /usr/bin
+"$1" | --verbose awk "$1" /usr/bin | export
+printf | readonly test local ${HOME} export printf cd $(pwd) sed "$@" /usr/bin
+	$(pwd) ${HOME} --verbose 'quoted text' --verbose
+	| x=1 awk | "$1" && 'quoted text' x=1 2>/dev/null /usr/bin --verbose
+then then 'quoted text' 2>/dev/null readonly
+		$(pwd) test && 'quoted text' echo "$@" local cd --verbose
+		&& 2>/dev/null | cd | $(pwd) ${HOME} printf awk then --verbose local x=1 $(pwd)
+		readonly | x=1 local /usr/bin readonly awk sed -eu local export
+	test readonly then echo -eu sed cd x=1 -eu readonly "$1" readonly done
+	test local readonly then printf printf sed | cd ${HOME} "$1" 2>/dev/null
+		readonly local && "$@" && test "$@" test
+	sed ${HOME} local sed x=1 export /usr/bin -eu --verbose
+		/usr/bin sed "$1" cd 'quoted text' $(pwd)
+x=1 x=1 'quoted text' cd "$@" $(pwd) printf readonly cd 2>/dev/null local
+		'quoted text' 2>/dev/null x=1 -eu "$1" "$1" awk -eu awk printf readonly 2>/dev/null
+		&& $(pwd) then x=1 then local test --verbose $(pwd) then readonly then ${HOME}
+test $(pwd) awk && echo --verbose printf
+	then /usr/bin export --verbose awk
+		printf done --verbose awk x=1 "$1" $(pwd) awk --verbose
+		then awk && /usr/bin $(pwd) -eu x=1 echo 2>/dev/null && done echo readonly
+		--verbose -eu echo $(pwd) | ${HOME} -eu grep --verbose grep test ${HOME} "$1"
+		readonly then readonly /usr/bin echo printf /usr/bin done done "$@" local -eu
+		${HOME} export then "$@" $(pwd) x=1 && grep
+'quoted text' grep $(pwd)
+--verbose awk "$@" -eu && $(pwd) awk "$1" &&
+		$(pwd) grep -eu ${HOME} cd cd local export "$@" "$1" then export
+		echo local echo echo grep "$1" -eu local awk
+		${HOME} "$1" "$@" awk ${HOME} local
+	${HOME} "$1" x=1 echo cd $(pwd) --verbose export export --verbose
+--verbose 2>/dev/null --verbose sed cd x=1 "$@" cd 2>/dev/null
+		cd x=1 readonly then grep export -eu | | --verbose
+		&& then awk test --verbose grep /usr/bin -eu $(pwd) sed test grep 2>/dev/null
+	cd 'quoted text' readonly cd done 2>/dev/null awk /usr/bin echo && |
+	done test awk x=1 | /usr/bin export
+printf echo x=1 /usr/bin | readonly 'quoted text' $(pwd) cd then 'quoted text'
+	/usr/bin x=1 "$@" ${HOME} done $(pwd) done printf 2>/dev/null sed grep
+	done && local printf && 'quoted text' "$1" export | local -eu awk --verbose
+x=1 "$1" cd local done then
+	grep local then printf --verbose --verbose
+done done cd echo 2>/dev/null 'quoted text' /usr/bin printf local /usr/bin
+		"$@" awk | grep echo "$1" 2>/dev/null "$@" sed ${HOME} ${HOME} echo local
+		"$@" 2>/dev/null export 'quoted text' "$1"
+		'quoted text' echo $(pwd) readonly
+-eu then grep --verbose local grep then $(pwd) --verbose -eu | | local
+		&& 2>/dev/null x=1 x=1 awk awk done readonly 'quoted text' x=1 2>/dev/null
+--verbose 2>/dev/null test -eu 2>/dev/null echo export readonly echo awk &&
+echo test 2>/dev/null awk printf ${HOME} test --verbose
+		"$@" && ${HOME} --verbose sed awk 2>/dev/null --verbose done "$1"
+		export grep "$1" /usr/bin /usr/bin "$@" x=1 --verbose 2>/dev/null
+"$1" && | && "$1" cd && "$@" printf cd --verbose $(pwd)
+grep | cd done cd local --verbose awk --verbose cd
+echo printf | grep export x=1 && then x=1 2>/dev/null
+	| done local done /usr/bin
+	readonly /usr/bin cd
+printf cd ${HOME} && /usr/bin export readonly sed then | && export
+	/usr/bin /usr/bin -eu $(pwd) 'quoted text'
+		--verbose --verbose x=1 x=1 local export then test "$1"
+		printf 2>/dev/null done 2>/dev/null
+		cd "$@" ${HOME} local 2>/dev/null ${HOME} grep then --verbose "$1" -eu && done
+	sed awk -eu awk local then ${HOME} readonly printf | test 'quoted text'
+	"$1" local ${HOME} && test readonly cd cd then -eu test export
+done --verbose "$1" -eu grep done
+		sed export local test echo test | cd --verbose cd $(pwd)
+		&& awk cd ${HOME} "$1" local local local echo --verbose
+		printf | test export /usr/bin then grep -eu $(pwd) --verbose cd export ${HOME}
+done /usr/bin 'quoted text'
+'quoted text' | test sed /usr/bin test ${HOME}
+		awk echo --verbose 2>/dev/null && test readonly --verbose
+		awk done then ${HOME} --verbose grep then
+--verbose x=1 | sed grep | export cd 'quoted text' cd cd local awk
+		2>/dev/null x=1 echo printf
+then printf "$1" readonly then done && 'quoted text'
+	2>/dev/null -eu --verbose
+		x=1 grep sed awk test export 'quoted text'
+	done then -eu | local echo
+		-eu ${HOME} readonly sed "$@"
+"$1" -eu "$@" x=1 $(pwd) x=1 | export grep sed readonly awk
+		grep done 2>/dev/null --verbose then readonly && done done echo then 'quoted text'
+		sed -eu then local | local test export export sed export echo sed --verbose
+test printf sed cd "$@" /usr/bin
+		printf -eu grep awk sed printf
+		${HOME} awk /usr/bin 'quoted text' $(pwd) $(pwd) printf "$@" 'quoted text'
+$(pwd) sed -eu echo echo export "$1" test
+	done then export awk
+then ${HOME} done 'quoted text' grep && | printf local export | | sed test
+	cd test export awk ${HOME} local then $(pwd) awk $(pwd)
+		"$1" x=1 $(pwd) done awk printf then &&
+printf printf local --verbose echo --verbose ${HOME} "$1"
+	$(pwd) test local -eu test $(pwd) readonly echo printf 2>/dev/null
+	-eu test --verbose then $(pwd) then x=1 awk 'quoted text' ${HOME}
+		then 'quoted text' printf | "$1" awk && echo "$1" test "$1"
+	-eu --verbose --verbose $(pwd) then
+"$@" ${HOME} awk --verbose "$@" done --verbose
+	readonly --verbose local done awk "$1" printf
+sed test printf | "$@" cd 'quoted text' ${HOME} grep -eu | cd test 2>/dev/null
+-eu export | printf --verbose x=1 sed export awk
+	export awk 2>/dev/null -eu x=1
+then cd readonly local awk | local printf
+-eu ${HOME} echo "$1" sed | &&
+	"$@" printf /usr/bin && "$1" echo x=1 export "$@" "$@" test export
+	awk test 2>/dev/null local "$1" && -eu test /usr/bin
+		export && -eu grep && test 'quoted text' export then awk sed /usr/bin
+$(pwd) test ${HOME} sed sed --verbose
+	&& then 'quoted text' printf 2>/dev/null
+test export done && ${HOME} "$@" x=1 ${HOME} "$@" $(pwd)
+then printf 'quoted text' "$@" then ${HOME} printf -eu $(pwd) grep
+	test sed -eu export then | awk
+		export printf sed done grep /usr/bin local export x=1 cd grep printf done
+	/usr/bin cd "$@" 'quoted text' grep --verbose
+	${HOME} 2>/dev/null grep echo 2>/dev/null
+$(pwd) x=1 -eu readonly -eu "$@" awk $(pwd) grep export x=1 readonly echo /usr/bin
+	sed /usr/bin ${HOME} /usr/bin then "$1" echo /usr/bin x=1 && done "$1" done sed
+		&& /usr/bin -eu printf --verbose "$@" | 2>/dev/null cd 2>/dev/null local $(pwd)
+	"$1" readonly && -eu grep "$1" 2>/dev/null printf
+		2>/dev/null 'quoted text'
+/usr/bin readonly x=1 ${HOME} "$@" -eu sed /usr/bin
+	done sed grep x=1 then grep "$1" -eu
+	export ${HOME} done echo
+		then done 2>/dev/null x=1 'quoted text'
+	cd then export echo $(pwd) ${HOME}
+	test "$1" grep local printf sed awk && && && && ${HOME} sed && sed "$@" && --verbose
+		x=1 -eu 'quoted text' cd --verbose awk cd && test --verbose && printf
+$(pwd) --verbose --verbose --verbose | done sed grep |
+		readonly | awk cd done x=1 "$1" ${HOME} | then grep x=1 -eu grep "$@" "$@"
+	$(pwd) cd awk "$@" test | echo readonly test readonly x=1 "$@"
+		test export "$1" $(pwd) awk 'quoted text' sed
+		--verbose x=1 awk --verbose && && "$1" ${HOME} ${HOME} --verbose
+export /usr/bin /usr/bin local -eu | && awk grep readonly
+echo "$1" test cd then x=1 printf printf 2>/dev/null
+		"$@" x=1 | local | then 2>/dev/null 'quoted text'
+$(pwd) echo --verbose | x=1 "$@" | export export
+	local grep test sed --verbose then 2>/dev/null | then -eu then export test -eu
+		cd readonly printf && then 2>/dev/null | --verbose echo export && sed export
+$(pwd) grep /usr/bin awk export --verbose
+done "$1" "$@" then 'quoted text' && && printf then $(pwd) grep readonly
+&& $(pwd) test export sed echo echo grep printf && /usr/bin "$@" 'quoted text'
+awk cd test 'quoted text' /usr/bin echo echo sed --verbose printf
+	2>/dev/null export $(pwd) ${HOME} ${HOME} readonly
+		grep echo export $(pwd) "$@" echo echo
+	${HOME} "$1" done printf "$@" /usr/bin
+then readonly | "$1" "$1" | export && then
+readonly $(pwd) ${HOME} -eu /usr/bin $(pwd) 2>/dev/null test ${HOME}
+		readonly x=1 cd x=1 'quoted text' "$@" -eu /usr/bin
+	sed export x=1 export grep awk | 2>/dev/null "$@" --verbose x=1 x=1
+'quoted text' awk test ${HOME} && 'quoted text' cd export --verbose local sed awk
+	sed cd local -eu then echo
+${HOME} echo "$@" cd | "$@" && ${HOME} && -eu "$1" cd echo
+		/usr/bin cd "$@" | x=1 done --verbose cd sed echo
+		export local "$1" printf local printf cd awk readonly "$1" then
+	--verbose x=1 /usr/bin --verbose
+	x=1 ${HOME} local 'quoted text' cd test "$@" test "$1" done sed done --verbose
+		--verbose then | cd echo sed export printf ${HOME}
+	"$1" awk test echo export | cd test test local done awk ${HOME}
+		"$@" readonly test readonly
+	echo ${HOME} readonly echo ${HOME}
+		export local test -eu cd readonly
+		${HOME} $(pwd) && done printf -eu
+	export "$@" -eu -eu "$@" | printf awk
+2>/dev/null done /usr/bin readonly done sed x=1 printf then readonly
+2>/dev/null 'quoted text' |
+		local $(pwd) local "$@"
+	$(pwd) /usr/bin printf 2>/dev/null ${HOME} /usr/bin export test $(pwd)
+	printf "$1" local printf | "$@" then local && -eu local
+	test test ${HOME} | cd export awk
+		| x=1 test -eu export /usr/bin sed awk
+		grep awk printf test 'quoted text'
+	"$@" $(pwd) echo && x=1
+		echo export test 2>/dev/null /usr/bin
+		x=1 "$1" awk 2>/dev/null x=1 printf export x=1
+done export sed then /usr/bin done then "$@" readonly --verbose readonly "$@" echo
+	test 2>/dev/null local local sed echo 'quoted text' printf 2>/dev/null
+	awk ${HOME} export sed awk cd printf test awk cd readonly &&
+	export sed /usr/bin "$@" 'quoted text' echo awk cd printf
+		export awk /usr/bin "$@" cd grep --verbose
+	${HOME} --verbose awk readonly printf
+readonly export done grep --verbose /usr/bin "$@" cd --verbose "$1" | /usr/bin
+		sed cd x=1 export /usr/bin 2>/dev/null export ${HOME} "$@" 2>/dev/null
+		printf $(pwd) ${HOME} test 'quoted text'
+--verbose grep printf grep && readonly $(pwd) /usr/bin sed cd -eu ${HOME} && then
+		&& 'quoted text' cd echo done | /usr/bin -eu "$1" ${HOME} ${HOME} done --verbose
+echo cd $(pwd) readonly printf cd local
+	x=1 2>/dev/null "$@" x=1 && "$1" | "$@" --verbose
+	awk $(pwd) grep 'quoted text' "$1" then test x=1 printf ${HOME} | local sed
+		${HOME} grep awk cd | "$@" /usr/bin "$1" cd test ${HOME}
+${HOME} printf sed sed 2>/dev/null awk readonly test x=1 printf awk readonly
+		cd printf $(pwd) "$1" "$1" test
+--verbose 2>/dev/null export then | cd 'quoted text'
+	awk grep 'quoted text' $(pwd) grep --verbose ${HOME} -eu ${HOME}
+		| "$@" readonly printf readonly 'quoted text'
+	grep test ${HOME} && 'quoted text'
+"$@" awk -eu /usr/bin 'quoted text'
+	echo readonly grep readonly then ${HOME} then && | x=1 sed --verbose done ${HOME}
+		-eu /usr/bin -eu then "$@" grep
+		--verbose echo x=1 "$@" --verbose "$@"
+$(pwd) cd cd "$1" -eu $(pwd) && done done "$1" 'quoted text'
+	done --verbose "$1" && printf local --verbose -eu test | 'quoted text' "$1"
+"$1" cd 2>/dev/null cd -eu 2>/dev/null test 'quoted text' ${HOME}
+		grep $(pwd) export 'quoted text' export 'quoted text' then --verbose | printf
+		test ${HOME} 'quoted text' "$1" readonly | export 2>/dev/null
+/usr/bin x=1 | "$@" ${HOME} | -eu done -eu
+		readonly printf cd local cd local x=1 ${HOME}
+	awk && cd "$1" done export /usr/bin done printf then done
+/usr/bin x=1 "$1" awk readonly sed cd cd | 2>/dev/null
+	local $(pwd) | "$@" x=1 --verbose sed grep printf && sed awk test /usr/bin
+	local ${HOME} done && x=1 /usr/bin "$@" cd grep
+'quoted text' awk grep | local echo cd | --verbose
+	| export sed cd /usr/bin | awk -eu awk 2>/dev/null printf sed done "$1" --verbose
+	2>/dev/null local && awk | printf ${HOME}
+		cd ${HOME} sed local "$@" 2>/dev/null 2>/dev/null export sed --verbose --verbose
+	x=1 --verbose /usr/bin "$1" ${HOME} test | readonly --verbose
+	then export --verbose "$1" sed 'quoted text' then done cd /usr/bin 2>/dev/null
+--verbose "$@" cd done local --verbose test local
+	grep readonly sed "$@" x=1 echo grep "$1" local 2>/dev/null
+	'quoted text' | readonly
+		&& export done local readonly "$1" cd --verbose grep echo export
+done -eu --verbose done sed 'quoted text' grep grep /usr/bin then awk | export
+2>/dev/null local readonly awk export
+		local && /usr/bin then "$@" ${HOME} local test "$1" 'quoted text'
+	'quoted text' && local cd then
+	local export sed test then "$1" "$@" &&
+	sed $(pwd) awk 'quoted text' awk cd x=1
+	test export | cd export /usr/bin && 2>/dev/null 'quoted text'
+--verbose /usr/bin | echo "$1" echo -eu | grep 'quoted text' awk grep
+	done readonly printf && readonly 'quoted text' awk
+		$(pwd) test sed && x=1
+		done "$1" 2>/dev/null cd readonly cd /usr/bin
+	cd | && awk 2>/dev/null cd 'quoted text'
+		2>/dev/null x=1 | -eu
+	"$1" ${HOME} grep 'quoted text'
+	| cd printf "$@" done --verbose done
+echo readonly grep readonly --verbose grep
+		/usr/bin awk "$@" then export local
+grep 2>/dev/null cd 'quoted text' export cd grep | export 'quoted text' done
+&& --verbose awk sed export
+	| cd 'quoted text' readonly x=1 readonly x=1 --verbose export readonly
+x=1 awk printf -eu -eu x=1 test 'quoted text' grep --verbose readonly
+-eu x=1 'quoted text' /usr/bin "$1" $(pwd) local
+		awk echo | readonly --verbose export -eu
+	"$@" grep -eu && "$1" /usr/bin --verbose done
+	echo -eu sed test 2>/dev/null /usr/bin
+	$(pwd) awk 'quoted text' x=1 cd 2>/dev/null
+&& "$1" test 2>/dev/null -eu export grep readonly --verbose 2>/dev/null
+		--verbose "$@" "$@" "$@" test && test --verbose cd 'quoted text' "$1"
+	echo ${HOME} done "$@" echo grep 'quoted text' awk test /usr/bin grep ${HOME}
+cd "$@" grep 2>/dev/null then export ${HOME} ${HOME} printf && "$@"
+	local test ${HOME} --verbose --verbose
+		"$1" sed /usr/bin readonly printf cd x=1 && export
+		done readonly -eu echo "$@" "$@" cd x=1
+		'quoted text' export cd done | 2>/dev/null
+2>/dev/null /usr/bin | readonly cd /usr/bin printf readonly "$1" $(pwd)
+readonly ${HOME} -eu cd echo "$1" grep readonly grep test $(pwd) ${HOME}
+	local done done /usr/bin local printf -eu
+readonly cd && test "$1" | then
+	grep awk local local | grep ${HOME} test --verbose --verbose x=1 x=1 then
+		&& 2>/dev/null grep local printf export 2>/dev/null
+		local -eu export | 'quoted text' 'quoted text' done 2>/dev/null
+echo 2>/dev/null done awk --verbose
+		echo local 2>/dev/null awk 2>/dev/null 2>/dev/null | --verbose done
+		"$1" then awk readonly sed then && local echo awk echo $(pwd)
+	export cd | "$1" "$@" --verbose
+		"$@" ${HOME} | -eu test 2>/dev/null then sed echo done then sed ${HOME} readonly
+	"$1" printf "$1" grep ${HOME} test
+		test | x=1 "$@" sed export 2>/dev/null ${HOME} -eu
+	export test "$@" test
+	'quoted text' test grep readonly export cd /usr/bin
+test then readonly echo x=1 sed awk --verbose printf sed x=1 $(pwd) &&
+awk /usr/bin local "$@" then 'quoted text' x=1 sed -eu cd done x=1
+&& 2>/dev/null | ${HOME} export done cd "$1" /usr/bin
+	export grep awk -eu sed -eu 2>/dev/null local ${HOME} then readonly done
+| /usr/bin --verbose then 2>/dev/null /usr/bin | ${HOME} readonly -eu test &&
+		readonly x=1 -eu 'quoted text' x=1
+"$@" "$1" "$1" $(pwd) "$1" awk --verbose 2>/dev/null grep
+x=1 "$1" printf then then
+	/usr/bin test ${HOME} then ${HOME} sed
+		--verbose local awk readonly --verbose
+/usr/bin "$@" echo echo | done export -eu grep --verbose
+	printf readonly printf local x=1 | printf ${HOME}
+		cd "$1" x=1 export /usr/bin grep --verbose grep $(pwd) x=1 cd && awk done awk
+/usr/bin "$1" 'quoted text' then --verbose $(pwd)
+	sed /usr/bin test | local ${HOME} cd echo &&
+	readonly then sed echo ${HOME} grep done grep
+then /usr/bin --verbose sed && x=1 x=1 awk
+| cd 2>/dev/null local test grep cd
+		test /usr/bin then "$@" && | echo cd cd "$@" export
+	2>/dev/null test "$1" test "$1"
+		"$1" cd "$1" echo grep -eu 'quoted text' ${HOME}
+		echo -eu awk cd && $(pwd) "$@" x=1 && && readonly "$@" echo grep cd printf
+	| "$@" --verbose "$@" /usr/bin x=1 readonly readonly echo $(pwd) printf
+		/usr/bin "$1" $(pwd) echo local awk readonly echo -eu
+		readonly awk "$1" printf done ${HOME} awk test 'quoted text' 'quoted text'
+		2>/dev/null sed "$1" cd then 2>/dev/null
+	awk sed /usr/bin 2>/dev/null /usr/bin /usr/bin echo -eu | awk awk grep
+awk grep 2>/dev/null local
+${HOME} done -eu 'quoted text' | test | 2>/dev/null
+		echo done "$1" /usr/bin | test && 'quoted text'
+| local -eu --verbose $(pwd) echo done echo
+	x=1 then "$1" cd --verbose -eu done local printf echo && local
+		--verbose printf echo | "$@" -eu 'quoted text' "$1" "$1" 'quoted text'
+2>/dev/null cd | local /usr/bin ${HOME} "$1"
+	-eu awk test --verbose 2>/dev/null --verbose
+	&& ${HOME} --verbose x=1 $(pwd) x=1 sed 'quoted text' sed 'quoted text'
+	then export export printf local && grep 2>/dev/null test awk readonly
+awk test local x=1 export | && echo grep readonly done -eu local printf &&
+		"$@" && "$@" local --verbose $(pwd) grep ${HOME}
+grep --verbose cd cd local ${HOME} printf printf x=1 done done test
+	local | -eu awk "$1" -eu -eu local echo && -eu 2>/dev/null echo local
+		echo "$@" "$@" -eu awk -eu 'quoted text' "$1"
+	test 2>/dev/null grep "$@" local -eu $(pwd) cd export grep
+&& then printf awk "$1" "$@" test 'quoted text'
+		done test done readonly --verbose --verbose printf ${HOME} echo
+"$1" ${HOME} sed 2>/dev/null test sed
+$(pwd) done readonly sed
+	sed echo printf test "$@" echo echo grep echo && | test test /usr/bin local |
+		"$@" -eu echo | $(pwd) -eu grep cd awk && local sed
+		local ${HOME} test "$1" /usr/bin
+	done grep 2>/dev/null | --verbose 'quoted text' -eu "$1"
+	cd ${HOME} 2>/dev/null 2>/dev/null export
+grep | cd then echo echo -eu x=1
+		printf then x=1 ${HOME}
+		readonly then /usr/bin local grep printf export export awk | "$1"
+		| 2>/dev/null 2>/dev/null "$@" done 2>/dev/null | --verbose
+		| grep 'quoted text' sed |
+		echo printf && -eu cd grep ${HOME} cd 'quoted text' cd ${HOME} && echo 2>/dev/null
+		test --verbose done x=1 cd -eu awk x=1 -eu local x=1 /usr/bin --verbose
+		grep /usr/bin grep then $(pwd) && 'quoted text'
+	-eu local ${HOME} cd 'quoted text' 'quoted text'
+local sed then readonly awk then x=1 export --verbose test sed x=1 $(pwd) 2>/dev/null
+	/usr/bin local $(pwd) 'quoted text'
+2>/dev/null test cd $(pwd)
+	| printf $(pwd) /usr/bin
+	readonly awk "$1" ${HOME} test
+		sed test | 'quoted text' grep grep && readonly
+	sed && export 2>/dev/null --verbose printf
+		--verbose readonly printf cd readonly "$@" 2>/dev/null "$1" && readonly echo sed
+x=1 done 'quoted text' echo cd readonly
+		echo -eu cd cd test sed local 'quoted text' printf grep
+		${HOME} | grep readonly export local "$@"
+		echo awk local | "$1" --verbose
+	cd -eu grep readonly printf
+	"$@" 2>/dev/null readonly grep echo test
+		echo -eu local local -eu echo "$1" echo | -eu
+| --verbose then "$@" grep | $(pwd) sed --verbose 'quoted text'
+		'quoted text' 'quoted text' /usr/bin
+		--verbose 2>/dev/null ${HOME} local ${HOME} grep --verbose x=1 $(pwd) "$1"
+	grep "$@" done -eu sed $(pwd) then $(pwd)
+		"$@" "$1" "$@" sed then
+	done -eu readonly awk echo cd sed | --verbose ${HOME} then awk local
+awk export "$1" && 2>/dev/null 2>/dev/null -eu | echo
+| test 2>/dev/null "$@" 'quoted text' | test
+	'quoted text' then awk done test export
+export | test then printf 'quoted text' $(pwd) ${HOME} grep test test cd cd
+local | local "$1" readonly
+		then printf local cd awk
+	${HOME} done 'quoted text' | grep && 2>/dev/null /usr/bin local "$@" --verbose $(pwd)
+	then awk local echo x=1 "$@"
+		local ${HOME} 2>/dev/null grep echo sed --verbose "$@" -eu &&
+	test "$@" test awk grep --verbose printf 'quoted text' | cd "$@" -eu && x=1 grep
+	"$1" /usr/bin sed -eu readonly | done x=1 'quoted text' && then -eu "$@"
+	--verbose awk cd local test -eu && | ${HOME} | --verbose
+2>/dev/null awk 'quoted text' echo $(pwd) test "$1" printf 'quoted text'
+		${HOME} --verbose readonly printf export
+grep $(pwd) then done 2>/dev/null done 'quoted text'
+| echo "$@" then awk | export --verbose export
+2>/dev/null | 2>/dev/null | x=1 -eu sed $(pwd) -eu
+	then then printf $(pwd) 'quoted text' | done sed export cd grep
+		'quoted text' grep echo ${HOME} -eu x=1 grep 2>/dev/null done "$1" test
+2>/dev/null && awk grep cd test export "$1" local grep "$@" "$@" export "$@"
+test export --verbose | $(pwd) echo
+	then --verbose 'quoted text' -eu
+cd local readonly -eu --verbose awk grep done test x=1 then printf
+		| "$1" "$1" ${HOME} cd
+	'quoted text' echo readonly 'quoted text' -eu /usr/bin ${HOME}
+		"$1" then && "$1" /usr/bin "$1"
+		export sed echo && cd sed "$@" --verbose sed "$@" local
+echo grep cd --verbose readonly
+	test then readonly echo "$@" awk export
+--verbose then ${HOME} sed done x=1 $(pwd) 'quoted text' ${HOME} printf
+	$(pwd) echo /usr/bin export sed
+	test x=1 ${HOME} grep grep "$1" x=1
+	$(pwd) grep --verbose -eu sed
+sed export local --verbose 'quoted text' 'quoted text' then awk test test $(pwd)
+		local -eu x=1 grep | readonly | printf /usr/bin $(pwd) "$@" echo
+local --verbose -eu 2>/dev/null export awk -eu echo grep done cd
+		then ${HOME} x=1 printf
+		local | printf /usr/bin export export echo
+	-eu export 2>/dev/null $(pwd) done /usr/bin then $(pwd)
+-eu | then && 2>/dev/null done
+	"$@" export sed /usr/bin "$1" done
+		/usr/bin export --verbose export /usr/bin $(pwd) sed &&
+	then done awk 2>/dev/null && awk export ${HOME} /usr/bin && ${HOME} ${HOME} /usr/bin
+	-eu 2>/dev/null cd | 2>/dev/null
+		x=1 "$1" echo awk export | && then then 2>/dev/null 2>/dev/null
+	local then "$@" -eu printf $(pwd) test local echo &&
+		2>/dev/null "$@" x=1
+	printf printf | test then ${HOME} test "$1"
+grep readonly grep 2>/dev/null --verbose grep 2>/dev/null "$1" 'quoted text'
+	"$@" cd --verbose "$1" 'quoted text' -eu
+grep printf "$@" readonly /usr/bin sed
+local awk -eu echo sed x=1 export $(pwd) /usr/bin
+export 2>/dev/null /usr/bin local
+		echo --verbose export 2>/dev/null $(pwd) then then --verbose
+		export /usr/bin done
+		'quoted text' && export -eu cd x=1
+	x=1 -eu | /usr/bin | "$1" -eu "$1" test 2>/dev/null
+		grep sed test then printf 'quoted text' then && grep awk grep | then sed local
+&& $(pwd) 2>/dev/null cd "$@"
+	'quoted text' /usr/bin awk then sed then -eu cd readonly
+2>/dev/null -eu export then test cd "$1" test x=1 printf "$1" sed readonly
+		awk 2>/dev/null then readonly x=1 | done sed done x=1
+	readonly -eu cd sed /usr/bin "$@" --verbose 'quoted text'
+	done cd cd awk --verbose echo |
+		$(pwd) $(pwd) && "$@" printf export 'quoted text' ${HOME} readonly
+	x=1 awk x=1 grep awk test done | test 'quoted text'
+		awk x=1 awk ${HOME} local $(pwd) grep sed --verbose
+		x=1 "$@" | printf ${HOME} x=1 cd 2>/dev/null "$1"
+	"$@" ${HOME} printf cd "$1" sed then printf
+		local /usr/bin 2>/dev/null
+sed ${HOME} grep grep 2>/dev/null $(pwd)
+	test 'quoted text' echo cd export "$@" "$1" cd "$@" export 2>/dev/null $(pwd)
+	echo 2>/dev/null x=1 x=1 "$@" readonly
+	${HOME} --verbose 'quoted text'
+	test "$@" printf 2>/dev/null grep "$1" 'quoted text' local local $(pwd) export
+		${HOME} ${HOME} sed awk x=1
+/usr/bin "$@" sed ${HOME} done "$@" /usr/bin
+-eu readonly 'quoted text'
+	| export "$@" then && 2>/dev/null then x=1 done
+	2>/dev/null done export then
+		cd echo then done sed awk local --verbose awk cd awk 'quoted text' "$1"
+readonly --verbose --verbose && readonly "$1"
+		local test local 'quoted text' local 'quoted text' local
+2>/dev/null && ${HOME} awk &&
+		export "$1" readonly echo printf
+	echo && x=1 sed readonly ${HOME} printf -eu "$@" 2>/dev/null
+	cd cd printf grep export then grep readonly
+--verbose 'quoted text' --verbose "$@"
+		local --verbose then sed ${HOME} sed "$@" test --verbose
+&& echo $(pwd) && awk cd cd "$@" $(pwd)
+	sed cd /usr/bin /usr/bin $(pwd) | grep 'quoted text' readonly readonly printf |
+$(pwd) "$1" export ${HOME} then /usr/bin -eu
+	2>/dev/null test then --verbose
+	'quoted text' 2>/dev/null $(pwd) done && && -eu && sed
+	export local 2>/dev/null 'quoted text' local export x=1 'quoted text'
+		| "$1" "$1" 'quoted text'
+		&& export 'quoted text' then printf then export sed sed export echo x=1 then
+	'quoted text' 'quoted text' "$@" 'quoted text' sed sed "$1" awk /usr/bin
+cd --verbose $(pwd) --verbose "$@" "$@" 'quoted text'
+	"$@" ${HOME} echo "$@" /usr/bin "$1" sed awk ${HOME} --verbose readonly
+	awk $(pwd) printf && echo echo awk test sed ${HOME} test x=1 -eu grep
+2>/dev/null echo "$1" test cd sed -eu readonly
+	&& /usr/bin awk local && --verbose printf /usr/bin
+then && readonly -eu -eu printf grep /usr/bin ${HOME} -eu ${HOME}
+"$1" x=1 /usr/bin -eu sed --verbose sed readonly
+	grep $(pwd) printf ${HOME}
+"$1" printf /usr/bin awk
+	local export $(pwd) done echo printf ${HOME} | x=1 --verbose
+cd && done test sed /usr/bin x=1 | $(pwd) --verbose done echo test test
+		echo echo local | done
+	cd 2>/dev/null "$1" && 2>/dev/null sed "$1" "$1" grep
+		| readonly "$@" cd 2>/dev/null ${HOME} then echo 2>/dev/null export --verbose
+--verbose sed -eu && $(pwd) sed cd x=1 cd "$1" && local awk then cd "$1"
+	${HOME} done $(pwd) then awk readonly 2>/dev/null
+		export then "$@" ${HOME} "$@" cd 'quoted text' test readonly ${HOME}
+done "$1" -eu $(pwd) --verbose "$@"
+then && done printf /usr/bin sed then grep done awk && 'quoted text' | awk $(pwd)
+	done x=1 test cd printf /usr/bin /usr/bin -eu test
+		$(pwd) 'quoted text' printf export $(pwd) /usr/bin 'quoted text'
+	local "$1" local done --verbose then && readonly export x=1 x=1 ${HOME} --verbose
+	done export done | /usr/bin -eu "$@" then
+		-eu printf test then 2>/dev/null then echo echo printf awk "$1" | done awk
+	2>/dev/null | && 2>/dev/null 'quoted text' grep
+readonly "$1" -eu done echo --verbose export
+		test sed && x=1 2>/dev/null "$@" local cd 2>/dev/null then |
+export 'quoted text' printf then printf sed echo "$1" grep --verbose
+		grep awk printf "$@" cd grep awk | && sed awk
+		2>/dev/null test test "$1" 'quoted text' local
+		-eu done "$@" cd 2>/dev/null test && --verbose $(pwd) /usr/bin
+	cd cd -eu done readonly /usr/bin
+		/usr/bin cd sed readonly readonly sed | ${HOME} echo local local printf
+		test export "$1" x=1 | 'quoted text' then 'quoted text' && -eu ${HOME} ${HOME}
+	then ${HOME} ${HOME} echo && "$@"
+		'quoted text' then --verbose then printf cd 'quoted text' test cd "$@"
+		awk sed && grep x=1 "$1" -eu /usr/bin readonly 'quoted text'
+echo 2>/dev/null export
+printf done ${HOME} /usr/bin done -eu export printf local awk echo
+		awk -eu && -eu then test
+		grep then cd "$1" -eu "$@" && done readonly then /usr/bin |
+	$(pwd) done ${HOME} done sed awk | export -eu printf --verbose 2>/dev/null sed
+done "$@" awk ${HOME} sed x=1 | -eu sed export cd "$@" $(pwd)
+		2>/dev/null --verbose local "$1" /usr/bin x=1 then
+${HOME} local | -eu done 2>/dev/null
+	x=1 grep | then then readonly
+	&& awk test 2>/dev/null local awk echo ${HOME} | printf done --verbose && 2>/dev/null
+	local test && && x=1 | "$@" --verbose local
+"$1" cd awk then x=1 2>/dev/null cd 'quoted text' then x=1
+then printf sed printf /usr/bin export done awk then --verbose test done
+		x=1 x=1 "$1" echo | 'quoted text' $(pwd) cd
+		"$@" test grep --verbose local ${HOME} local ${HOME} | then 'quoted text'
+	done then /usr/bin $(pwd) 'quoted text'
+cd test $(pwd) | grep local -eu readonly cd echo sed grep "$@"
+printf x=1 | /usr/bin "$1" | local /usr/bin test printf echo ${HOME}
+		echo awk "$1" "$@" x=1 awk x=1 "$1" 'quoted text'
+	--verbose test && "$1" | sed cd grep $(pwd) grep -eu && 2>/dev/null
+	"$1" "$@" | export echo local export --verbose grep
+	| readonly $(pwd) /usr/bin $(pwd) then | "$@" $(pwd) "$@" done $(pwd) export
+	sed echo 2>/dev/null "$1" --verbose done --verbose printf cd local
+${HOME} | ${HOME} done x=1 ${HOME} 2>/dev/null 2>/dev/null
+		printf export --verbose local | awk -eu cd cd --verbose ${HOME}
+	| $(pwd) ${HOME} 2>/dev/null test done echo grep export
+		"$@" awk ${HOME} 2>/dev/null
+		'quoted text' && -eu -eu && && 'quoted text' 2>/dev/null /usr/bin
+		$(pwd) "$1" done cd $(pwd) "$@"
+$(pwd) -eu printf echo export $(pwd) sed "$@" cd echo then -eu
+		$(pwd) "$@" "$1" readonly -eu printf export done
+		grep x=1 2>/dev/null export cd "$1" 2>/dev/null echo 2>/dev/null
+	| | && "$@" sed printf readonly /usr/bin test sed "$1" 2>/dev/null $(pwd)
+		${HOME} sed /usr/bin grep local "$@" ${HOME} printf grep 'quoted text' export
+	2>/dev/null readonly && readonly | /usr/bin ${HOME} printf 2>/dev/null
+	| /usr/bin /usr/bin then | local 2>/dev/null local sed "$@" 'quoted text'
+readonly echo done cd --verbose
+		| $(pwd) done "$1" cd awk cd && local -eu /usr/bin ${HOME} "$1" grep "$1" --verbose
+awk "$@" echo printf --verbose "$1" sed done $(pwd) local "$1" then cd export
+	then 'quoted text' --verbose x=1 export readonly
+		"$1" x=1 /usr/bin "$1" done | 'quoted text'
+	/usr/bin 2>/dev/null ${HOME} 2>/dev/null --verbose then printf 'quoted text'
+"$@" awk export "$@" --verbose && cd /usr/bin
+	"$@" "$@" then grep export grep test local awk "$1" "$1" ${HOME}
+		then | awk export ${HOME} test sed local local sed
+-eu export echo readonly 2>/dev/null
+		"$1" awk then export /usr/bin -eu done 'quoted text' export echo
+		test local --verbose --verbose
+		printf --verbose "$@" -eu | 'quoted text' export
+printf && $(pwd) sed $(pwd) -eu sed "$1" sed then test -eu "$1"
+	echo && echo && ${HOME} $(pwd) test x=1 2>/dev/null 'quoted text' --verbose
+	then export readonly export "$1" awk printf 'quoted text' && sed ${HOME} /usr/bin
+		sed cd awk | test local ${HOME} sed grep 'quoted text' local
+		then awk $(pwd) done -eu cd readonly | --verbose 2>/dev/null echo
+	awk ${HOME} x=1 | test readonly printf | && /usr/bin printf readonly export readonly
+-eu 2>/dev/null x=1 cd && sed /usr/bin
+	echo "$1" ${HOME} "$1" test ${HOME}
+$(pwd) $(pwd) test x=1 2>/dev/null 'quoted text' done ${HOME} then
+	/usr/bin 2>/dev/null cd grep /usr/bin && done readonly echo printf cd test export
+		| local printf awk /usr/bin $(pwd) $(pwd) readonly readonly readonly $(pwd)
+	readonly --verbose "$1" 'quoted text' sed "$1" $(pwd)
+	--verbose 2>/dev/null 2>/dev/null awk sed -eu export awk
+--verbose test "$1" -eu 'quoted text' $(pwd) then 'quoted text' "$1" then ${HOME}
+		${HOME} awk /usr/bin printf then
+x=1 then done cd cd export 2>/dev/null done sed local local printf
+"$1" local /usr/bin export $(pwd) echo grep /usr/bin grep done
+		x=1 test cd printf done && /usr/bin readonly done grep "$@" $(pwd) export done
+	printf echo sed /usr/bin then grep awk ${HOME} "$@"
+		"$1" --verbose done $(pwd) test printf "$1" && export awk sed sed then && "$1"
+		x=1 export "$1" echo grep echo grep --verbose | cd "$1" | local
+	cd done $(pwd) local -eu /usr/bin grep readonly awk && $(pwd) then readonly
+		local --verbose readonly test 2>/dev/null
+	local test export test sed then export --verbose $(pwd) readonly
+	awk -eu test && awk $(pwd) printf 2>/dev/null
+		local /usr/bin export readonly | grep then 'quoted text' then
+awk export $(pwd) echo test
+		then awk then | ${HOME} ${HOME} test /usr/bin
+		readonly "$@" "$@" --verbose
+export then -eu awk cd | readonly
+		cd $(pwd) test $(pwd) "$@" echo awk x=1 --verbose --verbose x=1 readonly
+	printf test then printf then
+	test ${HOME} cd awk /usr/bin readonly printf
+x=1 && | 2>/dev/null local ${HOME} "$@" ${HOME}
+		${HOME} test awk test grep -eu grep printf "$@" grep
+	--verbose ${HOME} $(pwd)
+readonly 2>/dev/null then printf "$@" then local readonly test 'quoted text'
+	"$1" "$1" grep "$1" cd done local --verbose readonly then x=1 test
+'quoted text' | -eu "$@" local -eu printf
+	/usr/bin echo cd /usr/bin 2>/dev/null
+		| test /usr/bin test && export && done
+		awk test 2>/dev/null
+		| then printf sed -eu "$@" grep echo then "$@" 'quoted text'
+	export export then export grep "$@"
+${HOME} echo --verbose printf done -eu $(pwd)
+cd /usr/bin awk -eu printf --verbose
+	local | $(pwd) x=1 cd printf cd export echo "$1"
+local -eu --verbose done x=1 sed echo test done -eu test
+		cd x=1 ${HOME} awk done cd "$1" "$1" then | local | done /usr/bin
+		x=1 local ${HOME} --verbose && |
+"$1" test /usr/bin echo x=1
+		readonly && 2>/dev/null cd test done awk test awk awk cd export
+"$@" ${HOME} ${HOME} --verbose local "$@"
+2>/dev/null cd grep --verbose ${HOME} --verbose
+		cd $(pwd) test -eu 2>/dev/null printf ${HOME} -eu cd test sed
+	cd local sed --verbose test readonly /usr/bin sed awk 'quoted text'
+		grep sed export grep then test done ${HOME}
+/usr/bin 'quoted text' test grep cd grep
+"$1" x=1 /usr/bin local $(pwd) then -eu printf test echo grep sed -eu
+cd && && sed 2>/dev/null test
+		&& awk local cd test grep
+		sed $(pwd) ${HOME} ${HOME} 2>/dev/null sed
+export 2>/dev/null echo export
+	${HOME} grep ${HOME} test -eu 2>/dev/null && sed cd done
+	| sed && local 'quoted text' "$1" | cd then export local --verbose grep grep
+	readonly grep printf printf x=1 grep /usr/bin "$@" local
+	${HOME} cd sed test test grep test
+	&& printf "$@" local "$1" --verbose
+cd then /usr/bin then && | sed
+		${HOME} /usr/bin 2>/dev/null /usr/bin then 2>/dev/null $(pwd)
+	/usr/bin -eu ${HOME} local cd cd ${HOME} --verbose sed --verbose awk test "$@"
+	printf ${HOME} local x=1 cd 2>/dev/null $(pwd) 'quoted text' ${HOME}
+	"$@" awk sed "$1" readonly --verbose $(pwd) -eu local done
+	x=1 export local echo grep export export then sed readonly
+		grep -eu ${HOME} | export
+		sed "$1" test cd /usr/bin then grep 2>/dev/null 'quoted text'
+"$@" readonly 'quoted text' export readonly local awk | | "$@"
+	sed 2>/dev/null $(pwd) /usr/bin
+$(pwd) sed done --verbose then awk $(pwd) done | ${HOME} then
+2>/dev/null | && cd awk --verbose sed printf "$1"
+	$(pwd) -eu | x=1 && done printf echo 2>/dev/null awk
+${HOME} && -eu "$@" --verbose export 2>/dev/null cd && readonly &&
+done local echo | /usr/bin cd ${HOME} echo grep sed "$1" echo --verbose
+		done echo cd then local printf
+		local test -eu done $(pwd) /usr/bin readonly --verbose then --verbose
+	--verbose 2>/dev/null && done 2>/dev/null
+printf then x=1 'quoted text' grep --verbose test awk grep grep -eu
+		'quoted text' "$@" -eu cd && echo | done grep echo awk export
+		"$1" test awk && local --verbose 'quoted text'
+	2>/dev/null "$@" -eu --verbose ${HOME} test "$@" -eu /usr/bin
+	'quoted text' echo $(pwd) "$1" ${HOME} cd export done readonly done
+readonly $(pwd) grep sed "$@" | 2>/dev/null test
+/usr/bin grep x=1 --verbose | "$@" done x=1 cd printf -eu echo
+	export $(pwd) printf then "$@" 2>/dev/null
+		export /usr/bin grep local && awk export /usr/bin grep
+		"$1" test then awk /usr/bin
+	export && done ${HOME} | echo | && 'quoted text'
+	'quoted text' | sed 2>/dev/null
+	"$1" $(pwd) awk cd 'quoted text' --verbose local done local x=1 then grep then cd
+	${HOME} grep printf "$1" 2>/dev/null 2>/dev/null
+		cd /usr/bin | test && /usr/bin done
+		"$1" "$1" export x=1 local -eu "$@" "$@" --verbose sed 2>/dev/null
+		--verbose && sed printf echo local
+		'quoted text' readonly printf
+sed && --verbose done ${HOME} "$1" 2>/dev/null | --verbose 2>/dev/null
+	$(pwd) grep x=1 echo x=1 | --verbose
+2>/dev/null echo readonly $(pwd) /usr/bin |
+		${HOME} 'quoted text' /usr/bin then -eu ${HOME} awk test echo sed -eu
+test "$1" | && awk 2>/dev/null | "$@"
+then /usr/bin 2>/dev/null echo readonly -eu echo then then local grep
+	cd 2>/dev/null 2>/dev/null test "$1" -eu sed export
+sed 'quoted text' /usr/bin sed grep
+	2>/dev/null x=1 x=1 -eu -eu "$@" && && "$@" x=1 2>/dev/null test 2>/dev/null local
+&& "$@" 'quoted text' then
+cd | local -eu readonly x=1 -eu
+		readonly ${HOME} echo -eu "$1" printf "$@"
+readonly "$@" -eu grep sed then printf -eu "$1" && "$1" done
+		printf "$@" export echo cd sed "$@" grep readonly -eu $(pwd) ${HOME} "$@"
+x=1 'quoted text' grep echo /usr/bin echo x=1 done | /usr/bin 'quoted text'
+	&& && ${HOME} awk grep readonly
+/usr/bin /usr/bin echo -eu echo "$@" ${HOME} "$1" echo $(pwd) && ${HOME} --verbose
+done /usr/bin cd x=1 readonly test grep grep grep ${HOME}
+		grep /usr/bin then echo "$1" x=1 sed --verbose | ${HOME}
+		awk awk | "$@" /usr/bin "$1" ${HOME} readonly /usr/bin x=1 local x=1
+export 2>/dev/null echo && --verbose
+		&& echo | $(pwd) grep then done --verbose 2>/dev/null 'quoted text'
+	"$1" test sed && readonly test awk test 'quoted text'
+done local cd 2>/dev/null /usr/bin
+	"$1" printf awk done export readonly
+		'quoted text' done && |
+		&& export 'quoted text'
+	-eu then 2>/dev/null ${HOME} test && export ${HOME} /usr/bin readonly
+		/usr/bin && local export export printf 2>/dev/null
+	x=1 local 'quoted text' awk /usr/bin done readonly done
+"$@" printf 2>/dev/null "$@" sed local export test ${HOME} $(pwd) "$@" local test
+"$1" --verbose "$1" ${HOME}
+echo 'quoted text' "$@" sed "$1" readonly
+		printf local && $(pwd) --verbose test
+then && then --verbose -eu grep grep -eu readonly |
+'quoted text' echo $(pwd) $(pwd) export --verbose ${HOME}
+	${HOME} 2>/dev/null done printf
+		awk | echo export "$@" printf test cd 2>/dev/null 'quoted text'
+	then export printf readonly export readonly done
+	2>/dev/null grep 2>/dev/null sed $(pwd) x=1
+	-eu 2>/dev/null test awk && "$1"
+	done -eu $(pwd) /usr/bin | /usr/bin "$1" local sed 2>/dev/null export done done
+	$(pwd) "$@" 'quoted text' then test then
+		sed echo -eu | awk done
+&& local $(pwd) readonly $(pwd) $(pwd) test echo echo
+	echo $(pwd) awk printf ${HOME}
+	echo then test echo 'quoted text'
+		&& cd cd grep export echo "$1" echo x=1 awk export cd &&
+		"$1" x=1 grep export 2>/dev/null readonly test x=1 'quoted text' && cd cd local
+--verbose x=1 done $(pwd) readonly sed "$@" $(pwd) export
+&& sed "$1" x=1 "$@" && local "$@" /usr/bin
+	"$1" printf export sed grep 2>/dev/null
+		$(pwd) 2>/dev/null grep && printf $(pwd)
+cd "$@" $(pwd) then echo test $(pwd) | x=1 x=1 /usr/bin 2>/dev/null awk sed echo
+		"$1" awk ${HOME} cd ${HOME} local --verbose readonly 2>/dev/null 'quoted text'
+2>/dev/null 2>/dev/null echo local test cd local x=1 echo
+test x=1 cd done /usr/bin "$@" local done $(pwd) local x=1 sed "$1" test
+	test printf then 'quoted text' 'quoted text' "$@"
+		x=1 grep /usr/bin "$@" done && local x=1 echo
+	export "$1" --verbose --verbose
+grep "$@" printf && then 'quoted text' "$@"
+		sed test sed done 2>/dev/null
+		--verbose then "$@" 2>/dev/null readonly $(pwd) ${HOME} local x=1 /usr/bin
+then local ${HOME} local printf && awk &&
+		cd x=1 export && grep then -eu test readonly
+	local "$@" 2>/dev/null then
+	sed awk --verbose printf then -eu done export ${HOME} readonly
+	| 'quoted text' echo /usr/bin "$@" "$1" --verbose local
+local local 'quoted text' 'quoted text'
+		printf cd $(pwd) x=1 x=1 awk --verbose "$1" grep 2>/dev/null
+		"$@" test -eu ${HOME} cd
+		done /usr/bin 2>/dev/null awk
+		export local echo grep then
+		"$@" echo sed /usr/bin awk | "$@" local "$@"
+	awk export /usr/bin test printf --verbose 2>/dev/null
+		-eu $(pwd) $(pwd) sed "$@" readonly | printf -eu export sed readonly
+		"$@" x=1 "$1" test | /usr/bin cd test
+local done --verbose sed export && cd -eu "$@" "$@" ${HOME}
+		| && done "$1" $(pwd) $(pwd) | sed 2>/dev/null test then
+		'quoted text' echo then sed "$@"
+		| then /usr/bin 2>/dev/null printf awk local export 'quoted text' ${HOME}
+	$(pwd) x=1 ${HOME} 'quoted text' printf "$@" test $(pwd) "$@" done
+		x=1 /usr/bin sed printf then test 2>/dev/null $(pwd)
+		done echo echo && then then "$1" 'quoted text' done ${HOME} cd $(pwd) ${HOME}
+"$@" export awk 'quoted text' x=1 test x=1 grep && test 'quoted text' cd grep
+-eu then "$@" | cd /usr/bin "$@" printf
+	-eu printf ${HOME} | "$@"
+		sed ${HOME} ${HOME} --verbose test cd export -eu export 'quoted text'
+	export export export |
+		done readonly | x=1 echo 2>/dev/null | sed sed $(pwd) 2>/dev/null
+	done "$1" printf --verbose export test | 'quoted text'
+'quoted text' /usr/bin cd "$@" echo x=1 awk
+sed grep printf printf sed awk 'quoted text'
+	&& $(pwd) echo then echo cd then export
+		grep readonly x=1 readonly | $(pwd) awk awk -eu echo echo "$@"
+'quoted text' test readonly test done
+test done --verbose awk x=1 grep 'quoted text' printf test 'quoted text'
+x=1 2>/dev/null /usr/bin awk
+'quoted text' --verbose
+	local | ${HOME} echo then --verbose
+		awk --verbose /usr/bin 2>/dev/null
+		&& ${HOME} sed export printf
+	printf local export "$@" sed -eu && "$@" "$@" cd readonly "$@" "$@" done done
+awk echo done printf awk --verbose printf done printf
+export test $(pwd) local awk -eu export /usr/bin cd /usr/bin ${HOME} x=1 $(pwd)
+		grep ${HOME} then | readonly x=1
+done test echo "$1" x=1 test test 2>/dev/null
+readonly ${HOME} awk echo
+		| "$@" then 2>/dev/null -eu echo awk "$1" then test
+done "$@" "$@" "$@" "$@" | $(pwd) --verbose local
+		'quoted text' 'quoted text' 'quoted text' "$1" test --verbose "$1" grep
+		export $(pwd) --verbose --verbose | grep -eu -eu sed then && printf &&
+/usr/bin echo x=1 done ${HOME}
+	'quoted text' -eu $(pwd) printf 'quoted text'
+$(pwd) --verbose 'quoted text' $(pwd) sed
+	sed export grep && cd export ${HOME} x=1 grep done | ${HOME} x=1 'quoted text'
+printf sed 'quoted text' -eu x=1 "$@" export
+	/usr/bin echo then "$1" cd cd "$@" echo export readonly
+	sed test awk sed /usr/bin cd test ${HOME} | && export
+	test | $(pwd) --verbose echo
+$(pwd) done | "$1" readonly export "$@" | local
+	$(pwd) /usr/bin x=1 done export 2>/dev/null export grep -eu 'quoted text'
+readonly then "$1" | test "$1" ${HOME} | && grep "$@"
+&& sed test ${HOME} printf printf
+	${HOME} --verbose -eu 2>/dev/null sed test --verbose
+		2>/dev/null export printf printf test 2>/dev/null local --verbose && | /usr/bin
+	printf awk cd $(pwd) $(pwd)
+	$(pwd) ${HOME} $(pwd) done ${HOME} local 'quoted text'
+	echo printf echo test test awk done awk printf sed ${HOME} -eu |
+		export -eu --verbose printf "$1" $(pwd) printf x=1 printf readonly --verbose
+done | ${HOME} --verbose ${HOME} "$@" && sed echo 'quoted text'
+export cd -eu done local -eu 'quoted text'
+$(pwd) readonly sed echo "$@" --verbose /usr/bin
+"$@" ${HOME} "$@" /usr/bin readonly grep /usr/bin ${HOME} | cd grep cd 'quoted text'
+	echo | ${HOME} $(pwd) ${HOME} sed awk "$@" done
+	export export 2>/dev/null export "$@" awk cd "$1" x=1 test printf $(pwd)
+		then cd 2>/dev/null test test local grep readonly then readonly "$@" --verbose
+	"$@" then local awk sed sed
+-eu echo cd grep 'quoted text' grep grep
+		'quoted text' test ${HOME}
+	${HOME} -eu cd 'quoted text' printf done $(pwd) -eu local && ${HOME} grep sed export
+sed /usr/bin && cd test --verbose test | echo sed
+2>/dev/null 2>/dev/null then
+test printf cd export ${HOME} && "$1" grep echo printf 'quoted text' then printf
+grep echo | /usr/bin readonly readonly echo x=1 then --verbose sed export then
+	local export x=1 2>/dev/null awk printf local then "$@" x=1 awk then
+	local "$1" grep sed readonly | sed ${HOME}
+$(pwd) test /usr/bin 'quoted text' ${HOME} --verbose "$@" --verbose
+$(pwd) -eu 'quoted text' local "$@" &&
+		"$@" /usr/bin ${HOME} /usr/bin test "$1" grep printf awk done
+'quoted text' test echo --verbose local "$1" echo -eu grep 'quoted text'
+&& grep grep export cd /usr/bin
+		${HOME} | /usr/bin $(pwd) && readonly x=1 x=1 echo awk
+'quoted text' "$@" $(pwd) /usr/bin "$@" readonly echo
+		| echo then "$1" $(pwd) | awk then readonly sed grep done x=1 printf sed
+		printf 2>/dev/null /usr/bin | printf "$@" x=1 test /usr/bin ${HOME} local "$1"
+	x=1 -eu printf grep 2>/dev/null ${HOME} printf "$@" sed awk grep /usr/bin --verbose
+	2>/dev/null -eu -eu local | grep
+		printf x=1 then echo grep local readonly -eu && | x=1
+	grep then "$@" 'quoted text'
+| /usr/bin grep 2>/dev/null 2>/dev/null 2>/dev/null awk awk awk
+		&& ${HOME} -eu readonly done then $(pwd) awk | sed cd --verbose
+		'quoted text' "$@" done printf test ${HOME}
+#include c22.sh
+		grep 2>/dev/null 2>/dev/null 2>/dev/null && 'quoted text' "$@"
+then | then grep test readonly
+		${HOME} -eu echo --verbose then
+| /usr/bin /usr/bin cd -eu $(pwd)
+		-eu done test readonly 'quoted text' && | x=1 --verbose then then "$1" x=1 /usr/bin
+	printf awk ${HOME} --verbose 'quoted text'
+	then test printf x=1 done ${HOME} -eu then local sed readonly
+printf 2>/dev/null awk 2>/dev/null
+		local 'quoted text' /usr/bin sed 2>/dev/null done
+	$(pwd) awk readonly "$@" | 'quoted text'
+	printf | sed x=1 sed export
+cd 2>/dev/null "$1" ${HOME} -eu /usr/bin "$1" && done x=1
+		&& echo $(pwd) echo then echo grep /usr/bin awk awk | /usr/bin ${HOME}
+		local awk local ${HOME} sed test 2>/dev/null && && local /usr/bin printf
+		$(pwd) | -eu readonly readonly cd
+		grep export awk echo | printf 2>/dev/null test grep $(pwd) test
+&& | readonly echo readonly --verbose 2>/dev/null
+	echo awk x=1 grep ${HOME} 2>/dev/null
+${HOME} grep -eu $(pwd) readonly
+	/usr/bin --verbose ${HOME} 2>/dev/null
+	-eu test "$1" $(pwd) awk
+"$1" 2>/dev/null export echo export
+local 'quoted text' done then $(pwd) 2>/dev/null cd | ${HOME} local test $(pwd)
+${HOME} printf then 'quoted text' readonly -eu 2>/dev/null -eu /usr/bin 'quoted text'
+	grep local -eu readonly readonly done local 2>/dev/null readonly
+		/usr/bin export && cd && export /usr/bin sed $(pwd)
+printf echo readonly --verbose export "$1" | $(pwd) cd grep 'quoted text' x=1
+awk done ${HOME} | cd "$1" | "$1"
+done "$1" export $(pwd) x=1 $(pwd) ${HOME} local echo sed awk awk x=1 local
+		sed sed local export --verbose | grep sed --verbose grep
+		local "$@" cd printf && | | grep then local done sed "$1" | export echo
+--verbose printf $(pwd) readonly -eu readonly | x=1
+	x=1 -eu && done && | ${HOME} grep awk export export
+	-eu && | --verbose done
+		| "$1" echo local | 2>/dev/null "$1" "$@" "$@" $(pwd)
+		grep readonly cd cd --verbose export export -eu awk --verbose
+test printf grep 2>/dev/null 'quoted text'
+	local /usr/bin -eu done local grep then -eu awk sed cd grep 2>/dev/null $(pwd)
+		'quoted text' -eu -eu cd x=1 readonly done && /usr/bin readonly
+	2>/dev/null awk test test /usr/bin
+	${HOME} "$1" readonly cd cd 2>/dev/null done awk awk
+done $(pwd) ${HOME} readonly cd local /usr/bin awk "$@" "$1"
+		readonly --verbose ${HOME} awk $(pwd) grep 'quoted text'
+		grep export export cd | 2>/dev/null -eu && test "$1" --verbose
+		test done test echo test export readonly $(pwd) done export printf readonly
+2>/dev/null "$@" "$1" then printf export sed grep
+		local $(pwd) echo printf echo && sed done "$1" && 'quoted text' printf readonly
+	&& test 'quoted text' then "$@" x=1 x=1 grep "$1" "$1" cd x=1 /usr/bin
+	&& --verbose -eu test local "$1" echo then x=1 test echo /usr/bin
+	readonly --verbose done sed printf echo ${HOME} export
+		export --verbose then awk grep "$@" done awk /usr/bin
+		grep | | printf /usr/bin "$@" grep export grep
+awk export printf | cd "$1" grep -eu --verbose grep ${HOME} local && 2>/dev/null
+		--verbose export && done --verbose sed "$1" 2>/dev/null
+awk ${HOME} "$@" then done readonly grep
+'quoted text' sed then readonly
+readonly export x=1 x=1 readonly readonly
+	"$1" $(pwd) readonly done
+	sed --verbose sed | printf then then grep test $(pwd) test printf
+	--verbose then x=1 grep "$@" $(pwd) ${HOME}
+		$(pwd) ${HOME} test export echo
+		$(pwd) "$@" -eu local && "$@" done --verbose 'quoted text' ${HOME}
+grep -eu "$@" "$@" then readonly then readonly
+	grep $(pwd) ${HOME} local
+		/usr/bin awk local echo x=1 printf awk test awk /usr/bin /usr/bin
+	printf awk $(pwd) -eu -eu echo x=1 done
+	x=1 export "$1" test -eu 2>/dev/null x=1
+		${HOME} test | --verbose "$@" export x=1 export x=1 test -eu sed local --verbose
+printf done $(pwd) cd --verbose ${HOME} 2>/dev/null
+	awk grep grep && export -eu "$@" cd -eu then 2>/dev/null export
+		"$@" 'quoted text' ${HOME}
+grep done "$1" --verbose 2>/dev/null "$@" && $(pwd) awk echo x=1 -eu "$@"
+		done $(pwd) | --verbose printf export done
+	"$1" export readonly done
+/usr/bin | | echo awk echo "$@" | && printf 2>/dev/null
+"$@" local awk then done cd $(pwd) grep grep 'quoted text' x=1 local
+		'quoted text' --verbose 2>/dev/null x=1 printf "$1" $(pwd) 2>/dev/null printf readonly
+	$(pwd) export ${HOME} ${HOME}
+"$@" $(pwd) 'quoted text' test --verbose printf readonly | echo cd echo export cd
+	cd local printf sed test echo test ${HOME} then x=1 /usr/bin export
+	printf test grep "$1" $(pwd) "$1" x=1 echo ${HOME} sed "$1" awk
+		awk printf 'quoted text' 'quoted text' "$1" 2>/dev/null test export awk done /usr/bin
+		done && sed "$1" && --verbose
+"$@" "$1" readonly 'quoted text'
+		${HOME} sed && echo local done echo then grep
+		test printf /usr/bin printf test 2>/dev/null readonly awk $(pwd) echo
+		test x=1 -eu -eu done printf && -eu "$1" "$@" x=1 ${HOME} 'quoted text'
+2>/dev/null $(pwd) && -eu && readonly 2>/dev/null cd cd ${HOME} -eu
+	grep -eu printf "$1" printf
+	&& then grep --verbose -eu "$@" echo test grep test done /usr/bin
+		--verbose --verbose printf "$1" --verbose sed export
+$(pwd) "$1" test readonly "$@" $(pwd) "$@" cd export 'quoted text' cd /usr/bin
+'quoted text' printf "$1" awk sed
+test export | done $(pwd) sed $(pwd) cd x=1 printf echo && -eu
+printf x=1 local grep $(pwd) "$@" -eu export
+		test "$1" 2>/dev/null printf then $(pwd) $(pwd) cd 'quoted text' sed
+		cd ${HOME} "$@" local awk grep -eu test echo export done
+	2>/dev/null /usr/bin x=1
+export local grep grep 'quoted text' -eu "$@" grep $(pwd) grep
+		sed local then | test printf
+printf 'quoted text' $(pwd) printf 2>/dev/null printf $(pwd)
+	awk grep export 2>/dev/null export
+		/usr/bin --verbose /usr/bin x=1 awk ${HOME} grep 2>/dev/null echo awk test "$@"
+	grep 2>/dev/null 'quoted text' /usr/bin | test
+	| sed grep grep ${HOME} sed -eu sed readonly grep sed "$1" /usr/bin echo
+		then local --verbose sed && readonly && awk grep | && x=1 awk 'quoted text' -eu
+		| 2>/dev/null awk "$@" grep then readonly then done then x=1 'quoted text' cd
+grep ${HOME} -eu printf export sed 2>/dev/null cd readonly local
+"$1" -eu then awk 'quoted text' ${HOME} cd sed sed test then cd printf printf "$@"
+--verbose grep "$1" cd export /usr/bin /usr/bin /usr/bin | && local "$1"
+awk awk $(pwd) /usr/bin export test printf awk 'quoted text'
+		-eu sed 2>/dev/null 'quoted text'
+	awk echo /usr/bin local
+		awk awk test test 'quoted text' "$1" /usr/bin export 'quoted text'
+		then printf grep local --verbose && local -eu done "$1" cd && -eu printf echo
+	echo x=1 export printf -eu sed grep export then export
+echo 2>/dev/null local "$@" sed awk -eu $(pwd) readonly
+	then awk x=1 done grep test /usr/bin echo 2>/dev/null export local local -eu
+	readonly awk "$1" local "$@" echo /usr/bin ${HOME} "$@" "$@" then /usr/bin
+	x=1 printf sed "$1" | echo cd printf grep
+		&& export /usr/bin local ${HOME} echo --verbose local 'quoted text'
+		"$@" -eu $(pwd) 2>/dev/null local 'quoted text' "$@" && sed ${HOME} 2>/dev/null
+		$(pwd) awk 'quoted text' awk test -eu /usr/bin 'quoted text'
+/usr/bin test "$1" then printf | test export /usr/bin cd export "$@"
+		-eu done /usr/bin && -eu export readonly sed done 'quoted text' printf
+		&& sed cd done grep printf then done awk sed awk &&
+${HOME} --verbose done done $(pwd) x=1 local awk then | && readonly
+${HOME} test done echo 'quoted text'
+--verbose awk /usr/bin grep export ${HOME} 'quoted text' grep echo /usr/bin
+	$(pwd) "$1" 'quoted text' awk /usr/bin "$@" then "$1"
+	-eu grep sed echo echo $(pwd) /usr/bin done --verbose 2>/dev/null grep
+	done sed awk 'quoted text'
+		grep 2>/dev/null awk "$1" grep local printf
+2>/dev/null $(pwd) -eu local "$1" test then export /usr/bin --verbose
+		/usr/bin "$1" test $(pwd) cd sed $(pwd) printf
+awk 'quoted text' $(pwd) export 2>/dev/null "$1" echo
+	then 2>/dev/null then readonly export then local ${HOME} printf "$@" then local
+awk echo readonly export
+	printf sed /usr/bin x=1 grep then | done
+--verbose ${HOME} "$@" && export cd x=1 local
+	readonly local readonly | printf grep -eu ${HOME} grep test "$@" sed export
+	x=1 /usr/bin grep ${HOME} awk echo | test echo && test local --verbose $(pwd)
+		echo 'quoted text' echo awk --verbose --verbose | sed export printf && -eu
+-eu 2>/dev/null cd "$1" then done x=1 | $(pwd) awk done local echo test
+readonly export test --verbose --verbose
+	local grep cd | cd && cd 2>/dev/null export $(pwd) export cd grep ${HOME}
+done --verbose local "$@" export "$1"
+		local sed -eu && printf sed 'quoted text' | $(pwd) printf 'quoted text'
+	x=1 | export then grep then echo -eu sed echo grep
+		${HOME} 2>/dev/null then $(pwd)
+	"$1" /usr/bin $(pwd) -eu $(pwd) "$@" -eu grep "$1"
+		test | test "$@" 'quoted text' "$@" -eu /usr/bin echo /usr/bin done
+		then "$1" done echo then grep test
+${HOME} --verbose /usr/bin test printf /usr/bin $(pwd) $(pwd)
+	'quoted text' /usr/bin
+		done | then sed && $(pwd) export
+	--verbose export | && readonly printf test -eu
+	/usr/bin test grep 'quoted text' 2>/dev/null
+		sed awk /usr/bin --verbose "$1" export echo /usr/bin && /usr/bin
+	export 'quoted text' sed test | readonly /usr/bin ${HOME} sed awk echo
+		printf printf cd ${HOME} done then | $(pwd) sed
+		echo export | 'quoted text' export x=1 2>/dev/null
+	'quoted text' "$@" export test 2>/dev/null local x=1 echo done /usr/bin
+		export then printf --verbose -eu printf x=1 $(pwd) then
+&& test awk local x=1 sed echo export cd local done --verbose cd 'quoted text'
+		grep echo then --verbose -eu
+	'quoted text' -eu ${HOME} "$1" grep "$@" echo local --verbose
+x=1 cd printf -eu grep export "$@" 2>/dev/null
+		local grep ${HOME} | && 2>/dev/null echo export
+	readonly export sed /usr/bin ${HOME} 'quoted text'
+"$@" $(pwd) grep "$1" sed awk readonly | sed /usr/bin 'quoted text'
+	"$1" readonly sed && -eu grep cd | "$1" export /usr/bin grep "$1" local
+	--verbose cd readonly cd "$1" | readonly
+		readonly ${HOME} 2>/dev/null | local
+readonly awk "$1" then 2>/dev/null
+		| -eu readonly | --verbose cd "$1" readonly sed "$@" && grep cd &&
+then --verbose 'quoted text' "$1" $(pwd)
+	grep test readonly then then x=1 ${HOME}
+		done export done echo grep sed
+		awk "$@" awk | test cd -eu "$@" &&
+		then x=1 done printf && local done test done done done
+echo printf then grep --verbose "$@" && "$@" -eu
+		$(pwd) -eu | done --verbose awk
+	--verbose x=1 ${HOME} "$@" --verbose grep
+	'quoted text' local "$@" "$1" -eu sed x=1 echo local sed ${HOME} --verbose
+		"$@" local ${HOME} $(pwd)
+-eu local printf sed 'quoted text' -eu /usr/bin
+	--verbose | --verbose test x=1 local sed -eu test "$1" done "$1" export /usr/bin
+		/usr/bin && awk cd --verbose ${HOME} sed --verbose
+grep ${HOME} local local ${HOME}
+&& sed --verbose grep ${HOME} "$@" "$@" readonly
+	-eu awk export test /usr/bin
+		local echo grep local done export /usr/bin
+	export readonly --verbose 2>/dev/null
+		done grep test | printf echo --verbose x=1 2>/dev/null --verbose
+		x=1 readonly && echo "$1"
+		--verbose printf done | "$1" awk && export --verbose
+echo export --verbose | local awk --verbose local test ${HOME} $(pwd)
+		test x=1 $(pwd) $(pwd) "$@" /usr/bin printf
+	'quoted text' x=1 readonly /usr/bin sed x=1
+printf cd ${HOME} test
+	awk -eu && export $(pwd)
+sed "$@" | cd export grep echo then ${HOME} local -eu 'quoted text'
+echo echo cd -eu 'quoted text' awk $(pwd) x=1 -eu awk
+"$1" done then && $(pwd) && /usr/bin printf "$@"
+		printf cd | /usr/bin "$1" 2>/dev/null export grep local printf echo done cd
+	echo awk then $(pwd) /usr/bin readonly grep awk awk sed test done
+	awk test && 2>/dev/null printf $(pwd)
+		"$@" && | && 'quoted text' -eu "$@" echo 'quoted text'
+done awk $(pwd) "$@" awk 2>/dev/null
+		cd -eu done echo echo -eu 'quoted text'
+		| && /usr/bin local &&
+'quoted text' /usr/bin readonly echo
+	echo --verbose "$@" 'quoted text' export 'quoted text' sed
+		"$1" -eu --verbose printf
+		then awk && readonly readonly -eu
+awk 'quoted text' export x=1 then
+	printf sed local /usr/bin -eu -eu printf cd printf -eu $(pwd) echo /usr/bin echo
+readonly grep done local echo "$@" | --verbose $(pwd) done && cd
+grep "$@" echo done --verbose "$@" 2>/dev/null "$@" export /usr/bin
+	readonly && printf && then readonly done readonly sed ${HOME} "$@" "$1" && | export
+sed test -eu echo printf --verbose $(pwd) done x=1 'quoted text'
+		export 2>/dev/null -eu | /usr/bin
+test grep awk ${HOME} then "$1" x=1 awk 2>/dev/null awk local test $(pwd)
+	&& "$1" && test cd ${HOME} then x=1
+	/usr/bin printf printf printf /usr/bin echo x=1
+	export "$@" awk done test then 2>/dev/null
+	sed done 2>/dev/null echo 2>/dev/null
+		cd cd -eu --verbose ${HOME} ${HOME} $(pwd) readonly x=1 "$1" cd "$1" 'quoted text'
+		sed done then 'quoted text' x=1 grep
+		printf printf printf && readonly
+"$1" "$@" /usr/bin 'quoted text'
+	grep | cd awk ${HOME} echo done ${HOME}
+		&& echo cd then then done --verbose 'quoted text'
+		${HOME} "$@" && --verbose test cd readonly
+	awk 'quoted text' test 'quoted text' | 2>/dev/null local grep -eu export
+	local 'quoted text' readonly 'quoted text' "$@" done done ${HOME} local
+	sed "$1" $(pwd) x=1 local sed
+done 2>/dev/null 'quoted text' --verbose | | local ${HOME} 2>/dev/null
+		printf awk awk /usr/bin printf local $(pwd) test "$@" awk /usr/bin
+	&& x=1 "$1" readonly | then "$1" grep 'quoted text' cd ${HOME} $(pwd) x=1
+	--verbose readonly x=1 test export test test
+		"$@" done sed export local printf /usr/bin
+	awk $(pwd) "$@" && /usr/bin grep cd test done
+/usr/bin echo | local "$1" 2>/dev/null x=1 &&
+		cd 'quoted text' grep --verbose grep && --verbose
+		sed 'quoted text' -eu "$@"
+		"$1" && printf cd local awk
+		'quoted text' 'quoted text'
+	local grep cd x=1 export x=1 awk then $(pwd) "$1" x=1 | awk awk 2>/dev/null x=1
+	"$1" test awk "$@" local x=1 local 2>/dev/null printf 'quoted text' test cd cd
+export export echo echo 'quoted text' readonly cd /usr/bin
+	'quoted text' 2>/dev/null -eu
+	local 2>/dev/null 2>/dev/null local "$@"
+done awk awk 2>/dev/null echo grep readonly local ${HOME} "$1" -eu cd awk
+cd sed awk cd | 2>/dev/null readonly local 'quoted text' test local
+2>/dev/null cd readonly awk -eu 2>/dev/null
+	${HOME} $(pwd) sed export sed echo "$1" "$1" sed && --verbose
+echo then 'quoted text' echo | local -eu --verbose $(pwd) "$@" | cd --verbose
+		done sed awk /usr/bin 'quoted text' | test ${HOME} 2>/dev/null done done echo grep
+		printf --verbose | $(pwd) "$@" printf readonly
+done && grep awk cd -eu && done grep printf grep printf
+		/usr/bin "$@" awk /usr/bin /usr/bin cd then $(pwd) 2>/dev/null export
+		export cd echo ${HOME} && awk export && && sed x=1
+	| export awk echo 'quoted text' | awk x=1 'quoted text' && test echo
+		&& cd && awk 2>/dev/null --verbose --verbose echo export ${HOME} cd export echo
+then export printf printf test | $(pwd)
+readonly ${HOME} export awk readonly awk /usr/bin cd awk sed
+-eu test | grep cd grep && local /usr/bin echo grep done | awk x=1 --verbose
+printf $(pwd) test sed /usr/bin x=1
+	sed printf then echo --verbose printf x=1 test "$@" ${HOME}
+		$(pwd) -eu x=1 x=1 sed 2>/dev/null then $(pwd) --verbose local
+x=1 readonly local /usr/bin | -eu cd $(pwd) $(pwd) then ${HOME} "$@" && 2>/dev/null
+		grep && x=1 /usr/bin sed done echo --verbose readonly
+cd -eu x=1 --verbose "$@" ${HOME} x=1 awk test local local && --verbose $(pwd)
+		"$1" cd grep done awk x=1
+grep | readonly 'quoted text' $(pwd) export awk
+	export printf "$@" && ${HOME} x=1 grep cd
+	/usr/bin ${HOME} | --verbose ${HOME} awk | local && /usr/bin
+-eu $(pwd) export awk echo 'quoted text' "$1" then
+		grep 'quoted text' local done sed sed | $(pwd)
+x=1 awk done awk "$1" grep export | sed then /usr/bin
+2>/dev/null | $(pwd) ${HOME} "$1" test 2>/dev/null "$@" done cd test
+		&& echo --verbose -eu awk echo && 'quoted text' 2>/dev/null
+		'quoted text' "$@" export sed | echo 'quoted text' cd then "$1" local cd awk local
+	--verbose test awk && $(pwd) -eu then grep --verbose $(pwd)
+sed sed $(pwd) "$@" --verbose "$1" --verbose test
+	local readonly /usr/bin
+		awk /usr/bin done sed --verbose printf done | grep printf x=1 && grep sed grep
+		export 2>/dev/null done | $(pwd) test $(pwd) "$@" x=1 /usr/bin done export
+		awk export printf done export
+done printf 'quoted text' | --verbose /usr/bin
+${HOME} /usr/bin grep done
+		--verbose $(pwd) sed 'quoted text' then "$@" printf
+		${HOME} 2>/dev/null export -eu done 'quoted text'
+readonly $(pwd) done /usr/bin echo cd done
+		readonly && | export awk
+		| awk ${HOME} export readonly cd done
+	"$@" && sed test awk awk /usr/bin grep --verbose readonly | 2>/dev/null printf
+| local awk local | then $(pwd) cd done
+	"$1" -eu /usr/bin $(pwd) ${HOME} | | "$1" "$1" "$1" done local "$@" echo x=1
+		local && printf grep echo then
+		echo grep grep printf | local grep cd | -eu -eu "$1"
+"$1" local sed readonly /usr/bin
+	printf -eu grep ${HOME} echo printf ${HOME} -eu grep awk printf
+test done --verbose /usr/bin
+		"$@" /usr/bin readonly x=1 "$@" echo "$@"
+"$@" ${HOME} /usr/bin 2>/dev/null
+		$(pwd) --verbose && "$@" 2>/dev/null
+test cd echo awk $(pwd) ${HOME} $(pwd) local
+cd 2>/dev/null x=1 local
+		x=1 cd sed then --verbose ${HOME} "$1" cd
+readonly 2>/dev/null | $(pwd) grep 2>/dev/null
+	cd local $(pwd) ${HOME} readonly | | | grep 2>/dev/null
+		'quoted text' 'quoted text' -eu 2>/dev/null sed cd 2>/dev/null &&
+$(pwd) --verbose cd test test local "$1" test -eu printf x=1 echo /usr/bin
+2>/dev/null test printf local x=1 then export --verbose grep printf
+--verbose && done echo "$1"
+$(pwd) $(pwd) "$1" 'quoted text'
+		x=1 done 'quoted text' | echo local /usr/bin readonly "$@" "$1" export
+local test 2>/dev/null "$@" grep --verbose printf
+	test $(pwd) test test grep | && x=1 /usr/bin "$1" "$@" 'quoted text'
+	export ${HOME} done sed test "$1" done export awk ${HOME} local grep /usr/bin --verbose
+	${HOME} then printf 2>/dev/null then 'quoted text' grep --verbose
+		echo ${HOME} export $(pwd) awk --verbose
+		| sed ${HOME} $(pwd) test awk
+${HOME} readonly done printf 'quoted text' /usr/bin local | printf then
+echo export -eu printf | ${HOME} export "$1" --verbose echo grep
+${HOME} "$@" local grep | cd done -eu test $(pwd) "$1" x=1 ${HOME} cd "$1" x=1
+echo then x=1 grep 'quoted text' awk
+		cd -eu test sed && "$@" then cd awk sed && -eu "$1"
+	${HOME} test $(pwd) ${HOME}
+		"$@" /usr/bin done x=1 -eu sed ${HOME} x=1 cd awk done then x=1 then ${HOME}
+	export local $(pwd) /usr/bin grep --verbose --verbose
+		printf x=1 then && local
+"$1" echo local export ${HOME} && && -eu | "$@"
+	2>/dev/null export printf readonly sed --verbose local test export
+		2>/dev/null echo local -eu awk "$@" -eu --verbose /usr/bin
+		-eu sed export local local /usr/bin 'quoted text'
+		${HOME} && ${HOME} ${HOME} done -eu test /usr/bin then /usr/bin "$@" then
+awk --verbose x=1 $(pwd)
+		${HOME} printf awk echo x=1 grep "$@"
+grep "$1" "$1" --verbose done "$@" local export sed && test awk
+sed printf "$1" | "$@" -eu x=1 x=1 "$1" test 2>/dev/null then then test grep
+		| local 'quoted text' awk grep awk ${HOME} test x=1 awk grep sed --verbose
+		sed cd | done printf && | echo sed "$1" cd grep -eu "$1"
+	export $(pwd) echo 2>/dev/null 2>/dev/null
+	"$1" -eu export ${HOME} readonly "$1"
+		${HOME} local ${HOME} echo 'quoted text' echo
+		$(pwd) x=1 2>/dev/null done ${HOME} done local local "$1" done export
+	"$@" local then ${HOME} 'quoted text'
+		--verbose sed "$@" then "$1" "$@" then
+x=1 /usr/bin export ${HOME} ${HOME}
+		readonly grep 2>/dev/null
+"$1" echo done $(pwd) 'quoted text'
+		"$1" 'quoted text' sed
+done test done "$1" --verbose x=1 ${HOME} cd done | grep
+		cd 'quoted text' && -eu --verbose
+		${HOME} "$1" | -eu awk 'quoted text' local | grep
+	"$1" && test echo x=1 /usr/bin x=1
+	2>/dev/null "$1" local | /usr/bin -eu ${HOME}
+	local 'quoted text' export then -eu readonly 'quoted text'
+	echo x=1 cd "$1" echo echo
+	"$@" /usr/bin ${HOME} "$@" test cd && local "$1" "$@" awk local $(pwd)
+		grep readonly "$@" /usr/bin "$@" then
+	echo $(pwd) x=1 export readonly awk done 'quoted text'
+| --verbose "$@" cd | /usr/bin
+	export | "$1" grep readonly 2>/dev/null "$1" | echo awk
+local echo cd 'quoted text'
+	$(pwd) x=1 | 2>/dev/null "$@" grep 2>/dev/null then echo grep then printf "$@"
+	readonly grep then "$@"
+--verbose done cd export /usr/bin
+		test 2>/dev/null local "$1" --verbose cd cd x=1
+		/usr/bin "$1" | 'quoted text' grep "$1"
+	local awk echo 2>/dev/null grep export then cd readonly cd /usr/bin
+	echo x=1 awk printf then | cd --verbose awk test
+		awk ${HOME} x=1 printf
+		export -eu readonly --verbose cd && 2>/dev/null local | 2>/dev/null --verbose
+printf grep /usr/bin done sed printf
+		export printf awk echo sed --verbose printf test
+	&& -eu awk done "$@" 'quoted text'
+test --verbose cd cd 2>/dev/null $(pwd)
+	grep then x=1 grep printf "$@" readonly
+		test -eu done printf --verbose grep | then echo $(pwd)
+		/usr/bin "$@" "$1" x=1 'quoted text' readonly local export
+printf readonly cd grep && -eu test 2>/dev/null
+		"$@" x=1 2>/dev/null echo -eu local local && then
+	printf cd test readonly printf
+echo | x=1 sed local 'quoted text'
+cd echo | x=1 "$1" cd sed test 'quoted text' readonly
+| | awk then local x=1 | -eu x=1 -eu --verbose
+	grep --verbose /usr/bin printf /usr/bin printf sed then 'quoted text'
+	$(pwd) printf export sed export --verbose awk export cd $(pwd) then 2>/dev/null
+echo "$@" grep /usr/bin export
+	"$@" echo printf 'quoted text' cd
+export && -eu printf "$1" "$@" "$@" 'quoted text' "$1" grep local awk "$@"
+		test -eu $(pwd) done --verbose /usr/bin sed awk /usr/bin ${HOME} 2>/dev/null
+awk "$@" 2>/dev/null x=1 export ${HOME}
+	cd grep awk "$@" cd -eu awk grep cd 'quoted text' ${HOME}
+	printf printf | export done x=1 -eu 'quoted text' -eu --verbose /usr/bin
+		"$@" export then $(pwd) local grep "$1" grep
+x=1 $(pwd) && 'quoted text' 'quoted text' test | /usr/bin
+		"$@" cd readonly ${HOME} "$@" /usr/bin && readonly local test "$@" grep "$@"
+	test export done x=1 ${HOME} 2>/dev/null
+	grep && echo cd echo readonly grep printf 'quoted text' /usr/bin test test export
+"$@" "$@" readonly | --verbose "$1" export awk awk && cd
+		sed 2>/dev/null 'quoted text' sed test cd done readonly done &&
+	then then then && readonly awk && local x=1 && readonly printf | done
+awk --verbose awk ${HOME} ${HOME} 'quoted text' printf /usr/bin
+2>/dev/null test 2>/dev/null && && /usr/bin
+	done /usr/bin echo x=1 && echo echo 2>/dev/null sed export "$1" readonly
+		echo "$@" && 'quoted text' cd 'quoted text'
+--verbose && sed local && cd
+		readonly printf awk local export
+sed local cd $(pwd) 2>/dev/null $(pwd) 'quoted text' then
+		'quoted text' echo /usr/bin printf | 'quoted text' awk done cd /usr/bin
+	${HOME} then printf echo readonly ${HOME} $(pwd) export then | awk
+		'quoted text' test awk test 2>/dev/null
+readonly && 2>/dev/null then "$1" sed
+-eu grep -eu awk --verbose awk sed 'quoted text'
+		"$1" cd cd local awk echo --verbose "$@"
+		${HOME} test -eu done cd echo --verbose echo
+	| ${HOME} && readonly 'quoted text'
+--verbose echo then 2>/dev/null
+		/usr/bin then 2>/dev/null 2>/dev/null 2>/dev/null && /usr/bin then 2>/dev/null
+		2>/dev/null 'quoted text' -eu awk 2>/dev/null
+	"$@" awk grep test export export awk | cd readonly echo
+"$@" x=1 sed grep --verbose /usr/bin | 2>/dev/null && export
+| cd 2>/dev/null "$1" | done sed done /usr/bin awk -eu "$@" readonly -eu grep
+	--verbose 'quoted text' --verbose -eu "$1" export grep test done
+awk local test | sed done local
+--verbose ${HOME} 2>/dev/null x=1 'quoted text' 'quoted text' echo done | readonly
+		--verbose cd --verbose
+		'quoted text' x=1 done /usr/bin | local "$1" 2>/dev/null
+		-eu x=1 export echo test test printf done local $(pwd)
+	awk -eu grep sed $(pwd) && echo && export grep "$1" 2>/dev/null 2>/dev/null
+then export local -eu 2>/dev/null 2>/dev/null grep
+readonly | "$1" then grep test &&
+printf cd echo sed 'quoted text' test ${HOME} "$1" "$1"
+		'quoted text' done /usr/bin done | readonly
+cd readonly --verbose
+	readonly $(pwd) 2>/dev/null x=1 "$@" --verbose test
+		readonly && test echo x=1 'quoted text'
+$(pwd) echo sed awk 2>/dev/null export "$1" awk awk sed
+| ${HOME} grep local "$1"
+	test sed then printf "$1"
+	| && "$@" x=1 test -eu $(pwd) $(pwd) readonly awk
+		$(pwd) && echo && x=1 grep done local
+x=1 --verbose | local $(pwd) ${HOME} export -eu printf awk $(pwd) /usr/bin ${HOME}
+		done grep "$1" local readonly
+printf sed -eu "$1" cd awk done ${HOME} grep echo x=1 --verbose 'quoted text'
+-eu "$@" && export cd --verbose | $(pwd) sed "$@"
+	test local grep export readonly "$1" ${HOME} "$1" sed "$1" test export
+local $(pwd) -eu sed export ${HOME} "$@" ${HOME}
+2>/dev/null 'quoted text' "$1" sed echo 'quoted text' readonly x=1 'quoted text'
+		2>/dev/null echo "$@" local "$@" test ${HOME}
+then test -eu 'quoted text' && grep
+-eu echo awk test readonly "$1" awk && awk echo sed
+	cd 2>/dev/null 'quoted text' 2>/dev/null
+	'quoted text' done -eu -eu printf grep && test 'quoted text' 'quoted text' && 2>/dev/null
+2>/dev/null done "$1" then ${HOME} awk cd local --verbose /usr/bin cd | echo
+		-eu 'quoted text' 2>/dev/null
+	&& 'quoted text' x=1 then grep /usr/bin
+		awk "$@" printf x=1 "$1" 'quoted text'
+		sed cd --verbose | 2>/dev/null sed x=1 test then done 'quoted text'
+	-eu "$1" export x=1 done x=1
+		export readonly ${HOME} 'quoted text' test
+	'quoted text' && done export
+		&& done echo sed --verbose
+	export "$1" "$1" local 'quoted text' sed && export cd --verbose export sed /usr/bin
+		readonly | /usr/bin x=1 x=1 printf sed sed cd then x=1
+2>/dev/null awk && awk cd test --verbose
+echo awk sed readonly sed -eu
+then 'quoted text' && -eu local grep printf
+done $(pwd) /usr/bin && echo
+| sed $(pwd) "$@" test test awk "$1" cd ${HOME} then export
+	local readonly x=1 2>/dev/null readonly /usr/bin $(pwd) grep test test ${HOME}
+		then --verbose ${HOME} | "$1" -eu 2>/dev/null then local
+		/usr/bin --verbose 2>/dev/null readonly 2>/dev/null ${HOME} export readonly
+		${HOME} sed local grep grep /usr/bin
+--verbose echo 'quoted text' | x=1 2>/dev/null "$1"
+	/usr/bin "$1" -eu $(pwd) grep && export cd done "$@" grep -eu --verbose
+	local awk --verbose awk done --verbose $(pwd)
+	"$@" done "$1" printf awk
+		${HOME} $(pwd) "$@" then done export
+/usr/bin x=1 export test echo
+	sed ${HOME} awk "$@" then ${HOME} 2>/dev/null echo then
+-eu 'quoted text' x=1 printf "$@" readonly
+	--verbose echo | | export grep | "$@" 'quoted text' "$@" then readonly
+test test readonly cd echo x=1 -eu sed awk local local printf 2>/dev/null
+	x=1 sed && "$@" done && "$1" 'quoted text' cd sed then export /usr/bin
+--verbose echo 2>/dev/null -eu local
+x=1 test ${HOME} sed -eu 'quoted text' -eu grep
+	echo | $(pwd) then -eu 'quoted text' | "$@"
+		printf x=1 grep done then "$1" ${HOME} cd printf grep --verbose "$1"
+		local x=1 done readonly echo $(pwd) | && ${HOME} 2>/dev/null 2>/dev/null -eu
+	${HOME} "$@" sed --verbose /usr/bin
+&& sed local export local x=1 "$@" 2>/dev/null cd /usr/bin cd /usr/bin -eu cd
+'quoted text' 'quoted text' sed awk 2>/dev/null grep printf
+	$(pwd) "$1" sed "$@" 2>/dev/null echo cd echo "$@" /usr/bin -eu local
+	x=1 "$1" then export /usr/bin readonly -eu echo && printf done readonly
+		then awk 'quoted text' "$1" done then local grep ${HOME} x=1 cd x=1 test
+	grep grep "$@" awk "$@" readonly grep "$1" then sed 'quoted text' --verbose
+	awk x=1 grep --verbose grep --verbose then ${HOME} printf ${HOME} | test
+		sed done done local ${HOME}
+$(pwd) local readonly "$@" cd local sed
+| echo readonly done --verbose awk "$@" 'quoted text'
+		cd printf | x=1 printf /usr/bin --verbose test printf "$1" test
+then -eu ${HOME} readonly x=1 x=1 grep export then 'quoted text' readonly
+		sed "$@" /usr/bin -eu $(pwd) test 2>/dev/null x=1 -eu -eu
+		grep "$@" 'quoted text' $(pwd) export local done test grep x=1 done
+		local $(pwd) echo 'quoted text' printf then sed
+test 'quoted text' sed awk export 2>/dev/null $(pwd) --verbose
+	${HOME} 'quoted text' x=1 'quoted text'
+	--verbose 'quoted text' echo export 'quoted text'
+grep | ${HOME} 2>/dev/null then echo local test --verbose test ${HOME} /usr/bin
+		x=1 sed test echo ${HOME} awk ${HOME}
+then awk 2>/dev/null ${HOME} cd done
+	echo local done readonly /usr/bin --verbose echo
+awk test /usr/bin then x=1 x=1 -eu && test
+		$(pwd) 2>/dev/null /usr/bin
+		${HOME} x=1 local --verbose
+	local 2>/dev/null printf done 'quoted text'
+		grep test readonly 'quoted text' $(pwd) x=1 | $(pwd) 'quoted text'
+awk cd grep "$@" -eu awk test 2>/dev/null
+&& cd readonly | && then test export done "$1" "$@" && 2>/dev/null
+	$(pwd) cd then $(pwd) export
+done "$@" -eu awk --verbose ${HOME} /usr/bin /usr/bin
+		&& readonly "$1" done "$@"
+		export echo sed --verbose "$@" --verbose --verbose readonly "$1" export awk
+		| done /usr/bin test printf printf 2>/dev/null
+		${HOME} | $(pwd) | /usr/bin ${HOME} cd
+		then readonly sed echo $(pwd) 'quoted text'
+--verbose grep done then x=1 test test cd cd ${HOME} $(pwd) ${HOME} then
+		echo 2>/dev/null printf 2>/dev/null then sed
+	--verbose ${HOME} 2>/dev/null export local && printf
+	"$@" ${HOME} readonly grep done test awk 'quoted text' readonly test test
+	-eu "$@" then local sed readonly cd "$@" "$@" | 2>/dev/null readonly &&
+		2>/dev/null awk x=1 cd ${HOME} ${HOME} --verbose && export | then
+	readonly grep 'quoted text' readonly then sed grep then cd
+	$(pwd) sed done | ${HOME} export local local && sed printf cd &&
+$(pwd) /usr/bin ${HOME} grep --verbose then
+	"$1" $(pwd) $(pwd) awk | x=1 then x=1 awk x=1
+	readonly --verbose 2>/dev/null
+"$1" local 'quoted text' $(pwd) printf --verbose | x=1 $(pwd) cd done awk "$1"
+awk readonly then -eu cd --verbose test "$@"
+	--verbose grep readonly grep 2>/dev/null | ${HOME} x=1
+		--verbose awk sed /usr/bin -eu /usr/bin then 'quoted text'
+		test ${HOME} && local ${HOME} 'quoted text' | "$@" local
+	echo 'quoted text' sed
+	-eu && "$@" 2>/dev/null export printf
+/usr/bin | 2>/dev/null test done $(pwd)
+	-eu export 2>/dev/null awk printf then
+2>/dev/null test 'quoted text'
+echo readonly ${HOME} 2>/dev/null grep sed done local $(pwd) done done
+	| done 'quoted text' sed $(pwd) test echo "$@" 'quoted text' printf --verbose
+	&& sed sed "$1" sed | done /usr/bin "$@" local --verbose printf local readonly
+		test ${HOME} local awk cd then /usr/bin 2>/dev/null sed cd "$1" test awk $(pwd)
+	sed && ${HOME} export x=1 2>/dev/null x=1
+	printf printf printf -eu "$@" done | sed 2>/dev/null
+		$(pwd) "$@" echo sed | $(pwd) cd 'quoted text'
+--verbose grep awk local grep "$@" $(pwd) && test test printf
+		/usr/bin /usr/bin export 2>/dev/null export done awk
+	x=1 export && done -eu cd --verbose "$@" $(pwd) cd | sed /usr/bin x=1 && printf
+local && cd --verbose && done
+$(pwd) --verbose 'quoted text' printf $(pwd)
+	readonly export echo 2>/dev/null | -eu printf test export 'quoted text' done
+	2>/dev/null "$@" grep x=1 printf "$1" "$1" grep
+		$(pwd) 2>/dev/null x=1 x=1 -eu $(pwd) sed && ${HOME} &&
+	&& cd done readonly -eu -eu readonly "$1" test done
+		local sed $(pwd) grep 'quoted text' local
+		&& local x=1 local -eu done grep $(pwd) printf
+done && cd test sed printf sed export --verbose
+	printf 2>/dev/null -eu echo x=1 cd then
+		| readonly --verbose | 'quoted text' grep x=1 ${HOME} grep ${HOME}
+		'quoted text' "$1" 'quoted text' done sed "$1" sed echo test "$1" printf
+		&& $(pwd) $(pwd) $(pwd) --verbose done readonly "$@" grep grep && readonly --verbose
+		2>/dev/null awk test && --verbose export printf done &&
+	&& then "$@" done ${HOME} && -eu grep cd x=1 2>/dev/null -eu $(pwd) grep
+	| /usr/bin grep "$@" awk x=1 ${HOME}
+	then grep | /usr/bin local ${HOME} "$1" --verbose done --verbose "$1"
+cd /usr/bin awk | 'quoted text' "$@" cd test --verbose
+	export grep 2>/dev/null export local | "$@" export sed "$1" sed --verbose
+		"$1" then | test $(pwd) 'quoted text'
+		| local $(pwd) 'quoted text' grep
+	| 'quoted text' sed "$@" cd done echo
+	| x=1 cd awk local 2>/dev/null done readonly readonly
+	echo "$@" 'quoted text' "$1" --verbose "$1" && -eu export
+-eu cd | printf ${HOME} local printf grep /usr/bin then 'quoted text'
+	-eu grep 'quoted text' sed | cd 'quoted text'
+		printf x=1 test && local export "$@" "$@" then /usr/bin
+	${HOME} "$1" | local "$@" --verbose sed "$@" then /usr/bin x=1 then "$1"
+printf test sed | done printf /usr/bin /usr/bin awk awk /usr/bin done export
+	"$1" printf --verbose && /usr/bin then
+${HOME} ${HOME} local "$1" awk &&
+	readonly /usr/bin printf local /usr/bin printf printf export
+		${HOME} grep | ${HOME} readonly $(pwd)
+		&& "$@" printf sed test "$@" readonly 2>/dev/null echo export local --verbose test
+echo printf -eu "$1" 'quoted text' export "$@" $(pwd) 'quoted text'
+	echo done ${HOME} printf readonly /usr/bin local /usr/bin "$@" printf
+echo 'quoted text' -eu
+	/usr/bin 2>/dev/null readonly "$@" 2>/dev/null export
+2>/dev/null x=1 then export then 'quoted text' export 'quoted text'
+	test ${HOME} then $(pwd) /usr/bin
+	--verbose $(pwd) && cd local
+		grep awk 2>/dev/null -eu "$@" readonly
+		then done then local x=1 local 'quoted text' grep awk awk
+		export cd "$1" 2>/dev/null --verbose grep && test
+		test 'quoted text' then grep
+${HOME} 2>/dev/null export awk awk -eu && sed "$1" x=1 printf then local readonly
+sed done --verbose export --verbose 'quoted text'
+cd cd echo | done local 2>/dev/null readonly export export "$@"
+-eu then ${HOME} sed local sed echo readonly echo
+		test x=1 then done grep 'quoted text' readonly -eu |
+-eu 2>/dev/null --verbose done sed awk x=1 then && export done && done export
+grep grep /usr/bin x=1 && 2>/dev/null $(pwd) done
+	"$@" cd printf readonly then x=1 "$1" export
+	/usr/bin awk done cd /usr/bin printf x=1 export awk test sed "$1" --verbose
+		then then then cd ${HOME} | | && grep && local | "$@"
+then "$@" "$@" $(pwd) readonly awk export echo "$@" grep export sed done sed
+"$1" 'quoted text' local
+"$@" && readonly printf sed ${HOME}
+	| ${HOME} $(pwd) -eu local --verbose x=1
+		--verbose -eu done readonly /usr/bin && "$@"
+		grep $(pwd) $(pwd) -eu readonly printf readonly readonly --verbose "$1"
+| done /usr/bin 2>/dev/null
+	echo test echo printf awk 'quoted text'
+grep readonly "$@" "$1" export
+		readonly awk | done echo 2>/dev/null --verbose done x=1 test then -eu
+	&& /usr/bin test /usr/bin printf sed "$1" && grep $(pwd) 2>/dev/null
+	${HOME} 2>/dev/null cd printf readonly grep --verbose x=1 grep "$1"
+${HOME} awk readonly local | printf test x=1 "$1" $(pwd) cd export /usr/bin
+	grep x=1 --verbose test
+	echo | then cd sed done readonly grep awk then
+		export --verbose "$1" export ${HOME}
+	-eu cd awk local --verbose awk cd | grep readonly
+	-eu x=1 -eu -eu x=1 export 'quoted text' awk test $(pwd)
+cd | && "$1" $(pwd) 2>/dev/null 2>/dev/null
+awk "$@" 'quoted text' && awk sed awk 'quoted text'
+	cd "$1" ${HOME} && awk /usr/bin "$1"
+sed cd | test ${HOME} | 'quoted text' grep --verbose
+		2>/dev/null 'quoted text' 2>/dev/null
+$(pwd) $(pwd) awk grep export export 'quoted text' /usr/bin && test
+-eu 'quoted text' --verbose done 2>/dev/null
+	local readonly ${HOME} readonly
+cd 2>/dev/null ${HOME} done "$1" printf --verbose awk --verbose
+		awk done $(pwd) then sed "$@" readonly
+	"$@" | export test sed "$1" -eu
+readonly 'quoted text' grep readonly 'quoted text' -eu 2>/dev/null
+		export awk sed cd grep cd local readonly -eu cd done awk $(pwd)
+		| x=1 --verbose awk export readonly
+	printf -eu cd x=1 'quoted text' echo
+		--verbose done awk export echo sed 'quoted text'
+		x=1 $(pwd) 2>/dev/null /usr/bin awk printf echo --verbose "$1" awk
+	grep && export "$@" /usr/bin
+	$(pwd) 2>/dev/null $(pwd) grep x=1 x=1
+printf $(pwd) echo sed local
+'quoted text' done ${HOME} printf
+		${HOME} readonly test then && export done
+		"$1" awk && echo readonly cd done then 'quoted text' test
+readonly 2>/dev/null done local -eu test cd $(pwd) export then && $(pwd)
+awk "$1" $(pwd) -eu 'quoted text' | readonly $(pwd) "$@" x=1
+--verbose | awk x=1 'quoted text' -eu 'quoted text'
+		printf sed echo "$1" printf
+	| test --verbose export "$@" $(pwd) printf | echo | readonly
+	awk grep && readonly x=1 ${HOME} cd
+		done grep "$1" sed x=1 readonly echo cd
+	"$@" grep ${HOME} awk cd cd printf "$1" local /usr/bin
+		then --verbose -eu 'quoted text' /usr/bin
+x=1 sed -eu -eu grep export done
+	"$@" sed && readonly | x=1 -eu --verbose
+		grep $(pwd) grep $(pwd) export readonly ${HOME} then --verbose
+2>/dev/null $(pwd) 'quoted text' echo /usr/bin
+	done x=1 awk test /usr/bin grep sed grep test then -eu readonly
+2>/dev/null --verbose 2>/dev/null 2>/dev/null x=1 test "$@" done cd cd
+	"$@" --verbose x=1 export ${HOME} sed &&
+&& echo then awk 2>/dev/null
+--verbose done awk cd grep test sed
+then echo done /usr/bin then -eu | ${HOME}
+	readonly 'quoted text'
+cd cd "$1" then sed x=1 grep test
+	"$@" local sed sed export -eu 2>/dev/null awk ${HOME} "$@" readonly /usr/bin
+	done export ${HOME} 'quoted text' ${HOME} cd test then export
+printf && x=1 'quoted text' readonly -eu printf awk | then "$1" printf
+	"$1" "$1" test $(pwd) "$1" echo && x=1 "$1" printf then
+sed then cd ${HOME} printf
+		"$@" local sed export grep test --verbose cd then $(pwd)
+		awk awk "$1" "$1" done
+	readonly $(pwd) 2>/dev/null awk --verbose
+local printf printf sed echo 'quoted text' cd echo echo test /usr/bin
+	/usr/bin 2>/dev/null test && --verbose "$1" "$1" "$@" local
+	export $(pwd) "$@" then ${HOME} 2>/dev/null
+readonly ${HOME} x=1 -eu echo "$1" readonly
+then x=1 test test 'quoted text' $(pwd) sed
+		&& 'quoted text' then 2>/dev/null --verbose then 2>/dev/null printf done
+		--verbose printf x=1 done awk
+		${HOME} --verbose echo 'quoted text' "$@" awk export local
+	sed awk done x=1 $(pwd) "$1" x=1 sed -eu grep && x=1 then -eu |
+		${HOME} "$@" then then awk local readonly | ${HOME} then /usr/bin echo "$1"
+"$1" | "$@" -eu grep 'quoted text'
+		test cd local -eu export 2>/dev/null 2>/dev/null ${HOME} export "$@" -eu test
+	&& ${HOME} sed $(pwd) readonly sed grep ${HOME} grep -eu grep "$1" local
+		echo done -eu readonly cd | $(pwd) cd grep echo -eu 'quoted text' x=1 sed done
+$(pwd) ${HOME} sed export printf then "$@" $(pwd) printf local
+"$1" ${HOME} ${HOME} then echo sed printf awk "$1" "$@"
+grep 'quoted text' ${HOME}
+-eu then --verbose then /usr/bin done export cd export
+'quoted text' && test then awk -eu readonly echo ${HOME}
+	&& sed --verbose $(pwd)
+export 'quoted text' && export $(pwd) $(pwd) cd --verbose $(pwd) done
+		awk --verbose $(pwd) x=1 done done
+"$@" -eu export sed /usr/bin 2>/dev/null sed "$1" cd ${HOME} cd export
+		test -eu awk $(pwd) done --verbose sed --verbose "$@" x=1 -eu local then ${HOME}
+sed readonly echo then printf
+		export cd printf /usr/bin /usr/bin readonly
+		local && && "$@" test "$@" ${HOME} -eu && export /usr/bin readonly
+	echo ${HOME} sed ${HOME} awk && /usr/bin export
+	done "$1" local done test --verbose ${HOME} grep ${HOME}
+	&& /usr/bin | /usr/bin local "$1" cd --verbose && sed -eu then "$1" |
+then awk | --verbose done awk local -eu | -eu x=1 cd cd local then
+		export readonly x=1 "$1" 2>/dev/null awk $(pwd)
+	"$1" | --verbose 2>/dev/null "$@" then test local --verbose export sed local cd
+printf export /usr/bin $(pwd) && local x=1 then ${HOME} 2>/dev/null
+	'quoted text' local 'quoted text' -eu /usr/bin /usr/bin
+	"$1" done "$@" readonly export sed readonly
+	-eu awk 2>/dev/null test "$@" grep --verbose ${HOME} ${HOME} && --verbose
+'quoted text' awk local awk "$@" --verbose 2>/dev/null cd done grep
+	"$@" ${HOME} printf -eu "$@" printf ${HOME} printf printf x=1 printf test x=1
+		--verbose grep then &&
+		-eu $(pwd) $(pwd) cd export | echo cd && cd && export
+local printf local $(pwd) done
+-eu x=1 local -eu 'quoted text' ${HOME}
+"$1" --verbose readonly printf | "$@" ${HOME}
+${HOME} grep sed awk /usr/bin echo 'quoted text' && export x=1 --verbose
+	'quoted text' export awk --verbose local 2>/dev/null --verbose x=1 2>/dev/null
+	local test printf awk echo ${HOME}
+	2>/dev/null && ${HOME} local && --verbose
+		test --verbose && "$1" grep
+		grep export "$@" export |
+	2>/dev/null echo | grep
+${HOME} x=1 "$@" && awk
+	awk grep grep "$1" sed ${HOME} 2>/dev/null 2>/dev/null export 'quoted text'
+	| && && readonly test test /usr/bin | --verbose echo --verbose
+x=1 | sed && export grep cd x=1 local export done done echo
+	printf test test 2>/dev/null done test x=1 cd readonly
+		-eu test sed --verbose $(pwd) $(pwd) awk /usr/bin $(pwd) && test echo | |
+grep /usr/bin | && printf /usr/bin then echo --verbose readonly
+	done "$1" grep echo 'quoted text'
+		/usr/bin "$@" --verbose grep 'quoted text' 'quoted text'
+cd 'quoted text' 'quoted text' done $(pwd) grep --verbose grep sed
+		/usr/bin ${HOME} export | echo cd 2>/dev/null
+		sed && "$1" /usr/bin export local "$@" test cd printf export $(pwd) sed
+2>/dev/null test export readonly printf then local sed sed export export --verbose
+${HOME} readonly /usr/bin $(pwd) export cd "$1" -eu "$1" "$@" printf then
+export readonly grep sed
+	-eu | sed test printf ${HOME} x=1 awk "$1" --verbose awk --verbose done --verbose
+	${HOME} echo /usr/bin
+	${HOME} export | done awk grep $(pwd) /usr/bin -eu
+x=1 then printf /usr/bin
+printf echo cd x=1 readonly local && printf done
+	-eu 'quoted text' export "$1" 2>/dev/null $(pwd) "$@"
+	grep x=1 sed ${HOME} grep x=1 x=1 ${HOME} local ${HOME} cd then
+	test test 2>/dev/null $(pwd) ${HOME}
+	'quoted text' x=1 export test ${HOME} 'quoted text' then $(pwd)
+"$@" local done local && "$1" | x=1 cd cd test
+	$(pwd) "$@" grep "$1" 'quoted text' x=1 --verbose | echo "$@"
+/usr/bin | "$1" echo cd "$1" -eu
+	-eu cd x=1 readonly && awk echo cd
+	${HOME} ${HOME} /usr/bin local cd local $(pwd) x=1 ${HOME} | awk test
+	"$1" grep sed done awk echo 'quoted text' test export test grep grep done /usr/bin
+	then $(pwd) 2>/dev/null local -eu 2>/dev/null
+	cd "$@" --verbose awk "$1" printf test test
+awk awk cd printf local sed
+	grep --verbose readonly | && test printf readonly 2>/dev/null grep
+	/usr/bin x=1 done "$1" "$@" test readonly "$1" test 'quoted text'
+		readonly then cd "$1" $(pwd) "$@"
+	awk then -eu 'quoted text' printf -eu printf --verbose 2>/dev/null printf /usr/bin
+test && --verbose 'quoted text' -eu -eu /usr/bin "$@" cd echo cd sed
+		awk echo /usr/bin x=1 | test cd echo ${HOME} echo done echo readonly
+	readonly sed local cd "$@" ${HOME} printf $(pwd) grep readonly --verbose
+"$1" cd && | x=1 done cd readonly --verbose -eu echo x=1 done
+	local --verbose ${HOME} && local grep | test printf &&
+--verbose test --verbose readonly ${HOME} test "$@" readonly
+	"$1" "$@" /usr/bin export | && "$@" && ${HOME} && echo echo then grep
+	&& "$@" readonly awk then awk
+test awk echo awk x=1 sed sed -eu local --verbose awk done echo && ${HOME} done
+	echo test "$@" /usr/bin done x=1 local done echo test $(pwd) 2>/dev/null
+"$@" 2>/dev/null 'quoted text' test | grep "$1" export test
+		cd --verbose ${HOME} test 'quoted text' cd
+	done ${HOME} x=1 -eu readonly --verbose "$@" ${HOME} export echo
+	test | "$1" done readonly printf test done "$1" then /usr/bin "$1" x=1 -eu
+		&& --verbose --verbose
+	echo /usr/bin && /usr/bin "$1" "$1" cd echo grep then
+	x=1 printf "$@" cd "$@" x=1 x=1 $(pwd) $(pwd)
+		awk test echo awk 2>/dev/null
+		"$1" grep awk 'quoted text' $(pwd) 'quoted text'
+	readonly printf && echo 2>/dev/null
+	grep "$1" x=1 printf && && readonly echo
+		&& && 2>/dev/null test $(pwd) 'quoted text' readonly 2>/dev/null ${HOME}
+		| "$@" done $(pwd) readonly done /usr/bin
+		printf --verbose x=1 printf
+cd && then cd ${HOME} awk /usr/bin test "$1" | /usr/bin test && export
+		"$1" readonly export awk awk && | echo sed && sed sed --verbose sed
+test "$1" -eu done grep grep
+		export x=1 "$1" ${HOME} /usr/bin echo $(pwd) readonly
+done --verbose done $(pwd)
+		awk local "$@" x=1 ${HOME} awk printf local 2>/dev/null
+test "$1" done awk --verbose 'quoted text' x=1 awk x=1
+		"$@" 'quoted text' awk --verbose "$1" grep local then 2>/dev/null
+-eu test readonly local grep /usr/bin --verbose ${HOME}
+local then local ${HOME} test export readonly
+then -eu 2>/dev/null sed done done "$1" | $(pwd)
+		$(pwd) cd cd "$1" "$@" then "$1" | printf readonly done readonly cd 'quoted text'
+		export 2>/dev/null -eu readonly "$@" 'quoted text' printf awk
+"$@" -eu local && x=1 grep export done -eu done ${HOME}
+cd ${HOME} --verbose awk
+		"$@" /usr/bin export local then test printf -eu readonly sed cd 'quoted text'
+	${HOME} | awk x=1 test awk sed /usr/bin -eu then echo test --verbose
+/usr/bin done sed echo done "$1" --verbose /usr/bin grep "$1" 2>/dev/null
+"$@" then printf awk grep "$@"
+2>/dev/null --verbose 2>/dev/null printf "$@"
+		--verbose 'quoted text' then test
+		then done readonly "$1" 2>/dev/null grep 2>/dev/null
+| $(pwd) "$@" grep then echo 'quoted text'
+	/usr/bin "$@" test awk grep x=1 | "$1" $(pwd) ${HOME}
+		cd awk $(pwd) && 2>/dev/null ${HOME} ${HOME} awk done "$@" local ${HOME}
+		done "$1" ${HOME} cd readonly 'quoted text' awk --verbose printf "$1" --verbose
+		cd && sed readonly x=1 --verbose printf printf sed | then
+		/usr/bin export "$@" test local test printf
+	/usr/bin --verbose --verbose 2>/dev/null grep "$@" cd
+		'quoted text' export 'quoted text' readonly
+	sed printf | grep local /usr/bin 'quoted text' sed --verbose echo $(pwd) $(pwd)
+	cd "$1" local 'quoted text' --verbose test local local /usr/bin -eu && | export
+	$(pwd) "$@" | x=1 export $(pwd) printf
+	&& | sed x=1 | grep export ${HOME} 2>/dev/null then ${HOME}
+	--verbose printf done /usr/bin local
+	cd done 'quoted text' "$1" 2>/dev/null --verbose echo
+	readonly 2>/dev/null "$@" "$@" awk "$1" then awk
+		awk 2>/dev/null x=1 "$@" test "$1" && && printf
+	local grep /usr/bin x=1 echo --verbose sed /usr/bin 'quoted text' printf
+'quoted text' local cd "$@" x=1 | /usr/bin export 'quoted text'
+		then "$1" "$1" done export then $(pwd) |
+then done echo local /usr/bin 2>/dev/null
+x=1 grep "$@" x=1 sed test "$1" test && done
+	echo -eu /usr/bin x=1 'quoted text'
+'quoted text' && printf "$@" cd then ${HOME} cd export $(pwd) cd ${HOME}
+| 2>/dev/null export then x=1 cd readonly local grep done --verbose
+	--verbose "$@" readonly grep 'quoted text' /usr/bin export printf
+	sed "$@" -eu cd 'quoted text' sed -eu readonly
+	"$@" 2>/dev/null 2>/dev/null local ${HOME} --verbose
+		echo -eu x=1 grep echo test sed local printf done -eu -eu
+	${HOME} --verbose --verbose
+x=1 done $(pwd) "$@" printf --verbose x=1 sed export then 'quoted text' 'quoted text'
+"$1" $(pwd) export x=1 x=1 awk local echo cd /usr/bin --verbose cd export
+	/usr/bin then $(pwd) 'quoted text'
+	sed local done export "$1" then --verbose
+	/usr/bin /usr/bin readonly done 2>/dev/null echo 'quoted text' 2>/dev/null
+	-eu x=1 export "$1" done -eu && local done /usr/bin 'quoted text'
+2>/dev/null export then -eu cd 2>/dev/null /usr/bin -eu $(pwd) printf ${HOME}
+	"$@" export echo test "$1" readonly grep printf ${HOME} export && readonly && $(pwd)
+	-eu 2>/dev/null | "$1" printf 'quoted text'
+| && printf /usr/bin cd 2>/dev/null "$@" | /usr/bin 2>/dev/null export awk
+		/usr/bin -eu && cd "$1" | "$1" printf sed printf 2>/dev/null export
+	/usr/bin test 2>/dev/null done /usr/bin test echo $(pwd)
+		sed readonly done then x=1
+-eu -eu /usr/bin done | "$@" grep local export "$@" done "$@" sed 2>/dev/null
+		then readonly $(pwd) done readonly cd /usr/bin
+		x=1 ${HOME} export x=1
+echo /usr/bin x=1 sed --verbose x=1 export
+${HOME} sed done 'quoted text' then local awk --verbose grep
+		local 2>/dev/null "$1" readonly sed 2>/dev/null test printf
+	"$1" -eu export | sed cd | grep $(pwd) test test --verbose awk "$1" -eu readonly
+		test "$1" x=1 -eu --verbose --verbose
+		sed test done -eu grep echo 'quoted text'
+		--verbose echo echo ${HOME} 2>/dev/null cd cd | /usr/bin
+	printf export -eu --verbose 'quoted text'
+	$(pwd) then awk 'quoted text' && done test printf local "$1" "$1" -eu
+		grep export sed && test grep && 2>/dev/null test grep
+	test 2>/dev/null local $(pwd) | printf -eu then && $(pwd) awk
+done grep then && readonly readonly
+	echo export --verbose ${HOME} done
+		"$@" && x=1 "$@" sed cd cd done echo echo sed $(pwd)
+	-eu cd 'quoted text' "$1" x=1 --verbose "$1" /usr/bin x=1 local
+		export ${HOME} 'quoted text' sed "$@" x=1 "$@" done --verbose
+	test | then export -eu sed -eu --verbose /usr/bin local done ${HOME}
+	"$1" export cd awk && -eu
+sed $(pwd) --verbose grep "$1" | | echo | cd then local
+		done then local /usr/bin ${HOME} x=1 /usr/bin $(pwd) && printf
+	done && $(pwd) then x=1 && sed 2>/dev/null grep export "$@" printf 2>/dev/null 2>/dev/null
+export && --verbose 2>/dev/null then --verbose
+test ${HOME} test /usr/bin | | |
+test echo grep "$@" x=1 done test /usr/bin | echo 2>/dev/null export cd local --verbose
+	'quoted text' grep "$@" 'quoted text' done /usr/bin && done
+		| grep export 'quoted text' x=1 | done local cd | sed -eu sed
+		local -eu grep 2>/dev/null local --verbose /usr/bin sed && awk && -eu
+	readonly readonly 'quoted text' sed done
+	awk then x=1 ${HOME} local cd $(pwd) 'quoted text'
+cd test readonly cd echo "$@" 2>/dev/null echo
+		"$1" --verbose --verbose then cd sed $(pwd) "$@" /usr/bin export "$@" done
+		| then printf done test printf done "$@" x=1 then readonly sed && --verbose x=1
+		cd && "$@" done "$1" then "$1" sed 2>/dev/null
+		-eu echo 2>/dev/null ${HOME} 'quoted text' 'quoted text' /usr/bin
+	sed ${HOME} then $(pwd) echo echo echo
+	local ${HOME} grep awk && grep -eu ${HOME} then 'quoted text' | then -eu
+		export -eu "$@" --verbose local
+	done | readonly then awk
+		"$@" readonly -eu echo "$1" "$1" awk | -eu local then 'quoted text'
+		test readonly /usr/bin && ${HOME} printf | local $(pwd) --verbose
+test sed printf ${HOME} $(pwd) then /usr/bin grep then
+--verbose -eu $(pwd) $(pwd) test && x=1 "$1" -eu 'quoted text'
+		-eu ${HOME} awk | | printf x=1 2>/dev/null
+	readonly --verbose export x=1 printf
+		readonly done test readonly ${HOME} "$1" export
+	-eu grep && /usr/bin local --verbose
+$(pwd) local -eu -eu echo 'quoted text' echo readonly export
+${HOME} sed /usr/bin awk 'quoted text' "$@" 2>/dev/null --verbose
+	sed /usr/bin "$@" $(pwd) 'quoted text' cd done x=1 test export
+		2>/dev/null ${HOME} local 'quoted text' sed /usr/bin
+	/usr/bin "$@" ${HOME} then printf awk "$1" 2>/dev/null --verbose
+		echo test /usr/bin awk && export x=1 readonly
+	-eu "$1" | echo echo $(pwd)
+		x=1 export -eu ${HOME} readonly
+		local done done "$1" sed then "$1" done 2>/dev/null
+		done printf ${HOME} "$@" grep local "$@" ${HOME} "$1" "$1" done done x=1
+		${HOME} local /usr/bin "$@" ${HOME} test && 2>/dev/null echo
+	sed "$@" export awk "$1" grep "$1" local echo "$@"
+"$1" | 2>/dev/null then "$@" -eu
+	$(pwd) --verbose 'quoted text' 2>/dev/null then
+	awk ${HOME} done "$1" --verbose | 'quoted text' local && awk "$@"
+	echo printf test | 'quoted text' /usr/bin test ${HOME} sed
+	"$1" awk then printf local printf --verbose "$@" --verbose | done
+		"$1" then $(pwd) --verbose readonly
+		done --verbose "$@" "$@" echo | -eu grep then export
+	cd --verbose test | test $(pwd) readonly
+		printf cd export export done $(pwd) done /usr/bin
+		printf sed | test sed cd cd grep "$1"
+	${HOME} $(pwd) test "$@" awk "$@" 2>/dev/null
+	sed ${HOME} "$@" export | echo --verbose 'quoted text' ${HOME}
+	local done 2>/dev/null printf 2>/dev/null readonly --verbose 'quoted text'
+		readonly echo x=1 readonly readonly $(pwd)
+	readonly x=1 cd -eu /usr/bin "$1" /usr/bin /usr/bin
+		&& -eu -eu printf export readonly echo local
+		done then sed echo echo x=1 local grep printf sed printf && ${HOME} readonly 'quoted text'
+	'quoted text' 'quoted text'
+	echo ${HOME} done export test 'quoted text' local grep "$1"
+	| sed done awk then sed
+	${HOME} | "$@" && x=1 'quoted text' ${HOME} && readonly ${HOME} done 2>/dev/null
+		$(pwd) awk "$1" printf --verbose test export local cd --verbose
+local | --verbose grep grep sed sed 'quoted text'
+		--verbose readonly awk $(pwd) local 2>/dev/null --verbose test
+-eu | && "$@" echo grep "$1" | x=1 readonly cd x=1 readonly cd && printf
+		awk | sed 2>/dev/null test awk | readonly then echo x=1
+	local sed /usr/bin cd awk 2>/dev/null done | --verbose -eu "$@" "$@"
+awk --verbose x=1 $(pwd) grep --verbose $(pwd)
+		${HOME} done x=1 ${HOME} then ${HOME} "$@" cd /usr/bin export $(pwd) local
+sed ${HOME} /usr/bin x=1 printf "$@" local $(pwd)
+		awk awk ${HOME} | x=1 /usr/bin then "$1" $(pwd) cd sed 'quoted text' --verbose
+test -eu x=1 --verbose readonly && && printf
+&& export cd | export readonly local "$1" cd x=1 "$1" 2>/dev/null then
+		cd then && grep 2>/dev/null export -eu local sed test | sed grep &&
+		-eu local 2>/dev/null 'quoted text' --verbose
+	awk local /usr/bin echo "$@" then "$@" done grep export
+		"$@" 'quoted text' $(pwd) test && 2>/dev/null x=1 --verbose
+	${HOME} --verbose printf readonly
+	cd cd cd "$1" -eu /usr/bin && -eu cd awk -eu --verbose local --verbose
+		test done /usr/bin awk /usr/bin export $(pwd) local awk sed done x=1
+		printf | test ${HOME} x=1 "$1" then cd x=1 x=1 done done ${HOME} x=1
+		local sed readonly export then export local x=1 "$@" /usr/bin &&
+then awk local ${HOME} cd 2>/dev/null done awk sed 'quoted text' printf x=1 &&
+	${HOME} | /usr/bin ${HOME} | -eu local sed then cd printf x=1 then export
+		local "$@" test --verbose -eu echo then local done /usr/bin /usr/bin -eu
+local sed $(pwd) local cd done 2>/dev/null --verbose && echo awk 'quoted text'
+readonly 'quoted text' sed "$@" then cd "$1" readonly
+test sed local local 2>/dev/null x=1 local test echo readonly sed /usr/bin local
+	&& local export 2>/dev/null && 2>/dev/null test /usr/bin
+	echo $(pwd) test -eu --verbose local
+${HOME} export x=1 "$@" test "$1" sed $(pwd) "$1" $(pwd) export "$1"
+		| done test then $(pwd)
+export cd then cd local x=1 echo grep
+$(pwd) local readonly export 'quoted text'
+$(pwd) then cd "$@" printf --verbose x=1 ${HOME} 'quoted text' echo cd done sed
+	&& ${HOME} local printf
+	| local then "$@" local test | sed printf sed then "$1"
+		test export -eu then 2>/dev/null "$@" grep "$1" /usr/bin test -eu ${HOME}
+	awk test $(pwd) | echo -eu sed test x=1 cd cd 'quoted text' echo export x=1 test
+	2>/dev/null && x=1 export $(pwd) local test x=1 ${HOME} awk "$1"
+--verbose then grep "$@" -eu sed sed 2>/dev/null
+		--verbose 'quoted text' /usr/bin 2>/dev/null test ${HOME} export cd local echo
+		2>/dev/null printf --verbose ${HOME} cd 2>/dev/null ${HOME} "$1"
+	x=1 -eu $(pwd) $(pwd) awk test then readonly
+	-eu 'quoted text' ${HOME} --verbose grep echo -eu | echo --verbose "$@" test
+	export awk export grep readonly
+		readonly ${HOME} sed --verbose awk then awk /usr/bin 2>/dev/null
+		echo && printf printf "$@" $(pwd) sed cd then x=1 cd local
+	| | 2>/dev/null cd ${HOME}
+		--verbose echo echo x=1 "$@" grep ${HOME} -eu | cd
+"$@" "$@" --verbose $(pwd) "$@" "$1" then printf
+	local "$@" awk test 'quoted text'
+	done ${HOME} then --verbose
+		readonly 'quoted text' ${HOME} --verbose ${HOME} sed "$1" x=1 cd 'quoted text'
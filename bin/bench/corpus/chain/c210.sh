@@ -0,0 +1,2001 @@
+$(pwd) 2>/dev/null cd export done ${HOME} 2>/dev/null
+		&& | test --verbose then 2>/dev/null test x=1 $(pwd) readonly awk test
+		done readonly cd grep | | /usr/bin local "$@" x=1 ${HOME} x=1 awk -eu
+		&& 'quoted text' sed then && cd --verbose 2>/dev/null && "$@" 2>/dev/null
+		awk x=1 --verbose "$@" x=1 readonly readonly then printf export echo 'quoted text'
+	local test test ${HOME} -eu echo
+test $(pwd) export cd 'quoted text'
+-eu export --verbose done 'quoted text' "$@" | && local 'quoted text'
+	--verbose --verbose export export x=1 echo -eu readonly /usr/bin
+"$1" | -eu $(pwd) grep | && --verbose ${HOME} -eu 2>/dev/null cd -eu "$@"
+"$1" cd "$1" printf export 'quoted text'
+${HOME} readonly 2>/dev/null $(pwd) sed cd 'quoted text' awk "$@" 2>/dev/null
+	'quoted text' x=1 $(pwd) export x=1 'quoted text'
+	then export then grep 2>/dev/null 'quoted text' cd $(pwd) awk readonly 2>/dev/null
+	readonly "$1" grep export "$@" readonly grep then "$@"
+		export test local export 2>/dev/null $(pwd) --verbose
+		grep -eu export export 'quoted text' ${HOME}
+"$1" grep ${HOME} 'quoted text'
+		'quoted text' sed printf "$1" local done && echo /usr/bin | local
+		cd 'quoted text' --verbose awk 'quoted text'
+awk 'quoted text' readonly 'quoted text' /usr/bin echo
+		local "$1" | 'quoted text' grep $(pwd) "$@" sed && | "$@" cd echo
+		$(pwd) local --verbose printf export awk 'quoted text'
+2>/dev/null /usr/bin /usr/bin 2>/dev/null "$1" grep test grep
+	export echo readonly echo done readonly x=1 then printf test "$@"
+done x=1 --verbose | $(pwd) sed test grep readonly test && then && readonly
+| $(pwd) awk ${HOME} x=1 cd "$1" $(pwd) "$1" test readonly cd
+		"$@" echo sed test "$@" | && ${HOME} echo
+		sed test awk -eu 'quoted text' "$@" "$@" && 'quoted text' printf
+		sed $(pwd) readonly 2>/dev/null done ${HOME} done export
+		${HOME} printf done "$1" | 'quoted text'
+	&& done then x=1 -eu awk echo $(pwd)
+	| sed $(pwd) "$1" $(pwd) echo --verbose -eu awk local printf --verbose
+	test /usr/bin readonly sed ${HOME} ${HOME} done | 2>/dev/null ${HOME} x=1
+		grep printf test awk echo $(pwd) --verbose | done export awk awk export "$1"
+-eu local /usr/bin export
+		&& "$@" printf "$1" "$1" cd readonly
+2>/dev/null test x=1 sed
+	awk grep | test readonly 2>/dev/null
+-eu -eu done done ${HOME}
+		${HOME} echo && sed && export "$1" grep 2>/dev/null export ${HOME} readonly
+then export done done done cd
+sed then grep --verbose --verbose then test 2>/dev/null grep -eu x=1 printf
+	done ${HOME} done 'quoted text' printf |
+then readonly printf --verbose "$1"
+		/usr/bin sed printf $(pwd) 'quoted text'
+		cd $(pwd) readonly "$1"
+	/usr/bin 2>/dev/null /usr/bin && readonly test -eu 2>/dev/null
+echo readonly then cd x=1 2>/dev/null sed done "$@" sed ${HOME} x=1
+	/usr/bin done 2>/dev/null echo -eu "$@" local grep test 'quoted text'
+		cd && awk cd /usr/bin 2>/dev/null grep 'quoted text' test 2>/dev/null test
+	&& printf printf sed | cd 'quoted text' --verbose x=1 ${HOME} then "$@" sed cd test
+-eu test /usr/bin readonly
+		echo x=1 $(pwd) test "$1" x=1 local printf
+		x=1 && -eu "$@" x=1 readonly /usr/bin 2>/dev/null
+		'quoted text' /usr/bin done 'quoted text'
+readonly sed --verbose cd
+	${HOME} x=1 $(pwd) then 2>/dev/null local echo
+		printf export cd readonly grep awk | --verbose x=1 $(pwd) | awk /usr/bin
+	'quoted text' export ${HOME} && test printf -eu | x=1 "$@" "$@"
+	then grep printf $(pwd) export -eu $(pwd) awk -eu printf grep --verbose
+	export $(pwd) printf 2>/dev/null 2>/dev/null 'quoted text'
+	readonly 'quoted text'
+cd x=1 | grep done export readonly sed 'quoted text' grep 'quoted text'
+		local then test readonly 2>/dev/null
+	awk then x=1 then then "$@" test
+	then echo test test | cd /usr/bin x=1 printf 2>/dev/null --verbose "$1" cd
+	local --verbose test x=1 readonly --verbose export
+		-eu readonly /usr/bin ${HOME} 2>/dev/null awk /usr/bin
+		grep ${HOME} then then $(pwd) readonly $(pwd) done local echo awk ${HOME}
+	/usr/bin test "$1" --verbose
+	"$1" && /usr/bin "$@" "$1" /usr/bin
+	sed ${HOME} echo -eu 'quoted text' done 'quoted text'
+		test 2>/dev/null "$1" done && x=1 x=1 local "$@" grep 'quoted text'
+		&& ${HOME} "$@" echo done awk "$@" "$@"
+		'quoted text' $(pwd) /usr/bin 'quoted text' cd 'quoted text' -eu -eu test "$@" printf
+--verbose then "$@" /usr/bin echo test 2>/dev/null awk sed
+test done "$1" 2>/dev/null then then ${HOME} | 2>/dev/null
+${HOME} readonly $(pwd) 2>/dev/null
+		'quoted text' && && x=1 local /usr/bin -eu ${HOME}
+done test sed grep echo $(pwd) cd sed $(pwd) --verbose "$1" $(pwd) --verbose
+-eu && awk then local --verbose then
+	$(pwd) | ${HOME} x=1 printf -eu test test --verbose readonly
+	"$@" -eu 2>/dev/null grep 2>/dev/null && then x=1 && /usr/bin sed export --verbose
+	"$1" "$1" awk test && sed echo then then test test --verbose
+--verbose done readonly x=1 local 'quoted text'
+	export done 'quoted text' cd then x=1 $(pwd) ${HOME} then ${HOME}
+	x=1 && local then sed
+	grep --verbose cd x=1 echo
+		--verbose $(pwd) awk && sed local test local $(pwd) 2>/dev/null
+awk export "$1" | $(pwd)
+	local --verbose local 2>/dev/null readonly local done ${HOME} x=1 then --verbose
+	readonly /usr/bin awk local
+sed "$1" -eu done ${HOME} $(pwd) cd local 2>/dev/null cd ${HOME}
+	&& grep local -eu export printf x=1
+	then 2>/dev/null done "$@" 2>/dev/null && -eu awk
+		sed --verbose grep cd | | grep x=1 export test | --verbose "$@" ${HOME}
+2>/dev/null export cd ${HOME} /usr/bin
+		/usr/bin printf && done $(pwd) -eu sed $(pwd) echo
+	readonly then echo | readonly done $(pwd) cd --verbose --verbose --verbose
+		awk "$1" done $(pwd) "$@"
+x=1 /usr/bin done echo x=1 "$1"
+	cd echo && 2>/dev/null | 2>/dev/null
+		-eu readonly "$@" awk cd $(pwd) "$@" "$1" && test printf && sed
+	"$@" printf --verbose done 2>/dev/null
+	echo /usr/bin $(pwd) echo test printf -eu awk test /usr/bin
+		"$@" then $(pwd) "$1" && printf --verbose readonly
+		readonly local /usr/bin 'quoted text' echo sed grep printf then sed && -eu
+	x=1 "$1" "$1" grep local x=1 printf done
+	"$1" | cd echo 'quoted text'
+"$@" sed echo export 2>/dev/null export echo local 'quoted text'
+	x=1 /usr/bin echo x=1 echo 2>/dev/null
+	x=1 then sed done | && "$1" && --verbose awk |
+		printf --verbose ${HOME} awk 'quoted text' "$1" awk grep "$1" export awk
+	'quoted text' 2>/dev/null
+	done --verbose "$1" x=1 export printf echo grep
+${HOME} printf done ${HOME} && echo local test $(pwd)
+"$1" done --verbose echo x=1 $(pwd)
+	export echo test local $(pwd) export
+		test 2>/dev/null 'quoted text' ${HOME} "$@" ${HOME} test -eu cd "$@" "$@"
+		/usr/bin 2>/dev/null $(pwd) | local ${HOME} 2>/dev/null
+export && echo grep 2>/dev/null | && grep /usr/bin -eu then /usr/bin local
+	done export test awk readonly 2>/dev/null cd done done -eu --verbose
+		test 2>/dev/null ${HOME} x=1 "$@" 'quoted text'
+test | | sed echo done export done && cd sed cd export 'quoted text'
+sed "$1" | 2>/dev/null cd ${HOME} then --verbose then 2>/dev/null echo
+done grep "$1" && 'quoted text' readonly sed ${HOME} then "$1"
+		printf awk then 'quoted text'
+| /usr/bin local "$@" x=1 'quoted text' 'quoted text'
+cd grep "$1" x=1 local && "$@" $(pwd)
+	printf sed x=1 export sed printf "$1" awk | | awk grep
+	test "$@" 2>/dev/null /usr/bin echo && --verbose test local
+x=1 ${HOME} export 'quoted text' grep cd /usr/bin
+	$(pwd) -eu 2>/dev/null -eu sed printf $(pwd) 2>/dev/null --verbose -eu "$@"
+echo "$@" /usr/bin "$1" && local 'quoted text' /usr/bin
+readonly sed echo --verbose awk "$@" "$@" local awk export ${HOME}
+	printf export ${HOME} then && local test done test "$1" then done --verbose awk
+		readonly "$@" sed --verbose 'quoted text' --verbose test "$1" sed "$@" cd awk
+		"$@" --verbose -eu x=1 --verbose local
+done test 2>/dev/null "$1" then cd printf done
+		'quoted text' export done 'quoted text' -eu then readonly then
+	x=1 ${HOME} 'quoted text' /usr/bin ${HOME} "$@" cd x=1 test local -eu
+	2>/dev/null x=1 echo cd echo | 'quoted text' | done printf 2>/dev/null ${HOME}
+	&& /usr/bin export cd /usr/bin
+	2>/dev/null echo "$@" test readonly sed | /usr/bin x=1 done awk 2>/dev/null &&
+	/usr/bin "$@" 'quoted text' /usr/bin "$@" | test
+		"$@" export /usr/bin grep 2>/dev/null
+	cd then readonly test --verbose then readonly
+	$(pwd) cd $(pwd) ${HOME} $(pwd) x=1 local ${HOME} --verbose
+	readonly sed $(pwd) readonly printf export
+		2>/dev/null then export 'quoted text' echo sed cd -eu local
+awk /usr/bin awk 'quoted text' 'quoted text' /usr/bin
+	done readonly -eu 'quoted text' --verbose test ${HOME}
+&& $(pwd) 'quoted text' ${HOME} printf then awk --verbose grep echo x=1 export
+		then awk $(pwd) && test done then 2>/dev/null cd grep
+		awk printf printf ${HOME}
+local | awk grep readonly x=1
+	readonly sed printf printf $(pwd) printf && local grep /usr/bin $(pwd) x=1 local
+$(pwd) echo then grep "$1"
+cd 'quoted text' local export local then 2>/dev/null
+	awk -eu "$1" | awk | --verbose | "$@" x=1 "$1" ${HOME} | done sed readonly ${HOME}
+${HOME} $(pwd) echo export "$@" grep cd /usr/bin 'quoted text' export
+	grep grep cd grep "$1" "$1"
+		${HOME} done grep cd then printf 'quoted text' cd "$1" then "$1"
+	sed ${HOME} test readonly | 2>/dev/null -eu 'quoted text' cd readonly "$@"
+	'quoted text' | /usr/bin done --verbose echo ${HOME}
+	/usr/bin -eu -eu 2>/dev/null awk && export
+	"$@" printf /usr/bin 'quoted text' -eu awk sed awk
+x=1 | /usr/bin 2>/dev/null /usr/bin
+$(pwd) 'quoted text' printf "$@" | $(pwd) ${HOME}
+		2>/dev/null sed "$@" then /usr/bin readonly
+	awk export done grep local cd 'quoted text' export -eu
+cd sed local x=1 $(pwd) test $(pwd) grep ${HOME} local test $(pwd) export
+	-eu cd then ${HOME} ${HOME} 2>/dev/null "$1" 'quoted text' test printf then
+		$(pwd) x=1 2>/dev/null -eu ${HOME} "$1"
+2>/dev/null sed awk echo printf grep echo "$@" sed cd $(pwd) x=1 echo local 2>/dev/null
+	export /usr/bin "$@" ${HOME} 'quoted text' grep sed test "$1" "$1" x=1 done
+		readonly local readonly echo then | local "$1"
+x=1 echo done && "$@" 2>/dev/null -eu --verbose "$@"
+"$@" done ${HOME} readonly echo /usr/bin cd local grep local export grep
+${HOME} -eu $(pwd) 2>/dev/null && awk && -eu --verbose 'quoted text'
+	| --verbose printf "$1" echo x=1 readonly grep awk ${HOME} x=1
+	"$@" $(pwd) && export /usr/bin 'quoted text' -eu grep --verbose test
+		readonly --verbose x=1 grep "$@" -eu --verbose -eu printf readonly
+"$1" $(pwd) export cd --verbose
+| printf | | export $(pwd) cd "$@"
+	export readonly readonly export --verbose && 'quoted text' grep
+2>/dev/null grep ${HOME} -eu
+		sed echo echo sed "$1" echo grep | -eu sed sed cd local | "$1"
+		readonly sed then ${HOME} sed ${HOME} sed test
+	"$@" grep /usr/bin 'quoted text' cd -eu
+		grep cd printf && | done 'quoted text' readonly grep export "$1" readonly
+	grep x=1 echo && local echo /usr/bin ${HOME} export --verbose
+		--verbose echo ${HOME} printf | ${HOME} cd echo local 'quoted text' 2>/dev/null
+	awk /usr/bin test grep printf 2>/dev/null
+| 2>/dev/null local then echo test
+	--verbose done && test x=1 "$1" && cd echo && /usr/bin
+	grep readonly "$1" --verbose -eu export readonly ${HOME} && echo grep printf
+local readonly 'quoted text' echo grep local printf
+		export awk | printf && /usr/bin 'quoted text' 'quoted text'
+done -eu 'quoted text' local
+		x=1 local echo "$@" --verbose "$1" echo
+		-eu local | "$@" "$1" /usr/bin
+2>/dev/null then 'quoted text' awk -eu 2>/dev/null sed
+printf test /usr/bin 2>/dev/null -eu /usr/bin && local awk cd printf then
+		sed /usr/bin 'quoted text' done echo
+		export | sed | cd awk readonly grep ${HOME}
+	echo local then && "$1" $(pwd)
+		awk 'quoted text' then local "$1" test "$1" test local ${HOME} ${HOME}
+	readonly --verbose local "$1" then
+	export x=1 test printf
+	${HOME} "$1" 'quoted text' | then awk
+2>/dev/null $(pwd) echo grep | x=1 ${HOME} export
+'quoted text' $(pwd) "$1" 'quoted text'
+	"$@" done printf 2>/dev/null "$1" -eu /usr/bin
+		${HOME} echo local cd "$1"
+	x=1 local /usr/bin x=1 echo "$@" local echo 2>/dev/null "$@" "$@" -eu echo
+		/usr/bin 2>/dev/null 2>/dev/null && 'quoted text' --verbose --verbose
+export /usr/bin 'quoted text'
+	grep export "$@" 2>/dev/null printf -eu cd
+"$@" ${HOME} x=1 "$1" && readonly test done cd ${HOME} test awk && grep
+	-eu sed local done cd sed --verbose ${HOME} --verbose test --verbose | readonly
+		cd local readonly sed | x=1 'quoted text'
+		--verbose --verbose export --verbose export | cd && /usr/bin x=1 local "$1" x=1
+		grep $(pwd) cd readonly "$1" cd | "$@" "$1" --verbose awk readonly then readonly
+	sed $(pwd) --verbose test echo ${HOME} | "$@" test --verbose readonly ${HOME}
+		| 2>/dev/null done local ${HOME} test awk 2>/dev/null
+		-eu test $(pwd) sed printf cd cd awk grep
+	"$1" $(pwd) 'quoted text' awk --verbose x=1 test awk && readonly --verbose 2>/dev/null
+	"$1" test sed local done echo export awk -eu local export
+	--verbose 'quoted text' cd readonly
+	echo "$@" done "$1" echo /usr/bin then local export echo grep echo
+	--verbose sed --verbose
+		test echo 2>/dev/null /usr/bin readonly x=1 printf x=1 then x=1 /usr/bin
+	then awk then printf "$1" sed 'quoted text'
+	export | -eu grep "$@" 2>/dev/null cd export x=1 printf
+		| done --verbose --verbose && $(pwd) && awk then grep
+printf export sed && then "$1"
+	done readonly sed readonly test
+sed --verbose && echo -eu grep "$@" grep | x=1 | "$1" local $(pwd)
+	awk 2>/dev/null then echo
+	--verbose 2>/dev/null | grep readonly local -eu printf
+awk export 2>/dev/null export 2>/dev/null -eu --verbose awk export
+--verbose local local sed sed /usr/bin local "$@" 2>/dev/null
+then "$@" readonly readonly /usr/bin grep "$@" then printf readonly /usr/bin
+		${HOME} ${HOME} /usr/bin && cd x=1 --verbose then 2>/dev/null
+		printf && awk then readonly $(pwd) echo
+then | test test awk then export echo 'quoted text'
+	readonly test readonly "$1" test printf
+		| sed | readonly cd -eu test export
+		/usr/bin awk test ${HOME} "$1" "$1" cd /usr/bin
+		"$1" ${HOME} 2>/dev/null 2>/dev/null | "$1" && ${HOME} --verbose
+		done ${HOME} x=1 --verbose awk grep test &&
+printf readonly local "$@"
+2>/dev/null ${HOME} --verbose
+sed --verbose ${HOME} cd 2>/dev/null cd sed test | && /usr/bin then grep grep
+	${HOME} "$@" grep echo printf x=1
+'quoted text' echo "$@" export ${HOME} export /usr/bin done "$@" awk | readonly
+| local echo grep $(pwd) x=1 $(pwd) then 2>/dev/null export then --verbose
+		awk then 'quoted text' done
+		sed then "$@" sed $(pwd) awk
+		&& export | readonly readonly
+		then -eu test awk "$@" cd -eu -eu /usr/bin 'quoted text' done &&
+		grep local "$1" readonly
+| test x=1 local local grep awk -eu x=1 printf --verbose export $(pwd)
+		/usr/bin 'quoted text' echo local
+		awk awk readonly sed sed local -eu then test --verbose
+		/usr/bin echo printf done "$@" --verbose
+--verbose sed export then test echo x=1 awk sed ${HOME} readonly test $(pwd)
+| $(pwd) echo then "$1" /usr/bin && printf then -eu 'quoted text'
+		${HOME} test | cd 'quoted text'
+		done test printf && cd awk local done $(pwd) grep done -eu printf
+		${HOME} -eu /usr/bin readonly "$@" awk cd
+		| 2>/dev/null ${HOME} done
+	readonly test test x=1 -eu readonly
+	awk "$@" echo | ${HOME} x=1 "$1" --verbose local cd -eu printf
+		echo -eu local x=1 ${HOME}
+		"$1" $(pwd) cd local test ${HOME} x=1 "$1" --verbose export &&
+$(pwd) awk awk | ${HOME} export -eu sed x=1 $(pwd) ${HOME}
+'quoted text' done grep "$1" printf 'quoted text' echo readonly printf
+	x=1 export /usr/bin -eu then -eu
+${HOME} local sed x=1 test grep echo readonly 'quoted text'
+	-eu x=1 | 2>/dev/null grep sed sed /usr/bin
+	test && $(pwd) "$@" export "$1" ${HOME} $(pwd) printf 'quoted text'
+'quoted text' ${HOME} x=1 test /usr/bin readonly cd export "$@"
+	&& sed done awk cd x=1 "$@" --verbose --verbose cd then cd --verbose cd then
+cd printf | && "$1" sed --verbose --verbose --verbose grep done
+local printf then x=1
+| sed grep 2>/dev/null "$1" ${HOME}
+	local && echo ${HOME} $(pwd) test sed export
+		grep | && "$@" "$1" && $(pwd)
+	awk then echo $(pwd) awk test 2>/dev/null
+"$@" && -eu "$1" printf cd printf cd -eu /usr/bin local local "$1" $(pwd)
+		&& "$@" ${HOME} readonly test --verbose 2>/dev/null readonly sed cd ${HOME} grep
+'quoted text' 2>/dev/null -eu &&
+		&& local ${HOME} local printf done done && readonly sed
+	echo awk test --verbose grep ${HOME} printf x=1 readonly && /usr/bin awk readonly
+-eu echo export "$@" grep --verbose 2>/dev/null $(pwd) && 'quoted text'
+sed grep && --verbose printf x=1
+		'quoted text' readonly "$@" printf test "$1" echo "$@"
+		readonly local --verbose printf
+cd 2>/dev/null "$@" awk 'quoted text'
+	$(pwd) cd sed export echo
+	test done 2>/dev/null test readonly export 2>/dev/null
+		'quoted text' grep awk sed awk printf export --verbose
+		-eu readonly "$1" "$@" /usr/bin
+then --verbose export | && sed sed 2>/dev/null 'quoted text' done local /usr/bin
+	x=1 export 'quoted text' 'quoted text' done
+${HOME} local $(pwd) echo $(pwd)
+	grep done -eu export export done awk awk x=1 local --verbose local | cd
+	export grep && ${HOME} echo readonly local cd grep ${HOME} | x=1
+	-eu "$@" x=1 then printf awk cd printf export ${HOME} grep grep
+		&& awk readonly printf -eu ${HOME} printf | "$@" then
+| readonly awk /usr/bin echo x=1 -eu 2>/dev/null
+		awk echo ${HOME} x=1 --verbose done
+readonly ${HOME} sed "$@" | 'quoted text' then "$1" ${HOME}
+	2>/dev/null echo test "$@" then printf 'quoted text' done
+	$(pwd) $(pwd) x=1 test export ${HOME} awk echo awk readonly 'quoted text'
+		-eu done 2>/dev/null --verbose
+		"$1" local readonly printf --verbose
+		readonly export -eu && x=1 echo
+x=1 ${HOME} $(pwd) x=1 export "$@" awk 'quoted text'
+	&& readonly printf "$1" then -eu then done then readonly 'quoted text'
+		--verbose cd | grep awk | echo | 'quoted text' x=1 && echo sed
+		local /usr/bin 2>/dev/null --verbose
+	| "$1" printf | x=1 sed grep
+		then local grep 'quoted text' $(pwd) --verbose local && local -eu local awk
+	cd printf ${HOME} | cd done done grep sed
+	&& /usr/bin 'quoted text' x=1 x=1 x=1 export local
+		done "$@" 'quoted text' printf --verbose
+		then /usr/bin readonly -eu && echo cd sed 2>/dev/null
+cd export readonly 2>/dev/null done /usr/bin printf cd && "$@" 'quoted text'
+	grep printf readonly "$@" -eu x=1 then cd x=1 /usr/bin printf
+		| 2>/dev/null --verbose export then
+--verbose 'quoted text' "$1" export sed printf 'quoted text' cd awk
+awk export cd 2>/dev/null ${HOME} local ${HOME}
+	awk sed then test --verbose awk cd "$@" ${HOME} done echo cd local "$1" grep done
+-eu /usr/bin ${HOME} echo done sed /usr/bin
+		x=1 $(pwd) cd $(pwd) then "$@" "$1" /usr/bin "$@" grep "$1"
+	${HOME} x=1 then awk $(pwd)
+	readonly readonly -eu --verbose
+readonly "$@" /usr/bin $(pwd) x=1 --verbose local local --verbose
+	--verbose local "$@"
+		echo "$1" sed | sed "$@" && local awk test printf then "$1" "$@" echo
+		"$1" done 'quoted text' grep
+	"$@" test test export printf
+2>/dev/null then export export -eu $(pwd) ${HOME} 'quoted text' test /usr/bin
+		--verbose done then cd export test -eu ${HOME} --verbose
+		"$1" test "$@" 'quoted text' done 2>/dev/null
+		awk /usr/bin readonly && "$1" export grep -eu 2>/dev/null grep export | "$@"
+		$(pwd) 'quoted text' grep x=1 then local x=1 export grep
+		then 'quoted text' -eu | "$@"
+done $(pwd) && test /usr/bin ${HOME} echo "$1" cd sed export printf --verbose
+		grep $(pwd) --verbose done 2>/dev/null awk ${HOME} 2>/dev/null
+		$(pwd) printf printf "$@" "$1" "$1" grep then --verbose
+local done 'quoted text' 2>/dev/null export printf -eu --verbose
+		"$@" && export cd x=1 --verbose /usr/bin /usr/bin ${HOME}
+	"$1" local echo test sed export -eu printf "$@"
+	cd readonly test x=1 sed export printf
+export done sed done readonly "$1" printf --verbose cd $(pwd) echo "$@"
+	echo then /usr/bin echo ${HOME} printf export 'quoted text' test && "$1"
+done then awk -eu "$@" echo cd local --verbose
+		'quoted text' -eu x=1 && test grep $(pwd) "$1" local printf
+'quoted text' grep then echo grep done "$@" local 2>/dev/null ${HOME}
+		2>/dev/null 2>/dev/null | /usr/bin test
+	awk local ${HOME} awk test ${HOME} "$1" 2>/dev/null /usr/bin /usr/bin
+	x=1 --verbose -eu sed readonly then "$1" awk awk "$1"
+	sed awk x=1 sed test ${HOME} -eu ${HOME} printf sed test readonly
+	/usr/bin $(pwd) 2>/dev/null cd --verbose $(pwd) done 2>/dev/null
+sed "$1" --verbose awk "$1" grep $(pwd) sed echo x=1 sed | local done x=1
+	echo done cd 'quoted text' then done && "$@"
+		| done test && && then 'quoted text' --verbose then
+		$(pwd) "$@" grep ${HOME} --verbose printf 2>/dev/null readonly printf
+		sed echo local 2>/dev/null | export -eu test
+		'quoted text' $(pwd) "$@" readonly then test -eu test 'quoted text' done x=1
+	/usr/bin readonly awk export
+	--verbose ${HOME} cd cd awk --verbose
+	"$1" x=1 ${HOME} test done
+grep then x=1 printf "$@" grep done sed "$@" | cd cd x=1 done cd printf
+test grep 'quoted text' sed echo | done readonly export
+test "$@" echo done "$@" local
+-eu echo ${HOME} 2>/dev/null
+	readonly | done $(pwd)
+2>/dev/null --verbose awk readonly
+	export awk "$1" cd 2>/dev/null /usr/bin ${HOME} /usr/bin awk
+	/usr/bin $(pwd) 2>/dev/null cd local local done -eu readonly |
+-eu "$1" sed sed sed readonly x=1 x=1 printf ${HOME} ${HOME} printf echo
+	echo export awk 'quoted text'
+"$@" --verbose test awk
+&& "$@" local ${HOME} "$1" sed readonly then "$1" 'quoted text' grep awk 'quoted text'
+		export x=1 awk local /usr/bin "$@" sed && sed echo -eu --verbose /usr/bin
+	awk grep export cd test && $(pwd) awk test printf echo ${HOME}
+echo echo | ${HOME} sed $(pwd) printf grep -eu done --verbose cd local grep sed
+$(pwd) export echo done then grep then ${HOME} ${HOME} /usr/bin $(pwd) test
+		"$@" test /usr/bin && | cd done done then "$@" printf readonly | awk
+sed "$1" export sed test ${HOME} echo x=1 $(pwd) ${HOME} "$@"
+		${HOME} echo | -eu grep "$1" | printf | "$@" /usr/bin && "$@" sed cd -eu
+		export $(pwd) done -eu done x=1 $(pwd) test x=1 awk test $(pwd)
+		sed $(pwd) echo local $(pwd) | "$1"
+		printf done then | "$1" 'quoted text'
+'quoted text' | --verbose test /usr/bin
+	sed -eu readonly echo -eu $(pwd) cd grep test --verbose readonly
+		then test export "$1" "$@" 2>/dev/null
+		echo readonly then local
+		sed $(pwd) printf then x=1 local
+test echo /usr/bin -eu awk grep --verbose sed
+printf test test x=1 $(pwd) && 2>/dev/null
+	readonly && /usr/bin printf done -eu "$1" "$@" printf readonly "$@" -eu readonly
+test --verbose grep x=1 export cd
+grep export "$@" echo then x=1 ${HOME}
+		"$1" "$@" awk x=1 $(pwd) then $(pwd) ${HOME} 2>/dev/null /usr/bin local
+	"$1" "$@" echo --verbose 2>/dev/null
+		"$@" test $(pwd) echo x=1 export done cd echo
+&& "$1" sed --verbose readonly sed local -eu $(pwd) $(pwd) -eu then | |
+		'quoted text' -eu --verbose local 'quoted text' -eu -eu local
+x=1 2>/dev/null /usr/bin local 'quoted text'
+2>/dev/null ${HOME} "$1" export then
+	awk x=1 then ${HOME} | ${HOME} $(pwd) export /usr/bin printf --verbose "$1" x=1
+&& ${HOME} grep export local then test /usr/bin export printf done grep 'quoted text'
+		done readonly echo -eu -eu echo local local /usr/bin
+	readonly /usr/bin echo "$@" cd -eu ${HOME}
+	--verbose "$@" | | x=1 echo done readonly
+		${HOME} -eu "$@" done "$1" $(pwd) printf then local 'quoted text'
+		awk grep printf 'quoted text' awk readonly 2>/dev/null | readonly printf "$@"
+| awk && printf local -eu "$1" sed cd -eu sed readonly
+		awk 'quoted text' "$@"
+sed awk 'quoted text' "$1" x=1 && | local "$1" printf export
+| "$1" && x=1 test && test 2>/dev/null "$@" --verbose "$1"
+		/usr/bin then "$@" /usr/bin | --verbose
+then local && 2>/dev/null --verbose "$1" 'quoted text' $(pwd) | readonly
+	x=1 then ${HOME} "$@" test awk readonly "$1" -eu export export export
+	then -eu "$1" grep then --verbose "$1" "$1" /usr/bin
+		"$@" awk -eu export sed sed local grep $(pwd) && test sed
+x=1 readonly "$1" 'quoted text' grep printf --verbose /usr/bin export
+	awk then /usr/bin && --verbose export printf
+	2>/dev/null readonly "$1" "$1" grep sed 2>/dev/null
+	&& --verbose then --verbose done sed "$1" echo cd awk /usr/bin local
+	awk cd then "$1" $(pwd) 2>/dev/null
+	--verbose 2>/dev/null "$@" test then awk && $(pwd) | "$@"
+	"$@" cd test awk --verbose 'quoted text' sed --verbose 'quoted text'
+		| 2>/dev/null $(pwd) $(pwd) cd 'quoted text'
+		x=1 /usr/bin -eu echo awk done ${HOME} awk
+	readonly local export | x=1 'quoted text' grep grep "$1" $(pwd) $(pwd)
+		--verbose ${HOME} grep done 'quoted text' printf "$1" export
+export export /usr/bin 'quoted text' local readonly
+	-eu 'quoted text' sed 2>/dev/null export done printf "$@" sed
+		--verbose awk export grep
+&& test export /usr/bin x=1 --verbose readonly
+		export 'quoted text' x=1 then printf cd x=1 -eu x=1 && --verbose
+grep grep -eu 2>/dev/null
+		printf -eu "$@" -eu /usr/bin test 2>/dev/null
+done 'quoted text' done local x=1 echo -eu sed "$@" done
+${HOME} done done x=1 readonly 2>/dev/null done ${HOME} "$@"
+	readonly "$1" x=1 ${HOME} /usr/bin done
+		"$1" --verbose grep awk export local test /usr/bin readonly grep readonly
+	--verbose grep && 'quoted text' export 'quoted text' local 'quoted text'
+		/usr/bin awk readonly printf "$1" sed readonly x=1
+echo grep export | --verbose
+/usr/bin export local /usr/bin | sed sed && | ${HOME} echo | awk | printf "$1"
+	| && "$@" echo "$@" "$1" $(pwd) local local echo --verbose readonly
+sed readonly readonly /usr/bin --verbose -eu "$@" readonly -eu
+		done "$@" awk --verbose -eu /usr/bin test "$1" export "$@" export
+	-eu sed cd sed sed 2>/dev/null grep
+		${HOME} x=1 printf /usr/bin then done grep echo
+	'quoted text' --verbose grep printf sed local readonly &&
+	'quoted text' done local -eu readonly awk cd $(pwd) grep | 2>/dev/null sed printf
+	$(pwd) "$1" && printf echo local x=1 /usr/bin && done sed done
+&& then local echo done | awk sed printf
+		test done readonly grep test test export $(pwd) test
+		'quoted text' 'quoted text' done echo ${HOME} 2>/dev/null && /usr/bin && &&
+	'quoted text' cd export -eu ${HOME} -eu && 2>/dev/null x=1 ${HOME} /usr/bin 2>/dev/null
+		2>/dev/null echo then local --verbose
+	awk 'quoted text' then x=1
+		readonly cd -eu echo then cd x=1 grep
+	--verbose export /usr/bin
+		export echo echo --verbose "$@" then done sed sed
+		${HOME} /usr/bin printf | 'quoted text' echo /usr/bin 'quoted text'
+	cd $(pwd) grep readonly test
+		sed sed x=1 x=1 done test test && "$1" --verbose awk awk 2>/dev/null "$1" echo test
+		'quoted text' readonly x=1 local
+	readonly printf /usr/bin --verbose
+		sed ${HOME} "$@" ${HOME} "$@" then awk echo 'quoted text'
+		readonly x=1 2>/dev/null /usr/bin /usr/bin
+		readonly 'quoted text' /usr/bin
+		&& done then echo printf 'quoted text' |
+local ${HOME} ${HOME} "$1" --verbose awk 2>/dev/null grep ${HOME} $(pwd)
+		$(pwd) $(pwd) grep cd export sed sed readonly echo awk then ${HOME} echo echo "$1"
+	/usr/bin 'quoted text' && $(pwd)
+		$(pwd) done cd done then
+readonly echo sed /usr/bin
+		local done /usr/bin test --verbose grep x=1 "$@" sed local 'quoted text'
+		test echo awk printf readonly cd awk ${HOME} x=1
+sed awk x=1 test /usr/bin --verbose -eu
+2>/dev/null $(pwd) then | printf
+'quoted text' && printf echo cd printf echo grep local done 2>/dev/null
+		2>/dev/null | x=1 --verbose
+	printf done readonly 'quoted text' $(pwd) && --verbose 2>/dev/null | test echo
+&& local 'quoted text' $(pwd) awk cd cd cd
+	&& ${HOME} grep x=1 local
+${HOME} | printf then sed $(pwd) x=1 "$@" test "$1" test sed
+	then local /usr/bin --verbose
+done 'quoted text' grep sed export ${HOME} "$1" test test grep
+$(pwd) awk $(pwd) export then then | && echo &&
+		cd grep && test 2>/dev/null ${HOME} sed awk test
+		cd 'quoted text' --verbose && 'quoted text' local sed awk test test "$1" done
+		--verbose "$1" test local done
+		${HOME} awk grep "$1" 2>/dev/null local readonly echo /usr/bin
+	$(pwd) $(pwd) sed test readonly cd -eu -eu 'quoted text'
+	test $(pwd) -eu "$@" printf local
+		then --verbose | && | 2>/dev/null sed -eu --verbose grep 2>/dev/null
+	printf "$1" ${HOME} echo export export "$1" -eu x=1 readonly
+	printf echo 2>/dev/null $(pwd) grep -eu sed printf done 'quoted text' /usr/bin
+		done && -eu sed awk sed --verbose ${HOME} grep
+		echo --verbose then readonly sed done local $(pwd) test then export echo test
+	export x=1 readonly -eu
+		${HOME} echo cd cd sed /usr/bin local
+	-eu printf cd --verbose $(pwd) | printf echo test then
+done export readonly ${HOME} done "$1" --verbose /usr/bin test awk printf /usr/bin
+	'quoted text' $(pwd) && sed sed awk
+	"$@" echo printf $(pwd) awk cd local
+		| $(pwd) done -eu -eu 2>/dev/null cd awk
+cd readonly -eu "$1" export $(pwd) awk 2>/dev/null
+		then 'quoted text' && sed printf test 2>/dev/null printf | export && && &&
+2>/dev/null -eu $(pwd) x=1 "$1" --verbose /usr/bin 'quoted text' --verbose
+		grep "$1" cd awk cd then x=1 -eu | echo
+	"$@" | && /usr/bin export -eu sed && x=1 "$@" x=1 cd
+		2>/dev/null then && printf | grep -eu "$1" "$1" grep
+		$(pwd) cd export cd ${HOME} --verbose
+	"$1" && test echo awk "$1" --verbose then "$@" | /usr/bin "$@"
+		awk sed readonly "$1" ${HOME} $(pwd)
+		grep 2>/dev/null test | "$1" "$@" export --verbose awk awk 'quoted text'
+	sed printf 'quoted text' "$1" ${HOME} grep "$@" echo x=1 "$1" awk 'quoted text'
+2>/dev/null done then -eu cd awk echo "$1" "$1"
+	cd local /usr/bin done "$1" echo
+		"$1" echo cd readonly done
+/usr/bin -eu local grep awk
+	then "$@" readonly --verbose "$@" 2>/dev/null export local $(pwd)
+		'quoted text' sed test -eu then 2>/dev/null
+2>/dev/null --verbose echo local /usr/bin
+'quoted text' 'quoted text' /usr/bin -eu readonly /usr/bin grep export
+		x=1 -eu 'quoted text' cd echo /usr/bin local awk /usr/bin $(pwd) && | /usr/bin
+		2>/dev/null echo ${HOME} "$1" grep grep 2>/dev/null
+echo awk test $(pwd) 2>/dev/null then export cd cd done cd $(pwd)
+/usr/bin "$@" 2>/dev/null | && && readonly
+	export | then grep /usr/bin $(pwd)
+		--verbose readonly && echo then x=1 /usr/bin --verbose -eu grep -eu echo "$@"
+	-eu done test 2>/dev/null /usr/bin then -eu x=1 printf readonly readonly 2>/dev/null
+	$(pwd) then --verbose /usr/bin then
+	'quoted text' printf test && --verbose
+cd ${HOME} done /usr/bin 2>/dev/null x=1 "$@" cd x=1 sed
+	done awk --verbose awk grep "$1" --verbose sed grep "$@" "$@" --verbose -eu
+	'quoted text' /usr/bin 'quoted text' echo done test grep | sed
+"$@" cd /usr/bin | done grep "$1" ${HOME} 2>/dev/null "$@" "$1"
+export | "$1" echo sed && "$@" echo local printf /usr/bin 'quoted text' echo $(pwd)
+	2>/dev/null x=1 grep x=1
+/usr/bin cd then export cd then sed && ${HOME}
+"$@" local then -eu "$@" "$1" $(pwd) cd sed local --verbose printf
+	x=1 /usr/bin ${HOME} ${HOME} printf grep test test echo
+	grep | export test 2>/dev/null
+		x=1 local then 'quoted text' local readonly
+		awk local readonly done /usr/bin export --verbose 2>/dev/null --verbose -eu -eu
+"$@" readonly test "$1" then -eu -eu export local "$@" grep done | local --verbose
+	local ${HOME} $(pwd) then /usr/bin "$1" local
+		readonly then x=1 export grep done x=1 -eu "$@" /usr/bin "$1"
+echo 'quoted text' --verbose printf
+	-eu grep 'quoted text' x=1 test 2>/dev/null
+readonly -eu "$@" done done export && -eu echo done done 2>/dev/null
+readonly 2>/dev/null | echo $(pwd) test local /usr/bin done --verbose
+	--verbose ${HOME} sed grep x=1 | cd test /usr/bin
+		&& 2>/dev/null | 'quoted text' --verbose export done local readonly 2>/dev/null
+		-eu 2>/dev/null local x=1
+	cd x=1 ${HOME} sed 2>/dev/null /usr/bin
+echo readonly then test local then && && grep awk printf grep /usr/bin
+		grep local export $(pwd) "$@"
+		export /usr/bin sed /usr/bin /usr/bin -eu sed then
+		${HOME} export 2>/dev/null | local readonly local done "$1" readonly cd done
+		printf "$1" cd ${HOME} | 2>/dev/null
+grep printf done echo "$@" done ${HOME}
+		"$1" -eu --verbose echo x=1
+export $(pwd) awk test | local
+	'quoted text' x=1 sed ${HOME} 'quoted text' cd local | 'quoted text'
+	grep x=1 --verbose local local then ${HOME} then --verbose done && x=1
+	sed -eu test x=1 x=1 cd echo
+&& /usr/bin x=1 readonly x=1 local cd echo ${HOME}
+		cd export readonly $(pwd) grep export
+		| awk -eu printf ${HOME} done /usr/bin local cd awk && cd sed x=1 done
+"$1" "$1" local local ${HOME} grep printf printf readonly &&
+		| cd 2>/dev/null export grep printf --verbose
+	grep echo ${HOME} then export 'quoted text' 'quoted text'
+	cd x=1 2>/dev/null printf then x=1 test
+	-eu done awk x=1 echo sed echo | -eu 2>/dev/null local test local
+		export test grep && test local
+		-eu $(pwd) readonly "$1" export then done export readonly echo
+export local grep "$@" | 'quoted text'
+	$(pwd) test done ${HOME} sed x=1 ${HOME} $(pwd) $(pwd) grep readonly export ${HOME}
+		${HOME} --verbose sed | -eu done -eu && -eu && cd sed ${HOME} printf
+	'quoted text' readonly cd -eu x=1 cd && awk printf local
+	awk ${HOME} "$@" local
+	x=1 $(pwd) /usr/bin local then done sed
+		x=1 cd x=1 sed && sed x=1 echo $(pwd) done $(pwd) done "$@" -eu ${HOME} "$@"
+grep "$@" then x=1 then --verbose "$1" -eu ${HOME}
+${HOME} 2>/dev/null "$1" ${HOME} export awk "$@" $(pwd) export x=1
+	awk $(pwd) --verbose /usr/bin -eu -eu | "$1" test
+	export awk then "$@" x=1 "$@" "$1" grep -eu ${HOME}
+		${HOME} $(pwd) export cd
+	grep "$1" "$1" x=1 local --verbose $(pwd) | test "$@" /usr/bin
+--verbose echo sed export 2>/dev/null
+2>/dev/null 2>/dev/null "$1" --verbose done printf sed /usr/bin /usr/bin 'quoted text'
+	/usr/bin /usr/bin "$@" "$@"
+	echo $(pwd) then $(pwd) sed readonly 'quoted text' done export
+export local test ${HOME} awk grep
+	grep | ${HOME} x=1 printf
+		x=1 "$@" ${HOME} 2>/dev/null | $(pwd) export /usr/bin "$@" $(pwd) x=1
+	test "$@" awk -eu "$@" sed readonly readonly ${HOME} /usr/bin cd 'quoted text' ${HOME}
+echo x=1 test | done "$@"
+echo && grep x=1 cd 2>/dev/null && 'quoted text' --verbose test ${HOME}
+		echo 2>/dev/null cd | export sed cd local local awk then local test
+		-eu export awk x=1 local "$1" export readonly then
+		/usr/bin --verbose "$@" /usr/bin echo /usr/bin
+		test "$1" echo grep grep /usr/bin
+	cd ${HOME} echo grep test "$@" -eu then done export ${HOME} -eu printf
+	then ${HOME} "$@" printf $(pwd) sed readonly
+		grep done printf done /usr/bin echo && test ${HOME} export grep printf
+cd | x=1 grep export "$1"
+	'quoted text' 'quoted text' printf done readonly "$@" local readonly readonly
+	'quoted text' test echo x=1 -eu grep awk "$@" && test 'quoted text'
+		readonly local -eu test sed then readonly sed local
+${HOME} 2>/dev/null export -eu export echo --verbose /usr/bin awk $(pwd)
+2>/dev/null ${HOME} then cd 'quoted text' /usr/bin --verbose then && local printf
+	printf cd --verbose x=1
+readonly | local echo --verbose $(pwd) --verbose test done export $(pwd) && echo
+		'quoted text' echo -eu export test $(pwd) | | x=1 -eu test cd test cd cd readonly
+	'quoted text' -eu && "$1" ${HOME} /usr/bin "$1" echo 'quoted text' test
+		awk awk 2>/dev/null "$1" export ${HOME} ${HOME} export export "$1" then awk
+	&& x=1 export --verbose "$@" export
+"$@" then --verbose awk "$@" "$1" done | test
+		"$1" "$1" test echo done echo | local && -eu --verbose
+sed sed printf x=1 --verbose printf | /usr/bin
+${HOME} grep $(pwd) cd awk $(pwd)
+		-eu export -eu local -eu awk | then
+		echo local printf local && "$@"
+	local export && | /usr/bin $(pwd) | test x=1 echo cd $(pwd) awk $(pwd)
+		--verbose local | "$@" export grep 2>/dev/null && 2>/dev/null
+x=1 && readonly "$1" echo
+		/usr/bin readonly export -eu printf
+	done cd -eu sed cd cd "$@" "$1" 'quoted text' --verbose readonly "$@" "$@" cd
+		readonly | "$@" $(pwd) x=1 grep $(pwd) /usr/bin $(pwd) /usr/bin awk 2>/dev/null
+	"$1" grep printf /usr/bin /usr/bin cd "$1" 2>/dev/null
+	local local then ${HOME} cd $(pwd) "$1"
+	sed x=1 | $(pwd) echo done test
+		cd "$@" ${HOME} then $(pwd) echo "$@" awk "$1" x=1 done ${HOME} done 'quoted text'
+-eu readonly local awk && readonly printf grep sed x=1 ${HOME}
+grep "$@" ${HOME} ${HOME} ${HOME} readonly sed
+		-eu | 2>/dev/null x=1 "$@" "$@" /usr/bin && x=1 printf $(pwd)
+	--verbose done done x=1 grep grep
+		done x=1 printf awk test cd echo export $(pwd) awk ${HOME}
+		export grep --verbose "$1" 2>/dev/null x=1 then | 2>/dev/null x=1 local
+&& readonly "$@" readonly readonly
+	| test --verbose && done readonly ${HOME}
+	grep sed "$@" test ${HOME} done sed /usr/bin -eu test test cd sed |
+"$@" then 'quoted text' | echo local "$1" "$1" /usr/bin
+local ${HOME} /usr/bin test printf
+		echo awk | test && "$@" done printf
+		grep "$@" grep ${HOME} grep 'quoted text'
+	then readonly awk echo sed x=1 | then -eu then 'quoted text' 2>/dev/null sed
+	-eu $(pwd) "$1" cd 2>/dev/null test
+	awk echo grep x=1 x=1 -eu "$1" done printf readonly sed x=1 | printf 2>/dev/null
+	-eu test test -eu "$1" $(pwd) cd 'quoted text' readonly "$@" ${HOME}
+grep then --verbose $(pwd)
+	sed 'quoted text' /usr/bin && -eu readonly -eu 2>/dev/null "$@" $(pwd) &&
+	| test ${HOME} /usr/bin /usr/bin | export | done
+		done test echo test 'quoted text' awk ${HOME} 2>/dev/null
+		'quoted text' /usr/bin export export sed test x=1 $(pwd) grep
+/usr/bin ${HOME} && test "$@" grep cd && 'quoted text' grep printf 'quoted text'
+		2>/dev/null && done then then x=1 -eu /usr/bin done x=1 readonly local ${HOME}
+/usr/bin sed test done x=1 | test ${HOME} sed awk | x=1 "$@" ${HOME}
+	/usr/bin -eu done readonly
+		export | local awk sed && --verbose export | then
+	sed local cd local cd && sed local | && 2>/dev/null --verbose printf cd
+--verbose test --verbose | printf echo ${HOME} /usr/bin export
+	--verbose 2>/dev/null --verbose export ${HOME} cd 2>/dev/null | echo
+| then 'quoted text' && --verbose done grep local test
+	test readonly test 2>/dev/null | | && cd --verbose 2>/dev/null
+	$(pwd) grep local printf export then cd echo
+		"$1" --verbose /usr/bin export sed awk test cd -eu local printf | $(pwd)
+	local -eu printf then export --verbose &&
+done --verbose export 'quoted text'
+	&& | test 2>/dev/null ${HOME} then test then
+		printf | grep printf $(pwd) --verbose
+x=1 'quoted text' $(pwd) /usr/bin
+/usr/bin cd --verbose
+grep "$@" $(pwd) /usr/bin ${HOME} sed "$1" /usr/bin -eu ${HOME}
+		'quoted text' --verbose done 'quoted text' cd $(pwd) echo x=1 "$@" then | export
+		echo -eu "$1" && | local awk /usr/bin ${HOME} local ${HOME} "$@"
+'quoted text' then && done 'quoted text'
+-eu grep awk export ${HOME} 'quoted text'
+		awk export cd -eu /usr/bin /usr/bin done "$@"
+	"$1" printf echo done sed "$@" "$@" grep -eu export readonly 2>/dev/null
+	done local grep && 'quoted text' ${HOME}
+2>/dev/null -eu cd done awk ${HOME} /usr/bin cd echo then x=1 echo printf
+	'quoted text' sed /usr/bin
+test "$1" "$1" $(pwd) x=1 'quoted text'
+printf --verbose sed cd 'quoted text'
+	readonly cd sed done test ${HOME} "$1" 2>/dev/null x=1 grep then --verbose
+		"$@" "$@" 'quoted text' export sed export && 2>/dev/null
+	/usr/bin cd "$@" --verbose 2>/dev/null readonly x=1 /usr/bin
+	'quoted text' --verbose $(pwd) done x=1 local
+	${HOME} x=1 /usr/bin 'quoted text' then test echo grep then "$@"
+	$(pwd) && test then /usr/bin
+		2>/dev/null grep local grep
+	test 2>/dev/null 2>/dev/null
+	echo grep 'quoted text' awk ${HOME} 2>/dev/null
+	"$@" echo echo awk $(pwd) then
+export cd | echo readonly $(pwd) | "$@" "$@" printf done sed printf test awk -eu
+	awk echo | done --verbose echo x=1 "$@" --verbose
+		printf cd readonly x=1 2>/dev/null local readonly /usr/bin "$@" --verbose
+export done printf then "$@"
+-eu x=1 done -eu $(pwd) awk then test $(pwd) local echo && | readonly
+		| grep done /usr/bin sed then | "$1" sed local readonly then 2>/dev/null
+"$@" --verbose "$@" | cd $(pwd) ${HOME} x=1 $(pwd) | printf $(pwd) sed
+		2>/dev/null grep /usr/bin ${HOME} --verbose 'quoted text' then
+| ${HOME} printf x=1 export cd 2>/dev/null
+		awk 'quoted text' sed then awk then
+	| && $(pwd) readonly $(pwd) "$@"
+test && export echo 2>/dev/null
+	then x=1 "$1" x=1 2>/dev/null export test 2>/dev/null
+"$1" done awk then sed sed ${HOME} readonly && export printf awk $(pwd) | grep
+$(pwd) | "$@" done awk --verbose $(pwd) export export
+--verbose && | 'quoted text' x=1
+		export ${HOME} --verbose /usr/bin export 'quoted text'
+	local echo x=1 ${HOME} then local
+		readonly then 'quoted text' then echo
+	'quoted text' printf printf readonly "$@" -eu -eu "$1" printf $(pwd) 2>/dev/null
+--verbose "$@" done $(pwd)
+export export printf ${HOME} | sed -eu
+sed -eu 'quoted text' "$1" local -eu ${HOME} $(pwd)
+--verbose readonly export "$@" awk grep
+		| awk then 2>/dev/null && printf export echo printf x=1 x=1 "$@" grep 2>/dev/null
+		echo done -eu x=1 --verbose then 2>/dev/null
+	sed grep 'quoted text' then && /usr/bin grep "$1" grep readonly
+'quoted text' local readonly $(pwd) echo 'quoted text'
+		grep && test /usr/bin /usr/bin export /usr/bin
+		"$1" 2>/dev/null readonly /usr/bin
+		test $(pwd) export /usr/bin printf local
+"$1" awk --verbose readonly readonly test x=1 /usr/bin
+		echo 2>/dev/null local test && | done $(pwd) && x=1 readonly cd local
+	| "$1" && test x=1 sed local -eu -eu "$1" $(pwd)
+	"$1" --verbose then ${HOME}
+		$(pwd) then sed export /usr/bin test sed /usr/bin
+		"$@" $(pwd) awk /usr/bin /usr/bin 2>/dev/null
+	test sed "$1" then -eu awk ${HOME} export done export
+/usr/bin printf printf export $(pwd) sed awk 'quoted text'
+$(pwd) test echo && 'quoted text' "$1" "$1" ${HOME} && export test ${HOME}
+		readonly 'quoted text' sed 'quoted text' x=1 done export | readonly done "$@"
+		'quoted text' --verbose done done test "$@" done /usr/bin printf --verbose "$1"
+"$1" test sed awk then echo x=1 grep --verbose cd readonly done done 2>/dev/null
+then "$1" echo "$1" done printf
+x=1 "$1" done readonly cd awk "$1" --verbose echo && echo sed x=1 2>/dev/null
+		readonly "$@" | export "$@" readonly |
+	sed x=1 done cd sed "$1" "$@" /usr/bin cd 'quoted text'
+		test -eu echo cd && | 'quoted text'
+	--verbose "$1" awk --verbose --verbose
+grep $(pwd) awk /usr/bin
+		readonly awk readonly && echo /usr/bin "$1" /usr/bin $(pwd)
+	/usr/bin then | printf
+		printf then cd local "$@" local local
+$(pwd) x=1 done sed export | x=1 sed grep /usr/bin 'quoted text'
+	${HOME} awk x=1 cd test sed "$1" -eu printf /usr/bin x=1 cd
+	--verbose && && x=1 export 2>/dev/null awk test then grep
+	2>/dev/null "$@" echo /usr/bin 'quoted text' sed
+test then echo | $(pwd) ${HOME} | cd ${HOME} sed
+		--verbose printf readonly -eu x=1 /usr/bin test
+	sed "$@" awk cd printf export 2>/dev/null /usr/bin then
+printf "$@" grep ${HOME} awk /usr/bin grep export
+		local --verbose 2>/dev/null "$1" done local export
+--verbose | printf printf cd --verbose
+| "$@" $(pwd) then printf 2>/dev/null ${HOME} then echo /usr/bin "$@"
+-eu -eu echo | echo && "$@" 'quoted text' echo
+	printf --verbose echo done -eu "$@" "$1" export 'quoted text' test sed
+echo $(pwd) awk grep 2>/dev/null | 'quoted text' -eu | /usr/bin x=1 && readonly
+		-eu /usr/bin | $(pwd) "$1" done
+	test $(pwd) done done local then echo "$@" readonly x=1 /usr/bin then | $(pwd)
+$(pwd) ${HOME} readonly grep awk
+	--verbose local local "$@" 2>/dev/null awk "$@" --verbose
+		export printf cd "$@"
+	'quoted text' | x=1 x=1 sed awk sed
+		cd 'quoted text' $(pwd)
+sed "$@" readonly done x=1 --verbose printf then sed done "$1" export then
+	cd sed 'quoted text' -eu then | sed export sed sed /usr/bin
+		local printf printf cd then $(pwd)
+		done 2>/dev/null $(pwd) -eu "$1"
+&& sed && $(pwd) 'quoted text' test awk "$1"
+		awk 'quoted text' ${HOME} "$1" x=1 x=1 x=1 && cd && x=1
+	| | | ${HOME} sed && printf export
+		${HOME} echo printf done -eu | export
+cd grep printf done /usr/bin | "$@" test sed awk awk && test
+'quoted text' --verbose ${HOME} export cd
+		/usr/bin 2>/dev/null "$@" && export done awk then --verbose printf awk
+"$1" /usr/bin export | awk 2>/dev/null && 2>/dev/null -eu sed
+readonly 'quoted text' echo && readonly
+x=1 2>/dev/null 2>/dev/null
+		| "$1" done "$@" awk export
+		then "$1" | export && "$@" /usr/bin 'quoted text'
+		&& | grep | $(pwd) "$1" x=1 printf done awk x=1 ${HOME}
+		export "$1" echo "$1" printf ${HOME} | /usr/bin echo grep export | "$@" sed -eu
+	done | 2>/dev/null /usr/bin awk grep --verbose --verbose | ${HOME} printf
+	| then readonly awk --verbose | /usr/bin local sed -eu cd then 2>/dev/null
+cd echo $(pwd) awk sed x=1
+		echo ${HOME} export readonly awk echo echo /usr/bin readonly 'quoted text'
+grep grep | --verbose --verbose "$1" ${HOME} sed
+$(pwd) $(pwd) ${HOME} | x=1 local x=1 && then then $(pwd) done
+		/usr/bin | local /usr/bin awk done | printf && --verbose && local "$@" 2>/dev/null
+	$(pwd) cd $(pwd) sed awk x=1 then readonly awk
+		sed cd "$@" then grep test awk sed awk "$1"
+	test test cd "$1" export then "$1" printf ${HOME} printf
+grep sed test 'quoted text'
+	cd && "$@" then awk awk x=1 awk sed $(pwd)
+		$(pwd) grep local "$1" export "$1"
+	"$@" readonly --verbose 2>/dev/null /usr/bin "$@" $(pwd)
+	echo awk && awk echo readonly
+		/usr/bin "$1" 'quoted text' x=1 grep export echo printf cd "$1"
+grep done readonly $(pwd) 'quoted text' grep export -eu
+export $(pwd) /usr/bin then "$@" x=1 "$@" $(pwd) echo --verbose -eu local
+test echo $(pwd) export done echo grep awk
+	printf echo /usr/bin /usr/bin -eu 2>/dev/null --verbose
+		-eu x=1 test /usr/bin
+awk echo grep ${HOME} sed
+		--verbose readonly printf $(pwd)
+		export then x=1 done readonly --verbose grep "$@" export | --verbose
+		done test local readonly cd printf test $(pwd)
+	-eu /usr/bin && then 'quoted text' -eu grep 2>/dev/null
+		test "$@" export cd ${HOME} then awk --verbose
+	echo 'quoted text' readonly
+printf sed "$@" && $(pwd) ${HOME} export $(pwd)
+		sed x=1 printf sed /usr/bin && ${HOME} --verbose
+2>/dev/null 2>/dev/null export local readonly $(pwd)
+		$(pwd) x=1 2>/dev/null "$1" ${HOME} "$@" cd
+		local 'quoted text' -eu cd -eu
+	"$1" test "$1" test test $(pwd) | -eu
+export --verbose x=1 export x=1 awk $(pwd) grep grep "$1"
+		x=1 "$1" "$1" export 'quoted text' --verbose 2>/dev/null --verbose export
+		-eu export $(pwd) export "$1" "$1" /usr/bin | ${HOME} grep x=1 ${HOME}
+"$1" /usr/bin awk test -eu printf 2>/dev/null 2>/dev/null --verbose then /usr/bin
+sed | 'quoted text' 2>/dev/null awk | --verbose echo -eu awk --verbose test
+		'quoted text' x=1 echo grep | 2>/dev/null then readonly awk echo | | done export
+		| --verbose ${HOME} ${HOME}
+	2>/dev/null --verbose "$@" sed grep x=1 "$1" grep awk
+		awk cd /usr/bin /usr/bin 2>/dev/null 'quoted text' test "$@"
+test sed 2>/dev/null "$1" export cd -eu /usr/bin x=1 printf cd ${HOME} sed
+	echo /usr/bin /usr/bin readonly
+		2>/dev/null done then -eu "$@" sed x=1 then done echo x=1 printf export
+	x=1 | done /usr/bin && "$@" local grep | grep printf
+		done export /usr/bin done printf 2>/dev/null "$1" $(pwd) cd
+		test sed export --verbose done export readonly "$@" export
+	"$@" --verbose cd local local | /usr/bin echo local readonly test readonly
+| 'quoted text' ${HOME} 2>/dev/null export -eu echo grep cd | 2>/dev/null
+		"$1" done sed /usr/bin cd /usr/bin --verbose grep done
+then done && then 2>/dev/null sed done printf test printf
+| 2>/dev/null then "$@" cd echo "$1" /usr/bin --verbose
+		awk printf done printf 'quoted text' printf | ${HOME} local /usr/bin "$1"
+		"$@" export sed $(pwd) | -eu echo readonly /usr/bin
+sed $(pwd) 2>/dev/null export -eu sed readonly awk grep then done 2>/dev/null
+echo 2>/dev/null "$1" grep export cd grep /usr/bin
+	export $(pwd) -eu ${HOME} "$1" sed x=1 2>/dev/null
+2>/dev/null $(pwd) 'quoted text' 'quoted text' awk /usr/bin
+local "$@" test | grep done done x=1 | $(pwd) ${HOME}
+		sed grep "$1" $(pwd) /usr/bin
+-eu 2>/dev/null ${HOME}
+	export && 2>/dev/null && awk
+		&& | -eu ${HOME} printf sed /usr/bin done -eu then printf 'quoted text'
+local readonly && ${HOME} && done local readonly
+		${HOME} done then readonly then awk echo echo
+	export $(pwd) --verbose 2>/dev/null 'quoted text' | && --verbose "$@" "$@"
+echo done test readonly test --verbose done --verbose $(pwd)
+	${HOME} x=1 $(pwd) grep x=1 test $(pwd) && | 2>/dev/null && awk $(pwd) readonly
+then -eu export 2>/dev/null x=1 $(pwd) local "$1" cd $(pwd) "$1" done
+	| && awk && echo echo sed --verbose cd 2>/dev/null test
+		cd done x=1 x=1 cd test "$1" "$1" test awk ${HOME}
+then echo export printf sed -eu export --verbose printf echo awk echo echo 2>/dev/null
+'quoted text' 2>/dev/null 'quoted text' grep readonly
+		-eu test ${HOME} $(pwd) cd "$@" -eu
+		export awk grep awk local "$1" 'quoted text'
+		printf 2>/dev/null readonly x=1 grep test echo test 'quoted text' cd | -eu sed
+	export $(pwd) $(pwd) awk awk awk && awk ${HOME}
+		x=1 --verbose awk 2>/dev/null local done then x=1 local 'quoted text'
+--verbose awk -eu readonly
+readonly "$1" cd $(pwd) cd awk -eu /usr/bin "$@" /usr/bin && test local local
+		| sed test export 'quoted text' "$@" ${HOME} sed cd cd "$1" -eu |
+--verbose local sed /usr/bin local $(pwd) cd done
+		done ${HOME} 2>/dev/null cd export ${HOME}
+		-eu x=1 printf 'quoted text'
+	awk echo test 2>/dev/null 2>/dev/null
+	export then $(pwd) x=1 readonly "$@" done
+		echo local "$@" && cd export --verbose ${HOME} done test export test
+		--verbose export 2>/dev/null /usr/bin x=1
+	$(pwd) echo 2>/dev/null grep cd 'quoted text'
+	then local -eu cd 'quoted text' x=1 local
+	sed printf local grep -eu | /usr/bin
+		&& cd cd local x=1 printf /usr/bin "$1" /usr/bin && 'quoted text'
+"$1" done readonly cd printf cd && ${HOME} 'quoted text' | ${HOME} echo done "$@"
+then cd ${HOME} echo echo sed echo -eu sed 2>/dev/null
+	"$@" readonly --verbose --verbose
+	echo "$@" 2>/dev/null test readonly then "$@" local readonly
+| && export | cd test local printf 'quoted text' /usr/bin awk export
+	awk readonly local grep x=1 then 'quoted text' export /usr/bin local
+'quoted text' "$1" "$@" local test awk grep
+	--verbose $(pwd) /usr/bin
+	test echo $(pwd) 'quoted text'
+--verbose local -eu local local $(pwd) awk -eu then
+	x=1 export && export "$@" /usr/bin sed "$1" echo done 'quoted text' grep printf
+	| /usr/bin && --verbose 2>/dev/null "$@"
+--verbose ${HOME} && -eu test readonly
+		sed ${HOME} $(pwd) && ${HOME} readonly printf readonly echo test readonly
+		grep $(pwd) "$@" printf ${HOME} "$@" local awk
+		grep && test test "$1" -eu sed $(pwd) awk ${HOME} test $(pwd)
+done $(pwd) local -eu
+| export sed /usr/bin "$@" ${HOME} | export local cd
+		$(pwd) "$1" --verbose export ${HOME} 2>/dev/null readonly test grep --verbose
+readonly x=1 ${HOME} "$@" then /usr/bin awk printf | printf local "$@" "$1"
+| x=1 && "$1" readonly cd -eu | --verbose $(pwd) -eu -eu then export
+	$(pwd) cd 'quoted text' "$1" sed 'quoted text'
+	local grep cd done test test cd 2>/dev/null $(pwd)
+	sed | readonly cd export "$@"
+grep 2>/dev/null grep x=1
+		then --verbose readonly printf 2>/dev/null then | printf "$1"
+		awk x=1 cd --verbose done printf done "$1"
+x=1 2>/dev/null | | sed test local readonly
+		then printf test grep
+	echo then | cd && awk cd 2>/dev/null
+	${HOME} ${HOME} test | local $(pwd)
+-eu | | && --verbose grep readonly "$1" /usr/bin printf ${HOME} "$1" test 2>/dev/null
+grep ${HOME} ${HOME} $(pwd) local 'quoted text' x=1 sed
+	printf 2>/dev/null ${HOME} -eu 2>/dev/null done --verbose grep then echo --verbose
+echo "$1" done $(pwd) 2>/dev/null /usr/bin export
+"$@" echo "$1" then sed test 'quoted text' "$@" cd --verbose
+${HOME} --verbose 2>/dev/null
+		-eu export "$1" echo 2>/dev/null /usr/bin test readonly readonly --verbose
+		$(pwd) | && sed printf cd cd printf local awk "$1" "$1" x=1 "$1"
+grep --verbose && test --verbose
+		"$@" done /usr/bin x=1 'quoted text' $(pwd) 2>/dev/null --verbose
+printf printf printf --verbose
+/usr/bin 'quoted text' x=1 sed
+	2>/dev/null 'quoted text' "$1" test export $(pwd) printf printf /usr/bin readonly
+echo awk -eu "$1" 2>/dev/null $(pwd) $(pwd) "$@"
+		"$1" 'quoted text' 'quoted text' echo readonly
+$(pwd) local cd local && | | printf
+		cd 2>/dev/null test cd
+		then | sed grep grep -eu && 2>/dev/null 2>/dev/null /usr/bin echo 2>/dev/null
+grep ${HOME} local && grep
+		/usr/bin export /usr/bin awk "$@" grep test | | export /usr/bin
+-eu export -eu /usr/bin
+	echo ${HOME} x=1 awk grep
+	-eu export done --verbose then
+	awk /usr/bin grep grep 'quoted text' then awk 2>/dev/null test
+	readonly echo && -eu export && export cd sed awk 'quoted text' cd | printf
+awk -eu done printf --verbose ${HOME}
+test echo "$1" /usr/bin readonly awk grep $(pwd) done
+		--verbose readonly local ${HOME}
+		readonly ${HOME} x=1 export cd cd -eu -eu "$@" $(pwd) "$1" "$@"
+		printf ${HOME} /usr/bin local then x=1 echo printf 'quoted text'
+printf ${HOME} grep echo awk 2>/dev/null
+'quoted text' && echo then printf 2>/dev/null local "$@" | printf 'quoted text'
+	-eu done grep "$1" local cd sed $(pwd) | test sed $(pwd) export local
+	-eu "$@" readonly 2>/dev/null --verbose
+	cd -eu awk echo x=1 "$@" readonly sed 2>/dev/null awk
+		echo ${HOME} $(pwd) "$@" $(pwd) /usr/bin "$1" -eu sed
+export export "$@" export grep "$1" && local local printf local
+		--verbose "$@" readonly done then /usr/bin then awk export
+		done sed && readonly | x=1 --verbose grep then
+		x=1 printf then cd printf -eu test $(pwd) --verbose then
+		$(pwd) printf readonly test && "$@" && then sed test local sed then cd "$1"
+	&& x=1 test local awk "$1" --verbose -eu $(pwd) |
+	awk export && then "$1" "$1" &&
+		${HOME} x=1 $(pwd) 2>/dev/null cd | sed sed echo ${HOME} export x=1 x=1
+	printf test 2>/dev/null export then
+	"$1" test x=1 export /usr/bin "$@" echo readonly
+		x=1 test then "$@" grep -eu echo --verbose awk readonly x=1 ${HOME} $(pwd)
+readonly x=1 done echo readonly
+	2>/dev/null "$1" test 2>/dev/null 2>/dev/null test && && awk awk printf 2>/dev/null
+	cd "$1" then && sed printf then export then cd printf test ${HOME}
+'quoted text' test test readonly
+export awk --verbose readonly
+		--verbose x=1 readonly readonly
+test -eu echo export readonly 'quoted text' --verbose $(pwd)
+	x=1 printf export | grep 2>/dev/null $(pwd) | echo echo grep /usr/bin
+cd sed test printf --verbose done | && then done "$1" x=1 awk
+		${HOME} cd 'quoted text' --verbose
+	cd && awk local "$@" -eu done sed export
+	-eu -eu $(pwd) "$1" cd readonly export echo readonly readonly x=1
+		test then sed --verbose echo | 'quoted text' readonly awk --verbose local readonly
+	| 'quoted text' awk && local done | test echo "$@" --verbose export
+		&& export && x=1 done echo ${HOME}
+	done export ${HOME} then $(pwd)
+-eu done then echo grep readonly
+		-eu --verbose export export test 2>/dev/null x=1 sed x=1 /usr/bin then -eu
+printf -eu | $(pwd) done awk grep $(pwd) 2>/dev/null ${HOME} 'quoted text'
+readonly /usr/bin && export | echo 2>/dev/null
+grep 2>/dev/null && $(pwd)
+	x=1 ${HOME} "$1" sed --verbose then -eu echo cd $(pwd) local
+export test /usr/bin "$1" readonly
+#include c211.sh
+		${HOME} 2>/dev/null printf grep -eu echo grep done test export $(pwd)
+	local -eu ${HOME} local printf
+then local 'quoted text' $(pwd) sed /usr/bin done done echo /usr/bin readonly
+		export x=1 ${HOME} /usr/bin
+test local /usr/bin cd grep local --verbose export then then /usr/bin
+		done test done test --verbose -eu $(pwd) awk sed export
+"$@" readonly local && 'quoted text' x=1 cd readonly x=1 | x=1 "$@" -eu echo
+"$1" grep cd /usr/bin "$1" "$1" test x=1 export ${HOME} echo 2>/dev/null
+$(pwd) done -eu /usr/bin 'quoted text' x=1 'quoted text' echo grep 'quoted text'
+echo --verbose awk printf
+	"$1" "$@" done $(pwd) | sed --verbose /usr/bin grep
+	$(pwd) x=1 cd "$1" export awk $(pwd) --verbose "$@"
+"$1" | --verbose done ${HOME}
+		/usr/bin awk then -eu grep awk --verbose sed | done then 'quoted text'
+		sed export 2>/dev/null then ${HOME} 'quoted text'
+		echo sed then -eu export "$1" /usr/bin local "$@"
+	echo | then echo "$@" "$@" test local -eu
+	then done then printf "$1"
+	printf && done echo cd --verbose
+&& printf readonly printf ${HOME} test echo grep readonly
+&& /usr/bin 2>/dev/null
+		done test local "$1" export --verbose "$@" then cd
+done x=1 $(pwd) done local x=1 grep
+		"$@" cd $(pwd) 'quoted text' $(pwd) -eu "$1" -eu /usr/bin 2>/dev/null
+local printf -eu $(pwd) --verbose
+x=1 && "$@" sed done export 'quoted text' sed
+		echo $(pwd) awk x=1 "$@" export 'quoted text'
+	"$1" local awk "$1" awk local grep printf cd && echo "$1" "$1"
+		export && $(pwd) grep readonly 2>/dev/null printf test cd grep export
+	test "$1" done --verbose x=1 export
+done 2>/dev/null done printf $(pwd)
+	/usr/bin export /usr/bin readonly
+	readonly cd ${HOME} -eu "$@" --verbose printf $(pwd) x=1 test awk 'quoted text'
+${HOME} local cd then | then printf
+	| printf -eu done echo sed --verbose $(pwd) x=1 2>/dev/null 2>/dev/null
+		"$@" ${HOME} printf $(pwd)
+		--verbose then 2>/dev/null done 'quoted text' -eu | "$1" grep awk test
+	-eu 'quoted text' ${HOME} "$@" ${HOME}
+test --verbose && echo awk /usr/bin printf "$@" --verbose /usr/bin ${HOME}
+	| "$1" then grep "$@" test echo cd export sed cd local ${HOME}
+		&& echo awk 2>/dev/null "$1" "$1" 'quoted text' 2>/dev/null "$1" done export
+--verbose awk grep local done printf
+	-eu local cd printf 'quoted text' 2>/dev/null
+	readonly x=1 2>/dev/null
+awk local 2>/dev/null sed sed local echo $(pwd) readonly "$1" sed "$@" local
+		${HOME} grep x=1 echo done x=1 printf 2>/dev/null $(pwd)
+| ${HOME} x=1 cd readonly echo 'quoted text' sed test awk -eu
+		--verbose awk "$1" awk then x=1 cd $(pwd) readonly
+		$(pwd) && sed 'quoted text' "$1" | echo | grep
+		2>/dev/null 'quoted text' echo "$1" && test "$1" -eu x=1 && echo 2>/dev/null
+	then readonly then /usr/bin local cd && x=1 $(pwd)
+		"$@" $(pwd) /usr/bin /usr/bin x=1 done sed -eu 2>/dev/null
+		sed awk awk grep ${HOME} readonly /usr/bin ${HOME} printf then ${HOME} grep
+-eu grep test 'quoted text' 2>/dev/null grep 'quoted text' "$@" $(pwd)
+		--verbose -eu export && then sed /usr/bin
+		2>/dev/null | -eu test /usr/bin export awk --verbose readonly echo
+	${HOME} --verbose | "$1" | $(pwd) readonly done "$@" readonly
+	done grep && awk export "$1" grep echo "$1"
+	sed && done awk cd local echo local printf x=1 export 2>/dev/null test done
+		test ${HOME} | -eu readonly --verbose grep $(pwd)
+	readonly | grep ${HOME} x=1 echo cd --verbose $(pwd) printf sed local
+		test | readonly awk local -eu /usr/bin
+sed done "$@" -eu | local "$1" $(pwd)
+		echo awk x=1 done | 2>/dev/null | test awk "$1" grep "$1" $(pwd) grep "$1"
+export done "$@" "$@" local echo --verbose export
+	'quoted text' $(pwd)
+		x=1 x=1 && --verbose
+		test 2>/dev/null printf | cd cd sed && sed test then "$@" awk
+	-eu --verbose grep | $(pwd) 'quoted text' echo ${HOME} awk | echo /usr/bin
+"$@" "$@" --verbose awk test readonly readonly "$1"
+		x=1 'quoted text' sed && readonly
+grep "$1" test ${HOME} awk sed printf x=1 printf 'quoted text' echo 2>/dev/null
+readonly --verbose grep
+		local printf cd done x=1 sed && |
+	--verbose export $(pwd) readonly
+	--verbose $(pwd) "$1" done awk readonly "$@" "$@" $(pwd) x=1 /usr/bin x=1
+${HOME} readonly --verbose
+	done export && then 'quoted text' -eu "$@" | printf "$1"
+	| readonly test | && awk x=1 "$@" awk done | -eu cd export | test then done
+printf export then && ${HOME} "$@" readonly -eu 2>/dev/null export
+	readonly /usr/bin cd local --verbose "$@" export local grep readonly
+	&& 2>/dev/null export ${HOME} done "$@" "$@" $(pwd)
+	'quoted text' $(pwd) local && local local x=1 --verbose /usr/bin
+		'quoted text' 2>/dev/null --verbose 'quoted text'
+		--verbose -eu local --verbose done local cd --verbose then $(pwd)
+	printf 2>/dev/null readonly -eu $(pwd) local ${HOME} "$1"
+		2>/dev/null && grep "$1" ${HOME} $(pwd) ${HOME} cd done "$1"
+"$1" -eu grep /usr/bin 'quoted text' "$@" export
+	awk export ${HOME} local
+| sed | cd 'quoted text' export $(pwd) $(pwd) | ${HOME} "$@" done sed test "$1"
+		sed echo x=1 cd grep && x=1
+		"$@" "$@" local --verbose local test done local
+		test sed awk printf 'quoted text' done cd cd
+| "$1" x=1 test cd 'quoted text'
+$(pwd) ${HOME} export /usr/bin
+	/usr/bin export 'quoted text' | 'quoted text' sed printf ${HOME} awk echo
+		-eu grep -eu "$1" "$1" grep && | ${HOME} echo local | | export local "$1" local
+		"$1" $(pwd) readonly --verbose --verbose
+local | 2>/dev/null local x=1
+	| "$1" ${HOME} sed &&
+	printf export then done 2>/dev/null readonly x=1 "$@" export
+	done test done printf /usr/bin ${HOME} "$1"
+"$1" local /usr/bin grep test | $(pwd)
+		2>/dev/null "$@" echo echo export then 'quoted text'
+		/usr/bin cd readonly sed awk ${HOME} && $(pwd) cd | local sed echo x=1 /usr/bin
+"$@" echo -eu "$1" export test echo 'quoted text' | printf "$1" 'quoted text'
+${HOME} "$@" 2>/dev/null ${HOME} ${HOME} echo 'quoted text' 'quoted text'
+		2>/dev/null awk printf 'quoted text' "$1" then done sed test grep $(pwd) x=1
+	x=1 && awk cd $(pwd) export awk x=1
+"$1" echo awk export test ${HOME} "$1" "$@" readonly
+		awk grep && 2>/dev/null
+		| $(pwd) && ${HOME} -eu /usr/bin | export /usr/bin
+		| ${HOME} /usr/bin 2>/dev/null 2>/dev/null && | sed $(pwd)
+then ${HOME} local printf
+local cd "$1" "$1" "$@" --verbose
+local then | "$1" then echo 2>/dev/null 2>/dev/null
+grep --verbose /usr/bin grep $(pwd) --verbose export
+	local x=1 -eu test awk --verbose 2>/dev/null awk
+	'quoted text' export echo ${HOME} local echo printf x=1 local
+"$@" $(pwd) x=1 done x=1 then awk
+		local local readonly x=1 local test
+/usr/bin grep done test "$1"
+echo ${HOME} test "$@" printf x=1 local x=1 "$1" "$1" 2>/dev/null export "$@" done
+	-eu ${HOME} && ${HOME} readonly grep cd cd --verbose -eu
+readonly then $(pwd) test
+printf then "$@" readonly "$1" readonly | "$@" export local
+$(pwd) "$1" done -eu | 2>/dev/null readonly "$@" sed echo export $(pwd) x=1
+		cd local echo local /usr/bin /usr/bin grep test export then &&
+	export -eu done /usr/bin 'quoted text' 'quoted text' ${HOME} | $(pwd) readonly
+	cd "$@" "$1" "$@" echo | sed | cd printf cd
+		local readonly $(pwd) export grep cd local
+"$@" "$@" "$@" $(pwd) local echo
+		"$@" cd -eu local 2>/dev/null && readonly
+		sed printf grep $(pwd)
+		--verbose -eu && awk 'quoted text' $(pwd) then then readonly $(pwd) echo
+		| $(pwd) readonly printf
+	&& local "$1" cd x=1 cd printf local 2>/dev/null && awk 2>/dev/null 'quoted text'
+grep then local 'quoted text'
+	then test "$1" readonly test then local && ${HOME} cd --verbose echo
+		done grep awk printf $(pwd) /usr/bin "$@" ${HOME} ${HOME} "$@" cd export
+	local awk 'quoted text' readonly "$1" --verbose /usr/bin
+	"$@" | cd export 2>/dev/null && local "$@"
+	&& cd export grep sed $(pwd) x=1
+		awk --verbose -eu && echo /usr/bin
+	$(pwd) test local local export sed echo sed --verbose then /usr/bin export
+		then -eu grep | ${HOME} x=1 echo cd
+		export local done grep --verbose done local /usr/bin local ${HOME}
+	export test -eu awk "$1" cd "$1" /usr/bin &&
+'quoted text' local done --verbose awk && && then awk 'quoted text'
+printf printf -eu /usr/bin sed sed "$1" echo then printf -eu | printf
+${HOME} awk x=1 /usr/bin ${HOME} awk awk --verbose $(pwd)
+		&& $(pwd) printf "$@" local && "$@" export printf sed cd 2>/dev/null
+	local ${HOME} awk | export export awk
+-eu cd "$1" 2>/dev/null "$1" then
+sed done $(pwd) "$@" 2>/dev/null readonly $(pwd)
+	| grep readonly "$@" cd $(pwd) done sed
+	sed "$@" 2>/dev/null
+	printf $(pwd) && echo $(pwd) export then x=1 local && | done
+${HOME} readonly readonly "$1" cd awk -eu && 2>/dev/null
+		$(pwd) cd done readonly "$1" $(pwd) $(pwd)
+		sed sed "$1" done --verbose printf test echo readonly "$@" sed
+		"$1" $(pwd) local /usr/bin x=1 x=1 printf cd | echo 'quoted text' readonly
+		"$1" export then then && cd done 2>/dev/null export export | "$1"
+		/usr/bin 2>/dev/null 'quoted text' "$@" "$@" -eu sed && readonly
+		local /usr/bin then grep x=1 2>/dev/null
+		x=1 readonly local && /usr/bin $(pwd)
+	export sed printf printf 2>/dev/null readonly && -eu $(pwd) "$1" $(pwd) "$1"
+		test echo awk sed -eu -eu grep test x=1 x=1
+sed test readonly 'quoted text' cd "$1"
+	then ${HOME} echo local | && | 'quoted text'
+	grep 'quoted text' test readonly "$1"
+| "$@" printf awk "$@" readonly "$1" awk printf
+"$1" /usr/bin awk sed -eu done awk echo grep then "$1" then -eu grep then "$1"
+printf readonly 2>/dev/null printf 2>/dev/null
+		echo export $(pwd) ${HOME} printf readonly cd 2>/dev/null "$@" done /usr/bin ${HOME}
+		cd printf echo -eu | | local x=1 readonly
+		test ${HOME} grep done -eu 2>/dev/null "$1" grep done readonly
+| 'quoted text' --verbose
+		test | sed awk grep awk -eu export 2>/dev/null x=1 readonly $(pwd)
+		"$1" printf x=1 done 2>/dev/null x=1 local sed done printf readonly x=1
+	x=1 && test 'quoted text'
+		printf 'quoted text' readonly sed "$@" export -eu | awk "$1" test
+		readonly ${HOME} 'quoted text' "$@" test local done done "$1" then echo cd --verbose
+		done cd | /usr/bin /usr/bin local "$1" readonly done then x=1
+	"$@" readonly awk "$1" && awk printf then
+		awk | && local then done awk
+${HOME} ${HOME} -eu --verbose | "$@" then done x=1 test test local
+		sed then | done $(pwd) grep export | $(pwd) x=1 grep grep -eu -eu
+		sed -eu cd "$1" local test export "$1" then then then /usr/bin then --verbose
+		--verbose 2>/dev/null awk test test 2>/dev/null cd 2>/dev/null 2>/dev/null
+		&& grep then cd 2>/dev/null test then ${HOME}
+2>/dev/null local | -eu readonly export
+"$@" then echo -eu awk
+-eu local awk sed "$1" && /usr/bin ${HOME} awk test awk awk x=1
+		| --verbose awk grep 'quoted text' x=1
+	"$1" sed $(pwd) local sed $(pwd) readonly
+"$1" test x=1 export 'quoted text'
+	export | export awk printf export "$1" -eu test
+	grep "$1" /usr/bin ${HOME} grep done readonly test --verbose ${HOME}
+	| readonly grep test local echo sed | && test printf local
+	| $(pwd) "$@" done cd "$1" && printf --verbose -eu readonly echo "$@" "$@"
+then ${HOME} -eu done test awk && 2>/dev/null local x=1 | ${HOME}
+$(pwd) test && ${HOME} test grep printf 2>/dev/null ${HOME} -eu export
+	then "$@" local x=1 export x=1 cd local cd readonly "$1" "$@"
+'quoted text' -eu 'quoted text' -eu "$1" cd -eu x=1 local cd x=1 sed then export
+	&& /usr/bin grep readonly cd echo /usr/bin sed ${HOME} && --verbose
+	test echo sed | $(pwd) grep sed | 2>/dev/null done printf then
+local --verbose cd done test "$1"
+	then && --verbose readonly test done done | echo
+	local export /usr/bin awk --verbose --verbose
+test x=1 ${HOME} "$1" export ${HOME} 'quoted text' x=1 'quoted text' done 'quoted text'
+	awk --verbose sed cd && echo test done ${HOME} x=1
+	$(pwd) printf 'quoted text' done -eu echo "$@" readonly test "$1" ${HOME} test
+	readonly done done then /usr/bin -eu then done sed export
+readonly ${HOME} "$1"
+		local --verbose /usr/bin then printf test -eu $(pwd) readonly cd 'quoted text'
+	2>/dev/null cd 'quoted text' && 2>/dev/null 'quoted text' sed echo sed done
+local 2>/dev/null "$@" "$1" && && /usr/bin x=1 && ${HOME} "$1" printf then /usr/bin
+	2>/dev/null $(pwd) sed then 'quoted text' printf $(pwd)
+		"$@" cd awk 2>/dev/null echo 'quoted text'
+	x=1 cd cd grep done --verbose 'quoted text'
+		readonly && local readonly cd sed sed grep sed cd local sed export
+	awk local "$@" $(pwd) "$@" $(pwd) -eu /usr/bin | 'quoted text'
+		printf 'quoted text' ${HOME} local
+		echo 2>/dev/null local /usr/bin -eu $(pwd) && export then
+		test "$1" cd $(pwd) done then sed | -eu cd | printf 2>/dev/null
+		-eu --verbose then 2>/dev/null 'quoted text' "$1" readonly "$1"
+	cd $(pwd) printf export | --verbose
+	-eu local printf ${HOME} 2>/dev/null | readonly then sed sed | "$1" then
+done x=1 && export x=1 printf then
+	2>/dev/null local printf 'quoted text'
+printf test 2>/dev/null "$@" ${HOME} test export export ${HOME} local
+'quoted text' test | 'quoted text'
+	${HOME} && ${HOME} readonly sed --verbose printf /usr/bin
+		readonly 'quoted text' x=1 "$1" | x=1 local echo
+'quoted text' awk export 'quoted text' 2>/dev/null
+	done cd /usr/bin then && grep
+		-eu sed ${HOME} "$@" x=1 && sed echo export grep export awk | -eu
+	cd sed 2>/dev/null awk then && && | ${HOME} ${HOME} $(pwd) && local local local
+		grep export then echo
+	${HOME} printf "$@" -eu -eu echo readonly echo awk cd 'quoted text' --verbose
+	echo then /usr/bin 2>/dev/null
+cd 'quoted text' x=1 x=1 -eu x=1 'quoted text'
+		export grep 'quoted text'
+		| /usr/bin 2>/dev/null "$1" sed && | | "$1" "$@" grep "$@" ${HOME}
+		readonly awk -eu cd ${HOME} cd echo -eu test "$@" local then
+	echo "$@" cd /usr/bin x=1 echo ${HOME} printf sed $(pwd) local $(pwd) "$1" -eu
+	$(pwd) awk ${HOME} && -eu $(pwd) "$@" --verbose
+$(pwd) local grep "$1" x=1 printf && echo | -eu && 2>/dev/null grep done readonly
+		awk && 2>/dev/null | echo sed 2>/dev/null /usr/bin awk x=1 /usr/bin
+		${HOME} && && "$1" test export
+local ${HOME} test echo echo 'quoted text' test sed awk ${HOME}
+	grep -eu "$1" ${HOME} sed -eu $(pwd) "$@" readonly
+	export --verbose export export -eu cd && cd then && then 2>/dev/null
+	-eu x=1 --verbose --verbose test export | /usr/bin x=1 ${HOME} "$1" | | -eu grep
+	2>/dev/null export local -eu 'quoted text' 'quoted text' ${HOME}
+	-eu --verbose x=1 awk | | done grep && readonly x=1 "$@"
+	done cd /usr/bin -eu 2>/dev/null
+2>/dev/null 'quoted text' -eu
+"$1" done | export --verbose 2>/dev/null readonly export "$@" "$@" 'quoted text'
+		done x=1 'quoted text'
+	printf echo local grep 2>/dev/null x=1
+	-eu x=1 done && $(pwd) /usr/bin grep export export then "$1"
+	| && readonly printf
+awk export test local /usr/bin local "$@" then
+	&& $(pwd) 2>/dev/null --verbose cd x=1 printf --verbose cd test -eu -eu echo
+	/usr/bin then local export cd "$1" x=1 awk
+$(pwd) readonly $(pwd) awk 2>/dev/null
+		then ${HOME} cd awk local 2>/dev/null
+	then 'quoted text' readonly printf then -eu --verbose x=1 echo 2>/dev/null
+"$1" sed && "$1" printf -eu ${HOME} 2>/dev/null echo printf export export
+	export readonly readonly --verbose --verbose test printf "$1" cd && --verbose
+		done export local x=1 grep "$1" sed local 'quoted text'
+		"$1" cd cd 2>/dev/null 'quoted text' cd cd sed 2>/dev/null export
+	test readonly /usr/bin -eu test then "$@" done "$@" cd done printf
+	-eu && printf "$1" -eu local readonly && 'quoted text'
+--verbose "$@" then then readonly done readonly --verbose x=1
+		then awk done 'quoted text' "$1"
+		x=1 "$1" 2>/dev/null x=1 readonly x=1
+done 'quoted text' awk --verbose done && "$1" -eu awk local sed then 2>/dev/null
+	test local then sed $(pwd) "$1" 'quoted text' then cd grep sed export test
+	then $(pwd) 2>/dev/null export done "$@" then | --verbose test readonly "$1"
+	sed && /usr/bin test -eu "$1" 2>/dev/null "$1" 2>/dev/null 'quoted text'
+		local ${HOME} 2>/dev/null x=1
+	x=1 then && export 'quoted text' 2>/dev/null x=1 --verbose then
+local echo "$@" ${HOME} export readonly 2>/dev/null -eu local --verbose
+| 2>/dev/null printf /usr/bin 'quoted text' grep --verbose $(pwd) echo 2>/dev/null
+		done cd 2>/dev/null --verbose --verbose readonly "$@" done 'quoted text' | &&
+	2>/dev/null "$1" awk printf "$@" "$1" export
+		printf printf "$@" | test x=1 'quoted text' sed
+		$(pwd) then x=1 grep 2>/dev/null
+		/usr/bin | readonly "$@" -eu echo $(pwd) export "$1" 'quoted text'
+		2>/dev/null test "$1" -eu
+test done sed ${HOME} then printf
+"$@" 'quoted text' echo
+	2>/dev/null echo 2>/dev/null sed 'quoted text' readonly
+		"$@" "$1" printf test $(pwd) /usr/bin ${HOME} ${HOME} && test
+&& | 2>/dev/null /usr/bin readonly test | "$@" "$1" export sed local ${HOME}
+echo export $(pwd) /usr/bin /usr/bin x=1 export echo /usr/bin
+	/usr/bin && printf local 'quoted text' && 'quoted text'
+cd done $(pwd) --verbose x=1 && "$@"
+"$1" | "$1" 2>/dev/null --verbose test $(pwd) cd $(pwd) | "$1" readonly
+		$(pwd) local --verbose && 2>/dev/null
+		x=1 echo local -eu grep x=1 --verbose 'quoted text'
+echo awk ${HOME} "$@" | awk ${HOME}
+		cd echo | printf then x=1 test ${HOME}
+		-eu test readonly && echo test -eu x=1 printf printf
+		sed grep -eu done printf export printf cd cd echo --verbose x=1 export
+		"$@" "$1" "$1" export --verbose
+		test test x=1 awk $(pwd) awk 'quoted text' "$@" ${HOME} && done 2>/dev/null
+	x=1 cd --verbose x=1 then export && $(pwd) x=1 sed | printf
+sed ${HOME} readonly printf
+		&& sed | test 'quoted text' export $(pwd) && printf
+	'quoted text' --verbose readonly --verbose
+		sed --verbose printf | local && 'quoted text'
+	then /usr/bin && -eu ${HOME} grep "$@" "$1" grep && grep
+		-eu 'quoted text' readonly test $(pwd) test --verbose
+	${HOME} && ${HOME} "$@" -eu "$1" $(pwd) done sed "$1" echo "$1"
+x=1 x=1 local done && ${HOME} sed
+	x=1 ${HOME} then done /usr/bin && grep /usr/bin test 'quoted text'
+	grep "$1" ${HOME} /usr/bin $(pwd) sed $(pwd) x=1 echo export awk /usr/bin
+	grep x=1 "$1" done 'quoted text' | 'quoted text' 'quoted text' "$@" awk |
+		2>/dev/null $(pwd) 2>/dev/null
+	"$1" sed --verbose cd local ${HOME} --verbose 2>/dev/null then 'quoted text' 'quoted text'
+/usr/bin --verbose cd awk readonly sed "$1" awk awk export 'quoted text'
+		echo $(pwd) grep 'quoted text' printf && test cd local
+	local /usr/bin echo readonly awk --verbose --verbose 2>/dev/null test done
+${HOME} cd cd awk test --verbose "$@" export export test done cd
+	${HOME} -eu -eu && sed ${HOME} local "$1" 2>/dev/null
+"$@" && $(pwd) $(pwd) readonly echo grep
+	2>/dev/null test readonly echo
+grep cd readonly "$1" test grep x=1
+/usr/bin x=1 'quoted text' echo
+	| sed echo grep $(pwd) export
+"$@" 'quoted text' ${HOME} $(pwd) export readonly
+		$(pwd) "$@" $(pwd) /usr/bin && "$1" && $(pwd) awk
+	export then -eu done x=1 done sed cd local
+	"$1" awk test x=1 test /usr/bin
+| cd cd "$1" sed awk grep then readonly x=1 "$@" cd "$1" printf sed | then
+	${HOME} 2>/dev/null cd test readonly 2>/dev/null echo ${HOME}
+	-eu /usr/bin local local done -eu cd -eu then | ${HOME} && cd test export grep
+	"$1" test 'quoted text' "$@" x=1 "$1" readonly
+$(pwd) -eu grep && "$@" test | 'quoted text' readonly x=1 cd && x=1
+		then sed sed | cd export local local export 2>/dev/null test readonly /usr/bin
+	"$@" grep echo ${HOME} cd done -eu "$1"
+	echo $(pwd) grep awk "$1" printf "$1"
+	&& readonly echo /usr/bin
+	${HOME} echo -eu ${HOME} then
+		printf sed "$@" cd /usr/bin echo 'quoted text' | sed | "$@" | awk sed sed then
+		echo echo -eu $(pwd) "$@" | /usr/bin grep grep printf export &&
+	/usr/bin /usr/bin cd cd "$1" printf printf
+		&& awk ${HOME} sed 'quoted text' "$@"
+		export --verbose --verbose done
+		readonly | test export
+	export export export done grep -eu export x=1 "$@" local 2>/dev/null
+'quoted text' | then printf | awk $(pwd) 'quoted text' awk
+printf printf "$@" $(pwd) && awk grep
+	done ${HOME} -eu export then readonly ${HOME}
+cd x=1 local local 2>/dev/null --verbose
+	"$@" 2>/dev/null $(pwd) "$1" -eu x=1 local $(pwd)
+	$(pwd) ${HOME} grep -eu done | $(pwd)
+	"$1" ${HOME} --verbose $(pwd) done readonly "$@" done
+	export | --verbose 'quoted text'
+		/usr/bin /usr/bin | export /usr/bin cd readonly 'quoted text'
+then export --verbose cd
+	--verbose readonly ${HOME} "$1" grep done grep readonly
+		$(pwd) "$1" --verbose | echo x=1 then export awk ${HOME} $(pwd) test -eu cd
+echo "$1" "$1" readonly readonly ${HOME}
+		2>/dev/null grep 2>/dev/null 'quoted text' export
+		--verbose 2>/dev/null ${HOME} x=1 && "$1" "$1" echo --verbose echo
+| x=1 printf x=1 x=1 /usr/bin awk echo | -eu -eu "$@" | 'quoted text'
+	grep echo $(pwd) "$1" readonly
+"$@" 2>/dev/null -eu 2>/dev/null then 'quoted text' done cd $(pwd)
+		cd --verbose $(pwd) echo
+	$(pwd) done grep && echo cd $(pwd)
+	"$@" 'quoted text' then printf "$@" && printf ${HOME} --verbose
+		"$@" printf cd then | grep $(pwd) 'quoted text'
+readonly cd export sed awk sed | "$1" --verbose local cd export readonly /usr/bin
+test readonly cd | awk then -eu --verbose
+	/usr/bin echo grep --verbose then $(pwd)
+		printf test 2>/dev/null printf x=1 2>/dev/null && ${HOME} | $(pwd)
+	test x=1 2>/dev/null /usr/bin $(pwd) "$@" sed cd readonly
+/usr/bin 'quoted text' x=1 printf test awk -eu | awk printf $(pwd) test cd test
+		"$1" then 2>/dev/null echo "$@"
+	grep "$@" test x=1 grep awk --verbose awk
+'quoted text' echo ${HOME} /usr/bin 2>/dev/null
+	--verbose local done then export export readonly --verbose awk "$@" /usr/bin
+	printf test sed 'quoted text' ${HOME} printf --verbose grep done -eu | cd printf
+		export /usr/bin -eu && $(pwd) readonly x=1 $(pwd)
+	--verbose /usr/bin grep 'quoted text' done "$1" "$1"
+		| cd readonly | x=1 &&
+grep --verbose readonly then --verbose grep cd export printf 'quoted text' local
+	"$1" printf cd sed export --verbose then /usr/bin
+		-eu 2>/dev/null test $(pwd) x=1 readonly "$@" export grep readonly export $(pwd)
+	"$1" echo local && echo echo grep ${HOME} | then awk echo ${HOME}
+		local local "$1" $(pwd) printf
+	"$@" -eu "$1" readonly --verbose && readonly
+		echo "$@" -eu export local then echo done test && --verbose readonly | then
+local && --verbose awk then --verbose test sed "$@" | 'quoted text' /usr/bin x=1
+printf 'quoted text' 'quoted text'
+	awk done 2>/dev/null printf cd ${HOME} echo grep && /usr/bin
+		awk x=1 "$1" cd printf --verbose awk
+		2>/dev/null test x=1 awk export /usr/bin local
+awk 'quoted text' -eu 2>/dev/null x=1 readonly --verbose
+grep --verbose 2>/dev/null $(pwd) "$@" $(pwd) /usr/bin | awk "$1" && export
+test /usr/bin x=1 sed test ${HOME}
+"$@" ${HOME} printf "$@" cd printf echo grep ${HOME} then export
+		2>/dev/null readonly "$@" | 2>/dev/null printf /usr/bin printf cd /usr/bin
+grep --verbose --verbose 'quoted text' /usr/bin then export 2>/dev/null
+	awk "$1" 'quoted text' x=1 then && then local $(pwd) done && | --verbose
+		echo test "$1" readonly export ${HOME} | grep |
+		"$1" done && test awk --verbose -eu awk x=1
+		${HOME} test export export /usr/bin done x=1 2>/dev/null | printf 'quoted text'
+	"$@" 'quoted text' then cd ${HOME} export echo | test awk sed
+&& "$@" x=1 export /usr/bin /usr/bin 'quoted text'
+done done $(pwd) && x=1 2>/dev/null | $(pwd) && /usr/bin printf awk export
+		--verbose local awk printf
+test x=1 -eu $(pwd) -eu test then sed /usr/bin awk $(pwd) && --verbose x=1 "$@"
+${HOME} ${HOME} ${HOME} && readonly | x=1 /usr/bin local
+$(pwd) --verbose ${HOME} 'quoted text' | printf
+		"$1" $(pwd) && 2>/dev/null cd test | then | 2>/dev/null export
+/usr/bin /usr/bin /usr/bin "$@" sed echo ${HOME} sed 'quoted text' -eu
+		${HOME} "$@" ${HOME} ${HOME} | sed "$@"
+"$@" ${HOME} printf readonly cd x=1 readonly then awk /usr/bin sed
+--verbose ${HOME} 'quoted text' /usr/bin
+		/usr/bin printf 2>/dev/null
+${HOME} cd done "$@" cd 2>/dev/null sed
+	awk done echo cd done "$@" && sed ${HOME} 2>/dev/null -eu x=1 test x=1 grep
+		local readonly 2>/dev/null export echo
+	${HOME} test test "$1" grep then
+		${HOME} /usr/bin local sed
+"$@" x=1 cd ${HOME} && awk | ${HOME} echo --verbose
+		| sed "$@" x=1 sed local && x=1 sed x=1
+| 'quoted text' /usr/bin $(pwd) ${HOME} echo printf | 2>/dev/null readonly
+grep 'quoted text' | local awk 'quoted text' /usr/bin 'quoted text'
+test done awk awk /usr/bin x=1 -eu ${HOME} 2>/dev/null grep ${HOME} "$1" 2>/dev/null
+| printf 'quoted text' 'quoted text' sed /usr/bin "$@" $(pwd) x=1 grep --verbose
+echo printf readonly && readonly printf local then $(pwd) export printf grep
+	cd ${HOME} test --verbose /usr/bin export
+	echo /usr/bin -eu readonly x=1 /usr/bin printf | 2>/dev/null
+--verbose --verbose readonly --verbose 2>/dev/null && then done sed | x=1
+	sed test echo x=1 -eu test "$1" ${HOME} grep then printf "$@" then $(pwd) 'quoted text'
+		/usr/bin done ${HOME} cd echo sed awk awk export readonly
+		${HOME} test | echo sed /usr/bin grep --verbose
+	"$1" echo x=1 'quoted text' 'quoted text' printf done test done ${HOME}
+	2>/dev/null grep echo echo cd sed -eu printf test $(pwd) |
+	then --verbose $(pwd) readonly
+		readonly readonly "$1" "$@" awk cd "$1" readonly echo echo done local 'quoted text'
+		sed x=1 "$@" echo x=1 sed grep test -eu "$@" ${HOME}
+grep sed ${HOME} 2>/dev/null cd && -eu printf "$@"
+printf x=1 ${HOME} local then awk test cd grep "$1" 'quoted text'
+export cd grep export readonly cd export then
+		done awk x=1 grep "$@" sed done x=1 /usr/bin test $(pwd) echo export "$1"
+	"$1" then awk grep sed
+sed "$@" sed "$@" && --verbose ${HOME}
+'quoted text' then local "$@" $(pwd) then sed local
+		printf sed "$1" ${HOME} "$1" awk grep readonly -eu echo 2>/dev/null
+		grep readonly awk 'quoted text' done echo 'quoted text' 2>/dev/null printf done
+	local --verbose awk sed then local cd export local cd echo awk
+test local $(pwd) grep | sed cd x=1 then test local && printf ${HOME} sed export
+		&& "$@" export echo | 'quoted text' done | "$@" export printf
+		local readonly local && export then "$1" -eu 2>/dev/null
+		printf local --verbose | done "$@" 2>/dev/null ${HOME}
+	cd sed ${HOME} x=1 echo x=1 printf local ${HOME} --verbose
+	grep | awk && "$1" "$@"
+'quoted text' cd grep export | --verbose -eu --verbose export
+	grep "$@" "$1" "$1" "$@" sed -eu 'quoted text' x=1 awk --verbose
+		$(pwd) --verbose && ${HOME} | $(pwd) "$@"
+	grep cd ${HOME} | && /usr/bin test
+	grep 2>/dev/null local ${HOME} "$@" $(pwd) && $(pwd) export "$@" ${HOME} ${HOME}
+--verbose --verbose x=1 cd
+$(pwd) sed test 'quoted text' -eu "$1"
+grep sed $(pwd) 'quoted text' 2>/dev/null readonly
+printf sed x=1 --verbose readonly -eu local x=1 sed x=1
+		2>/dev/null "$@" $(pwd) done sed export ${HOME}
+		printf cd --verbose 'quoted text' export /usr/bin --verbose done local 'quoted text'
+--verbose cd done $(pwd) done
+done sed sed /usr/bin echo done "$1" 'quoted text' &&
+then awk $(pwd) && awk 2>/dev/null | --verbose export $(pwd) done
+		x=1 then && sed then x=1 --verbose local
+	${HOME} | export "$@" "$@" | grep | 2>/dev/null -eu readonly && test --verbose
+		echo ${HOME} ${HOME} echo ${HOME} ${HOME} then test "$1" echo $(pwd) echo "$@"
+	cd cd "$1" cd 2>/dev/null
+	export && $(pwd) | cd x=1 done "$1" /usr/bin echo
+	--verbose then grep x=1 ${HOME}
+	export local export echo | done 'quoted text' -eu export ${HOME} 2>/dev/null |
+	sed printf sed then test x=1 'quoted text'
+	sed --verbose && x=1 printf export
+	done printf "$1" && cd "$1"
+	'quoted text' grep printf grep readonly
+local sed echo grep $(pwd) "$@" x=1 then
+sed echo $(pwd) | local done x=1 readonly $(pwd) readonly
+	then && --verbose && printf | $(pwd) | grep local printf test x=1
+"$@" awk "$1" && 'quoted text' "$@" | then sed x=1 2>/dev/null
+	grep grep $(pwd) -eu printf ${HOME} awk then "$@" "$1"
+then "$@" printf --verbose export | x=1 | printf x=1 export 2>/dev/null
+		&& local /usr/bin grep -eu done cd 'quoted text' -eu
+		export 'quoted text' readonly awk 'quoted text' x=1 sed export local
+	grep $(pwd) -eu 'quoted text'
+		awk printf grep "$1" $(pwd) cd x=1 "$1" $(pwd)
+	${HOME} local printf export
+		"$1" readonly ${HOME} &&
+	${HOME} printf --verbose done ${HOME}
+echo 2>/dev/null ${HOME} 'quoted text'
+		local -eu sed then echo sed /usr/bin grep -eu "$@" echo printf x=1
+	${HOME} then grep echo echo x=1 then /usr/bin 'quoted text' echo awk | echo
+/usr/bin /usr/bin "$1" ${HOME}
+		"$@" printf --verbose awk | awk $(pwd)
+'quoted text' awk awk
+		printf /usr/bin "$@" "$@" && local "$@" printf
+"$1" /usr/bin printf x=1 echo cd && grep 2>/dev/null x=1 then -eu echo
+		| cd test /usr/bin 2>/dev/null readonly 'quoted text'
+local done -eu awk echo --verbose test "$@" --verbose "$@" ${HOME}
+		${HOME} 'quoted text' printf export 2>/dev/null
+		2>/dev/null | echo "$@" --verbose done readonly
+	'quoted text' --verbose echo 2>/dev/null sed "$@" --verbose -eu
+		done --verbose ${HOME} then /usr/bin test echo sed "$@" --verbose sed grep
+x=1 "$1" $(pwd) ${HOME} awk printf /usr/bin readonly 'quoted text'
+then printf $(pwd) --verbose
+	2>/dev/null "$1" 'quoted text'
+$(pwd) test test grep -eu "$@" "$1" -eu
+2>/dev/null x=1 printf
+		sed awk printf awk export "$1" $(pwd) x=1 -eu grep x=1 'quoted text'
+echo done done test | --verbose && "$1" -eu /usr/bin test then
+		$(pwd) 2>/dev/null echo
+		| export "$@" --verbose grep $(pwd) x=1 local ${HOME} "$1" "$@" ${HOME} --verbose
+-eu --verbose then /usr/bin -eu x=1 && -eu done echo
+export $(pwd) "$1" cd readonly
+	/usr/bin cd awk 'quoted text'
+${HOME} export export $(pwd)
+	"$@" --verbose "$1" awk
+		export | | ${HOME} ${HOME} sed --verbose readonly echo 2>/dev/null -eu
+x=1 local then sed then cd then 'quoted text'
+		$(pwd) local then export
+&& /usr/bin x=1 --verbose $(pwd) 2>/dev/null /usr/bin done
+| awk grep export -eu $(pwd) && "$1" -eu sed cd sed
+${HOME} sed ${HOME} --verbose done /usr/bin | echo test awk /usr/bin
+	test 'quoted text' x=1 "$@" && grep local sed x=1 local
+	&& awk x=1 x=1 sed done 'quoted text'
+	readonly x=1 done awk cd test printf local ${HOME} /usr/bin sed
+/usr/bin && ${HOME} 2>/dev/null done export
+then test | && grep x=1 -eu readonly --verbose sed
+		-eu done | -eu sed awk "$1"
+&& ${HOME} --verbose "$1" && && -eu echo
+-eu ${HOME} | done cd $(pwd) $(pwd) --verbose $(pwd) 2>/dev/null
+printf grep /usr/bin 2>/dev/null sed then
+	"$1" awk -eu "$1" 2>/dev/null
+		then test 2>/dev/null local
+		readonly test awk then -eu echo 2>/dev/null
+	2>/dev/null && awk echo --verbose then && $(pwd) cd $(pwd)
+"$@" /usr/bin test 'quoted text' | local grep
+		grep x=1 local then then printf 2>/dev/null
+x=1 "$1" awk readonly $(pwd) ${HOME} "$@" then readonly
+		grep 2>/dev/null awk then local "$1"
+		then awk sed 2>/dev/null | "$1" then x=1 /usr/bin --verbose -eu
+	${HOME} awk sed && "$@" "$1" | cd "$1" printf export $(pwd) echo
+"$@" x=1 $(pwd) /usr/bin local sed done sed sed export test then
+		"$@" test --verbose 2>/dev/null x=1 awk grep "$@" 2>/dev/null
+	"$@" readonly done test | then "$@" 2>/dev/null
+		| $(pwd) ${HOME} | readonly readonly sed printf x=1 printf cd ${HOME} x=1 test
+	cd 2>/dev/null 2>/dev/null x=1 then cd echo
+export then 2>/dev/null sed done echo test printf | echo x=1 cd
+	sed done "$1" | awk | local awk
+grep awk "$@" then x=1 done && | done && sed 'quoted text'
+echo done cd x=1 awk 'quoted text'
+		sed "$@" printf export cd /usr/bin $(pwd) printf x=1
+	sed | ${HOME} 'quoted text' "$1" "$@"
+		local | done cd printf local ${HOME} --verbose
+	export done then grep sed ${HOME} x=1 printf
+	-eu grep done awk local readonly done
+	test "$@" sed awk 'quoted text' "$@" readonly printf 'quoted text'
+readonly /usr/bin -eu /usr/bin readonly /usr/bin then printf echo awk
+x=1 done done readonly then 'quoted text'
+		| 'quoted text' $(pwd) 'quoted text' printf test printf test cd
+		cd ${HOME} ${HOME} 2>/dev/null
+	export done export sed /usr/bin $(pwd)
+	/usr/bin -eu grep done "$@" export awk $(pwd)
+	local sed "$1" -eu echo then --verbose | 2>/dev/null
+		cd grep ${HOME} then "$@" -eu readonly
+export echo --verbose /usr/bin then
+$(pwd) cd 'quoted text' $(pwd) 2>/dev/null
+	printf local echo -eu 'quoted text' | "$@" --verbose &&
+	-eu cd 2>/dev/null $(pwd)
+		readonly readonly --verbose readonly test -eu grep /usr/bin sed readonly
+	"$1" awk readonly cd --verbose 'quoted text' test local 2>/dev/null |
+		cd awk "$1" local local
+	-eu && 'quoted text' --verbose awk --verbose "$1" local
+		cd -eu test 'quoted text' test 2>/dev/null local
+"$1" -eu -eu grep done /usr/bin /usr/bin &&
+"$1" test 'quoted text' x=1 done then
+printf then $(pwd) /usr/bin then /usr/bin /usr/bin done "$@" "$@"
+local && awk export sed echo "$@" printf readonly ${HOME} 2>/dev/null
+x=1 "$@" printf printf test done "$1" done --verbose printf cd cd done
+	'quoted text' "$@" sed "$1" sed && export test
+export x=1 2>/dev/null sed export then | && "$@" x=1 cd test echo
+		"$@" awk $(pwd) awk printf "$1" awk "$1" printf test 2>/dev/null | done readonly
+x=1 local sed grep local cd "$1" echo $(pwd) 2>/dev/null export
+	--verbose "$1" export ${HOME}
+"$@" $(pwd) test readonly $(pwd) readonly then ${HOME} x=1 -eu
+		then done --verbose | local test 2>/dev/null x=1 "$@" awk printf
+		local $(pwd) /usr/bin printf
+	"$@" export && ${HOME} grep done x=1 $(pwd) local readonly
+	grep "$@" | ${HOME} test cd done 'quoted text'
+		${HOME} && awk --verbose printf printf sed printf echo
+	readonly cd done && local then readonly test sed
+cd sed awk readonly done local test --verbose -eu "$1"
+	grep | 'quoted text' local sed x=1 $(pwd) $(pwd) cd 'quoted text' &&
+		$(pwd) test export then ${HOME} done "$@" done x=1 cd sed
+${HOME} done test "$1" done readonly export ${HOME} cd 2>/dev/null "$1"
+	&& grep /usr/bin readonly sed sed | readonly
+done ${HOME} grep --verbose ${HOME} 'quoted text' ${HOME} && local $(pwd)
+		--verbose printf x=1 | /usr/bin echo 'quoted text' local then "$@" -eu
+	'quoted text' "$1" -eu 2>/dev/null /usr/bin "$1" test --verbose ${HOME} sed
+local $(pwd) readonly "$@" x=1 'quoted text' then export export readonly
+	'quoted text' x=1 -eu x=1 "$@" local done done -eu --verbose 2>/dev/null ${HOME}
+"$1" then 'quoted text' test | cd then 2>/dev/null
+		grep 'quoted text' cd x=1 x=1 cd
+	printf x=1 grep --verbose x=1 echo 2>/dev/null --verbose
+readonly --verbose awk /usr/bin then
+		x=1 x=1 /usr/bin "$1" done x=1 "$1" "$1" done | echo then
+--verbose then export && awk grep | echo grep cd "$1"
+	awk test -eu $(pwd) "$1" grep $(pwd) "$@" ${HOME} 'quoted text'
+	x=1 export then printf "$1" cd cd --verbose
+		--verbose ${HOME} "$@" cd grep awk | echo test && then echo $(pwd) -eu $(pwd)
+grep printf -eu 'quoted text' awk -eu done awk --verbose readonly
+	grep ${HOME} grep "$@" awk
+		x=1 sed printf awk then cd cd 2>/dev/null printf cd | awk printf cd readonly
+printf ${HOME} local export ${HOME} local "$1" then /usr/bin ${HOME} awk grep
+		printf grep awk done done local echo "$@" | "$1" x=1 "$@" then | sed
+	"$1" then | --verbose -eu /usr/bin -eu "$@" /usr/bin sed
+		&& sed "$1" | printf sed x=1 -eu test awk echo | printf
+		local x=1 | then "$1" printf ${HOME} ${HOME} ${HOME} grep awk done 'quoted text'
+echo readonly then printf awk && echo 'quoted text'
+		printf local cd --verbose local done export readonly && x=1 2>/dev/null
+'quoted text' local cd -eu export sed cd ${HOME} readonly
+		cd "$@" && echo grep /usr/bin export
+		"$@" $(pwd) 2>/dev/null /usr/bin x=1 /usr/bin readonly
+		x=1 "$@" 2>/dev/null echo done "$@" -eu
+		${HOME} --verbose printf $(pwd) echo done 'quoted text'
+local cd && done /usr/bin grep ${HOME} /usr/bin
+		/usr/bin -eu --verbose awk "$@" awk 2>/dev/null local
+awk local done $(pwd) readonly printf
+cd 'quoted text' export grep $(pwd) then sed 'quoted text'
+| awk "$1" -eu | done 'quoted text' local && sed
+		local && ${HOME} readonly 'quoted text' echo /usr/bin
+		test "$1" "$1" then | done echo sed 2>/dev/null "$@" "$1" "$1"
+	--verbose done sed local -eu | grep --verbose
+		-eu x=1 --verbose $(pwd) /usr/bin
+	printf awk -eu cd 'quoted text' ${HOME} "$@" echo readonly
+awk x=1 x=1 done export awk test 'quoted text' --verbose
+	"$@" done done local export ${HOME} /usr/bin done ${HOME} awk ${HOME} echo
+	x=1 done grep | -eu x=1 x=1 "$1" awk /usr/bin awk
+		sed grep done test 2>/dev/null echo printf "$@"
+	sed $(pwd) "$1" printf $(pwd) | awk 2>/dev/null /usr/bin
+sed | cd | $(pwd) 2>/dev/null && ${HOME} export awk
+-eu /usr/bin "$1" awk 2>/dev/null -eu sed printf 2>/dev/null 'quoted text'
+"$1" awk readonly printf "$@" x=1 done
+		"$1" awk "$@" export done /usr/bin 'quoted text'
+then ${HOME} printf x=1 -eu done then | | --verbose "$1" then echo -eu printf echo
+| grep cd echo readonly | grep cd done
+		done $(pwd) && "$@" done "$1" $(pwd) then grep sed
+cd cd echo /usr/bin 'quoted text'
+	grep printf done | "$@" 2>/dev/null 2>/dev/null then | --verbose && /usr/bin test
+	${HOME} sed test then "$@" test readonly
+	x=1 echo ${HOME} $(pwd) && test then 2>/dev/null -eu cd 'quoted text' grep 'quoted text'
+	2>/dev/null /usr/bin then 'quoted text' "$@"
+	printf 'quoted text' 'quoted text' grep echo readonly done test test export
+		&& then | awk "$1" 2>/dev/null
+	awk 2>/dev/null "$1" then printf && local
+		"$@" readonly local --verbose sed 'quoted text' 'quoted text' readonly done printf
+--verbose test ${HOME} sed cd --verbose export awk 'quoted text'
+local "$1" test test done cd && echo "$1" -eu grep --verbose x=1 -eu "$1" awk local
+export printf awk | /usr/bin readonly
+		export grep grep "$@" --verbose awk awk --verbose --verbose
+		2>/dev/null printf cd then test cd then grep ${HOME}
+test "$1" | 2>/dev/null "$@" done cd && grep /usr/bin grep && 2>/dev/null
+"$1" cd 'quoted text' readonly sed echo && then | readonly x=1 'quoted text'
+		'quoted text' && printf then printf echo --verbose "$@" export
+cd "$1" local /usr/bin && ${HOME} -eu
+	awk "$1" local echo grep $(pwd) awk local -eu "$@" test printf local && && sed then
+done --verbose cd sed && --verbose "$@" test
+	$(pwd) "$1" readonly sed ${HOME} ${HOME} $(pwd) | sed printf 'quoted text' $(pwd)
+awk awk printf cd && $(pwd) test awk done | echo x=1 $(pwd)
+		then && "$1" 2>/dev/null $(pwd) printf -eu x=1 --verbose
+sed done /usr/bin sed done test x=1 | && && --verbose
+	printf x=1 'quoted text' readonly awk --verbose | | "$1" 2>/dev/null | &&
+	/usr/bin sed grep grep $(pwd) then x=1 ${HOME} then /usr/bin && readonly
+	&& 'quoted text' $(pwd) grep then
+		cd ${HOME} x=1 2>/dev/null 'quoted text' then export ${HOME} "$1"
+		x=1 "$1" sed local "$1"
+		test readonly -eu test echo --verbose done "$@" grep sed "$1"
+		'quoted text' x=1 echo export sed
+	printf printf && awk $(pwd)
+		sed --verbose -eu "$@"
+		export x=1 cd then /usr/bin "$1" grep export "$1" export
+	x=1 | done readonly awk "$@" 'quoted text'
+		grep "$@" | awk grep echo readonly 'quoted text' readonly printf
+cd done x=1 then 'quoted text' $(pwd) /usr/bin
+sed export && && sed x=1 grep
+	printf -eu readonly grep -eu 'quoted text' then awk -eu export
+	-eu | && "$1" && "$1" sed 'quoted text' 2>/dev/null 2>/dev/null 2>/dev/null
+'quoted text' done x=1 sed | awk then
+	${HOME} export "$1" -eu 2>/dev/null
+"$1" awk && export export $(pwd)
+"$1" cd echo grep then 2>/dev/null && local export /usr/bin local 'quoted text'
+-eu | /usr/bin 'quoted text' done
+		x=1 "$@" done $(pwd) /usr/bin done
+	then --verbose ${HOME} local "$@" done 'quoted text' readonly ${HOME} /usr/bin
+--verbose done then | 2>/dev/null
+		2>/dev/null "$@" 2>/dev/null then local sed
+printf export /usr/bin then $(pwd) 'quoted text' grep local
+		-eu sed && readonly test "$1" local done ${HOME} test --verbose
+grep "$1" | "$@" local x=1 sed 'quoted text' export echo done /usr/bin local
+	&& /usr/bin "$@" then && echo --verbose echo
+local awk ${HOME} $(pwd) then awk cd local x=1 grep |
+		local -eu then test ${HOME} -eu --verbose cd echo && readonly
+test cd -eu cd local cd readonly sed done
+/usr/bin local awk cd ${HOME} /usr/bin test grep
+cd export "$@" && export
+		cd local x=1 test echo -eu local
+		printf awk sed cd sed "$1" sed echo test
+	--verbose readonly sed ${HOME} then 'quoted text' echo | cd |
+2>/dev/null done 'quoted text' 2>/dev/null --verbose grep
+x=1 x=1 "$@" 'quoted text' "$1" && sed --verbose done | 'quoted text'
+		grep printf export echo | test printf
+	x=1 2>/dev/null printf | --verbose | ${HOME} awk export cd x=1 grep 2>/dev/null
+		grep printf awk "$@" printf done 'quoted text' sed 2>/dev/null test test
+	local readonly "$@" $(pwd) && echo cd cd
+"$@" x=1 "$@" echo 'quoted text' 2>/dev/null local cd
+	readonly cd 'quoted text' "$@" local echo "$1" /usr/bin local /usr/bin
+awk awk cd printf test sed done then "$1" then
+x=1 | export -eu -eu sed "$1" done local 'quoted text' 2>/dev/null sed
+		echo export cd 'quoted text' 2>/dev/null | awk export -eu && cd -eu | grep
+		grep then 'quoted text' && done /usr/bin "$1" 2>/dev/null
+		${HOME} local done --verbose ${HOME} $(pwd) --verbose
+		"$@" ${HOME} printf echo
+		awk printf $(pwd) readonly grep -eu grep local 'quoted text'
+"$1" /usr/bin ${HOME} "$1" sed "$@" test readonly "$1" grep awk x=1 echo
+'quoted text' /usr/bin printf
+cd awk then done $(pwd) sed then "$1" "$1" awk then --verbose printf
+	--verbose 'quoted text' && readonly --verbose awk readonly local test then
+	--verbose done readonly --verbose test && printf cd cd --verbose 'quoted text'
+	echo | ${HOME} && grep --verbose 'quoted text' "$1" printf
+-eu readonly printf 'quoted text' export
+	printf && "$@" test then x=1 'quoted text' -eu $(pwd)
+	awk printf && --verbose /usr/bin && local
+	echo test then grep done --verbose grep awk /usr/bin
+	&& sed -eu cd then readonly $(pwd)
+-eu sed /usr/bin "$@" cd ${HOME} $(pwd) local --verbose -eu then sed
+	echo then then grep awk readonly
+		local /usr/bin "$@" --verbose grep readonly readonly 'quoted text'
+		export 2>/dev/null export local --verbose --verbose test cd "$@"
+	$(pwd) awk "$@" grep local cd sed sed then then done awk test test 2>/dev/null
+	--verbose cd --verbose cd
+${HOME} grep 'quoted text' printf ${HOME} --verbose
+"$1" then $(pwd) ${HOME} "$1"
+	cd /usr/bin local | "$@" /usr/bin done awk x=1 x=1 ${HOME} export "$@" --verbose
+/usr/bin /usr/bin 'quoted text' awk printf x=1 x=1 'quoted text' readonly
+cd --verbose local -eu printf echo ${HOME}
+		done && x=1 test export readonly awk $(pwd) --verbose printf grep $(pwd)
+		${HOME} sed export $(pwd) echo sed cd $(pwd) echo then 2>/dev/null x=1 local
+	printf "$1" $(pwd) "$@" cd ${HOME} printf sed printf "$@" printf sed sed
+		| 'quoted text' test $(pwd) awk "$1" printf 'quoted text' --verbose ${HOME} test
+	then done ${HOME} "$1" -eu && ${HOME} test && then test "$@" then 'quoted text'
+x=1 done then grep readonly x=1 --verbose /usr/bin then then "$@" -eu export
+	${HOME} readonly ${HOME}
+	$(pwd) /usr/bin 'quoted text' local
+		export then cd printf "$@" -eu /usr/bin $(pwd) 'quoted text' $(pwd)
+	'quoted text' $(pwd) test readonly sed $(pwd)
+export test && done "$1"
+	--verbose /usr/bin "$1" /usr/bin
+		done printf -eu then test local /usr/bin cd sed printf 2>/dev/null cd echo 2>/dev/null
+	/usr/bin awk -eu | local printf local x=1
+		$(pwd) cd readonly | x=1 cd then sed | "$@" | grep /usr/bin
+	echo && ${HOME} $(pwd) grep "$1" local done ${HOME} test
+| | 2>/dev/null 2>/dev/null
+	'quoted text' && grep "$1" test echo readonly
+		--verbose x=1 $(pwd) x=1 printf cd echo cd "$1" echo $(pwd) grep printf printf test
+		sed local $(pwd) "$1" && x=1 /usr/bin sed
+		$(pwd) sed grep && "$1" grep $(pwd)
+		printf printf local && x=1 | && "$1" sed "$1" local echo && local --verbose
+		'quoted text' 'quoted text' 'quoted text' && "$1"
+		"$1" /usr/bin x=1 ${HOME} sed printf grep test --verbose
+		sed done then x=1 x=1 local
+	2>/dev/null --verbose 2>/dev/null awk
+--verbose --verbose export
+		readonly then sed && local done ${HOME} done sed 2>/dev/null
+		${HOME} done /usr/bin printf then done /usr/bin
+	/usr/bin printf --verbose echo $(pwd) local echo readonly sed $(pwd) done test
+	-eu awk readonly export done sed echo --verbose then then printf -eu readonly
+	sed grep "$1" cd 'quoted text'
+	&& /usr/bin sed echo test local grep local && "$1" test --verbose
+	$(pwd) sed sed | && export 2>/dev/null grep then
+	x=1 -eu && x=1 && | x=1 sed local local "$@" --verbose
+grep ${HOME} done -eu && | grep 'quoted text' echo ${HOME} done
+printf ${HOME} local grep
+${HOME} && readonly test printf 2>/dev/null
+cd "$1" /usr/bin && test local grep |
+		then --verbose "$@" export
+		echo grep echo "$1" /usr/bin then ${HOME} then then x=1
+	x=1 cd -eu export ${HOME} echo 'quoted text'
+	'quoted text' done local test 2>/dev/null echo --verbose "$1" awk ${HOME} grep
+		"$@" 2>/dev/null awk "$@" export $(pwd) -eu echo export "$1" x=1 x=1
+"$1" -eu done ${HOME} 'quoted text'
+"$@" test ${HOME} 2>/dev/null 'quoted text'
+"$1" 'quoted text' awk /usr/bin --verbose x=1 export
+		printf printf && /usr/bin
+		${HOME} readonly local cd 'quoted text' && sed
+	x=1 /usr/bin done x=1 sed --verbose "$@" /usr/bin echo export "$@"
+		test "$1" echo $(pwd) -eu "$@" cd $(pwd) done export sed "$1"
+		readonly | export grep readonly ${HOME} test 'quoted text'
+	--verbose "$@" awk echo
+	${HOME} printf --verbose echo
+		awk sed grep printf 2>/dev/null awk "$@" "$1" readonly && ${HOME} grep then
+test --verbose "$@" "$@" 'quoted text' sed done
+		echo cd && done 2>/dev/null $(pwd) echo local "$1" --verbose
+	${HOME} local -eu "$@" export
+"$1" 2>/dev/null awk readonly
+	x=1 grep $(pwd) "$@" && /usr/bin x=1 printf sed
+	x=1 x=1 --verbose 'quoted text'
+	grep --verbose "$@" test | /usr/bin 'quoted text' -eu /usr/bin printf
+cd done awk 2>/dev/null grep grep grep -eu readonly
+		2>/dev/null export grep | "$@" $(pwd) printf
+		cd echo grep done "$1" -eu /usr/bin
+	grep cd local ${HOME} "$1" echo done printf 2>/dev/null -eu sed printf
+	-eu done done awk done $(pwd) x=1
+${HOME} export grep -eu 2>/dev/null "$@" && awk test
+export && "$1" --verbose x=1 /usr/bin sed awk printf
+	'quoted text' -eu 'quoted text' $(pwd) --verbose sed "$1" printf local
+done grep "$1" x=1 2>/dev/null
+		then && local --verbose done "$1" done echo "$@" then awk sed grep 'quoted text'
+		x=1 cd awk "$1" "$1" | local && && awk printf
+	"$@" "$1" local $(pwd) then echo echo then readonly x=1 sed
+	$(pwd) -eu cd | printf x=1 2>/dev/null $(pwd) -eu test done
+		then printf test "$1" then awk "$@" grep awk 'quoted text' then
+	export | cd printf --verbose sed 2>/dev/null then --verbose test
+test echo test 'quoted text' awk then $(pwd) && "$1" local "$1" 2>/dev/null
+		${HOME} /usr/bin 'quoted text' export 'quoted text'
+done echo then "$1" readonly done "$1" cd then && /usr/bin "$@"
+2>/dev/null ${HOME} done ${HOME} /usr/bin && printf x=1
+		2>/dev/null cd | done then
+	echo cd $(pwd) -eu | 2>/dev/null
+	--verbose 2>/dev/null x=1 test
+local readonly /usr/bin done grep | grep x=1 sed && ${HOME} -eu local done --verbose
+	test -eu done $(pwd) printf && awk --verbose done 'quoted text'
+	cd -eu readonly sed local echo ${HOME} printf $(pwd)
+		awk printf then export local 2>/dev/null done grep
+'quoted text' && sed $(pwd) awk /usr/bin
+/usr/bin --verbose local test 2>/dev/null done then | test
+	${HOME} grep ${HOME} 2>/dev/null
+		local done grep "$1" "$@" | -eu -eu ${HOME}
+x=1 --verbose local "$1" echo then
+	done cd cd done /usr/bin /usr/bin 'quoted text' 2>/dev/null /usr/bin "$1"
+"$@" "$1" --verbose 2>/dev/null
+awk 2>/dev/null sed 'quoted text' | then "$@" awk local | -eu "$@"
+	${HOME} printf then 'quoted text' test readonly done echo "$1" cd "$1" grep $(pwd)
+sed "$@" x=1 awk local -eu export && /usr/bin x=1 cd printf readonly
+		export local 'quoted text' "$@" printf x=1 echo /usr/bin "$@" echo cd test export
+		| awk | then ${HOME} "$@" 2>/dev/null
+awk 2>/dev/null echo --verbose 2>/dev/null local printf cd x=1 "$@" "$@"
+awk "$@" cd printf x=1 readonly --verbose printf
+		echo export | awk cd grep "$@" readonly $(pwd) then
+	done 'quoted text' 2>/dev/null printf then echo x=1
+test 'quoted text' cd echo done ${HOME} export x=1 awk
+--verbose readonly -eu local /usr/bin test && 'quoted text' awk /usr/bin
+	test done then export test $(pwd)
+test -eu 'quoted text' $(pwd) local readonly awk | "$@" grep then
+	$(pwd) echo awk echo sed sed ${HOME} echo
+	printf done grep export export x=1 "$1" test echo -eu
+	printf && /usr/bin 'quoted text'
+awk sed -eu sed sed 2>/dev/null awk cd cd test awk printf
+printf /usr/bin | -eu sed 2>/dev/null printf
+		${HOME} grep --verbose -eu cd x=1 'quoted text' "$@" readonly $(pwd) | /usr/bin
+	export grep grep --verbose sed printf | --verbose x=1
+	| test 'quoted text' "$@"
+export && done --verbose grep local grep then readonly readonly &&
+--verbose $(pwd) done sed test "$1" printf export sed
+		awk test printf | $(pwd) cd 2>/dev/null awk awk
+	&& then awk readonly cd then test awk done printf export test done && echo test
+| sed 2>/dev/null | awk --verbose && $(pwd) "$1" --verbose
+		readonly 2>/dev/null export printf
+	&& test grep "$1" $(pwd) export printf
+		sed x=1 2>/dev/null done test echo export echo then sed 2>/dev/null
+	readonly grep readonly --verbose x=1 "$@"
+	cd x=1 /usr/bin /usr/bin sed --verbose local export done && "$@"
+${HOME} 2>/dev/null sed ${HOME}
+		--verbose awk -eu printf /usr/bin --verbose 'quoted text'
+		test awk $(pwd) echo test printf "$@" -eu x=1 /usr/bin
+echo export awk readonly && 2>/dev/null -eu 'quoted text'
+"$@" printf local test "$1" test cd then cd && cd echo | printf -eu 2>/dev/null
+	echo "$1" --verbose --verbose x=1 ${HOME} ${HOME} printf
+$(pwd) grep cd awk local export test readonly printf && "$1" ${HOME} echo then
+		sed printf cd done 2>/dev/null
+	--verbose /usr/bin 2>/dev/null
+	printf local cd export 2>/dev/null sed cd readonly
+		/usr/bin export printf local && then x=1 done printf export echo grep
+$(pwd) grep cd -eu printf | $(pwd) x=1 "$@" 2>/dev/null $(pwd)
+		echo /usr/bin && echo 'quoted text'
+	"$@" echo "$@" readonly | grep awk awk done test grep cd && awk "$1" "$1" then done
+	2>/dev/null -eu "$@" export ${HOME} awk grep /usr/bin
+	"$@" cd awk readonly 2>/dev/null then printf sed && ${HOME} local
+	local $(pwd) test awk local awk
+	sed 'quoted text' 2>/dev/null "$1" /usr/bin test readonly -eu x=1
+	&& 'quoted text' test x=1 test $(pwd) /usr/bin "$1" echo
+readonly 'quoted text' x=1 ${HOME} | /usr/bin
+	echo export test echo 'quoted text' done x=1 done
+		x=1 readonly /usr/bin | "$1" | "$1" ${HOME} 'quoted text'
+	2>/dev/null local && ${HOME} printf ${HOME} readonly
+"$1" done test readonly $(pwd) x=1 2>/dev/null 'quoted text' "$1"
+		&& readonly sed echo && | 2>/dev/null --verbose 'quoted text' &&
+		export ${HOME} then export
+sed sed export --verbose awk | 'quoted text'
+		done printf 2>/dev/null printf /usr/bin -eu export test
+	'quoted text' grep 2>/dev/null | -eu 2>/dev/null cd /usr/bin echo
+		readonly 2>/dev/null done /usr/bin x=1 printf grep printf printf test
+	then then printf "$1" export -eu test
+		cd /usr/bin 'quoted text' && ${HOME} 2>/dev/null 'quoted text' ${HOME}
+	$(pwd) $(pwd) cd x=1
+	printf echo && done -eu
+local /usr/bin "$@" $(pwd) export ${HOME} /usr/bin local printf
+		x=1 then | | printf then x=1 | awk readonly printf 'quoted text'
+	2>/dev/null readonly printf
+		printf --verbose "$1" local 'quoted text' echo && test "$@" --verbose x=1 readonly
+		'quoted text' 2>/dev/null 2>/dev/null ${HOME} readonly local echo export "$1"
+	sed export "$@" -eu "$@" export x=1 then awk sed ${HOME} awk sed printf awk
+	$(pwd) cd then test echo 'quoted text' && && -eu sed readonly echo then local $(pwd)
+	sed export 2>/dev/null x=1 printf 2>/dev/null
+	awk x=1 --verbose echo printf readonly --verbose
+$(pwd) grep -eu printf readonly 'quoted text' export
+/usr/bin /usr/bin $(pwd) $(pwd) cd sed readonly sed 2>/dev/null
+	${HOME} ${HOME} then 'quoted text' --verbose 2>/dev/null
+	/usr/bin test 'quoted text' 2>/dev/null && "$@" 2>/dev/null echo readonly -eu
+		done echo echo export echo x=1 export --verbose sed 'quoted text' /usr/bin
+	'quoted text' local "$@" cd "$@"
+		"$1" grep x=1 | 'quoted text' /usr/bin ${HOME} --verbose
+		done done ${HOME} 'quoted text' local "$@" $(pwd)
+		readonly | printf test then grep local
+&& grep "$@" printf --verbose
+		local echo printf && x=1 cd $(pwd) 'quoted text' "$@"
+	printf test "$@" grep grep "$1" $(pwd) $(pwd)
+readonly awk readonly awk export test ${HOME} readonly awk export
+	test x=1 awk 'quoted text' local done 2>/dev/null
+	"$1" -eu printf $(pwd) grep && then --verbose
+/usr/bin $(pwd) x=1 && 2>/dev/null
+		"$@" | ${HOME} grep "$@" ${HOME} x=1 'quoted text' -eu readonly "$@"
+		grep -eu cd "$1" printf printf $(pwd)
+		"$@" /usr/bin "$1" x=1 && local done then then then done /usr/bin
+		awk ${HOME} $(pwd) "$@" && && echo $(pwd) $(pwd) --verbose
+		${HOME} grep export | && --verbose
+${HOME} readonly "$@" sed 'quoted text' export ${HOME} local -eu
+	cd then x=1 cd printf awk
+x=1 done done done echo x=1 cd export local cd /usr/bin readonly 2>/dev/null
+		echo printf /usr/bin export --verbose grep x=1 --verbose
+	&& && $(pwd) 'quoted text' grep test readonly awk --verbose then "$@"
+	x=1 -eu readonly --verbose readonly
+		printf local local /usr/bin && && /usr/bin echo && ${HOME}
+	-eu && cd cd test local -eu 2>/dev/null ${HOME}
+		| "$1" test -eu /usr/bin | 'quoted text' then
+		| x=1 "$1" "$1" export test --verbose readonly 2>/dev/null awk echo readonly
+		--verbose cd 'quoted text' -eu -eu local
+		printf printf test sed --verbose
+local cd done --verbose readonly /usr/bin grep
+	2>/dev/null awk -eu 2>/dev/null echo printf $(pwd) grep ${HOME} ${HOME}
+		--verbose sed grep cd export readonly cd $(pwd) "$@" --verbose cd export local
+readonly "$@" done 2>/dev/null "$1" | 2>/dev/null awk 'quoted text'
+export test && ${HOME} ${HOME} done printf test then awk awk
+	x=1 'quoted text' 2>/dev/null
+local "$1" -eu 'quoted text'
+	export 2>/dev/null done && ${HOME} -eu
+printf "$1" /usr/bin ${HOME}
+		2>/dev/null readonly readonly local "$1" | local
+	/usr/bin 'quoted text' "$@" awk readonly awk grep x=1 awk ${HOME} then then
+x=1 sed export awk cd && ${HOME}
+--verbose awk -eu export ${HOME} test && && grep
+	test 'quoted text' -eu --verbose "$1" echo
+		2>/dev/null test /usr/bin
+grep ${HOME} cd printf
+readonly | cd awk readonly local local grep -eu
+grep 2>/dev/null && | "$1"
+local local grep 2>/dev/null
+		grep awk echo then then cd /usr/bin -eu --verbose
+	sed "$@" export 2>/dev/null 2>/dev/null "$1" grep then local
+	sed readonly "$1" readonly "$1" 2>/dev/null sed awk cd ${HOME} |
+	grep ${HOME} 2>/dev/null
+	--verbose --verbose awk printf "$1" $(pwd) | && local then
+	2>/dev/null sed "$@" 'quoted text' --verbose
+readonly export grep -eu awk grep "$1" && test
+		echo x=1 done "$1" ${HOME} local echo awk ${HOME} x=1 ${HOME}
+		/usr/bin local 2>/dev/null
+		readonly 2>/dev/null --verbose readonly then x=1 2>/dev/null /usr/bin ${HOME}
+export $(pwd) local --verbose sed && 'quoted text' cd
+		sed /usr/bin /usr/bin cd | -eu $(pwd) cd echo | "$@" printf 2>/dev/null
+/usr/bin "$@" $(pwd) x=1 export
+	'quoted text' grep then | -eu printf grep $(pwd)
+		-eu $(pwd) x=1 grep "$1" "$1" local -eu test
+		sed && awk readonly "$1" cd 'quoted text'
+	awk done /usr/bin echo --verbose cd sed && x=1 $(pwd) | export $(pwd)
+		$(pwd) readonly "$1" sed ${HOME} done done && | 2>/dev/null then ${HOME}
+		"$@" --verbose | 'quoted text'
+-eu && 'quoted text' | export
@@ -0,0 +1,2001 @@
+	&& /usr/bin ${HOME} 2>/dev/null readonly awk grep local x=1 "$1" $(pwd)
+		echo done printf sed cd grep printf readonly "$@"
+	/usr/bin sed test ${HOME} "$@" "$@" test local 'quoted text' -eu local 2>/dev/null
+		2>/dev/null then sed ${HOME} "$1" awk x=1 local grep echo ${HOME} /usr/bin
+		/usr/bin then 'quoted text' then echo local
+		readonly awk printf $(pwd) -eu awk
+	local readonly && x=1 "$1" export test readonly printf
+		"$1" 'quoted text' grep echo $(pwd)
+readonly --verbose x=1 readonly 'quoted text'
+		echo && awk sed --verbose then -eu
+		"$@" && $(pwd) readonly readonly 2>/dev/null export
+	-eu export test grep printf /usr/bin $(pwd) printf readonly readonly done /usr/bin
+export local --verbose -eu grep "$1" 'quoted text' &&
+-eu "$1" test cd 2>/dev/null "$@" awk echo x=1
+"$1" test && local -eu 2>/dev/null --verbose --verbose "$1" local
+--verbose "$@" --verbose printf grep -eu awk
+		readonly && done echo 'quoted text'
+		'quoted text' ${HOME} x=1 /usr/bin
+		${HOME} --verbose $(pwd) echo cd
+awk /usr/bin awk 'quoted text' 'quoted text' 2>/dev/null grep
+--verbose grep x=1 --verbose test printf "$@" 2>/dev/null echo x=1 then
+printf 2>/dev/null "$@" && export
+	&& /usr/bin --verbose "$1"
+		x=1 done /usr/bin --verbose
+/usr/bin x=1 -eu $(pwd) && test "$@"
+		$(pwd) --verbose | awk sed sed && grep && x=1 --verbose 'quoted text'
+		printf then local "$@" 2>/dev/null $(pwd) "$@" --verbose
+	2>/dev/null -eu -eu echo readonly
+/usr/bin $(pwd) then && printf readonly echo && "$@" cd -eu echo
+'quoted text' /usr/bin echo 2>/dev/null local 'quoted text' | $(pwd)
+	sed "$@" printf then done then x=1
+	--verbose $(pwd) readonly -eu
+awk grep ${HOME} done 2>/dev/null
+	sed done 2>/dev/null local -eu then "$@" done
+	local /usr/bin awk done grep "$@" test
+		| "$@" done ${HOME} echo | then | grep local test test -eu --verbose ${HOME} printf
+		awk && "$@" local | cd 2>/dev/null -eu /usr/bin --verbose
+awk grep export echo /usr/bin awk cd /usr/bin awk printf -eu local export
+	--verbose -eu then "$1" test --verbose echo ${HOME} "$@" $(pwd)
+		done grep x=1 printf grep
+		awk "$@" test ${HOME} --verbose awk echo sed
+awk cd cd x=1 awk awk awk echo | readonly /usr/bin && grep &&
+${HOME} then /usr/bin | readonly ${HOME} echo local
+"$@" "$1" readonly $(pwd)
+	then x=1 done done grep --verbose
+	2>/dev/null echo x=1 $(pwd) --verbose then 'quoted text' "$1"
+printf 'quoted text'
+'quoted text' /usr/bin $(pwd) awk && -eu 'quoted text'
+		cd echo sed then printf local local sed -eu $(pwd) /usr/bin awk
+	x=1 readonly grep ${HOME} "$@" 'quoted text' --verbose --verbose 2>/dev/null
+/usr/bin export done local "$@" && readonly | grep
+sed 'quoted text' export | local then ${HOME}
+		cd -eu 2>/dev/null 2>/dev/null 2>/dev/null | cd /usr/bin
+&& grep && printf grep local "$@" readonly "$1"
+then | 'quoted text' done 'quoted text' awk --verbose 2>/dev/null
+"$1" done /usr/bin | /usr/bin awk echo "$1" printf sed done
+		test awk test echo grep /usr/bin then --verbose then --verbose
+		done echo 2>/dev/null export echo --verbose /usr/bin x=1 export then printf
+	export test x=1 done 'quoted text' 2>/dev/null
+printf "$1" 'quoted text' awk local x=1 cd "$@" 2>/dev/null
+	&& sed done --verbose awk printf "$@"
+	${HOME} x=1 ${HOME} grep ${HOME} test 'quoted text'
+		$(pwd) then local --verbose then "$1" echo sed "$1" /usr/bin | x=1 readonly
+		"$1" x=1 /usr/bin -eu
+		&& cd -eu "$1" | printf $(pwd) cd && "$1" /usr/bin -eu -eu cd
+sed 'quoted text' test done 'quoted text' local done
+		x=1 local done -eu echo
+		| x=1 printf test && ${HOME} /usr/bin echo grep -eu --verbose --verbose
+	export done 'quoted text' export
+		${HOME} local test $(pwd) && done test "$1" "$1" test x=1 then "$1"
+awk ${HOME} "$@" test then /usr/bin grep $(pwd) /usr/bin --verbose
+export local 2>/dev/null 'quoted text' test test printf printf
+| x=1 awk "$@" then done done &&
+done awk x=1 then grep test "$1"
+$(pwd) awk $(pwd) /usr/bin printf /usr/bin
+		&& 2>/dev/null done -eu grep printf x=1 $(pwd) "$@" x=1 then --verbose /usr/bin
+	grep test "$@" | awk then grep
+	test export cd export x=1 grep sed "$1" --verbose /usr/bin ${HOME} awk grep $(pwd)
+	x=1 "$@" 2>/dev/null ${HOME} local then test cd --verbose echo cd 2>/dev/null export
+readonly $(pwd) test ${HOME} then sed local echo 2>/dev/null
+	then x=1 sed grep readonly cd 2>/dev/null ${HOME} awk /usr/bin "$1" $(pwd)
+	| 'quoted text' export readonly && -eu
+"$@" /usr/bin then export done -eu 2>/dev/null | test local cd
+	2>/dev/null echo printf sed grep --verbose "$@" sed printf echo
+	2>/dev/null "$1" | cd |
+	readonly grep 'quoted text' "$1"
+export printf local ${HOME} -eu local /usr/bin test then grep printf /usr/bin
+	-eu 'quoted text' | $(pwd) readonly 2>/dev/null
+		-eu sed local --verbose grep test test "$@" ${HOME} test x=1 $(pwd) 2>/dev/null
+	cd | x=1 2>/dev/null /usr/bin $(pwd) test test
+		cd ${HOME} ${HOME} grep readonly | export sed grep cd cd && ${HOME}
+	${HOME} grep 2>/dev/null readonly grep -eu done printf
+2>/dev/null awk awk /usr/bin cd
+		-eu --verbose "$1" done && --verbose ${HOME} 2>/dev/null
+		2>/dev/null grep --verbose "$1" ${HOME} /usr/bin
+		done && --verbose && x=1 -eu then
+		x=1 grep $(pwd) 'quoted text' echo $(pwd) "$@" readonly
+"$@" "$@" 2>/dev/null test $(pwd) && x=1 then done -eu x=1 'quoted text' sed "$@"
+	echo $(pwd) cd cd then ${HOME} && $(pwd) /usr/bin --verbose local
+cd sed done local echo 2>/dev/null then test x=1 done --verbose
+		echo && "$1" 'quoted text' $(pwd) awk local test local /usr/bin
+		grep x=1 "$@" then then && | "$1" cd ${HOME} 'quoted text'
+		&& 2>/dev/null export grep -eu /usr/bin test 'quoted text' awk 2>/dev/null
+	then readonly cd ${HOME} x=1 | | grep 2>/dev/null x=1
+$(pwd) grep "$1" "$@"
+export then local $(pwd) ${HOME} test
+		echo 'quoted text' 'quoted text' 2>/dev/null then -eu 'quoted text'
+test then ${HOME} grep -eu then 2>/dev/null
+		${HOME} test sed grep 2>/dev/null -eu "$@" -eu x=1 then echo done "$@" 'quoted text'
+readonly grep -eu -eu printf local cd
+		printf x=1 echo && export
+	readonly "$@" ${HOME} then grep | awk -eu | -eu grep $(pwd)
+awk "$@" x=1 awk echo | awk x=1 "$1" "$@" echo
+readonly x=1 'quoted text'
+		'quoted text' x=1 sed "$@" -eu readonly x=1 readonly
+		echo sed $(pwd) local --verbose "$1" printf /usr/bin test sed ${HOME} "$@" 2>/dev/null
+2>/dev/null echo ${HOME} done "$@" test grep
+x=1 cd x=1 && sed cd awk 'quoted text'
+	awk -eu readonly readonly 2>/dev/null -eu printf $(pwd) $(pwd) --verbose
+		sed $(pwd) sed | x=1 $(pwd) --verbose
+		export readonly | ${HOME} readonly -eu --verbose test printf done
+		"$1" x=1 done test /usr/bin sed awk cd -eu readonly $(pwd)
+	echo "$1" export awk "$1" x=1 cd local
+	local -eu cd then local then
+--verbose sed "$@" export
+	sed && ${HOME} x=1 | /usr/bin 2>/dev/null && echo done | export export /usr/bin
+		cd && test cd then --verbose
+		grep printf -eu export ${HOME} -eu test "$@" printf readonly test
+${HOME} 'quoted text' readonly then
+	echo x=1 sed local --verbose grep test x=1 --verbose 'quoted text' done --verbose
+	${HOME} 'quoted text' export printf then
+		cd "$1" then printf "$1" "$@" grep 'quoted text' readonly export --verbose echo
+	${HOME} sed awk 2>/dev/null readonly
+	cd export $(pwd) sed export echo $(pwd) 'quoted text' "$1" | export x=1 printf
+/usr/bin $(pwd) echo readonly done export
+cd awk "$@" 'quoted text' | 2>/dev/null x=1 "$1" printf
+	| 2>/dev/null readonly ${HOME} awk readonly 'quoted text'
+		"$@" awk $(pwd) awk && then export "$@" -eu readonly
+		export printf cd $(pwd) x=1 "$1" && $(pwd) x=1 printf 'quoted text'
+then $(pwd) export -eu then echo | printf ${HOME} $(pwd) 2>/dev/null x=1
+		&& then test printf --verbose 'quoted text' $(pwd) then
+		readonly awk done printf cd test export 'quoted text' printf
+'quoted text' awk sed awk grep --verbose readonly x=1 echo ${HOME} -eu
+	cd "$@" 2>/dev/null "$@" ${HOME} && $(pwd) export sed
+	| cd grep && | grep awk x=1 -eu x=1 echo /usr/bin cd "$@" test | x=1
+		$(pwd) grep ${HOME} | grep -eu echo "$@" echo cd sed --verbose echo --verbose
+	--verbose printf done echo grep $(pwd) 'quoted text' "$1"
+		&& test "$@" --verbose "$@" "$1" then
+	local -eu printf sed x=1
+	echo 2>/dev/null --verbose done cd
+${HOME} && | echo /usr/bin awk --verbose
+		printf cd && $(pwd) 2>/dev/null $(pwd) --verbose | 2>/dev/null echo 'quoted text'
+-eu 2>/dev/null then sed 2>/dev/null
+	"$1" test grep readonly readonly printf grep "$@" then sed echo grep /usr/bin
+		2>/dev/null -eu export | /usr/bin "$@" test --verbose sed sed /usr/bin --verbose
+	${HOME} x=1 grep echo "$@" | echo
+		printf --verbose test grep echo ${HOME} awk local ${HOME} sed "$1"
+done cd echo printf "$@"
+	-eu test 2>/dev/null | $(pwd)
+	2>/dev/null local 2>/dev/null
+		"$@" x=1 test printf | local $(pwd) "$1" "$@" export echo ${HOME} cd 2>/dev/null
+		'quoted text' grep "$1" readonly
+	"$1" "$@" cd "$1" echo local
+		"$1" local done local echo awk sed done 2>/dev/null grep
+	sed then done echo grep then 2>/dev/null local && /usr/bin
+	printf export awk | echo /usr/bin && /usr/bin cd export done "$@" awk export awk
+		"$1" "$1" /usr/bin cd "$@" readonly grep --verbose x=1 $(pwd)
+		local readonly readonly
+	&& printf 2>/dev/null done --verbose local test done cd echo "$@" echo
+		"$@" && /usr/bin && | export awk readonly readonly local readonly
+"$@" -eu | export 'quoted text' | cd | then --verbose /usr/bin
+	grep echo | x=1 then then export export
+	$(pwd) "$1" echo 'quoted text'
+export printf 'quoted text' --verbose
+		cd local echo printf 2>/dev/null
+	${HOME} printf 'quoted text' local grep grep 'quoted text' printf ${HOME} x=1
+		| echo | test awk -eu echo cd "$1"
+	then $(pwd) echo /usr/bin -eu export $(pwd) test awk awk test
+	cd -eu awk readonly -eu sed awk | /usr/bin then $(pwd) test then $(pwd)
+		"$@" sed local sed cd /usr/bin readonly && "$@"
+		cd | 'quoted text' then -eu
+${HOME} then 2>/dev/null
+	test local "$@" /usr/bin 2>/dev/null export -eu printf cd x=1 cd -eu done
+	x=1 local 'quoted text'
+	echo cd export $(pwd) awk then 'quoted text' -eu awk 'quoted text' printf test -eu
+		-eu readonly then then /usr/bin "$@" sed && cd readonly local
+'quoted text' "$1" --verbose "$@" $(pwd) echo && | then | echo 2>/dev/null
+		&& awk awk -eu printf $(pwd) grep -eu "$1" echo $(pwd)
+"$@" "$1" echo readonly $(pwd) | | test
+		-eu printf "$1" 'quoted text' cd done test | 'quoted text'
+	local then /usr/bin "$1" readonly echo awk /usr/bin
+done export grep x=1 x=1 readonly readonly export --verbose x=1 2>/dev/null
+$(pwd) printf printf sed x=1 cd done test done awk
+	printf $(pwd) done "$1" x=1 awk "$@" "$1" && readonly test sed && printf 'quoted text'
+grep sed /usr/bin 2>/dev/null test "$@" ${HOME} 2>/dev/null 2>/dev/null
+awk $(pwd) ${HOME} && 'quoted text'
+printf ${HOME} local cd "$@" export awk ${HOME} echo test "$@" done x=1
+	/usr/bin | 2>/dev/null done sed cd ${HOME} --verbose | $(pwd) sed $(pwd)
+		test done export done then x=1 printf awk echo
+cd awk export readonly
+	2>/dev/null && then then "$1" printf "$@" x=1 && cd "$1" done echo grep x=1 -eu
+	-eu echo sed done $(pwd) ${HOME} x=1 && ${HOME} && readonly printf sed awk readonly
+		test 2>/dev/null 'quoted text' /usr/bin test grep
+awk test readonly 'quoted text' "$1" "$@" export $(pwd) test "$1" "$1" $(pwd) x=1
+	local grep grep ${HOME} grep ${HOME} 'quoted text' | awk test 2>/dev/null
+done ${HOME} printf "$1"
+	x=1 'quoted text' -eu readonly echo cd /usr/bin test local "$@" echo sed readonly
+		"$@" printf && 2>/dev/null | grep ${HOME} grep --verbose
+--verbose local $(pwd) readonly
+$(pwd) cd echo $(pwd) export
+	--verbose x=1 export export
+		"$@" printf 'quoted text' printf echo readonly cd local /usr/bin
+	'quoted text' -eu --verbose "$@" 'quoted text'
+local | "$@" ${HOME} sed $(pwd) ${HOME} | echo sed export 2>/dev/null printf
+		then ${HOME} $(pwd) export
+	awk x=1 | sed done $(pwd) -eu awk 2>/dev/null grep && -eu
+	x=1 | awk -eu readonly grep done "$@" grep echo
+	awk grep then && 'quoted text' | && "$@" | sed x=1 readonly $(pwd) --verbose
+		2>/dev/null -eu echo 'quoted text' | grep printf printf
+		"$@" --verbose done x=1 "$@" test && local cd ${HOME} sed | readonly "$@"
+		--verbose awk 'quoted text' cd echo echo sed 2>/dev/null x=1 /usr/bin done | 2>/dev/null
+export grep "$@" "$1" readonly readonly 2>/dev/null then && x=1 done readonly
+"$1" -eu test 2>/dev/null echo sed awk export
+	done && readonly printf test --verbose x=1 "$1" --verbose
+		sed export $(pwd) --verbose sed --verbose sed cd
+readonly readonly x=1 awk x=1 /usr/bin readonly 2>/dev/null
+	${HOME} "$1" then x=1 done readonly 2>/dev/null sed then export "$1" /usr/bin 'quoted text'
+--verbose cd readonly --verbose done 2>/dev/null then | done ${HOME}
+		| /usr/bin then x=1 /usr/bin
+	test x=1 then awk local printf awk x=1 && ${HOME} echo
+		--verbose export "$@" sed 'quoted text' "$@" printf printf local done
+	grep then x=1 ${HOME} --verbose --verbose x=1 done local &&
+local then cd awk "$@" && sed local 2>/dev/null echo grep 2>/dev/null
+	--verbose export x=1 awk export /usr/bin
+&& then 2>/dev/null && -eu grep sed test -eu
+	grep local /usr/bin 'quoted text'
+	sed test "$@" $(pwd) 2>/dev/null 'quoted text' --verbose printf
+	then grep "$1" grep -eu awk local x=1 2>/dev/null printf done local echo
+/usr/bin -eu ${HOME} grep 2>/dev/null then grep export then grep cd export
+	echo x=1 x=1 /usr/bin
+	export cd readonly printf "$@" cd done cd 'quoted text'
+| sed /usr/bin "$1" cd /usr/bin then
+	grep echo | cd && -eu grep -eu echo && $(pwd) then printf "$1" cd awk sed "$@"
+		sed local --verbose /usr/bin "$@" printf 2>/dev/null readonly 'quoted text'
+	x=1 sed then 'quoted text' x=1 'quoted text'
+	export test awk "$@" sed ${HOME} then ${HOME}
+test done | "$1" "$1" export && ${HOME} | test readonly cd 2>/dev/null
+test | echo "$@" "$1" done printf sed
+local printf -eu "$@" && then "$@" export /usr/bin 'quoted text' $(pwd)
+cd --verbose then then export done ${HOME}
+	-eu test "$@" echo ${HOME} test 2>/dev/null "$1"
+	then export local echo printf 'quoted text' && cd && echo
+	/usr/bin printf readonly export grep 'quoted text'
+2>/dev/null x=1 "$1" grep printf /usr/bin ${HOME} ${HOME} $(pwd) sed cd | x=1 readonly
+	done | awk --verbose ${HOME} export done test local
+&& then x=1 printf done cd local x=1
+awk /usr/bin local | --verbose sed printf && ${HOME} export export
+	-eu echo echo test readonly --verbose export "$@"
+	$(pwd) $(pwd) cd export sed echo ${HOME} echo then test ${HOME} local "$@" | /usr/bin
+	x=1 -eu echo export "$1" echo grep 'quoted text' sed cd 2>/dev/null /usr/bin
+	--verbose export "$@" /usr/bin export then awk -eu --verbose
+	test echo && readonly echo export printf ${HOME} "$1" /usr/bin
+	local x=1 printf local printf /usr/bin $(pwd) printf --verbose /usr/bin
+		readonly awk 2>/dev/null ${HOME} echo $(pwd)
+sed | $(pwd) "$1" then 'quoted text'
+awk ${HOME} $(pwd) then done && $(pwd) 'quoted text' --verbose 'quoted text'
+| /usr/bin ${HOME} test test /usr/bin
+grep /usr/bin test test sed "$@" ${HOME} 'quoted text' sed | 'quoted text' local
+	grep cd /usr/bin | -eu -eu
+		"$1" grep printf printf cd 2>/dev/null readonly sed cd "$@" $(pwd) "$@" then
+		--verbose grep "$@" printf cd | /usr/bin
+done "$1" x=1 awk printf done awk then local echo printf "$1" readonly
+${HOME} local 'quoted text' 'quoted text' --verbose -eu &&
+		-eu "$@" readonly local "$@" export && "$@"
+"$1" local "$1" ${HOME}
+cd && --verbose /usr/bin cd test test -eu echo $(pwd)
+done 2>/dev/null done grep 2>/dev/null grep --verbose
+	| sed awk grep --verbose
+		printf $(pwd) /usr/bin local
+		then "$1" && --verbose 2>/dev/null x=1 && sed printf echo $(pwd)
+	test "$1" --verbose cd sed "$1" export test && then
+printf test /usr/bin readonly local "$@"
+		echo cd $(pwd) echo /usr/bin readonly awk
+	2>/dev/null sed then "$1" 2>/dev/null
+	'quoted text' --verbose sed readonly ${HOME} sed sed "$1"
+	x=1 ${HOME} 2>/dev/null ${HOME} test echo readonly $(pwd) ${HOME} printf
+		printf test readonly x=1 $(pwd) test --verbose "$@" echo
+		x=1 ${HOME} grep cd local "$1" 'quoted text' cd 'quoted text'
+	cd $(pwd) awk awk x=1 /usr/bin x=1 $(pwd) 'quoted text' cd done test 2>/dev/null
+		done test sed grep export
+sed awk /usr/bin readonly 2>/dev/null export sed -eu
+		"$@" $(pwd) 2>/dev/null readonly then 2>/dev/null
+readonly $(pwd) x=1 | "$@"
+&& awk awk --verbose echo echo ${HOME} local "$1" "$@" done x=1 'quoted text'
+	&& export /usr/bin $(pwd) -eu "$@" | export ${HOME}
+		'quoted text' "$@" export sed --verbose
+		-eu then "$1" printf sed done cd sed "$@" test sed 2>/dev/null
+x=1 printf readonly x=1 /usr/bin && "$1"
+'quoted text' ${HOME} done && awk && test /usr/bin
+$(pwd) test cd cd local
+		grep done cd ${HOME} awk local
+--verbose x=1 printf local "$1" cd -eu printf "$@" awk ${HOME} "$@" 2>/dev/null
+test "$1" done test "$1"
+	cd -eu -eu printf x=1 then awk
+	local local cd x=1 then test |
+	grep --verbose x=1 printf ${HOME} $(pwd)
+	"$1" printf then -eu |
+	done -eu local readonly && 'quoted text' readonly
+$(pwd) && export echo grep grep "$@"
+		/usr/bin -eu 2>/dev/null
+		-eu done | readonly "$@" /usr/bin cd /usr/bin
+		local "$@" export -eu grep grep cd printf cd -eu
+grep export readonly export readonly
+		"$@" x=1 cd 'quoted text' test export then x=1 then cd "$1" then printf
+	done $(pwd) /usr/bin /usr/bin "$1" ${HOME} echo /usr/bin && echo $(pwd) && then
+		done sed cd | 'quoted text' readonly
+		printf ${HOME} 'quoted text' ${HOME} x=1 | echo "$1" readonly printf
+grep x=1 $(pwd) echo --verbose printf 'quoted text' then 2>/dev/null
+	done ${HOME} --verbose ${HOME} $(pwd) done test | sed ${HOME} test $(pwd)
+	done -eu grep /usr/bin x=1 export local "$1" cd local x=1 -eu
+		test then -eu "$@" readonly sed local local x=1 cd printf cd
+"$@" 2>/dev/null | && x=1 /usr/bin test "$@" &&
+		done | grep 'quoted text'
+	"$1" "$1" x=1 x=1 readonly echo ${HOME} readonly
+'quoted text' export "$@" $(pwd) 'quoted text' ${HOME} cd cd export cd ${HOME}
+/usr/bin x=1 echo 2>/dev/null $(pwd) /usr/bin
+		echo test done test -eu --verbose 2>/dev/null then local local --verbose awk
+| | sed then 2>/dev/null |
+echo local echo $(pwd) export printf export
+	&& $(pwd) sed cd local "$@"
+		then test --verbose "$1" cd printf export -eu
+export printf test grep &&
+	&& echo | export export && readonly echo 'quoted text' 'quoted text' sed
+local echo "$1" ${HOME} cd printf local 'quoted text'
+	printf | test x=1 x=1 sed | /usr/bin 'quoted text' grep echo -eu -eu $(pwd)
+		test done | /usr/bin grep ${HOME} then
+"$1" export printf test local x=1 cd cd &&
+		readonly | /usr/bin /usr/bin
+		x=1 export readonly ${HOME} test "$@"
+		/usr/bin awk "$1" printf test 'quoted text' local "$@" ${HOME} local cd local
+	sed local printf printf /usr/bin local x=1 ${HOME} | "$@"
+$(pwd) "$1" cd local ${HOME}
+		-eu cd printf "$1" awk grep
+"$1" readonly grep 2>/dev/null
+-eu sed 'quoted text' echo
+/usr/bin 'quoted text' x=1 grep printf done && awk awk $(pwd) && --verbose
+	sed export readonly x=1
+		'quoted text' then -eu $(pwd) 'quoted text' awk
+		'quoted text' $(pwd) then "$@" cd grep awk --verbose
+		then | "$1" then test ${HOME} x=1
+	export grep local | awk 2>/dev/null |
+grep grep cd awk $(pwd) test then | done
+	echo sed -eu -eu -eu --verbose echo x=1
+	local readonly ${HOME} "$@"
+		${HOME} cd readonly ${HOME} readonly echo then "$1" |
+	-eu "$1" --verbose sed readonly grep test $(pwd)
+cd cd | done "$1" | grep local echo --verbose --verbose
+then && && /usr/bin awk 'quoted text' 'quoted text' grep test then 2>/dev/null
+sed readonly then awk --verbose grep /usr/bin 'quoted text' ${HOME} cd readonly
+done done $(pwd) 2>/dev/null echo done awk "$1"
+		/usr/bin awk --verbose
+		&& ${HOME} sed echo sed "$1" && export "$1" printf echo | local $(pwd)
+		"$@" "$@" /usr/bin --verbose then
+done echo "$@" then cd sed 'quoted text' export && test then | ${HOME}
+echo -eu grep done $(pwd) 2>/dev/null
+	echo local then done -eu -eu then printf export
+	awk awk x=1 local ${HOME} echo
+| export readonly -eu export done ${HOME}
+	grep readonly echo readonly | printf
+	cd then x=1 /usr/bin test && "$1" -eu awk
+		local readonly -eu | then done done sed local grep
+$(pwd) $(pwd) awk sed printf export x=1 test x=1 local "$1" printf | ${HOME}
+		&& cd | "$1" 'quoted text' echo printf
+/usr/bin 2>/dev/null "$@" then export
+	"$1" cd | /usr/bin export x=1 && then awk | 2>/dev/null $(pwd) 'quoted text'
+		readonly grep cd export && local
+		local printf 2>/dev/null awk readonly "$1" export awk readonly then 2>/dev/null
+x=1 cd then "$1" "$1" /usr/bin readonly ${HOME} -eu done cd --verbose
+&& cd cd export /usr/bin |
+		echo local && 'quoted text' x=1 done x=1 $(pwd)
+&& && ${HOME} x=1 $(pwd) $(pwd) | 2>/dev/null printf cd &&
+${HOME} export $(pwd)
+		"$@" 'quoted text' | export export sed local sed /usr/bin
+	local readonly echo "$@" x=1 &&
+	then then --verbose sed ${HOME} echo done echo /usr/bin printf grep "$1" $(pwd)
+		echo /usr/bin $(pwd) export
+		"$1" export ${HOME} "$@" /usr/bin
+		grep then -eu readonly test
+echo -eu "$@" then && 'quoted text' readonly | then ${HOME} test awk then then
+		--verbose grep sed echo printf -eu 2>/dev/null /usr/bin export -eu export
+		local --verbose printf "$1" sed --verbose | export then local | && "$@" then
+local awk --verbose awk
+	grep $(pwd) x=1 grep sed 'quoted text' /usr/bin
+		readonly local 2>/dev/null x=1 cd echo "$@" sed local "$1" awk
+		${HOME} export grep local 'quoted text'
+	local x=1 /usr/bin done readonly
+		cd echo printf printf /usr/bin local grep /usr/bin 2>/dev/null
+printf local --verbose "$1" &&
+readonly $(pwd) test "$1" cd "$1" grep
+	then ${HOME} /usr/bin echo 'quoted text' "$1" --verbose readonly ${HOME} "$@" printf
+grep --verbose cd --verbose readonly $(pwd) /usr/bin awk
+x=1 $(pwd) grep then x=1 sed x=1 2>/dev/null readonly
+		2>/dev/null -eu 2>/dev/null /usr/bin -eu "$1" --verbose
+	test cd readonly cd test cd then "$@" echo 'quoted text' sed sed "$@" grep
+		cd echo grep 2>/dev/null -eu test printf $(pwd) echo test done cd ${HOME}
+-eu grep grep printf readonly then awk grep | ${HOME} x=1 done local "$1" sed
+	sed grep x=1 cd ${HOME} printf
+		--verbose ${HOME} && x=1 -eu && "$@" local 'quoted text' --verbose --verbose
+	test $(pwd) ${HOME} printf sed awk --verbose grep awk "$@" $(pwd) export
+export ${HOME} --verbose ${HOME} "$1" && test "$@" local x=1 printf
+		then cd -eu 2>/dev/null x=1 "$@" test ${HOME} local echo --verbose
+	--verbose ${HOME} -eu grep test && && && && x=1 grep done
+"$@" export "$@" printf 'quoted text' 'quoted text' "$1"
+		readonly printf -eu printf echo x=1 --verbose cd 'quoted text'
+		grep readonly -eu test echo
+awk awk done done --verbose
+test sed awk | ${HOME} "$@" test test |
+	-eu ${HOME} /usr/bin ${HOME} -eu grep
+		grep awk 2>/dev/null test 'quoted text' printf
+		${HOME} ${HOME} echo echo
+	printf awk sed local x=1 --verbose awk "$1" then "$1" grep
+test /usr/bin test | /usr/bin "$@" test printf "$@" printf && test done sed awk
+done echo test 2>/dev/null test $(pwd)
+		then printf --verbose export "$@" awk -eu export grep local
+	echo 2>/dev/null 'quoted text' $(pwd)
+	cd ${HOME} sed printf printf done grep export "$@" $(pwd)
+test /usr/bin printf readonly test export "$@" echo cd | then "$1" 'quoted text'
+		export && readonly printf printf export
+		'quoted text' printf local cd cd grep "$@" && test
+${HOME} /usr/bin test && export | awk cd awk readonly done /usr/bin awk test
+readonly x=1 "$@" echo local then x=1 cd 2>/dev/null export test /usr/bin
+		'quoted text' -eu | grep -eu sed /usr/bin
+	cd "$1" echo /usr/bin grep
+		printf 'quoted text' cd test /usr/bin "$@" test "$1" ${HOME}
+then ${HOME} grep && done
+then grep done export cd 'quoted text'
+| readonly x=1 "$@" "$1" x=1 done readonly | 2>/dev/null && echo
+		printf echo sed then &&
+	2>/dev/null then 'quoted text' cd "$1" x=1 "$@" 'quoted text' 2>/dev/null
+&& $(pwd) echo awk --verbose done done
+x=1 -eu && test then sed -eu awk 'quoted text' 2>/dev/null
+		/usr/bin x=1 -eu ${HOME} -eu echo then x=1 grep printf awk cd then $(pwd)
+		x=1 awk -eu echo printf then awk | && readonly "$1" "$1" "$@" --verbose
+		test 2>/dev/null readonly $(pwd) then ${HOME} 'quoted text'
+	then echo printf echo test /usr/bin
+--verbose grep awk && printf x=1 x=1 --verbose /usr/bin
+-eu --verbose grep $(pwd) readonly | | "$1" && echo local test readonly |
+&& readonly export ${HOME} printf 'quoted text'
+	grep x=1 test 'quoted text' 2>/dev/null && "$@" cd done printf export
+sed awk readonly echo awk cd -eu 'quoted text' -eu awk && sed local
+	"$1" "$1" done done awk cd grep awk "$@" printf x=1 done --verbose
+	${HOME} $(pwd) | awk | "$1" grep test "$@" readonly done then -eu 'quoted text'
+		"$1" 'quoted text' readonly readonly sed
+		/usr/bin done -eu then 'quoted text' $(pwd)
+then --verbose ${HOME} -eu echo cd ${HOME} awk -eu --verbose
+	'quoted text' "$@" /usr/bin then echo "$1" printf
+grep sed grep -eu awk "$@" readonly "$@" done $(pwd) local export cd readonly
+$(pwd) --verbose x=1 then printf sed grep done
+x=1 "$1" cd ${HOME} grep local then x=1 cd sed test
+		${HOME} test "$@" "$@" echo test awk "$1" --verbose "$@"
+	/usr/bin cd "$@" | 2>/dev/null then done "$1" | local "$@" "$@" /usr/bin then
+	| export export "$@" && ${HOME} && cd
+	${HOME} | 2>/dev/null "$1" then 2>/dev/null /usr/bin
+	awk awk then 2>/dev/null --verbose sed /usr/bin -eu "$@"
+		done "$1" done ${HOME} awk export printf ${HOME} --verbose 2>/dev/null test export
+		grep x=1 -eu /usr/bin echo test done
+	test awk $(pwd) 2>/dev/null sed /usr/bin -eu export $(pwd) export sed 'quoted text'
+	awk x=1 'quoted text' && then awk echo ${HOME}
+local then cd /usr/bin --verbose
+		export 2>/dev/null then readonly --verbose "$1" 2>/dev/null awk 'quoted text'
+	awk local | sed printf 2>/dev/null ${HOME} awk /usr/bin
+&& && x=1 $(pwd) export test /usr/bin x=1
+readonly --verbose /usr/bin local --verbose 2>/dev/null grep
+	printf --verbose ${HOME} local 'quoted text'
+| test --verbose --verbose $(pwd) grep echo /usr/bin awk done readonly local then
+sed /usr/bin x=1 echo 'quoted text' grep awk 'quoted text'
+cd test test readonly grep | then grep 2>/dev/null --verbose
+printf printf echo | grep then /usr/bin --verbose "$1" done ${HOME} &&
+	$(pwd) sed echo export done --verbose test x=1 then export local test
+		"$@" awk $(pwd) readonly test ${HOME} cd cd printf /usr/bin
+"$1" 2>/dev/null local $(pwd)
+		test grep done awk readonly
+	sed then /usr/bin | x=1
+--verbose echo "$@" 'quoted text' then awk --verbose test awk
+		-eu --verbose test -eu "$1" 'quoted text'
+		x=1 ${HOME} cd | printf 2>/dev/null export && ${HOME}
+		sed done | "$1" "$1" export 2>/dev/null $(pwd)
+cd /usr/bin --verbose "$1" | ${HOME}
+cd echo $(pwd) --verbose /usr/bin /usr/bin "$1" export done printf
+2>/dev/null cd cd cd grep
+readonly /usr/bin cd 'quoted text'
+	sed test | -eu local
+		2>/dev/null 2>/dev/null done $(pwd) --verbose printf ${HOME}
+	$(pwd) local $(pwd) ${HOME} $(pwd) done 'quoted text'
+	local echo "$1" grep "$@"
+	printf readonly --verbose grep echo --verbose printf export
+	readonly | "$@" 2>/dev/null "$@" export readonly $(pwd) 2>/dev/null
+		${HOME} --verbose readonly --verbose local export 2>/dev/null
+		then sed test $(pwd) 'quoted text' echo $(pwd) sed cd test then 2>/dev/null
+		grep done "$1" "$@" export /usr/bin done export grep ${HOME} export
+	sed $(pwd) --verbose local "$@" echo
+2>/dev/null "$@" 2>/dev/null -eu "$@" x=1 test -eu sed
+		"$1" done cd awk then /usr/bin "$@" -eu 2>/dev/null --verbose export grep printf
+	&& && echo test export
+		grep awk awk readonly done && cd printf local | -eu ${HOME} /usr/bin x=1 "$@"
+		done /usr/bin done "$@" 'quoted text'
+${HOME} 2>/dev/null sed -eu readonly $(pwd) /usr/bin printf 2>/dev/null
+		${HOME} && done && local grep ${HOME}
+	--verbose export local "$@" /usr/bin awk test done 'quoted text' 2>/dev/null
+	x=1 2>/dev/null x=1 --verbose readonly printf
+		&& -eu done /usr/bin /usr/bin x=1
+	-eu local 2>/dev/null "$@" | done sed then
+echo ${HOME} printf /usr/bin awk echo then "$@" sed printf ${HOME} && && grep 2>/dev/null
+		test done test done export ${HOME} done $(pwd) /usr/bin
+$(pwd) $(pwd) test /usr/bin cd awk ${HOME} awk 'quoted text'
+grep done && test $(pwd) sed && && then local
+	--verbose readonly -eu | test "$1"
+	printf --verbose sed --verbose printf sed awk grep
+	local grep 'quoted text' $(pwd) sed 2>/dev/null | local
+	cd /usr/bin /usr/bin printf x=1 'quoted text' local test /usr/bin /usr/bin 'quoted text'
+grep "$@" $(pwd) then "$1" | readonly printf 2>/dev/null ${HOME} --verbose
+	export /usr/bin test local | "$@" | $(pwd) x=1 --verbose grep
+	awk -eu -eu && --verbose awk then
+		local echo "$1" 'quoted text' echo
+	test /usr/bin sed sed export | $(pwd)
+	--verbose /usr/bin local grep 2>/dev/null
+	readonly sed 2>/dev/null cd &&
+grep local --verbose $(pwd) | 2>/dev/null grep printf cd then 'quoted text' "$@"
+		"$1" echo x=1 2>/dev/null done awk
+printf then -eu done printf 'quoted text'
+		cd readonly -eu 2>/dev/null
+		local | done printf export readonly cd 'quoted text'
+	--verbose then sed -eu printf x=1 done
+	then grep test local && export printf sed then
+| sed /usr/bin sed printf 'quoted text' test echo
+then 2>/dev/null $(pwd) awk
+	then awk echo sed "$1" sed ${HOME}
+		readonly export printf
+	done | -eu export && done done readonly
+	awk && export 'quoted text' --verbose /usr/bin printf sed export awk
+&& export sed 'quoted text' ${HOME} done echo sed -eu sed -eu 'quoted text' export
+	$(pwd) && cd 'quoted text' test grep && 2>/dev/null
+		printf export grep then awk awk echo 2>/dev/null 'quoted text' printf then sed
+	'quoted text' printf awk -eu "$1" "$1" -eu local grep
+		--verbose printf readonly printf | cd "$1" export test "$1" readonly
+	&& "$@" -eu grep sed
+		2>/dev/null sed /usr/bin then sed export | then printf then ${HOME} export && readonly
+"$@" then local "$1" "$1" then x=1 | ${HOME}
+		2>/dev/null local local local
+	| | 'quoted text' --verbose readonly export
+	printf $(pwd) printf --verbose echo then
+	local /usr/bin $(pwd) && "$@" /usr/bin awk sed readonly
+	then cd local 2>/dev/null --verbose "$1" printf local grep local 'quoted text'
+		2>/dev/null awk x=1 cd awk test printf 'quoted text'
+	readonly "$@" ${HOME} printf cd "$@" 2>/dev/null
+	'quoted text' x=1 then printf done | export then 'quoted text'
+/usr/bin $(pwd) grep grep done 2>/dev/null
+		local cd then "$@" then echo 'quoted text' /usr/bin grep 'quoted text'
+	printf then ${HOME} "$@" "$@" export "$1" && -eu | export local ${HOME}
+		test echo local echo | export sed ${HOME} -eu export 'quoted text' 2>/dev/null
+	"$@" "$@" | export awk cd then /usr/bin
+		printf echo "$@" 2>/dev/null awk printf test --verbose local grep "$@" cd 2>/dev/null
+		export x=1 'quoted text' sed echo echo export x=1 /usr/bin
+cd printf /usr/bin cd
+local echo test "$1" then x=1 local readonly
+		local grep test sed printf awk -eu "$1" printf $(pwd)
+local sed done done 'quoted text' printf ${HOME} /usr/bin --verbose
+		cd /usr/bin /usr/bin local | /usr/bin test "$@" x=1 printf x=1 --verbose
+	readonly 'quoted text' && -eu readonly 'quoted text' "$@" export
+		done 'quoted text' 2>/dev/null readonly -eu readonly
+	then -eu local then x=1 test 'quoted text' sed
+| cd -eu $(pwd) readonly
+		cd && readonly 'quoted text' && $(pwd)
+local printf "$1" grep export echo 2>/dev/null 2>/dev/null x=1 export
+--verbose sed test 2>/dev/null
+		-eu 2>/dev/null $(pwd) 'quoted text' readonly then readonly --verbose then
+	grep local grep 2>/dev/null local | /usr/bin
+	printf | | "$@" 'quoted text' --verbose && 'quoted text' printf 'quoted text'
+	grep export grep 'quoted text' --verbose export export --verbose && 'quoted text'
+sed "$@" then sed ${HOME} echo cd
+echo 'quoted text' "$@" echo x=1 | --verbose "$1" sed ${HOME} printf printf
+-eu done then /usr/bin done readonly echo -eu echo cd | printf
+--verbose "$@" | echo grep $(pwd) -eu export 'quoted text' && -eu local done awk
+cd echo /usr/bin -eu "$1" | /usr/bin x=1 "$@" local sed ${HOME} cd readonly
+		2>/dev/null && done awk /usr/bin echo
+local $(pwd) export 2>/dev/null 2>/dev/null 'quoted text' printf | --verbose
+	2>/dev/null awk $(pwd) && echo grep /usr/bin "$1" then ${HOME} grep echo
+	echo echo "$1" awk sed 'quoted text'
+	awk cd "$@" "$1" 2>/dev/null done --verbose ${HOME} 2>/dev/null awk awk x=1 -eu
+	echo "$@" --verbose done && -eu awk echo
+		test sed "$@" grep awk ${HOME} 2>/dev/null echo /usr/bin | $(pwd) "$1"
+"$@" test --verbose grep "$@" | | grep export cd test test "$@" | 2>/dev/null 2>/dev/null
+		'quoted text' 'quoted text' && printf export 'quoted text'
+		&& local printf 2>/dev/null ${HOME} export
+		awk $(pwd) --verbose awk sed $(pwd) | "$@" readonly | export
+test --verbose -eu awk && "$@" export grep done && | printf --verbose
+export 2>/dev/null 2>/dev/null
+		x=1 "$@" x=1 readonly --verbose readonly /usr/bin /usr/bin x=1 export cd
+	x=1 && printf then /usr/bin --verbose test done x=1 | then --verbose
+"$1" local sed sed printf x=1 printf sed "$1" then echo "$@" |
+		echo test local export echo sed cd $(pwd) then ${HOME}
+	then printf local printf export "$@" local $(pwd)
+	test cd "$@" printf local 2>/dev/null 2>/dev/null | printf | &&
+		export echo /usr/bin sed awk ${HOME} $(pwd) | export
+	2>/dev/null ${HOME} awk "$@" 2>/dev/null && ${HOME}
+	/usr/bin | "$1" awk test
+		awk 'quoted text' test -eu
+		${HOME} | $(pwd) sed | echo cd
+	echo grep x=1 2>/dev/null printf 2>/dev/null test
+		awk ${HOME} test done /usr/bin test -eu ${HOME} awk ${HOME} then
+		test cd "$@" awk export | then then done
+	| "$1" awk /usr/bin /usr/bin
+	done awk grep export 'quoted text' awk && export
+		readonly $(pwd) --verbose
+awk --verbose x=1 cd "$@" done cd cd local done then /usr/bin grep
+	then grep printf export done echo readonly echo
+		cd sed then readonly "$@" "$1" |
+"$@" awk then "$1" ${HOME} done 'quoted text' readonly then -eu -eu
+	x=1 'quoted text' /usr/bin local test $(pwd) /usr/bin x=1 "$1"
+local done grep 2>/dev/null test test
+		sed readonly awk printf cd export
+	x=1 'quoted text' cd "$1" then
+	test | /usr/bin && readonly cd | 2>/dev/null && 2>/dev/null awk /usr/bin | --verbose
+readonly --verbose && local "$@" ${HOME} --verbose test printf
+		local && printf 2>/dev/null
+		--verbose "$1" && export /usr/bin 2>/dev/null then done sed && test 'quoted text'
+	${HOME} /usr/bin printf printf --verbose 2>/dev/null | done local then
+	grep && --verbose && ${HOME} readonly awk export done && "$1" --verbose awk echo
+x=1 export 2>/dev/null 'quoted text' "$1" && test "$1" --verbose 'quoted text'
+	done test -eu echo export test readonly
+| ${HOME} "$@" sed /usr/bin --verbose ${HOME} -eu /usr/bin /usr/bin 2>/dev/null
+	-eu grep local local export test
+	readonly -eu done sed echo /usr/bin local cd export export grep local
+/usr/bin 2>/dev/null readonly readonly
+	grep readonly cd local done awk --verbose export printf test test -eu 2>/dev/null
+	2>/dev/null | grep ${HOME} grep then test test -eu grep
+readonly 'quoted text' awk -eu ${HOME} ${HOME}
+export 2>/dev/null ${HOME} sed "$@" --verbose && test readonly echo
+		grep readonly -eu ${HOME} sed grep test 2>/dev/null
+&& then then "$@" export awk readonly cd "$1" x=1 grep
+	"$1" awk done | -eu readonly 'quoted text'
+	test ${HOME} --verbose then done then ${HOME} x=1 -eu cd printf && x=1 sed
+	x=1 then /usr/bin ${HOME} awk -eu -eu awk awk ${HOME} 2>/dev/null
+	${HOME} 2>/dev/null ${HOME} local x=1 | && $(pwd) awk 2>/dev/null
+2>/dev/null 2>/dev/null ${HOME} ${HOME} | "$1" -eu grep -eu $(pwd) done
+	"$@" --verbose awk local export ${HOME} /usr/bin then
+grep grep sed && 'quoted text' | echo
+		2>/dev/null 'quoted text' && awk printf sed && done
+--verbose /usr/bin test /usr/bin "$1" awk ${HOME}
+	&& /usr/bin printf "$1" && x=1 readonly readonly then
+		--verbose /usr/bin awk done printf cd then then $(pwd) readonly cd 2>/dev/null
+local cd grep done -eu done /usr/bin cd local printf done --verbose 2>/dev/null
+printf 'quoted text' printf sed
+		&& "$@" test && && /usr/bin -eu ${HOME}
+x=1 ${HOME} | sed 'quoted text' done x=1 2>/dev/null ${HOME} local
+--verbose 2>/dev/null grep echo test $(pwd) | "$@" 'quoted text'
+readonly "$@" && ${HOME} awk 'quoted text'
+	printf ${HOME} 'quoted text'
+		&& then && grep 2>/dev/null test cd ${HOME}
+		readonly cd local && 'quoted text' sed | printf then awk test
+		done /usr/bin done echo
+	--verbose "$@" -eu cd local
+	awk "$1" test -eu done then then local -eu --verbose | x=1
+printf && awk grep local export then $(pwd)
+		echo printf echo -eu export then
+	printf readonly 'quoted text' "$1"
+		'quoted text' $(pwd) "$1" "$1" && x=1 "$1" "$@" -eu export "$@" local readonly
+		sed 'quoted text' $(pwd) | x=1
+export 'quoted text' 2>/dev/null grep $(pwd) && then x=1 then printf cd --verbose
+		2>/dev/null export && --verbose local export
+		cd ${HOME} | 2>/dev/null then -eu ${HOME} done
+-eu awk && "$1" sed | | then --verbose
+cd && /usr/bin ${HOME} $(pwd) x=1 | /usr/bin x=1
+then printf "$1" | then 'quoted text' $(pwd) readonly 2>/dev/null then
+	"$1" x=1 readonly -eu then local | $(pwd) export printf "$@" /usr/bin awk
+		printf 'quoted text' "$@" "$@"
+	"$1" --verbose grep $(pwd) --verbose
+	test -eu readonly /usr/bin --verbose
+"$1" printf printf export "$@" | done printf ${HOME} local 2>/dev/null awk --verbose
+	"$1" readonly && && -eu x=1 | /usr/bin echo
+printf 'quoted text' then $(pwd) local /usr/bin
+	sed "$1" test --verbose printf test echo --verbose 2>/dev/null x=1 -eu
+		sed "$@" awk ${HOME} -eu --verbose 'quoted text'
+	${HOME} -eu printf printf export -eu done cd |
+		/usr/bin "$@" "$1" "$1" echo /usr/bin test export x=1
+		grep local $(pwd) grep $(pwd) printf printf awk --verbose
+2>/dev/null then 2>/dev/null | export /usr/bin /usr/bin
+		&& "$@" x=1 $(pwd) then done cd && test x=1 then ${HOME}
+	readonly local $(pwd) done | /usr/bin
+		"$1" 'quoted text' 'quoted text' "$@" echo sed printf sed "$@" local
+		"$@" cd printf /usr/bin 'quoted text' export
+	x=1 && sed x=1 2>/dev/null readonly
+then done 2>/dev/null then -eu --verbose
+	| readonly test grep test && test | sed local test $(pwd) printf 2>/dev/null $(pwd)
+'quoted text' awk local local awk $(pwd)
+		${HOME} echo cd then /usr/bin then echo export --verbose 2>/dev/null echo
+	-eu ${HOME} -eu && awk -eu grep
+	2>/dev/null && echo 2>/dev/null
+	grep printf export -eu export awk local 'quoted text' ${HOME} cd 'quoted text' 'quoted text'
+	2>/dev/null local printf awk sed test && && -eu | awk && readonly
+grep 2>/dev/null printf export 2>/dev/null "$1"
+		sed | x=1 | sed test export
+"$@" $(pwd) -eu printf export export
+	export awk && grep $(pwd) && 'quoted text' ${HOME}
+2>/dev/null "$@" --verbose awk awk printf -eu
+awk local "$1" -eu | 2>/dev/null x=1 "$@" "$@" &&
+		cd echo cd -eu test -eu sed local
+	then then --verbose grep printf
+	x=1 printf | | | && ${HOME} && local -eu 'quoted text' awk && && sed export
+		readonly | 'quoted text' then 2>/dev/null "$@" -eu -eu --verbose "$@"
+awk then printf -eu done test printf local /usr/bin 2>/dev/null
+	| /usr/bin sed --verbose test test awk sed "$@" | $(pwd) "$@"
+	${HOME} awk 2>/dev/null test echo --verbose echo -eu grep
+sed export then export x=1 -eu
+done echo echo /usr/bin
+		test cd echo --verbose local && && "$@" ${HOME} -eu sed
+		then readonly then && echo && local cd echo --verbose awk "$1" 2>/dev/null
+		x=1 'quoted text' ${HOME} export 'quoted text' && x=1 grep export export
+	"$@" printf readonly "$1" "$1" then echo
+		--verbose grep local --verbose done readonly --verbose cd "$@" grep readonly grep
+	&& --verbose cd sed 2>/dev/null
+	local ${HOME} $(pwd) && export $(pwd) done test | awk 2>/dev/null test $(pwd)
+		"$1" done readonly printf sed x=1 $(pwd)
+	/usr/bin echo cd | ${HOME} readonly | local awk
+		cd echo sed 'quoted text' && x=1 echo sed grep cd 2>/dev/null done
+	export export -eu $(pwd) local ${HOME} "$1" cd | 2>/dev/null ${HOME}
+	grep 'quoted text' 'quoted text' && export
+'quoted text' | export --verbose 'quoted text' $(pwd) export 'quoted text'
+"$@" x=1 -eu "$1" /usr/bin done "$1" test test printf "$@"
+then echo ${HOME} 'quoted text' sed "$@" local export | then cd &&
+		printf sed /usr/bin awk done sed "$1" "$1" -eu | 'quoted text' cd /usr/bin printf
+awk "$@" 2>/dev/null cd | grep "$1" echo local
+	echo $(pwd) export | awk test local 'quoted text' && "$@" ${HOME} readonly
+		--verbose "$@" | export then then ${HOME} awk ${HOME} awk readonly 'quoted text'
+"$1" awk 'quoted text' readonly
+		awk x=1 /usr/bin ${HOME} | echo printf grep sed sed export echo printf
+		${HOME} printf "$1" readonly --verbose "$1"
+	grep "$1" "$@" "$@" grep ${HOME} "$1"
+"$1" ${HOME} sed 2>/dev/null echo ${HOME} awk cd $(pwd) "$@" $(pwd)
+--verbose 'quoted text' done
+		printf readonly test printf
+		echo cd -eu x=1 then local ${HOME} 2>/dev/null done $(pwd) ${HOME}
+		'quoted text' test /usr/bin -eu --verbose "$@" awk awk sed cd --verbose echo x=1
+		local echo && sed /usr/bin | readonly "$@" ${HOME} "$1" 'quoted text'
+		&& export local && --verbose "$@" cd "$1" ${HOME} echo then grep
+cd cd | $(pwd) cd && $(pwd) readonly && local echo then --verbose -eu ${HOME}
+		printf $(pwd) echo cd echo then -eu ${HOME} 2>/dev/null 2>/dev/null cd then then
+"$1" -eu sed test -eu done /usr/bin local --verbose export /usr/bin
+	-eu | printf x=1 test "$@" test 2>/dev/null /usr/bin x=1 -eu export x=1 $(pwd)
+		-eu ${HOME} printf -eu
+	test readonly $(pwd)
+		done test ${HOME} /usr/bin
+		'quoted text' done x=1 && grep --verbose "$1" x=1 local --verbose echo done
+	printf grep -eu "$1" /usr/bin awk cd echo export | && export readonly
+		sed export -eu --verbose /usr/bin
+		readonly printf -eu done readonly "$@" $(pwd) printf
+		then cd awk "$@" cd "$1" /usr/bin | printf x=1
+	2>/dev/null awk && echo local test --verbose readonly
+sed then --verbose readonly --verbose "$1" 2>/dev/null sed
+	done -eu done 'quoted text' export ${HOME} "$1" readonly x=1 done then -eu
+		--verbose then grep /usr/bin cd /usr/bin
+	${HOME} /usr/bin x=1 readonly 'quoted text' 2>/dev/null
+echo x=1 && printf cd grep 'quoted text'
+		done /usr/bin $(pwd) sed then -eu 'quoted text' cd ${HOME} --verbose $(pwd) cd
+	&& x=1 sed grep readonly test
+'quoted text' 2>/dev/null then printf awk --verbose grep export grep "$@" "$@"
+'quoted text' ${HOME} /usr/bin -eu /usr/bin "$@"
+	sed cd then then 2>/dev/null readonly then then done /usr/bin "$1" $(pwd)
+	'quoted text' $(pwd) printf echo $(pwd) awk $(pwd) $(pwd) grep
+		readonly 'quoted text' /usr/bin
+	/usr/bin $(pwd) "$@" "$@" awk 2>/dev/null
+		x=1 /usr/bin --verbose cd $(pwd) 2>/dev/null x=1 "$1" cd 2>/dev/null
+	echo export export | done printf | done | then
+"$@" local && 'quoted text' sed x=1 test && $(pwd)
+		test echo sed | "$@" 2>/dev/null
+local | cd "$1" ${HOME} awk x=1
+&& done cd -eu 'quoted text' 'quoted text' ${HOME} x=1
+	'quoted text' 'quoted text' export 'quoted text' then ${HOME}
+	-eu $(pwd) local grep -eu --verbose awk -eu then printf ${HOME} ${HOME} 2>/dev/null
+&& readonly 2>/dev/null then then /usr/bin | "$@" printf
+2>/dev/null /usr/bin done /usr/bin 2>/dev/null "$1" 2>/dev/null --verbose | printf
+| test x=1 /usr/bin --verbose
+x=1 test "$@" /usr/bin grep
+	$(pwd) done 'quoted text' export | x=1 test
+| "$@" "$@" printf test 'quoted text' sed x=1 --verbose
+		then $(pwd) -eu test 'quoted text' readonly then
+	-eu export $(pwd) -eu x=1 cd local printf && | awk test -eu | | local echo test
+		sed "$@" cd 2>/dev/null 'quoted text' echo grep done "$@" && local --verbose
+echo test done -eu x=1 local echo "$@" grep -eu test export
+		sed /usr/bin cd sed local "$1" && test readonly echo /usr/bin
+'quoted text' test x=1 readonly printf --verbose then ${HOME} -eu
+		grep 2>/dev/null done && | -eu local -eu x=1 ${HOME}
+2>/dev/null awk readonly local --verbose | | sed /usr/bin
+		then then readonly echo x=1 local | x=1 export awk
+--verbose then x=1 grep export "$1" local $(pwd)
+		done && sed 2>/dev/null 'quoted text' -eu test
+	cd /usr/bin "$1" && readonly ${HOME} -eu test 'quoted text'
+"$1" 'quoted text' awk /usr/bin echo
+		echo awk printf x=1 echo /usr/bin then done done done | local then cd $(pwd)
+	&& readonly then "$1" echo export --verbose && grep -eu local $(pwd) && cd sed
+	x=1 --verbose then 'quoted text' "$@" done | printf
+x=1 -eu --verbose then printf cd x=1 then --verbose
+export | --verbose test x=1 export cd printf
+		awk --verbose x=1 printf -eu test && $(pwd) "$@" /usr/bin
+then x=1 "$1" export 'quoted text'
+		done readonly ${HOME} echo x=1 test
+	'quoted text' 'quoted text' $(pwd) local 2>/dev/null awk done sed
+then test "$1" awk awk "$1" ${HOME} && "$@" x=1 cd
+	"$@" && local then sed "$1" echo then "$1" grep cd printf then -eu
+x=1 2>/dev/null /usr/bin awk then 'quoted text' readonly
+		readonly readonly test cd done "$@" sed --verbose /usr/bin export
+	grep 2>/dev/null ${HOME} done sed 'quoted text' 2>/dev/null
+		-eu done /usr/bin 2>/dev/null
+		sed 2>/dev/null then "$@" sed 2>/dev/null 'quoted text' printf awk |
+echo 'quoted text' printf 'quoted text'
+		awk $(pwd) /usr/bin && awk export ${HOME} $(pwd) grep && $(pwd) $(pwd) "$@" /usr/bin
+		x=1 x=1 readonly /usr/bin sed 2>/dev/null test $(pwd) grep &&
+		"$1" 2>/dev/null -eu "$1" readonly "$@" "$1" test awk local cd "$@" $(pwd)
+	test local 2>/dev/null awk then $(pwd) then --verbose then
+		--verbose $(pwd) 'quoted text'
+	grep sed grep cd -eu test sed awk awk -eu "$@" local printf ${HOME} echo
+	awk /usr/bin printf awk sed --verbose readonly --verbose
+grep cd local test "$@" export /usr/bin
+		2>/dev/null "$@" grep cd /usr/bin "$@" sed local 2>/dev/null then $(pwd) | 2>/dev/null
+		sed export && ${HOME} -eu x=1
+	"$1" sed printf sed printf export
+		/usr/bin cd 2>/dev/null ${HOME} done local then ${HOME} $(pwd) 'quoted text'
+		printf test awk && -eu x=1 readonly "$1"
+		awk done x=1 | done x=1 "$@" $(pwd) --verbose awk test 'quoted text' -eu
+	done /usr/bin | then ${HOME} local ${HOME} echo printf
+printf $(pwd) "$@" then test then $(pwd) export done cd x=1 -eu cd cd export export
+--verbose 'quoted text' then
+echo /usr/bin -eu 2>/dev/null 'quoted text' readonly 2>/dev/null then grep cd printf
+		"$@" && test /usr/bin && ${HOME} export
+"$@" local test -eu -eu && export x=1 awk awk $(pwd) export x=1 readonly
+		readonly ${HOME} awk --verbose
+"$@" | --verbose /usr/bin && cd --verbose 2>/dev/null "$@" 'quoted text' local
+		sed | | "$@" 'quoted text' export test done printf
+		awk cd x=1 $(pwd) grep readonly local export
+${HOME} export echo done 'quoted text' cd x=1 "$@" --verbose 'quoted text'
+	'quoted text' ${HOME} -eu --verbose
+grep done cd echo export ${HOME} /usr/bin
+		/usr/bin && done && done "$@" local test x=1 grep grep && then
+		then "$@" done 'quoted text' readonly test x=1 local "$1" && && grep "$1" "$@"
+	/usr/bin 2>/dev/null $(pwd) | readonly export
+	echo awk --verbose grep | 'quoted text' 'quoted text'
+	'quoted text' "$@" readonly
+		readonly 'quoted text' x=1 2>/dev/null awk -eu --verbose then && 'quoted text'
+	'quoted text' | export --verbose --verbose x=1 && 'quoted text' grep printf
+&& -eu --verbose done export && && "$1"
+		test --verbose ${HOME} export -eu cd sed grep echo awk "$1"
+x=1 && printf 2>/dev/null
+"$@" export export /usr/bin /usr/bin cd awk sed
+/usr/bin cd local printf "$@" --verbose x=1 sed done grep grep 'quoted text'
+	done 2>/dev/null test x=1 awk printf readonly awk "$1" grep then readonly
+		test readonly 2>/dev/null cd $(pwd) awk done grep
+		"$1" grep 'quoted text' 2>/dev/null readonly
+	echo export awk && readonly cd then && |
+grep local readonly printf -eu | sed | sed ${HOME}
+test ${HOME} awk done export export ${HOME} sed cd && ${HOME}
+	${HOME} sed | grep "$@" then export 2>/dev/null 'quoted text' done /usr/bin 2>/dev/null
+		/usr/bin 'quoted text' /usr/bin x=1 ${HOME}
+	${HOME} test test x=1 test x=1 local 2>/dev/null done 'quoted text'
+		grep local then | grep && -eu | cd then 2>/dev/null readonly echo
+	export -eu echo && && && local local
+		sed && done echo test grep echo grep awk x=1 /usr/bin x=1 x=1 readonly
+		$(pwd) local sed cd echo 'quoted text' "$1" cd x=1 && $(pwd) printf
+	$(pwd) --verbose local 'quoted text' printf x=1 local grep
+	"$@" grep 'quoted text' | local sed done printf 2>/dev/null echo /usr/bin
+'quoted text' readonly ${HOME} done 'quoted text' x=1 /usr/bin x=1 echo export
+local /usr/bin $(pwd) readonly
+2>/dev/null readonly -eu local x=1 local 2>/dev/null && && "$1"
+		&& readonly cd sed done "$@" then 2>/dev/null awk then x=1 readonly x=1 awk
+test done | done /usr/bin cd ${HOME} 'quoted text' "$@"
+		echo /usr/bin sed cd test -eu --verbose && --verbose
+		--verbose && local && | $(pwd) && echo ${HOME} awk
+--verbose export readonly && readonly && $(pwd) /usr/bin readonly
+		cd test ${HOME} 'quoted text' x=1 ${HOME} sed "$1" /usr/bin x=1 x=1 export
+$(pwd) cd cd awk $(pwd) printf then cd && test ${HOME} "$@" ${HOME} 2>/dev/null
+		| test cd $(pwd) export x=1 "$@"
+| then echo test "$1" --verbose done "$1" grep && "$1" sed "$@" && printf
+	'quoted text' 'quoted text' x=1 "$@" x=1 $(pwd) 'quoted text'
+		local -eu then done 'quoted text' printf readonly && $(pwd) then "$1" 2>/dev/null
+awk grep "$1" test --verbose local | | "$@" done 'quoted text' sed --verbose
+readonly test | cd done -eu /usr/bin
+	--verbose local printf cd ${HOME} /usr/bin /usr/bin
+test then test && /usr/bin | readonly && awk
+readonly cd 2>/dev/null export sed "$1" local done 2>/dev/null readonly grep grep
+'quoted text' $(pwd) "$@" local /usr/bin sed -eu cd printf done
+		test 'quoted text' sed local &&
+then x=1 $(pwd) | "$1" export x=1 local x=1
+	cd grep ${HOME} && $(pwd) test echo x=1 printf test printf awk
+		&& $(pwd) readonly $(pwd) done 'quoted text' --verbose | awk
+echo | sed awk local printf awk sed grep 2>/dev/null ${HOME} 'quoted text'
+--verbose export -eu readonly local /usr/bin done --verbose readonly && |
+done printf && sed readonly then "$@"
+		awk sed && then done /usr/bin
+awk printf $(pwd) export && cd sed "$1" 'quoted text' then then ${HOME}
+		export "$1" local grep test done /usr/bin /usr/bin --verbose done
+-eu awk cd export printf "$@" "$1" awk $(pwd) /usr/bin sed test export printf readonly
+	-eu "$@" "$1" -eu $(pwd) test export $(pwd) --verbose awk /usr/bin "$1"
+	-eu && && 'quoted text' then /usr/bin awk readonly test printf awk test cd /usr/bin
+x=1 then printf export | echo local grep /usr/bin --verbose
+done local "$1" $(pwd) $(pwd) awk awk -eu &&
+	2>/dev/null grep && echo | |
+		cd $(pwd) --verbose test 'quoted text'
+-eu -eu local && echo grep readonly /usr/bin readonly echo done "$1" x=1 sed
+${HOME} export 'quoted text' "$@" "$@" awk test | done grep 'quoted text' -eu
+cd x=1 cd ${HOME} export 'quoted text' printf local then readonly ${HOME} local
+	awk then | --verbose echo && | export && then test --verbose export --verbose
+	readonly awk 2>/dev/null "$@" awk awk test --verbose 'quoted text' ${HOME} && grep
+/usr/bin cd done && /usr/bin --verbose /usr/bin cd 2>/dev/null sed ${HOME}
+	$(pwd) local sed -eu export printf then -eu grep "$@" printf export 2>/dev/null
+		test $(pwd) $(pwd) readonly export readonly ${HOME}
+		readonly export ${HOME} sed
+local done "$@" -eu --verbose cd ${HOME} local 2>/dev/null
+	grep cd "$@" "$1" cd local export
+	then | readonly cd printf readonly awk x=1 "$1" ${HOME} ${HOME} 2>/dev/null
+	/usr/bin /usr/bin 'quoted text' "$1" grep
+		then $(pwd) /usr/bin $(pwd) then sed done -eu grep 2>/dev/null export grep -eu
+		&& readonly export --verbose echo x=1 echo ${HOME} printf && grep local
+	"$1" 2>/dev/null local |
+		cd ${HOME} 2>/dev/null test x=1 then "$1" test sed && test export
+awk cd x=1 $(pwd) x=1 awk 'quoted text' test done
+		--verbose grep readonly 2>/dev/null grep 'quoted text' local ${HOME}
+	/usr/bin test cd --verbose ${HOME} echo grep -eu | test ${HOME}
+	printf x=1 2>/dev/null export sed /usr/bin x=1
+	readonly echo && --verbose "$@" /usr/bin ${HOME} printf -eu done test
+		local grep 2>/dev/null && sed echo test ${HOME} "$1" ${HOME} grep
+	| 'quoted text' 2>/dev/null && x=1 sed test printf
+	x=1 $(pwd) --verbose && grep done cd then
+		/usr/bin "$1" cd then ${HOME}
+cd test 2>/dev/null printf $(pwd)
+grep /usr/bin && --verbose local
+2>/dev/null "$@" -eu | echo | test
+grep "$1" ${HOME} /usr/bin
+		then --verbose local $(pwd) 'quoted text' local |
+'quoted text' x=1 "$@" cd then readonly "$@"
+-eu export ${HOME} -eu -eu x=1 awk -eu 2>/dev/null awk grep export
+		$(pwd) $(pwd) test done readonly $(pwd) local awk printf
+echo readonly then awk --verbose && echo /usr/bin readonly echo
+	then 'quoted text' echo sed -eu sed done -eu printf sed x=1 export grep ${HOME}
+	export export | test x=1 cd /usr/bin "$1" readonly
+${HOME} done grep printf cd awk 'quoted text' echo | cd then awk export
+grep -eu ${HOME} sed 2>/dev/null
+		done then then ${HOME} readonly
+	awk --verbose ${HOME} test test
+		"$1" && sed echo readonly done test grep
+	grep "$@" x=1 test done
+		then grep test then awk then ${HOME} done export awk test x=1 readonly
+	x=1 local /usr/bin test then
+local readonly | test then /usr/bin sed test -eu echo x=1
+	echo test awk printf && --verbose echo
+		"$@" printf "$@" "$1" 2>/dev/null
+	-eu | $(pwd) | 'quoted text' grep 2>/dev/null 2>/dev/null done test grep $(pwd)
+	printf x=1 ${HOME} | done printf /usr/bin --verbose cd sed awk export
+test export "$1" "$1" --verbose ${HOME} cd awk sed 2>/dev/null
+done | cd $(pwd) test cd
+		"$@" --verbose "$1" sed 2>/dev/null
+	local echo -eu awk cd awk 'quoted text'
+		--verbose awk 2>/dev/null && cd
+		cd done awk $(pwd) 'quoted text' x=1
+	then done echo grep /usr/bin cd 2>/dev/null
+		readonly sed $(pwd) printf
+		done echo && readonly awk printf "$1" readonly --verbose
+	export sed sed --verbose grep ${HOME}
+		--verbose export sed ${HOME} printf 'quoted text' | export
+	awk $(pwd) export export && --verbose
+printf test export grep $(pwd) readonly export
+"$@" export sed "$@" cd /usr/bin "$@" "$@" readonly awk
+	&& printf $(pwd) /usr/bin --verbose done "$1" "$@" && done x=1 sed
+printf awk /usr/bin -eu 'quoted text' -eu ${HOME} grep grep
+		done -eu printf local /usr/bin --verbose
+echo -eu printf test --verbose "$@" local
+"$1" "$1" | $(pwd) test grep echo ${HOME} cd awk sed "$1" &&
+	awk sed done x=1 /usr/bin cd 'quoted text' then | 'quoted text' ${HOME}
+done x=1 readonly done sed ${HOME} export &&
+	cd x=1 echo done printf printf echo cd export
+-eu export && -eu $(pwd) printf echo --verbose done then | echo readonly
+	${HOME} local readonly printf "$1" printf readonly x=1 /usr/bin
+2>/dev/null local "$1" echo
+		readonly "$1" 2>/dev/null then && grep "$1" x=1 test test --verbose "$@" awk
+	awk 2>/dev/null 'quoted text' cd grep 2>/dev/null printf test sed readonly
+readonly then $(pwd) $(pwd) export -eu "$@" ${HOME} printf
+	-eu cd printf | done grep grep
+-eu grep "$1" && x=1 export 2>/dev/null test local 2>/dev/null
+		| then export "$1" cd then -eu "$@"
+		test echo done awk grep printf "$1"
+		"$@" --verbose printf 2>/dev/null local -eu test grep -eu printf "$@" /usr/bin
+	| -eu sed 2>/dev/null 2>/dev/null -eu "$1" awk -eu && | then $(pwd) sed
+awk sed 'quoted text' x=1 cd echo -eu --verbose "$@"
+		"$@" 'quoted text' readonly ${HOME}
+	local $(pwd) 'quoted text' then
+	&& local "$1" printf -eu echo readonly
+done && "$@" echo && done
+		--verbose 'quoted text' --verbose "$1" "$1" 'quoted text'
+		--verbose printf export then grep local "$@"
+	readonly x=1 cd readonly && grep /usr/bin printf
+	sed && "$@" local test done test x=1 readonly done /usr/bin 'quoted text'
+/usr/bin grep x=1 $(pwd) local
+#include c212.sh
+	/usr/bin /usr/bin grep 'quoted text' then && printf |
+	awk 'quoted text' "$1" sed sed done |
+2>/dev/null ${HOME} awk then then grep
+	-eu -eu grep echo 'quoted text'
+		'quoted text' x=1 --verbose
+	"$@" then cd && "$1" awk test test 2>/dev/null readonly echo export "$1"
+cd awk -eu test "$1" grep 2>/dev/null /usr/bin x=1 sed | local printf -eu
+then grep done grep then ${HOME} readonly export readonly then test "$1"
+$(pwd) $(pwd) 2>/dev/null
+		sed x=1 sed x=1 x=1 local
+readonly grep "$@" 'quoted text' $(pwd) echo then -eu && done 'quoted text'
+	/usr/bin sed done then | cd 'quoted text' export "$1" printf readonly | test
+	$(pwd) grep done local done done printf awk export | x=1 "$@"
+	local $(pwd) /usr/bin
+	'quoted text' readonly && --verbose sed test sed 'quoted text' ${HOME}
+	| then -eu export echo 2>/dev/null | printf 2>/dev/null
+2>/dev/null "$1" grep "$1" awk then ${HOME} $(pwd) cd
+	sed x=1 /usr/bin | /usr/bin -eu x=1 "$@" /usr/bin
+	"$@" --verbose $(pwd) printf "$1"
+		awk done $(pwd) 'quoted text' cd "$@" $(pwd) local 'quoted text'
+-eu x=1 2>/dev/null /usr/bin "$1"
+		sed export -eu then -eu grep then 'quoted text' then -eu -eu 2>/dev/null
+	printf | 2>/dev/null /usr/bin /usr/bin -eu test "$@" echo echo "$1" readonly
+-eu x=1 grep x=1 then $(pwd)
+	&& sed local ${HOME} 'quoted text' /usr/bin 2>/dev/null
+echo printf $(pwd) x=1 ${HOME} readonly --verbose cd "$@" ${HOME} 'quoted text'
+sed sed && grep x=1 echo cd sed $(pwd) readonly printf then sed echo
+	${HOME} done -eu test -eu ${HOME}
+		| grep cd local echo grep 'quoted text'
+		sed /usr/bin done cd "$@" ${HOME} then -eu printf awk printf /usr/bin
+		2>/dev/null export $(pwd) awk | "$1" cd $(pwd) export | $(pwd) "$@" "$@"
+	printf cd then x=1 awk done printf awk "$1" $(pwd) -eu 'quoted text'
+	-eu $(pwd) "$1" local $(pwd) $(pwd) $(pwd) echo
+	printf grep 2>/dev/null printf test
+		grep $(pwd) 'quoted text' awk export
+		readonly | cd done 2>/dev/null 2>/dev/null /usr/bin --verbose
+	echo "$1" && ${HOME} | done x=1 echo | && | grep 2>/dev/null
+	cd echo "$1" then local export then
+		${HOME} -eu awk awk ${HOME} grep export 2>/dev/null grep 'quoted text'
+	local 2>/dev/null readonly cd $(pwd) printf done printf
+		test grep 'quoted text' 'quoted text' readonly test done readonly
+grep export awk done test --verbose
+	sed $(pwd) readonly local /usr/bin
+		readonly export export 2>/dev/null && test x=1
+	export "$@" | echo grep 'quoted text' && cd local printf | && -eu
+	local -eu 'quoted text' done
+		$(pwd) sed "$@" 'quoted text'
+		export "$@" "$1" sed -eu export then | && /usr/bin $(pwd) test printf printf --verbose
+		done && then && echo readonly cd
+test ${HOME} readonly $(pwd) ${HOME}
+	x=1 -eu 'quoted text' grep
+	"$1" then $(pwd) "$@" cd
+	echo sed printf grep --verbose local cd ${HOME} 2>/dev/null
+	test echo --verbose then then done sed --verbose "$1" printf "$@"
+'quoted text' export $(pwd) then then $(pwd) done ${HOME} export test cd
+&& awk && readonly readonly cd readonly
+		${HOME} 2>/dev/null then && then awk ${HOME} sed then $(pwd)
+	'quoted text' cd ${HOME} sed --verbose 2>/dev/null | --verbose x=1 export then
+	grep $(pwd) test then export "$@" awk sed awk awk | echo echo cd
+		test echo readonly 2>/dev/null "$@" | 2>/dev/null readonly
+	--verbose sed -eu /usr/bin -eu
+printf $(pwd) cd "$@" "$@" local test "$@" local x=1 echo then ${HOME}
+awk | $(pwd) /usr/bin test 2>/dev/null --verbose | readonly /usr/bin && 2>/dev/null
+		/usr/bin | 'quoted text' readonly readonly "$@" ${HOME}
+	'quoted text' --verbose sed sed grep "$1" -eu local cd then $(pwd) sed -eu "$1"
+	sed "$1" test 'quoted text'
+		readonly --verbose cd
+		-eu -eu sed then test x=1 local grep && then $(pwd) /usr/bin
+		printf sed 2>/dev/null awk grep 'quoted text' 'quoted text'
+"$@" 'quoted text' grep ${HOME} && then sed printf then --verbose $(pwd)
+local export then /usr/bin | -eu echo "$1" sed 2>/dev/null
+	x=1 grep readonly -eu 2>/dev/null && "$1" x=1 x=1 done cd "$@"
+	cd ${HOME} test sed "$@" sed "$1" --verbose
+sed grep --verbose x=1 $(pwd) export -eu $(pwd)
+		readonly export x=1 done 'quoted text'
+export sed readonly /usr/bin printf
+		x=1 2>/dev/null grep done && test "$@" awk readonly -eu cd
+	sed cd done /usr/bin /usr/bin --verbose
+awk cd "$@" awk awk grep && readonly cd $(pwd) echo ${HOME} --verbose
+printf "$1" x=1 -eu &&
+'quoted text' -eu printf printf then -eu readonly
+sed cd readonly /usr/bin printf readonly cd echo grep
+printf | test readonly readonly
+$(pwd) export sed 'quoted text' cd && echo printf && done grep done $(pwd) |
+readonly | readonly export "$1" | --verbose
+		$(pwd) awk then 'quoted text' sed "$1" | 2>/dev/null x=1 /usr/bin
+		${HOME} "$@" local export 2>/dev/null 'quoted text' &&
+test "$@" -eu "$1" local grep awk printf local awk printf
+		local printf grep "$1" | "$@" "$@" "$@" --verbose ${HOME} |
+		2>/dev/null cd then -eu $(pwd) awk grep grep -eu "$@" -eu export
+		'quoted text' readonly && && then done echo done
+		&& ${HOME} && 'quoted text' 'quoted text' "$1" grep
+readonly -eu local ${HOME}
+	"$1" 'quoted text' readonly test 'quoted text'
+		test "$1" 'quoted text'
+	sed cd x=1 $(pwd) echo | then 'quoted text'
+		--verbose "$1" readonly 'quoted text' "$@" then local
+		cd export 2>/dev/null --verbose "$1" grep local grep
+		grep /usr/bin printf printf cd 'quoted text'
+	then /usr/bin -eu done "$1" readonly readonly "$@" printf cd
+	grep export grep | x=1 "$@"
+then then cd -eu awk 'quoted text' x=1 test ${HOME} /usr/bin && export grep
+		done export "$@" awk x=1 --verbose x=1 echo echo cd && cd local
+	-eu "$@" 2>/dev/null "$1" local printf printf x=1 2>/dev/null printf $(pwd)
+		| local x=1 "$@" awk local printf $(pwd) export
+2>/dev/null awk awk x=1 && "$@" grep printf -eu
+	awk ${HOME} -eu "$@" && cd "$1"
+		${HOME} grep | readonly $(pwd) --verbose
+	echo && "$1" 2>/dev/null test test export printf -eu
+	sed grep --verbose readonly --verbose echo awk grep test | done
+		awk grep /usr/bin printf
+-eu then | export && cd printf awk grep $(pwd) awk done ${HOME}
+		2>/dev/null -eu local && printf && export printf
+	sed -eu printf && printf test
+awk 2>/dev/null x=1 ${HOME} export -eu x=1 echo ${HOME} | test -eu /usr/bin
+cd 'quoted text' echo ${HOME} echo then done cd x=1 local done readonly 'quoted text'
+	-eu && test && 'quoted text' 'quoted text' cd -eu
+		test 2>/dev/null && /usr/bin | ${HOME} && 'quoted text' local echo done "$1"
+	cd grep sed ${HOME} "$@" export grep awk grep -eu export "$1" &&
+	grep export 'quoted text'
+		done local | --verbose "$1" awk "$1" printf ${HOME}
+--verbose ${HOME} ${HOME}
+echo "$@" | -eu x=1 "$1" grep
+cd && /usr/bin ${HOME} ${HOME} test 'quoted text' x=1 | 'quoted text' x=1 $(pwd)
+		then grep done sed && --verbose cd $(pwd) --verbose && readonly
+		2>/dev/null 2>/dev/null awk cd 'quoted text' && "$@"
+		grep local "$@" x=1 printf done ${HOME} done
+		$(pwd) echo -eu done test "$1" grep done awk printf echo echo 'quoted text'
+		sed -eu -eu | local "$1"
+	"$1" ${HOME} readonly 'quoted text' -eu grep x=1 $(pwd) echo export
+awk export --verbose sed cd ${HOME} awk sed && echo done 2>/dev/null
+cd then sed --verbose awk
+"$1" x=1 export --verbose export printf && 'quoted text' export -eu
+	done then done awk export done cd test done grep $(pwd) &&
+awk done 2>/dev/null done echo 'quoted text' cd test printf
+	"$1" cd "$@" readonly -eu then
+--verbose done --verbose /usr/bin | 2>/dev/null
+	awk echo x=1 --verbose "$1"
+| "$1" $(pwd) /usr/bin cd -eu x=1 | test && printf readonly /usr/bin && /usr/bin
+	${HOME} printf $(pwd) --verbose --verbose echo printf "$1" 'quoted text'
+		local test x=1 done /usr/bin readonly --verbose cd "$@" readonly
+		local then test "$1" | | test "$1" printf echo --verbose
+	printf 2>/dev/null $(pwd) "$@" done cd
+	sed done && x=1 2>/dev/null
+--verbose awk readonly
+	-eu sed --verbose ${HOME} 'quoted text'
+export --verbose grep cd x=1 export local export awk /usr/bin $(pwd)
+		/usr/bin export $(pwd) echo awk then readonly printf "$1" "$1" -eu then &&
+&& -eu test then "$@" -eu awk echo then grep
+		awk "$@" && test && readonly $(pwd) echo grep export -eu ${HOME} awk | -eu
+	x=1 printf /usr/bin $(pwd) && "$@"
+		-eu -eu then test /usr/bin sed test | "$1" echo then
+		"$@" done && 2>/dev/null "$1" done grep local /usr/bin
+sed "$1" echo "$@" local readonly x=1 ${HOME}
+		awk awk export done then cd "$1" export && $(pwd) ${HOME} $(pwd) printf
+		export x=1 "$@" && "$1" x=1 sed local "$@" -eu
+		awk "$@" ${HOME} x=1 | | echo "$@"
+grep --verbose echo --verbose /usr/bin
+	cd "$1" export $(pwd) then test grep 2>/dev/null "$@"
+		test sed --verbose grep done then $(pwd) "$@" && | 'quoted text'
+	export printf done echo awk x=1 then
+&& sed "$@" $(pwd) local --verbose --verbose cd && "$1" printf 2>/dev/null
+		/usr/bin 2>/dev/null test done "$@" echo cd sed awk | then -eu export
+"$1" done 'quoted text' printf 2>/dev/null cd x=1 then "$1" then | local
+		'quoted text' then sed echo /usr/bin
+		'quoted text' "$1" x=1 && sed grep local 'quoted text'
+	2>/dev/null echo 'quoted text' then local printf /usr/bin
+	"$@" -eu $(pwd) grep x=1 export readonly $(pwd) 2>/dev/null done cd
+		--verbose readonly "$1" ${HOME}
+	echo local cd sed readonly | echo
+	sed | /usr/bin ${HOME} printf then x=1 echo sed 2>/dev/null /usr/bin "$@" done
+--verbose -eu cd && then test && export && awk printf 'quoted text' test echo
+	-eu x=1 -eu 2>/dev/null ${HOME} --verbose | echo $(pwd)
+	cd | $(pwd) cd sed export "$1" "$1" "$1" printf export export
+		then x=1 /usr/bin done 2>/dev/null test ${HOME}
+		-eu printf readonly cd printf && cd ${HOME} | done awk 2>/dev/null x=1 echo
+"$1" printf --verbose local then --verbose "$1" local && grep -eu /usr/bin readonly
+printf done /usr/bin x=1 sed then echo x=1 printf export ${HOME}
+	| done echo readonly 2>/dev/null test awk
+grep done test 2>/dev/null readonly export 'quoted text'
+		-eu --verbose sed ${HOME} 2>/dev/null 2>/dev/null 2>/dev/null
+	cd && /usr/bin ${HOME} export 'quoted text' x=1
+		'quoted text' export /usr/bin ${HOME} --verbose printf printf
+	export test export done
+${HOME} echo --verbose 2>/dev/null && ${HOME} test grep x=1 local && /usr/bin
+	$(pwd) x=1 export sed 2>/dev/null
+	'quoted text' export sed "$@"
+	-eu cd | grep cd /usr/bin grep -eu 2>/dev/null x=1 done $(pwd) x=1
+cd "$@" test ${HOME} test --verbose /usr/bin sed 2>/dev/null /usr/bin cd x=1
+		x=1 ${HOME} -eu 2>/dev/null ${HOME} then ${HOME} --verbose export | |
+		awk "$@" | grep | grep 2>/dev/null 2>/dev/null
+then "$@" test then local x=1 'quoted text' x=1 --verbose export
+		done 'quoted text' 2>/dev/null sed local done "$@" "$@" printf
+	&& readonly 'quoted text' done local local readonly /usr/bin export sed
+	${HOME} readonly $(pwd) && export cd $(pwd) 'quoted text' then export
+	awk export test 2>/dev/null readonly && $(pwd) test
+	2>/dev/null printf done export /usr/bin
+		awk --verbose then /usr/bin --verbose -eu test local 2>/dev/null "$1" 'quoted text'
+	then local "$@" done readonly && 'quoted text' | | printf x=1
+done | sed 'quoted text' $(pwd) --verbose then 2>/dev/null $(pwd) awk
+		sed | sed "$1" printf grep
+		done 'quoted text' echo --verbose
+		sed -eu && /usr/bin sed cd -eu cd then printf "$1" $(pwd) | sed
+		local cd --verbose printf "$1" 'quoted text' cd
+	&& printf test done awk
+grep grep 2>/dev/null then done then -eu ${HOME} --verbose
+	"$1" "$1" local $(pwd) printf
+		${HOME} then | test | 2>/dev/null grep grep local test
+grep awk -eu done 'quoted text' 2>/dev/null x=1 -eu ${HOME} readonly awk
+| then && sed export cd sed 'quoted text' export printf cd 2>/dev/null
+	'quoted text' test sed $(pwd) sed local 'quoted text' --verbose --verbose
+		'quoted text' grep "$1"
+	sed --verbose sed local echo done $(pwd)
+awk --verbose "$1" "$1" echo 2>/dev/null
+	| test local grep test x=1 x=1 $(pwd) && grep printf 2>/dev/null
+		/usr/bin test x=1 local 2>/dev/null | awk 'quoted text' grep echo x=1
+	x=1 sed ${HOME} "$1" 2>/dev/null /usr/bin
+grep sed echo awk | echo x=1 readonly printf
+		export echo --verbose cd 2>/dev/null
+'quoted text' cd export "$@" x=1 ${HOME} echo --verbose
+		sed 2>/dev/null printf awk done && -eu
+	echo sed done grep "$1" echo | "$1" /usr/bin 2>/dev/null then -eu
+--verbose && readonly test awk sed export "$@" export echo 2>/dev/null |
+	then 2>/dev/null 'quoted text' $(pwd) grep "$@" sed local test
+	"$@" echo done /usr/bin local test export "$1" cd x=1 local
+	-eu "$1" sed --verbose $(pwd)
+	local 'quoted text' "$1" done grep then ${HOME} --verbose
+	local awk awk ${HOME} readonly awk cd readonly grep 2>/dev/null
+2>/dev/null readonly | export
+		cd export "$@" printf test --verbose /usr/bin echo
+		done ${HOME} cd | test "$1" cd && ${HOME} then export export
+"$1" "$1" echo test echo $(pwd) test local 2>/dev/null $(pwd)
+	$(pwd) then then local 2>/dev/null cd sed "$1" 2>/dev/null readonly /usr/bin
+--verbose readonly echo done export
+		cd readonly cd "$1" test "$1" awk test
+$(pwd) && -eu $(pwd) -eu 'quoted text' then | export && grep then ${HOME}
+	then -eu test then "$1" "$1" | 2>/dev/null test local test grep 2>/dev/null local
+	--verbose "$1" done awk readonly 'quoted text' --verbose export
+	local printf "$@" done then
+	echo then && readonly ${HOME} 'quoted text' printf
+	done x=1 local test then /usr/bin
+	then -eu readonly cd | 2>/dev/null grep
+2>/dev/null awk ${HOME} --verbose test grep $(pwd) "$@" 2>/dev/null
+	local local --verbose then | 'quoted text' && -eu "$@" "$@" local then "$1"
+	test awk 2>/dev/null $(pwd) -eu cd printf printf cd && test printf 2>/dev/null
+		sed x=1 -eu ${HOME} | x=1
+	awk done test grep -eu export | 2>/dev/null "$@" cd && /usr/bin
+	export cd "$@" grep grep printf && "$1"
+sed $(pwd) $(pwd) && export readonly
+export && local && 'quoted text' ${HOME}
+2>/dev/null 2>/dev/null sed $(pwd) "$@" export --verbose then $(pwd) echo then
+2>/dev/null && | awk 'quoted text' | test x=1
+grep export 2>/dev/null -eu "$@" /usr/bin "$1"
+		sed printf --verbose ${HOME} | then printf cd /usr/bin -eu "$1" local /usr/bin
+		done sed printf local printf x=1 -eu ${HOME} "$1" local && echo local
+	sed x=1 ${HOME} --verbose printf /usr/bin /usr/bin export
+readonly sed test "$1" "$@" ${HOME}
+	$(pwd) "$@" 'quoted text' local x=1 awk cd test
+		then 2>/dev/null done done grep --verbose && readonly cd --verbose ${HOME} $(pwd)
+2>/dev/null readonly cd --verbose echo
+	then --verbose done echo x=1 /usr/bin
+/usr/bin sed | export x=1 /usr/bin "$@" /usr/bin | local ${HOME}
+grep then ${HOME} echo done --verbose readonly awk test /usr/bin
+'quoted text' "$1" $(pwd) && /usr/bin
+cd test -eu grep $(pwd) then "$@" 2>/dev/null
+	printf 2>/dev/null done "$@" /usr/bin 'quoted text'
+		then /usr/bin ${HOME} x=1 "$1" $(pwd)
+done readonly printf readonly 'quoted text' then done cd awk && sed $(pwd)
+		readonly 'quoted text' -eu grep done --verbose /usr/bin
+test ${HOME} ${HOME} /usr/bin -eu 2>/dev/null 2>/dev/null then printf
+		"$@" local then --verbose then "$@" 2>/dev/null
+		awk then 2>/dev/null ${HOME} awk export local
+		2>/dev/null done export cd then readonly | cd
+	sed /usr/bin readonly export
+	&& grep echo 'quoted text' printf then | test $(pwd) export /usr/bin sed
+		x=1 2>/dev/null 2>/dev/null | 2>/dev/null test sed x=1 2>/dev/null awk /usr/bin
+	"$1" "$@" awk sed | 2>/dev/null
+		then && ${HOME} 2>/dev/null then "$@" printf grep
+		--verbose ${HOME} export --verbose done 'quoted text' --verbose ${HOME}
+		x=1 local | test export 2>/dev/null
+	'quoted text' $(pwd) readonly printf
+	awk x=1 echo readonly && && x=1 ${HOME} then test export export
+export export then $(pwd) $(pwd) $(pwd) then
+		awk "$1" 2>/dev/null done /usr/bin x=1 local
+		sed awk && -eu ${HOME} 'quoted text' --verbose "$@" $(pwd) "$1" export local x=1
+		awk echo ${HOME} grep "$@" readonly x=1 "$1" readonly
+		"$1" awk 'quoted text' test ${HOME} printf awk then -eu
+		"$@" sed -eu grep 'quoted text'
+awk awk ${HOME} 2>/dev/null awk printf cd awk
+		&& "$@" | 'quoted text' test sed -eu local
+		cd $(pwd) /usr/bin 'quoted text' $(pwd) x=1 awk /usr/bin ${HOME} && "$1" --verbose
+readonly 2>/dev/null "$@" "$@"
+echo export grep "$1" /usr/bin grep 2>/dev/null x=1
+test test export awk cd done && grep x=1 x=1 readonly
+		sed "$@" echo "$1" | /usr/bin 2>/dev/null grep | "$1" /usr/bin
+	${HOME} echo test | sed printf awk
+		/usr/bin ${HOME} x=1 /usr/bin && sed local $(pwd) awk ${HOME}
+then --verbose awk echo
+	'quoted text' -eu local && $(pwd) export test "$@" --verbose /usr/bin
+	readonly "$@" 'quoted text' sed printf echo -eu x=1 local
+$(pwd) -eu "$@" | awk $(pwd) done --verbose
+		readonly "$@" $(pwd) done | "$@" "$@" ${HOME} export -eu awk awk
+export local x=1 awk | then done export
+		"$@" && 2>/dev/null echo
+		cd 2>/dev/null echo "$@" --verbose "$1"
+	2>/dev/null $(pwd) grep done x=1 -eu
+	export x=1 test $(pwd) --verbose 2>/dev/null ${HOME} awk grep
+	"$@" --verbose 2>/dev/null readonly "$1" /usr/bin /usr/bin
+		| $(pwd) "$1" echo grep -eu awk "$@" sed x=1
+'quoted text' echo "$1" awk then local
+	/usr/bin ${HOME} done 2>/dev/null readonly x=1 then cd printf sed | cd $(pwd) "$1"
+"$@" sed export 2>/dev/null && grep && && -eu test readonly
+		${HOME} 2>/dev/null ${HOME} echo | test test -eu "$@"
+	$(pwd) && then done && local grep readonly
+$(pwd) && awk readonly sed 2>/dev/null
+test cd ${HOME} printf local 'quoted text'
+	readonly grep 'quoted text' readonly "$1" -eu --verbose
+		"$1" cd $(pwd) ${HOME} "$1" --verbose cd ${HOME}
+		test echo | awk && then then then 'quoted text' "$@" --verbose
+		done x=1 printf "$1" test
+	test echo awk -eu 'quoted text' awk readonly export sed test ${HOME}
+		echo "$@" $(pwd) 2>/dev/null "$1" && sed | x=1 --verbose export export local
+	test ${HOME} cd --verbose 2>/dev/null
+/usr/bin $(pwd) echo 'quoted text'
+		readonly -eu | done 'quoted text'
+	test $(pwd) --verbose && -eu done printf "$@" 'quoted text' echo printf
+		then 'quoted text' export "$@" | awk ${HOME} readonly printf export echo
+		test test sed "$1" "$1" local test export grep /usr/bin -eu --verbose local
+test ${HOME} $(pwd) awk $(pwd)
+		"$@" printf x=1 grep readonly x=1 'quoted text'
+'quoted text' "$@" && printf ${HOME} local cd --verbose readonly | && sed
+&& ${HOME} then test sed sed done sed local readonly ${HOME} readonly
+		export -eu $(pwd) awk printf printf 'quoted text' printf
+		| && --verbose 'quoted text' export
+local && --verbose -eu --verbose --verbose -eu readonly $(pwd)
+	export /usr/bin test 2>/dev/null printf
+		export $(pwd) -eu done test printf echo sed "$@" /usr/bin ${HOME} | x=1
+export printf | sed grep 'quoted text' readonly awk | "$1" && $(pwd)
+echo --verbose 'quoted text' -eu --verbose $(pwd) 2>/dev/null
+/usr/bin 'quoted text' "$1" readonly
+cd done ${HOME} awk | ${HOME} "$@" echo
+printf then /usr/bin x=1 'quoted text' ${HOME} --verbose printf export printf 'quoted text'
+		test "$1" export test $(pwd) echo test -eu -eu "$@"
+| $(pwd) "$@" export "$1" && /usr/bin 'quoted text' readonly
+-eu then awk -eu x=1 | x=1 test --verbose local printf /usr/bin
+		grep export 'quoted text' awk export && /usr/bin
+echo export x=1 sed ${HOME} readonly
+		| awk && $(pwd) 2>/dev/null echo awk done "$@"
+		${HOME} -eu x=1 --verbose awk --verbose x=1 grep done
+	&& awk | 'quoted text' /usr/bin
+	-eu -eu printf "$1" 'quoted text' x=1 -eu test export printf "$@"
+	then x=1 cd then && then sed sed -eu /usr/bin 2>/dev/null echo
+		${HOME} 2>/dev/null sed awk export "$1" 2>/dev/null
+		cd test export echo "$@" x=1 $(pwd) local
+cd x=1 x=1 x=1 "$1" echo $(pwd) 2>/dev/null
+	export "$1" awk --verbose $(pwd) -eu "$1" test 2>/dev/null --verbose cd
+export ${HOME} done -eu 'quoted text'
+printf && "$@" -eu --verbose ${HOME}
+	test | 'quoted text' "$@" readonly
+"$1" "$1" $(pwd) grep x=1 ${HOME} readonly
+	x=1 | echo test $(pwd) 'quoted text'
+	'quoted text' export sed grep 'quoted text' echo --verbose printf readonly
+	grep awk cd x=1 echo && x=1 readonly
+x=1 && export grep -eu 'quoted text' awk grep done test
+	echo && && $(pwd) readonly ${HOME} done test 2>/dev/null
+/usr/bin 2>/dev/null | test | | | && export readonly "$1" then 'quoted text' 2>/dev/null
+local done local /usr/bin --verbose ${HOME} | local sed readonly
+	--verbose --verbose "$@" then printf test printf --verbose
+2>/dev/null $(pwd) done test test -eu |
+printf done && $(pwd) | local readonly export
+		done export test $(pwd) -eu
+	&& && awk grep /usr/bin | "$@" sed $(pwd) readonly
+$(pwd) -eu printf | export
+"$@" sed /usr/bin && export local printf && "$@" cd x=1 $(pwd) awk readonly 'quoted text'
+	readonly && /usr/bin "$1" 'quoted text'
+	export grep && echo export "$@" /usr/bin awk test | "$1" && grep "$@"
+		2>/dev/null grep x=1 --verbose readonly &&
+	printf cd sed x=1 awk echo -eu sed sed | local /usr/bin $(pwd) cd --verbose
+-eu | readonly $(pwd) 'quoted text'
+		'quoted text' done readonly local done echo export |
+cd ${HOME} && awk /usr/bin $(pwd) ${HOME} then test
+	readonly | printf printf x=1 ${HOME}
+then export | test && x=1 'quoted text' done -eu x=1 "$@" -eu sed grep
+		$(pwd) $(pwd) echo cd "$@" export sed | local echo printf done cd 2>/dev/null
+	printf printf test printf cd test && "$@" cd x=1 'quoted text' ${HOME}
+2>/dev/null then && sed cd sed cd sed x=1 'quoted text'
+"$1" x=1 local then "$@" awk awk grep && "$1" &&
+cd && cd 'quoted text' printf x=1 export 'quoted text' ${HOME} awk
+		then 'quoted text' local printf awk "$@" 'quoted text' readonly --verbose
+| 'quoted text' && awk printf 'quoted text' done --verbose echo test "$1" "$@"
+	printf local cd "$1" "$1" grep
+		&& "$@" && echo 2>/dev/null export printf printf
+	then 2>/dev/null -eu x=1 awk && readonly /usr/bin x=1 local
+	$(pwd) local export awk cd export "$@"
+2>/dev/null 'quoted text' -eu | 2>/dev/null echo local sed && --verbose --verbose
+	then grep "$1" "$@" x=1
+	awk 'quoted text' sed sed test readonly $(pwd) ${HOME}
+	grep ${HOME} then "$@" sed cd --verbose "$1" 'quoted text'
+		grep export printf && --verbose $(pwd)
+	| x=1 sed 'quoted text' 'quoted text'
+		-eu --verbose "$1" --verbose awk then printf $(pwd) printf export
+then grep local export local done awk "$@" done $(pwd) "$1" "$1" sed grep $(pwd)
+	grep test 'quoted text' printf test
+		${HOME} 'quoted text' | awk "$1"
+-eu then then $(pwd) export 2>/dev/null 'quoted text' "$1" "$1" /usr/bin
+	/usr/bin && "$1" printf
+export local printf readonly test readonly ${HOME} done
+		awk local --verbose local
+		awk | x=1 ${HOME} ${HOME} grep export && export $(pwd)
+printf -eu grep cd test sed -eu local "$1" ${HOME} 2>/dev/null
+		"$@" ${HOME} printf echo test ${HOME} $(pwd) grep ${HOME} local cd cd
+	grep $(pwd) --verbose | --verbose -eu x=1 "$@" 2>/dev/null
+&& | sed readonly /usr/bin
+x=1 then then | cd && | $(pwd) printf ${HOME} 2>/dev/null readonly /usr/bin
+	&& --verbose readonly x=1 grep /usr/bin 'quoted text' ${HOME} then ${HOME} 2>/dev/null
+local x=1 2>/dev/null x=1 grep cd awk done x=1 $(pwd) awk 2>/dev/null -eu local
+	local | -eu echo /usr/bin
+	"$1" -eu export done grep printf x=1 grep x=1 /usr/bin readonly
+	"$@" /usr/bin "$1" grep "$1" cd printf
+		local printf ${HOME} done x=1
+		2>/dev/null | -eu test cd then "$1" awk /usr/bin && /usr/bin sed test x=1
+		/usr/bin /usr/bin "$@" -eu 2>/dev/null grep printf | --verbose export
+	grep $(pwd) --verbose "$1" readonly echo /usr/bin |
+	readonly --verbose && /usr/bin $(pwd) grep "$1" export grep
+	cd ${HOME} 'quoted text' cd x=1 done --verbose sed 'quoted text' export
+		printf then 'quoted text' 2>/dev/null "$1" $(pwd) /usr/bin
+	printf echo && echo | then
+printf printf printf printf -eu &&
+'quoted text' echo ${HOME} ${HOME}
+		'quoted text' grep sed ${HOME} awk ${HOME} export
+then 'quoted text' printf /usr/bin then echo done && readonly $(pwd) then "$1" x=1
+	echo sed echo readonly export done
+	grep "$1" "$1" | export --verbose
+		grep test $(pwd) "$@" 2>/dev/null readonly cd ${HOME} "$1" && x=1 readonly
+	"$1" -eu printf "$@" && && grep
+	&& sed && "$@" 2>/dev/null x=1 --verbose 'quoted text' "$@" cd --verbose awk
+	&& "$1" echo "$1" export test readonly 2>/dev/null export 'quoted text'
+		x=1 then export cd export 'quoted text' local 'quoted text'
+	export "$1" "$@" readonly awk 'quoted text' then
+	&& test 'quoted text' then x=1 echo 2>/dev/null $(pwd) 'quoted text' -eu
+printf printf && then | cd cd && grep test cd
+		$(pwd) readonly readonly grep "$@" awk x=1 "$@" "$1" test then
+		${HOME} ${HOME} | 'quoted text' 2>/dev/null echo
+		awk "$1" done sed -eu export | ${HOME} readonly "$1" echo
+&& ${HOME} ${HOME} 'quoted text' sed echo readonly readonly 'quoted text' &&
+	printf "$1" awk ${HOME} "$1" then printf && "$1"
+export test "$@" sed local export awk echo | local "$1" test sed
+test cd x=1 -eu --verbose | grep 2>/dev/null then sed local local
+		local "$@" printf x=1 sed "$1"
+	test /usr/bin export readonly ${HOME} awk done 2>/dev/null ${HOME} | && "$@"
+$(pwd) done sed done cd sed ${HOME} $(pwd)
+		printf awk readonly 2>/dev/null /usr/bin /usr/bin --verbose grep done /usr/bin
+sed then --verbose local done cd --verbose export |
+	--verbose x=1 /usr/bin sed 2>/dev/null /usr/bin 2>/dev/null --verbose
+		then readonly echo ${HOME} $(pwd) grep $(pwd) "$1" grep -eu | /usr/bin
+	${HOME} | && /usr/bin
+	printf 'quoted text' 'quoted text' sed grep cd
+&& done "$@" x=1 export awk 2>/dev/null /usr/bin --verbose x=1 done && cd
+cd readonly then "$@" done ${HOME} --verbose
+&& | export && $(pwd) 2>/dev/null
+		--verbose x=1 awk /usr/bin test awk cd test test --verbose
+then done echo "$1" --verbose
+test ${HOME} | echo x=1 2>/dev/null grep
+	${HOME} export "$@" readonly && 'quoted text'
+	export done grep | awk echo /usr/bin x=1 'quoted text' -eu echo 2>/dev/null
+awk $(pwd) test grep "$@" local readonly cd cd /usr/bin 2>/dev/null
+$(pwd) 2>/dev/null | 'quoted text' && sed ${HOME} then --verbose --verbose
+x=1 cd "$1" 2>/dev/null
+		done local && cd 2>/dev/null $(pwd) readonly --verbose /usr/bin "$1" awk export
+	readonly -eu printf 'quoted text' x=1 cd x=1 x=1 then -eu test test
+	-eu readonly /usr/bin export
+		printf 2>/dev/null | x=1
+		then test ${HOME} readonly | sed then --verbose then $(pwd) sed export && --verbose
+&& 'quoted text' -eu readonly x=1 "$@" export ${HOME} then then printf sed
+| export echo && export | x=1 $(pwd) done sed readonly readonly
+	"$1" x=1 grep local "$1" --verbose
+		/usr/bin -eu | /usr/bin grep /usr/bin
+	then export ${HOME} cd 2>/dev/null "$1" sed --verbose
+		/usr/bin printf 'quoted text'
+export readonly -eu --verbose -eu 2>/dev/null
+	grep 'quoted text' /usr/bin readonly $(pwd)
+		test && grep export grep awk echo ${HOME} | test
+	export x=1 local 2>/dev/null
+		${HOME} then "$@" done cd sed --verbose
+		grep --verbose && x=1
+awk readonly ${HOME} done test printf readonly cd cd "$1" readonly && --verbose
+		test test -eu grep local cd readonly cd "$1" then test && printf -eu grep
+	echo x=1 "$@" sed then -eu "$1" $(pwd) "$1" then done /usr/bin $(pwd) && ${HOME}
+export awk "$1" export "$@" printf
+/usr/bin -eu 'quoted text' local 2>/dev/null export printf cd echo
+cd x=1 --verbose sed "$@"
+local test "$1" -eu $(pwd) grep sed printf cd "$1" "$1" echo "$@"
+	${HOME} echo "$1" | export $(pwd) readonly awk
+cd awk 2>/dev/null done
+		local echo echo awk cd export x=1 grep x=1
+	printf ${HOME} local /usr/bin export 'quoted text' local | printf
+		-eu $(pwd) 2>/dev/null done 'quoted text'
+	| 2>/dev/null 2>/dev/null | $(pwd) | "$1" 'quoted text'
+		$(pwd) readonly 2>/dev/null printf 'quoted text'
+		--verbose $(pwd) done sed | done | readonly
+	&& cd awk | sed done local printf $(pwd) export
+		"$@" $(pwd) export readonly x=1 awk -eu ${HOME} export
+	&& sed "$@" awk --verbose "$1" local export test $(pwd)
+	&& -eu ${HOME} 'quoted text' sed ${HOME} ${HOME}
+		$(pwd) grep 2>/dev/null awk | 'quoted text' /usr/bin printf | test
+		printf local | "$1" "$@" export local
+| 'quoted text' sed awk && 'quoted text' awk readonly 'quoted text' x=1
+-eu 'quoted text' done 2>/dev/null
+	'quoted text' 2>/dev/null | test
+then printf 2>/dev/null 'quoted text'
+		| | sed /usr/bin "$1" 2>/dev/null
+		| 2>/dev/null export | "$1" grep | "$@" then then
+done done 'quoted text' export $(pwd) then 'quoted text' 2>/dev/null
+then local ${HOME} x=1 awk "$@" 2>/dev/null "$@"
+	"$1" $(pwd) ${HOME} then local sed | done
+--verbose awk --verbose x=1 ${HOME} done printf grep "$@"
+	2>/dev/null grep && done -eu printf "$@"
+	awk && $(pwd) -eu x=1 "$1" ${HOME} | grep test sed x=1 sed
+"$1" local printf && && && readonly && ${HOME}
+	readonly echo --verbose --verbose cd /usr/bin then printf export
+awk local $(pwd) test 2>/dev/null
+	$(pwd) export cd && printf "$1" /usr/bin
+		&& printf $(pwd) printf
+		cd awk 'quoted text' 'quoted text' export
+		${HOME} grep export "$1" echo $(pwd) done test 'quoted text'
+		printf cd && $(pwd) echo cd -eu ${HOME} | x=1 $(pwd) 2>/dev/null printf
+		done "$1" $(pwd) /usr/bin x=1 echo then --verbose
+		printf readonly /usr/bin 'quoted text' grep 2>/dev/null -eu local cd done test
+2>/dev/null local then cd x=1 sed grep sed echo cd x=1
+	readonly && printf sed grep then "$1" awk ${HOME} x=1 awk $(pwd) 'quoted text'
+grep readonly x=1 && grep -eu awk printf 'quoted text'
+/usr/bin done x=1 x=1 2>/dev/null "$@" test done /usr/bin | --verbose grep
+export 'quoted text' then 2>/dev/null | grep grep awk "$1"
+test awk "$1" echo test local sed done local
+		test grep | x=1 $(pwd) && awk $(pwd)
+		'quoted text' "$1" -eu $(pwd) x=1 2>/dev/null
+	printf ${HOME} then --verbose ${HOME} done
+	readonly awk local cd "$@" ${HOME} ${HOME} then export then
+then $(pwd) test -eu
+done grep 2>/dev/null echo
+export then test test ${HOME} -eu
+	then readonly -eu | awk then -eu && && export "$@" $(pwd) && awk
+	grep ${HOME} awk $(pwd)
+		$(pwd) awk local $(pwd) 2>/dev/null
+		-eu readonly | /usr/bin grep | test &&
+		then done export 2>/dev/null
+	/usr/bin "$@" | | export
+		'quoted text' 'quoted text' echo "$1" sed x=1 printf $(pwd) done --verbose
+then /usr/bin 'quoted text' --verbose "$1"
+	x=1 --verbose test sed 'quoted text' ${HOME} | "$1" sed $(pwd) test printf
+printf local grep echo "$1" cd 2>/dev/null cd x=1 /usr/bin
+	sed 2>/dev/null --verbose echo x=1 then awk export -eu export x=1 | x=1 && "$@"
+	grep -eu --verbose echo done readonly grep /usr/bin awk awk sed
+		"$1" /usr/bin test "$1" "$1" grep printf test test echo x=1 x=1 && 'quoted text'
+		'quoted text' 2>/dev/null cd local printf
+	test then "$@" $(pwd) export
+	/usr/bin 2>/dev/null --verbose && 2>/dev/null cd
+	grep grep --verbose x=1 2>/dev/null sed readonly 'quoted text' 'quoted text'
+		cd cd cd test && printf export --verbose
+	grep $(pwd) /usr/bin -eu "$@" then -eu cd
+	"$1" 2>/dev/null cd | export "$1" "$@"
+| /usr/bin ${HOME} | cd
+		-eu ${HOME} printf printf awk x=1
+x=1 then 'quoted text' 2>/dev/null sed
+readonly local "$@" $(pwd) awk
+		&& "$1" then 2>/dev/null /usr/bin export awk --verbose 2>/dev/null
+		local cd | ${HOME} "$@" --verbose
+	"$1" $(pwd) echo $(pwd) --verbose export export printf 'quoted text' -eu 'quoted text'
+--verbose grep $(pwd) | test --verbose
+	grep "$@" | awk && "$@" "$1" 'quoted text' 2>/dev/null 2>/dev/null awk readonly
+"$@" "$@" -eu -eu ${HOME} | 'quoted text' test done awk ${HOME} cd
+		/usr/bin printf echo --verbose
+		sed 'quoted text' /usr/bin sed /usr/bin done 'quoted text' export then
+local ${HOME} --verbose
+	done done test x=1 grep cd echo sed test
+		echo $(pwd) grep local awk "$1" ${HOME}
+readonly readonly local -eu echo local && sed x=1 2>/dev/null export | 'quoted text'
+		echo test --verbose $(pwd) sed "$@" readonly test /usr/bin
+		--verbose "$1" done /usr/bin 'quoted text' && test x=1 --verbose
+done $(pwd) && echo test --verbose
+		x=1 && awk && then x=1 export then $(pwd) /usr/bin awk
+	cd sed then | echo then test "$@"
+done ${HOME} then done && x=1 "$@" awk ${HOME} ${HOME} printf sed awk
+readonly $(pwd) readonly test 'quoted text' 2>/dev/null
+	'quoted text' export x=1 'quoted text' then test 2>/dev/null export readonly
+	-eu x=1 $(pwd) local printf then printf | $(pwd) export -eu cd grep | test
+	--verbose && -eu --verbose
+	readonly awk grep readonly 'quoted text'
+		local && printf readonly $(pwd)
+	test done cd local x=1 $(pwd) test ${HOME} test "$@" echo
+		local local $(pwd) cd awk $(pwd) grep "$@" "$1" export test && test test grep "$1"
+echo printf && local sed
+	-eu awk --verbose 'quoted text' 2>/dev/null grep
+echo | grep cd "$1" -eu "$1" /usr/bin
+done then done readonly export $(pwd) cd $(pwd)
+	local then readonly printf /usr/bin
+$(pwd) | grep cd readonly then
+	cd 'quoted text' && "$1" "$1" readonly then printf local printf
+	2>/dev/null | done readonly x=1 readonly 'quoted text'
+	--verbose --verbose "$@" cd local -eu "$1" export
+	done readonly && sed && /usr/bin | export /usr/bin echo
+	printf then grep /usr/bin | 2>/dev/null ${HOME} readonly sed printf local
+${HOME} then | ${HOME} x=1 cd grep | cd grep &&
+		-eu cd then export && local --verbose awk test printf ${HOME}
+	test export $(pwd) 'quoted text' printf | /usr/bin sed $(pwd)
+"$@" echo "$1" 2>/dev/null grep sed -eu
+echo 'quoted text' then export
+	$(pwd) echo --verbose | cd 2>/dev/null local
+${HOME} readonly -eu awk x=1 cd echo done echo ${HOME}
+		echo export x=1 && 2>/dev/null sed grep | "$@" /usr/bin $(pwd)
+		"$@" /usr/bin done sed grep cd readonly /usr/bin --verbose sed
+| echo 'quoted text' -eu sed awk test
+	awk local "$@" $(pwd)
+	done -eu awk && 'quoted text'
+&& readonly ${HOME} "$1" ${HOME} /usr/bin -eu grep "$1"
+	then 2>/dev/null | /usr/bin test sed --verbose local awk && $(pwd) sed
+		test printf echo | cd ${HOME} "$1" -eu 2>/dev/null
+	${HOME} 'quoted text' sed grep then test ${HOME} "$1"
+	then ${HOME} 2>/dev/null test && echo && && 'quoted text' printf
+		printf $(pwd) --verbose -eu && echo done $(pwd) cd
+		"$@" "$@" then --verbose | cd grep ${HOME} && /usr/bin
+done readonly 'quoted text' export | printf local
+		&& awk local "$@" 'quoted text' ${HOME} /usr/bin grep local grep "$1" grep "$1"
+	/usr/bin test printf | then
+		"$@" 'quoted text' test "$@" 'quoted text' cd | cd sed "$@" test local | awk
+$(pwd) && then && | grep export "$1" grep local readonly && && ${HOME}
+		printf | -eu && "$@" then /usr/bin /usr/bin
+done | cd export local cd && printf
+	-eu awk --verbose readonly x=1
+		export "$@" "$@" export printf printf -eu done readonly "$@" -eu -eu
+	| 'quoted text' test then printf local printf local /usr/bin && export | /usr/bin
+	$(pwd) printf export cd -eu | done ${HOME} ${HOME}
+		echo x=1 readonly export sed sed export -eu cd x=1 && "$1" -eu echo grep
+readonly "$@" ${HOME} awk grep
+"$@" local cd echo 2>/dev/null x=1 "$1" local &&
+	&& local x=1 cd then ${HOME} test export readonly echo --verbose done
+		export 'quoted text' grep | done done test printf /usr/bin
+	-eu ${HOME} cd ${HOME} /usr/bin
+	'quoted text' readonly x=1 'quoted text'
+	grep printf done -eu done ${HOME} cd local test echo
+	sed "$@" | && readonly $(pwd) grep done cd | printf $(pwd)
+	"$1" local sed cd readonly cd cd && && echo readonly then 2>/dev/null
+	"$1" readonly 'quoted text' && "$1" -eu -eu /usr/bin export | "$@" x=1 $(pwd)
+readonly && ${HOME} $(pwd) then && --verbose local readonly
+'quoted text' sed local export
+printf then done $(pwd) x=1 echo printf
+printf 2>/dev/null then sed echo awk 2>/dev/null "$@" printf echo 'quoted text'
+x=1 "$1" $(pwd) export /usr/bin 2>/dev/null x=1 "$1"
+awk ${HOME} readonly 'quoted text' x=1 &&
+		x=1 x=1 export 2>/dev/null
+	| export -eu $(pwd) x=1 done echo | sed echo "$1"
+readonly /usr/bin "$1" | 'quoted text' x=1 -eu
+then done echo -eu && awk 'quoted text' $(pwd)
+		grep "$1" echo /usr/bin x=1 export 'quoted text'
+local grep 'quoted text'
+	awk readonly echo 'quoted text'
+grep 2>/dev/null "$@" then --verbose
+	${HOME} "$@" "$1" 'quoted text' export "$1" grep | echo "$1" ${HOME}
+grep 2>/dev/null printf done export 2>/dev/null readonly readonly
+		export x=1 export grep printf -eu /usr/bin
+x=1 export -eu ${HOME} 2>/dev/null "$1" grep then cd test -eu 'quoted text'
+	${HOME} 'quoted text' $(pwd) done | cd "$@" "$1" x=1 $(pwd) ${HOME}
+	echo -eu sed ${HOME} $(pwd) done echo x=1 local local sed printf sed
+awk 'quoted text' then local
+		"$@" 'quoted text' export
+	2>/dev/null then cd --verbose export 'quoted text' printf awk
+	${HOME} readonly "$@" sed test
+echo grep then echo --verbose printf
+		'quoted text' cd 2>/dev/null -eu grep | "$@" done cd /usr/bin export /usr/bin
+		$(pwd) test "$@" --verbose export && /usr/bin grep x=1 "$@" local grep
+		sed && "$1" then -eu local
+test /usr/bin x=1 ${HOME}
+export "$1" | printf then && then | /usr/bin ${HOME} -eu
+2>/dev/null "$1" /usr/bin printf local --verbose | printf sed cd "$@" export
+	"$1" printf grep x=1 test -eu done readonly cd test "$1" x=1 ${HOME}
+	then printf readonly printf "$1" "$1" --verbose cd
+/usr/bin test ${HOME} export awk echo export /usr/bin local
+		local readonly "$1" x=1 | x=1 /usr/bin echo done
+	awk 'quoted text' local done 'quoted text' done readonly $(pwd)
+	done | sed 'quoted text'
+		--verbose | --verbose cd ${HOME} awk $(pwd) local
+	done ${HOME} cd export /usr/bin done 'quoted text' /usr/bin 'quoted text'
+2>/dev/null cd "$1" sed -eu sed sed done local test test
+		'quoted text' echo x=1 local printf
+'quoted text' "$1" $(pwd) && readonly local awk --verbose readonly
+		'quoted text' readonly /usr/bin echo test test ${HOME}
+		-eu /usr/bin done echo "$@" && /usr/bin readonly
+printf done awk test && && x=1 x=1 test "$@" x=1 local 'quoted text'
+		grep cd then -eu cd printf 2>/dev/null
+		local 2>/dev/null 2>/dev/null | echo
+	--verbose readonly && "$@" "$@" sed printf printf echo local
+	cd $(pwd) done test x=1 ${HOME} then sed sed "$1" /usr/bin
+	cd 'quoted text' sed test ${HOME} sed 'quoted text' cd $(pwd)
+test echo printf export then grep done
+	echo echo /usr/bin -eu test ${HOME} awk /usr/bin readonly --verbose local
+	"$1" printf 2>/dev/null sed "$@" 2>/dev/null local x=1 ${HOME} "$@" -eu -eu --verbose
+		printf readonly 'quoted text' export ${HOME} sed 'quoted text' test grep
+	echo local sed done x=1 'quoted text' $(pwd) awk
+export awk local awk test readonly done sed -eu readonly "$1"
+		done local --verbose test echo --verbose /usr/bin 2>/dev/null sed /usr/bin test
+		| "$1" cd 2>/dev/null sed -eu 'quoted text'
+'quoted text' $(pwd) "$1" 2>/dev/null
+$(pwd) grep --verbose done $(pwd) ${HOME} | /usr/bin
+		then test readonly echo test | "$1" echo printf grep
+		export echo "$1" test printf 2>/dev/null done $(pwd) then --verbose
+'quoted text' cd done printf
+		2>/dev/null && echo awk "$@" local echo
+cd local -eu x=1 echo -eu x=1 $(pwd) x=1 2>/dev/null
+${HOME} readonly then 2>/dev/null 'quoted text' readonly awk grep
+		printf $(pwd) && 'quoted text' printf "$1" sed x=1 'quoted text'
+		"$@" 'quoted text' sed grep x=1 cd readonly test printf sed
+	x=1 printf 'quoted text' readonly awk then && 'quoted text' awk 'quoted text' "$1"
+		grep "$1" --verbose echo /usr/bin --verbose then cd "$1" /usr/bin | /usr/bin
+		"$1" "$1" cd done local sed /usr/bin awk $(pwd) 2>/dev/null awk | 'quoted text'
+		sed readonly --verbose && && | readonly $(pwd) "$1" |
+awk ${HOME} readonly "$@"
+		test echo 'quoted text' export --verbose && $(pwd) x=1 "$@" echo cd
+		/usr/bin grep readonly cd then x=1 -eu then
+		&& --verbose then x=1 -eu then $(pwd)
+		2>/dev/null 2>/dev/null "$@" /usr/bin grep grep local grep $(pwd) $(pwd)
+/usr/bin then printf "$1" x=1 awk test -eu awk readonly "$1"
+then sed then && readonly test export | done /usr/bin cd 'quoted text' awk
+		2>/dev/null && | echo && | $(pwd) test awk ${HOME} "$@" $(pwd) --verbose /usr/bin
+$(pwd) printf 'quoted text' /usr/bin x=1 /usr/bin && awk export
+		then test && done $(pwd) cd --verbose --verbose
+	cd /usr/bin | awk readonly done 'quoted text'
+		${HOME} export | "$1" /usr/bin sed "$1" cd && "$@" printf then 'quoted text'
+	readonly /usr/bin then echo grep --verbose /usr/bin awk | -eu export | done
+	-eu "$@" 2>/dev/null then -eu x=1 readonly sed printf --verbose
+		then local echo test local sed sed done done local
+2>/dev/null $(pwd) sed local
+	/usr/bin awk done /usr/bin sed "$1"
+	grep /usr/bin readonly export 2>/dev/null local readonly printf then local
+	/usr/bin 'quoted text' test done grep echo 2>/dev/null ${HOME}
+		$(pwd) done then x=1 sed printf export 2>/dev/null -eu /usr/bin readonly
+		| ${HOME} /usr/bin 'quoted text'
+		--verbose | 2>/dev/null export $(pwd) $(pwd) done export /usr/bin export then "$@"
+${HOME} $(pwd) sed test readonly printf ${HOME} readonly
+&& cd 'quoted text' x=1 echo test /usr/bin -eu echo test x=1 $(pwd) sed --verbose
+	test 'quoted text' cd grep awk awk
+		export --verbose 2>/dev/null x=1 printf --verbose
+		${HOME} 'quoted text' grep then then --verbose ${HOME} ${HOME} && local /usr/bin
+"$@" export awk awk | awk local && -eu then "$1" $(pwd) 'quoted text' && local
+	test x=1 awk "$1" readonly | 2>/dev/null echo done -eu 2>/dev/null readonly test
+		"$@" cd cd --verbose -eu $(pwd) x=1 awk --verbose cd && readonly echo echo
+		readonly cd 'quoted text' test 'quoted text' sed cd
+done && local grep grep ${HOME} $(pwd) -eu grep export -eu test 2>/dev/null
+2>/dev/null $(pwd) "$1" test sed 'quoted text' /usr/bin test cd ${HOME}
+x=1 -eu then then $(pwd) "$@" 'quoted text'
+		grep local printf 'quoted text' grep 2>/dev/null -eu 2>/dev/null
+cd sed then done then ${HOME} echo x=1 then ${HOME} cd --verbose test | |
+	printf "$1" && $(pwd) --verbose ${HOME} test echo printf echo "$1" x=1 local
+2>/dev/null echo 2>/dev/null grep
+then 2>/dev/null --verbose then
+		/usr/bin cd /usr/bin | sed && "$1" "$1" export ${HOME} 'quoted text'
+	echo && printf grep readonly local "$1" x=1
+${HOME} then then | -eu ${HOME} awk export "$@" then x=1 local
+		local sed local export "$@"
+	cd printf grep printf --verbose export 2>/dev/null cd awk --verbose -eu "$@"
+	then done ${HOME} x=1 echo "$@"
+	"$@" sed awk "$1" grep export --verbose then then "$1" | $(pwd) /usr/bin readonly
+	readonly readonly -eu
+		export test awk /usr/bin --verbose then ${HOME} then grep local ${HOME} 2>/dev/null
+		${HOME} ${HOME} && done printf
+then ${HOME} sed | --verbose readonly cd then echo "$1" x=1 done export $(pwd)
+	echo cd done --verbose echo grep $(pwd) | $(pwd) readonly
+--verbose test --verbose ${HOME} /usr/bin awk grep -eu awk export grep x=1 sed
+	echo grep && 'quoted text' sed grep printf awk && --verbose 'quoted text'
+		awk x=1 test x=1 'quoted text' grep readonly readonly 2>/dev/null sed awk grep
+		then --verbose export printf sed --verbose --verbose "$1" readonly then local
+		x=1 sed --verbose --verbose /usr/bin --verbose
+| ${HOME} local echo "$1" done "$1" ${HOME}
+$(pwd) sed awk readonly printf --verbose echo sed --verbose
+x=1 readonly export -eu && printf ${HOME} x=1 printf --verbose
+test readonly 2>/dev/null ${HOME} echo grep
+"$@" /usr/bin done /usr/bin ${HOME} $(pwd) -eu "$@"
+$(pwd) cd | "$@" 'quoted text' local cd readonly
+export /usr/bin test awk
+$(pwd) --verbose /usr/bin local 'quoted text' x=1
+		printf && export && "$@" sed export printf grep awk "$@" export "$1" /usr/bin
+		${HOME} ${HOME} -eu --verbose
+	&& export sed echo cd export
+"$1" grep "$1" then cd grep x=1 --verbose awk -eu local --verbose -eu /usr/bin
+	/usr/bin export sed | | ${HOME} readonly sed
+&& "$@" sed done x=1 local done awk --verbose | test $(pwd) 'quoted text' | --verbose
+	"$1" 2>/dev/null ${HOME}
+	test sed sed | ${HOME} && readonly
+echo "$1" "$@" then /usr/bin
+		printf grep 'quoted text' 'quoted text' | readonly ${HOME}
+grep export echo grep x=1 -eu readonly local sed "$@" "$1" readonly && cd $(pwd)
+		readonly 'quoted text' x=1 ${HOME} echo
+	"$1" sed "$@" "$@" awk -eu --verbose printf 2>/dev/null
+&& done grep local local printf "$1" $(pwd) test awk sed then awk then
+	/usr/bin readonly 'quoted text' sed printf
+x=1 printf 2>/dev/null 'quoted text' /usr/bin test -eu
+		$(pwd) awk "$1" then x=1 "$@" 2>/dev/null "$1" -eu local "$1" printf /usr/bin
+		grep 2>/dev/null awk $(pwd) sed --verbose | 'quoted text' && echo
+--verbose $(pwd) ${HOME} /usr/bin 2>/dev/null test 'quoted text'
+	awk readonly then sed x=1 grep readonly $(pwd) then done
+		-eu test then $(pwd) ${HOME} --verbose done /usr/bin x=1 awk sed local &&
+		&& export done "$@" 'quoted text' cd printf --verbose done x=1
+		$(pwd) --verbose test local |
+		$(pwd) "$@" --verbose done test local --verbose done
+	2>/dev/null export awk && test x=1
+		done export -eu test then sed cd local export
+2>/dev/null awk 2>/dev/null "$@" awk export sed
+		printf export "$1" x=1 $(pwd) cd then -eu
+/usr/bin test sed grep --verbose --verbose /usr/bin awk sed
+/usr/bin "$@" $(pwd)
+		sed awk /usr/bin -eu "$@" -eu --verbose "$@" local 'quoted text' test printf
+		'quoted text' && done
+		'quoted text' readonly | "$@"
+	"$@" sed printf "$1" ${HOME} 'quoted text' $(pwd) 'quoted text'
+	${HOME} echo && /usr/bin local awk
+	awk /usr/bin readonly "$1" $(pwd) echo -eu ${HOME} test export
+test --verbose then done --verbose
+grep | cd awk ${HOME} $(pwd) printf ${HOME} grep test echo "$1" cd echo 'quoted text'
+		&& then 'quoted text' printf done 'quoted text' then printf /usr/bin "$1"
+local 2>/dev/null $(pwd) "$@" grep test 'quoted text' /usr/bin 'quoted text'
+		test "$1" sed local ${HOME} 2>/dev/null grep "$1"
+		$(pwd) test awk ${HOME} grep sed sed /usr/bin grep
+export local local sed 'quoted text' sed ${HOME}
+--verbose cd 'quoted text' echo -eu local -eu local readonly "$1" 'quoted text'
+echo ${HOME} readonly x=1 ${HOME} printf export local then
+		-eu sed export $(pwd) grep test --verbose cd 2>/dev/null $(pwd) /usr/bin
+	-eu "$@" local $(pwd) printf done
+	/usr/bin | test test 'quoted text' export 2>/dev/null --verbose
+	--verbose x=1 "$1" done grep 2>/dev/null
+	$(pwd) readonly "$@" 2>/dev/null 2>/dev/null "$1" ${HOME}
+	awk awk 'quoted text' awk --verbose printf x=1 awk export -eu
+	/usr/bin "$1" readonly /usr/bin
+2>/dev/null printf awk local
+sed local done 'quoted text'
+		readonly grep "$@" awk "$@" /usr/bin done done export readonly
+		"$@" && $(pwd) && sed "$@" "$1" grep /usr/bin x=1 test done printf echo
+		done /usr/bin printf "$@" test 2>/dev/null "$@" $(pwd) done 'quoted text'
+--verbose $(pwd) echo sed sed grep | then 2>/dev/null readonly /usr/bin
+"$1" sed cd && then grep echo printf
+	-eu done 'quoted text' ${HOME} export test ${HOME}
+		-eu printf 2>/dev/null sed local readonly cd "$1" readonly local x=1 readonly
+	--verbose grep 'quoted text' local then | "$@" test -eu awk "$1" then done && /usr/bin
+"$@" ${HOME} grep 'quoted text' && 'quoted text'
+	echo 2>/dev/null printf "$@" echo export --verbose "$@"
+		grep test done "$1" export
+	'quoted text' done ${HOME}
+	readonly x=1 test -eu test test export
+	--verbose export done then ${HOME} done
+$(pwd) awk $(pwd) /usr/bin ${HOME} grep
+		"$1" "$1" | ${HOME} "$1" | ${HOME} ${HOME} echo
+		"$@" && export 'quoted text' 2>/dev/null /usr/bin ${HOME} readonly
+then "$1" then "$1" | /usr/bin sed grep "$1" -eu ${HOME} && grep printf
+		${HOME} sed local | printf
+cd "$@" grep done sed sed "$1" awk then 'quoted text' echo
+then then readonly "$@" done && 'quoted text' readonly /usr/bin grep test "$@"
+	&& x=1 sed sed awk -eu /usr/bin -eu 2>/dev/null then then echo then
+		/usr/bin --verbose --verbose -eu done export grep sed
+		${HOME} printf sed export awk printf then 'quoted text' 'quoted text'
+	test x=1 test /usr/bin
+		'quoted text' echo cd x=1 test grep ${HOME} cd local ${HOME}
+	| | grep echo then 2>/dev/null ${HOME} done 'quoted text' x=1 "$@" ${HOME} export
+		awk awk x=1 readonly grep 'quoted text' 2>/dev/null done
+		sed cd local /usr/bin cd ${HOME} "$@" done
+"$@" done --verbose local "$@" test "$1" x=1 /usr/bin "$1" echo
+	&& cd ${HOME} done |
+		done | export && ${HOME} "$1" test local
+		printf echo export local sed echo
+		local done "$@" x=1 | then "$1" && cd /usr/bin test "$@" export local
+		${HOME} $(pwd) 'quoted text' awk then
+		done 2>/dev/null test grep "$1" | readonly x=1 echo /usr/bin sed done /usr/bin
+		then local $(pwd) x=1 && sed echo grep
+2>/dev/null $(pwd) cd && 'quoted text' -eu printf grep $(pwd) local export 2>/dev/null
+	&& -eu readonly 2>/dev/null echo then
+		--verbose grep done /usr/bin "$@" then
+	x=1 ${HOME} printf awk 'quoted text' && 'quoted text' done
+		export /usr/bin local x=1 --verbose then
+test export "$@" && --verbose readonly 2>/dev/null | awk done printf "$1"
+export then --verbose printf sed /usr/bin
+	readonly done awk printf grep | -eu 2>/dev/null
+	test printf --verbose then done export
+grep 'quoted text' 'quoted text' ${HOME} x=1 /usr/bin sed && export
+	"$1" grep ${HOME} printf printf test &&
+done 'quoted text' 2>/dev/null ${HOME}
+		test echo --verbose sed $(pwd) $(pwd) then ${HOME}
+	sed /usr/bin done x=1 "$@" then test -eu | echo then then | sed then
+then && && cd local export test x=1 cd
+done cd --verbose 2>/dev/null
+awk done cd && $(pwd) export
+		grep done echo /usr/bin -eu $(pwd) ${HOME} 2>/dev/null --verbose ${HOME}
+	-eu --verbose $(pwd) printf echo | -eu printf printf export
+-eu echo -eu then export readonly x=1 --verbose "$1" && |
+		export done export awk done then awk --verbose --verbose |
+test "$1" then local
+	cd /usr/bin awk "$@" done $(pwd) 'quoted text' cd
+	'quoted text' /usr/bin 'quoted text' echo cd cd cd cd --verbose $(pwd)
+"$1" ${HOME} grep local --verbose sed ${HOME} x=1 readonly awk /usr/bin ${HOME}
+	awk readonly --verbose "$@" $(pwd) awk done 'quoted text' printf && | "$@" awk &&
+echo ${HOME} ${HOME} 2>/dev/null
+"$1" done ${HOME} readonly readonly export done printf ${HOME} ${HOME}
+echo readonly done 2>/dev/null then "$@"
+	x=1 2>/dev/null && 2>/dev/null 2>/dev/null then export --verbose
+		grep 'quoted text' echo 2>/dev/null done && cd awk done export export
+		2>/dev/null x=1 sed $(pwd)
+		/usr/bin -eu x=1 readonly then export "$1" 'quoted text' echo
+--verbose local sed echo "$1" && $(pwd) 'quoted text'
+		export 2>/dev/null x=1 done /usr/bin
+awk echo --verbose 'quoted text' echo ${HOME}
+	'quoted text' local grep
+-eu "$@" done printf && echo --verbose | sed grep | printf x=1 -eu printf && &&
+${HOME} 2>/dev/null awk readonly --verbose
+	2>/dev/null "$1" /usr/bin x=1 -eu | --verbose 2>/dev/null /usr/bin -eu
+grep x=1 -eu done && --verbose --verbose
+		2>/dev/null 2>/dev/null done 'quoted text' ${HOME} awk local ${HOME} -eu
+	| ${HOME} -eu -eu && then 'quoted text' printf
+/usr/bin readonly cd cd echo --verbose | |
+		-eu /usr/bin echo test && grep "$@" /usr/bin $(pwd) export
+	export 'quoted text' 'quoted text' awk test "$1" ${HOME} "$@" ${HOME}
+	local /usr/bin && printf
+&& | | echo grep /usr/bin then printf
+	grep ${HOME} export printf local $(pwd) grep
+		echo test local sed /usr/bin x=1
+then echo 2>/dev/null awk 'quoted text' local | x=1 sed then grep $(pwd) printf
+	echo ${HOME} 2>/dev/null awk 'quoted text'
+then -eu sed -eu --verbose | then
+		'quoted text' export readonly echo then local
+-eu cd echo 2>/dev/null ${HOME} export 'quoted text' then export echo readonly
+		2>/dev/null awk | && /usr/bin && 'quoted text' /usr/bin awk readonly
+		local --verbose cd --verbose test test then
+	local awk "$@" -eu x=1 "$1" echo ${HOME} sed $(pwd) local "$1" /usr/bin
+		$(pwd) echo grep x=1 2>/dev/null printf 'quoted text' 2>/dev/null readonly
+		echo grep grep "$@" x=1 export local "$1" then ${HOME} "$1" | 2>/dev/null "$@"
+	export echo done export 2>/dev/null
+		"$@" export sed && awk -eu printf cd 'quoted text'
+		-eu echo awk cd local &&
+		"$@" printf -eu --verbose && x=1 local ${HOME} "$@" | -eu | -eu echo --verbose
+		$(pwd) 'quoted text' local done printf done "$@" --verbose
+readonly --verbose sed grep $(pwd) export "$1"
+	${HOME} 'quoted text' | local
+'quoted text' done | sed $(pwd) test $(pwd) awk test && 'quoted text' awk
+export && export export | -eu "$1" --verbose
+	grep 2>/dev/null echo && /usr/bin done
+grep -eu done then "$1" awk x=1 --verbose x=1 cd $(pwd) then
+grep "$1" export /usr/bin "$1" ${HOME} then awk | local 'quoted text'
+echo then printf cd awk "$1" then
+local && test 2>/dev/null
+test sed done awk printf 'quoted text' --verbose "$1" awk sed ${HOME} then
+grep grep "$1" readonly test readonly x=1 2>/dev/null
+test "$@" done readonly "$@" then x=1 -eu
+		x=1 --verbose --verbose done --verbose /usr/bin
+cd then --verbose export ${HOME} then "$1" /usr/bin export
+grep sed readonly awk test test
+readonly $(pwd) "$1" && done done | awk local $(pwd)
+'quoted text' "$@" awk x=1 -eu sed $(pwd) "$1" | &&
+		readonly awk --verbose 2>/dev/null
+		local /usr/bin readonly ${HOME} -eu "$1" 2>/dev/null | --verbose then echo
+		"$1" --verbose done /usr/bin done -eu cd 2>/dev/null readonly export sed 2>/dev/null
+--verbose echo | ${HOME} export awk
+		'quoted text' -eu export local grep "$1" sed "$1" x=1 'quoted text'
+		"$@" x=1 sed local "$@" cd test
+echo grep | local printf sed $(pwd) --verbose test 2>/dev/null
+export $(pwd) test then -eu --verbose /usr/bin cd --verbose
+"$@" ${HOME} | 2>/dev/null test | local -eu /usr/bin echo "$1"
+	awk printf export grep --verbose --verbose sed ${HOME} ${HOME}
+	--verbose sed 2>/dev/null "$1" then ${HOME}
+	'quoted text' cd local test x=1 x=1 local
+		| printf "$1" grep --verbose printf export sed &&
+		"$1" export 2>/dev/null readonly | local printf echo "$1" local test "$@" local
+		$(pwd) grep grep "$@" test printf /usr/bin && awk -eu readonly done -eu test
+		/usr/bin "$1" awk "$1" 2>/dev/null x=1 then readonly ${HOME} --verbose echo cd
+"$@" then grep cd grep grep printf $(pwd) 2>/dev/null done
+		grep && done readonly "$@" export "$1" /usr/bin awk grep printf
+		"$1" test ${HOME} done cd awk awk done 'quoted text'
+	$(pwd) $(pwd) local echo && 'quoted text' -eu echo grep readonly 'quoted text'
+cd cd awk $(pwd) grep
+		'quoted text' local 2>/dev/null
+	done x=1 grep sed grep readonly
+--verbose cd --verbose
+${HOME} test export ${HOME} export local ${HOME} readonly sed test cd "$1" |
+		done --verbose --verbose $(pwd) local echo readonly
+done "$1" /usr/bin awk awk x=1 echo grep readonly then test 'quoted text'
+test "$1" cd --verbose -eu 'quoted text' test /usr/bin x=1 printf "$1"
+	local export done /usr/bin readonly awk done export x=1 grep cd "$1" printf
+grep $(pwd) 'quoted text' sed $(pwd) export x=1 x=1 2>/dev/null x=1 test
+	"$1" x=1 -eu then x=1 echo
+	${HOME} sed --verbose /usr/bin | awk $(pwd) 'quoted text' printf
+	echo --verbose awk -eu ${HOME} printf /usr/bin sed -eu $(pwd)
+		export test /usr/bin | --verbose printf --verbose --verbose
+		${HOME} --verbose | cd then -eu 2>/dev/null then then cd export --verbose echo printf
+		cd sed 'quoted text' /usr/bin local 'quoted text' && export
+		test -eu ${HOME} echo printf /usr/bin export ${HOME}
+		-eu done $(pwd) then done
+		x=1 printf printf "$1" $(pwd) /usr/bin printf grep done ${HOME}
+--verbose -eu -eu echo x=1 ${HOME} done test test grep echo
+	readonly --verbose $(pwd) ${HOME} "$1" /usr/bin export echo
+		| $(pwd) -eu $(pwd) done $(pwd) /usr/bin awk -eu cd x=1
+	local -eu | "$1" "$1" done sed sed
+2>/dev/null then 2>/dev/null 'quoted text' cd echo
+	"$1" "$@" cd 2>/dev/null readonly
+	-eu "$@" export --verbose readonly /usr/bin
+$(pwd) sed 2>/dev/null -eu 2>/dev/null
+	then grep 2>/dev/null
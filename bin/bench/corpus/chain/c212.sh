@@ -0,0 +1,2001 @@
+		grep -eu done readonly sed /usr/bin cd printf "$1" $(pwd) ${HOME}
+		"$1" done | grep readonly printf echo grep "$1" /usr/bin
+		"$1" export ${HOME} 2>/dev/null local "$1"
+	export readonly echo then $(pwd) 2>/dev/null && 2>/dev/null then -eu x=1 'quoted text'
+sed -eu printf grep && x=1 ${HOME} "$1" && export sed "$@" done --verbose
+export test printf echo test | -eu local && | "$1" "$1" grep cd --verbose
+	then --verbose x=1 2>/dev/null done "$@" readonly export 'quoted text' sed | "$1"
+test --verbose -eu | done "$@" printf --verbose
+		--verbose x=1 -eu -eu "$@" 2>/dev/null
+	2>/dev/null x=1 printf local 2>/dev/null local /usr/bin $(pwd)
+		'quoted text' -eu printf && readonly -eu awk "$@" x=1 'quoted text' sed 'quoted text'
+${HOME} sed 2>/dev/null ${HOME} 2>/dev/null
+sed local /usr/bin then -eu then echo /usr/bin sed x=1 | echo grep cd
+	/usr/bin readonly export 2>/dev/null "$@" sed && 2>/dev/null | grep then test readonly
+	--verbose then test 2>/dev/null | x=1 done
+awk done --verbose echo awk local
+	"$1" test $(pwd) awk local && 2>/dev/null sed then echo export echo "$1"
+cd export echo | done then |
+	x=1 | && readonly sed ${HOME} $(pwd) then 'quoted text' sed
+		${HOME} printf -eu echo /usr/bin
+		printf sed readonly ${HOME} "$1" cd
+	export --verbose -eu $(pwd) sed sed ${HOME} --verbose
+	2>/dev/null export --verbose readonly && printf | /usr/bin
+		${HOME} "$1" sed awk then -eu sed export readonly "$1"
+--verbose 'quoted text'
+grep 2>/dev/null "$@" "$1" sed $(pwd) sed sed 2>/dev/null ${HOME} $(pwd)
+| sed "$@" "$1" export
+${HOME} test printf awk cd x=1 "$@" --verbose test
+		--verbose /usr/bin 'quoted text' "$1"
+	"$@" | -eu --verbose echo echo $(pwd) export readonly cd $(pwd) cd --verbose
+awk readonly grep && readonly && sed ${HOME}
+	awk readonly cd echo done "$1" $(pwd) x=1 grep cd 'quoted text'
+		readonly && local /usr/bin /usr/bin /usr/bin --verbose ${HOME}
+	printf export readonly ${HOME} /usr/bin sed
+	export ${HOME} cd awk export ${HOME}
+printf --verbose test awk then sed x=1 "$1" done --verbose
+	local then local echo export echo test sed echo awk printf
+cd echo x=1 "$@" printf x=1 2>/dev/null "$1" done 'quoted text' cd cd x=1 grep
+	cd echo cd printf 2>/dev/null test sed 'quoted text' echo "$1" grep ${HOME} awk
+		| local ${HOME} "$1" local export 2>/dev/null 2>/dev/null 'quoted text' "$@"
+printf --verbose 'quoted text'
+		| export sed sed /usr/bin --verbose printf sed
+cd done --verbose -eu sed && export
+		| 'quoted text' "$1" && export awk echo local 2>/dev/null
+--verbose $(pwd) "$1" $(pwd) sed 2>/dev/null -eu /usr/bin "$1" 2>/dev/null
+		cd -eu local then -eu printf done echo printf grep sed /usr/bin $(pwd)
+		"$@" cd "$@" printf --verbose 2>/dev/null
+	2>/dev/null ${HOME} ${HOME}
+	--verbose "$@" --verbose && done done
+	/usr/bin readonly ${HOME} echo -eu | 'quoted text'
+	export grep $(pwd) && 'quoted text' --verbose
+		/usr/bin then done awk cd local printf "$@" export ${HOME}
+test "$@" awk ${HOME} x=1 test "$1" 2>/dev/null 'quoted text'
+		printf /usr/bin test sed local /usr/bin ${HOME} awk
+		"$@" awk $(pwd) -eu 2>/dev/null
+	local 'quoted text' 'quoted text'
+		echo export ${HOME} export "$1" "$@" test $(pwd) cd "$1"
+	cd awk grep then | --verbose export
+	readonly | grep $(pwd) ${HOME} ${HOME} $(pwd)
+x=1 "$1" then --verbose cd printf --verbose cd printf awk echo 'quoted text'
+	echo awk $(pwd) local readonly
+export ${HOME} cd done local $(pwd) local x=1 /usr/bin then echo
+		done $(pwd) echo export x=1 printf readonly test sed
+2>/dev/null -eu "$@" test local
+$(pwd) echo cd then export "$1" local printf echo && readonly
+		-eu done x=1 sed cd export "$@" grep
+	${HOME} $(pwd) then awk x=1
+export $(pwd) && readonly local cd awk "$1" grep "$1" -eu x=1 "$1" -eu
+	printf cd ${HOME} /usr/bin awk sed /usr/bin local test
+awk "$@" && awk /usr/bin 2>/dev/null awk local 'quoted text'
+readonly x=1 "$@" cd test awk readonly cd 'quoted text'
+&& then && ${HOME} echo export 'quoted text' && test awk "$1" ${HOME} x=1
+$(pwd) cd export ${HOME}
+printf awk | && -eu "$@" export grep 'quoted text' sed printf export "$@"
+	done && $(pwd) export export x=1
+		'quoted text' echo sed 2>/dev/null | cd
+		&& $(pwd) export x=1 $(pwd) --verbose 'quoted text'
+		then then 2>/dev/null
+		/usr/bin local x=1 sed echo x=1
+awk 2>/dev/null | printf "$1"
+	--verbose local export echo echo local --verbose "$@" echo cd
+		&& $(pwd) then done 2>/dev/null
+		2>/dev/null 2>/dev/null /usr/bin printf | printf ${HOME} test $(pwd) echo |
+local cd export sed "$@" test test x=1 ${HOME} 'quoted text' "$1"
+	"$1" echo && /usr/bin echo then grep printf then export && echo awk cd readonly
+		awk then "$1" export "$@" sed sed local export cd echo -eu | done cd ${HOME}
+	--verbose x=1 | echo -eu 2>/dev/null
+		&& printf grep 'quoted text' x=1 then | && test "$1" --verbose
+"$1" done awk --verbose -eu --verbose /usr/bin | echo $(pwd) sed
+		sed then /usr/bin sed done printf 2>/dev/null $(pwd)
+	test printf --verbose cd cd echo done done &&
+readonly $(pwd) x=1 x=1 awk local && awk done && && && 'quoted text' &&
+		"$1" "$1" --verbose export grep --verbose local sed "$@" 'quoted text'
+done awk $(pwd) -eu "$1" 'quoted text' local export &&
+local echo -eu ${HOME} -eu readonly 'quoted text'
+		cd awk sed sed then -eu 'quoted text' --verbose awk "$1" then | grep -eu |
+		printf x=1 done done sed 'quoted text' test local grep local export
+readonly && x=1 | 2>/dev/null && test
+		done 'quoted text' 2>/dev/null | /usr/bin printf
+		cd && ${HOME} --verbose "$@" printf grep "$1" export
+		| readonly awk 2>/dev/null readonly readonly printf awk
+2>/dev/null | awk echo then test echo then
+		export local "$1" | x=1 --verbose
+	x=1 ${HOME} test done test "$@" "$1" "$1" echo "$@" export
+test readonly echo /usr/bin && awk grep done echo local -eu sed echo
+awk "$1" export ${HOME} done awk grep cd /usr/bin
+	readonly /usr/bin local --verbose | ${HOME} readonly -eu "$@" local --verbose
+	grep ${HOME} test 'quoted text' export test | echo
+		readonly x=1 sed $(pwd)
+	cd then sed local test $(pwd) local /usr/bin $(pwd)
+	test printf export done
+		/usr/bin "$1" grep $(pwd) 'quoted text'
+'quoted text' /usr/bin sed readonly
+${HOME} "$@" -eu -eu -eu /usr/bin grep "$@" $(pwd) /usr/bin "$1" sed printf then
+$(pwd) -eu 'quoted text'
+"$1" "$1" echo $(pwd) $(pwd) cd grep printf awk local grep local then cd export
+local readonly /usr/bin sed 'quoted text' $(pwd) local echo done "$1"
+${HOME} && /usr/bin 'quoted text' $(pwd) && -eu ${HOME} cd export echo awk
+local awk 2>/dev/null printf readonly local && test && 2>/dev/null --verbose
+	then echo local /usr/bin "$1" then /usr/bin sed &&
+| 2>/dev/null 'quoted text' printf echo ${HOME} sed |
+		2>/dev/null "$@" "$@" grep "$1" export printf
+		done test $(pwd) cd /usr/bin --verbose readonly ${HOME}
+then -eu ${HOME} "$1" cd then -eu echo "$1"
+		then 2>/dev/null grep "$@"
+"$1" echo sed $(pwd) x=1 2>/dev/null export 2>/dev/null done 'quoted text' | |
+	sed --verbose done echo then readonly | "$1" "$@"
+	${HOME} | cd done then /usr/bin 'quoted text'
+x=1 "$1" && test echo | -eu | sed sed ${HOME}
+"$1" 2>/dev/null | ${HOME} "$1" ${HOME} done printf local /usr/bin
+$(pwd) readonly export local done sed printf
+		export | ${HOME} x=1 cd grep awk done
+		--verbose export echo x=1 $(pwd)
+	'quoted text' "$@" -eu -eu local $(pwd) readonly --verbose awk "$@" | && /usr/bin
+	done readonly && test grep printf --verbose 'quoted text'
+	local 2>/dev/null --verbose
+	test 2>/dev/null then
+done && test ${HOME} /usr/bin
+local x=1 done 2>/dev/null local export
+export echo ${HOME} cd $(pwd) export -eu "$1" --verbose 2>/dev/null
+	/usr/bin grep test cd -eu export 'quoted text' -eu "$@" $(pwd)
+		local x=1 $(pwd) /usr/bin && printf sed test --verbose "$1" && "$1" && echo
+	export cd ${HOME} cd export readonly ${HOME} "$@" 2>/dev/null
+	| 2>/dev/null --verbose done -eu local
+		readonly "$1" test test awk && ${HOME}
+	"$1" test echo "$@" done /usr/bin done
+grep && 'quoted text' printf export | readonly printf x=1 "$@" echo sed | test
+then 2>/dev/null cd awk && && local 'quoted text' 2>/dev/null
+&& local "$@" "$@" cd x=1 readonly ${HOME} /usr/bin x=1 --verbose awk && && local
+		readonly test x=1 --verbose ${HOME}
+echo echo ${HOME} -eu grep $(pwd) cd $(pwd) ${HOME} 'quoted text' |
+&& grep "$1" 2>/dev/null x=1 awk -eu grep "$1" 'quoted text'
+	--verbose "$@" test ${HOME} echo ${HOME} -eu then -eu export readonly $(pwd)
+${HOME} 2>/dev/null export ${HOME} echo "$1" local /usr/bin
+		printf 'quoted text' 'quoted text'
+x=1 'quoted text' "$1" export export $(pwd)
+		"$1" -eu ${HOME} 'quoted text' readonly
+x=1 readonly awk export echo awk | sed "$1" sed cd | "$1" local
+	cd test "$@" "$1" local
+		printf && sed x=1 && $(pwd) awk test --verbose
+/usr/bin "$1" "$1" --verbose | x=1 --verbose && readonly
+		readonly grep /usr/bin readonly
+		&& 2>/dev/null local export export
+sed && 'quoted text' test | /usr/bin done /usr/bin | echo "$1" export $(pwd)
+grep x=1 printf grep ${HOME}
+$(pwd) done local then -eu x=1 readonly --verbose ${HOME}
+/usr/bin "$1" $(pwd) && readonly /usr/bin local /usr/bin | $(pwd) 2>/dev/null
+		echo then test --verbose && | grep printf awk 2>/dev/null
+then | 2>/dev/null "$1" sed | ${HOME} cd sed awk /usr/bin
+2>/dev/null ${HOME} test ${HOME} printf 2>/dev/null x=1
+		echo grep sed /usr/bin
+-eu "$@" export | awk readonly x=1 | sed cd | 'quoted text' -eu grep grep 'quoted text'
+		export done 2>/dev/null /usr/bin echo cd "$1" printf /usr/bin &&
+		$(pwd) export && /usr/bin grep awk 2>/dev/null
+		readonly "$@" grep && readonly
+then && 'quoted text' x=1 "$@" grep cd export x=1 /usr/bin
+	export /usr/bin awk printf | | "$@" export export
+--verbose --verbose readonly -eu x=1 then /usr/bin
+		"$@" readonly grep "$@" && cd cd 2>/dev/null 'quoted text' test printf --verbose
+	/usr/bin "$@" --verbose -eu test export grep printf then
+	&& grep done /usr/bin /usr/bin done
+		echo "$@" cd 'quoted text' 'quoted text'
+	awk 'quoted text' local local 'quoted text' cd | echo --verbose
+then x=1 done echo awk cd 2>/dev/null readonly
+	| done | 2>/dev/null readonly export
+readonly test ${HOME} x=1 --verbose local --verbose
+	readonly 'quoted text' "$1" 'quoted text' export echo 'quoted text' &&
+		local sed ${HOME} 'quoted text' printf export cd 2>/dev/null done local "$@"
+		test test x=1 ${HOME} ${HOME} && readonly then local "$@"
+'quoted text' readonly awk sed --verbose /usr/bin $(pwd) sed awk echo "$@" then
+		${HOME} sed echo printf export $(pwd)
+awk sed | 'quoted text' && | then printf cd test grep && test local
+	${HOME} --verbose then /usr/bin 'quoted text' && -eu grep 2>/dev/null grep local
+		cd printf x=1 cd done "$@" local readonly --verbose export echo
+		-eu | test --verbose 'quoted text' ${HOME} done grep "$1" -eu readonly
+2>/dev/null awk cd && "$1" done $(pwd) 'quoted text' /usr/bin &&
+		'quoted text' 2>/dev/null /usr/bin
+	local sed | -eu 'quoted text' local done cd "$@" grep cd grep awk && local
+/usr/bin cd printf echo done export done "$@"
+		grep 2>/dev/null -eu export && echo cd cd 2>/dev/null then
+echo printf "$@" awk && --verbose
+		printf | "$@" "$@" 2>/dev/null printf export 2>/dev/null then 'quoted text'
+--verbose x=1 "$@" 'quoted text' grep grep local $(pwd) "$1" ${HOME} readonly x=1
+		| cd -eu "$@" done awk /usr/bin echo x=1 readonly 2>/dev/null readonly export
+&& cd -eu sed readonly --verbose
+export 2>/dev/null && readonly awk $(pwd) "$1" | "$@" /usr/bin x=1
+		x=1 test done --verbose -eu -eu
+sed x=1 | /usr/bin readonly --verbose test -eu then "$@" local "$1" test
+	printf x=1 $(pwd) | 2>/dev/null printf then $(pwd) /usr/bin
+		readonly local | test printf | $(pwd) x=1 sed --verbose -eu echo grep done --verbose
+	sed readonly awk | test 'quoted text' grep && awk local
+${HOME} /usr/bin 2>/dev/null test /usr/bin grep 2>/dev/null x=1 sed cd cd | | "$@"
+		| "$@" test | /usr/bin printf "$1" done awk /usr/bin cd readonly export test
+/usr/bin test "$@" --verbose test sed local ${HOME} printf sed /usr/bin
+readonly x=1 then $(pwd) && $(pwd) "$1" 'quoted text'
+echo readonly then grep 2>/dev/null
+local | "$1" && grep echo -eu x=1 x=1 "$1" sed -eu test local
+	${HOME} local echo then
+awk export printf ${HOME} 2>/dev/null "$@" sed echo "$@" local export --verbose
+	'quoted text' awk x=1 awk export 'quoted text' "$@" x=1
+'quoted text' grep /usr/bin echo "$@" grep export done | export $(pwd) done
+-eu readonly ${HOME} test -eu echo export readonly printf sed cd export
+echo 'quoted text' printf cd grep then -eu awk done grep
+	local grep ${HOME} sed sed ${HOME} done export test grep local grep && done
+	grep awk 2>/dev/null --verbose done printf echo "$@" export local -eu export test
+then echo awk grep -eu 'quoted text' "$1" 2>/dev/null done readonly
+	local then && && $(pwd) $(pwd) ${HOME} export printf x=1 done readonly
+	${HOME} && printf local | done && -eu echo sed && then test /usr/bin
+awk --verbose 'quoted text' "$1" then && /usr/bin 'quoted text'
+		test cd $(pwd) 'quoted text' ${HOME} done
+	readonly export awk echo
+		export x=1 | 2>/dev/null "$@" x=1
+		x=1 printf 'quoted text' 'quoted text' cd --verbose
+printf cd -eu grep cd test grep x=1 "$@" --verbose echo 'quoted text'
+	$(pwd) 2>/dev/null 'quoted text' export $(pwd) export 'quoted text'
+x=1 "$@" /usr/bin --verbose readonly grep 2>/dev/null local export
+	local 2>/dev/null echo /usr/bin local x=1
+		| local x=1 --verbose "$@" --verbose printf &&
+printf grep local 2>/dev/null awk local export 2>/dev/null
+	&& then | ${HOME} done
+	/usr/bin "$1" && $(pwd) test | && export 'quoted text' ${HOME}
+	/usr/bin "$@" done ${HOME} test ${HOME} cd 2>/dev/null x=1 -eu
+		/usr/bin /usr/bin | 'quoted text'
+	&& $(pwd) ${HOME} $(pwd) 'quoted text'
+	${HOME} then test grep x=1 local ${HOME} grep ${HOME} "$1"
+&& | grep /usr/bin /usr/bin $(pwd) 2>/dev/null done "$1" echo ${HOME}
+		grep readonly awk then ${HOME}
+grep printf | --verbose /usr/bin | local
+		-eu -eu $(pwd) | --verbose ${HOME} cd done awk --verbose
+"$@" ${HOME} $(pwd) "$1" echo
+	&& export | sed then readonly --verbose -eu cd local readonly test
+local 2>/dev/null sed "$@" --verbose -eu 'quoted text'
+| test done test -eu "$1"
+		printf printf "$1" grep $(pwd)
+	test test | $(pwd) ${HOME} sed /usr/bin && sed 'quoted text' local grep awk
+	awk echo printf 'quoted text' export -eu 2>/dev/null awk -eu local ${HOME}
+export --verbose --verbose grep && && then printf grep /usr/bin
+	| $(pwd) --verbose cd /usr/bin cd $(pwd) -eu sed "$@" awk ${HOME} x=1 "$1" $(pwd)
+	export grep 'quoted text' && 2>/dev/null x=1 'quoted text'
+grep "$1" 2>/dev/null grep grep "$@"
+$(pwd) 'quoted text' x=1 done grep readonly
+		local readonly -eu done printf test done printf local echo grep readonly
+export 2>/dev/null grep -eu done $(pwd) 2>/dev/null printf awk | grep awk "$1"
+		test echo done -eu printf
+${HOME} $(pwd) $(pwd) echo awk $(pwd)
+printf done 'quoted text' echo 2>/dev/null
+		"$1" then cd readonly && sed "$1"
+		-eu 2>/dev/null ${HOME} --verbose then 2>/dev/null readonly echo -eu
+2>/dev/null sed test cd printf 'quoted text' awk
+printf --verbose sed readonly
+	"$1" -eu done echo awk ${HOME} $(pwd) $(pwd) local awk grep readonly
+		export --verbose then printf "$1" | -eu 'quoted text'
+	-eu 'quoted text' sed
+	--verbose ${HOME} readonly awk "$1" printf local done --verbose
+	cd awk test readonly
+	"$1" echo local awk $(pwd) grep readonly /usr/bin
+cd "$1" local grep readonly | export 'quoted text' x=1
+	&& awk ${HOME} test awk grep | -eu local
+		| | | printf && -eu /usr/bin
+		printf awk $(pwd) done local test done export | awk sed
+done grep export readonly grep ${HOME} | "$@" grep &&
+printf /usr/bin --verbose | awk readonly done sed
+export local "$@" "$@" "$1"
+	$(pwd) 'quoted text' | readonly --verbose sed 'quoted text' "$1" awk
+		"$1" 'quoted text' x=1 -eu $(pwd)
+	--verbose x=1 $(pwd) readonly
+		"$1" local /usr/bin grep sed 'quoted text'
+	export test "$1" /usr/bin local "$1" awk -eu cd 2>/dev/null echo local 'quoted text'
+then -eu 'quoted text' awk && ${HOME}
+		/usr/bin grep $(pwd) awk ${HOME} echo && printf
+	'quoted text' echo then "$1" 'quoted text'
+	-eu ${HOME} ${HOME} sed "$@" local sed export echo | ${HOME} sed | &&
+		printf grep "$@" "$1" ${HOME} && 'quoted text'
+&& --verbose awk grep local && ${HOME}
+awk 'quoted text' done /usr/bin x=1 "$@" grep local grep
+2>/dev/null export grep done printf test ${HOME} done
+		done /usr/bin sed "$1" -eu
+		2>/dev/null --verbose ${HOME} echo x=1 awk
+	cd | 2>/dev/null awk export cd done $(pwd) "$1" 2>/dev/null
+	export cd local -eu "$@" local export sed test "$@" done echo local cd |
+cd "$@" cd $(pwd) 2>/dev/null
+	test "$1" echo 'quoted text' /usr/bin 2>/dev/null
+| grep done ${HOME} && export echo
+"$1" export sed "$1" test local 2>/dev/null
+		then awk ${HOME} --verbose sed && printf --verbose echo cd 'quoted text'
+		&& x=1 printf /usr/bin grep readonly local $(pwd) done $(pwd) && 'quoted text'
+x=1 'quoted text' local grep
+&& then /usr/bin sed /usr/bin printf $(pwd) "$1" grep local grep /usr/bin sed
+	'quoted text' test readonly test export awk "$1" test 'quoted text' | awk 2>/dev/null
+		&& ${HOME} sed --verbose awk --verbose done sed | && 'quoted text' --verbose 'quoted text'
+		| ${HOME} sed then export -eu printf -eu x=1 'quoted text'
+		2>/dev/null export cd -eu printf printf printf export "$1" readonly x=1 done
+cd 2>/dev/null then done local local 2>/dev/null
+		--verbose --verbose | sed --verbose then cd cd awk | awk grep
+	local then done sed sed local echo && grep -eu -eu export --verbose 2>/dev/null
+	&& ${HOME} ${HOME} local | test readonly "$1" -eu $(pwd) test readonly -eu
+	"$@" cd ${HOME} "$1" echo && export --verbose printf
+	echo grep export | test 2>/dev/null --verbose done ${HOME}
+	done printf | $(pwd) 'quoted text'
+		then readonly --verbose grep readonly printf ${HOME} ${HOME} local --verbose
+		&& x=1 /usr/bin 2>/dev/null "$@" grep test | -eu cd printf export test
+		${HOME} readonly x=1 cd 'quoted text' ${HOME} export local ${HOME}
+	| then && awk grep --verbose -eu done
+		sed /usr/bin "$1" test
+'quoted text' $(pwd) --verbose
+2>/dev/null /usr/bin "$1" | /usr/bin "$1" x=1 sed awk test "$1"
+	| /usr/bin readonly awk && readonly -eu "$@" awk -eu "$1" then 'quoted text'
+	x=1 echo -eu test | local export
+		"$1" grep "$@" grep | readonly export
+test "$@" then ${HOME} awk -eu x=1 awk --verbose local printf then sed
+		&& then test local "$@" local export echo
+	then | awk readonly -eu readonly cd | readonly
+		then "$1" 'quoted text' "$@" export test local readonly awk readonly
+	done awk 2>/dev/null sed readonly "$@" 2>/dev/null
+	grep printf test && ${HOME} local "$1" local echo
+	/usr/bin && 2>/dev/null && readonly /usr/bin then "$@" sed then /usr/bin
+	| export export grep --verbose
+		echo done --verbose grep echo | $(pwd)
+	readonly test local done x=1 grep local test $(pwd) printf then $(pwd)
+	awk then local ${HOME} "$1"
+sed -eu /usr/bin sed "$@" ${HOME} done test export readonly then
+readonly local echo | "$1" ${HOME} done test x=1 | grep
+		done $(pwd) test readonly echo ${HOME} readonly
+$(pwd) local readonly "$1" -eu ${HOME}
+	echo readonly /usr/bin grep local local grep done /usr/bin
+| 2>/dev/null && x=1 'quoted text' x=1 -eu $(pwd)
+	2>/dev/null printf && ${HOME} -eu sed done test
+	"$1" grep && test test --verbose local "$1" ${HOME}
+'quoted text' "$1" 2>/dev/null sed grep
+	'quoted text' 'quoted text'
+local x=1 x=1 $(pwd) "$1" "$1"
+	sed $(pwd) export && local
+		export awk -eu | echo echo readonly echo /usr/bin ${HOME}
+done echo printf ${HOME} export test readonly 2>/dev/null ${HOME} cd test local
+2>/dev/null test sed -eu local /usr/bin
+test --verbose test awk echo
+	sed done readonly | $(pwd) export
+		grep local then awk -eu -eu sed | -eu cd cd echo | then
+		$(pwd) ${HOME} $(pwd) grep done printf then readonly then x=1 ${HOME} test --verbose
+"$@" done sed ${HOME} printf -eu /usr/bin done then readonly "$@" echo |
+	/usr/bin cd | export "$1" cd printf printf sed printf
+		sed 2>/dev/null && done cd awk --verbose awk grep
+	printf /usr/bin x=1 && && printf
+	"$@" $(pwd) | /usr/bin && /usr/bin local
+done done --verbose /usr/bin ${HOME} 'quoted text'
+	printf grep sed 2>/dev/null readonly export &&
+		${HOME} x=1 grep sed test | "$1" sed -eu test echo ${HOME} awk | ${HOME}
+grep echo 2>/dev/null && then && done "$1" local local done x=1 "$@" done export
+		'quoted text' grep 'quoted text' -eu local sed local readonly /usr/bin 2>/dev/null
+		/usr/bin | /usr/bin $(pwd) x=1 | grep "$@" /usr/bin cd "$1" cd echo 2>/dev/null
+	x=1 "$@" sed ${HOME} /usr/bin cd x=1 grep readonly 'quoted text'
+		-eu awk awk local export done grep x=1 sed ${HOME}
+printf ${HOME} test x=1 -eu && x=1 echo readonly "$1"
+	${HOME} "$@" grep "$@" x=1 && $(pwd) test && export
+		'quoted text' /usr/bin x=1 ${HOME} "$1" x=1 --verbose export
+		test 'quoted text' | then echo "$@" | "$@" "$@" test 'quoted text'
+		${HOME} | "$1" then -eu readonly -eu | x=1 cd ${HOME}
+"$@" readonly printf && "$1" | | grep test then grep | /usr/bin test export x=1
+	'quoted text' awk /usr/bin --verbose ${HOME} sed echo readonly $(pwd)
+		cd ${HOME} done "$@" && "$1" && x=1 awk
+	${HOME} $(pwd) sed $(pwd) cd $(pwd) sed printf ${HOME} grep readonly
+	| echo | 'quoted text' then printf "$1" readonly cd test
+echo then x=1 grep x=1 cd
+		${HOME} echo && then awk "$@" --verbose awk readonly export /usr/bin ${HOME}
+sed 'quoted text' done
+	'quoted text' export "$@" test grep grep "$1" -eu 2>/dev/null x=1 $(pwd)
+awk | 'quoted text' grep | 2>/dev/null 2>/dev/null grep export
+	2>/dev/null "$@" then local readonly echo
+		"$@" ${HOME} echo local
+	x=1 x=1 "$@" ${HOME} test test grep test -eu printf 'quoted text' $(pwd)
+	${HOME} $(pwd) then done 2>/dev/null grep cd
+grep "$1" -eu cd then 'quoted text' "$1" grep echo "$@"
+	readonly echo test local cd 'quoted text'
+		$(pwd) grep sed && x=1 echo /usr/bin && cd export export --verbose 'quoted text'
+echo cd then "$@" export 2>/dev/null
+$(pwd) 2>/dev/null awk
+	--verbose test test export && $(pwd)
+$(pwd) | test | export $(pwd)
+	--verbose test awk ${HOME} local printf export && -eu grep echo
+		printf ${HOME} readonly "$@" "$@" readonly
+	echo done echo ${HOME} printf done cd
+	"$1" grep "$1" sed | $(pwd) then readonly
+		done && 2>/dev/null -eu done /usr/bin local done "$1" test $(pwd) test
+	'quoted text' readonly export then 2>/dev/null
+sed 'quoted text' local echo x=1 ${HOME}
+		&& echo 2>/dev/null cd | "$1" printf cd readonly
+		readonly cd $(pwd) printf local "$1" | ${HOME} ${HOME}
+| grep x=1 printf --verbose x=1 echo x=1 awk -eu test export /usr/bin
+	--verbose 'quoted text' "$1" 2>/dev/null "$@" "$@" done local then ${HOME} awk
+		grep then 'quoted text' -eu local "$@" $(pwd) | grep 'quoted text' | --verbose
+then -eu grep 2>/dev/null grep | then
+		/usr/bin -eu grep /usr/bin then "$@" |
+		then ${HOME} /usr/bin | && x=1
+done cd && awk | echo --verbose then readonly cd 2>/dev/null
+		'quoted text' readonly cd readonly
+test grep awk | sed echo
+test printf ${HOME} -eu $(pwd) --verbose x=1 export --verbose 2>/dev/null
+	"$1" "$1" grep -eu "$1" grep && then "$1" "$@"
+		echo printf awk readonly -eu
+	x=1 test done ${HOME} done "$1" 'quoted text' "$@" printf /usr/bin
+		echo $(pwd) sed ${HOME} --verbose awk x=1 "$@" 'quoted text' grep && && ${HOME}
+	x=1 /usr/bin cd done done ${HOME} 2>/dev/null printf sed printf -eu readonly
+then 'quoted text' -eu export $(pwd) cd local x=1 then
+	&& --verbose readonly test /usr/bin
+		then echo readonly awk printf local grep grep sed readonly awk export
+		test "$@" ${HOME} printf awk "$@" --verbose grep then --verbose
+		&& sed grep ${HOME} awk export grep readonly
+	local cd local grep export && /usr/bin cd then test test $(pwd)
+	printf grep done export cd -eu echo x=1 test 2>/dev/null done sed ${HOME}
+		&& -eu --verbose then cd awk $(pwd) grep "$@" then 2>/dev/null export
+readonly awk local 2>/dev/null "$@" echo /usr/bin
+		'quoted text' test $(pwd) "$@" "$1" awk then 'quoted text'
+	$(pwd) ${HOME} x=1 /usr/bin ${HOME} /usr/bin grep export $(pwd) --verbose
+		-eu && cd && x=1 $(pwd) $(pwd)
+		-eu export -eu export /usr/bin test 2>/dev/null done done --verbose
+sed x=1 | && sed test cd readonly echo
+/usr/bin -eu /usr/bin then
+readonly "$@" printf "$@" 'quoted text' x=1 local test then cd
+	readonly ${HOME} sed 2>/dev/null x=1 ${HOME} -eu cd
+then -eu ${HOME} 'quoted text' ${HOME} ${HOME}
+${HOME} "$1" export printf -eu -eu $(pwd) ${HOME} "$@" readonly cd
+	sed printf local grep "$1" 2>/dev/null grep --verbose --verbose export sed 2>/dev/null
+done $(pwd) readonly --verbose /usr/bin /usr/bin | test
+	'quoted text' export readonly
+		--verbose export then awk 'quoted text'
+	printf --verbose /usr/bin sed echo | sed done test readonly | 'quoted text'
+	printf $(pwd) readonly then echo /usr/bin 'quoted text' /usr/bin -eu -eu 2>/dev/null
+${HOME} printf grep echo sed done ${HOME} /usr/bin --verbose readonly
+	grep cd --verbose grep | x=1 readonly awk 2>/dev/null $(pwd) readonly echo |
+2>/dev/null | export 'quoted text' done
+&& --verbose ${HOME} | readonly ${HOME} 2>/dev/null
+	awk test && readonly | /usr/bin
+done readonly readonly printf "$1" x=1 export
+	echo --verbose then | "$@" && $(pwd) "$1" $(pwd) printf cd | grep "$1"
+		-eu 2>/dev/null ${HOME} export "$@" "$1" test test && cd grep then "$@"
+		2>/dev/null echo grep $(pwd) test $(pwd) done local export
+		export --verbose echo ${HOME} then grep /usr/bin x=1 && "$@" /usr/bin readonly
+'quoted text' done /usr/bin ${HOME} sed $(pwd) "$@" $(pwd) x=1
+		then local awk --verbose sed echo x=1 -eu then --verbose ${HOME} done $(pwd)
+		| "$1" test -eu ${HOME} echo 'quoted text'
+test "$@" --verbose printf $(pwd) 2>/dev/null done echo export readonly
+		then echo readonly ${HOME} $(pwd) test
+&& 'quoted text' local then echo printf "$1" && --verbose /usr/bin awk
+awk 2>/dev/null echo "$1" && | "$1" local 2>/dev/null
+awk sed --verbose ${HOME} --verbose 'quoted text' grep export awk 'quoted text'
+local then ${HOME} $(pwd) 'quoted text'
+x=1 ${HOME} echo -eu && x=1 then done awk 2>/dev/null grep
+		/usr/bin printf grep "$@" | ${HOME} -eu 'quoted text' $(pwd) echo 2>/dev/null &&
+--verbose grep | cd 'quoted text' export $(pwd) echo then ${HOME} local
+		2>/dev/null 2>/dev/null awk export test
+	grep ${HOME} | echo sed cd | x=1 cd cd awk printf
+		readonly done awk ${HOME} awk readonly readonly done awk 2>/dev/null --verbose
+	local grep --verbose cd "$1" local ${HOME} readonly 2>/dev/null readonly
+	readonly local test ${HOME} cd /usr/bin 2>/dev/null
+2>/dev/null 2>/dev/null ${HOME} x=1 export then printf "$@" printf done ${HOME}
+	grep test grep sed local grep sed --verbose --verbose export then
+	grep echo "$@" done echo cd grep "$1" -eu local grep -eu grep
+	awk ${HOME} awk /usr/bin --verbose awk "$1" readonly printf 2>/dev/null
+$(pwd) done done cd | done "$1" 2>/dev/null cd printf 'quoted text'
+	2>/dev/null printf 2>/dev/null export
+		printf /usr/bin /usr/bin printf grep 2>/dev/null /usr/bin printf readonly
+		sed sed echo "$1" local then /usr/bin "$1" --verbose test && export
+	$(pwd) printf ${HOME} echo readonly cd local 2>/dev/null
+echo 'quoted text' --verbose
+| cd grep "$1" 2>/dev/null ${HOME} --verbose 2>/dev/null ${HOME} 2>/dev/null
+"$1" && export 2>/dev/null "$1" 2>/dev/null 2>/dev/null
+	"$@" export | readonly $(pwd) test
+-eu $(pwd) readonly 2>/dev/null printf local done done 'quoted text'
+"$1" ${HOME} ${HOME} done export readonly sed
+	echo ${HOME} done then "$1" -eu cd cd local echo $(pwd) "$1"
+&& cd then done grep --verbose -eu readonly
+test "$1" $(pwd) echo echo
+	awk awk --verbose export "$@" grep -eu cd local echo
+		$(pwd) ${HOME} then x=1 2>/dev/null | local $(pwd) "$1" ${HOME} --verbose
+	| local readonly done /usr/bin x=1
+		echo done done awk ${HOME} $(pwd)
+	'quoted text' sed ${HOME} printf 2>/dev/null "$@" sed then 2>/dev/null test "$@"
+"$1" 'quoted text' echo readonly | --verbose test readonly && | local printf
+'quoted text' cd readonly printf "$@" /usr/bin done awk awk
+		local 'quoted text' readonly echo x=1 "$1" x=1 --verbose ${HOME} readonly
+		grep 'quoted text' "$1" --verbose
+	awk 'quoted text' sed then local
+echo local 'quoted text'
+		then local -eu sed /usr/bin
+	/usr/bin $(pwd) local
+		export cd "$1" 'quoted text' readonly then grep 'quoted text'
+	echo "$@" cd awk awk /usr/bin done awk x=1 && ${HOME} 2>/dev/null done printf echo
+sed cd printf printf x=1 printf grep
+		printf 'quoted text' $(pwd) x=1 $(pwd) test local
+echo local | done | echo grep | "$@" export "$1" /usr/bin | "$@" /usr/bin
+		grep export --verbose /usr/bin /usr/bin | --verbose
+$(pwd) local done /usr/bin printf
+		local readonly "$@" sed done
+		${HOME} 'quoted text' -eu "$@" then awk grep then export x=1 done
+	x=1 echo echo && 2>/dev/null printf | printf 'quoted text'
+		export cd 'quoted text' export 2>/dev/null export "$1" 'quoted text' grep awk 2>/dev/null
+	printf "$1" readonly awk --verbose grep sed && "$@" --verbose
+/usr/bin done "$@" | awk sed echo grep 'quoted text'
+2>/dev/null && awk 2>/dev/null readonly
+	--verbose cd 2>/dev/null -eu readonly -eu
+	/usr/bin 'quoted text'
+		-eu | --verbose echo sed
+		echo done export cd && grep /usr/bin test --verbose
+		| local export sed -eu echo --verbose && test
+done export x=1 x=1 printf "$1" readonly
+		-eu --verbose awk then readonly readonly "$1"
+	local 2>/dev/null local
+	echo /usr/bin done echo readonly "$@" done cd 2>/dev/null
+	cd "$@" /usr/bin x=1 export 'quoted text' awk awk "$@" local done
+	readonly -eu $(pwd) readonly && --verbose
+		export grep "$@" grep local printf && "$@" -eu --verbose awk awk
+	$(pwd) ${HOME} cd printf $(pwd) sed cd export --verbose grep
+	export then then /usr/bin sed then
+	local local sed "$@" -eu
+		/usr/bin 2>/dev/null $(pwd) x=1 export /usr/bin
+		test /usr/bin printf --verbose && readonly sed --verbose printf sed "$1" $(pwd)
+	/usr/bin cd sed cd cd --verbose test /usr/bin "$@"
+	export -eu -eu -eu readonly "$@" grep test then ${HOME} export
+&& then "$@" readonly "$1"
+		export "$1" then $(pwd) done x=1 | ${HOME} ${HOME} cd awk | 'quoted text' && readonly
+	then readonly echo --verbose printf
+	&& test "$@" $(pwd) done done readonly
+awk 2>/dev/null "$1"
+		cd cd done export --verbose printf -eu
+	echo grep awk then done then 'quoted text' x=1 sed sed test local
+	'quoted text' echo | 2>/dev/null readonly
+echo local readonly ${HOME} "$@"
+		cd echo "$1" sed | --verbose
+		done then ${HOME} -eu ${HOME} echo 2>/dev/null 'quoted text' awk
+		/usr/bin --verbose local /usr/bin printf
+		local test grep "$@" readonly printf local
+	cd 'quoted text' 2>/dev/null
+	readonly done awk local "$1" ${HOME} /usr/bin /usr/bin local -eu printf
+	${HOME} export awk grep local cd --verbose
+	awk "$@" $(pwd) 'quoted text' | && && printf $(pwd) sed readonly
+		-eu export export local export
+/usr/bin awk && then test -eu /usr/bin $(pwd) && | cd ${HOME} test printf
+		echo -eu "$@" ${HOME} -eu 2>/dev/null 2>/dev/null readonly
+		&& $(pwd) 2>/dev/null x=1 readonly
+		-eu --verbose export
+	grep printf local 2>/dev/null && then export "$@"
+| /usr/bin sed 2>/dev/null grep awk "$1" 2>/dev/null "$@" cd test sed export
+&& grep | echo "$@" ${HOME} --verbose
+${HOME} "$@" /usr/bin done && --verbose test | x=1 x=1
+cd grep $(pwd) readonly ${HOME} readonly then && readonly x=1 && echo local
+	/usr/bin -eu cd local -eu local /usr/bin test --verbose -eu grep test 2>/dev/null
+readonly cd "$1" awk local "$1" -eu test 2>/dev/null echo done local cd
+		printf x=1 | done echo x=1 2>/dev/null | sed readonly $(pwd) sed 2>/dev/null --verbose
+${HOME} /usr/bin test export local grep /usr/bin
+		done awk 2>/dev/null test readonly grep export -eu cd done "$@" local done printf
+		export /usr/bin --verbose printf ${HOME} done && printf test -eu x=1 "$@"
+then 2>/dev/null sed x=1 && printf
+		awk && sed "$@" $(pwd) echo
+	done | /usr/bin && cd cd export | x=1 $(pwd) "$@" grep /usr/bin grep local local
+		$(pwd) grep grep && | 2>/dev/null ${HOME} -eu /usr/bin local awk ${HOME}
+		&& -eu "$1" 2>/dev/null test echo then $(pwd) echo test "$1" readonly
+	grep | /usr/bin | export echo local "$1" done x=1 /usr/bin $(pwd)
+		2>/dev/null cd awk awk "$@"
+	cd done awk x=1 && -eu test "$1" 2>/dev/null
+	awk awk then readonly echo ${HOME} then /usr/bin
+2>/dev/null local x=1 printf readonly
+	local test printf && grep cd then
+	test test test then local readonly test then sed ${HOME}
+		2>/dev/null --verbose
+2>/dev/null printf awk x=1 -eu x=1 --verbose 2>/dev/null | |
+"$@" grep 'quoted text' | local && /usr/bin 'quoted text' && /usr/bin
+		cd 'quoted text' sed sed && "$@" 2>/dev/null /usr/bin --verbose --verbose
+	grep $(pwd) local cd echo -eu awk && readonly grep sed test test ${HOME} "$@"
+		awk printf readonly test
+--verbose export 2>/dev/null | -eu readonly readonly grep grep export test
+	awk "$1" awk echo && echo grep local cd done "$@" 2>/dev/null ${HOME} cd x=1
+		| "$@" $(pwd) ${HOME} grep |
+		${HOME} -eu --verbose cd readonly echo export
+		'quoted text' done export
+		cd readonly awk --verbose --verbose --verbose --verbose && test
+		2>/dev/null --verbose 'quoted text' grep
+		x=1 test readonly done 'quoted text'
+		"$@" /usr/bin /usr/bin 'quoted text'
+	echo x=1 then test $(pwd) awk && export then /usr/bin
+local sed "$@" awk && done ${HOME}
+	/usr/bin "$@" export "$1" 'quoted text' grep done cd | x=1 awk x=1
+		test test local sed readonly readonly x=1 /usr/bin sed
+	sed 2>/dev/null done /usr/bin ${HOME} done done then --verbose 'quoted text' x=1
+		local x=1 printf ${HOME}
+	then 2>/dev/null echo 'quoted text' grep readonly --verbose
+${HOME} /usr/bin readonly local test printf echo
+	done $(pwd) awk | "$1" done echo && x=1 done echo then local awk sed awk awk test
+x=1 | 'quoted text' done printf 2>/dev/null readonly printf "$@" 2>/dev/null echo
+		printf local readonly local sed test awk done "$1" test
+	"$@" then then echo "$1" printf "$@" done test "$1" 'quoted text' sed "$@" 2>/dev/null
+		x=1 ${HOME} cd -eu sed x=1 2>/dev/null echo printf echo $(pwd) | /usr/bin -eu
+	cd 2>/dev/null && -eu awk 'quoted text' "$@" "$1" readonly awk
+	&& x=1 done x=1 readonly 2>/dev/null printf awk && x=1 done 'quoted text'
+	'quoted text' echo then -eu awk local ${HOME} 2>/dev/null
+		sed then export 2>/dev/null
+	"$1" && local echo -eu awk 2>/dev/null
+		then printf echo /usr/bin readonly /usr/bin grep grep $(pwd)
+export printf echo -eu cd then cd sed done | readonly
+		&& 2>/dev/null -eu --verbose echo 2>/dev/null export -eu awk grep "$@" &&
+test done $(pwd) "$@" export "$1" awk grep /usr/bin printf grep
+local done "$1" sed export x=1
+grep x=1 x=1 awk echo $(pwd) echo /usr/bin done local printf then sed -eu printf
+&& $(pwd) export done | export test test ${HOME}
+	--verbose test then test sed export 'quoted text' echo done "$@" cd local
+x=1 cd 'quoted text' && local grep && echo "$1" readonly done
+	&& sed readonly echo && -eu grep then cd 2>/dev/null ${HOME} printf local 2>/dev/null
+	then -eu printf test | "$@" 'quoted text' 'quoted text' grep
+	"$1" 2>/dev/null test ${HOME} printf $(pwd) sed
+		printf then | 'quoted text' done awk
+/usr/bin grep echo done && | $(pwd) grep 'quoted text'
+sed readonly printf | test sed && ${HOME} ${HOME}
+	${HOME} -eu $(pwd) readonly readonly 2>/dev/null
+done done --verbose local readonly "$1" printf readonly
+-eu readonly /usr/bin -eu --verbose ${HOME} /usr/bin "$@" then --verbose printf
+	"$1" then readonly /usr/bin | readonly
+echo 'quoted text' 'quoted text'
+		cd grep grep done 2>/dev/null grep 'quoted text' sed
+	grep echo test export --verbose 'quoted text' | sed /usr/bin --verbose done
+		'quoted text' 'quoted text' x=1 sed echo then
+local x=1 | cd | 2>/dev/null | printf $(pwd)
+	$(pwd) $(pwd) cd sed && sed cd local "$1" local sed sed cd $(pwd) cd $(pwd) | export
+		export export --verbose /usr/bin "$1" then
+test then grep && cd --verbose
+	$(pwd) grep export | && export grep done
+grep -eu x=1 -eu sed local echo awk export printf /usr/bin ${HOME} local then
+$(pwd) ${HOME} test then
+	&& ${HOME} /usr/bin cd local 2>/dev/null
+		2>/dev/null ${HOME} grep $(pwd) x=1 "$1" $(pwd) -eu "$1"
+	cd --verbose sed 'quoted text' then test /usr/bin --verbose readonly
+		2>/dev/null x=1 done | 'quoted text' cd done && done
+cd export printf /usr/bin $(pwd) grep then awk readonly local sed
+		2>/dev/null | $(pwd) echo x=1 printf
+		readonly 'quoted text'
+	"$1" export "$@" echo 2>/dev/null
+echo sed printf awk -eu $(pwd) --verbose 2>/dev/null
+	done 'quoted text' --verbose $(pwd)
+	"$@" x=1 | cd sed readonly "$1" test --verbose
+	local x=1 2>/dev/null then cd x=1 export /usr/bin 'quoted text'
+		printf sed cd --verbose export 'quoted text'
+done echo awk test ${HOME} ${HOME} 'quoted text' export 2>/dev/null 'quoted text'
+then 2>/dev/null $(pwd) awk && --verbose then export && grep x=1 then && 'quoted text'
+		'quoted text' $(pwd) local awk 2>/dev/null /usr/bin readonly 2>/dev/null ${HOME}
+	"$1" readonly grep "$@" printf "$@" /usr/bin cd $(pwd) cd "$@" test
+		export echo readonly test test
+		local printf "$1" "$@" $(pwd) done test 'quoted text'
+done 'quoted text' export x=1 && && x=1 'quoted text'
+echo -eu | test --verbose done
+		${HOME} 2>/dev/null $(pwd) awk $(pwd) "$1" ${HOME} |
+/usr/bin 2>/dev/null
+	/usr/bin ${HOME} local readonly "$@" ${HOME} --verbose grep 2>/dev/null
+${HOME} then "$@" echo readonly "$1" -eu -eu export
+then $(pwd) export then | x=1 "$@"
+		"$@" | readonly --verbose x=1 | /usr/bin ${HOME} /usr/bin readonly grep printf
+		'quoted text' echo && /usr/bin && then "$@" cd 'quoted text' && 'quoted text'
+		echo && cd /usr/bin --verbose done
+	&& | $(pwd) x=1 echo $(pwd)
+export sed && local x=1 test -eu 2>/dev/null
+		2>/dev/null ${HOME} cd "$1" "$1" |
+&& readonly sed "$1" "$1" $(pwd) --verbose x=1 sed readonly
+	done export done local && done "$1" $(pwd) cd test grep "$1" grep x=1
+x=1 done -eu "$@" then
+		&& x=1 "$1" --verbose /usr/bin echo awk sed && /usr/bin printf
+		/usr/bin "$@" grep | export done export -eu --verbose "$@" cd sed echo
+	${HOME} export grep ${HOME} echo /usr/bin test ${HOME} readonly ${HOME} -eu
+'quoted text' test export 2>/dev/null 'quoted text' then printf && printf
+	echo --verbose sed sed echo done printf cd "$1" ${HOME} grep $(pwd)
+		export done cd /usr/bin printf done -eu cd sed ${HOME} x=1 local
+		-eu /usr/bin then cd printf 2>/dev/null && "$1" done | | local done 'quoted text'
+	${HOME} -eu -eu 2>/dev/null readonly export cd cd "$1" | 2>/dev/null grep &&
+/usr/bin "$1" done cd printf ${HOME} grep awk
+	--verbose $(pwd) export grep 'quoted text' printf export 2>/dev/null
+'quoted text' -eu $(pwd) "$1" grep $(pwd) awk 2>/dev/null local ${HOME}
+		echo "$1" && | x=1 x=1 cd printf
+printf local then /usr/bin -eu $(pwd)
+cd done grep 'quoted text'
+		x=1 ${HOME} ${HOME} $(pwd) 'quoted text' test "$@"
+	'quoted text' awk x=1 && ${HOME} grep cd grep awk "$1" --verbose echo
+echo | cd 2>/dev/null x=1 readonly
+	${HOME} printf readonly /usr/bin --verbose
+		test local $(pwd) sed
+	printf -eu $(pwd) local -eu x=1 x=1 "$@" printf local
+	grep -eu -eu test echo test /usr/bin echo awk 2>/dev/null
+	$(pwd) 2>/dev/null "$@" sed "$1" /usr/bin && export export local
+		/usr/bin | x=1 --verbose
+	'quoted text' 2>/dev/null --verbose done && "$1" 'quoted text' grep sed "$1"
+		-eu then 2>/dev/null --verbose printf local printf && x=1 "$@"
+		export readonly awk ${HOME} echo -eu local x=1 done
+		| | ${HOME} done readonly echo -eu local
+&& 'quoted text' grep grep local ${HOME} --verbose grep then
+	| && sed 'quoted text' -eu "$@" printf 'quoted text'
+		2>/dev/null done -eu 2>/dev/null sed "$1" readonly export ${HOME} -eu test
+	then $(pwd) cd grep awk
+		awk /usr/bin local local -eu echo cd sed then $(pwd)
+		grep "$1" --verbose readonly export | 'quoted text'
+	"$@" && test 2>/dev/null 2>/dev/null readonly
+		2>/dev/null awk 2>/dev/null $(pwd) sed
+		printf /usr/bin $(pwd) "$1" then
+2>/dev/null ${HOME} && 'quoted text' readonly export --verbose
+		--verbose ${HOME} cd "$1" then
+		| grep --verbose /usr/bin ${HOME}
+printf && export | ${HOME} $(pwd) /usr/bin 'quoted text' readonly grep 2>/dev/null
+	"$1" $(pwd) /usr/bin readonly 'quoted text' sed "$@" 'quoted text' --verbose /usr/bin
+		grep echo cd ${HOME} x=1 then 2>/dev/null echo readonly
+		2>/dev/null $(pwd) "$@" cd "$1" | awk echo /usr/bin
+x=1 printf then ${HOME} --verbose "$1"
+&& $(pwd) ${HOME} "$1"
+then -eu sed sed done 'quoted text' echo /usr/bin 2>/dev/null | awk ${HOME} 'quoted text'
+		| readonly 2>/dev/null export sed $(pwd) sed test grep --verbose
+		sed 'quoted text' --verbose
+/usr/bin "$@" | printf test
+	"$1" -eu then -eu 2>/dev/null
+	/usr/bin x=1 echo ${HOME} sed -eu $(pwd)
+x=1 "$1" 2>/dev/null
+		2>/dev/null "$1" sed grep --verbose ${HOME} readonly export test x=1
+		printf --verbose local echo | "$1"
+		cd x=1 ${HOME} readonly readonly
+	test 'quoted text' "$@" "$@" $(pwd) 2>/dev/null
+		cd --verbose /usr/bin awk /usr/bin echo local
+		x=1 echo 2>/dev/null | done local
+	readonly grep cd -eu export ${HOME} ${HOME} local $(pwd) then
+	--verbose | && "$@" readonly /usr/bin
+	test "$@" x=1 printf cd $(pwd) export ${HOME}
+	"$1" local ${HOME} $(pwd) && "$@" -eu x=1 "$@" test
+"$1" x=1 grep | sed -eu cd then export readonly 'quoted text' printf sed 2>/dev/null
+	$(pwd) then ${HOME} printf
+		echo done | | sed && cd grep 2>/dev/null local ${HOME}
+		"$1" 'quoted text' sed local -eu "$1" sed local x=1 test /usr/bin
+		done x=1 printf sed export --verbose export
+		"$1" "$1" sed cd echo 'quoted text' test echo 2>/dev/null
+	echo /usr/bin --verbose done | /usr/bin
+		done done awk local -eu local "$@" echo -eu grep
+		x=1 x=1 local sed done $(pwd) "$@" &&
+2>/dev/null $(pwd) grep test
+		$(pwd) && $(pwd) && && sed $(pwd) $(pwd) 2>/dev/null "$1" awk -eu printf
+	cd "$@" local awk done x=1 --verbose cd
+	"$1" test readonly cd 2>/dev/null 2>/dev/null readonly done && local --verbose echo
+awk printf cd $(pwd) "$1" done awk "$1" 'quoted text'
+	echo readonly export -eu local -eu echo && echo 2>/dev/null
+		awk test 2>/dev/null echo /usr/bin "$1" cd /usr/bin readonly export "$@"
+		$(pwd) && && "$@" then
+	test awk sed local local | && readonly x=1 done "$1" local echo then
+		'quoted text' 2>/dev/null "$1" echo printf grep 2>/dev/null then --verbose
+		then -eu $(pwd) done local && "$@" printf then 'quoted text'
+		$(pwd) printf local grep then && export awk x=1 2>/dev/null awk done then
+"$1" 2>/dev/null readonly -eu 'quoted text' "$1" grep local -eu export
+	/usr/bin grep | export --verbose $(pwd) "$1" --verbose export then
+		readonly then readonly 'quoted text' export
+	cd && && local test $(pwd) "$@" sed "$1" && 2>/dev/null x=1 export grep sed sed
+		x=1 && -eu x=1 $(pwd) done "$1" && echo "$1" 2>/dev/null printf | echo $(pwd)
+		printf && grep printf
+	--verbose "$1" sed $(pwd) "$@" local 2>/dev/null test
+export test 2>/dev/null printf -eu -eu done
+2>/dev/null /usr/bin x=1 && sed && /usr/bin
+	grep | && -eu /usr/bin ${HOME}
+		/usr/bin -eu sed printf done test && -eu 'quoted text'
+		awk $(pwd) readonly grep "$@" 2>/dev/null grep awk 2>/dev/null 2>/dev/null -eu echo
+/usr/bin -eu && x=1 2>/dev/null done echo test x=1 done "$1" x=1 "$1"
+		sed export printf "$1" 'quoted text' sed "$@" done local done 2>/dev/null
+export sed 2>/dev/null printf printf printf 2>/dev/null
+	sed -eu grep grep printf readonly sed awk && | && sed then printf
+		-eu 'quoted text' done
+		sed sed $(pwd) grep ${HOME} 'quoted text' -eu echo --verbose test
+		| cd export --verbose /usr/bin readonly &&
+		&& 2>/dev/null sed -eu "$1" done $(pwd) && -eu
+done && -eu 'quoted text' printf printf "$1" | /usr/bin -eu sed "$1" readonly
+$(pwd) "$1" then $(pwd) x=1 then sed then printf readonly test ${HOME}
+		| "$1" $(pwd) sed "$@"
+		awk grep 2>/dev/null then printf x=1 export
+	readonly "$1" export readonly readonly echo grep test then export local
+		local export x=1 /usr/bin /usr/bin grep "$1" cd
+	local test --verbose /usr/bin printf sed &&
+	cd export $(pwd) && export -eu $(pwd)
+	awk export $(pwd) ${HOME} | local | $(pwd) done awk grep &&
+| sed awk done grep | ${HOME} cd grep test readonly local readonly
+	-eu 2>/dev/null 'quoted text'
+	-eu cd then grep awk x=1 -eu awk
+"$1" done then echo test grep /usr/bin "$@" "$@" export printf
+	x=1 cd x=1 --verbose done
+/usr/bin --verbose /usr/bin export then
+	"$1" printf "$1" 2>/dev/null then 2>/dev/null && printf $(pwd) 2>/dev/null cd
+awk test test -eu && cd x=1 printf done then awk sed test
+		2>/dev/null sed x=1 sed | -eu 2>/dev/null "$1"
+	done local test 'quoted text' 'quoted text' x=1 local 'quoted text'
+		test 'quoted text' 2>/dev/null sed /usr/bin $(pwd) local
+		done awk test cd done && printf cd sed && sed 2>/dev/null /usr/bin 'quoted text'
+	readonly readonly awk 'quoted text' printf
+	/usr/bin "$@" sed test | | grep
+		'quoted text' /usr/bin x=1 ${HOME} && | then /usr/bin $(pwd)
+		&& cd test --verbose printf /usr/bin done echo
+-eu awk readonly printf cd "$1" && 2>/dev/null && "$@" echo && x=1 2>/dev/null
+export export test export | &&
+echo 'quoted text' done awk /usr/bin echo printf done
+		"$@" 2>/dev/null 2>/dev/null then "$1" readonly --verbose
+2>/dev/null local printf $(pwd) cd then x=1 cd export test
+then 2>/dev/null --verbose ${HOME} ${HOME} 2>/dev/null sed --verbose
+		"$1" -eu ${HOME} sed cd export /usr/bin then
+'quoted text' readonly awk x=1 grep grep done sed printf 'quoted text'
+	printf awk x=1 ${HOME} export && local &&
+--verbose cd local -eu cd | echo awk ${HOME} cd cd x=1 readonly done
+	--verbose --verbose readonly
+		awk "$@" local 'quoted text' awk awk readonly done
+/usr/bin readonly x=1 | grep -eu x=1 && x=1 export "$@" ${HOME}
+		"$1" sed grep "$1" grep "$1" test awk local x=1 'quoted text' then then
+		$(pwd) "$1" local echo local x=1 /usr/bin -eu awk readonly echo then
+	| sed ${HOME} export sed -eu sed
+&& | | grep export 'quoted text' done grep
+		-eu 2>/dev/null -eu export export | && cd ${HOME} "$@" | done
+		"$1" local done local $(pwd) $(pwd) cd awk -eu $(pwd)
+		echo done printf readonly then done x=1 "$@" -eu printf "$@" export
+"$1" | readonly /usr/bin -eu export then then 'quoted text' x=1 /usr/bin
+		--verbose $(pwd) | sed "$1"
+-eu printf awk done cd && "$1" 2>/dev/null $(pwd)
+	/usr/bin then | /usr/bin -eu test | && x=1 done sed x=1 'quoted text' grep
+awk /usr/bin -eu awk done
+		then "$1" "$@" readonly sed local sed cd 2>/dev/null
+awk export then printf grep && | cd sed export done 'quoted text'
+	done -eu && sed test x=1 echo -eu local 'quoted text' echo
+-eu cd printf x=1 ${HOME} --verbose ${HOME} $(pwd) "$@" /usr/bin -eu cd &&
+done --verbose test awk export $(pwd) printf $(pwd) sed "$1"
+	2>/dev/null "$@" printf export
+	'quoted text' | && x=1 grep && export export 'quoted text' -eu export
+sed done 2>/dev/null grep 'quoted text' $(pwd) grep
+	test /usr/bin /usr/bin then &&
+		/usr/bin "$1" 'quoted text' x=1 'quoted text' sed test export local ${HOME}
+"$@" cd awk x=1 -eu -eu then then sed done readonly
+	sed $(pwd) test grep "$@" | local echo sed "$1" awk test 2>/dev/null local awk
+	$(pwd) 2>/dev/null grep sed readonly && 2>/dev/null -eu readonly
+	x=1 x=1 ${HOME} | sed --verbose x=1 ${HOME} awk $(pwd) | "$@"
+local && x=1 then 'quoted text' 2>/dev/null cd --verbose echo "$1" $(pwd)
+	$(pwd) --verbose -eu echo awk cd /usr/bin
+/usr/bin | export /usr/bin $(pwd) $(pwd) readonly cd -eu $(pwd) export
+	echo "$1" -eu | 'quoted text' | sed $(pwd) readonly /usr/bin export | export
+		sed sed /usr/bin -eu grep 'quoted text' -eu export grep sed 'quoted text'
+cd sed local echo printf printf export /usr/bin $(pwd) "$@" | x=1 $(pwd)
+grep grep 2>/dev/null done
+	--verbose readonly then awk
+| $(pwd) done echo sed readonly x=1 $(pwd) then
+	test local done 'quoted text'
+	$(pwd) sed printf && echo 2>/dev/null readonly --verbose /usr/bin ${HOME} sed
+$(pwd) 'quoted text' | readonly then && $(pwd) 'quoted text' -eu done && | echo
+printf then readonly awk cd -eu
+		awk "$1" -eu /usr/bin echo x=1 export
+		/usr/bin export "$@" /usr/bin
+x=1 'quoted text' 'quoted text' 'quoted text' readonly -eu test /usr/bin
+		x=1 sed 'quoted text' cd sed &&
+		&& awk "$1" awk --verbose 2>/dev/null -eu grep
+	'quoted text' -eu --verbose echo export echo $(pwd) --verbose x=1 awk
+	/usr/bin && test | -eu x=1 awk printf
+	readonly grep "$1" ${HOME} cd && then grep -eu test "$@"
+| printf $(pwd) readonly grep $(pwd) echo export
+	x=1 sed then --verbose
+	done grep /usr/bin ${HOME} printf "$@" readonly --verbose printf
+	local "$1" x=1 /usr/bin -eu 'quoted text' "$@" x=1 "$@" printf --verbose | then
+	--verbose $(pwd) -eu echo awk 2>/dev/null test sed
+		'quoted text' --verbose readonly | /usr/bin done done -eu awk awk test x=1
+echo -eu $(pwd) sed readonly /usr/bin "$1" readonly
+	test "$@" 'quoted text' "$1" "$1" --verbose
+		"$@" done grep echo $(pwd) printf -eu test echo && | grep && awk x=1 export
+	&& local && "$@" ${HOME} sed /usr/bin 'quoted text' x=1 &&
+	readonly done "$@" awk -eu then then | /usr/bin "$1"
+	test 2>/dev/null --verbose $(pwd) --verbose echo "$@" printf export "$@"
+${HOME} export export x=1 printf 2>/dev/null
+		sed printf then x=1 x=1 ${HOME} /usr/bin
+$(pwd) test $(pwd) then /usr/bin
+		export --verbose echo | export && printf local --verbose
+${HOME} 2>/dev/null /usr/bin $(pwd) local local -eu readonly export done 2>/dev/null
+	then export "$1" grep $(pwd) $(pwd) ${HOME} readonly -eu grep awk
+		cd local grep 'quoted text' grep "$1" /usr/bin grep ${HOME}
+"$1" readonly "$1" $(pwd) "$@" x=1 local grep --verbose -eu ${HOME} -eu cd then
+x=1 cd /usr/bin ${HOME} grep printf x=1 then printf sed then 'quoted text'
+	then grep 'quoted text' /usr/bin export cd cd readonly "$1" && then echo
+		"$1" "$1" printf export
+		done cd 2>/dev/null && -eu "$1" 2>/dev/null && echo x=1 'quoted text'
+	"$1" grep export $(pwd) | --verbose then && -eu $(pwd) cd cd test
+awk readonly test done then then 2>/dev/null sed awk 2>/dev/null -eu
+	2>/dev/null local local x=1 && | $(pwd)
+	${HOME} done && /usr/bin test then --verbose 2>/dev/null
+		| printf sed test sed awk sed &&
+cd x=1 grep done done grep sed export
+		$(pwd) awk export | done readonly ${HOME} x=1 'quoted text' | && echo 'quoted text'
+		$(pwd) printf test test echo "$1" "$@" 2>/dev/null
+	done local -eu 2>/dev/null local $(pwd) /usr/bin "$1" $(pwd) -eu awk |
+	| printf awk then cd 'quoted text' printf echo x=1
+	echo awk done echo then export done grep ${HOME}
+		--verbose grep --verbose export
+		awk x=1 "$@" done x=1 echo echo -eu local x=1 printf cd -eu /usr/bin grep
+		test --verbose $(pwd) x=1 cd x=1 readonly ${HOME} /usr/bin readonly $(pwd) test
+		export local sed /usr/bin readonly -eu x=1 awk 'quoted text' done /usr/bin
+	echo then ${HOME} export --verbose test awk printf -eu && /usr/bin cd echo then
+		then ${HOME} readonly | printf && -eu "$1" "$1" readonly done done
+	printf cd | "$1" -eu sed $(pwd) 2>/dev/null echo /usr/bin --verbose
+		"$@" local export x=1 x=1 2>/dev/null "$1" $(pwd) 'quoted text'
+		$(pwd) 2>/dev/null && 2>/dev/null -eu ${HOME} sed 'quoted text'
+		/usr/bin ${HOME} ${HOME}
+	-eu test /usr/bin && $(pwd) cd "$@" grep 2>/dev/null ${HOME} 2>/dev/null
+		| "$1" cd -eu /usr/bin ${HOME} grep export readonly awk /usr/bin cd test
+		| export local grep export test cd
+		local /usr/bin "$@" local sed && cd grep sed cd $(pwd) printf
+$(pwd) $(pwd) "$1" readonly sed
+${HOME} "$@" "$@" 2>/dev/null "$1" "$@" done local /usr/bin
+		export 2>/dev/null then grep test done x=1 readonly 'quoted text' /usr/bin
+	sed -eu export "$1" then grep "$1" test
+/usr/bin --verbose local ${HOME} local "$1" readonly $(pwd)
+		/usr/bin done sed sed /usr/bin
+'quoted text' then cd --verbose /usr/bin
+		/usr/bin awk then grep echo local ${HOME}
+	&& x=1 readonly 'quoted text' local
+	export 2>/dev/null /usr/bin 2>/dev/null
+done "$1" ${HOME} grep then ${HOME} /usr/bin && | "$@" grep
+"$@" grep then --verbose "$1" 'quoted text' local readonly "$1" echo
+	then printf "$@" "$1" | -eu
+2>/dev/null sed printf test 2>/dev/null "$1" readonly sed then awk --verbose
+-eu grep then "$@" printf && --verbose | "$@" done
+${HOME} test test ${HOME} "$@" $(pwd) "$@" 'quoted text' echo "$1" | grep sed
+		then ${HOME} test test local
+	test readonly echo awk && "$1"
+&& /usr/bin done --verbose done then
+	"$1" 'quoted text' cd sed local x=1 sed cd --verbose readonly
+		cd echo | $(pwd) $(pwd) grep && /usr/bin "$1" grep "$@" done export
+		done grep export "$@" done then -eu 'quoted text' echo ${HOME} awk x=1 test
+	then "$@" printf printf done export cd test -eu /usr/bin "$1" ${HOME} sed
+		&& local "$1" | done test cd 2>/dev/null -eu $(pwd) && export --verbose
+'quoted text' 'quoted text' /usr/bin && readonly
+	$(pwd) readonly $(pwd) local && readonly
+	x=1 done "$1" "$1" "$@" "$1" then sed then then
+test sed --verbose /usr/bin sed test grep /usr/bin done awk local
+x=1 then sed readonly "$@" readonly cd 'quoted text' sed
+'quoted text' -eu "$1" | export --verbose $(pwd) 'quoted text' $(pwd)
+"$1" export "$1" $(pwd) cd sed local echo ${HOME} sed local export
+		done 'quoted text' then /usr/bin
+		sed /usr/bin grep test "$@" "$1" echo
+		| then "$@" | grep "$@" -eu "$@" ${HOME}
+		-eu printf && echo local
+test printf printf local "$@" $(pwd)
+&& x=1 export /usr/bin "$1" then 2>/dev/null
+	"$@" test printf echo "$@" ${HOME} | local
+local ${HOME} export then then
+		2>/dev/null done --verbose
+	awk 2>/dev/null /usr/bin $(pwd) x=1 test cd readonly
+	export cd $(pwd) "$1" x=1 $(pwd) && sed "$@" --verbose "$1" grep sed
+		/usr/bin echo | echo echo sed sed 2>/dev/null 2>/dev/null
+	echo then "$1" local 2>/dev/null printf awk printf
+	&& /usr/bin local sed -eu && /usr/bin 'quoted text' local awk local --verbose
+	sed -eu --verbose then | printf "$1" x=1 export --verbose export grep
+"$@" x=1 --verbose echo printf local echo | awk cd $(pwd) -eu done grep echo awk
+		sed -eu --verbose "$@" x=1 then then local grep
+'quoted text' | done && ${HOME} --verbose printf
+$(pwd) awk $(pwd) then | /usr/bin
+then ${HOME} "$1" && -eu --verbose 'quoted text'
+		-eu export then -eu sed "$@"
+	/usr/bin grep readonly --verbose /usr/bin sed ${HOME} test
+		awk echo echo awk sed local cd "$@" local grep then ${HOME} | then test
+echo "$1" --verbose done cd printf $(pwd) echo
+		${HOME} local -eu export
+--verbose awk --verbose awk ${HOME} test && readonly
+	local echo test -eu "$@" echo test /usr/bin then "$@" local $(pwd)
+	done printf ${HOME} 2>/dev/null readonly
+$(pwd) ${HOME} printf cd done ${HOME} x=1 /usr/bin -eu $(pwd)
+	&& echo cd cd && then local --verbose
+	test && readonly printf 2>/dev/null local
+	grep echo /usr/bin /usr/bin test done 2>/dev/null
+grep printf "$1" test test cd 'quoted text' grep printf "$1" --verbose echo /usr/bin
+	${HOME} local local ${HOME} | 2>/dev/null cd "$1" -eu
+--verbose done | cd then x=1 then $(pwd) printf echo grep "$@" done -eu awk export
+		$(pwd) -eu "$@" awk "$1" readonly
+"$@" 2>/dev/null "$1" printf then grep done local 2>/dev/null
+	| ${HOME} --verbose export printf --verbose test
+		-eu -eu printf ${HOME}
+${HOME} printf --verbose ${HOME} done then 2>/dev/null
+local ${HOME} -eu x=1 local | /usr/bin -eu --verbose test printf ${HOME} cd $(pwd)
+		done "$@" $(pwd) /usr/bin "$@"
+		$(pwd) 'quoted text' -eu $(pwd) sed
+	echo test && local /usr/bin
+x=1 $(pwd) cd --verbose done --verbose -eu then done sed && && $(pwd)
+	export test done sed -eu test 2>/dev/null && -eu test 'quoted text' cd done
+		"$1" ${HOME} cd -eu x=1 /usr/bin x=1 done
+$(pwd) 2>/dev/null awk export done && 2>/dev/null cd
+		awk 2>/dev/null ${HOME} && grep test test "$@" printf "$@"
+		then ${HOME} local && x=1 then cd x=1
+	grep x=1 "$1" /usr/bin readonly /usr/bin
+#include c213.sh
+		'quoted text' "$@" | "$@" grep /usr/bin
+	done sed "$@" $(pwd) readonly
+		local ${HOME} awk printf local /usr/bin sed then $(pwd) cd $(pwd) 2>/dev/null
+| local export 'quoted text' test test | echo --verbose 'quoted text' &&
+		cd -eu x=1 /usr/bin -eu "$1"
+done local ${HOME} -eu awk awk cd cd | 'quoted text'
+		$(pwd) 2>/dev/null 'quoted text' then x=1 printf awk test --verbose
+awk x=1 cd && done && x=1 grep sed printf cd local x=1
+printf | sed grep then printf readonly && /usr/bin
+		$(pwd) echo 'quoted text' ${HOME} | grep
+&& echo echo "$@" sed && -eu grep grep test printf
+	readonly 'quoted text' "$1" local awk "$1" | ${HOME} "$1"
+| readonly sed test awk cd
+		'quoted text' done /usr/bin echo ${HOME} --verbose echo ${HOME} ${HOME}
+		| grep "$@" x=1 x=1 "$@" then "$1" "$1" x=1 | echo printf /usr/bin
+		--verbose -eu grep 'quoted text' 2>/dev/null
+"$@" test 2>/dev/null local && && "$@" echo
+	$(pwd) local && done "$1" awk x=1 echo -eu grep
+	sed ${HOME} "$@" ${HOME} $(pwd)
+	grep "$@" awk /usr/bin && grep local 'quoted text'
+		&& then "$1" | sed x=1 export test "$@" && 2>/dev/null $(pwd) /usr/bin readonly
+		"$@" && --verbose printf then /usr/bin "$1" awk echo then export
+		${HOME} 2>/dev/null 2>/dev/null 'quoted text'
+"$1" then /usr/bin test "$@" export --verbose ${HOME}
+	awk printf local readonly /usr/bin
+	local && 2>/dev/null $(pwd) awk
+	&& export grep test $(pwd) x=1 && "$1" then
+then test ${HOME} test printf test ${HOME} cd printf awk grep 2>/dev/null
+		then done $(pwd) echo then /usr/bin test 2>/dev/null
+		--verbose 2>/dev/null then readonly 2>/dev/null
+		awk test grep cd then echo done export test export echo test grep --verbose
+	-eu x=1 "$@" 2>/dev/null grep --verbose --verbose
+	cd sed readonly 'quoted text' local grep ${HOME} "$1" x=1 --verbose
+sed readonly $(pwd) readonly ${HOME}
+	done /usr/bin $(pwd) /usr/bin export | done ${HOME} x=1 export test /usr/bin x=1
+printf -eu && local 'quoted text' local x=1 test export echo
+		$(pwd) "$1" && export --verbose 2>/dev/null /usr/bin | ${HOME} | sed
+sed && $(pwd) echo test local then local /usr/bin sed "$1" sed
+	printf test "$1" then ${HOME} cd local x=1 --verbose then done
+done then then "$@" then test export test
+export | "$@" && --verbose 2>/dev/null -eu ${HOME} local grep
+		${HOME} export test x=1 && done echo sed && 'quoted text' $(pwd) printf
+$(pwd) "$1" x=1 ${HOME} 2>/dev/null | done test test export
+sed | /usr/bin awk x=1
+	&& -eu done ${HOME} then x=1 "$@" readonly grep
+	then | && test readonly 2>/dev/null cd grep ${HOME}
+/usr/bin local awk "$@" -eu
+$(pwd) then cd sed local
+	${HOME} sed $(pwd) sed "$1" cd done "$1" export "$@" /usr/bin then "$@"
+		/usr/bin grep 2>/dev/null printf then ${HOME} test x=1 local ${HOME} /usr/bin
+test "$@" /usr/bin ${HOME} -eu awk awk --verbose export echo $(pwd)
+	$(pwd) export $(pwd) export export test awk 'quoted text' printf
+readonly -eu local readonly test "$1" $(pwd) printf
+	local -eu grep grep ${HOME} export
+test then test local $(pwd) local echo --verbose printf
+	"$1" x=1 test awk then ${HOME} echo x=1 sed done local
+	export && "$1" sed "$1" ${HOME} echo -eu
+	'quoted text' ${HOME} awk cd 'quoted text'
+done $(pwd) "$1" 2>/dev/null then sed /usr/bin x=1 ${HOME}
+		-eu cd awk 'quoted text' export done && readonly test x=1 "$1"
+done grep --verbose awk 2>/dev/null | -eu local
+-eu && -eu awk && && export printf local done
+		readonly done | grep -eu --verbose
+		local awk cd "$1" cd /usr/bin && --verbose ${HOME} --verbose test 'quoted text'
+-eu | ${HOME} sed $(pwd)
+	x=1 grep grep done -eu then && -eu local grep grep grep && then done sed
+	"$1" $(pwd) printf printf
+		cd cd export awk then 2>/dev/null awk --verbose
+	${HOME} echo | 'quoted text'
+		${HOME} "$@" && | $(pwd) /usr/bin ${HOME} echo echo
+	"$1" local && | && -eu done --verbose done cd 'quoted text' ${HOME}
+readonly | --verbose
+		--verbose 2>/dev/null && printf local ${HOME} -eu
+export ${HOME} readonly $(pwd) echo 2>/dev/null sed readonly
+		export sed echo done -eu echo --verbose cd --verbose /usr/bin then readonly
+	awk sed x=1 grep printf local
+		local then --verbose | grep ${HOME} -eu ${HOME} 2>/dev/null
+grep sed "$@" | $(pwd) | test readonly grep "$1" -eu cd 2>/dev/null "$1" ${HOME}
+	local awk /usr/bin readonly 2>/dev/null 'quoted text' readonly export awk
+	test --verbose x=1 then grep "$1" grep --verbose ${HOME} grep test | sed
+		x=1 awk then cd 2>/dev/null
+/usr/bin grep echo cd $(pwd) -eu
+		x=1 /usr/bin then printf -eu printf "$@" "$1" readonly /usr/bin --verbose
+		"$@" local $(pwd) $(pwd) $(pwd) local && $(pwd) "$1" --verbose awk cd
+		printf grep awk then /usr/bin echo x=1 "$1"
+	test printf /usr/bin printf export then printf local cd && grep printf sed
+		/usr/bin readonly $(pwd) --verbose
+$(pwd) test ${HOME} sed -eu readonly export 'quoted text' -eu $(pwd)
+sed local then /usr/bin export done sed | 2>/dev/null echo printf readonly
+		--verbose readonly -eu
+&& 2>/dev/null && | --verbose 2>/dev/null
+		then local 'quoted text' readonly sed "$1" awk readonly test sed then 'quoted text'
+	cd local done grep "$@" /usr/bin grep "$1"
+	'quoted text' local "$@" done sed 2>/dev/null
+	| awk echo -eu grep && ${HOME} && test export
+		-eu done 2>/dev/null /usr/bin --verbose export
+		then printf done "$@" cd /usr/bin test x=1 x=1 done
+	then x=1 'quoted text' "$@" done
+'quoted text' done 2>/dev/null echo
+	2>/dev/null "$@" ${HOME}
+-eu --verbose /usr/bin sed x=1 then echo grep && printf x=1 echo test $(pwd)
+		then -eu grep echo | | 2>/dev/null local printf readonly /usr/bin
+--verbose /usr/bin $(pwd)
+	done --verbose echo then done done grep x=1 cd cd local export 'quoted text' x=1
+		export done x=1 2>/dev/null 2>/dev/null
+test ${HOME} x=1 readonly echo /usr/bin $(pwd) echo 2>/dev/null
+		"$1" 'quoted text' printf --verbose
+		--verbose sed "$@" && sed |
+printf --verbose grep 2>/dev/null ${HOME} | | local /usr/bin awk
+	done printf x=1 then 'quoted text' export -eu /usr/bin grep
+	'quoted text' && then local && local grep 'quoted text'
+		printf echo x=1 cd "$@" && &&
+cd readonly && printf --verbose
+local && grep 2>/dev/null 'quoted text' cd x=1 "$1" grep then printf 'quoted text'
+		--verbose sed && echo ${HOME} /usr/bin cd | local cd grep echo export cd x=1 ${HOME}
+	$(pwd) "$@" "$@" readonly sed printf awk
+2>/dev/null 2>/dev/null 'quoted text' --verbose "$@" awk ${HOME} test
+		${HOME} ${HOME} "$@" 'quoted text' $(pwd) "$@" sed
+done --verbose grep test test $(pwd) 2>/dev/null -eu && then
+| $(pwd) x=1 && && $(pwd) readonly --verbose 'quoted text' --verbose
+		${HOME} /usr/bin -eu export printf test ${HOME} $(pwd) && printf 'quoted text'
+local echo "$1" echo -eu x=1 "$@" $(pwd) $(pwd) "$1" readonly local
+	then local then -eu done $(pwd) test "$@" --verbose /usr/bin "$@" ${HOME} done
+		x=1 grep "$@" --verbose
+export done sed /usr/bin readonly x=1 done
+		cd test ${HOME} 2>/dev/null $(pwd) /usr/bin awk --verbose printf
+		printf 'quoted text' cd readonly
+	awk "$1" readonly x=1 cd ${HOME}
+printf done then && grep 2>/dev/null /usr/bin export export export --verbose printf
+		"$1" 2>/dev/null then 'quoted text' grep echo $(pwd) readonly ${HOME}
+		export awk export --verbose cd awk && echo
+/usr/bin && -eu --verbose
+	printf -eu && echo x=1 cd --verbose sed then test then test local
+	echo $(pwd) | $(pwd) -eu
+	${HOME} sed awk sed sed
+-eu x=1 ${HOME} "$@" /usr/bin x=1 awk --verbose
+		| $(pwd) grep test "$@" "$@" awk && && 2>/dev/null test printf
+		--verbose x=1 test echo "$@" printf echo --verbose
+readonly awk echo test then --verbose "$@" done | --verbose grep sed
+		cd -eu echo done export $(pwd) x=1 echo export grep sed grep readonly "$@"
+		'quoted text' -eu then grep && readonly --verbose && x=1 grep && done readonly
+		sed x=1 --verbose ${HOME} grep printf
+		cd export $(pwd) x=1 ${HOME} 2>/dev/null $(pwd) echo
+		then 'quoted text' done awk
+| echo printf "$1" then "$1" ${HOME} "$1" grep printf "$1" -eu awk test
+--verbose -eu cd awk ${HOME} /usr/bin
+	sed cd then export awk "$1" --verbose /usr/bin then echo
+	grep x=1 "$1" && $(pwd)
+		$(pwd) sed -eu sed export
+		"$@" /usr/bin printf "$@" 'quoted text' 'quoted text' echo
+		| test echo $(pwd) x=1 grep printf done printf
+then x=1 2>/dev/null cd done echo 'quoted text' -eu -eu cd $(pwd)
+	$(pwd) readonly test && /usr/bin "$1" readonly
+		grep local echo cd && cd
+		"$1" cd "$@" local 'quoted text' 'quoted text' sed "$@" x=1 done "$@"
+&& && grep then /usr/bin x=1 then 2>/dev/null
+-eu "$@" sed test done ${HOME}
+		"$@" done export x=1 'quoted text'
+		&& local printf test export x=1 /usr/bin "$1" readonly printf local
+		then readonly readonly cd
+	echo readonly export sed cd | test local
+readonly test ${HOME} ${HOME} readonly -eu local
+x=1 2>/dev/null | printf && grep 2>/dev/null test
+		printf sed | ${HOME} x=1 'quoted text' --verbose
+		${HOME} export --verbose | sed
+grep $(pwd) /usr/bin readonly export $(pwd) grep ${HOME} grep cd export $(pwd)
+	/usr/bin readonly "$@" done echo sed --verbose readonly x=1
+-eu grep cd done echo printf 'quoted text' 2>/dev/null
+	echo awk 2>/dev/null 2>/dev/null
+		2>/dev/null x=1 && awk grep 'quoted text' /usr/bin x=1 'quoted text'
+		sed x=1 test $(pwd) then "$@" readonly local | test sed grep
+"$1" x=1 local | awk done -eu 2>/dev/null local --verbose "$@" then 2>/dev/null
+local -eu 2>/dev/null $(pwd) test grep awk /usr/bin ${HOME} awk
+		/usr/bin printf export cd awk awk sed -eu -eu test sed echo /usr/bin printf
+-eu awk printf sed ${HOME} cd ${HOME} done -eu | export readonly -eu && sed | "$1"
+	$(pwd) /usr/bin | -eu /usr/bin
+export cd test grep --verbose 'quoted text'
+$(pwd) awk ${HOME} printf 2>/dev/null
+readonly echo 2>/dev/null 'quoted text'
+-eu | --verbose 2>/dev/null x=1 | | awk done sed | "$@" |
+	then | export cd $(pwd) | ${HOME} x=1 && | -eu grep
+--verbose && | local --verbose readonly
+| done cd readonly | ${HOME} -eu awk local --verbose local
+	readonly local cd --verbose export export test "$@" "$1"
+	printf x=1 -eu 2>/dev/null done export | sed test awk /usr/bin
+		'quoted text' "$@" printf && x=1 2>/dev/null 2>/dev/null awk local "$1"
+-eu awk test ${HOME} then echo echo printf
+		'quoted text' echo 'quoted text' sed sed readonly echo /usr/bin
+		then export local printf
+cd printf cd sed "$1" done test awk /usr/bin
+	&& | --verbose --verbose sed "$1" test done readonly printf awk
+		cd ${HOME} grep --verbose
+		2>/dev/null export sed
+'quoted text' x=1 test 2>/dev/null | cd grep echo
+		-eu echo cd echo cd awk cd readonly 2>/dev/null --verbose ${HOME} | export
+printf awk $(pwd) "$1" readonly ${HOME}
+| cd printf "$@" x=1 grep ${HOME} local
+		&& "$@" /usr/bin printf awk
+	cd done $(pwd) -eu $(pwd) $(pwd)
+		sed cd ${HOME} printf cd readonly | ${HOME} local ${HOME} echo -eu
+printf awk test then | 2>/dev/null then test cd
+	"$1" echo $(pwd) && sed /usr/bin
+${HOME} | $(pwd) | x=1 /usr/bin -eu grep "$@" /usr/bin -eu readonly cd export
+	/usr/bin "$1" /usr/bin "$@" && --verbose cd -eu | -eu
+	export 'quoted text' 2>/dev/null "$1" 'quoted text'
+readonly printf export awk done "$@" -eu
+		grep awk && export 'quoted text'
+'quoted text' /usr/bin local $(pwd)
+	cd 'quoted text' --verbose
+	--verbose test test export awk then then ${HOME} "$@" /usr/bin
+		&& local echo awk export printf
+	x=1 then 'quoted text' printf local
+echo grep 2>/dev/null 'quoted text' export "$@" "$@" 2>/dev/null 2>/dev/null
+--verbose done test x=1 sed "$1" --verbose
+	test "$@" sed ${HOME} | 2>/dev/null done sed "$@" | $(pwd) local
+	echo grep | ${HOME} then local --verbose
+		| awk cd readonly done 2>/dev/null && 'quoted text'
+-eu $(pwd) "$1" grep test
+		| x=1 /usr/bin then --verbose -eu done sed 'quoted text'
+cd $(pwd) $(pwd) /usr/bin $(pwd) 'quoted text' "$@" readonly "$@"
+"$@" --verbose && awk /usr/bin sed -eu done --verbose echo --verbose
+"$1" -eu echo | grep then awk grep | 2>/dev/null /usr/bin
+	2>/dev/null test $(pwd) awk -eu "$@" grep then "$1" 2>/dev/null 2>/dev/null
+	$(pwd) --verbose grep echo sed then done $(pwd) --verbose "$1" done -eu $(pwd)
+	local 'quoted text' readonly 2>/dev/null then awk done done
+		test $(pwd) readonly "$@" export export local export ${HOME}
+	readonly local done printf ${HOME} sed test ${HOME} sed
+		/usr/bin then /usr/bin local awk sed sed $(pwd) export | | x=1 "$@" && --verbose
+	-eu local && awk --verbose x=1
+test grep grep then then $(pwd) "$@" 'quoted text' echo "$@" sed | ${HOME}
+$(pwd) local local then | local "$1" 2>/dev/null echo readonly grep -eu
+		cd && readonly --verbose done | | 2>/dev/null | -eu
+"$1" -eu printf x=1 -eu export "$@" done sed ${HOME} $(pwd) export readonly
+-eu grep readonly readonly 'quoted text' 2>/dev/null 'quoted text' 2>/dev/null
+		test awk export /usr/bin x=1 readonly then test -eu && --verbose 'quoted text'
+local cd readonly --verbose /usr/bin echo sed echo "$@" && | | /usr/bin
+awk sed echo x=1 | sed --verbose echo
+	grep export export printf echo test 'quoted text' then export
+	$(pwd) /usr/bin test --verbose done printf grep export
+	cd x=1 'quoted text' readonly
+	printf && readonly cd $(pwd) 2>/dev/null -eu -eu 2>/dev/null 2>/dev/null
+	'quoted text' grep grep readonly readonly --verbose 2>/dev/null awk
+-eu cd sed /usr/bin export
+--verbose /usr/bin -eu | -eu export test /usr/bin x=1 done awk awk -eu
+		done test x=1 test /usr/bin printf sed
+		done "$@" "$1" echo $(pwd) then -eu 'quoted text' readonly ${HOME} grep awk ${HOME}
+	printf then x=1 local | /usr/bin
+	"$1" cd "$1" --verbose "$1" ${HOME} printf done $(pwd) ${HOME} ${HOME} printf
+		local done readonly readonly readonly test 'quoted text' test export cd "$1" ${HOME}
+-eu ${HOME} cd && echo test echo -eu -eu |
+test && 'quoted text' cd printf $(pwd) local then readonly
+	then awk grep grep done "$1" ${HOME} $(pwd) && | --verbose then
+	sed echo /usr/bin | | 2>/dev/null
+2>/dev/null ${HOME} ${HOME} grep
+		&& awk | && | --verbose local | 'quoted text' readonly
+	grep done echo export -eu export readonly "$@" grep grep sed | then
+	| test echo "$@" -eu | 'quoted text' /usr/bin | | "$1" printf "$@"
+-eu export | 2>/dev/null "$1" echo local printf
+		echo 'quoted text' -eu awk 2>/dev/null
+	export 'quoted text' x=1 "$@" /usr/bin ${HOME} then
+	"$1" awk sed local $(pwd) test awk --verbose
+--verbose --verbose x=1 sed "$@" $(pwd) x=1 then
+		/usr/bin 2>/dev/null cd cd --verbose 2>/dev/null
+		then sed 'quoted text' test 2>/dev/null 'quoted text'
+		$(pwd) 2>/dev/null && | test --verbose ${HOME} ${HOME} done then cd awk sed
+	echo && then -eu --verbose test sed export "$1" awk
+		/usr/bin awk x=1 && 'quoted text' awk ${HOME} ${HOME} sed
+	"$@" cd /usr/bin export
+	/usr/bin echo /usr/bin cd echo
+	"$@" 'quoted text' grep && --verbose awk cd 'quoted text' readonly | sed sed
+'quoted text' sed /usr/bin test sed cd sed "$@" /usr/bin printf done
+	grep export then grep cd "$@" 'quoted text'
+		echo -eu then cd export "$1" | printf && cd x=1 /usr/bin --verbose /usr/bin
+		'quoted text' sed $(pwd) local awk $(pwd)
+x=1 --verbose then local grep then local grep then x=1 /usr/bin
+'quoted text' --verbose 2>/dev/null echo echo echo readonly
+		--verbose | 'quoted text'
+	test export "$1" /usr/bin -eu done "$@" "$1" grep readonly $(pwd)
+	"$1" cd 'quoted text' $(pwd) && 'quoted text' --verbose readonly "$@" "$1"
+	cd "$1" readonly echo echo readonly 'quoted text'
+	-eu $(pwd) cd grep --verbose 'quoted text' grep cd
+	x=1 ${HOME} printf echo $(pwd) then | then /usr/bin test test x=1 readonly
+		-eu 2>/dev/null done -eu ${HOME} x=1 ${HOME} sed test sed --verbose 2>/dev/null
+local "$1" 'quoted text'
+	"$1" export "$@" 2>/dev/null grep
+		echo 'quoted text' export | "$@" then "$@" grep "$1"
+	2>/dev/null "$@" grep 2>/dev/null done | x=1 sed
+awk 2>/dev/null 'quoted text' grep
+	"$@" echo "$1" then grep "$1"
+export ${HOME} /usr/bin printf -eu awk export
+grep $(pwd) done && /usr/bin 'quoted text' export | "$@" ${HOME}
+	--verbose grep | 'quoted text' ${HOME}
+awk $(pwd) ${HOME} ${HOME} "$@" test local 2>/dev/null | -eu printf then
+	${HOME} test local 'quoted text' test x=1 |
+		export echo echo grep export local sed readonly local readonly
+		local -eu echo echo | grep 'quoted text'
+		local test 'quoted text' readonly 'quoted text' 'quoted text'
+| 'quoted text' then && && readonly echo
+-eu --verbose grep "$1" grep /usr/bin grep then awk echo export then awk
+$(pwd) export /usr/bin local x=1 done
+		then --verbose export cd test -eu printf test
+		readonly $(pwd) echo local | x=1 local
+	echo test echo printf then echo echo
+		printf then sed /usr/bin done 2>/dev/null -eu
+		&& $(pwd) && awk -eu && "$@" "$@"
+'quoted text' test "$1" cd done readonly sed /usr/bin cd export echo x=1 2>/dev/null
+	"$@" --verbose sed readonly
+2>/dev/null $(pwd) printf export $(pwd) echo then ${HOME} echo -eu awk
+		cd ${HOME} test "$1" test 2>/dev/null printf 2>/dev/null done
+		grep -eu sed "$@" then
+| "$@" 'quoted text' done /usr/bin && ${HOME} export export done x=1
+	-eu -eu cd --verbose then /usr/bin "$1"
+		"$@" local /usr/bin test $(pwd) printf &&
+x=1 grep && 2>/dev/null printf test "$1" printf
+test x=1 /usr/bin ${HOME} test printf readonly printf "$1" local export awk then
+cd then "$1" grep /usr/bin | "$1" printf
+2>/dev/null ${HOME} test readonly sed awk "$1" test
+/usr/bin then "$@" export printf && --verbose echo x=1 /usr/bin awk 'quoted text'
+"$@" test -eu "$@" echo "$@" done
+	"$1" done then ${HOME} then
+		/usr/bin cd awk x=1 echo test test x=1 "$@"
+	&& printf grep test echo export export test cd "$@"
+		/usr/bin "$@" --verbose echo ${HOME} then local awk done $(pwd) | && test printf
+	done "$1" then ${HOME} $(pwd) grep
+${HOME} /usr/bin && "$1" awk cd 2>/dev/null
+		cd 2>/dev/null "$@" test 2>/dev/null /usr/bin readonly 'quoted text' then
+	'quoted text' /usr/bin | awk ${HOME} ${HOME} printf test /usr/bin done local printf
+	local 'quoted text' printf --verbose printf
+echo cd awk && cd printf export x=1 echo x=1 /usr/bin
+		readonly readonly awk readonly
+		x=1 ${HOME} export | 2>/dev/null
+		echo done "$@" | readonly awk 'quoted text' 2>/dev/null 2>/dev/null "$@"
+		readonly $(pwd) | "$1" awk -eu ${HOME}
+awk export then awk --verbose && local $(pwd)
+printf echo $(pwd) done cd sed -eu ${HOME} printf 2>/dev/null printf
+	| cd x=1 awk 'quoted text' export test grep local then done export 2>/dev/null
+	test test "$1" | -eu ${HOME} $(pwd) "$1" ${HOME}
+| readonly local 2>/dev/null printf
+	export then done done | local |
+	cd local grep | $(pwd) /usr/bin $(pwd) ${HOME}
+	"$1" x=1 printf 2>/dev/null printf -eu "$1" readonly -eu then
+	sed ${HOME} then | cd test readonly --verbose "$1" | "$1" sed printf readonly 'quoted text'
+--verbose /usr/bin sed
+	'quoted text' cd 2>/dev/null
+	--verbose "$1" 'quoted text' grep && then /usr/bin -eu
+	readonly /usr/bin done -eu && echo x=1 "$@"
+	local 2>/dev/null cd then ${HOME} 2>/dev/null 2>/dev/null
+	then test $(pwd) && sed "$@" -eu printf
+	&& then /usr/bin echo printf done export "$1" printf
+		awk --verbose && awk /usr/bin readonly printf printf export 2>/dev/null
+		-eu readonly "$@" awk sed echo local 2>/dev/null
+	echo sed "$1" 'quoted text' x=1 printf awk
+then test test x=1 readonly 2>/dev/null
+		readonly 2>/dev/null done 'quoted text' awk echo cd echo export
+| local local echo $(pwd) echo $(pwd) ${HOME} export -eu &&
+	${HOME} grep 2>/dev/null "$1" sed export --verbose local local -eu 'quoted text'
+	awk export then local "$1" local --verbose 2>/dev/null | grep 2>/dev/null
+done -eu 2>/dev/null | && 2>/dev/null export then |
+	-eu --verbose printf export 2>/dev/null printf then
+sed readonly test sed x=1 && cd sed "$@" /usr/bin printf x=1 export sed 'quoted text'
+"$@" --verbose cd grep
+printf cd echo "$@" awk grep export local /usr/bin then local grep printf x=1
+		x=1 && grep done --verbose export
+$(pwd) awk 2>/dev/null sed grep 2>/dev/null cd test /usr/bin --verbose
+		-eu printf 2>/dev/null local $(pwd) local test x=1 sed local && "$1"
+printf done awk && done done 'quoted text' local done
+awk done export readonly 2>/dev/null cd then | export test echo --verbose
+		$(pwd) x=1 --verbose done $(pwd) sed then then test ${HOME}
+	'quoted text' cd grep 2>/dev/null export test printf done test ${HOME} "$1"
+	2>/dev/null "$@" $(pwd) grep "$1" /usr/bin readonly then -eu && -eu awk $(pwd)
+	readonly "$@" "$1" grep --verbose $(pwd) /usr/bin
+		$(pwd) cd | --verbose ${HOME} "$1" ${HOME} sed export
+		test ${HOME} "$1" /usr/bin -eu
+		printf test && "$@" done done
+${HOME} export 'quoted text' printf done printf
+		2>/dev/null done && --verbose
+	local ${HOME} --verbose
+"$1" 2>/dev/null test local && ${HOME} grep $(pwd) readonly
+&& $(pwd) && -eu ${HOME} /usr/bin "$@"
+		local echo grep && local
+		printf done export grep test 2>/dev/null
+echo then export cd cd --verbose sed && /usr/bin
+printf -eu && 'quoted text' --verbose ${HOME} $(pwd)
+--verbose "$@" "$@" printf local cd "$@" done x=1 cd $(pwd) && 'quoted text'
+	'quoted text' --verbose sed ${HOME} echo export grep awk readonly then
+	| cd cd -eu sed export
+sed $(pwd) 'quoted text' "$@" | && printf 2>/dev/null
+		printf /usr/bin export "$1" "$1" export "$@" export awk grep test
+local local grep --verbose printf grep sed 2>/dev/null
+${HOME} ${HOME} echo x=1 2>/dev/null echo /usr/bin printf test $(pwd) "$@"
+&& --verbose /usr/bin 'quoted text' 'quoted text' grep readonly
+test -eu | x=1 x=1 local "$1" && ${HOME} readonly
+x=1 printf "$@" printf printf "$1" x=1 then "$@" test --verbose grep readonly
+		then printf | sed then awk "$@" 'quoted text'
+	/usr/bin x=1 x=1 test -eu then grep $(pwd)
+	echo done -eu cd /usr/bin grep local awk
+test then grep then printf then then sed | readonly local echo then "$@"
+		printf done | /usr/bin "$1" 'quoted text'
+	| 2>/dev/null "$@" local x=1 x=1 done ${HOME} echo then then sed /usr/bin echo
+		${HOME} test $(pwd) awk && sed 2>/dev/null -eu "$1" 2>/dev/null done ${HOME}
+local local sed readonly "$1" --verbose then x=1 readonly
+	cd x=1 readonly local awk printf export x=1 "$1" $(pwd) "$1" sed printf
+export echo -eu 'quoted text' readonly --verbose export "$@"
+-eu printf | -eu local 2>/dev/null grep
+	awk grep ${HOME} test then printf cd grep && 2>/dev/null local
+	printf grep $(pwd) $(pwd) | x=1 ${HOME} printf local "$1"
+	${HOME} "$1" "$@" 2>/dev/null cd done printf && /usr/bin
+		/usr/bin /usr/bin grep test printf export
+		done readonly sed "$1" && grep ${HOME} test then
+export grep cd && local 2>/dev/null | x=1 cd grep cd -eu export
+	| readonly --verbose | 'quoted text' "$@" done --verbose $(pwd)
+		$(pwd) then sed /usr/bin grep printf sed "$1" echo ${HOME} | sed
+		grep printf grep 'quoted text' 2>/dev/null sed
+"$@" --verbose awk --verbose
+echo | | "$@" export grep cd readonly cd && export $(pwd) "$1"
+-eu "$@" 'quoted text' --verbose test then --verbose done cd then
+"$@" x=1 sed ${HOME} "$1" -eu "$1"
+		local local | awk done awk && x=1 --verbose readonly --verbose
+		x=1 awk $(pwd) 'quoted text' x=1 done test echo then cd x=1 'quoted text'
+--verbose 2>/dev/null $(pwd) -eu "$1" echo /usr/bin export local printf /usr/bin
+		&& /usr/bin x=1 ${HOME}
+	"$1" awk printf "$1" -eu done printf sed cd sed 'quoted text'
+		-eu --verbose then done ${HOME}
+x=1 sed 2>/dev/null done echo cd 2>/dev/null | && "$1"
+export sed sed && | ${HOME} echo "$1"
+		&& 2>/dev/null "$1" x=1 "$1" /usr/bin
+	printf local "$1" then "$1" && 2>/dev/null x=1 x=1
+	grep --verbose x=1 /usr/bin readonly grep done
+	grep local /usr/bin grep
+&& "$1" 2>/dev/null cd 'quoted text' grep export grep x=1 done local $(pwd)
+		echo $(pwd) export grep then then | sed export "$@" grep done
+--verbose sed local /usr/bin export "$1" | sed
+	| 'quoted text' local ${HOME}
+"$@" "$@" /usr/bin test then ${HOME} done test "$@" 2>/dev/null | ${HOME} -eu
+	cd done readonly --verbose
+test --verbose $(pwd) grep grep printf sed
+	cd awk export | 2>/dev/null awk local
+	--verbose /usr/bin readonly
+		2>/dev/null then --verbose 2>/dev/null | 2>/dev/null export x=1 ${HOME} | 'quoted text'
+		grep 'quoted text' awk 'quoted text' then x=1 'quoted text'
+/usr/bin echo test readonly "$1" grep printf sed -eu x=1 $(pwd) awk && --verbose
+		&& "$1" sed "$1" -eu done 'quoted text' then test cd && test
+'quoted text' | then grep echo -eu "$1" cd "$1"
+	cd x=1 -eu x=1 test |
+test /usr/bin x=1 sed test cd -eu export awk awk cd test "$1" grep x=1 cd cd
+	${HOME} cd done echo 'quoted text' | sed
+	/usr/bin test /usr/bin echo $(pwd)
+-eu --verbose local then done then readonly /usr/bin $(pwd) export ${HOME} $(pwd)
+	$(pwd) then readonly export test -eu readonly
+		"$@" 2>/dev/null printf then $(pwd)
+		echo readonly "$@" -eu export | echo awk test -eu
+	${HOME} --verbose awk $(pwd) grep 'quoted text'
+"$1" -eu --verbose | grep awk
+	${HOME} | then test "$1" 'quoted text' awk "$@"
+		echo 'quoted text' test && /usr/bin
+		-eu && done "$@" printf "$@" "$@" | then --verbose 2>/dev/null && then
+		sed 'quoted text' test x=1 /usr/bin echo
+	x=1 export | && $(pwd) cd then | -eu echo &&
+		/usr/bin | cd | "$@" test done 2>/dev/null readonly export --verbose
+	awk test $(pwd) then then "$@" cd echo "$1" "$1" cd printf echo | then sed $(pwd)
+	awk local export 2>/dev/null "$1" x=1 local ${HOME} awk test && -eu
+	grep /usr/bin echo readonly test done printf sed sed 2>/dev/null
+printf ${HOME} export "$1" | /usr/bin echo --verbose 2>/dev/null test
+		export | sed sed export && ${HOME} sed ${HOME} /usr/bin 2>/dev/null
+sed test export 'quoted text' done printf readonly
+		${HOME} ${HOME} then printf grep /usr/bin x=1 $(pwd) && -eu
+		/usr/bin grep $(pwd) && local printf $(pwd) export cd ${HOME} export
+awk "$1" ${HOME} 2>/dev/null 'quoted text' awk /usr/bin | 'quoted text'
+	| -eu cd test readonly printf echo /usr/bin grep export -eu
+	x=1 test && && export local readonly readonly ${HOME} ${HOME} x=1 'quoted text'
+	export done 'quoted text' export
+		--verbose 'quoted text' /usr/bin cd then | echo --verbose ${HOME} export
+local x=1 done awk /usr/bin $(pwd) echo
+		cd local test echo /usr/bin export -eu test cd "$1" readonly -eu
+	"$@" "$@" echo 2>/dev/null echo grep ${HOME} sed printf echo cd grep "$1" x=1
+--verbose cd $(pwd) export then echo grep local
+		2>/dev/null | done grep | sed 2>/dev/null 'quoted text'
+		done done cd echo | echo done
+		readonly | local x=1 sed printf echo sed export
+	grep "$1" local x=1 test 'quoted text' sed echo cd echo
+		x=1 x=1 x=1 local ${HOME} grep "$@" "$@" done printf
+	readonly then awk local echo echo done done ${HOME} sed x=1 x=1 printf "$@"
+2>/dev/null 2>/dev/null ${HOME} -eu test 'quoted text'
+	2>/dev/null cd -eu $(pwd) echo -eu --verbose
+	awk ${HOME} local $(pwd) awk
+	cd $(pwd) local cd | test x=1 && export export $(pwd) done cd ${HOME}
+		then done readonly 'quoted text'
+$(pwd) then "$@" --verbose && ${HOME} | export /usr/bin printf -eu ${HOME} test
+sed 2>/dev/null 2>/dev/null sed awk then export test ${HOME} x=1
+	grep grep $(pwd) | readonly x=1 sed readonly cd --verbose then | "$1"
+		&& && grep --verbose awk /usr/bin ${HOME} --verbose /usr/bin printf ${HOME}
+--verbose "$@" $(pwd) 'quoted text'
+		readonly && && test 'quoted text'
+	--verbose "$@" done 2>/dev/null -eu | then awk $(pwd)
+		then then $(pwd) printf /usr/bin | $(pwd) then readonly export awk
+-eu "$1" /usr/bin sed local printf 2>/dev/null 'quoted text' test test
+	echo 'quoted text' done sed 'quoted text' "$@" $(pwd) echo 'quoted text' | export
+"$1" -eu sed /usr/bin "$1" cd
+		2>/dev/null done export local export echo then
+	2>/dev/null sed then readonly
+"$@" test printf export ${HOME} export 'quoted text' awk cd done done && &&
+echo -eu /usr/bin printf --verbose
+		grep grep test cd grep && 2>/dev/null
+echo local sed $(pwd) done awk cd "$@" readonly 'quoted text'
+	$(pwd) x=1 printf "$@" done && sed "$1" readonly && cd $(pwd) | awk
+	sed local | ${HOME} | export /usr/bin 2>/dev/null done && grep cd 2>/dev/null sed
+${HOME} echo && printf -eu sed echo awk export "$1"
+		done local 2>/dev/null ${HOME} | cd "$@" && readonly
+		test ${HOME} local | && readonly
+cd 2>/dev/null "$1" && /usr/bin
+	printf /usr/bin 2>/dev/null ${HOME} -eu grep readonly ${HOME} /usr/bin printf
+	'quoted text' --verbose x=1
+	readonly cd cd /usr/bin sed "$1" --verbose
+'quoted text' awk 2>/dev/null /usr/bin /usr/bin export x=1 $(pwd) readonly
+	x=1 'quoted text' cd x=1 'quoted text' 2>/dev/null |
+	/usr/bin done local "$1" "$@" -eu x=1
+	x=1 "$@" --verbose $(pwd) "$1" "$@" readonly done x=1 local x=1 grep
+	"$@" sed cd test sed test done export
+		cd test done "$1" printf printf x=1 readonly $(pwd) cd readonly
+		then ${HOME} $(pwd) grep local ${HOME} ${HOME} local readonly --verbose
+	2>/dev/null grep "$1" local test /usr/bin then export export -eu $(pwd)
+x=1 "$1" "$1" printf local export printf
+--verbose awk export local
+	2>/dev/null cd x=1 -eu done 'quoted text'
+"$@" 2>/dev/null -eu x=1 done done $(pwd) grep
+&& printf | test $(pwd) test -eu then ${HOME}
+	$(pwd) test "$@" ${HOME}
+-eu | test && 'quoted text' $(pwd)
+	/usr/bin test printf "$1" sed printf grep cd ${HOME} echo
+2>/dev/null && | && grep $(pwd) ${HOME} --verbose
+	awk then test done awk x=1 | $(pwd) /usr/bin "$@" export local echo "$@" readonly
+	${HOME} $(pwd) ${HOME} export "$1" test local
+		${HOME} local local /usr/bin
+	grep 2>/dev/null awk "$@" -eu x=1 test
+	sed export done && done
+| done 'quoted text' awk | 2>/dev/null $(pwd) sed grep awk /usr/bin then -eu
+readonly sed done sed done | /usr/bin grep ${HOME} --verbose grep x=1 &&
+	"$@" --verbose then sed -eu && 'quoted text' readonly --verbose 2>/dev/null
+	2>/dev/null done | --verbose local
+		&& && cd export "$1" echo grep test then awk test printf printf test
+/usr/bin | 'quoted text' then && 2>/dev/null "$@" -eu printf ${HOME} local
+	done cd 2>/dev/null && awk | local "$@" /usr/bin | /usr/bin 'quoted text'
+		x=1 then grep cd printf -eu --verbose done 'quoted text'
+readonly -eu x=1 cd ${HOME} 'quoted text'
+	sed "$1" sed readonly local --verbose awk test done
+	grep readonly 'quoted text' -eu "$@" test
+		readonly ${HOME} done /usr/bin /usr/bin local "$1" | cd then -eu
+"$@" test readonly printf readonly printf printf --verbose done | local
+		awk local -eu test x=1 | $(pwd) /usr/bin 2>/dev/null
+	done printf local cd printf export printf && && then && awk -eu 2>/dev/null
+| /usr/bin test -eu echo cd && echo awk sed local "$@" echo readonly x=1
+done export local "$1" -eu 'quoted text' done done test /usr/bin
+		awk -eu --verbose done $(pwd)
+		$(pwd) done export cd printf sed then
+x=1 then grep then x=1 echo "$1" 'quoted text' x=1 grep printf local
+		-eu x=1 grep awk done | grep export 'quoted text' --verbose | "$@" cd awk test 'quoted text'
+	echo awk "$@" local readonly -eu cd $(pwd) test ${HOME} then local done test
+		$(pwd) echo && done local
+		${HOME} $(pwd) done sed then sed "$1" echo printf "$1" ${HOME} test ${HOME} cd
+		| -eu "$1" | test printf done -eu 'quoted text' grep local cd then -eu -eu readonly
+	grep done readonly "$@" grep
+		'quoted text' echo $(pwd) sed --verbose "$1" cd x=1 done sed grep 2>/dev/null
+awk cd "$1" -eu echo printf x=1 then "$1" 'quoted text'
+echo then local 2>/dev/null x=1
+'quoted text' export then 'quoted text' cd -eu
+		-eu sed readonly -eu printf
+"$@" "$1" --verbose local x=1 /usr/bin x=1 "$@" "$@"
+		"$1" awk x=1 test --verbose 2>/dev/null grep test 2>/dev/null export
+	grep /usr/bin local ${HOME} sed then x=1 /usr/bin 'quoted text' 2>/dev/null
+		then echo readonly sed -eu local /usr/bin awk readonly
+sed 'quoted text' then
+grep cd x=1 2>/dev/null
+		local ${HOME} 2>/dev/null 2>/dev/null cd printf /usr/bin -eu
+done | echo "$1" "$1" --verbose export 'quoted text' export
+		test 'quoted text' "$1" sed --verbose cd | "$@" 'quoted text' -eu grep test printf
+/usr/bin export export awk && 'quoted text' test ${HOME} -eu export printf 'quoted text'
+		2>/dev/null echo ${HOME} 'quoted text' sed ${HOME} cd -eu export
+	${HOME} ${HOME} $(pwd) x=1 'quoted text' && local export | "$@" | done | echo
+		"$@" 'quoted text' export grep awk then export "$1" done $(pwd) done
+local -eu $(pwd) /usr/bin 2>/dev/null | printf && ${HOME} |
+local "$@" ${HOME} awk "$@" local awk 2>/dev/null
+		done awk grep 2>/dev/null
+		printf | sed export echo $(pwd) -eu 'quoted text'
+test -eu --verbose sed test
+		/usr/bin sed $(pwd) x=1 then 2>/dev/null awk $(pwd) grep
+	--verbose sed --verbose grep | local export readonly
+	&& --verbose $(pwd) -eu sed local x=1 then /usr/bin
+2>/dev/null "$1" -eu export "$@" -eu export 'quoted text'
+		grep ${HOME} /usr/bin export | | $(pwd) ${HOME} | done $(pwd) ${HOME} readonly
+${HOME} test local echo -eu ${HOME} done echo 'quoted text' ${HOME}
+		/usr/bin printf local printf done awk && sed sed echo readonly
+then && | then 'quoted text' test echo --verbose readonly printf awk ${HOME}
+		sed then 'quoted text' x=1 readonly
+	readonly ${HOME} local cd echo printf | "$1" 'quoted text' done local
+		cd x=1 grep printf echo grep sed ${HOME} --verbose
+	echo then sed printf done export $(pwd) done cd
+		printf 'quoted text' echo
+	cd $(pwd) /usr/bin then ${HOME} done local echo readonly
+		export 2>/dev/null then readonly x=1 grep export export "$1" 'quoted text'
+		sed x=1 "$@" cd x=1 $(pwd) local && $(pwd) | done printf 'quoted text'
+	--verbose ${HOME} -eu readonly 'quoted text'
+	--verbose "$@" echo | | then
+	x=1 cd grep | printf awk export done test then "$1" "$1" awk done test printf
+		'quoted text' local export "$@" x=1 test
+	export 'quoted text' cd && "$1" $(pwd) 'quoted text' /usr/bin done
+		readonly export local | printf x=1 export $(pwd) local x=1 echo -eu
+	echo echo export printf export "$1" printf && | 'quoted text' 2>/dev/null
+	${HOME} /usr/bin "$@" export readonly
+	"$@" "$1" awk ${HOME} readonly ${HOME}
+-eu export x=1 readonly
+		--verbose done ${HOME} -eu done "$@" awk readonly | x=1 sed cd && /usr/bin
+		grep readonly sed grep echo done echo awk then -eu then echo
+printf printf grep cd cd grep readonly --verbose readonly grep "$@"
+		"$@" | then readonly done 2>/dev/null sed test "$@" echo then then 2>/dev/null
+		export ${HOME} grep 2>/dev/null printf
+${HOME} x=1 $(pwd) /usr/bin x=1 local --verbose "$@" grep --verbose
+		echo | x=1 'quoted text' "$1" | "$1" cd readonly
+	grep done | printf done
+echo ${HOME} readonly --verbose /usr/bin ${HOME} then export x=1 printf readonly
+&& cd test "$@" $(pwd) ${HOME} "$1" -eu done "$1" $(pwd) test echo test grep --verbose
+"$1" "$1" readonly sed readonly
+| sed test 'quoted text' "$@" export && && then echo --verbose "$@" grep && readonly
+	${HOME} "$1" /usr/bin -eu awk /usr/bin
+	| printf export $(pwd) printf && export /usr/bin && local local
+| done "$@" export echo sed && $(pwd) export -eu -eu cd cd done $(pwd)
+"$1" then -eu "$1" test printf readonly /usr/bin | local ${HOME} printf ${HOME}
+		done --verbose | && --verbose
+		x=1 grep /usr/bin cd cd && done --verbose /usr/bin local
+"$1" readonly cd test 2>/dev/null /usr/bin -eu printf then
+		'quoted text' ${HOME}
+	done then -eu test then printf -eu | cd 'quoted text'
+		awk $(pwd) x=1 done then -eu sed printf 'quoted text'
+	x=1 readonly grep | printf ${HOME}
+		printf done "$1" /usr/bin /usr/bin -eu readonly 'quoted text'
+	grep done sed readonly x=1 && export
+'quoted text' done done 2>/dev/null && grep
+		awk sed cd /usr/bin --verbose
+'quoted text' x=1 && local
+	awk done "$1" --verbose export
+test --verbose test test --verbose then awk | x=1 then printf ${HOME} local
+		"$@" local "$@" export awk local x=1 then $(pwd) export ${HOME} 2>/dev/null $(pwd)
+	x=1 grep 'quoted text' ${HOME} cd 'quoted text'
+	then "$1" test done 2>/dev/null awk
+	test then printf 2>/dev/null 'quoted text' "$@" 'quoted text'
+		| echo readonly export ${HOME} "$1" awk done "$1"
+	readonly then sed --verbose grep grep readonly /usr/bin
+	grep --verbose cd "$1"
+x=1 done then cd "$@" test done "$@" && awk && ${HOME} "$@" 'quoted text' -eu grep
+/usr/bin sed then 2>/dev/null $(pwd) done then 2>/dev/null
+then /usr/bin export then x=1
+	grep local /usr/bin 'quoted text'
+		-eu export 'quoted text' $(pwd)
+		done "$1" echo ${HOME} "$1" done &&
+		'quoted text' done sed
+"$@" then 'quoted text' && done readonly printf
+		echo x=1 $(pwd) $(pwd) done local
+	| readonly cd echo awk ${HOME} readonly
+		'quoted text' then --verbose printf printf printf
+2>/dev/null -eu grep /usr/bin | && /usr/bin /usr/bin echo x=1 -eu 'quoted text'
+readonly export 'quoted text' "$1" "$@"
+		readonly local | --verbose local echo
+	2>/dev/null "$@" echo readonly
+awk "$1" local | local awk | sed /usr/bin --verbose
+		grep grep awk 2>/dev/null --verbose
+		$(pwd) x=1 'quoted text' 2>/dev/null ${HOME} awk done
+2>/dev/null ${HOME} done x=1 cd $(pwd) ${HOME} x=1 local --verbose -eu
+awk -eu export echo done "$1" echo
+-eu /usr/bin echo then ${HOME} grep x=1 2>/dev/null
+		2>/dev/null cd | -eu then then test readonly "$1" cd awk readonly
+		&& test x=1 "$@" ${HOME} --verbose echo readonly
+local && $(pwd) sed x=1
+		echo x=1 'quoted text' 2>/dev/null -eu 'quoted text' 2>/dev/null --verbose
+	cd readonly 'quoted text' | echo printf | cd /usr/bin awk 'quoted text'
+		echo x=1 && grep -eu
+	awk && done /usr/bin printf 'quoted text' local x=1 |
+		-eu /usr/bin "$1" "$@" && test --verbose echo "$1" done 2>/dev/null
+	done --verbose /usr/bin
+"$@" ${HOME} /usr/bin grep --verbose
+		export | export echo 2>/dev/null local export
+--verbose test 2>/dev/null grep test x=1 awk readonly
+		${HOME} printf grep $(pwd) -eu echo
+	then "$1" export local readonly 2>/dev/null
+-eu test 'quoted text' 'quoted text'
+then done $(pwd) $(pwd) echo x=1
+		${HOME} echo "$1" echo done sed -eu ${HOME} | echo $(pwd) then printf grep 2>/dev/null
+${HOME} | $(pwd) echo && | | "$1" --verbose | | 2>/dev/null | echo --verbose
+		readonly done echo grep "$1" printf $(pwd)
+printf cd done x=1 local then test && done --verbose 'quoted text'
+awk export "$1" local 'quoted text' "$@" cd -eu sed readonly /usr/bin readonly
+awk | "$@" export --verbose | $(pwd) sed -eu $(pwd) readonly printf --verbose
+	2>/dev/null test export local x=1 done export x=1 $(pwd) awk test "$1" printf
+2>/dev/null local test 'quoted text' "$@"
+then sed cd /usr/bin && $(pwd) x=1 /usr/bin
+&& awk sed local --verbose -eu -eu sed $(pwd) x=1 cd printf "$@" done
+x=1 "$1" 'quoted text' | x=1 awk done test /usr/bin --verbose grep $(pwd) $(pwd)
+		awk readonly awk grep && sed done -eu $(pwd) cd /usr/bin readonly cd local
+&& /usr/bin sed grep && "$1" echo x=1 | --verbose export awk
+done -eu | awk grep x=1 printf grep echo
+	printf awk sed | awk then grep && then
+"$1" -eu ${HOME} "$1" 'quoted text' grep && awk local done export done --verbose
+"$@" $(pwd) 2>/dev/null
+	printf echo 2>/dev/null cd | echo test sed cd local printf 'quoted text'
+		printf -eu ${HOME} sed test 2>/dev/null grep done
+	x=1 awk -eu readonly x=1 && $(pwd) ${HOME} "$@"
+'quoted text' -eu /usr/bin readonly export /usr/bin $(pwd) --verbose
+	$(pwd) --verbose /usr/bin awk /usr/bin "$1" "$@" && grep ${HOME}
+		test done grep "$1" local --verbose --verbose ${HOME} done readonly cd
+2>/dev/null | cd && --verbose && --verbose "$1" && then -eu --verbose sed cd
+${HOME} test /usr/bin ${HOME} export
+grep | readonly && 2>/dev/null
+readonly printf $(pwd) 'quoted text' readonly /usr/bin "$1" 'quoted text' then
+	/usr/bin "$@" awk -eu --verbose 2>/dev/null readonly export
+	${HOME} grep ${HOME} then test --verbose && test grep grep
+done "$@" "$@" readonly awk export cd echo
+		done x=1 && "$1" /usr/bin "$1" "$1" 2>/dev/null
+local "$@" grep 2>/dev/null local echo awk then ${HOME}
+		x=1 printf | | "$@" local grep ${HOME} $(pwd) test "$@" export --verbose
+	export test && cd "$1" -eu echo
+/usr/bin readonly then 'quoted text' | done "$@" /usr/bin
+/usr/bin /usr/bin "$@" grep readonly && x=1 ${HOME} | echo test
+		&& sed | printf test "$@" done 2>/dev/null printf export local &&
+		sed grep printf /usr/bin "$@" && $(pwd) "$1" done echo
+		done cd /usr/bin then ${HOME} sed local
+	echo then test done $(pwd) "$1" cd "$@" "$1" x=1 --verbose
+		'quoted text' -eu 'quoted text' awk /usr/bin
+		/usr/bin grep "$1" /usr/bin x=1 awk grep printf 2>/dev/null awk "$@"
+		grep --verbose "$1" printf local
+		&& local echo printf 2>/dev/null x=1 -eu export grep $(pwd) printf
+		2>/dev/null cd && printf printf export 'quoted text' ${HOME}
+	"$@" then cd grep 'quoted text' printf then
+awk "$1" cd 'quoted text' echo /usr/bin && ${HOME} local done 2>/dev/null
+	local sed awk $(pwd) echo readonly
+		export export --verbose | --verbose && $(pwd) ${HOME} echo
+	local cd ${HOME} && printf
+		--verbose sed sed -eu then grep awk ${HOME} test test test && echo cd "$1"
+echo --verbose /usr/bin local $(pwd) $(pwd) x=1 sed cd 'quoted text'
+		/usr/bin readonly "$@" "$@" "$@" awk
+readonly x=1 --verbose --verbose
+		"$@" ${HOME} then export --verbose "$@" $(pwd) x=1 --verbose test
+done local -eu done test -eu 2>/dev/null done then $(pwd)
+	readonly ${HOME} ${HOME} echo 2>/dev/null
+| local echo export "$1" -eu awk
+then printf ${HOME} export | awk && done test --verbose 2>/dev/null
+local printf | ${HOME} cd
+	x=1 test | "$@" /usr/bin -eu
+	"$1" 2>/dev/null awk then local -eu echo grep
+test grep test /usr/bin 2>/dev/null echo sed -eu local cd test x=1 ${HOME}
+'quoted text' export readonly 'quoted text' ${HOME} export
+		echo -eu $(pwd) local cd done -eu then then local grep
+readonly sed readonly 2>/dev/null "$1" /usr/bin x=1 done
+sed then && "$1" && readonly "$@"
+		2>/dev/null /usr/bin "$1" 2>/dev/null done
+		--verbose 'quoted text' ${HOME} "$@" local then ${HOME} export "$1" | --verbose
+	'quoted text' done $(pwd) echo printf 2>/dev/null
+	printf /usr/bin test cd ${HOME}
+	&& awk test awk grep "$@" then $(pwd) -eu x=1 ${HOME} 2>/dev/null
+		export cd printf --verbose done $(pwd) echo 2>/dev/null x=1 x=1 done
+grep ${HOME} "$@" "$@" cd x=1 readonly
+2>/dev/null local ${HOME} /usr/bin test test && readonly
+| 2>/dev/null 'quoted text' then cd sed ${HOME}
+	export done sed awk awk x=1 'quoted text'
+	cd test | sed x=1 grep printf test readonly /usr/bin cd grep sed /usr/bin
+		${HOME} sed test 'quoted text'
+		echo --verbose local awk
+export echo sed cd then export grep printf readonly
+	/usr/bin x=1 sed -eu "$1"
+	&& 2>/dev/null 'quoted text' "$@" ${HOME} | readonly
+		grep "$1" awk -eu "$1" $(pwd)
+	$(pwd) sed sed then then readonly
+		awk /usr/bin echo && done sed echo $(pwd) export export test
+		local echo 'quoted text' done $(pwd) -eu cd x=1 cd 2>/dev/null --verbose
+	x=1 /usr/bin readonly "$1" && awk cd ${HOME} --verbose x=1
+2>/dev/null -eu local -eu done grep 'quoted text' "$1" --verbose printf
+		| readonly | 2>/dev/null $(pwd) --verbose
+		/usr/bin -eu 2>/dev/null 2>/dev/null test export ${HOME} sed "$@" local
+awk printf readonly printf
+/usr/bin grep done readonly local sed
+	"$1" 2>/dev/null sed echo
+	readonly ${HOME} local readonly "$1" && $(pwd) "$@"
+	"$@" echo /usr/bin $(pwd) cd 'quoted text' local grep
+echo readonly grep 2>/dev/null grep done then readonly cd done
+		printf | "$1" x=1 export done x=1 $(pwd)
+then 'quoted text' test 2>/dev/null cd printf echo then printf printf 'quoted text'
+x=1 done "$1" $(pwd) "$1" x=1 test --verbose awk ${HOME} grep -eu local
+--verbose ${HOME} 'quoted text' | printf
+		export export test 2>/dev/null ${HOME} "$@" done sed awk echo awk | local
+	echo /usr/bin cd -eu readonly sed "$1" then test awk /usr/bin readonly
+	local sed awk $(pwd) --verbose readonly readonly
+"$@" "$@" export cd /usr/bin
+	--verbose done $(pwd) 2>/dev/null $(pwd) done x=1 x=1 awk
+/usr/bin local local "$1" readonly -eu | "$1" 2>/dev/null "$@"
+awk test echo echo then | cd then "$1" local $(pwd) -eu
+		done 'quoted text' export done readonly ${HOME}
+	done local cd x=1 -eu -eu sed grep
+done printf sed sed "$1"
+sed "$1" grep grep cd 2>/dev/null /usr/bin 'quoted text'
+| awk $(pwd) 'quoted text' /usr/bin "$@" printf /usr/bin
+	x=1 printf test | && | x=1 sed sed cd $(pwd) 'quoted text'
+${HOME} cd -eu cd done readonly
+		export | test ${HOME} "$@" && awk && --verbose /usr/bin --verbose ${HOME} local
+	"$@" --verbose && local /usr/bin x=1 export ${HOME} 2>/dev/null
+	&& readonly 'quoted text' then cd --verbose x=1 | 2>/dev/null awk x=1 -eu
+--verbose then awk --verbose done ${HOME} export done
+		readonly local local cd export | --verbose
+	cd test echo $(pwd) sed "$1"
+--verbose readonly ${HOME} 2>/dev/null $(pwd)
+/usr/bin grep grep cd "$1" && awk ${HOME} "$@" sed then awk
+then test test x=1 -eu $(pwd) 'quoted text' test export cd test
+	'quoted text' then | grep 'quoted text' /usr/bin | | $(pwd) local then
+		${HOME} x=1 $(pwd) done && --verbose
+		-eu sed x=1 export export 2>/dev/null
+	"$@" 2>/dev/null then test export
+	--verbose $(pwd) $(pwd) ${HOME} "$@" $(pwd) grep printf test grep
+	printf x=1 export awk printf sed printf readonly
+cd printf 'quoted text' done 'quoted text'
+$(pwd) --verbose done 2>/dev/null && && readonly
+	test | cd --verbose test grep cd cd "$1" /usr/bin then | $(pwd)
+"$1" awk /usr/bin done then "$1" grep
+		grep "$1" cd cd 'quoted text' awk 'quoted text' ${HOME}
+	then && then sed echo readonly 2>/dev/null ${HOME} export then done 2>/dev/null
+then export readonly readonly 2>/dev/null
+		echo | test 'quoted text' local | ${HOME} echo 'quoted text' "$1"
+		test && echo cd ${HOME} cd 'quoted text'
+		printf grep cd ${HOME} awk awk printf $(pwd) && echo
+grep printf $(pwd) "$1" cd 2>/dev/null done &&
+	${HOME} --verbose x=1 ${HOME} -eu /usr/bin $(pwd) test x=1 printf
+		readonly 2>/dev/null && sed test
+		-eu "$1" test test sed grep printf grep readonly 2>/dev/null export printf grep
+		-eu echo sed export "$@" grep sed export then 'quoted text' 2>/dev/null awk -eu
+		awk | ${HOME} sed sed sed printf | 'quoted text'
+		"$1" "$@" sed 2>/dev/null done then && sed cd
+		-eu ${HOME} && cd grep awk sed /usr/bin then ${HOME} -eu readonly $(pwd) done
+		'quoted text' | && --verbose done "$@" "$1" $(pwd) then
+	${HOME} done awk printf sed 2>/dev/null
+	${HOME} --verbose | | local done x=1 cd local && "$@" 'quoted text'
+		readonly ${HOME} export test printf 'quoted text' 2>/dev/null /usr/bin grep
+		grep -eu 2>/dev/null printf printf awk export --verbose
+x=1 done local cd echo grep done /usr/bin | export export
+	${HOME} x=1 ${HOME} then cd export echo --verbose grep
+| -eu readonly "$@" x=1 cd done cd echo -eu && printf cd
+done printf printf 'quoted text'
+	readonly "$1" /usr/bin local echo readonly "$@" grep
+	printf sed printf cd /usr/bin -eu "$@" readonly test export
+	| readonly -eu grep test export awk test 2>/dev/null sed
+		"$@" --verbose /usr/bin x=1 /usr/bin /usr/bin echo
+		| then -eu local "$1" printf $(pwd) readonly grep test 2>/dev/null --verbose
+		grep "$@" /usr/bin grep echo "$@" x=1 export
+		test done x=1 echo cd $(pwd) 'quoted text'
+		--verbose cd then "$1" x=1 ${HOME} --verbose 2>/dev/null echo 2>/dev/null
+'quoted text' grep then x=1 sed && awk 2>/dev/null $(pwd) | cd "$@"
+readonly --verbose sed | cd test "$@" | x=1
+		local local cd echo $(pwd) && then printf
+	echo $(pwd) awk printf printf export --verbose cd && grep 'quoted text'
+	${HOME} then cd "$1" /usr/bin "$@" grep $(pwd) "$@" "$1" grep echo grep
+	"$1" "$1" echo /usr/bin grep export && echo && awk export then local
+--verbose ${HOME} readonly 'quoted text' | then awk && readonly echo
+		local "$1" x=1 "$@" 2>/dev/null sed sed ${HOME} local
+		local -eu && --verbose export
+done && $(pwd) readonly printf sed then cd && test 'quoted text'
+2>/dev/null x=1 local "$1" "$@" done "$@" 2>/dev/null $(pwd)
+		test 2>/dev/null printf export local grep echo then grep awk $(pwd) then
+	export x=1 then && awk awk awk echo && then export
+	--verbose export /usr/bin then 2>/dev/null "$@" awk printf $(pwd) /usr/bin local
+	sed /usr/bin cd | test | "$1" 'quoted text' "$1" test test
+grep ${HOME} $(pwd) ${HOME} done grep test $(pwd) awk awk
+		then readonly $(pwd) sed "$@" cd /usr/bin | | export && x=1 --verbose ${HOME}
+local done 'quoted text' 'quoted text'
+	awk --verbose done awk ${HOME} -eu test --verbose
+"$1" ${HOME} printf grep "$1" echo
+	readonly -eu && echo && --verbose 2>/dev/null awk --verbose
+		--verbose ${HOME} /usr/bin
+		--verbose done echo grep awk cd -eu export awk grep sed $(pwd) grep $(pwd)
+cd echo printf readonly x=1 $(pwd) x=1
+'quoted text' readonly done export test x=1 "$@" awk /usr/bin "$1" cd test 2>/dev/null
+		then cd cd printf sed && && $(pwd) x=1 'quoted text'
+	/usr/bin grep && test x=1 done test local
+	--verbose cd "$1" --verbose
+export cd done 2>/dev/null && sed --verbose
+	awk 'quoted text' 2>/dev/null x=1 "$1"
+		local grep "$@" "$1" | 'quoted text' $(pwd)
+export --verbose cd cd -eu local awk | 2>/dev/null && x=1
+	&& -eu cd && grep awk ${HOME} -eu -eu local sed sed test x=1 | 'quoted text'
+		| | | local ${HOME} | export export
+	-eu /usr/bin cd --verbose done test "$@" echo test --verbose
+	/usr/bin && -eu $(pwd) $(pwd) awk | ${HOME} test echo "$@" -eu /usr/bin
+	echo "$1" "$@" grep local export -eu export |
+${HOME} sed export then export awk $(pwd) "$@" test done done export
+		then export export "$1" awk $(pwd) local
+		${HOME} $(pwd) "$1" sed ${HOME} --verbose "$1" 2>/dev/null then then printf
+	done awk "$1" printf "$1" $(pwd) | --verbose then awk ${HOME} test then local
+	export "$1" readonly export
+	export x=1 grep x=1 $(pwd) readonly 'quoted text'
+		--verbose local export echo sed test echo
+cd test export "$1" printf 2>/dev/null "$1" then "$@" then $(pwd) $(pwd) "$1"
+"$@" cd --verbose local sed | ${HOME}
+		echo printf "$@" | 2>/dev/null sed | local "$@" readonly grep
+		/usr/bin $(pwd) | "$@" x=1 2>/dev/null /usr/bin
+	/usr/bin 'quoted text' printf x=1 'quoted text'
+	"$@" printf && echo | -eu
+"$@" -eu test done echo ${HOME} readonly echo
+	2>/dev/null 2>/dev/null --verbose grep x=1 grep | printf printf cd
+		printf printf printf awk export then done local awk awk local
+	--verbose x=1 local test 'quoted text' "$1" sed cd && sed "$@" test
+	| grep $(pwd) printf printf /usr/bin -eu local "$@" printf printf sed then
+		2>/dev/null 'quoted text' $(pwd) awk local 'quoted text'
+test 2>/dev/null $(pwd) "$@" x=1 printf then 2>/dev/null --verbose
+then /usr/bin test export x=1 /usr/bin $(pwd) done "$1" readonly
+	${HOME} done x=1 awk && --verbose export done --verbose
+	printf readonly $(pwd) | done local "$@" local readonly && test local echo
+echo awk export "$@" "$@" --verbose readonly 'quoted text' x=1 $(pwd) local
+	"$1" -eu test | then
+	"$@" -eu "$1" cd readonly -eu sed 2>/dev/null
+'quoted text' "$1" readonly readonly done printf "$@"
+	readonly awk test echo 2>/dev/null
+		"$@" done && && test cd -eu readonly "$@" cd
+		${HOME} grep x=1 sed sed "$1" && printf readonly echo | -eu done
+export local printf awk "$@" 2>/dev/null
+		&& export grep cd "$1" 'quoted text' 'quoted text'
+	| x=1 readonly sed echo export then ${HOME} $(pwd) -eu ${HOME}
+printf ${HOME} done -eu | readonly cd done
+		sed 2>/dev/null ${HOME} test done grep ${HOME} readonly --verbose "$1"
+readonly 'quoted text' printf then 'quoted text' awk
+done export printf $(pwd) $(pwd) then export ${HOME} $(pwd)
+"$@" && cd printf awk -eu test 'quoted text'
+	grep -eu 'quoted text'
+grep export echo grep grep done
+	awk && && "$@" cd echo 'quoted text' /usr/bin -eu sed
+done "$1" done cd && 2>/dev/null then ${HOME} "$@" grep
+	x=1 x=1 local ${HOME} --verbose "$1" $(pwd) "$1" cd export done cd test x=1 test
+-eu export 'quoted text' 'quoted text' awk awk local
+		"$1" 'quoted text' -eu done test && --verbose awk then export
+	readonly 'quoted text' "$1" ${HOME} then "$@" --verbose "$1" grep
+		-eu readonly grep test awk export echo then grep grep | ${HOME}
+	2>/dev/null 2>/dev/null
+		2>/dev/null printf echo test export grep
+--verbose 'quoted text'
+	done test grep echo x=1
+x=1 awk local | 2>/dev/null grep cd local --verbose echo 2>/dev/null
+"$@" local --verbose 2>/dev/null "$@" /usr/bin
+		| test sed "$1" then -eu export awk grep echo grep
+		${HOME} 'quoted text' export /usr/bin "$@" grep export
+		printf done --verbose grep export
+		export ${HOME} printf 2>/dev/null x=1 x=1 | && echo test cd && "$@"
+		printf cd ${HOME} echo && echo $(pwd) then test 'quoted text' --verbose
+readonly | printf printf cd echo sed
+	| 2>/dev/null printf ${HOME} cd done local done "$@"
+	done x=1 /usr/bin sed
+"$1" test echo cd done x=1 test readonly
+echo echo | grep | then $(pwd) local
+		$(pwd) awk && /usr/bin printf | x=1 awk | "$1" --verbose
+test done $(pwd) grep 2>/dev/null "$@" awk
+	x=1 cd --verbose cd && "$@" ${HOME} $(pwd) sed 'quoted text'
+	| && export cd --verbose ${HOME}
+	x=1 sed x=1 local local sed "$@"
+	/usr/bin 2>/dev/null -eu export cd ${HOME}
+grep 'quoted text' export -eu cd $(pwd) | local echo
+		done grep awk then "$1" printf 'quoted text' echo &&
+${HOME} then echo awk then export "$@" "$@" && ${HOME} cd 2>/dev/null
+	printf -eu --verbose --verbose 'quoted text' printf echo local "$@"
+		-eu "$@" awk readonly /usr/bin
+-eu --verbose export "$@" x=1 ${HOME} done "$1" local
+"$@" x=1 x=1 ${HOME} export && grep grep 'quoted text'
+	export printf then /usr/bin printf done printf
+		${HOME} x=1 ${HOME} test 'quoted text' local done echo cd echo -eu ${HOME}
+readonly | | sed && echo test 2>/dev/null grep then
+		$(pwd) --verbose -eu export readonly done ${HOME} export grep
+	local ${HOME} echo readonly local "$1" /usr/bin readonly cd --verbose
+		"$@" | then "$@" local then "$@" $(pwd) "$@" 'quoted text' 2>/dev/null
+	| echo test x=1 ${HOME} x=1 'quoted text'
+	/usr/bin sed done ${HOME} printf "$1" "$@" grep | | printf --verbose
+		| "$@" then x=1 sed awk --verbose sed sed sed test
+awk then 'quoted text' echo -eu ${HOME}
+'quoted text' sed echo local
+	sed -eu export 2>/dev/null grep x=1 --verbose printf 2>/dev/null
+awk 2>/dev/null x=1 2>/dev/null $(pwd) printf /usr/bin 'quoted text'
+		-eu grep -eu awk "$@" ${HOME} | sed 'quoted text'
+-eu done readonly --verbose "$1" "$1" --verbose
+	--verbose --verbose sed export
+		"$@" -eu then /usr/bin
+		2>/dev/null grep /usr/bin && && /usr/bin x=1 x=1 x=1 echo $(pwd) then export
+		printf sed | | sed done -eu export echo cd awk readonly
+&& test sed test --verbose echo grep local
+	sed awk x=1 && printf 2>/dev/null
+	"$@" readonly local $(pwd) then "$1" 'quoted text' awk "$1" 2>/dev/null
+		sed echo grep cd echo -eu then export | -eu 2>/dev/null
+		local awk | printf "$1" "$1" $(pwd) done test
+		cd && --verbose then && 'quoted text' export | sed 'quoted text' 2>/dev/null
+		printf 2>/dev/null cd ${HOME} readonly "$1"
+2>/dev/null --verbose export ${HOME} ${HOME} --verbose
+'quoted text' sed sed && "$1" "$@" "$1" x=1 | done readonly && | /usr/bin
+x=1 printf local --verbose --verbose export awk printf "$1" local test
+		--verbose export sed --verbose
+	-eu /usr/bin | local echo /usr/bin export awk 'quoted text'
+${HOME} local && --verbose sed "$@"
+		2>/dev/null export $(pwd) -eu grep x=1 'quoted text' --verbose
+	sed export printf then /usr/bin && | test x=1 sed ${HOME} awk then ${HOME} $(pwd)
+| grep --verbose grep -eu "$1" sed | then
+$(pwd) then readonly -eu grep cd --verbose readonly
+cd test then done ${HOME} awk done $(pwd) grep ${HOME} readonly
+	&& ${HOME} printf awk -eu
@@ -0,0 +1,2001 @@
+	&& readonly | | "$@" then then test --verbose
+		test "$1" 2>/dev/null x=1 'quoted text'
+	grep ${HOME} awk awk test $(pwd) && 'quoted text' local
+sed printf printf "$@" 2>/dev/null /usr/bin
+		echo grep && | awk 'quoted text' then grep && $(pwd) /usr/bin
+		--verbose sed /usr/bin && cd grep grep -eu "$1" $(pwd) x=1 grep sed "$@"
+		local /usr/bin sed export export --verbose
+| export 2>/dev/null echo awk | "$@" x=1 "$@"
+export | | "$@" printf $(pwd) printf test
+	printf echo grep ${HOME} "$@" x=1 local 'quoted text'
+	local grep && export export export test export $(pwd) && /usr/bin
+		--verbose export && $(pwd) -eu $(pwd)
+awk sed test --verbose $(pwd) "$@" && cd grep readonly printf export then "$1"
+	sed printf -eu local "$1" test --verbose x=1 "$@"
+x=1 2>/dev/null readonly -eu printf
+	cd -eu /usr/bin done export | --verbose grep then "$1" then --verbose ${HOME}
+		awk export then printf $(pwd) "$1" x=1 "$1" $(pwd)
+echo echo "$1" x=1 echo
+	${HOME} && | cd printf readonly 2>/dev/null cd cd awk "$1" awk x=1 test
+"$@" && export ${HOME} then sed grep --verbose "$@" local --verbose "$1"
+done test 2>/dev/null export echo local /usr/bin -eu test echo awk &&
+	"$1" "$@" "$1" $(pwd) x=1 grep sed export printf -eu 'quoted text'
+		readonly readonly | --verbose $(pwd) "$1" && | | ${HOME} | 2>/dev/null
+	sed && && $(pwd) echo local --verbose "$1" grep -eu printf --verbose echo -eu 2>/dev/null
+	${HOME} "$1" export printf && cd echo -eu done x=1 readonly
+	cd local /usr/bin 2>/dev/null readonly readonly
+	cd x=1 --verbose $(pwd) readonly | 'quoted text'
+echo sed 'quoted text' $(pwd) x=1 'quoted text' echo printf && x=1 &&
+	cd cd -eu grep | x=1 printf /usr/bin /usr/bin "$@"
+local -eu 'quoted text' $(pwd)
+$(pwd) export local | && 'quoted text'
+		-eu readonly test x=1 printf done echo "$1" /usr/bin then
+		"$1" readonly export --verbose 'quoted text'
+| $(pwd) 'quoted text' $(pwd) && /usr/bin awk readonly x=1 | -eu && then readonly
+		-eu x=1 then -eu awk ${HOME} printf echo sed $(pwd)
+sed printf "$1" awk cd ${HOME} x=1 done
+test ${HOME} --verbose echo local printf | 2>/dev/null -eu local --verbose
+awk local "$1" -eu sed | awk 2>/dev/null /usr/bin
+	"$@" cd local /usr/bin echo printf
+		echo test sed grep 2>/dev/null "$@" awk ${HOME} 'quoted text'
+readonly export printf /usr/bin 2>/dev/null /usr/bin
+	done | export x=1 'quoted text' | export /usr/bin grep done x=1 | readonly
+	printf "$1" ${HOME} echo grep grep $(pwd) $(pwd) grep sed
+	grep | $(pwd) test cd x=1 2>/dev/null grep -eu export && x=1
+then local test readonly && "$1" 2>/dev/null "$1"
+		x=1 $(pwd) readonly 2>/dev/null /usr/bin
+cd "$@" | local sed "$@" printf "$1"
+"$@" "$1" echo $(pwd) readonly then | "$@" then test ${HOME} 'quoted text' sed
+	-eu grep && export cd export cd -eu /usr/bin then ${HOME}
+then /usr/bin --verbose "$1" then awk echo
+	'quoted text' printf export sed --verbose
+		$(pwd) test awk "$1" done cd
+	"$@" 2>/dev/null --verbose test | 'quoted text' "$1" sed readonly
+		x=1 echo local test done 'quoted text' --verbose --verbose test ${HOME} then
+		'quoted text' 'quoted text' export echo ${HOME}
+	-eu -eu export test 'quoted text' awk sed export
+		| 'quoted text' && $(pwd)
+	x=1 grep -eu printf 2>/dev/null | $(pwd)
+		readonly sed 'quoted text' readonly export export -eu done
+	echo sed grep "$@" export
+$(pwd) $(pwd) done echo export 2>/dev/null
+readonly sed /usr/bin | readonly --verbose test cd --verbose local awk
+	"$@" "$1" 2>/dev/null "$1" then then 2>/dev/null
+	${HOME} | 'quoted text' && done
+	grep -eu done -eu "$1" ${HOME} local sed echo 2>/dev/null
+	printf "$@" -eu done | local
+	$(pwd) sed printf 'quoted text' "$1" $(pwd) && printf sed "$1" "$1"
+-eu /usr/bin && $(pwd) 2>/dev/null grep awk "$@" export "$1" --verbose
+	cd x=1 2>/dev/null "$1" ${HOME}
+		2>/dev/null readonly x=1 'quoted text' && -eu then sed "$@" -eu test |
+	$(pwd) "$@" 2>/dev/null test "$@" -eu ${HOME}
+2>/dev/null export && "$1" ${HOME} printf export echo sed "$1" /usr/bin
+| -eu "$1" local echo done cd printf --verbose awk x=1 -eu x=1 ${HOME}
+	2>/dev/null 2>/dev/null /usr/bin readonly test --verbose
+	done export export -eu
+"$1" && 'quoted text' 2>/dev/null
+local cd local --verbose readonly sed $(pwd) printf "$@" echo x=1
+	2>/dev/null awk ${HOME} "$1" --verbose readonly "$1" --verbose readonly
+	done x=1 /usr/bin ${HOME} --verbose ${HOME}
+		| $(pwd) $(pwd) /usr/bin --verbose done "$1" 'quoted text' readonly -eu
+		${HOME} sed x=1 local | awk ${HOME}
+	| /usr/bin echo -eu $(pwd) test ${HOME} grep export then echo
+done 2>/dev/null "$@" echo readonly --verbose echo
+| echo readonly local "$@" echo | x=1 readonly -eu 2>/dev/null
+done test /usr/bin readonly -eu sed --verbose sed sed "$@" printf export export
+$(pwd) test 2>/dev/null done 'quoted text' ${HOME} then then $(pwd)
+	&& -eu echo echo readonly 'quoted text'
+		awk sed sed readonly 2>/dev/null "$1" && 2>/dev/null local echo && test
+"$@" printf grep 'quoted text'
+	'quoted text' local $(pwd) test | awk done printf readonly /usr/bin "$@" -eu ${HOME}
+	-eu x=1 printf cd 2>/dev/null "$@" test cd "$1" && cd echo then "$1" echo -eu
+	local local 'quoted text'
+	| export test sed /usr/bin /usr/bin then $(pwd) grep
+grep 'quoted text' awk -eu | test --verbose
+	/usr/bin readonly 2>/dev/null ${HOME}
+	| 'quoted text' "$@" echo "$@" test
+		grep 'quoted text' -eu test "$1" "$@"
+${HOME} local 'quoted text' cd x=1 2>/dev/null readonly
+	cd ${HOME} "$@" then local "$1" then
+sed sed test test | --verbose
+"$@" awk cd awk "$@" sed ${HOME} | ${HOME}
+-eu printf ${HOME} "$1" echo printf done 'quoted text' export 2>/dev/null readonly
+		'quoted text' sed "$@" local echo local | --verbose echo test --verbose then
+grep local readonly cd sed grep $(pwd) then test x=1 && awk awk
+	printf 'quoted text' && $(pwd) 'quoted text' printf -eu 2>/dev/null
+		| cd ${HOME} then -eu && /usr/bin printf $(pwd)
+	&& 2>/dev/null | | export local echo && grep $(pwd) grep --verbose --verbose
+	then test echo echo ${HOME} $(pwd) done test done
+	x=1 2>/dev/null 'quoted text' done $(pwd) local 2>/dev/null export | test 'quoted text'
+		then readonly x=1 "$@" "$1" sed then "$@" awk &&
+readonly done echo |
+	| -eu printf $(pwd) readonly && "$1" "$1" $(pwd) $(pwd) cd printf
+		| "$@" sed test | | done export 2>/dev/null
+	| ${HOME} then echo && done 'quoted text' --verbose "$1" ${HOME} echo sed local
+	--verbose "$@" --verbose local
+		grep 2>/dev/null 2>/dev/null 'quoted text' ${HOME}
+--verbose test | sed "$@" "$1" $(pwd) ${HOME} then /usr/bin --verbose "$1" test
+	export local local ${HOME} printf
+	2>/dev/null done then grep --verbose readonly cd /usr/bin --verbose
+${HOME} sed awk | /usr/bin then done 2>/dev/null x=1 | 'quoted text'
+		&& $(pwd) printf "$@" grep && local local 2>/dev/null 'quoted text' /usr/bin
+readonly 'quoted text' "$1" /usr/bin done x=1 ${HOME} cd test "$@" ${HOME} readonly
+		readonly 2>/dev/null x=1 /usr/bin local && export local sed echo 'quoted text'
+	$(pwd) then local "$@" readonly readonly ${HOME} local "$1" "$1" sed then x=1
+	echo readonly 'quoted text' ${HOME} cd export printf printf done readonly
+2>/dev/null "$@" /usr/bin ${HOME} --verbose printf $(pwd) export
+	readonly x=1 ${HOME} --verbose
+	then local export sed ${HOME} | test done awk 'quoted text' awk
+	awk done ${HOME} then export test
+		sed local && then export "$1" "$1" | x=1 printf local "$1" 2>/dev/null
+| done 2>/dev/null 'quoted text' x=1 "$1" cd echo $(pwd)
+		&& grep cd && printf --verbose echo readonly 'quoted text'
+grep sed 'quoted text' grep readonly --verbose "$1" | "$@" printf echo ${HOME}
+test grep awk $(pwd) -eu printf 2>/dev/null sed sed /usr/bin
+done test "$@" | x=1 --verbose sed $(pwd) sed -eu
+	"$1" ${HOME} | done done ${HOME} printf then ${HOME} done --verbose
+printf ${HOME} awk then x=1 2>/dev/null 'quoted text'
+local done local x=1
+"$@" ${HOME} ${HOME} export 2>/dev/null echo "$1" then "$1" 'quoted text'
+	local awk local $(pwd) && sed then echo export && /usr/bin /usr/bin local
+	"$1" "$1" | "$@" test cd && local $(pwd) printf export done
+	done test ${HOME} ${HOME} echo
+		then local readonly echo printf "$1" done test export && done ${HOME}
+	2>/dev/null 2>/dev/null 'quoted text' -eu ${HOME} readonly
+		readonly export | cd && x=1 local --verbose
+x=1 && cd printf echo 'quoted text' && && x=1 printf /usr/bin ${HOME} x=1 export
+	local 'quoted text' grep grep
+echo readonly ${HOME} && local "$1" printf
+test test x=1 then sed readonly awk cd /usr/bin then
+awk /usr/bin | grep then $(pwd) sed ${HOME} printf readonly | awk
+grep readonly test /usr/bin export --verbose x=1
+	sed && "$@" /usr/bin --verbose ${HOME} "$1" "$@" export "$@"
+| cd -eu done --verbose readonly
+	then cd cd --verbose readonly printf
+awk echo local | 'quoted text' /usr/bin grep sed done ${HOME} readonly grep done
+&& grep then x=1 "$@" "$@" "$1" export /usr/bin --verbose |
+echo "$1" printf && grep echo readonly
+${HOME} then $(pwd) --verbose x=1 sed test | then | | local 2>/dev/null $(pwd)
+--verbose then && grep awk awk printf 2>/dev/null
+	cd $(pwd) awk --verbose "$1" test sed "$1" | readonly 'quoted text' grep && | then
+	export readonly printf awk "$@"
+then test then x=1 --verbose
+-eu | -eu 2>/dev/null && x=1 sed /usr/bin cd | readonly /usr/bin cd x=1 done
+	readonly grep done "$@" done "$1" "$@" local x=1 export | && cd "$@" 2>/dev/null
+/usr/bin x=1 grep test
+cd echo "$1" done | cd --verbose 'quoted text' cd sed && "$1" test awk
+		"$1" $(pwd) export $(pwd)
+| done x=1 test ${HOME} export x=1 "$@" $(pwd) then "$1" test
+		/usr/bin printf done 'quoted text' $(pwd) cd awk test $(pwd) -eu x=1
+then $(pwd) && local "$1" -eu
+	| 'quoted text' ${HOME} /usr/bin && 2>/dev/null echo cd "$@" ${HOME} done /usr/bin
+		x=1 awk /usr/bin echo ${HOME}
+${HOME} "$@" /usr/bin echo -eu awk printf ${HOME} test -eu
+		done local sed "$@" awk grep "$@" awk export local 2>/dev/null /usr/bin 2>/dev/null
+	"$1" grep done "$1" local | "$@" 'quoted text' printf -eu cd "$@" ${HOME}
+x=1 'quoted text' cd then "$1" printf
+	/usr/bin 2>/dev/null | export $(pwd) printf "$@" then then
+done | test | awk $(pwd) "$@" grep test awk grep | awk --verbose export
+echo export cd export && cd $(pwd) x=1 export echo ${HOME} ${HOME}
+		cd local "$1" 'quoted text' /usr/bin grep export
+	/usr/bin 2>/dev/null grep
+	| "$1" && $(pwd) 'quoted text' local sed /usr/bin printf /usr/bin sed export
+	"$1" awk sed readonly awk "$1" printf readonly
+	then "$@" test -eu echo grep /usr/bin 2>/dev/null x=1 sed printf
+	cd test x=1 sed readonly sed --verbose 2>/dev/null export
+	&& | readonly printf grep then
+	'quoted text' | done done && "$1"
+		export export export x=1 then local "$@" --verbose
+		-eu sed test $(pwd) readonly local --verbose ${HOME} then "$@" --verbose
+	printf sed export printf export -eu
+	"$@" 'quoted text' && readonly "$@" "$1" ${HOME} sed echo grep then
+		x=1 done printf /usr/bin local printf then printf "$@" 2>/dev/null x=1
+	echo awk cd grep -eu test -eu
+	echo test 'quoted text' $(pwd) ${HOME} --verbose
+	awk x=1 then local "$@" cd then grep sed local
+	grep x=1 sed | test -eu done test 'quoted text' cd local
+		awk test "$@" -eu readonly "$1" "$@" && local 2>/dev/null sed export test |
+		local echo /usr/bin 'quoted text' export
+	$(pwd) sed test local echo awk ${HOME} cd cd -eu printf echo awk readonly
+	test -eu x=1 readonly 'quoted text'
+	grep 'quoted text' awk done cd -eu && echo sed ${HOME} awk then then export
+	sed grep | "$@" export -eu sed
+&& readonly test awk export grep
+then "$@" printf 2>/dev/null cd export echo "$@" then
+	grep "$@" export export "$@" local ${HOME}
+		echo readonly test local printf /usr/bin
+	then readonly ${HOME} 2>/dev/null cd cd printf sed
+	"$1" printf ${HOME} 'quoted text' awk && 'quoted text' "$@" printf done
+	/usr/bin | done echo "$1" "$@" then sed done grep sed ${HOME} awk grep
+	readonly /usr/bin grep --verbose | local awk done --verbose test sed cd --verbose
+	local /usr/bin test done "$@" /usr/bin done | readonly then "$1"
+done printf --verbose x=1 printf awk | 'quoted text' 2>/dev/null grep | local
+	printf -eu | $(pwd) /usr/bin -eu echo x=1 sed "$@" /usr/bin
+	--verbose then /usr/bin 'quoted text' test test sed test "$1"
+	&& | ${HOME} /usr/bin then awk x=1 local x=1 2>/dev/null "$@"
+		2>/dev/null $(pwd) export readonly --verbose
+		/usr/bin x=1 && /usr/bin "$1" && $(pwd)
+	test then /usr/bin 2>/dev/null
+${HOME} "$1" printf then x=1 then local && 'quoted text'
+		$(pwd) /usr/bin export "$1" test readonly test local printf sed ${HOME}
+	2>/dev/null readonly ${HOME} echo ${HOME} test "$@" 'quoted text' export
+	printf test then ${HOME} export grep x=1 "$@" 2>/dev/null -eu export awk
+	export cd test --verbose 2>/dev/null && echo && grep done cd readonly
+		readonly export printf done then export 2>/dev/null && $(pwd)
+local cd export ${HOME} local readonly
+		/usr/bin echo grep --verbose ${HOME} -eu
+export local grep sed test | test $(pwd) export 2>/dev/null 'quoted text'
+		local test | -eu done "$@" then 'quoted text' ${HOME}
+	sed printf -eu $(pwd) local awk 2>/dev/null | ${HOME}
+	done /usr/bin ${HOME} cd printf 'quoted text' export --verbose echo done
+	2>/dev/null | && && cd "$@" cd $(pwd)
+		/usr/bin /usr/bin readonly /usr/bin $(pwd) echo --verbose
+		awk printf --verbose export readonly cd 2>/dev/null $(pwd) sed grep -eu /usr/bin
+${HOME} sed then | ${HOME} then -eu grep test "$@" ${HOME} cd done
+	test "$@" then sed |
+	local cd --verbose export awk 'quoted text' --verbose grep awk ${HOME} local
+		grep --verbose "$1" local /usr/bin
+sed && printf 'quoted text'
+		cd "$1" grep sed /usr/bin "$@" export 2>/dev/null
+'quoted text' echo printf
+"$@" awk 'quoted text' printf 'quoted text'
+	printf x=1 /usr/bin ${HOME} --verbose local then echo test 2>/dev/null
+		printf 2>/dev/null export
+		--verbose && awk "$@" && x=1 -eu local test 2>/dev/null
+test done $(pwd) x=1 local x=1 sed export
+		local $(pwd) done && 2>/dev/null && x=1 grep export && local "$1" && export
+		$(pwd) && awk 'quoted text' "$@" local printf --verbose sed "$@"
+cd printf then echo "$@" $(pwd) sed 2>/dev/null 2>/dev/null
+	sed "$1" --verbose awk export sed x=1 "$1" $(pwd) done /usr/bin 2>/dev/null
+	sed done grep grep /usr/bin 'quoted text'
+		--verbose ${HOME} cd ${HOME}
+done printf then readonly "$@"
+		$(pwd) --verbose x=1 echo export awk "$1" /usr/bin
+"$@" $(pwd) sed readonly
+	&& export 2>/dev/null "$@" awk && | 'quoted text' printf &&
+		cd then done test -eu grep /usr/bin | readonly
+then 'quoted text' readonly sed "$@" done export "$1" cd readonly
+	&& test "$@" && then grep echo $(pwd) echo -eu printf
+x=1 grep x=1 ${HOME} sed $(pwd) grep echo grep then /usr/bin $(pwd)
+'quoted text' "$1" "$1" done awk $(pwd) export done done
+		readonly cd -eu test awk -eu
+		test sed export printf grep readonly done echo awk readonly && sed -eu
+awk done "$1" ${HOME} x=1 done local x=1 printf export
+	printf grep /usr/bin && readonly sed done awk 2>/dev/null ${HOME} test awk
+		test readonly sed 2>/dev/null /usr/bin local cd && sed 'quoted text'
+	${HOME} then x=1 then x=1 --verbose --verbose test ${HOME}
+awk sed "$1" export printf /usr/bin
+		grep readonly export export -eu | 'quoted text' /usr/bin -eu awk
+cd -eu then --verbose local awk export 'quoted text' export done cd then
+"$1" | && grep -eu grep test $(pwd) "$1" local 'quoted text'
+${HOME} local export --verbose && 2>/dev/null
+	x=1 awk then printf && test sed "$@" 'quoted text'
+		local local && --verbose
+		echo test grep then "$1" $(pwd) readonly
+then readonly --verbose 'quoted text' export 'quoted text' awk printf test -eu
+	cd printf | local printf echo local readonly /usr/bin 'quoted text'
+		'quoted text' export --verbose $(pwd) "$@" echo --verbose awk local then "$1" cd
+| x=1 -eu "$@" export 2>/dev/null /usr/bin
+awk printf --verbose done awk done && cd | $(pwd) 2>/dev/null
+	'quoted text' sed $(pwd) --verbose
+	--verbose printf $(pwd) local test
+printf x=1 && --verbose x=1 "$1" --verbose test awk 'quoted text'
+local printf local awk 2>/dev/null /usr/bin then 2>/dev/null "$1" test --verbose
+	local done local then awk printf
+/usr/bin local 'quoted text'
+export cd readonly --verbose --verbose 2>/dev/null
+2>/dev/null 2>/dev/null "$@" readonly ${HOME} sed grep 2>/dev/null "$1" /usr/bin
+done readonly -eu x=1 $(pwd) "$@" cd "$@" printf
+	| 'quoted text' x=1 "$1" local && sed -eu
+${HOME} export readonly /usr/bin readonly "$@" 2>/dev/null readonly grep 2>/dev/null
+echo "$1" 2>/dev/null done sed
+echo local x=1 --verbose sed x=1 sed "$1" export test done readonly $(pwd) readonly
+"$1" printf /usr/bin sed done sed 2>/dev/null sed awk readonly x=1
+		printf "$@" awk cd done $(pwd)
+	$(pwd) sed sed | "$@" test local | x=1 | 2>/dev/null /usr/bin ${HOME} readonly 'quoted text'
+		2>/dev/null done --verbose 'quoted text'
+	-eu /usr/bin grep "$1" echo done | 'quoted text' && awk then /usr/bin cd done "$@"
+	sed done grep x=1 test 'quoted text' && echo --verbose 'quoted text' grep
+	cd /usr/bin export test x=1 'quoted text'
+	local && 'quoted text'
+		printf 2>/dev/null x=1 | readonly then "$@" --verbose
+		then cd && sed readonly $(pwd) export awk echo then readonly /usr/bin
+cd echo then printf && | sed x=1 readonly 'quoted text' "$1" $(pwd) | -eu
+printf export | done readonly 2>/dev/null awk | | then test done x=1 "$1" export
+sed "$1" readonly cd grep 'quoted text' "$1" --verbose $(pwd) done
+	2>/dev/null done -eu done "$@" sed readonly 'quoted text' local "$1"
+	grep readonly /usr/bin "$1" cd x=1 -eu local echo printf x=1
+		export local local printf 'quoted text' 2>/dev/null /usr/bin done
+	&& local ${HOME} 2>/dev/null done 2>/dev/null awk 2>/dev/null
+		cd echo export 2>/dev/null && grep | export 2>/dev/null 'quoted text'
+		printf local ${HOME} 'quoted text' /usr/bin
+"$1" "$1" cd 'quoted text' printf
+done readonly | $(pwd)
+	2>/dev/null then readonly test sed && ${HOME}
+		done cd && "$1" echo test printf ${HOME} && readonly test "$@" export
+${HOME} "$@" awk local /usr/bin export x=1
+readonly readonly done cd x=1 grep "$1" "$@" 'quoted text' 2>/dev/null -eu export
+"$@" test /usr/bin grep && done $(pwd)
+x=1 done printf --verbose "$@" 'quoted text'
+--verbose export ${HOME} readonly $(pwd) $(pwd) echo
+	"$1" 2>/dev/null echo done x=1
+sed "$1" ${HOME} grep awk grep 'quoted text'
+"$@" 2>/dev/null awk ${HOME} done 2>/dev/null awk x=1
+		"$@" -eu done export $(pwd) sed test x=1 -eu
+local $(pwd) 'quoted text' awk then awk echo readonly /usr/bin
+2>/dev/null 2>/dev/null then "$1" grep export "$1" ${HOME} done done export
+		&& 'quoted text' ${HOME} "$1" x=1 printf $(pwd) 2>/dev/null export
+	-eu "$@" done awk then "$1" && then done | sed local awk x=1 done export $(pwd)
+-eu ${HOME} $(pwd) then /usr/bin
+		grep sed sed | x=1 awk awk
+then "$1" --verbose awk "$1" echo ${HOME} export "$@" $(pwd) "$1" grep
+	local local /usr/bin cd printf
+&& "$1" awk $(pwd) sed cd local then ${HOME} echo
+	cd | -eu $(pwd) local awk 'quoted text' 'quoted text' | "$1" /usr/bin
+		2>/dev/null echo local readonly printf 2>/dev/null /usr/bin
+	"$@" then readonly "$@" sed "$1" | 'quoted text'
+		| local sed 'quoted text' test
+2>/dev/null "$@" --verbose then -eu test test "$@" "$@" 2>/dev/null | grep
+sed test --verbose 2>/dev/null sed
+	${HOME} readonly "$1" | export --verbose grep awk test
+local x=1 "$@" x=1 done local printf --verbose then | echo 'quoted text'
+export done awk "$@" then $(pwd) | && | local grep awk "$@" readonly x=1 2>/dev/null
+${HOME} export readonly | printf ${HOME} then
+		| grep /usr/bin 2>/dev/null 'quoted text' && | -eu done
+		--verbose $(pwd) "$1" export export /usr/bin x=1 && 'quoted text'
+export 'quoted text' x=1 2>/dev/null 2>/dev/null "$@" test done done awk 'quoted text'
+${HOME} 2>/dev/null printf awk then "$@" | cd
+done && readonly ${HOME} "$1" awk
+	"$1" awk 'quoted text' --verbose grep grep cd 'quoted text'
+sed awk sed grep awk --verbose $(pwd) cd printf 2>/dev/null
+	x=1 awk -eu grep done echo grep export &&
+local grep 'quoted text' --verbose then done
+		then 2>/dev/null 'quoted text' grep x=1 awk printf $(pwd)
+	x=1 echo grep sed awk then
+printf printf readonly local
+-eu local readonly $(pwd) 'quoted text' --verbose
+		2>/dev/null echo printf local cd 'quoted text'
+	test "$@" printf "$1" then 'quoted text'
+	"$1" $(pwd) ${HOME} echo /usr/bin done sed export "$@" printf | -eu && --verbose
+grep echo awk --verbose sed echo "$@" 2>/dev/null
+	| then readonly local grep 'quoted text' test local /usr/bin
+	&& 'quoted text' x=1 cd && "$1" 'quoted text' $(pwd) x=1 -eu "$1" /usr/bin
+printf && test awk x=1 export
+then --verbose export ${HOME} "$1" readonly ${HOME} test x=1 $(pwd) echo
+		x=1 readonly grep grep ${HOME} awk --verbose "$@" local
+	"$@" readonly awk "$1" && test sed $(pwd)
+	--verbose sed --verbose --verbose sed | 2>/dev/null 'quoted text'
+		"$1" cd -eu printf then | test test printf echo "$1" | awk "$@" printf 2>/dev/null
+		echo done echo "$@" readonly 'quoted text'
+grep $(pwd) 'quoted text' "$@" ${HOME} local test ${HOME} | /usr/bin --verbose
+readonly $(pwd) local -eu export sed | done
+sed sed $(pwd) then test awk "$@"
+		'quoted text' sed printf export && echo export cd readonly /usr/bin "$@" test
+		local sed -eu awk ${HOME} --verbose
+		/usr/bin grep && printf --verbose then echo export export ${HOME}
+		--verbose 'quoted text' ${HOME} -eu --verbose "$@"
+&& ${HOME} /usr/bin export -eu /usr/bin $(pwd)
+awk done ${HOME} x=1 awk
+	-eu done && local x=1 "$@" && sed | export echo printf readonly /usr/bin
+	"$1" x=1 export test /usr/bin test /usr/bin 'quoted text'
+	| readonly 2>/dev/null
+		-eu awk --verbose grep x=1 "$1" ${HOME} export awk 'quoted text'
+		/usr/bin awk 'quoted text' --verbose done awk "$@" test | sed --verbose done --verbose
+readonly $(pwd) x=1 "$@"
+awk | awk 2>/dev/null done -eu
+	then grep x=1 && --verbose /usr/bin "$1" done && echo then done "$@"
+then readonly /usr/bin local local local "$1"
+	cd "$@" grep local | local "$@" grep sed
+"$1" x=1 printf echo "$@" then | && -eu
+'quoted text' -eu done cd /usr/bin printf done printf ${HOME} awk then then
+${HOME} done echo test cd ${HOME} "$1"
+&& 2>/dev/null -eu done readonly
+	2>/dev/null $(pwd) echo sed cd --verbose
+		done export sed "$1" test --verbose
+$(pwd) x=1 'quoted text' export $(pwd) export export /usr/bin -eu
+"$@" readonly awk 'quoted text'
+	$(pwd) printf | grep "$1" 'quoted text'
+done then echo awk cd then -eu x=1 done --verbose sed
+		| grep 2>/dev/null done "$1" test --verbose | ${HOME} --verbose
+	"$1" awk cd 2>/dev/null test local --verbose done 'quoted text' done awk
+readonly done "$1" awk $(pwd) sed "$1" /usr/bin
+	done then awk --verbose
+		grep local done && export sed 2>/dev/null grep $(pwd) x=1
+		readonly awk && sed readonly cd | ${HOME} echo
+printf x=1 && printf --verbose ${HOME} --verbose /usr/bin
+	cd && printf export /usr/bin cd echo -eu 2>/dev/null x=1 readonly
+	$(pwd) local | then grep 'quoted text' grep
+test cd printf 2>/dev/null
+	'quoted text' | && test --verbose printf && then 2>/dev/null
+"$1" readonly "$1" test awk local ${HOME}
+		/usr/bin | ${HOME} "$@" then 2>/dev/null test readonly
+x=1 | test awk ${HOME} /usr/bin done then x=1 /usr/bin sed
+	x=1 done readonly x=1 2>/dev/null grep 2>/dev/null && ${HOME}
+		--verbose "$1" grep local
+'quoted text' cd 'quoted text' readonly && "$1" /usr/bin "$@" --verbose
+	local ${HOME} cd awk x=1 grep sed ${HOME}
+	cd printf printf sed | cd readonly
+		--verbose export then 'quoted text'
+local local ${HOME} done $(pwd) grep local printf | 2>/dev/null ${HOME}
+	then then local then
+	export $(pwd) $(pwd) x=1 /usr/bin --verbose echo x=1
+		| test 2>/dev/null -eu x=1 cd sed 'quoted text' awk 2>/dev/null 2>/dev/null
+	awk export && x=1 | printf then test sed
+	grep export sed local local then test "$@" echo local
+awk echo readonly $(pwd)
+		/usr/bin --verbose export
+$(pwd) | "$@" "$1" -eu && | x=1 sed && sed
+	2>/dev/null export grep grep done "$1" sed export awk test printf
+'quoted text' -eu test ${HOME} printf sed done --verbose done echo --verbose
+		--verbose | then --verbose -eu awk then sed ${HOME}
+cd test then echo cd /usr/bin $(pwd) local local --verbose
+	"$1" readonly --verbose &&
+&& -eu local 'quoted text' x=1 then local "$@" sed test -eu --verbose
+--verbose 2>/dev/null echo local
+sed -eu sed readonly x=1 grep printf -eu -eu ${HOME}
+	readonly echo /usr/bin printf -eu ${HOME} grep
+done grep grep sed x=1 'quoted text'
+	"$1" ${HOME} && grep $(pwd) test
+		/usr/bin awk 2>/dev/null grep
+	done -eu x=1 x=1 sed | 'quoted text' export ${HOME} readonly
+	grep printf cd local 2>/dev/null test readonly "$1" ${HOME}
+echo && | sed export grep -eu ${HOME} && printf 'quoted text' $(pwd)
+		"$@" grep "$1" -eu "$1" readonly
+echo ${HOME} done | "$1" cd /usr/bin | /usr/bin echo
+		awk done 'quoted text'
+		cd 'quoted text' done printf --verbose x=1 "$1" $(pwd) awk
+	grep | 'quoted text' $(pwd) "$@" readonly --verbose grep ${HOME}
+done then readonly $(pwd) printf "$1" $(pwd) printf --verbose
+	done readonly 2>/dev/null readonly test sed "$1" | 2>/dev/null
+2>/dev/null && --verbose --verbose 2>/dev/null readonly
+		2>/dev/null echo /usr/bin $(pwd) "$@" test done /usr/bin
+readonly /usr/bin cd 'quoted text'
+"$@" readonly done | export 2>/dev/null
+awk 'quoted text' grep ${HOME} echo && export test cd printf then x=1 export done
+&& ${HOME} printf cd cd -eu export
+	&& grep readonly readonly done -eu 2>/dev/null
+		export export sed local done x=1 -eu $(pwd) 'quoted text'
+	printf | 'quoted text' /usr/bin local then echo readonly ${HOME}
+	awk 'quoted text' $(pwd)
+		done $(pwd) export "$@" -eu sed awk done export | printf -eu printf local
+	2>/dev/null sed 2>/dev/null cd sed
+	then -eu /usr/bin local readonly && 'quoted text' done
+		"$1" 2>/dev/null then then ${HOME}
+-eu "$@" x=1 export x=1
+	$(pwd) grep "$1" --verbose
+		x=1 export cd 2>/dev/null | test cd -eu export printf 'quoted text' readonly
+x=1 test "$1" test cd 'quoted text'
+	sed local test $(pwd) ${HOME} cd sed echo "$1" $(pwd) cd
+		| ${HOME} done -eu export sed "$@" --verbose 2>/dev/null
+/usr/bin cd sed cd test && 'quoted text' "$1" echo ${HOME} 2>/dev/null grep "$@"
+then "$@" 2>/dev/null local echo local done test $(pwd) -eu $(pwd) | ${HOME} "$1"
+	export x=1 x=1 test -eu "$1" --verbose ${HOME} $(pwd) grep ${HOME}
+	| 'quoted text' readonly "$@" echo echo --verbose 2>/dev/null && awk
+	--verbose "$@" --verbose | echo "$1" awk --verbose
+	awk awk local 'quoted text' local $(pwd) ${HOME}
+		sed $(pwd) /usr/bin 2>/dev/null
+		readonly test awk echo done /usr/bin readonly 'quoted text'
+/usr/bin && sed 'quoted text'
+		-eu /usr/bin 2>/dev/null 'quoted text'
+	done 2>/dev/null "$@" && export awk
+--verbose cd | /usr/bin printf then done "$@" printf "$1" then
+	echo $(pwd) /usr/bin x=1 && awk printf done export export --verbose done "$@"
+		awk "$@" "$1" done -eu then
+	then then local $(pwd) echo 'quoted text' && -eu done "$@"
+	grep ${HOME} local grep ${HOME} 2>/dev/null awk readonly sed awk 2>/dev/null
+		/usr/bin && x=1 awk local grep | printf awk && printf ${HOME} sed done 2>/dev/null
+$(pwd) then test printf --verbose /usr/bin /usr/bin export done ${HOME}
+	printf ${HOME} echo local -eu 'quoted text' ${HOME} then awk -eu readonly
+	"$@" grep grep x=1 $(pwd) export x=1 test awk sed
+	sed --verbose 2>/dev/null /usr/bin awk local then test cd "$1" -eu
+	--verbose then readonly x=1 && --verbose $(pwd) --verbose | &&
+		"$1" 'quoted text' /usr/bin cd sed local
+x=1 | x=1 ${HOME} test cd grep done ${HOME}
+		awk done done 'quoted text' "$1" local echo
+	awk export /usr/bin sed readonly readonly $(pwd)
+"$1" local grep $(pwd) awk cd $(pwd) ${HOME} ${HOME} "$@" printf grep
+	test awk ${HOME} done "$@" $(pwd) ${HOME} test readonly
+done && 'quoted text' -eu echo /usr/bin readonly /usr/bin | readonly |
+		done echo cd $(pwd) export ${HOME} then
+	sed /usr/bin printf -eu | cd test awk cd grep | 2>/dev/null export | "$@" printf
+		local grep /usr/bin grep 'quoted text' | /usr/bin "$1" printf
+		sed 2>/dev/null 'quoted text' grep test printf cd -eu test && done readonly
+2>/dev/null 'quoted text' && -eu $(pwd) | -eu 'quoted text'
+x=1 echo | sed grep --verbose && awk sed sed readonly -eu &&
+		/usr/bin sed done awk "$1" "$1"
+	| sed /usr/bin -eu $(pwd) sed awk export x=1 then /usr/bin -eu 'quoted text'
+		| test done done test 2>/dev/null "$@" "$1" readonly cd test
+		-eu 'quoted text' grep "$1" && ${HOME} --verbose done
+readonly -eu sed test && ${HOME} export cd "$@" 2>/dev/null test local
+	'quoted text' echo sed awk export done &&
+	"$@" ${HOME} then done grep echo cd --verbose "$@" --verbose test 'quoted text'
+	then done $(pwd) ${HOME} printf echo 2>/dev/null printf
+	test -eu x=1 && grep grep "$1" $(pwd) "$1" /usr/bin done && cd x=1 awk | grep "$@"
+		$(pwd) 'quoted text' $(pwd) $(pwd) readonly
+		readonly grep export export local
+		x=1 --verbose --verbose sed 'quoted text'
+	2>/dev/null cd | 'quoted text' 2>/dev/null 'quoted text' "$@" awk ${HOME} x=1 ${HOME}
+		"$1" test /usr/bin x=1 2>/dev/null readonly local sed
+	cd --verbose --verbose | $(pwd) echo x=1 /usr/bin awk -eu /usr/bin local
+		printf sed 2>/dev/null ${HOME} "$1" cd sed test && 2>/dev/null
+-eu done export printf $(pwd) 'quoted text' 'quoted text' then test export ${HOME}
+	test /usr/bin "$@" printf "$1" 2>/dev/null then -eu readonly x=1 /usr/bin "$1"
+	$(pwd) "$@" then ${HOME} test --verbose cd echo local "$1" test ${HOME}
+local -eu 2>/dev/null "$@" 'quoted text'
+		2>/dev/null export export local 'quoted text'
+	/usr/bin awk then test then $(pwd) "$@" |
+grep "$@" sed then /usr/bin --verbose -eu $(pwd) printf && "$1"
+	echo 'quoted text' $(pwd) test && ${HOME} /usr/bin sed then grep printf
+	sed x=1 $(pwd) "$1" ${HOME} "$@" | then && -eu export
+	"$@" awk grep 'quoted text' local readonly x=1
+		--verbose 'quoted text' | cd grep
+echo cd | /usr/bin x=1 echo && ${HOME} then "$@" -eu && -eu | x=1 x=1 2>/dev/null
+test 2>/dev/null $(pwd)
+		sed "$1" export done export awk awk --verbose
+	then done /usr/bin $(pwd) export printf printf && --verbose local
+2>/dev/null | test done then readonly ${HOME}
+	then 'quoted text' awk "$@" 2>/dev/null
+		sed "$1" readonly "$1" /usr/bin done /usr/bin $(pwd)
+sed sed ${HOME} "$@" /usr/bin
+	'quoted text' done echo && test grep export
+	| "$1" export "$@" local "$1" 'quoted text'
+/usr/bin $(pwd) $(pwd) 'quoted text' 'quoted text' 2>/dev/null
+'quoted text' readonly test --verbose
+x=1 then then -eu ${HOME} readonly sed --verbose /usr/bin done echo
+		'quoted text' && 'quoted text' printf
+-eu sed -eu | sed x=1 awk printf echo done $(pwd) x=1
+awk awk "$@" cd "$1" x=1 cd
+	printf then ${HOME} test readonly export /usr/bin -eu -eu -eu ${HOME}
+		then local cd cd 'quoted text' 2>/dev/null
+&& then ${HOME} cd && done awk | test export | awk ${HOME} "$@" 2>/dev/null done
+/usr/bin /usr/bin $(pwd) local echo then /usr/bin "$@" echo | test awk sed 2>/dev/null
+		| readonly "$1" awk local then awk export test awk export
+		${HOME} done && grep --verbose sed test -eu $(pwd) local grep 2>/dev/null
+	-eu local awk readonly -eu "$1" grep awk "$1" done awk grep cd
+sed awk then 'quoted text' done 'quoted text' x=1 ${HOME} x=1 | done /usr/bin
+		export && ${HOME} cd 2>/dev/null awk sed local
+		readonly --verbose && --verbose test 2>/dev/null "$@" export 'quoted text' done
+	test "$1" "$@" readonly local grep | done
+		readonly local export | 2>/dev/null sed echo /usr/bin
+	grep "$1" 2>/dev/null
+test awk /usr/bin "$@" x=1 cd x=1 cd
+		-eu done local ${HOME} $(pwd)
+	export && 2>/dev/null export 2>/dev/null cd cd 'quoted text'
+	test --verbose sed $(pwd) -eu "$1" export test ${HOME} awk /usr/bin
+		awk then x=1 done readonly "$1" cd local && awk grep $(pwd) then
+'quoted text' 'quoted text'
+		$(pwd) cd ${HOME} ${HOME}
+		$(pwd) local --verbose /usr/bin "$1" printf ${HOME} grep export grep "$@" "$1" -eu
+	grep cd 2>/dev/null "$@" printf done
+${HOME} "$@" grep sed 2>/dev/null test && test /usr/bin grep awk sed "$1" awk
+then x=1 && x=1 export /usr/bin cd /usr/bin ${HOME} -eu /usr/bin --verbose
+		awk then /usr/bin ${HOME} --verbose && then 'quoted text'
+		awk cd local export "$@"
+	$(pwd) /usr/bin sed -eu
+awk echo "$@" -eu x=1 readonly local $(pwd) /usr/bin --verbose
+	--verbose --verbose local
+	awk local /usr/bin test "$@" grep $(pwd) $(pwd) grep
+"$1" test done sed /usr/bin "$1" test "$@" --verbose readonly done "$@"
+	'quoted text' test /usr/bin done export echo
+		awk $(pwd) && cd test -eu printf readonly ${HOME} 2>/dev/null grep
+	"$@" /usr/bin printf then
+	${HOME} export 2>/dev/null then ${HOME} x=1 ${HOME} then "$@" 2>/dev/null
+	local --verbose ${HOME} done done
+		sed export | test $(pwd) echo && $(pwd) grep $(pwd) $(pwd) awk
+	done readonly $(pwd) $(pwd) awk && echo then echo "$1" grep
+grep $(pwd) printf echo test cd grep | done
+		printf && local x=1 --verbose readonly then done test grep cd grep ${HOME} /usr/bin
+-eu 'quoted text' "$1" echo printf printf
+	"$1" export grep cd test "$1" $(pwd) cd -eu awk 2>/dev/null
+printf -eu x=1 x=1 cd
+		${HOME} test cd -eu && 'quoted text'
+	local 2>/dev/null then export --verbose
+		"$1" done 2>/dev/null | grep 'quoted text' grep ${HOME} ${HOME} echo cd cd
+	'quoted text' cd 'quoted text'
+export export 2>/dev/null printf "$1" awk awk echo
+	-eu 2>/dev/null "$@" | sed sed
+	${HOME} 'quoted text' printf 'quoted text'
+	local -eu -eu "$1" awk echo
+	done && then 'quoted text' sed && && -eu /usr/bin cd
+readonly ${HOME} && echo grep cd echo printf done x=1 2>/dev/null
+printf export 2>/dev/null | "$@" export 2>/dev/null local "$1" 2>/dev/null
+	/usr/bin 'quoted text' -eu x=1 grep sed 'quoted text' then --verbose printf done
+	export -eu 'quoted text'
+export awk 'quoted text' --verbose && export && local echo 'quoted text' "$@" $(pwd)
+	export -eu cd | test awk x=1 "$@" then
+		'quoted text' /usr/bin x=1 sed "$1"
+export done cd "$1" | test --verbose grep sed grep done
+	echo readonly x=1 test then local -eu --verbose test then cd export echo "$1" awk
+		| /usr/bin /usr/bin echo echo cd $(pwd) --verbose && test echo local
+	then "$@" $(pwd) awk x=1 echo test | test 'quoted text' awk then
+	export then grep && --verbose export
+${HOME} export ${HOME} --verbose export done -eu ${HOME} then grep awk cd
+x=1 readonly readonly local "$1" readonly "$1"
+| /usr/bin 'quoted text' x=1 export grep "$@" "$@" echo
+done /usr/bin -eu grep printf && 'quoted text'
+echo printf -eu /usr/bin readonly $(pwd) sed then 2>/dev/null then $(pwd) then
+	then then | && readonly 2>/dev/null done ${HOME} | test
+	&& then x=1 "$@" "$@" local local | awk
+-eu grep /usr/bin $(pwd)
+	--verbose echo --verbose ${HOME} -eu x=1 -eu awk | ${HOME} cd done 2>/dev/null
+		cd echo then done done export
+	"$@" printf test && then echo grep
+		| | "$@" grep "$@" awk ${HOME} "$1" awk grep test
+2>/dev/null sed -eu ${HOME} readonly local printf && -eu sed grep "$@" "$@"
+	done /usr/bin awk /usr/bin ${HOME} x=1 ${HOME} | echo readonly grep
+	readonly | cd done readonly echo sed x=1 --verbose | && | x=1 local
+export "$@" /usr/bin printf awk "$1" readonly ${HOME} readonly x=1 test x=1
+	export cd readonly local
+	echo --verbose -eu grep | 2>/dev/null
+	x=1 --verbose 'quoted text' done -eu then
+	readonly test echo $(pwd)
+	test readonly $(pwd) cd printf ${HOME} x=1 "$@" export export /usr/bin ${HOME}
+	local sed x=1 test export awk grep sed printf readonly ${HOME} export
+readonly --verbose x=1 'quoted text' 2>/dev/null | readonly && 2>/dev/null
+	&& export 2>/dev/null x=1 'quoted text' -eu 'quoted text' --verbose -eu
+	'quoted text' | | -eu "$1" --verbose 'quoted text'
+	awk | test cd -eu echo ${HOME} awk local --verbose
+		done /usr/bin x=1 awk /usr/bin $(pwd) readonly
+		&& "$@" $(pwd) cd test awk echo awk export 2>/dev/null
+| x=1 cd "$1" echo /usr/bin | "$@" --verbose ${HOME}
+	awk readonly | done local | awk ${HOME} ${HOME} printf
+	test -eu done done readonly | awk
+	| -eu readonly x=1 cd awk && export readonly 2>/dev/null /usr/bin
+| 'quoted text' test readonly -eu -eu local local -eu --verbose
+	sed echo awk $(pwd) grep 'quoted text' "$1" grep "$1" local printf 'quoted text'
+		then /usr/bin 'quoted text' done printf cd 2>/dev/null export --verbose
+		test 'quoted text' sed 2>/dev/null cd echo ${HOME} then
+		sed echo test printf -eu | printf export cd -eu sed 'quoted text'
+		echo $(pwd) && 2>/dev/null $(pwd) readonly 'quoted text' test done echo
+		--verbose 2>/dev/null export "$@" awk awk echo awk
+		--verbose "$@" $(pwd) grep cd local
+		${HOME} done x=1 printf echo --verbose ${HOME}
+	grep test "$@" 2>/dev/null "$@" x=1 done "$@" cd /usr/bin | ${HOME} | --verbose
+		--verbose test then grep awk 'quoted text' local readonly done grep $(pwd)
+	$(pwd) 2>/dev/null --verbose readonly
+		2>/dev/null readonly $(pwd) $(pwd) readonly
+$(pwd) 'quoted text' done grep done
+		sed then local local cd x=1 2>/dev/null x=1 export "$1" $(pwd)
+		echo x=1 then | ${HOME} done 'quoted text'
+	sed grep awk ${HOME} test test printf -eu test done printf then awk --verbose
+/usr/bin export "$@" x=1 x=1 grep printf /usr/bin 2>/dev/null | --verbose | printf
+readonly readonly $(pwd) && local 'quoted text' echo "$1" printf
+		${HOME} grep "$1" -eu "$@" "$1" x=1 --verbose
+	"$@" awk grep then ${HOME} test cd --verbose then $(pwd)
+		"$1" local | cd done done
+		then | readonly sed echo /usr/bin cd && printf "$@" -eu sed then cd -eu readonly
+| x=1 -eu export echo --verbose ${HOME} cd export test -eu /usr/bin 'quoted text'
+| awk ${HOME} awk /usr/bin -eu -eu "$@" sed /usr/bin
+		echo grep $(pwd) x=1 then --verbose ${HOME} sed /usr/bin echo grep 'quoted text'
+		&& done readonly local --verbose grep -eu printf | 'quoted text'
+		| test export printf grep | /usr/bin cd done ${HOME}
+sed awk "$@" export x=1 sed done local
+"$1" $(pwd) readonly printf sed
+awk --verbose local && local "$1" echo test printf export && --verbose cd awk ${HOME}
+		export test echo /usr/bin test "$1" -eu "$1"
+	"$1" test | x=1 "$@" local export done "$@" -eu
+	sed echo readonly && printf
+-eu done local | --verbose echo 2>/dev/null 'quoted text'
+echo done then done 'quoted text' done && ${HOME} awk
+	$(pwd) /usr/bin sed "$@"
+	readonly cd done "$@" && test grep 'quoted text' local x=1 -eu printf
+"$@" then /usr/bin x=1 printf ${HOME} ${HOME} done
+awk sed "$1" echo x=1 cd readonly --verbose
+		/usr/bin sed && awk awk awk grep done local grep
+		test sed export grep
+"$@" ${HOME} && -eu then sed sed | "$1" -eu $(pwd) then echo echo "$@"
+'quoted text' -eu "$@" ${HOME} then $(pwd)
+/usr/bin 2>/dev/null 2>/dev/null $(pwd)
+done echo printf "$1" 'quoted text' "$1"
+		"$1" && sed "$1" 'quoted text' --verbose ${HOME} 'quoted text'
+		${HOME} x=1 ${HOME} "$@" x=1 | readonly
+		cd -eu -eu | "$1" then printf | readonly 2>/dev/null 2>/dev/null
+"$@" done $(pwd) test then
+	cd test ${HOME} ${HOME} awk test echo
+	--verbose test readonly -eu x=1 printf $(pwd) ${HOME}
+		$(pwd) -eu --verbose printf test && export done | "$1" local sed done
+	"$@" 2>/dev/null $(pwd) ${HOME} cd readonly --verbose x=1 echo echo
+		readonly sed local | /usr/bin --verbose cd &&
+		/usr/bin 2>/dev/null 'quoted text'
+	"$@" then sed test sed then /usr/bin /usr/bin cd x=1 &&
+	'quoted text' && export --verbose
+	echo readonly "$1" $(pwd) /usr/bin -eu /usr/bin done ${HOME} printf
+	local sed -eu local && 2>/dev/null export "$1" printf printf test awk ${HOME}
+		$(pwd) ${HOME} | ${HOME} /usr/bin | printf ${HOME} 2>/dev/null
+	| ${HOME} 2>/dev/null grep printf echo cd test readonly "$@"
+		printf sed && local "$@" then "$@" | --verbose local local awk printf
+	then local $(pwd) /usr/bin "$@" x=1 printf x=1
+		-eu awk awk printf /usr/bin /usr/bin && cd awk
+$(pwd) --verbose -eu 'quoted text' && awk sed $(pwd) grep && then grep sed
+test grep echo | awk
+cd && ${HOME} -eu export test x=1 -eu
+sed readonly x=1 ${HOME} printf --verbose sed done
+	grep local --verbose 'quoted text' then
+'quoted text' ${HOME} /usr/bin
+	x=1 | sed -eu --verbose | 'quoted text' "$1" grep grep $(pwd) echo --verbose
+	${HOME} "$@" $(pwd) grep cd /usr/bin done readonly
+		awk && sed ${HOME} "$@" sed awk "$1" $(pwd) grep then grep $(pwd) x=1 'quoted text'
+	done test -eu then $(pwd) "$@" && -eu ${HOME}
+echo -eu /usr/bin &&
+		--verbose grep x=1 grep awk echo "$1" && done export x=1 /usr/bin awk then
+	readonly sed "$1" && export done local sed x=1 echo x=1 done grep grep
+		grep local /usr/bin printf
+	&& sed local test readonly -eu $(pwd) local $(pwd)
+	${HOME} grep then cd local then x=1 ${HOME} -eu
+		awk echo "$@" "$1" "$@" local | $(pwd) ${HOME} "$1" local /usr/bin test awk
+"$@" export sed 'quoted text'
+	grep printf "$@" readonly -eu /usr/bin sed "$@" test
+test export "$1" 'quoted text' x=1 then
+	local grep done printf /usr/bin x=1 test printf done sed 'quoted text'
+		--verbose --verbose readonly
+	sed --verbose readonly -eu "$1" awk 'quoted text' local /usr/bin grep
+		local test grep awk echo printf --verbose readonly /usr/bin readonly test 'quoted text'
+	| echo 2>/dev/null -eu | done echo "$@" done sed && 2>/dev/null
+'quoted text' awk 2>/dev/null cd then --verbose /usr/bin sed 2>/dev/null
+test grep /usr/bin "$1" readonly 2>/dev/null |
+printf ${HOME} sed echo local
+		test -eu test --verbose "$@" /usr/bin /usr/bin --verbose -eu --verbose
+	printf ${HOME} export readonly ${HOME} test "$1" $(pwd) done $(pwd) echo local
+	x=1 printf readonly ${HOME} x=1 test grep
+	echo | -eu 'quoted text' "$@" x=1 printf printf echo echo "$@"
+done ${HOME} 2>/dev/null | ${HOME} export sed done 2>/dev/null then
+"$@" grep awk "$1" 'quoted text' x=1 done |
+"$1" test ${HOME} then sed readonly "$1" "$@" "$1" "$1" -eu "$1" sed
+--verbose awk 'quoted text' awk /usr/bin
+	then printf local "$@" && ${HOME} done sed 2>/dev/null
+	cd sed && local cd printf then
+echo readonly $(pwd) /usr/bin
+		then cd sed -eu $(pwd) cd grep export export "$1" export && test | x=1 awk ${HOME}
+		export printf /usr/bin sed then then | $(pwd) x=1 && --verbose
+		test sed && test test ${HOME} sed --verbose 2>/dev/null done
+2>/dev/null export "$@" test && "$@" awk -eu sed then
+	${HOME} -eu readonly /usr/bin readonly /usr/bin readonly
+		export then local then export then
+	echo 'quoted text' x=1 'quoted text' $(pwd) awk --verbose test readonly echo
+	then x=1 /usr/bin $(pwd) 2>/dev/null
+	readonly && && $(pwd) local "$@" echo sed echo export cd -eu awk -eu echo cd echo
+		sed /usr/bin done cd test "$@" ${HOME} --verbose awk printf test
+	printf "$@" ${HOME} "$@" /usr/bin 2>/dev/null --verbose --verbose
+done awk 'quoted text'
+	cd -eu readonly | awk ${HOME} export "$1" 'quoted text' --verbose grep ${HOME}
+2>/dev/null --verbose awk printf readonly sed "$1" sed
+	readonly local done printf "$1" 2>/dev/null
+-eu -eu readonly export sed "$1" local | ${HOME} "$@" awk --verbose && "$@"
+		&& cd awk done grep local x=1 then test "$1"
+grep ${HOME} "$1" export "$1" ${HOME} local "$@" x=1 grep --verbose ${HOME} ${HOME}
+${HOME} printf export ${HOME} --verbose -eu local /usr/bin 'quoted text' -eu sed
+'quoted text' printf sed grep
+		sed "$1" echo test awk export awk 2>/dev/null
+		${HOME} --verbose test "$@" | 'quoted text' readonly awk "$@" -eu /usr/bin
+sed /usr/bin local awk x=1 ${HOME} --verbose printf ${HOME} printf sed &&
+printf $(pwd) sed test export local && $(pwd) -eu sed $(pwd)
+	readonly | readonly $(pwd) export
+		2>/dev/null test awk /usr/bin done 2>/dev/null sed echo && "$@"
+		'quoted text' x=1 test ${HOME} &&
+	printf readonly grep /usr/bin cd readonly test printf printf local then x=1
+then grep "$@" cd sed then 2>/dev/null done local /usr/bin
+| /usr/bin 2>/dev/null awk then
+/usr/bin ${HOME} && cd 'quoted text' ${HOME} done local
+	then -eu /usr/bin readonly x=1 'quoted text'
+		&& printf export local grep
+	| $(pwd) 2>/dev/null done local done
+		&& ${HOME} --verbose echo | "$1" then export /usr/bin
+		/usr/bin /usr/bin echo printf $(pwd) -eu grep x=1 2>/dev/null readonly
+		readonly && | /usr/bin | | --verbose grep
+		-eu sed done readonly $(pwd) grep local local "$1"
+		readonly printf readonly | grep test echo awk local then done done $(pwd)
+		-eu echo "$1" local echo --verbose sed ${HOME} echo export printf ${HOME}
+		'quoted text' && | && sed done && "$1" "$1" local && 'quoted text'
+'quoted text' --verbose grep printf local /usr/bin printf "$@" printf local x=1
+| cd cd cd && ${HOME} "$1" readonly "$1" ${HOME}
+		/usr/bin $(pwd) --verbose done 'quoted text' printf grep awk then then
+	--verbose done && && done
+	cd && $(pwd) 2>/dev/null test local x=1 --verbose cd sed "$@" "$1" "$@"
+	then 2>/dev/null x=1 grep sed local
+	$(pwd) grep then then -eu 2>/dev/null
+&& done $(pwd) -eu 'quoted text'
+readonly done printf $(pwd)
+${HOME} "$@" "$@" awk readonly ${HOME} awk x=1 done "$1" awk cd then test then
+		--verbose done printf -eu 'quoted text' /usr/bin
+	'quoted text' export grep sed
+| $(pwd) then 'quoted text' "$1" "$@" printf done $(pwd)
+	"$@" echo 2>/dev/null cd readonly /usr/bin
+		"$1" sed echo | export ${HOME} "$@" "$1"
+	--verbose echo grep "$1" cd && x=1 $(pwd) 2>/dev/null 2>/dev/null
+		| local | echo sed -eu "$1" 2>/dev/null 'quoted text' 'quoted text' awk
+		echo | 2>/dev/null echo sed then /usr/bin awk echo cd --verbose
+		/usr/bin sed done awk test
+	test then printf --verbose /usr/bin
+		sed echo "$1" /usr/bin ${HOME} "$@" 2>/dev/null done 'quoted text' |
+	'quoted text' $(pwd) -eu 'quoted text' 2>/dev/null export
+	printf printf cd echo /usr/bin
+	readonly ${HOME} readonly ${HOME} 2>/dev/null then x=1 cd -eu
+readonly printf ${HOME} x=1 local x=1 && done --verbose local
+	"$@" test echo "$@" -eu | 'quoted text' echo local --verbose 'quoted text'
+--verbose awk x=1 export export -eu done printf readonly test 'quoted text' cd
+	awk local done $(pwd) sed test && printf | --verbose /usr/bin
+	grep $(pwd) cd 'quoted text' grep 2>/dev/null "$@" && grep x=1 "$1" done
+	grep export cd $(pwd) x=1 readonly | x=1
+	$(pwd) 2>/dev/null echo then
+2>/dev/null && then grep then | cd |
+echo -eu $(pwd) "$1" 'quoted text' x=1 "$@" | /usr/bin x=1 --verbose --verbose
+		done 2>/dev/null local sed then "$1" "$1"
+echo cd 'quoted text' sed -eu 2>/dev/null -eu awk $(pwd)
+		"$@" export then /usr/bin | cd echo 2>/dev/null grep x=1 echo export "$1"
+export cd readonly "$1" $(pwd) local local $(pwd) readonly
+| echo cd --verbose ${HOME} ${HOME}
+		/usr/bin echo x=1 local $(pwd) 'quoted text' --verbose /usr/bin awk
+	echo done done x=1 echo cd readonly printf --verbose grep 'quoted text'
+		'quoted text' "$1" cd printf sed /usr/bin export export readonly sed done
+	${HOME} 'quoted text' | test awk "$@" 'quoted text' local
+echo awk 'quoted text' && cd x=1 2>/dev/null grep
+local -eu $(pwd) x=1 export cd /usr/bin sed | "$@" test /usr/bin
+		'quoted text' 'quoted text' then $(pwd) test local awk x=1
+printf then awk 2>/dev/null ${HOME} /usr/bin printf $(pwd) grep "$1" printf $(pwd)
+2>/dev/null awk printf | sed $(pwd) export | && then sed grep grep "$@" "$1"
+	$(pwd) | "$@" && -eu then 'quoted text'
+		2>/dev/null -eu test ${HOME} echo "$1" awk 2>/dev/null /usr/bin
+sed x=1 "$1" cd sed test $(pwd) x=1 test readonly sed
+		awk --verbose local -eu "$1" cd awk cd && -eu
+	local "$@" $(pwd) export x=1 export "$1" sed echo x=1
+2>/dev/null printf printf cd awk cd x=1 -eu x=1 --verbose "$@" local && $(pwd)
+		| 2>/dev/null export awk
+		"$1" test $(pwd) printf -eu then x=1
+		echo -eu cd "$@" printf 2>/dev/null "$1" export 'quoted text' export
+	/usr/bin "$1" 'quoted text' then grep "$1"
+	| done then readonly -eu x=1 $(pwd) printf sed awk "$@" awk && printf x=1 local
+	done 'quoted text' done
+		${HOME} 2>/dev/null $(pwd) cd cd then awk done
+echo "$1" $(pwd) printf then local local 'quoted text' echo sed "$@" test
+		'quoted text' readonly done grep "$@" echo -eu "$@"
+		export printf x=1 echo printf sed $(pwd) "$1" cd 2>/dev/null
+${HOME} then awk echo readonly then sed "$@" | test awk x=1 "$@" awk done $(pwd)
+-eu x=1 | x=1 test printf
+		$(pwd) && echo test echo done local 2>/dev/null local
+		readonly test sed local "$@" echo 2>/dev/null then export -eu readonly
+-eu -eu "$@" x=1 --verbose export --verbose grep x=1 "$1" local echo $(pwd)
+		cd "$@" --verbose $(pwd) printf cd x=1 awk --verbose done --verbose
+		2>/dev/null done x=1 "$@" $(pwd) test "$@" $(pwd) echo printf
+	echo /usr/bin then then
+		&& 2>/dev/null grep then && cd local 2>/dev/null -eu export | && /usr/bin
+		echo ${HOME} 'quoted text' grep sed then $(pwd) && done echo $(pwd) test sed
+then 'quoted text' -eu grep "$@" --verbose cd cd /usr/bin $(pwd) && && ${HOME}
+	echo test readonly echo echo -eu | x=1 --verbose grep
+	x=1 ${HOME} 2>/dev/null done --verbose
+	awk -eu 'quoted text' -eu echo && -eu -eu local
+		x=1 'quoted text' ${HOME} 2>/dev/null grep
+echo -eu echo "$@" && cd && "$1" readonly local | echo "$1" /usr/bin -eu export
+	${HOME} cd echo 2>/dev/null --verbose x=1 local printf x=1 /usr/bin local &&
+printf /usr/bin 'quoted text' test cd -eu grep test local sed
+"$1" 2>/dev/null then "$@" grep /usr/bin x=1 "$1"
+	test sed echo grep sed ${HOME} && x=1 sed "$1" test local readonly | |
+	done && "$1" export "$1" sed readonly | then cd "$1"
+	cd 'quoted text' /usr/bin
+	local printf --verbose readonly --verbose then "$@" | && sed --verbose x=1 -eu
+&& readonly x=1 "$1" readonly | test export test --verbose "$1" /usr/bin
+$(pwd) cd "$@" echo --verbose 'quoted text'
+		-eu done awk then && awk x=1 'quoted text' awk cd
+	cd ${HOME} --verbose "$@" --verbose x=1 2>/dev/null $(pwd) "$@" | /usr/bin
+	"$1" && cd /usr/bin x=1 cd awk export 2>/dev/null grep "$1"
+local then grep 2>/dev/null --verbose
+		echo done "$@" readonly local test grep then "$@" export then 'quoted text'
+	export printf cd x=1 sed readonly sed 2>/dev/null && awk local sed 'quoted text'
+		'quoted text' printf grep
+		--verbose --verbose then export printf then local "$1" then awk
+-eu --verbose && awk /usr/bin | test x=1 "$1"
+	'quoted text' done cd x=1 awk grep cd cd export &&
+		sed local awk 'quoted text' sed
+"$1" cd done "$@" cd awk
+	readonly echo 'quoted text' --verbose x=1 done "$@" test local "$@"
+then then readonly done sed sed local export "$@" 'quoted text'
+		test readonly | cd && | awk
+	test local "$@" awk printf export
+$(pwd) "$1" sed then awk sed ${HOME} 2>/dev/null
+awk 'quoted text' "$1"
+		'quoted text' readonly ${HOME} export readonly x=1 "$@" && "$1" x=1 /usr/bin
+		sed 2>/dev/null test echo awk cd "$1"
+		grep done && export 2>/dev/null "$1"
+		local grep $(pwd) && echo "$1" grep 2>/dev/null
+		grep printf -eu then awk $(pwd) grep $(pwd) "$@" --verbose 'quoted text' sed
+2>/dev/null ${HOME} 2>/dev/null echo printf --verbose
+readonly done -eu cd printf readonly sed "$1" 2>/dev/null "$@" echo grep echo
+		test $(pwd) sed done "$@"
+sed x=1 -eu --verbose 'quoted text' x=1 -eu
+x=1 "$@" ${HOME} && export grep "$@" --verbose cd 'quoted text' 'quoted text'
+		"$1" readonly 2>/dev/null test echo -eu 2>/dev/null "$1" "$@" sed grep x=1 printf
+		sed 2>/dev/null 'quoted text' 2>/dev/null x=1 x=1 done printf "$1"
+		--verbose ${HOME} -eu test "$1" $(pwd) 2>/dev/null -eu cd "$@" then
+	echo readonly local ${HOME} sed sed done && grep ${HOME} 'quoted text' test -eu
+		readonly local ${HOME} x=1 awk 'quoted text' 'quoted text'
+	grep x=1 then test 'quoted text' "$1" x=1
+	awk x=1 && done then 'quoted text' -eu "$1" | then done --verbose ${HOME} local
+export export $(pwd) /usr/bin
+"$@" "$@" awk "$@" done cd grep cd 2>/dev/null
+	"$1" 'quoted text' local done cd
+	sed /usr/bin done -eu awk /usr/bin && export sed 'quoted text' --verbose
+cd sed -eu sed x=1 x=1 "$1" | ${HOME} 2>/dev/null test cd && cd
+		grep | "$@" grep grep 'quoted text' printf
+	export test grep cd then
+$(pwd) -eu grep readonly sed grep $(pwd) then 'quoted text' $(pwd) readonly
+		sed done /usr/bin 'quoted text' | export echo test --verbose -eu "$@"
+		"$1" "$1" && local $(pwd) done done cd test done $(pwd)
+		| local local cd local echo
+		export x=1 "$@" x=1 && --verbose local sed &&
+&& readonly | x=1 export printf export then /usr/bin | && sed
+2>/dev/null then --verbose awk ${HOME} /usr/bin awk printf --verbose
+| $(pwd) | local && 'quoted text' local export -eu x=1 printf
+sed test sed test && && /usr/bin ${HOME} readonly
+	sed "$1" "$@" && local done /usr/bin -eu sed | && sed test cd readonly --verbose
+done then echo /usr/bin grep readonly 'quoted text'
+done 'quoted text' 'quoted text' then printf /usr/bin cd 2>/dev/null
+export && sed export ${HOME} x=1 $(pwd)
+		local awk done readonly "$@" ${HOME} then done 2>/dev/null
+cd local echo cd $(pwd) printf
+		-eu echo awk awk | cd cd
+		2>/dev/null "$1" local readonly local sed echo x=1
+export cd done "$1" x=1 local
+local readonly test "$@" grep "$@" sed 2>/dev/null
+--verbose 2>/dev/null
+readonly grep 'quoted text' export -eu x=1 ${HOME} --verbose awk "$@" readonly "$1"
+grep readonly readonly local
+		readonly cd grep && && grep echo then -eu -eu
+readonly readonly readonly
+		local echo /usr/bin grep "$1" then test 'quoted text'
+	readonly --verbose $(pwd) local
+'quoted text' test awk 'quoted text'
+test test /usr/bin $(pwd)
+		sed test done 'quoted text' "$1" && local "$1" echo
+	/usr/bin local x=1 then local
+	/usr/bin | "$@" && test --verbose cd readonly "$1" "$@" $(pwd) "$@"
+		awk "$@" "$1" readonly
+$(pwd) x=1 $(pwd) local -eu test awk x=1 $(pwd)
+	'quoted text' ${HOME} sed -eu local x=1 readonly sed done export
+${HOME} done sed "$1" ${HOME} awk
+		export awk readonly x=1 sed grep grep $(pwd) grep
+"$@" | sed -eu printf 2>/dev/null
+"$1" --verbose grep 2>/dev/null | 'quoted text' readonly
+	then test ${HOME} then readonly test
+		'quoted text' 'quoted text' grep 2>/dev/null local "$1" cd
+	then sed /usr/bin 'quoted text' "$1" cd local readonly "$@" | export then | export
+then export "$@" done then echo x=1 --verbose
+		2>/dev/null x=1 x=1 echo && -eu export
+		cd | cd --verbose echo printf local 2>/dev/null awk "$1" | local && -eu
+		local "$@" /usr/bin $(pwd) printf
+"$@" -eu then "$1" -eu $(pwd) awk sed /usr/bin
+		&& then then $(pwd) echo cd
+		local 2>/dev/null ${HOME} && ${HOME} awk cd -eu echo
+		test "$1" $(pwd) -eu 2>/dev/null done "$1" local printf -eu "$@" -eu $(pwd)
+grep local "$@" 2>/dev/null 2>/dev/null "$@" && sed readonly "$@" printf ${HOME}
+printf done $(pwd) 2>/dev/null
+		${HOME} then --verbose sed local then
+	cd ${HOME} cd 2>/dev/null /usr/bin "$@" local cd "$@" test | done
+		printf awk -eu export /usr/bin echo test done
+		"$@" awk -eu echo "$1" test echo
+	&& awk test 'quoted text' && printf ${HOME} --verbose ${HOME}
+		export --verbose x=1 grep printf "$@" --verbose
+	done export echo x=1 done | echo && local done awk "$1" 2>/dev/null
+	${HOME} 2>/dev/null readonly sed awk ${HOME} -eu local $(pwd) x=1 ${HOME} then
+	done sed cd done ${HOME} grep cd local
+	&& awk && -eu grep ${HOME} "$1" test awk printf cd x=1 x=1 then test local
+"$@" ${HOME} && test 'quoted text' test "$1" then test grep
+		export $(pwd) "$1" then cd local printf
+x=1 then ${HOME} ${HOME} awk export ${HOME} test echo readonly
+then /usr/bin local local awk "$1" then "$@" local "$@" ${HOME}
+		then sed "$@" local cd echo readonly | readonly --verbose printf grep --verbose
+		readonly /usr/bin -eu awk
+| printf done export printf done 2>/dev/null printf
+		readonly awk --verbose 2>/dev/null "$1" done grep
+	sed echo "$@" export x=1 printf local /usr/bin && --verbose export /usr/bin |
+	printf echo "$1" awk grep ${HOME} test awk printf local | readonly cd awk grep
+export readonly --verbose local
+&& export "$1" "$@" sed local echo "$1" | cd x=1 then printf "$@" 2>/dev/null
+	sed test awk /usr/bin "$@" $(pwd) grep | done readonly cd
+	readonly done grep |
+		x=1 then -eu local export --verbose --verbose awk x=1 export 2>/dev/null
+/usr/bin | "$@" 2>/dev/null 'quoted text' ${HOME}
+		readonly "$1" | "$1" $(pwd) | -eu /usr/bin echo then $(pwd) grep | /usr/bin
+export 2>/dev/null test "$@" export readonly -eu /usr/bin done done export
+grep echo done done -eu "$@" echo printf
+test cd grep "$1" 2>/dev/null grep 'quoted text' sed
+readonly echo echo test
+#include c214.sh
+		cd printf -eu | printf readonly cd ${HOME}
+		&& | export readonly $(pwd)
+		"$@" local && x=1 "$1" | sed "$@" sed 2>/dev/null readonly awk /usr/bin ${HOME}
+	grep 2>/dev/null | then "$1" $(pwd) --verbose done readonly export "$@"
+export cd sed && -eu 'quoted text' && | echo | | | $(pwd) test
+${HOME} grep --verbose "$1" "$1" /usr/bin && ${HOME} echo
+	'quoted text' -eu readonly 2>/dev/null then "$@"
+/usr/bin --verbose --verbose --verbose 2>/dev/null readonly
+	"$@" awk && $(pwd) /usr/bin printf then -eu && && /usr/bin /usr/bin | cd
+		x=1 then grep -eu export cd x=1 "$@" &&
+		done $(pwd) x=1 done && | grep -eu test done "$1" echo "$1" test
+		-eu export --verbose x=1 "$1"
+$(pwd) x=1 sed export export then awk 'quoted text'
+	${HOME} 'quoted text' 'quoted text' printf then then x=1 --verbose test
+	done printf local printf &&
+		echo "$@" | sed "$@" grep $(pwd) cd "$@" /usr/bin x=1 cd && export && x=1 export
+		${HOME} | printf done "$1" 'quoted text' grep
+		then grep readonly 'quoted text' readonly "$@" --verbose
+		printf test done | 'quoted text'
+readonly && ${HOME} && | then 2>/dev/null "$@" sed
+	-eu "$1" ${HOME} "$1" test test && x=1 ${HOME} awk
+		readonly "$1" test --verbose -eu echo /usr/bin ${HOME} export done
+		| $(pwd) awk done -eu -eu 'quoted text' export 'quoted text'
+	readonly -eu -eu ${HOME} --verbose
+readonly awk awk awk ${HOME} "$1" then x=1 $(pwd) echo test local
+	cd ${HOME} && test echo sed /usr/bin && 2>/dev/null --verbose
+		done readonly test awk $(pwd) done /usr/bin grep 'quoted text'
+	"$@" grep local 2>/dev/null sed readonly $(pwd) 2>/dev/null | && x=1 local
+		export "$1" 'quoted text' ${HOME} /usr/bin x=1 x=1 /usr/bin
+local then readonly && readonly then awk printf && grep ${HOME} 'quoted text'
+	then "$@" test done grep /usr/bin ${HOME} "$@" && grep && ${HOME}
+		local /usr/bin cd && cd && /usr/bin local local sed test
+		${HOME} $(pwd) 'quoted text' test readonly awk | awk "$@" "$1"
+		| /usr/bin && export 'quoted text' /usr/bin then /usr/bin sed echo echo $(pwd)
+	$(pwd) /usr/bin "$1" echo "$1" /usr/bin /usr/bin readonly test "$1" printf --verbose
+	$(pwd) 'quoted text' "$1" readonly $(pwd) readonly done -eu export
+echo -eu --verbose "$1" 'quoted text' "$1" | -eu done /usr/bin readonly
+		"$1" then 'quoted text'
+export 2>/dev/null 2>/dev/null echo x=1
+		export && -eu done /usr/bin | &&
+	"$@" /usr/bin grep ${HOME} $(pwd) local test -eu readonly
+	$(pwd) "$@" local printf then then export 'quoted text'
+	--verbose printf grep
+printf awk cd "$@" test 'quoted text'
+	echo grep 'quoted text' ${HOME} then echo "$1" printf 2>/dev/null export
+	grep && test export local x=1 "$1" cd -eu --verbose awk awk
+		local | test cd | "$@" "$@" readonly
+	-eu ${HOME} grep --verbose
+x=1 --verbose echo echo done "$@"
+cd 2>/dev/null ${HOME} readonly 2>/dev/null /usr/bin
+readonly echo grep export readonly
+	export test /usr/bin | ${HOME} | then grep 'quoted text' $(pwd)
+		sed $(pwd) && -eu x=1 done && ${HOME} export then sed
+&& $(pwd) awk then && | "$1" &&
+done -eu cd $(pwd) "$@" ${HOME} 2>/dev/null && && readonly && 'quoted text' echo
+test -eu x=1 && then export && sed x=1 /usr/bin cd | then awk
+${HOME} | readonly "$@" "$1" $(pwd) 2>/dev/null 'quoted text'
+grep 'quoted text' echo $(pwd) "$@" done done | readonly $(pwd)
+		-eu sed done sed -eu awk --verbose test printf local
+		awk 'quoted text' $(pwd) x=1 then grep cd
+| $(pwd) awk x=1 /usr/bin -eu then echo 'quoted text' then
+then readonly 'quoted text' | grep local grep cd printf then $(pwd) local --verbose
+		echo printf sed then "$1" done x=1 &&
+		"$1" -eu | x=1 'quoted text' test awk && readonly |
+	'quoted text' test | "$1" "$1" readonly echo export
+		sed -eu /usr/bin /usr/bin --verbose sed x=1 ${HOME} readonly awk awk
+cd && printf echo /usr/bin cd x=1 ${HOME}
+	then export 2>/dev/null cd readonly && done --verbose test ${HOME}
+echo && echo --verbose && --verbose awk test awk export -eu echo | awk && "$@" echo
+"$1" 2>/dev/null test 'quoted text' test "$1" 'quoted text'
+	readonly "$1" 'quoted text' local test 2>/dev/null
+	sed then echo done export echo echo "$1" test awk "$1" -eu "$1" | ${HOME}
+"$@" -eu 2>/dev/null ${HOME}
+		test && grep --verbose 'quoted text' --verbose "$1"
+		'quoted text' cd x=1 $(pwd)
+		printf awk && cd 2>/dev/null "$@" test local awk ${HOME} 'quoted text' then
+	/usr/bin $(pwd) 'quoted text' x=1 ${HOME}
+	export | ${HOME} 2>/dev/null x=1 x=1 echo "$1" ${HOME} 2>/dev/null "$1" "$1" x=1
+	"$@" local 'quoted text' readonly -eu --verbose ${HOME} readonly $(pwd) cd echo
+	cd "$1" "$1" | --verbose echo
+	cd done | "$1" x=1 awk echo && "$@" awk $(pwd) echo 'quoted text' && done cd
+printf -eu echo printf ${HOME} cd && "$@" "$@" "$1" sed 'quoted text' --verbose
+awk | local --verbose -eu local readonly && grep "$@" -eu 'quoted text'
+	| --verbose local "$@" 2>/dev/null --verbose
+'quoted text' /usr/bin
+		awk x=1 printf 'quoted text' cd
+		--verbose local "$1" sed then 2>/dev/null cd 2>/dev/null printf && then x=1 2>/dev/null
+awk readonly -eu "$1" /usr/bin done | sed /usr/bin test "$@"
+	"$@" ${HOME} then x=1 && readonly test
+printf export 2>/dev/null echo /usr/bin sed readonly export -eu cd
+	| --verbose "$1" ${HOME} echo test && test
+		awk grep $(pwd) "$@" ${HOME} grep &&
+	${HOME} echo echo 2>/dev/null local 2>/dev/null
+		/usr/bin done --verbose export printf test then 2>/dev/null | echo -eu
+	${HOME} then then "$@" readonly
+		local "$@" sed 'quoted text' $(pwd) printf sed test --verbose 'quoted text'
+'quoted text' awk "$@" -eu "$@" local local "$1" then
+		printf | ${HOME} export 'quoted text'
+		sed printf test -eu /usr/bin test --verbose awk grep --verbose export "$@"
+/usr/bin echo export readonly 2>/dev/null
+readonly "$1" cd ${HOME} done "$1" export
+	-eu -eu x=1 echo local readonly x=1 "$@" 'quoted text'
+	-eu --verbose cd 'quoted text' done /usr/bin printf
+	2>/dev/null x=1 2>/dev/null && -eu awk && "$1" "$1" readonly "$@" "$@"
+	"$1" cd readonly && "$1" readonly printf done /usr/bin
+		-eu $(pwd) test -eu export sed x=1 "$1" printf ${HOME} | sed
+		readonly /usr/bin sed $(pwd) /usr/bin 2>/dev/null 'quoted text'
+/usr/bin ${HOME} -eu awk "$1" --verbose printf printf
+	"$@" "$@" echo cd x=1 printf grep echo "$1"
+		x=1 "$1" -eu /usr/bin sed local echo 'quoted text' local export
+printf sed cd local cd && | --verbose export printf /usr/bin export awk --verbose
+	then echo ${HOME} ${HOME}
+		sed export readonly local export "$@"
+		cd $(pwd) 'quoted text' sed awk $(pwd)
+"$1" $(pwd) local sed export cd -eu cd 2>/dev/null && 'quoted text' ${HOME}
+'quoted text' x=1 grep printf x=1 awk $(pwd) then awk -eu 'quoted text'
+		${HOME} 2>/dev/null --verbose echo 2>/dev/null
+		cd printf test local printf
+		${HOME} local sed test -eu 'quoted text' printf
+then $(pwd) printf | "$1"
+		x=1 ${HOME} $(pwd) printf "$@" then x=1 echo printf
+	x=1 && /usr/bin sed printf /usr/bin export
+echo | readonly sed 2>/dev/null
+| | grep cd ${HOME} 2>/dev/null
+		'quoted text' awk -eu ${HOME} test test test grep done readonly
+		test x=1 then 2>/dev/null /usr/bin sed "$1" printf done
+	"$1" --verbose ${HOME} 'quoted text' ${HOME} 'quoted text' $(pwd) /usr/bin
+"$@" done && cd /usr/bin "$@" sed local cd && x=1 | 2>/dev/null "$1" cd -eu
+		"$@" awk | awk && /usr/bin readonly readonly ${HOME}
+		"$@" ${HOME} && grep done | export -eu
+x=1 printf | echo cd awk printf "$1" "$@" cd && $(pwd) awk "$@"
+grep /usr/bin "$1" /usr/bin done cd then done ${HOME} then "$@" && && printf /usr/bin
+		test --verbose "$@" x=1 sed then --verbose printf export sed
+	printf x=1 done cd x=1 cd printf | && readonly "$1" then then 2>/dev/null
+	done 2>/dev/null --verbose
+	'quoted text' export -eu export test ${HOME} --verbose "$1"
+		x=1 $(pwd) printf --verbose echo done /usr/bin sed $(pwd) then export "$@" 2>/dev/null
+export "$1" && export readonly "$@"
+		readonly sed 'quoted text' "$1" local | sed --verbose cd "$1" awk awk 2>/dev/null
+		then done awk readonly /usr/bin 2>/dev/null done then --verbose
+grep --verbose cd done --verbose echo "$1"
+readonly echo | -eu "$1" 2>/dev/null -eu printf "$1" -eu ${HOME} then -eu && readonly
+2>/dev/null 'quoted text'
+echo $(pwd) printf done x=1 "$@" x=1 done then "$@" x=1 && /usr/bin
+		printf $(pwd) ${HOME} test grep
+		done local && --verbose x=1 grep cd -eu x=1 | echo echo ${HOME}
+	$(pwd) export "$@" awk "$1" 'quoted text' && -eu
+local sed sed readonly && then | export 2>/dev/null local x=1
+	"$1" cd grep /usr/bin printf
+	2>/dev/null "$1" local grep x=1 $(pwd) awk grep 'quoted text' -eu x=1 -eu
+	-eu sed cd $(pwd) echo cd && awk cd
+	/usr/bin export done echo grep readonly readonly x=1 sed -eu awk sed grep x=1
+		printf sed then awk grep echo "$@" x=1 x=1 /usr/bin
+	-eu grep echo 'quoted text' "$@" sed 'quoted text' x=1 && "$@" x=1 x=1 test cd
+awk && 'quoted text' printf done 'quoted text'
+${HOME} x=1 x=1 2>/dev/null 2>/dev/null
+		then echo --verbose local then done --verbose "$@" local --verbose 'quoted text'
+&& cd --verbose then cd 'quoted text' echo test export | "$1" test | then
+&& 2>/dev/null printf then
+	| cd ${HOME} echo $(pwd) && $(pwd) x=1 test "$@" /usr/bin
+		readonly awk --verbose
+	sed | ${HOME} /usr/bin | x=1 echo "$1" /usr/bin test echo echo
+	cd test | --verbose && then sed readonly 'quoted text' done --verbose 'quoted text'
+	2>/dev/null && local 'quoted text'
+done done grep cd 2>/dev/null
+"$@" local ${HOME} readonly --verbose local
+		local readonly printf
+		done export printf cd /usr/bin && -eu sed "$@"
+	&& grep printf 2>/dev/null --verbose test then printf done readonly
+		readonly echo "$@" "$1" $(pwd) printf "$1" 2>/dev/null
+		then echo "$@" echo done local then 'quoted text' | grep
+		grep 2>/dev/null "$1" local
+		2>/dev/null 2>/dev/null export printf sed && -eu sed ${HOME} | 'quoted text'
+	export local "$@" && $(pwd) grep
+	readonly "$1" ${HOME} 'quoted text'
+export -eu sed test ${HOME} x=1 "$1" -eu $(pwd)
+	printf test then awk local export &&
+		grep awk test /usr/bin $(pwd) "$@" -eu
+		2>/dev/null $(pwd) $(pwd) local test | 'quoted text' -eu awk && local
+		&& printf cd 2>/dev/null done printf cd echo -eu local
+2>/dev/null | && done grep awk x=1 2>/dev/null && x=1 test awk | printf grep
+		sed grep | then readonly --verbose sed --verbose done x=1 done ${HOME}
+/usr/bin -eu test local "$1" echo | readonly | readonly
+"$1" local done then 'quoted text' x=1 x=1 --verbose "$@" echo test
+'quoted text' then cd $(pwd) "$@" echo "$@" 'quoted text' --verbose /usr/bin
+		$(pwd) test export readonly echo awk local done | export --verbose
+	grep x=1 $(pwd) -eu "$1" && --verbose
+export readonly cd "$1" "$@" ${HOME} readonly x=1 'quoted text'
+	echo test -eu 2>/dev/null && $(pwd) && "$1" readonly done $(pwd) echo export
+		| grep && printf $(pwd) cd echo ${HOME} echo cd "$1" echo cd && -eu
+		echo sed local -eu -eu && printf export --verbose test 2>/dev/null export -eu
+	'quoted text' $(pwd) sed printf x=1 sed --verbose grep --verbose 'quoted text'
+		"$@" test then sed printf 'quoted text' readonly --verbose
+sed test grep --verbose grep then "$1"
+		readonly grep then done done
+	-eu done awk export cd $(pwd) /usr/bin sed && readonly cd | done $(pwd) -eu
+printf x=1 test $(pwd) sed && grep printf printf
+		--verbose "$@" cd -eu local && echo x=1 sed local
+		grep test local grep export
+${HOME} cd grep local local --verbose 'quoted text' "$1" ${HOME} then local "$@"
+	2>/dev/null sed cd --verbose 'quoted text' x=1
+cd 'quoted text' | -eu $(pwd) -eu local $(pwd) test "$@" export "$@" 'quoted text'
+	"$1" done -eu grep local -eu export echo $(pwd) local $(pwd) sed x=1 grep 'quoted text'
+	printf --verbose then sed local echo
+	cd sed awk test grep 2>/dev/null -eu local grep
+		x=1 "$1" printf printf --verbose "$1" cd awk ${HOME} done local
+	"$@" test readonly echo test awk done 2>/dev/null | export 'quoted text'
+		--verbose test local $(pwd) 2>/dev/null
+--verbose then cd done "$@"
+	local /usr/bin export /usr/bin 'quoted text' /usr/bin
+	awk awk echo then echo test "$1" /usr/bin /usr/bin | | 2>/dev/null $(pwd) local
+		"$@" local 2>/dev/null sed --verbose -eu "$1" "$1" -eu printf awk readonly awk
+		-eu cd then /usr/bin "$1" "$1" x=1 awk --verbose cd sed 2>/dev/null
+&& 'quoted text' cd && -eu export cd && cd printf x=1
+	"$1" cd $(pwd) sed $(pwd) 'quoted text' echo then local cd |
+/usr/bin $(pwd) 'quoted text' export awk printf echo export &&
+		"$@" x=1 then export | 2>/dev/null /usr/bin
+		local printf done printf export /usr/bin cd $(pwd) test then readonly test
+		"$@" test | export echo export readonly "$1" $(pwd)
+x=1 /usr/bin done $(pwd) test ${HOME} | test echo -eu grep 2>/dev/null test --verbose
+"$1" test x=1 grep then echo "$@" -eu export test 'quoted text'
+	$(pwd) export "$@" | | test cd export 'quoted text' "$1" 2>/dev/null
+--verbose sed export 2>/dev/null grep /usr/bin $(pwd) $(pwd) | test
+--verbose --verbose x=1 grep done
+test awk then $(pwd) && ${HOME} | --verbose ${HOME} 2>/dev/null
+	readonly /usr/bin --verbose -eu awk sed --verbose
+	&& | ${HOME} "$1" export cd test grep then local
+	"$1" $(pwd) $(pwd) && ${HOME} readonly "$@"
+	readonly export done export && -eu done -eu $(pwd) ${HOME} cd
+local sed printf local /usr/bin
+		x=1 "$@" grep awk awk 2>/dev/null x=1
+		awk $(pwd) 2>/dev/null sed local $(pwd) 'quoted text' awk
+sed awk local --verbose echo grep grep awk echo awk --verbose $(pwd) ${HOME}
+grep echo $(pwd) local -eu grep export
+		| | test && printf awk done $(pwd) ${HOME} "$1" done export 'quoted text' ${HOME}
+done cd | --verbose grep --verbose 2>/dev/null -eu echo
+		| test grep x=1 printf
+		test grep ${HOME} 2>/dev/null
+	readonly test ${HOME} then cd --verbose
+		readonly && ${HOME} printf -eu export done local
+${HOME} cd -eu printf ${HOME} --verbose done 2>/dev/null --verbose
+		then | sed printf export && done | echo readonly
+done 2>/dev/null sed awk 2>/dev/null awk 2>/dev/null
+test /usr/bin local then 2>/dev/null "$@" 'quoted text' local test /usr/bin "$@"
+	--verbose test cd 'quoted text' "$1" cd printf ${HOME} printf && awk test
+		"$@" "$@" then 2>/dev/null && local
+		done export 'quoted text' $(pwd) echo --verbose
+'quoted text' | local ${HOME} then export test sed | grep
+	/usr/bin "$1" $(pwd) "$1" test
+	printf readonly 2>/dev/null done -eu "$@" $(pwd)
+	--verbose sed awk then && printf
+x=1 "$1" printf echo awk
+		&& "$1" $(pwd) 2>/dev/null echo $(pwd)
+	&& awk local "$@" -eu "$1" then "$@" test then
+	echo sed $(pwd) --verbose done 'quoted text' /usr/bin cd -eu then awk
+		readonly sed grep then sed test cd
+		-eu $(pwd) 'quoted text' | ${HOME} | x=1 done printf
+		&& -eu /usr/bin grep readonly "$1" done test
+printf "$1" done 'quoted text' --verbose then ${HOME} done x=1 grep
+echo export sed export ${HOME} local readonly ${HOME} -eu /usr/bin awk && -eu local
+test -eu | export test
+		sed /usr/bin /usr/bin $(pwd)
+	"$1" test "$1" "$1" && awk $(pwd) then "$@" -eu echo awk 2>/dev/null
+2>/dev/null && done -eu ${HOME} awk awk $(pwd) x=1 ${HOME} printf local 'quoted text'
+	--verbose echo 2>/dev/null 'quoted text' local 2>/dev/null done export
+	-eu x=1 printf ${HOME} local echo readonly "$1" "$@" $(pwd) --verbose
+done 2>/dev/null x=1 /usr/bin awk --verbose awk then --verbose
+printf done --verbose /usr/bin && grep grep
+	-eu test echo && export then
+x=1 && cd grep local done $(pwd) /usr/bin cd ${HOME} "$1" sed
+	| readonly 2>/dev/null $(pwd) printf readonly 'quoted text' local
+	2>/dev/null printf x=1 local printf --verbose printf printf printf grep "$1" $(pwd)
+--verbose $(pwd) printf local && sed test done --verbose -eu cd 2>/dev/null
+grep $(pwd) readonly -eu
+		test grep cd "$@" -eu $(pwd) readonly then export cd $(pwd) ${HOME} --verbose
+	2>/dev/null grep "$1" 2>/dev/null 'quoted text' &&
+		| printf 2>/dev/null test local ${HOME} -eu 2>/dev/null cd then 2>/dev/null
+	'quoted text' x=1 && /usr/bin cd "$1"
+readonly grep test test 'quoted text' | --verbose $(pwd) /usr/bin -eu grep
+	-eu 2>/dev/null 2>/dev/null echo sed 'quoted text' awk /usr/bin
+sed then $(pwd) export echo "$1" cd done /usr/bin
+		sed export $(pwd) grep readonly && echo x=1 test done -eu "$1" done "$1" grep "$@"
+		export printf grep "$@" -eu printf | ${HOME} 2>/dev/null
+printf "$1" sed printf ${HOME} export done
+		echo 'quoted text' sed cd readonly ${HOME} 'quoted text' echo ${HOME}
+		'quoted text' then /usr/bin 'quoted text' cd
+	sed grep done 'quoted text'
+		${HOME} x=1 awk "$1" awk "$1" test /usr/bin 'quoted text'
+export | | && --verbose local --verbose echo
+2>/dev/null && readonly && then "$@" export export "$1" sed
+local readonly then awk /usr/bin grep 2>/dev/null && cd $(pwd) export
+		x=1 /usr/bin 2>/dev/null done test
+	x=1 --verbose grep x=1 "$@" --verbose ${HOME} grep ${HOME} 'quoted text'
+	--verbose x=1 readonly test | ${HOME} awk ${HOME} --verbose then printf sed local
+		${HOME} /usr/bin awk -eu local ${HOME} 2>/dev/null
+	done $(pwd) ${HOME} 2>/dev/null sed export ${HOME} x=1
+${HOME} $(pwd) "$1" "$@" ${HOME} 2>/dev/null && /usr/bin export "$1"
+	&& grep --verbose then x=1 -eu 'quoted text' cd && printf "$1" --verbose $(pwd)
+	cd x=1 | test awk --verbose 2>/dev/null cd 2>/dev/null
+		readonly echo grep ${HOME} grep ${HOME} printf echo x=1 awk export awk "$1"
+		export readonly && export done | $(pwd) 2>/dev/null x=1 cd cd $(pwd) readonly
+	local | $(pwd) export done done -eu cd 'quoted text' echo sed done 2>/dev/null
+--verbose 2>/dev/null "$@"
+test "$1" test test "$@" local echo export --verbose -eu 2>/dev/null
+	&& 'quoted text' --verbose sed local -eu && grep readonly
+		'quoted text' --verbose printf /usr/bin
+		'quoted text' awk done export sed "$1" /usr/bin readonly
+		${HOME} ${HOME} done
+	"$@" sed echo | awk test "$1" local readonly awk x=1 readonly
+"$@" readonly cd then $(pwd) ${HOME} test
+	readonly "$@" printf $(pwd) x=1 -eu sed && test /usr/bin
+		cd | export test echo awk cd /usr/bin then
+$(pwd) $(pwd) grep test 2>/dev/null 'quoted text' -eu 'quoted text' done cd | /usr/bin
+		test cd "$@" test x=1 grep /usr/bin then then echo x=1 sed printf && /usr/bin readonly
+	2>/dev/null "$1" ${HOME} sed -eu local --verbose done 'quoted text' 'quoted text'
+		-eu sed cd echo awk readonly
+	--verbose "$1" $(pwd)
+local "$@" /usr/bin done --verbose printf /usr/bin /usr/bin
+	echo test sed echo 'quoted text'
+		| x=1 --verbose "$1" printf && | test | "$@"
+		'quoted text' 2>/dev/null
+		x=1 cd /usr/bin 2>/dev/null printf "$1" "$@" awk "$1" printf &&
+readonly --verbose local awk local
+printf -eu test then --verbose "$@" export local ${HOME}
+		printf 2>/dev/null --verbose test awk
+"$@" echo done echo test awk ${HOME} echo cd |
+2>/dev/null echo "$1"
+		local awk done 'quoted text' printf
+export && readonly ${HOME} then printf awk
+		awk 2>/dev/null "$1" --verbose test readonly -eu echo /usr/bin
+-eu sed done && --verbose local
+		sed then awk printf cd "$1" printf /usr/bin 'quoted text' done --verbose
+readonly /usr/bin grep --verbose readonly
+	grep local echo /usr/bin sed ${HOME} | | && export /usr/bin test grep
+	readonly $(pwd) done 'quoted text'
+readonly $(pwd) readonly readonly | cd /usr/bin
+		then "$1" cd $(pwd) test --verbose grep "$@" /usr/bin done grep /usr/bin | "$1"
+$(pwd) "$@" local -eu export 'quoted text'
+		"$1" printf $(pwd) 2>/dev/null
+	| -eu export echo --verbose echo
+	export "$1" && local "$@" 'quoted text' echo --verbose --verbose 2>/dev/null
+		--verbose grep 'quoted text' -eu done "$1" 'quoted text' sed local
+		"$1" && --verbose -eu /usr/bin -eu && cd | | cd sed && printf export 2>/dev/null
+&& grep "$@" | "$@" -eu awk | ${HOME} printf x=1 done grep awk 'quoted text'
+	--verbose then && | printf printf then x=1 echo |
+| export export --verbose cd echo then
+2>/dev/null x=1 sed export x=1 "$1" ${HOME} export
+		local | cd "$@" ${HOME} | sed && x=1 grep "$@" $(pwd) --verbose $(pwd) test grep
+test cd && 'quoted text'
+	'quoted text' grep 2>/dev/null
+		&& ${HOME} 2>/dev/null /usr/bin
+		'quoted text' /usr/bin done "$1" test cd | readonly done cd readonly
+	grep && cd sed /usr/bin $(pwd) -eu done
+		"$1" && /usr/bin cd -eu cd test x=1 "$@" x=1 then readonly echo --verbose
+		sed ${HOME} cd ${HOME} echo export local 2>/dev/null
+	done export $(pwd) 2>/dev/null
+		&& ${HOME} 'quoted text'
+sed awk test -eu -eu sed export | cd $(pwd) ${HOME} "$1" done ${HOME} test test
+		sed export export ${HOME} export then then local ${HOME} --verbose /usr/bin
+	sed $(pwd) ${HOME} "$@" "$1" 'quoted text' ${HOME} local
+		local awk export -eu grep grep --verbose export
+		test readonly -eu then echo --verbose 2>/dev/null done done then 'quoted text'
+		2>/dev/null done local cd "$1" sed export readonly then awk x=1 readonly $(pwd)
+	printf readonly ${HOME} 2>/dev/null ${HOME} | readonly ${HOME} && 'quoted text'
+then --verbose cd "$@" cd grep readonly
+test "$1" echo 'quoted text' 'quoted text' sed
+&& local | -eu $(pwd) --verbose --verbose "$1" | printf 'quoted text'
+		grep "$1" "$1" 'quoted text' awk $(pwd) cd 'quoted text' readonly
+-eu x=1 x=1 awk printf then done then
+	| export printf then awk --verbose 'quoted text'
+	--verbose echo "$@" /usr/bin 'quoted text'
+		--verbose ${HOME} -eu x=1 "$1"
+	awk && 2>/dev/null export "$1" done grep "$1" printf x=1
+		--verbose "$@" grep "$@"
+local grep 'quoted text' readonly 'quoted text' cd awk 2>/dev/null
+		/usr/bin awk then ${HOME} 2>/dev/null test
+	readonly /usr/bin --verbose 'quoted text' | printf
+		printf ${HOME} --verbose export | ${HOME} | export export && /usr/bin --verbose
+	${HOME} export $(pwd) &&
+-eu --verbose then 'quoted text' cd "$1" sed --verbose 2>/dev/null 'quoted text'
+	cd 2>/dev/null export sed x=1 test
+		x=1 awk printf -eu export sed
+		${HOME} export $(pwd) 'quoted text'
+awk "$1" test && x=1 --verbose
+	cd local readonly sed ${HOME}
+	local readonly then && local grep readonly echo --verbose export
+		done readonly 2>/dev/null 2>/dev/null
+-eu -eu sed && echo "$1" cd sed sed test && readonly /usr/bin
+		awk export ${HOME} printf -eu x=1 "$1" awk done
+echo readonly | test "$@"
+	2>/dev/null sed local /usr/bin done -eu
+	echo 2>/dev/null 'quoted text' "$1" "$1" echo && export 'quoted text' --verbose
+then done export sed | 'quoted text' grep readonly awk
+		--verbose 2>/dev/null then readonly
+		printf printf cd sed echo export then x=1 readonly | local export printf
+	"$1" && && "$@" | echo grep cd /usr/bin printf awk export
+echo cd grep /usr/bin grep x=1 2>/dev/null 2>/dev/null
+awk echo grep "$1" local ${HOME} "$1"
+		echo export readonly awk --verbose
+'quoted text' x=1 -eu echo export printf -eu cd awk /usr/bin $(pwd) done
+local x=1 'quoted text' echo && cd --verbose "$@" awk cd | done done
+	"$1" "$@" /usr/bin /usr/bin
+		x=1 --verbose /usr/bin readonly then local 2>/dev/null
+	/usr/bin "$@" /usr/bin echo $(pwd) -eu /usr/bin grep && printf 2>/dev/null
+${HOME} test then cd readonly printf echo export | sed x=1 export -eu grep
+test local ${HOME} export local cd 'quoted text' "$1" echo
+${HOME} 2>/dev/null | then grep 'quoted text' ${HOME} "$@" 2>/dev/null
+printf cd printf echo 'quoted text' readonly $(pwd) 'quoted text'
+		awk awk 'quoted text' sed /usr/bin -eu && sed ${HOME}
+		grep ${HOME} export local -eu "$1" printf
+		$(pwd) done /usr/bin "$@" --verbose then $(pwd) echo sed |
+		readonly /usr/bin | ${HOME} "$@" --verbose cd
+		cd --verbose awk then done && "$@" echo grep -eu x=1 sed
+		&& 2>/dev/null echo test sed awk "$@" then local "$1" | grep | 2>/dev/null
+2>/dev/null --verbose /usr/bin done -eu done
+	then x=1 | x=1 "$@" done awk 'quoted text'
+		$(pwd) export $(pwd) --verbose
+		-eu export /usr/bin /usr/bin local cd grep "$1" ${HOME} sed grep 2>/dev/null
+grep | done test 'quoted text'
+		$(pwd) export local awk echo "$@" -eu 'quoted text' 2>/dev/null export
+-eu done $(pwd) --verbose done export 'quoted text' awk test
+	/usr/bin x=1 "$1" done "$1" 2>/dev/null "$1" $(pwd)
+	then grep $(pwd) x=1 sed sed sed && && test readonly sed
+--verbose 'quoted text' awk readonly ${HOME} ${HOME} grep --verbose ${HOME}
+		--verbose then echo grep cd && printf
+		readonly sed printf && && then 'quoted text' printf cd |
+		| readonly echo printf cd "$1"
+		awk then 'quoted text' done then done readonly cd
+	then && then --verbose && 2>/dev/null 2>/dev/null | && local x=1 sed /usr/bin
+	done -eu "$@" $(pwd)
+		sed 'quoted text' $(pwd)
+sed -eu printf --verbose done 'quoted text' ${HOME}
+export readonly 2>/dev/null $(pwd) done done awk grep 2>/dev/null export /usr/bin
+echo printf 2>/dev/null sed ${HOME} -eu done "$@" cd 'quoted text'
+export then awk x=1 x=1 -eu -eu --verbose cd awk cd grep export "$1" 2>/dev/null
+		test readonly test echo local ${HOME} echo then $(pwd) 'quoted text'
+		then "$1" | sed /usr/bin cd grep export
+local 'quoted text' done x=1 2>/dev/null sed done grep echo x=1 export test
+		x=1 'quoted text' export
+	printf readonly then grep export 'quoted text' 2>/dev/null
+"$1" grep export /usr/bin awk done done
+		x=1 /usr/bin readonly $(pwd) /usr/bin 'quoted text' "$1" 2>/dev/null
+		--verbose "$1" ${HOME} cd "$1" ${HOME} done local x=1 | readonly readonly
+		| --verbose readonly -eu "$1" ${HOME} | awk ${HOME} --verbose
+		awk grep && "$@" readonly test export x=1 && x=1 local export -eu echo --verbose
+		local local | cd then && "$@" readonly then then then | "$@"
+export --verbose then 2>/dev/null /usr/bin grep -eu grep | cd $(pwd) && -eu ${HOME}
+2>/dev/null sed then && ${HOME} 'quoted text' printf printf done
+	done 2>/dev/null /usr/bin readonly
+| export 2>/dev/null "$@" done "$@" -eu ${HOME} ${HOME} --verbose 'quoted text'
+export grep && "$@" readonly cd "$1" -eu cd && test -eu cd
+export -eu export awk ${HOME} 'quoted text' | ${HOME} grep
+-eu grep && 'quoted text' $(pwd) test "$@" readonly -eu $(pwd) 'quoted text'
+	&& --verbose --verbose readonly ${HOME} | sed $(pwd) ${HOME}
+	sed readonly then && printf grep awk "$1" -eu -eu "$@" | done export grep
+&& --verbose "$@" then echo x=1 $(pwd) cd $(pwd) grep cd -eu done export
+readonly done done $(pwd)
+		$(pwd) && done cd 2>/dev/null grep | awk sed
+		-eu -eu "$@" && cd /usr/bin 2>/dev/null
+		sed ${HOME} && readonly awk "$@" printf "$1" awk x=1 ${HOME}
+		"$@" -eu done grep grep export && sed
+		echo local -eu x=1 'quoted text'
+	&& $(pwd) | awk test echo /usr/bin
+		$(pwd) $(pwd) 'quoted text' ${HOME}
+		--verbose export then $(pwd)
+&& $(pwd) echo --verbose
+	then x=1 ${HOME} sed awk x=1 readonly
+	| readonly sed -eu "$1" printf export 'quoted text' x=1
+printf test cd cd echo cd test echo export && test -eu done local
+awk -eu local sed awk "$1" local -eu export | printf
+		readonly ${HOME} ${HOME} echo done test 2>/dev/null
+		grep echo then /usr/bin grep
+	--verbose export done grep -eu ${HOME} done test local local
+		| $(pwd) cd ${HOME} /usr/bin | ${HOME} x=1 "$1" then $(pwd) && grep x=1
+		local readonly echo readonly -eu
+"$1" export "$1" readonly test cd then export "$@" grep "$1" --verbose
+	awk | grep cd --verbose local 'quoted text' -eu printf
+		sed printf "$1" x=1 $(pwd) sed then
+		cd export readonly awk -eu awk
+		local x=1 test 'quoted text' 2>/dev/null
+	readonly "$@" "$1" awk "$@" -eu | "$1" printf
+		$(pwd) && grep sed then x=1 cd -eu | printf -eu -eu "$1" test
+	$(pwd) && export && done ${HOME} --verbose --verbose
+/usr/bin "$@" x=1 printf cd echo export readonly readonly $(pwd) echo
+-eu test --verbose ${HOME} /usr/bin &&
+		2>/dev/null $(pwd) ${HOME} test echo 2>/dev/null /usr/bin
+	2>/dev/null echo sed export local done 2>/dev/null 2>/dev/null && printf
+	echo test readonly && "$@" "$@"
+		2>/dev/null grep ${HOME} 'quoted text'
+		"$1" cd && 'quoted text' printf echo export then test "$@" grep
+	cd done awk /usr/bin | awk -eu cd ${HOME}
+		/usr/bin printf awk ${HOME} done cd cd x=1 "$1" "$1" then then readonly
+	| 'quoted text' done readonly local | $(pwd) | local export then x=1 -eu 'quoted text'
+		-eu grep "$@" /usr/bin
+echo ${HOME} x=1 sed 2>/dev/null | awk "$1" "$@" then printf awk "$@" grep
+		test 'quoted text' 2>/dev/null
+	awk x=1 awk "$1" $(pwd) then
+		done local then test local export x=1 test 2>/dev/null
+| sed | printf cd 2>/dev/null
+-eu printf "$@" 2>/dev/null then -eu cd "$1" export ${HOME} then
+"$1" printf x=1 "$@" "$@" --verbose && 'quoted text' grep 'quoted text' done
+	echo 'quoted text' awk then
+	$(pwd) 2>/dev/null awk cd 2>/dev/null export test local test ${HOME} 'quoted text'
+	2>/dev/null printf cd then local
+		"$1" test echo awk test awk "$1" echo echo then
+	printf $(pwd) grep export $(pwd) then 2>/dev/null export
+	/usr/bin export "$@" readonly test
+		done 2>/dev/null local cd "$@" "$@"
+		cd "$1" "$1" grep 'quoted text' sed sed | test readonly 2>/dev/null
+	2>/dev/null test grep "$@" sed cd test export
+		-eu export --verbose "$@" readonly grep readonly
+	then "$1" awk echo /usr/bin readonly
+local done ${HOME} -eu awk sed /usr/bin test x=1 printf
+	${HOME} cd ${HOME} echo done 2>/dev/null
+	export && && | local $(pwd) printf echo | $(pwd) then then export
+| then 2>/dev/null "$@" grep "$1" sed cd "$1"
+		--verbose local then sed 'quoted text' 2>/dev/null --verbose
+		test then test ${HOME} -eu done --verbose "$@"
+$(pwd) 'quoted text' local $(pwd) $(pwd) "$@" echo
+2>/dev/null -eu $(pwd) echo ${HOME} 2>/dev/null cd $(pwd) --verbose
+	local local test echo /usr/bin
+readonly echo echo "$@" "$1" test -eu -eu x=1 --verbose --verbose sed grep awk
+	then local 2>/dev/null /usr/bin export
+	cd "$@" "$@" /usr/bin test local test --verbose | then printf && printf export
+| /usr/bin $(pwd) "$1" echo x=1 grep test
+	sed echo /usr/bin --verbose echo && 2>/dev/null
+		"$1" cd -eu local -eu grep test "$1" && local then /usr/bin $(pwd)
+${HOME} test readonly echo grep ${HOME} sed done test "$@"
+		grep | export x=1 test ${HOME} --verbose
+-eu done "$1" -eu printf cd cd
+	cd "$@" $(pwd) export cd | && $(pwd) | /usr/bin "$1" | && cd
+	/usr/bin | sed "$1" x=1 cd done ${HOME}
+	readonly echo printf sed
+		&& grep export local readonly local "$1" then $(pwd) "$1"
+		"$1" echo && grep done 'quoted text' test printf echo then 2>/dev/null
+	| -eu echo cd test echo "$1" then readonly local grep test grep local &&
+		local $(pwd) grep readonly
+	"$1" "$1" done export local ${HOME}
+-eu cd 2>/dev/null 'quoted text'
+	sed test echo readonly $(pwd) sed grep
+local then printf --verbose
+		| printf done awk -eu awk awk cd done sed 'quoted text' "$@" -eu | $(pwd)
+echo grep 2>/dev/null ${HOME}
+echo "$1" then && done sed "$@" awk
+		echo --verbose cd x=1 && readonly "$1" 'quoted text'
+sed sed "$1" "$@" x=1 "$1" | ${HOME} "$@" done | $(pwd)
+		2>/dev/null local /usr/bin && export "$1" sed "$@" test grep awk ${HOME} local awk
+		readonly local test -eu
+	readonly x=1 readonly -eu cd x=1 --verbose
+	x=1 readonly x=1 x=1 printf readonly cd printf local ${HOME}
+"$@" x=1 "$@" export readonly 2>/dev/null export -eu x=1
+		--verbose "$@" then /usr/bin | "$@" -eu awk echo sed
+		| /usr/bin echo done "$@" printf "$@" | awk
+	export --verbose ${HOME} ${HOME} local sed 2>/dev/null
+	grep printf export && 2>/dev/null done printf
+| printf awk ${HOME} done local ${HOME} grep done awk --verbose | test
+-eu "$1" 'quoted text' local echo 'quoted text' "$1" printf echo echo
+local --verbose export test --verbose -eu cd x=1 cd "$@" "$1" /usr/bin then grep
+		sed readonly ${HOME} /usr/bin ${HOME} x=1 &&
+${HOME} -eu $(pwd) "$1" cd done x=1 --verbose 2>/dev/null sed "$@" test done done
+		test 'quoted text' grep x=1 ${HOME} then done then 2>/dev/null | 'quoted text'
+	echo 2>/dev/null readonly echo $(pwd) test printf then | then
+	2>/dev/null 'quoted text' readonly
+	printf grep printf readonly /usr/bin "$@" readonly echo $(pwd) $(pwd) | then
+&& 2>/dev/null local 'quoted text'
+		| export && printf awk 'quoted text'
+	| done "$1" ${HOME} "$1" cd --verbose grep && ${HOME}
+/usr/bin then printf
+	$(pwd) echo then grep x=1 ${HOME} $(pwd) 'quoted text'
+	grep "$1" 'quoted text' printf "$1"
+	/usr/bin grep 2>/dev/null test readonly "$1" readonly then "$@" awk export ${HOME}
+	test $(pwd) sed echo local then local
+then --verbose && "$@" /usr/bin
+		| "$1" "$@" "$@" local cd awk then done /usr/bin --verbose
+'quoted text' grep "$1" done "$@" awk && readonly
+	${HOME} 2>/dev/null $(pwd) 'quoted text'
+		awk x=1 sed readonly export "$1" done echo done && echo 2>/dev/null --verbose
+		&& test cd done sed done /usr/bin -eu | printf 2>/dev/null && printf grep awk sed
+	-eu x=1 /usr/bin echo | --verbose printf | awk test ${HOME} done
+		${HOME} export echo -eu &&
+awk ${HOME} "$@" -eu export 2>/dev/null then done awk then
+		echo export "$@" done cd ${HOME} -eu grep &&
+/usr/bin "$@" ${HOME} /usr/bin | readonly cd readonly && -eu local /usr/bin
+export readonly cd --verbose ${HOME} 'quoted text'
+&& /usr/bin 2>/dev/null ${HOME} x=1 cd --verbose 2>/dev/null
+		sed local | printf awk $(pwd) && && local | $(pwd) echo ${HOME} 'quoted text' "$1"
+	'quoted text' -eu -eu -eu x=1 |
+	cd "$1" 'quoted text' sed export
+	x=1 printf $(pwd) ${HOME} printf | "$@" -eu done done cd
+	export /usr/bin grep && && local
+"$@" printf ${HOME} done export | "$1" sed done export
+	export test local local awk awk 2>/dev/null 'quoted text'
+"$1" /usr/bin -eu 2>/dev/null sed echo export local "$1" && local "$1"
+printf awk printf awk 2>/dev/null 'quoted text' echo export
+		'quoted text' | export printf | echo
+		$(pwd) x=1 "$@" "$1" 2>/dev/null
+	cd x=1 export ${HOME} done ${HOME} export --verbose 'quoted text' "$@"
+	sed awk ${HOME} && echo x=1 done ${HOME}
+		-eu grep /usr/bin /usr/bin 2>/dev/null --verbose "$1" 'quoted text'
+	/usr/bin ${HOME} sed echo $(pwd)
+		&& sed 2>/dev/null test sed test x=1 cd printf --verbose 'quoted text'
+	/usr/bin 'quoted text'
+	| export export /usr/bin done test then x=1 cd 2>/dev/null ${HOME} echo
+		readonly ${HOME} --verbose --verbose echo test cd then $(pwd) readonly x=1 "$1"
+&& -eu export $(pwd) then ${HOME}
+	"$@" "$1" 2>/dev/null then --verbose
+		| test printf "$1" cd "$1" 2>/dev/null "$@" sed "$@" && grep done &&
+"$1" --verbose 2>/dev/null -eu then x=1 -eu
+		done printf export 'quoted text' printf
+local test grep x=1 awk | "$1" &&
+cd -eu $(pwd) cd awk awk sed awk && cd then "$1" |
+	sed "$@" test 2>/dev/null local printf
+		then then "$@" 'quoted text' | && "$1"
+sed ${HOME} -eu 'quoted text'
+		"$1" local echo ${HOME} 'quoted text' echo ${HOME} then $(pwd) sed
+export sed | then local local
+"$@" echo | "$@" sed awk cd cd "$1" 'quoted text'
+		printf "$@" /usr/bin -eu 2>/dev/null -eu /usr/bin 2>/dev/null /usr/bin local done
+--verbose "$@" | cd done local printf then ${HOME} && 'quoted text' printf
+	done "$@" $(pwd) -eu cd awk 'quoted text' --verbose "$1" done
+		readonly x=1 local test ${HOME} export
+	done printf "$@" | test readonly local 2>/dev/null "$@" --verbose 'quoted text'
+	x=1 then sed | 'quoted text' awk $(pwd) then export awk echo "$1"
+then readonly x=1 $(pwd) 2>/dev/null -eu test "$@" grep test printf "$1" then done
+	done x=1 -eu -eu ${HOME} then awk cd 2>/dev/null grep --verbose
+	x=1 'quoted text' then --verbose "$@" $(pwd)
+	echo sed awk awk "$@" cd cd done $(pwd) then && "$@" then /usr/bin
+		x=1 && test x=1 printf cd | /usr/bin /usr/bin printf "$1" export test $(pwd)
+		export --verbose cd ${HOME} x=1
+	cd cd then cd done /usr/bin "$@" 'quoted text'
+		/usr/bin local export awk 2>/dev/null sed export
+	awk local | x=1 --verbose printf sed "$1" x=1 echo sed cd local done
+	"$1" local readonly printf
+		--verbose -eu /usr/bin test -eu /usr/bin "$1" /usr/bin "$1" "$1" export
+then awk | 'quoted text' test ${HOME} test readonly x=1
+		&& done awk 2>/dev/null | /usr/bin --verbose $(pwd) "$1" test ${HOME}
+/usr/bin --verbose "$@" 2>/dev/null then ${HOME} "$@" grep "$1" local
+--verbose readonly sed sed && -eu
+		local "$1" sed 2>/dev/null cd sed grep 'quoted text' "$@" local readonly
+		x=1 sed ${HOME} 2>/dev/null $(pwd) grep 2>/dev/null 'quoted text'
+		/usr/bin $(pwd) -eu printf --verbose 'quoted text' cd grep local local
+		cd local $(pwd) export "$1"
+cd x=1 local cd export "$@" 'quoted text' export
+		local local sed export grep local local cd printf
+x=1 then grep test "$1" readonly then "$1" sed sed sed done
+"$@" ${HOME} /usr/bin -eu 2>/dev/null && && sed /usr/bin -eu 2>/dev/null
+		/usr/bin awk test printf echo
+	$(pwd) grep awk x=1 --verbose awk grep "$@"
+	2>/dev/null ${HOME} "$@" | "$@" -eu printf
+	"$@" 2>/dev/null 'quoted text' local x=1 'quoted text' && printf awk /usr/bin
+		x=1 echo test "$@" | 'quoted text' "$1" local
+${HOME} "$1" sed done then echo then x=1 && 2>/dev/null awk --verbose x=1 "$@"
+/usr/bin | sed grep "$1" 'quoted text' cd local
+local -eu $(pwd) echo ${HOME} echo x=1 test
+	${HOME} && printf awk echo grep local awk -eu $(pwd) echo readonly 'quoted text'
+		echo readonly then -eu sed --verbose printf
+		local x=1 echo ${HOME} "$@" x=1 local test
+		'quoted text' -eu "$@" readonly printf awk "$1" "$1" x=1 test x=1 local ${HOME}
+'quoted text' "$@" sed -eu readonly x=1 $(pwd)
+	x=1 "$@" "$1" local ${HOME} $(pwd) | x=1 /usr/bin done
+		printf export done x=1 echo -eu echo && awk cd grep /usr/bin "$@" awk echo
+		--verbose "$1" echo | 2>/dev/null 2>/dev/null "$@" local printf --verbose
+		cd -eu readonly grep printf 'quoted text'
+		2>/dev/null -eu echo grep ${HOME} | "$@" sed ${HOME} 2>/dev/null "$1"
+		grep export -eu x=1 /usr/bin cd $(pwd) done test test done cd x=1 $(pwd)
+$(pwd) grep sed then -eu sed && cd
+	grep x=1 cd export awk grep readonly "$@"
+${HOME} && /usr/bin 'quoted text' grep echo 2>/dev/null
+"$@" x=1 /usr/bin done x=1 sed
+	awk "$1" printf --verbose then -eu then test
+readonly -eu && sed "$@" sed sed /usr/bin awk cd echo export test test sed ${HOME}
+"$@" -eu x=1 echo readonly 'quoted text' "$@"
+"$@" 'quoted text' local printf ${HOME} --verbose readonly --verbose
+"$1" 'quoted text' ${HOME} $(pwd)
+then echo x=1 awk printf && /usr/bin
+	local && $(pwd) echo local /usr/bin | printf
+		$(pwd) test printf 'quoted text' printf done done "$1" --verbose echo
+		echo 'quoted text' --verbose ${HOME} grep cd grep | | readonly done local sed
+		printf done test printf /usr/bin &&
+	$(pwd) done 2>/dev/null | "$1" sed local awk
+		"$1" x=1 $(pwd) readonly cd x=1 cd && awk "$@" echo export --verbose echo
+"$1" && done 2>/dev/null cd x=1 export ${HOME}
+done /usr/bin 'quoted text' awk readonly readonly printf cd &&
+&& then sed 'quoted text' x=1 done && cd | $(pwd) "$@" grep export cd readonly
+	echo cd "$@" -eu 'quoted text' test && x=1 --verbose "$@"
+		--verbose 'quoted text' "$@" readonly
+echo test $(pwd) -eu 'quoted text'
+echo echo $(pwd) readonly /usr/bin
+test && /usr/bin local /usr/bin printf sed "$@" "$1" "$@"
+		done /usr/bin sed $(pwd)
+then 2>/dev/null /usr/bin -eu
+		echo 2>/dev/null $(pwd) grep -eu
+		-eu then $(pwd) done echo x=1 /usr/bin /usr/bin
+		$(pwd) readonly -eu export $(pwd) x=1 done local -eu awk
+	then sed test "$1" cd printf local /usr/bin then && /usr/bin then grep
+		export --verbose "$@" ${HOME} && "$@" 'quoted text' printf
+readonly --verbose x=1
+	-eu 2>/dev/null local test sed "$1" x=1 echo -eu cd readonly "$1"
+sed ${HOME} grep "$1" ${HOME} "$@"
+echo cd echo $(pwd) $(pwd) printf grep then readonly
+	cd test 2>/dev/null echo test --verbose
+		awk local /usr/bin cd echo
+		then $(pwd) test echo | local then grep sed
+	awk cd sed grep --verbose echo sed readonly grep "$1" printf
+	readonly awk cd awk echo awk --verbose x=1 sed "$@" grep | echo ${HOME} done export
+	printf cd x=1 sed 'quoted text' | then 2>/dev/null ${HOME} local -eu done
+		done echo "$@" export "$1" -eu test $(pwd) grep
+	"$1" "$@" $(pwd) awk x=1 echo | -eu 2>/dev/null then
+x=1 then done local | /usr/bin 'quoted text' ${HOME} "$1" echo
+		export test readonly x=1 --verbose && && readonly test local
+	local cd 2>/dev/null echo test readonly printf /usr/bin grep export
+-eu readonly grep readonly ${HOME} export grep printf then echo
+		export sed --verbose $(pwd) cd x=1 "$@"
+		sed 2>/dev/null local cd $(pwd) | then readonly "$@" export "$1" /usr/bin
+		&& local && && awk "$@" $(pwd)
+done /usr/bin $(pwd) printf x=1 /usr/bin grep | -eu && echo export sed
+readonly 'quoted text' readonly readonly then echo /usr/bin
+	"$@" $(pwd) local then test
+		-eu "$1" && sed 2>/dev/null readonly
+test "$1" && sed cd /usr/bin -eu grep "$1" sed printf
+		/usr/bin -eu -eu "$1" &&
+done "$@" test -eu "$@" echo "$1" echo awk then cd
+		cd -eu $(pwd) sed sed x=1 x=1
+		grep then $(pwd) /usr/bin readonly readonly
+	cd "$@" then $(pwd) printf local x=1 -eu then 2>/dev/null "$1" done "$@" --verbose
+sed readonly local cd export x=1
+		local echo "$@" test | done export grep /usr/bin sed ${HOME} export
+		test | $(pwd) readonly export --verbose -eu /usr/bin ${HOME}
+	"$1" done done cd $(pwd) echo printf cd /usr/bin grep local -eu ${HOME}
+	cd --verbose 'quoted text' -eu done cd echo
+		echo $(pwd) x=1 then then cd 'quoted text' "$@" && sed readonly
+	printf awk "$@" awk --verbose grep -eu x=1 then x=1 readonly
+local printf && done --verbose
+		local $(pwd) local "$@" printf /usr/bin test grep "$@"
+		done grep grep printf done "$@" /usr/bin readonly export
+test "$@" $(pwd) awk "$1" printf cd echo test 'quoted text'
+	--verbose 'quoted text' 'quoted text' && export sed awk "$1" 2>/dev/null local 'quoted text'
+x=1 then && printf echo cd 2>/dev/null /usr/bin export
+x=1 cd | test printf grep "$@" && -eu 'quoted text' 2>/dev/null 'quoted text'
+		-eu export 2>/dev/null readonly x=1 "$1" "$@" 'quoted text'
+-eu grep ${HOME} "$1" && --verbose 'quoted text'
+readonly $(pwd) $(pwd) done grep x=1 readonly "$1" printf ${HOME} printf done cd
+	&& 'quoted text' cd $(pwd) local printf
+| echo "$@" "$@" grep readonly | readonly echo /usr/bin
+"$@" echo then $(pwd) done $(pwd) sed readonly done export
+	-eu cd done $(pwd) cd test cd "$@" "$@" -eu 'quoted text' /usr/bin done local
+	2>/dev/null "$@" grep cd awk "$1" test grep grep | "$@" export
+		| | | printf -eu local sed ${HOME} printf ${HOME} then export test local cd sed
+2>/dev/null export | --verbose cd readonly export printf
+		"$1" 'quoted text' 'quoted text' "$@" echo -eu awk cd done
+readonly local readonly test printf
+	local export readonly echo awk
+echo test readonly x=1 && cd -eu --verbose 2>/dev/null ${HOME} "$@"
+		test x=1 awk awk readonly 'quoted text'
+then --verbose local sed x=1 'quoted text' -eu
+		| done cd --verbose awk
+		export --verbose then done --verbose done | | then && "$@" printf /usr/bin
+	${HOME} $(pwd) --verbose
+		awk echo cd /usr/bin echo local x=1 done local done
+		${HOME} 2>/dev/null 'quoted text' ${HOME} test local awk -eu local x=1
+		-eu "$1" "$1" "$@" cd $(pwd)
+		&& ${HOME} done local $(pwd) 'quoted text' printf --verbose done
+		--verbose local /usr/bin cd 2>/dev/null | local "$@" "$1" sed
+		$(pwd) 2>/dev/null cd awk
+&& local grep sed test then "$1" then awk "$@" awk --verbose awk | --verbose
+sed --verbose readonly 'quoted text'
+	awk && "$1" /usr/bin 2>/dev/null done awk sed ${HOME} then "$@" 2>/dev/null
+"$@" awk /usr/bin | test echo -eu && "$@"
+		$(pwd) 'quoted text' $(pwd) done /usr/bin readonly then && && done local test
+		echo local "$1" done ${HOME} local sed --verbose
+	2>/dev/null --verbose "$@" | 2>/dev/null echo /usr/bin echo 2>/dev/null
+		printf 'quoted text' "$1" grep "$1" "$1" readonly --verbose x=1
+test "$1" 'quoted text' local
+	| test $(pwd) done 'quoted text' x=1 ${HOME} ${HOME}
+		'quoted text' && grep | 2>/dev/null 2>/dev/null $(pwd)
+	awk then --verbose local | readonly grep
+${HOME} awk /usr/bin export --verbose cd test
+	"$1" local | 'quoted text'
+		$(pwd) grep $(pwd) test grep | --verbose
+then cd sed $(pwd) $(pwd) awk done
+	&& ${HOME} awk done echo local test --verbose awk echo 2>/dev/null
+&& /usr/bin readonly readonly grep -eu 'quoted text'
+done awk --verbose $(pwd) done echo done readonly
+awk x=1 grep cd printf | then "$1" then x=1 local printf
+	grep local ${HOME} 'quoted text' | /usr/bin 2>/dev/null test local
+then -eu "$1" -eu $(pwd) 'quoted text' 'quoted text'
+$(pwd) "$@" /usr/bin 'quoted text' "$1" grep readonly x=1 echo echo printf
+	$(pwd) --verbose then grep $(pwd) awk 2>/dev/null x=1 'quoted text'
+	printf export then "$@" grep grep
+cd 2>/dev/null "$1" && "$@" echo "$1" "$@" | test -eu grep then sed /usr/bin
+	sed -eu sed test readonly done then done 'quoted text'
+	$(pwd) printf cd 2>/dev/null --verbose && && grep
+		test x=1 /usr/bin awk "$1" printf --verbose | export | then
+	cd /usr/bin done readonly echo sed $(pwd) sed
+	test printf cd ${HOME} then echo cd ${HOME}
+x=1 | "$1" | x=1 x=1 'quoted text' $(pwd) done | readonly export grep done
+awk done "$@" export 'quoted text' printf test "$@" test done && 2>/dev/null
+test 2>/dev/null sed awk local x=1 --verbose 'quoted text' test printf 2>/dev/null
+		"$1" printf echo local test test printf grep local sed test
+		printf cd cd grep awk "$1" /usr/bin then 'quoted text' --verbose echo awk --verbose
+		${HOME} export /usr/bin -eu printf then then
+		-eu grep echo cd "$1" --verbose
+done -eu "$1" --verbose then "$@" export printf /usr/bin cd --verbose grep
+		"$@" ${HOME} cd local done test "$@" export echo | ${HOME}
+"$1" export "$@" done readonly echo $(pwd) printf test
+	then "$@" grep then printf sed cd 2>/dev/null "$@" && 'quoted text' --verbose
+grep x=1 local printf printf /usr/bin
+	-eu echo export then | $(pwd) sed cd --verbose
+	-eu grep printf echo && done --verbose local 2>/dev/null
+		'quoted text' export $(pwd) x=1 -eu then test printf local done --verbose
+		$(pwd) grep echo then cd echo "$1" printf readonly echo awk sed
+	x=1 2>/dev/null 2>/dev/null 'quoted text' 2>/dev/null
+"$@" && printf test readonly done 2>/dev/null
+	grep local /usr/bin test sed "$@" test x=1
+&& /usr/bin then --verbose 2>/dev/null 2>/dev/null | x=1 sed 2>/dev/null
+	echo grep | | "$@" export grep ${HOME} done done ${HOME}
+$(pwd) x=1 | --verbose --verbose printf awk 'quoted text' then done done
+		grep export echo 2>/dev/null && test /usr/bin | grep grep $(pwd) local x=1
+	grep --verbose cd && printf 'quoted text'
+		awk "$1" cd && ${HOME} 2>/dev/null cd && grep "$1" &&
+-eu ${HOME} echo export /usr/bin printf echo
+&& sed grep awk --verbose export grep then cd && $(pwd) "$1"
+		$(pwd) awk ${HOME} test done "$1" test sed
+	local "$@" printf export echo export
+		-eu cd "$@" ${HOME} then printf
+	2>/dev/null --verbose x=1
+${HOME} | | grep "$1" local readonly "$@"
+	--verbose test test done
+		-eu readonly awk readonly --verbose readonly 2>/dev/null "$@" $(pwd) local 2>/dev/null
+		sed test echo echo local cd then "$1" | grep local -eu $(pwd) export echo grep
+	${HOME} then grep ${HOME}
+	done x=1 printf -eu local then && ${HOME} --verbose --verbose printf grep
+		-eu && done awk $(pwd) readonly /usr/bin sed
+		2>/dev/null x=1 $(pwd) -eu then awk test echo ${HOME} grep x=1 cd printf
+then x=1 grep done done done 'quoted text'
+	local sed | 2>/dev/null "$@" 'quoted text'
+--verbose "$@" $(pwd) 'quoted text' then readonly "$@"
+		'quoted text' sed grep readonly awk $(pwd)
+	| cd sed -eu x=1 printf ${HOME} "$@" grep export
+	test 2>/dev/null | printf "$1"
+		${HOME} 2>/dev/null local ${HOME} test "$@"
+	$(pwd) | "$@" test grep local ${HOME} then 'quoted text'
+readonly readonly && cd && $(pwd) done readonly
+sed $(pwd) -eu grep && sed then then -eu $(pwd) sed --verbose
+sed 2>/dev/null sed x=1 -eu export readonly $(pwd)
+	awk awk | ${HOME} | readonly cd grep then "$@" $(pwd) $(pwd)
+	grep printf cd local sed readonly grep 2>/dev/null grep | echo
+		awk then x=1 x=1 "$1" export 2>/dev/null
+		local "$1" "$1" then local 2>/dev/null /usr/bin then $(pwd)
+| 2>/dev/null /usr/bin -eu readonly test /usr/bin && awk "$@" cd
+	&& | sed "$@" echo then 2>/dev/null grep /usr/bin then
+printf -eu sed local then sed "$1" printf
+		local printf export done /usr/bin printf
+	done test /usr/bin printf "$1" "$1"
+		'quoted text' x=1 readonly export readonly -eu "$@" sed -eu "$1" readonly
+x=1 export sed -eu test sed awk cd
+readonly x=1 $(pwd) "$@"
+	-eu --verbose grep done then "$@"
+		x=1 /usr/bin export local 'quoted text'
+	'quoted text' $(pwd) readonly local export test 2>/dev/null
+		${HOME} ${HOME} local sed export
+		"$1" "$1" readonly test "$1" && test | awk test
+		${HOME} "$1" -eu cd printf done grep local echo
+	printf echo 2>/dev/null ${HOME}
+		export sed -eu && test done cd $(pwd)
+		cd done awk 'quoted text' test readonly local done /usr/bin | "$1" sed
+test "$@" "$@" cd grep "$@" awk printf printf echo ${HOME} awk then test
+	-eu test 'quoted text' $(pwd) then /usr/bin test | test
+		test /usr/bin readonly | "$@" "$@"
+${HOME} ${HOME} done then
+	/usr/bin awk cd ${HOME} sed -eu printf echo /usr/bin 2>/dev/null printf printf
+		2>/dev/null && grep | echo local && --verbose readonly test grep /usr/bin
+		test then echo 'quoted text' x=1 && test /usr/bin local -eu 'quoted text'
+		$(pwd) /usr/bin echo -eu test -eu x=1
+	&& done then grep readonly /usr/bin awk 2>/dev/null
+	printf $(pwd) "$@" test "$@" /usr/bin
+		readonly 2>/dev/null 2>/dev/null "$1" echo
+		printf echo 'quoted text' export awk cd test 2>/dev/null
+		&& 'quoted text' export cd echo "$1" 'quoted text' /usr/bin echo grep && /usr/bin
+local && test ${HOME} 2>/dev/null | 2>/dev/null $(pwd) 'quoted text' readonly
+readonly 2>/dev/null sed && readonly
+	done -eu && "$@" awk -eu | echo && && awk $(pwd) x=1
+		awk /usr/bin sed done readonly 2>/dev/null ${HOME} /usr/bin
+	2>/dev/null sed --verbose
+	${HOME} --verbose x=1 "$1" awk
+readonly --verbose 'quoted text'
+	printf then printf test x=1 | done ${HOME}
+		x=1 /usr/bin export grep test cd done ${HOME} -eu then 'quoted text'
+done echo done "$@" cd "$1" sed && && echo echo --verbose | local cd done
+	-eu then $(pwd) ${HOME} && -eu 'quoted text' "$@" done sed $(pwd) cd
+		| /usr/bin && printf done readonly printf
+		2>/dev/null && --verbose && /usr/bin cd 2>/dev/null
+2>/dev/null -eu awk 'quoted text'
+"$1" export done 2>/dev/null -eu && "$@" cd printf
+		${HOME} printf ${HOME} ${HOME} readonly
+done && 'quoted text' && ${HOME} export -eu x=1 x=1 $(pwd) done --verbose
+then $(pwd) grep 'quoted text' then "$@" cd "$@" x=1 $(pwd) export awk 'quoted text'
+/usr/bin then grep printf readonly sed "$1" grep
+	&& sed -eu "$1" awk && --verbose --verbose 2>/dev/null export cd sed
+		printf && grep && awk | export printf -eu 'quoted text' export readonly
+2>/dev/null ${HOME} grep /usr/bin export export -eu && $(pwd) "$@" "$@" | 2>/dev/null
+grep $(pwd) ${HOME} readonly readonly --verbose && grep local 'quoted text'
+echo cd export awk "$1" /usr/bin done printf ${HOME} 2>/dev/null "$@"
+export test local test x=1 x=1 "$1" ${HOME} -eu | "$@" --verbose
+printf done cd --verbose /usr/bin
+	$(pwd) export grep test /usr/bin "$@" 2>/dev/null
+readonly printf printf readonly test | /usr/bin grep echo test sed then && --verbose
+	printf | --verbose -eu $(pwd) then x=1 readonly done
+	printf | echo "$1" $(pwd) "$@" printf -eu /usr/bin -eu $(pwd) "$1"
+	"$@" awk printf x=1 readonly cd local ${HOME} | ${HOME} export $(pwd)
+$(pwd) && then && printf test export export
+		done "$@" export cd echo "$@" && awk test 2>/dev/null sed cd local
+&& grep test readonly done
+	printf "$@" | 2>/dev/null test ${HOME} grep
+		readonly 'quoted text' cd cd echo printf
+--verbose 2>/dev/null echo ${HOME} 'quoted text' grep cd
+	done sed readonly x=1 readonly 'quoted text'
+	sed && printf 'quoted text' "$@" echo x=1 /usr/bin test export ${HOME} 'quoted text'
+	export 2>/dev/null -eu 2>/dev/null local && readonly sed sed export printf
+		"$1" local ${HOME} cd 2>/dev/null
+		awk export local && local awk readonly
+	"$@" readonly $(pwd) export 2>/dev/null grep test | 2>/dev/null
+		test grep grep && grep awk 2>/dev/null awk sed "$@" "$@" 2>/dev/null done
+	"$1" 'quoted text' && export readonly export cd cd 2>/dev/null
+	&& "$@" cd 2>/dev/null
+then local done $(pwd) x=1 awk "$@" cd --verbose cd &&
+grep x=1 "$1" x=1 'quoted text' readonly printf | --verbose "$1" then
+export awk echo "$@" test test printf 2>/dev/null done x=1 local $(pwd)
+export then "$@" sed echo
+	export | sed "$@" awk local cd local | && -eu
+		echo local sed grep "$1" sed -eu local
+		/usr/bin /usr/bin export
+"$1" done --verbose -eu -eu printf export local /usr/bin printf test grep
+	echo 2>/dev/null awk && cd | 'quoted text' 2>/dev/null 2>/dev/null printf
+		&& && "$@" 2>/dev/null cd x=1 2>/dev/null
+	echo $(pwd) test | then 'quoted text' local
+	grep -eu $(pwd) grep then sed cd "$1" echo local awk ${HOME} cd 'quoted text' local
+grep readonly -eu /usr/bin -eu done "$1" done
+--verbose x=1 cd readonly "$1" --verbose sed export done 2>/dev/null
+/usr/bin test ${HOME}
+	--verbose export echo 'quoted text'
+	then | done awk "$1" -eu x=1 'quoted text'
+	x=1 | "$@" 2>/dev/null done "$@" /usr/bin | local --verbose x=1 test
+	'quoted text' 'quoted text'
+		--verbose done grep local | $(pwd) x=1 x=1 export x=1 "$1" grep awk echo
+	-eu x=1 'quoted text' 2>/dev/null test then done ${HOME} export | printf
+&& done test "$1" test grep "$1" awk then then export readonly 2>/dev/null awk -eu
+| export then printf readonly
+--verbose local then readonly export x=1
+		/usr/bin $(pwd) /usr/bin local printf local
+	sed cd ${HOME} 2>/dev/null --verbose export /usr/bin /usr/bin 'quoted text'
+sed printf /usr/bin done 2>/dev/null
+printf export grep 2>/dev/null sed -eu "$1" test awk
+		'quoted text' local "$1" then local $(pwd) "$1" ${HOME}
+$(pwd) /usr/bin 2>/dev/null export -eu readonly grep
+	local "$1" done done grep 'quoted text' "$1" export cd printf
+		${HOME} | -eu awk | grep 2>/dev/null sed "$1" --verbose
+		then printf cd -eu echo /usr/bin ${HOME}
+		test printf 'quoted text' --verbose printf printf --verbose
+		"$@" --verbose test test sed $(pwd) ${HOME} "$1" local awk 'quoted text'
+		grep test "$1" && 2>/dev/null x=1 x=1 grep | -eu awk $(pwd) "$@" --verbose
+		export local /usr/bin awk 'quoted text' grep test ${HOME} echo test echo
+	echo readonly awk --verbose test export readonly 'quoted text' ${HOME}
+		grep -eu cd test ${HOME} local done sed && export | && -eu
+		sed "$1" /usr/bin local sed grep
+		"$1" 2>/dev/null $(pwd) done --verbose
+		${HOME} local grep done /usr/bin 'quoted text' then printf printf --verbose
+		/usr/bin printf local sed /usr/bin 2>/dev/null && -eu
+	printf && local 'quoted text' readonly 'quoted text' $(pwd) readonly readonly
+	export x=1 echo ${HOME} test | "$@" export | export sed printf cd $(pwd)
+		done $(pwd) readonly grep -eu done &&
+	/usr/bin printf $(pwd) export /usr/bin ${HOME} 2>/dev/null
+		'quoted text' grep readonly "$@" test ${HOME} done /usr/bin
+grep /usr/bin "$1" echo ${HOME} printf grep
+	'quoted text' then then awk cd sed awk cd done echo export "$1" awk x=1
+		--verbose | echo && local
+		local 2>/dev/null then /usr/bin ${HOME} 'quoted text' 'quoted text'
+cd --verbose printf -eu ${HOME} 'quoted text' "$@" "$@" sed $(pwd) "$1"
+cd ${HOME} local printf "$1" 'quoted text' "$@" ${HOME}
+	| export ${HOME} then ${HOME} x=1 | /usr/bin
+	| | "$@" export "$@" 'quoted text' "$@" done "$1" then "$1"
+local local echo then /usr/bin local then /usr/bin done -eu
+readonly 2>/dev/null test echo x=1 'quoted text' 'quoted text' done
+		awk "$1" export cd /usr/bin test x=1 --verbose
+	${HOME} 2>/dev/null 'quoted text' 2>/dev/null
+	| sed 'quoted text' done awk -eu --verbose
+awk echo /usr/bin --verbose $(pwd) test test -eu && readonly sed echo "$@" 2>/dev/null
+-eu sed readonly awk test "$1" sed
+		cd ${HOME} 2>/dev/null ${HOME} "$1" ${HOME}
+${HOME} ${HOME} local | awk && printf export cd local | grep printf
+	done 2>/dev/null x=1 readonly then then cd $(pwd) test readonly
+	test | grep then then then test "$@" "$1" cd 2>/dev/null
+	local 2>/dev/null export cd --verbose && | readonly
+		readonly sed "$1" | cd
+	sed "$1" local done done
+		sed cd /usr/bin "$1" "$@" printf ${HOME} then --verbose
+echo export /usr/bin local "$@" "$1" | && && cd && $(pwd) readonly
+"$@" /usr/bin 'quoted text' done then | | awk -eu
+$(pwd) 2>/dev/null && then 'quoted text' readonly printf ${HOME} printf ${HOME}
+	'quoted text' awk sed export
@@ -0,0 +1,2001 @@
+	export && x=1 done /usr/bin readonly | cd x=1 |
+"$@" cd test sed "$1" x=1 "$1"
+	sed local grep cd local cd ${HOME} /usr/bin "$1" local
+		awk printf 'quoted text'
+	done | "$@" readonly export 'quoted text' -eu | "$@" then
+		readonly sed $(pwd) ${HOME} readonly test export test grep local
+	readonly cd readonly $(pwd) done $(pwd) sed sed "$@" done ${HOME} $(pwd) test
+	grep echo then "$1" x=1 cd sed 2>/dev/null 'quoted text' 2>/dev/null 2>/dev/null
+&& 'quoted text' cd $(pwd)
+	$(pwd) | x=1 | x=1 "$1"
+		/usr/bin printf "$1" grep -eu $(pwd) printf test test -eu
+export x=1 export "$@" 'quoted text' /usr/bin
+		awk export local then
+| x=1 --verbose 'quoted text' "$1" | done ${HOME} x=1 test -eu
+printf | grep -eu echo $(pwd) printf grep cd then
+	test --verbose done awk test && /usr/bin grep "$@" && awk $(pwd) --verbose
+export then ${HOME} sed printf
+grep printf $(pwd) $(pwd) printf then
+"$1" x=1 ${HOME} "$1" 2>/dev/null
+	&& readonly readonly sed grep grep
+		test x=1 && test 'quoted text'
+		local $(pwd) awk sed test ${HOME}
+cd | awk test awk export sed local awk 2>/dev/null
+"$1" then done && && grep --verbose awk 2>/dev/null awk readonly
+		local && echo --verbose sed echo
+	"$@" --verbose -eu 'quoted text' grep test x=1 --verbose
+readonly "$@" export | /usr/bin
+readonly printf | "$1" cd awk
+readonly && x=1 2>/dev/null --verbose 'quoted text' cd $(pwd) x=1 export then $(pwd)
+		"$1" test | /usr/bin sed $(pwd) /usr/bin
+--verbose grep "$@" echo $(pwd) "$1" | sed then
+	printf /usr/bin printf /usr/bin -eu --verbose cd $(pwd) grep
+/usr/bin printf then 2>/dev/null
+	&& "$@" | done sed awk && x=1 readonly --verbose then 2>/dev/null
+then ${HOME} $(pwd) test
+		"$@" | test printf cd done echo "$1" done
+	local cd then export | /usr/bin "$@"
+		done export $(pwd) /usr/bin $(pwd) -eu sed printf ${HOME}
+grep && echo readonly grep 'quoted text' awk local "$1" then awk then
+/usr/bin readonly x=1 cd /usr/bin 'quoted text'
+${HOME} "$@" local awk grep ${HOME}
+echo $(pwd) $(pwd) x=1 done cd then
+		readonly then grep sed printf 2>/dev/null test "$1" export --verbose x=1 sed awk
+	2>/dev/null grep readonly 'quoted text' $(pwd) cd sed then
+	x=1 ${HOME} sed export ${HOME} && |
+x=1 then readonly $(pwd) awk
+		${HOME} ${HOME} 2>/dev/null && 2>/dev/null echo 2>/dev/null
+		2>/dev/null | && sed done export awk done /usr/bin 2>/dev/null
+$(pwd) done x=1 done grep
+		-eu readonly "$@" --verbose test test
+| awk echo "$1" cd done x=1 ${HOME} /usr/bin
+		cd "$@" x=1 readonly printf grep "$@" echo printf test 2>/dev/null 2>/dev/null
+		export && /usr/bin 2>/dev/null ${HOME} awk | $(pwd) done "$@" ${HOME} cd readonly
+		--verbose && awk | export export export "$@" sed readonly
+	grep ${HOME} -eu -eu 2>/dev/null printf 2>/dev/null echo 2>/dev/null grep grep cd
+	grep "$@" test cd readonly ${HOME} --verbose ${HOME} -eu printf "$@" echo printf
+	--verbose --verbose "$@" -eu 'quoted text' cd x=1 awk export
+		"$1" | readonly -eu ${HOME} /usr/bin test ${HOME}
+		done && printf "$1" local printf | then sed 2>/dev/null x=1 cd readonly then test
+readonly printf $(pwd) ${HOME}
+	"$@" --verbose done $(pwd) "$@" --verbose "$@" | export then | "$1" --verbose
+	printf && && $(pwd) export test awk export awk
+2>/dev/null done x=1 2>/dev/null
+	2>/dev/null $(pwd) test $(pwd) readonly cd --verbose cd ${HOME} && cd echo
+		'quoted text' "$1" test "$1" done ${HOME} "$@" -eu ${HOME} && grep $(pwd) | "$1"
+"$@" 2>/dev/null "$1" cd test done printf awk export | export sed /usr/bin
+		test "$1" sed export --verbose readonly
+	/usr/bin 'quoted text' cd local echo local printf -eu $(pwd) sed ${HOME}
+	export grep printf 2>/dev/null /usr/bin
+--verbose done 'quoted text' sed /usr/bin grep local --verbose
+	2>/dev/null cd echo sed readonly
+	then test x=1 /usr/bin local ${HOME} grep test export
+echo 2>/dev/null -eu $(pwd) test readonly "$@" awk 'quoted text'
+${HOME} ${HOME} cd test export -eu "$1" printf
+		awk "$@" 'quoted text' 'quoted text' test "$@" --verbose
+	${HOME} -eu /usr/bin 2>/dev/null awk ${HOME} readonly local awk readonly
+readonly echo && echo export printf export
+x=1 readonly | echo --verbose "$1"
+	"$1" 2>/dev/null x=1 2>/dev/null local grep
+		test readonly cd cd done echo ${HOME} /usr/bin
+cd 'quoted text' $(pwd) -eu 'quoted text' export ${HOME} | ${HOME} -eu echo &&
+	'quoted text' readonly local
+		echo /usr/bin --verbose 'quoted text' x=1 ${HOME} &&
+		'quoted text' ${HOME} printf --verbose
+	printf echo "$1" "$1" "$1" 'quoted text' then x=1 /usr/bin grep
+grep --verbose cd cd ${HOME} awk grep
+	/usr/bin ${HOME} -eu export awk export
+| "$@" sed "$1" x=1 cd && local grep grep printf printf | --verbose grep then
+		grep sed 2>/dev/null /usr/bin grep "$1" -eu
+$(pwd) ${HOME} printf "$@" 'quoted text'
+$(pwd) then printf --verbose 2>/dev/null cd $(pwd) echo export 'quoted text'
+		"$1" "$@" grep 2>/dev/null test printf --verbose
+-eu readonly 2>/dev/null done /usr/bin 2>/dev/null printf -eu --verbose
+echo local then done "$1" done "$1"
+		-eu local "$1" then && grep export $(pwd) 'quoted text'
+	cd -eu cd x=1 printf /usr/bin "$1" "$1" echo x=1 'quoted text' cd
+${HOME} readonly test export test
+then "$1" export "$@" 'quoted text' grep "$1" cd "$@" "$@"
+	$(pwd) x=1 ${HOME} && awk $(pwd) awk grep 'quoted text' x=1 'quoted text'
+	'quoted text' "$@" local sed 'quoted text' echo test local x=1 echo -eu
+	echo ${HOME} 'quoted text' x=1 'quoted text' 'quoted text'
+		'quoted text' awk -eu cd done
+		"$1" --verbose sed 'quoted text' &&
+		cd 'quoted text' export awk export | -eu && readonly
+		test /usr/bin cd 'quoted text' x=1 --verbose done grep then sed readonly
+	sed export grep "$1" -eu readonly | && readonly
+"$1" 2>/dev/null readonly --verbose "$1" awk "$1"
+		2>/dev/null awk grep test grep printf $(pwd) 'quoted text'
+		| $(pwd) "$@" awk done "$@" 'quoted text' cd | /usr/bin awk then
+x=1 then --verbose "$1" awk | /usr/bin
+	-eu "$@" "$1" printf
+echo sed then export done export | && && ${HOME} --verbose "$1" then
+		"$@" printf && "$@" x=1 export then local cd done echo test then
+	export sed | grep 'quoted text' printf --verbose local printf 2>/dev/null
+grep -eu --verbose test done 2>/dev/null "$1" /usr/bin test x=1
+		export 2>/dev/null --verbose cd awk
+"$@" 2>/dev/null -eu $(pwd) "$@" $(pwd) export
+		cd "$@" readonly sed -eu ${HOME}
+--verbose awk printf /usr/bin 2>/dev/null | sed
+		$(pwd) echo local --verbose --verbose | | | && "$@" &&
+		local export /usr/bin x=1 readonly export local
+		$(pwd) export grep grep grep local "$@"
+"$1" done readonly grep -eu x=1 cd ${HOME}
+	"$1" -eu printf "$1" "$1" x=1 -eu /usr/bin --verbose $(pwd) | && $(pwd)
+	then x=1 && done sed -eu --verbose 'quoted text' | $(pwd) /usr/bin
+done "$@" export x=1 x=1 2>/dev/null local 2>/dev/null printf readonly cd "$1" readonly
+test x=1 -eu x=1 done ${HOME} "$1" | local local
+$(pwd) test done 2>/dev/null /usr/bin awk grep x=1 /usr/bin 2>/dev/null done 'quoted text'
+	readonly | test -eu grep
+	cd echo | awk sed done && test x=1 done cd export "$1" awk 2>/dev/null
+2>/dev/null done -eu 2>/dev/null --verbose
+		/usr/bin 'quoted text' "$@" cd echo readonly test
+--verbose then grep cd grep
+		awk echo "$1" readonly $(pwd) sed echo /usr/bin cd &&
+$(pwd) 'quoted text' && && 2>/dev/null "$@" echo x=1 echo
+	${HOME} grep cd export |
+	'quoted text' --verbose
+		readonly test $(pwd) /usr/bin then then ${HOME}
+"$@" done local echo 'quoted text'
+	2>/dev/null then $(pwd) --verbose $(pwd) 2>/dev/null "$1" | --verbose
+		'quoted text' echo 'quoted text' echo
+		-eu echo grep 'quoted text' "$1" local -eu awk export
+		$(pwd) "$@" test ${HOME} export printf $(pwd) echo "$@" readonly ${HOME}
+	x=1 $(pwd) grep "$@" local -eu done $(pwd)
+	grep 'quoted text' local test export 'quoted text' echo --verbose && /usr/bin
+	printf x=1 /usr/bin 2>/dev/null printf printf sed
+	done sed /usr/bin done then echo /usr/bin test printf
+	grep x=1 echo /usr/bin awk local
+export "$1" | awk readonly "$1"
+	$(pwd) "$1" export "$@" export local export sed | "$@" /usr/bin
+		${HOME} /usr/bin echo awk 2>/dev/null export && --verbose
+	printf then awk test && 'quoted text' awk awk "$@" /usr/bin then &&
+		2>/dev/null && local readonly readonly
+	sed grep readonly | -eu sed /usr/bin printf "$1"
+		"$@" 2>/dev/null --verbose 2>/dev/null "$@" /usr/bin
+		export $(pwd) readonly 'quoted text' then sed local "$1" test grep done 'quoted text'
+		&& 'quoted text' $(pwd) then cd test -eu --verbose
+	awk sed done -eu printf && then | test
+test --verbose -eu x=1 done
+| printf then /usr/bin /usr/bin then awk "$1" x=1 printf done test
+		export grep $(pwd) x=1 --verbose local grep then | local test echo "$1" export local
+	x=1 2>/dev/null sed "$1" "$1" ${HOME}
+	${HOME} | grep $(pwd) test | "$@" $(pwd) $(pwd)
+		$(pwd) awk printf /usr/bin cd test x=1 | export ${HOME} $(pwd) then awk then &&
+	"$@" | done && "$1" --verbose "$1" -eu "$@" 2>/dev/null cd --verbose
+		grep then then awk x=1 'quoted text' echo test cd 'quoted text' grep
+readonly /usr/bin && done grep sed echo 2>/dev/null && "$@" 'quoted text'
+	sed $(pwd) -eu export x=1 readonly
+awk sed export export then 'quoted text' awk "$1" done "$@" "$1"
+	test $(pwd) /usr/bin --verbose /usr/bin readonly x=1
+		cd readonly awk /usr/bin cd --verbose done grep ${HOME} done /usr/bin && sed grep
+test awk | x=1 test 2>/dev/null sed /usr/bin
+		readonly -eu local done $(pwd) "$@" then
+	"$@" export cd /usr/bin 'quoted text' -eu $(pwd) grep printf printf
+		&& awk $(pwd) export 'quoted text' x=1 "$@" x=1 x=1 x=1 done
+/usr/bin x=1 $(pwd) readonly then local export && --verbose 2>/dev/null ${HOME}
+local echo sed then --verbose 2>/dev/null
+		grep done 'quoted text' printf then "$1" awk ${HOME} "$@" test x=1
+		| readonly && ${HOME} sed $(pwd) $(pwd) x=1
+grep /usr/bin export sed $(pwd) local "$1" cd then sed 2>/dev/null
+x=1 done --verbose && /usr/bin
+&& export --verbose /usr/bin awk echo
+x=1 local "$@" && awk test && readonly 2>/dev/null 2>/dev/null echo local 'quoted text'
+	'quoted text' test cd x=1 | 2>/dev/null
+'quoted text' test then /usr/bin grep echo export echo cd $(pwd) printf
+		${HOME} ${HOME} 2>/dev/null printf
+/usr/bin --verbose export /usr/bin local echo
+	"$@" 'quoted text' export
+-eu done awk $(pwd) $(pwd) cd test local /usr/bin && "$1"
+-eu awk readonly -eu then x=1 done
+&& local test printf readonly then && export
+	sed "$1" 2>/dev/null 'quoted text' /usr/bin done -eu then x=1
+printf "$1" cd grep sed | test "$1" echo printf
+		done done done done x=1 awk | awk then | $(pwd) done "$@" 2>/dev/null
+		-eu export 2>/dev/null echo cd export
+done 2>/dev/null printf echo "$@" --verbose 'quoted text' | export
+		| done sed ${HOME} | | sed "$@" 2>/dev/null "$@" done done awk export ${HOME} |
+		/usr/bin export sed ${HOME} sed "$@" 'quoted text'
+		test ${HOME} --verbose ${HOME} ${HOME} "$1" "$1" then awk x=1 /usr/bin readonly
+	grep then local 2>/dev/null
+"$@" "$1" cd && test 2>/dev/null --verbose /usr/bin /usr/bin --verbose sed local
+	'quoted text' export 2>/dev/null 'quoted text' grep 'quoted text' && 2>/dev/null
+readonly cd x=1 -eu /usr/bin cd x=1 export -eu ${HOME}
+	grep "$@" $(pwd) "$1" done ${HOME} awk
+		"$1" sed $(pwd) awk then 'quoted text' echo cd && "$1" grep
+	cd -eu "$@" 'quoted text' 2>/dev/null test -eu sed awk
+		$(pwd) printf --verbose awk test
+		cd && cd x=1 --verbose 2>/dev/null -eu && /usr/bin "$@" /usr/bin
+	'quoted text' readonly local
+		grep 2>/dev/null ${HOME} sed
+		grep 'quoted text' ${HOME} export readonly 'quoted text'
+		grep 'quoted text' sed local printf test
+		cd "$@" x=1 2>/dev/null grep
+		then && /usr/bin awk ${HOME} awk 2>/dev/null printf ${HOME} 2>/dev/null done
+		then export local x=1 awk $(pwd) readonly readonly "$1" export
+		2>/dev/null cd 2>/dev/null /usr/bin $(pwd)
+cd then then && echo --verbose x=1 awk grep /usr/bin test readonly
+		printf $(pwd) 2>/dev/null 2>/dev/null
+		echo | ${HOME} test local ${HOME} -eu /usr/bin "$@" "$1" 2>/dev/null
+	export 'quoted text' sed
+		test "$@" readonly "$1" sed 'quoted text' -eu sed 'quoted text'
+	echo "$1" "$@" grep then readonly local 2>/dev/null ${HOME}
+	-eu 'quoted text' readonly
+		cd /usr/bin grep /usr/bin done
+		echo readonly --verbose ${HOME}
+	-eu grep x=1 "$@" awk 2>/dev/null 'quoted text'
+awk sed readonly 'quoted text' "$1" sed sed done && grep 'quoted text' x=1
+	/usr/bin sed local x=1 printf then 'quoted text' grep sed x=1 /usr/bin
+	--verbose 2>/dev/null then --verbose test $(pwd) -eu cd | --verbose
+echo x=1 && 'quoted text'
+		sed $(pwd) x=1 done test echo local awk
+		awk "$@" grep sed x=1 --verbose sed local /usr/bin
+		-eu sed then "$@" | && /usr/bin sed x=1 x=1
+	/usr/bin then 'quoted text' echo sed readonly readonly "$1" "$1"
+		readonly sed local | "$1" readonly "$1" test "$1" cd "$@" ${HOME}
+	printf printf printf done export awk done echo x=1
+&& $(pwd) $(pwd) cd readonly awk | printf echo then readonly echo local test "$@"
+	export echo test "$@" /usr/bin readonly echo && -eu grep && readonly
+	export --verbose && printf | -eu x=1 export
+		printf /usr/bin awk | ${HOME} echo
+"$@" done /usr/bin -eu 'quoted text'
+--verbose /usr/bin export test "$1" -eu /usr/bin local "$@" ${HOME} && | && "$@"
+		sed awk printf ${HOME} cd then awk "$@" 'quoted text' local test cd 'quoted text'
+		then readonly && 2>/dev/null /usr/bin
+grep 'quoted text' done
+	grep readonly printf x=1 readonly 2>/dev/null done awk then
+		printf 2>/dev/null readonly awk export "$@" /usr/bin 2>/dev/null
+		echo $(pwd) 'quoted text' ${HOME} /usr/bin 2>/dev/null /usr/bin
+| grep ${HOME} test printf awk sed 2>/dev/null readonly awk /usr/bin
+	/usr/bin "$@" then grep export "$@" done && export local export
+2>/dev/null sed -eu sed /usr/bin
+		| && done echo -eu done
+	echo export | /usr/bin -eu grep /usr/bin "$1"
+	local readonly grep $(pwd) --verbose
+		--verbose readonly x=1 2>/dev/null readonly
+	echo local -eu $(pwd) "$@" test readonly ${HOME}
+	'quoted text' $(pwd) cd grep sed awk && test | --verbose readonly printf
+'quoted text' --verbose readonly awk then sed test && echo ${HOME} readonly
+		--verbose --verbose 'quoted text'
+sed done "$@" awk x=1 ${HOME} 'quoted text' ${HOME} "$1" readonly 'quoted text'
+&& --verbose -eu cd "$@" readonly cd -eu && -eu awk local echo
+	--verbose awk --verbose -eu grep export
+x=1 grep --verbose export local readonly local
+'quoted text' 2>/dev/null && "$1" x=1 ${HOME} done | "$1" then 2>/dev/null
+&& sed then printf sed --verbose readonly $(pwd)
+		done "$@" local echo $(pwd) /usr/bin then
+		"$@" export --verbose
+		test "$1" then /usr/bin ${HOME} then grep
+	grep 'quoted text' "$1" export done cd x=1 -eu echo 'quoted text'
+		printf --verbose 2>/dev/null -eu then &&
+printf && /usr/bin sed -eu x=1 -eu "$@" echo
+	test grep && 'quoted text' x=1
+'quoted text' $(pwd) ${HOME} --verbose local
+&& 2>/dev/null ${HOME} $(pwd) local
+2>/dev/null && test echo x=1 $(pwd) grep | readonly cd x=1
+'quoted text' grep echo "$@" "$@" sed "$@"
+test readonly x=1 done then -eu --verbose -eu
+	"$1" "$1" export --verbose printf 2>/dev/null readonly ${HOME} -eu readonly 2>/dev/null
+	cd 2>/dev/null readonly grep
+	-eu 'quoted text' printf
+then | done 'quoted text' -eu x=1 ${HOME} test done cd 2>/dev/null
+	'quoted text' ${HOME} echo 2>/dev/null printf && --verbose
+	readonly "$1" | awk then local export 'quoted text' test
+	/usr/bin sed 2>/dev/null | && 2>/dev/null sed ${HOME}
+		test done export /usr/bin --verbose awk done 2>/dev/null grep 'quoted text'
+"$1" sed --verbose | 'quoted text' ${HOME} done readonly echo ${HOME} x=1 "$@"
+	"$1" local --verbose 2>/dev/null | local | "$1" done grep sed sed
+printf 2>/dev/null ${HOME}
+printf | local cd 2>/dev/null sed readonly ${HOME}
+-eu echo done cd 'quoted text'
+		${HOME} ${HOME} printf sed --verbose
+'quoted text' 2>/dev/null | $(pwd) then readonly
+		--verbose export sed -eu "$@" printf cd "$@" -eu "$@" /usr/bin printf |
+-eu grep "$1" then x=1 | printf "$1" "$1" then x=1 'quoted text' "$1" sed
+		-eu local then done grep readonly
+/usr/bin awk printf echo echo
+	-eu awk --verbose test | | readonly grep
+		"$@" 2>/dev/null "$@" done test -eu --verbose local local /usr/bin x=1 && ${HOME}
+awk then export export export done then $(pwd) grep ${HOME} "$1" sed done
+then echo done then /usr/bin 2>/dev/null --verbose
+then 2>/dev/null export export sed awk --verbose | echo
+	local 'quoted text' done "$@" cd "$1" 'quoted text'
+	"$@" && "$@" /usr/bin 'quoted text' done grep grep export x=1 then then
+	x=1 done grep grep x=1 test awk | echo && readonly x=1 done
+	awk x=1 && export x=1 --verbose printf grep --verbose printf local
+test x=1 echo | test export printf local echo export && readonly then | /usr/bin
+		${HOME} /usr/bin readonly x=1 awk "$1" test test
+	"$@" 2>/dev/null x=1 then local test x=1 sed
+"$@" printf ${HOME} /usr/bin ${HOME} "$@" && --verbose printf
+$(pwd) 'quoted text' test echo
+	"$1" x=1 2>/dev/null "$1" "$@" printf 'quoted text' test readonly grep
+printf awk "$1" cd "$@" x=1 test sed x=1 then x=1 | $(pwd) then printf
+readonly test ${HOME} then "$@" grep then done
+&& /usr/bin ${HOME} test grep printf $(pwd) --verbose "$@" sed grep local
+		--verbose "$@" x=1 awk && x=1 grep
+cd cd x=1 echo ${HOME} readonly grep export echo /usr/bin
+	test sed grep 'quoted text' --verbose
+echo done | $(pwd) /usr/bin done done 'quoted text'
+	| then echo test local $(pwd)
+		"$@" -eu grep x=1 sed --verbose sed
+	2>/dev/null -eu readonly /usr/bin
+		then sed $(pwd) then test -eu then echo --verbose 'quoted text'
+		then cd export 'quoted text' test readonly echo /usr/bin
+	echo cd 'quoted text' export cd -eu done && readonly 'quoted text' done "$1" --verbose
+	then then echo grep grep grep -eu x=1 printf -eu
+grep printf --verbose x=1 printf printf
+local printf $(pwd) --verbose x=1 done test done 'quoted text' | ${HOME}
+		then x=1 printf && 2>/dev/null printf test -eu /usr/bin "$1" "$@" test
+		grep --verbose printf | "$@" | echo sed then "$1" grep test ${HOME}
+echo 2>/dev/null test then sed printf "$@" "$@" /usr/bin
+		sed x=1 "$@" then x=1 | then
+		export test cd | && ${HOME} x=1 echo printf awk --verbose
+		cd cd 'quoted text' export --verbose
+	export sed grep local 'quoted text'
+		-eu awk done -eu 2>/dev/null
+	"$@" --verbose -eu 'quoted text' local "$1" 'quoted text' printf printf && cd
+		export sed | | printf done -eu
+		local export printf "$@" -eu printf "$1" readonly 'quoted text'
+		/usr/bin ${HOME} && done readonly $(pwd)
+		export && test 'quoted text' /usr/bin
+	x=1 "$1" local export /usr/bin
+	local local printf readonly readonly test /usr/bin
+		"$1" ${HOME} 'quoted text' "$@" "$@" ${HOME} | /usr/bin x=1 "$@" 2>/dev/null
+	--verbose /usr/bin x=1 then echo "$1" local
+	| /usr/bin local cd | printf $(pwd) echo local cd test "$1" && awk x=1 sed
+		cd test ${HOME} done /usr/bin awk awk awk echo sed sed readonly $(pwd) &&
+	/usr/bin -eu "$1" test --verbose &&
+		sed /usr/bin 'quoted text' "$@" readonly local "$1" then 'quoted text'
+x=1 echo "$1" sed -eu local export
+		export export /usr/bin readonly
+	| export | echo readonly grep test x=1
+local export ${HOME} -eu -eu echo x=1 echo ${HOME}
+	printf export 'quoted text' cd ${HOME} ${HOME}
+	"$@" awk -eu /usr/bin && printf echo awk 2>/dev/null x=1 /usr/bin -eu "$1"
+		done awk x=1 && && done -eu 'quoted text' $(pwd)
+	-eu test 2>/dev/null "$1" /usr/bin
+| export $(pwd) test export --verbose echo "$1"
+x=1 then "$1" /usr/bin readonly $(pwd) "$@" grep echo echo x=1 -eu
+		/usr/bin $(pwd) sed 2>/dev/null done "$1" then grep
+		$(pwd) test && "$@" $(pwd) --verbose | x=1 cd
+	-eu readonly x=1 readonly "$@" 'quoted text'
+	--verbose 'quoted text' 'quoted text' "$1" then ${HOME} readonly
+		--verbose "$1" && "$1" && grep /usr/bin
+printf --verbose done sed awk sed
+	cd "$1" -eu "$1" ${HOME}
+	$(pwd) grep sed printf && cd done -eu "$@" --verbose
+		cd ${HOME} x=1 test then -eu export then /usr/bin
+		'quoted text' done cd $(pwd) printf printf readonly -eu echo sed cd export
+	readonly echo local then sed 2>/dev/null
+-eu export awk readonly "$1" 2>/dev/null 2>/dev/null --verbose sed "$1" done
+${HOME} printf sed then awk ${HOME} printf
+done --verbose | done then export then echo echo
+$(pwd) /usr/bin test done cd 'quoted text' && cd ${HOME} grep
+		printf | test "$1" export | printf echo done local readonly
+		2>/dev/null -eu ${HOME}
+--verbose done $(pwd) then 'quoted text' 2>/dev/null ${HOME} printf
+sed awk test awk x=1 $(pwd) --verbose cd
+		'quoted text' ${HOME} cd readonly
+	"$1" grep | && readonly echo awk "$1" 'quoted text'
+	cd | 2>/dev/null then export "$1" echo && awk
+then awk /usr/bin printf $(pwd) echo | /usr/bin
+${HOME} then -eu 2>/dev/null awk cd ${HOME} cd cd
+		&& local -eu -eu then awk $(pwd) sed /usr/bin export readonly printf
+	awk 'quoted text' && 'quoted text' && 2>/dev/null echo test
+'quoted text' 2>/dev/null
+	x=1 then printf echo && 2>/dev/null awk cd awk readonly /usr/bin "$@" && awk then
+test x=1 "$1" local ${HOME} --verbose printf echo -eu done printf printf
+		'quoted text' x=1 /usr/bin done sed 'quoted text' --verbose 'quoted text'
+	awk awk && x=1 export --verbose --verbose -eu export $(pwd) /usr/bin then then
+	--verbose "$1" grep local "$1" done printf then local
+		$(pwd) done --verbose "$1" then then grep --verbose ${HOME} export
+		cd printf grep "$@" $(pwd) "$@" $(pwd)
+		/usr/bin test sed local local 2>/dev/null "$@" x=1 printf grep
+export -eu local 'quoted text'
+		printf sed grep grep $(pwd)
+"$1" done x=1 2>/dev/null cd x=1 awk readonly
+	sed "$@" $(pwd) sed local then $(pwd) export test | printf sed then grep ${HOME}
+		${HOME} "$1" | 'quoted text' done cd cd 'quoted text' printf readonly
+	cd "$1" --verbose | done then
+"$@" /usr/bin -eu echo "$@" "$1" "$@" local | $(pwd) "$1" export printf ${HOME}
+		export $(pwd) printf printf 'quoted text' local cd 'quoted text'
+		/usr/bin 'quoted text' cd | /usr/bin
+	/usr/bin cd readonly "$@" grep echo 'quoted text' cd 'quoted text' x=1
+	local 2>/dev/null test --verbose --verbose export
+readonly | test -eu export "$@" -eu printf "$1"
+then local readonly sed -eu grep export 'quoted text' x=1 test --verbose
+	sed done done printf | local awk 2>/dev/null "$1" awk cd $(pwd)
+		done then -eu then ${HOME}
+		readonly local "$1" export x=1 sed echo echo grep cd ${HOME} 'quoted text' readonly
+		| printf echo /usr/bin local ${HOME}
+		done "$1" x=1 readonly | x=1 |
+		${HOME} | printf 'quoted text' "$@" 'quoted text' readonly
+echo -eu --verbose then 'quoted text' "$@" && then "$@" -eu 'quoted text'
+		printf cd done 2>/dev/null ${HOME} then $(pwd) /usr/bin readonly
+		/usr/bin "$1" then ${HOME} awk "$@" --verbose
+echo ${HOME} grep awk 'quoted text' export sed
+	readonly sed cd /usr/bin 'quoted text' /usr/bin --verbose 2>/dev/null test then
+awk awk && echo | readonly
+		--verbose done /usr/bin local /usr/bin local awk readonly ${HOME} /usr/bin
+	awk then /usr/bin "$1"
+printf echo awk awk test then
+	sed cd done export cd test x=1 2>/dev/null done then export
+	test sed readonly sed -eu -eu local -eu awk done 'quoted text' "$1" "$@" test
+	$(pwd) 2>/dev/null local | --verbose /usr/bin export printf ${HOME}
+	${HOME} awk "$1" then "$@" test 'quoted text' awk
+	local | sed readonly "$@" ${HOME} "$1" cd then then printf local | | -eu
+	readonly ${HOME} 'quoted text' 'quoted text'
+${HOME} "$1" /usr/bin
+		test awk printf printf $(pwd) done local
+	export --verbose /usr/bin readonly ${HOME}
+		--verbose "$1" --verbose --verbose readonly echo 2>/dev/null
+'quoted text' -eu export x=1 2>/dev/null then printf then "$@" x=1 2>/dev/null
+done 2>/dev/null export local "$1" 'quoted text' readonly
+		test readonly awk "$@" awk &&
+	cd 'quoted text' 2>/dev/null 2>/dev/null awk local "$@" --verbose | grep
+		${HOME} "$@" test awk -eu readonly | /usr/bin x=1 awk /usr/bin /usr/bin
+	$(pwd) sed echo echo sed done && $(pwd) 'quoted text' 'quoted text' grep
+done 'quoted text' test
+		$(pwd) grep then $(pwd) /usr/bin then | printf /usr/bin "$1" 2>/dev/null
+	x=1 "$1" "$@" -eu && 'quoted text' 'quoted text' --verbose ${HOME}
+	awk "$1" "$1" awk done
+		-eu 'quoted text' $(pwd) "$@" readonly --verbose awk "$1" sed
+	awk printf 'quoted text' x=1 "$@" cd /usr/bin test awk awk -eu done awk test
+local 'quoted text' ${HOME} readonly /usr/bin
+		done cd $(pwd) --verbose
+		test $(pwd) 2>/dev/null 2>/dev/null | 'quoted text' "$1" |
+	awk | awk ${HOME} | x=1 'quoted text' | --verbose
+		/usr/bin --verbose awk done "$1" /usr/bin echo local 2>/dev/null && test cd /usr/bin
+	cd -eu echo && "$1" $(pwd)
+	cd echo /usr/bin $(pwd) 'quoted text'
+	grep 2>/dev/null | printf "$@" --verbose done "$@" test printf && /usr/bin done
+grep done /usr/bin then then awk grep | done
+		readonly "$@" x=1 "$@" then sed readonly "$@" -eu x=1 &&
+&& 2>/dev/null && ${HOME} awk sed x=1 local ${HOME} && sed --verbose export sed
+	cd --verbose test && export done readonly readonly export 'quoted text'
+		| test "$@" then && awk printf
+-eu && | "$1" ${HOME} then then then $(pwd) sed $(pwd) then printf
+		"$1" 2>/dev/null test $(pwd) $(pwd) sed local awk | readonly awk x=1 'quoted text'
+		&& printf "$1" --verbose 2>/dev/null x=1 awk /usr/bin ${HOME}
+${HOME} readonly | test export -eu $(pwd) sed echo printf "$1" && export test
+/usr/bin --verbose cd then /usr/bin done grep | $(pwd) --verbose /usr/bin
+	done "$1" readonly readonly && export echo
+		sed && readonly printf 'quoted text' /usr/bin
+		grep then | export /usr/bin echo sed cd -eu "$1" $(pwd) "$1" $(pwd) /usr/bin local
+${HOME} done export "$1"
+		${HOME} && readonly 2>/dev/null "$@" $(pwd) -eu awk && grep grep $(pwd)
+	grep 2>/dev/null local "$@" cd cd grep done /usr/bin
+		then | -eu && export /usr/bin
+"$1" local awk -eu export readonly --verbose local
+sed ${HOME} then test &&
+		&& /usr/bin test done awk x=1 --verbose "$1"
+| --verbose 'quoted text' readonly ${HOME} cd test printf x=1 && test
+		printf --verbose ${HOME} --verbose $(pwd) printf -eu done
+cd then done sed 'quoted text'
+		&& "$1" "$@" | done then /usr/bin /usr/bin ${HOME} | | && 'quoted text'
+		"$1" 2>/dev/null then x=1 --verbose x=1 done x=1 2>/dev/null grep then test
+		$(pwd) 2>/dev/null &&
+		/usr/bin 'quoted text' sed -eu /usr/bin
+echo done grep "$1" cd export done awk done test export local
+	test sed awk -eu && && done 2>/dev/null
+	| test then ${HOME} x=1 sed grep sed grep --verbose printf --verbose x=1 done
+	"$@" x=1 2>/dev/null grep local
+		test done done cd "$@"
+x=1 --verbose x=1 readonly cd /usr/bin --verbose ${HOME}
+done x=1 /usr/bin 2>/dev/null
+		--verbose then readonly sed sed
+	x=1 && then && cd ${HOME} && awk awk 2>/dev/null sed sed "$1" 'quoted text'
+		local awk --verbose --verbose | awk export printf export export x=1 awk
+	awk echo -eu cd -eu $(pwd) then done "$@" /usr/bin cd | "$1" -eu ${HOME} test
+	-eu then printf 2>/dev/null
+		echo test done done test cd 2>/dev/null
+	echo "$@" /usr/bin --verbose
+local sed && readonly done "$1"
+| grep -eu -eu --verbose | test "$@" sed -eu /usr/bin x=1
+	${HOME} export sed local | | ${HOME} x=1 sed --verbose /usr/bin 2>/dev/null
+		local "$1" sed readonly | export 'quoted text'
+		| readonly grep local cd | "$1" "$@" done local
+	'quoted text' "$1" 'quoted text' --verbose && 'quoted text' && echo "$@" local
+	"$1" "$@" done then printf -eu cd grep "$1" 'quoted text'
+	2>/dev/null test done test sed grep awk cd local sed
+		sed sed 'quoted text' local && sed 'quoted text'
+'quoted text' ${HOME} sed
+local $(pwd) $(pwd) 2>/dev/null local --verbose readonly test 2>/dev/null
+		printf --verbose then echo | test ${HOME} local export
+cd echo $(pwd) awk cd grep /usr/bin -eu then "$1" /usr/bin readonly awk -eu
+then -eu $(pwd) 'quoted text' && -eu && 2>/dev/null sed
+		grep grep | | echo x=1
+	-eu printf cd sed readonly grep awk && local awk
+		${HOME} echo "$1" readonly | /usr/bin 'quoted text' done 'quoted text'
+		--verbose grep sed printf cd cd test ${HOME} cd x=1 echo /usr/bin then echo 2>/dev/null
+		grep sed && 2>/dev/null printf
+-eu $(pwd) test $(pwd)
+	| && "$1" then "$@" awk grep grep "$@" --verbose
+		then 'quoted text' /usr/bin "$1" local "$@" ${HOME} "$@" then
+then echo echo -eu readonly ${HOME} cd $(pwd) "$1" "$@" 2>/dev/null /usr/bin
+		| | 'quoted text' | printf awk "$@" && sed && echo $(pwd) ${HOME} printf
+		done local x=1 cd local -eu awk local
+| local x=1 cd printf grep "$1" | $(pwd) printf 'quoted text'
+		then /usr/bin cd 2>/dev/null
+2>/dev/null 'quoted text' cd --verbose | -eu cd
+		"$@" cd /usr/bin readonly &&
+-eu then done 2>/dev/null "$1" cd && local readonly
+		readonly | ${HOME} awk test 2>/dev/null "$1" $(pwd) x=1 done local && awk export
+-eu readonly 2>/dev/null &&
+&& ${HOME} x=1 done -eu $(pwd) $(pwd) test test awk sed /usr/bin $(pwd) awk
+	test && | readonly echo sed then $(pwd) awk --verbose
+	echo --verbose "$1" sed awk $(pwd)
+		done $(pwd) | && cd printf local 2>/dev/null &&
+	readonly awk then printf "$@" ${HOME}
+	export cd x=1 local export /usr/bin 'quoted text' echo readonly
+/usr/bin /usr/bin printf x=1 'quoted text'
+awk -eu printf /usr/bin grep done printf 'quoted text'
+	done -eu --verbose then | test
+	2>/dev/null ${HOME} -eu sed "$@"
+		grep grep 'quoted text' awk ${HOME}
+		local done echo $(pwd) local x=1
+	local local readonly -eu "$@" grep x=1 | readonly
+		grep "$1" then local grep /usr/bin readonly "$@"
+awk "$1" printf cd /usr/bin |
+sed local "$1" test then grep x=1 x=1 x=1 then ${HOME} ${HOME} /usr/bin
+--verbose && "$1" /usr/bin 2>/dev/null done "$1" && -eu local grep
+		-eu $(pwd) "$1" ${HOME} echo awk local && ${HOME} "$@" | "$@"
+grep test /usr/bin printf 2>/dev/null awk 'quoted text' |
+		"$@" $(pwd) test grep --verbose export
+		/usr/bin && x=1 readonly -eu ${HOME}
+cd 2>/dev/null cd $(pwd) awk awk 'quoted text' ${HOME} 2>/dev/null then ${HOME}
+	export 'quoted text' && then then export 2>/dev/null
+		'quoted text' /usr/bin cd "$@" $(pwd) -eu $(pwd) -eu x=1
+		echo | && -eu 'quoted text' cd readonly grep 2>/dev/null
+	--verbose /usr/bin done test printf 2>/dev/null --verbose readonly then
+$(pwd) "$@" done && | 'quoted text' "$@" 'quoted text'
+		$(pwd) && --verbose /usr/bin /usr/bin
+		&& cd | test local then --verbose printf test then "$1" grep -eu
+		printf x=1 sed $(pwd) 2>/dev/null awk x=1 --verbose x=1 then cd &&
+	local 2>/dev/null echo export | cd test then | grep test echo
+		printf then echo $(pwd) printf export sed $(pwd) done grep /usr/bin cd 'quoted text'
+$(pwd) local test sed ${HOME} | --verbose
+	test local 'quoted text' --verbose echo done printf --verbose
+-eu --verbose grep grep x=1 readonly 'quoted text' then --verbose
+		cd /usr/bin x=1 --verbose then test echo && export cd 'quoted text'
+	x=1 /usr/bin /usr/bin printf $(pwd) local -eu
+		grep | echo /usr/bin cd && done local
+readonly then ${HOME} sed done | --verbose "$1" --verbose 2>/dev/null
+	test | x=1 x=1 then awk $(pwd)
+	sed $(pwd) x=1 test test export
+	x=1 /usr/bin export "$@" --verbose $(pwd) x=1 /usr/bin
+sed echo sed --verbose printf awk awk "$1" grep --verbose x=1
+		| --verbose "$1" done readonly x=1 2>/dev/null
+		| echo then "$@" /usr/bin test readonly
+	cd awk printf then export
+sed then awk readonly done "$@" /usr/bin -eu cd printf grep
+	cd done 'quoted text' --verbose "$1" local -eu
+		${HOME} done printf 2>/dev/null 2>/dev/null | $(pwd)
+	/usr/bin grep test ${HOME} local sed
+	--verbose -eu readonly --verbose x=1 ${HOME} echo readonly cd sed x=1 'quoted text'
+echo test cd /usr/bin && done awk
+		"$@" x=1 test x=1 $(pwd) grep readonly grep 2>/dev/null $(pwd) readonly
+x=1 then "$1" && printf readonly
+awk done | awk ${HOME} printf grep "$@" done 'quoted text'
+${HOME} 'quoted text' "$@" -eu done
+	readonly cd sed "$1" x=1 readonly $(pwd) then printf x=1 done readonly
+		export sed sed echo 'quoted text' sed echo printf "$1" test done
+	'quoted text' local && && x=1 -eu
+"$1" test sed local x=1 ${HOME} done /usr/bin
+		test readonly test export 2>/dev/null test export readonly then -eu 2>/dev/null
+sed --verbose printf /usr/bin readonly ${HOME}
+		readonly $(pwd) done echo
+		cd then -eu && 2>/dev/null test awk $(pwd) grep && printf "$1" awk /usr/bin 2>/dev/null
+		$(pwd) printf readonly test $(pwd) test "$1" "$1" "$1" && cd "$@"
+		2>/dev/null test "$1" 2>/dev/null
+	2>/dev/null ${HOME} | $(pwd) "$1" test ${HOME} test $(pwd) test && test readonly
+	$(pwd) cd "$1" 'quoted text' readonly
+		-eu /usr/bin 'quoted text' ${HOME} $(pwd) then
+	&& grep grep | then ${HOME} /usr/bin
+done && --verbose "$@" 2>/dev/null export then printf ${HOME}
+'quoted text' awk ${HOME} 2>/dev/null awk /usr/bin
+local grep $(pwd) awk 'quoted text' | test then echo "$@" grep $(pwd) printf awk
+	"$1" "$@" test x=1 ${HOME} ${HOME}
+		"$@" "$1" /usr/bin cd then ${HOME} x=1 sed then
+${HOME} export "$1" done test && sed grep /usr/bin | $(pwd) readonly -eu
+$(pwd) echo printf && ${HOME} /usr/bin printf export awk sed 2>/dev/null
+	awk sed 'quoted text' test ${HOME} ${HOME} 'quoted text' "$@" /usr/bin "$1" export
+		sed /usr/bin "$1" awk echo export $(pwd) printf
+local cd awk "$1" x=1 ${HOME} readonly printf "$@" 'quoted text'
+	"$1" ${HOME} --verbose sed awk -eu && grep local
+	then 2>/dev/null printf awk $(pwd) "$@" x=1 printf -eu readonly printf printf printf
+	grep grep -eu | awk "$@" done 2>/dev/null
+	--verbose echo && done cd 'quoted text' then printf done
+local ${HOME} echo printf echo local -eu printf grep
+	| then $(pwd) 'quoted text' then cd awk | local export cd 'quoted text'
+	awk test /usr/bin | "$1" -eu --verbose awk /usr/bin sed 2>/dev/null
+"$1" | x=1 "$@" echo cd awk /usr/bin then local $(pwd) cd x=1 readonly
+	&& echo 'quoted text' ${HOME} && /usr/bin sed grep cd local --verbose
+		cd --verbose readonly "$1" local awk /usr/bin then readonly
+'quoted text' sed printf $(pwd) | && test then "$1" 2>/dev/null ${HOME} 2>/dev/null
+	/usr/bin readonly local 'quoted text' "$@" grep export "$@" x=1
+		local "$1" && 2>/dev/null $(pwd) echo readonly
+x=1 echo local cd grep /usr/bin ${HOME} ${HOME}
+	/usr/bin | awk $(pwd) /usr/bin awk readonly echo echo echo "$@"
+test readonly --verbose /usr/bin then "$@" echo
+	grep /usr/bin --verbose printf && done x=1 export
+	'quoted text' printf printf done readonly test echo export
+	${HOME} -eu $(pwd) done test
+| x=1 "$1" | 2>/dev/null echo --verbose
+	--verbose --verbose cd echo x=1 $(pwd) 2>/dev/null
+	cd sed /usr/bin grep test grep then awk /usr/bin sed 'quoted text'
+	/usr/bin awk | /usr/bin "$@" echo local
+sed --verbose export ${HOME} export export -eu -eu x=1 then printf
+	&& 2>/dev/null --verbose
+echo cd then --verbose 2>/dev/null 'quoted text'
+		then readonly 'quoted text' -eu done 'quoted text'
+	--verbose -eu printf 2>/dev/null /usr/bin grep --verbose
+		awk done && 'quoted text' done
+	2>/dev/null test readonly "$1" done && /usr/bin awk ${HOME}
+${HOME} sed printf readonly test -eu readonly printf
+	--verbose ${HOME} | then
+	export local ${HOME} "$@" 2>/dev/null local
+echo 2>/dev/null && x=1 --verbose
+		| "$@" grep sed "$1" 2>/dev/null | | echo && /usr/bin export local 2>/dev/null
+/usr/bin echo 'quoted text' 2>/dev/null 2>/dev/null "$@" $(pwd) $(pwd)
+	done grep "$@" x=1 local local
+	local local grep -eu ${HOME} export $(pwd) local
+cd 2>/dev/null then 2>/dev/null
+		&& x=1 2>/dev/null then readonly printf ${HOME} ${HOME} 2>/dev/null x=1 && 'quoted text'
+		/usr/bin sed "$@" then cd | -eu test "$1" export awk && sed
+		sed export -eu | test "$@" && awk cd &&
+	/usr/bin "$@" printf 'quoted text' x=1 sed done sed export
+	"$@" awk -eu awk --verbose /usr/bin local sed grep then $(pwd)
+		done awk cd 'quoted text' then && grep echo
+echo grep 'quoted text' "$@" ${HOME} done x=1 "$@" cd local done 2>/dev/null x=1
+&& test test then x=1 printf 'quoted text' --verbose
+		grep awk ${HOME} --verbose grep local 2>/dev/null
+		${HOME} done printf 2>/dev/null "$@" 2>/dev/null sed sed x=1 grep "$@" grep ${HOME}
+sed test "$1" printf done ${HOME} echo cd --verbose export 'quoted text' then
+		awk x=1 sed --verbose /usr/bin "$@"
+test cd grep | && done 2>/dev/null sed ${HOME} cd printf printf sed echo 'quoted text'
+/usr/bin cd done grep grep "$1" local |
+		done -eu --verbose $(pwd) "$@" sed done x=1 printf -eu then "$@" grep cd /usr/bin
+	grep && -eu readonly echo awk --verbose | 'quoted text' -eu grep 2>/dev/null | --verbose
+		${HOME} readonly ${HOME} export --verbose --verbose /usr/bin
+	$(pwd) x=1 grep readonly | && /usr/bin $(pwd) local export "$@" 'quoted text'
+	done test "$@" test $(pwd) export sed "$@" 2>/dev/null
+readonly export readonly $(pwd) grep cd done test test local /usr/bin
+	cd printf done | 'quoted text' done
+awk 2>/dev/null local local $(pwd) 'quoted text' 'quoted text' awk --verbose
+		/usr/bin x=1 'quoted text' ${HOME} --verbose "$1" "$1" /usr/bin cd export /usr/bin
+	| readonly readonly ${HOME} x=1 export "$1" readonly local local
+printf readonly "$@" test --verbose
+test && --verbose 'quoted text' echo test && $(pwd) x=1 x=1
+$(pwd) cd "$1" ${HOME} echo grep ${HOME} cd "$@" -eu printf
+	export echo printf ${HOME} test readonly "$@" $(pwd) readonly 'quoted text'
+		"$@" $(pwd) sed awk local && awk "$@" readonly "$1"
+		local --verbose 2>/dev/null then "$@" --verbose sed 2>/dev/null echo done -eu
+		${HOME} done x=1 local ${HOME} export
+		grep cd "$1" 2>/dev/null local local | /usr/bin "$@"
+		$(pwd) --verbose grep sed 'quoted text' test
+		"$1" readonly 'quoted text' ${HOME} /usr/bin cd /usr/bin done x=1 --verbose
+		cd local -eu | export export 'quoted text' --verbose "$1" "$@" "$1"
+		echo readonly 'quoted text'
+awk -eu 2>/dev/null awk cd ${HOME} then test $(pwd) awk && --verbose 2>/dev/null
+/usr/bin printf "$@" 2>/dev/null local
+		'quoted text' "$1" grep export
+	sed printf local "$1" /usr/bin $(pwd) grep ${HOME} x=1 && "$1" --verbose
+		cd test printf x=1 printf sed
+		"$@" readonly ${HOME} printf
+	| readonly cd then awk sed 2>/dev/null
+	grep cd sed --verbose 'quoted text' sed 'quoted text' "$@" 'quoted text'
+	| "$@" "$1" echo "$1" $(pwd) -eu grep ${HOME}
+		sed 'quoted text' done sed /usr/bin cd x=1 "$1"
+		"$1" done /usr/bin && /usr/bin x=1 export
+	done echo readonly cd x=1 export
+		test readonly local readonly /usr/bin "$1" grep cd --verbose -eu "$1"
+		readonly awk | done cd $(pwd) x=1 "$@" readonly local local
+done 'quoted text' printf ${HOME}
+sed awk readonly 2>/dev/null && done | echo readonly local
+	then sed cd then -eu x=1 awk export 'quoted text' | 'quoted text'
+	awk 2>/dev/null local readonly awk 'quoted text' 2>/dev/null
+$(pwd) sed x=1 readonly cd test 2>/dev/null awk x=1 x=1 "$@"
+/usr/bin 2>/dev/null --verbose
+x=1 printf echo grep cd && sed --verbose done x=1 -eu done ${HOME} "$1"
+&& "$@" done ${HOME} echo done x=1 $(pwd)
+&& sed then echo then 'quoted text' readonly
+"$1" "$@" sed "$1" "$@" /usr/bin --verbose export 'quoted text' 'quoted text' cd
+export test --verbose readonly export awk && printf then -eu sed test /usr/bin
+	then && && sed local $(pwd)
+		done local done local $(pwd) -eu grep
+		cd printf echo | 'quoted text' /usr/bin grep 2>/dev/null
+done export echo export printf printf export
+	"$@" done ${HOME} "$@" --verbose test then readonly 2>/dev/null
+		-eu "$1" sed readonly export sed && then grep done 'quoted text'
+| 2>/dev/null readonly /usr/bin test | x=1 && test $(pwd) ${HOME}
+${HOME} readonly /usr/bin then | x=1 x=1 "$@" readonly --verbose
+		readonly "$1" $(pwd) ${HOME} x=1
+${HOME} --verbose && 2>/dev/null -eu "$1"
+		-eu ${HOME} && "$1" echo awk readonly ${HOME}
+		'quoted text' x=1 $(pwd) printf sed --verbose
+		awk $(pwd) export grep sed
+		2>/dev/null "$1" 2>/dev/null printf -eu "$1" "$1" printf 2>/dev/null
+		printf "$@" 'quoted text' awk grep then
+	'quoted text' awk awk printf ${HOME} echo -eu | test --verbose x=1 2>/dev/null
+	cd awk then 'quoted text' -eu "$@" /usr/bin "$@" ${HOME} then sed
+local test ${HOME} "$1" "$@" local "$1" echo 'quoted text'
+	| "$@" awk export grep 2>/dev/null
+		/usr/bin x=1 local && then echo awk ${HOME} 'quoted text'
+'quoted text' | echo cd awk $(pwd) "$@" && $(pwd)
+	--verbose readonly "$@" grep test cd "$@" test printf
+	| 2>/dev/null && readonly export "$1"
+	&& 'quoted text' cd echo readonly -eu then "$@" "$@"
+	export local local sed && echo
+grep $(pwd) echo done sed cd test "$1" --verbose --verbose readonly
+cd -eu -eu printf -eu readonly && | "$@" echo x=1 $(pwd)
+${HOME} done "$@" then
+	"$1" "$1" readonly export awk echo test "$1"
+		"$1" test printf awk 'quoted text'
+	x=1 'quoted text' printf echo 'quoted text'
+	&& readonly 2>/dev/null readonly
+	--verbose "$1" 'quoted text'
+local --verbose $(pwd) ${HOME} cd cd "$@" local "$1" ${HOME}
+		awk done 2>/dev/null /usr/bin $(pwd) ${HOME} cd "$1" cd then "$@"
+2>/dev/null 'quoted text' | sed echo $(pwd) sed "$@" test
+		&& readonly 2>/dev/null local echo export --verbose done
+	-eu then awk grep test export
+then $(pwd) printf export grep echo -eu | local && "$@" done awk "$1" /usr/bin
+		test "$@" ${HOME} local grep cd printf x=1 local 2>/dev/null "$@" && then x=1
+$(pwd) $(pwd) 'quoted text' "$@" 2>/dev/null --verbose x=1
+	"$@" echo /usr/bin 'quoted text' | 'quoted text' awk /usr/bin done cd
+	sed echo readonly "$@" /usr/bin export 'quoted text'
+--verbose --verbose $(pwd)
+	echo 'quoted text' local done grep echo test $(pwd)
+	printf x=1 echo "$@" && $(pwd) ${HOME}
+--verbose grep cd test test
+awk /usr/bin x=1 "$@" readonly
+		"$1" "$@" awk 2>/dev/null -eu "$@" local | 'quoted text' then x=1 2>/dev/null
+		cd sed sed 2>/dev/null test x=1
+		&& done test -eu sed cd && then $(pwd) then
+		cd done --verbose x=1 ${HOME} 2>/dev/null local --verbose 'quoted text'
+		local test local x=1 awk echo /usr/bin ${HOME} 2>/dev/null sed $(pwd)
+	printf 'quoted text' --verbose readonly ${HOME} local test --verbose printf
+		test ${HOME} awk then 2>/dev/null | readonly awk export
+		grep && cd awk "$1" "$1" sed "$1" test echo
+		grep "$@" test export ${HOME} ${HOME}
+		-eu /usr/bin export export echo && test local
+	${HOME} done printf cd export 2>/dev/null cd && then printf readonly
+		sed echo x=1 local cd --verbose "$1" --verbose /usr/bin /usr/bin "$@"
+	/usr/bin /usr/bin /usr/bin ${HOME} "$@"
+awk "$@" cd $(pwd) grep && /usr/bin
+	'quoted text' done done | "$1" test export test -eu
+	&& export x=1 --verbose local --verbose "$1" cd $(pwd) ${HOME}
+	printf x=1 | && -eu awk -eu | "$1" done && /usr/bin
+		readonly local /usr/bin grep && done echo -eu echo -eu grep x=1 | cd test "$@"
+		then local ${HOME} export "$@" 'quoted text'
+	--verbose done local -eu echo awk ${HOME} "$1" x=1 echo
+grep grep done export done export test | cd x=1 ${HOME}
+		&& local cd 'quoted text' 'quoted text' -eu -eu export then printf
+		x=1 done grep $(pwd)
+echo 2>/dev/null export echo echo && awk echo "$1" echo grep x=1 printf
+	then local /usr/bin test cd "$1" printf readonly | 2>/dev/null awk export
+	cd "$@" awk local readonly awk && /usr/bin --verbose printf
+	&& grep printf export export test sed 2>/dev/null local grep ${HOME} export
+'quoted text' $(pwd) 'quoted text'
+		then 2>/dev/null grep -eu --verbose local
+		--verbose echo readonly "$1" -eu
+	&& local && done --verbose grep 2>/dev/null
+		awk grep done test test /usr/bin
+		sed 'quoted text' readonly 'quoted text'
+		test export done awk done x=1 --verbose 2>/dev/null ${HOME} /usr/bin -eu
+		x=1 awk "$1" done sed grep "$@" ${HOME} "$1" export
+	'quoted text' | done then --verbose "$1" /usr/bin printf
+		| awk --verbose done cd
+	readonly /usr/bin done 2>/dev/null
+		--verbose test export ${HOME} cd ${HOME} done -eu 2>/dev/null then
+$(pwd) then local 2>/dev/null --verbose
+x=1 test test then -eu "$1" --verbose sed "$1" then -eu export local |
+printf local && && then "$1" echo grep -eu x=1 test ${HOME} 'quoted text'
+	grep done printf readonly printf printf awk "$1" ${HOME}
+	-eu done --verbose "$1" echo ${HOME} x=1 && --verbose
+		echo printf x=1 "$1" x=1 "$1" printf x=1 /usr/bin "$1" && /usr/bin $(pwd)
+		2>/dev/null awk test awk done 'quoted text' "$@" test "$1" x=1 $(pwd)
+${HOME} 'quoted text' grep && --verbose $(pwd) "$@" export | "$@" ${HOME} then
+"$1" awk cd cd awk x=1 awk ${HOME}
+/usr/bin x=1 --verbose export && test 'quoted text'
+	&& grep readonly awk test awk awk "$@" "$1"
+		&& ${HOME} sed 'quoted text' sed cd --verbose test export && "$@" grep readonly
+	/usr/bin done && "$1" local printf
+	x=1 --verbose 2>/dev/null grep "$@" test --verbose readonly
+		printf /usr/bin "$@" -eu "$@"
+sed awk test test done awk sed && sed $(pwd)
+		"$1" 'quoted text' /usr/bin export ${HOME} -eu
+	grep cd /usr/bin -eu ${HOME} --verbose && then then export 2>/dev/null
+	-eu cd 'quoted text' local 'quoted text' printf then
+		printf readonly done
+		"$1" x=1 x=1 ${HOME} 'quoted text' done cd awk
+2>/dev/null -eu grep "$1" "$1" test | "$1" ${HOME} $(pwd)
+	cd | ${HOME} --verbose "$1" grep test echo 2>/dev/null export
+test done x=1 printf 2>/dev/null
+	&& echo echo 2>/dev/null 'quoted text' echo printf printf done local sed
+	readonly test cd test export sed done 2>/dev/null -eu 'quoted text'
+	cd 2>/dev/null ${HOME}
+	--verbose -eu awk done --verbose grep done 2>/dev/null | --verbose test
+sed echo awk ${HOME} grep sed
+		-eu printf then printf -eu "$@" --verbose $(pwd) export ${HOME} printf
+		echo echo sed readonly echo echo "$1"
+awk 2>/dev/null ${HOME} cd x=1 readonly
+	${HOME} -eu grep done readonly done readonly
+		"$@" done test 2>/dev/null export test export x=1 -eu then | && ${HOME} $(pwd)
+export 2>/dev/null printf
+		--verbose 'quoted text' grep printf --verbose
+--verbose && grep done then 'quoted text' /usr/bin
+	$(pwd) "$1" $(pwd) sed then -eu ${HOME} echo awk
+		test 2>/dev/null /usr/bin | "$1"
+| --verbose test awk cd 2>/dev/null export --verbose
+then readonly ${HOME} --verbose echo readonly "$@" "$@"
+/usr/bin then sed -eu $(pwd) x=1 sed && printf x=1 'quoted text'
+		"$@" cd && cd done done && 'quoted text' done $(pwd)
+		printf $(pwd) sed "$1" echo 'quoted text' x=1 -eu -eu readonly /usr/bin
+	readonly export $(pwd) grep 2>/dev/null --verbose grep export sed
+		--verbose | printf ${HOME} -eu readonly 2>/dev/null printf
+	test then --verbose grep local then done 'quoted text' x=1 then awk local printf
+		test printf --verbose sed 'quoted text' local "$1" x=1 2>/dev/null 'quoted text'
+		sed -eu 2>/dev/null ${HOME}
+&& | 2>/dev/null 'quoted text' /usr/bin && local awk grep --verbose
+	| "$@" --verbose ${HOME} "$@" "$1" --verbose printf test $(pwd)
+-eu 'quoted text' "$1" sed 'quoted text' export | printf /usr/bin export 2>/dev/null
+		2>/dev/null then export ${HOME} sed | 2>/dev/null "$@" then &&
+		cd && /usr/bin 2>/dev/null awk grep echo
+		awk 'quoted text' 2>/dev/null then ${HOME}
+		local echo local /usr/bin $(pwd) && readonly && 2>/dev/null printf test ${HOME}
+cd "$1" "$@" x=1 2>/dev/null done export "$1" then cd local printf 2>/dev/null
+"$1" grep -eu ${HOME}
+| awk -eu printf $(pwd) && /usr/bin
+	"$1" $(pwd) -eu 2>/dev/null
+		export test 'quoted text' echo 'quoted text' then
+echo "$@" /usr/bin -eu done x=1 awk 'quoted text' cd cd --verbose
+		awk echo /usr/bin done | sed readonly -eu 2>/dev/null
+		| readonly x=1 awk readonly
+printf && 2>/dev/null | echo grep x=1 printf grep
+echo 2>/dev/null --verbose then awk -eu
+		| then -eu --verbose -eu ${HOME} cd x=1 "$1" 2>/dev/null export grep then test
+	printf printf "$1" "$1" then echo sed test
+	cd /usr/bin $(pwd) 'quoted text' readonly | x=1
+	awk echo then grep 'quoted text'
+		"$@" -eu | 'quoted text' ${HOME} --verbose grep printf awk awk -eu local
+		export readonly cd /usr/bin 'quoted text'
+		grep readonly printf 'quoted text' x=1
+		$(pwd) x=1 export ${HOME} echo grep test cd "$@" ${HOME}
+		'quoted text' --verbose echo ${HOME} --verbose cd printf sed "$1" then 2>/dev/null
+	--verbose printf | cd awk printf 'quoted text' cd $(pwd) export awk
+	x=1 2>/dev/null --verbose "$1" 2>/dev/null
+	printf sed -eu readonly export test "$1" local test printf "$@"
+	test x=1 test printf -eu sed 2>/dev/null done --verbose
+readonly ${HOME} $(pwd) "$@" printf ${HOME}
+		/usr/bin ${HOME} cd --verbose "$1" "$1" "$@" grep
+&& | local | grep readonly awk --verbose then --verbose ${HOME} export
+		test grep | /usr/bin "$@" printf "$@" ${HOME} ${HOME}
+awk $(pwd) "$@" && echo 2>/dev/null -eu cd "$@" x=1 then readonly echo awk x=1
+	&& cd printf echo export echo then grep test test then
+	/usr/bin local x=1 test 'quoted text' /usr/bin done && -eu 'quoted text' sed "$@"
+	&& -eu grep local /usr/bin "$@"
+	done readonly 'quoted text' "$@"
+		"$@" sed $(pwd) sed awk then export 'quoted text'
+	/usr/bin cd then cd done test 2>/dev/null
+		echo readonly readonly export sed sed ${HOME} local
+	done --verbose done -eu done
+	-eu ${HOME} x=1 done /usr/bin | 2>/dev/null "$@" readonly 'quoted text' 2>/dev/null
+awk x=1 readonly -eu
+	awk | x=1 test 'quoted text' local -eu $(pwd) "$@" x=1 $(pwd)
+cd "$1" /usr/bin awk x=1 export
+&& local /usr/bin cd
+		2>/dev/null printf --verbose local local awk local
+	&& sed -eu 'quoted text' readonly
+&& awk echo sed done then -eu done
+	grep 2>/dev/null && readonly test then 2>/dev/null "$1"
+	'quoted text' test "$1" grep local test $(pwd) test test
+		readonly sed export awk sed cd -eu done then cd then x=1 readonly
+cd cd $(pwd) readonly 2>/dev/null -eu test -eu grep x=1 x=1 local readonly &&
+	done | | export echo echo awk | export "$1" local echo /usr/bin 2>/dev/null
+		--verbose grep | /usr/bin 2>/dev/null -eu export | /usr/bin
+	printf then awk then $(pwd) x=1 awk cd export done
+	test printf $(pwd) grep && "$1" readonly "$1" cd readonly
+		readonly ${HOME} "$@" 2>/dev/null | awk --verbose cd $(pwd)
+		sed $(pwd) --verbose awk -eu export echo cd awk
+	${HOME} $(pwd) -eu "$1" done test ${HOME} sed cd -eu cd then done
+		test grep --verbose "$1" "$@" awk
+	${HOME} readonly "$1" echo awk 'quoted text' ${HOME} "$@" 'quoted text' cd && "$1"
+		awk /usr/bin local "$@"
+	-eu printf sed /usr/bin --verbose "$1" x=1 printf
+2>/dev/null awk "$@" local
+done export export local grep awk && 'quoted text' | && /usr/bin sed
+	then readonly echo echo 2>/dev/null -eu "$@" "$1"
+		"$1" echo sed --verbose | -eu cd awk printf local $(pwd) ${HOME} awk sed x=1
+x=1 $(pwd) "$@" printf x=1 readonly export | echo /usr/bin echo
+${HOME} awk readonly "$1" "$@" |
+		"$@" -eu $(pwd) "$@" printf "$@" | | 'quoted text' 'quoted text' test 'quoted text'
+	"$1" awk grep echo "$@" printf readonly
+	$(pwd) && local "$1" test "$@" printf x=1 "$@"
+	done -eu test /usr/bin -eu echo printf then x=1
+echo test printf x=1 cd export
+	awk "$1" /usr/bin echo readonly
+	$(pwd) x=1 $(pwd) local && -eu done $(pwd) -eu $(pwd) then && ${HOME} printf
+		x=1 && done ${HOME} --verbose done
+$(pwd) cd 2>/dev/null awk then cd sed && x=1
+done "$@" 2>/dev/null done local /usr/bin 2>/dev/null $(pwd) export sed test local
+		-eu local /usr/bin ${HOME} ${HOME} -eu
+		"$@" "$1" -eu printf && 2>/dev/null x=1 printf x=1 "$1" -eu
+		printf echo "$@" grep local "$1" --verbose test $(pwd) "$@" 2>/dev/null
+sed x=1 -eu ${HOME} -eu done && 2>/dev/null printf 2>/dev/null cd echo grep
+${HOME} awk printf echo local ${HOME}
+		"$1" 2>/dev/null ${HOME} | echo --verbose -eu 'quoted text' grep $(pwd) echo
+	done -eu awk 2>/dev/null
+	awk sed export 'quoted text' test test /usr/bin
+		echo then then local && readonly $(pwd)
+	then readonly /usr/bin 'quoted text' printf && &&
+	export ${HOME} readonly test x=1 'quoted text' $(pwd) local
+	--verbose readonly readonly --verbose export printf done --verbose --verbose
+		-eu sed echo readonly printf then
+$(pwd) awk export && ${HOME} export -eu local --verbose done x=1 echo
+| $(pwd) | 2>/dev/null $(pwd)
+	$(pwd) 2>/dev/null cd /usr/bin "$1" | local awk
+	--verbose --verbose echo --verbose
+	--verbose x=1 printf test
+"$@" x=1 done grep && echo then awk $(pwd) sed && && "$1" export 'quoted text'
+x=1 "$@" 2>/dev/null grep readonly $(pwd) sed --verbose
+	grep /usr/bin 2>/dev/null "$1" local then grep x=1 2>/dev/null 'quoted text'
+	${HOME} ${HOME} -eu --verbose echo sed "$@" x=1 readonly done 2>/dev/null
+'quoted text' --verbose 2>/dev/null
+	2>/dev/null "$@" ${HOME} done -eu $(pwd) -eu
+	"$1" cd x=1 | awk ${HOME} "$@" then "$1" $(pwd) 'quoted text' ${HOME}
+	awk printf --verbose awk printf $(pwd)
+	printf sed printf "$@" cd "$@" --verbose export sed sed cd
+'quoted text' $(pwd) ${HOME} 2>/dev/null done
+	/usr/bin 'quoted text' $(pwd) && sed && echo
+	local done echo cd awk && local
+printf then test echo && x=1 2>/dev/null cd printf "$1" export
+		'quoted text' "$@" --verbose
+echo grep "$1" | readonly -eu && /usr/bin "$1" grep
+	${HOME} printf sed /usr/bin cd 'quoted text' "$@"
+	2>/dev/null -eu && echo sed cd ${HOME} "$1"
+	printf 2>/dev/null "$@" /usr/bin /usr/bin $(pwd) 2>/dev/null --verbose
+	"$1" sed --verbose --verbose
+	${HOME} export test export cd sed | awk 'quoted text' && &&
+"$@" then awk $(pwd) -eu
+	then 2>/dev/null grep test "$1" /usr/bin
+done ${HOME} ${HOME} -eu | && cd local
+		echo "$@" 2>/dev/null | --verbose printf local sed readonly local | && -eu echo
+awk grep export $(pwd) done 2>/dev/null local -eu --verbose sed echo cd
+		--verbose 'quoted text' && grep --verbose sed cd sed -eu test
+	"$@" "$1" printf ${HOME} "$1" /usr/bin --verbose printf done
+	awk x=1 readonly local export readonly local
+$(pwd) done --verbose $(pwd) "$1" 'quoted text' printf 'quoted text' printf
+	grep test sed export && $(pwd)
+		"$1" sed awk readonly x=1 -eu "$1" "$1" "$@"
+		done x=1 /usr/bin && x=1 sed
+--verbose echo readonly ${HOME} sed -eu grep ${HOME} grep $(pwd)
+	sed local && 'quoted text' export printf 2>/dev/null "$1"
+		"$@" 2>/dev/null sed /usr/bin $(pwd)
+readonly -eu export echo done grep ${HOME} cd test
+		done readonly ${HOME} -eu
+		| then -eu printf $(pwd) /usr/bin -eu local ${HOME}
+		"$@" sed sed done ${HOME} /usr/bin done
+		done x=1 --verbose awk --verbose printf 'quoted text' 2>/dev/null then
+	x=1 printf && grep echo --verbose x=1 printf $(pwd)
+	done grep printf grep cd echo then local
+cd local then /usr/bin grep printf ${HOME} 'quoted text'
+		cd printf /usr/bin grep sed export
+	sed test --verbose x=1 /usr/bin sed test ${HOME}
+then export ${HOME} local /usr/bin sed
+	| "$1" /usr/bin ${HOME} sed
+| sed awk && "$@" test --verbose "$1" cd --verbose
+	grep echo local ${HOME} --verbose --verbose cd 2>/dev/null ${HOME} "$1"
+then echo | && --verbose local cd && "$@" "$@" echo 'quoted text'
+	local readonly then && sed local local
+	awk echo local export done "$@" readonly grep done -eu test
+x=1 --verbose "$1" test -eu test done
+	'quoted text' ${HOME} /usr/bin -eu cd "$1" test /usr/bin sed
+		readonly test export echo ${HOME} cd awk
+		'quoted text' readonly "$@"
+		| printf cd && done test
+	"$1" "$@" done x=1 /usr/bin ${HOME} -eu cd ${HOME} 2>/dev/null
+	x=1 echo awk readonly export awk 2>/dev/null
+2>/dev/null /usr/bin export readonly $(pwd) done $(pwd) && x=1 /usr/bin "$@" readonly
+#include c215.sh
+&& 2>/dev/null then awk && test printf /usr/bin
+$(pwd) 'quoted text' 'quoted text' readonly
+${HOME} --verbose 2>/dev/null cd done local test && 'quoted text' done -eu
+--verbose printf "$1" | sed cd -eu local test
+'quoted text' test "$1"
+	$(pwd) sed 2>/dev/null printf awk done
+		test awk "$1" cd local cd 2>/dev/null
+		printf grep x=1 $(pwd) 'quoted text' readonly
+	x=1 test $(pwd) printf cd && "$@" cd
+	sed 2>/dev/null cd readonly 2>/dev/null grep --verbose printf echo $(pwd) "$@"
+		printf "$1" && done cd readonly cd "$1" ${HOME}
+$(pwd) printf printf "$1" --verbose
+	$(pwd) then export "$1" grep /usr/bin sed then "$1" sed
+	grep printf printf readonly && done ${HOME} grep && test cd local && /usr/bin
+printf /usr/bin --verbose -eu local test then echo export export
+	x=1 'quoted text' 2>/dev/null --verbose local -eu -eu $(pwd) --verbose
+	2>/dev/null | $(pwd) export
+${HOME} "$1" "$1" then 'quoted text' then export x=1 readonly
+	--verbose | awk readonly "$@" | awk
+	-eu ${HOME} -eu awk then ${HOME} --verbose cd grep sed
+		-eu "$@" local /usr/bin printf local -eu export
+		local then && grep x=1
+		"$@" "$1" sed $(pwd) awk "$@" done awk readonly cd
+'quoted text' "$@" then then echo
+$(pwd) echo -eu readonly done printf && 'quoted text' x=1 2>/dev/null
+	export --verbose local printf grep --verbose
+grep printf -eu export -eu $(pwd) export test /usr/bin export
+	awk local /usr/bin then | awk
+/usr/bin echo then -eu --verbose
+		x=1 "$1" 'quoted text'
+printf 2>/dev/null readonly --verbose
+done "$@" echo ${HOME} -eu cd /usr/bin local awk
+	echo -eu readonly export sed -eu printf local echo ${HOME} test $(pwd) -eu readonly
+${HOME} cd "$1" export "$@" "$1" cd 2>/dev/null test 2>/dev/null
+	--verbose 2>/dev/null --verbose then 'quoted text'
+	awk awk done /usr/bin /usr/bin
+&& -eu done $(pwd) grep "$1" printf
+echo ${HOME} local -eu then
+	grep awk printf sed --verbose
+		done grep awk test && echo -eu -eu sed 2>/dev/null
+		x=1 printf "$@" x=1 /usr/bin cd readonly --verbose 2>/dev/null
+	| $(pwd) ${HOME} export x=1 cd ${HOME} export done done awk readonly
+	"$1" local $(pwd) "$1" /usr/bin echo 'quoted text'
+		export x=1 "$1" 2>/dev/null done echo $(pwd) "$@" echo -eu
+	sed /usr/bin | $(pwd) ${HOME} x=1 echo && | readonly export ${HOME} | 'quoted text'
+		done readonly $(pwd) $(pwd) grep local x=1 done
+	-eu 2>/dev/null printf grep printf awk x=1 cd test -eu grep "$@" $(pwd) --verbose
+		"$@" "$@" sed readonly "$1" "$@" "$@" export done test
+		test "$@" /usr/bin then awk echo 'quoted text'
+	"$@" echo -eu ${HOME} -eu 2>/dev/null
+	2>/dev/null 'quoted text' cd "$@" --verbose
+		"$1" export done awk | -eu echo local test cd sed
+--verbose x=1 then awk printf sed local 2>/dev/null
+	echo grep readonly $(pwd) ${HOME} cd ${HOME} -eu --verbose echo "$@" local
+	local 2>/dev/null 2>/dev/null && test test printf
+		"$1" $(pwd) export /usr/bin /usr/bin export echo
+awk then $(pwd) 2>/dev/null --verbose cd then | awk -eu ${HOME}
+"$@" 'quoted text' &&
+2>/dev/null "$1" then $(pwd) /usr/bin printf export local then then sed
+grep printf sed done done ${HOME} "$1" grep test ${HOME} x=1 echo "$@" "$@"
+		done readonly sed awk then printf $(pwd)
+		cd "$@" local "$@" then
+done then "$@" 'quoted text' then readonly
+	readonly export -eu echo "$@" $(pwd)
+local "$1" && | local export "$1" export
+printf echo readonly $(pwd) && ${HOME} done printf /usr/bin &&
+done echo ${HOME} awk --verbose printf -eu 2>/dev/null echo ${HOME}
+"$@" done ${HOME} ${HOME} --verbose readonly awk sed "$1" "$1" grep $(pwd) export
+		'quoted text' /usr/bin --verbose readonly && grep awk "$1"
+	grep -eu echo "$1" local local cd test
+	readonly test grep | awk | local /usr/bin
+	-eu "$@" | /usr/bin -eu
+2>/dev/null | --verbose done printf awk test 2>/dev/null /usr/bin echo grep echo
+	'quoted text' x=1 -eu && grep /usr/bin ${HOME} x=1
+	readonly 2>/dev/null "$@" ${HOME} ${HOME} then $(pwd)
+		"$@" | readonly awk "$@" -eu 'quoted text'
+| "$@" ${HOME} export then test /usr/bin grep cd cd -eu readonly grep awk
+	-eu grep grep readonly export
+/usr/bin awk /usr/bin $(pwd) && | then --verbose $(pwd) printf && x=1
+		local then local $(pwd) test local x=1 test 2>/dev/null
+		printf printf sed | cd --verbose /usr/bin "$@" echo "$@" done "$@"
+		"$1" 'quoted text' /usr/bin echo -eu x=1 cd "$1" 2>/dev/null /usr/bin --verbose
+	then grep x=1 "$@" && 'quoted text' x=1
+		cd -eu grep 2>/dev/null test cd "$1" awk x=1 local readonly
+done printf ${HOME} 2>/dev/null -eu 'quoted text'
+test x=1 export -eu 2>/dev/null local
+	--verbose | printf && printf && ${HOME} export x=1 cd export
+		awk local then -eu 'quoted text' && /usr/bin "$1" sed -eu printf &&
+	sed $(pwd) echo done ${HOME} test "$1" readonly echo export 2>/dev/null then ${HOME}
+	done grep x=1 --verbose then sed done x=1 local cd local "$@" 'quoted text' &&
+		export echo echo test ${HOME} && printf
+		x=1 export && grep then then --verbose
+		"$@" && /usr/bin 'quoted text' cd done && readonly
+		$(pwd) export | local "$1" then /usr/bin
+		cd sed | -eu $(pwd) test -eu cd then sed x=1 grep then 2>/dev/null
+/usr/bin echo awk printf grep $(pwd) done --verbose | 2>/dev/null
+--verbose cd ${HOME} export "$@" 2>/dev/null printf
+		| x=1 export test then "$@" -eu $(pwd) 'quoted text'
+&& ${HOME} ${HOME} export "$@" 'quoted text' x=1 2>/dev/null
+		"$@" sed "$1" /usr/bin -eu awk
+		-eu 'quoted text' grep done export awk done then 2>/dev/null cd readonly
+		printf $(pwd) then printf cd | done awk cd
+-eu "$@" $(pwd) grep x=1 /usr/bin awk | x=1 x=1 printf x=1 -eu local awk
+	printf $(pwd) export $(pwd) local done "$@"
+		sed export -eu x=1 cd 2>/dev/null
+-eu x=1 ${HOME} test test "$1"
+		| export cd cd test --verbose /usr/bin awk done /usr/bin "$1" && "$1" &&
+/usr/bin --verbose 2>/dev/null && x=1 sed awk $(pwd)
+export awk awk 2>/dev/null
+		'quoted text' test 2>/dev/null && export
+cd $(pwd) | | then && ${HOME} $(pwd) test test test local readonly
+sed -eu 2>/dev/null awk test sed
+cd echo readonly readonly grep $(pwd) /usr/bin
+	test sed echo -eu /usr/bin done printf 'quoted text'
+then "$1" grep | local ${HOME} export grep cd local -eu then x=1
+--verbose 2>/dev/null readonly then done awk -eu test test done grep |
+then -eu --verbose x=1 ${HOME} -eu ${HOME} x=1 | cd 'quoted text'
+		local grep 'quoted text' echo ${HOME} | "$@"
+		sed cd export && export
+then 2>/dev/null 2>/dev/null "$1" echo grep -eu awk -eu sed -eu done $(pwd)
+	--verbose "$1" awk readonly export -eu
+readonly printf x=1 then cd cd && && --verbose 'quoted text' then
+		export -eu ${HOME} echo export ${HOME} /usr/bin "$@" x=1
+	readonly -eu sed then cd export then $(pwd) ${HOME} && x=1 test ${HOME}
+'quoted text' "$@" done 2>/dev/null
+	| "$1" done && grep grep sed $(pwd)
+		done grep test export ${HOME} x=1 "$1" x=1 x=1 "$1"
+	--verbose test echo export done "$1" done /usr/bin
+	-eu sed printf "$@" done 'quoted text' ${HOME} ${HOME}
+	echo readonly awk cd readonly test "$1" 2>/dev/null
+-eu done done grep "$@" ${HOME} done "$1" $(pwd)
+	sed -eu local test -eu $(pwd) export
+"$1" /usr/bin /usr/bin printf export test sed "$@" grep grep $(pwd) 2>/dev/null
+	&& -eu x=1 && awk local | | echo printf grep 'quoted text'
+	x=1 local test export grep "$@" grep
+		local -eu sed 'quoted text' --verbose
+		-eu | local 2>/dev/null "$1" awk | local sed 'quoted text'
+	echo 2>/dev/null grep echo local done --verbose | $(pwd) echo test x=1
+	then 'quoted text' sed test then /usr/bin awk --verbose cd ${HOME} /usr/bin
+	printf | && cd export grep local done --verbose ${HOME} awk 'quoted text'
+	x=1 readonly "$@" 2>/dev/null x=1 echo && 'quoted text' done -eu done printf
+		test done | && echo done /usr/bin readonly then local done awk done $(pwd) local
+x=1 'quoted text' sed /usr/bin echo /usr/bin test
+		echo local cd printf x=1 test ${HOME} awk printf ${HOME}
+	export awk "$@" -eu export "$1" echo x=1 then grep done echo "$@" cd readonly
+		/usr/bin awk done readonly 'quoted text' ${HOME} sed printf "$1" 2>/dev/null
+		grep ${HOME} 'quoted text' 'quoted text' grep awk x=1
+	sed cd then done -eu && | 'quoted text' export ${HOME}
+	then $(pwd) -eu export export ${HOME} |
+done grep printf readonly $(pwd) ${HOME} 'quoted text' sed printf
+		then printf ${HOME} readonly grep && 'quoted text' test | test awk "$@"
+		cd --verbose x=1 "$@" ${HOME} --verbose "$1" $(pwd) then export
+		--verbose "$1" then readonly "$1" -eu x=1 cd sed x=1 test -eu echo
+"$@" 2>/dev/null 2>/dev/null
+		/usr/bin test x=1 x=1 | export
+&& echo 'quoted text' /usr/bin
+		grep | 'quoted text' grep 'quoted text' echo
+	local "$@" /usr/bin then sed echo awk "$1"
+	awk -eu x=1 echo sed 2>/dev/null
+	2>/dev/null echo && x=1 /usr/bin
+		${HOME} -eu 'quoted text' "$1" readonly /usr/bin
+'quoted text' cd local then test x=1 export --verbose done --verbose
+	test "$@" -eu x=1 "$1" local $(pwd)
+"$@" 'quoted text' && sed then "$@" 2>/dev/null
+grep local /usr/bin 2>/dev/null
+		cd "$1" export local echo
+		sed grep /usr/bin echo /usr/bin echo ${HOME} 'quoted text' then | "$1" 'quoted text'
+		"$1" 'quoted text' local ${HOME} printf --verbose | sed done grep -eu $(pwd) &&
+cd grep ${HOME} awk done x=1 local echo test --verbose test local
+		--verbose awk /usr/bin awk ${HOME} ${HOME} "$1" local && then "$1" sed cd 'quoted text'
+echo printf | then --verbose then | local grep &&
+	$(pwd) export "$1" awk
+		--verbose ${HOME} printf 'quoted text' printf printf "$1" grep "$1" 'quoted text'
+readonly done 2>/dev/null 2>/dev/null
+-eu --verbose export ${HOME} /usr/bin test done && /usr/bin printf
+cd $(pwd) -eu ${HOME} 'quoted text' && done echo 2>/dev/null sed sed printf
+&& sed 2>/dev/null ${HOME} && | cd grep
+"$1" readonly && && && echo "$@" 'quoted text'
+		'quoted text' then --verbose
+	"$@" | 'quoted text' --verbose -eu -eu "$@" /usr/bin
+"$1" -eu awk "$1" then /usr/bin "$1" awk 2>/dev/null then test cd ${HOME}
+	local echo cd export --verbose 'quoted text' | then "$1" cd && | "$@"
+'quoted text' -eu grep -eu 'quoted text' $(pwd) && echo 2>/dev/null
+		echo printf sed local export $(pwd) x=1 done readonly
+| | then then 2>/dev/null cd $(pwd) --verbose readonly x=1 printf
+	"$@" echo /usr/bin --verbose sed 2>/dev/null
+		$(pwd) echo "$@" | done /usr/bin 2>/dev/null x=1 -eu $(pwd) "$1" && | done
+	printf | readonly ${HOME} /usr/bin echo done
+	&& sed printf printf sed printf
+	local test sed grep 2>/dev/null
+	local | cd x=1 then -eu
+	| awk 2>/dev/null readonly awk
+		export /usr/bin then | ${HOME} local 2>/dev/null "$1" done
+2>/dev/null sed sed awk test && printf readonly sed --verbose $(pwd) awk readonly
+	| readonly 'quoted text' test 'quoted text' then | "$@" printf test then -eu
+	$(pwd) $(pwd) export cd ${HOME} readonly 'quoted text' echo
+		"$1" echo 2>/dev/null $(pwd) $(pwd) -eu test "$@" | $(pwd)
+	--verbose x=1 'quoted text' readonly
+	x=1 x=1 -eu x=1 then ${HOME} "$@" echo readonly readonly
+	-eu -eu cd local $(pwd) readonly "$1" 'quoted text'
+	done --verbose printf printf echo local "$@" cd | awk "$@" readonly 'quoted text'
+	"$@" 2>/dev/null awk ${HOME} local 2>/dev/null
+printf test cd 2>/dev/null export local awk test && readonly
+	test -eu then && export x=1 sed test
+		&& done printf export /usr/bin 'quoted text' ${HOME} sed
+	'quoted text' x=1 export then cd "$1" grep && x=1 echo x=1 export echo
+readonly | export "$1" echo /usr/bin && "$1" ${HOME} "$@"
+		"$1" done $(pwd) --verbose --verbose
+"$1" local /usr/bin readonly export "$1" $(pwd) "$@" export
+done echo sed $(pwd) done readonly done 2>/dev/null "$1" /usr/bin done | -eu printf
+		printf sed /usr/bin then 'quoted text' export
+"$1" done sed && /usr/bin test $(pwd) $(pwd) then
+-eu 'quoted text' printf then sed cd "$@" "$1" $(pwd) x=1 then $(pwd)
+	/usr/bin x=1 then --verbose x=1 sed export
+printf then awk "$@"
+		/usr/bin | -eu sed awk awk
+| then "$1" grep done sed awk "$@"
+&& readonly export | sed cd "$@" cd && then echo && cd 2>/dev/null
+/usr/bin "$1" done printf ${HOME} 'quoted text'
+		printf -eu echo grep x=1 grep /usr/bin x=1 x=1 $(pwd) printf
+	cd "$@" awk export readonly export --verbose printf printf $(pwd)
+		echo 'quoted text' -eu 2>/dev/null
+readonly $(pwd) x=1 $(pwd) 2>/dev/null grep done
+		'quoted text' export "$@" awk ${HOME}
+cd $(pwd) done x=1 sed "$1" awk readonly "$@" "$1"
+		| $(pwd) then "$@" --verbose then
+		sed test ${HOME} /usr/bin export && "$@" ${HOME} --verbose
+sed 2>/dev/null readonly
+$(pwd) --verbose "$@" echo 2>/dev/null "$@" 'quoted text'
+		then --verbose then awk 'quoted text' awk "$@"
+	2>/dev/null echo printf x=1 "$1" -eu cd
+		-eu 2>/dev/null printf "$1" grep -eu echo local ${HOME} sed echo local then
+then grep sed done | "$@" grep 'quoted text' $(pwd)
+	test ${HOME} local && cd printf -eu "$@" local done export printf export export
+${HOME} -eu awk then printf then $(pwd)
+'quoted text' | awk /usr/bin x=1 sed done grep export
+	grep $(pwd) test && readonly 2>/dev/null
+	local -eu test local --verbose | /usr/bin "$@" readonly
+		awk | -eu test readonly local "$1" printf printf "$1" ${HOME} test test 'quoted text'
+		echo local | ${HOME} readonly && ${HOME} readonly --verbose -eu sed 'quoted text'
+	"$1" ${HOME} 2>/dev/null 'quoted text' 2>/dev/null done -eu
+		x=1 sed $(pwd) ${HOME} ${HOME}
+	| | readonly readonly 'quoted text' done then sed 'quoted text'
+		&& | local --verbose grep local -eu
+awk x=1 --verbose sed awk cd $(pwd) cd 'quoted text' "$1" "$@"
+		"$1" echo done local grep readonly printf
+readonly awk local done x=1 then "$@" --verbose $(pwd) then
+	test test --verbose "$@" "$1"
+	--verbose && 'quoted text' /usr/bin x=1
+local echo /usr/bin "$1" sed $(pwd)
+		x=1 awk /usr/bin | -eu export
+		/usr/bin echo /usr/bin && "$1"
+		${HOME} awk 'quoted text' x=1 sed x=1 --verbose -eu 2>/dev/null
+		${HOME} "$1" 'quoted text' -eu && --verbose echo &&
+	awk ${HOME} && local -eu test "$@" "$1"
+		test printf done /usr/bin awk x=1
+	"$1" then -eu ${HOME} done && "$@" test echo readonly --verbose local
+	then "$@" 'quoted text' x=1 cd sed "$@" 'quoted text' x=1 local |
+		cd -eu $(pwd) 2>/dev/null then sed local ${HOME}
+		&& "$@" 'quoted text' "$@" sed readonly then 'quoted text'
+readonly then "$1" then --verbose printf then printf 2>/dev/null -eu $(pwd)
+		"$@" && ${HOME} x=1 grep echo $(pwd) grep printf x=1 grep ${HOME} $(pwd) 'quoted text'
+	cd "$@" then cd grep sed x=1 echo $(pwd) grep | done readonly x=1 x=1 2>/dev/null
+		done 2>/dev/null 'quoted text' "$1" awk
+-eu /usr/bin printf export then awk echo then --verbose "$@" ${HOME}
+		x=1 test ${HOME} | "$@" $(pwd) &&
+		--verbose 'quoted text' 2>/dev/null ${HOME} $(pwd) --verbose --verbose
+		test echo awk echo ${HOME} && sed
+	-eu ${HOME} sed ${HOME} $(pwd) "$1" export then
+	test export | export readonly | | echo cd --verbose
+	$(pwd) awk awk export $(pwd) echo test export readonly x=1 /usr/bin
+		${HOME} local then --verbose
+/usr/bin $(pwd) grep
+grep cd cd then local -eu done "$@"
+	| 2>/dev/null "$@" "$1" grep 2>/dev/null local 'quoted text' echo readonly then
+	"$1" done /usr/bin test --verbose export x=1 "$@" "$1" printf printf grep -eu
+	x=1 --verbose export $(pwd)
+		sed then && awk 'quoted text' done awk --verbose cd | --verbose
+	--verbose test | 2>/dev/null grep printf 2>/dev/null cd test
+		then done "$1" ${HOME} sed then export
+	local local ${HOME} readonly && test "$@" --verbose "$1" "$1" ${HOME} done
+		"$1" test /usr/bin local | ${HOME} grep "$1" cd $(pwd) cd --verbose
+--verbose 'quoted text' 'quoted text'
+&& sed export "$@" then --verbose awk sed /usr/bin sed
+		--verbose --verbose export --verbose echo 2>/dev/null 'quoted text'
+"$1" 2>/dev/null --verbose -eu | /usr/bin
+	readonly "$@" sed local && -eu echo done && | readonly 2>/dev/null
+	export | readonly -eu "$1" done printf "$@" grep 2>/dev/null readonly x=1
+-eu 'quoted text' "$1" sed "$1" awk x=1 local echo 2>/dev/null sed
+local "$@" readonly $(pwd) export -eu "$@" x=1 x=1 grep cd cd /usr/bin local
+awk 'quoted text' readonly /usr/bin
+	'quoted text' ${HOME} 'quoted text'
+		local echo echo export cd awk cd done -eu "$1" -eu echo echo
+		then then --verbose readonly export grep -eu |
+		export readonly echo | grep sed test then --verbose then
+	echo local awk grep -eu
+"$@" "$1" local | "$@" &&
+		| echo x=1 sed x=1 $(pwd) export x=1 export 'quoted text' -eu readonly
+		| $(pwd) echo cd export
+	${HOME} sed then local test "$1" "$@" "$@" x=1 export test echo printf && 2>/dev/null
+sed x=1 'quoted text' done "$1" "$1" awk $(pwd) &&
+readonly $(pwd) $(pwd) sed readonly 'quoted text'
+		printf readonly sed cd && |
+		echo local ${HOME} sed test -eu /usr/bin
+/usr/bin /usr/bin local x=1 grep && --verbose echo ${HOME} export grep | sed then
+		done awk $(pwd) sed echo x=1 cd 'quoted text' "$@" echo | done $(pwd)
+		local 'quoted text' x=1 x=1 awk $(pwd) 'quoted text' cd sed sed readonly "$@"
+	&& -eu /usr/bin local export
+2>/dev/null 'quoted text' x=1 -eu 2>/dev/null x=1 /usr/bin awk grep
+export echo 'quoted text'
+local printf -eu 'quoted text' grep 'quoted text' sed
+		-eu awk 'quoted text' cd | readonly $(pwd) then awk && "$1"
+grep "$1" local awk sed "$1" /usr/bin
+	then readonly ${HOME} --verbose done 2>/dev/null "$1" /usr/bin cd &&
+		printf cd /usr/bin /usr/bin done 2>/dev/null then echo -eu 'quoted text'
+		&& x=1 "$1" 'quoted text'
+	| ${HOME} echo ${HOME}
+	echo then $(pwd) echo x=1 printf -eu | x=1 && 2>/dev/null then local -eu local
+"$@" "$@" -eu then local && 2>/dev/null && && && "$1" "$1" readonly
+	&& | printf echo grep export --verbose test echo /usr/bin printf
+	"$1" readonly | grep done "$@" "$@" then then
+	/usr/bin local grep sed && export && printf $(pwd) local -eu
+	grep | ${HOME} grep local --verbose x=1 grep
+		export grep 2>/dev/null export 'quoted text' "$1" awk then printf x=1 export done
+printf readonly echo 'quoted text' test done ${HOME} -eu grep 'quoted text'
+		2>/dev/null x=1 then sed ${HOME} ${HOME} echo "$@" &&
+		-eu then 2>/dev/null -eu | local grep done
+	"$@" test sed then echo test 2>/dev/null 2>/dev/null test | echo
+&& cd $(pwd) echo -eu --verbose local
+	x=1 echo --verbose x=1 -eu
+		2>/dev/null grep test printf --verbose && export ${HOME} x=1 grep
+	echo "$@" -eu local local ${HOME} cd done local && --verbose grep x=1 readonly
+echo local "$@" "$1" -eu /usr/bin 2>/dev/null test | 'quoted text'
+	sed 2>/dev/null "$1" then sed /usr/bin -eu 2>/dev/null echo 2>/dev/null | 'quoted text'
+		export ${HOME} ${HOME} ${HOME} readonly "$1" done /usr/bin
+		local local | cd --verbose -eu 2>/dev/null grep /usr/bin /usr/bin
+		${HOME} awk echo /usr/bin printf $(pwd) cd | 2>/dev/null
+		sed ${HOME} -eu "$1" && 'quoted text' echo awk $(pwd)
+--verbose echo $(pwd) /usr/bin "$1" "$@" "$@" echo sed "$1" -eu echo
+	-eu cd local 2>/dev/null -eu --verbose
+	done "$@" x=1 ${HOME} 2>/dev/null
+&& && 2>/dev/null grep done cd ${HOME} /usr/bin ${HOME} /usr/bin -eu
+export 'quoted text' x=1 readonly && -eu
+"$1" awk cd readonly export /usr/bin ${HOME} export -eu 2>/dev/null
+		awk --verbose $(pwd) | 'quoted text' readonly awk printf
+	| --verbose "$1" then $(pwd)
+	${HOME} export 2>/dev/null cd cd echo export 'quoted text' test
+	${HOME} "$1" /usr/bin 2>/dev/null -eu export -eu 2>/dev/null
+-eu awk local grep /usr/bin done "$@" --verbose
+		"$1" printf sed echo -eu /usr/bin
+	then readonly awk | /usr/bin 2>/dev/null 2>/dev/null
+		"$1" printf local local sed | echo printf && ${HOME} x=1 /usr/bin readonly
+then x=1 test sed x=1 "$@" "$1" grep grep grep cd "$1" /usr/bin
+		"$1" /usr/bin ${HOME} grep awk --verbose done
+		| test printf echo | /usr/bin local test ${HOME} export
+		local awk "$1" $(pwd) export | x=1
+	-eu | export 2>/dev/null ${HOME}
+	then cd sed printf echo
+"$@" "$@" cd -eu then 2>/dev/null local export then 2>/dev/null
+		| echo sed grep sed done 'quoted text' ${HOME}
+	local done ${HOME} then readonly /usr/bin
+		'quoted text' then awk readonly readonly readonly ${HOME} grep printf local then
+	printf /usr/bin ${HOME} x=1 readonly "$@" "$@" readonly --verbose
+		| 'quoted text' echo $(pwd) ${HOME} printf
+	printf done $(pwd) grep awk 'quoted text' export echo printf 'quoted text'
+		/usr/bin printf done then sed grep printf $(pwd) printf export | echo 2>/dev/null
+		"$@" awk test echo 2>/dev/null export cd export "$@" cd 2>/dev/null
+cd test ${HOME} grep export --verbose | "$1" awk grep
+		grep "$1" /usr/bin export sed 2>/dev/null --verbose
+		'quoted text' export then grep "$1" test && $(pwd) 2>/dev/null test
+		-eu | readonly sed 'quoted text' awk awk sed /usr/bin
+	'quoted text' local printf echo -eu grep 'quoted text' sed
+	test echo export "$1" printf
+		test -eu x=1 export done 2>/dev/null awk ${HOME}
+	x=1 -eu done $(pwd) sed "$@"
+awk export $(pwd) test "$1" echo 'quoted text' && cd "$@" $(pwd) export cd x=1
+test | ${HOME} x=1 && readonly
+then --verbose && test /usr/bin "$@" $(pwd) cd awk $(pwd) && awk 'quoted text'
+		done readonly --verbose $(pwd) local /usr/bin cd done local printf && awk
+	printf sed local 2>/dev/null | --verbose | echo $(pwd) echo /usr/bin cd then
+	grep /usr/bin && readonly readonly test then && sed --verbose
+		2>/dev/null 'quoted text' grep sed export
+	/usr/bin | export readonly printf done && echo && sed export cd echo printf
+		-eu && printf sed x=1 awk 'quoted text' "$@" grep && "$@" printf readonly test
+/usr/bin ${HOME} echo --verbose echo
+"$@" export 'quoted text' 'quoted text' 'quoted text'
+	--verbose sed && -eu --verbose --verbose --verbose 'quoted text'
+awk cd readonly "$1" sed "$1" awk test export local
+	x=1 ${HOME} $(pwd) 2>/dev/null
+		done | 2>/dev/null local 2>/dev/null local printf "$1"
+readonly x=1 ${HOME} printf
+done awk export echo awk 'quoted text'
+readonly awk echo local /usr/bin
+		test 'quoted text' test local
+	cd "$1" 2>/dev/null printf "$1"
+x=1 cd x=1 cd grep then $(pwd)
+		2>/dev/null done | "$1" then grep awk --verbose readonly
+		export test | export done "$1" x=1 sed printf | echo | sed 2>/dev/null 2>/dev/null
+		test ${HOME} done ${HOME} 'quoted text' 2>/dev/null cd "$@" -eu
+	-eu cd x=1 readonly echo 2>/dev/null
+2>/dev/null sed echo --verbose x=1 readonly
+		--verbose awk ${HOME} --verbose x=1 -eu test printf then echo $(pwd)
+		| $(pwd) readonly 2>/dev/null $(pwd) echo
+export && | awk 2>/dev/null export | | awk
+		test readonly -eu ${HOME} grep readonly local
+		awk local sed | && x=1 &&
+local cd && grep ${HOME}
+	then local grep "$@" awk 'quoted text'
+	export export "$1" then done /usr/bin && 'quoted text' x=1 | --verbose "$@"
+		done /usr/bin then grep x=1 done -eu cd "$1" echo | 'quoted text'
+	echo "$1" sed -eu 'quoted text' && | then printf grep $(pwd) test awk |
+	&& x=1 export export 'quoted text' printf
+		then readonly local 'quoted text' cd export
+local done --verbose x=1 grep ${HOME}
+cd "$@" ${HOME} done grep
+	"$1" --verbose $(pwd) --verbose && | local "$@" readonly
+		echo test && then 2>/dev/null | x=1 sed
+${HOME} done export -eu -eu x=1 /usr/bin $(pwd) 'quoted text' "$1"
+		test -eu local $(pwd) export "$1" then | | ${HOME} awk readonly export
+| -eu then printf x=1 $(pwd) -eu | $(pwd) ${HOME} /usr/bin | readonly
+		'quoted text' grep x=1 local 'quoted text' echo grep
+&& "$@" "$1" done sed test cd readonly then readonly done readonly
+		test cd then && x=1 sed readonly | printf grep ${HOME} local -eu export echo
+local done x=1 2>/dev/null then --verbose
+		"$@" 2>/dev/null /usr/bin cd sed sed ${HOME} then "$1" $(pwd) awk awk printf awk
+		printf test --verbose grep -eu && sed | echo &&
+local echo 2>/dev/null readonly
+	$(pwd) printf 2>/dev/null printf 'quoted text' local && export
+test awk --verbose "$@" | awk "$@" echo "$@" export export echo | ${HOME}
+		then local local 2>/dev/null ${HOME} done
+	then sed done sed printf 'quoted text' local 2>/dev/null
+/usr/bin local 'quoted text' readonly -eu local &&
+printf $(pwd) "$1" 'quoted text' x=1 awk echo 2>/dev/null "$@" export cd
+	/usr/bin && $(pwd) | x=1 x=1 /usr/bin "$@" /usr/bin grep sed awk printf readonly
+--verbose ${HOME} ${HOME}
+grep readonly echo | then echo --verbose
+then echo x=1 && local
+	-eu "$1" done sed ${HOME} local
+		/usr/bin local printf done export --verbose --verbose ${HOME} x=1 echo printf
+		done then done "$1" local -eu readonly local /usr/bin 2>/dev/null printf
+		then && | ${HOME} readonly --verbose
+	cd 2>/dev/null readonly && $(pwd) --verbose test awk
+		readonly readonly done && x=1 "$@" 'quoted text' 'quoted text' awk 2>/dev/null
+	grep readonly cd | $(pwd) sed local printf then printf
+| "$@" printf grep --verbose && | printf
+		"$@" export && /usr/bin done export /usr/bin readonly "$1" 2>/dev/null awk
+printf --verbose awk then cd echo grep test x=1
+	| "$1" x=1 grep local printf awk sed grep && then "$@" test | x=1 "$@" printf
+x=1 "$@" then export x=1 then 'quoted text' "$1" 2>/dev/null awk 2>/dev/null
+${HOME} $(pwd) x=1 export x=1 2>/dev/null --verbose "$@" test
+		readonly 'quoted text' cd x=1 local sed export then ${HOME} echo sed
+		cd awk 'quoted text' readonly "$@" $(pwd) export -eu --verbose echo cd "$@" |
+		-eu "$@" 'quoted text' /usr/bin -eu 'quoted text' && -eu x=1
+printf x=1 $(pwd) echo $(pwd) readonly && && done sed
+	${HOME} then 2>/dev/null then $(pwd)
+	local 'quoted text' 2>/dev/null
+cd echo test readonly "$@" 'quoted text' sed printf echo
+then | "$@" x=1 printf --verbose 'quoted text' | x=1 $(pwd) cd "$1" awk "$@" |
+printf "$1" $(pwd) cd "$@" then grep x=1 readonly /usr/bin readonly
+		then -eu echo printf printf export "$1" awk test grep -eu
+	-eu local -eu x=1 "$1" --verbose export "$@" cd cd && ${HOME} grep export
+awk ${HOME} then grep x=1 echo 'quoted text' echo readonly
+		export /usr/bin awk x=1 local 2>/dev/null
+		local && | "$1" test awk done
+		"$@" /usr/bin local awk grep 2>/dev/null $(pwd)
+readonly sed $(pwd) done grep "$1" && grep && then 'quoted text' local x=1 ${HOME}
+		${HOME} grep /usr/bin test x=1 awk
+		x=1 ${HOME} && | /usr/bin | grep
+		export $(pwd) printf test done /usr/bin printf cd x=1 done
+	2>/dev/null ${HOME} 2>/dev/null x=1 done --verbose | 2>/dev/null sed done --verbose
+	'quoted text' 'quoted text' local /usr/bin ${HOME} awk && --verbose 'quoted text'
+	${HOME} "$1" | | printf sed cd then "$1" && done $(pwd) cd local && cd -eu
+test -eu ${HOME} x=1 x=1 x=1 "$1" /usr/bin "$@" --verbose echo cd readonly
+	"$@" sed export ${HOME} x=1 readonly
+		printf echo awk then -eu readonly ${HOME} then local export then ${HOME}
+"$1" $(pwd) done sed cd --verbose "$@" --verbose --verbose $(pwd) printf
+		cd grep -eu test x=1 /usr/bin cd grep grep cd 'quoted text'
+test && --verbose /usr/bin
+| | --verbose test /usr/bin awk cd "$1" printf
+test test "$1" cd /usr/bin $(pwd) readonly test
+		printf 2>/dev/null $(pwd) "$@" awk "$1" x=1 awk "$@" "$1" done cd export
+		done export | "$@" printf | "$1" -eu x=1 readonly "$1" export
+	local -eu 2>/dev/null
+		export grep /usr/bin test && cd
+	--verbose $(pwd) "$@" 2>/dev/null local test export "$@" test "$1" x=1 grep
+		test then readonly $(pwd) awk cd /usr/bin test x=1 sed readonly
+		awk --verbose -eu readonly 'quoted text'
+		| then test 'quoted text' test then
+		| done 'quoted text' && | test grep && echo | export
+	awk $(pwd) done cd "$@" export grep ${HOME} x=1 grep
+| && printf done export echo sed -eu --verbose -eu
+	sed awk then done 'quoted text' 'quoted text' 2>/dev/null --verbose cd 'quoted text'
+		export printf echo local x=1 sed local 'quoted text'
+	"$1" done awk printf echo cd export then
+		done "$@" done | && awk then --verbose
+	readonly export sed cd ${HOME} echo &&
+awk awk 'quoted text' $(pwd) export 'quoted text' "$@"
+	--verbose printf $(pwd) /usr/bin
+		-eu ${HOME} export -eu "$@" 2>/dev/null 'quoted text' local /usr/bin export grep
+| cd 'quoted text' test ${HOME} then
+		/usr/bin grep $(pwd) grep printf /usr/bin then $(pwd) 2>/dev/null |
+cd printf | x=1 "$@" awk && cd
+	$(pwd) readonly local
+--verbose grep local sed "$@" then
+	&& then && echo 'quoted text' printf 2>/dev/null --verbose
+done export test readonly grep /usr/bin
+		export readonly sed -eu "$1" readonly echo ${HOME} cd done done test --verbose export
+echo echo --verbose export 2>/dev/null
+	echo && "$@" local 2>/dev/null /usr/bin then
+	cd awk x=1 -eu done "$1" readonly x=1 awk 2>/dev/null | --verbose test local
+&& 'quoted text' 2>/dev/null echo $(pwd) -eu export then
+		$(pwd) --verbose -eu printf cd "$1" "$@" local
+		test sed grep sed cd sed readonly x=1 done | "$@" readonly
+'quoted text' printf readonly echo 'quoted text' 'quoted text'
+	${HOME} $(pwd) ${HOME} printf cd then grep 2>/dev/null
+'quoted text' then 2>/dev/null 2>/dev/null "$@" "$@" /usr/bin then
+		done grep 'quoted text' local 'quoted text' export x=1 2>/dev/null
+"$1" 'quoted text' $(pwd) then 'quoted text' printf ${HOME} done $(pwd)
+		printf export local printf "$@" printf | test --verbose test printf
+	&& 'quoted text' test |
+${HOME} /usr/bin test ${HOME} then x=1 -eu readonly grep sed /usr/bin
+echo then sed printf 'quoted text'
+x=1 2>/dev/null printf printf done printf then ${HOME}
+		sed test local readonly echo cd awk $(pwd) export -eu cd test
+	awk local printf sed x=1 /usr/bin cd sed /usr/bin
+	| $(pwd) /usr/bin --verbose -eu "$@" then "$1" ${HOME} local export
+	x=1 $(pwd) local local awk test
+		2>/dev/null /usr/bin awk 'quoted text' readonly sed grep $(pwd)
+	echo local grep cd --verbose "$@" --verbose
+		awk grep /usr/bin sed /usr/bin 2>/dev/null
+	"$1" test --verbose export "$1" | "$1" | sed test awk $(pwd) 'quoted text'
+export grep "$@" readonly 2>/dev/null
+readonly | grep $(pwd) local awk awk done printf --verbose
+		cd | grep $(pwd) ${HOME} x=1 export then cd ${HOME}
+		cd ${HOME} then -eu printf awk 2>/dev/null grep /usr/bin
+local | "$1" ${HOME} sed readonly local test 2>/dev/null readonly sed test then
+		export 'quoted text' $(pwd) --verbose echo 'quoted text'
+test awk | /usr/bin export | awk "$@" && $(pwd) printf x=1 export then
+		export && readonly printf /usr/bin $(pwd) x=1
+readonly then /usr/bin -eu
+sed 'quoted text' x=1 readonly &&
+-eu echo export --verbose readonly
+		--verbose printf "$1" export | export "$1" test local $(pwd) --verbose
+		local readonly x=1 --verbose /usr/bin
+	/usr/bin -eu echo printf -eu test $(pwd) | /usr/bin test
+grep export then test --verbose 'quoted text' -eu -eu local echo x=1 cd ${HOME}
+awk $(pwd) 'quoted text' grep /usr/bin local $(pwd) /usr/bin
+	printf x=1 done /usr/bin then --verbose then
+		export readonly --verbose
+	-eu 'quoted text' awk done local done -eu then
+'quoted text' test /usr/bin x=1 "$@" readonly
+	x=1 && /usr/bin echo 2>/dev/null "$1" echo echo export -eu
+		-eu --verbose /usr/bin -eu | && --verbose /usr/bin x=1 x=1 grep local export
+		then awk x=1 $(pwd) then awk "$@" -eu /usr/bin done
+	test sed grep x=1 local sed then 'quoted text' echo
+	grep "$1" -eu --verbose grep printf cd /usr/bin local done
+	$(pwd) $(pwd) grep -eu sed sed
+		"$@" sed -eu /usr/bin sed "$1" --verbose x=1 local ${HOME} 'quoted text' --verbose
+then ${HOME} awk --verbose export echo export | then test
+		sed then local awk x=1 awk cd 'quoted text' done "$@" 2>/dev/null | &&
+		"$1" && cd sed --verbose cd echo echo --verbose "$1" awk 2>/dev/null
+	"$1" readonly readonly 2>/dev/null export x=1 readonly --verbose
+cd readonly | test x=1 $(pwd) cd awk && -eu "$@" echo done then
+	done $(pwd) --verbose 2>/dev/null -eu then test $(pwd) /usr/bin
+		printf done ${HOME} echo printf local 2>/dev/null $(pwd)
+	done ${HOME} test --verbose -eu export echo -eu echo /usr/bin
+	$(pwd) -eu awk readonly --verbose then
+cd 2>/dev/null | then export /usr/bin readonly -eu x=1 sed
+	test cd awk printf 2>/dev/null --verbose cd echo x=1
+	readonly "$1" then echo sed ${HOME} test
+	-eu | sed export 2>/dev/null $(pwd) cd $(pwd)
+		printf 'quoted text' sed
+	-eu grep local "$@" export
+	| "$@" 2>/dev/null awk "$@" test sed cd x=1 cd x=1 local "$1" grep | /usr/bin
+	-eu readonly --verbose
+		readonly 2>/dev/null grep "$@" | awk awk $(pwd) test printf grep 2>/dev/null
+	printf awk -eu echo export x=1 export done "$@" then -eu then -eu then
+	test x=1 done then done ${HOME} printf "$@" local && readonly -eu "$1" sed
+grep readonly x=1 2>/dev/null sed readonly test ${HOME} ${HOME} && export
+local echo | printf echo echo test echo --verbose
+		then local | test && $(pwd) $(pwd) echo --verbose awk 2>/dev/null local sed
+	then ${HOME} $(pwd) printf -eu 'quoted text'
+	awk echo readonly awk printf readonly cd echo cd | awk
+	printf awk cd && echo sed awk 'quoted text' ${HOME} export local then sed
+local printf then test | 2>/dev/null
+sed echo export "$@" && then readonly then cd && readonly
+		export "$@" 'quoted text' --verbose
+	"$1" grep && 'quoted text' local 'quoted text'
+grep && local then "$1" && "$@" test readonly done local "$@"
+		--verbose then "$@" export
+echo then cd "$@" 'quoted text'
+"$1" readonly 'quoted text' then -eu "$1" test
+$(pwd) -eu x=1 /usr/bin /usr/bin printf /usr/bin readonly echo
+--verbose cd awk export echo ${HOME} sed x=1 grep
+		| test $(pwd) cd "$@" x=1 test | printf then
+then && local cd echo && printf && awk | export -eu && readonly
+then /usr/bin sed test export --verbose readonly
+	'quoted text' then && ${HOME}
+		then test awk awk export ${HOME} printf "$@" sed ${HOME} 'quoted text' printf
+	local && printf /usr/bin --verbose /usr/bin 2>/dev/null
+	echo then "$1" export /usr/bin && test -eu | export ${HOME}
+then readonly local $(pwd) x=1
+"$@" --verbose "$1" "$1" awk sed done /usr/bin x=1 | "$@"
+		done | export $(pwd) --verbose printf /usr/bin then | test -eu --verbose $(pwd)
+test && --verbose awk awk done then -eu /usr/bin "$@" printf echo cd /usr/bin
+		$(pwd) printf test export printf sed done grep sed && "$@" printf test "$1"
+echo 2>/dev/null && printf test local cd cd "$@" ${HOME} $(pwd) -eu -eu done awk
+	/usr/bin ${HOME} local readonly "$@" "$@" grep sed 'quoted text' -eu
+	readonly && && --verbose x=1 cd "$1"
+		test export echo 2>/dev/null |
+	"$@" -eu echo x=1 --verbose echo
+		${HOME} done cd grep ${HOME} x=1 export readonly test local done export &&
+	&& cd | awk done --verbose "$1" sed 'quoted text' echo echo test awk | x=1 done
+"$1" x=1 test readonly echo printf then
+	-eu 2>/dev/null /usr/bin local ${HOME} echo "$@" awk | --verbose awk readonly
+		x=1 --verbose ${HOME} readonly grep | done sed
+		cd awk grep local done cd awk cd export "$1"
+done && ${HOME} --verbose "$1" $(pwd) ${HOME}
+		$(pwd) "$1" && export awk sed echo cd grep "$1" printf echo ${HOME} then export
+	printf local | grep x=1 --verbose then | sed local cd --verbose
+"$1" /usr/bin && printf | ${HOME}
+then readonly then printf done && "$1" echo local -eu
+	/usr/bin 2>/dev/null &&
+		$(pwd) printf "$@" "$@" "$@" done cd done echo done
+		"$@" "$@" ${HOME} $(pwd) |
+	2>/dev/null awk echo /usr/bin
+		/usr/bin readonly --verbose export then printf
+x=1 printf test "$1" done done cd
+-eu 'quoted text' ${HOME} echo x=1 then x=1 sed
+		sed export "$@" -eu "$@" 'quoted text' sed $(pwd) "$1" "$@" then sed -eu
+	--verbose && 'quoted text' ${HOME} echo then 2>/dev/null sed /usr/bin
+		then export "$@" sed awk grep "$@" cd printf readonly
+x=1 --verbose sed local cd 'quoted text' "$@" "$@"
+/usr/bin ${HOME} "$1" awk 'quoted text' export grep && sed x=1 x=1 then "$1"
+		&& 'quoted text' /usr/bin 'quoted text' x=1 x=1 "$@" $(pwd) --verbose "$@" grep
+		awk "$@" export "$@" $(pwd) 2>/dev/null $(pwd) "$1" ${HOME} then readonly done
+		${HOME} awk sed $(pwd) done cd sed /usr/bin
+		"$1" awk 'quoted text' $(pwd) $(pwd) sed sed "$1" x=1 x=1 && && cd local done
+	sed $(pwd) readonly "$1" /usr/bin -eu echo "$@" --verbose sed
+		readonly echo "$@" $(pwd) /usr/bin -eu ${HOME} "$1" local
+/usr/bin done export awk test test readonly printf echo then
+		then echo "$@" "$@" x=1 x=1 grep grep
+readonly printf 'quoted text' && grep "$1" done
+	-eu ${HOME} done readonly cd "$@" export local ${HOME} "$1" cd
+	test grep echo awk ${HOME} cd local awk "$1" test test x=1 -eu 2>/dev/null
+x=1 printf | test | /usr/bin local then x=1 done awk sed then printf "$@"
+	grep x=1 grep awk grep grep && export
+		readonly 'quoted text' local -eu | 'quoted text'
+	"$@" 2>/dev/null 'quoted text' 'quoted text' ${HOME} awk x=1 export
+echo "$1" -eu printf echo cd 'quoted text' ${HOME} printf then
+then printf then cd echo ${HOME} 2>/dev/null
+	readonly readonly -eu --verbose test --verbose local
+	cd echo 'quoted text' printf readonly x=1 grep
+${HOME} 2>/dev/null cd printf --verbose 2>/dev/null
+		/usr/bin then ${HOME} | $(pwd) printf --verbose grep
+		${HOME} "$1" cd -eu 'quoted text' x=1 printf
+--verbose done awk readonly 2>/dev/null $(pwd) /usr/bin awk
+		${HOME} export grep x=1 2>/dev/null --verbose | then local echo
+		sed ${HOME} 'quoted text' echo readonly
+		export "$@" x=1 && readonly local done awk readonly | -eu cd 'quoted text'
+printf done cd done /usr/bin "$@" awk echo
+	"$1" sed cd done awk x=1 readonly grep 2>/dev/null | x=1 /usr/bin
+| printf "$1" 'quoted text' then grep readonly
+	"$1" sed cd cd test local printf
+		--verbose printf printf awk awk "$1"
+	grep test "$@" readonly echo awk readonly export 2>/dev/null
+		awk readonly /usr/bin echo then ${HOME} ${HOME}
+		x=1 awk -eu -eu $(pwd) readonly sed
+	local && test cd "$1" awk ${HOME} -eu test sed export ${HOME} then
+sed cd done $(pwd) x=1 -eu grep grep cd then /usr/bin /usr/bin
+	export sed awk ${HOME} echo && readonly
+		&& /usr/bin export --verbose cd $(pwd) | "$1" && 2>/dev/null printf grep local
+	| cd -eu cd export cd echo cd "$@" then printf local local then /usr/bin
+	'quoted text' && "$@" cd printf 'quoted text' awk test "$1" readonly cd | test
+	${HOME} /usr/bin | "$@" && ${HOME} /usr/bin 2>/dev/null then ${HOME}
+	done sed | | $(pwd) 2>/dev/null 2>/dev/null grep "$@" "$1" x=1 sed -eu
+	x=1 2>/dev/null "$1" readonly
+		-eu 'quoted text' then done then sed
+	echo | sed grep export then test /usr/bin
+		x=1 $(pwd) printf test cd echo 2>/dev/null awk
+	export export done 'quoted text' 2>/dev/null "$@" ${HOME} done x=1 done
+$(pwd) sed x=1 test local cd awk cd cd export "$@" grep local $(pwd)
+		| /usr/bin printf echo sed | ${HOME} -eu export printf
+	local 2>/dev/null | $(pwd) 2>/dev/null awk readonly
+		"$@" awk "$@" 'quoted text' done echo local --verbose
+awk readonly printf | done awk grep "$1" printf awk readonly
+local $(pwd) export $(pwd) /usr/bin --verbose export 'quoted text' ${HOME} export
+		cd && echo -eu -eu printf sed sed grep sed test
+export readonly test /usr/bin export export
+done echo test sed "$@" $(pwd) awk -eu local export export 2>/dev/null
+		/usr/bin readonly test test ${HOME}
+	-eu "$@" 'quoted text' --verbose -eu && cd "$1"
+	sed awk /usr/bin 2>/dev/null -eu -eu /usr/bin
+"$@" cd ${HOME} --verbose "$1" --verbose --verbose ${HOME}
+		printf ${HOME} x=1 sed x=1 done then "$1" cd $(pwd) x=1 | printf && 2>/dev/null
+grep awk done test export
+	| /usr/bin 'quoted text' echo | readonly --verbose && echo && ${HOME}
+		2>/dev/null export done grep "$@" /usr/bin 2>/dev/null
+	awk ${HOME} $(pwd) awk -eu printf
+sed sed sed sed x=1 cd ${HOME} --verbose "$@" --verbose ${HOME} $(pwd) /usr/bin
+	/usr/bin local /usr/bin
+"$1" /usr/bin $(pwd) awk sed && -eu printf local awk printf
+	--verbose "$1" local --verbose 'quoted text' ${HOME} grep sed local grep
+"$@" grep test readonly awk cd 2>/dev/null then readonly "$@" /usr/bin
+	2>/dev/null test | test test done export ${HOME} awk 2>/dev/null "$1" "$1"
+		/usr/bin | grep 'quoted text' printf $(pwd) && cd | test 2>/dev/null test readonly
+echo grep then printf --verbose
+	printf /usr/bin /usr/bin export | awk then test test export sed export x=1 echo
+		${HOME} printf awk done awk cd sed export
+		awk done cd /usr/bin ${HOME} grep cd printf "$@" local export
+${HOME} 'quoted text' | "$1" 'quoted text' grep /usr/bin grep test echo $(pwd)
+		$(pwd) ${HOME} export printf x=1 printf then cd local --verbose "$1"
+		| then export && "$1" "$1" done printf x=1 grep cd $(pwd) --verbose
+		&& "$@" grep readonly x=1 awk cd sed cd 'quoted text'
+	'quoted text' -eu /usr/bin x=1 local readonly
+		2>/dev/null 2>/dev/null sed | ${HOME} | echo -eu && done "$1" printf done |
+	--verbose && export $(pwd)
+		| $(pwd) "$1" --verbose awk test awk | ${HOME} "$@" export awk && cd printf
+		printf 'quoted text' -eu 'quoted text' | done "$@" &&
+	echo printf awk export awk awk export -eu sed then test && cd echo readonly
+done 'quoted text' then readonly echo echo 2>/dev/null
+grep cd sed grep awk cd x=1 ${HOME} x=1 printf ${HOME} /usr/bin ${HOME}
+		-eu $(pwd) 2>/dev/null done $(pwd) | local x=1 local x=1 /usr/bin
+	cd export "$1" ${HOME} | then && x=1 then x=1
+		then /usr/bin $(pwd) grep then
+"$@" export readonly test "$1" awk -eu ${HOME} ${HOME} "$@" awk ${HOME} cd 2>/dev/null
+${HOME} then then printf local 2>/dev/null "$@"
+	readonly | sed echo grep echo "$1" sed awk cd then
+echo "$@" then && && sed echo 2>/dev/null
+		export $(pwd) readonly "$1" readonly && -eu x=1 2>/dev/null x=1 && ${HOME}
+		printf done then "$@" x=1 export echo 2>/dev/null then readonly test
+		| 'quoted text' "$1" 'quoted text' /usr/bin ${HOME} x=1 grep done export export
+$(pwd) export | --verbose $(pwd) test done "$1" done 2>/dev/null then
+export readonly test && -eu 2>/dev/null done && local x=1 printf export --verbose
+printf export test readonly
+		export cd -eu $(pwd) "$1" /usr/bin ${HOME} echo ${HOME}
+	printf test && /usr/bin done ${HOME} "$@" awk
+done sed && export grep
+	test then then cd 2>/dev/null sed && $(pwd)
+	| "$1" sed local 2>/dev/null ${HOME} local x=1 readonly cd && then then --verbose
+	printf x=1 -eu done grep
+	--verbose | grep ${HOME} 2>/dev/null 'quoted text' echo $(pwd)
+	printf echo $(pwd) 2>/dev/null | printf readonly -eu "$@" "$1"
+readonly printf readonly printf --verbose printf /usr/bin
+	then 'quoted text' "$1" test | local export
+		${HOME} grep ${HOME} printf export test --verbose ${HOME}
+	test awk "$1" echo awk sed readonly $(pwd) then 'quoted text'
+		/usr/bin export echo "$@" then echo "$1" | "$@" /usr/bin test 'quoted text'
+	-eu then "$@" x=1 'quoted text' "$@" echo grep 'quoted text' -eu "$@" test -eu
+	printf cd then ${HOME} awk sed then
+	printf echo --verbose --verbose 2>/dev/null
+	then done test local grep printf --verbose
+	"$@" grep printf ${HOME} cd then -eu sed echo local /usr/bin
+		local --verbose x=1 2>/dev/null
+		then | readonly 2>/dev/null $(pwd) -eu cd "$@" readonly grep
+	"$@" /usr/bin awk sed awk done readonly /usr/bin then export
+		export readonly grep --verbose
+-eu echo "$1" cd echo cd cd sed sed test
+	$(pwd) test "$@" $(pwd) /usr/bin | sed ${HOME} echo "$1" "$1"
+		--verbose --verbose local
+	| "$1" $(pwd) awk export done local local test && $(pwd) cd x=1 done
+	"$@" ${HOME} echo /usr/bin ${HOME} readonly
+	printf export 'quoted text' export then awk ${HOME} awk | -eu | ${HOME} /usr/bin
+	cd $(pwd) done local cd ${HOME} export export $(pwd) readonly -eu "$1"
+echo -eu test 2>/dev/null
+local local then --verbose cd "$1" readonly local cd x=1
+	awk "$@" && then awk 'quoted text' | done "$@" cd
+		"$1" | done awk then cd $(pwd) 'quoted text' --verbose sed export
+	awk done grep --verbose sed $(pwd) x=1 export
+	done "$1" test $(pwd) printf
+		"$@" done -eu test local test awk
+	then local $(pwd) --verbose readonly sed test echo sed echo cd && sed
+		x=1 sed cd ${HOME} -eu awk done readonly
+	"$1" done -eu export "$1" && then /usr/bin
+${HOME} done done 'quoted text' sed "$1"
+	&& -eu "$1" cd readonly | done -eu $(pwd) test ${HOME}
+		cd awk -eu test "$@" && local sed $(pwd) 'quoted text' "$1" done --verbose
+| "$@" --verbose | "$@" done test test done /usr/bin
+	done && then readonly test cd 'quoted text'
+	"$1" -eu ${HOME} x=1 cd $(pwd) cd readonly local 2>/dev/null $(pwd) 2>/dev/null
+"$@" /usr/bin && then $(pwd) && 'quoted text' x=1
+grep "$@" /usr/bin awk then local
+	readonly "$@" done cd && "$@" -eu export ${HOME} test echo | 'quoted text'
+"$@" readonly ${HOME} &&
+"$1" $(pwd) x=1 then test x=1 $(pwd) 2>/dev/null "$1" ${HOME} then && /usr/bin
+	${HOME} readonly printf awk sed | "$1" local echo ${HOME} --verbose --verbose
+	x=1 'quoted text' --verbose
+		2>/dev/null cd export export export done "$1" -eu "$@"
+readonly cd 2>/dev/null test /usr/bin 'quoted text' echo 2>/dev/null export
+	x=1 export test 2>/dev/null x=1 export
+2>/dev/null printf x=1 awk --verbose
+grep | "$@" test sed readonly cd export readonly
+echo export 2>/dev/null "$1" 'quoted text' awk then ${HOME}
+		--verbose --verbose /usr/bin x=1 echo echo && -eu local
+export -eu 2>/dev/null "$1" &&
+test awk awk echo printf grep awk /usr/bin --verbose local echo
+'quoted text' local cd done | ${HOME} $(pwd) awk export x=1 "$@" 'quoted text'
+	export sed local $(pwd) sed printf test $(pwd) | | --verbose 'quoted text'
+	&& $(pwd) grep echo | echo "$1" printf then /usr/bin cd printf && test --verbose
+	test readonly done ${HOME} readonly x=1 2>/dev/null "$@" | x=1 --verbose -eu local
+| grep echo -eu sed && local
+	export done $(pwd) --verbose /usr/bin --verbose --verbose
+export 2>/dev/null | --verbose && "$@" sed grep echo "$@" awk
+	grep then readonly readonly done "$1" "$@" awk export --verbose
+	/usr/bin 2>/dev/null "$@" "$1"
+&& test readonly $(pwd) "$1" 'quoted text' ${HOME}
+		cd -eu ${HOME} 2>/dev/null test $(pwd) echo /usr/bin test cd | cd then local x=1
+	printf && --verbose awk -eu $(pwd)
+		${HOME} 'quoted text' export "$@" x=1 export 2>/dev/null echo grep local
+test 2>/dev/null done "$@" echo
+	printf 'quoted text' x=1 awk && $(pwd) local /usr/bin x=1 && export ${HOME}
+2>/dev/null 'quoted text'
+	| grep -eu x=1 x=1 readonly | 'quoted text' cd sed readonly echo ${HOME}
+		sed local x=1 printf test --verbose export && 'quoted text' echo --verbose
+$(pwd) awk then done sed printf "$@" -eu && 2>/dev/null -eu sed
+	then echo -eu | -eu printf then /usr/bin
+		x=1 | -eu "$1" then grep test echo
+	awk export grep awk "$@" x=1 readonly test
+--verbose ${HOME} 2>/dev/null "$1" "$1" done x=1 -eu 'quoted text' sed "$1"
+&& 2>/dev/null printf printf readonly grep
+	cd $(pwd) export done | -eu echo local /usr/bin ${HOME}
+		'quoted text' then 2>/dev/null echo ${HOME}
+	${HOME} $(pwd) echo local "$@"
+-eu "$1" done "$1" local local && 'quoted text' ${HOME} | -eu echo |
+	printf test test local
+/usr/bin --verbose export sed -eu -eu
+		"$1" 'quoted text' printf | && export awk echo awk printf
+sed | readonly "$1" export then 'quoted text' 2>/dev/null
+${HOME} && x=1 ${HOME} export "$1" $(pwd)
+		local echo grep /usr/bin /usr/bin x=1 readonly
+		${HOME} $(pwd) test printf done awk printf
+&& cd "$1" --verbose awk 2>/dev/null
+	"$1" /usr/bin | 2>/dev/null 'quoted text'
+&& -eu then then --verbose printf awk done test echo cd x=1 x=1 printf
+--verbose readonly sed "$@" readonly --verbose export "$@" test ${HOME}
+test grep /usr/bin then ${HOME} && local && cd printf readonly 'quoted text'
+-eu echo printf --verbose grep local grep local echo echo x=1
+		--verbose "$1" | test printf "$1" test printf printf local readonly x=1 readonly
+	${HOME} test test echo readonly "$@" ${HOME} printf
+		then test "$@" echo ${HOME} awk | cd 2>/dev/null -eu cd | done sed then
+		2>/dev/null export printf ${HOME} ${HOME} 2>/dev/null x=1 ${HOME} readonly
+cd --verbose then readonly && --verbose | done x=1
+		&& readonly printf "$1" | readonly "$1" 'quoted text' 'quoted text'
+		2>/dev/null grep local /usr/bin ${HOME} 'quoted text'
+printf test --verbose grep
+'quoted text' /usr/bin 2>/dev/null printf "$@" local
+sed export 2>/dev/null 'quoted text' && 'quoted text' /usr/bin test -eu
+		test --verbose readonly x=1
+		${HOME} "$1" local printf /usr/bin then printf ${HOME} /usr/bin 2>/dev/null printf
+	done x=1 grep then done | grep "$@" ${HOME} done && |
+		local 2>/dev/null awk
+		cd 'quoted text' echo local | echo export cd
+test $(pwd) /usr/bin ${HOME} done 'quoted text' done -eu --verbose export cd
+		'quoted text' awk 'quoted text' 'quoted text' $(pwd)
+	/usr/bin x=1 -eu ${HOME} done
+		$(pwd) sed sed x=1 $(pwd) x=1 sed "$@"
+		--verbose printf /usr/bin done then then cd
+		| 2>/dev/null $(pwd) export x=1
+	local done export test
+		grep sed cd then local x=1 --verbose printf local "$@" done
+"$@" awk cd export "$1" test cd 2>/dev/null
+		-eu x=1 done "$@" sed
+		${HOME} "$1" 2>/dev/null
+		$(pwd) done export sed printf
+	&& --verbose local local ${HOME} sed echo test ${HOME} awk -eu
+		-eu grep x=1 "$1" readonly grep $(pwd) awk done
+	export sed local sed x=1 echo export && | -eu /usr/bin "$1"
+		"$1" sed grep printf "$@" /usr/bin cd cd | $(pwd) $(pwd)
+		done awk sed "$@" grep cd then $(pwd) "$1" && && "$@" awk printf 2>/dev/null
+local /usr/bin export test $(pwd)
+'quoted text' && printf
+	'quoted text' ${HOME} /usr/bin
+-eu -eu awk printf cd /usr/bin x=1 /usr/bin "$@" ${HOME} $(pwd)
+		grep ${HOME} $(pwd) ${HOME} -eu printf export printf local echo | 2>/dev/null
+sed "$1" "$1" "$1" local --verbose readonly then grep export cd ${HOME} grep $(pwd)
+	done x=1 done cd | export local export done | awk 2>/dev/null
+	x=1 && --verbose && --verbose x=1 && | x=1 ${HOME}
+		echo grep --verbose "$@" done
+--verbose then export --verbose cd -eu
+		cd awk cd | | grep local test test printf local
+		grep local "$@" "$@" done x=1 x=1 x=1
+		"$@" -eu local then test && printf /usr/bin $(pwd) -eu ${HOME} cd local then printf
+	export -eu && cd cd then sed cd -eu 2>/dev/null "$@" echo local then grep
+		${HOME} /usr/bin /usr/bin local test /usr/bin "$1" sed done echo cd &&
+		'quoted text' -eu ${HOME} -eu echo done then done "$@" 'quoted text'
+local | 'quoted text' "$1" --verbose
+$(pwd) then "$1" $(pwd) grep sed x=1 local
+	awk printf "$1" /usr/bin ${HOME}
+	x=1 -eu echo grep sed "$1" ${HOME} awk echo --verbose x=1 -eu x=1 readonly
+	printf export awk test $(pwd)
+"$@" ${HOME} $(pwd) awk && then local awk readonly
+then echo export then "$@" grep 'quoted text'
+test local /usr/bin awk x=1 done 'quoted text' cd local 2>/dev/null
+		local --verbose local
+	2>/dev/null /usr/bin --verbose then test 2>/dev/null
+/usr/bin cd readonly readonly /usr/bin
+		${HOME} && test "$1" grep cd x=1 "$1"
+	2>/dev/null "$@" printf awk | local --verbose | /usr/bin test
+	-eu awk "$1" export echo x=1 grep grep --verbose test
+		sed 2>/dev/null --verbose readonly echo cd readonly
+$(pwd) cd printf done 2>/dev/null 'quoted text' "$@" /usr/bin
+		cd test sed && /usr/bin awk cd "$@" cd /usr/bin local then -eu
+	&& export | done 'quoted text' -eu && echo then echo export grep 2>/dev/null
+	test grep echo $(pwd) 'quoted text' 2>/dev/null /usr/bin
+		done done printf "$1" $(pwd) echo then grep done
+grep then done awk | && 2>/dev/null grep done $(pwd) --verbose 2>/dev/null $(pwd)
+readonly --verbose | "$@" done test
+sed readonly && "$1" $(pwd) local
+	cd grep /usr/bin local ${HOME} echo
+test sed --verbose printf | -eu "$1"
+test readonly "$1" printf /usr/bin 'quoted text' grep
+	"$1" echo cd echo echo
+'quoted text' /usr/bin -eu then && "$@" then awk 'quoted text' printf
+		sed && grep /usr/bin $(pwd) cd /usr/bin awk then local
+		"$@" grep grep "$1" 2>/dev/null "$1" sed done done -eu done echo x=1 | "$1" printf
+		"$1" && grep $(pwd) sed /usr/bin sed export export && && -eu "$1" readonly 'quoted text'
+		grep sed grep /usr/bin /usr/bin test -eu 2>/dev/null "$1" test /usr/bin
+	"$1" grep && "$@" local then then | export "$1"
+		awk readonly export /usr/bin readonly 2>/dev/null
+then | grep && export
+		readonly grep readonly "$@"
+	-eu && --verbose | sed -eu local grep sed
+		| | --verbose export then /usr/bin cd 'quoted text' -eu awk awk "$1" 2>/dev/null
+printf local sed ${HOME} echo sed grep $(pwd) -eu awk
+export 'quoted text' readonly
+	$(pwd) done && "$@" $(pwd) /usr/bin /usr/bin 'quoted text'
+		x=1 $(pwd) test 2>/dev/null "$1"
+local | cd $(pwd) local "$@" --verbose
+sed "$@" "$@" "$1" sed && && -eu echo local | then sed sed grep ${HOME} done
+		$(pwd) 'quoted text' -eu grep done $(pwd)
+	then cd | sed "$1" test
+	| /usr/bin --verbose printf /usr/bin "$1" && sed test
+&& && done $(pwd) export /usr/bin
+		readonly done done done ${HOME} printf /usr/bin
+	test readonly local x=1 "$@" && cd && awk /usr/bin
+'quoted text' /usr/bin export "$1" local
+		grep done readonly x=1 $(pwd)
+	'quoted text' cd sed grep ${HOME}
+-eu "$1" $(pwd) export x=1 -eu grep
+local grep echo test sed done $(pwd)
+		'quoted text' | /usr/bin "$@" export sed
+		sed 2>/dev/null 2>/dev/null && local 'quoted text' local
+2>/dev/null echo grep 2>/dev/null 'quoted text' awk "$1" sed 'quoted text'
+	export 2>/dev/null printf cd --verbose --verbose ${HOME} readonly
+test done echo /usr/bin 2>/dev/null
+export then && "$@" ${HOME} export then 'quoted text'
+		readonly readonly then && local /usr/bin && && echo readonly
+		local | ${HOME} x=1 local export --verbose awk
+"$1" sed echo test ${HOME} local 2>/dev/null readonly x=1 -eu "$1" sed
+--verbose 'quoted text' "$@"
+&& printf && | sed readonly test 'quoted text'
+		"$@" "$@" printf | /usr/bin x=1 /usr/bin sed | 'quoted text'
+	"$@" then sed echo cd grep readonly awk awk "$1"
+	export 'quoted text' x=1 awk awk awk
+	echo cd /usr/bin $(pwd) && local -eu $(pwd) then && done echo
+		$(pwd) test done && awk
+test $(pwd) local /usr/bin "$@" awk cd && 2>/dev/null $(pwd) -eu |
+	printf awk ${HOME} 'quoted text' --verbose then $(pwd)
+		-eu test | $(pwd) 'quoted text' printf 2>/dev/null -eu "$@" printf printf --verbose
+$(pwd) then ${HOME} grep readonly | done /usr/bin $(pwd)
+"$@" cd ${HOME} printf "$1" $(pwd) sed
+	"$1" local done "$1" cd 2>/dev/null local | cd test ${HOME}
+		readonly printf readonly /usr/bin && printf then 2>/dev/null
+2>/dev/null /usr/bin ${HOME} "$@" local
+		test && -eu export local
+echo test cd ${HOME} 2>/dev/null /usr/bin readonly export readonly | awk done
+	| $(pwd) test echo 'quoted text' printf $(pwd) cd "$@" test 2>/dev/null
+awk cd $(pwd) grep "$@" /usr/bin cd ${HOME} && local && x=1 printf -eu grep
+	grep done 2>/dev/null awk x=1 2>/dev/null grep && echo local local done sed
+	grep $(pwd) test export "$@" --verbose
+	${HOME} x=1 test awk "$@" 2>/dev/null | awk grep | ${HOME} && && test
+		cd awk | $(pwd) export printf | then "$1" 'quoted text'
+	readonly readonly -eu && /usr/bin $(pwd) $(pwd) local "$1" && test "$1" test export
+		sed awk then readonly ${HOME}
+		| grep local -eu $(pwd) 'quoted text' then then --verbose
+	"$@" echo 'quoted text' | done done test then sed local awk ${HOME} "$1"
+test export export echo readonly
+	test "$@" readonly then x=1 2>/dev/null then cd test
+	-eu grep -eu grep export readonly cd /usr/bin awk "$@" && x=1 done sed
+grep awk echo grep awk then readonly export
+	&& 2>/dev/null | grep local "$1" ${HOME}
+${HOME} x=1 /usr/bin done echo readonly awk "$1" /usr/bin ${HOME} &&
+	"$1" awk ${HOME} | "$@" | --verbose
+--verbose readonly /usr/bin then && sed awk x=1 export 'quoted text'
+sed grep printf done cd && sed sed && "$@"
+$(pwd) && then done then grep -eu grep --verbose --verbose "$@" /usr/bin
+		local printf grep test x=1 echo then ${HOME} && ${HOME}
+		--verbose 'quoted text' readonly /usr/bin --verbose
+		cd cd test local /usr/bin "$@" x=1 test readonly done /usr/bin
+		"$1" --verbose x=1 -eu $(pwd) awk export test export sed export 'quoted text'
+	awk $(pwd) "$@" export
+	echo then x=1 printf ${HOME} printf 'quoted text' --verbose local export --verbose
+then sed /usr/bin cd echo ${HOME} local -eu printf ${HOME} 'quoted text' local
+		"$@" $(pwd) then cd printf
+		export then "$@" readonly $(pwd)
+		$(pwd) /usr/bin /usr/bin grep "$@" test | sed
+	printf -eu then readonly grep
+	2>/dev/null awk 2>/dev/null export
+	test x=1 local && /usr/bin cd x=1 readonly
+	awk 'quoted text' echo printf x=1 printf --verbose cd "$1" --verbose $(pwd)
@@ -0,0 +1,2001 @@
+--verbose local x=1 ${HOME} 2>/dev/null
+	test 2>/dev/null /usr/bin
+done -eu x=1 printf -eu export
+	${HOME} then local "$1" cd done then awk grep
+		grep done 'quoted text' | --verbose grep
+	"$1" then echo local -eu 'quoted text' ${HOME}
+		x=1 "$@" --verbose --verbose test
+		sed echo 'quoted text' grep "$1"
+	-eu $(pwd) "$@" | /usr/bin --verbose sed "$@" printf done /usr/bin | 2>/dev/null
+		${HOME} && then readonly $(pwd) ${HOME}
+	local --verbose x=1 $(pwd) -eu printf $(pwd)
+		echo readonly "$1" "$1" printf grep done local 2>/dev/null
+		2>/dev/null $(pwd) awk --verbose readonly | sed export --verbose
+		"$1" 2>/dev/null local export
+"$1" ${HOME} test sed $(pwd) ${HOME} 2>/dev/null
+	${HOME} /usr/bin cd done then cd ${HOME} && local ${HOME} awk
+		test readonly awk $(pwd) /usr/bin
+	x=1 printf local ${HOME}
+-eu /usr/bin x=1 done done printf x=1 echo 2>/dev/null ${HOME}
+x=1 done test 'quoted text' awk ${HOME} "$@" 'quoted text'
+&& awk then awk && "$1" grep "$1" sed printf echo
+	--verbose export ${HOME} local --verbose printf
+echo 2>/dev/null grep done awk local
+	2>/dev/null readonly sed cd 2>/dev/null
+	sed test -eu printf readonly cd test
+		/usr/bin then local "$@" ${HOME} readonly done then
+"$1" | sed && awk test printf &&
+	&& 'quoted text' cd echo && x=1 /usr/bin cd grep ${HOME} printf | 2>/dev/null
+		printf 'quoted text' -eu
+readonly && readonly && test grep $(pwd) --verbose grep "$1" x=1 -eu && done /usr/bin
+		test local test cd echo
+	then test | ${HOME} echo export /usr/bin
+	| grep awk printf /usr/bin ${HOME} printf "$1" test awk
+	local 'quoted text' sed | --verbose $(pwd) -eu echo "$@" "$@" && "$@" done
+		&& /usr/bin sed "$1" "$1" echo grep echo test x=1 done && ${HOME}
+	sed -eu 2>/dev/null && export 2>/dev/null grep
+	"$@" done printf ${HOME} test "$1" x=1 --verbose
+	readonly 2>/dev/null 'quoted text' 'quoted text' done
+	grep --verbose /usr/bin done local grep /usr/bin done ${HOME} -eu cd done
+	2>/dev/null done -eu local then
+		'quoted text' echo then
+		${HOME} x=1 awk echo cd 'quoted text'
+$(pwd) awk | then && | 2>/dev/null export | /usr/bin local local 2>/dev/null
+done printf /usr/bin awk 'quoted text'
+		readonly --verbose --verbose -eu -eu | --verbose echo cd cd $(pwd) "$@" --verbose
+	&& cd | done then "$@" 'quoted text' 'quoted text' "$1" grep
+		${HOME} awk -eu && cd 2>/dev/null grep | grep --verbose export cd awk sed export
+	| grep x=1 then awk awk readonly
+test ${HOME} "$1" "$1" then echo $(pwd)
+	'quoted text' awk --verbose --verbose | | readonly cd "$@" then
+$(pwd) grep ${HOME} then /usr/bin
+	export then printf "$1" grep && printf
+	x=1 test "$@" 2>/dev/null echo ${HOME} 2>/dev/null awk /usr/bin echo done awk
+	$(pwd) ${HOME} local awk test 2>/dev/null then $(pwd)
+-eu printf "$@" | grep
+--verbose x=1 test then printf test "$@" awk "$@" local
+		local cd ${HOME} 'quoted text' "$1" 'quoted text' readonly sed printf sed then
+	readonly awk | ${HOME} cd cd "$@" grep && "$@" readonly cd readonly ${HOME} readonly
+then -eu && /usr/bin local
+	awk echo grep "$1" printf readonly printf export
+"$1" export then 'quoted text' "$1" then
+&& && | local x=1 2>/dev/null then
+	"$@" echo --verbose export /usr/bin 'quoted text' $(pwd) && readonly --verbose
+export printf -eu "$@" "$1" "$1"
+export "$@" 2>/dev/null local local then grep grep --verbose
+/usr/bin grep grep then local test --verbose --verbose $(pwd) 'quoted text' echo
+		done grep done --verbose grep sed /usr/bin x=1 test "$@" echo grep
+		-eu test export -eu readonly 'quoted text' $(pwd) awk -eu
+		2>/dev/null 2>/dev/null local export local sed then 2>/dev/null
+	/usr/bin /usr/bin 'quoted text' test done "$@" echo
+--verbose test local readonly && 2>/dev/null done readonly export | test "$1"
+	${HOME} done done $(pwd) awk x=1 "$1" echo echo then grep
+		local | /usr/bin && awk && test cd awk x=1 && | --verbose export
+		/usr/bin ${HOME} export 2>/dev/null local printf "$1" cd 'quoted text' 'quoted text'
+	readonly grep export | then "$@" /usr/bin printf
+"$@" local local 2>/dev/null printf "$@" sed 2>/dev/null x=1
+	done readonly printf "$@" "$1" 'quoted text'
+		readonly grep /usr/bin "$1" sed echo $(pwd) done /usr/bin echo cd echo
+	"$@" --verbose | awk 2>/dev/null | readonly | | sed cd x=1
+		$(pwd) test "$@" $(pwd) --verbose export local x=1 "$@" "$@" x=1 'quoted text'
+	grep local -eu local --verbose 2>/dev/null
+	export readonly /usr/bin /usr/bin grep 'quoted text' export --verbose export
+		awk "$1" -eu "$@" then && then grep cd "$1" sed x=1 x=1 local
+		done cd "$@" && $(pwd)
+grep cd awk && cd test | cd cd sed | printf "$1" sed "$1" /usr/bin
+		awk | "$@" -eu $(pwd) ${HOME} && then sed
+cd echo "$1" test /usr/bin then
+	"$1" cd /usr/bin 'quoted text' "$@" $(pwd) awk 'quoted text' | local echo sed
+		sed "$1" 'quoted text' "$1" export && awk /usr/bin
+-eu cd | done readonly printf
+		printf 2>/dev/null $(pwd) awk 'quoted text' done 2>/dev/null -eu grep then ${HOME}
+	printf cd | readonly 'quoted text' 2>/dev/null grep export -eu x=1 export readonly
+	done echo then test $(pwd) then 2>/dev/null echo grep
+	-eu then export awk readonly
+--verbose local --verbose cd printf local 'quoted text' awk 2>/dev/null
+		"$1" export -eu awk echo --verbose test
+		$(pwd) --verbose cd | | printf x=1 --verbose local cd ${HOME} -eu done sed
+	$(pwd) grep awk x=1 printf readonly
+		&& then --verbose 'quoted text'
+local && -eu --verbose cd echo echo
+		done done local cd && cd local local echo
+	2>/dev/null local -eu $(pwd)
+	&& awk && export && | local && then cd $(pwd) 2>/dev/null printf 2>/dev/null
+'quoted text' x=1 test "$1" "$1" --verbose /usr/bin "$1" /usr/bin
+		awk then 2>/dev/null | test then local --verbose x=1
+--verbose | && "$1" --verbose 2>/dev/null "$1" sed $(pwd)
+		-eu $(pwd) cd cd | x=1 echo cd echo
+done ${HOME} local grep echo "$@" "$1" $(pwd) -eu "$@" | done printf
+	test --verbose "$@" "$@" printf ${HOME} x=1
+		printf /usr/bin export
+		/usr/bin done ${HOME} local sed grep readonly && then done $(pwd) sed export
+	"$@" && then /usr/bin then sed
+		"$1" local "$1" 2>/dev/null
+-eu | | printf awk awk /usr/bin 2>/dev/null grep awk $(pwd) grep cd printf -eu
+"$@" printf cd x=1 echo local local "$1" /usr/bin 'quoted text'
+		x=1 "$@" 'quoted text' 2>/dev/null test cd
+awk "$1" sed printf readonly ${HOME} /usr/bin echo done done local awk printf
+		-eu | awk readonly readonly
+	printf --verbose awk --verbose --verbose
+	| awk 'quoted text' /usr/bin | grep 'quoted text' 2>/dev/null awk /usr/bin
+x=1 export "$@" "$1" local readonly readonly
+&& 'quoted text' test x=1 local && /usr/bin -eu 2>/dev/null
+		${HOME} $(pwd) then x=1 done ${HOME} && cd cd readonly
+		/usr/bin 'quoted text' --verbose grep local $(pwd) echo /usr/bin
+		done && echo grep then /usr/bin done echo 'quoted text' x=1
+	&& done x=1 2>/dev/null printf test ${HOME} cd grep | grep
+'quoted text' then ${HOME}
+		then then /usr/bin echo then x=1 "$@"
+	export awk awk 'quoted text' ${HOME} ${HOME} /usr/bin $(pwd) /usr/bin awk | then
+		then 2>/dev/null grep --verbose -eu
+grep x=1 export x=1 && --verbose grep -eu 2>/dev/null local "$1"
+	-eu awk done && then awk export "$@" cd test grep | --verbose 'quoted text'
+export cd grep grep test local 2>/dev/null printf
+	sed sed ${HOME} cd ${HOME}
+		printf grep "$@" grep 'quoted text' "$1" grep $(pwd)
+	/usr/bin then "$1" | | $(pwd) test readonly
+	"$@" export 'quoted text' echo 2>/dev/null "$1" awk printf awk
+		&& ${HOME} -eu x=1 done readonly && awk printf done echo &&
+	'quoted text' ${HOME} then echo awk then --verbose
+	then cd 2>/dev/null done awk cd export
+		--verbose && ${HOME} echo
+		local local "$@" then --verbose 'quoted text' awk then 2>/dev/null grep
+		'quoted text' printf
+		cd $(pwd) $(pwd) /usr/bin x=1 then then sed $(pwd) test "$@" "$1" test local
+		"$@" local test ${HOME} "$@" && "$@" $(pwd) --verbose
+		| then "$1" done printf echo local "$@" local local then echo test
+	| /usr/bin sed ${HOME} $(pwd) sed test sed
+		export 'quoted text' echo ${HOME}
+	${HOME} && cd -eu test && awk sed /usr/bin
+echo grep 2>/dev/null grep "$1" grep
+		${HOME} "$@" sed grep then | printf
+readonly echo then test && 'quoted text' 'quoted text' 'quoted text'
+printf echo export printf "$@" --verbose sed export $(pwd) && "$1" done &&
+sed cd $(pwd) cd 2>/dev/null ${HOME} awk then -eu grep then
+	&& grep 'quoted text' | "$@" && grep cd 'quoted text' done
+	export 2>/dev/null local done
+2>/dev/null done "$1" "$1" | $(pwd) printf printf cd
+		test | printf printf sed /usr/bin "$@"
+		"$@" awk awk cd printf -eu ${HOME} grep grep readonly --verbose done then awk test
+readonly && -eu cd && | cd 'quoted text' && printf readonly
+		sed readonly cd -eu echo "$1" "$@" export |
+cd export 2>/dev/null && -eu $(pwd) | local 2>/dev/null -eu done
+	echo "$1" "$@" "$1" test /usr/bin awk | x=1 | sed done echo x=1
+		/usr/bin ${HOME} x=1 "$@"
+	test ${HOME} "$@" x=1 2>/dev/null
+	"$@" "$@" cd done test sed awk readonly "$@" -eu "$1" readonly grep /usr/bin readonly
+--verbose grep x=1 | echo grep local x=1 done echo echo cd x=1 echo "$@"
+	echo echo -eu | local done -eu local $(pwd)
+		"$1" 2>/dev/null --verbose
+	${HOME} local /usr/bin
+		awk printf 2>/dev/null readonly
+'quoted text' --verbose cd echo export
+local cd sed echo awk export && | export grep echo ${HOME} local
+		then 2>/dev/null grep && x=1 $(pwd) x=1 "$@" "$1" then -eu printf | then
+		export 2>/dev/null "$1" test x=1 x=1 sed 2>/dev/null /usr/bin
+"$1" echo echo ${HOME} "$@" 2>/dev/null | "$@" && printf cd
+	test "$1" -eu done "$1" awk
+printf --verbose -eu 2>/dev/null test
+cd test "$1" 2>/dev/null -eu test 'quoted text'
+	-eu export printf --verbose echo readonly
+/usr/bin cd readonly echo
+	2>/dev/null | "$@" cd printf awk readonly "$1"
+		done done --verbose x=1 sed readonly cd | printf | local ${HOME} printf /usr/bin
+	echo 2>/dev/null test sed "$1" printf -eu grep /usr/bin awk 'quoted text'
+/usr/bin "$@" | $(pwd) awk readonly readonly cd |
+		/usr/bin && export grep then | grep | "$@" | 'quoted text' 'quoted text' |
+readonly local grep printf && "$@" then | readonly
+		'quoted text' "$1" /usr/bin awk $(pwd) ${HOME} -eu ${HOME}
+		local 'quoted text' --verbose
+	2>/dev/null "$1" "$1"
+		&& "$@" awk $(pwd) then /usr/bin awk $(pwd) readonly -eu awk readonly
+| printf -eu /usr/bin
+		awk $(pwd) then done local --verbose
+--verbose -eu awk local grep "$@" awk awk "$1" local grep x=1 grep test "$1"
+	awk then $(pwd) | awk -eu then --verbose "$1"
+$(pwd) "$@" "$@" grep test done export -eu 2>/dev/null sed then
+		local ${HOME} readonly /usr/bin printf
+	${HOME} "$@" $(pwd) printf 'quoted text' local "$1" -eu /usr/bin
+		done | printf 2>/dev/null 'quoted text' sed /usr/bin x=1 echo
+'quoted text' -eu readonly /usr/bin 'quoted text'
+"$@" export ${HOME} grep $(pwd) 2>/dev/null then "$1" $(pwd) echo /usr/bin $(pwd)
+		x=1 test then printf -eu echo --verbose 2>/dev/null awk printf && /usr/bin
+		"$@" printf cd readonly /usr/bin ${HOME} printf 2>/dev/null
+		then readonly --verbose readonly
+&& "$@" ${HOME} readonly /usr/bin awk
+		grep awk $(pwd) cd then test ${HOME} "$1" done "$@" | grep readonly
+echo "$1" then local
+	-eu awk awk 'quoted text' ${HOME} local done "$1" "$1" test && then ${HOME} "$@"
+| then local sed sed awk /usr/bin
+${HOME} test && 'quoted text' /usr/bin 'quoted text' echo
+x=1 then cd 2>/dev/null --verbose
+| --verbose export echo "$1" grep
+	$(pwd) grep | 'quoted text' /usr/bin grep /usr/bin local 'quoted text' $(pwd) awk
+		"$@" local local local readonly ${HOME}
+| awk grep cd printf | grep local cd sed then readonly export readonly /usr/bin
+$(pwd) /usr/bin -eu "$@" sed export --verbose
+&& sed export "$@" -eu cd $(pwd) then $(pwd) awk local 'quoted text'
+x=1 'quoted text' "$1" local awk && $(pwd)
+		-eu --verbose test then test awk done $(pwd) awk --verbose then cd ${HOME}
+		&& awk --verbose awk x=1
+readonly sed printf x=1 grep "$@" cd "$@" --verbose -eu "$@"
+		test "$@" "$@" 'quoted text' printf
+	printf x=1 $(pwd) --verbose
+	'quoted text' -eu local echo readonly then cd x=1 -eu ${HOME}
+	echo /usr/bin "$@" --verbose then cd
+	echo | then -eu /usr/bin sed grep
+		-eu -eu test export sed
+		${HOME} awk "$@" local then printf -eu sed --verbose
+	| x=1 "$1" echo -eu then local 2>/dev/null "$1" "$1" cd ${HOME} printf 'quoted text'
+	"$1" | -eu $(pwd) printf $(pwd)
+		x=1 printf | export 2>/dev/null echo
+| export | && echo | 2>/dev/null test
+		grep --verbose -eu printf then "$1" ${HOME} "$@" $(pwd) && export done "$@"
+	$(pwd) cd | 2>/dev/null ${HOME} /usr/bin | export local then /usr/bin grep
+x=1 done x=1 sed local grep --verbose
+	grep done grep then /usr/bin sed then $(pwd) | done then export
+"$1" then awk 'quoted text' $(pwd) ${HOME} cd &&
+	"$@" --verbose "$@" x=1 cd then grep done -eu | cd readonly cd test local
+	--verbose cd readonly done "$@" ${HOME} grep echo | local echo 'quoted text'
+	readonly local "$1" sed "$1" x=1 x=1 "$@" done "$@" printf "$1" "$1" "$@"
+		test test "$1" sed 2>/dev/null
+/usr/bin | 'quoted text' sed sed done /usr/bin
+		$(pwd) then x=1 export readonly x=1 echo printf 2>/dev/null
+		'quoted text' echo export x=1 test | 2>/dev/null readonly | awk local
+	echo && | 2>/dev/null printf then | cd local done
+	2>/dev/null awk printf x=1 done "$1" $(pwd) readonly
+		printf --verbose local
+	local sed cd done /usr/bin
+	"$@" /usr/bin printf && done cd ${HOME}
+	2>/dev/null "$1" readonly grep grep /usr/bin done grep | awk /usr/bin
+$(pwd) export then sed export then export export
+	"$1" 'quoted text' /usr/bin
+&& test local && --verbose 'quoted text' -eu cd 2>/dev/null -eu
+	readonly awk then then ${HOME} done ${HOME} "$1"
+	${HOME} awk echo 2>/dev/null then -eu cd test 'quoted text' test && -eu -eu x=1
+grep export 'quoted text' cd x=1 --verbose grep
+		--verbose x=1 -eu echo x=1 then "$1" readonly 'quoted text' sed
+		cd printf "$1" "$1" test sed
+--verbose | ${HOME} done local echo | ${HOME} awk then | &&
+	-eu "$1" 2>/dev/null 2>/dev/null
+		-eu "$1" readonly awk "$1" awk cd 2>/dev/null sed then &&
+	sed grep 2>/dev/null 'quoted text' local && $(pwd) done 2>/dev/null
+		$(pwd) then sed /usr/bin local "$1" /usr/bin && $(pwd) -eu
+&& test 'quoted text' then
+readonly echo then printf printf sed test --verbose echo -eu
+		local "$@" printf | 2>/dev/null local --verbose then grep readonly
+local then sed /usr/bin test then -eu grep 2>/dev/null -eu ${HOME}
+then readonly grep "$@" export $(pwd) cd | -eu
+&& 'quoted text' test done cd $(pwd) awk | echo export sed -eu local export
+		test echo printf /usr/bin done -eu ${HOME} echo --verbose test
+		cd "$@" --verbose awk "$@" test /usr/bin export
+--verbose | test done x=1 x=1 --verbose local cd
+printf then --verbose $(pwd) | 'quoted text' 'quoted text'
+	test test --verbose "$@" test readonly 'quoted text' printf grep test
+2>/dev/null grep sed 2>/dev/null "$1" "$@" "$@" --verbose then
+readonly --verbose readonly grep 2>/dev/null | | x=1 'quoted text' /usr/bin x=1
+/usr/bin 'quoted text' grep local then local done x=1 export |
+	test then grep $(pwd) then 'quoted text' readonly echo
+	then $(pwd) readonly -eu echo -eu export x=1 | 2>/dev/null 2>/dev/null x=1
+	printf readonly echo x=1 export --verbose cd -eu done x=1 readonly readonly
+-eu printf $(pwd) cd ${HOME} && done -eu then export test
+	--verbose export --verbose x=1 test $(pwd) && test
+awk | local export awk /usr/bin
+		cd "$@" printf -eu $(pwd) --verbose then local
+test local -eu test sed -eu
+export grep export sed 'quoted text' awk 'quoted text' $(pwd) x=1
+		${HOME} readonly /usr/bin readonly 'quoted text' --verbose
+		readonly 'quoted text' then printf x=1 done --verbose
+	export "$1" 'quoted text' 2>/dev/null "$@"
+	export local cd then cd "$@" 'quoted text' readonly 'quoted text' test
+		then then then readonly readonly | | sed
+		echo --verbose --verbose
+"$1" local then awk | "$1" grep && echo readonly && && -eu
+	grep && $(pwd) local cd -eu && printf /usr/bin export
+printf echo -eu "$1" x=1 $(pwd) done -eu then | echo --verbose local "$1" export
+	sed echo awk "$1" 'quoted text'
+		test $(pwd) --verbose printf "$1" -eu ${HOME}
+		&& cd readonly echo 'quoted text'
+	export /usr/bin | "$1" cd /usr/bin grep 2>/dev/null
+		cd echo --verbose | --verbose done "$@" cd sed --verbose 'quoted text' x=1 |
+		"$@" ${HOME} then | 'quoted text'
+'quoted text' grep --verbose --verbose awk cd "$@" echo $(pwd) 'quoted text' &&
+-eu && then && awk "$@" echo "$1"
+printf $(pwd) -eu x=1 /usr/bin -eu "$@" -eu && "$@"
+		cd echo && $(pwd) test x=1 -eu then test -eu test
+${HOME} 'quoted text' awk sed && 'quoted text' "$1"
+${HOME} 'quoted text' --verbose "$1" local $(pwd)
+		cd -eu cd x=1 then ${HOME}
+	&& printf readonly echo sed readonly awk 'quoted text' cd
+	| grep && /usr/bin awk then x=1 $(pwd) --verbose
+		printf echo 2>/dev/null 'quoted text' "$@" | export && echo x=1 2>/dev/null
+		--verbose && readonly x=1 'quoted text'
+		export "$1" /usr/bin x=1 /usr/bin --verbose
+		done ${HOME} done --verbose awk then echo test echo --verbose 'quoted text'
+		local 'quoted text' echo export then
+	grep "$1" then export then $(pwd) --verbose x=1 done cd | cd 'quoted text'
+	readonly "$@" local x=1 -eu x=1 done cd
+	done printf local sed sed local 'quoted text' 2>/dev/null $(pwd) readonly | 'quoted text'
+	/usr/bin echo "$1" grep echo | readonly 2>/dev/null
+&& grep export local awk $(pwd) 2>/dev/null awk done
+	2>/dev/null --verbose && export awk ${HOME} -eu ${HOME}
+--verbose done readonly readonly x=1 x=1 $(pwd) | awk /usr/bin echo grep test
+"$1" x=1 $(pwd) awk 'quoted text'
+	"$1" "$1" export cd sed 'quoted text'
+	printf sed ${HOME} awk "$@" then sed ${HOME} cd test readonly
+	then printf sed /usr/bin then printf done 'quoted text' done done "$1" 2>/dev/null
+	local "$@" cd sed | cd -eu grep "$@" ${HOME} /usr/bin printf cd x=1 sed
+grep then cd printf done
+		then printf -eu "$1" printf --verbose cd export local -eu
+"$1" "$1" x=1 grep 'quoted text' readonly x=1 ${HOME}
+then /usr/bin 2>/dev/null $(pwd) export export printf awk sed test readonly
+		awk grep done done sed "$1" sed sed 2>/dev/null done "$1" "$1" grep
+	--verbose "$1" "$1" grep "$1" $(pwd) /usr/bin -eu local --verbose /usr/bin "$1"
+echo "$1" grep ${HOME} | 'quoted text'
+		-eu "$1" done printf --verbose grep 2>/dev/null --verbose 'quoted text'
+	cd /usr/bin ${HOME} readonly 2>/dev/null readonly /usr/bin &&
+echo x=1 readonly && export grep -eu ${HOME}
+echo cd test | ${HOME} "$@" test
+	${HOME} readonly && then readonly local grep sed x=1 $(pwd) cd then grep
+	x=1 x=1 export done grep then cd cd grep -eu echo test
+		export echo test "$@" x=1 echo sed local local readonly then then
+"$@" ${HOME} sed grep $(pwd) readonly test grep --verbose /usr/bin test x=1 -eu
+		cd test $(pwd) | local test 2>/dev/null /usr/bin $(pwd) 'quoted text'
+		/usr/bin then "$@" done $(pwd) --verbose awk sed then /usr/bin test
+	"$1" echo "$@" local "$1" 2>/dev/null $(pwd)
+then printf && awk -eu then --verbose grep printf awk "$@" 'quoted text'
+	local | && $(pwd) ${HOME} 2>/dev/null then "$@"
+		--verbose "$@" --verbose grep awk && && sed && --verbose sed -eu 'quoted text'
+		sed then test x=1 readonly
+	then sed -eu printf cd then done awk printf
+		/usr/bin x=1 | $(pwd) && /usr/bin | done | x=1 /usr/bin $(pwd)
+		sed -eu | --verbose printf sed "$@" done 'quoted text' cd readonly then
+x=1 echo && --verbose && test awk 'quoted text'
+done $(pwd) $(pwd) 'quoted text'
+	export --verbose sed local --verbose test
+printf cd 'quoted text' $(pwd) ${HOME}
+		local readonly 2>/dev/null grep then export /usr/bin "$1" --verbose readonly -eu
+--verbose /usr/bin cd "$1" $(pwd) && cd then $(pwd) readonly "$@" x=1 then printf
+	test then printf $(pwd) && | echo ${HOME}
+export test grep local && cd "$@" printf x=1 /usr/bin
+'quoted text' --verbose grep $(pwd)
+		awk local | printf "$1" cd | echo /usr/bin 2>/dev/null grep && echo test done
+		'quoted text' cd 2>/dev/null
+		done ${HOME} -eu "$@" done $(pwd) cd x=1 echo --verbose echo
+	"$1" | -eu done "$1" test readonly 'quoted text'
+	--verbose local readonly "$@" 2>/dev/null
+	readonly local done $(pwd) sed $(pwd) ${HOME} | "$@"
+local -eu $(pwd) echo cd cd -eu sed awk && "$@"
+-eu export "$1" awk echo sed printf
+/usr/bin echo | "$1" local 'quoted text' cd test sed local
+		$(pwd) then echo readonly
+		echo grep export printf local done grep /usr/bin /usr/bin x=1 readonly
+		/usr/bin | cd echo sed export 2>/dev/null sed "$@" x=1 $(pwd) printf /usr/bin
+/usr/bin -eu 2>/dev/null /usr/bin local 2>/dev/null
+local "$1" && | 'quoted text' local local readonly
+readonly readonly $(pwd) cd
+		done sed 2>/dev/null done "$1"
+	| --verbose echo 'quoted text' "$@"
+	grep echo awk && x=1 -eu echo 2>/dev/null | sed
+	then /usr/bin "$1" $(pwd) awk ${HOME}
+	export x=1 $(pwd) $(pwd) awk "$1" cd -eu test awk && printf export | sed 2>/dev/null
+		-eu done 'quoted text' export cd sed grep test ${HOME} | local
+	sed 2>/dev/null x=1 readonly sed then awk | grep 'quoted text' then export
+		$(pwd) x=1 local local -eu grep echo && local && test readonly
+		printf local $(pwd) echo
+-eu awk echo $(pwd) -eu
+	done "$@" echo $(pwd) | test test printf grep --verbose | "$1" 2>/dev/null
+${HOME} && x=1 "$1" sed "$@" /usr/bin echo awk $(pwd) printf awk grep export cd
+		&& && cd test x=1 then test --verbose local grep && /usr/bin
+		readonly --verbose && "$@" /usr/bin x=1 readonly
+	done readonly 'quoted text' x=1 test
+		"$@" then awk printf awk echo readonly "$@" x=1 $(pwd) export
+		| export readonly echo cd /usr/bin export x=1 awk test "$1" -eu then
+echo done readonly | | /usr/bin
+		${HOME} grep done "$@" | printf "$@" printf readonly
+	"$@" -eu ${HOME} sed $(pwd) echo export sed /usr/bin "$@" local | 'quoted text'
+		awk -eu /usr/bin x=1 local cd "$@" "$1" ${HOME} readonly --verbose | test test local
+		local printf test grep awk grep export
+	x=1 done "$1" readonly "$1" done
+		awk readonly x=1 then "$1" 'quoted text' readonly sed
+		"$1" cd /usr/bin awk "$1" then /usr/bin
+	echo | 2>/dev/null 'quoted text' | printf test "$@" 'quoted text' grep "$@"
+-eu 2>/dev/null awk -eu | done done local
+		2>/dev/null then grep $(pwd)
+		-eu echo | /usr/bin 2>/dev/null -eu grep cd grep "$@" $(pwd)
+		done done ${HOME} x=1 done
+	test $(pwd) printf sed cd 'quoted text' local echo | readonly cd echo "$@"
+		sed | then test /usr/bin
+		&& ${HOME} done 'quoted text' done 'quoted text'
+x=1 2>/dev/null readonly $(pwd) "$1" then --verbose
+		test then x=1 then 2>/dev/null x=1 local && x=1 2>/dev/null "$1" "$1"
+local --verbose export test test x=1 $(pwd) | | -eu then && grep "$1" awk cd "$@"
+sed 2>/dev/null "$1" awk grep sed "$@" cd printf cd cd 2>/dev/null local
+	test awk echo x=1 "$@" local $(pwd) printf cd x=1 echo export 'quoted text'
+		sed grep | echo | export /usr/bin
+grep --verbose /usr/bin
+	x=1 export | --verbose done 'quoted text' $(pwd) "$1" grep then readonly
+	printf test export local "$1" x=1 grep -eu "$@" $(pwd) &&
+	$(pwd) 'quoted text' 2>/dev/null | readonly /usr/bin grep local done --verbose
+	&& then "$1" "$1" test x=1 'quoted text' awk --verbose -eu done
+		export -eu test echo
+	${HOME} done awk --verbose && ${HOME} sed local
+	done export -eu grep then $(pwd) -eu awk
+	cd --verbose grep test readonly "$@" ${HOME} --verbose "$1" "$@" "$1" ${HOME}
+	awk && "$1" printf $(pwd) cd 'quoted text'
+x=1 "$1" $(pwd) ${HOME} sed ${HOME} 2>/dev/null 'quoted text'
+		| 2>/dev/null --verbose "$@" grep echo cd test
+	echo | printf local export local 2>/dev/null && echo sed grep
+--verbose test "$@" x=1 "$1" $(pwd) 'quoted text' && printf cd "$1"
+		$(pwd) ${HOME} /usr/bin awk "$@" 'quoted text'
+	export echo grep done 'quoted text'
+	${HOME} && | x=1 cd readonly sed
+		--verbose $(pwd) $(pwd) then -eu "$1" test printf ${HOME} readonly /usr/bin
+	export echo then readonly 'quoted text' $(pwd) cd ${HOME} readonly
+		printf -eu && x=1 | /usr/bin
+	local 2>/dev/null && x=1 test sed
+sed x=1 awk cd echo sed grep export grep readonly /usr/bin ${HOME}
+export 2>/dev/null then 'quoted text' cd ${HOME} 2>/dev/null
+	awk -eu "$@" && "$1" grep done
+		sed readonly x=1 readonly ${HOME}
+cd local local sed then echo awk 'quoted text' printf echo -eu 2>/dev/null
+	x=1 local -eu | local local ${HOME} export ${HOME}
+		grep 2>/dev/null grep 'quoted text'
+		awk --verbose && echo sed -eu && 2>/dev/null grep sed 'quoted text'
+sed $(pwd) -eu --verbose done 2>/dev/null awk | x=1 cd |
+2>/dev/null sed echo done -eu && | grep
+local | /usr/bin ${HOME} -eu 'quoted text'
+'quoted text' readonly grep 'quoted text' --verbose printf
+	&& echo -eu "$1" "$@" | "$1" readonly -eu export -eu x=1 /usr/bin
+	x=1 'quoted text' && local $(pwd) 'quoted text'
+then "$@" sed "$1" export
+	export cd "$@" ${HOME} $(pwd) ${HOME} echo test -eu printf x=1
+		done x=1 2>/dev/null echo
+	-eu /usr/bin then -eu &&
+	-eu $(pwd) printf export | then export local sed | test printf
+		done 2>/dev/null sed printf local /usr/bin --verbose
+	then x=1 awk echo $(pwd) ${HOME} $(pwd) sed then then 'quoted text'
+${HOME} x=1 "$1" 'quoted text' "$1" -eu x=1 done -eu 'quoted text' "$1" 2>/dev/null
+| then && echo --verbose x=1 test
+	grep 2>/dev/null grep "$@"
+		sed | 2>/dev/null -eu 'quoted text' x=1 printf 'quoted text' "$1" /usr/bin
+then x=1 --verbose readonly "$1" cd awk readonly cd | 'quoted text' then
+then local 2>/dev/null export local && test x=1
+-eu 'quoted text' test echo
+echo x=1 grep "$1" ${HOME} awk --verbose
+	'quoted text' echo sed printf && test printf x=1 x=1 2>/dev/null &&
+		'quoted text' && echo sed sed && | $(pwd) echo x=1
+"$@" -eu --verbose cd export grep cd
+		--verbose printf sed readonly
+| printf 2>/dev/null -eu "$1" x=1 cd
+x=1 ${HOME} 'quoted text' --verbose x=1
+test awk then 'quoted text' printf
+		"$1" test grep x=1 ${HOME}
+	| "$@" -eu | cd --verbose 'quoted text' 2>/dev/null test x=1 export
+	| grep readonly export local
+	test 2>/dev/null then cd sed /usr/bin cd local -eu | | ${HOME} awk awk cd --verbose
+	then echo awk done "$@" "$1" 2>/dev/null /usr/bin grep | /usr/bin echo then test
+export "$@" awk && ${HOME} $(pwd) --verbose sed then local
+'quoted text' done test readonly sed
+2>/dev/null echo "$1" awk --verbose test awk ${HOME} --verbose
+		-eu printf export test x=1 local export x=1 2>/dev/null 2>/dev/null "$1" sed echo
+	$(pwd) grep readonly local | && test
+	"$1" /usr/bin --verbose 'quoted text' -eu $(pwd) readonly 'quoted text' export
+	printf done local grep 'quoted text' readonly "$@" done
+		test | -eu 2>/dev/null cd 2>/dev/null "$1" test export done
+		&& grep awk 'quoted text' printf ${HOME} printf 2>/dev/null && grep 2>/dev/null
+echo readonly sed 'quoted text' cd awk grep export && cd $(pwd) x=1 /usr/bin test
+test done 2>/dev/null -eu cd cd sed then "$@" --verbose -eu
+		"$@" /usr/bin local -eu --verbose 'quoted text'
+		awk cd --verbose grep ${HOME} "$@" cd --verbose sed
+	printf 2>/dev/null "$1"
+"$1" "$@" readonly cd done then sed $(pwd) echo 2>/dev/null --verbose
+done -eu && printf done --verbose | awk
+	"$1" grep "$@" | local
+		"$@" awk 'quoted text' /usr/bin test readonly --verbose
+	grep x=1 echo sed x=1 sed cd local local
+	readonly printf echo done sed local ${HOME} local then awk $(pwd)
+		$(pwd) $(pwd) cd grep && awk readonly && "$@" 'quoted text'
+		sed done "$@" cd cd awk -eu then printf then
+	local awk awk --verbose
+		sed echo 'quoted text' local | --verbose /usr/bin "$1"
+		2>/dev/null printf done $(pwd) echo printf
+		&& cd -eu export 'quoted text' echo echo $(pwd) && "$1" "$1" x=1 awk then
+printf local export then ${HOME}
+	${HOME} local readonly grep then grep sed then readonly
+	'quoted text' x=1 printf printf
+		${HOME} | local readonly | export sed then 'quoted text' && cd cd grep
+readonly printf readonly
+		'quoted text' grep ${HOME} readonly "$@" 'quoted text'
+		sed sed && | sed then grep --verbose readonly | test -eu "$@"
+&& then readonly sed ${HOME} /usr/bin export readonly $(pwd) readonly grep done
+		local readonly sed echo export done sed grep export --verbose test
+then ${HOME} x=1 /usr/bin 'quoted text' 'quoted text' 2>/dev/null
+	then done /usr/bin done ${HOME} then --verbose local
+-eu | awk echo local export 2>/dev/null
+sed then export ${HOME} && test | then 2>/dev/null done readonly | && printf
+readonly export cd ${HOME} test printf $(pwd) printf grep
+'quoted text' printf cd ${HOME} $(pwd)
+"$@" cd then awk ${HOME} grep 2>/dev/null awk awk x=1 "$@" export then
+		sed readonly done export x=1 && 2>/dev/null | cd local printf then
+	printf /usr/bin awk "$@" 'quoted text' then local export ${HOME}
+$(pwd) x=1 | -eu readonly cd | test
+echo 'quoted text' --verbose x=1 awk printf | printf printf "$1" --verbose
+		"$1" grep --verbose local -eu
+		test done -eu "$@" done local
+local cd echo printf printf export done /usr/bin
+--verbose readonly echo 2>/dev/null --verbose
+		then | && sed 2>/dev/null done ${HOME} echo
+		&& $(pwd) "$@" done export ${HOME}
+cd then | done "$@" then
+	-eu awk printf $(pwd) /usr/bin done cd -eu --verbose
+	${HOME} "$1" $(pwd) grep "$1" | $(pwd) test done sed --verbose
+		"$@" /usr/bin done ${HOME} done $(pwd) echo --verbose
+local 2>/dev/null readonly readonly export
+		awk 2>/dev/null x=1 export
+readonly ${HOME} "$1" --verbose echo | | cd local printf "$1" printf cd -eu
+		printf test "$1" done | test /usr/bin -eu then readonly grep
+	printf done sed "$1" grep done then | 'quoted text' $(pwd) ${HOME} then
+&& sed 'quoted text' /usr/bin readonly
+2>/dev/null /usr/bin "$1" readonly
+sed done test echo sed && ${HOME} $(pwd) export ${HOME} "$1" -eu "$@"
+		| && cd export export done then cd 2>/dev/null "$1"
+--verbose 2>/dev/null test sed
+	-eu done 2>/dev/null echo sed | 'quoted text' local x=1 done --verbose export awk
+${HOME} /usr/bin readonly sed x=1 x=1
+		"$1" grep readonly sed then
+		echo | export "$1" $(pwd) && | 'quoted text' | --verbose cd export && ${HOME}
+${HOME} --verbose done --verbose "$@" /usr/bin export readonly awk local export
+	"$1" 2>/dev/null ${HOME}
+2>/dev/null && export printf then 'quoted text' printf --verbose export x=1 2>/dev/null
+2>/dev/null ${HOME} awk /usr/bin
+		then ${HOME} -eu printf 2>/dev/null
+	local ${HOME} test then echo
+	'quoted text' export "$@" -eu then
+	awk printf "$@" export done then
+	echo sed done grep "$@" --verbose
+		| "$@" local ${HOME} 'quoted text' /usr/bin $(pwd) --verbose printf awk local
+	then && then ${HOME} /usr/bin
+x=1 2>/dev/null 2>/dev/null then && echo then "$@"
+	"$1" then local awk -eu $(pwd) awk -eu && "$1" grep 2>/dev/null then printf export
+readonly printf awk 2>/dev/null sed awk | 2>/dev/null awk
+	test printf "$@" /usr/bin --verbose "$@" echo printf 'quoted text' grep
+		x=1 sed grep 'quoted text' /usr/bin
+		&& echo local export && test cd ${HOME} $(pwd) sed readonly -eu test
+${HOME} "$1" awk awk
+	grep ${HOME} readonly export
+	printf echo 2>/dev/null cd readonly export done x=1 | -eu awk "$1"
+		| /usr/bin printf "$1" -eu printf echo echo awk -eu test "$1" "$@" sed grep
+	&& && awk x=1 "$1" printf $(pwd) "$1" test sed "$1" | x=1 --verbose test
+	readonly done export &&
+		$(pwd) test 'quoted text'
+	"$@" 2>/dev/null then done done printf grep grep && readonly
+	grep sed echo x=1 -eu echo -eu sed export awk "$@" then 'quoted text'
+x=1 echo export $(pwd)
+		/usr/bin echo $(pwd) --verbose
+grep x=1 -eu -eu --verbose
+		export sed x=1 2>/dev/null | sed
+	done ${HOME} cd /usr/bin $(pwd) local && sed 'quoted text'
+		--verbose ${HOME} 'quoted text'
+	grep /usr/bin x=1 export ${HOME} done /usr/bin
+		local $(pwd) echo test done sed export $(pwd) then | cd sed
+"$1" -eu sed "$@" grep /usr/bin $(pwd) awk 'quoted text'
+printf /usr/bin 2>/dev/null ${HOME} 'quoted text'
+	$(pwd) grep x=1 -eu -eu local ${HOME}
+		'quoted text' readonly printf then $(pwd) ${HOME} ${HOME}
+	&& local $(pwd) cd grep "$@" "$1" test x=1 test
+	then -eu test $(pwd) | | $(pwd) awk "$1" -eu grep printf sed
+	2>/dev/null --verbose 'quoted text'
+		2>/dev/null "$1" | &&
+		"$1" echo sed export
+		--verbose local x=1 done 2>/dev/null |
+	2>/dev/null local then "$1"
+		/usr/bin 'quoted text'
+-eu && awk 'quoted text' export "$@" grep "$1" export cd $(pwd) test
+	cd grep x=1 local awk 'quoted text' sed test --verbose local x=1 grep local
+echo "$1" 2>/dev/null 'quoted text' test printf printf local
+		readonly local grep local printf sed echo
+	readonly && then "$@" --verbose | echo "$1" x=1 test
+&& cd cd sed ${HOME} awk -eu readonly echo echo
+	cd && /usr/bin "$@" "$@" local ${HOME} printf cd export | sed
+	--verbose x=1 ${HOME} | && done "$@" then "$@"
+grep x=1 | 'quoted text' echo 2>/dev/null
+then readonly readonly "$@" "$1" 'quoted text' | readonly $(pwd)
+/usr/bin printf printf test 2>/dev/null --verbose grep grep sed printf
+	done readonly export --verbose x=1 2>/dev/null
+	x=1 ${HOME} sed --verbose then sed sed 2>/dev/null $(pwd)
+	$(pwd) echo printf echo 2>/dev/null "$@"
+		"$@" local && grep echo local then sed test 2>/dev/null 'quoted text' sed
+	echo local local | export && $(pwd) then -eu ${HOME} grep | awk x=1 'quoted text'
+	test test $(pwd) cd local 2>/dev/null
+	--verbose /usr/bin && grep sed "$1" && export done then grep awk
+		printf cd then ${HOME} 'quoted text' $(pwd) cd ${HOME} then
+printf x=1 sed cd echo && awk "$@" local | -eu local local -eu
+		&& grep readonly | export 'quoted text' -eu "$@"
+readonly /usr/bin "$1" $(pwd) "$1" $(pwd) 'quoted text' --verbose
+		'quoted text' local then 'quoted text' test /usr/bin cd x=1
+		${HOME} readonly ${HOME} 'quoted text' awk $(pwd) sed echo awk --verbose
+		local && -eu readonly | test awk | cd sed --verbose
+		-eu /usr/bin test "$@" export |
+| /usr/bin | done -eu sed grep done echo export ${HOME} /usr/bin
+readonly cd local cd echo 2>/dev/null test "$1"
+"$1" printf then awk $(pwd) cd done x=1 sed export "$@" echo readonly
+"$1" "$@" /usr/bin awk local "$1" printf export test sed then export 2>/dev/null
+	then $(pwd) x=1 && sed local x=1 "$1" -eu
+test "$@" x=1 export sed local ${HOME} 'quoted text'
+	export 2>/dev/null local --verbose | 'quoted text' x=1 | done | printf
+-eu readonly sed then /usr/bin "$1"
+	printf local then && then $(pwd) --verbose --verbose done then export printf x=1
+	-eu echo awk export 2>/dev/null | export ${HOME} && &&
+	readonly --verbose 2>/dev/null
+test -eu export /usr/bin "$@" sed -eu local readonly x=1 /usr/bin
+		readonly readonly done | printf sed && grep done && 'quoted text' --verbose
+	sed local && test "$1" ${HOME} test local -eu awk echo
+	done readonly cd | test | echo | sed "$1"
+done --verbose && "$@" export then --verbose "$@" sed --verbose "$@"
+		export then printf "$1" ${HOME} sed x=1 && readonly export awk ${HOME} -eu then
+	sed export grep $(pwd) x=1 "$@" then
+		"$1" 2>/dev/null $(pwd) printf x=1 'quoted text' 2>/dev/null printf printf
+/usr/bin grep sed "$1" "$1" printf
+| export test grep export cd | | -eu "$1" then export sed awk then
+		export 2>/dev/null "$@"
+		local -eu 2>/dev/null --verbose awk echo cd then
+	sed "$@" && sed grep printf $(pwd) | export printf ${HOME} export
+		done grep done $(pwd) echo
+2>/dev/null /usr/bin x=1 2>/dev/null /usr/bin --verbose "$@"
+		| 2>/dev/null ${HOME} local then test local -eu readonly grep
+x=1 -eu x=1 printf ${HOME} then "$1" then
+	test readonly export export cd then export -eu "$@"
+awk echo echo cd --verbose
+	"$1" readonly | sed ${HOME} --verbose ${HOME}
+	export ${HOME} 2>/dev/null grep 2>/dev/null
+grep ${HOME} awk echo ${HOME} $(pwd) done
+		printf awk echo | then then | --verbose test
+		test test local "$@" $(pwd) x=1 $(pwd) local export "$@" export awk /usr/bin
+	then local test printf $(pwd) -eu ${HOME}
+	--verbose sed "$@" done x=1 ${HOME} -eu /usr/bin awk sed done | done test test
+		"$1" 2>/dev/null sed printf
+"$1" ${HOME} $(pwd) && "$@" -eu $(pwd)
+	then grep sed --verbose readonly readonly "$1" then local printf local
+-eu -eu x=1 export /usr/bin x=1 --verbose done test $(pwd) /usr/bin
+	$(pwd) && x=1 readonly sed printf then "$1" x=1 done grep sed
+		-eu then printf /usr/bin "$@" local && $(pwd)
+		'quoted text' echo $(pwd) x=1 -eu x=1 $(pwd) sed grep export then
+| awk && "$@" /usr/bin
+	cd grep then echo && then awk local x=1 2>/dev/null
+	done sed cd done ${HOME} readonly
+	local readonly x=1 "$1" /usr/bin grep | 2>/dev/null export --verbose
+		awk && test export export export 2>/dev/null cd -eu "$1" "$1"
+		export x=1 && awk cd awk -eu "$@" then echo echo printf readonly
+printf export 'quoted text' $(pwd)
+		cd export -eu cd /usr/bin local
+	sed "$@" -eu x=1 "$@" printf && then ${HOME} readonly
+local --verbose echo then local then -eu done 2>/dev/null "$1" "$1"
+	"$1" ${HOME} -eu then then done sed 2>/dev/null $(pwd) 2>/dev/null
+awk && local test $(pwd)
+	local done && export --verbose local local 2>/dev/null done cd $(pwd) test
+	done 'quoted text' cd export x=1 then $(pwd) awk $(pwd) readonly -eu
+	--verbose $(pwd) x=1 then && 2>/dev/null
+"$1" then "$@" echo "$@" x=1 awk "$@" 2>/dev/null local done grep
+	x=1 "$@" echo then then then /usr/bin grep sed printf "$1" "$1"
+	printf then 2>/dev/null printf echo
+test 2>/dev/null sed $(pwd) 'quoted text' readonly | 2>/dev/null
+	done echo x=1 && --verbose -eu echo echo
+		grep 2>/dev/null printf 2>/dev/null 2>/dev/null
+		local sed --verbose cd | cd 2>/dev/null 2>/dev/null awk 2>/dev/null "$1"
+export test test $(pwd) /usr/bin /usr/bin
+		$(pwd) /usr/bin sed 'quoted text' grep
+"$1" sed export grep $(pwd) && test "$@"
+local done --verbose test test grep sed x=1 grep local | | "$1" --verbose
+grep /usr/bin export && export | readonly /usr/bin local
+		sed $(pwd) cd $(pwd) $(pwd) --verbose
+test grep 2>/dev/null
+/usr/bin then -eu -eu grep
+		"$@" $(pwd) x=1 readonly -eu 2>/dev/null printf local cd
+		test awk test readonly
+		then local /usr/bin then cd
+readonly | export -eu export grep --verbose export && $(pwd) echo export
+	$(pwd) done x=1 x=1 ${HOME} x=1 --verbose
+| $(pwd) export export ${HOME} cd "$@"
+x=1 grep /usr/bin /usr/bin sed sed echo export
+"$1" awk | 2>/dev/null sed 'quoted text' "$@" 'quoted text'
+${HOME} sed | test $(pwd) echo sed readonly echo && test 'quoted text'
+| -eu sed && "$@" grep | sed | /usr/bin
+	x=1 'quoted text' echo ${HOME} echo echo printf /usr/bin
+		test export | 'quoted text'
+		test $(pwd) x=1 export export awk ${HOME} && | echo export
+printf "$@" awk export cd cd printf echo cd grep
+	&& $(pwd) | test done printf test done --verbose done sed test cd
+		'quoted text' 'quoted text' sed
+grep local export "$1" ${HOME}
+	--verbose then then printf grep 2>/dev/null sed echo printf done
+	echo echo 'quoted text' 'quoted text' sed 'quoted text' printf && local local
+then grep "$1" /usr/bin 2>/dev/null -eu test cd /usr/bin done $(pwd) local $(pwd)
+	--verbose $(pwd) sed printf "$1" x=1 sed printf
+		local export echo "$@" -eu
+then grep export 2>/dev/null ${HOME} "$@" $(pwd) then --verbose echo then local
+${HOME} sed && && "$@" export $(pwd) && "$1" "$@" done /usr/bin ${HOME} then
+		| /usr/bin then /usr/bin
+	then | && then /usr/bin -eu | awk export
+/usr/bin 2>/dev/null
+grep readonly then 'quoted text' cd "$1" && -eu readonly --verbose
+		-eu "$@" | 2>/dev/null -eu && 2>/dev/null
+2>/dev/null -eu awk export ${HOME}
+readonly sed "$@" "$@" awk --verbose
+		test test && | sed && $(pwd) sed export -eu && --verbose 2>/dev/null grep
+		readonly x=1 x=1 --verbose
+		"$1" readonly cd readonly awk 'quoted text'
+	test $(pwd) "$1" && | "$@" | $(pwd)
+	| sed echo local export done echo echo $(pwd) cd "$@" grep ${HOME} 2>/dev/null
+sed awk 'quoted text' readonly test
+	readonly $(pwd) readonly "$1" echo done
+	"$@" printf "$@" test export --verbose test /usr/bin
+${HOME} /usr/bin --verbose ${HOME} ${HOME} | 'quoted text' echo printf readonly
+		2>/dev/null echo x=1 "$1" cd echo echo
+sed x=1 export ${HOME} awk && printf | | && | "$@" ${HOME} printf local cd
+		sed 2>/dev/null local "$1" -eu
+${HOME} cd sed | export done x=1 done --verbose --verbose awk -eu -eu done
+	&& grep export awk echo local awk $(pwd) cd | test test | "$1"
+		grep x=1 --verbose sed done sed
+	/usr/bin ${HOME} then done && 2>/dev/null "$@" | /usr/bin 2>/dev/null -eu
+	local | sed echo echo 2>/dev/null ${HOME} test ${HOME} "$@" done -eu cd echo
+		export grep && sed printf then --verbose
+		--verbose /usr/bin export
+		sed then test sed test cd ${HOME} 2>/dev/null
+		cd /usr/bin sed && printf "$1"
+	cd --verbose -eu export 'quoted text'
+local test printf 'quoted text' then --verbose "$@"
+		'quoted text' --verbose readonly 'quoted text'
+	sed local test $(pwd) echo && grep local sed | echo readonly &&
+| -eu echo 2>/dev/null local | done test -eu /usr/bin readonly
+$(pwd) "$@" printf -eu echo 'quoted text' x=1 done echo echo awk readonly test x=1
+		-eu echo | echo "$@" /usr/bin
+	printf x=1 $(pwd) 2>/dev/null
+		printf grep -eu x=1 echo x=1 done "$@"
+	-eu done $(pwd) "$@" printf test awk
+	local --verbose done readonly cd 'quoted text'
+		readonly && /usr/bin local
+	then sed && ${HOME} then --verbose then echo --verbose echo /usr/bin
+local | done local export test
+export cd echo then 'quoted text'
+		x=1 done printf --verbose local export 'quoted text'
+${HOME} test && then sed "$@" "$@" readonly
+		'quoted text' | test -eu /usr/bin "$1" echo 2>/dev/null
+printf "$@" printf sed export export --verbose then 'quoted text'
+	echo local awk test cd printf local test sed cd | 'quoted text' cd /usr/bin
+		${HOME} | local test && printf ${HOME}
+		printf echo ${HOME} 2>/dev/null grep ${HOME} 'quoted text' $(pwd) x=1 readonly
+		cd printf --verbose cd printf -eu 'quoted text' test awk export done
+		$(pwd) | test "$1" echo && then ${HOME} /usr/bin $(pwd)
+echo ${HOME} then test echo sed | sed cd -eu cd export cd "$1" -eu
+		&& then grep test local /usr/bin $(pwd) cd done x=1 && printf --verbose | local
+		printf sed export then -eu printf export grep && $(pwd) printf --verbose
+--verbose 'quoted text'
+		readonly --verbose "$1" export local then && "$1"
+		export awk 'quoted text' 2>/dev/null cd awk
+		grep -eu sed local test /usr/bin -eu $(pwd) done && "$1"
+grep 2>/dev/null 2>/dev/null
+local local "$@" ${HOME} then ${HOME} grep then then | test x=1 test printf | test
+		${HOME} && test | 2>/dev/null
+then | 2>/dev/null "$@" sed --verbose readonly | $(pwd)
+		/usr/bin $(pwd) && /usr/bin $(pwd) sed && cd printf done awk test sed "$@" printf
+printf sed $(pwd) -eu printf 'quoted text'
+	--verbose --verbose printf ${HOME} "$1"
+	awk && cd $(pwd) "$1" grep echo 'quoted text'
+		test export /usr/bin "$1" readonly local "$1" grep &&
+readonly cd /usr/bin local 'quoted text' "$1" x=1 ${HOME}
+awk "$@" then awk $(pwd) printf /usr/bin
+export x=1 $(pwd) x=1
+		cd awk 2>/dev/null then "$@" 2>/dev/null --verbose |
+	export /usr/bin readonly then /usr/bin printf 2>/dev/null grep -eu &&
+/usr/bin test --verbose export echo
+		awk awk /usr/bin $(pwd) 2>/dev/null
+test then local local then local && then ${HOME} printf "$@" then grep
+"$@" 'quoted text' x=1 test local cd ${HOME} local cd printf
+		local test sed | ${HOME} | echo sed done printf 'quoted text' awk readonly
+local sed && 2>/dev/null awk sed readonly done awk readonly
+	--verbose done cd $(pwd) echo local "$1" -eu readonly --verbose test "$@" | "$@"
+	done ${HOME} "$@" test x=1 x=1 echo $(pwd) awk |
+		awk printf | awk echo grep $(pwd) | --verbose sed --verbose | && | grep 2>/dev/null
+	--verbose test | x=1 done awk readonly |
+	2>/dev/null "$@" ${HOME} 2>/dev/null then /usr/bin sed "$@" $(pwd)
+		done test test -eu $(pwd) /usr/bin then
+	grep x=1 cd $(pwd) 2>/dev/null local
+sed ${HOME} local test test cd sed grep echo "$@" printf --verbose -eu
+readonly -eu export then "$1" done -eu -eu "$@" -eu done | && readonly
+		local export $(pwd) /usr/bin
+	awk done export ${HOME} -eu ${HOME} 'quoted text' sed
+		readonly -eu sed /usr/bin echo 'quoted text' "$1" "$1" -eu local 'quoted text'
+	sed grep echo printf 2>/dev/null local then ${HOME} grep
+&& 'quoted text' /usr/bin "$1" export grep grep "$@" /usr/bin --verbose
+'quoted text' test $(pwd) readonly export &&
+		printf "$@" $(pwd) $(pwd)
+readonly "$1" done done printf
+	| test $(pwd) "$1" test x=1 'quoted text'
+	&& readonly 'quoted text' /usr/bin 2>/dev/null printf then
+/usr/bin cd printf then grep readonly test 2>/dev/null /usr/bin /usr/bin
+${HOME} 2>/dev/null && "$1" && ${HOME} awk sed then $(pwd) then
+		readonly 'quoted text' ${HOME} 2>/dev/null 2>/dev/null --verbose printf
+/usr/bin 'quoted text' --verbose readonly awk done | ${HOME}
+test 2>/dev/null ${HOME} "$@"
+		printf ${HOME} -eu cd /usr/bin ${HOME} done sed
+		grep ${HOME} test | -eu sed readonly done
+done export 2>/dev/null local sed sed readonly sed && grep then
+	'quoted text' done done export awk grep sed done
+		/usr/bin 2>/dev/null local ${HOME} printf "$@" grep
+		| "$1" $(pwd) x=1 "$@" awk "$1" echo then local /usr/bin ${HOME}
+2>/dev/null local printf "$1" echo "$@"
+	/usr/bin sed "$@" "$1" cd "$1" echo "$@" --verbose test export
+		grep grep ${HOME} export $(pwd) x=1
+	$(pwd) test 2>/dev/null awk --verbose local awk x=1 grep printf test $(pwd)
+		2>/dev/null 2>/dev/null | echo -eu "$@" echo 'quoted text' "$1" && test 2>/dev/null
+		"$@" --verbose sed readonly then awk x=1 | &&
+2>/dev/null echo cd -eu "$1" cd --verbose /usr/bin 'quoted text' cd printf
+		/usr/bin | "$1" --verbose -eu grep cd awk && /usr/bin $(pwd) printf
+| && grep ${HOME} "$1" awk /usr/bin --verbose awk cd grep
+		echo --verbose export printf -eu ${HOME} local export
+		done --verbose export done printf grep 2>/dev/null
+grep readonly -eu cd sed export sed grep
+test done readonly && awk "$@" awk --verbose
+		local sed echo local printf 'quoted text'
+sed x=1 | "$@" test echo readonly && ${HOME} local x=1 printf
+--verbose local 2>/dev/null grep x=1 && printf -eu cd local then readonly test
+		awk 'quoted text' && done printf sed 'quoted text' 'quoted text'
+	awk echo --verbose sed echo cd awk sed && printf 2>/dev/null 2>/dev/null printf
+	readonly cd grep done "$@" && local
+	--verbose echo --verbose 2>/dev/null sed sed
+"$@" sed --verbose printf awk printf
+		'quoted text' $(pwd) sed 'quoted text'
+&& $(pwd) $(pwd) x=1 printf readonly "$@" test printf
+		| && ${HOME} printf "$@" && then | "$@" cd echo 'quoted text' sed
+		readonly -eu | test "$@" x=1 cd "$1" sed "$1"
+		grep "$1" /usr/bin export
+		printf readonly x=1 "$@" readonly
+		test readonly awk cd echo printf -eu cd awk awk "$@" export
+	echo readonly sed && "$1" "$1" -eu
+		"$@" printf export 2>/dev/null | done | "$@" x=1 local $(pwd)
+		| x=1 printf 2>/dev/null
+$(pwd) | awk "$@" ${HOME} awk $(pwd) $(pwd) --verbose | 'quoted text'
+		--verbose local echo done && /usr/bin "$@" echo echo sed | done && /usr/bin
+		"$1" "$1" "$1" test --verbose then | local
+x=1 test 2>/dev/null 'quoted text'
+"$@" sed local readonly readonly sed export local awk printf done 'quoted text'
+	export test x=1 x=1 --verbose ${HOME} /usr/bin
+	export && ${HOME} done && echo echo printf | /usr/bin
+		readonly printf "$@" ${HOME} "$@" 2>/dev/null grep grep | export local grep "$@"
+${HOME} cd done printf "$1" export export && /usr/bin ${HOME}
+done /usr/bin ${HOME} ${HOME} readonly x=1 -eu -eu test
+	cd done done /usr/bin printf echo 2>/dev/null
+	grep test echo "$@" done local
+	--verbose ${HOME} readonly printf cd then sed /usr/bin sed cd --verbose awk
+	done grep && cd x=1 echo x=1 then x=1 x=1 test $(pwd)
+		awk echo export awk export | "$@" echo awk echo --verbose local readonly
+	then test 2>/dev/null grep
+export $(pwd) -eu sed "$@" $(pwd) /usr/bin cd local local
+awk sed readonly && done grep printf done | local 'quoted text'
+		'quoted text' readonly "$1" /usr/bin awk
+		then echo echo sed 'quoted text' export
+		| ${HOME} 2>/dev/null x=1 cd &&
+--verbose sed "$1" local "$@" --verbose local -eu 'quoted text'
+	export test "$1" 'quoted text'
+		export 2>/dev/null printf /usr/bin readonly 'quoted text'
+	| echo $(pwd) done export | readonly test "$@" "$@" && 'quoted text' test
+sed "$@" echo | export 'quoted text' 2>/dev/null -eu then x=1 'quoted text'
+	test x=1 test /usr/bin test echo cd echo local ${HOME} readonly
+awk 'quoted text' 2>/dev/null then export cd awk 'quoted text' "$1" --verbose
+		done readonly sed grep 'quoted text' readonly
+	-eu test 'quoted text' export echo printf export
+local cd "$1" -eu export 'quoted text' --verbose -eu && awk
+		&& readonly | 2>/dev/null /usr/bin x=1 printf local then cd awk -eu awk export
+	&& done -eu "$1" "$@" readonly grep readonly local $(pwd) awk
+test $(pwd) --verbose /usr/bin then sed -eu -eu && /usr/bin /usr/bin
+grep grep x=1 $(pwd) x=1 && --verbose
+		echo then readonly -eu
+| /usr/bin | readonly printf $(pwd) x=1 --verbose --verbose
+	awk $(pwd) then "$1" -eu
+	export echo export -eu "$1" printf && awk then done awk
+"$@" --verbose 'quoted text' printf -eu test sed sed "$1" echo --verbose
+$(pwd) then cd printf ${HOME} "$@" printf
+	awk printf "$@" sed awk test printf test $(pwd) 'quoted text' done local sed "$1"
+	test && grep | awk -eu cd x=1 --verbose awk -eu printf ${HOME} /usr/bin "$1" "$1"
+	test x=1 -eu then readonly done "$@" grep grep && --verbose
+	| sed test done readonly local awk 2>/dev/null $(pwd) --verbose && $(pwd)
+${HOME} 'quoted text' 'quoted text'
+	"$@" x=1 x=1 cd /usr/bin
+		cd printf printf cd cd printf test test test --verbose 2>/dev/null
+	test done "$1" grep /usr/bin export
+export then /usr/bin "$1" | echo --verbose readonly /usr/bin
+		local "$@" sed && export done export 'quoted text' readonly ${HOME}
+	x=1 then "$1" 'quoted text' $(pwd) -eu "$1" | --verbose x=1 cd /usr/bin
+'quoted text' "$@" export grep x=1 $(pwd) then
+	export | 2>/dev/null && awk ${HOME} 'quoted text'
+		-eu "$1" "$@" "$1" grep "$@" | && test then printf cd -eu x=1
+	echo awk printf | | ${HOME} ${HOME} echo
+	2>/dev/null grep grep local local "$1" sed readonly
+	echo "$1" done /usr/bin awk "$@" echo $(pwd) x=1 && --verbose
+		export $(pwd) x=1 test cd | -eu then test -eu awk sed done && && -eu
+		done test echo "$@" readonly 'quoted text' x=1 sed /usr/bin "$@" /usr/bin
+x=1 export -eu 'quoted text'
+| $(pwd) test done | echo
+	--verbose && done && echo readonly | /usr/bin done "$@" --verbose ${HOME} export
+	cd then x=1 grep cd --verbose
+		2>/dev/null echo done 'quoted text' export readonly |
+		echo cd awk done sed ${HOME} "$@" $(pwd) sed x=1 test
+		2>/dev/null ${HOME} /usr/bin | readonly echo grep grep /usr/bin
+	&& readonly "$1" echo cd
+		-eu /usr/bin printf local ${HOME} echo sed && cd printf export "$1" -eu ${HOME}
+		sed cd && printf | cd /usr/bin awk done $(pwd) ${HOME} 2>/dev/null ${HOME}
+readonly test $(pwd) x=1 "$1" then
+	"$@" readonly x=1 done export 'quoted text' cd /usr/bin 'quoted text'
+		grep readonly "$1" test export printf 'quoted text' /usr/bin printf
+		printf local 2>/dev/null grep $(pwd) 'quoted text' printf
+&& cd then awk 2>/dev/null done "$1"
+printf && awk /usr/bin /usr/bin -eu 'quoted text' echo $(pwd) cd
+	'quoted text' then --verbose && "$1" | 2>/dev/null | sed -eu
+		"$@" /usr/bin echo "$1" | $(pwd) done echo local printf 2>/dev/null | test
+	sed echo "$@" readonly grep $(pwd) x=1 grep | "$1" "$1" && /usr/bin
+	| local | 2>/dev/null readonly | local export then readonly local printf $(pwd)
+&& /usr/bin export then local cd --verbose /usr/bin
+	done local x=1 "$@" readonly cd
+	-eu x=1 --verbose && | printf then grep sed grep ${HOME} "$@" grep
+		/usr/bin echo cd | 'quoted text' then /usr/bin ${HOME} awk ${HOME}
+/usr/bin cd cd then test -eu cd awk done test $(pwd)
+awk && /usr/bin ${HOME} done
+	done $(pwd) cd echo grep sed -eu "$@" --verbose
+${HOME} /usr/bin done export done readonly
+$(pwd) local ${HOME} && x=1 sed local grep local 2>/dev/null
+	2>/dev/null export done
+	awk && sed /usr/bin && $(pwd) -eu && x=1 sed readonly --verbose printf
+	sed readonly -eu grep --verbose
+		"$@" 'quoted text' local "$1" export -eu export awk x=1 then 'quoted text'
+	sed cd --verbose echo export $(pwd) ${HOME} echo /usr/bin -eu echo
+"$@" 2>/dev/null awk &&
+then "$@" echo $(pwd) --verbose | done test sed grep | done 2>/dev/null --verbose
+	x=1 ${HOME} echo cd awk ${HOME} ${HOME} then local 'quoted text'
+	readonly /usr/bin 2>/dev/null
+	printf local done printf sed $(pwd)
+x=1 export /usr/bin then | x=1 local "$@" -eu cd 'quoted text'
+	/usr/bin done then -eu printf --verbose
+	| && "$@" then 2>/dev/null -eu 'quoted text'
+		x=1 ${HOME} | ${HOME} | readonly "$@" --verbose
+	-eu x=1 readonly ${HOME} done x=1 cd 2>/dev/null cd
+		--verbose /usr/bin cd printf x=1 'quoted text' awk --verbose then grep grep --verbose
+		grep 2>/dev/null --verbose 'quoted text' export | readonly local
+		$(pwd) printf export && -eu echo awk "$@" cd then echo cd "$@"
+	then cd then local test | test 2>/dev/null sed test sed
+${HOME} cd test --verbose | awk export done
+	local cd --verbose readonly export /usr/bin ${HOME} && "$1" awk ${HOME} x=1
+"$1" test | 'quoted text' $(pwd)
+	done "$1" /usr/bin 'quoted text' printf echo "$@" x=1 grep 2>/dev/null sed
+		x=1 done then printf
+		/usr/bin 2>/dev/null && printf
+	sed 'quoted text' /usr/bin
+		2>/dev/null echo echo sed 'quoted text' printf 2>/dev/null readonly grep && echo
+	sed then echo ${HOME} test --verbose echo awk && awk
+done printf sed sed 2>/dev/null printf ${HOME} && | x=1
+		local --verbose | test echo "$1" $(pwd)
+	x=1 awk printf readonly --verbose sed test x=1 local echo | local echo printf
+	-eu /usr/bin "$1" then x=1
+	/usr/bin then --verbose cd | export cd test /usr/bin cd readonly $(pwd)
+/usr/bin | | 2>/dev/null local x=1 export
+	x=1 sed export x=1 --verbose readonly local
+		&& "$@" $(pwd) local cd -eu then awk -eu grep sed local then readonly
+	"$@" | local 2>/dev/null
+		2>/dev/null then awk /usr/bin
+	readonly 2>/dev/null /usr/bin cd -eu readonly 2>/dev/null
+		$(pwd) x=1 "$@" "$1" done
+	&& sed "$1" readonly --verbose | ${HOME}
+	${HOME} && export awk 2>/dev/null 2>/dev/null cd export then cd done -eu sed $(pwd)
+	| x=1 | local -eu cd readonly grep 2>/dev/null
+	2>/dev/null export 'quoted text'
+		/usr/bin awk ${HOME} readonly x=1 | $(pwd) grep | echo $(pwd) awk $(pwd) local
+	--verbose x=1 && done readonly
+	"$1" -eu readonly local awk /usr/bin -eu 2>/dev/null $(pwd) printf -eu
+-eu grep test local grep && export "$@" grep local sed && "$@"
+| | 'quoted text' cd test
+	2>/dev/null | -eu $(pwd) --verbose ${HOME} ${HOME} --verbose -eu x=1 'quoted text'
+	-eu awk "$1" | export /usr/bin cd "$@" awk done ${HOME}
+		done 'quoted text' readonly printf local
+		sed 2>/dev/null $(pwd)
+&& ${HOME} ${HOME} export && $(pwd) local printf
+#include c216.sh
+		echo "$@" /usr/bin /usr/bin awk
+$(pwd) $(pwd) "$@" 2>/dev/null /usr/bin then then then local
+		then "$@" sed && grep cd 'quoted text' export cd x=1 grep /usr/bin 'quoted text'
+	x=1 2>/dev/null echo "$@" "$@" ${HOME} "$@" local readonly
+then done local awk echo /usr/bin echo | cd ${HOME} -eu "$1" --verbose local
+		grep $(pwd) "$1" | 'quoted text'
+		awk | 'quoted text' grep readonly echo cd local
+		&& | done sed awk ${HOME} then export --verbose && grep local /usr/bin
+		"$@" local -eu "$1" test --verbose grep echo awk "$1"
+	"$@" /usr/bin 'quoted text' && "$@" --verbose
+		awk test local echo echo /usr/bin local --verbose awk | awk
+	done $(pwd) sed awk && grep "$@" then 'quoted text' printf sed grep && -eu
+		sed readonly printf done test export /usr/bin readonly "$@"
+&& /usr/bin readonly printf awk "$@" sed echo --verbose
+	| 2>/dev/null x=1 $(pwd) | -eu then echo readonly test $(pwd) export
+"$@" "$1" -eu | ${HOME} sed readonly | test | awk | grep $(pwd) test "$@"
+	${HOME} awk /usr/bin export sed 2>/dev/null sed 2>/dev/null sed cd
+/usr/bin echo --verbose cd export local
+then sed x=1 /usr/bin printf echo &&
+		local --verbose done export grep echo echo cd
+		-eu echo echo then awk $(pwd) ${HOME} cd x=1 cd x=1 then && "$@"
+test awk export | -eu "$@" local sed
+		| x=1 readonly --verbose grep $(pwd)
+test 2>/dev/null test test && --verbose test 2>/dev/null done printf
+readonly grep 'quoted text' 'quoted text' export echo x=1 echo
+		done awk 'quoted text' --verbose
+		cd $(pwd) --verbose $(pwd) awk then local export | 'quoted text'
+		cd done local | | cd echo printf /usr/bin export readonly --verbose | cd test
+"$1" grep x=1 echo /usr/bin "$1" 2>/dev/null local x=1 awk /usr/bin
+		awk printf ${HOME} then printf
+echo readonly "$1" /usr/bin
+$(pwd) -eu | then awk
+	| cd x=1 grep 2>/dev/null /usr/bin --verbose "$@" 2>/dev/null "$1"
+	--verbose "$@" grep export x=1 local cd done ${HOME}
+grep ${HOME} sed $(pwd) ${HOME} x=1
+x=1 2>/dev/null test local echo --verbose echo
+	sed ${HOME} grep cd && export printf $(pwd) local /usr/bin --verbose -eu 'quoted text'
+		--verbose awk cd && && x=1 awk done local printf | readonly echo /usr/bin
+	cd $(pwd) "$1" x=1 2>/dev/null local "$1" --verbose awk done 2>/dev/null -eu
+		awk grep && 'quoted text' $(pwd)
+		awk cd export printf $(pwd) /usr/bin
+	printf grep done --verbose
+-eu /usr/bin test readonly "$@" local then sed /usr/bin 'quoted text'
+	-eu local "$1" echo x=1 done awk --verbose done 'quoted text' then sed
+	| sed readonly x=1 $(pwd) sed x=1 /usr/bin 'quoted text' test /usr/bin test done
+	grep -eu done "$1" /usr/bin awk cd then grep /usr/bin $(pwd)
+		--verbose | echo echo grep /usr/bin export $(pwd) sed echo && test
+-eu "$@" local sed local "$@" "$1" grep ${HOME}
+-eu && ${HOME} export readonly
+	/usr/bin done done | ${HOME} "$@" 'quoted text' awk --verbose
+	grep 'quoted text' then readonly "$1" "$1"
+grep grep "$1" sed local ${HOME} echo "$1" /usr/bin
+		test -eu --verbose && "$1"
+		printf readonly echo echo | export sed readonly export test sed cd
+local done local local grep echo && 2>/dev/null
+		then 'quoted text' | 2>/dev/null $(pwd) test grep printf
+	printf echo grep /usr/bin 2>/dev/null echo | 'quoted text' 'quoted text'
+--verbose 'quoted text' ${HOME} -eu ${HOME}
+then ${HOME} echo export x=1 test
+		'quoted text' "$1" $(pwd) /usr/bin local readonly then local
+$(pwd) 'quoted text' done cd "$1"
+test | readonly 'quoted text' then x=1 cd cd echo grep
+readonly "$@" && then cd 'quoted text' readonly 'quoted text' /usr/bin
+		"$@" readonly done x=1 && 'quoted text' $(pwd) | /usr/bin ${HOME} --verbose
+		export 2>/dev/null local /usr/bin -eu | "$1" readonly local
+local echo cd echo "$1" test sed test 'quoted text' export done "$@"
+		x=1 ${HOME} test readonly test |
+&& grep $(pwd) /usr/bin readonly $(pwd)
+then test "$@" awk -eu "$@" "$@" "$@" printf grep x=1 "$@"
+'quoted text' --verbose && /usr/bin then
+		done --verbose then echo -eu /usr/bin awk "$@" awk 'quoted text'
+		--verbose test --verbose
+echo 'quoted text' local x=1 | awk $(pwd) test export test awk done local $(pwd)
+	export awk "$@" then printf | awk done local done then --verbose
+done "$@" "$@" export
+	done -eu "$@" x=1 sed readonly --verbose cd
+grep awk grep cd "$1" printf
+		sed cd echo --verbose -eu test printf
+		local printf -eu 2>/dev/null echo cd 'quoted text' && && $(pwd)
+sed test printf done | /usr/bin export
+		| --verbose printf then test readonly local then | "$1" ${HOME}
+local x=1 "$@" --verbose && -eu printf 'quoted text' "$@" local | export x=1
+	x=1 x=1 ${HOME} printf printf then export cd done | -eu "$@" sed 2>/dev/null
+	local 2>/dev/null test "$@" test $(pwd) 'quoted text' awk | done cd "$1" readonly
+	/usr/bin | "$1" | | grep done export && readonly $(pwd) cd "$@"
+done then readonly -eu cd done export awk then cd export echo "$1" echo --verbose
+"$@" --verbose $(pwd) then local --verbose /usr/bin x=1
+		"$@" sed grep readonly test
+	test && grep grep sed 'quoted text' sed test 'quoted text' "$1" done
+		export local $(pwd) && done echo echo -eu | "$@" echo 'quoted text'
+		done -eu -eu "$1" local sed echo done done "$1" ${HOME} local cd
+${HOME} /usr/bin $(pwd) echo $(pwd) 'quoted text'
+	printf test export awk /usr/bin readonly x=1 local | readonly
+$(pwd) test "$@" -eu ${HOME} grep
+	sed awk export printf export --verbose readonly ${HOME}
+		grep "$1" 2>/dev/null awk $(pwd) 'quoted text' local /usr/bin done sed
+		${HOME} test awk --verbose cd "$@" 2>/dev/null "$1" "$@" 2>/dev/null local "$@"
+		echo /usr/bin /usr/bin -eu $(pwd) && grep test 2>/dev/null
+		"$@" then x=1 grep export "$@" -eu echo && export 2>/dev/null done && x=1 ${HOME}
+		x=1 ${HOME} export printf then ${HOME} 'quoted text' "$@" awk --verbose | ${HOME}
+	'quoted text' done then -eu sed "$@" 'quoted text' printf /usr/bin
+${HOME} x=1 $(pwd) ${HOME}
+	"$1" awk "$1" 2>/dev/null | local
+	'quoted text' done test done readonly $(pwd) --verbose --verbose
+	done ${HOME} "$@" export $(pwd) && 2>/dev/null 'quoted text'
+		'quoted text' sed x=1 'quoted text' test test printf x=1 then awk done
+		2>/dev/null cd done "$@" local export 'quoted text' ${HOME}
+	&& && --verbose cd grep readonly test local $(pwd) $(pwd)
+		'quoted text' export | echo awk export x=1 "$1" && $(pwd) local x=1 cd printf
+		$(pwd) 2>/dev/null export ${HOME} export
+local sed awk echo "$1" $(pwd) --verbose 'quoted text' export
+x=1 sed "$@" 'quoted text' done sed "$@" readonly cd test
+	$(pwd) test echo sed export -eu echo 'quoted text' x=1 'quoted text' "$@"
+"$1" "$1" awk "$@" readonly readonly echo
+grep awk grep readonly echo printf -eu && export "$@" && "$@" "$1"
+		printf ${HOME} && 'quoted text' $(pwd) awk test printf ${HOME} 'quoted text'
+		--verbose readonly "$@" done test grep -eu readonly export readonly done
+	"$@" readonly "$1" local
+x=1 "$@" | "$1" | local grep export x=1 grep
+	local test ${HOME} --verbose "$@" export ${HOME} /usr/bin done 'quoted text' readonly
+done test /usr/bin awk 2>/dev/null "$@" ${HOME} echo done x=1 awk awk test
+	"$@" done done done printf export then printf x=1 'quoted text'
+'quoted text' printf "$1" grep readonly sed cd test 2>/dev/null 2>/dev/null
+		${HOME} /usr/bin export then printf | export printf ${HOME} cd "$@" /usr/bin $(pwd)
+	done then --verbose "$@" readonly
+	"$@" && /usr/bin && printf sed ${HOME} cd cd | x=1
+	export done grep cd && $(pwd) 2>/dev/null "$@" cd --verbose "$@" "$@"
+${HOME} echo awk cd 2>/dev/null ${HOME} awk grep printf readonly
+	-eu sed 2>/dev/null /usr/bin
+	/usr/bin $(pwd) done x=1 /usr/bin export awk $(pwd) local
+	$(pwd) 2>/dev/null && ${HOME} grep then grep "$@" export cd
+	test cd "$@" "$1" grep | test local
+	sed awk "$1" "$1" then -eu awk readonly && "$1" 2>/dev/null
+| echo "$1" --verbose 2>/dev/null
+		$(pwd) cd echo 'quoted text' local
+sed awk 'quoted text' printf readonly readonly
+	--verbose sed sed 'quoted text' grep echo $(pwd) 2>/dev/null awk && x=1 cd
+printf local ${HOME} 'quoted text' then awk awk test $(pwd) local done --verbose
+	${HOME} printf -eu ${HOME} $(pwd)
+		$(pwd) --verbose /usr/bin 2>/dev/null cd sed
+	-eu readonly grep echo export x=1 sed printf grep sed --verbose 'quoted text' then
+done export ${HOME} --verbose
+		sed grep cd export grep | cd local 2>/dev/null /usr/bin
+		'quoted text' printf $(pwd) printf x=1 && awk 2>/dev/null
+		awk 'quoted text' && echo $(pwd) export test | --verbose "$1" local "$@"
+		grep local x=1 then export awk echo awk /usr/bin "$@" --verbose awk "$@" --verbose
+readonly /usr/bin cd awk 2>/dev/null
+| local local echo cd grep readonly | x=1 'quoted text'
+		&& -eu export -eu done | -eu echo
+		'quoted text' done && sed grep then $(pwd) printf
+--verbose export --verbose 2>/dev/null
+	echo awk && -eu readonly ${HOME} $(pwd) test done local done 'quoted text'
+echo cd cd cd 'quoted text'
+	$(pwd) && printf && 'quoted text' printf ${HOME} 'quoted text'
+"$@" /usr/bin done echo
+		2>/dev/null -eu /usr/bin ${HOME} && --verbose then
+'quoted text' $(pwd) grep && /usr/bin 2>/dev/null $(pwd)
+"$1" 2>/dev/null cd then --verbose
+2>/dev/null echo then 'quoted text'
+	grep printf grep x=1 -eu "$@" done echo 2>/dev/null readonly
+	cd printf local ${HOME} done "$1" && cd sed awk /usr/bin test "$1" test
+		x=1 local /usr/bin -eu --verbose printf --verbose 'quoted text' printf
+/usr/bin && ${HOME} test ${HOME} "$@" echo echo test export /usr/bin | awk
+		then awk 'quoted text' | | then -eu grep sed sed
+		local sed grep awk printf $(pwd) $(pwd) $(pwd) local awk echo && echo then
+grep printf grep ${HOME} readonly export && done awk sed 'quoted text' ${HOME}
+"$@" -eu && echo | then "$1" readonly 'quoted text' awk /usr/bin echo /usr/bin
+	/usr/bin /usr/bin then printf
+		then | printf | ${HOME} --verbose awk ${HOME} "$1"
+		then 'quoted text' grep export cd "$1" ${HOME} grep $(pwd) export x=1 sed echo
+	done && awk test readonly ${HOME} awk sed local "$@" readonly awk 'quoted text'
+x=1 printf | --verbose $(pwd) 'quoted text' x=1 2>/dev/null x=1 echo grep grep
+	x=1 | echo local -eu x=1 x=1 "$1" /usr/bin
+2>/dev/null x=1 && $(pwd) awk ${HOME} cd echo 'quoted text' readonly
+export && then ${HOME}
+	printf export export awk -eu printf printf awk
+		/usr/bin ${HOME} done && $(pwd) local export sed -eu
+/usr/bin readonly test then --verbose /usr/bin done --verbose --verbose
+then done | ${HOME} echo ${HOME} printf && grep awk /usr/bin
+cd ${HOME} printf grep x=1 local | "$1" done
+	"$1" test --verbose --verbose printf sed --verbose x=1 "$@" $(pwd)
+		${HOME} $(pwd) echo 'quoted text' then local echo cd grep "$1" && readonly |
+		2>/dev/null echo export readonly echo export then cd ${HOME} grep grep then
+	&& cd readonly readonly echo local 'quoted text' echo sed "$@" grep
+	/usr/bin sed | ${HOME} 'quoted text' printf then cd export sed done
+		"$1" -eu 'quoted text' "$@"
+| 'quoted text' /usr/bin 'quoted text' local "$@" sed echo
+		2>/dev/null 'quoted text' ${HOME} test ${HOME} sed cd then sed x=1 "$@" "$1"
+		then ${HOME} && local $(pwd) x=1 && cd then
+printf cd test 2>/dev/null 'quoted text' /usr/bin -eu $(pwd) grep /usr/bin
+cd awk "$1" 2>/dev/null "$1" "$1" --verbose | then "$@" export --verbose then
+	cd ${HOME} 'quoted text'
+then "$1" "$1" -eu grep "$@" ${HOME} readonly cd cd grep then readonly
+-eu done readonly x=1 grep | x=1 "$@" printf
+	done done "$@" 2>/dev/null test local readonly /usr/bin | grep
+	'quoted text' "$@" 2>/dev/null readonly
+done x=1 awk 'quoted text'
+test sed test --verbose | test awk /usr/bin 2>/dev/null
+	done printf 2>/dev/null then ${HOME} 2>/dev/null awk then "$1" sed
+-eu then export && ${HOME} awk export local "$@" 2>/dev/null
+		export --verbose "$1" ${HOME} "$1" export done echo "$1"
+	"$@" cd awk 'quoted text' $(pwd) test done echo /usr/bin cd 2>/dev/null
+		printf awk echo awk grep awk test readonly done grep --verbose "$1" sed cd && echo
+--verbose grep 2>/dev/null /usr/bin sed then readonly "$1" --verbose
+		export x=1 export ${HOME}
+readonly cd printf "$@" local --verbose --verbose
+x=1 done /usr/bin "$@"
+export local then printf /usr/bin 'quoted text' cd "$@"
+		then export "$@" ${HOME} cd then -eu && "$@" 2>/dev/null 2>/dev/null local && x=1
+'quoted text' test x=1 export --verbose
+	awk --verbose readonly then x=1
+	-eu done 'quoted text' readonly local awk && | grep 'quoted text' x=1 awk -eu
+	printf $(pwd) local 'quoted text'
+'quoted text' local /usr/bin "$1" done
+		export cd echo -eu "$@" | 'quoted text' 2>/dev/null echo $(pwd)
+		done ${HOME} --verbose grep
+test $(pwd) local -eu local done local printf sed local -eu
+	"$@" $(pwd) $(pwd) $(pwd) export test
+grep 2>/dev/null --verbose 2>/dev/null
+export printf printf /usr/bin readonly 'quoted text' echo ${HOME} test ${HOME}
+		local ${HOME} sed 2>/dev/null cd done | done local ${HOME} |
+local -eu readonly echo | sed sed local x=1 export done cd echo cd
+		test && then x=1 test test 'quoted text' &&
+2>/dev/null readonly cd then $(pwd) awk cd awk
+		2>/dev/null done sed "$@" 'quoted text' export echo $(pwd)
+	&& awk $(pwd) "$@" ${HOME}
+		-eu local echo readonly readonly && cd cd
+		/usr/bin test cd then x=1 export test 2>/dev/null "$1" &&
+&& $(pwd) "$1" export cd echo -eu awk then printf printf done
+	-eu ${HOME} cd /usr/bin then
+	/usr/bin ${HOME} --verbose test done -eu echo grep /usr/bin echo
+$(pwd) x=1 $(pwd) | local --verbose readonly cd -eu cd test /usr/bin
+	2>/dev/null awk 'quoted text' "$1" local "$@" $(pwd) "$@"
+then local awk 2>/dev/null
+export -eu grep export local awk --verbose local readonly
+echo cd "$1" 2>/dev/null cd --verbose readonly 2>/dev/null then
+printf 'quoted text' $(pwd) sed 'quoted text'
+	export 'quoted text' readonly ${HOME} "$@" echo sed export $(pwd) 'quoted text'
+--verbose then -eu awk
+		test then then "$@" 'quoted text' && readonly /usr/bin sed && local grep readonly
+test readonly /usr/bin local /usr/bin
+		| local done --verbose 'quoted text' echo
+	sed "$1" awk --verbose x=1 grep | printf local local "$@" "$1"
+&& grep sed 'quoted text' then local sed -eu $(pwd) grep then ${HOME}
+		cd 2>/dev/null $(pwd)
+		grep cd /usr/bin "$@" awk "$@" $(pwd) "$1" && "$@" /usr/bin 'quoted text'
+	then ${HOME} cd then local printf -eu -eu | done printf
+		-eu "$@" -eu readonly export echo --verbose && -eu grep --verbose
+'quoted text' awk export local readonly export
+"$@" "$@" done 2>/dev/null /usr/bin echo local x=1
+		then && "$@" grep done echo x=1 sed test
+$(pwd) readonly sed $(pwd) "$1" test
+		&& readonly -eu "$@" then awk cd then awk cd /usr/bin printf printf
+	done 'quoted text' grep awk x=1 test export $(pwd) && "$1" "$@" readonly
+${HOME} export sed -eu /usr/bin done test grep sed -eu -eu | && | 2>/dev/null
+"$@" test sed done awk done sed | grep done -eu $(pwd) --verbose
+	then 'quoted text' cd | then --verbose -eu local $(pwd) 'quoted text' awk
+	-eu "$@" --verbose export 'quoted text' export
+		awk x=1 sed cd $(pwd) cd | | "$1" readonly
+then --verbose cd test | readonly $(pwd) | readonly -eu 2>/dev/null "$@" 'quoted text'
+| ${HOME} && 'quoted text' readonly 2>/dev/null
+	readonly printf ${HOME} "$1" echo && && test export && "$1" ${HOME}
+grep | "$1" 'quoted text' test $(pwd)
+sed export then cd test export printf 2>/dev/null ${HOME} ${HOME}
+export 2>/dev/null readonly done x=1 | -eu
+		sed && echo /usr/bin sed x=1 test printf then "$1" -eu | echo
+		2>/dev/null then awk 'quoted text' 2>/dev/null
+		2>/dev/null echo /usr/bin /usr/bin ${HOME} grep
+	--verbose local local printf --verbose
+	2>/dev/null printf sed
+&& "$1" "$1" 'quoted text' --verbose local "$@" && ${HOME} x=1 local -eu
+	echo --verbose grep $(pwd) export
+2>/dev/null printf cd -eu then
+/usr/bin awk awk /usr/bin readonly
+"$1" done printf test 'quoted text'
+&& printf "$1" ${HOME} sed x=1 | grep | test echo "$1" x=1
+	2>/dev/null readonly export "$1"
+${HOME} ${HOME} 'quoted text' && awk 2>/dev/null /usr/bin test
+		grep /usr/bin -eu local /usr/bin
+		local | ${HOME} 2>/dev/null grep "$1"
+		'quoted text' $(pwd) cd export local grep export printf $(pwd)
+		${HOME} $(pwd) && "$@" grep -eu printf
+	"$1" test 2>/dev/null -eu sed --verbose grep echo export readonly
+	grep /usr/bin --verbose "$@" echo echo cd printf | local -eu cd $(pwd)
+	then $(pwd) | -eu /usr/bin 'quoted text'
+	echo done x=1 export $(pwd) export 'quoted text' "$@" "$@" echo /usr/bin --verbose
+	/usr/bin $(pwd) awk "$@" awk local printf /usr/bin sed cd grep test ${HOME} done
+	&& test && echo grep local && local && "$@" -eu "$@" readonly /usr/bin
+		grep sed grep "$1" export 2>/dev/null ${HOME}
+		x=1 cd export cd awk local 2>/dev/null awk local export
+x=1 | x=1 test 2>/dev/null done ${HOME}
+export local x=1 2>/dev/null printf sed done
+/usr/bin printf local /usr/bin ${HOME} x=1 --verbose /usr/bin ${HOME}
+		export ${HOME} "$@" echo 2>/dev/null
+	"$@" 'quoted text' sed ${HOME} x=1 && /usr/bin $(pwd) --verbose done cd cd
+	$(pwd) | local test /usr/bin
+-eu sed test cd echo /usr/bin printf
+		readonly local 'quoted text' cd echo printf --verbose /usr/bin readonly 2>/dev/null
+	'quoted text' then && $(pwd)
+		test --verbose "$@" cd echo readonly 'quoted text' local then | printf sed printf
+-eu printf cd local 2>/dev/null
+${HOME} awk && x=1 sed -eu
+		done "$1" grep sed printf ${HOME} ${HOME} awk && $(pwd) done done "$1" done
+	$(pwd) 2>/dev/null $(pwd) $(pwd) sed grep
+		test -eu | awk ${HOME} | ${HOME} grep 2>/dev/null printf sed | cd --verbose done
+	x=1 -eu local done -eu | cd 'quoted text'
+done grep /usr/bin export local 'quoted text' x=1
+&& export printf sed && && | then awk awk done
+| 'quoted text' sed && -eu "$1" $(pwd) x=1 $(pwd) cd
+cd | 'quoted text' export | 'quoted text' 2>/dev/null
+sed export grep sed --verbose $(pwd) local
+		'quoted text' local test done done x=1 grep
+	'quoted text' echo /usr/bin x=1 | x=1 local readonly echo
+readonly "$1" /usr/bin && 2>/dev/null ${HOME} | echo "$1" --verbose $(pwd) "$1"
+	--verbose "$1" printf then $(pwd) grep
+	--verbose -eu x=1 local local "$1" 2>/dev/null then
+		then printf echo printf then sed 'quoted text'
+		'quoted text' x=1 printf /usr/bin local $(pwd) printf echo awk /usr/bin cd /usr/bin
+sed sed | readonly export "$1" export /usr/bin then
+then 2>/dev/null printf &&
+local sed && readonly "$1" "$@" 2>/dev/null printf /usr/bin printf test done
+	2>/dev/null 'quoted text' cd --verbose awk "$1"
+		then grep x=1 /usr/bin 'quoted text' test ${HOME} sed printf x=1 2>/dev/null
+	local 2>/dev/null done /usr/bin printf | test export ${HOME} 2>/dev/null
+	${HOME} done cd "$1" -eu x=1 -eu grep export
+	--verbose sed cd /usr/bin grep $(pwd) grep
+	cd grep ${HOME} | $(pwd) then
+		done printf 2>/dev/null -eu export ${HOME} -eu --verbose local sed && grep
+	then ${HOME} --verbose --verbose 'quoted text' ${HOME}
+		grep 2>/dev/null local export | ${HOME} awk 'quoted text' 2>/dev/null
+		grep readonly export -eu cd grep $(pwd) 'quoted text' then test "$@" | then
+	/usr/bin echo cd echo test "$@"
+	export awk 'quoted text' test x=1 awk
+	test | cd export cd && readonly /usr/bin
+		/usr/bin grep x=1 awk "$@" | sed /usr/bin x=1 && sed export
+$(pwd) echo export /usr/bin --verbose printf
+		done x=1 then x=1 then | "$1"
+2>/dev/null && | -eu ${HOME} 2>/dev/null ${HOME} grep local --verbose
+		done test --verbose grep "$1" done 'quoted text'
+		/usr/bin awk && | ${HOME} $(pwd) cd
+	$(pwd) x=1 export "$1" "$1" 'quoted text'
+		printf export -eu "$1" printf echo && printf && $(pwd) then /usr/bin cd 'quoted text'
+		test export x=1 printf readonly $(pwd) test printf
+		sed printf grep echo done test cd awk --verbose && done 2>/dev/null
+		awk -eu grep readonly cd grep --verbose
+		"$@" printf "$@" test test -eu | /usr/bin
+sed sed then x=1 printf
+		printf awk test test && 2>/dev/null
+	cd "$1" sed cd done awk $(pwd) /usr/bin local $(pwd) 2>/dev/null then
+	-eu cd -eu 2>/dev/null readonly awk awk 'quoted text' 2>/dev/null
+		grep test -eu -eu awk done sed done awk -eu readonly 2>/dev/null 2>/dev/null
+		'quoted text' ${HOME} awk ${HOME} done echo |
+"$1" done sed $(pwd) then
+	then then echo -eu "$1" sed sed $(pwd) then
+	| 2>/dev/null test x=1 'quoted text'
+readonly cd then echo x=1 /usr/bin grep |
+printf awk grep "$@" "$1" local ${HOME} local
+test grep "$1" -eu then then "$@"
+&& local readonly $(pwd) sed
+		test cd then -eu local && "$@" printf
+/usr/bin test "$@" $(pwd) && -eu --verbose | x=1 | x=1 awk
+	/usr/bin local local awk ${HOME}
+	grep "$@" awk x=1 export -eu readonly cd grep export
+		"$@" --verbose cd sed x=1 readonly cd grep -eu --verbose --verbose
+"$1" "$1" readonly local cd readonly && | grep "$1"
+		cd sed "$@" /usr/bin cd $(pwd)
+	export test readonly done && &&
+	printf && done && done local cd printf printf -eu | "$@" "$1" echo grep
+		&& --verbose local grep echo awk /usr/bin "$1" echo printf grep -eu && then
+	cd readonly done /usr/bin /usr/bin
+		-eu $(pwd) readonly | grep -eu grep $(pwd) test done --verbose
+		'quoted text' test -eu --verbose 2>/dev/null x=1
+	then -eu -eu 2>/dev/null x=1 readonly local grep then ${HOME} --verbose printf
+"$@" export ${HOME} printf echo grep local /usr/bin
+		--verbose readonly --verbose done x=1 awk 2>/dev/null
+	'quoted text' -eu $(pwd) export /usr/bin x=1 --verbose cd
+&& "$1" 2>/dev/null grep | -eu awk x=1 grep /usr/bin
+		grep x=1 "$1" echo 'quoted text' export -eu printf echo $(pwd) done x=1 -eu
+	readonly local then printf "$@" | done echo local test awk awk "$1" local
+	'quoted text' "$@" $(pwd) local $(pwd) then
+| x=1 cd sed done --verbose echo readonly x=1 export local printf
+		--verbose ${HOME} test readonly readonly grep
+-eu echo --verbose $(pwd) local $(pwd) echo echo test export /usr/bin 2>/dev/null
+${HOME} ${HOME} echo /usr/bin /usr/bin "$1" done readonly
+test export && 2>/dev/null done export
+		'quoted text' -eu --verbose readonly done "$1" $(pwd) "$@"
+		local "$1" /usr/bin grep 2>/dev/null | then readonly /usr/bin && 2>/dev/null export
+		--verbose cd test "$1" x=1 --verbose
+		$(pwd) cd then $(pwd) cd --verbose cd ${HOME} local local test local
+	${HOME} sed x=1 printf &&
+then echo --verbose 2>/dev/null
+	2>/dev/null "$@" | done grep $(pwd) grep
+"$@" cd test then && "$@" echo then "$1" readonly --verbose
+awk ${HOME} test "$@" 'quoted text' -eu |
+echo && 2>/dev/null "$1" export 2>/dev/null done echo "$1" ${HOME} "$@"
+sed readonly sed x=1 local "$@" ${HOME} --verbose
+then cd | /usr/bin "$1" x=1 "$1" readonly awk echo && -eu cd echo $(pwd)
+local /usr/bin -eu sed test test export /usr/bin
+		x=1 done /usr/bin awk readonly
+		| cd echo /usr/bin grep ${HOME} test echo 'quoted text' -eu local
+	$(pwd) -eu 'quoted text' sed 2>/dev/null local then awk awk | printf printf
+sed "$1" echo readonly cd echo "$@" $(pwd) "$1" cd then "$1" local sed local /usr/bin
+	${HOME} 'quoted text' export x=1 x=1 /usr/bin &&
+| then $(pwd) cd then awk readonly printf -eu printf "$1" -eu done grep x=1
+echo 2>/dev/null 2>/dev/null x=1 /usr/bin 2>/dev/null awk
+$(pwd) then export ${HOME} -eu done -eu
+		"$@" "$@" readonly "$1" grep && $(pwd) /usr/bin
+$(pwd) --verbose $(pwd) done sed --verbose grep /usr/bin local -eu -eu local
+x=1 cd done sed 2>/dev/null local sed printf echo readonly awk
+		printf printf --verbose printf 'quoted text' printf /usr/bin
+	/usr/bin /usr/bin | printf x=1 cd grep -eu 'quoted text' grep
+		x=1 'quoted text' x=1 | /usr/bin test echo "$1" export grep
+cd printf /usr/bin 2>/dev/null sed -eu
+		-eu /usr/bin printf --verbose local export ${HOME} | local
+'quoted text' sed ${HOME} export --verbose
+${HOME} awk && printf x=1 readonly echo
+		test awk --verbose -eu ${HOME} /usr/bin cd test $(pwd) cd cd then
+		"$1" -eu | --verbose | ${HOME}
+	/usr/bin | grep "$1" x=1 readonly $(pwd)
+	-eu sed grep readonly
+"$@" cd awk echo | x=1 "$1" 'quoted text' 'quoted text'
+export 2>/dev/null $(pwd) ${HOME} grep /usr/bin local export "$1" echo "$@"
+		then | grep ${HOME} printf x=1 x=1 sed "$1" done readonly "$1"
+	"$1" local grep done sed awk | readonly awk --verbose test && test
+grep "$@" export cd -eu 'quoted text' /usr/bin | -eu export
+	cd grep export x=1 done
+printf cd $(pwd) -eu -eu printf 'quoted text' x=1 | local
+	2>/dev/null | 2>/dev/null -eu done --verbose -eu test cd "$@"
+		done ${HOME} "$@" awk printf "$1" export --verbose
+		export "$@" printf awk awk x=1 'quoted text' export awk && /usr/bin cd &&
+awk --verbose x=1 --verbose 2>/dev/null grep test "$@" done printf
+	local "$1" ${HOME} done
+	| --verbose | "$@" grep local
+	export then grep then export -eu /usr/bin
+	$(pwd) $(pwd) cd "$1" awk printf readonly done "$1" x=1 ${HOME} --verbose
+		${HOME} test "$1" printf done
+		local grep "$@" local | done &&
+printf grep echo x=1 ${HOME} | then
+	test x=1 x=1 cd test --verbose grep
+		| 2>/dev/null grep -eu printf test sed cd then export ${HOME} 'quoted text' /usr/bin
+	${HOME} $(pwd) x=1 then x=1 | export -eu &&
+done cd /usr/bin readonly $(pwd) sed 2>/dev/null
+	then $(pwd) "$1" --verbose
+		readonly export 2>/dev/null readonly
+| "$1" | echo cd /usr/bin test
+	cd grep done | cd awk | 2>/dev/null "$@" && echo
+local && 'quoted text' /usr/bin local cd sed cd then ${HOME}
+		| | echo && printf 2>/dev/null cd "$1" test 'quoted text' echo && 2>/dev/null
+	awk done -eu local test ${HOME} printf then test /usr/bin readonly cd done
+	done /usr/bin ${HOME} "$1" done export $(pwd) /usr/bin
+printf | "$@" 'quoted text' done done readonly grep sed done
+printf --verbose --verbose --verbose printf x=1 ${HOME}
+		2>/dev/null $(pwd) $(pwd) "$@" 'quoted text' | $(pwd) |
+	export 'quoted text' && 'quoted text' then x=1
+$(pwd) echo done 2>/dev/null --verbose $(pwd)
+| readonly ${HOME} test test grep
+printf printf export "$1" readonly echo done awk 2>/dev/null | test readonly
+	local 2>/dev/null ${HOME} grep $(pwd) | -eu ${HOME} cd $(pwd) && echo $(pwd)
+$(pwd) sed then | export done
+		done -eu ${HOME} 'quoted text'
+grep ${HOME} awk then "$1" --verbose echo readonly test
+"$1" "$1" -eu "$@" sed 2>/dev/null then echo awk ${HOME} "$1" "$1"
+		--verbose printf printf x=1 done echo
+	$(pwd) cd grep 2>/dev/null local "$1" done 2>/dev/null sed printf "$1" ${HOME}
+		grep $(pwd) readonly cd local done echo $(pwd) sed ${HOME} | "$1" test
+		$(pwd) printf grep ${HOME} export local then 2>/dev/null /usr/bin
+	awk grep then test $(pwd) local echo test then
+		readonly "$@" 'quoted text' -eu done /usr/bin
+${HOME} awk -eu printf "$1" readonly
+	--verbose -eu && && -eu ${HOME} ${HOME} --verbose export local cd $(pwd) /usr/bin
+		$(pwd) done 'quoted text' export "$1"
+		awk done "$@" ${HOME} echo done
+	sed x=1 /usr/bin readonly printf && "$1"
+		printf printf "$1" printf x=1 awk -eu | /usr/bin grep
+		-eu readonly 2>/dev/null done then echo | | x=1
+		grep && test then | test echo grep
+sed 2>/dev/null echo local x=1 $(pwd) done
+		then "$1" | sed readonly printf 2>/dev/null test sed awk $(pwd) echo
+		&& printf $(pwd) /usr/bin "$@" then awk x=1 cd | test awk $(pwd) -eu then -eu
+	echo printf 'quoted text' cd done printf ${HOME} 'quoted text'
+	grep $(pwd) $(pwd) local --verbose then readonly readonly
+		2>/dev/null "$1" 'quoted text' export cd "$1" x=1 grep 'quoted text'
+'quoted text' export | -eu echo /usr/bin 'quoted text' awk
+"$1" test sed --verbose 'quoted text' $(pwd) "$1" grep export cd ${HOME}
+'quoted text' readonly $(pwd) export test && echo cd $(pwd)
+-eu echo "$1" 'quoted text'
+	grep /usr/bin awk 2>/dev/null 2>/dev/null
+		${HOME} awk $(pwd) 2>/dev/null
+	done readonly awk $(pwd) test then "$1" && x=1 readonly 2>/dev/null export done
+cd ${HOME} x=1 --verbose local local cd then && "$1" export "$1" test
+		test done export local "$1" ${HOME} printf | "$@" /usr/bin awk done
+${HOME} $(pwd) export echo $(pwd) local cd
+$(pwd) then cd /usr/bin $(pwd) /usr/bin
+	-eu "$@" 'quoted text' -eu && readonly "$1" readonly readonly
+${HOME} 2>/dev/null --verbose
+	printf && && then /usr/bin x=1 "$1" cd "$@" done "$1" done test grep
+echo readonly grep printf cd && readonly 'quoted text' 'quoted text'
+awk $(pwd) --verbose 2>/dev/null readonly printf
+	test "$@" readonly test
+	$(pwd) printf printf "$1" sed -eu -eu && -eu --verbose local awk done
+	then /usr/bin then cd cd
+		"$1" done then done grep 2>/dev/null &&
+		export printf done ${HOME} 'quoted text' 'quoted text' 2>/dev/null done
+	done 'quoted text' cd grep printf export
+		/usr/bin printf 2>/dev/null
+	local cd then grep "$@" readonly ${HOME} sed x=1 /usr/bin export echo x=1
+	"$@" "$1" -eu /usr/bin "$@" ${HOME} && echo
+		export "$1" -eu -eu "$1" readonly $(pwd) test awk grep cd "$1" echo "$@"
+	then grep local /usr/bin
+		/usr/bin then readonly then test --verbose
+readonly 2>/dev/null echo --verbose cd cd
+	sed "$1" $(pwd) sed printf echo readonly grep /usr/bin ${HOME} | then sed
+		echo local && printf echo /usr/bin 'quoted text'
+	| /usr/bin -eu echo /usr/bin
+	${HOME} cd /usr/bin done ${HOME} printf 2>/dev/null "$@"
+	test done then && /usr/bin echo grep "$@" then awk -eu awk grep local
+'quoted text' 2>/dev/null "$1" awk
+x=1 | sed readonly --verbose -eu cd ${HOME} 2>/dev/null $(pwd) sed echo
+&& && then -eu 2>/dev/null grep && echo "$@" --verbose test
+local ${HOME} x=1 | 'quoted text' "$1" x=1 grep 2>/dev/null
+export grep -eu | done export
+	local -eu ${HOME} readonly
+		| --verbose | 2>/dev/null "$@" export --verbose printf
+	awk test x=1 sed export --verbose "$1" printf --verbose awk "$@" cd "$@" /usr/bin
+		| "$@" then --verbose readonly printf printf
+	x=1 printf local done | | readonly
+	-eu printf && sed "$@" 'quoted text' local "$@" $(pwd) ${HOME} --verbose local
+${HOME} printf -eu | cd sed
+"$@" sed -eu then test /usr/bin grep 'quoted text' test -eu echo readonly
+		&& ${HOME} awk done awk "$@" grep done echo | sed && awk "$1"
+	"$@" x=1 -eu awk "$1" && echo 'quoted text' --verbose
+x=1 cd done cd | && "$@" --verbose -eu cd -eu 'quoted text' echo printf
+	grep && /usr/bin done -eu "$@" sed /usr/bin awk grep local
+	--verbose "$1" echo /usr/bin
+	"$1" test 2>/dev/null grep /usr/bin ${HOME} 'quoted text' | local "$1"
+		done "$1" ${HOME} | x=1 grep ${HOME} done --verbose
+		export done export && grep test done then ${HOME} && $(pwd) &&
+grep "$@" sed --verbose --verbose x=1 cd x=1 | x=1 export && ${HOME}
+sed --verbose /usr/bin /usr/bin awk cd export cd done 'quoted text' done
+	2>/dev/null awk $(pwd) "$1" --verbose "$@"
+export $(pwd) 2>/dev/null then grep done
+	| --verbose | && --verbose x=1 && printf 2>/dev/null awk 'quoted text' --verbose
+printf awk 2>/dev/null /usr/bin "$@" done done echo /usr/bin -eu echo && &&
+		grep -eu x=1 test | readonly echo printf
+	$(pwd) readonly -eu && export && 2>/dev/null
+		echo printf readonly echo "$1" grep sed echo
+	/usr/bin 'quoted text' ${HOME} readonly x=1 $(pwd) 2>/dev/null
+		${HOME} "$1" printf local test --verbose "$@" && /usr/bin awk
+$(pwd) ${HOME} then awk /usr/bin | x=1 then 'quoted text' export x=1 | local | 2>/dev/null
+$(pwd) awk "$@" cd -eu -eu 'quoted text' readonly awk cd
+	sed /usr/bin local "$1" $(pwd) then -eu --verbose
+		export "$1" "$1" 2>/dev/null
+	${HOME} export $(pwd) done test test awk done echo
+	| "$1" $(pwd) x=1 --verbose export test | grep -eu x=1 grep export
+"$@" /usr/bin -eu grep test then | printf && -eu done 'quoted text' export
+	sed grep x=1 echo 2>/dev/null printf 'quoted text' "$1" x=1 test sed 'quoted text'
+${HOME} ${HOME} then then "$@" ${HOME} | then cd x=1 printf /usr/bin $(pwd)
+		test done printf 'quoted text' grep then | cd
+	then printf "$1" | readonly local
+		sed $(pwd) then done -eu -eu test
+then awk grep awk export $(pwd) 2>/dev/null | x=1 readonly
+sed printf readonly $(pwd) echo "$1" echo 2>/dev/null local "$1" 2>/dev/null
+		cd cd | printf -eu && "$@" /usr/bin 'quoted text'
+/usr/bin local then 2>/dev/null export --verbose ${HOME} | $(pwd) echo awk then
+	-eu readonly $(pwd) "$@" grep local 2>/dev/null export
+printf export -eu cd
+then "$@" 'quoted text' 'quoted text' done "$1" | local x=1 echo 'quoted text'
+'quoted text' test 2>/dev/null 2>/dev/null
+	sed 'quoted text' --verbose then
+	"$@" readonly 'quoted text'
+	echo --verbose $(pwd) awk echo
+	-eu "$1" -eu "$@" --verbose local readonly /usr/bin
+	sed then printf sed export sed done then "$@" 'quoted text'
+		| sed -eu 'quoted text' ${HOME} 2>/dev/null && ${HOME} grep "$@" --verbose $(pwd)
+	export $(pwd) 2>/dev/null /usr/bin "$@" export done then awk local ${HOME} grep
+	done sed x=1 awk "$1" ${HOME} $(pwd) /usr/bin x=1
+readonly -eu ${HOME} ${HOME} test awk cd readonly "$1" then printf echo
+		echo | export local export 2>/dev/null 'quoted text' test 'quoted text'
+	awk echo --verbose cd --verbose awk "$1" /usr/bin
+	'quoted text' test cd /usr/bin /usr/bin local 'quoted text' "$@" awk
+		--verbose printf 'quoted text' test 'quoted text'
+	x=1 2>/dev/null "$1" 'quoted text' /usr/bin -eu readonly
+${HOME} cd $(pwd) $(pwd) "$1" grep "$1" "$1" $(pwd) 2>/dev/null
+${HOME} then cd then export 'quoted text'
+printf "$@" grep "$1" && done awk --verbose export
+	export local done then 'quoted text'
+	-eu test x=1 local && 2>/dev/null 2>/dev/null done && done cd | cd
+		--verbose export "$1" cd $(pwd) done 2>/dev/null
+		awk sed local grep /usr/bin printf $(pwd) then $(pwd) awk $(pwd)
+		sed test then -eu | sed && "$1" 'quoted text'
+	test cd "$1" done ${HOME} done export | | test ${HOME} local then
+	echo grep readonly | $(pwd) x=1 2>/dev/null --verbose export
+		$(pwd) readonly x=1 test sed -eu local ${HOME} x=1
+then 2>/dev/null ${HOME} ${HOME} done test awk test x=1 ${HOME}
+| grep "$1" 'quoted text' --verbose grep printf local
+		done printf local cd echo grep awk readonly awk grep readonly |
+		local x=1 done --verbose printf
+		awk cd echo | sed export | awk x=1 done export export readonly /usr/bin
+	"$@" export then -eu printf cd test 2>/dev/null awk | local "$@"
+	grep then ${HOME} /usr/bin echo grep $(pwd)
+x=1 then && && && -eu 'quoted text' test "$1" x=1 "$1" done done
+		--verbose --verbose 2>/dev/null echo && 2>/dev/null && local && "$@" echo
+		--verbose cd then echo
+		readonly && "$1" printf $(pwd) /usr/bin
+		then && "$1" --verbose "$@" "$@" grep readonly export | export 'quoted text'
+		awk x=1 test -eu sed 2>/dev/null | && readonly "$@" test -eu local
+readonly "$1" --verbose "$@" grep 2>/dev/null test readonly ${HOME}
+/usr/bin then test sed printf sed printf
+		"$1" sed grep awk --verbose export test sed | "$@" sed "$1" awk /usr/bin sed echo
+	2>/dev/null done --verbose /usr/bin printf
+| $(pwd) 'quoted text'
+	--verbose | export cd --verbose
+		--verbose 'quoted text' --verbose ${HOME} printf 2>/dev/null -eu
+${HOME} | printf test x=1 && readonly export
+-eu "$1" local ${HOME} readonly readonly && x=1 --verbose /usr/bin
+	2>/dev/null sed test $(pwd) ${HOME} readonly then | x=1 "$@" $(pwd)
+grep local readonly cd /usr/bin /usr/bin && -eu local | grep "$1" $(pwd) | 2>/dev/null
+awk printf awk readonly sed 'quoted text' "$@" "$@" test $(pwd)
+"$@" ${HOME} -eu "$@" awk then
+		$(pwd) | echo done 'quoted text'
+| echo then grep grep done --verbose
+readonly readonly /usr/bin readonly local
+		then && $(pwd) $(pwd) "$1" export "$@" --verbose echo && test
+grep cd "$@" cd export readonly
+	2>/dev/null | awk printf readonly &&
+	x=1 /usr/bin export then local 2>/dev/null
+		export 'quoted text' -eu grep
+	then export sed export ${HOME} | printf then "$@" --verbose "$@" 2>/dev/null
+		echo sed | /usr/bin awk printf "$1" export sed done printf local $(pwd) "$@" 2>/dev/null
+readonly $(pwd) | grep -eu 2>/dev/null echo 'quoted text'
+	2>/dev/null "$@" test local printf && ${HOME} grep && 'quoted text'
+		| export "$@" "$@" export sed -eu grep readonly grep && done | awk
+	then local printf awk /usr/bin echo then readonly
+		local sed done --verbose $(pwd) ${HOME} local awk readonly --verbose export
+	| export local awk $(pwd) -eu test ${HOME} sed && /usr/bin "$@"
+grep "$@" && x=1 --verbose /usr/bin && export ${HOME} 'quoted text'
+		/usr/bin awk "$@" local awk done export ${HOME}
+| export x=1 awk "$1" grep local ${HOME}
+done /usr/bin | done readonly "$@" ${HOME} awk then x=1 done
+		done 'quoted text' && 2>/dev/null | local echo
+	sed sed test 'quoted text' sed && export -eu sed 2>/dev/null
+		local echo | ${HOME} awk printf -eu "$@" "$@" "$@" sed ${HOME} ${HOME} -eu grep
+	readonly -eu x=1 export export echo "$1" echo && /usr/bin sed && grep "$@"
+2>/dev/null export "$1" "$1" x=1
+		"$@" readonly $(pwd) done "$1" local awk then
+		readonly 2>/dev/null done 'quoted text' x=1 awk /usr/bin "$1" x=1 readonly
+		cd echo "$@" | $(pwd) | test | "$1" test && ${HOME} "$1" done 2>/dev/null
+| cd $(pwd) x=1 "$1" $(pwd)
+test done grep awk sed ${HOME} local local --verbose /usr/bin x=1
+		done printf echo && --verbose "$@" echo done /usr/bin
+		'quoted text' -eu $(pwd) printf echo export "$@" echo $(pwd) sed cd
+/usr/bin sed ${HOME} ${HOME} sed export local "$@" -eu
+		2>/dev/null echo --verbose test done x=1 x=1 awk
+	awk cd 2>/dev/null local "$@" echo readonly local printf | local readonly
+'quoted text' 'quoted text' printf then | export test export export
+sed grep x=1 echo grep "$1" && awk local "$1" $(pwd) readonly $(pwd) | | "$1"
+	echo "$1" sed /usr/bin export cd printf && printf -eu "$1" 2>/dev/null
+2>/dev/null export done export x=1 &&
+		cd test printf 2>/dev/null | $(pwd) -eu
+		--verbose sed then cd done /usr/bin "$@" done ${HOME} "$@" export test printf
+		| ${HOME} done "$1" echo --verbose $(pwd)
+done grep $(pwd) --verbose readonly $(pwd) then /usr/bin awk cd ${HOME}
+		x=1 --verbose "$1" grep --verbose done then
+	2>/dev/null test $(pwd) x=1 local "$@"
+		readonly then then sed cd | done 'quoted text'
+'quoted text' sed cd grep
+		| "$1" ${HOME} && | awk test cd 2>/dev/null -eu && x=1 && local echo local
+printf "$1" 'quoted text' /usr/bin "$1" printf
+	local 'quoted text' export ${HOME} test 'quoted text' -eu
+'quoted text' && x=1 "$1" grep test 'quoted text' ${HOME} export $(pwd) echo
+	'quoted text' readonly 2>/dev/null awk x=1 echo awk then
+		2>/dev/null $(pwd) test -eu readonly
+grep local ${HOME} $(pwd) "$1" 2>/dev/null 2>/dev/null x=1
+		'quoted text' echo $(pwd) 2>/dev/null
+	| --verbose && export ${HOME} x=1
+		grep sed x=1 echo 2>/dev/null -eu 2>/dev/null echo "$@" "$1" sed then
+	done 2>/dev/null $(pwd) awk sed $(pwd) $(pwd) echo
+printf echo test local echo
+	&& -eu export /usr/bin && cd | "$@" ${HOME} grep
+$(pwd) sed sed grep awk 2>/dev/null
+	'quoted text' "$1" then && ${HOME} then then sed readonly
+	x=1 cd 'quoted text' echo cd awk done 2>/dev/null readonly x=1
+$(pwd) 'quoted text' x=1 && | export awk export done then x=1
+	local 'quoted text' sed
+${HOME} && then -eu 2>/dev/null
+awk && echo export echo printf awk
+	local /usr/bin sed echo "$1" export local
+'quoted text' readonly -eu ${HOME}
+	"$@" -eu sed local 'quoted text' x=1 cd then | done cd "$@" readonly | --verbose
+		/usr/bin then printf --verbose printf test cd awk 'quoted text' test
+		local export printf test ${HOME} awk && awk echo export
+	-eu grep 'quoted text' | $(pwd) x=1 grep
+	echo ${HOME} then "$@" echo -eu grep then 'quoted text' echo --verbose printf
+"$@" | awk then $(pwd) printf -eu
+	${HOME} --verbose 2>/dev/null
+		awk $(pwd) "$@" awk test
+"$@" export local test x=1 "$@"
+	grep /usr/bin printf readonly 2>/dev/null ${HOME}
+	test grep "$1" export then "$@" export x=1 awk export echo awk && awk done
+	printf local 2>/dev/null then "$1" awk printf then $(pwd) awk awk ${HOME}
+		grep 2>/dev/null sed then grep
+	export "$1" grep 'quoted text'
+	--verbose 'quoted text' "$1" | test export
+		awk readonly local test
+-eu readonly --verbose test
+	awk -eu local x=1 cd grep 2>/dev/null ${HOME} | test echo --verbose cd
+		then awk && echo export -eu local /usr/bin local ${HOME} | echo "$1" ${HOME}
+		awk 'quoted text' 'quoted text' test
+test test sed $(pwd) $(pwd) then -eu x=1 done grep
+		'quoted text' $(pwd) "$@" done echo done 2>/dev/null
+	test 'quoted text' -eu cd test grep 'quoted text' sed "$1" awk
+		| printf grep export "$@" readonly --verbose test test "$@" && sed
+	grep test done 'quoted text' local
+| printf | export then
+echo ${HOME} export 'quoted text' grep echo echo
+	printf cd -eu grep 'quoted text' | "$@" "$@" test
+"$@" | /usr/bin readonly sed export echo "$@" done echo local $(pwd) "$1" ${HOME}
+		${HOME} "$1" echo sed 2>/dev/null sed
+		sed cd printf x=1 x=1 $(pwd) done
+-eu "$1" readonly readonly 2>/dev/null awk printf
+	'quoted text' grep 2>/dev/null sed | local 2>/dev/null
+	test -eu done --verbose ${HOME}
+	sed x=1 $(pwd) export 'quoted text' done awk 2>/dev/null sed done $(pwd) local $(pwd)
+x=1 done done --verbose echo 2>/dev/null cd grep then then
+	cd export && ${HOME} --verbose "$1"
+		done $(pwd) $(pwd) $(pwd) --verbose --verbose echo $(pwd) done readonly "$1" then
+		2>/dev/null -eu --verbose --verbose | x=1 local awk sed local printf /usr/bin
+--verbose $(pwd) sed readonly "$@" "$@" --verbose && sed awk "$1" 2>/dev/null
+		"$1" | /usr/bin 'quoted text' test $(pwd) printf 'quoted text'
+		"$@" && done test cd 'quoted text' ${HOME} awk "$1" | ${HOME} 2>/dev/null
+"$1" readonly printf cd export
+	'quoted text' "$1" awk && $(pwd) && "$@"
+		'quoted text' 'quoted text'
+	-eu "$1" sed -eu && echo 2>/dev/null "$1" readonly
+		"$@" /usr/bin x=1 sed x=1 ${HOME}
+	export -eu ${HOME} --verbose cd "$@" done awk 'quoted text' grep | $(pwd)
+		2>/dev/null then grep x=1 x=1 then "$@" then ${HOME} "$1" 'quoted text' ${HOME}
+		'quoted text' done 2>/dev/null sed /usr/bin export readonly export && &&
+		$(pwd) 'quoted text' done printf test "$@" "$1" && "$@" --verbose
+-eu "$@" | test test test
+		awk 2>/dev/null && --verbose echo | 'quoted text'
+2>/dev/null export "$1" -eu x=1 echo done then cd 'quoted text' "$1"
+local ${HOME} done printf "$1" $(pwd) "$1" "$1" test local printf
+-eu awk local grep sed ${HOME} readonly "$1" ${HOME} x=1 2>/dev/null test
+		"$@" 'quoted text' "$@" readonly "$@" "$@" && --verbose
+		${HOME} cd "$1" $(pwd)
+"$1" /usr/bin | ${HOME} done grep done awk 2>/dev/null sed echo
+	test local export readonly $(pwd) sed awk test export --verbose readonly
+	echo echo test test --verbose sed ${HOME} /usr/bin local cd echo echo -eu ${HOME}
+		--verbose $(pwd) ${HOME}
+printf then printf done "$1"
+	cd printf x=1 2>/dev/null -eu | "$1" | sed | grep -eu /usr/bin 2>/dev/null |
+$(pwd) local grep 2>/dev/null 'quoted text' ${HOME} then awk 2>/dev/null -eu done
+		--verbose grep echo then /usr/bin then -eu /usr/bin echo &&
+	"$1" cd readonly readonly x=1 x=1 | echo
+	local && awk test 2>/dev/null
+	| test -eu "$@" echo | --verbose 'quoted text' ${HOME} 2>/dev/null cd "$1" local
+		"$1" cd readonly awk $(pwd) -eu /usr/bin x=1
+	-eu export sed x=1 local printf ${HOME} awk then ${HOME} echo echo grep printf
+--verbose then export 2>/dev/null printf awk ${HOME} ${HOME} &&
+	--verbose 2>/dev/null export --verbose "$1" /usr/bin
+	local "$1" export --verbose x=1 export $(pwd) $(pwd)
+	2>/dev/null $(pwd) printf --verbose cd "$@" then awk
+	test x=1 | /usr/bin echo $(pwd)
+test $(pwd) local "$1" /usr/bin echo --verbose "$@" readonly /usr/bin "$1" 'quoted text'
+2>/dev/null "$1" test x=1 $(pwd) "$@" local export -eu --verbose
+then -eu cd test $(pwd) x=1 printf done $(pwd) readonly echo local export ${HOME}
+sed then sed local done then
+	/usr/bin then readonly sed then then awk -eu
+	local sed && awk | export && readonly --verbose
+done --verbose $(pwd) test --verbose cd done -eu /usr/bin "$1" grep 2>/dev/null
+x=1 x=1 "$@" test $(pwd) done grep printf test
+	export echo export | awk "$1" grep && readonly test echo -eu
+		| -eu then && $(pwd) | grep export test -eu && done -eu done echo
+$(pwd) -eu then printf cd done local local
+	then "$1" grep local /usr/bin grep 'quoted text' echo && | export awk printf 2>/dev/null
+	-eu sed | then test test $(pwd) "$@" done "$1" done done printf
+	'quoted text' local then $(pwd) x=1 $(pwd) "$@"
+	echo sed readonly | export
+	x=1 -eu $(pwd) done && printf /usr/bin -eu -eu --verbose
+		done 'quoted text' | echo printf x=1 | $(pwd) && "$1" "$1" -eu
+	test printf test done printf
+		done echo grep 'quoted text' -eu x=1 "$@" -eu "$@" grep 'quoted text' cd grep 2>/dev/null
+--verbose sed awk then grep "$1" done export
+	| /usr/bin $(pwd) readonly "$@" export echo
+		"$1" grep x=1 'quoted text' export "$1" cd then | /usr/bin
+local printf $(pwd) export && "$@" ${HOME} sed local x=1 -eu ${HOME} sed |
+		local done "$1" $(pwd) "$1" echo && 2>/dev/null "$@" cd 2>/dev/null readonly
+		readonly cd test export cd readonly ${HOME} /usr/bin printf --verbose
+	-eu cd ${HOME} export | grep awk | local export 'quoted text' | test
+		${HOME} /usr/bin done | 2>/dev/null local 'quoted text'
+		readonly printf awk done --verbose sed test sed test x=1 --verbose /usr/bin
+	echo "$@" -eu x=1 -eu readonly sed && ${HOME} 'quoted text' /usr/bin $(pwd) sed
+		| | "$1" sed printf "$1" 2>/dev/null x=1 awk "$@"
+"$1" 'quoted text' done printf
+/usr/bin --verbose export then readonly ${HOME}
+		sed --verbose local done
+	&& done /usr/bin awk -eu
+		| "$1" $(pwd) && grep printf awk cd "$1" local export awk --verbose
+	printf x=1 local 'quoted text' $(pwd) && readonly && cd | 'quoted text'
+then $(pwd) sed export done awk "$1" awk readonly $(pwd)
+		x=1 /usr/bin grep echo "$1" | awk test --verbose
+	local --verbose local 'quoted text' ${HOME} printf
+	cd awk printf readonly
+	test local $(pwd) grep done && cd | 2>/dev/null x=1 cd awk 'quoted text'
+	then cd done "$1" "$1" cd && cd "$@" echo "$1" readonly ${HOME} 'quoted text'
+	sed then test /usr/bin x=1 2>/dev/null
+		grep then printf echo done
+| --verbose 'quoted text' awk echo $(pwd) && 2>/dev/null
+		sed | --verbose | test --verbose readonly
+		then local ${HOME} export awk $(pwd)
+awk echo $(pwd) export && 2>/dev/null
+local then -eu then grep grep "$1"
+&& sed "$1" && 2>/dev/null readonly && grep "$@" "$@" --verbose then readonly readonly
+		2>/dev/null sed cd test 2>/dev/null then then
+		readonly then $(pwd) /usr/bin -eu export local /usr/bin
+	printf grep "$@" 2>/dev/null
+	-eu done --verbose awk
+awk printf /usr/bin readonly ${HOME} ${HOME} "$1" grep sed "$@" then
+		sed -eu --verbose --verbose done readonly 2>/dev/null then echo /usr/bin
+local export sed -eu -eu ${HOME} --verbose awk && | 2>/dev/null
+	then printf /usr/bin readonly export sed x=1 done $(pwd)
+		$(pwd) x=1 x=1 $(pwd) test grep done 2>/dev/null
+test cd grep /usr/bin $(pwd) done "$1" 2>/dev/null 2>/dev/null
+2>/dev/null done sed x=1
+	$(pwd) awk | $(pwd) grep -eu cd local then |
+	x=1 && "$1" --verbose export | "$1" printf && 'quoted text' then local sed
+echo sed -eu $(pwd) --verbose echo local x=1 "$1" export ${HOME} sed --verbose
+	&& -eu 'quoted text' cd 2>/dev/null echo "$@"
+	awk --verbose readonly "$1" export 2>/dev/null grep grep /usr/bin
+		2>/dev/null --verbose readonly
+		awk grep done printf --verbose export $(pwd)
+awk done done test 2>/dev/null --verbose sed cd /usr/bin readonly
+awk sed "$1" test -eu done local -eu sed readonly $(pwd) && "$@" then && "$1" readonly
+	sed -eu echo x=1 'quoted text' readonly cd cd | then 2>/dev/null "$@" 'quoted text'
+	test | echo && "$@" x=1 done printf $(pwd) sed done then
+		printf | "$1" /usr/bin awk x=1 /usr/bin 2>/dev/null
+	sed printf test $(pwd) done && readonly ${HOME} then
+	-eu ${HOME} -eu printf then --verbose /usr/bin awk local
+		--verbose 2>/dev/null done
+		$(pwd) --verbose 'quoted text'
+	done 'quoted text' printf awk grep ${HOME} local | test then -eu
+		echo 2>/dev/null printf | grep ${HOME} --verbose cd "$1" export echo
+&& test then printf 2>/dev/null x=1 done then sed "$1"
+		grep done awk then then echo -eu ${HOME} local echo done && --verbose local
+sed test local grep echo | echo --verbose echo $(pwd) echo grep /usr/bin
+		x=1 2>/dev/null "$1" cd $(pwd) | local "$1" /usr/bin
+		readonly | 2>/dev/null sed
+		x=1 x=1 readonly 2>/dev/null ${HOME} "$@"
+	grep 2>/dev/null -eu 2>/dev/null local x=1 sed --verbose
+	| readonly export cd x=1 | | 'quoted text' && ${HOME}
+		2>/dev/null test 2>/dev/null
+	| local "$1" sed x=1 test awk
+		--verbose --verbose x=1 && && grep test then echo
+local grep $(pwd) echo echo -eu readonly $(pwd)
+	echo 2>/dev/null local
+		&& echo then "$@" | "$1" 2>/dev/null cd readonly echo 'quoted text' printf
+		${HOME} --verbose | /usr/bin ${HOME} 2>/dev/null printf test | awk --verbose --verbose
+local local readonly "$1" && local grep x=1 x=1 -eu
+&& /usr/bin awk --verbose
+		echo then "$@" "$1" -eu 'quoted text'
+		&& awk /usr/bin local && "$1" grep sed test printf $(pwd) printf done "$@" --verbose
+2>/dev/null awk -eu /usr/bin readonly
+		x=1 "$1" x=1 then grep "$1" echo 2>/dev/null
+		'quoted text' test printf
+	echo echo 2>/dev/null echo "$@" --verbose -eu grep
+printf echo -eu ${HOME} "$@" echo
+	"$1" x=1 'quoted text' echo | sed readonly ${HOME} readonly sed sed && cd /usr/bin
+grep "$@" cd export "$@" echo ${HOME} 'quoted text' && then
+	cd export && $(pwd) /usr/bin $(pwd) -eu done 2>/dev/null
+	"$1" -eu sed awk readonly -eu $(pwd) 'quoted text'
+		2>/dev/null local "$@" "$1" --verbose --verbose
+	2>/dev/null | x=1 ${HOME}
+		export "$@" readonly grep ${HOME} "$@" --verbose | local readonly sed printf readonly
+		printf done cd local then awk
+&& 'quoted text' local --verbose awk | | printf x=1 --verbose then
+	$(pwd) ${HOME} -eu "$@" && then "$1" $(pwd)
+sed cd then printf ${HOME} export awk "$@" 2>/dev/null awk local sed
+	sed 'quoted text' /usr/bin
+	done grep && x=1 printf readonly local then export readonly readonly | --verbose
+x=1 'quoted text' --verbose
+-eu cd echo export /usr/bin sed cd local "$@" x=1 ${HOME} local done awk grep
+cd done "$1" test then printf cd | ${HOME} x=1 | --verbose printf
+		done grep | awk awk 2>/dev/null
+		| awk then "$1" then --verbose
+		local 'quoted text' sed -eu export readonly awk cd echo done ${HOME}
+		printf ${HOME} local readonly "$@"
+		readonly 2>/dev/null grep cd
+		export test && "$@" grep && export
+	--verbose "$1" --verbose --verbose
+	&& -eu readonly printf test && local sed echo cd sed awk
+	cd test export awk ${HOME} grep 'quoted text' | readonly 2>/dev/null
+	printf local cd readonly && "$1" $(pwd) 2>/dev/null
+	-eu done done 'quoted text' --verbose
+	"$@" "$@" done ${HOME} local then local 2>/dev/null grep grep "$1" "$1"
+| x=1 --verbose /usr/bin $(pwd) test 2>/dev/null then &&
+	awk awk cd -eu ${HOME} ${HOME} local printf "$1" $(pwd) cd export && && awk printf
+grep /usr/bin -eu /usr/bin export -eu readonly && grep readonly
+		/usr/bin "$1" cd -eu | /usr/bin 'quoted text'
+/usr/bin 2>/dev/null "$1" 2>/dev/null then awk
+printf then 2>/dev/null && local | printf
+done /usr/bin done echo && local local 2>/dev/null local 2>/dev/null
+printf ${HOME} 'quoted text' "$@" export printf -eu cd test --verbose
+		| 'quoted text' $(pwd) echo &&
+		2>/dev/null test echo "$@" printf | awk "$@"
+$(pwd) ${HOME} 'quoted text' | local |
+	&& awk "$1" 2>/dev/null 'quoted text' | "$@" then readonly x=1 local cd x=1 "$@"
+export $(pwd) sed x=1 $(pwd) x=1 grep cd 'quoted text' -eu
+${HOME} $(pwd) "$1" | "$1" awk ${HOME} echo printf
+"$1" readonly /usr/bin test -eu "$@"
+	then $(pwd) | awk -eu sed cd -eu test /usr/bin echo -eu
+"$@" printf readonly | -eu then 'quoted text' | 2>/dev/null export sed
+	cd cd -eu awk printf grep export
+-eu /usr/bin $(pwd) done cd x=1 /usr/bin 2>/dev/null
+	"$1" && test "$@" x=1 && "$1" echo -eu done printf x=1 "$1" readonly then $(pwd)
+export /usr/bin printf readonly readonly awk /usr/bin 'quoted text' -eu
+then readonly local $(pwd) 'quoted text'
+	/usr/bin 2>/dev/null echo | --verbose
+		echo grep -eu x=1 echo $(pwd)
+		"$1" readonly | echo -eu 2>/dev/null --verbose | 'quoted text'
+then "$@" $(pwd) 'quoted text' && && local "$1" ${HOME} 2>/dev/null x=1
+		${HOME} --verbose echo sed echo ${HOME} done "$1" --verbose readonly echo $(pwd)
+grep echo sed && 2>/dev/null local
+	cd $(pwd) "$@" /usr/bin cd $(pwd)
+	"$1" awk -eu sed 'quoted text' test awk cd grep printf done 2>/dev/null x=1 then
+		printf x=1 export $(pwd) sed then /usr/bin -eu
+x=1 grep done -eu 'quoted text' readonly done done $(pwd) echo /usr/bin
+		'quoted text' $(pwd) /usr/bin /usr/bin
+	export sed cd -eu export echo
+		export export 'quoted text' readonly then $(pwd) then export grep test
+	printf local echo done local printf
+	sed local sed done test readonly -eu
+grep grep sed 2>/dev/null $(pwd) done grep local
+/usr/bin sed sed | $(pwd) printf
+		&& printf "$1" test printf "$1"
+"$1" "$@" readonly readonly | then export grep then local readonly 2>/dev/null
+	export done done "$1" $(pwd) awk 'quoted text' grep 2>/dev/null $(pwd) 'quoted text'
+	cd 'quoted text' 2>/dev/null cd cd | "$@" readonly done local test local sed
+	--verbose printf | "$1" /usr/bin sed ${HOME} done local awk cd | "$@" test export
+	${HOME} 2>/dev/null sed --verbose --verbose "$1" readonly export /usr/bin -eu
+	${HOME} readonly /usr/bin cd awk grep awk "$1" "$1" | && "$@" local awk "$@"
+	'quoted text' awk && x=1 | awk "$1" 'quoted text' && -eu grep test &&
+	export /usr/bin 'quoted text' awk then $(pwd) --verbose
+	export cd echo printf /usr/bin awk -eu local $(pwd) $(pwd) $(pwd) $(pwd) awk
+	2>/dev/null grep $(pwd) 2>/dev/null printf awk done awk x=1 /usr/bin test
+	x=1 readonly --verbose --verbose cd done sed cd test then then cd 'quoted text'
+/usr/bin $(pwd) "$1" $(pwd) x=1 -eu printf export 'quoted text' readonly "$1" --verbose
+'quoted text' /usr/bin export "$1" $(pwd) | sed -eu $(pwd) "$1" grep 2>/dev/null
+printf test $(pwd) printf
+	done readonly printf --verbose $(pwd) | printf && 2>/dev/null cd && readonly
+"$@" export 2>/dev/null "$1" 'quoted text' done /usr/bin 'quoted text'
+$(pwd) awk readonly "$@" 2>/dev/null printf printf local local
+	| grep 'quoted text' $(pwd) printf x=1 'quoted text' x=1 export
+printf readonly done export 2>/dev/null /usr/bin
+	"$@" local "$@" 'quoted text'
+	grep x=1 sed 'quoted text' done ${HOME} then awk ${HOME} "$1" cd 2>/dev/null
+		"$1" /usr/bin awk 'quoted text' then cd readonly
+local --verbose ${HOME} 'quoted text' 2>/dev/null "$1" -eu x=1 sed | -eu
+$(pwd) readonly && local test
+	-eu readonly done "$1" echo
+sed test printf "$1" done "$@" &&
+cd 2>/dev/null x=1 && awk -eu then x=1 $(pwd) done done then
+	cd readonly $(pwd) $(pwd) test echo | -eu export && -eu awk readonly
+	then "$@" local cd "$@" x=1 x=1 | then x=1 2>/dev/null 'quoted text' /usr/bin
+awk readonly x=1 ${HOME} x=1 "$1" readonly "$@" "$1"
+sed 2>/dev/null 'quoted text' "$1" export
+	"$@" cd x=1 | /usr/bin && -eu test local ${HOME} sed
+		printf export awk --verbose test --verbose /usr/bin
+2>/dev/null local --verbose x=1 then sed then
+x=1 -eu ${HOME} export $(pwd) test /usr/bin 'quoted text' done then printf echo
+2>/dev/null echo | grep -eu
+		awk 'quoted text' ${HOME} echo "$1" "$@" x=1 x=1 2>/dev/null sed --verbose
+		local && "$@" echo --verbose local printf readonly test $(pwd) && "$@"
+printf then && ${HOME} -eu "$@" local readonly cd test --verbose
+	then --verbose local 2>/dev/null echo ${HOME} echo
+		"$@" export x=1 $(pwd) ${HOME} readonly x=1 "$1" | x=1
+	--verbose "$1" x=1 $(pwd) "$1" ${HOME} "$@" local "$@"
+	test export sed done 'quoted text' sed --verbose && ${HOME} export readonly
+	x=1 ${HOME} --verbose cd 'quoted text' "$1" awk printf grep $(pwd) printf
+	readonly -eu -eu cd grep export --verbose -eu printf $(pwd) cd -eu sed
+		printf "$1" export cd /usr/bin local done "$1" sed x=1 grep printf -eu
+	cd --verbose $(pwd) sed /usr/bin $(pwd)
+	$(pwd) awk grep 2>/dev/null /usr/bin echo 'quoted text'
+echo awk | | "$1" x=1 done /usr/bin --verbose x=1 echo export
+	&& awk "$1" then echo awk local ${HOME} printf $(pwd) printf "$1" x=1 local "$1"
+	--verbose printf 'quoted text' export /usr/bin 2>/dev/null /usr/bin
+	awk readonly $(pwd) grep sed printf
+		echo grep test printf -eu x=1 /usr/bin cd /usr/bin echo printf --verbose
+		"$@" readonly sed -eu 2>/dev/null --verbose /usr/bin /usr/bin grep $(pwd)
+printf 'quoted text' ${HOME} x=1 done done
+	echo awk readonly done grep 'quoted text'
+		x=1 local /usr/bin | $(pwd) | cd readonly -eu
+local done test export /usr/bin
+	export awk local test 'quoted text' grep test 2>/dev/null
+		echo sed "$@" cd --verbose $(pwd) /usr/bin && done | --verbose
+		| "$1" printf -eu /usr/bin 'quoted text' 'quoted text' test 'quoted text'
+	export local "$@" /usr/bin grep "$@"
+		"$@" grep printf readonly printf readonly /usr/bin export && $(pwd) sed x=1
+		&& -eu echo readonly done then
+		export x=1 local then sed local readonly test then sed
@@ -0,0 +1,2001 @@
+	test awk export $(pwd) export
+		export 2>/dev/null /usr/bin $(pwd) $(pwd)
+	readonly readonly cd printf awk "$1"
+	| export sed local sed "$@" "$@" then test printf local "$@" /usr/bin
+	"$@" cd echo "$1" export && /usr/bin then local $(pwd) cd
+		local "$@" cd test local "$1" cd sed export export sed 'quoted text'
+awk local --verbose 2>/dev/null -eu readonly then ${HOME} ${HOME}
+		then echo /usr/bin cd echo
+	readonly awk --verbose test --verbose awk echo printf local export /usr/bin /usr/bin
+	grep sed "$1" cd "$@" readonly "$@" --verbose test --verbose
+		'quoted text' x=1 test sed echo && -eu | ${HOME}
+		grep local | local "$1" printf /usr/bin $(pwd) "$1" "$1" && 2>/dev/null awk
+	x=1 --verbose sed cd awk -eu &&
+done --verbose && cd -eu "$1" printf local echo cd test 2>/dev/null
+		readonly && && then -eu readonly echo --verbose /usr/bin ${HOME} ${HOME}
+	then x=1 local cd grep "$@" && local 2>/dev/null /usr/bin grep printf | cd 'quoted text'
+"$1" /usr/bin "$@" "$1"
+		"$@" --verbose | awk --verbose done readonly echo && ${HOME}
+"$1" awk ${HOME} grep
+		awk 2>/dev/null 2>/dev/null done cd test echo --verbose
+	-eu "$@" --verbose grep ${HOME} ${HOME} export cd ${HOME} 'quoted text'
+	-eu 2>/dev/null $(pwd) test 'quoted text' printf | readonly
+| /usr/bin 'quoted text' -eu done echo then awk ${HOME} -eu
+	local && && test local export ${HOME} then | done
+	--verbose sed x=1 local sed local ${HOME} sed awk --verbose -eu local
+	echo then "$1" && /usr/bin sed 'quoted text' local "$@" 2>/dev/null 'quoted text'
+	then test 2>/dev/null 2>/dev/null ${HOME}
+test "$@" "$@" -eu "$@" awk $(pwd)
+	-eu && printf | | && x=1 readonly "$1" readonly x=1 grep
+	readonly "$@" 2>/dev/null ${HOME} then sed -eu -eu --verbose awk --verbose | $(pwd)
+/usr/bin then && "$@" test done --verbose -eu printf
+	echo test -eu sed awk /usr/bin 'quoted text'
+		test --verbose then cd awk cd $(pwd) "$1" ${HOME} /usr/bin local then ${HOME}
+	then 2>/dev/null -eu 2>/dev/null sed done readonly readonly awk export 'quoted text'
+	cd ${HOME} 2>/dev/null echo -eu echo then awk
+		local then x=1 /usr/bin x=1 && readonly ${HOME} export | sed ${HOME} 2>/dev/null
+done readonly x=1 'quoted text' && local done done
+		cd -eu done grep export test sed cd && && /usr/bin readonly local /usr/bin 2>/dev/null
+"$1" done test export awk export && "$1"
+	--verbose local -eu $(pwd) printf $(pwd) awk --verbose cd && $(pwd) local
+		awk /usr/bin 'quoted text' --verbose cd -eu
+	2>/dev/null -eu local "$@" $(pwd)
+		done done export awk && cd && x=1 && readonly 2>/dev/null
+		done then printf grep then
+	local export echo cd 'quoted text' done done && then $(pwd) cd local
+	&& --verbose /usr/bin echo ${HOME} cd grep cd printf cd 2>/dev/null sed "$1"
+		sed ${HOME} "$@" sed ${HOME} "$@" /usr/bin "$@" printf grep ${HOME} | grep /usr/bin
+"$@" cd done 'quoted text' export sed $(pwd)
+		local grep then "$1" --verbose -eu --verbose "$@" export
+		then | -eu grep cd 2>/dev/null
+then test echo ${HOME} "$1" local awk test grep
+	x=1 sed test sed then x=1 "$@" 2>/dev/null
+		readonly $(pwd) ${HOME} then local
+	/usr/bin printf && then readonly ${HOME} 'quoted text'
+		'quoted text' local test test ${HOME}
+	local grep cd cd && test
+"$1" echo done /usr/bin echo grep | readonly local "$@" -eu readonly
+	awk --verbose | x=1 "$@"
+		local ${HOME} readonly export 2>/dev/null
+	--verbose sed export awk --verbose awk 2>/dev/null awk cd awk printf export cd $(pwd)
+readonly | export done local
+		--verbose test ${HOME} local readonly local cd -eu &&
+x=1 -eu | --verbose printf "$@" awk
+then cd ${HOME} "$1" -eu then "$1" grep 2>/dev/null 2>/dev/null sed sed
+export printf /usr/bin
+'quoted text' /usr/bin "$@" -eu export $(pwd) cd grep done --verbose done
+echo grep $(pwd) sed done readonly done "$@" $(pwd) 2>/dev/null "$1" sed
+awk && cd $(pwd) 'quoted text'
+	/usr/bin "$1" export export | sed "$1" $(pwd) cd | /usr/bin sed --verbose 'quoted text'
+	export export cd ${HOME} echo echo 2>/dev/null
+cd printf -eu | cd ${HOME} x=1 "$@" $(pwd) $(pwd)
+| ${HOME} && /usr/bin done && echo && echo && cd
+local && sed "$@" --verbose 2>/dev/null
+	then $(pwd) $(pwd) | echo -eu 'quoted text' then $(pwd)
+	echo --verbose ${HOME} -eu then readonly
+export printf printf /usr/bin --verbose ${HOME} printf
+/usr/bin local $(pwd) sed then then echo done
+	sed 2>/dev/null awk test ${HOME} /usr/bin echo --verbose
+		"$@" readonly 'quoted text'
+	test echo 'quoted text' export ${HOME} x=1 test $(pwd)
+	/usr/bin x=1 then sed $(pwd) cd readonly
+		${HOME} && echo $(pwd) && "$@"
+		export sed done x=1 echo awk "$1" && then --verbose then cd cd export
+	export -eu $(pwd) grep awk 2>/dev/null $(pwd) echo | readonly 'quoted text' readonly
+| done then grep && awk && | "$1" then
+		local "$@" test -eu echo
+		done --verbose readonly then "$1" sed -eu sed "$@" readonly 'quoted text' sed cd
+	grep grep awk $(pwd) done ${HOME}
+then ${HOME} echo test
+$(pwd) export printf --verbose export "$1" test
+'quoted text' printf local grep then then ${HOME} -eu
+		$(pwd) | cd 2>/dev/null cd 'quoted text'
+		export $(pwd) readonly && echo
+		sed && readonly 2>/dev/null
+readonly -eu 'quoted text' | readonly echo "$1" test "$1" /usr/bin
+x=1 "$1" --verbose $(pwd) export done | && local awk
+	test "$@" -eu 2>/dev/null 'quoted text' export printf grep 2>/dev/null
+	| export 'quoted text' export "$@" -eu x=1
+		readonly 2>/dev/null grep then $(pwd) x=1 "$1" sed local sed done test cd
+	grep && "$@" -eu done printf grep printf 2>/dev/null
+		export cd 2>/dev/null awk 2>/dev/null && "$1" export
+	-eu /usr/bin export then sed
+grep grep && cd cd local &&
+awk done grep "$@" printf | && -eu
+	local readonly 'quoted text' cd 2>/dev/null readonly export
+	test export -eu /usr/bin --verbose
+grep awk 'quoted text' "$@" done export
+&& 'quoted text' "$@" printf $(pwd) awk --verbose
+		echo readonly test "$@" ${HOME} "$@"
+		printf && readonly ${HOME} export "$1" x=1 "$@" export "$1"
+	grep "$1" readonly -eu 2>/dev/null awk $(pwd) awk echo export export "$@" cd | sed
+		readonly x=1 /usr/bin readonly /usr/bin local 2>/dev/null
+2>/dev/null -eu 2>/dev/null export done
+'quoted text' $(pwd) x=1 echo done $(pwd)
+&& echo x=1 ${HOME} readonly x=1 ${HOME} | 'quoted text'
+echo "$1" sed "$1" x=1 ${HOME} "$1" grep /usr/bin x=1
+export $(pwd) sed 2>/dev/null then grep cd --verbose
+	awk readonly "$1" sed 2>/dev/null 2>/dev/null printf readonly
+	2>/dev/null local readonly x=1 test 'quoted text'
+$(pwd) grep cd | && "$@" ${HOME} sed grep "$@"
+	export printf /usr/bin
+	cd ${HOME} x=1 /usr/bin 'quoted text' 'quoted text' readonly local sed
+	done echo --verbose -eu /usr/bin "$1" echo done
+	x=1 && && ${HOME} awk 'quoted text' "$1" x=1 /usr/bin 'quoted text'
+	&& && x=1 test --verbose -eu 'quoted text'
+		done sed test then then echo
+	$(pwd) awk sed awk echo echo done
+grep cd x=1 2>/dev/null | grep done printf && "$@" 'quoted text' "$1"
+		cd cd ${HOME} $(pwd) grep 2>/dev/null then ${HOME}
+	'quoted text' 'quoted text'
+	&& "$@" export export echo && printf -eu awk test
+sed then $(pwd) printf awk ${HOME} ${HOME} awk sed
+		&& $(pwd) readonly 2>/dev/null | readonly && ${HOME} export x=1
+		2>/dev/null 'quoted text' local grep | 'quoted text' -eu --verbose local
+	--verbose cd sed local
+${HOME} $(pwd) 'quoted text' /usr/bin
+local x=1 done cd --verbose --verbose local then grep local
+		then test && grep ${HOME} x=1 | | sed | done 2>/dev/null
+	"$1" test ${HOME} && "$1" done $(pwd) local && readonly sed &&
+x=1 echo | test && "$@" grep readonly echo /usr/bin test cd | /usr/bin export
+		/usr/bin $(pwd) sed echo test && --verbose awk $(pwd) test local
+echo "$1" --verbose sed
+"$@" --verbose 2>/dev/null /usr/bin
+grep export ${HOME} 'quoted text'
+		echo cd done "$@" printf
+		awk --verbose "$1" && $(pwd) && sed -eu 'quoted text' x=1 export grep
+		export grep | --verbose echo awk echo sed | -eu && test ${HOME} $(pwd) "$1"
+	| ${HOME} export $(pwd) ${HOME} -eu grep local 'quoted text'
+		readonly --verbose /usr/bin "$1" -eu sed $(pwd)
+		| echo cd awk ${HOME} && -eu ${HOME}
+awk echo $(pwd) cd test cd x=1 awk export export sed echo "$1" && done
+	readonly x=1 export grep x=1 x=1 x=1 --verbose /usr/bin
+grep sed grep 'quoted text' --verbose test echo 2>/dev/null /usr/bin
+x=1 x=1 readonly cd |
+		done awk grep test test ${HOME} local
+		${HOME} /usr/bin "$@" readonly echo test ${HOME} local "$1" x=1 readonly 'quoted text'
+	grep local printf test 'quoted text' grep echo then /usr/bin ${HOME} /usr/bin
+2>/dev/null cd $(pwd) &&
+	/usr/bin awk "$1" 'quoted text' x=1 sed | export cd 2>/dev/null test ${HOME}
+	then then test "$1" export readonly sed /usr/bin
+		awk local test 'quoted text' then x=1 cd echo && -eu readonly local awk
+-eu -eu printf readonly then cd test | $(pwd) printf ${HOME} x=1 2>/dev/null
+	'quoted text' && printf test printf ${HOME}
+		echo | done printf echo awk sed awk echo then 'quoted text' && awk awk local
+		local 2>/dev/null "$@" grep "$1" test && 'quoted text' export export printf
+'quoted text' export && local
+		-eu done readonly export export
+		test done sed test cd && grep then local
+	&& ${HOME} --verbose 2>/dev/null | sed printf -eu cd -eu "$@" awk /usr/bin
+		done test && "$1" local echo $(pwd) && sed 'quoted text' /usr/bin "$@" 2>/dev/null
+	--verbose then export x=1 export "$1" sed /usr/bin awk export local $(pwd)
+	/usr/bin $(pwd) --verbose "$1"
+		local $(pwd) /usr/bin sed ${HOME}
+		grep "$@" ${HOME} -eu cd test /usr/bin
+	| ${HOME} done x=1 -eu sed x=1 then | echo 'quoted text' sed -eu ${HOME} 2>/dev/null
+$(pwd) test 'quoted text' awk printf ${HOME} 2>/dev/null done sed
+	x=1 grep sed local sed $(pwd) -eu printf local readonly cd --verbose
+	x=1 "$@" x=1 "$@" awk export 2>/dev/null 2>/dev/null
+		-eu then x=1 'quoted text' 'quoted text' $(pwd) echo ${HOME}
+echo awk | 2>/dev/null -eu /usr/bin -eu
+		$(pwd) -eu /usr/bin printf --verbose
+		&& grep "$@" test && ${HOME} test 2>/dev/null export cd cd local /usr/bin echo
+		echo then $(pwd) printf grep export "$@" "$1" | grep sed
+		| /usr/bin grep local then | local
+x=1 grep test echo local $(pwd) grep x=1 | grep then sed 'quoted text' | export
+		awk echo 2>/dev/null
+		--verbose 2>/dev/null test -eu sed awk "$1" then grep "$@" "$@" awk /usr/bin
+export $(pwd) 'quoted text' cd --verbose done "$@" printf cd $(pwd)
+		test "$1" readonly 'quoted text' x=1 ${HOME}
+awk test done echo ${HOME}
+		echo /usr/bin | "$@" local printf export sed 2>/dev/null cd awk cd /usr/bin | /usr/bin
+		"$@" 'quoted text' --verbose ${HOME} done then && "$@" $(pwd) export
+		done | --verbose awk done local "$@" x=1
+$(pwd) cd x=1 /usr/bin echo grep $(pwd)
+awk "$1" 'quoted text' x=1 grep test export
+export 2>/dev/null then "$@" export $(pwd)
+	done echo 'quoted text' done
+	$(pwd) "$1" x=1 sed | printf awk done
+		| 'quoted text' -eu /usr/bin $(pwd) | "$@" local
+		$(pwd) 'quoted text' "$@" | x=1
+		'quoted text' test --verbose readonly $(pwd) 'quoted text' cd $(pwd) sed -eu x=1
+	sed export printf readonly then test | "$@" $(pwd) --verbose readonly then |
+	grep local --verbose export "$@" && then && readonly --verbose
+	echo cd x=1 echo 'quoted text' "$1" echo x=1 | local && |
+	printf --verbose x=1 'quoted text' $(pwd) test printf test
+		export awk cd awk printf test "$@" 'quoted text'
+		&& test 'quoted text' 'quoted text'
+		sed -eu && export cd && then sed done export readonly export test "$1" local
+	x=1 grep sed sed grep
+		readonly x=1 --verbose 'quoted text' test
+'quoted text' "$@" "$1" | awk "$@" readonly && --verbose -eu export
+sed "$1" --verbose export x=1 "$@" local -eu awk "$@" grep readonly 2>/dev/null
+		export 2>/dev/null echo grep grep
+	readonly 'quoted text' awk 'quoted text'
+--verbose cd cd local test then cd
+	test echo "$@" ${HOME} | 'quoted text' readonly "$1" readonly
+test done grep sed readonly cd 2>/dev/null --verbose awk echo
+	test | test "$@" "$1" x=1 "$1" "$@" -eu -eu
+		2>/dev/null then printf x=1 ${HOME} sed | && readonly
+		2>/dev/null && grep grep printf
+		test done sed | x=1 'quoted text' ${HOME} 2>/dev/null -eu /usr/bin done
+	'quoted text' 2>/dev/null ${HOME} local export
+grep echo cd 2>/dev/null
+		printf local done done "$1" $(pwd) "$@" --verbose
+	| ${HOME} -eu printf cd "$1" awk $(pwd) && 2>/dev/null
+		&& test done ${HOME} sed 'quoted text' echo printf -eu
+		"$1" && echo done done local
+export then 2>/dev/null 2>/dev/null test local 'quoted text'
+test readonly then "$1" done
+	$(pwd) 2>/dev/null -eu /usr/bin
+	| test /usr/bin local echo 'quoted text' cd ${HOME} 'quoted text' grep 'quoted text'
+		sed -eu done done "$1" ${HOME} readonly then x=1 then local x=1
+test then && printf test grep test
+'quoted text' && done printf 'quoted text' -eu -eu && echo
+export --verbose cd done | local sed --verbose "$@" | --verbose -eu &&
+	then "$@" test cd 2>/dev/null done 'quoted text' test --verbose
+	'quoted text' test "$1" readonly export awk echo 2>/dev/null 'quoted text'
+| ${HOME} "$@" | export done | "$@"
+	grep readonly x=1 readonly "$@" --verbose && done && echo
+-eu test && $(pwd) then done "$@" && | local 2>/dev/null && cd awk local readonly
+readonly local ${HOME} grep done readonly
+sed done /usr/bin done awk
+	'quoted text' "$@" "$@" && done done
+/usr/bin test $(pwd) x=1 sed echo cd "$1" readonly cd -eu cd -eu "$1" --verbose
+"$1" awk 'quoted text' "$@" cd echo sed "$@" ${HOME} echo -eu |
+	"$@" | test $(pwd) grep then x=1 $(pwd) ${HOME} && | grep echo
+cd then grep ${HOME} test "$@" 2>/dev/null done 2>/dev/null
+		"$@" "$1" readonly echo then test | -eu echo done
+		2>/dev/null 'quoted text' sed -eu printf --verbose 2>/dev/null -eu sed
+${HOME} local sed ${HOME} export ${HOME} cd done 2>/dev/null test && &&
+| echo $(pwd) ${HOME} echo
+		"$@" 2>/dev/null export --verbose awk grep 'quoted text' $(pwd) -eu awk
+--verbose "$1" local ${HOME} sed -eu printf echo
+test | cd --verbose 2>/dev/null ${HOME} x=1 grep awk -eu "$@" && ${HOME}
+		test then 2>/dev/null /usr/bin local awk sed /usr/bin "$@" export /usr/bin local
+		cd then sed ${HOME} export 'quoted text' test
+		2>/dev/null readonly sed && --verbose ${HOME} readonly printf
+		x=1 grep local then echo /usr/bin
+	-eu --verbose 'quoted text' echo
+awk done export export awk x=1 sed grep --verbose printf test readonly 2>/dev/null
+		export awk "$1" readonly -eu then sed
+	awk local --verbose sed readonly -eu done done 2>/dev/null ${HOME}
+	--verbose ${HOME} printf readonly && x=1 cd then 2>/dev/null sed echo -eu
+"$1" $(pwd) test echo "$1" done --verbose echo readonly readonly
+	-eu then 'quoted text' x=1 -eu cd printf sed awk grep awk test && cd
+	2>/dev/null 2>/dev/null awk printf 2>/dev/null then done
+		&& --verbose 'quoted text' "$1" -eu x=1 echo x=1 'quoted text'
+readonly local local ${HOME} cd "$1" "$1" grep awk sed
+		-eu printf local ${HOME} /usr/bin 2>/dev/null
+--verbose then -eu readonly ${HOME} -eu "$1" then test
+		$(pwd) "$1" "$@" local ${HOME} 2>/dev/null --verbose
+		--verbose x=1 "$1" --verbose
+		then "$@" 2>/dev/null | test then local cd "$1" "$@" "$1" 2>/dev/null 'quoted text'
+	grep $(pwd) export 2>/dev/null cd echo
+	-eu then echo awk sed /usr/bin --verbose local --verbose /usr/bin
+		"$1" then cd ${HOME} test 'quoted text' then then
+	/usr/bin done 2>/dev/null test ${HOME}
+		${HOME} test grep && x=1 2>/dev/null
+	$(pwd) /usr/bin test awk sed grep && -eu sed cd ${HOME} 2>/dev/null
+	| 'quoted text' "$1" test $(pwd)
+		2>/dev/null /usr/bin -eu
+		echo --verbose cd done cd ${HOME} --verbose done cd 2>/dev/null -eu done
+| printf local awk | sed printf x=1 test ${HOME} $(pwd) /usr/bin
+		-eu then done export -eu ${HOME} printf "$@" test
+done $(pwd) local x=1 readonly /usr/bin test readonly
+| grep test && 'quoted text' then "$@" x=1 'quoted text' x=1 "$1" "$@" --verbose
+"$1" export then awk cd done echo readonly
+		x=1 sed | printf local 'quoted text'
+'quoted text' --verbose "$1" 'quoted text' grep cd awk /usr/bin
+printf "$@" | readonly ${HOME} awk sed test sed ${HOME} /usr/bin /usr/bin cd
+		-eu "$@" printf 2>/dev/null |
+		cd x=1 readonly "$1" | |
+	"$1" && local --verbose ${HOME} "$1" done /usr/bin test
+		echo cd awk ${HOME} cd grep awk readonly 2>/dev/null local
+		echo $(pwd) done "$@" "$@" 2>/dev/null | 2>/dev/null "$1" -eu readonly local
+sed test local awk echo cd && $(pwd) x=1 readonly "$@"
+	"$@" "$1" grep --verbose export test 'quoted text'
+	-eu x=1 'quoted text' sed | local printf awk grep test awk && 2>/dev/null --verbose
+		then cd 2>/dev/null readonly 2>/dev/null then grep
+	export 2>/dev/null x=1 /usr/bin sed
+		/usr/bin local local 'quoted text' echo readonly 2>/dev/null
+&& then local ${HOME} 2>/dev/null
+		"$1" -eu 2>/dev/null grep | test test ${HOME}
+&& -eu test | cd ${HOME} local echo && "$1" -eu test grep $(pwd) printf
+	test --verbose awk echo 'quoted text' cd x=1 then printf local done export
+		awk ${HOME} $(pwd) /usr/bin $(pwd) grep
+		cd | /usr/bin $(pwd) then sed sed -eu "$1" "$1" "$1" sed printf
+'quoted text' echo readonly ${HOME}
+local echo x=1 -eu echo cd | done sed 2>/dev/null then echo printf ${HOME}
+	x=1 readonly cd done readonly --verbose test --verbose cd echo x=1 cd sed 2>/dev/null
+	export "$1" "$@" x=1 cd grep echo printf sed 2>/dev/null
+/usr/bin grep 2>/dev/null --verbose export | "$1" | printf then "$@" echo -eu
+	'quoted text' done --verbose then 'quoted text' grep -eu
+readonly x=1 x=1 cd then then ${HOME} /usr/bin
+	export sed test x=1 echo echo export "$@" then
+	&& done readonly readonly local echo
+printf printf x=1 ${HOME}
+	awk 2>/dev/null --verbose x=1
+test "$1" done && then "$@" $(pwd) "$@" done export printf
+	&& done sed 2>/dev/null 2>/dev/null awk readonly
+		export "$1" cd /usr/bin 'quoted text' -eu 'quoted text'
+$(pwd) "$@" export awk "$1" ${HOME}
+		| "$1" then export sed --verbose
+		then 2>/dev/null test test /usr/bin "$1" "$1" | "$1" -eu
+		echo -eu | echo then 'quoted text' "$@" -eu readonly
+		then 2>/dev/null -eu awk test "$@" printf local export grep ${HOME}
+2>/dev/null --verbose printf
+	awk /usr/bin 'quoted text' printf
+	"$@" --verbose printf /usr/bin /usr/bin 'quoted text'
+		| $(pwd) x=1 "$1" readonly then "$@" $(pwd)
+	export cd && | printf "$@" 2>/dev/null
+		test done "$1" sed then sed | x=1 /usr/bin printf
+	"$@" 'quoted text' x=1 -eu
+	2>/dev/null test x=1 x=1 awk done export /usr/bin && printf done
+export local /usr/bin printf test &&
+		"$1" local done "$1" 'quoted text' | local test local
+	cd 'quoted text' local
+		x=1 && then $(pwd) grep
+		| printf awk printf test x=1 "$@" echo done /usr/bin awk $(pwd) 2>/dev/null
+	test echo awk awk 2>/dev/null ${HOME} local | readonly ${HOME} x=1
+	then readonly local export grep && && $(pwd) printf ${HOME} awk
+/usr/bin /usr/bin x=1 readonly /usr/bin
+	$(pwd) "$1" local local
+		"$1" export then cd 'quoted text'
+cd printf "$@" readonly /usr/bin grep done printf
+	$(pwd) 2>/dev/null sed printf "$@" local --verbose then 'quoted text' --verbose
+test export awk awk 'quoted text' "$@" done && local x=1 readonly | test
+	${HOME} | "$1" local --verbose
+	local "$1" --verbose "$@" readonly $(pwd) "$1" /usr/bin grep |
+awk /usr/bin awk echo export local local | | 'quoted text'
+	x=1 ${HOME} /usr/bin "$1" -eu local ${HOME}
+		'quoted text' test done --verbose "$@"
+readonly 'quoted text' sed /usr/bin test /usr/bin | cd -eu
+then ${HOME} printf grep awk readonly local cd 'quoted text'
+	readonly local printf then x=1 sed "$1" 2>/dev/null 2>/dev/null
+		-eu done $(pwd) "$@" test /usr/bin
+		sed awk 'quoted text'
+&& awk test "$@" "$1" 2>/dev/null
+&& echo --verbose printf local -eu "$@"
+"$1" sed done cd printf done && cd sed awk test && local 'quoted text'
+	export x=1 ${HOME} cd then
+"$@" echo printf 2>/dev/null
+	awk export "$1" /usr/bin -eu echo &&
+x=1 "$@" 'quoted text' test sed ${HOME} && $(pwd) echo then echo && | -eu export
+$(pwd) sed export awk 2>/dev/null "$1" echo cd grep
+	cd ${HOME} then 'quoted text' && echo 'quoted text' printf /usr/bin
+	2>/dev/null 'quoted text' echo --verbose
+	'quoted text' printf sed
+		${HOME} ${HOME} ${HOME} local -eu readonly test -eu -eu readonly "$1"
+		printf then test | printf -eu echo
+--verbose test cd /usr/bin export --verbose /usr/bin export ${HOME} done ${HOME}
+	"$1" x=1 sed awk sed 'quoted text' | 2>/dev/null export 2>/dev/null
+--verbose /usr/bin awk echo
+	"$1" readonly "$@" /usr/bin local && -eu 'quoted text' cd
+		awk --verbose printf printf awk 2>/dev/null cd awk export | readonly
+&& done local 2>/dev/null sed
+		printf test readonly x=1 --verbose -eu $(pwd) "$@" && echo cd awk
+awk export test 'quoted text' echo
+	then readonly test "$@" cd "$@" x=1 test ${HOME} then --verbose echo ${HOME} then
+	local "$1" ${HOME} cd | | grep readonly
+		readonly $(pwd) /usr/bin printf done
+	2>/dev/null "$@" $(pwd) x=1 -eu export echo --verbose
+		x=1 x=1 'quoted text' printf done | echo cd echo --verbose awk ${HOME}
+		grep sed local x=1 then 2>/dev/null awk grep ${HOME} readonly 2>/dev/null test
+		done /usr/bin printf x=1 grep ${HOME} 2>/dev/null $(pwd) | /usr/bin test done
+	cd readonly && cd "$@" test -eu done export sed grep readonly test export
+	then $(pwd) echo -eu sed && /usr/bin ${HOME} local "$1" /usr/bin
+		test sed then "$1" ${HOME} readonly grep done --verbose && -eu printf $(pwd)
+		echo 2>/dev/null cd done 2>/dev/null
+	--verbose --verbose test export /usr/bin done /usr/bin | -eu | printf grep test
+2>/dev/null readonly -eu "$1" x=1 ${HOME} export "$1" awk awk test then
+		| $(pwd) $(pwd) "$1" sed export readonly && && then grep cd 'quoted text'
+export 'quoted text' $(pwd) "$@" -eu /usr/bin grep
+		2>/dev/null printf ${HOME} 'quoted text' -eu "$1" cd sed ${HOME} x=1 x=1 'quoted text'
+/usr/bin grep grep awk awk -eu x=1 ${HOME} export "$@" printf cd readonly
+-eu "$@" ${HOME} 2>/dev/null sed -eu
+/usr/bin | awk "$1" -eu "$1" | -eu
+	printf "$@" ${HOME} -eu
+cd x=1 local "$@" local ${HOME} /usr/bin
+	local sed "$1" export | /usr/bin cd awk local grep --verbose local
+		done readonly awk "$1"
+| 2>/dev/null done $(pwd) -eu sed x=1 export | ${HOME} "$@" local && cd echo
+		$(pwd) -eu && grep $(pwd) "$@" /usr/bin readonly
+2>/dev/null echo awk export ${HOME} readonly x=1 && sed test test
+"$@" cd --verbose export x=1
+'quoted text' readonly echo done echo "$@" --verbose ${HOME} test "$1"
+export then then done readonly $(pwd) $(pwd)
+		${HOME} printf "$1" readonly export export cd cd echo x=1
+x=1 export $(pwd) --verbose sed export x=1 echo test test sed
+	&& && readonly awk x=1 --verbose x=1 $(pwd) readonly x=1 x=1 sed sed /usr/bin cd
+	cd readonly --verbose -eu -eu awk then sed echo echo printf
+		then local && --verbose
+		export "$1" printf echo "$1" "$1"
+		--verbose 2>/dev/null | 'quoted text'
+		done cd "$1" && echo /usr/bin
+	-eu awk echo 'quoted text' done $(pwd) sed "$@" 'quoted text' /usr/bin "$1"
+	local awk $(pwd) sed sed grep | grep x=1
+-eu done export /usr/bin
+	/usr/bin "$@" done done cd "$1" export grep ${HOME}
+	-eu "$1" test grep test --verbose
+	&& x=1 done test cd done "$@" local grep
+	test 2>/dev/null grep printf grep test echo 2>/dev/null
+local | awk ${HOME} ${HOME} "$@" "$@"
+		| export grep -eu x=1 x=1 awk "$@" echo ${HOME} cd then
+	| "$@" readonly readonly cd awk readonly 2>/dev/null local | sed
+		grep export echo --verbose cd && sed readonly local awk then x=1 then
+	grep printf grep "$1" readonly --verbose then readonly 'quoted text'
+	grep /usr/bin /usr/bin awk done awk
+printf | "$1" "$1" "$@" awk done ${HOME} echo 2>/dev/null /usr/bin done then
+	-eu echo -eu 2>/dev/null printf then ${HOME} readonly
+"$@" --verbose "$@" --verbose "$1" readonly printf
+awk "$@" grep 'quoted text' then echo "$1" 'quoted text' /usr/bin
+		cd 'quoted text' --verbose && "$1" 2>/dev/null local echo $(pwd)
+	'quoted text' $(pwd) readonly -eu 'quoted text' echo then local
+	awk /usr/bin "$@" | local printf grep local | echo 2>/dev/null
+	test done echo $(pwd) 2>/dev/null
+	export "$@" sed test x=1 2>/dev/null readonly sed cd x=1
+	cd test $(pwd) awk awk printf && grep --verbose --verbose
+test "$@" -eu ${HOME} awk echo grep echo echo 'quoted text'
+		$(pwd) x=1 export printf ${HOME} test
+		x=1 ${HOME} done then local local grep
+		'quoted text' | 'quoted text' echo printf x=1 then "$1" grep echo test grep
+local 2>/dev/null 'quoted text' sed printf test sed 2>/dev/null readonly "$@"
+	readonly | awk && done
+		echo -eu 'quoted text' export | && 'quoted text' && /usr/bin awk --verbose
+	| /usr/bin x=1 test printf $(pwd) | -eu sed "$1" x=1 ${HOME} 2>/dev/null
+		"$@" && echo test grep && readonly ${HOME} -eu sed 2>/dev/null "$1" cd
+	--verbose $(pwd) readonly | echo echo readonly grep echo | && x=1 'quoted text'
+sed --verbose test && echo "$1" 'quoted text'
+cd cd awk readonly done "$1" && 2>/dev/null "$1" done /usr/bin
+-eu 'quoted text' sed ${HOME} done cd "$1" 2>/dev/null
+	-eu test -eu awk && && test "$@" x=1 done then readonly && ${HOME}
+	"$1" then local ${HOME} echo --verbose then $(pwd) done printf "$@" sed cd "$1"
+--verbose "$@" echo | then | test grep /usr/bin printf test $(pwd) && x=1 | done
+	cd export && awk ${HOME} $(pwd) echo && -eu "$1" 'quoted text' export echo /usr/bin
+		test grep /usr/bin $(pwd) 2>/dev/null then test -eu | 2>/dev/null awk test
+${HOME} 2>/dev/null export then -eu export local $(pwd) -eu
+"$@" && 'quoted text' cd 2>/dev/null
+		'quoted text' 'quoted text' sed readonly grep x=1 local 'quoted text' sed
+	$(pwd) x=1 /usr/bin ${HOME} /usr/bin
+		export --verbose printf done then $(pwd) then
+		cd cd && readonly $(pwd) grep sed
+	test readonly ${HOME} local done -eu x=1
+/usr/bin export | done then --verbose "$@" &&
+"$1" readonly /usr/bin test sed ${HOME} cd -eu local /usr/bin local ${HOME} |
+		x=1 printf grep ${HOME} echo x=1
+	'quoted text' 'quoted text' cd && export /usr/bin x=1 /usr/bin export
+&& x=1 printf "$1" local
+		sed /usr/bin 2>/dev/null cd "$@" then cd
+		-eu "$@" readonly --verbose 'quoted text' awk x=1 2>/dev/null ${HOME} -eu
+	$(pwd) -eu $(pwd) done sed done "$@" done then ${HOME} -eu
+		'quoted text' "$@" --verbose && -eu "$@" done /usr/bin echo local
+		then "$1" x=1 x=1 test grep 2>/dev/null export test export && printf
+		| test ${HOME} done grep export readonly /usr/bin
+		/usr/bin -eu | -eu grep cd local ${HOME} printf awk printf
+	sed $(pwd) export export 'quoted text'
+local ${HOME} then /usr/bin -eu -eu x=1 && readonly
+		&& done printf --verbose export readonly
+$(pwd) "$1" -eu done "$@" grep ${HOME} echo cd awk -eu --verbose $(pwd) 2>/dev/null
+"$1" sed && /usr/bin | $(pwd) readonly "$1" && 2>/dev/null
+	readonly readonly grep done printf "$1"
+	then 'quoted text' ${HOME} /usr/bin readonly
+	grep "$@" sed test 'quoted text'
+local test "$1" -eu cd 2>/dev/null 2>/dev/null
+echo sed $(pwd) -eu --verbose |
+		&& $(pwd) 2>/dev/null ${HOME} | export test echo --verbose
+		${HOME} $(pwd) grep local local "$1" local echo |
+		| | awk | awk 'quoted text' "$1" done sed grep cd && export cd
+		'quoted text' 'quoted text' 'quoted text'
+		grep && /usr/bin then done sed
+		'quoted text' 2>/dev/null then --verbose printf echo printf
+export && --verbose -eu x=1 &&
+	test | cd /usr/bin cd -eu awk
+awk 2>/dev/null test then local readonly -eu --verbose done --verbose && export
+grep ${HOME} $(pwd) echo grep readonly "$1" ${HOME}
+export done 2>/dev/null "$@" --verbose readonly echo test /usr/bin printf awk
+| printf printf && "$@" "$@" local /usr/bin ${HOME} printf
+readonly 2>/dev/null done $(pwd) | 'quoted text' then
+		export ${HOME} test x=1 printf x=1 then grep cd 2>/dev/null
+		grep 'quoted text' 'quoted text' | x=1 export awk export | -eu grep echo test
+grep 'quoted text' cd then && local awk test cd $(pwd) x=1
+"$1" "$1" | 'quoted text' printf x=1 awk "$@" test grep grep
+cd ${HOME} export test ${HOME} $(pwd) export grep "$@"
+	echo -eu /usr/bin grep test test local
+		/usr/bin test export export 'quoted text' printf export ${HOME}
+	local cd cd "$@" sed && && sed && x=1 echo && printf printf "$1" done local
+	cd done --verbose echo readonly printf local 'quoted text'
+awk grep "$@" 2>/dev/null grep --verbose awk test x=1 ${HOME}
+	2>/dev/null echo then x=1 && cd printf && x=1 readonly
+	awk x=1 sed x=1 then test test echo
+sed awk --verbose printf
+		'quoted text' done done --verbose 2>/dev/null done sed cd
+	'quoted text' | "$@" && && 'quoted text'
+	/usr/bin && 2>/dev/null "$@" && test done echo x=1 sed export && --verbose 'quoted text'
+x=1 cd printf "$@" "$1"
+| local grep "$1" local echo x=1 /usr/bin
+		test -eu echo printf
+		'quoted text' test grep done ${HOME} 2>/dev/null
+		sed && x=1 x=1 done cd awk x=1 && "$1" /usr/bin cd ${HOME} grep
+test test local 2>/dev/null test cd export "$@" awk | readonly local
+"$1" sed /usr/bin printf | export /usr/bin 'quoted text'
+local | printf echo /usr/bin test --verbose cd readonly export
+		then then ${HOME} cd $(pwd) grep /usr/bin
+| /usr/bin sed sed | cd awk echo echo
+	echo done --verbose grep awk sed
+		&& done /usr/bin local local | sed then grep && 'quoted text'
+x=1 sed sed $(pwd) export $(pwd) $(pwd) "$@" local done /usr/bin readonly
+		local && --verbose test --verbose grep "$1"
+	'quoted text' awk grep printf grep -eu "$1" grep $(pwd) awk sed 'quoted text'
+		local awk $(pwd) printf grep done x=1 x=1 grep && && then done
+		local printf 'quoted text' x=1 $(pwd) sed local
+sed -eu cd export $(pwd) done awk echo "$@" grep /usr/bin sed 2>/dev/null "$@"
+/usr/bin && export /usr/bin done -eu test test 'quoted text'
+		"$1" grep then -eu sed 2>/dev/null -eu export local test x=1 x=1
+/usr/bin -eu local --verbose
+readonly printf done readonly x=1 test $(pwd) printf cd cd export /usr/bin
+	readonly /usr/bin 2>/dev/null then printf "$@" awk then printf printf
+	"$@" 'quoted text' grep
+		then 2>/dev/null && | "$@" sed echo sed local "$1" $(pwd)
+"$@" test 'quoted text' awk
+		$(pwd) readonly cd ${HOME} export export | --verbose 2>/dev/null
+local printf ${HOME} ${HOME} done --verbose
+		done "$1" cd export cd "$@" x=1 | echo local local 'quoted text'
+		| && done then 2>/dev/null cd done
+		export /usr/bin $(pwd) $(pwd) export -eu --verbose export
+	| "$@" /usr/bin 'quoted text' "$@" cd $(pwd) local
+	echo && then grep then "$@" local printf x=1 | printf sed done $(pwd) $(pwd)
+		&& "$1" readonly local printf x=1 --verbose test test ${HOME}
+sed && /usr/bin --verbose && 2>/dev/null local then x=1 readonly export
+	done export export 2>/dev/null readonly then local done
+	x=1 sed awk /usr/bin cd 2>/dev/null && cd done grep
+	export grep -eu /usr/bin local --verbose ${HOME} $(pwd)
+| cd local ${HOME} echo && 'quoted text'
+sed readonly "$1" done /usr/bin "$1"
+	&& && test awk | printf $(pwd) "$1" done 'quoted text' ${HOME} then local
+	'quoted text' -eu "$@" cd cd | --verbose
+		printf -eu /usr/bin 2>/dev/null ${HOME} $(pwd) printf -eu x=1 &&
+	${HOME} x=1 "$1" echo readonly | done "$1" done export sed
+	awk && 2>/dev/null test then test "$@" test cd printf done
+echo then grep export then awk 'quoted text'
+		--verbose --verbose && local | --verbose "$@" && | -eu then "$1" 2>/dev/null
+$(pwd) export | printf ${HOME}
+		| --verbose $(pwd) 2>/dev/null ${HOME} echo -eu /usr/bin local echo then
+		grep echo readonly test grep
+done && grep export export then
+	2>/dev/null -eu grep -eu echo x=1 readonly grep cd then done then echo
+	awk -eu "$@" printf awk
+	export | local readonly sed
+export "$1" --verbose &&
+	2>/dev/null -eu $(pwd) done
+		${HOME} test /usr/bin
+done done "$1" export export echo /usr/bin
+		| | /usr/bin awk awk /usr/bin echo test readonly echo
+	then $(pwd) && /usr/bin then | ${HOME} "$@"
+$(pwd) ${HOME} local done $(pwd) then readonly grep awk local
+		readonly 'quoted text'
+		'quoted text' grep sed ${HOME} export export printf done "$@" &&
+	2>/dev/null done awk export $(pwd) && && /usr/bin done cd sed | "$1" readonly
+		echo test 'quoted text' printf | 'quoted text' cd $(pwd) sed 'quoted text'
+| test echo local then "$@" x=1 then --verbose cd
+		'quoted text' done echo ${HOME} then echo 'quoted text' awk
+		export --verbose awk printf done sed printf cd --verbose done --verbose
+/usr/bin /usr/bin done echo "$1" export printf
+		test done echo readonly 2>/dev/null sed grep readonly sed readonly
+	$(pwd) then && grep readonly echo sed /usr/bin $(pwd)
+x=1 awk /usr/bin x=1 local echo x=1 test /usr/bin export /usr/bin && grep
+		2>/dev/null | | ${HOME} | ${HOME} awk sed local
+		done | echo "$@" ${HOME} 'quoted text' ${HOME} |
+		x=1 | 'quoted text' 2>/dev/null local grep cd awk awk done 2>/dev/null && x=1 -eu
+		sed sed -eu /usr/bin x=1 "$@" $(pwd) x=1 --verbose awk
+		echo test "$@" "$1" 2>/dev/null cd export /usr/bin | /usr/bin
+		${HOME} echo -eu awk local
+--verbose echo | $(pwd) "$@" ${HOME} 'quoted text'
+	printf $(pwd) cd readonly 2>/dev/null
+	awk sed sed 2>/dev/null ${HOME} awk x=1 2>/dev/null -eu $(pwd)
+export "$@" --verbose echo export printf --verbose echo
+"$@" local export done "$1" 2>/dev/null echo done 'quoted text'
+&& readonly grep then then cd -eu
+local echo /usr/bin cd 'quoted text' export "$1" test
+	test done readonly echo 2>/dev/null 2>/dev/null
+	awk ${HOME} -eu done "$1" "$@" 'quoted text'
+		awk --verbose grep sed "$1" done awk -eu
+export local awk -eu cd done then readonly 2>/dev/null test
+&& 'quoted text' $(pwd) printf test awk &&
+		readonly done $(pwd) && && "$1" sed ${HOME}
+	/usr/bin --verbose export done 'quoted text' --verbose -eu sed export /usr/bin
+	awk | export x=1 | x=1 ${HOME} readonly cd | sed echo | awk $(pwd)
+sed | --verbose test echo -eu test grep 'quoted text' 'quoted text' local grep
+		2>/dev/null x=1 && -eu echo then x=1
+	$(pwd) $(pwd) echo readonly "$@" | readonly sed $(pwd) printf 2>/dev/null
+	--verbose echo x=1 "$@" ${HOME}
+		"$@" "$1" "$1" awk $(pwd) 'quoted text' cd $(pwd) 'quoted text' 'quoted text'
+"$@" echo /usr/bin 'quoted text' printf /usr/bin ${HOME}
+	| --verbose /usr/bin "$@" echo "$@" /usr/bin --verbose
+${HOME} cd export printf local printf "$@"
+		--verbose cd x=1 echo then awk | grep /usr/bin
+	printf --verbose --verbose && --verbose export "$1" --verbose
+	export && grep readonly test grep
+| /usr/bin then 'quoted text' readonly | test
+	grep export local then | grep grep export
+		${HOME} echo export | ${HOME} awk local -eu "$@" "$@" x=1 ${HOME} x=1 --verbose
+		then $(pwd) awk x=1 --verbose echo printf then && sed then
+		--verbose echo then 2>/dev/null
+	2>/dev/null ${HOME} -eu done export 2>/dev/null "$1" readonly
+		cd --verbose then sed sed printf
+		--verbose && local echo export x=1
+2>/dev/null then $(pwd)
+local done local then && ${HOME} "$@" | "$1" 2>/dev/null
+awk | export /usr/bin 2>/dev/null | export x=1 test local printf -eu
+done | $(pwd) && grep
+		test then 2>/dev/null "$1" 'quoted text' &&
+	-eu /usr/bin printf test 'quoted text' /usr/bin
+	-eu then "$1" | readonly sed 'quoted text' done awk x=1 grep ${HOME} export export
+--verbose -eu echo $(pwd) "$@" $(pwd) | grep readonly x=1 readonly x=1 local
+	printf -eu then readonly "$@" 2>/dev/null
+&& local 'quoted text' printf echo readonly
+	cd ${HOME} printf | test export readonly
+	&& /usr/bin cd test 2>/dev/null echo then
+'quoted text' grep awk /usr/bin "$@" cd export 2>/dev/null done x=1 "$@" readonly
+		--verbose export "$@" ${HOME} 'quoted text' grep ${HOME} "$1" x=1 then
+grep && -eu awk local $(pwd) then /usr/bin
+	"$@" && local echo done && "$@" done
+		2>/dev/null cd "$@" test cd printf local | test done /usr/bin
+cd x=1 -eu && ${HOME} "$1" -eu sed done cd 'quoted text' sed
+--verbose test echo ${HOME} --verbose x=1
+	-eu -eu test export $(pwd)
+		-eu /usr/bin readonly 2>/dev/null awk
+		"$1" sed sed "$@" local "$1" sed readonly $(pwd) readonly grep export grep done
+2>/dev/null grep grep /usr/bin | readonly $(pwd) grep --verbose printf
+		local then cd 'quoted text' export cd done x=1 test 2>/dev/null
+"$@" -eu ${HOME} "$@" readonly awk done local echo export sed
+		sed "$1" printf 'quoted text'
+		$(pwd) $(pwd) "$@" then cd $(pwd) ${HOME} 2>/dev/null export then /usr/bin
+		cd grep 2>/dev/null --verbose
+	printf test printf --verbose cd "$@" "$@" | local -eu
+	local 2>/dev/null local done done done /usr/bin -eu awk readonly
+	sed cd local grep $(pwd) printf echo 2>/dev/null export -eu
+		awk -eu echo ${HOME} grep "$1" | readonly readonly
+		cd cd grep grep cd 'quoted text' ${HOME} awk
+sed done "$1" x=1 awk done done echo | local grep local
+then cd grep echo $(pwd) 2>/dev/null /usr/bin 2>/dev/null sed && readonly
+/usr/bin ${HOME} printf --verbose awk done 'quoted text' cd 2>/dev/null test
+		local -eu --verbose ${HOME} local export readonly "$@" test
+done && "$1" done | -eu awk 'quoted text'
+	grep /usr/bin readonly /usr/bin done | readonly /usr/bin
+		printf -eu && 'quoted text' sed
+	awk "$1" printf local echo export -eu 'quoted text'
+		export --verbose printf sed 2>/dev/null then
+	then 2>/dev/null then grep "$@" "$@" sed x=1 export sed
+--verbose local awk grep $(pwd) echo | sed then local printf /usr/bin
+	&& done x=1 | x=1 awk x=1 then /usr/bin x=1 test test 'quoted text' echo --verbose
+	-eu grep test ${HOME} 'quoted text'
+		test --verbose 2>/dev/null 'quoted text'
+		2>/dev/null && x=1 --verbose x=1 echo --verbose "$1"
+		test "$1" -eu x=1 then -eu 'quoted text' then $(pwd)
+awk grep 2>/dev/null test /usr/bin $(pwd) awk 'quoted text' x=1 then -eu then ${HOME}
+cd sed -eu echo && "$1" printf
+then readonly && 2>/dev/null "$@" x=1 cd x=1 done
+		| printf /usr/bin readonly awk | ${HOME} --verbose
+	2>/dev/null "$1" "$1" x=1 'quoted text'
+--verbose ${HOME} -eu done sed "$1" printf $(pwd) export echo cd local done 2>/dev/null
+	done readonly $(pwd) 2>/dev/null
+	&& then cd --verbose awk && "$1" cd x=1 && --verbose
+	test then | then "$1" then test grep "$1" && cd awk
+		2>/dev/null then export 2>/dev/null 'quoted text' grep grep && cd
+	-eu x=1 --verbose "$1" && "$@" "$1" awk grep test
+printf readonly then x=1 local | echo grep readonly $(pwd) x=1 cd echo --verbose
+		then readonly 'quoted text' x=1 awk cd
+&& awk echo --verbose ${HOME}
+		"$1" sed then "$1" printf awk awk grep then done
+		'quoted text' | && "$1" 2>/dev/null "$1"
+	x=1 -eu 'quoted text' test export readonly test done done export $(pwd)
+		echo $(pwd) $(pwd) echo /usr/bin "$@"
+	readonly awk readonly printf local 2>/dev/null x=1
+done "$1" local && export "$@" cd test "$@" readonly export
+awk /usr/bin "$@" $(pwd) 2>/dev/null 2>/dev/null /usr/bin x=1 then | ${HOME}
+	/usr/bin && printf "$1"
+	| && local --verbose done && --verbose ${HOME} && printf $(pwd) cd x=1 readonly
+cd ${HOME} 'quoted text' 2>/dev/null printf
+	&& 2>/dev/null "$@" "$1" printf local /usr/bin test "$1" readonly local
+	"$1" 2>/dev/null then "$1" cd then ${HOME} 'quoted text'
+	printf 'quoted text'
+| | "$1" printf "$@" sed 2>/dev/null sed awk -eu grep "$@" && readonly
+&& sed x=1 echo echo --verbose awk readonly -eu sed readonly
+	cd 2>/dev/null && /usr/bin readonly 'quoted text' grep readonly
+-eu && awk /usr/bin "$@" | printf sed "$1" "$@" $(pwd) export sed -eu
+'quoted text' local sed awk done done cd readonly local readonly
+-eu "$1" test && done local ${HOME} 2>/dev/null $(pwd) ${HOME} 2>/dev/null
+2>/dev/null "$@" 2>/dev/null grep --verbose
+${HOME} then test -eu 'quoted text' sed
+	export x=1 cd -eu echo 'quoted text' readonly test readonly -eu grep /usr/bin sed
+		/usr/bin echo | awk ${HOME} done 2>/dev/null $(pwd) test 2>/dev/null "$@"
+	/usr/bin ${HOME} printf /usr/bin --verbose "$@" printf | awk test
+${HOME} ${HOME} && printf && grep
+"$@" local ${HOME} test "$1" | 'quoted text' -eu -eu --verbose "$1"
+		--verbose ${HOME} /usr/bin echo && printf --verbose 'quoted text' | "$@"
+		then awk 2>/dev/null 2>/dev/null && echo done | $(pwd)
+	echo then /usr/bin sed x=1 awk test then local test --verbose | &&
+		then local readonly /usr/bin then "$@" --verbose printf then /usr/bin readonly
+		&& ${HOME} done 'quoted text'
+	done then x=1 echo then done then done "$@"
+	--verbose "$1" | grep printf x=1 $(pwd) x=1 'quoted text' then readonly 'quoted text'
+	"$1" awk ${HOME} 2>/dev/null grep
+		/usr/bin cd done grep then
+	echo grep /usr/bin then $(pwd) $(pwd) export grep echo x=1 done "$@" done
+&& export local && readonly x=1 local "$@" then test $(pwd) test readonly
+	'quoted text' export echo x=1 2>/dev/null then | printf sed
+	"$1" readonly done ${HOME} 'quoted text'
+	echo 2>/dev/null && readonly awk test "$@" grep "$@"
+echo "$1" $(pwd) && x=1 && x=1 && local --verbose
+		then -eu x=1 readonly awk echo printf ${HOME} "$@" awk $(pwd) 2>/dev/null
+	local --verbose 'quoted text' cd 'quoted text' grep "$1" 'quoted text'
+		| then && done "$1" && x=1 $(pwd) $(pwd) sed x=1 "$@" echo local
+		local | printf /usr/bin "$1" x=1
+	x=1 sed awk "$1" -eu readonly 'quoted text' readonly 2>/dev/null
+	local /usr/bin grep x=1 $(pwd) ${HOME}
+	sed export x=1 /usr/bin 'quoted text' "$1" | -eu
+		printf awk cd then 2>/dev/null
+		-eu 2>/dev/null $(pwd) sed -eu grep "$@" 2>/dev/null ${HOME} done
+awk -eu then --verbose 2>/dev/null
+		"$@" echo 'quoted text' "$@" echo --verbose ${HOME} "$@"
+awk cd test then && |
+	done echo test export "$@" /usr/bin cd local echo x=1 grep $(pwd) 2>/dev/null
+		test && -eu 'quoted text' 2>/dev/null | 'quoted text' then 'quoted text'
+${HOME} sed 'quoted text' 2>/dev/null -eu test "$@" echo then /usr/bin
+	export grep ${HOME} grep "$@" |
+sed /usr/bin | 2>/dev/null 'quoted text'
+	readonly printf && grep local sed "$1" done done && 'quoted text'
+		grep then cd awk $(pwd) awk
+		done && ${HOME} "$@" /usr/bin
+		"$@" "$@" "$1" $(pwd) printf && grep 'quoted text' printf ${HOME} export 2>/dev/null
+grep printf awk && readonly printf /usr/bin ${HOME}
+printf $(pwd) | export ${HOME} grep "$1" grep -eu "$@" /usr/bin $(pwd)
+readonly $(pwd) --verbose grep
+-eu "$@" awk readonly readonly ${HOME}
+cd then grep printf awk local 2>/dev/null awk readonly
+	sed -eu printf /usr/bin sed /usr/bin echo ${HOME} cd sed /usr/bin
+	done test sed | readonly $(pwd) awk | ${HOME} 'quoted text'
+	&& done "$1" /usr/bin sed readonly 2>/dev/null then 'quoted text' local
+	${HOME} ${HOME} printf
+-eu printf readonly awk |
+	export cd 2>/dev/null 2>/dev/null
+		x=1 grep test then printf test printf test --verbose -eu readonly
+		test 2>/dev/null | ${HOME} export export && grep 'quoted text'
+sed sed | cd then && then
+	export --verbose 2>/dev/null | sed && grep test ${HOME} "$1" echo then /usr/bin
+	x=1 then "$1" done export -eu cd --verbose && grep sed $(pwd) /usr/bin "$1"
+$(pwd) -eu sed 2>/dev/null | 2>/dev/null
+		grep $(pwd) ${HOME} x=1 sed ${HOME}
+		2>/dev/null readonly x=1 | export $(pwd) cd && grep "$@" ${HOME} x=1 printf
+		/usr/bin awk then "$1" | $(pwd) 2>/dev/null x=1 | --verbose 'quoted text'
+printf test awk "$1" "$1" then readonly awk cd ${HOME} ${HOME}
+export /usr/bin readonly | printf /usr/bin --verbose 'quoted text'
+	cd then test 'quoted text' readonly x=1 ${HOME} printf done done --verbose
+&& ${HOME} "$@" -eu readonly then grep "$@" done awk export "$1"
+	x=1 "$1" "$@" --verbose --verbose | printf echo
+		local -eu | $(pwd) $(pwd) $(pwd) readonly
+		-eu /usr/bin then "$@" then &&
+"$1" $(pwd) then "$1" echo sed "$1" local test done readonly
+2>/dev/null $(pwd) cd -eu "$@" local -eu
+	&& ${HOME} test && $(pwd) readonly
+		readonly readonly readonly 2>/dev/null && cd test /usr/bin
+2>/dev/null cd 'quoted text' awk "$1" done | cd awk
+	awk "$1" | export 'quoted text' echo readonly then test /usr/bin
+		&& then test 'quoted text' sed test test --verbose grep -eu sed awk readonly
+	${HOME} x=1 export awk x=1 local 2>/dev/null 2>/dev/null echo 'quoted text'
+		'quoted text' "$@" -eu $(pwd)
+then readonly test printf /usr/bin echo $(pwd) grep printf "$@" x=1 "$@"
+		local | then local done 'quoted text' sed /usr/bin -eu $(pwd) sed ${HOME}
+	grep /usr/bin done --verbose then export 'quoted text' | --verbose local
+	readonly local ${HOME} x=1 printf
+		/usr/bin then export awk grep ${HOME} --verbose readonly echo $(pwd) ${HOME}
+		test 'quoted text' ${HOME} /usr/bin -eu ${HOME} readonly
+$(pwd) x=1 $(pwd) "$1" echo
+		${HOME} x=1 ${HOME} cd local
+		$(pwd) test test done ${HOME} --verbose 2>/dev/null awk local "$@"
+	printf "$1" readonly "$@" done ${HOME} then $(pwd) grep awk --verbose test
+	$(pwd) printf 2>/dev/null then $(pwd) echo "$@" local test x=1 export done printf
+printf "$@" | --verbose "$@" /usr/bin test printf
+	local -eu /usr/bin echo 'quoted text' 2>/dev/null printf readonly 2>/dev/null
+		--verbose $(pwd) "$@" sed grep readonly "$1" 'quoted text' test
+awk /usr/bin cd x=1 "$1" | test test done awk x=1 --verbose
+	sed 2>/dev/null sed --verbose 2>/dev/null then /usr/bin
+	| "$1" local local awk grep export cd "$1" && /usr/bin then echo awk
+-eu /usr/bin local printf
+	2>/dev/null | sed done ${HOME} done && && awk /usr/bin x=1 local done -eu
+		--verbose "$1" readonly ${HOME} awk "$@" --verbose echo x=1 test sed | echo
+${HOME} cd x=1 cd -eu test ${HOME} 'quoted text'
+&& | cd then grep local
+	printf test 2>/dev/null x=1 -eu then 2>/dev/null /usr/bin && 'quoted text'
+/usr/bin export | && echo && ${HOME} /usr/bin | grep printf x=1 then
+		export grep "$1" $(pwd) "$1" then
+		printf test done ${HOME} done ${HOME} done sed --verbose | && 'quoted text'
+readonly --verbose ${HOME} echo done export
+printf $(pwd) export printf done awk 'quoted text'
+done ${HOME} && done done then export printf export 2>/dev/null
+		cd "$@" then readonly 'quoted text' readonly "$@" /usr/bin
+		sed test awk --verbose sed test readonly $(pwd) readonly local awk
+	export "$@" echo cd /usr/bin
+	sed done sed /usr/bin echo 'quoted text'
+	cd echo cd $(pwd) sed printf
+grep printf export 'quoted text' | cd ${HOME}
+"$1" then echo "$1" cd | -eu sed then "$@" ${HOME} 'quoted text' /usr/bin
+		export test printf --verbose 2>/dev/null awk |
+readonly "$@" readonly 2>/dev/null 2>/dev/null ${HOME} && x=1 readonly printf
+	grep grep cd local grep local awk cd then --verbose $(pwd) 2>/dev/null
+	&& "$1" export awk 2>/dev/null | /usr/bin then echo
+	"$@" local 'quoted text' printf sed test | grep export "$@" echo readonly
+export cd local && export printf x=1 $(pwd) grep -eu -eu 'quoted text' awk readonly
+${HOME} readonly --verbose --verbose --verbose
+		| "$1" "$1" x=1 local echo ${HOME} readonly
+		2>/dev/null $(pwd) $(pwd)
+export then cd --verbose sed "$1" done 2>/dev/null && then x=1 local
+	echo grep 'quoted text' export readonly $(pwd) ${HOME} /usr/bin "$@" "$1" $(pwd)
+		2>/dev/null printf 2>/dev/null
+	grep readonly readonly cd ${HOME} awk && readonly echo
+| readonly x=1 readonly grep
+		grep "$1" grep test "$@" export x=1 'quoted text' printf printf cd 'quoted text'
+		printf "$1" echo $(pwd) export $(pwd) && 'quoted text' ${HOME}
+		printf "$@" $(pwd) local
+readonly readonly 2>/dev/null && echo
+		test done export local /usr/bin && --verbose "$1" awk -eu && && "$@" |
+	local cd 2>/dev/null readonly
+		"$1" "$1" then readonly "$@" cd
+	x=1 -eu --verbose "$@" awk | "$@" export && done readonly
+"$@" ${HOME} cd 2>/dev/null 'quoted text' /usr/bin
+&& 2>/dev/null x=1 done readonly done echo printf -eu grep local ${HOME} grep local
+local awk 2>/dev/null local
+		| then -eu ${HOME} then | echo grep readonly /usr/bin sed "$1"
+	$(pwd) --verbose printf 2>/dev/null printf 2>/dev/null
+	sed ${HOME} "$1" && grep awk /usr/bin x=1 done "$@" ${HOME} done x=1 --verbose
+done awk printf /usr/bin test echo 2>/dev/null ${HOME} -eu $(pwd)
+		grep "$@" && sed grep echo done cd /usr/bin 'quoted text' $(pwd)
+x=1 x=1 readonly sed printf
+-eu test "$1" && "$@" test export ${HOME} sed done
+	then "$@" echo test -eu "$1" /usr/bin "$1" echo local local "$1" local "$@" x=1
+	&& printf && printf $(pwd) && printf --verbose
+	$(pwd) x=1 x=1 export cd 'quoted text' "$@" printf
+then x=1 echo -eu readonly "$1" echo /usr/bin
+done "$1" test then "$1" $(pwd)
+	echo grep grep $(pwd) "$1" readonly
+2>/dev/null cd --verbose x=1 export grep
+	readonly ${HOME} echo $(pwd) done readonly
+| echo cd -eu export | printf && 'quoted text' -eu 'quoted text' "$@"
+	"$1" cd cd && cd "$1" $(pwd) ${HOME} done readonly test
+	/usr/bin readonly && grep x=1 readonly done export "$@" "$1" "$@" done printf
+$(pwd) printf 'quoted text' local && -eu sed /usr/bin
+		cd 'quoted text' -eu -eu | "$1" done &&
+	done grep cd cd export then -eu --verbose | readonly | grep | grep printf "$1"
+	--verbose local "$@" export "$1" export --verbose done export x=1 cd
+		"$@" "$@" /usr/bin ${HOME} -eu --verbose sed "$@"
+		2>/dev/null done -eu -eu | && awk
+"$1" 2>/dev/null sed echo then 'quoted text' -eu export
+'quoted text' readonly 2>/dev/null local printf
+	done "$@" test echo cd -eu echo readonly awk
+	2>/dev/null "$@" "$1" local x=1 --verbose grep printf cd | cd local local
+	export | echo 2>/dev/null readonly then
+sed test then --verbose | --verbose grep export
+grep x=1 2>/dev/null sed -eu then 2>/dev/null | --verbose --verbose
+		sed -eu awk 'quoted text' x=1 'quoted text' "$@"
+		printf | export ${HOME} "$@" local readonly "$@" local grep ${HOME}
+		done 2>/dev/null then x=1 2>/dev/null printf
+		export printf grep test local cd sed && x=1 "$1" 2>/dev/null
+	x=1 export local test readonly export ${HOME} sed cd cd echo echo
+		awk export cd 'quoted text' local x=1 | 2>/dev/null
+	echo sed /usr/bin && export 'quoted text' -eu done -eu
+	test 2>/dev/null printf --verbose
+2>/dev/null && cd -eu test ${HOME} sed then $(pwd) ${HOME}
+	printf readonly cd x=1 done -eu 2>/dev/null done then printf -eu grep
+		2>/dev/null "$1" ${HOME} && 'quoted text' readonly 'quoted text'
+	cd x=1 'quoted text' echo | 2>/dev/null done export cd grep $(pwd)
+		echo "$1" test local test "$@" awk "$@" test "$@" x=1 done local export done
+local "$1" done /usr/bin echo
+cd /usr/bin --verbose grep awk echo done x=1 /usr/bin grep 2>/dev/null
+printf grep cd 2>/dev/null 'quoted text' 2>/dev/null
+		then --verbose awk test awk | local
+export 'quoted text' done ${HOME} echo /usr/bin && echo | readonly
+		awk /usr/bin sed sed sed /usr/bin && done
+		'quoted text' readonly 'quoted text' $(pwd)
+		test grep $(pwd) awk awk cd
+cd echo done 'quoted text'
+	then export "$1" cd 2>/dev/null | --verbose done && then $(pwd) -eu && grep
+/usr/bin awk x=1 "$1" printf cd cd "$@" ${HOME} test -eu export "$@" ${HOME} |
+"$@" readonly -eu /usr/bin awk "$@" 'quoted text' echo done x=1
+		local done "$@" x=1 && 'quoted text' -eu 'quoted text' "$@" /usr/bin | $(pwd) $(pwd)
+		sed $(pwd) awk local export readonly ${HOME} $(pwd) grep
+		"$1" -eu printf x=1 'quoted text' ${HOME}
+		readonly ${HOME} export | "$@" awk grep export sed "$1" 'quoted text'
+		&& 'quoted text' printf && x=1 /usr/bin &&
+		local then "$@" | 'quoted text' --verbose $(pwd) test "$@" -eu 2>/dev/null
+		&& ${HOME} done done cd
+${HOME} x=1 $(pwd) "$1" "$@" "$@"
+"$1" printf export x=1 echo $(pwd) done x=1 then export -eu x=1 $(pwd)
+	local x=1 test "$1" ${HOME} done &&
+	/usr/bin "$1" && test /usr/bin ${HOME} awk local | grep "$1" export "$1"
+	"$1" /usr/bin --verbose
+		x=1 done awk 'quoted text' 'quoted text' export 2>/dev/null
+cd "$@" /usr/bin x=1 /usr/bin $(pwd) x=1 test
+	test grep test x=1 /usr/bin local | && -eu echo export
+cd --verbose 2>/dev/null 2>/dev/null export
+	2>/dev/null sed && grep
+	"$1" sed export sed sed --verbose awk test then
+	done 'quoted text' "$@" -eu awk
+echo done "$1" awk $(pwd) echo 2>/dev/null /usr/bin local grep 'quoted text' --verbose
+		-eu /usr/bin cd && -eu --verbose sed 2>/dev/null
+	--verbose -eu grep ${HOME} local x=1 2>/dev/null && x=1 x=1 "$@" x=1
+"$1" grep export sed test && ${HOME} --verbose
+	cd "$@" awk -eu readonly "$1" then -eu "$1" local done "$@" && "$1" &&
+	"$@" x=1 grep 2>/dev/null 'quoted text' x=1 ${HOME} grep
+		sed awk && export readonly echo local && | awk readonly
+		done && x=1 export export then local /usr/bin && "$@"
+| local sed | test 'quoted text'
+x=1 test "$1" -eu /usr/bin printf "$1"
+	cd && echo --verbose /usr/bin x=1 export export 2>/dev/null readonly test --verbose
+	--verbose done local | grep test 'quoted text' && test
+		grep ${HOME} export ${HOME} "$1" 2>/dev/null readonly local "$@"
+&& cd -eu printf sed | export
+		readonly readonly -eu | sed test $(pwd) awk done then sed printf export | then
+test x=1 readonly test "$@" x=1 /usr/bin done -eu -eu $(pwd) ${HOME}
+grep export echo echo 'quoted text' && test
+	x=1 "$@" "$@" echo && && $(pwd) 2>/dev/null awk readonly 2>/dev/null readonly
+$(pwd) echo awk 'quoted text'
+	-eu export export -eu /usr/bin local "$1" readonly "$1"
+		readonly cd cd readonly awk echo "$@" cd printf export x=1 printf
+sed printf /usr/bin -eu sed -eu grep
+grep awk 'quoted text' -eu local done "$@" test cd export
+	done | 'quoted text' awk then && printf
+		awk --verbose | 2>/dev/null awk "$@"
+		$(pwd) then cd 'quoted text' test 2>/dev/null awk && done 'quoted text'
+		printf | echo echo local then /usr/bin grep | && printf 'quoted text'
+	x=1 done "$1" local -eu | done "$1"
+	export printf local done $(pwd) echo
+	${HOME} export done x=1
+printf grep 'quoted text' 2>/dev/null done awk x=1 export
+	x=1 then | x=1 | $(pwd) ${HOME} x=1 /usr/bin export grep -eu
+awk local done | ${HOME} sed x=1 printf 2>/dev/null
+		local 2>/dev/null --verbose test x=1 -eu -eu local test && done local --verbose
+printf "$@" -eu 'quoted text' && "$@" printf | printf printf
+readonly /usr/bin && --verbose export /usr/bin "$@" && "$1" 'quoted text'
+		done export && then /usr/bin
+		$(pwd) test --verbose cd --verbose "$1" $(pwd) x=1 /usr/bin "$1" -eu
+local 2>/dev/null "$1" --verbose "$@" cd readonly
+export ${HOME} test x=1 2>/dev/null
+		then $(pwd) cd /usr/bin echo -eu awk ${HOME}
+local printf | readonly readonly --verbose cd $(pwd)
+	sed -eu x=1 grep 'quoted text' | printf /usr/bin $(pwd) printf 2>/dev/null
+		/usr/bin | then -eu | -eu readonly
+		then ${HOME} 'quoted text' 'quoted text' echo echo sed 2>/dev/null
+x=1 --verbose /usr/bin | /usr/bin local 2>/dev/null 2>/dev/null
+		&& awk readonly -eu "$@" sed ${HOME}
+		--verbose && 'quoted text' 'quoted text' export /usr/bin --verbose
+	x=1 -eu x=1 -eu x=1 echo done
+		&& readonly sed done sed -eu printf awk printf 'quoted text' -eu
+	| "$@" readonly 2>/dev/null readonly readonly
+then | | printf $(pwd) x=1 ${HOME}
+	then x=1 "$1" 'quoted text' export 2>/dev/null $(pwd) awk "$@" export && "$1"
+"$@" | export export test test printf ${HOME} | export done /usr/bin x=1
+	then sed 'quoted text' "$1" x=1 -eu cd readonly then 'quoted text'
+&& $(pwd) /usr/bin $(pwd) then test done
+		awk "$@" awk then ${HOME} $(pwd) 2>/dev/null -eu awk | 2>/dev/null -eu x=1 test
+	-eu $(pwd) x=1 test --verbose
+	readonly test "$@" -eu "$@" then "$@" grep export
+		done --verbose test export echo --verbose cd test cd && local sed -eu
+	export /usr/bin "$@" grep printf grep echo 'quoted text' printf printf 2>/dev/null
+		${HOME} done grep -eu ${HOME} "$1" done x=1 -eu sed 2>/dev/null "$@" $(pwd) echo
+local /usr/bin ${HOME} /usr/bin cd /usr/bin
+		/usr/bin x=1 grep readonly -eu "$@" |
+sed -eu && $(pwd) then local "$@" | test -eu
+	test grep --verbose 2>/dev/null ${HOME} done done "$1"
+		-eu x=1 sed then 2>/dev/null /usr/bin --verbose printf done | then x=1 -eu
+		| local $(pwd) "$@" export x=1
+/usr/bin x=1 "$1" then
+readonly | $(pwd) awk readonly cd test "$1" done local
+export cd readonly then 'quoted text' "$@" sed printf
+	x=1 test --verbose done test awk x=1 export
+${HOME} local awk 'quoted text'
+local readonly | echo --verbose 'quoted text' printf test test "$1" x=1 then printf
+		$(pwd) $(pwd) ${HOME} cd grep
+local printf "$@" test 'quoted text' "$1" export 'quoted text'
+	export -eu cd export "$1" ${HOME} done readonly "$@"
+#include c217.sh
+grep local -eu 'quoted text' printf grep export test awk && then
+	done local test printf printf "$1" -eu printf readonly export x=1 &&
+		x=1 -eu local 2>/dev/null | local | sed $(pwd) --verbose export export
+		${HOME} export printf local "$1" && grep done $(pwd)
+awk $(pwd) "$1" printf export
+x=1 local --verbose ${HOME} cd done then
+grep | -eu sed "$@" "$@" -eu grep done echo "$@" ${HOME}
+	x=1 local local | && readonly --verbose local then "$@" readonly
+	'quoted text' printf readonly then $(pwd) test then "$1"
+-eu echo done 'quoted text' sed | -eu "$1" local "$1" cd readonly ${HOME} x=1 sed
+	"$1" /usr/bin sed 'quoted text'
+2>/dev/null 2>/dev/null ${HOME} | test readonly export cd sed then grep
+	| $(pwd) ${HOME} && | /usr/bin readonly local then "$@" /usr/bin echo ${HOME}
+		printf done -eu printf --verbose
+	"$@" "$@" --verbose 2>/dev/null printf -eu done && 2>/dev/null
+	export && test /usr/bin awk $(pwd) printf cd "$@" $(pwd) printf | $(pwd)
+'quoted text' awk | "$@" --verbose && cd then grep done $(pwd)
+$(pwd) cd && sed done printf -eu cd printf 'quoted text'
+"$1" | x=1 2>/dev/null 'quoted text' /usr/bin cd "$1" then sed x=1 && 'quoted text'
+done test sed $(pwd) then
+sed export $(pwd) echo local x=1 then sed
+		'quoted text' cd printf then ${HOME} export grep then cd 2>/dev/null
+$(pwd) echo printf ${HOME} awk $(pwd) "$@" "$1" done | 'quoted text' readonly
+--verbose $(pwd) -eu printf "$1" awk "$1"
+&& -eu "$@" && awk sed
+		done done printf && grep readonly local local then
+		export x=1 export grep export printf sed "$@" x=1
+		echo then awk test done && $(pwd)
+	"$@" sed grep && cd test local sed 'quoted text' $(pwd) grep -eu ${HOME} $(pwd)
+	grep $(pwd) $(pwd) /usr/bin then echo /usr/bin
+		&& | "$1" $(pwd) cd | test 'quoted text' awk awk 2>/dev/null echo
+$(pwd) then "$1" local readonly awk | done -eu && ${HOME} cd 2>/dev/null
+		"$@" cd then --verbose
+		/usr/bin grep grep "$1" "$@" "$1" awk ${HOME} sed
+	then awk awk && "$1" 'quoted text'
+printf readonly && readonly
+x=1 /usr/bin $(pwd) grep test && ${HOME} /usr/bin then $(pwd) x=1 'quoted text'
+		$(pwd) test test "$@" ${HOME} 'quoted text' "$@" | -eu sed --verbose --verbose
+	"$1" done cd readonly then |
+	| "$@" 2>/dev/null "$@" ${HOME} local cd ${HOME}
+		export | export grep -eu ${HOME} sed
+	printf then awk printf 2>/dev/null grep --verbose --verbose 2>/dev/null
+	done export sed export "$1" --verbose | grep export -eu 2>/dev/null
+	echo cd cd done x=1 /usr/bin 2>/dev/null
+		local "$1" "$@" sed sed printf ${HOME} echo
+	"$@" "$@" 2>/dev/null "$1" /usr/bin 2>/dev/null --verbose --verbose cd done
+		/usr/bin awk /usr/bin -eu grep --verbose echo /usr/bin
+		awk --verbose 'quoted text'
+	${HOME} ${HOME} awk 'quoted text' | -eu test /usr/bin | && export "$1"
+		--verbose x=1 | sed "$@" printf
+		'quoted text' test grep echo -eu grep local done 2>/dev/null done
+		cd sed | awk echo 'quoted text' then export --verbose awk local | | x=1 echo
+grep cd "$@" | then && done echo
+	awk then awk grep awk -eu echo ${HOME} then cd && "$@" then sed ${HOME}
+	| done sed done done -eu x=1 'quoted text' 'quoted text' /usr/bin then 'quoted text'
+	'quoted text' printf local 'quoted text' done ${HOME}
+		x=1 "$1" then export "$1" export
+		cd sed sed --verbose done printf 2>/dev/null
+	--verbose test then x=1 cd sed 'quoted text' "$1" -eu readonly
+	awk && done grep | | done x=1 "$@"
+	printf printf $(pwd) sed $(pwd) | cd &&
+2>/dev/null test "$1" -eu test && "$@" 'quoted text' "$1" /usr/bin cd "$@" "$1"
+		printf ${HOME} grep && "$@" cd
+--verbose /usr/bin echo cd
+	readonly then then && test /usr/bin | grep 2>/dev/null
+		--verbose 2>/dev/null awk awk
+		'quoted text' ${HOME} ${HOME} 2>/dev/null 2>/dev/null -eu printf then
+	"$@" 2>/dev/null | x=1 /usr/bin readonly 2>/dev/null printf
+	"$1" export local ${HOME} echo "$1" done local
+		'quoted text' x=1 cd "$@" ${HOME} | "$1" printf sed echo grep
+	${HOME} --verbose $(pwd) grep sed 'quoted text' awk cd --verbose
+readonly ${HOME} local cd cd && $(pwd) "$@" then printf
+		export -eu echo readonly "$1" done local export cd 2>/dev/null test then |
+	| then echo && && local local |
+echo $(pwd) ${HOME} grep sed local
+		export export "$@" && $(pwd) "$1" x=1 -eu grep done "$1" "$@" printf awk --verbose
+		export x=1 export 2>/dev/null --verbose x=1 local --verbose
+	/usr/bin "$@" 2>/dev/null "$1" cd | --verbose
+	"$@" --verbose -eu "$@" readonly 2>/dev/null && readonly
+	$(pwd) cd /usr/bin echo done | readonly
+	| "$1" && ${HOME} x=1 awk --verbose
+	-eu "$@" export ${HOME} done && grep -eu test x=1 readonly /usr/bin export
+		readonly /usr/bin | sed cd sed -eu done done printf sed --verbose -eu $(pwd)
+	x=1 grep readonly && export -eu echo 2>/dev/null local grep local
+	then awk awk cd x=1 x=1 export export
+x=1 then $(pwd) /usr/bin readonly sed echo -eu local 2>/dev/null
+		cd grep | then 'quoted text'
+		printf export | done done -eu echo then export done "$1" 'quoted text' $(pwd)
+	"$@" echo 2>/dev/null ${HOME}
+		${HOME} 2>/dev/null --verbose sed
+	"$1" done then test done grep cd 2>/dev/null --verbose awk | x=1
+/usr/bin sed local readonly test grep 'quoted text' sed
+		"$@" printf test cd 'quoted text' done export
+test echo echo --verbose /usr/bin "$1" "$1"
+		cd x=1 $(pwd) test echo local export /usr/bin | "$@"
+		/usr/bin 2>/dev/null 'quoted text' test awk --verbose
+	| cd && sed done then readonly && "$1" 'quoted text' readonly x=1 | && export
+		local awk export 'quoted text' x=1 -eu | then /usr/bin
+echo -eu test --verbose ${HOME} echo echo awk "$1"
+"$1" then done ${HOME} ${HOME}
+	--verbose echo "$@" cd readonly ${HOME} export sed 2>/dev/null
+	echo 2>/dev/null 'quoted text' -eu /usr/bin 'quoted text' "$@" &&
+		awk cd "$1" echo grep --verbose --verbose then then 'quoted text'
+		done echo sed grep --verbose
+then sed then then test readonly /usr/bin
+		&& sed $(pwd) /usr/bin readonly ${HOME} awk --verbose readonly
+&& /usr/bin readonly grep test x=1 export local 'quoted text' test cd sed
+		echo done printf | /usr/bin cd /usr/bin awk x=1 readonly && awk 2>/dev/null
+'quoted text' local | /usr/bin
+		test readonly readonly then done sed $(pwd) awk echo
+readonly echo 'quoted text' "$@" "$1" done --verbose local local && export
+/usr/bin then ${HOME} -eu cd then
+	cd grep awk x=1 $(pwd) --verbose
+test awk awk export echo
+done test && readonly test sed "$1" printf cd cd ${HOME} 'quoted text'
+	then $(pwd) x=1 cd "$1" "$@" 2>/dev/null sed sed --verbose /usr/bin && | ${HOME}
+		local && x=1 'quoted text' sed -eu ${HOME}
+/usr/bin -eu test ${HOME} awk 'quoted text' "$@" -eu x=1 sed readonly
+	cd printf grep done cd "$1" 'quoted text' test then /usr/bin
+then ${HOME} ${HOME} ${HOME} /usr/bin grep x=1
+		/usr/bin /usr/bin 'quoted text' echo --verbose
+		done ${HOME} printf readonly "$@" "$@"
+		'quoted text' local cd test local cd "$@" x=1 | ${HOME} test && echo && done
+		grep $(pwd) -eu cd ${HOME} grep && cd x=1 $(pwd) echo
+	grep test $(pwd) "$1" sed export
+done then readonly && && export done ${HOME} local -eu &&
+		export "$1" x=1 /usr/bin export echo $(pwd) sed test done cd 'quoted text'
+&& readonly 2>/dev/null readonly done ${HOME} /usr/bin
+&& && --verbose test "$1" echo then sed sed cd x=1 /usr/bin local local 'quoted text'
+	$(pwd) x=1 -eu "$1" done then done 2>/dev/null test x=1
+		echo then $(pwd) | export sed | local && sed | printf export
+	"$1" $(pwd) && 'quoted text' local
+export awk awk printf local local local | awk --verbose
+	echo 2>/dev/null -eu
+"$1" 'quoted text' echo test ${HOME} readonly -eu echo awk --verbose printf
+&& && done --verbose grep
+	"$@" echo readonly ${HOME} 'quoted text'
+	grep test done | readonly && $(pwd) done awk cd "$1" ${HOME}
+		then 'quoted text' /usr/bin cd 2>/dev/null
+		test echo | export readonly awk && awk | 2>/dev/null printf local done
+		local readonly test --verbose 2>/dev/null awk -eu /usr/bin done
+printf readonly $(pwd) awk /usr/bin
+test grep 2>/dev/null 'quoted text'
+	grep grep | readonly x=1 echo $(pwd)
+test ${HOME} test awk -eu ${HOME} then awk --verbose 2>/dev/null test && export
+		readonly "$1" "$@" "$@" echo /usr/bin grep /usr/bin readonly readonly
+	${HOME} && ${HOME} 2>/dev/null local export
+	awk ${HOME} -eu local done echo -eu awk "$1" | printf "$@" test grep then 'quoted text'
+		readonly 'quoted text' | then awk test $(pwd) local && x=1 -eu "$@" sed
+		-eu export "$1" cd --verbose
+		sed | grep "$1" local "$@" printf
+awk awk | local x=1 'quoted text' echo local $(pwd) --verbose && --verbose "$@"
+		$(pwd) "$@" echo | "$@" export $(pwd) && $(pwd)
+x=1 --verbose "$1" /usr/bin test grep done grep cd -eu | --verbose
+grep x=1 cd && done readonly "$1" /usr/bin local grep -eu
+	| --verbose /usr/bin cd cd 'quoted text'
+-eu && "$@" readonly $(pwd) printf
+		${HOME} test sed -eu --verbose done x=1
+	--verbose && test 'quoted text' /usr/bin x=1 | -eu | readonly sed grep
+	'quoted text' readonly --verbose cd "$@" $(pwd) then done then then done
+'quoted text' export | export ${HOME} cd
+	cd awk && local export && grep local -eu cd "$1" awk readonly x=1
+"$@" then x=1 done | export $(pwd) printf
+	printf /usr/bin "$1" export | $(pwd) "$1" /usr/bin 2>/dev/null
+		"$1" export "$1" local x=1 $(pwd) --verbose -eu sed && "$@" --verbose --verbose
+		-eu sed --verbose && test echo
+		2>/dev/null | --verbose then local cd | export readonly 'quoted text' test sed
+	printf then && "$@" "$@" readonly $(pwd) cd
+	"$@" 'quoted text' then $(pwd) && && "$1" export "$@" --verbose ${HOME} /usr/bin
+		"$1" 'quoted text' printf --verbose printf cd
+export 'quoted text' x=1 cd "$1" echo ${HOME} -eu --verbose sed $(pwd)
+		echo "$@" | | && | then 'quoted text'
+		&& ${HOME} x=1 done && | && /usr/bin readonly grep echo grep readonly local
+x=1 $(pwd) /usr/bin /usr/bin awk $(pwd) done "$1" -eu | readonly
+	cd cd test echo "$@" readonly readonly $(pwd) x=1 && x=1
+	printf $(pwd) readonly --verbose 'quoted text' ${HOME} test -eu
+		| --verbose 2>/dev/null x=1 export
+		grep then x=1 'quoted text' cd && printf printf
+		2>/dev/null local /usr/bin -eu local export local then
+-eu "$1" x=1 then $(pwd) sed
+		export export export && 2>/dev/null
+x=1 "$1" cd done export
+		done done local then -eu test /usr/bin export --verbose ${HOME}
+	--verbose /usr/bin "$1" sed && cd /usr/bin
+		local | readonly then grep echo then /usr/bin local
+	${HOME} "$1" "$@" ${HOME} && --verbose && then
+| && awk $(pwd) "$1" printf cd grep
+	then local x=1 ${HOME} test -eu
+		'quoted text' local cd | ${HOME} | cd "$@" x=1 'quoted text' awk
+"$1" -eu 'quoted text' /usr/bin
+cd 'quoted text' /usr/bin test grep -eu test 2>/dev/null sed --verbose
+	export then then test --verbose local
+--verbose -eu done | && done | local
+		$(pwd) local x=1 | awk $(pwd) --verbose
+echo printf then done "$@" test sed printf export
+test export | "$@" export sed x=1 sed then
+${HOME} -eu local ${HOME} cd -eu then 'quoted text' "$1"
+		readonly readonly ${HOME} cd -eu export local "$@" 2>/dev/null /usr/bin
+	&& $(pwd) | done $(pwd) --verbose && printf echo then && sed grep readonly
+readonly local 'quoted text' /usr/bin
+	test awk echo test cd ${HOME} done grep | 2>/dev/null
+		$(pwd) 2>/dev/null 'quoted text' done -eu /usr/bin test x=1 2>/dev/null readonly
+		"$1" /usr/bin test grep grep x=1
+then "$1" && export cd "$1" -eu "$1" "$1" grep /usr/bin
+$(pwd) 'quoted text' 'quoted text' cd test readonly | && --verbose local export
+&& && "$1" --verbose then
+		2>/dev/null && then awk printf
+		"$1" then echo 'quoted text'
+$(pwd) printf readonly local grep printf 2>/dev/null --verbose && export
+${HOME} cd ${HOME} then export readonly echo "$@"
+'quoted text' "$@" x=1 /usr/bin readonly
+	"$1" $(pwd) "$1" --verbose /usr/bin ${HOME} then |
+		local done -eu "$1" | readonly local cd 'quoted text' then export
+--verbose "$@" && --verbose awk "$@" $(pwd) /usr/bin 'quoted text'
+"$1" readonly $(pwd) "$@" test /usr/bin then x=1 x=1 local ${HOME} 2>/dev/null
+local cd --verbose awk
+	sed 'quoted text' | export grep
+	test sed test cd && 2>/dev/null "$@"
+		| ${HOME} -eu -eu && 'quoted text' export sed grep test local
+		2>/dev/null && done local readonly cd /usr/bin ${HOME} sed "$1" export
+$(pwd) readonly grep export $(pwd) sed printf $(pwd) done test && "$@" |
+		$(pwd) ${HOME} $(pwd) export && grep /usr/bin ${HOME} 2>/dev/null
+&& test x=1 | readonly 'quoted text'
+	sed x=1 then grep readonly local readonly /usr/bin printf local ${HOME} -eu
+		"$@" printf /usr/bin --verbose printf local -eu test grep grep $(pwd) echo sed
+		2>/dev/null done echo 2>/dev/null /usr/bin test sed 2>/dev/null $(pwd) && test
+sed $(pwd) /usr/bin grep awk then readonly echo printf
+		printf 2>/dev/null cd -eu
+${HOME} "$1" && "$@" 'quoted text'
+	test local awk export | && printf done "$@" $(pwd) cd
+		2>/dev/null 2>/dev/null 'quoted text' cd ${HOME} done ${HOME}
+		"$1" test done export -eu export
+	/usr/bin --verbose then awk | "$@" x=1 then
+&& "$1" $(pwd) | grep sed grep
+-eu readonly -eu --verbose awk ${HOME}
+	then /usr/bin --verbose 'quoted text' "$1" --verbose ${HOME} $(pwd)
+2>/dev/null readonly --verbose ${HOME} local sed "$@"
+	${HOME} && readonly | && "$@" 2>/dev/null readonly awk echo readonly
+		awk ${HOME} "$1" sed done -eu local --verbose $(pwd) done 2>/dev/null
+		sed && "$@" -eu done /usr/bin awk readonly -eu ${HOME} && -eu echo
+		'quoted text' cd && then 2>/dev/null
+		/usr/bin readonly $(pwd) 'quoted text'
+${HOME} --verbose 2>/dev/null 2>/dev/null 2>/dev/null sed
+	x=1 "$@" readonly readonly "$1" cd -eu | $(pwd) echo --verbose
+echo done then "$1" grep local export -eu readonly -eu
+		/usr/bin "$@" && grep printf sed printf awk grep local && -eu
+echo awk 'quoted text' grep
+echo grep printf sed 2>/dev/null sed "$@"
+	grep cd echo then readonly
+grep then then ${HOME} echo 2>/dev/null
+		x=1 ${HOME} "$1" "$@" test x=1 printf readonly test readonly sed "$@" x=1 cd
+export awk --verbose x=1 ${HOME}
+		cd local | cd 2>/dev/null export
+then $(pwd) readonly export 'quoted text'
+	readonly done 'quoted text' test
+	done echo grep 'quoted text' $(pwd) --verbose
+	"$1" --verbose --verbose x=1
+$(pwd) "$1" local then echo printf then "$@" cd test "$@" /usr/bin
+-eu $(pwd) readonly export ${HOME} readonly | /usr/bin awk /usr/bin cd ${HOME}
+	test $(pwd) grep awk printf sed "$@" /usr/bin --verbose "$1" local cd
+'quoted text' 'quoted text' echo
+	test printf then local $(pwd) done grep grep awk "$@" export 'quoted text'
+		$(pwd) "$@" cd /usr/bin then export
+grep echo awk local &&
+sed cd 'quoted text' awk && local test done
+	done then done grep readonly
+"$1" "$1" ${HOME} sed "$@" ${HOME} export readonly -eu sed sed 2>/dev/null test
+${HOME} --verbose 2>/dev/null readonly test awk "$1" then
+		&& | echo -eu --verbose awk sed test "$1" test
+		/usr/bin test export -eu sed readonly --verbose x=1 ${HOME} echo /usr/bin "$@"
+	then then sed /usr/bin $(pwd)
+		echo $(pwd) local local sed $(pwd) test
+		"$1" awk done && local -eu then "$@" awk cd then sed then printf
+2>/dev/null sed | then export printf ${HOME} ${HOME}
+2>/dev/null "$@" export readonly cd 'quoted text' awk done
+	/usr/bin $(pwd) echo --verbose
+		"$@" --verbose export 'quoted text' test echo $(pwd) export
+	cd /usr/bin "$@" printf done then printf awk && "$1" ${HOME}
+	x=1 sed /usr/bin local /usr/bin cd && 2>/dev/null ${HOME} done
+2>/dev/null x=1 echo printf
+/usr/bin "$1" export && /usr/bin | awk && readonly local "$1"
+		&& && done "$@" echo -eu echo export -eu --verbose && ${HOME} --verbose
+| 'quoted text' "$1" $(pwd)
+'quoted text' cd done $(pwd) cd 'quoted text' ${HOME} awk readonly $(pwd)
+		x=1 printf printf local && export /usr/bin 2>/dev/null
+grep readonly ${HOME} 'quoted text'
+	readonly ${HOME} 'quoted text' && export then grep printf &&
+	'quoted text' && then grep printf then $(pwd) x=1 readonly x=1 local
+x=1 x=1 then x=1 echo /usr/bin --verbose echo
+	grep grep then 'quoted text' && 2>/dev/null then /usr/bin
+sed done export awk "$1" 2>/dev/null 2>/dev/null "$@" test
+	"$@" awk --verbose x=1 test /usr/bin readonly local $(pwd) | test cd then
+	sed test awk 2>/dev/null local $(pwd) done --verbose printf
+	grep "$1" x=1 readonly "$@" "$1" test local local echo then -eu awk test
+$(pwd) | cd /usr/bin "$@" x=1 awk /usr/bin done /usr/bin awk 2>/dev/null
+/usr/bin 2>/dev/null 'quoted text' --verbose export
+	cd readonly ${HOME} "$@" -eu export local
+		${HOME} --verbose | "$1" local done cd grep
+	then test 'quoted text' 'quoted text'
+	done export awk echo $(pwd) "$1" $(pwd) && x=1 | export -eu
+		| cd 'quoted text' test grep done
+done cd $(pwd) grep then done sed cd ${HOME} --verbose test local --verbose
+		&& 'quoted text' && "$1" printf "$1" done ${HOME} test && printf
+"$@" test test then readonly then && "$1" grep -eu test -eu sed 'quoted text'
+printf x=1 x=1 ${HOME} cd /usr/bin | /usr/bin done awk | 'quoted text'
+		export $(pwd) local "$1" 2>/dev/null 2>/dev/null
+"$@" "$1" 'quoted text' readonly "$@" $(pwd)
+then x=1 test done then echo test printf
+	-eu /usr/bin done export cd "$@" --verbose test | /usr/bin
+	| 2>/dev/null ${HOME} --verbose export done -eu then readonly test sed done
+	'quoted text' -eu test grep ${HOME} grep printf $(pwd) printf export
+		'quoted text' echo ${HOME} sed readonly local
+test 2>/dev/null /usr/bin sed printf --verbose sed grep export ${HOME} cd export
+printf readonly ${HOME} 'quoted text' printf done awk local
+	--verbose awk local local test readonly $(pwd)
+		printf export done &&
+		awk "$@" then 2>/dev/null
+		"$@" 2>/dev/null sed $(pwd) test
+export done "$@" grep readonly
+	grep awk && awk then x=1 2>/dev/null local $(pwd)
+	grep local | grep echo x=1 awk test 2>/dev/null then sed
+awk -eu /usr/bin ${HOME}
+--verbose | local && cd grep test awk printf | export "$1" sed 'quoted text'
+-eu 2>/dev/null echo --verbose
+	&& $(pwd) $(pwd) ${HOME}
+/usr/bin ${HOME} local x=1 cd ${HOME} printf "$1" awk "$1" echo cd awk /usr/bin
+	"$@" "$1" ${HOME} "$@" awk printf sed test
+		-eu readonly x=1 2>/dev/null done $(pwd) -eu 'quoted text'
+		awk "$1" grep --verbose --verbose x=1 "$1"
+		/usr/bin -eu $(pwd) awk then done readonly cd | awk 2>/dev/null
+		x=1 grep 'quoted text' && export x=1 /usr/bin
+		'quoted text' printf then "$@" readonly
+	awk $(pwd) "$1" test --verbose test 2>/dev/null --verbose done
+export ${HOME} /usr/bin awk $(pwd) sed export "$@" printf done 2>/dev/null
+		x=1 $(pwd) ${HOME} --verbose ${HOME} done -eu
+		-eu 'quoted text' then printf x=1 cd x=1 readonly then -eu export 'quoted text'
+-eu echo ${HOME} ${HOME} echo then test /usr/bin --verbose |
+test /usr/bin 'quoted text' awk then readonly export grep --verbose
+grep grep awk readonly readonly 'quoted text'
+awk | done sed readonly awk test && echo test done
+		export -eu --verbose | awk x=1 then | awk && awk --verbose then | local grep
+	awk x=1 local x=1 ${HOME} --verbose test readonly
+&& echo | "$1" -eu "$@" then sed test 2>/dev/null
+grep awk sed export 'quoted text' then export cd --verbose 2>/dev/null
+test "$@" ${HOME} export awk
+		grep x=1 'quoted text' done export $(pwd) 2>/dev/null test test test
+	"$1" readonly 2>/dev/null awk
+-eu -eu readonly awk then local 'quoted text' $(pwd)
+		$(pwd) cd echo -eu ${HOME} cd sed -eu echo 2>/dev/null 'quoted text'
+		awk 'quoted text' /usr/bin echo printf
+2>/dev/null printf $(pwd) local grep then done "$1"
+		local export | $(pwd) $(pwd) -eu cd 2>/dev/null local
+test then "$@" $(pwd) readonly done done grep x=1 -eu /usr/bin
+		done /usr/bin awk --verbose
+-eu -eu echo done local -eu $(pwd) local printf then /usr/bin echo test x=1
+&& export printf done $(pwd)
+	--verbose x=1 /usr/bin -eu $(pwd) /usr/bin 'quoted text'
+printf ${HOME} "$1" export printf && echo echo done 2>/dev/null
+then done grep | sed awk ${HOME}
+--verbose 2>/dev/null printf $(pwd) sed done
+then awk --verbose $(pwd) ${HOME} | $(pwd) && -eu
+		printf /usr/bin && echo && --verbose 2>/dev/null
+		&& cd && grep sed test then printf -eu cd 'quoted text' 'quoted text' 'quoted text'
+		local --verbose grep | -eu test awk 'quoted text' local
+2>/dev/null awk 2>/dev/null
+$(pwd) 'quoted text' ${HOME} $(pwd) 'quoted text' x=1 export
+2>/dev/null "$1" --verbose
+	sed -eu "$1" awk readonly ${HOME} printf |
+grep ${HOME} awk 'quoted text' -eu awk $(pwd) | sed sed
+/usr/bin cd && "$@" && /usr/bin /usr/bin /usr/bin "$1" | && test /usr/bin
+		echo --verbose "$@" export export ${HOME}
+		$(pwd) && readonly done "$1" --verbose then && printf readonly /usr/bin
+		test awk --verbose export /usr/bin && /usr/bin done then sed
+cd /usr/bin x=1 local $(pwd) --verbose x=1 -eu -eu "$@" local
+	2>/dev/null && ${HOME} local 2>/dev/null x=1
+export awk local export awk done ${HOME} printf /usr/bin
+	export awk then 2>/dev/null 'quoted text'
+		readonly 2>/dev/null printf 2>/dev/null grep local done export | echo "$@" "$@"
+	--verbose /usr/bin export awk $(pwd) x=1 /usr/bin | local local
+		printf echo "$1" && $(pwd) cd "$1" grep ${HOME} export
+	echo /usr/bin sed --verbose cd -eu -eu "$@" "$1" test 'quoted text' ${HOME} echo
+grep /usr/bin test && -eu "$@" cd printf sed grep 2>/dev/null readonly $(pwd)
+		export --verbose echo | grep "$1" --verbose 2>/dev/null
+		-eu "$1" export export sed /usr/bin local
+	export && printf 'quoted text' echo 'quoted text'
+--verbose $(pwd) 2>/dev/null 2>/dev/null -eu
+printf 'quoted text' readonly printf printf 2>/dev/null "$@" echo printf --verbose
+		'quoted text' 'quoted text' "$@" export sed export x=1 |
+		readonly "$1" cd 'quoted text' && 2>/dev/null "$@" echo -eu ${HOME}
+	sed --verbose cd echo 'quoted text'
+done test awk x=1 cd && &&
+		--verbose ${HOME} "$@" local local
+done x=1 | $(pwd) local grep then
+local sed export export awk test | && 2>/dev/null
+/usr/bin -eu | test $(pwd) export then grep ${HOME} test -eu done
+		then echo then grep echo --verbose
+	export x=1 awk printf readonly |
+2>/dev/null echo awk $(pwd)
+		test "$1" /usr/bin sed | grep /usr/bin readonly
+${HOME} "$1" readonly x=1 grep | done 2>/dev/null 2>/dev/null
+		local done --verbose -eu readonly
+	2>/dev/null "$1" local printf export /usr/bin readonly
+	awk --verbose printf 2>/dev/null | echo && && sed local -eu then -eu printf
+		"$@" awk export local sed x=1
+	--verbose done -eu sed 2>/dev/null export "$1" cd
+	x=1 | && local x=1 /usr/bin 2>/dev/null cd -eu export "$@" readonly
+	local --verbose cd cd 'quoted text'
+&& "$@" printf sed export /usr/bin 'quoted text'
+	| done printf cd cd --verbose test | grep | "$1"
+	done local 'quoted text' sed -eu printf /usr/bin local /usr/bin
+"$@" | x=1 $(pwd) awk "$1" readonly then awk /usr/bin "$1" "$1" && 2>/dev/null
+	-eu grep grep ${HOME} /usr/bin done "$1" printf $(pwd)
+/usr/bin | echo export grep local echo grep echo $(pwd) $(pwd)
+		'quoted text' ${HOME} done
+echo local /usr/bin && x=1 awk -eu local "$1" printf done 2>/dev/null
+		${HOME} echo 2>/dev/null x=1 2>/dev/null "$@" export 'quoted text' then
+	local -eu printf awk /usr/bin done $(pwd) $(pwd) cd test $(pwd) ${HOME} ${HOME}
+	sed x=1 local done test awk
+		2>/dev/null "$@" && 'quoted text' /usr/bin
+	--verbose | sed local --verbose
+then x=1 ${HOME} test $(pwd) /usr/bin test readonly cd sed sed printf test
+	"$1" --verbose | export 2>/dev/null test | 2>/dev/null
+	test -eu --verbose echo local 'quoted text'
+		test awk local awk && printf 'quoted text' 2>/dev/null 2>/dev/null
+		done echo done 'quoted text' x=1
+		-eu test "$1" printf "$1" --verbose -eu -eu cd ${HOME} 2>/dev/null export
+${HOME} test sed printf -eu --verbose echo | then sed |
+| ${HOME} cd echo done echo ${HOME} x=1 -eu | $(pwd) $(pwd) awk
+${HOME} test --verbose echo then test | echo
+		sed export local printf 'quoted text' && $(pwd) local
+done "$@" x=1 awk /usr/bin "$1" export 2>/dev/null done /usr/bin printf
+		x=1 grep "$@" 'quoted text' printf
+	$(pwd) awk awk -eu --verbose
+	$(pwd) x=1 echo "$@" then 'quoted text' x=1 -eu readonly /usr/bin
+'quoted text' "$@" done "$1" echo 'quoted text'
+&& --verbose sed && awk readonly readonly printf echo --verbose
+	grep "$@" sed /usr/bin cd -eu then "$1" "$@" 2>/dev/null then
+	&& readonly cd 'quoted text' x=1 --verbose cd --verbose printf | printf
+		"$1" "$@" "$1" echo echo --verbose 'quoted text'
+	printf export test done awk | cd -eu "$@" -eu echo readonly --verbose | grep
+	"$1" ${HOME} /usr/bin then "$1" grep | $(pwd) echo 'quoted text'
+	$(pwd) export printf sed test awk readonly
+	-eu /usr/bin local 'quoted text' then
+	-eu $(pwd) export $(pwd)
+export test sed $(pwd) | $(pwd) printf sed $(pwd) "$@" readonly sed | --verbose
+		readonly test 'quoted text' local ${HOME} x=1 -eu ${HOME}
+/usr/bin /usr/bin $(pwd) | 'quoted text' export |
+	x=1 --verbose export readonly | -eu sed "$@" "$@" printf cd then && "$@"
+		/usr/bin && done /usr/bin
+$(pwd) $(pwd) echo echo then ${HOME} | 'quoted text' cd /usr/bin done export
+	done local printf awk done "$@" ${HOME}
+	| then then then then readonly 'quoted text' echo ${HOME} export
+		${HOME} grep ${HOME} && printf
+x=1 /usr/bin 2>/dev/null x=1 "$1" "$1" /usr/bin export --verbose echo && 2>/dev/null
+	sed 'quoted text' grep -eu ${HOME} /usr/bin done grep 2>/dev/null printf x=1
+		'quoted text' grep 2>/dev/null
+	| "$1" grep sed echo readonly then echo /usr/bin
+	local local 2>/dev/null printf x=1 cd 2>/dev/null -eu
+x=1 /usr/bin ${HOME} export echo then ${HOME}
+		x=1 sed sed && 2>/dev/null -eu "$@" sed | ${HOME} then -eu /usr/bin -eu cd | grep
+printf test -eu readonly && && printf &&
+x=1 printf --verbose ${HOME} awk -eu cd
+		&& echo awk sed x=1 &&
+	-eu | $(pwd) 'quoted text'
+		local grep cd /usr/bin readonly local 'quoted text'
+	&& cd "$1" cd ${HOME} readonly /usr/bin ${HOME} sed local then | then x=1 "$@"
+		"$@" 'quoted text' awk && cd ${HOME} done x=1 echo 'quoted text'
+&& test sed x=1 local export --verbose printf 2>/dev/null
+readonly "$@" 2>/dev/null | printf
+	-eu "$@" /usr/bin "$@" export 'quoted text' ${HOME}
+		--verbose 2>/dev/null export test test
+x=1 cd readonly | printf ${HOME} done grep export "$1" then
+-eu readonly echo test 'quoted text'
+		cd $(pwd) done | sed grep printf "$@" export -eu "$1"
+	local echo echo cd /usr/bin done awk $(pwd) -eu $(pwd)
+x=1 --verbose /usr/bin x=1 test -eu /usr/bin x=1 && x=1 cd 'quoted text'
+done --verbose sed | ${HOME} $(pwd) sed | grep x=1 $(pwd) --verbose "$@" done
+readonly then | x=1 local then local --verbose echo cd && awk echo 'quoted text'
+		'quoted text' then x=1 2>/dev/null then -eu x=1 x=1 local
+	cd $(pwd) awk && x=1 cd then echo && test "$@" 2>/dev/null sed grep /usr/bin /usr/bin
+${HOME} 'quoted text' --verbose then cd $(pwd) $(pwd)
+		--verbose readonly 'quoted text' x=1 $(pwd) /usr/bin printf $(pwd) cd -eu
+		cd ${HOME} local then grep awk "$1" | test $(pwd) printf --verbose 'quoted text'
+		2>/dev/null --verbose $(pwd) && 2>/dev/null export 2>/dev/null readonly "$@"
+	echo printf 2>/dev/null then | --verbose echo cd printf local x=1 && printf
+		printf "$@" -eu 'quoted text' test "$1" echo sed cd echo
+	local "$@" /usr/bin && done 2>/dev/null 2>/dev/null local
+		grep "$@" cd -eu 'quoted text'
+		--verbose 'quoted text' "$1" x=1 && "$@" printf && | awk -eu $(pwd)
+		export x=1 test done 'quoted text' test x=1 echo echo done "$@"
+		sed sed ${HOME} echo --verbose cd export -eu -eu readonly -eu x=1 "$1" $(pwd)
+	sed ${HOME} then | --verbose x=1 then test ${HOME} 'quoted text' /usr/bin 2>/dev/null
+	awk done echo x=1 | grep --verbose test local done cd &&
+		cd printf 'quoted text' sed -eu printf -eu "$@" 2>/dev/null done export then "$@"
+/usr/bin --verbose && "$@" | "$1" $(pwd) local "$@" "$1" 2>/dev/null
+		test awk x=1 awk x=1 -eu sed test grep awk x=1 -eu test grep --verbose "$@" 2>/dev/null
+		awk readonly /usr/bin /usr/bin test awk test 'quoted text' echo sed --verbose
+"$1" 'quoted text' | -eu -eu printf && -eu "$1"
+readonly | local echo /usr/bin && readonly printf cd -eu
+grep sed echo test 'quoted text' readonly x=1 "$1" ${HOME} grep cd readonly
+cd grep printf printf grep then local
+$(pwd) -eu readonly printf awk && sed -eu sed export sed
+done 'quoted text' -eu ${HOME} export -eu 2>/dev/null readonly
+		done | grep --verbose test printf then x=1 test cd --verbose
+	printf readonly sed "$@" local done local
+local && local 2>/dev/null sed
+echo sed awk --verbose local local --verbose printf | grep
+echo x=1 awk sed $(pwd) sed $(pwd) 2>/dev/null
+cd test x=1 grep -eu "$@" "$1"
+then test "$@" local "$1" sed 'quoted text'
+&& --verbose --verbose 2>/dev/null "$1" sed /usr/bin done readonly
+done test "$@" echo | $(pwd) echo --verbose printf /usr/bin x=1 done
+| "$@" --verbose sed | /usr/bin printf cd 2>/dev/null
+		grep echo /usr/bin --verbose
+x=1 && cd local $(pwd) test x=1 local done && grep cd --verbose
+		echo test then then readonly done
+local grep $(pwd) && $(pwd) | cd done echo awk x=1
+	'quoted text' 'quoted text' -eu readonly $(pwd) local --verbose
+	printf readonly export test
+	readonly "$@" ${HOME} readonly test echo export
+	done cd "$@" "$1" --verbose /usr/bin readonly awk sed awk sed done
+export x=1 && done "$@" 2>/dev/null && -eu then done local /usr/bin then 2>/dev/null
+		2>/dev/null $(pwd) $(pwd) $(pwd) /usr/bin && done "$1" 'quoted text'
+		printf 'quoted text' done test 2>/dev/null
+	done --verbose done local ${HOME} done local | "$@" readonly
+local $(pwd) /usr/bin 'quoted text' sed sed then sed export grep test sed "$@"
+		export test ${HOME} local 'quoted text' export
+	local awk x=1 x=1 "$1" printf
+		echo ${HOME} printf export echo --verbose -eu echo
+		test cd sed -eu -eu done --verbose
+	2>/dev/null grep done done /usr/bin local ${HOME} -eu then "$@" test "$@" "$@" $(pwd)
+	"$@" 2>/dev/null done x=1 echo && $(pwd) -eu
+grep -eu $(pwd) -eu "$1"
+	local 2>/dev/null then x=1 done | cd printf grep echo grep readonly 2>/dev/null
+then done --verbose then awk /usr/bin | /usr/bin && | ${HOME} readonly sed
+		x=1 | readonly awk $(pwd)
+awk cd then then test ${HOME} awk ${HOME} x=1 --verbose readonly export
+		echo x=1 done sed 2>/dev/null -eu then x=1 then done 2>/dev/null | done
+		printf printf "$@" 2>/dev/null sed grep | echo grep "$@" "$@" /usr/bin awk
+	grep export ${HOME} cd $(pwd) $(pwd)
+	'quoted text' done "$1" echo 2>/dev/null /usr/bin
+x=1 sed "$1" done 'quoted text' "$@" then /usr/bin printf
+		echo "$1" local | "$1" $(pwd) 2>/dev/null test /usr/bin printf grep && echo
+	'quoted text' export x=1 printf
+		echo done --verbose $(pwd)
+	then $(pwd) /usr/bin echo | printf /usr/bin -eu -eu test
+| x=1 && readonly "$1"
+		printf export local --verbose awk cd 'quoted text' printf sed /usr/bin ${HOME}
+		echo then done then test 2>/dev/null "$@" x=1 x=1 "$@" 2>/dev/null -eu
+then "$1" awk 'quoted text' 'quoted text' 2>/dev/null done
+| done x=1 test grep 'quoted text' "$1" $(pwd) readonly readonly export 'quoted text'
+${HOME} x=1 ${HOME} ${HOME} sed export echo $(pwd) x=1 --verbose 'quoted text'
+cd ${HOME} export && -eu sed
+| 2>/dev/null ${HOME} done readonly export sed "$1" ${HOME} | local
+		/usr/bin 'quoted text' awk readonly done --verbose done awk
+		${HOME} -eu ${HOME} sed awk /usr/bin /usr/bin $(pwd) printf test readonly
+2>/dev/null export 'quoted text'
+${HOME} --verbose printf
+		readonly | test x=1 | printf then /usr/bin grep
+		/usr/bin && ${HOME} test 2>/dev/null -eu -eu done /usr/bin
+	--verbose echo | awk echo
+	test sed ${HOME} --verbose x=1 then && done && --verbose test export done
+	cd $(pwd) test echo grep readonly readonly
+		echo && echo test && x=1 /usr/bin readonly echo export $(pwd) grep && --verbose
+| x=1 2>/dev/null 2>/dev/null | | printf x=1 "$@" --verbose awk $(pwd) | 2>/dev/null
+| then grep grep printf x=1 x=1 done
+		export | | --verbose grep
+		sed echo printf "$1" printf x=1 $(pwd) --verbose local "$@" "$1" local | readonly
+readonly grep local grep 2>/dev/null
+	then /usr/bin 'quoted text' -eu test printf sed printf $(pwd) awk /usr/bin 'quoted text'
+	"$1" printf readonly "$@" printf grep 'quoted text' 2>/dev/null "$@" awk printf
+grep readonly /usr/bin && $(pwd) awk done $(pwd)
+grep local grep $(pwd)
+${HOME} $(pwd) -eu -eu echo sed echo
+	x=1 readonly grep cd ${HOME} -eu local "$1"
+2>/dev/null $(pwd) "$1" sed "$1"
+sed --verbose "$1" printf x=1 awk | readonly readonly /usr/bin readonly
+grep | 'quoted text' x=1 cd | /usr/bin --verbose $(pwd)
+2>/dev/null | --verbose &&
+		then then "$@" /usr/bin then awk
+"$@" done /usr/bin 2>/dev/null
+'quoted text' $(pwd)
+		cd | "$1" readonly cd --verbose awk cd $(pwd) "$1" -eu x=1 done readonly /usr/bin
+	'quoted text' done local echo x=1 "$1" x=1 "$@" cd printf
+	x=1 export "$@" cd local 'quoted text' printf test 2>/dev/null test /usr/bin readonly
+	awk awk local test awk sed
+test then $(pwd) x=1 then x=1 test local test 'quoted text' grep then -eu
+	--verbose x=1 && -eu then then
+	test 'quoted text' test ${HOME} | export readonly
+	cd -eu export cd /usr/bin
+	"$1" --verbose cd && -eu | ${HOME} 2>/dev/null
+${HOME} local then printf cd -eu x=1 local
+"$@" /usr/bin printf /usr/bin | /usr/bin --verbose /usr/bin $(pwd)
+	"$@" test sed "$@" | x=1 && readonly cd "$1"
+	&& then $(pwd) /usr/bin 2>/dev/null $(pwd) -eu local 2>/dev/null "$1" test
+done /usr/bin grep cd $(pwd) && then printf && /usr/bin ${HOME} 'quoted text' export
+	"$1" cd cd "$1" 2>/dev/null awk grep printf ${HOME} "$@" /usr/bin
+/usr/bin $(pwd) done 'quoted text' x=1 cd x=1 x=1
+cd test ${HOME} grep printf /usr/bin
+cd 'quoted text' | then 'quoted text' export
+		-eu then grep sed done | ${HOME} done 'quoted text' && -eu && local && readonly
+'quoted text' "$@" "$@" then done "$@" done local
+	readonly test sed awk printf done export awk test "$1" done
+	test -eu | readonly awk -eu 'quoted text'
+		--verbose --verbose awk printf sed then local $(pwd)
+'quoted text' "$1" export -eu printf then printf 'quoted text'
+		&& /usr/bin "$@" printf "$@" test printf sed --verbose --verbose cd readonly
+sed | awk printf readonly /usr/bin 'quoted text' /usr/bin readonly
+2>/dev/null "$@" sed $(pwd) done awk cd "$1" "$@" done 2>/dev/null ${HOME}
+printf -eu awk "$1" grep /usr/bin | echo grep 'quoted text' done cd &&
+		readonly test 2>/dev/null $(pwd) grep cd -eu done export awk 'quoted text'
+	/usr/bin cd readonly cd | --verbose test x=1 --verbose
+		export 'quoted text' "$1" grep
+	local ${HOME} then && ${HOME} sed $(pwd) $(pwd)
+	awk readonly done -eu printf sed export sed printf "$1" awk "$1" readonly
+	awk ${HOME} "$@" 'quoted text' echo 'quoted text'
+	echo awk then printf readonly "$@" sed printf 'quoted text' sed "$@" 'quoted text'
+${HOME} "$@" | then 2>/dev/null
+		export 'quoted text' /usr/bin /usr/bin
+		awk cd echo 2>/dev/null 2>/dev/null
+grep --verbose test x=1 local $(pwd) --verbose "$1"
+	local cd 'quoted text' then cd ${HOME} test grep
+${HOME} awk done 2>/dev/null sed printf
+${HOME} done ${HOME} 2>/dev/null --verbose | 'quoted text' local readonly
+	sed "$@" export -eu then then x=1 "$1" "$1" &&
+		cd readonly awk 'quoted text' echo | $(pwd) test sed echo
+test ${HOME} then awk printf readonly printf then export local /usr/bin sed |
+	test done "$1" "$1" echo
+local local | | echo grep x=1 readonly export grep /usr/bin x=1 && sed printf
+-eu test test ${HOME} awk done x=1 awk then ${HOME} grep printf $(pwd)
+		| 'quoted text' "$1" cd | export awk ${HOME} ${HOME} export 2>/dev/null
+		2>/dev/null x=1 grep done done "$@" --verbose
+2>/dev/null awk "$@" export grep echo "$@" | then "$1" 2>/dev/null cd
+	"$1" "$1" --verbose ${HOME} grep --verbose 'quoted text' "$1" --verbose ${HOME}
+		awk cd awk --verbose /usr/bin
+echo test -eu printf awk | echo 2>/dev/null done echo "$1" "$1" awk then
+		/usr/bin sed 'quoted text' 'quoted text' printf sed |
+	/usr/bin x=1 printf echo local grep $(pwd) "$1" echo
+		2>/dev/null readonly "$1" "$1" /usr/bin
+$(pwd) "$1" --verbose grep test awk "$@" "$1" grep -eu /usr/bin
+		'quoted text' "$@" 2>/dev/null --verbose local
+done "$@" && echo then $(pwd) && $(pwd) --verbose local
+	${HOME} --verbose echo
+	grep printf -eu local $(pwd) "$@" && then ${HOME} awk readonly /usr/bin grep -eu
+	'quoted text' grep local x=1
+$(pwd) printf then grep printf sed $(pwd) --verbose "$@" readonly sed |
+	$(pwd) readonly x=1 "$@" | ${HOME} then echo awk 'quoted text'
+		-eu -eu "$1" -eu export 'quoted text' cd &&
+		awk awk 2>/dev/null readonly local --verbose readonly done
+	readonly then test | readonly 2>/dev/null --verbose cd | -eu echo echo cd grep
+		echo printf 'quoted text' then
+		test x=1 sed && "$1" done cd 'quoted text'
+	local 'quoted text' && done && grep readonly $(pwd) printf | ${HOME}
+/usr/bin then ${HOME} --verbose x=1 test grep printf local export printf --verbose
+		"$@" cd cd --verbose | local -eu 'quoted text'
+		then x=1 echo && /usr/bin ${HOME} "$@"
+		'quoted text' sed cd cd --verbose x=1 readonly 2>/dev/null export grep printf
+cd 'quoted text' | -eu $(pwd) | then 'quoted text' -eu &&
+		test "$@" test $(pwd) -eu sed printf
+test "$1" --verbose grep awk 'quoted text' --verbose test readonly readonly export
+	-eu "$1" $(pwd) done readonly local then --verbose sed awk --verbose "$@"
+sed export -eu $(pwd) | test -eu
+	'quoted text' export | cd awk /usr/bin "$1" -eu then printf printf local
+	done export grep --verbose && readonly && printf 2>/dev/null x=1
+grep sed "$1" then /usr/bin echo printf /usr/bin
+	| /usr/bin ${HOME} --verbose ${HOME} local
+	/usr/bin export export "$1" echo --verbose test --verbose $(pwd)
+'quoted text' "$@" then export "$1" export local printf
+	x=1 "$1" local ${HOME} local "$1" cd local "$@" echo grep
+| awk local && --verbose --verbose 2>/dev/null /usr/bin readonly grep
+/usr/bin --verbose && cd "$1" grep cd -eu "$1" 'quoted text' readonly /usr/bin
+		echo awk && cd 'quoted text' test printf test
+	echo $(pwd) then $(pwd) then ${HOME}
+		/usr/bin "$1" cd && readonly then readonly "$1" export printf
+&& $(pwd) sed test 'quoted text' done | 'quoted text' | export |
+grep export x=1 "$@" echo then done $(pwd) test done
+		/usr/bin --verbose --verbose -eu "$@" |
+$(pwd) 2>/dev/null && echo ${HOME} 2>/dev/null export done local echo then
+	/usr/bin "$@" 'quoted text' ${HOME} awk sed /usr/bin done ${HOME} /usr/bin
+x=1 2>/dev/null printf printf done test &&
+2>/dev/null --verbose local --verbose 'quoted text'
+sed cd readonly ${HOME} cd /usr/bin printf x=1 sed printf | test
+		done 'quoted text' cd --verbose /usr/bin
+	'quoted text' "$1" 'quoted text' readonly
+local sed readonly then -eu
+		readonly test echo awk $(pwd) | -eu export done | grep -eu
+		cd | "$1" "$@" --verbose
+--verbose "$1" 2>/dev/null printf local /usr/bin cd
+	export x=1 'quoted text' && done
+awk 'quoted text' 'quoted text' awk printf | local "$@" --verbose
+		${HOME} "$@" printf printf | | done echo "$1" grep grep
+	"$@" x=1 then local | test export $(pwd) x=1 grep 'quoted text'
+		echo readonly ${HOME} "$@" 'quoted text' printf "$@" x=1 -eu x=1 --verbose local
+	echo x=1 awk local then x=1 echo awk echo "$@" then && done awk done done
+		$(pwd) ${HOME} --verbose echo awk printf
+	echo 'quoted text' awk echo export && echo
+	/usr/bin $(pwd) x=1 /usr/bin && 'quoted text' --verbose done
+then local $(pwd) ${HOME} | "$1"
+		export && x=1 /usr/bin sed | local printf grep 2>/dev/null | | done readonly
+echo awk "$1" sed --verbose --verbose
+| done $(pwd) grep -eu 'quoted text'
+x=1 -eu | /usr/bin | awk
+		cd export 2>/dev/null
+		"$@" ${HOME} then done ${HOME} grep local -eu readonly echo ${HOME}
+		readonly echo readonly export
+done echo -eu | && grep "$1" cd awk -eu
+echo "$@" export printf | readonly grep |
+	grep printf grep test done then done then echo sed grep awk && $(pwd) --verbose
+	local ${HOME} test grep sed printf grep then
+		awk "$@" ${HOME} export $(pwd) $(pwd) done test readonly
+grep printf awk | "$1" readonly readonly
+	$(pwd) /usr/bin readonly
+	sed grep sed awk && 2>/dev/null
+	-eu x=1 echo 2>/dev/null "$@" echo --verbose grep
+awk printf $(pwd) grep ${HOME} test
+done awk cd grep printf 2>/dev/null ${HOME} printf then | local local "$@"
+printf then 'quoted text' sed awk 2>/dev/null readonly echo awk --verbose ${HOME}
+	"$1" ${HOME} local $(pwd) --verbose awk | readonly echo
+		&& then $(pwd) export awk $(pwd) local then awk grep test cd echo | 2>/dev/null
+echo $(pwd) echo awk test ${HOME} test
+	printf export $(pwd) grep test "$@"
+	${HOME} done | --verbose done test $(pwd)
+	| "$@" | "$@" echo /usr/bin ${HOME} x=1 /usr/bin /usr/bin awk $(pwd) local
+$(pwd) export "$@" grep 2>/dev/null then cd cd done
+		--verbose "$@" done echo cd "$1"
+	&& test local /usr/bin "$@" "$@" -eu printf test echo echo
+	--verbose --verbose 2>/dev/null readonly awk cd 2>/dev/null
+"$@" -eu x=1 local local -eu && "$1" ${HOME} grep local "$1" x=1 "$1" && 'quoted text'
+readonly x=1 /usr/bin grep grep | local printf printf grep 'quoted text'
+&& "$1" test grep /usr/bin awk sed -eu --verbose ${HOME} -eu cd then
+local echo printf test grep && readonly
+		${HOME} x=1 grep 2>/dev/null ${HOME} done echo
+		grep then ${HOME} 'quoted text' "$@" "$1" sed
+done test -eu export then 2>/dev/null 2>/dev/null
+		echo awk cd grep local $(pwd) x=1 sed
+	/usr/bin export && x=1 x=1 sed local /usr/bin $(pwd) "$@" sed "$1" "$@" 'quoted text'
+		| /usr/bin | "$@" ${HOME} then readonly readonly
+		/usr/bin sed && local awk ${HOME}
+	local printf -eu local awk done "$@" printf test local -eu printf ${HOME} test
+	2>/dev/null -eu grep && 2>/dev/null
+--verbose /usr/bin 'quoted text' 'quoted text'
+		| echo awk "$1" done local $(pwd)
+		-eu echo cd -eu awk /usr/bin local 'quoted text'
+	export cd printf ${HOME} -eu sed x=1 echo "$1"
+	export sed 2>/dev/null | ${HOME} awk awk x=1 grep export
+grep ${HOME} export $(pwd) grep
+		x=1 sed grep "$1" then --verbose -eu ${HOME} readonly /usr/bin readonly $(pwd)
+export && 2>/dev/null awk
+		echo -eu "$@" cd | /usr/bin | ${HOME} | local echo
+	grep printf | export -eu sed $(pwd) /usr/bin cd local printf && awk export
+"$1" cd grep awk x=1 ${HOME} cd local
+"$1" readonly cd x=1 printf --verbose cd --verbose "$@" ${HOME} printf $(pwd)
+	then then local 2>/dev/null awk done export
+		2>/dev/null echo grep | x=1 done grep 'quoted text' local then && "$@"
+		grep --verbose export echo x=1 ${HOME}
+		$(pwd) local cd --verbose x=1
+	cd awk x=1 readonly grep then "$@" 2>/dev/null 'quoted text'
+local ${HOME} 'quoted text' local | export then "$@" "$1"
+		test readonly echo 2>/dev/null awk readonly "$1" --verbose && $(pwd)
+test && "$@" --verbose then
+--verbose /usr/bin export printf $(pwd) awk readonly x=1 printf printf
+		/usr/bin local grep local -eu
+	$(pwd) test cd /usr/bin readonly && cd test echo $(pwd) echo grep sed then 'quoted text'
+x=1 "$1" readonly readonly "$@" 'quoted text' ${HOME} then "$1" sed test
+	readonly sed && test
+then done ${HOME} -eu -eu printf ${HOME} "$1" done export
+		test /usr/bin readonly 2>/dev/null awk sed "$1"
+	'quoted text' done export test readonly
+		echo -eu | -eu ${HOME} && printf printf "$@" | sed done sed printf /usr/bin
+	/usr/bin --verbose --verbose
+		$(pwd) readonly sed done &&
+	${HOME} echo cd /usr/bin grep 2>/dev/null 2>/dev/null | test | printf
+		printf --verbose grep x=1 x=1 cd grep test echo | ${HOME} test "$1" grep export
+		-eu export && done local cd ${HOME} --verbose "$1" readonly | printf 2>/dev/null
+	cd printf -eu echo awk printf -eu && export local cd
+		${HOME} "$@" echo then "$@" x=1 test -eu "$1" --verbose
+sed 2>/dev/null 2>/dev/null $(pwd) then printf "$1" | x=1
+		printf echo "$@" /usr/bin && test readonly x=1 /usr/bin done | --verbose $(pwd)
+$(pwd) printf "$@" --verbose ${HOME} -eu grep /usr/bin
+		$(pwd) echo /usr/bin cd --verbose test "$@" done echo $(pwd) readonly cd 'quoted text'
+export "$@" && ${HOME} sed | $(pwd) $(pwd) "$1"
+test --verbose "$@" --verbose done echo ${HOME} x=1 "$1"
+		"$@" test printf export awk test "$@" cd | $(pwd) | x=1 awk "$1" sed -eu test
+	/usr/bin "$1" x=1 &&
+	-eu 'quoted text' test then sed sed $(pwd) "$@" local -eu awk
+	&& export ${HOME} local | 2>/dev/null && "$@"
+		| sed "$1" | echo echo readonly test awk "$@" x=1 x=1 printf -eu grep
+done "$1" local ${HOME}
+		readonly "$@" readonly sed /usr/bin --verbose
+	grep awk test grep | cd /usr/bin export "$1" 2>/dev/null printf
+		"$1" printf awk x=1 grep sed then ${HOME} x=1
+		| then test echo "$@" --verbose $(pwd) sed --verbose local grep $(pwd)
+	2>/dev/null grep local done done ${HOME} cd local local x=1 printf
+readonly printf 2>/dev/null /usr/bin sed done then test
+	--verbose 2>/dev/null export awk then -eu 'quoted text' --verbose test done local
+		"$1" then grep /usr/bin grep $(pwd) -eu sed -eu /usr/bin done 2>/dev/null
+		readonly /usr/bin 'quoted text' export 2>/dev/null cd test &&
+x=1 x=1 local 'quoted text'
+	| "$@" 'quoted text' printf "$@" then | "$@"
+		'quoted text' -eu test && 2>/dev/null awk /usr/bin -eu echo
+	"$1" 'quoted text' $(pwd) sed 2>/dev/null export test -eu $(pwd) grep 2>/dev/null
+&& awk awk export readonly
+		${HOME} then test "$@" x=1 readonly cd ${HOME} ${HOME} echo
+2>/dev/null export -eu "$@" ${HOME} echo then local readonly awk then
+	printf && && ${HOME} grep local &&
+	/usr/bin sed cd sed --verbose /usr/bin
+		&& && export readonly x=1 'quoted text' ${HOME} "$1" local ${HOME} | -eu "$1"
+test sed done ${HOME} "$1" awk "$@" done cd && then echo printf local
+sed --verbose ${HOME} test grep awk done && echo -eu x=1 /usr/bin local
+done cd sed && "$1" $(pwd) 'quoted text' && local
+2>/dev/null grep && then /usr/bin grep "$@" test cd x=1 export sed cd x=1
+	&& sed $(pwd) test $(pwd) 2>/dev/null ${HOME} "$@" done x=1 x=1 && /usr/bin
+		grep printf && local local $(pwd) "$1" grep ${HOME} /usr/bin
+		&& x=1 ${HOME} && local $(pwd) 'quoted text' grep sed && 'quoted text' cd grep
+2>/dev/null x=1 "$@" -eu | | local x=1 "$1" then
+	grep && done grep "$1" printf sed grep awk | 'quoted text' then "$1"
+	export "$1" "$@" ${HOME} echo grep done echo /usr/bin
+		done grep then 'quoted text' | --verbose | /usr/bin cd printf --verbose
+then sed "$@" test cd --verbose
+| | awk done cd sed echo local x=1
+		printf 'quoted text' | 2>/dev/null
+		export printf x=1 local --verbose test 2>/dev/null grep x=1 -eu done
+	grep /usr/bin echo test grep 2>/dev/null ${HOME} cd echo && then
+then awk cd 'quoted text' echo && echo | done local echo | $(pwd) local echo
+done | awk sed "$1" local done ${HOME} printf local 'quoted text'
+	then done -eu x=1 x=1 test done export done ${HOME} | test cd
+	/usr/bin printf | echo "$1" | grep && sed -eu "$@"
+		cd /usr/bin awk 2>/dev/null 2>/dev/null $(pwd) printf
+		readonly grep grep "$@" sed printf readonly cd
+export awk 'quoted text'
+$(pwd) "$@" cd readonly -eu local $(pwd)
+done then cd done 2>/dev/null printf /usr/bin && echo sed --verbose cd awk
+${HOME} "$1" done local sed /usr/bin
+		"$1" cd -eu cd then then test
+		then --verbose $(pwd) then --verbose
+$(pwd) "$1" | grep | done readonly x=1 test done cd
+	'quoted text' 2>/dev/null "$@" then cd local "$@" done "$@" -eu -eu done
+	export "$@" && local export "$1" cd "$@" grep
+	&& --verbose 2>/dev/null sed ${HOME} printf "$1" 'quoted text'
+	readonly /usr/bin /usr/bin "$@" grep /usr/bin echo readonly sed "$1" "$1"
+		sed --verbose | /usr/bin export sed "$1" local $(pwd) then "$1" 2>/dev/null x=1
+		2>/dev/null done 2>/dev/null $(pwd) --verbose cd -eu export
+		cd "$@" readonly "$1" $(pwd) then export awk local $(pwd) cd /usr/bin
+	| echo grep echo 2>/dev/null --verbose | "$@" then awk | ${HOME} $(pwd) 2>/dev/null
+		then export export --verbose cd $(pwd) done cd export
+local export cd test | "$@" -eu && "$@" /usr/bin printf test /usr/bin 2>/dev/null
+	then --verbose cd echo "$1" readonly "$1" export "$@" cd local && && ${HOME}
+$(pwd) awk 2>/dev/null echo awk -eu printf then x=1 x=1
+		| echo then cd x=1 printf test "$@" then ${HOME}
+	$(pwd) test x=1 cd printf && 'quoted text'
+${HOME} $(pwd) then -eu /usr/bin
+awk /usr/bin done x=1 x=1 'quoted text' "$1" done echo --verbose
+	/usr/bin ${HOME} test grep test -eu awk 2>/dev/null sed ${HOME} cd local readonly
+	sed test test sed "$1"
+		printf | done export ${HOME} 2>/dev/null
+		&& /usr/bin ${HOME} sed awk "$1" printf cd x=1 ${HOME} export echo
+		'quoted text' export local done "$@"
+	"$@" printf grep test | ${HOME} -eu grep echo /usr/bin -eu local
+echo | local then --verbose "$1" local
+	readonly echo 'quoted text' --verbose /usr/bin
+grep local $(pwd) grep "$1" then "$1" $(pwd) printf "$1" -eu awk "$1" local
+&& "$@" export awk then sed readonly test | printf "$@" awk "$1" cd "$@"
+	&& then x=1 $(pwd) "$@" then sed cd 'quoted text' 2>/dev/null
+		"$1" readonly ${HOME} 'quoted text'
+cd -eu | grep "$1" test $(pwd) && $(pwd) test
+test cd readonly | ${HOME} readonly
+		done cd test grep | x=1 local | readonly && then
+		x=1 readonly cd sed "$@" 2>/dev/null then grep echo cd ${HOME} sed awk "$@"
+	-eu then grep -eu readonly && readonly --verbose done
+		cd "$@" cd "$@" --verbose "$@" then test $(pwd) echo "$@" then "$@"
+${HOME} /usr/bin cd x=1 "$1" -eu sed ${HOME}
+echo "$1" && sed "$1" 'quoted text' awk
+	sed --verbose cd grep -eu && printf cd x=1
+	test sed | sed awk "$1" test printf
+	printf awk local export && -eu --verbose export && cd 'quoted text'
+export export 'quoted text' test printf grep $(pwd) /usr/bin -eu sed
+2>/dev/null test test 2>/dev/null && awk /usr/bin "$@" then "$1"
+	-eu then --verbose grep then local done "$@" "$1"
+local local echo x=1 x=1 2>/dev/null echo | sed grep 'quoted text'
+	local export local awk /usr/bin 'quoted text'
+		"$@" local echo -eu cd sed readonly export "$@" $(pwd) export cd | "$1" sed 'quoted text'
+		"$@" | local test done 2>/dev/null readonly export
+	printf test local 'quoted text'
+	echo --verbose 2>/dev/null done grep readonly readonly
+readonly awk -eu readonly cd $(pwd) export
+-eu printf -eu | /usr/bin grep | then 2>/dev/null $(pwd) 2>/dev/null
+	/usr/bin 'quoted text' printf local sed /usr/bin --verbose x=1
+		'quoted text' then "$@" cd "$@" ${HOME}
+		test done export && awk "$1" grep ${HOME} readonly
+	"$1" $(pwd) x=1 readonly "$@" && /usr/bin cd "$@" printf 'quoted text'
+		'quoted text' -eu cd done awk test done "$1" $(pwd) grep x=1 $(pwd)
+	${HOME} && grep && awk readonly ${HOME} cd && readonly --verbose --verbose
+	awk local "$@" echo $(pwd) sed sed grep sed awk export test --verbose cd
+	/usr/bin 'quoted text' --verbose --verbose 2>/dev/null 'quoted text' $(pwd)
+	cd 'quoted text' $(pwd) local local readonly --verbose -eu export grep "$@"
+		grep "$1" ${HOME} printf -eu awk sed --verbose 2>/dev/null --verbose
+"$@" "$@" readonly awk /usr/bin
+awk done grep | 'quoted text'
+	--verbose awk awk cd done grep grep cd readonly cd
+cd local ${HOME} --verbose ${HOME} "$1" $(pwd) /usr/bin cd ${HOME} /usr/bin
+	grep printf export cd 'quoted text' -eu echo 2>/dev/null
+	readonly "$@" 'quoted text' then printf cd
+sed printf && grep grep ${HOME} echo 2>/dev/null cd done -eu local export sed
+	-eu | "$1" 2>/dev/null echo done
+	local | export export "$@" && 'quoted text' then "$@" cd && grep export "$1"
+		local test | done local && then test export then 2>/dev/null
+grep --verbose test printf | then $(pwd) grep /usr/bin echo 'quoted text'
+/usr/bin readonly readonly then sed 2>/dev/null -eu
+"$1" -eu local export $(pwd) sed 'quoted text'
+printf then printf local then export done
+	'quoted text' /usr/bin echo $(pwd) local | echo done && sed
+		done $(pwd) 'quoted text' |
+| done $(pwd) 2>/dev/null 'quoted text' "$@" && ${HOME} && | awk
+		'quoted text' cd $(pwd) 2>/dev/null cd x=1 'quoted text' sed done -eu 'quoted text'
+		x=1 x=1 awk "$@" then grep printf local ${HOME} 'quoted text' then
+	printf /usr/bin grep --verbose echo
+	then 'quoted text' 2>/dev/null awk local test test sed "$1" readonly awk
+	--verbose /usr/bin done local
+		echo printf | 'quoted text' -eu done printf then export $(pwd) | awk
+	awk | awk sed "$@" echo test $(pwd) -eu test done cd "$1" "$@"
+		echo export ${HOME} done sed then 'quoted text' export "$1"
+		export done ${HOME} done 2>/dev/null echo printf
+	awk echo cd x=1 echo done awk test local --verbose x=1 echo | --verbose
+	printf /usr/bin | done readonly | --verbose 2>/dev/null
+	&& 'quoted text' readonly 2>/dev/null | |
+&& && "$@" 2>/dev/null then cd 2>/dev/null printf grep export --verbose sed "$1"
+	2>/dev/null cd readonly printf 'quoted text' "$@" $(pwd) $(pwd) sed
+$(pwd) "$1" $(pwd) export echo x=1 done cd echo done
+	/usr/bin | awk grep $(pwd) 'quoted text' 'quoted text'
+	"$1" test grep 'quoted text' readonly done
+		test local 2>/dev/null && done local 2>/dev/null "$1" -eu 'quoted text' then --verbose
+${HOME} && -eu local test "$1" grep x=1 readonly export | local "$@"
+cd ${HOME} | readonly | | 'quoted text' $(pwd) x=1 'quoted text'
+		echo test test local export cd test then local | sed sed awk -eu cd && | done
+| | awk sed /usr/bin test 'quoted text' | | 'quoted text' test then x=1
+printf $(pwd) "$1" && cd "$@" /usr/bin awk awk ${HOME} sed "$1" --verbose
+| && --verbose done local
+	local grep echo "$1" 'quoted text' printf
+	| && "$1" readonly sed 2>/dev/null
+-eu | "$1" then -eu --verbose -eu
+echo printf then readonly
+		done cd "$@" sed x=1 awk $(pwd) 2>/dev/null
+done grep ${HOME} readonly printf && grep readonly
+"$1" sed printf test sed -eu 'quoted text'
+		awk cd readonly grep $(pwd) awk cd local
+	readonly 2>/dev/null && readonly |
+		cd -eu done sed /usr/bin "$1" readonly "$@" local echo
+2>/dev/null printf then 2>/dev/null && export -eu cd -eu | x=1 --verbose 2>/dev/null
+	printf sed 2>/dev/null echo readonly sed --verbose
+--verbose 'quoted text' cd readonly 'quoted text'
+	readonly grep --verbose cd "$@" echo readonly
+		"$@" ${HOME} test printf "$1" 2>/dev/null export awk awk readonly -eu readonly
+	sed ${HOME} grep | 'quoted text' $(pwd) && sed then 'quoted text'
+		grep 'quoted text' "$1"
+	echo echo "$1" export && "$1" grep x=1
+	'quoted text' /usr/bin 'quoted text' readonly echo done
+		test then && "$@" done 2>/dev/null ${HOME}
+		"$@" then | && test $(pwd)
+	"$1" printf test sed cd test $(pwd) ${HOME} cd sed | "$1" local done /usr/bin
+2>/dev/null done /usr/bin cd then
+		x=1 "$@" 'quoted text' printf cd printf
+		printf && awk export | x=1 /usr/bin "$@" export ${HOME}
+sed then /usr/bin -eu export $(pwd) x=1 readonly "$1" awk 2>/dev/null
+		"$1" && -eu printf awk "$@" --verbose ${HOME} ${HOME} test done test | awk 'quoted text'
+/usr/bin done local then awk awk echo export $(pwd)
+		readonly x=1 | done -eu $(pwd) printf
+		${HOME} cd awk /usr/bin awk | | export && && "$@" | -eu grep then printf test
+		/usr/bin done -eu x=1 "$@" "$@" grep
+grep awk echo awk "$1" | grep "$1" "$1" done awk
+sed /usr/bin done "$@" test x=1 export readonly readonly done
+	export then ${HOME} x=1 -eu 'quoted text' 'quoted text' "$1"
+		"$@" echo local ${HOME} --verbose test readonly
+x=1 "$1" grep readonly readonly && | local 'quoted text'
+echo readonly --verbose 'quoted text' "$1" cd $(pwd) --verbose ${HOME} $(pwd)
+printf cd export ${HOME} test /usr/bin grep done
+		'quoted text' echo sed echo $(pwd) grep local sed | local $(pwd)
+	"$1" 'quoted text' sed readonly | awk
+sed | cd -eu 2>/dev/null printf echo ${HOME} test awk ${HOME} export
+echo echo "$@" printf then local printf "$@"
+| "$@" "$@" cd --verbose awk $(pwd) printf awk
+	then echo grep grep sed printf $(pwd) "$@"
+	-eu echo test sed readonly export 2>/dev/null export --verbose export
+		/usr/bin "$@" "$@" grep done readonly x=1 done cd && "$1" awk
+	awk 2>/dev/null "$1" local 'quoted text' && then awk "$@" cd
+		sed grep printf "$1" --verbose --verbose /usr/bin
+awk export echo --verbose done $(pwd) 2>/dev/null
+		done export readonly grep | done $(pwd) 2>/dev/null
+local cd -eu "$1" && test test
+done printf --verbose -eu --verbose awk "$1" cd "$1" awk | ${HOME}
+	done "$1" echo 2>/dev/null x=1 done grep done then readonly readonly ${HOME}
+then -eu $(pwd) && awk done printf --verbose echo printf $(pwd) local
+&& done export x=1 then awk sed local --verbose $(pwd) && 2>/dev/null
+	export && printf done | echo test grep then $(pwd) grep 'quoted text'
+		test echo printf 2>/dev/null cd
+	printf then local -eu x=1 then
+	test --verbose cd 'quoted text' export "$1" done echo ${HOME}
+	${HOME} then | export
+	printf | 'quoted text' printf /usr/bin echo local
+		test export cd sed "$@"
+		printf | "$@" -eu | --verbose
@@ -0,0 +1,2001 @@
+${HOME} "$@" sed --verbose -eu sed -eu sed 2>/dev/null 'quoted text'
+| echo -eu printf then -eu readonly sed "$1" $(pwd) test | awk "$1" export
+		local -eu readonly "$@" export then x=1 cd readonly
+	"$1" cd export --verbose done --verbose local printf export /usr/bin "$1" &&
+		local echo cd ${HOME} "$@" /usr/bin /usr/bin "$1" && awk /usr/bin cd "$@" grep
+	printf "$@" sed grep readonly ${HOME} printf done
+	awk | 'quoted text' x=1 "$@" "$1" ${HOME} readonly $(pwd)
+	test 'quoted text' -eu local 2>/dev/null -eu
+	-eu -eu printf | echo "$@" /usr/bin
+"$@" grep | then readonly $(pwd) 2>/dev/null 2>/dev/null readonly
+		grep done ${HOME} "$@" /usr/bin "$1" $(pwd) $(pwd) "$@" $(pwd) | then 2>/dev/null
+	awk "$1" export awk 2>/dev/null export echo ${HOME} sed -eu
+$(pwd) 2>/dev/null sed "$1" sed x=1 -eu /usr/bin awk --verbose "$@"
+	| && test 2>/dev/null export printf /usr/bin readonly /usr/bin "$@" awk "$@"
+	export sed local 'quoted text'
+&& 'quoted text' "$1" readonly 'quoted text' --verbose
+awk readonly awk awk x=1 ${HOME} --verbose sed awk done "$@" 2>/dev/null readonly
+	awk local | done 2>/dev/null grep 'quoted text' ${HOME} export /usr/bin
+export awk && echo readonly
+then echo sed -eu cd && sed &&
+	awk 2>/dev/null "$@" $(pwd) awk
+		x=1 grep export then "$1" ${HOME}
+test /usr/bin readonly grep && x=1 echo test done readonly awk local
+${HOME} local echo grep && && printf printf cd && -eu echo /usr/bin
+grep --verbose /usr/bin readonly && test echo done then
+export x=1 sed 'quoted text'
+	| 2>/dev/null printf "$1" "$1" $(pwd) /usr/bin "$@"
+	--verbose awk printf /usr/bin sed ${HOME} ${HOME} readonly grep local
+	cd echo echo /usr/bin "$1" done ${HOME} readonly readonly awk grep export "$1"
+		awk 2>/dev/null -eu readonly
+	printf x=1 printf grep x=1 "$1" done "$@" cd then && test
+	--verbose 'quoted text' local && && printf awk sed --verbose
+$(pwd) local | 'quoted text' printf 'quoted text' printf grep export test sed
+	| "$1" cd echo | local $(pwd) -eu && sed test 2>/dev/null printf && grep done
+		local /usr/bin "$1" x=1 cd printf awk $(pwd) test "$@" "$1" $(pwd) x=1 ${HOME}
+"$1" printf awk && readonly local
+	local readonly "$@" grep "$1" && -eu echo x=1
+${HOME} then echo | -eu grep $(pwd) $(pwd) then 2>/dev/null readonly
+	done 2>/dev/null -eu x=1 x=1 grep -eu -eu export | export
+		test cd 2>/dev/null 'quoted text' done awk $(pwd) ${HOME} done local && test ${HOME}
+	cd ${HOME} grep $(pwd) && --verbose printf
+	local x=1 $(pwd) export 2>/dev/null local --verbose "$@" $(pwd)
+		&& $(pwd) printf && $(pwd)
+"$@" x=1 2>/dev/null $(pwd) 'quoted text' -eu test && "$@"
+	local && test /usr/bin ${HOME} $(pwd) export /usr/bin "$1" awk
+	"$1" sed echo export printf export /usr/bin awk echo then && sed export cd
+	--verbose printf | && $(pwd) "$@" grep cd "$@" "$1" /usr/bin
+		done "$@" printf $(pwd)
+		'quoted text' readonly && "$@" done then ${HOME} && awk
+-eu grep local awk x=1
+${HOME} readonly --verbose /usr/bin 'quoted text' awk done
+		cd done sed 'quoted text' printf "$@" | "$@" /usr/bin "$1" ${HOME}
+		'quoted text' printf cd cd "$@" test
+		then sed export "$@" -eu 'quoted text' --verbose ${HOME} ${HOME} /usr/bin done
+	test 'quoted text' readonly | && &&
+	printf 'quoted text' "$@" x=1 $(pwd) 2>/dev/null sed 'quoted text'
+	2>/dev/null 'quoted text' done --verbose "$@" && local grep 'quoted text' ${HOME}
+		grep readonly then /usr/bin | 'quoted text' local "$@" /usr/bin awk
+awk && export "$1" "$1" -eu -eu 2>/dev/null cd --verbose x=1 2>/dev/null
+		echo --verbose x=1 cd /usr/bin export 2>/dev/null printf test /usr/bin
+		2>/dev/null ${HOME} then 2>/dev/null | cd grep test ${HOME}
+	&& then test printf 2>/dev/null test grep
+awk "$1" readonly sed 2>/dev/null
+		done done test awk $(pwd) /usr/bin ${HOME} 'quoted text'
+local done readonly $(pwd) --verbose
+	"$1" -eu --verbose export
+	test grep && && grep --verbose
+&& $(pwd) x=1 test cd cd echo
+awk "$1" sed awk grep grep readonly grep readonly readonly -eu export test
+test echo done local printf awk grep $(pwd) ${HOME}
+		test sed test x=1 'quoted text'
+		&& "$1" "$@" sed done done local done echo 2>/dev/null "$@"
+/usr/bin local echo -eu sed cd printf "$@" sed -eu awk 'quoted text'
+	cd then readonly /usr/bin printf export $(pwd) local -eu then ${HOME}
+printf x=1 && $(pwd) test test export && local then ${HOME} | printf readonly
+export /usr/bin local -eu -eu local then export "$@"
+	grep export readonly && $(pwd) cd awk echo printf
+		then 2>/dev/null export /usr/bin export | "$@" printf ${HOME} grep
+	readonly echo ${HOME} && sed then ${HOME}
+	x=1 readonly then echo --verbose 'quoted text' "$1" ${HOME}
+'quoted text' ${HOME} "$@" echo awk done -eu then echo
+		then export printf printf
+	${HOME} $(pwd) ${HOME} readonly "$1" cd --verbose local readonly ${HOME}
+export --verbose export 'quoted text' -eu export test
+	export | --verbose readonly export && then echo grep 'quoted text'
+		done -eu done local "$1" cd echo printf awk
+	grep "$@" cd 2>/dev/null echo
+		done cd -eu cd export
+		"$1" done export && test 2>/dev/null -eu echo then done
+	2>/dev/null awk then echo 'quoted text' x=1 -eu 2>/dev/null awk
+		/usr/bin cd local awk local /usr/bin then awk export "$@" $(pwd)
+x=1 --verbose 2>/dev/null awk && awk "$1" readonly 'quoted text' printf -eu
+	$(pwd) test awk then --verbose
+		done "$@" /usr/bin --verbose 2>/dev/null then /usr/bin -eu && test cd
+	x=1 echo 2>/dev/null 'quoted text' | export printf awk grep done cd &&
+		cd then echo && 'quoted text' printf /usr/bin
+x=1 cd done export printf test test x=1 printf local
+printf export | --verbose echo x=1 | 2>/dev/null sed 'quoted text'
+		--verbose test -eu ${HOME} --verbose grep x=1 sed
+&& | "$1" test && test then test "$1" $(pwd)
+		--verbose | readonly "$1" grep "$@" then
+	&& -eu cd echo x=1 grep printf ${HOME} -eu "$@" printf "$1" | export
+local && x=1 test done then done sed 2>/dev/null -eu export test
+then awk then test readonly then "$@" 'quoted text' "$1"
+'quoted text' awk "$@" then 2>/dev/null sed cd grep $(pwd) x=1
+	-eu printf "$1" done echo grep "$1" sed grep done done /usr/bin
+		'quoted text' && test echo then 'quoted text'
+		/usr/bin | $(pwd) -eu awk --verbose cd
+		x=1 --verbose local local local 'quoted text'
+	cd --verbose local echo sed awk sed local -eu
+		&& x=1 | test export $(pwd) export readonly cd then awk readonly
+2>/dev/null done 'quoted text' 'quoted text' awk ${HOME} 2>/dev/null grep
+		"$@" done test "$1" 2>/dev/null -eu export | && grep --verbose $(pwd)
+		"$@" readonly echo 'quoted text' local x=1 ${HOME} -eu test && --verbose 2>/dev/null
+		'quoted text' then grep printf /usr/bin "$1" grep then 'quoted text'
+x=1 2>/dev/null readonly "$1" export
+-eu test x=1 sed printf test echo "$@" awk test
+printf done --verbose ${HOME} --verbose --verbose 2>/dev/null
+		$(pwd) sed ${HOME} test export cd ${HOME} --verbose "$@" "$@" echo $(pwd)
+2>/dev/null echo 2>/dev/null x=1 then
+	awk export /usr/bin 'quoted text' /usr/bin $(pwd)
+		"$1" export 2>/dev/null printf | then test /usr/bin printf "$@" readonly
+done /usr/bin --verbose readonly awk
+	2>/dev/null "$1" done readonly /usr/bin $(pwd) --verbose "$1" test "$@"
+		/usr/bin "$1" $(pwd) | ${HOME} local done 2>/dev/null
+-eu "$1" awk -eu readonly /usr/bin /usr/bin then echo test && grep awk readonly
+		grep --verbose $(pwd) sed sed awk done $(pwd)
+	-eu printf --verbose local $(pwd) x=1 $(pwd) "$@" cd done test awk | grep
+	| ${HOME} cd sed test -eu echo && $(pwd) 'quoted text'
+	test echo x=1 ${HOME} "$@" awk 2>/dev/null ${HOME} -eu export awk ${HOME}
+		-eu local x=1 'quoted text' -eu --verbose x=1 ${HOME} --verbose ${HOME} 'quoted text'
+		cd grep x=1 x=1 && ${HOME} ${HOME} "$1"
+	awk awk | x=1 -eu local |
+	"$1" local --verbose then printf readonly && x=1
+	sed then x=1 printf | grep local /usr/bin readonly ${HOME} -eu cd export -eu
+	'quoted text' printf --verbose sed printf then && "$@" readonly readonly
+-eu readonly grep test ${HOME} sed
+cd grep test 'quoted text' awk --verbose
+		cd | cd then done "$@" done printf cd grep done readonly |
+$(pwd) readonly printf "$@" awk x=1 local echo done printf -eu local
+		local grep done --verbose -eu | x=1 'quoted text' 'quoted text' &&
+2>/dev/null sed then then cd grep "$1" awk | "$@" then 2>/dev/null
+		x=1 $(pwd) -eu awk && readonly awk $(pwd) then printf x=1 cd && "$1" awk test
+local /usr/bin 'quoted text' --verbose
+		export sed cd x=1 test --verbose --verbose
+	'quoted text' | then | grep cd
+	x=1 ${HOME} then readonly readonly done "$1" export
+cd grep --verbose done "$@" x=1 "$1" x=1 readonly sed && local 'quoted text'
+grep grep test 2>/dev/null awk "$1" "$@" "$1" ${HOME} 'quoted text' echo /usr/bin
+		grep printf 'quoted text' test --verbose "$1" | local grep echo then
+"$@" x=1 grep grep test export done -eu
+		"$1" readonly export | grep | "$1" ${HOME} awk awk
+		printf 2>/dev/null printf done /usr/bin 2>/dev/null grep grep cd
+test local $(pwd) then printf export ${HOME} local | $(pwd) awk ${HOME}
+		'quoted text' 'quoted text' "$@" "$1" | /usr/bin 'quoted text' "$1" local
+	2>/dev/null done --verbose | | $(pwd) | "$1" then /usr/bin
+		| "$@" -eu printf readonly ${HOME} "$@" "$@" awk sed x=1 sed
+		"$1" cd "$1" 'quoted text' -eu ${HOME} printf ${HOME} cd then grep
+		cd && | "$1" cd printf "$1" x=1 printf
+	| grep export ${HOME} "$@" "$1" awk --verbose then "$1" x=1 "$@"
+		then test grep test -eu printf $(pwd) then ${HOME} test export readonly ${HOME}
+		echo "$@" --verbose done
+	${HOME} awk x=1 test "$@" sed printf readonly awk cd /usr/bin
+&& echo grep sed 'quoted text' awk done readonly readonly x=1
+	'quoted text' readonly cd $(pwd) then grep sed echo
+	echo 2>/dev/null x=1 'quoted text' local export | test cd echo readonly awk "$@"
+		test && x=1 grep then local then export $(pwd) cd
+	echo awk local sed sed test -eu ${HOME} "$@" grep
+	then "$1" then printf local done local | cd /usr/bin /usr/bin /usr/bin x=1 'quoted text'
+"$@" "$@" "$@" readonly -eu sed
+	x=1 && printf test $(pwd) echo $(pwd) awk echo local
+		/usr/bin done done x=1 then local x=1 export done cd cd awk 2>/dev/null
+		readonly grep $(pwd) && x=1 | | x=1 $(pwd) printf "$@"
+done then test -eu echo awk awk sed | done done 'quoted text'
+		&& grep 'quoted text' "$@" -eu $(pwd)
+		"$1" --verbose printf local sed export test ${HOME} 'quoted text'
+	&& awk 2>/dev/null sed sed ${HOME} done ${HOME} && 2>/dev/null done
+printf grep --verbose 'quoted text'
+	grep local test export echo "$1" | 2>/dev/null --verbose 'quoted text'
+		2>/dev/null 2>/dev/null $(pwd) "$@" test cd export 2>/dev/null "$1"
+		readonly && done readonly 'quoted text'
+	"$@" cd "$@" "$1" readonly readonly
+--verbose export && /usr/bin ${HOME} cd x=1
+		export 2>/dev/null readonly | "$@" export done 'quoted text'
+		awk 'quoted text' 2>/dev/null printf ${HOME} 'quoted text' readonly &&
+		2>/dev/null awk then -eu sed local | /usr/bin printf "$@" /usr/bin
+		x=1 export $(pwd) ${HOME} cd printf | test
+	awk "$@" "$@" export printf cd done x=1
+	| /usr/bin then -eu 2>/dev/null awk ${HOME}
+/usr/bin readonly -eu ${HOME} grep "$1" awk -eu done awk "$1" 'quoted text' sed
+	"$@" x=1 2>/dev/null "$@"
+	"$1" "$1" x=1 'quoted text' awk -eu "$@" && printf echo
+local cd "$1" 'quoted text' sed 'quoted text' sed export
+	grep readonly done $(pwd) grep 2>/dev/null printf
+		local "$1" $(pwd) "$1" 'quoted text'
+awk awk 'quoted text' && "$@" printf "$@" grep grep | -eu 2>/dev/null |
+	then cd 2>/dev/null done sed x=1 /usr/bin -eu
+	done && 2>/dev/null printf then grep readonly ${HOME} cd | | --verbose cd grep
+	printf local test echo "$@" 2>/dev/null x=1 x=1 "$@" test local -eu test
+grep grep "$1" echo awk "$1" done 'quoted text' 2>/dev/null sed $(pwd) sed
+printf -eu "$@" sed cd "$1" 'quoted text' then
+		cd sed printf awk grep printf echo grep -eu "$@" -eu 'quoted text'
+	&& 2>/dev/null $(pwd) cd 'quoted text'
+grep echo sed "$@" then done readonly then test cd
+--verbose -eu && echo printf
+x=1 "$1" && && 2>/dev/null $(pwd) then 'quoted text' && | 2>/dev/null
+	then cd "$@" /usr/bin | sed printf
+done && "$@" $(pwd) export done awk &&
+	done 2>/dev/null -eu "$1" -eu then local grep "$@"
+		grep test x=1 && done | printf -eu grep cd $(pwd) echo grep export 'quoted text'
+		printf done printf readonly cd readonly awk
+readonly done cd awk $(pwd)
+	export -eu sed | export /usr/bin export readonly
+-eu 'quoted text' cd && printf
+2>/dev/null export && $(pwd) 'quoted text' echo /usr/bin printf
+		| local readonly export grep ${HOME}
+'quoted text' then awk local "$1" done done "$@" done export "$@" readonly awk
+		cd /usr/bin /usr/bin grep $(pwd) readonly done | 'quoted text'
+	2>/dev/null awk local awk $(pwd)
+readonly local printf echo 'quoted text' "$@" sed local "$@" sed
+		awk && printf sed then grep && 'quoted text'
+	/usr/bin export && "$1" export done cd /usr/bin
+	cd 'quoted text' --verbose "$1" awk local then cd |
+awk printf "$1" | --verbose readonly then 2>/dev/null
+	export sed grep --verbose /usr/bin cd done cd test | done x=1 x=1 then -eu
+	$(pwd) cd readonly | && local $(pwd) grep -eu | 2>/dev/null test cd &&
+		/usr/bin 'quoted text' sed grep | export cd -eu
+	grep /usr/bin then 2>/dev/null local done 'quoted text' echo export
+export local $(pwd) awk x=1 awk done
+${HOME} && local readonly grep grep 2>/dev/null
+	2>/dev/null grep ${HOME} x=1 --verbose cd test printf $(pwd) /usr/bin "$@" cd export
+		done export test readonly -eu local done -eu printf
+'quoted text' printf then sed printf && x=1 | --verbose done sed then
+		--verbose && ${HOME} cd cd | "$1"
+		$(pwd) export grep ${HOME} cd --verbose awk cd ${HOME} echo cd
+		grep $(pwd) ${HOME} -eu $(pwd) done export ${HOME} | grep --verbose local done
+		cd test /usr/bin /usr/bin cd && -eu
+		then /usr/bin 2>/dev/null local | cd then ${HOME} test
+then 2>/dev/null "$@" /usr/bin test echo local printf done
+-eu readonly sed 'quoted text'
+		x=1 echo test test printf export awk ${HOME} -eu "$1" sed test readonly | export
+export cd --verbose --verbose ${HOME}
+${HOME} awk 2>/dev/null 2>/dev/null
+		'quoted text' ${HOME} local x=1 cd ${HOME}
+printf readonly awk -eu /usr/bin && local grep $(pwd)
+	cd /usr/bin 2>/dev/null "$@" grep 2>/dev/null
+	${HOME} "$1" x=1 readonly export -eu 'quoted text'
+		'quoted text' grep export cd $(pwd) readonly && x=1 grep local
+		local then 2>/dev/null 'quoted text' -eu printf sed 2>/dev/null
+"$1" -eu $(pwd) test then ${HOME} | | grep printf $(pwd) test cd
+	awk "$1" -eu test /usr/bin echo x=1
+		readonly echo then test grep awk awk "$1" local 'quoted text' cd
+		"$@" cd 'quoted text' && "$1" awk readonly && --verbose
+	awk "$@" awk /usr/bin 'quoted text' "$1" cd && awk $(pwd) ${HOME}
+then -eu 2>/dev/null then 2>/dev/null x=1 && readonly test awk | echo cd awk echo
+		then /usr/bin x=1 readonly ${HOME}
+		cd echo "$@" x=1 test "$1" cd | 2>/dev/null export cd sed x=1 test ${HOME}
+		then sed --verbose | local grep sed | /usr/bin | then x=1 local done
+		x=1 export $(pwd) cd x=1 --verbose ${HOME}
+	x=1 2>/dev/null /usr/bin |
+"$1" echo 'quoted text' awk /usr/bin sed x=1 | && sed local echo 'quoted text'
+export sed grep test echo done export /usr/bin awk "$@" -eu test
+'quoted text' /usr/bin && test 2>/dev/null export export ${HOME} 'quoted text'
+		x=1 local sed $(pwd) 'quoted text' awk test && "$@"
+	-eu echo /usr/bin --verbose
+		test && grep grep /usr/bin readonly -eu -eu && 2>/dev/null then local done
+printf done | export readonly printf
+grep "$@" grep awk test grep x=1 "$@"
+		awk -eu && "$1" awk /usr/bin local 'quoted text' then sed 'quoted text'
+'quoted text' | | ${HOME} 'quoted text' done &&
+sed "$@" cd export | "$@"
+--verbose x=1 cd done 'quoted text' /usr/bin
+		'quoted text' then --verbose
+	--verbose $(pwd) then grep 2>/dev/null local awk
+	sed sed "$@" sed --verbose $(pwd) --verbose echo printf grep
+	$(pwd) sed readonly "$@" done cd then then sed "$1" | local && readonly /usr/bin
+		$(pwd) /usr/bin grep cd done $(pwd) then 'quoted text'
+		export 2>/dev/null cd 'quoted text'
+export "$@" cd --verbose | awk "$@" test /usr/bin 2>/dev/null readonly
+		test "$1" local cd readonly sed readonly "$1" 2>/dev/null
+	'quoted text' cd -eu --verbose "$@" "$@" && --verbose cd echo ${HOME}
+	&& local --verbose ${HOME} && | --verbose cd "$1" test printf awk
+		local export | --verbose && printf | grep 2>/dev/null
+		--verbose readonly --verbose local
+		printf grep sed "$@" "$@" | /usr/bin x=1
+		"$1" sed sed 'quoted text' grep cd echo printf awk x=1 ${HOME} "$@"
+		| export cd && $(pwd) && /usr/bin "$1" 2>/dev/null readonly -eu -eu
+	export grep && local done
+	echo /usr/bin awk $(pwd) local "$@" $(pwd) grep
+/usr/bin | local done readonly "$1" awk
+"$@" printf grep | -eu
+		2>/dev/null cd sed grep done awk && cd local && ${HOME} && -eu && -eu |
+		test printf "$1" && sed && awk echo then 2>/dev/null awk "$@" x=1 x=1 test $(pwd)
+	&& readonly echo then /usr/bin done cd
+export 'quoted text' 2>/dev/null
+	export sed done echo
+grep "$1" cd cd ${HOME} && /usr/bin --verbose then cd -eu sed ${HOME} export
+&& export echo ${HOME} /usr/bin
+		export test | 'quoted text' then 2>/dev/null
+printf --verbose ${HOME} local test awk "$1" grep awk
+		| readonly done x=1 echo awk readonly 2>/dev/null grep done ${HOME} /usr/bin grep
+	cd export $(pwd) -eu echo printf ${HOME} x=1 -eu -eu "$@" grep
+	$(pwd) ${HOME} x=1 2>/dev/null
+		printf cd local sed sed export --verbose "$1" "$1" grep x=1 'quoted text'
+&& local sed -eu /usr/bin /usr/bin export local
+2>/dev/null | "$1" export 2>/dev/null local grep "$1" awk -eu done export &&
+	2>/dev/null x=1 done && "$@" "$1" cd printf ${HOME} grep 2>/dev/null && done
+	| printf local grep done /usr/bin local $(pwd) "$@" grep
+	printf readonly 'quoted text'
+grep grep ${HOME} /usr/bin awk done 'quoted text' local "$@" awk "$@"
+"$@" && | 'quoted text' -eu && 2>/dev/null readonly then && ${HOME}
+	sed export cd cd local awk printf --verbose
+		2>/dev/null && "$1" printf
+done $(pwd) echo local awk test sed export test then 2>/dev/null
+		/usr/bin echo && sed 'quoted text' "$1" ${HOME} 2>/dev/null grep /usr/bin readonly
+	x=1 --verbose awk local -eu x=1 export 'quoted text' then | awk
+	/usr/bin grep | -eu then 'quoted text'
+		awk ${HOME} cd echo sed export awk --verbose sed ${HOME} grep grep 2>/dev/null
+	awk test "$1" cd echo -eu 'quoted text' | done awk
+	test sed awk export echo --verbose "$1" 2>/dev/null /usr/bin
+		then readonly cd export "$1" test done done
+		printf echo $(pwd) 'quoted text'
+sed printf "$1" | --verbose "$@" --verbose $(pwd) grep 'quoted text' "$@" printf
+		export echo test "$@" readonly
+	'quoted text' 2>/dev/null readonly $(pwd) cd ${HOME} 2>/dev/null | && test echo
+		/usr/bin readonly then then cd export
+		x=1 sed -eu then --verbose grep 'quoted text'
+'quoted text' sed grep x=1 cd "$1" cd readonly
+	x=1 -eu && echo --verbose awk awk "$@" ${HOME} && $(pwd) export then
+export --verbose ${HOME} "$1" -eu | /usr/bin
+		readonly done sed test echo done local local --verbose then
+		&& printf "$1" done cd -eu "$@" local x=1
+	x=1 && local cd done --verbose sed grep --verbose --verbose awk awk
+		grep "$@" done x=1 /usr/bin 2>/dev/null
+cd grep 2>/dev/null awk then cd local /usr/bin 2>/dev/null local
+		sed awk readonly && awk "$@"
+local echo grep awk local sed $(pwd) test $(pwd) --verbose |
+	grep local 'quoted text' sed && sed grep "$@" test
+	2>/dev/null 2>/dev/null
+	$(pwd) /usr/bin export printf --verbose grep awk -eu
+	awk export test test 'quoted text' export cd
+/usr/bin ${HOME} x=1 $(pwd) awk readonly then grep then
+local echo 2>/dev/null done 2>/dev/null grep
+	then sed sed /usr/bin | done local x=1 2>/dev/null | grep 2>/dev/null
+	readonly | echo awk "$@" export "$1" export "$1"
+		echo sed | "$1" | -eu /usr/bin readonly cd
+then cd done 'quoted text' | --verbose
+		$(pwd) $(pwd) printf "$1" test cd awk cd awk done
+'quoted text' /usr/bin done ${HOME} |
+	cd printf readonly readonly "$1" | 2>/dev/null
+	--verbose "$1" 'quoted text'
+local "$1" --verbose awk awk done grep x=1 readonly
+&& -eu 2>/dev/null "$@" /usr/bin && | sed cd done grep printf -eu
+		'quoted text' x=1 'quoted text'
+		/usr/bin --verbose test "$@" grep | done readonly "$@" echo "$@" cd readonly &&
+$(pwd) printf local --verbose $(pwd) sed awk x=1 readonly
+'quoted text' test grep
+		'quoted text' "$1" local echo ${HOME}
+	x=1 $(pwd) && printf && readonly done sed | --verbose --verbose "$1"
+		test "$@" done -eu "$@" export "$@" local done sed printf done test echo
+	sed export local local x=1 cd grep "$@"
+		"$@" 2>/dev/null test printf && echo -eu | ${HOME} local echo
+	-eu export && && printf $(pwd) ${HOME}
+awk --verbose /usr/bin grep test
+		${HOME} export cd cd $(pwd) | 'quoted text' local "$1" | awk readonly local
+2>/dev/null && --verbose awk cd
+		grep --verbose test -eu && then x=1 test "$1" awk readonly
+| printf then readonly | export readonly 2>/dev/null && grep grep
+local $(pwd) && local -eu ${HOME} then 2>/dev/null "$1"
+		"$@" grep then done --verbose
+cd 'quoted text' then
+printf awk $(pwd) /usr/bin 'quoted text' test
+	then ${HOME} | 'quoted text' grep then echo ${HOME} export 'quoted text' -eu --verbose
+test "$@" -eu local readonly readonly x=1 echo sed
+		'quoted text' local local && export && && "$@" 'quoted text' local printf
+echo ${HOME} $(pwd) -eu "$1" then 2>/dev/null cd done cd cd x=1 ${HOME} awk
+		&& 'quoted text' "$@" -eu done test "$@" local "$1" | cd printf 2>/dev/null
+		echo printf "$1" cd 2>/dev/null awk grep
+	"$1" cd export x=1 --verbose
+export ${HOME} test --verbose sed x=1 echo echo x=1 $(pwd)
+		test echo printf --verbose 2>/dev/null $(pwd) test 'quoted text' 2>/dev/null
+"$1" test --verbose 2>/dev/null local /usr/bin cd printf
+'quoted text' export "$@"
+	test awk echo echo grep export
+local && $(pwd) export 'quoted text' -eu readonly ${HOME} awk
+grep printf export echo printf "$1" local
+	--verbose awk grep --verbose grep ${HOME} -eu printf "$1" test
+sed x=1 2>/dev/null && --verbose 2>/dev/null printf 2>/dev/null -eu then
+		printf "$1" $(pwd) | then printf -eu test x=1 export then export cd local
+	| grep printf cd cd x=1 'quoted text' | x=1 ${HOME}
+		echo x=1 done x=1 echo echo readonly -eu
+--verbose test then readonly
+		awk 2>/dev/null "$1" then -eu 'quoted text' 2>/dev/null "$@" /usr/bin done
+	echo --verbose readonly test export --verbose x=1 grep local $(pwd) --verbose sed
+2>/dev/null 'quoted text' -eu sed /usr/bin /usr/bin cd --verbose
+test $(pwd) printf local then 'quoted text' "$@" /usr/bin 2>/dev/null
+	local echo readonly done echo ${HOME}
+	&& ${HOME} x=1 $(pwd) awk echo echo readonly grep done
+	test grep -eu done "$1" then -eu echo /usr/bin then --verbose "$@" 'quoted text'
+awk grep readonly export sed $(pwd) 2>/dev/null
+		done grep -eu echo 'quoted text' 'quoted text' then export $(pwd)
+/usr/bin grep && awk $(pwd) && $(pwd) /usr/bin
+		printf /usr/bin && --verbose readonly sed 2>/dev/null grep 2>/dev/null
+	done "$1" x=1 cd "$1" -eu
+		readonly printf $(pwd)
+		sed --verbose cd --verbose "$1" done "$@" x=1 -eu printf --verbose
+	/usr/bin test "$@" "$1" $(pwd) echo /usr/bin test
+$(pwd) && x=1 "$@" | awk echo 2>/dev/null test --verbose then printf ${HOME}
+	$(pwd) local export done local ${HOME} 2>/dev/null 'quoted text'
+&& $(pwd) cd x=1 sed x=1 && x=1 export
+	readonly then "$1" sed $(pwd)
+		printf -eu "$@" -eu awk grep grep readonly
+	export sed "$1" grep readonly "$@" 2>/dev/null
+	export "$1" sed echo "$1" --verbose sed /usr/bin
+/usr/bin grep readonly "$@" echo done grep
+		export done then echo cd awk test
+		"$@" && | cd done echo local "$@" ${HOME} printf "$@" | echo | awk sed -eu ${HOME}
+	export then --verbose echo /usr/bin x=1 2>/dev/null "$@" grep awk grep
+		2>/dev/null test local $(pwd) -eu 'quoted text' /usr/bin "$@" export
+	awk export "$@" grep done printf 2>/dev/null ${HOME} echo "$@" grep &&
+		awk done printf 'quoted text' done | grep -eu $(pwd) --verbose grep readonly
+		${HOME} $(pwd) grep -eu done 'quoted text'
+2>/dev/null 'quoted text'
+		then 2>/dev/null 'quoted text' done
+		test --verbose printf readonly
+		local x=1 /usr/bin $(pwd) awk local | test export
+	local done readonly 'quoted text' printf awk $(pwd) ${HOME} awk 2>/dev/null cd
+	x=1 local 'quoted text' 2>/dev/null $(pwd) --verbose done readonly done then &&
+	done printf test ${HOME} ${HOME} 2>/dev/null
+	awk printf "$1" && "$@" $(pwd) local "$1" "$1"
+"$@" 'quoted text' sed export /usr/bin echo cd export "$@" awk x=1 /usr/bin
+		then /usr/bin awk local echo grep "$1" 'quoted text'
+	2>/dev/null ${HOME} sed --verbose
+x=1 sed echo $(pwd) 'quoted text'
+done ${HOME} export done 2>/dev/null
+		then local local then x=1 sed test 'quoted text' && echo
+		local "$1" cd "$@" test test -eu --verbose printf 2>/dev/null cd --verbose
+		echo test /usr/bin grep grep sed
+sed cd cd awk test export /usr/bin 'quoted text' export -eu test readonly &&
+--verbose 2>/dev/null printf -eu "$1" local "$1" sed x=1 cd | local
+cd $(pwd) test --verbose export
+		printf x=1 -eu local grep
+		"$1" local 2>/dev/null ${HOME} export then "$@" then
+	${HOME} 2>/dev/null 2>/dev/null done then local printf $(pwd)
+local printf local cd 2>/dev/null export "$1" $(pwd) x=1 --verbose
+	export grep | x=1 test readonly cd "$1" --verbose | export
+${HOME} 'quoted text' readonly /usr/bin cd
+local cd export cd test /usr/bin printf printf awk echo grep
+	x=1 && echo | sed test cd | test 'quoted text' | readonly "$@" echo -eu | "$1"
+echo awk export printf $(pwd) test
+		"$@" 'quoted text' 2>/dev/null printf readonly x=1 && --verbose grep
+	test sed printf 'quoted text' then local export
+&& x=1 "$@" | then 'quoted text'
+-eu local $(pwd) then done done local 2>/dev/null 2>/dev/null
+	echo | echo ${HOME} sed x=1
+awk x=1 -eu 2>/dev/null printf $(pwd)
+		-eu done cd --verbose "$@" --verbose /usr/bin printf 'quoted text' awk 'quoted text'
+		done x=1 grep 'quoted text' "$1" /usr/bin done ${HOME} sed grep && test local
+		cd echo local 2>/dev/null awk x=1 local /usr/bin --verbose
+export 2>/dev/null x=1 echo $(pwd) then cd awk
+		&& -eu awk export /usr/bin test ${HOME} export then done /usr/bin
+	/usr/bin echo then "$@" "$@" cd test
+grep echo readonly printf --verbose export then local
+	$(pwd) "$1" --verbose sed echo
+	test $(pwd) test export && printf /usr/bin awk local -eu done
+	local readonly local ${HOME} $(pwd) /usr/bin
+		"$@" ${HOME} -eu then && grep awk $(pwd) awk printf $(pwd) "$@" echo cd grep
+	$(pwd) "$@" && x=1 then 2>/dev/null 2>/dev/null && readonly
+		&& readonly | grep | done -eu sed test grep cd sed then &&
+		readonly echo ${HOME} printf done done | "$@" "$@"
+	echo done awk grep "$1" "$1" x=1 && sed 2>/dev/null
+grep export grep sed /usr/bin awk echo then sed test echo -eu /usr/bin
+		'quoted text' ${HOME} test "$1" 'quoted text' sed $(pwd) --verbose ${HOME}
+	echo | 'quoted text' x=1 -eu readonly --verbose
+		local 'quoted text' 2>/dev/null done done ${HOME}
+		"$@" "$@" test ${HOME} && 2>/dev/null ${HOME} | then
+		"$1" readonly 2>/dev/null -eu export awk then
+&& done printf "$@" cd sed --verbose /usr/bin
+	/usr/bin "$@" test readonly echo
+	/usr/bin ${HOME} cd then "$@" -eu grep done "$1" local awk
+		--verbose local ${HOME} ${HOME} echo $(pwd)
+		cd cd && done grep echo
+		test export export x=1 export grep
+'quoted text' && local readonly x=1 "$@" export
+	--verbose 'quoted text' -eu then "$@"
+	echo 2>/dev/null | ${HOME} "$@" /usr/bin
+2>/dev/null -eu x=1 done readonly /usr/bin --verbose local 'quoted text' $(pwd)
+${HOME} && 'quoted text' "$@" grep then printf && echo grep export
+	readonly 'quoted text' --verbose
+done /usr/bin ${HOME} && "$@" "$@" | -eu then ${HOME} then
+	"$@" | sed printf | then ${HOME} 2>/dev/null "$1" "$@" readonly
+	local readonly test test then
+'quoted text' -eu 'quoted text' /usr/bin echo test grep "$1" grep "$@"
+		awk "$@" sed x=1 done 2>/dev/null then
+| && export printf --verbose $(pwd) | export then $(pwd) && 'quoted text'
+		&& | test | echo 'quoted text' "$1" /usr/bin done 2>/dev/null
+	readonly printf $(pwd) /usr/bin awk grep sed x=1 x=1 local ${HOME} "$1" "$@" 'quoted text'
+		2>/dev/null local grep test "$1" export test $(pwd) /usr/bin 2>/dev/null
+"$1" "$@" -eu 'quoted text'
+x=1 2>/dev/null ${HOME} awk
+		printf test /usr/bin sed ${HOME} grep sed x=1 done export grep test grep
+-eu cd test test && test 'quoted text' sed 2>/dev/null local grep sed /usr/bin
+	x=1 "$@" printf awk 2>/dev/null sed 'quoted text' 'quoted text'
+	printf -eu && local | awk export readonly awk done 'quoted text'
+		$(pwd) "$1" ${HOME} --verbose x=1 x=1 2>/dev/null test "$1" 'quoted text'
+'quoted text' -eu printf then "$1" | && printf $(pwd) grep export
+	/usr/bin && $(pwd) cd readonly 'quoted text' printf ${HOME} /usr/bin -eu
+	awk local export $(pwd) --verbose
+	x=1 ${HOME} $(pwd) echo local | printf $(pwd) echo export
+/usr/bin local 'quoted text' ${HOME} awk $(pwd) done echo ${HOME}
+	cd 'quoted text' echo ${HOME} "$1" $(pwd) && "$1" done -eu local "$@"
+export printf echo "$1" done cd
+2>/dev/null cd readonly then awk echo echo
+	grep test readonly "$1" --verbose 'quoted text' | 'quoted text' readonly ${HOME}
+	"$@" then 'quoted text' 2>/dev/null "$@" awk /usr/bin /usr/bin && local
+	$(pwd) printf "$@" printf -eu /usr/bin
+		-eu && readonly then cd && 2>/dev/null sed "$1" /usr/bin
+x=1 --verbose x=1 /usr/bin x=1 awk echo done cd --verbose
+x=1 /usr/bin done cd test done then readonly "$1" -eu
+		&& then done "$@" x=1 2>/dev/null printf awk
+		then 2>/dev/null /usr/bin "$1" printf 2>/dev/null -eu
+	/usr/bin grep /usr/bin 'quoted text' echo $(pwd) $(pwd) local then -eu awk x=1
+		/usr/bin awk $(pwd) /usr/bin | && awk printf
+	"$@" x=1 --verbose ${HOME}
+	"$@" /usr/bin readonly && local -eu | sed test -eu
+printf 2>/dev/null "$@" ${HOME} done cd
+	"$1" | --verbose | -eu $(pwd) 2>/dev/null done grep then -eu -eu done
+	echo | ${HOME} printf grep $(pwd) done 'quoted text' grep test sed
+	-eu awk | ${HOME} cd x=1 printf readonly 2>/dev/null printf export cd then
+		${HOME} ${HOME} then 2>/dev/null
+	local -eu printf "$1" --verbose ${HOME} printf sed && grep grep "$@" -eu
+export 'quoted text' awk test $(pwd) cd
+		&& cd export echo x=1 then ${HOME} 'quoted text'
+		/usr/bin local "$1" echo &&
+${HOME} -eu readonly export "$1" grep test local $(pwd) awk && -eu sed cd | export
+		$(pwd) then "$@" --verbose grep x=1 test /usr/bin x=1 readonly x=1
+		"$@" $(pwd) local export $(pwd) test test $(pwd) grep -eu /usr/bin
+"$1" sed 2>/dev/null $(pwd) | -eu | echo done 'quoted text'
+	done 2>/dev/null 2>/dev/null local
+		${HOME} 'quoted text' printf export echo
+	"$@" local export 2>/dev/null 'quoted text' local readonly grep
+"$1" then -eu done 2>/dev/null "$1" $(pwd) awk readonly --verbose "$1"
+		export sed | 'quoted text' sed test readonly
+"$1" 2>/dev/null test awk | | echo --verbose | --verbose | awk x=1
+&& readonly awk awk readonly grep /usr/bin export export cd cd x=1 cd x=1 "$1"
+	&& readonly && 'quoted text' /usr/bin 'quoted text' sed
+	grep echo then sed export then local | -eu echo ${HOME} test readonly ${HOME}
+	awk 'quoted text' done 2>/dev/null
+	${HOME} --verbose sed local /usr/bin /usr/bin x=1 "$1" /usr/bin
+grep /usr/bin grep local echo grep x=1 ${HOME} local x=1 'quoted text' sed "$1"
+		${HOME} readonly awk test $(pwd) "$1" sed $(pwd)
+	sed /usr/bin ${HOME} printf | "$@" "$@" $(pwd)
+		done test grep local cd test x=1 "$@" then $(pwd) ${HOME}
+	test printf sed /usr/bin "$1"
+		then printf done "$@" -eu
+		| done grep grep /usr/bin x=1 "$1"
+	&& $(pwd) $(pwd) then
+	readonly | 2>/dev/null --verbose 'quoted text' && echo "$@" export export
+	awk done awk local -eu grep
+		readonly readonly 2>/dev/null test printf "$@" -eu test --verbose
+	local $(pwd) sed | awk readonly done
+	"$@" readonly -eu /usr/bin /usr/bin 2>/dev/null done /usr/bin
+export echo ${HOME} test "$1" grep x=1 -eu printf | done
+		${HOME} awk -eu "$1" awk "$1" grep && export
+		2>/dev/null x=1 awk ${HOME} cd cd export sed export 'quoted text'
+$(pwd) 'quoted text' x=1 && "$1" "$1" -eu local 'quoted text' "$1" ${HOME}
+	done | sed $(pwd) 'quoted text' printf "$1" --verbose | echo -eu "$1" && awk "$1"
+		echo export local local done printf --verbose "$@" 'quoted text'
+	--verbose local local then local "$1" "$@" local "$@" "$@" && "$1"
+		cd && | x=1 then -eu awk
+$(pwd) && x=1 awk "$@" "$@" printf test x=1 $(pwd) --verbose
+$(pwd) --verbose export -eu | 'quoted text'
+		sed printf readonly | 2>/dev/null 'quoted text'
+	"$1" -eu sed awk export cd done | 2>/dev/null local local 2>/dev/null export
+	echo test awk then $(pwd) 'quoted text' export
+	done $(pwd) ${HOME} cd then awk --verbose local export 'quoted text'
+"$1" /usr/bin 'quoted text' x=1
+2>/dev/null /usr/bin test --verbose --verbose export grep local
+--verbose then sed local readonly | grep then $(pwd) && test
+		-eu "$1" echo awk && echo awk $(pwd) echo "$1" echo awk printf
+		sed 'quoted text' $(pwd) done
+	-eu | $(pwd) && export -eu
+		test x=1 then | --verbose 'quoted text' /usr/bin sed grep /usr/bin
+awk grep /usr/bin printf x=1 --verbose --verbose && && 2>/dev/null echo done
+	'quoted text' | x=1 awk cd awk printf
+		-eu grep sed ${HOME} cd cd sed /usr/bin 2>/dev/null
+	done grep --verbose done readonly sed "$1" local then x=1
+echo grep done $(pwd) awk x=1 "$@" "$1" test grep awk awk awk readonly
+grep sed --verbose done "$@" 2>/dev/null done --verbose $(pwd) export
+		grep local "$1" printf readonly
+awk sed | test $(pwd) ${HOME} done sed "$@" -eu
+	local grep && /usr/bin -eu export printf
+	grep sed readonly readonly x=1 -eu done x=1 ${HOME} /usr/bin -eu 2>/dev/null cd
+| 'quoted text' 'quoted text' ${HOME} local export then /usr/bin cd readonly
+	awk "$1" 'quoted text' ${HOME} awk x=1 then 'quoted text'
+	echo sed -eu grep "$@" cd /usr/bin ${HOME} local "$1" /usr/bin 2>/dev/null $(pwd)
+'quoted text' local "$@" $(pwd) local sed && readonly export | --verbose --verbose
+	awk done -eu && local cd | printf done
+	done export test local 'quoted text' --verbose sed then x=1 done --verbose cd --verbose
+	test local $(pwd) test | cd && "$1" ${HOME} -eu then test
+| "$1" "$1" && x=1 grep local ${HOME} && readonly && --verbose
+local test local test | awk done
+		x=1 test sed 2>/dev/null | | "$1" $(pwd) then then
+${HOME} -eu x=1 ${HOME} sed | cd /usr/bin 'quoted text' 2>/dev/null
+	done && local grep ${HOME} "$@" grep $(pwd)
+		"$1" then -eu "$1" done ${HOME} grep 2>/dev/null sed
+	| done "$1" done ${HOME} | printf test
+	| 'quoted text' readonly awk 'quoted text' cd grep /usr/bin ${HOME} sed cd cd
+		--verbose grep && x=1 'quoted text' then readonly cd "$@" | sed readonly
+		readonly && local && -eu $(pwd) 'quoted text' -eu sed &&
+	grep sed "$1" grep 2>/dev/null /usr/bin x=1 readonly && sed grep
+&& grep readonly cd "$@" "$@" x=1 done -eu export
+	local /usr/bin && | --verbose readonly | printf ${HOME}
+		then -eu test 2>/dev/null 2>/dev/null export --verbose /usr/bin sed done grep sed
+	&& done then /usr/bin ${HOME} -eu 2>/dev/null x=1 echo export
+-eu printf grep 2>/dev/null readonly sed awk grep export "$@"
+/usr/bin --verbose cd /usr/bin 'quoted text' 2>/dev/null "$1"
+/usr/bin && 'quoted text' ${HOME}
+		then cd $(pwd) --verbose -eu done --verbose grep
+	readonly /usr/bin -eu x=1 local cd cd ${HOME} /usr/bin test $(pwd) /usr/bin
+		2>/dev/null ${HOME} then | x=1
+		cd export readonly test "$@" test then /usr/bin 2>/dev/null -eu -eu /usr/bin "$@"
+		${HOME} printf --verbose /usr/bin readonly "$1" test then sed
+echo local $(pwd) --verbose export
+		echo awk grep then -eu readonly printf "$1" | echo
+	"$@" 'quoted text' test "$1" export sed
+	x=1 && | export export awk echo grep echo x=1 2>/dev/null ${HOME}
+	printf grep test echo $(pwd) && done awk cd done ${HOME} --verbose
+	x=1 --verbose sed -eu done 2>/dev/null -eu 2>/dev/null sed printf
+	"$1" "$@" local readonly
+awk test local sed $(pwd) sed 'quoted text' "$1" sed test
+done then sed --verbose then x=1 sed && x=1
+		export && grep then done /usr/bin ${HOME} x=1
+"$@" | /usr/bin /usr/bin awk | "$1"
+2>/dev/null "$1" x=1 readonly export grep
+	'quoted text' ${HOME} ${HOME} x=1 /usr/bin grep cd test printf "$1" echo --verbose
+		| --verbose $(pwd) /usr/bin x=1 local $(pwd) -eu printf "$@" done
+	$(pwd) then --verbose done x=1 && echo 'quoted text' && awk test
+		$(pwd) then "$@" 2>/dev/null then | echo awk 'quoted text' -eu export
+-eu test ${HOME} "$@" -eu
+sed x=1 export done printf cd $(pwd)
+		echo export echo 'quoted text' 2>/dev/null
+		local $(pwd) $(pwd) then 2>/dev/null
+		/usr/bin echo printf 'quoted text' local readonly local
+-eu --verbose echo 2>/dev/null 2>/dev/null 'quoted text' "$@" x=1
+	test local local awk -eu cd local grep export readonly -eu 2>/dev/null
+	printf grep /usr/bin $(pwd) && then local "$1" | -eu then local
+	test readonly 'quoted text'
+	${HOME} sed /usr/bin test | "$@" -eu local cd /usr/bin
+		awk export grep printf
+$(pwd) 'quoted text' && readonly local done done && awk ${HOME}
+"$1" sed $(pwd) && | cd -eu cd cd printf $(pwd)
+		readonly -eu export --verbose /usr/bin export echo "$@" grep sed 2>/dev/null
+		2>/dev/null /usr/bin awk awk cd && /usr/bin && --verbose
+	| done && then then grep x=1 "$@" 2>/dev/null export sed
+		'quoted text' ${HOME} | 'quoted text'
+	/usr/bin done local -eu echo && cd /usr/bin export --verbose 'quoted text'
+	$(pwd) -eu "$@" done |
+cd grep /usr/bin 'quoted text'
+		readonly printf grep export 'quoted text' | -eu export --verbose readonly
+	cd && --verbose && export ${HOME} 'quoted text'
+		"$@" ${HOME} && "$1" readonly && readonly $(pwd) readonly
+printf && && readonly /usr/bin $(pwd) -eu /usr/bin
+		sed awk test 2>/dev/null printf 'quoted text' echo awk --verbose ${HOME} $(pwd)
+	printf 2>/dev/null export
+	x=1 ${HOME} echo test --verbose awk echo "$1" then && grep cd grep test
+then /usr/bin sed /usr/bin local sed done /usr/bin --verbose --verbose
+		-eu ${HOME} then | 'quoted text' --verbose "$1" local
+	-eu x=1 export grep grep cd "$@" readonly export printf
+		cd readonly grep 2>/dev/null 2>/dev/null test 2>/dev/null done "$1" done test
+export 2>/dev/null && local 'quoted text' $(pwd) grep
+-eu 'quoted text' /usr/bin -eu grep x=1 x=1 done 2>/dev/null ${HOME}
+cd "$@" printf printf echo test export
+	sed sed echo echo --verbose grep 'quoted text'
+		done -eu "$1" -eu export x=1 then export grep $(pwd) test 'quoted text'
+/usr/bin export 2>/dev/null
+	-eu printf --verbose 'quoted text' $(pwd)
+	cd awk "$1" $(pwd) 'quoted text' "$@" 2>/dev/null x=1 --verbose
+		done x=1 cd done export test /usr/bin done then export 'quoted text' readonly
+		/usr/bin $(pwd) x=1 echo sed then grep 2>/dev/null
+		$(pwd) /usr/bin printf $(pwd)
+	done "$1" "$1" grep x=1 | 'quoted text' then
+		--verbose then then -eu $(pwd) test x=1
+		"$@" "$@" grep | printf echo test &&
+	awk echo -eu local local awk
+printf -eu "$1" printf 2>/dev/null "$1" local --verbose
+		then /usr/bin -eu && cd awk done ${HOME} sed "$@"
+		&& 'quoted text' cd awk export echo && done export x=1 2>/dev/null
+		echo done local x=1 local sed 'quoted text' export "$@"
+		-eu 'quoted text' then export ${HOME} readonly ${HOME} cd echo
+	--verbose $(pwd) "$@" printf
+	/usr/bin 'quoted text' then then then 'quoted text' | grep | 'quoted text'
+	$(pwd) $(pwd) cd local 2>/dev/null --verbose --verbose local x=1 awk 'quoted text'
+2>/dev/null -eu grep | 'quoted text' awk local
+cd test | echo echo -eu export -eu --verbose readonly $(pwd) -eu sed
+	&& ${HOME} cd sed then 'quoted text'
+done "$@" | | && grep "$@" && --verbose | awk "$1" |
+	$(pwd) $(pwd) awk 'quoted text' echo printf $(pwd) "$@"
+		2>/dev/null ${HOME} printf --verbose grep sed /usr/bin 'quoted text'
+	export x=1 local $(pwd) echo
+$(pwd) 2>/dev/null sed 'quoted text'
+	echo x=1 ${HOME} "$1" done 'quoted text' test /usr/bin
+	printf ${HOME} test printf x=1 readonly then "$1" export
+		echo | sed "$1" --verbose ${HOME} "$1" echo readonly $(pwd)
+readonly local then grep ${HOME} -eu -eu "$@" /usr/bin "$1"
+		readonly $(pwd) then echo then /usr/bin --verbose then
+	"$@" grep 'quoted text' sed done done awk local -eu -eu /usr/bin 'quoted text'
+then printf /usr/bin then local
+		awk test cd grep $(pwd) /usr/bin | x=1 2>/dev/null echo
+&& "$@" && local local && x=1 $(pwd) "$@" "$1" 'quoted text' readonly -eu
+		done readonly echo printf x=1
+x=1 && export then local -eu grep "$1" 2>/dev/null local "$1" -eu cd
+		test $(pwd) sed 2>/dev/null readonly 'quoted text' 2>/dev/null
+		grep ${HOME} printf x=1 grep 2>/dev/null 'quoted text' grep local
+	cd $(pwd) then echo $(pwd) /usr/bin readonly test ${HOME} -eu |
+readonly printf --verbose local --verbose 'quoted text' -eu $(pwd)
+	"$1" x=1 test test printf
+		--verbose local && then | cd --verbose local
+		export cd then "$1" grep | sed
+		then export local $(pwd) && --verbose -eu readonly /usr/bin done 2>/dev/null
+| x=1 'quoted text' awk cd | test | ${HOME} /usr/bin &&
+		"$@" x=1 'quoted text' readonly awk 2>/dev/null $(pwd)
+export -eu test "$@" ${HOME} /usr/bin /usr/bin then readonly
+	printf readonly echo
+		x=1 export $(pwd) && $(pwd) echo 2>/dev/null
+/usr/bin export | "$1" /usr/bin cd grep export
+		echo grep 'quoted text'
+| --verbose x=1 ${HOME} done | printf test |
+		/usr/bin $(pwd) --verbose done done "$1" ${HOME} ${HOME} --verbose awk "$@"
+		&& grep done awk /usr/bin 'quoted text' && | | /usr/bin --verbose "$1" export
+	$(pwd) local | "$@" /usr/bin $(pwd) echo 2>/dev/null export readonly done sed
+export -eu local -eu ${HOME}
+	local $(pwd) 2>/dev/null 2>/dev/null x=1 echo "$@"
+		echo ${HOME} export then echo local echo sed 'quoted text' 2>/dev/null readonly
+then test cd 2>/dev/null 2>/dev/null 'quoted text'
+		local sed echo sed 'quoted text' export -eu
+		'quoted text' 'quoted text' x=1 $(pwd) ${HOME} $(pwd) awk cd --verbose "$@"
+	'quoted text' --verbose x=1 -eu then grep "$1"
+	${HOME} printf grep --verbose ${HOME}
+$(pwd) done --verbose grep /usr/bin --verbose local
+	-eu && 'quoted text' echo "$1" 2>/dev/null
+-eu readonly echo 'quoted text' 'quoted text' grep 2>/dev/null
+	${HOME} done echo "$1" grep --verbose then cd $(pwd) sed $(pwd) awk
+	readonly echo sed sed local | -eu local && then printf /usr/bin
+		${HOME} local 'quoted text' readonly sed 'quoted text'
+	cd printf awk cd ${HOME} -eu
+	"$@" grep -eu x=1 | && "$1" grep /usr/bin awk local grep /usr/bin local grep readonly
+		cd /usr/bin -eu x=1 local printf grep local awk then done local
+$(pwd) | readonly sed export awk printf local
+		--verbose then export --verbose /usr/bin cd cd
+	x=1 local then /usr/bin test awk 2>/dev/null
+cd echo && 'quoted text' test readonly && sed 'quoted text' echo
+local export grep grep /usr/bin awk
+	test --verbose && 2>/dev/null 2>/dev/null "$@" "$1" 'quoted text'
+		${HOME} cd echo "$1" 2>/dev/null --verbose ${HOME} sed x=1 echo test local
+	printf x=1 test /usr/bin awk --verbose
+readonly x=1 printf export done "$@" /usr/bin && -eu -eu
+"$@" | echo test export 'quoted text' "$@" x=1 echo then
+	cd printf grep grep printf test grep test export ${HOME} 2>/dev/null
+	export sed ${HOME} 'quoted text' echo grep --verbose "$@" echo
+		readonly awk 'quoted text' -eu local then x=1 done
+	2>/dev/null && grep readonly test sed 'quoted text'
+grep -eu local /usr/bin "$1" done "$@" export local
+		'quoted text' awk --verbose "$1" "$1" "$@" echo "$@" 2>/dev/null | awk "$@"
+	local echo | && grep echo "$@"
+	$(pwd) done sed awk echo echo 2>/dev/null
+"$1" ${HOME} -eu ${HOME} -eu printf done "$@"
+		x=1 export 2>/dev/null "$@" done sed echo x=1 && 2>/dev/null 2>/dev/null
+cd sed grep "$@" "$1" 2>/dev/null cd | "$1" readonly export grep $(pwd) awk
+done x=1 'quoted text' done local --verbose $(pwd) | ${HOME}
+	x=1 grep export 'quoted text' readonly sed 'quoted text' /usr/bin cd 2>/dev/null
+		readonly /usr/bin awk readonly
+	export && -eu sed | /usr/bin grep ${HOME}
+echo echo --verbose awk readonly "$1" 'quoted text' local printf printf sed
+test -eu | "$@" test cd local /usr/bin "$@" 2>/dev/null $(pwd) 'quoted text'
+	2>/dev/null 'quoted text' && local && local grep ${HOME}
+		awk ${HOME} local readonly readonly ${HOME} export /usr/bin
+	-eu "$@" /usr/bin -eu export "$1" export -eu 'quoted text' 'quoted text'
+	test /usr/bin printf cd then "$1" x=1 | awk then awk local ${HOME} printf
+readonly -eu awk --verbose "$@" printf | done "$1" readonly local ${HOME}
+${HOME} --verbose && sed -eu awk "$1" 2>/dev/null
+	echo 'quoted text' 2>/dev/null | ${HOME} test "$@"
+"$1" --verbose x=1 export
+		local export readonly awk grep sed /usr/bin then $(pwd) ${HOME} test
+		awk /usr/bin export -eu "$@" sed | echo local -eu export readonly local $(pwd)
+		cd 'quoted text' export --verbose echo $(pwd) printf x=1 sed 2>/dev/null
+		-eu && cd local && cd
+echo 2>/dev/null grep export printf x=1 echo $(pwd) readonly
+readonly $(pwd) 2>/dev/null echo printf "$1" then readonly && | export
+"$1" readonly done $(pwd) echo ${HOME} "$1"
+	test "$1" -eu then echo ${HOME} printf && --verbose export | $(pwd)
+		"$1" echo sed awk cd /usr/bin done export "$1" x=1 "$@" && echo -eu echo
+		${HOME} sed "$1" 2>/dev/null cd "$@" "$1" printf
+-eu --verbose done "$1" 'quoted text' done x=1 readonly
+	echo --verbose export && x=1 2>/dev/null
+	'quoted text' echo $(pwd) /usr/bin awk 'quoted text' --verbose done
+	&& local echo ${HOME} awk then then readonly 'quoted text' 'quoted text'
+| export /usr/bin export then export $(pwd)
+		"$@" 2>/dev/null -eu cd readonly "$@" 2>/dev/null "$@" awk ${HOME}
+	"$@" 2>/dev/null test $(pwd) x=1 sed ${HOME} done /usr/bin $(pwd) "$1" readonly
+	"$1" cd "$1" $(pwd) $(pwd) awk "$@" readonly
+		2>/dev/null done awk local "$@" printf sed awk x=1 echo then &&
+		"$@" 'quoted text' awk then "$1" "$@" test test readonly $(pwd)
+	-eu $(pwd) /usr/bin export "$1" awk "$1"
+	${HOME} ${HOME} 2>/dev/null test --verbose local export
+x=1 readonly readonly awk 2>/dev/null echo cd local "$@"
+		sed "$1" done | local "$@" "$@" export printf then test printf --verbose
+"$@" $(pwd) "$1" && ${HOME} local && "$@" /usr/bin
+		/usr/bin grep -eu && awk -eu grep then printf
+		&& test sed sed local && export x=1 export
+	echo test local /usr/bin export printf
+	| | $(pwd) 2>/dev/null
+cd "$1" && then 2>/dev/null "$1" then "$@" done /usr/bin "$@" 'quoted text'
+	${HOME} x=1 2>/dev/null local --verbose
+2>/dev/null | sed then echo
+		'quoted text' | done --verbose x=1 printf $(pwd) "$@" /usr/bin sed sed && grep
+printf test readonly ${HOME}
+echo $(pwd) "$@" $(pwd) --verbose ${HOME} "$1"
+done local "$1" 2>/dev/null "$1"
+--verbose "$1" cd local printf echo $(pwd) printf test --verbose cd
+	2>/dev/null export | 2>/dev/null ${HOME} cd then readonly
+		/usr/bin readonly $(pwd)
+		printf readonly echo 2>/dev/null local "$1" "$@" test 2>/dev/null echo "$@"
+local "$1" awk | "$@" x=1
+		${HOME} then readonly local local
+		-eu local local --verbose local readonly test local test awk /usr/bin 'quoted text'
+		sed export 'quoted text' sed grep
+--verbose --verbose 'quoted text'
+	readonly awk -eu then /usr/bin cd done x=1 -eu sed | "$1" | "$1" -eu
+	awk /usr/bin awk x=1 "$@" printf 2>/dev/null cd export --verbose && 'quoted text'
+		readonly echo printf "$@" --verbose "$1" cd echo && | ${HOME} test test
+&& ${HOME} then "$@" 2>/dev/null /usr/bin -eu | then $(pwd)
+	awk -eu "$@" /usr/bin grep /usr/bin printf ${HOME} "$@" ${HOME} sed done
+2>/dev/null ${HOME} then local 2>/dev/null && ${HOME} && "$@"
+readonly x=1 done x=1 echo printf local readonly sed
+cd awk grep then done grep | 'quoted text'
+awk "$1" echo readonly $(pwd) local ${HOME} cd x=1 --verbose && grep echo sed grep
+	| $(pwd) then awk test echo sed | $(pwd) cd readonly | $(pwd) --verbose 2>/dev/null
+	cd ${HOME} echo test cd printf echo | -eu local x=1
+		echo "$1" sed $(pwd) cd then -eu test x=1 cd cd $(pwd) echo 2>/dev/null
+then -eu /usr/bin readonly
+	/usr/bin /usr/bin x=1 "$@" && 'quoted text' done echo grep
+done then /usr/bin local local sed | 2>/dev/null
+		--verbose "$1" done awk local /usr/bin
+	-eu test echo local 'quoted text' /usr/bin
+		x=1 export grep ${HOME} local $(pwd) awk
+cd test 2>/dev/null echo cd readonly 'quoted text' local | done grep printf
+		printf echo sed -eu -eu
+	-eu then grep | local
+	awk $(pwd) local local cd
+		sed "$@" grep cd done 2>/dev/null awk test ${HOME}
+	${HOME} test --verbose printf cd sed $(pwd) sed && "$@" $(pwd) cd 'quoted text'
+		cd && cd printf grep "$1" 2>/dev/null $(pwd) done --verbose
+	| | && echo ${HOME} cd x=1 "$1" "$@" done x=1 readonly
+"$@" sed echo $(pwd) export
+		-eu -eu awk | 2>/dev/null "$@" echo echo
+'quoted text' grep then test cd test $(pwd) $(pwd) echo
+awk x=1 x=1 2>/dev/null --verbose then done && then "$1"
+'quoted text' "$1" export echo 2>/dev/null
+sed x=1 -eu grep sed -eu
+		"$@" awk awk printf && --verbose then echo local printf readonly
+-eu 'quoted text' /usr/bin 2>/dev/null
+then | "$1" -eu printf export "$@"
+/usr/bin readonly "$@" -eu cd local test echo readonly "$1"
+		echo && test readonly x=1 done done readonly -eu /usr/bin
+		$(pwd) printf /usr/bin 2>/dev/null && local
+${HOME} /usr/bin export export "$1" "$@" 'quoted text'
+	export 2>/dev/null awk x=1 awk echo echo export
+	x=1 && awk export /usr/bin
+x=1 -eu 2>/dev/null cd grep | readonly test
+x=1 2>/dev/null local echo export | done grep -eu --verbose "$1" --verbose
+	done done && && test x=1 done 2>/dev/null cd "$@" /usr/bin
+test 2>/dev/null | local then $(pwd) 'quoted text' grep --verbose "$1"
+echo --verbose cd done test sed x=1 export echo
+&& $(pwd) -eu then then local then echo "$@" -eu
+"$1" then | 2>/dev/null then printf --verbose
+	printf "$@" x=1 local ${HOME} --verbose x=1 grep /usr/bin printf --verbose
+then done x=1 awk /usr/bin 'quoted text' ${HOME} && awk
+		local cd done | test 'quoted text'
+		awk | "$1" export "$@" cd && && export
+		"$1" printf --verbose local readonly ${HOME} --verbose ${HOME}
+done test 'quoted text' -eu $(pwd) done /usr/bin sed grep local 'quoted text'
+	x=1 -eu export /usr/bin x=1 x=1 /usr/bin --verbose
+2>/dev/null 2>/dev/null local ${HOME} then -eu echo done
+&& | test /usr/bin sed ${HOME} 'quoted text' export
+		printf readonly 2>/dev/null done /usr/bin test printf export
+		done awk | readonly 'quoted text'
+grep cd -eu cd | && awk then "$1" ${HOME} cd 2>/dev/null 2>/dev/null
+test /usr/bin "$1" sed printf export readonly 2>/dev/null -eu
+	readonly local awk cd
+then ${HOME} ${HOME} 'quoted text' ${HOME} 2>/dev/null
+"$1" cd | "$1" && test done x=1 grep "$@" && awk cd readonly
+x=1 local readonly ${HOME} awk /usr/bin readonly | echo /usr/bin
+	readonly 2>/dev/null -eu
+local cd grep local then
+		2>/dev/null /usr/bin awk 'quoted text' "$@" then cd then
+"$1" /usr/bin $(pwd) x=1 "$@" -eu readonly "$@" done printf
+${HOME} cd echo -eu local readonly --verbose --verbose cd "$1" -eu $(pwd) ${HOME}
+done sed done && "$1" cd awk $(pwd) /usr/bin "$@" readonly
+		sed && $(pwd) ${HOME} "$1" /usr/bin test echo grep
+printf cd cd test $(pwd) done
+		$(pwd) | printf awk awk | "$1" 2>/dev/null
+	echo -eu && --verbose awk sed "$@" /usr/bin --verbose echo echo done
+	echo $(pwd) 2>/dev/null
+	${HOME} "$1" ${HOME} echo /usr/bin then --verbose
+	x=1 2>/dev/null echo 'quoted text' sed cd printf
+--verbose sed export done sed readonly $(pwd) echo then then && sed then cd awk
+echo echo test -eu done "$1" echo printf printf printf
+done grep export "$1" test x=1 cd readonly | printf
+grep printf echo awk "$@" ${HOME} $(pwd) echo 2>/dev/null sed && x=1 awk 'quoted text'
+	local test cd export printf readonly cd then /usr/bin
+		${HOME} $(pwd) grep sed echo -eu grep && export /usr/bin $(pwd)
+printf x=1 $(pwd) && echo ${HOME}
+		"$1" --verbose sed printf echo && /usr/bin "$1"
+	printf 2>/dev/null export cd local export $(pwd) test "$1"
+	&& printf cd --verbose -eu awk /usr/bin done 'quoted text' "$1"
+		"$@" local done --verbose cd --verbose
+done cd 'quoted text' done local
+		local cd "$1" --verbose awk printf && cd ${HOME} --verbose "$@" grep
+		export ${HOME} test test sed printf
+		cd export test awk done && echo && local && -eu 2>/dev/null echo
+$(pwd) 'quoted text' /usr/bin cd ${HOME} | &&
+	readonly x=1 ${HOME} awk ${HOME} done -eu 'quoted text' grep /usr/bin
+&& "$1" cd test test readonly done cd sed 2>/dev/null ${HOME}
+	test readonly 2>/dev/null
+		'quoted text' "$1" 2>/dev/null 'quoted text'
+sed | export local then
+		awk export "$@" ${HOME}
+		test printf x=1 "$@" local done readonly printf "$@" printf
+		printf local | sed test "$1" && -eu then echo cd export cd $(pwd) sed && "$@" -eu
+--verbose readonly x=1 'quoted text' 'quoted text'
+then export ${HOME} sed 2>/dev/null --verbose grep grep export
+	done test awk "$@" local x=1 -eu
+x=1 grep --verbose then 'quoted text' /usr/bin local "$1" cd /usr/bin grep awk
+--verbose sed -eu | then 2>/dev/null
+		"$@" -eu readonly --verbose readonly $(pwd) --verbose x=1 x=1 "$1" readonly
+local local then && x=1 --verbose
+	cd done readonly cd | --verbose
+	readonly --verbose readonly ${HOME} cd test done
+		readonly export --verbose cd "$1" && cd awk "$1" x=1 awk $(pwd) grep
+		readonly -eu 'quoted text' $(pwd) test -eu "$@"
+		'quoted text' "$1" done ${HOME} test awk echo "$@"
+&& printf test grep done "$1" "$@" ${HOME} readonly cd &&
+		printf grep x=1 /usr/bin readonly "$1" grep echo x=1 readonly done | local
+then "$1" 'quoted text' "$1" done grep /usr/bin x=1 "$@"
+		done $(pwd) done ${HOME} sed echo "$@" then /usr/bin then $(pwd)
+	cd && $(pwd) -eu ${HOME} "$@" sed test readonly export local 2>/dev/null
+	grep export "$@" done "$1" readonly /usr/bin
+		done | printf done x=1
+		sed ${HOME} x=1 && $(pwd) /usr/bin awk x=1 sed grep 'quoted text'
+	printf $(pwd) echo local awk grep --verbose x=1 ${HOME} /usr/bin local 'quoted text'
+		"$@" export local readonly
+export test echo /usr/bin
+	2>/dev/null cd $(pwd) readonly printf $(pwd) 'quoted text' sed && -eu /usr/bin
+		| "$1" $(pwd) ${HOME} ${HOME} printf printf then test
+		x=1 cd -eu printf "$@" ${HOME} 2>/dev/null done done
+	export test 2>/dev/null readonly $(pwd) -eu awk
+		printf local /usr/bin /usr/bin 2>/dev/null printf "$1" done done awk readonly done
+export -eu readonly then sed $(pwd) then "$1" && $(pwd) ${HOME} cd done x=1
+	-eu printf "$@" /usr/bin export && 2>/dev/null readonly x=1 ${HOME} | done "$1"
+	$(pwd) $(pwd) /usr/bin "$@" then grep /usr/bin "$@" cd --verbose
+	then $(pwd) echo && -eu x=1 grep -eu 2>/dev/null "$1" awk "$1" | readonly test
+		$(pwd) -eu -eu | local grep 2>/dev/null
+		then local grep awk 'quoted text' done grep echo /usr/bin sed ${HOME}
+local $(pwd) export 'quoted text' x=1 cd
+		-eu $(pwd) $(pwd) test test readonly $(pwd) ${HOME} "$@" awk -eu
+local "$1" test -eu -eu
+echo 2>/dev/null readonly /usr/bin 'quoted text' echo sed && cd echo 'quoted text'
+grep -eu /usr/bin 'quoted text' -eu printf grep echo local awk $(pwd) echo
+		x=1 $(pwd) 2>/dev/null $(pwd) awk
+$(pwd) --verbose | /usr/bin | awk printf local /usr/bin ${HOME}
+	x=1 test done readonly --verbose
+	grep done cd cd "$@" grep echo readonly echo printf 2>/dev/null
+	$(pwd) export x=1 readonly 'quoted text' sed test echo echo
+"$@" "$1" 2>/dev/null --verbose -eu readonly 'quoted text' x=1 awk 2>/dev/null
+		done /usr/bin done --verbose export
+	readonly readonly readonly -eu ${HOME} printf
+		-eu /usr/bin | test ${HOME} 'quoted text' local x=1 2>/dev/null
+		2>/dev/null done done "$@" local
+		--verbose -eu /usr/bin cd 2>/dev/null -eu then then cd
+	'quoted text' cd 'quoted text' awk 'quoted text' 2>/dev/null
+	done /usr/bin ${HOME} awk ${HOME} "$@" export printf
+test 2>/dev/null awk test "$1" export then then test | 2>/dev/null
+		x=1 test then then -eu 'quoted text' printf export then x=1 done "$@" test x=1
+		then "$@" readonly "$@" grep | && test "$@" awk
+printf local 'quoted text' local
+	"$@" "$@" readonly printf awk /usr/bin
+	-eu && readonly ${HOME} ${HOME} readonly done
+	test cd /usr/bin local 2>/dev/null
+printf readonly export
+		readonly local cd test then export echo /usr/bin | grep ${HOME} export then then
+	${HOME} readonly -eu printf local echo ${HOME} cd grep
+	2>/dev/null grep printf awk -eu cd x=1 "$@" | printf printf test "$@"
+		local /usr/bin local --verbose
+		test cd ${HOME} 2>/dev/null test grep cd -eu --verbose sed cd printf
+		"$1" x=1 -eu 'quoted text'
+		done "$@" && "$1" then test grep
+"$1" printf ${HOME} grep readonly awk
+	sed $(pwd) --verbose echo "$@" "$@" "$1" test "$1" printf done cd
+		awk "$1" "$1" test awk done -eu local grep 2>/dev/null
+#include c218.sh
+		"$1" cd test "$@" && | awk $(pwd) test 'quoted text' --verbose
+echo /usr/bin --verbose 2>/dev/null echo
+/usr/bin echo then test export ${HOME}
+local -eu test "$@" 2>/dev/null cd then ${HOME} sed readonly
+	'quoted text' /usr/bin cd x=1
+	-eu "$@" awk 'quoted text' local export && grep "$@" /usr/bin cd test /usr/bin done
+	| then echo /usr/bin --verbose sed echo printf
+		"$1" echo readonly 2>/dev/null && then x=1 "$@"
+		"$1" /usr/bin done x=1 export $(pwd) local $(pwd) --verbose readonly echo
+		done cd 'quoted text' cd "$@" export x=1 "$@" ${HOME} -eu "$@" 'quoted text'
+		grep 'quoted text' awk --verbose then grep sed grep awk then "$1"
+		cd ${HOME} test ${HOME} then cd "$@" grep then sed | echo x=1 2>/dev/null 'quoted text'
+$(pwd) | grep | ${HOME} $(pwd) 'quoted text' "$@" -eu "$@" done
+		cd done export -eu $(pwd) ${HOME} /usr/bin --verbose
+	readonly --verbose echo 'quoted text' printf -eu "$@" -eu printf &&
+		readonly echo "$@" /usr/bin x=1 $(pwd) x=1 sed 'quoted text' -eu then --verbose
+	grep ${HOME} | "$1" && ${HOME} readonly "$1" export
+"$@" $(pwd) ${HOME} -eu --verbose $(pwd) echo $(pwd)
+		then cd x=1 then && done cd sed $(pwd) -eu local | local local 'quoted text'
+2>/dev/null | | sed "$@" then
+		grep sed awk 2>/dev/null
+		done --verbose grep cd /usr/bin -eu -eu export x=1 then local &&
+	printf test then sed done x=1 /usr/bin /usr/bin ${HOME} readonly "$@"
+		done $(pwd) && done 2>/dev/null awk "$1"
+		&& readonly 2>/dev/null done cd awk ${HOME} printf then ${HOME} &&
+printf done $(pwd) export --verbose readonly sed x=1 done "$1" &&
+$(pwd) readonly printf test sed then ${HOME} awk --verbose cd then
+	${HOME} printf export ${HOME} ${HOME}
+	printf /usr/bin -eu test && -eu export readonly --verbose --verbose && 2>/dev/null
+	local test cd x=1 $(pwd) "$@" done
+		printf echo "$@" $(pwd) then echo
+local x=1 --verbose then -eu echo x=1 local | local local
+	done then done cd cd local
+	$(pwd) cd grep "$@" test test $(pwd) && then cd -eu -eu done
+2>/dev/null | done "$@" --verbose $(pwd) "$1" /usr/bin echo then echo export
+	$(pwd) echo echo done "$@" | "$@"
+x=1 "$1" test 'quoted text'
+2>/dev/null readonly &&
+	awk "$1" "$1" local -eu printf
+awk x=1 readonly export ${HOME} $(pwd) | $(pwd) echo grep
+	printf 2>/dev/null test cd -eu --verbose 'quoted text' test /usr/bin /usr/bin
+		cd export ${HOME} -eu echo grep done "$1" echo awk cd grep 'quoted text' "$1"
+"$@" printf "$1" x=1 sed 'quoted text' sed sed local "$1" printf
+		readonly then test $(pwd) /usr/bin x=1 && -eu then done printf cd
+$(pwd) readonly "$1" -eu && && then x=1 && export |
+	test 'quoted text' x=1 done
+	local grep local awk cd && | "$1" readonly printf local
+		2>/dev/null /usr/bin test
+		| x=1 echo grep then printf done echo sed /usr/bin $(pwd)
+${HOME} "$1" ${HOME} then /usr/bin
+		sed /usr/bin | awk /usr/bin done grep test echo
+$(pwd) printf grep local
+then done $(pwd) export readonly "$@" local "$1" test | --verbose "$1" && -eu
+		done done x=1 readonly awk /usr/bin grep "$@" 2>/dev/null
+then | 'quoted text' echo --verbose sed x=1 awk $(pwd)
+	echo x=1 -eu local && x=1 awk echo ${HOME} test grep test then "$1" "$1" ${HOME}
+		grep -eu "$@" "$@" | readonly
+		"$1" "$@" 'quoted text' && local && 2>/dev/null | --verbose printf cd export
+		echo grep "$1" ${HOME} grep grep ${HOME}
+then ${HOME} cd then test export | export
+		| 2>/dev/null printf -eu cd 'quoted text' awk --verbose 'quoted text' sed
+2>/dev/null | && 'quoted text' -eu "$@" export x=1 then
+		printf "$1" x=1 grep printf
+	-eu cd then done && grep then
+cd /usr/bin $(pwd) echo $(pwd) printf ${HOME}
+	echo ${HOME} --verbose export /usr/bin then "$@" 'quoted text'
+		"$@" ${HOME} then /usr/bin done done awk grep export 'quoted text' cd echo
+		done "$@" readonly sed done readonly "$@" cd readonly cd printf
+		awk 'quoted text' done sed -eu $(pwd) 2>/dev/null
+		done sed done | ${HOME} sed 'quoted text' echo cd "$@" readonly
+$(pwd) /usr/bin export then /usr/bin echo local /usr/bin cd sed done ${HOME} local
+	local /usr/bin "$@" echo
+	$(pwd) export 2>/dev/null x=1 -eu /usr/bin
+		readonly 2>/dev/null echo "$@" awk printf ${HOME}
+	$(pwd) cd then test test --verbose
+	--verbose grep printf 'quoted text' --verbose cd x=1 echo /usr/bin sed &&
+		"$@" local /usr/bin export
+test echo local 2>/dev/null
+		printf /usr/bin export test | cd printf export local
+	readonly cd "$@" 2>/dev/null cd cd grep cd awk grep -eu -eu x=1 printf
+	readonly ${HOME} awk grep grep x=1
+grep -eu sed -eu readonly export /usr/bin grep && 'quoted text'
+		printf $(pwd) | "$1" export 2>/dev/null
+	cd -eu awk local test 2>/dev/null ${HOME} done 'quoted text'
+		grep local "$@" awk sed /usr/bin test
+	"$1" 2>/dev/null && && done grep test ${HOME} "$1" test
+	2>/dev/null cd test x=1 test "$1"
+sed "$1" $(pwd) /usr/bin "$@" "$@" $(pwd) /usr/bin echo "$1" --verbose
+		awk $(pwd) grep then && done awk cd test && -eu export printf
+${HOME} awk readonly cd cd --verbose "$1" export
+sed awk && echo local then && ${HOME}
+	export export readonly "$1" 'quoted text' readonly
+sed test grep "$@" done /usr/bin echo /usr/bin 'quoted text' local "$@" && awk
+		$(pwd) cd grep cd sed --verbose export 2>/dev/null
+		--verbose "$1" local test grep /usr/bin --verbose then then local echo
+		${HOME} "$@" x=1 grep awk test done export cd then x=1 "$@" x=1 x=1 awk "$@"
+	then --verbose "$1" cd sed
+		export x=1 -eu 2>/dev/null ${HOME} "$1" printf "$1" done echo grep sed
+printf echo test -eu 'quoted text' test x=1 readonly --verbose done && then readonly
+grep ${HOME} grep 'quoted text'
+	--verbose 2>/dev/null test $(pwd) -eu /usr/bin grep done --verbose
+local 2>/dev/null then x=1 2>/dev/null 'quoted text'
+/usr/bin 2>/dev/null 'quoted text'
+echo x=1 then readonly sed awk cd done export | | --verbose
+| x=1 sed "$@" ${HOME} /usr/bin $(pwd)
+	&& echo sed $(pwd) awk awk $(pwd) x=1 --verbose x=1 --verbose awk local printf
+sed "$1" sed sed test echo 'quoted text'
+"$@" test then x=1 $(pwd) /usr/bin 'quoted text'
+	&& x=1 sed "$1" local
+	export -eu x=1 awk $(pwd) export ${HOME} 'quoted text' ${HOME} --verbose
+	${HOME} 2>/dev/null "$1" local printf test cd --verbose 2>/dev/null
+		${HOME} awk ${HOME} $(pwd) cd cd x=1 local sed test printf
+then -eu sed cd export cd $(pwd)
+		echo echo printf cd x=1 $(pwd) local
+		'quoted text' grep | "$1" x=1 then | test cd | && grep |
+readonly $(pwd) | echo echo
+	awk awk echo cd done -eu $(pwd) awk awk cd printf
+printf 'quoted text' printf echo done 2>/dev/null
+		'quoted text' /usr/bin /usr/bin cd 'quoted text'
+	local sed 'quoted text' printf done echo awk cd "$@"
+		awk $(pwd) -eu "$@" $(pwd) then
+	"$@" done sed "$1" | $(pwd) x=1 echo $(pwd) export echo then -eu && 2>/dev/null
+		x=1 "$1" "$1" && /usr/bin --verbose x=1 cd readonly printf ${HOME}
+	done 'quoted text' echo readonly | local then --verbose done x=1 'quoted text'
+	readonly -eu "$1" printf done done 2>/dev/null
+		&& --verbose "$1" 'quoted text' cd cd --verbose done then printf done
+	then then done | then awk && cd "$1" printf done -eu x=1 ${HOME} local cd grep
+then -eu test -eu "$1" | done sed grep && $(pwd) sed export readonly --verbose
+		"$@" cd ${HOME} 2>/dev/null --verbose ${HOME} -eu local echo 'quoted text' export
+| x=1 sed /usr/bin "$1" test export | "$1" readonly export
+	echo /usr/bin "$1" --verbose "$1" sed echo awk ${HOME} | export -eu then export
+	readonly local test 2>/dev/null "$1" grep
+sed ${HOME} sed --verbose "$1"
+	&& | "$@" echo local 'quoted text' echo echo cd readonly $(pwd) export "$@" test
+		echo readonly /usr/bin then -eu cd
+		/usr/bin awk then 'quoted text' echo done --verbose "$@" grep echo grep 2>/dev/null
+		awk --verbose export 'quoted text'
+		'quoted text' "$@" && grep echo done -eu
+| sed $(pwd) 'quoted text' ${HOME} ${HOME}
+		'quoted text' ${HOME} grep sed x=1 /usr/bin --verbose sed
+		local 'quoted text' test then -eu -eu then readonly --verbose -eu
+grep x=1 export && cd $(pwd) export x=1 ${HOME} "$1" printf
+		'quoted text' "$@" sed "$@" "$@" "$1" local echo then x=1 "$@"
+	cd "$1" grep echo export then done "$@" cd done test awk --verbose
+		${HOME} $(pwd) 'quoted text' -eu "$1" test 'quoted text' test "$@" then done
+		done $(pwd) awk printf ${HOME} $(pwd) test cd /usr/bin
+/usr/bin local local sed printf local 'quoted text' 2>/dev/null
+	export 'quoted text' $(pwd) readonly local echo readonly
+/usr/bin readonly printf done | printf "$1" test test cd "$1" sed /usr/bin /usr/bin
+	| -eu && "$@" export $(pwd) "$@" test then local
+	--verbose $(pwd) readonly printf echo local test x=1 | /usr/bin
+--verbose test 2>/dev/null test then awk echo 'quoted text'
+		export && cd cd ${HOME} 2>/dev/null 'quoted text' "$1" "$@" export local
+		x=1 --verbose | test --verbose 2>/dev/null /usr/bin ${HOME} -eu | printf
+	sed local local test sed then awk ${HOME} "$@" grep ${HOME} awk ${HOME}
+--verbose export grep | "$@" done "$@" /usr/bin then local then x=1 cd |
+	echo sed readonly export 2>/dev/null $(pwd) awk && /usr/bin /usr/bin /usr/bin
+		awk 2>/dev/null readonly | export ${HOME} test && | readonly 2>/dev/null |
+then local && 2>/dev/null /usr/bin 'quoted text' ${HOME} x=1 local --verbose x=1
+	/usr/bin "$1" awk printf
+	-eu ${HOME} done sed printf done export $(pwd) local && echo done /usr/bin
+		"$@" then printf x=1 --verbose
+	export && "$1" --verbose printf
+	printf local -eu grep ${HOME} $(pwd) sed cd $(pwd) ${HOME} "$1"
+"$1" ${HOME} "$@" "$1" printf sed grep $(pwd)
+		--verbose 'quoted text' printf readonly printf sed printf local
+${HOME} "$1" export --verbose test cd grep
+	${HOME} test x=1 x=1 2>/dev/null sed --verbose "$@" printf test then then cd
+	${HOME} $(pwd) test awk then --verbose sed printf
+		awk done done 'quoted text' test echo /usr/bin readonly
+	echo "$1" awk $(pwd) -eu printf --verbose test $(pwd) /usr/bin
+		-eu && sed "$@" && printf "$@" "$@" sed --verbose
+		/usr/bin local 2>/dev/null 2>/dev/null x=1 $(pwd)
+		then 2>/dev/null && 'quoted text'
+	x=1 --verbose echo echo
+test 2>/dev/null "$1" 2>/dev/null 2>/dev/null 2>/dev/null | printf
+--verbose echo "$@" $(pwd)
+x=1 awk /usr/bin readonly done local
+echo && 2>/dev/null 'quoted text' cd echo --verbose printf x=1
+		/usr/bin /usr/bin then --verbose | -eu /usr/bin --verbose 'quoted text'
+		"$1" | export readonly export 2>/dev/null $(pwd) local
+		-eu "$@" | | done export sed 'quoted text' test local --verbose
+$(pwd) echo grep ${HOME} "$1" /usr/bin -eu sed sed cd && export "$1"
+	$(pwd) /usr/bin then cd | && "$1" x=1 x=1 -eu export
+grep "$1" --verbose $(pwd) echo printf export && "$1" 'quoted text'
+		'quoted text' readonly x=1 awk readonly local
+-eu x=1 | awk printf sed cd $(pwd) 2>/dev/null then awk
+		sed --verbose ${HOME} export echo printf
+	-eu $(pwd) sed ${HOME} done grep /usr/bin 'quoted text' && 2>/dev/null 2>/dev/null
+echo awk | sed local && test export sed readonly local
+		export x=1 done --verbose cd 'quoted text' x=1 test $(pwd) "$1" test test awk
+x=1 printf /usr/bin awk local 2>/dev/null awk printf test -eu 2>/dev/null /usr/bin
+	readonly test ${HOME} $(pwd) then 2>/dev/null
+	readonly then cd ${HOME} echo readonly done test x=1 --verbose done "$1" &&
+		echo /usr/bin /usr/bin --verbose "$@" "$1" cd "$1"
+	/usr/bin export done test | readonly awk local ${HOME} "$@" cd --verbose x=1 -eu
+$(pwd) export /usr/bin x=1 --verbose local /usr/bin
+&& done printf local ${HOME} $(pwd) && printf
+		export then 'quoted text' $(pwd) /usr/bin test 2>/dev/null echo ${HOME} grep
+	${HOME} $(pwd) -eu readonly echo x=1 cd --verbose
+	echo echo export awk --verbose grep export printf test cd echo
+readonly printf $(pwd) 2>/dev/null export done export echo test sed x=1 done
+	/usr/bin && 2>/dev/null
+	printf then x=1 awk local awk awk ${HOME} -eu
+	echo "$@" sed sed export ${HOME}
+echo "$1" 'quoted text' x=1 grep --verbose 'quoted text' | "$1" "$1" sed 2>/dev/null
+x=1 export awk | && --verbose && "$1"
+		cd printf local test printf test local /usr/bin done then
+	local readonly && printf 'quoted text' done test
+	sed grep /usr/bin sed test test && | readonly grep grep
+		readonly local -eu 'quoted text' ${HOME} local sed then printf echo -eu
+	${HOME} test $(pwd) "$1" -eu readonly
+x=1 echo cd local readonly readonly printf "$1" "$@" readonly | sed cd 2>/dev/null
+	'quoted text' --verbose then /usr/bin awk 2>/dev/null local -eu local
+		test cd printf grep 2>/dev/null | test
+		then test -eu awk readonly then --verbose
+		"$@" readonly readonly -eu echo test printf cd 2>/dev/null readonly
+		2>/dev/null printf sed x=1 sed printf
+	${HOME} && grep /usr/bin
+		"$1" awk ${HOME} 2>/dev/null grep 2>/dev/null then && ${HOME} ${HOME} /usr/bin
+		--verbose export 2>/dev/null /usr/bin 2>/dev/null
+	2>/dev/null test sed export /usr/bin 2>/dev/null --verbose 'quoted text'
+--verbose $(pwd) sed -eu 2>/dev/null && --verbose
+	cd done printf 2>/dev/null printf x=1 export
+	2>/dev/null | 'quoted text'
+&& echo && readonly done "$@" "$@"
+awk then export test awk echo grep x=1 | awk ${HOME} awk awk export ${HOME} sed
+	then "$@" awk grep cd /usr/bin test 'quoted text' grep test "$1" --verbose
+		done then 2>/dev/null ${HOME} 'quoted text' cd cd cd "$1"
+	"$@" sed cd export done -eu x=1 done readonly grep awk "$@" printf ${HOME} readonly
+		echo $(pwd) then && /usr/bin local readonly 'quoted text' /usr/bin
+readonly export cd x=1 2>/dev/null grep
+	&& 'quoted text' --verbose $(pwd) --verbose && "$@" -eu grep
+		/usr/bin | sed --verbose sed sed
+'quoted text' echo --verbose | echo x=1 ${HOME} awk 'quoted text'
+	$(pwd) then awk printf 'quoted text' sed local
+	'quoted text' "$@" && && grep /usr/bin cd export export local awk $(pwd)
+	cd 'quoted text' && cd "$@" ${HOME} /usr/bin 'quoted text'
+		-eu "$@" done grep $(pwd) grep --verbose 2>/dev/null /usr/bin
+		"$@" sed test cd /usr/bin 'quoted text' readonly && awk ${HOME}
+		&& awk printf $(pwd) 'quoted text' --verbose | grep grep export export
+		local $(pwd) echo local then --verbose local grep awk $(pwd)
+		readonly --verbose cd $(pwd) readonly export &&
+/usr/bin grep | echo test local
+	awk && printf printf echo "$@" x=1 ${HOME} $(pwd) 'quoted text'
+		${HOME} "$1" 'quoted text' done 'quoted text' export
+		cd grep local ${HOME} $(pwd) local /usr/bin --verbose
+		grep 'quoted text' printf --verbose local /usr/bin printf cd -eu 'quoted text'
+done --verbose "$@" "$@" 'quoted text' grep ${HOME}
+		/usr/bin ${HOME} printf grep "$@" cd | &&
+		done "$1" ${HOME} --verbose 'quoted text' "$1" readonly ${HOME} -eu "$1" && 2>/dev/null
+printf sed readonly ${HOME} "$1" 'quoted text' | /usr/bin
+		done export then $(pwd)
+	${HOME} local /usr/bin grep sed 'quoted text' sed 'quoted text'
+		printf --verbose | then -eu --verbose cd test 'quoted text' && --verbose then
+	echo --verbose /usr/bin 'quoted text'
+		test printf /usr/bin readonly test echo
+local export 'quoted text'
+	/usr/bin readonly ${HOME} x=1 test | export $(pwd) grep "$1" -eu
+2>/dev/null $(pwd) /usr/bin
+		--verbose grep 'quoted text' then
+'quoted text' echo printf && "$1"
+		readonly 'quoted text' ${HOME}
+done --verbose x=1 "$1" 'quoted text' cd then local cd
+	awk 2>/dev/null awk local
+		export local local 2>/dev/null "$1" --verbose then | "$@" x=1 &&
+	"$@" readonly && -eu | --verbose
+&& /usr/bin 2>/dev/null 2>/dev/null done x=1 export readonly 'quoted text'
+		then then /usr/bin 2>/dev/null echo awk
+	awk | "$@" printf /usr/bin -eu
+	test && echo --verbose 2>/dev/null | local then
+		"$1" -eu then test then && printf -eu
+	/usr/bin -eu "$1" /usr/bin done test --verbose
+local | $(pwd) then | local sed test local ${HOME} && /usr/bin test x=1
+cd /usr/bin 'quoted text' ${HOME} done -eu test ${HOME} test $(pwd)
+"$@" && -eu then 2>/dev/null x=1 printf | /usr/bin && && awk && x=1 then test
+--verbose export done --verbose done -eu -eu 'quoted text' then -eu readonly
+2>/dev/null echo done done 'quoted text' --verbose sed --verbose
+-eu awk | cd 'quoted text' printf cd grep
+	$(pwd) cd && $(pwd) done ${HOME} awk grep x=1 echo 'quoted text'
+		local sed then 2>/dev/null then grep -eu echo $(pwd) /usr/bin grep sed
+		printf x=1 sed readonly /usr/bin done then echo "$@" done "$1"
+		${HOME} ${HOME} 'quoted text' && export $(pwd) -eu cd readonly x=1
+/usr/bin then grep && /usr/bin "$1" "$@"
+	export "$1" "$1" cd echo $(pwd) sed then "$@" "$@" 'quoted text' 2>/dev/null
+		2>/dev/null "$1" grep $(pwd) x=1 ${HOME} then then --verbose && printf export
+		done -eu grep | export test -eu -eu 2>/dev/null done local "$1" printf x=1
+grep 'quoted text' local
+	done "$@" "$@" readonly && grep then x=1 printf
+		${HOME} --verbose x=1 export --verbose local done cd "$1" "$1"
+		${HOME} local test $(pwd) 'quoted text'
+/usr/bin x=1 readonly readonly sed
+"$@" local export printf test 2>/dev/null
+		x=1 --verbose 'quoted text'
+	echo grep done awk && printf "$1" then awk
+		${HOME} echo | /usr/bin $(pwd) x=1 local then x=1
+	-eu ${HOME} printf printf printf && echo ${HOME}
+cd && | test printf then $(pwd) echo 2>/dev/null awk then readonly
+	'quoted text' test then cd done awk -eu && readonly sed 'quoted text' x=1 echo
+awk "$@" then 'quoted text' "$1" /usr/bin "$@" export
+x=1 x=1 $(pwd) grep && && awk printf -eu
+		cd awk x=1 readonly sed echo | ${HOME} /usr/bin then 'quoted text' 'quoted text'
+	| -eu --verbose grep 2>/dev/null export -eu local done cd then | /usr/bin
+		'quoted text' "$@" | "$1" then | /usr/bin 'quoted text'
+		| export grep readonly export cd done echo 'quoted text'
+	--verbose export awk awk $(pwd) && printf printf ${HOME} sed export grep
+	then 2>/dev/null "$1" done "$1"
+		sed grep readonly && /usr/bin awk 2>/dev/null sed test "$1" cd grep
+		&& grep printf printf export "$@" && test | ${HOME} -eu readonly $(pwd)
+		$(pwd) sed awk 'quoted text' -eu x=1 grep printf printf "$1" echo "$1" test awk
+echo local readonly "$1" awk then done /usr/bin
+		&& done local export "$@" test 2>/dev/null
+		echo export /usr/bin grep cd done local
+	test /usr/bin echo done && export
+	--verbose echo then -eu /usr/bin test
+	echo local $(pwd) sed "$@" ${HOME} echo export -eu export local
+	/usr/bin printf 2>/dev/null ${HOME} --verbose "$1" printf -eu
+		printf then local test then local then x=1 x=1 awk
+x=1 --verbose test then 2>/dev/null 'quoted text' cd --verbose 2>/dev/null printf
+		test readonly ${HOME} readonly export awk 2>/dev/null awk cd echo x=1 printf
+		readonly ${HOME} echo $(pwd) && local
+printf grep test printf 2>/dev/null
+sed local --verbose awk awk
+readonly ${HOME} then --verbose
+done 'quoted text' ${HOME} /usr/bin grep 'quoted text' echo test local awk
+${HOME} $(pwd) grep test done printf $(pwd) | printf export | 'quoted text'
+	grep export 2>/dev/null test ${HOME} awk readonly 'quoted text' echo
+		test x=1 test cd ${HOME} "$@" done
+	test then printf "$@" $(pwd) grep test test done "$@" /usr/bin && grep
+		2>/dev/null $(pwd) echo then sed --verbose "$1" export 2>/dev/null printf -eu echo
+-eu ${HOME} 2>/dev/null ${HOME} && echo 2>/dev/null "$1" ${HOME} -eu
+	$(pwd) | $(pwd) then printf
+		cd grep done export | echo
+| $(pwd) | $(pwd) cd then -eu -eu done echo -eu then -eu sed echo
+	echo export grep awk
+echo $(pwd) 2>/dev/null /usr/bin x=1
+	${HOME} /usr/bin | "$1" sed $(pwd) printf sed
+--verbose sed 2>/dev/null readonly readonly cd && | | test echo --verbose
+x=1 "$1" ${HOME} 'quoted text' printf | 2>/dev/null local $(pwd) local test
+		export 2>/dev/null sed 2>/dev/null awk grep ${HOME} local x=1 | done export
+	x=1 sed grep | test ${HOME} sed done done | echo -eu 2>/dev/null
+	then export sed echo | x=1 test test 'quoted text'
+		readonly readonly printf
+	x=1 printf && "$@" /usr/bin
+		printf -eu "$@" test --verbose readonly "$@" 'quoted text' export
+	export /usr/bin readonly 'quoted text'
+	--verbose /usr/bin $(pwd) 'quoted text' /usr/bin printf --verbose
+	"$@" done cd /usr/bin
+	&& | 2>/dev/null cd x=1 cd 'quoted text' --verbose 2>/dev/null ${HOME} sed
+	-eu echo | local printf cd --verbose
+		grep then printf then && export test -eu local
+		&& | done sed awk done grep $(pwd) x=1 "$@" local "$1"
+echo ${HOME} $(pwd) grep sed grep printf then ${HOME} $(pwd) export printf
+		$(pwd) then readonly $(pwd) local awk 2>/dev/null 2>/dev/null
+then test 'quoted text' test export "$@" test local
+readonly /usr/bin cd ${HOME} ${HOME}
+	'quoted text' local local "$1" cd $(pwd) grep cd local --verbose $(pwd)
+	--verbose then && -eu && /usr/bin /usr/bin && readonly --verbose
+readonly export export local | then
+		| x=1 sed grep export 'quoted text' sed && && 2>/dev/null done local grep $(pwd)
+	${HOME} echo --verbose 2>/dev/null | --verbose then "$@" && "$@" awk
+-eu 2>/dev/null "$@" /usr/bin cd $(pwd) test then
+"$@" && test ${HOME} "$1" printf /usr/bin then then /usr/bin $(pwd)
+export done sed echo printf sed awk test test --verbose
+	awk x=1 grep -eu "$@" ${HOME}
+		readonly 2>/dev/null /usr/bin -eu --verbose readonly
+	test grep awk then awk sed --verbose "$@" "$1" readonly echo
+sed then local | cd x=1 ${HOME} 2>/dev/null then then --verbose grep test "$1"
+	awk awk /usr/bin 'quoted text' 2>/dev/null then $(pwd) awk x=1
+		sed sed x=1 then $(pwd) "$1" export "$@" ${HOME}
+test && "$1" echo x=1 done ${HOME}
+		awk sed then export "$1" x=1 --verbose
+'quoted text' export ${HOME} readonly then $(pwd) 2>/dev/null "$@"
+awk echo x=1 cd --verbose export
+${HOME} "$1" ${HOME} ${HOME} printf sed 2>/dev/null export --verbose
+	"$@" | done "$@" 'quoted text' --verbose 2>/dev/null
+		-eu sed local test | $(pwd)
+		/usr/bin 'quoted text' sed | /usr/bin "$@" /usr/bin test --verbose &&
+		"$@" readonly printf ${HOME} done then --verbose && &&
+	-eu 'quoted text' echo /usr/bin
+	'quoted text' local awk -eu x=1 /usr/bin 'quoted text' --verbose test export &&
+		echo test local --verbose echo ${HOME}
+		$(pwd) export then test awk ${HOME} $(pwd) readonly $(pwd)
+	'quoted text' $(pwd) sed sed 'quoted text'
+		&& x=1 done sed | ${HOME} done printf 'quoted text'
+	grep then done && --verbose echo grep 2>/dev/null
+		'quoted text' "$@" "$@" ${HOME} export --verbose awk --verbose ${HOME}
+	readonly done ${HOME} ${HOME}
+"$@" then 'quoted text' -eu done ${HOME} test "$@"
+export printf awk ${HOME} 'quoted text'
+		2>/dev/null awk cd | /usr/bin $(pwd) |
+	"$@" && 2>/dev/null /usr/bin grep export readonly sed done "$1" grep export
+	then export 2>/dev/null echo cd --verbose local export
+		'quoted text' "$@" ${HOME} test $(pwd)
+		local 'quoted text' local printf then cd export readonly
+then cd && && readonly "$@"
+2>/dev/null -eu printf awk /usr/bin "$@" "$@" "$@"
+	export local then "$1"
+'quoted text' test echo 2>/dev/null done ${HOME} ${HOME}
+-eu x=1 && -eu done sed ${HOME} --verbose
+		done && "$@" awk && "$@" export grep local sed
+	cd sed --verbose --verbose -eu ${HOME} local
+readonly "$1" 2>/dev/null local /usr/bin x=1 -eu
+	awk grep sed x=1 readonly test 2>/dev/null -eu echo /usr/bin
+	2>/dev/null ${HOME} export |
+	test export $(pwd) $(pwd) --verbose | &&
+-eu awk x=1 done export done cd 'quoted text' done 2>/dev/null grep export "$@"
+	cd ${HOME} --verbose then 2>/dev/null done 2>/dev/null grep export awk "$1" &&
+		'quoted text' --verbose
+-eu | --verbose sed export $(pwd) export x=1 'quoted text' sed | | -eu then
+		/usr/bin sed "$1" test export $(pwd) local --verbose
+	then --verbose printf readonly "$@" done ${HOME} 'quoted text' -eu done cd -eu
+	2>/dev/null printf sed -eu printf sed /usr/bin then -eu cd -eu "$1" grep
+		'quoted text' grep |
+	awk sed 'quoted text' && && -eu then $(pwd) 'quoted text'
+		test test $(pwd) sed readonly cd awk -eu "$1"
+		grep $(pwd) cd /usr/bin echo done
+		sed --verbose cd readonly -eu done echo then cd ${HOME}
+		/usr/bin "$@" export ${HOME} /usr/bin | export
+--verbose printf "$@" 2>/dev/null local 2>/dev/null test export
+		printf awk 'quoted text' && awk 'quoted text' && cd done readonly readonly
+	$(pwd) done export then awk printf
+		--verbose 'quoted text' 'quoted text' export 2>/dev/null
+		"$@" printf --verbose "$1" cd awk --verbose echo
+echo ${HOME} grep test echo awk readonly grep printf
+	x=1 "$1" "$1" local printf export -eu && sed $(pwd)
+		2>/dev/null local 2>/dev/null sed "$1" sed $(pwd)
+export ${HOME} echo awk readonly grep readonly x=1 x=1
+		2>/dev/null $(pwd) /usr/bin /usr/bin done 'quoted text'
+| --verbose x=1 grep readonly printf awk grep echo -eu --verbose
+then export printf done
+	--verbose "$1" $(pwd) cd local $(pwd)
+		x=1 --verbose echo /usr/bin sed printf sed $(pwd) sed -eu /usr/bin export local
+"$1" printf echo sed cd test local
+	'quoted text' $(pwd) --verbose | /usr/bin "$@" readonly readonly grep |
+		test --verbose -eu && done
+		/usr/bin 2>/dev/null "$1" -eu then sed cd &&
+${HOME} 2>/dev/null awk x=1
+	&& -eu 2>/dev/null printf test -eu export test printf $(pwd)
+&& --verbose done grep $(pwd) readonly 'quoted text'
+		test echo local --verbose export test 'quoted text'
+	local -eu readonly /usr/bin && printf 2>/dev/null
+printf grep --verbose export --verbose sed && export sed awk done test cd --verbose
+then 2>/dev/null local awk 2>/dev/null | "$1" echo sed && --verbose
+		printf then cd /usr/bin /usr/bin export local ${HOME} then then $(pwd) cd &&
+		awk ${HOME} --verbose export printf 2>/dev/null 2>/dev/null export
+echo echo --verbose echo
+2>/dev/null test export echo $(pwd) cd 2>/dev/null echo cd /usr/bin 2>/dev/null
+	awk done -eu --verbose "$@" sed sed "$1" -eu printf
+/usr/bin export ${HOME}
+	&& /usr/bin done "$1" printf $(pwd)
+	export 2>/dev/null cd echo readonly then readonly -eu 2>/dev/null sed 2>/dev/null
+	/usr/bin | export 2>/dev/null
+| && cd readonly "$1" readonly
+	--verbose x=1 then $(pwd) done x=1 echo local awk then
+		/usr/bin "$1" then 2>/dev/null grep | export $(pwd) echo local
+awk $(pwd) $(pwd) ${HOME}
+	| /usr/bin echo "$1" -eu x=1
+	/usr/bin -eu --verbose --verbose "$1"
+"$1" export "$@" && "$1" awk done done 2>/dev/null
+	| 2>/dev/null readonly 2>/dev/null echo -eu sed | grep 2>/dev/null
+cd --verbose done sed done $(pwd) $(pwd) sed | -eu
+| && "$1" "$1" && grep 2>/dev/null x=1 && "$1" |
+	done done export 2>/dev/null sed then sed --verbose local awk done echo
+"$1" ${HOME} "$@" 2>/dev/null then
+	local test /usr/bin awk awk $(pwd)
+	| echo printf -eu printf 'quoted text' sed done 'quoted text'
+	awk done && local ${HOME} printf "$@" cd | local readonly cd -eu "$@"
+		x=1 "$@" awk test | export | echo ${HOME} ${HOME} local 'quoted text'
+2>/dev/null printf 2>/dev/null $(pwd) test "$@" && --verbose done /usr/bin
+	awk && readonly "$@" awk readonly cd awk /usr/bin 2>/dev/null export ${HOME} 'quoted text'
+	x=1 then grep "$1" ${HOME} x=1 echo awk "$1" local sed /usr/bin "$@" export
+sed done local printf awk "$1" awk | printf && /usr/bin -eu done | "$@" x=1 /usr/bin
+cd grep test then awk --verbose then $(pwd) done && echo 'quoted text' printf
+		x=1 sed sed "$@" && 'quoted text' awk /usr/bin readonly
+		local awk | && local | grep ${HOME}
+	2>/dev/null $(pwd) "$@" && printf grep ${HOME}
+	test readonly sed 'quoted text'
+"$@" printf | && sed grep done --verbose "$@" && echo then $(pwd) --verbose
+x=1 -eu 'quoted text' x=1 grep "$@" awk &&
+echo echo grep | done awk
+-eu "$@" awk x=1 2>/dev/null
+	printf echo $(pwd) export done "$@" then
+		'quoted text' test then -eu echo awk $(pwd) printf done "$1" echo
+	done awk /usr/bin "$@" /usr/bin -eu -eu awk readonly
+		x=1 "$1" "$@" 'quoted text' grep "$@"
+	--verbose -eu $(pwd) done cd | echo x=1 echo sed "$@" test grep cd test printf echo
+		'quoted text' export && sed sed /usr/bin -eu $(pwd) --verbose
+		| done awk /usr/bin then "$@" "$1" echo test echo "$1" readonly -eu /usr/bin cd
+	'quoted text' | then --verbose /usr/bin -eu
+grep -eu cd --verbose "$@" /usr/bin cd then printf grep "$1" "$1" 'quoted text'
+		done "$@" echo && 2>/dev/null /usr/bin 'quoted text' --verbose cd
+	test 2>/dev/null x=1 echo 2>/dev/null --verbose readonly done readonly
+	2>/dev/null ${HOME} "$@" | "$1" 'quoted text' $(pwd) test
+		echo cd --verbose | export $(pwd) awk readonly | x=1 test echo echo
+	awk export /usr/bin 'quoted text'
+		readonly 'quoted text' | 'quoted text' echo export "$1" "$1" $(pwd) "$1" cd
+	x=1 echo cd ${HOME} x=1 2>/dev/null -eu x=1 'quoted text' |
+--verbose "$@" x=1 awk --verbose "$@" grep /usr/bin
+awk readonly printf cd echo printf 'quoted text' $(pwd) -eu 2>/dev/null
+	/usr/bin $(pwd) export echo sed then && | 2>/dev/null x=1
+		export /usr/bin cd | /usr/bin --verbose
+cd sed 2>/dev/null grep sed $(pwd) 'quoted text'
+	awk local 2>/dev/null "$1" "$1" echo local cd x=1 | x=1
+"$@" sed ${HOME} grep --verbose ${HOME} test 'quoted text' 'quoted text'
+		grep | grep readonly awk echo done x=1 grep
+&& echo sed grep export && export 'quoted text'
+	${HOME} grep sed export ${HOME} /usr/bin -eu -eu awk export readonly cd printf
+test /usr/bin && cd done ${HOME} 'quoted text' echo
+	| echo printf done sed sed x=1 -eu "$@" local x=1 local
+done then export x=1 | && echo printf test && then "$@" | 2>/dev/null echo
+	echo 2>/dev/null ${HOME} && local /usr/bin --verbose && awk echo export then
+"$@" awk ${HOME} --verbose "$1" ${HOME} --verbose
+		grep x=1 ${HOME} test printf $(pwd)
+	test grep "$1" readonly export /usr/bin
+		done local -eu test 2>/dev/null
+		then export cd export cd
+		then then "$1" export done printf done | export $(pwd) "$1"
+		local readonly ${HOME} sed export grep local awk cd x=1
+	done readonly awk -eu "$1" then grep grep readonly printf local test
+		| "$@" "$1" then /usr/bin x=1 readonly echo ${HOME} --verbose echo $(pwd)
+grep 'quoted text' local local echo $(pwd)
+	$(pwd) grep cd "$1" cd ${HOME} cd readonly
+		| "$1" --verbose sed x=1 done x=1 ${HOME} done x=1 ${HOME}
+		"$1" readonly | $(pwd) test | done readonly
+test readonly x=1 x=1 then
+| -eu ${HOME} cd echo 'quoted text' 'quoted text'
+		&& | export done x=1 test awk x=1 then 'quoted text'
+export --verbose | -eu readonly "$1" -eu
+	printf && x=1 then echo x=1 echo 2>/dev/null grep printf readonly x=1 done
+		$(pwd) awk | printf --verbose
+-eu export | grep ${HOME} "$1" echo then "$@" "$@"
+2>/dev/null "$@" echo --verbose && cd /usr/bin "$@" export
+| 2>/dev/null awk local printf | x=1 2>/dev/null | done x=1 "$@"
+x=1 readonly cd local export sed grep
+	'quoted text' grep awk 2>/dev/null --verbose ${HOME} 'quoted text' --verbose
+	2>/dev/null && local cd 2>/dev/null x=1 awk ${HOME} --verbose local
+	2>/dev/null test then /usr/bin 2>/dev/null "$@" -eu cd && test export awk ${HOME}
+grep then readonly 'quoted text' awk "$1" printf done && cd && | done
+	-eu 'quoted text' cd "$@" printf "$@" sed -eu export sed grep readonly
+		"$@" | grep ${HOME} test then 'quoted text' $(pwd) local test printf 2>/dev/null
+		/usr/bin test 2>/dev/null awk echo awk
+"$@" then test then done cd sed 'quoted text' sed cd local ${HOME} then printf
+--verbose x=1 --verbose 'quoted text' -eu /usr/bin -eu
+		'quoted text' && "$1" 2>/dev/null test printf local export --verbose
+--verbose $(pwd) export && "$@" 2>/dev/null grep
+		local && cd cd "$@" -eu /usr/bin awk local test then grep
+		export grep test "$@" 'quoted text'
+	$(pwd) done 2>/dev/null "$@" grep local "$1" printf $(pwd) 'quoted text'
+		awk local local echo -eu /usr/bin awk grep -eu sed | awk printf "$1"
+x=1 cd readonly done sed awk "$@" printf
+grep && printf export readonly "$1" | then
+'quoted text' readonly awk grep -eu
+cd then | grep x=1 grep "$@"
+		-eu printf readonly readonly awk x=1 ${HOME}
+		"$@" && /usr/bin echo local export $(pwd) ${HOME} done printf x=1
+	awk /usr/bin && /usr/bin 'quoted text' cd then grep
+	${HOME} local test ${HOME} printf "$@" sed cd 'quoted text'
+2>/dev/null cd readonly "$@" export "$1"
+done --verbose x=1 printf awk then export echo echo awk then sed
+		x=1 sed --verbose 2>/dev/null "$1" /usr/bin
+	$(pwd) cd 'quoted text' printf | done ${HOME} sed export
+printf test done sed && 'quoted text' then
+		local echo && awk /usr/bin test test sed local | "$@" grep sed $(pwd)
+| then | ${HOME} | then printf sed echo
+then --verbose "$1" test local && x=1 printf 'quoted text' 2>/dev/null && x=1
+	echo /usr/bin 'quoted text'
+	| local && awk 'quoted text' x=1 "$1" export
+awk export sed 'quoted text' done --verbose
+		-eu done x=1 printf test -eu export "$@" ${HOME} awk grep 2>/dev/null
+		printf local | $(pwd) "$@" $(pwd) echo test "$@" /usr/bin
+		cd "$1" local && echo $(pwd) awk /usr/bin
+test | local "$1" echo && test sed 'quoted text'
+		$(pwd) readonly printf done echo "$@" /usr/bin | x=1 | local && printf
+		then export awk export --verbose /usr/bin --verbose -eu test then
+	| awk "$@" $(pwd) sed ${HOME} /usr/bin
+readonly /usr/bin echo "$1" local x=1 --verbose done printf
+	&& printf then echo test 'quoted text' done /usr/bin cd grep
+	x=1 local ${HOME} done sed grep --verbose then local "$@"
+		x=1 2>/dev/null -eu printf printf local "$1" 2>/dev/null /usr/bin
+	"$@" awk "$1" x=1 'quoted text' local -eu sed grep grep sed x=1
+	cd sed | test local -eu
+cd 'quoted text' x=1 done awk ${HOME} $(pwd) "$@" readonly printf sed --verbose
+printf sed "$1" $(pwd) sed awk then test awk ${HOME} local $(pwd) local
+		2>/dev/null echo "$1" test local local echo test
+	"$1" done ${HOME} -eu --verbose "$@" cd ${HOME} 2>/dev/null
+		awk $(pwd) grep /usr/bin $(pwd) awk --verbose grep printf && && readonly
+	printf x=1 /usr/bin -eu printf /usr/bin x=1 && | local printf local
+		$(pwd) export "$1" then "$@" printf grep grep readonly local echo
+&& "$@" done local x=1 'quoted text' /usr/bin
+		grep sed cd 2>/dev/null 'quoted text' grep "$@"
+	done readonly test "$1" 'quoted text' readonly then test 'quoted text'
+printf "$@" | awk local 2>/dev/null && cd --verbose awk ${HOME} "$1" awk echo
+		&& awk && "$1" $(pwd) | grep done ${HOME} -eu | done
+&& awk echo done && 2>/dev/null done export sed /usr/bin ${HOME}
+	sed awk --verbose readonly 'quoted text' ${HOME}
+	local awk cd 'quoted text' test -eu /usr/bin echo
+	"$@" awk 2>/dev/null "$@" 'quoted text' "$1" sed 'quoted text' cd
+		echo | "$1" readonly --verbose -eu 'quoted text' --verbose export then
+		--verbose printf grep test x=1 2>/dev/null
+	"$1" | done export done $(pwd) test $(pwd) "$1" sed
+	printf /usr/bin x=1 -eu "$1" "$1" cd sed x=1 readonly 'quoted text' cd awk
+--verbose cd then awk --verbose
+		then echo --verbose 'quoted text' printf test --verbose -eu sed
+	'quoted text' x=1 && readonly x=1 ${HOME} -eu ${HOME} 2>/dev/null 'quoted text'
+		'quoted text' echo | done
+--verbose done | ${HOME} "$1" printf printf "$@" local printf
+	&& printf 'quoted text' echo && 2>/dev/null $(pwd) done /usr/bin /usr/bin
+	2>/dev/null --verbose grep
+done awk x=1 cd x=1 readonly 'quoted text' sed echo
+	then /usr/bin 'quoted text' test echo then cd
+		cd "$1" | cd --verbose awk test && /usr/bin readonly ${HOME} printf grep
+	cd && -eu readonly $(pwd) -eu | 2>/dev/null printf readonly awk 2>/dev/null
+grep --verbose | printf sed awk $(pwd) cd sed test local test $(pwd) printf
+cd readonly "$@" done "$@" --verbose cd awk && "$1" /usr/bin 'quoted text'
+		${HOME} ${HOME} grep local "$@" echo --verbose local awk awk readonly sed
+	readonly "$@" x=1 then
+sed $(pwd) --verbose local
+readonly readonly done 2>/dev/null
+		x=1 "$@" readonly cd echo x=1 && 2>/dev/null test -eu
+		grep | printf readonly $(pwd) x=1 sed ${HOME} printf "$1"
+	x=1 then -eu --verbose --verbose "$1" export grep cd cd then /usr/bin
+	echo x=1 --verbose readonly test grep echo done 2>/dev/null /usr/bin
+		/usr/bin then | 'quoted text' sed $(pwd) sed "$@" done -eu export "$1" cd grep
+		awk | printf "$@" -eu test x=1 sed done grep /usr/bin $(pwd) printf
+--verbose -eu test 2>/dev/null ${HOME} 'quoted text' cd | $(pwd) -eu printf
+		$(pwd) --verbose grep cd sed "$1" readonly readonly | sed test /usr/bin done "$@"
+		--verbose "$1" | ${HOME} && 2>/dev/null
+		-eu awk then test grep test readonly -eu | x=1 cd "$@" -eu then local
+		local "$1" sed --verbose /usr/bin readonly
+2>/dev/null local -eu 'quoted text' x=1 /usr/bin awk export
+		"$@" cd awk then done 'quoted text' && grep test test then x=1 "$@" then grep
+	-eu grep readonly done readonly echo |
+	local ${HOME} grep "$@" grep
+		local readonly done 2>/dev/null echo | readonly test $(pwd) 2>/dev/null x=1 x=1
+		done awk 'quoted text' 2>/dev/null grep grep then echo sed ${HOME}
+	readonly sed export "$1" ${HOME} awk --verbose
+"$1" "$@" x=1 grep --verbose then then 2>/dev/null --verbose test export
+	/usr/bin local 2>/dev/null x=1 readonly 2>/dev/null /usr/bin 'quoted text'
+		test readonly echo && done "$@" export /usr/bin test "$@" 2>/dev/null then
+		x=1 export -eu readonly 2>/dev/null
+"$@" cd -eu "$1" x=1 && $(pwd) ${HOME} 2>/dev/null echo test done
+	&& "$1" then | export printf $(pwd) done 2>/dev/null
+		| done -eu export "$@" 2>/dev/null grep export -eu ${HOME} &&
+	| awk local 2>/dev/null cd "$1"
+"$1" "$@" cd 'quoted text' -eu printf done
+		-eu -eu 'quoted text' --verbose /usr/bin
+then cd test awk cd test readonly && sed -eu /usr/bin local "$@" local
+-eu done /usr/bin awk "$1" export x=1 && -eu ${HOME} grep test
+| printf ${HOME} /usr/bin "$1" "$1" "$1" sed && | echo
+	then 'quoted text' test 2>/dev/null ${HOME} && | then awk printf
+		readonly && cd echo 'quoted text' | $(pwd) 2>/dev/null
+x=1 awk -eu local then done -eu sed readonly readonly /usr/bin
+		readonly 'quoted text' cd -eu "$@" then --verbose 'quoted text' | && "$@" ${HOME}
+-eu readonly $(pwd) "$@" then printf "$1" /usr/bin echo --verbose
+		x=1 echo 'quoted text'
+		"$@" sed done echo test printf local
+		done done --verbose local ${HOME} cd | /usr/bin | local --verbose 'quoted text'
+"$@" ${HOME} ${HOME} x=1 'quoted text' awk sed readonly --verbose
+		export x=1 ${HOME} grep 2>/dev/null readonly echo ${HOME} /usr/bin then
+cd test -eu x=1 local -eu test 2>/dev/null && "$1" "$1" printf &&
+	2>/dev/null -eu printf grep /usr/bin done $(pwd) /usr/bin
+	readonly && awk x=1 | | grep && export done
+		${HOME} sed readonly --verbose
+		| grep awk $(pwd) 2>/dev/null x=1
+		printf cd $(pwd) x=1 /usr/bin
+	done -eu && sed cd readonly "$@" awk 'quoted text' 2>/dev/null
+printf export ${HOME} 2>/dev/null
+		x=1 -eu --verbose | sed done local | -eu ${HOME}
+2>/dev/null ${HOME} "$@" ${HOME}
+echo 'quoted text' echo 'quoted text' --verbose local sed "$1" &&
+x=1 readonly ${HOME} awk && test
+local export --verbose test "$@" done --verbose done x=1
+	x=1 readonly cd readonly grep -eu $(pwd) ${HOME} --verbose
+/usr/bin 'quoted text' local | -eu && -eu x=1 /usr/bin local
+		"$@" done -eu 2>/dev/null x=1 then printf cd then $(pwd) "$1" "$@" test test "$1"
+	printf grep 2>/dev/null ${HOME} local && ${HOME} | echo | readonly $(pwd) printf
+		done 'quoted text' printf local readonly $(pwd) cd readonly printf
+	| ${HOME} "$1" ${HOME} readonly /usr/bin | awk readonly export /usr/bin
+	/usr/bin "$@" done test $(pwd) | 2>/dev/null cd 'quoted text' 'quoted text'
+cd grep x=1 | test grep 'quoted text' "$@" ${HOME} test "$@" --verbose export --verbose
+	&& then readonly done awk readonly readonly local
+grep /usr/bin sed /usr/bin printf "$@" readonly
+		export && "$@" export &&
+	awk ${HOME} 'quoted text'
+		test then /usr/bin -eu $(pwd) && test
+		printf then then echo export local --verbose /usr/bin local readonly printf
+sed export && sed -eu local ${HOME} printf
+	"$1" "$@" $(pwd) sed cd
+grep echo ${HOME} "$@" "$@" | sed /usr/bin
+	$(pwd) export awk 2>/dev/null | local echo && "$1" cd grep $(pwd)
+$(pwd) then "$1" && $(pwd) /usr/bin $(pwd) awk grep && -eu -eu
+		${HOME} "$@" done "$1" -eu
+	done | printf ${HOME} -eu x=1 export printf 'quoted text' x=1 awk
+		&& sed then done 2>/dev/null ${HOME} "$@" grep readonly | echo cd $(pwd) /usr/bin
+	cd 'quoted text' cd readonly
+		local cd /usr/bin then
+	| -eu local ${HOME} awk export awk 2>/dev/null
+	sed ${HOME} | && $(pwd) | -eu --verbose
+--verbose "$1" 'quoted text' done cd local && cd ${HOME} sed --verbose then -eu
+		${HOME} echo readonly "$1" | awk x=1 awk x=1 grep -eu "$@" ${HOME}
+	local readonly test "$@" "$@" test x=1 local && "$1" echo test $(pwd) done
+readonly grep awk printf ${HOME} readonly readonly
+	printf $(pwd) 2>/dev/null local --verbose
+done echo printf --verbose /usr/bin sed done 'quoted text'
+		"$1" $(pwd) echo | 2>/dev/null
+		&& --verbose -eu readonly "$1" "$@" x=1 x=1 2>/dev/null $(pwd) cd grep
+	cd ${HOME} echo | readonly then x=1
+'quoted text' && --verbose -eu && 'quoted text'
+		local -eu x=1 /usr/bin ${HOME} grep
+&& printf $(pwd) readonly done | export $(pwd) "$1" sed
+		grep x=1 ${HOME} awk awk | sed --verbose "$@" 2>/dev/null grep done readonly grep
+		"$@" 'quoted text' local --verbose
+	| && "$1" 'quoted text' --verbose --verbose
+	x=1 export /usr/bin cd cd sed readonly 2>/dev/null local export
+"$1" $(pwd) cd 2>/dev/null "$@" && 'quoted text'
+	awk local x=1 'quoted text' sed then
+	"$1" x=1 x=1 'quoted text' local ${HOME}
+		test grep export | test /usr/bin
+then test 2>/dev/null grep test local ${HOME} grep && /usr/bin
+		-eu && sed /usr/bin echo "$1" local printf then && readonly local printf
+		test export grep done printf local then x=1 awk export printf done
+	done export $(pwd) readonly "$@"
+"$1" grep "$1" cd x=1 'quoted text' sed echo "$@" /usr/bin --verbose | 'quoted text'
+then "$1" && echo 'quoted text' then && x=1 &&
+	grep readonly then "$@"
+	$(pwd) "$@" $(pwd) $(pwd) test printf 'quoted text'
+	| echo ${HOME} grep --verbose
+$(pwd) 2>/dev/null cd sed "$@" | readonly 2>/dev/null -eu sed $(pwd)
+	awk export export ${HOME} done then done printf ${HOME} $(pwd) grep local
+		readonly local ${HOME}
+		grep $(pwd) $(pwd) 2>/dev/null /usr/bin
+		done -eu awk readonly cd x=1 awk readonly x=1 -eu then readonly
+${HOME} then test "$@" x=1 ${HOME}
+	then 'quoted text' then -eu "$@" 'quoted text' test $(pwd) --verbose
+		local test then "$1" echo sed test then | | "$@"
+"$@" 'quoted text' --verbose "$1"
+		2>/dev/null local printf 2>/dev/null then $(pwd) ${HOME}
+		done cd readonly grep done | printf printf cd -eu ${HOME} $(pwd) done cd
+		then -eu cd $(pwd) awk -eu && then ${HOME}
+	grep sed sed 'quoted text' awk sed -eu /usr/bin sed "$@" then cd cd printf echo
+		2>/dev/null $(pwd) cd 'quoted text' $(pwd) $(pwd) -eu export
+x=1 && 'quoted text' test grep "$1" printf 'quoted text' done --verbose
+		x=1 sed printf 2>/dev/null local echo grep grep done test $(pwd) grep 2>/dev/null
+awk 2>/dev/null --verbose
+	"$1" ${HOME} echo | done 'quoted text' export ${HOME} ${HOME} /usr/bin
+	echo then x=1 $(pwd) sed awk 2>/dev/null 2>/dev/null grep -eu printf ${HOME}
+		'quoted text' | -eu "$@" export -eu done x=1 echo
+		&& --verbose test 'quoted text' ${HOME} readonly
+printf -eu 'quoted text' && -eu then
+	printf local x=1 echo readonly printf readonly export printf
+	-eu cd $(pwd) && "$@" sed export sed printf
+cd $(pwd) 2>/dev/null
+/usr/bin sed printf export --verbose grep
+		export 2>/dev/null done
+${HOME} | test $(pwd) awk
+sed -eu cd -eu "$@" awk "$1" export $(pwd) -eu sed test export echo awk $(pwd)
+	$(pwd) x=1 export "$1" ${HOME}
+		$(pwd) awk --verbose x=1 then 2>/dev/null --verbose export "$1" then
+	$(pwd) "$1" then -eu /usr/bin "$@" awk "$@" test local awk 2>/dev/null /usr/bin
+${HOME} awk ${HOME} --verbose
+		done /usr/bin sed grep -eu echo "$1" "$1" awk grep --verbose readonly done /usr/bin
+2>/dev/null -eu --verbose "$1" ${HOME} ${HOME} printf
+	"$@" 'quoted text' /usr/bin export sed echo sed readonly "$@" -eu
+	readonly x=1 && "$1" export "$@" 2>/dev/null then awk export
+	-eu | done | readonly readonly test then | $(pwd)
+		export /usr/bin printf cd -eu 2>/dev/null 'quoted text' $(pwd) && echo
+	x=1 export readonly printf then /usr/bin test readonly /usr/bin --verbose /usr/bin
+		then sed readonly "$1" -eu test grep
+	x=1 "$1" 'quoted text' local local
+		2>/dev/null "$1" 2>/dev/null then grep printf done
+	test awk 2>/dev/null 'quoted text' cd test
+x=1 readonly readonly 2>/dev/null -eu grep
+	--verbose printf export -eu then && "$1" export grep "$@"
+	echo printf $(pwd) sed grep 'quoted text' 'quoted text'
+	/usr/bin /usr/bin grep cd
+	2>/dev/null test -eu $(pwd) awk $(pwd) x=1 "$@" x=1 "$1"
+--verbose export then test --verbose test
+	local -eu | export x=1 -eu $(pwd) readonly export x=1 -eu
+--verbose x=1 export test then echo export printf export "$1" x=1
+	printf echo test -eu export sed $(pwd) 2>/dev/null "$@"
+local echo echo then | "$@"
+awk -eu ${HOME} grep $(pwd) awk "$1" -eu awk /usr/bin
+"$1" test "$@" "$@" -eu awk test sed printf echo cd test | export
+		${HOME} 'quoted text' done "$1" echo ${HOME}
+--verbose ${HOME} then
+/usr/bin && x=1 "$1" $(pwd) && "$1" done --verbose /usr/bin cd test readonly cd
+		then /usr/bin 2>/dev/null readonly -eu
+		2>/dev/null awk -eu "$@" done 'quoted text' 'quoted text' -eu
+		-eu test printf /usr/bin -eu then sed /usr/bin $(pwd) | "$1" &&
+sed && ${HOME} /usr/bin awk sed local "$1" export grep echo "$1" "$@" "$1"
+grep cd | echo -eu "$@" 2>/dev/null
+	export && x=1 'quoted text' local awk echo done done $(pwd) sed echo ${HOME}
+		done && sed then --verbose "$@" $(pwd)
+-eu | export /usr/bin -eu --verbose
+		$(pwd) $(pwd) x=1 | cd export "$@" | /usr/bin local readonly
+		'quoted text' export then -eu export readonly "$1" && $(pwd) | --verbose grep
+| done grep readonly 2>/dev/null "$@" /usr/bin local &&
+	cd 'quoted text' done awk sed test 2>/dev/null export readonly export /usr/bin
+	&& --verbose readonly test done cd local 'quoted text'
+		&& cd local 'quoted text' --verbose local test "$@" then
+export awk "$@" /usr/bin local cd $(pwd)
+		/usr/bin printf cd $(pwd) sed local
+	printf grep awk test printf then
+$(pwd) 2>/dev/null echo $(pwd)
+		grep local echo -eu "$1"
+grep | && "$1" export then export awk local -eu /usr/bin $(pwd) awk
+	-eu local && grep x=1 x=1 --verbose 'quoted text' "$@" ${HOME}
+		x=1 | sed readonly local 'quoted text' && grep $(pwd) 'quoted text'
+awk printf test /usr/bin "$1" sed 2>/dev/null -eu && sed --verbose
+/usr/bin test export grep && test awk then "$@" $(pwd) $(pwd)
+		then && && && 2>/dev/null echo -eu grep -eu 2>/dev/null "$@" ${HOME}
+'quoted text' $(pwd) $(pwd) "$@" local awk test
+		grep $(pwd) printf x=1 'quoted text' "$@" --verbose /usr/bin --verbose /usr/bin
+		printf awk export local | printf
+	${HOME} --verbose local export -eu
+	sed grep grep printf local echo printf --verbose
+/usr/bin x=1 /usr/bin 2>/dev/null grep local "$@" -eu then $(pwd) test 'quoted text'
+		${HOME} 2>/dev/null 2>/dev/null local --verbose | sed
+| sed | ${HOME} sed cd printf cd ${HOME}
+	export | done grep 2>/dev/null sed | ${HOME} /usr/bin ${HOME}
+	done && $(pwd) --verbose cd $(pwd)
+	"$1" local readonly 'quoted text'
+	"$1" local "$1" && then awk echo -eu local readonly test sed export --verbose local
+	grep cd -eu 2>/dev/null readonly -eu --verbose printf -eu "$@"
+export awk 'quoted text' && && --verbose -eu sed ${HOME} ${HOME} grep echo
+		test 'quoted text' x=1 | export "$1" export ${HOME} && export /usr/bin export
+		${HOME} cd echo && grep ${HOME} | -eu grep
+	| "$1" grep echo readonly $(pwd) x=1 readonly readonly
+cd grep echo && -eu echo && $(pwd) "$@" /usr/bin awk test ${HOME} then | done
+	${HOME} && /usr/bin | export
+'quoted text' sed sed x=1 $(pwd) 2>/dev/null -eu ${HOME} /usr/bin
+&& ${HOME} --verbose x=1 local grep printf grep done printf cd "$@" 2>/dev/null
+	&& /usr/bin ${HOME} ${HOME} test sed $(pwd) 2>/dev/null export "$@" "$1" /usr/bin
+readonly "$@" x=1 | && then grep sed /usr/bin printf sed cd -eu $(pwd)
+	"$@" 2>/dev/null 2>/dev/null test export sed local 2>/dev/null readonly
+cd $(pwd) echo export grep test | printf "$@" test "$1" sed local
+		'quoted text' awk export x=1 readonly
+printf test cd 'quoted text' x=1
+	echo | printf /usr/bin test ${HOME} export 2>/dev/null echo 2>/dev/null done done
+	"$@" && then echo "$1" -eu sed 'quoted text' 2>/dev/null grep readonly 'quoted text'
+sed && 'quoted text' --verbose 2>/dev/null export "$@" -eu ${HOME} local grep cd
+	export "$@" 2>/dev/null x=1 /usr/bin export sed sed "$1" then echo /usr/bin
+	-eu grep printf test 2>/dev/null && | awk --verbose 2>/dev/null
+		grep "$@" local ${HOME} ${HOME} "$@"
+		--verbose readonly "$@" cd
+echo 'quoted text' "$1"
+		--verbose awk --verbose then printf printf /usr/bin /usr/bin 2>/dev/null
+"$1" done -eu echo "$@" sed done "$@" 'quoted text' cd printf printf && "$1"
+	cd $(pwd) 'quoted text' sed "$@" then ${HOME}
+	then readonly | && $(pwd) "$1" --verbose
+printf test $(pwd) | --verbose && test sed awk echo awk done done && -eu
+/usr/bin 2>/dev/null && ${HOME}
+readonly export && -eu
+	grep 2>/dev/null test cd test ${HOME} --verbose readonly $(pwd) 2>/dev/null
+		'quoted text' awk done && echo
+local echo -eu echo --verbose then readonly ${HOME} ${HOME}
+	test awk "$1" awk | -eu
+		awk cd sed -eu test echo test x=1 sed awk local
+export ${HOME} awk cd /usr/bin printf ${HOME} 'quoted text' readonly 2>/dev/null
+grep export && /usr/bin "$@" $(pwd) x=1 | export
+"$@" /usr/bin done "$1" --verbose $(pwd) 2>/dev/null
+$(pwd) -eu printf && sed awk --verbose --verbose ${HOME} cd cd
+	readonly && /usr/bin local && ${HOME} test done && export sed then 2>/dev/null
+awk ${HOME} ${HOME} -eu x=1 --verbose sed grep | x=1 'quoted text' grep awk local
+		echo grep "$@" printf printf
+	/usr/bin 'quoted text' local "$1"
+		export then x=1 | "$1" -eu done grep "$@" "$@"
+		| local echo cd printf -eu
+		'quoted text' readonly 'quoted text' cd | | x=1
+readonly printf then awk ${HOME} test export
+	x=1 then readonly --verbose "$@" awk printf awk 'quoted text'
+		x=1 $(pwd) "$@" 'quoted text' --verbose then done
+	awk readonly then x=1 then $(pwd) echo
+"$@" cd 2>/dev/null --verbose readonly && sed echo x=1 $(pwd) awk ${HOME} /usr/bin
+	${HOME} x=1 x=1 /usr/bin cd ${HOME} readonly cd local --verbose printf
+		grep ${HOME} -eu ${HOME} echo
+	printf $(pwd) local --verbose printf "$1" && | sed "$1" /usr/bin
+	x=1 sed | done 2>/dev/null cd awk then $(pwd)
+		printf "$@" 2>/dev/null awk --verbose 2>/dev/null "$1" "$@" printf | local grep
+	done -eu done && sed then --verbose awk
+		export then "$@" | "$@" printf "$@" -eu printf export sed "$1"
+export grep readonly cd -eu ${HOME} -eu
+	echo then awk done x=1 sed -eu local local local 2>/dev/null cd cd ${HOME}
+grep printf "$1" "$1" grep /usr/bin printf readonly sed then grep
+"$1" export export grep && $(pwd) --verbose -eu 2>/dev/null
+	then $(pwd) cd "$1" local grep export ${HOME} then --verbose
+		local test /usr/bin "$1" --verbose 'quoted text' readonly readonly
+		echo cd ${HOME} local x=1 --verbose $(pwd) /usr/bin echo printf
+"$1" "$1" "$1" done cd printf x=1 awk export -eu -eu | sed readonly ${HOME}
+		test printf | x=1 cd "$@" local 'quoted text' awk /usr/bin "$@" | readonly
+		echo readonly local --verbose
+done ${HOME} done ${HOME} readonly "$1" 'quoted text' ${HOME}
+		grep then | grep 'quoted text' readonly
+awk awk sed && echo done -eu echo grep x=1 $(pwd) test 'quoted text'
+		x=1 then x=1 2>/dev/null
+	awk 'quoted text' printf ${HOME} cd grep test -eu export 'quoted text'
+		then -eu export | sed x=1 printf cd | awk sed | "$@" export grep printf --verbose
+	-eu /usr/bin readonly printf 'quoted text' printf cd cd ${HOME} export ${HOME}
+		x=1 | --verbose cd test sed awk "$1" then
+'quoted text' "$1" readonly 2>/dev/null 'quoted text'
+		$(pwd) && /usr/bin awk "$@" cd 'quoted text' "$@" echo
+		grep --verbose --verbose "$1" done
+	x=1 $(pwd) --verbose test sed readonly /usr/bin $(pwd) export
+		"$1" awk echo /usr/bin ${HOME} readonly
+	$(pwd) printf cd -eu 2>/dev/null printf
+	then "$1" /usr/bin ${HOME} then 2>/dev/null local export done test "$1" cd
+		| --verbose 'quoted text' echo
+	done echo local -eu --verbose && "$@" 'quoted text' x=1 ${HOME}
+		/usr/bin awk echo export 'quoted text' ${HOME} | | cd readonly "$1"
+/usr/bin awk "$1" $(pwd) cd $(pwd)
+&& x=1 "$1" 2>/dev/null && readonly printf then --verbose done | grep test
+	-eu && x=1 && "$1" test test 'quoted text' export -eu --verbose export
+	grep then readonly local $(pwd) "$1" awk export --verbose grep
+	printf grep /usr/bin awk 2>/dev/null sed awk readonly then local "$@" awk
+| cd /usr/bin sed test test export 2>/dev/null 2>/dev/null then
+		cd readonly cd grep test --verbose sed echo "$@"
+		"$@" | /usr/bin /usr/bin grep
+	echo 2>/dev/null 2>/dev/null "$1" export --verbose /usr/bin test "$@"
+		done test $(pwd) test
+&& then 2>/dev/null then
+x=1 awk "$1" x=1 -eu | --verbose grep awk local export $(pwd)
+		readonly --verbose grep readonly cd $(pwd)
+	then local printf echo -eu && /usr/bin "$@" "$1" readonly then $(pwd)
+		$(pwd) export printf $(pwd) awk echo grep "$1" "$@"
+	'quoted text' export "$1" done && | -eu "$1" sed local /usr/bin 'quoted text'
+		--verbose ${HOME} && sed export
+then --verbose "$@" test cd echo grep
+echo grep done awk cd $(pwd) -eu --verbose
+cd "$@" ${HOME} test cd "$@" "$@" x=1 export echo awk
+	'quoted text' done "$@" ${HOME} --verbose "$1" test cd awk --verbose 2>/dev/null
+	--verbose printf export | readonly
+	done -eu sed "$1" local /usr/bin --verbose -eu
+-eu then awk ${HOME} awk ${HOME}
+	cd && test printf && --verbose local 2>/dev/null
+		&& printf | | && echo echo echo test printf export local awk "$1"
+	-eu "$@" awk | sed 2>/dev/null "$1" done then cd | readonly grep "$1"
+export 'quoted text' x=1 --verbose /usr/bin export grep -eu
+"$@" "$1" x=1 x=1 local then sed
+	${HOME} grep awk grep "$@" cd export "$@" done && echo awk export
+		$(pwd) grep "$1" | then "$@" ${HOME} cd echo "$@" 'quoted text'
+		export ${HOME} /usr/bin $(pwd) readonly echo $(pwd) echo $(pwd) 'quoted text'
+		/usr/bin "$1" test && --verbose $(pwd) $(pwd) grep test test test cd |
+		"$1" x=1 test ${HOME} --verbose
+		test 'quoted text' 'quoted text' echo cd "$1" | cd /usr/bin
+	local test "$@" x=1 local 2>/dev/null readonly -eu 'quoted text'
+'quoted text' "$1" && done ${HOME} -eu awk && sed "$@" done "$@" then
+&& export then cd 2>/dev/null /usr/bin && cd | echo $(pwd)
+		then done cd | 'quoted text' local printf x=1 sed then printf then export cd x=1
+		${HOME} && export | "$@" 2>/dev/null
+	export "$1" x=1 echo echo export test export
+		"$@" /usr/bin local /usr/bin
+		test echo sed ${HOME} && grep readonly
+	awk local ${HOME} sed
+	&& /usr/bin grep 2>/dev/null local test printf then readonly
+		'quoted text' test /usr/bin --verbose 2>/dev/null
+		-eu --verbose "$1" "$1" x=1 ${HOME} /usr/bin $(pwd) x=1
+	x=1 sed local local | printf /usr/bin awk -eu readonly awk local export -eu
+	&& ${HOME} /usr/bin awk "$@" awk then "$@" "$@" test
+		--verbose ${HOME} sed /usr/bin printf sed && "$1" 2>/dev/null
+	export x=1 export /usr/bin $(pwd) export "$1" cd awk ${HOME}
+		"$1" grep x=1 $(pwd) local "$1" grep
+	readonly | "$@" $(pwd) "$1" local sed
+&& | ${HOME} grep /usr/bin /usr/bin | "$1" "$@" then then $(pwd) "$@" /usr/bin
+		&& "$@" then ${HOME} readonly export echo done x=1 readonly $(pwd)
+	-eu local $(pwd) x=1 | $(pwd)
+/usr/bin x=1 /usr/bin grep sed x=1 -eu x=1 && --verbose "$@"
+	awk printf x=1 done x=1
+2>/dev/null | x=1 | ${HOME} &&
+		-eu 2>/dev/null 2>/dev/null readonly
+x=1 -eu 'quoted text' then local ${HOME} --verbose x=1 "$1" ${HOME} grep then
+echo --verbose --verbose
+&& 'quoted text' cd echo cd
+grep grep readonly done ${HOME} x=1 -eu && cd test grep
+	readonly echo 2>/dev/null grep "$@" done "$@"
+		then awk done --verbose sed 2>/dev/null "$1" "$1" cd && awk printf
+		'quoted text' export printf --verbose -eu echo ${HOME} test
+2>/dev/null export && grep --verbose "$@"
+	sed local | cd sed sed $(pwd) local /usr/bin
+x=1 grep /usr/bin "$@" local then then printf
+		"$1" "$@" then readonly | grep printf --verbose x=1 sed readonly
+		"$@" ${HOME} sed x=1 -eu export "$1" test "$@" 2>/dev/null
+		test | test cd printf cd then
+		printf x=1 --verbose $(pwd) -eu sed && | $(pwd) /usr/bin
+		sed sed x=1 export x=1 | 'quoted text'
+		--verbose && /usr/bin then /usr/bin && cd 2>/dev/null test && --verbose done
+	export awk local 'quoted text' sed printf 2>/dev/null done printf
+--verbose 2>/dev/null readonly x=1 printf -eu 2>/dev/null
+	echo printf 'quoted text' --verbose x=1 local --verbose printf then
+	sed --verbose done echo 2>/dev/null export $(pwd)
+		2>/dev/null awk -eu echo /usr/bin "$1" printf 2>/dev/null ${HOME} sed grep
+sed sed -eu x=1 /usr/bin | test awk printf $(pwd) && 'quoted text' "$1" echo
+	2>/dev/null cd --verbose ${HOME} 2>/dev/null | "$@" echo test echo then export
+		${HOME} "$1" awk export sed $(pwd) test 'quoted text'
+		2>/dev/null --verbose cd test awk 2>/dev/null x=1 "$@" readonly sed /usr/bin cd
+	echo --verbose readonly export awk readonly export /usr/bin $(pwd) readonly --verbose
+	grep cd readonly sed "$1"
+cd grep "$1" && x=1 "$1" ${HOME}
+	$(pwd) ${HOME} /usr/bin | 'quoted text' 'quoted text'
+| --verbose 'quoted text' sed "$1" readonly --verbose echo "$@" echo
@@ -0,0 +1,2001 @@
+		-eu 'quoted text' 'quoted text'
+--verbose test printf printf
+		/usr/bin && local cd cd test readonly -eu export
+		${HOME} 2>/dev/null done sed sed | test | readonly cd test awk "$1"
+&& $(pwd) readonly local | "$1" /usr/bin
+	&& echo /usr/bin done /usr/bin | cd local "$@" done "$1" "$@" ${HOME} --verbose
+	then "$1" "$@" /usr/bin $(pwd) --verbose
+		echo --verbose readonly
+		'quoted text' | 'quoted text' echo ${HOME} -eu | printf 2>/dev/null
+done /usr/bin local /usr/bin sed done
+		echo 2>/dev/null then && local echo export
+	--verbose x=1 local readonly test ${HOME} local | "$@"
+$(pwd) printf done grep sed then | $(pwd) --verbose 2>/dev/null
+printf readonly 2>/dev/null done x=1 then
+	${HOME} $(pwd) "$@" /usr/bin "$1" then awk
+"$@" grep --verbose x=1 echo export
+		--verbose cd grep "$@" 'quoted text'
+		printf "$1" then "$@" -eu awk local test
+/usr/bin grep 2>/dev/null test export | 'quoted text' $(pwd) "$@"
+awk && printf then x=1 /usr/bin
+		readonly awk "$1" test echo $(pwd) echo export
+		then test | done && |
+	-eu x=1 export export "$@" readonly
+	/usr/bin "$1" grep "$1" "$1"
+		echo sed && | /usr/bin local readonly grep && 'quoted text' local done
+	export local /usr/bin "$@" | x=1 test "$@" then "$1"
+		cd sed awk sed done ${HOME} awk sed $(pwd) x=1 'quoted text'
+	then | 2>/dev/null $(pwd) export local 2>/dev/null printf
+	echo && && "$@" sed local cd awk printf | $(pwd) 'quoted text'
+		/usr/bin awk printf ${HOME} ${HOME} echo local test readonly then
+| readonly /usr/bin awk local echo local x=1 /usr/bin "$1"
+	x=1 sed "$1" grep printf sed /usr/bin readonly /usr/bin /usr/bin && export "$1"
+		printf 'quoted text' "$@" "$@" "$@" $(pwd) readonly echo "$@" printf $(pwd)
+		sed ${HOME} export local 2>/dev/null done --verbose --verbose | 'quoted text'
+		grep 2>/dev/null && -eu ${HOME} printf echo 2>/dev/null /usr/bin test ${HOME} 'quoted text'
+		export done -eu -eu /usr/bin | grep done $(pwd) local "$@" done local 'quoted text'
+	/usr/bin then /usr/bin readonly test export && export printf "$1"
+		--verbose test x=1 cd test && cd grep sed && export 2>/dev/null
+		$(pwd) /usr/bin "$@" /usr/bin
+"$@" cd -eu printf then then
+	sed "$@" test done | awk then printf echo printf
+"$@" echo 2>/dev/null sed --verbose sed "$@" x=1 echo test
+${HOME} | | --verbose | 2>/dev/null
+		| -eu ${HOME} && sed echo
+		2>/dev/null echo x=1 then $(pwd) awk -eu "$@" "$1" 2>/dev/null
+"$@" grep | readonly printf echo awk ${HOME} test "$1" cd sed -eu | echo then
+		then printf test 'quoted text' cd "$1" awk && x=1 echo "$@" echo
+	$(pwd) grep "$@" | awk readonly
+printf "$1" $(pwd) | "$@" done x=1 -eu
+	| --verbose sed $(pwd) ${HOME} && -eu grep echo
+		test then /usr/bin 2>/dev/null $(pwd) export grep x=1 -eu && sed readonly export
+	done x=1 export x=1 done then export /usr/bin cd "$@" printf
+	readonly readonly ${HOME} echo --verbose awk awk printf
+		awk x=1 2>/dev/null 'quoted text' ${HOME} cd
+2>/dev/null x=1 | "$1" cd awk
+		${HOME} $(pwd) readonly 2>/dev/null grep grep export done readonly done
+"$1" grep printf local readonly readonly then echo x=1 echo readonly
+	awk -eu "$@" echo printf then $(pwd) sed printf grep /usr/bin -eu test local 2>/dev/null
+		/usr/bin awk 'quoted text' printf
+		--verbose echo printf local echo echo $(pwd) test $(pwd)
+		grep awk echo then export done -eu echo x=1 "$1" echo cd done done
+	echo 2>/dev/null ${HOME} && cd 2>/dev/null "$@" -eu
+	awk awk && $(pwd) -eu "$@" 'quoted text' /usr/bin
+	--verbose | cd ${HOME}
+		test grep x=1 'quoted text' local x=1 then
+${HOME} --verbose /usr/bin
+	grep 'quoted text' test && 'quoted text' awk ${HOME} sed | -eu
+		-eu local x=1 grep done /usr/bin &&
+	"$@" ${HOME} /usr/bin then grep | --verbose $(pwd) ${HOME} sed awk
+| 2>/dev/null export printf x=1
+		test sed 2>/dev/null "$@" sed && cd export | | "$1" awk test readonly ${HOME}
+		sed then echo awk local done -eu printf 2>/dev/null
+		export --verbose x=1 awk
+x=1 | done local test done export
+	--verbose "$1" printf "$1" -eu then echo
+--verbose --verbose then --verbose --verbose ${HOME} "$@" readonly "$1" ${HOME}
+		"$1" echo 2>/dev/null && sed $(pwd) ${HOME} export echo $(pwd)
+"$@" export $(pwd) $(pwd) | $(pwd)
+		2>/dev/null /usr/bin 2>/dev/null && cd /usr/bin
+--verbose local done --verbose && then x=1 export printf local
+	&& "$1" local ${HOME} cd export
+2>/dev/null | awk test sed && sed -eu done test --verbose then grep test
+		&& test 'quoted text' echo | /usr/bin awk
+		$(pwd) readonly ${HOME} "$@"
+	sed grep awk 'quoted text' local --verbose cd sed readonly
+x=1 test test && done echo
+		"$1" "$1" then && awk printf
+	$(pwd) /usr/bin cd 'quoted text' echo readonly local 2>/dev/null 2>/dev/null
+		sed cd && local /usr/bin printf
+	-eu printf test 'quoted text' $(pwd) $(pwd) done then local then local
+	echo echo readonly done cd && | sed test sed readonly
+		export /usr/bin $(pwd) awk x=1 ${HOME} sed && 2>/dev/null
+	"$1" /usr/bin /usr/bin -eu --verbose 'quoted text'
+		test 'quoted text' 'quoted text' -eu printf x=1 -eu | && local && --verbose cd
+		done test x=1 ${HOME} "$1" && "$@"
+	&& 2>/dev/null cd done
+		awk done awk 'quoted text'
+	local echo -eu $(pwd) done ${HOME} $(pwd) -eu export 'quoted text'
+/usr/bin --verbose test export
+	/usr/bin done -eu $(pwd) $(pwd) |
+	local then awk done then "$@" "$1" ${HOME}
+		export /usr/bin ${HOME} ${HOME} grep then local | "$@" 'quoted text'
+$(pwd) echo ${HOME} test printf printf
+		grep cd then then echo export $(pwd) export 2>/dev/null
+		test -eu /usr/bin "$@" echo readonly 2>/dev/null done
+2>/dev/null $(pwd) sed sed 2>/dev/null test 2>/dev/null echo sed sed readonly
+	echo readonly "$1" local sed --verbose then sed
+	/usr/bin cd echo 'quoted text' | test
+	| printf "$@" export export --verbose -eu ${HOME} 2>/dev/null
+	--verbose test "$@" x=1 | export "$@"
+local then printf awk export -eu "$@" x=1
+echo | $(pwd) "$1" sed
+	x=1 sed printf then && grep x=1 local x=1 sed --verbose
+		printf 'quoted text' awk -eu ${HOME} sed -eu readonly x=1 awk 2>/dev/null
+		local && "$1" | local
+	x=1 readonly printf readonly x=1 /usr/bin sed 'quoted text'
+-eu && export 'quoted text' 2>/dev/null -eu --verbose
+	export /usr/bin local export ${HOME} awk grep
+| 2>/dev/null ${HOME} readonly echo grep "$1" awk
+	${HOME} -eu done echo && export
+	x=1 printf done "$1" --verbose
+&& echo 2>/dev/null grep test "$1" "$@" && -eu then printf "$@" /usr/bin sed &&
+		-eu && ${HOME} readonly $(pwd) cd test 'quoted text' 2>/dev/null
+--verbose x=1 "$1" test local 2>/dev/null && -eu sed cd readonly /usr/bin
+		-eu test done awk test done -eu "$@" sed "$1"
+grep echo sed done "$1" export test export sed 2>/dev/null
+		test ${HOME} readonly x=1 'quoted text'
+	$(pwd) printf "$@" 'quoted text' local export
+	readonly | then /usr/bin local local done ${HOME} done
+		--verbose 2>/dev/null grep x=1 | "$1"
+		echo done cd then export 'quoted text' -eu && local
+	test 2>/dev/null then x=1 cd | test "$@" test readonly 2>/dev/null x=1 grep /usr/bin
+&& -eu readonly ${HOME} /usr/bin -eu readonly 2>/dev/null
+"$@" "$1" local /usr/bin ${HOME} && sed sed export echo awk awk
+		2>/dev/null test -eu $(pwd)
+		echo cd $(pwd) && export then export | -eu "$1" | && echo echo /usr/bin export
+		sed then done cd 'quoted text' -eu cd "$@" export grep grep test echo "$1" test
+		export --verbose /usr/bin test --verbose printf grep awk "$1" "$1" "$1"
+$(pwd) 2>/dev/null 2>/dev/null
+-eu x=1 'quoted text' | then "$@" "$@" -eu ${HOME}
+		local && "$@" export ${HOME}
+		"$@" | ${HOME} 2>/dev/null readonly "$@" 'quoted text' "$1" $(pwd)
+		awk "$1" echo "$@" test --verbose 'quoted text'
+		sed awk test local local --verbose local
+	x=1 readonly -eu done x=1 cd readonly ${HOME} "$@" awk
+x=1 done "$1" 2>/dev/null $(pwd) --verbose done "$1" /usr/bin ${HOME}
+		/usr/bin ${HOME} printf "$1"
+awk awk sed "$1" done done echo | && grep done | done && readonly
+		&& readonly done "$@" 2>/dev/null 2>/dev/null export cd printf done
+	then then $(pwd) | x=1 && x=1 --verbose
+		then 'quoted text' grep && then
+		test ${HOME} ${HOME} "$@" -eu test 'quoted text' local local
+local -eu readonly awk local /usr/bin test test
+&& local test printf local cd 2>/dev/null -eu $(pwd) x=1 grep test local cd cd
+		${HOME} -eu done done done --verbose cd
+		"$1" awk && "$@" awk ${HOME} done | -eu readonly 2>/dev/null x=1 2>/dev/null
+local readonly $(pwd) ${HOME} "$@" $(pwd) /usr/bin awk readonly
+| "$1" "$1" sed $(pwd) /usr/bin --verbose
+	&& cd cd readonly && test export | done
+	readonly && 2>/dev/null then $(pwd) ${HOME}
+		| local "$1" cd cd done readonly test 2>/dev/null readonly test && done -eu
+awk test sed cd sed printf awk readonly printf 'quoted text' cd
+		| done echo then echo --verbose then readonly
+export then 2>/dev/null cd "$1" echo done test | sed /usr/bin "$1" "$@" printf
+	local $(pwd) echo $(pwd) grep && | then echo export
+	then ${HOME} x=1 printf 'quoted text' grep sed 2>/dev/null -eu 2>/dev/null export
+'quoted text' $(pwd) --verbose
+	2>/dev/null done ${HOME} --verbose "$@" "$@" readonly
+-eu grep x=1 && "$1" cd
+readonly 2>/dev/null then readonly && ${HOME} | "$1" export $(pwd)
+awk 'quoted text' | x=1 awk printf readonly && $(pwd) readonly -eu cd "$1"
+sed ${HOME} -eu 'quoted text' 'quoted text' echo readonly | 2>/dev/null
+	awk --verbose | grep grep $(pwd) cd grep export
+&& awk printf ${HOME} local /usr/bin 'quoted text' /usr/bin "$@"
+		/usr/bin printf local $(pwd) test echo && printf test $(pwd)
+		readonly sed "$1" 2>/dev/null echo printf 'quoted text'
+		"$1" awk cd | | printf local "$@" ${HOME} 2>/dev/null
+/usr/bin readonly local printf | printf ${HOME} then --verbose
+cd test sed | /usr/bin test | test "$@" $(pwd) then awk | sed test then
+		cd --verbose sed local
+"$@" then cd $(pwd) | -eu && export echo printf export then --verbose ${HOME}
+printf $(pwd) cd "$@" sed export done printf $(pwd) "$1" "$1" -eu test
+		local /usr/bin readonly 'quoted text' --verbose --verbose grep sed
+		-eu /usr/bin grep sed printf ${HOME} "$@" "$@" 2>/dev/null
+$(pwd) local sed local && "$@" 'quoted text' $(pwd) grep done awk done export /usr/bin
+	readonly | readonly x=1
+		awk done 2>/dev/null /usr/bin $(pwd) grep 2>/dev/null
+		local -eu "$1" $(pwd) $(pwd) ${HOME}
+	grep ${HOME} cd --verbose export local grep ${HOME} $(pwd) | done readonly
+/usr/bin echo local local test done awk && echo
+		then sed printf ${HOME} && local sed test
+&& cd done echo && $(pwd) readonly
+		$(pwd) 2>/dev/null --verbose "$@" grep readonly 'quoted text'
+	cd echo cd /usr/bin readonly "$1" sed sed 2>/dev/null
+		$(pwd) awk -eu ${HOME} $(pwd) -eu then sed && echo "$1" --verbose local sed |
+		x=1 readonly "$@" "$1" test sed &&
+	/usr/bin local && cd "$@" awk $(pwd) | printf ${HOME} --verbose
+"$1" cd readonly then printf
+'quoted text' 2>/dev/null --verbose ${HOME} awk
+	x=1 --verbose awk local && local $(pwd) test then export done
+	"$1" awk test -eu 2>/dev/null --verbose $(pwd) readonly then "$@"
+printf && x=1 test x=1 | local local done grep 2>/dev/null
+	echo local 2>/dev/null | cd
+		x=1 && grep | printf x=1 local 2>/dev/null | -eu sed test x=1 awk
+		grep "$@" /usr/bin local then && /usr/bin "$1" echo
+		sed ${HOME} cd "$1" --verbose done /usr/bin export sed
+readonly && printf done "$@" -eu ${HOME} done -eu printf
+		then ${HOME} awk then echo | test 2>/dev/null sed export $(pwd) --verbose
+		'quoted text' test 'quoted text' done x=1 local done "$@" local --verbose 'quoted text'
+	then $(pwd) 2>/dev/null grep local printf
+		printf test /usr/bin ${HOME} -eu done --verbose
+		grep grep sed | export export | then sed sed "$1" --verbose then ${HOME}
+	local echo grep local "$@" printf 2>/dev/null --verbose
+x=1 awk "$1" "$1" x=1 printf test --verbose
+		export cd "$@" "$@" $(pwd) x=1 -eu /usr/bin export && awk "$1" 'quoted text'
+	printf printf local test
+		--verbose --verbose --verbose local --verbose
+printf 2>/dev/null test -eu x=1 readonly /usr/bin export /usr/bin
+'quoted text' x=1 echo echo -eu local 'quoted text' done |
+	cd 'quoted text' -eu --verbose
+awk awk test done readonly grep awk awk /usr/bin then export
+echo test local --verbose
+	'quoted text' export done local cd sed
+	awk "$1" done /usr/bin then then printf "$@" done
+&& local printf grep done local
+		/usr/bin "$1" 'quoted text' awk printf
+	'quoted text' sed test /usr/bin
+| local 'quoted text' | cd awk cd test $(pwd) 'quoted text'
+		printf sed 'quoted text' --verbose
+		2>/dev/null grep cd &&
+		2>/dev/null --verbose done -eu && "$1" /usr/bin $(pwd) -eu echo test
+test done ${HOME} printf -eu export -eu sed | awk x=1
+		cd done sed sed readonly echo $(pwd) done $(pwd) printf ${HOME} /usr/bin $(pwd)
+	readonly readonly awk export $(pwd) echo printf 'quoted text'
+		x=1 then -eu readonly local export local readonly /usr/bin
+then cd -eu -eu --verbose cd --verbose
+		${HOME} $(pwd) cd export export ${HOME} awk printf grep "$1" export && awk 'quoted text'
+readonly export /usr/bin awk local ${HOME} done grep --verbose echo echo /usr/bin
+		cd 2>/dev/null sed --verbose
+	&& ${HOME} then grep local
+		2>/dev/null && | test $(pwd) cd $(pwd)
+	"$1" /usr/bin | grep done printf done
+grep grep -eu echo -eu -eu export
+sed printf cd echo -eu export test cd "$@" readonly --verbose 2>/dev/null awk
+	$(pwd) -eu | awk printf "$@"
+grep x=1 export $(pwd) -eu echo sed &&
+		"$1" grep ${HOME} sed -eu "$1" x=1
+	$(pwd) printf test 'quoted text'
+		2>/dev/null --verbose /usr/bin test -eu cd ${HOME} done "$@" awk printf
+	export printf then --verbose then cd done
+'quoted text' local grep "$@" | local readonly test /usr/bin cd
+printf cd /usr/bin && local done 'quoted text'
+/usr/bin done 'quoted text' grep $(pwd) export echo local
+${HOME} /usr/bin done --verbose test -eu /usr/bin export grep --verbose
+readonly readonly cd -eu cd readonly -eu test 2>/dev/null readonly done
+then --verbose 2>/dev/null | grep cd $(pwd)
+	readonly | "$@" local --verbose "$1" -eu -eu echo
+sed test grep 'quoted text'
+$(pwd) /usr/bin 'quoted text' | -eu
+	${HOME} ${HOME} cd awk | then grep x=1 $(pwd) then export | ${HOME} 'quoted text'
+		&& "$1" && /usr/bin 2>/dev/null "$@" grep && printf
+	2>/dev/null test done
+	| then echo grep && test then echo export -eu done awk
+--verbose $(pwd) | local ${HOME} done done && local
+-eu local | local && grep printf 2>/dev/null
+done /usr/bin /usr/bin echo ${HOME} cd test grep -eu readonly
+		grep awk --verbose readonly done -eu /usr/bin
+		2>/dev/null 2>/dev/null
+		&& "$@" /usr/bin readonly done
+	x=1 2>/dev/null export
+${HOME} && local --verbose test awk | -eu && $(pwd) $(pwd) /usr/bin 2>/dev/null
+		export | test x=1 echo "$@" --verbose readonly --verbose local awk x=1 'quoted text'
+printf sed printf $(pwd) export echo printf --verbose "$@" awk done
+	| cd --verbose && x=1 awk readonly
+	printf --verbose cd "$@" echo grep x=1 sed "$@" export x=1 ${HOME}
+		--verbose $(pwd) cd echo /usr/bin then printf
+	-eu "$1" && export grep ${HOME} echo "$1" x=1 x=1 2>/dev/null
+		local echo test --verbose 2>/dev/null done 2>/dev/null done "$1" /usr/bin test
+test printf && test 2>/dev/null -eu $(pwd) ${HOME} done ${HOME}
+export | then sed grep printf x=1 | then echo "$@" echo /usr/bin --verbose
+		grep sed /usr/bin $(pwd) $(pwd)
+awk --verbose ${HOME} /usr/bin test -eu /usr/bin then printf local --verbose 2>/dev/null
+'quoted text' then ${HOME} printf "$1" test
+	"$1" -eu export awk grep | test grep /usr/bin
+'quoted text' /usr/bin test -eu echo
+		'quoted text' awk "$1" then echo local
+sed /usr/bin test && then test then "$1" then export sed $(pwd) sed "$@" awk
+	&& "$1" test -eu && export x=1 sed ${HOME} x=1 then cd printf awk local
+	--verbose cd 'quoted text' 2>/dev/null --verbose
+	| echo done "$@" then sed local 2>/dev/null local done -eu export $(pwd) 'quoted text'
+	printf then echo readonly cd done readonly awk "$@" echo /usr/bin
+	-eu grep echo 2>/dev/null readonly && $(pwd) grep --verbose local test "$1" done
+${HOME} "$@" && echo test sed printf "$1" x=1 "$@"
+		-eu sed awk ${HOME} grep ${HOME} x=1 then && local
+	awk sed | local then | 'quoted text'
+	echo "$@" export -eu 2>/dev/null
+export | | "$@" && | $(pwd) /usr/bin && readonly
+		echo ${HOME} "$1" echo $(pwd) "$@" ${HOME} 2>/dev/null local
+echo test cd local printf done | -eu readonly 2>/dev/null
+		readonly x=1 $(pwd) "$@" grep -eu 'quoted text'
+		awk echo "$@" readonly local export /usr/bin awk done
+	done test "$1" -eu x=1 ${HOME} printf local
+	&& local "$@" && 'quoted text' local
+	| test export 2>/dev/null $(pwd) then "$@"
+	-eu "$@" echo readonly done /usr/bin
+		echo done cd printf x=1 local ${HOME} $(pwd) echo "$@" ${HOME} "$@"
+-eu test readonly sed x=1 done ${HOME} cd 'quoted text'
+test echo -eu x=1 local 2>/dev/null $(pwd) test
+	readonly export | done grep done then then cd then | x=1 --verbose
+	printf done awk printf cd done "$1" ${HOME} awk --verbose
+		$(pwd) && x=1 "$@" printf printf local 2>/dev/null
+sed test awk awk 2>/dev/null
+	| ${HOME} 'quoted text' -eu local sed printf local
+		sed sed then printf --verbose cd $(pwd) && 2>/dev/null test grep test sed
+grep export grep -eu echo cd cd local echo -eu /usr/bin done then
+	printf test local --verbose "$1" | then printf cd &&
+| 2>/dev/null "$@" cd printf local grep awk 'quoted text' test 2>/dev/null 2>/dev/null
+$(pwd) && grep 'quoted text' printf "$@" && then done echo
+		printf done --verbose awk readonly "$1" ${HOME} readonly awk printf
+		sed printf -eu && | then cd done --verbose && cd "$1" 'quoted text'
+	then x=1 && test echo test awk
+${HOME} printf sed "$1"
+$(pwd) 2>/dev/null test $(pwd) --verbose x=1
+printf cd $(pwd) printf -eu && $(pwd) then x=1 $(pwd) export ${HOME} cd
+		sed "$@" "$1" /usr/bin &&
+		done /usr/bin ${HOME} 'quoted text'
+	x=1 ${HOME} echo cd ${HOME} local test "$1" cd
+	readonly --verbose sed --verbose echo cd export printf
+		"$1" --verbose printf echo awk "$1" "$@" | test
+		&& readonly done "$@"
+--verbose && then cd "$@" "$1"
+/usr/bin done echo cd | "$@" $(pwd) 'quoted text'
+test local 2>/dev/null readonly 2>/dev/null
+	grep grep x=1 && done export
+		sed "$1" 'quoted text' -eu 2>/dev/null printf echo local echo printf
+cd ${HOME} export grep /usr/bin echo 2>/dev/null -eu local ${HOME}
+'quoted text' "$1" cd 2>/dev/null then then --verbose ${HOME} | 'quoted text'
+	local ${HOME} cd done "$1" /usr/bin export export $(pwd) --verbose printf
+cd grep $(pwd) $(pwd) cd x=1 export $(pwd) export | done "$1" readonly
+		awk /usr/bin then x=1 $(pwd) -eu test awk x=1 awk 'quoted text' ${HOME} readonly
+'quoted text' readonly
+--verbose local $(pwd) cd 2>/dev/null test --verbose sed 2>/dev/null
+readonly printf /usr/bin printf export 'quoted text' grep sed 2>/dev/null
+	2>/dev/null awk awk -eu
+${HOME} && 2>/dev/null 'quoted text'
+$(pwd) local export ${HOME} test "$@" /usr/bin
+"$1" done -eu sed test echo x=1 $(pwd) x=1 'quoted text' local -eu then readonly
+		grep $(pwd) awk -eu test awk x=1 cd readonly ${HOME} readonly 2>/dev/null
+		local done printf -eu then grep done test
+	sed ${HOME} grep echo "$1" cd -eu printf ${HOME}
+		awk then echo | $(pwd) done cd ${HOME} && x=1 then done --verbose && --verbose
+	/usr/bin cd sed 'quoted text' 'quoted text'
+done awk "$1" local done cd sed x=1 -eu echo export | grep && ${HOME} readonly &&
+	awk echo grep then | && test 'quoted text' then local export --verbose
+"$@" && local $(pwd) done test export "$@" /usr/bin grep export local
+		--verbose 'quoted text' 2>/dev/null
+"$1" done cd | test done export 'quoted text' x=1 'quoted text'
+"$@" sed $(pwd) 2>/dev/null ${HOME} && readonly ${HOME} sed x=1 | grep
+grep "$@" awk readonly && test /usr/bin 'quoted text'
+		2>/dev/null "$@" 'quoted text' test echo | x=1 readonly printf
+sed then done awk grep echo done "$1" 2>/dev/null 'quoted text'
+	--verbose /usr/bin export 2>/dev/null readonly test done --verbose
+cd --verbose $(pwd) $(pwd) "$1" printf
+		test "$1" 2>/dev/null echo ${HOME}
+	awk awk grep then readonly 2>/dev/null -eu export readonly
+2>/dev/null cd 2>/dev/null export $(pwd) "$@" ${HOME} $(pwd) "$@" 'quoted text'
+		test 'quoted text' sed ${HOME} -eu local awk ${HOME}
+cd echo done x=1 /usr/bin
+| awk local --verbose --verbose 2>/dev/null readonly
+done local x=1 "$@" done grep awk readonly done readonly readonly
+x=1 2>/dev/null printf test awk 'quoted text' x=1 | readonly sed $(pwd)
+awk readonly --verbose done 'quoted text' export $(pwd) && readonly ${HOME}
+	/usr/bin "$@" done | $(pwd) -eu sed 'quoted text' cd ${HOME} "$1" grep
+		cd done echo then awk "$1" "$1" $(pwd) $(pwd) sed $(pwd) x=1 ${HOME}
+	awk --verbose test then /usr/bin
+then printf x=1 "$@" awk grep x=1 readonly cd test then 'quoted text'
+echo "$@" echo 2>/dev/null export readonly readonly $(pwd) local then --verbose
+sed 'quoted text' export | /usr/bin sed 'quoted text' && 2>/dev/null $(pwd) test
+		"$1" /usr/bin -eu readonly --verbose awk && awk
+	--verbose --verbose --verbose done done sed --verbose "$1" cd
+	'quoted text' done 'quoted text' done &&
+awk | $(pwd) "$1" echo cd "$1" "$@" 'quoted text' "$@" $(pwd)
+	cd then "$1" $(pwd) $(pwd) 'quoted text'
+		cd export test done --verbose 'quoted text' "$@" 2>/dev/null ${HOME} grep
+	printf export $(pwd) 'quoted text' cd test cd export
+		"$1" ${HOME} grep done grep awk readonly then done | echo $(pwd)
+/usr/bin grep sed printf cd export | echo echo awk echo sed readonly && sed grep
+test "$1" readonly $(pwd) 2>/dev/null readonly cd 'quoted text'
+		| done 2>/dev/null cd echo test -eu --verbose "$@" "$1" sed ${HOME} | export grep
+		echo | x=1 --verbose 'quoted text'
+		sed /usr/bin /usr/bin done | 'quoted text' readonly 2>/dev/null ${HOME}
+printf "$@" && printf /usr/bin export --verbose
+&& cd export && "$1" /usr/bin
+&& -eu "$@" readonly -eu ${HOME} sed echo local $(pwd) $(pwd) --verbose
+	export 'quoted text' --verbose local "$@" awk $(pwd) awk 'quoted text'
+	2>/dev/null test printf /usr/bin done then --verbose
+	echo -eu --verbose "$@" printf && done done $(pwd) 'quoted text' printf "$1"
+	printf $(pwd) "$@" local ${HOME}
+${HOME} /usr/bin cd test x=1 awk
+	| /usr/bin readonly | ${HOME} printf printf printf local /usr/bin then
+| /usr/bin "$1" echo --verbose echo echo then cd cd 'quoted text'
+readonly ${HOME} echo ${HOME} export 'quoted text'
+		"$1" export cd printf echo |
+sed sed 2>/dev/null ${HOME} && sed -eu awk test test -eu | 2>/dev/null x=1 readonly
+	| "$@" local test 2>/dev/null readonly $(pwd) done grep
+		/usr/bin test ${HOME} test readonly
+sed grep echo printf ${HOME} test 'quoted text'
+test $(pwd) printf "$1" then export && "$@" "$@" test 2>/dev/null grep sed
+		x=1 'quoted text' test ${HOME} awk --verbose export
+		export && awk 'quoted text' "$@" printf $(pwd) test awk local sed --verbose
+"$1" readonly then printf ${HOME} grep awk
+		test printf | export awk export
+	export --verbose x=1 readonly awk test --verbose 2>/dev/null
+	readonly export done && 2>/dev/null echo
+		sed 2>/dev/null test cd export --verbose grep "$@" 'quoted text' /usr/bin
+'quoted text' local local local
+		/usr/bin $(pwd) awk $(pwd) export grep
+grep | && sed readonly ${HOME} /usr/bin "$@" -eu "$1" done ${HOME}
+then --verbose done echo --verbose
+	"$1" 2>/dev/null awk "$@" readonly
+export 2>/dev/null awk $(pwd) printf x=1 awk sed grep export 2>/dev/null
+'quoted text' sed ${HOME} readonly "$1"
+"$1" awk test sed export 2>/dev/null -eu $(pwd) /usr/bin
+		echo 'quoted text' printf readonly x=1 echo | "$@" sed "$1" local test
+		--verbose 2>/dev/null | grep then "$@" && --verbose awk echo readonly
+		grep "$1" awk awk --verbose
+	x=1 --verbose printf && sed ${HOME}
+done 2>/dev/null $(pwd) readonly "$1" --verbose awk grep $(pwd) "$@" | export
+		sed ${HOME} echo "$1" "$@" grep
+	'quoted text' then done sed $(pwd) export $(pwd) readonly
+"$@" export awk 'quoted text' 'quoted text' local
+export cd x=1 ${HOME} 'quoted text' -eu ${HOME} && local &&
+	test /usr/bin then | cd --verbose && /usr/bin
+export readonly 2>/dev/null -eu then export 'quoted text'
+		2>/dev/null | "$1" --verbose x=1 then awk export local 'quoted text' readonly /usr/bin
+	&& && "$@" && x=1 ${HOME}
+		sed export 2>/dev/null then export | $(pwd) export readonly
+	$(pwd) /usr/bin printf 'quoted text'
+	done /usr/bin "$@" x=1 export awk test sed --verbose then "$@" export grep echo
+	-eu readonly $(pwd) sed -eu "$@" then 2>/dev/null readonly grep
+		/usr/bin then | /usr/bin "$1" "$@" done readonly --verbose
+		grep cd "$@" local "$@" "$@" export echo awk | | | --verbose && grep 'quoted text'
+done --verbose "$1" "$1" printf
+	printf export then 'quoted text' /usr/bin awk printf export echo --verbose
+-eu then --verbose 'quoted text' 2>/dev/null | --verbose readonly
+	then cd | local /usr/bin awk grep
+'quoted text' && "$@" printf x=1 --verbose "$@" | x=1 'quoted text' done local
+	test then -eu echo x=1 local --verbose 'quoted text' local done local printf
+--verbose --verbose local ${HOME} printf sed "$1" 'quoted text'
+-eu "$@" -eu --verbose 2>/dev/null 2>/dev/null -eu done cd x=1 echo ${HOME} "$@"
+	${HOME} done done then test && sed
+		done "$@" /usr/bin local
+	echo "$1" --verbose cd local && | "$1" sed printf /usr/bin grep
+export test done awk test $(pwd) local | | "$1"
+		"$@" test export $(pwd) 'quoted text' 2>/dev/null
+	echo x=1 'quoted text' readonly --verbose test sed $(pwd) | ${HOME} then cd
+		sed -eu 'quoted text'
+x=1 2>/dev/null x=1 export -eu awk sed grep /usr/bin echo printf export |
+		$(pwd) grep "$@" cd --verbose printf && /usr/bin
+		test 2>/dev/null then -eu -eu
+	${HOME} -eu export test
+	echo $(pwd) done echo done readonly
+	test | then /usr/bin awk "$1" $(pwd)
+	then readonly x=1 echo /usr/bin local
+		then $(pwd) 'quoted text' "$@" | && x=1 --verbose x=1 sed test $(pwd) 2>/dev/null
+--verbose then | done cd export cd --verbose $(pwd) "$1" /usr/bin
+	printf && | export ${HOME} then echo readonly -eu
+		grep "$1" --verbose --verbose x=1 |
+x=1 /usr/bin cd $(pwd) awk -eu "$@" sed grep awk "$1" x=1
+$(pwd) | --verbose -eu "$1"
+	-eu ${HOME} done 'quoted text' grep | "$@" --verbose local | 2>/dev/null ${HOME}
+	&& x=1 "$1" | ${HOME} export 'quoted text' grep
+	export grep sed x=1 printf export readonly cd awk then -eu "$1"
+	&& ${HOME} test | -eu sed ${HOME} /usr/bin 2>/dev/null
+2>/dev/null readonly cd | $(pwd) -eu -eu /usr/bin then "$1" awk 'quoted text'
+x=1 awk && ${HOME} local sed $(pwd)
+		echo "$@" | /usr/bin "$1" then
+		printf then "$1" sed -eu 2>/dev/null ${HOME}
+export test "$1" "$@" x=1 2>/dev/null done
+	sed export echo awk test x=1 'quoted text'
+		test -eu x=1 sed export /usr/bin --verbose x=1 | readonly cd sed "$@" ${HOME}
+	echo cd "$1" test awk done test
+	${HOME} "$1" | printf "$1" printf
+	"$1" /usr/bin local then export grep cd cd sed 2>/dev/null test
+	done echo echo local 'quoted text' x=1 test export
+echo export x=1 echo grep done "$1" ${HOME}
+		export sed 'quoted text' readonly echo
+	then cd 'quoted text' "$@" -eu test local printf cd
+"$@" 2>/dev/null sed readonly | done
+		&& then sed "$1" -eu test done done x=1 local /usr/bin $(pwd) done done && local
+export test 2>/dev/null done $(pwd) $(pwd) && echo
+cd sed readonly export printf 2>/dev/null test then local grep x=1 awk
+echo echo local x=1 export 2>/dev/null echo export cd "$1" export
+		echo ${HOME} ${HOME} local printf awk 2>/dev/null
+		cd local done readonly readonly $(pwd) readonly echo
+/usr/bin "$1" --verbose | sed | /usr/bin && /usr/bin -eu then "$1" /usr/bin
+		grep "$1" export printf done "$@" then 'quoted text' local /usr/bin local done
+		awk export printf 'quoted text' && ${HOME} echo 'quoted text' | x=1 export
+echo $(pwd) $(pwd) test $(pwd) 2>/dev/null && printf sed ${HOME}
+		grep printf test 'quoted text' local $(pwd) done -eu export
+	/usr/bin $(pwd) done 'quoted text' --verbose -eu && readonly x=1 $(pwd)
+local awk printf sed "$1" export echo /usr/bin readonly | then export /usr/bin
+x=1 readonly echo cd && grep $(pwd) echo echo x=1 grep
+		${HOME} --verbose awk 2>/dev/null -eu sed cd printf done | test sed
+	readonly /usr/bin awk "$@" $(pwd) readonly export
+	test -eu && /usr/bin sed
+		${HOME} "$1" sed printf printf
+grep | awk grep export /usr/bin cd 2>/dev/null local ${HOME}
+readonly x=1 ${HOME} | ${HOME}
+-eu "$1" --verbose 2>/dev/null printf | echo export test printf $(pwd)
+	/usr/bin grep then && cd awk test
+sed local x=1 && grep /usr/bin | test then awk printf then done
+		&& /usr/bin cd --verbose printf echo ${HOME} /usr/bin ${HOME} "$1" $(pwd)
+		"$@" $(pwd) grep sed --verbose x=1 | then cd ${HOME} test
+"$1" awk "$@" test "$1" sed && grep local $(pwd)
+	done echo export "$@" grep test | sed echo cd local 'quoted text' printf
+then grep 'quoted text' export printf /usr/bin ${HOME} grep "$1"
+done -eu 'quoted text' x=1 sed sed "$1" done printf test cd awk printf && ${HOME}
+		test then 2>/dev/null /usr/bin && grep /usr/bin
+	x=1 printf readonly echo readonly local printf 'quoted text' echo
+'quoted text' grep local test test ${HOME} then test done 'quoted text' -eu
+local echo echo && export local then 2>/dev/null
+grep echo 'quoted text' cd x=1 && then
+	'quoted text' "$1" sed "$1" echo done printf -eu awk cd
+-eu test x=1 | $(pwd) 2>/dev/null $(pwd) -eu local done local
+		${HOME} $(pwd) 2>/dev/null grep && "$@" | done done test && grep readonly
+		local && cd echo $(pwd) awk
+	export test && -eu cd readonly && printf "$@" "$@" test done awk grep test printf
+	&& then readonly readonly done --verbose echo awk && grep printf
+	'quoted text' x=1 export done printf echo ${HOME} cd then 'quoted text'
+echo readonly then 2>/dev/null 'quoted text'
+	| && --verbose $(pwd) grep ${HOME} readonly "$@" readonly ${HOME}
+	grep cd sed /usr/bin readonly && awk $(pwd) echo 'quoted text'
+	2>/dev/null echo export local grep
+		| then awk | awk --verbose cd $(pwd) 'quoted text' "$1" "$@"
+printf | local "$@" ${HOME}
+	x=1 $(pwd) && done sed $(pwd) then
+		test done ${HOME} $(pwd) local 2>/dev/null ${HOME} then export -eu
+		echo --verbose 'quoted text' /usr/bin "$1" awk test sed local
+| && && local readonly 'quoted text'
+readonly ${HOME} then x=1 "$1"
+	| --verbose $(pwd) "$@" $(pwd) "$1" "$1" && "$1" x=1 export x=1
+	export test grep done grep --verbose 'quoted text'
+-eu printf x=1 2>/dev/null /usr/bin
+$(pwd) -eu | && -eu x=1 $(pwd) --verbose | ${HOME}
+	done local grep | && export readonly --verbose then readonly export
+	cd test done "$1" export sed echo ${HOME} readonly done printf awk awk
+	readonly | /usr/bin "$@" x=1 export -eu then printf "$@" sed printf test
+		$(pwd) done local grep ${HOME} -eu &&
+	2>/dev/null local x=1 local readonly done echo && sed
+		local --verbose ${HOME} /usr/bin --verbose | awk sed ${HOME}
+	/usr/bin sed x=1 awk 2>/dev/null /usr/bin readonly done
+-eu export done -eu /usr/bin then readonly --verbose $(pwd) && cd local |
+	$(pwd) -eu --verbose grep $(pwd) | echo grep $(pwd) ${HOME} ${HOME}
+readonly then && then 2>/dev/null /usr/bin 'quoted text' sed export "$1"
+	awk | sed cd 'quoted text' echo /usr/bin 2>/dev/null sed
+then ${HOME} "$1" echo done
+		| local cd grep "$1" done 'quoted text' awk cd test done ${HOME}
+	&& 2>/dev/null cd then /usr/bin printf
+		| awk && "$1" local echo
+	test "$1" $(pwd) local ${HOME} --verbose && sed 'quoted text'
+		$(pwd) ${HOME} then readonly
+		grep $(pwd) then export $(pwd) local then
+&& test done readonly 2>/dev/null
+readonly test local /usr/bin echo
+	grep cd && readonly export test then
+	printf $(pwd) awk "$@"
+x=1 printf --verbose then sed done | local readonly
+"$1" x=1 && && test then sed "$@" "$@" sed echo x=1 awk && test export readonly
+/usr/bin ${HOME} sed --verbose sed sed printf
+grep readonly 'quoted text' ${HOME} "$1"
+	readonly done then "$@" awk sed 2>/dev/null | test 'quoted text' sed cd
+		"$1" "$@" cd done --verbose -eu test 2>/dev/null
+		echo --verbose -eu x=1 "$@" $(pwd) | awk 'quoted text' test
+		grep -eu test sed readonly local sed 2>/dev/null x=1 && awk
+		$(pwd) 2>/dev/null 'quoted text' | x=1 readonly -eu
+		then 'quoted text' | readonly $(pwd)
+		printf ${HOME} -eu && /usr/bin done done echo then then --verbose --verbose cd
+x=1 x=1 -eu "$1" && 2>/dev/null done /usr/bin awk
+x=1 ${HOME} -eu sed readonly
+	sed done -eu 'quoted text' readonly local && | && done /usr/bin awk 2>/dev/null
+	then x=1 "$1" printf /usr/bin
+"$@" done 'quoted text' /usr/bin
+	cd awk $(pwd) printf $(pwd) "$@" grep
+"$@" /usr/bin /usr/bin cd --verbose awk -eu sed echo printf | | export cd 'quoted text'
+		${HOME} echo /usr/bin cd cd ${HOME} export awk /usr/bin 'quoted text'
+		then readonly --verbose "$1" export && printf done 'quoted text' 2>/dev/null x=1
+		2>/dev/null echo echo "$@" readonly --verbose
+		${HOME} ${HOME} export &&
+	"$1" cd "$1" readonly $(pwd) echo cd printf then awk done "$@" grep "$1" local
+	/usr/bin cd test | awk /usr/bin ${HOME} test $(pwd) printf done readonly
+	then printf -eu done --verbose x=1 grep
+	x=1 "$@" readonly /usr/bin
+		&& echo /usr/bin then grep 'quoted text'
+	${HOME} local 'quoted text' $(pwd) "$@" "$@"
+-eu done done echo --verbose awk "$@" x=1 cd "$@" 2>/dev/null $(pwd) local "$1"
+local then sed sed x=1 awk 2>/dev/null echo x=1 ${HOME} cd printf
+		sed && done readonly printf "$@" x=1 then readonly grep
+done | then local /usr/bin
+test test && 2>/dev/null "$1" $(pwd) 2>/dev/null then "$@" grep "$@" export
+	&& 2>/dev/null done | "$@" -eu "$@" -eu --verbose test sed ${HOME} readonly
+	-eu "$1" sed ${HOME} local -eu "$1" then -eu | x=1 grep then /usr/bin
+printf sed 2>/dev/null done sed | printf awk | readonly sed 'quoted text' 2>/dev/null
+		'quoted text' $(pwd) echo && then cd export 'quoted text' test awk
+'quoted text' cd readonly then awk && echo echo -eu --verbose grep awk test
+	export readonly done "$@" done
+		&& readonly test readonly export x=1
+		sed -eu readonly $(pwd) 2>/dev/null -eu "$1" cd sed x=1 sed 2>/dev/null
+	'quoted text' grep grep done awk | ${HOME} done then cd sed sed ${HOME}
+&& test ${HOME} grep 2>/dev/null local "$@" "$1" cd awk
+	"$1" 'quoted text' export printf 'quoted text' local
+		export printf then ${HOME} then done && "$@" && ${HOME} local x=1 /usr/bin
+| sed readonly then done sed x=1 sed local
+sed cd grep x=1 2>/dev/null echo | grep
+sed printf readonly cd /usr/bin && done printf 'quoted text' echo | readonly
+"$@" ${HOME} -eu /usr/bin cd --verbose --verbose local 2>/dev/null printf printf
+	awk | 'quoted text' x=1 printf test ${HOME} readonly -eu /usr/bin
+		awk 2>/dev/null 2>/dev/null
+$(pwd) export "$@" test done /usr/bin
+--verbose awk sed /usr/bin readonly sed x=1 && awk awk
+local sed test local local cd sed $(pwd)
+		"$@" /usr/bin readonly $(pwd) local echo printf echo
+		2>/dev/null $(pwd) 2>/dev/null
+		awk done x=1 x=1 readonly
+2>/dev/null export 'quoted text' then | ${HOME} /usr/bin
+	2>/dev/null export awk
+2>/dev/null -eu -eu done x=1 printf printf then
+readonly $(pwd) /usr/bin
+echo local readonly /usr/bin 'quoted text' test test 2>/dev/null
+2>/dev/null "$@" "$@" x=1 grep test sed x=1 awk ${HOME} test then x=1
+readonly $(pwd) awk "$@" --verbose local awk && $(pwd) "$1" done ${HOME}
+	test ${HOME} 'quoted text' local $(pwd) cd | export 'quoted text'
+		"$1" done | export && ${HOME} /usr/bin sed done /usr/bin "$@" && | local "$@"
+		printf $(pwd) grep grep "$1"
+		printf ${HOME} sed grep $(pwd) printf ${HOME} export -eu
+		-eu then --verbose done echo -eu grep echo -eu "$1" -eu
+2>/dev/null x=1 export export x=1 /usr/bin export echo export -eu
+	echo --verbose cd 'quoted text' done awk -eu cd readonly | 2>/dev/null
+		--verbose /usr/bin printf "$@" cd grep local
+		echo -eu test awk && export awk $(pwd) -eu echo $(pwd) && awk cd
+	test sed sed awk then readonly grep printf
+		printf cd export | grep /usr/bin --verbose test printf "$1"
+x=1 --verbose printf awk ${HOME} echo
+then x=1 echo printf sed cd
+		-eu awk && "$@" -eu readonly /usr/bin local "$1" $(pwd) then "$1" grep && /usr/bin
+	$(pwd) 'quoted text' && 2>/dev/null then 2>/dev/null /usr/bin ${HOME}
+	&& sed sed "$1" && readonly
+	/usr/bin echo export --verbose | x=1 $(pwd)
+		$(pwd) --verbose echo local
+echo printf local -eu export ${HOME} 2>/dev/null
+		printf /usr/bin -eu "$1" local echo 2>/dev/null --verbose 2>/dev/null
+awk /usr/bin 2>/dev/null done 2>/dev/null
+"$@" /usr/bin 'quoted text' readonly --verbose
+		then --verbose && && cd 'quoted text' echo -eu
+		test test cd local --verbose ${HOME} cd then -eu cd /usr/bin x=1 "$1" then --verbose
+| x=1 test awk done done 'quoted text' /usr/bin
+printf 2>/dev/null | readonly
+	/usr/bin echo printf awk 'quoted text' "$1" -eu echo && cd 'quoted text' ${HOME}
+	readonly echo echo then /usr/bin
+	done ${HOME} test test grep cd $(pwd) && --verbose test grep then "$@"
+sed | 2>/dev/null readonly sed cd 2>/dev/null /usr/bin echo
+awk done "$@" grep | 2>/dev/null ${HOME}
+		readonly grep printf /usr/bin
+test export "$1" --verbose "$@"
+	sed /usr/bin x=1 --verbose sed x=1 $(pwd) 'quoted text' -eu
+	x=1 "$1" $(pwd) -eu readonly
+		--verbose --verbose | 'quoted text'
+	local test -eu $(pwd) cd $(pwd) test 'quoted text'
+	printf done "$@" cd sed printf --verbose $(pwd) export
+	-eu -eu --verbose ${HOME} /usr/bin cd -eu readonly
+	"$1" | -eu "$1" --verbose && /usr/bin export "$@" /usr/bin awk local
+	/usr/bin test echo "$1" then ${HOME} export awk cd readonly x=1 done -eu cd
+		$(pwd) 2>/dev/null export /usr/bin $(pwd)
+	"$1" | printf "$1" grep
+	awk then done echo -eu grep x=1 "$1"
+		&& readonly -eu 2>/dev/null
+	| 'quoted text' awk | ${HOME} && local awk 2>/dev/null
+then /usr/bin export ${HOME} export test then
+		awk $(pwd) then /usr/bin readonly /usr/bin | printf grep "$1" /usr/bin /usr/bin
+done local then $(pwd) printf
+		grep $(pwd) -eu grep export local echo && cd export --verbose then
+		'quoted text' -eu cd awk 'quoted text' export --verbose sed awk done local then
+done /usr/bin --verbose && local -eu local "$@" export grep awk 'quoted text'
+	${HOME} readonly grep readonly printf
+	-eu export 'quoted text' echo "$1" test ${HOME} export $(pwd)
+		printf then /usr/bin "$@" 2>/dev/null
+${HOME} x=1 -eu sed $(pwd) | && && 'quoted text' "$@" 'quoted text' then
+		awk $(pwd) 'quoted text' done readonly 'quoted text'
+		$(pwd) ${HOME} local grep "$1" awk awk ${HOME} cd
+	--verbose --verbose $(pwd) "$1" 2>/dev/null
+	sed done "$1" cd 'quoted text' then then "$@" awk readonly
+test ${HOME} echo readonly grep grep --verbose $(pwd) test && test local &&
+export then -eu "$1" then sed "$@" test 'quoted text'
+		local $(pwd) --verbose
+		readonly readonly awk then sed then | x=1 then grep /usr/bin /usr/bin local test
+	x=1 test awk /usr/bin readonly
+	cd awk /usr/bin "$1" && then readonly cd /usr/bin echo 'quoted text'
+&& ${HOME} "$1" sed sed x=1 | $(pwd) /usr/bin readonly
+		-eu $(pwd) grep local echo | /usr/bin cd 'quoted text' x=1
+done export x=1 done test grep -eu awk awk then
+grep echo local test | printf "$1" && "$@" --verbose
+	export cd echo --verbose 'quoted text' "$1"
+		local then | sed ${HOME} 2>/dev/null |
+export done ${HOME} | done grep awk -eu 'quoted text'
+	${HOME} $(pwd) local sed then printf local
+		/usr/bin sed "$1" printf awk awk
+		| export ${HOME} test sed cd echo /usr/bin "$1" cd "$1" readonly done sed
+test grep -eu echo 2>/dev/null readonly echo | && 'quoted text'
+		x=1 readonly local x=1 -eu printf 'quoted text' | done
+		| echo local && -eu done
+	cd cd /usr/bin done sed && "$1" --verbose then -eu sed "$1" x=1 echo x=1
+| local printf "$1" echo awk then
+--verbose /usr/bin test echo readonly
+	export test readonly awk | "$1" printf "$@" x=1 printf echo
+echo x=1 "$@" sed -eu sed $(pwd) readonly test x=1 -eu $(pwd) 'quoted text'
+	done sed x=1 echo $(pwd) echo 'quoted text'
+'quoted text' ${HOME} ${HOME} awk 'quoted text' "$1" 'quoted text'
+local 2>/dev/null test "$@" readonly $(pwd) test echo cd --verbose
+	then "$1" --verbose 'quoted text' printf awk -eu printf
+	then printf echo then x=1 x=1 /usr/bin test
+		then export readonly echo ${HOME} then then awk
+		grep "$1" "$@" local cd /usr/bin -eu --verbose export export export /usr/bin
+		readonly awk test export -eu 2>/dev/null
+	-eu printf --verbose 'quoted text'
+export && "$@" printf "$1" test -eu
+${HOME} then readonly local test sed "$1" && ${HOME} done "$1" --verbose
+"$@" $(pwd) readonly 2>/dev/null --verbose echo awk echo grep
+	echo then grep done grep cd --verbose local 'quoted text' echo ${HOME} export
+/usr/bin cd sed done 'quoted text' | -eu done "$1" 'quoted text'
+	"$1" grep awk --verbose 2>/dev/null "$1" $(pwd) "$1" then printf
+x=1 "$1" cd readonly readonly local "$1" grep && export
+printf 2>/dev/null x=1 -eu sed echo local $(pwd) | printf readonly
+readonly | "$1" && test ${HOME} $(pwd)
+	readonly export then sed local "$1" grep 'quoted text'
+		sed | x=1 $(pwd) x=1 --verbose && 2>/dev/null /usr/bin done test
+echo 'quoted text' readonly printf
+		awk printf $(pwd) 2>/dev/null 2>/dev/null done && /usr/bin local cd grep then
+	sed /usr/bin printf readonly /usr/bin readonly
+		'quoted text' done done "$@" done test --verbose sed awk ${HOME}
+	grep "$1" 'quoted text' "$@" ${HOME} export && printf export
+	'quoted text' "$1" echo sed -eu | $(pwd) export --verbose $(pwd)
+		2>/dev/null readonly cd $(pwd) echo 'quoted text' x=1 "$@" x=1 && awk "$1" then
+		'quoted text' cd x=1 readonly export then printf export && ${HOME} "$@" local
+		done $(pwd) then /usr/bin
+	2>/dev/null local cd cd "$1" done
+		export done export | then echo "$@" grep readonly
+	grep grep "$1" readonly then test $(pwd) 'quoted text'
+	x=1 export /usr/bin /usr/bin "$@" ${HOME}
+		grep test $(pwd) x=1 'quoted text' x=1 &&
+	"$1" 2>/dev/null 2>/dev/null --verbose "$@" x=1 /usr/bin
+2>/dev/null test x=1 -eu x=1 done echo awk |
+	printf printf && x=1 printf grep test local 'quoted text' cd printf
+		printf awk echo local cd x=1 awk grep 2>/dev/null "$1" $(pwd) export done "$1" cd
+		then readonly local --verbose
+		2>/dev/null "$1" $(pwd) done done printf
+	sed ${HOME} && | export readonly
+	$(pwd) awk "$@" echo done "$1"
+	local cd grep printf then ${HOME} /usr/bin
+	x=1 2>/dev/null export readonly 'quoted text' awk | done | &&
+	local 2>/dev/null | grep $(pwd) 2>/dev/null "$@" ${HOME}
+		cd "$@" x=1 export readonly test -eu ${HOME} /usr/bin
+echo cd $(pwd) then echo ${HOME} then
+		&& done echo 'quoted text'
+	"$@" echo 2>/dev/null awk
+		2>/dev/null ${HOME} readonly
+	echo readonly 'quoted text' done done local sed "$@" echo && awk
+		test "$1" ${HOME} local --verbose echo -eu --verbose then readonly echo 'quoted text'
+		export export "$@" --verbose $(pwd)
+		sed test test sed -eu 'quoted text'
+readonly echo then && && ${HOME}
+		awk -eu "$1" export local then echo sed $(pwd) readonly done then -eu done
+	local export /usr/bin 'quoted text' "$1" 'quoted text' readonly
+	-eu test --verbose test cd grep /usr/bin && --verbose
+	grep ${HOME} test awk cd x=1 'quoted text' awk 'quoted text' /usr/bin
+	readonly 'quoted text' done ${HOME} printf && then
+${HOME} readonly done "$@" "$1" awk awk export grep test 'quoted text'
+		readonly done "$1" sed ${HOME} export then then $(pwd) printf 2>/dev/null
+		grep --verbose cd test ${HOME} ${HOME} -eu && awk | 2>/dev/null done && 2>/dev/null
+then | 2>/dev/null -eu "$@" 2>/dev/null done 2>/dev/null "$1" 2>/dev/null
+sed printf $(pwd) 2>/dev/null printf x=1 grep 2>/dev/null local echo local
+		export export $(pwd) export echo 'quoted text'
+		"$1" "$@" local sed sed 2>/dev/null -eu cd --verbose -eu /usr/bin awk sed
+		then cd "$1" readonly "$@" "$1" /usr/bin
+"$@" echo 'quoted text' | -eu grep printf --verbose --verbose test grep
+	-eu ${HOME} && sed printf printf -eu ${HOME} readonly
+	sed test && ${HOME} "$@" && && 'quoted text' then local local ${HOME} "$1"
+	-eu cd -eu awk /usr/bin export | 2>/dev/null
+	local cd "$@" sed cd cd then export readonly "$1" awk awk grep test local
+		-eu -eu cd awk readonly echo test readonly sed local -eu "$1" 2>/dev/null $(pwd)
+&& 2>/dev/null 2>/dev/null awk --verbose | "$1"
+	--verbose readonly export done /usr/bin 2>/dev/null "$@" | printf export awk
+		2>/dev/null local cd then
+	-eu export | sed test awk 'quoted text' export
+	| /usr/bin printf -eu x=1 --verbose x=1 echo "$@" && x=1 'quoted text'
+		grep "$@" awk $(pwd) --verbose echo | x=1 --verbose | grep 2>/dev/null | then x=1
+	grep --verbose grep ${HOME} printf --verbose $(pwd) done
+x=1 x=1 readonly --verbose "$@" "$@" /usr/bin | then /usr/bin x=1 test export
+		grep cd sed done x=1 2>/dev/null printf
+		${HOME} /usr/bin ${HOME} /usr/bin | "$@" "$1" grep -eu | local
+	x=1 readonly done test then --verbose
+	2>/dev/null readonly awk done && sed grep -eu
+	printf sed && $(pwd) 2>/dev/null 'quoted text' then sed
+	readonly 2>/dev/null -eu
+		local "$@" readonly -eu then test awk export done local echo ${HOME}
+		$(pwd) echo --verbose x=1 readonly -eu export
+		"$1" cd test grep test 'quoted text' export done cd 2>/dev/null
+		echo printf cd cd sed x=1 readonly && | $(pwd) --verbose
+--verbose cd grep "$1" sed printf printf | done 'quoted text' awk
+printf grep done && "$@" -eu cd local done grep $(pwd)
+-eu "$@" awk sed test awk ${HOME} x=1 sed --verbose
+		&& export awk awk awk 'quoted text' cd cd --verbose done $(pwd) test test
+2>/dev/null cd -eu then -eu -eu local 2>/dev/null cd x=1
+-eu $(pwd) echo ${HOME} $(pwd) x=1 echo awk echo
+2>/dev/null "$1" x=1 sed grep | grep
+	/usr/bin && 2>/dev/null
+--verbose echo cd ${HOME} local && /usr/bin cd
+	test test "$1" --verbose x=1 printf "$1" awk -eu "$@" printf
+	&& | cd 2>/dev/null "$1" x=1 local ${HOME} done sed $(pwd) 2>/dev/null
+awk 'quoted text' x=1 test "$@" 'quoted text' && --verbose export --verbose
+readonly /usr/bin -eu echo
+		${HOME} echo 'quoted text' sed readonly x=1 'quoted text' ${HOME} ${HOME} echo
+		awk echo cd sed "$@" done ${HOME} | echo
+test --verbose test awk |
+	"$1" done ${HOME} 'quoted text' ${HOME}
+		"$1" cd "$1" test 'quoted text'
+	"$@" && local sed 'quoted text' sed then local && printf
+printf then | ${HOME} awk printf -eu
+		done then ${HOME} sed printf printf 2>/dev/null
+		2>/dev/null --verbose | && 2>/dev/null x=1 local $(pwd) done "$@"
+		sed sed ${HOME} x=1 printf && --verbose 'quoted text'
+x=1 $(pwd) grep echo $(pwd) grep -eu then && export cd "$1" | --verbose
+	sed "$@" --verbose local readonly "$@" local ${HOME}
+		'quoted text' /usr/bin $(pwd) ${HOME} readonly local test then awk /usr/bin local
+	--verbose readonly 'quoted text' printf "$1" test 2>/dev/null
+	sed | "$1" "$@" export 'quoted text' && test
+	"$@" readonly test 'quoted text' --verbose ${HOME} local done
+		printf then cd awk "$@" grep $(pwd) readonly local "$1" printf
+2>/dev/null $(pwd) awk awk cd done local && $(pwd) awk && awk x=1 2>/dev/null
+echo --verbose export
+		'quoted text' -eu readonly
+		printf -eu grep done -eu done
+local done local sed $(pwd)
+		then x=1 "$@" && "$@" ${HOME} -eu readonly printf ${HOME}
+	"$@" | ${HOME} 2>/dev/null test | | --verbose cd && | x=1 --verbose | $(pwd) -eu
+		'quoted text' x=1 "$1" ${HOME} echo 2>/dev/null
+		'quoted text' printf test -eu done readonly 2>/dev/null
+		'quoted text' export "$@" 'quoted text' awk -eu /usr/bin
+"$1" done export && grep awk /usr/bin 'quoted text'
+	grep --verbose | local --verbose echo $(pwd)
+	${HOME} ${HOME} echo test test -eu /usr/bin ${HOME} export local && then
+		export grep readonly $(pwd) echo /usr/bin printf test /usr/bin x=1 -eu
+	&& && echo printf 2>/dev/null
+sed export --verbose readonly 2>/dev/null 'quoted text'
+		"$1" sed readonly printf awk --verbose 2>/dev/null local /usr/bin
+-eu local "$1" then sed echo 'quoted text' echo ${HOME} ${HOME} cd --verbose
+-eu then awk done printf cd | --verbose cd x=1 local echo && | x=1 echo -eu
+echo grep --verbose then export | export cd then &&
+		local sed "$1" echo test && /usr/bin -eu "$1" then -eu sed then local ${HOME}
+	grep 'quoted text' && export done 2>/dev/null
+printf ${HOME} echo sed done
+	awk 'quoted text' then done local "$@" --verbose
+$(pwd) done 2>/dev/null -eu $(pwd) local x=1 export test
+		sed export export "$@" readonly | --verbose
+		/usr/bin --verbose grep readonly
+	'quoted text' 2>/dev/null "$@" test $(pwd) test 'quoted text'
+		--verbose sed awk printf sed "$@" ${HOME} local 'quoted text'
+printf "$1" test $(pwd) "$@" echo "$@" done readonly $(pwd) --verbose then ${HOME}
+		export "$@" sed sed "$1" printf "$@" 2>/dev/null then ${HOME} readonly
+	'quoted text' "$@" -eu 2>/dev/null test x=1 cd awk
+"$1" $(pwd) printf awk
+grep ${HOME} 'quoted text' 'quoted text' readonly local ${HOME} $(pwd)
+export printf awk cd --verbose "$1" readonly /usr/bin local ${HOME}
+	grep done x=1 done --verbose ${HOME} | awk export
+	local x=1 echo readonly 'quoted text'
+	local /usr/bin cd done readonly local -eu -eu -eu awk | "$@" | | /usr/bin
+		$(pwd) cd 'quoted text' /usr/bin awk sed x=1 local done grep 2>/dev/null
+echo awk 2>/dev/null sed awk done 'quoted text'
+		sed "$1" $(pwd) "$@" | | awk 'quoted text'
+	/usr/bin then done 'quoted text' /usr/bin test readonly readonly
+		2>/dev/null "$@" then sed "$@" awk export
+	"$@" x=1 -eu --verbose sed printf "$1" local "$@" 2>/dev/null sed
+'quoted text' "$@" 2>/dev/null readonly
+		test x=1 then "$@" export printf
+	$(pwd) "$@" /usr/bin local -eu --verbose readonly "$@"
+readonly $(pwd) /usr/bin local
+		"$@" sed test done "$@" 'quoted text' readonly /usr/bin local
+	&& echo printf sed $(pwd) echo then /usr/bin /usr/bin export readonly awk
+	echo cd export export grep "$@" "$1" -eu ${HOME} grep cd grep awk done /usr/bin
+	&& test --verbose awk grep readonly ${HOME} readonly
+		"$@" local readonly awk "$1" local echo cd awk ${HOME}
+		done cd then echo ${HOME} echo "$@" 'quoted text' cd --verbose
+"$1" ${HOME} then && export printf | grep $(pwd) echo echo then then
+		test && -eu -eu /usr/bin readonly x=1 --verbose sed $(pwd) done printf
+cd test 'quoted text' | sed ${HOME}
+grep 2>/dev/null sed $(pwd) 'quoted text' -eu | | | "$1" x=1 local done --verbose
+	"$1" | echo local 'quoted text'
+		/usr/bin printf printf printf cd grep 2>/dev/null sed
+		export "$1" echo echo awk cd readonly $(pwd) test
+		then 2>/dev/null local readonly cd x=1 awk && ${HOME}
+then ${HOME} -eu --verbose grep 2>/dev/null "$@" "$@" x=1 --verbose
+		/usr/bin /usr/bin $(pwd) && done sed local awk |
+	printf test echo --verbose && local ${HOME} $(pwd) test 2>/dev/null local "$@"
+		grep -eu -eu x=1 /usr/bin ${HOME} grep
+printf grep local | ${HOME}
+'quoted text' -eu export grep /usr/bin sed cd test 'quoted text' -eu &&
+		2>/dev/null readonly export then grep /usr/bin "$1" "$@"
+	echo --verbose 2>/dev/null "$1" --verbose
+"$1" /usr/bin export done
+cd /usr/bin echo --verbose test --verbose printf export
+	echo 'quoted text' export "$@" awk then && && /usr/bin 2>/dev/null 2>/dev/null
+sed echo test "$@" 'quoted text' grep
+		| echo printf local test grep local test ${HOME}
+then "$1" ${HOME} done awk && test | grep echo --verbose && -eu
+		export $(pwd) -eu then $(pwd) test 2>/dev/null
+		export local | "$1" export awk x=1 -eu
+		printf | readonly sed && then | test sed $(pwd) | -eu printf && ${HOME} "$1" printf
+		| cd "$1" export export readonly
+	$(pwd) printf local -eu ${HOME} -eu printf --verbose
+		local printf /usr/bin 'quoted text' printf grep export readonly echo export
+		x=1 2>/dev/null awk test && --verbose && 'quoted text' sed local /usr/bin
+		readonly awk export test done cd ${HOME} | local then
+/usr/bin 'quoted text' grep $(pwd) ${HOME} printf ${HOME} awk export printf
+		sed done export then /usr/bin 2>/dev/null 2>/dev/null
+	'quoted text' echo then done done x=1 done
+	awk done readonly test printf --verbose printf |
+		test test "$1" ${HOME} test && export grep grep
+	test | x=1 ${HOME} grep done test readonly $(pwd) -eu echo "$1" local grep
+test ${HOME} awk --verbose sed test echo "$@" 2>/dev/null
+	readonly -eu | /usr/bin $(pwd) echo printf
+		${HOME} awk /usr/bin --verbose printf done printf
+	grep then ${HOME} cd /usr/bin
+export --verbose --verbose awk "$@" "$@"
+awk ${HOME} grep export 2>/dev/null
+	sed done echo readonly grep sed local
+grep -eu --verbose ${HOME} /usr/bin 2>/dev/null --verbose ${HOME}
+		then printf | cd 'quoted text' sed -eu readonly ${HOME}
+done grep then -eu && grep sed
+	"$1" /usr/bin sed 2>/dev/null
+	--verbose sed test /usr/bin
+	grep awk --verbose printf cd 2>/dev/null printf echo grep
+-eu test export cd printf 2>/dev/null then export awk awk echo test local
+readonly --verbose then printf cd
+"$1" "$1" $(pwd) "$@" sed 'quoted text' then awk ${HOME} done
+grep sed 2>/dev/null grep
+		sed | /usr/bin ${HOME} local cd 2>/dev/null done
+	2>/dev/null export && echo done | -eu printf readonly 'quoted text'
+"$1" "$@" printf 'quoted text' "$@" ${HOME}
+| /usr/bin 'quoted text' grep | cd echo 'quoted text'
+		-eu --verbose /usr/bin test -eu cd 2>/dev/null cd awk --verbose
+	-eu /usr/bin /usr/bin "$@" echo --verbose /usr/bin
+		/usr/bin export export 2>/dev/null readonly &&
+'quoted text' grep sed grep $(pwd) awk 'quoted text' 'quoted text' -eu
+		done export done "$1" "$@" export "$@" | | test |
+	x=1 "$1" export 2>/dev/null echo test | --verbose -eu export readonly then
+	awk $(pwd) export ${HOME} "$1" 2>/dev/null $(pwd) done awk
+	$(pwd) $(pwd) && sed 'quoted text' $(pwd) && && ${HOME} --verbose
+then /usr/bin done export --verbose "$@" --verbose "$1"
+		x=1 -eu grep $(pwd) test x=1 "$@" && sed then
+		&& echo 'quoted text' readonly done /usr/bin
+"$@" "$@" local 2>/dev/null printf readonly 'quoted text' "$1" test
+grep export 'quoted text' printf local echo awk
+	"$@" $(pwd) awk 2>/dev/null --verbose 2>/dev/null awk export echo "$@" /usr/bin
+	printf printf done grep cd cd sed "$1" 'quoted text'
+printf --verbose done grep -eu 2>/dev/null test && export --verbose x=1
+		-eu local export printf then 2>/dev/null | grep grep "$@" export x=1 printf
+-eu test test $(pwd) $(pwd) 2>/dev/null "$@" /usr/bin --verbose
+		${HOME} -eu then awk echo && "$1"
+	/usr/bin "$@" printf awk -eu awk cd printf awk grep sed test ${HOME}
+		echo ${HOME} | && then
+	x=1 export $(pwd) done cd "$@" "$1" awk cd ${HOME} test 2>/dev/null export
+	${HOME} grep local cd readonly
+		printf echo printf local export local test
+${HOME} | then && $(pwd) "$@" export $(pwd) "$1" printf && readonly
+	2>/dev/null 'quoted text' $(pwd) $(pwd) sed ${HOME} ${HOME} then
+		readonly 2>/dev/null --verbose
+--verbose "$@" export $(pwd) awk cd echo awk export | local "$@"
+"$1" awk $(pwd) ${HOME} sed awk
+	then readonly "$@" done ${HOME} readonly
+		"$1" awk | && awk && $(pwd) ${HOME}
+	/usr/bin 2>/dev/null | cd | cd
+	/usr/bin x=1 --verbose ${HOME} done "$@" test "$@" then && 'quoted text'
+	cd echo grep printf $(pwd) --verbose awk --verbose
+		local 'quoted text' --verbose
+		printf printf 'quoted text' "$1" local export
+	then $(pwd) | export /usr/bin
+	awk test x=1 sed test awk export
+	&& cd done && /usr/bin then
+'quoted text' --verbose | "$@" test grep echo
+x=1 then readonly -eu then ${HOME} | done ${HOME} "$1" $(pwd) local echo then --verbose
+done then then --verbose 'quoted text' x=1 "$@" cd 'quoted text' -eu
+		&& 2>/dev/null test -eu $(pwd) sed test 2>/dev/null then /usr/bin | then
+	cd -eu printf x=1 test local sed grep export "$1"
+		-eu 'quoted text' "$@" 2>/dev/null "$@" readonly
+local readonly --verbose test ${HOME} && "$1" printf
+		test readonly && local "$1" test && printf | echo sed echo /usr/bin
+printf "$@" cd awk ${HOME}
+--verbose | printf test --verbose printf 2>/dev/null --verbose | echo
+		"$1" -eu local sed "$1" "$@" test --verbose -eu printf
+awk cd done $(pwd) echo --verbose then x=1
+	"$@" local cd 'quoted text' /usr/bin
+#include c219.sh
+sed 2>/dev/null && && done 'quoted text' --verbose && printf readonly $(pwd)
+		2>/dev/null cd | /usr/bin && 'quoted text'
+x=1 export cd done local $(pwd) cd
+		awk grep | && x=1 local "$1" local "$@" "$1" 'quoted text'
+| $(pwd) x=1 $(pwd) grep grep export done grep && ${HOME} export sed ${HOME}
+2>/dev/null 'quoted text' "$1" grep /usr/bin awk $(pwd) 'quoted text'
+	--verbose -eu local /usr/bin x=1 grep awk grep sed ${HOME} echo
+	&& "$@" done "$@" test x=1 2>/dev/null | -eu "$@"
+		x=1 /usr/bin "$@" --verbose sed -eu x=1
+	/usr/bin cd 'quoted text' done /usr/bin /usr/bin "$1" | sed /usr/bin export -eu
+	"$1" awk local ${HOME} ${HOME} "$1" -eu
+	grep | x=1 | /usr/bin
+	${HOME} --verbose grep 2>/dev/null 2>/dev/null
+&& --verbose sed sed x=1 grep test --verbose
+sed | 2>/dev/null then export /usr/bin test
+/usr/bin export done /usr/bin grep echo printf /usr/bin export --verbose
+		'quoted text' sed 2>/dev/null --verbose readonly done export x=1 2>/dev/null test
+	&& x=1 "$@" "$@" awk readonly sed $(pwd)
+		&& cd && sed "$@" -eu --verbose
+		local sed 'quoted text' --verbose
+echo x=1 sed then sed "$1" done grep /usr/bin | cd sed readonly
+		"$@" test | | "$1" "$@" echo
+${HOME} done awk "$@" ${HOME} echo done
+	"$@" ${HOME} echo printf echo test cd | 'quoted text'
+export $(pwd) "$@" ${HOME} | -eu /usr/bin printf then test && 2>/dev/null
+	'quoted text' export test done $(pwd) then /usr/bin then printf
+		/usr/bin local x=1 local 2>/dev/null | test printf /usr/bin ${HOME} echo then --verbose
+	2>/dev/null done local 2>/dev/null $(pwd) sed local
+"$1" grep | awk printf printf export ${HOME} "$1" printf
+		then && local then cd echo x=1 local /usr/bin
+	"$@" readonly cd && ${HOME}
+test 'quoted text' /usr/bin 'quoted text' then echo grep echo then "$1"
+"$@" grep local done done 'quoted text' 2>/dev/null sed && -eu $(pwd) cd
+| $(pwd) cd 2>/dev/null x=1 local --verbose $(pwd)
+		x=1 echo then export "$1" 'quoted text' /usr/bin sed readonly
+x=1 2>/dev/null echo | then | echo /usr/bin sed x=1 $(pwd) echo -eu 2>/dev/null
+	-eu -eu cd | cd cd x=1 awk ${HOME} 'quoted text' -eu cd grep local test printf echo
+x=1 cd | cd | x=1 x=1 'quoted text' && && echo "$@" grep |
+	awk readonly ${HOME}
+		done awk then sed echo local sed done
+		"$1" "$1" printf /usr/bin awk --verbose readonly 2>/dev/null ${HOME} test cd
+		&& --verbose 'quoted text' --verbose awk
+		readonly sed /usr/bin echo 'quoted text' readonly 2>/dev/null --verbose $(pwd)
+echo | --verbose "$@" "$@" -eu readonly done $(pwd) cd "$1"
+--verbose 'quoted text' 2>/dev/null | readonly sed $(pwd)
+		/usr/bin awk then "$@" --verbose then "$1" test test then export
+	'quoted text' 'quoted text' then $(pwd) ${HOME}
+		test && | awk printf done -eu then awk echo then printf -eu && "$1" x=1
+awk | echo /usr/bin | --verbose readonly awk test ${HOME} 'quoted text' $(pwd)
+| && echo echo --verbose
+${HOME} 'quoted text' ${HOME} cd /usr/bin 2>/dev/null
+		export && echo 'quoted text'
+		printf readonly ${HOME} $(pwd) "$@" local /usr/bin /usr/bin export
+		done --verbose /usr/bin awk && readonly local test export ${HOME} $(pwd)
+		2>/dev/null && echo export readonly test export 'quoted text'
+		--verbose sed grep local done cd echo echo done ${HOME} sed then $(pwd)
+	export then done | grep echo awk |
+		"$@" 'quoted text' 2>/dev/null | export cd awk
+-eu sed $(pwd) echo awk 'quoted text' test awk 2>/dev/null
+		test done export then 2>/dev/null
+		printf "$@" 2>/dev/null cd $(pwd) grep sed echo x=1
+'quoted text' then "$1" local | export cd awk printf
+		test printf local done && $(pwd) readonly "$@" test test 'quoted text'
+		${HOME} 2>/dev/null test then export -eu sed $(pwd) | sed readonly
+sed ${HOME} 2>/dev/null export |
+	&& test "$1" grep -eu cd -eu then awk --verbose awk test
+		test done grep cd export && /usr/bin --verbose
+cd then | local awk $(pwd) cd 'quoted text' echo &&
+	then "$@" | "$@" "$@" printf local readonly 2>/dev/null readonly
+		$(pwd) | awk 'quoted text' "$1" /usr/bin "$1" x=1 ${HOME} echo x=1 test done grep
+&& export printf | grep -eu -eu 'quoted text' -eu done --verbose
+sed 2>/dev/null && cd --verbose
+	then test sed 2>/dev/null grep -eu /usr/bin
+--verbose 'quoted text' 'quoted text' readonly 2>/dev/null "$@" x=1
+		$(pwd) local 2>/dev/null
+/usr/bin grep && && --verbose $(pwd) | export local x=1 grep /usr/bin
+	local && local grep cd then /usr/bin "$@" export | sed test test awk && cd
+$(pwd) | done readonly awk printf "$@" awk then done "$1" -eu
+	sed cd export && printf grep $(pwd) 2>/dev/null
+		export done test 2>/dev/null export /usr/bin --verbose $(pwd) echo "$@" --verbose
+		awk echo local && -eu grep
+	-eu && printf done done $(pwd) "$1" -eu /usr/bin test | "$1" awk
+--verbose grep "$@" $(pwd) "$@" sed 'quoted text' && local
+	awk $(pwd) local cd ${HOME} cd export cd 'quoted text' local
+		local && $(pwd) "$1" -eu sed && test x=1 printf sed --verbose --verbose
+readonly | grep x=1 test done done printf then "$@" $(pwd) printf readonly
+		$(pwd) $(pwd) "$@" grep
+| done done export readonly
+	sed test test -eu --verbose test | ${HOME} sed then
+cd cd "$@" --verbose /usr/bin && export | test grep echo readonly done 2>/dev/null
+awk cd sed grep readonly local 2>/dev/null --verbose
+	$(pwd) x=1 /usr/bin printf -eu
+	test test test readonly echo -eu
+${HOME} 2>/dev/null then
+--verbose printf x=1 ${HOME} x=1 printf | $(pwd) x=1 awk /usr/bin
+		awk readonly sed sed "$@" awk --verbose && test then echo export | "$@" export
+		export -eu cd ${HOME} grep printf export export x=1 "$@" $(pwd) readonly export
+		"$1" then "$@" -eu 'quoted text' ${HOME} x=1 $(pwd) done echo --verbose
+		awk awk grep | grep -eu -eu "$@" readonly local test done /usr/bin x=1
+	sed ${HOME} then x=1 echo "$@" ${HOME} && --verbose 2>/dev/null echo x=1 "$1" readonly
+sed | printf && cd && -eu -eu readonly awk readonly
+		readonly local then | "$@"
+then -eu "$@" cd $(pwd) test printf
+		grep local printf local && "$1" | echo done
+	cd cd 2>/dev/null --verbose x=1 $(pwd) done "$@" | cd
+		x=1 echo && 'quoted text' then $(pwd) x=1 echo then readonly 'quoted text'
+		grep 2>/dev/null $(pwd)
+		'quoted text' grep /usr/bin 2>/dev/null 2>/dev/null test local
+		export echo 'quoted text' $(pwd)
+	local sed x=1 /usr/bin awk sed
+	printf "$@" local "$1" /usr/bin --verbose "$@"
+	/usr/bin 'quoted text' local sed test && 'quoted text'
+		test grep grep then |
+		printf local printf sed then $(pwd) printf "$1" echo --verbose x=1
+	grep --verbose printf --verbose 2>/dev/null printf x=1 done local -eu -eu test
+	-eu sed ${HOME} ${HOME} ${HOME} /usr/bin export echo
+"$1" echo then readonly sed export grep
+	"$1" | $(pwd) cd awk grep && "$@" x=1 sed | then x=1 -eu "$@" $(pwd) readonly
+		&& /usr/bin "$@" "$@" "$@" "$@" readonly $(pwd)
+		awk ${HOME} /usr/bin export --verbose 'quoted text' | then | printf -eu
+	$(pwd) readonly --verbose test export awk --verbose x=1 2>/dev/null "$@" readonly
+&& sed printf cd $(pwd) && test
+	${HOME} test "$1" | -eu then echo
+awk 'quoted text' printf | 2>/dev/null x=1 readonly x=1 done then && echo
+		${HOME} 2>/dev/null /usr/bin --verbose then 'quoted text' ${HOME} "$@" --verbose
+${HOME} 'quoted text' readonly --verbose
+	&& | ${HOME} 2>/dev/null 'quoted text'
+cd /usr/bin "$@" | local readonly grep ${HOME} grep | awk "$@" x=1 local cd
+&& sed done cd "$1" readonly test local -eu done test ${HOME} local awk "$@"
+		x=1 printf | --verbose sed sed 'quoted text'
+	/usr/bin -eu "$1" grep -eu ${HOME} 'quoted text' -eu cd -eu 'quoted text'
+2>/dev/null export echo -eu "$@" "$1" && printf ${HOME}
+		2>/dev/null x=1 echo $(pwd) /usr/bin $(pwd) readonly
+		"$@" "$@" export -eu 'quoted text' $(pwd)
+printf local 'quoted text' "$1" ${HOME}
+	awk local "$1" x=1 printf && 2>/dev/null ${HOME} && | sed readonly local sed
+	--verbose -eu $(pwd) readonly ${HOME} export
+readonly done export export 2>/dev/null grep echo "$@" &&
+		$(pwd) sed ${HOME} sed && echo ${HOME}
+		'quoted text' ${HOME} echo local
+	echo printf "$1" "$1" grep 2>/dev/null $(pwd)
+		local local echo 2>/dev/null
+	/usr/bin 2>/dev/null cd "$@"
+		/usr/bin grep "$1" grep /usr/bin readonly -eu
+	sed awk printf readonly sed /usr/bin local local echo test ${HOME}
+| ${HOME} awk 'quoted text' -eu "$@" readonly /usr/bin /usr/bin then
+-eu --verbose "$@" $(pwd)
+local done test sed "$1" 2>/dev/null test --verbose 'quoted text'
+		| printf test /usr/bin printf ${HOME} echo 'quoted text' done sed
+		local export x=1 /usr/bin then -eu ${HOME} $(pwd) $(pwd)
+		"$@" 2>/dev/null local local echo then export --verbose -eu local
+then readonly then 2>/dev/null cd
+"$@" printf printf printf export | cd --verbose /usr/bin
+	sed 2>/dev/null export grep then 'quoted text'
+		printf done 'quoted text' printf ${HOME} 2>/dev/null grep &&
+	-eu x=1 ${HOME} readonly readonly export done
+		test "$@" export x=1 && $(pwd) x=1 && ${HOME} /usr/bin "$@" test done export
+		| 2>/dev/null cd echo cd echo ${HOME} sed | 2>/dev/null 'quoted text' echo --verbose
+${HOME} then awk grep "$1" && | then
+	echo cd | /usr/bin cd && test readonly 'quoted text'
+	echo printf --verbose done
+	done --verbose --verbose sed export $(pwd) grep x=1 /usr/bin
+		readonly test cd echo "$1"
+-eu export --verbose awk test | echo grep echo awk awk cd
+		done export 2>/dev/null readonly && test test $(pwd) $(pwd) export grep 'quoted text'
+&& local then && --verbose "$1" readonly
+		export 'quoted text' echo awk && | done $(pwd) 'quoted text' $(pwd) readonly
+	then 2>/dev/null grep -eu sed awk /usr/bin
+$(pwd) export export --verbose 'quoted text'
+		"$@" test sed 'quoted text' cd "$@"
+	local done 'quoted text' grep awk /usr/bin -eu done 2>/dev/null echo readonly
+	export echo test export cd 'quoted text' echo x=1 printf cd
+		2>/dev/null --verbose $(pwd) 2>/dev/null
+	done local sed cd "$@" export "$@" x=1 "$@" "$@" awk printf echo
+	then printf sed test test "$1" 'quoted text' -eu cd
+	--verbose test -eu 2>/dev/null sed test
+	cd done awk && && then --verbose
+		test 2>/dev/null | then "$1" cd test | export x=1 grep awk readonly "$@" echo awk
+	sed ${HOME} test --verbose
+test grep "$1" /usr/bin export sed awk
+		x=1 -eu ${HOME} readonly 'quoted text' && "$@" then x=1 grep test echo
+${HOME} --verbose 2>/dev/null
+		${HOME} "$@" $(pwd) "$1" ${HOME} printf $(pwd)
+x=1 grep done "$1" ${HOME} /usr/bin --verbose sed | sed
+done "$@" printf -eu readonly 'quoted text' "$@" | export /usr/bin && done --verbose
+x=1 export x=1 test | done /usr/bin grep
+		2>/dev/null export readonly
+	| test awk --verbose x=1 sed 'quoted text'
+	| export && test sed x=1 local
+		$(pwd) cd then 2>/dev/null export --verbose | /usr/bin awk readonly
+		x=1 local sed awk x=1 | "$1" && printf grep $(pwd) ${HOME} 2>/dev/null
+		local grep 2>/dev/null grep
+test 2>/dev/null echo done 2>/dev/null printf then cd sed $(pwd)
+	local $(pwd) export test readonly 'quoted text' ${HOME} && done grep readonly
+		&& --verbose cd $(pwd) done local ${HOME}
+		awk local test $(pwd) cd 2>/dev/null --verbose 'quoted text'
+		| "$@" ${HOME} "$@" --verbose 'quoted text' 'quoted text' $(pwd) printf 2>/dev/null
+		then "$1" done grep test readonly "$1" /usr/bin x=1 readonly cd ${HOME} sed sed
+test | grep printf sed "$1" echo cd readonly export x=1 done cd x=1 done then readonly
+		x=1 "$1" ${HOME} "$1" $(pwd) readonly
+sed ${HOME} export /usr/bin then | 2>/dev/null x=1 "$1"
+test readonly sed then x=1 "$1" done test "$@" echo $(pwd) 2>/dev/null $(pwd) /usr/bin
+	done test "$1" $(pwd) --verbose then
+	sed && echo $(pwd) sed sed export
+		&& done 'quoted text' "$@" test | ${HOME} awk "$@"
+	--verbose printf readonly readonly sed | --verbose local -eu awk
+2>/dev/null /usr/bin x=1 cd export "$@" 'quoted text' 2>/dev/null awk then
+		| readonly done /usr/bin --verbose | 2>/dev/null grep export /usr/bin $(pwd)
+&& -eu printf && "$1"
+-eu && | "$@" sed echo printf cd $(pwd) grep echo
+'quoted text' -eu sed -eu echo sed echo | $(pwd) "$@" /usr/bin
+	--verbose 'quoted text' | test grep x=1 readonly
+x=1 2>/dev/null /usr/bin printf done
+	cd sed /usr/bin awk 'quoted text' -eu "$1" awk && printf test | -eu cd local done
+	cd readonly "$@" done /usr/bin readonly
+	readonly export grep readonly $(pwd) test sed export
+		-eu && $(pwd) x=1 sed export
+	awk --verbose 'quoted text'
+'quoted text' export sed $(pwd) "$@" done echo echo awk 2>/dev/null "$1" echo cd
+grep | 'quoted text' echo $(pwd) printf
+		/usr/bin then | "$@" ${HOME} cd export test -eu printf sed -eu 'quoted text'
+		echo test -eu printf test && local ${HOME} cd $(pwd)
+	echo grep local grep /usr/bin $(pwd) ${HOME} sed
+export 'quoted text' --verbose "$1" local
+		"$1" x=1 test /usr/bin -eu awk awk echo done
+		sed /usr/bin ${HOME} | local
+-eu -eu 2>/dev/null then | | local 2>/dev/null then /usr/bin |
+$(pwd) cd /usr/bin 2>/dev/null
+&& "$1" test -eu $(pwd) "$@" "$1" "$1" sed $(pwd) --verbose
+		${HOME} $(pwd) local echo export echo | ${HOME}
+		printf sed 'quoted text'
+		/usr/bin "$1" sed test -eu test ${HOME} awk then echo readonly
+${HOME} /usr/bin local "$@" x=1 echo &&
+	test done test grep $(pwd) echo 2>/dev/null | /usr/bin && &&
+		-eu grep "$@" ${HOME} then awk $(pwd)
+sed "$1" | echo "$@" then cd grep printf $(pwd) -eu cd
+		'quoted text' ${HOME} /usr/bin "$@" export 'quoted text' sed grep sed readonly printf
+		${HOME} "$@" | then 'quoted text' $(pwd)
+	--verbose local cd export sed then x=1 grep "$1" printf -eu
+then /usr/bin -eu echo then | printf printf $(pwd)
+'quoted text' --verbose x=1 echo
+	&& ${HOME} x=1 -eu local
+${HOME} cd echo awk then 'quoted text' x=1 printf echo /usr/bin awk done -eu
+test grep --verbose x=1 printf | && readonly local "$1" grep done /usr/bin
+	echo x=1 'quoted text' ${HOME} x=1 grep -eu
+-eu "$1" --verbose 2>/dev/null cd grep 'quoted text' | grep sed printf test
+2>/dev/null grep && readonly x=1 | awk test $(pwd) done grep -eu cd
+		-eu grep export 2>/dev/null grep test | printf grep x=1 export awk --verbose
+test echo --verbose cd | echo 'quoted text'
+sed ${HOME} 'quoted text' done 'quoted text' cd export printf
+	2>/dev/null local --verbose 2>/dev/null done
+	| -eu /usr/bin sed -eu readonly $(pwd)
+	readonly "$@" && readonly echo awk x=1 /usr/bin && readonly "$1" && 2>/dev/null
+	export | --verbose x=1 x=1 --verbose
+'quoted text' -eu grep
+		printf ${HOME} grep printf export ${HOME} ${HOME}
+	${HOME} local test $(pwd) readonly awk 'quoted text' $(pwd) && grep -eu x=1 --verbose
+sed sed then cd && 'quoted text'
+	sed /usr/bin "$1" then x=1 "$@" printf "$1" "$1" -eu ${HOME} grep ${HOME}
+	test readonly echo -eu "$@" | cd
+	--verbose ${HOME} --verbose x=1 'quoted text'
+local test then 2>/dev/null
+	-eu "$1" local local done
+		printf $(pwd) grep then -eu grep
+export test | cd 2>/dev/null then printf echo
+	awk cd && "$1" echo 2>/dev/null echo 2>/dev/null ${HOME} cd
+		${HOME} readonly x=1 echo local echo
+x=1 test test printf cd && "$@" --verbose && | cd x=1 done x=1 awk /usr/bin
+		x=1 awk $(pwd) then -eu test cd x=1 cd 'quoted text'
+		sed cd && test sed ${HOME} /usr/bin sed --verbose export
+	cd printf sed printf x=1 "$1" /usr/bin ${HOME} awk printf && readonly grep
+		"$1" | readonly 2>/dev/null ${HOME} && /usr/bin --verbose | readonly
+		awk | --verbose test x=1 then ${HOME} -eu 'quoted text' sed grep export
+		| -eu -eu 2>/dev/null | 2>/dev/null cd then $(pwd) printf then cd "$1" awk --verbose
+		"$@" readonly 'quoted text' grep && "$1" local cd ${HOME} --verbose "$@" grep
+awk cd /usr/bin $(pwd) readonly "$@" awk done |
+then -eu x=1 'quoted text' /usr/bin 2>/dev/null x=1 done "$1" "$1" awk test printf
+	| "$1" x=1 cd /usr/bin grep done /usr/bin local grep printf export local "$1"
+	done 2>/dev/null "$1" sed 2>/dev/null /usr/bin x=1 x=1 echo --verbose 2>/dev/null
+2>/dev/null "$1" sed cd 'quoted text' readonly
+		&& "$1" 'quoted text' x=1 readonly sed sed
+-eu local 'quoted text' "$1" export cd --verbose -eu test printf ${HOME}
+		echo cd && cd cd cd $(pwd) ${HOME} cd 2>/dev/null 2>/dev/null
+	${HOME} "$1" | $(pwd) printf local sed cd printf
+	export echo cd local ${HOME} awk
+/usr/bin sed export "$1" readonly echo | readonly
+done cd 2>/dev/null printf 2>/dev/null
+	awk && export | 2>/dev/null 2>/dev/null -eu "$1" local local -eu cd printf
+'quoted text' | x=1 ${HOME} done sed -eu cd then test then
+'quoted text' done $(pwd) grep && 2>/dev/null echo | printf
+sed "$@" cd --verbose cd --verbose cd $(pwd) "$1" then && --verbose
+		export "$1" readonly sed done $(pwd)
+		test --verbose && "$1" printf
+| --verbose printf x=1 "$@"
+	grep 'quoted text' &&
+	then /usr/bin cd test done test | x=1 grep sed 'quoted text'
+/usr/bin printf local awk readonly 2>/dev/null grep x=1
+awk cd awk x=1 "$1" && test $(pwd) ${HOME} $(pwd) readonly --verbose
+	readonly cd x=1 'quoted text' readonly export
+	export "$@" && && echo 2>/dev/null -eu sed | local
+| && --verbose export local x=1 cd awk -eu sed grep printf -eu awk
+		--verbose readonly "$1" ${HOME} test readonly done
+	x=1 then local cd 'quoted text' --verbose
+/usr/bin cd echo local -eu echo $(pwd)
+		x=1 | ${HOME} then /usr/bin --verbose readonly echo sed grep cd
+		then "$1" /usr/bin x=1 cd 'quoted text' awk | readonly ${HOME} 'quoted text'
+	--verbose sed echo && | printf done "$@" cd test -eu "$1" $(pwd) /usr/bin
+		2>/dev/null printf 2>/dev/null cd done done grep readonly grep local
+"$1" ${HOME} 2>/dev/null grep 2>/dev/null | done then grep test
+readonly local --verbose
+done echo then local "$@"
+		--verbose $(pwd) /usr/bin
+	$(pwd) printf printf export cd $(pwd) ${HOME} export sed | readonly
+"$1" 'quoted text' sed x=1 readonly 2>/dev/null
+	readonly /usr/bin 'quoted text' echo awk "$@" sed
+	2>/dev/null cd grep ${HOME} 'quoted text' sed x=1 |
+	done sed awk /usr/bin -eu cd 'quoted text' $(pwd) printf
+		&& done | --verbose ${HOME} 'quoted text' local -eu test && 2>/dev/null
+		2>/dev/null "$1" then export --verbose
+test --verbose echo && "$1" x=1 "$@" awk readonly
+		${HOME} 2>/dev/null done cd printf --verbose
+		2>/dev/null done && x=1 awk "$1" --verbose /usr/bin then $(pwd)
+		echo export export --verbose sed then
+		cd 2>/dev/null 2>/dev/null x=1 $(pwd) readonly
+readonly cd local done
+		echo cd grep cd readonly awk then then && readonly then printf done
+		export then printf 2>/dev/null | cd printf && test --verbose local printf "$1" "$1"
+'quoted text' ${HOME} then && local export cd readonly x=1
+		2>/dev/null test grep test -eu then 2>/dev/null readonly done | awk && awk
+export | cd local "$@" ${HOME} "$1" && test x=1
+		"$1" printf done printf | cd &&
+local && export echo "$@" -eu 'quoted text' $(pwd) grep test | test cd
+'quoted text' test grep sed /usr/bin $(pwd)
+"$1" awk /usr/bin grep $(pwd) $(pwd) test 'quoted text' ${HOME} then
+--verbose $(pwd) grep --verbose /usr/bin grep echo $(pwd) --verbose
+awk 'quoted text' sed -eu done | /usr/bin export
+2>/dev/null export "$@" sed | --verbose printf
+| grep -eu local "$1" 2>/dev/null export sed 2>/dev/null
+"$1" "$@" ${HOME} local /usr/bin echo /usr/bin grep && | cd echo
+	"$@" then then test "$1" printf printf 'quoted text'
+cd /usr/bin x=1 readonly
+		"$@" && printf grep | local test local cd cd grep then
+cd 'quoted text' test /usr/bin --verbose local export cd echo grep done
+	-eu $(pwd) && then done x=1 2>/dev/null
+local x=1 done 'quoted text' local grep
+	&& grep -eu readonly "$@" "$1" grep "$@" | cd && --verbose readonly printf awk then
+		2>/dev/null awk sed "$1" $(pwd) $(pwd) x=1 echo -eu export "$1" "$1" x=1 awk
+readonly x=1 local cd echo "$1" 2>/dev/null 2>/dev/null
+		local -eu "$1" export x=1 awk sed "$1" ${HOME} cd
+		echo done then done grep sed x=1 'quoted text' echo "$1" $(pwd)
+$(pwd) && --verbose -eu local sed cd && x=1 'quoted text'
+"$@" done cd "$1" 'quoted text' x=1 awk $(pwd) then -eu cd export
+	/usr/bin "$@" printf --verbose awk && test grep done /usr/bin
+		done then awk /usr/bin
+	x=1 "$1" then export -eu then "$@" |
+		printf done local local cd $(pwd)
+printf echo cd x=1 awk 2>/dev/null readonly readonly "$1"
+	"$1" test x=1 -eu done 'quoted text' "$@" done readonly --verbose
+export awk cd "$@" | awk export cd export 'quoted text'
+		cd done $(pwd) "$@" local
+	test printf --verbose
+		done -eu printf && "$1" readonly grep test x=1
+cd awk 2>/dev/null cd "$1" cd test test readonly sed
+	--verbose "$1" "$@" local "$1" -eu done $(pwd) local 'quoted text'
+"$1" 2>/dev/null sed -eu && then 'quoted text'
+"$@" sed | local echo test awk --verbose local
+'quoted text' "$1" 2>/dev/null echo
+-eu awk | "$@" -eu awk /usr/bin printf /usr/bin
+awk awk 2>/dev/null local | awk
+cd echo x=1 printf "$1" $(pwd) -eu then ${HOME} "$@" local "$@" | readonly 2>/dev/null
+		sed readonly cd awk awk then test
+		&& 'quoted text' readonly 'quoted text' && then -eu echo cd --verbose
+		readonly "$@" then printf | "$1" && $(pwd) "$1" "$1" done /usr/bin
+| then "$@" cd done done "$@" cd test /usr/bin
+	| sed -eu local /usr/bin done ${HOME} awk test && "$1" ${HOME}
+	cd "$1" readonly awk 2>/dev/null grep /usr/bin export local
+2>/dev/null sed echo sed
+		--verbose export && && | 'quoted text'
+x=1 readonly export --verbose x=1 | grep "$1" then
+local ${HOME} /usr/bin sed | done grep awk --verbose grep
+	| 2>/dev/null /usr/bin 'quoted text'
+		'quoted text' test printf 'quoted text' done local export 'quoted text'
+	2>/dev/null $(pwd) -eu ${HOME} -eu sed -eu cd 2>/dev/null
+	/usr/bin export "$1" "$@" $(pwd)
+then "$@" awk cd printf $(pwd) $(pwd) sed --verbose
+		--verbose /usr/bin test x=1 x=1 --verbose awk
+done export awk then 2>/dev/null --verbose then 2>/dev/null
+	x=1 local echo "$@" "$1" -eu "$1" readonly grep
+		sed "$@" /usr/bin awk readonly
+		done readonly "$@" $(pwd) /usr/bin
+		then cd --verbose awk "$1" cd --verbose --verbose x=1 'quoted text'
+		| /usr/bin $(pwd) local sed "$1" then x=1 done ${HOME} local
+		local -eu export && printf /usr/bin
+		&& x=1 printf 'quoted text' done grep && "$@" done -eu sed cd sed cd x=1
+	x=1 x=1 x=1 echo ${HOME} 'quoted text' 'quoted text'
+	sed | local && sed 2>/dev/null
+	grep ${HOME} awk /usr/bin "$@" $(pwd) /usr/bin test cd echo "$1" export |
+	-eu | ${HOME} done --verbose sed $(pwd) | cd /usr/bin
+/usr/bin then && && local test printf
+		2>/dev/null readonly echo $(pwd) local -eu test awk ${HOME} printf
+		done -eu then grep x=1 echo cd grep echo
+	/usr/bin 'quoted text' && awk cd then "$1" printf /usr/bin sed echo awk x=1 | &&
+		readonly local "$@" test ${HOME} "$1" export awk
+		test export "$@" sed --verbose "$1" cd -eu echo /usr/bin local cd $(pwd)
+sed echo printf "$@" -eu -eu 2>/dev/null
+	awk echo echo echo 2>/dev/null local | readonly export
+		local grep ${HOME} printf "$@" "$@" "$1" x=1
+	export ${HOME} test /usr/bin cd 'quoted text' 2>/dev/null cd then done
+		export | readonly | -eu grep x=1 done awk readonly then readonly | awk "$1"
+	done /usr/bin done "$1" /usr/bin test -eu test export sed 'quoted text'
+	printf ${HOME} -eu done ${HOME} 'quoted text'
+2>/dev/null | x=1 'quoted text' 2>/dev/null
+	readonly | sed local
+		sed grep | then $(pwd) x=1 readonly awk 'quoted text' /usr/bin local
+	$(pwd) | then && test 'quoted text'
+		printf export grep cd test $(pwd) awk 'quoted text'
+	echo readonly printf -eu 'quoted text' && echo sed -eu 'quoted text'
+$(pwd) awk "$@" test printf readonly 'quoted text' test
+	$(pwd) sed "$1" awk sed local
+		cd /usr/bin x=1 && done grep test -eu export "$1" $(pwd)
+--verbose /usr/bin "$1" x=1 "$@" 2>/dev/null sed done awk done
+	local sed printf $(pwd) "$1" sed done $(pwd) ${HOME} 2>/dev/null ${HOME} $(pwd)
+		cd $(pwd) | x=1 readonly "$@" cd export
+		readonly sed echo readonly readonly local echo echo readonly -eu local
+test "$@" echo "$@" | export "$@"
+	x=1 --verbose && --verbose && --verbose && done
+	done readonly local readonly
+| "$@" ${HOME} grep done && "$@"
+"$1" printf then sed "$1" x=1 && export --verbose x=1 "$1" x=1 cd x=1 grep
+		&& then echo | test 2>/dev/null echo --verbose
+done "$@" && awk "$@" grep awk sed awk export -eu ${HOME} readonly "$@" | "$@"
+		awk sed sed local -eu sed grep -eu x=1
+	"$1" ${HOME} && done $(pwd)
+		readonly test grep -eu | -eu done export
+		cd | cd then cd ${HOME} ${HOME} $(pwd) "$@" --verbose
+then "$@" grep 'quoted text' $(pwd) x=1 /usr/bin "$1"
+		then "$@" && cd export /usr/bin 2>/dev/null "$@" | && then local
+		| $(pwd) awk 'quoted text' -eu printf awk echo grep && printf cd
+		${HOME} grep readonly ${HOME} x=1 grep -eu "$1" cd
+		readonly local -eu --verbose test | echo -eu then awk $(pwd) /usr/bin $(pwd)
+x=1 test && -eu -eu --verbose -eu readonly $(pwd) | printf x=1 cd
+	--verbose test && "$1" then && export 'quoted text' 'quoted text'
+		export readonly 2>/dev/null cd -eu local 2>/dev/null test sed local | local
+$(pwd) done ${HOME} readonly | "$@" readonly readonly cd 'quoted text'
+	"$1" | sed --verbose printf awk cd done test then sed
+	export local /usr/bin grep grep grep
+		export "$@" printf done cd echo ${HOME} ${HOME} --verbose cd export && /usr/bin
+		"$1" test grep local then ${HOME} --verbose --verbose echo cd
+&& cd echo cd "$@" cd ${HOME} && 2>/dev/null
+		readonly local $(pwd) "$@" $(pwd)
+/usr/bin ${HOME} | awk done readonly 'quoted text' cd && | done
+	--verbose export readonly "$1"
+	| then echo cd && "$@" $(pwd) cd printf export --verbose /usr/bin
+		then readonly && /usr/bin
+		-eu readonly -eu echo "$1" cd "$1"
+		readonly printf x=1 printf -eu -eu readonly
+	| -eu /usr/bin "$@" done "$1" echo done then grep 'quoted text'
+		grep awk local grep -eu readonly | awk then sed ${HOME} | done grep
+	then printf test done -eu readonly awk sed local awk && export "$1" 'quoted text'
+	awk x=1 x=1 'quoted text' export -eu then
+test sed && && awk local 'quoted text' | $(pwd) "$@" && "$1"
+		readonly 2>/dev/null done
+		$(pwd) -eu cd echo -eu 2>/dev/null
+--verbose 'quoted text' && printf && $(pwd) && "$1" --verbose
+$(pwd) grep then /usr/bin "$1" && && -eu x=1 -eu test test
+x=1 x=1 /usr/bin export printf /usr/bin
+x=1 done then export cd then | 'quoted text' export printf printf done
+	printf $(pwd) 2>/dev/null x=1 local --verbose done 'quoted text'
+	then --verbose $(pwd) done "$@" test then test x=1 x=1 local --verbose
+		printf --verbose then /usr/bin --verbose && x=1 2>/dev/null "$1" &&
+	local 'quoted text' 'quoted text' "$@" 2>/dev/null
+	'quoted text' 'quoted text' -eu 'quoted text' && "$@" done local 'quoted text'
+sed then then export then readonly
+	x=1 grep 'quoted text' $(pwd) then cd -eu printf
+"$@" test awk "$@" x=1 printf --verbose /usr/bin test test && 'quoted text'
+done /usr/bin $(pwd) $(pwd) /usr/bin
+'quoted text' readonly
+		/usr/bin 'quoted text' -eu export "$@" /usr/bin grep $(pwd) readonly
+&& --verbose sed then cd then $(pwd) sed ${HOME} cd /usr/bin readonly
+		$(pwd) --verbose test readonly -eu ${HOME}
+		-eu --verbose | ${HOME} -eu
+	cd local awk awk --verbose printf &&
+	export "$1" | export $(pwd) 'quoted text' local -eu then
+		/usr/bin export /usr/bin done 2>/dev/null readonly
+		'quoted text' printf --verbose
+		'quoted text' -eu readonly test cd readonly
+		${HOME} && then --verbose "$1" 2>/dev/null
+	done ${HOME} $(pwd) -eu sed done then awk --verbose awk -eu grep awk
+	done | export done test sed 'quoted text' -eu ${HOME}
+	sed grep grep sed local export printf 'quoted text' cd -eu 'quoted text'
+sed --verbose echo -eu 2>/dev/null grep /usr/bin then done
+		2>/dev/null $(pwd) done sed grep && ${HOME}
+'quoted text' grep x=1 "$1" -eu && awk x=1 awk /usr/bin cd --verbose "$1"
+sed | "$@" "$1" export --verbose then /usr/bin --verbose printf
+		local x=1 local "$@" test | cd /usr/bin | export --verbose
+		printf export done export printf local then "$@" readonly && sed
+		export ${HOME} && printf test && "$1" 2>/dev/null 'quoted text'
+readonly awk export "$@" --verbose
+		cd 2>/dev/null local grep "$@" awk printf sed --verbose
+		${HOME} local $(pwd) export readonly printf cd printf
+${HOME} readonly 'quoted text' awk "$@" awk | echo
+		export local ${HOME} 2>/dev/null grep sed then readonly test readonly done "$1"
+		readonly 'quoted text' 'quoted text'
+		&& 'quoted text' x=1 x=1 ${HOME} --verbose done
+sed "$@" test grep ${HOME}
+		-eu grep | $(pwd) export echo grep
+	"$@" "$@" 2>/dev/null 2>/dev/null "$@" --verbose $(pwd) "$1"
+echo ${HOME} ${HOME} 'quoted text' --verbose
+	&& test ${HOME} sed ${HOME} 2>/dev/null
+		local awk echo && && --verbose 2>/dev/null grep
+	test awk && cd && 'quoted text' echo | echo
+		2>/dev/null readonly awk 2>/dev/null && x=1 grep
+		"$@" "$@" | ${HOME} $(pwd)
+		sed local readonly awk awk $(pwd) 'quoted text'
+		&& cd printf && ${HOME} export
+	2>/dev/null "$1" cd awk test local 2>/dev/null /usr/bin && printf | readonly
+		sed export test printf done done printf x=1 "$1" x=1 then sed
+	export export test && echo cd x=1 cd printf x=1 $(pwd) "$1" done done echo then
+$(pwd) cd local ${HOME} done
+		echo x=1 -eu then $(pwd) echo readonly printf export /usr/bin x=1 local
+		done local export -eu ${HOME} 'quoted text' awk "$1" /usr/bin $(pwd) sed "$@"
+		then local local awk export | && test echo done "$@" && ${HOME} 2>/dev/null
+	$(pwd) sed then "$@" "$@" 2>/dev/null "$@" && ${HOME} 2>/dev/null 'quoted text'
+	grep echo /usr/bin then | local 2>/dev/null grep done /usr/bin &&
+	| -eu local done $(pwd) sed /usr/bin "$@" "$@" echo echo local local 2>/dev/null
+readonly export ${HOME} done export export "$@"
+		readonly local && "$@" | --verbose $(pwd) |
+	export /usr/bin test | 'quoted text'
+echo then -eu -eu "$@" printf
+		then export readonly sed then
+		-eu /usr/bin && grep -eu sed x=1 2>/dev/null
+printf $(pwd) -eu x=1 awk printf
+		awk ${HOME} x=1 echo then "$1" local export grep printf "$@" ${HOME}
+	echo | "$1" 'quoted text' -eu grep -eu test "$@" /usr/bin sed grep readonly
+cd 2>/dev/null readonly "$1" readonly echo local $(pwd) export
+	awk sed sed /usr/bin echo awk then
+		done grep cd sed sed echo local
+		'quoted text' export local readonly local
+grep | "$1" export sed $(pwd) "$1"
+	sed "$1" && ${HOME} 2>/dev/null /usr/bin export "$@" | $(pwd) then echo
+	then 2>/dev/null x=1 printf
+		then $(pwd) /usr/bin && awk
+	printf awk ${HOME} local echo cd --verbose readonly echo local done echo
+sed ${HOME} then x=1 sed export then "$@" cd cd awk cd test readonly grep sed
+	$(pwd) /usr/bin "$@" x=1
+		"$@" $(pwd) "$1" "$@" 2>/dev/null awk grep grep cd grep x=1 local then -eu
+	'quoted text' 'quoted text' $(pwd) then && x=1 export && grep test sed
+		local "$@" 2>/dev/null local --verbose ${HOME} 'quoted text' echo awk &&
+grep --verbose x=1 && $(pwd)
+		export 'quoted text' 2>/dev/null -eu printf readonly
+echo /usr/bin test readonly --verbose grep -eu $(pwd) grep
+		printf sed test cd export
+grep sed && ${HOME} awk
+"$@" ${HOME} 'quoted text' $(pwd) awk export local --verbose test 'quoted text'
+	test readonly /usr/bin test "$1" test $(pwd) ${HOME} printf awk grep awk "$1" 2>/dev/null
+		printf grep test done printf readonly then local && "$1" "$1" local local
+	2>/dev/null echo echo | local | cd -eu readonly done /usr/bin test | sed &&
+x=1 | 2>/dev/null x=1 sed /usr/bin grep && grep 2>/dev/null
+	readonly export awk sed cd export "$1" | grep $(pwd)
+	/usr/bin sed 'quoted text' 'quoted text'
+	done grep "$1" $(pwd) export "$@" sed awk printf
+		$(pwd) "$@" grep grep awk done export -eu then 'quoted text'
+		--verbose ${HOME} awk 2>/dev/null -eu x=1 grep --verbose | echo
+export grep | sed ${HOME} test
+	echo export ${HOME} test $(pwd) test "$1" awk printf
+"$1" "$1" | test | then 'quoted text' sed | && -eu echo awk echo x=1 2>/dev/null
+		2>/dev/null printf --verbose x=1 test then x=1 sed done sed printf
+sed | | cd | -eu test -eu done | "$1" grep export x=1 echo /usr/bin --verbose
+'quoted text' "$@" cd readonly awk
+		test $(pwd) && x=1 $(pwd)
+		export "$@" $(pwd) $(pwd) "$1" --verbose /usr/bin x=1 done export $(pwd)
+	test awk /usr/bin $(pwd) /usr/bin | -eu $(pwd) && then
+		"$@" then "$1" 'quoted text' export -eu --verbose -eu 'quoted text' $(pwd)
+		printf grep cd cd "$1"
+	awk --verbose "$1" "$1" echo x=1 "$1" test done $(pwd) echo echo
+	done && grep ${HOME} local --verbose grep readonly /usr/bin
+	echo sed readonly /usr/bin 'quoted text'
+x=1 echo --verbose "$1" ${HOME} sed ${HOME} && "$1" x=1 echo
+done --verbose ${HOME} -eu /usr/bin echo && 2>/dev/null $(pwd) "$1" test awk
+		x=1 cd 'quoted text' "$1" x=1
+"$1" -eu printf 'quoted text' awk local "$@" cd done /usr/bin
+		x=1 then ${HOME} printf cd grep readonly
+	grep printf readonly echo echo grep
+	test printf readonly 'quoted text' sed 2>/dev/null $(pwd) | -eu "$1" sed
+		-eu local sed $(pwd) cd --verbose "$1" --verbose printf "$@" x=1 --verbose printf
+	/usr/bin | && test done
+		readonly /usr/bin "$@" 'quoted text' readonly printf
+	sed "$1" 'quoted text' -eu $(pwd) $(pwd) 'quoted text'
+		done && ${HOME} printf --verbose sed test sed ${HOME} printf &&
+	"$1" grep printf "$1" readonly awk export -eu -eu 2>/dev/null
+	then grep sed export sed x=1 test "$1" test --verbose echo sed "$@" &&
+"$1" awk awk --verbose -eu then "$@" sed "$1" $(pwd)
+		grep --verbose echo awk "$1" 'quoted text' done
+	then sed | | -eu | export printf /usr/bin
+"$1" echo -eu export grep --verbose cd && awk readonly test /usr/bin 'quoted text'
+| 'quoted text' cd then 2>/dev/null local awk && $(pwd) ${HOME}
+'quoted text' then 'quoted text' "$@" 'quoted text' "$@" grep $(pwd) grep 'quoted text'
+		sed echo then local "$@" "$@" x=1 grep $(pwd) 2>/dev/null | $(pwd) | --verbose
+$(pwd) -eu "$1" export grep readonly grep
+	sed cd ${HOME} -eu test | cd local ${HOME} /usr/bin "$@" | 'quoted text'
+-eu then echo /usr/bin $(pwd) readonly done export grep 'quoted text' awk echo
+	"$@" done printf -eu local readonly grep /usr/bin grep && cd local
+	done test && | then readonly test local then /usr/bin
+grep 'quoted text' cd awk local "$1" -eu grep /usr/bin
+		2>/dev/null grep grep /usr/bin && sed && && ${HOME} $(pwd)
+		test then done export ${HOME} && x=1 readonly echo cd x=1 --verbose
+		cd ${HOME} /usr/bin local sed "$@" echo -eu grep --verbose
+	'quoted text' ${HOME} then cd sed readonly awk test readonly export ${HOME}
+echo printf done -eu export 'quoted text' printf ${HOME} "$1" && --verbose
+		-eu then export export grep printf
+	&& echo readonly echo "$1" x=1 | $(pwd) /usr/bin local awk 'quoted text' export
+	&& grep | cd cd "$@" sed
+'quoted text' echo echo echo then printf awk -eu readonly readonly --verbose | 'quoted text'
+		export ${HOME} echo readonly test local export local ${HOME} echo test 'quoted text'
+	sed then /usr/bin readonly
+		then test x=1 'quoted text' --verbose
+echo && "$@" export readonly
+		"$@" -eu done x=1 printf /usr/bin readonly "$1" grep sed cd local readonly
+		echo echo local grep $(pwd) awk grep ${HOME} /usr/bin /usr/bin x=1 "$@"
+awk /usr/bin cd x=1 sed && awk | printf echo export test && 'quoted text'
+		-eu 'quoted text' sed ${HOME} | local 2>/dev/null
+done echo && sed echo cd $(pwd) local then 'quoted text' readonly grep
+	sed cd /usr/bin | local /usr/bin done done readonly
+	export sed export sed "$@" echo && 2>/dev/null
+export echo grep --verbose done grep "$@" "$@" echo done then -eu x=1 export
+		&& ${HOME} -eu ${HOME} awk done readonly
+	x=1 && printf printf local then readonly $(pwd) echo $(pwd) "$1" cd echo | then
+-eu echo ${HOME} sed local | 2>/dev/null --verbose x=1 | printf
+	then "$@" --verbose test $(pwd) done readonly -eu
+		x=1 /usr/bin export $(pwd) cd | ${HOME} then && -eu sed grep && 'quoted text'
+	test done readonly --verbose "$1" test ${HOME} -eu
+	export 2>/dev/null echo ${HOME} awk echo then -eu && "$1" cd echo echo
+2>/dev/null "$1" echo -eu ${HOME} && done readonly | export test
+		cd | awk local then local /usr/bin -eu cd test cd 2>/dev/null
+	local test -eu --verbose then /usr/bin "$@" then cd "$@" done
+		&& | 'quoted text' export echo awk printf sed x=1
+		done --verbose "$@" $(pwd)
+printf | printf | cd test x=1 done -eu --verbose awk x=1 "$@" -eu | -eu &&
+		| "$1" "$1" 'quoted text' --verbose 2>/dev/null
+	'quoted text' cd | "$@" --verbose
+	"$@" export $(pwd) x=1 test && done local $(pwd) $(pwd) readonly x=1 x=1
+done --verbose ${HOME} printf
+		export $(pwd) done x=1 then cd sed $(pwd) cd local printf
+cd $(pwd) 'quoted text' -eu --verbose x=1
+	--verbose --verbose echo printf
+	--verbose local done $(pwd) readonly export --verbose
+		${HOME} sed test 2>/dev/null readonly 'quoted text' readonly cd then then
+		'quoted text' cd test -eu sed ${HOME} --verbose readonly 2>/dev/null
+		-eu grep x=1 done -eu grep /usr/bin local awk -eu
+	test 'quoted text' $(pwd) sed echo cd readonly $(pwd) --verbose /usr/bin
+		awk && ${HOME} ${HOME} 'quoted text'
+/usr/bin ${HOME} local sed cd && "$1" awk awk 'quoted text' grep sed
+	"$@" test 2>/dev/null | -eu 2>/dev/null "$1" | ${HOME} 2>/dev/null
+		echo ${HOME} 2>/dev/null "$@" 'quoted text'
+	then "$1" /usr/bin -eu awk then $(pwd) readonly awk echo cd $(pwd) --verbose
+		awk readonly /usr/bin readonly cd printf then export /usr/bin ${HOME}
+then awk && | printf cd then ${HOME} local -eu test printf ${HOME} 'quoted text'
+	"$@" 2>/dev/null | ${HOME} --verbose export "$1" --verbose -eu local export
+		grep test awk grep then ${HOME} done x=1
+		/usr/bin grep /usr/bin sed cd echo cd "$@" local "$@" grep
+	local /usr/bin /usr/bin --verbose 'quoted text' awk "$@" 'quoted text' cd
+awk awk /usr/bin --verbose printf test cd x=1 2>/dev/null local ${HOME} 'quoted text'
+	| awk then ${HOME} ${HOME} 'quoted text' grep --verbose readonly x=1 'quoted text'
+then | then x=1 test done $(pwd) 2>/dev/null 'quoted text'
+		awk sed && readonly then -eu $(pwd) && 'quoted text' export --verbose printf "$@"
+	${HOME} 'quoted text' 'quoted text' -eu local printf test | 'quoted text'
+	/usr/bin echo done echo sed --verbose
+	"$1" awk awk ${HOME} local ${HOME}
+		$(pwd) printf cd local done x=1 awk done /usr/bin grep cd sed 2>/dev/null
+/usr/bin test local local test sed
+	done awk test grep /usr/bin x=1 x=1 --verbose echo | 'quoted text'
+		cd | 'quoted text' --verbose then grep -eu 'quoted text' awk done export ${HOME}
+local echo --verbose --verbose -eu readonly x=1 then local
+	--verbose done x=1 'quoted text'
+		local grep ${HOME} then --verbose readonly "$1"
+		echo 2>/dev/null $(pwd) grep awk done grep awk local printf $(pwd)
+		local export --verbose local x=1 "$1" "$1" && /usr/bin -eu /usr/bin
+&& readonly 'quoted text' local printf -eu x=1 cd local done sed ${HOME} done &&
+2>/dev/null 'quoted text' readonly
+		awk cd x=1 $(pwd) | "$@" awk cd
+		| printf readonly cd /usr/bin $(pwd) --verbose local 2>/dev/null readonly
+		'quoted text' done "$1" ${HOME} awk readonly export
+		local then "$1" sed echo $(pwd) then "$1" $(pwd) x=1 'quoted text'
+	"$@" done then x=1 readonly 'quoted text'
+x=1 sed grep /usr/bin done cd done printf ${HOME} awk
+		${HOME} sed "$1" /usr/bin /usr/bin readonly echo --verbose
+'quoted text' sed && ${HOME} $(pwd) echo export "$1" -eu done 2>/dev/null
+	readonly "$@" test export printf readonly
+		x=1 cd | awk cd local readonly 'quoted text' "$@" $(pwd) export ${HOME} 2>/dev/null
+'quoted text' printf export sed done echo | awk -eu 'quoted text'
+		&& cd sed -eu && x=1 local test --verbose local grep sed | --verbose export
+	cd "$@" printf grep awk "$1" "$@" printf done $(pwd) && --verbose cd ${HOME}
+	printf "$1" "$@" grep $(pwd) cd grep sed && local --verbose
+		echo && x=1 2>/dev/null -eu then &&
+		'quoted text' --verbose --verbose 2>/dev/null && echo done ${HOME}
+		"$@" awk done $(pwd) grep "$@" grep && && cd sed done echo awk printf "$1"
+	awk 'quoted text' readonly && grep -eu 'quoted text' | awk /usr/bin
+/usr/bin $(pwd) ${HOME} "$1" awk /usr/bin cd -eu
+	${HOME} echo sed ${HOME} --verbose awk
+		2>/dev/null cd --verbose done x=1 local "$1" done 'quoted text'
+		'quoted text' 'quoted text' done readonly "$@" -eu local ${HOME}
+	-eu cd grep then 'quoted text' done sed readonly done "$1" done "$1" --verbose
+	x=1 awk echo awk grep awk 'quoted text' "$1" done /usr/bin -eu
+export $(pwd) export sed local "$@"
+	local cd printf | 2>/dev/null
+$(pwd) --verbose test 'quoted text' "$@" cd 'quoted text' --verbose
+		awk done --verbose readonly
+		x=1 /usr/bin /usr/bin && echo sed readonly /usr/bin export "$1" awk
+	2>/dev/null x=1 export grep local local export -eu /usr/bin cd done then
+	grep export then --verbose printf "$@" $(pwd)
+-eu -eu 2>/dev/null /usr/bin x=1 ${HOME} readonly
+export "$1" $(pwd) cd /usr/bin sed 2>/dev/null test
+awk /usr/bin | | echo | cd --verbose printf "$1"
+	-eu echo local export done 2>/dev/null done grep && test test sed printf
+		test test 'quoted text' 2>/dev/null cd readonly $(pwd) printf /usr/bin
+test export --verbose "$1" 2>/dev/null cd printf
+		then ${HOME} ${HOME} --verbose then -eu done done printf echo test
+readonly && sed $(pwd) -eu readonly
+		$(pwd) done "$1" "$@" sed
+		x=1 "$@" /usr/bin local 2>/dev/null grep "$1" sed done "$@"
+'quoted text' $(pwd) -eu --verbose ${HOME} 'quoted text'
+	/usr/bin 2>/dev/null |
+| local 2>/dev/null ${HOME} --verbose /usr/bin
+	2>/dev/null done x=1 then $(pwd) --verbose done then "$1" | ${HOME} 2>/dev/null
+		sed "$1" echo -eu local $(pwd) then cd test
+		--verbose $(pwd) then x=1 printf
+x=1 test "$@" export ${HOME} 2>/dev/null
+	"$@" x=1 local 2>/dev/null local --verbose
+'quoted text' && export && local awk ${HOME} done 'quoted text' cd |
+		local cd x=1 echo test /usr/bin test export ${HOME} export /usr/bin
+		/usr/bin sed export -eu export then "$@" && "$@" readonly then
+		"$@" --verbose x=1 local -eu local test awk echo "$1" printf
+	sed sed export local cd 2>/dev/null
+readonly "$1" echo awk "$1" local
+		export printf | /usr/bin grep grep ${HOME}
+--verbose grep --verbose test then x=1 'quoted text' x=1
+		printf 'quoted text' && export test then test && | echo
+"$@" /usr/bin grep "$@" $(pwd) 2>/dev/null 2>/dev/null
+	${HOME} local grep test sed grep export x=1 /usr/bin then echo && printf
+grep /usr/bin ${HOME} cd "$@" --verbose | local readonly sed "$1" ${HOME} test
+	sed --verbose "$@" cd $(pwd)
+		-eu /usr/bin 'quoted text' grep && "$@" x=1
+		export local awk awk ${HOME} sed 2>/dev/null echo grep $(pwd) awk export /usr/bin
+done done local | | 'quoted text' && ${HOME}
+		printf 'quoted text' x=1 sed /usr/bin "$@" ${HOME} local
+'quoted text' ${HOME} grep awk then x=1 export local -eu test -eu /usr/bin
+		done cd sed /usr/bin awk echo && --verbose x=1 readonly local "$@" 2>/dev/null
+	&& "$@" x=1 readonly test | sed local ${HOME} awk
+		"$@" done done local "$1" | readonly grep /usr/bin | && -eu && sed local -eu
+		-eu then cd 'quoted text' 'quoted text' "$@" local
+	| test "$@" done --verbose x=1 "$@"
+		printf "$1" readonly cd 'quoted text' export awk --verbose
+"$1" printf "$1" $(pwd) awk sed sed $(pwd) sed | 'quoted text'
+		then grep "$1" printf --verbose && local $(pwd) --verbose -eu
+local test then local test done awk
+		readonly $(pwd) $(pwd) 2>/dev/null awk &&
+	--verbose echo --verbose awk readonly export x=1 2>/dev/null ${HOME}
+		sed local test export sed printf awk 2>/dev/null "$@" test -eu sed then
+2>/dev/null export $(pwd) $(pwd) awk /usr/bin sed readonly
+	'quoted text' x=1 'quoted text' $(pwd) 2>/dev/null
+export -eu /usr/bin grep 2>/dev/null
+		"$1" export sed printf readonly ${HOME} sed "$@" && $(pwd) echo readonly readonly
+sed then $(pwd) 'quoted text' grep -eu echo /usr/bin 'quoted text' test
+	local printf sed cd done export "$1" printf
+"$1" printf 2>/dev/null grep /usr/bin 2>/dev/null /usr/bin local
+	x=1 "$@" sed 2>/dev/null readonly local
+		'quoted text' | --verbose echo readonly "$1" sed then -eu done && x=1 grep -eu
+		x=1 -eu local export $(pwd) -eu done /usr/bin | export export test done
+printf 'quoted text' /usr/bin "$@" then --verbose export
+	awk "$1" "$1" printf "$1" "$@" cd -eu
+echo --verbose ${HOME} awk sed then readonly "$1" test 2>/dev/null
+		&& x=1 ${HOME} cd local printf awk done ${HOME} | --verbose ${HOME} sed 'quoted text'
+	grep $(pwd) "$@" test /usr/bin ${HOME} 2>/dev/null 'quoted text' | -eu
+		2>/dev/null -eu printf 'quoted text' -eu "$1"
+		export x=1 'quoted text' "$1"
+local --verbose --verbose sed done printf local export cd x=1
+		local "$@" echo ${HOME} /usr/bin local && "$@" "$1" "$1" --verbose then awk
+		done /usr/bin "$1" 'quoted text' 2>/dev/null | test "$@" test | | done readonly
+grep grep awk -eu 2>/dev/null && --verbose /usr/bin ${HOME} test echo --verbose
+"$@" "$@" done -eu "$@" grep cd awk "$@" | grep test printf
+'quoted text' | sed && --verbose 2>/dev/null "$1" | local x=1 --verbose "$1"
+	test -eu "$1" export 2>/dev/null echo $(pwd) export
+&& -eu -eu then -eu ${HOME} done
+		"$1" cd local readonly "$@" export
+cd echo ${HOME} && ${HOME}
+		| grep readonly /usr/bin readonly
+		-eu "$1" $(pwd) 2>/dev/null x=1 x=1
+	$(pwd) 2>/dev/null /usr/bin printf /usr/bin ${HOME} sed export
+	echo grep grep && export -eu "$1" | sed | readonly sed sed -eu
+		test x=1 echo 2>/dev/null cd --verbose sed test done 2>/dev/null 'quoted text'
+then sed local local echo "$1"
+		cd $(pwd) 'quoted text' readonly $(pwd) && export echo readonly sed
+		grep then cd 'quoted text' /usr/bin grep done then sed 2>/dev/null
+x=1 local awk sed sed --verbose local "$@" ${HOME}
+		-eu /usr/bin 2>/dev/null x=1 'quoted text' "$@" $(pwd) ${HOME} --verbose
+&& | $(pwd) --verbose test cd cd
+		"$@" x=1 test readonly test done -eu
+	/usr/bin 'quoted text' export sed sed /usr/bin $(pwd) sed echo /usr/bin local
+echo sed -eu awk done sed printf cd "$1" ${HOME}
+	| -eu export local "$@" ${HOME} --verbose ${HOME} then sed 'quoted text'
+readonly $(pwd) echo "$1" $(pwd) echo --verbose
+	sed && grep x=1 grep export --verbose cd ${HOME} | "$1" | export
+		cd test | /usr/bin /usr/bin sed awk export $(pwd) readonly
+	sed sed readonly | done $(pwd) "$1" && $(pwd) echo awk "$1"
+	awk "$1" awk test /usr/bin local then readonly "$1" awk printf local
+	"$@" readonly local "$@" local
+		$(pwd) --verbose /usr/bin --verbose "$1" /usr/bin
+		grep then "$1" printf | && "$1" && ${HOME} sed ${HOME} readonly sed $(pwd) "$@"
+		done echo done cd 'quoted text' export 2>/dev/null test
+		| export then local && 'quoted text' ${HOME} -eu $(pwd)
+	export then echo done && x=1 | local echo "$1"
+	cd -eu && awk done x=1 awk export cd grep printf 'quoted text' 'quoted text'
+	test readonly local ${HOME} 'quoted text' grep "$@" then
+	'quoted text' cd local grep done sed grep x=1 then awk cd "$@" |
+| export grep "$@" | 2>/dev/null
+		--verbose 2>/dev/null export grep -eu "$1" local grep 'quoted text'
+local done 'quoted text' "$1" "$1" 2>/dev/null && && awk -eu awk printf
+	x=1 ${HOME} printf --verbose test $(pwd) cd cd $(pwd)
+awk cd --verbose x=1 readonly
+		x=1 printf done | local x=1 /usr/bin
+		"$@" echo ${HOME} "$@" cd "$1"
+	then awk sed 2>/dev/null
+		/usr/bin printf --verbose done grep cd awk cd done echo
+		"$@" export readonly local awk echo test export awk done cd cd
+grep grep done x=1 'quoted text' then awk x=1 ${HOME} $(pwd) x=1 "$@"
+	"$@" printf export then export test test ${HOME} printf awk readonly
+		awk sed then "$1" sed 2>/dev/null then then x=1 cd ${HOME} cd
+	echo --verbose "$1" done ${HOME}
+export then export --verbose -eu "$@" -eu export -eu 2>/dev/null local "$1"
+echo printf "$@" printf sed 2>/dev/null test readonly
+		-eu "$@" printf -eu awk | test --verbose printf export x=1 "$1" $(pwd)
+"$1" /usr/bin local local local echo x=1 x=1 cd
+$(pwd) x=1 x=1 $(pwd) local ${HOME}
+	-eu sed awk && echo printf /usr/bin && --verbose
+	cd grep x=1 | 2>/dev/null done
+		/usr/bin echo && then $(pwd) "$1" --verbose -eu export && -eu
+readonly export readonly ${HOME} x=1 done "$@" cd --verbose 'quoted text'
+	| 'quoted text' x=1 echo test echo echo cd readonly x=1 test local --verbose 'quoted text'
+	echo 2>/dev/null "$1" then readonly --verbose
+		then test "$@" ${HOME} x=1 then ${HOME} export 'quoted text'
+-eu readonly $(pwd) export awk awk "$1" local
+printf --verbose cd export awk done
+export $(pwd) "$1" $(pwd)
+	cd then --verbose /usr/bin printf done --verbose
+	readonly local -eu grep "$1" -eu export -eu /usr/bin test export cd
+done readonly | export
+x=1 local ${HOME} && test 'quoted text' cd && grep awk && done test ${HOME}
+		"$@" $(pwd) then then sed test sed ${HOME} awk ${HOME} /usr/bin readonly
+done -eu export readonly 2>/dev/null printf "$1" cd done echo x=1 export awk
+		then awk grep local done grep $(pwd) local
+test test && 2>/dev/null 'quoted text' /usr/bin echo && local
+echo readonly then 2>/dev/null cd printf | readonly readonly test && x=1
+	2>/dev/null local 'quoted text' /usr/bin awk readonly local then readonly
+		${HOME} done && /usr/bin 2>/dev/null
+	--verbose x=1 readonly 2>/dev/null printf /usr/bin
+		--verbose awk readonly cd sed | echo x=1
+		test x=1 'quoted text' ${HOME} "$1" local
+&& -eu awk test --verbose --verbose then sed && cd echo | "$@" "$1" echo sed 'quoted text'
+cd $(pwd) x=1 test awk sed export 'quoted text' cd ${HOME}
+	| 2>/dev/null | | then sed $(pwd) /usr/bin /usr/bin /usr/bin sed "$1" | cd |
+/usr/bin /usr/bin "$@" --verbose
+x=1 test awk "$1" echo 2>/dev/null echo done && awk readonly "$@"
+test 2>/dev/null 2>/dev/null echo ${HOME} -eu awk $(pwd) sed | "$1" 2>/dev/null
+grep echo | export "$1" readonly readonly x=1 sed
+		echo 'quoted text' awk --verbose $(pwd)
+	--verbose cd && | --verbose done cd test -eu && readonly --verbose sed
+		${HOME} readonly && 2>/dev/null
+'quoted text' echo sed x=1 &&
+	grep echo then then && "$1" sed grep done 'quoted text'
+		readonly test -eu 2>/dev/null --verbose --verbose
+	/usr/bin x=1 export --verbose readonly local echo /usr/bin
+		done sed ${HOME} 2>/dev/null local
+	x=1 test printf /usr/bin test
+	grep -eu readonly echo x=1 x=1 cd then sed $(pwd) && test cd then
+	sed 'quoted text' cd grep readonly 'quoted text' done
+	/usr/bin && local --verbose && grep awk then ${HOME} $(pwd)
+	x=1 cd | echo --verbose x=1 2>/dev/null grep -eu
+		sed then 2>/dev/null 2>/dev/null
+		${HOME} cd "$@" test /usr/bin 2>/dev/null x=1 "$1" "$1"
+	"$@" x=1 readonly readonly grep
+	done test "$@" --verbose && readonly
+	echo x=1 2>/dev/null grep local done
+awk local 2>/dev/null "$1" printf sed cd $(pwd)
+		2>/dev/null cd readonly 2>/dev/null 2>/dev/null grep "$1"
+/usr/bin sed printf | export x=1
+	done export done | && -eu "$1" printf awk test --verbose export
+	&& sed cd test --verbose echo sed
+		test then awk export export done printf ${HOME} cd ${HOME}
+	-eu -eu cd then done x=1 --verbose cd done -eu 2>/dev/null
+	"$@" readonly echo echo cd 2>/dev/null
+	grep sed local 2>/dev/null local $(pwd) "$1" x=1
+/usr/bin awk export then grep printf 2>/dev/null 'quoted text'
+export grep 2>/dev/null $(pwd) $(pwd)
+	/usr/bin readonly --verbose done printf
+		"$@" -eu then test && "$@" test 'quoted text' |
+2>/dev/null then $(pwd)
+sed readonly "$@" && grep printf x=1 2>/dev/null readonly && ${HOME}
+| readonly printf -eu readonly -eu test test readonly test
+		'quoted text' done 2>/dev/null printf && printf grep
+	grep grep -eu "$@" 2>/dev/null
+	"$@" -eu -eu | ${HOME}
+${HOME} printf "$1" x=1 cd /usr/bin done $(pwd) /usr/bin 'quoted text' 'quoted text'
+"$1" "$1" /usr/bin /usr/bin
+test ${HOME} cd "$@" "$@" awk && awk sed | grep 'quoted text' &&
+	printf sed /usr/bin sed && && "$@"
+	test printf readonly x=1 ${HOME} grep 2>/dev/null
+	x=1 test "$@" grep grep | "$@" local done printf printf /usr/bin --verbose
+x=1 | printf | local | 'quoted text'
+	-eu x=1 ${HOME} awk -eu then local export
+		2>/dev/null "$1" grep "$@"
+		grep 2>/dev/null awk "$1" then "$1" done ${HOME}
+		"$@" "$1" "$1" export --verbose -eu awk test printf
+	echo 'quoted text' grep $(pwd) -eu local grep | 2>/dev/null
+		awk "$@" echo 2>/dev/null ${HOME} cd printf | cd && readonly $(pwd)
+	done readonly grep readonly printf test cd 'quoted text' 'quoted text'
+	&& printf -eu x=1 --verbose 2>/dev/null --verbose ${HOME}
+	/usr/bin 'quoted text' --verbose awk |
+		x=1 echo /usr/bin export ${HOME} then test echo
+		-eu $(pwd) /usr/bin --verbose 'quoted text' "$1" printf awk export | printf -eu
+local printf then -eu
+-eu 'quoted text' sed ${HOME} then 'quoted text' 'quoted text' "$1" 2>/dev/null
+"$@" sed export --verbose cd sed
+$(pwd) && grep readonly then 'quoted text' && |
+		/usr/bin 'quoted text' /usr/bin echo "$1" cd ${HOME} "$1" && x=1 $(pwd) /usr/bin
+	sed "$1" done 'quoted text' -eu "$1" 2>/dev/null --verbose
+local ${HOME} readonly done printf grep "$@" then
+		/usr/bin -eu x=1 readonly cd $(pwd)
+	printf ${HOME} test then echo
+export && 'quoted text' 2>/dev/null export cd |
+| awk 2>/dev/null done awk awk cd cd grep readonly done then local readonly
+	--verbose then 2>/dev/null echo "$1" && awk -eu 2>/dev/null | 2>/dev/null export
+	| x=1 x=1 'quoted text' local grep --verbose | grep $(pwd) | $(pwd) ${HOME} 'quoted text'
+| awk sed 'quoted text' --verbose
+		&& local 2>/dev/null 2>/dev/null cd /usr/bin x=1
+	2>/dev/null grep x=1 | echo echo
+		&& 'quoted text' && "$1"
+		then | cd export test
+	&& local awk test export
+		export $(pwd) grep grep readonly local ${HOME} local local
+export /usr/bin | local -eu then readonly | &&
+	readonly test && "$1" readonly done x=1 printf
+		| | "$@" awk | "$1" cd $(pwd) export
+cd "$@" x=1 "$1" -eu "$@" export awk /usr/bin export readonly sed
+		'quoted text' echo sed done | echo /usr/bin cd
+	--verbose /usr/bin | ${HOME} export test printf
+	'quoted text' /usr/bin awk sed export echo ${HOME} readonly ${HOME} grep cd
+	${HOME} ${HOME} awk cd cd done local --verbose
+cd && printf ${HOME} /usr/bin "$1" readonly readonly local | --verbose
+	export "$1" then done "$1" && local x=1 2>/dev/null && awk readonly --verbose
+	&& "$@" /usr/bin && /usr/bin echo echo ${HOME} test 'quoted text' && ${HOME}
+&& "$1" --verbose -eu 'quoted text' x=1 local then then /usr/bin cd x=1 && cd /usr/bin
+		'quoted text' test ${HOME} sed x=1 echo then readonly local printf
+	2>/dev/null awk done && $(pwd) local ${HOME} $(pwd) --verbose | done
+	x=1 test && readonly "$@" sed readonly /usr/bin done then && then test export
+		echo 'quoted text' 'quoted text' then 'quoted text'
+		export x=1 local readonly readonly
+	"$@" export --verbose --verbose 'quoted text' awk cd then sed cd export cd --verbose
+		readonly 'quoted text' 'quoted text' then ${HOME} "$1" "$@" awk printf
+		local | "$@" x=1 awk | done then
+'quoted text' 2>/dev/null | --verbose && 2>/dev/null "$@" sed grep then
+local grep 2>/dev/null printf sed | /usr/bin export /usr/bin printf
+	printf grep cd 'quoted text' x=1 test awk echo
+		x=1 cd 2>/dev/null --verbose local test local
+		local && 2>/dev/null 'quoted text' test grep $(pwd) then 2>/dev/null -eu
+	${HOME} done cd export 2>/dev/null "$1"
+		x=1 then local cd 'quoted text'
+		"$@" 2>/dev/null 'quoted text' then export ${HOME} readonly
+grep export && 2>/dev/null then | --verbose
+		2>/dev/null -eu --verbose sed "$1" "$@" --verbose then $(pwd) grep
+"$1" test "$1" -eu -eu echo local -eu echo "$1" -eu | --verbose
+export cd "$1" done | $(pwd) $(pwd) then cd ${HOME} grep echo cd local printf
+	done "$1" 'quoted text' then then
+	"$1" cd test readonly readonly readonly
+	cd done done local "$@" -eu
+		-eu sed printf then x=1 readonly done grep "$@" 2>/dev/null
+2>/dev/null && printf -eu cd /usr/bin
+		then -eu readonly sed echo sed x=1 readonly "$@"
+x=1 readonly $(pwd) awk 2>/dev/null then test 2>/dev/null
+		cd x=1 local && && --verbose grep "$1" then 'quoted text' --verbose cd then local
+		-eu "$1" readonly echo echo /usr/bin awk "$@" cd x=1 && readonly
+| | 'quoted text' echo test readonly then awk x=1
+readonly ${HOME} 2>/dev/null
+echo --verbose grep awk echo export printf echo
+awk cd grep printf export
+	x=1 && then sed && 2>/dev/null readonly | grep --verbose x=1
+		then 2>/dev/null done ${HOME} cd cd then --verbose $(pwd)
+	grep readonly awk "$1" | export "$@"
+readonly /usr/bin cd local "$1" sed echo done "$@" awk readonly "$@" --verbose
+		export cd "$@" $(pwd) sed local export done sed x=1 x=1 echo awk
+	echo 'quoted text' -eu && awk printf "$@" then 2>/dev/null test
+	local cd 2>/dev/null x=1 x=1 grep | 'quoted text'
+	| done awk awk export awk 2>/dev/null | cd readonly $(pwd) -eu 'quoted text'
+		&& awk printf "$1" export && ${HOME}
+		echo $(pwd) && printf export "$1" $(pwd)
+		test cd cd grep && local ${HOME} -eu then done $(pwd) && | $(pwd) awk local test
+'quoted text' then /usr/bin printf --verbose
+	sed -eu printf | readonly -eu /usr/bin "$1" --verbose local cd ${HOME}
+grep /usr/bin then 2>/dev/null 'quoted text' export local awk 2>/dev/null export
+		awk 'quoted text' export awk echo ${HOME} done export x=1
+	"$1" -eu /usr/bin then then $(pwd) -eu cd ${HOME} $(pwd) cd
@@ -0,0 +1,2001 @@
+/usr/bin export -eu /usr/bin readonly grep awk printf
+sed --verbose -eu done x=1 local 2>/dev/null 2>/dev/null
+		echo readonly -eu -eu awk && printf
+		done "$@" | done --verbose printf x=1 --verbose then | sed --verbose cd 'quoted text'
+	awk | "$@" done | then && test echo export done 'quoted text'
+		done cd test export ${HOME} done echo export awk done && sed
+	--verbose | readonly && echo $(pwd) "$1" cd 2>/dev/null $(pwd)
+echo done | printf export /usr/bin
+		grep && echo --verbose -eu "$@" then $(pwd) then "$1" local cd x=1 "$1" printf
+		${HOME} local ${HOME} 'quoted text' /usr/bin
+awk export 2>/dev/null local $(pwd) then printf local 2>/dev/null | "$1" awk
+	&& export 'quoted text' | then
+		readonly "$@" then $(pwd)
+	--verbose ${HOME} ${HOME} readonly -eu awk 2>/dev/null "$@"
+		export "$@" export 2>/dev/null printf
+echo ${HOME} "$1" | ${HOME}
+		'quoted text' readonly sed done
+sed "$@" "$@" 2>/dev/null --verbose
+	readonly printf export grep echo
+	2>/dev/null && ${HOME} export /usr/bin cd export cd then export -eu local printf
+	test | cd readonly printf grep && export /usr/bin && $(pwd) && "$1"
+		"$@" 'quoted text' readonly /usr/bin 'quoted text'
+	local echo readonly | export | readonly ${HOME} readonly
+	-eu cd x=1 cd cd /usr/bin "$1" done --verbose 2>/dev/null test then
+	readonly printf | printf sed local
+	&& grep export "$1" then test $(pwd) --verbose
+2>/dev/null printf $(pwd) then grep "$1" 2>/dev/null 2>/dev/null cd
+awk readonly echo -eu ${HOME} 2>/dev/null -eu
+	local 2>/dev/null echo && then
+		then test --verbose grep echo local local test done export && | then
+local 'quoted text' && readonly -eu test readonly
+		grep export sed readonly sed grep readonly
+	${HOME} done cd | 2>/dev/null "$@" local done sed awk done | done grep
+	--verbose ${HOME} sed awk x=1 done --verbose $(pwd) && grep done /usr/bin "$@"
+x=1 "$1" cd && local "$1"
+'quoted text' $(pwd) x=1 && export
+		grep "$1" 'quoted text' sed
+	${HOME} --verbose echo sed | "$@" -eu -eu local then
+		| "$1" -eu printf sed 'quoted text' test /usr/bin then awk cd echo 'quoted text'
+	local "$1" readonly "$@"
+	$(pwd) 2>/dev/null then --verbose printf 2>/dev/null echo awk sed echo
+		x=1 export ${HOME} export then awk x=1 && echo then
+/usr/bin test local /usr/bin export x=1 export | "$@"
+"$@" x=1 && sed echo test ${HOME} "$1" then $(pwd) done
+$(pwd) | echo $(pwd) --verbose
+2>/dev/null 'quoted text'
+cd $(pwd) grep /usr/bin 'quoted text'
+		awk "$@" then --verbose /usr/bin "$1" -eu && awk
+sed && printf "$1" readonly done awk $(pwd) printf done 'quoted text' local
+| && && x=1 ${HOME} --verbose done printf sed printf echo &&
+	$(pwd) readonly "$@" /usr/bin echo local 2>/dev/null cd x=1 "$1" ${HOME}
+		sed export then "$1" && | done "$@" && ${HOME} 'quoted text' awk printf
+		${HOME} test $(pwd) ${HOME} ${HOME} "$1" x=1 | awk cd done
+	--verbose --verbose then && test done printf $(pwd) done cd
+		printf "$@" export | $(pwd) | 'quoted text' 2>/dev/null readonly
+		| local cd export export grep grep sed 2>/dev/null $(pwd) x=1
+test "$1" done "$@" echo 'quoted text'
+echo readonly awk sed cd cd -eu "$@" grep awk "$@" /usr/bin "$@"
+	| echo test awk sed $(pwd) grep echo export awk --verbose
+grep sed | cd cd echo grep then -eu
+		local ${HOME} $(pwd) 2>/dev/null grep awk grep sed export echo printf
+	grep readonly echo export awk readonly
+		sed done export local echo echo && | ${HOME} x=1 printf
+awk ${HOME} cd 'quoted text' export --verbose export printf 2>/dev/null --verbose
+export 'quoted text' ${HOME} echo local
+| test export echo sed 'quoted text' 2>/dev/null grep then
+printf ${HOME} test then $(pwd) "$1" ${HOME} $(pwd) local 'quoted text'
+awk local | grep && && readonly echo x=1 readonly
+printf then export "$@" 'quoted text' then x=1 "$@"
+	awk then x=1 echo cd --verbose --verbose then readonly sed grep "$@" local --verbose
+cd grep done then printf /usr/bin then grep -eu grep x=1 ${HOME} local cd
+	2>/dev/null awk "$1" sed -eu done && printf done 2>/dev/null local "$1" export
+		x=1 printf cd -eu x=1 x=1 then echo export /usr/bin 2>/dev/null sed "$1"
+	2>/dev/null $(pwd) --verbose "$1" grep x=1 -eu
+		sed 'quoted text' "$1" then "$@" awk then -eu
+$(pwd) $(pwd) -eu printf test && grep cd && then cd 2>/dev/null readonly
+	sed && 2>/dev/null echo grep test --verbose $(pwd) && printf
+	&& grep awk readonly && test test sed printf done cd 2>/dev/null sed --verbose
+		readonly "$1" readonly grep $(pwd)
+	then then 'quoted text' awk x=1 && echo
+local x=1 -eu test sed
+${HOME} printf local cd -eu then -eu readonly
+echo 'quoted text' --verbose --verbose x=1 grep
+2>/dev/null | done sed awk printf && | echo
+readonly local $(pwd) grep export /usr/bin
+	--verbose 'quoted text' "$1" "$@" x=1 printf -eu echo --verbose && sed "$@" x=1
+	grep --verbose --verbose then test cd /usr/bin x=1 then awk 2>/dev/null
+		'quoted text' echo "$@" awk test awk --verbose export x=1 grep
+	"$@" "$1" 'quoted text' /usr/bin
+	$(pwd) done x=1 -eu && test sed sed sed && readonly $(pwd) x=1
+/usr/bin done ${HOME} 2>/dev/null
+		done "$@" ${HOME} done awk grep done && then -eu && local x=1 'quoted text'
+grep $(pwd) cd "$@" -eu --verbose cd "$1" awk /usr/bin done sed
+"$1" echo ${HOME} -eu cd then grep test test awk grep $(pwd) 'quoted text' "$@"
+		test ${HOME} test done
+		sed test "$1" x=1 sed done local
+		cd local -eu /usr/bin 'quoted text' 'quoted text'
+	/usr/bin ${HOME} local local local readonly /usr/bin --verbose "$@" sed export
+"$1" "$1" -eu ${HOME} then echo test 2>/dev/null printf printf local
+	printf "$1" local sed done
+then then "$@" ${HOME} export ${HOME} 'quoted text' grep
+	$(pwd) ${HOME} printf readonly awk
+		"$@" grep test awk && export echo grep ${HOME} local cd "$1" local | printf
+	export sed then local readonly sed
+		echo readonly "$@" -eu sed "$1" then cd local printf
+		$(pwd) --verbose | test "$1" grep x=1 'quoted text'
+		${HOME} done "$1" "$1" 'quoted text' 2>/dev/null grep awk
+	"$@" /usr/bin readonly echo readonly then 'quoted text'
+	done -eu echo readonly cd && grep "$1" 'quoted text' x=1 awk
+	--verbose sed local --verbose -eu echo ${HOME} echo x=1 /usr/bin
+-eu test echo /usr/bin
+test --verbose "$1" cd 'quoted text' cd "$1" "$@" local --verbose /usr/bin
+	'quoted text' /usr/bin done 2>/dev/null
+readonly --verbose ${HOME} echo x=1 "$@" 'quoted text' echo then
+		${HOME} export then awk export awk then ${HOME} | 'quoted text'
+-eu echo "$@" "$@" && "$@" done grep 2>/dev/null "$1"
+	export export | local grep x=1 awk echo --verbose
+export ${HOME} then "$1" export local
+&& cd readonly /usr/bin then | /usr/bin /usr/bin "$1" awk 2>/dev/null
+		| /usr/bin export then grep ${HOME}
+$(pwd) export "$1" awk cd printf then --verbose ${HOME} readonly printf
+	"$@" sed then 'quoted text' printf export "$1" ${HOME} 'quoted text'
+printf "$1" sed $(pwd) local cd
+	cd then | ${HOME} "$1" grep /usr/bin
+	&& -eu sed test 'quoted text'
+	sed 2>/dev/null -eu -eu grep done local done then && grep $(pwd)
+		"$1" then -eu -eu "$1" readonly cd --verbose /usr/bin
+cd 2>/dev/null local awk sed | 'quoted text' ${HOME} | done
+	grep "$@" done done echo test && $(pwd) test export "$@" test $(pwd)
+--verbose 'quoted text' -eu grep
+echo printf -eu then awk | local then "$@" done | echo ${HOME} sed ${HOME}
+	awk printf x=1 -eu $(pwd) /usr/bin then echo grep test readonly
+&& /usr/bin awk done awk sed 2>/dev/null /usr/bin
+sed test readonly "$@" sed 'quoted text'
+		$(pwd) cd readonly ${HOME} /usr/bin "$@"
+		"$@" $(pwd) done $(pwd) readonly x=1 done cd --verbose x=1 readonly
+		-eu then printf x=1 local --verbose -eu
+		then /usr/bin $(pwd) echo 'quoted text'
+		export "$1" 2>/dev/null grep | printf
+done cd 2>/dev/null "$1" echo 2>/dev/null
+local -eu x=1 "$@" /usr/bin readonly
+	readonly 2>/dev/null cd echo -eu cd then grep x=1 test
+	sed export -eu "$1" 'quoted text' export local "$@" "$1" --verbose export local
+		cd local test --verbose sed x=1 then --verbose $(pwd) export --verbose done then
+	then | --verbose sed echo ${HOME} done
+		grep /usr/bin | cd test
+"$1" echo awk && -eu "$1" 'quoted text' export ${HOME} ${HOME}
+awk printf then | "$@" x=1
+	-eu readonly local test 2>/dev/null $(pwd) done
+		cd $(pwd) readonly echo
+		then then && sed printf echo echo test
+		-eu --verbose | $(pwd)
+		awk cd -eu readonly && "$@" $(pwd) awk 'quoted text' $(pwd)
+grep -eu echo -eu -eu then test
+	readonly sed grep export printf local done
+printf | 'quoted text' ${HOME} export ${HOME} done $(pwd)
+		awk 'quoted text' grep -eu 2>/dev/null export
+cd test x=1 test then 2>/dev/null "$1" readonly local
+		--verbose 2>/dev/null 'quoted text' awk /usr/bin then 2>/dev/null
+	readonly test x=1 done then
+export "$1" --verbose readonly echo -eu echo 2>/dev/null
+	grep readonly -eu 'quoted text'
+	-eu then -eu grep done --verbose
+/usr/bin "$1" | ${HOME} then readonly "$@" echo awk readonly
+	sed awk -eu awk grep export
+	&& --verbose 'quoted text' cd -eu test
+${HOME} "$@" then grep -eu test && sed 'quoted text' test awk --verbose readonly
+| | | cd "$@" && export done then then
+	local sed sed /usr/bin 2>/dev/null done test | cd "$@"
+	| echo export local export
+	/usr/bin awk export "$1" cd test 2>/dev/null "$@" && awk readonly sed done &&
+		grep 'quoted text' done echo local && "$@" ${HOME} awk grep
+readonly echo readonly | && ${HOME} | /usr/bin grep ${HOME} printf echo
+	/usr/bin && test x=1 awk -eu ${HOME} grep echo | awk readonly ${HOME}
+	&& grep 'quoted text' local local "$1"
+done x=1 $(pwd) grep && echo then 'quoted text' $(pwd) 'quoted text'
+awk local readonly done local sed grep $(pwd) ${HOME}
+	${HOME} /usr/bin readonly 'quoted text' local x=1
+	"$1" export /usr/bin /usr/bin awk && ${HOME} local
+	&& x=1 readonly awk readonly "$1" readonly -eu 'quoted text' grep /usr/bin
+		sed echo readonly sed then done "$@" sed cd test /usr/bin
+	'quoted text' "$@" /usr/bin --verbose local | local readonly ${HOME}
+		awk | cd ${HOME} --verbose ${HOME} echo awk sed /usr/bin "$@" --verbose grep cd
+grep then /usr/bin done /usr/bin x=1 /usr/bin "$@" sed "$@" export
+&& cd ${HOME} readonly && "$1" ${HOME} export then
+$(pwd) test echo sed test cd --verbose ${HOME} && 2>/dev/null $(pwd)
+	"$@" local done export cd readonly
+		"$@" sed 2>/dev/null /usr/bin then "$1" local | echo /usr/bin
+printf test echo /usr/bin done $(pwd)
+"$1" done 2>/dev/null awk printf /usr/bin "$@" sed -eu -eu printf
+local then cd && | test | cd done && "$1" sed test printf
+2>/dev/null x=1 test && cd readonly && $(pwd) sed printf "$@" done
+		sed readonly x=1 echo printf "$1" grep 2>/dev/null
+		${HOME} done done cd 2>/dev/null export done ${HOME} 'quoted text' 2>/dev/null
+		awk local --verbose readonly -eu printf export
+		$(pwd) cd /usr/bin then --verbose
+		x=1 $(pwd) echo x=1 cd export ${HOME} /usr/bin "$@" printf sed
+	--verbose "$1" test then 2>/dev/null
+	done cd local test export readonly $(pwd) grep
+| --verbose printf ${HOME} "$1" printf readonly export ${HOME} && readonly
+		readonly echo -eu then awk "$@" echo echo --verbose --verbose echo $(pwd)
+	printf /usr/bin local x=1 -eu x=1 grep -eu done grep echo -eu 'quoted text'
+		echo sed ${HOME} printf && cd x=1 "$@" grep awk 2>/dev/null cd grep
+	readonly $(pwd) x=1 --verbose 'quoted text'
+	2>/dev/null x=1 readonly && 2>/dev/null
+		done 'quoted text' /usr/bin &&
+| "$1" "$@" grep awk export printf test /usr/bin ${HOME} echo test export
+test ${HOME} awk echo printf cd readonly printf local "$@" export
+	'quoted text' /usr/bin | ${HOME} then sed 'quoted text' x=1 sed
+${HOME} then $(pwd) x=1 2>/dev/null
+		awk echo ${HOME} $(pwd) local /usr/bin cd export local
+		printf x=1 -eu "$@" export ${HOME} | export $(pwd) readonly
+		$(pwd) ${HOME} $(pwd) "$@" awk 2>/dev/null done echo /usr/bin sed 2>/dev/null
+	export echo readonly export x=1 echo cd "$1" 'quoted text'
+		echo echo cd && | /usr/bin test local test && local /usr/bin readonly
+then grep export | readonly
+		--verbose ${HOME} echo $(pwd) awk then $(pwd)
+	echo 'quoted text' test "$1" && sed then /usr/bin --verbose 2>/dev/null
+		${HOME} then ${HOME} awk "$@"
+	| export && -eu readonly /usr/bin -eu ${HOME} 2>/dev/null export
+	test then | ${HOME} printf /usr/bin --verbose printf
+done "$@" export grep --verbose then done printf sed test ${HOME}
+	then awk then && sed local --verbose && 'quoted text' cd printf
+&& test readonly local /usr/bin --verbose echo "$@" x=1 test test
+		export 2>/dev/null awk x=1 "$1"
+		done then done --verbose printf && readonly printf "$1" local
+		export grep sed 'quoted text'
+	done -eu | sed | --verbose readonly ${HOME} grep export "$1" 2>/dev/null 'quoted text'
+	2>/dev/null done "$@" printf
+		/usr/bin && $(pwd) readonly
+readonly --verbose -eu awk ${HOME} printf 'quoted text'
+		&& awk && test awk done export sed
+	2>/dev/null done "$@" readonly cd then awk grep cd --verbose local -eu sed
+local "$@" "$1" sed then then echo then then local
+--verbose echo && 2>/dev/null sed $(pwd) readonly "$@"
+$(pwd) && echo local --verbose
+	sed done -eu done printf 2>/dev/null
+	--verbose printf local test "$1" export done test
+local /usr/bin $(pwd) "$@" cd "$1" --verbose awk "$@" 'quoted text'
+		| 'quoted text' echo done 'quoted text' echo ${HOME} $(pwd)
+		test done -eu && echo
+x=1 -eu export -eu awk grep -eu "$@" && 'quoted text' "$1" -eu ${HOME}
+		$(pwd) test $(pwd) /usr/bin "$@" done printf local
+then -eu awk --verbose cd local "$@" echo test
+	| readonly awk x=1 printf done printf 'quoted text' echo
+		2>/dev/null x=1 then 'quoted text'
+		$(pwd) 2>/dev/null local test local printf local $(pwd) cd done --verbose
+grep done 2>/dev/null -eu $(pwd) 2>/dev/null
+		then && 'quoted text' printf x=1 --verbose "$@"
+	&& grep "$@" $(pwd) /usr/bin printf
+test export -eu 'quoted text' 'quoted text' && export
+	${HOME} "$@" printf grep "$1" --verbose local sed ${HOME} "$1" 2>/dev/null
+sed && 2>/dev/null sed awk 'quoted text' x=1 $(pwd) "$1"
+		done $(pwd) done /usr/bin export test
+		/usr/bin awk printf grep then $(pwd) --verbose x=1 local
+		printf $(pwd) echo cd local ${HOME} printf export 'quoted text' local &&
+	2>/dev/null /usr/bin then --verbose
+	'quoted text' 2>/dev/null
+	$(pwd) 2>/dev/null "$1" readonly 2>/dev/null
+&& echo -eu echo -eu grep x=1 /usr/bin 2>/dev/null echo /usr/bin sed export
+${HOME} then $(pwd) awk $(pwd)
+"$1" 'quoted text' "$@" done "$1" /usr/bin ${HOME}
+	printf /usr/bin 'quoted text' ${HOME} cd -eu | sed ${HOME}
+		local "$@" "$@" ${HOME} ${HOME}
+grep && ${HOME} done ${HOME} 2>/dev/null 'quoted text'
+"$1" cd x=1 grep "$1" "$1" awk readonly
+${HOME} sed $(pwd) "$@" | then local cd printf && printf
+	| "$1" grep sed done ${HOME} sed done | echo sed test export test $(pwd) --verbose
+	export --verbose test test then cd grep then x=1 export /usr/bin done
+	then $(pwd) done local 2>/dev/null "$@" sed /usr/bin | --verbose
+${HOME} printf awk printf grep done
+		test cd test done done local printf
+"$1" -eu 2>/dev/null then test ${HOME} printf readonly
+	&& --verbose awk | echo "$1" printf printf done "$@" awk
+	-eu --verbose | /usr/bin sed awk $(pwd) | printf
+		"$@" 'quoted text' readonly done export readonly printf
+	"$@" ${HOME} | awk && awk echo printf grep grep
+test export then echo 2>/dev/null readonly readonly x=1 grep && test $(pwd)
+	'quoted text' export export sed
+		/usr/bin 2>/dev/null | then awk 'quoted text'
+		grep -eu echo | local
+		/usr/bin "$1" ${HOME} sed export /usr/bin /usr/bin && done sed -eu sed
+		$(pwd) "$@" then test readonly echo
+awk readonly -eu awk | /usr/bin awk then echo export then -eu then
+		/usr/bin "$@" then cd
+	sed grep && export 'quoted text' -eu local "$@" -eu echo
+	test | export $(pwd) x=1 readonly test /usr/bin | x=1 grep grep done local local
+		-eu test printf cd awk -eu test
+--verbose && export grep "$1" &&
+test | printf then test
+	/usr/bin sed export done
+--verbose then awk $(pwd) ${HOME} | local $(pwd) -eu $(pwd) && sed
+		${HOME} x=1 echo echo $(pwd) printf
+	2>/dev/null cd -eu done local 'quoted text' --verbose awk
+		local x=1 2>/dev/null local export awk then
+		done /usr/bin && | test -eu done readonly
+	test readonly readonly export "$1" cd 'quoted text'
+cd sed ${HOME} printf | -eu
+		${HOME} $(pwd) test ${HOME}
+	${HOME} --verbose awk export && local && then --verbose
+$(pwd) 2>/dev/null -eu local --verbose ${HOME} echo test
+done cd $(pwd) $(pwd) ${HOME} 'quoted text' echo x=1 x=1
+	/usr/bin /usr/bin printf
+	done local grep $(pwd)
+-eu $(pwd) grep then awk 2>/dev/null
+	-eu cd $(pwd) ${HOME} local grep awk "$@" --verbose
+&& --verbose x=1 -eu export export sed x=1 sed export
+		export 2>/dev/null done | readonly sed "$1" $(pwd) cd $(pwd) done
+	grep x=1 test echo 'quoted text' $(pwd) "$@" $(pwd) --verbose
+	cd ${HOME} ${HOME} echo
+	grep /usr/bin export ${HOME} "$@" 'quoted text'
+		readonly --verbose && readonly
+		&& grep 2>/dev/null echo sed | echo && done sed
+	local sed 'quoted text' -eu --verbose
+readonly $(pwd) awk then readonly then echo && then grep |
+	local ${HOME} done -eu /usr/bin 2>/dev/null --verbose $(pwd)
+	&& then local $(pwd) "$@" --verbose && awk
+		echo done export export /usr/bin done x=1 'quoted text'
+		$(pwd) --verbose test 2>/dev/null --verbose x=1 | 2>/dev/null
+	--verbose 'quoted text' printf -eu -eu 2>/dev/null && ${HOME}
+	awk "$1" awk ${HOME} 'quoted text' ${HOME} 2>/dev/null
+		x=1 | "$1" -eu done "$1" "$@" -eu ${HOME} "$@" cd && cd | 2>/dev/null
+		'quoted text' 2>/dev/null /usr/bin cd /usr/bin -eu
+test /usr/bin && "$1" $(pwd) then $(pwd) cd
+		'quoted text' 2>/dev/null done test $(pwd) grep
+	'quoted text' printf
+echo then local -eu x=1 test cd | then "$@"
+| ${HOME} x=1 2>/dev/null readonly
+		| done $(pwd) test -eu sed | readonly && "$1"
+		awk -eu sed done -eu awk ${HOME} awk "$1" x=1
+$(pwd) printf 2>/dev/null readonly readonly $(pwd) awk 'quoted text' echo | cd 'quoted text'
+$(pwd) --verbose $(pwd)
+then test /usr/bin readonly --verbose /usr/bin 'quoted text' sed x=1
+	$(pwd) printf $(pwd) 'quoted text' x=1 $(pwd) printf
+&& export cd $(pwd) --verbose | -eu export x=1 "$@" $(pwd) done local local
+grep | | test x=1 x=1 export
+	local awk | 2>/dev/null ${HOME} local cd 2>/dev/null then test "$@" -eu echo
+&& local local then "$1" && $(pwd) "$@"
+	grep export sed | /usr/bin 'quoted text' -eu local local local "$@"
+'quoted text' local 'quoted text' ${HOME} local && 2>/dev/null /usr/bin
+		&& 2>/dev/null local $(pwd) | awk awk 2>/dev/null sed 2>/dev/null
+	"$1" then printf done local then awk cd test "$@" cd | test
+$(pwd) cd ${HOME} -eu ${HOME} "$@" done done 2>/dev/null printf echo
+export 2>/dev/null --verbose x=1 x=1 'quoted text'
+local printf && cd readonly
+	printf local --verbose echo && cd export ${HOME} grep
+| echo awk | readonly then printf x=1 /usr/bin && /usr/bin 2>/dev/null
+&& /usr/bin grep /usr/bin "$@" "$@" && done export test done "$1" /usr/bin $(pwd)
+	export "$1" | 2>/dev/null local
+	-eu then local then 'quoted text' echo 'quoted text' "$1" local done test x=1
+		export | && test ${HOME} x=1 "$@" "$@" --verbose 'quoted text'
+	test echo local x=1 --verbose && sed done then done readonly printf
+		'quoted text' "$@" test cd && --verbose readonly test --verbose
+		echo x=1 done --verbose -eu
+		sed grep cd -eu && readonly --verbose done 2>/dev/null
+		2>/dev/null cd x=1 'quoted text'
+		${HOME} x=1 ${HOME} local ${HOME} then /usr/bin 'quoted text'
+	then sed export sed $(pwd) local /usr/bin
+		&& printf $(pwd) --verbose export -eu then 'quoted text' && && $(pwd) cd 2>/dev/null
+-eu test x=1 "$1" export sed &&
+		grep readonly 'quoted text' $(pwd)
+printf then && sed grep x=1 ${HOME} 'quoted text'
+		printf export /usr/bin awk test x=1 local done sed awk "$1" "$@"
+sed test /usr/bin | local awk 'quoted text'
+		then export cd 'quoted text' cd export | done x=1 then
+	cd && local printf local test echo "$@" cd then "$1" -eu && grep 2>/dev/null
+		| local test 2>/dev/null ${HOME} printf ${HOME} done ${HOME} && "$1" x=1 $(pwd)
+	export printf && 'quoted text'
+	export ${HOME} sed -eu grep grep echo sed
+		-eu "$1" "$@" && && "$@" ${HOME} printf cd -eu ${HOME} printf
+readonly ${HOME} ${HOME} "$@" awk $(pwd) awk
+		--verbose local -eu ${HOME} /usr/bin $(pwd)
+		sed test "$@" "$1" --verbose "$@" "$@" && readonly printf
+&& 'quoted text' then done done ${HOME} "$1" readonly && printf /usr/bin
+x=1 local sed x=1 printf sed readonly /usr/bin x=1 && readonly
+		sed "$1" ${HOME} echo && done 2>/dev/null
+		'quoted text' "$1" 2>/dev/null
+	"$@" $(pwd) local then && echo export awk sed 2>/dev/null
+		${HOME} "$@" ${HOME} local ${HOME} -eu readonly x=1 &&
+readonly 'quoted text' --verbose "$@" printf local done
+	readonly readonly local "$1" ${HOME} test cd grep printf readonly local grep
+		--verbose echo readonly x=1 $(pwd) awk -eu readonly
+local --verbose grep 'quoted text'
+"$@" $(pwd) && grep -eu 'quoted text' grep printf
+readonly | then /usr/bin 2>/dev/null local grep -eu grep | /usr/bin
+2>/dev/null local --verbose
+export ${HOME} awk x=1 export | test /usr/bin
+		echo done /usr/bin local 2>/dev/null printf
+readonly echo "$1" done readonly awk printf printf sed done
+	"$@" cd /usr/bin ${HOME} grep ${HOME}
+		then | ${HOME} $(pwd) && ${HOME} printf /usr/bin
+--verbose /usr/bin awk && echo echo /usr/bin "$@" "$1" cd readonly --verbose
+	/usr/bin --verbose cd printf && 2>/dev/null && 'quoted text'
+		-eu ${HOME} && ${HOME} cd 2>/dev/null readonly ${HOME}
+${HOME} cd "$1" printf | cd x=1 awk --verbose
+		test -eu | done then sed /usr/bin
+		2>/dev/null printf cd $(pwd) readonly done -eu /usr/bin "$1" sed | test done
+		&& && "$1" $(pwd) echo 2>/dev/null
+	$(pwd) done x=1 -eu local x=1 ${HOME}
+	--verbose export cd 2>/dev/null
+	| x=1 awk printf && -eu -eu &&
+"$@" $(pwd) x=1 then export then $(pwd) printf then x=1
+echo test --verbose awk 'quoted text' printf done export x=1 $(pwd) echo
+		"$1" done test "$@" then --verbose "$@"
+		x=1 && cd test 2>/dev/null then ${HOME} awk x=1 -eu test then echo
+"$1" done printf printf | -eu cd x=1 cd /usr/bin done
+		awk local 2>/dev/null cd readonly -eu "$@" local test $(pwd) ${HOME}
+		done | done "$@" local then
+	printf ${HOME} -eu test "$@" 2>/dev/null echo
+		test printf export ${HOME}
+"$1" $(pwd) echo ${HOME}
+	"$@" awk printf $(pwd) readonly
+	export 2>/dev/null "$@"
+	readonly --verbose awk printf $(pwd) x=1 grep export
+	awk "$1" done -eu done done ${HOME} test
+"$1" "$@" -eu x=1 local printf
+	${HOME} printf /usr/bin then -eu "$1"
+		printf readonly && 2>/dev/null --verbose
+	echo 'quoted text' /usr/bin local -eu
+'quoted text' local cd local 'quoted text' | echo "$@" x=1
+		grep awk "$1" test test printf local sed
+	&& "$1" then sed export "$1"
+		echo -eu ${HOME} awk /usr/bin "$@" done /usr/bin $(pwd) cd --verbose
+		-eu | /usr/bin ${HOME}
+	2>/dev/null ${HOME} x=1 local $(pwd) && echo awk "$1" echo local "$@" done
+		sed 2>/dev/null x=1 cd && then then --verbose
+		done then x=1 -eu local local export grep x=1 sed
+		test readonly 'quoted text' local "$1" $(pwd) sed
+	export local grep test readonly 2>/dev/null test --verbose ${HOME}
+	${HOME} ${HOME} ${HOME} grep local local ${HOME} $(pwd) echo then --verbose
+		$(pwd) 'quoted text' test x=1 "$1" export x=1 then printf
+done grep awk test "$1" 2>/dev/null 2>/dev/null
+	export then then "$1" cd test printf x=1 2>/dev/null 2>/dev/null | ${HOME}
+"$@" 'quoted text' 'quoted text' /usr/bin test cd printf local printf
+echo sed /usr/bin 'quoted text' ${HOME} printf then export -eu && 'quoted text'
+	"$1" awk local $(pwd) printf
+done 2>/dev/null printf test 2>/dev/null sed 'quoted text'
+then x=1 $(pwd) x=1 awk $(pwd) | grep && | then ${HOME} printf
+	-eu | "$1" ${HOME} sed -eu local 2>/dev/null 2>/dev/null &&
+		cd export 2>/dev/null 2>/dev/null $(pwd) printf
+	done | ${HOME} cd "$@" --verbose /usr/bin 'quoted text'
+echo local --verbose -eu "$@" readonly && sed awk "$1" &&
+	cd echo "$1" echo readonly export "$1" readonly | --verbose && $(pwd) cd
+&& local printf printf $(pwd) 2>/dev/null --verbose "$1" echo test sed
+	2>/dev/null sed export ${HOME}
+'quoted text' x=1 --verbose awk cd grep --verbose && printf export
+	| done grep | $(pwd) awk cd sed "$1" local -eu export
+		/usr/bin --verbose 'quoted text' export "$1" then --verbose "$@"
+	sed local ${HOME} cd test -eu grep test $(pwd) awk &&
+		&& test export /usr/bin export echo && local cd test awk x=1 printf "$@"
+	grep done x=1 'quoted text' grep $(pwd)
+	--verbose -eu 2>/dev/null local readonly sed sed
+		then grep grep "$@" printf && "$@" export && readonly /usr/bin 'quoted text'
+		| -eu && printf done "$1" printf 2>/dev/null --verbose && echo then local && 2>/dev/null
+		"$1" 'quoted text' | 'quoted text' && --verbose echo export echo
+echo export x=1 'quoted text'
+done x=1 printf printf | cd local
+awk -eu ${HOME} cd grep --verbose 'quoted text' | --verbose
+"$@" -eu 2>/dev/null cd "$1" ${HOME} readonly 'quoted text' awk -eu
+	echo $(pwd) --verbose "$@" $(pwd) grep
+x=1 printf sed sed then export done | --verbose "$@" readonly
+	| --verbose printf echo /usr/bin export "$1" "$1" 'quoted text' "$@" 2>/dev/null
+	export echo x=1 && awk cd $(pwd) /usr/bin export x=1 export then awk --verbose
+		/usr/bin | -eu export grep then echo readonly local x=1 ${HOME}
+		| $(pwd) | local --verbose cd "$@" readonly export echo local test readonly printf
+		echo echo then then echo readonly then "$@" "$@" then done awk
+then done awk done done readonly $(pwd) then 'quoted text'
+		2>/dev/null then echo then 'quoted text' cd --verbose x=1 |
+	test | "$@" && export printf awk 2>/dev/null 2>/dev/null -eu readonly
+	x=1 echo /usr/bin /usr/bin | && cd $(pwd) printf ${HOME} --verbose
+	then && && local $(pwd) "$1" grep ${HOME} sed local cd echo done
+cd done printf "$@" && "$1" x=1 sed test echo x=1 grep 'quoted text'
+		&& cd cd && echo "$@" $(pwd) printf export x=1 | export | grep then
+	"$@" local 'quoted text' 2>/dev/null sed test then $(pwd) printf
+	readonly 2>/dev/null $(pwd) "$@" done export
+	$(pwd) cd echo 2>/dev/null done "$@" then
+		"$@" x=1 2>/dev/null /usr/bin then /usr/bin test x=1 printf /usr/bin
+	"$1" printf done sed echo awk test x=1 --verbose sed && local test
+	export && ${HOME} /usr/bin /usr/bin
+		$(pwd) x=1 "$@" then && then "$@" sed sed done -eu 'quoted text'
+	| printf then readonly 'quoted text' local sed | -eu "$1" local -eu
+		$(pwd) grep -eu export test sed sed 'quoted text' --verbose
+	&& awk "$@" x=1 printf cd then "$1" echo 'quoted text' export export then grep
+echo printf local --verbose &&
+	grep -eu ${HOME} export 2>/dev/null $(pwd) "$1" readonly --verbose
+		2>/dev/null readonly grep readonly
+	cd cd sed 2>/dev/null && grep test echo awk | "$@" readonly 'quoted text'
+"$1" done /usr/bin 2>/dev/null -eu then export
+		/usr/bin grep echo 'quoted text' 'quoted text' cd "$@" "$@"
+		-eu -eu echo | local grep local readonly -eu /usr/bin
+awk then x=1 && export --verbose
+		local "$1" done done "$1" x=1 test local sed |
+2>/dev/null done $(pwd) && echo then cd test done /usr/bin
+local local cd awk grep printf 2>/dev/null test
+export cd && x=1 cd 2>/dev/null ${HOME} ${HOME} awk /usr/bin x=1
+2>/dev/null sed "$@" --verbose sed then ${HOME}
+		readonly /usr/bin x=1 then x=1 "$1" awk
+	done /usr/bin ${HOME} ${HOME} local then grep
+	${HOME} then && $(pwd) sed 2>/dev/null && grep printf "$@"
+	x=1 echo grep --verbose export then "$1" -eu /usr/bin ${HOME}
+x=1 grep then echo 2>/dev/null --verbose cd ${HOME} printf ${HOME} done
+	local "$@" sed -eu done local sed ${HOME} cd
+${HOME} awk /usr/bin cd test
+awk grep then && cd printf awk --verbose export cd 2>/dev/null && local test x=1
+	"$@" 'quoted text' sed export done readonly "$@" --verbose
+local local -eu echo done then printf echo -eu readonly $(pwd)
+2>/dev/null ${HOME} cd --verbose then 'quoted text' awk 2>/dev/null then readonly
+"$@" grep export then then -eu cd ${HOME} local cd 'quoted text' sed
+	2>/dev/null x=1 2>/dev/null && --verbose ${HOME} x=1 "$1" /usr/bin "$@" 'quoted text'
+		printf then export && then export
+readonly cd then 'quoted text' sed && echo /usr/bin &&
+		printf /usr/bin /usr/bin cd "$@" awk && awk 2>/dev/null 2>/dev/null
+	$(pwd) echo /usr/bin /usr/bin ${HOME} export ${HOME}
+		then local "$1" 'quoted text'
+	2>/dev/null grep $(pwd) -eu done --verbose
+		printf "$1" readonly echo sed
+		cd --verbose 'quoted text' x=1 then test sed -eu cd done
+		${HOME} $(pwd) printf grep "$1" readonly sed 'quoted text' awk ${HOME} | --verbose
+		done then export printf &&
+	${HOME} /usr/bin "$1" $(pwd) sed $(pwd) "$@" /usr/bin done test readonly
+		x=1 ${HOME} test echo printf export | done printf
+		cd then 'quoted text' 'quoted text' 2>/dev/null 2>/dev/null &&
+		then x=1 test awk "$@" then | && -eu printf 'quoted text' readonly "$1"
+	| && export $(pwd) ${HOME} printf
+done ${HOME} ${HOME} --verbose
+	"$1" then -eu && test awk "$@"
+	"$@" local then done test grep
+		export local "$1" -eu --verbose $(pwd) x=1 "$1" -eu "$1"
+'quoted text' printf done /usr/bin && 'quoted text' awk done "$@" $(pwd) local
+cd "$@" $(pwd) -eu /usr/bin "$@" readonly local 2>/dev/null grep $(pwd)
+	printf printf awk cd done 2>/dev/null then cd --verbose
+		&& sed then echo 'quoted text' ${HOME} 'quoted text' test cd grep awk
+readonly test | -eu "$1" printf "$@" "$1" awk printf done
+		readonly grep ${HOME} 2>/dev/null --verbose test grep awk readonly done
+		done x=1 $(pwd) 'quoted text' export | printf 'quoted text'
+		2>/dev/null ${HOME} && && -eu
+		export awk "$@" grep awk sed "$1" -eu "$1" ${HOME} awk echo sed grep
+		$(pwd) cd cd --verbose "$1" 2>/dev/null
+-eu x=1 ${HOME} x=1 --verbose
+	export 2>/dev/null 2>/dev/null x=1 done export -eu export "$1" printf local
+2>/dev/null 2>/dev/null echo
+	--verbose local ${HOME} then && -eu
+grep printf x=1 grep sed 'quoted text' ${HOME} $(pwd) sed $(pwd) export
+	-eu | 'quoted text' echo cd then x=1 then "$@"
+	printf done awk then test 'quoted text' "$1" local grep grep
+		| | cd readonly readonly "$1"
+-eu awk "$1" ${HOME} sed | --verbose echo export printf echo grep $(pwd) cd --verbose
+	local cd | local | /usr/bin test
+done awk && readonly awk
+		awk done test /usr/bin "$@" | ${HOME} | local "$1" then awk /usr/bin printf test
+test test cd done "$@" awk "$@" printf 'quoted text' "$@" &&
+		local 'quoted text' local 2>/dev/null
+test then | printf "$@" done && && echo sed export sed "$1" export 2>/dev/null
+done awk "$@" --verbose
+	done cd "$@" x=1 x=1 export
+		awk export x=1 && | $(pwd) "$1" printf grep done /usr/bin "$@" -eu
+		'quoted text' grep local
+	test echo | "$@" "$1" awk test ${HOME} local local local readonly echo
+	$(pwd) then "$1" local cd test "$1" sed awk echo /usr/bin 'quoted text'
+local test && ${HOME} export 2>/dev/null x=1 done
+		-eu $(pwd) 2>/dev/null echo sed echo "$1" awk 'quoted text'
+	| -eu /usr/bin local 'quoted text' sed awk export x=1 sed x=1 x=1 test done
+'quoted text' done echo export "$1" -eu then
+	| then && "$1" echo then -eu 2>/dev/null
+		"$@" "$@" sed --verbose export "$@" | 2>/dev/null
+x=1 --verbose x=1 ${HOME} "$1" "$@" cd --verbose
+		sed cd $(pwd) --verbose 2>/dev/null $(pwd) "$@" "$1" export then sed echo && test
+awk && && 2>/dev/null echo --verbose | local | /usr/bin
+		'quoted text' /usr/bin 'quoted text' 'quoted text'
+		done awk export ${HOME} ${HOME} local done cd "$1" local && local
+	"$@" | export --verbose sed -eu ${HOME} grep grep /usr/bin
+	&& cd $(pwd) "$@" awk awk 2>/dev/null done awk then local awk 'quoted text'
+	local printf then readonly awk awk --verbose
+readonly local | sed --verbose | && "$1" 2>/dev/null then x=1 $(pwd)
+	--verbose sed -eu $(pwd) -eu 2>/dev/null
+		export done 'quoted text' then $(pwd) && --verbose | cd 'quoted text' /usr/bin
+	then && $(pwd) readonly ${HOME} sed export echo x=1 cd 'quoted text' sed test
+		awk echo readonly -eu "$1" 2>/dev/null 'quoted text' readonly --verbose
+then test test ${HOME} 2>/dev/null printf $(pwd) grep awk /usr/bin grep
+		done $(pwd) 2>/dev/null /usr/bin sed x=1 "$@" test $(pwd) | && --verbose
+		printf local x=1 echo test echo test cd local grep done printf 'quoted text'
+	-eu sed test grep cd cd awk echo
+		readonly readonly done grep --verbose --verbose -eu --verbose | 2>/dev/null
+		local x=1 echo test grep readonly
+--verbose | echo local export done readonly echo then -eu /usr/bin sed readonly
+		printf 2>/dev/null echo then done ${HOME} grep
+	'quoted text' "$@" awk grep local local then $(pwd) grep local readonly ${HOME}
+	local 'quoted text' x=1 $(pwd) /usr/bin && --verbose ${HOME}
+		grep echo && done $(pwd) x=1 sed 'quoted text'
+"$@" && local grep echo then
+cd test export grep | $(pwd) sed "$@" --verbose done sed $(pwd) grep
+cd readonly /usr/bin awk echo "$1" ${HOME} done x=1 local sed sed echo
+'quoted text' cd | echo test
+	readonly x=1 sed echo -eu "$1" echo export $(pwd) | printf
+	awk $(pwd) readonly "$@" | test sed printf
+		/usr/bin "$1" $(pwd) /usr/bin sed 2>/dev/null done cd cd cd && test 'quoted text'
+		readonly local $(pwd) -eu grep
+${HOME} ${HOME} sed 2>/dev/null awk "$1" grep done 'quoted text' echo |
+	sed readonly "$@" grep --verbose --verbose echo readonly
+		&& ${HOME} | /usr/bin 'quoted text' printf sed sed
+		"$@" $(pwd) readonly printf && $(pwd) x=1 sed printf
+	sed then awk cd echo done $(pwd)
+		--verbose $(pwd) echo export grep printf
+$(pwd) awk $(pwd) "$@" --verbose 'quoted text' echo awk grep "$1" --verbose
+		readonly echo done -eu 'quoted text' export grep -eu x=1 -eu grep
+	--verbose sed x=1 -eu done $(pwd) test $(pwd) cd local
+	echo export awk readonly local done local
+| then -eu "$1" export 2>/dev/null 'quoted text' cd x=1
+		-eu grep x=1 printf --verbose
+		readonly cd sed 'quoted text' then
+	/usr/bin $(pwd) /usr/bin
+	local test && && 'quoted text' grep /usr/bin cd test test cd grep
+readonly 2>/dev/null x=1
+	-eu x=1 local printf readonly && x=1 sed grep grep done -eu
+	'quoted text' printf local readonly 2>/dev/null echo $(pwd) /usr/bin printf
+x=1 -eu /usr/bin $(pwd) "$1" 2>/dev/null local done readonly 'quoted text'
+	2>/dev/null "$@" cd /usr/bin
+		/usr/bin done done echo /usr/bin cd "$@" then awk echo $(pwd) export ${HOME}
+	-eu "$1" --verbose "$@" "$@" "$1" "$1" test
+'quoted text' readonly
+		local echo sed "$1" "$@" | export
+		/usr/bin done grep grep
+	grep awk grep printf cd test sed 2>/dev/null | x=1 && then sed grep printf
+printf ${HOME} 'quoted text' /usr/bin local printf /usr/bin && local
+	sed "$@" 'quoted text' echo --verbose
+	2>/dev/null /usr/bin echo 2>/dev/null
+		$(pwd) ${HOME} done printf | | local grep | ${HOME}
+		'quoted text' | printf awk ${HOME} | $(pwd) grep "$1" local
+2>/dev/null -eu printf done && | sed cd local readonly
+		"$1" local "$1" done | awk awk "$1"
+	grep && "$1" echo awk -eu | x=1 done 2>/dev/null
+		"$1" cd local ${HOME} grep then
+		done sed -eu test -eu && test awk echo 'quoted text' printf sed /usr/bin |
+	then printf /usr/bin cd printf done echo cd | grep "$1" ${HOME}
+| $(pwd) -eu awk -eu "$@" 2>/dev/null x=1 local 2>/dev/null
+		awk "$1" "$@" --verbose grep test -eu then readonly
+		printf echo ${HOME} $(pwd) printf
+readonly readonly "$1" cd export awk /usr/bin $(pwd) export x=1
+		/usr/bin x=1 && done "$@" grep --verbose /usr/bin 2>/dev/null x=1
+		'quoted text' "$1" x=1 -eu /usr/bin export "$1" cd cd "$1" grep 'quoted text'
+		cd printf ${HOME} && ${HOME} ${HOME}
+	sed --verbose | done "$1" test readonly "$1" sed && sed $(pwd)
+		${HOME} x=1 2>/dev/null export "$1" printf grep readonly
+	echo awk done awk | 2>/dev/null
+	2>/dev/null 'quoted text' readonly
+	&& grep printf test x=1 x=1 --verbose "$@"
+	"$1" "$1" done "$@" | local
+	grep "$@" grep $(pwd) cd /usr/bin 'quoted text' -eu -eu awk
+		&& -eu test test then test
+		2>/dev/null done test 2>/dev/null 2>/dev/null test "$1" /usr/bin --verbose /usr/bin
+2>/dev/null echo done x=1 cd echo printf --verbose
+		awk -eu then done "$1" ${HOME} grep awk grep grep cd /usr/bin
+		grep printf printf ${HOME} readonly printf
+		&& then 'quoted text' readonly echo cd ${HOME} local $(pwd)
+		$(pwd) printf echo 'quoted text'
+	printf readonly grep test 'quoted text' test /usr/bin /usr/bin
+sed test "$1" readonly && $(pwd) /usr/bin printf --verbose
+local 'quoted text' --verbose ${HOME} test x=1
+	$(pwd) && echo test done /usr/bin grep sed /usr/bin sed "$1" local export &&
+&& local echo readonly grep ${HOME} echo done
+		local printf 'quoted text' printf ${HOME} test done | sed --verbose "$1"
+	${HOME} "$@" 2>/dev/null readonly 'quoted text'
+		done /usr/bin "$1" && echo export export cd
+/usr/bin echo "$1" ${HOME} cd local readonly | | printf sed "$1" local
+		awk | printf && -eu 'quoted text' cd sed &&
+		--verbose then "$@" | export 2>/dev/null && readonly echo printf cd
+	printf awk "$@" /usr/bin readonly "$@" cd
+	cd grep printf | ${HOME} 2>/dev/null echo awk local "$@"
+		'quoted text' --verbose local 2>/dev/null sed echo
+/usr/bin echo 'quoted text' -eu 2>/dev/null 'quoted text' && then
+	'quoted text' --verbose echo export test readonly -eu awk local
+	| x=1 $(pwd) x=1 | done echo $(pwd) "$@" "$1" --verbose -eu ${HOME}
+		export && test ${HOME} done 'quoted text' test ${HOME} awk local | then
+		done $(pwd) "$@" sed grep $(pwd) readonly "$1" "$@"
+		export ${HOME} sed sed readonly $(pwd) --verbose -eu done 'quoted text'
+awk test --verbose /usr/bin x=1
+	'quoted text' then | then printf /usr/bin $(pwd) local export 'quoted text'
+export | done "$1" cd awk test cd "$1" x=1 cd then "$@" then "$1"
+		-eu awk --verbose $(pwd) grep echo "$@" "$@" "$1"
+		then echo test echo 2>/dev/null grep echo echo awk
+		/usr/bin --verbose "$1" $(pwd) ${HOME} awk local
+	sed printf /usr/bin grep awk --verbose |
+		-eu 2>/dev/null grep export --verbose test test readonly
+printf | 'quoted text'
+${HOME} printf -eu printf grep ${HOME} 2>/dev/null
+	sed local $(pwd) | test echo done /usr/bin && $(pwd)
+local --verbose test $(pwd) 2>/dev/null then ${HOME} done then local "$@"
+		'quoted text' awk sed test | "$@" echo
+		local printf then /usr/bin
+	done then sed && | cd 'quoted text' sed && local --verbose cd 'quoted text' sed
+test grep --verbose done local 2>/dev/null
+		cd cd awk --verbose awk echo test cd printf cd /usr/bin
+	test | "$@" && x=1 2>/dev/null
+&& && --verbose echo 'quoted text' -eu --verbose export cd /usr/bin
+	$(pwd) "$1" -eu local "$1" sed -eu ${HOME} -eu echo done /usr/bin && test export
+	local then /usr/bin test x=1 2>/dev/null export local 2>/dev/null "$@"
+test ${HOME} cd 2>/dev/null awk --verbose cd "$1" "$1" $(pwd)
+'quoted text' local && then /usr/bin readonly awk echo
+		'quoted text' local local $(pwd) -eu done "$1"
+"$1" -eu /usr/bin awk -eu printf test "$@" | grep local awk then
+		$(pwd) done $(pwd) 2>/dev/null /usr/bin
+sed readonly --verbose local echo "$1" sed grep -eu && printf
+cd 'quoted text' printf then export local 2>/dev/null "$1"
+		$(pwd) "$1" grep -eu 'quoted text' 'quoted text' /usr/bin
+		awk awk 2>/dev/null $(pwd) test 2>/dev/null 2>/dev/null
+	sed test ${HOME} "$1" echo "$1" -eu export 'quoted text'
+		awk export 'quoted text' --verbose
+	/usr/bin "$@" 'quoted text' 2>/dev/null sed sed ${HOME} x=1
+2>/dev/null then sed export echo sed echo /usr/bin
+		/usr/bin 'quoted text' done done $(pwd) -eu x=1 cd cd
+		cd cd "$@" 2>/dev/null "$1" -eu /usr/bin x=1 printf then
+	test test | grep 'quoted text' --verbose ${HOME} cd ${HOME} readonly cd
+$(pwd) then cd 2>/dev/null -eu 2>/dev/null
+		--verbose "$1" cd export && grep x=1
+printf done export printf awk /usr/bin $(pwd) x=1 then awk x=1 $(pwd)
+| x=1 && export test awk --verbose awk $(pwd) grep 2>/dev/null grep
+	test done grep && grep 'quoted text' local export test "$@" echo local
+--verbose test 2>/dev/null -eu ${HOME}
+	2>/dev/null local "$1" printf grep then local
+| && "$1" 2>/dev/null "$1" export | test grep local cd "$1" 'quoted text'
+	local ${HOME} printf export printf | /usr/bin
+		${HOME} cd && ${HOME} local "$@" printf 'quoted text' awk readonly
+| -eu 2>/dev/null x=1 ${HOME} done | --verbose export then cd then grep cd x=1
+		"$1" sed cd test printf printf readonly sed export
+		'quoted text' /usr/bin cd readonly
+	readonly printf test done -eu $(pwd) 2>/dev/null
+		then --verbose export ${HOME} "$1" echo x=1 test 2>/dev/null 'quoted text'
+	'quoted text' --verbose 'quoted text' readonly 2>/dev/null
+local && $(pwd) printf sed local "$1" && sed
+	${HOME} export printf cd readonly 'quoted text' test cd | "$@" 2>/dev/null
+/usr/bin export sed && $(pwd) "$1" readonly awk | 2>/dev/null -eu readonly
+		| grep /usr/bin x=1 awk echo readonly
+	printf | then "$@" /usr/bin "$@" --verbose
+		echo 'quoted text' ${HOME} $(pwd) /usr/bin echo | --verbose echo
+		'quoted text' | x=1 printf
+		awk done ${HOME} | | local 'quoted text' cd $(pwd) $(pwd) test
+	"$@" --verbose test && $(pwd) test
+	local ${HOME} "$@" /usr/bin ${HOME}
+	${HOME} -eu ${HOME} /usr/bin then sed $(pwd) echo 'quoted text' grep
+	printf grep readonly readonly && "$@" 'quoted text' grep -eu echo "$@" /usr/bin
+		grep "$1" ${HOME} /usr/bin -eu --verbose
+	&& /usr/bin done grep test /usr/bin "$1" done $(pwd) | local
+-eu -eu --verbose printf test export 2>/dev/null
+	x=1 ${HOME} readonly cd export
+then export && /usr/bin cd awk /usr/bin $(pwd) 'quoted text'
+	grep /usr/bin "$1" local "$@" | | local
+		"$1" grep awk then ${HOME} printf local /usr/bin
+cd -eu "$1" local export $(pwd) /usr/bin readonly export ${HOME}
+		printf 2>/dev/null $(pwd) "$@" -eu /usr/bin "$@"
+	"$1" | | /usr/bin && grep $(pwd) readonly --verbose
+	done 2>/dev/null awk "$@" grep 2>/dev/null "$@" x=1
+		then done then printf --verbose printf then | export cd -eu
+		export ${HOME} 'quoted text' /usr/bin sed echo sed test /usr/bin readonly printf
+		"$1" --verbose echo readonly --verbose
+	--verbose "$@" echo sed local && 'quoted text' ${HOME}
+awk 'quoted text' 'quoted text' local --verbose
+	echo "$1" && 2>/dev/null then x=1
+	cd "$1" 2>/dev/null test sed /usr/bin -eu printf done "$@" x=1 readonly printf
+	echo printf | echo cd "$1" grep readonly /usr/bin ${HOME} grep --verbose readonly
+	test grep ${HOME} 2>/dev/null sed 2>/dev/null
+		"$1" "$@" "$1" 'quoted text' -eu local -eu
+	grep printf export sed sed cd grep && printf
+	cd sed /usr/bin sed x=1 /usr/bin x=1 ${HOME} awk 2>/dev/null done
+readonly export /usr/bin cd 2>/dev/null printf
+	export sed grep | test done "$@" cd local
+echo --verbose sed then $(pwd) test test ${HOME}
+	$(pwd) | /usr/bin readonly grep done ${HOME} done echo -eu /usr/bin
+	"$@" "$1" echo 2>/dev/null sed $(pwd) sed
+echo local $(pwd) &&
+		--verbose $(pwd) -eu
+		-eu $(pwd) "$1" awk grep
+		printf | ${HOME} 2>/dev/null awk export
+	-eu echo awk local ${HOME} echo cd sed /usr/bin ${HOME} printf 'quoted text'
+	done "$1" export done "$@" then /usr/bin
+		grep "$@" awk sed then | printf test export cd
+${HOME} cd test cd done /usr/bin --verbose $(pwd) export $(pwd)
+	${HOME} echo test -eu $(pwd) --verbose cd 2>/dev/null
+		printf awk x=1 printf printf cd then test grep sed "$@" "$@" 'quoted text'
+	printf ${HOME} /usr/bin echo then "$@" /usr/bin "$1" x=1 local ${HOME}
+export grep printf readonly $(pwd) | printf test grep awk awk "$@" grep 'quoted text'
+	cd | --verbose printf echo grep awk
+		export | | 'quoted text' | sed "$1" "$@" ${HOME} readonly
+local echo test echo 2>/dev/null
+		${HOME} 'quoted text' -eu x=1 local $(pwd) --verbose x=1 'quoted text'
+	'quoted text' export printf readonly -eu ${HOME} local
+	local readonly sed | && test sed "$@" 'quoted text' | ${HOME}
+		done $(pwd) && --verbose
+		/usr/bin readonly readonly sed
+		"$@" x=1 "$1" grep test ${HOME} grep ${HOME}
+	$(pwd) export awk --verbose awk | 'quoted text' readonly echo -eu "$1"
+awk test x=1 --verbose --verbose echo "$1" $(pwd) 2>/dev/null echo printf
+"$@" && test ${HOME} /usr/bin "$1" grep 2>/dev/null local then /usr/bin
+	sed done echo echo echo then awk --verbose
+test 'quoted text' cd --verbose test printf awk readonly grep | $(pwd)
+	awk 'quoted text' && cd printf printf -eu echo printf
+done cd sed && test --verbose $(pwd) test | printf "$@" export
+	test 2>/dev/null && | done grep cd local
+	printf && cd "$1" && sed cd local
+	x=1 echo printf readonly then
+test $(pwd) test then
+	2>/dev/null 2>/dev/null printf export 'quoted text' | echo $(pwd) $(pwd) x=1
+		2>/dev/null local $(pwd) 2>/dev/null ${HOME}
+echo cd | 2>/dev/null "$@" | x=1 /usr/bin
+		x=1 done echo "$@" "$@" "$1" export local sed then readonly 2>/dev/null
+	2>/dev/null sed readonly x=1 && x=1 'quoted text'
+		cd | sed local -eu cd --verbose done done sed test "$1" | x=1 readonly "$1"
+		${HOME} printf test grep "$@" export echo readonly
+		"$@" readonly cd cd export cd 2>/dev/null
+readonly /usr/bin done "$1" readonly readonly awk
+		--verbose ${HOME} | cd "$1" then cd --verbose test "$1" sed awk sed awk /usr/bin
+'quoted text' local local
+		-eu export --verbose --verbose sed 'quoted text'
+		then && local /usr/bin -eu local --verbose
+	--verbose ${HOME} x=1 | -eu && -eu
+		cd echo done done --verbose --verbose
+echo -eu awk $(pwd) sed test 2>/dev/null | --verbose $(pwd) export readonly
+		echo done readonly --verbose -eu | cd && test cd
+		"$@" | 2>/dev/null /usr/bin
+		awk grep "$1" x=1 && grep
+	readonly awk printf "$@" done 'quoted text'
+		"$1" awk readonly "$1" cd grep --verbose $(pwd) sed && echo
+		grep printf 'quoted text' "$@" "$@" -eu | ${HOME} x=1 && readonly
+	grep --verbose awk printf printf
+	then /usr/bin 'quoted text' cd test $(pwd)
+| && cd cd 2>/dev/null $(pwd) && ${HOME} 2>/dev/null then 'quoted text'
+		export $(pwd) ${HOME} local ${HOME}
+	grep test ${HOME} x=1 readonly
+	/usr/bin /usr/bin done local
+$(pwd) local x=1 readonly 2>/dev/null printf &&
+/usr/bin readonly awk grep "$1" ${HOME} ${HOME} awk then local test
+${HOME} then | 'quoted text' -eu test
+	printf 2>/dev/null cd cd export grep ${HOME}
+		cd cd export && cd readonly readonly readonly $(pwd) then 2>/dev/null done
+	/usr/bin "$@" then --verbose
+		"$@" test "$@" printf -eu export grep awk grep x=1 x=1 x=1 "$1" "$1"
+	cd -eu x=1 grep ${HOME} 'quoted text' awk grep | sed /usr/bin then
+awk readonly /usr/bin export -eu
+	$(pwd) 'quoted text' sed ${HOME} $(pwd) cd $(pwd) x=1 'quoted text' /usr/bin
+$(pwd) /usr/bin grep $(pwd) /usr/bin
+	--verbose printf test --verbose | | /usr/bin
+		grep echo /usr/bin printf /usr/bin
+		sed 'quoted text' grep
+		test echo | done --verbose
+		then && "$@" test then
+| "$1" | -eu -eu awk | -eu export "$@"
+		--verbose | 2>/dev/null -eu
+	"$1" --verbose test | | local
+local -eu $(pwd) $(pwd)
+	--verbose --verbose readonly 2>/dev/null && echo local -eu /usr/bin
+		-eu -eu x=1 x=1 -eu x=1 echo --verbose
+$(pwd) readonly /usr/bin printf grep local "$1" cd "$@" /usr/bin done
+		/usr/bin printf awk && test
+local awk awk $(pwd) done local test -eu ${HOME} /usr/bin ${HOME} "$@" 'quoted text'
+&& test "$@" 2>/dev/null | && local --verbose then -eu && printf
+/usr/bin local && sed export x=1 'quoted text'
+sed && && -eu --verbose local printf
+		| | local -eu --verbose "$@" then ${HOME} x=1 /usr/bin grep then | done && echo
+	export done /usr/bin
+	sed 'quoted text' 2>/dev/null
+		awk --verbose "$1" cd cd test echo /usr/bin
+	sed | then ${HOME} $(pwd) sed grep
+	test /usr/bin grep cd -eu test grep
+	&& sed --verbose "$1" export
+	done /usr/bin printf readonly ${HOME} readonly
+cd cd echo readonly printf grep then 2>/dev/null "$1"
+	sed 'quoted text' grep export awk sed export local
+	&& grep "$@" test local test $(pwd) 'quoted text'
+	test export "$@" test -eu 'quoted text' | --verbose export export | "$1" && export
+	${HOME} && && local printf ${HOME} cd --verbose sed readonly
+	echo -eu printf awk "$@" $(pwd)
+		'quoted text' then x=1 'quoted text' readonly | export
+/usr/bin cd "$1" export "$@" 2>/dev/null
+		echo | then echo $(pwd) printf /usr/bin
+		sed printf --verbose 'quoted text'
+		/usr/bin 2>/dev/null "$@" then
+	"$@" awk 'quoted text' then "$1" "$1" awk | $(pwd) --verbose
+		echo test test echo test -eu sed readonly $(pwd) ${HOME} export
+		then readonly "$@" sed sed
+"$@" 2>/dev/null then then local local -eu 'quoted text' awk $(pwd)
+	${HOME} | sed -eu && echo 2>/dev/null
+		| readonly cd "$1" readonly "$1"
+		cd awk ${HOME} echo ${HOME} then grep printf
+cd 2>/dev/null local then ${HOME} --verbose -eu
+		local 2>/dev/null awk "$@" local
+printf then test readonly && 2>/dev/null test grep -eu
+		echo && "$1" "$1" -eu /usr/bin
+		x=1 2>/dev/null done && test --verbose grep cd readonly $(pwd)
+2>/dev/null local | /usr/bin && readonly test sed --verbose
+		2>/dev/null grep cd $(pwd) 'quoted text' readonly done test echo
+/usr/bin awk /usr/bin "$@" test | local
+printf 'quoted text' "$1" local "$@" -eu /usr/bin
+	x=1 cd printf sed awk x=1 then readonly -eu x=1 then "$1" /usr/bin 2>/dev/null
+	&& ${HOME} ${HOME} "$1" ${HOME} grep "$1" && ${HOME} && ${HOME}
+	-eu then "$@" local readonly echo x=1
+		x=1 sed "$@" grep ${HOME} export
+then ${HOME} x=1 ${HOME} then --verbose grep
+		2>/dev/null 2>/dev/null done ${HOME}
+		| --verbose echo "$@" export "$1" "$@" /usr/bin
+		/usr/bin export | grep ${HOME} sed then 2>/dev/null awk echo "$@" $(pwd)
+awk test sed && $(pwd) "$@"
+	readonly 2>/dev/null 2>/dev/null awk && awk /usr/bin
+		-eu export done sed printf printf echo $(pwd) && grep -eu x=1 'quoted text'
+		cd x=1 cd printf "$1" cd --verbose "$1" echo cd
+	export 2>/dev/null awk "$1" | echo ${HOME}
+	"$@" -eu readonly -eu "$1" export grep 2>/dev/null
+	-eu --verbose grep "$1" "$@" 2>/dev/null echo then cd printf grep | awk echo grep
+		2>/dev/null local 2>/dev/null grep awk "$1" ${HOME} done 'quoted text' $(pwd)
+export "$@" grep local grep x=1 awk && done readonly export 2>/dev/null printf
+	x=1 --verbose /usr/bin test --verbose | sed sed grep 'quoted text' $(pwd)
+	grep awk ${HOME} grep then ${HOME} readonly grep grep
+		printf -eu -eu --verbose awk
+		export export cd readonly grep | x=1 awk local done
+cd done --verbose --verbose done "$@"
+| -eu -eu printf printf grep
+	2>/dev/null awk test echo printf awk "$@" --verbose
+	export "$1" | sed sed readonly 'quoted text'
+	sed ${HOME} --verbose then export cd "$1" test test test 'quoted text' readonly
+	-eu then echo done sed grep --verbose x=1 grep then cd cd cd 'quoted text' 2>/dev/null
+	2>/dev/null test test done
+	"$1" --verbose echo awk $(pwd) cd printf readonly "$@" export
+'quoted text' 2>/dev/null "$1" $(pwd) grep cd --verbose ${HOME} awk "$1"
+		awk sed "$1" && 2>/dev/null $(pwd)
+		then && --verbose x=1 && printf
+	| 2>/dev/null grep done readonly printf printf && && /usr/bin
+		2>/dev/null ${HOME} x=1 && -eu echo /usr/bin | x=1
+	'quoted text' 'quoted text'
+/usr/bin sed echo done 'quoted text' -eu ${HOME} test | awk printf cd "$1"
+sed --verbose echo "$@" grep then 2>/dev/null
+grep "$@" ${HOME} test -eu x=1 local cd
+test awk 2>/dev/null readonly
+printf test "$1" x=1 done awk grep ${HOME} x=1 test sed x=1 && -eu export
+		local done echo --verbose $(pwd) | then x=1
+sed ${HOME} cd cd --verbose
+	cd 2>/dev/null 'quoted text'
+'quoted text' "$@" awk local done awk
+		"$@" "$1" echo --verbose x=1 2>/dev/null printf export test
+		readonly test then "$@" && "$1" awk
+local local export -eu
+		${HOME} ${HOME} sed cd
+${HOME} -eu --verbose -eu && awk done grep test readonly 'quoted text' readonly
+	then grep grep $(pwd) 2>/dev/null
+		x=1 readonly 2>/dev/null /usr/bin test 2>/dev/null | then grep | /usr/bin
+then readonly "$@" && ${HOME} /usr/bin
+		readonly test awk readonly x=1 awk cd test grep grep -eu 'quoted text'
+		| 2>/dev/null printf grep printf awk export sed grep export
+awk "$@" ${HOME} awk "$@" $(pwd) "$1" grep "$@" && && grep /usr/bin local
+		$(pwd) "$@" $(pwd) --verbose /usr/bin
+$(pwd) export "$1" then 'quoted text' then cd --verbose 2>/dev/null cd sed
+--verbose printf 'quoted text' sed then -eu readonly
+	'quoted text' "$1" && printf /usr/bin
+	-eu done $(pwd) readonly
+sed $(pwd) sed echo printf -eu done
+"$1" -eu -eu ${HOME} cd cd ${HOME} "$@" "$@" done
+${HOME} /usr/bin echo && grep ${HOME} test --verbose && "$1" $(pwd) local
+cd $(pwd) awk local printf echo readonly local cd "$1" /usr/bin
+	/usr/bin printf awk cd "$1" 2>/dev/null ${HOME} 2>/dev/null test local then awk
+	--verbose printf "$@" awk awk 2>/dev/null then export ${HOME}
+	done x=1 "$1" 'quoted text' ${HOME} test
+		grep awk /usr/bin printf $(pwd) grep
+"$1" grep printf sed printf -eu readonly echo grep /usr/bin export "$1" $(pwd) |
+	"$@" sed && local && done then
+awk readonly -eu cd echo test -eu --verbose printf
+"$1" sed echo then sed awk 2>/dev/null
+		test grep && cd $(pwd) cd "$1" -eu | x=1 ${HOME} x=1 | && export readonly
+/usr/bin /usr/bin echo x=1 "$1" printf ${HOME} readonly | && -eu ${HOME} -eu
+${HOME} x=1 ${HOME} sed --verbose then then then "$1" done printf x=1 /usr/bin
+		sed /usr/bin 2>/dev/null 'quoted text' printf ${HOME}
+	printf readonly ${HOME} done sed test | && --verbose readonly -eu readonly
+&& sed sed -eu printf 2>/dev/null | x=1 then readonly awk --verbose
+		grep -eu 2>/dev/null then export "$@" export /usr/bin "$@"
+x=1 echo 2>/dev/null ${HOME} "$@" printf "$@" cd export 2>/dev/null
+	-eu done $(pwd) echo -eu export grep ${HOME} sed done awk export grep $(pwd)
+--verbose export /usr/bin readonly done "$1" x=1
+	"$1" echo grep grep readonly 2>/dev/null --verbose local x=1
+	awk 'quoted text' ${HOME} local && test 'quoted text' done
+	x=1 export "$1" echo then local readonly
+--verbose /usr/bin | local export --verbose
+/usr/bin && echo then readonly "$@" x=1 'quoted text' -eu export cd awk
+/usr/bin -eu done printf export readonly
+		export 2>/dev/null then && $(pwd) 'quoted text' | sed "$1" 2>/dev/null
+	| | local test x=1 done 2>/dev/null test readonly done 'quoted text'
+--verbose readonly export cd --verbose
+		then local cd /usr/bin then
+		"$@" ${HOME} printf x=1
+	cd -eu cd ${HOME} | readonly local
+"$1" && /usr/bin x=1 echo awk export awk
+sed local sed --verbose awk ${HOME} -eu "$1" ${HOME} --verbose
+local sed sed local "$@" && awk ${HOME} x=1 printf echo test test local
+echo echo "$1" -eu /usr/bin -eu -eu local echo local cd done "$@" done &&
+		"$@" then then x=1 "$@" export && local &&
+		$(pwd) awk --verbose printf && && | export awk x=1 cd $(pwd) 2>/dev/null awk
+export awk readonly then printf readonly done export /usr/bin 'quoted text'
+		--verbose "$@" cd cd done | "$@" test | echo 'quoted text' cd /usr/bin
+		'quoted text' ${HOME} local /usr/bin "$1" $(pwd) |
+		sed 'quoted text' "$1" --verbose
+	local | readonly ${HOME} -eu /usr/bin printf ${HOME} x=1 grep /usr/bin
+/usr/bin --verbose "$1" grep ${HOME} sed printf readonly
+	readonly echo /usr/bin echo -eu readonly 'quoted text' | sed -eu
+		grep "$1" 2>/dev/null cd awk
+	/usr/bin cd sed | ${HOME} done
+#include c220.sh
+	sed -eu -eu 'quoted text' /usr/bin --verbose sed readonly echo readonly
+	then --verbose printf echo done $(pwd) $(pwd) x=1 test
+-eu --verbose export /usr/bin | && cd $(pwd) --verbose sed /usr/bin "$@" && readonly
+export 2>/dev/null "$1" sed then cd echo
+	sed /usr/bin test && --verbose "$1" -eu "$@"
+	readonly test awk export 'quoted text' echo $(pwd) done
+	'quoted text' /usr/bin printf x=1 echo echo ${HOME}
+		test printf export 'quoted text' awk printf 2>/dev/null then then "$1" "$1"
+		done test | local cd x=1 local /usr/bin --verbose readonly
+	-eu /usr/bin awk -eu 'quoted text'
+| printf | local && cd $(pwd) /usr/bin test
+	"$1" local 'quoted text' 2>/dev/null
+		"$1" done sed 2>/dev/null 2>/dev/null 'quoted text'
+cd --verbose local export 'quoted text' 2>/dev/null
+&& /usr/bin -eu --verbose | readonly
+	&& awk test readonly 'quoted text'
+		grep 2>/dev/null "$1" 'quoted text'
+	echo test local then printf /usr/bin ${HOME} $(pwd) readonly x=1 cd ${HOME} |
+	'quoted text' export "$1" cd x=1 done echo $(pwd) 2>/dev/null 2>/dev/null
+test grep ${HOME} "$@" done
+${HOME} 'quoted text' then ${HOME} /usr/bin "$@" "$1"
+	2>/dev/null sed sed echo ${HOME} export awk local grep
+		/usr/bin && local $(pwd)
+		$(pwd) sed done sed cd
+		/usr/bin done export readonly echo done /usr/bin
+		| local x=1 /usr/bin local | awk cd 2>/dev/null --verbose
+		sed 2>/dev/null "$@" 'quoted text' cd 2>/dev/null 'quoted text'
+	export "$@" grep -eu "$1" then grep 'quoted text' "$@" printf sed
+"$1" done "$1" test x=1 ${HOME} && x=1 --verbose
+	/usr/bin 2>/dev/null awk test -eu readonly echo "$1" --verbose local
+		export grep "$@" && export awk && done /usr/bin
+then grep | "$@" 2>/dev/null 2>/dev/null grep 2>/dev/null
+		local "$1" export done "$@" local | && $(pwd) awk cd $(pwd)
+	'quoted text' /usr/bin grep --verbose "$@" then cd /usr/bin 2>/dev/null
+echo printf $(pwd) export $(pwd) --verbose $(pwd) $(pwd) 'quoted text' --verbose
+then $(pwd) ${HOME} /usr/bin
+		2>/dev/null local /usr/bin 'quoted text' grep
+echo then sed awk && && export "$1"
+		grep /usr/bin 'quoted text' $(pwd) export printf /usr/bin echo
+		"$1" sed done local then local
+		${HOME} export | -eu then awk x=1 local -eu
+		done local export readonly printf --verbose
+grep 2>/dev/null printf ${HOME} && then local "$@" "$1" | $(pwd)
+export printf "$@" 2>/dev/null local readonly export cd sed sed grep | echo
+	awk /usr/bin grep ${HOME} printf local 'quoted text' grep sed local
+	done 2>/dev/null 2>/dev/null grep 'quoted text' test ${HOME} && $(pwd) 2>/dev/null
+test printf "$@" 2>/dev/null
+--verbose $(pwd) test -eu $(pwd) readonly
+		2>/dev/null awk echo local test --verbose export
+export test 'quoted text' x=1 && "$1" | local test sed sed | /usr/bin printf
+		| x=1 test "$@" | "$1" "$1" echo 'quoted text'
+		then $(pwd) /usr/bin sed export -eu
+${HOME} printf done x=1 cd $(pwd) ${HOME}
+		local awk done -eu readonly sed 'quoted text' "$@" && local readonly export done
+	then && readonly x=1 echo export --verbose ${HOME} x=1 done 'quoted text'
+'quoted text' echo -eu test grep /usr/bin 'quoted text'
+awk echo --verbose test --verbose echo
+&& 2>/dev/null test sed -eu 2>/dev/null 2>/dev/null awk 2>/dev/null
+	readonly echo local echo && 'quoted text' export
+printf && "$@" sed 'quoted text'
+		2>/dev/null grep | 2>/dev/null ${HOME} "$@" readonly $(pwd)
+		readonly done done "$@" echo echo ${HOME} sed printf grep
+	test awk ${HOME} /usr/bin && -eu readonly -eu && printf done 2>/dev/null ${HOME}
+done -eu readonly 'quoted text' /usr/bin 'quoted text'
+	local printf sed echo printf export then 'quoted text'
+	sed echo "$1" awk 2>/dev/null awk then printf sed
+		"$@" export cd ${HOME} done then ${HOME}
+/usr/bin --verbose done "$1" done ${HOME} && cd 2>/dev/null test printf 'quoted text'
+		readonly awk x=1 | && test x=1 "$@" "$@" awk
+	$(pwd) ${HOME} echo done cd awk local
+test printf then 2>/dev/null export | && awk && done ${HOME}
+	awk grep export awk grep --verbose grep 'quoted text'
+	x=1 $(pwd) -eu ${HOME} 'quoted text' export /usr/bin local "$1" export
+local 'quoted text' -eu local printf "$1" readonly "$@" 2>/dev/null --verbose
+	local local | echo && echo
+	"$@" grep then readonly then
+	cd test cd $(pwd) | printf --verbose export done done awk &&
+		"$1" done ${HOME} 2>/dev/null echo echo | /usr/bin grep
+		'quoted text' sed x=1 2>/dev/null && readonly
+"$@" /usr/bin 2>/dev/null "$1" printf x=1 export
+readonly local test done readonly --verbose cd "$@" "$@" x=1 local then ${HOME}
+		&& sed ${HOME} -eu "$1" awk
+		2>/dev/null 'quoted text' readonly sed $(pwd) "$@" --verbose
+	| | local local cd 'quoted text' export
+printf export --verbose "$@" awk --verbose local -eu export 'quoted text'
+	"$@" && cd --verbose export "$1" export grep then echo
+	readonly printf done /usr/bin done x=1 local
+		awk "$@" "$@" awk --verbose printf printf readonly test
+"$@" test -eu -eu done --verbose "$@" 'quoted text'
+		printf 2>/dev/null awk export
+	awk test "$1" readonly | "$1" $(pwd) then "$@"
+		'quoted text' printf 2>/dev/null "$@" done
+		local -eu 2>/dev/null export then
+		${HOME} && local export --verbose ${HOME} cd -eu local x=1
+	test 'quoted text' -eu && cd -eu && "$@" done awk "$@" "$@" cd $(pwd) printf
+		x=1 "$@" sed cd then /usr/bin 'quoted text' | "$@" x=1 'quoted text' grep readonly
+cd -eu x=1 $(pwd) && test test readonly | export awk ${HOME} 2>/dev/null grep
+	2>/dev/null readonly --verbose ${HOME} readonly test | cd echo export echo local
+$(pwd) "$@" awk done 2>/dev/null --verbose
+	echo --verbose readonly | sed local 'quoted text'
+		test echo "$@" sed cd export export -eu local
+	"$@" grep local echo | export "$1" && 2>/dev/null
+		"$1" --verbose -eu grep $(pwd) sed local
+-eu awk && -eu $(pwd) && ${HOME} export printf
+		&& export --verbose x=1 | 'quoted text' then ${HOME}
+	"$1" export grep printf -eu sed awk echo ${HOME} $(pwd)
+		readonly $(pwd) ${HOME} 2>/dev/null | ${HOME} -eu /usr/bin -eu
+	${HOME} grep 2>/dev/null 2>/dev/null sed 2>/dev/null cd echo local
+	printf test awk then export | 'quoted text' export 'quoted text' cd printf
+		${HOME} printf --verbose $(pwd) --verbose $(pwd) /usr/bin -eu
+	local /usr/bin export echo 2>/dev/null 'quoted text'
+		"$@" then | ${HOME} x=1 "$1" awk local x=1 done -eu "$@"
+| awk 'quoted text' /usr/bin printf done grep 'quoted text' printf "$1"
+	/usr/bin echo grep awk readonly $(pwd) --verbose "$1" readonly | $(pwd) local
+		done export readonly && 2>/dev/null then printf printf /usr/bin printf awk | readonly
+		export printf | 'quoted text' awk 2>/dev/null
+		| && --verbose /usr/bin readonly local then echo cd awk | && | test --verbose
+		cd grep done x=1 x=1 then && grep x=1 && "$1"
+		"$1" grep 'quoted text' -eu x=1 local cd "$1" ${HOME} -eu local "$1" sed export
+| test printf awk --verbose x=1 cd grep done done grep | echo 2>/dev/null
+${HOME} readonly readonly 'quoted text' test /usr/bin grep test
+	'quoted text' sed $(pwd) sed export "$1" "$@"
+then readonly done 2>/dev/null then | --verbose printf /usr/bin
+	export ${HOME} export then export --verbose echo
+	export awk readonly readonly awk done ${HOME}
+-eu x=1 ${HOME} --verbose cd done && export readonly printf then printf
+printf export echo 2>/dev/null
+		2>/dev/null export /usr/bin printf -eu done "$1" printf --verbose cd done
+	cd && --verbose $(pwd) && "$1" "$1" export /usr/bin
+	&& 'quoted text' test export sed readonly
+		grep local && export ${HOME} grep grep "$@" then awk export local
+		test done then test awk /usr/bin -eu ${HOME}
+$(pwd) cd 'quoted text' --verbose "$1" sed &&
+		cd then 'quoted text' sed then | echo
+"$@" /usr/bin awk then grep readonly /usr/bin then && sed local test cd x=1
+local cd done then sed "$@" printf
+sed echo test $(pwd) && awk | &&
+		"$1" --verbose && "$1" sed 'quoted text' done export awk printf awk && cd readonly
+"$@" ${HOME} sed done 2>/dev/null "$@" 'quoted text' x=1 test
+	x=1 done x=1 cd echo $(pwd) test readonly /usr/bin
+		| done | "$@" 2>/dev/null awk test ${HOME} && sed x=1 ${HOME} x=1 -eu
+	readonly local then echo | -eu cd export "$@" x=1 done
+	test echo | then local && -eu cd printf
+	"$@" x=1 grep export printf "$@" awk test -eu && | test done ${HOME} /usr/bin test
+	'quoted text' printf && local && ${HOME} export
+'quoted text' awk 2>/dev/null x=1 "$1" awk 2>/dev/null
+	$(pwd) test 'quoted text' awk && && readonly | $(pwd) printf -eu awk
+	--verbose --verbose $(pwd) --verbose
+		awk export $(pwd) local grep
+		local then /usr/bin export "$1"
+		printf "$1" test local export &&
+	$(pwd) test && && readonly
+	sed awk "$@" printf "$@" grep printf --verbose --verbose echo cd "$@" local
+	done ${HOME} $(pwd) /usr/bin
+then grep cd grep /usr/bin
+test 'quoted text' printf
+		sed x=1 x=1 ${HOME} readonly "$@" /usr/bin awk printf
+		then ${HOME} ${HOME} -eu /usr/bin test | grep x=1 x=1
+		sed grep awk printf then awk cd 'quoted text' -eu test awk
+		/usr/bin readonly readonly then cd | sed local cd ${HOME}
+/usr/bin --verbose sed $(pwd) | test echo
+	${HOME} ${HOME} && "$@" ${HOME}
+		2>/dev/null readonly 'quoted text' 2>/dev/null && grep && "$@" && -eu
+${HOME} export "$1" ${HOME} echo | grep && done
+export && $(pwd) cd ${HOME} local |
+		${HOME} 2>/dev/null sed ${HOME} readonly local
+		x=1 x=1 ${HOME} 2>/dev/null "$1" done && printf && --verbose
+	grep local x=1 "$1" | |
+		/usr/bin done --verbose printf | $(pwd) printf then sed -eu
+sed export /usr/bin x=1
+	sed grep /usr/bin /usr/bin
+	done | awk | /usr/bin &&
+2>/dev/null && export awk readonly cd -eu
+--verbose /usr/bin export
+		then $(pwd) done --verbose | cd -eu printf then "$1" 'quoted text' "$@" awk
+	cd grep readonly grep sed "$1" x=1 $(pwd) x=1 x=1 'quoted text' --verbose
+export "$@" test cd awk 'quoted text' test echo 'quoted text' 'quoted text'
+	2>/dev/null | done printf printf done
+${HOME} "$@" "$1" then -eu export export awk 2>/dev/null "$1" -eu | readonly
+		--verbose test 2>/dev/null export 'quoted text'
+		"$1" echo echo $(pwd) done x=1 /usr/bin
+"$1" export cd test awk 2>/dev/null cd then --verbose -eu
+	"$@" export sed "$@" 2>/dev/null grep --verbose
+	echo local done && test sed done --verbose echo $(pwd) "$@" grep
+readonly printf test "$@" --verbose && /usr/bin sed 'quoted text'
+		--verbose --verbose ${HOME} sed -eu export -eu
+		echo ${HOME} readonly readonly --verbose x=1 grep
+		$(pwd) printf && local ${HOME} readonly awk sed cd readonly then -eu "$1"
+		| 'quoted text' awk --verbose awk -eu then export "$@" test awk
+x=1 grep then printf then echo done x=1 --verbose printf 2>/dev/null
+	${HOME} cd done $(pwd) 2>/dev/null printf x=1 export
+	then then then --verbose 2>/dev/null local grep -eu 2>/dev/null readonly
+test ${HOME} ${HOME} ${HOME}
+		"$@" sed /usr/bin done readonly local
+		${HOME} && test awk test x=1 x=1 test export export awk cd test printf 2>/dev/null
+x=1 printf local grep --verbose echo "$@" x=1 export awk
+		"$1" /usr/bin export "$1" then grep
+	printf then $(pwd) --verbose && done printf
+	2>/dev/null then cd 'quoted text'
+"$1" grep test --verbose grep grep sed cd 2>/dev/null then $(pwd) export test
+		2>/dev/null 'quoted text' then test "$1" sed "$@" 2>/dev/null sed readonly
+		sed /usr/bin cd then "$@" cd -eu echo
+--verbose x=1 --verbose echo local "$1" echo
+	${HOME} --verbose readonly readonly 2>/dev/null echo "$1" test | cd
+	sed done readonly 'quoted text'
+/usr/bin grep "$@" readonly done 2>/dev/null local "$1" sed -eu test sed
+&& | sed awk "$@" -eu ${HOME} "$@" cd test "$@" grep echo echo
+		-eu done printf cd readonly then "$1" x=1 $(pwd) readonly
+		2>/dev/null $(pwd) /usr/bin x=1 --verbose "$1" awk awk "$1" 'quoted text'
+		sed ${HOME} awk $(pwd) export readonly && echo | echo x=1 "$@"
+| "$@" -eu done awk echo then cd grep local | export
+	"$@" /usr/bin echo done | "$@" /usr/bin echo
+		| export 2>/dev/null -eu test awk "$@" $(pwd) "$1" && -eu /usr/bin test | readonly
+	'quoted text' grep 2>/dev/null 'quoted text' --verbose --verbose
+"$1" local "$@" -eu awk done echo $(pwd) local local && /usr/bin
+	$(pwd) export /usr/bin echo 'quoted text'
+		export "$@" export /usr/bin echo $(pwd) /usr/bin
+		test ${HOME} x=1 ${HOME} local /usr/bin
+		&& && local "$@" /usr/bin done local | awk grep $(pwd)
+	export done x=1 printf awk 2>/dev/null test readonly x=1
+done /usr/bin then x=1 "$1" echo /usr/bin grep | 'quoted text' "$1" test echo /usr/bin
+	$(pwd) printf cd ${HOME} --verbose | && sed local
+export | "$1" ${HOME} 'quoted text' "$@" printf then x=1 ${HOME} --verbose
+readonly "$1" "$1" test grep echo then test 'quoted text' then 'quoted text'
+	then x=1 ${HOME} x=1 $(pwd) readonly
+/usr/bin ${HOME} 'quoted text' test cd | $(pwd) "$1"
+x=1 | /usr/bin 'quoted text' 2>/dev/null "$1" sed export "$1" --verbose
+		readonly --verbose test export grep "$@" "$1" test
+		/usr/bin ${HOME} export echo /usr/bin printf readonly -eu sed printf
+$(pwd) "$1" x=1 "$1" test ${HOME} /usr/bin
+	/usr/bin grep local then 2>/dev/null "$1"
+-eu printf test grep readonly then awk printf printf sed
+	test readonly export echo /usr/bin sed sed | x=1 done sed printf grep -eu
+grep -eu done echo && && done "$1" done -eu sed 2>/dev/null
+	"$1" echo awk printf then done cd -eu awk export
+		"$@" export 'quoted text' echo | 2>/dev/null local /usr/bin -eu done && sed
+	$(pwd) awk | readonly then sed then
+| export ${HOME} test $(pwd) done cd "$1"
+	grep local readonly grep && test x=1 grep | awk -eu $(pwd) cd done
+	printf /usr/bin | x=1 printf grep
+		/usr/bin awk sed 2>/dev/null cd echo awk 'quoted text'
+		test $(pwd) test "$@" 2>/dev/null local "$@" "$1"
+echo readonly && done 'quoted text' 'quoted text'
+		/usr/bin awk ${HOME} | x=1 readonly echo printf
+	readonly 2>/dev/null ${HOME} ${HOME} awk
+	then grep printf grep -eu ${HOME} ${HOME} then export then
+sed done cd "$@" then sed printf && --verbose 'quoted text' /usr/bin /usr/bin
+	sed cd readonly -eu && sed done
+		local /usr/bin cd sed local
+	echo local $(pwd) -eu && cd then "$@" $(pwd) x=1 export | 2>/dev/null 2>/dev/null
+		readonly ${HOME} readonly grep "$@" then
+	-eu 'quoted text' "$1"
+		&& sed echo test | done 'quoted text' $(pwd) $(pwd) grep 2>/dev/null export
+	local test echo grep -eu /usr/bin /usr/bin x=1 -eu ${HOME}
+		"$1" cd printf "$1" ${HOME} local --verbose
+		then local "$@" "$1" 2>/dev/null echo $(pwd)
+| "$1" local export ${HOME} readonly x=1
+		grep printf 'quoted text' then echo grep -eu x=1 /usr/bin cd /usr/bin
+export readonly local 2>/dev/null 'quoted text'
+export | sed ${HOME} sed echo $(pwd) /usr/bin echo && test 2>/dev/null test
+		"$@" sed local | grep echo echo 2>/dev/null cd 'quoted text' ${HOME} ${HOME}
+		$(pwd) x=1 "$@" grep /usr/bin
+		awk export "$@" grep x=1 then "$1" ${HOME}
+		&& "$@" printf x=1 test x=1
+		"$@" /usr/bin done "$1" $(pwd) x=1 grep done done local
+test printf done | x=1
+"$1" 2>/dev/null ${HOME} "$@" readonly sed "$@" -eu cd 2>/dev/null sed "$1" &&
+readonly "$1" | "$@" then grep sed /usr/bin $(pwd) 2>/dev/null
+	$(pwd) 2>/dev/null grep awk
+	2>/dev/null | /usr/bin grep cd -eu cd done --verbose awk ${HOME}
+		${HOME} sed local ${HOME} ${HOME} echo 2>/dev/null printf "$1"
+awk "$1" done --verbose -eu local readonly x=1 done awk 'quoted text'
+sed then sed then /usr/bin cd --verbose
+		| readonly awk 2>/dev/null grep readonly 2>/dev/null
+		${HOME} grep local readonly printf x=1 -eu export export awk
+	local awk done export printf $(pwd) local -eu printf test --verbose printf -eu
+		readonly 2>/dev/null |
+	/usr/bin ${HOME} 'quoted text' test printf
+		$(pwd) sed grep --verbose 2>/dev/null test
+'quoted text' | "$@" 'quoted text' $(pwd) echo printf grep &&
+	sed && readonly -eu done --verbose echo 2>/dev/null done awk
+		awk "$@" | printf | && awk $(pwd)
+local then cd local local && test local $(pwd) "$@" "$@" 'quoted text' export
+	'quoted text' 'quoted text' cd local && done echo --verbose -eu 2>/dev/null
+	-eu printf "$1" ${HOME} 'quoted text' sed
+		awk then /usr/bin then then test 2>/dev/null printf
+		2>/dev/null echo x=1 grep cd "$@" ${HOME} then done
+	x=1 awk sed && sed then done x=1 x=1 && x=1 "$1" printf x=1 "$@" readonly local
+		2>/dev/null x=1 local 'quoted text' echo export
+	export ${HOME} test then 2>/dev/null grep --verbose echo
+	local "$@" 'quoted text' export sed printf printf x=1 x=1
+	printf printf readonly ${HOME}
+printf "$1" sed awk cd done then
+readonly $(pwd) local 2>/dev/null /usr/bin
+local ${HOME} sed echo $(pwd) "$@" x=1 then cd ${HOME} done cd x=1 echo
+		x=1 grep "$1" cd /usr/bin cd 'quoted text' x=1 x=1 x=1
+"$1" /usr/bin local readonly printf sed echo "$@" /usr/bin
+-eu printf "$@" awk awk 2>/dev/null
+	--verbose export x=1 echo local done echo -eu awk export "$@"
+		${HOME} then && echo x=1 readonly $(pwd) 2>/dev/null x=1 export
+grep x=1 test local export $(pwd) test 2>/dev/null test "$@" "$@"
+		grep sed | x=1 2>/dev/null then echo "$1" export 'quoted text'
+		then 'quoted text' grep readonly -eu -eu done local x=1
+"$@" sed -eu 2>/dev/null local printf 'quoted text' "$1" --verbose --verbose
+		readonly sed "$@" export local --verbose
+		echo ${HOME} echo then --verbose $(pwd) | ${HOME} && echo /usr/bin
+local "$1" | /usr/bin 2>/dev/null 2>/dev/null "$@" readonly ${HOME} printf /usr/bin
+		test "$@" local --verbose awk then readonly /usr/bin 2>/dev/null echo 2>/dev/null
+test cd test -eu cd local done then sed grep readonly && readonly
+		${HOME} local readonly export x=1 /usr/bin | -eu
+grep grep sed awk "$@" printf /usr/bin local
+done | x=1 x=1 && echo grep done "$@"
+		grep && && -eu test x=1 printf --verbose 2>/dev/null | && -eu printf /usr/bin cd
+		"$@" test done grep x=1
+		'quoted text' 2>/dev/null --verbose readonly printf
+	x=1 "$@" then 'quoted text' sed test export
+		local then then 'quoted text' then cd ${HOME} | -eu done
+	test && printf "$@" cd 'quoted text' grep "$@" readonly "$1" sed awk -eu
+	2>/dev/null -eu cd /usr/bin
+		"$1" done awk grep printf | done "$1" echo $(pwd) sed -eu export --verbose
+2>/dev/null -eu sed --verbose cd --verbose
+	grep && export grep then "$@" export
+$(pwd) x=1 cd local cd test
+"$1" "$1" sed "$1" sed export $(pwd) sed readonly
+$(pwd) | then -eu && grep --verbose -eu --verbose /usr/bin echo test |
+		-eu x=1 local "$@" echo
+		-eu "$1" sed awk local awk $(pwd) done
+	--verbose --verbose sed | -eu -eu $(pwd) 'quoted text' echo echo 2>/dev/null
+		then echo sed then x=1 --verbose awk echo export 'quoted text' 'quoted text'
+${HOME} readonly sed export "$1" |
+	"$1" | export test 2>/dev/null export
+${HOME} "$@" test /usr/bin "$1" local cd readonly $(pwd)
+2>/dev/null $(pwd) test | 'quoted text' x=1 x=1 ${HOME}
+	"$@" x=1 "$1" 2>/dev/null /usr/bin local --verbose test
+		2>/dev/null | /usr/bin cd && ${HOME} echo && echo --verbose sed echo export
+"$@" 'quoted text' sed sed readonly test 'quoted text' ${HOME}
+	"$@" test --verbose local "$1" && cd /usr/bin test
+/usr/bin "$1" /usr/bin 2>/dev/null printf 2>/dev/null
+$(pwd) sed --verbose -eu
+		| --verbose /usr/bin "$@" awk sed --verbose local awk ${HOME} cd && "$@"
+	export && local test && echo
+		2>/dev/null | done grep sed 'quoted text'
+x=1 && cd then readonly /usr/bin 'quoted text' test echo cd 'quoted text' printf
+	"$@" 'quoted text' local x=1
+		readonly 2>/dev/null grep echo sed "$1" "$@" /usr/bin echo
+	| 2>/dev/null done "$1" ${HOME} export x=1 sed
+then $(pwd) x=1 cd echo readonly
+	"$@" local readonly && -eu export local /usr/bin ${HOME}
+	-eu export ${HOME} printf echo test
+cd "$1" 'quoted text' "$1" | && --verbose printf x=1 | "$1" "$@" awk -eu awk
+		'quoted text' export export && $(pwd) /usr/bin
+	2>/dev/null 'quoted text'
+	${HOME} echo grep local
+		-eu echo && $(pwd) readonly echo "$1" -eu --verbose 2>/dev/null cd x=1
+		'quoted text' sed $(pwd) "$1" export readonly
+		--verbose && $(pwd) --verbose test echo --verbose echo
+	$(pwd) then local && | x=1
+	cd test /usr/bin then | cd local
+awk done sed && x=1 echo awk $(pwd) /usr/bin 'quoted text'
+		/usr/bin awk then --verbose cd done x=1 test
+--verbose grep test $(pwd) test sed "$1" done x=1 2>/dev/null
+	sed "$@" && test && 2>/dev/null | 2>/dev/null local
+		printf grep cd echo then "$1" 2>/dev/null
+	export -eu awk 2>/dev/null && export x=1 export printf x=1 awk sed cd export
+		grep "$@" awk /usr/bin cd && 2>/dev/null grep export grep /usr/bin
+		local awk -eu then export done readonly
+/usr/bin && echo 'quoted text'
+		cd sed ${HOME} -eu /usr/bin --verbose "$@"
+		--verbose cd grep done done export grep 'quoted text'
+	export x=1 $(pwd) printf 'quoted text' then
+		"$1" | done $(pwd) printf | 2>/dev/null printf --verbose sed readonly sed --verbose
+	$(pwd) && local readonly test --verbose cd cd readonly | x=1 echo --verbose
+		echo "$@" then "$@" done test x=1 awk cd printf printf "$1"
+		"$@" 2>/dev/null sed -eu x=1 grep cd /usr/bin $(pwd) readonly grep sed 2>/dev/null
+awk printf export --verbose /usr/bin | local 'quoted text' sed
+cd 2>/dev/null then cd cd cd test export test sed readonly local
+'quoted text' printf test echo export && printf /usr/bin test
+	${HOME} done export export --verbose printf test awk
+		'quoted text' $(pwd) export /usr/bin
+	printf done --verbose test cd grep ${HOME} && echo
+	printf then x=1 ${HOME} --verbose readonly then test && -eu 'quoted text'
+		$(pwd) x=1 local "$@" cd export awk
+"$1" && done done "$@" sed echo 2>/dev/null 'quoted text' readonly
+	awk "$@" done "$1" then
+	then "$1" done then echo 2>/dev/null
+		| cd export | 2>/dev/null grep 2>/dev/null 'quoted text'
+	x=1 'quoted text' "$1" 'quoted text'
+	test local -eu done && awk "$@" awk 'quoted text' echo $(pwd) 2>/dev/null
+		| then cd awk -eu echo 2>/dev/null $(pwd) readonly
+	cd /usr/bin "$@" ${HOME} done -eu
+		awk 'quoted text' && then 'quoted text' 2>/dev/null printf -eu | grep then $(pwd)
+	2>/dev/null "$@" printf test test "$@" && local 2>/dev/null test
+		sed cd sed 'quoted text' "$1" test x=1 grep -eu /usr/bin /usr/bin x=1
+		'quoted text' printf local awk grep readonly done then awk readonly "$@" "$1"
+	-eu $(pwd) sed echo 2>/dev/null
+		/usr/bin --verbose --verbose
+local 2>/dev/null then awk ${HOME}
+printf export $(pwd) ${HOME} 2>/dev/null printf cd x=1 |
+		--verbose printf -eu $(pwd) ${HOME} export
+local printf readonly | sed | $(pwd)
+local test echo readonly x=1 awk export export
+sed then "$@" export $(pwd) then 'quoted text' 'quoted text' grep 'quoted text'
+	echo /usr/bin | sed echo grep | sed then ${HOME} -eu printf echo
+test "$1" sed $(pwd) printf sed done | "$@" "$@"
+export && export readonly local sed | "$@" cd
+	&& test readonly && /usr/bin ${HOME} grep "$@" ${HOME}
+	&& && awk done && readonly printf
+	readonly --verbose 2>/dev/null printf
+		"$@" cd /usr/bin printf --verbose /usr/bin x=1 2>/dev/null
+$(pwd) 'quoted text' && grep grep grep sed
+| "$@" /usr/bin then printf && export
+		-eu sed 'quoted text' echo test export "$1" ${HOME} test
+${HOME} x=1 readonly readonly printf local echo "$@"
+		test && sed cd done awk cd $(pwd) && $(pwd) $(pwd) --verbose
+	awk --verbose awk x=1 local 'quoted text'
+sed printf | test "$1" --verbose then readonly done readonly ${HOME}
+	awk echo ${HOME} /usr/bin "$@" export sed $(pwd) done readonly test ${HOME}
+	echo && readonly printf
+	"$1" 2>/dev/null 2>/dev/null done then -eu
+	sed sed printf echo local --verbose && $(pwd) test $(pwd) echo then
+	"$@" grep $(pwd) test grep /usr/bin -eu "$1" "$1" /usr/bin
+then echo "$@" 2>/dev/null "$1" $(pwd) | printf echo cd then printf cd | | cd
+export "$@" -eu sed x=1 && printf then printf sed sed 'quoted text' --verbose
+sed test -eu ${HOME} grep -eu printf -eu $(pwd) then readonly --verbose "$1" -eu
+		'quoted text' sed 'quoted text' ${HOME} readonly local
+		$(pwd) local && x=1 test readonly
+-eu export export printf then ${HOME} local --verbose
+		local sed grep echo | /usr/bin -eu printf
+	&& -eu "$1" echo export cd export
+	/usr/bin 2>/dev/null && grep cd cd
+	-eu ${HOME} x=1 2>/dev/null
+		test then ${HOME} export $(pwd) cd "$1" awk --verbose /usr/bin ${HOME}
+	$(pwd) --verbose done --verbose "$@" test 'quoted text' --verbose
+		then | $(pwd) "$@" printf readonly
+		awk sed -eu sed ${HOME} "$1" awk ${HOME} 2>/dev/null
+		-eu ${HOME} done grep /usr/bin printf --verbose test readonly awk
+	${HOME} test | 'quoted text'
+awk x=1 /usr/bin 'quoted text' test readonly 'quoted text' grep 'quoted text'
+echo && ${HOME} printf export "$@" test --verbose
+done awk x=1 2>/dev/null done test | "$1" then /usr/bin
+sed --verbose done --verbose x=1
+	'quoted text' awk export x=1 -eu ${HOME} test grep ${HOME} && 2>/dev/null
+-eu local 'quoted text' printf "$1" echo grep
+		export test export -eu awk readonly ${HOME} cd 'quoted text'
+		${HOME} cd /usr/bin "$1" echo x=1 ${HOME}
+cd done cd | echo $(pwd) $(pwd) -eu 'quoted text'
+		sed printf "$1" /usr/bin -eu --verbose 'quoted text'
+	&& export cd test cd /usr/bin export --verbose cd && && readonly sed
+	then ${HOME} "$@" awk export /usr/bin
+	local echo -eu printf -eu then local ${HOME} x=1 2>/dev/null ${HOME} test
+	grep 2>/dev/null "$1" --verbose sed x=1 x=1 && /usr/bin export
+	&& 'quoted text' grep export /usr/bin export
+	awk --verbose --verbose 'quoted text' done "$1" readonly -eu awk sed then $(pwd)
+		2>/dev/null sed test "$@" test $(pwd) done cd
+		grep -eu -eu --verbose x=1 grep $(pwd) | test grep export local export
+awk x=1 done "$@" "$1" "$1" test sed | echo 'quoted text' cd
+| grep $(pwd) local "$@"
+grep grep then /usr/bin grep then /usr/bin awk readonly "$@" sed 2>/dev/null
+-eu --verbose "$@" "$1" cd done "$@" x=1 -eu grep --verbose
+	-eu "$1" /usr/bin then ${HOME} printf
+	done /usr/bin | test x=1 -eu
+"$1" test && local "$1" awk x=1 2>/dev/null grep ${HOME} readonly then |
+		echo test | "$@" awk "$1" local x=1 /usr/bin 'quoted text' -eu
+	| echo readonly printf x=1 sed test cd ${HOME} "$1" 2>/dev/null &&
+readonly --verbose && && | | ${HOME} export "$1" x=1 2>/dev/null
+		echo $(pwd) grep /usr/bin $(pwd) x=1 printf | readonly
+local /usr/bin cd cd then 2>/dev/null cd | test then local -eu
+	'quoted text' 2>/dev/null then awk "$@"
+2>/dev/null awk awk echo readonly /usr/bin
+		| 2>/dev/null ${HOME} -eu sed then printf "$1" "$@" awk sed
+then done printf printf printf
+		$(pwd) -eu 'quoted text' echo then grep awk local "$1" export echo test
+/usr/bin --verbose && "$@" readonly
+	"$@" /usr/bin "$1" sed 'quoted text' 'quoted text' x=1 readonly readonly
+--verbose 2>/dev/null -eu "$1" done sed ${HOME} --verbose readonly --verbose "$@"
+	echo "$1" 2>/dev/null cd /usr/bin echo --verbose awk cd awk sed
+--verbose printf readonly done grep $(pwd)
+	'quoted text' ${HOME} done grep then sed echo x=1 ${HOME} /usr/bin
+		${HOME} --verbose export printf | sed && export cd "$@" ${HOME}
+		export export export -eu
+	grep local local "$@" 2>/dev/null
+done && 'quoted text' grep export $(pwd) cd done && 2>/dev/null ${HOME}
+	&& export $(pwd) $(pwd) export test export cd sed then 'quoted text' "$1"
+"$@" done echo -eu done $(pwd) --verbose cd export sed sed --verbose --verbose
+x=1 readonly sed export 'quoted text' /usr/bin sed $(pwd)
+"$@" echo then awk readonly readonly
+		--verbose /usr/bin done
+		-eu awk readonly $(pwd) grep readonly then readonly /usr/bin
+	$(pwd) done awk sed printf | test local /usr/bin "$@" "$@" | sed
+	x=1 done local printf $(pwd) sed awk export -eu readonly "$@" | grep readonly
+local ${HOME} test x=1 /usr/bin readonly echo x=1 then
+2>/dev/null done cd 'quoted text'
+"$@" then --verbose x=1 --verbose test "$1" export -eu | readonly
+	export 'quoted text' x=1 2>/dev/null sed "$@" | 2>/dev/null $(pwd)
+	/usr/bin grep ${HOME} ${HOME} | readonly
+$(pwd) awk --verbose -eu echo && /usr/bin done printf | ${HOME} echo
+		--verbose then test grep x=1 2>/dev/null export
+export grep "$1" /usr/bin | echo ${HOME} then sed -eu /usr/bin
+done 'quoted text' then done awk -eu && "$@" sed readonly x=1 "$@"
+${HOME} printf awk x=1 $(pwd) grep ${HOME}
+	echo && test && printf grep then -eu test echo printf printf readonly
+--verbose test awk "$@"
+sed export /usr/bin export readonly done cd ${HOME} /usr/bin
+x=1 sed "$1" | -eu 2>/dev/null $(pwd)
+then test awk echo "$1" sed cd $(pwd) grep $(pwd) && x=1 && cd readonly
+		"$@" && --verbose /usr/bin $(pwd) echo test echo readonly
+		x=1 readonly cd export
+		awk cd grep -eu echo printf ${HOME} then "$1"
+	printf test echo /usr/bin | 'quoted text' x=1 readonly cd local
+	x=1 ${HOME} /usr/bin "$1" done
+	awk test x=1 readonly echo "$1" export $(pwd)
+		| 'quoted text' "$1" | export readonly x=1 $(pwd) local
+		&& 2>/dev/null /usr/bin echo sed local 2>/dev/null readonly sed --verbose grep
+		printf 2>/dev/null "$@" then x=1 ${HOME} awk 2>/dev/null test echo x=1 sed ${HOME}
+"$@" done awk -eu then $(pwd) ${HOME}
+		'quoted text' $(pwd) test /usr/bin awk export 2>/dev/null
+'quoted text' done grep cd 2>/dev/null sed
+	&& | awk --verbose sed cd $(pwd) then | "$1" printf
+${HOME} 'quoted text' done "$@" && test then && /usr/bin test
+	-eu done x=1 -eu printf x=1 cd grep awk local cd done ${HOME}
+	readonly test /usr/bin "$@" cd | /usr/bin grep export 'quoted text' local ${HOME}
+grep x=1 sed readonly && $(pwd) then
+		test --verbose awk awk then done done test local 2>/dev/null
+| sed printf local ${HOME} x=1 grep "$@" printf "$1"
+	sed echo && x=1 && local | test then awk grep then then -eu 2>/dev/null
+		--verbose /usr/bin $(pwd) grep 'quoted text' "$1" "$1" test ${HOME} grep
+		-eu ${HOME} $(pwd) "$1" echo -eu sed
+readonly /usr/bin --verbose done
+		readonly done echo -eu && grep done -eu ${HOME}
+		"$@" cd sed 'quoted text' test 'quoted text' x=1 -eu export then done 2>/dev/null
+		x=1 /usr/bin grep --verbose
+		grep test ${HOME} awk grep ${HOME} sed readonly x=1 2>/dev/null
+		--verbose echo --verbose local "$1"
+local done "$@" "$@" $(pwd) readonly "$1" done sed then ${HOME} && local
+local sed --verbose && readonly printf -eu echo -eu test test awk "$@"
+/usr/bin ${HOME} grep echo echo
+local /usr/bin x=1 -eu
+	"$1" printf && awk cd | --verbose local -eu x=1 /usr/bin
+cd x=1 && sed -eu && then --verbose ${HOME} export echo done 2>/dev/null
+/usr/bin ${HOME} export test awk
+		echo done then grep /usr/bin $(pwd)
+		export 2>/dev/null 2>/dev/null && | --verbose /usr/bin cd -eu done test awk
+	2>/dev/null export /usr/bin grep
+	printf ${HOME} 2>/dev/null
+	awk test /usr/bin /usr/bin grep 2>/dev/null
+		grep 'quoted text' -eu
+-eu --verbose sed "$@" && && local
+${HOME} "$@" sed done | awk | ${HOME} x=1 2>/dev/null
+		| $(pwd) --verbose 'quoted text' sed /usr/bin
+"$1" grep 2>/dev/null printf ${HOME} local | cd
+	export local --verbose then cd $(pwd)
+	then readonly local 'quoted text' x=1 readonly grep
+		then test test export "$1" |
+	/usr/bin done cd echo -eu "$@" test 'quoted text' | export -eu "$@" "$1"
+echo local export "$@" awk 'quoted text' |
+		"$1" cd sed printf x=1 'quoted text'
+	printf | --verbose ${HOME} 2>/dev/null printf cd test /usr/bin "$@" export
+		echo done echo 2>/dev/null readonly 'quoted text' then done then echo
+awk sed && printf cd sed --verbose
+		awk "$1" grep awk | $(pwd) 2>/dev/null "$@" /usr/bin
+		then "$@" printf x=1 grep done test ${HOME}
+	$(pwd) && cd echo 2>/dev/null grep printf
+	&& ${HOME} echo && --verbose test
+	${HOME} grep printf readonly grep local sed 'quoted text' done x=1 then
+	x=1 --verbose sed then | --verbose test awk export then local
+local sed readonly cd ${HOME} readonly readonly 2>/dev/null 2>/dev/null 2>/dev/null
+	| sed echo export $(pwd)
+	cd 'quoted text' "$@" export awk export
+done grep cd echo "$1" cd "$@" test cd printf printf $(pwd) ${HOME}
+	sed local --verbose 'quoted text' | 2>/dev/null "$1" -eu then awk local
+x=1 "$@" x=1 "$1" local "$@" echo done ${HOME} cd 2>/dev/null
+	grep local -eu cd x=1 && &&
+		| cd x=1 sed $(pwd) "$1" /usr/bin --verbose printf then echo echo export
+		done echo && $(pwd) echo "$1" "$@" done cd local
+		then export "$1" 2>/dev/null cd awk sed 2>/dev/null
+		printf sed awk grep then /usr/bin $(pwd) local x=1 2>/dev/null
+	test "$1" then sed cd 'quoted text' /usr/bin -eu echo && x=1 printf
+		x=1 sed ${HOME} printf $(pwd) grep | 2>/dev/null sed local
+	-eu x=1 printf | /usr/bin /usr/bin readonly local -eu | grep
+		x=1 --verbose 2>/dev/null | ${HOME} readonly readonly test printf && && done
+'quoted text' /usr/bin grep echo 2>/dev/null local
+		test && then 2>/dev/null awk export printf sed | printf
+printf printf && $(pwd) 2>/dev/null done "$@" && readonly done then done -eu
+$(pwd) ${HOME} -eu printf test -eu export /usr/bin -eu "$@"
+		$(pwd) ${HOME} cd | echo printf ${HOME} /usr/bin | test done sed test local
+	local done test x=1 awk done readonly --verbose 2>/dev/null "$@" --verbose
+	export readonly && test done sed printf grep sed awk export printf readonly
+cd "$@" x=1 then ${HOME} export
+		grep "$@" $(pwd) /usr/bin "$@" echo "$1" local
+		/usr/bin "$1" 2>/dev/null awk | --verbose echo 'quoted text' done --verbose
+		/usr/bin $(pwd) echo "$1" echo "$1" grep "$1" 'quoted text' grep x=1 readonly
+		cd --verbose echo awk sed done readonly grep $(pwd) awk ${HOME} | export /usr/bin
+		"$@" "$1" $(pwd) 'quoted text' && 'quoted text' 'quoted text' readonly $(pwd)
+		then && | sed done "$@"
+		test 'quoted text' x=1 $(pwd) "$@" | grep
+	-eu done --verbose cd $(pwd) sed test local "$1" $(pwd) printf $(pwd) x=1 'quoted text'
+		| export printf -eu local ${HOME} local printf printf && test export readonly readonly
+		&& echo local local echo then grep sed "$@"
+		--verbose awk "$@" readonly 2>/dev/null sed 2>/dev/null
+	sed 'quoted text' readonly export x=1
+	/usr/bin sed grep $(pwd) export grep printf sed x=1
+	echo test "$1" "$1" --verbose done "$1" 'quoted text'
+		local readonly grep 2>/dev/null 'quoted text'
+		$(pwd) test sed ${HOME} readonly cd
+	printf export local sed awk | && done readonly then
+		printf && --verbose sed --verbose test 'quoted text' done x=1 x=1 "$@" $(pwd)
+		2>/dev/null readonly awk 2>/dev/null
+test readonly /usr/bin readonly && --verbose "$1" && --verbose then ${HOME}
+		printf && grep local echo printf --verbose echo x=1 2>/dev/null sed
+		local | -eu "$1" 2>/dev/null printf
+	then $(pwd) cd echo local $(pwd) $(pwd) echo
+${HOME} then 'quoted text' local 2>/dev/null ${HOME} "$@" awk | --verbose
+	grep local "$@" 'quoted text' done export export
+	cd $(pwd) test ${HOME} "$1" local "$@" && 'quoted text' x=1
+		awk /usr/bin grep $(pwd) && readonly cd
+		'quoted text' echo x=1 "$@" sed
+	'quoted text' done echo && /usr/bin 2>/dev/null "$@" sed 2>/dev/null cd "$@"
+	test -eu test cd cd printf 'quoted text'
+test 'quoted text' awk -eu done
+		then export echo export echo done awk -eu echo /usr/bin && x=1 done then
+--verbose && 2>/dev/null
+	| printf echo $(pwd) $(pwd)
+sed grep --verbose | readonly && && local -eu cd export cd ${HOME} printf
+		-eu echo cd test 'quoted text' /usr/bin ${HOME} "$@" /usr/bin && export sed
+		grep "$1" /usr/bin &&
+sed /usr/bin 2>/dev/null /usr/bin 2>/dev/null
+		/usr/bin "$1" then ${HOME} "$@" local x=1 done 2>/dev/null
+		$(pwd) "$@" done readonly 2>/dev/null
+printf && "$@" "$1" grep "$1" printf 'quoted text' /usr/bin echo grep sed
+	"$1" | cd ${HOME} -eu done then "$@" $(pwd) sed export
+&& cd local ${HOME} then ${HOME} x=1 export | "$@" x=1 printf "$@"
+"$@" done && $(pwd) --verbose | echo cd 'quoted text' export awk /usr/bin 2>/dev/null
+readonly then test 'quoted text' done --verbose /usr/bin -eu "$@" ${HOME}
+		awk then done awk 2>/dev/null "$1" 'quoted text' 2>/dev/null && -eu sed
+		'quoted text' then "$@" ${HOME} sed awk export export
+/usr/bin echo readonly grep awk sed x=1 export awk echo then 2>/dev/null ${HOME}
+		test -eu local export 2>/dev/null /usr/bin readonly printf
+printf "$1" | | printf --verbose | "$@" echo awk then
+export 2>/dev/null test readonly
+test readonly readonly readonly cd --verbose echo "$1" --verbose awk test
+		'quoted text' grep && export printf sed 2>/dev/null export done local
+	echo $(pwd) -eu awk printf "$@" "$1" readonly then local 2>/dev/null printf 2>/dev/null
+		"$1" "$@" "$1" test -eu then echo "$@" readonly 2>/dev/null 'quoted text'
+echo -eu grep 2>/dev/null "$@" readonly local $(pwd) "$1" local done
+	then readonly printf local grep done $(pwd) "$@" then then 2>/dev/null
+cd then $(pwd) awk -eu /usr/bin
+		grep --verbose export grep
+x=1 "$1" echo awk $(pwd) ${HOME} readonly x=1 readonly $(pwd)
+&& done sed 'quoted text' $(pwd) --verbose
+	--verbose x=1 "$@" "$@" | 2>/dev/null cd
+	sed 'quoted text' $(pwd) readonly export
+	${HOME} -eu /usr/bin awk grep -eu done awk export -eu
+		| ${HOME} "$1" -eu readonly then 2>/dev/null
+| local 2>/dev/null -eu 'quoted text'
+	export | then local --verbose
+		${HOME} -eu /usr/bin readonly
+	${HOME} echo printf --verbose "$@" 'quoted text' "$1"
+		printf awk readonly test cd export then ${HOME} x=1 done awk
+		| echo echo 'quoted text' grep 'quoted text' sed
+	"$@" awk local 'quoted text' 2>/dev/null echo "$@" then 'quoted text'
+	| x=1 test done "$1" -eu awk ${HOME} "$@" awk && local readonly
+		$(pwd) grep "$@" printf sed -eu /usr/bin "$1" sed sed echo local
+	export cd ${HOME} sed /usr/bin $(pwd) export "$@" readonly export && export --verbose
+		/usr/bin 2>/dev/null test readonly 2>/dev/null printf awk $(pwd) |
+		-eu sed readonly /usr/bin -eu /usr/bin
+then 'quoted text' readonly 'quoted text' cd 'quoted text' cd $(pwd) "$@"
+	${HOME} printf x=1 "$@" --verbose
+		readonly grep printf printf x=1 cd then
+	awk 2>/dev/null | 'quoted text' then
+		local "$1" sed -eu printf then --verbose then
+		then 'quoted text' | $(pwd) done sed "$1" readonly grep 'quoted text'
+-eu 'quoted text' 'quoted text'
+/usr/bin x=1 /usr/bin 'quoted text'
+		-eu -eu --verbose awk cd -eu /usr/bin --verbose -eu cd -eu
+readonly test sed then --verbose
+		echo grep && cd "$@"
+awk readonly && $(pwd) && printf ${HOME} cd cd -eu export done /usr/bin test
+	printf grep readonly --verbose
+	"$1" export 2>/dev/null sed -eu grep grep ${HOME}
+"$@" sed grep x=1 export | 'quoted text'
+| sed "$1" -eu -eu "$1" export echo | x=1 printf
+	2>/dev/null cd $(pwd) && readonly printf
+	$(pwd) printf 2>/dev/null awk x=1 printf -eu
+		printf $(pwd) "$@" "$1" printf cd
+'quoted text' && | "$1" 2>/dev/null done grep export
+	/usr/bin printf awk $(pwd) 2>/dev/null ${HOME} cd
+${HOME} done echo && 2>/dev/null grep $(pwd)
+test | ${HOME} local sed 2>/dev/null awk awk &&
+		then 2>/dev/null ${HOME} export awk "$1" "$@"
+		grep local test && /usr/bin cd x=1 awk
+		| 2>/dev/null $(pwd) $(pwd) && cd "$@" | local x=1 | sed local --verbose
+sed --verbose $(pwd) grep local 'quoted text' 2>/dev/null 2>/dev/null 'quoted text'
+		awk sed -eu /usr/bin x=1 && | ${HOME} "$@" grep
+		'quoted text' printf $(pwd) awk done ${HOME} echo 2>/dev/null export
+	cd "$1" "$1" printf x=1 x=1 grep | echo 'quoted text' export | done &&
+		2>/dev/null ${HOME} $(pwd) printf local grep --verbose --verbose
+		&& x=1 test sed "$@" then -eu $(pwd) /usr/bin | awk sed sed && sed ${HOME}
+	--verbose done --verbose 2>/dev/null --verbose export export
+	done x=1 "$@" x=1 2>/dev/null local -eu $(pwd) 2>/dev/null --verbose 2>/dev/null
+		readonly x=1 sed "$@" test /usr/bin "$@" && grep "$1" -eu 2>/dev/null
+	printf && /usr/bin "$@" $(pwd) echo /usr/bin done echo then x=1 && "$1" 2>/dev/null
+	printf $(pwd) ${HOME} echo | -eu -eu "$1"
+${HOME} sed done local "$@"
+| --verbose && then 'quoted text'
+		local "$@" grep -eu x=1 "$@" grep test
+awk /usr/bin && awk done sed ${HOME} && done 2>/dev/null
+		"$1" 'quoted text' 'quoted text'
+	then -eu cd export 'quoted text'
+| "$@" "$@" readonly then cd local
+	done test echo && then
+	| /usr/bin echo test x=1 ${HOME} && printf "$@"
+		--verbose cd ${HOME} -eu
+		-eu 2>/dev/null sed export local 2>/dev/null
+2>/dev/null "$1" readonly awk | x=1 && test sed 2>/dev/null grep
+	'quoted text' echo local --verbose echo printf export --verbose 'quoted text' awk
+		awk local export echo x=1 readonly $(pwd) x=1 "$@" $(pwd)
+| 2>/dev/null readonly "$@" printf 2>/dev/null
+		done "$1" x=1 $(pwd) | /usr/bin | awk then && /usr/bin 'quoted text' x=1
+	'quoted text' "$@" && "$@" test 'quoted text' grep sed local sed
+		cd 'quoted text' --verbose readonly printf export "$@" "$@"
+--verbose $(pwd) export readonly readonly -eu awk x=1 ${HOME} echo
+sed printf done export local
+		x=1 "$@" && printf done /usr/bin local then | /usr/bin
+	cd sed printf "$@" /usr/bin && awk local -eu "$1" && done done done "$@" cd
+/usr/bin awk test $(pwd) | awk 2>/dev/null
+	--verbose awk /usr/bin | "$@" echo done /usr/bin
+	sed then grep then -eu cd "$1" printf readonly 'quoted text'
+		grep readonly x=1 local 'quoted text' "$@" && export test $(pwd) sed awk
+	grep $(pwd) local $(pwd) --verbose /usr/bin --verbose then 2>/dev/null
+local test 2>/dev/null "$@" cd cd
+	cd sed 'quoted text' test
+local cd echo then "$@" then "$1" export
+		then echo export echo $(pwd) 2>/dev/null awk printf 2>/dev/null
+	grep && grep then echo $(pwd) $(pwd) awk 2>/dev/null 'quoted text'
+	cd done then -eu "$1" then done cd 2>/dev/null --verbose sed --verbose
+		then ${HOME} readonly export $(pwd) grep awk && "$@"
+'quoted text' $(pwd) --verbose && /usr/bin /usr/bin printf echo --verbose
+awk test --verbose cd "$@"
+		done local 'quoted text' export -eu printf export
+	then ${HOME} readonly local readonly
+	readonly $(pwd) 'quoted text' -eu
+		done /usr/bin x=1 local "$@" test echo && echo x=1 "$@" sed done awk sed sed 'quoted text'
+"$1" done x=1 grep export cd awk "$1" -eu grep ${HOME}
+-eu 2>/dev/null done ${HOME} sed export cd sed ${HOME} 'quoted text' printf
+${HOME} /usr/bin /usr/bin --verbose
+	-eu readonly ${HOME} export --verbose ${HOME} grep printf x=1 export
+		| local awk $(pwd) x=1 | && "$1" awk then $(pwd) 'quoted text'
+${HOME} local echo local 2>/dev/null "$1" cd awk
+test export echo awk 2>/dev/null 2>/dev/null local && x=1 export
+	readonly --verbose printf
+		cd | "$1" | printf x=1 'quoted text' 'quoted text' | echo ${HOME}
+	| "$1" "$@" printf | ${HOME} export -eu sed | readonly local "$1" done
+		"$@" grep grep then local local test done "$1" && 'quoted text' then readonly
+readonly test 2>/dev/null "$@" grep then done x=1 | awk readonly --verbose
+	| | done export then -eu --verbose sed printf
+test --verbose test sed then "$@" test echo
+	"$@" --verbose && x=1 'quoted text' done grep
+	2>/dev/null /usr/bin local sed | cd | 2>/dev/null
+	printf sed grep 'quoted text' local /usr/bin && readonly $(pwd) "$1" test
+	local printf awk -eu x=1 test done $(pwd) "$1" "$@" done
+		| printf cd awk x=1 test cd -eu done echo grep then 'quoted text' awk 'quoted text'
+	&& printf cd x=1 "$@" readonly $(pwd) done && -eu
+		cd then | echo then "$1" export awk export x=1 "$1" test x=1 export "$1" "$1"
+printf local readonly export 'quoted text' /usr/bin local
+		-eu done x=1 && -eu printf test | -eu 2>/dev/null
+echo "$@" echo printf awk "$1" then
+		"$1" local && x=1 x=1 x=1 echo sed export grep
+--verbose then sed | export && test echo "$1" sed test "$1" 'quoted text' | /usr/bin
+		/usr/bin --verbose 'quoted text' sed
+		"$1" then grep && cd
+	local /usr/bin | cd && local /usr/bin $(pwd) sed test
+local cd then "$1" awk done
+${HOME} "$@" -eu export readonly --verbose "$1" echo then --verbose
+		export && grep | 2>/dev/null x=1 readonly
+/usr/bin "$1" | -eu -eu test -eu && && then 2>/dev/null
+		| "$1" grep then then echo printf | && local sed && readonly x=1 done
+	readonly ${HOME} 2>/dev/null done local sed echo grep --verbose "$@"
+	"$1" 2>/dev/null then done done export export
+		readonly export sed awk | test grep sed grep local grep sed
+done x=1 'quoted text' | && 'quoted text' /usr/bin done done
+	&& echo $(pwd) "$@" "$@" sed echo then ${HOME} done 2>/dev/null
+		export | && printf echo /usr/bin && then sed sed readonly --verbose x=1 /usr/bin
+${HOME} --verbose ${HOME}
+--verbose done sed readonly sed /usr/bin printf -eu 2>/dev/null
+then 2>/dev/null then then 'quoted text' "$1" --verbose test /usr/bin printf
+		'quoted text' test cd then 2>/dev/null /usr/bin
+"$1" sed x=1 printf awk x=1 -eu echo awk local echo awk "$@" sed |
+		export printf printf printf grep
+		${HOME} export grep ${HOME}
+sed "$@" 'quoted text' | local x=1 then
+	${HOME} awk cd export x=1 'quoted text' cd x=1 -eu && printf 2>/dev/null
+x=1 $(pwd) 2>/dev/null 'quoted text' awk test "$@" sed --verbose
+		/usr/bin grep -eu && local "$1" awk readonly local echo $(pwd) /usr/bin
+		--verbose /usr/bin grep printf awk done $(pwd) readonly $(pwd) -eu
+	${HOME} awk ${HOME} readonly done ${HOME} x=1 sed cd cd local awk
+"$1" done ${HOME} -eu ${HOME} printf ${HOME} export cd &&
+	export awk local -eu x=1 'quoted text' x=1 then &&
+awk done readonly -eu | $(pwd) ${HOME} "$@" test $(pwd)
+/usr/bin echo "$@" 2>/dev/null "$1" ${HOME} x=1
+done export /usr/bin --verbose cd 2>/dev/null echo "$@" export test
+		export local cd export "$@"
+/usr/bin cd export grep printf readonly done cd readonly printf printf
+--verbose test x=1 sed grep then awk "$1" grep && cd then then done test
+	done 'quoted text' sed grep --verbose
+		/usr/bin then x=1 x=1 x=1 export sed readonly ${HOME} readonly $(pwd) echo --verbose
+		echo then --verbose cd "$@" "$1" "$@" ${HOME} ${HOME} 'quoted text' "$1" "$@"
+		2>/dev/null --verbose sed -eu local printf readonly
+	done x=1 ${HOME} "$@" --verbose 'quoted text'
+&& x=1 sed && cd $(pwd) then -eu $(pwd) awk x=1 ${HOME} test awk grep done $(pwd)
+	local grep /usr/bin echo echo awk then
+	grep 'quoted text' $(pwd) sed
+		test cd local export -eu then
+	| printf 2>/dev/null sed "$@" | done "$1" then export awk "$1" x=1 awk
+		x=1 'quoted text' | && cd done ${HOME} readonly echo x=1 $(pwd) "$@" x=1 /usr/bin
+	export grep "$@" local /usr/bin
+'quoted text' "$1" "$@" grep grep done done ${HOME} /usr/bin -eu cd |
+grep ${HOME} "$1" echo "$1" 'quoted text' sed awk -eu /usr/bin
+	echo "$1" && 'quoted text' /usr/bin awk | ${HOME} cd
+		readonly "$1" "$@" && done export "$1" "$1" 'quoted text' awk
+		${HOME} 2>/dev/null readonly
+		test readonly printf awk $(pwd) local $(pwd) -eu x=1 /usr/bin readonly
+		"$1" grep test readonly "$@" $(pwd) 2>/dev/null
+	'quoted text' 2>/dev/null cd -eu readonly
+printf --verbose x=1 "$@" -eu printf export -eu -eu | local && local printf
+echo test awk test printf export export --verbose 2>/dev/null echo echo $(pwd)
+echo --verbose "$@" echo
+	--verbose -eu 2>/dev/null -eu sed $(pwd) | printf
+		/usr/bin 2>/dev/null |
+		2>/dev/null sed -eu local test printf $(pwd) grep then x=1
+	sed printf readonly readonly awk sed test printf grep 'quoted text'
+| | 'quoted text' /usr/bin export /usr/bin 'quoted text'
+test export 2>/dev/null grep ${HOME} /usr/bin ${HOME}
+${HOME} cd test then awk x=1 printf cd "$1" x=1 'quoted text'
+	grep ${HOME} 2>/dev/null grep 2>/dev/null /usr/bin printf
+awk export test 2>/dev/null "$1" export ${HOME}
+		awk then 2>/dev/null | -eu done cd "$@"
+2>/dev/null --verbose /usr/bin $(pwd) --verbose test "$@"
+		&& $(pwd) $(pwd) awk "$1" echo export sed "$1" local awk cd done 'quoted text'
+	export echo /usr/bin export -eu grep 2>/dev/null
+	grep 'quoted text' then -eu && "$1"
+	test $(pwd) && done awk && printf grep local x=1 printf
+-eu test 2>/dev/null && | "$1" 'quoted text' | cd test export
+	&& --verbose "$1" then /usr/bin /usr/bin local --verbose -eu awk ${HOME}
+	echo 2>/dev/null $(pwd) local "$@" done printf
+x=1 ${HOME} grep "$@" ${HOME}
+| printf 'quoted text' grep 2>/dev/null
+		| x=1 2>/dev/null then grep done grep done $(pwd) ${HOME} --verbose 'quoted text'
+		-eu local && done local | -eu 2>/dev/null | export readonly grep export $(pwd) /usr/bin
+		grep 2>/dev/null grep grep 2>/dev/null
+printf -eu -eu "$@" awk -eu --verbose
+		then x=1 "$1" export cd && 'quoted text' done ${HOME} 2>/dev/null
+		&& sed awk | export done readonly | | export then
+&& | export echo export 'quoted text' "$1" x=1 then 2>/dev/null ${HOME} $(pwd)
+then cd grep /usr/bin -eu awk "$1" | then cd 'quoted text' x=1 cd export
+	printf grep x=1 test then
+	&& && -eu awk $(pwd) "$@" echo "$@" sed then sed -eu export done ${HOME}
+		2>/dev/null grep ${HOME} export sed printf 'quoted text' export
+		${HOME} | export sed "$1" echo "$@" -eu ${HOME} "$1" cd local readonly
+		'quoted text' cd readonly -eu x=1 echo cd then /usr/bin "$1"
+	done then ${HOME} done sed --verbose printf 'quoted text' echo
+	echo /usr/bin cd local grep -eu awk
+test && 2>/dev/null x=1 readonly
+		sed readonly cd test $(pwd) cd grep done cd printf cd | test
+		local echo then ${HOME} printf 2>/dev/null --verbose $(pwd) 'quoted text' cd
+	sed done echo grep grep echo sed "$1" done $(pwd) --verbose
+	${HOME} "$@" 2>/dev/null 2>/dev/null /usr/bin
+		test /usr/bin awk --verbose cd
+	"$1" printf grep $(pwd)
+${HOME} awk --verbose 'quoted text' test | "$1"
+/usr/bin echo | done | done then 'quoted text' done "$1" --verbose then
+	sed --verbose awk cd $(pwd) && awk ${HOME} sed /usr/bin
+	"$@" printf "$@" echo -eu && -eu "$@" /usr/bin local
+&& x=1 printf -eu "$@" 2>/dev/null ${HOME} export 'quoted text'
+		"$@" sed printf echo printf done then test 'quoted text'
+		"$@" "$@" -eu | echo awk $(pwd) readonly local /usr/bin ${HOME} grep echo echo
+		echo echo -eu /usr/bin cd echo --verbose -eu 'quoted text' then readonly export
+	export --verbose "$1" local done 'quoted text'
+$(pwd) readonly awk /usr/bin
+		'quoted text' $(pwd) done local grep ${HOME} done x=1 local export
+"$@" 'quoted text' x=1 printf echo export printf export awk /usr/bin
+| test then "$1" grep "$1" export
+done | cd x=1 | local --verbose "$1" --verbose "$@"
+		"$1" grep && then $(pwd) ${HOME} "$@"
+	export "$1" readonly printf local 'quoted text'
+	done /usr/bin -eu --verbose /usr/bin test 2>/dev/null
+x=1 2>/dev/null 2>/dev/null sed echo "$1" "$1" grep local
+test $(pwd) "$1" $(pwd) && done 'quoted text'
+	printf readonly local $(pwd) local cd then "$@" 'quoted text' cd --verbose
+		| cd awk awk && "$@"
+$(pwd) sed 2>/dev/null then "$@" 'quoted text'
+&& echo local "$@" local "$1" test done printf grep --verbose "$@" 'quoted text'
+cd done "$@" ${HOME} test 2>/dev/null | $(pwd)
+2>/dev/null local 'quoted text' done printf then cd cd
+		-eu /usr/bin 'quoted text' grep readonly
+	awk sed echo grep --verbose 'quoted text'
+local echo "$1" -eu | -eu --verbose && sed "$1" x=1 /usr/bin x=1 export test
+		export 'quoted text' ${HOME} printf grep 'quoted text'
+'quoted text' | printf readonly readonly echo $(pwd) "$1" -eu
+	&& local --verbose | ${HOME}
+then /usr/bin --verbose then done "$@"
+echo grep 'quoted text'
+		"$@" /usr/bin $(pwd) cd
+		grep /usr/bin $(pwd) printf && -eu $(pwd) 'quoted text'
+		grep awk then cd readonly "$@" echo echo
+	test /usr/bin grep grep ${HOME} export grep done awk $(pwd)
+	then && cd test cd local "$@" --verbose | test -eu $(pwd) --verbose
+		| test export $(pwd) local $(pwd) awk -eu grep cd test "$1"
+2>/dev/null "$@" -eu grep cd /usr/bin
+echo grep && awk local echo
+--verbose 'quoted text' done done x=1 local grep -eu test
+		"$1" | --verbose export sed readonly 'quoted text' -eu
+	echo 2>/dev/null ${HOME}
+		readonly && printf done --verbose done printf ${HOME} "$1"
+		"$1" ${HOME} ${HOME} local "$@" 'quoted text' then /usr/bin
+then sed printf --verbose 'quoted text' $(pwd) export echo readonly "$1"
+		-eu done grep 2>/dev/null test printf --verbose readonly |
+then && /usr/bin sed readonly
+local done then | cd 2>/dev/null && ${HOME} then | done then printf ${HOME}
+	echo ${HOME} --verbose test x=1 | 2>/dev/null test readonly sed cd
+cd then export /usr/bin echo awk -eu -eu
+	$(pwd) "$1" 2>/dev/null test cd | -eu readonly
+$(pwd) /usr/bin -eu 2>/dev/null ${HOME} "$@"
+	$(pwd) /usr/bin local sed awk sed "$1" && ${HOME} 'quoted text'
+		readonly awk $(pwd) local -eu /usr/bin echo ${HOME} /usr/bin /usr/bin
+	readonly 2>/dev/null ${HOME} -eu "$1" test /usr/bin | local 2>/dev/null echo
+	| export awk $(pwd) "$@" echo | "$@" && ${HOME} /usr/bin done &&
+local 2>/dev/null test printf
+		-eu "$1" awk test then ${HOME}
+	export printf $(pwd) -eu $(pwd) readonly
+		'quoted text' readonly && cd echo --verbose
+	--verbose export cd ${HOME} local then 'quoted text' done "$1" then 'quoted text'
+	local awk test grep then sed "$@" test /usr/bin sed sed local export
+	| export done readonly "$1" "$@" cd | 2>/dev/null
+	then export echo && local x=1 readonly export readonly sed "$@" done local
+	then /usr/bin sed sed "$@" grep /usr/bin
+	test awk sed readonly printf export | export awk 2>/dev/null x=1
+| -eu | test x=1 | -eu test cd printf "$1" test cd 'quoted text'
+"$1" readonly test "$1" $(pwd) echo --verbose then done export
+	| $(pwd) then x=1 /usr/bin local
+		export echo local 2>/dev/null -eu -eu readonly local "$@" printf awk
+		2>/dev/null ${HOME} "$1" echo grep cd && export
+		"$@" echo test | ${HOME} local export "$1"
+	test $(pwd) --verbose -eu /usr/bin | local sed "$@"
+2>/dev/null then --verbose --verbose
+		2>/dev/null $(pwd) done --verbose "$1" then export
+		done "$@" sed $(pwd) 2>/dev/null export /usr/bin cd
+	export 'quoted text'
+printf && test printf local grep 'quoted text' then x=1 then local local "$@"
+awk 'quoted text' awk $(pwd)
+printf readonly then "$1" sed "$@" $(pwd) sed cd x=1 --verbose export printf
+		${HOME} echo local test printf done printf sed echo /usr/bin -eu
+		"$@" done readonly echo test "$@" ${HOME} "$@" $(pwd) $(pwd)
+		awk | grep ${HOME} x=1 && cd export -eu cd 2>/dev/null "$@" export
+	export x=1 ${HOME} cd
+--verbose printf awk local | sed
+grep ${HOME} awk "$@" 2>/dev/null
+cd done sed /usr/bin 2>/dev/null | 2>/dev/null then /usr/bin
+		2>/dev/null | awk && "$@" grep sed sed sed sed | 2>/dev/null "$1"
+local && --verbose x=1
+2>/dev/null 'quoted text' readonly export "$@" then echo then
+		--verbose ${HOME} export 2>/dev/null
+cd test "$1" export printf -eu | awk -eu then local "$1" "$1"
+awk x=1 grep /usr/bin printf local
+		/usr/bin "$@" 'quoted text' echo readonly
+	readonly 2>/dev/null readonly --verbose grep printf "$1"
+		| export test 2>/dev/null x=1
+| grep && echo sed x=1 sed export test -eu --verbose
+x=1 echo grep 'quoted text' done then $(pwd) printf ${HOME} "$@" then "$1" cd
+		--verbose local /usr/bin done test test done x=1 --verbose
+		done export export cd 2>/dev/null cd test
+		-eu 2>/dev/null /usr/bin local grep echo sed grep grep x=1 export
+export --verbose done echo done test test && awk
+	then 'quoted text' -eu "$@" /usr/bin
+	printf /usr/bin awk local && grep test
+'quoted text' ${HOME} export $(pwd) export &&
+		awk export export echo -eu /usr/bin printf x=1 done
+then -eu --verbose sed ${HOME}
+	printf awk /usr/bin -eu && $(pwd) grep $(pwd) $(pwd) readonly
+		readonly export && sed
+--verbose ${HOME} done ${HOME} && awk
+	printf 2>/dev/null printf && printf $(pwd) -eu
+'quoted text' /usr/bin /usr/bin x=1 -eu export readonly then
+export /usr/bin then grep sed 2>/dev/null sed echo "$1" "$1" --verbose sed
+	"$1" done readonly 'quoted text' awk /usr/bin $(pwd) 2>/dev/null
+		${HOME} sed done "$@" --verbose
+${HOME} x=1 echo -eu awk export printf local sed /usr/bin $(pwd) awk echo
+	printf 2>/dev/null 2>/dev/null 2>/dev/null --verbose /usr/bin | 'quoted text'
+		cd sed -eu --verbose x=1 "$1" sed sed "$@" && awk
+	'quoted text' then 2>/dev/null | local awk 'quoted text' readonly
+	grep readonly cd --verbose then grep grep done $(pwd) then $(pwd) -eu
+		$(pwd) local echo 'quoted text' "$1" then local then --verbose ${HOME}
+	export test echo local /usr/bin echo sed export -eu 'quoted text'
+	then 'quoted text' then 2>/dev/null then echo $(pwd) ${HOME} /usr/bin "$@" awk $(pwd)
+	printf export 'quoted text' export echo done && test
+		"$@" "$1" echo && -eu echo 2>/dev/null
+readonly then ${HOME} ${HOME} readonly
+		then | $(pwd) done -eu done
+		readonly | --verbose -eu done "$1" test test -eu cd /usr/bin
+		local cd readonly test cd &&
+	&& cd local cd done export x=1 x=1 printf 'quoted text' export done
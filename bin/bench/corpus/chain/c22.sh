@@ -0,0 +1,2001 @@
+	export 2>/dev/null --verbose grep echo grep local
+		export cd && done printf export | && -eu /usr/bin readonly test
+	/usr/bin test readonly 'quoted text' x=1 then export cd 'quoted text'
+		done -eu then /usr/bin | test export test x=1 echo | x=1 cd $(pwd) "$1" echo readonly
+		${HOME} /usr/bin 'quoted text' awk 2>/dev/null "$1"
+		then local "$1" -eu --verbose then
+	"$1" grep x=1 'quoted text' printf --verbose
+/usr/bin cd ${HOME} $(pwd) --verbose readonly then 'quoted text'
+	grep /usr/bin awk readonly |
+	cd x=1 done -eu 2>/dev/null
+		local local $(pwd) echo "$@" "$1" printf awk $(pwd) "$1"
+&& | ${HOME} "$1" then printf sed x=1 ${HOME} cd readonly ${HOME}
+readonly then then grep then readonly
+'quoted text' | then cd /usr/bin --verbose sed
+then ${HOME} "$@" "$1" -eu grep ${HOME} awk readonly test awk
+x=1 2>/dev/null "$@" printf 'quoted text' cd
+		export then 2>/dev/null | -eu 2>/dev/null 2>/dev/null then readonly "$1" "$1" /usr/bin
+then -eu echo --verbose | --verbose -eu 'quoted text' grep x=1 cd
+		cd local readonly printf export x=1
+	${HOME} "$@" test test -eu $(pwd) | 2>/dev/null x=1 "$@"
+grep && x=1 -eu cd -eu /usr/bin then then readonly -eu sed x=1 /usr/bin
+	sed 2>/dev/null $(pwd) "$1" 2>/dev/null /usr/bin
+		echo && && "$@" /usr/bin 2>/dev/null "$@" "$@" && && -eu done readonly
+		export printf --verbose -eu --verbose export readonly
+	${HOME} export export cd "$1" printf 2>/dev/null cd -eu sed --verbose --verbose
+${HOME} local export awk | ${HOME} echo awk grep local then grep local
+		${HOME} done "$@" readonly local echo cd test local | -eu ${HOME}
+		local readonly "$@" "$@" awk "$1" echo 'quoted text' ${HOME}
+		cd $(pwd) | /usr/bin local ${HOME} local then cd grep 2>/dev/null --verbose
+		cd echo sed echo -eu done 2>/dev/null | echo then 2>/dev/null local then done "$@"
+	&& local "$@" awk then
+echo local awk "$@" readonly cd --verbose ${HOME}
+	${HOME} "$1" && $(pwd) local done x=1 grep awk "$1" /usr/bin done "$1"
+		readonly echo readonly
+	'quoted text' export /usr/bin && 'quoted text' /usr/bin
+	printf then "$@" awk then ${HOME} test
+sed 2>/dev/null x=1 test grep 2>/dev/null sed $(pwd) && --verbose echo
+	x=1 then | grep export sed 'quoted text' --verbose then echo 'quoted text'
+	awk export && cd /usr/bin "$@" /usr/bin cd "$1" "$1" ${HOME} /usr/bin
+		test cd && readonly x=1 printf
+		-eu export sed sed 2>/dev/null sed 'quoted text' printf
+	export local done ${HOME} ${HOME}
+	| readonly "$1" 'quoted text' test x=1 x=1 done | "$@" 2>/dev/null
+	${HOME} "$1" 'quoted text' then "$@" | export printf | test && cd
+	/usr/bin 'quoted text' "$1" echo export x=1 -eu /usr/bin -eu
+	"$1" done then sed --verbose local done cd echo $(pwd)
+echo export cd 'quoted text' test printf 2>/dev/null
+	'quoted text' echo done | && --verbose export sed awk done 'quoted text'
+	'quoted text' readonly --verbose test -eu x=1 --verbose | && cd test readonly
+awk "$@" x=1 --verbose "$@"
+		| "$@" awk 2>/dev/null cd sed && done | /usr/bin | cd grep printf
+	echo test "$1" --verbose test 'quoted text'
+		test local readonly "$1" x=1 --verbose
+	readonly then "$1" 'quoted text' $(pwd) 'quoted text' grep /usr/bin printf
+sed printf export && sed --verbose local
+	2>/dev/null sed && local ${HOME}
+		2>/dev/null export cd | /usr/bin "$1" 2>/dev/null
+	| 2>/dev/null 2>/dev/null done "$1" | /usr/bin && $(pwd) local /usr/bin readonly
+echo export then sed cd $(pwd) grep export 'quoted text'
+	local --verbose -eu readonly "$@" "$1"
+'quoted text' "$1" /usr/bin done 2>/dev/null
+		--verbose | echo 'quoted text' export local
+	&& 2>/dev/null --verbose sed ${HOME} ${HOME}
+$(pwd) -eu sed awk then x=1
+	${HOME} grep | --verbose --verbose grep sed local
+	printf $(pwd) local export done -eu $(pwd) echo
+done awk "$1" printf export --verbose local $(pwd)
+	done --verbose printf sed sed "$@" 2>/dev/null
+	x=1 2>/dev/null 'quoted text'
+	grep printf | sed --verbose export x=1
+		-eu "$1" readonly && done test | 2>/dev/null x=1 x=1 /usr/bin
+	then /usr/bin /usr/bin echo
+local grep "$1" echo sed "$@" "$@" ${HOME} grep
+		2>/dev/null test x=1 echo test
+| ${HOME} grep | 2>/dev/null
+test "$@" 2>/dev/null echo -eu echo x=1 "$1" /usr/bin
+		&& --verbose -eu /usr/bin -eu -eu /usr/bin x=1 && "$1" -eu
+		sed 'quoted text' then cd 'quoted text' && awk grep echo printf
+	echo test /usr/bin sed sed |
+2>/dev/null export readonly /usr/bin "$@" --verbose -eu export && local done
+-eu ${HOME} test export printf
+		readonly sed readonly $(pwd) 2>/dev/null x=1
+export $(pwd) x=1 grep sed $(pwd) --verbose grep cd 'quoted text'
+	2>/dev/null -eu then export sed ${HOME} cd --verbose -eu
+export 'quoted text' then test $(pwd) 'quoted text'
+		| then export test 2>/dev/null && grep 'quoted text' then awk "$@" cd
+		printf --verbose sed /usr/bin grep readonly sed test sed
+	printf echo local readonly sed export then x=1 printf
+x=1 readonly echo -eu
+local printf then awk then -eu cd done $(pwd) "$@" --verbose $(pwd) /usr/bin printf
+		${HOME} cd echo local grep test sed awk 2>/dev/null --verbose ${HOME} 'quoted text'
+	2>/dev/null then test export
+test | --verbose export local x=1 echo && x=1 cd --verbose "$1" echo
+grep $(pwd) ${HOME} then 'quoted text' awk sed echo awk $(pwd)
+		2>/dev/null /usr/bin done "$1" echo export echo ${HOME} echo
+		awk local | ${HOME} ${HOME} done "$@"
+readonly -eu echo -eu cd readonly
+		$(pwd) then printf -eu "$@" grep export test echo awk echo
+"$@" grep printf local --verbose /usr/bin export /usr/bin
+	printf test && "$@" ${HOME} -eu /usr/bin
+"$1" 2>/dev/null readonly readonly printf 'quoted text'
+echo sed then -eu printf grep /usr/bin export done
+| | && /usr/bin ${HOME}
+"$1" done 'quoted text' sed
+	grep 2>/dev/null done "$1" done printf && printf -eu then
+		local "$1" "$@" "$@" && test readonly
+		echo ${HOME} && -eu x=1 cd
+then readonly then done export echo
+export awk /usr/bin printf x=1 --verbose "$@" "$@" x=1 local ${HOME} $(pwd)
+		&& ${HOME} cd local -eu
+&& 2>/dev/null "$1" "$1" ${HOME} cd "$1"
+		then ${HOME} | then export readonly grep cd 2>/dev/null $(pwd)
+		awk --verbose echo echo cd
+	done grep -eu ${HOME} sed export ${HOME} cd 'quoted text' 'quoted text'
+		readonly -eu awk "$1" then "$1" | readonly
+	awk sed local && export cd
+		sed "$1" ${HOME} readonly && x=1 && 'quoted text' readonly readonly "$1" sed
+		cd -eu --verbose 'quoted text'
+${HOME} cd sed test readonly grep "$@" echo | 'quoted text' "$1"
+	-eu $(pwd) $(pwd) printf "$@" sed 2>/dev/null
+	-eu -eu sed --verbose done
+2>/dev/null /usr/bin grep awk "$1" grep $(pwd)
+		echo grep --verbose ${HOME}
+local 2>/dev/null $(pwd) -eu --verbose
+readonly test local grep test --verbose echo "$1" 2>/dev/null sed --verbose
+		"$@" awk 'quoted text'
+	grep "$@" --verbose | 'quoted text' && echo ${HOME} test
+		done ${HOME} --verbose awk readonly ${HOME} $(pwd) test "$1"
+-eu test test test sed /usr/bin | export 'quoted text' printf -eu local
+		echo then export grep $(pwd) sed readonly --verbose
+		cd awk test "$@" 'quoted text' sed 'quoted text' echo echo | awk then grep $(pwd)
+	readonly readonly "$1" | readonly test sed | done -eu then 'quoted text'
+	--verbose x=1 -eu -eu readonly echo cd "$@" --verbose 'quoted text' readonly $(pwd)
+		'quoted text' echo -eu && "$1" -eu export "$@" --verbose awk "$1" 'quoted text'
+$(pwd) then --verbose printf export ${HOME}
+-eu ${HOME} 2>/dev/null x=1 echo
+'quoted text' "$1" awk
+		-eu /usr/bin "$1" --verbose sed | readonly
+	grep cd 'quoted text' cd --verbose x=1 cd cd export
+$(pwd) "$1" echo $(pwd) cd done test readonly then cd awk printf $(pwd) export
+	'quoted text' 'quoted text' done sed grep x=1 x=1 sed ${HOME}
+	test /usr/bin | done done test cd then ${HOME} awk "$@" done ${HOME} x=1 'quoted text'
+	$(pwd) && x=1 echo -eu grep "$1" $(pwd)
+	"$1" 'quoted text' -eu /usr/bin ${HOME} then echo
+	cd 'quoted text' $(pwd) printf awk 2>/dev/null readonly /usr/bin readonly
+		export done x=1 export | sed /usr/bin
+		readonly printf x=1 awk ${HOME} --verbose grep sed grep &&
+/usr/bin ${HOME} | awk test
+	| echo $(pwd) --verbose sed cd 'quoted text' test then "$1" cd
+then x=1 --verbose 2>/dev/null printf /usr/bin "$@" | 'quoted text' echo
+	echo "$1" echo --verbose grep 2>/dev/null
+		test cd test done local test grep export printf && 'quoted text'
+		-eu --verbose cd done /usr/bin -eu sed && x=1 --verbose cd then "$1" &&
+cd awk ${HOME} then readonly --verbose sed then test "$@" -eu
+cd local printf $(pwd) export done
+test $(pwd) "$1" 'quoted text' readonly -eu ${HOME} 2>/dev/null
+sed "$1" && $(pwd) 2>/dev/null && | awk awk "$@" grep "$1" "$@" -eu && readonly
+	export awk test local cd 'quoted text' awk "$1" /usr/bin grep
+x=1 cd echo /usr/bin printf printf
+	cd "$@" then done echo | sed && --verbose && 'quoted text' 'quoted text' done
+		local export ${HOME} done "$@" awk cd --verbose grep echo export export then
+local --verbose /usr/bin printf
+	2>/dev/null "$1" then done test grep /usr/bin cd test cd $(pwd) x=1 test | grep
+	done done $(pwd) | "$1" ${HOME} 2>/dev/null test printf "$@"
+		&& x=1 sed then cd x=1 "$1" done printf then ${HOME} /usr/bin
+		--verbose "$1" local "$@" 'quoted text'
+2>/dev/null x=1 grep grep "$@" echo x=1 local echo local
+'quoted text' x=1 grep grep "$1" local x=1 'quoted text'
+	local ${HOME} sed 'quoted text' then -eu cd 2>/dev/null "$@" $(pwd)
+		"$1" -eu cd /usr/bin cd 'quoted text' 'quoted text'
+		--verbose printf readonly local
+		-eu /usr/bin 'quoted text'
+--verbose 2>/dev/null readonly then readonly -eu ${HOME} /usr/bin
+	test test printf -eu cd
+	test /usr/bin readonly test test
+	/usr/bin done --verbose ${HOME} "$@"
+sed x=1 sed -eu readonly local grep -eu
+		then readonly export local grep
+printf echo grep cd $(pwd) --verbose cd grep x=1 readonly 2>/dev/null
+'quoted text' local | then echo "$1" "$@" sed && then ${HOME} export && then
+	cd then done "$1" grep && awk /usr/bin test 'quoted text' /usr/bin
+	sed awk test cd local echo x=1 printf
+		x=1 && ${HOME} grep $(pwd) awk readonly
+then ${HOME} /usr/bin && done printf -eu local echo done --verbose | test grep
+"$1" readonly cd 2>/dev/null done local awk ${HOME} --verbose
+done 'quoted text' printf $(pwd) "$1"
+	sed /usr/bin && export | export | export test test cd echo | ${HOME}
+		$(pwd) then sed awk "$@" "$1" "$1" "$@" x=1 x=1 cd $(pwd) echo -eu
+sed 2>/dev/null grep -eu 2>/dev/null "$1" 'quoted text'
+		printf test then test /usr/bin grep local printf done
+	$(pwd) done --verbose | sed grep awk printf
+test 2>/dev/null /usr/bin grep
+| 'quoted text' echo echo sed ${HOME} sed 'quoted text' sed local grep printf
+	grep cd && echo $(pwd) export cd sed 'quoted text'
+	-eu then /usr/bin done done /usr/bin printf && ${HOME} cd printf --verbose $(pwd)
+/usr/bin | 2>/dev/null $(pwd) "$@" echo x=1 "$@" 2>/dev/null
+done echo grep grep awk awk then then ${HOME} "$@" "$@" test x=1
+		${HOME} "$1" /usr/bin awk sed echo done ${HOME} 'quoted text' cd
+		then x=1 && readonly done "$1" echo done then $(pwd) "$@" "$1" test
+		'quoted text' --verbose "$1" readonly -eu "$1" "$1" printf done x=1 test $(pwd)
+	/usr/bin grep | | awk echo done -eu "$@" echo $(pwd) grep ${HOME}
+x=1 "$1" --verbose && cd 'quoted text' readonly | $(pwd) test test $(pwd) printf
+	awk 'quoted text' x=1 /usr/bin /usr/bin awk sed "$1" printf $(pwd) | -eu
+	$(pwd) | 'quoted text' cd test sed
+done | && "$@" --verbose then 2>/dev/null test "$1" export readonly
+		&& export && sed -eu 2>/dev/null $(pwd) awk export
+	then sed 2>/dev/null
+sed local -eu | 2>/dev/null 2>/dev/null
+	cd printf sed done cd test awk -eu done then awk x=1 echo done x=1 "$1"
+readonly export test grep grep && 'quoted text'
+2>/dev/null ${HOME} --verbose /usr/bin test test x=1 -eu 2>/dev/null
+	done 2>/dev/null printf local $(pwd)
+		awk printf -eu readonly $(pwd) readonly --verbose sed test $(pwd) then /usr/bin
+		sed awk test grep cd echo local /usr/bin --verbose then
+	${HOME} x=1 $(pwd) --verbose
+		awk "$@" cd x=1 sed echo "$@" then readonly x=1 | x=1 &&
+		2>/dev/null /usr/bin "$@" grep && /usr/bin then
+	"$@" && -eu 'quoted text' /usr/bin grep
+	x=1 && sed /usr/bin echo then grep "$1" x=1 test export
+	done done x=1 done --verbose ${HOME} sed 'quoted text'
+then | 2>/dev/null -eu $(pwd)
+	awk -eu sed x=1 local
+test done "$@" grep ${HOME} sed | && done
+"$1" export cd -eu && grep local 2>/dev/null local echo ${HOME}
+-eu $(pwd) local readonly 'quoted text'
+		/usr/bin test ${HOME} cd && ${HOME}
+	local 2>/dev/null export readonly sed
+	local readonly && cd
+	test echo grep local grep then "$1" echo export --verbose
+	/usr/bin then "$1" done done --verbose -eu then "$@" awk printf
+		$(pwd) cd -eu sed export printf | 2>/dev/null
+	readonly readonly readonly 'quoted text'
+	cd printf | --verbose -eu && local 2>/dev/null
+		echo && ${HOME} && --verbose awk 'quoted text' local 2>/dev/null -eu 'quoted text'
+--verbose local local 'quoted text' $(pwd)
+	done printf printf then ${HOME} "$@" cd export readonly local
+	sed local echo "$@" done $(pwd) | -eu test -eu printf && --verbose echo
+		| awk export then 'quoted text' grep /usr/bin ${HOME}
+	x=1 /usr/bin x=1 'quoted text'
+		| -eu /usr/bin | | grep
+local 'quoted text' local test && local 'quoted text'
+	2>/dev/null "$@" cd "$1" "$@" printf awk echo then 2>/dev/null
+		"$@" "$1" -eu && done awk -eu /usr/bin sed --verbose
+		local awk 'quoted text' x=1 /usr/bin "$@" readonly && "$@" x=1
+	test local cd ${HOME} test local | x=1 /usr/bin /usr/bin "$1" 2>/dev/null
+		| ${HOME} test -eu cd readonly 'quoted text'
+		echo done grep readonly x=1 | test ${HOME} echo && export "$@" --verbose
+&& x=1 cd awk grep 'quoted text' ${HOME} /usr/bin
+export sed readonly 'quoted text' grep
+		test echo x=1 printf "$1" done readonly && --verbose x=1 done awk echo
+	test done sed x=1 test
+	echo "$@" /usr/bin --verbose grep printf readonly -eu --verbose 'quoted text'
+2>/dev/null && 2>/dev/null x=1 --verbose done then cd | cd done sed done 2>/dev/null
+	printf local echo then grep "$1"
+${HOME} printf 2>/dev/null local done
+		| then $(pwd) echo cd /usr/bin grep
+		awk $(pwd) /usr/bin sed ${HOME} | echo "$1" readonly 2>/dev/null echo export test
+	$(pwd) then --verbose && local --verbose x=1 sed x=1 "$1" echo
+grep echo then "$1" /usr/bin "$@" done
+	done "$1" then 2>/dev/null printf && $(pwd)
+local -eu "$@" && done readonly x=1 &&
+		"$1" && then printf awk local grep | -eu test
+2>/dev/null ${HOME} test export && 2>/dev/null 2>/dev/null done export
+		grep --verbose x=1 cd x=1 printf ${HOME} done done x=1 2>/dev/null
+	${HOME} test test 2>/dev/null x=1 then -eu 'quoted text' done 'quoted text'
+		"$@" ${HOME} done grep printf -eu x=1 &&
+		&& 2>/dev/null 2>/dev/null export local $(pwd)
+	| $(pwd) x=1 grep readonly --verbose sed readonly
+local x=1 /usr/bin | then export 2>/dev/null 2>/dev/null
+		cd local /usr/bin | "$@"
+		done | $(pwd) export --verbose readonly --verbose
+${HOME} "$@" 2>/dev/null /usr/bin |
+		&& --verbose awk test cd local "$@" done x=1 ${HOME} $(pwd)
+	/usr/bin 'quoted text' x=1 done
+		${HOME} test "$@" "$1" done $(pwd) awk cd done
+		x=1 /usr/bin /usr/bin printf "$1" awk readonly sed
+| then ${HOME} "$@" $(pwd) | cd -eu /usr/bin
+	awk then $(pwd) ${HOME} grep 2>/dev/null $(pwd) done sed ${HOME} cd readonly
+		"$@" --verbose awk cd done "$@" "$1" readonly readonly --verbose
+		printf readonly "$@" cd | then | 2>/dev/null test
+echo 'quoted text' test printf 'quoted text' 'quoted text' ${HOME}
+2>/dev/null local x=1 sed cd 2>/dev/null "$@" -eu /usr/bin
+		/usr/bin --verbose done printf done grep test "$1"
+	/usr/bin export local export 'quoted text'
+--verbose then local
+echo sed test done sed -eu echo done awk printf && 'quoted text' |
+	/usr/bin export -eu /usr/bin x=1 test printf grep 2>/dev/null
+	"$@" --verbose printf awk 'quoted text'
+	2>/dev/null awk local "$@" export /usr/bin ${HOME} && $(pwd) awk then 2>/dev/null
+	readonly readonly test then printf
+		"$1" readonly readonly "$@" grep 'quoted text'
+x=1 /usr/bin grep sed then
+		2>/dev/null done /usr/bin test && ${HOME} ${HOME} test test $(pwd) sed cd
+		printf x=1 x=1 cd --verbose -eu local echo x=1 'quoted text' then
+	sed export sed readonly $(pwd) sed ${HOME}
+	readonly local sed cd local x=1 done | done 2>/dev/null 'quoted text' 'quoted text'
+	$(pwd) export echo grep readonly awk 2>/dev/null
+		$(pwd) /usr/bin --verbose cd 2>/dev/null | cd echo
+grep "$1" export cd && grep local then echo
+		--verbose printf 'quoted text'
+-eu "$1" 2>/dev/null 'quoted text' $(pwd) 'quoted text' awk && | export
+		printf $(pwd) sed $(pwd) cd "$1"
+		2>/dev/null | export $(pwd) awk
+	readonly ${HOME} 2>/dev/null grep --verbose 'quoted text' cd printf
+grep cd echo grep "$1"
+done 2>/dev/null | && "$1"
+printf "$1" export readonly && 2>/dev/null /usr/bin --verbose "$@" --verbose local
+	"$@" | then /usr/bin -eu --verbose ${HOME} test echo
+	$(pwd) test 2>/dev/null &&
+	--verbose grep | && printf
+	/usr/bin -eu printf cd then then "$1" local
+		"$@" && x=1 cd | /usr/bin then grep 'quoted text' "$1" x=1 awk
+		-eu done export then 'quoted text' readonly
+	awk cd sed && sed && 2>/dev/null
+		--verbose && cd "$@" "$@"
+awk "$1" done done "$@" cd ${HOME} cd /usr/bin
+		sed export 2>/dev/null then
+'quoted text' test 2>/dev/null "$@" echo
+		"$1" && /usr/bin done cd && 2>/dev/null
+		2>/dev/null /usr/bin "$1" export --verbose done
+then && then awk sed $(pwd) x=1
+		$(pwd) awk local awk /usr/bin
+$(pwd) ${HOME} "$1" 2>/dev/null then awk grep sed
+| --verbose $(pwd) done sed
+awk "$@" x=1 && awk sed
+"$1" x=1 sed grep printf then $(pwd) ${HOME} export
+		--verbose test grep 2>/dev/null
+echo $(pwd) "$1" grep -eu export awk cd
+		${HOME} done 'quoted text' 2>/dev/null local echo grep "$1" x=1 grep sed done
+	export sed test local sed done $(pwd)
+		test $(pwd) 'quoted text' echo local local && $(pwd) printf echo && local
+	sed done readonly local ${HOME}
+		&& /usr/bin 2>/dev/null 2>/dev/null
+echo export 2>/dev/null readonly then | "$1" printf x=1 grep printf export "$1"
+x=1 --verbose done then grep "$@" sed sed --verbose export | readonly done --verbose
+	"$@" echo /usr/bin echo
+&& awk /usr/bin cd 2>/dev/null x=1 then then then
+		grep && | then --verbose echo grep grep ${HOME} 2>/dev/null x=1 --verbose
+	cd "$@" awk "$1" then
+		&& | 2>/dev/null "$1"
+	readonly printf echo sed "$@" grep --verbose export
+		cd test x=1 /usr/bin "$@" x=1 then then readonly done
+		echo echo $(pwd) && x=1 'quoted text'
+2>/dev/null -eu /usr/bin $(pwd) 'quoted text' grep echo
+	then cd cd printf local printf $(pwd) sed x=1 "$1" export
+	"$@" awk export printf echo local
+	| echo echo $(pwd) then 'quoted text'
+	grep done printf cd cd --verbose
+	2>/dev/null sed --verbose
+		--verbose test "$@" "$1" grep test 2>/dev/null
+"$1" 2>/dev/null done 'quoted text' then ${HOME} && echo
+		--verbose done printf then | echo done ${HOME}
+sed /usr/bin then "$1" echo x=1 x=1 x=1 "$1" ${HOME} printf
+		grep $(pwd) $(pwd) | x=1 --verbose x=1 echo 2>/dev/null
+readonly ${HOME} --verbose
+export "$1" done && --verbose local test then awk grep sed "$@" local && awk export
+/usr/bin 2>/dev/null test 'quoted text' -eu && done -eu readonly printf printf
+	&& test cd && done grep && --verbose
+sed printf -eu x=1 cd --verbose done echo /usr/bin local printf readonly echo
+echo ${HOME} x=1 awk awk "$1" printf /usr/bin "$1" local awk printf readonly
+		done && --verbose readonly then /usr/bin printf grep
+	export x=1 readonly done | && ${HOME}
+	done 'quoted text' 'quoted text' local done 2>/dev/null
+		/usr/bin 2>/dev/null 'quoted text' 2>/dev/null
+export readonly && x=1 | "$1" 2>/dev/null
+		printf $(pwd) echo awk local --verbose
+	export echo done sed echo echo readonly export awk local -eu
+		--verbose /usr/bin local then ${HOME} done export /usr/bin echo "$1" ${HOME}
+local done sed "$@" printf export x=1 /usr/bin then x=1
+	${HOME} printf | 2>/dev/null done -eu | 'quoted text'
+	-eu then done local test sed /usr/bin
+2>/dev/null grep done && /usr/bin && && -eu local awk test
+		'quoted text' echo sed && local export grep /usr/bin
+	-eu grep awk "$1" 2>/dev/null
+	local ${HOME} echo ${HOME} -eu /usr/bin
+		/usr/bin && awk then echo /usr/bin ${HOME} test printf | ${HOME}
+	$(pwd) /usr/bin done 'quoted text' done local export && grep
+${HOME} grep echo -eu "$1" echo local
+	awk | 'quoted text' cd test -eu echo &&
+/usr/bin sed "$@" done
+		grep echo "$1" echo "$1" | export grep $(pwd) /usr/bin cd "$@"
+x=1 "$@" $(pwd) x=1 export -eu 2>/dev/null readonly then 2>/dev/null ${HOME} cd
+	done export cd test sed awk /usr/bin /usr/bin /usr/bin done printf
+	2>/dev/null local && $(pwd) 'quoted text' grep
+2>/dev/null x=1 cd then local && sed printf readonly
+		then 'quoted text' ${HOME} test readonly test /usr/bin
+test printf echo awk "$1" /usr/bin grep && test test local "$1" done
+-eu | "$1" /usr/bin | then ${HOME}
+	/usr/bin -eu | "$1" readonly "$1" x=1 | "$1" printf 2>/dev/null done then
+2>/dev/null $(pwd) echo sed readonly ${HOME}
+"$1" test export | $(pwd) /usr/bin export | ${HOME} grep awk
+		cd x=1 $(pwd) 'quoted text' test --verbose
+test printf && awk then 'quoted text' test && local
+		"$@" ${HOME} | /usr/bin echo "$1" && readonly && "$@" cd "$@" --verbose 2>/dev/null
+		grep done -eu printf && sed ${HOME} done $(pwd)
+		/usr/bin echo 'quoted text'
+cd done ${HOME} cd test local readonly
+		done then cd 2>/dev/null "$1"
+		$(pwd) printf 2>/dev/null then -eu && --verbose
+	2>/dev/null 'quoted text' 'quoted text' $(pwd) ${HOME} printf "$@" -eu done export
+grep test -eu 'quoted text' $(pwd) test 'quoted text' grep --verbose sed $(pwd)
+	$(pwd) /usr/bin /usr/bin awk readonly printf $(pwd) x=1 test then readonly $(pwd)
+	| cd readonly cd echo --verbose -eu ${HOME} --verbose
+		| "$@" x=1 --verbose local "$@" grep && 2>/dev/null 'quoted text' &&
+	$(pwd) done sed /usr/bin 'quoted text'
+grep awk sed -eu "$1" 2>/dev/null
+done "$@" cd done $(pwd) 2>/dev/null ${HOME} sed
+	test -eu local "$1" $(pwd) printf then && --verbose $(pwd) 'quoted text'
+	export "$1" "$@" | export && /usr/bin local
+	--verbose --verbose 'quoted text'
+		--verbose readonly echo -eu "$1" 2>/dev/null | then
+		2>/dev/null x=1 x=1 "$@"
+		test -eu printf sed -eu x=1 ${HOME} $(pwd) export awk
+		done cd grep -eu readonly $(pwd) test "$1" 'quoted text'
+	${HOME} export 'quoted text' local local "$@" -eu done "$1" export readonly
+	/usr/bin /usr/bin -eu && --verbose done "$@" done "$@" ${HOME} cd --verbose printf
+-eu local "$@" "$1" cd awk local ${HOME} && awk | sed awk test
+| cd | done --verbose sed done test done readonly 'quoted text'
+	&& cd awk -eu "$1" echo ${HOME} 'quoted text' ${HOME} x=1 x=1 ${HOME}
+		x=1 --verbose grep awk 'quoted text' 2>/dev/null cd 2>/dev/null
+		sed /usr/bin | x=1 readonly 2>/dev/null x=1 $(pwd) grep 2>/dev/null
+	-eu 2>/dev/null then 'quoted text'
+sed done "$@" test && x=1 export cd && then x=1
+		done local 'quoted text' --verbose export $(pwd) --verbose ${HOME} grep --verbose
+awk cd sed "$1" 2>/dev/null | printf -eu | test export "$1" ${HOME}
+	sed x=1 local export then awk grep /usr/bin then awk test "$@" --verbose done awk
+2>/dev/null readonly 'quoted text'
+	"$@" 2>/dev/null done /usr/bin
+	readonly 'quoted text' done $(pwd) readonly
+		2>/dev/null done cd readonly
+2>/dev/null local awk "$1" echo cd cd && -eu sed "$1" -eu /usr/bin
+	printf cd sed | local then "$@" x=1 cd "$1" sed
+	/usr/bin && 2>/dev/null then
+-eu grep 'quoted text'
+'quoted text' printf $(pwd) $(pwd) && awk
+		echo grep | /usr/bin done /usr/bin
+	$(pwd) x=1 /usr/bin local awk && "$1" grep export then sed 2>/dev/null
+	${HOME} cd -eu x=1 /usr/bin /usr/bin local
+--verbose x=1 "$@" echo
+		export -eu export printf
+$(pwd) | ${HOME} printf export | cd local awk
+	-eu | grep 2>/dev/null local printf 2>/dev/null local cd /usr/bin -eu export
+	x=1 echo cd "$1" test
+		test readonly echo awk awk 'quoted text'
+	export x=1 && grep done
+echo --verbose && echo grep "$1" --verbose printf "$@" -eu printf grep export
+&& cd -eu --verbose /usr/bin then
+	then $(pwd) "$@" && 2>/dev/null local --verbose printf 2>/dev/null ${HOME}
+		cd 'quoted text' sed /usr/bin --verbose export 'quoted text' done -eu | "$1"
+		grep /usr/bin export readonly cd test
+	local done "$1" ${HOME} sed 2>/dev/null cd cd sed /usr/bin
+sed 'quoted text' grep sed "$1" x=1 $(pwd)
+		${HOME} readonly && done then then awk /usr/bin echo x=1 echo cd cd awk
+		/usr/bin -eu && | cd ${HOME} readonly test done | printf
+		then local --verbose /usr/bin "$@" test test then 2>/dev/null then export 'quoted text'
+test then awk $(pwd) printf awk grep sed "$@" | "$@" | $(pwd) 'quoted text'
+	echo 2>/dev/null 2>/dev/null --verbose sed export
+'quoted text' done echo ${HOME} printf 2>/dev/null local printf
+		sed cd then "$1" && local printf awk echo --verbose local
+		then /usr/bin awk /usr/bin $(pwd) &&
+-eu sed -eu awk done test test -eu $(pwd) 'quoted text'
+local /usr/bin "$1" 'quoted text'
+"$@" test | echo readonly test cd x=1 awk export 2>/dev/null echo
+	"$@" local $(pwd) printf readonly local awk /usr/bin 'quoted text' -eu "$@" export
+	echo readonly "$1" "$@" x=1 sed
+/usr/bin -eu awk echo 2>/dev/null ${HOME} then "$@"
+	$(pwd) -eu local -eu local then export printf 2>/dev/null export "$1" cd $(pwd)
+grep done awk 2>/dev/null 2>/dev/null ${HOME} sed cd x=1 export /usr/bin
+	-eu awk -eu readonly awk printf x=1
+		${HOME} ${HOME} printf $(pwd) x=1 awk done x=1 ${HOME} sed sed $(pwd) then awk
+-eu $(pwd) test done | && 2>/dev/null printf cd export
+	&& echo "$1" local sed awk /usr/bin
+	echo cd 'quoted text' 'quoted text' sed local then
+	'quoted text' && awk "$@" "$@" | echo done "$@"
+		then sed -eu then 'quoted text' /usr/bin $(pwd) 2>/dev/null $(pwd) test
+		x=1 cd /usr/bin awk 'quoted text'
+	printf 'quoted text' "$1" --verbose -eu echo "$1" | 'quoted text' printf /usr/bin
+		local $(pwd) | grep test ${HOME} $(pwd) 2>/dev/null x=1
+sed /usr/bin done grep ${HOME} echo | /usr/bin export --verbose
+echo 2>/dev/null printf printf test --verbose | 'quoted text' /usr/bin
+		2>/dev/null sed cd sed ${HOME} test local "$@" done done echo 'quoted text'
+$(pwd) readonly then -eu grep | readonly --verbose | && $(pwd) -eu x=1 /usr/bin
+		&& -eu x=1 done echo "$@" awk local cd done "$@" test cd 'quoted text' local
+-eu "$1" $(pwd) export cd 2>/dev/null awk && printf | echo test /usr/bin
+	export --verbose then done readonly
+		/usr/bin local ${HOME} printf --verbose $(pwd) test "$1" "$1" export
+cd printf | ${HOME} cd "$@" done "$@" x=1 done "$1" $(pwd)
+		| sed "$@" 'quoted text' grep echo cd $(pwd) 2>/dev/null ${HOME} | grep && echo
+		2>/dev/null local "$@" grep | "$@" /usr/bin done $(pwd) local grep ${HOME} export
+		readonly cd printf sed /usr/bin x=1 "$1"
+		x=1 -eu export echo test "$1" readonly | awk done /usr/bin local test
+		${HOME} cd "$1" sed awk done done
+done "$1" printf --verbose cd sed
+2>/dev/null readonly awk
+then --verbose test readonly export readonly x=1 2>/dev/null
+awk x=1 -eu printf awk cd readonly then 2>/dev/null
+		'quoted text' "$1" then 'quoted text' "$1" "$1" && 'quoted text' ${HOME}
+		--verbose 2>/dev/null done /usr/bin "$1" done
+	$(pwd) printf echo x=1 export
+	| -eu 2>/dev/null x=1 grep $(pwd) | 'quoted text' | 2>/dev/null local
+	done "$@" then readonly sed sed ${HOME} grep $(pwd)
+&& printf $(pwd) awk echo echo readonly then -eu sed cd cd | test
+printf export $(pwd) $(pwd) --verbose && local awk "$@" cd
+		local readonly && -eu export awk cd awk 2>/dev/null
+x=1 grep /usr/bin printf 2>/dev/null then sed done
+		/usr/bin /usr/bin grep "$@" "$1" sed x=1
+&& export test "$@" sed then then test --verbose sed && /usr/bin done
+		2>/dev/null 'quoted text' x=1 export --verbose $(pwd) ${HOME} x=1 "$1" /usr/bin
+		--verbose && sed test -eu done x=1 cd local local "$@" -eu
+"$@" 2>/dev/null --verbose $(pwd) --verbose awk
+		-eu cd 2>/dev/null cd /usr/bin && echo readonly | 2>/dev/null
+	&& "$1" then local grep grep -eu && "$@" printf 'quoted text' 2>/dev/null 'quoted text'
+/usr/bin printf grep $(pwd)
+$(pwd) grep then cd local echo grep cd readonly x=1 then -eu then $(pwd)
+	done "$1" export --verbose
+	export done cd sed grep
+		"$@" sed && done printf
+test echo "$@" -eu 2>/dev/null $(pwd) awk "$1" cd printf 2>/dev/null | $(pwd)
+	'quoted text' /usr/bin 2>/dev/null export sed sed ${HOME}
+echo x=1 local $(pwd) "$@" echo --verbose then readonly
+-eu readonly readonly "$@" printf then -eu export /usr/bin then awk readonly
+		done "$1" cd grep | | then sed 'quoted text' $(pwd) echo done cd awk
+&& grep readonly ${HOME} local awk readonly local done -eu "$@" awk echo
+		test local "$@" export cd local local
+'quoted text' && | printf && grep done -eu grep /usr/bin 'quoted text' printf 2>/dev/null
+		'quoted text' cd awk $(pwd) 2>/dev/null
+	awk "$1" local printf
+		${HOME} x=1 sed --verbose printf $(pwd) sed /usr/bin local local "$@" then
+grep done && && echo echo "$1" cd echo /usr/bin export
+/usr/bin "$@" sed --verbose 2>/dev/null sed ${HOME}
+	-eu /usr/bin "$@" awk grep "$@" done | "$1" done "$@" --verbose export
+	local echo 'quoted text' -eu export
+printf "$1" --verbose | "$@" awk then echo cd
+printf echo --verbose echo "$@" x=1
+	${HOME} x=1 cd then grep
+&& cd x=1 printf readonly local /usr/bin printf && "$1" --verbose test awk 2>/dev/null
+test printf test export
+	2>/dev/null echo then test 'quoted text' then 'quoted text' 'quoted text' ${HOME}
+test "$1" awk /usr/bin test done && cd
+	echo test cd grep test sed x=1 test export export local $(pwd) local
+${HOME} local && done
+		then && --verbose --verbose
+		grep sed --verbose 'quoted text' 2>/dev/null cd /usr/bin export test
+'quoted text' cd export 'quoted text'
+grep /usr/bin -eu 'quoted text' | sed | 2>/dev/null
+		local echo export echo printf printf done
+printf cd -eu then --verbose | 'quoted text' done sed echo | readonly
+		-eu then /usr/bin && local /usr/bin grep grep sed --verbose "$1" -eu local
+	--verbose x=1 echo test cd && export "$@" && awk awk then local
+		local -eu ${HOME} "$1" printf $(pwd) readonly
+	grep --verbose grep readonly
+then x=1 "$@" readonly test sed done grep "$@" local
+	x=1 ${HOME} --verbose $(pwd) awk echo cd
+		cd x=1 done "$1" printf -eu awk grep export | | printf awk
+		then "$@" cd ${HOME} echo export
+		printf 'quoted text' readonly --verbose
+	awk "$@" sed ${HOME}
+cd export then done 'quoted text' test
+	grep x=1 --verbose local export 2>/dev/null export awk x=1 "$@" -eu
+sed ${HOME} test "$@" echo $(pwd) | echo echo readonly
+		&& done export local ${HOME} awk export && -eu cd
+		| then local /usr/bin cd "$@" then &&
+-eu local $(pwd) && readonly
+| /usr/bin export echo
+	x=1 awk -eu readonly printf echo done $(pwd) export /usr/bin
+local export done "$@" readonly "$1" $(pwd) "$1" 'quoted text'
+then ${HOME} then grep "$1" "$1"
+	2>/dev/null -eu sed | $(pwd) export echo then --verbose $(pwd) "$@" 'quoted text'
+then --verbose echo ${HOME} 'quoted text' sed
+		awk x=1 echo readonly local $(pwd) "$@" "$@" "$@" x=1 | $(pwd) && "$1"
+	/usr/bin then --verbose "$1" awk ${HOME}
+sed then awk /usr/bin --verbose |
+	cd /usr/bin cd grep local $(pwd) ${HOME} echo --verbose 2>/dev/null
+$(pwd) "$1" echo --verbose readonly | x=1 test export local
+	"$@" grep awk $(pwd) -eu /usr/bin && readonly "$1" /usr/bin
+	readonly 2>/dev/null echo 2>/dev/null -eu "$1" export cd $(pwd) cd echo
+test -eu cd done && "$1" readonly x=1 export test "$@"
+		"$1" echo "$@" export test echo sed readonly
+echo x=1 test 'quoted text' then 2>/dev/null && printf 'quoted text' --verbose
+		--verbose readonly $(pwd)
+| export 'quoted text' cd | sed "$@" /usr/bin done done /usr/bin awk export
+		grep awk x=1 awk grep "$1" ${HOME} printf
+	'quoted text' "$1" test 2>/dev/null "$1" cd printf 'quoted text'
+	| | cd --verbose awk awk done | -eu test /usr/bin "$@" ${HOME} echo
+echo --verbose printf | then grep local -eu ${HOME} printf
+echo 2>/dev/null printf "$1" then && x=1 2>/dev/null local $(pwd) ${HOME}
+&& | then -eu $(pwd) 'quoted text'
+	$(pwd) awk x=1 'quoted text' x=1 x=1 "$@" && done test x=1 $(pwd)
+		"$@" export cd && cd 'quoted text' 'quoted text' sed grep $(pwd)
+		2>/dev/null test 2>/dev/null 'quoted text' test
+	&& | sed done 2>/dev/null grep $(pwd)
+		-eu export readonly awk cd
+		/usr/bin && sed x=1 printf
+		2>/dev/null -eu done then then export | printf printf 2>/dev/null then |
+		printf x=1 "$1" "$@" sed local readonly
+		"$1" | sed awk awk 2>/dev/null
+'quoted text' 2>/dev/null
+	sed sed done sed test "$1" --verbose
+local local readonly local $(pwd) x=1 2>/dev/null local
+then 'quoted text' | test printf then 'quoted text'
+	/usr/bin "$@" echo echo 'quoted text' test done awk ${HOME} $(pwd) readonly
+		awk x=1 'quoted text' | -eu test 'quoted text'
+	x=1 'quoted text' test export x=1 sed -eu test 'quoted text'
+		cd "$@" local printf ${HOME}
+local | "$1" /usr/bin --verbose 2>/dev/null "$1" test echo then echo awk
+	&& readonly echo "$1" /usr/bin 'quoted text'
+2>/dev/null && $(pwd) --verbose $(pwd) done readonly export ${HOME} sed
+	echo "$@" "$1" done "$@" sed then 2>/dev/null cd echo "$1" readonly done 'quoted text'
+		sed "$1" grep printf ${HOME} sed local x=1 cd x=1 2>/dev/null x=1 /usr/bin
+	x=1 sed done test printf "$1" | 'quoted text' printf sed test
+	x=1 local then local -eu cd done $(pwd) grep cd readonly
+		'quoted text' && && cd $(pwd) /usr/bin | "$1" && "$@" "$1" then /usr/bin
+printf --verbose readonly awk echo printf
+	awk then ${HOME} /usr/bin
+	grep echo grep -eu sed cd then "$@" -eu printf 'quoted text' ${HOME}
+	echo printf x=1 $(pwd) test && /usr/bin ${HOME} sed
+sed 2>/dev/null --verbose 2>/dev/null awk ${HOME} awk 2>/dev/null
+	sed /usr/bin grep sed "$1" done && echo readonly test test
+done ${HOME} 2>/dev/null sed /usr/bin printf && "$1" done awk test cd then cd
+		'quoted text' ${HOME} export sed
+local x=1 ${HOME} | then $(pwd) /usr/bin ${HOME}
+	'quoted text' grep awk local "$1" cd readonly printf -eu
+	sed ${HOME} /usr/bin 2>/dev/null
+		-eu ${HOME} "$@" echo /usr/bin 'quoted text' done printf local local sed 'quoted text'
+	export "$@" "$@" 'quoted text' echo sed echo $(pwd) printf readonly $(pwd)
+		test done readonly $(pwd) local sed "$1" test sed
+echo awk x=1 | done readonly
+'quoted text' done printf sed && ${HOME} && then echo --verbose awk ${HOME}
+echo --verbose then | printf done done echo export 'quoted text'
+"$1" $(pwd) grep | then printf awk 2>/dev/null "$@" readonly
+		test grep cd printf | |
+		cd grep echo done x=1 x=1 grep readonly done 'quoted text' $(pwd) "$@" ${HOME}
+		${HOME} sed x=1 x=1 ${HOME}
+test x=1 local $(pwd) "$@" echo then 2>/dev/null "$1" && "$1"
+		echo --verbose sed local test 2>/dev/null $(pwd)
+		"$@" /usr/bin && then sed echo |
+x=1 /usr/bin readonly then && done cd "$1" sed /usr/bin /usr/bin grep printf grep
+	sed export awk "$1" "$1" readonly then readonly export echo /usr/bin readonly
+	local | then awk echo printf /usr/bin
+	$(pwd) "$@" sed $(pwd) cd x=1 | cd done grep sed -eu readonly cd
+	"$1" x=1 echo --verbose awk printf 2>/dev/null &&
+		"$1" "$@" "$@" awk grep "$1" --verbose grep ${HOME} && awk | "$@" x=1 && cd
+	'quoted text' --verbose grep awk "$@" printf
+awk then "$1" test test awk 2>/dev/null x=1 cd
+--verbose x=1 export printf
+export "$@" | ${HOME} "$@" "$1" then done awk "$1" awk
+	sed $(pwd) readonly x=1 -eu grep x=1 local
+		${HOME} echo -eu grep
+	awk -eu "$1" grep 'quoted text' "$1" export awk local echo |
+		done -eu then --verbose cd readonly readonly awk x=1 sed && sed $(pwd)
+		| echo | -eu local echo then && done ${HOME}
+	${HOME} "$@" 'quoted text' x=1
+		&& readonly echo "$1"
+	| local sed $(pwd) /usr/bin test
+printf printf --verbose ${HOME} |
+x=1 2>/dev/null -eu awk x=1 local done readonly ${HOME} x=1 sed 'quoted text'
+	test printf "$@" then ${HOME} printf x=1
+		cd echo cd printf | && | sed --verbose x=1 grep -eu done ${HOME}
+	'quoted text' | echo "$@" x=1 echo 2>/dev/null "$@"
+echo --verbose --verbose | --verbose $(pwd) 'quoted text' cd grep | 'quoted text'
+--verbose sed 'quoted text'
+		'quoted text' --verbose --verbose /usr/bin
+	cd then /usr/bin done then x=1 cd sed readonly
+		/usr/bin printf "$@" export x=1 awk "$1" $(pwd) -eu readonly echo
+readonly $(pwd) export && "$1" printf sed printf --verbose
+	awk then done export
+${HOME} then 'quoted text' test readonly export test 2>/dev/null /usr/bin | $(pwd)
+local awk /usr/bin export test
+	export $(pwd) echo /usr/bin awk then then cd ${HOME} && ${HOME}
+	export "$@" printf readonly --verbose local --verbose
+		export -eu cd ${HOME}
+		'quoted text' local local test printf export "$@" --verbose --verbose $(pwd)
+		-eu "$@" | -eu && -eu "$@" 'quoted text'
+		&& "$@" export 2>/dev/null echo
+		local grep printf sed --verbose x=1 && readonly /usr/bin then cd ${HOME}
+	local && 'quoted text' done export cd x=1 --verbose &&
+	${HOME} ${HOME} awk grep done local sed | $(pwd) |
+	-eu ${HOME} readonly "$1"
+	/usr/bin sed export echo -eu local printf --verbose local --verbose ${HOME}
+	local printf echo ${HOME} ${HOME} "$@" done readonly grep
+		/usr/bin ${HOME} x=1 local -eu cd sed done sed x=1
+		test then 2>/dev/null /usr/bin sed x=1 export /usr/bin
+test --verbose local /usr/bin then $(pwd) /usr/bin
+		grep cd | readonly echo
+		awk cd /usr/bin grep then export ${HOME}
+"$@" sed awk readonly x=1 then
+		cd "$1" /usr/bin local $(pwd) ${HOME} grep test | "$1" 'quoted text' then x=1
+${HOME} && readonly printf readonly test x=1 export
+		--verbose "$1" local "$@" done /usr/bin export cd then done grep done
+"$@" $(pwd) test "$1" -eu export "$@" then ${HOME} $(pwd) sed sed then ${HOME}
+	awk echo && local "$@" -eu sed 'quoted text'
+	cd /usr/bin grep $(pwd) echo readonly
+awk test $(pwd) 'quoted text' test "$@" "$1" 'quoted text' done local
+local -eu sed 2>/dev/null "$@" /usr/bin readonly
+	done sed then | printf 'quoted text' readonly readonly --verbose cd --verbose
+2>/dev/null echo "$1" done $(pwd) sed local && $(pwd) local local /usr/bin
+"$@" printf test 2>/dev/null done export printf local cd done printf /usr/bin
+	$(pwd) /usr/bin grep --verbose --verbose ${HOME}
+	-eu then --verbose 'quoted text' cd cd readonly grep awk 2>/dev/null test readonly
+		local local ${HOME} "$@" grep 'quoted text' test 'quoted text' export
+/usr/bin done 2>/dev/null echo local cd sed readonly sed
+		printf | done done 2>/dev/null echo && readonly 2>/dev/null
+"$@" /usr/bin | 2>/dev/null sed echo echo
+		"$1" done 'quoted text'
+		/usr/bin echo readonly && $(pwd) -eu sed done
+		export 'quoted text' then | -eu $(pwd) local sed x=1 grep grep
+done readonly 'quoted text' --verbose &&
+	export echo 'quoted text' printf printf then export cd -eu local done | /usr/bin
+		readonly sed awk grep 'quoted text'
+	'quoted text' grep "$1" awk export local
+		"$1" local export then "$@" ${HOME} local awk cd 'quoted text'
+local readonly export "$1" awk --verbose 'quoted text' 'quoted text'
+2>/dev/null "$1" awk ${HOME} cd && export test echo "$@" cd then "$1"
+echo local printf && cd "$@" "$1" | && $(pwd) done readonly x=1 export
+		sed "$1" test "$1" 2>/dev/null "$@" --verbose
+		done x=1 cd "$1" grep && $(pwd) sed
+	--verbose | 'quoted text' ${HOME}
+"$@" cd export --verbose /usr/bin
+		readonly 2>/dev/null ${HOME} "$1" cd awk done
+/usr/bin ${HOME} sed
+readonly readonly grep printf awk readonly ${HOME} sed --verbose | test
+	'quoted text' export
+		sed cd | -eu --verbose && readonly done 2>/dev/null 'quoted text' ${HOME}
+&& printf then /usr/bin echo "$1" 2>/dev/null -eu x=1 awk 'quoted text'
+	printf printf -eu | "$@" local /usr/bin awk awk 2>/dev/null
+${HOME} "$@" local then | export 'quoted text' echo sed ${HOME}
+$(pwd) 2>/dev/null test cd awk && &&
+local $(pwd) sed | | "$@" 'quoted text'
+		--verbose --verbose export printf --verbose "$1" echo --verbose "$1" readonly
+	grep grep -eu x=1 readonly "$1" done done | readonly -eu done readonly
+echo "$1" awk export /usr/bin x=1 echo export | --verbose --verbose
+		2>/dev/null 'quoted text' -eu local 'quoted text' local then
+	test /usr/bin local export ${HOME} export test -eu /usr/bin | "$@" grep && sed
+	"$1" grep "$@" readonly /usr/bin
+		$(pwd) /usr/bin printf $(pwd) $(pwd) ${HOME}
+		${HOME} cd | then && x=1 cd
+	printf x=1 "$1" cd cd grep echo | sed local ${HOME} $(pwd)
+	"$@" ${HOME} $(pwd) "$@" sed sed awk readonly test export readonly
+	then /usr/bin printf /usr/bin awk grep
+		printf test awk $(pwd) awk /usr/bin
+--verbose test sed grep x=1 -eu
+	/usr/bin cd readonly done /usr/bin printf done --verbose sed awk printf 2>/dev/null
+	grep test export export readonly grep 'quoted text' local
+	printf "$@" local 'quoted text'
+&& /usr/bin "$@" 'quoted text' 2>/dev/null awk then sed -eu
+	"$@" x=1 done then local echo readonly echo
+| && done "$1" ${HOME} done test | echo echo awk -eu awk | done "$@" printf "$@"
+	&& test then echo cd "$1" awk 'quoted text' done -eu awk && x=1
+	then awk readonly then 'quoted text' printf "$1"
+grep "$1" awk "$1" $(pwd)
+		2>/dev/null --verbose sed echo sed $(pwd) cd export 'quoted text'
+	done cd readonly printf readonly export 'quoted text'
+	awk grep "$@" export --verbose printf
+	| readonly printf cd x=1
+	echo cd cd sed awk awk printf printf
+		| done readonly | cd | x=1 cd
+		--verbose x=1 local $(pwd) done $(pwd) &&
+'quoted text' readonly then cd readonly
+-eu done sed awk -eu grep done local -eu "$@" && --verbose "$1" sed 'quoted text'
+	&& --verbose export echo -eu then "$@" printf then
+	printf | --verbose echo awk -eu awk && echo printf
+	| "$1" 2>/dev/null $(pwd) ${HOME} echo local printf 2>/dev/null && cd $(pwd)
+sed 2>/dev/null 'quoted text' readonly --verbose test local
+	/usr/bin 2>/dev/null | then done --verbose
+echo $(pwd) export ${HOME} -eu x=1 x=1 "$@" printf local
+		sed export awk 'quoted text' /usr/bin export "$@" test printf x=1 'quoted text'
+	/usr/bin printf local then | echo printf
+		sed local sed /usr/bin readonly x=1 /usr/bin 'quoted text' echo echo local 2>/dev/null
+	-eu --verbose export printf then echo ${HOME} "$1" "$@" printf grep done /usr/bin
+		x=1 --verbose /usr/bin
+| grep /usr/bin | 2>/dev/null "$1" --verbose cd 'quoted text'
+sed 'quoted text' 'quoted text' cd && test export grep "$1" test test printf
+	grep -eu cd /usr/bin readonly "$@" 2>/dev/null 2>/dev/null
+		| | export sed then export then printf -eu -eu test readonly grep --verbose
+"$1" x=1 ${HOME} -eu sed && printf local 'quoted text'
+		export local sed test && then grep && readonly awk export
+		local grep x=1 done export | ${HOME} -eu 'quoted text' printf
+		$(pwd) ${HOME} "$@" export 'quoted text'
+		export sed x=1 "$@" awk done cd x=1 ${HOME} done /usr/bin "$1" -eu sed grep
+		/usr/bin echo /usr/bin
+	x=1 | -eu test echo sed export echo $(pwd)
+x=1 x=1 grep -eu awk readonly then grep /usr/bin "$@" 2>/dev/null --verbose
+	--verbose readonly local echo cd "$1" done x=1 x=1 ${HOME}
+		/usr/bin 2>/dev/null "$@" "$@" x=1 echo then -eu cd ${HOME} $(pwd) echo
+	then export grep && done printf sed /usr/bin done
+	"$1" "$@" $(pwd) | echo then 'quoted text' test awk --verbose | awk then
+grep 2>/dev/null then "$1" "$@" test "$@" && echo &&
+	--verbose cd cd sed x=1 $(pwd) -eu
+		printf printf sed cd "$@" cd "$1" && x=1 -eu done 'quoted text'
+/usr/bin readonly readonly /usr/bin /usr/bin sed
+sed $(pwd) && cd ${HOME} && cd done 2>/dev/null test && sed grep test /usr/bin
+	cd && "$@" readonly && echo 2>/dev/null 2>/dev/null $(pwd) "$@" &&
+		then grep grep export --verbose ${HOME} local
+		done done && echo then 'quoted text' && 'quoted text'
+echo "$1" x=1 printf readonly $(pwd) x=1 2>/dev/null "$@" awk
+		${HOME} readonly --verbose 'quoted text' $(pwd) x=1 cd awk ${HOME}
+	readonly grep readonly local x=1
+		readonly done -eu "$1" local
+/usr/bin 'quoted text' $(pwd) x=1 awk $(pwd)
+'quoted text' export "$@" sed export sed echo done |
+		then sed && grep local awk -eu done grep ${HOME} x=1 /usr/bin --verbose
+'quoted text' export grep ${HOME}
+| 2>/dev/null -eu grep grep then | "$1" cd
+		--verbose sed test -eu done local
+export && /usr/bin | && --verbose
+	2>/dev/null "$1" local 'quoted text' x=1 readonly
+	awk then export export 'quoted text' 2>/dev/null sed awk readonly x=1 'quoted text'
+		grep local ${HOME} sed done sed awk awk export
+$(pwd) | x=1 "$@" echo "$@" export done test 'quoted text' local
+local 2>/dev/null "$@" --verbose export awk awk && awk -eu
+	$(pwd) test "$@" export 'quoted text' export done 2>/dev/null
+| then sed --verbose "$@" done /usr/bin export "$@" done "$@" $(pwd) grep
+	"$1" 'quoted text' ${HOME} awk
+echo test && 'quoted text' sed | /usr/bin &&
+	export then 2>/dev/null awk local sed sed echo x=1 2>/dev/null
+-eu test | awk && cd /usr/bin && && -eu export readonly printf local printf
+${HOME} awk test "$1" printf grep grep export ${HOME} "$@"
+	readonly done printf "$@" local sed awk sed | grep 2>/dev/null awk done 2>/dev/null
+echo x=1 $(pwd) export /usr/bin echo x=1 awk "$@"
+		x=1 done awk --verbose
+--verbose local echo "$@" printf
+local then awk test "$1" sed "$1" $(pwd) -eu sed && --verbose cd
+	cd sed && x=1 x=1 "$@"
+"$@" grep cd x=1 awk /usr/bin echo && "$1" && --verbose
+	sed "$@" ${HOME} test 2>/dev/null local
+	cd /usr/bin export /usr/bin --verbose x=1 && then && "$@"
+--verbose grep done echo 2>/dev/null sed readonly | "$1" --verbose --verbose
+		awk sed awk readonly 'quoted text' cd readonly local 'quoted text' --verbose
+		grep x=1 /usr/bin then x=1 cd "$@" --verbose grep export then --verbose
+awk x=1 x=1 -eu "$1" ${HOME} "$1" ${HOME}
+cd echo readonly ${HOME} ${HOME} x=1 export printf cd sed echo cd grep
+		test 2>/dev/null 2>/dev/null x=1 cd "$@" done
+		export $(pwd) -eu && /usr/bin /usr/bin
+"$1" done echo local 'quoted text' 2>/dev/null sed 2>/dev/null
+		$(pwd) ${HOME} local readonly grep ${HOME} sed done readonly
+echo echo --verbose test /usr/bin --verbose 'quoted text' echo awk local awk | test
+	readonly /usr/bin --verbose grep done "$@" && | "$@" test export local --verbose
+	"$@" local done 2>/dev/null &&
+		2>/dev/null readonly then 'quoted text' grep printf printf
+printf && test local && 'quoted text' sed
+		${HOME} echo --verbose cd --verbose /usr/bin
+printf awk --verbose printf -eu $(pwd) x=1 ${HOME} readonly test
+	2>/dev/null --verbose ${HOME} -eu cd "$1" -eu
+awk /usr/bin ${HOME} done /usr/bin then test local readonly awk local 2>/dev/null
+	local ${HOME} ${HOME} local | test
+	--verbose then 'quoted text' ${HOME} printf "$1" test export $(pwd) /usr/bin local
+		"$@" $(pwd) cd x=1 'quoted text' sed && printf
+sed --verbose sed | $(pwd) ${HOME} | test | export readonly 'quoted text'
+		--verbose awk export $(pwd) echo grep 2>/dev/null
+x=1 awk /usr/bin echo sed readonly
+		sed readonly ${HOME} test | 'quoted text' $(pwd) 'quoted text' then -eu awk printf
+echo awk --verbose --verbose grep then local /usr/bin --verbose
+		$(pwd) done grep awk x=1 "$@"
+		"$1" export "$@" sed 'quoted text' /usr/bin printf
+readonly sed "$1" local done "$1" test grep "$@" awk 'quoted text'
+		${HOME} done done "$1" sed done then
+	test x=1 --verbose x=1 then readonly local "$@" printf 'quoted text' $(pwd)
+	&& done test $(pwd) "$1" grep echo "$@" "$@" echo local $(pwd) printf 'quoted text'
+grep -eu 'quoted text' 'quoted text'
+		grep printf then "$1" test
+test cd "$1" ${HOME} cd grep awk /usr/bin 2>/dev/null ${HOME}
+		grep test printf sed export
+	2>/dev/null echo then sed $(pwd) "$1"
+	"$1" | 2>/dev/null $(pwd) readonly | -eu ${HOME} export
+		-eu awk cd test "$1" --verbose test 2>/dev/null
+		then x=1 /usr/bin /usr/bin $(pwd) cd echo $(pwd) ${HOME}
+	sed printf 2>/dev/null /usr/bin "$1" readonly local
+		-eu readonly "$1" | $(pwd)
+	$(pwd) 'quoted text' --verbose x=1 -eu cd
+sed done test sed test | grep sed ${HOME} 2>/dev/null done test cd && -eu
+		echo ${HOME} "$@" --verbose printf awk export x=1 --verbose --verbose $(pwd)
+	&& readonly /usr/bin echo test "$1" /usr/bin readonly
+export export sed -eu printf done $(pwd) echo awk cd readonly
+		printf --verbose 2>/dev/null readonly | readonly grep | printf printf done
+readonly 2>/dev/null | x=1 ${HOME} 2>/dev/null "$1"
+		then test then local echo readonly test local 2>/dev/null awk echo export
+	sed sed x=1 | grep "$1" | x=1 awk
+${HOME} export ${HOME} awk readonly 'quoted text'
+	/usr/bin /usr/bin printf $(pwd) test -eu local "$@" ${HOME} "$@" export /usr/bin
+	local export x=1 sed awk --verbose -eu | /usr/bin
+done -eu 'quoted text' 'quoted text' then $(pwd) local
+		x=1 echo done -eu readonly ${HOME} &&
+readonly --verbose sed grep /usr/bin export done ${HOME}
+		sed 'quoted text' readonly done 'quoted text'
+x=1 'quoted text' then export 'quoted text'
+		/usr/bin then cd -eu done printf export && cd echo echo /usr/bin "$1"
+sed --verbose export then $(pwd) 2>/dev/null
+	-eu "$@" x=1 done cd echo
+$(pwd) then 'quoted text' printf
+${HOME} $(pwd) ${HOME} "$1" readonly echo
+	| done local $(pwd) test -eu && sed export readonly --verbose then 2>/dev/null
+		echo 2>/dev/null 'quoted text' /usr/bin cd --verbose "$@" cd cd "$1"
+	echo sed | then "$@" grep readonly sed readonly ${HOME} printf
+cd local cd cd && then | grep | 'quoted text' 2>/dev/null cd test then |
+test test readonly readonly done 'quoted text' 'quoted text' 2>/dev/null
+cd "$1" 'quoted text' sed $(pwd) echo grep "$1" x=1 printf awk --verbose
+	readonly awk readonly cd | test /usr/bin local | sed done |
+	&& awk cd 'quoted text' $(pwd) grep done export $(pwd) "$1" $(pwd)
+		'quoted text' export cd sed cd | export x=1 cd /usr/bin echo done
+echo grep sed export export
+'quoted text' x=1 sed awk readonly ${HOME} sed && grep sed 2>/dev/null "$@"
+		cd -eu --verbose -eu readonly
+		'quoted text' -eu && /usr/bin "$@" ${HOME} | readonly x=1 2>/dev/null
+cd 'quoted text' local | then readonly then grep export local printf ${HOME}
+export x=1 ${HOME} $(pwd)
+x=1 grep /usr/bin /usr/bin &&
+/usr/bin awk x=1 done "$@" 2>/dev/null x=1 done done test awk export |
+	$(pwd) /usr/bin local test then $(pwd) printf done then "$1" ${HOME} printf &&
+grep x=1 && test 2>/dev/null 'quoted text' test readonly x=1 echo echo "$1" local
+	test then echo test readonly
+		grep -eu printf local then echo /usr/bin x=1
+${HOME} sed printf "$1" done --verbose printf
+		readonly $(pwd) grep && "$1" x=1 readonly cd ${HOME} | sed "$1" "$1" grep
+test grep && -eu cd $(pwd) 'quoted text' test awk --verbose && awk done x=1 local
+	awk && awk test /usr/bin local export 'quoted text' $(pwd) awk && printf
+	cd grep sed /usr/bin test printf ${HOME} echo --verbose --verbose printf sed
+		awk $(pwd) ${HOME} "$@" -eu export export
+cd x=1 -eu && ${HOME} cd awk "$@" ${HOME} sed --verbose then test x=1 'quoted text'
+test printf then "$1" cd awk "$1" echo done readonly $(pwd)
+		&& && x=1 grep -eu "$@" awk done 'quoted text'
+	export && 'quoted text' done echo then done | cd then ${HOME}
+sed 'quoted text' local x=1 --verbose
+	done done /usr/bin | cd then
+		${HOME} /usr/bin "$1" /usr/bin $(pwd) | "$@" --verbose local /usr/bin
+/usr/bin local 'quoted text' "$@" && 'quoted text' cd sed
+	sed done grep test echo echo sed
+		readonly /usr/bin 2>/dev/null readonly then && --verbose done
+		"$1" x=1 /usr/bin grep readonly grep grep echo export -eu && $(pwd) printf
+	${HOME} printf $(pwd) printf x=1 grep "$@" $(pwd)
+"$@" --verbose awk x=1 grep echo && then done
+		printf printf /usr/bin local $(pwd) /usr/bin then test
+	grep ${HOME} readonly "$@" 'quoted text' ${HOME} echo /usr/bin 'quoted text'
+		"$@" test local local done | cd grep done printf then
+	done echo sed grep grep export x=1 $(pwd)
+	2>/dev/null readonly local "$@" cd
+		sed then 'quoted text' echo
+		| "$1" echo $(pwd) printf printf
+readonly && 'quoted text' grep 'quoted text' printf --verbose
+&& local 2>/dev/null -eu awk printf 'quoted text' /usr/bin printf grep && $(pwd)
+		"$@" awk grep awk | "$@" x=1 2>/dev/null
+x=1 echo /usr/bin cd export readonly 'quoted text'
+		$(pwd) ${HOME} awk -eu printf -eu 'quoted text' awk -eu then ${HOME}
+echo -eu echo 'quoted text' ${HOME} ${HOME}
+		'quoted text' awk ${HOME} 2>/dev/null
+test awk x=1 && && 2>/dev/null x=1 x=1 echo
+local sed export | "$@" test x=1 local awk done x=1 --verbose -eu awk
+		--verbose "$@" && $(pwd) "$1" then
+		awk -eu readonly done local local /usr/bin
+test local cd 'quoted text' --verbose awk echo 2>/dev/null -eu
+'quoted text' export 'quoted text'
+		"$@" then "$1" sed ${HOME} "$@" readonly x=1 | sed /usr/bin cd
+	&& ${HOME} local echo grep echo
+export then $(pwd) readonly awk -eu 2>/dev/null
+		-eu --verbose local local sed 2>/dev/null "$1"
+		awk local then /usr/bin done $(pwd) "$1" && 'quoted text' test | echo
+		cd export ${HOME} grep test "$1" x=1 ${HOME} printf -eu && /usr/bin | awk grep
+'quoted text' "$1" --verbose 2>/dev/null test awk done --verbose $(pwd) test x=1
+awk printf 2>/dev/null grep "$1" echo $(pwd) echo "$1"
+x=1 | echo test then then "$1" then echo then ${HOME} && readonly test
+	grep cd done grep -eu 2>/dev/null printf then grep | "$1" | local /usr/bin
+	readonly echo && "$@" test test x=1 awk x=1 done -eu --verbose export
+		${HOME} export /usr/bin
+		then test echo | --verbose
+	$(pwd) /usr/bin $(pwd) cd x=1 local local --verbose -eu | 2>/dev/null
+	printf | $(pwd) --verbose echo 2>/dev/null
+		export echo echo then && ${HOME} | x=1 "$@"
+	local export readonly
+		cd ${HOME} && echo 2>/dev/null
+	cd "$1" done echo awk && sed awk
+| "$1" "$1" readonly echo && then cd "$1" then printf cd -eu test
+echo --verbose "$@" echo sed "$@" echo x=1
+done printf sed sed "$1" "$1" /usr/bin local awk 'quoted text' "$1" test
+		printf ${HOME} "$1" readonly 'quoted text' 'quoted text' $(pwd)
+	$(pwd) test cd ${HOME} 2>/dev/null
+cd readonly 'quoted text' then done awk cd done ${HOME} cd && "$1"
+	sed done 2>/dev/null done && printf "$1" done echo cd 'quoted text' "$1" test "$@"
+	echo 2>/dev/null $(pwd) -eu printf export echo
+		/usr/bin --verbose cd 'quoted text' echo echo --verbose test echo |
+test ${HOME} 'quoted text' ${HOME} 2>/dev/null $(pwd) echo echo printf |
+$(pwd) grep awk ${HOME} ${HOME} $(pwd) x=1 export cd $(pwd) readonly
+"$@" x=1 printf 2>/dev/null ${HOME} -eu $(pwd) /usr/bin --verbose $(pwd)
+printf -eu --verbose 2>/dev/null cd | export /usr/bin done then sed grep x=1
+		&& 'quoted text' ${HOME} then done
+'quoted text' -eu -eu sed echo then
+"$1" "$1" export ${HOME} ${HOME} -eu local
+		${HOME} sed --verbose "$1"
+		test local grep && local -eu
+then export echo grep cd export readonly sed cd && 2>/dev/null then ${HOME} readonly
+	local ${HOME} x=1 grep | && sed sed test
+		then readonly printf x=1 $(pwd) /usr/bin echo | test /usr/bin export then readonly
+cd 'quoted text' done -eu readonly grep "$1" test && sed local
+		"$1" readonly cd printf test
+		-eu printf | echo 2>/dev/null -eu echo $(pwd) $(pwd)
+	$(pwd) --verbose | echo --verbose awk 2>/dev/null && awk
+	x=1 grep echo /usr/bin && done "$1" && 'quoted text' $(pwd) echo then echo
+		grep /usr/bin -eu 2>/dev/null
+		x=1 | /usr/bin readonly grep $(pwd) printf export &&
+		grep sed echo -eu echo export "$@" sed done "$@" /usr/bin
+	awk x=1 local cd done test printf &&
+-eu sed then readonly grep -eu grep echo "$@"
+#include c23.sh
+		sed ${HOME} echo sed $(pwd) then
+	readonly --verbose cd test
+	2>/dev/null done --verbose grep sed ${HOME} x=1 export
+	2>/dev/null printf $(pwd) grep --verbose
+		--verbose /usr/bin sed -eu readonly cd 2>/dev/null cd test echo cd
+		--verbose echo sed awk done -eu && cd readonly && "$1" grep
+sed --verbose sed then readonly
+		| grep -eu x=1 $(pwd) cd done printf /usr/bin
+		| $(pwd) sed awk cd "$1" 2>/dev/null ${HOME} sed ${HOME} awk -eu && grep
+--verbose cd x=1 grep grep && awk
+echo cd x=1 printf && "$1" 2>/dev/null --verbose grep test then test
+		echo echo --verbose $(pwd) 2>/dev/null sed ${HOME} ${HOME} "$@" x=1 export
+test printf -eu ${HOME} x=1 echo "$@" export | done echo ${HOME}
+	-eu 2>/dev/null "$@" /usr/bin 'quoted text' "$@"
+		export cd done awk awk done $(pwd) 2>/dev/null
+		awk awk printf | cd export export
+&& then cd 'quoted text' ${HOME} $(pwd) ${HOME} readonly "$1"
+"$@" 'quoted text' ${HOME} test ${HOME} && && && ${HOME} printf ${HOME}
+	/usr/bin grep ${HOME} grep done | then cd 'quoted text'
+	sed local cd 'quoted text' readonly test awk grep
+	2>/dev/null -eu awk x=1 2>/dev/null export printf x=1 --verbose done 'quoted text'
+		awk then done | && /usr/bin grep test
+	done ${HOME} /usr/bin awk ${HOME}
+	readonly printf awk test "$@" | printf -eu then
+		printf then 2>/dev/null x=1 awk && echo test echo ${HOME} x=1
+	/usr/bin 2>/dev/null
+'quoted text' 2>/dev/null cd 2>/dev/null /usr/bin && grep awk then "$1" readonly
+/usr/bin x=1 done export echo "$1" echo $(pwd) test && sed -eu $(pwd) test
+		-eu then -eu echo "$@" then --verbose echo export readonly awk test echo test
+		grep "$1" test cd grep awk printf --verbose export 2>/dev/null
+	"$1" ${HOME} --verbose test | awk 'quoted text'
+local ${HOME} | test && 2>/dev/null then awk /usr/bin done "$1"
+	awk test awk done && "$1" $(pwd) cd 'quoted text'
+	"$@" echo "$1" cd | local
+	/usr/bin echo --verbose ${HOME}
+		export echo readonly $(pwd) then done
+local cd "$1" $(pwd) "$@" export printf "$1" $(pwd) sed printf printf
+		"$@" awk -eu cd -eu 2>/dev/null $(pwd) x=1 readonly
+cd | /usr/bin cd test 2>/dev/null awk "$1"
+	--verbose 2>/dev/null echo then
+		cd awk cd echo local &&
+x=1 2>/dev/null done 'quoted text' "$@" ${HOME}
+	echo $(pwd) 'quoted text' x=1 'quoted text' cd $(pwd) 'quoted text'
+		&& done x=1 done && echo "$@" ${HOME}
+	cd "$1" echo done "$@" done grep x=1 sed -eu grep 'quoted text'
+		cd x=1 ${HOME} done echo "$1"
+		| local 'quoted text' printf local sed "$@" x=1 x=1 ${HOME}
+	2>/dev/null readonly cd local --verbose
+		sed export -eu "$1" readonly grep grep local ${HOME} --verbose awk cd /usr/bin sed
+-eu "$1" awk "$@" "$1" then -eu && sed "$1" cd grep ${HOME} export
+		/usr/bin | then "$1" | 2>/dev/null -eu x=1
+		local sed | -eu cd grep "$1" 'quoted text'
+	$(pwd) -eu awk done printf /usr/bin && sed grep test
+		x=1 export && cd "$@" test then test $(pwd) -eu 'quoted text'
+		${HOME} "$@" x=1 done x=1 "$1" $(pwd) done test done printf "$1" ${HOME}
+		-eu 2>/dev/null 'quoted text' sed
+	-eu sed sed awk "$@" 2>/dev/null 2>/dev/null
+	local grep -eu awk awk then printf
+	2>/dev/null printf local then $(pwd)
+	echo | /usr/bin 2>/dev/null awk ${HOME} "$1" cd sed test local
+local && /usr/bin sed x=1
+/usr/bin done export then sed 2>/dev/null "$@" /usr/bin | 2>/dev/null
+		cd /usr/bin "$@" printf done echo sed 2>/dev/null
+		/usr/bin 2>/dev/null export && "$1" awk
+	'quoted text' export /usr/bin 2>/dev/null local awk
+		"$@" 'quoted text' --verbose 'quoted text'
+		sed test echo sed -eu
+"$@" export | 2>/dev/null test sed x=1 then sed | echo
+local && done export $(pwd) echo done test "$@" x=1 && | 2>/dev/null
+	export sed test awk done --verbose | -eu readonly export test
+		sed test awk --verbose ${HOME} 2>/dev/null 'quoted text' "$1"
+		x=1 printf 'quoted text' test 'quoted text' x=1 /usr/bin export
+"$@" "$1" test $(pwd) /usr/bin 'quoted text' "$@" cd 'quoted text' "$@" awk
+	printf done -eu -eu done awk printf export awk local local echo x=1 ${HOME}
+	'quoted text' -eu 2>/dev/null test then "$@" export export && readonly /usr/bin
+	--verbose 2>/dev/null export "$@" x=1 && "$@" "$1" -eu
+	x=1 done awk "$@" x=1 --verbose "$@" ${HOME} printf |
+'quoted text' awk | export test grep --verbose local -eu -eu
+	readonly /usr/bin readonly --verbose
+		${HOME} awk "$@" | local -eu local printf "$@" /usr/bin -eu /usr/bin
+readonly ${HOME} "$@" x=1 'quoted text'
+		grep 2>/dev/null local cd ${HOME} readonly then then "$1" readonly $(pwd)
+	"$1" local "$1" echo --verbose
+		readonly $(pwd) local test /usr/bin grep echo --verbose
+-eu -eu && export done 2>/dev/null
+		${HOME} "$@" x=1 -eu 2>/dev/null done "$@" cd 2>/dev/null -eu echo cd "$1"
+		printf "$@" readonly done then sed
+	$(pwd) readonly grep "$1" /usr/bin && local x=1
+		--verbose 2>/dev/null "$1" grep
+		done "$@" readonly "$@" echo "$@" x=1 export awk then grep awk
+		printf x=1 | && local test done local printf readonly
+		"$@" readonly printf readonly sed 2>/dev/null x=1 /usr/bin 2>/dev/null printf
+	local /usr/bin test grep ${HOME} cd sed local ${HOME}
+$(pwd) local printf 2>/dev/null && grep --verbose $(pwd) | then
+awk ${HOME} echo export local
+	/usr/bin sed x=1 echo then 'quoted text' /usr/bin then 'quoted text'
+	export cd printf ${HOME} done cd cd printf
+	2>/dev/null test done
+		/usr/bin echo printf "$1" "$@" awk readonly sed --verbose $(pwd)
+		${HOME} readonly printf printf x=1 && /usr/bin sed readonly
+readonly x=1 | sed ${HOME} -eu readonly &&
+	${HOME} 'quoted text' x=1 awk echo --verbose grep
+--verbose printf local readonly && done
+		test then echo test test /usr/bin
+${HOME} 'quoted text' 'quoted text' then printf -eu echo $(pwd)
+grep && -eu test --verbose 2>/dev/null then
+/usr/bin sed test $(pwd) --verbose
+	sed export -eu $(pwd) 2>/dev/null echo $(pwd) test
+grep echo && printf "$1"
+test && echo 2>/dev/null $(pwd) grep 'quoted text'
+		2>/dev/null readonly grep | && $(pwd) && printf
+	${HOME} /usr/bin awk --verbose x=1 x=1 sed printf x=1 ${HOME} 'quoted text' --verbose
+	local echo test sed printf cd cd grep 'quoted text' cd then local
+x=1 grep local /usr/bin "$1" && /usr/bin
+readonly awk 'quoted text' done printf awk x=1 sed && "$@" --verbose "$@"
+export printf $(pwd) "$@" /usr/bin | readonly "$1" "$1" 2>/dev/null test export
+x=1 | cd done -eu awk -eu readonly
+		done -eu sed grep -eu
+"$@" $(pwd) sed | 2>/dev/null
+export export echo | sed
+		$(pwd) sed export done "$@" && | --verbose
+		--verbose then "$1" ${HOME} printf | readonly "$@"
+	"$1" local "$1" local --verbose export 'quoted text'
+	local "$1" /usr/bin export -eu | test "$1" test /usr/bin printf then | readonly
+| cd sed && && printf awk sed then cd then sed
+		${HOME} cd local -eu test
+		x=1 readonly "$@" ${HOME} printf
+		"$@" readonly test 2>/dev/null awk export echo -eu cd then local
+	local echo --verbose "$1" "$1"
+	"$@" 'quoted text' | grep echo
+	"$1" "$1" "$@" test export export x=1
+	/usr/bin export $(pwd) $(pwd) then --verbose readonly export /usr/bin
+	export sed 'quoted text' then ${HOME} echo readonly
+	sed sed $(pwd) printf && cd cd awk
+/usr/bin --verbose | printf $(pwd)
+	sed export 'quoted text' echo | readonly test 2>/dev/null $(pwd) then grep
+done printf grep printf 'quoted text'
+		"$1" local test local "$1" then done cd
+test "$@" cd readonly x=1 cd done
+		"$@" echo test test /usr/bin
+	echo | /usr/bin | export awk test
+		"$1" && echo printf 2>/dev/null
+export test test export "$@" ${HOME} printf --verbose
+		2>/dev/null awk 'quoted text' done ${HOME} local && x=1 ${HOME} readonly ${HOME}
+	printf echo x=1 && readonly ${HOME} $(pwd) local --verbose /usr/bin grep sed
+x=1 readonly ${HOME} 'quoted text' local echo test "$@" cd | sed --verbose
+'quoted text' ${HOME} printf "$1" | ${HOME} test
+--verbose echo sed "$@" echo && cd then export printf export "$@"
+	test --verbose 2>/dev/null && sed 'quoted text' done printf
+x=1 awk 'quoted text' -eu /usr/bin "$1" $(pwd) done --verbose --verbose readonly
+	cd && test "$@" 2>/dev/null --verbose && cd local export
+		awk done -eu printf local "$@"
+awk readonly then readonly awk
+		sed readonly echo grep test awk then x=1 | printf readonly local /usr/bin echo
+readonly awk && grep done /usr/bin && test
+sed "$@" echo cd local done sed export "$1" x=1 $(pwd) readonly printf
+	grep | awk grep echo done cd printf --verbose printf export "$@" "$@" readonly
+		printf ${HOME} readonly done test done awk -eu /usr/bin
+		-eu | -eu sed cd 'quoted text' --verbose 'quoted text' done "$1" test export
+	then sed | cd echo cd printf $(pwd) x=1 | then 'quoted text' printf done printf
+		$(pwd) export 'quoted text' cd export | 'quoted text'
+/usr/bin cd /usr/bin done "$1" readonly then done 'quoted text'
+awk -eu -eu sed printf echo awk printf sed printf
+	grep awk | x=1 ${HOME} /usr/bin && "$1" /usr/bin -eu printf grep export grep
+local local echo $(pwd) "$1" grep "$1" x=1 readonly sed x=1 --verbose
+		$(pwd) test awk --verbose 2>/dev/null
+	"$1" | 'quoted text' ${HOME} && echo echo test && -eu /usr/bin test "$@"
+echo cd -eu cd printf
+| ${HOME} && ${HOME}
+"$@" "$@" -eu printf then echo | | --verbose "$@" echo export readonly then then
+		sed && $(pwd) local printf export 'quoted text' export 2>/dev/null
+awk export printf echo test ${HOME} echo x=1 $(pwd) ${HOME}
+		export 'quoted text' local ${HOME} then grep $(pwd) test grep cd "$@"
+		-eu then cd grep printf cd awk awk awk "$@" sed "$1" sed
+	/usr/bin done /usr/bin done readonly grep && "$1" printf "$1" local --verbose
+echo x=1 test | 'quoted text' x=1 -eu then cd grep 2>/dev/null "$@"
+	| done local readonly ${HOME} $(pwd) sed echo sed ${HOME} "$1" export "$1" 2>/dev/null
+	2>/dev/null readonly $(pwd) -eu x=1 sed readonly -eu
+	${HOME} "$1" 'quoted text' grep -eu "$1" /usr/bin
+		| 2>/dev/null x=1 grep $(pwd) ${HOME}
+/usr/bin ${HOME} && -eu done echo
+		local then test -eu "$1" && | readonly printf test && "$1"
+		$(pwd) sed "$@" done sed awk && grep 'quoted text' test "$@" 2>/dev/null
+	export grep ${HOME} ${HOME} local test
+printf 'quoted text' "$@" printf
+	grep then "$@" ${HOME} test
+	-eu | && printf done -eu sed
+	&& ${HOME} grep && sed sed awk /usr/bin printf then test x=1 cd $(pwd)
+		'quoted text' cd /usr/bin /usr/bin local x=1
+		printf echo echo then local "$1"
+	| local -eu /usr/bin x=1 echo ${HOME} | -eu then awk "$1" --verbose export then
+		x=1 awk local --verbose "$1" && export --verbose
+	local readonly ${HOME} 'quoted text' test grep test ${HOME}
+x=1 ${HOME} "$1" awk
+		'quoted text' && awk -eu "$@" x=1
+	x=1 sed printf echo done -eu then readonly && && export sed 2>/dev/null "$@"
+awk "$1" "$1" then 2>/dev/null done | x=1 test cd
+		done printf readonly && cd echo --verbose
+	$(pwd) 'quoted text' && --verbose test 'quoted text' readonly sed ${HOME} cd
+printf 'quoted text' ${HOME} /usr/bin then
+--verbose printf awk ${HOME}
+cd | 'quoted text' printf $(pwd)
+		readonly then 2>/dev/null printf -eu done printf ${HOME} "$1" --verbose
+	then -eu 2>/dev/null sed echo
+"$@" -eu cd "$@" -eu 2>/dev/null sed "$1" test -eu && /usr/bin
+	| "$1" x=1 test /usr/bin readonly grep awk printf export "$@" "$@"
+		'quoted text' | $(pwd) then
+	x=1 then then $(pwd) test readonly sed grep x=1 | --verbose 'quoted text' printf
+		-eu local awk $(pwd) "$1" readonly $(pwd) ${HOME}
+	grep then /usr/bin | readonly x=1 /usr/bin "$@" then
+		done && 2>/dev/null -eu ${HOME} local echo local export
+		'quoted text' /usr/bin | awk printf -eu test echo $(pwd) then done
+test x=1 grep "$@" echo echo
+		grep -eu readonly 2>/dev/null export /usr/bin
+local local /usr/bin
+		${HOME} awk && $(pwd) then && /usr/bin /usr/bin $(pwd)
+		--verbose x=1 then echo cd cd local 'quoted text'
+		export done local 'quoted text' done readonly $(pwd) grep grep readonly awk
+"$@" "$1" "$@" test 'quoted text' &&
+		x=1 2>/dev/null | | cd x=1 then "$@" --verbose
+		local done readonly export ${HOME}
+		x=1 x=1 | 2>/dev/null ${HOME} -eu printf "$1" done printf "$1" "$1" ${HOME}
+printf "$@" x=1 export then 'quoted text' 2>/dev/null x=1 printf done && "$1"
+printf /usr/bin done test -eu local local | "$1" test --verbose readonly |
+2>/dev/null test --verbose cd ${HOME} then readonly printf
+		&& export 2>/dev/null "$1" sed /usr/bin "$1" cd
+	local export awk readonly 'quoted text' export
+printf export x=1 -eu /usr/bin
+	done "$@" local readonly readonly /usr/bin printf
+awk ${HOME} | 2>/dev/null awk && -eu printf export export
+	export awk $(pwd) -eu /usr/bin awk then 'quoted text' echo $(pwd) export $(pwd)
+		printf local echo -eu "$@" /usr/bin "$1" --verbose printf
+		sed ${HOME} -eu sed -eu readonly | export x=1 readonly test echo
+	'quoted text' --verbose 2>/dev/null echo export | then
+-eu x=1 export -eu then | "$@" printf local "$@" printf done 'quoted text'
+	2>/dev/null "$1" -eu then | x=1
+		2>/dev/null printf ${HOME} "$1" 'quoted text' "$1" local echo | local cd sed
+	| $(pwd) export $(pwd) -eu --verbose export awk "$@" $(pwd) -eu
+done --verbose x=1 /usr/bin echo echo -eu done
+	printf "$@" 'quoted text' export local
+&& printf -eu ${HOME} "$@" -eu ${HOME} printf x=1
+printf readonly /usr/bin cd && sed ${HOME} 2>/dev/null test
+		awk "$@" && /usr/bin $(pwd) "$1"
+local --verbose done test readonly
+	readonly done x=1 cd local readonly
+sed /usr/bin -eu 2>/dev/null then grep cd | -eu "$1" && | done
+		&& 2>/dev/null readonly export 2>/dev/null "$@" sed readonly /usr/bin $(pwd) done
+local export /usr/bin $(pwd) grep readonly x=1 sed cd --verbose
+	$(pwd) "$@" | local | -eu
+export /usr/bin readonly -eu /usr/bin readonly -eu /usr/bin 2>/dev/null
+sed sed 'quoted text' "$1" readonly readonly && grep "$@" $(pwd)
+		sed $(pwd) ${HOME} awk | cd sed echo
+		then && | sed $(pwd) readonly awk x=1 printf "$1" sed readonly ${HOME} | --verbose
+readonly "$@" 2>/dev/null readonly ${HOME} && | ${HOME} export cd
+		| /usr/bin "$1" test cd awk --verbose x=1 cd echo -eu "$@" | awk
+		$(pwd) sed sed done cd "$1" export export | | x=1 readonly
+$(pwd) ${HOME} export && test -eu -eu 2>/dev/null $(pwd) ${HOME} printf echo
+	"$1" 2>/dev/null done 'quoted text'
+	awk export echo then | 'quoted text' grep
+	export 2>/dev/null then printf -eu "$1" local 2>/dev/null
+	${HOME} | awk grep "$1" grep done
+		"$1" "$1" -eu printf && && readonly printf
+/usr/bin -eu echo 'quoted text' local then awk
+/usr/bin --verbose "$@"
+		printf ${HOME} local x=1 ${HOME} echo grep ${HOME} echo
+printf done awk $(pwd) ${HOME} done | local 'quoted text' "$@" test
+	done export 2>/dev/null then local awk awk sed local
+&& done -eu echo done cd x=1 echo sed local x=1 readonly x=1 && printf
+	done grep local local -eu echo
+	2>/dev/null local test | 2>/dev/null "$@" $(pwd)
+	| awk grep && local 2>/dev/null cd readonly sed
+	| awk readonly $(pwd) 'quoted text' 2>/dev/null
+		awk $(pwd) cd | --verbose printf printf export | readonly test test grep x=1
+sed sed 2>/dev/null --verbose 2>/dev/null
+		readonly printf readonly "$1" readonly printf awk done
+	--verbose --verbose export ${HOME} then "$1" export ${HOME} 2>/dev/null export
+	readonly echo x=1 done | $(pwd)
+-eu | grep grep | then && test "$@"
+	| then /usr/bin "$1" x=1 then grep 'quoted text'
+-eu -eu --verbose --verbose done 'quoted text' then then
+	cd -eu export /usr/bin && echo echo awk x=1 2>/dev/null
+	sed --verbose sed then $(pwd) grep $(pwd)
+		local --verbose && 2>/dev/null echo done
+		echo ${HOME} then -eu test done cd /usr/bin sed
+		'quoted text' awk 'quoted text' export echo
+	printf printf then local $(pwd) && | done --verbose ${HOME} --verbose
+	echo ${HOME} -eu echo grep done
+		printf | -eu then readonly readonly sed -eu readonly /usr/bin test $(pwd) grep
+printf sed ${HOME} "$@" ${HOME} then readonly
+	cd ${HOME} ${HOME} 'quoted text' cd --verbose $(pwd)
+	&& 2>/dev/null | awk cd then echo -eu
+printf readonly $(pwd) && grep sed -eu ${HOME} cd sed export /usr/bin && |
+&& test -eu 2>/dev/null done grep | local readonly
+		then test --verbose /usr/bin
+	"$1" cd awk grep ${HOME} done -eu
+	2>/dev/null printf export then awk echo --verbose x=1
+	local cd --verbose sed echo echo local export grep cd then test grep
+| --verbose export export -eu export x=1 export --verbose
+		${HOME} "$@" "$1" -eu then done --verbose readonly && --verbose sed | grep
+	"$@" then export awk $(pwd) grep
+'quoted text' -eu | test -eu printf "$@" readonly x=1 | printf then
+export ${HOME} export "$1"
+	echo "$@" /usr/bin | awk --verbose
+		"$@" --verbose printf "$@" sed $(pwd) $(pwd) 'quoted text' $(pwd) echo && x=1 --verbose
+	x=1 grep grep && echo /usr/bin
+		"$1" --verbose "$1" cd cd 2>/dev/null
+	--verbose $(pwd) 'quoted text' ${HOME} 2>/dev/null
+	printf /usr/bin sed |
+2>/dev/null /usr/bin then
+	export && echo "$1" grep awk 2>/dev/null /usr/bin --verbose && sed "$1" cd
+	"$1" readonly local done grep && 'quoted text' x=1 grep export
+	printf grep 'quoted text' done
+		/usr/bin x=1 "$@" | | 'quoted text'
+		sed export sed -eu ${HOME} | 2>/dev/null "$@" then
+readonly && --verbose 'quoted text' cd export printf | 2>/dev/null
+	/usr/bin export "$1" "$@"
+${HOME} | echo /usr/bin sed | 2>/dev/null x=1 && echo &&
+		2>/dev/null && readonly /usr/bin done grep ${HOME}
+awk 2>/dev/null -eu --verbose
+/usr/bin $(pwd) echo then done -eu done export && ${HOME} 'quoted text'
+	echo cd export awk $(pwd) /usr/bin
+printf cd echo 'quoted text'
+&& grep $(pwd) test readonly test $(pwd) echo && printf done echo x=1 then
+		'quoted text' echo 2>/dev/null 2>/dev/null
+		printf ${HOME} "$@" x=1
+	'quoted text' test 2>/dev/null export
+		cd -eu printf done then printf cd /usr/bin "$1" && -eu --verbose "$@" "$@" echo
+	export "$1" export awk
+	printf -eu "$@" grep -eu --verbose done
+	local --verbose cd done /usr/bin && x=1 2>/dev/null
+echo "$@" ${HOME} 'quoted text' 2>/dev/null then --verbose local | --verbose
+	test /usr/bin "$1" 'quoted text'
+		cd export 'quoted text' $(pwd) "$1" "$1" export cd | x=1
+grep done awk $(pwd) readonly
+	test "$@" ${HOME} "$@" | x=1 then printf test
+	export cd test echo --verbose $(pwd) readonly
+	local export awk 2>/dev/null
+	"$1" x=1 -eu -eu cd $(pwd) $(pwd) "$1" "$1" then grep && printf grep local
+	test local local "$1" test local $(pwd)
+	x=1 'quoted text' grep awk &&
+echo export cd | ${HOME} 'quoted text'
+	'quoted text' && "$@" test
+		"$1" ${HOME} && grep $(pwd) awk | export sed grep ${HOME} grep --verbose
+		sed then readonly --verbose "$@" awk sed echo grep && 2>/dev/null
+export $(pwd) --verbose
+		/usr/bin | "$@" && /usr/bin x=1 export printf export ${HOME}
+--verbose | awk /usr/bin | ${HOME} done 'quoted text' done 'quoted text'
+'quoted text' ${HOME} && local 2>/dev/null echo $(pwd) sed 'quoted text'
+	printf | --verbose ${HOME} done 2>/dev/null
+then "$@" sed sed ${HOME} cd "$@" printf $(pwd) sed "$@" $(pwd) test
+| sed export "$1" done
+		-eu local "$@" awk 'quoted text' "$1" --verbose -eu sed ${HOME} "$@" then local
+		awk "$1" 2>/dev/null /usr/bin printf "$@" export -eu
+	export printf export x=1 ${HOME} "$1"
+		-eu && sed "$1" test test && && $(pwd) echo /usr/bin grep -eu printf x=1 readonly
+-eu | "$@" done local 'quoted text'
+	local printf done awk && printf test "$@" test $(pwd)
+	printf --verbose 'quoted text' printf printf awk local grep test
+	echo --verbose 2>/dev/null echo $(pwd) local echo done awk then
+&& then export export "$1" $(pwd)
+		| ${HOME} | 'quoted text'
+	echo export test printf "$@" x=1 /usr/bin
+	sed awk x=1 grep local grep readonly cd then awk ${HOME} awk grep && |
+		/usr/bin awk test printf "$@" && /usr/bin echo printf "$@" then then | grep
+		sed grep "$1" | $(pwd) $(pwd)
+		printf "$1" export -eu done "$@" readonly then
+	${HOME} /usr/bin export && | | awk /usr/bin cd then 2>/dev/null | /usr/bin
+"$1" --verbose | /usr/bin local x=1 -eu 2>/dev/null
+readonly && ${HOME} readonly readonly 'quoted text' && | 'quoted text' ${HOME}
+		| 2>/dev/null "$1" -eu "$1" printf
+	local export && x=1 2>/dev/null 2>/dev/null sed && && ${HOME} | && cd
+test x=1 | sed printf /usr/bin /usr/bin --verbose "$1" --verbose
+		sed -eu grep 'quoted text' local
+		echo done printf readonly "$@" "$1" then $(pwd) echo export 'quoted text'
+--verbose printf local echo 2>/dev/null -eu
+	readonly then 'quoted text'
+done -eu x=1 'quoted text' printf
+		done local $(pwd) && cd /usr/bin
+	"$@" -eu --verbose then x=1
+		local "$@" test 'quoted text'
+	done -eu --verbose "$@" local "$@" printf
+"$1" /usr/bin export "$1" --verbose done 2>/dev/null
+		done sed done /usr/bin /usr/bin /usr/bin printf test 2>/dev/null test then awk
+	$(pwd) then awk | cd x=1 ${HOME} then readonly | && sed --verbose local done test
+	"$1" printf readonly /usr/bin sed && 'quoted text' x=1 awk cd printf
+	-eu ${HOME} x=1 awk "$1" local --verbose "$@" | local "$@" "$1" test readonly printf
+		awk ${HOME} export | 2>/dev/null --verbose export -eu done "$1" $(pwd)
+		cd -eu && readonly awk $(pwd)
+done awk "$1" cd export | done printf | grep -eu awk readonly printf x=1 sed
+	-eu /usr/bin echo /usr/bin 2>/dev/null echo ${HOME} printf then
+	| $(pwd) "$@" 2>/dev/null && test cd readonly grep
+		cd /usr/bin /usr/bin readonly "$@" then readonly "$1" then readonly
+		--verbose "$@" 'quoted text' readonly
+		test $(pwd) /usr/bin "$@" done ${HOME} then 'quoted text' 'quoted text'
+		grep 'quoted text' "$@" $(pwd) then x=1 test 2>/dev/null
+		cd echo sed $(pwd) sed done 'quoted text' 2>/dev/null printf
+		${HOME} sed x=1 sed echo 2>/dev/null "$1" sed echo awk /usr/bin $(pwd)
+		cd cd /usr/bin cd cd printf sed "$1"
+		-eu "$@" 2>/dev/null ${HOME} local && sed export | readonly
+	done | x=1 -eu x=1 done && -eu --verbose awk test cd
+	then 'quoted text' |
+		x=1 | -eu --verbose test --verbose sed ${HOME} "$@"
+		grep | "$1" --verbose -eu x=1 readonly export --verbose | x=1 readonly
+	--verbose done "$@" "$1" x=1 readonly --verbose -eu local && /usr/bin x=1 cd "$1"
+grep ${HOME} "$1" test --verbose local x=1 awk readonly -eu test cd echo test
+$(pwd) && && done then ${HOME} sed export $(pwd)
+x=1 awk 'quoted text' echo
+export grep cd "$1" && 2>/dev/null
+local echo test export printf $(pwd) -eu printf && && -eu
+	-eu ${HOME} readonly readonly printf then | grep && "$@" echo
+		&& awk done awk --verbose | then export grep && x=1 cd "$1" ${HOME}
+	test sed "$@" /usr/bin printf
+	export 2>/dev/null echo done cd test $(pwd) sed && "$@" cd x=1 && x=1
+	then ${HOME} 2>/dev/null done /usr/bin export --verbose
+		2>/dev/null "$1" local local printf cd test grep ${HOME} done
+	$(pwd) awk cd 'quoted text'
+	x=1 done done printf x=1 readonly awk && 'quoted text'
+local done done ${HOME} 2>/dev/null echo 'quoted text' printf && 'quoted text'
+	| local $(pwd) awk 2>/dev/null readonly then awk export local x=1 2>/dev/null
+printf -eu | 'quoted text' export "$1" "$1" ${HOME} --verbose cd
+local sed && local "$1" echo /usr/bin
+		readonly && cd x=1 && readonly 2>/dev/null export "$@" 'quoted text' then 'quoted text'
+	awk test cd -eu | "$@" x=1
+	local && 'quoted text' then $(pwd) "$1" 2>/dev/null 'quoted text' printf
+	x=1 2>/dev/null | -eu export && then export 'quoted text'
+test grep 2>/dev/null --verbose && && -eu ${HOME} /usr/bin x=1 && done
+test awk "$@" ${HOME} test "$@" 2>/dev/null
+	$(pwd) 2>/dev/null x=1 | then awk grep export echo local
+		"$1" "$@" then | 'quoted text' then test sed "$1" export local
+| -eu && awk && -eu $(pwd) && sed /usr/bin ${HOME} then echo
+$(pwd) printf printf done | test "$@" "$1" readonly -eu cd -eu sed
+&& echo x=1 cd x=1 ${HOME} $(pwd)
+printf $(pwd) --verbose x=1 then
+		readonly grep 'quoted text' "$1" 'quoted text' test "$@" $(pwd) x=1 printf
+	local --verbose printf awk awk printf export echo x=1 $(pwd) ${HOME}
+	done | && echo then export
+	sed | printf grep then x=1 local && awk
+-eu local "$1" echo sed local x=1 | ${HOME} local
+		2>/dev/null cd then "$1" printf "$@" grep 'quoted text' local test -eu
+cd printf cd then && "$1" "$1" x=1 echo then cd cd 2>/dev/null
+		--verbose 2>/dev/null x=1 ${HOME} "$1" local "$@" printf
+	then printf local test local echo
+		test --verbose readonly /usr/bin "$@" readonly "$1" export sed 'quoted text'
+--verbose "$@" /usr/bin local export
+		| -eu echo export $(pwd) readonly ${HOME}
+local -eu then grep 'quoted text' awk 'quoted text' sed echo && x=1 ${HOME}
+		printf grep cd 2>/dev/null $(pwd)
+		test printf "$@" echo echo && then /usr/bin --verbose "$1" ${HOME} "$@"
+		--verbose -eu -eu sed x=1 readonly $(pwd) 2>/dev/null && "$@" echo | readonly
+	echo && export done awk --verbose -eu |
+readonly --verbose local cd sed test 'quoted text' grep then "$@" "$1"
+local grep -eu "$1" 'quoted text'
+		grep then | $(pwd) sed readonly /usr/bin sed readonly --verbose grep printf
+	echo | "$1" then | | echo 2>/dev/null 'quoted text' test local grep 'quoted text'
+		printf cd /usr/bin ${HOME} && printf test "$@" echo 2>/dev/null
+$(pwd) x=1 readonly x=1 local && local "$1" awk && sed -eu
+&& && && cd awk printf /usr/bin && awk
+		"$@" local cd readonly --verbose cd x=1 readonly readonly
+| printf done x=1 cd readonly 'quoted text'
+	| awk cd --verbose test
+'quoted text' sed ${HOME} done
+&& then | sed "$1" then test export sed "$1"
+sed sed done done && "$1"
+local $(pwd) test 'quoted text'
+awk && "$1" 2>/dev/null readonly /usr/bin 2>/dev/null sed "$1" && sed done
+$(pwd) 2>/dev/null --verbose echo --verbose
+'quoted text' 'quoted text' 'quoted text'
+printf cd ${HOME} cd grep --verbose -eu echo test x=1 /usr/bin grep --verbose
+	"$@" 2>/dev/null done $(pwd)
+		readonly local cd export cd "$1" $(pwd) /usr/bin local "$@" --verbose
+${HOME} && | readonly test 'quoted text' cd grep 2>/dev/null printf "$1"
+'quoted text' ${HOME} && echo done sed local
+	echo 2>/dev/null echo ${HOME} -eu && 2>/dev/null
+	readonly sed x=1 'quoted text' test x=1 -eu 2>/dev/null x=1 grep
+x=1 sed readonly | local
+'quoted text' "$@" export -eu x=1 grep --verbose
+	grep "$1" && grep printf then "$1" echo awk 2>/dev/null -eu done local && test $(pwd)
+		--verbose -eu && printf echo test cd readonly sed && "$1" | "$1" && test
+		${HOME} echo echo done && x=1 local sed x=1 sed grep | export echo
+	2>/dev/null $(pwd) "$@" test ${HOME} cd 'quoted text' 2>/dev/null then echo 2>/dev/null
+		cd 2>/dev/null then 'quoted text' -eu --verbose $(pwd) ${HOME} sed $(pwd) sed
+	--verbose cd 2>/dev/null "$1" 2>/dev/null then --verbose printf then test -eu
+	done readonly test awk test done | 2>/dev/null | "$@" sed awk grep x=1 echo
+		done readonly /usr/bin echo test cd $(pwd) | 'quoted text' then
+		test --verbose echo readonly export
+	grep -eu | sed 'quoted text' awk /usr/bin /usr/bin 2>/dev/null echo sed -eu export
+	done && awk sed x=1 echo --verbose cd then local
+	&& awk /usr/bin /usr/bin -eu ${HOME}
+"$1" | ${HOME} test readonly | 'quoted text' -eu | cd grep printf
+		readonly && then 2>/dev/null --verbose $(pwd) sed cd cd $(pwd) local -eu awk 2>/dev/null
+		2>/dev/null ${HOME} done awk -eu export done --verbose --verbose sed export awk
+--verbose export 'quoted text' export --verbose export
+		'quoted text' $(pwd) cd local export
+		test readonly | "$@" done cd 2>/dev/null && "$@" $(pwd) --verbose
+${HOME} -eu && readonly printf
+	"$1" done done "$1" printf --verbose
+	readonly 'quoted text' -eu 'quoted text'
+done cd awk "$1" 2>/dev/null $(pwd) ${HOME} awk awk then ${HOME}
+"$@" sed local then sed local awk then /usr/bin
+	"$@" | awk | x=1 | "$@" export x=1 $(pwd) | printf
+		echo local echo 2>/dev/null 2>/dev/null cd done grep
+	done $(pwd) | printf printf done echo awk | /usr/bin 'quoted text'
+		test && "$@" x=1 "$@" --verbose "$@" x=1 -eu printf
+2>/dev/null /usr/bin "$1" readonly --verbose echo /usr/bin "$@" $(pwd)
+		local test cd 2>/dev/null test "$@" | then -eu printf printf
+	| 2>/dev/null | /usr/bin x=1 echo $(pwd) echo then local done printf
+2>/dev/null awk export export 'quoted text'
+		printf "$1" echo "$@" export local $(pwd)
+	2>/dev/null done awk cd cd awk -eu
+	sed grep grep -eu grep readonly
+"$@" done readonly -eu then --verbose --verbose
+| /usr/bin -eu then test
+	done | test 'quoted text' "$1"
+		&& grep -eu -eu 2>/dev/null x=1 then sed test local "$1" done
+test sed local sed 'quoted text' $(pwd) "$1"
+	sed export test && 2>/dev/null then "$@"
+		readonly x=1 | awk readonly awk export grep awk ${HOME} 'quoted text'
+2>/dev/null "$1" x=1 cd echo "$@" grep | echo readonly /usr/bin --verbose "$1"
+	"$@" ${HOME} "$@" readonly | &&
+	printf ${HOME} sed x=1 sed export export grep 2>/dev/null then test printf
+	'quoted text' 2>/dev/null
+$(pwd) x=1 local | 'quoted text' --verbose
+		"$@" "$@" done "$1" | | cd echo $(pwd)
+	$(pwd) --verbose /usr/bin export $(pwd) test grep | awk "$@" cd export grep
+test && test sed | local "$@" | --verbose
+		sed /usr/bin $(pwd) ${HOME} "$1" x=1 $(pwd) cd | "$1" test | --verbose grep grep
+x=1 echo --verbose "$@" && && export readonly "$@" && x=1 cd --verbose
+	local 'quoted text' $(pwd) export echo test
+	awk readonly "$1" | 2>/dev/null cd &&
+	2>/dev/null done --verbose cd export $(pwd) cd 2>/dev/null
+	sed && | --verbose local printf $(pwd)
+"$1" readonly cd done grep "$1" 2>/dev/null "$@"
+		| sed --verbose | "$@" local grep awk 2>/dev/null test
+	"$@" x=1 cd echo "$1" $(pwd) 'quoted text' -eu "$1" awk
+$(pwd) local "$@" readonly /usr/bin /usr/bin ${HOME} && --verbose 'quoted text'
+x=1 x=1 echo /usr/bin grep $(pwd) "$1" -eu export cd ${HOME} "$@" grep
+&& printf done done 2>/dev/null 'quoted text' "$1" ${HOME} then &&
+"$@" readonly local echo grep 'quoted text'
+		x=1 | -eu readonly cd printf --verbose "$@" local export --verbose grep readonly
+	sed printf test then /usr/bin x=1
+	'quoted text' sed | local $(pwd) /usr/bin printf
+	"$@" sed test readonly
+/usr/bin echo grep printf export ${HOME} ${HOME} "$1" awk ${HOME} export
+		then done done export -eu "$@" 'quoted text' "$@"
+		local awk | $(pwd) sed test /usr/bin echo 2>/dev/null
+awk grep x=1 && echo test ${HOME} "$@" test done -eu readonly
+cd then export /usr/bin sed awk cd export readonly echo export echo
+		sed awk "$@" /usr/bin 2>/dev/null
+	awk readonly && echo 'quoted text' "$1"
+--verbose done grep then
+		then && readonly "$@" grep local sed grep "$1" test 'quoted text'
+		then "$1" local x=1 --verbose
+		done && done -eu done sed $(pwd) export
+'quoted text' export --verbose then
+	| | readonly readonly printf x=1 echo
+then printf -eu grep grep | echo sed sed local printf "$@"
+	done sed && cd && test /usr/bin /usr/bin ${HOME} "$@" /usr/bin && test sed 2>/dev/null
+	2>/dev/null readonly cd $(pwd)
+	sed export --verbose 2>/dev/null x=1 done 'quoted text' -eu --verbose
+	-eu "$@" | -eu --verbose
+2>/dev/null 2>/dev/null readonly
+		printf && "$1" x=1 printf cd | 'quoted text' ${HOME} sed && then ${HOME} cd
+awk sed sed "$@" then $(pwd) test "$@" then --verbose
+		printf echo 2>/dev/null x=1 done 'quoted text' test printf
+	readonly cd local && --verbose printf
+	&& --verbose grep sed | && "$1" 2>/dev/null /usr/bin
+	/usr/bin grep grep awk -eu /usr/bin
+		grep --verbose echo "$1" "$@" test grep local then local 2>/dev/null then
+		test -eu sed then cd sed sed local grep && done /usr/bin grep 2>/dev/null
+export awk "$1" /usr/bin cd export local 2>/dev/null test then awk
+--verbose echo local 'quoted text' --verbose "$1" x=1 --verbose cd ${HOME}
+${HOME} ${HOME} "$@" grep
+awk 'quoted text' "$1" | export sed | sed then export local test "$1" | readonly
+		readonly done export x=1 $(pwd) "$1" && cd $(pwd)
+		"$1" awk -eu cd cd 2>/dev/null "$@" done echo grep x=1 readonly done -eu -eu export
+	then readonly test && --verbose x=1 /usr/bin echo ${HOME}
+done echo test readonly then "$1" x=1 grep 2>/dev/null readonly local
+	--verbose sed cd --verbose printf then "$@" $(pwd) sed ${HOME} "$1" awk -eu
+export printf readonly echo printf ${HOME}
+		&& grep | then awk ${HOME} $(pwd) --verbose -eu cd readonly $(pwd) -eu then awk
+		/usr/bin && export grep awk "$@" printf done awk printf | "$1" then
+		| -eu "$1" export cd cd "$@" -eu "$1" "$1" sed grep local echo
+| export export local -eu $(pwd) awk awk
+export ${HOME} "$1" then ${HOME} | local then echo --verbose
+		$(pwd) /usr/bin && cd grep ${HOME} export cd then -eu
+sed 'quoted text' ${HOME} sed local "$@"
+	${HOME} echo --verbose
+		-eu sed "$1" grep echo -eu | export grep /usr/bin && ${HOME}
+		cd readonly test "$1" "$@" x=1 printf /usr/bin sed export sed export
+		printf export done readonly awk -eu grep -eu cd 'quoted text'
+	$(pwd) | && x=1 /usr/bin test cd ${HOME} test "$@" then readonly 'quoted text'
+		echo sed | 'quoted text' /usr/bin ${HOME} && printf | "$1" && --verbose
+	cd x=1 -eu local echo printf
+		then sed awk "$1" ${HOME} done "$1" /usr/bin then test
+export && 2>/dev/null x=1 grep local
+	test readonly 'quoted text' printf readonly "$@" $(pwd)
+readonly | "$1" test test export "$@" sed printf cd done test "$@" readonly
+		echo ${HOME} awk 'quoted text'
+"$1" printf | awk local 2>/dev/null awk "$1" printf
+$(pwd) | 2>/dev/null
+		grep then then echo "$@" done --verbose ${HOME} ${HOME} local "$@" test
+"$@" printf awk --verbose ${HOME} "$1" printf local
+		"$1" && 'quoted text'
+then local readonly echo readonly && $(pwd) test "$@" -eu /usr/bin
+		test 'quoted text' awk x=1
+printf printf export 2>/dev/null awk sed --verbose "$@" done readonly
+	$(pwd) "$@" cd then $(pwd) | $(pwd) done
+	-eu done readonly x=1 'quoted text'
+		sed $(pwd) && 2>/dev/null done
+	| local -eu $(pwd) grep
+		&& export /usr/bin -eu done awk $(pwd) "$@" grep --verbose "$@" --verbose
+		${HOME} ${HOME} export -eu printf echo $(pwd) test awk cd x=1 sed echo "$@"
+/usr/bin test /usr/bin then 'quoted text' &&
+		readonly $(pwd) | 'quoted text'
+printf --verbose x=1 test local 2>/dev/null awk cd
+	readonly && grep done done $(pwd) && -eu done cd sed --verbose --verbose ${HOME}
+		"$@" printf then then /usr/bin x=1 awk x=1 printf --verbose echo 2>/dev/null
+		local /usr/bin "$1" /usr/bin sed
+	&& --verbose -eu test printf readonly
+$(pwd) -eu && printf done awk
+| test printf $(pwd) "$1" $(pwd) export --verbose ${HOME}
+2>/dev/null $(pwd) then ${HOME} echo x=1 awk x=1 "$1" printf | -eu /usr/bin
+${HOME} | then awk | export cd
+	then printf readonly grep | readonly 2>/dev/null --verbose
+echo 2>/dev/null grep -eu done | readonly
+	/usr/bin test -eu local $(pwd) printf --verbose grep --verbose && 2>/dev/null
+		-eu --verbose -eu ${HOME} x=1 done 'quoted text' ${HOME} grep readonly
+		&& | -eu printf | "$@" test awk | x=1 readonly --verbose $(pwd)
+	readonly && done then "$1" echo test $(pwd) -eu x=1 --verbose
+	/usr/bin awk -eu printf
+		echo awk /usr/bin && | echo echo test cd printf 'quoted text'
+	test $(pwd) sed sed --verbose && sed && x=1 local
+		grep x=1 grep echo 2>/dev/null
+		done "$1" readonly && --verbose
+	| --verbose && 'quoted text' cd --verbose done then local
+	/usr/bin readonly grep awk sed -eu $(pwd) && $(pwd) /usr/bin printf -eu cd
+$(pwd) grep local ${HOME} 2>/dev/null --verbose 2>/dev/null printf echo
+		| && local readonly && export "$1" -eu local
+	awk echo cd --verbose $(pwd) /usr/bin -eu printf grep /usr/bin 'quoted text'
+${HOME} "$@" local then sed test awk x=1 grep printf ${HOME} && --verbose --verbose
+	/usr/bin -eu local -eu echo $(pwd) 'quoted text'
+awk then done grep test -eu sed test $(pwd) awk readonly readonly
+		2>/dev/null sed "$1" done x=1 done --verbose | "$1" --verbose | 2>/dev/null
+$(pwd) export awk test readonly
+		grep 2>/dev/null /usr/bin "$1"
+done awk 2>/dev/null x=1 local && --verbose ${HOME} x=1 cd 2>/dev/null
+		/usr/bin awk ${HOME} sed readonly grep
+"$1" && --verbose && printf awk ${HOME}
+		done 2>/dev/null then | -eu 2>/dev/null && 'quoted text' done sed x=1 sed &&
+		&& x=1 local sed --verbose
+&& test then -eu -eu printf 'quoted text'
+x=1 $(pwd) then export readonly && cd awk | grep
+	/usr/bin "$1" -eu -eu --verbose $(pwd) 'quoted text'
+		awk | cd cd -eu ${HOME} | export x=1 echo sed local
+cd cd ${HOME} local done $(pwd) export then local readonly
+	x=1 printf printf then
+	test $(pwd) readonly echo x=1 "$@" x=1
+	then "$@" local then "$1" && grep ${HOME}
+-eu ${HOME} -eu -eu export ${HOME} "$@" | ${HOME} test
+--verbose 'quoted text' test ${HOME} | grep grep "$@"
+		/usr/bin echo export 2>/dev/null printf printf
+	"$@" 2>/dev/null then test 2>/dev/null test
+		&& -eu --verbose $(pwd) $(pwd) grep
+		printf | cd --verbose
+		then done local cd local then --verbose "$@" awk readonly
+	| ${HOME} -eu printf sed ${HOME} ${HOME} grep echo --verbose echo | printf printf
+sed 'quoted text' sed && x=1 echo 2>/dev/null test ${HOME} cd grep
+| export -eu sed --verbose
+		2>/dev/null grep "$1" "$1" awk $(pwd) export awk export -eu test $(pwd)
+		'quoted text' echo printf $(pwd) && "$1" then cd printf printf "$@"
+"$1" local sed cd test cd awk | printf local readonly $(pwd) /usr/bin /usr/bin
+	/usr/bin printf /usr/bin ${HOME} export
+readonly 'quoted text' x=1 sed export cd 2>/dev/null
+		/usr/bin --verbose cd cd "$@" -eu sed
+	echo "$@" then | "$@" awk $(pwd) /usr/bin | /usr/bin then 'quoted text'
+		then test test grep $(pwd) local grep sed cd grep printf | "$1" readonly &&
+	x=1 | 2>/dev/null --verbose 'quoted text'
+	printf | cd echo export "$@" "$@" /usr/bin sed --verbose
+		then "$1" ${HOME} readonly
+grep awk echo echo 2>/dev/null 'quoted text' awk 'quoted text'
+		awk grep sed cd test echo done "$@" echo sed
+-eu $(pwd) /usr/bin echo export export | printf
+	local 2>/dev/null printf done $(pwd) x=1 2>/dev/null 2>/dev/null | sed echo
+		| cd readonly ${HOME} printf then export 'quoted text' | done
+		$(pwd) /usr/bin export x=1 | 2>/dev/null --verbose printf "$1" 'quoted text'
+done --verbose /usr/bin x=1 done 'quoted text' grep cd
+	"$1" | echo readonly cd /usr/bin
+	awk local grep sed export
+| x=1 "$@" local grep readonly printf "$1" /usr/bin done | sed
+sed && grep 2>/dev/null export sed readonly done /usr/bin readonly grep $(pwd) "$1"
+echo /usr/bin "$@" 'quoted text' sed local grep test
+$(pwd) done && local "$1" $(pwd) x=1 sed
+	grep 'quoted text' /usr/bin
+-eu --verbose "$1" export printf test local
+readonly "$1" x=1 printf | cd printf sed x=1 readonly ${HOME}
+	2>/dev/null echo cd "$1" export 'quoted text'
+		grep then echo "$1" "$@" | readonly && ${HOME} sed 2>/dev/null
+export | -eu ${HOME} export 'quoted text' ${HOME}
+		'quoted text' | "$@" ${HOME} $(pwd) local "$1" | /usr/bin grep $(pwd) cd
+printf -eu readonly ${HOME} export done -eu
+		$(pwd) test grep awk
+	$(pwd) /usr/bin $(pwd) $(pwd) local /usr/bin x=1 "$@" 2>/dev/null
+		${HOME} ${HOME} /usr/bin cd sed 'quoted text' 'quoted text' sed -eu
+		"$@" sed export cd -eu 'quoted text' grep printf 2>/dev/null $(pwd) 'quoted text'
+		${HOME} printf cd then awk done grep awk echo "$1" cd awk ${HOME} 'quoted text'
+export grep 2>/dev/null /usr/bin "$@" printf $(pwd) sed | x=1
+echo 2>/dev/null done echo
+awk x=1 ${HOME} done "$1" awk
+		"$1" done echo sed ${HOME} readonly export test done
+--verbose awk local readonly /usr/bin
+		readonly ${HOME} grep 'quoted text' local awk && && 2>/dev/null
+	${HOME} test "$1" export x=1 $(pwd) export done /usr/bin
+	"$1" done awk /usr/bin
+	x=1 'quoted text' 2>/dev/null done export
+	$(pwd) | --verbose readonly export --verbose
+		$(pwd) local local sed printf
+		"$@" export && then readonly x=1 test x=1 sed "$@" x=1 test | ${HOME} done ${HOME}
+		| -eu "$@" then $(pwd) done done
+	then then 2>/dev/null -eu grep 'quoted text' "$1" done grep 'quoted text' cd ${HOME}
+		"$1" local echo /usr/bin $(pwd) &&
+		/usr/bin --verbose 2>/dev/null sed
+grep grep printf /usr/bin ${HOME} "$1" echo readonly printf 2>/dev/null
+	readonly x=1 x=1 sed 2>/dev/null printf -eu export
+/usr/bin | --verbose /usr/bin echo sed grep -eu "$1" 2>/dev/null
+		done readonly /usr/bin cd $(pwd) /usr/bin /usr/bin "$1" echo && -eu
+		${HOME} export "$@" "$@" "$@" x=1 $(pwd)
+done then /usr/bin printf test sed
+	"$1" | export done local sed then 'quoted text' readonly done ${HOME}
+		&& ${HOME} grep "$1" readonly cd | && cd "$1" cd 2>/dev/null
+2>/dev/null "$1" readonly $(pwd) cd "$@"
+echo && awk sed then cd sed
+		| local test local "$@" test x=1 printf && /usr/bin
+		'quoted text' && "$@" --verbose then done test done -eu /usr/bin -eu cd printf
+		x=1 x=1 /usr/bin 2>/dev/null
+awk test export | --verbose awk
+$(pwd) ${HOME} grep "$@" $(pwd) awk 'quoted text' | export
+| ${HOME} "$1" printf printf x=1 && ${HOME} $(pwd) "$1" cd |
+		local $(pwd) export grep
+	readonly grep done /usr/bin ${HOME} 'quoted text' readonly sed sed 'quoted text'
+export echo test echo 2>/dev/null done "$1" "$1" readonly readonly echo
+local ${HOME} 'quoted text' test "$@"
+-eu "$@" awk "$@" grep export
+-eu test export local echo done 'quoted text' cd /usr/bin export then -eu test
+	'quoted text' test awk export x=1 sed "$1" readonly | ${HOME}
+	-eu awk test sed "$1" readonly printf 2>/dev/null 'quoted text'
+		'quoted text' echo 'quoted text' --verbose test sed grep local && &&
+-eu /usr/bin sed /usr/bin local local $(pwd) echo readonly
+$(pwd) cd ${HOME} --verbose done "$@" readonly ${HOME}
+	--verbose local "$@" && sed then printf sed --verbose "$1" sed awk x=1 export
+readonly then grep awk awk then echo $(pwd) grep sed local done 2>/dev/null local
+x=1 -eu grep done echo 2>/dev/null
+then -eu -eu local -eu
+		sed readonly then echo then export "$@" && 'quoted text' /usr/bin $(pwd) | x=1
+		export --verbose --verbose --verbose -eu readonly echo $(pwd) readonly
+cd test echo -eu awk test ${HOME} ${HOME}
+	-eu ${HOME} && then local "$1" 2>/dev/null printf 2>/dev/null
+		cd --verbose /usr/bin && sed grep test
+		cd test 'quoted text' 'quoted text' x=1 x=1 && | then echo | /usr/bin readonly grep
+	awk sed "$@" /usr/bin | printf
+		export $(pwd) $(pwd) printf export export cd printf
+		done export --verbose export
+	grep cd /usr/bin "$1" export export -eu 2>/dev/null awk local
+		x=1 --verbose | cd awk
+		-eu "$1" 2>/dev/null awk grep x=1 2>/dev/null done --verbose 'quoted text'
+		done then "$1" then cd -eu printf 'quoted text' export x=1 "$1" ${HOME}
+| ${HOME} ${HOME} 'quoted text' --verbose --verbose printf "$@" 'quoted text'
+		awk sed x=1 local | done | ${HOME} ${HOME} sed -eu /usr/bin 'quoted text' x=1
+	'quoted text' then printf "$1" 2>/dev/null done x=1 grep echo -eu sed
+		-eu /usr/bin export --verbose 2>/dev/null cd echo
+cd x=1 "$1" --verbose cd 2>/dev/null "$@" && | x=1 /usr/bin
+		$(pwd) sed /usr/bin "$@" done done x=1 'quoted text' /usr/bin
+		${HOME} sed x=1 grep echo | $(pwd) ${HOME} x=1 export
+'quoted text' local test /usr/bin
+		-eu awk awk printf --verbose grep grep
+sed "$@" test && 2>/dev/null /usr/bin ${HOME} $(pwd) && ${HOME} grep test
+local "$1" && echo "$1"
+		"$@" cd x=1 -eu x=1 x=1 local && grep printf echo export 'quoted text'
+	test cd test 2>/dev/null printf readonly printf awk --verbose 'quoted text' export
+cd grep readonly local
+		2>/dev/null grep /usr/bin export awk then "$@" done test cd && done sed
+'quoted text' --verbose ${HOME} "$@" /usr/bin done
+		done -eu grep awk && readonly | grep cd then grep sed 2>/dev/null
+	grep awk printf /usr/bin
+		echo /usr/bin then ${HOME} &&
+		test test 'quoted text' -eu test printf "$@" -eu 'quoted text' done done
+x=1 "$@" readonly sed "$@" local 'quoted text' ${HOME} | | readonly
+sed && printf && "$1" cd /usr/bin && grep awk test "$1"
+	x=1 sed -eu ${HOME} echo grep local test local
+	--verbose --verbose /usr/bin x=1 readonly
+echo "$@" grep --verbose 'quoted text'
+cd done printf "$@" && | && readonly sed "$1"
+	local "$1" done awk 2>/dev/null awk printf 2>/dev/null
+	cd /usr/bin awk --verbose "$1" -eu cd sed readonly &&
+"$@" test then awk printf printf && echo then /usr/bin
+grep | cd sed "$1" --verbose printf
+	"$1" echo | then done local /usr/bin test grep ${HOME} 2>/dev/null
+	"$@" 2>/dev/null printf grep && $(pwd) "$@" /usr/bin echo --verbose
+	done 2>/dev/null echo sed local $(pwd) /usr/bin -eu cd "$1" awk
+-eu sed grep then printf local /usr/bin 'quoted text'
+		x=1 local cd 'quoted text' done x=1 test
+		x=1 grep 'quoted text' cd 2>/dev/null export
+local $(pwd) then echo && ${HOME} grep 2>/dev/null awk done
+	export 2>/dev/null readonly --verbose "$@" awk printf local ${HOME} test | |
+	then grep local && awk ${HOME} printf -eu "$@" awk $(pwd)
+x=1 then sed x=1 export 2>/dev/null test --verbose
+		x=1 ${HOME} x=1 -eu | awk
+	"$@" x=1 /usr/bin done /usr/bin local $(pwd) x=1 --verbose
+x=1 'quoted text' /usr/bin | -eu --verbose readonly printf
+		sed printf 2>/dev/null $(pwd) && "$1" test sed "$1" printf /usr/bin readonly
+echo "$1" export test cd 2>/dev/null
+		2>/dev/null test "$@" "$@" --verbose 'quoted text' readonly done ${HOME}
+printf printf awk | $(pwd) test | && $(pwd) readonly -eu printf
+'quoted text' 'quoted text' --verbose printf export | "$@" x=1 | x=1
+	--verbose test /usr/bin local local 'quoted text'
+then 'quoted text' "$1" printf echo /usr/bin then ${HOME}
+	done 'quoted text' then echo 2>/dev/null done 'quoted text' 2>/dev/null /usr/bin
+	-eu test done grep test --verbose sed --verbose
+		awk ${HOME} export "$1" --verbose -eu awk 'quoted text' /usr/bin /usr/bin readonly
+		export | /usr/bin && awk && "$1" 'quoted text' /usr/bin local
+	awk sed "$1" "$@" local echo then sed
+test test local 'quoted text' "$1" printf cd echo sed done $(pwd) ${HOME} && export
+/usr/bin export -eu grep
+done done | readonly cd "$@"
+"$1" export "$1" "$1" sed echo "$1" -eu cd
+		--verbose /usr/bin && 2>/dev/null
+| test "$@" x=1 then local echo 2>/dev/null 'quoted text' &&
+then cd awk local -eu "$1" /usr/bin awk --verbose echo ${HOME} /usr/bin
+	-eu /usr/bin ${HOME} "$@" local test $(pwd)
+2>/dev/null awk 'quoted text' --verbose
+		2>/dev/null export 2>/dev/null
+	$(pwd) cd export | 2>/dev/null then x=1 $(pwd) 2>/dev/null
+-eu -eu printf && grep x=1 ${HOME}
+${HOME} "$@" /usr/bin readonly --verbose export
+	--verbose printf | echo
+	echo then -eu test test --verbose
+	/usr/bin "$@" done -eu grep && local ${HOME} 'quoted text' 'quoted text'
+		printf export sed local export
+		cd awk "$@" 2>/dev/null 2>/dev/null -eu done printf then "$1" readonly
+		2>/dev/null test printf && ${HOME} "$1" -eu $(pwd)
+		--verbose local 'quoted text' ${HOME} /usr/bin 2>/dev/null $(pwd)
+2>/dev/null readonly test x=1 awk x=1 'quoted text'
+		echo $(pwd) && | echo $(pwd)
+	-eu --verbose done "$@" /usr/bin sed readonly test readonly
+		test 2>/dev/null readonly readonly "$1"
+		${HOME} echo readonly then --verbose ${HOME} --verbose
+	local x=1 sed | "$1" then 2>/dev/null 2>/dev/null | grep
+echo readonly "$1" readonly cd && printf
+/usr/bin "$1" then | readonly 2>/dev/null --verbose done
+		-eu sed --verbose sed local sed x=1 && 2>/dev/null
+		'quoted text' -eu done then --verbose --verbose test
+		"$1" /usr/bin -eu grep sed -eu local test 'quoted text'
+	cd awk cd cd x=1 "$@" done x=1 cd x=1 printf
+${HOME} -eu readonly readonly export
+		export && $(pwd) sed done | done done
+-eu local 2>/dev/null export -eu awk sed /usr/bin awk
+		grep grep local awk awk cd 'quoted text' local grep
+awk -eu "$1" x=1 $(pwd) && export then cd --verbose readonly test
+$(pwd) grep "$1" 2>/dev/null 'quoted text' --verbose && "$@"
+		printf then echo "$@" printf
+&& printf /usr/bin printf test printf
+	x=1 awk export | grep awk -eu export x=1 test test /usr/bin ${HOME} done
+"$@" x=1 echo /usr/bin "$@" "$1" echo echo
+		printf x=1 grep test cd grep $(pwd)
+		export readonly $(pwd) 2>/dev/null "$1"
+		grep && sed "$@" 'quoted text' -eu 'quoted text' awk sed 'quoted text'
+&& x=1 sed awk --verbose "$@" test readonly $(pwd) local then readonly sed
+	then x=1 done grep "$1" awk awk x=1 x=1 'quoted text'
+	'quoted text' ${HOME} test --verbose grep echo grep
+	grep local printf -eu
+	printf local 2>/dev/null awk "$@" local
+| sed test test | echo "$@" local
+"$1" grep local /usr/bin local local --verbose --verbose grep x=1 sed cd
+	test 2>/dev/null "$@" cd -eu done grep --verbose then printf | $(pwd) -eu ${HOME}
+'quoted text' && "$@" readonly
+		printf "$@" /usr/bin -eu printf sed sed echo sed --verbose "$@" x=1 /usr/bin
+		--verbose grep export ${HOME}
+		-eu awk | then sed 2>/dev/null && test test then "$@" /usr/bin
+	--verbose printf 'quoted text' grep sed "$1" printf done "$@"
+test -eu $(pwd) echo "$1" export --verbose
+		export ${HOME} readonly awk "$@" -eu "$1" local test x=1 -eu cd
+		x=1 test $(pwd) 'quoted text' export grep printf
+-eu cd cd "$@" echo sed "$@" --verbose ${HOME}
+local readonly && test -eu export then $(pwd)
+	grep awk 2>/dev/null -eu done "$1" -eu printf done
+		$(pwd) awk done sed 'quoted text'
+--verbose ${HOME} done /usr/bin local awk x=1 test x=1 grep | awk printf
+$(pwd) then 'quoted text' echo
+	&& 2>/dev/null sed 2>/dev/null awk "$@"
+		2>/dev/null printf ${HOME} "$1" test | done x=1 test test | "$@"
+	printf "$@" echo -eu grep /usr/bin grep awk readonly
+2>/dev/null then export export readonly then done
+echo echo "$1" "$@" 'quoted text' -eu x=1 "$1"
+done && $(pwd) grep cd --verbose
+	--verbose cd x=1 2>/dev/null
+	awk $(pwd) readonly -eu 2>/dev/null then $(pwd) /usr/bin echo sed echo /usr/bin
+		export then && ${HOME} 'quoted text' test "$1"
+	${HOME} $(pwd) local "$1" 'quoted text' grep ${HOME} "$1"
+	| 2>/dev/null readonly "$@" "$@" echo 'quoted text' grep
+		--verbose "$@" sed | x=1 2>/dev/null
+	echo test sed 2>/dev/null "$1" then printf "$@" grep echo "$1" ${HOME}
+then ${HOME} /usr/bin test export 'quoted text' -eu echo grep /usr/bin
+		/usr/bin | local done test local && grep sed local $(pwd)
+		sed export done 2>/dev/null sed ${HOME} grep
+		&& /usr/bin $(pwd) 'quoted text' done grep && then
+		x=1 && cd ${HOME} | 'quoted text' 'quoted text' grep echo &&
+		local readonly local | "$1" local
+	grep --verbose $(pwd) --verbose cd readonly && readonly -eu x=1 /usr/bin local
+	${HOME} && 'quoted text' local awk done && export sed done sed local
+-eu ${HOME} grep && /usr/bin /usr/bin /usr/bin "$@" export "$1"
+		grep export export test 'quoted text' | echo -eu /usr/bin
+	-eu readonly cd cd echo --verbose | sed -eu test
+	echo readonly readonly local
+		x=1 awk $(pwd) 'quoted text' --verbose then --verbose printf && cd
+test test printf "$@" local "$@" --verbose done -eu then echo grep local awk 'quoted text'
+		"$1" /usr/bin printf /usr/bin
+		--verbose grep echo ${HOME} sed awk done
+/usr/bin awk x=1 x=1 ${HOME} grep readonly
+	echo /usr/bin && awk sed readonly -eu export readonly local
+	-eu -eu then && /usr/bin sed "$1"
+		grep then -eu done done 'quoted text' 'quoted text'
+"$@" test -eu $(pwd) printf $(pwd) then "$1" local
+	grep sed local 2>/dev/null && --verbose
+		x=1 && | --verbose "$1" 2>/dev/null $(pwd) &&
+	x=1 --verbose | printf test | 'quoted text' awk export x=1 then done
+	awk "$@" cd -eu 2>/dev/null echo export cd "$1"
+	/usr/bin printf && printf
+	--verbose export "$1" 'quoted text' && -eu then local
+	${HOME} awk 'quoted text' cd export grep local readonly "$@"
+2>/dev/null grep then grep "$@" printf 'quoted text' test readonly export
+		-eu test sed local --verbose
+then sed | printf $(pwd) ${HOME} --verbose
+		readonly /usr/bin 2>/dev/null readonly printf --verbose then -eu then awk readonly
+	cd readonly local | grep sed ${HOME}
+x=1 sed && readonly test
+	sed "$1" test "$1" ${HOME} local readonly grep 'quoted text' -eu
+		local --verbose printf
+	$(pwd) readonly x=1 echo grep 'quoted text' "$@" readonly "$@" awk /usr/bin
+		| /usr/bin 'quoted text'
+		-eu export "$1" "$@" readonly then done local test "$@" "$@" x=1 done $(pwd) 2>/dev/null
+		cd test then printf && /usr/bin done readonly ${HOME} --verbose export printf
+${HOME} $(pwd) 'quoted text' local
+	done then then test sed awk awk awk 'quoted text' local && "$@" readonly local
+done readonly grep && --verbose export 'quoted text' sed done grep /usr/bin
+		readonly 2>/dev/null x=1 cd done sed | local 2>/dev/null $(pwd) done /usr/bin
+		printf -eu x=1 awk --verbose 'quoted text' done done test
+&& export $(pwd) printf then test done /usr/bin "$@"
+"$1" sed --verbose echo done && x=1 "$@" echo /usr/bin done readonly then x=1 sed
+awk /usr/bin sed ${HOME}
+		/usr/bin done then test $(pwd) readonly local x=1 "$@" echo
+	local ${HOME} done awk --verbose test "$@" cd readonly
+2>/dev/null awk readonly awk export awk | x=1 then export
+awk $(pwd) $(pwd) "$1" /usr/bin cd $(pwd) && ${HOME}
+	readonly 'quoted text'
+		&& --verbose /usr/bin && "$@" printf -eu then awk 2>/dev/null readonly
+"$1" 'quoted text' printf then export echo test --verbose
+	'quoted text' x=1 && sed "$1" awk printf then
+	x=1 ${HOME} $(pwd) awk printf done grep ${HOME} cd 2>/dev/null
+		then 'quoted text' test test x=1 echo | sed "$@"
+	x=1 "$1" | test export grep readonly then cd ${HOME} 'quoted text'
+"$1" $(pwd) | --verbose ${HOME} sed 'quoted text' "$1"
+'quoted text' then readonly local echo
+	done done readonly sed printf && done grep
+	awk --verbose 2>/dev/null echo then cd 'quoted text' grep | echo echo test $(pwd)
+x=1 --verbose -eu $(pwd) && cd echo 'quoted text' echo "$@" export
+	grep cd x=1 local test sed sed awk then printf "$1" "$@"
+	test echo echo cd -eu export
+	test 2>/dev/null && && then test done | "$@"
+		/usr/bin "$@" ${HOME} "$@" $(pwd) ${HOME} "$1"
+${HOME} awk 'quoted text' export readonly -eu readonly echo "$@" local
+cd printf /usr/bin | -eu | echo ${HOME} awk grep /usr/bin 'quoted text' printf &&
+"$1" "$1" ${HOME} awk sed /usr/bin
+-eu sed && test /usr/bin -eu done ${HOME} && $(pwd) sed
+x=1 test readonly export local echo --verbose test | 'quoted text'
+	awk grep echo export readonly printf awk export awk /usr/bin
+	x=1 /usr/bin readonly 'quoted text' /usr/bin "$1" then "$@" sed --verbose printf
+		local done ${HOME} echo done 2>/dev/null sed then done echo --verbose readonly
+/usr/bin 2>/dev/null "$1" echo "$@"
+--verbose --verbose "$@" -eu --verbose && cd "$@"
+	$(pwd) readonly done "$@" readonly sed printf -eu readonly $(pwd) --verbose /usr/bin
+	readonly && --verbose printf $(pwd) /usr/bin
+	printf echo test $(pwd) awk x=1 readonly
+grep export /usr/bin echo
+		sed echo 2>/dev/null | /usr/bin echo test --verbose done readonly
+		done then export local x=1 ${HOME} export export
+	"$1" export echo && awk -eu export echo sed printf done /usr/bin
+		"$1" 2>/dev/null "$1" test echo && -eu awk --verbose awk "$1" x=1 x=1 cd
+$(pwd) sed --verbose export
+	awk test | -eu sed then readonly -eu cd grep x=1 $(pwd) then $(pwd)
+	"$1" export ${HOME} x=1 done $(pwd) test x=1 | /usr/bin
+${HOME} && export cd printf && --verbose local /usr/bin | local ${HOME} cd
+done printf 2>/dev/null "$1" && done export readonly "$1" x=1 echo 'quoted text'
+	grep | && sed readonly printf readonly
+	/usr/bin export sed sed x=1 local
+	local ${HOME} awk grep $(pwd) local readonly grep done "$1" "$@" test "$1"
+	done "$1" awk done readonly ${HOME} test readonly echo sed then -eu printf
+	"$1" $(pwd) /usr/bin grep test ${HOME} local then then &&
+"$1" test ${HOME} --verbose then
+done readonly --verbose readonly -eu && then | 2>/dev/null "$@" export
+	echo -eu /usr/bin 'quoted text' grep | | --verbose test printf awk
+		-eu "$1" echo grep printf grep export $(pwd) $(pwd) readonly
@@ -0,0 +1,2001 @@
+x=1 sed export "$1" ${HOME} local local readonly readonly
+	&& --verbose -eu ${HOME} /usr/bin -eu echo grep
+	then && $(pwd) done $(pwd) printf 'quoted text' 2>/dev/null then ${HOME}
+		printf done ${HOME} then -eu $(pwd) | "$@" 2>/dev/null cd export x=1
+	-eu export done 2>/dev/null readonly printf
+test 'quoted text' echo then then printf
+		then && echo awk $(pwd) x=1 "$1" test --verbose ${HOME} /usr/bin /usr/bin "$1"
+		readonly awk $(pwd) /usr/bin printf cd 2>/dev/null
+2>/dev/null -eu then export &&
+	echo test "$1" done && /usr/bin x=1 "$@" test x=1 cd
+		grep /usr/bin $(pwd) then
+		${HOME} -eu 'quoted text' sed
+		${HOME} grep readonly $(pwd) sed done /usr/bin 2>/dev/null -eu awk
+		cd test /usr/bin done $(pwd) 2>/dev/null done && x=1 local
+		x=1 | local test "$@" local "$1"
+	&& awk ${HOME} export awk --verbose && 'quoted text' readonly && export /usr/bin
+		'quoted text' grep printf $(pwd) export 'quoted text' test echo ${HOME} done sed
+		"$1" | | $(pwd) grep sed grep printf ${HOME} local sed /usr/bin -eu awk
+${HOME} 'quoted text' test $(pwd) cd $(pwd) 2>/dev/null echo awk local
+	sed -eu readonly x=1 awk --verbose 2>/dev/null done grep $(pwd) local -eu then
+		&& 'quoted text' readonly
+		done ${HOME} "$@" done grep test printf
+	readonly -eu -eu 2>/dev/null echo ${HOME} export
+grep cd cd echo --verbose 'quoted text' && 2>/dev/null
+	2>/dev/null 'quoted text' x=1 sed /usr/bin $(pwd)
+sed then -eu && sed $(pwd) cd $(pwd) local sed readonly
+"$@" "$1" ${HOME} local awk "$1" "$1" $(pwd) cd grep -eu then
+		sed /usr/bin --verbose 2>/dev/null | then "$@" -eu
+	x=1 --verbose export sed && export printf grep awk
+${HOME} printf local | 2>/dev/null /usr/bin then "$@" $(pwd) done echo
+printf 'quoted text' printf sed ${HOME} | ${HOME} ${HOME} then
+${HOME} done done done 2>/dev/null
+	$(pwd) && echo /usr/bin cd ${HOME} then cd &&
+x=1 printf x=1 "$1" | --verbose local $(pwd)
+	printf local "$1" --verbose export ${HOME} "$@" ${HOME}
+printf local sed ${HOME} grep ${HOME} then
+	&& 2>/dev/null | x=1 printf echo --verbose then grep
+	awk readonly echo 2>/dev/null then | "$1" 2>/dev/null
+awk awk sed readonly -eu grep
+	--verbose x=1 grep test "$@" 2>/dev/null
+		export grep "$1" "$1" "$1" then && x=1 | ${HOME}
+		printf grep /usr/bin $(pwd) grep 'quoted text' sed test
+$(pwd) echo grep --verbose
+	${HOME} --verbose && awk grep
+		x=1 -eu done x=1 export
+	local local "$1" "$@" then x=1 |
+		test | --verbose -eu cd cd "$1" export --verbose /usr/bin
+test 'quoted text' export sed then sed --verbose
+		$(pwd) 'quoted text' done export test export 2>/dev/null x=1 'quoted text'
+		2>/dev/null echo printf -eu echo
+		2>/dev/null $(pwd) grep printf test then 2>/dev/null
+		"$1" x=1 local echo cd echo then --verbose local
+grep export && && "$@" --verbose echo printf && local grep
+	"$@" "$1" grep | "$1" "$1" then "$@" $(pwd) -eu echo
+	awk "$@" && --verbose 2>/dev/null
+		readonly echo sed -eu
+		/usr/bin readonly -eu test done $(pwd) 2>/dev/null 2>/dev/null /usr/bin
+	--verbose printf && done echo $(pwd) "$@" -eu printf $(pwd)
+		2>/dev/null then echo "$@" then echo
+		readonly then then export --verbose /usr/bin
+	cd sed -eu done "$@" awk local 2>/dev/null "$@" then $(pwd) echo
+		readonly "$@" && "$1" "$@" echo /usr/bin
+done test then done "$@" test printf
+	done && --verbose ${HOME} ${HOME}
+		echo "$@" awk grep grep done then x=1 ${HOME}
+		then cd 'quoted text' echo sed "$@"
+	test x=1 printf 2>/dev/null --verbose "$1" $(pwd) x=1 --verbose
+		readonly /usr/bin awk then --verbose $(pwd) test --verbose
+${HOME} 2>/dev/null test awk done x=1 $(pwd) -eu done "$1" readonly
+	'quoted text' printf "$@" x=1 | local -eu local printf done x=1 $(pwd)
+	-eu | export /usr/bin export cd sed && && printf done printf x=1 done
+then 2>/dev/null ${HOME} then && awk $(pwd) export test
+		test /usr/bin then --verbose --verbose
+		done then grep cd /usr/bin test
+	sed 2>/dev/null printf x=1 --verbose ${HOME} "$@" export then export then
+		/usr/bin && /usr/bin readonly done readonly
+export --verbose 2>/dev/null
+		-eu then 'quoted text' printf printf "$@" -eu 'quoted text' $(pwd)
+		${HOME} "$1" $(pwd) export test --verbose -eu | "$1"
+	export awk "$@" printf echo 'quoted text' sed grep 'quoted text'
+		echo 'quoted text' "$1" "$1" 2>/dev/null cd then
+sed test cd --verbose then done | | $(pwd) --verbose echo then local cd
+-eu awk | done grep cd done export local
+		/usr/bin $(pwd) 2>/dev/null ${HOME} test sed export awk
+	then 2>/dev/null cd awk -eu grep local
+		readonly done printf local done echo local cd $(pwd)
+		cd --verbose "$1" 2>/dev/null
+		2>/dev/null && /usr/bin | x=1 grep 2>/dev/null
+	printf x=1 --verbose 'quoted text'
+		export && 2>/dev/null local export ${HOME} awk --verbose sed
+&& test 2>/dev/null ${HOME} awk -eu | cd "$1" test 'quoted text'
+		readonly /usr/bin test printf awk 2>/dev/null
+		grep done "$1" sed done 2>/dev/null export $(pwd)
+$(pwd) -eu done local cd x=1 "$@" 2>/dev/null
+	awk x=1 test echo | readonly
+"$@" $(pwd) /usr/bin | /usr/bin $(pwd) export done 'quoted text' && -eu "$@"
+		printf --verbose cd awk then --verbose ${HOME} printf sed echo
+	&& 'quoted text' done 'quoted text' | echo then
+	x=1 -eu sed grep done sed readonly
+		test -eu echo echo then then $(pwd) readonly | grep printf "$@" local --verbose
+	"$1" then then done sed 'quoted text'
+echo export 'quoted text' x=1 export
+$(pwd) grep | | x=1 2>/dev/null /usr/bin sed echo readonly echo
+| "$1" test $(pwd) --verbose awk 2>/dev/null readonly -eu printf x=1 ${HOME}
+	"$1" "$1" ${HOME} && echo 2>/dev/null "$1" -eu $(pwd)
+--verbose test readonly test --verbose 2>/dev/null export
+	awk done 2>/dev/null export export readonly
+cd && && | | sed awk local | 'quoted text' done readonly && "$@" sed
+-eu "$@" printf | -eu x=1 ${HOME} "$1" readonly cd sed readonly x=1 "$1" /usr/bin
+		--verbose 'quoted text' "$@" test grep --verbose awk && /usr/bin printf local grep
+${HOME} ${HOME} export cd "$1" && -eu readonly sed done | export
+	test && /usr/bin /usr/bin "$1"
+printf export printf echo export ${HOME} grep x=1 export test
+		sed then x=1 sed "$1" --verbose grep "$1" local 'quoted text'
+		&& export awk "$1" grep grep grep grep -eu readonly test awk test "$@" local
+		2>/dev/null && 2>/dev/null ${HOME}
+"$1" "$1" /usr/bin echo "$@" done "$@" echo && -eu
+		awk export x=1 | | -eu then 'quoted text'
+	sed /usr/bin sed x=1 printf echo $(pwd) cd echo /usr/bin && $(pwd) -eu printf /usr/bin
+		$(pwd) done $(pwd) 2>/dev/null sed
+	"$1" /usr/bin echo "$@" /usr/bin "$@" "$@" && /usr/bin
+	&& 2>/dev/null "$1" sed cd cd grep -eu sed export x=1 $(pwd) printf -eu
+		"$@" /usr/bin printf "$1" -eu printf /usr/bin readonly sed
+	local $(pwd) printf local done awk && export sed then --verbose test | $(pwd)
+		awk 2>/dev/null "$@" cd export 2>/dev/null sed
+x=1 echo then -eu cd printf "$1"
+	${HOME} | printf --verbose local --verbose
+	printf -eu && readonly local
+		&& ${HOME} awk && 'quoted text' "$@" --verbose
+		--verbose then echo then grep echo x=1 printf printf grep local
+"$@" awk -eu echo ${HOME} $(pwd) 2>/dev/null x=1 test "$@" /usr/bin printf
+x=1 --verbose export cd awk
+${HOME} grep "$@" readonly 2>/dev/null readonly export &&
+	${HOME} sed /usr/bin && "$1" && printf then
+/usr/bin readonly printf ${HOME} printf done
+		local local done then grep x=1 2>/dev/null
+	then && export test cd export sed readonly /usr/bin
+-eu local printf done "$@" --verbose then 'quoted text' && local export ${HOME}
+		| awk /usr/bin grep sed done readonly done "$1" then --verbose
+2>/dev/null "$1" "$1" | 'quoted text' awk /usr/bin
+	| test printf printf printf --verbose printf
+		| done --verbose test echo && local cd 'quoted text'
+x=1 cd -eu 2>/dev/null test cd local 'quoted text' done
+readonly -eu awk local "$@" test x=1 grep "$1" x=1
+	'quoted text' sed echo 2>/dev/null x=1 ${HOME}
+	'quoted text' cd awk echo sed test -eu && sed | 2>/dev/null
+$(pwd) /usr/bin test test test | -eu export printf ${HOME} ${HOME} readonly done
+	printf --verbose /usr/bin printf -eu cd done export grep ${HOME}
+		"$1" && printf 2>/dev/null local sed readonly
+		local export cd 'quoted text' ${HOME} echo printf export
+		${HOME} 'quoted text' x=1 cd cd "$1" cd done printf
+	'quoted text' awk awk ${HOME} then 2>/dev/null printf
+	printf sed 2>/dev/null 'quoted text' && export grep grep awk
+		done awk sed "$1" test $(pwd) sed /usr/bin cd test "$@" x=1 test printf && &&
+	/usr/bin "$1" 'quoted text' awk test done export
+		sed printf --verbose /usr/bin
+	sed printf done done then done local
+then ${HOME} readonly 'quoted text' echo export readonly --verbose
+	sed local awk awk "$1"
+	awk "$@" --verbose then
+		awk x=1 "$@" ${HOME} printf readonly test sed echo
+then 'quoted text' cd
+x=1 then test $(pwd) "$1" export "$1" done done done export sed "$@" sed readonly
+		done ${HOME} --verbose printf echo "$@" local local "$@" x=1 echo "$@"
+$(pwd) readonly 'quoted text' "$@" $(pwd) /usr/bin && awk "$1" echo ${HOME}
+/usr/bin | readonly | local printf 'quoted text' 'quoted text' 2>/dev/null
+--verbose "$1" --verbose then 'quoted text'
+		&& "$1" then | readonly "$1" /usr/bin echo
+		local done test | test 2>/dev/null awk local awk printf && printf "$@" readonly
+2>/dev/null grep $(pwd) "$@" "$1" "$1" 'quoted text'
+-eu export --verbose | $(pwd) 2>/dev/null readonly
+		awk "$@" "$@" 2>/dev/null awk x=1 sed awk
+printf then && done test "$@" ${HOME} $(pwd) awk x=1 | | 'quoted text'
+	awk test grep cd test sed ${HOME} "$@" 2>/dev/null readonly -eu x=1 $(pwd)
+${HOME} "$1" echo --verbose "$@" "$@" | "$@" /usr/bin
+"$1" then 'quoted text' export awk test 2>/dev/null
+&& readonly "$@" awk ${HOME} && x=1 "$1" x=1 sed "$@" "$1" grep "$@" cd 2>/dev/null
+	test echo printf readonly "$1" then "$1" sed "$@" cd 2>/dev/null
+	--verbose -eu local export ${HOME} export && -eu 2>/dev/null sed 2>/dev/null
+sed "$1" 2>/dev/null done -eu --verbose
+	${HOME} 2>/dev/null 'quoted text' --verbose
+		/usr/bin sed && x=1 --verbose printf "$@" ${HOME} cd $(pwd) ${HOME}
+	printf /usr/bin test ${HOME} 'quoted text' then 'quoted text'
+| 2>/dev/null cd "$@" grep x=1 ${HOME} x=1 test $(pwd) "$1" && -eu local
+		local grep -eu test "$@" test --verbose
+	grep printf 'quoted text' sed "$1" /usr/bin x=1 "$1" --verbose
+cd printf -eu "$@" $(pwd) -eu export 2>/dev/null "$@" printf grep && x=1 readonly
+		/usr/bin local grep printf then --verbose export 'quoted text' x=1 export export
+/usr/bin ${HOME} readonly export | printf sed $(pwd) $(pwd) test | x=1
+	test --verbose 2>/dev/null 'quoted text'
+		"$@" then -eu && echo test $(pwd) then local printf 'quoted text' printf
+	local 'quoted text' echo "$@" "$1" test
+		echo then -eu 'quoted text' | 2>/dev/null
+		| "$@" 'quoted text' then sed done ${HOME} grep echo local
+	cd awk ${HOME} done local "$1" "$1" sed echo
+		export done 2>/dev/null 'quoted text' test awk
+	awk echo echo export done --verbose awk $(pwd) /usr/bin | x=1
+${HOME} "$@" test printf grep x=1 && export 2>/dev/null 2>/dev/null /usr/bin
+	&& awk /usr/bin /usr/bin x=1 && 2>/dev/null 2>/dev/null export --verbose
+		grep cd done "$@" cd ${HOME} && -eu $(pwd) --verbose then cd
+	then sed readonly "$@" --verbose echo sed test 2>/dev/null
+'quoted text' "$1" 'quoted text'
+then printf -eu x=1 readonly "$1" $(pwd) test then ${HOME} then export readonly
+		&& /usr/bin cd sed $(pwd) test printf echo
+		"$@" echo x=1 $(pwd) && /usr/bin
+${HOME} /usr/bin 'quoted text' readonly grep 'quoted text' | --verbose | cd grep
+		&& printf export test $(pwd) then local awk "$@" readonly | grep then test
+		sed grep 'quoted text' 2>/dev/null
+export cd export 'quoted text' done --verbose export readonly x=1 &&
+		readonly export local grep
+		${HOME} export -eu $(pwd) printf -eu then echo ${HOME} --verbose | "$1"
+${HOME} awk done printf $(pwd)
+	"$1" awk awk "$1" 2>/dev/null /usr/bin then awk export --verbose 2>/dev/null grep
+'quoted text' /usr/bin awk readonly test cd awk export local readonly
+'quoted text' done x=1 then --verbose test && awk /usr/bin $(pwd) && -eu
+readonly readonly readonly "$@" export -eu /usr/bin test readonly test
+	test local && x=1 then "$1" ${HOME} done test "$@"
+/usr/bin 'quoted text' && -eu "$1"
+/usr/bin $(pwd) export x=1 "$@" grep
+test grep $(pwd) then "$@" ${HOME} test then $(pwd) "$1" grep awk printf
+		local --verbose && | 2>/dev/null done
+-eu && sed test && /usr/bin && export "$@" 'quoted text' cd 'quoted text'
+		--verbose && cd test export printf
+	/usr/bin | && echo $(pwd) awk awk x=1
+		$(pwd) export test && "$@" -eu awk grep "$@" --verbose local export done
+"$1" sed done 2>/dev/null awk
+	echo printf && sed awk grep awk $(pwd) readonly
+	then readonly then sed echo readonly sed
+	| printf --verbose export echo export sed test $(pwd) export readonly then |
+		printf --verbose then test | /usr/bin then
+| test && readonly test && "$@" done "$@" local | 'quoted text' local x=1 --verbose
+	readonly --verbose | sed done printf test
+		/usr/bin printf "$1" 'quoted text' /usr/bin local 'quoted text'
+		cd 2>/dev/null /usr/bin /usr/bin
+test | 'quoted text' && cd $(pwd) sed test
+		'quoted text' /usr/bin --verbose sed echo "$@" grep export -eu awk
+		"$1" ${HOME} "$1" "$@" export test --verbose
+"$1" && $(pwd) export && echo sed 2>/dev/null "$@" done printf
+	printf sed x=1 grep 2>/dev/null $(pwd) "$@"
+	done sed echo cd then sed | 'quoted text' "$@" -eu local "$@" test sed readonly
+printf x=1 'quoted text' then /usr/bin done local 'quoted text' $(pwd)
+2>/dev/null grep grep --verbose /usr/bin -eu echo ${HOME} --verbose
+echo | grep 'quoted text' "$@" sed "$@" readonly done -eu /usr/bin 'quoted text'
+	'quoted text' --verbose ${HOME} done ${HOME}
+2>/dev/null "$@" done test x=1 echo
+	grep export $(pwd) 2>/dev/null sed 'quoted text' -eu ${HOME} 'quoted text'
+	done grep 2>/dev/null "$@" readonly $(pwd) cd sed readonly -eu "$@" "$1" ${HOME}
+		"$@" readonly $(pwd) echo test "$@" test "$@" "$1" "$1" x=1 readonly | sed readonly
+		| -eu then readonly then 2>/dev/null sed && ${HOME} local -eu readonly cd printf
+	-eu grep "$1" export 2>/dev/null "$1" && readonly 'quoted text'
+		x=1 export && done && done cd $(pwd) printf readonly
+	grep && then -eu ${HOME} 'quoted text' 2>/dev/null -eu
+'quoted text' done && ${HOME} | -eu test sed 2>/dev/null done local $(pwd)
+		| done /usr/bin "$@" sed sed "$@" export export export -eu local printf
+readonly 'quoted text' sed 2>/dev/null
+	| x=1 ${HOME} test ${HOME} --verbose | -eu sed then | "$1" local
+x=1 done --verbose "$@" 2>/dev/null x=1 ${HOME} echo --verbose
+		--verbose then 'quoted text'
+		local --verbose local printf /usr/bin
+&& 2>/dev/null test export /usr/bin sed
+	done awk local then x=1 "$1" 'quoted text'
+		done local "$1" "$1" 'quoted text' && $(pwd) --verbose && | 'quoted text'
+	then 'quoted text' done export x=1 "$1" cd
+		done "$1" cd local | readonly && ${HOME} done then sed echo test local 'quoted text'
+--verbose grep sed -eu test
+		${HOME} -eu /usr/bin $(pwd) && then awk x=1 2>/dev/null -eu done
+	cd printf /usr/bin done awk printf 'quoted text' awk 2>/dev/null
+'quoted text' printf -eu test test readonly 'quoted text'
+	grep "$1" grep sed -eu cd export cd x=1 readonly $(pwd) awk | done
+		printf echo echo test $(pwd) then 2>/dev/null
+echo done readonly /usr/bin
+grep readonly -eu export cd done
+	&& cd | readonly "$1" awk test local echo
+	"$@" ${HOME} /usr/bin test x=1 x=1 -eu echo && | printf local
+		$(pwd) --verbose sed --verbose done 2>/dev/null cd readonly &&
+cd 'quoted text' && "$@" $(pwd) -eu x=1 ${HOME} cd x=1 2>/dev/null 2>/dev/null
+	'quoted text' | printf /usr/bin /usr/bin awk then readonly printf export
+	$(pwd) then cd ${HOME}
+	"$1" cd awk "$1" cd "$@"
+	"$@" x=1 -eu done local
+		then awk --verbose echo
+	x=1 export "$@" sed local readonly readonly local echo ${HOME} &&
+	readonly --verbose "$@" && echo -eu sed readonly
+		local -eu | -eu --verbose printf sed sed readonly echo done test done grep test
+| printf readonly then sed
+'quoted text' --verbose | test then export
+		&& local --verbose /usr/bin awk 'quoted text' x=1 /usr/bin local 'quoted text'
+		'quoted text' export /usr/bin test then x=1 local
+		'quoted text' test && && | export done x=1 -eu cd test printf $(pwd)
+export awk then /usr/bin /usr/bin $(pwd) 'quoted text' awk sed x=1 --verbose
+		-eu 'quoted text' | -eu $(pwd) readonly "$@" awk --verbose "$1" | echo echo
+	sed 2>/dev/null readonly echo local readonly "$1" -eu ${HOME} sed
+	sed ${HOME} local 'quoted text' grep echo ${HOME} echo 2>/dev/null |
+'quoted text' then 2>/dev/null
+	"$1" | export 'quoted text' then awk x=1 then --verbose
+echo && local echo -eu && ${HOME} printf --verbose
+done "$@" && $(pwd) export sed readonly test && cd $(pwd) cd grep done 2>/dev/null
+	grep 2>/dev/null test 2>/dev/null 2>/dev/null $(pwd) local "$@" printf
+		2>/dev/null | done --verbose | 'quoted text' /usr/bin $(pwd) done echo
+${HOME} cd export test export done grep 2>/dev/null 'quoted text' /usr/bin
+		'quoted text' sed x=1 2>/dev/null $(pwd) readonly
+'quoted text' done 'quoted text' -eu echo test
+	| /usr/bin 'quoted text' then done done --verbose
+| printf 2>/dev/null printf printf printf $(pwd) -eu "$1" readonly
+&& $(pwd) readonly "$1"
+		$(pwd) && done echo readonly export
+then grep 2>/dev/null $(pwd)
+$(pwd) local sed "$1" local grep
+x=1 x=1 readonly cd test awk && --verbose /usr/bin done 'quoted text' grep
+	"$@" 2>/dev/null cd 2>/dev/null ${HOME} grep local local && local x=1 | local
+	test 'quoted text' awk test
+	x=1 | 2>/dev/null readonly grep "$1" cd "$1"
+then local sed --verbose ${HOME} test | x=1 ${HOME} local readonly &&
+--verbose --verbose "$1" --verbose local readonly grep -eu then echo sed local
+test -eu ${HOME} printf echo | ${HOME}
+		$(pwd) x=1 cd echo cd sed sed readonly readonly test readonly done -eu then 2>/dev/null
+		echo 2>/dev/null local echo then echo -eu -eu cd
+2>/dev/null cd export sed
+	'quoted text' 'quoted text' awk done 2>/dev/null
+		printf readonly ${HOME} $(pwd) local
+		/usr/bin grep then local
+test /usr/bin printf ${HOME} test done test "$@" && x=1 ${HOME} |
+		grep --verbose local then /usr/bin awk --verbose sed grep echo && "$@"
+		x=1 2>/dev/null readonly done ${HOME} "$1" grep export /usr/bin
+	readonly grep cd cd 'quoted text' $(pwd)
+		/usr/bin 2>/dev/null 'quoted text'
+echo echo printf "$1" 'quoted text' /usr/bin
+'quoted text' cd then /usr/bin /usr/bin sed /usr/bin export
+--verbose then then awk
+then | export "$1" --verbose $(pwd) --verbose x=1 grep ${HOME} | "$1"
+	"$1" sed grep cd readonly then x=1 awk
+/usr/bin $(pwd) local "$1" && ${HOME} /usr/bin export ${HOME} "$1"
+		readonly grep 2>/dev/null "$@" cd awk 'quoted text' then local "$1" 'quoted text'
+cd --verbose test ${HOME} cd -eu --verbose grep awk local 2>/dev/null done 'quoted text'
+		${HOME} awk readonly done echo sed then export x=1 -eu echo printf /usr/bin
+	cd 'quoted text' | test "$@" export --verbose 'quoted text'
+		printf awk 'quoted text' test x=1 test grep -eu awk
+	x=1 sed done && local test sed "$@"
+		$(pwd) $(pwd) readonly --verbose
+	"$@" local readonly $(pwd) done export && --verbose cd --verbose "$1" /usr/bin
+	export export | done echo -eu $(pwd) 2>/dev/null
+	"$1" "$@" then printf readonly /usr/bin /usr/bin --verbose -eu local
+	readonly sed 2>/dev/null "$@" -eu echo 2>/dev/null "$@"
+	/usr/bin awk 2>/dev/null ${HOME} |
+export ${HOME} | && test -eu test ${HOME} printf ${HOME} ${HOME} "$@"
+	then then echo echo printf x=1
+		printf grep printf test export awk | local -eu
+sed 'quoted text' export test 2>/dev/null
+		awk test "$1" sed /usr/bin grep sed sed cd --verbose $(pwd)
+		2>/dev/null then export then /usr/bin readonly ${HOME} export
+		awk ${HOME} sed local -eu
+	-eu export 'quoted text' $(pwd) "$1" 'quoted text'
+		cd ${HOME} export "$1" $(pwd) sed $(pwd) /usr/bin local done --verbose x=1
+grep export | echo local | grep test 2>/dev/null "$@" | echo
+		"$1" 2>/dev/null grep done export $(pwd) 2>/dev/null echo echo "$1" "$@"
+-eu local 2>/dev/null "$1" cd --verbose
+		2>/dev/null awk /usr/bin | "$1" then printf
+	"$@" readonly awk printf $(pwd) local test | sed cd grep 2>/dev/null
+		test ${HOME} echo printf /usr/bin
+		readonly awk sed /usr/bin x=1 "$1" x=1 /usr/bin 'quoted text' --verbose
+		awk --verbose x=1 ${HOME}
+	"$1" "$1" ${HOME} readonly grep ${HOME} test
+	&& cd sed /usr/bin echo -eu readonly
+		'quoted text' --verbose 'quoted text'
+		&& then && readonly readonly
+-eu --verbose grep export /usr/bin sed local done done printf
+		echo x=1 "$@" local cd readonly grep
+export sed "$@" cd sed -eu && printf "$1" "$1"
+	x=1 2>/dev/null grep grep 'quoted text'
+2>/dev/null then awk x=1 /usr/bin $(pwd) local export done |
+	"$1" local $(pwd) export awk grep test export "$1" printf
+grep readonly "$@" "$@" then echo sed awk -eu 2>/dev/null x=1 --verbose
+		-eu then test --verbose $(pwd) then done ${HOME}
+		grep $(pwd) then 2>/dev/null && $(pwd) printf cd test export
+	awk -eu export done $(pwd) | cd local awk readonly --verbose ${HOME} echo
+	x=1 --verbose -eu readonly echo printf readonly export echo "$@" grep
+	printf local cd local /usr/bin local grep
+		"$@" cd test local -eu "$@" local --verbose test awk /usr/bin 2>/dev/null
+printf done --verbose "$@" ${HOME} export grep -eu test
+	grep done then | $(pwd) done grep x=1 then "$@" -eu
+grep 2>/dev/null --verbose x=1 readonly x=1 export -eu -eu test local ${HOME}
+	done | ${HOME} --verbose $(pwd) test "$@" awk && -eu /usr/bin
+	/usr/bin printf ${HOME} done "$1" ${HOME} && printf "$1"
+"$@" export -eu test sed "$@" test printf then ${HOME}
+		local x=1 ${HOME} 2>/dev/null awk local cd ${HOME}
+'quoted text' export | | 2>/dev/null 'quoted text'
+		2>/dev/null | then 2>/dev/null
+	echo x=1 then -eu printf echo
+	test done /usr/bin awk $(pwd) printf cd grep test readonly test --verbose
+'quoted text' grep --verbose -eu -eu ${HOME} $(pwd) 'quoted text'
+cd $(pwd) local sed 'quoted text'
+		"$1" /usr/bin --verbose awk grep x=1
+	test grep test -eu --verbose -eu ${HOME} x=1 readonly
+	$(pwd) ${HOME} grep printf 'quoted text' local ${HOME} awk
+	then test echo export /usr/bin readonly ${HOME} x=1 then x=1 ${HOME} readonly
+--verbose /usr/bin printf $(pwd) --verbose $(pwd)
+	test echo x=1 export readonly
+"$@" cd -eu -eu export /usr/bin x=1 && test | printf cd /usr/bin printf x=1 2>/dev/null
+| "$1" export done $(pwd) | --verbose "$@" | $(pwd) test "$1" "$1"
+		"$@" readonly done grep -eu && "$@" $(pwd) cd | $(pwd)
+	'quoted text' | $(pwd) test ${HOME} done ${HOME}
+	--verbose awk done ${HOME}
+$(pwd) cd local local | --verbose -eu then ${HOME} test then done readonly --verbose
+	"$@" && export awk $(pwd) sed local awk | then awk ${HOME}
+		2>/dev/null cd done readonly export cd grep then /usr/bin "$1" -eu awk "$@"
+		local x=1 -eu /usr/bin $(pwd) test
+	2>/dev/null then $(pwd) --verbose -eu readonly
+then readonly /usr/bin
+cd test -eu $(pwd) local sed $(pwd) "$1" | cd echo
+	done --verbose done sed ${HOME} grep -eu export ${HOME} cd awk "$1"
+		grep --verbose 2>/dev/null readonly
+/usr/bin done awk -eu local x=1 cd export then
+echo "$@" /usr/bin -eu /usr/bin test awk 'quoted text' local cd -eu grep ${HOME}
+		export $(pwd) echo echo cd /usr/bin
+	${HOME} local $(pwd) local
+		done cd echo && sed readonly /usr/bin printf | sed export ${HOME}
+		export --verbose done ${HOME} test export "$1" local done
+		test 'quoted text' echo echo done echo cd | grep --verbose test printf
+		--verbose awk printf readonly readonly --verbose grep
+		echo -eu done local |
+printf then 2>/dev/null readonly $(pwd) echo 2>/dev/null --verbose
+	export awk readonly 'quoted text' 'quoted text' 'quoted text'
+		2>/dev/null "$1" test done readonly
+		-eu echo $(pwd) then
+--verbose local "$@" export /usr/bin 2>/dev/null | "$1"
+		done printf cd "$@" printf "$1" printf done printf /usr/bin
+		| grep --verbose | "$@" $(pwd)
+		cd | "$@" --verbose readonly sed readonly "$@" awk /usr/bin awk 'quoted text'
+	readonly "$@" test x=1 --verbose
+		x=1 done echo grep --verbose "$@" "$@" x=1 export
+x=1 "$1" "$1" printf sed awk echo "$@" readonly test "$1"
+		test $(pwd) 2>/dev/null /usr/bin test 'quoted text' test ${HOME} 2>/dev/null
+$(pwd) echo $(pwd) --verbose ${HOME} 'quoted text'
+		'quoted text' 2>/dev/null local -eu done
+		--verbose done printf $(pwd) awk printf "$@" echo 'quoted text' awk echo -eu 2>/dev/null
+		done awk x=1 "$@" printf "$1" done "$1" && cd then
+	grep cd local "$@" printf && 2>/dev/null x=1 'quoted text'
+--verbose --verbose --verbose
+test -eu cd --verbose done "$1"
+	echo echo readonly sed cd export
+		cd "$1" cd grep && then awk cd "$1" then grep 'quoted text' -eu 2>/dev/null
+		x=1 "$1" && "$@" | echo
+	then | && done printf export awk local
+grep --verbose "$@" -eu $(pwd) local cd test "$@" -eu && export && "$@"
+-eu done done echo -eu "$@" -eu -eu cd --verbose $(pwd)
+		readonly && grep done x=1 local $(pwd) then 2>/dev/null
+	'quoted text' then && local grep 'quoted text' then
+sed /usr/bin readonly local x=1 readonly cd echo -eu x=1 | "$@"
+	cd 2>/dev/null awk 2>/dev/null --verbose
+		-eu cd local export 'quoted text' 2>/dev/null
+	x=1 printf printf grep echo | 'quoted text'
+	export /usr/bin "$@" -eu export
+&& "$1" /usr/bin sed local
+		grep test ${HOME} /usr/bin export done x=1
+		export echo $(pwd) "$@" 2>/dev/null
+	awk echo 'quoted text' --verbose test 2>/dev/null
+		x=1 $(pwd) sed -eu grep "$@" --verbose && && ${HOME} local done done echo grep
+	-eu cd "$@" cd 2>/dev/null readonly export "$@" "$1" 2>/dev/null echo
+		sed && awk --verbose export awk
+		test 'quoted text' ${HOME} then 'quoted text' sed export sed | -eu
+echo grep printf /usr/bin printf readonly readonly | test | "$1" |
+	done && ${HOME} awk "$1" --verbose done test -eu $(pwd) readonly
+cd "$1" grep --verbose /usr/bin && "$@" readonly -eu grep
+printf grep /usr/bin ${HOME} 2>/dev/null done "$@" "$1" --verbose done
+	test echo local x=1 printf $(pwd) 2>/dev/null 'quoted text' local
+	"$@" && sed ${HOME} sed done printf done readonly awk $(pwd) then ${HOME}
+"$1" printf "$@" --verbose
+		"$@" sed grep -eu test 2>/dev/null test test --verbose ${HOME} "$1" awk
+	printf && printf then awk test test then
+	test test 2>/dev/null /usr/bin readonly echo -eu 'quoted text'
+		readonly export x=1 done grep printf echo export && export cd 'quoted text'
+	--verbose then grep -eu awk "$@" && test "$@" 'quoted text' grep
+		"$1" | sed "$@" grep sed grep && done $(pwd) "$@" then grep local "$@"
+2>/dev/null printf /usr/bin grep ${HOME} awk
+		cd 'quoted text' -eu | 2>/dev/null then
+	readonly then cd -eu | test 'quoted text'
+	cd x=1 ${HOME} cd --verbose -eu "$@" x=1
+		/usr/bin printf "$@" sed readonly
+		grep grep x=1 then 'quoted text' ${HOME} && echo readonly 'quoted text'
+	"$@" awk done 2>/dev/null test && cd done awk /usr/bin
+	echo echo then test /usr/bin local
+'quoted text' -eu test "$@" && 'quoted text'
+		test /usr/bin 'quoted text'
+	-eu export export echo "$@" export
+		--verbose x=1 echo "$1" "$1" x=1 test done x=1 ${HOME} test $(pwd) &&
+		awk readonly readonly "$1" echo 'quoted text'
+printf -eu /usr/bin && local
+	done $(pwd) "$@" export $(pwd) "$@" 'quoted text' echo
+done then /usr/bin cd then
+		printf then done done $(pwd) --verbose
+		local --verbose printf 2>/dev/null
+	| sed -eu $(pwd) local ${HOME} x=1
+	$(pwd) 'quoted text' test then $(pwd) local && test
+		echo "$@" 'quoted text' | done printf /usr/bin $(pwd)
+then cd awk -eu | "$1" awk awk | x=1
+		'quoted text' then --verbose export sed 2>/dev/null 2>/dev/null
+		${HOME} done cd x=1 export -eu printf awk echo && test done export $(pwd)
+	'quoted text' test test grep test | --verbose 'quoted text'
+export test grep then /usr/bin ${HOME} -eu cd grep | "$1" 2>/dev/null test
+sed && "$@" 2>/dev/null echo printf 2>/dev/null 'quoted text' 2>/dev/null local
+readonly printf --verbose && | cd && "$@" sed --verbose grep cd printf
+		grep grep echo awk $(pwd) cd /usr/bin -eu x=1 /usr/bin 2>/dev/null grep ${HOME}
+	-eu printf done --verbose echo then ${HOME} --verbose grep grep
+		echo awk export export readonly
+		done echo awk "$@" -eu 'quoted text' "$1" | $(pwd) 2>/dev/null
+	awk grep -eu readonly readonly
+"$@" x=1 printf test echo "$@" printf /usr/bin
+		local test export /usr/bin
+		export printf echo echo
+		printf 'quoted text' test cd local cd $(pwd)
+	readonly cd 'quoted text' -eu cd done --verbose "$@" cd | done
+printf export 2>/dev/null export then $(pwd) export cd |
+	printf "$1" /usr/bin cd local
+		grep 2>/dev/null 'quoted text' awk
+		$(pwd) cd | && export x=1 then then
+		local ${HOME} "$1" printf
+		readonly export 2>/dev/null printf test -eu --verbose readonly readonly test x=1
+		| test -eu then cd ${HOME} x=1 local grep grep -eu 'quoted text' -eu
+/usr/bin -eu test printf &&
+		done printf then grep "$@" 'quoted text' "$1" export printf sed local
+local printf awk 2>/dev/null done done 'quoted text'
+		awk sed /usr/bin 'quoted text' /usr/bin readonly
+	x=1 echo grep then /usr/bin /usr/bin awk "$1"
+'quoted text' | test then echo done 2>/dev/null --verbose "$@" x=1 printf
+&& awk readonly sed printf sed "$@" echo x=1 2>/dev/null $(pwd)
+	"$@" -eu then /usr/bin test x=1 "$1" -eu
+	local | "$@" printf readonly -eu cd
+/usr/bin --verbose cd --verbose "$1" "$@"
+	&& && export printf grep grep -eu cd 2>/dev/null
+	'quoted text' test "$@" 'quoted text'
+x=1 then export sed x=1 awk grep local --verbose | x=1 -eu $(pwd)
+	$(pwd) 2>/dev/null awk done local echo local "$1"
+test "$@" export awk |
+2>/dev/null $(pwd) x=1 export grep
+export x=1 ${HOME} grep 'quoted text'
+sed echo printf ${HOME} ${HOME} /usr/bin -eu grep x=1 awk "$@" cd
+		grep --verbose cd 2>/dev/null
+	export /usr/bin /usr/bin test ${HOME} ${HOME} awk -eu local x=1
+cd && "$1" x=1 export && | echo test cd && sed export test done "$1" export
+		grep -eu sed printf printf x=1 done
+	| readonly && export local "$@" --verbose --verbose readonly
+		printf x=1 $(pwd) && ${HOME} sed 2>/dev/null local x=1 grep x=1 "$@"
+	--verbose awk awk export 2>/dev/null -eu echo x=1 cd "$1"
+		echo /usr/bin test echo $(pwd) local --verbose printf export "$@" echo 'quoted text'
+		local /usr/bin ${HOME}
+	echo grep local x=1 | && x=1 cd "$@" "$@" 'quoted text'
+	cd then echo --verbose local
+	export --verbose export echo
+"$@" --verbose printf -eu && grep sed test export printf done
+sed x=1 echo 'quoted text' cd echo printf /usr/bin 'quoted text'
+		readonly then 'quoted text' && x=1 done -eu "$@" cd export
+${HOME} then $(pwd) export printf /usr/bin "$@" export readonly
+echo test sed /usr/bin cd --verbose && "$@" cd test local $(pwd) "$1"
+		"$1" echo sed 'quoted text' awk "$@" "$1" | sed
+echo --verbose /usr/bin
+	local export --verbose printf echo 'quoted text' done echo local
+sed "$@" printf | cd "$1" grep echo -eu | /usr/bin --verbose local
+	$(pwd) 'quoted text' /usr/bin && local test echo
+| $(pwd) && $(pwd) sed then export local --verbose
+		"$@" "$@" echo | 2>/dev/null then ${HOME}
+local sed readonly -eu printf ${HOME} && | printf -eu local -eu export
+	echo printf --verbose | cd -eu -eu printf
+2>/dev/null echo "$1" export 'quoted text' && /usr/bin done test && -eu
+&& export $(pwd) x=1 x=1 sed /usr/bin local export done grep done
+		awk ${HOME} echo ${HOME} cd $(pwd) echo readonly
+printf readonly then printf done
+--verbose "$@" local grep local printf | readonly $(pwd) done awk export
+		local echo 'quoted text' "$@"
+		--verbose printf grep 'quoted text' 'quoted text'
+/usr/bin done test 'quoted text'
+done && printf x=1 -eu sed $(pwd) local 'quoted text'
+done ${HOME} awk test awk && done "$1" --verbose local ${HOME} local printf
+	test && echo then 'quoted text' --verbose cd ${HOME} test /usr/bin ${HOME} | done
+	$(pwd) readonly /usr/bin 'quoted text' grep
+	"$@" local sed sed 2>/dev/null 'quoted text' $(pwd) 'quoted text'
+		x=1 /usr/bin x=1 local x=1 echo sed -eu
+	echo grep "$@" awk sed $(pwd) && test --verbose
+	| ${HOME} export ${HOME} "$1" | "$1" done "$@"
+/usr/bin 2>/dev/null printf awk ${HOME} 2>/dev/null printf sed printf x=1
+		"$@" echo 2>/dev/null export /usr/bin echo $(pwd) then $(pwd)
+	"$@" $(pwd) readonly x=1 | | readonly "$1" ${HOME} then 'quoted text'
+done readonly 'quoted text' "$1" "$@"
+	$(pwd) /usr/bin sed export | awk
+		/usr/bin 2>/dev/null printf readonly --verbose
+'quoted text' --verbose grep awk printf export readonly $(pwd) printf
+	readonly awk printf grep then /usr/bin
+		then then /usr/bin | export done && "$@" local
+sed -eu grep 2>/dev/null test /usr/bin done cd && export done 'quoted text'
+&& echo cd cd test echo /usr/bin
+		cd /usr/bin grep x=1 'quoted text' printf echo grep "$@" "$@"
+test /usr/bin $(pwd) sed readonly $(pwd) $(pwd) --verbose printf
+		local ${HOME} 'quoted text'
+cd x=1 "$1" "$1" awk "$@" x=1 ${HOME} local 2>/dev/null -eu "$@" | local 'quoted text'
+	done && sed -eu -eu printf cd local
+sed local 'quoted text' readonly readonly local awk "$1" x=1 'quoted text' 'quoted text'
+	sed ${HOME} 'quoted text' | awk cd /usr/bin grep grep $(pwd) | local local sed x=1
+		--verbose sed | test | --verbose
+		cd awk 'quoted text' sed readonly sed | awk ${HOME} --verbose
+	echo -eu export readonly --verbose | -eu then local -eu cd test x=1 printf "$1"
+		local 'quoted text' local printf local done cd 2>/dev/null
+awk grep --verbose && test
+-eu $(pwd) /usr/bin export awk awk export sed
+		$(pwd) readonly awk && local echo x=1 then local grep done --verbose echo printf
+		cd cd readonly sed then /usr/bin "$@"
+		&& test $(pwd) test "$1"
+		&& echo done awk "$1" export sed printf
+		"$@" printf && -eu cd test --verbose cd sed | /usr/bin
+		test "$1" --verbose && 2>/dev/null then "$@" export echo "$1" echo
+	${HOME} sed /usr/bin 2>/dev/null
+then cd ${HOME} sed "$@" echo printf "$1" 2>/dev/null --verbose --verbose echo
+x=1 --verbose && x=1 then then grep
+		--verbose test ${HOME} ${HOME}
+	--verbose sed printf ${HOME}
+		"$1" "$1" export 2>/dev/null ${HOME} sed export &&
+	echo readonly cd echo readonly sed echo
+	--verbose $(pwd) sed printf done $(pwd) cd
+cd ${HOME} && 'quoted text' printf grep $(pwd)
+	awk "$@" local done test awk done then awk "$1" x=1 printf
+	/usr/bin | /usr/bin export "$@" test
+	printf done grep grep /usr/bin && ${HOME} export echo 2>/dev/null "$@" export
+awk local grep "$@" awk test 'quoted text'
+2>/dev/null cd "$@" printf echo ${HOME} $(pwd) export done 'quoted text' cd
+	2>/dev/null 2>/dev/null 'quoted text' "$@" awk done --verbose
+		done then grep readonly 2>/dev/null "$1" -eu -eu
+		| && "$1" /usr/bin test x=1 -eu echo grep echo | printf
+		${HOME} readonly && grep 'quoted text' "$@" cd test $(pwd)
+printf ${HOME} printf readonly then test printf echo done grep echo
+	printf done then x=1 sed grep readonly awk "$@" export "$@" "$@" export
+	readonly --verbose readonly readonly awk cd done done
+		sed then -eu 2>/dev/null
+then test cd awk 2>/dev/null --verbose export
+		/usr/bin echo then 2>/dev/null | awk && grep /usr/bin ${HOME} printf "$@" x=1
+	&& x=1 "$@" printf -eu 2>/dev/null
+	grep export "$1" | "$1" test 'quoted text' printf readonly local ${HOME}
+/usr/bin $(pwd) export /usr/bin x=1 echo export
+	-eu test export | printf
+	"$@" export ${HOME} cd x=1 test
+		'quoted text' test --verbose grep local /usr/bin x=1 echo && && awk readonly
+printf then cd | awk "$1"
+	x=1 2>/dev/null done 'quoted text' "$1" /usr/bin x=1 &&
+	readonly echo then echo x=1 done $(pwd) done export export
+		test --verbose sed local "$1" printf export then sed local ${HOME} then cd cd
+		export 'quoted text' echo -eu local awk
+$(pwd) "$1" echo x=1 then 'quoted text' readonly
+		awk x=1 && cd grep export 2>/dev/null done 2>/dev/null "$@" --verbose done
+	export ${HOME} "$1" grep grep cd 'quoted text'
+	printf 'quoted text' sed test
+		"$1" cd "$@" | && export 'quoted text' readonly then grep test
+		--verbose export "$1" grep x=1 cd | awk
+		local sed ${HOME} test grep 2>/dev/null
+local test readonly done
+	-eu 'quoted text' 2>/dev/null && sed echo $(pwd) 2>/dev/null
+		2>/dev/null grep cd done echo test printf cd readonly && grep 2>/dev/null
+| | $(pwd) -eu grep "$@" sed
+		-eu | --verbose printf 2>/dev/null test local sed && readonly test then
+local /usr/bin /usr/bin
+	$(pwd) then x=1 x=1 printf grep $(pwd) "$1" done export done printf
+	--verbose test test "$1" test test then grep -eu awk --verbose readonly readonly
+		export echo export $(pwd) test /usr/bin "$@" "$1" /usr/bin
+	| ${HOME} "$1" awk "$@" local
+export $(pwd) awk test done 'quoted text'
+		sed then echo x=1 $(pwd) awk --verbose x=1 sed && 'quoted text' -eu && awk $(pwd)
+	'quoted text' printf && 2>/dev/null
+		-eu $(pwd) "$1" echo echo printf 2>/dev/null $(pwd)
+		grep awk | test 2>/dev/null cd cd "$1" $(pwd) cd readonly "$@" test /usr/bin cd
+	/usr/bin local test test /usr/bin
+		&& cd 2>/dev/null awk sed x=1 grep sed && 2>/dev/null ${HOME}
+	echo awk export awk $(pwd) cd local ${HOME} local
+readonly && awk export printf
+grep | ${HOME} local echo
+		grep test 2>/dev/null 'quoted text'
+	-eu "$1" done "$1" echo "$1" sed && | then x=1 x=1 printf
+		done $(pwd) "$1" 2>/dev/null "$@" 'quoted text' && awk test && sed
+	test then /usr/bin --verbose
+		echo echo awk -eu -eu test echo ${HOME}
+	/usr/bin cd $(pwd) && ${HOME} -eu cd cd test echo test --verbose 'quoted text'
+		&& --verbose ${HOME} --verbose 2>/dev/null
+/usr/bin "$1" "$1" && $(pwd) /usr/bin
+	--verbose --verbose readonly &&
+sed "$@" && 2>/dev/null "$1" "$1" | readonly 'quoted text' printf cd
+		--verbose readonly awk
+echo done readonly awk printf /usr/bin 2>/dev/null | test "$1" local "$@"
+2>/dev/null $(pwd) ${HOME} export /usr/bin sed /usr/bin x=1 -eu && 2>/dev/null
+	"$1" grep readonly && export "$@" local done export printf local grep
+	printf done -eu -eu x=1 | echo echo test
+awk grep test x=1 local x=1 x=1 then then sed x=1 "$1" local $(pwd) grep test
+	-eu local -eu export printf echo 2>/dev/null local 'quoted text'
+${HOME} readonly -eu awk echo sed printf | x=1 x=1 x=1 awk |
+	2>/dev/null -eu awk $(pwd)
+"$1" && "$@" x=1 awk 'quoted text' "$1" done --verbose -eu /usr/bin cd readonly
+	sed test export "$1" done x=1
+	awk "$@" sed | /usr/bin -eu local
+	local && && echo && then
+		"$@" readonly "$1" test
+done awk 'quoted text' echo | "$@" --verbose test 'quoted text'
+	2>/dev/null sed /usr/bin 2>/dev/null
+		| | "$1" $(pwd) sed | printf --verbose ${HOME} 2>/dev/null x=1 "$1" x=1 2>/dev/null
+		sed then --verbose -eu test /usr/bin "$1" local ${HOME}
+| grep grep sed awk readonly export
+"$@" readonly --verbose -eu --verbose /usr/bin -eu grep $(pwd) sed $(pwd)
+$(pwd) echo 2>/dev/null 2>/dev/null echo --verbose --verbose --verbose awk
+		x=1 done export "$1" printf "$@"
+		$(pwd) cd "$@" grep && readonly export sed 2>/dev/null x=1 awk | 'quoted text'
+	| --verbose "$@" test export /usr/bin -eu $(pwd) 2>/dev/null ${HOME}
+then awk && ${HOME} done sed readonly $(pwd)
+	awk x=1 readonly printf printf 2>/dev/null --verbose
+	x=1 2>/dev/null cd 2>/dev/null cd -eu export 2>/dev/null ${HOME}
+		/usr/bin ${HOME} echo "$1" echo --verbose -eu done test readonly grep
+		x=1 && 'quoted text' 2>/dev/null 2>/dev/null
+then export 'quoted text' sed cd local readonly -eu done 'quoted text' 2>/dev/null
+	local export printf /usr/bin test awk $(pwd) export done
+export local 2>/dev/null
+x=1 sed grep awk ${HOME} 'quoted text' /usr/bin x=1 readonly printf ${HOME}
+	sed readonly -eu cd /usr/bin
+		"$@" ${HOME} local -eu echo x=1 "$@" x=1 export
+	done echo echo && --verbose | --verbose echo /usr/bin
+		sed 2>/dev/null -eu "$@" grep grep local
+		awk | "$@" --verbose "$1" "$@" 2>/dev/null sed $(pwd) $(pwd) -eu then
+	-eu readonly cd -eu awk then "$@" echo ${HOME}
+	sed "$@" "$@" 'quoted text' x=1 then
+		test x=1 printf ${HOME} -eu x=1 readonly 'quoted text'
+		| x=1 --verbose grep echo -eu 'quoted text'
+	&& /usr/bin test $(pwd) $(pwd) export $(pwd)
+grep sed -eu x=1 done && cd && awk test test export $(pwd)
+		cd /usr/bin && | 2>/dev/null echo sed export
+--verbose ${HOME} then sed
+	/usr/bin /usr/bin x=1 2>/dev/null then -eu grep test "$@" ${HOME} x=1
+	local && echo $(pwd) ${HOME} grep | --verbose ${HOME} /usr/bin echo ${HOME} echo
+	local -eu ${HOME} && awk awk &&
+	/usr/bin && 'quoted text' && | 'quoted text' ${HOME} readonly then $(pwd) ${HOME}
+| printf -eu ${HOME} printf
+	-eu done test printf
+	sed local done then echo "$1" "$1" printf awk cd sed then 2>/dev/null
+	cd /usr/bin export "$@" then readonly 'quoted text' test
+echo test then ${HOME} then x=1 && printf readonly x=1 test cd | x=1
+	${HOME} 'quoted text' --verbose grep then cd printf | --verbose grep
+x=1 test echo export /usr/bin then
+awk -eu ${HOME} "$1" done -eu export
+	printf ${HOME} export ${HOME} && readonly sed test 2>/dev/null
+		sed "$@" echo echo | --verbose sed grep | readonly |
+	"$1" x=1 readonly "$@" ${HOME} local /usr/bin export -eu $(pwd) | 'quoted text'
+	cd test -eu $(pwd) test "$1" local grep cd local /usr/bin ${HOME} ${HOME} export
+		then cd -eu cd awk local -eu 2>/dev/null local "$@" grep |
+printf test ${HOME} /usr/bin awk sed $(pwd) | echo
+	$(pwd) ${HOME} local "$@" test | echo
+	--verbose "$@" local x=1 printf ${HOME} ${HOME} local
+		-eu test --verbose "$@" | test sed local local --verbose
+-eu 2>/dev/null awk echo sed x=1 test --verbose 2>/dev/null -eu ${HOME} awk "$@"
+&& --verbose ${HOME} done $(pwd) cd 2>/dev/null --verbose export "$1" | echo local
+		${HOME} --verbose x=1 sed /usr/bin then awk
+		echo --verbose --verbose && -eu | cd 2>/dev/null
+grep 2>/dev/null cd "$@" x=1 --verbose $(pwd) local then grep $(pwd) x=1
+		2>/dev/null printf cd x=1 awk cd export $(pwd) /usr/bin readonly 'quoted text' export
+		2>/dev/null 2>/dev/null --verbose done x=1
+	local $(pwd) ${HOME} readonly awk /usr/bin
+"$1" ${HOME} test grep --verbose
+		"$@" ${HOME} local 'quoted text' -eu | cd grep done export $(pwd) -eu -eu x=1
+x=1 then ${HOME} awk export $(pwd)
+local readonly 'quoted text' $(pwd) x=1 "$1" awk printf 'quoted text'
+	printf done local x=1 readonly | "$@" awk sed grep /usr/bin
+		awk readonly "$1" then 'quoted text'
+		echo --verbose "$@" /usr/bin && printf grep && local x=1 ${HOME} "$1"
+		local grep printf "$1" export
+	2>/dev/null "$@" ${HOME} 'quoted text'
+	&& /usr/bin x=1 sed export ${HOME} cd cd cd
+		/usr/bin export --verbose --verbose done printf 'quoted text' printf
+		readonly | -eu cd --verbose export
+2>/dev/null cd "$1" x=1 grep -eu sed
+test done done cd readonly | && echo then 'quoted text' x=1 export
+	--verbose $(pwd) sed ${HOME} 'quoted text' export "$1" "$@" 2>/dev/null
+	echo -eu 2>/dev/null test "$1" grep x=1 echo readonly x=1 x=1 echo
+	"$@" then && grep "$@" awk $(pwd)
+| "$@" awk awk done --verbose 2>/dev/null grep ${HOME} echo --verbose
+	sed ${HOME} -eu sed printf sed ${HOME} 'quoted text' export x=1
+awk /usr/bin sed --verbose "$1" $(pwd) sed export test x=1 printf local sed done
+&& "$@" && ${HOME} x=1 echo "$@" --verbose
+	printf x=1 grep awk awk sed done then printf ${HOME} x=1 then
+	-eu -eu echo grep local done awk /usr/bin then awk
+		"$@" local local cd done 2>/dev/null --verbose -eu
+	printf sed "$1" $(pwd) readonly --verbose "$@"
+"$1" 2>/dev/null cd "$@" ${HOME} local -eu ${HOME} readonly awk /usr/bin
+	printf cd awk | test cd /usr/bin "$@" ${HOME} done then sed cd /usr/bin
+	cd && x=1 /usr/bin test grep grep sed
+	printf /usr/bin then --verbose
+2>/dev/null "$1" local 2>/dev/null printf x=1
+		sed export sed done echo echo export export local readonly echo 'quoted text'
+	| grep sed done x=1 "$@" "$@" cd test /usr/bin local --verbose readonly
+	2>/dev/null && readonly awk export done "$1" sed
+		cd test done | local -eu then
+		test && readonly grep sed |
+		local done readonly done 2>/dev/null $(pwd) then "$@"
+"$1" printf then then "$@" grep $(pwd) readonly ${HOME} printf grep
+	cd --verbose /usr/bin local 'quoted text' 'quoted text' test 2>/dev/null
+	'quoted text' cd cd 2>/dev/null
+	echo printf test cd /usr/bin local "$1" -eu $(pwd) ${HOME} 2>/dev/null
+		x=1 echo done -eu --verbose
+readonly done sed x=1 echo then local "$@"
+	/usr/bin ${HOME} done test
+	readonly grep readonly -eu local local | 'quoted text' then -eu 2>/dev/null 2>/dev/null
+	"$@" printf done 2>/dev/null test --verbose 'quoted text' $(pwd) | | test export
+export local test readonly && ${HOME} && grep ${HOME}
+grep 'quoted text' sed
+then "$1" $(pwd) "$1" export cd echo printf test
+	| --verbose --verbose echo local --verbose
+	grep cd awk test export then "$1" x=1 cd | && -eu export
+		done 2>/dev/null | export sed grep cd done test
+x=1 /usr/bin sed x=1 then test --verbose
+	sed /usr/bin "$1" local | "$1" $(pwd) $(pwd) export awk echo done $(pwd) export
+	then ${HOME} x=1 x=1 printf sed /usr/bin echo x=1
+		$(pwd) ${HOME} echo echo -eu 2>/dev/null test export then sed test 2>/dev/null
+"$1" 'quoted text' && $(pwd) test "$1"
+	export local printf sed ${HOME}
+	then ${HOME} $(pwd) && --verbose --verbose -eu 2>/dev/null
+	2>/dev/null x=1 grep "$1" | /usr/bin echo | local awk echo
+		grep export export | $(pwd) local cd /usr/bin test
+	--verbose --verbose ${HOME} "$@" test readonly /usr/bin
+		'quoted text' awk 'quoted text' --verbose x=1 $(pwd) "$@" local /usr/bin ${HOME}
+x=1 sed "$@" $(pwd) "$@" cd 'quoted text' "$1" echo x=1 test ${HOME}
+grep local $(pwd) ${HOME}
+	echo "$1" echo sed "$@" printf $(pwd)
+echo test ${HOME} | && local "$@" readonly printf echo
+test awk $(pwd) 'quoted text' --verbose && awk printf
+	then 2>/dev/null "$@" -eu --verbose readonly
+		grep done sed local 'quoted text'
+		cd printf then local done && then
+grep local grep local 'quoted text' x=1 2>/dev/null echo
+grep /usr/bin export export | "$@" export awk
+	local "$@" ${HOME} --verbose then cd printf "$@" | ${HOME}
+	test | local | test &&
+2>/dev/null 'quoted text' local export cd test 2>/dev/null
+"$@" 2>/dev/null cd awk printf sed then awk | printf $(pwd) readonly
+	cd x=1 then x=1 x=1 export -eu export | cd 2>/dev/null && readonly local /usr/bin
+	awk -eu --verbose done export grep 'quoted text' then "$@" test local printf
+		sed 2>/dev/null 2>/dev/null ${HOME} sed done awk then done done echo 2>/dev/null
+local -eu /usr/bin echo "$@" export cd echo printf $(pwd) "$1"
+-eu "$@" local "$1" awk cd -eu grep then readonly readonly
+	/usr/bin cd --verbose && readonly x=1 ${HOME} done | "$@" echo
+	sed --verbose 'quoted text' && "$1" grep 2>/dev/null
+		&& echo cd grep --verbose awk echo $(pwd) 2>/dev/null cd then
+	echo printf "$@" cd 'quoted text' | printf | export sed test then x=1 grep
+local $(pwd) printf local awk x=1 && test 'quoted text' export -eu done awk "$1"
+	done test "$@" awk then readonly
+2>/dev/null echo grep
+	export local /usr/bin /usr/bin /usr/bin grep then --verbose "$1" readonly ${HOME}
+		printf -eu 2>/dev/null grep $(pwd) x=1 readonly | printf 2>/dev/null
+		-eu cd && | test sed cd echo
+-eu /usr/bin && | -eu "$@"
+	sed local ${HOME} $(pwd) --verbose
+grep /usr/bin $(pwd) readonly cd echo cd
+	/usr/bin awk local 'quoted text'
+--verbose --verbose local |
+${HOME} 'quoted text' echo 'quoted text' test "$1" -eu awk
+	local then grep 2>/dev/null grep sed test cd test $(pwd) readonly
+	sed -eu --verbose local sed "$@" readonly && 'quoted text' | awk readonly
+2>/dev/null 'quoted text' "$@" echo $(pwd) grep 'quoted text'
+then --verbose printf done x=1 "$1"
+	${HOME} 'quoted text' cd grep sed | awk echo --verbose "$@" $(pwd) && "$@"
+"$1" && "$@" local ${HOME} grep --verbose && 2>/dev/null && 'quoted text' ${HOME}
+	x=1 'quoted text' 2>/dev/null "$@"
+		cd awk then && local done
+x=1 "$1" then x=1 readonly --verbose | --verbose "$@" readonly
+| 2>/dev/null echo "$1" x=1 test /usr/bin && sed 2>/dev/null "$1" ${HOME}
+"$1" sed local -eu 'quoted text'
+-eu 'quoted text' echo ${HOME}
+		"$@" test grep "$@" 'quoted text' /usr/bin | /usr/bin then printf --verbose
+	echo "$1" test $(pwd) 2>/dev/null 'quoted text'
+	echo cd x=1 printf -eu readonly echo x=1 "$1" x=1 | readonly | printf sed
+		done | test | echo /usr/bin cd x=1 then
+		printf sed sed /usr/bin
+	"$@" readonly $(pwd) "$@" grep test 'quoted text' 'quoted text' printf 'quoted text'
+		&& grep grep | ${HOME} printf echo ${HOME} && 2>/dev/null echo printf $(pwd)
+	printf printf "$@" && local /usr/bin done
+	grep "$1" 'quoted text' test echo awk awk then test "$1" | "$@" "$@"
+--verbose echo ${HOME} then grep grep && sed 'quoted text' "$1" /usr/bin ${HOME}
+sed grep x=1 "$@" export test grep x=1 test grep then grep done ${HOME} "$@"
+	cd 2>/dev/null awk "$@"
+	--verbose 2>/dev/null echo | printf
+		| done grep && ${HOME} printf test
+/usr/bin echo sed local
+2>/dev/null && readonly /usr/bin | done $(pwd) cd
+"$1" awk awk then 2>/dev/null readonly awk | && -eu readonly
+readonly --verbose local done cd sed done -eu --verbose
+echo "$@" --verbose export echo then 'quoted text' readonly x=1 "$1"
+&& --verbose test readonly | "$@" grep 2>/dev/null x=1 then --verbose awk ${HOME}
+--verbose sed "$1" | --verbose
+		"$1" && test printf "$@" local ${HOME} readonly
+		then "$@" awk test x=1 export $(pwd) --verbose 'quoted text'
+printf then -eu -eu cd x=1 $(pwd) 2>/dev/null export
+"$1" local x=1 "$1" /usr/bin printf $(pwd) awk $(pwd) sed
+	grep -eu printf test readonly export
+'quoted text' | readonly 'quoted text' grep cd 2>/dev/null
+	'quoted text' readonly ${HOME} then -eu
+		readonly --verbose 'quoted text' readonly && export done export
+	x=1 grep readonly 2>/dev/null sed /usr/bin
+printf grep then cd awk grep $(pwd) test /usr/bin "$1" -eu 'quoted text' done
+x=1 && sed grep "$1" "$@" ${HOME} cd echo $(pwd) 2>/dev/null
+readonly awk readonly "$1" 'quoted text' --verbose -eu test
+then cd x=1 cd printf 2>/dev/null 'quoted text' /usr/bin then "$1" readonly
+then printf "$1" cd --verbose sed test printf
+		sed grep | readonly && | local 2>/dev/null /usr/bin echo $(pwd) "$@" done |
+	export "$@" | then local 2>/dev/null
+$(pwd) -eu awk -eu /usr/bin -eu then grep -eu local grep
+	'quoted text' done export
+		$(pwd) -eu "$@" "$@" printf $(pwd) && readonly grep "$@" --verbose x=1 readonly
+	"$@" export printf --verbose cd echo $(pwd) 'quoted text' $(pwd)
+readonly then ${HOME} done "$1"
+then local $(pwd) done --verbose
+		2>/dev/null printf x=1 readonly test $(pwd)
+$(pwd) readonly 'quoted text' "$@" 'quoted text' -eu then && ${HOME}
+	sed printf ${HOME} 2>/dev/null test sed $(pwd) readonly ${HOME} /usr/bin "$@"
+		grep readonly | | grep done
+cd 2>/dev/null then --verbose &&
+grep 2>/dev/null "$@" readonly x=1 x=1 awk done
+$(pwd) readonly x=1 /usr/bin -eu "$@" export ${HOME} -eu
+"$1" grep grep test && export && readonly
+	readonly done -eu 2>/dev/null awk 'quoted text' &&
+done | echo then test && | && grep && awk &&
+		export export done readonly echo awk printf /usr/bin awk /usr/bin 'quoted text'
+	/usr/bin --verbose $(pwd) export /usr/bin "$1" | grep
+	| -eu test sed 'quoted text' /usr/bin cd cd $(pwd) && awk /usr/bin
+		awk ${HOME} then sed grep test && --verbose
+| x=1 x=1 printf test --verbose echo echo && export 'quoted text'
+cd /usr/bin then $(pwd) then ${HOME} local printf sed /usr/bin
+"$1" export /usr/bin echo | sed test echo export ${HOME}
+echo "$@" /usr/bin 2>/dev/null 'quoted text' -eu "$@" sed --verbose readonly
+"$1" awk -eu export done then x=1 "$@" 'quoted text' | "$@" sed "$@" printf
+/usr/bin awk && grep && 2>/dev/null --verbose done printf /usr/bin -eu awk
+cd --verbose then sed $(pwd) awk 'quoted text'
+-eu 'quoted text' | awk --verbose ${HOME}
+		&& | sed grep readonly /usr/bin x=1 grep sed awk 2>/dev/null
+	export local && printf $(pwd)
+		test then readonly "$@" local ${HOME} local grep cd printf grep printf
+	echo sed done grep "$@" 2>/dev/null
+sed local "$@" grep printf 2>/dev/null ${HOME} sed 2>/dev/null
+	"$@" /usr/bin "$@" 'quoted text' test local grep $(pwd) "$@" $(pwd) grep /usr/bin
+		-eu && export --verbose awk --verbose
+${HOME} --verbose ${HOME} cd then export echo "$@" $(pwd) "$@" ${HOME} sed cd then
+${HOME} "$1" --verbose $(pwd) ${HOME} echo then 'quoted text'
+	local echo --verbose printf && export
+		-eu printf -eu readonly | "$@" echo readonly
+		$(pwd) sed grep 2>/dev/null echo "$@" -eu && 2>/dev/null
+local x=1 readonly test $(pwd) echo --verbose | then
+	sed --verbose readonly sed 'quoted text' awk $(pwd) "$@" test test
+		local readonly 'quoted text' | echo sed 2>/dev/null 2>/dev/null 2>/dev/null
+&& local export --verbose test printf
+awk sed 2>/dev/null "$1" local "$1"
+done test && --verbose echo /usr/bin -eu grep awk --verbose awk -eu grep
+	"$1" | && "$@" x=1 grep --verbose local
+		done export $(pwd) | /usr/bin 2>/dev/null && /usr/bin echo grep
+		${HOME} "$@" done "$@" "$1" awk echo echo local local | ${HOME} export 2>/dev/null
+	local -eu cd "$1" cd && --verbose 2>/dev/null
+test export grep /usr/bin grep readonly sed $(pwd)
+		test 2>/dev/null grep $(pwd) awk "$1" readonly readonly ${HOME} cd x=1 --verbose
+done then && echo && export
+	| 2>/dev/null printf $(pwd) -eu printf printf readonly /usr/bin then $(pwd)
+&& ${HOME} --verbose && "$@" && done -eu test --verbose echo
+		local echo done export --verbose ${HOME} awk /usr/bin 'quoted text'
+	export | then 'quoted text' && "$@" test -eu $(pwd) "$1" "$@" cd -eu x=1 | cd
+	grep x=1 x=1 $(pwd) readonly && "$@" done export 2>/dev/null 'quoted text' /usr/bin
+	'quoted text' awk readonly 'quoted text' printf echo test export echo
+		cd grep && cd then 2>/dev/null | grep $(pwd) echo test test readonly export
+		sed printf 2>/dev/null "$@" then /usr/bin "$1" 2>/dev/null
+	$(pwd) test awk test awk ${HOME} readonly -eu cd cd readonly /usr/bin printf
+-eu cd grep "$@" $(pwd) ${HOME}
+		| "$1" --verbose test export local local 'quoted text' | --verbose grep
+	$(pwd) awk "$1" 'quoted text' 2>/dev/null printf "$@" grep "$1" x=1 /usr/bin
+	then then /usr/bin sed "$1" awk /usr/bin
+		'quoted text' awk local /usr/bin | grep sed echo export
+		x=1 echo --verbose then ${HOME}
+	test && then --verbose /usr/bin -eu echo 'quoted text' readonly readonly
+		readonly echo --verbose grep readonly export printf
+		"$1" readonly echo && -eu printf 'quoted text'
+	"$@" $(pwd) && && export && --verbose grep then "$1" then local && x=1 x=1
+"$1" -eu echo cd export readonly | --verbose ${HOME} grep && export
+		$(pwd) export test export
+'quoted text' x=1 sed export
+	/usr/bin export awk cd echo test "$@" local printf test
+sed sed | grep $(pwd) grep -eu grep "$@" readonly
+test /usr/bin done /usr/bin
+	echo export -eu awk --verbose test 2>/dev/null /usr/bin
+export /usr/bin && then -eu x=1 echo local export x=1 done done
+${HOME} grep --verbose -eu | sed | 'quoted text' --verbose done "$1"
+	readonly "$@" awk $(pwd) && export "$1" awk "$@" grep x=1 test ${HOME} 'quoted text'
+	x=1 ${HOME} export then grep 2>/dev/null 'quoted text' 2>/dev/null
+	&& x=1 readonly --verbose x=1 --verbose printf 2>/dev/null sed x=1 "$1" export
+2>/dev/null --verbose /usr/bin sed 'quoted text'
+	export /usr/bin echo 2>/dev/null export "$1" && export grep x=1
+local --verbose awk /usr/bin test $(pwd) cd echo | ${HOME} "$1" test
+		"$@" /usr/bin ${HOME} cd && echo readonly /usr/bin && then "$1" cd local $(pwd)
+x=1 $(pwd) grep export
+	sed ${HOME} printf /usr/bin cd
+		test sed "$@" "$1" then sed readonly
+	x=1 && "$@" awk ${HOME} /usr/bin local $(pwd)
+	-eu done ${HOME} cd "$1" | grep $(pwd) 'quoted text' | "$@" export
+		export readonly /usr/bin readonly local sed grep printf done sed local
+2>/dev/null 'quoted text' then "$1"
+	&& && 'quoted text' 'quoted text' x=1 /usr/bin done
+/usr/bin -eu -eu sed | sed readonly | awk export awk grep readonly export x=1
+/usr/bin cd done 2>/dev/null
+--verbose sed echo done | 'quoted text' export
+#include c221.sh
+printf --verbose local x=1 "$@" $(pwd) echo echo "$1" --verbose
+$(pwd) echo "$1" --verbose then $(pwd) grep 'quoted text' test x=1
+printf echo awk /usr/bin 'quoted text' 2>/dev/null 'quoted text'
+	echo local /usr/bin export 'quoted text'
+/usr/bin ${HOME} printf cd && printf -eu | export x=1 awk printf
+	printf grep x=1 "$@" x=1 && echo sed 2>/dev/null ${HOME} ${HOME} --verbose
+	done local done then | -eu then 'quoted text' printf x=1 echo echo
+	'quoted text' sed then "$1" x=1 export awk local printf export export
+	2>/dev/null /usr/bin awk 'quoted text' printf "$@" 'quoted text'
+		grep cd awk cd 'quoted text' local 2>/dev/null /usr/bin test test x=1
+	'quoted text' readonly "$@" test awk x=1 awk && 2>/dev/null grep cd
+	echo --verbose x=1 && local 2>/dev/null cd printf
+done echo test 2>/dev/null cd local export
+x=1 printf test -eu "$@" -eu 'quoted text'
+	2>/dev/null export "$@" -eu done sed | -eu done "$1" echo awk -eu grep /usr/bin
+-eu local local $(pwd) echo awk echo test
+	done awk "$1" test done sed "$@" "$@" grep
+		&& grep $(pwd) "$@" 'quoted text' 'quoted text' --verbose "$1" "$@" readonly
+	echo awk cd cd $(pwd) awk readonly local ${HOME}
+	grep local done done "$1" && "$1"
+x=1 'quoted text' then | sed 'quoted text' done "$1"
+	"$1" export 'quoted text'
+		$(pwd) -eu -eu x=1 | sed echo sed awk
+	echo "$1" -eu | | sed ${HOME} && --verbose echo echo 2>/dev/null
+		x=1 ${HOME} ${HOME} local --verbose printf &&
+'quoted text' sed grep awk /usr/bin --verbose ${HOME} export
+		grep grep && ${HOME} | /usr/bin --verbose $(pwd) ${HOME} /usr/bin 2>/dev/null
+		grep printf ${HOME} then then awk awk /usr/bin | printf --verbose
+| grep awk printf /usr/bin cd "$1" done readonly 2>/dev/null /usr/bin readonly
+	done printf -eu ${HOME} x=1 readonly grep printf sed
+--verbose test --verbose echo test sed && && test export done | "$@" -eu
+--verbose 'quoted text' "$@"
+&& --verbose "$@" export test cd --verbose printf --verbose | $(pwd) | 2>/dev/null
+		/usr/bin "$@" -eu && done local "$@"
+local | sed then cd cd then test && awk "$1" awk then local test ${HOME} printf
+		/usr/bin test test 'quoted text' then --verbose awk export
+echo export x=1 "$@" | echo --verbose
+grep "$1" $(pwd) "$1" "$1" ${HOME} | awk cd "$@" cd sed echo "$1" 2>/dev/null
+sed x=1 -eu echo readonly test printf
+		$(pwd) -eu /usr/bin export | ${HOME} echo 'quoted text'
+	2>/dev/null "$@" printf 2>/dev/null cd then | "$@" readonly "$1" readonly
+test grep readonly $(pwd) awk awk echo printf "$@" export readonly
+		$(pwd) && 'quoted text'
+	'quoted text' x=1 /usr/bin echo cd x=1
+		--verbose test awk 2>/dev/null then && -eu printf sed && "$@" local "$@" "$1"
+		-eu echo test grep awk 'quoted text'
+	printf printf echo echo && --verbose "$1" cd 2>/dev/null $(pwd) "$@" readonly
+test then echo done awk then ${HOME} cd grep local sed "$@" 2>/dev/null
+		--verbose "$1" --verbose --verbose | "$@" /usr/bin $(pwd) 2>/dev/null
+		then 'quoted text' ${HOME} 'quoted text' cd then done grep grep
+	then 2>/dev/null printf --verbose --verbose /usr/bin awk /usr/bin
+-eu cd 2>/dev/null -eu "$1" "$1" | readonly ${HOME} local -eu cd local then -eu
+	"$1" awk | test "$@" cd export 2>/dev/null
+	then "$1" then && test "$@" "$@" echo 2>/dev/null
+echo export readonly done cd awk x=1
+	${HOME} test | then "$@" | grep done
+sed "$1" done -eu /usr/bin "$@" --verbose
+	cd awk awk awk "$@" ${HOME} test test
+	"$1" $(pwd) done 2>/dev/null
+	readonly echo /usr/bin local local
+x=1 /usr/bin && sed -eu /usr/bin export test export
+		test | "$@" --verbose echo printf /usr/bin local ${HOME}
+	'quoted text' printf sed then done 2>/dev/null
+	grep x=1 export $(pwd) $(pwd)
+	sed test "$1" /usr/bin && local then && --verbose
+2>/dev/null printf cd 2>/dev/null ${HOME} /usr/bin then | /usr/bin
+	"$@" 2>/dev/null -eu x=1 grep
+	grep "$1" test echo && grep awk && printf readonly readonly
+		"$1" test -eu --verbose "$1" $(pwd) awk ${HOME} printf | -eu printf ${HOME}
+	cd "$@" test then x=1 $(pwd) "$@" 2>/dev/null ${HOME}
+	printf readonly echo printf x=1 ${HOME} -eu then awk -eu ${HOME} $(pwd) printf
+		test -eu | && readonly printf
+	| "$1" | grep echo "$1" --verbose local cd "$1" done echo grep
+		cd sed 'quoted text' grep -eu "$@" -eu readonly sed x=1 echo cd done &&
+2>/dev/null export printf sed local -eu test "$1"
+	echo echo "$1" "$@" /usr/bin cd 'quoted text' -eu 'quoted text' sed export grep
+		export -eu "$@" x=1 test echo "$@" printf 'quoted text' export
+	grep -eu awk export readonly && export 'quoted text' echo ${HOME}
+	done sed export then 2>/dev/null echo --verbose --verbose
+done $(pwd) done awk /usr/bin then |
+		readonly export | then local local cd /usr/bin done "$1" export echo
+awk --verbose test | cd -eu
+		x=1 readonly --verbose awk test sed -eu 2>/dev/null echo ${HOME} done &&
+	readonly echo done | printf "$1" printf
+	test /usr/bin cd "$1" sed sed readonly export sed then
+	done "$1" ${HOME} printf
+		2>/dev/null test readonly then $(pwd) cd export readonly readonly sed test
+	-eu $(pwd) && done $(pwd) awk 'quoted text' readonly -eu x=1 local readonly
+	${HOME} --verbose /usr/bin
+"$@" && export --verbose then sed 'quoted text' done local
+cd ${HOME} | sed local x=1 grep echo export
+		-eu && && awk echo grep done && echo printf 'quoted text'
+	--verbose local "$@" local local sed readonly sed x=1 "$@" printf
+		done && done readonly sed awk awk ${HOME} readonly readonly x=1
+		local awk /usr/bin awk
+| 'quoted text' | -eu cd readonly cd grep ${HOME} "$@" local then
+echo export then /usr/bin printf
+		"$@" cd awk && "$1" printf grep x=1 $(pwd) 2>/dev/null awk then readonly "$1"
+		printf printf done x=1 -eu ${HOME} printf && sed export /usr/bin
+export | local done cd local --verbose
+	grep readonly /usr/bin && readonly ${HOME} printf cd "$@" grep "$1" sed
+		/usr/bin 'quoted text' "$@"
+		x=1 test local done x=1 x=1 && /usr/bin
+		done cd ${HOME} && ${HOME} export ${HOME} "$1" 2>/dev/null "$1" $(pwd) awk printf
+		${HOME} test 2>/dev/null readonly /usr/bin --verbose readonly 2>/dev/null done &&
+		"$@" export "$@" printf
+	${HOME} sed /usr/bin --verbose
+	readonly printf export 2>/dev/null /usr/bin
+	then echo export echo cd cd "$1" $(pwd) "$1" done --verbose "$1"
+&& 2>/dev/null export "$1" "$@" echo readonly --verbose "$@" awk ${HOME} ${HOME}
+${HOME} --verbose cd 2>/dev/null local test readonly cd ${HOME} 2>/dev/null
+	"$1" done /usr/bin --verbose x=1 'quoted text' | done
+		/usr/bin awk sed local x=1 printf local && x=1 "$@" cd "$1" && 2>/dev/null
+	2>/dev/null "$1" export && && | $(pwd) | | 'quoted text' x=1 -eu | echo
+grep awk --verbose grep awk
+	export /usr/bin 'quoted text' then 2>/dev/null ${HOME} local $(pwd)
+		x=1 printf /usr/bin done
+cd cd echo ${HOME} cd && export sed "$@" then 2>/dev/null readonly export readonly
+	awk awk $(pwd) local test && 2>/dev/null then
+		--verbose $(pwd) done test printf 2>/dev/null sed printf local -eu
+		readonly "$@" grep "$@" readonly printf
+test -eu export && 'quoted text' | grep grep
+'quoted text' "$@" -eu readonly
+	"$1" | local && local ${HOME} printf && done "$1" cd ${HOME} /usr/bin local grep
+test 2>/dev/null x=1 | grep "$@" echo /usr/bin
+local | -eu $(pwd) export "$1" | $(pwd) local grep x=1
+2>/dev/null 2>/dev/null sed 'quoted text' 'quoted text' 2>/dev/null
+		2>/dev/null done /usr/bin
+		$(pwd) grep sed "$1" 2>/dev/null local test
+	local -eu "$@" grep -eu x=1 -eu "$1"
+	test printf printf ${HOME} export grep export "$@" 'quoted text'
+	sed | echo 2>/dev/null export then ${HOME} && && "$@" test "$@"
+printf test x=1 /usr/bin cd && printf sed cd awk local done --verbose
+x=1 $(pwd) -eu test cd --verbose
+	cd | && /usr/bin 'quoted text' grep $(pwd) sed cd readonly --verbose
+"$@" ${HOME} /usr/bin -eu cd -eu 'quoted text' done 'quoted text'
+	"$1" local | 2>/dev/null $(pwd) echo ${HOME} readonly then ${HOME}
+2>/dev/null then 2>/dev/null echo | grep "$@" -eu then local local
+	grep readonly local echo "$@" done "$1" echo cd -eu /usr/bin $(pwd) -eu "$1" -eu
+		${HOME} /usr/bin --verbose && ${HOME}
+| export "$1" -eu 2>/dev/null x=1 'quoted text' local | | 'quoted text' 'quoted text'
+		&& 2>/dev/null local ${HOME} ${HOME} "$1" 'quoted text' readonly && then &&
+printf 'quoted text' x=1
+	--verbose grep && echo && sed $(pwd) $(pwd)
+sed --verbose local then awk grep then "$@" then export | "$@" export
+${HOME} --verbose sed | "$@" 2>/dev/null && 2>/dev/null $(pwd) "$@"
+		readonly done ${HOME} grep | local export --verbose "$1" "$@" -eu
+/usr/bin local sed "$1" | 2>/dev/null
+		done export --verbose echo grep then awk done test "$1" local sed && cd
+	"$@" readonly x=1 x=1 readonly "$@"
+	sed then "$1" && -eu -eu then echo ${HOME} then $(pwd) printf printf -eu test
+	test ${HOME} 2>/dev/null awk -eu /usr/bin
+		done 'quoted text' "$@" sed 'quoted text'
+	'quoted text' export cd then x=1 then 'quoted text' ${HOME}
+${HOME} | $(pwd) sed $(pwd) sed 2>/dev/null $(pwd) readonly
+	grep done export ${HOME} sed "$@" $(pwd)
+sed x=1 then --verbose then test 2>/dev/null /usr/bin cd ${HOME}
+		test printf --verbose then "$1" | echo | && printf -eu cd
+		| x=1 echo | $(pwd) -eu export
+		echo readonly awk ${HOME} printf sed x=1 --verbose test --verbose $(pwd) 2>/dev/null
+		x=1 | 'quoted text' test done | $(pwd) | -eu local sed | readonly
+		${HOME} local test "$@" --verbose $(pwd) export
+		x=1 x=1 export && x=1 test readonly ${HOME} 2>/dev/null 2>/dev/null | -eu "$1"
+then printf export 'quoted text'
+		$(pwd) sed cd 2>/dev/null | "$1" x=1 -eu -eu "$@" export 'quoted text' ${HOME}
+"$1" readonly 'quoted text' export cd awk grep readonly then cd done
+		'quoted text' test && 'quoted text' /usr/bin
+		export /usr/bin && printf && 2>/dev/null sed readonly "$@" 'quoted text'
+		printf test readonly export ${HOME} 'quoted text' /usr/bin export readonly
+| "$@" printf 'quoted text'
+		$(pwd) then sed ${HOME} test 2>/dev/null 2>/dev/null --verbose cd export
+		local x=1 2>/dev/null echo echo readonly ${HOME} test $(pwd) -eu
+		--verbose test cd x=1 awk 'quoted text' test export "$1" grep awk 'quoted text'
+	"$1" /usr/bin x=1 "$@" -eu -eu
+		${HOME} x=1 && sed && x=1 --verbose 'quoted text' awk cd echo /usr/bin "$@" "$1"
+grep awk sed done test --verbose
+		printf export x=1 $(pwd) done
+	x=1 && --verbose $(pwd) readonly $(pwd) x=1
+	$(pwd) echo "$@" x=1 cd printf ${HOME}
+		| "$1" readonly then readonly -eu done
+printf x=1 --verbose cd
+--verbose grep x=1 | echo cd echo export
+2>/dev/null local test awk sed --verbose
+	awk echo && | done && test local local -eu --verbose
+	-eu "$@" local local readonly | | cd x=1
+		| done /usr/bin /usr/bin then readonly
+	sed awk ${HOME} readonly cd | export export local && ${HOME}
+| cd 'quoted text' readonly awk $(pwd) --verbose && | "$@" export &&
+		/usr/bin printf -eu 'quoted text' /usr/bin readonly
+"$1" done readonly 2>/dev/null --verbose test sed "$@"
+	${HOME} echo readonly grep "$@" && /usr/bin /usr/bin -eu "$@" x=1 done
+	2>/dev/null printf grep 'quoted text' -eu export
+	sed | then "$@" grep x=1 sed printf --verbose &&
+	-eu awk test && && done test /usr/bin awk "$@" -eu echo "$@" done cd /usr/bin
+		sed readonly awk -eu sed done "$1" cd export export local export "$@"
+export "$@" /usr/bin printf grep
+cd | /usr/bin x=1 /usr/bin
+	${HOME} local local grep export cd awk 2>/dev/null ${HOME}
+	readonly x=1 printf x=1 | export test then "$1" test then
+		awk cd awk 'quoted text' $(pwd) --verbose
+	x=1 awk echo /usr/bin done export sed echo $(pwd) readonly "$@" -eu
+	local ${HOME} -eu x=1 ${HOME} echo cd test $(pwd)
+		readonly -eu readonly /usr/bin /usr/bin | sed ${HOME} "$@" local |
+${HOME} ${HOME} "$@" $(pwd) awk
+		then awk local -eu echo 'quoted text' /usr/bin readonly
+	then grep echo "$@" done printf awk | 2>/dev/null
+sed cd && -eu "$1" --verbose local $(pwd) echo printf readonly 2>/dev/null readonly
+		-eu $(pwd) export sed export then printf "$@" | test cd then /usr/bin "$1"
+		readonly echo cd printf awk x=1 -eu export
+	printf sed printf echo readonly /usr/bin readonly local awk -eu 2>/dev/null
+		test sed 'quoted text' grep /usr/bin test "$@" export done readonly export
+	readonly "$@" | && &&
+--verbose done cd /usr/bin done local
+		export awk --verbose echo --verbose awk "$@" /usr/bin
+grep "$1" cd x=1 2>/dev/null --verbose 'quoted text' export && "$1" local -eu
+	sed cd 2>/dev/null local x=1 done readonly 2>/dev/null readonly
+		&& 2>/dev/null local local readonly export $(pwd) local cd done ${HOME}
+		"$@" sed cd done then awk awk | test 2>/dev/null cd 2>/dev/null printf
+	/usr/bin | "$@" grep 'quoted text' 2>/dev/null
+		then 2>/dev/null export $(pwd) "$1" --verbose $(pwd) 'quoted text'
+	awk printf local --verbose -eu echo echo 2>/dev/null
+		export sed --verbose awk /usr/bin 'quoted text' x=1 2>/dev/null "$1"
+		readonly sed sed "$@" && awk -eu | "$@" ${HOME} "$@"
+	cd sed ${HOME} /usr/bin cd /usr/bin
+		printf grep ${HOME} "$@" 2>/dev/null /usr/bin "$@" "$1" x=1
+	export echo "$1" 2>/dev/null 2>/dev/null awk then readonly
+done "$1" grep grep 2>/dev/null sed printf test /usr/bin
+		echo sed 'quoted text' "$@"
+	printf printf | export test /usr/bin
+		export && "$@" test 2>/dev/null -eu | "$1"
+		readonly test echo export printf /usr/bin
+	sed local ${HOME} echo ${HOME} done --verbose 2>/dev/null
+	export awk printf --verbose /usr/bin -eu ${HOME} 'quoted text'
+sed cd ${HOME} && grep -eu $(pwd) --verbose "$1" test cd done grep "$@" grep
+${HOME} cd grep then grep cd local then 'quoted text'
+test && then | awk sed done --verbose --verbose 'quoted text'
+		${HOME} --verbose grep echo printf grep
+grep x=1 grep && awk grep ${HOME} 'quoted text'
+	readonly done export $(pwd) cd "$1" && | echo sed
+/usr/bin --verbose 2>/dev/null test "$@" ${HOME} cd | test ${HOME} awk --verbose
+		awk then grep 2>/dev/null "$1" echo -eu
+		export && $(pwd) /usr/bin readonly readonly cd $(pwd)
+printf cd sed $(pwd) $(pwd)
+	printf echo printf export | test printf echo "$1"
+readonly export /usr/bin done cd x=1 && 'quoted text'
+		$(pwd) | test local export
+	cd --verbose grep local then then then
+		then awk local readonly x=1 "$@" | "$1" printf done
+-eu "$1" echo --verbose cd sed awk local echo x=1 then 2>/dev/null
+done readonly test readonly
+		then export $(pwd) local export grep
+${HOME} sed echo echo readonly "$1" printf sed grep &&
+	/usr/bin "$@" /usr/bin sed echo --verbose
+	-eu cd ${HOME} export then && | awk
+	export 'quoted text' cd printf -eu "$1" "$1" 2>/dev/null --verbose /usr/bin readonly
+	2>/dev/null readonly local
+		${HOME} "$@" 'quoted text' local x=1
+		/usr/bin local --verbose --verbose "$@" then export
+	then /usr/bin then "$1" ${HOME} cd cd "$@" 'quoted text'
+		/usr/bin --verbose 2>/dev/null "$1" sed 2>/dev/null readonly export printf
+		--verbose ${HOME} export
+	'quoted text' --verbose -eu "$1" test ${HOME}
+export /usr/bin "$1" export 'quoted text' "$@" grep
+		printf export ${HOME} "$@" "$1" sed 2>/dev/null
+		cd /usr/bin --verbose printf readonly && 2>/dev/null
+"$1" echo x=1 test /usr/bin local
+	test done "$@" 'quoted text' printf export done -eu cd echo ${HOME} export
+		export $(pwd) test x=1 --verbose 'quoted text' done /usr/bin -eu 'quoted text'
+	local "$@" printf local "$1" ${HOME} "$1" /usr/bin 2>/dev/null "$@" && test | export
+	-eu x=1 2>/dev/null ${HOME} awk 2>/dev/null grep local |
+2>/dev/null | ${HOME} done local &&
+	x=1 done cd x=1 && sed
+		2>/dev/null | x=1 test ${HOME} grep
+| --verbose readonly $(pwd)
+		--verbose 'quoted text' x=1 grep export
+		${HOME} 'quoted text' | echo ${HOME} --verbose readonly
+test local echo then echo printf && cd grep export cd test test x=1 then
+		"$1" --verbose -eu export $(pwd)
+	$(pwd) /usr/bin x=1 grep 'quoted text' && 2>/dev/null "$@"
+		"$@" cd test && test cd "$@" done echo && readonly
+done /usr/bin --verbose export -eu -eu --verbose 'quoted text' sed cd cd 2>/dev/null
+		--verbose cd x=1 'quoted text' cd printf --verbose printf
+echo -eu /usr/bin -eu test local
+	/usr/bin cd readonly -eu
+export --verbose awk x=1 ${HOME} | x=1 | $(pwd) awk | $(pwd) | done readonly
+	/usr/bin then $(pwd) readonly done local local awk 'quoted text' /usr/bin
+		local grep --verbose printf "$@" "$1"
+'quoted text' --verbose ${HOME} --verbose
+"$@" --verbose && sed -eu echo 2>/dev/null /usr/bin
+${HOME} | --verbose export local && echo ${HOME} printf
+cd "$1" --verbose local done $(pwd) test printf
+	&& ${HOME} --verbose local printf /usr/bin
+readonly local local cd awk ${HOME}
+	| cd grep grep cd cd then -eu
+-eu readonly then && done printf
+	cd sed export 2>/dev/null export awk readonly done printf && done awk -eu $(pwd)
+-eu "$1" local printf local export done 2>/dev/null 2>/dev/null
+		"$1" test $(pwd) export ${HOME} "$1" $(pwd) printf 'quoted text'
+		export sed export "$1" cd sed "$1" echo done grep then readonly
+	| "$1" "$@" readonly local $(pwd) | awk && x=1 -eu sed --verbose && /usr/bin
+${HOME} echo sed cd awk export sed | grep x=1 "$1" $(pwd) test 2>/dev/null
+	test 'quoted text' printf readonly then test /usr/bin "$1"
+		&& local --verbose 2>/dev/null export "$@"
+then local | -eu x=1 "$1" "$@" 2>/dev/null awk cd 'quoted text' -eu readonly
+		done --verbose sed test sed cd done
+x=1 test x=1 -eu /usr/bin done grep
+		| -eu 2>/dev/null 2>/dev/null 2>/dev/null local "$@" "$@" cd /usr/bin 'quoted text'
+		local done /usr/bin local | awk echo awk --verbose
+	done echo --verbose 2>/dev/null then 'quoted text' awk echo
+		--verbose x=1 ${HOME} && local "$1" printf test awk test local grep
+	x=1 2>/dev/null "$1" --verbose
+		/usr/bin && export local readonly 2>/dev/null 2>/dev/null cd awk | printf
+readonly --verbose /usr/bin printf printf export
+	| "$1" readonly --verbose x=1 2>/dev/null | "$1" cd && done /usr/bin 2>/dev/null
+-eu grep grep | /usr/bin local --verbose sed "$1" sed && 2>/dev/null -eu "$@" done
+		sed echo | then 'quoted text' cd $(pwd) "$1" | x=1 && readonly
+awk echo x=1 "$@" ${HOME} readonly
+		printf $(pwd) ${HOME} echo 2>/dev/null | -eu awk grep ${HOME} x=1
+	sed $(pwd) test 2>/dev/null "$1" cd cd "$1"
+	x=1 local awk cd 2>/dev/null
+	"$1" 'quoted text' sed 2>/dev/null -eu test 2>/dev/null export
+local test cd | grep readonly sed -eu export export
+		readonly export local printf sed test -eu
+then /usr/bin cd $(pwd) readonly "$1" grep 2>/dev/null
+| local then done 'quoted text' && | awk printf test ${HOME} local "$@" local
+	then $(pwd) then -eu x=1 | test cd echo -eu "$@" $(pwd) 'quoted text'
+		printf printf && cd --verbose local $(pwd) test --verbose x=1 test "$1"
+	grep $(pwd) 2>/dev/null ${HOME}
+-eu then "$1" /usr/bin local --verbose /usr/bin 2>/dev/null x=1 cd test done awk
+then grep -eu "$1" export 'quoted text' "$1" local "$1" 2>/dev/null
+local done echo readonly "$1" ${HOME} /usr/bin "$1" then ${HOME} awk 'quoted text'
+	| sed x=1 $(pwd) "$@" ${HOME} cd export export -eu
+	${HOME} -eu /usr/bin sed "$1" 2>/dev/null 'quoted text' export echo && local
+		local x=1 2>/dev/null "$@" export cd "$@" export | 'quoted text' && 'quoted text'
+		echo --verbose | | "$@" printf /usr/bin "$1" printf test then 'quoted text' sed
+/usr/bin "$@" /usr/bin -eu
+	done $(pwd) readonly readonly then printf "$@" then
+		| && sed --verbose && "$@" awk ${HOME}
+		local local test done sed && 'quoted text' $(pwd) grep
+	export local 2>/dev/null sed local 'quoted text' --verbose done
+	grep echo test x=1 grep awk test then x=1 -eu
+echo readonly ${HOME} export then printf x=1 grep
+	sed done then -eu -eu x=1 "$1" x=1 awk "$@"
+--verbose readonly -eu ${HOME} export then 'quoted text' --verbose "$1" sed --verbose
+	/usr/bin local x=1 cd local grep ${HOME}
+		$(pwd) && && | echo sed && | ${HOME} -eu 2>/dev/null && sed sed awk "$@" printf
+	echo 2>/dev/null then echo local $(pwd)
+| printf /usr/bin export sed "$@"
+		--verbose export x=1 && --verbose "$1" done printf
+		export x=1 local "$@" grep --verbose -eu export echo test "$1" && sed sed readonly
+		export test then "$@" printf && x=1 -eu "$@" ${HOME} test 'quoted text' then
+		2>/dev/null done "$1" sed &&
+		export 'quoted text' /usr/bin echo export export && | 'quoted text'
+	grep 2>/dev/null /usr/bin done export /usr/bin cd printf
+		printf readonly $(pwd) -eu done --verbose | cd
+done test done --verbose --verbose done
+	'quoted text' test 'quoted text' grep $(pwd)
+${HOME} /usr/bin awk printf then $(pwd) -eu && test
+	sed "$1" awk /usr/bin printf
+| test done $(pwd) done cd "$1" && readonly ${HOME} cd
+		export then 'quoted text' && readonly -eu echo |
+	test && export done "$1" -eu | echo printf x=1 | cd /usr/bin echo
+	x=1 ${HOME} | then grep then awk x=1 export local echo ${HOME}
+	readonly cd /usr/bin then local grep awk awk "$@" "$@" readonly -eu 'quoted text'
+		local local then x=1 sed x=1 local printf 2>/dev/null | echo export /usr/bin then
+printf echo cd done | $(pwd)
+	"$@" 2>/dev/null x=1 x=1 readonly
+	2>/dev/null test ${HOME} -eu "$1" 'quoted text' test "$@" 'quoted text'
+		then printf 2>/dev/null export readonly done
+	printf echo export local printf grep
+	"$@" "$@" 'quoted text' 'quoted text'
+		&& cd export $(pwd) 2>/dev/null 2>/dev/null echo cd awk sed done $(pwd) | ${HOME}
+test ${HOME} | grep -eu readonly test 2>/dev/null
+		sed $(pwd) echo done $(pwd) test echo $(pwd) && "$1" cd x=1 then
+		--verbose cd sed x=1 printf grep readonly sed echo --verbose --verbose
+		local sed x=1 awk --verbose -eu test printf grep 2>/dev/null -eu done echo
+		| x=1 printf 'quoted text' 2>/dev/null
+x=1 printf export cd echo readonly cd echo test 'quoted text'
+test cd awk | 2>/dev/null awk readonly grep readonly 2>/dev/null 'quoted text'
+test echo awk readonly 2>/dev/null "$@" "$@" 'quoted text' --verbose
+		&& sed $(pwd) cd x=1 'quoted text'
+	local cd awk export | --verbose local printf 'quoted text'
+		--verbose 'quoted text' "$1" &&
+		local && $(pwd) readonly -eu then $(pwd) 'quoted text' && 2>/dev/null
+then 'quoted text' awk 2>/dev/null 'quoted text' --verbose
+	x=1 local grep 2>/dev/null export
+		then local /usr/bin readonly x=1
+	then echo export echo "$@" "$1" --verbose "$1" x=1 awk awk grep cd awk cd
+cd export $(pwd) && "$@" test local | export 'quoted text' echo
+"$1" "$@" grep cd echo && $(pwd) awk then readonly
+'quoted text' done grep test $(pwd) export done ${HOME} "$1" --verbose 'quoted text'
+	test ${HOME} done echo local cd ${HOME} done ${HOME} cd && local readonly
+x=1 x=1 printf ${HOME} && then "$@" cd ${HOME} | ${HOME} 2>/dev/null
+	--verbose "$1" test grep 'quoted text' x=1 echo readonly /usr/bin x=1 awk x=1
+test cd test $(pwd) grep done /usr/bin
+	export export "$1" | $(pwd) then -eu sed | --verbose local awk "$@" printf done
+	-eu readonly sed --verbose x=1 printf && $(pwd) ${HOME} -eu cd -eu
+&& /usr/bin $(pwd) done grep echo $(pwd) 'quoted text'
+		2>/dev/null export --verbose cd awk then done
+awk done 2>/dev/null x=1 awk printf -eu
+	cd "$1" ${HOME} 2>/dev/null sed
+		test x=1 2>/dev/null "$1" sed $(pwd) done grep echo grep
+then export "$1" 2>/dev/null
+then readonly && echo then && awk test
+${HOME} 'quoted text' ${HOME} grep ${HOME} && local && | -eu --verbose
+	$(pwd) x=1 readonly 'quoted text'
+		printf echo test local export -eu ${HOME} sed "$1" grep x=1 then "$@" 'quoted text'
+	sed /usr/bin printf "$1" && "$1" 2>/dev/null
+		2>/dev/null printf /usr/bin x=1 --verbose 'quoted text' 2>/dev/null echo echo done
+	/usr/bin "$1" -eu && local ${HOME} $(pwd) cd printf ${HOME} -eu | --verbose
+	${HOME} then && grep cd -eu /usr/bin && /usr/bin -eu echo readonly test then test
+		echo $(pwd) "$1" test "$@" -eu --verbose /usr/bin
+	'quoted text' awk $(pwd) done
+	export done cd awk $(pwd) awk 'quoted text'
+/usr/bin echo then | /usr/bin ${HOME} cd "$1" --verbose | export then
+	| then && then then cd
+		2>/dev/null 'quoted text' local "$1" x=1 'quoted text' /usr/bin
+	x=1 2>/dev/null done test readonly cd sed grep
+		awk cd export printf sed -eu | done -eu sed export 2>/dev/null
+	export readonly printf "$@" 'quoted text' echo test then done done echo awk -eu
+done 'quoted text' test -eu sed $(pwd) echo
+	"$@" 2>/dev/null $(pwd) awk ${HOME} then local cd --verbose
+	2>/dev/null x=1 awk --verbose && x=1 local "$1"
+		&& --verbose grep | "$1" cd | done ${HOME} -eu cd $(pwd)
+		test echo $(pwd) cd | "$@" -eu x=1 2>/dev/null echo "$1" then -eu export echo then
+		'quoted text' --verbose ${HOME} "$1" readonly --verbose $(pwd) /usr/bin
+	'quoted text' local |
+test && printf awk sed "$@" | cd echo 'quoted text' done printf
+readonly 'quoted text' 2>/dev/null export echo && then readonly
+	grep --verbose grep export -eu then ${HOME} export -eu x=1 -eu echo
+	awk "$1" "$@" readonly awk local && $(pwd) x=1 readonly | grep grep
+		| "$1" export && | awk readonly then x=1 "$@" readonly x=1 | 2>/dev/null test
+	grep && -eu && done && echo readonly
+	/usr/bin local sed echo then x=1 grep "$@" -eu $(pwd) export grep grep | echo local
+sed 2>/dev/null sed /usr/bin
+	"$@" done readonly cd -eu done 2>/dev/null | printf done
+--verbose cd ${HOME} export "$1" /usr/bin "$1" export then
+		$(pwd) && 2>/dev/null
+awk -eu printf "$@" -eu printf local export
+		&& 'quoted text' grep echo 2>/dev/null 2>/dev/null
+	printf ${HOME} 'quoted text' sed sed sed sed done /usr/bin readonly
+-eu "$@" readonly -eu done
+		2>/dev/null export local ${HOME} ${HOME}
+	$(pwd) printf printf 2>/dev/null
+	done 2>/dev/null "$1" 'quoted text' /usr/bin export x=1 ${HOME} --verbose
+		2>/dev/null 2>/dev/null ${HOME}
+		export && | then 2>/dev/null && x=1
+"$1" local cd printf --verbose export
+	echo local echo awk echo
+"$1" x=1 x=1 ${HOME} echo grep x=1 awk --verbose x=1 x=1 | echo
+$(pwd) x=1 test then $(pwd) && then cd 'quoted text'
+"$@" then 2>/dev/null grep local
+	"$1" && sed grep 'quoted text' 'quoted text' awk $(pwd) sed
+		readonly --verbose --verbose --verbose "$1" export awk cd x=1 awk $(pwd) $(pwd)
+then then grep --verbose "$@" x=1 && readonly /usr/bin /usr/bin 'quoted text'
+	readonly 2>/dev/null then then printf
+		readonly | echo && then --verbose "$@" awk then echo ${HOME} | printf && cd -eu
+'quoted text' export cd cd 'quoted text'
+'quoted text' /usr/bin && x=1
+$(pwd) test then ${HOME}
+		cd && readonly 'quoted text' echo --verbose grep grep then then sed readonly
+		then cd ${HOME} then
+		printf echo grep -eu readonly readonly "$@"
+"$@" printf -eu "$@" done awk
+then --verbose "$1" cd sed done 2>/dev/null --verbose
+		/usr/bin test then grep --verbose /usr/bin done
+x=1 local --verbose 'quoted text' printf local 2>/dev/null printf done export
+	"$1" test "$@" local /usr/bin "$1" printf 2>/dev/null
+		${HOME} readonly "$1" export 2>/dev/null export echo sed ${HOME}
+$(pwd) $(pwd) test x=1 ${HOME} done done printf | awk | ${HOME} test /usr/bin
+	awk -eu then "$@" readonly x=1 test "$@" 'quoted text' local echo x=1 x=1 -eu
+--verbose sed export echo done local sed done printf 2>/dev/null printf
+		done echo test | -eu --verbose
+&& test "$@" cd awk ${HOME} cd | ${HOME} cd cd $(pwd) sed echo && | local local
+		then awk --verbose x=1 done cd cd --verbose
+		test | "$1" ${HOME} --verbose readonly awk sed then awk then echo 'quoted text'
+	done -eu -eu | echo x=1 | readonly cd && grep test printf grep 'quoted text'
+		then -eu "$@" | echo -eu readonly printf readonly
+	--verbose "$1" /usr/bin cd test 'quoted text' | ${HOME}
+		x=1 -eu "$@" export cd printf /usr/bin && x=1 2>/dev/null grep export test
+	"$1" cd awk -eu echo 2>/dev/null awk readonly
+		cd test && printf awk "$@" grep sed local awk local ${HOME} export local "$1"
+		--verbose export --verbose "$1" | "$1" then local
+		2>/dev/null test 2>/dev/null awk "$1" awk 'quoted text'
+		echo /usr/bin 2>/dev/null 2>/dev/null
+		$(pwd) && x=1 "$@" | grep export --verbose sed done /usr/bin
+	'quoted text' -eu x=1 ${HOME} /usr/bin | "$1" local readonly readonly
+grep ${HOME} printf -eu test "$1" ${HOME} local x=1 ${HOME} $(pwd)
+		${HOME} 'quoted text' $(pwd) readonly --verbose --verbose 'quoted text'
+		$(pwd) | && done cd test ${HOME} readonly /usr/bin grep sed 2>/dev/null
+$(pwd) "$1" ${HOME} export | /usr/bin &&
+$(pwd) | test -eu "$1" "$1" x=1 "$1" local printf x=1 echo 'quoted text'
+		"$1" | "$@" grep -eu readonly --verbose | 2>/dev/null
+	-eu | && 2>/dev/null then
+	x=1 x=1 --verbose ${HOME} test sed "$@" /usr/bin done x=1 && 2>/dev/null test --verbose
+done sed sed done test export --verbose
+test printf echo ${HOME} /usr/bin grep && 2>/dev/null
+test ${HOME} /usr/bin test x=1 --verbose cd
+		test grep printf -eu export "$1" | readonly /usr/bin $(pwd) "$1" readonly
+	local "$@" ${HOME} -eu printf | grep test 'quoted text'
+		grep ${HOME} cd readonly done
+2>/dev/null $(pwd) "$@" 'quoted text' $(pwd) awk 'quoted text' done
+		grep "$1" grep "$1" | -eu | --verbose local printf readonly $(pwd) cd done then
+echo | done x=1 grep "$1"
+		printf 2>/dev/null ${HOME} local
+	| ${HOME} $(pwd) /usr/bin $(pwd) 'quoted text'
+	sed then "$@" /usr/bin ${HOME} 2>/dev/null ${HOME} then /usr/bin x=1 then
+2>/dev/null 2>/dev/null printf 2>/dev/null "$1"
+	2>/dev/null readonly grep /usr/bin ${HOME}
+-eu /usr/bin awk cd "$@" printf done awk | test x=1 echo ${HOME} "$@"
+	local x=1 export cd 'quoted text' echo echo done
+	sed && && cd --verbose x=1 --verbose
+/usr/bin test /usr/bin echo
+then -eu awk && export /usr/bin cd echo export printf $(pwd)
+		readonly --verbose 'quoted text' -eu $(pwd)
+| printf cd 2>/dev/null test "$@" awk "$@" then done awk printf
+export echo cd -eu 'quoted text' --verbose "$@"
+	$(pwd) --verbose printf ${HOME} && -eu local done grep ${HOME} then sed then
+	2>/dev/null echo | readonly
+		$(pwd) sed /usr/bin ${HOME} 2>/dev/null
+	2>/dev/null && ${HOME} ${HOME} grep readonly
+	export "$1" test sed cd test ${HOME} && 'quoted text' export cd --verbose /usr/bin
+	2>/dev/null local && export "$1"
+		/usr/bin "$1" && printf then cd done x=1 grep
+	cd "$1" 2>/dev/null ${HOME} 2>/dev/null
+		cd -eu 'quoted text' $(pwd) done readonly /usr/bin
+	$(pwd) 2>/dev/null echo $(pwd) "$1" test $(pwd) x=1 awk printf 2>/dev/null 'quoted text'
+local --verbose ${HOME} $(pwd) cd awk 2>/dev/null
+	echo /usr/bin -eu done grep echo 'quoted text'
+	-eu echo 2>/dev/null done readonly
+		2>/dev/null awk && $(pwd) printf "$@" echo export -eu export done x=1 && then
+/usr/bin printf -eu readonly
+		'quoted text' x=1 printf $(pwd) then 2>/dev/null && "$@"
+printf then awk echo && done "$@" echo
+		${HOME} test | ${HOME} test "$1" cd | 2>/dev/null -eu $(pwd) done /usr/bin
+sed && awk readonly "$@" ${HOME} --verbose printf sed
+	test "$@" $(pwd) done grep readonly awk ${HOME} printf awk /usr/bin $(pwd)
+done --verbose export grep /usr/bin && readonly readonly "$1" 2>/dev/null /usr/bin
+"$1" local awk echo sed then && printf awk sed &&
+		x=1 echo --verbose "$@" /usr/bin ${HOME} ${HOME} 'quoted text' -eu 'quoted text'
+then sed readonly cd | &&
+		cd "$1" $(pwd) x=1 grep export
+	local cd done sed ${HOME} x=1 | cd echo 'quoted text'
+export 'quoted text' then $(pwd) then | export 2>/dev/null
+echo x=1 | done test x=1 sed $(pwd)
+--verbose awk /usr/bin
+		awk then done ${HOME} -eu --verbose printf readonly
+		local | "$1" done done 2>/dev/null x=1 test readonly awk --verbose
+		"$@" printf -eu $(pwd)
+		--verbose x=1 export then grep printf x=1 $(pwd) done grep test ${HOME} --verbose
+cd 'quoted text' printf echo echo ${HOME} done grep "$1" grep 'quoted text' readonly
+		&& "$1" done local "$1" grep printf done printf "$@" $(pwd) --verbose --verbose
+		x=1 awk done ${HOME} echo cd echo then -eu
+	export x=1 -eu | cd sed done awk printf
+test readonly echo && awk
+done -eu printf grep 2>/dev/null
+	echo local cd ${HOME} && "$1" | ${HOME} -eu printf ${HOME}
+	${HOME} x=1 $(pwd) | test -eu 'quoted text'
+--verbose cd x=1 /usr/bin "$@" 2>/dev/null $(pwd) cd "$@" &&
+	readonly done awk --verbose cd cd test ${HOME} test --verbose
+	awk ${HOME} 'quoted text' 'quoted text'
+		sed awk test cd readonly done grep "$1" -eu
+		then -eu "$@" awk readonly local 'quoted text' x=1 | $(pwd) awk && ${HOME}
+		"$1" local $(pwd) ${HOME} printf done && test local 'quoted text' readonly
+done x=1 "$1" /usr/bin | then && grep /usr/bin
+	${HOME} sed awk -eu awk sed --verbose $(pwd) done then then $(pwd)
+	$(pwd) $(pwd) && 2>/dev/null readonly printf -eu
+readonly cd $(pwd) awk "$@" test "$@"
+		export --verbose readonly cd | | local
+		x=1 awk printf "$1" $(pwd) test
+2>/dev/null then then
+	"$@" $(pwd) && cd printf 'quoted text' grep then
+&& cd printf "$@" --verbose echo readonly
+| readonly "$@" export grep echo grep 2>/dev/null --verbose 'quoted text'
+	echo && | 'quoted text' sed sed
+		$(pwd) -eu awk ${HOME} test 2>/dev/null cd ${HOME} then
+	--verbose awk "$1" 2>/dev/null cd x=1 -eu | readonly
+	x=1 "$@" export /usr/bin x=1 echo --verbose -eu cd
+-eu 'quoted text' x=1 local cd
+	"$1" readonly "$@" /usr/bin | local then cd /usr/bin test /usr/bin | then echo
+	${HOME} "$@" | then printf x=1 | export ${HOME}
+awk x=1 $(pwd) done 'quoted text' readonly 2>/dev/null local
+	test grep "$1" awk local /usr/bin $(pwd)
+cd grep -eu && | --verbose "$@" sed cd export export $(pwd) x=1 /usr/bin $(pwd)
+awk | export sed echo "$1" local local 'quoted text'
+		| "$@" "$@" /usr/bin cd
+/usr/bin cd 'quoted text' -eu local then 2>/dev/null x=1
+cd 2>/dev/null "$@" printf test awk readonly
+&& $(pwd) printf grep then local x=1
+		"$@" --verbose 'quoted text' echo && echo
+		local test -eu sed test export --verbose -eu --verbose done
+		$(pwd) ${HOME} printf "$@" 2>/dev/null done ${HOME}
+		cd readonly printf awk --verbose | -eu ${HOME}
+'quoted text' awk local "$@" echo cd | echo export
+	printf awk && 'quoted text' grep $(pwd) readonly
+$(pwd) awk 'quoted text'
+		grep "$@" cd sed export printf awk -eu ${HOME}
+	| readonly | 'quoted text' readonly test /usr/bin && local 2>/dev/null
+$(pwd) done --verbose cd done grep 2>/dev/null sed sed "$@" then cd cd awk readonly
+		export 2>/dev/null printf awk $(pwd) readonly
+done /usr/bin | readonly sed cd readonly "$@" grep
+	/usr/bin "$1" grep --verbose && 2>/dev/null ${HOME} "$1" --verbose
+		&& --verbose 2>/dev/null /usr/bin local && readonly "$1" --verbose
+local done 2>/dev/null readonly then export && 'quoted text' "$1"
+	"$1" then grep && then local awk -eu 2>/dev/null
+	$(pwd) printf readonly then 'quoted text' export printf readonly readonly
+		done -eu x=1 ${HOME} printf
+x=1 'quoted text' ${HOME}
+		export "$@" ${HOME} 2>/dev/null echo then
+printf "$1" -eu printf local grep --verbose echo test grep --verbose --verbose
+		cd cd 2>/dev/null -eu 2>/dev/null && x=1 x=1 cd x=1 echo awk
+		test done && 'quoted text' echo | test "$@" done "$@" printf
+printf 'quoted text' echo 'quoted text' local "$@" x=1 grep && done grep | 2>/dev/null
+	awk echo "$1" sed then
+		"$1" awk && "$@" --verbose -eu test export -eu
+x=1 && cd sed grep | done "$1" "$@" awk
+--verbose -eu then 2>/dev/null
+	-eu sed ${HOME} echo grep then
+		grep x=1 | $(pwd) ${HOME} readonly sed $(pwd)
+$(pwd) done -eu printf done export "$@" ${HOME} sed --verbose printf | readonly
+${HOME} "$@" done "$@" --verbose echo --verbose test && "$@"
+	then -eu echo test printf grep
+	&& printf sed /usr/bin
+done export "$@" printf 2>/dev/null awk sed awk $(pwd)
+'quoted text' --verbose ${HOME}
+		sed 'quoted text' test 2>/dev/null x=1 "$@" cd readonly awk ${HOME} grep
+	printf readonly printf
+"$1" export then sed /usr/bin export echo ${HOME} awk "$1" then printf echo
+	'quoted text' readonly grep /usr/bin export
+	then printf local grep | test
+	'quoted text' ${HOME} | "$1" --verbose
+2>/dev/null /usr/bin -eu readonly cd "$1" readonly "$1" 2>/dev/null sed printf
+		readonly printf grep printf awk sed $(pwd)
+		"$1" && printf echo local export 'quoted text' /usr/bin
+	&& && --verbose -eu --verbose cd echo x=1 done -eu --verbose
+		'quoted text' x=1 test
+&& x=1 -eu 2>/dev/null /usr/bin ${HOME} x=1 printf done 'quoted text' readonly
+$(pwd) grep --verbose 'quoted text'
+	sed local local "$@" "$1" /usr/bin
+	2>/dev/null /usr/bin readonly
+grep ${HOME} 'quoted text' awk done done grep readonly done printf grep
+'quoted text' local echo $(pwd) grep then && | cd && sed ${HOME} --verbose export
+		2>/dev/null && test "$1" test sed "$1"
+	&& awk $(pwd) | readonly 2>/dev/null printf "$1" then test
+	then "$@" | /usr/bin cd && done /usr/bin 'quoted text'
+x=1 test echo $(pwd) readonly 2>/dev/null sed && done /usr/bin awk
+		grep 'quoted text' cd grep $(pwd) done export done sed $(pwd)
+$(pwd) awk readonly 2>/dev/null ${HOME} && ${HOME} && printf
+		awk 'quoted text' then readonly -eu 'quoted text'
+	sed $(pwd) grep awk -eu "$@" && -eu local x=1 awk sed printf
+		local 2>/dev/null | printf cd 2>/dev/null -eu export --verbose
+	| printf done x=1 local x=1 | "$@" awk grep $(pwd) sed $(pwd) cd readonly
+	${HOME} test export local test test test ${HOME}
+test "$@" 'quoted text' /usr/bin local x=1
+		| /usr/bin "$1" | -eu awk then 'quoted text' local printf --verbose
+		done 'quoted text' 'quoted text' printf /usr/bin --verbose export "$1" echo
+		echo done | readonly grep | echo ${HOME} awk
+		sed then test | grep cd readonly x=1 cd 2>/dev/null
+cd ${HOME} --verbose | &&
+		cd awk echo grep | cd local cd awk printf 'quoted text' grep | sed echo
+awk | cd local -eu 'quoted text'
+		readonly 2>/dev/null
+		/usr/bin cd then ${HOME} printf grep sed sed "$1" cd 2>/dev/null
+cd readonly echo 'quoted text' 2>/dev/null $(pwd) cd /usr/bin
+		| readonly -eu local /usr/bin 2>/dev/null 2>/dev/null then sed
+	export --verbose export x=1 grep 2>/dev/null ${HOME} readonly | readonly && then
+	| /usr/bin | 2>/dev/null test
+		2>/dev/null x=1 test $(pwd) then
+		test readonly echo --verbose && x=1 test echo 2>/dev/null awk "$1" --verbose
+/usr/bin readonly done "$1" readonly /usr/bin done | x=1 then
+local cd cd echo "$@" | | 2>/dev/null
+		cd $(pwd) cd echo -eu cd "$@" -eu test | awk done awk then
+'quoted text' --verbose x=1
+	"$@" echo x=1 then readonly 2>/dev/null -eu
+		/usr/bin then local grep export printf test then 2>/dev/null |
+		"$1" test local local 'quoted text' -eu && $(pwd) |
+export done && grep $(pwd) -eu echo awk
+	$(pwd) echo -eu -eu "$1" local "$@" cd grep x=1 "$@" "$1"
+"$1" done /usr/bin readonly x=1 sed
+echo x=1 awk ${HOME} local | printf
+	/usr/bin readonly readonly echo ${HOME} export 2>/dev/null $(pwd) export &&
+	| ${HOME} 'quoted text'
+	test awk export 'quoted text' grep local -eu "$1" ${HOME} test grep -eu
+		grep done readonly cd 'quoted text' -eu && 'quoted text' test
+	x=1 "$1" done then done then 'quoted text' readonly -eu cd test done ${HOME} --verbose
+grep cd x=1 export --verbose && --verbose --verbose x=1 awk $(pwd) -eu echo
+	--verbose $(pwd) --verbose
+	x=1 cd /usr/bin ${HOME} then $(pwd) 2>/dev/null -eu x=1 "$1" sed --verbose
+-eu sed printf --verbose x=1 cd echo readonly
+	local /usr/bin grep local local cd test readonly then
+done readonly awk awk /usr/bin awk readonly 'quoted text' echo
+&& done 'quoted text' cd awk printf awk cd readonly then printf cd x=1 && --verbose
+	sed && ${HOME} awk "$@" $(pwd)
+2>/dev/null 2>/dev/null 2>/dev/null then -eu echo grep /usr/bin && $(pwd)
+&& $(pwd) then /usr/bin 'quoted text' "$@" x=1
+cd cd $(pwd) test export --verbose done "$@" test && sed
+	"$@" cd export ${HOME} printf
+		echo /usr/bin "$1" sed
+	$(pwd) x=1 local export
+2>/dev/null -eu | test 2>/dev/null awk grep cd "$@"
+	cd test && -eu x=1 -eu echo x=1 "$1" "$1" printf 'quoted text'
+		local --verbose --verbose ${HOME} x=1 'quoted text' --verbose
+		&& cd echo test export cd --verbose x=1 'quoted text'
+	export then | readonly ${HOME}
+	"$1" test ${HOME} ${HOME} test | awk readonly export 'quoted text' | "$@"
+	sed local ${HOME} readonly /usr/bin grep local "$1" x=1
+$(pwd) | done ${HOME} 2>/dev/null
+grep -eu test "$1" test local test printf
+	grep --verbose printf $(pwd) grep
+		$(pwd) "$1" done | -eu echo x=1 awk "$1" "$@" echo export && -eu 2>/dev/null
+		${HOME} awk awk cd $(pwd) && -eu cd then test --verbose "$@"
+		/usr/bin printf "$@" x=1 sed x=1 "$1" "$@" cd local && /usr/bin 2>/dev/null
+"$@" $(pwd) | | printf ${HOME} "$1" --verbose done then export &&
+		${HOME} 'quoted text' $(pwd) --verbose && sed $(pwd)
+		echo printf local done && x=1 test $(pwd) export awk printf $(pwd)
+		"$@" local --verbose | -eu echo "$1" done --verbose /usr/bin
+	grep "$1" grep ${HOME} sed --verbose --verbose export ${HOME} test cd "$@"
+--verbose x=1 $(pwd) -eu $(pwd) && export test export && && sed awk sed $(pwd)
+&& /usr/bin printf then --verbose done grep grep then /usr/bin 'quoted text' 2>/dev/null
+2>/dev/null 'quoted text' awk cd local awk && export
+	done cd /usr/bin printf test /usr/bin 'quoted text' cd "$1" | x=1 "$1" cd |
+&& "$1" "$@" awk readonly 2>/dev/null printf
+		sed 2>/dev/null -eu --verbose && done 'quoted text' test cd
+	--verbose -eu test --verbose
+	then | readonly readonly /usr/bin -eu echo --verbose ${HOME}
+		"$@" 2>/dev/null $(pwd) x=1 grep
+		${HOME} sed cd && 2>/dev/null --verbose awk 2>/dev/null test readonly
+	grep grep "$1" readonly /usr/bin 2>/dev/null | 'quoted text' awk
+		$(pwd) "$1" "$@" done grep ${HOME}
+		${HOME} x=1 $(pwd) ${HOME} printf
+export | export grep x=1 | 'quoted text'
+sed && && x=1 --verbose --verbose --verbose
+		export readonly awk printf echo 'quoted text' done 2>/dev/null
+export 2>/dev/null awk awk 2>/dev/null
+$(pwd) && "$@" ${HOME} 2>/dev/null readonly |
+		cd test printf local 2>/dev/null "$1" "$@"
+		printf done test /usr/bin printf 2>/dev/null /usr/bin 2>/dev/null --verbose
+local "$1" local "$1" local
+x=1 2>/dev/null $(pwd) sed 'quoted text'
+	"$1" awk test "$1" $(pwd) export ${HOME} /usr/bin 2>/dev/null 'quoted text' local
+	echo -eu awk export echo awk --verbose /usr/bin -eu --verbose done
+		'quoted text' readonly then local then echo ${HOME} cd awk awk
+		&& "$@" grep "$@" export | awk "$@" local then ${HOME}
+'quoted text' -eu && && sed && | awk cd "$@" printf "$1" && ${HOME} -eu
+		export x=1 test | /usr/bin then | --verbose 2>/dev/null test then
+	test && awk -eu echo "$1" "$1" && local echo done local | sed readonly cd 2>/dev/null
+then printf "$@" printf ${HOME} /usr/bin $(pwd) test grep echo echo 'quoted text'
+		local $(pwd) test done done
+"$@" export then $(pwd) x=1 local grep x=1 x=1 export grep grep echo
+grep then | printf && -eu /usr/bin
+	x=1 $(pwd) --verbose --verbose done
+	&& "$@" sed && $(pwd) sed awk -eu ${HOME} readonly -eu --verbose && "$1" x=1
+--verbose x=1 -eu 2>/dev/null local -eu "$1" --verbose -eu --verbose
+	x=1 readonly --verbose &&
+	cd --verbose printf 2>/dev/null --verbose | --verbose -eu export readonly
+		echo 2>/dev/null printf done 'quoted text' "$1"
+	x=1 echo test --verbose ${HOME} awk printf 'quoted text'
+	export /usr/bin sed | ${HOME} done sed sed 'quoted text'
+	--verbose awk export ${HOME}
+	${HOME} -eu readonly local -eu | 'quoted text' done then then done -eu
+	/usr/bin | && sed export 2>/dev/null --verbose done -eu --verbose
+	then then /usr/bin -eu 2>/dev/null
+		--verbose x=1 ${HOME} echo cd --verbose 'quoted text' -eu -eu cd echo
+	"$@" | grep cd grep test echo $(pwd) "$1" test cd done printf echo local /usr/bin
+echo 2>/dev/null test then printf printf
+	-eu sed -eu && $(pwd) grep then ${HOME}
+		2>/dev/null then export printf "$@"
+		then 2>/dev/null | done cd cd echo 2>/dev/null $(pwd) test "$@"
+done cd export local printf 2>/dev/null sed awk -eu readonly echo /usr/bin
+	x=1 && && --verbose "$1" echo readonly local "$@" ${HOME} $(pwd) export
+printf && "$@" -eu echo echo | then printf ${HOME} test | $(pwd)
+&& sed export test local echo cd
+	done 'quoted text' readonly -eu | awk echo ${HOME} &&
+	-eu cd x=1 cd local /usr/bin printf awk done printf /usr/bin readonly
+		echo local sed then readonly 'quoted text'
+	done && "$1" cd printf && sed $(pwd) 2>/dev/null cd printf cd sed
+"$1" $(pwd) cd | echo sed done $(pwd)
+		local cd readonly then "$1" -eu printf "$@" readonly grep sed done --verbose
+	"$1" grep $(pwd) ${HOME} awk && done done --verbose 2>/dev/null readonly
+		then "$@" done x=1 test 2>/dev/null
+		echo test | echo | --verbose
+	/usr/bin $(pwd) /usr/bin
+		test && $(pwd) "$1" ${HOME} x=1 --verbose done local --verbose 2>/dev/null
+	local sed grep grep echo readonly test then -eu printf
+	${HOME} local $(pwd) 'quoted text' then x=1
+		test cd $(pwd) --verbose $(pwd) then grep
+		local ${HOME} cd $(pwd)
+		awk echo done cd test awk then readonly --verbose "$1" done
+	export sed grep $(pwd) "$1" test -eu grep -eu then export
+		printf echo /usr/bin then cd readonly cd /usr/bin
+	printf -eu printf test --verbose
+--verbose && x=1 local done | grep done awk awk export sed
+	"$1" $(pwd) readonly readonly export printf
+awk --verbose then then 'quoted text' then /usr/bin "$@" then $(pwd) 2>/dev/null
+		test --verbose then test printf "$@" -eu ${HOME} $(pwd) 'quoted text'
+&& "$@" ${HOME} && printf 'quoted text' x=1 "$1" printf sed -eu readonly export
+	x=1 cd local "$@" -eu | then
+2>/dev/null test readonly then readonly done grep cd then $(pwd) |
+	grep local local sed printf test /usr/bin
+		| $(pwd) && /usr/bin ${HOME} cd /usr/bin test "$1"
+		done grep local grep 'quoted text' grep printf /usr/bin "$1" export
+	done | cd local $(pwd) then 2>/dev/null --verbose
+		${HOME} 'quoted text'
+awk -eu test "$@" printf /usr/bin
+	export sed grep sed cd 'quoted text' $(pwd) && cd done ${HOME}
+	echo && readonly | readonly --verbose readonly
+	grep | ${HOME} x=1 cd readonly /usr/bin /usr/bin
+2>/dev/null readonly && ${HOME} awk sed test "$1" "$1" ${HOME} $(pwd)
+		--verbose 'quoted text' done 'quoted text' sed readonly sed 'quoted text' --verbose
+		readonly done "$1" && local ${HOME} done x=1 done 2>/dev/null /usr/bin /usr/bin
+		readonly echo sed 2>/dev/null printf "$1" then 'quoted text' export printf
+		sed 2>/dev/null test 'quoted text'
+export -eu "$1" echo
+	${HOME} /usr/bin echo done sed awk
+cd $(pwd) grep done readonly readonly | "$@" done "$@" | 'quoted text' | echo ${HOME}
+${HOME} then | then -eu 2>/dev/null "$1" 'quoted text'
+	cd 'quoted text' then "$1" --verbose --verbose awk 2>/dev/null then /usr/bin
+${HOME} "$1" 'quoted text' 'quoted text'
+		awk 2>/dev/null sed export
+	echo then cd test $(pwd) "$1" 'quoted text'
+		x=1 $(pwd) ${HOME} "$@" "$@" printf export --verbose done
+	printf ${HOME} cd 'quoted text' | echo readonly "$1" echo echo
+	cd /usr/bin --verbose echo /usr/bin | 2>/dev/null export | sed sed 2>/dev/null printf
+	-eu then | test grep then
+		$(pwd) ${HOME} local grep grep
+grep "$1" grep ${HOME} | x=1 export readonly sed -eu ${HOME} x=1
+		test test 'quoted text' grep
+cd --verbose 'quoted text' "$@" then -eu readonly && awk /usr/bin cd $(pwd) -eu
+	readonly awk printf -eu export 'quoted text' local readonly -eu | "$1"
+	awk sed local "$1" test printf && readonly awk 'quoted text'
+	&& then 2>/dev/null test local then grep readonly local
+2>/dev/null --verbose 2>/dev/null test test | $(pwd) "$1" && sed readonly
+then 2>/dev/null done export && echo && && awk test sed "$@" then sed
+'quoted text' ${HOME} --verbose /usr/bin printf then && x=1
+	'quoted text' grep "$1" then ${HOME} grep printf local /usr/bin then
+	/usr/bin $(pwd) 'quoted text' | $(pwd) 'quoted text'
+	sed x=1 && echo "$@" grep 2>/dev/null && "$1" 'quoted text' echo export
+		"$@" -eu cd 'quoted text' export export grep export "$@" then ${HOME} echo
+		printf "$1" awk x=1 "$@" 2>/dev/null
+	-eu export cd readonly done -eu "$@" /usr/bin
+		&& ${HOME} awk local x=1 --verbose --verbose echo
+		x=1 test $(pwd) done $(pwd) && awk ${HOME} printf /usr/bin /usr/bin
+	"$@" x=1 | echo then readonly local $(pwd) /usr/bin
+		done printf "$@" echo cd grep && 2>/dev/null && grep "$1" export awk --verbose
+echo /usr/bin "$@" awk | cd 2>/dev/null "$1" "$1" echo
+		${HOME} local cd grep sed ${HOME} grep /usr/bin
+	2>/dev/null echo grep && $(pwd) done "$@" echo readonly 'quoted text'
+		2>/dev/null && && "$1" 'quoted text' then
+		--verbose -eu cd readonly -eu export $(pwd) | then | test
+x=1 export && | export ${HOME} echo export printf
+printf "$1" cd done $(pwd) then cd sed printf
+	export readonly "$@" 'quoted text' ${HOME}
+	x=1 x=1 cd --verbose awk 'quoted text' local cd readonly
+		"$1" /usr/bin --verbose grep readonly export | /usr/bin export "$@" echo
+		| sed echo ${HOME} echo
+		x=1 test export | x=1 "$@" | | awk 'quoted text' printf "$1" "$1" export
+$(pwd) && $(pwd) 2>/dev/null readonly --verbose
+	done done local awk 'quoted text'
+	&& /usr/bin | "$1" ${HOME} x=1 printf readonly ${HOME} x=1 sed ${HOME} --verbose
+test "$1" /usr/bin awk sed | grep "$@" &&
+'quoted text' cd 2>/dev/null export printf | export "$1" grep "$@" 'quoted text'
+		x=1 && awk export 2>/dev/null && | --verbose
+		'quoted text' | echo | ${HOME} awk done printf
+		&& | "$@" done test "$@" "$1" awk ${HOME} echo sed
+	2>/dev/null x=1 sed 'quoted text' "$1" echo echo cd local ${HOME} export done --verbose
+		2>/dev/null awk echo test local echo done x=1 done export ${HOME} export -eu -eu
+		then x=1 cd && readonly done
+		then then x=1 -eu sed sed export echo $(pwd) test local "$1"
+printf $(pwd) $(pwd) local cd printf readonly test $(pwd) echo && $(pwd) 'quoted text'
+	then echo ${HOME} "$@" ${HOME} awk
+	cd -eu sed | --verbose -eu export export
+	done test then cd export /usr/bin -eu -eu --verbose
+		${HOME} /usr/bin "$@" $(pwd) readonly readonly
+		export sed "$1" $(pwd) | readonly export local "$@" echo echo export done done
+		&& ${HOME} --verbose "$1" printf --verbose | x=1 export test x=1
+	"$@" then grep 'quoted text' "$1" readonly test then printf readonly
+"$@" echo 'quoted text' /usr/bin export $(pwd) echo $(pwd) -eu
+	cd test echo cd local done cd x=1 export sed
+		--verbose cd sed done sed cd printf sed then
+		test "$@" && then local "$@" done test /usr/bin done printf
+--verbose "$1" grep | done $(pwd) --verbose echo 2>/dev/null
+		x=1 2>/dev/null $(pwd) "$1" ${HOME} printf
+		x=1 /usr/bin cd test echo | "$1"
+$(pwd) cd -eu sed awk | && "$@" grep &&
+	'quoted text' 2>/dev/null /usr/bin cd awk -eu $(pwd) then |
+	cd printf awk -eu then echo sed --verbose echo then echo export
+	grep local done test -eu -eu echo local --verbose test $(pwd)
+		grep 'quoted text' sed 2>/dev/null done grep printf readonly |
+		"$@" "$@" done && 2>/dev/null && ${HOME} then
+	echo then 'quoted text' local
+		"$1" /usr/bin echo ${HOME} printf $(pwd) x=1 && | ${HOME} sed
+	test test done /usr/bin local "$1" x=1 echo test "$1" -eu printf 'quoted text'
+		"$1" 2>/dev/null | echo grep x=1 "$1" --verbose -eu printf test --verbose
+	2>/dev/null | x=1 -eu grep export "$@" x=1 $(pwd) cd grep -eu export printf
+	printf | echo cd echo echo && $(pwd)
+		done readonly x=1 echo ${HOME} echo done cd -eu -eu sed "$@" && then && local
+	cd && -eu "$@" 'quoted text' | local grep /usr/bin /usr/bin && echo sed &&
+"$1" sed 'quoted text' "$1" test then printf readonly sed awk
+		echo awk && readonly "$1"
+/usr/bin && 'quoted text'
+	--verbose "$1" | grep "$1" "$@" readonly "$1" x=1 export export
+	then awk $(pwd) x=1 "$@" 'quoted text'
+	export 2>/dev/null grep x=1 $(pwd) sed awk /usr/bin done export /usr/bin
+		/usr/bin 'quoted text' local --verbose printf grep "$@" echo local 2>/dev/null
+x=1 export readonly echo $(pwd) printf /usr/bin /usr/bin 'quoted text' sed
+		-eu "$@" export printf /usr/bin local && -eu grep
+	cd test export "$1" /usr/bin
+	echo /usr/bin ${HOME} -eu grep local export | local && done $(pwd)
+awk "$@" 2>/dev/null local done ${HOME} cd $(pwd) -eu 'quoted text'
+	test 2>/dev/null awk readonly test x=1 local
+		export sed export grep && --verbose echo
+		"$@" -eu export local echo ${HOME}
+--verbose 2>/dev/null -eu | echo echo then echo printf done cd cd test local
+		| "$1" -eu ${HOME} $(pwd) test "$@" grep
+		done ${HOME} | local grep | cd cd readonly echo --verbose --verbose local
+	--verbose test && export -eu awk test
+2>/dev/null grep && test "$1" "$@" readonly
+		/usr/bin then awk grep printf && local $(pwd) ${HOME} x=1 cd test ${HOME}
+		awk x=1 $(pwd) echo 'quoted text' readonly x=1 | cd awk grep && && printf /usr/bin
+	$(pwd) local echo ${HOME} local --verbose echo export grep $(pwd)
+done echo -eu printf ${HOME} --verbose awk done 2>/dev/null printf --verbose
+	printf sed x=1 awk awk 2>/dev/null x=1 ${HOME} "$1" echo 'quoted text'
+/usr/bin awk ${HOME} -eu local awk test readonly "$1"
+printf export grep "$@"
+		test awk test $(pwd) done echo 2>/dev/null 'quoted text' /usr/bin cd grep --verbose
+-eu done done | local ${HOME}
+		echo -eu --verbose "$@" local local done $(pwd) export $(pwd)
+		&& x=1 | ${HOME} $(pwd) -eu | cd $(pwd) "$1" grep echo readonly
+		sed 'quoted text' printf && && then /usr/bin sed 2>/dev/null
+		2>/dev/null | --verbose -eu "$@" -eu done && /usr/bin
+	&& awk local /usr/bin echo done
+		2>/dev/null grep && grep | && $(pwd)
+	echo cd export test test done "$1" /usr/bin echo sed /usr/bin awk | test export
+'quoted text' x=1 printf x=1 echo "$@" export grep x=1 "$@" grep "$@"
+	cd sed x=1 | x=1 | grep sed sed -eu readonly
+${HOME} | && export "$@" | grep
+	&& -eu /usr/bin /usr/bin done test
+| printf | 2>/dev/null x=1 readonly cd printf 'quoted text'
+-eu awk test $(pwd) grep 2>/dev/null done cd cd grep export
+	test sed 2>/dev/null -eu cd sed readonly -eu export test
+		| echo cd grep ${HOME} && printf cd ${HOME} 'quoted text' | readonly
+		test "$@" awk echo grep echo readonly printf
+	"$@" test export cd "$@" -eu 'quoted text' then readonly "$@" done
+		&& && test x=1 local awk $(pwd)
+readonly test | x=1 local sed then x=1 printf ${HOME} export --verbose
+sed 2>/dev/null "$1" readonly then "$1" && echo sed done
+2>/dev/null /usr/bin then /usr/bin | awk "$@" export "$@"
+x=1 printf "$@" --verbose cd $(pwd)
+	'quoted text' local printf ${HOME} printf grep "$1" echo grep readonly grep
+		| done grep 'quoted text' ${HOME} readonly
+		done echo readonly 2>/dev/null "$1" grep readonly export sed test x=1
+	&& ${HOME} test "$1" /usr/bin --verbose
+export cd awk echo local -eu done && echo done --verbose "$1" 2>/dev/null
+		--verbose done "$1" done test
+2>/dev/null x=1 'quoted text' /usr/bin readonly --verbose /usr/bin /usr/bin
+| readonly grep grep "$1" grep
+	printf | --verbose printf then sed 2>/dev/null
+	printf && --verbose then
+		"$1" 'quoted text' done then test --verbose grep $(pwd) local local $(pwd) done
+	"$@" printf done && cd grep export readonly
+		sed -eu then local ${HOME} echo cd "$1" "$@" x=1 -eu export
+awk && 'quoted text' sed done && export ${HOME}
+		readonly echo && printf test cd local
+	&& sed sed done --verbose $(pwd) echo echo grep grep printf
+-eu local -eu printf | x=1 "$1" export 2>/dev/null /usr/bin
+cd then cd readonly "$1" x=1 test x=1 local
+	awk grep "$1" awk 2>/dev/null sed done cd 'quoted text'
+	then x=1 local test | --verbose | done "$@" export echo grep x=1 x=1 -eu awk
+	&& /usr/bin -eu awk x=1 readonly
+	/usr/bin local sed 'quoted text'
+printf 'quoted text' $(pwd) $(pwd) readonly x=1 $(pwd) grep then ${HOME} ${HOME}
+	awk $(pwd) done done "$@" echo $(pwd) export ${HOME} --verbose
+grep 2>/dev/null sed then ${HOME} "$@" -eu |
+local ${HOME} $(pwd) $(pwd) awk sed x=1 awk --verbose
+		"$1" printf export "$@" done sed -eu then printf
+	"$@" echo awk | echo echo /usr/bin readonly
+	x=1 test done ${HOME} -eu && /usr/bin then ${HOME} 'quoted text' | 2>/dev/null
+sed export | x=1 $(pwd) 'quoted text' test readonly
+		readonly export 'quoted text'
+		local cd echo printf sed && && "$1" export 2>/dev/null done printf 'quoted text'
+readonly grep $(pwd) test $(pwd) "$@" sed --verbose cd grep
+readonly "$@" && sed done export sed sed && awk grep echo 2>/dev/null $(pwd) test
+	grep then "$@" 2>/dev/null grep awk "$1" && $(pwd) x=1 --verbose
+	printf --verbose grep && "$1" --verbose
+	test grep "$@" local -eu then /usr/bin && "$1"
+	cd /usr/bin awk "$@" | readonly
+		export 2>/dev/null cd done && 2>/dev/null test awk printf 'quoted text'
+then && cd | "$1" -eu /usr/bin readonly "$@" "$1" done $(pwd) x=1
+	x=1 $(pwd) | echo test ${HOME} "$@" 'quoted text'
+cd echo -eu test --verbose 'quoted text' -eu x=1 readonly
+	-eu x=1 echo test grep echo export "$1" x=1 x=1 -eu "$@" cd
+	-eu ${HOME} sed export sed "$@" test -eu 2>/dev/null echo ${HOME}
+| readonly readonly grep done awk --verbose
+local echo then test
+		export sed "$@" x=1 grep |
+		${HOME} "$@" then x=1 local then cd test grep
+test "$1" printf x=1 then echo $(pwd) x=1 | export printf cd echo grep
+	readonly x=1 "$@" grep printf
+		--verbose /usr/bin then export --verbose
+	x=1 $(pwd) cd printf 'quoted text' echo --verbose 2>/dev/null
@@ -0,0 +1,2001 @@
+	$(pwd) "$1" awk test /usr/bin then --verbose --verbose local awk "$1" /usr/bin
+	awk /usr/bin "$@" x=1 echo ${HOME} | ${HOME} then $(pwd) then echo export 'quoted text'
+	echo 'quoted text' printf
+cd grep x=1 "$@" "$1" test -eu $(pwd) grep --verbose then local echo local
+		/usr/bin x=1 awk -eu cd "$@" printf grep 'quoted text' done 'quoted text'
+	echo | then 'quoted text' cd -eu "$1" test
+		x=1 x=1 printf "$@" grep x=1 x=1
+		grep export export 'quoted text' "$@" x=1 && echo readonly |
+		${HOME} --verbose "$@" done readonly ${HOME} readonly $(pwd) &&
+		x=1 'quoted text' $(pwd) readonly
+'quoted text' readonly x=1 local $(pwd) cd done
+&& "$1" awk 2>/dev/null && grep
+'quoted text' $(pwd) 'quoted text' "$1" 2>/dev/null test --verbose done
+		printf awk x=1 done x=1 | sed "$1"
+	"$@" "$1" printf $(pwd) awk local && 2>/dev/null ${HOME} x=1 x=1 readonly
+done then cd readonly x=1 echo local cd
+		grep readonly /usr/bin sed export | then /usr/bin readonly
+	--verbose done echo $(pwd) -eu echo then 'quoted text'
+		awk "$@" readonly echo sed ${HOME} printf cd printf ${HOME} "$@" then readonly cd
+		| $(pwd) "$1" local 'quoted text'
+| awk sed then echo --verbose x=1
+	$(pwd) sed awk export echo local readonly
+	2>/dev/null local $(pwd) "$1" sed && test 2>/dev/null export $(pwd)
+| export awk awk && /usr/bin --verbose then /usr/bin
+		export then $(pwd) /usr/bin
+	sed awk "$1" sed && then "$@" ${HOME}
+		printf export echo cd test "$@" then "$@" local printf && && ${HOME}
+		local printf -eu echo 'quoted text' grep 2>/dev/null then -eu test test done sed
+	local 'quoted text' local | | /usr/bin
+$(pwd) local grep 2>/dev/null
+/usr/bin readonly --verbose | echo 2>/dev/null done
+		/usr/bin "$1" grep $(pwd) 'quoted text'
+	cd && grep | "$@" printf "$1" test
+		cd grep printf -eu local 'quoted text' 2>/dev/null grep local $(pwd)
+	${HOME} $(pwd) then 'quoted text' cd "$@" echo /usr/bin then --verbose
+	2>/dev/null awk readonly
+		printf "$1" -eu /usr/bin "$@" then --verbose
+$(pwd) echo && local "$@"
+		/usr/bin grep awk cd then && --verbose
+	grep /usr/bin echo 'quoted text' 'quoted text'
+	done then $(pwd) --verbose && "$@" && printf /usr/bin export cd echo /usr/bin
+	cd echo --verbose ${HOME} -eu readonly 2>/dev/null
+		"$@" cd readonly "$@" -eu 'quoted text' x=1 then "$1"
+	'quoted text' cd test -eu /usr/bin && /usr/bin "$1" 'quoted text'
+grep "$@" test sed cd "$@" cd x=1
+	cd --verbose awk readonly printf "$@" $(pwd) cd ${HOME} | -eu --verbose 'quoted text'
+awk readonly | test ${HOME} ${HOME} done | | test $(pwd) export test x=1
+		&& $(pwd) && echo grep ${HOME} echo then
+		-eu sed grep done && "$@" && local
+		2>/dev/null ${HOME} readonly then local sed $(pwd) | awk export 'quoted text' sed
+"$@" grep readonly cd $(pwd) /usr/bin -eu grep cd 2>/dev/null sed printf readonly
+	${HOME} 'quoted text' ${HOME} then echo sed echo --verbose export printf
+		x=1 done "$@" grep -eu $(pwd) && printf --verbose readonly then
+	done && awk done readonly $(pwd) awk grep "$@" cd local echo 'quoted text' 2>/dev/null
+		printf printf "$1" "$1" --verbose
+	cd && -eu /usr/bin 2>/dev/null --verbose printf --verbose
+	awk readonly "$1" cd && && test 'quoted text' "$@" --verbose 'quoted text'
+		/usr/bin awk grep "$1" cd 'quoted text'
+		/usr/bin test cd readonly | cd --verbose echo ${HOME} done
+-eu && cd "$@" grep "$1" "$@" cd done readonly echo /usr/bin test
+awk 2>/dev/null grep echo done $(pwd) done printf grep printf &&
+	${HOME} grep && $(pwd) readonly | 'quoted text' "$@" awk $(pwd) | sed echo
+/usr/bin local | printf 2>/dev/null
+	readonly x=1 done printf readonly cd then /usr/bin readonly printf
+done "$@" export printf sed -eu cd "$1"
+		-eu grep awk $(pwd) sed local cd /usr/bin /usr/bin
+sed --verbose $(pwd) 2>/dev/null ${HOME} -eu echo grep 'quoted text'
+		readonly | echo then grep /usr/bin "$@" printf awk local | 'quoted text' &&
+	grep /usr/bin 'quoted text' | local then -eu &&
+echo "$@" test "$@" $(pwd) readonly
+		sed && done local --verbose cd && grep -eu --verbose then local
+	export 'quoted text' awk sed done export | echo printf 2>/dev/null
+		readonly 2>/dev/null echo done -eu done sed test | cd awk x=1 printf awk ${HOME}
+		"$1" test sed -eu cd "$@" awk local -eu -eu echo "$@" grep
+done export "$@" --verbose "$@" grep -eu done x=1 "$@" cd -eu printf
+		cd sed x=1 2>/dev/null "$@" readonly grep readonly test test
+	test grep $(pwd) x=1 $(pwd) /usr/bin "$@"
+		${HOME} echo ${HOME} 'quoted text' test then local "$1"
+	echo && $(pwd) echo 'quoted text' $(pwd) && /usr/bin readonly 2>/dev/null
+	local | test ${HOME} grep printf | awk readonly test test cd local sed 2>/dev/null
+		'quoted text' test awk ${HOME}
+		echo | 'quoted text' && ${HOME} 2>/dev/null test awk local then
+	printf echo local "$@" x=1 && echo printf
+$(pwd) --verbose 2>/dev/null
+	'quoted text' echo sed then awk cd local --verbose awk 'quoted text'
+2>/dev/null local 'quoted text' | 'quoted text' "$1" /usr/bin grep then done
+	then /usr/bin -eu 'quoted text' "$1" awk sed "$@" echo x=1 grep -eu then
+		echo done echo 2>/dev/null 'quoted text' readonly 'quoted text' test -eu ${HOME}
+/usr/bin echo grep -eu 'quoted text' sed then "$@"
+	"$1" /usr/bin echo printf 'quoted text' /usr/bin
+x=1 local cd x=1 then 'quoted text' 'quoted text' "$@" grep "$@"
+		export && echo then && printf $(pwd) -eu && 2>/dev/null test x=1 && && readonly
+		-eu test local 2>/dev/null "$@" 2>/dev/null
+2>/dev/null --verbose sed echo awk sed readonly &&
+--verbose "$1" --verbose x=1 ${HOME} test grep $(pwd) -eu 'quoted text' printf
+	grep readonly awk local && done echo printf grep test echo --verbose
+$(pwd) && test test --verbose local "$1" local grep readonly && readonly
+2>/dev/null | printf grep readonly "$@" sed cd ${HOME}
+		2>/dev/null --verbose readonly test
+	export echo sed "$1" 'quoted text' "$@" x=1 export export x=1 "$@" x=1 printf
+		awk grep local --verbose x=1 --verbose done local | 2>/dev/null printf && grep
+		$(pwd) ${HOME} "$1" --verbose -eu test
+	'quoted text' --verbose local --verbose
+then grep done done awk && "$1" export
+	| echo grep ${HOME} 2>/dev/null "$@" grep then local awk | ${HOME} local $(pwd)
+echo awk readonly "$@" && awk && 2>/dev/null "$1"
+sed test cd local cd echo
+${HOME} local "$@" x=1 readonly 2>/dev/null ${HOME} "$1" local ${HOME}
+done test "$1" printf
+	2>/dev/null printf ${HOME} readonly
+sed cd test export printf test "$1" | --verbose readonly x=1 done awk
+local --verbose sed sed awk cd ${HOME} echo grep --verbose sed awk cd
+test -eu "$1" 'quoted text' $(pwd) "$1" then "$@" "$@" then
+local local echo sed /usr/bin readonly awk
+2>/dev/null x=1 x=1 local -eu readonly 'quoted text' local test x=1 "$@"
+		'quoted text' awk "$@" "$@" grep sed | 2>/dev/null
+		| test readonly sed cd $(pwd) x=1 cd echo "$1" printf then grep 'quoted text'
+	| "$@" --verbose && awk
+--verbose sed --verbose done local readonly
+		grep printf ${HOME} cd
+	x=1 export $(pwd) -eu local export --verbose "$@" local
+		"$@" done $(pwd) grep /usr/bin done "$1" printf
+		/usr/bin awk done readonly && "$@" readonly local --verbose export "$1" -eu $(pwd)
+cd local grep 'quoted text' ${HOME} ${HOME}
+2>/dev/null -eu awk readonly x=1 done cd "$@"
+	/usr/bin x=1 --verbose done $(pwd) then "$@" "$1"
+${HOME} local && done echo echo /usr/bin grep readonly awk readonly
+| echo local then export -eu | "$@" done
+		then echo | echo test --verbose done sed x=1 2>/dev/null
+"$@" | local export printf x=1 printf &&
+		test then grep then printf grep /usr/bin cd awk x=1 --verbose
+printf readonly echo | "$@" && | x=1 export && cd && echo
+		done 'quoted text' sed --verbose --verbose
+		awk printf then test 'quoted text' local
+		echo && export local "$1" local -eu echo
+		&& test export ${HOME} export printf ${HOME} -eu "$@" "$@" /usr/bin
+printf "$@" 'quoted text' $(pwd) then readonly "$@" printf
+		awk done 2>/dev/null 'quoted text' grep 2>/dev/null "$@" done "$1" done
+--verbose sed printf done && done grep 'quoted text'
+		${HOME} grep && && -eu echo x=1 ${HOME} && local awk echo printf --verbose export
+	grep echo "$1" | x=1 export /usr/bin local -eu ${HOME} cd test 'quoted text'
+	${HOME} local done then | printf --verbose printf 2>/dev/null
+&& local done grep 2>/dev/null grep done "$1" readonly awk x=1 test
+sed x=1 /usr/bin /usr/bin
+| awk sed /usr/bin test
+	export local sed $(pwd) grep && ${HOME} "$1" test 2>/dev/null
+'quoted text' | readonly printf printf /usr/bin "$1" x=1 done "$1"
+		export then | local test | "$@" grep local echo x=1 2>/dev/null /usr/bin
+	--verbose sed $(pwd) -eu | x=1 ${HOME} "$1" && done /usr/bin grep
+	readonly 2>/dev/null sed "$1" ${HOME} | && | then | sed sed printf readonly
+	cd awk 2>/dev/null x=1 then readonly then grep awk x=1 sed readonly awk ${HOME}
+		--verbose export "$@" $(pwd) $(pwd) "$1" "$1" test -eu /usr/bin 'quoted text' |
+	test $(pwd) | export | then echo && "$1" then /usr/bin
+		readonly 2>/dev/null 'quoted text' x=1 printf "$1" && | echo grep
+		printf 2>/dev/null done done 2>/dev/null $(pwd) readonly
+cd sed readonly done sed test /usr/bin "$1" done awk ${HOME} test
+	done "$@" readonly cd /usr/bin
+	readonly done printf ${HOME} ${HOME} local $(pwd) echo local "$1" echo
+		2>/dev/null printf && done local awk local 2>/dev/null
+	awk grep --verbose $(pwd) then | echo grep test $(pwd) echo
+done printf x=1 readonly sed --verbose
+		sed echo 'quoted text' /usr/bin /usr/bin readonly test
+	-eu "$1" awk done "$@" printf done $(pwd) grep "$@" echo | test
+		export 2>/dev/null 2>/dev/null /usr/bin cd
+	x=1 | cd awk /usr/bin 'quoted text' cd then readonly sed done test echo local
+&& cd && 'quoted text' 2>/dev/null test --verbose export --verbose echo 'quoted text'
+	then "$1" readonly local done then awk -eu grep
+test --verbose done awk echo sed "$@" export 2>/dev/null export && 'quoted text'
+		2>/dev/null -eu grep 'quoted text' 'quoted text' --verbose ${HOME} && printf cd
+--verbose echo awk readonly && x=1 done "$1" test awk echo /usr/bin then
+		cd | test test x=1 "$@" | done test
+		'quoted text' ${HOME}
+then 2>/dev/null export sed 'quoted text' $(pwd) test
+	export sed grep awk printf $(pwd) done x=1 awk && -eu grep $(pwd) 'quoted text'
+		/usr/bin x=1 | local then ${HOME} grep then 'quoted text'
+	then printf "$@" /usr/bin awk done x=1 printf 2>/dev/null
+	/usr/bin echo 'quoted text' done --verbose
+	local ${HOME} done -eu "$1" && printf
+		then cd "$@" -eu 2>/dev/null awk test awk export /usr/bin cd export grep ${HOME}
+		echo x=1 2>/dev/null --verbose readonly x=1 --verbose
+		x=1 done "$@" && printf local cd x=1 'quoted text'
+grep export printf x=1 | awk sed | printf x=1 x=1 printf
+	${HOME} export -eu done 2>/dev/null awk && echo
+"$@" printf "$1" export awk | export done test "$1" readonly
+		-eu local "$@" local 2>/dev/null
+		--verbose grep then echo
+		--verbose -eu local grep test done
+	"$1" | echo && x=1 /usr/bin test
+'quoted text' x=1 readonly 'quoted text' awk ${HOME} export sed
+		"$@" 'quoted text' --verbose cd echo done sed echo export /usr/bin
+${HOME} && -eu | 2>/dev/null local export && 2>/dev/null
+export awk ${HOME} awk sed /usr/bin
+	| x=1 readonly local 'quoted text' printf x=1 export -eu
+sed && /usr/bin test sed 'quoted text' test done then echo "$@" readonly
+	awk /usr/bin then 2>/dev/null
+$(pwd) then && -eu 2>/dev/null $(pwd) ${HOME} then
+		--verbose "$1" 'quoted text' grep && readonly | /usr/bin export then cd 'quoted text'
+"$@" test then ${HOME} cd readonly export && "$1" | $(pwd)
+	local && x=1 awk done grep /usr/bin echo
+		&& awk --verbose printf test | readonly awk --verbose 2>/dev/null /usr/bin
+	x=1 $(pwd) grep grep test -eu 2>/dev/null --verbose cd /usr/bin
+x=1 awk then awk cd 2>/dev/null $(pwd) then
+		$(pwd) && "$1" export local
+sed awk "$1" -eu -eu
+	-eu done && done echo
+	$(pwd) -eu && "$1" done "$@" "$1" 2>/dev/null sed &&
+	--verbose echo local export then 2>/dev/null grep test echo
+		2>/dev/null --verbose export awk then "$1" -eu cd $(pwd) readonly | test cd
+		export /usr/bin readonly
+readonly && /usr/bin x=1 readonly ${HOME} export export $(pwd) echo
+		'quoted text' sed 'quoted text'
+		${HOME} then 'quoted text' echo readonly sed
+	export x=1 awk 'quoted text' local sed then local done
+	cd ${HOME} awk && test && cd grep cd --verbose
+cd then 2>/dev/null then 'quoted text'
+	echo ${HOME} | x=1 "$@" done then 2>/dev/null --verbose then test test
+		2>/dev/null then | export grep printf readonly --verbose done done cd
+		readonly grep test ${HOME} $(pwd) then /usr/bin
+	done 2>/dev/null echo local echo echo readonly 2>/dev/null
+&& echo cd cd 'quoted text' echo readonly
+		printf sed readonly local grep printf done
+		awk echo 2>/dev/null echo x=1 && then sed readonly local ${HOME} grep ${HOME}
+		done local 2>/dev/null | awk printf x=1 -eu cd local
+		"$@" "$@" -eu test | --verbose $(pwd) test readonly printf
+--verbose grep && "$1" export export test /usr/bin
+	then | cd local "$1" --verbose 2>/dev/null
+&& export /usr/bin export --verbose
+&& sed local test cd local export x=1 2>/dev/null ${HOME} 2>/dev/null "$1" "$@"
+		"$1" sed 'quoted text' then $(pwd) ${HOME} readonly grep | export
+		sed -eu ${HOME} --verbose x=1 -eu "$1" echo readonly cd done
+	awk printf grep /usr/bin local done cd awk echo &&
+		readonly sed /usr/bin grep ${HOME} grep ${HOME} 2>/dev/null 'quoted text' sed
+		awk awk "$@" cd 2>/dev/null
+	2>/dev/null 'quoted text' local sed x=1 echo
+	done echo ${HOME} sed ${HOME} export
+		cd "$1" done readonly x=1 ${HOME} x=1 2>/dev/null $(pwd) sed printf
+		then && $(pwd) done /usr/bin 2>/dev/null local x=1 echo grep done test
+		then /usr/bin then sed && && awk "$1" printf grep | awk cd printf done done grep
+--verbose local | done 'quoted text' 2>/dev/null echo
+	local 'quoted text' then 2>/dev/null "$@" local | "$1" then x=1 done export readonly
+		2>/dev/null x=1 test $(pwd) export $(pwd) ${HOME} x=1 export --verbose
+sed then done local cd grep then sed "$@" /usr/bin 2>/dev/null sed cd sed then
+	cd local ${HOME} ${HOME} /usr/bin sed -eu done export | readonly x=1 -eu
+	test x=1 x=1 printf /usr/bin --verbose grep 2>/dev/null
+		readonly readonly then awk ${HOME} "$1" --verbose local echo
+	echo --verbose test "$1" $(pwd) && -eu sed
+	2>/dev/null cd | $(pwd) done test
+export 2>/dev/null | readonly -eu local | --verbose 'quoted text' "$1"
+${HOME} -eu test | then printf local 2>/dev/null ${HOME} export "$1" --verbose
+		'quoted text' test printf export
+	then 'quoted text' "$1" export "$@" x=1 --verbose
+	cd done 'quoted text' export --verbose printf
+	cd ${HOME} readonly local export echo "$1" readonly
+		local export sed --verbose cd then /usr/bin 'quoted text'
+		x=1 sed cd 2>/dev/null "$1" x=1 export $(pwd) cd cd readonly "$@" grep 2>/dev/null
+		printf "$@" x=1 "$1" sed | ${HOME} "$1" ${HOME} /usr/bin
+&& "$1" "$@" "$1" printf x=1 'quoted text' test --verbose ${HOME} "$1" "$1" printf
+		then then x=1 && x=1 ${HOME}
+	readonly -eu "$1" && awk done readonly x=1 "$1" x=1 readonly then && | sed local
+		sed -eu /usr/bin 2>/dev/null then
+		x=1 then "$1" awk "$1" ${HOME}
+		export && sed cd then done awk done | cd
+		sed 'quoted text' ${HOME} export done awk 2>/dev/null echo /usr/bin
+	local ${HOME} /usr/bin && && test done /usr/bin sed readonly test /usr/bin local
+		grep cd 'quoted text' x=1 | $(pwd) x=1 --verbose | printf "$1" $(pwd) 2>/dev/null
+		echo awk then /usr/bin awk then $(pwd) $(pwd) test echo ${HOME}
+		'quoted text' export readonly "$1"
+	| "$1" -eu awk x=1 echo $(pwd) && done local 'quoted text' local 2>/dev/null
+	done local awk local sed "$1" "$1" awk grep readonly $(pwd)
+		export x=1 $(pwd) 'quoted text' grep -eu x=1 | "$1" test test 2>/dev/null
+| --verbose x=1 /usr/bin 2>/dev/null
+	then ${HOME} readonly test $(pwd) grep export readonly
+		test awk echo printf sed done "$@" readonly export --verbose then
+"$1" 2>/dev/null local ${HOME} "$@" 2>/dev/null
+x=1 export && test done 'quoted text' awk echo && then readonly export 2>/dev/null
+		'quoted text' done cd "$@"
+		printf sed $(pwd) local | echo x=1 awk 2>/dev/null
+		${HOME} awk 2>/dev/null
+		&& local ${HOME} readonly | "$@" awk sed "$1" "$@" 'quoted text' &&
+echo | test "$1" grep 'quoted text' --verbose
+		sed export readonly 2>/dev/null
+cd | done 'quoted text' echo local
+	'quoted text' sed printf "$1" -eu -eu && /usr/bin --verbose awk grep "$@" /usr/bin
+		test test -eu done then | --verbose && "$1" echo && x=1 /usr/bin readonly
+		x=1 /usr/bin export "$@" awk test
+		&& export cd | cd awk grep
+local local local test grep then sed printf printf 2>/dev/null
+	echo | --verbose /usr/bin sed echo 2>/dev/null
+then readonly cd --verbose grep local x=1 sed awk /usr/bin
+	grep done printf then | local | | echo "$@" awk grep x=1 grep
+		'quoted text' printf 2>/dev/null done $(pwd)
+		"$@" test -eu "$@" $(pwd) readonly readonly grep test cd --verbose export local
+	awk cd export -eu local && "$1" x=1 grep --verbose
+	$(pwd) echo "$@" x=1 'quoted text' /usr/bin &&
+	export && done x=1 ${HOME} cd
+		echo export ${HOME} && test 2>/dev/null /usr/bin | export printf /usr/bin -eu sed
+	$(pwd) done && $(pwd) -eu done 2>/dev/null test | /usr/bin && 'quoted text'
+$(pwd) 'quoted text' test "$@" echo sed echo /usr/bin
+	"$@" "$@" grep grep cd && 2>/dev/null 'quoted text'
+	/usr/bin 2>/dev/null &&
+	test | /usr/bin "$1" | /usr/bin && && x=1 echo local awk test printf local
+		"$@" awk printf && "$@" 'quoted text' "$@" printf
+	then 2>/dev/null ${HOME} 'quoted text' test "$1" then
+2>/dev/null cd "$1" sed grep
+${HOME} local then done printf x=1 cd 2>/dev/null cd "$1" /usr/bin -eu
+test 'quoted text' awk printf test sed
+sed local --verbose sed && printf grep && |
+	2>/dev/null export echo "$@" /usr/bin
+	${HOME} sed | $(pwd) ${HOME} readonly 2>/dev/null
+	| x=1 test $(pwd) export cd 'quoted text' awk 2>/dev/null /usr/bin
+		export /usr/bin $(pwd) 'quoted text' "$@" echo then 'quoted text' ${HOME}
+awk grep test cd 2>/dev/null local 'quoted text' done export export test
+		done 'quoted text' cd readonly
+		test 2>/dev/null ${HOME} export sed done 2>/dev/null readonly then "$@" 2>/dev/null
+	export -eu printf "$1" sed 'quoted text' "$1" /usr/bin grep | echo "$1" $(pwd)
+	x=1 grep x=1 /usr/bin --verbose 2>/dev/null
+	| | -eu test -eu sed export echo $(pwd) "$1" && local 2>/dev/null
+		export && echo 'quoted text'
+		"$@" cd && 2>/dev/null cd readonly sed done printf test local x=1 'quoted text'
+printf printf done && ${HOME} x=1 local 2>/dev/null
+sed | /usr/bin "$@" cd /usr/bin then export $(pwd)
+export awk test grep --verbose readonly readonly | /usr/bin
+	sed --verbose done done printf
+test 2>/dev/null -eu 'quoted text'
+		/usr/bin cd "$@" printf export --verbose $(pwd) printf 2>/dev/null
+	then /usr/bin $(pwd) done printf "$1" local local echo
+		${HOME} test readonly 'quoted text'
+		| local echo /usr/bin 2>/dev/null local ${HOME} grep done
+x=1 -eu "$@" --verbose /usr/bin -eu awk echo echo local --verbose cd && cd done
+"$1" awk "$1" /usr/bin 'quoted text'
+x=1 export export test "$@" then && grep --verbose -eu 'quoted text' ${HOME} sed
+		&& done printf export echo 'quoted text'
+		test /usr/bin -eu 'quoted text' echo export
+		done readonly "$1" | grep sed echo 'quoted text'
+		done test local /usr/bin grep done -eu 2>/dev/null
+sed -eu | awk echo export then x=1 done grep | readonly
+	echo readonly local && --verbose local then readonly done && && sed
+x=1 echo then readonly awk echo 2>/dev/null done --verbose printf
+	readonly -eu grep 'quoted text' && done echo x=1
+export local -eu x=1 cd test /usr/bin test && then test printf ${HOME}
+		done grep readonly done && readonly x=1 $(pwd) cd local done ${HOME} cd
+&& -eu grep "$@" echo then export done
+		printf awk "$1" /usr/bin printf x=1
+export && test cd grep 2>/dev/null readonly cd && --verbose $(pwd) grep awk
+		printf local "$1" local cd cd 2>/dev/null cd cd test "$@" && local --verbose
+	/usr/bin "$@" readonly readonly done "$@" export then "$1" -eu
+		then ${HOME} $(pwd) done grep grep echo $(pwd) readonly 2>/dev/null local
+	then 'quoted text' test "$1" ${HOME} then "$1" sed local then then echo readonly
+	echo printf grep export 'quoted text' --verbose
+local $(pwd) "$1" 2>/dev/null local local "$@" | grep test ${HOME} done
+/usr/bin -eu ${HOME} export printf --verbose /usr/bin
+		| done cd --verbose && printf "$1" 'quoted text'
+		'quoted text' cd /usr/bin "$@" then 2>/dev/null then
+"$1" awk x=1 | cd sed 2>/dev/null cd readonly 2>/dev/null
+		/usr/bin $(pwd) export x=1 | -eu --verbose printf grep export "$@"
+		'quoted text' | | --verbose "$1" $(pwd) $(pwd) ${HOME} -eu
+		"$@" ${HOME} $(pwd) ${HOME} test done --verbose export cd then cd | x=1
+export printf test 'quoted text' --verbose done "$@" && then "$1" /usr/bin
+then export 'quoted text' x=1 && done
+done ${HOME} "$1" | $(pwd) -eu 'quoted text' $(pwd) awk
+	2>/dev/null "$@" 'quoted text' x=1 cd echo then "$1" printf
+	readonly awk printf echo printf awk -eu echo
+-eu /usr/bin -eu then cd test awk x=1 test $(pwd) "$@" awk /usr/bin readonly
+		${HOME} test grep awk --verbose printf
+		cd cd export 'quoted text' local done /usr/bin ${HOME} sed $(pwd)
+	printf awk echo printf readonly grep -eu sed /usr/bin "$@" -eu export
+		'quoted text' cd awk printf
+		$(pwd) readonly 'quoted text' --verbose && done 'quoted text'
+	"$1" test $(pwd) readonly
+	awk $(pwd) x=1 sed "$1" "$1" grep test $(pwd) sed test "$@" grep printf
+	| 'quoted text' "$1" --verbose
+		then ${HOME} export printf sed && --verbose && readonly done printf
+	done 2>/dev/null sed x=1 test readonly "$1" | grep $(pwd)
+	-eu done sed then echo readonly then grep |
+		-eu sed "$@" printf cd readonly cd cd echo then then
+	${HOME} printf readonly echo local $(pwd) && "$@" echo
+		test ${HOME} grep done readonly
+		${HOME} sed done "$@" export grep | echo then 'quoted text' --verbose
+		sed $(pwd) readonly /usr/bin
+		2>/dev/null 2>/dev/null 'quoted text' grep x=1 export && $(pwd) sed echo
+	cd /usr/bin | $(pwd) "$@" awk $(pwd) "$1" export grep awk
+		local test readonly $(pwd) sed grep
+		readonly echo sed cd grep done
+readonly awk awk -eu sed export --verbose && $(pwd) echo awk /usr/bin
+		${HOME} readonly x=1 readonly local ${HOME} "$1" "$@" done echo /usr/bin
+printf readonly $(pwd) done 'quoted text' grep export
+	then local | ${HOME} 2>/dev/null sed then "$1" local sed export awk 'quoted text'
+	| readonly ${HOME} echo && x=1 local
+	"$@" export && printf --verbose readonly test printf
+	| then then readonly cd "$1" then
+	${HOME} "$@" /usr/bin export "$1" -eu 'quoted text' x=1 echo readonly
+		${HOME} readonly ${HOME} done cd done echo && && then | done done /usr/bin
+		/usr/bin "$1" && && $(pwd) "$1" /usr/bin
+	$(pwd) readonly test export -eu cd && "$@" x=1 readonly cd cd 2>/dev/null "$1"
+	cd && local /usr/bin | local test && "$1" then ${HOME}
+		printf x=1 | | -eu readonly echo sed 2>/dev/null done test
+	done "$@" 2>/dev/null 2>/dev/null "$1" "$@" --verbose printf -eu
+	local 'quoted text' -eu done -eu ${HOME} 'quoted text'
+		"$@" local 2>/dev/null local "$1"
+	"$1" && ${HOME} x=1 ${HOME} test -eu
+| grep -eu --verbose sed echo then local $(pwd)
+local echo grep $(pwd) 'quoted text' export "$1" "$1" | && ${HOME} -eu echo
+	x=1 && "$1" done readonly
+		local readonly "$1" 2>/dev/null readonly then 'quoted text'
+then readonly printf then "$1" | "$1" then "$1"
+	$(pwd) grep cd then awk "$1" readonly /usr/bin cd x=1 x=1 sed
+printf export && echo --verbose cd local test $(pwd) /usr/bin x=1
+		export "$1" $(pwd) grep 2>/dev/null
+done printf $(pwd) /usr/bin
+-eu then done grep cd $(pwd) 2>/dev/null 2>/dev/null 2>/dev/null
+	local cd 2>/dev/null -eu --verbose
+		export test | 2>/dev/null
+	'quoted text' readonly 2>/dev/null
+		| done "$@" 2>/dev/null && grep awk printf sed readonly cd | ${HOME}
+	-eu export --verbose && 'quoted text'
+x=1 -eu -eu grep -eu "$1" --verbose export awk local awk "$1" awk
+		done "$@" local grep awk $(pwd) --verbose --verbose awk then printf local 2>/dev/null
+	grep grep && 'quoted text' printf 'quoted text'
+		sed grep x=1 --verbose echo printf readonly
+	$(pwd) 'quoted text' $(pwd) $(pwd) sed 2>/dev/null
+done "$@" readonly grep && sed
+		export sed test readonly $(pwd)
+x=1 test "$@" "$1" && export
+'quoted text' sed $(pwd) sed
+	cd readonly test export
+readonly export sed && awk local
+grep "$@" x=1 done echo done 2>/dev/null sed
+		done export ${HOME} $(pwd) "$@"
+	awk | 'quoted text' --verbose local --verbose sed then
+$(pwd) awk export --verbose 'quoted text' then 'quoted text'
+	echo | readonly $(pwd) test echo awk
+printf x=1 test local awk sed export grep $(pwd) test
+	2>/dev/null "$@" | 'quoted text' &&
+	echo done x=1 $(pwd) && awk x=1 sed then "$@" $(pwd) readonly grep -eu export
+local then readonly "$@" ${HOME}
+	"$1" cd 2>/dev/null "$@" local export test 'quoted text' 2>/dev/null
+	cd "$@" -eu /usr/bin "$@" && /usr/bin sed grep grep | "$1" x=1
+test cd x=1 printf --verbose /usr/bin
+		echo -eu echo sed x=1 echo && -eu local "$@" --verbose
+--verbose /usr/bin echo ${HOME}
+'quoted text' done "$@" && /usr/bin
+done awk 2>/dev/null | && | 'quoted text' "$1"
+		grep cd done ${HOME} && echo --verbose x=1
+	"$1" grep awk awk sed ${HOME} ${HOME} 'quoted text' 'quoted text'
+cd ${HOME} | echo -eu then test grep
+	readonly && "$@" --verbose "$@" printf /usr/bin ${HOME} --verbose test
+		-eu readonly awk awk "$@"
+sed && "$1" $(pwd) -eu export then grep --verbose cd awk 2>/dev/null
+2>/dev/null echo done 'quoted text' local
+		grep readonly awk 'quoted text' local -eu && grep echo $(pwd) cd | /usr/bin
+	grep 2>/dev/null echo echo export
+then -eu ${HOME} 'quoted text' x=1 | && then -eu readonly $(pwd) echo /usr/bin
+		x=1 export && 'quoted text' /usr/bin
+		/usr/bin $(pwd) 2>/dev/null
+		grep export then /usr/bin ${HOME} export && then
+		x=1 "$@" x=1 printf test "$@" && "$1" x=1 then $(pwd) 'quoted text'
+		done grep ${HOME} $(pwd) export ${HOME} printf
+${HOME} && --verbose test $(pwd) cd awk x=1 x=1 "$1" grep echo local $(pwd) /usr/bin
+	cd awk $(pwd) 'quoted text' readonly | grep echo
+		-eu -eu grep -eu grep --verbose /usr/bin $(pwd) -eu --verbose grep "$1" "$1"
+	| printf ${HOME} --verbose local ${HOME} "$1" && readonly
+done readonly cd grep grep 'quoted text'
+$(pwd) cd awk 2>/dev/null then
+sed test done /usr/bin done && && x=1
+		/usr/bin ${HOME} 2>/dev/null "$@" &&
+		local sed x=1 2>/dev/null grep local sed 2>/dev/null | && cd
+	--verbose $(pwd) test awk awk export local awk "$1" then ${HOME} "$@" cd
+	"$1" --verbose cd "$@"
+	x=1 --verbose /usr/bin "$@" /usr/bin done test ${HOME}
+--verbose /usr/bin && then x=1 "$@" 'quoted text' echo "$@" --verbose x=1
+cd $(pwd) "$1" && test export awk /usr/bin --verbose "$1"
+		&& awk echo local "$@" -eu grep
+	x=1 $(pwd) then test done "$1"
+		-eu readonly $(pwd) done
+2>/dev/null awk ${HOME} cd "$1" /usr/bin printf && $(pwd) "$1" echo local test test
+	readonly "$@" echo cd done sed | cd local && "$@" grep cd
+		printf sed export sed done test x=1 'quoted text'
+		sed awk cd readonly $(pwd) printf test done echo ${HOME} ${HOME} 'quoted text'
+		2>/dev/null "$1" x=1 && $(pwd) done "$1" 'quoted text' && ${HOME} -eu cd $(pwd)
+		export local 2>/dev/null then echo | 2>/dev/null
+awk 2>/dev/null readonly $(pwd) && export printf -eu -eu echo
+done -eu && 'quoted text' test cd grep | sed | export
+	test local then readonly sed /usr/bin -eu | "$1" "$1" echo
+	'quoted text' 'quoted text' then export $(pwd) export $(pwd)
+done | 2>/dev/null echo $(pwd)
+export local && grep 2>/dev/null /usr/bin awk sed sed readonly /usr/bin echo
+	export "$@" cd sed ${HOME} /usr/bin grep ${HOME} x=1 ${HOME} test "$1" && ${HOME}
+	| sed test readonly -eu export 'quoted text' $(pwd) "$1" ${HOME} sed -eu
+	local 'quoted text' ${HOME} cd done test then /usr/bin "$1" 'quoted text'
+		x=1 ${HOME} cd then done
+		awk $(pwd) 2>/dev/null /usr/bin export export readonly
+&& local -eu sed done 'quoted text'
+		cd printf $(pwd) "$1" -eu -eu local 2>/dev/null export
+		cd echo awk --verbose && cd readonly
+		readonly then /usr/bin awk -eu test readonly /usr/bin x=1 done
+done test "$1" "$@" readonly -eu | 'quoted text'
+		readonly && readonly 2>/dev/null grep "$@" --verbose
+done test done "$@" 2>/dev/null "$@" sed $(pwd) 2>/dev/null
+x=1 "$@" ${HOME} && "$1" then then awk done then done /usr/bin
+	done && echo printf -eu
+	grep /usr/bin -eu /usr/bin "$1" ${HOME} 2>/dev/null 2>/dev/null
+		printf done then "$1" readonly cd ${HOME} test 'quoted text' echo grep
+	then echo cd echo | grep ${HOME} cd 'quoted text' then ${HOME} awk
+		local local -eu --verbose
+$(pwd) readonly then ${HOME} sed --verbose x=1
+	$(pwd) "$@" | x=1 done printf /usr/bin printf 'quoted text' 2>/dev/null
+	grep readonly readonly cd awk
+cd && echo test printf "$@" cd --verbose x=1 export 2>/dev/null ${HOME} readonly
+${HOME} 'quoted text' local export done cd
+	2>/dev/null sed sed then /usr/bin then test awk | "$@" test
+	'quoted text' local --verbose "$1" && local grep test sed printf $(pwd) test
+		'quoted text' local export test ${HOME} cd $(pwd) cd ${HOME} grep test | ${HOME}
+		export echo printf test | printf readonly | printf -eu | then --verbose
+'quoted text' then 2>/dev/null grep echo done awk then 'quoted text'
+	x=1 "$@" "$1" 'quoted text' && readonly readonly done awk ${HOME} done done 'quoted text'
+	"$1" sed awk /usr/bin "$1" local && test done then grep | && -eu printf
+	${HOME} then 'quoted text' -eu x=1 echo --verbose 'quoted text'
+		cd && awk $(pwd) 2>/dev/null cd -eu awk cd printf sed 2>/dev/null
+	grep cd grep | /usr/bin grep export
+	local $(pwd) test --verbose printf test | | export /usr/bin && awk cd echo
+2>/dev/null | "$@" && echo grep test readonly readonly 'quoted text' "$1" test cd
+		done done readonly ${HOME} printf sed 2>/dev/null ${HOME}
+		/usr/bin sed "$@" awk "$@" 2>/dev/null sed -eu cd local
+	then "$@" /usr/bin echo readonly "$@" done 2>/dev/null local "$1" "$1" awk local
+	sed grep x=1 ${HOME} "$1" "$@" export printf local /usr/bin 'quoted text'
+	| -eu && /usr/bin readonly -eu local done grep readonly then grep $(pwd)
+	sed echo x=1 readonly done ${HOME}
+	local "$1" export 'quoted text' 2>/dev/null local
+		sed cd ${HOME} x=1 then --verbose /usr/bin readonly done
+&& export x=1 ${HOME} | && echo "$@"
+		then "$@" cd 2>/dev/null printf grep cd printf 'quoted text' test "$1" echo
+		readonly /usr/bin --verbose sed --verbose 2>/dev/null && grep
+		export export grep done
+	local 'quoted text' cd echo
+	local sed printf printf echo 2>/dev/null readonly -eu sed done local
+"$1" cd --verbose readonly | readonly
+	"$@" cd "$@" then "$1" cd awk
+	readonly cd --verbose done then cd /usr/bin | "$1" "$1" readonly awk
+	readonly 2>/dev/null sed 2>/dev/null |
+cd "$1" done echo then $(pwd) echo | sed grep then
+	${HOME} awk --verbose ${HOME} cd --verbose test "$1" test test done then
+		awk sed test then "$@" awk --verbose export --verbose
+${HOME} grep ${HOME} "$1" x=1 cd $(pwd) --verbose
+sed | /usr/bin cd cd 2>/dev/null
+		sed done 2>/dev/null | printf x=1 -eu
+		sed awk /usr/bin 2>/dev/null
+$(pwd) grep echo /usr/bin readonly readonly "$1"
+awk grep 2>/dev/null /usr/bin | --verbose 2>/dev/null
+echo -eu then "$@" sed cd "$1" cd -eu 2>/dev/null
+	$(pwd) cd && ${HOME} local awk "$1" | cd done ${HOME} cd
+readonly "$1" export then printf local awk echo done /usr/bin $(pwd) /usr/bin
+/usr/bin cd awk $(pwd) cd
+	then awk "$@" printf && /usr/bin "$1" $(pwd) echo
+	x=1 --verbose grep 'quoted text'
+		/usr/bin local sed cd 2>/dev/null
+grep printf "$@" 2>/dev/null
+		$(pwd) grep ${HOME} 'quoted text' "$@" cd echo | export sed done $(pwd) awk
+	readonly 'quoted text'
+	local sed sed sed echo /usr/bin
+		readonly 2>/dev/null x=1 /usr/bin /usr/bin sed --verbose
+	--verbose cd cd "$1" -eu 'quoted text' local 'quoted text' -eu x=1 sed
+-eu 'quoted text' ${HOME} cd awk --verbose $(pwd) sed export grep
+	$(pwd) test echo "$@" -eu -eu --verbose "$1" local
+--verbose ${HOME} && && /usr/bin
+cd $(pwd) /usr/bin 2>/dev/null awk grep "$@"
+		${HOME} cd && test | 'quoted text' then sed && --verbose $(pwd) && printf readonly
+	"$@" -eu | cd --verbose echo sed cd ${HOME} test 2>/dev/null | export
+	export done $(pwd) grep
+	readonly readonly x=1 --verbose && 2>/dev/null
+		| /usr/bin test | printf local --verbose done then
+		export -eu grep awk awk "$1" awk 'quoted text'
+$(pwd) grep -eu echo "$@" grep --verbose then sed sed cd printf
+	done printf 2>/dev/null printf done export "$@" done
+		done then done printf 'quoted text'
+printf local sed /usr/bin
+	grep x=1 -eu && test x=1 readonly /usr/bin "$1" cd --verbose readonly
+test export grep 2>/dev/null /usr/bin "$@" printf
+"$@" | ${HOME} cd test "$1" /usr/bin grep && readonly
+sed "$@" | local --verbose -eu 'quoted text' ${HOME}
+		| local 2>/dev/null grep echo 'quoted text' $(pwd) cd
+	--verbose 2>/dev/null 2>/dev/null /usr/bin readonly
+then && sed --verbose test && x=1 'quoted text' "$@" $(pwd) | x=1
+		x=1 export test -eu "$@" then then 2>/dev/null awk cd "$1" | awk
+		cd export awk "$@" --verbose printf
+sed $(pwd) export done "$@" 'quoted text' -eu readonly
+		awk $(pwd) | && done printf x=1 --verbose awk 2>/dev/null
+done done done 2>/dev/null grep done awk then export --verbose ${HOME} printf
+	then | grep "$@" export echo
+test ${HOME} /usr/bin then -eu done ${HOME} "$1" && export sed 'quoted text'
+	awk then ${HOME} $(pwd) readonly readonly -eu readonly test echo then && awk
+		printf printf echo done 'quoted text' local sed "$1" export -eu awk echo
+-eu ${HOME} echo export cd "$@" cd done 2>/dev/null done x=1 -eu x=1 export "$1"
+		'quoted text' 'quoted text' /usr/bin local ${HOME}
+then ${HOME} | awk echo --verbose grep
+	$(pwd) --verbose readonly echo export done $(pwd) "$@" local
+$(pwd) cd cd echo ${HOME} then cd | grep printf
+		then $(pwd) cd grep 'quoted text' | test "$1" test grep
+${HOME} done "$1" && "$@" "$1" && && echo awk readonly 2>/dev/null done readonly
+local x=1 sed export cd local "$@"
+	cd $(pwd) | local cd --verbose echo sed /usr/bin 2>/dev/null awk
+	export 2>/dev/null $(pwd) | then "$@" local readonly local
+test x=1 "$@" "$1" -eu | echo /usr/bin then readonly test
+		--verbose test /usr/bin | /usr/bin "$@" grep && local export test awk 'quoted text'
+		local done awk "$1" "$1" && "$@" /usr/bin echo --verbose /usr/bin local awk
+| local | done ${HOME} "$@" && "$@" --verbose "$1" $(pwd)
+	/usr/bin then -eu cd printf done test test -eu printf 2>/dev/null -eu
+		2>/dev/null --verbose 'quoted text'
+		echo awk grep then grep grep --verbose x=1 --verbose 'quoted text' -eu sed 'quoted text'
+	-eu -eu grep readonly done cd
+	$(pwd) then test "$1" "$1"
+grep -eu x=1 cd | -eu sed sed then sed x=1 printf /usr/bin
+	'quoted text' 2>/dev/null 'quoted text' "$@" export cd awk | | $(pwd)
+	${HOME} test ${HOME} readonly ${HOME} --verbose export 2>/dev/null
+	then grep $(pwd) /usr/bin "$@" printf x=1 readonly -eu && --verbose
+x=1 readonly grep && && $(pwd) export
+&& 2>/dev/null printf then cd && "$1" /usr/bin "$@" then && "$1" echo
+		sed printf export export readonly printf && done
+		printf ${HOME} grep cd
+echo awk printf then echo
+	grep --verbose ${HOME} cd ${HOME}
+cd "$@" /usr/bin test && 2>/dev/null printf
+local printf grep --verbose "$1" && done done echo 'quoted text' cd awk x=1
+| $(pwd) then cd x=1 export 2>/dev/null printf && awk ${HOME} /usr/bin
+/usr/bin printf --verbose
+		"$@" local cd done printf export grep "$@" local done "$@" sed --verbose
+${HOME} "$@" printf grep /usr/bin grep grep
+awk | /usr/bin sed -eu && export x=1 /usr/bin /usr/bin --verbose sed cd
+	export "$1" -eu ${HOME} readonly 2>/dev/null export then "$1" "$@" $(pwd)
+		"$1" | cd sed --verbose then x=1 /usr/bin x=1 ${HOME} done echo printf
+		readonly done grep grep x=1 && echo
+		| export awk && awk --verbose
+| local $(pwd) 'quoted text' 'quoted text'
+	test export --verbose sed ${HOME}
+		/usr/bin awk sed done x=1 echo 2>/dev/null | printf 2>/dev/null 2>/dev/null $(pwd)
+	then readonly sed cd export awk done ${HOME} -eu test readonly && /usr/bin then
+	2>/dev/null 'quoted text' && sed && 'quoted text' export /usr/bin
+		-eu $(pwd) /usr/bin awk "$1" done x=1 local local | sed -eu test grep printf
+		grep --verbose local 'quoted text' --verbose
+		'quoted text' test | 2>/dev/null
+"$@" 2>/dev/null test test echo then ${HOME} sed -eu 2>/dev/null /usr/bin
+cd test x=1 grep done done $(pwd) 2>/dev/null grep awk 'quoted text'
+	/usr/bin | echo x=1 printf readonly 'quoted text' /usr/bin local
+awk 2>/dev/null printf test $(pwd) | local -eu readonly x=1 "$@" then cd readonly
+local 'quoted text' readonly /usr/bin ${HOME} | x=1 /usr/bin x=1
+		sed --verbose /usr/bin sed local
+	cd && sed ${HOME} then export readonly
+	x=1 done local -eu x=1 printf x=1 grep -eu 2>/dev/null printf printf local
+	&& grep echo -eu printf grep --verbose
+-eu sed done ${HOME} local done grep local $(pwd)
+local printf "$@" x=1 sed x=1
+"$1" "$@" sed printf grep 'quoted text' sed local done then done 'quoted text'
+test /usr/bin "$@" x=1 ${HOME}
+		cd 'quoted text' /usr/bin echo -eu then cd
+	-eu printf --verbose x=1 export test "$1" export done sed grep printf readonly x=1
+| --verbose 'quoted text' grep then --verbose cd
+awk awk "$1" local local awk cd awk 'quoted text' awk "$@" ${HOME} cd done
+	local sed local printf $(pwd) -eu grep 2>/dev/null
+	printf grep printf sed 'quoted text'
+--verbose -eu ${HOME} test local export sed --verbose | echo && ${HOME} echo
+--verbose cd "$1" /usr/bin echo "$1" export test --verbose "$@" grep
+	test test local awk "$1" --verbose
+		&& --verbose export "$1" "$@" readonly && echo ${HOME} --verbose cd readonly
+	$(pwd) grep -eu && readonly
+	-eu "$@" done "$@" /usr/bin "$1" grep /usr/bin echo --verbose
+		awk test then grep "$@" local 'quoted text'
+		/usr/bin ${HOME} && readonly then ${HOME} /usr/bin 'quoted text'
+	echo test /usr/bin grep local ${HOME} && then test then -eu &&
+	sed grep readonly printf printf sed cd ${HOME} awk echo 'quoted text' readonly grep
+	grep x=1 $(pwd) && cd awk
+/usr/bin cd sed /usr/bin echo
+		test 'quoted text' awk printf
+	echo then | readonly printf local grep -eu readonly ${HOME} done test x=1
+	then 2>/dev/null then test --verbose
+export ${HOME} done printf --verbose ${HOME} awk ${HOME} 'quoted text'
+	&& "$@" "$1" cd export $(pwd) readonly ${HOME} ${HOME} done
+		echo readonly 'quoted text' --verbose | readonly printf readonly
+done ${HOME} -eu 'quoted text' grep $(pwd) readonly 'quoted text' done awk sed 'quoted text'
+	2>/dev/null cd 'quoted text' /usr/bin
+export export && readonly -eu sed 2>/dev/null | local && -eu
+done /usr/bin "$1" awk echo $(pwd) | awk readonly then "$@" export
+		/usr/bin $(pwd) 2>/dev/null grep "$1" done x=1
+		'quoted text' printf --verbose x=1 "$@" "$@" awk
+"$1" "$@" awk $(pwd) "$1" printf grep cd
+		readonly $(pwd) local echo sed grep -eu x=1 readonly
+	printf 2>/dev/null sed grep && test
+		local printf | done grep readonly && test grep
+printf 2>/dev/null ${HOME} "$1" "$1" local export
+2>/dev/null grep sed | test && then --verbose "$@" readonly
+		-eu readonly sed && x=1 -eu | readonly --verbose 2>/dev/null 2>/dev/null
+	done awk printf printf cd readonly "$@" -eu cd readonly 2>/dev/null | | ${HOME}
+		/usr/bin x=1 "$@" | $(pwd) "$@"
+${HOME} $(pwd) 'quoted text'
+		local 'quoted text' export 'quoted text'
+echo awk readonly echo done 'quoted text' then export local 'quoted text' 2>/dev/null
+		/usr/bin grep -eu --verbose x=1 test then x=1 'quoted text' printf | local
+readonly $(pwd) 2>/dev/null grep
+then | readonly sed printf x=1 && sed
+	echo test $(pwd) --verbose done | test
+		readonly $(pwd) export printf cd test 'quoted text'
+-eu /usr/bin export | --verbose ${HOME} export 2>/dev/null | 2>/dev/null
+		export local && done -eu --verbose test "$@" readonly test export
+"$@" "$1" awk awk cd --verbose 'quoted text' sed export local export
+| 'quoted text' ${HOME} "$1" readonly --verbose
+done local $(pwd) 'quoted text'
+		test 'quoted text' sed sed "$1" --verbose export cd local 2>/dev/null
+		"$@" printf then readonly sed echo x=1 then 2>/dev/null
+awk grep 'quoted text' printf ${HOME} grep
+		local cd then export local cd echo 2>/dev/null "$@" echo $(pwd) 'quoted text'
+		/usr/bin echo | $(pwd) 'quoted text' --verbose printf $(pwd)
+		| echo "$1" sed awk awk && echo local readonly 'quoted text'
+done done local "$@" "$@" export then local "$1" sed "$@"
+'quoted text' local grep test done "$1" --verbose awk
+	2>/dev/null ${HOME} export readonly export echo -eu export -eu 'quoted text'
+	2>/dev/null x=1 x=1 then sed 2>/dev/null
+	test && "$@" test | 'quoted text' --verbose -eu x=1 printf "$1" --verbose
+		cd readonly ${HOME} then test
+awk x=1 | awk echo "$@" export echo awk /usr/bin
+x=1 readonly local 'quoted text' echo
+	test "$@" $(pwd) echo | export cd export cd ${HOME} done sed 'quoted text'
+	local awk local done $(pwd) test local done 'quoted text'
+-eu | --verbose | readonly test echo done local 'quoted text' --verbose
+		readonly printf test | test printf 'quoted text'
+'quoted text' $(pwd) done export echo && "$@" 2>/dev/null "$@"
+		'quoted text' export awk 2>/dev/null echo
+awk --verbose "$1" then && awk && "$1" sed grep then
+	$(pwd) readonly readonly ${HOME} -eu --verbose readonly 'quoted text' 'quoted text'
+	2>/dev/null grep | "$@" grep -eu cd | /usr/bin 2>/dev/null $(pwd) local
+	awk grep echo "$@" done
+	| /usr/bin 'quoted text' "$@" 2>/dev/null sed /usr/bin ${HOME} sed local
+"$@" then --verbose /usr/bin awk awk echo x=1 sed /usr/bin --verbose
+$(pwd) && && local /usr/bin local
+		test --verbose sed echo "$1" 2>/dev/null
+		'quoted text' local x=1 'quoted text'
+	2>/dev/null test cd grep done -eu grep grep
+-eu $(pwd) "$1" $(pwd) | grep x=1 && test printf
+		grep /usr/bin cd && 2>/dev/null /usr/bin
+		${HOME} 2>/dev/null grep readonly export && echo then $(pwd)
+		grep printf awk -eu local done "$@" readonly && grep 2>/dev/null
+		test -eu && then 2>/dev/null && then then "$@" 'quoted text' $(pwd) done grep
+"$@" awk local local
+		x=1 then /usr/bin 'quoted text' then "$@" && cd "$1" export "$1" cd "$@" x=1
+		awk "$@" ${HOME} grep && $(pwd) | /usr/bin echo && readonly /usr/bin
+'quoted text' echo readonly ${HOME} awk $(pwd) awk
+	2>/dev/null sed then && sed cd && echo cd "$1" ${HOME}
+	--verbose "$@" printf "$1" "$@" $(pwd) then readonly
+2>/dev/null export then /usr/bin x=1 && | then done echo --verbose |
+	${HOME} then sed 'quoted text' cd "$1" echo --verbose 'quoted text'
+		done | x=1 -eu x=1 -eu ${HOME} $(pwd) | 2>/dev/null
+	test awk sed printf && ${HOME} then local
+-eu "$1" "$@" ${HOME} readonly
+		test done | --verbose && | "$@" && test printf readonly -eu | 'quoted text'
+		"$1" grep grep /usr/bin x=1 cd --verbose
+		grep --verbose "$@" x=1 cd test grep | /usr/bin test
+--verbose && "$1" x=1 printf 'quoted text'
+export echo cd printf x=1 x=1 "$@"
+		readonly 'quoted text' grep awk sed then awk
+		"$@" x=1 "$@" cd "$@" 'quoted text'
+	done 2>/dev/null export ${HOME} cd --verbose x=1 cd local 2>/dev/null cd
+	cd ${HOME} /usr/bin &&
+	printf && | "$1" readonly printf then readonly
+		printf "$1" printf export && done awk 2>/dev/null ${HOME} 2>/dev/null "$1" x=1
+	echo /usr/bin "$1" --verbose
+grep test x=1 sed sed cd --verbose 2>/dev/null -eu grep x=1 then export
+		then | 2>/dev/null && && local
+	--verbose export | x=1 --verbose sed printf "$@" echo 'quoted text'
+		export "$@" readonly ${HOME} test
+		then test 'quoted text' sed awk ${HOME} readonly "$1" readonly 'quoted text' -eu
+	grep grep | ${HOME} /usr/bin done cd "$1" readonly then && done
+	/usr/bin -eu readonly echo sed awk -eu export then /usr/bin export | done && |
+	--verbose export then local test $(pwd)
+	local x=1 /usr/bin readonly then readonly | | x=1 'quoted text' printf 'quoted text'
+		awk --verbose awk 2>/dev/null
+		x=1 | readonly $(pwd) "$1" ${HOME} local echo export
+		echo local 2>/dev/null "$1" && export && /usr/bin |
+"$@" awk /usr/bin 2>/dev/null /usr/bin
+	--verbose x=1 2>/dev/null && -eu $(pwd) local "$1" echo cd "$@" grep
+		echo cd && --verbose | cd export grep awk sed
+-eu 'quoted text' done then | "$1" grep done test cd "$@" | printf
+		"$1" local export sed readonly cd $(pwd) && awk --verbose x=1 done |
+		local $(pwd) "$1" echo awk x=1 $(pwd) "$1" export
+"$@" | --verbose readonly local "$@" x=1
+		"$1" "$1" 'quoted text' local
+--verbose echo -eu /usr/bin cd 2>/dev/null
+	--verbose --verbose export export x=1 2>/dev/null
+grep awk "$@" "$1" test done
+	'quoted text' 2>/dev/null echo && test ${HOME} echo "$@"
+"$1" $(pwd) && echo 'quoted text' then 2>/dev/null
+	test x=1 sed then ${HOME} -eu local
+		"$@" && 2>/dev/null grep
+		x=1 export "$@" ${HOME}
+	--verbose "$1" cd test cd "$1" x=1 done done && 'quoted text' awk
+${HOME} then $(pwd) /usr/bin -eu -eu echo /usr/bin -eu grep printf
+		$(pwd) "$@" /usr/bin readonly "$@" $(pwd) && test printf cd test
+then 2>/dev/null $(pwd) then $(pwd)
+grep readonly "$@" export 'quoted text' then export awk echo
+	${HOME} export $(pwd) readonly
+		test -eu readonly printf "$1" 'quoted text'
+export -eu | grep -eu "$@" "$1" then --verbose local 2>/dev/null cd cd --verbose
+	-eu ${HOME} printf "$1" done echo "$@" $(pwd) /usr/bin local then | $(pwd)
+grep test then done test sed
+then sed cd x=1 echo 2>/dev/null sed export 2>/dev/null "$1" /usr/bin /usr/bin
+		echo printf x=1 test "$@" test awk && awk readonly
+grep 'quoted text' "$@" then awk | awk readonly then grep
+	&& && grep 2>/dev/null then done readonly $(pwd) --verbose x=1 echo --verbose
+	&& readonly | awk "$1" "$@" grep | sed sed "$1" "$@" | then sed "$@"
+		-eu | sed sed /usr/bin awk readonly export then then "$@" --verbose | printf
+		| --verbose grep awk readonly sed "$1"
+		/usr/bin readonly awk 2>/dev/null readonly 2>/dev/null
+	$(pwd) readonly cd $(pwd) --verbose grep ${HOME} x=1 printf done
+then local done export $(pwd)
+test then $(pwd) | --verbose readonly 'quoted text' then printf
+	${HOME} 'quoted text' sed printf printf local local 'quoted text' readonly cd done
+	2>/dev/null readonly 2>/dev/null && export 2>/dev/null export
+grep --verbose "$@" /usr/bin sed x=1 x=1 2>/dev/null
+	--verbose test sed printf --verbose
+&& cd printf echo sed
+cd grep --verbose x=1 ${HOME} readonly | x=1
+	"$1" readonly -eu | 2>/dev/null -eu grep printf sed -eu readonly export awk
+	awk $(pwd) done then 2>/dev/null
+	${HOME} x=1 readonly printf
+		${HOME} /usr/bin printf done
+		test test readonly "$1" cd $(pwd)
+	local 2>/dev/null | sed
+	done echo $(pwd) then 'quoted text' ${HOME} echo "$@" readonly
+	echo awk export cd "$1" $(pwd) local printf ${HOME} x=1 --verbose test x=1
+		cd test grep | && && -eu
+	then "$@" $(pwd) export ${HOME} sed
+		local done grep ${HOME} grep 2>/dev/null 2>/dev/null cd then grep export echo --verbose
+		| | | 'quoted text' "$@" x=1 export 'quoted text'
+	local /usr/bin readonly printf done local cd 'quoted text' && then grep readonly
+		"$@" -eu readonly 'quoted text' local "$1" local readonly local
+		export then | local sed ${HOME} local /usr/bin done x=1 'quoted text' --verbose
+		then echo cd ${HOME} | test readonly
+		| local export readonly readonly | done 2>/dev/null --verbose
+/usr/bin echo printf
+'quoted text' x=1 echo then export echo ${HOME}
+		local awk awk /usr/bin local
+		cd sed && -eu export readonly "$@"
+$(pwd) $(pwd) awk grep done 'quoted text' printf 2>/dev/null test "$@" readonly
+grep "$@" --verbose | grep export test
+		$(pwd) "$1" && test | | -eu | done "$1" "$1" $(pwd) $(pwd) "$1" && --verbose |
+		printf && local printf && /usr/bin
+		"$@" -eu | grep cd cd /usr/bin
+	readonly echo 'quoted text' printf ${HOME} local | "$@" then ${HOME} cd | grep
+		| "$@" echo -eu --verbose ${HOME} grep 2>/dev/null
+		-eu cd cd readonly --verbose sed --verbose && -eu $(pwd) $(pwd) && grep 2>/dev/null
+		&& then $(pwd) "$@" awk local ${HOME} "$1" local x=1
+-eu 2>/dev/null /usr/bin readonly awk
+2>/dev/null cd then "$@" readonly ${HOME} grep cd readonly awk
+echo sed "$@" done ${HOME}
+echo export --verbose 'quoted text'
+		sed "$@" cd local && $(pwd) printf done "$@" awk sed readonly awk local
+&& x=1 local --verbose
+	grep local | /usr/bin awk 'quoted text'
+	${HOME} 2>/dev/null 'quoted text'
+"$1" "$@" then printf readonly echo done 'quoted text' "$@" x=1 &&
+		--verbose local awk test done "$@" $(pwd) | && | /usr/bin
+		/usr/bin grep ${HOME} printf "$1" --verbose --verbose --verbose
+	echo --verbose then --verbose echo done sed | echo readonly x=1 2>/dev/null
+&& x=1 -eu awk awk export --verbose then | "$1" && "$1" echo echo done x=1 awk
+	--verbose && echo sed test cd && echo && "$1" -eu
+	'quoted text' x=1 | ${HOME}
+		'quoted text' && ${HOME}
+	"$@" x=1 $(pwd) | $(pwd) cd "$1"
+	readonly test local "$@" --verbose readonly
+		export echo local --verbose local /usr/bin x=1 | test
+	"$@" 2>/dev/null done
+		2>/dev/null -eu ${HOME} printf
+		local $(pwd) export --verbose local test 2>/dev/null awk "$@" awk ${HOME}
+	done export 'quoted text' "$@" ${HOME} test done $(pwd)
+		2>/dev/null "$1" echo $(pwd) echo /usr/bin export "$1" cd "$@" cd
+	sed && 2>/dev/null then done "$@" --verbose sed ${HOME} sed awk $(pwd) |
+		then 2>/dev/null sed sed grep then | | "$@" 2>/dev/null
+		${HOME} export | sed 'quoted text' printf done then --verbose --verbose
+"$1" cd sed awk "$1" export test 'quoted text'
+		awk | ${HOME} /usr/bin export $(pwd) 'quoted text' ${HOME} done
+		&& | "$@" -eu 2>/dev/null awk grep awk sed
+		"$@" "$1" $(pwd) grep done x=1 sed && readonly 'quoted text' ${HOME} $(pwd)
+		--verbose export grep readonly done && "$@" test
+		-eu done test -eu /usr/bin "$@" "$1" local | cd x=1 echo /usr/bin
+grep echo echo "$1" test ${HOME} echo local printf
+		export done done echo echo x=1 readonly grep
+'quoted text' sed export cd grep /usr/bin test printf $(pwd)
+	sed /usr/bin /usr/bin /usr/bin && "$1" test sed printf "$1" done
+		grep ${HOME} ${HOME} | x=1 /usr/bin 2>/dev/null cd local printf "$@"
+cd && echo readonly readonly readonly sed export
+2>/dev/null | readonly readonly && --verbose 'quoted text' "$@" && --verbose local
+	sed cd "$1" && -eu /usr/bin --verbose done --verbose /usr/bin | test echo
+"$1" "$1" $(pwd) readonly $(pwd) && then then $(pwd) readonly --verbose
+		awk echo sed then printf done awk $(pwd) echo done echo readonly echo 2>/dev/null
+echo echo 2>/dev/null $(pwd) awk /usr/bin sed printf $(pwd) sed echo 2>/dev/null
+x=1 grep done "$@" -eu 2>/dev/null awk
+	2>/dev/null -eu ${HOME} readonly
+printf then awk export /usr/bin ${HOME} | 2>/dev/null --verbose 'quoted text'
+	$(pwd) x=1 $(pwd) /usr/bin ${HOME} && 'quoted text'
+	grep readonly echo awk -eu
+-eu test "$@" grep 'quoted text'
+		sed cd 'quoted text' then
+		-eu 2>/dev/null cd $(pwd) printf -eu /usr/bin /usr/bin grep done x=1 x=1
+printf 2>/dev/null awk local /usr/bin $(pwd) sed ${HOME} grep readonly 2>/dev/null
+	--verbose && then cd "$@" awk sed then $(pwd)
+	2>/dev/null sed awk local ${HOME} x=1 readonly sed
+awk 2>/dev/null -eu -eu
+grep x=1 local grep cd ${HOME} awk grep
+cd grep 'quoted text' ${HOME} "$@" sed | local $(pwd)
+		"$1" x=1 -eu test export && "$@" grep /usr/bin local grep local "$1"
+		--verbose cd $(pwd) grep readonly x=1 /usr/bin
+		awk --verbose "$1" then export done 2>/dev/null
+--verbose test --verbose "$1" --verbose 2>/dev/null
+printf x=1 echo 2>/dev/null --verbose local cd --verbose ${HOME} --verbose
+local | test test export grep -eu cd | readonly
+	/usr/bin cd awk 'quoted text' --verbose awk cd done test "$1" 2>/dev/null
+		sed sed local 'quoted text' echo grep -eu export
+	x=1 local local && "$1" --verbose local test test export
+		'quoted text' --verbose
+-eu --verbose cd done | 2>/dev/null 'quoted text' echo echo ${HOME}
+		cd readonly --verbose && test "$@" --verbose --verbose
+		x=1 cd grep test $(pwd) then test test | cd export done test 'quoted text'
+	"$@" then -eu then 2>/dev/null export x=1 "$1" test printf 'quoted text'
+	"$@" awk "$1" ${HOME} sed
+		"$@" printf x=1 sed sed cd done --verbose printf printf "$@" | local
+		-eu then 'quoted text' sed
+		${HOME} 2>/dev/null -eu awk readonly then local local sed readonly awk && --verbose
+		grep "$1" "$1" export x=1 ${HOME} -eu | $(pwd) /usr/bin && 2>/dev/null
+printf ${HOME} ${HOME} | 2>/dev/null
+grep x=1 | grep --verbose echo local cd /usr/bin
+'quoted text' test sed printf 'quoted text' && -eu /usr/bin sed export grep then
+	grep test done x=1 ${HOME} /usr/bin awk 2>/dev/null ${HOME} done then
+grep $(pwd) $(pwd) /usr/bin -eu $(pwd) awk -eu export
+		"$@" ${HOME} grep echo local test x=1 awk $(pwd) x=1
+	&& "$@" export grep "$1" readonly /usr/bin 'quoted text'
+	x=1 local && ${HOME} -eu awk && 2>/dev/null ${HOME} -eu then cd done then awk awk
+	done "$@" printf x=1 --verbose grep echo then | done | 2>/dev/null
+	$(pwd) local && echo 2>/dev/null
+		--verbose done awk cd awk awk cd
+	then cd then 2>/dev/null | && -eu test awk sed readonly grep "$1" /usr/bin
+	| && sed 2>/dev/null 2>/dev/null /usr/bin local $(pwd) grep sed
+		--verbose 2>/dev/null grep echo done cd local then 2>/dev/null
+		'quoted text' test | export readonly "$@" 2>/dev/null "$1" && "$1" ${HOME} echo
+		awk echo test -eu | echo "$1" echo ${HOME} sed $(pwd) --verbose
+	printf -eu ${HOME} | 2>/dev/null awk x=1 "$@" test printf then
+test echo "$1" 2>/dev/null echo ${HOME} echo 2>/dev/null
+		then ${HOME} cd export -eu /usr/bin --verbose grep --verbose ${HOME}
+2>/dev/null | local readonly /usr/bin -eu readonly
+		2>/dev/null test test awk --verbose
+$(pwd) local && x=1 "$@" "$1"
+	/usr/bin $(pwd) export -eu then sed && "$@"
+	done export "$1" cd grep
+	local grep $(pwd) done | cd "$1"
+		test --verbose export local local $(pwd)
+		"$@" $(pwd) cd then readonly then $(pwd) readonly
+'quoted text' printf test readonly
+x=1 /usr/bin 2>/dev/null test --verbose
+	then echo done $(pwd) /usr/bin
+	${HOME} grep printf echo awk readonly | sed
+		-eu then "$1" printf --verbose "$@" readonly 2>/dev/null printf
+	grep 2>/dev/null --verbose printf "$1" "$@" $(pwd) "$@" done 2>/dev/null
+	grep $(pwd) echo echo export cd cd local printf grep cd awk then $(pwd)
+		test x=1 local grep "$@" -eu 'quoted text' cd
+	"$1" sed && x=1 cd cd x=1 export
+awk -eu then echo ${HOME} 2>/dev/null readonly && 2>/dev/null 'quoted text'
+		/usr/bin test readonly "$@"
+$(pwd) then ${HOME} cd ${HOME} local ${HOME}
+printf then then 'quoted text' -eu "$1" --verbose -eu "$1" --verbose
+local sed then export sed test then /usr/bin
+readonly export "$1" awk grep done test cd grep ${HOME} -eu awk ${HOME} done
+	export awk local | done local x=1 local
+	x=1 awk local sed "$@" && echo echo $(pwd)
+	x=1 local | --verbose
+readonly 'quoted text' "$@" echo --verbose grep test readonly sed "$1" /usr/bin
+&& && | then | 2>/dev/null -eu /usr/bin && awk sed "$@" echo 'quoted text'
+"$1" export printf awk ${HOME}
+		&& && "$@" --verbose --verbose --verbose then 'quoted text' cd printf
+	2>/dev/null export "$@" -eu awk 'quoted text' && --verbose
+export | printf -eu -eu --verbose "$@" 2>/dev/null | sed -eu grep
+		then -eu "$1" /usr/bin export "$1" --verbose done export echo 'quoted text' cd sed
+-eu done export local cd cd readonly readonly local 'quoted text' x=1 export
+then export | -eu "$1" readonly
+readonly | x=1 local 2>/dev/null
+	'quoted text' awk sed 'quoted text'
+	/usr/bin 'quoted text' printf -eu -eu grep --verbose readonly "$1"
+	-eu printf cd /usr/bin awk "$@" echo "$@" cd "$1" 2>/dev/null 2>/dev/null
+	sed $(pwd) /usr/bin done printf export && /usr/bin grep then x=1 printf
+		done printf sed | ${HOME} then x=1
+test "$1" "$1" local then "$@" grep export && grep --verbose "$1" x=1
+	cd export readonly printf done awk grep sed local cd /usr/bin
+		sed echo sed "$1" "$1" sed sed test --verbose done done grep /usr/bin
+		printf readonly export /usr/bin -eu | cd && 2>/dev/null
+	-eu "$1" export /usr/bin export x=1 local x=1 awk grep 2>/dev/null export "$@"
+	/usr/bin $(pwd) printf --verbose printf local echo "$1" printf "$1"
+	local export printf --verbose 2>/dev/null /usr/bin grep awk /usr/bin
+grep readonly "$@" x=1 /usr/bin "$@" cd | local awk "$1" then
+		then && "$1" echo "$1" && local 'quoted text'
+	| 'quoted text' cd test | sed --verbose ${HOME} local --verbose
+		then readonly && echo --verbose then done printf
+printf && | ${HOME} cd x=1 --verbose 2>/dev/null echo grep done /usr/bin
+		awk cd -eu 2>/dev/null printf local test 'quoted text' "$@" export
+	2>/dev/null | export export 'quoted text' awk "$1" x=1 printf 'quoted text'
+	${HOME} --verbose sed readonly $(pwd) ${HOME}
+		then --verbose then awk 'quoted text' done sed ${HOME}
+#include c222.sh
+cd grep 'quoted text' echo 'quoted text' 2>/dev/null
+test echo awk ${HOME} x=1 readonly /usr/bin --verbose test then
+	'quoted text' -eu 2>/dev/null readonly sed echo /usr/bin sed printf
+		${HOME} && local printf 2>/dev/null 2>/dev/null
+"$@" $(pwd) 'quoted text' --verbose x=1 && test cd export printf cd "$@"
+	cd && ${HOME} -eu cd
+	local && awk --verbose -eu 2>/dev/null | sed "$1" /usr/bin "$@" x=1 -eu "$1" "$1"
+	echo "$1" export test "$@" local "$1" printf /usr/bin && $(pwd) test test ${HOME}
+		sed sed export cd "$1" echo then export
+		then done 'quoted text' test readonly
+&& $(pwd) && awk grep $(pwd)
+	${HOME} sed sed /usr/bin ${HOME} echo 'quoted text' "$1"
+	done local cd done done $(pwd) readonly | ${HOME} local printf | printf
+		sed grep | cd cd ${HOME} sed -eu 2>/dev/null sed -eu printf
+&& sed $(pwd) | export -eu grep echo
+	test 'quoted text' && then -eu test done -eu grep sed
+	sed echo x=1 grep sed test 'quoted text'
+	grep "$1" "$@" done done 2>/dev/null printf printf
+"$1" 'quoted text' printf echo 'quoted text' "$1" grep 'quoted text' ${HOME}
+		"$@" then ${HOME} /usr/bin printf "$@" local "$@" readonly printf
+/usr/bin 2>/dev/null test printf ${HOME} 'quoted text'
+test /usr/bin echo test sed 2>/dev/null "$@" -eu cd printf
+		cd 'quoted text' $(pwd) $(pwd) 'quoted text' local
+2>/dev/null printf then cd test $(pwd) then && | 2>/dev/null cd export ${HOME}
+sed readonly then 2>/dev/null sed --verbose test /usr/bin
+		awk printf | readonly --verbose 'quoted text' cd test x=1 then 'quoted text' awk
+"$@" --verbose cd export test 'quoted text' "$1" printf /usr/bin
+	printf -eu test 2>/dev/null
+sed && "$@" -eu "$1" ${HOME} then x=1 | --verbose readonly
+		grep --verbose --verbose
+	test awk /usr/bin sed sed cd awk "$@" $(pwd) --verbose
+'quoted text' "$1" | ${HOME}
+		| printf 2>/dev/null x=1 export export done readonly grep test echo
+	printf && -eu awk && awk sed sed -eu ${HOME}
+		grep --verbose then --verbose export "$@" "$1" $(pwd) x=1 awk $(pwd) then
+		done printf awk && awk
+	printf | /usr/bin echo echo echo 'quoted text' | "$1" /usr/bin awk export
+		--verbose -eu ${HOME} -eu sed | /usr/bin readonly awk then sed done sed done ${HOME}
+	$(pwd) grep -eu 2>/dev/null export
+done sed && --verbose 2>/dev/null then cd "$@" readonly
+${HOME} grep -eu readonly
+		x=1 grep x=1 2>/dev/null ${HOME} x=1 then
+		2>/dev/null test local sed --verbose then "$@" /usr/bin
+		export then then "$@" local ${HOME}
+$(pwd) grep "$@" "$1" export
+printf awk printf | readonly 'quoted text' 'quoted text' echo ${HOME}
+		/usr/bin awk awk printf export awk local $(pwd) printf readonly | grep echo
+readonly grep "$1" awk
+	&& then sed sed && && then echo test && $(pwd) printf
+		readonly 'quoted text' 2>/dev/null x=1 local export local | ${HOME}
+	echo -eu -eu 'quoted text'
+	/usr/bin test /usr/bin local --verbose
+		$(pwd) local cd --verbose printf -eu test &&
+	"$1" awk done readonly 'quoted text' echo "$1" export
+		awk $(pwd) done awk export readonly x=1 /usr/bin /usr/bin awk && x=1 x=1
+		test /usr/bin local readonly export then printf && done echo --verbose awk ${HOME}
+	/usr/bin export test readonly test 2>/dev/null -eu 'quoted text' &&
+		&& "$@" "$@" ${HOME} local /usr/bin grep then -eu "$@" readonly
+		x=1 then 2>/dev/null local 2>/dev/null then test
+	"$1" /usr/bin x=1 "$@"
+		cd && "$@" && 2>/dev/null
+-eu x=1 ${HOME} "$1" 2>/dev/null awk test local 2>/dev/null
+'quoted text' -eu cd then
+	then readonly local done awk printf
+		local readonly test -eu test 'quoted text'
+	&& done local "$1" echo
+$(pwd) readonly 'quoted text' sed cd sed --verbose x=1 2>/dev/null
+sed -eu cd sed --verbose x=1 then --verbose /usr/bin awk 'quoted text'
+${HOME} grep readonly && $(pwd) then 2>/dev/null /usr/bin | done
+		test awk --verbose local 2>/dev/null
+sed printf x=1 grep cd
+		test export local 2>/dev/null --verbose $(pwd) "$1" $(pwd)
+	cd grep ${HOME} grep awk $(pwd) x=1 && -eu grep done local done echo awk --verbose
+		-eu cd awk ${HOME} printf &&
+		done sed echo && "$1" done "$@" readonly
+x=1 "$1" 2>/dev/null | && then 2>/dev/null export readonly 2>/dev/null 2>/dev/null
+test cd /usr/bin done then ${HOME} then "$1" 'quoted text' &&
+		${HOME} done awk -eu 2>/dev/null grep x=1 export
+	test echo awk x=1 awk "$1" echo echo ${HOME} && printf
+		/usr/bin "$1" cd export "$@" test -eu awk 'quoted text'
+local | -eu $(pwd) cd local /usr/bin x=1
+	&& | readonly --verbose
+	printf $(pwd) -eu -eu export x=1 grep done 'quoted text' sed 'quoted text'
+"$1" --verbose test sed 'quoted text' "$1"
+--verbose sed && x=1 sed then --verbose echo ${HOME} sed awk readonly -eu export
+	$(pwd) --verbose done local 'quoted text' then
+	--verbose done awk 'quoted text' echo x=1 ${HOME} done readonly |
+	done x=1 readonly "$1" done && 'quoted text' grep
+	export grep /usr/bin ${HOME} 2>/dev/null | grep "$@" && test done printf then
+readonly awk 2>/dev/null readonly readonly done && x=1 2>/dev/null printf /usr/bin
+		-eu awk 2>/dev/null echo printf 2>/dev/null sed export "$1" --verbose
+printf && $(pwd) $(pwd)
+		local $(pwd) ${HOME} export 'quoted text' then then test cd
+	cd 2>/dev/null x=1 local $(pwd)
+		'quoted text' printf /usr/bin -eu printf grep awk printf printf
+	grep x=1 && sed "$@" -eu awk ${HOME} ${HOME} then
+	awk export 2>/dev/null 2>/dev/null $(pwd)
+		${HOME} done ${HOME} test /usr/bin 'quoted text'
+/usr/bin ${HOME} cd 2>/dev/null x=1 then /usr/bin grep 'quoted text'
+	readonly readonly -eu ${HOME} --verbose x=1 done done && $(pwd) "$@" local
+		test 'quoted text' test x=1 && "$@" -eu
+	grep x=1 ${HOME} $(pwd) test export sed $(pwd) export
+		then --verbose printf then local cd printf 'quoted text'
+then && sed readonly /usr/bin
+	"$@" ${HOME} "$@" -eu sed && local printf local
+		-eu 'quoted text' $(pwd) printf "$1"
+	x=1 $(pwd) /usr/bin local --verbose sed 2>/dev/null && done
+| cd | /usr/bin echo test $(pwd) then "$1" 'quoted text' --verbose
+	sed awk readonly echo echo &&
+		test "$1" cd then test then $(pwd) done test "$1" && cd printf
+${HOME} x=1 | --verbose --verbose cd "$1" "$@" 2>/dev/null cd done then
+awk | readonly done printf
+		'quoted text' printf "$1" done "$@" && then local readonly test test echo &&
+	2>/dev/null /usr/bin 'quoted text' --verbose ${HOME}
+	--verbose "$1" done /usr/bin readonly
+local --verbose cd ${HOME} grep local | "$@" test x=1 -eu test 'quoted text'
+grep printf sed then $(pwd)
+		cd | done x=1 | export readonly local cd ${HOME}
+${HOME} 'quoted text' awk x=1 && then cd done echo ${HOME} --verbose
+	export ${HOME} grep echo echo "$1" export done ${HOME} x=1 --verbose
+	readonly "$1" ${HOME} local "$1" cd sed "$1"
+echo done | awk ${HOME}
+		export ${HOME} cd ${HOME}
+sed && "$1" test -eu sed grep | readonly /usr/bin test printf grep test
+		grep --verbose /usr/bin --verbose && $(pwd) -eu done then "$@" && local
+local | readonly then "$@" --verbose test --verbose printf
+| then sed $(pwd) "$1" /usr/bin done done echo 2>/dev/null cd export
+	printf printf cd x=1 && | local echo grep ${HOME}
+then done export cd | $(pwd) $(pwd) then echo export 2>/dev/null then cd
+		&& $(pwd) -eu --verbose readonly x=1 echo $(pwd) 'quoted text' 2>/dev/null
+	${HOME} --verbose export $(pwd) "$@" done echo printf -eu sed
+	${HOME} export export sed done grep ${HOME}
+--verbose awk awk awk && "$1" awk awk grep done local 'quoted text'
+	${HOME} /usr/bin local $(pwd) x=1
+	"$@" "$1" x=1 ${HOME} x=1 then awk echo export 'quoted text'
+	"$@" /usr/bin "$1" ${HOME} readonly
+	/usr/bin | ${HOME} 'quoted text' /usr/bin
+		echo "$1" /usr/bin --verbose printf then -eu then 'quoted text' "$1" export --verbose
+2>/dev/null x=1 $(pwd) ${HOME} $(pwd) grep x=1 sed awk done
+| $(pwd) echo --verbose | sed ${HOME} /usr/bin "$1" "$@" --verbose
+	sed readonly x=1 export sed "$@" /usr/bin export && --verbose
+	then -eu $(pwd) ${HOME} awk cd ${HOME} grep x=1 'quoted text' awk 'quoted text'
+		x=1 $(pwd) readonly grep then --verbose done sed
+-eu awk x=1 test done --verbose "$@" echo ${HOME} echo done
+		export /usr/bin grep --verbose awk cd /usr/bin
+		x=1 | awk grep 2>/dev/null cd sed test /usr/bin printf -eu echo grep
+		"$@" /usr/bin awk x=1 /usr/bin test 2>/dev/null x=1 -eu x=1 readonly
+	export sed cd local $(pwd) -eu | ${HOME}
+	readonly /usr/bin local
+then local /usr/bin -eu sed grep done export then awk $(pwd)
+	$(pwd) cd "$@" | x=1 sed printf local awk && x=1 "$@" $(pwd) "$1" x=1 "$@" x=1
+	local local then 2>/dev/null 'quoted text' $(pwd)
+cd "$@" "$@" done readonly $(pwd) readonly x=1
+"$1" "$@" ${HOME} 2>/dev/null
+cd local $(pwd) echo local x=1 x=1 grep local awk -eu export cd &&
+"$1" done sed | test
+done echo export then --verbose
+	test && --verbose test sed
+test readonly "$@" && ${HOME} --verbose export then local |
+	$(pwd) "$1" readonly done | $(pwd) &&
+		--verbose 'quoted text' local done grep --verbose export test "$@" "$@" /usr/bin
+echo "$1" --verbose x=1 cd | readonly done --verbose
+	| "$@" export /usr/bin | export "$@" 2>/dev/null -eu
+	echo /usr/bin export awk 'quoted text' /usr/bin test sed -eu grep
+	'quoted text' test readonly export
+		then cd echo test readonly done done $(pwd) x=1 cd "$1" echo && /usr/bin done
+echo $(pwd) && 'quoted text' /usr/bin --verbose awk test | echo echo
+	x=1 done /usr/bin cd grep echo grep /usr/bin --verbose && sed sed printf $(pwd)
+		done /usr/bin "$@" awk awk | 2>/dev/null &&
+	then awk then echo "$@" printf -eu "$@" awk cd readonly "$1" 2>/dev/null
+		local local 2>/dev/null then printf readonly /usr/bin
+/usr/bin local "$@" && printf x=1 'quoted text' then readonly awk printf
+	$(pwd) -eu -eu then readonly export echo 'quoted text' readonly
+	readonly | x=1 $(pwd) $(pwd) local export readonly readonly && export awk sed
+		/usr/bin test printf readonly -eu export | local done local -eu readonly sed
+--verbose "$1" test printf echo 'quoted text' "$1" "$1" 2>/dev/null
+		grep readonly readonly sed 'quoted text'
+		cd then printf && readonly test echo readonly x=1 $(pwd) echo $(pwd)
+test printf local -eu printf /usr/bin --verbose
+cd awk | 'quoted text' --verbose | grep local test | "$@" sed local | printf &&
+"$@" x=1 awk $(pwd) local $(pwd) printf awk
+'quoted text' | x=1 'quoted text' x=1
+		echo readonly export "$@" export 2>/dev/null $(pwd) 2>/dev/null sed | 2>/dev/null
+	test grep sed && "$@" $(pwd) grep x=1 cd awk
+	/usr/bin && then then cd awk 'quoted text' ${HOME} grep ${HOME} "$@" x=1 2>/dev/null
+	done grep sed printf export 2>/dev/null 'quoted text'
+	$(pwd) -eu -eu sed $(pwd) /usr/bin then test local then printf
+export && test "$1" awk --verbose echo x=1
+		"$@" grep done -eu | "$@" awk $(pwd) --verbose test "$1" x=1 2>/dev/null
+		local | sed cd $(pwd) /usr/bin ${HOME} sed local local &&
+cd 'quoted text' -eu export -eu "$@" 'quoted text' grep | readonly test export
+readonly -eu $(pwd) -eu readonly 2>/dev/null | ${HOME} "$@" ${HOME}
+	$(pwd) && | local 'quoted text' done && test "$@" done test test grep grep &&
+		awk local --verbose "$@" awk test
+	cd $(pwd) --verbose /usr/bin $(pwd)
+	readonly grep --verbose done echo echo x=1 done && /usr/bin local ${HOME}
+		awk ${HOME} -eu then echo printf ${HOME} readonly
+x=1 ${HOME} sed done printf | x=1 printf "$@" ${HOME}
+${HOME} printf -eu awk ${HOME} 2>/dev/null "$@" x=1 --verbose readonly -eu
+		/usr/bin grep 'quoted text' grep local local printf test
+	"$1" printf cd cd awk cd readonly
+		cd --verbose cd cd sed local $(pwd) --verbose
+2>/dev/null test readonly printf awk ${HOME} "$@" readonly
+		grep -eu echo 2>/dev/null $(pwd) readonly done
+	grep readonly awk | ${HOME} "$1" cd 2>/dev/null
+		x=1 cd $(pwd) "$@" 2>/dev/null export test
+		local ${HOME} /usr/bin 2>/dev/null 'quoted text' export
+	$(pwd) && && --verbose then echo 2>/dev/null --verbose
+		/usr/bin cd then --verbose /usr/bin
+		"$@" awk export sed readonly echo && | echo /usr/bin test
+grep "$1" cd 'quoted text' printf ${HOME} cd -eu printf 'quoted text'
+	local readonly "$1" export | --verbose x=1 "$1" $(pwd) && /usr/bin | awk
+		echo /usr/bin "$@" --verbose cd awk export $(pwd) | -eu 2>/dev/null sed readonly
+	export echo readonly /usr/bin "$@"
+	"$1" $(pwd) | && 2>/dev/null /usr/bin export "$1" && readonly
+	| -eu done | | export printf
+		grep --verbose test "$@" /usr/bin ${HOME} ${HOME}
+	"$@" test echo then readonly $(pwd) awk |
+2>/dev/null export echo 2>/dev/null export cd x=1 test
+local printf | then printf 'quoted text' "$1" /usr/bin
+	'quoted text' | /usr/bin $(pwd) grep
+	$(pwd) --verbose echo done test 'quoted text'
+${HOME} then grep 2>/dev/null local
+		${HOME} -eu export grep sed grep x=1 local local grep done
+	"$@" awk $(pwd) grep -eu "$@" $(pwd) "$@" readonly 'quoted text'
+	printf awk export --verbose readonly
+		/usr/bin export | /usr/bin sed ${HOME} echo $(pwd) "$@" 2>/dev/null 2>/dev/null
+&& local && | awk -eu 2>/dev/null done done -eu printf local then
+sed export 2>/dev/null --verbose ${HOME} 'quoted text'
+/usr/bin 2>/dev/null grep 2>/dev/null x=1 --verbose $(pwd) && ${HOME} printf awk
+		x=1 $(pwd) 'quoted text' -eu printf x=1 then cd "$@" readonly sed awk "$1" readonly
+'quoted text' done sed 'quoted text' done "$@" echo 2>/dev/null 'quoted text'
+		awk sed 'quoted text' 2>/dev/null 'quoted text'
+	/usr/bin readonly /usr/bin 2>/dev/null then awk $(pwd) done
+	"$@" cd 'quoted text'
+		export ${HOME} done sed
+	| local printf 2>/dev/null test done grep local
+		2>/dev/null $(pwd) /usr/bin
+		sed -eu 2>/dev/null && 'quoted text' ${HOME} cd
+test cd ${HOME} 2>/dev/null echo local ${HOME} readonly $(pwd)
+	test 'quoted text' sed "$@" $(pwd)
+		then --verbose local ${HOME} --verbose ${HOME} --verbose -eu
+		'quoted text' printf "$1" awk done readonly echo ${HOME} 2>/dev/null export
+		--verbose --verbose |
+grep done readonly && local printf grep x=1 cd 2>/dev/null local
+		2>/dev/null "$@" 2>/dev/null readonly awk --verbose x=1
+	-eu sed readonly readonly | -eu sed $(pwd)
+-eu local $(pwd) test test --verbose cd 'quoted text' cd "$1" $(pwd)
+then 2>/dev/null -eu "$1"
+	--verbose export "$@" cd readonly "$1" test
+		awk readonly /usr/bin
+	'quoted text' ${HOME} "$1" done then && sed cd && $(pwd) $(pwd) x=1 test export
+		"$1" readonly -eu local awk grep --verbose grep $(pwd) 'quoted text'
+| cd local awk /usr/bin
+	sed "$1" grep grep x=1 done | grep
+readonly readonly grep $(pwd) readonly printf done ${HOME}
+export cd cd grep "$1" cd printf 2>/dev/null -eu printf $(pwd)
+	then export test awk --verbose /usr/bin echo
+		readonly then 2>/dev/null awk export ${HOME} printf then x=1 $(pwd) printf
+	"$@" && "$1" local grep cd
+x=1 sed test then 'quoted text' "$1" 'quoted text' "$@" && echo | cd awk /usr/bin
+		local sed cd local printf "$@" done 'quoted text' $(pwd) x=1 && readonly
+		cd -eu 2>/dev/null "$@" test cd $(pwd) "$@" export test -eu readonly | sed
+-eu readonly 2>/dev/null local done "$1" readonly
+printf local awk sed 'quoted text' --verbose -eu awk "$@" 'quoted text'
+		echo ${HOME} $(pwd) printf
+		done x=1 ${HOME} -eu "$@" ${HOME} grep sed local $(pwd) done awk /usr/bin printf
+$(pwd) then --verbose $(pwd) test --verbose readonly local printf export awk
+2>/dev/null echo -eu && awk sed then local "$@" then then readonly awk done
+	'quoted text' && export echo readonly printf export $(pwd)
+&& test $(pwd) export $(pwd)
+x=1 then $(pwd) 2>/dev/null cd then sed && 2>/dev/null test
+		awk cd $(pwd) $(pwd) "$1" export -eu
+		echo grep local then -eu
+		2>/dev/null printf $(pwd) export x=1 --verbose then printf
+x=1 test readonly /usr/bin
+		x=1 "$1" x=1 --verbose --verbose
+$(pwd) | --verbose "$@" test done "$1" 2>/dev/null printf 'quoted text'
+echo printf ${HOME} then 'quoted text'
+"$1" | | 2>/dev/null /usr/bin
+		done && printf awk | cd --verbose
+	"$1" printf -eu /usr/bin ${HOME} "$1"
+readonly done 2>/dev/null echo && awk
+		export grep "$1" -eu export
+		grep x=1 then 'quoted text' -eu cd printf echo "$@"
+		x=1 local then 'quoted text' echo
+	| -eu readonly awk readonly --verbose export cd printf test
+	grep test printf "$@" && printf test -eu 2>/dev/null
+		/usr/bin cd sed "$@" printf
+		test /usr/bin local cd export "$@" printf x=1 'quoted text' local ${HOME}
+cd /usr/bin done readonly $(pwd) $(pwd)
+		done --verbose -eu && --verbose 2>/dev/null
+		$(pwd) readonly sed test ${HOME} --verbose grep ${HOME}
+	grep x=1 | 'quoted text' test readonly
+		2>/dev/null --verbose 2>/dev/null echo 'quoted text'
+		&& 'quoted text' --verbose then ${HOME} | then export export
+		done --verbose --verbose
+'quoted text' ${HOME} sed printf export test echo --verbose 'quoted text' cd
+	grep awk ${HOME} "$@" cd $(pwd) "$@" export
+	x=1 /usr/bin x=1 /usr/bin 2>/dev/null done 'quoted text' "$1"
+--verbose 'quoted text' then | 'quoted text' && test /usr/bin export
+'quoted text' 2>/dev/null | "$1" readonly
+| cd "$1" && ${HOME} ${HOME} 2>/dev/null
+	'quoted text' -eu "$@" export --verbose "$@" -eu
+		awk grep "$@" printf 'quoted text' done grep /usr/bin cd grep
+-eu -eu awk /usr/bin 2>/dev/null -eu sed 2>/dev/null
+		"$1" 'quoted text' echo /usr/bin readonly export
+| done done 'quoted text' cd --verbose readonly done
+	sed && /usr/bin 'quoted text' 'quoted text' printf
+		done "$@" awk export then --verbose sed readonly 2>/dev/null 2>/dev/null ${HOME}
+	test grep "$1" /usr/bin --verbose 'quoted text'
+	x=1 grep && readonly | --verbose cd -eu export -eu awk -eu printf
+	x=1 | "$@" -eu export test $(pwd) readonly awk 2>/dev/null "$@" done 2>/dev/null
+then --verbose awk local -eu cd ${HOME} ${HOME} local -eu /usr/bin grep | cd $(pwd)
+	--verbose test cd -eu /usr/bin cd sed 'quoted text' -eu 2>/dev/null
+		| "$1" cd test export -eu
+$(pwd) grep 2>/dev/null -eu grep export /usr/bin echo &&
+&& $(pwd) grep awk export cd
+x=1 export done "$@" test --verbose
+'quoted text' 'quoted text' ${HOME} | readonly local $(pwd) "$1" -eu 'quoted text'
+'quoted text' test -eu && 'quoted text' grep ${HOME} x=1 export
+grep sed 'quoted text' export then test done x=1 awk then -eu test done -eu
+		sed x=1 export test printf test $(pwd) /usr/bin
+		${HOME} then "$1" awk readonly readonly
+		readonly "$@" printf echo done sed --verbose
+printf done readonly test sed x=1 "$1" "$@" && && grep 'quoted text'
+	2>/dev/null x=1 2>/dev/null
+		cd | x=1 printf done done --verbose local echo cd "$@" x=1 "$1" readonly
+	"$@" x=1 test readonly readonly /usr/bin ${HOME}
+	/usr/bin local $(pwd) sed local
+		done export && "$@" ${HOME} ${HOME}
+test && cd test x=1 printf local cd /usr/bin && readonly readonly
+	printf done && x=1 then
+	&& x=1 done x=1 local "$1" readonly grep
+		echo 2>/dev/null 2>/dev/null export $(pwd) "$1" |
+	| x=1 'quoted text' sed awk readonly
+awk $(pwd) x=1 readonly $(pwd) "$1" test test test readonly "$@" && printf readonly
+"$1" ${HOME} sed test ${HOME} readonly
+"$1" ${HOME} 'quoted text' test readonly export export grep --verbose
+	'quoted text' sed --verbose
+		${HOME} /usr/bin x=1 sed cd && 'quoted text'
+	local readonly then echo ${HOME} local 2>/dev/null test |
+		sed test 'quoted text' readonly $(pwd) -eu "$@" --verbose | $(pwd)
+		printf readonly 'quoted text' --verbose
+printf && done $(pwd) "$@" grep grep /usr/bin $(pwd) /usr/bin echo
+	echo ${HOME} "$1" then then done "$@" -eu $(pwd) &&
+'quoted text' local printf echo echo "$@" cd done -eu done /usr/bin grep
+	"$1" local && -eu export ${HOME} 2>/dev/null
+		$(pwd) && export done then export --verbose 2>/dev/null done && /usr/bin
+	sed | 2>/dev/null /usr/bin -eu awk local readonly /usr/bin 'quoted text' echo test
+	cd then "$1" 2>/dev/null x=1 local done
+${HOME} /usr/bin 2>/dev/null export grep then grep /usr/bin
+	printf echo test done 2>/dev/null done "$1" "$@" sed "$@"
+		sed done 'quoted text' readonly 2>/dev/null
+2>/dev/null export && sed | 2>/dev/null "$@" test readonly
+	grep printf ${HOME} $(pwd) sed
+x=1 cd x=1 grep readonly readonly
+		"$1" 2>/dev/null x=1 awk printf
+	export | awk --verbose test readonly
+	sed x=1 "$1" test x=1 echo awk sed done awk echo --verbose
+		${HOME} 'quoted text' readonly "$1" sed done "$@" readonly --verbose 'quoted text'
+	"$1" /usr/bin ${HOME} test test -eu done "$@" done $(pwd) x=1 -eu --verbose printf
+		echo local done "$@" done x=1 printf x=1 done && x=1
+		local then "$1" $(pwd) | "$1" test | test grep echo local -eu ${HOME}
+2>/dev/null awk then -eu 'quoted text' --verbose && local printf test && grep cd
+		then grep awk $(pwd) grep
+	then echo export $(pwd) /usr/bin test test | --verbose echo done test
+	awk test awk ${HOME} done export test then x=1 /usr/bin test
+--verbose echo sed $(pwd) 2>/dev/null
+		"$1" --verbose awk awk done
+2>/dev/null done cd then awk "$1" "$1"
+readonly done 'quoted text' -eu readonly "$1" /usr/bin printf && done cd 'quoted text'
+		test -eu && 2>/dev/null readonly && --verbose --verbose --verbose echo cd local
+	then readonly awk grep export
+printf export "$@" 'quoted text' /usr/bin x=1
+"$@" 2>/dev/null local cd printf grep x=1 grep sed 2>/dev/null readonly
+'quoted text' export && awk "$1" test -eu --verbose grep sed printf x=1
+	--verbose $(pwd) readonly x=1 sed export echo export test
+	/usr/bin -eu printf echo readonly printf "$@" /usr/bin -eu /usr/bin echo x=1 $(pwd)
+$(pwd) local printf grep /usr/bin 2>/dev/null printf export x=1 2>/dev/null
+	$(pwd) -eu then sed | "$1"
+${HOME} $(pwd) sed test done then ${HOME} readonly | readonly
+	2>/dev/null $(pwd) done $(pwd) /usr/bin /usr/bin
+cd test cd && x=1 && test
+		--verbose sed | local | | |
+	readonly 2>/dev/null "$1" --verbose /usr/bin
+	&& local local 2>/dev/null done "$1" echo --verbose readonly | 2>/dev/null
+		printf echo test grep grep export -eu --verbose local echo grep grep cd ${HOME}
+awk x=1 "$1" then x=1 x=1 -eu "$1" --verbose $(pwd) export x=1 "$@"
+/usr/bin && then -eu printf grep && echo -eu awk "$1" then | x=1 printf --verbose
+		awk then "$@" cd done 2>/dev/null
+	printf -eu -eu test done cd export ${HOME} 2>/dev/null x=1 local
+	done && /usr/bin $(pwd) "$@" awk
+	${HOME} -eu ${HOME} /usr/bin
+		/usr/bin test 'quoted text' -eu echo
+	&& && $(pwd) done export && awk
+grep $(pwd) "$@" && local readonly done x=1 && ${HOME} local
+x=1 ${HOME} /usr/bin sed done sed 'quoted text' 2>/dev/null "$1" -eu "$@"
+&& --verbose && cd -eu sed && awk "$1" ${HOME} 'quoted text'
+	"$@" printf /usr/bin && test export "$1" test -eu done
+--verbose 'quoted text' cd 2>/dev/null cd $(pwd)
+x=1 local 2>/dev/null "$1" done echo &&
+		2>/dev/null cd awk 2>/dev/null echo /usr/bin ${HOME} printf export
+		awk $(pwd) cd done | && && --verbose 2>/dev/null
+	x=1 awk cd | x=1 --verbose 2>/dev/null "$@" test
+		$(pwd) readonly 'quoted text'
+		done export then $(pwd) --verbose test export --verbose -eu awk then ${HOME} -eu
+readonly test cd /usr/bin && $(pwd) x=1 --verbose /usr/bin
+awk export x=1 | ${HOME} readonly done readonly "$1" -eu local -eu
+		export /usr/bin ${HOME} "$1" -eu
+		done done && then export
+--verbose sed ${HOME} printf && /usr/bin grep test then
+	grep && then grep then -eu "$1" 2>/dev/null ${HOME} -eu
+$(pwd) "$1" && done /usr/bin then sed readonly echo sed local --verbose
+	$(pwd) | sed 'quoted text' x=1 x=1 done $(pwd) "$1" 2>/dev/null then
+		$(pwd) test "$1" "$1" "$@" "$@" cd -eu /usr/bin then cd test "$@" echo sed &&
+	test readonly 2>/dev/null done /usr/bin echo 2>/dev/null -eu "$1" export cd
+done /usr/bin test $(pwd)
+		-eu --verbose "$1" export
+	--verbose cd | cd then local done readonly "$@" printf ${HOME} --verbose $(pwd)
+'quoted text' sed grep ${HOME} $(pwd) "$@" grep echo sed 'quoted text'
+	export done | 'quoted text' grep sed x=1 2>/dev/null 2>/dev/null
+	local export && /usr/bin ${HOME} && -eu printf /usr/bin -eu 2>/dev/null
+	$(pwd) export test cd done awk "$@" cd $(pwd) local printf export
+	grep /usr/bin 2>/dev/null --verbose /usr/bin local awk then readonly awk then
+echo test printf test sed then x=1 cd 'quoted text'
+	awk | cd 2>/dev/null local local | awk "$@" printf then -eu 'quoted text'
+		2>/dev/null "$1" done "$1" sed "$1" 2>/dev/null export
+cd "$@" readonly sed then -eu printf printf 'quoted text' then 'quoted text'
+x=1 | "$@" grep cd done --verbose test --verbose $(pwd) /usr/bin grep test
+sed awk "$1" readonly done sed --verbose grep "$@" x=1 x=1 readonly test readonly
+	"$1" readonly awk /usr/bin && then "$1" awk
+	readonly awk cd "$@" /usr/bin "$@" local
+	test export local x=1 x=1 test "$@" /usr/bin
+then "$1" awk 2>/dev/null awk "$1" x=1 && echo /usr/bin
+	'quoted text' ${HOME} local
+		&& done x=1 'quoted text' echo /usr/bin $(pwd) &&
+	sed -eu grep grep | cd export x=1 "$1" $(pwd) export 'quoted text'
+2>/dev/null sed local cd export export printf "$1" 2>/dev/null "$1" awk local
+		${HOME} done && --verbose -eu readonly
+		&& x=1 && 2>/dev/null sed test ${HOME}
+	awk -eu 'quoted text' --verbose | x=1 awk 2>/dev/null printf
+	test /usr/bin cd export 'quoted text'
+	sed | -eu /usr/bin grep 2>/dev/null
+		grep && -eu ${HOME} cd echo |
+echo -eu --verbose | then grep echo
+		readonly x=1 readonly sed done | readonly export
+		readonly ${HOME} && test sed test /usr/bin awk /usr/bin then && "$@"
+export printf sed test grep -eu awk cd x=1 && 'quoted text' 'quoted text'
+sed cd x=1 then "$@" --verbose echo grep test | printf
+-eu "$1" "$1" grep then then readonly cd /usr/bin /usr/bin
+	--verbose 2>/dev/null -eu cd /usr/bin
+		cd 'quoted text' -eu x=1 | then awk /usr/bin x=1 export cd /usr/bin export
+echo sed export "$@" readonly -eu printf readonly "$@" printf --verbose
+export test 2>/dev/null done
+&& --verbose $(pwd) "$@" export test done --verbose done cd grep /usr/bin done
+	&& 'quoted text' done cd test test
+		&& sed | then test 'quoted text' cd awk printf /usr/bin -eu --verbose 'quoted text'
+		echo ${HOME} 'quoted text' test printf export echo readonly
+x=1 local --verbose grep
+		| export ${HOME} "$@" awk local x=1 then x=1 then &&
+local sed export | local && /usr/bin local | -eu $(pwd) readonly readonly
+		'quoted text' printf export | 2>/dev/null | awk
+cd 2>/dev/null --verbose readonly sed then ${HOME} cd export
+		--verbose sed done /usr/bin echo export x=1 test then && --verbose "$@" 2>/dev/null
+export then --verbose awk cd | x=1 cd 'quoted text' cd -eu echo ${HOME}
+	export $(pwd) && awk echo
+		2>/dev/null -eu export
+$(pwd) -eu "$@" local 'quoted text' $(pwd) | cd sed local
+	&& $(pwd) cd 2>/dev/null ${HOME} "$1" "$1"
+		then $(pwd) done export sed grep echo && "$1"
+		local export sed echo $(pwd) | sed
+		"$@" awk then echo /usr/bin 'quoted text' && sed test readonly
+	${HOME} local --verbose && -eu echo readonly awk -eu
+		local ${HOME} "$1" /usr/bin readonly
+	sed -eu --verbose readonly 2>/dev/null 'quoted text'
+	local x=1 $(pwd) grep sed ${HOME} grep --verbose
+	"$1" local grep 'quoted text' | 'quoted text' grep readonly --verbose
+	readonly readonly && ${HOME} local printf --verbose
+-eu sed /usr/bin echo ${HOME} export local grep 2>/dev/null -eu export "$@" --verbose
+		--verbose sed /usr/bin "$@" echo cd done test "$@" $(pwd) | && x=1 export
+--verbose ${HOME} --verbose test ${HOME}
+readonly $(pwd) "$@" echo "$@" test 'quoted text' grep
+		echo "$@" "$1" readonly x=1 awk cd
+x=1 'quoted text' then then ${HOME} grep readonly done 2>/dev/null
+		awk export 2>/dev/null local && readonly /usr/bin && ${HOME} $(pwd)
+export echo cd 'quoted text' test "$1" ${HOME} cd test export readonly
+		2>/dev/null echo readonly local grep --verbose |
+	/usr/bin export $(pwd) export | local
+"$1" | sed cd printf export x=1 ${HOME} | x=1 && ${HOME} x=1 "$1" "$1" /usr/bin
+then -eu echo $(pwd) test export local cd 'quoted text' && test grep readonly
+		readonly --verbose /usr/bin 2>/dev/null test /usr/bin
+		--verbose /usr/bin readonly printf test -eu x=1 && "$1" 'quoted text'
+awk 2>/dev/null local export /usr/bin local "$1" "$1" local cd
+	printf 2>/dev/null 'quoted text' /usr/bin
+	&& 2>/dev/null readonly "$@" export 2>/dev/null -eu ${HOME} ${HOME}
+printf $(pwd) -eu grep then -eu printf "$1" then cd echo done printf
+		'quoted text' awk cd --verbose echo /usr/bin 2>/dev/null /usr/bin --verbose
+'quoted text' local done x=1 /usr/bin done echo "$@" ${HOME} cd | $(pwd)
+export printf done "$@" $(pwd) && export test 2>/dev/null --verbose echo export
+then local /usr/bin then && /usr/bin
+"$@" 'quoted text' cd ${HOME} then done /usr/bin cd --verbose --verbose readonly
+		cd awk test "$1" /usr/bin readonly export awk /usr/bin export /usr/bin
+	local x=1 "$1" && && $(pwd) echo $(pwd) 'quoted text' test then test
+"$1" done $(pwd) 2>/dev/null "$1" ${HOME} grep echo sed echo x=1 readonly
+	printf local readonly | "$1" --verbose
+	then --verbose && grep test cd "$@" sed
+	local test printf && && printf echo "$@" cd cd sed echo $(pwd)
+	cd /usr/bin -eu local cd printf sed printf --verbose 'quoted text'
+test then ${HOME} "$@" echo /usr/bin echo printf ${HOME} &&
+x=1 /usr/bin $(pwd) --verbose grep local | cd -eu echo sed readonly
+$(pwd) $(pwd) 'quoted text' grep 2>/dev/null 'quoted text'
+$(pwd) ${HOME} 'quoted text' "$1" /usr/bin $(pwd) "$1"
+	test readonly ${HOME} then | then x=1
+	$(pwd) export export readonly cd then /usr/bin | -eu local then then then -eu
+done $(pwd) printf "$1"
+then 2>/dev/null && local then /usr/bin
+x=1 echo export export "$1" | 'quoted text' then grep "$@"
+		-eu | readonly x=1 'quoted text' "$@" 'quoted text'
+	2>/dev/null grep | $(pwd) && awk
+		| cd done x=1 2>/dev/null echo
+"$@" export done printf then "$1" --verbose printf test export x=1
+cd && && $(pwd) && | local 2>/dev/null 2>/dev/null
+		awk ${HOME} | export sed 2>/dev/null 2>/dev/null done
+cd cd /usr/bin | printf cd awk ${HOME} --verbose cd -eu cd ${HOME}
+test done printf local echo --verbose "$1" $(pwd) readonly cd 2>/dev/null
+echo grep cd echo ${HOME} printf echo "$1" cd awk --verbose then --verbose
+awk local -eu readonly grep then
+		${HOME} echo /usr/bin "$1" sed "$@" "$1" $(pwd) /usr/bin "$1" "$1" done
+		/usr/bin awk sed echo "$@"
+		done awk sed done grep echo readonly local
+	/usr/bin 2>/dev/null --verbose 'quoted text'
+	"$@" x=1 ${HOME} $(pwd) 2>/dev/null done $(pwd) printf then "$1" done
+		local 2>/dev/null sed grep done -eu
+		| 'quoted text' "$1" "$1" sed /usr/bin
+		-eu x=1 test readonly /usr/bin "$@" test test $(pwd)
+		/usr/bin local sed local && then 2>/dev/null grep -eu readonly then
+		awk "$@" -eu ${HOME} grep "$@" ${HOME}
+		grep 2>/dev/null sed --verbose ${HOME} test --verbose
+	readonly then $(pwd) -eu cd
+		local sed local --verbose printf 2>/dev/null sed "$@" $(pwd) test readonly
+export ${HOME} echo ${HOME} /usr/bin test
+	done echo "$@" | ${HOME} 'quoted text' local echo -eu ${HOME}
+		printf -eu "$1" done | -eu "$@" test cd ${HOME}
+| --verbose done local x=1 echo cd
+/usr/bin readonly done
+	/usr/bin --verbose "$1" "$@" | printf
+x=1 $(pwd) test $(pwd) $(pwd) "$@" | test grep
+		local printf test grep $(pwd) printf --verbose
+"$1" --verbose readonly "$1" readonly "$@" awk cd ${HOME} x=1
+$(pwd) test "$@" cd awk awk -eu
+done cd "$1" readonly ${HOME} --verbose -eu x=1
+-eu printf export awk cd export echo | printf -eu --verbose test -eu /usr/bin
+	| sed -eu -eu && sed printf $(pwd) readonly "$@" ${HOME} | cd cd then 'quoted text'
+		"$@" /usr/bin 2>/dev/null | 'quoted text' ${HOME} then /usr/bin
+	"$1" grep 'quoted text' "$1" printf grep "$1" /usr/bin
+	"$1" x=1 $(pwd) done cd test && then cd | cd "$1" cd local $(pwd) export done
+	test /usr/bin "$1" --verbose x=1 $(pwd) /usr/bin x=1 --verbose
+		${HOME} export x=1 $(pwd) export -eu 2>/dev/null
+		"$1" local ${HOME} awk test readonly then "$1" 'quoted text' $(pwd)
+		| 'quoted text' echo --verbose 2>/dev/null done && $(pwd) x=1
+	"$1" -eu export then then | grep cd test && /usr/bin echo "$@" awk then $(pwd)
+		export --verbose --verbose 2>/dev/null export echo "$1" readonly
+	echo test && awk local
+		done ${HOME} "$1" -eu | $(pwd) $(pwd) "$@" printf x=1
+$(pwd) test sed cd 'quoted text' echo awk test | /usr/bin local readonly grep
+		-eu && awk $(pwd) grep sed sed ${HOME} x=1 && grep "$1" local then
+	then cd $(pwd) echo done
+	cd printf /usr/bin test done x=1 test $(pwd) 2>/dev/null "$1"
+	local $(pwd) /usr/bin printf readonly cd "$1"
+	local grep 2>/dev/null sed awk 'quoted text' done x=1 --verbose
+sed $(pwd) then | echo printf then then echo "$1" "$@" done grep grep ${HOME}
+"$@" /usr/bin then | printf test cd awk test sed | &&
+-eu readonly printf awk "$@" 'quoted text' --verbose 'quoted text'
+test cd "$1" printf ${HOME} cd sed "$@" && -eu /usr/bin grep readonly
+readonly --verbose x=1 sed
+		export -eu printf grep printf
+&& test x=1 cd readonly echo printf --verbose /usr/bin local x=1
+	${HOME} ${HOME} "$1" 'quoted text' test --verbose
+	export -eu "$@" ${HOME} sed printf && grep cd grep test awk then
+	grep -eu readonly | export -eu ${HOME} 2>/dev/null local printf
+	echo 2>/dev/null export | awk sed /usr/bin test 'quoted text'
+grep 2>/dev/null && printf ${HOME}
+"$1" "$1" then --verbose grep --verbose 2>/dev/null awk -eu awk awk -eu
+echo $(pwd) -eu then 'quoted text' cd 2>/dev/null
+"$@" && then $(pwd) then $(pwd) ${HOME} local --verbose && x=1 local then "$@"
+sed 2>/dev/null "$@" printf test grep 'quoted text'
+then awk $(pwd) export echo local $(pwd) x=1 done && x=1 local
+		&& ${HOME} readonly |
+	cd cd $(pwd) --verbose --verbose
+	&& done export | "$1" local
+	x=1 $(pwd) printf printf export "$@" local local
+		"$@" /usr/bin sed | echo 'quoted text' | "$@" -eu ${HOME} cd
+	'quoted text' local grep && local grep "$1" x=1
+	export | /usr/bin "$@" "$1" grep && | echo grep done test printf --verbose test
+		/usr/bin cd ${HOME} grep readonly "$@" /usr/bin awk && grep done -eu -eu echo
+		export done awk 2>/dev/null "$1" done "$1" x=1 export export
+	2>/dev/null 'quoted text' grep test ${HOME} x=1 grep cd grep
+		| "$@" sed grep "$1" -eu grep 2>/dev/null
+2>/dev/null ${HOME} done export sed printf test "$1" cd then
+	grep cd ${HOME} $(pwd) -eu test | echo 2>/dev/null "$@" cd
+		/usr/bin sed x=1 awk && 'quoted text'
+test cd cd echo x=1 local x=1 -eu 'quoted text' -eu cd local awk readonly
+		x=1 done 'quoted text' $(pwd) --verbose
+	echo echo "$1" grep export
+	"$@" sed cd grep -eu x=1 "$1" cd
+		echo done "$1" /usr/bin --verbose cd | ${HOME}
+printf echo awk ${HOME} test
+&& awk -eu "$@" awk cd "$1" test 2>/dev/null local | 'quoted text' "$@"
+	2>/dev/null /usr/bin && "$1" -eu x=1 -eu then --verbose
+	cd export -eu local x=1 export /usr/bin local
+	then sed local done $(pwd) done --verbose "$@" local then
+	test "$1" local echo done "$@" local --verbose
+then -eu test x=1 grep awk local cd echo test "$@" echo export
+done local x=1 | x=1 'quoted text' && $(pwd) && printf export --verbose echo /usr/bin
+		echo test test sed awk "$1" --verbose "$@" printf then "$1"
+		x=1 $(pwd) local local $(pwd) cd done printf --verbose
+	'quoted text' | grep 2>/dev/null echo
+		local grep -eu 2>/dev/null x=1 $(pwd) readonly
+	local "$@" printf "$1" grep
+"$1" done -eu printf export && test then -eu
+	cd /usr/bin --verbose &&
+	| --verbose -eu cd 'quoted text'
+	$(pwd) export printf "$1" $(pwd) | sed /usr/bin
+printf --verbose x=1 test "$1" "$1" export
+		echo echo local printf && then "$@" "$@" grep 'quoted text' export
+	awk "$@" $(pwd) /usr/bin --verbose "$1" x=1 ${HOME} | -eu
+| $(pwd) 2>/dev/null && grep --verbose
+	$(pwd) -eu export 2>/dev/null
+		sed printf export printf
+		test -eu | awk done echo | local readonly 'quoted text' | ${HOME} 2>/dev/null
+${HOME} done /usr/bin 2>/dev/null "$@" then x=1 $(pwd) x=1 $(pwd) readonly --verbose
+		$(pwd) ${HOME} grep --verbose cd /usr/bin --verbose
+	'quoted text' cd awk then $(pwd) test -eu && /usr/bin "$@" $(pwd)
+		2>/dev/null --verbose local done "$@" -eu -eu | awk export printf awk 'quoted text'
+export 2>/dev/null "$@" grep $(pwd) then printf
+		${HOME} 2>/dev/null export --verbose grep "$1" 2>/dev/null export | export
+	&& awk | awk awk grep export
+	local 'quoted text' /usr/bin export readonly test cd grep
+then grep 2>/dev/null | $(pwd) $(pwd) echo $(pwd) export cd then 2>/dev/null
+grep sed 2>/dev/null ${HOME} test readonly local awk cd test
+		then readonly echo 'quoted text' "$@" /usr/bin test readonly
+cd && --verbose ${HOME} sed ${HOME} /usr/bin export && "$@" ${HOME} done $(pwd)
+2>/dev/null --verbose local cd sed "$1" &&
+		local ${HOME} -eu 'quoted text' awk | readonly echo "$1" printf
+	"$@" x=1 ${HOME} "$1"
+	2>/dev/null done sed export &&
+	'quoted text' echo -eu "$1" $(pwd) --verbose /usr/bin printf test printf
+local done awk --verbose "$1" 'quoted text' then sed
+	then x=1 "$@" awk awk local
+	export "$@" -eu grep done x=1 'quoted text' $(pwd) ${HOME} /usr/bin awk
+		readonly "$1" then then printf -eu cd 'quoted text'
+	--verbose awk $(pwd) x=1 readonly
+$(pwd) /usr/bin cd | "$@" "$1"
+		printf x=1 'quoted text' /usr/bin
+	done "$1" "$1" 2>/dev/null -eu x=1
+echo ${HOME} done grep local readonly printf then 'quoted text'
+		printf "$@" && readonly printf sed 2>/dev/null x=1 | x=1 test "$@"
+		awk ${HOME} done printf readonly sed ${HOME} readonly 'quoted text' $(pwd)
+		cd 2>/dev/null ${HOME} --verbose sed 2>/dev/null
+		| "$@" awk readonly && local done /usr/bin $(pwd) |
+sed echo -eu --verbose done "$1" printf | 'quoted text' export && then
+	$(pwd) | $(pwd) test done ${HOME} done done sed awk
+		done "$1" readonly test 2>/dev/null then 'quoted text'
+&& --verbose sed "$1" $(pwd) 'quoted text'
+	-eu -eu | test --verbose 'quoted text' $(pwd)
+	$(pwd) readonly done -eu readonly -eu done "$1"
+	test ${HOME} cd /usr/bin 'quoted text' /usr/bin -eu readonly
+		test -eu | | 2>/dev/null echo printf
+awk echo done cd cd --verbose local "$@" $(pwd) &&
+readonly x=1 readonly $(pwd)
+-eu "$@" --verbose x=1 | done "$1" local export printf
+printf grep $(pwd) && --verbose /usr/bin local 2>/dev/null
+	test "$@" x=1 printf "$1" awk 'quoted text'
+		grep then grep ${HOME} "$1"
+printf /usr/bin /usr/bin x=1 $(pwd) --verbose "$@" $(pwd) cd -eu x=1
+-eu 2>/dev/null "$1" export done then "$@" | ${HOME} $(pwd) x=1 test "$@"
+test test awk export x=1 awk done $(pwd) awk
+	--verbose local export then
+done ${HOME} local test ${HOME} --verbose 2>/dev/null -eu $(pwd)
+local cd done test export cd done 2>/dev/null cd --verbose ${HOME}
+	echo /usr/bin 2>/dev/null cd 'quoted text' awk cd echo readonly
+		| grep "$@" readonly -eu done | export cd x=1
+	awk grep grep "$@" local ${HOME} ${HOME} $(pwd) done done "$@" x=1 readonly
+	printf $(pwd) awk export cd x=1 sed cd echo && ${HOME}
+		-eu sed $(pwd) x=1 -eu 2>/dev/null
+		done export && done printf x=1 "$@" /usr/bin awk
+		/usr/bin echo printf && local
+	-eu local local export | sed --verbose 2>/dev/null grep 'quoted text'
+test 2>/dev/null then x=1 export ${HOME} --verbose
+		${HOME} 'quoted text' echo then printf && $(pwd)
+&& /usr/bin readonly x=1 sed x=1 local done 'quoted text' /usr/bin
+	"$@" then grep done | awk /usr/bin x=1 readonly readonly
+	"$@" x=1 --verbose then local $(pwd)
+2>/dev/null /usr/bin ${HOME} "$@"
+		"$1" ${HOME} x=1 $(pwd) -eu awk && "$1" test readonly | ${HOME} $(pwd)
+	echo --verbose /usr/bin /usr/bin && local -eu test echo local "$@" local "$@"
+--verbose | then "$1" 'quoted text' export 2>/dev/null done ${HOME} -eu
+	then cd printf echo readonly ${HOME} grep "$@" | test grep grep
+&& && $(pwd) local awk grep export sed
+		cd ${HOME} test /usr/bin done --verbose readonly
+		export readonly "$@" $(pwd) 'quoted text' x=1 cd test printf done --verbose x=1
+then awk awk $(pwd) 'quoted text'
+		printf awk | ${HOME} $(pwd) done -eu
+done && local 2>/dev/null done export /usr/bin
+"$1" x=1 then local 'quoted text' | &&
+${HOME} 'quoted text' export "$@" awk ${HOME} cd /usr/bin $(pwd)
+	--verbose then grep /usr/bin | "$@" 'quoted text' cd /usr/bin /usr/bin /usr/bin
+	local then $(pwd) sed readonly export test done x=1 -eu ${HOME} done done
+	local printf export -eu test local readonly && 2>/dev/null
+&& /usr/bin 2>/dev/null readonly | -eu && grep cd sed x=1
+	-eu export ${HOME} grep echo test | grep | local ${HOME}
+		printf "$@" then cd grep echo
+	then 'quoted text' "$@" test -eu grep
+then sed done --verbose awk "$@" x=1 -eu
+	done && --verbose test 'quoted text'
+	-eu && ${HOME} | readonly awk 2>/dev/null --verbose
+	-eu --verbose printf then "$@" /usr/bin ${HOME} printf
+	test sed "$1" /usr/bin --verbose cd awk && then readonly --verbose readonly
+		${HOME} "$1" printf done x=1 cd /usr/bin $(pwd) "$@" "$@" &&
+readonly 'quoted text'
+	sed awk "$@" cd readonly $(pwd) printf && x=1 --verbose --verbose
+		awk 2>/dev/null "$@" && && "$@" 2>/dev/null export
+		$(pwd) test export printf | x=1 awk $(pwd) x=1 local grep "$@"
+export export export test /usr/bin "$@"
+awk awk 2>/dev/null && grep "$1" "$@" cd then
+'quoted text' ${HOME} then done export done then "$@" printf
+		test "$@" export 'quoted text'
+/usr/bin awk done ${HOME} $(pwd) 2>/dev/null then
+test readonly readonly ${HOME} grep "$@" 2>/dev/null
+	then $(pwd) $(pwd) ${HOME} export done /usr/bin
+		x=1 printf grep /usr/bin cd
+	cd echo "$1" printf $(pwd) "$1" x=1 export local && | grep 'quoted text'
+	'quoted text' $(pwd) 2>/dev/null local cd /usr/bin
+		--verbose then local done awk "$1" export cd --verbose -eu
+		'quoted text' grep -eu echo then --verbose --verbose local done sed x=1
+		'quoted text' "$1" "$@" ${HOME} /usr/bin done "$1" "$1" "$1" "$1"
+	cd 2>/dev/null $(pwd) test grep test 2>/dev/null echo
+		'quoted text' export && awk test readonly
+	&& | 2>/dev/null done 'quoted text'
+	echo --verbose grep 'quoted text' ${HOME}
+	cd "$@" done grep local printf /usr/bin awk done ${HOME} -eu "$1" local cd
+	$(pwd) cd readonly 2>/dev/null echo -eu /usr/bin /usr/bin test /usr/bin
+test local x=1 | grep /usr/bin --verbose ${HOME} $(pwd)
+--verbose ${HOME} && echo 'quoted text' &&
+		/usr/bin ${HOME} x=1 ${HOME} ${HOME} && $(pwd) then x=1 echo printf grep "$@"
+	awk /usr/bin done printf awk "$@" grep 2>/dev/null then grep readonly
+'quoted text' $(pwd) 2>/dev/null -eu test /usr/bin
+	/usr/bin printf 'quoted text' 2>/dev/null
+local 2>/dev/null export echo "$@" then && /usr/bin sed cd local && local
+awk | done sed "$@" 'quoted text'
+	-eu done | && readonly export awk readonly printf grep 'quoted text' "$1" cd sed
+sed 'quoted text' echo
+cd export test 'quoted text'
+		x=1 cd readonly readonly --verbose echo cd done --verbose export cd 2>/dev/null
+	| --verbose | --verbose $(pwd)
+		export --verbose test printf && done awk
+		sed $(pwd) x=1 printf readonly /usr/bin grep then
+2>/dev/null test --verbose x=1 done x=1 done /usr/bin ${HOME}
+	readonly grep readonly $(pwd) -eu --verbose 'quoted text' "$@" x=1 grep printf
+x=1 test /usr/bin -eu 2>/dev/null
+$(pwd) --verbose done then sed "$@" ${HOME} local readonly readonly && | local
+| -eu export done echo echo && x=1 --verbose
+	| printf then printf --verbose && "$@"
+	test sed sed 'quoted text' local export printf sed done awk 'quoted text'
+	sed printf | sed test
+		--verbose && x=1 'quoted text' ${HOME}
+		echo printf test grep "$@" | awk export
+	echo then x=1 readonly test readonly local then cd --verbose echo | cd awk echo
+		echo | test printf x=1 cd cd export awk
+	sed sed x=1 -eu && 2>/dev/null "$@" 'quoted text'
+	${HOME} readonly "$@" "$@"
+${HOME} $(pwd) "$1" echo | -eu done $(pwd)
+		"$@" done printf local && done awk export -eu $(pwd) /usr/bin 2>/dev/null
+	x=1 readonly "$1" ${HOME} "$@" x=1 && "$@" echo
+		"$@" test "$1" awk -eu cd test local printf x=1 grep "$@" local done --verbose
+echo awk $(pwd) done cd x=1 /usr/bin
+-eu 'quoted text' cd /usr/bin local readonly
+| "$1" $(pwd) --verbose /usr/bin sed local && grep echo
+sed ${HOME} done test echo
+		--verbose --verbose sed then && grep export --verbose "$@" && "$1" /usr/bin &&
+		awk local "$1" echo printf grep 2>/dev/null sed $(pwd) awk -eu --verbose
+	${HOME} cd 2>/dev/null && && /usr/bin
+	--verbose cd x=1 x=1 sed "$@" ${HOME} "$1" sed "$@" "$@" "$@" test 2>/dev/null
+		x=1 "$1" printf done test /usr/bin /usr/bin 2>/dev/null
+readonly | x=1 printf -eu --verbose
+		local sed cd ${HOME} printf "$1" test printf
+x=1 2>/dev/null then awk echo ${HOME} printf --verbose test
+	sed printf readonly then && 2>/dev/null cd "$1" echo | grep test export /usr/bin
+local $(pwd) printf cd test 2>/dev/null awk && export ${HOME} awk
+	2>/dev/null --verbose --verbose x=1 sed awk readonly
+		then sed x=1 /usr/bin done sed "$@" | awk && echo sed --verbose
+		cd done test /usr/bin grep 2>/dev/null
+	sed local 'quoted text' awk grep grep 2>/dev/null
+--verbose $(pwd) 'quoted text'
+		${HOME} 'quoted text' | awk $(pwd) grep
+		'quoted text' --verbose printf grep /usr/bin grep awk -eu echo --verbose then
+		cd done export -eu "$1"
+		printf --verbose export "$1" x=1 && printf 2>/dev/null | printf
+then echo "$@" 2>/dev/null echo $(pwd) then
+2>/dev/null readonly done echo sed grep x=1
+readonly local grep printf 2>/dev/null export |
+	| $(pwd) "$@" sed 'quoted text' cd 'quoted text' ${HOME} ${HOME}
+		sed printf readonly /usr/bin ${HOME} x=1 && cd "$1"
+		test "$1" 'quoted text' readonly sed then awk
+		${HOME} grep /usr/bin | local echo printf | ${HOME} 'quoted text'
+		readonly "$1" 2>/dev/null $(pwd) $(pwd) x=1 cd /usr/bin
+		done sed cd printf $(pwd) sed 'quoted text' $(pwd) export /usr/bin
+	$(pwd) 2>/dev/null printf sed "$1" echo $(pwd) printf -eu
+		&& then local -eu done then local echo grep export
+		then printf test cd sed echo --verbose "$@" printf
+local awk "$@" /usr/bin 2>/dev/null --verbose | "$@" printf /usr/bin test then
+echo --verbose | sed "$@" local readonly grep grep x=1 printf printf sed echo |
+${HOME} export cd grep then done
+	x=1 $(pwd) "$1" 2>/dev/null echo /usr/bin 'quoted text' 2>/dev/null
+		local $(pwd) ${HOME} awk
+	"$@" printf "$@" export -eu x=1 && echo
+cd echo export && ${HOME} then "$1" printf
+		| readonly 2>/dev/null x=1 sed "$@"
+--verbose /usr/bin test "$@" && && 'quoted text'
+	echo 'quoted text' /usr/bin
+| "$@" done /usr/bin printf "$@" | test 'quoted text'
+export "$@" printf /usr/bin echo printf --verbose "$@" local awk 'quoted text'
+		test local | readonly echo | && local
+		/usr/bin ${HOME} -eu then 2>/dev/null grep awk ${HOME}
+		then --verbose cd && grep 2>/dev/null awk sed -eu /usr/bin printf "$@" done done
+	local /usr/bin grep 2>/dev/null export ${HOME} 'quoted text' awk export
+"$@" then x=1 /usr/bin sed test
+		printf "$@" x=1 echo sed 'quoted text' x=1 done cd | local
+	2>/dev/null sed readonly "$@" grep --verbose
+		readonly $(pwd) ${HOME} 2>/dev/null sed printf readonly /usr/bin grep
+	'quoted text' printf -eu $(pwd) awk echo ${HOME}
+/usr/bin done x=1 x=1 printf "$@" local 2>/dev/null awk
+	echo /usr/bin printf -eu readonly awk 'quoted text'
+		awk local "$1" sed printf $(pwd) --verbose -eu 2>/dev/null
+		cd done /usr/bin $(pwd) && local
+	${HOME} /usr/bin x=1 $(pwd)
+	printf echo readonly && echo 'quoted text'
+	| | && $(pwd) done /usr/bin /usr/bin printf --verbose cd cd "$1" printf local
+	printf "$1" $(pwd) done x=1 then "$@" /usr/bin done cd
+local export readonly
+	awk "$@" $(pwd) local 'quoted text' && && printf local echo readonly local
+		awk done test /usr/bin readonly |
+		2>/dev/null x=1 test && readonly cd --verbose done export "$1" "$1" 'quoted text'
+	/usr/bin x=1 "$@" local echo "$@" --verbose export awk
+/usr/bin "$1" printf local 2>/dev/null --verbose
+		sed /usr/bin "$1" --verbose local then
+	then 'quoted text' grep && ${HOME} echo "$@" local
+&& --verbose then $(pwd) && sed 2>/dev/null
+'quoted text' grep /usr/bin "$1" printf
+done sed done readonly 2>/dev/null then
+/usr/bin readonly 'quoted text' "$1" "$1" --verbose
+${HOME} cd -eu $(pwd) | | $(pwd) echo
+done readonly local export printf -eu --verbose grep
+		${HOME} && done readonly local ${HOME}
+		&& local readonly printf 'quoted text' readonly $(pwd) done grep cd done
+		x=1 awk done grep printf done "$1" "$@" local done
+	sed && cd readonly awk local cd
+	| -eu grep 'quoted text' then grep x=1 printf ${HOME} then &&
+	2>/dev/null /usr/bin 2>/dev/null -eu cd ${HOME} then local export
+grep then $(pwd) 2>/dev/null 2>/dev/null
+		sed "$@" readonly cd grep printf && /usr/bin "$@" && $(pwd) done grep printf
+		x=1 | test $(pwd) 2>/dev/null --verbose sed grep x=1 /usr/bin echo 2>/dev/null
+	test x=1 && grep && done 2>/dev/null
+	cd grep 'quoted text' x=1 cd
+	&& cd local ${HOME} local
+"$@" --verbose ${HOME} "$1" printf printf then | awk
+		2>/dev/null export echo "$1" cd | ${HOME} -eu awk 'quoted text'
+awk x=1 $(pwd) awk "$@" readonly cd -eu local sed
+		2>/dev/null -eu done | -eu printf awk x=1 | 2>/dev/null $(pwd)
+	done export done "$@" grep | --verbose
+		"$1" then echo grep test "$1" $(pwd) export echo --verbose 'quoted text' done readonly
+sed done export /usr/bin /usr/bin "$@" test sed grep sed x=1 done
+cd sed $(pwd) done awk sed test ${HOME} test
+	'quoted text' && --verbose printf export
+		printf x=1 printf ${HOME} x=1 local
+		'quoted text' && test printf sed --verbose
+2>/dev/null $(pwd) 2>/dev/null
+	awk echo ${HOME} $(pwd) export -eu /usr/bin
+	--verbose "$@" done printf x=1 2>/dev/null
+2>/dev/null done 'quoted text' 2>/dev/null
+		readonly then then --verbose echo "$@" test then "$1" && printf x=1 printf |
+	x=1 test "$1" sed "$1" local sed -eu $(pwd) 'quoted text'
+test cd -eu sed readonly "$1" test "$1" grep ${HOME} 2>/dev/null test done printf
+		export then | && printf x=1 awk then test ${HOME} test 'quoted text' | readonly
+"$1" test local test -eu grep x=1
+	grep && -eu done | "$@" "$@" x=1 done /usr/bin printf
+	then --verbose then export --verbose "$@" sed readonly then ${HOME} &&
+'quoted text' -eu $(pwd) awk | /usr/bin
+		then /usr/bin 'quoted text' readonly awk export grep -eu /usr/bin
+	then | local awk "$@" export then
+		-eu done readonly | echo $(pwd) $(pwd) /usr/bin export "$@"
+		printf echo then x=1 done grep readonly test readonly $(pwd) grep 2>/dev/null
+cd test "$@" | local sed
+"$@" ${HOME} "$@" local local ${HOME} && ${HOME}
+local grep 'quoted text' grep cd && /usr/bin sed export 'quoted text' "$@" printf
+		then --verbose echo "$@" echo ${HOME} local x=1 -eu export
+	sed echo printf -eu ${HOME} awk cd 2>/dev/null
+		"$1" | 'quoted text' grep grep grep echo grep done && 2>/dev/null awk
+	cd | then ${HOME} grep -eu local export echo echo echo 'quoted text' readonly
+		"$@" "$1" -eu sed 2>/dev/null x=1
+test "$@" printf awk test done then $(pwd)
+x=1 echo readonly --verbose "$@" echo | --verbose x=1 --verbose 'quoted text'
+		printf && ${HOME} -eu local local x=1
+readonly --verbose 2>/dev/null | export
+		"$@" test export ${HOME} "$@" awk readonly
+	then test ${HOME} -eu "$@" echo printf grep /usr/bin
+awk grep x=1 && export echo echo grep --verbose "$@" /usr/bin && -eu -eu
+cd ${HOME} -eu ${HOME} --verbose readonly readonly printf "$@" sed
+then --verbose export $(pwd) 'quoted text' test
+	echo 2>/dev/null | test local "$1" /usr/bin awk cd
+'quoted text' /usr/bin done sed sed echo readonly printf readonly
+		"$1" ${HOME} x=1 then $(pwd) test then -eu -eu local
+	grep $(pwd) ${HOME} /usr/bin echo /usr/bin --verbose sed awk local
+	$(pwd) -eu echo grep local 2>/dev/null export test /usr/bin ${HOME} -eu ${HOME}
+local awk ${HOME} done 2>/dev/null cd sed && readonly $(pwd) x=1
+| test readonly then cd $(pwd)
+&& | "$1" 'quoted text' --verbose test ${HOME} --verbose
+		x=1 grep | echo grep done test "$1" grep
+readonly export test $(pwd) 2>/dev/null
+export awk x=1 echo && test "$1" $(pwd) echo
+		2>/dev/null /usr/bin then then --verbose /usr/bin ${HOME}
+x=1 export ${HOME} readonly export 'quoted text' ${HOME} && cd export
+	"$@" cd /usr/bin then $(pwd) 2>/dev/null
+	local grep --verbose "$1" ${HOME} 'quoted text'
+	awk 2>/dev/null then $(pwd) "$@" | 2>/dev/null awk && x=1 cd
+		done -eu cd readonly 2>/dev/null && "$@" "$1"
+	| grep printf done 2>/dev/null readonly
+	2>/dev/null printf echo local then local $(pwd) awk then test x=1 test
+-eu "$1" done test $(pwd) && $(pwd) && then grep $(pwd) export | "$1"
+		sed && 'quoted text' cd sed "$@" then
+		grep done cd -eu grep /usr/bin
+		"$@" test /usr/bin -eu 'quoted text' 2>/dev/null
+sed test readonly --verbose done sed test cd /usr/bin awk x=1 | awk grep x=1
+&& 'quoted text' -eu x=1 export 2>/dev/null x=1 $(pwd) "$@" | $(pwd) $(pwd)
+local | && done grep export --verbose "$@" test 2>/dev/null local 2>/dev/null 'quoted text'
+"$@" done && | "$@" 'quoted text'
+&& ${HOME} sed echo --verbose
+	$(pwd) x=1 ${HOME} export $(pwd) 'quoted text' && 2>/dev/null $(pwd) ${HOME} awk
+		x=1 "$@" "$1" -eu cd | cd /usr/bin
+	/usr/bin printf x=1 test && -eu local 2>/dev/null echo local
+printf /usr/bin echo && "$@" 'quoted text' --verbose
+		&& done grep done --verbose | "$@" awk awk local cd $(pwd) "$@"
+x=1 export export test
+	sed then sed export 'quoted text'
+	| awk printf echo echo sed "$@" local
+	awk export printf sed then sed local local ${HOME} printf 'quoted text' cd local
+	2>/dev/null test grep then /usr/bin --verbose && test $(pwd) test
+		"$1" awk test -eu /usr/bin --verbose
+test && "$1" -eu awk echo "$@" test ${HOME} "$@" "$@" | readonly readonly
+		| x=1 "$@" sed grep local "$@" $(pwd) 2>/dev/null export
+		"$@" local | then awk $(pwd) $(pwd) readonly "$1" "$@" "$1"
+${HOME} readonly then $(pwd) -eu ${HOME} | x=1
+	'quoted text' /usr/bin then
+		/usr/bin sed cd && awk done done 'quoted text'
+$(pwd) readonly awk /usr/bin awk && export 2>/dev/null
+"$1" | printf /usr/bin export awk --verbose "$1"
+		&& $(pwd) then "$1" grep ${HOME} export
+	/usr/bin ${HOME} done -eu "$1" then
+--verbose done sed 'quoted text' $(pwd) readonly x=1 | | printf "$@" ${HOME} awk
+local done local then -eu printf 2>/dev/null $(pwd) printf then
+	${HOME} echo readonly local ${HOME} test sed && then export -eu 'quoted text' $(pwd)
+		-eu sed then "$@" | $(pwd) | -eu grep local test grep sed /usr/bin $(pwd)
+	readonly x=1 | /usr/bin then 2>/dev/null readonly
+		local printf | printf local "$1" &&
+		awk local $(pwd) | cd echo $(pwd) test printf awk then
+echo local cd && $(pwd) ${HOME} ${HOME} x=1 awk
+/usr/bin printf test done readonly
+		readonly /usr/bin -eu export
+	/usr/bin grep cd | $(pwd) "$1" $(pwd) "$1"
+	$(pwd) --verbose test cd "$1" local sed grep -eu x=1 | printf readonly
+		/usr/bin x=1 printf sed export && sed "$@" /usr/bin -eu x=1 $(pwd)
+	/usr/bin "$1" /usr/bin /usr/bin --verbose | test printf done cd grep x=1
+	&& export 2>/dev/null export
+		grep sed && then "$1" | cd x=1 echo
+		-eu "$1" printf ${HOME} 2>/dev/null then then awk printf echo | ${HOME}
+		"$@" 'quoted text' && $(pwd) 'quoted text'
+		echo echo echo x=1 sed awk
+"$1" 'quoted text' -eu cd | done sed 'quoted text'
+		then readonly /usr/bin --verbose "$1" 2>/dev/null
+done && "$@" grep echo export && local /usr/bin /usr/bin echo x=1 test then x=1
+readonly --verbose /usr/bin grep && "$@" awk && export then $(pwd) echo
+		x=1 printf sed done printf export readonly local |
+		cd readonly grep 2>/dev/null "$@" grep
+		cd cd && echo echo x=1 ${HOME} export 2>/dev/null 2>/dev/null
+	"$1" && x=1 readonly export sed "$1" readonly
+| readonly -eu --verbose export && then awk 'quoted text' test readonly
+	"$1" export 'quoted text' -eu local -eu export test awk grep && | 2>/dev/null readonly
+readonly 'quoted text' awk "$1" done /usr/bin awk awk
+	${HOME} && /usr/bin --verbose -eu /usr/bin "$1" local --verbose
+	echo | && printf "$@" $(pwd) awk | local readonly readonly
+	"$1" -eu printf local printf --verbose awk test local readonly
+		awk "$@" "$@" done test x=1 sed --verbose echo grep
+	printf 2>/dev/null local done ${HOME} local | 2>/dev/null done "$1" &&
+	sed ${HOME} awk awk | test
+local x=1 printf $(pwd) then x=1 "$@" x=1 done grep x=1 test /usr/bin
+	test test export /usr/bin
+printf readonly /usr/bin | done ${HOME} "$@" x=1 "$1" "$@" "$@" /usr/bin echo then
+	-eu local test awk local echo then --verbose
+local done && ${HOME} export /usr/bin export echo export -eu
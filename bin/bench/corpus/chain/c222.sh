@@ -0,0 +1,2001 @@
+		printf 2>/dev/null ${HOME} readonly sed
+	&& x=1 ${HOME} export done --verbose then local then local x=1 done
+	"$@" readonly 2>/dev/null local local cd "$1" --verbose "$1" test ${HOME} awk
+		$(pwd) grep readonly ${HOME}
+	printf --verbose awk -eu && test sed printf |
+	sed echo cd readonly
+export -eu /usr/bin sed grep | cd grep grep --verbose readonly 2>/dev/null $(pwd)
+	done | readonly cd 'quoted text' cd done ${HOME} export 'quoted text'
+x=1 $(pwd) done done done cd readonly
+-eu printf done echo && awk echo && readonly then 'quoted text'
+		readonly "$1" cd cd test x=1 2>/dev/null && ${HOME} 'quoted text'
+	export done x=1 && && "$1" readonly echo && echo echo x=1 done "$@" 'quoted text'
+	"$@" | $(pwd) printf "$@" then done test /usr/bin ${HOME} && $(pwd) x=1 -eu grep
+	then x=1 2>/dev/null echo -eu && then echo $(pwd) local echo 'quoted text'
+	&& export "$1" x=1 echo --verbose local readonly cd -eu
+readonly x=1 2>/dev/null x=1 printf cd then export --verbose "$@" done
+		test echo done x=1 sed 'quoted text' /usr/bin
+		then grep grep 2>/dev/null 2>/dev/null /usr/bin "$@" /usr/bin
+	readonly then 2>/dev/null
+-eu echo sed printf 'quoted text' sed
+	done printf ${HOME} test
+	&& export grep local x=1 | 2>/dev/null "$1"
+then awk -eu local printf | grep --verbose printf export "$@" --verbose
+	done 'quoted text' export echo then
+'quoted text' ${HOME} 'quoted text' readonly x=1 "$@" echo awk x=1 export
+		&& done local cd --verbose done echo done && 2>/dev/null ${HOME}
+		grep local done "$1" "$@" readonly && $(pwd) $(pwd)
+-eu echo "$1" ${HOME} printf local then x=1 export cd
+	printf done -eu done cd "$1" echo 2>/dev/null
+		then export then printf test readonly
+	test "$@" export local
+	test /usr/bin | cd | --verbose sed --verbose "$1"
+		&& "$1" sed "$@" --verbose "$@"
+		grep $(pwd) sed cd "$1" "$@" grep awk cd | done $(pwd) awk $(pwd) x=1 "$@"
+		"$@" /usr/bin echo test
+$(pwd) cd then ${HOME} x=1 grep test --verbose | readonly sed echo test
+		done "$@" awk ${HOME} && 'quoted text' "$1" awk
+	readonly && && readonly "$@" done -eu printf grep
+cd test then "$1" awk && local awk sed ${HOME} && --verbose then 2>/dev/null 2>/dev/null
+		2>/dev/null cd then $(pwd) 'quoted text' --verbose $(pwd)
+grep $(pwd) "$@" "$1" readonly "$1" --verbose -eu x=1 readonly done "$1"
+	cd local 2>/dev/null awk readonly -eu sed grep readonly | 'quoted text'
+	echo && --verbose $(pwd) 2>/dev/null x=1 done $(pwd)
+	readonly "$1" awk grep test sed -eu && ${HOME} /usr/bin
+	local cd export && && cd test 'quoted text'
+	&& sed then grep --verbose $(pwd)
+export test /usr/bin x=1 local 2>/dev/null /usr/bin
+then | "$@" awk cd sed cd --verbose "$@" export test && &&
+awk --verbose && echo grep 2>/dev/null
+awk | -eu local then "$@" then cd done --verbose | && "$1" 2>/dev/null "$1" ${HOME}
+'quoted text' printf done 2>/dev/null done $(pwd)
+		export | printf sed sed echo done
+	awk then then 2>/dev/null grep
+2>/dev/null cd $(pwd) sed readonly $(pwd) "$@" local | /usr/bin
+		cd $(pwd) | | printf sed --verbose x=1 -eu --verbose cd cd | 2>/dev/null export
+x=1 /usr/bin cd 'quoted text'
+	sed 2>/dev/null "$1" /usr/bin local $(pwd) readonly | done echo done then x=1 $(pwd)
+	grep then "$1" test printf echo && then
+		then "$@" -eu then awk then cd done test x=1 done cd
+"$@" "$@" /usr/bin test grep x=1 readonly printf && grep awk ${HOME} grep "$@"
+	&& 2>/dev/null "$1" printf
+	local done --verbose 'quoted text' local
+		printf && 2>/dev/null && "$1" test 'quoted text'
+	test export then -eu awk --verbose /usr/bin grep sed /usr/bin $(pwd)
+local --verbose echo grep done 2>/dev/null readonly then | --verbose test
+		export $(pwd) echo then x=1 then "$1" export /usr/bin test ${HOME} readonly
+		echo && sed $(pwd) cd grep done "$1" done 'quoted text'
+	-eu /usr/bin awk && /usr/bin | echo sed 2>/dev/null | grep $(pwd) 2>/dev/null
+sed echo $(pwd) $(pwd) sed "$1"
+	export -eu ${HOME} -eu cd --verbose sed local sed
+	export local then echo awk awk cd /usr/bin sed && ${HOME} cd sed | export
+		local export | grep && readonly
+'quoted text' awk grep awk -eu export
+		sed $(pwd) test sed awk printf | done cd -eu export | awk sed then done
+awk export && 2>/dev/null 'quoted text' sed --verbose && --verbose readonly export
+sed x=1 echo /usr/bin "$@" "$@" x=1 -eu grep | cd ${HOME} cd printf awk
+		then ${HOME} ${HOME} cd grep && readonly readonly 2>/dev/null
+"$@" -eu grep "$@" sed done "$1" 2>/dev/null --verbose $(pwd)
+	${HOME} 2>/dev/null printf readonly 'quoted text' cd
+	awk | cd export done cd "$1" "$@" && done local awk && echo 'quoted text'
+$(pwd) test /usr/bin 2>/dev/null
+${HOME} 'quoted text' && -eu "$1"
+	local export 2>/dev/null --verbose
+echo sed && -eu test /usr/bin -eu grep -eu export export
+-eu done sed printf ${HOME}
+done "$@" 2>/dev/null local sed "$1" then sed 'quoted text' "$1" test |
+	grep /usr/bin && -eu -eu -eu $(pwd) printf grep 'quoted text' 'quoted text' awk
+readonly -eu --verbose test "$@" 2>/dev/null -eu readonly cd export echo
+		&& grep 'quoted text' --verbose
+	/usr/bin printf grep done then grep cd echo
+${HOME} --verbose --verbose sed "$1" cd $(pwd)
+/usr/bin then test grep local export
+		test $(pwd) printf /usr/bin --verbose awk done done done sed 2>/dev/null x=1 readonly
+		local sed test awk readonly /usr/bin $(pwd) -eu local
+awk --verbose -eu --verbose
+	awk x=1 && awk "$@" 2>/dev/null && printf printf readonly cd
+	awk sed sed readonly sed 2>/dev/null -eu
+		done printf export sed sed | "$@" grep export
+		printf x=1 ${HOME} "$@" grep readonly then ${HOME} cd 2>/dev/null
+		readonly /usr/bin test && --verbose -eu
+	done -eu readonly ${HOME} export local | | cd awk printf "$1" 2>/dev/null
+		awk grep "$1" /usr/bin then awk
+"$@" ${HOME} sed --verbose printf $(pwd) done awk 2>/dev/null "$@" | --verbose
+	sed 2>/dev/null printf && export printf -eu /usr/bin then echo printf --verbose
+done echo awk $(pwd) && echo | sed cd && "$1" $(pwd) "$1" sed awk local
+		/usr/bin then done && export --verbose --verbose
+		echo grep done -eu sed "$@" $(pwd) | --verbose
+		x=1 cd $(pwd) 2>/dev/null grep then export
+	$(pwd) "$@" readonly x=1 printf
+		awk sed "$@" "$1" --verbose "$1" 'quoted text'
+	2>/dev/null echo x=1 2>/dev/null echo test x=1 2>/dev/null
+	printf /usr/bin --verbose printf 2>/dev/null printf
+sed -eu -eu local awk
+	readonly done -eu test printf | -eu test then
+grep local 2>/dev/null
+local readonly done 2>/dev/null --verbose done -eu test "$1"
+| grep sed printf 2>/dev/null $(pwd) readonly $(pwd) export
+awk "$1" && printf then /usr/bin echo 'quoted text' local
+	grep done test --verbose 'quoted text' /usr/bin 2>/dev/null then
+	export printf 'quoted text' sed echo awk test grep
+	-eu awk awk local cd grep $(pwd) grep --verbose /usr/bin
+	printf echo 2>/dev/null
+then && /usr/bin && test "$1" cd echo test test 2>/dev/null x=1
+then echo ${HOME} x=1 echo 2>/dev/null x=1 2>/dev/null awk sed export ${HOME}
+"$@" 'quoted text' "$1" sed awk "$@"
+/usr/bin -eu local "$1" echo && /usr/bin
+		readonly | --verbose 2>/dev/null test --verbose $(pwd) 'quoted text'
+	"$@" test then $(pwd) --verbose cd
+		cd printf ${HOME} cd printf ${HOME} then echo x=1 printf then
+		-eu x=1 sed -eu "$@" echo awk readonly "$@" $(pwd) "$1" grep echo echo 'quoted text'
+		$(pwd) "$1" "$@" then
+	"$1" then ${HOME} /usr/bin export "$1"
+		$(pwd) /usr/bin --verbose -eu grep printf
+	echo done grep done "$@" local readonly | grep
+| "$@" --verbose --verbose 2>/dev/null export test /usr/bin $(pwd)
+	awk cd readonly readonly
+		$(pwd) local | | grep export then test x=1 -eu "$@" 'quoted text'
+		awk 2>/dev/null $(pwd) /usr/bin x=1 x=1
+	2>/dev/null 'quoted text' 2>/dev/null --verbose
+	| -eu echo x=1 readonly $(pwd) && done ${HOME}
+	--verbose "$1" "$@" sed sed grep done grep then echo $(pwd) awk
+		"$@" "$@" "$@" readonly echo --verbose && sed | -eu export "$@" | awk export
+-eu printf ${HOME} /usr/bin /usr/bin && readonly --verbose grep
+	readonly ${HOME} readonly "$@" $(pwd) --verbose printf $(pwd) local
+/usr/bin echo --verbose && x=1 /usr/bin x=1 | local
+cd "$@" printf awk cd 'quoted text' ${HOME} ${HOME} cd
+		grep export cd readonly /usr/bin -eu 'quoted text' echo
+		"$@" $(pwd) local ${HOME} | then x=1 2>/dev/null grep $(pwd) echo -eu then
+awk | readonly x=1 local --verbose x=1 test -eu --verbose 'quoted text'
+| | x=1 test export $(pwd)
+echo "$@" printf done export grep then test
+test --verbose local x=1 readonly
+	readonly test 2>/dev/null sed grep | -eu && x=1 readonly 2>/dev/null -eu
+		then x=1 && -eu -eu readonly
+		| x=1 cd x=1 'quoted text' test cd grep readonly
+	sed readonly && x=1 x=1 && local x=1 x=1 $(pwd) test cd /usr/bin
+"$1" readonly $(pwd) readonly 'quoted text'
+		${HOME} /usr/bin ${HOME} | export $(pwd) 'quoted text'
+done export && && -eu readonly export 2>/dev/null awk "$@" sed sed 'quoted text'
+		"$@" $(pwd) then sed "$@" $(pwd) ${HOME} local export ${HOME} | 'quoted text'
+		export test readonly | -eu cd grep &&
+		&& 2>/dev/null then awk done 2>/dev/null printf -eu
+/usr/bin awk sed 'quoted text'
+	then ${HOME} x=1 cd 'quoted text' $(pwd)
+	${HOME} printf awk "$@" test "$@" -eu
+		2>/dev/null | $(pwd) printf then -eu && "$@" 'quoted text' local test 2>/dev/null
+		x=1 $(pwd) "$1" printf export printf printf
+local local | done cd export then
+		echo grep local echo done
+echo "$@" ${HOME} done sed cd grep sed printf
+'quoted text' grep && 2>/dev/null && cd | grep && | 'quoted text'
+	x=1 --verbose $(pwd) "$1" sed 'quoted text'
+	cd $(pwd) --verbose 2>/dev/null
+	export export printf ${HOME} 'quoted text' && export $(pwd) $(pwd) "$@"
+'quoted text' awk local cd 'quoted text' echo 'quoted text'
+	"$@" "$1" done --verbose
+	awk && "$1" echo && grep local
+	awk "$1" && "$1" local x=1 then | 'quoted text'
+	done export 'quoted text' -eu echo x=1 2>/dev/null echo 'quoted text' x=1 cd "$@"
+	export -eu then sed export && ${HOME} x=1 readonly /usr/bin
+${HOME} | -eu -eu 'quoted text' $(pwd) --verbose ${HOME} x=1 local
+		test ${HOME} grep test done /usr/bin local readonly grep 'quoted text'
+	done "$@" /usr/bin printf ${HOME} printf "$@" printf
+	export then printf 2>/dev/null printf -eu cd x=1 cd printf export
+		grep --verbose ${HOME} test export test ${HOME} | ${HOME}
+done printf "$1" awk done export /usr/bin 'quoted text'
+	| $(pwd) ${HOME} | done echo grep cd cd 'quoted text' --verbose
+	local echo x=1 awk $(pwd) | local 'quoted text'
+"$@" 2>/dev/null done -eu x=1
+		cd 'quoted text' ${HOME} done done
+	awk test ${HOME} /usr/bin awk --verbose && -eu
+-eu /usr/bin test echo 2>/dev/null then 'quoted text' export -eu 2>/dev/null
+	export | -eu test awk grep --verbose "$@" /usr/bin
+		$(pwd) -eu readonly "$1" && cd sed done ${HOME} grep local
+		-eu ${HOME} --verbose "$1" | "$@" printf --verbose grep /usr/bin
+	export printf "$1" test "$@" awk "$1" done "$1" 'quoted text'
+		/usr/bin local grep cd 'quoted text' ${HOME} local x=1 test
+	&& local /usr/bin export
+	/usr/bin grep && && cd done printf
+local $(pwd) grep printf printf 2>/dev/null
+		test readonly /usr/bin | awk grep local "$@"
+		--verbose $(pwd) --verbose "$1" export
+local grep cd export && -eu test /usr/bin awk -eu printf -eu readonly
+--verbose && sed --verbose cd sed && "$1" 'quoted text'
+	readonly "$1" && | $(pwd) grep done export $(pwd)
+	echo then printf ${HOME} done && 2>/dev/null 2>/dev/null --verbose
+-eu grep then && cd 'quoted text' "$@" awk done $(pwd)
+		/usr/bin echo echo 'quoted text' x=1 sed sed $(pwd) x=1 test echo /usr/bin
+		&& "$@" && "$1" "$@" "$@" ${HOME} echo then $(pwd) done grep -eu
+		done export local 'quoted text' then grep done grep local printf
+		/usr/bin export test 'quoted text' ${HOME}
+		test "$@" $(pwd) && $(pwd) "$1" x=1 echo then
+		readonly sed && done then 'quoted text' awk local 'quoted text' ${HOME}
+	"$1" "$@" then done local done && test done 2>/dev/null x=1
+${HOME} local readonly grep ${HOME} && cd
+then $(pwd) "$@" /usr/bin -eu --verbose 2>/dev/null /usr/bin
+echo done 'quoted text' echo -eu 2>/dev/null awk export printf
+		&& && "$1" sed printf
+		/usr/bin | "$@" ${HOME}
+	readonly echo ${HOME} export ${HOME} echo cd | ${HOME} $(pwd)
+		sed awk echo grep done --verbose x=1 cd then export sed x=1 cd /usr/bin
+		/usr/bin cd readonly test grep
+		&& ${HOME} "$@" -eu $(pwd) grep echo --verbose
+		${HOME} /usr/bin awk export
+test $(pwd) then | printf $(pwd) sed export local
+	"$1" sed readonly 2>/dev/null export then printf local done 2>/dev/null && done
+	'quoted text' /usr/bin -eu grep printf | export
+"$@" export local cd awk $(pwd) readonly sed 2>/dev/null ${HOME} awk
+		/usr/bin readonly cd 'quoted text'
+sed readonly sed printf export --verbose local x=1 $(pwd) cd $(pwd)
+echo "$@" readonly /usr/bin readonly test
+${HOME} cd sed | 2>/dev/null
+	printf && -eu done cd cd printf printf "$@" 2>/dev/null local "$@" $(pwd) then
+readonly readonly done | printf /usr/bin 2>/dev/null && sed
+2>/dev/null | /usr/bin 'quoted text' grep | local test 'quoted text'
+		/usr/bin awk --verbose --verbose ${HOME}
+	cd local awk "$@" echo "$@"
+		x=1 "$@" local && "$@" readonly awk "$1" awk export
+awk grep 'quoted text' grep echo readonly cd /usr/bin --verbose
+		"$1" 'quoted text' then awk "$1" -eu ${HOME} && --verbose 'quoted text'
+	${HOME} $(pwd) /usr/bin local then | "$@" sed export done echo 'quoted text' local
+		awk 2>/dev/null | printf
+		/usr/bin "$@" "$@" /usr/bin grep test done printf | printf export "$1" awk
+test local test && $(pwd) export ${HOME} -eu |
+"$1" && $(pwd) 'quoted text' "$1" sed | $(pwd)
+printf local --verbose export test
+test export printf ${HOME}
+	local && --verbose /usr/bin x=1 sed "$@" grep
+		$(pwd) done grep | x=1 x=1 | -eu /usr/bin
+	awk echo /usr/bin readonly "$@" -eu readonly
+&& | -eu && "$@" -eu 2>/dev/null cd sed local $(pwd) done
+		echo export && /usr/bin 'quoted text' echo /usr/bin done 2>/dev/null awk $(pwd)
+	&& readonly /usr/bin cd && -eu
+${HOME} $(pwd) printf printf printf | $(pwd) "$1" x=1 --verbose 'quoted text'
+--verbose done && export 'quoted text' ${HOME} $(pwd)
+	echo | awk && echo | | local && cd local awk printf readonly awk
+sed && /usr/bin --verbose grep 'quoted text'
+		2>/dev/null test --verbose 'quoted text' echo awk
+/usr/bin sed /usr/bin -eu sed $(pwd) then test awk | $(pwd)
+		local ${HOME} x=1 2>/dev/null --verbose
+2>/dev/null readonly 2>/dev/null
+		then 'quoted text' ${HOME} "$1" done awk -eu "$@" grep cd &&
+		$(pwd) "$@" $(pwd) /usr/bin
+	'quoted text' 'quoted text' export
+	-eu echo printf /usr/bin "$@" && 'quoted text'
+&& "$@" ${HOME} export 2>/dev/null --verbose then $(pwd) readonly
+	echo --verbose 'quoted text' sed
+"$@" $(pwd) cd "$1" "$1" /usr/bin echo cd awk cd "$@"
+		| readonly echo 'quoted text' && $(pwd) echo grep
+		cd then $(pwd) then echo printf ${HOME} --verbose -eu sed "$@" 'quoted text'
+	grep test test test grep export readonly --verbose "$1" printf ${HOME}
+export && then x=1 test echo then |
+	--verbose done done export
+	-eu printf sed printf /usr/bin "$1" --verbose
+		test 2>/dev/null 2>/dev/null readonly 2>/dev/null printf readonly
+		printf 'quoted text' | printf done -eu
+	'quoted text' /usr/bin done then then /usr/bin $(pwd) /usr/bin
+&& echo test --verbose --verbose --verbose grep ${HOME} grep "$@"
+echo readonly awk local --verbose test readonly
+		"$@" | /usr/bin local --verbose export awk export && printf awk --verbose
+		2>/dev/null cd 'quoted text' readonly cd
+grep printf done then done && done export awk echo
+	sed grep --verbose done $(pwd) readonly
+-eu then test /usr/bin $(pwd) echo && done
+	2>/dev/null grep /usr/bin echo --verbose readonly x=1 sed done ${HOME}
+x=1 ${HOME} $(pwd) grep readonly export done x=1 'quoted text' printf
+cd $(pwd) grep --verbose cd echo x=1 readonly -eu ${HOME}
+		awk awk echo $(pwd) local echo
+	export 'quoted text' | $(pwd)
+		&& --verbose grep | && local awk local sed --verbose sed awk x=1
+--verbose && cd /usr/bin | && readonly awk then x=1 /usr/bin 2>/dev/null
+		grep 2>/dev/null 'quoted text' printf awk 'quoted text' --verbose --verbose
+done 'quoted text' 2>/dev/null done cd $(pwd) awk done /usr/bin x=1 grep local
+	awk grep -eu printf x=1 echo then 'quoted text' --verbose ${HOME} --verbose
+export done readonly readonly cd "$@" "$@"
+		&& cd printf && then export /usr/bin
+grep ${HOME} cd awk x=1 | | awk echo 2>/dev/null cd --verbose 2>/dev/null done
+printf readonly cd ${HOME} local
+		x=1 $(pwd) grep x=1 then "$@" echo ${HOME} --verbose
+	sed "$1" "$@" /usr/bin awk cd "$@" ${HOME} --verbose local test
+		/usr/bin grep then --verbose && awk sed -eu export echo x=1 x=1 2>/dev/null echo
+		${HOME} echo -eu done -eu $(pwd)
+grep grep test then x=1 then readonly -eu 2>/dev/null
+-eu $(pwd) then sed x=1 x=1 echo local -eu awk readonly $(pwd) | done /usr/bin
+		local "$@" echo cd echo "$1" $(pwd) local local echo echo
+		then cd echo 2>/dev/null grep -eu "$1"
+	/usr/bin 2>/dev/null /usr/bin $(pwd) test echo "$@"
+'quoted text' export $(pwd) | grep done ${HOME}
+	"$@" 2>/dev/null cd --verbose sed && 'quoted text' -eu
+&& ${HOME} sed -eu --verbose
+	'quoted text' 'quoted text' && done export awk awk &&
+export sed cd && ${HOME} "$@"
+	test x=1 cd then test cd awk local test ${HOME} --verbose /usr/bin
+--verbose "$1" 'quoted text' test && "$@" "$1"
+	export awk echo export grep && readonly printf | grep
+		test test x=1 readonly done "$@" "$1"
+	echo "$1" -eu 2>/dev/null
+2>/dev/null /usr/bin x=1 /usr/bin $(pwd) grep done /usr/bin -eu
+| | 2>/dev/null done /usr/bin
+		/usr/bin "$1" echo export test grep done
+		local "$@" export cd "$1" grep awk sed cd then 'quoted text' test 'quoted text'
+	test done test awk test ${HOME}
+		then local export awk done -eu --verbose export x=1 $(pwd) "$1"
+${HOME} echo /usr/bin then readonly
+		local echo 'quoted text' sed -eu --verbose
+grep echo local "$@" "$@" awk | "$1" 'quoted text' --verbose
+then 'quoted text' done -eu /usr/bin readonly /usr/bin
+		test --verbose && 2>/dev/null && printf
+"$1" test done awk "$@" ${HOME} printf
+		cd done export && grep local echo 2>/dev/null "$@" export
+	sed $(pwd) cd then local printf 2>/dev/null
+	&& local done "$1" cd done
+awk x=1 local x=1 awk x=1 local done ${HOME} export local && then ${HOME} x=1 "$@"
+		export echo $(pwd) awk export --verbose | done printf sed /usr/bin $(pwd) export
+	2>/dev/null && | /usr/bin x=1 awk --verbose awk cd done grep then
+export "$1" ${HOME} /usr/bin
+-eu -eu 'quoted text' cd printf then --verbose
+done readonly | then done local echo /usr/bin 2>/dev/null then
+"$1" --verbose --verbose local 2>/dev/null grep /usr/bin
+--verbose -eu | 'quoted text' then export then "$@" test local awk test --verbose
+	then test readonly printf /usr/bin
+'quoted text' && done grep --verbose "$1" $(pwd) ${HOME} /usr/bin && export
+		2>/dev/null printf /usr/bin /usr/bin $(pwd) "$1" printf
+		"$1" "$1" awk test export grep && awk | && readonly done
+		echo /usr/bin export readonly then && sed printf ${HOME} | test awk ${HOME} "$1"
+	2>/dev/null printf export local 'quoted text' x=1
+	x=1 readonly | echo | | --verbose /usr/bin awk x=1 test printf test -eu sed grep
+	--verbose done ${HOME} "$1" ${HOME} grep 2>/dev/null
+		2>/dev/null local --verbose test readonly
+		echo --verbose test $(pwd) 'quoted text' 2>/dev/null readonly --verbose
+		"$1" then then cd $(pwd) "$@" ${HOME} /usr/bin readonly $(pwd) | 'quoted text'
+		x=1 $(pwd) readonly -eu
+echo && local "$@" x=1 done echo test done && awk "$@"
+	printf cd cd x=1 printf local test sed x=1 /usr/bin grep cd test && ${HOME} &&
+		&& x=1 2>/dev/null cd cd 'quoted text' "$1" "$@" echo 'quoted text' cd
+		${HOME} 2>/dev/null x=1
+$(pwd) local x=1 ${HOME} printf echo readonly
+		| then local grep $(pwd) && export grep local readonly |
+		-eu && "$@" -eu cd local
+	cd test | sed printf 'quoted text' | 2>/dev/null ${HOME}
+		sed | readonly && -eu echo export
+		echo readonly "$1" cd 'quoted text' | 'quoted text' ${HOME} | && | awk sed test
+echo --verbose $(pwd) $(pwd)
+2>/dev/null sed then -eu printf sed "$@" sed 'quoted text'
+		${HOME} local "$1" -eu "$1" awk test awk test sed /usr/bin 2>/dev/null
+		"$@" sed x=1 -eu | "$@" test /usr/bin readonly ${HOME} |
+		$(pwd) readonly readonly echo /usr/bin export grep 'quoted text' then 2>/dev/null
+	then && 'quoted text' $(pwd) done
+${HOME} 'quoted text' /usr/bin
+test 'quoted text' 'quoted text' echo $(pwd) 'quoted text' ${HOME} printf printf
+/usr/bin readonly printf
+cd cd done local ${HOME} grep printf awk local test
+	$(pwd) 2>/dev/null export awk -eu "$@" "$@" x=1 /usr/bin
+		x=1 /usr/bin /usr/bin sed cd x=1 /usr/bin readonly
+		$(pwd) 'quoted text' ${HOME} /usr/bin x=1 -eu -eu done sed "$1" | /usr/bin awk awk
+		grep sed readonly 2>/dev/null
+done then local && | grep ${HOME} grep export "$@" printf 2>/dev/null
+		&& && grep | done "$@" cd
+		2>/dev/null ${HOME} 2>/dev/null
+		| ${HOME} ${HOME} "$1" ${HOME}
+echo "$@" $(pwd) x=1 "$1" 'quoted text' x=1 local ${HOME}
+		local "$1" $(pwd) readonly done x=1 -eu && test grep export readonly
+		/usr/bin $(pwd) export local "$1" then && printf
+		-eu export echo $(pwd) echo /usr/bin sed printf "$@" then -eu /usr/bin awk
+	--verbose -eu done "$@" "$1" local 2>/dev/null
+		local x=1 grep done local echo ${HOME} done | awk "$@" $(pwd)
+export sed done sed export done
+export echo 'quoted text' x=1 --verbose 'quoted text' | --verbose cd then /usr/bin
+	x=1 awk -eu done echo -eu /usr/bin x=1 local -eu local
+	readonly echo awk readonly -eu test && local --verbose
+		printf 2>/dev/null cd "$1"
+		echo | -eu -eu 2>/dev/null
+grep x=1 x=1 done sed grep printf
+x=1 local "$1" local ${HOME}
+'quoted text' --verbose test --verbose | /usr/bin sed
+		/usr/bin test printf then "$@"
+		"$@" $(pwd) export test 2>/dev/null printf && "$@" | grep export cd
+		"$1" 2>/dev/null printf 2>/dev/null --verbose cd
+	--verbose "$@" awk then /usr/bin grep 'quoted text' 2>/dev/null
+x=1 && | export "$1" local && grep grep local $(pwd) cd --verbose printf $(pwd)
+	/usr/bin done then -eu test 2>/dev/null sed then /usr/bin cd /usr/bin "$1"
+	then export x=1 -eu ${HOME} /usr/bin -eu test
+		'quoted text' export x=1 -eu "$1" 2>/dev/null
+		'quoted text' awk echo /usr/bin -eu 2>/dev/null sed && x=1 cd done printf
+		readonly && readonly "$1" $(pwd) printf cd cd grep export readonly
+"$1" test then then test
+'quoted text' grep done done done "$1" export
+		awk "$1" export readonly x=1 && $(pwd) -eu && && 'quoted text' &&
+		"$1" printf local "$@" | awk --verbose cd "$@" grep "$@" echo cd 2>/dev/null
+		grep readonly then echo -eu $(pwd) x=1 then | | test echo echo
+/usr/bin awk "$1" awk local x=1
+&& local && x=1 done
+-eu "$@" grep local cd 'quoted text' 'quoted text' | && x=1 x=1 done test
+		sed "$@" printf sed -eu
+sed /usr/bin 'quoted text' readonly /usr/bin "$@" sed
+local grep grep local -eu local -eu ${HOME} $(pwd)
+		local --verbose cd | awk export -eu local local sed 2>/dev/null done echo
+done awk cd readonly | x=1 grep done 2>/dev/null "$1" "$1" /usr/bin printf /usr/bin
+x=1 readonly test && --verbose /usr/bin echo printf
+		readonly sed grep && echo local 2>/dev/null -eu sed | test "$1" test local export
+		local readonly awk --verbose "$1" cd -eu grep echo "$1"
+	test then $(pwd) export /usr/bin readonly
+	echo $(pwd) printf --verbose x=1 sed "$@"
+	then "$@" && -eu readonly 2>/dev/null
+		/usr/bin echo 'quoted text' awk cd $(pwd) printf done test $(pwd)
+		local local then --verbose printf /usr/bin
+	then local 2>/dev/null "$1" local sed 2>/dev/null
+	"$1" | && local --verbose readonly readonly -eu cd grep
+	'quoted text' | test readonly sed x=1 -eu -eu
+		test cd grep $(pwd) sed x=1 -eu readonly x=1 done then
+		$(pwd) grep export --verbose --verbose "$1" then -eu -eu 'quoted text'
+test "$1" echo | "$@" export local
+	x=1 "$1" $(pwd) grep echo then -eu -eu x=1 2>/dev/null local -eu sed $(pwd)
+	grep done "$1" done test then printf
+	--verbose cd grep /usr/bin printf printf local && echo
+"$1" readonly "$1" awk
+	readonly done local cd x=1 printf --verbose awk 'quoted text'
+		then "$@" ${HOME} -eu awk sed && readonly export
+	| sed $(pwd) -eu $(pwd) export | /usr/bin awk
+		printf local --verbose /usr/bin 2>/dev/null &&
+		then "$1" && awk test 'quoted text' test --verbose --verbose done "$@"
+"$1" | test grep | &&
+	local cd readonly /usr/bin readonly local test ${HOME} ${HOME} sed
+		x=1 sed local | --verbose
+	test readonly sed "$1" x=1 awk awk export printf -eu echo cd test test
+echo "$1" | --verbose
+		then | "$1" grep /usr/bin printf /usr/bin ${HOME} && x=1 | 'quoted text'
+		readonly export $(pwd)
+grep echo sed 'quoted text' cd awk 'quoted text' --verbose printf readonly
+awk done 2>/dev/null then && sed ${HOME} "$1" && test cd
+		--verbose printf local echo "$@" awk test $(pwd) -eu 'quoted text' local
+${HOME} "$1" "$@" done then
+	printf | /usr/bin ${HOME} awk
+	local 2>/dev/null "$@" && | export awk --verbose ${HOME}
+		${HOME} readonly awk awk "$1" cd "$@" local $(pwd)
+$(pwd) test ${HOME} test done awk x=1 | done sed 2>/dev/null
+${HOME} "$@" echo /usr/bin | "$@" "$1" "$@" /usr/bin | readonly /usr/bin
+		/usr/bin sed then -eu "$1" --verbose 2>/dev/null && cd test ${HOME} done --verbose
+--verbose then export cd 2>/dev/null /usr/bin | local done "$1" $(pwd) 'quoted text'
+		grep | | then && echo export sed $(pwd) "$1" readonly
+	"$1" /usr/bin "$@" $(pwd) readonly 'quoted text' ${HOME}
+		cd x=1 -eu --verbose | 'quoted text' "$1" && "$1" /usr/bin
+	"$@" test 2>/dev/null && --verbose | && | export printf
+		| x=1 /usr/bin -eu -eu --verbose then ${HOME} "$1"
+	$(pwd) echo grep "$@" "$@" test
+	/usr/bin | printf "$1" done && done grep grep test echo "$@" readonly
+$(pwd) 'quoted text' $(pwd) 'quoted text' echo "$1" export local export
+		cd export readonly "$1" printf sed $(pwd) /usr/bin done local --verbose "$@"
+	grep awk --verbose $(pwd) ${HOME} ${HOME} printf x=1 export done sed awk
+		done $(pwd) $(pwd) export "$1" 'quoted text'
+readonly local readonly /usr/bin export
+	echo 2>/dev/null test awk && $(pwd) /usr/bin cd 2>/dev/null local --verbose
+printf test test grep 'quoted text' awk export cd cd done $(pwd) done 2>/dev/null
+		"$1" x=1 ${HOME} x=1 -eu export 2>/dev/null awk ${HOME}
+${HOME} /usr/bin 'quoted text' cd echo /usr/bin printf 2>/dev/null readonly
+	&& && $(pwd) done $(pwd) 'quoted text' 2>/dev/null
+		${HOME} ${HOME} done awk -eu ${HOME}
+	x=1 printf 2>/dev/null printf
+		sed sed awk test then printf
+x=1 echo x=1 test ${HOME} printf
+		readonly export /usr/bin export grep x=1 grep 'quoted text'
+${HOME} then -eu "$@" readonly 'quoted text' && ${HOME} then awk local sed
+		cd local 'quoted text' echo grep 'quoted text' 'quoted text' | ${HOME}
+'quoted text' readonly && sed
+		&& -eu x=1 "$1" "$@" done $(pwd) x=1 $(pwd) awk 2>/dev/null -eu
+	local 2>/dev/null echo test test export grep readonly test then x=1 /usr/bin done
+test --verbose $(pwd) echo awk local "$@" ${HOME}
+cd export readonly 2>/dev/null readonly cd export readonly
+$(pwd) printf | readonly then "$@" done awk
+	grep then "$1" $(pwd) "$@" export grep
+		"$@" $(pwd) printf echo /usr/bin
+	readonly local sed ${HOME} grep export 'quoted text' 'quoted text'
+	echo local && printf sed | cd cd | echo --verbose
+sed echo "$1" 'quoted text' $(pwd) "$1" "$1" echo x=1
+	"$1" /usr/bin awk "$@" grep "$1" echo --verbose x=1 && printf
+	"$@" echo echo -eu printf export export done done "$1" export
+2>/dev/null local -eu local 2>/dev/null x=1 readonly done readonly /usr/bin
+		"$1" readonly -eu | export && local -eu | echo
+		readonly awk sed 'quoted text' then "$@"
+echo readonly awk echo echo echo
+	test done "$@" ${HOME} x=1 printf sed grep awk | "$1" echo printf 'quoted text'
+done $(pwd) done done printf done awk /usr/bin 2>/dev/null && 2>/dev/null test
+	local && echo ${HOME} awk export
+"$1" -eu "$1" test done readonly --verbose cd local grep cd awk &&
+		export export && x=1 sed done test "$1" cd 2>/dev/null test export readonly
+	${HOME} then "$1" done -eu sed readonly | export printf test | /usr/bin && &&
+"$1" sed then cd "$1" done ${HOME} "$@" $(pwd)
+		x=1 2>/dev/null printf done 2>/dev/null 'quoted text'
+&& -eu && "$@" sed awk 2>/dev/null
+x=1 test "$1" ${HOME} awk sed test test 2>/dev/null $(pwd) grep cd 'quoted text'
+'quoted text' 2>/dev/null $(pwd) sed /usr/bin local
+test /usr/bin done readonly sed test sed 'quoted text' echo "$@"
+		$(pwd) 2>/dev/null "$1" -eu "$1"
+		awk && && $(pwd) printf awk export
+		2>/dev/null cd && test -eu awk readonly 'quoted text' x=1 sed local && done $(pwd)
+	"$@" | $(pwd) $(pwd) $(pwd) $(pwd) printf readonly readonly
+	readonly "$1" "$@" sed export grep cd 'quoted text'
+test | -eu cd && --verbose sed /usr/bin local /usr/bin && "$1" ${HOME} test
+sed && done local 'quoted text' --verbose --verbose
+		sed $(pwd) x=1 "$1" && "$1" ${HOME} /usr/bin /usr/bin -eu test grep --verbose
+export local $(pwd) /usr/bin $(pwd) sed sed readonly $(pwd) printf
+	x=1 | test | test -eu then /usr/bin
+${HOME} 2>/dev/null /usr/bin printf /usr/bin sed --verbose
+		-eu then -eu "$1" "$@" "$1" then "$@" "$@" "$@" $(pwd)
+x=1 printf readonly test | readonly grep ${HOME} local --verbose
+		'quoted text' 2>/dev/null /usr/bin
+/usr/bin echo export && sed done awk --verbose readonly
+	grep "$@" 2>/dev/null "$@" export printf
+		'quoted text' 'quoted text' test 'quoted text' "$@"
+	export x=1 $(pwd) readonly -eu 2>/dev/null
+	printf ${HOME} $(pwd) printf then sed -eu done --verbose
+-eu 2>/dev/null 2>/dev/null && printf done
+"$1" $(pwd) readonly x=1 readonly "$@" done &&
+	${HOME} printf echo 'quoted text' | ${HOME} done
+	"$1" -eu grep -eu 'quoted text' cd ${HOME} "$@"
+		done local /usr/bin readonly /usr/bin printf grep /usr/bin
+test | ${HOME} sed -eu -eu x=1 printf -eu "$@" /usr/bin awk printf cd readonly
+	test | | echo cd && && local grep 2>/dev/null
+	"$@" export $(pwd) grep cd /usr/bin sed x=1 readonly printf
+	"$@" "$1" grep && 2>/dev/null sed 2>/dev/null grep echo
+test x=1 echo "$1" readonly sed 2>/dev/null -eu echo echo local
+-eu sed x=1 2>/dev/null awk "$1" done x=1 grep ${HOME} printf "$1"
+echo 'quoted text' -eu
+		done cd && --verbose 'quoted text' test "$1" local --verbose then awk export
+		${HOME} echo readonly readonly /usr/bin
+cd sed && ${HOME} grep && done export done awk grep cd awk
+		awk sed | awk 2>/dev/null printf
+	&& /usr/bin then printf then && cd echo --verbose 2>/dev/null "$@" /usr/bin
+	export /usr/bin done x=1 x=1 --verbose
+	echo cd awk "$@" cd $(pwd) "$@" printf 'quoted text'
+		${HOME} sed cd /usr/bin grep export -eu printf -eu --verbose "$@" printf done echo
+		echo printf -eu --verbose "$1" --verbose
+readonly grep grep sed -eu export grep awk grep test local "$@" printf readonly
+	--verbose echo 'quoted text' sed
+	grep "$1" readonly -eu
+test --verbose $(pwd) | 2>/dev/null export then -eu | grep sed ${HOME}
+	&& test printf done awk local ${HOME}
+/usr/bin && awk ${HOME} "$@"
+	then $(pwd) then "$1" 'quoted text'
+cd grep cd -eu echo "$1" /usr/bin export cd 'quoted text' | export --verbose
+		sed ${HOME} "$@" test grep | && test /usr/bin | test printf && --verbose "$@" -eu
+2>/dev/null echo "$@" && then 2>/dev/null "$1" echo 2>/dev/null export
+	"$@" | 2>/dev/null printf readonly --verbose | $(pwd) -eu $(pwd) $(pwd) x=1
+readonly --verbose ${HOME} done export printf readonly | done local | "$1"
+		$(pwd) printf && $(pwd) test /usr/bin | cd $(pwd) echo &&
+	-eu 'quoted text' echo "$1"
+| sed grep /usr/bin awk then export ${HOME}
+		"$@" 'quoted text' sed
+	local local printf 2>/dev/null "$1" echo export printf "$1" ${HOME}
+		done ${HOME} | && cd ${HOME} $(pwd) x=1 cd export grep grep /usr/bin
+	cd /usr/bin ${HOME} test -eu cd
+&& awk grep readonly local "$1" -eu "$1" local
+'quoted text' --verbose sed sed echo local sed && "$1" | -eu 'quoted text' 2>/dev/null
+cd -eu export && | --verbose local x=1 "$@" 'quoted text'
+	local local echo grep && "$@" | 2>/dev/null local export
+	"$@" test | export export && awk 'quoted text' "$@"
+--verbose -eu then grep ${HOME}
+		"$1" then readonly readonly cd "$@" -eu
+"$@" sed cd -eu "$@" --verbose --verbose "$1" /usr/bin
+		x=1 x=1 test readonly | echo /usr/bin cd x=1 $(pwd) done export /usr/bin
+		--verbose then ${HOME} cd awk 'quoted text' /usr/bin $(pwd) sed sed
+cd test done 'quoted text' x=1
+		"$1" printf $(pwd) "$@" | export 'quoted text' readonly ${HOME} /usr/bin
+local cd printf x=1 done sed && test x=1 x=1
+		printf -eu done 'quoted text' 'quoted text' ${HOME} $(pwd) sed x=1
+	grep "$1" done 2>/dev/null /usr/bin &&
+		"$1" 'quoted text' && grep sed export ${HOME} ${HOME} 'quoted text' echo ${HOME}
+	echo --verbose "$@" && then echo ${HOME}
+--verbose sed $(pwd) | test ${HOME} printf "$1" && grep && echo done
+	$(pwd) 2>/dev/null -eu done -eu test cd $(pwd) awk export grep 'quoted text'
+	then printf "$@" done $(pwd) then echo $(pwd) readonly awk
+	x=1 printf "$@" -eu sed $(pwd) printf readonly /usr/bin
+		awk grep awk test 'quoted text'
+	"$1" | cd grep then sed --verbose | awk
+awk --verbose echo && export --verbose test "$@" then local x=1 /usr/bin grep
+		/usr/bin && readonly 'quoted text' ${HOME} local printf $(pwd) "$1" "$@" readonly
+| 'quoted text' 'quoted text'
+	"$1" grep sed "$@" then
+		/usr/bin --verbose -eu grep
+		-eu $(pwd) && awk && echo /usr/bin readonly grep sed then x=1 ${HOME}
+		'quoted text' x=1 echo then x=1 awk
+		&& export done 2>/dev/null 2>/dev/null --verbose
+		printf 2>/dev/null && -eu awk --verbose readonly then -eu
+${HOME} echo $(pwd) echo readonly test echo 'quoted text' local "$1"
+export $(pwd) x=1 cd ${HOME} cd x=1 printf
+test then grep done test printf
+	-eu local then -eu test readonly grep
+	"$1" test /usr/bin test "$@" then echo done done readonly | local ${HOME}
+/usr/bin grep sed readonly && 2>/dev/null 'quoted text'
+sed ${HOME} -eu "$1" readonly --verbose then "$@" cd | $(pwd) --verbose
+export /usr/bin && test test awk | 2>/dev/null test $(pwd) export
+		test | $(pwd) x=1 2>/dev/null "$@" export cd 'quoted text' export then
+	/usr/bin && ${HOME} echo local then "$@" done -eu "$@" $(pwd) local
+"$1" sed cd x=1 | grep /usr/bin /usr/bin readonly && local
+	test 2>/dev/null && sed "$@" x=1 -eu x=1
+sed sed local 2>/dev/null
+		awk "$@" sed 2>/dev/null | $(pwd) $(pwd) $(pwd) then local
+		2>/dev/null readonly echo awk then x=1 then "$1" $(pwd) "$@"
+		| then -eu $(pwd) ${HOME} cd
+-eu /usr/bin && grep awk test readonly
+	--verbose --verbose readonly 2>/dev/null ${HOME} 'quoted text'
+	"$@" done cd sed cd awk grep printf 'quoted text' x=1 local done awk -eu export
+${HOME} then $(pwd) then && && cd /usr/bin sed cd --verbose
+${HOME} "$1" awk cd test done local ${HOME} &&
+sed sed "$@" done sed test
+awk export echo "$@" sed export test readonly --verbose && ${HOME}
+		test 2>/dev/null test local -eu awk sed
+	&& "$@" sed ${HOME} export -eu done 'quoted text' done x=1
+	cd then readonly x=1 local --verbose
+	| -eu then echo then test ${HOME} export echo
+		"$@" grep && x=1 2>/dev/null
+	grep --verbose sed export ${HOME} printf
+		sed "$@" sed $(pwd) cd x=1 done done grep cd "$@" done "$1"
+echo local /usr/bin local printf sed readonly 2>/dev/null sed "$@" readonly
+		cd --verbose -eu -eu -eu 2>/dev/null "$1" readonly sed "$@"
+awk --verbose cd | 2>/dev/null
+	done local --verbose 'quoted text' | test /usr/bin "$@" awk
+		awk then | 2>/dev/null $(pwd) done sed
+		awk x=1 sed /usr/bin grep -eu | export
+done local cd export "$@"
+		grep awk "$1" awk --verbose && 'quoted text'
+		done "$1" "$@" local cd /usr/bin printf export ${HOME} ${HOME}
+		cd -eu $(pwd) $(pwd) awk sed $(pwd) 2>/dev/null
+	'quoted text' awk --verbose printf && "$1" readonly echo awk x=1 ${HOME}
+		then export done 2>/dev/null 2>/dev/null printf
+'quoted text' && x=1 printf echo grep ${HOME}
+	&& printf done $(pwd) ${HOME} --verbose "$1" ${HOME} 'quoted text'
+	export done then 2>/dev/null x=1 printf "$@" 'quoted text' ${HOME} sed awk --verbose
+	test --verbose /usr/bin local test test local awk sed --verbose readonly
+	| -eu $(pwd) sed /usr/bin ${HOME} -eu 'quoted text' local readonly
+done readonly -eu export | test local
+		'quoted text' readonly then ${HOME}
+		"$@" export sed printf sed readonly local local test
+$(pwd) --verbose sed cd ${HOME}
+		${HOME} $(pwd) echo readonly
+	awk sed --verbose then ${HOME} "$1" -eu local test local -eu ${HOME} x=1 grep x=1
+		-eu 'quoted text' grep done export | x=1
+		grep 2>/dev/null "$@" cd 'quoted text' 'quoted text' awk && 'quoted text'
+$(pwd) readonly --verbose $(pwd) -eu --verbose grep test
+2>/dev/null ${HOME} grep awk cd && local readonly $(pwd)
+	sed --verbose | ${HOME} local 'quoted text' echo "$@" ${HOME} awk printf
+		'quoted text' export export "$@" 'quoted text' --verbose
+		| local /usr/bin x=1 cd test readonly test 'quoted text' echo export
+		${HOME} test sed grep cd sed readonly awk sed 'quoted text' ${HOME}
+2>/dev/null --verbose then cd $(pwd)
+	printf local test grep sed local echo $(pwd) test /usr/bin readonly -eu -eu
+	&& | -eu printf $(pwd) x=1 grep done --verbose
+	local awk grep then awk /usr/bin 'quoted text' | 'quoted text'
+	"$@" --verbose && x=1 then /usr/bin awk sed printf
+	awk 2>/dev/null 2>/dev/null $(pwd) -eu "$1" export
+		--verbose ${HOME} printf x=1 grep "$@" $(pwd) 'quoted text' export
+		grep | /usr/bin export then
+	test -eu awk "$@" readonly sed
+	grep test "$1" then 2>/dev/null | "$@" done sed sed
+-eu then 'quoted text' -eu $(pwd) 2>/dev/null /usr/bin grep
+	grep "$@" ${HOME} done 2>/dev/null
+"$@" && 2>/dev/null then -eu
+/usr/bin echo "$@" "$1" local sed test printf /usr/bin "$1" echo awk cd
+		"$1" export "$@" local grep -eu local 2>/dev/null $(pwd) done x=1 /usr/bin
+done sed 2>/dev/null grep && then printf cd test "$@" /usr/bin
+	&& 2>/dev/null | "$1" && export 'quoted text' 2>/dev/null grep done test printf
+		| 'quoted text' echo sed | ${HOME} echo printf
+"$1" --verbose x=1 done | readonly awk "$@" "$@" export
+		'quoted text' 'quoted text' && $(pwd) x=1 'quoted text'
+		| local sed readonly --verbose test
+		"$1" export grep x=1 "$1" ${HOME} sed awk "$@" "$1" "$1" sed x=1
+		readonly | test && sed
+	cd 'quoted text' -eu done sed awk "$1" /usr/bin local -eu export then /usr/bin
+	export readonly x=1 test local
+		'quoted text' /usr/bin ${HOME} /usr/bin done
+	done "$1" /usr/bin cd 2>/dev/null done $(pwd) ${HOME} | cd cd grep && readonly
+	echo && test done && ${HOME} 'quoted text' awk local readonly $(pwd) x=1
+printf echo done x=1 readonly test --verbose "$1" export
+echo export awk -eu --verbose 2>/dev/null test --verbose
+	-eu x=1 "$1" "$@" x=1
+-eu 2>/dev/null /usr/bin awk printf "$1" export then local then
+		then then x=1 | 'quoted text' awk 'quoted text' printf readonly
+	export 'quoted text' cd readonly --verbose
+then grep sed export done sed sed awk export ${HOME} cd "$@" done local local test
+	readonly grep echo && 'quoted text'
+${HOME} printf "$1" x=1 /usr/bin
+	--verbose grep && $(pwd) local -eu ${HOME} "$@"
+	"$1" test export ${HOME}
+	$(pwd) test export export x=1 | printf "$@" cd then 2>/dev/null
+${HOME} done awk "$@" export done -eu awk /usr/bin readonly cd export
+--verbose test local -eu -eu | /usr/bin then local && readonly ${HOME}
+-eu test -eu grep -eu ${HOME} ${HOME} $(pwd) /usr/bin
+		&& -eu readonly x=1 -eu 'quoted text' grep echo printf /usr/bin
+		readonly | export grep &&
+	test --verbose "$@" | --verbose "$@" grep && test
+		x=1 "$1" && sed grep 'quoted text' ${HOME} echo && test
+		x=1 $(pwd) printf 2>/dev/null
+		printf 'quoted text' sed then readonly test -eu "$@" x=1
+-eu done && "$1" local local test && --verbose awk cd
+grep printf awk sed 'quoted text' export && grep
+	/usr/bin cd printf then local done grep /usr/bin 2>/dev/null x=1 cd &&
+		--verbose 'quoted text' /usr/bin "$1" ${HOME} | export
+		grep local | -eu -eu /usr/bin 'quoted text' test sed local export local
+'quoted text' local local local x=1 -eu echo /usr/bin /usr/bin "$@" 'quoted text'
+	| cd | --verbose export -eu printf ${HOME} then "$@" "$1" test
+/usr/bin 'quoted text' ${HOME} sed printf then
+		"$@" sed x=1 ${HOME} grep -eu "$1"
+	echo x=1 -eu then "$1" local export /usr/bin test $(pwd) awk "$1" done
+		printf --verbose x=1 export sed grep
+	-eu "$1" ${HOME} $(pwd) printf
+	done ${HOME} cd "$@" echo test 2>/dev/null done -eu /usr/bin
+	--verbose | test test awk 'quoted text' && export awk
+	grep cd export printf x=1 /usr/bin then -eu 2>/dev/null --verbose
+		export printf local "$@" local cd | done ${HOME} --verbose | printf && awk
+		x=1 printf awk awk export ${HOME} /usr/bin | echo x=1 "$@"
+	/usr/bin cd -eu x=1 "$1" awk test cd -eu readonly -eu sed echo echo
+grep export echo then then done 2>/dev/null grep
+'quoted text' | sed then echo --verbose
+		echo "$1" /usr/bin "$1" /usr/bin printf
+	${HOME} local sed test --verbose -eu $(pwd)
+		/usr/bin printf x=1 /usr/bin && awk local sed 'quoted text' && echo --verbose
+		${HOME} test sed then
+	$(pwd) "$@" | sed cd awk "$1" /usr/bin printf sed done -eu
+	export "$@" /usr/bin then grep local "$@"
+$(pwd) $(pwd) -eu sed && awk grep x=1 "$1" "$1" export
+		export printf local /usr/bin
+	${HOME} /usr/bin --verbose export && export
+		readonly test done export -eu | --verbose echo 2>/dev/null echo "$@"
+	2>/dev/null then readonly grep ${HOME} 'quoted text'
+readonly test /usr/bin cd grep "$@" awk && $(pwd)
+		$(pwd) echo -eu sed "$@" $(pwd) local /usr/bin "$@" /usr/bin
+	local $(pwd) --verbose echo -eu ${HOME}
+	printf --verbose "$1" cd ${HOME} /usr/bin x=1 then local sed
+"$@" /usr/bin sed x=1 export readonly "$@" sed "$1" echo printf local cd sed
+	then grep | test --verbose 2>/dev/null && sed awk
+		--verbose 2>/dev/null -eu awk && export sed sed done | -eu ${HOME}
+done "$@" done sed --verbose readonly sed "$@" awk
+	2>/dev/null printf $(pwd) echo
+&& cd -eu local grep && readonly export $(pwd) export then echo readonly
+	export | local done readonly
+		done --verbose echo && x=1 echo -eu
+	grep awk then 2>/dev/null ${HOME} grep
+awk 2>/dev/null local --verbose export sed --verbose sed
+	${HOME} "$1" export $(pwd) grep readonly
+	/usr/bin readonly ${HOME} then &&
+"$@" 2>/dev/null && && readonly 'quoted text' printf --verbose
+		"$1" grep | | export 2>/dev/null cd 2>/dev/null --verbose x=1 cd | $(pwd)
+	$(pwd) $(pwd) grep ${HOME} local | grep
+		sed "$@" printf readonly local echo readonly cd
+		echo awk export awk $(pwd) sed awk 'quoted text'
+		export grep done 2>/dev/null echo x=1 "$1" $(pwd) grep "$@" printf
+"$@" -eu readonly test 'quoted text' && 2>/dev/null x=1 local awk
+		local | printf cd cd grep printf "$@" sed grep ${HOME}
+then done x=1 local readonly sed sed x=1
+	then test printf then export then test && --verbose
+		"$@" done echo echo then then --verbose "$1" ${HOME} cd grep 'quoted text'
+	then 2>/dev/null done "$1" x=1 ${HOME} $(pwd)
+"$1" 2>/dev/null done test then "$1" printf grep 2>/dev/null echo "$1" local
+	${HOME} echo awk "$1" echo 2>/dev/null 'quoted text' done &&
+	'quoted text' then ${HOME} | done
+sed "$@" --verbose "$1" echo
+echo cd local "$1" ${HOME} then export printf ${HOME} sed test export readonly
+	${HOME} grep readonly grep /usr/bin awk 'quoted text' 2>/dev/null export
+export --verbose "$1" --verbose test
+	grep awk printf then /usr/bin x=1 sed grep
+		2>/dev/null printf done -eu grep | ${HOME} sed grep "$1"
+/usr/bin 2>/dev/null -eu sed cd --verbose cd ${HOME} "$1" grep "$@"
+		/usr/bin local 'quoted text' 'quoted text' -eu cd -eu && 'quoted text'
+${HOME} printf --verbose /usr/bin "$@" printf | echo | --verbose 2>/dev/null
+		$(pwd) printf 2>/dev/null && | ${HOME}
+		"$1" cd $(pwd) printf echo then && 2>/dev/null test awk
+cd /usr/bin done $(pwd)
+2>/dev/null --verbose | cd
+		&& --verbose ${HOME} -eu $(pwd)
+	'quoted text' cd "$@" printf x=1 --verbose "$1" | ${HOME} cd | done "$1"
+'quoted text' export $(pwd) | $(pwd) done && printf 'quoted text' -eu local
+	'quoted text' test grep done
+done --verbose done done echo printf
+"$@" | $(pwd) -eu ${HOME} export "$1" local printf 2>/dev/null "$1" --verbose
+		test 2>/dev/null sed readonly $(pwd) local grep /usr/bin --verbose x=1 x=1
+		awk --verbose "$1" 'quoted text'
+| /usr/bin readonly then echo echo printf /usr/bin && && "$@" cd test grep ${HOME}
+		printf ${HOME} printf export /usr/bin
+		local cd test /usr/bin done x=1
+		grep && 'quoted text' x=1 -eu -eu grep
+	awk ${HOME} "$1" echo -eu &&
+		"$@" "$@" printf 2>/dev/null
+	sed --verbose done readonly then --verbose 2>/dev/null | && 2>/dev/null
+		grep readonly -eu cd awk | --verbose export $(pwd) $(pwd) local | | "$1"
+&& printf --verbose done /usr/bin "$@" && printf test export $(pwd) done awk
+	then && "$@" sed awk local echo then 2>/dev/null readonly "$1" sed export /usr/bin
+printf 2>/dev/null printf test
+'quoted text' echo ${HOME} grep awk "$@"
+echo 'quoted text' grep $(pwd) 'quoted text'
+	| readonly 'quoted text' "$@"
+		--verbose -eu x=1 x=1 /usr/bin | && 2>/dev/null export | 2>/dev/null
+	-eu local | done | grep && 'quoted text' echo 'quoted text' 'quoted text'
+2>/dev/null sed cd "$1" /usr/bin done sed
+grep -eu test | export /usr/bin
+		$(pwd) -eu 2>/dev/null 'quoted text' export cd echo local 'quoted text' cd "$1"
+		sed then echo | cd awk | then readonly done 'quoted text'
+	printf then "$@" test cd then
+	sed /usr/bin done ${HOME}
+"$1" grep echo "$1" $(pwd) --verbose && awk ${HOME} cd --verbose cd && -eu -eu
+		grep done -eu sed export ${HOME}
+		printf cd && sed printf $(pwd) -eu test "$1" "$@"
+		-eu /usr/bin "$1" 2>/dev/null 'quoted text' && grep &&
+		/usr/bin done ${HOME} 'quoted text' cd "$1" && --verbose x=1 2>/dev/null
+	printf --verbose $(pwd) ${HOME} printf done ${HOME} printf
+		awk x=1 awk sed then "$1" $(pwd) "$@"
+		awk sed test 'quoted text' then done test test sed
+		sed /usr/bin sed 'quoted text' echo -eu 2>/dev/null -eu -eu "$1" /usr/bin /usr/bin
+	export /usr/bin export sed then 2>/dev/null
+		cd --verbose "$@" readonly -eu readonly x=1 readonly test
+${HOME} cd cd x=1 grep ${HOME}
+		sed 'quoted text' echo "$1" sed | test /usr/bin
+		'quoted text' "$1" | "$1" -eu "$1" cd && ${HOME} ${HOME} cd cd ${HOME}
+	${HOME} 'quoted text' then readonly -eu | local "$1"
+	"$@" /usr/bin awk grep readonly && local done ${HOME}
+	echo echo grep "$1" printf awk export cd 2>/dev/null 'quoted text' $(pwd)
+	test done local grep 'quoted text'
+		test $(pwd) -eu | awk printf then -eu printf 2>/dev/null x=1 && done -eu &&
+x=1 test done 2>/dev/null cd local cd export --verbose
+/usr/bin 'quoted text' $(pwd) /usr/bin ${HOME} printf done
+'quoted text' x=1 ${HOME} test local "$1"
+	| then awk 2>/dev/null awk readonly
+grep 'quoted text' export local echo test "$@"
+then cd $(pwd) /usr/bin /usr/bin 2>/dev/null readonly x=1 then
+${HOME} x=1 ${HOME} /usr/bin readonly awk readonly
+		done "$1" cd local ${HOME} $(pwd) 2>/dev/null export ${HOME}
+readonly && local printf awk "$1" && && x=1 echo 'quoted text'
+		echo echo test export then 'quoted text' test awk done awk && cd test ${HOME}
+	2>/dev/null 2>/dev/null 'quoted text' -eu echo grep
+printf echo echo grep readonly
+	done readonly then && readonly &&
+	&& /usr/bin sed then | /usr/bin grep
+printf -eu ${HOME} grep test --verbose grep awk export |
+then ${HOME} then ${HOME} printf -eu local /usr/bin test x=1 awk "$@"
+		'quoted text' echo "$1" | sed ${HOME} x=1
+$(pwd) echo cd cd --verbose sed --verbose export 'quoted text' awk --verbose
+		'quoted text' 2>/dev/null awk echo cd
+2>/dev/null --verbose 2>/dev/null then --verbose ${HOME}
+		$(pwd) "$@" "$1" sed printf test grep
+printf export x=1 2>/dev/null "$@" awk readonly 'quoted text'
+&& --verbose -eu cd awk 2>/dev/null
+printf sed ${HOME} ${HOME} ${HOME}
+		--verbose --verbose sed echo x=1 --verbose cd
+export sed cd "$1" 'quoted text' readonly grep && 2>/dev/null -eu then
+	&& echo test $(pwd) local x=1 printf "$1" export
+-eu 2>/dev/null readonly then "$1" done /usr/bin cd export test
+	readonly export --verbose printf echo --verbose "$1" --verbose echo ${HOME}
+	${HOME} "$@" /usr/bin done | sed ${HOME} 2>/dev/null printf export
+--verbose | readonly ${HOME} 2>/dev/null 2>/dev/null x=1 && done | &&
+	grep | -eu x=1 local echo
+		-eu echo printf done "$@" "$1" test grep $(pwd)
+	readonly done x=1 -eu export then echo test echo -eu local --verbose
+		'quoted text' cd echo ${HOME} awk echo export sed
+export echo -eu ${HOME} "$1" done
+	2>/dev/null grep sed done "$@" local sed export test export ${HOME} ${HOME}
+		"$1" local export sed readonly cd local 2>/dev/null $(pwd) --verbose -eu --verbose
+	$(pwd) && local then echo sed --verbose test --verbose 'quoted text'
+	export export printf export -eu grep &&
+		| "$@" $(pwd) && x=1 && | test && readonly $(pwd)
+awk export test -eu -eu printf | local 2>/dev/null cd -eu grep
+		awk 2>/dev/null awk export ${HOME}
+	-eu ${HOME} grep --verbose -eu test x=1 awk && then done && cd then export
+&& 'quoted text' then readonly
+	'quoted text' --verbose $(pwd) ${HOME} readonly
+		grep --verbose && awk ${HOME}
+printf 2>/dev/null &&
+	/usr/bin readonly $(pwd) $(pwd) echo && test test readonly /usr/bin /usr/bin
+		cd 2>/dev/null test "$1" -eu x=1 $(pwd) printf
+| x=1 sed test "$1" then
+grep "$1" x=1 local ${HOME} sed local printf
+	/usr/bin then sed && $(pwd) done --verbose
+	/usr/bin | $(pwd) then awk /usr/bin echo
+	${HOME} && awk cd printf echo x=1 "$@" echo echo 2>/dev/null
+		x=1 sed $(pwd) $(pwd) sed awk awk /usr/bin sed
+		export done ${HOME} awk awk grep "$@" cd x=1 /usr/bin && ${HOME} 2>/dev/null ${HOME}
+2>/dev/null printf grep then 'quoted text' grep done grep
+then -eu readonly | && readonly && awk echo --verbose
+grep "$1" export ${HOME} 'quoted text'
+		x=1 2>/dev/null $(pwd) | then /usr/bin
+		local "$@" local done "$1" sed export sed | cd local | 2>/dev/null $(pwd)
+	/usr/bin grep 2>/dev/null readonly readonly /usr/bin && done grep
+export x=1 local export test
+	local 'quoted text' done then
+		printf | awk x=1 'quoted text' test local awk cd
+"$@" awk | 2>/dev/null /usr/bin -eu
+		-eu cd cd 'quoted text' && /usr/bin && | export /usr/bin grep "$1" cd done -eu
+		/usr/bin $(pwd) $(pwd) /usr/bin echo 2>/dev/null
+		test echo cd | "$1" printf done && awk sed x=1 cd --verbose readonly && done
+		| -eu ${HOME} sed awk "$@" | echo && "$@" done "$@" "$1" printf
+	&& "$1" "$@" export readonly 2>/dev/null readonly
+		sed readonly /usr/bin awk "$1"
+sed readonly then $(pwd) "$@" x=1
+		local --verbose local
+		test x=1 export awk sed grep 'quoted text' && /usr/bin
+	-eu echo done sed printf readonly test done test ${HOME}
+		done ${HOME} local test && awk then
+-eu 2>/dev/null $(pwd) local done --verbose done x=1 cd readonly --verbose
+	${HOME} 'quoted text' echo x=1 grep 'quoted text'
+'quoted text' sed local then /usr/bin echo awk local then readonly
+		test 2>/dev/null | /usr/bin
+&& printf printf readonly export printf done | sed
+		| "$@" | sed "$@" printf export echo sed cd 2>/dev/null awk
+	then -eu && awk "$@" echo sed export
+	| printf -eu export "$1" test cd 'quoted text'
+	$(pwd) "$1" | grep echo grep local $(pwd) "$1" 'quoted text'
+		done 2>/dev/null 'quoted text' done 'quoted text'
+then "$@" /usr/bin --verbose
+"$@" then "$@" $(pwd) -eu
+	awk x=1 awk 2>/dev/null "$@" readonly sed
+'quoted text' test && printf $(pwd) awk then "$@" local ${HOME} -eu
+	then awk local export "$1" 'quoted text' 'quoted text' then echo
+		cd x=1 local "$@" sed printf ${HOME}
+echo $(pwd) "$@" test |
+		awk -eu export && $(pwd) done printf
+	/usr/bin echo && local awk | | readonly
+		2>/dev/null -eu echo && "$@" 2>/dev/null && 2>/dev/null export printf "$1"
+		grep x=1 export export local && ${HOME}
+		-eu "$1" done done readonly /usr/bin -eu awk grep x=1
+		--verbose 'quoted text' 'quoted text'
+x=1 $(pwd) printf cd then cd -eu x=1 then grep local
+	-eu x=1 echo "$@" | | | readonly
+	x=1 "$@" sed readonly local printf test 'quoted text' $(pwd) -eu grep readonly
+		&& "$1" echo 2>/dev/null test test "$1" "$1" readonly test readonly -eu
+	echo 'quoted text' export && --verbose local export 2>/dev/null cd export
+		local local ${HOME} awk readonly echo
+echo ${HOME} export -eu awk ${HOME} && local $(pwd) -eu
+awk then | done $(pwd) /usr/bin done done test export ${HOME} 'quoted text' then
+	grep cd readonly grep x=1 'quoted text' -eu readonly && 2>/dev/null
+-eu cd sed 'quoted text' then test --verbose sed ${HOME} "$@" then
+	"$1" local -eu --verbose awk "$1"
+	awk ${HOME} readonly --verbose cd test readonly printf printf awk awk sed /usr/bin
+"$@" "$1" printf sed ${HOME} $(pwd) | -eu && cd then awk
+&& ${HOME} -eu readonly sed /usr/bin
+		"$1" "$@" 'quoted text' readonly test /usr/bin readonly
+local local x=1 ${HOME} x=1 test 2>/dev/null
+	then echo 'quoted text' printf local sed echo done readonly x=1 "$1" ${HOME} export
+sed 2>/dev/null grep grep /usr/bin export && ${HOME} echo
+		test ${HOME} awk done 2>/dev/null --verbose printf x=1 -eu printf
+	readonly -eu sed sed export export $(pwd) -eu 'quoted text'
+	then x=1 "$@" /usr/bin done awk 'quoted text' cd local grep printf then --verbose
+		echo $(pwd) test x=1 then export local export done
+		"$1" readonly | cd grep printf
+	done /usr/bin "$1" "$@" --verbose
+		printf "$@" --verbose 2>/dev/null ${HOME} ${HOME}
+	2>/dev/null printf && export "$@" && export
+	x=1 printf test /usr/bin sed
+$(pwd) "$1" $(pwd) grep
+		readonly printf -eu -eu 2>/dev/null $(pwd) | --verbose
+"$1" echo done | | $(pwd) export -eu -eu local && cd then "$1" && readonly
+	printf local "$@" readonly "$1" 2>/dev/null awk $(pwd) "$1"
+	readonly "$1" "$1" "$1"
+		$(pwd) --verbose ${HOME} /usr/bin local "$@" local readonly grep
+	cd /usr/bin ${HOME} $(pwd) grep $(pwd)
+	local $(pwd) "$1" grep grep x=1 | "$1" then export printf
+		&& sed $(pwd) ${HOME} ${HOME} && then /usr/bin echo | -eu x=1 |
+		awk /usr/bin 'quoted text' then echo --verbose cd /usr/bin
+	2>/dev/null readonly test
+		readonly test 'quoted text' test export -eu done
+		readonly $(pwd) awk "$1" test
+		test "$@" local local "$@" --verbose
+		awk sed /usr/bin x=1 export && $(pwd) 'quoted text' ${HOME} grep && -eu test done
+	local cd "$@" --verbose "$@" 2>/dev/null readonly &&
+		--verbose 'quoted text' 'quoted text' && && /usr/bin readonly /usr/bin
+	--verbose && 'quoted text' export 'quoted text' x=1 -eu "$1" test local
+		printf $(pwd) 2>/dev/null 2>/dev/null done local 2>/dev/null ${HOME} $(pwd)
+		&& -eu --verbose printf --verbose local ${HOME}
+	/usr/bin --verbose export
+-eu /usr/bin $(pwd) readonly
+		cd printf grep | 'quoted text' $(pwd) 'quoted text'
+	test "$1" "$@" done done "$1" test sed "$@" test
+	cd | echo $(pwd) grep local echo sed "$1" cd | echo sed sed ${HOME} echo
+'quoted text' --verbose ${HOME} awk | | /usr/bin -eu /usr/bin test export echo
+/usr/bin cd echo then -eu $(pwd) echo test awk done 'quoted text' x=1 local
+	readonly sed --verbose $(pwd)
+	| export export $(pwd) -eu local echo local | --verbose $(pwd)
+	printf local awk local 2>/dev/null then echo -eu /usr/bin
+--verbose x=1 local | cd ${HOME} then echo ${HOME} | x=1
+| local /usr/bin sed "$@" /usr/bin
+then "$@" awk awk printf
+	export grep grep x=1 --verbose
+		readonly export /usr/bin $(pwd) && echo
+#include c223.sh
+	test 2>/dev/null x=1 grep 'quoted text'
+	${HOME} /usr/bin /usr/bin export 'quoted text'
+export "$1" 'quoted text' grep /usr/bin --verbose "$@" --verbose test
+$(pwd) local --verbose grep $(pwd)
+		$(pwd) printf readonly ${HOME} | readonly sed | ${HOME} /usr/bin /usr/bin readonly
+	cd /usr/bin then cd x=1 'quoted text' export && export "$@" then
+--verbose /usr/bin | x=1 awk test
+| printf printf "$@" -eu $(pwd) sed sed 'quoted text' done | |
+	export export "$1" 'quoted text' && $(pwd) 'quoted text'
+		done sed awk grep "$1" grep sed | readonly "$@" && -eu | -eu -eu
+		${HOME} local | cd ${HOME} awk sed | sed awk | -eu cd 'quoted text'
+	cd | 2>/dev/null x=1
+awk /usr/bin "$1" test && "$@" awk "$@" -eu "$1"
+	"$@" 'quoted text' /usr/bin --verbose awk grep --verbose
+done --verbose then /usr/bin
+local x=1 then test && then
+	| export cd printf cd | ${HOME}
+	${HOME} echo ${HOME} awk then echo "$@" export /usr/bin 2>/dev/null
+		'quoted text' test | 'quoted text' readonly /usr/bin && "$@" printf --verbose
+	x=1 -eu ${HOME} test "$@" -eu export /usr/bin
+"$1" cd | printf sed grep 2>/dev/null local awk done "$@"
+		${HOME} export sed x=1 $(pwd) done cd -eu && done then local
+	x=1 then test 2>/dev/null --verbose $(pwd) printf 'quoted text' 'quoted text'
+grep local cd awk printf sed $(pwd) test export --verbose
+		"$@" --verbose 2>/dev/null "$1" "$1" x=1 | awk "$@" 2>/dev/null
+		/usr/bin /usr/bin $(pwd) awk test echo "$@" awk
+	printf "$@" done 2>/dev/null printf
+$(pwd) then "$1" "$@" awk 2>/dev/null awk readonly test && then -eu cd
+	export -eu export 'quoted text'
+grep done $(pwd) "$@" 2>/dev/null
+	| done x=1 readonly done ${HOME} ${HOME} && "$@"
+	"$@" && x=1 --verbose x=1 grep x=1 printf
+		'quoted text' x=1 done "$1"
+	export cd -eu local export --verbose /usr/bin --verbose /usr/bin | done sed local
+'quoted text' sed awk $(pwd) local printf $(pwd) awk /usr/bin
+2>/dev/null "$1" local ${HOME} $(pwd) cd done export then echo
+		'quoted text' 'quoted text' grep 'quoted text' | local --verbose
+		then $(pwd) 'quoted text' -eu
+		/usr/bin --verbose awk cd awk printf
+		"$1" x=1 awk export $(pwd) ${HOME} test /usr/bin /usr/bin 'quoted text' --verbose
+		&& && 'quoted text' printf grep awk echo &&
+"$@" awk local awk /usr/bin cd "$@" 2>/dev/null ${HOME} test "$@" then "$1" done
+	/usr/bin && done x=1 sed "$@" -eu "$@" -eu --verbose ${HOME} x=1 local
+	cd $(pwd) | grep 'quoted text' 2>/dev/null $(pwd) awk grep 'quoted text' then
+		done printf "$1" cd local /usr/bin done "$1" local export test
+		$(pwd) export sed | -eu 'quoted text'
+"$@" sed echo ${HOME} local printf --verbose
+	$(pwd) /usr/bin local | then export then ${HOME} local -eu test /usr/bin
+		'quoted text' awk ${HOME} "$1" "$1" test test test "$1" cd "$1" sed
+	sed 'quoted text' grep 2>/dev/null
+		then then done -eu && cd x=1 done
+	2>/dev/null /usr/bin test sed
+		done readonly awk awk done grep awk awk export x=1 export done --verbose /usr/bin
+		x=1 done && export export | printf grep "$1" --verbose
+	local x=1 test && 2>/dev/null echo awk
+		$(pwd) --verbose $(pwd) "$1" ${HOME} export test
+	/usr/bin "$@" local then sed test echo x=1 'quoted text'
+	&& printf $(pwd) --verbose sed done $(pwd) /usr/bin --verbose 2>/dev/null
+test && then "$1" /usr/bin && x=1 awk local
+	grep test 2>/dev/null "$@" "$@" readonly && "$1" awk printf "$@" 'quoted text'
+${HOME} sed /usr/bin | test test "$@" --verbose && && local ${HOME} done test
+		&& /usr/bin local sed echo local test ${HOME} ${HOME} x=1 echo && grep
+	sed /usr/bin x=1 done -eu -eu | | printf 'quoted text' test
+		readonly printf printf awk readonly then ${HOME}
+	export test grep grep "$@" -eu cd readonly
+		/usr/bin 2>/dev/null | ${HOME} printf --verbose export cd grep
+&& -eu x=1 awk ${HOME} sed
+		--verbose test | 2>/dev/null | readonly $(pwd) readonly ${HOME} local
+	-eu then readonly echo cd awk printf ${HOME}
+	--verbose -eu /usr/bin readonly
+		| -eu -eu --verbose --verbose echo "$1" export 2>/dev/null ${HOME} test echo
+done grep "$@" 'quoted text'
+-eu && 'quoted text' local then ${HOME} export "$1" readonly | grep
+		test "$@" echo /usr/bin sed | "$1" ${HOME} done echo
+		grep echo --verbose | ${HOME} /usr/bin export | "$@" "$1" awk x=1 -eu x=1
+'quoted text' && 'quoted text' && && | 'quoted text' /usr/bin
+		echo sed "$1" done awk grep grep ${HOME} &&
+done echo local sed "$1" x=1 sed
+	"$@" x=1 2>/dev/null | awk readonly
+		2>/dev/null readonly | sed
+		sed 'quoted text' echo 2>/dev/null local readonly then ${HOME}
+2>/dev/null test done local $(pwd) --verbose cd -eu printf sed
+		readonly 2>/dev/null x=1 printf grep readonly
+		local ${HOME} readonly 2>/dev/null $(pwd)
+	awk then 'quoted text' test 2>/dev/null "$1" | | echo export 2>/dev/null
+		-eu echo printf x=1 awk export $(pwd) printf echo
+"$@" echo 'quoted text' 2>/dev/null "$1" --verbose
+		echo then x=1 awk test done -eu "$1" && x=1 test sed sed x=1 echo
+&& local echo sed export export "$@" -eu $(pwd) test readonly 'quoted text'
+'quoted text' done -eu sed then cd done --verbose
+		| $(pwd) cd awk "$1" /usr/bin && done printf grep test --verbose
+		x=1 readonly | x=1 done readonly "$1" x=1 awk -eu "$@" printf local
+-eu then grep local "$1" readonly awk echo | 2>/dev/null ${HOME}
+sed cd $(pwd) then x=1 then test readonly
+--verbose sed /usr/bin | grep readonly
+		then | /usr/bin cd test --verbose
+		grep $(pwd) sed sed 'quoted text' local then done
+--verbose local cd && readonly "$@" && sed x=1 test &&
+	&& x=1 "$1" printf sed --verbose --verbose cd ${HOME}
+	"$1" then printf sed x=1 ${HOME} then cd grep export -eu | -eu printf
+"$1" echo "$@" sed printf then 2>/dev/null test export
+	| echo printf 2>/dev/null grep awk awk $(pwd) /usr/bin
+		"$1" "$1" /usr/bin x=1 $(pwd) readonly test 2>/dev/null export -eu done | "$@"
+	awk readonly | then readonly -eu export /usr/bin ${HOME}
+-eu --verbose test 2>/dev/null $(pwd) cd awk /usr/bin --verbose
+x=1 then echo x=1 export ${HOME} export then
+	readonly grep "$@" done echo $(pwd)
+		"$1" ${HOME} export printf grep
+		2>/dev/null ${HOME} done | /usr/bin done printf ${HOME} echo test local
+		printf grep /usr/bin awk awk echo done 'quoted text' 'quoted text'
+"$1" --verbose grep then "$@" ${HOME} $(pwd) awk echo export test then awk $(pwd)
+	$(pwd) 'quoted text' 'quoted text' test grep awk $(pwd)
+		awk "$@" awk printf done awk export cd
+	done --verbose 'quoted text' then 'quoted text'
+"$1" echo 'quoted text' local grep 'quoted text' 'quoted text'
+		export cd export sed awk
+		'quoted text' export 2>/dev/null /usr/bin /usr/bin awk $(pwd) $(pwd) cd x=1 "$1"
+		printf | export done "$1" "$1" -eu done --verbose 2>/dev/null && ${HOME} "$1"
+		test x=1 echo $(pwd) grep local awk then done x=1 sed
+	sed x=1 cd local && then
+2>/dev/null done 2>/dev/null /usr/bin echo && echo --verbose x=1 'quoted text'
+${HOME} "$1" -eu --verbose then echo "$1" test grep sed -eu
+x=1 | /usr/bin test --verbose
+		sed then export "$@" ${HOME} echo readonly readonly 'quoted text' cd x=1
+		local 'quoted text' 2>/dev/null $(pwd) && sed echo "$1" grep -eu --verbose
+test 2>/dev/null printf "$1" export readonly
+printf 'quoted text' ${HOME} awk x=1 then $(pwd) --verbose /usr/bin
+		| "$@" "$@" x=1 "$1" /usr/bin 2>/dev/null "$@"
+		-eu cd && $(pwd) echo x=1 x=1 --verbose -eu "$1" -eu
+	$(pwd) /usr/bin $(pwd) |
+"$@" x=1 then x=1 /usr/bin then readonly sed && awk --verbose
+		done grep then readonly then export printf test
+"$1" printf 'quoted text' | readonly -eu 2>/dev/null export
+		cd -eu local x=1 readonly "$@" $(pwd) export
+		done then "$@" 2>/dev/null --verbose
+		/usr/bin readonly then 2>/dev/null readonly sed 2>/dev/null
+		then cd test readonly "$@" test && $(pwd) --verbose then printf $(pwd)
+		awk done -eu awk cd 'quoted text' echo 'quoted text'
+	echo x=1 2>/dev/null /usr/bin
+	grep export | echo ${HOME} -eu /usr/bin x=1 --verbose "$1" local
+"$1" printf --verbose "$1" 2>/dev/null "$1"
+'quoted text' 2>/dev/null sed "$@" && grep readonly done
+"$@" echo && export /usr/bin $(pwd) | cd cd | export ${HOME}
+	/usr/bin /usr/bin local printf
+local "$@" x=1 sed printf local 2>/dev/null -eu test x=1 readonly
+	&& export /usr/bin echo local echo local -eu then cd cd 2>/dev/null test echo
+	test | --verbose -eu && /usr/bin done printf test test echo
+	local "$1" local local awk "$1"
+	${HOME} 2>/dev/null $(pwd)
+&& printf "$@" sed 'quoted text' /usr/bin x=1 ${HOME}
+x=1 export then echo grep
+export $(pwd) /usr/bin -eu -eu
+"$1" /usr/bin 'quoted text' grep done /usr/bin 'quoted text' test cd
+cd $(pwd) echo | grep sed && ${HOME} | x=1 local local /usr/bin | --verbose
+	"$@" export "$@" then 2>/dev/null | ${HOME} "$1" --verbose | sed "$@" ${HOME}
+sed x=1 "$@" export then x=1 ${HOME} sed -eu then
+		2>/dev/null done 'quoted text' ${HOME} readonly
+		test -eu grep "$@" "$1" $(pwd)
+	${HOME} sed sed && /usr/bin --verbose
+	printf test --verbose grep 'quoted text'
+'quoted text' cd "$1" "$@" 2>/dev/null
+	cd "$1" echo grep "$@" --verbose readonly readonly printf
+	sed readonly grep readonly test ${HOME}
+	echo $(pwd) cd --verbose cd $(pwd) && "$@" echo sed --verbose test /usr/bin
+		${HOME} "$1" then "$@" sed --verbose local
+awk sed readonly 'quoted text' then x=1
+	--verbose -eu 'quoted text' printf test -eu cd "$1" -eu
+		test local readonly awk &&
+test done && grep readonly echo -eu
+	/usr/bin cd done --verbose -eu 'quoted text' x=1 sed test echo
+	export 2>/dev/null | then --verbose ${HOME} grep awk
+		${HOME} awk | local "$1" readonly "$1" test
+		${HOME} /usr/bin then echo
+"$1" "$1" grep x=1 && x=1 then cd ${HOME} --verbose
+&& -eu printf then -eu local 2>/dev/null x=1 done then local readonly "$@" /usr/bin
+		printf "$1" /usr/bin $(pwd) awk readonly "$@" awk 'quoted text'
+	awk local 'quoted text' |
+		readonly && --verbose 2>/dev/null sed grep export printf
+	local /usr/bin ${HOME} awk sed grep |
+		x=1 printf export test "$1" export printf done
+then && then -eu cd "$@" grep readonly awk ${HOME}
+		local readonly /usr/bin printf "$1" cd
+export "$@" cd x=1 cd x=1 --verbose ${HOME} readonly "$1" x=1 -eu 'quoted text'
+	echo grep printf then --verbose 'quoted text'
+cd 'quoted text' $(pwd) $(pwd) -eu then cd | test sed 'quoted text' sed echo
+		test local done "$@" local "$1" cd test -eu --verbose
+export /usr/bin export printf "$1" done done x=1 then readonly awk 'quoted text'
+then awk /usr/bin 'quoted text' local grep --verbose 2>/dev/null
+		'quoted text' export local readonly test -eu $(pwd) local export
+		cd local printf x=1 -eu x=1 'quoted text'
+	grep printf "$1" 'quoted text' readonly printf cd sed ${HOME} readonly ${HOME}
+x=1 local then /usr/bin "$@" --verbose
+	&& then done grep awk 'quoted text' "$1" "$@" sed sed done --verbose done export
+test then printf done export $(pwd)
+local export test ${HOME} 2>/dev/null sed 'quoted text' | echo /usr/bin && -eu
+	readonly test grep "$@" /usr/bin --verbose
+		echo cd 'quoted text' "$@" $(pwd) x=1 && x=1 echo local ${HOME} | /usr/bin
+	export 2>/dev/null readonly
+cd && echo printf x=1 'quoted text'
+printf $(pwd) printf $(pwd) readonly sed export sed
+	export --verbose ${HOME} 'quoted text' then test && /usr/bin | printf 2>/dev/null
+cd "$1" | readonly && awk /usr/bin ${HOME}
+		x=1 then /usr/bin /usr/bin -eu export x=1 then readonly $(pwd) x=1 -eu
+		-eu --verbose $(pwd) $(pwd) x=1
+	2>/dev/null local grep test printf sed local test | x=1 $(pwd) done | && "$1"
+	sed --verbose awk local test printf then test
+	test sed export 'quoted text' ${HOME} printf | x=1
+/usr/bin && readonly ${HOME} echo sed x=1 echo then
+	printf 'quoted text' test -eu local
+"$@" test cd --verbose $(pwd)
+		then local echo 2>/dev/null
+grep printf readonly ${HOME} echo 'quoted text' && --verbose
+cd --verbose x=1 sed awk export grep test echo
+	$(pwd) export && x=1 readonly
+test && | $(pwd) --verbose ${HOME} $(pwd) "$1"
+		grep sed local | -eu done grep "$@" ${HOME} |
+test 2>/dev/null && /usr/bin 2>/dev/null sed test -eu | printf readonly --verbose
+	--verbose --verbose $(pwd) ${HOME} "$1" /usr/bin
+	test sed | | "$@" grep /usr/bin $(pwd) local -eu x=1
+	&& cd readonly readonly -eu sed 'quoted text' awk --verbose |
+		grep --verbose 'quoted text' grep ${HOME} --verbose
+	&& test /usr/bin ${HOME} $(pwd)
+		echo readonly "$1" grep 'quoted text' local /usr/bin done
+	| printf && echo echo x=1 grep "$1" --verbose
+		"$@" cd grep -eu -eu echo local && ${HOME} test ${HOME} ${HOME} --verbose readonly
+"$@" 'quoted text' /usr/bin x=1 sed test awk -eu
+		"$@" sed --verbose "$@"
+"$@" readonly | sed export x=1 then $(pwd) local "$@" local then
+test awk /usr/bin awk 'quoted text' $(pwd) readonly /usr/bin
+		-eu "$1" printf done export
+	| then ${HOME} sed "$@" awk | --verbose awk 'quoted text' --verbose printf
+then $(pwd) awk -eu awk sed | cd 2>/dev/null x=1 --verbose
+		local "$1" "$1" grep -eu echo -eu printf -eu readonly "$@" "$@"
+		'quoted text' then local -eu printf
+		${HOME} export 2>/dev/null then printf sed echo
+	awk 2>/dev/null readonly | sed
+		x=1 $(pwd) -eu 2>/dev/null
+	printf --verbose awk then local cd ${HOME} -eu then -eu --verbose
+		echo echo -eu cd local echo | "$@"
+	-eu echo "$1" cd | test -eu awk --verbose echo | test echo then readonly
+&& /usr/bin readonly | "$@" local sed local -eu | sed 'quoted text' "$@" "$1"
+done "$@" "$@" && printf -eu echo x=1 awk grep local
+		${HOME} | $(pwd) --verbose readonly x=1 awk local awk --verbose
+	"$1" | awk && x=1 cd grep
+		echo done "$1" sed done echo sed $(pwd) "$@"
+	${HOME} "$1" --verbose printf --verbose 'quoted text'
+	local 2>/dev/null 'quoted text' cd then "$1" test printf sed "$@" x=1
+	export && awk done echo printf awk then | ${HOME} --verbose && local
+		-eu $(pwd) 'quoted text' -eu x=1 | -eu ${HOME} local cd test local
+	cd x=1 local printf awk 'quoted text' --verbose
+x=1 export cd "$1" awk test --verbose $(pwd) "$@"
+		2>/dev/null export /usr/bin grep awk
+	readonly | -eu readonly export cd done "$@" 'quoted text' x=1
+	grep ${HOME} cd -eu $(pwd) done $(pwd) ${HOME} -eu awk "$1" -eu
+-eu test cd cd /usr/bin x=1 grep export sed
+2>/dev/null sed ${HOME} export local printf x=1 /usr/bin
+cd 2>/dev/null echo "$@" test -eu
+	/usr/bin cd grep awk --verbose export then then "$1" readonly | &&
+		'quoted text' printf test -eu ${HOME} readonly -eu "$@" printf --verbose local
+		export 'quoted text' local --verbose awk && cd /usr/bin x=1 --verbose local echo
+		echo readonly export x=1 x=1 awk "$1" then x=1
+		-eu $(pwd) printf sed ${HOME} --verbose
+printf export printf awk awk test export local grep 'quoted text'
+echo && sed cd x=1 2>/dev/null
+		printf x=1 printf export
+		done grep "$1" && && sed done awk
+	sed test awk 2>/dev/null "$1" 2>/dev/null sed printf x=1 cd readonly $(pwd)
+		readonly readonly ${HOME} /usr/bin "$1" done 2>/dev/null 'quoted text'
+	| then echo cd echo sed /usr/bin
+		"$1" ${HOME} && "$1" then export -eu "$@" $(pwd) done awk printf && awk cd done
+	then test export -eu x=1 local 2>/dev/null then --verbose
+		$(pwd) --verbose x=1 grep sed ${HOME}
+export echo readonly && 2>/dev/null | cd $(pwd) local -eu awk cd printf
+	&& readonly && ${HOME} cd export cd then cd "$1" export local printf "$1" /usr/bin
+x=1 test sed test then $(pwd) | then && 2>/dev/null "$1" 'quoted text'
+		readonly export x=1 $(pwd) "$1" then
+grep cd echo | sed test 2>/dev/null echo export --verbose
+export printf then "$@" echo "$@" /usr/bin "$@" &&
+		done test cd grep 2>/dev/null
+		"$1" local done awk printf $(pwd) readonly "$1" -eu --verbose -eu local grep
+		awk cd done -eu -eu "$1" "$1" 'quoted text'
+local cd awk 2>/dev/null sed echo echo then ${HOME}
+		x=1 "$1" --verbose done 'quoted text' grep "$@" readonly
+${HOME} sed "$1" "$@" x=1 /usr/bin 'quoted text'
+$(pwd) then x=1 /usr/bin x=1 printf | "$1" readonly 2>/dev/null sed $(pwd) echo
+		&& 'quoted text' printf
+${HOME} $(pwd) then --verbose grep done
+2>/dev/null 2>/dev/null |
+printf printf /usr/bin -eu $(pwd) then export
+	cd export $(pwd) ${HOME} 2>/dev/null
+&& ${HOME} $(pwd) local grep -eu --verbose done
+	"$1" 'quoted text' export local --verbose $(pwd) done 'quoted text'
+/usr/bin printf then readonly printf awk -eu "$@" done /usr/bin "$1" /usr/bin
+grep --verbose test then --verbose
+		'quoted text' 2>/dev/null 2>/dev/null readonly
+"$@" && | 'quoted text' /usr/bin
+		grep done cd local export --verbose 2>/dev/null x=1 awk --verbose
+		export | then && export readonly 'quoted text' "$1" ${HOME} done ${HOME}
+		-eu export export "$1" cd /usr/bin
+x=1 "$1" sed awk x=1 /usr/bin 2>/dev/null cd "$@" sed /usr/bin
+		$(pwd) && sed readonly /usr/bin 'quoted text' -eu 'quoted text' export $(pwd) &&
+	'quoted text' 'quoted text'
+--verbose "$@" $(pwd) sed ${HOME} test cd
+	2>/dev/null echo x=1 echo done $(pwd) done --verbose
+2>/dev/null | -eu awk 2>/dev/null readonly then export sed
+sed echo done grep | ${HOME} cd "$@" readonly done "$1" x=1 grep
+	grep /usr/bin awk && echo 'quoted text' "$@" /usr/bin --verbose /usr/bin local
+	'quoted text' done "$1" 'quoted text' echo | x=1 awk done "$@"
+		"$1" sed export && awk && then export $(pwd) echo &&
+--verbose --verbose | ${HOME} sed printf | readonly
+		2>/dev/null $(pwd) local | done echo "$1" 'quoted text' export
+${HOME} ${HOME} && --verbose
+		done readonly 'quoted text' $(pwd) then done done test $(pwd) test
+	2>/dev/null echo 'quoted text' x=1 readonly /usr/bin sed
+	x=1 | done | x=1 printf "$1" 'quoted text' --verbose
+| "$@" cd | sed && 2>/dev/null
+grep readonly -eu awk readonly test 'quoted text' && | printf grep ${HOME}
+		local grep awk grep "$@" | awk done test 2>/dev/null then awk
+local done awk echo printf 2>/dev/null
+		echo then ${HOME} awk sed --verbose && local cd /usr/bin then
+grep echo export && x=1 "$@" --verbose test "$@"
+	&& readonly export cd x=1 done
+-eu cd cd then local local ${HOME} /usr/bin
+test ${HOME} done export "$1" /usr/bin grep cd /usr/bin && && "$1"
+| local ${HOME} --verbose -eu test readonly cd echo $(pwd) export 'quoted text'
+	$(pwd) 2>/dev/null 'quoted text' printf
+		${HOME} | "$1" "$1" 2>/dev/null echo grep x=1 test x=1 export
+		| 2>/dev/null -eu $(pwd) local 'quoted text' awk
+x=1 readonly 'quoted text' test readonly
+	cd readonly "$@" 2>/dev/null test $(pwd) 2>/dev/null test
+	done local x=1 $(pwd) 2>/dev/null local test export readonly grep
+test --verbose echo ${HOME} 2>/dev/null x=1 --verbose grep export awk 'quoted text'
+--verbose 'quoted text' "$1" sed ${HOME} readonly --verbose "$@"
+echo 2>/dev/null && awk ${HOME} "$1" /usr/bin
+	then /usr/bin /usr/bin export "$1" $(pwd) echo printf done 'quoted text'
+		printf 'quoted text' -eu | readonly test readonly export
+/usr/bin sed 2>/dev/null /usr/bin && /usr/bin done readonly grep 2>/dev/null
+		then test done sed sed then grep grep awk /usr/bin
+printf sed printf $(pwd) grep "$1" 2>/dev/null test 2>/dev/null /usr/bin echo
+	then && 2>/dev/null /usr/bin
+		readonly -eu done then $(pwd) then then 'quoted text'
+done test sed "$1" /usr/bin echo --verbose | awk --verbose | "$1"
+	"$1" echo then --verbose
+		-eu 2>/dev/null && | printf printf 'quoted text' -eu local grep 2>/dev/null
+		/usr/bin export 'quoted text'
+		sed local readonly echo test x=1 "$@" 'quoted text' 'quoted text' ${HOME}
+$(pwd) "$@" cd x=1 echo echo 2>/dev/null grep -eu | x=1 2>/dev/null awk /usr/bin
+	x=1 cd | 2>/dev/null local done 2>/dev/null /usr/bin export then printf cd
+"$1" x=1 x=1 --verbose export sed $(pwd)
+		export cd x=1 -eu done -eu 2>/dev/null echo printf
+		"$1" local "$1" "$1" 'quoted text' sed export "$1" echo printf && | ${HOME}
+	/usr/bin echo sed done done "$@" &&
+		grep 2>/dev/null readonly local awk awk echo test readonly 'quoted text' $(pwd)
+	&& "$@" export $(pwd) /usr/bin x=1 printf then 'quoted text' echo "$1" echo
+		&& 'quoted text' echo 2>/dev/null
+		/usr/bin ${HOME} echo cd --verbose local
+-eu cd sed then /usr/bin grep $(pwd) cd /usr/bin
+"$@" "$1" "$@" then export test
+	then x=1 local sed ${HOME} -eu sed x=1 cd export export --verbose
+	$(pwd) readonly sed export x=1 -eu awk sed --verbose local done done
+| | test | 'quoted text' readonly "$1" sed awk awk x=1 --verbose done
+x=1 grep test "$@" "$@" -eu test then printf sed awk grep grep
+	'quoted text' "$@" grep ${HOME} grep sed $(pwd) "$1" printf 'quoted text'
+	sed x=1 cd | readonly ${HOME} echo awk
+	printf "$@" readonly readonly
+export echo 'quoted text' echo readonly readonly ${HOME} local ${HOME}
+sed export cd sed x=1 /usr/bin printf | done test 2>/dev/null $(pwd)
+		readonly grep "$@" echo "$@" cd ${HOME} | done | 2>/dev/null 2>/dev/null
+	x=1 "$1" readonly /usr/bin -eu local cd done "$1" ${HOME} sed grep
+		printf 'quoted text' /usr/bin done $(pwd) -eu x=1 2>/dev/null
+	$(pwd) ${HOME} local readonly /usr/bin then "$1"
+	test /usr/bin $(pwd) 'quoted text' /usr/bin test sed 'quoted text' &&
+		printf $(pwd) && 2>/dev/null sed printf then grep -eu printf | then echo $(pwd)
+		x=1 readonly readonly "$1" readonly echo cd echo
+		/usr/bin x=1 grep | local --verbose 'quoted text'
+	--verbose done echo -eu ${HOME} 'quoted text'
+		-eu awk export 'quoted text' done export | local test "$@"
+&& local && printf "$@" printf --verbose grep
+"$@" export awk "$@" $(pwd) awk echo cd awk export test test sed "$1" grep export
+		awk /usr/bin $(pwd) sed test /usr/bin readonly echo | then local
+local done -eu x=1 test done --verbose --verbose awk echo test readonly
+readonly -eu 2>/dev/null echo /usr/bin export x=1
+"$@" "$1" cd readonly awk readonly ${HOME}
+		-eu then readonly echo && ${HOME} echo grep 'quoted text' test
+| printf done && test
+	$(pwd) $(pwd) 'quoted text'
+"$@" export echo sed "$1" /usr/bin "$1" $(pwd) ${HOME} awk | grep
+		${HOME} "$@" local grep 'quoted text' grep 2>/dev/null readonly
+	readonly done -eu --verbose export /usr/bin then $(pwd)
+"$@" $(pwd) x=1 "$1"
+		echo "$@" printf test sed x=1 2>/dev/null "$@" then ${HOME} 2>/dev/null
+"$@" && readonly ${HOME}
+local printf sed test done "$@"
+		echo printf then cd then readonly cd printf sed /usr/bin
+then "$@" echo grep then ${HOME} local $(pwd) -eu $(pwd) awk x=1 echo awk done
+	echo ${HOME} printf echo | 'quoted text' printf && export -eu x=1 $(pwd) grep
+x=1 sed | export echo test /usr/bin x=1 $(pwd) readonly
+		local -eu x=1 "$1" ${HOME} ${HOME}
+	--verbose grep done && test done done echo grep -eu ${HOME} export "$@"
+	$(pwd) then grep x=1 'quoted text' && then -eu "$1" -eu 2>/dev/null
+export $(pwd) echo ${HOME} && 'quoted text' && grep export
+&& x=1 "$1" ${HOME} cd $(pwd) "$@" --verbose
+then cd echo done 'quoted text' && $(pwd) ${HOME} -eu "$1"
+2>/dev/null $(pwd) readonly x=1 printf
+&& && 2>/dev/null echo done awk then ${HOME}
+$(pwd) 2>/dev/null ${HOME} ${HOME} 'quoted text' -eu awk
+	test $(pwd) ${HOME} --verbose sed 'quoted text' readonly
+		sed 2>/dev/null export echo awk --verbose --verbose grep local
+	then && printf done local x=1 awk cd
+	done --verbose | /usr/bin sed 2>/dev/null test --verbose "$1" -eu 'quoted text'
+	readonly sed | sed grep | export done export
+sed $(pwd) 'quoted text' then 2>/dev/null /usr/bin "$1" 'quoted text'
+printf "$1" | 'quoted text' awk x=1 $(pwd) 'quoted text' awk | $(pwd) sed
+	-eu | "$1" /usr/bin 'quoted text' ${HOME} readonly --verbose done -eu grep
+		${HOME} ${HOME} ${HOME} sed echo "$1" then echo $(pwd) echo awk
+	"$@" readonly done && 'quoted text' /usr/bin && --verbose
+sed "$@" cd x=1 local -eu | "$1" -eu awk local "$@" x=1 ${HOME} | ${HOME} cd
+then && -eu export "$@" "$@" echo export
+sed awk grep done 2>/dev/null $(pwd) ${HOME} local awk "$1"
+		2>/dev/null then --verbose
+"$@" -eu awk && echo && | readonly readonly x=1 cd export /usr/bin "$1" echo
+	| printf grep echo export readonly test test 2>/dev/null then $(pwd) test
+		done echo "$1" grep awk grep test && grep done
+x=1 sed "$1" test 2>/dev/null
+		2>/dev/null sed /usr/bin -eu 'quoted text' ${HOME} && grep
+"$@" awk sed "$1" then 'quoted text' then
+	| printf "$1" 'quoted text'
+awk readonly -eu test test -eu "$@" -eu x=1 -eu /usr/bin "$@" then ${HOME}
+	awk /usr/bin && sed printf cd test printf
+		grep x=1 "$@" | sed "$1" echo && /usr/bin
+local x=1 echo then sed $(pwd) cd -eu /usr/bin x=1 then printf
+"$@" /usr/bin local sed local sed -eu -eu
+/usr/bin export sed "$1" cd echo 2>/dev/null readonly done -eu awk readonly
+	"$@" "$@" awk $(pwd) "$1" awk 2>/dev/null
+		/usr/bin ${HOME} 'quoted text' "$@"
+	local | "$1" $(pwd) --verbose "$1" && -eu "$1" --verbose
+		| then x=1 test && && grep readonly test --verbose $(pwd) | ${HOME}
+		2>/dev/null 2>/dev/null --verbose 2>/dev/null
+--verbose local then test export /usr/bin 2>/dev/null
+$(pwd) ${HOME} then done $(pwd) echo && "$1" export --verbose
+grep "$@" done then /usr/bin
+		${HOME} ${HOME} local done "$1" then done --verbose -eu $(pwd) grep
+${HOME} readonly export ${HOME} export local $(pwd) $(pwd) -eu
+"$@" 'quoted text' then $(pwd) sed cd echo && local awk 'quoted text' && printf
+		-eu then readonly cd local cd
+2>/dev/null local sed --verbose 2>/dev/null
+		printf printf echo sed sed test 'quoted text' 'quoted text' cd echo x=1 echo /usr/bin
+	test echo $(pwd) $(pwd) x=1
+		$(pwd) -eu 'quoted text' readonly echo grep export 'quoted text' 'quoted text'
+echo readonly printf "$1" printf awk 'quoted text'
+	'quoted text' grep 'quoted text' && readonly 2>/dev/null sed awk
+	${HOME} local 2>/dev/null grep
+	| cd printf done printf then done | local sed printf
+		readonly x=1 sed "$@" ${HOME} done $(pwd) --verbose
+		sed x=1 "$1" "$@" printf grep
+-eu 2>/dev/null grep -eu "$1" printf readonly sed printf
+		| done cd printf 2>/dev/null local --verbose
+	$(pwd) && $(pwd) export &&
+local awk printf $(pwd) local then cd cd
+		/usr/bin 2>/dev/null grep x=1 echo readonly
+	'quoted text' --verbose cd --verbose "$1"
+		/usr/bin test $(pwd) awk readonly "$@" "$1" | grep | cd x=1 awk readonly
+	done readonly --verbose done cd then
+	echo && | $(pwd) export "$@" $(pwd) -eu cd local
+local printf echo "$@" | --verbose x=1 $(pwd) echo done x=1
+-eu awk sed 2>/dev/null printf
+		-eu awk local echo /usr/bin grep test 'quoted text' $(pwd) 2>/dev/null test then
+	printf grep ${HOME} x=1 done -eu
+	"$1" cd --verbose export test echo grep -eu cd "$@" -eu ${HOME} 'quoted text'
+test awk printf printf echo
+		then ${HOME} "$1" x=1 2>/dev/null $(pwd) echo "$1" "$@"
+printf then sed "$1" 2>/dev/null $(pwd) grep
+	2>/dev/null sed cd && "$@" | 'quoted text' "$1" $(pwd)
+		/usr/bin test printf echo | local done
+	2>/dev/null "$1" printf /usr/bin done readonly
+	awk sed printf readonly done
+local grep grep && $(pwd) -eu --verbose local printf -eu
+		"$1" echo x=1 export done cd cd | awk 2>/dev/null | "$@"
+	-eu | 2>/dev/null $(pwd) done -eu local
+	echo --verbose then cd echo "$1" then 'quoted text'
+	done x=1 echo cd "$@" | echo "$1" test 'quoted text'
+	printf cd $(pwd) 'quoted text' ${HOME}
+	then done awk /usr/bin $(pwd) && "$1" test "$1" cd --verbose 2>/dev/null
+	printf readonly -eu /usr/bin "$1" "$1" cd "$@" | $(pwd) cd local
+		printf echo printf && export "$@" $(pwd) ${HOME}
+done local readonly --verbose local
+readonly local -eu export
+		"$@" done "$@" | | cd readonly local ${HOME} | test
+${HOME} test "$1" | then local readonly grep && awk
+test awk x=1 printf export export $(pwd) export readonly local done
+2>/dev/null && "$1" printf then 'quoted text' export /usr/bin $(pwd)
+	echo $(pwd) "$@" /usr/bin printf printf printf done "$1"
+		test "$1" local readonly "$1" $(pwd)
+$(pwd) $(pwd) 2>/dev/null printf 2>/dev/null --verbose
+		&& readonly 2>/dev/null $(pwd) /usr/bin /usr/bin export readonly x=1
+	grep x=1 echo export "$@" test
+	2>/dev/null awk local done
+		then | then --verbose "$@" done | awk grep local readonly
+export test printf -eu
+--verbose && done then --verbose readonly sed then
+		$(pwd) printf local -eu && "$@" 'quoted text' x=1 -eu | printf /usr/bin
+		"$1" && 2>/dev/null x=1 then awk sed cd 2>/dev/null "$@" && $(pwd)
+		cd && "$1" 2>/dev/null echo ${HOME} readonly
+	local $(pwd) --verbose && export printf && grep cd local /usr/bin | then
+2>/dev/null readonly "$@" --verbose 2>/dev/null
+	awk then --verbose sed readonly
+'quoted text' awk x=1 export -eu readonly /usr/bin cd grep printf sed
+	test awk then -eu /usr/bin &&
+		${HOME} export /usr/bin $(pwd)
+		"$1" then sed /usr/bin $(pwd) local --verbose
+	cd 2>/dev/null printf && export
+&& 2>/dev/null ${HOME}
+		cd echo "$@" test --verbose /usr/bin
+	&& local then "$@" "$1" /usr/bin local sed | export export -eu 'quoted text' 2>/dev/null
+	&& "$1" -eu $(pwd) sed "$1" test grep ${HOME} done test sed 'quoted text'
+cd echo 'quoted text' 2>/dev/null -eu readonly 2>/dev/null export -eu test x=1
+		-eu 'quoted text' x=1 -eu --verbose
+2>/dev/null $(pwd) -eu 'quoted text' printf $(pwd) -eu
+		awk $(pwd) -eu test | echo -eu export cd
+	-eu sed sed test --verbose 'quoted text' "$1" "$@" | printf local cd x=1 readonly
+	&& then --verbose grep test cd done awk echo export /usr/bin | done /usr/bin done
+	then 'quoted text' sed done
+grep printf cd sed export x=1 cd x=1 ${HOME} readonly | then ${HOME} awk && grep
+		'quoted text' x=1 /usr/bin 2>/dev/null "$1" readonly sed local $(pwd) echo
+cd 2>/dev/null grep && 2>/dev/null "$1"
+		"$@" local done | && echo ${HOME}
+		"$@" echo awk awk cd ${HOME} ${HOME} export | printf 'quoted text' test -eu
+	-eu echo "$@" "$@" test $(pwd) $(pwd)
+		-eu -eu test done -eu readonly
+$(pwd) local x=1 && 2>/dev/null printf "$1" test
+x=1 local awk /usr/bin grep export echo echo x=1 echo && local $(pwd) awk --verbose
+-eu test | x=1 export ${HOME} then --verbose && test
+	sed "$@" export test printf $(pwd) ${HOME}
+--verbose "$1" local /usr/bin then 'quoted text'
+		2>/dev/null --verbose local echo readonly -eu -eu
+	-eu $(pwd) cd cd echo local
+		"$1" /usr/bin then awk grep "$@" awk && local --verbose
+$(pwd) test local ${HOME} printf
+		-eu /usr/bin awk ${HOME} then printf 'quoted text' | /usr/bin "$1"
+		2>/dev/null --verbose local
+	"$@" readonly x=1 export cd then $(pwd)
+		'quoted text' local 2>/dev/null 2>/dev/null -eu "$1"
+	| cd cd /usr/bin export sed echo 2>/dev/null readonly then
+		local readonly /usr/bin -eu
+	awk grep 2>/dev/null --verbose awk "$1" done "$@" local "$1"
+		readonly readonly --verbose x=1
+readonly /usr/bin cd awk 'quoted text'
+	--verbose "$@" printf then -eu local sed x=1 'quoted text'
+export awk test /usr/bin echo
+		/usr/bin --verbose readonly sed --verbose x=1
+	cd sed /usr/bin "$1" ${HOME} "$1" readonly "$@" cd sed test ${HOME}
+	'quoted text' readonly | 2>/dev/null done grep &&
+	x=1 /usr/bin 2>/dev/null "$1" export
+		grep x=1 /usr/bin "$@" test cd "$@" |
+&& /usr/bin local 2>/dev/null local | sed cd 'quoted text' x=1 2>/dev/null
+	printf && -eu -eu | && done sed readonly 2>/dev/null
+then $(pwd) $(pwd) export done "$1"
+	echo /usr/bin --verbose printf 2>/dev/null
+		/usr/bin test awk printf export
+	| 'quoted text' ${HOME} | test cd sed && awk test echo then grep sed 2>/dev/null
+		then echo done x=1 readonly test grep echo
+		cd done test test $(pwd) then awk ${HOME}
+'quoted text' --verbose 2>/dev/null export echo echo --verbose
+		x=1 x=1 awk 'quoted text' | test done done 'quoted text'
+	awk export /usr/bin 2>/dev/null ${HOME} grep -eu $(pwd) 2>/dev/null
+printf $(pwd) grep export printf ${HOME} sed sed
+2>/dev/null x=1 export local --verbose
+"$1" ${HOME} then 'quoted text' readonly $(pwd) export
+$(pwd) cd "$@" readonly test "$1" | --verbose ${HOME} export
+		x=1 -eu printf "$@" awk then
+export printf "$@" echo local readonly done --verbose grep ${HOME} && 2>/dev/null
+	x=1 cd ${HOME} 'quoted text' readonly --verbose done
+		"$1" ${HOME} "$1" -eu done ${HOME} /usr/bin
+done --verbose ${HOME} cd printf --verbose x=1 | x=1 && "$@" echo readonly
+		'quoted text' test echo echo grep $(pwd) ${HOME} done sed --verbose
+/usr/bin test | echo then --verbose done awk done "$@" test x=1 awk then && grep
+	export 2>/dev/null 2>/dev/null
+	"$@" done 2>/dev/null --verbose then $(pwd) 2>/dev/null --verbose
+	-eu --verbose sed then 'quoted text' then test echo local local echo "$@" then $(pwd)
+		"$@" && cd | echo | /usr/bin -eu done $(pwd) grep $(pwd) then "$@" sed 'quoted text'
+	sed "$@" | export --verbose 2>/dev/null /usr/bin grep
+		"$@" && $(pwd) grep test cd then $(pwd) export sed done
+printf -eu cd 'quoted text' "$@"
+	local echo "$@" && | x=1
+	"$@" export test && -eu 'quoted text' "$@" cd printf local && 'quoted text' /usr/bin
+export cd export export local
+		echo readonly local done $(pwd) sed -eu printf ${HOME} ${HOME} echo echo /usr/bin
+done awk $(pwd) /usr/bin printf 'quoted text' ${HOME} grep $(pwd) cd --verbose
+	| ${HOME} $(pwd) 2>/dev/null then awk "$@" export grep "$@"
+		-eu echo then ${HOME} sed ${HOME}
+	"$@" done echo 'quoted text' --verbose "$1" then grep readonly | awk test
+grep | done "$@" done "$@" /usr/bin export "$@" grep | $(pwd) grep --verbose
+		/usr/bin export "$1" 2>/dev/null done grep echo printf /usr/bin -eu
+'quoted text' done echo local grep x=1 done x=1 x=1 --verbose "$@" done "$1" ${HOME}
+	sed test sed sed readonly then then echo awk grep cd x=1 2>/dev/null 2>/dev/null
+		$(pwd) sed $(pwd) | readonly awk && done echo | cd
+		test then done cd grep
+printf local test 2>/dev/null -eu "$@" x=1
+	awk export 2>/dev/null ${HOME} done echo awk grep
+		echo $(pwd) local done local cd && cd sed done local awk "$@" /usr/bin
+	x=1 echo 'quoted text' "$@" 'quoted text' 'quoted text'
+		x=1 x=1 echo test /usr/bin ${HOME} cd && --verbose
+local sed then 'quoted text' "$1" export done 2>/dev/null printf
+		cd x=1 "$1" && export $(pwd) echo -eu sed $(pwd) printf printf sed readonly sed
+		test && x=1 done then grep echo
+test done --verbose then --verbose 2>/dev/null readonly test x=1 grep
+		sed test done printf done "$@" grep ${HOME} 2>/dev/null "$1" x=1 | cd awk local
+		"$1" --verbose echo printf cd cd "$@" printf done "$@" local export grep
+	"$@" $(pwd) echo $(pwd) "$@" "$@" --verbose --verbose
+cd | done x=1 2>/dev/null
+	${HOME} 'quoted text' local awk sed | export awk | echo
+| test printf /usr/bin local | grep then && --verbose
+done grep "$@" 2>/dev/null -eu printf then export echo 2>/dev/null
+printf sed | --verbose cd /usr/bin then export export awk then grep 2>/dev/null
+		readonly /usr/bin -eu $(pwd) | x=1 readonly test
+	${HOME} && 'quoted text'
+	test --verbose grep done sed | awk readonly export local echo --verbose
+readonly readonly sed x=1 'quoted text' then 2>/dev/null export
+	&& printf | && && test
+	2>/dev/null /usr/bin "$@" && ${HOME} 'quoted text' -eu grep ${HOME}
+	printf x=1 test export grep echo local "$1" 2>/dev/null export
+		done test ${HOME} $(pwd)
+local sed $(pwd) 'quoted text' ${HOME} then | printf "$@" export sed readonly
+		local done --verbose readonly
+		"$1" export readonly | sed
+2>/dev/null /usr/bin -eu | && cd /usr/bin then readonly
+		grep /usr/bin 2>/dev/null export 'quoted text'
+x=1 'quoted text' -eu x=1
+	sed grep grep readonly x=1 export | test 'quoted text' awk /usr/bin /usr/bin then
+	then export 2>/dev/null -eu done $(pwd) ${HOME} ${HOME} "$1" 2>/dev/null
+		$(pwd) done printf | printf --verbose awk grep then x=1 sed
+	local local $(pwd) 'quoted text'
+sed | done ${HOME} cd test "$@" test x=1 local printf echo ${HOME} ${HOME}
+then "$@" done export cd local awk export readonly $(pwd)
+printf "$@" done local echo test 2>/dev/null grep "$1" --verbose
+| 2>/dev/null done x=1 $(pwd) --verbose
+		&& | export done grep grep
+2>/dev/null 2>/dev/null awk readonly grep echo --verbose
+	$(pwd) | -eu readonly awk "$1" grep && 'quoted text' grep cd ${HOME} printf
+		-eu printf grep -eu local awk local "$1" done then --verbose printf then
+	/usr/bin sed | export test then
+		"$1" grep grep /usr/bin done 2>/dev/null local local
+local && -eu cd export readonly "$1" "$@" readonly
+		cd "$1" cd local local 2>/dev/null 'quoted text' test 'quoted text'
+		sed $(pwd) 2>/dev/null done ${HOME} --verbose export awk
+sed -eu ${HOME} sed done && readonly
+	echo awk 'quoted text' done awk sed x=1 -eu cd | export /usr/bin /usr/bin
+echo $(pwd) -eu done -eu echo x=1 $(pwd) &&
+	-eu awk then local export readonly
+'quoted text' | "$1" printf --verbose 'quoted text'
+		-eu done -eu echo done ${HOME} | | done "$1" 2>/dev/null cd | cd x=1
+	--verbose printf ${HOME} done /usr/bin 2>/dev/null "$1" awk then echo then
+readonly "$1" -eu 2>/dev/null /usr/bin /usr/bin sed
+--verbose cd | 'quoted text'
+&& 'quoted text' echo cd && $(pwd) ${HOME} echo sed readonly done
+		export sed echo local | awk done "$@" /usr/bin
+cd -eu echo printf then --verbose
+		-eu readonly test "$1" local echo 'quoted text' 2>/dev/null
+		${HOME} cd && 'quoted text' readonly ${HOME} --verbose /usr/bin echo --verbose
+test -eu --verbose cd grep readonly x=1 export echo -eu -eu $(pwd) ${HOME}
+printf local $(pwd) /usr/bin
+		-eu local "$1" ${HOME} export cd grep then | --verbose -eu 'quoted text'
+		then "$@" -eu test 'quoted text' grep x=1 /usr/bin
+		printf 'quoted text' awk readonly "$@" echo 'quoted text'
+readonly -eu $(pwd) done $(pwd) readonly printf echo --verbose 2>/dev/null then
+local $(pwd) "$@" 'quoted text' printf
+		grep "$1" echo && 'quoted text' "$@" 2>/dev/null sed printf 2>/dev/null
+	"$@" "$1" --verbose test ${HOME} readonly "$@" local echo test /usr/bin
+cd done then export $(pwd)
+		-eu readonly -eu "$1" test readonly echo ${HOME} -eu "$@" local 'quoted text'
+	local readonly cd 'quoted text' $(pwd) export readonly grep
+"$1" sed grep sed test sed 'quoted text' readonly
+"$1" -eu | x=1 export "$1" 'quoted text' && readonly ${HOME} "$@" --verbose
+'quoted text' && local
+"$1" --verbose awk export -eu done awk echo "$@" ${HOME}
+		grep "$1" 2>/dev/null 'quoted text' printf sed test && --verbose
+		'quoted text' local "$@" "$1" cd done cd 'quoted text' local "$1"
+		x=1 'quoted text' 'quoted text' && && /usr/bin grep echo "$@"
+	then x=1 echo echo sed /usr/bin -eu echo readonly && printf
+	--verbose export 'quoted text' -eu && export grep $(pwd) x=1 local $(pwd)
+	cd "$1" && export export $(pwd) awk
+		grep /usr/bin "$1" readonly ${HOME}
+	/usr/bin | test -eu --verbose /usr/bin local export export 2>/dev/null
+sed 2>/dev/null local test awk test 'quoted text'
+		echo "$1" sed test test done
+local 'quoted text' -eu printf done "$1" sed done $(pwd) /usr/bin
+		printf /usr/bin then awk /usr/bin
+		readonly readonly export 'quoted text'
+echo local "$1" $(pwd) test done sed sed 'quoted text' $(pwd)
+		export readonly grep -eu -eu
+	-eu $(pwd) readonly "$1"
+&& cd "$1" grep readonly |
+done "$@" 'quoted text' echo printf | --verbose export 'quoted text'
+--verbose printf /usr/bin printf echo -eu "$@" $(pwd)
+		done echo echo | /usr/bin | --verbose
+		${HOME} export 'quoted text' readonly
+-eu --verbose test "$@" /usr/bin done 2>/dev/null
+	--verbose printf && "$@" && echo /usr/bin
+'quoted text' -eu && echo $(pwd) awk x=1 readonly
+2>/dev/null sed grep "$@" cd && ${HOME} && $(pwd) x=1
+	cd then -eu 'quoted text' /usr/bin && cd test ${HOME} | 2>/dev/null grep cd grep
+	then done awk /usr/bin /usr/bin export --verbose cd done grep cd && echo
+awk $(pwd) 'quoted text' ${HOME} then then
+"$1" export local sed | done grep cd
+		done $(pwd) cd awk ${HOME} export "$1" grep 2>/dev/null && awk 2>/dev/null
+awk --verbose awk "$1" $(pwd) printf ${HOME}
+		'quoted text' sed "$@" 'quoted text' x=1 --verbose
+"$@" readonly --verbose echo export done "$@" -eu "$1" "$1" --verbose
+/usr/bin printf then cd | /usr/bin sed /usr/bin x=1 "$@" $(pwd) x=1 | "$1" |
+	x=1 grep printf /usr/bin /usr/bin x=1 cd $(pwd) readonly
+cd --verbose test | done
+	test cd "$1" 2>/dev/null | --verbose
+"$1" ${HOME} x=1 ${HOME} sed cd echo export local ${HOME}
+		cd | local -eu echo /usr/bin
+	local local printf "$1" readonly local x=1 then 2>/dev/null awk cd grep done
+	/usr/bin sed test cd cd | ${HOME} $(pwd) 2>/dev/null -eu
+test sed | awk export test
+		&& 2>/dev/null | x=1 readonly echo
+	| $(pwd) $(pwd) $(pwd)
+	${HOME} export "$1" test
+		2>/dev/null cd readonly /usr/bin
+$(pwd) then echo local printf | awk 'quoted text'
+		$(pwd) -eu 'quoted text' -eu 'quoted text'
+echo && sed grep echo ${HOME} readonly "$1" $(pwd) readonly "$@"
+	--verbose local then echo local 2>/dev/null
+		test --verbose -eu "$@" /usr/bin 'quoted text' ${HOME} test ${HOME} "$@"
+		test awk 'quoted text' done grep readonly cd export done local cd /usr/bin readonly
+		"$@" echo x=1 sed x=1 -eu cd cd "$1" awk printf test x=1
+	export sed x=1 readonly then sed export
+${HOME} | cd export test $(pwd) 2>/dev/null cd 2>/dev/null
+then && 'quoted text' sed -eu awk printf export
+		local sed $(pwd) 'quoted text' --verbose export
+x=1 then local grep awk echo readonly
+echo readonly && -eu sed 'quoted text' --verbose "$1" cd grep printf
+"$@" awk $(pwd) --verbose -eu sed printf export -eu /usr/bin printf awk $(pwd)
+		cd then cd grep test test /usr/bin
+	"$1" x=1 export readonly echo printf grep cd local x=1 sed ${HOME}
+--verbose "$1" grep done export printf 2>/dev/null local grep
+'quoted text' cd "$1" $(pwd) -eu $(pwd) "$1" |
+sed "$@" 2>/dev/null 2>/dev/null grep cd 'quoted text' done test cd "$1" done
+		| ${HOME} then export "$1" ${HOME} readonly readonly
+		test ${HOME} readonly done cd printf /usr/bin done local -eu ${HOME} ${HOME}
+x=1 sed then local awk then --verbose
+		cd export sed --verbose -eu test awk awk printf
+/usr/bin printf 'quoted text' readonly readonly printf && /usr/bin
+| 'quoted text' x=1 x=1 && --verbose cd 'quoted text' -eu
+	grep awk echo /usr/bin x=1 grep sed printf printf sed --verbose
+		'quoted text' 'quoted text' done x=1 readonly "$1" -eu
+"$1" readonly local 2>/dev/null local x=1 -eu grep
+		readonly --verbose /usr/bin $(pwd) && 2>/dev/null --verbose 'quoted text' 'quoted text'
+then test -eu -eu ${HOME} readonly && local test x=1 test awk -eu printf
+	x=1 cd -eu --verbose "$1" printf echo test | "$@" "$1" cd && done ${HOME} /usr/bin
+		--verbose | awk && local test | export echo sed
+		${HOME} "$@" ${HOME} cd readonly grep
+		${HOME} "$@" echo local printf /usr/bin awk readonly --verbose cd "$1" then
+	-eu 'quoted text' --verbose
+2>/dev/null -eu printf echo sed awk done then printf done awk
+	grep done sed 2>/dev/null 2>/dev/null
+x=1 ${HOME} echo printf --verbose --verbose ${HOME}
+		&& readonly -eu then $(pwd) sed awk export grep "$1" echo 'quoted text'
+		cd && printf export /usr/bin local --verbose printf
+&& test grep /usr/bin && && 'quoted text' local "$1" echo awk -eu ${HOME}
+		| grep grep then "$@" test --verbose
+x=1 | "$1" readonly export export |
+readonly test done | "$@" $(pwd) sed 2>/dev/null then "$@" /usr/bin
+	done | test | test grep cd $(pwd) && ${HOME} export cd test sed
+	${HOME} printf export /usr/bin 'quoted text' "$1"
+awk printf --verbose -eu readonly awk --verbose -eu 'quoted text' 2>/dev/null
+	cd awk local /usr/bin done grep -eu sed awk
+		printf ${HOME} local $(pwd) --verbose export | -eu printf
+	then 'quoted text' && ${HOME} export
+	readonly && export then done readonly 'quoted text'
+	| --verbose $(pwd) local grep then cd local "$@" local cd /usr/bin then
+	${HOME} 2>/dev/null export --verbose
+		&& "$1" /usr/bin grep /usr/bin && "$1" 'quoted text' "$@" export export
+		test ${HOME} local "$1"
+	x=1 test awk -eu ${HOME} echo --verbose
+		echo export local readonly test export local /usr/bin echo | awk $(pwd) grep /usr/bin
+	&& grep -eu "$@" ${HOME}
+		'quoted text' $(pwd) $(pwd)
+	-eu export -eu -eu done ${HOME}
+		${HOME} echo then echo awk test
+"$1" /usr/bin echo printf cd 2>/dev/null --verbose "$@" printf
+		| "$@" $(pwd) -eu export cd -eu done sed |
+	/usr/bin cd /usr/bin then $(pwd) --verbose | "$1" "$@"
+		echo printf -eu /usr/bin
+	| grep local && --verbose
+&& awk grep 2>/dev/null -eu export local echo
+	"$@" "$1" grep echo x=1 printf then echo /usr/bin 'quoted text'
+"$1" -eu done --verbose "$1" sed "$@" -eu && done && awk
+awk cd local | 'quoted text' local local done 'quoted text' done ${HOME}
+	grep | grep echo awk then echo echo cd grep "$1" awk export
+	--verbose /usr/bin done $(pwd) echo 'quoted text' && awk grep done readonly readonly
+echo grep cd readonly echo && "$1" /usr/bin readonly grep $(pwd) done
+		cd awk "$@" ${HOME} 2>/dev/null | "$1" /usr/bin cd | x=1 done grep --verbose awk
+	then x=1 "$@" echo $(pwd) echo sed grep readonly export 'quoted text'
+	then grep --verbose local 'quoted text' "$1" printf grep | printf "$1"
+	$(pwd) local | && &&
+	local 'quoted text' test --verbose
+		&& 2>/dev/null readonly "$1" -eu "$1" /usr/bin export readonly
+	sed test && sed -eu && "$1" /usr/bin "$@" -eu done then
+	grep /usr/bin awk then done 'quoted text' done test cd | "$@" awk
+		'quoted text' && "$1" then printf done ${HOME} "$@" "$@" cd printf
+--verbose local | sed "$1" cd $(pwd) "$1" local
+		then && $(pwd) awk sed readonly 2>/dev/null /usr/bin printf
+		then x=1 'quoted text' readonly cd
+	&& 2>/dev/null done --verbose local -eu
+"$1" export -eu local /usr/bin readonly 2>/dev/null x=1 -eu 2>/dev/null
+	2>/dev/null local $(pwd)
+&& printf "$@" grep test done cd $(pwd) awk grep 2>/dev/null
+	$(pwd) grep readonly awk "$@" cd awk readonly --verbose -eu $(pwd)
+cd 'quoted text' printf "$1" sed done readonly
+	&& then $(pwd) grep && x=1 ${HOME}
+"$1" test 2>/dev/null local echo &&
+done done sed /usr/bin x=1 cd then grep x=1 "$@"
+x=1 export "$1" local
+2>/dev/null export done ${HOME} | -eu test test local
+--verbose 2>/dev/null export then grep $(pwd) $(pwd) export echo x=1 -eu
+	printf test awk test then grep "$@" sed $(pwd) grep
+	readonly printf x=1 sed sed grep done grep -eu readonly readonly export x=1
+done sed printf done | -eu $(pwd) test /usr/bin
+2>/dev/null export | $(pwd) local printf 2>/dev/null
+	sed "$1" export readonly 2>/dev/null
+	2>/dev/null then | done cd printf
+		'quoted text' ${HOME} x=1 --verbose 2>/dev/null /usr/bin
+		local && /usr/bin ${HOME}
+readonly -eu -eu x=1 then && /usr/bin /usr/bin "$@" ${HOME} /usr/bin --verbose
+	export export --verbose grep printf grep "$@"
+	awk | | 2>/dev/null awk $(pwd) local grep then export
+export cd export export "$@" "$1" /usr/bin | printf test done echo "$@" awk 'quoted text'
+		'quoted text' readonly $(pwd) "$1" x=1
+	sed awk test | grep x=1 sed printf local --verbose ${HOME} | $(pwd) x=1 "$@"
+		--verbose /usr/bin then printf
+	"$@" 2>/dev/null x=1 export 2>/dev/null ${HOME} done "$@"
+		then done done readonly test --verbose done "$1" ${HOME} readonly
+grep && echo cd /usr/bin /usr/bin 'quoted text' then $(pwd) then
+grep --verbose /usr/bin --verbose cd "$1" readonly echo then -eu | test 'quoted text'
+	then 'quoted text' 'quoted text'
+	-eu ${HOME} done | echo
+	readonly 2>/dev/null "$1" | done export /usr/bin $(pwd) export | "$1"
+		/usr/bin test local 'quoted text' cd
+&& echo awk printf grep
+x=1 $(pwd) | $(pwd) local export --verbose readonly test "$1" "$@" local "$@"
+	"$@" 2>/dev/null cd awk readonly -eu -eu && 2>/dev/null && "$@" ${HOME} echo
+		"$@" sed done 'quoted text' done | grep ${HOME} readonly
+	echo $(pwd) | cd "$1" grep -eu sed | done ${HOME} $(pwd) $(pwd) x=1 'quoted text'
+	| readonly -eu -eu && -eu /usr/bin $(pwd)
+		export "$1" printf "$1" $(pwd) --verbose cd export
+		readonly done && grep test &&
+--verbose && then done awk
+		&& 2>/dev/null --verbose $(pwd) done test
+		printf /usr/bin export then echo readonly -eu then local ${HOME} printf ${HOME}
+		/usr/bin then echo && "$@"
+		grep /usr/bin -eu -eu
+		test 2>/dev/null sed cd echo readonly | echo 'quoted text' ${HOME}
+then 2>/dev/null -eu 'quoted text'
+	test && then readonly test 'quoted text' /usr/bin && $(pwd) sed 'quoted text'
+	test /usr/bin $(pwd) "$@" echo export test test awk --verbose echo $(pwd)
+		"$@" /usr/bin /usr/bin local ${HOME} cd 'quoted text'
+	"$@" | awk $(pwd) cd printf /usr/bin done local | /usr/bin x=1 awk "$1"
+'quoted text' -eu local --verbose | then x=1 export
+	then | -eu 2>/dev/null "$@" awk "$1" "$@" 'quoted text' awk --verbose readonly
+	2>/dev/null $(pwd) grep grep
+	'quoted text' sed done echo $(pwd) test local --verbose
+		test cd awk sed 2>/dev/null ${HOME} "$@" x=1 $(pwd) sed test /usr/bin done
+-eu done $(pwd) && -eu "$@" local awk awk $(pwd) $(pwd)
+awk cd 2>/dev/null test $(pwd) done grep "$1" echo echo /usr/bin grep awk
+"$1" x=1 "$@" readonly local ${HOME} sed 'quoted text' ${HOME} -eu x=1 --verbose
+2>/dev/null sed local done then awk && 2>/dev/null printf local --verbose
+		${HOME} awk grep "$1" echo -eu "$1" export
+		-eu done ${HOME} readonly 2>/dev/null awk readonly --verbose 'quoted text'
+| sed 'quoted text' local "$1" printf "$@" 2>/dev/null
+		"$@" ${HOME} done 2>/dev/null "$@" -eu ${HOME} "$@" printf grep printf
+	local ${HOME} "$@" /usr/bin "$1" "$1" 'quoted text' echo done done test grep |
+test awk && then "$1" local x=1 2>/dev/null "$1" awk cd
+| cd test then grep $(pwd) awk test 2>/dev/null "$1" echo printf
+-eu printf cd 'quoted text' done
+	x=1 cd --verbose x=1 local x=1 /usr/bin
+awk grep readonly x=1 $(pwd) cd | && grep awk
+export && test awk && awk export ${HOME}
+	--verbose cd "$1" -eu export $(pwd) readonly $(pwd) "$@" readonly ${HOME} -eu
+x=1 test test sed printf
+		readonly "$@" 2>/dev/null cd local --verbose sed grep export &&
+		grep sed test x=1 --verbose test echo export
+		"$@" 2>/dev/null printf grep
+$(pwd) sed done && && export export
+readonly then local grep && | printf
+		readonly echo 2>/dev/null
+		/usr/bin readonly | /usr/bin echo "$@" grep "$1" x=1 awk echo done export ${HOME}
+	--verbose -eu ${HOME} | ${HOME} && echo readonly -eu x=1 'quoted text'
+done done "$@" | && local then test --verbose ${HOME} local
+		2>/dev/null echo -eu "$@" awk | && readonly ${HOME} cd "$1"
+		"$1" echo x=1 -eu --verbose /usr/bin printf cd 'quoted text' echo readonly
+printf "$1" 2>/dev/null printf x=1 readonly local && | done local printf echo
+| 'quoted text' --verbose --verbose && done && | export local then -eu 2>/dev/null
+done "$@" | local "$1" awk
+		readonly sed local export --verbose grep local
+	cd test "$@" && echo local x=1 -eu
+	x=1 x=1 grep 2>/dev/null sed /usr/bin $(pwd) done | printf echo readonly 'quoted text'
+printf 2>/dev/null 2>/dev/null readonly "$1" echo echo $(pwd) then
+	'quoted text' "$@" cd sed printf ${HOME}
+	echo cd $(pwd) echo readonly && 2>/dev/null sed --verbose
+	grep sed grep test -eu x=1 echo /usr/bin "$1" x=1 x=1 test |
+&& local ${HOME} then -eu "$1" printf grep
+-eu local cd /usr/bin -eu cd --verbose printf
+	grep -eu sed printf -eu done sed "$1"
+-eu "$@" printf awk test
+	&& grep ${HOME} --verbose --verbose
+		printf 'quoted text' then && local "$@" echo && 2>/dev/null
+${HOME} "$1" ${HOME} awk ${HOME} printf cd grep sed sed then --verbose 'quoted text'
+		test readonly && awk $(pwd) "$1" x=1 -eu x=1
+then test x=1 sed awk sed sed done echo && "$@"
+		${HOME} 2>/dev/null awk awk /usr/bin done sed 'quoted text'
+	sed export sed echo $(pwd) $(pwd) x=1 2>/dev/null
+awk ${HOME} grep -eu export local printf
+	| then readonly readonly test && awk /usr/bin awk && done readonly
+		then "$1" sed "$@" -eu | 'quoted text' cd grep echo cd "$@"
+-eu | x=1 /usr/bin && | 2>/dev/null
+awk x=1 printf --verbose
+		printf /usr/bin echo -eu
+		&& $(pwd) ${HOME} "$@" awk 'quoted text'
+x=1 "$1" 'quoted text' test "$@" readonly readonly local
+		--verbose done readonly -eu ${HOME}
+	${HOME} 2>/dev/null "$1" printf --verbose cd
+	done printf test ${HOME} awk && sed sed --verbose
+		/usr/bin 2>/dev/null "$1" &&
+	x=1 local readonly readonly | | sed 'quoted text'
+	"$1" 'quoted text' && local sed "$@" grep
+test sed $(pwd) /usr/bin /usr/bin grep export sed
+grep $(pwd) "$@" then $(pwd) && "$1" grep
+export x=1 'quoted text' ${HOME} | ${HOME} 2>/dev/null --verbose && printf local
+		2>/dev/null 'quoted text' export "$1" test 'quoted text' echo ${HOME} then
+	grep cd awk then sed export grep grep /usr/bin sed done sed 2>/dev/null
+		cd 2>/dev/null 2>/dev/null echo "$@" local printf cd local ${HOME} readonly
+	awk ${HOME} ${HOME} then | readonly "$@" done grep 2>/dev/null sed then ${HOME}
+	printf export "$@" && done grep "$@"
+		"$1" ${HOME} sed --verbose "$1" readonly 2>/dev/null --verbose "$@"
+cd "$@" cd echo ${HOME} | sed then
+-eu grep ${HOME} ${HOME} x=1 "$@" readonly
+		awk test ${HOME} awk readonly
+then export awk && x=1 grep local then $(pwd) echo
+	-eu "$@" $(pwd) -eu "$1" | done && --verbose /usr/bin sed
+		then test --verbose -eu then /usr/bin echo $(pwd) 'quoted text'
+		${HOME} grep then sed "$1"
+then test export done then /usr/bin x=1 done awk grep $(pwd) sed | | 2>/dev/null
+done "$@" echo local -eu awk 'quoted text' local awk "$1" x=1
+	x=1 test test x=1 2>/dev/null test 2>/dev/null "$@" then --verbose done |
+		'quoted text' readonly "$1" && grep test --verbose export
+"$@" echo && 'quoted text' /usr/bin echo echo x=1 ${HOME}
+	'quoted text' ${HOME} && printf test $(pwd) local then "$1"
+"$@" grep $(pwd) readonly "$1"
+x=1 then echo cd -eu 2>/dev/null -eu sed $(pwd)
+	/usr/bin printf export then &&
+	export /usr/bin ${HOME} test x=1 2>/dev/null then ${HOME} /usr/bin && /usr/bin
+/usr/bin 'quoted text' | test test | --verbose printf
+		cd awk awk grep ${HOME} readonly $(pwd) grep "$1" -eu "$@" x=1 $(pwd) 2>/dev/null
+2>/dev/null -eu "$@" | then readonly | test --verbose x=1 && 2>/dev/null /usr/bin
+	echo sed ${HOME} ${HOME} 'quoted text' grep printf $(pwd) | export
+		${HOME} "$1" printf local export &&
+2>/dev/null /usr/bin "$1" sed -eu local export echo "$1" /usr/bin x=1 $(pwd) $(pwd)
+		cd echo grep local awk -eu done -eu x=1 /usr/bin $(pwd) local
+		2>/dev/null export sed
+	"$1" grep readonly "$1" done grep
+		$(pwd) local && "$@" local 2>/dev/null echo sed readonly readonly /usr/bin
+	sed printf x=1 cd export cd ${HOME} "$1" 2>/dev/null
+	/usr/bin -eu | cd | printf
+	test --verbose "$1" cd /usr/bin && local echo 2>/dev/null done awk && 2>/dev/null
+		sed 2>/dev/null export then done done
+then "$1" 2>/dev/null readonly done "$1" x=1 x=1 export sed
+grep export export test printf
+test done ${HOME} local done test awk done cd awk cd "$1" cd then /usr/bin
+"$@" --verbose awk ${HOME}
+sed /usr/bin 2>/dev/null printf /usr/bin 2>/dev/null grep
+-eu && done x=1 "$1" "$1" "$@" sed cd | 'quoted text' /usr/bin sed && test 'quoted text'
+	cd | 'quoted text' && grep sed
+--verbose -eu --verbose "$@" $(pwd) | local cd $(pwd) awk ${HOME}
+		/usr/bin | 2>/dev/null awk cd && done readonly "$1" $(pwd) readonly
+/usr/bin cd 'quoted text' /usr/bin export export test ${HOME} local 2>/dev/null
+	grep $(pwd) x=1 "$1" test
+grep test echo local done && "$1" done 2>/dev/null
+		-eu local awk awk /usr/bin test && echo
+	"$@" -eu 'quoted text' awk --verbose grep
+test /usr/bin ${HOME} /usr/bin printf $(pwd)
+	awk export && local /usr/bin && 2>/dev/null cd echo ${HOME} "$@" $(pwd)
+sed printf cd /usr/bin awk export
+cd "$1" sed export then 2>/dev/null ${HOME} 2>/dev/null ${HOME} -eu
+		cd /usr/bin 2>/dev/null cd ${HOME} cd test readonly | test
+awk grep -eu && 2>/dev/null sed echo
+	&& done local 'quoted text' cd cd 'quoted text' x=1 x=1 x=1 grep | awk
+readonly then "$1" "$1"
+done -eu sed test cd test 2>/dev/null cd -eu grep 2>/dev/null
+	| test --verbose cd -eu
+&& x=1 2>/dev/null "$1" test printf echo ${HOME} export 2>/dev/null awk
+		${HOME} "$@" local done ${HOME} readonly export sed 'quoted text' export 'quoted text'
+then test $(pwd) then "$1" && local ${HOME} then && -eu "$1" | done grep done printf
+export 2>/dev/null 2>/dev/null
+		done $(pwd) awk $(pwd) 'quoted text' x=1 sed test -eu done x=1
+	2>/dev/null local "$1" sed
+	test | done readonly printf "$1" ${HOME} readonly then
+	--verbose test $(pwd) cd -eu --verbose "$@"
@@ -0,0 +1,2001 @@
+	export "$1" $(pwd) --verbose -eu readonly export
+printf then then readonly --verbose
+	then $(pwd) ${HOME} 'quoted text' && local | 'quoted text' local printf awk grep
+test then awk cd "$1" --verbose echo
+		readonly && | ${HOME} test sed test $(pwd) | awk
+	cd | "$1" --verbose echo
+/usr/bin -eu cd export echo 'quoted text' local export
+		-eu printf echo printf grep ${HOME} echo export /usr/bin awk 2>/dev/null
+done && x=1 echo cd echo "$1" test
+	x=1 printf local readonly sed awk /usr/bin local then
+		${HOME} && && echo -eu "$1" sed local --verbose done /usr/bin $(pwd) test local
+x=1 local printf 2>/dev/null -eu /usr/bin | 'quoted text' readonly local local
+	--verbose local 'quoted text' then echo
+x=1 test && cd echo "$@" "$@" | sed
+	"$1" echo "$1" awk export echo grep grep awk -eu ${HOME} grep awk export grep
+		awk 2>/dev/null test && /usr/bin awk
+	$(pwd) export readonly done &&
+		awk -eu $(pwd) -eu done -eu $(pwd) test local "$1"
+	done awk && done $(pwd) local --verbose $(pwd) grep --verbose ${HOME} ${HOME}
+local 'quoted text' "$1" | printf $(pwd) readonly --verbose
+	awk /usr/bin ${HOME} && "$@" test 'quoted text' sed --verbose ${HOME}
+	'quoted text' grep grep test
+	export /usr/bin echo $(pwd) echo $(pwd) /usr/bin x=1
+$(pwd) echo export printf
+export /usr/bin awk -eu test printf test /usr/bin
+	-eu awk local grep grep /usr/bin "$@" --verbose
+		echo echo 2>/dev/null ${HOME} ${HOME} | done test grep
+sed local sed /usr/bin 'quoted text' test
+		echo $(pwd) "$@" "$@" 2>/dev/null cd -eu
+		x=1 grep -eu --verbose "$1" cd echo 2>/dev/null done readonly
+--verbose local test &&
+	--verbose cd 'quoted text' awk awk echo | 2>/dev/null
+	cd ${HOME} test "$@" test --verbose
+		sed test printf awk awk
+	"$@" awk grep export 2>/dev/null awk "$@" "$@" -eu 'quoted text'
+	x=1 2>/dev/null cd test "$@" done cd awk 2>/dev/null 2>/dev/null 'quoted text'
+	grep printf done "$1" grep sed readonly
+		"$@" --verbose export then -eu then ${HOME} sed readonly
+		done | sed local "$1" readonly cd test 'quoted text' $(pwd)
+	done export awk export --verbose x=1 grep x=1 'quoted text' awk ${HOME} | 2>/dev/null
+		grep /usr/bin local 2>/dev/null "$1" "$1" awk x=1 "$@" 'quoted text' "$1" test local
+	"$@" awk 'quoted text' 'quoted text' -eu awk /usr/bin
+		'quoted text' sed "$@" 'quoted text' | readonly
+	-eu cd x=1 "$@" local local --verbose ${HOME} --verbose | readonly printf export
+	echo && && printf 'quoted text' ${HOME} "$@" | echo /usr/bin
+then --verbose -eu "$@" printf
+then local x=1 "$@" "$@" echo grep then &&
+&& $(pwd) echo ${HOME} done test then | 'quoted text' cd cd awk printf 'quoted text'
+	"$@" --verbose cd 2>/dev/null --verbose 2>/dev/null export printf
+	-eu | sed readonly $(pwd) "$1" "$1" local -eu local done done "$1" then
+'quoted text' ${HOME} cd printf
+then "$@" then local "$@" -eu && cd "$@" printf test test
+		done local awk done "$1" && then | grep readonly -eu
+	-eu "$1" /usr/bin test 'quoted text' && test export
+-eu "$@" then --verbose grep $(pwd) | done echo sed 'quoted text' 'quoted text'
+		grep 'quoted text' local 2>/dev/null
+2>/dev/null x=1 export then readonly ${HOME} --verbose | 2>/dev/null
+	echo --verbose sed 2>/dev/null x=1 then 2>/dev/null test --verbose local printf
+	&& awk export grep printf -eu -eu sed ${HOME} readonly
+		--verbose echo "$1" --verbose
+	readonly "$@" --verbose | echo done /usr/bin "$1" 'quoted text' --verbose
+	export /usr/bin readonly && ${HOME}
+		'quoted text' done cd then x=1 'quoted text' printf done "$1" export
+	-eu "$@" sed grep | echo printf printf $(pwd) then
+		x=1 readonly -eu awk awk echo -eu "$1"
+	--verbose --verbose export
+		'quoted text' then test sed ${HOME} "$@" awk "$@" $(pwd) "$1" "$1"
+	cd then sed printf local done ${HOME}
+printf && test grep | 'quoted text' printf local then 2>/dev/null
+done "$1" local then awk awk 'quoted text'
+	done /usr/bin sed sed x=1 ${HOME} local "$1" $(pwd) 2>/dev/null 2>/dev/null
+/usr/bin printf local "$@" export test $(pwd) $(pwd)
+	"$@" -eu export local sed echo awk | /usr/bin test 2>/dev/null done test local
+x=1 2>/dev/null local -eu /usr/bin 'quoted text' sed sed && ${HOME} "$@"
+test local "$@" | done then awk 'quoted text' x=1 then export
+printf /usr/bin export -eu
+		printf 2>/dev/null test export ${HOME} export local sed then && awk done cd
+	2>/dev/null export awk sed local ${HOME} --verbose then printf readonly x=1 &&
+	echo then && printf $(pwd) 2>/dev/null grep sed awk $(pwd) awk cd
+		awk awk printf readonly local --verbose
+		printf printf | done 'quoted text' -eu export local printf done echo awk
+		local -eu printf local | local $(pwd) 'quoted text'
+		done /usr/bin readonly ${HOME} awk x=1 "$1" --verbose
+		sed sed -eu grep --verbose x=1 then -eu
+	then grep /usr/bin $(pwd) ${HOME}
+		| "$1" $(pwd) | --verbose $(pwd) 2>/dev/null
+&& -eu && x=1 $(pwd) done | grep x=1 | 2>/dev/null awk x=1 x=1
+		/usr/bin | --verbose sed grep grep then "$@" && "$@" cd 'quoted text' grep
+		$(pwd) awk /usr/bin export
+sed $(pwd) | "$1" sed grep ${HOME} local "$1" && x=1 /usr/bin echo
+printf echo awk && 'quoted text' sed "$@" awk -eu 'quoted text'
+/usr/bin && /usr/bin export ${HOME} -eu "$@" --verbose
+${HOME} ${HOME} && then grep x=1 && 'quoted text' x=1 "$1" sed echo test
+	-eu then ${HOME} export "$@" | /usr/bin 2>/dev/null "$1" then
+		| ${HOME} readonly "$1" export "$@" grep x=1 -eu 2>/dev/null grep
+		$(pwd) "$1" "$1" 'quoted text'
+		then printf --verbose then && printf then
+		then readonly 2>/dev/null 'quoted text' && --verbose
+		sed 'quoted text' echo $(pwd)
+		-eu $(pwd) done $(pwd) "$1" printf /usr/bin ${HOME} then local done $(pwd) "$1"
+	local echo cd --verbose readonly /usr/bin ${HOME} then 2>/dev/null local
+	'quoted text' readonly local
+	grep cd awk done --verbose printf | && /usr/bin
+	${HOME} printf -eu 'quoted text' 2>/dev/null
+	readonly awk 'quoted text' && x=1
+		| cd | ${HOME} test $(pwd) awk |
+		2>/dev/null | test ${HOME} "$1" echo printf
+	readonly echo -eu awk 2>/dev/null
+		then local | then test test ${HOME} | then x=1 2>/dev/null
+done /usr/bin awk $(pwd) "$@" 2>/dev/null cd printf
+test printf x=1 x=1 cd ${HOME} | grep awk && grep cd --verbose grep | export cd
+	echo then && printf /usr/bin awk && test then echo ${HOME} local && done
+| local "$1" 'quoted text' grep && local then then local
+	&& awk readonly /usr/bin grep | readonly $(pwd) 2>/dev/null 2>/dev/null
+	awk export test $(pwd) awk local
+	then printf printf export awk "$@" /usr/bin sed grep
+$(pwd) grep ${HOME} test sed
+	grep cd 'quoted text'
+		x=1 local printf ${HOME} "$1"
+		readonly "$1" 'quoted text' 'quoted text'
+		"$@" /usr/bin test x=1 done $(pwd) sed && cd $(pwd)
+-eu test /usr/bin | 'quoted text'
+		--verbose 2>/dev/null $(pwd) /usr/bin $(pwd) awk awk $(pwd) "$@" 'quoted text'
+		test "$@" export printf
+readonly echo sed ${HOME} | test && --verbose 'quoted text' sed x=1
+	printf 'quoted text' local awk $(pwd) "$1"
+x=1 "$@" $(pwd) then then "$1" then printf "$1" "$@" 'quoted text' grep test cd
+	local test "$1" | --verbose ${HOME}
+echo echo -eu local awk $(pwd) | echo "$@" local /usr/bin x=1 grep readonly
+--verbose 2>/dev/null --verbose test readonly --verbose -eu /usr/bin
+		grep $(pwd) $(pwd) && && then
+		awk ${HOME} sed printf readonly then && readonly -eu | -eu | /usr/bin cd 2>/dev/null
+		2>/dev/null local readonly
+sed && 2>/dev/null grep | local 2>/dev/null ${HOME} done sed printf "$1"
+		readonly sed x=1 cd -eu ${HOME} awk "$@" | printf
+	&& local export | /usr/bin cd -eu export awk readonly
+	awk printf sed cd then ${HOME} 'quoted text'
+		then test printf ${HOME} "$1" | then x=1 echo 'quoted text'
+sed then && test readonly awk && 2>/dev/null
+export "$@" 2>/dev/null done $(pwd)
+		local --verbose "$@" | "$1" 'quoted text' printf then echo done test
+readonly done awk then ${HOME}
+		'quoted text' --verbose 'quoted text' -eu test 'quoted text'
+	local $(pwd) echo "$1" && x=1 test export export export 'quoted text'
+	--verbose -eu -eu then awk --verbose done
+awk | export then awk printf --verbose $(pwd) "$1" readonly
+echo 'quoted text' echo $(pwd) awk "$@" "$1" x=1 x=1 test
+cd ${HOME} "$1" awk && readonly test local x=1 echo
+--verbose --verbose &&
+echo x=1 "$1" test /usr/bin cd echo sed sed
+echo "$@" then | "$@" export printf && && readonly -eu -eu
+printf "$@" done ${HOME} sed "$1" && printf
+test grep printf -eu local && done echo then /usr/bin
+${HOME} then ${HOME} export local local test |
+	awk done grep export ${HOME} -eu -eu "$1" cd "$@" done done ${HOME}
+		readonly grep done && -eu then "$@" done | printf "$@" ${HOME} export sed awk /usr/bin
+		'quoted text' $(pwd) "$@" x=1 echo grep export
+	grep && awk awk echo export then 2>/dev/null 'quoted text' -eu ${HOME}
+	readonly export local x=1 cd grep awk test
+		/usr/bin 'quoted text' done
+	grep then 'quoted text' --verbose "$1" $(pwd)
+echo grep x=1 awk cd cd export
+then then | grep then test readonly $(pwd) && sed local 2>/dev/null
+		readonly sed readonly local grep 'quoted text' "$1" done
+		grep echo readonly ${HOME}
+	"$@" | grep done awk ${HOME}
+	export /usr/bin then done "$@" "$@" done local 2>/dev/null "$@" sed
+		-eu awk export export then test "$1"
+		'quoted text' && x=1 printf | grep grep |
+	echo | printf | /usr/bin "$@" echo 2>/dev/null | "$1"
+"$@" readonly then "$@" then echo local && sed | test | sed $(pwd)
+2>/dev/null local /usr/bin printf $(pwd) x=1 printf x=1 local
+	echo printf done sed | && local done /usr/bin done done
+then "$1" && grep cd cd x=1 echo export awk -eu "$1" ${HOME} ${HOME}
+	echo then ${HOME} done
+		'quoted text' && x=1 "$1" awk printf echo grep awk printf 'quoted text'
+		/usr/bin test "$1" "$@"
+'quoted text' "$@" --verbose test readonly
+	/usr/bin local cd --verbose export readonly
+		readonly --verbose $(pwd) then 2>/dev/null
+		cd ${HOME} sed done grep then "$@" ${HOME} grep then readonly
+		then 2>/dev/null readonly /usr/bin && grep sed grep
+		x=1 sed then && $(pwd) printf 2>/dev/null printf grep x=1
+		local done then --verbose | then test test | 2>/dev/null
+cd done test --verbose done --verbose echo | $(pwd) --verbose --verbose
+	--verbose --verbose sed then
+	awk local "$@" ${HOME} cd $(pwd) 'quoted text' "$@" local export $(pwd) 'quoted text'
+	"$@" echo | -eu export && -eu "$@" printf done printf grep
+		2>/dev/null echo readonly cd -eu && | "$1" && sed printf export "$1" then
+x=1 awk cd cd --verbose x=1 | -eu
+	--verbose $(pwd) ${HOME}
+		"$@" ${HOME} done then x=1 /usr/bin done "$@" | done 2>/dev/null $(pwd) sed export
+	x=1 done grep export sed awk /usr/bin
+	test local cd 'quoted text' -eu "$@" sed done sed cd export /usr/bin cd export
+--verbose test done echo && && "$@" test "$@" --verbose test test done done
+		/usr/bin && export sed then echo
+local "$1" printf 2>/dev/null grep x=1 awk echo sed cd "$@" printf readonly
+		&& readonly $(pwd) | printf "$@" cd local 'quoted text'
+		2>/dev/null readonly "$1" "$@" readonly readonly export && cd
+		&& awk $(pwd) sed "$@" local awk sed local -eu -eu $(pwd)
+	/usr/bin --verbose 2>/dev/null 'quoted text'
+	/usr/bin local readonly done --verbose
+/usr/bin "$@" awk grep "$1" test sed |
+		--verbose 'quoted text' "$@" sed /usr/bin 'quoted text'
+	"$1" grep --verbose x=1 sed 2>/dev/null echo "$1" awk local readonly
+		&& then $(pwd) test --verbose "$1" -eu export awk -eu cd | 'quoted text'
+done sed 2>/dev/null "$1" awk ${HOME} "$1" printf
+/usr/bin "$@" then "$@" echo readonly export $(pwd) &&
+	${HOME} done "$1" then 2>/dev/null $(pwd)
+"$@" test "$@" x=1 grep printf printf then -eu grep
+	"$@" -eu /usr/bin 2>/dev/null
+awk cd 2>/dev/null printf readonly -eu /usr/bin awk
+export $(pwd) awk --verbose grep local
+	| ${HOME} grep test printf x=1 then local -eu
+/usr/bin sed readonly
+	| echo printf 'quoted text' export -eu local awk $(pwd) local done
+"$1" printf local ${HOME} "$@" done echo
+		/usr/bin sed done readonly && test grep "$@" x=1 'quoted text' then
+		/usr/bin grep x=1 done --verbose readonly echo local x=1 -eu then grep echo 'quoted text'
+grep done && $(pwd) readonly -eu cd sed | grep export test &&
+		${HOME} --verbose then printf readonly printf printf | | grep echo sed sed export
+	"$1" -eu && done export x=1 grep echo ${HOME}
+x=1 awk local 2>/dev/null | test -eu cd
+"$@" grep grep 2>/dev/null $(pwd) 'quoted text' --verbose --verbose awk local
+	awk awk 'quoted text' 'quoted text' sed | readonly -eu && echo readonly
+	printf /usr/bin && then $(pwd)
+	x=1 then readonly 'quoted text' /usr/bin awk "$@"
+		local done | /usr/bin readonly local readonly awk grep 'quoted text' printf export
+	--verbose cd sed printf /usr/bin | export x=1 printf 'quoted text' awk test 2>/dev/null
+--verbose "$1" | /usr/bin cd grep export $(pwd) 2>/dev/null
+	"$1" awk $(pwd) 2>/dev/null ${HOME} /usr/bin
+	| x=1 --verbose ${HOME} test local --verbose /usr/bin echo done
+	cd /usr/bin local grep echo awk "$1" 2>/dev/null --verbose test --verbose cd 2>/dev/null
+test | printf $(pwd) ${HOME} --verbose done 2>/dev/null awk grep $(pwd)
+--verbose echo printf done -eu printf && --verbose
+		readonly cd done sed && 'quoted text'
+		export && && grep -eu cd /usr/bin
+	'quoted text' cd echo grep -eu x=1 --verbose then
+	/usr/bin ${HOME} $(pwd) readonly ${HOME} local done then then /usr/bin printf
+		local 'quoted text' "$@" $(pwd) && -eu -eu
+awk sed --verbose echo cd grep x=1 -eu --verbose
+	export then x=1 export then -eu && grep echo local then --verbose
+	export && export test "$1"
+	export readonly echo | echo "$@" grep "$1" cd -eu "$1" --verbose -eu 'quoted text'
+	'quoted text' -eu then "$@"
+	local export ${HOME} $(pwd) done 'quoted text'
+'quoted text' "$1" export | $(pwd) &&
+		export sed --verbose test echo 'quoted text' x=1 cd then
+		export $(pwd) --verbose $(pwd) ${HOME} &&
+	-eu grep "$@" x=1 cd "$1" readonly awk "$1" cd "$@" test -eu 'quoted text'
+	then echo $(pwd) ${HOME} readonly
+local "$@" ${HOME} | grep
+export -eu /usr/bin && "$1" ${HOME} x=1 --verbose awk
+	${HOME} echo printf readonly --verbose awk then 'quoted text' --verbose
+	then "$@" -eu sed local | -eu readonly x=1 | "$1" x=1 printf test && echo -eu
+	test grep done "$@" ${HOME} "$1" export
+local printf ${HOME} && -eu done "$1" awk 'quoted text' x=1
+		--verbose then | grep test printf awk ${HOME} done -eu printf $(pwd)
+"$@" 2>/dev/null readonly test /usr/bin
+-eu $(pwd) "$@" printf
+	done done awk "$1" awk local "$1" done ${HOME} 2>/dev/null awk ${HOME} awk
+		2>/dev/null grep done -eu 'quoted text' echo
+		'quoted text' $(pwd) "$@"
+		$(pwd) cd --verbose | export sed -eu printf readonly
+-eu grep then 2>/dev/null cd cd --verbose grep | | sed printf x=1 2>/dev/null ${HOME}
+		"$1" echo local --verbose printf readonly readonly test $(pwd) sed x=1 ${HOME} "$@"
+then 2>/dev/null cd ${HOME} $(pwd) 2>/dev/null $(pwd)
+then 2>/dev/null 'quoted text' ${HOME}
+"$1" then x=1 ${HOME} /usr/bin export && 2>/dev/null
+	"$@" cd then -eu export then readonly && | printf /usr/bin
+		'quoted text' $(pwd) 2>/dev/null awk done grep --verbose done
+	x=1 "$1" echo readonly echo
+--verbose echo grep -eu && printf done
+&& ${HOME} $(pwd) test -eu "$@" cd /usr/bin
+	done 'quoted text' readonly
+		"$@" ${HOME} export /usr/bin -eu --verbose 2>/dev/null done awk -eu | "$@" sed
+	grep export /usr/bin grep
+	${HOME} | ${HOME} echo -eu 'quoted text' 'quoted text' "$1" then readonly export
+	export /usr/bin sed -eu echo 'quoted text' | $(pwd) -eu test
+		x=1 local grep awk && done 2>/dev/null awk ${HOME} | 'quoted text' readonly
+		cd | echo "$1" printf then
+test cd --verbose /usr/bin test 'quoted text' done local
+		readonly done 2>/dev/null $(pwd) ${HOME} && sed
+x=1 /usr/bin local 2>/dev/null
+	'quoted text' x=1 x=1
+"$@" export printf "$@" ${HOME} |
+	${HOME} x=1 | $(pwd) /usr/bin cd awk then readonly "$1"
+readonly -eu local printf && -eu x=1 test sed awk local export
+export test 'quoted text' -eu --verbose export grep 2>/dev/null
+	$(pwd) sed awk "$@" echo
+	-eu export -eu $(pwd) && grep echo export
+	awk echo test echo /usr/bin $(pwd) printf grep awk grep
+		echo /usr/bin ${HOME}
+--verbose -eu 'quoted text' export echo test awk -eu then then $(pwd) | awk "$@"
+$(pwd) then test readonly $(pwd) done sed 'quoted text'
+sed "$1" /usr/bin --verbose 2>/dev/null | cd export "$@" ${HOME} done $(pwd)
+	done x=1 export echo sed readonly sed 'quoted text'
+		cd 2>/dev/null then /usr/bin printf |
+then "$1" ${HOME} echo x=1 -eu && ${HOME} 'quoted text' -eu $(pwd) grep
+		| echo ${HOME} export readonly sed
+printf echo grep ${HOME} --verbose "$1" -eu --verbose then && | sed then
+${HOME} test "$@" cd && "$1" x=1 done
+${HOME} printf grep sed -eu cd | cd sed
+		'quoted text' readonly awk 'quoted text'
+	cd $(pwd) local readonly test
+--verbose done --verbose echo test --verbose --verbose cd echo export
+		--verbose local cd ${HOME} echo | grep ${HOME} readonly -eu "$1" cd
+&& --verbose "$@" awk "$1" --verbose
+"$@" sed && local echo export grep grep awk --verbose "$@"
+	"$@" done sed done --verbose 'quoted text' sed cd awk echo grep $(pwd) 'quoted text'
+	echo cd -eu -eu local done $(pwd) --verbose --verbose
+	"$@" /usr/bin ${HOME}
+	grep 'quoted text' 'quoted text' sed done test cd cd readonly test
+x=1 "$@" 'quoted text' "$@" x=1 'quoted text' | local test --verbose
+		${HOME} "$1" | sed grep ${HOME} done export export "$@" $(pwd) "$1" awk
+	| && --verbose awk $(pwd) "$1" 'quoted text' then readonly && printf -eu
+	sed /usr/bin cd $(pwd) "$1" /usr/bin readonly
+		sed then then awk cd then printf && export
+-eu export "$1" done test awk test $(pwd) test | sed "$1"
+		printf 'quoted text' --verbose
+	2>/dev/null done then local local printf x=1 awk test "$1" sed -eu then "$1" grep
+"$1" sed | --verbose -eu echo x=1 ${HOME} readonly
+grep "$@" sed x=1 ${HOME} ${HOME} awk -eu export awk cd
+	${HOME} "$1" ${HOME} "$1" local x=1 local test awk /usr/bin /usr/bin
+	--verbose x=1 printf 2>/dev/null test printf $(pwd) --verbose
+		${HOME} local 'quoted text' test 'quoted text'
+		x=1 $(pwd) readonly local printf local awk readonly
+		grep cd -eu sed test
+"$1" "$@" x=1 sed | then echo | grep cd local grep 2>/dev/null
+		test echo cd test x=1 then
+		x=1 awk export awk --verbose "$1"
+"$@" then && "$@" "$1" "$1" $(pwd)
+2>/dev/null readonly export 2>/dev/null
+$(pwd) | && ${HOME} readonly $(pwd) && readonly x=1 "$@" $(pwd) printf x=1 -eu
+	${HOME} done sed /usr/bin $(pwd) printf echo && printf export
+	local export local --verbose awk readonly sed done export echo "$1" readonly
+	$(pwd) 'quoted text' test done grep | "$1"
+"$@" x=1 awk x=1 && 2>/dev/null 2>/dev/null
+then 2>/dev/null sed "$1" ${HOME} x=1 2>/dev/null cd cd test printf then
+	echo done /usr/bin test local $(pwd) --verbose grep x=1
+	/usr/bin export cd cd "$1" 2>/dev/null && printf grep readonly readonly
+	echo grep 'quoted text' "$@" 2>/dev/null $(pwd) export
+echo /usr/bin "$1" && cd grep "$1" /usr/bin --verbose awk x=1 "$1" $(pwd)
+		x=1 | local 2>/dev/null sed ${HOME} sed x=1 test | export x=1 --verbose
+		x=1 && "$1" | x=1 /usr/bin echo "$@" | printf
+		'quoted text' x=1 | 'quoted text'
+	then -eu sed local 'quoted text' | $(pwd)
+-eu 2>/dev/null | "$@" 'quoted text' local printf echo
+		&& $(pwd) 2>/dev/null sed export 'quoted text' 'quoted text' | export
+	grep readonly export awk && /usr/bin /usr/bin
+grep echo "$@" "$@" sed 2>/dev/null local export | | ${HOME} --verbose x=1
+'quoted text' "$@" x=1 then --verbose echo export /usr/bin 'quoted text'
+		awk /usr/bin grep ${HOME} echo echo local
+echo ${HOME} then /usr/bin awk x=1 local $(pwd) sed 2>/dev/null then 'quoted text'
+	readonly readonly /usr/bin && grep done sed | "$1" local readonly local
+echo printf "$1" sed $(pwd) ${HOME} | done
+		"$1" | echo x=1 2>/dev/null
+	'quoted text' && test $(pwd) grep /usr/bin export readonly
+		x=1 && | /usr/bin test sed ${HOME}
+		echo then $(pwd) test "$@"
+grep -eu ${HOME} 2>/dev/null 2>/dev/null -eu | then 2>/dev/null
+		test sed echo ${HOME} 2>/dev/null --verbose x=1 readonly ${HOME} readonly /usr/bin
+		$(pwd) grep && -eu cd /usr/bin readonly
+2>/dev/null printf | | done awk awk --verbose 'quoted text' printf
+		${HOME} awk readonly ${HOME} export export "$1" then local
+	x=1 "$@" x=1 $(pwd) local
+sed awk local && /usr/bin 'quoted text' $(pwd)
+	/usr/bin then printf ${HOME} done awk echo | $(pwd) | | cd | done
+		x=1 "$1" $(pwd) sed "$@" awk local 'quoted text' | grep -eu "$1" sed local ${HOME}
+then 'quoted text' then -eu echo "$@" 2>/dev/null
+| echo then --verbose test
+	$(pwd) "$1" "$@" test | done sed sed export 2>/dev/null -eu
+		test awk export ${HOME} then "$1" sed readonly --verbose "$@" sed test 'quoted text'
+		${HOME} && sed 2>/dev/null then awk
+sed awk awk ${HOME} -eu awk && test done 2>/dev/null
+	printf echo cd 2>/dev/null 2>/dev/null
+		echo 'quoted text' 2>/dev/null awk test ${HOME} test grep 'quoted text'
+		/usr/bin readonly --verbose $(pwd) && printf then done
+	awk x=1 $(pwd) 'quoted text' export ${HOME} | sed
+	${HOME} export done sed done -eu test sed --verbose | grep readonly
+		&& echo cd grep grep export "$1" sed /usr/bin local export
+	&& echo -eu 'quoted text' echo test sed -eu cd local 2>/dev/null
+		then && then 'quoted text' export awk $(pwd) echo "$@" 2>/dev/null "$@" grep
+		echo test awk 'quoted text' | echo
+	done awk done $(pwd) cd ${HOME}
+		${HOME} readonly /usr/bin awk readonly -eu then grep 'quoted text' grep && --verbose
+"$@" ${HOME} readonly echo echo $(pwd) ${HOME} cd done
+	| /usr/bin $(pwd) grep ${HOME} test
+		readonly export | "$1" && grep cd 2>/dev/null sed | then then readonly awk 2>/dev/null
+		| ${HOME} awk export then -eu local
+sed test | --verbose "$@" echo local x=1 cd test x=1
+	"$1" then 2>/dev/null --verbose --verbose
+	cd local | then -eu sed sed
+		"$@" grep $(pwd) done test && readonly grep readonly /usr/bin 'quoted text'
+	x=1 ${HOME} --verbose cd local printf "$@"
+sed /usr/bin awk $(pwd) export test $(pwd) done
+awk readonly "$1" local then 'quoted text' -eu 'quoted text'
+		printf awk ${HOME} printf ${HOME} readonly "$1"
+	grep 'quoted text' local | export
+&& 2>/dev/null export grep
+	then "$@" printf awk && 'quoted text' echo local test --verbose
+	grep ${HOME} ${HOME} test
+sed echo test -eu "$1" sed x=1 /usr/bin awk printf
+	${HOME} then export 2>/dev/null x=1 | grep then sed awk
+sed printf && test export 'quoted text'
+		x=1 "$1" sed --verbose echo -eu
+cd -eu echo --verbose --verbose
+		$(pwd) export -eu 'quoted text' --verbose ${HOME} | done echo sed sed awk
+--verbose cd "$@" "$@"
+		local echo cd sed printf && export
+grep done then readonly /usr/bin ${HOME} ${HOME} /usr/bin 2>/dev/null
+		$(pwd) readonly -eu awk |
+sed "$1" echo /usr/bin "$1" $(pwd) 2>/dev/null -eu x=1 echo | readonly local
+"$1" ${HOME} "$@" | grep done "$1" "$1" && echo sed 'quoted text' /usr/bin x=1
+		grep 2>/dev/null 2>/dev/null awk
+		/usr/bin x=1 echo x=1 'quoted text' sed
+local printf readonly sed
+/usr/bin awk cd 'quoted text' done test test test local
+	done ${HOME} "$1" export readonly test sed --verbose then ${HOME}
+	$(pwd) $(pwd) | /usr/bin x=1 local "$@" 2>/dev/null "$@" "$@" sed $(pwd)
+		"$1" && echo $(pwd) 2>/dev/null /usr/bin then done x=1 then -eu -eu done && &&
+	grep 'quoted text' echo then "$1" -eu readonly cd -eu --verbose
+| ${HOME} printf echo --verbose sed cd "$1" echo ${HOME} then
+	/usr/bin export awk -eu && "$1" awk echo then
+done done then echo | x=1 && then "$1" x=1 echo |
+	2>/dev/null test grep export export $(pwd) done cd done
+	awk ${HOME} --verbose /usr/bin 'quoted text' 2>/dev/null "$1"
+	awk printf echo && /usr/bin local sed && | awk export /usr/bin local
+	awk 'quoted text' done -eu local --verbose
+		cd ${HOME} sed awk ${HOME} -eu cd readonly export
+		local cd --verbose --verbose local
+	awk test 'quoted text' awk echo
+	cd echo 'quoted text' ${HOME} ${HOME} done awk then
+		&& "$@" "$1" then done
+		printf then | $(pwd) awk
+x=1 then "$1" $(pwd)
+		then printf test "$1" 'quoted text'
+		--verbose readonly awk -eu then 2>/dev/null
+		x=1 local readonly export -eu
+		'quoted text' ${HOME} echo
+x=1 local 'quoted text' local 'quoted text' "$@" ${HOME} "$@" &&
+	test --verbose && printf --verbose awk 2>/dev/null && sed 'quoted text' sed /usr/bin
+		local done -eu "$@" sed && done export then then /usr/bin
+printf ${HOME} "$@" x=1 && sed printf
+	grep && -eu $(pwd) x=1 && echo grep 2>/dev/null
+awk grep local grep printf sed 2>/dev/null export 2>/dev/null "$1" ${HOME}
+cd /usr/bin | /usr/bin sed /usr/bin awk awk ${HOME} "$1" export
+		export -eu printf 2>/dev/null
+--verbose printf awk cd local $(pwd)
+readonly awk echo awk "$@" x=1 done printf grep "$@" /usr/bin ${HOME}
+	'quoted text' ${HOME} sed awk then "$1" printf
+		test "$@" /usr/bin ${HOME} /usr/bin local
+"$@" test 2>/dev/null readonly x=1
+	cd done && test /usr/bin echo $(pwd) x=1 | done test $(pwd) /usr/bin
+done 2>/dev/null ${HOME} x=1 test 'quoted text'
+	printf "$@" --verbose 2>/dev/null awk x=1 local export test local | local
+		test then $(pwd) 'quoted text' readonly
+| "$@" then sed echo
+	2>/dev/null sed cd /usr/bin "$1" export | local
+		| cd then -eu x=1 cd local echo cd then | echo x=1 "$@" ${HOME} printf local readonly
+		then test local /usr/bin /usr/bin cd printf local "$1" grep local
+export 'quoted text' "$@"
+export local 'quoted text' x=1 cd | 2>/dev/null done echo --verbose
+	awk readonly /usr/bin
+		printf test "$1" then done | readonly /usr/bin sed export grep test -eu
+		awk local done x=1 test printf 2>/dev/null 'quoted text' grep --verbose
+sed export done | then --verbose
+readonly sed --verbose | x=1 --verbose --verbose 'quoted text'
+		/usr/bin sed printf --verbose
+	readonly | "$@" x=1 "$1" local ${HOME} -eu cd /usr/bin && ${HOME} echo
+	'quoted text' done test
+grep export done "$1" sed
+| "$1" | ${HOME} echo local printf grep /usr/bin "$@"
+	sed then $(pwd) --verbose
+then echo test sed --verbose --verbose
+	-eu printf echo done "$1" x=1 grep sed x=1 -eu $(pwd) 'quoted text'
+done "$1" grep test awk done -eu "$@" "$1" 2>/dev/null
+		&& done 2>/dev/null local x=1 then done grep | -eu echo
+then then | | local done grep -eu echo x=1 ${HOME} x=1 readonly $(pwd)
+	2>/dev/null --verbose printf done $(pwd) "$@" local test
+		export 'quoted text' awk done echo ${HOME}
+done -eu cd test then awk /usr/bin sed echo "$@" then printf "$@" x=1
+x=1 "$1" sed grep export grep ${HOME}
+		done --verbose awk awk printf
+-eu "$1" $(pwd) "$@" x=1 | printf x=1 printf | local -eu && /usr/bin done local
+		2>/dev/null | "$1" 2>/dev/null
+		test | echo cd printf sed "$1" --verbose printf "$@"
+	printf "$1" 2>/dev/null --verbose
+cd "$@" 2>/dev/null test x=1 printf done readonly
+	readonly 2>/dev/null | cd | done x=1 local then --verbose echo
+then export printf 2>/dev/null && | $(pwd) 2>/dev/null -eu then
+readonly ${HOME} /usr/bin test
+	done | && 2>/dev/null local --verbose -eu /usr/bin cd test $(pwd) &&
+		echo /usr/bin --verbose local echo "$1" grep | grep export $(pwd) | test --verbose
+'quoted text' then printf done | local done /usr/bin &&
+	/usr/bin cd /usr/bin && export printf grep grep
+		'quoted text' ${HOME} ${HOME} echo test then export cd grep readonly
+	"$@" -eu $(pwd) 'quoted text'
+		$(pwd) sed done test export 2>/dev/null cd local grep --verbose ${HOME} test
+		awk sed local grep /usr/bin ${HOME} 2>/dev/null
+	cd x=1 test "$1" "$@" readonly sed
+		done -eu ${HOME} grep grep ${HOME} printf printf -eu
+	--verbose "$@" 'quoted text' test 'quoted text' test --verbose
+		/usr/bin export && "$1" readonly readonly
+		${HOME} grep test awk export
+	${HOME} /usr/bin 2>/dev/null
+	echo test ${HOME} "$@" $(pwd)
+	--verbose 2>/dev/null && awk done cd then
+readonly /usr/bin x=1 $(pwd) 'quoted text' x=1 -eu $(pwd)
+2>/dev/null local echo grep awk /usr/bin "$1" cd 'quoted text' then
+$(pwd) awk awk printf && 'quoted text' "$1" | x=1 local "$1" readonly -eu export
+	"$1" done x=1 grep --verbose readonly | ${HOME}
+| sed 2>/dev/null cd -eu local grep readonly awk local
+	&& && grep then x=1 cd
+sed "$@" readonly printf
+${HOME} -eu ${HOME} grep awk --verbose -eu | grep --verbose --verbose --verbose
+	local 2>/dev/null $(pwd) readonly readonly
+		grep --verbose $(pwd) cd "$@" x=1 'quoted text' then printf
+	/usr/bin && && $(pwd) readonly grep
+export $(pwd) /usr/bin then $(pwd) | "$@"
+		2>/dev/null --verbose done && export done export 'quoted text'
+	cd /usr/bin | "$1" awk x=1 $(pwd) 2>/dev/null
+		export grep then $(pwd) "$@" x=1 sed sed printf -eu then $(pwd) "$1" cd
+&& x=1 grep done sed done -eu 'quoted text'
+--verbose | then -eu "$@" export
+grep | | "$@" $(pwd) "$1" "$1" --verbose "$@" && sed then done
+	--verbose done printf "$@" awk done sed --verbose
+	export x=1 2>/dev/null "$@" cd x=1 test sed && "$1"
+	readonly --verbose then awk
+	-eu printf export printf -eu sed /usr/bin ${HOME} sed then printf 'quoted text'
+	2>/dev/null && then "$1" readonly --verbose sed done cd
+printf test /usr/bin done "$@" /usr/bin $(pwd) awk readonly "$1" && -eu test
+grep sed local ${HOME} x=1 --verbose readonly $(pwd) x=1 2>/dev/null
+'quoted text' /usr/bin export | done local ${HOME}
+		&& "$1" ${HOME} echo 'quoted text' ${HOME} export | $(pwd) local printf $(pwd) 'quoted text'
+test "$1" readonly test done -eu export echo readonly x=1 printf ${HOME}
+		local && then grep && 'quoted text' $(pwd) sed grep
+		printf -eu sed test then /usr/bin --verbose
+		readonly | grep | 2>/dev/null
+printf -eu export $(pwd) "$1" awk && test
+printf sed cd x=1 "$1" "$1" --verbose sed 2>/dev/null printf $(pwd) "$@" test
+${HOME} awk printf sed 'quoted text' then 'quoted text' readonly printf &&
+	echo then "$@" -eu 2>/dev/null --verbose
+		"$@" | x=1 readonly readonly grep printf -eu "$@" local
+sed echo printf | readonly grep 'quoted text'
+2>/dev/null /usr/bin echo grep cd echo done export readonly
+readonly 2>/dev/null "$1" sed --verbose test | done x=1 -eu /usr/bin "$@" local
+	'quoted text' "$1" 'quoted text' local $(pwd) /usr/bin
+		awk printf | printf "$@"
+	sed export "$1" "$1" ${HOME} awk | readonly test 2>/dev/null
+"$1" | sed readonly "$@" -eu /usr/bin /usr/bin | &&
+	export && /usr/bin then -eu local export ${HOME} echo | x=1 -eu "$1" --verbose
+	2>/dev/null --verbose | awk x=1 'quoted text'
+${HOME} --verbose "$1" | "$1" export --verbose then test sed
+"$1" ${HOME} x=1 --verbose "$@" --verbose "$1" -eu "$1" "$1" "$1"
+		"$@" --verbose export "$1" echo | sed
+-eu -eu readonly printf done awk awk done echo echo -eu local export && 'quoted text'
+	local --verbose /usr/bin --verbose -eu cd readonly ${HOME} done sed printf
+		--verbose --verbose sed done && export /usr/bin
+	echo "$@" printf --verbose | x=1 readonly $(pwd) 2>/dev/null 'quoted text'
+		'quoted text' cd 'quoted text' && ${HOME} sed $(pwd) sed "$@" cd | &&
+&& cd /usr/bin local "$1" test grep
+	sed local export printf then cd "$@"
+		cd awk test echo /usr/bin
+	local grep export "$@" --verbose ${HOME} x=1 printf local
+		done sed /usr/bin /usr/bin -eu $(pwd) $(pwd) ${HOME} -eu test
+x=1 cd 2>/dev/null "$@" "$1" 2>/dev/null
+	/usr/bin /usr/bin readonly awk
+		2>/dev/null ${HOME} -eu | then -eu readonly 2>/dev/null cd
+	/usr/bin | local then readonly | sed "$1" "$1" readonly --verbose /usr/bin
+	&& 2>/dev/null x=1 test done ${HOME} then readonly /usr/bin
+		export cd awk grep export export --verbose && ${HOME} local done awk then
+		${HOME} done "$@" sed x=1 x=1 test printf &&
+awk && /usr/bin grep | $(pwd) | cd cd awk sed printf printf
+	then local 'quoted text' echo done sed $(pwd) | && grep export | readonly
+sed sed test | "$@" readonly -eu printf export | grep echo export
+		/usr/bin readonly test awk -eu
+		"$1" x=1 printf && --verbose
+	2>/dev/null "$1" 2>/dev/null 2>/dev/null
+| done --verbose cd printf cd awk
+awk -eu | local readonly 'quoted text' $(pwd) then local grep ${HOME} grep
+		cd "$@" "$@" readonly cd done echo echo local readonly
+	export grep | readonly readonly readonly x=1 export && grep grep
+done then then done printf test cd done
+		$(pwd) local 'quoted text'
+	grep 2>/dev/null awk grep && echo printf
+		/usr/bin test awk cd $(pwd)
+	grep awk then 'quoted text' then
+		export awk sed readonly printf grep | readonly -eu ${HOME} && then 2>/dev/null
+		"$1" printf printf $(pwd)
+"$1" $(pwd) x=1 then "$@" export "$@" && 'quoted text' $(pwd) "$@" echo
+	"$@" x=1 grep export "$@" echo then --verbose "$1"
+		"$1" /usr/bin | grep
+		/usr/bin grep echo readonly x=1
+	"$1" then printf export export 'quoted text' -eu
+$(pwd) /usr/bin done then ${HOME} grep sed ${HOME} then
+	| done awk cd /usr/bin "$@" readonly printf x=1
+		/usr/bin export $(pwd) grep x=1 readonly awk done local done
+		export local /usr/bin grep ${HOME}
+	x=1 -eu cd local ${HOME} printf test
+| --verbose printf cd echo 'quoted text' x=1
+		/usr/bin /usr/bin export awk | ${HOME} -eu --verbose ${HOME}
+"$1" 'quoted text' export readonly $(pwd)
+		test -eu local "$@" 'quoted text' readonly && echo sed "$@" echo echo
+		printf test /usr/bin "$@" $(pwd) "$@" 'quoted text' && /usr/bin x=1 grep -eu
+		echo done ${HOME} ${HOME} "$@" grep done 'quoted text' /usr/bin local /usr/bin
+	"$1" "$@" test sed "$@" export grep -eu ${HOME} /usr/bin
+	cd "$1" 2>/dev/null /usr/bin -eu local
+	&& readonly | 'quoted text' && readonly readonly ${HOME} export --verbose
+	done local | test echo test local awk export 'quoted text' 2>/dev/null printf
+printf printf printf echo 2>/dev/null
+	&& /usr/bin "$1" "$@" /usr/bin
+	/usr/bin readonly 'quoted text'
+		cd | && export && export ${HOME} "$1" ${HOME} "$1"
+		-eu local echo printf done
+readonly then cd then awk --verbose cd x=1 awk done printf
+		done export sed echo --verbose export cd awk awk printf sed awk export local cd
+		echo sed grep | printf
+--verbose "$@" readonly "$@" printf readonly && "$@" | done "$@" export "$@" "$@"
+test awk grep "$1" 2>/dev/null awk --verbose
+	"$@" cd -eu cd local --verbose
+	readonly printf cd 'quoted text' test grep awk then grep awk /usr/bin
+	then && 2>/dev/null | local cd readonly $(pwd) /usr/bin export printf x=1 printf
+	--verbose printf ${HOME} sed /usr/bin -eu "$1" export awk local
+	${HOME} "$1" $(pwd) echo ${HOME}
+		then && 'quoted text' export sed $(pwd) $(pwd)
+	x=1 x=1 sed "$@" local $(pwd) test local ${HOME}
+--verbose $(pwd) cd $(pwd) /usr/bin awk cd
+	local sed ${HOME} /usr/bin x=1 "$@"
+	done "$1" -eu done --verbose then grep test export
+	'quoted text' $(pwd) x=1
+	"$1" && "$@" then --verbose grep x=1 cd $(pwd)
+	grep --verbose /usr/bin done && grep export local grep then x=1 test --verbose
+		2>/dev/null printf sed "$@" local grep test 'quoted text'
+printf sed "$1" export ${HOME} readonly grep local printf done sed --verbose
+		echo -eu -eu && test 'quoted text' ${HOME} then
+		-eu export --verbose -eu readonly -eu -eu && then -eu grep readonly
+printf printf sed ${HOME} grep 2>/dev/null 2>/dev/null
+export printf test sed 2>/dev/null $(pwd) echo cd sed /usr/bin printf export
+readonly | && /usr/bin "$1" ${HOME} done ${HOME} awk export && x=1 "$1"
+	sed 'quoted text' /usr/bin /usr/bin
+-eu export cd done test
+done -eu ${HOME} -eu "$@" cd 'quoted text'
+export grep export -eu ${HOME} grep printf $(pwd) awk test "$1" -eu
+		done grep done echo sed 'quoted text'
+		local done grep /usr/bin sed && 2>/dev/null
+${HOME} "$1" printf done readonly
+echo export $(pwd) --verbose
+	"$@" then /usr/bin awk export /usr/bin
+then grep readonly export "$1" then 2>/dev/null awk ${HOME} ${HOME} then cd
+"$@" "$1" 2>/dev/null then && awk && printf local "$@" "$@"
+	awk 'quoted text' | test 'quoted text' "$1" && 'quoted text' cd echo $(pwd)
+		grep ${HOME} printf "$@"
+-eu then awk 'quoted text' 'quoted text' awk 'quoted text'
+	$(pwd) 'quoted text' sed &&
+	sed done ${HOME} printf sed export $(pwd) awk /usr/bin
+	'quoted text' $(pwd) sed "$@" done ${HOME} printf $(pwd) grep sed
+	readonly cd printf 2>/dev/null "$1" --verbose readonly
+		${HOME} grep local echo x=1 awk "$1" 'quoted text'
+		--verbose printf then awk sed /usr/bin
+	echo "$@" ${HOME} -eu -eu $(pwd) printf
+		done awk readonly ${HOME}
+/usr/bin 'quoted text' -eu
+		printf then done awk && 2>/dev/null x=1 then "$1" test printf | echo
+		'quoted text' /usr/bin sed | /usr/bin
+/usr/bin then sed | cd /usr/bin cd --verbose "$1" --verbose local
+		"$1" "$@" test then local x=1 sed --verbose
+export done "$1" echo then done /usr/bin "$@" cd && x=1 -eu
+'quoted text' ${HOME} local export awk x=1 echo | readonly readonly readonly 'quoted text'
+	then 2>/dev/null 2>/dev/null 2>/dev/null && done && && echo "$1" 2>/dev/null
+	cd | cd "$1" 'quoted text' --verbose "$1" export /usr/bin
+	| test grep /usr/bin export ${HOME} "$@" readonly local done 2>/dev/null
+		then $(pwd) echo && x=1 "$@" echo x=1 export sed "$@"
+--verbose && $(pwd) x=1 printf local -eu
+	grep "$@" cd --verbose 'quoted text' && "$@"
+		sed echo then --verbose
+		&& printf 'quoted text' readonly --verbose "$@"
+		-eu printf printf /usr/bin then export
+		--verbose readonly local -eu $(pwd) 'quoted text' printf sed cd printf test local
+	--verbose "$1" grep x=1 echo ${HOME} grep x=1
+'quoted text' "$1" "$@" echo cd $(pwd)
+	/usr/bin -eu sed then x=1 "$@" | --verbose
+	'quoted text' awk cd echo | -eu export readonly
+	| printf "$1" grep local -eu "$@" local | -eu 'quoted text'
+	then awk 2>/dev/null -eu "$1" export --verbose
+		test "$1" local -eu awk -eu x=1 ${HOME} readonly |
+grep ${HOME} | local sed $(pwd) sed 'quoted text' $(pwd)
+		readonly echo then echo ${HOME} "$@"
+done ${HOME} /usr/bin grep x=1 $(pwd) readonly
+awk $(pwd) --verbose printf "$1" test readonly export sed
+		cd readonly grep x=1 then "$@" test
+		cd then grep --verbose 'quoted text' readonly printf test 'quoted text'
+printf -eu readonly sed --verbose done
+		cd ${HOME} cd /usr/bin local ${HOME} 2>/dev/null done 2>/dev/null x=1
+		2>/dev/null test $(pwd) 2>/dev/null --verbose -eu "$@" grep readonly
+		then 'quoted text' "$1" x=1 /usr/bin export printf -eu then
+		-eu "$1" then /usr/bin
+		--verbose x=1 --verbose
+		then grep --verbose then export | echo awk 'quoted text'
+test "$@" -eu local | then
+done echo done -eu --verbose "$@" test
+		/usr/bin | -eu readonly printf echo
+	-eu export cd export cd then --verbose 2>/dev/null grep grep "$@"
+x=1 | then then ${HOME} x=1 /usr/bin test done local ${HOME}
+	-eu done awk grep | "$@" /usr/bin local
+grep export then "$1" 'quoted text'
+	cd cd 'quoted text' printf sed awk $(pwd) printf then --verbose
+		local sed echo "$1" awk
+		| 'quoted text' export local
+		grep /usr/bin "$@" 'quoted text' done x=1 awk local "$@" --verbose
+	"$@" ${HOME} "$1" local "$@" export
+	x=1 && grep awk "$1" 'quoted text'
+		/usr/bin /usr/bin /usr/bin "$@" ${HOME}
+awk && | done "$1" then echo | --verbose "$1" ${HOME} $(pwd) sed "$@" readonly
+'quoted text' export "$@" "$1" printf echo printf --verbose $(pwd)
+		then x=1 'quoted text' $(pwd) awk then then "$1" /usr/bin
+		&& "$@" export sed readonly && then x=1 cd readonly 2>/dev/null export
+	cd then 2>/dev/null "$@" && "$1"
+		/usr/bin "$1" test sed
+		sed 'quoted text' 2>/dev/null printf grep
+	"$1" 'quoted text' done grep $(pwd)
+	grep x=1 awk ${HOME}
+		echo && /usr/bin cd x=1 --verbose $(pwd) then "$@" awk "$@" x=1 x=1 grep ${HOME}
+${HOME} --verbose "$1" x=1 awk echo && x=1
+		local echo $(pwd) $(pwd) ${HOME} "$1" local
+awk "$@" "$@" cd test --verbose --verbose grep local | done cd /usr/bin
+"$1" x=1 test x=1 test
+	cd readonly then x=1 sed readonly grep
+		export 2>/dev/null local --verbose test --verbose && --verbose local test
+export sed x=1 "$1" 2>/dev/null done grep echo readonly
+	sed echo readonly then cd cd "$1" | /usr/bin
+test $(pwd) 2>/dev/null /usr/bin
+$(pwd) grep $(pwd) readonly && --verbose local
+		cd x=1 export -eu --verbose "$1" printf readonly "$1" 2>/dev/null echo && ${HOME}
+	"$1" --verbose ${HOME} done sed x=1 cd --verbose awk "$@" "$@"
+$(pwd) -eu printf | cd $(pwd) "$@" --verbose sed cd local export
+		${HOME} ${HOME} x=1 test && then awk done |
+2>/dev/null cd echo done ${HOME} done sed grep grep x=1
+grep x=1 ${HOME} cd then sed local 2>/dev/null && $(pwd) | test "$@" echo
+		'quoted text' awk "$@" awk cd -eu | 'quoted text' then export
+	--verbose "$1" /usr/bin | echo "$@" "$1" --verbose && "$@" --verbose
+		x=1 $(pwd) export printf cd awk -eu local "$1" "$1" x=1
+		/usr/bin grep && "$1" ${HOME} | sed x=1 "$@" --verbose done 2>/dev/null x=1 --verbose
+		sed readonly then printf ${HOME}
+done | "$1" sed 2>/dev/null awk readonly export --verbose | x=1 'quoted text' 2>/dev/null
+		&& grep grep /usr/bin x=1 'quoted text' export && printf ${HOME} then cd
+/usr/bin printf cd test printf local cd 'quoted text' ${HOME} x=1 export $(pwd)
+| grep then && grep cd | readonly cd then then grep then ${HOME} printf
+		sed echo echo test export printf /usr/bin
+	sed | /usr/bin /usr/bin readonly "$1" test
+"$@" "$@" local && $(pwd) "$@" $(pwd) test "$1" /usr/bin
+${HOME} "$1" /usr/bin local ${HOME} awk done x=1 && --verbose "$1" test
+	"$1" done local $(pwd) "$@" grep awk
+	sed "$@" -eu done cd awk export && test done printf && test && awk echo grep |
+	"$@" "$1" done x=1 "$@" 2>/dev/null
+"$@" --verbose grep grep printf --verbose
+$(pwd) sed $(pwd) sed | &&
+&& then 2>/dev/null x=1 done readonly export printf
+cd cd done export then echo cd ${HOME} | ${HOME} -eu &&
+		sed test && -eu --verbose grep export x=1
+		2>/dev/null test printf sed --verbose
+	local ${HOME} local $(pwd) --verbose x=1 'quoted text' echo $(pwd) printf
+		test x=1 test --verbose && sed "$1" sed "$@" x=1 "$1" "$@" echo ${HOME} test done
+	local && test grep grep grep
+readonly | x=1 echo grep x=1 --verbose -eu done cd
+cd x=1 /usr/bin /usr/bin /usr/bin awk readonly done
+	'quoted text' sed 2>/dev/null grep /usr/bin | awk ${HOME}
+	printf test sed echo 'quoted text'
+	sed && "$@" | printf -eu 2>/dev/null x=1 /usr/bin local local local /usr/bin
+		grep sed then ${HOME} --verbose then grep /usr/bin /usr/bin awk test
+		local 2>/dev/null done printf
+	"$1" -eu echo "$1" sed "$@"
+awk test sed "$1" -eu export awk -eu printf then
+| "$@" 2>/dev/null local awk -eu cd /usr/bin /usr/bin cd
+'quoted text' | /usr/bin printf test /usr/bin | echo
+export local && && "$1" -eu x=1 printf $(pwd) then --verbose
+sed then && then sed then $(pwd) test export --verbose 2>/dev/null readonly
+		awk "$@" 'quoted text'
+grep echo test -eu x=1 /usr/bin && done awk /usr/bin then /usr/bin readonly /usr/bin
+		readonly printf done echo && export done 'quoted text'
+	-eu $(pwd) "$1" cd /usr/bin /usr/bin readonly 'quoted text' 'quoted text'
+		local export test --verbose
+	"$@" export 2>/dev/null
+		printf 'quoted text' | grep | /usr/bin
+--verbose 'quoted text' test | "$1" "$@" "$1" export /usr/bin cd && local
+		awk $(pwd) sed test test readonly -eu
+'quoted text' && $(pwd) cd awk && export $(pwd) "$@"
+| done readonly cd then test sed grep local done
+$(pwd) grep && $(pwd) -eu done
+	"$1" --verbose "$@" test readonly /usr/bin grep 'quoted text' echo
+test 2>/dev/null printf /usr/bin
+awk local awk done local
+	--verbose test echo sed -eu 2>/dev/null ${HOME} echo grep $(pwd)
+	then local local /usr/bin 2>/dev/null export then readonly
+/usr/bin export ${HOME} x=1 then /usr/bin
+	local /usr/bin "$@" $(pwd) 'quoted text'
+	| readonly ${HOME} printf
+2>/dev/null readonly test $(pwd) | "$@"
+		export --verbose 2>/dev/null grep test x=1 sed /usr/bin 'quoted text'
+	then printf --verbose done $(pwd) --verbose "$@" cd | grep echo $(pwd) cd
+| $(pwd) "$1" "$@" 2>/dev/null && echo then x=1 printf
+	| local then && ${HOME} | x=1 $(pwd) /usr/bin echo && grep cd $(pwd)
+	$(pwd) then export local 'quoted text' $(pwd) cd && x=1 ${HOME} done printf
+grep grep ${HOME} then done grep sed local /usr/bin
+	&& sed sed cd | "$1" local then grep 'quoted text' 'quoted text'
+local test ${HOME} "$1" test x=1 "$@" /usr/bin
+	done awk awk test sed awk 2>/dev/null test
+test sed /usr/bin x=1 "$1" /usr/bin printf
+export -eu | readonly /usr/bin
+echo readonly local sed export readonly && $(pwd) then
+printf x=1 test "$1"
+		done then cd $(pwd) readonly test "$@" -eu --verbose printf readonly ${HOME}
+		grep sed cd printf export --verbose awk "$@" then -eu ${HOME}
+		export cd cd test --verbose $(pwd) --verbose
+	2>/dev/null grep export $(pwd) test test done readonly cd sed
+${HOME} $(pwd) | "$1" done done 2>/dev/null
+		sed && && "$1" test 2>/dev/null printf -eu then "$1"
+	export local /usr/bin export sed ${HOME} readonly x=1 "$1" cd
+		readonly --verbose cd awk sed sed 2>/dev/null 'quoted text' -eu $(pwd)
+		'quoted text' && readonly x=1 2>/dev/null x=1 readonly awk --verbose then
+		/usr/bin | export export cd printf done 2>/dev/null ${HOME} "$1" printf then
+		cd /usr/bin export /usr/bin | ${HOME}
+	test echo grep $(pwd) then export ${HOME} readonly | test sed then
+sed sed --verbose --verbose
+2>/dev/null | "$1" 'quoted text'
+	"$1" readonly local cd local 'quoted text' cd && "$@" cd --verbose readonly awk
+		"$@" then readonly "$@" echo
+	test sed 'quoted text' 'quoted text'
+	cd local export x=1 ${HOME} 2>/dev/null then then 'quoted text'
+	-eu "$1" && --verbose "$@" echo cd && then local /usr/bin "$1" 2>/dev/null --verbose
+		then local readonly -eu sed grep && ${HOME} then
+'quoted text' x=1 'quoted text' awk x=1
+	"$1" /usr/bin -eu then "$1" echo 2>/dev/null grep printf
+x=1 -eu awk printf 'quoted text'
+&& /usr/bin "$@" && x=1 'quoted text'
+		"$1" | | awk | echo export printf
+		grep x=1 printf ${HOME} cd export printf --verbose $(pwd) /usr/bin 'quoted text'
+		done local readonly cd sed awk echo done /usr/bin $(pwd)
+	2>/dev/null local -eu /usr/bin
+		'quoted text' done done $(pwd) 'quoted text' ${HOME} readonly
+	x=1 2>/dev/null export
+	'quoted text' printf 2>/dev/null 2>/dev/null $(pwd) then | export x=1
+2>/dev/null 'quoted text' $(pwd)
+	printf 2>/dev/null /usr/bin grep printf grep then
+		sed export "$1" export "$@" /usr/bin $(pwd) ${HOME}
+		'quoted text' export export --verbose readonly && local done test | awk
+	"$@" grep readonly sed "$1" done grep x=1 2>/dev/null
+		x=1 printf awk x=1 | local then 2>/dev/null $(pwd) cd 2>/dev/null readonly
+&& $(pwd) 'quoted text' grep readonly x=1 readonly local /usr/bin
+'quoted text' $(pwd) printf x=1 -eu && --verbose /usr/bin 2>/dev/null "$@" cd
+		2>/dev/null cd "$@" "$@" awk --verbose ${HOME}
+		cd && local 2>/dev/null 2>/dev/null
+cd && export printf 2>/dev/null awk awk printf "$1" ${HOME} -eu readonly awk
+		sed | 'quoted text' done && /usr/bin done export then
+	local ${HOME} --verbose then $(pwd) "$1" "$@"
+		printf sed grep && --verbose test | --verbose "$@" 2>/dev/null && awk
+echo done $(pwd) "$1" ${HOME} 2>/dev/null echo
+/usr/bin && 2>/dev/null -eu export -eu && "$1" 2>/dev/null cd printf
+	echo "$1" /usr/bin then $(pwd)
+| 2>/dev/null x=1 x=1 && 'quoted text' grep test "$@" $(pwd) then readonly -eu
+	&& grep local then && sed readonly printf && local then cd export
+	| local awk -eu then grep grep -eu /usr/bin printf sed local
+	"$@" printf printf 'quoted text'
+		export 'quoted text' done $(pwd) && export echo 'quoted text' export
+	echo x=1 $(pwd) cd echo echo cd "$@" x=1 test readonly sed done
+	--verbose done awk --verbose cd sed
+		| cd ${HOME} "$1" "$1" printf test ${HOME} readonly readonly local | done x=1 ${HOME}
+echo awk printf $(pwd) test then ${HOME} -eu -eu grep local
+| "$@" ${HOME} export sed readonly x=1 --verbose 'quoted text' -eu "$@"
+		awk -eu grep "$1" $(pwd) awk done "$@" "$@" test && | /usr/bin
+	printf 'quoted text' cd test grep 2>/dev/null
+		done local | "$1" local
+export $(pwd) "$@" 2>/dev/null printf awk done
+echo readonly export x=1 'quoted text' /usr/bin -eu --verbose
+		--verbose $(pwd) 'quoted text' awk x=1 local "$1" sed then ${HOME}
+sed 2>/dev/null x=1 awk
+	then echo test -eu -eu
+		2>/dev/null "$@" x=1 readonly | cd 'quoted text' awk local
+		cd 2>/dev/null --verbose export 2>/dev/null printf readonly cd /usr/bin 2>/dev/null
+	printf cd sed x=1 $(pwd) done /usr/bin test cd "$1"
+test && 2>/dev/null sed readonly "$@" grep ${HOME} readonly readonly sed
+"$@" cd sed 2>/dev/null cd then sed
+	-eu export test awk printf -eu readonly readonly && cd $(pwd) awk
+		readonly echo export printf /usr/bin | echo 2>/dev/null /usr/bin "$@" sed -eu
+	export done printf grep /usr/bin /usr/bin then printf
+	export ${HOME} | test --verbose x=1 local -eu --verbose
+--verbose $(pwd) && -eu then test /usr/bin | && 2>/dev/null
+	cd sed --verbose 'quoted text' test "$1" export ${HOME}
+then -eu $(pwd) "$1" "$1" ${HOME} | --verbose done
+	$(pwd) echo 2>/dev/null then done $(pwd)
+'quoted text' grep ${HOME}
+2>/dev/null 2>/dev/null done 'quoted text' cd awk sed --verbose $(pwd) awk ${HOME}
+awk local export x=1 readonly export "$@" $(pwd) x=1 2>/dev/null
+&& --verbose "$@" awk /usr/bin export export "$@"
+	then 2>/dev/null /usr/bin "$@" awk ${HOME}
+	--verbose /usr/bin cd test | export printf printf
+"$@" grep && "$1" sed
+		export cd then | export readonly printf
+'quoted text' test --verbose x=1 -eu -eu awk "$@" grep done "$1"
+	--verbose cd && ${HOME} -eu then -eu --verbose then --verbose printf | then
+	echo --verbose local test x=1 sed /usr/bin && 2>/dev/null
+		'quoted text' -eu /usr/bin
+		awk grep cd cd --verbose printf
+		2>/dev/null | 2>/dev/null | | --verbose then done awk sed "$1" -eu ${HOME} ${HOME}
+		done x=1 export -eu 'quoted text' echo sed grep "$1" sed
+		export readonly cd test export readonly echo awk
+		readonly echo -eu "$1" ${HOME} "$1" ${HOME}
+		test "$@" test "$@" sed then printf --verbose echo done
+-eu ${HOME} printf x=1 sed ${HOME} /usr/bin && 2>/dev/null readonly export | readonly
+		${HOME} --verbose local "$@" test
+local readonly "$1" | "$@" test test awk readonly "$1" x=1
+	--verbose && test cd x=1 ${HOME} | local "$@" printf awk done echo
+		grep "$1" --verbose /usr/bin "$@" $(pwd) && test export 2>/dev/null
+	test sed --verbose local
+		local sed x=1 -eu "$@" "$1" | echo done grep test 'quoted text'
+		done && readonly printf printf done local && && /usr/bin "$@" then readonly test
+cd local done printf export sed then ${HOME} printf sed echo
+| done --verbose "$@" echo export /usr/bin 2>/dev/null
+	/usr/bin printf --verbose ${HOME} readonly export local "$@" ${HOME} | then
+	| echo echo ${HOME} awk echo | ${HOME} --verbose grep ${HOME} ${HOME} /usr/bin
+	&& awk "$@" readonly x=1 &&
+	${HOME} /usr/bin x=1 test 'quoted text' echo /usr/bin /usr/bin printf echo
+		export ${HOME} readonly "$1" /usr/bin
+	cd --verbose test 2>/dev/null | ${HOME} --verbose
+		readonly | --verbose
+		local grep grep local 2>/dev/null 'quoted text' done 2>/dev/null
+	--verbose readonly x=1 export
+		sed "$1" then readonly ${HOME}
+		-eu awk "$@" sed done $(pwd) | 'quoted text'
+		&& $(pwd) export 2>/dev/null
+local awk sed /usr/bin | done export test "$1" -eu /usr/bin printf
+	/usr/bin /usr/bin -eu local
+awk test "$@" then awk x=1 grep echo "$@" printf && ${HOME} export awk /usr/bin
+"$@" $(pwd) $(pwd) test printf printf done "$@" sed printf -eu
+	/usr/bin && "$@" local cd grep sed && -eu /usr/bin
+	printf | 'quoted text' done export && readonly
+	${HOME} ${HOME} printf test 2>/dev/null
+done readonly printf export readonly "$1" /usr/bin
+	--verbose test /usr/bin
+		x=1 --verbose grep /usr/bin 2>/dev/null
+		"$1" awk printf x=1 "$@" echo "$1" test x=1 test
+	x=1 && awk $(pwd) && ${HOME} $(pwd) done /usr/bin
+	awk cd echo 'quoted text'
+		echo echo "$1" x=1 /usr/bin printf 2>/dev/null
+		cd 2>/dev/null readonly readonly 'quoted text' "$1"
+	grep 2>/dev/null then --verbose --verbose x=1 test printf
+		x=1 then | local | $(pwd) then local
+		2>/dev/null /usr/bin sed test 2>/dev/null | export --verbose sed echo
+		echo -eu done $(pwd) --verbose 2>/dev/null local "$@"
+	local $(pwd) "$@" then awk grep
+"$@" 2>/dev/null x=1
+done --verbose then $(pwd) grep && echo 2>/dev/null "$1"
+		'quoted text' "$1" done "$1" "$1" readonly
+		${HOME} $(pwd) "$@" "$@" x=1 $(pwd) done -eu
+	echo cd done ${HOME} /usr/bin test then x=1 export "$1" done
+"$@" /usr/bin /usr/bin awk && 'quoted text' && printf "$1"
+	--verbose grep test /usr/bin /usr/bin
+/usr/bin export && && done
+		&& done --verbose 'quoted text' cd printf
+		x=1 printf 'quoted text' /usr/bin | ${HOME} | done "$1" done then "$@" done &&
+		/usr/bin -eu 2>/dev/null | x=1 "$@" && echo
+		test $(pwd) echo awk x=1 then $(pwd) printf sed printf sed -eu local printf readonly
+		awk /usr/bin awk printf --verbose
+| grep "$@" then test cd 2>/dev/null awk
+		| readonly local "$@" | --verbose --verbose sed
+		echo awk cd -eu printf /usr/bin "$@" done
+	echo local local printf cd "$@" 'quoted text' --verbose --verbose
+	done done "$1" /usr/bin export echo && $(pwd) --verbose
+	${HOME} echo 2>/dev/null awk "$1" && && | ${HOME} && /usr/bin grep
+	&& grep awk echo grep local /usr/bin
+		then printf cd done "$@" x=1 -eu cd then $(pwd) --verbose /usr/bin echo
+| then echo printf -eu /usr/bin
+	&& cd test then export | local && printf then ${HOME}
+	echo | then printf "$@" $(pwd) /usr/bin
+	awk --verbose && 2>/dev/null /usr/bin then $(pwd) echo | printf grep $(pwd)
+	local ${HOME} -eu "$1" 2>/dev/null local 'quoted text' sed sed --verbose test x=1
+| grep "$@" /usr/bin sed 'quoted text'
+	test local echo $(pwd) /usr/bin
+		'quoted text' awk then awk cd ${HOME} x=1
+/usr/bin | grep then x=1 test export "$1"
+		${HOME} echo x=1 'quoted text' local done ${HOME} readonly "$@" local
+awk | "$1" && 2>/dev/null export
+then "$@" ${HOME} 'quoted text' printf then test -eu sed sed $(pwd)
+	printf | then done printf grep echo awk 'quoted text'
+done cd "$1" echo export && ${HOME} done echo && $(pwd) 'quoted text' readonly
+${HOME} 'quoted text' "$@" sed readonly printf "$1" awk
+		export "$@" | printf 2>/dev/null grep awk
+&& grep "$1" 'quoted text' local awk 'quoted text' readonly
+done sed $(pwd) readonly ${HOME} 2>/dev/null 'quoted text'
+		then && echo 2>/dev/null printf --verbose --verbose echo -eu 2>/dev/null
+awk "$1" 'quoted text' export 'quoted text'
+	&& sed "$@" echo "$@" 'quoted text'
+	/usr/bin awk -eu && done echo 2>/dev/null "$1"
+		grep cd --verbose && export | /usr/bin grep --verbose done
+		cd -eu | $(pwd) sed readonly export --verbose 'quoted text' sed && echo | then
+&& && done echo --verbose x=1 'quoted text' "$@" awk 'quoted text'
+		$(pwd) --verbose /usr/bin -eu export $(pwd) "$@" 'quoted text' test x=1 then
+		${HOME} 'quoted text' | x=1 "$@" $(pwd)
+"$@" cd then "$@" /usr/bin test "$@" export readonly -eu "$@" awk 'quoted text'
+		export 2>/dev/null 'quoted text' done cd $(pwd) "$@" ${HOME} readonly sed
+#include c224.sh
+		awk 2>/dev/null 2>/dev/null --verbose echo cd -eu cd grep readonly $(pwd) 'quoted text'
+"$@" printf then $(pwd) ${HOME} --verbose local "$@" readonly
+2>/dev/null printf test && cd echo then /usr/bin "$1" "$1"
+		${HOME} local $(pwd) done then --verbose | then sed
+"$@" $(pwd) export readonly | readonly readonly
+		$(pwd) grep readonly --verbose readonly then then x=1 local sed $(pwd)
+		done "$1" export | /usr/bin echo awk 'quoted text' sed
+		then --verbose --verbose ${HOME} sed grep printf cd echo "$@" readonly local
+	sed x=1 then printf export
+$(pwd) test awk --verbose echo "$@"
+test done readonly x=1 grep x=1 export ${HOME} $(pwd) then x=1 then --verbose
+		local "$1" "$@" done && "$@" then grep
+	$(pwd) local done /usr/bin done readonly cd --verbose sed grep readonly
+sed grep 'quoted text' readonly test sed export export
+echo ${HOME} printf $(pwd) printf sed "$@"
+		cd $(pwd) grep x=1 /usr/bin test $(pwd) grep cd && ${HOME}
+	x=1 /usr/bin "$@" -eu readonly cd awk 2>/dev/null done test
+		--verbose /usr/bin 2>/dev/null "$1"
+	"$@" cd awk && x=1 --verbose
+	echo x=1 --verbose test test done "$1" awk /usr/bin 'quoted text'
+		echo 2>/dev/null awk "$1" cd "$@"
+test printf "$@" then echo printf then $(pwd)
+'quoted text' && local grep grep /usr/bin --verbose awk $(pwd) /usr/bin ${HOME}
+${HOME} ${HOME} ${HOME} done "$@" "$1"
+		then x=1 awk --verbose sed awk && "$@" -eu "$1" x=1 | --verbose /usr/bin
+		done -eu echo -eu x=1 cd echo 'quoted text'
+&& grep --verbose echo ${HOME} echo "$@" local 'quoted text' $(pwd) echo
+	test echo sed x=1 $(pwd) 'quoted text' "$1" --verbose
+		printf export 2>/dev/null && $(pwd) then grep | 'quoted text' && ${HOME}
+	awk printf x=1 'quoted text' /usr/bin then readonly | export --verbose echo test
+		printf local export echo 'quoted text' done test awk /usr/bin x=1 grep 2>/dev/null
+		echo test sed cd && export "$1" printf /usr/bin "$1" sed | x=1 then then readonly
+		then printf printf test --verbose cd 2>/dev/null
+cd done echo done /usr/bin 2>/dev/null
+	'quoted text' local readonly "$@" then ${HOME} echo test "$1" && "$1" x=1 printf
+	2>/dev/null then cd readonly 'quoted text' x=1 awk
+		&& readonly readonly local "$@" "$@" $(pwd) /usr/bin test grep -eu
+grep export printf 'quoted text' --verbose x=1 $(pwd) "$@" printf
+	test --verbose printf local ${HOME} -eu
+$(pwd) export printf | readonly "$@" then echo export x=1 printf readonly
+&& "$1" awk && && local $(pwd) -eu
+		/usr/bin x=1 && ${HOME} -eu && local local $(pwd) 2>/dev/null "$@"
+awk awk 'quoted text' "$@" 'quoted text'
+	/usr/bin printf cd echo local "$@" done "$1" echo -eu 'quoted text' sed
+then grep local echo && | $(pwd) then --verbose | /usr/bin
+	done && --verbose $(pwd) done "$@" awk printf awk then | ${HOME} echo ${HOME}
+	grep grep "$@" ${HOME} grep printf && x=1 grep
+echo /usr/bin sed $(pwd) /usr/bin "$@" 'quoted text'
+		export "$@" echo x=1 awk test sed test $(pwd) local cd grep local $(pwd) "$@"
+sed "$1" --verbose /usr/bin ${HOME} grep cd test grep then awk
+		| done echo cd ${HOME} readonly printf 2>/dev/null done "$@" grep
+| grep test echo --verbose ${HOME} local "$@" | x=1 sed echo ${HOME} && test
+then && readonly /usr/bin 2>/dev/null export grep readonly echo export cd /usr/bin
+		local export grep grep sed echo grep "$1"
+then && local $(pwd) readonly -eu | printf
+		done | 2>/dev/null export grep | --verbose awk
+then then "$1" $(pwd) grep "$@" && sed "$@"
+		test $(pwd) | sed local "$@" | cd export $(pwd) $(pwd) echo export done awk export
+		cd 2>/dev/null awk awk cd echo sed export printf 'quoted text' sed test
+	done $(pwd) export readonly local test export export | cd readonly
+cd test 2>/dev/null && -eu | awk -eu readonly | then awk
+--verbose 2>/dev/null "$@" test --verbose cd readonly "$1" ${HOME} $(pwd)
+	sed 2>/dev/null x=1 then "$@" /usr/bin done awk 'quoted text'
+	&& done then then printf
+		&& awk $(pwd) then | 'quoted text' --verbose local done
+		test | 'quoted text' && sed test export done cd 'quoted text'
+	test && readonly --verbose then "$@"
+		grep awk "$@" test test x=1 local && test awk echo then test 'quoted text'
+test --verbose done grep 2>/dev/null readonly 2>/dev/null x=1 "$@" "$@"
+		${HOME} grep 2>/dev/null /usr/bin "$1" then printf done
+		echo local test x=1 /usr/bin
+	'quoted text' 'quoted text'
+		-eu -eu echo -eu ${HOME} | $(pwd) /usr/bin "$1" x=1 2>/dev/null
+		done "$1" export 2>/dev/null grep 'quoted text' ${HOME} awk
+local cd local --verbose 2>/dev/null local grep export then | x=1 cd echo "$@"
+--verbose test | readonly awk export | /usr/bin readonly ${HOME}
+		| export done 'quoted text' cd $(pwd) -eu
+		cd local then $(pwd) local 2>/dev/null printf --verbose cd
+		awk cd $(pwd) printf then sed local ${HOME} x=1
+		"$@" x=1 ${HOME} --verbose --verbose "$@" --verbose sed
+	then readonly -eu /usr/bin ${HOME} grep readonly && sed grep sed then ${HOME}
+	/usr/bin sed | local ${HOME}
+| echo "$1" 'quoted text' ${HOME} "$@" sed grep then grep echo $(pwd)
+awk && "$@" /usr/bin "$@" awk && echo local then /usr/bin | done sed -eu done
+"$1" | printf "$@" /usr/bin "$@"
+2>/dev/null sed "$1" --verbose echo grep grep cd 2>/dev/null ${HOME}
+	sed sed "$1" 2>/dev/null
+"$@" sed $(pwd) grep grep
+		"$@" | /usr/bin test then -eu && grep "$1" "$1" "$@" "$@" 2>/dev/null readonly
+then 'quoted text' $(pwd) ${HOME} -eu "$@" printf grep grep
+		local sed cd sed export x=1 | $(pwd)
+$(pwd) grep 'quoted text' cd then --verbose "$@" /usr/bin then
+		&& ${HOME} echo printf $(pwd) $(pwd) ${HOME} grep "$@"
+	then sed && $(pwd) "$1" done
+	printf cd -eu cd 2>/dev/null && done --verbose
+	awk export ${HOME} done printf | --verbose x=1 ${HOME} --verbose sed readonly
+		"$1" $(pwd) printf export cd ${HOME} grep echo $(pwd) local echo
+"$1" -eu awk 2>/dev/null export --verbose export | | | "$@" readonly echo
+	$(pwd) x=1 local $(pwd) readonly
+&& -eu test local local done awk awk 'quoted text'
+done $(pwd) test awk /usr/bin | done 'quoted text' echo printf local
+"$1" $(pwd) 2>/dev/null && done ${HOME} sed export && export /usr/bin local
+	printf "$1" sed --verbose 2>/dev/null --verbose
+	test export cd /usr/bin
+awk then $(pwd) grep export cd sed printf 'quoted text' --verbose
+	done printf test | x=1 sed "$1" test -eu
+	local $(pwd) awk done awk then export sed cd printf then 'quoted text' $(pwd)
+echo /usr/bin | 'quoted text' x=1 cd 'quoted text' test /usr/bin
+		echo sed $(pwd) done ${HOME}
+$(pwd) echo -eu printf awk test awk 'quoted text' /usr/bin
+	awk cd local then /usr/bin ${HOME} readonly
+	readonly then printf x=1 --verbose export cd /usr/bin readonly cd
+	sed export then -eu && done sed done test export 2>/dev/null printf
+readonly "$1" then $(pwd) then --verbose 'quoted text' done --verbose printf
+		"$@" cd export done "$1" cd done readonly test /usr/bin -eu --verbose grep
+		/usr/bin printf test "$@" /usr/bin && done echo
+-eu awk grep -eu $(pwd) awk && | done "$1" test awk x=1 "$1"
+		then readonly then /usr/bin awk 'quoted text' grep
+		"$1" export done printf 2>/dev/null
+	--verbose | "$@" /usr/bin grep echo
+&& then --verbose then "$1" | x=1 ${HOME} cd
+	awk then /usr/bin cd && ${HOME} ${HOME} x=1 grep then | --verbose test test x=1
+export "$@" done -eu x=1
+	cd | /usr/bin 2>/dev/null 'quoted text' "$@" | printf &&
+	/usr/bin readonly "$1" x=1 --verbose && $(pwd)
+awk 2>/dev/null && then | readonly | x=1 'quoted text' ${HOME} sed 2>/dev/null
+		printf ${HOME} awk --verbose $(pwd) local echo $(pwd)
+		&& 2>/dev/null test | cd
+	x=1 | local cd 2>/dev/null done x=1
+	grep && printf export local cd grep "$1" --verbose
+	x=1 readonly sed cd printf "$1" && && $(pwd) x=1 && -eu cd local x=1 awk readonly
+		--verbose ${HOME} then echo ${HOME} cd $(pwd) echo
+	"$1" x=1 printf | $(pwd) --verbose
+	&& test -eu "$1" sed &&
+	export /usr/bin ${HOME} printf ${HOME} export x=1 printf ${HOME} cd -eu sed 'quoted text'
+	"$@" readonly export export test $(pwd) readonly && cd x=1 "$1"
+		"$@" | -eu 2>/dev/null sed "$@" | local
+		&& done 'quoted text' $(pwd)
+		"$1" readonly | -eu | 'quoted text' then grep printf 'quoted text'
+	printf 2>/dev/null ${HOME} local grep /usr/bin grep then 'quoted text'
+		done ${HOME} sed awk test && sed grep done grep 2>/dev/null echo
+		cd awk test awk x=1 "$1" | echo sed -eu "$1" ${HOME} "$1"
+		awk grep awk 2>/dev/null test 'quoted text' ${HOME} cd then
+		done cd cd "$@" cd 'quoted text' --verbose
+	$(pwd) then test local sed printf cd "$1" export echo test grep then readonly 2>/dev/null
+		x=1 echo x=1 awk sed test $(pwd) /usr/bin $(pwd) | 2>/dev/null sed grep
+	done cd awk echo export | export
+		'quoted text' then ${HOME} awk
+	printf 'quoted text' "$@"
+"$1" $(pwd) x=1 export printf "$@"
+		export ${HOME} sed done $(pwd) "$@" echo 'quoted text'
+		awk 'quoted text' x=1 cd -eu ${HOME} readonly "$1" ${HOME} readonly
+	export --verbose done "$1"
+		"$@" grep x=1 && grep test printf export x=1 ${HOME} "$1" x=1 -eu then export
+done printf /usr/bin ${HOME} | 2>/dev/null awk
+	local grep /usr/bin /usr/bin sed echo 'quoted text'
+${HOME} --verbose | ${HOME}
+	"$1" local x=1 -eu readonly
+		export echo readonly --verbose
+${HOME} echo 2>/dev/null $(pwd) done
+		2>/dev/null && printf echo "$@"
+		grep grep /usr/bin sed 2>/dev/null -eu $(pwd)
+		2>/dev/null 'quoted text' /usr/bin
+awk echo /usr/bin "$@" awk cd
+	x=1 sed cd "$1" --verbose 'quoted text' ${HOME} x=1 --verbose 2>/dev/null -eu
+&& echo test $(pwd) -eu sed --verbose awk x=1 2>/dev/null echo $(pwd) export 'quoted text'
+	$(pwd) ${HOME} /usr/bin
+		sed -eu grep ${HOME} awk $(pwd) readonly 'quoted text' awk export local && &&
+		test 2>/dev/null awk echo /usr/bin
+	2>/dev/null --verbose x=1 | x=1 "$1" cd
+	2>/dev/null ${HOME} test ${HOME} $(pwd) then |
+	x=1 /usr/bin | cd "$@" readonly local readonly /usr/bin "$@" grep
+	/usr/bin x=1 done then 'quoted text' | test
+	"$@" 'quoted text' cd $(pwd)
+${HOME} ${HOME} grep 2>/dev/null 'quoted text' local
+	"$1" && -eu /usr/bin awk awk echo -eu 2>/dev/null && x=1 /usr/bin /usr/bin sed
+	"$@" /usr/bin 2>/dev/null test "$@" -eu done $(pwd) "$@" cd echo $(pwd) readonly
+| --verbose --verbose 2>/dev/null --verbose
+&& grep --verbose export then sed "$1" && 'quoted text'
+| export "$1" test "$@" $(pwd) /usr/bin
+		/usr/bin "$@" test $(pwd) done "$1" local "$1" cd done /usr/bin /usr/bin then
+/usr/bin | | local awk then cd sed 'quoted text' | -eu export grep done readonly
+local echo -eu ${HOME} printf $(pwd) "$1" sed
+test $(pwd) $(pwd) local -eu
+		readonly 2>/dev/null sed -eu printf cd echo done test x=1
+2>/dev/null readonly "$@" then $(pwd) then then awk && then done 'quoted text'
+		grep --verbose ${HOME}
+/usr/bin done then $(pwd) "$@" $(pwd) cd
+		awk done $(pwd) /usr/bin && /usr/bin 2>/dev/null cd done export ${HOME}
+	'quoted text' export sed grep export |
+		awk 2>/dev/null export 2>/dev/null
+readonly cd "$@" 'quoted text' /usr/bin then export then
+"$1" sed echo export /usr/bin "$@" readonly
+	awk grep --verbose printf -eu | echo "$1" && export "$1" -eu && x=1 done
+"$1" /usr/bin readonly
+$(pwd) local -eu local ${HOME} echo "$1" -eu grep done printf 2>/dev/null
+		$(pwd) x=1 grep printf printf sed 2>/dev/null 2>/dev/null
+		echo && awk "$@" 2>/dev/null grep | "$1" cd echo && local $(pwd) |
+	echo local readonly $(pwd) 2>/dev/null echo done | | echo
+	export sed "$@" ${HOME} x=1 | "$1" | $(pwd) | local
+		x=1 test echo sed $(pwd) "$@"
+local local "$1" x=1 'quoted text' then printf
+		then test 'quoted text' 'quoted text'
+	--verbose 2>/dev/null /usr/bin readonly local 'quoted text' $(pwd) --verbose
+		x=1 cd $(pwd) export 2>/dev/null "$1" x=1 "$@" echo export
+		done "$1" printf -eu | test 2>/dev/null "$1" cd | 'quoted text'
+	x=1 "$1" local export cd $(pwd) grep awk done --verbose
+		test test printf -eu "$1" | 2>/dev/null test /usr/bin cd /usr/bin grep
+export local test x=1 printf 2>/dev/null local awk local 'quoted text'
+&& test $(pwd) local cd test local -eu local ${HOME}
+		grep | 'quoted text' 2>/dev/null readonly --verbose test echo grep done
+	--verbose /usr/bin sed
+	$(pwd) /usr/bin x=1 -eu 2>/dev/null local readonly --verbose awk export
+	${HOME} echo ${HOME} /usr/bin 2>/dev/null then then $(pwd)
+	cd x=1 echo | 'quoted text' done "$1" -eu
+		x=1 awk sed ${HOME} test
+echo /usr/bin sed 2>/dev/null grep | local sed
+	--verbose test "$1" $(pwd)
+		local local test /usr/bin local echo x=1 grep cd | 2>/dev/null 2>/dev/null
+		${HOME} test local then printf readonly -eu awk
+&& "$1" awk --verbose /usr/bin /usr/bin
+done --verbose 'quoted text'
+${HOME} test grep "$@" && 'quoted text'
+		x=1 ${HOME} done cd /usr/bin printf
+test 'quoted text' printf "$@" printf
+awk sed 2>/dev/null -eu local then test cd --verbose /usr/bin
+	readonly "$@" && cd grep /usr/bin then x=1 'quoted text' test 'quoted text'
+cd done --verbose x=1 | sed 2>/dev/null -eu -eu
+	printf sed sed 2>/dev/null readonly /usr/bin printf awk /usr/bin
+		printf ${HOME} then --verbose 2>/dev/null | sed printf $(pwd) && readonly awk
+2>/dev/null x=1 "$1" ${HOME}
+local | test && "$1" /usr/bin --verbose --verbose test x=1 test test 2>/dev/null
+grep printf echo export 2>/dev/null
+-eu -eu && echo "$@" printf done
+2>/dev/null readonly readonly awk awk then readonly "$@" then 'quoted text'
+		grep printf "$@" readonly ${HOME} sed local
+		&& ${HOME} then 2>/dev/null awk |
+		export test 'quoted text' && "$@" then | &&
+		done echo export $(pwd) readonly readonly
+readonly echo echo && &&
+export awk | cd 'quoted text' | -eu grep 'quoted text' $(pwd) export
+		| printf cd export then
+cd x=1 && then export
+		grep ${HOME} 'quoted text' test
+2>/dev/null cd test cd && echo && grep --verbose "$@" -eu 2>/dev/null test
+x=1 --verbose local echo cd ${HOME} | grep
+/usr/bin printf echo cd grep local export
+		--verbose local readonly -eu
+--verbose done | sed "$@" export
+grep echo $(pwd) done --verbose 2>/dev/null 'quoted text' 'quoted text' $(pwd) grep
+		/usr/bin --verbose --verbose | export "$@" x=1 --verbose export --verbose sed
+/usr/bin cd local readonly readonly cd /usr/bin grep test $(pwd)
+	"$1" $(pwd) local "$1" sed && grep $(pwd) $(pwd)
+	done done $(pwd) "$1" done awk awk x=1 test echo export
+		test 'quoted text' sed test test echo readonly cd cd local -eu && --verbose
+		local -eu test done 2>/dev/null && echo test done local
+	2>/dev/null echo grep $(pwd) --verbose cd cd
+		readonly && 2>/dev/null
+		printf cd then -eu 2>/dev/null /usr/bin "$@" $(pwd) $(pwd)
+		| ${HOME} && cd grep grep 2>/dev/null | "$1" test then && 2>/dev/null && cd cd
+		2>/dev/null -eu 'quoted text' x=1
+&& awk awk grep done awk ${HOME} awk then 'quoted text' done && && x=1 cd
+	local local ${HOME} done export done -eu test export ${HOME} 2>/dev/null
+sed readonly test && --verbose "$1" ${HOME} readonly "$@" readonly then
+/usr/bin export 'quoted text'
+		-eu awk --verbose /usr/bin sed sed local "$1" ${HOME} | 'quoted text'
+	| grep export -eu | | then cd then
+	x=1 test done && | -eu then awk readonly sed cd grep
+	${HOME} -eu "$1" export
+'quoted text' then grep "$@" "$1" 'quoted text'
+-eu export done then --verbose | export
+"$@" grep test 'quoted text' --verbose done && $(pwd) done -eu
+	then | "$1" awk local done done awk then --verbose
+	x=1 --verbose readonly then && printf done awk
+	export test 'quoted text' x=1 --verbose ${HOME} export echo echo ${HOME} echo
+		then "$1" then | printf
+'quoted text' "$1" cd sed && done cd done test --verbose 2>/dev/null echo
+	/usr/bin printf $(pwd)
+	$(pwd) $(pwd) -eu "$@" done "$@" -eu --verbose export x=1 -eu ${HOME} done
+	cd sed 'quoted text' printf sed
+		'quoted text' | grep $(pwd) "$@" awk "$@" ${HOME} export
+${HOME} grep test 'quoted text' | sed --verbose cd readonly grep grep 'quoted text'
+	x=1 grep test "$@" echo
+	awk cd /usr/bin then ${HOME} echo x=1 && && test ${HOME} export awk ${HOME}
+		$(pwd) | awk $(pwd) 'quoted text' sed awk echo "$1" ${HOME} "$@"
+${HOME} export sed echo 'quoted text'
+		| --verbose cd printf x=1 x=1
+echo 'quoted text' && ${HOME} 'quoted text' printf -eu awk test 'quoted text' then
+	sed then "$@" local x=1 x=1 readonly sed
+cd 'quoted text' then test echo test
+2>/dev/null x=1 export done done printf echo done /usr/bin ${HOME}
+		"$1" && 'quoted text' /usr/bin readonly echo x=1 'quoted text'
+	--verbose && | then printf awk grep 'quoted text' -eu
+	/usr/bin sed -eu cd $(pwd) awk x=1 'quoted text' 2>/dev/null 2>/dev/null
+sed 2>/dev/null then readonly grep 'quoted text' printf printf awk cd
+echo "$1" && printf grep -eu ${HOME} x=1
+echo /usr/bin awk echo awk done "$@" x=1 "$1" | readonly grep 2>/dev/null
+'quoted text' | 2>/dev/null then x=1 readonly && then awk awk test done readonly
+		local export export cd awk cd 'quoted text' readonly awk
+	&& export export 'quoted text' sed local then && export 2>/dev/null
+		grep sed export done x=1 $(pwd) local grep --verbose
+		'quoted text' "$@" done $(pwd)
+		printf printf done then local echo done local readonly export
+	"$1" awk done /usr/bin "$@" echo x=1 'quoted text' sed ${HOME} sed "$@"
+		2>/dev/null local awk "$@" "$@" "$1" | done export grep done "$@" "$@"
+		2>/dev/null --verbose export done printf awk awk "$1"
+	&& --verbose cd done sed cd && readonly x=1 -eu test grep "$1"
+		local x=1 sed sed ${HOME} && readonly local export && /usr/bin echo
+	echo "$@" export | ${HOME} /usr/bin | then ${HOME} test && x=1 | done
+	export x=1 sed done cd awk test "$@" $(pwd) echo echo "$1"
+		readonly --verbose /usr/bin 'quoted text' cd sed --verbose "$@"
+	then export 'quoted text' then printf "$@" 'quoted text' then printf awk readonly
+then | export sed "$@" /usr/bin --verbose 'quoted text'
+	$(pwd) readonly echo grep done printf 2>/dev/null printf printf 'quoted text'
+readonly ${HOME} local ${HOME}
+| awk sed sed local /usr/bin ${HOME} readonly 2>/dev/null /usr/bin
+&& grep "$1" "$@" local done then then sed && test "$@" 'quoted text'
+		export "$1" printf then x=1
+	then awk 2>/dev/null then 'quoted text' && awk printf $(pwd)
+2>/dev/null local $(pwd) x=1 cd x=1 ${HOME} grep 2>/dev/null
+		x=1 awk "$@" 2>/dev/null /usr/bin grep && && sed awk cd $(pwd)
+		-eu test -eu /usr/bin | grep readonly
+x=1 printf cd | grep sed "$@" awk awk
+		then then cd ${HOME} readonly test
+$(pwd) /usr/bin echo "$1" done | "$@" --verbose awk sed x=1 && readonly grep
+	"$1" && -eu then -eu | --verbose x=1 readonly
+		2>/dev/null | then /usr/bin
+	| sed && 'quoted text' /usr/bin printf -eu ${HOME} "$1" sed local | -eu ${HOME}
+	'quoted text' readonly ${HOME} local -eu -eu printf then $(pwd) /usr/bin
+	--verbose /usr/bin --verbose then && awk sed --verbose -eu -eu sed 'quoted text'
+	local --verbose echo -eu "$@" | $(pwd) 2>/dev/null
+	done ${HOME} local readonly
+| | test test "$1" "$@" x=1 --verbose $(pwd)
+	printf done 2>/dev/null printf grep local && export
+x=1 'quoted text' 'quoted text' readonly echo x=1 --verbose | sed sed ${HOME}
+printf 2>/dev/null sed 'quoted text' printf local readonly
+cd ${HOME} "$@" "$1" /usr/bin 2>/dev/null test
+		"$@" grep $(pwd) cd 2>/dev/null 'quoted text' ${HOME} sed export local then 'quoted text'
+	"$1" then grep "$@" grep -eu "$@" "$@" "$@" -eu 'quoted text' done
+		x=1 cd echo ${HOME} export done local && "$@" ${HOME} local local done then --verbose
+		"$@" && | /usr/bin echo ${HOME} awk --verbose readonly
+	done cd $(pwd) test test 'quoted text'
+		2>/dev/null /usr/bin echo export printf && -eu local
+	${HOME} test awk ${HOME} $(pwd)
+	cd 2>/dev/null grep "$1" grep then x=1 grep done $(pwd) test "$1" "$1" printf printf
+		x=1 $(pwd) printf then /usr/bin export done then cd 2>/dev/null 'quoted text' awk
+		readonly && 2>/dev/null $(pwd) printf /usr/bin /usr/bin
+export "$1" readonly printf done test export | /usr/bin 'quoted text'
+sed export "$1" $(pwd) --verbose 2>/dev/null printf 'quoted text' export printf
+		readonly readonly | 'quoted text' printf sed
+		"$@" then -eu x=1 'quoted text' x=1 local 2>/dev/null -eu x=1
+	"$1" awk --verbose grep "$@" cd | /usr/bin done /usr/bin
+| --verbose | cd then x=1 sed
+${HOME} grep readonly awk printf
+awk | --verbose | then "$1" -eu printf grep cd --verbose "$@"
+		local -eu /usr/bin sed 'quoted text' /usr/bin cd echo grep "$@" -eu done /usr/bin
+-eu --verbose ${HOME} ${HOME} --verbose cd && awk
+	cd local cd 'quoted text' && x=1 local && then /usr/bin test awk ${HOME}
+		-eu export done "$@" done grep echo local
+| echo test --verbose 'quoted text' -eu | "$1" | grep cd readonly
+		/usr/bin export done ${HOME} done awk local cd ${HOME}
+		/usr/bin "$@" cd test grep sed 2>/dev/null sed /usr/bin $(pwd) cd ${HOME} ${HOME}
+		'quoted text' 2>/dev/null | export 2>/dev/null
+'quoted text' | --verbose $(pwd) && cd sed awk "$@" /usr/bin --verbose | then |
+	| done $(pwd) readonly done ${HOME}
+done test test readonly "$1" sed 2>/dev/null done -eu | local printf
+$(pwd) && awk grep "$@" readonly readonly sed -eu then sed awk x=1
+${HOME} "$1" printf $(pwd) && grep $(pwd) printf test "$1" ${HOME} echo
+local awk && --verbose x=1 ${HOME} -eu -eu grep sed -eu --verbose cd sed grep
+${HOME} grep cd -eu --verbose && cd | -eu x=1 x=1 && -eu "$1" "$1"
+	test --verbose "$1" && readonly
+	local x=1 'quoted text' x=1 test -eu ${HOME} awk
+	'quoted text' test 'quoted text' then --verbose cd -eu test
+readonly 'quoted text' printf | then echo
+		'quoted text' then echo awk
+		/usr/bin /usr/bin 'quoted text' $(pwd) printf x=1
+		export grep /usr/bin echo ${HOME} $(pwd) 2>/dev/null --verbose awk readonly 'quoted text'
+	awk grep echo 'quoted text' printf then 'quoted text'
+		-eu 'quoted text' "$1" 'quoted text' 'quoted text' ${HOME} 'quoted text' && sed
+		awk ${HOME} ${HOME} --verbose
+	--verbose --verbose 2>/dev/null readonly awk echo readonly "$@" 'quoted text'
+		cd done test local printf 2>/dev/null echo 'quoted text' test
+	sed -eu then | echo readonly && ${HOME} 2>/dev/null awk | ${HOME}
+		'quoted text' printf -eu cd test -eu |
+		"$@" export export test export "$1" awk && 'quoted text' x=1 printf local
+		export printf export
+/usr/bin sed --verbose "$@"
+done then cd done 'quoted text' $(pwd) --verbose export printf ${HOME} readonly
+	printf | printf awk x=1 -eu readonly
+	readonly done then -eu
+	sed grep x=1 done $(pwd) "$1" /usr/bin x=1 "$1"
+	/usr/bin && "$@" -eu --verbose test
+test -eu printf 'quoted text' grep x=1 /usr/bin
+-eu /usr/bin "$1" "$@" /usr/bin /usr/bin "$1" readonly
+export echo ${HOME} 'quoted text' && export /usr/bin $(pwd) /usr/bin readonly
+	local "$1" "$1" grep ${HOME} printf sed /usr/bin export cd ${HOME} ${HOME} printf
+$(pwd) ${HOME} | "$1" /usr/bin -eu --verbose && -eu cd /usr/bin
+	readonly sed 'quoted text' "$1" test printf printf | x=1 | $(pwd)
+'quoted text' --verbose -eu cd sed awk
+printf && awk ${HOME} export then
+	grep sed readonly awk $(pwd) --verbose then grep awk test local
+	/usr/bin "$@" cd echo --verbose
+	awk export done printf
+		then 2>/dev/null "$1" echo x=1
+	$(pwd) done test 2>/dev/null -eu done test 2>/dev/null
+		'quoted text' export printf /usr/bin ${HOME} test "$@" echo "$1" done printf
+awk local 'quoted text' ${HOME} -eu then local printf
+	awk grep done export -eu test then "$@" printf printf 2>/dev/null
+	2>/dev/null 2>/dev/null --verbose grep "$1" done printf printf -eu done /usr/bin
+	awk "$@" --verbose -eu --verbose cd ${HOME} "$@"
+		"$1" awk /usr/bin local "$1"
+	"$1" --verbose "$@" --verbose
+/usr/bin "$@" && grep readonly | /usr/bin -eu x=1
+		&& printf -eu export "$1" echo
+	&& readonly 2>/dev/null && readonly --verbose "$1" /usr/bin awk then 2>/dev/null
+done echo "$@" then export cd $(pwd) && -eu $(pwd) 2>/dev/null "$1"
+"$1" readonly ${HOME} grep ${HOME} 'quoted text' sed x=1 local && test -eu
+then 2>/dev/null cd test echo "$@" readonly $(pwd)
+	${HOME} "$1" /usr/bin "$1" 'quoted text' $(pwd) local sed done
+		export done "$@" "$@" 'quoted text' $(pwd) sed sed -eu "$@" && grep awk then
+cd "$@" then ${HOME} export export test -eu printf
+	sed && then sed x=1 sed readonly 2>/dev/null cd
+		$(pwd) x=1 local x=1 printf then | awk awk printf echo -eu x=1 done echo $(pwd)
+		&& sed /usr/bin export export && "$@" printf test 2>/dev/null
+		| && cd $(pwd) sed $(pwd)
+	"$@" readonly | sed 2>/dev/null
+	&& 2>/dev/null cd 'quoted text'
+	awk "$1" ${HOME} echo test grep
+		done -eu $(pwd) done printf
+local /usr/bin then "$@" "$@" then readonly done
+		${HOME} "$1" export x=1 test sed x=1 "$@" 'quoted text'
+&& "$@" cd "$1" readonly done local "$@" /usr/bin echo
+printf test printf | x=1 export test readonly && done "$1" cd | then echo
+		printf echo then --verbose awk ${HOME} ${HOME} printf
+		awk awk local echo echo done "$@" then "$1" "$1"
+		'quoted text' && printf awk 2>/dev/null export readonly grep |
+${HOME} grep export "$@" ${HOME} grep grep $(pwd) /usr/bin /usr/bin printf
+	x=1 awk test && && local printf
+${HOME} ${HOME} done /usr/bin | 2>/dev/null printf && local | 'quoted text' "$1"
+| readonly printf awk 2>/dev/null echo
+	printf "$1" printf sed 2>/dev/null awk x=1 ${HOME} test 2>/dev/null
+&& grep local x=1 --verbose awk done --verbose awk
+	/usr/bin then $(pwd)
+	readonly grep | | -eu then $(pwd) cd 'quoted text' export echo sed test printf
+	'quoted text' x=1 awk
+		'quoted text' 'quoted text' ${HOME}
+'quoted text' && awk | /usr/bin --verbose 'quoted text' | done --verbose $(pwd)
+readonly x=1 "$1" readonly then 2>/dev/null then
+		grep --verbose then ${HOME} "$1" /usr/bin awk local /usr/bin
+"$1" cd "$@" sed | test sed readonly echo
+local sed done 'quoted text'
+		then | /usr/bin ${HOME} x=1 echo cd /usr/bin /usr/bin
+${HOME} grep "$1" | cd && readonly awk
+/usr/bin echo x=1 then readonly export then
+"$@" printf "$@" sed then echo | awk 2>/dev/null
+&& test then awk "$@" /usr/bin done local echo done local sed /usr/bin &&
+		2>/dev/null printf grep --verbose ${HOME} sed && echo local local
+&& x=1 echo ${HOME} -eu 'quoted text' && ${HOME} "$@" 'quoted text'
+		test -eu ${HOME} sed && sed && --verbose 2>/dev/null
+	| "$1" /usr/bin printf && readonly local then
+	--verbose export grep --verbose readonly then | | done then
+	export grep 'quoted text' printf test then /usr/bin readonly
+done --verbose printf ${HOME} then done x=1 x=1 /usr/bin readonly sed | then /usr/bin
+		readonly awk done test /usr/bin then && done awk | export "$@" test
+test && awk -eu "$1" sed "$1" ${HOME} readonly $(pwd) ${HOME} | cd
+		export 'quoted text' local done printf then && --verbose
+		cd | ${HOME} sed 2>/dev/null
+		export && "$@" "$1" x=1 export $(pwd) $(pwd) echo cd /usr/bin export "$1" 2>/dev/null
+	| $(pwd) sed local local then | -eu $(pwd) "$@" "$1"
+	test test 2>/dev/null && ${HOME}
+	"$1" cd awk export test "$@" 2>/dev/null
+	$(pwd) 2>/dev/null grep && "$@" grep "$1" export "$@"
+	printf readonly local x=1 sed && printf
+local -eu /usr/bin -eu local && awk local 'quoted text'
+		"$@" cd awk echo "$@" grep cd
+/usr/bin x=1 | awk grep --verbose sed | $(pwd)
+2>/dev/null 'quoted text' export printf | 'quoted text' 2>/dev/null
+then printf echo 2>/dev/null
+done export printf cd | echo printf -eu "$@" -eu sed -eu && | printf sed && echo
+		"$1" && /usr/bin $(pwd) sed 2>/dev/null
+		-eu readonly echo awk 2>/dev/null && $(pwd) readonly
+		then "$1" "$1" cd -eu && awk
+echo grep x=1 echo then echo
+		readonly && awk 2>/dev/null /usr/bin
+readonly "$@" printf 'quoted text'
+	x=1 ${HOME} -eu grep | "$@" --verbose printf
+	cd /usr/bin then 2>/dev/null echo then export
+		/usr/bin "$@" 2>/dev/null | 2>/dev/null local 'quoted text' then echo
+	&& grep cd "$1" x=1 export && "$@"
+	awk ${HOME} "$@" echo test test local
+		test ${HOME} printf | printf export | test local 'quoted text' test --verbose
+/usr/bin readonly grep
+		/usr/bin -eu echo test cd
+		local then test export ${HOME} printf test printf local
+		"$@" export local && then -eu export sed then x=1 then echo -eu 'quoted text'
+	echo -eu awk awk --verbose printf cd "$@" echo test x=1 x=1 "$1" local &&
+"$@" cd $(pwd) export done grep cd /usr/bin
+	2>/dev/null printf 'quoted text'
+	x=1 export 'quoted text' --verbose then && readonly 2>/dev/null done printf
+"$1" --verbose echo cd grep echo /usr/bin
+	x=1 readonly -eu then local | 2>/dev/null local --verbose local
+	awk test | "$@" $(pwd) cd cd $(pwd) export then && "$@" /usr/bin done &&
+		sed 'quoted text' grep readonly ${HOME} printf /usr/bin awk
+	readonly readonly done done grep grep | readonly
+	${HOME} 2>/dev/null && /usr/bin 2>/dev/null
+x=1 "$@" sed $(pwd) /usr/bin local 2>/dev/null 2>/dev/null
+		grep cd "$1" then done
+		readonly test export ${HOME} done 2>/dev/null 2>/dev/null
+		${HOME} "$@" x=1 export test readonly ${HOME} --verbose
+--verbose "$@" echo /usr/bin
+-eu -eu readonly -eu "$1" 'quoted text' /usr/bin 'quoted text' --verbose
+	/usr/bin && /usr/bin done sed sed readonly x=1 "$1" then cd
+	x=1 then 2>/dev/null readonly test "$1" grep done then
+	--verbose sed printf 'quoted text' awk grep sed | "$@" local 'quoted text'
+		$(pwd) -eu cd local x=1 $(pwd) echo ${HOME}
+	awk 'quoted text' ${HOME} printf "$@" readonly then && | cd local
+	export 'quoted text' --verbose "$1" $(pwd) -eu --verbose ${HOME}
+	'quoted text' 2>/dev/null awk -eu done cd ${HOME} 'quoted text'
+	then x=1 cd 'quoted text' -eu ${HOME} x=1 export ${HOME}
+'quoted text' 2>/dev/null 'quoted text' ${HOME} export test /usr/bin
+cd x=1 /usr/bin export export ${HOME} /usr/bin "$@" test "$1" cd $(pwd) -eu sed
+2>/dev/null 2>/dev/null
+		printf readonly "$@" | /usr/bin done $(pwd) 2>/dev/null x=1 sed |
+cd && export $(pwd) printf ${HOME} ${HOME}
+done printf echo printf sed --verbose local /usr/bin grep x=1 "$1" x=1 "$@" -eu
+export ${HOME} done sed echo grep --verbose $(pwd) grep
+	&& sed -eu echo readonly $(pwd) "$@" done -eu
+		$(pwd) readonly x=1 local export awk sed ${HOME} /usr/bin
+-eu && x=1 sed -eu sed -eu 2>/dev/null
+		readonly "$@" /usr/bin && x=1 --verbose
+	2>/dev/null then awk readonly
+		--verbose cd && "$@" done -eu
+		"$@" cd 'quoted text' awk sed grep --verbose --verbose /usr/bin grep awk
+done && && "$@" done -eu x=1 -eu
+		then && /usr/bin export --verbose export 2>/dev/null && sed -eu $(pwd) |
+		awk "$1" local grep local
+2>/dev/null 2>/dev/null
+		| local local local --verbose "$@" &&
+		echo sed -eu awk echo awk then test
+	echo "$@" $(pwd) -eu awk done --verbose
+		done --verbose "$@" /usr/bin
+		then | x=1 x=1 cd cd --verbose --verbose && && "$@" cd printf
+"$1" export --verbose readonly grep export
+printf $(pwd) --verbose test echo
+readonly /usr/bin "$@" "$1" export done cd test local awk done test
+	--verbose "$@" $(pwd) readonly awk 'quoted text' echo printf --verbose
+awk $(pwd) 'quoted text' "$@" x=1 cd "$@" cd "$@" sed 2>/dev/null && export 2>/dev/null
+	--verbose --verbose readonly echo ${HOME} echo printf sed $(pwd)
+2>/dev/null awk printf /usr/bin then done cd then grep grep test
+/usr/bin 2>/dev/null printf cd -eu -eu
+done done -eu local echo $(pwd)
+	readonly echo "$1" sed test 2>/dev/null done printf printf export awk cd | sed
+	cd grep grep && 2>/dev/null ${HOME} "$1"
+2>/dev/null sed awk sed test grep "$1" x=1 x=1 printf -eu && awk 'quoted text'
+		local $(pwd) | /usr/bin sed then
+	done && $(pwd) then grep sed x=1 $(pwd) "$1" x=1
+	printf "$@" -eu sed done -eu "$@"
+		printf x=1 ${HOME} ${HOME} && /usr/bin
+	$(pwd) export | export sed | 2>/dev/null -eu printf
+done $(pwd) && ${HOME} "$@" test | -eu 2>/dev/null
+	awk sed sed done --verbose
+echo printf && $(pwd) echo done "$1" awk export
+	-eu echo test $(pwd) 'quoted text'
+"$1" export sed ${HOME} local ${HOME} -eu $(pwd)
+		-eu readonly cd grep then
+		-eu -eu readonly $(pwd) 'quoted text' cd "$@" --verbose -eu
+readonly $(pwd) x=1 grep $(pwd)
+	readonly "$1" printf awk | /usr/bin printf "$1" local x=1 echo 2>/dev/null -eu
+	$(pwd) done 2>/dev/null echo
+		test cd sed export awk 'quoted text'
+	'quoted text' local awk cd 'quoted text' awk
+	cd awk | test test "$@" /usr/bin
+${HOME} cd echo -eu --verbose $(pwd) ${HOME} -eu test "$@" export printf &&
+awk printf printf awk then
+	--verbose && sed awk echo awk test && x=1 "$@" "$@" awk "$1" x=1
+/usr/bin x=1 test cd x=1 export export
+		"$1" then export | "$1" "$1" export local "$1" "$@" --verbose |
+2>/dev/null && grep test export -eu && cd x=1 "$@" printf --verbose
+		| printf && test | test --verbose && /usr/bin 2>/dev/null ${HOME} export
+	"$1" export | 'quoted text' && && ${HOME}
+	'quoted text' grep "$@" "$@" $(pwd) /usr/bin test "$1" test cd echo x=1
+		awk export cd 'quoted text' test && 2>/dev/null -eu grep grep ${HOME}
+grep awk export -eu readonly cd /usr/bin
+	x=1 then x=1 "$@" local local done 2>/dev/null awk | $(pwd)
+		local "$1" grep $(pwd) $(pwd) cd --verbose $(pwd) $(pwd) 'quoted text'
+		$(pwd) printf echo grep sed local $(pwd)
+'quoted text' sed --verbose sed printf "$@" export "$@" done x=1 $(pwd)
+&& done --verbose 2>/dev/null | local then echo x=1 test --verbose "$@"
+local | sed -eu $(pwd) cd "$1" | ${HOME} readonly export 'quoted text'
+	'quoted text' printf printf test cd test | test "$1" cd export export
+		awk "$@" local sed readonly 'quoted text' | local done
+		-eu ${HOME} test local --verbose
+		--verbose sed ${HOME} 'quoted text' printf printf echo echo done
+	$(pwd) && test | cd grep awk --verbose && $(pwd) -eu sed readonly
+		local x=1 awk "$1" 'quoted text' grep /usr/bin grep grep 2>/dev/null
+$(pwd) awk --verbose local cd test awk "$1" -eu /usr/bin ${HOME} && local
+	x=1 "$1" awk test -eu && cd /usr/bin x=1 && done then
+		cd awk then echo sed done sed && export done
+		"$@" 2>/dev/null ${HOME} ${HOME} ${HOME} 'quoted text'
+	--verbose $(pwd) done "$@" echo && 'quoted text' x=1 2>/dev/null sed grep /usr/bin
+	$(pwd) cd $(pwd) awk echo
+x=1 -eu export /usr/bin 'quoted text' "$1" "$1" awk $(pwd) readonly
+done awk grep && 2>/dev/null 'quoted text'
+sed export done /usr/bin echo cd x=1
+echo export "$@" --verbose cd export sed 'quoted text' 'quoted text' done readonly
+sed test awk then readonly readonly 2>/dev/null then echo echo test echo
+"$1" -eu grep "$1" ${HOME} done sed "$@" cd && then 2>/dev/null sed awk done
+	| sed --verbose ${HOME} done /usr/bin sed "$1" echo
+		then "$1" /usr/bin && export /usr/bin && --verbose --verbose export
+	&& echo printf "$@" /usr/bin "$@" then /usr/bin awk sed --verbose
+cd -eu ${HOME} then readonly cd 2>/dev/null -eu -eu test test "$@" echo
+--verbose echo /usr/bin && ${HOME} readonly
+		| --verbose /usr/bin /usr/bin cd readonly done done
+		| "$1" sed grep $(pwd) local
+local test && ${HOME} readonly test cd then awk ${HOME}
+	2>/dev/null "$1" export 'quoted text' then $(pwd) then
+grep "$@" cd readonly -eu test $(pwd) "$@"
+	done x=1 2>/dev/null local sed awk done
+$(pwd) echo test ${HOME} export printf printf echo "$@" local sed test
+sed printf ${HOME} done $(pwd) export sed sed export awk then ${HOME} grep printf
+	-eu ${HOME} sed 2>/dev/null -eu awk
+	&& cd x=1 && /usr/bin sed awk 2>/dev/null test | sed done "$1" | x=1 2>/dev/null
+	/usr/bin echo x=1 export awk printf grep /usr/bin local
+		then x=1 /usr/bin echo 'quoted text' printf -eu
+		echo cd sed sed ${HOME} /usr/bin local "$1" 2>/dev/null local /usr/bin x=1
+		readonly printf sed x=1 readonly "$@" export local "$1" && awk test test echo
+export readonly 2>/dev/null
+	-eu $(pwd) readonly 2>/dev/null "$@"
+		echo sed local --verbose
+done grep "$1" && then --verbose sed
+		grep echo readonly 2>/dev/null cd awk "$@"
+	done cd awk 2>/dev/null cd awk cd test /usr/bin 'quoted text'
+	readonly && x=1 x=1 local awk readonly "$1" $(pwd) ${HOME}
+echo | grep 'quoted text' x=1 x=1 test "$1" grep | 2>/dev/null export local
+"$1" x=1 /usr/bin --verbose local test local
+echo then $(pwd) printf 2>/dev/null
+local --verbose cd local $(pwd) echo printf then -eu echo 'quoted text' export
+	x=1 2>/dev/null printf "$@" "$1" test grep local $(pwd)
+	'quoted text' "$@" export awk sed x=1 x=1 export printf awk printf
+		${HOME} 2>/dev/null echo && done sed 'quoted text' /usr/bin grep printf
+	$(pwd) 'quoted text' "$@" cd 'quoted text' cd ${HOME} export
+		test "$@" 2>/dev/null cd echo printf printf
+2>/dev/null 2>/dev/null local readonly x=1
+		&& --verbose x=1 && "$1" 2>/dev/null echo echo
+	export && cd "$1" 2>/dev/null ${HOME} done ${HOME} "$@" 2>/dev/null test grep
+| "$1" done cd cd 'quoted text' readonly printf x=1 | echo readonly
+		grep ${HOME} && sed ${HOME} local done
+export $(pwd) cd | local grep "$1" printf --verbose export readonly $(pwd) x=1
+grep x=1 && then test test ${HOME} local 'quoted text'
+	test cd "$@" 'quoted text' cd sed echo
+	/usr/bin done then "$@"
+	readonly sed -eu | -eu ${HOME} grep ${HOME} awk /usr/bin then --verbose readonly
+		sed ${HOME} -eu x=1 ${HOME} 'quoted text' done "$@" cd | -eu readonly
+		${HOME} cd 'quoted text' "$1" done cd local export awk cd printf readonly cd
+		local /usr/bin $(pwd) x=1 -eu x=1 --verbose local /usr/bin -eu
+awk 'quoted text' "$1" "$@" sed ${HOME} -eu
+		readonly /usr/bin "$@" && export ${HOME} grep done local /usr/bin
+readonly -eu awk $(pwd) cd 'quoted text' --verbose cd grep "$@"
+		/usr/bin sed test "$@" | x=1 local
+	--verbose done cd 2>/dev/null printf "$@" 2>/dev/null
+	$(pwd) sed printf /usr/bin cd "$@" "$@" printf awk sed ${HOME}
+		local | readonly grep ${HOME} "$1" local x=1 grep
+	then cd test printf then "$@" && x=1 --verbose test "$1" -eu echo x=1 then
+		$(pwd) then printf then export local --verbose awk sed grep "$@" done echo test
+		| 2>/dev/null $(pwd) && "$@" "$1" --verbose
+		test -eu && grep printf "$1"
+		then /usr/bin x=1 sed -eu | $(pwd) --verbose
+		test $(pwd) /usr/bin "$1" 'quoted text' printf x=1 /usr/bin
+	&& "$1" grep test export sed && grep cd
+grep ${HOME} /usr/bin then && && awk 2>/dev/null -eu -eu
+| then --verbose $(pwd) done /usr/bin sed /usr/bin readonly readonly export printf
+"$@" "$@" sed done printf | sed ${HOME}
+echo local local test readonly "$@" "$@" awk export
+		export 'quoted text' local "$1"
+		${HOME} echo --verbose 2>/dev/null
+	2>/dev/null --verbose &&
+	export grep $(pwd) awk awk readonly ${HOME} /usr/bin done
+then done "$1" "$1" 'quoted text' echo 2>/dev/null
+	"$1" $(pwd) done readonly --verbose printf awk cd /usr/bin
+$(pwd) local | cd awk && "$1" /usr/bin | "$@" export test then
+	cd --verbose echo cd "$@"
+	2>/dev/null /usr/bin printf
+	| /usr/bin 'quoted text' local test
+		"$@" sed && 'quoted text' grep --verbose local test /usr/bin --verbose x=1
+	grep grep /usr/bin --verbose printf ${HOME} done test
+		done then /usr/bin export "$@" printf 'quoted text' done
+$(pwd) x=1 "$1" 2>/dev/null "$1" cd -eu echo awk "$1" export printf grep
+	'quoted text' grep readonly then -eu sed done ${HOME} && -eu | ${HOME}
+	x=1 grep x=1 2>/dev/null local sed done 'quoted text'
+	printf $(pwd) ${HOME} "$@" 2>/dev/null /usr/bin "$@"
+echo && export sed readonly ${HOME} test grep 'quoted text' done "$@" done
+	echo echo && /usr/bin && then
+		readonly printf grep 'quoted text' echo readonly --verbose -eu then | -eu &&
+2>/dev/null test local test 'quoted text' 'quoted text' /usr/bin local ${HOME}
+		$(pwd) then 2>/dev/null /usr/bin $(pwd) $(pwd) cd grep test "$@" ${HOME} echo
+		grep "$1" sed "$@" --verbose local then 2>/dev/null
+	| export "$1" grep | local export local 2>/dev/null | local test && /usr/bin
+	$(pwd) 'quoted text' export -eu -eu 2>/dev/null echo export local ${HOME}
+| -eu --verbose printf local ${HOME} local grep --verbose ${HOME} done /usr/bin
+	| export "$1" awk readonly readonly "$@" test | awk echo test
+	&& /usr/bin awk 'quoted text' "$1" $(pwd) -eu
+	2>/dev/null sed then "$@"
+	--verbose 'quoted text' | | 'quoted text' then done local
+echo && /usr/bin test
+	'quoted text' readonly
+	cd test then "$@" | $(pwd) "$@" "$1" 'quoted text' "$1"
+		-eu readonly then done 'quoted text' "$1" test --verbose 2>/dev/null grep
+		readonly local | cd readonly awk then && | ${HOME}
+	&& "$1" echo && $(pwd) x=1 then
+	echo && grep done ${HOME}
+		done ${HOME} /usr/bin $(pwd) $(pwd) then readonly 'quoted text'
+-eu export "$1" sed readonly readonly echo /usr/bin --verbose ${HOME}
+then done sed printf awk "$1" "$@" --verbose ${HOME}
+	printf 2>/dev/null local cd cd readonly
+2>/dev/null 2>/dev/null printf sed then /usr/bin printf sed "$@" done
+	local --verbose && done 'quoted text' done echo
+	done test then /usr/bin | 'quoted text' readonly $(pwd) -eu sed --verbose
+test echo 2>/dev/null | export
+| /usr/bin sed x=1 cd /usr/bin done then
+&& echo "$@" "$@" echo
+		printf 2>/dev/null && x=1 sed "$1" -eu printf echo -eu grep | echo --verbose
+	| test 'quoted text' $(pwd) awk sed readonly
+		/usr/bin "$@" ${HOME} 2>/dev/null ${HOME} && readonly /usr/bin awk -eu
+/usr/bin cd grep readonly $(pwd) /usr/bin awk
+		&& echo x=1 awk sed cd "$1" printf 2>/dev/null --verbose awk done --verbose
+	-eu | 'quoted text' grep ${HOME} echo /usr/bin /usr/bin
+	${HOME} test 'quoted text' -eu done grep echo sed
+	sed x=1 export done 2>/dev/null x=1 'quoted text'
+		2>/dev/null 'quoted text' x=1 ${HOME} --verbose sed done ${HOME}
+		| | test /usr/bin done echo
+'quoted text' x=1 --verbose | "$@" grep | awk test echo export $(pwd) echo
+		-eu test then "$1" x=1 $(pwd) /usr/bin && x=1
+then printf "$1" done | | sed awk /usr/bin "$1" /usr/bin
+	awk local ${HOME} grep grep x=1 2>/dev/null then done readonly
+	/usr/bin echo /usr/bin sed x=1 --verbose done echo readonly cd && x=1
+	x=1 'quoted text' -eu test test 2>/dev/null 2>/dev/null done then "$@" export
+		/usr/bin echo x=1 'quoted text' grep x=1 "$@" local then cd --verbose
+	"$@" cd | local 'quoted text' "$@" test readonly /usr/bin sed 'quoted text'
+	then readonly "$@" && awk grep $(pwd)
+awk x=1 grep export -eu awk | 'quoted text' grep && 'quoted text' then && local
+	awk --verbose readonly printf | readonly grep local echo
+		echo $(pwd) done awk grep done ${HOME} $(pwd) 'quoted text' local done then
+test echo printf && grep local $(pwd) grep sed && ${HOME}
+printf echo -eu 2>/dev/null cd test then sed awk printf "$1"
+	2>/dev/null 2>/dev/null /usr/bin then export -eu
+/usr/bin "$@" "$1" readonly local then x=1 local $(pwd) sed test --verbose
+| grep awk "$1" printf 'quoted text' echo | local "$@" $(pwd) $(pwd) && local
+sed cd then 'quoted text' x=1 sed -eu $(pwd) "$1" local then cd local
+x=1 then "$1" 'quoted text' x=1 echo --verbose then test local -eu x=1 "$@" local
+	readonly readonly ${HOME} --verbose
+		export sed sed 'quoted text' x=1 "$1" $(pwd) export && $(pwd)
+	done /usr/bin export local export sed cd readonly 'quoted text' $(pwd) done
+awk --verbose done local $(pwd) /usr/bin sed printf done --verbose cd export
+		-eu ${HOME} test "$@" export printf local "$@" local --verbose
+		"$@" export -eu ${HOME} | && readonly 2>/dev/null
+	readonly then then readonly grep "$1" 'quoted text' 'quoted text' -eu then
+		x=1 "$@" echo 'quoted text'
+$(pwd) sed cd export ${HOME} -eu test then local echo --verbose
+		x=1 grep cd "$@" readonly "$1" | 2>/dev/null readonly readonly awk
+cd && export x=1 printf && x=1 /usr/bin | test echo test | test /usr/bin ${HOME}
+	"$@" printf "$@" local 2>/dev/null && $(pwd) && 2>/dev/null -eu --verbose "$1"
+	awk sed ${HOME} && 2>/dev/null 'quoted text'
+		--verbose && | "$@" test export 'quoted text' 'quoted text'
+	-eu && x=1 local /usr/bin "$1" test cd export --verbose
+readonly /usr/bin then done $(pwd)
+		local && | 'quoted text' -eu grep
+	test echo --verbose cd /usr/bin printf ${HOME} awk "$@" readonly
+${HOME} /usr/bin ${HOME}
+		echo -eu export cd echo test "$@" 2>/dev/null printf sed "$@" local && grep
+		local "$1" -eu /usr/bin && --verbose
+	local echo readonly local --verbose printf cd x=1 export /usr/bin
+		grep test cd "$1" awk $(pwd) cd awk local "$1" printf test export x=1 --verbose
+	${HOME} printf $(pwd) local echo cd readonly
+"$1" | sed 2>/dev/null readonly &&
+	"$1" cd && test test $(pwd) $(pwd) printf
+"$@" 'quoted text' cd sed $(pwd)
+--verbose 2>/dev/null -eu 'quoted text' printf &&
+| 'quoted text' -eu test done "$1" test && 'quoted text' awk
+${HOME} test "$1" readonly echo /usr/bin printf then cd test printf | export
+		echo awk local cd 'quoted text' 2>/dev/null
+local grep "$@" && then ${HOME} printf readonly test then sed
+	"$@" echo test sed grep $(pwd) local ${HOME} grep grep /usr/bin $(pwd) then
+	done cd export printf then x=1 local
+		--verbose printf readonly $(pwd)
+readonly export -eu $(pwd)
+grep 2>/dev/null 2>/dev/null
+	grep 'quoted text' -eu export grep
+	printf -eu && then echo cd grep 'quoted text' printf &&
+cd echo ${HOME} sed printf grep cd cd done cd echo 2>/dev/null | echo
+	| 2>/dev/null $(pwd) && then sed | -eu cd ${HOME} | && local sed 2>/dev/null
+x=1 x=1 /usr/bin grep
+		printf export cd $(pwd) --verbose
+		'quoted text' export grep | $(pwd) awk
+		"$1" -eu ${HOME} test grep export export ${HOME} 2>/dev/null
+		/usr/bin ${HOME} test 'quoted text' export
+then x=1 local done printf test grep done --verbose cd then printf $(pwd)
+	local printf /usr/bin $(pwd) sed done echo $(pwd) grep awk echo 'quoted text'
+done test cd -eu --verbose $(pwd) test test
+	$(pwd) cd echo export 'quoted text' -eu | --verbose printf
+	"$@" local "$1" awk local done "$1" export sed
+| $(pwd) sed done | 'quoted text'
+	'quoted text' sed done awk | readonly export
+	done 2>/dev/null x=1 2>/dev/null printf cd export printf cd
+		| local "$1" test export | ${HOME} -eu test sed done then "$@" export
+		echo test test then export "$1" awk export awk ${HOME} x=1
+	then then -eu x=1 --verbose done test test --verbose
+awk && x=1 test test sed local
+then awk grep ${HOME} echo done
+		export printf printf test export x=1 | -eu -eu grep | "$@" /usr/bin
+	grep -eu $(pwd) local 2>/dev/null -eu
+then awk test "$@" -eu $(pwd) --verbose 'quoted text' echo awk cd cd
+	test | | export grep echo grep readonly "$@" 2>/dev/null
+	x=1 2>/dev/null cd done "$1" "$1" grep -eu | ${HOME} |
+	-eu test then sed --verbose cd "$1" 2>/dev/null echo "$1" echo
+		'quoted text' export cd && echo "$@"
+		done --verbose | cd /usr/bin --verbose export "$1" then /usr/bin done
+		$(pwd) x=1 then cd ${HOME} 2>/dev/null printf echo "$1" 2>/dev/null
+		readonly printf /usr/bin local
+--verbose grep grep done cd then "$1" cd | /usr/bin /usr/bin
+	grep readonly echo ${HOME} && 2>/dev/null ${HOME} echo 2>/dev/null $(pwd) local
+		awk then 2>/dev/null local
+		/usr/bin /usr/bin printf
+		--verbose sed ${HOME} "$1" echo local export
+x=1 awk $(pwd) /usr/bin then grep done export /usr/bin awk
+	2>/dev/null /usr/bin done | export cd
+		awk readonly local test sed "$1" echo $(pwd) "$1" 'quoted text' 'quoted text'
+	then 2>/dev/null test printf "$@" | 2>/dev/null
+		${HOME} ${HOME} echo then "$1" x=1 /usr/bin /usr/bin
+		cd x=1 -eu /usr/bin done
+	test x=1 test $(pwd) x=1 grep cd awk 2>/dev/null | local $(pwd) | local
+		sed test grep echo x=1 --verbose export
+then | local && sed "$1" sed
+	then --verbose $(pwd) "$@" echo "$@" -eu grep "$@" grep && test
+printf test 'quoted text' $(pwd) 'quoted text'
+		${HOME} --verbose 2>/dev/null export | awk readonly readonly local done |
+	--verbose | printf export echo
+		"$@" ${HOME} $(pwd) ${HOME} export sed
+"$1" && sed -eu cd cd then done echo $(pwd) awk x=1 ${HOME}
+local export && printf x=1 local -eu printf "$@" x=1 printf then "$@" cd
+	echo grep printf test ${HOME}
+		'quoted text' readonly cd cd -eu sed done "$@" 'quoted text' 2>/dev/null
+		-eu --verbose awk grep echo local && grep x=1 "$1" "$1" -eu sed x=1 && -eu "$@"
+	grep test readonly export ${HOME} echo grep local awk printf then --verbose readonly
+		then local awk -eu awk "$@" -eu && 'quoted text' export local "$1"
+	${HOME} -eu 'quoted text' 'quoted text' cd awk then --verbose
+		sed then done export && $(pwd) echo
+	"$1" ${HOME} export 2>/dev/null local done
+		readonly export --verbose cd --verbose /usr/bin
+		sed --verbose 2>/dev/null "$@" 2>/dev/null export local cd 2>/dev/null
+		readonly cd x=1 echo x=1 2>/dev/null test readonly cd
+		export $(pwd) then ${HOME}
+	x=1 'quoted text' /usr/bin $(pwd) printf cd 2>/dev/null echo
+	awk echo sed 2>/dev/null $(pwd)
+	x=1 'quoted text' ${HOME} then | export done -eu 'quoted text' "$1" local
+		cd done 2>/dev/null 'quoted text' export -eu 'quoted text' ${HOME} local cd 2>/dev/null
+		echo sed ${HOME} "$@" test 2>/dev/null && then sed ${HOME}
+	x=1 test export local | -eu done sed
+	grep cd | --verbose 'quoted text' sed grep echo done readonly printf cd
+		printf 'quoted text' readonly && then grep -eu $(pwd) awk
+	"$1" readonly sed then echo --verbose && -eu local then then
+grep readonly grep printf then export awk printf local
+		echo "$@" sed --verbose sed sed 2>/dev/null test | test ${HOME}
+	"$1" "$@" sed | export awk sed local 'quoted text'
+		readonly "$@" done readonly local readonly printf done "$1" local grep
+		--verbose 'quoted text'
+	awk test grep && awk export --verbose ${HOME}
+x=1 2>/dev/null local -eu 'quoted text' export export then readonly then "$@" readonly
+		awk 'quoted text' printf export x=1
+	--verbose test done x=1 --verbose 'quoted text' then then sed
+printf && "$1" && test && export /usr/bin &&
+	printf sed grep export sed $(pwd) "$@" export -eu | sed && -eu done echo /usr/bin
+done then local /usr/bin printf then 2>/dev/null
+2>/dev/null done 'quoted text'
+	then echo 'quoted text' echo x=1 cd local "$1" sed 'quoted text'
+"$@" "$@" -eu "$@" /usr/bin done --verbose awk echo --verbose -eu x=1 | /usr/bin
+	cd test echo $(pwd) --verbose printf -eu cd | 2>/dev/null
+	$(pwd) ${HOME} sed sed "$1" local printf
+/usr/bin printf echo /usr/bin sed
+		done echo 2>/dev/null grep echo $(pwd) echo
+		x=1 "$@" -eu readonly readonly
+export "$1" x=1 awk test sed cd awk
+	"$1" x=1 "$@" export awk "$@" --verbose --verbose | "$@" 2>/dev/null local readonly
+export printf done cd "$1" -eu awk x=1 'quoted text' export readonly
+		${HOME} --verbose then -eu
+"$@" echo 'quoted text' test grep --verbose
+test cd "$@" then /usr/bin --verbose cd readonly $(pwd) "$1" readonly $(pwd) x=1
+	$(pwd) | && "$1" cd printf
+		export readonly awk echo /usr/bin awk "$1" readonly && awk 'quoted text' x=1
+	awk 'quoted text' --verbose grep sed done export echo done | readonly
+		"$@" local /usr/bin cd "$1"
+		${HOME} "$1" /usr/bin /usr/bin awk ${HOME}
+printf ${HOME} export echo
+		done | && 'quoted text' printf x=1 local && test
+&& done sed echo done && test done x=1 -eu ${HOME}
+		"$@" local 2>/dev/null readonly
+		${HOME} awk && readonly -eu readonly "$1" && export /usr/bin cd /usr/bin
+done sed ${HOME} && done done && 'quoted text' then
+		grep x=1 then --verbose
+	/usr/bin sed $(pwd) export export && "$1" sed 'quoted text' printf "$1" then
+		readonly local 2>/dev/null
+	&& done then readonly readonly
+		-eu -eu done && x=1 then "$@" export 2>/dev/null awk x=1 && ${HOME}
+	sed 'quoted text' | "$@" --verbose
+2>/dev/null $(pwd) x=1 done cd --verbose local | sed 'quoted text'
+	then sed ${HOME} echo cd printf readonly x=1 echo awk grep "$@"
+	export local $(pwd) $(pwd) done test x=1 awk grep && /usr/bin
+cd echo awk 'quoted text' 'quoted text' --verbose /usr/bin -eu
+${HOME} printf | | x=1 ${HOME} test $(pwd) done 'quoted text' awk 'quoted text'
+	awk awk 2>/dev/null test test
+then /usr/bin sed | sed echo printf 'quoted text'
+		--verbose grep export
+		done cd "$1" -eu ${HOME} then test
+	then sed printf | --verbose echo | x=1 then && | readonly | cd 2>/dev/null grep
+		done ${HOME} "$@" x=1 done "$1" export cd echo ${HOME}
+readonly x=1 echo cd "$1" --verbose readonly
+	awk "$@" awk awk printf local grep grep -eu && sed sed local --verbose
+		-eu export local echo --verbose
+		${HOME} sed awk printf test sed "$@" printf -eu printf
+	--verbose 2>/dev/null export test test
+/usr/bin -eu 2>/dev/null awk echo then cd --verbose grep
+readonly awk sed "$@" | test x=1 then echo printf 2>/dev/null
+		done "$1" "$@" readonly sed
+	sed -eu "$1" test 2>/dev/null printf sed
+		cd "$@" then local awk --verbose x=1 printf done "$@" $(pwd) export ${HOME}
+&& --verbose test 2>/dev/null echo printf echo grep /usr/bin
+	x=1 export test printf --verbose "$@" && "$@" "$@" "$1" readonly sed
+	printf done sed awk sed -eu printf
+		grep "$@" done /usr/bin done && local
+	sed readonly grep $(pwd) ${HOME}
+		&& --verbose readonly grep x=1 done
+test x=1 awk cd cd "$@" local awk 'quoted text'
+		'quoted text' -eu export readonly "$1" test x=1
+	x=1 test /usr/bin /usr/bin
+	done export $(pwd) 'quoted text' then --verbose 2>/dev/null awk 2>/dev/null
+		printf printf 2>/dev/null $(pwd) "$1" readonly then then
+2>/dev/null 2>/dev/null sed sed
+export echo cd /usr/bin local readonly printf 'quoted text' /usr/bin
+	&& printf 'quoted text' export "$1" sed
+done grep --verbose local "$@" "$@" | 'quoted text' 'quoted text' x=1 'quoted text'
+		"$@" $(pwd) x=1 $(pwd) --verbose readonly ${HOME} readonly
+	"$@" "$@" readonly /usr/bin sed --verbose
+grep then --verbose && "$@"
+		echo done sed x=1 local $(pwd) local /usr/bin $(pwd)
+	cd --verbose /usr/bin readonly local $(pwd) cd 'quoted text' readonly echo
+		2>/dev/null printf printf x=1 readonly local awk done 'quoted text'
+	done test --verbose then "$1" readonly sed
+		x=1 -eu $(pwd) sed sed local local readonly -eu sed |
+	-eu x=1 then sed --verbose && test echo
+test grep -eu sed --verbose 2>/dev/null
+grep grep grep local cd awk sed "$@" cd 'quoted text' echo awk
+${HOME} local /usr/bin 2>/dev/null -eu /usr/bin /usr/bin 2>/dev/null awk 'quoted text'
+	'quoted text' test export $(pwd) done done grep printf grep &&
+	'quoted text' export /usr/bin $(pwd) /usr/bin /usr/bin 'quoted text' readonly
+cd cd x=1 export $(pwd) $(pwd) test "$@" -eu printf sed ${HOME}
+		"$1" done /usr/bin local test grep /usr/bin ${HOME}
+readonly | test 'quoted text' export 'quoted text'
+		"$@" cd && grep 2>/dev/null
+readonly -eu 2>/dev/null --verbose -eu grep
+sed "$@" ${HOME} readonly done printf ${HOME} grep
+$(pwd) "$@" readonly --verbose "$@" && readonly
+	"$@" 'quoted text' export --verbose
+${HOME} readonly | test then -eu "$@" -eu 2>/dev/null -eu cd && grep sed
+	2>/dev/null && 2>/dev/null "$@" sed test
+	awk $(pwd) readonly sed "$@" local cd ${HOME} ${HOME} $(pwd)
+		awk sed "$@" awk export printf export grep sed 'quoted text'
+$(pwd) 2>/dev/null x=1 readonly
+	&& | "$@" export sed test readonly local "$1" $(pwd) --verbose sed
+"$1" | grep $(pwd) then x=1 ${HOME} /usr/bin
+-eu "$1" ${HOME} && sed readonly /usr/bin 'quoted text' "$@" "$1" then
+	test grep test "$@" grep "$@"
+		readonly local $(pwd) awk 'quoted text' ${HOME}
+	--verbose printf export export $(pwd)
+		cd cd echo grep awk "$1" 'quoted text' echo 'quoted text'
+-eu export ${HOME} $(pwd) awk sed x=1
+done /usr/bin x=1 ${HOME} --verbose -eu /usr/bin 'quoted text' grep
+&& "$@" cd && 'quoted text' $(pwd)
+		--verbose export test grep "$1" | /usr/bin
+	"$1" then 2>/dev/null ${HOME} 2>/dev/null $(pwd) then export test
+--verbose awk grep then awk
+		export grep awk export 2>/dev/null
+	${HOME} --verbose readonly | -eu 2>/dev/null $(pwd) sed /usr/bin
+readonly 'quoted text' ${HOME} local "$1" x=1 'quoted text' grep
+'quoted text' cd $(pwd) then | test ${HOME}
+		grep | "$1" -eu -eu echo then test
+then x=1 printf /usr/bin local ${HOME} "$1" 2>/dev/null
+		x=1 awk grep test grep && && ${HOME} cd /usr/bin --verbose grep $(pwd) && readonly
+	"$1" then cd 'quoted text' x=1 printf sed $(pwd) done
+then "$1" done x=1 $(pwd) export cd echo export grep $(pwd) sed /usr/bin
+		readonly /usr/bin readonly "$1" x=1 cd "$1" 2>/dev/null
+"$1" sed local local
+		'quoted text' awk x=1 local -eu x=1
+done readonly -eu /usr/bin $(pwd) awk grep --verbose test $(pwd)
+		&& awk && echo sed done readonly
+export export --verbose
+/usr/bin /usr/bin /usr/bin 2>/dev/null "$@"
+		awk -eu | export ${HOME} cd
+	test export test awk sed && echo echo -eu |
+		awk 'quoted text' local &&
+	awk then -eu /usr/bin --verbose done "$1" local done 'quoted text' done
+		&& "$@" echo --verbose ${HOME} $(pwd) ${HOME} echo "$1" awk local "$@" test
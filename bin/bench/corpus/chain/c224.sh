@@ -0,0 +1,2001 @@
+		local "$@" "$1" printf then local echo awk && readonly done $(pwd)
+		local sed printf grep && export "$1" awk x=1 local --verbose
+		x=1 "$@" echo && --verbose
+	test test test /usr/bin /usr/bin
+'quoted text' && "$1" cd echo printf x=1 'quoted text' "$1" "$@" 2>/dev/null
+		cd local "$1" ${HOME} 'quoted text' "$@" 'quoted text' "$@" $(pwd)
+	cd export 'quoted text' 'quoted text' 2>/dev/null 'quoted text' awk test
+cd $(pwd) test "$1" 'quoted text' && ${HOME} && -eu sed 'quoted text'
+	export ${HOME} export /usr/bin export
+/usr/bin "$1" x=1 --verbose cd | local test $(pwd) export x=1
+		&& $(pwd) 'quoted text' 2>/dev/null sed
+sed printf x=1 then | 'quoted text'
+		"$@" export | awk "$@" cd test grep | $(pwd) 'quoted text'
+		awk test | then sed "$1" awk awk /usr/bin
+	sed "$1" grep -eu /usr/bin sed readonly echo | cd && "$@"
+printf echo local printf 2>/dev/null x=1 "$@" $(pwd)
+	then "$1" /usr/bin printf export |
+	readonly "$@" "$1" export sed echo local
+	echo $(pwd) --verbose --verbose export sed "$1" -eu x=1 local
+x=1 cd echo && x=1 /usr/bin | -eu grep then readonly
+cd "$1" local grep test echo ${HOME}
+'quoted text' echo "$1" /usr/bin 'quoted text' local /usr/bin
+local echo -eu 2>/dev/null && done "$1" x=1 grep && && readonly 'quoted text'
+		echo test --verbose done echo
+	done then /usr/bin "$@" done $(pwd) done done --verbose | done export "$1"
+	grep -eu cd readonly x=1 readonly grep test
+		test 'quoted text' test test -eu cd ${HOME} 2>/dev/null --verbose sed awk
+		-eu "$@" printf -eu done x=1
+&& $(pwd) test | test then
+&& 2>/dev/null awk sed --verbose
+		done local local awk 'quoted text' && local && "$1" "$@" 'quoted text'
+	&& grep ${HOME} && | && /usr/bin
+		then readonly --verbose --verbose readonly
+$(pwd) sed sed printf awk 2>/dev/null --verbose && x=1 && export $(pwd)
+		--verbose then grep cd printf sed sed export done
+	then then printf export readonly readonly
+x=1 ${HOME} then export
+		'quoted text' printf | test && --verbose "$1"
+-eu local --verbose /usr/bin export
+		done x=1 cd export readonly then printf awk "$@" -eu export
+readonly test readonly readonly printf x=1 readonly
+		-eu grep local && | "$1" /usr/bin sed | -eu
+grep ${HOME} "$1" 'quoted text' /usr/bin 2>/dev/null awk 2>/dev/null 2>/dev/null
+	2>/dev/null -eu "$1" /usr/bin readonly /usr/bin
+	| grep readonly printf --verbose export awk echo $(pwd) echo x=1
+		echo $(pwd) "$@" | -eu /usr/bin
+cd 2>/dev/null printf awk /usr/bin -eu cd
+| "$@" then done --verbose awk --verbose echo grep ${HOME}
+		"$1" | echo echo --verbose printf x=1 "$@"
+		/usr/bin /usr/bin echo cd grep $(pwd) | done readonly cd | export
+		'quoted text' -eu sed local sed --verbose test grep $(pwd)
+	x=1 && sed sed echo | /usr/bin | 2>/dev/null
+2>/dev/null -eu --verbose 'quoted text' ${HOME}
+		export echo done then printf cd 2>/dev/null then "$1" ${HOME} readonly
+-eu then awk $(pwd) grep test /usr/bin "$@" 2>/dev/null grep /usr/bin readonly
+	| printf /usr/bin --verbose awk 'quoted text' echo x=1 cd x=1 readonly readonly
+-eu printf /usr/bin /usr/bin done ${HOME} $(pwd) test
+"$@" "$1" local grep sed $(pwd) local "$1" | printf
+		grep /usr/bin grep "$1" 'quoted text'
+	cd awk awk printf $(pwd) printf -eu 2>/dev/null awk --verbose echo
+	| printf sed done 2>/dev/null export $(pwd) /usr/bin grep grep awk && -eu local
+awk awk export 'quoted text' x=1 2>/dev/null export -eu 'quoted text' awk $(pwd)
+		| echo x=1 x=1 | done awk sed -eu cd printf "$1" test 2>/dev/null --verbose
+	awk --verbose --verbose done
+		2>/dev/null readonly "$@"
+/usr/bin done "$@" then printf done /usr/bin export
+		awk $(pwd) sed grep awk grep 2>/dev/null
+		2>/dev/null test readonly 2>/dev/null
+		printf sed then -eu 'quoted text' $(pwd) then -eu && export
+	awk /usr/bin export --verbose "$1" sed awk
+	| then $(pwd) printf sed local &&
+&& test local done x=1 "$1" test "$1" $(pwd) readonly echo grep
+	&& | sed | echo test awk "$@" $(pwd) cd x=1 $(pwd) cd
+	/usr/bin && /usr/bin sed printf 2>/dev/null echo /usr/bin sed readonly
+/usr/bin then cd | export | cd readonly ${HOME} then awk awk "$@" export
+x=1 awk ${HOME} echo --verbose
+		&& done done 2>/dev/null local | --verbose then
+		2>/dev/null x=1 | && "$1" readonly readonly echo /usr/bin cd done
+		"$1" local awk export sed "$@" awk done
+		test && --verbose | && 'quoted text'
+		${HOME} local echo readonly export then cd
+echo printf "$@" /usr/bin cd "$@"
+		-eu then test "$@" --verbose cd printf | cd 2>/dev/null -eu test then done then
+		done ${HOME} 2>/dev/null -eu x=1 /usr/bin
+		readonly -eu $(pwd) -eu awk local "$1" awk | /usr/bin export then | awk printf
+done /usr/bin -eu then printf readonly "$@" --verbose awk "$1" $(pwd)
+readonly local readonly ${HOME} --verbose readonly "$@"
+awk x=1 $(pwd) 2>/dev/null awk local test $(pwd) 2>/dev/null export $(pwd) echo
+	test $(pwd) 'quoted text' $(pwd) | "$1" cd done
+x=1 test ${HOME} export | | printf 'quoted text' -eu printf
+x=1 cd $(pwd) awk | && readonly sed echo | grep 2>/dev/null "$1"
+&& ${HOME} test sed awk sed awk 2>/dev/null export x=1 awk awk 2>/dev/null awk
+${HOME} done "$1" awk ${HOME} | $(pwd) grep cd readonly
+		cd "$@" sed echo sed ${HOME} readonly ${HOME}
+		sed test test && local sed printf /usr/bin readonly "$1" export --verbose
+		grep export test "$@" then | 'quoted text' x=1 'quoted text' "$@" readonly
+	sed awk 'quoted text' done readonly "$1" echo printf -eu grep 2>/dev/null
+		"$1" --verbose test local
+		sed "$1" cd x=1 grep "$1" then $(pwd)
+done echo echo /usr/bin 2>/dev/null awk && "$1" done "$@" "$@" "$1" | cd
+		&& ${HOME} 2>/dev/null ${HOME} && | cd $(pwd) -eu grep then export $(pwd) | ${HOME}
+		done test 2>/dev/null x=1 echo
+		| && then then export then && 'quoted text' /usr/bin then test --verbose "$1"
+${HOME} -eu && --verbose done echo export "$1" printf $(pwd) grep then &&
+	test then --verbose test 2>/dev/null
+	"$1" && grep x=1 readonly then awk && cd
+	--verbose -eu 'quoted text' sed printf
+	cd | ${HOME} done $(pwd) ${HOME} x=1 then -eu test
+"$1" export printf readonly grep 2>/dev/null -eu x=1 x=1 --verbose
+		-eu /usr/bin readonly --verbose | $(pwd) done then 'quoted text' printf sed
+		-eu readonly readonly x=1 --verbose grep --verbose
+"$1" -eu grep test printf local local printf $(pwd) cd cd 2>/dev/null
+	readonly grep cd printf then
+	&& done echo echo && sed /usr/bin sed then export export ${HOME} "$@" ${HOME} "$@"
+		then 'quoted text' awk grep readonly $(pwd) "$@" export sed
+		sed readonly grep 'quoted text' printf cd "$1" export
+	"$1" "$@" /usr/bin $(pwd) done test sed sed grep awk x=1 $(pwd)
+		x=1 echo ${HOME} 'quoted text' | x=1 sed sed echo printf readonly cd x=1 /usr/bin
+		printf grep $(pwd) 2>/dev/null export x=1 echo | "$@" x=1 2>/dev/null "$@" grep
+		--verbose ${HOME} cd echo readonly then local /usr/bin ${HOME} | "$1"
+	printf --verbose grep local --verbose
+printf "$1" test then then then --verbose test echo done 2>/dev/null /usr/bin
+"$@" test local --verbose $(pwd) test --verbose readonly export
+	local echo -eu test $(pwd) /usr/bin --verbose "$@" 'quoted text' cd sed
+	printf $(pwd) 2>/dev/null sed cd /usr/bin 2>/dev/null /usr/bin then
+x=1 awk | cd cd "$@" --verbose ${HOME}
+	readonly awk && awk "$1" ${HOME} awk 'quoted text' then "$1"
+		'quoted text' $(pwd) "$@" grep done grep test
+		'quoted text' /usr/bin x=1 export test 2>/dev/null export 'quoted text' ${HOME}
+test --verbose /usr/bin echo && local printf cd export /usr/bin grep /usr/bin
+x=1 printf done echo printf readonly ${HOME}
+		then grep echo | sed then test 2>/dev/null -eu test --verbose then 2>/dev/null
+2>/dev/null echo then 'quoted text' "$1" grep x=1 cd $(pwd) test "$1" --verbose
+		printf $(pwd) readonly echo "$@" readonly done -eu | "$@" "$1" -eu -eu
+readonly && sed test cd cd sed
+		/usr/bin 2>/dev/null $(pwd) grep -eu x=1 "$1" local
+	--verbose "$@" /usr/bin printf 'quoted text'
+		export 'quoted text' "$1" export
+	test | 'quoted text' | | printf "$1" test "$1" &&
+	${HOME} -eu /usr/bin "$@" local --verbose
+local done ${HOME} grep 2>/dev/null export sed echo 2>/dev/null $(pwd) 2>/dev/null
+		"$1" sed "$1" | test 2>/dev/null
+	done readonly -eu done readonly ${HOME}
+	done /usr/bin -eu x=1 cd printf printf --verbose "$@" echo 'quoted text'
+		sed x=1 x=1 x=1 -eu && cd ${HOME} echo cd sed ${HOME} awk export
+/usr/bin | "$1" -eu cd cd && x=1 readonly
+&& -eu -eu -eu cd printf 2>/dev/null "$1" test x=1 2>/dev/null readonly
+		$(pwd) -eu && /usr/bin awk -eu x=1 echo "$@"
+cd -eu then x=1 then printf ${HOME} 2>/dev/null "$1" printf
+		x=1 sed 'quoted text' sed
+	export readonly 'quoted text' local printf test printf export
+	grep sed "$@" printf grep 'quoted text' then then awk
+test local then x=1 sed /usr/bin done /usr/bin echo x=1 then 2>/dev/null printf
+x=1 -eu "$@" readonly done
+	-eu sed grep /usr/bin done x=1
+	sed -eu ${HOME} "$@" export /usr/bin then grep 'quoted text'
+	test grep printf export -eu readonly
+	/usr/bin cd readonly awk
+	readonly printf test grep awk local cd /usr/bin grep
+	| sed 2>/dev/null x=1 -eu cd ${HOME} -eu
+		cd x=1 echo local then cd cd x=1 $(pwd) ${HOME}
+"$@" "$@" cd export | local local grep $(pwd) | awk sed test $(pwd) $(pwd) grep
+echo printf --verbose local then --verbose echo then
+	done printf && echo grep "$1" $(pwd) "$@" then grep && test
+then 'quoted text' test export 'quoted text' readonly ${HOME} done 2>/dev/null
+		"$1" -eu | grep done sed x=1 then && 'quoted text' | | grep x=1 -eu test
+cd && x=1 printf then printf && /usr/bin
+		done "$@" export 2>/dev/null
+done 2>/dev/null printf "$1" && grep sed ${HOME} local readonly cd
+echo grep x=1 'quoted text' && test $(pwd) awk grep cd /usr/bin grep
+test 'quoted text' cd && 'quoted text' && /usr/bin 2>/dev/null x=1 $(pwd) awk grep
+"$1" echo readonly "$1" "$@" done grep 'quoted text' cd
+	echo 'quoted text' export echo done cd
+		&& --verbose readonly 'quoted text' ${HOME} cd echo local /usr/bin readonly
+		-eu test echo done readonly
+"$1" cd readonly 'quoted text' sed sed done grep 2>/dev/null
+		grep export x=1 printf sed
+	${HOME} 2>/dev/null 2>/dev/null 2>/dev/null x=1 /usr/bin 'quoted text'
+		--verbose $(pwd) done then grep | grep then "$1" "$1"
+		'quoted text' "$1" echo awk local --verbose x=1 'quoted text' local 'quoted text'
+printf grep ${HOME} /usr/bin
+	$(pwd) cd x=1 awk --verbose
+	grep local then grep ${HOME} --verbose export 2>/dev/null export 2>/dev/null
+	echo cd grep "$@" -eu printf awk done --verbose --verbose 'quoted text'
+	echo done | done test cd awk local 2>/dev/null
+		test test ${HOME} 2>/dev/null /usr/bin then x=1 $(pwd) test done test
+	x=1 $(pwd) echo | --verbose then "$@"
+"$1" printf && --verbose $(pwd) export $(pwd) | $(pwd) grep echo $(pwd) /usr/bin
+printf | readonly "$@" "$@"
+	2>/dev/null echo grep
+	/usr/bin readonly | ${HOME} readonly $(pwd) 2>/dev/null 'quoted text'
+		grep "$@" local test "$1" -eu --verbose echo && cd 2>/dev/null
+		awk 2>/dev/null /usr/bin && | echo $(pwd) -eu
+readonly --verbose local ${HOME} | $(pwd) $(pwd) --verbose
+		$(pwd) then cd && printf export && ${HOME} "$@" grep awk x=1
+	echo /usr/bin local cd -eu -eu x=1 x=1 2>/dev/null 'quoted text'
+		${HOME} ${HOME} && local $(pwd)
+	--verbose echo sed 2>/dev/null | export ${HOME}
+		--verbose --verbose $(pwd) cd grep grep sed test "$1" "$1"
+&& printf ${HOME} done ${HOME}
+	${HOME} sed && done x=1 printf && printf
+	printf local export "$1" sed export "$1" sed
+grep then sed echo -eu cd export
+	"$@" /usr/bin printf -eu echo export done done
+&& x=1 -eu sed x=1 local x=1
+'quoted text' --verbose && grep export
+	2>/dev/null test | awk
+readonly "$1" done "$@" export /usr/bin --verbose && ${HOME} ${HOME} &&
+/usr/bin then then -eu done
+		then done /usr/bin x=1 'quoted text' 2>/dev/null -eu echo -eu
+${HOME} $(pwd) test test
+awk --verbose --verbose done sed --verbose -eu
+	&& | awk --verbose local test
+/usr/bin --verbose x=1 echo grep done -eu "$@" sed 2>/dev/null
+	${HOME} -eu -eu test ${HOME} ${HOME} cd 'quoted text' 2>/dev/null awk | x=1 printf
+		/usr/bin "$1" echo printf && /usr/bin | && "$1" sed
+	then then test x=1 echo /usr/bin "$1" grep awk readonly ${HOME} readonly grep
+		'quoted text' /usr/bin then done then --verbose sed echo cd export "$1" --verbose
+"$@" ${HOME} 'quoted text' /usr/bin ${HOME} && done echo grep "$@" ${HOME}
+		--verbose /usr/bin x=1 done sed x=1 /usr/bin
+		"$@" && "$1" grep sed export export cd $(pwd) -eu "$1" then done awk /usr/bin echo
+	x=1 --verbose then sed sed "$1" export 2>/dev/null --verbose "$1"
+'quoted text' 'quoted text' printf 2>/dev/null -eu $(pwd) done | "$@" $(pwd)
+done done done "$1" test sed 2>/dev/null x=1 --verbose printf awk 'quoted text'
+/usr/bin printf awk "$@" "$@" test export "$1" readonly readonly grep ${HOME}
+grep echo 2>/dev/null done then echo && x=1 done awk && /usr/bin cd
+		"$@" --verbose cd --verbose /usr/bin
+"$@" /usr/bin local 'quoted text' 'quoted text'
+		readonly export then | 2>/dev/null grep done
+		readonly $(pwd) $(pwd) readonly /usr/bin grep
+	echo awk 'quoted text' local
+	2>/dev/null x=1 printf awk "$1"
+		2>/dev/null readonly 2>/dev/null -eu -eu export printf "$@" grep cd 'quoted text'
+		printf cd ${HOME} sed grep
+test | echo -eu && 'quoted text' printf
+		"$@" "$1" cd --verbose 'quoted text' then | && /usr/bin export
+		'quoted text' then readonly readonly 'quoted text' | cd --verbose && ${HOME}
+		'quoted text' printf done then /usr/bin done local /usr/bin
+printf --verbose 'quoted text' done -eu readonly
+	grep done awk /usr/bin -eu local awk
+		export done cd "$1" /usr/bin export ${HOME} printf awk
+	grep 'quoted text' x=1 "$@" -eu test "$@" done printf ${HOME} -eu
+		&& -eu awk 'quoted text' printf test then
+	${HOME} && /usr/bin -eu sed /usr/bin && cd && ${HOME} ${HOME}
+		awk /usr/bin ${HOME} awk echo cd awk /usr/bin cd cd cd readonly
+test | 'quoted text' echo "$1"
+local awk export | readonly /usr/bin | then awk test /usr/bin "$1" --verbose
+printf echo 2>/dev/null local 'quoted text' "$1" then done
+		&& test readonly export sed echo awk test
+		'quoted text' then -eu sed echo test
+	| x=1 cd -eu echo "$1" done sed "$1" then test done "$1"
+		--verbose 2>/dev/null "$@" grep then
+printf cd echo cd local test 'quoted text' "$@" grep cd ${HOME} "$1" "$1" -eu
+	then echo awk x=1 && grep export
+grep --verbose "$@" $(pwd) sed grep
+	then printf 'quoted text' done && $(pwd) done test x=1 /usr/bin then && test
+		sed ${HOME} export cd ${HOME} && printf -eu ${HOME} done
+		"$1" then test 2>/dev/null ${HOME} x=1 local printf ${HOME} done grep
+		| x=1 then export 2>/dev/null echo sed echo
+	"$@" && "$@" test local echo | $(pwd) done $(pwd)
+	"$@" sed local $(pwd) test $(pwd) printf x=1 2>/dev/null
+	| readonly cd --verbose && "$1" -eu x=1 readonly
+	printf then x=1 echo printf
+		done "$1" ${HOME} cd export then export cd ${HOME} done ${HOME}
+	then echo echo local export x=1 readonly local done export then awk
+		x=1 cd test sed cd && printf $(pwd) /usr/bin $(pwd) 'quoted text'
+"$@" ${HOME} local printf echo ${HOME} done done
+	local awk readonly cd "$1" test readonly export 'quoted text' |
+	"$1" readonly "$1" echo
+	&& -eu -eu | 'quoted text' awk
+	2>/dev/null | $(pwd) readonly | local readonly
+"$@" export --verbose ${HOME} x=1 x=1
+export echo echo sed "$@" printf && cd sed /usr/bin test "$1"
+		cd -eu cd export ${HOME} "$1" test ${HOME} 2>/dev/null "$@" $(pwd)
+	local "$@" export printf done 2>/dev/null
+		printf done "$@" --verbose local
+	/usr/bin && ${HOME} | --verbose | ${HOME}
+awk "$@" --verbose $(pwd) cd
+	'quoted text' readonly export "$1" printf 2>/dev/null 'quoted text'
+test grep "$1" x=1 echo "$1" --verbose awk ${HOME} && | local
+"$1" --verbose x=1 readonly test "$@" local 2>/dev/null -eu test local printf
+	/usr/bin grep "$1" 2>/dev/null
+local /usr/bin x=1 2>/dev/null readonly awk ${HOME} 2>/dev/null
+cd ${HOME} 2>/dev/null awk done 2>/dev/null
+	sed cd x=1 cd done done readonly local $(pwd) /usr/bin -eu local 2>/dev/null local
+		$(pwd) "$1" printf cd | cd readonly --verbose export cd | test /usr/bin
+		grep 'quoted text' grep --verbose
+	local ${HOME} cd export then test readonly $(pwd) ${HOME} x=1 $(pwd)
+	/usr/bin cd $(pwd) 2>/dev/null | awk readonly "$1" /usr/bin readonly sed
+		'quoted text' $(pwd) --verbose local --verbose "$@" readonly sed
+		then /usr/bin export $(pwd) awk /usr/bin "$@" &&
+		x=1 then --verbose grep $(pwd) echo "$@" sed | $(pwd) sed $(pwd)
+--verbose awk "$1" 'quoted text' "$1" done cd cd 'quoted text'
+		then export -eu -eu done
+		--verbose test readonly x=1 'quoted text' local
+local then x=1 sed printf local 'quoted text'
+${HOME} test ${HOME} test local test x=1 'quoted text' local
+export sed $(pwd) -eu awk export | ${HOME} "$1" | grep local local then test
+	"$@" 2>/dev/null ${HOME} 2>/dev/null
+	"$1" --verbose awk "$1" readonly
+		-eu test local local awk 'quoted text' 2>/dev/null grep x=1 -eu "$1" "$@" then
+2>/dev/null echo test | "$@" 'quoted text'
+	done | x=1 --verbose sed cd
+		then "$1" cd && "$1" 'quoted text' 'quoted text'
+x=1 printf -eu "$@" awk awk 'quoted text'
+printf sed $(pwd) then then
+		printf /usr/bin cd 'quoted text' cd local x=1 | test echo then -eu $(pwd)
+		echo test cd grep "$@"
+-eu echo awk done 2>/dev/null | echo --verbose printf then echo test sed
+"$1" cd awk /usr/bin export
+cd "$1" echo then then | printf x=1 && /usr/bin "$1" | then
+	x=1 awk awk then /usr/bin awk
+		'quoted text' readonly x=1 awk
+		-eu cd 'quoted text' echo x=1
+done then /usr/bin --verbose export test x=1 readonly
+	${HOME} $(pwd) test "$@" "$@" done
+		2>/dev/null cd /usr/bin then grep | "$@" awk $(pwd) 'quoted text'
+		x=1 | && && then /usr/bin $(pwd) "$1" /usr/bin --verbose awk && "$1" "$@"
+	'quoted text' export "$@" 'quoted text' "$1" x=1 $(pwd)
+		${HOME} done ${HOME} 2>/dev/null readonly
+	"$@" $(pwd) 'quoted text' ${HOME} | ${HOME} then /usr/bin done cd cd /usr/bin
+grep export --verbose local -eu grep x=1 2>/dev/null test 2>/dev/null
+		"$@" "$@" echo done sed test test --verbose awk readonly grep 'quoted text' --verbose
+&& sed then local export test /usr/bin
+test $(pwd) 2>/dev/null awk cd local cd echo "$@" $(pwd) then
+"$1" && test sed "$1" done "$1" --verbose && then local 'quoted text'
+	$(pwd) awk done "$@" && --verbose sed x=1 --verbose
+	'quoted text' "$1" $(pwd) readonly echo "$1" local printf
+		then local printf local ${HOME} cd "$1" /usr/bin -eu
+		| "$1" then "$1" --verbose test 2>/dev/null awk | cd -eu /usr/bin 'quoted text'
+local && ${HOME} 'quoted text'
+		grep test grep readonly 'quoted text' printf printf local then -eu 'quoted text'
+	&& local then /usr/bin "$1" readonly x=1 sed x=1 sed
+	done $(pwd) ${HOME} awk
+	then echo grep ${HOME}
+grep done $(pwd) cd sed "$1" then readonly printf test echo
+	"$@" "$1" "$1" done printf local 2>/dev/null ${HOME} x=1 readonly
+		'quoted text' x=1 readonly | sed 'quoted text'
+		then -eu cd 2>/dev/null awk $(pwd) then ${HOME}
+		grep sed sed /usr/bin "$@" x=1 awk export x=1 | local --verbose ${HOME} && test
+		test local ${HOME} ${HOME} x=1 -eu /usr/bin sed --verbose sed echo && grep then
+		export "$@" export grep then $(pwd) -eu $(pwd) export 'quoted text'
+		&& "$@" | ${HOME} echo | cd -eu sed 2>/dev/null local /usr/bin $(pwd)
+test x=1 -eu | /usr/bin && "$1" $(pwd)
+		| && --verbose printf readonly done echo
+cd x=1 done sed x=1 -eu echo printf x=1
+	export cd /usr/bin && echo ${HOME}
+	$(pwd) --verbose "$@" grep grep
+		sed ${HOME} && test -eu "$@" export cd done -eu && export
+	&& "$1" "$1" "$@" 'quoted text'
+	export "$@" test done "$@" awk printf awk
+	local -eu awk "$@" $(pwd) printf
+'quoted text' && local ${HOME} 2>/dev/null done local sed ${HOME} sed x=1 grep
+	x=1 awk "$1" $(pwd) /usr/bin "$1" --verbose test /usr/bin then
+	$(pwd) sed "$@" -eu 2>/dev/null printf /usr/bin 2>/dev/null
+printf then 2>/dev/null $(pwd)
+	sed "$@" 'quoted text' x=1 x=1 | $(pwd)
+grep printf ${HOME} grep -eu -eu then echo printf export
+-eu 'quoted text' export 'quoted text'
+	${HOME} local ${HOME}
+		readonly | -eu && then "$@" "$1" "$@" done grep | /usr/bin
+$(pwd) awk "$1" cd 'quoted text' ${HOME} && x=1 /usr/bin "$1" readonly
+-eu readonly "$1" $(pwd)
+$(pwd) then then "$1" local done $(pwd) echo
+		${HOME} local "$@" cd /usr/bin grep
+	-eu then && --verbose x=1 $(pwd) ${HOME} $(pwd) 'quoted text'
+	local $(pwd) then readonly
+	x=1 "$1" readonly printf 2>/dev/null
+	echo done $(pwd) -eu test x=1 echo grep test -eu cd ${HOME} $(pwd)
+	'quoted text' 2>/dev/null printf --verbose $(pwd) export
+	--verbose echo echo /usr/bin $(pwd) cd 2>/dev/null grep /usr/bin
+"$@" local $(pwd) "$@" awk grep awk sed test 2>/dev/null
+readonly /usr/bin 2>/dev/null x=1
+${HOME} $(pwd) test /usr/bin sed ${HOME} && 'quoted text'
+	test grep readonly x=1 x=1
+echo cd test 2>/dev/null readonly 'quoted text' && 'quoted text'
+&& x=1 then local printf /usr/bin test local readonly done "$1" awk readonly export
+	grep "$@" grep $(pwd) $(pwd) ${HOME} | echo cd "$1" | | printf ${HOME}
+		&& export 2>/dev/null 'quoted text' echo | sed then "$1" --verbose sed readonly
+awk local test --verbose | grep test --verbose -eu cd sed --verbose 2>/dev/null
+	--verbose cd cd 'quoted text' then
+	&& | grep printf printf /usr/bin then
+	x=1 test -eu ${HOME} readonly /usr/bin "$@" readonly cd local
+grep then 2>/dev/null sed -eu readonly then done test local printf /usr/bin
+		"$@" cd "$@" done local 'quoted text' printf done echo "$1" $(pwd) 2>/dev/null
+${HOME} "$1" $(pwd) local
+"$@" grep /usr/bin ${HOME}
+	/usr/bin test "$@" awk readonly
+/usr/bin 'quoted text' ${HOME}
+	readonly "$@" test --verbose
+		done && local ${HOME} x=1 then awk printf -eu ${HOME} $(pwd) test test x=1 cd $(pwd)
+		sed /usr/bin --verbose | "$@" printf awk printf 2>/dev/null && test
+	x=1 cd grep printf awk readonly
+		"$1" then printf "$1" x=1 'quoted text' done
+	cd | "$@" ${HOME} /usr/bin cd echo cd | | x=1 $(pwd)
+		2>/dev/null --verbose grep
+		&& 2>/dev/null && then "$@" 'quoted text' done readonly
+		--verbose $(pwd) grep printf export ${HOME} $(pwd) 'quoted text' && cd 2>/dev/null
+	"$1" && | /usr/bin "$1" cd $(pwd) x=1 $(pwd) echo sed then && "$1" local -eu sed
+	cd export "$@" awk awk 2>/dev/null --verbose /usr/bin $(pwd)
+-eu | readonly export done readonly $(pwd) then local --verbose
+/usr/bin --verbose echo 2>/dev/null
+	echo cd local ${HOME} && grep 2>/dev/null && "$@" /usr/bin
+	--verbose done test export "$@" printf
+	export $(pwd) sed -eu "$@" "$@"
+$(pwd) 'quoted text' awk cd -eu $(pwd) done && sed $(pwd)
+		$(pwd) readonly sed then -eu && 'quoted text'
+/usr/bin test --verbose export ${HOME} &&
+	grep 2>/dev/null "$1" echo $(pwd) then --verbose
+readonly then grep printf test awk "$@" /usr/bin sed 'quoted text'
+		2>/dev/null 2>/dev/null export test
+		grep 'quoted text' -eu test printf -eu 2>/dev/null -eu then
+awk done /usr/bin then "$1" 2>/dev/null
+printf ${HOME} then echo readonly printf export
+/usr/bin "$1" sed 'quoted text' "$@" grep | local
+grep test ${HOME} export then grep "$@" $(pwd) test --verbose
+		"$1" --verbose /usr/bin --verbose printf
+	-eu awk 'quoted text' export 'quoted text' awk sed | && "$1" "$@"
+		readonly -eu ${HOME} ${HOME} | sed
+	then sed "$@" -eu "$@" | local 'quoted text'
+	"$@" test ${HOME} --verbose "$@" grep
+		&& -eu awk local printf then export
+		local -eu -eu readonly grep | awk readonly
+		awk /usr/bin -eu 'quoted text' 'quoted text' cd | awk x=1
+		x=1 local 2>/dev/null --verbose
+cd cd 2>/dev/null ${HOME} test 'quoted text' then && -eu local | awk
+done readonly 'quoted text' "$1" 'quoted text' "$1" test printf "$1" awk local
+		"$@" test echo 'quoted text' 2>/dev/null /usr/bin readonly x=1 echo export
+		awk 'quoted text' "$@" && "$@" cd | printf |
+${HOME} $(pwd) echo && local
+		readonly awk awk | | printf /usr/bin readonly grep "$1"
+		cd cd 2>/dev/null -eu export /usr/bin printf cd awk sed x=1 -eu && ${HOME}
+		"$@" cd 'quoted text' awk && then /usr/bin
+		done --verbose readonly sed /usr/bin $(pwd) awk
+		'quoted text' 'quoted text' -eu ${HOME} x=1
+sed "$@" $(pwd) local grep local $(pwd) cd echo echo "$1" test
+	-eu ${HOME} "$1" x=1 sed "$@"
+	&& cd printf echo 2>/dev/null export $(pwd)
+	2>/dev/null "$@" awk test -eu | grep "$1" echo cd test export $(pwd)
+grep 'quoted text' /usr/bin then then
+	done && /usr/bin printf test then echo then 'quoted text' local then
+"$1" printf /usr/bin $(pwd) export | /usr/bin --verbose then then && export
+cd x=1 printf /usr/bin /usr/bin awk test local ${HOME} sed readonly && 'quoted text'
+"$1" $(pwd) /usr/bin cd 2>/dev/null done done then /usr/bin
+/usr/bin local grep x=1 | echo grep done | 'quoted text'
+		sed && sed local /usr/bin cd
+	test export printf -eu --verbose readonly
+grep grep "$1" cd 'quoted text' grep local ${HOME} /usr/bin export
+		&& export readonly 2>/dev/null
+$(pwd) x=1 export export awk x=1 local x=1
+		done $(pwd) "$1" $(pwd) local $(pwd) cd sed then && sed cd readonly /usr/bin test
+		sed ${HOME} -eu test export grep $(pwd) echo ${HOME} | awk test $(pwd)
+done readonly local | "$1" readonly --verbose cd
+		readonly --verbose -eu $(pwd) readonly
+	readonly sed ${HOME} | awk x=1 -eu printf && local 'quoted text'
+	"$@" 2>/dev/null | --verbose 'quoted text' then "$1" readonly grep
+grep echo 2>/dev/null && --verbose
+		readonly local $(pwd) 2>/dev/null done then test ${HOME} -eu -eu 2>/dev/null
+	$(pwd) 2>/dev/null awk |
+		done /usr/bin --verbose sed echo /usr/bin --verbose -eu local | /usr/bin
+local readonly test export ${HOME} "$1" ${HOME}
+		readonly export ${HOME}
+	awk $(pwd) $(pwd) x=1 readonly sed cd /usr/bin awk awk sed /usr/bin
+	$(pwd) awk --verbose "$@"
+"$@" test export 'quoted text'
+	/usr/bin awk $(pwd) ${HOME} 2>/dev/null
+$(pwd) printf ${HOME} 2>/dev/null test "$1" local --verbose /usr/bin
+		cd grep ${HOME} cd 'quoted text' sed ${HOME} "$@" /usr/bin $(pwd) grep echo
+grep 2>/dev/null test cd test grep test "$1" x=1 printf | echo | sed cd sed
+"$1" "$@" -eu | x=1 -eu export printf cd test 'quoted text' test
+/usr/bin sed $(pwd) test
+	echo "$1" sed export "$@" test
+	x=1 done "$1" "$@" awk printf readonly export /usr/bin --verbose -eu x=1 done
+	cd --verbose $(pwd) | $(pwd) sed $(pwd)
+	awk readonly x=1 cd done
+		readonly x=1 /usr/bin /usr/bin
+		${HOME} "$1" export readonly then $(pwd) 2>/dev/null
+		readonly "$@" ${HOME} local echo && printf "$@"
+x=1 cd -eu test && /usr/bin printf $(pwd)
+export export "$@" x=1 x=1
+then -eu awk readonly 'quoted text'
+awk --verbose --verbose "$1" grep ${HOME} x=1 | 2>/dev/null
+export grep grep | 'quoted text' sed $(pwd) awk local sed printf
+	printf readonly cd $(pwd) local $(pwd) echo cd x=1
+		printf test awk awk -eu
+		echo -eu "$1" grep -eu local -eu 'quoted text'
+		| | printf 'quoted text' 'quoted text'
+		2>/dev/null then "$@" /usr/bin
+	x=1 export 2>/dev/null awk
+export then -eu local sed cd /usr/bin 2>/dev/null | echo cd /usr/bin awk
+		test local export awk grep 'quoted text' cd && printf
+	--verbose awk export readonly ${HOME} /usr/bin
+		test /usr/bin awk x=1 ${HOME} echo done /usr/bin export ${HOME} 'quoted text'
+	"$@" local then local 2>/dev/null awk && export "$@" then
+	${HOME} "$1" -eu | $(pwd)
+	test ${HOME} echo /usr/bin | test export 2>/dev/null "$@" export | grep local 'quoted text'
+		local ${HOME} ${HOME} $(pwd) x=1
+x=1 && ${HOME} 'quoted text' printf
+	&& awk local 2>/dev/null "$@" then
+	done sed printf cd "$@" | && local awk --verbose grep
+	cd cd "$@" --verbose x=1 done done && /usr/bin
+		local "$1" | x=1 done x=1
+local $(pwd) "$1" printf "$@" then sed -eu /usr/bin 2>/dev/null
+		readonly /usr/bin --verbose /usr/bin ${HOME} test --verbose x=1 x=1 grep --verbose
+	export "$@" sed ${HOME} readonly /usr/bin echo && done 2>/dev/null $(pwd) then
+		'quoted text' test grep && echo echo printf "$@"
+	'quoted text' readonly 'quoted text' "$1" awk --verbose then
+		sed && grep "$@" $(pwd) $(pwd) echo then | 2>/dev/null $(pwd) export then x=1
+		| done 2>/dev/null $(pwd) readonly echo grep export && ${HOME} awk
+		"$@" sed "$@" /usr/bin echo 2>/dev/null done /usr/bin && && printf -eu "$1" export
+	printf "$1" readonly then | $(pwd) grep && test "$1" 2>/dev/null ${HOME}
+	sed && readonly sed local then test "$@" ${HOME} awk
+--verbose 2>/dev/null --verbose test done
+	readonly ${HOME} -eu sed 'quoted text' $(pwd) -eu test
+done "$@" | test -eu test grep echo -eu "$@" cd "$@" readonly readonly
+		readonly done -eu local /usr/bin && x=1 "$1" ${HOME} export "$@"
+	export export export "$1" echo then "$1" local then export | local "$1"
+		&& "$1" readonly export done x=1 grep
+'quoted text' sed x=1 ${HOME} cd "$1" | ${HOME} test readonly then -eu 2>/dev/null
+x=1 "$@" x=1 local echo sed
+	grep --verbose 'quoted text'
+		test done test /usr/bin x=1 done
+		x=1 --verbose ${HOME}
+	| cd readonly ${HOME} -eu test "$1" sed 2>/dev/null
+		x=1 sed then ${HOME} 'quoted text' printf then done -eu ${HOME} readonly
+	"$@" "$@" then ${HOME} x=1 2>/dev/null "$@"
+grep ${HOME} && echo "$@" done 'quoted text' 'quoted text' /usr/bin
+/usr/bin x=1 "$@" cd sed "$1" done then $(pwd) | && --verbose
+	test grep x=1 -eu && printf "$@" echo 'quoted text' sed awk "$@"
+2>/dev/null then --verbose $(pwd)
+	--verbose done done grep x=1 "$@" readonly awk -eu 2>/dev/null
+	&& echo sed && sed && "$@" 2>/dev/null readonly
+	readonly 'quoted text' cd grep
+		-eu /usr/bin test done x=1 'quoted text' ${HOME} sed "$@" then
+		echo grep $(pwd) ${HOME} local echo readonly
+	echo local --verbose printf 2>/dev/null echo -eu done grep | 2>/dev/null &&
+	local 2>/dev/null export /usr/bin $(pwd)
+		/usr/bin && local ${HOME} /usr/bin /usr/bin $(pwd) local "$@" done | ${HOME}
+		&& then readonly /usr/bin test $(pwd) -eu "$1" 2>/dev/null readonly
+	readonly printf 2>/dev/null sed "$@" export "$@" cd 'quoted text'
+		awk local "$@" sed cd -eu local $(pwd) /usr/bin local printf printf grep echo
+	--verbose -eu "$@" grep && then test && ${HOME} "$@" ${HOME} local
+		test awk --verbose 2>/dev/null -eu | local
+		| -eu test export awk local | then
+	--verbose printf x=1 printf grep test x=1 | export
+grep done printf && "$@" echo 'quoted text'
+| sed /usr/bin test /usr/bin 'quoted text' grep
+		"$@" $(pwd) export && -eu && "$1" "$@"
+| x=1 cd "$1" done then x=1 readonly
+	cd grep export printf export sed then sed $(pwd) 'quoted text' awk echo grep
+		2>/dev/null echo /usr/bin
+printf 2>/dev/null /usr/bin
+	"$1" $(pwd) 'quoted text' $(pwd) $(pwd) echo x=1 "$@" /usr/bin
+		awk export awk /usr/bin done $(pwd) -eu $(pwd) local
+${HOME} sed ${HOME} local export local x=1 done 'quoted text' echo awk cd "$1"
+test printf | | "$1" sed cd test 'quoted text' "$1" local ${HOME} | x=1
+	"$1" 'quoted text' x=1 done ${HOME}
+cd && local --verbose sed && | then grep
+echo ${HOME} && echo test echo test
+	cd "$@" readonly done --verbose then export grep local then printf
+--verbose --verbose awk printf export cd | export cd -eu
+sed readonly awk $(pwd) --verbose
+	done cd local printf 2>/dev/null
+${HOME} awk "$1" 'quoted text'
+	&& done grep then 'quoted text' local | cd
+&& x=1 "$@" x=1 "$@" awk /usr/bin --verbose then local
+awk grep -eu ${HOME} 2>/dev/null $(pwd) done printf readonly -eu printf && cd awk
+		sed "$@" test sed export -eu --verbose
+'quoted text' /usr/bin 2>/dev/null
+	echo export $(pwd) cd echo awk sed 'quoted text' 'quoted text' "$@" 2>/dev/null
+	awk cd test $(pwd) "$1" 2>/dev/null /usr/bin then export
+	'quoted text' "$1" 'quoted text' 2>/dev/null x=1 sed sed export
+		sed test cd sed ${HOME} awk done x=1 echo test awk local ${HOME} ${HOME}
+'quoted text' export awk "$@" --verbose | 2>/dev/null --verbose
+		--verbose --verbose $(pwd) readonly awk readonly then local export /usr/bin
+		$(pwd) grep "$1" -eu "$1" test 2>/dev/null
+echo export echo 'quoted text' awk $(pwd) x=1
+echo done cd sed readonly cd && "$1" cd 2>/dev/null grep then --verbose
+		cd x=1 done test then local 'quoted text' $(pwd) test awk done
+printf $(pwd) awk awk then echo 2>/dev/null then "$1"
+	--verbose 2>/dev/null "$@" -eu then local cd test sed /usr/bin 'quoted text'
+$(pwd) echo "$@" done readonly then | export
+	echo | "$@" test | readonly ${HOME} echo
+	readonly printf grep echo then done "$@" 2>/dev/null
+printf then x=1 ${HOME} &&
+		'quoted text' export "$1" export export && grep
+	readonly sed "$@" x=1 cd -eu sed done printf grep -eu done readonly
+export test sed ${HOME} local printf /usr/bin
+	then export cd grep "$@" export 2>/dev/null local &&
+grep printf readonly readonly export readonly grep then local
+		$(pwd) ${HOME} test sed then x=1 cd local --verbose sed /usr/bin
+	--verbose | awk 2>/dev/null
+	$(pwd) /usr/bin local x=1 export -eu 2>/dev/null
+	/usr/bin -eu echo echo 2>/dev/null --verbose readonly
+	cd ${HOME} 'quoted text' && --verbose grep
+$(pwd) export then -eu 'quoted text' /usr/bin x=1
+	'quoted text' x=1 cd --verbose /usr/bin $(pwd) $(pwd) ${HOME} readonly cd sed
+		done readonly -eu cd done test "$1" -eu awk 2>/dev/null /usr/bin
+-eu echo test export /usr/bin | -eu grep 2>/dev/null
+	x=1 --verbose done printf x=1
+awk printf then --verbose
+		"$@" test awk ${HOME}
+	-eu awk echo export --verbose "$@" "$@" 2>/dev/null then $(pwd) -eu x=1
+	export "$1" ${HOME} readonly export grep
+		printf export -eu "$1" -eu -eu sed
+"$@" -eu --verbose 'quoted text'
+echo readonly export --verbose printf $(pwd)
+	$(pwd) echo /usr/bin readonly --verbose awk ${HOME} $(pwd) local x=1
+test | "$@" /usr/bin done -eu awk test ${HOME} printf
+printf --verbose $(pwd) cd done -eu && test "$@"
+	awk grep done ${HOME} 2>/dev/null "$1" && | export x=1 /usr/bin
+		${HOME} "$1" -eu awk done readonly /usr/bin readonly local | --verbose
+		then x=1 grep printf export 2>/dev/null "$@"
+&& grep export readonly $(pwd) x=1 awk local then grep sed 'quoted text'
+$(pwd) echo ${HOME} awk 'quoted text' then sed sed sed awk
+$(pwd) awk 2>/dev/null local 2>/dev/null printf x=1 && printf awk readonly
+	local export x=1 export x=1 --verbose x=1 then grep "$@"
+test printf then export sed /usr/bin awk grep export
+	-eu sed 'quoted text' --verbose readonly 2>/dev/null grep export
+		printf readonly | printf 'quoted text'
+		then ${HOME} -eu 'quoted text' echo "$1"
+${HOME} 'quoted text' --verbose cd then -eu ${HOME} local /usr/bin printf done
+	x=1 2>/dev/null ${HOME}
+	readonly "$1" printf 'quoted text'
+		x=1 sed --verbose x=1 x=1 && 2>/dev/null grep sed
+done export export && cd | "$1" then x=1 ${HOME} cd export
+		cd -eu cd 2>/dev/null export /usr/bin ${HOME}
+		${HOME} done then sed grep x=1 "$@" echo x=1 /usr/bin done printf
+echo echo awk cd cd sed awk grep then cd "$1" "$@" /usr/bin then test
+		| /usr/bin && readonly test "$@" export -eu /usr/bin
+grep test then $(pwd) 2>/dev/null
+	grep | cd -eu printf local --verbose
+cd then local -eu "$1" then $(pwd) 2>/dev/null
+	test echo --verbose ${HOME} awk "$1" sed
+	${HOME} test cd x=1 x=1 $(pwd) sed cd done ${HOME} --verbose | "$1"
+'quoted text' export awk 2>/dev/null
+	&& --verbose cd | cd ${HOME} $(pwd) export then done -eu readonly $(pwd) $(pwd)
+--verbose && "$@" -eu | 2>/dev/null awk local ${HOME} ${HOME}
+	/usr/bin && then done awk sed sed
+		--verbose cd grep x=1 local ${HOME} grep test grep echo done $(pwd)
+&& | echo --verbose ${HOME} | "$@"
+done awk then printf && -eu echo
+	"$1" sed ${HOME} done x=1 awk $(pwd) sed ${HOME} /usr/bin
+	$(pwd) printf /usr/bin -eu grep then "$@" sed /usr/bin -eu "$@" cd x=1 then
+		'quoted text' $(pwd) ${HOME} --verbose 'quoted text' cd grep test --verbose
+	export done "$1" printf readonly then export "$@" sed grep sed echo | then $(pwd)
+		| --verbose local ${HOME} 2>/dev/null x=1 $(pwd) awk $(pwd)
+		| done export $(pwd) 2>/dev/null ${HOME} cd --verbose
+	-eu done | ${HOME} $(pwd) "$1" ${HOME} 'quoted text' done --verbose $(pwd) --verbose
+	x=1 x=1 ${HOME} sed then $(pwd) "$1" --verbose
+	"$1" | 'quoted text' sed 'quoted text' then x=1 awk cd
+	local "$1" /usr/bin cd export cd cd "$1" export awk
+$(pwd) $(pwd) export awk printf then
+local 2>/dev/null awk printf local "$@" done "$@" awk 2>/dev/null awk
+		$(pwd) export "$1" awk /usr/bin grep "$@" done echo sed grep "$1" test
+	test "$1" cd "$1" then local test x=1 && $(pwd) 2>/dev/null sed 'quoted text'
+		x=1 x=1 test 'quoted text' $(pwd) export /usr/bin
+		cd echo "$@" -eu --verbose 'quoted text' x=1 && export
+	'quoted text' | ${HOME} readonly test 'quoted text' 2>/dev/null x=1 local
+'quoted text' export printf awk --verbose 'quoted text'
+then && /usr/bin test "$1" | printf printf /usr/bin "$@" /usr/bin then /usr/bin
+	"$1" grep cd "$1" 2>/dev/null -eu cd export cd
+	printf 'quoted text' then x=1 "$1" printf -eu -eu printf
+		export ${HOME} | done ${HOME} 2>/dev/null cd test export
+	--verbose -eu sed sed awk $(pwd) ${HOME} awk done ${HOME} done sed grep 'quoted text'
+${HOME} | 2>/dev/null | && then "$1" /usr/bin 2>/dev/null 'quoted text'
+export echo "$1" readonly 2>/dev/null
+		cd printf export then cd sed printf sed ${HOME} printf readonly printf
+		cd $(pwd) echo 2>/dev/null x=1 x=1 --verbose export /usr/bin
+		${HOME} readonly -eu /usr/bin printf 2>/dev/null
+	awk --verbose && echo sed awk test ${HOME} /usr/bin done
+	then x=1 export cd 2>/dev/null then 'quoted text' printf ${HOME} -eu $(pwd)
+cd ${HOME} test cd readonly $(pwd) "$1"
+&& test test grep /usr/bin local echo export --verbose
+--verbose readonly $(pwd) ${HOME} grep --verbose -eu
+	sed && && | sed readonly
+	x=1 done readonly | done done -eu sed awk test --verbose --verbose
+"$@" awk done "$1" /usr/bin 2>/dev/null
+	grep /usr/bin readonly readonly | printf $(pwd)
+		test sed -eu awk "$1" --verbose
+	done export -eu grep "$@" | printf echo 'quoted text' then x=1 done
+	test awk 'quoted text' cd echo /usr/bin ${HOME} $(pwd) printf && then ${HOME}
+		printf sed 2>/dev/null && "$@" --verbose --verbose cd ${HOME} --verbose 'quoted text'
+		local --verbose grep readonly "$1" local printf printf
+		$(pwd) then /usr/bin sed ${HOME} local cd done ${HOME} ${HOME} "$@" local
+'quoted text' --verbose then $(pwd) printf --verbose "$1" readonly
+	printf done grep sed ${HOME} local 2>/dev/null grep awk x=1 'quoted text'
+		-eu $(pwd) | | | export x=1 ${HOME} sed 'quoted text' /usr/bin sed local test &&
+	printf /usr/bin --verbose cd export && awk "$1" done
+-eu readonly local sed grep echo printf sed && --verbose local $(pwd) done
+	readonly done --verbose echo x=1 test readonly ${HOME} grep
+		"$@" -eu done 'quoted text' grep ${HOME} export
+		echo grep 2>/dev/null ${HOME}
+		| export /usr/bin | 'quoted text'
+/usr/bin x=1 $(pwd) --verbose grep cd x=1 printf
+		$(pwd) && $(pwd) --verbose $(pwd)
+/usr/bin 'quoted text' -eu && cd sed echo -eu "$1" $(pwd)
+	"$@" $(pwd) /usr/bin "$@" printf ${HOME} awk | "$@"
+		'quoted text' echo cd 'quoted text' awk sed printf | test x=1
+		grep x=1 x=1 'quoted text' x=1
+$(pwd) local then sed test 'quoted text'
+	| --verbose ${HOME} local awk printf -eu /usr/bin
+		2>/dev/null done grep 2>/dev/null "$@" "$@" /usr/bin export
+	--verbose 2>/dev/null export -eu $(pwd) grep test export done printf
+	grep export test "$1" 2>/dev/null export test
+		&& --verbose "$1" "$1" -eu grep | && x=1 "$1"
+&& awk "$1" then | local readonly | -eu echo cd
+export cd export test grep ${HOME} && then "$@"
+	x=1 ${HOME} awk then echo printf && printf x=1 printf
+done "$1" echo printf | 'quoted text' "$@" -eu test awk "$1" awk x=1 grep printf
+		2>/dev/null local test -eu "$@" "$1" --verbose readonly 2>/dev/null /usr/bin
+	export && done "$1" "$@" printf /usr/bin | "$1" 2>/dev/null "$@" grep
+"$@" done ${HOME} && 'quoted text' done local
+		&& $(pwd) grep sed done --verbose ${HOME} x=1 export
+printf sed echo printf export "$@" ${HOME} 'quoted text' 'quoted text' 'quoted text'
+		done 'quoted text' test sed -eu x=1 export readonly 2>/dev/null
+		"$@" printf 'quoted text'
+		printf && grep done test printf x=1 && | awk ${HOME} 2>/dev/null 2>/dev/null
+	--verbose --verbose export readonly sed cd printf test "$1" /usr/bin
+-eu cd cd test test then test sed cd echo sed
+		-eu local /usr/bin /usr/bin 2>/dev/null ${HOME} ${HOME}
+${HOME} $(pwd) && "$1" awk "$1" grep "$@" "$1" awk done then export $(pwd) $(pwd)
+		--verbose && --verbose done sed printf 'quoted text'
+		printf && ${HOME} local 'quoted text'
+	&& -eu test /usr/bin | local
+	export "$1" && /usr/bin test x=1 awk ${HOME} --verbose readonly test local 'quoted text'
+		local && grep | cd "$1" then export /usr/bin ${HOME} "$1"
+	$(pwd) x=1 then x=1 /usr/bin
+$(pwd) printf $(pwd) echo 2>/dev/null
+		'quoted text' "$1" --verbose test printf test local -eu export then
+x=1 'quoted text' echo 'quoted text' readonly awk --verbose
+then x=1 cd /usr/bin
+		echo local local "$@" sed x=1 sed --verbose 'quoted text' -eu | test
+2>/dev/null then awk cd local
+export | 2>/dev/null "$1" 'quoted text' "$@" printf cd --verbose test local "$@"
+	cd $(pwd) 2>/dev/null ${HOME} "$1" printf --verbose
+		x=1 ${HOME} export sed echo -eu -eu local --verbose 2>/dev/null
+sed | /usr/bin export
+		2>/dev/null sed echo "$1" test awk 2>/dev/null readonly --verbose test && ${HOME}
+	-eu ${HOME} ${HOME} printf export cd awk local
+		2>/dev/null then done |
+	"$1" /usr/bin "$1" -eu grep
+&& 'quoted text' sed readonly echo sed grep
+	| test x=1 done done test x=1
+| ${HOME} && "$@" | --verbose ${HOME} test 2>/dev/null -eu test /usr/bin
+	grep /usr/bin | "$@" 2>/dev/null "$@" readonly then export | echo sed
+readonly cd "$@" echo -eu $(pwd) 2>/dev/null
+		x=1 /usr/bin x=1 2>/dev/null grep | awk x=1 grep ${HOME} && done
+		sed then "$1" x=1 test 2>/dev/null $(pwd) printf "$1" "$@" printf readonly
+awk 'quoted text' -eu grep export export readonly awk
+		"$@" local "$@" /usr/bin && 'quoted text' echo /usr/bin grep then
+	'quoted text' --verbose awk "$1" readonly "$1" x=1 export export
+		done sed export export "$1" 2>/dev/null 2>/dev/null done
+	export local x=1 "$@" readonly grep readonly 'quoted text' test readonly
+	test done awk echo | 'quoted text'
+	"$1" export /usr/bin cd echo $(pwd) "$1" printf done "$@" test /usr/bin $(pwd)
+readonly printf then && 2>/dev/null "$1" "$1" -eu $(pwd) "$@" printf /usr/bin
+	"$@" 'quoted text' "$@" readonly export then ${HOME}
+		local 'quoted text' cd 'quoted text' cd local echo $(pwd) "$1" "$1" && --verbose
+cd 'quoted text' readonly then
+		export --verbose echo
+	&& readonly awk readonly export echo readonly --verbose then
+	cd | x=1 'quoted text' local
+x=1 'quoted text' -eu | echo x=1 ${HOME}
+echo $(pwd) export && export
+&& 2>/dev/null done sed && then -eu 2>/dev/null
+	'quoted text' $(pwd) local export readonly readonly then
+		export x=1 x=1 && && local
+		&& -eu && 'quoted text' "$@" "$@" then readonly echo
+	echo done awk sed cd test sed | then then 'quoted text' done export grep grep cd
+		export test $(pwd) test -eu 2>/dev/null
+	$(pwd) $(pwd) 2>/dev/null
+		test "$1" then ${HOME} /usr/bin cd awk "$@" sed && sed local -eu "$@" local
+"$1" readonly ${HOME} $(pwd) x=1 awk | cd "$1" grep
+then cd 2>/dev/null echo test --verbose grep 'quoted text'
+	readonly /usr/bin readonly done
+$(pwd) cd 'quoted text' export test
+	local export && done sed test echo $(pwd) readonly cd 'quoted text'
+	$(pwd) readonly readonly echo "$@" x=1 "$1" ${HOME} --verbose -eu
+test grep ${HOME} ${HOME} x=1 echo test local x=1 "$1" --verbose && test readonly
+| /usr/bin $(pwd) printf
+	done cd 2>/dev/null readonly awk sed grep export "$1" printf "$1" /usr/bin readonly
+export 'quoted text' awk readonly -eu done && test local
+		readonly x=1 readonly cd --verbose
+		cd awk /usr/bin && done awk -eu "$1" 'quoted text' grep local then
+	x=1 then 'quoted text'
+		echo export $(pwd) && $(pwd) then
+export done 'quoted text' $(pwd) local done x=1 && -eu "$@" $(pwd) awk
+'quoted text' x=1 x=1 ${HOME}
+	/usr/bin printf cd done
+		cd "$@" x=1 $(pwd) 'quoted text' export local 2>/dev/null sed printf export local
+-eu && $(pwd) /usr/bin done
+	2>/dev/null $(pwd) 2>/dev/null then "$@" local awk x=1 done
+awk 'quoted text' ${HOME} sed export awk echo done export 2>/dev/null
+		'quoted text' ${HOME} 2>/dev/null sed awk 2>/dev/null
+-eu awk "$1" grep grep done ${HOME}
+	printf test test /usr/bin -eu sed /usr/bin | "$1" echo "$@" x=1 $(pwd) /usr/bin
+	x=1 2>/dev/null readonly done "$@" 2>/dev/null 2>/dev/null then x=1 /usr/bin
+	export /usr/bin sed "$1" done export
+	export "$@" awk "$@" readonly /usr/bin echo grep done 'quoted text'
+		then /usr/bin --verbose ${HOME} $(pwd) ${HOME} 2>/dev/null export readonly
+awk grep awk grep --verbose -eu
+		2>/dev/null 'quoted text' printf -eu 2>/dev/null $(pwd) -eu export
+		sed 2>/dev/null awk && 'quoted text'
+$(pwd) "$1" | echo echo readonly x=1 export "$@" done
+	then -eu 2>/dev/null x=1 echo then "$@" /usr/bin --verbose readonly --verbose
+	x=1 cd "$@" echo sed --verbose printf readonly
+		$(pwd) printf grep echo export --verbose
+echo x=1 /usr/bin -eu sed /usr/bin cd x=1 test done x=1 'quoted text'
+	test readonly echo printf done | | sed -eu
+	-eu then 2>/dev/null done 2>/dev/null
+grep -eu ${HOME} /usr/bin grep $(pwd)
+		local printf ${HOME} | local done $(pwd)
+x=1 test done echo 'quoted text' then test readonly /usr/bin local local "$@"
+$(pwd) "$@" -eu "$1" sed "$@"
+		&& printf test printf /usr/bin export
+	local | printf --verbose awk x=1
+		2>/dev/null x=1 readonly then "$@" printf --verbose
+	2>/dev/null | local readonly local
+		done "$1" then grep /usr/bin && $(pwd) export grep grep done
+		x=1 2>/dev/null "$@" --verbose
+x=1 && 2>/dev/null x=1 grep | | awk x=1 "$1" 2>/dev/null
+cd -eu local readonly 2>/dev/null --verbose
+	x=1 test readonly $(pwd) $(pwd) awk ${HOME} x=1 cd cd "$1" done | export grep &&
+	| cd readonly -eu echo 'quoted text' -eu | readonly $(pwd) --verbose
+		${HOME} && then printf x=1 echo && then test
+	2>/dev/null && --verbose awk x=1 && grep export /usr/bin awk $(pwd)
+--verbose | echo 'quoted text'
+sed 'quoted text' $(pwd) $(pwd) done 'quoted text'
+	/usr/bin printf 'quoted text' sed /usr/bin /usr/bin printf printf sed
+/usr/bin cd "$1" awk -eu sed "$1" x=1 grep 2>/dev/null "$@" "$1" ${HOME}
+	| $(pwd) export x=1 then export | /usr/bin -eu /usr/bin && /usr/bin "$@" echo
+readonly 2>/dev/null "$@" "$1" && echo
+		echo 2>/dev/null && --verbose test echo awk
+${HOME} sed 'quoted text' then readonly 2>/dev/null
+done readonly /usr/bin x=1 $(pwd) done done 2>/dev/null
+		-eu cd echo printf export /usr/bin export printf
+	echo | "$1" cd "$@" cd -eu
+grep $(pwd) $(pwd) -eu awk 'quoted text' /usr/bin then local test --verbose
+		&& done ${HOME} x=1 awk
+	readonly echo printf /usr/bin --verbose local && 'quoted text'
+--verbose --verbose printf
+		-eu done awk -eu $(pwd) x=1 test --verbose | /usr/bin local
+		then test awk "$@" readonly ${HOME} cd then
+awk --verbose awk 'quoted text' && ${HOME}
+	/usr/bin export --verbose 'quoted text' done echo | ${HOME} awk | sed --verbose
+export "$1" --verbose local grep
+		local sed /usr/bin | done /usr/bin 2>/dev/null
+		export grep | local -eu "$@" "$1" export export echo grep echo "$1" &&
+awk export && then export sed awk /usr/bin export
+		'quoted text' --verbose test local cd awk grep sed -eu cd --verbose cd
+		x=1 && "$@" echo $(pwd) then echo $(pwd) 2>/dev/null ${HOME}
+--verbose printf readonly | printf echo
+-eu cd test grep 2>/dev/null $(pwd)
+printf test x=1 -eu readonly ${HOME}
+then test test grep grep
+2>/dev/null export done ${HOME} local -eu x=1 ${HOME} sed x=1 'quoted text'
+grep export then "$@" done | readonly x=1 /usr/bin --verbose sed
+	export local "$1" printf "$1" $(pwd) "$1" /usr/bin echo
+x=1 "$@" && 'quoted text' $(pwd) ${HOME} readonly -eu ${HOME} cd export --verbose
+awk awk ${HOME} "$@" "$@" echo 'quoted text' --verbose 2>/dev/null "$@"
+		then 'quoted text' -eu grep | 'quoted text' x=1 | readonly | $(pwd) | | cd
+	--verbose "$1" echo sed
+		sed grep echo printf grep && cd sed ${HOME} grep x=1 "$@" sed --verbose x=1 done
+		export done && export 2>/dev/null ${HOME} sed
+	awk sed awk echo "$@" && && sed readonly sed local echo test -eu /usr/bin ${HOME}
+		export 2>/dev/null export readonly --verbose export
+	grep 'quoted text' 2>/dev/null grep local test test 2>/dev/null
+		"$@" local | echo local ${HOME} -eu local
+${HOME} sed /usr/bin /usr/bin printf && $(pwd) --verbose x=1 x=1 "$@" x=1 local
+		"$1" --verbose -eu 'quoted text'
+	sed awk local -eu export $(pwd) sed then "$1" local x=1 done
+	test sed then $(pwd) export "$1" test /usr/bin awk "$1" "$1" 'quoted text'
+		$(pwd) export test ${HOME} x=1
+	'quoted text' echo ${HOME} awk then 'quoted text' 'quoted text' -eu sed export
+		awk 2>/dev/null local grep | cd test $(pwd)
+		cd cd $(pwd) ${HOME} x=1 export printf awk test --verbose
+	echo 2>/dev/null "$1"
+	-eu ${HOME} done "$1" x=1 'quoted text' export done
+then 'quoted text' test 'quoted text' --verbose | ${HOME} /usr/bin grep
+--verbose /usr/bin /usr/bin echo 2>/dev/null "$@"
+		done then && then sed awk 'quoted text' readonly export
+		done local done export cd && local x=1 /usr/bin -eu export printf
+export "$@" -eu /usr/bin && done test $(pwd)
+cd 'quoted text' ${HOME} "$@" "$@" echo "$@" sed grep echo --verbose echo |
+	sed then then awk printf x=1 -eu -eu | "$@" printf x=1 test test
+		--verbose test | done && -eu 'quoted text' "$@" 2>/dev/null
+"$@" cd readonly awk export -eu awk awk $(pwd)
+		sed readonly then export sed "$1" sed x=1
+cd sed "$1" printf printf export 2>/dev/null && ${HOME} && done local grep cd
+		grep test -eu --verbose ${HOME} ${HOME} "$@"
+		local done ${HOME} "$1" 2>/dev/null | --verbose local local
+"$@" test export -eu printf
+	echo && awk x=1 sed 2>/dev/null
+	| 2>/dev/null ${HOME} ${HOME} && grep sed "$1" test then -eu | grep
+cd /usr/bin "$@" cd /usr/bin
+x=1 -eu sed then 'quoted text' ${HOME} "$@" | -eu awk awk --verbose
+		"$1" "$1" ${HOME} --verbose $(pwd)
+	$(pwd) local printf echo
+local /usr/bin | x=1 -eu local readonly grep /usr/bin $(pwd)
+	--verbose "$@" -eu grep --verbose |
+		--verbose cd sed printf -eu /usr/bin $(pwd) 'quoted text'
+cd --verbose sed x=1 awk $(pwd) $(pwd) 'quoted text' /usr/bin echo sed | done
+	grep ${HOME} /usr/bin printf | && /usr/bin done sed readonly awk printf -eu printf
+	export --verbose grep ${HOME} awk local
+		sed awk --verbose awk -eu $(pwd) test
+	done echo export x=1 x=1 readonly readonly
+		cd | /usr/bin sed cd --verbose
+	sed 2>/dev/null x=1 printf export then "$@" $(pwd) echo
+${HOME} done echo 2>/dev/null "$@" "$@"
+	2>/dev/null sed cd awk && done && done "$@" echo --verbose | x=1 then 2>/dev/null
+test && readonly awk test local cd $(pwd) done "$1" x=1 awk /usr/bin test
+	"$@" then "$@" test -eu local echo export $(pwd) sed printf
+export readonly cd grep "$@" cd printf
+		grep local "$@" export export readonly then $(pwd) test
+	| $(pwd) -eu grep grep test $(pwd) printf cd readonly && awk test test export
+${HOME} -eu awk awk ${HOME} "$@" echo
+		"$1" printf "$@" ${HOME} --verbose &&
+echo sed echo 2>/dev/null $(pwd) && "$1" readonly /usr/bin cd
+		readonly grep --verbose cd export cd x=1
+	--verbose -eu grep --verbose
+	x=1 "$1" printf ${HOME} done 'quoted text' printf readonly x=1 2>/dev/null
+printf done "$@" /usr/bin done done $(pwd) "$@" cd -eu grep done sed -eu
+		then ${HOME} --verbose grep printf printf
+	test --verbose then 'quoted text'
+		-eu && done printf --verbose 2>/dev/null echo awk cd awk printf readonly
+		--verbose printf /usr/bin test echo && cd test cd sed readonly
+		local cd -eu /usr/bin done "$@"
+	$(pwd) grep printf readonly "$1" local -eu -eu
+	then -eu done $(pwd) echo awk "$1" ${HOME} then "$1" x=1 | printf
+		readonly | && && readonly ${HOME} "$@" local local --verbose readonly local
+export x=1 export test 2>/dev/null 2>/dev/null x=1 x=1 test
+		| $(pwd) then && readonly | grep local ${HOME} grep "$@" 'quoted text' local then
+'quoted text' "$@" readonly then echo "$@" /usr/bin --verbose
+printf sed | export && /usr/bin echo "$@" ${HOME} -eu cd sed cd local
+		grep readonly printf --verbose awk x=1 grep ${HOME} /usr/bin
+		&& | export /usr/bin sed x=1 echo readonly "$@" grep 2>/dev/null | local
+		/usr/bin && then x=1 sed 2>/dev/null echo ${HOME}
+		${HOME} 'quoted text' "$@" export "$1" 'quoted text'
+		cd sed 2>/dev/null printf && 'quoted text' export | &&
+	test -eu x=1 grep export readonly then grep grep sed
+	sed $(pwd) ${HOME} "$@" --verbose
+| | 2>/dev/null awk export local test cd local grep then
+	sed "$1" /usr/bin printf $(pwd) "$@" cd echo
+readonly ${HOME} printf printf 'quoted text'
+/usr/bin --verbose test printf local sed --verbose cd /usr/bin
+${HOME} /usr/bin --verbose -eu $(pwd) "$1" ${HOME} /usr/bin
+	| echo ${HOME} printf then "$@" printf -eu $(pwd) | cd cd cd grep cd
+	done sed $(pwd) awk 'quoted text' --verbose
+x=1 readonly -eu then /usr/bin ${HOME} $(pwd)
+	cd x=1 readonly ${HOME} --verbose export test awk --verbose
+-eu "$1" printf && "$@" $(pwd) sed 'quoted text' --verbose
+readonly echo awk local grep done test printf then /usr/bin -eu export
+		cd awk export "$1" sed cd grep echo then
+	local done 'quoted text' awk ${HOME} 'quoted text'
+cd local /usr/bin -eu local then /usr/bin "$1" $(pwd) ${HOME} sed done
+		grep readonly then grep && && test 2>/dev/null
+		sed --verbose x=1 x=1 ${HOME}
+		--verbose then then x=1 && export
+grep readonly x=1 cd done --verbose
+		sed export export 'quoted text' "$@" export grep done local done "$@" cd
+"$@" done 2>/dev/null echo then
+	x=1 $(pwd) -eu | && 'quoted text' done grep && test /usr/bin /usr/bin
+/usr/bin cd export -eu local test export grep sed echo sed x=1 test done grep
+printf sed awk 'quoted text'
+	x=1 "$@" export x=1 'quoted text'
+	| "$1" local test printf test sed awk local "$1" && echo echo
+	2>/dev/null then done /usr/bin x=1 "$@" cd x=1 'quoted text'
+x=1 local -eu done | -eu cd then "$1" printf 2>/dev/null --verbose "$1" $(pwd)
+-eu --verbose 'quoted text' done /usr/bin export printf echo echo export x=1 ${HOME}
+	--verbose sed awk export
+"$1" | 'quoted text' export /usr/bin 2>/dev/null
+		printf --verbose cd && $(pwd) && /usr/bin
+then "$1" local export test 'quoted text' 2>/dev/null -eu && "$1" printf
+		sed | && | local $(pwd) $(pwd) then test /usr/bin then export local local cd then
+	x=1 export grep -eu readonly grep local test --verbose $(pwd) awk "$@"
+	cd echo test awk x=1 sed grep 2>/dev/null
+	$(pwd) local readonly -eu 2>/dev/null 2>/dev/null
+		$(pwd) $(pwd) --verbose ${HOME} && printf grep | "$@"
+$(pwd) local x=1 echo
+"$@" readonly awk test /usr/bin "$@" sed ${HOME} /usr/bin
+export | grep 2>/dev/null -eu | && sed $(pwd) test 'quoted text' printf then
+$(pwd) "$1" /usr/bin then "$1" echo $(pwd) printf done echo
+		export 2>/dev/null test 2>/dev/null "$1" && && && "$@" /usr/bin x=1 export
+--verbose cd $(pwd) cd local sed
+	"$@" export | | "$@" $(pwd) local local
+	awk -eu 2>/dev/null --verbose | test && echo -eu
+test test echo && grep sed cd then local $(pwd) readonly
+		echo /usr/bin x=1 printf local
+x=1 printf sed -eu -eu $(pwd) && printf /usr/bin echo local x=1
+then printf -eu "$@" cd
+		echo export 'quoted text' export grep cd "$@" echo "$1" echo --verbose
+	echo echo $(pwd) test echo then test awk -eu done $(pwd) $(pwd) 'quoted text'
+&& sed echo -eu | x=1 | -eu $(pwd)
+		echo export "$@" 'quoted text' export --verbose
+	done | 'quoted text' && /usr/bin --verbose /usr/bin
+		'quoted text' $(pwd) local awk ${HOME} x=1 --verbose sed echo &&
+		${HOME} readonly cd /usr/bin 'quoted text' readonly /usr/bin
+		awk cd done 'quoted text'
+| && $(pwd) then test 'quoted text'
+#include c225.sh
+	-eu -eu grep echo sed export printf then && | grep readonly export "$@" sed
+		grep /usr/bin | 'quoted text'
+local printf test -eu x=1
+	-eu --verbose $(pwd) grep $(pwd) "$@" grep "$@"
+		printf readonly ${HOME} --verbose 2>/dev/null
+	| ${HOME} then 'quoted text'
+	readonly $(pwd) 'quoted text' export then printf
+	then | grep readonly awk grep x=1 local x=1 'quoted text' awk
+		sed ${HOME} sed | && 2>/dev/null
+		'quoted text' readonly export done export
+		done cd test 2>/dev/null
+| "$@" x=1 $(pwd) awk 'quoted text'
+		$(pwd) grep --verbose x=1 echo awk local awk test
+		awk export && then awk
+		awk x=1 2>/dev/null then && done readonly | grep
+"$@" 'quoted text' readonly then local 2>/dev/null
+done export $(pwd) then ${HOME} then printf | | "$@"
+		sed $(pwd) x=1 local "$@" export "$@" 2>/dev/null ${HOME} x=1 echo grep awk awk
+		readonly && | /usr/bin | local
+x=1 readonly | /usr/bin printf readonly 'quoted text' x=1 grep
+-eu "$@" -eu awk "$1" grep
+cd 'quoted text' 'quoted text'
+		x=1 && 2>/dev/null echo x=1 readonly
+		readonly -eu cd /usr/bin 2>/dev/null echo
+		readonly sed | readonly "$@" $(pwd) echo echo sed awk | --verbose echo -eu test
+done ${HOME} awk printf printf
+awk cd cd $(pwd) --verbose 'quoted text'
+$(pwd) ${HOME} then /usr/bin /usr/bin
+export --verbose && printf x=1
+	then 2>/dev/null ${HOME} | 2>/dev/null
+local cd sed printf /usr/bin && ${HOME} cd /usr/bin awk sed |
+		printf echo ${HOME} | $(pwd) ${HOME} "$@" local sed
+${HOME} grep awk grep export "$@" awk 'quoted text' sed -eu
+		done test -eu -eu cd --verbose "$1" 'quoted text'
+	x=1 grep export "$1" awk
+cd --verbose | $(pwd) echo && sed x=1 grep test && export "$@"
+	&& echo | cd cd /usr/bin readonly /usr/bin
+		printf | x=1 export sed 2>/dev/null awk $(pwd) done $(pwd) /usr/bin
+		"$@" /usr/bin /usr/bin "$@" x=1 done --verbose done /usr/bin
+	2>/dev/null echo grep readonly done echo ${HOME} x=1 local then export
+	&& && then --verbose printf echo /usr/bin then "$1" awk "$@" ${HOME}
+${HOME} export 'quoted text' sed then -eu
+-eu x=1 /usr/bin --verbose readonly && grep done 'quoted text'
+		x=1 2>/dev/null -eu cd x=1 then 2>/dev/null "$@" /usr/bin awk 2>/dev/null
+		"$@" "$1" local printf echo then sed cd "$1" "$@" --verbose then cd && "$@"
+export grep ${HOME} "$1" $(pwd) export awk echo "$@" 2>/dev/null
+		echo sed $(pwd) $(pwd) x=1 "$1" "$@" printf
+&& done printf sed -eu /usr/bin test && printf done local test local
+	then test cd then awk then
+	sed echo readonly x=1 sed "$@" printf then /usr/bin export "$1" "$@" x=1
+$(pwd) -eu cd $(pwd) grep then --verbose done 2>/dev/null
+		x=1 "$1" --verbose cd then -eu "$@" export awk /usr/bin /usr/bin
+x=1 -eu done 'quoted text' export /usr/bin /usr/bin done x=1
+	"$1" test echo && cd --verbose done 'quoted text' sed /usr/bin
+		readonly grep sed echo ${HOME} echo test echo --verbose
+	'quoted text' $(pwd) ${HOME} test ${HOME} /usr/bin
+	/usr/bin export -eu readonly
+then export -eu awk echo readonly echo local
+	x=1 grep "$1" test x=1 && awk awk echo x=1 printf
+		$(pwd) then 2>/dev/null ${HOME} "$@" done
+	$(pwd) $(pwd) 2>/dev/null export done
+echo awk | awk export done
+'quoted text' --verbose test export readonly "$1"
+done then printf test printf printf "$1" printf grep done grep ${HOME}
+	cd -eu printf "$1" awk
+		cd 2>/dev/null printf x=1 $(pwd) x=1
+	local awk export cd x=1 'quoted text' then done cd printf export export 'quoted text'
+cd cd printf 2>/dev/null 2>/dev/null cd -eu && "$1" "$1" export sed awk 'quoted text'
+		grep -eu 2>/dev/null done x=1 "$@" done --verbose readonly
+x=1 $(pwd) 'quoted text' "$1" cd x=1
+| 2>/dev/null 'quoted text' local "$@" |
+		sed "$1" export 2>/dev/null
+	"$1" then readonly cd
+$(pwd) "$@" "$1" ${HOME} test | awk ${HOME} grep 'quoted text' "$@" done
+-eu -eu && /usr/bin then 'quoted text' grep | echo
+		'quoted text' | printf test -eu ${HOME} done 2>/dev/null "$@" sed
+	-eu export 'quoted text' $(pwd) |
+		grep | ${HOME} --verbose && $(pwd)
+local cd grep awk test $(pwd) $(pwd)
+local ${HOME} cd --verbose /usr/bin then -eu export
+	test -eu cd "$1" | 'quoted text' readonly --verbose $(pwd) echo export
+		--verbose --verbose then 2>/dev/null awk "$@" then done ${HOME} | "$@" local /usr/bin
+	-eu ${HOME} "$1" | 'quoted text' local grep "$@"
+	'quoted text' && | "$@" "$@" grep 'quoted text' "$@" cd
+/usr/bin "$@" ${HOME} echo x=1 sed export x=1 ${HOME}
+	-eu test then readonly $(pwd) /usr/bin x=1 $(pwd) sed
+	readonly 'quoted text' readonly
+printf readonly x=1 2>/dev/null "$1" export ${HOME} /usr/bin $(pwd)
+grep cd test 2>/dev/null echo /usr/bin --verbose
+done && /usr/bin ${HOME} sed printf && test && awk && -eu /usr/bin 'quoted text'
+	local then export ${HOME} x=1 grep
+awk printf "$1" 'quoted text' -eu done "$1" && 'quoted text' x=1 grep export "$1"
+awk then sed done done awk -eu
+		"$@" sed awk ${HOME} x=1 --verbose
+x=1 export | "$1" printf readonly ${HOME} readonly "$1" echo readonly
+	| sed x=1 sed cd local ${HOME} $(pwd) then grep $(pwd) $(pwd) "$1" echo
+		sed export "$@" && awk --verbose printf echo
+	sed -eu sed -eu --verbose cd cd cd
+	"$@" done -eu grep test printf -eu grep ${HOME} then then x=1 2>/dev/null &&
+	/usr/bin readonly 2>/dev/null done done
+		${HOME} x=1 "$@" grep "$@" "$1" local
+		x=1 "$1" -eu then /usr/bin 2>/dev/null /usr/bin
+		--verbose x=1 then x=1
+export 'quoted text' readonly
+	x=1 awk cd 2>/dev/null local local ${HOME} /usr/bin && export local
+		'quoted text' printf && --verbose
+		-eu 2>/dev/null then "$@" -eu x=1 --verbose -eu done echo 'quoted text' -eu
+		/usr/bin "$@" grep 'quoted text'
+		2>/dev/null ${HOME} -eu | | printf | "$1" --verbose
+	cd x=1 ${HOME} "$1" && --verbose /usr/bin cd grep && ${HOME} && export
+printf cd 'quoted text' $(pwd) 'quoted text' export 'quoted text'
+"$@" $(pwd) /usr/bin export /usr/bin -eu awk grep echo local "$1"
+		awk echo readonly export grep 'quoted text'
+	echo x=1 $(pwd) ${HOME} export awk && $(pwd)
+sed && "$@" printf && --verbose
+		test 2>/dev/null 2>/dev/null 2>/dev/null
+	/usr/bin done local -eu
+		2>/dev/null sed "$@" printf
+test test | cd && grep printf printf 'quoted text'
+		sed ${HOME} local | 2>/dev/null &&
+		done done | 'quoted text' echo readonly ${HOME}
+		| done sed done "$@" printf
+	x=1 --verbose --verbose 2>/dev/null /usr/bin
+then /usr/bin printf local
+	2>/dev/null echo 'quoted text'
+	x=1 "$@" echo -eu x=1 2>/dev/null ${HOME}
+	$(pwd) readonly local readonly | then /usr/bin done cd 'quoted text' cd readonly
+		echo && ${HOME} printf local --verbose test cd "$@" grep --verbose then
+	| x=1 done readonly --verbose && 2>/dev/null
+local $(pwd) printf echo printf done local
+awk sed grep sed echo printf "$1" "$@" grep awk cd cd
+		| && export local $(pwd) local --verbose echo local
+export sed "$1" then printf ${HOME} ${HOME} && awk && awk
+		x=1 -eu $(pwd) "$@" readonly $(pwd) test -eu 2>/dev/null "$@" && x=1 test --verbose
+	local "$1" x=1 cd --verbose 2>/dev/null
+		printf then 2>/dev/null /usr/bin
+$(pwd) /usr/bin local && "$@" done && done && local 2>/dev/null echo "$@" $(pwd)
+	${HOME} -eu local /usr/bin
+	sed sed done then export x=1 sed ${HOME} /usr/bin
+	&& && done /usr/bin printf "$1" 'quoted text' | readonly
+		x=1 local "$@" "$1" echo grep test echo "$1" echo /usr/bin -eu
+	export echo ${HOME} done
+	grep grep export --verbose x=1 ${HOME} local
+/usr/bin $(pwd) readonly 2>/dev/null
+/usr/bin "$1" echo x=1 && 2>/dev/null "$@" printf $(pwd) $(pwd) echo cd 'quoted text'
+		then then printf -eu cd sed && local ${HOME} ${HOME} echo
+		${HOME} x=1 ${HOME} "$@" /usr/bin
+done done readonly 2>/dev/null
+		cd $(pwd) /usr/bin "$@" --verbose echo cd --verbose -eu test grep x=1 && readonly
+	--verbose 'quoted text' echo 'quoted text' cd printf done
+		| $(pwd) done "$@" "$1" sed then cd echo printf "$1" "$@" then
+$(pwd) printf 2>/dev/null 'quoted text' awk 2>/dev/null 'quoted text' $(pwd)
+		test && 2>/dev/null printf sed 2>/dev/null
+| test | "$@" 2>/dev/null cd local
+		test sed && ${HOME} ${HOME} && "$1" grep && awk 'quoted text' x=1 export awk awk
+sed readonly 'quoted text'
+	local export /usr/bin --verbose test grep x=1 printf 'quoted text'
+		test "$@" then printf && x=1 export then && /usr/bin x=1 /usr/bin export
+		x=1 export $(pwd) printf "$@" $(pwd) cd echo readonly 2>/dev/null
+		echo $(pwd) echo then test | "$@" then && awk 2>/dev/null | -eu 2>/dev/null
+	$(pwd) echo export "$@"
+		readonly x=1 local test && then awk cd echo
+	then sed cd awk "$@" -eu $(pwd) --verbose x=1 done 'quoted text' grep 2>/dev/null
+	/usr/bin /usr/bin x=1 2>/dev/null grep test x=1 export sed local echo then
+		then grep local --verbose grep -eu awk x=1 grep | $(pwd) "$1" $(pwd) printf
+"$@" /usr/bin local then printf "$@" then
+local awk then /usr/bin x=1 cd ${HOME} --verbose test ${HOME} "$@"
+		2>/dev/null local "$@" "$1" $(pwd) 2>/dev/null export echo x=1
+	&& $(pwd) local 'quoted text' --verbose 'quoted text' "$1" "$1" printf
+	grep local && printf && export export 2>/dev/null --verbose
+'quoted text' then printf $(pwd) cd printf ${HOME} cd ${HOME} -eu -eu /usr/bin
+'quoted text' | "$1" local awk echo /usr/bin $(pwd) &&
+		| then test awk sed export echo -eu --verbose grep
+local export export export awk 'quoted text'
+		printf /usr/bin printf awk && 2>/dev/null readonly "$@" awk 'quoted text'
+		--verbose local | echo "$1" -eu then cd x=1 /usr/bin local
+	sed && then grep local x=1 'quoted text'
+		local cd | "$1" 'quoted text' x=1 grep grep && sed printf
+	done readonly $(pwd) echo cd awk readonly 'quoted text'
+	echo done done readonly 2>/dev/null then done local cd echo "$1" | -eu "$@"
+		export awk -eu done -eu 'quoted text' local
+echo awk cd grep then | && x=1 local local -eu $(pwd) ${HOME} x=1 /usr/bin printf
+		--verbose echo && readonly ${HOME} readonly
+	readonly $(pwd) -eu ${HOME}
+		&& 2>/dev/null local --verbose && local ${HOME} /usr/bin --verbose readonly |
+-eu --verbose grep grep --verbose grep && && "$@" "$1" /usr/bin
+sed sed local sed 2>/dev/null done --verbose
+	cd -eu /usr/bin local export
+		/usr/bin sed grep export awk -eu 'quoted text' readonly
+		x=1 export export printf readonly /usr/bin 2>/dev/null readonly
+		-eu cd | done && printf --verbose sed --verbose then echo
+$(pwd) ${HOME} "$1" -eu
+		--verbose export readonly
+		awk done test 2>/dev/null done 'quoted text'
+		| 'quoted text' 2>/dev/null local echo sed --verbose
+-eu 'quoted text' "$1" done --verbose
+	local $(pwd) "$@" done done -eu test && done readonly
+	echo && done done local --verbose export
+		2>/dev/null $(pwd) awk export test sed --verbose
+		"$@" done readonly done -eu readonly
+		echo printf grep $(pwd) $(pwd) local grep readonly ${HOME} grep
+	cd printf 'quoted text' local export
+export printf export readonly 'quoted text'
+	--verbose echo awk done done export | -eu echo --verbose
+		$(pwd) local "$1" -eu awk done 2>/dev/null cd done export
+	"$1" x=1 cd local 'quoted text' printf readonly $(pwd) 2>/dev/null &&
+x=1 grep printf | export awk readonly cd "$@" "$@" 2>/dev/null
+"$@" export cd local | 2>/dev/null cd
+cd 'quoted text' readonly /usr/bin "$1" awk | /usr/bin
+cd done && local "$1" readonly /usr/bin && readonly "$@" ${HOME} readonly &&
+2>/dev/null "$1" x=1 $(pwd) test -eu $(pwd) sed then export echo grep
+		--verbose done -eu test sed test --verbose
+	export echo "$1" 'quoted text' "$1" local then 2>/dev/null
+	${HOME} -eu /usr/bin "$@" 2>/dev/null test $(pwd) echo
+		/usr/bin export $(pwd) "$@" | grep cd "$1"
+		sed $(pwd) ${HOME} /usr/bin
+	'quoted text' export "$1" export then sed && awk -eu 2>/dev/null "$1"
+		then | echo done echo x=1 x=1 export $(pwd) readonly $(pwd) then
+-eu $(pwd) awk sed 2>/dev/null 'quoted text'
+sed "$1" echo 2>/dev/null 2>/dev/null export awk 2>/dev/null
+		${HOME} echo echo && export cd awk "$@" echo -eu
+--verbose /usr/bin $(pwd) | "$1" "$@" ${HOME}
+	then 'quoted text' -eu "$1" "$1"
+	done grep "$1" /usr/bin $(pwd) test then done /usr/bin $(pwd)
+		'quoted text' /usr/bin echo /usr/bin export x=1 'quoted text' -eu 'quoted text'
+	&& grep test 'quoted text' awk && | --verbose printf ${HOME}
+/usr/bin grep done then x=1 then test 2>/dev/null then -eu
+		x=1 --verbose /usr/bin | export x=1 | printf
+	$(pwd) then x=1 --verbose "$1"
+	| awk /usr/bin --verbose grep --verbose
+grep done grep && sed done "$@" 'quoted text'
+	--verbose x=1 "$@" -eu sed 2>/dev/null
+awk "$@" --verbose -eu $(pwd) export | x=1 "$1" 2>/dev/null
+test 'quoted text' echo 'quoted text' 2>/dev/null export echo $(pwd) cd -eu readonly
+	printf "$@" printf x=1 printf ${HOME} ${HOME} local awk
+	awk cd test readonly "$@" done "$1" echo export
+'quoted text' -eu local
+	2>/dev/null cd readonly readonly "$1" sed echo
+		x=1 local $(pwd) 'quoted text' 'quoted text' printf && grep then |
+		awk && printf export sed readonly echo
+then 2>/dev/null cd "$1" $(pwd) printf
+		${HOME} readonly -eu "$@" ${HOME} awk
+		cd 2>/dev/null $(pwd) echo --verbose 2>/dev/null then | then readonly awk
+| cd && echo sed then "$@" local ${HOME}
+		| && grep sed && echo awk -eu $(pwd) "$@" awk grep awk -eu done export export "$1"
+sed grep /usr/bin sed /usr/bin echo "$@" "$1" ${HOME} cd 'quoted text' awk
+awk grep export readonly --verbose | readonly -eu x=1 local sed awk x=1 -eu
+awk 'quoted text' awk sed readonly $(pwd) | readonly ${HOME} awk local "$1" local
+	'quoted text' local echo -eu then echo done done
+/usr/bin -eu printf 2>/dev/null sed sed cd test done export test $(pwd)
+2>/dev/null sed x=1 awk test | awk "$@" ${HOME} "$@" -eu x=1 | local
+		'quoted text' 2>/dev/null readonly $(pwd) "$@" grep &&
+		2>/dev/null test grep awk grep local export readonly x=1 'quoted text'
+sed echo test grep "$1" readonly && /usr/bin &&
+printf "$1" /usr/bin 2>/dev/null
+		printf "$1" echo export export 2>/dev/null -eu $(pwd)
+		| awk sed --verbose printf 'quoted text' export && 2>/dev/null local
+"$@" /usr/bin "$@" | export && sed --verbose readonly
+		2>/dev/null awk x=1 readonly x=1 x=1
+export 'quoted text' "$1" "$1"
+		"$1" grep --verbose printf
+	"$@" sed readonly | --verbose local
+	$(pwd) "$@" done /usr/bin cd $(pwd) ${HOME}
+$(pwd) local printf printf ${HOME} sed echo "$@" readonly
+cd sed "$@" cd readonly --verbose export | grep done ${HOME}
+		&& echo --verbose cd printf -eu "$@" 'quoted text' done 'quoted text'
+	readonly ${HOME} "$@" $(pwd) "$1" echo readonly x=1 printf && /usr/bin
+then $(pwd) x=1 'quoted text' /usr/bin /usr/bin
+| $(pwd) export 2>/dev/null awk printf done then local
+		test 'quoted text' sed "$@" done 'quoted text' ${HOME} local
+		-eu ${HOME} echo test 'quoted text' cd 'quoted text'
+x=1 "$@" local x=1 done then --verbose export 'quoted text' $(pwd)
+	${HOME} --verbose echo sed
+${HOME} -eu awk export done local ${HOME} then
+-eu "$@" $(pwd) "$1" printf sed then test grep ${HOME} --verbose
+	'quoted text' awk test then done printf
+		readonly then cd --verbose awk 2>/dev/null 'quoted text'
+		echo sed cd printf /usr/bin sed readonly grep export cd "$@" then "$@" --verbose
+export awk && 2>/dev/null "$@" "$@" /usr/bin --verbose $(pwd) x=1 local
+	cd 2>/dev/null /usr/bin readonly $(pwd) 2>/dev/null
+		then grep | export sed export done then readonly grep -eu ${HOME} echo awk
+		"$@" -eu && && 'quoted text' --verbose "$@" grep test ${HOME} readonly
+	cd test export "$1" x=1 printf printf readonly --verbose printf sed /usr/bin
+export && printf cd grep
+	2>/dev/null done ${HOME} done done -eu sed $(pwd)
+	/usr/bin 2>/dev/null grep test printf "$1" export ${HOME} local --verbose
+	local local "$1" --verbose cd grep
+${HOME} -eu | x=1 test export /usr/bin /usr/bin cd && local awk x=1 cd
+	| sed /usr/bin /usr/bin done readonly
+		printf "$1" "$1" && -eu | && local -eu $(pwd) readonly $(pwd) /usr/bin /usr/bin
+| "$@" then test -eu 'quoted text' ${HOME} export local x=1
+		'quoted text' "$1" test
+		printf -eu -eu "$1" readonly 2>/dev/null grep
+		| /usr/bin 2>/dev/null 'quoted text' local 'quoted text' && /usr/bin --verbose 2>/dev/null
+		awk readonly then ${HOME} done "$@"
+	local export awk $(pwd) cd echo && local cd grep
+	done echo --verbose /usr/bin awk "$@" && 2>/dev/null
+	awk cd readonly export sed x=1 'quoted text' && -eu $(pwd) 2>/dev/null
+	| "$1" 2>/dev/null test echo cd ${HOME} "$@" sed cd printf
+--verbose done --verbose awk "$1"
+	done export export export test then then ${HOME} &&
+	test printf readonly readonly
+	awk printf /usr/bin $(pwd) grep --verbose export x=1 && echo |
+"$@" 'quoted text' "$1" done $(pwd)
+x=1 2>/dev/null | | done then && x=1 echo /usr/bin done -eu sed $(pwd)
+	test ${HOME} "$1" | readonly
+	grep $(pwd) && grep /usr/bin 2>/dev/null
+export ${HOME} | /usr/bin
+		| cd 'quoted text' local
+		x=1 | local cd "$1" cd /usr/bin "$@" cd "$@"
+	$(pwd) "$@" export | x=1 "$@" 2>/dev/null local ${HOME} "$@" | && then readonly
+&& done export && -eu -eu cd local printf sed export | cd "$@" sed done
+&& ${HOME} done readonly && readonly --verbose done --verbose grep readonly
+		--verbose readonly | cd $(pwd) /usr/bin cd cd then | cd done && $(pwd)
+		'quoted text' && 2>/dev/null ${HOME} cd
+		--verbose ${HOME} --verbose then awk /usr/bin
+	then 2>/dev/null "$@" then export echo cd -eu --verbose cd
+		"$@" -eu /usr/bin echo "$1" readonly cd 2>/dev/null local
+		echo export 'quoted text' /usr/bin
+cd && --verbose test printf then "$1" x=1 "$1" "$@"
+	sed $(pwd) sed x=1 grep x=1 | done export /usr/bin /usr/bin $(pwd) && printf
+		&& "$1" echo "$1" && echo 2>/dev/null echo && && "$@" $(pwd)
+	readonly sed local 2>/dev/null sed ${HOME} ${HOME} "$@" --verbose
+		cd echo export sed 2>/dev/null local grep then $(pwd) export cd echo x=1 x=1 done
+	--verbose | done export -eu 2>/dev/null "$@"
+2>/dev/null then export awk 'quoted text' test echo printf "$@" x=1 --verbose
+	'quoted text' && "$@" ${HOME} $(pwd) then 2>/dev/null --verbose
+		grep then --verbose x=1 done ${HOME} -eu && awk
+		| local && cd awk /usr/bin ${HOME}
+	test "$@" local echo ${HOME} && $(pwd)
+		test printf "$1" --verbose awk && export cd then
+		&& 'quoted text' && && 'quoted text'
+sed then /usr/bin && "$@" printf
+printf then --verbose
+	x=1 ${HOME} done then 2>/dev/null readonly "$@" x=1
+		x=1 /usr/bin 'quoted text'
+$(pwd) test test cd | "$1" ${HOME} awk awk -eu readonly --verbose 'quoted text'
+	--verbose readonly ${HOME} awk readonly "$1" cd sed -eu done -eu readonly
+/usr/bin done cd "$@" grep "$@"
+	"$@" sed --verbose x=1 ${HOME} $(pwd)
+'quoted text' printf sed "$@" && x=1
+done /usr/bin | printf "$1"
+		"$1" x=1 grep awk | x=1 awk echo
+		awk then 'quoted text' && 2>/dev/null
+	then x=1 /usr/bin echo "$@" 'quoted text' done export printf sed
+readonly "$1" x=1 /usr/bin sed local test 2>/dev/null $(pwd) &&
+2>/dev/null sed export $(pwd) 2>/dev/null --verbose cd $(pwd) "$1" | $(pwd) printf
+--verbose "$1" | local local "$1" printf 'quoted text'
+		awk export awk $(pwd) local 'quoted text' -eu --verbose
+		${HOME} | $(pwd) /usr/bin | printf x=1 test "$@" 2>/dev/null
+		echo grep -eu readonly ${HOME} sed awk "$@" then $(pwd) | printf "$1"
+		"$@" && "$1" && local export --verbose cd printf sed echo
+&& $(pwd) printf x=1 cd
+		sed echo && awk grep x=1 then -eu && grep export echo then
+"$@" export then echo $(pwd) | $(pwd) $(pwd) echo
+	awk awk grep export awk grep
+		printf /usr/bin /usr/bin 'quoted text' --verbose grep sed $(pwd) x=1 ${HOME} test
+		then "$1" ${HOME} then done
+		sed && | awk --verbose export readonly | then ${HOME} grep 'quoted text' awk
+	cd x=1 "$@" then local 'quoted text' x=1 /usr/bin
+${HOME} /usr/bin $(pwd) then done && && 2>/dev/null
+		awk /usr/bin $(pwd) ${HOME} && cd
+		awk -eu printf $(pwd) test --verbose | 'quoted text' sed awk 2>/dev/null
+		done x=1 | local $(pwd) done | && grep readonly awk awk sed readonly sed done
+	x=1 ${HOME} echo "$@" x=1 readonly sed && local
+	-eu "$@" test x=1 then $(pwd) echo export printf then -eu /usr/bin
+done printf printf grep 'quoted text' export "$1" grep printf grep | awk 2>/dev/null
+	${HOME} ${HOME} echo then --verbose readonly then x=1 cd export export && 2>/dev/null
+grep cd /usr/bin "$@" grep ${HOME} && export echo -eu printf then /usr/bin
+		--verbose && "$1" | echo
+	${HOME} done then printf && cd echo "$1" x=1 | && sed "$1" cd 2>/dev/null ${HOME}
+	local echo printf | printf local test "$1" test echo then cd
+		&& ${HOME} 'quoted text'
+		cd && x=1 then printf && echo sed test x=1 local "$@" "$@" cd local local
+		/usr/bin echo grep export && ${HOME}
+then /usr/bin /usr/bin 2>/dev/null readonly 'quoted text' local grep readonly
+	done && $(pwd) grep 'quoted text' grep echo readonly | /usr/bin "$1"
+	printf "$1" readonly done $(pwd) && 2>/dev/null
+	local grep ${HOME} | cd printf 2>/dev/null cd "$@" /usr/bin grep
+		sed awk && ${HOME} export
+then test | sed ${HOME} echo --verbose -eu && ${HOME} /usr/bin |
+local then | then cd $(pwd) echo cd -eu readonly
+		printf test 'quoted text' done test then "$@"
+	x=1 "$1" export && export $(pwd) cd echo then | 'quoted text'
+$(pwd) && readonly && | then grep awk cd 2>/dev/null local "$1" /usr/bin
+	test export grep cd -eu readonly
+		-eu 2>/dev/null /usr/bin done test /usr/bin export printf test awk -eu export
+	| 'quoted text' ${HOME} x=1 grep /usr/bin /usr/bin grep x=1 'quoted text' cd
+	--verbose x=1 export readonly readonly
+		then echo "$1" grep awk
+	grep then test -eu | export
+${HOME} -eu done 2>/dev/null awk
+	sed then 'quoted text' && ${HOME} "$@"
+	grep then then cd ${HOME} ${HOME} "$@" | --verbose
+		--verbose cd && $(pwd) test 'quoted text'
+		--verbose $(pwd) test /usr/bin export ${HOME} && /usr/bin cd ${HOME} /usr/bin
+	'quoted text' then printf test
+printf sed readonly "$@" ${HOME} then readonly | then x=1 &&
+/usr/bin | /usr/bin local $(pwd) awk readonly grep -eu 2>/dev/null | &&
+	awk readonly printf test local done
+	"$@" /usr/bin /usr/bin done x=1 echo
+	'quoted text' "$1" --verbose cd echo x=1 ${HOME} "$1" done && then
+		test cd | local "$@" x=1 grep --verbose done
+	grep awk x=1 readonly then echo sed 2>/dev/null "$1" readonly echo --verbose
+		'quoted text' 'quoted text' readonly awk awk
+local then grep | "$@" "$@" | /usr/bin printf
+awk $(pwd) test export x=1 ${HOME} echo 2>/dev/null 'quoted text' echo test
+	--verbose && test awk cd --verbose ${HOME} readonly echo -eu | then test
+	sed --verbose echo 2>/dev/null
+	"$@" 'quoted text' "$@" --verbose
+	sed test export --verbose grep export export
+	'quoted text' local && test test cd && grep grep
+echo x=1 ${HOME} done grep -eu then printf "$1" "$@" printf export sed grep
+	| printf && /usr/bin export
+	printf test $(pwd) | sed printf then done
+then test 2>/dev/null /usr/bin sed /usr/bin awk
+echo echo "$1" sed ${HOME} | | printf $(pwd)
+		export local ${HOME} ${HOME} x=1 "$1" "$1" --verbose grep printf test then
+then ${HOME} -eu export export $(pwd) grep /usr/bin local /usr/bin
+		"$1" sed -eu test 2>/dev/null 2>/dev/null -eu cd "$1" done --verbose local && grep
+		sed /usr/bin local sed ${HOME} "$1"
+	done then awk --verbose awk 'quoted text' local /usr/bin export
+grep --verbose x=1 x=1 sed
+	2>/dev/null printf cd readonly /usr/bin "$@" readonly
+		/usr/bin --verbose local export sed $(pwd) "$@" printf |
+		2>/dev/null && then --verbose $(pwd) 'quoted text'
+then -eu then local test "$1" 'quoted text'
+	then --verbose cd printf echo /usr/bin
+		-eu x=1 | printf /usr/bin $(pwd)
+'quoted text' echo 2>/dev/null 2>/dev/null readonly
+	$(pwd) awk sed x=1 echo readonly grep then then
+		echo && grep "$1" export cd then | then local export local x=1 && printf readonly
+	--verbose local then "$@" --verbose /usr/bin printf local
+--verbose | ${HOME} x=1 echo local readonly $(pwd) && sed printf "$1" awk export
+	printf 'quoted text' printf x=1 2>/dev/null x=1
+		then grep then && grep local local ${HOME} 2>/dev/null
+		printf -eu echo readonly ${HOME} x=1 -eu && | grep awk
+		| x=1 echo printf 'quoted text' ${HOME}
+-eu $(pwd) grep readonly "$1"
+| | grep | $(pwd) grep ${HOME} export -eu awk
+	${HOME} echo cd x=1 printf /usr/bin -eu test echo
+	x=1 "$@" "$1" x=1 cd --verbose -eu grep 2>/dev/null printf -eu 2>/dev/null
+		x=1 then | x=1 sed readonly done $(pwd) grep "$1" -eu "$1" local x=1 readonly
+echo echo done cd printf x=1 printf done && cd sed && 'quoted text'
+		sed "$1" sed $(pwd) ${HOME}
+	local done | $(pwd) then "$@" 2>/dev/null echo printf then echo
+${HOME} export -eu && && awk --verbose -eu echo "$1"
+test -eu test sed local | "$@" ${HOME} local sed echo /usr/bin local readonly
+&& | printf readonly
+"$@" local 'quoted text' "$@" then grep $(pwd) | test &&
+"$1" /usr/bin -eu x=1 awk readonly 2>/dev/null then cd printf "$1" 'quoted text'
+		| local | x=1 --verbose grep x=1 echo && 'quoted text' -eu 'quoted text'
+	local echo x=1 test sed printf 'quoted text' 2>/dev/null $(pwd) "$@"
+		&& | ${HOME} echo 2>/dev/null printf | export done
+		cd export then export then readonly
+test awk /usr/bin x=1 local 2>/dev/null &&
+	cd 'quoted text' "$1" local && --verbose 2>/dev/null && && sed sed
+		cd -eu && | readonly /usr/bin readonly "$@"
+grep "$@" then printf export ${HOME} 'quoted text' -eu cd grep "$@"
+	$(pwd) export /usr/bin 'quoted text' "$1" 'quoted text'
+x=1 readonly sed awk && --verbose
+	cd /usr/bin local test --verbose local local && "$1" $(pwd) -eu | readonly 'quoted text'
+export $(pwd) readonly test | test ${HOME} /usr/bin printf then echo
+		awk /usr/bin x=1 $(pwd)
+/usr/bin then x=1 readonly -eu then echo "$@" "$1" x=1 && test
+		export done && --verbose "$@" 2>/dev/null then
+/usr/bin ${HOME} /usr/bin
+"$1" sed /usr/bin printf 2>/dev/null then cd export
+		${HOME} echo | /usr/bin "$@" echo export
+	readonly | /usr/bin 'quoted text' ${HOME}
+		local 2>/dev/null then
+		done "$@" --verbose -eu $(pwd) sed $(pwd) "$@" 'quoted text'
+	printf readonly local 'quoted text' /usr/bin && -eu && cd done
+		grep x=1 awk "$@" ${HOME} printf test $(pwd) 2>/dev/null done
+x=1 "$1" readonly then readonly 'quoted text'
+	"$@" test test readonly |
+		/usr/bin "$@" test done 'quoted text' && cd test &&
+		cd $(pwd) grep grep 2>/dev/null
+		--verbose && local echo export local cd
+		2>/dev/null grep readonly --verbose && awk $(pwd) done grep awk x=1 then
+sed 'quoted text' "$1" export | 2>/dev/null && "$1" 'quoted text'
+--verbose $(pwd) 2>/dev/null awk /usr/bin local |
+		"$1" "$1" --verbose x=1 'quoted text' export
+test cd then x=1 -eu grep ${HOME} done ${HOME} grep 2>/dev/null grep /usr/bin
+cd --verbose export awk $(pwd) grep sed --verbose --verbose grep local export sed
+	export 2>/dev/null awk sed awk cd grep "$@" test && sed done
+-eu echo export awk "$@" printf
+	'quoted text' grep ${HOME}
+"$1" && export "$1" --verbose local test $(pwd) "$1"
+		2>/dev/null export -eu 'quoted text'
+		${HOME} "$@" cd sed then x=1
+		export | cd && "$1" && test local then printf "$1" $(pwd) | -eu "$1" | $(pwd)
+	awk "$1" && 2>/dev/null sed cd sed printf /usr/bin
+awk -eu -eu awk readonly $(pwd) x=1 ${HOME} | --verbose
+		| export test readonly sed done && local && -eu echo "$1" --verbose grep then
+	readonly done awk && sed awk readonly sed awk printf /usr/bin export x=1 /usr/bin
+		export grep 2>/dev/null awk echo local "$1"
+	x=1 done -eu 2>/dev/null ${HOME} 2>/dev/null then 'quoted text'
+printf local done --verbose readonly
+	--verbose "$@" 'quoted text' /usr/bin
+		2>/dev/null "$1" then sed printf "$@" -eu test | $(pwd) -eu awk --verbose
+printf --verbose ${HOME} export 'quoted text' 'quoted text'
+		awk then test sed cd "$@" | sed && echo test sed ${HOME}
+		cd && then done --verbose | awk "$1" 2>/dev/null export printf
+done sed -eu "$@" local "$@" | "$@" local "$@" $(pwd) grep done "$1" /usr/bin
+		| "$@" 2>/dev/null 2>/dev/null "$1" --verbose cd printf 'quoted text' "$1" echo
+	--verbose test local test printf | local export export
+&& printf $(pwd) done echo /usr/bin $(pwd) | echo
+		awk x=1 grep sed 'quoted text' then "$@" $(pwd) 'quoted text' &&
+	cd sed awk -eu $(pwd) x=1 | /usr/bin test /usr/bin grep then
+		${HOME} "$1" ${HOME} printf
+done 2>/dev/null then "$1" "$@" x=1 cd echo /usr/bin then cd done printf
+then sed x=1 grep 2>/dev/null sed test "$1" test export done x=1 local 2>/dev/null
+awk test --verbose readonly done /usr/bin ${HOME}
+		grep | && "$1" awk 'quoted text'
+test grep 'quoted text' --verbose printf $(pwd) | printf cd done "$1"
+	/usr/bin /usr/bin ${HOME} export printf ${HOME}
+		| 2>/dev/null /usr/bin done export
+	$(pwd) done "$1" then ${HOME} then
+		--verbose local "$1" printf grep echo sed -eu printf printf
+		'quoted text' ${HOME} printf
+		grep $(pwd) sed readonly | && cd sed "$1" then awk x=1 grep local sed "$@"
+export then sed -eu 2>/dev/null awk /usr/bin
+'quoted text' done printf ${HOME}
+	${HOME} | && printf grep $(pwd) test
+"$1" --verbose printf 'quoted text' grep grep && printf "$1" test export test
+| sed && && export | test && /usr/bin
+	2>/dev/null echo 2>/dev/null x=1 "$1" x=1 $(pwd) x=1 sed echo done
+	-eu -eu echo --verbose 'quoted text'
+"$1" | readonly -eu echo done awk 2>/dev/null
+awk echo awk && echo
+		test x=1 readonly "$@" sed echo then $(pwd) cd awk readonly x=1 done
+	grep /usr/bin x=1 "$@"
+		export 2>/dev/null /usr/bin /usr/bin
+printf "$1" sed readonly printf
+	sed test cd printf echo echo "$@" "$@"
+		awk /usr/bin ${HOME} test
+then sed local "$@" export
+		/usr/bin x=1 | | 2>/dev/null
+export --verbose | awk awk /usr/bin then -eu | /usr/bin printf printf
+| | sed printf cd readonly readonly readonly --verbose printf sed 'quoted text'
+export then 2>/dev/null -eu "$@" 'quoted text'
+	cd then | grep local | grep
+	"$@" 2>/dev/null | readonly grep 2>/dev/null
+	printf sed "$1" $(pwd) -eu printf awk "$1" | "$1" awk | done /usr/bin &&
+		echo sed local "$@" then awk ${HOME} /usr/bin
+done test local | sed ${HOME} /usr/bin
+		cd awk "$1" test then --verbose ${HOME} 'quoted text' 'quoted text'
+done awk "$@" done 'quoted text' test readonly echo done
+		2>/dev/null printf awk && done local sed | test echo cd ${HOME}
+	test 'quoted text' echo | 2>/dev/null $(pwd) done grep done then local
+	2>/dev/null "$@" x=1
+		export "$1" local test ${HOME} echo done cd export | "$@" readonly /usr/bin
+		then ${HOME} "$@" "$1" "$1" -eu ${HOME}
+		/usr/bin local -eu "$1"
+		'quoted text' && && sed sed | && export -eu echo --verbose
+done | export test readonly test ${HOME} | awk x=1 x=1 'quoted text' sed
+	-eu echo grep done | | printf printf
+	done printf echo ${HOME} grep test echo
+	echo && local /usr/bin $(pwd) done 'quoted text' awk done | test printf 'quoted text'
+		&& | --verbose 2>/dev/null echo done awk done readonly ${HOME}
+		"$@" printf grep --verbose ${HOME} /usr/bin "$@" then 2>/dev/null
+		| -eu readonly | cd cd cd done local sed x=1
+	--verbose "$1" x=1 readonly
+${HOME} done export test then echo | | done "$@"
+	sed grep echo $(pwd) awk cd /usr/bin cd "$1" "$@" done
+x=1 | export && local | ${HOME} -eu
+		2>/dev/null -eu && x=1 done readonly $(pwd) awk readonly x=1 readonly
+		local $(pwd) | && "$1" /usr/bin x=1 "$@" then x=1 2>/dev/null export
+	--verbose /usr/bin "$1" /usr/bin grep 2>/dev/null ${HOME}
+	local grep && sed "$@" 2>/dev/null awk readonly export echo echo export
+export export "$1" /usr/bin ${HOME} echo 'quoted text' && awk sed 2>/dev/null
+		2>/dev/null local sed "$1" awk awk awk
+		x=1 x=1 printf "$1" $(pwd) sed readonly printf export --verbose
+--verbose readonly "$1" 'quoted text' 2>/dev/null grep
+		| then readonly && then x=1 -eu
+	readonly echo | cd echo export printf then grep --verbose
+$(pwd) $(pwd) local /usr/bin $(pwd) test $(pwd) $(pwd) export local
+	"$@" /usr/bin --verbose export | && echo "$@"
+		2>/dev/null -eu readonly && then awk local echo echo | "$@" grep cd echo &&
+${HOME} test then x=1 --verbose -eu local
+	x=1 done done --verbose "$@" $(pwd) then $(pwd) -eu $(pwd)
+/usr/bin --verbose | "$1" then
+/usr/bin printf "$1" cd $(pwd) x=1 $(pwd) --verbose 'quoted text'
+sed "$@" /usr/bin | readonly 'quoted text' cd
+		sed export export awk --verbose cd echo 'quoted text'
+		grep | 2>/dev/null export echo
+test ${HOME} then 2>/dev/null awk "$@" | 'quoted text' grep
+grep readonly | cd ${HOME} /usr/bin "$1" 'quoted text' awk then
+cd | cd echo test /usr/bin 2>/dev/null awk | ${HOME}
+	awk sed x=1 $(pwd) | awk "$@" echo grep
+	echo test grep then ${HOME} $(pwd) echo /usr/bin echo | cd cd "$1" x=1
+sed 'quoted text' 'quoted text' readonly readonly then printf
+export /usr/bin && --verbose export "$@" then && printf x=1 /usr/bin ${HOME}
+| printf && 2>/dev/null ${HOME} /usr/bin && 'quoted text' "$@"
+		printf ${HOME} && printf $(pwd) x=1 printf local --verbose cd awk $(pwd) then 2>/dev/null
+	printf printf cd --verbose test && /usr/bin
+		&& echo && test x=1 "$1" | "$@" "$1" echo local awk 2>/dev/null
+		sed --verbose export ${HOME} sed && cd readonly
+		2>/dev/null $(pwd) ${HOME} "$1" done grep
+		grep "$1" grep ${HOME} sed done 2>/dev/null
+then done test awk printf ${HOME} readonly
+		&& awk 2>/dev/null test "$1" done test ${HOME} local then ${HOME} cd && grep
+	test readonly test 2>/dev/null 2>/dev/null --verbose then && export
+${HOME} awk echo /usr/bin done /usr/bin echo 2>/dev/null sed done then | "$1" then
+	then x=1 'quoted text' done 'quoted text' ${HOME} awk done ${HOME}
+"$1" "$@" sed readonly "$1" printf awk --verbose export "$@" sed cd grep
+readonly test /usr/bin "$@" "$1" "$@" | "$@" -eu done test && then
+	printf echo && && 2>/dev/null done 'quoted text'
+then 2>/dev/null 2>/dev/null
+"$1" awk | "$1" readonly awk export &&
+		$(pwd) $(pwd) "$@" printf 'quoted text'
+		-eu then "$1" echo ${HOME} printf export printf grep printf then
+	done cd x=1 -eu grep export "$@" local -eu 'quoted text'
+		x=1 sed --verbose local awk printf printf 'quoted text' test grep 2>/dev/null
+	"$@" $(pwd) then 2>/dev/null x=1 then | export 2>/dev/null -eu
+	sed | echo "$@" sed export | echo export awk readonly /usr/bin
+	printf x=1 echo sed -eu then -eu $(pwd) local readonly
+-eu export awk "$1" printf printf 2>/dev/null awk
+	local done printf | ${HOME} done "$1" then cd test /usr/bin
+cd printf readonly "$@" $(pwd) awk
+	cd --verbose printf "$@" local 2>/dev/null then x=1 readonly printf --verbose
+		${HOME} grep sed "$1" echo && --verbose cd then cd 'quoted text' $(pwd) /usr/bin
+	2>/dev/null cd cd done "$1" export x=1 /usr/bin test
+| export $(pwd) x=1 then ${HOME} -eu -eu -eu cd $(pwd) printf echo
+printf awk | | $(pwd) printf ${HOME}
+	&& sed 'quoted text' -eu readonly 'quoted text' done
+		sed echo local && $(pwd)
+	grep | export test test done && test "$@" readonly then readonly --verbose
+| 'quoted text' awk 'quoted text' x=1 then 'quoted text'
+	"$1" test $(pwd) echo "$@" 2>/dev/null | $(pwd) printf
+'quoted text' echo --verbose readonly $(pwd) cd && then /usr/bin
+		x=1 x=1 then -eu x=1 local
+	$(pwd) -eu $(pwd) x=1 | /usr/bin printf printf printf echo
+	then sed $(pwd) | awk echo ${HOME} ${HOME} | | echo --verbose
+		test | readonly then && awk "$1" printf readonly
+	x=1 test && readonly sed /usr/bin "$1" x=1 then done --verbose
+		/usr/bin "$@" echo ${HOME} then "$@" sed /usr/bin "$@" -eu
+		2>/dev/null "$1" --verbose grep -eu | readonly echo 2>/dev/null
+	awk readonly awk printf export readonly
+	grep cd readonly -eu export | export
+		/usr/bin printf "$@" readonly cd -eu $(pwd)
+		&& && local ${HOME} test done done /usr/bin awk x=1 printf ${HOME}
+		readonly local "$@" then
+	grep -eu test "$@" | $(pwd)
+	"$1" 'quoted text' cd &&
+		awk "$@" "$1" readonly "$@" test local
+	/usr/bin awk ${HOME} done /usr/bin awk "$1" grep 2>/dev/null
+		test export grep awk ${HOME} "$@" | local -eu readonly | grep
+		cd test /usr/bin test -eu done then --verbose --verbose
+		echo "$1" done cd cd && 'quoted text' cd
+	-eu "$1" done "$1" grep 2>/dev/null $(pwd) "$@" grep sed
+	export "$@" grep $(pwd) then done awk export cd 2>/dev/null
+		x=1 sed | -eu printf 'quoted text' printf -eu test echo
+		x=1 then awk x=1 local $(pwd) x=1 local printf "$1"
+done done local 2>/dev/null sed echo done test local readonly "$@" && grep
+		printf && --verbose $(pwd) ${HOME}
+grep local | local then && x=1
+	&& printf 'quoted text' readonly $(pwd) "$@" then cd cd x=1
+		local awk /usr/bin 2>/dev/null
+export && printf printf | -eu "$1" export export
+	readonly $(pwd) test test then sed "$@" "$@" done x=1 ${HOME} x=1 2>/dev/null
+		-eu | echo | then readonly -eu grep
+		export local 'quoted text' "$1" ${HOME} $(pwd) --verbose
+printf --verbose grep
+	sed awk readonly /usr/bin printf && local --verbose
+'quoted text' | local done "$@" /usr/bin then -eu awk grep 2>/dev/null -eu "$@"
+		/usr/bin x=1 && ${HOME} x=1 && | readonly 'quoted text' cd 2>/dev/null ${HOME}
+		"$1" && /usr/bin local test | x=1 2>/dev/null -eu cd --verbose
+		"$1" x=1 done echo 2>/dev/null | export test
+"$@" cd then ${HOME} cd sed /usr/bin
+${HOME} then | readonly done | sed /usr/bin -eu x=1 && readonly
+	awk /usr/bin local ${HOME} local ${HOME} echo echo
+$(pwd) then test local ${HOME}
+	2>/dev/null done "$@" echo readonly local local readonly --verbose
+	cd "$1" awk && printf test test x=1 awk ${HOME}
+	readonly | 2>/dev/null local | echo export local
+		&& x=1 --verbose "$@" sed
+	--verbose readonly sed then local 'quoted text' local && --verbose $(pwd) done --verbose
+		'quoted text' "$1" "$@" "$@" ${HOME} --verbose "$1" /usr/bin | && /usr/bin
+export "$1" "$@" $(pwd) export readonly test && ${HOME} grep done $(pwd)
+	cd | --verbose 'quoted text' sed
+cd test $(pwd) "$1" && sed ${HOME} "$@" --verbose
+		awk echo "$1" sed printf 2>/dev/null
+		test x=1 "$1" --verbose /usr/bin
+		then cd awk "$1" --verbose
+		printf | "$@" x=1 "$1" --verbose
+	x=1 'quoted text' 2>/dev/null 'quoted text'
+printf readonly /usr/bin "$1" "$1" --verbose -eu local 2>/dev/null local
+	cd then done 2>/dev/null done
+${HOME} && -eu x=1 printf then
+"$@" $(pwd) $(pwd) x=1 grep done sed --verbose 'quoted text' /usr/bin
+		export 2>/dev/null export --verbose $(pwd)
+		'quoted text' echo printf 'quoted text' echo
+cd done "$1" test then x=1 /usr/bin | export
+x=1 --verbose --verbose $(pwd) 'quoted text' printf
+		printf ${HOME} awk export test cd printf
+	local cd --verbose ${HOME} test printf readonly then grep | && /usr/bin "$1"
+	export | -eu "$1" echo awk cd grep "$@" --verbose grep
+	sed ${HOME} --verbose local grep /usr/bin
+	"$@" | | 'quoted text' "$1" done test ${HOME} && --verbose readonly grep "$1"
+	grep printf "$1" "$1" echo | && cd printf printf "$1" /usr/bin
+		readonly cd /usr/bin 'quoted text' then $(pwd) export readonly
+		awk local 2>/dev/null --verbose sed echo readonly && "$@"
+	sed /usr/bin 'quoted text' 2>/dev/null 2>/dev/null -eu sed grep cd "$1" "$@" --verbose
+awk sed cd $(pwd) sed 2>/dev/null then 'quoted text'
+		awk readonly local printf
+then sed then printf local "$@" grep sed "$@" | local ${HOME} printf awk
+${HOME} readonly local
+$(pwd) readonly readonly test export -eu "$1" ${HOME} --verbose local
+	done cd cd 2>/dev/null x=1 echo --verbose 2>/dev/null --verbose export -eu readonly
+		"$1" awk test x=1 then echo local printf
+		| | readonly "$1" 2>/dev/null test done 2>/dev/null --verbose
+		| | grep sed "$1" grep x=1 sed &&
+-eu printf test | 2>/dev/null 'quoted text' cd then awk | |
+"$1" --verbose $(pwd) export
+	cd readonly "$@" local echo
+	'quoted text' grep grep sed 'quoted text' then grep grep printf --verbose
+$(pwd) grep done && export done local ${HOME} x=1 "$1" "$@"
+		readonly export awk grep done 2>/dev/null sed cd
+-eu local && local "$1" 'quoted text' awk sed then then $(pwd)
+		done -eu local export "$@" ${HOME} grep -eu |
+${HOME} printf x=1 "$1" grep local echo | 2>/dev/null
+grep awk | readonly test x=1 2>/dev/null
+		test "$@" --verbose printf
+	awk then /usr/bin sed done --verbose
+&& sed "$1" "$@" readonly
+		| 2>/dev/null readonly then grep
+	grep awk local && awk awk ${HOME} readonly readonly awk test
+		"$@" local && grep done readonly | test && sed sed echo /usr/bin
+"$1" done done export sed --verbose export /usr/bin export
+	| | grep printf readonly export 'quoted text' $(pwd) "$1" sed
+awk "$@" && && done echo then local readonly sed | --verbose sed done echo
+	${HOME} /usr/bin test awk x=1 sed 2>/dev/null cd -eu echo cd /usr/bin |
+		done then "$1" "$@" "$@" 2>/dev/null cd grep -eu 2>/dev/null sed sed done
+	export grep sed then 'quoted text'
+		readonly export sed -eu x=1 grep x=1 readonly done 'quoted text' -eu
+		sed $(pwd) | printf 'quoted text' export done cd echo awk local
+		"$1" printf "$@" done done test
+	done then 2>/dev/null export && test cd readonly done 2>/dev/null
+		readonly ${HOME} printf
+printf "$@" "$@" echo
+local readonly | sed -eu printf
+	'quoted text' local sed sed --verbose -eu | sed echo && --verbose
+		echo cd "$@" /usr/bin awk done 2>/dev/null | -eu && $(pwd) x=1
+x=1 printf grep --verbose echo
+"$1" x=1 grep 'quoted text' -eu done "$1" sed "$1" /usr/bin cd export test
+| "$@" sed readonly printf x=1 'quoted text' printf "$1" "$1" --verbose
+		export echo awk 'quoted text' export awk "$1" awk awk then echo readonly $(pwd)
+| echo "$@" x=1 x=1 ${HOME} test printf
+		test ${HOME} --verbose --verbose ${HOME} "$@" cd test
+	| then $(pwd) x=1 then x=1 x=1 x=1 | $(pwd) | "$1"
+echo then awk | /usr/bin x=1 export -eu echo printf cd done --verbose
+	/usr/bin local -eu && --verbose
+echo grep printf sed 2>/dev/null cd printf 2>/dev/null
+		sed test "$@" done grep cd test "$1" && awk $(pwd) -eu
+		then local readonly 'quoted text' sed grep ${HOME} cd 'quoted text'
+		--verbose --verbose export done done 'quoted text' local /usr/bin
+'quoted text' sed echo 'quoted text'
+	awk x=1 -eu "$1" x=1 done
+	${HOME} then cd export then readonly
+	&& done -eu --verbose $(pwd) && readonly awk "$@"
+	cd x=1 "$1" | printf test --verbose ${HOME} then sed $(pwd) 2>/dev/null
+		--verbose -eu ${HOME} 2>/dev/null
+	2>/dev/null ${HOME} $(pwd) grep grep x=1 -eu "$1" then "$@" | "$@"
+	export local ${HOME} "$1" "$1" awk ${HOME}
+then sed echo ${HOME} /usr/bin
+		done echo readonly ${HOME} --verbose 'quoted text' x=1 echo
+		"$@" test x=1 2>/dev/null "$@" -eu done export $(pwd) local /usr/bin "$@" then
+	then cd && then ${HOME} | "$@" export && -eu then "$1"
+		| export -eu $(pwd) 2>/dev/null printf
+		${HOME} ${HOME} ${HOME} done --verbose ${HOME} cd && $(pwd) test "$1" then
+$(pwd) printf -eu x=1 $(pwd)
+		/usr/bin awk --verbose sed --verbose "$1" ${HOME}
+		test done -eu "$1" echo sed readonly && --verbose
+		then && ${HOME} sed local printf "$1" sed ${HOME}
+		cd "$1" -eu awk done done /usr/bin sed "$@" grep then /usr/bin printf sed
+2>/dev/null test echo --verbose done
+'quoted text' "$@" "$@" local local /usr/bin sed x=1 test "$@" readonly test
+	"$1" printf local local local && /usr/bin
+	&& local ${HOME} cd cd 'quoted text'
+2>/dev/null "$@" printf
+-eu grep -eu -eu 2>/dev/null
+		${HOME} 'quoted text' export
+		readonly 'quoted text' readonly "$@" awk "$1" sed test 'quoted text'
+	"$@" 2>/dev/null ${HOME} readonly echo x=1 ${HOME}
+export /usr/bin then x=1 ${HOME}
+	"$@" echo then local test 'quoted text' x=1 echo | local | &&
+test /usr/bin echo printf && "$1"
+	'quoted text' ${HOME} /usr/bin ${HOME}
+		x=1 | grep echo --verbose cd cd 'quoted text' cd cd &&
+		/usr/bin export echo 2>/dev/null awk local echo "$@" readonly && test
+| test echo x=1 grep ${HOME} $(pwd) "$1"
+	--verbose 'quoted text' printf sed done printf /usr/bin "$1" local "$@" then
+		--verbose then x=1 printf awk awk done readonly test $(pwd) local local done
+		local printf ${HOME} ${HOME} readonly then 'quoted text' then local
+		| 2>/dev/null test && -eu export awk test local /usr/bin
+	done 'quoted text' done cd test then "$@" -eu echo 2>/dev/null
+	&& then 'quoted text' echo test sed "$1" readonly awk
+	readonly then $(pwd) "$1" awk ${HOME} sed | cd then echo |
+	x=1 "$@" ${HOME} then -eu echo | x=1 local --verbose -eu readonly 2>/dev/null
+then test cd done -eu export sed x=1 /usr/bin local done "$@" printf
+		export local x=1 -eu echo awk echo x=1 local printf sed x=1 done export "$@" export
+'quoted text' ${HOME} sed
+	awk -eu export awk cd | echo --verbose | ${HOME} cd && x=1 echo && echo done
+	local && grep grep $(pwd) --verbose -eu echo grep 'quoted text'
+	$(pwd) "$1" $(pwd) x=1 /usr/bin 2>/dev/null sed echo printf export && echo cd
+2>/dev/null "$@" printf && export echo "$@" -eu --verbose 'quoted text'
+	"$@" test cd -eu local
+		--verbose && readonly sed "$@"
+${HOME} | "$1" 2>/dev/null "$1" local sed 2>/dev/null
+		$(pwd) "$1" x=1 sed echo --verbose awk
+		"$@" /usr/bin cd done "$1" 2>/dev/null 2>/dev/null && ${HOME}
+grep awk done && awk x=1 && local export | $(pwd) 'quoted text' echo 2>/dev/null
+		$(pwd) ${HOME} readonly /usr/bin
+	awk "$1" awk $(pwd) then test
+	--verbose sed readonly /usr/bin
+		"$@" "$@" -eu 'quoted text' echo -eu local -eu test --verbose 'quoted text'
+	| "$@" then "$@" readonly ${HOME} && awk --verbose done
+		done done echo printf "$@" "$@" done local "$1" "$@"
+		${HOME} local x=1 then |
+local --verbose && readonly readonly printf --verbose -eu x=1 done | && "$@" |
+	x=1 "$1" 'quoted text' cd 2>/dev/null test awk cd 'quoted text' printf grep
+	echo export then 2>/dev/null done ${HOME} grep awk -eu export
+		printf | readonly done echo export awk then
+		sed echo 'quoted text'
+echo done --verbose echo 'quoted text' then test && x=1
+	x=1 readonly done -eu ${HOME} test
+awk ${HOME} /usr/bin sed awk sed done test && x=1 grep ${HOME} printf "$1"
+then echo then x=1 test grep $(pwd) $(pwd) printf done "$@" local then $(pwd)
+		test ${HOME} 2>/dev/null echo local | awk cd | echo then ${HOME} -eu $(pwd)
+		/usr/bin $(pwd) x=1 export 2>/dev/null
+	x=1 cd 2>/dev/null && readonly ${HOME} printf $(pwd)
+grep local -eu local then && then printf
+&& && then $(pwd) -eu cd "$@" test /usr/bin $(pwd) awk
+	2>/dev/null $(pwd) awk 2>/dev/null readonly cd 'quoted text'
+		x=1 awk local /usr/bin echo | test done "$1" then sed local readonly
+		printf $(pwd) /usr/bin awk local
+	then 2>/dev/null ${HOME} "$@"
+export && grep export -eu -eu
+	cd test && "$1" echo sed printf "$@" | ${HOME}
+	&& "$1" /usr/bin test
+	&& "$1" echo -eu -eu cd $(pwd) then export local --verbose
+		cd awk ${HOME} -eu test 2>/dev/null grep test x=1 2>/dev/null
+		readonly 'quoted text' --verbose then done 2>/dev/null "$1" 'quoted text'
+	&& readonly -eu "$@" "$1" printf | -eu && ${HOME} awk /usr/bin
+	done /usr/bin cd local echo ${HOME} && "$1" export echo ${HOME} sed echo | echo
+		-eu echo printf ${HOME} --verbose readonly "$1"
+	cd $(pwd) echo -eu then then | test test ${HOME} --verbose x=1 sed
+done sed x=1 awk "$@" done --verbose
+test x=1 2>/dev/null /usr/bin /usr/bin 'quoted text'
+sed test export "$1" "$@" 2>/dev/null test "$1"
+"$1" && -eu printf x=1 test awk x=1 x=1 awk 2>/dev/null -eu printf "$@" && 'quoted text'
+		'quoted text' "$1" ${HOME} printf x=1
+cd -eu local "$@" ${HOME} export
+		cd test then && 'quoted text'
+| test x=1 && readonly | ${HOME}
+test export test /usr/bin --verbose awk readonly "$1" then echo
+		${HOME} ${HOME} grep x=1 /usr/bin cd /usr/bin
+'quoted text' then 2>/dev/null
+	grep export test 2>/dev/null
+${HOME} test cd test --verbose
+		awk 'quoted text' echo /usr/bin 2>/dev/null
+	&& readonly grep "$1" 2>/dev/null ${HOME} printf readonly
+	'quoted text' --verbose "$@" "$1"
+	grep && x=1 awk "$1" 'quoted text' grep then
+		echo $(pwd) sed awk 'quoted text' printf ${HOME} x=1 grep 'quoted text'
+	test /usr/bin done export "$@" grep --verbose sed
+	echo cd local /usr/bin -eu export local 2>/dev/null cd done then readonly test sed
+	/usr/bin ${HOME} awk echo export echo x=1 grep export export 'quoted text'
+		readonly printf | 'quoted text' test
+test printf printf echo sed
+		'quoted text' 'quoted text' | $(pwd)
+printf "$@" done x=1 ${HOME}
+"$1" "$@" local | x=1 && -eu 2>/dev/null 'quoted text' readonly sed export
+		&& 'quoted text' && cd then local echo /usr/bin | "$@" test
+	printf 2>/dev/null local 2>/dev/null cd awk export | export
+		grep x=1 local local 'quoted text' "$1" readonly
+--verbose readonly x=1 $(pwd) "$@" "$@" --verbose
+	test export local 2>/dev/null
+		--verbose sed export local x=1 awk /usr/bin grep
+'quoted text' x=1 | awk readonly "$1" && 2>/dev/null && cd grep 2>/dev/null
+	$(pwd) awk local 2>/dev/null &&
+	2>/dev/null printf 2>/dev/null cd "$1" local readonly
+echo then printf "$@" awk awk "$1" echo 'quoted text' grep /usr/bin
+"$1" ${HOME} export readonly
+	done done -eu && -eu export 2>/dev/null 2>/dev/null
+	grep "$1" $(pwd) /usr/bin 'quoted text'
+	sed | export "$@" 2>/dev/null sed 'quoted text' &&
+	&& done grep --verbose $(pwd) -eu done 2>/dev/null
+	'quoted text' -eu -eu then -eu
+	export test done cd test -eu sed local awk readonly
+	sed export printf echo
+awk "$1" "$@" grep then
+	local test local --verbose -eu "$1" printf printf cd 'quoted text'
+	export echo "$1" test readonly
+		| 'quoted text' then grep ${HOME} "$1" ${HOME} awk 'quoted text'
+	${HOME} printf ${HOME} | 'quoted text'
+--verbose grep | sed export 2>/dev/null cd | "$1"
+	printf "$@" | test | printf "$1" local export
+	grep sed ${HOME} $(pwd) awk x=1 done cd ${HOME} | local
+"$@" "$1" "$@" 'quoted text' --verbose
+"$1" 2>/dev/null export ${HOME} cd
+then cd awk echo 'quoted text' --verbose echo
+	test -eu /usr/bin 2>/dev/null 'quoted text' printf done x=1
+		&& cd printf /usr/bin then then
+	cd "$1" cd readonly && | grep echo readonly 2>/dev/null | --verbose
+readonly 2>/dev/null --verbose local
+		cd "$@" sed $(pwd) echo test x=1 grep 'quoted text'
+	${HOME} 'quoted text' local --verbose
+		-eu && printf "$1" "$@"
+awk "$1" $(pwd) | sed "$@" $(pwd) readonly then readonly && export
+then grep | | then "$@" awk done "$@" ${HOME} "$1" -eu ${HOME}
+	cd "$1" export 'quoted text' then
+		'quoted text' | --verbose
+readonly 'quoted text' test
+--verbose sed awk $(pwd) $(pwd)
+	readonly then sed then test done /usr/bin |
+printf echo grep export sed cd printf && && 'quoted text' $(pwd) grep then
+sed 2>/dev/null readonly --verbose sed readonly test done
+		${HOME} local then && export -eu $(pwd) $(pwd) && local
+	2>/dev/null printf "$1" cd awk ${HOME}
+	--verbose grep ${HOME} then && ${HOME}
+	&& awk readonly export echo printf awk export
+		-eu test export 'quoted text' echo
+	done | | -eu readonly 2>/dev/null
+	$(pwd) grep done export then 'quoted text' awk cd ${HOME} $(pwd) --verbose
+/usr/bin 'quoted text' export export cd grep
+&& printf awk grep /usr/bin
+then 'quoted text' done sed | awk -eu /usr/bin test "$1" ${HOME}
+	"$@" awk 'quoted text' | test "$1" $(pwd) | x=1
+	awk then 2>/dev/null sed "$1" ${HOME} --verbose done awk | "$1"
+done done 'quoted text' "$@" $(pwd) then
+	local 'quoted text' --verbose /usr/bin grep "$@" printf sed export done
+		| "$@" test x=1 "$1" && grep sed sed
+	export test /usr/bin 'quoted text'
+	"$1" sed ${HOME} cd cd
+"$1" then $(pwd) -eu x=1 done -eu local done printf
+	&& --verbose 'quoted text' x=1 local done done grep
+	--verbose done x=1 local $(pwd) /usr/bin sed 2>/dev/null
+	export /usr/bin x=1 | readonly grep echo &&
+$(pwd) --verbose printf then test --verbose
+	export sed /usr/bin test x=1 sed /usr/bin | done
+		2>/dev/null ${HOME} export
+	grep 2>/dev/null readonly $(pwd) -eu 'quoted text'
+		cd echo -eu 'quoted text' grep cd 2>/dev/null 2>/dev/null
+		2>/dev/null | done x=1 done 2>/dev/null local "$1" grep printf &&
+	'quoted text' local then export --verbose awk printf 'quoted text' awk
+		2>/dev/null | --verbose
+/usr/bin test ${HOME} 2>/dev/null $(pwd)
+	awk sed sed test awk -eu sed "$1" && sed export echo $(pwd) ${HOME} sed
+x=1 printf test sed sed -eu --verbose -eu sed "$@" test awk "$1" "$@"
+	export --verbose ${HOME} 'quoted text' ${HOME} done
+		x=1 -eu "$1" grep done then sed then printf -eu x=1 echo sed cd readonly
+awk --verbose sed -eu awk -eu /usr/bin --verbose grep $(pwd)
+	test test 2>/dev/null local && export cd && echo
+		'quoted text' readonly x=1 'quoted text'
+local then /usr/bin local then sed -eu export -eu
+		awk grep done test 2>/dev/null printf 'quoted text' echo export
+	then "$@" $(pwd) -eu done $(pwd) readonly local test 2>/dev/null
+	${HOME} readonly local
+"$1" printf 'quoted text' x=1 export sed
+"$@" done grep readonly --verbose grep awk grep ${HOME} awk
+		2>/dev/null 'quoted text' grep "$@" -eu export done done local |
+	| 'quoted text' then "$1" cd $(pwd) "$1" "$@" $(pwd) | local printf done
+		printf echo printf $(pwd) cd awk echo sed x=1 ${HOME} echo 2>/dev/null
+--verbose printf 'quoted text' | "$1" done grep test export 2>/dev/null then
+	grep awk ${HOME} export cd -eu grep "$@" ${HOME} 2>/dev/null local /usr/bin
+grep 'quoted text' test 'quoted text' cd ${HOME}
+	2>/dev/null readonly "$@" test local readonly -eu export
+		x=1 test x=1 sed local echo export
+cd awk | test && sed grep && "$1" "$@"
+	x=1 cd ${HOME} local /usr/bin
+	--verbose awk 'quoted text' 2>/dev/null then "$1" local && | grep then &&
+		| awk readonly | readonly echo grep readonly /usr/bin "$@" cd --verbose
+		test sed && 'quoted text'
+		awk done "$@" cd "$@" test "$@"
+		done grep 'quoted text' $(pwd) x=1 | done --verbose
+"$1" "$@" sed --verbose echo test 'quoted text' echo --verbose "$1" 'quoted text'
+		awk $(pwd) export awk echo "$1" && then
+	then ${HOME} --verbose sed | && local 2>/dev/null 'quoted text'
+${HOME} -eu test ${HOME}
+	'quoted text' local | echo $(pwd) readonly printf done "$@" -eu "$1" && x=1
+		/usr/bin /usr/bin printf "$@" 2>/dev/null local
+| local done $(pwd) grep x=1 $(pwd) awk $(pwd) | /usr/bin local local && done
+grep grep printf readonly export ${HOME} cd grep && "$@" && "$1" local grep echo
+done 'quoted text' "$1" then x=1 x=1 test "$@" && x=1 "$@"
+awk x=1 && cd cd local |
+	done awk export cd --verbose readonly sed $(pwd) echo echo $(pwd) --verbose
+'quoted text' | "$@" "$1"
+	printf && -eu 2>/dev/null echo local
+	/usr/bin ${HOME} 'quoted text' "$1"
+		-eu export export "$1" "$@" 'quoted text' "$@" $(pwd) echo "$@" printf 2>/dev/null
+"$@" grep export echo cd then
+	echo 2>/dev/null test "$@" ${HOME} awk /usr/bin && "$@" ${HOME}
+	awk readonly export --verbose x=1 cd "$1" test sed 2>/dev/null | x=1
+then done sed 2>/dev/null
+	"$@" ${HOME} then readonly --verbose "$@"
+	'quoted text' readonly local echo $(pwd) 'quoted text' awk test
+		done ${HOME} 2>/dev/null "$@" | x=1 2>/dev/null
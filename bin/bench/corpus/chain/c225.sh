@@ -0,0 +1,2001 @@
+		grep local cd --verbose | export then cd | awk /usr/bin grep "$@" 2>/dev/null
+	2>/dev/null printf export && -eu -eu done /usr/bin
+$(pwd) readonly x=1 export ${HOME} export -eu awk
+	| grep done done "$@" /usr/bin
+grep cd 'quoted text'
+	sed grep readonly then && --verbose x=1 awk $(pwd) 2>/dev/null grep
+echo 2>/dev/null test $(pwd)
+		test local done test "$1" /usr/bin echo | grep
+		echo | "$@" export printf printf ${HOME} && export "$1" export
+		"$@" sed "$1" sed 2>/dev/null && "$1" cd -eu grep test cd "$1" $(pwd) awk
+		x=1 readonly readonly then cd test done --verbose cd grep test done
+'quoted text' test | readonly done | --verbose ${HOME} echo sed && /usr/bin
+awk grep $(pwd) cd readonly -eu x=1 sed x=1 && cd test printf "$1"
+		/usr/bin printf /usr/bin export printf 'quoted text'
+local awk test echo local $(pwd)
+	cd && --verbose "$@" cd "$@" awk grep | readonly
+		awk local --verbose 'quoted text'
+		test 'quoted text' sed cd cd 'quoted text' &&
+		x=1 2>/dev/null ${HOME} readonly
+	local ${HOME} x=1 printf test $(pwd) && then echo local | && done
+		&& grep grep "$1" "$@" -eu
+		echo grep done sed done test local && readonly test -eu -eu echo echo
+echo export printf /usr/bin ${HOME} ${HOME} grep done export && && cd test
+export && $(pwd) x=1 local printf awk printf
+		done done --verbose local then && && cd readonly --verbose $(pwd) local "$1"
+	readonly | export printf cd grep echo $(pwd) done
+${HOME} /usr/bin printf local sed readonly echo done test | ${HOME} cd echo
+	cd export 'quoted text' test cd sed grep then "$@" readonly export grep && local
+		export | printf awk -eu local local && grep done | "$1" | ${HOME} done export
+	${HOME} ${HOME} && then -eu | x=1 $(pwd) "$1" /usr/bin
+grep | test test cd printf local | done
+readonly $(pwd) 2>/dev/null export local then export local ${HOME} x=1 grep
+cd x=1 readonly awk && x=1 "$@" grep cd cd cd -eu grep
+		done local test test 2>/dev/null cd done test "$@" awk --verbose
+local -eu then printf readonly test
+local then /usr/bin && local ${HOME} test | test "$@" printf "$1" readonly local
+echo 'quoted text' readonly 'quoted text' 'quoted text'
+sed export readonly local "$@" awk then 2>/dev/null $(pwd)
+	sed | awk export export sed done readonly --verbose -eu echo
+		-eu sed /usr/bin done export /usr/bin awk
+x=1 'quoted text' 'quoted text' -eu cd grep readonly
+	-eu readonly local ${HOME} grep echo test awk -eu export
+echo awk local ${HOME} && test 'quoted text' $(pwd) echo -eu
+	test done test -eu done --verbose
+test --verbose -eu grep done $(pwd) local echo
+local $(pwd) 2>/dev/null x=1 x=1 --verbose readonly -eu
+--verbose readonly --verbose
+	test grep | printf "$1" -eu then printf
+		x=1 x=1 sed /usr/bin grep "$@" grep --verbose
+		done then echo x=1 | /usr/bin cd cd then $(pwd) 2>/dev/null
+then then then done "$1" readonly "$@" 2>/dev/null ${HOME} --verbose export
+-eu readonly x=1 readonly && ${HOME} --verbose /usr/bin grep -eu then "$1" echo
+done then -eu "$1" "$1" /usr/bin sed x=1 "$@"
+		'quoted text' 'quoted text'
+/usr/bin echo "$@" export 2>/dev/null then awk then cd local echo cd local
+local export "$@" && echo test export "$1" local
+		&& grep $(pwd) echo then
+done ${HOME} grep cd --verbose "$1" export awk /usr/bin $(pwd)
+		grep x=1 'quoted text' --verbose -eu awk done 2>/dev/null readonly "$@" | awk grep
+		-eu awk printf | done 2>/dev/null --verbose "$1" --verbose -eu
+		'quoted text' | sed local echo
+	-eu local 2>/dev/null $(pwd) /usr/bin 2>/dev/null awk && "$1"
+	| done /usr/bin grep "$@" local cd -eu then /usr/bin "$@" &&
+	"$1" /usr/bin x=1 ${HOME} done readonly
+--verbose /usr/bin "$1" local "$1" ${HOME} -eu 'quoted text' then printf
+'quoted text' done grep echo "$@" x=1 ${HOME} | "$@" && readonly
+		echo --verbose 2>/dev/null then
+${HOME} cd "$@" grep /usr/bin done
+		"$1" sed | readonly -eu "$1" "$@" |
+		"$1" "$@" test export sed -eu
+		export awk x=1 test | readonly test
+		sed 'quoted text' && /usr/bin "$@" 2>/dev/null awk done
+	echo echo echo /usr/bin $(pwd) awk x=1 2>/dev/null readonly "$1"
+		--verbose readonly 2>/dev/null | export local test --verbose then test then 2>/dev/null
+printf ${HOME} then 2>/dev/null awk echo ${HOME}
+		then printf awk grep cd ${HOME} test -eu
+	done 'quoted text' "$@" printf echo $(pwd)
+test 'quoted text' ${HOME}
+		| sed printf awk /usr/bin sed grep export test export awk --verbose readonly
+/usr/bin awk $(pwd) | "$1" done 2>/dev/null x=1 printf
+	/usr/bin sed echo sed --verbose && ${HOME} cd | then --verbose
+grep local cd export /usr/bin
+		echo then 2>/dev/null readonly
+		/usr/bin $(pwd) echo | then "$@" readonly $(pwd) awk 2>/dev/null
+done 2>/dev/null done && --verbose
+	x=1 sed /usr/bin printf ${HOME} 'quoted text' "$1" sed local printf export
+	x=1 "$@" test "$1" export x=1 then sed
+		then export | && && grep | printf ${HOME} local
+		--verbose then sed 2>/dev/null
+| 2>/dev/null local export readonly awk /usr/bin "$@" cd $(pwd) grep
+	2>/dev/null awk echo awk grep "$1" --verbose && cd "$1" sed readonly
+readonly sed export /usr/bin /usr/bin export
+x=1 grep test sed $(pwd) 'quoted text' readonly sed awk done
+		&& "$1" then ${HOME} local $(pwd) -eu local ${HOME}
+	--verbose echo && local test test 'quoted text'
+		grep | ${HOME} && echo --verbose && 'quoted text' readonly --verbose then awk
+awk cd cd grep grep --verbose "$@" | 2>/dev/null awk
+sed local && done readonly readonly | readonly 'quoted text'
+echo then x=1 done x=1 --verbose $(pwd) done "$@" $(pwd)
+		export | export x=1 | ${HOME} sed cd test printf "$1" "$@" "$1" |
+	-eu done cd export "$@" ${HOME} $(pwd) export -eu 'quoted text' --verbose echo
+		cd grep -eu local && ${HOME}
+readonly test 'quoted text' sed /usr/bin /usr/bin sed awk "$@" 2>/dev/null
+	/usr/bin awk "$1" $(pwd) --verbose $(pwd)
+| local /usr/bin x=1 sed sed -eu printf 'quoted text'
+		| readonly -eu && ${HOME} 2>/dev/null cd
+	done printf test readonly test x=1 grep
+		grep x=1 "$1" "$1" done awk done 2>/dev/null -eu 2>/dev/null 'quoted text'
+	test $(pwd) test ${HOME} readonly x=1 local
+cd then | then readonly -eu readonly then echo test readonly "$1" ${HOME} "$1"
+2>/dev/null /usr/bin printf test ${HOME} $(pwd)
+		2>/dev/null export 'quoted text' ${HOME} grep cd 2>/dev/null
+		2>/dev/null done cd grep /usr/bin
+		export /usr/bin awk cd done -eu local cd sed | cd printf sed
+cd readonly awk test local "$1" $(pwd) cd export "$@" echo grep grep -eu
+-eu "$@" export 'quoted text'
+echo sed "$@" sed 2>/dev/null
+		"$@" test sed $(pwd) x=1 $(pwd) printf -eu printf
+		sed -eu x=1 local cd --verbose
+local done then then "$1"
+'quoted text' ${HOME} echo test | echo echo cd | --verbose grep $(pwd) "$@"
+	cd grep --verbose export $(pwd) "$1"
+then ${HOME} readonly $(pwd) awk then local x=1 "$@" 'quoted text'
+		local export x=1 sed sed 'quoted text'
+	$(pwd) readonly printf
+	readonly | 'quoted text' done 2>/dev/null 2>/dev/null
+		'quoted text' echo -eu printf done "$1" cd
+awk x=1 'quoted text' $(pwd) cd "$1" && --verbose ${HOME}
+	printf ${HOME} /usr/bin
+	-eu readonly grep x=1 $(pwd) | "$@" readonly
+	&& readonly | "$1" $(pwd) export cd sed readonly
+local echo 'quoted text'
+	printf -eu readonly 2>/dev/null sed --verbose
+		$(pwd) "$@" cd ${HOME} x=1 printf printf ${HOME} "$1" ${HOME} then sed grep sed
+-eu -eu && | readonly x=1 cd 'quoted text' printf | x=1 /usr/bin awk
+	2>/dev/null "$1" local /usr/bin cd cd "$@" /usr/bin
+/usr/bin cd test done x=1 | -eu grep done echo sed
+| ${HOME} done 2>/dev/null
+/usr/bin done $(pwd)
+		'quoted text' -eu "$1" 'quoted text' "$1"
+		export "$1" ${HOME} cd && 2>/dev/null done 'quoted text' $(pwd) $(pwd)
+--verbose $(pwd) awk grep grep export sed
+		| -eu export "$1" | 'quoted text' printf cd --verbose
+		export -eu | x=1 done -eu readonly then "$@"
+		"$1" x=1 --verbose 2>/dev/null
+grep 'quoted text' && readonly awk 2>/dev/null | echo -eu "$@" echo
+		x=1 test sed sed -eu test --verbose
+		${HOME} sed export "$@" local
+		&& awk test $(pwd) sed ${HOME} awk ${HOME} --verbose | /usr/bin then readonly
+-eu | 2>/dev/null local ${HOME} local test | then then "$@"
+printf && | done then then
+then -eu export cd "$@" grep export ${HOME}
+"$@" done awk 'quoted text' "$@"
+	/usr/bin 'quoted text' | && "$@" x=1 cd | echo "$@" 2>/dev/null ${HOME} "$1" done
+		| --verbose then export cd awk export
+		printf 2>/dev/null then
+		/usr/bin sed grep grep ${HOME} cd sed --verbose echo
+sed ${HOME} local readonly
+		then x=1 'quoted text' && printf then export export "$1" -eu readonly
+		--verbose sed test "$1" sed x=1 $(pwd) -eu done
+		'quoted text' cd printf export x=1 done echo
+		--verbose && sed 'quoted text' done done x=1 test
+		$(pwd) export then then grep
+		printf "$1" ${HOME} then readonly
+	export sed -eu sed cd -eu export readonly readonly
+		-eu printf "$1" x=1 done 2>/dev/null "$1" && test printf
+grep readonly "$1" export /usr/bin && --verbose export x=1 | cd export
+	printf | "$1" readonly "$1" test test
+		x=1 ${HOME} ${HOME} then x=1 $(pwd) cd printf
+'quoted text' grep --verbose /usr/bin 'quoted text' cd ${HOME} /usr/bin 'quoted text'
+	then local export export sed | echo | $(pwd) && /usr/bin local
+echo grep local "$1" printf --verbose "$1" /usr/bin $(pwd) printf "$@" done
+awk echo 2>/dev/null ${HOME} && ${HOME} then ${HOME} --verbose printf /usr/bin
+"$@" then echo echo --verbose
+		local && done /usr/bin "$@" then 'quoted text' readonly printf
+	printf -eu && awk -eu echo printf sed "$@" /usr/bin cd printf
+	grep $(pwd) | grep sed test done && cd && ${HOME} printf cd -eu grep readonly
+test ${HOME} sed grep awk local cd cd 'quoted text'
+	'quoted text' x=1 /usr/bin done x=1 | "$1" cd "$1" done
+	echo 2>/dev/null done awk test local | sed $(pwd) -eu $(pwd) printf 2>/dev/null
+readonly | --verbose done ${HOME} | && export x=1 x=1 $(pwd) --verbose
+		done && /usr/bin && 'quoted text' -eu
+	/usr/bin && echo awk $(pwd) -eu /usr/bin --verbose "$@" && "$@" | test 2>/dev/null
+	2>/dev/null done 2>/dev/null export $(pwd)
+		cd then ${HOME} -eu --verbose --verbose $(pwd) awk
+--verbose local | export x=1 readonly
+		--verbose grep | then && && --verbose /usr/bin done grep test
+2>/dev/null local awk export "$1" x=1 --verbose then
+		${HOME} "$1" "$@" 'quoted text' "$@" | awk "$@"
+		x=1 printf $(pwd) printf awk export echo grep
+		then && "$1" "$@" export export printf x=1 "$1" "$1" $(pwd)
+		${HOME} printf | echo $(pwd) then grep "$1"
+		'quoted text' $(pwd) sed grep -eu --verbose local 'quoted text'
+grep export test 'quoted text'
+		--verbose awk cd && readonly $(pwd) awk
+		2>/dev/null export 2>/dev/null | done readonly | 2>/dev/null echo "$1" --verbose
+	/usr/bin "$@" cd 'quoted text' 'quoted text' 2>/dev/null readonly --verbose 2>/dev/null
+		&& echo --verbose x=1 sed | cd "$1" 2>/dev/null -eu &&
+		$(pwd) local -eu test printf test echo
+		then && $(pwd) test 2>/dev/null
+2>/dev/null ${HOME} 2>/dev/null $(pwd) "$@" awk
+"$@" sed cd -eu -eu cd "$@"
+		2>/dev/null 2>/dev/null 2>/dev/null readonly
+2>/dev/null 2>/dev/null local 2>/dev/null /usr/bin printf 2>/dev/null "$@" 2>/dev/null
+		local local && awk grep
+		/usr/bin "$1" && | export echo local
+	-eu && grep export ${HOME} --verbose local
+	&& "$@" -eu readonly ${HOME} printf | ${HOME} --verbose
+x=1 cd printf 2>/dev/null "$@" --verbose 'quoted text'
+	--verbose 'quoted text' 2>/dev/null "$@" grep --verbose local | awk /usr/bin
+	echo /usr/bin printf && $(pwd) done && -eu export "$@" "$@" -eu then sed
+		-eu echo grep readonly local cd done local done | cd x=1 cd grep test x=1 printf
+		| test "$1" sed --verbose readonly 'quoted text' export
+| $(pwd) cd -eu && && readonly
+		x=1 echo /usr/bin local "$1" --verbose 'quoted text'
+test $(pwd) && then ${HOME} 2>/dev/null awk 'quoted text'
+		| x=1 | "$@" $(pwd) x=1 /usr/bin test 'quoted text' "$@" then test ${HOME}
+	sed "$1" 'quoted text' 'quoted text'
+2>/dev/null $(pwd) done && test -eu printf "$1"
+| && /usr/bin 2>/dev/null "$@" then | ${HOME} then -eu $(pwd) $(pwd) --verbose
+		2>/dev/null printf 2>/dev/null sed
+	local -eu /usr/bin sed grep
+local cd 2>/dev/null export | $(pwd) sed awk ${HOME} echo
+	x=1 then readonly printf -eu "$1" echo --verbose ${HOME} test echo /usr/bin
+	x=1 cd readonly done awk &&
+sed then "$1" sed cd 'quoted text' | x=1 -eu && awk
+	"$@" echo grep | cd 2>/dev/null --verbose && "$@" /usr/bin
+		readonly test 'quoted text' cd local
+done -eu 2>/dev/null --verbose echo -eu 2>/dev/null /usr/bin "$@"
+		sed 'quoted text' --verbose "$@" 2>/dev/null 2>/dev/null readonly
+	$(pwd) awk && then then then readonly test -eu sed echo -eu grep awk
+		awk 'quoted text' test echo "$1" 'quoted text' sed local done local
+echo 2>/dev/null export export | then --verbose
+$(pwd) 'quoted text' cd "$@" && /usr/bin local local -eu /usr/bin local cd
+&& cd then cd local $(pwd)
+done -eu echo local 2>/dev/null
+		done cd | --verbose readonly --verbose 2>/dev/null
+	"$1" 'quoted text' echo
+		export -eu sed "$1" awk | grep && cd 'quoted text'
+	cd readonly cd test -eu cd && "$@" then && | -eu local
+		"$@" && ${HOME} awk -eu cd "$1" 2>/dev/null
+		test done sed 'quoted text' printf "$1" && local sed local "$@" done 2>/dev/null
+	export | grep export ${HOME} local | printf 'quoted text' done
+		local cd then done $(pwd) test grep x=1 local export $(pwd) echo 'quoted text'
+	readonly 2>/dev/null awk "$1" 'quoted text' --verbose
+	${HOME} "$1" --verbose x=1 ${HOME} echo done
+	| 'quoted text' $(pwd)
+printf then printf -eu ${HOME} then
+		readonly echo echo done ${HOME} && sed awk local printf "$1"
+		then sed export x=1 && printf
+		awk readonly readonly readonly 2>/dev/null then cd then readonly
+&& sed then sed $(pwd) && "$1" "$@" 2>/dev/null awk
+grep -eu test 'quoted text' cd printf readonly grep
+		then -eu -eu sed then -eu -eu 'quoted text'
+	local echo printf local export | export "$1" --verbose
+		'quoted text' done 2>/dev/null ${HOME}
+/usr/bin local cd then echo "$1" $(pwd) done ${HOME} "$@"
+		readonly 2>/dev/null echo grep 'quoted text'
+		test -eu export grep /usr/bin $(pwd) x=1 printf export x=1 -eu then 'quoted text'
+	"$1" "$1" -eu --verbose done $(pwd) 2>/dev/null "$@" then printf done && readonly
+	export local "$@" /usr/bin grep readonly done
+		/usr/bin then --verbose "$1" echo awk grep /usr/bin
+		"$@" && --verbose $(pwd)
+--verbose local --verbose echo ${HOME} -eu test
+	done /usr/bin grep /usr/bin cd echo && awk cd --verbose
+		export awk sed readonly --verbose
+cd x=1 printf 2>/dev/null done export done -eu
+"$@" readonly ${HOME} cd export awk
+	-eu ${HOME} then x=1 then grep local x=1 done then
+awk -eu cd $(pwd) --verbose "$@" local --verbose
+		local && && done "$1" /usr/bin 'quoted text' export
+	local $(pwd) done "$1" 2>/dev/null
+		local grep "$@" sed && | awk cd /usr/bin awk ${HOME} echo printf --verbose
+	echo ${HOME} printf ${HOME} --verbose
+		echo $(pwd) 'quoted text' export
+		| /usr/bin $(pwd) $(pwd) then | -eu
+	-eu grep --verbose -eu cd
+'quoted text' export "$1" grep then --verbose
+		$(pwd) x=1 echo test 'quoted text' sed sed then
+	printf awk sed printf awk awk sed | printf && $(pwd) awk
+		sed x=1 export 2>/dev/null ${HOME} cd export
+done -eu ${HOME} readonly /usr/bin printf -eu grep ${HOME} then -eu cd then sed
+	x=1 export $(pwd) test cd "$@" readonly /usr/bin "$@" ${HOME}
+'quoted text' "$1" awk -eu printf echo $(pwd) 2>/dev/null
+	sed sed "$@" "$@" export local export grep "$1" && then grep export grep echo
+"$@" /usr/bin | echo 2>/dev/null $(pwd) -eu done x=1
+		cd sed -eu echo sed -eu sed then x=1 sed
+	x=1 ${HOME} done cd --verbose echo awk
+		/usr/bin local /usr/bin 'quoted text' printf "$1" export readonly local
+		echo local done local test awk echo test 'quoted text' 2>/dev/null
+done ${HOME} awk x=1 -eu && local
+	/usr/bin printf local "$@" local 2>/dev/null sed echo sed cd cd
+	${HOME} && -eu then awk /usr/bin cd &&
+	test 'quoted text' cd && done then cd && --verbose /usr/bin --verbose $(pwd)
+| grep --verbose export "$@" ${HOME} x=1 2>/dev/null
+awk $(pwd) grep && -eu "$1" "$1" cd local
+	| -eu awk 2>/dev/null -eu --verbose
+	awk sed $(pwd) | && export | && --verbose
+		done cd 2>/dev/null local grep
+	local test x=1 'quoted text' test && grep done -eu "$1"
+| ${HOME} local ${HOME} 2>/dev/null echo test test readonly export readonly | ${HOME}
+readonly && export done "$@" x=1 export export printf cd sed export echo -eu readonly
+		x=1 test readonly cd grep echo 'quoted text' x=1 x=1 -eu grep done ${HOME}
+		| x=1 --verbose 2>/dev/null
+${HOME} 2>/dev/null done --verbose
+sed test 2>/dev/null echo sed echo readonly then
+cd 2>/dev/null then 2>/dev/null /usr/bin sed cd printf
+	sed && export x=1 awk $(pwd) then | readonly test | | awk |
+		printf ${HOME} awk x=1 "$@" awk then grep 2>/dev/null
+		/usr/bin test ${HOME} "$1" grep -eu $(pwd) x=1
+echo "$1" 2>/dev/null $(pwd) && -eu 'quoted text'
+		printf grep printf ${HOME} | -eu cd $(pwd) 2>/dev/null awk
+	cd | 2>/dev/null then readonly done $(pwd) | awk
+	export x=1 $(pwd) echo 2>/dev/null local ${HOME} "$@" cd
+		printf cd grep then then echo then test /usr/bin export /usr/bin
+sed --verbose ${HOME} awk /usr/bin readonly export
+	done $(pwd) cd grep local x=1 -eu printf $(pwd) cd && &&
+--verbose "$@" readonly grep done x=1
+| ${HOME} grep local /usr/bin printf -eu --verbose --verbose
+/usr/bin printf "$@" readonly 2>/dev/null | export "$1" printf --verbose | "$1"
+		-eu 2>/dev/null "$@" local 'quoted text'
+		&& && --verbose then x=1 cd grep grep then
+	export $(pwd) printf cd then then echo done /usr/bin
+	${HOME} /usr/bin | "$1" done then local readonly /usr/bin
+"$1" then sed 'quoted text' 'quoted text' done && grep readonly echo
+		2>/dev/null sed && && --verbose --verbose /usr/bin awk then
+		| done printf printf done printf done "$1" done
+	printf test printf --verbose ${HOME}
+		then /usr/bin "$1" $(pwd) $(pwd)
+export | /usr/bin ${HOME} "$@" done cd test readonly export local
+		local 'quoted text' x=1 awk "$@" echo grep grep
+		"$1" sed echo export test export | grep done --verbose then
+2>/dev/null $(pwd) done
+	--verbose -eu 'quoted text' then
+	'quoted text' 'quoted text'
+2>/dev/null --verbose &&
+	$(pwd) 2>/dev/null /usr/bin && done cd x=1 grep echo test readonly
+		grep "$@" cd local "$@" printf sed ${HOME} awk 'quoted text'
+	awk test ${HOME} test "$@" | /usr/bin "$1" grep sed && then
+		sed grep ${HOME} /usr/bin "$1" cd local export export --verbose
+printf cd && grep "$@" ${HOME} "$1" ${HOME} local local $(pwd) test
+	printf cd echo -eu --verbose "$1" readonly done
+	"$1" test cd done local awk /usr/bin sed 2>/dev/null
+	grep grep 'quoted text' "$@" "$1" sed done --verbose
+	grep printf awk test cd
+	sed export export sed done ${HOME} -eu "$1" grep $(pwd) test
+sed "$@" local 2>/dev/null
+	2>/dev/null "$1" ${HOME} "$1" $(pwd) printf grep awk $(pwd) && printf
+	--verbose awk 'quoted text' printf
+		readonly | --verbose -eu --verbose $(pwd) echo x=1 && x=1
+		"$1" done 2>/dev/null export -eu grep && readonly
+	"$@" --verbose cd ${HOME} 'quoted text'
+	cd export local echo ${HOME} test -eu /usr/bin
+		readonly x=1 awk echo
+	x=1 'quoted text' --verbose done readonly ${HOME} done grep cd
+echo -eu /usr/bin printf /usr/bin echo ${HOME} ${HOME} local test
+export x=1 "$@" done | test ${HOME} readonly "$1"
+export ${HOME} echo 'quoted text' -eu cd readonly test grep
+		| 'quoted text' "$1" 2>/dev/null $(pwd)
+2>/dev/null 'quoted text' echo $(pwd) "$1" && ${HOME} 2>/dev/null
+	x=1 ${HOME} test "$@"
+		${HOME} cd /usr/bin && awk 2>/dev/null | grep export echo test
+		x=1 printf 'quoted text' awk done "$1" 'quoted text'
+	${HOME} ${HOME} grep "$@" readonly
+	export test sed $(pwd) ${HOME} done local 2>/dev/null echo x=1
+readonly export grep | echo --verbose
+		'quoted text' echo readonly awk
+		| | -eu test "$@" test ${HOME} done grep grep "$1" test -eu 2>/dev/null $(pwd)
+/usr/bin then "$@" 'quoted text' && -eu test $(pwd) 2>/dev/null
+	cd x=1 grep echo $(pwd) readonly --verbose local
+		$(pwd) sed 'quoted text'
+		'quoted text' local then ${HOME} --verbose x=1 sed $(pwd)
+		sed sed -eu /usr/bin export then | then "$1" awk echo "$@" "$@" "$1" | readonly
+	done cd echo test local x=1 readonly grep 2>/dev/null
+		sed 2>/dev/null test 'quoted text' --verbose
+--verbose cd /usr/bin ${HOME} x=1 awk 2>/dev/null local sed
+	sed grep ${HOME} 2>/dev/null "$@" ${HOME} && export ${HOME} then cd
+	export "$1" | x=1 awk
+		done test export cd -eu x=1 cd 'quoted text' --verbose export -eu test x=1 ${HOME}
+"$1" local then printf
+		awk 'quoted text' | x=1 readonly test "$1"
+| x=1 "$1" && 'quoted text' readonly done printf 'quoted text' && test echo printf
+"$1" done | 2>/dev/null then "$@" "$1" 'quoted text' /usr/bin local
+	printf --verbose done $(pwd) "$1" $(pwd) -eu /usr/bin
+export awk then echo done "$1" ${HOME} export done local sed test -eu $(pwd)
+		printf --verbose then grep 'quoted text' x=1 echo awk echo ${HOME} local &&
+		local export --verbose 2>/dev/null
+	grep readonly /usr/bin local -eu $(pwd) awk | 2>/dev/null local -eu test grep done
+		&& done echo printf && local -eu readonly 'quoted text'
+	test printf awk cd x=1 grep x=1 $(pwd) export /usr/bin
+		echo echo "$@" test ${HOME} test export
+	grep done "$1" --verbose -eu /usr/bin 2>/dev/null
+	x=1 x=1 echo --verbose "$1" && sed 2>/dev/null
+		export printf ${HOME} -eu x=1 "$@" local printf
+cd echo && grep awk ${HOME} printf "$@"
+		x=1 sed 2>/dev/null 2>/dev/null test
+cd local grep $(pwd) /usr/bin | test export then
+	done sed printf awk -eu export
+2>/dev/null ${HOME} && 'quoted text'
+		local /usr/bin | x=1 && export echo && | 'quoted text'
+echo "$1" test && sed echo x=1 /usr/bin
+test echo | ${HOME} done x=1 "$1" -eu readonly test
+	&& export && test sed then then -eu
+	sed echo readonly "$1" printf done then ${HOME}
+		${HOME} sed ${HOME} local "$1"
+--verbose 'quoted text' "$@" 'quoted text' ${HOME} --verbose
+		-eu "$@" test printf grep && x=1 'quoted text' --verbose sed readonly 2>/dev/null
+	--verbose | /usr/bin awk -eu /usr/bin $(pwd) grep 2>/dev/null && awk $(pwd)
+	--verbose -eu printf printf
+	"$@" local echo local echo export /usr/bin printf 'quoted text' --verbose
+	awk cd && | sed --verbose test export | --verbose readonly done
+	local test test "$1" && grep "$@"
+	-eu $(pwd) grep printf echo test printf cd test ${HOME} 'quoted text'
+		"$@" 2>/dev/null export | readonly ${HOME} cd echo | sed 2>/dev/null grep done
+	readonly printf readonly --verbose test && |
+	x=1 local --verbose ${HOME}
+		'quoted text' then awk done
+	| /usr/bin sed then x=1 cd x=1
+		&& sed x=1 | && && && --verbose /usr/bin "$@" cd test 'quoted text'
+		echo "$1" "$1" $(pwd) test export then -eu -eu "$@" sed "$@"
+		awk "$1" $(pwd) && /usr/bin local "$@"
+	then done echo $(pwd)
+		done x=1 -eu $(pwd) cd 'quoted text' cd ${HOME} 'quoted text' 'quoted text'
+'quoted text' export
+	echo "$@" | sed 2>/dev/null awk 'quoted text' 2>/dev/null echo
+		--verbose x=1 && "$1" readonly --verbose
+	echo sed /usr/bin export $(pwd) && awk x=1 &&
+	2>/dev/null && echo readonly --verbose export awk /usr/bin 2>/dev/null
+/usr/bin && --verbose cd 2>/dev/null "$1" -eu -eu done awk echo
+-eu readonly export "$1"
+grep export sed --verbose -eu test $(pwd) echo sed
+then awk then ${HOME} echo local
+2>/dev/null awk readonly x=1 ${HOME} sed local -eu 2>/dev/null then export
+	done test x=1 printf x=1 cd x=1 $(pwd) cd readonly done awk cd grep --verbose
+--verbose then "$@" then sed 'quoted text'
+		'quoted text' sed awk && --verbose "$1"
+		echo 2>/dev/null export 'quoted text' ${HOME} printf /usr/bin export "$@" && --verbose
+	"$1" cd -eu then grep awk 2>/dev/null test readonly echo cd --verbose then x=1
+		"$1" grep ${HOME} /usr/bin grep test cd
+| && echo export && 2>/dev/null 'quoted text'
+	'quoted text' 'quoted text' export 2>/dev/null
+	cd grep x=1 then cd 2>/dev/null $(pwd) then x=1 echo done sed | grep
+echo /usr/bin printf export grep sed local cd cd
+		sed done "$1" x=1 | $(pwd) printf ${HOME} "$1" echo "$@" local -eu printf
+	test printf -eu /usr/bin done export "$1"
+	-eu 2>/dev/null sed local local && x=1 $(pwd) echo --verbose readonly x=1
+	-eu "$@" --verbose | "$1" sed && printf
+"$@" awk /usr/bin "$1" grep "$@" local 'quoted text'
+	x=1 $(pwd) x=1 $(pwd) printf x=1 $(pwd) test done local -eu grep export then printf
+	export then grep --verbose cd 2>/dev/null local export cd x=1 --verbose
+	--verbose printf $(pwd) local echo 'quoted text' 'quoted text'
+then 'quoted text' test ${HOME} x=1 sed
+/usr/bin 'quoted text' ${HOME} export awk
+	/usr/bin local then ${HOME} cd "$@" local /usr/bin x=1 ${HOME} sed /usr/bin x=1
+		${HOME} test done x=1 then sed sed cd x=1 export test 2>/dev/null
+		sed "$1" ${HOME} ${HOME} done
+		local -eu ${HOME} then $(pwd) "$1" 2>/dev/null $(pwd) local awk
+	&& 2>/dev/null "$1" echo local
+	readonly grep /usr/bin $(pwd) test printf readonly && $(pwd) --verbose awk
+	x=1 "$1" --verbose "$1" | --verbose
+x=1 local test 2>/dev/null grep 2>/dev/null 'quoted text'
+		grep printf awk 'quoted text'
+local $(pwd) printf sed $(pwd) $(pwd) "$@" ${HOME} 'quoted text' "$@" -eu
+		printf --verbose "$1" x=1 local ${HOME} test done cd awk printf ${HOME}
+	done printf "$1" export grep 'quoted text' grep --verbose cd test "$1" |
+		x=1 -eu /usr/bin then "$1" 2>/dev/null $(pwd)
+		test local then /usr/bin test
+	awk x=1 && | readonly | cd 'quoted text' x=1 local --verbose awk 2>/dev/null
+then 2>/dev/null 2>/dev/null
+		2>/dev/null $(pwd) sed sed && readonly x=1 x=1 printf /usr/bin
+	awk done && "$1" awk then done "$1" local printf echo | --verbose
+grep 'quoted text' printf 'quoted text' grep | x=1 'quoted text' "$@" 'quoted text'
+	export cd printf && sed --verbose awk echo readonly ${HOME}
+sed readonly 'quoted text' export x=1 -eu test && grep && export -eu
+	&& $(pwd) grep readonly awk /usr/bin sed grep awk x=1
+		grep /usr/bin local /usr/bin then | $(pwd) "$1" sed grep
+	&& /usr/bin "$1" "$@"
+then sed -eu readonly -eu $(pwd) x=1 -eu /usr/bin printf awk
+-eu -eu $(pwd) export "$1" local echo then --verbose $(pwd) "$@"
+		awk then export cd export
+		x=1 "$1" x=1 'quoted text' then cd $(pwd) sed
+	echo | --verbose && 'quoted text' export
+		"$1" export cd echo sed && 'quoted text'
+		x=1 cd local test | x=1 'quoted text' ${HOME} printf /usr/bin cd "$@" /usr/bin
+echo awk ${HOME} -eu ${HOME} echo printf printf
+then "$1" 2>/dev/null $(pwd) echo cd ${HOME}
+	-eu test x=1 'quoted text' | awk 'quoted text' 2>/dev/null
+		"$1" sed done local cd x=1 "$1"
+	-eu -eu "$1" echo done local --verbose ${HOME} cd /usr/bin x=1 "$1"
+		grep sed export | echo sed export awk cd awk readonly && $(pwd) test --verbose
+		awk awk echo 2>/dev/null awk readonly $(pwd) ${HOME} then echo printf printf
+&& x=1 done grep /usr/bin --verbose $(pwd) && --verbose echo echo printf cd x=1
+awk local | -eu local test x=1 sed ${HOME} grep ${HOME} grep $(pwd)
+$(pwd) --verbose cd "$@" done && ${HOME} grep sed | 2>/dev/null x=1
+	x=1 printf x=1 /usr/bin
+	grep /usr/bin then readonly
+then cd x=1 2>/dev/null --verbose awk cd -eu "$1" -eu "$1" x=1 -eu then /usr/bin
+		"$1" printf awk -eu -eu 'quoted text'
+	| ${HOME} echo ${HOME} -eu && test local echo
+sed $(pwd) -eu ${HOME} printf printf readonly x=1
+/usr/bin grep | test | $(pwd) -eu "$@"
+		/usr/bin 'quoted text' ${HOME} --verbose x=1
+	-eu local then echo awk -eu grep echo done 2>/dev/null
+	| ${HOME} x=1 /usr/bin awk 'quoted text' --verbose
+		${HOME} /usr/bin | ${HOME} ${HOME} sed cd 2>/dev/null readonly $(pwd) then 2>/dev/null
+printf && "$1" "$1" x=1 /usr/bin -eu printf /usr/bin --verbose then --verbose
+	2>/dev/null --verbose -eu 2>/dev/null test x=1 2>/dev/null
+done echo echo "$1" printf done -eu 2>/dev/null done test ${HOME} $(pwd)
+	-eu /usr/bin /usr/bin awk then cd x=1 --verbose export --verbose then printf |
+	&& 2>/dev/null then /usr/bin sed |
+done 2>/dev/null | export cd 2>/dev/null
+'quoted text' 'quoted text'
+		${HOME} "$1" --verbose --verbose
+		local local $(pwd) grep awk then then
+then "$@" readonly x=1 --verbose echo done $(pwd)
+	"$@" "$1" local x=1 -eu 'quoted text'
+		&& 'quoted text' /usr/bin grep x=1 2>/dev/null
+printf printf then local ${HOME} cd "$@" x=1
+echo grep cd | test "$@" ${HOME} echo done ${HOME} grep awk $(pwd)
+	awk export readonly printf -eu then test 2>/dev/null awk sed
+printf && sed export 2>/dev/null
+		2>/dev/null then printf readonly
+		echo && cd 'quoted text' -eu readonly then sed grep 'quoted text' 'quoted text'
+	&& && awk printf grep 'quoted text'
+		awk 'quoted text' cd /usr/bin "$@" $(pwd) echo 2>/dev/null
+"$1" cd && -eu grep test ${HOME} ${HOME} "$1" local awk local
+test | readonly "$1" done echo -eu ${HOME} test
+	${HOME} $(pwd) "$@" /usr/bin
+then && readonly $(pwd) -eu awk && ${HOME} printf readonly cd "$1"
+	readonly printf 2>/dev/null
+printf && 'quoted text' $(pwd) awk export echo printf grep
+2>/dev/null | grep done echo ${HOME} "$@" 'quoted text'
+cd x=1 x=1 test export && cd echo local "$@" printf "$@" grep printf "$@" grep "$@"
+		then printf "$1" ${HOME} printf done /usr/bin printf export then 'quoted text'
+	then grep "$1" cd awk -eu printf
+/usr/bin ${HOME} --verbose /usr/bin 2>/dev/null
+		printf -eu 2>/dev/null 'quoted text' && test done test "$1" test $(pwd)
+	--verbose ${HOME} then then echo ${HOME} printf --verbose then
+	/usr/bin 'quoted text' x=1
+	$(pwd) local | sed awk test
+test -eu readonly && sed awk export x=1 --verbose printf
+	done cd "$1" local 'quoted text'
+export -eu --verbose ${HOME} --verbose readonly
+	${HOME} ${HOME} "$@" export grep done && && readonly test --verbose
+		--verbose $(pwd) readonly $(pwd) printf echo ${HOME}
+local | sed 2>/dev/null readonly done
+	"$@" 'quoted text' awk --verbose done export done
+		printf local $(pwd) export
+"$1" "$@" /usr/bin "$1" printf printf "$1" x=1 "$1" 2>/dev/null
+	/usr/bin then sed ${HOME} then echo echo $(pwd) "$1" printf ${HOME} --verbose
+		$(pwd) 2>/dev/null then grep "$@"
+2>/dev/null grep -eu "$1" -eu echo --verbose printf "$@" | x=1 export
+2>/dev/null then 'quoted text' then export x=1 export printf $(pwd) cd sed done
+		--verbose 2>/dev/null then awk /usr/bin
+		echo x=1 --verbose ${HOME} sed printf export $(pwd) test
+	2>/dev/null awk echo /usr/bin awk local $(pwd)
+	export cd 'quoted text' --verbose local test test grep "$@" /usr/bin
+awk | ${HOME} sed echo "$@" local local /usr/bin $(pwd) readonly | 2>/dev/null
+		echo sed 2>/dev/null "$1" done && $(pwd) "$1" cd readonly
+	done sed 'quoted text' cd sed test echo test && && echo cd "$@" then
+grep && export "$1" "$1" && awk
+		/usr/bin grep x=1 2>/dev/null
+		2>/dev/null sed done | --verbose local 2>/dev/null then echo readonly awk test
+grep then "$1" --verbose
+awk awk && grep sed | ${HOME} "$1" grep test
+'quoted text' echo printf sed echo | readonly done && printf --verbose cd
+	${HOME} 'quoted text' sed "$@" printf /usr/bin
+grep | echo --verbose cd x=1 done printf "$1" then -eu then | sed grep "$@"
+"$@" "$@" done "$1" cd export local export
+/usr/bin && 'quoted text' | echo
+	'quoted text' test $(pwd) done $(pwd) then sed -eu
+		sed ${HOME} x=1 "$1" 'quoted text'
+awk x=1 "$@" awk echo printf done printf
+		/usr/bin sed done | echo local grep
+		"$1" export sed "$@" "$1" && export | local && /usr/bin echo sed "$@"
+test 2>/dev/null then x=1 --verbose then then
+grep cd && | local sed sed export 2>/dev/null 'quoted text' x=1 readonly
+		&& ${HOME} cd 'quoted text' | 2>/dev/null export
+		-eu local local printf done /usr/bin grep && /usr/bin --verbose 2>/dev/null
+	sed sed $(pwd) x=1 echo && test grep
+"$@" awk grep sed | -eu sed readonly export awk then test
+		$(pwd) echo | && -eu 2>/dev/null 'quoted text' grep && 'quoted text'
+	'quoted text' then export "$@" /usr/bin "$1" /usr/bin test ${HOME} export done
+sed 'quoted text' done --verbose
+export $(pwd) "$@" done "$@" readonly
+cd cd | -eu "$1" local cd --verbose 2>/dev/null test export cd
+		'quoted text' 2>/dev/null echo /usr/bin awk $(pwd) "$@" then then "$@" test grep
+		/usr/bin sed printf -eu export grep test "$@" local test then ${HOME}
+		cd /usr/bin ${HOME} -eu
+"$1" --verbose grep printf then awk export $(pwd) done grep awk test readonly
+	--verbose $(pwd) cd grep then cd
+	x=1 echo ${HOME} cd test && $(pwd) sed /usr/bin then
+"$1" printf grep 2>/dev/null printf local test
+		export x=1 export | $(pwd) test /usr/bin echo then
+	test sed | ${HOME} && then export printf x=1 "$1" 'quoted text'
+then ${HOME} awk | "$1" x=1 && done "$1" | then
+"$1" done && x=1 local printf $(pwd) x=1 "$1" --verbose export
+	--verbose readonly grep | grep ${HOME} "$1" 2>/dev/null
+	$(pwd) readonly test sed
+		then /usr/bin cd printf 2>/dev/null awk printf --verbose && -eu
+test 2>/dev/null ${HOME} printf done echo printf
+then -eu /usr/bin test awk awk
+	-eu export | x=1 test "$1" | sed grep /usr/bin
+		${HOME} --verbose "$@" echo && sed done echo | $(pwd)
+&& readonly /usr/bin x=1 readonly awk sed printf test "$1" cd grep
+	--verbose readonly readonly --verbose test "$1" 2>/dev/null 'quoted text'
+"$1" -eu local ${HOME} cd local $(pwd) cd && "$1" ${HOME} $(pwd)
+&& export 2>/dev/null $(pwd) --verbose ${HOME} x=1 sed ${HOME}
+		"$@" 2>/dev/null -eu awk echo grep printf
+	/usr/bin grep cd "$1" printf /usr/bin x=1 ${HOME} "$1" | "$@" /usr/bin sed printf
+	export cd --verbose | "$1" done 'quoted text' then cd echo
+		cd x=1 grep local awk "$@"
+		"$@" -eu sed "$1" && && | readonly echo x=1 'quoted text'
+		local awk | | readonly --verbose printf -eu
+		cd test /usr/bin "$1" local -eu --verbose
+	echo done x=1 printf printf echo printf /usr/bin $(pwd) then cd sed x=1
+	$(pwd) grep --verbose done echo sed 'quoted text' 'quoted text' echo done $(pwd)
+readonly /usr/bin 'quoted text' 2>/dev/null
+grep then | readonly x=1 x=1 done awk "$@" $(pwd) awk "$@" readonly done
+	&& "$@" -eu "$@" --verbose test 'quoted text' grep
+awk && "$1" --verbose then | then awk -eu sed $(pwd) cd then x=1 test test
+	then --verbose $(pwd) sed done sed && && test && local printf
+sed echo -eu grep -eu "$@" |
+$(pwd) && cd 2>/dev/null && awk readonly readonly
+	-eu awk printf $(pwd) "$1" printf && && echo grep "$@" /usr/bin | export | "$@"
+x=1 readonly done "$1"
+done /usr/bin ${HOME} ${HOME} echo cd
+"$1" export ${HOME} grep "$1" | 2>/dev/null sed -eu $(pwd)
+		awk -eu x=1 && | sed done "$1" cd --verbose "$@" --verbose /usr/bin
+		awk awk readonly x=1 "$@"
+		${HOME} export "$@" --verbose "$1" cd 'quoted text' "$1" && test &&
+		'quoted text' x=1 $(pwd) 'quoted text' | /usr/bin
+	'quoted text' grep | then local cd /usr/bin cd printf /usr/bin
+sed cd 2>/dev/null 'quoted text' readonly
+	readonly export | | &&
+echo grep ${HOME} ${HOME} 2>/dev/null echo /usr/bin | $(pwd) -eu done readonly export
+		done awk /usr/bin done 'quoted text' x=1 && /usr/bin
+	--verbose --verbose awk "$1" done printf "$@" --verbose
+--verbose 2>/dev/null export x=1 /usr/bin && "$1" echo
+local | x=1 echo x=1 -eu && grep x=1 "$1" export export cd ${HOME}
+	export readonly then "$1" | grep done local grep sed ${HOME} --verbose
+	then printf printf cd then | && local grep awk echo ${HOME} ${HOME}
+		done grep | test awk --verbose $(pwd) grep cd $(pwd) 2>/dev/null
+	readonly test awk /usr/bin export cd done done 'quoted text' test /usr/bin
+		'quoted text' --verbose && cd awk export then readonly
+		cd --verbose --verbose "$1" awk sed /usr/bin printf /usr/bin --verbose
+		/usr/bin x=1 sed test "$@" awk 2>/dev/null local sed 2>/dev/null local 'quoted text'
+	&& /usr/bin echo sed cd 2>/dev/null /usr/bin sed
+${HOME} done x=1 cd printf
+echo echo done | --verbose then && /usr/bin |
+		2>/dev/null then awk echo
+"$1" local sed then ${HOME} | test test | grep 2>/dev/null
+awk echo cd $(pwd) 'quoted text' x=1 && sed && awk echo sed -eu grep $(pwd) cd
+	$(pwd) awk --verbose awk x=1 "$1" 'quoted text'
+	"$1" $(pwd) /usr/bin --verbose grep && echo
+	local 2>/dev/null x=1 test printf x=1 'quoted text'
+	test cd | && | sed 'quoted text'
+'quoted text' $(pwd) sed
+	then 'quoted text' && export
+"$1" /usr/bin test && 'quoted text'
+		cd done done -eu sed x=1 -eu "$@" done 2>/dev/null
+		&& "$@" sed "$@" then "$@"
+		-eu readonly && export $(pwd) cd done 'quoted text' cd done cd -eu test sed
+	local printf export "$@" printf test grep cd | grep done
+		2>/dev/null 2>/dev/null printf /usr/bin printf then readonly
+	"$1" printf readonly "$1" done $(pwd) 'quoted text'
+		grep x=1 /usr/bin 2>/dev/null grep done
+		grep x=1 /usr/bin sed local "$@" /usr/bin $(pwd) sed && ${HOME}
+		/usr/bin printf local
+	&& grep echo "$1" /usr/bin done $(pwd)
+	"$1" echo local -eu -eu
+	-eu 2>/dev/null $(pwd) 2>/dev/null done x=1 /usr/bin printf
+		x=1 2>/dev/null --verbose --verbose
+| "$@" readonly && ${HOME} grep $(pwd) /usr/bin local then /usr/bin /usr/bin
+		"$@" $(pwd) grep export -eu echo grep && x=1 printf $(pwd) sed $(pwd)
+done then 2>/dev/null
+		| "$1" then sed && readonly | test $(pwd) /usr/bin "$1" x=1 ${HOME} && done
+$(pwd) awk 'quoted text' local
+cd awk "$1" 'quoted text'
+		cd grep x=1 -eu "$@" echo sed | local done export cd x=1
+	--verbose && export 2>/dev/null "$1" x=1 x=1 readonly
+		export export && echo printf local echo export $(pwd) then
+		$(pwd) | -eu local cd echo &&
+		2>/dev/null | then echo | && then readonly printf test --verbose
+	$(pwd) "$1" readonly echo && export && grep echo "$@" "$1"
+cd awk --verbose done 2>/dev/null
+		-eu ${HOME} awk | | ${HOME}
+2>/dev/null local local && done x=1 && then 'quoted text'
+&& | then 2>/dev/null readonly sed printf echo 2>/dev/null
+		awk done printf 2>/dev/null sed "$@"
+2>/dev/null "$1" done export "$1" then grep
+2>/dev/null then /usr/bin 2>/dev/null echo --verbose
+local | "$@" readonly then export
+		"$1" /usr/bin $(pwd) 'quoted text' | local
+'quoted text' 'quoted text' cd --verbose readonly
+echo then cd export local --verbose
+	| cd && echo printf "$@" cd "$@" && readonly export echo printf done grep
+	cd local && readonly printf
+	${HOME} x=1 readonly 'quoted text' && sed 2>/dev/null
+	"$1" x=1 | echo printf sed local 'quoted text'
+	export then x=1 x=1 readonly ${HOME} cd echo ${HOME} export readonly
+	test && ${HOME} && "$1" done export
+test && "$@" /usr/bin printf --verbose 2>/dev/null printf
+&& test x=1 $(pwd) /usr/bin awk -eu "$1" -eu echo "$1"
+		awk awk printf 2>/dev/null ${HOME} test export 2>/dev/null
+		| export sed "$1" ${HOME} readonly
+		local --verbose awk ${HOME} echo test printf cd && "$1" local && && done local
+export /usr/bin 2>/dev/null local test local local printf x=1 'quoted text'
+-eu $(pwd) --verbose echo local
+		readonly -eu x=1 echo test echo "$1" | $(pwd) awk test sed sed export done ${HOME}
+		grep $(pwd) echo 'quoted text'
+printf | "$@" awk $(pwd) local $(pwd) printf cd && then
+local && && | awk done /usr/bin awk done /usr/bin --verbose "$1" then
+		--verbose export --verbose ${HOME} done /usr/bin awk "$@" cd test
+/usr/bin ${HOME} && $(pwd) x=1 /usr/bin && echo echo cd printf x=1
+printf 'quoted text' -eu x=1 readonly grep sed awk -eu "$1" 'quoted text'
+	2>/dev/null echo grep | $(pwd) --verbose cd local /usr/bin awk export awk printf
+${HOME} then echo ${HOME} test printf awk awk x=1
+2>/dev/null 'quoted text' sed && readonly done sed readonly | then echo 'quoted text'
+test | echo ${HOME} local awk local --verbose awk 2>/dev/null -eu readonly
+then x=1 x=1 printf test 'quoted text' ${HOME}
+		-eu grep sed x=1 printf test -eu local readonly
+	2>/dev/null test cd "$@" test then /usr/bin echo readonly /usr/bin
+		--verbose | sed -eu grep local export
+		then awk && /usr/bin awk sed $(pwd) 'quoted text' -eu && $(pwd) -eu
+'quoted text' test 2>/dev/null 'quoted text' printf echo awk ${HOME}
+		| echo ${HOME} grep test
+		-eu readonly readonly x=1 "$@" 2>/dev/null ${HOME} test
+		export 'quoted text' awk sed grep done $(pwd) "$1" then then done -eu
+"$1" grep test 2>/dev/null && "$@"
+	cd local 2>/dev/null done test --verbose sed echo /usr/bin echo test "$@" $(pwd)
+		-eu ${HOME} echo /usr/bin $(pwd) /usr/bin printf "$@"
+'quoted text' --verbose ${HOME} readonly | /usr/bin && done $(pwd) export x=1
+done ${HOME} /usr/bin /usr/bin printf "$@" "$1" ${HOME}
+"$1" && /usr/bin export then printf echo | readonly cd readonly sed "$1" then
+		'quoted text' && sed local sed $(pwd) /usr/bin
+	grep && local printf 2>/dev/null ${HOME} test --verbose "$1" sed 2>/dev/null
+		'quoted text' && -eu printf /usr/bin "$@" local "$@"
+		&& ${HOME} done awk "$@"
+		done then -eu printf $(pwd) then local awk -eu "$1" && echo sed
+		--verbose --verbose readonly | done --verbose /usr/bin
+		cd "$1" sed 'quoted text' && awk then awk awk awk done test awk | --verbose
+--verbose sed && "$@" export x=1 'quoted text'
+	local --verbose 'quoted text' readonly 2>/dev/null
+		"$@" --verbose x=1 2>/dev/null export ${HOME} printf echo /usr/bin "$1"
+"$@" -eu --verbose awk sed awk $(pwd) && grep
+${HOME} readonly --verbose local readonly
+		printf local local printf readonly "$1" 'quoted text' ${HOME} && --verbose $(pwd)
+	then 'quoted text' echo cd awk readonly readonly export
+	"$1" $(pwd) printf "$1" /usr/bin --verbose
+		--verbose --verbose 'quoted text' export printf 2>/dev/null /usr/bin
+done awk local sed $(pwd) 'quoted text'
+	test 'quoted text' --verbose | --verbose "$@" test export
+	x=1 x=1 x=1 sed "$@" export printf --verbose
+x=1 'quoted text' cd local cd "$@" 'quoted text' "$@"
+	cd awk then | cd "$@" /usr/bin
+printf readonly /usr/bin --verbose "$1" x=1 local
+		${HOME} grep then local "$@" && "$1" && done
+'quoted text' -eu cd awk
+		awk ${HOME} test -eu 'quoted text' printf && test sed --verbose --verbose
+'quoted text' x=1 /usr/bin ${HOME} $(pwd) readonly cd echo 'quoted text'
+	2>/dev/null grep --verbose sed 2>/dev/null
+	cd 'quoted text' $(pwd)
+	"$@" grep export && done 'quoted text' test cd cd
+	export cd --verbose /usr/bin "$1" "$1" "$1" && readonly printf --verbose
+		test "$1" "$@" /usr/bin test then -eu "$1" --verbose
+	done "$1" --verbose -eu
+'quoted text' awk ${HOME} ${HOME}
+	/usr/bin 2>/dev/null ${HOME} echo then 'quoted text'
+	"$@" | local sed $(pwd) /usr/bin grep "$1" cd then 2>/dev/null printf
+		$(pwd) test awk grep x=1 echo printf --verbose done sed export
+	export done 'quoted text' local then 'quoted text'
+	export readonly export "$1" -eu
+	awk local --verbose readonly local echo export x=1 "$@"
+		2>/dev/null "$1" x=1
+awk printf export export echo done local sed --verbose test sed x=1 echo
+	echo -eu then awk "$@"
+	cd sed local readonly 2>/dev/null $(pwd)
+${HOME} sed then "$1" "$1" printf $(pwd)
+sed test awk 'quoted text' x=1 && "$1" readonly 2>/dev/null export then
+	${HOME} local grep local /usr/bin 'quoted text'
+/usr/bin -eu test local "$1"
+--verbose readonly "$1" 'quoted text' 2>/dev/null --verbose
+		"$1" done printf awk test grep "$@" local ${HOME} local --verbose local
+${HOME} export | | "$@" grep awk 2>/dev/null x=1
+	-eu awk grep grep sed done local then cd local --verbose -eu -eu /usr/bin
+$(pwd) $(pwd) "$@" readonly grep --verbose
+printf x=1 grep printf /usr/bin "$1" grep cd "$@" then /usr/bin readonly
+	awk cd | --verbose local && 2>/dev/null
+	echo grep awk x=1 cd && /usr/bin 2>/dev/null cd test 'quoted text'
+	grep /usr/bin local 2>/dev/null
+'quoted text' $(pwd) readonly 'quoted text'
+	then grep cd x=1 "$1"
+		done ${HOME} ${HOME} sed --verbose
+echo && echo /usr/bin then --verbose printf /usr/bin x=1 2>/dev/null test
+	"$1" cd --verbose && readonly -eu x=1 cd local test "$@" printf grep
+	-eu && local printf test export then && export ${HOME} /usr/bin x=1 && $(pwd)
+grep local -eu export
+echo 'quoted text' $(pwd) && local export ${HOME} /usr/bin 2>/dev/null
+${HOME} done sed x=1 ${HOME} 2>/dev/null
+		export done x=1 "$@" export "$@" && ${HOME} ${HOME} then $(pwd) && awk
+	--verbose /usr/bin done done printf awk "$1"
+		$(pwd) awk "$@" 2>/dev/null done sed echo test && 2>/dev/null 2>/dev/null
+		/usr/bin test awk | /usr/bin | --verbose awk | "$1"
+		readonly printf "$1" sed export cd awk local "$1" export 'quoted text'
+		"$1" test then 'quoted text'
+2>/dev/null | local 'quoted text' awk 'quoted text' --verbose
+	-eu | done | export "$1" 'quoted text' done printf 'quoted text'
+"$@" 2>/dev/null "$@"
+printf --verbose then && local test && export "$1" readonly done --verbose
+&& awk grep cd ${HOME} ${HOME} 'quoted text' echo sed "$@" printf
+	done awk grep "$1" $(pwd) $(pwd) grep awk $(pwd)
+then "$1" "$1" "$1" awk && readonly 'quoted text' /usr/bin then &&
+	/usr/bin local x=1 echo awk awk 'quoted text' "$@" && ${HOME}
+		then /usr/bin export --verbose | test $(pwd) ${HOME} then test | cd $(pwd)
+'quoted text' sed grep then cd local test then --verbose x=1 x=1 x=1 awk 2>/dev/null
+/usr/bin $(pwd) sed local -eu -eu $(pwd) "$1" ${HOME} sed 2>/dev/null
+	-eu /usr/bin /usr/bin printf 2>/dev/null echo echo then sed 2>/dev/null
+		${HOME} local printf "$1" ${HOME} /usr/bin
+	'quoted text' | | "$1" ${HOME} readonly "$1" -eu 2>/dev/null
+		'quoted text' sed -eu test
+--verbose | 'quoted text' -eu export | printf
+	grep "$@" readonly cd
+		echo local test export test cd done awk /usr/bin
+${HOME} "$@" $(pwd) $(pwd)
+	2>/dev/null x=1 cd local | then 2>/dev/null "$1" -eu /usr/bin
+		${HOME} sed test cd readonly 'quoted text' local grep && /usr/bin
+$(pwd) cd test --verbose awk export test local sed test /usr/bin 2>/dev/null
+	sed "$1" -eu "$@" cd "$1" test then ${HOME} -eu "$@" local
+	local readonly test test
+	'quoted text' ${HOME} --verbose test test 'quoted text' ${HOME} awk sed
+printf then x=1 readonly /usr/bin ${HOME} local
+	-eu awk $(pwd) --verbose ${HOME} /usr/bin echo local 2>/dev/null | -eu test printf
+	sed test export grep 'quoted text' "$1" sed readonly "$1"
+		$(pwd) 'quoted text' grep --verbose local grep
+		test then -eu sed grep printf 2>/dev/null 'quoted text' readonly && then
+		"$@" -eu /usr/bin && cd ${HOME} 2>/dev/null test done 'quoted text'
+	awk cd /usr/bin test $(pwd) x=1 /usr/bin
+grep readonly done $(pwd) awk /usr/bin awk echo done 'quoted text'
+export export --verbose export then awk /usr/bin grep "$1" then
+		cd cd grep "$1" local && --verbose
+		awk "$@" --verbose local $(pwd) "$1" "$1" "$@" then
+		--verbose 2>/dev/null printf sed
+	test $(pwd) $(pwd) 2>/dev/null && then 2>/dev/null cd
+test -eu cd --verbose -eu --verbose
+		${HOME} echo /usr/bin test printf awk printf
+	| x=1 printf export then
+	cd test export && "$@" test ${HOME} cd sed printf /usr/bin sed ${HOME}
+		-eu --verbose local export --verbose ${HOME} test printf && "$@" grep
+	awk && grep export x=1 ${HOME} /usr/bin printf test
+		export grep | -eu && x=1 test echo readonly 'quoted text' done sed "$@" readonly
+/usr/bin --verbose | --verbose $(pwd) readonly
+	x=1 sed echo ${HOME} then awk readonly $(pwd) local && then test
+		"$@" "$@" "$1" test printf done ${HOME} /usr/bin awk local /usr/bin
+	'quoted text' --verbose /usr/bin
+	| --verbose sed $(pwd) readonly then
+	done 'quoted text' grep && | then printf printf "$1" readonly
+		done readonly $(pwd) 2>/dev/null
+		printf 2>/dev/null x=1
+	grep /usr/bin echo local sed test readonly local export
+sed 'quoted text' $(pwd) | echo 'quoted text' && 2>/dev/null
+		-eu $(pwd) awk 2>/dev/null
+		cd done grep "$1" "$1" /usr/bin awk ${HOME} printf 'quoted text' echo grep
+readonly printf echo test grep cd cd | printf "$@" sed echo x=1 local 'quoted text'
+		&& | x=1 | awk $(pwd)
+	then ${HOME} local export "$1" awk | $(pwd)
+		2>/dev/null test "$1" grep "$1" && /usr/bin /usr/bin
+export x=1 export "$@"
+x=1 test sed "$@" echo "$@" readonly "$@" "$@" -eu export sed readonly /usr/bin
+$(pwd) /usr/bin /usr/bin awk awk
+	grep awk test done -eu 2>/dev/null then 'quoted text'
+$(pwd) --verbose export printf
+	'quoted text' done echo && 'quoted text'
+$(pwd) readonly "$@" test awk grep $(pwd)
+test done | | | "$@" && export sed echo 2>/dev/null
+		/usr/bin "$@" ${HOME} echo
+		readonly "$1" $(pwd)
+"$@" /usr/bin sed sed "$@" echo && 'quoted text' /usr/bin /usr/bin sed
+	test $(pwd) awk local && export awk then -eu
+"$@" 'quoted text' printf done && printf readonly export done
+| sed /usr/bin | x=1 'quoted text' done $(pwd) grep && printf
+'quoted text' && x=1 printf 2>/dev/null export
+		2>/dev/null /usr/bin local $(pwd) --verbose readonly $(pwd) /usr/bin sed
+		test export printf printf grep "$@" --verbose
+printf --verbose "$@" ${HOME} printf
+test /usr/bin "$1" then then 'quoted text' local --verbose sed done && grep
+printf test "$1" printf 'quoted text' printf
+test test local printf "$@" && cd export grep && sed 'quoted text' 2>/dev/null
+		2>/dev/null done export sed 'quoted text' --verbose
+		printf cd echo $(pwd) "$@"
+"$1" "$@" | test "$@" && grep -eu | /usr/bin printf "$1" readonly x=1
+/usr/bin done printf grep && && && local "$@" -eu --verbose
+		2>/dev/null readonly done
+2>/dev/null readonly && awk awk /usr/bin test grep $(pwd) x=1 --verbose
+		printf $(pwd) ${HOME} sed "$1" x=1 && && grep local grep "$@" sed then export
+${HOME} && export awk cd done /usr/bin sed 'quoted text' 2>/dev/null -eu
+		-eu 2>/dev/null $(pwd) echo ${HOME} sed
+	export export 'quoted text' test awk
+"$@" awk test grep readonly
+$(pwd) readonly grep 2>/dev/null awk -eu "$1"
+		then awk then "$@" ${HOME} --verbose "$1" echo test 2>/dev/null
+		echo echo /usr/bin printf --verbose "$1" readonly cd ${HOME} cd && /usr/bin
+	test cd then grep grep grep local grep printf test |
+		test -eu /usr/bin echo printf sed 2>/dev/null 'quoted text'
+	export test test printf /usr/bin
+		local done done test cd ${HOME} awk export
+	export --verbose x=1 $(pwd)
+		/usr/bin -eu printf echo $(pwd) grep echo && /usr/bin ${HOME} grep 'quoted text'
+--verbose local "$1" $(pwd) test | done
+		grep cd printf 'quoted text' test echo printf test | grep grep sed 2>/dev/null
+		local echo then local grep readonly then echo readonly -eu awk then test
+	--verbose 2>/dev/null "$1" "$1" /usr/bin test awk cd x=1 export --verbose ${HOME}
+-eu printf /usr/bin ${HOME} x=1 then
+		"$1" sed ${HOME} 'quoted text' $(pwd) x=1 && export local
+-eu export sed "$1" test x=1 "$1" /usr/bin
+-eu "$@" 2>/dev/null then ${HOME}
+-eu "$1" local done awk done 'quoted text' --verbose local -eu $(pwd) sed
+-eu then cd 'quoted text' export done "$1" cd /usr/bin done sed /usr/bin
+	${HOME} && && local | local x=1 --verbose /usr/bin local done
+		"$@" 'quoted text' export /usr/bin then "$@" cd --verbose $(pwd) && awk grep
+		local $(pwd) sed "$1" "$1" x=1 done $(pwd) cd then 2>/dev/null cd --verbose
+-eu /usr/bin -eu awk $(pwd) printf && 2>/dev/null
+cd $(pwd) export awk 'quoted text' | x=1 'quoted text' sed 'quoted text'
+then "$@" local x=1 | --verbose -eu export x=1 "$1" && ${HOME} grep echo
+	&& done printf /usr/bin grep export readonly local -eu done sed local 'quoted text'
+/usr/bin $(pwd) 2>/dev/null
+readonly readonly then readonly 'quoted text'
+'quoted text' && 'quoted text'
+	${HOME} local $(pwd) 'quoted text'
+		'quoted text' cd 'quoted text' sed "$1" | local "$1" cd && local --verbose |
+x=1 cd sed readonly test x=1 then -eu sed x=1 readonly "$1" | | 'quoted text'
+		$(pwd) test $(pwd) then awk echo $(pwd) /usr/bin "$1" ${HOME}
+	"$1" "$@" readonly sed ${HOME}
+	"$1" && "$1" then ${HOME} "$@"
+	echo $(pwd) echo grep then "$1" export
+	test local local cd "$1" done ${HOME} sed echo grep
+		done echo echo x=1 done then x=1
+test export "$@" -eu cd ${HOME} echo --verbose | 'quoted text'
+	'quoted text' printf
+		awk ${HOME} /usr/bin 'quoted text' test | "$@" --verbose
+| $(pwd) /usr/bin test grep awk cd
+${HOME} then --verbose "$@" printf && then
+		done ${HOME} --verbose awk "$1"
+		/usr/bin --verbose $(pwd) 'quoted text'
+	${HOME} --verbose 2>/dev/null | "$@" /usr/bin export
+	"$@" cd /usr/bin "$1" printf 'quoted text' "$@" grep then
+	&& grep "$1" ${HOME} x=1 x=1 | --verbose sed
+	test local /usr/bin /usr/bin ${HOME} ${HOME} /usr/bin
+	printf awk sed $(pwd) 2>/dev/null
+	test grep --verbose awk 2>/dev/null local && sed 2>/dev/null
+'quoted text' cd awk "$@"
+		x=1 | ${HOME} && && awk /usr/bin readonly 2>/dev/null sed cd /usr/bin export
+		printf cd "$1" "$1" grep then cd --verbose readonly grep "$1" 'quoted text'
+2>/dev/null readonly cd printf readonly
+	&& "$@" local export export local $(pwd) && $(pwd)
+	cd --verbose test sed done awk /usr/bin then
+| test echo /usr/bin local "$@" $(pwd) sed echo
+		"$@" sed "$@" "$@" x=1 printf awk local grep
+		awk export && && local x=1 -eu grep echo 2>/dev/null -eu
+		grep grep /usr/bin $(pwd) then "$1" printf | local readonly
+export --verbose --verbose test $(pwd)
+	echo 2>/dev/null && readonly
+test ${HOME} "$@" 2>/dev/null grep then 2>/dev/null
+		cd ${HOME} done "$1" sed | printf cd then cd
+		sed | 'quoted text' ${HOME} echo
+	cd --verbose test readonly "$@" /usr/bin x=1 then 'quoted text' readonly then
+	test ${HOME} test | ${HOME} /usr/bin then cd -eu "$@"
+		| --verbose "$1" 2>/dev/null
+	| echo export -eu /usr/bin readonly
+sed test readonly export 'quoted text' ${HOME} awk sed $(pwd) | 2>/dev/null
+		"$@" 'quoted text' "$@" local grep 'quoted text' $(pwd) "$@" -eu
+		grep $(pwd) local test x=1 'quoted text'
+cd done x=1 export 'quoted text' | /usr/bin
+--verbose readonly cd $(pwd) cd && /usr/bin &&
+	local /usr/bin cd readonly test /usr/bin awk
+		echo /usr/bin 'quoted text' "$1" then x=1
+	awk grep "$@" x=1 test sed export echo awk | export ${HOME} /usr/bin local
+		&& export readonly local grep --verbose local 'quoted text' then done
+done cd x=1 awk /usr/bin cd --verbose 2>/dev/null test -eu cd | && 'quoted text'
+	| cd test done "$@" -eu "$@" -eu
+	awk done --verbose 2>/dev/null
+		-eu 2>/dev/null cd 'quoted text' /usr/bin ${HOME} $(pwd) readonly
+		cd then "$1" && readonly grep then x=1 x=1 export
+test grep "$@" export grep then x=1
+${HOME} printf 2>/dev/null cd "$@" local
+${HOME} && printf 'quoted text'
+		then --verbose readonly test echo "$1" export
+		'quoted text' $(pwd) cd -eu then done 2>/dev/null 'quoted text' grep && && awk
+		then /usr/bin test --verbose sed -eu "$@" export | local
+/usr/bin $(pwd) echo $(pwd) echo local -eu local grep echo 2>/dev/null
+		/usr/bin /usr/bin /usr/bin && export 2>/dev/null
+--verbose | 'quoted text' grep 'quoted text' test grep /usr/bin grep "$@"
+	x=1 x=1 --verbose printf export local $(pwd) awk printf x=1 printf
+	printf /usr/bin "$@" "$1" grep done /usr/bin | ${HOME} printf
+		export local | printf ${HOME} sed test test printf
+local local 2>/dev/null awk grep test
+/usr/bin "$@" grep echo "$@"
+		--verbose export then | 2>/dev/null awk grep "$@" ${HOME} cd ${HOME}
+sed $(pwd) then ${HOME} test
+	test ${HOME} local readonly $(pwd)
+#include c226.sh
+	cd grep done awk readonly 2>/dev/null export
+	readonly then ${HOME} 2>/dev/null cd echo && $(pwd) 'quoted text'
+	| export test 'quoted text' /usr/bin
+&& "$1" printf cd local echo 'quoted text'
+		-eu 2>/dev/null cd "$1" | x=1 done --verbose then printf
+		| cd then done cd | sed 2>/dev/null x=1 /usr/bin
+		sed sed test 'quoted text'
+	x=1 done $(pwd) 'quoted text' 2>/dev/null then && "$1" grep x=1 "$@"
+'quoted text' $(pwd) "$@" && $(pwd) && grep test done -eu awk -eu
+	then readonly sed export printf ${HOME}
+	| --verbose && | 2>/dev/null /usr/bin echo done
+	'quoted text' test readonly
+	printf | export 'quoted text' 'quoted text'
+		'quoted text' "$@" test test "$1" ${HOME} readonly test
+test "$@" awk ${HOME} 'quoted text' awk sed $(pwd) | x=1
+		${HOME} cd export "$@" ${HOME} x=1 $(pwd) 2>/dev/null x=1 $(pwd) "$@" echo
+		${HOME} done then -eu "$@" 2>/dev/null awk 2>/dev/null
+	$(pwd) ${HOME} grep /usr/bin
+printf local grep 2>/dev/null
+		-eu -eu -eu cd | grep grep /usr/bin
+	-eu && x=1 | 2>/dev/null 'quoted text' "$@" "$1" local done done | printf | 'quoted text'
+	readonly "$1" then "$1" printf done done --verbose local /usr/bin 2>/dev/null sed
+printf awk local local x=1 $(pwd) echo /usr/bin awk x=1 | then /usr/bin
+	then done /usr/bin cd grep export --verbose
+		local readonly "$@" cd /usr/bin echo "$1" printf awk local 'quoted text' --verbose
+test 2>/dev/null readonly -eu ${HOME} /usr/bin awk 2>/dev/null "$1"
+		${HOME} 2>/dev/null sed "$@" "$@" then cd /usr/bin x=1
+--verbose cd test awk ${HOME} grep /usr/bin
+export x=1 -eu echo readonly "$1" then readonly awk "$@" --verbose
+		echo local $(pwd) echo local grep echo -eu grep x=1 'quoted text'
+	/usr/bin local awk 2>/dev/null
+"$1" --verbose 'quoted text' echo test local readonly
+		then local then grep && --verbose printf
+	local /usr/bin x=1 cd $(pwd) 'quoted text' sed && /usr/bin
+		cd /usr/bin $(pwd) echo ${HOME} | grep grep x=1
+test && "$@" printf $(pwd)
+	$(pwd) done | 2>/dev/null | printf
+		sed local x=1 "$1" grep then printf awk "$1" 'quoted text'
+		x=1 cd "$1" | "$1" ${HOME} 2>/dev/null then -eu printf x=1 local readonly
+		| test 'quoted text' readonly cd readonly 'quoted text' "$@" /usr/bin cd 2>/dev/null
+	grep sed readonly echo --verbose 'quoted text' grep
+&& cd test test "$1" test --verbose
+	then | | "$1" "$1" printf sed readonly test local -eu /usr/bin 'quoted text'
+sed export export done echo 2>/dev/null then cd export
+	done grep 'quoted text' cd ${HOME}
+		x=1 cd $(pwd) "$@" | /usr/bin x=1 | export cd
+	&& sed ${HOME} 2>/dev/null -eu --verbose local
+		sed && /usr/bin grep --verbose ${HOME} | sed local | && $(pwd)
+		cd $(pwd) then cd test 2>/dev/null "$1" --verbose && test x=1 ${HOME} 'quoted text'
+	--verbose "$@" awk export sed | then cd $(pwd)
+	&& $(pwd) | | grep sed && printf ${HOME} "$@" ${HOME} x=1 'quoted text'
+	$(pwd) export -eu 'quoted text'
+	'quoted text' "$1" printf grep test ${HOME}
+		sed | export --verbose readonly local export cd $(pwd) printf
+export cd $(pwd) test -eu printf
+local && && --verbose "$1" cd sed printf --verbose
+-eu sed then ${HOME}
+		-eu $(pwd) --verbose $(pwd) "$@" ${HOME} --verbose done test "$1"
+	echo ${HOME} local local --verbose "$1" /usr/bin export x=1 sed | readonly
+		/usr/bin grep && --verbose x=1 x=1 && ${HOME}
+	--verbose cd then printf 2>/dev/null cd -eu awk /usr/bin test export "$1"
+sed readonly --verbose "$1"
+		test ${HOME} then -eu sed ${HOME} x=1 then && && -eu 2>/dev/null $(pwd)
+	-eu && ${HOME} && readonly printf test export | && export $(pwd) | awk printf -eu
+	/usr/bin 'quoted text'
+local /usr/bin 2>/dev/null && awk && "$1" cd done cd local | printf readonly
+${HOME} "$1" && echo /usr/bin export readonly printf
+		printf awk 'quoted text' then ${HOME} test echo -eu grep 2>/dev/null -eu ${HOME}
+"$@" && -eu export 2>/dev/null done sed echo ${HOME} grep --verbose "$@" readonly
+	readonly test awk /usr/bin
+'quoted text' "$1" x=1
+2>/dev/null 'quoted text' x=1 awk echo
+		awk 'quoted text' done 'quoted text' cd && done test | then | then | $(pwd)
+	awk sed printf test --verbose readonly $(pwd) readonly local local export
+		| -eu -eu 'quoted text' x=1 -eu | readonly done awk local
+'quoted text' "$@" export echo
+	grep local ${HOME} echo --verbose "$@"
+		printf "$1" grep cd readonly then grep export local export readonly
+	local --verbose $(pwd) && -eu
+		2>/dev/null cd 'quoted text'
+'quoted text' --verbose readonly ${HOME} readonly $(pwd) /usr/bin
+cd export then "$@" then /usr/bin local printf then sed readonly local 2>/dev/null
+test local && local && grep 'quoted text'
+		printf export printf grep "$@" printf /usr/bin
+/usr/bin 2>/dev/null 'quoted text' $(pwd) echo ${HOME}
+echo 2>/dev/null -eu | done then export then test test
+printf 2>/dev/null "$@" 2>/dev/null awk echo readonly
+		"$@" && sed test echo printf "$1" cd -eu printf readonly /usr/bin echo
+printf export x=1 test 'quoted text'
+local /usr/bin /usr/bin && && done readonly test $(pwd) printf echo
+	test /usr/bin "$@" sed grep
+		&& cd 2>/dev/null "$1" done x=1 /usr/bin 2>/dev/null
+readonly | cd ${HOME} --verbose
+cd local echo local x=1
+cd x=1 -eu x=1 | local /usr/bin ${HOME}
+	-eu sed sed then --verbose cd local x=1 $(pwd) ${HOME}
+"$1" -eu -eu printf && 'quoted text' "$1" export
+		awk done local 2>/dev/null 2>/dev/null echo 2>/dev/null
+	"$1" test && && export sed "$@" "$@" ${HOME} printf echo
+		$(pwd) test readonly then && | -eu && --verbose echo
+		awk sed readonly test readonly | ${HOME}
+	"$1" sed done sed done test && then /usr/bin done ${HOME} -eu
+printf readonly then readonly
+		awk /usr/bin awk done echo cd done x=1 "$1" && sed echo
+/usr/bin ${HOME} then awk sed printf export && awk | local && | grep readonly
+local printf "$@" ${HOME} && grep sed -eu export 'quoted text' 2>/dev/null |
+export "$1" then ${HOME} "$@" && && test done sed
+&& && cd /usr/bin awk then 2>/dev/null $(pwd) ${HOME} then readonly ${HOME}
+		done "$@" x=1 done readonly then
+		local 2>/dev/null 2>/dev/null then export 2>/dev/null
+"$@" ${HOME} -eu && readonly echo | /usr/bin awk ${HOME} awk x=1 export local
+	--verbose grep cd export
+	printf echo 2>/dev/null sed done echo --verbose then sed grep cd | "$@" "$1"
+/usr/bin echo echo "$1" local
+		2>/dev/null --verbose cd local awk "$@" | sed "$@" awk echo local cd printf test
+		grep cd readonly printf 'quoted text' export awk readonly grep x=1 ${HOME}
+/usr/bin then sed ${HOME} cd 2>/dev/null local done &&
+/usr/bin | readonly x=1 cd -eu echo /usr/bin then awk cd test awk printf
+		sed /usr/bin then export && --verbose readonly && done echo 2>/dev/null
+		done /usr/bin awk echo 2>/dev/null printf -eu /usr/bin 'quoted text' 'quoted text'
+		| test x=1 printf -eu && awk sed x=1 printf
+| ${HOME} "$1" echo grep done 2>/dev/null
+printf 2>/dev/null awk grep && printf --verbose $(pwd) "$@" awk test
+printf cd --verbose $(pwd) $(pwd) /usr/bin
+	${HOME} readonly x=1 x=1 && --verbose cd "$1" awk --verbose 2>/dev/null
+	| && /usr/bin 'quoted text'
+	${HOME} -eu 'quoted text' test "$1" 'quoted text' "$1" &&
+		--verbose $(pwd) local grep | 2>/dev/null
+| /usr/bin grep "$@" && ${HOME}
+	export | x=1 done export "$1" export cd grep ${HOME} test cd
+		x=1 $(pwd) test | 2>/dev/null && /usr/bin sed --verbose
+	$(pwd) "$@" -eu 'quoted text' awk -eu sed sed cd
+		/usr/bin readonly && readonly --verbose -eu x=1
+		echo printf 2>/dev/null | grep "$1" x=1 done 2>/dev/null done
+test test awk 2>/dev/null 'quoted text' ${HOME}
+	x=1 | 'quoted text' done && "$@" local
+x=1 test cd local grep echo done x=1
+	'quoted text' awk "$@" grep awk -eu ${HOME}
+	"$1" && cd 2>/dev/null -eu $(pwd) test
+done echo then local cd sed done then 2>/dev/null echo export echo
+| $(pwd) printf grep local echo | /usr/bin -eu cd readonly --verbose export
+		"$@" 2>/dev/null echo local echo && readonly readonly then local
+	"$@" | "$@" cd local cd sed /usr/bin && /usr/bin && /usr/bin -eu /usr/bin awk
+		done echo sed echo && "$@" --verbose $(pwd) "$1" printf done local grep
+	$(pwd) ${HOME} then /usr/bin then test "$@" && 2>/dev/null
+	--verbose "$@" awk 2>/dev/null ${HOME} ${HOME} grep ${HOME} ${HOME}
+	echo "$1" "$@" "$@" export ${HOME} then local x=1 /usr/bin
+	export /usr/bin cd then awk ${HOME} echo -eu "$1" done then "$1" export
+		sed grep sed -eu cd -eu then sed && ${HOME} then then /usr/bin
+		local sed && 2>/dev/null then
+	--verbose --verbose grep && "$@" export cd 2>/dev/null 'quoted text'
+export awk then local readonly
+	'quoted text' -eu echo
+	echo $(pwd) printf ${HOME} done export sed then done test -eu 'quoted text'
+		| test "$@" sed export awk ${HOME} "$1" printf sed 2>/dev/null
+then done cd | test done $(pwd) x=1 awk local 'quoted text' $(pwd)
+	cd /usr/bin printf -eu "$@"
+export && done 2>/dev/null then
+		--verbose test export local done then local | x=1 'quoted text' then export $(pwd)
+test grep grep test done --verbose -eu --verbose
+local test $(pwd) local x=1 "$@" 2>/dev/null printf $(pwd)
+	&& export export "$1" /usr/bin printf ${HOME} | printf
+	printf awk readonly | awk readonly 2>/dev/null
+	| 2>/dev/null $(pwd) "$1" /usr/bin export
+&& x=1 -eu readonly printf
+		&& 2>/dev/null grep $(pwd) done && 2>/dev/null x=1
+x=1 readonly /usr/bin "$@" "$1" x=1 2>/dev/null export echo
+grep /usr/bin 2>/dev/null | "$@" cd export
+then sed $(pwd) then local export -eu
+		&& ${HOME} then printf export 2>/dev/null printf 'quoted text' readonly
+${HOME} done 2>/dev/null 'quoted text' then ${HOME} grep then $(pwd) "$1"
+	grep 'quoted text' sed grep
+		local "$@" ${HOME} /usr/bin "$1" 2>/dev/null local awk
+x=1 "$1" sed "$@" x=1 $(pwd) ${HOME} done $(pwd) "$1" printf cd grep printf 'quoted text'
+-eu export "$@" cd "$1" x=1 test grep
+/usr/bin ${HOME} readonly export && $(pwd) 'quoted text' readonly --verbose
+	grep readonly --verbose then awk readonly sed awk local $(pwd) 'quoted text'
+		printf then -eu export 'quoted text' sed local x=1 -eu then echo | "$@" export
+		--verbose awk printf $(pwd) --verbose --verbose | cd 'quoted text'
+cd "$1" done x=1 /usr/bin test
+	| "$1" sed | 'quoted text' $(pwd) printf 2>/dev/null
+		sed test local x=1 echo "$1" echo && /usr/bin
+local ${HOME} awk done export echo sed $(pwd) /usr/bin
+		echo then "$1" awk "$@" /usr/bin
+${HOME} local readonly -eu local 'quoted text' grep then
+&& printf export && -eu printf x=1 x=1 export "$1" echo && 'quoted text' sed ${HOME}
+	2>/dev/null printf ${HOME} then printf $(pwd) x=1 done | sed done done then sed
+/usr/bin awk sed then 'quoted text' readonly grep 2>/dev/null grep readonly
+	test awk test && $(pwd) ${HOME} -eu && cd then
+done done test $(pwd) export done sed 2>/dev/null grep 'quoted text' --verbose
+		local 2>/dev/null sed awk grep local
+done /usr/bin "$@" then x=1 x=1 |
+		/usr/bin test --verbose | done printf
+		${HOME} "$1" --verbose then x=1
+		-eu x=1 sed grep echo export $(pwd)
+cd --verbose done "$@" --verbose && && echo ${HOME} --verbose grep -eu echo &&
+-eu readonly awk -eu cd x=1 done cd test printf
+	grep | x=1 sed --verbose done "$@" --verbose
+		done --verbose export --verbose "$1" test
+	${HOME} "$1" | "$1" sed "$@"
+	grep export local test ${HOME} /usr/bin
+		sed --verbose local awk $(pwd) sed then sed awk
+"$1" export export 2>/dev/null --verbose
+	| x=1 'quoted text' sed local done export printf then --verbose
+	2>/dev/null then --verbose -eu && awk && x=1 "$1"
+		2>/dev/null -eu grep test local sed -eu 'quoted text' --verbose /usr/bin
+grep printf sed && "$@" local "$@" cd $(pwd) grep cd printf then /usr/bin
+		sed readonly | export "$1" && awk $(pwd) grep printf
+grep then local sed grep $(pwd) echo readonly --verbose
+--verbose 2>/dev/null awk sed
+/usr/bin ${HOME} export x=1 printf 2>/dev/null 2>/dev/null --verbose
+		done -eu grep grep cd done
+	printf cd grep cd echo echo echo done | $(pwd)
+done done awk export cd
+		'quoted text' awk ${HOME} x=1 | 2>/dev/null grep echo ${HOME} local
+	-eu /usr/bin "$@" echo cd $(pwd)
+--verbose && $(pwd) readonly -eu cd sed /usr/bin "$@" --verbose
+x=1 ${HOME} cd 'quoted text'
+	/usr/bin 'quoted text' x=1 readonly
+cd then $(pwd) readonly x=1
+readonly echo local awk ${HOME} printf -eu echo --verbose awk && echo cd &&
+	printf && readonly "$1" readonly x=1 | | test
+x=1 done | --verbose ${HOME} then local
+done test cd | grep printf
+		$(pwd) 'quoted text' && --verbose "$1" ${HOME} then $(pwd) ${HOME}
+		"$@" x=1 && x=1 readonly $(pwd) awk && grep --verbose echo test done | $(pwd)
+	done test "$1" export printf /usr/bin
+readonly "$1" && 2>/dev/null $(pwd) local cd | grep then --verbose
+	done /usr/bin cd x=1 awk 'quoted text' $(pwd) "$1" | "$@" &&
+$(pwd) export 2>/dev/null x=1 2>/dev/null local cd
+		-eu awk "$1" sed local awk echo export /usr/bin readonly
+	cd "$@" "$@" "$1" grep then awk
+sed cd $(pwd) cd sed awk printf awk echo --verbose readonly sed ${HOME}
+export --verbose printf awk -eu grep --verbose
+	&& done --verbose cd ${HOME} | | local echo
+export test sed "$1" then "$1"
+	"$1" ${HOME} --verbose export done
+		awk 'quoted text' awk done 2>/dev/null test then
+	/usr/bin 'quoted text' test readonly local
+| x=1 grep awk x=1 "$1" grep | sed x=1 export test 'quoted text'
+	printf sed then ${HOME} | cd "$1"
+		2>/dev/null export ${HOME}
+	-eu ${HOME} grep -eu echo grep then && --verbose grep sed then "$1"
+$(pwd) export then 'quoted text' export readonly sed 'quoted text' echo done
+		| local /usr/bin then sed printf
+	$(pwd) "$1" x=1 x=1 ${HOME} local
+/usr/bin grep 2>/dev/null
+		| awk then sed cd $(pwd) "$@"
+		printf echo /usr/bin 2>/dev/null
+-eu $(pwd) then grep -eu --verbose -eu cd && "$1" -eu grep "$@"
+		local $(pwd) echo --verbose echo export cd 'quoted text' x=1
+		done printf printf --verbose readonly sed echo cd |
+	readonly grep /usr/bin readonly done export 2>/dev/null x=1 /usr/bin 2>/dev/null
+		| /usr/bin --verbose | 'quoted text' local export
+		--verbose test "$1" -eu "$1" grep 'quoted text'
+test && local export | 'quoted text' grep export readonly grep "$1" ${HOME}
+	${HOME} readonly --verbose && | printf local 'quoted text'
+	| cd then | --verbose sed test ${HOME}
+		echo done | --verbose /usr/bin sed ${HOME} 2>/dev/null | sed
+| "$@" /usr/bin readonly 'quoted text' | export readonly cd then
+		$(pwd) test printf done "$1" done readonly /usr/bin x=1 readonly /usr/bin "$1"
+		&& done /usr/bin -eu sed "$1" readonly
+	local then local grep 2>/dev/null 2>/dev/null -eu grep cd /usr/bin
+awk local x=1 test --verbose cd cd --verbose echo && -eu 2>/dev/null "$1" && local
+		| local --verbose readonly | awk grep 2>/dev/null printf awk awk sed 'quoted text'
+	awk x=1 local x=1 'quoted text' done cd sed "$1" /usr/bin 2>/dev/null
+printf x=1 -eu x=1 export "$@" test test done test "$@" "$@" awk && 2>/dev/null
+	-eu then cd done | printf then | --verbose export | && sed "$1" 2>/dev/null
+	grep echo 2>/dev/null cd -eu echo then
+	done ${HOME} $(pwd) export local | awk grep sed cd $(pwd) printf -eu 2>/dev/null
+		sed /usr/bin /usr/bin --verbose
+/usr/bin -eu cd echo --verbose awk -eu --verbose x=1 | local
+		readonly | local /usr/bin done sed awk x=1 export cd x=1 local -eu test |
+readonly "$@" test test awk "$1" ${HOME}
+		${HOME} | "$1" awk cd --verbose 2>/dev/null echo
+	test $(pwd) printf printf grep export local awk 2>/dev/null
+		"$@" cd readonly done test then "$1" grep
+local sed grep ${HOME} --verbose | grep export
+		/usr/bin x=1 awk local -eu sed && 'quoted text' --verbose
+export "$@" awk export
+local --verbose export awk cd cd 2>/dev/null
+		2>/dev/null ${HOME} 2>/dev/null $(pwd) echo 'quoted text' readonly 'quoted text'
+"$1" -eu test -eu x=1 echo done && ${HOME} echo
+printf && "$1" /usr/bin then grep 2>/dev/null
+awk "$@" /usr/bin test "$@" x=1 "$@" local && export 2>/dev/null
+	$(pwd) then | test | -eu "$@" readonly
+local grep -eu cd ${HOME} 'quoted text' done export
+		"$@" $(pwd) 2>/dev/null
+		printf && "$@" printf awk test done
+		x=1 export && awk export cd readonly "$1" printf "$@" awk sed 2>/dev/null x=1
+		'quoted text' cd test printf x=1 --verbose echo test "$@" x=1 $(pwd)
+	local export printf sed readonly 2>/dev/null
+		local && awk --verbose -eu done printf "$@" --verbose /usr/bin grep
+	grep $(pwd) readonly test local done 2>/dev/null
+'quoted text' 2>/dev/null cd test awk readonly awk cd
+		grep -eu 2>/dev/null | awk test $(pwd) then test grep /usr/bin -eu export x=1
+$(pwd) awk x=1 x=1 done && 2>/dev/null grep --verbose readonly done
+		printf | && -eu -eu local printf -eu
+${HOME} printf awk 'quoted text' $(pwd)
+	/usr/bin cd 2>/dev/null -eu done grep sed "$@"
+	test readonly readonly grep export awk export --verbose printf
+		x=1 --verbose 2>/dev/null && | $(pwd) readonly
+then readonly 2>/dev/null
+	/usr/bin cd x=1 local | echo grep local
+		then sed x=1 printf readonly then --verbose echo
+&& ${HOME} 2>/dev/null /usr/bin local x=1 x=1 printf printf sed
+	'quoted text' printf --verbose
+"$@" done "$1" -eu "$1" --verbose echo cd grep cd local && cd
+sed echo awk | awk $(pwd) export readonly "$@" then
+/usr/bin --verbose done grep /usr/bin | readonly "$1" /usr/bin
+	'quoted text' | | && export sed "$@"
+		awk sed local sed 'quoted text' -eu -eu 2>/dev/null --verbose grep done printf
+	printf 2>/dev/null cd /usr/bin local "$@" x=1 awk done "$1" | 2>/dev/null
+	'quoted text' "$1" "$1" 2>/dev/null --verbose echo "$1" cd
+echo grep "$@" awk ${HOME} x=1 'quoted text' done printf -eu
+	sed "$@" ${HOME} grep "$1" local done
+	then ${HOME} local x=1 && awk --verbose | --verbose
+	2>/dev/null $(pwd) cd done printf grep && "$@" 'quoted text' then
+	x=1 done ${HOME} -eu --verbose 'quoted text' readonly | -eu | $(pwd) local local
+"$1" test done sed export readonly done done
+&& sed cd /usr/bin --verbose sed -eu test done test 2>/dev/null x=1 then echo
+		then grep --verbose /usr/bin done x=1 sed "$@" && && cd echo printf
+printf --verbose && "$@" x=1 && test 2>/dev/null grep cd cd
+printf x=1 then /usr/bin test readonly done ${HOME} local readonly ${HOME}
+		&& "$1" "$1" grep done $(pwd) "$@" 'quoted text' | echo test /usr/bin 2>/dev/null
+	$(pwd) done 2>/dev/null "$1" && local done "$1" "$@" x=1 | test
+	sed 'quoted text' 2>/dev/null then
+export $(pwd) awk awk echo "$@" x=1 -eu /usr/bin -eu /usr/bin
+		awk export done printf echo printf && && ${HOME} "$@"
+		${HOME} 2>/dev/null "$@" readonly "$1" printf readonly
+	"$1" cd "$@" 'quoted text' $(pwd) x=1 cd then --verbose local --verbose ${HOME}
+-eu /usr/bin test export
+		x=1 local 2>/dev/null x=1 'quoted text' echo printf test -eu /usr/bin
+	| && readonly "$1" x=1 x=1 test printf done
+	--verbose printf grep ${HOME} test /usr/bin "$@" readonly
+	"$@" /usr/bin cd ${HOME} done /usr/bin then readonly then cd
+	| "$@" x=1 ${HOME} 2>/dev/null export | sed sed awk
+	export readonly | echo readonly readonly done $(pwd) then export
+echo /usr/bin $(pwd) export
+	/usr/bin echo $(pwd) && 2>/dev/null -eu "$1"
+-eu /usr/bin readonly grep 'quoted text' | test then export
+	readonly $(pwd) 'quoted text' $(pwd) readonly $(pwd)
+	sed test test export awk export then 'quoted text'
+		done 2>/dev/null printf "$1" grep $(pwd) readonly
+"$@" -eu && grep done -eu local --verbose
+		sed x=1 'quoted text' test sed $(pwd)
+		cd awk --verbose export local --verbose ${HOME} /usr/bin 'quoted text' test
+		$(pwd) export grep $(pwd) export grep x=1 export $(pwd)
+		sed | x=1 local readonly awk then export && /usr/bin sed 'quoted text'
+		cd export $(pwd) "$@" "$@" && grep $(pwd) "$1" awk then 2>/dev/null
+sed $(pwd) cd awk /usr/bin | -eu x=1 grep awk export
+	local ${HOME} cd 'quoted text' readonly done local then /usr/bin printf readonly
+	${HOME} echo && awk done "$@" done
+	'quoted text' $(pwd) x=1 echo printf then
+echo done awk "$1" --verbose 'quoted text' cd /usr/bin $(pwd) readonly
+2>/dev/null --verbose sed "$@" 2>/dev/null | sed cd "$@" echo echo
+	'quoted text' ${HOME} /usr/bin done $(pwd) 2>/dev/null "$1" | grep
+test 2>/dev/null printf echo x=1 awk
+done 2>/dev/null grep && ${HOME} cd x=1 grep 2>/dev/null
+"$1" "$@" x=1 -eu readonly
+"$@" cd cd ${HOME} -eu then cd grep cd printf echo
+		2>/dev/null "$1" sed x=1 ${HOME} test cd sed export awk 'quoted text'
+		| grep awk cd cd "$@" | && done
+	test "$@" export export cd then ${HOME} awk 2>/dev/null
+/usr/bin 2>/dev/null sed awk "$@" --verbose then readonly sed x=1 | 2>/dev/null
+		"$@" readonly $(pwd) -eu grep $(pwd) --verbose
+		grep done "$@" printf "$1" --verbose grep
+x=1 done printf echo grep "$1" export /usr/bin
+test ${HOME} && readonly local "$@"
+		${HOME} printf "$1" ${HOME} done printf printf
+		printf echo && -eu export local test local cd ${HOME} test cd
+'quoted text' done "$1" $(pwd) -eu -eu export done test
+sed 'quoted text' "$1" 'quoted text' $(pwd) cd cd
+		echo $(pwd) export /usr/bin local sed "$@" awk local && cd grep awk --verbose
+	done /usr/bin sed cd echo 'quoted text' --verbose test
+	sed echo export $(pwd) -eu | && x=1
+	test 'quoted text' ${HOME} echo -eu done done ${HOME} $(pwd)
+printf $(pwd) echo readonly | done -eu -eu
+printf then awk awk $(pwd) -eu local local ${HOME} local 'quoted text' local
+	&& test && --verbose 2>/dev/null $(pwd) x=1 local 'quoted text' local -eu 2>/dev/null
+	test && awk 'quoted text' then /usr/bin --verbose x=1 echo $(pwd)
+		then 2>/dev/null test $(pwd) printf export done echo
+local ${HOME} grep $(pwd) && 'quoted text' && printf test grep grep printf
+	--verbose printf echo grep 'quoted text' ${HOME} sed sed | cd ${HOME}
+		x=1 export test -eu && awk /usr/bin 2>/dev/null
+		echo $(pwd) local && /usr/bin echo /usr/bin /usr/bin 'quoted text'
+	'quoted text' sed -eu x=1 test test printf readonly echo $(pwd)
+local done echo 'quoted text'
+readonly 2>/dev/null --verbose -eu test 'quoted text'
+		grep awk && | readonly $(pwd) export export local 'quoted text' done export
+printf sed /usr/bin test then x=1 --verbose x=1 x=1 | test
+		| test local readonly done "$1"
+printf | test --verbose x=1
+done export ${HOME} x=1 readonly 2>/dev/null 2>/dev/null
+		sed 2>/dev/null "$@" local --verbose ${HOME} "$@" export /usr/bin --verbose "$@"
+	then readonly 2>/dev/null && export then readonly sed grep -eu
+	readonly test echo sed readonly local readonly "$1" $(pwd) test
+	then echo awk then && ${HOME} test 'quoted text' --verbose then x=1 sed readonly
+	"$@" grep 'quoted text' echo grep $(pwd) done cd
+then then "$@" awk "$1" 'quoted text' awk ${HOME}
+		--verbose sed -eu /usr/bin awk x=1 ${HOME} sed cd export cd "$1" /usr/bin
+		-eu cd | 'quoted text' /usr/bin local | test then -eu x=1
+	'quoted text' cd $(pwd) /usr/bin /usr/bin
+		test -eu done --verbose /usr/bin sed awk "$@"
+| "$1" && test -eu "$1" x=1 printf local
+echo "$@" "$@" -eu | awk test echo -eu
+		x=1 then sed x=1 echo done 'quoted text' ${HOME} -eu 2>/dev/null 'quoted text'
+"$@" readonly done printf
+	/usr/bin 2>/dev/null | awk
+	then export done /usr/bin local sed "$@" local
+&& grep grep then ${HOME} x=1 | test 'quoted text'
+		test sed test "$1" printf --verbose && printf /usr/bin "$@" export
+		-eu cd test "$@" "$1" grep /usr/bin awk then --verbose awk 'quoted text'
+		2>/dev/null $(pwd) 2>/dev/null -eu "$@" | awk sed "$1" 2>/dev/null
+		then grep "$1" test echo "$@" local
+		'quoted text' grep x=1 | grep grep grep done 2>/dev/null | && done
+	export /usr/bin grep --verbose grep -eu --verbose
+	&& /usr/bin grep echo echo done
+		cd ${HOME} 'quoted text' done export cd | export readonly done test 'quoted text'
+		"$@" "$@" local /usr/bin && 'quoted text' 2>/dev/null
+		local ${HOME} x=1 x=1 done sed echo x=1 /usr/bin
+		sed readonly 'quoted text' local | echo test && cd ${HOME} readonly
+	done local grep export
+		cd printf && sed awk awk "$@" echo
+${HOME} -eu printf "$@" printf readonly ${HOME} --verbose printf
+	"$@" $(pwd) 2>/dev/null then "$@" then 'quoted text'
+	/usr/bin x=1 test grep test /usr/bin x=1 $(pwd)
+"$@" | x=1 awk x=1 echo "$1" sed done then x=1 echo awk sed x=1 "$1" readonly
+		&& awk -eu ${HOME} then --verbose x=1 done x=1 && "$@" x=1 'quoted text'
+		&& "$@" awk "$@" local cd 'quoted text' $(pwd) test $(pwd) then 'quoted text'
+		echo 'quoted text' echo sed /usr/bin 'quoted text' x=1
+local --verbose $(pwd) | awk then | --verbose then sed -eu --verbose
+		sed "$1" 'quoted text' readonly && readonly
+-eu --verbose "$1" awk then done 'quoted text'
+&& -eu awk $(pwd) 2>/dev/null
+2>/dev/null done ${HOME} && $(pwd) test --verbose export test "$@" 2>/dev/null
+readonly "$1" cd readonly
+	done sed x=1 -eu 2>/dev/null "$1" 2>/dev/null sed cd
+printf then x=1 "$1" readonly --verbose 'quoted text'
+grep test done sed | && -eu readonly cd then ${HOME} sed cd then readonly
+	x=1 readonly awk sed export done /usr/bin done $(pwd) readonly then
+		echo ${HOME} then awk then grep /usr/bin && --verbose
+		printf export sed then && sed echo --verbose -eu
+done cd readonly sed export
+x=1 -eu --verbose -eu | awk readonly cd echo /usr/bin grep && readonly
+2>/dev/null ${HOME} printf
+		${HOME} done -eu readonly
+	'quoted text' readonly | 'quoted text' local $(pwd) --verbose
+echo 'quoted text' printf awk echo sed done && $(pwd) ${HOME} sed readonly
+		printf "$@" x=1 test --verbose && "$@" cd && "$@" readonly 'quoted text'
+		2>/dev/null "$@" readonly $(pwd) 2>/dev/null --verbose awk x=1 cd local
+	test "$@" printf 'quoted text' /usr/bin test -eu "$@" "$@" 2>/dev/null 'quoted text'
+	2>/dev/null cd cd -eu test 'quoted text' /usr/bin awk
+	| | $(pwd) printf 2>/dev/null 2>/dev/null printf printf awk local grep "$1"
+	x=1 export local export printf $(pwd) test printf local $(pwd)
+	echo grep grep x=1 sed then && x=1 printf local | then echo then
+'quoted text' then --verbose | 2>/dev/null
+		echo test "$1" --verbose done printf -eu x=1 local echo printf 2>/dev/null
+	grep /usr/bin -eu "$@" awk ${HOME} echo readonly done "$1" /usr/bin
+x=1 | -eu cd echo | /usr/bin -eu awk --verbose -eu export sed
+	printf awk ${HOME} && sed "$@" -eu -eu
+	--verbose --verbose echo awk test echo
+'quoted text' -eu x=1 | 'quoted text'
+"$1" ${HOME} ${HOME} printf "$@" done cd echo then --verbose
+	test local /usr/bin printf "$@" grep test -eu ${HOME} printf "$1"
+	2>/dev/null printf cd printf awk
+	cd then 2>/dev/null ${HOME} local 2>/dev/null
+	grep /usr/bin -eu echo && then done readonly x=1 | awk then
+2>/dev/null local | "$@" | /usr/bin
+		--verbose | printf "$@" x=1 --verbose
+		"$1" 2>/dev/null echo export && echo -eu -eu 2>/dev/null local $(pwd) | /usr/bin
+	grep printf 2>/dev/null readonly "$1" x=1 | | --verbose done echo grep
+	-eu cd local && readonly export printf -eu "$1" grep $(pwd)
+sed x=1 ${HOME} readonly "$1" local echo
+		"$1" ${HOME} ${HOME} 'quoted text'
+"$@" done awk awk | $(pwd) --verbose test 'quoted text' grep echo
+	printf && /usr/bin "$1" 'quoted text' "$1" export --verbose done
+		printf x=1 done local export x=1
+		-eu ${HOME} /usr/bin /usr/bin x=1 "$1" | -eu echo printf
+	'quoted text' && local export
+	grep -eu done | printf sed printf sed cd "$@" awk sed
+		readonly sed awk && export done ${HOME} 'quoted text' 'quoted text'
+sed test awk --verbose grep $(pwd) export "$@" echo cd
+	export printf 2>/dev/null sed | test | -eu "$1" test export cd
+		grep "$@" $(pwd) local grep sed done "$@" | printf then $(pwd)
+then "$@" && "$@" -eu 'quoted text'
+	echo awk readonly done /usr/bin awk 2>/dev/null cd $(pwd) then ${HOME}
+	printf $(pwd) ${HOME} test
+		local /usr/bin ${HOME} -eu && "$@" $(pwd) export printf /usr/bin awk sed
+	export && ${HOME} awk grep x=1 ${HOME}
+		export cd done cd $(pwd) "$@" echo echo --verbose -eu "$@" --verbose echo ${HOME}
+	grep ${HOME} then "$@" 'quoted text'
+		/usr/bin --verbose export sed &&
+| grep test sed cd "$1" "$@" 2>/dev/null sed readonly ${HOME}
+	sed | printf cd printf
+	sed local then | 'quoted text' awk ${HOME}
+		echo readonly 2>/dev/null grep readonly
+	-eu --verbose ${HOME} sed grep done awk --verbose /usr/bin x=1
+		x=1 --verbose awk then ${HOME}
+		readonly "$@" sed cd "$@" awk ${HOME} $(pwd)
+${HOME} "$@" -eu local $(pwd)
+	&& echo sed readonly readonly $(pwd)
+	printf done x=1 done
+cd "$1" x=1 $(pwd) then local test
+done && grep "$@" "$@" printf grep --verbose then /usr/bin
+	"$@" local test x=1 export --verbose
+	printf cd -eu grep export $(pwd) echo $(pwd) grep grep done x=1
+		2>/dev/null "$1" ${HOME} grep 'quoted text'
+	"$1" local test sed local then --verbose -eu awk x=1 grep $(pwd) && done cd readonly
+		readonly export awk grep done "$1" readonly 'quoted text' export x=1 echo readonly
+	&& local printf local export
+local | $(pwd) cd sed 2>/dev/null 2>/dev/null
+		done | cd sed x=1 cd -eu | local export done ${HOME} local echo 2>/dev/null
+		--verbose cd readonly cd cd test cd --verbose
+		&& && readonly /usr/bin "$@" then cd export done
+x=1 -eu awk $(pwd) done awk awk ${HOME} test sed x=1 "$@" $(pwd)
+then done echo && ${HOME} | sed "$1" "$@" cd
+| x=1 echo "$1" done | "$1" | local then && printf export -eu /usr/bin
+$(pwd) printf -eu 'quoted text' then 'quoted text'
+	test ${HOME} 'quoted text' export ${HOME} readonly export
+| | cd "$1" echo && readonly then grep done ${HOME} && done grep
+		&& echo ${HOME} $(pwd)
+local /usr/bin "$@" -eu test then export awk export cd then 2>/dev/null
+	echo /usr/bin $(pwd) $(pwd)
+	&& /usr/bin | then grep --verbose
+/usr/bin "$1" export "$@" $(pwd) printf | done awk export /usr/bin
+	&& $(pwd) $(pwd) done readonly
+		&& ${HOME} $(pwd) "$@" --verbose echo | 2>/dev/null
+		${HOME} local x=1 ${HOME} readonly $(pwd) local done grep then -eu "$1"
+		2>/dev/null $(pwd) "$@" | local export && grep "$@"
+	| 2>/dev/null test done && readonly readonly local 'quoted text'
+		2>/dev/null test --verbose | test grep ${HOME} done printf export
+		printf echo local 'quoted text' export awk "$1"
+${HOME} 2>/dev/null awk test 2>/dev/null
+	done done printf awk 'quoted text' printf
+		--verbose && && ${HOME} 2>/dev/null
+	readonly export -eu | 'quoted text'
+	"$1" then 2>/dev/null x=1 awk
+		$(pwd) "$@" awk "$1" --verbose
+		${HOME} readonly then awk "$@" 2>/dev/null ${HOME}
+		${HOME} ${HOME} && local ${HOME}
+		printf local ${HOME} then readonly ${HOME} local printf test sed /usr/bin | -eu
+	-eu $(pwd) printf readonly awk x=1 $(pwd) "$@" "$1" readonly grep 'quoted text'
+	'quoted text' sed then done printf x=1 done x=1
+--verbose readonly local 2>/dev/null
+	then printf 'quoted text' 2>/dev/null
+	'quoted text' then printf "$@" cd printf grep "$@" -eu done "$1" cd echo
+	echo local local ${HOME} 'quoted text' readonly local readonly
+"$1" && readonly cd ${HOME} --verbose "$@" test 2>/dev/null
+	"$@" "$1" then --verbose local $(pwd) sed --verbose then 'quoted text' test readonly
+		printf local "$1" 2>/dev/null ${HOME} test "$1" /usr/bin &&
+		-eu 2>/dev/null export x=1 sed x=1 /usr/bin done grep 'quoted text' "$@" --verbose
+	local then $(pwd) echo
+	&& test x=1 /usr/bin then &&
+		printf -eu grep x=1 export 2>/dev/null -eu cd local $(pwd) cd echo && local
+	| /usr/bin "$1" $(pwd) export
+	x=1 printf && ${HOME} x=1 test
+export then "$@" test sed awk --verbose
+"$@" --verbose /usr/bin
+		${HOME} "$1" 2>/dev/null && && 'quoted text' printf $(pwd) grep then 'quoted text'
+		x=1 readonly -eu && -eu grep done 'quoted text' readonly
+		echo sed "$@" sed echo grep test awk done grep && grep grep
+		${HOME} awk readonly readonly 'quoted text' echo
+		"$1" "$@" cd --verbose sed "$@" cd awk $(pwd) /usr/bin
+		| echo --verbose $(pwd) then then test readonly | test | done -eu ${HOME}
+	/usr/bin 2>/dev/null /usr/bin test "$1" export awk "$1" local
+	printf 'quoted text' && 2>/dev/null 2>/dev/null
+--verbose ${HOME} x=1 printf test "$@" done --verbose done
+		-eu awk then /usr/bin cd export "$1" awk done 'quoted text'
+echo "$1" grep ${HOME} -eu export | x=1 grep | 'quoted text'
+-eu then -eu $(pwd) printf grep export ${HOME} readonly echo awk x=1 awk
+2>/dev/null awk sed ${HOME} "$1" export sed cd export
+	then | "$@" local then && x=1 /usr/bin readonly printf done "$@" test && test
+	grep 'quoted text' printf --verbose awk
+grep awk && done test printf "$@" cd 2>/dev/null export export
+readonly awk "$1" done done x=1
+		"$1" --verbose grep cd test export awk echo | -eu done /usr/bin then sed
+	grep echo echo export -eu "$@"
+		export echo local echo | readonly "$1" -eu 'quoted text'
+x=1 "$@" done 'quoted text'
+	test "$1" grep $(pwd) cd "$1" "$1" readonly "$@" printf grep ${HOME} local
+	| x=1 'quoted text' readonly $(pwd) sed | "$1" echo x=1
+		"$@" 2>/dev/null /usr/bin printf export
+	echo test awk echo export "$1" done local 2>/dev/null 2>/dev/null
+	then echo sed --verbose && readonly export
+		test printf then "$@"
+test sed $(pwd) /usr/bin then x=1 cd
+		'quoted text' x=1 && ${HOME} cd 'quoted text' /usr/bin -eu /usr/bin printf /usr/bin
+		x=1 -eu "$1" --verbose echo ${HOME} --verbose grep ${HOME} cd local test done x=1
+	sed ${HOME} | | --verbose export echo
+printf export 2>/dev/null $(pwd) /usr/bin echo grep
+&& 'quoted text' "$@" $(pwd) 2>/dev/null ${HOME} grep
+	readonly printf printf readonly sed echo readonly | done local 'quoted text'
+	| "$@" local cd ${HOME} export
+		--verbose "$1" 'quoted text' x=1 sed "$@" "$@" | export "$@" done 2>/dev/null
+-eu cd echo "$@" 'quoted text'
+	2>/dev/null export "$1"
+		"$@" 2>/dev/null --verbose | "$1" /usr/bin | | ${HOME} export | | test
+	awk printf 2>/dev/null test ${HOME} local /usr/bin done
+		export readonly | && /usr/bin local ${HOME} 'quoted text' awk printf
+		done echo -eu /usr/bin --verbose /usr/bin
+	&& test ${HOME} ${HOME} | -eu export awk
+		"$@" local echo "$1" ${HOME} sed && "$1" then
+		printf --verbose -eu then
+	${HOME} cd x=1 grep && test echo | | 2>/dev/null export then
+/usr/bin /usr/bin "$@" done 'quoted text'
+		&& cd ${HOME} grep 'quoted text'
+		cd export cd && | -eu export local awk awk x=1 "$1" cd
+		--verbose $(pwd) $(pwd) "$1" | 'quoted text' export && awk x=1 --verbose
+		/usr/bin grep $(pwd) "$@" readonly sed test cd local printf x=1
+	-eu $(pwd) x=1 test --verbose sed printf export awk && local
+	sed /usr/bin && test awk && && export | sed export "$@" x=1
+		cd grep awk echo --verbose
+	&& ${HOME} sed awk then local export 2>/dev/null export
+	--verbose x=1 test printf then ${HOME} "$@" | readonly cd -eu awk && cd $(pwd) 2>/dev/null
+	$(pwd) export && 2>/dev/null cd readonly awk sed grep 'quoted text' done &&
+then && 'quoted text' 'quoted text' awk test 2>/dev/null local then echo "$1" ${HOME}
+	done "$@" $(pwd) sed 2>/dev/null
+	"$1" $(pwd) && | then 2>/dev/null | readonly /usr/bin readonly
+		printf 'quoted text' readonly 'quoted text' readonly 'quoted text' grep
+		/usr/bin "$@" echo awk awk cd -eu x=1 echo 2>/dev/null sed
+	${HOME} grep export -eu done done && cd | | $(pwd) local
+cd done cd --verbose cd ${HOME} cd $(pwd)
+	'quoted text' -eu && -eu cd echo
+	printf local grep local local ${HOME}
+	x=1 awk printf test ${HOME} grep done echo /usr/bin readonly
+		grep 2>/dev/null awk "$@" && awk --verbose cd printf "$@" export "$1" then
+$(pwd) ${HOME} printf -eu | 2>/dev/null cd x=1 ${HOME} then x=1
+	$(pwd) export -eu grep && printf /usr/bin echo "$@" && ${HOME} test ${HOME}
+		export && printf printf 'quoted text' echo then done then test test grep
+	x=1 'quoted text' test $(pwd)
+	&& awk done readonly test cd 'quoted text' readonly ${HOME} -eu && cd
+	'quoted text' grep done sed done | local then then ${HOME} test printf echo
+	${HOME} --verbose 'quoted text' cd --verbose test done done "$@"
+		${HOME} done grep | ${HOME} --verbose readonly awk local readonly export
+		local sed x=1 -eu 2>/dev/null | test done cd local && grep --verbose "$@"
+		"$1" /usr/bin cd ${HOME} 'quoted text' --verbose
+		done "$1" echo grep test -eu readonly "$@"
+${HOME} test 2>/dev/null local local readonly --verbose sed local
+		then readonly ${HOME} test $(pwd)
+		'quoted text' && grep ${HOME} awk $(pwd) then --verbose local $(pwd) test 2>/dev/null
+		/usr/bin "$@" then /usr/bin -eu "$1" "$1" echo ${HOME} x=1 local
+	echo "$1" "$@" echo test local
+	printf | "$1" 2>/dev/null x=1 x=1 test readonly echo "$@" echo sed echo
+	grep "$1" ${HOME} "$@" "$1" readonly ${HOME} printf echo echo -eu awk $(pwd)
+		"$@" -eu cd readonly sed "$1" grep && && 'quoted text'
+	$(pwd) 'quoted text' test 2>/dev/null $(pwd)
+	local sed ${HOME} "$1" -eu cd local sed /usr/bin -eu sed
+printf cd cd "$1" readonly readonly test --verbose $(pwd) "$@"
+${HOME} x=1 grep local | x=1 printf ${HOME} then done
+export local printf 2>/dev/null
+	then echo sed grep echo grep 'quoted text'
+	'quoted text' -eu export -eu 2>/dev/null
+	echo "$1" /usr/bin ${HOME} sed 'quoted text' done grep awk 2>/dev/null
+	--verbose cd readonly "$1" $(pwd) cd sed awk
+--verbose then 'quoted text' then $(pwd)
+		2>/dev/null 2>/dev/null --verbose x=1 local local printf test
+	&& /usr/bin test ${HOME} ${HOME} test cd
+	printf "$1" --verbose then $(pwd) /usr/bin sed cd
+		"$@" readonly printf x=1 grep export cd 'quoted text'
+"$1" && sed done 2>/dev/null echo | $(pwd) -eu ${HOME}
+| x=1 awk -eu $(pwd) "$@" "$1" -eu echo -eu -eu local x=1 grep awk awk
+	export && 2>/dev/null x=1 /usr/bin grep && 'quoted text'
+		--verbose sed ${HOME} readonly
+		printf done cd -eu --verbose -eu printf then then then x=1 && && export
+	test ${HOME} local ${HOME} printf cd -eu && readonly export
+	then --verbose local "$1" | --verbose /usr/bin
+		2>/dev/null 2>/dev/null ${HOME} /usr/bin --verbose --verbose 'quoted text'
+	"$1" $(pwd) /usr/bin echo test
+	"$@" echo $(pwd) "$@" 'quoted text' | 2>/dev/null done $(pwd) ${HOME} echo
+	2>/dev/null done awk /usr/bin test && export done
+	2>/dev/null 'quoted text' && echo echo $(pwd) -eu echo
+		echo $(pwd) printf | --verbose then 2>/dev/null test | grep
+	printf -eu done 'quoted text' done -eu x=1 grep local 2>/dev/null
+	awk readonly /usr/bin awk
+/usr/bin export 2>/dev/null
+	test x=1 grep export sed && local done then
+		local test /usr/bin printf grep && readonly 'quoted text' && awk
+		readonly | printf --verbose grep done local cd 2>/dev/null
+	cd $(pwd) x=1 --verbose awk /usr/bin
+		test printf done x=1 done && local local
+grep printf awk x=1 then export x=1 local
+		-eu readonly "$1" /usr/bin 'quoted text'
+		$(pwd) $(pwd) export "$@"
+	echo 'quoted text' sed --verbose local cd echo printf export
+awk grep $(pwd) readonly --verbose /usr/bin 'quoted text'
+	then x=1 export "$@" | x=1
+		'quoted text' export x=1 $(pwd) test "$@" ${HOME} 2>/dev/null done then
+x=1 echo sed sed awk 'quoted text' done -eu echo
+	readonly "$@" "$@" && /usr/bin | 2>/dev/null then && awk readonly
+test 'quoted text' test export awk grep echo then $(pwd) "$@" x=1 export export
+	printf -eu test $(pwd) ${HOME} "$1" | $(pwd) sed -eu /usr/bin "$@" awk cd 'quoted text'
+		echo 2>/dev/null "$@" cd 'quoted text'
+		export done awk printf done then "$1" $(pwd) --verbose "$@" cd test ${HOME}
+	echo readonly export "$@" export
+	&& sed test ${HOME} ${HOME}
+	--verbose | test 2>/dev/null done then x=1 "$1" "$@" export then grep readonly
+	'quoted text' export 'quoted text' ${HOME} test grep --verbose awk then
+sed && export /usr/bin echo export then "$@" export 'quoted text'
+	-eu test sed | "$1" printf sed cd awk readonly printf done | -eu 2>/dev/null
+		--verbose "$1" -eu $(pwd) /usr/bin readonly 2>/dev/null
+"$@" sed test "$@" grep sed echo sed && cd grep && export 2>/dev/null
+-eu --verbose cd awk -eu echo export 'quoted text' $(pwd) $(pwd) echo
+	$(pwd) ${HOME} sed x=1 ${HOME} then "$1"
+--verbose -eu | readonly "$1" 2>/dev/null
+		| readonly "$1" echo local local local "$1" "$@" --verbose | -eu printf --verbose
+		| echo -eu $(pwd) 'quoted text' "$1" ${HOME} -eu
+		test sed "$@" "$1" "$@" "$@" then
+		/usr/bin printf 'quoted text' then echo 2>/dev/null x=1 printf readonly |
+-eu sed ${HOME} local
+		"$@" "$@" ${HOME} "$1" printf 2>/dev/null
+	done done 'quoted text' -eu x=1 | x=1 test cd $(pwd) ${HOME}
+	'quoted text' $(pwd) -eu $(pwd) test /usr/bin $(pwd) grep awk /usr/bin "$1"
+-eu echo local | x=1 &&
+	sed && | "$@" awk local 'quoted text' export /usr/bin 2>/dev/null
+		awk 'quoted text' then 2>/dev/null /usr/bin grep && local
+test -eu printf grep -eu local | done export 2>/dev/null
+then "$1" printf echo $(pwd) && $(pwd)
+"$1" --verbose /usr/bin export
+	readonly && /usr/bin | then "$@" local printf 2>/dev/null
+	'quoted text' $(pwd) cd x=1 $(pwd) --verbose sed awk awk x=1 awk "$1" then awk
+		awk $(pwd) echo echo /usr/bin export
+	"$@" sed ${HOME} done $(pwd) test 'quoted text' --verbose
+		printf -eu && && export done | --verbose && --verbose test printf
+$(pwd) 'quoted text' x=1 x=1 | 'quoted text' printf
+		test test ${HOME} sed echo 2>/dev/null -eu "$@" readonly then
+		&& | cd printf test 2>/dev/null x=1 then test test test grep |
+		&& export awk x=1 local
+		-eu echo echo x=1 /usr/bin done export "$@" 2>/dev/null
+"$@" done local /usr/bin 'quoted text' test done ${HOME} export -eu --verbose
+	done -eu "$1" ${HOME} -eu | readonly -eu /usr/bin --verbose
+	then local -eu sed ${HOME} 'quoted text' local readonly /usr/bin readonly "$1"
+		--verbose ${HOME} local $(pwd) 2>/dev/null "$1" export printf
+		"$1" 2>/dev/null x=1 x=1 sed "$@" /usr/bin "$@" printf export test --verbose
+	"$@" awk "$1" test readonly awk test -eu
+	export done "$1" x=1 ${HOME} "$1" 2>/dev/null 'quoted text' "$@"
+		x=1 sed "$1" -eu "$@" printf "$1" --verbose grep local 'quoted text'
+	2>/dev/null printf export
+	"$1" x=1 sed 2>/dev/null sed ${HOME} x=1 -eu local x=1 echo printf
+local export done cd then awk 'quoted text' grep cd export --verbose
+	x=1 done export | ${HOME} 'quoted text' | | "$1" readonly grep ${HOME} x=1 &&
+"$1" test /usr/bin x=1 echo then echo && export sed -eu 'quoted text' local
+	x=1 test test 2>/dev/null awk awk -eu /usr/bin 2>/dev/null
+	--verbose /usr/bin export x=1 --verbose test test grep
+		cd then cd ${HOME} /usr/bin $(pwd) x=1 /usr/bin done awk cd 2>/dev/null local
+		awk local 'quoted text' grep grep 2>/dev/null x=1 export
+	sed done x=1 then "$1" then echo sed echo x=1 $(pwd) | "$1" --verbose local done
+"$1" awk -eu done 'quoted text' -eu x=1
+-eu then && awk echo ${HOME} export x=1 awk $(pwd) grep | sed 2>/dev/null /usr/bin
+		--verbose cd sed -eu 'quoted text' awk 2>/dev/null printf done readonly
+		test $(pwd) then awk sed cd export grep local --verbose sed echo awk
+	local export readonly done awk grep "$@" cd
+	$(pwd) awk export sed "$1" echo grep x=1 test | cd "$1"
+		export "$@" --verbose local 'quoted text' cd test /usr/bin
+		x=1 -eu cd 'quoted text' 'quoted text'
+echo ${HOME} ${HOME} sed echo export grep
+	"$1" ${HOME} ${HOME} echo x=1
+sed && 2>/dev/null printf x=1 export printf export 'quoted text' grep test
+$(pwd) grep -eu cd 2>/dev/null
+		"$@" cd "$1" done /usr/bin printf done
+	-eu 2>/dev/null "$1" /usr/bin grep cd
+export "$@" ${HOME} && done 'quoted text'
+	readonly "$1" "$1" cd ${HOME} | "$@" export x=1 -eu printf
+$(pwd) done && 2>/dev/null test && done
+'quoted text' awk /usr/bin
+	echo awk then local grep done -eu awk echo export
+	cd cd && grep then echo sed 'quoted text' cd | /usr/bin
+		$(pwd) then ${HOME} sed
+		${HOME} echo x=1 cd x=1 awk /usr/bin test "$@" && export awk -eu local local then
+		"$@" done local "$1" | echo awk /usr/bin local --verbose readonly test
+	readonly local x=1 ${HOME} then "$1" -eu | grep
+--verbose cd -eu && sed "$1" local 'quoted text' local readonly --verbose
+		/usr/bin echo /usr/bin ${HOME} readonly grep "$1" $(pwd) $(pwd) --verbose
+	"$1" "$1" x=1 export
+	cd awk then local test printf grep then printf printf
+test 'quoted text' then /usr/bin && x=1 awk sed sed grep
+$(pwd) echo export x=1 /usr/bin
+		--verbose -eu export printf $(pwd) -eu
+-eu $(pwd) cd echo "$@" readonly sed
+export "$1" local "$1"
+${HOME} | /usr/bin export --verbose -eu && | test
+test | && 2>/dev/null
+		2>/dev/null readonly cd local echo 2>/dev/null -eu
+2>/dev/null "$@" cd echo echo
+	echo then awk cd ${HOME} export /usr/bin
+		test x=1 export readonly awk
+	printf 'quoted text' local /usr/bin
+		cd test /usr/bin "$@" x=1 -eu $(pwd) 'quoted text' test -eu export printf readonly
+	"$@" sed && printf | export grep 'quoted text'
+		"$@" readonly ${HOME} ${HOME} -eu $(pwd)
+	done "$1" "$1" then ${HOME}
+		awk local --verbose cd awk local cd x=1 cd x=1 echo done | -eu local
+export /usr/bin 'quoted text'
+echo echo sed export sed | /usr/bin
+echo done $(pwd) test &&
+${HOME} 'quoted text' ${HOME} printf grep
+	test --verbose then test readonly sed x=1 cd sed -eu | local sed 'quoted text'
+readonly | export cd grep --verbose cd 'quoted text' sed ${HOME} grep ${HOME}
+		$(pwd) 2>/dev/null --verbose --verbose | printf x=1 printf -eu
+		sed | echo 2>/dev/null then done readonly local readonly ${HOME} printf ${HOME}
+		sed | x=1 printf 'quoted text' &&
+sed | local test echo /usr/bin
+'quoted text' local x=1 2>/dev/null --verbose
+		test cd x=1 -eu 'quoted text' x=1 awk -eu done 'quoted text' 'quoted text' printf
+then | echo -eu done test sed /usr/bin sed x=1 -eu sed done sed 'quoted text'
+	test "$1" sed awk test grep export local sed printf local x=1
+		grep 'quoted text' $(pwd)
+		${HOME} | --verbose /usr/bin "$@" test echo export echo /usr/bin 2>/dev/null
+	"$@" echo x=1 test -eu grep /usr/bin printf printf 2>/dev/null 'quoted text'
+done grep grep cd done --verbose awk local "$1" -eu test "$@" --verbose
+	2>/dev/null --verbose "$@" grep /usr/bin ${HOME}
+		-eu test x=1 then "$@" -eu cd readonly -eu local export grep
+	${HOME} "$@" 'quoted text' grep "$@" cd done export
+'quoted text' x=1 local readonly
+	"$1" x=1 cd 2>/dev/null x=1 --verbose done
+"$@" --verbose /usr/bin grep 'quoted text' "$1"
+export export && ${HOME} grep /usr/bin echo
+'quoted text' | echo cd --verbose export -eu
+"$1" cd then test 'quoted text' "$@" "$1" echo
+test -eu --verbose x=1 2>/dev/null | export x=1 export echo cd $(pwd) --verbose
+		done sed -eu 2>/dev/null $(pwd) done $(pwd) ${HOME} 'quoted text' 'quoted text'
+local "$1" echo | --verbose export /usr/bin --verbose cd
+-eu -eu done test 2>/dev/null
+		printf printf "$@" 2>/dev/null local /usr/bin
+"$@" $(pwd) --verbose $(pwd) grep && "$1" $(pwd) --verbose cd awk grep
+		--verbose "$@" /usr/bin | && "$@" "$1" -eu then --verbose then
+	local printf then $(pwd) "$1" ${HOME} &&
+		cd x=1 grep done x=1 done done cd --verbose /usr/bin 'quoted text'
+	'quoted text' 'quoted text' local readonly "$1" export /usr/bin 2>/dev/null
+	/usr/bin local sed 2>/dev/null /usr/bin x=1 'quoted text' /usr/bin 'quoted text'
+		$(pwd) && 2>/dev/null readonly awk | done ${HOME} test ${HOME}
+cd 2>/dev/null sed x=1 cd printf /usr/bin export
+then done awk readonly -eu export awk 2>/dev/null printf export
+		&& then test $(pwd) -eu echo grep 2>/dev/null $(pwd) echo grep | echo
+	&& x=1 'quoted text' done 2>/dev/null printf sed test /usr/bin local cd
+		x=1 readonly printf cd /usr/bin 2>/dev/null
+	"$1" test then printf cd test && "$1" -eu ${HOME} cd --verbose
+	echo printf readonly done printf test && "$1" printf --verbose
+		echo grep then ${HOME} echo grep && /usr/bin test --verbose --verbose
+	readonly grep 2>/dev/null grep echo test awk /usr/bin awk done done
+	done sed readonly awk 'quoted text'
+	/usr/bin 2>/dev/null echo echo readonly x=1 printf test
+	then x=1 sed "$@" -eu readonly
+		| 2>/dev/null /usr/bin 2>/dev/null
+		"$@" "$1" /usr/bin export printf grep && printf 'quoted text' "$1" --verbose cd
+readonly "$1" $(pwd) printf /usr/bin then export --verbose printf
+awk awk 'quoted text' cd
+		"$1" /usr/bin local 2>/dev/null printf
+${HOME} echo test sed --verbose
+-eu grep then --verbose test x=1 awk
+export ${HOME} "$1" && readonly grep echo export
+printf "$1" local echo echo /usr/bin cd | "$@" awk then -eu /usr/bin readonly
+"$@" sed readonly awk export
+		test --verbose && 2>/dev/null
+2>/dev/null --verbose -eu done /usr/bin done test local echo 'quoted text'
+		grep then grep test done printf ${HOME} /usr/bin
+test printf 'quoted text' sed -eu 'quoted text' readonly readonly
+${HOME} test "$1" /usr/bin --verbose
+	awk sed echo grep grep test printf $(pwd)
+printf export 2>/dev/null
+local local then /usr/bin /usr/bin cd "$@" cd readonly grep awk
+	cd $(pwd) echo 'quoted text' "$1" sed ${HOME} /usr/bin
+		"$@" readonly printf ${HOME} ${HOME} x=1
+&& readonly "$@" "$@" sed then -eu local $(pwd)
+		/usr/bin sed -eu 'quoted text' | local x=1 test readonly then 'quoted text'
+	"$1" cd $(pwd) ${HOME} sed readonly 2>/dev/null && awk &&
+	cd $(pwd) local && x=1 grep test 2>/dev/null local test printf
+	local local readonly x=1 echo --verbose /usr/bin
+	&& 'quoted text' | awk
+		cd sed echo -eu 2>/dev/null export "$1" printf sed "$@" cd
+		awk | readonly --verbose $(pwd) | 'quoted text'
+grep $(pwd) 2>/dev/null cd /usr/bin
+		| then grep echo printf done
+then sed export printf sed && --verbose export x=1 done $(pwd)
+		then printf local cd sed | then
+		2>/dev/null -eu "$@" echo x=1 "$@" "$@" $(pwd) readonly
+	-eu && grep && local --verbose local x=1 sed sed printf /usr/bin echo export $(pwd)
+		done x=1 /usr/bin x=1 "$@" /usr/bin "$@" 'quoted text' then 2>/dev/null grep
+		/usr/bin ${HOME} export "$1" "$@" "$@" ${HOME} && "$@" | done sed sed local
+--verbose ${HOME} export done /usr/bin | export export
+		then printf test | export && $(pwd) --verbose
+		&& /usr/bin | then && "$1" test cd printf
+		printf && 'quoted text'
+	sed sed /usr/bin /usr/bin /usr/bin x=1 then $(pwd) test test cd readonly sed
+test 2>/dev/null grep readonly done x=1 awk
+		/usr/bin local printf cd /usr/bin readonly
+		&& grep --verbose local 2>/dev/null done "$1"
+| --verbose local cd /usr/bin cd | grep test export readonly
+		${HOME} "$@" $(pwd) test local test /usr/bin /usr/bin sed readonly
+		${HOME} test ${HOME} && export /usr/bin /usr/bin
+	/usr/bin --verbose readonly && "$1" local $(pwd)
+		echo 2>/dev/null $(pwd) test done readonly ${HOME} $(pwd) local then cd /usr/bin
+export "$1" 'quoted text'
+	printf grep export | --verbose local $(pwd) cd then then $(pwd) awk ${HOME}
+		grep 'quoted text' --verbose readonly /usr/bin 'quoted text'
+&& awk test printf -eu
+		2>/dev/null -eu awk local x=1 -eu echo -eu export grep $(pwd) test then
+echo /usr/bin printf awk
+		grep sed "$@" printf $(pwd) 2>/dev/null grep && sed 'quoted text' test && grep
+	export "$@" /usr/bin awk sed readonly local x=1 then | -eu export "$@" test /usr/bin
+		| "$@" readonly /usr/bin done readonly echo "$@" done $(pwd) printf grep
+	&& 'quoted text' --verbose -eu sed readonly $(pwd) | --verbose | && awk grep
+		printf x=1 "$1" 'quoted text' then sed sed $(pwd) grep $(pwd) | echo awk echo
+printf done --verbose --verbose | 2>/dev/null $(pwd)
+	"$@" printf ${HOME} && test cd /usr/bin "$1"
+test $(pwd) export /usr/bin "$1" "$1" local sed
+	awk --verbose 2>/dev/null then local ${HOME} readonly
+	grep x=1 "$@" printf | && then grep sed -eu ${HOME} "$1"
+local | grep | 2>/dev/null awk echo done 2>/dev/null local awk then
+printf echo cd $(pwd) x=1 |
+		'quoted text' done grep /usr/bin
+	local readonly "$1" 2>/dev/null 2>/dev/null cd
+	2>/dev/null --verbose ${HOME} done done
+		${HOME} | local "$@" readonly then grep readonly test
+	"$@" sed then readonly sed sed grep "$1"
+		grep cd grep sed "$@" export 'quoted text' $(pwd) /usr/bin
+		awk 2>/dev/null "$@" cd 'quoted text' cd /usr/bin done
+done | done "$@" x=1 'quoted text' local readonly
+test local sed "$1" echo test | local
+	test echo && sed ${HOME}
+		${HOME} grep "$@" local sed 2>/dev/null --verbose test
+/usr/bin && cd -eu ${HOME} sed then grep 'quoted text' -eu
+	'quoted text' local readonly echo done cd 'quoted text'
+sed "$1" sed done ${HOME} 'quoted text' 2>/dev/null
+	${HOME} x=1 done /usr/bin awk
+		&& /usr/bin ${HOME} sed readonly
+		"$@" "$@" /usr/bin /usr/bin then | then 2>/dev/null --verbose cd
+export test grep $(pwd) -eu && test
+		then "$@" -eu ${HOME} "$@" then test "$1" grep local export
+	"$@" $(pwd) -eu sed 'quoted text' local echo printf x=1 sed grep sed sed |
+	"$@" | "$1" awk && $(pwd) readonly
+		grep then | 2>/dev/null sed test local ${HOME} x=1 done && export
+	/usr/bin | echo x=1 2>/dev/null 'quoted text' done 2>/dev/null /usr/bin 'quoted text'
+$(pwd) --verbose export 2>/dev/null awk then ${HOME} local awk export
+		echo done && awk awk /usr/bin --verbose grep -eu echo && export
+	--verbose x=1 done readonly printf awk
+	| grep /usr/bin 2>/dev/null
+grep awk sed then "$1" -eu --verbose printf -eu | /usr/bin x=1 readonly sed
+	sed -eu | 2>/dev/null 'quoted text' /usr/bin && -eu ${HOME} export readonly
+	then /usr/bin export 'quoted text' export | local "$1" "$1" done 'quoted text'
+	-eu "$1" readonly "$@" done test "$@" cd local "$@" 'quoted text'
+		cd 'quoted text' printf
+done test readonly readonly | /usr/bin --verbose grep "$1"
+	then 'quoted text' printf then
+printf 2>/dev/null x=1 cd done
+		"$1" x=1 sed | awk | && /usr/bin 'quoted text' -eu
+		x=1 done x=1 sed x=1 then x=1 done "$@" && -eu --verbose
+	cd echo x=1 readonly readonly export $(pwd) cd cd -eu cd local
+	| local 'quoted text' awk readonly cd awk sed awk grep local
+	printf local printf grep "$@" x=1 then then 'quoted text'
+	export /usr/bin echo ${HOME}
+local ${HOME} sed grep /usr/bin printf sed x=1 -eu /usr/bin cd ${HOME}
+done | $(pwd) 'quoted text' awk cd "$@" $(pwd)
+		local grep -eu -eu echo | cd -eu $(pwd) 'quoted text' awk x=1 readonly /usr/bin
+| "$1" $(pwd) | export grep cd "$@" awk | test "$1" sed cd grep
+"$@" "$1" ${HOME} then "$1" test done
+local /usr/bin "$@" "$1"
+$(pwd) awk x=1 "$@" ${HOME} 'quoted text'
+"$@" ${HOME} export "$@" "$1" --verbose --verbose "$@" 'quoted text'
+		export done && && export && "$1" sed
+	--verbose && -eu 2>/dev/null
+		--verbose export local "$1" 'quoted text' test && export -eu test sed echo -eu
+'quoted text' /usr/bin then grep --verbose cd sed -eu x=1 && test
+		then readonly 2>/dev/null $(pwd) export readonly readonly x=1 && 2>/dev/null x=1
+		cd echo 'quoted text' $(pwd) && 'quoted text'
+		-eu 'quoted text' grep printf then /usr/bin test "$@" $(pwd) readonly
+		readonly | export done
+		awk done | ${HOME} "$@" test $(pwd) 2>/dev/null --verbose
+"$1" "$@" test grep 2>/dev/null x=1 ${HOME} done /usr/bin x=1 printf readonly
+		export "$1" echo -eu grep /usr/bin printf then 2>/dev/null x=1
+	&& "$@" "$@" grep $(pwd) test done test awk && 'quoted text' x=1 grep
+	awk 2>/dev/null then then awk local readonly
+		local -eu 'quoted text'
+		awk test /usr/bin x=1 local readonly | 2>/dev/null
+2>/dev/null "$1" | ${HOME} 'quoted text'
+		/usr/bin $(pwd) printf cd $(pwd) echo
+		/usr/bin --verbose cd done 'quoted text' cd cd && -eu x=1
+awk local awk x=1 then 'quoted text' 2>/dev/null readonly x=1 cd test cd 'quoted text'
+export x=1 then test "$@" cd -eu done "$1" export /usr/bin
+"$@" | test then "$1" done
+		test -eu -eu test x=1 sed grep ${HOME} /usr/bin "$1" 'quoted text'
+		sed $(pwd) ${HOME} echo export test
+	'quoted text' printf cd grep $(pwd) 'quoted text' local echo x=1
+		${HOME} then local --verbose sed x=1 sed /usr/bin ${HOME} local
+readonly grep done 2>/dev/null
+	/usr/bin "$1" /usr/bin printf
+	2>/dev/null then test x=1 x=1 -eu echo awk --verbose
+	/usr/bin grep printf test local "$@" test cd sed grep
+		readonly x=1 then done echo --verbose cd readonly
+	printf done -eu | awk "$@" -eu done awk test && ${HOME}
+	-eu --verbose ${HOME} 2>/dev/null grep local && awk grep readonly 2>/dev/null
+done printf grep 'quoted text' | cd --verbose 'quoted text' echo 2>/dev/null
+		export && /usr/bin done x=1 --verbose grep cd
+		grep then grep 'quoted text' "$@" test grep x=1 cd test grep 2>/dev/null cd 2>/dev/null
+local cd /usr/bin $(pwd) grep && 2>/dev/null | -eu "$1"
+echo test done export grep /usr/bin -eu
+x=1 test awk $(pwd) then test $(pwd) awk ${HOME} then $(pwd) |
+	test export -eu local awk
+grep local ${HOME} "$@" /usr/bin 'quoted text' then printf then -eu local
+	"$@" echo awk | --verbose 2>/dev/null && 'quoted text' --verbose echo test printf
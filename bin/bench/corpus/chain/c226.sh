@@ -0,0 +1,2001 @@
+		--verbose --verbose test cd -eu $(pwd) done awk echo | test test grep --verbose
+		| 'quoted text' | "$1" x=1 $(pwd)
+		'quoted text' "$1" test done awk x=1 ${HOME}
+		sed 2>/dev/null grep 'quoted text' /usr/bin then local printf
+--verbose | then && sed
+		printf done && test grep "$@" export
+	2>/dev/null x=1 cd printf awk x=1 -eu readonly "$@" echo $(pwd)
+		echo export cd then 'quoted text' printf local --verbose 2>/dev/null
+	then export then printf export x=1 then -eu
+awk test sed 2>/dev/null export x=1 'quoted text'
+		&& test local /usr/bin local then --verbose x=1 "$1" done grep grep
+grep printf && "$@" x=1 ${HOME} printf 'quoted text' readonly awk
+	&& echo --verbose done cd awk | grep grep
+	"$@" echo awk then done 'quoted text' | done 'quoted text'
+--verbose cd printf /usr/bin sed grep x=1 grep /usr/bin grep
+awk sed printf printf grep readonly
+		test test then then printf local
+--verbose cd then export awk awk local
+		echo echo && awk local "$1" local ${HOME} test test
+		$(pwd) done export ${HOME} echo grep /usr/bin
+		&& "$@" "$1" echo sed "$1" done local sed "$1" x=1 done done readonly
+		"$@" then "$1" sed "$1" grep export local x=1 "$1"
+local ${HOME} $(pwd) ${HOME} -eu /usr/bin
+cd printf sed readonly sed $(pwd)
+	'quoted text' "$@" done printf ${HOME} 2>/dev/null
+		awk then $(pwd) local 2>/dev/null 'quoted text' export printf then && sed | x=1
+	--verbose /usr/bin /usr/bin grep grep | | then test -eu cd --verbose --verbose
+then | done grep cd local local then "$@" local done sed cd echo grep ${HOME}
+grep --verbose awk readonly
+	awk sed then then "$@" $(pwd) echo -eu echo local echo 2>/dev/null $(pwd)
+		$(pwd) | $(pwd) readonly sed | && printf && sed --verbose
+local cd test /usr/bin 2>/dev/null "$1" test 2>/dev/null
+awk sed local echo sed 'quoted text' "$1" cd echo
+awk 2>/dev/null export readonly awk grep /usr/bin "$1" cd export
+then 'quoted text' x=1 | sed /usr/bin readonly export printf x=1
+		awk -eu export done printf /usr/bin ${HOME} echo
+	2>/dev/null /usr/bin ${HOME} && then $(pwd) cd export ${HOME}
+${HOME} "$@" $(pwd) --verbose local 2>/dev/null cd 'quoted text'
+"$1" "$@" --verbose -eu ${HOME} cd /usr/bin -eu then | export ${HOME}
+	--verbose "$@" local done x=1 sed then
+	${HOME} test printf test local done sed ${HOME} -eu local grep "$1" --verbose
+		x=1 printf -eu x=1 test echo echo ${HOME}
+	--verbose export sed echo grep
+	readonly 2>/dev/null test echo 'quoted text' then
+readonly x=1 --verbose readonly export awk export 2>/dev/null
+		&& echo readonly export "$1" "$1"
+/usr/bin test cd ${HOME} printf export -eu
+	-eu "$@" export local "$1" /usr/bin | "$1" /usr/bin $(pwd)
+	awk printf done sed | export | x=1 2>/dev/null
+export local 'quoted text'
+	echo then echo | $(pwd) | done | "$@" 2>/dev/null $(pwd)
+		"$1" export x=1 && $(pwd) then local "$1" /usr/bin awk readonly $(pwd) x=1 cd
+		export sed awk 2>/dev/null grep ${HOME}
+		/usr/bin -eu local --verbose --verbose printf x=1 grep local test x=1 x=1 grep
+'quoted text' echo &&
+sed readonly 'quoted text' $(pwd) 'quoted text'
+| done /usr/bin printf sed readonly -eu ${HOME} test done test done done awk
+--verbose echo | awk x=1 readonly test "$1" ${HOME} printf printf "$1" -eu
+local -eu echo ${HOME} export done | | $(pwd) x=1 ${HOME} ${HOME} export
+&& && test && "$1" cd && done grep -eu cd test cd
+readonly "$1" 2>/dev/null --verbose $(pwd) echo x=1 grep /usr/bin ${HOME}
+	local x=1 awk test /usr/bin /usr/bin 2>/dev/null x=1
+	&& then grep done awk | echo export 2>/dev/null "$1" sed "$1" /usr/bin echo 2>/dev/null
+awk ${HOME} 2>/dev/null echo grep then
+-eu cd --verbose -eu -eu readonly "$1" && x=1 /usr/bin | done cd $(pwd)
+sed x=1 -eu cd "$1" 'quoted text' export
+x=1 "$1" awk --verbose && echo echo $(pwd) awk -eu printf 2>/dev/null
+		sed export /usr/bin "$1" "$@" ${HOME} sed then
+	&& printf --verbose echo | && test "$1" cd test then then printf ${HOME}
+		"$@" then -eu awk awk 'quoted text' sed 2>/dev/null ${HOME} -eu
+		/usr/bin | cd printf 2>/dev/null x=1 ${HOME} done /usr/bin
+awk 'quoted text' "$1" echo -eu | export done cd export 'quoted text'
+		/usr/bin cd && grep test
+local ${HOME} local sed "$@" $(pwd) 'quoted text' "$1" --verbose "$1" printf
+		grep sed -eu ${HOME} | 2>/dev/null "$@" x=1
+	'quoted text' /usr/bin 'quoted text'
+readonly echo 'quoted text' sed x=1 sed x=1 -eu sed -eu 2>/dev/null readonly
+		then export local "$1" then cd $(pwd) && echo
+		then 'quoted text' ${HOME} "$1" ${HOME} | "$@" x=1 readonly
+	test | echo cd 'quoted text' awk grep --verbose awk x=1 awk done echo local
+		&& awk "$@" test cd local 2>/dev/null x=1 "$1" readonly 2>/dev/null awk readonly
+test 'quoted text' "$1" "$1" 'quoted text' /usr/bin
+	"$1" echo x=1 $(pwd) | awk printf awk "$1"
+	awk awk sed test grep cd 2>/dev/null
+	$(pwd) awk done x=1 readonly | ${HOME} -eu export export echo export then
+	"$@" 'quoted text' done sed | -eu && -eu local 2>/dev/null
+		printf done /usr/bin test echo readonly echo x=1 -eu 2>/dev/null && done
+		&& printf grep readonly "$@" local | echo -eu echo readonly x=1
+		'quoted text' 2>/dev/null
+		| "$@" -eu /usr/bin test -eu done awk 'quoted text' 2>/dev/null cd grep
+		"$@" x=1 'quoted text' cd -eu awk x=1 readonly "$@" export awk local export
+		done ${HOME} ${HOME} export
+		export 'quoted text' | printf "$1" printf export sed -eu
+		printf sed readonly cd
+	sed test export then grep 'quoted text' sed "$1"
+		cd $(pwd) awk "$1" done sed 'quoted text' $(pwd) 2>/dev/null
+then --verbose done ${HOME} grep 'quoted text'
+echo sed printf test awk 'quoted text' awk /usr/bin grep "$1" export
+		--verbose && then "$1" ${HOME} sed
+${HOME} && done readonly echo x=1 --verbose ${HOME} /usr/bin
+local local then grep 2>/dev/null "$1" readonly "$1" local then --verbose
+--verbose -eu --verbose readonly &&
+	--verbose printf 2>/dev/null
+"$1" local readonly --verbose ${HOME} && awk awk echo
+x=1 printf awk | printf cd "$1" test export && && ${HOME} echo --verbose
+echo && test awk cd --verbose --verbose "$@" export
+	echo echo --verbose grep 2>/dev/null -eu 2>/dev/null readonly
+		"$1" --verbose sed awk 2>/dev/null test printf --verbose
+	readonly readonly ${HOME} && done ${HOME} readonly |
+local ${HOME} done $(pwd) then done /usr/bin done "$1" $(pwd) export "$1"
+	"$@" grep cd && -eu && local local && ${HOME} 'quoted text' 'quoted text'
+	test x=1 test sed /usr/bin grep --verbose then sed local 'quoted text' x=1 sed
+	$(pwd) sed then /usr/bin sed cd 2>/dev/null
+	"$@" x=1 cd && && 2>/dev/null 2>/dev/null local test x=1 export grep then
+x=1 grep awk /usr/bin /usr/bin grep --verbose grep cd /usr/bin
+	cd printf cd cd done sed cd $(pwd) export
+done readonly ${HOME} ${HOME}
+		'quoted text' ${HOME} 'quoted text' grep
+		${HOME} echo 2>/dev/null local cd 'quoted text' -eu cd --verbose awk /usr/bin local
+-eu -eu test "$@" grep local readonly $(pwd) done x=1 | done -eu grep "$@"
+/usr/bin done 2>/dev/null local 2>/dev/null grep /usr/bin printf echo --verbose
+printf then grep grep echo "$@" 'quoted text'
+		readonly /usr/bin "$@" export echo "$1" x=1 local test | export
+		readonly "$1" x=1 "$@" /usr/bin "$1" --verbose cd 2>/dev/null --verbose && cd cd
+		awk /usr/bin sed awk && $(pwd) && sed && 'quoted text' local --verbose "$1"
+printf && printf /usr/bin $(pwd) x=1 awk export
+test local ${HOME} echo grep x=1 2>/dev/null done local && readonly
+	done -eu export x=1 then "$@"
+		"$@" $(pwd) --verbose done cd ${HOME} awk
+$(pwd) local echo echo "$@" $(pwd) awk && local local cd 'quoted text' "$@"
+		readonly --verbose "$@" 'quoted text' "$@" local local
+	'quoted text' "$1" $(pwd) | 'quoted text'
+		local 'quoted text' grep -eu local "$@" local printf && grep "$1" "$@"
+		'quoted text' cd export then cd -eu local test 2>/dev/null
+awk 2>/dev/null grep 2>/dev/null grep
+export | | --verbose -eu export export awk readonly done
+export test "$@" done export "$1" -eu export |
+/usr/bin readonly && cd | -eu grep 'quoted text'
+	| export && 2>/dev/null grep ${HOME} ${HOME} awk ${HOME} x=1
+		2>/dev/null awk && local sed
+		| "$@" export "$1" done x=1 cd cd
+/usr/bin 2>/dev/null $(pwd) --verbose cd done then 'quoted text' cd -eu -eu ${HOME}
+		printf test export done printf sed 2>/dev/null $(pwd) then grep 2>/dev/null
+local local export | cd --verbose
+		test "$@" x=1 && 2>/dev/null sed then echo cd sed cd 'quoted text'
+local cd --verbose done
+-eu printf then 'quoted text' /usr/bin
+		cd export readonly "$@" awk test "$@" cd done test 2>/dev/null then
+	awk export awk "$1" local grep export echo "$@" "$1" test local --verbose export
+		&& test "$1" | "$@" sed then cd "$1" --verbose grep local
+	/usr/bin cd then "$1" done test "$@" -eu test then cd --verbose $(pwd)
+	"$1" --verbose "$@" "$1" echo $(pwd) printf x=1 export | x=1 2>/dev/null
+	| echo awk -eu echo local -eu echo then ${HOME} then | | export then 'quoted text'
+done printf then grep test done
+		| ${HOME} --verbose x=1 sed $(pwd) awk cd printf printf
+		x=1 printf 2>/dev/null export echo cd
+		sed awk sed --verbose && readonly export --verbose ${HOME} -eu
+awk done | awk cd readonly
+		grep awk grep cd export cd $(pwd) "$1" printf
+awk x=1 --verbose 'quoted text' cd $(pwd)
+	printf "$@" 2>/dev/null ${HOME} | 'quoted text' 'quoted text' grep printf
+$(pwd) | 2>/dev/null echo echo x=1 export
+	grep then awk --verbose ${HOME} && awk cd 'quoted text'
+	local "$1" x=1 $(pwd) test cd ${HOME} | printf grep cd
+	then -eu && sed awk $(pwd) done ${HOME} cd x=1 "$@" -eu && readonly ${HOME}
+${HOME} "$1" echo | cd 2>/dev/null
+readonly 2>/dev/null sed ${HOME}
+	/usr/bin cd export x=1 -eu printf
+	test $(pwd) cd -eu cd 'quoted text' grep "$1" done printf echo -eu --verbose
+	${HOME} cd $(pwd) "$@" 'quoted text'
+		| "$@" 'quoted text' done done done ${HOME} then echo sed --verbose "$1"
+/usr/bin grep export ${HOME} | then test test && cd && --verbose sed cd local
+then export | export done x=1 readonly
+	2>/dev/null 'quoted text' --verbose -eu readonly $(pwd) -eu $(pwd) grep sed "$@"
+awk -eu then $(pwd) --verbose $(pwd) "$@" 2>/dev/null printf
+'quoted text' --verbose --verbose /usr/bin
+| ${HOME} then printf grep sed export printf ${HOME}
+-eu readonly "$1" | awk test then /usr/bin 2>/dev/null done
+-eu then --verbose "$@" $(pwd) "$1"
+--verbose $(pwd) test cd then cd printf 2>/dev/null then "$1" done readonly cd /usr/bin
+		export printf export -eu "$1" readonly | /usr/bin readonly
+		sed /usr/bin printf cd awk --verbose /usr/bin
+		echo && echo "$@" x=1 test readonly ${HOME} | --verbose cd awk /usr/bin
+readonly grep test local done --verbose && 'quoted text' /usr/bin test -eu readonly
+test | then awk 'quoted text'
+		echo 'quoted text' /usr/bin
+		$(pwd) printf done done printf
+	'quoted text' | --verbose && 2>/dev/null x=1 awk cd grep 'quoted text' cd && --verbose
+		/usr/bin test then awk | readonly
+	&& awk $(pwd) -eu "$1" --verbose export awk local printf x=1 2>/dev/null x=1
+		local 2>/dev/null readonly 'quoted text'
+		local test 'quoted text' export printf
+test awk "$1" printf --verbose echo $(pwd) readonly printf ${HOME}
+'quoted text' done test
+		printf grep grep 'quoted text'
+	| local "$@" "$@" export $(pwd) printf grep sed | awk awk | grep sed | test
+	--verbose done --verbose | x=1 | done 'quoted text' "$1" grep 2>/dev/null | 2>/dev/null
+done cd test export sed
+		&& then test local 'quoted text' "$1"
+${HOME} | then printf 2>/dev/null sed test cd echo cd x=1 x=1 x=1
+	printf then local --verbose ${HOME} printf
+	$(pwd) printf x=1 'quoted text' echo grep | then export sed readonly done 2>/dev/null
+		then --verbose 2>/dev/null /usr/bin readonly done printf 'quoted text' test ${HOME}
+	${HOME} cd printf awk readonly done grep sed
+test | 'quoted text' done /usr/bin "$@"
+printf local -eu then awk export "$@" done -eu
+	"$@" $(pwd) then x=1 export && awk x=1 sed -eu "$@" x=1 $(pwd)
+	--verbose --verbose -eu x=1 done 2>/dev/null "$1"
+		grep "$1" printf ${HOME} export cd $(pwd) -eu readonly printf $(pwd)
+		"$@" done ${HOME} | echo test grep $(pwd)
+		| grep sed local done $(pwd) echo
+		${HOME} done readonly $(pwd) && awk awk && $(pwd) /usr/bin awk test "$@" grep
+		grep echo done -eu 'quoted text' awk then
+		-eu export $(pwd) x=1 "$@"
+	test | ${HOME} | done printf grep ${HOME} --verbose
+	readonly export | "$1" x=1 then readonly
+	-eu readonly sed ${HOME} done done ${HOME} readonly
+readonly 2>/dev/null ${HOME} test && then readonly sed | then --verbose $(pwd) local
+awk x=1 grep local cd done ${HOME} --verbose local local -eu 'quoted text'
+cd "$1" then 'quoted text' then echo 2>/dev/null
+		--verbose sed x=1 test cd
+cd test 'quoted text' --verbose test
+test x=1 grep x=1 && local && ${HOME} export
+		x=1 /usr/bin sed | 'quoted text'
+	--verbose ${HOME} "$1" done --verbose awk export 'quoted text'
+local "$1" "$@" then printf awk "$1" echo 'quoted text' printf --verbose && local
+--verbose sed 'quoted text' readonly
+grep $(pwd) -eu /usr/bin /usr/bin ${HOME} x=1 export then 'quoted text'
+		export /usr/bin local cd /usr/bin printf
+	printf sed "$1" | grep && done awk test
+&& done then awk printf sed
+		-eu local | grep printf printf readonly "$1" "$@" 'quoted text'
+$(pwd) awk awk echo && readonly 2>/dev/null export readonly done cd
+		2>/dev/null cd $(pwd) $(pwd) ${HOME}
+	grep done readonly then
+-eu grep -eu -eu readonly done ${HOME}
+	readonly then "$1" readonly awk /usr/bin readonly "$1" "$1" --verbose
+		readonly printf cd "$@" echo done ${HOME} --verbose awk "$1" "$@"
+	grep --verbose $(pwd) $(pwd) "$@" grep x=1 "$1" --verbose
+	--verbose /usr/bin "$1" "$1" echo "$@" -eu cd -eu printf readonly
+	"$1" 'quoted text' 2>/dev/null 2>/dev/null
+		'quoted text' grep local | && |
+	x=1 'quoted text' grep -eu ${HOME} awk awk readonly --verbose $(pwd)
+		test test "$1" local -eu 'quoted text' then -eu sed printf 'quoted text'
+/usr/bin 'quoted text' then "$1"
+		"$@" ${HOME} $(pwd) export $(pwd) "$@" cd 2>/dev/null --verbose printf awk
+	x=1 -eu x=1 "$1" x=1 done 'quoted text' test --verbose done
+		test | $(pwd) export awk test 2>/dev/null
+--verbose awk ${HOME} export "$1" readonly grep done test
+		${HOME} && 2>/dev/null readonly export grep | |
+	echo cd test test --verbose sed 'quoted text'
+	echo awk export echo sed export grep
+	export awk printf export ${HOME} sed x=1 "$1" 2>/dev/null
+		printf readonly awk ${HOME} "$1" -eu awk sed /usr/bin x=1
+	local then printf then awk -eu /usr/bin readonly -eu done local 2>/dev/null
+		printf export readonly local "$1" local $(pwd) readonly awk $(pwd)
+awk done 'quoted text' --verbose "$@" x=1 | /usr/bin echo
+		export printf 'quoted text' $(pwd)
+$(pwd) local printf --verbose grep $(pwd) && $(pwd) test /usr/bin readonly
+	readonly test echo readonly /usr/bin local printf
+		"$1" sed x=1 test $(pwd) readonly done local "$1" /usr/bin "$@"
+cd readonly readonly ${HOME}
+	$(pwd) done echo 2>/dev/null -eu local cd 2>/dev/null export test ${HOME}
+sed test "$@" "$1" 'quoted text' 2>/dev/null && cd "$1" readonly
+		2>/dev/null printf && --verbose awk
+-eu grep cd test x=1 'quoted text' then $(pwd) 2>/dev/null && /usr/bin && 'quoted text'
+		echo x=1 grep && test done /usr/bin export test echo
+		-eu "$1" 2>/dev/null sed -eu ${HOME} cd $(pwd) | x=1 local sed readonly export
+		"$1" test done "$@" readonly export sed $(pwd) export local | cd
+printf --verbose done /usr/bin printf
+		then | cd x=1 -eu echo /usr/bin export
+--verbose grep then sed then test cd $(pwd) cd export readonly printf 2>/dev/null
+	then readonly | printf -eu echo 2>/dev/null cd awk
+sed local -eu "$@" 2>/dev/null "$@" $(pwd) "$@"
+	"$@" cd local printf 2>/dev/null x=1 $(pwd) ${HOME}
+	sed && cd echo awk sed /usr/bin ${HOME} -eu awk /usr/bin sed readonly $(pwd)
+	-eu grep $(pwd) 2>/dev/null test 2>/dev/null /usr/bin 2>/dev/null readonly
+		&& && "$@" "$@" --verbose && readonly grep awk test | sed
+printf then done readonly local --verbose sed x=1 'quoted text'
+	readonly --verbose "$@" readonly 'quoted text' done echo 'quoted text'
+${HOME} awk 'quoted text' echo test printf 'quoted text' cd cd $(pwd) readonly
+readonly local 'quoted text' done /usr/bin $(pwd)
+		| "$1" 'quoted text' readonly 2>/dev/null | cd export local awk x=1 sed
+then "$@" --verbose done /usr/bin
+	"$1" 'quoted text' x=1 then "$1"
+	"$1" x=1 then x=1 grep /usr/bin export -eu readonly && echo then
+	$(pwd) grep "$@" 2>/dev/null "$1"
+readonly $(pwd) echo ${HOME} 2>/dev/null grep
+${HOME} -eu then test /usr/bin done done -eu 'quoted text' 'quoted text'
+	sed printf test | test then awk --verbose -eu $(pwd) /usr/bin test sed 2>/dev/null
+	test awk cd | 'quoted text' x=1 --verbose /usr/bin /usr/bin "$@" /usr/bin sed
+	"$@" && 2>/dev/null "$1"
+	&& local --verbose printf 'quoted text'
+--verbose 'quoted text' ${HOME} awk echo /usr/bin 2>/dev/null then --verbose
+		${HOME} "$1" x=1 printf done test done "$@" done "$@" export printf then
+	-eu 'quoted text' done --verbose ${HOME} grep awk grep
+test | 'quoted text' 'quoted text' ${HOME}
+		"$@" -eu "$@" && printf /usr/bin "$1" echo
+printf --verbose sed ${HOME} 2>/dev/null 'quoted text' 'quoted text'
+$(pwd) then printf "$@" $(pwd) local
+		sed 2>/dev/null x=1 echo cd awk $(pwd) | export printf "$@" x=1 x=1 /usr/bin
+		&& -eu "$@" export "$1" 2>/dev/null then sed 2>/dev/null && $(pwd)
+grep awk printf $(pwd) grep $(pwd) | cd grep 2>/dev/null awk /usr/bin
+"$@" done local 'quoted text' "$@" x=1 sed cd sed local readonly
+		export test "$@" /usr/bin sed printf awk $(pwd) x=1 | ${HOME} "$@" x=1 cd -eu
+echo awk /usr/bin x=1 local test readonly
+readonly "$1" then test then "$@" "$1" awk $(pwd) then printf
+		printf ${HOME} done test sed --verbose "$@" -eu x=1 -eu then echo && "$@" 'quoted text'
+local 'quoted text' echo readonly --verbose --verbose --verbose
+		-eu then && test local then sed $(pwd) test then sed 2>/dev/null
+	readonly | cd | test --verbose --verbose local | export
+echo | -eu --verbose awk printf
+	"$1" x=1 test /usr/bin -eu 'quoted text' x=1 export "$@" grep
+		x=1 ${HOME} local done then | x=1 readonly cd then -eu "$1"
+	"$@" 'quoted text' && 'quoted text'
+		test then printf export 'quoted text'
+		"$@" "$1" -eu 2>/dev/null
+		local x=1 x=1 'quoted text' awk grep then 2>/dev/null /usr/bin readonly
+		'quoted text' local cd 2>/dev/null x=1
+		cd | "$1" test printf
+		--verbose awk x=1 echo "$1" sed sed grep sed readonly
+	"$@" local $(pwd) export
+	"$@" grep x=1 sed export export awk && "$@" /usr/bin 'quoted text'
+		2>/dev/null echo 'quoted text' sed
+		${HOME} -eu $(pwd) /usr/bin
+	echo /usr/bin && then && grep done /usr/bin $(pwd)
+		export readonly printf
+	test cd "$1" local ${HOME} echo local then 2>/dev/null
+-eu -eu done ${HOME} x=1
+	'quoted text' 2>/dev/null
+/usr/bin export "$@" x=1 'quoted text' 'quoted text' ${HOME} done x=1
+	local ${HOME} ${HOME} "$1" | sed awk test --verbose $(pwd) test 2>/dev/null
+		&& "$@" "$@" 'quoted text' done sed awk -eu grep readonly 'quoted text' -eu 'quoted text'
+		printf printf awk printf ${HOME} $(pwd) then
+	$(pwd) && readonly test ${HOME} 'quoted text' "$1" --verbose 2>/dev/null done sed
+		test 2>/dev/null 'quoted text' cd | export
+	--verbose grep | grep /usr/bin done "$@" printf test "$@"
+sed 'quoted text' --verbose -eu
+		sed $(pwd) 'quoted text' awk sed grep /usr/bin sed ${HOME} x=1 2>/dev/null
+	then local -eu "$1" done 2>/dev/null
+		--verbose cd done printf "$@"
+awk | && grep readonly
+		x=1 ${HOME} then --verbose awk $(pwd) readonly done readonly "$@" x=1 "$1"
+		2>/dev/null -eu --verbose export awk grep
+		sed 'quoted text' readonly done | test && "$@" 2>/dev/null
+		2>/dev/null export -eu grep -eu "$1" 2>/dev/null export 'quoted text'
+	&& --verbose printf then printf done then echo ${HOME}
+	test local awk sed local readonly
+then 2>/dev/null awk && 2>/dev/null $(pwd) printf "$@" 'quoted text' grep
+	done test $(pwd) echo 'quoted text' cd awk echo ${HOME}
+echo /usr/bin grep then sed sed printf export cd "$@" sed $(pwd) printf /usr/bin
+	&& ${HOME} printf sed local | "$@" done 2>/dev/null
+	test --verbose awk grep /usr/bin printf $(pwd) awk
+"$@" x=1 then && export "$1" $(pwd) "$1" printf
+		grep -eu export sed readonly awk sed 'quoted text'
+	"$1" printf --verbose 2>/dev/null
+'quoted text' | export ${HOME} "$@"
+	--verbose local grep "$1" then x=1 /usr/bin x=1 grep /usr/bin awk local grep ${HOME}
+	sed echo grep done ${HOME}
+'quoted text' printf ${HOME} --verbose local done echo export grep echo grep
+"$@" echo ${HOME} -eu x=1 done && ${HOME}
+		2>/dev/null 2>/dev/null
+"$1" ${HOME} sed cd test x=1 sed cd sed printf
+		x=1 "$@" "$1" sed $(pwd) ${HOME} done done echo
+		export awk 'quoted text' ${HOME}
+	x=1 test echo cd | grep local x=1 then "$1" "$@" | sed readonly
+		local -eu $(pwd) echo 'quoted text' /usr/bin
+		echo x=1 "$@" grep grep
+"$@" readonly "$1" echo
+		sed local sed "$@" "$@" "$@" awk
+	cd x=1 x=1 x=1 readonly readonly printf printf ${HOME} local
+'quoted text' 'quoted text'
+		local ${HOME} then cd local 2>/dev/null export "$@" export "$@" export
+	"$@" | sed sed test printf export "$1" echo done
+x=1 export cd awk echo local
+"$@" sed -eu export x=1 && readonly x=1 2>/dev/null cd "$@" done /usr/bin
+		"$@" export --verbose printf sed
+--verbose sed awk readonly test readonly
+	/usr/bin grep cd 'quoted text' test -eu $(pwd) 2>/dev/null
+x=1 test test ${HOME} then done ${HOME} grep "$@" local echo /usr/bin cd echo
+		-eu -eu ${HOME} awk awk local "$@" readonly sed "$@"
+	&& $(pwd) echo && -eu -eu
+| sed awk readonly cd ${HOME} test
+"$1" | awk done && cd export grep x=1 ${HOME} -eu grep "$1" export x=1 grep
+cd /usr/bin echo cd echo done "$@" 'quoted text' readonly /usr/bin cd done
+export --verbose awk export printf readonly
+cd $(pwd) echo | echo export 'quoted text' done sed awk && done export 'quoted text'
+then /usr/bin 2>/dev/null
+	x=1 'quoted text' printf export
+	--verbose $(pwd) && x=1 echo printf "$1"
+printf readonly readonly $(pwd) readonly echo -eu cd ${HOME} x=1 cd && grep ${HOME}
+sed "$@" "$1" "$@" sed local
+	"$1" local -eu printf done echo then echo grep "$@" echo
+		"$1" export && sed readonly --verbose printf "$1" "$@" sed
+		readonly 2>/dev/null "$1" -eu done readonly $(pwd) sed grep
+	'quoted text' 'quoted text' awk grep ${HOME} printf -eu "$1"
+	cd 2>/dev/null local "$1" echo ${HOME} sed ${HOME} printf then test export --verbose
+	cd $(pwd) printf && local
+		awk cd done grep then local sed /usr/bin ${HOME} "$1" 'quoted text'
+readonly "$@" "$@" local x=1 grep readonly export readonly
+	/usr/bin sed 2>/dev/null 2>/dev/null 'quoted text' /usr/bin "$@" "$1" sed
+done "$@" test cd readonly local
+	echo local /usr/bin /usr/bin readonly awk then
+	echo && awk -eu --verbose local -eu $(pwd) --verbose &&
+| test /usr/bin /usr/bin "$1" x=1 $(pwd) $(pwd) && readonly export
+	readonly ${HOME} /usr/bin grep cd 2>/dev/null cd then "$@" "$1" grep
+	&& "$1" done "$1" && test
+		--verbose ${HOME} "$@" done 2>/dev/null -eu readonly grep
+test && -eu readonly readonly echo
+-eu sed "$1" test awk readonly "$@" then test cd readonly | $(pwd) export
+	grep "$@" -eu "$1" export done --verbose local sed /usr/bin /usr/bin printf
+grep test cd export export | test | readonly then grep then done 'quoted text'
+readonly | printf readonly | -eu readonly && export
+	--verbose echo x=1 echo
+x=1 ${HOME} $(pwd) 2>/dev/null local test local echo "$1" local export
+	--verbose grep test -eu ${HOME} then "$@" done printf ${HOME} then && sed $(pwd)
+	grep done "$@" local readonly $(pwd)
+		"$1" ${HOME} export printf --verbose x=1 x=1
+x=1 "$@" "$@" done done $(pwd) 2>/dev/null local
+2>/dev/null /usr/bin /usr/bin
+x=1 --verbose | echo 'quoted text'
+	then "$@" awk printf local grep "$1" | test "$1" echo done
+		cd export grep test | "$@" cd ${HOME} 'quoted text'
+	--verbose awk /usr/bin 2>/dev/null ${HOME} sed "$1" -eu cd local 2>/dev/null
+-eu && grep --verbose readonly
+&& printf /usr/bin echo test --verbose grep | --verbose $(pwd) -eu then ${HOME}
+	${HOME} x=1 | done | done && readonly &&
+		x=1 export cd then 2>/dev/null readonly -eu x=1 | x=1 $(pwd) -eu
+	&& printf ${HOME} readonly
+		| awk 2>/dev/null -eu readonly --verbose awk | /usr/bin | /usr/bin local test
+		sed /usr/bin /usr/bin printf grep export printf ${HOME} sed "$1" done
+-eu && printf cd | "$@" --verbose printf $(pwd) x=1 --verbose awk test
+| echo ${HOME} readonly readonly cd "$1" readonly local then
+		grep ${HOME} printf ${HOME}
+	done ${HOME} 'quoted text' export done
+	| "$@" local cd && --verbose
+echo | ${HOME} "$@" -eu $(pwd) && 'quoted text' then grep echo 2>/dev/null then
+cd --verbose readonly $(pwd) $(pwd) "$1" "$@" | sed -eu printf awk /usr/bin export
+		"$@" printf $(pwd) local | "$1" $(pwd) local printf
+	/usr/bin --verbose then
+	echo printf export then ${HOME}
+		printf test /usr/bin printf awk sed /usr/bin && -eu
+awk readonly test /usr/bin
+/usr/bin printf export printf export grep "$1" 2>/dev/null
+		"$1" $(pwd) export $(pwd) readonly "$@" readonly echo awk "$1" -eu
+sed "$1" 2>/dev/null readonly /usr/bin ${HOME}
+	'quoted text' $(pwd) local grep export x=1 echo "$@" then --verbose
+		awk printf -eu echo 2>/dev/null
+	sed "$@" "$@" 'quoted text' x=1 test then done x=1 --verbose printf readonly
+		grep awk done $(pwd) /usr/bin then then 'quoted text'
+readonly $(pwd) awk sed echo echo ${HOME}
+		then awk /usr/bin ${HOME} readonly "$1" test echo awk cd $(pwd)
+		test "$1" ${HOME} test local
+done grep grep "$1" 2>/dev/null --verbose | "$@" && sed "$@"
+	2>/dev/null "$@" sed done test sed --verbose $(pwd) done test then
+readonly done -eu local
+then test "$@" sed 'quoted text' $(pwd) cd 'quoted text' "$@"
+	readonly printf | "$@" echo printf
+		2>/dev/null x=1 printf test cd ${HOME}
+	$(pwd) then then export 'quoted text' $(pwd) grep
+done "$1" && "$@" 2>/dev/null -eu readonly readonly grep
+	test cd | cd printf -eu
+	test test $(pwd) echo cd --verbose
+	"$1" $(pwd) done sed 2>/dev/null test ${HOME} printf /usr/bin
+then cd sed then ${HOME} "$1" --verbose
+'quoted text' 'quoted text' cd
+		test 2>/dev/null done done sed /usr/bin then --verbose --verbose
+	2>/dev/null --verbose | local export x=1 printf | && readonly
+/usr/bin then 'quoted text' test && && readonly 'quoted text'
+cd --verbose cd 'quoted text' local sed ${HOME} echo x=1 cd && export
+		$(pwd) "$1" export "$@" then
+x=1 | readonly $(pwd) "$1" export -eu done done --verbose export
+		then then export done "$@" 2>/dev/null echo sed readonly local $(pwd) x=1
+		echo --verbose sed test --verbose grep done --verbose done 2>/dev/null
+$(pwd) readonly $(pwd) echo 'quoted text'
+	"$1" local && 2>/dev/null sed test
+'quoted text' readonly /usr/bin
+&& && -eu /usr/bin 2>/dev/null cd grep done "$1"
+	grep echo then "$@" grep awk export
+	sed | "$@" export then test /usr/bin readonly 2>/dev/null ${HOME}
+	$(pwd) /usr/bin /usr/bin local x=1 readonly awk 'quoted text' export echo "$@"
+		--verbose --verbose x=1 "$@" x=1 | sed readonly sed | 'quoted text' -eu
+	/usr/bin -eu printf done cd 2>/dev/null "$@" awk "$1"
+awk --verbose /usr/bin test grep grep done printf /usr/bin 'quoted text'
+	&& --verbose /usr/bin done 2>/dev/null export test | readonly
+awk /usr/bin "$@" && then cd x=1 test $(pwd) "$@" x=1 /usr/bin
+	$(pwd) ${HOME} 'quoted text' local cd grep ${HOME} export 2>/dev/null
+		x=1 done ${HOME} -eu readonly "$1" | cd -eu done echo
+	export -eu then -eu printf "$@"
+awk x=1 --verbose && 2>/dev/null /usr/bin "$@" sed sed $(pwd)
+	readonly ${HOME} then |
+	"$1" local 2>/dev/null -eu echo readonly then ${HOME} "$@"
+	sed readonly && ${HOME} sed && grep --verbose
+done local then ${HOME} test /usr/bin done local echo /usr/bin
+	export /usr/bin ${HOME} 'quoted text' awk sed x=1 $(pwd) -eu $(pwd) -eu --verbose
+'quoted text' test | 'quoted text' --verbose
+		cd --verbose echo test test cd readonly --verbose 'quoted text'
+| export x=1 test test cd grep grep -eu 2>/dev/null ${HOME} grep local ${HOME}
+| 2>/dev/null sed echo "$@" sed $(pwd) && sed --verbose
+		$(pwd) grep grep ${HOME} --verbose "$1" export test awk readonly cd echo
+		"$1" awk $(pwd) $(pwd) -eu x=1 x=1 --verbose awk cd grep test $(pwd) awk then
+readonly then grep --verbose local -eu then printf
+sed --verbose /usr/bin -eu $(pwd) 2>/dev/null then 'quoted text'
+local 'quoted text' readonly | printf
+	then test local -eu x=1
+		readonly --verbose && local
+	| && | export -eu | "$@" --verbose sed && export echo
+	printf echo export local
+-eu echo cd done ${HOME} grep $(pwd) export /usr/bin "$@" /usr/bin
+echo sed sed printf 'quoted text' then ${HOME} awk $(pwd) "$1" && local cd
+		cd grep test then cd "$@" printf local 2>/dev/null
+		| "$1" 2>/dev/null | printf readonly "$1" done
+		readonly cd printf | awk export grep && $(pwd) --verbose echo awk 2>/dev/null
+		awk done sed test | --verbose $(pwd)
+	-eu $(pwd) ${HOME} then --verbose echo cd /usr/bin
+		/usr/bin x=1 then /usr/bin 'quoted text'
+cd x=1 -eu | done "$@" local 'quoted text'
+	'quoted text' then /usr/bin test echo test grep "$@" then echo
+awk local $(pwd) grep cd then "$@" | ${HOME} test ${HOME} /usr/bin printf
+	2>/dev/null cd ${HOME} 2>/dev/null "$@" 'quoted text'
+		$(pwd) then echo grep $(pwd) -eu ${HOME} /usr/bin
+		local | "$1" $(pwd) cd $(pwd) ${HOME} grep
+	done "$1" "$@" && && test -eu cd "$@" "$1" awk
+		| then done --verbose sed grep echo --verbose "$1" echo 'quoted text'
+	grep test done 'quoted text' && --verbose
+cd -eu local x=1 done local echo export "$@" | x=1 awk readonly
+	'quoted text' echo $(pwd) $(pwd) x=1 /usr/bin /usr/bin grep awk
+	local 'quoted text' local printf echo 'quoted text' readonly done export 2>/dev/null
+test awk --verbose "$@" | "$@" --verbose
+echo && test x=1 x=1 $(pwd) awk | | -eu -eu
+cd awk local x=1 -eu --verbose | /usr/bin
+		export then test readonly $(pwd) -eu local cd "$@" readonly | 'quoted text'
+/usr/bin then then && -eu local 'quoted text'
+	2>/dev/null "$@" done && sed then export
+x=1 then 2>/dev/null done ${HOME} /usr/bin awk done done test echo
+		'quoted text' "$@" then "$1" test cd awk x=1
+	| test /usr/bin awk $(pwd) $(pwd)
+		test ${HOME} --verbose | sed && 'quoted text'
+		echo /usr/bin done && local printf ${HOME} printf
+'quoted text' --verbose awk && -eu "$1" "$1" then 'quoted text' sed
+		printf x=1 grep ${HOME} local sed $(pwd) && awk done -eu /usr/bin
+x=1 printf echo x=1 grep | grep
+	then --verbose export 'quoted text'
+&& printf && x=1 test local "$1" sed --verbose echo grep /usr/bin &&
+	'quoted text' local export /usr/bin -eu grep test $(pwd) test x=1
+readonly cd test then grep printf grep $(pwd)
+	echo cd then "$1" x=1 --verbose "$@" readonly export done 2>/dev/null -eu &&
+test | sed cd $(pwd) local | && x=1 grep sed | readonly 'quoted text' 'quoted text'
+	"$1" cd export /usr/bin 'quoted text' cd
+		'quoted text' x=1 echo 2>/dev/null sed export test
+${HOME} "$@" sed export echo local awk done --verbose
+		/usr/bin then sed "$@" then then x=1 2>/dev/null readonly done | then export
+	2>/dev/null then -eu readonly "$@" 2>/dev/null sed $(pwd) &&
+awk "$1" test | grep "$1" readonly grep "$@" then 'quoted text'
+		export sed sed $(pwd) done "$1" x=1 -eu "$1" echo | $(pwd) printf $(pwd)
+		"$@" $(pwd) ${HOME} "$@"
+export then printf -eu x=1 | printf $(pwd) ${HOME}
+		local "$1" done 2>/dev/null 2>/dev/null echo cd test echo then export "$1" echo
+grep /usr/bin 'quoted text' printf
+		cd local "$1" local sed then done
+	local test echo x=1 $(pwd) then $(pwd) "$@" x=1 --verbose echo
+/usr/bin export test local ${HOME} local cd ${HOME}
+| test sed | --verbose --verbose cd grep /usr/bin
+		--verbose x=1 2>/dev/null local sed echo export 'quoted text'
+	${HOME} --verbose ${HOME} export $(pwd)
+		done awk then local printf --verbose
+-eu | "$@" cd grep cd
+		"$1" test sed sed cd readonly readonly && sed
+	2>/dev/null x=1 'quoted text' grep -eu ${HOME} /usr/bin
+	grep /usr/bin readonly
+		"$@" "$1" && --verbose sed ${HOME} $(pwd) 'quoted text'
+	'quoted text' $(pwd) x=1 cd grep done cd "$1"
+	test then then "$1" -eu awk printf "$1"
+		then test local 'quoted text' then $(pwd) "$@" sed export | "$1" test test "$@"
+2>/dev/null $(pwd) printf test
+		printf awk 2>/dev/null test ${HOME} done "$@" readonly 2>/dev/null
+&& sed 2>/dev/null ${HOME} grep
+	-eu "$@" 'quoted text' $(pwd) done
+--verbose readonly then | echo echo test cd local readonly test 'quoted text'
+	awk grep $(pwd) done -eu printf /usr/bin x=1 | x=1 done test --verbose
+	awk then test ${HOME}
+${HOME} grep x=1 readonly done && readonly 2>/dev/null readonly "$1" readonly
+	local local grep done && echo done local then echo
+	-eu printf export awk cd readonly -eu /usr/bin local ${HOME} cd grep && then echo
+-eu --verbose printf export done then
+		--verbose grep --verbose export done 2>/dev/null -eu
+	'quoted text' -eu -eu | x=1
+	/usr/bin done cd local local &&
+	readonly ${HOME} then && 2>/dev/null -eu ${HOME} done test &&
+		cd 2>/dev/null test local grep export x=1 /usr/bin cd then /usr/bin /usr/bin grep
+	local done x=1 then && printf ${HOME} sed
+	readonly done | --verbose 'quoted text' test sed
+x=1 echo awk cd /usr/bin awk local export -eu awk --verbose &&
+	| cd test --verbose "$1"
+	echo done x=1 grep cd "$1" /usr/bin readonly -eu
+test -eu printf grep $(pwd) "$@" $(pwd) 2>/dev/null readonly cd test
+		'quoted text' && "$@" cd -eu cd x=1 x=1 'quoted text'
+then 2>/dev/null echo "$1" local && done x=1 --verbose awk done
+then test $(pwd) done $(pwd) 'quoted text' grep | then --verbose --verbose
+	export sed local && 'quoted text' local
+		-eu export "$@" && 'quoted text' 'quoted text' local cd 2>/dev/null "$@"
+		then sed -eu printf 'quoted text' x=1 2>/dev/null
+	2>/dev/null done done "$@" -eu 2>/dev/null "$1" awk && && done
+	readonly --verbose test readonly "$1" /usr/bin "$@" echo x=1 --verbose grep
+then "$@" | x=1 -eu export echo --verbose done ${HOME} echo
+x=1 awk test 2>/dev/null readonly
+	echo local | x=1 grep | echo
+		printf "$1" cd local sed ${HOME}
+cd $(pwd) test x=1 then local then done --verbose then export 'quoted text'
+${HOME} grep $(pwd) awk grep "$@" | grep
+'quoted text' $(pwd) sed then
+-eu echo sed export grep awk test cd --verbose then awk
+	"$1" 'quoted text' ${HOME} cd readonly x=1 x=1
+		"$@" && --verbose -eu && ${HOME} --verbose readonly cd && cd $(pwd) $(pwd) local
+		awk $(pwd) $(pwd) done echo sed x=1 local --verbose
+	$(pwd) export printf /usr/bin printf grep 'quoted text'
+		/usr/bin --verbose echo && /usr/bin awk awk awk then
+		grep done echo ${HOME} $(pwd) grep && awk
+		--verbose echo && export --verbose test test done awk --verbose
+| test local printf cd 2>/dev/null echo cd printf done "$@"
+&& sed 'quoted text' ${HOME} then ${HOME} | -eu then --verbose awk "$@" $(pwd)
+awk test test x=1 $(pwd)
+		--verbose x=1 grep /usr/bin | "$1"
+done | | && printf cd | grep 'quoted text'
+	"$1" /usr/bin "$@" cd test --verbose cd awk
+		then printf export test /usr/bin printf test 2>/dev/null
+'quoted text' | readonly grep awk $(pwd) "$@" sed
+		&& cd "$@" ${HOME} local --verbose local 2>/dev/null 'quoted text'
+	cd -eu local sed 2>/dev/null echo cd export -eu sed readonly
+	printf x=1 x=1 printf printf
+	&& "$1" echo local 'quoted text'
+	$(pwd) export ${HOME} "$1" /usr/bin readonly
+export 2>/dev/null echo $(pwd) ${HOME} "$@" sed done -eu 'quoted text' export
+		grep "$@" done readonly echo done $(pwd) echo printf
+	cd export printf done
+/usr/bin cd $(pwd) | | test $(pwd) ${HOME} done &&
+readonly $(pwd) 'quoted text' | sed grep awk echo
+awk awk printf then /usr/bin -eu done
+$(pwd) export 2>/dev/null
+export awk 'quoted text' done "$1" readonly export cd "$1"
+	local && -eu cd grep ${HOME} test 2>/dev/null -eu
+		2>/dev/null 2>/dev/null --verbose "$1" awk 2>/dev/null
+		done cd echo /usr/bin "$@" sed echo echo | 'quoted text'
+	then export 2>/dev/null
+		export --verbose | printf $(pwd) ${HOME} ${HOME} then echo
+		2>/dev/null done x=1 printf readonly
+	readonly cd echo export $(pwd) export readonly ${HOME} "$@" sed x=1 local cd --verbose
+		echo sed awk --verbose then && awk && 2>/dev/null grep cd done local
+test export echo test grep | ${HOME} grep sed export then cd test echo "$@" -eu
+		"$@" printf done /usr/bin 2>/dev/null && 2>/dev/null
+		2>/dev/null local | local | printf grep done /usr/bin awk $(pwd) -eu "$@"
+	awk then readonly "$1" && ${HOME} &&
+		echo 'quoted text' 'quoted text' "$@" then $(pwd) local ${HOME} readonly
+then then local --verbose readonly /usr/bin 2>/dev/null 2>/dev/null
+	test then awk ${HOME} --verbose 'quoted text' done done local x=1
+awk printf "$1" "$@" ${HOME} $(pwd) /usr/bin ${HOME}
+		local echo x=1 test grep x=1 printf 'quoted text'
+	local x=1 --verbose readonly done awk test then local -eu ${HOME} /usr/bin
+&& cd export local cd "$1" sed local --verbose
+| printf awk ${HOME} "$@" $(pwd) awk local sed
+	x=1 "$@" -eu 'quoted text' ${HOME} "$@" printf
+	export then echo export awk local echo awk /usr/bin
+		${HOME} echo test ${HOME} "$@" then -eu export x=1 && |
+x=1 readonly -eu && 2>/dev/null sed --verbose x=1 then awk
+		x=1 $(pwd) test "$1" grep --verbose $(pwd) --verbose readonly
+		readonly && | test cd then ${HOME} done then grep 'quoted text'
+		| && grep 'quoted text' -eu
+		--verbose test -eu $(pwd) 'quoted text' "$@" sed readonly
+		2>/dev/null export && "$1" printf done x=1 ${HOME} cd /usr/bin
+		printf test printf "$@" awk /usr/bin "$@" 2>/dev/null printf
+	| "$1" test "$@" export local
+		/usr/bin readonly | /usr/bin $(pwd) sed export | export
+		-eu x=1 ${HOME} local grep awk readonly export export
+done printf readonly awk 'quoted text' /usr/bin | awk
+	grep readonly 2>/dev/null awk test done -eu grep cd && then x=1 cd 'quoted text'
+$(pwd) x=1 readonly /usr/bin 2>/dev/null -eu export && done export awk grep awk
+	${HOME} done -eu --verbose awk ${HOME} printf
+	grep grep -eu 2>/dev/null x=1 readonly && -eu
+		${HOME} "$1" -eu ${HOME} awk cd printf && | export
+${HOME} "$1" then --verbose readonly
+	-eu $(pwd) sed /usr/bin
+2>/dev/null grep -eu x=1 cd --verbose --verbose test
+'quoted text' "$@" "$@" x=1 test | then | /usr/bin
+| readonly 2>/dev/null local done printf grep ${HOME} then ${HOME} grep
+cd /usr/bin /usr/bin ${HOME} /usr/bin 2>/dev/null
+${HOME} sed sed x=1 grep -eu ${HOME} -eu awk echo
+		export | test then printf 'quoted text' done local 2>/dev/null x=1
+	2>/dev/null | 2>/dev/null -eu ${HOME} &&
+test -eu "$1" --verbose
+		$(pwd) local sed x=1 grep test x=1 test export
+export $(pwd) test awk test && printf cd cd export "$@" printf then 2>/dev/null
+		echo awk 2>/dev/null cd x=1 --verbose test $(pwd) then local $(pwd)
+printf printf then done sed 2>/dev/null echo done
+&& | | 2>/dev/null echo $(pwd) then -eu 'quoted text' test local done x=1
+		printf ${HOME} "$@" -eu local && $(pwd) awk ${HOME}
+		then cd grep 'quoted text'
+readonly -eu sed done "$@" readonly x=1 grep echo cd "$1" printf
+	"$1" grep x=1 x=1 && -eu local local "$@" done echo
+	--verbose sed | --verbose /usr/bin then /usr/bin
+	awk cd cd 'quoted text' x=1 "$1" && 'quoted text' -eu awk --verbose
+	echo printf $(pwd) awk done echo printf grep
+awk then ${HOME} x=1 'quoted text'
+	readonly sed /usr/bin --verbose sed sed done grep 2>/dev/null test local local
+	awk -eu sed && x=1 $(pwd) && /usr/bin
+	&& local grep "$1" then && cd 2>/dev/null
+		"$1" readonly ${HOME} /usr/bin
+	printf local -eu sed ${HOME} "$@" -eu -eu "$1" test | cd &&
+then && awk done $(pwd) /usr/bin readonly readonly 2>/dev/null
+	/usr/bin | ${HOME} awk readonly x=1 printf readonly
+	"$@" x=1 sed export | readonly && --verbose awk cd awk
+		2>/dev/null ${HOME} local 'quoted text' --verbose /usr/bin 2>/dev/null
+	'quoted text' 'quoted text' --verbose x=1 export && local /usr/bin test done
+	cd 2>/dev/null done $(pwd) -eu /usr/bin
+echo printf x=1 && x=1 grep
+cd && printf && -eu -eu "$1" && awk 2>/dev/null test && ${HOME}
+		local $(pwd) sed "$1" x=1 "$1" cd "$1" then printf readonly local && awk $(pwd)
+		"$@" /usr/bin && done then grep sed local --verbose $(pwd) /usr/bin
+		2>/dev/null -eu 2>/dev/null grep grep
+		"$1" /usr/bin "$@" printf readonly sed x=1 grep
+done "$@" x=1 $(pwd) "$@" test | $(pwd) ${HOME} -eu cd then 2>/dev/null
+		export 2>/dev/null 'quoted text'
+	"$@" printf sed grep printf sed awk ${HOME} local readonly | echo local "$1"
+readonly printf 'quoted text' $(pwd) awk 2>/dev/null ${HOME} && awk
+2>/dev/null readonly readonly
+		done cd --verbose local ${HOME} x=1 done local 2>/dev/null local then printf
+	| | sed | 'quoted text' export awk sed | -eu -eu | 2>/dev/null cd readonly echo
+		grep x=1 echo $(pwd) test local "$1" "$1" echo --verbose 'quoted text'
+		x=1 awk --verbose test done local echo
+		awk "$1" printf readonly -eu
+	2>/dev/null 2>/dev/null done x=1 ${HOME} sed "$@" sed then
+	"$@" --verbose "$1" | /usr/bin
+		-eu x=1 --verbose then awk local x=1 then --verbose done 2>/dev/null
+x=1 then echo echo export readonly test then grep export -eu
+		grep printf "$@" $(pwd) 2>/dev/null cd 'quoted text'
+		awk 2>/dev/null printf then awk x=1 && test export sed $(pwd) echo "$@" cd test
+	"$@" "$@" echo 2>/dev/null then ${HOME} --verbose
+		test "$1" readonly echo export readonly local /usr/bin $(pwd) "$@" readonly
+sed $(pwd) awk done 'quoted text' && export $(pwd) | local readonly --verbose
+	${HOME} grep 'quoted text' awk -eu export ${HOME} echo 'quoted text' /usr/bin
+		'quoted text' cd sed then local sed sed $(pwd) && grep 2>/dev/null
+| $(pwd) | x=1 -eu --verbose --verbose local printf /usr/bin sed "$@"
+$(pwd) /usr/bin local printf /usr/bin readonly
+		done "$@" test echo export echo echo /usr/bin
+		"$@" /usr/bin -eu 2>/dev/null ${HOME} "$@" $(pwd)
+		awk done echo "$1" cd export sed 'quoted text' && cd export "$@"
+	done test grep printf printf done grep printf done sed $(pwd) local /usr/bin
+-eu --verbose sed 'quoted text' awk echo "$@" printf sed sed
+	"$1" 'quoted text' $(pwd) --verbose
+		--verbose done /usr/bin then 2>/dev/null 2>/dev/null done x=1 'quoted text'
+readonly "$@" | done then x=1 grep "$1" $(pwd)
+cd cd 'quoted text' --verbose --verbose "$1" -eu then && ${HOME} /usr/bin sed
+&& export 'quoted text' -eu $(pwd) readonly export 'quoted text'
+		"$1" local "$1" "$@" done 'quoted text' --verbose "$1" 'quoted text'
+		done export "$@" /usr/bin && "$@" done awk grep $(pwd)
+	$(pwd) done 2>/dev/null --verbose
+		echo x=1 echo /usr/bin done then readonly grep
+		printf "$1" export && ${HOME}
+	readonly sed 'quoted text' $(pwd) $(pwd) echo "$@" local x=1
+test && printf echo /usr/bin done 2>/dev/null $(pwd)
+	test cd /usr/bin "$1" |
+		cd export test "$@" awk | ${HOME} "$1" "$1"
+	export /usr/bin "$1" then /usr/bin
+	| /usr/bin x=1 /usr/bin && "$1" x=1 sed then cd readonly -eu grep
+	/usr/bin && then x=1 /usr/bin x=1 echo /usr/bin done local then --verbose
+		export awk && "$1" cd cd readonly done cd | export "$1" x=1 local
+	| /usr/bin test sed grep awk
+		"$1" done --verbose /usr/bin "$1" x=1
+	printf ${HOME} awk $(pwd) cd "$@" sed | x=1 awk printf
+	x=1 printf awk local done 2>/dev/null printf awk then 2>/dev/null printf
+	| /usr/bin && | sed then ${HOME} readonly
+$(pwd) -eu local 'quoted text' readonly && awk awk then $(pwd)
+	'quoted text' x=1 test then "$@" local test then $(pwd) test printf && "$@"
+	local x=1 local printf "$@" export --verbose x=1 printf 2>/dev/null
+	done "$1" --verbose "$@" test "$1" readonly $(pwd) done
+	echo done sed grep then cd local 'quoted text'
+	2>/dev/null x=1 2>/dev/null echo x=1 && awk 2>/dev/null
+x=1 /usr/bin grep --verbose && test grep awk
+x=1 /usr/bin $(pwd) awk done | printf
+	then | --verbose x=1 "$@" sed cd ${HOME} x=1 echo echo 'quoted text' 2>/dev/null
+x=1 "$1" sed grep then sed
+	$(pwd) "$@" export /usr/bin 'quoted text' awk /usr/bin $(pwd) printf "$@"
+printf grep grep $(pwd) "$1" "$@" done | then --verbose "$1" 2>/dev/null readonly
+	test | -eu -eu -eu grep x=1 readonly awk readonly -eu grep 2>/dev/null sed echo
+	| ${HOME} $(pwd) awk 'quoted text' /usr/bin x=1 done $(pwd)
+	local $(pwd) done --verbose echo local x=1 x=1 2>/dev/null
+local x=1 --verbose $(pwd) local
+		-eu export awk export ${HOME} printf cd sed "$@" then 2>/dev/null
+	2>/dev/null grep $(pwd) x=1
+awk cd echo 'quoted text' x=1 sed 'quoted text'
+grep awk "$1" 'quoted text' x=1 then cd local
+	printf sed ${HOME} then awk readonly
+local | awk export done
+echo printf /usr/bin $(pwd) cd /usr/bin && readonly cd printf
+		export 'quoted text' | echo awk $(pwd) local --verbose then && 'quoted text' /usr/bin
+grep printf /usr/bin readonly x=1 'quoted text' then && export && printf
+&& done echo && test && grep $(pwd)
+		export export printf awk sed test then && && grep x=1 local
+	test printf && printf then printf && 'quoted text' then export "$@"
+"$1" done grep /usr/bin echo then ${HOME} echo export | echo "$@"
+test --verbose | 'quoted text' | -eu test cd local cd grep -eu
+	"$@" "$1" local printf 2>/dev/null local sed awk test x=1 echo
+${HOME} $(pwd) local "$@" printf | 'quoted text' 2>/dev/null export cd | ${HOME}
+readonly "$1" "$@" | done /usr/bin
+	/usr/bin echo "$1" cd test grep
+	sed --verbose printf && local 2>/dev/null 2>/dev/null
+		x=1 local local "$@" -eu "$@" 2>/dev/null awk cd | ${HOME} 'quoted text' "$1"
+	printf done 'quoted text' --verbose sed echo local ${HOME} ${HOME}
+		echo awk done "$1" done -eu --verbose then 'quoted text' export -eu awk
+	done && && $(pwd) awk
+	/usr/bin sed 'quoted text' cd /usr/bin
+/usr/bin x=1 grep $(pwd) ${HOME} printf awk && echo x=1 grep | awk
+		'quoted text' 2>/dev/null then && --verbose export -eu "$@" "$@" grep local
+/usr/bin $(pwd) -eu && grep | echo then done $(pwd) ${HOME} sed /usr/bin
+	/usr/bin x=1 'quoted text' -eu /usr/bin awk local then 'quoted text'
+grep x=1 /usr/bin 'quoted text' echo
+	test | local readonly --verbose export "$1" readonly | awk done
+		awk x=1 local && x=1 local $(pwd) x=1 local 2>/dev/null then printf ${HOME}
+	"$1" x=1 cd test --verbose cd printf then sed printf export test
+		printf --verbose $(pwd) cd "$1" "$@" "$@"
+&& readonly "$@" cd x=1 x=1 -eu awk echo
+	2>/dev/null echo cd 'quoted text' printf grep
+	sed "$1" 2>/dev/null readonly
+local | printf then awk local printf ${HOME}
+"$1" sed --verbose -eu done ${HOME} "$@" local 'quoted text' | "$1" awk -eu --verbose
+		2>/dev/null x=1 | && awk then echo sed then 2>/dev/null
+| --verbose readonly ${HOME} 'quoted text' awk echo && && then /usr/bin
+	2>/dev/null /usr/bin echo --verbose ${HOME} local cd then x=1 'quoted text'
+sed local sed 'quoted text' && "$1" done
+/usr/bin sed sed local done --verbose "$1" "$@" | -eu --verbose local 2>/dev/null
+	-eu "$1" -eu test /usr/bin --verbose export
+		"$1" 'quoted text' --verbose
+	awk x=1 $(pwd) local $(pwd) 2>/dev/null printf done echo echo
+"$1" -eu printf $(pwd) ${HOME} && "$@" /usr/bin test | sed "$1" cd /usr/bin cd
+		export /usr/bin --verbose test ${HOME} sed test && cd $(pwd) printf
+		cd $(pwd) /usr/bin $(pwd) "$1" sed && x=1
+	then then sed printf done then x=1 "$@" -eu cd awk grep
+export echo readonly then awk ${HOME} readonly "$@" sed
+	x=1 awk x=1 done | grep local
+		"$1" then grep ${HOME} 'quoted text'
+test x=1 /usr/bin sed cd sed export ${HOME} x=1 --verbose
+		awk cd 'quoted text' sed --verbose -eu | echo then --verbose echo && ${HOME} -eu
+	local -eu local export done test printf "$1"
+		local ${HOME} "$1" done 2>/dev/null
+done "$1" --verbose | "$@" printf --verbose
+	done "$@" "$1" cd | $(pwd) 'quoted text' grep echo cd ${HOME} printf ${HOME}
+	then ${HOME} 'quoted text' 2>/dev/null grep "$@" printf "$@" "$@"
+	then 'quoted text' -eu x=1 sed &&
+	local then test "$@" /usr/bin cd done /usr/bin --verbose && echo awk then
+	--verbose readonly grep test --verbose readonly
+		--verbose cd -eu --verbose
+	"$1" "$1" cd && then $(pwd) "$1" /usr/bin
+$(pwd) test echo x=1 /usr/bin --verbose | cd then
+	'quoted text' 2>/dev/null "$@" sed local x=1 sed awk ${HOME}
+		sed sed done $(pwd) export grep /usr/bin /usr/bin
+	"$1" sed done cd sed grep 2>/dev/null $(pwd) --verbose then readonly
+export export && then grep readonly grep echo $(pwd) x=1 /usr/bin
+readonly --verbose local x=1 && echo readonly "$@" "$1" readonly done 'quoted text'
+	readonly readonly cd | --verbose export sed "$1" cd printf $(pwd)
+		sed /usr/bin readonly --verbose sed --verbose -eu awk readonly
+	--verbose then echo --verbose 2>/dev/null x=1
+	sed 'quoted text' $(pwd) sed --verbose
+--verbose "$1" export sed echo | "$@" /usr/bin
+	export "$@" done -eu grep printf ${HOME} grep
+		'quoted text' awk --verbose printf then printf -eu x=1 $(pwd)
+		x=1 /usr/bin "$1" then test
+		test 'quoted text' && | $(pwd)
+		x=1 then ${HOME} 'quoted text' -eu local "$@"
+	$(pwd) $(pwd) ${HOME} readonly --verbose
+2>/dev/null then && "$1"
+		sed 2>/dev/null && local grep /usr/bin | -eu -eu sed test test 'quoted text'
+	--verbose $(pwd) x=1 then && test
+		cd --verbose $(pwd) awk echo | sed done 2>/dev/null
+cd /usr/bin -eu echo test
+"$@" echo && /usr/bin ${HOME} test --verbose | -eu cd printf test printf --verbose
+	cd $(pwd) $(pwd) done 2>/dev/null sed done echo ${HOME} x=1 done -eu grep
+readonly grep /usr/bin printf --verbose readonly echo 'quoted text' "$1"
+		"$1" ${HOME} then readonly 2>/dev/null readonly x=1 done
+		then x=1 2>/dev/null awk --verbose grep export awk test | --verbose
+		awk $(pwd) printf sed cd sed sed export grep "$1" 'quoted text' done awk x=1 cd
+printf 'quoted text' && /usr/bin
+	sed -eu "$@" printf test awk
+	printf 2>/dev/null done cd --verbose x=1 printf ${HOME} export
+		${HOME} "$1" test | | readonly
+		"$@" -eu -eu 2>/dev/null "$1" /usr/bin | then printf 2>/dev/null sed ${HOME} 'quoted text'
+printf printf then awk /usr/bin "$1" $(pwd) "$1" cd /usr/bin /usr/bin
+readonly export local ${HOME} readonly sed x=1 'quoted text'
+--verbose sed then export && x=1 "$1" 2>/dev/null "$1" then
+2>/dev/null ${HOME} grep
+awk | test $(pwd) ${HOME}
+2>/dev/null done "$@" --verbose
+	--verbose 2>/dev/null --verbose -eu 2>/dev/null 'quoted text' done
+		"$1" cd /usr/bin then
+| echo 2>/dev/null | local --verbose sed
+		| test awk sed x=1 'quoted text'
+	echo export "$@" "$1" cd ${HOME} -eu readonly
+echo test ${HOME} -eu "$1" echo --verbose sed awk "$@" done x=1
+	${HOME} done -eu local then "$@" done local --verbose ${HOME} sed "$@" cd
+x=1 sed cd /usr/bin | cd awk "$@" $(pwd) /usr/bin awk cd "$1" -eu
+-eu printf /usr/bin /usr/bin $(pwd)
+		| cd grep grep done then export awk done x=1 --verbose $(pwd) "$@" local -eu
+		/usr/bin | export -eu 'quoted text'
+	&& -eu test 'quoted text' ${HOME} $(pwd) ${HOME} x=1 "$@" | && -eu
+	printf echo | --verbose
+		${HOME} done "$@" awk echo cd
+		local -eu test x=1 --verbose "$@" --verbose
+awk echo export then readonly done readonly 2>/dev/null
+		grep test readonly "$1" ${HOME}
+	export | x=1 echo /usr/bin
+		&& sed cd && x=1 2>/dev/null
+	printf 2>/dev/null then && echo 2>/dev/null
+awk printf local grep readonly cd local --verbose
+	awk cd --verbose 2>/dev/null done readonly test grep "$@" $(pwd) ${HOME} /usr/bin
+	sed 'quoted text' local --verbose
+--verbose && $(pwd) readonly done printf 'quoted text' 2>/dev/null grep
+	$(pwd) local "$@" -eu grep then $(pwd) sed /usr/bin "$@" grep ${HOME}
+-eu local printf "$@" test && 2>/dev/null printf awk done local awk then cd &&
+cd test grep awk | then
+		grep printf /usr/bin test awk 'quoted text' x=1 && $(pwd) 'quoted text' local
+	grep then cd && cd && test cd export | 'quoted text' /usr/bin
+	'quoted text' awk export 2>/dev/null test done -eu -eu
+		${HOME} "$@" local 'quoted text' cd
+		then awk readonly 2>/dev/null
+"$@" cd 2>/dev/null | test export done test sed "$@" | cd echo
+	grep sed done && x=1 --verbose $(pwd) 'quoted text'
+		--verbose | 'quoted text' /usr/bin grep cd test 'quoted text'
+		--verbose --verbose printf
+		"$@" ${HOME} sed x=1 | test "$@"
+		'quoted text' -eu --verbose export export grep | export grep local
+	export test "$@" --verbose ${HOME} "$1" 'quoted text'
+		local ${HOME} local $(pwd) printf test cd export /usr/bin grep cd
+	--verbose cd readonly export --verbose readonly awk |
+	$(pwd) sed 2>/dev/null 'quoted text' sed local awk && /usr/bin readonly
+printf --verbose && && then printf &&
+		2>/dev/null x=1 test echo | done then "$@"
+2>/dev/null readonly grep
+| "$@" 'quoted text' && test
+	export /usr/bin x=1 then
+	"$1" 'quoted text' then cd 2>/dev/null --verbose local grep ${HOME} printf printf
+-eu grep awk $(pwd) "$@" "$1" x=1 grep done $(pwd)
+		local $(pwd) sed 'quoted text' --verbose "$@" export cd 'quoted text'
+		done --verbose sed local |
+		readonly local awk 'quoted text' -eu grep "$1" grep 2>/dev/null
+	readonly /usr/bin && ${HOME} then && && printf
+		2>/dev/null export test "$1" awk then grep
+	"$1" done sed export /usr/bin then /usr/bin printf
+awk x=1 ${HOME} 'quoted text' 'quoted text' local 'quoted text' ${HOME} then
+	done local grep done done "$1" local local x=1
+		--verbose export awk sed ${HOME} | export 2>/dev/null
+		2>/dev/null export --verbose ${HOME} printf -eu "$1" --verbose 'quoted text' "$@"
+	| test sed grep export x=1 export export echo x=1 -eu "$1"
+	x=1 | printf -eu -eu local && 'quoted text' -eu x=1 sed 'quoted text' "$1"
+/usr/bin x=1 ${HOME} x=1 done 2>/dev/null cd done | -eu
+		printf | ${HOME} 'quoted text' test done done sed readonly
+	| ${HOME} && && export "$@" export awk -eu test done echo then sed /usr/bin
+	readonly cd printf -eu "$1" $(pwd) "$1" "$1" test
+awk sed -eu ${HOME} sed ${HOME} printf grep "$@" test printf $(pwd) 2>/dev/null
+-eu echo export printf readonly then local sed done grep x=1 |
+		$(pwd) | && | readonly | "$1" -eu && 2>/dev/null
+then local /usr/bin echo sed local grep sed grep && -eu echo printf test
+awk 2>/dev/null printf export printf export grep 2>/dev/null
+		test test readonly local test grep && sed
+	$(pwd) readonly --verbose local printf printf then
+awk test "$@" | "$@" then readonly ${HOME} grep
+	--verbose 2>/dev/null printf cd cd 2>/dev/null "$1" grep "$1" "$@" -eu && test
+		&& local local export /usr/bin x=1 printf test readonly x=1 --verbose awk $(pwd)
+	/usr/bin readonly readonly awk then echo ${HOME}
+		2>/dev/null ${HOME} done grep cd | sed -eu "$@" -eu awk export /usr/bin 2>/dev/null
+	export done | ${HOME} 'quoted text'
+	echo ${HOME} export printf then 2>/dev/null then -eu echo
+	then | local readonly 2>/dev/null $(pwd) then
+then | x=1 cd cd echo test x=1 export done test 'quoted text'
+	then readonly 'quoted text' export test --verbose x=1 sed "$1" "$1" | && 'quoted text'
+	$(pwd) cd echo x=1 then -eu export local readonly export test |
+	echo 'quoted text' --verbose $(pwd) export export
+		'quoted text' /usr/bin local cd "$1" -eu ${HOME} cd "$1" ${HOME} then test
+	local --verbose cd export local sed then export awk done -eu cd
+echo && | && -eu awk 2>/dev/null "$1" done 'quoted text'
+	/usr/bin awk x=1 then grep 'quoted text' done awk echo cd &&
+	$(pwd) ${HOME} done ${HOME} then
+		2>/dev/null --verbose awk cd ${HOME} 2>/dev/null grep then echo cd $(pwd) test
+		"$@" "$1" local awk done test
+	echo 'quoted text' local then printf 2>/dev/null
+export sed then test -eu 'quoted text' readonly test cd | printf x=1
+	local | export /usr/bin ${HOME}
+		cd "$1" cd /usr/bin done $(pwd) grep ${HOME} && 2>/dev/null --verbose export
+		readonly 2>/dev/null 'quoted text' export local readonly printf readonly sed
+		cd "$1" export x=1 then "$@" "$1" cd test printf local "$@" local test
+| && cd ${HOME} ${HOME}
+	done "$1" /usr/bin then export export local sed "$@" -eu ${HOME} done
+	'quoted text' $(pwd) cd 'quoted text' done --verbose readonly | awk
+		/usr/bin /usr/bin awk 2>/dev/null --verbose "$1"
+		2>/dev/null && 'quoted text' export done cd then
+		-eu 'quoted text' --verbose cd "$1" x=1 | readonly
+then /usr/bin grep && x=1 "$1" --verbose awk test test /usr/bin
+		printf "$1" $(pwd) grep x=1 -eu
+	--verbose done && sed "$1" $(pwd) printf then sed grep
+	x=1 readonly -eu "$@" 'quoted text' /usr/bin
+		then export export ${HOME} ${HOME} done 'quoted text' /usr/bin
+	grep -eu -eu 'quoted text' printf then x=1 "$@" 'quoted text'
+		local | done echo x=1 grep "$1" sed sed local x=1 grep /usr/bin
+#include c227.sh
+		readonly local readonly "$@" echo "$@" && 'quoted text'
+"$@" -eu done "$@" | echo
+local export x=1 2>/dev/null cd then ${HOME} ${HOME} awk printf
+x=1 2>/dev/null sed "$@" readonly
+		--verbose export 2>/dev/null /usr/bin test done /usr/bin test readonly --verbose
+		then local | test then cd 'quoted text' && cd local x=1 local --verbose --verbose
+	--verbose then grep | | local done | awk 'quoted text'
+awk --verbose --verbose $(pwd) /usr/bin readonly local 'quoted text'
+	grep echo | local awk then /usr/bin sed | $(pwd) local -eu | -eu $(pwd) local done
+	$(pwd) && awk 'quoted text'
+		${HOME} $(pwd) grep && done 'quoted text'
+-eu 2>/dev/null grep 'quoted text' /usr/bin test 'quoted text'
+/usr/bin ${HOME} x=1 $(pwd) -eu cd x=1 local /usr/bin cd x=1 printf
+'quoted text' test sed ${HOME}
+/usr/bin $(pwd) | local -eu
+		echo && | && -eu printf done then cd /usr/bin "$1" printf "$1" local
+printf "$@" && awk 'quoted text' readonly -eu sed readonly
+	awk echo done export cd "$1" printf sed cd $(pwd) local "$1" $(pwd)
+/usr/bin 2>/dev/null sed --verbose awk $(pwd) grep
+then && done then 'quoted text' ${HOME} 'quoted text' "$@"
+	| x=1 ${HOME} | 2>/dev/null sed
+		sed then local "$@" readonly 2>/dev/null "$@" echo awk readonly 'quoted text' sed
+		2>/dev/null -eu echo $(pwd) done grep "$1" $(pwd) ${HOME}
+cd /usr/bin x=1 ${HOME} test 'quoted text' && | 2>/dev/null
+	local printf x=1 "$1" readonly
+	--verbose $(pwd) --verbose then local
+"$1" 'quoted text' x=1 -eu done then awk "$1" ${HOME}
+		echo 2>/dev/null echo readonly done awk awk -eu sed "$1" done /usr/bin 2>/dev/null
+'quoted text' x=1 grep readonly then && 2>/dev/null
+	test -eu && ${HOME} echo sed echo test echo awk $(pwd) 'quoted text'
+/usr/bin x=1 awk sed x=1 done && 2>/dev/null ${HOME} local -eu ${HOME} export
+	test test --verbose "$1" export printf
+2>/dev/null local then 'quoted text'
+	2>/dev/null then sed local then 2>/dev/null local awk test
+-eu ${HOME} then "$@" printf 'quoted text' done cd 'quoted text' ${HOME}
+	&& "$@" 'quoted text' && printf $(pwd) $(pwd) cd local 2>/dev/null
+		-eu readonly "$@" cd echo "$@" readonly | then
+		&& "$1" 'quoted text' done printf then 'quoted text' $(pwd)
+	${HOME} awk x=1 test done local /usr/bin "$1" cd done
+		export echo sed "$1" "$@" x=1 ${HOME} | /usr/bin
+		grep ${HOME} echo /usr/bin echo 2>/dev/null echo
+&& awk printf cd then printf export awk export --verbose
+		&& "$@" then $(pwd) export "$@" 2>/dev/null "$1" "$1" 'quoted text'
+		local done --verbose 'quoted text' -eu awk && echo "$@" "$1" cd sed cd /usr/bin
+	done readonly $(pwd) $(pwd) ${HOME} 'quoted text' then sed awk
+echo sed && sed | && echo export && then x=1
+/usr/bin -eu done 2>/dev/null -eu ${HOME} | export
+	echo local done grep local "$1" readonly 'quoted text' awk
+		readonly grep ${HOME} awk "$@" printf done awk && --verbose readonly then printf
+		then local sed /usr/bin local test "$1" grep | cd sed printf
+sed $(pwd) awk local "$@" then echo
+test done "$@" "$@" 'quoted text' cd awk local
+/usr/bin echo grep x=1 awk "$1" | /usr/bin $(pwd) -eu --verbose grep
+${HOME} test $(pwd) "$@" then local export $(pwd) ${HOME} ${HOME}
+		printf done then echo "$@" x=1 readonly -eu | -eu local 'quoted text'
+	sed "$1" 2>/dev/null awk test test
+		"$1" then grep cd 'quoted text' 2>/dev/null
+printf test readonly done printf then 'quoted text' local cd 2>/dev/null /usr/bin
+		x=1 then | awk --verbose 'quoted text' export /usr/bin then
+local x=1 then | -eu printf 2>/dev/null test ${HOME} cd -eu | && /usr/bin
+x=1 local export local then test
+"$@" "$1" then export
+		/usr/bin $(pwd) sed $(pwd) x=1 2>/dev/null local | cd
+	-eu printf sed /usr/bin
+	grep sed echo ${HOME} x=1 'quoted text' sed | local x=1 | readonly
+"$1" $(pwd) /usr/bin x=1 cd | --verbose x=1 local | test x=1 /usr/bin
+'quoted text' -eu then cd x=1 awk
+		sed then local local done ${HOME} printf |
+	"$1" --verbose 2>/dev/null echo awk --verbose local
+		then ${HOME} cd && --verbose ${HOME} 'quoted text' x=1 2>/dev/null
+sed printf 'quoted text' ${HOME} 'quoted text' echo ${HOME} test ${HOME} 2>/dev/null
+$(pwd) printf --verbose cd 2>/dev/null /usr/bin "$@" $(pwd)
+	&& 2>/dev/null | echo local done test echo /usr/bin 2>/dev/null export
+		printf | x=1 printf && 2>/dev/null -eu sed /usr/bin $(pwd) awk && grep | echo
+	readonly /usr/bin $(pwd) then /usr/bin
+	--verbose /usr/bin && local then "$1" x=1 cd grep 2>/dev/null
+	done sed | -eu echo grep x=1 readonly
+	sed "$1" readonly readonly &&
+	&& cd --verbose --verbose "$@" "$@" /usr/bin test export
+	grep ${HOME} done 2>/dev/null printf cd 'quoted text'
+readonly 'quoted text' | then local x=1
+"$1" local printf awk sed --verbose awk readonly x=1
+	readonly export ${HOME} awk
+readonly grep ${HOME} grep "$1" echo $(pwd) printf export readonly x=1 then cd |
+		test then awk readonly --verbose x=1 export $(pwd)
+	2>/dev/null -eu grep 2>/dev/null readonly && "$1"
+		printf grep x=1 $(pwd) /usr/bin -eu local awk | $(pwd) 'quoted text' && | $(pwd)
+	&& 2>/dev/null local test test done /usr/bin -eu printf -eu
+	export --verbose cd "$@" cd x=1 done /usr/bin readonly /usr/bin
+		grep grep export | cd export "$1" ${HOME} then "$1"
+--verbose "$@" echo awk -eu $(pwd) echo then
+	readonly "$@" -eu sed 'quoted text' readonly -eu echo 'quoted text'
+$(pwd) /usr/bin 'quoted text' "$1" "$@" x=1 cd
+	awk 'quoted text' 'quoted text' --verbose 2>/dev/null local readonly
+		then x=1 --verbose readonly | ${HOME} ${HOME} awk
+printf echo test "$@" "$@" 2>/dev/null -eu | "$@" "$@"
+		then cd test --verbose -eu then then 'quoted text' readonly
+	cd done | local --verbose grep local then x=1 readonly cd cd x=1 && ${HOME}
+"$@" grep 2>/dev/null /usr/bin then
+--verbose -eu then readonly $(pwd) $(pwd) -eu /usr/bin "$@" $(pwd) awk x=1 readonly
+	$(pwd) printf "$@" export "$1" $(pwd)
+	then ${HOME} readonly cd echo cd grep
+	then -eu -eu ${HOME} -eu -eu --verbose 2>/dev/null grep /usr/bin sed test
+	$(pwd) "$1" 'quoted text' 'quoted text' 'quoted text' 'quoted text'
+sed local "$1" then && | sed "$@" ${HOME} /usr/bin x=1 /usr/bin
+	2>/dev/null 2>/dev/null sed -eu "$@" grep printf "$@" ${HOME} printf
+		done ${HOME} $(pwd) x=1 && test sed export &&
+test -eu local export "$@" x=1 test -eu awk $(pwd)
+| cd readonly x=1 ${HOME} echo && | $(pwd) sed cd export ${HOME} cd done
+	local /usr/bin local --verbose
+"$1" 2>/dev/null x=1 printf $(pwd) then | then readonly 2>/dev/null cd x=1 readonly
+		&& | readonly $(pwd) sed awk $(pwd) sed local --verbose
+	/usr/bin readonly -eu /usr/bin echo $(pwd) grep printf cd awk ${HOME} export
+		done echo test /usr/bin export echo
+		export then "$1" ${HOME} export cd 'quoted text' /usr/bin ${HOME} /usr/bin
+		-eu grep ${HOME} && /usr/bin x=1 awk
+x=1 cd 2>/dev/null --verbose test /usr/bin
+	/usr/bin --verbose local readonly -eu 2>/dev/null 'quoted text' printf
+${HOME} awk x=1 $(pwd) grep "$1" cd awk local awk 'quoted text'
+	&& readonly cd 'quoted text'
+		awk readonly export export -eu sed local grep done echo readonly awk local then
+	sed 'quoted text' 'quoted text' -eu "$@" "$1" -eu done cd | printf
+| echo -eu done "$1" $(pwd) echo /usr/bin done && printf
+	2>/dev/null -eu local done
+	2>/dev/null --verbose local echo 'quoted text' sed sed /usr/bin &&
+printf $(pwd) printf /usr/bin
+		cd 2>/dev/null then | 2>/dev/null /usr/bin printf x=1 /usr/bin "$1" export
+		'quoted text' readonly x=1 printf x=1 | /usr/bin
+		"$@" then ${HOME} "$1" --verbose $(pwd) local | done
+		echo done | | awk --verbose sed test
+		&& grep then done test local 2>/dev/null 2>/dev/null
+	done echo "$@" sed 'quoted text' "$1" awk
+	cd local 2>/dev/null then x=1
+awk local done readonly printf awk &&
+$(pwd) export && test grep printf printf
+		-eu cd cd 'quoted text' test sed grep && done && $(pwd) --verbose
+$(pwd) 'quoted text' awk x=1 awk | export export /usr/bin
+	${HOME} awk readonly done -eu then then readonly && echo $(pwd) awk ${HOME}
+		$(pwd) /usr/bin x=1 /usr/bin 'quoted text' local
+		&& then | 'quoted text' local echo test
+done && local 2>/dev/null sed
+	then local awk awk -eu readonly awk sed grep "$@"
+"$1" -eu local /usr/bin "$1" ${HOME} local local grep $(pwd) local 'quoted text'
+readonly 2>/dev/null x=1 echo
+'quoted text' export printf then
+	done readonly /usr/bin export echo $(pwd) sed export printf echo
+		'quoted text' echo x=1 /usr/bin sed local "$@" 2>/dev/null /usr/bin
+	${HOME} grep export $(pwd) $(pwd) -eu "$@" ${HOME} /usr/bin -eu awk awk then
+		readonly 2>/dev/null printf test export 'quoted text'
+	/usr/bin grep grep x=1 "$1" $(pwd) "$@" && | awk
+cd ${HOME} grep then ${HOME} ${HOME} /usr/bin export local --verbose
+	readonly cd sed sed then && then 'quoted text' | -eu 2>/dev/null export
+/usr/bin "$1" then "$@" --verbose 'quoted text'
+${HOME} echo x=1 cd export printf --verbose
+"$1" readonly "$@" readonly && $(pwd) printf ${HOME}
+		x=1 "$@" awk 2>/dev/null echo done printf x=1 printf ${HOME} /usr/bin -eu
+		'quoted text' printf "$1" && $(pwd) printf && /usr/bin readonly | ${HOME}
+	then 'quoted text' $(pwd) sed readonly "$1"
+		$(pwd) x=1 echo cd && 2>/dev/null then local sed grep local $(pwd) -eu grep test
+| echo -eu echo "$@" 'quoted text' then ${HOME} awk $(pwd) export
+	${HOME} "$1" /usr/bin x=1 "$@"
+echo x=1 cd /usr/bin printf echo ${HOME}
+	"$1" then grep 2>/dev/null done awk x=1 --verbose
+readonly export ${HOME} && x=1 && 'quoted text'
+	cd readonly cd test done
+		"$1" printf $(pwd) "$@"
+		| export && awk /usr/bin
+	printf 'quoted text' --verbose "$1" readonly /usr/bin awk 2>/dev/null
+test "$@" cd ${HOME} cd local ${HOME} "$@" echo
+	-eu x=1 export $(pwd) sed
+		cd 'quoted text' "$1" --verbose ${HOME}
+		x=1 local /usr/bin printf then done "$1" $(pwd) -eu --verbose cd ${HOME}
+readonly "$@" export echo "$@" sed | --verbose 'quoted text'
+grep "$1" printf echo test && --verbose -eu 'quoted text' echo done
+	then "$1" | done readonly ${HOME} readonly export then && printf ${HOME}
+		2>/dev/null $(pwd) awk "$@" -eu echo
+		-eu ${HOME} local ${HOME} export /usr/bin printf | -eu | export 'quoted text'
+	--verbose "$1" && "$1" | test /usr/bin /usr/bin printf echo $(pwd) 'quoted text'
+		readonly 2>/dev/null "$1" printf $(pwd) --verbose | $(pwd)
+	printf done x=1 done sed -eu "$@" readonly
+cd --verbose && awk test /usr/bin "$@"
+done done /usr/bin export
+		| | then local --verbose export echo -eu export awk -eu
+	2>/dev/null awk readonly echo readonly --verbose $(pwd) "$@" --verbose
+	awk test sed x=1 ${HOME} 2>/dev/null | $(pwd) cd local test sed
+local test x=1 /usr/bin $(pwd) |
+	awk sed test ${HOME} then local sed then sed local then
+		grep "$@" readonly then --verbose && --verbose printf -eu grep
+"$@" done local then "$1" && cd x=1 | -eu
+	| 'quoted text' $(pwd) -eu local x=1 /usr/bin 'quoted text'
+export "$@" then 2>/dev/null 'quoted text' done /usr/bin && then
+	"$@" "$1" grep grep -eu "$@" grep 'quoted text'
+--verbose x=1 awk $(pwd) 2>/dev/null cd "$@" && "$1"
+		"$1" cd -eu awk cd awk printf 2>/dev/null -eu then && /usr/bin
+	"$@" --verbose ${HOME} awk done "$1" test /usr/bin then
+		"$1" sed printf test "$1" printf ${HOME}
+	x=1 export | && | 2>/dev/null
+	export "$@" done export then "$1" 'quoted text'
+done test local $(pwd)
+/usr/bin --verbose cd -eu grep cd then 'quoted text'
+$(pwd) "$1" awk --verbose sed export sed x=1 local
+		sed printf 2>/dev/null /usr/bin readonly then 2>/dev/null
+"$@" "$@" test echo done
+/usr/bin x=1 export "$@" ${HOME}
+		local -eu 'quoted text' echo test test x=1 x=1 cd 2>/dev/null | sed
+	2>/dev/null readonly 2>/dev/null "$1" x=1 sed 2>/dev/null cd
+	-eu $(pwd) then echo 2>/dev/null ${HOME} then local "$1" cd
+$(pwd) test /usr/bin export test done sed then test 'quoted text' 2>/dev/null
+/usr/bin local test /usr/bin local
+	x=1 cd export x=1 printf x=1 then then
+	x=1 awk "$@" "$@" "$@" cd echo local grep $(pwd) cd sed
+		echo export /usr/bin local echo local --verbose && test test test
+	2>/dev/null && readonly awk ${HOME} local printf 2>/dev/null
+$(pwd) grep "$@" local test x=1 && | -eu /usr/bin then readonly
+| 'quoted text' export | /usr/bin export
+test cd x=1 "$@" /usr/bin then readonly export --verbose --verbose
+$(pwd) /usr/bin readonly then /usr/bin | --verbose $(pwd) 'quoted text' readonly
+		echo x=1 awk | test "$@" 2>/dev/null "$1" | awk --verbose --verbose
+	done "$1" "$1" cd | --verbose
+then --verbose awk printf 2>/dev/null
+	cd ${HOME} test "$@" | 'quoted text'
+		grep echo echo && awk | done export cd printf
+	printf echo ${HOME} 2>/dev/null
+		--verbose 2>/dev/null --verbose ${HOME}
+		-eu x=1 printf done && 'quoted text' | awk "$1" export 2>/dev/null -eu local awk
+	$(pwd) $(pwd) local grep done ${HOME} local readonly done awk 2>/dev/null
+		$(pwd) "$@" readonly ${HOME} && /usr/bin
+	printf then done 'quoted text' | $(pwd) x=1 cd /usr/bin --verbose then
+		2>/dev/null readonly 2>/dev/null --verbose
+		'quoted text' "$1" x=1 then printf local "$1" echo test
+$(pwd) export "$1" awk readonly | then readonly -eu $(pwd) && printf x=1 grep
+printf export cd cd printf printf $(pwd)
+	printf | export cd "$@"
+test export "$@" -eu grep cd 'quoted text' 2>/dev/null awk awk
+export export echo ${HOME} | "$@" /usr/bin printf "$1" readonly --verbose $(pwd)
+export /usr/bin local /usr/bin test -eu $(pwd) x=1 grep readonly
+		test $(pwd) sed sed | "$@" echo
+		x=1 && grep x=1 done "$@" done then sed grep readonly echo ${HOME}
+	"$@" | sed $(pwd) grep sed readonly
+		cd $(pwd) 'quoted text' done -eu printf "$@"
+	then done 'quoted text' printf then "$1" local echo "$@" $(pwd)
+then ${HOME} "$@" then awk grep --verbose
+"$@" sed "$1" echo ${HOME} 'quoted text'
+&& x=1 2>/dev/null cd --verbose $(pwd) $(pwd) local local
+	x=1 local done done local done local local
+		grep done x=1 awk "$1" done /usr/bin /usr/bin readonly cd 2>/dev/null grep awk
+		cd local /usr/bin echo sed /usr/bin "$@"
+-eu "$@" -eu export done then "$@" grep "$@" /usr/bin
+		done --verbose readonly sed ${HOME} done local /usr/bin ${HOME} echo done test |
+		local local ${HOME} cd
+export cd 2>/dev/null printf /usr/bin 'quoted text' --verbose -eu | test "$1"
+	test --verbose --verbose
+		'quoted text' x=1 $(pwd) awk local --verbose
+		local && awk grep cd printf "$1" readonly awk ${HOME} "$1" /usr/bin "$@" awk
+		| grep local echo done readonly x=1
+	--verbose cd grep cd readonly 2>/dev/null
+	then /usr/bin 2>/dev/null | then sed readonly done | $(pwd) -eu local
+x=1 x=1 -eu local /usr/bin x=1 'quoted text' x=1 readonly 'quoted text'
+grep 2>/dev/null echo grep "$@" && ${HOME} test ${HOME} /usr/bin test
+done echo "$@" | 'quoted text'
+	"$@" echo cd done cd local /usr/bin --verbose
+		cd -eu local /usr/bin export export cd
+done readonly && x=1 local && cd awk ${HOME} -eu
+		&& awk | 'quoted text' sed $(pwd) then
+		local awk /usr/bin "$@" grep | "$@" export awk
+grep local "$@" then "$1" done -eu "$1" "$@"
+	"$@" done export then local test "$@" $(pwd) && /usr/bin 'quoted text' echo
+grep x=1 /usr/bin sed export | | test
+echo /usr/bin export cd && "$1" readonly local && "$@" $(pwd) local 'quoted text'
+	awk done then "$1" -eu export grep 2>/dev/null cd x=1 echo 2>/dev/null
+cd 'quoted text' --verbose printf
+	$(pwd) printf done | --verbose echo done && sed 2>/dev/null 'quoted text' "$1" x=1
+		'quoted text' echo "$@" readonly x=1 --verbose local x=1 ${HOME}
+		echo awk x=1 printf echo -eu "$1" 2>/dev/null test
+	local awk done "$@" --verbose --verbose done 2>/dev/null awk sed 2>/dev/null /usr/bin
+		grep cd readonly awk $(pwd) && && "$@" $(pwd) 'quoted text' test export x=1
+readonly test 2>/dev/null readonly $(pwd) $(pwd)
+	x=1 then "$1" test readonly ${HOME}
+	then then then 'quoted text' 2>/dev/null && export --verbose cd readonly
+echo ${HOME} then x=1 -eu && printf -eu test sed echo readonly
+echo && test cd test x=1 | done grep --verbose
+		${HOME} --verbose awk
+	cd then /usr/bin ${HOME} "$@" export
+	printf 'quoted text' test grep readonly echo
+		"$@" cd cd x=1 --verbose export x=1 echo done printf
+	"$1" echo echo x=1 cd 2>/dev/null "$1" cd readonly
+sed echo grep test --verbose ${HOME} $(pwd) --verbose
+	awk test printf cd 'quoted text' grep test "$@"
+		"$@" x=1 sed x=1 readonly local "$1" -eu awk x=1 ${HOME} | printf test
+	-eu -eu "$@" "$1" /usr/bin "$@" | export then 2>/dev/null
+		&& sed awk | export then | 2>/dev/null x=1
+	--verbose awk local printf
+$(pwd) export && sed 'quoted text' local "$1" --verbose /usr/bin
+export done sed sed cd grep
+	local 'quoted text' sed export 'quoted text' grep
+test "$@" cd 2>/dev/null then export done sed --verbose echo then 'quoted text'
+		'quoted text' local ${HOME} grep x=1
+'quoted text' local $(pwd) "$1" x=1 && grep $(pwd)
+		echo export printf $(pwd) echo -eu done grep then
+		| printf sed -eu && awk /usr/bin
+local readonly "$@" printf done x=1 --verbose
+sed "$1" -eu $(pwd) grep $(pwd) && | 'quoted text' "$1" export printf then x=1
+	sed export done local 'quoted text'
+	done echo $(pwd) export 'quoted text' awk done 'quoted text'
+'quoted text' grep local local sed --verbose
+		done x=1 x=1 grep --verbose 'quoted text'
+		-eu test --verbose awk test /usr/bin -eu 'quoted text'
+"$@" | grep && && readonly --verbose
+awk x=1 -eu /usr/bin $(pwd) x=1 export sed "$@" sed
+	sed export awk then local readonly
+		export then sed readonly
+	| --verbose printf 'quoted text' grep cd grep $(pwd) echo awk
+	--verbose 'quoted text'
+	awk export | ${HOME} --verbose ${HOME} done
+		'quoted text' local ${HOME} | grep --verbose
+awk awk $(pwd) "$@" printf cd /usr/bin awk test x=1 local
+printf cd cd echo 2>/dev/null test done /usr/bin sed grep done then cd -eu
+	cd /usr/bin export /usr/bin test export x=1 | local && 2>/dev/null test
+	-eu awk 2>/dev/null $(pwd) then $(pwd) && local
+	2>/dev/null readonly x=1 awk local
+	2>/dev/null $(pwd) && --verbose && echo ${HOME} export test
+		local --verbose "$@" --verbose awk awk -eu -eu /usr/bin local grep && "$1" /usr/bin
+		export /usr/bin --verbose echo readonly readonly printf export echo
+${HOME} local then awk export | --verbose done cd 'quoted text'
+local sed readonly printf 'quoted text' echo
+		cd test test 'quoted text' 'quoted text'
+echo "$@" awk -eu printf local awk
+		"$@" done export | $(pwd) ${HOME} test
+	readonly --verbose --verbose
+		x=1 | printf 2>/dev/null $(pwd) echo local 'quoted text' x=1 --verbose
+		test then echo $(pwd) test x=1 then 2>/dev/null done
+	sed && cd 2>/dev/null 'quoted text' then local "$@" /usr/bin 'quoted text'
+		'quoted text' ${HOME} -eu "$@" awk echo x=1 grep x=1
+/usr/bin then then sed $(pwd)
+		&& awk done cd printf printf done | /usr/bin sed
+	sed -eu echo /usr/bin "$@" -eu then
+		awk echo local local awk test sed export -eu
+	then local done | done /usr/bin readonly
+2>/dev/null ${HOME} -eu /usr/bin
+		x=1 'quoted text' --verbose $(pwd) $(pwd) sed local echo -eu | | local
+printf "$1" test then ${HOME}
+--verbose sed cd done done
+	&& echo x=1 cd readonly /usr/bin --verbose "$@" && test ${HOME}
+	echo && then then $(pwd) "$1" echo &&
+local done $(pwd) awk 2>/dev/null local sed done echo
+	test && $(pwd) test 2>/dev/null grep && 'quoted text'
+	sed ${HOME} | cd ${HOME} sed
+local local local 2>/dev/null
+		local echo test && -eu echo
+	echo --verbose $(pwd) done && readonly && $(pwd)
+		'quoted text' test /usr/bin done
+		| grep local printf "$1" |
+test echo grep | echo 'quoted text' sed
+	grep local local 2>/dev/null 2>/dev/null
+	${HOME} then $(pwd) $(pwd) x=1 'quoted text' 2>/dev/null "$1" echo
+		$(pwd) grep done export | ${HOME} x=1 export awk export
+awk "$@" cd sed grep "$1"
+		--verbose cd test "$@" cd export
+	then "$1" 2>/dev/null grep done 'quoted text'
+		2>/dev/null cd 2>/dev/null cd | printf "$1" && && $(pwd) grep
+	| 'quoted text' export ${HOME} -eu readonly x=1 /usr/bin then done --verbose
+/usr/bin "$@" echo x=1 2>/dev/null cd $(pwd) readonly awk
+	2>/dev/null test then 'quoted text' 'quoted text'
+	--verbose echo local awk "$1" test -eu "$1" printf ${HOME} readonly
+		cd $(pwd) cd echo grep -eu x=1
+echo echo awk readonly 'quoted text' | x=1
+	--verbose echo awk x=1 then
+cd 2>/dev/null x=1 then "$@" grep --verbose
+		-eu 2>/dev/null then 2>/dev/null 2>/dev/null /usr/bin readonly
+	printf && "$@" --verbose -eu && done x=1 then done --verbose
+		"$1" then printf done sed /usr/bin 'quoted text' $(pwd) $(pwd)
+	$(pwd) echo export export "$@" 'quoted text' cd export echo 'quoted text'
+		${HOME} /usr/bin export /usr/bin | printf -eu test
+		done done done test && "$1" then ${HOME} -eu "$@" printf && local --verbose --verbose
+		echo export "$1" x=1 'quoted text' grep $(pwd)
+		| --verbose $(pwd) --verbose
+--verbose awk -eu test done "$1" x=1 "$@" local grep grep $(pwd) 'quoted text'
+	&& $(pwd) | $(pwd) "$1" -eu
+		export "$@" -eu "$@" local echo test | && $(pwd) 'quoted text'
+		| 'quoted text' test && local readonly /usr/bin x=1 echo /usr/bin $(pwd)
+		then 'quoted text' /usr/bin then "$1" test readonly 2>/dev/null
+echo test 'quoted text' x=1 awk --verbose
+	2>/dev/null done /usr/bin local
+then -eu then test test cd 2>/dev/null
+	/usr/bin 'quoted text' 2>/dev/null printf $(pwd) grep /usr/bin
+		echo export $(pwd) -eu
+	&& grep "$1" /usr/bin echo -eu cd 2>/dev/null echo ${HOME} --verbose ${HOME} export
+	'quoted text' awk "$@" grep then x=1 export
+awk ${HOME} "$1" awk readonly
+	'quoted text' "$@" cd done readonly test grep --verbose
+local readonly awk 'quoted text' test echo "$@"
+		awk /usr/bin ${HOME} echo echo sed local 'quoted text' cd sed cd 'quoted text'
+local 'quoted text' test done --verbose
+cd /usr/bin echo | 'quoted text' ${HOME} "$@" readonly grep
+	local x=1 x=1 && "$@" grep then && && awk $(pwd) printf then
+'quoted text' done ${HOME} sed ${HOME} x=1 test 'quoted text' $(pwd)
+	cd export x=1 | | grep echo printf echo echo echo ${HOME} cd
+-eu --verbose cd test $(pwd) echo readonly
+		'quoted text' 2>/dev/null then --verbose awk then /usr/bin done --verbose
+	2>/dev/null test $(pwd) printf echo -eu
+	cd | /usr/bin echo readonly printf
+	awk $(pwd) ${HOME} cd printf "$@" local awk 2>/dev/null | sed grep -eu $(pwd)
+done cd | done readonly test test
+	grep echo then -eu -eu 'quoted text' awk cd grep && "$@"
+then x=1 sed readonly x=1 done "$@" cd
+	${HOME} echo echo | grep readonly done
+	sed "$1" 'quoted text' then test | local x=1 && echo export |
+	-eu echo awk local 2>/dev/null
+${HOME} local && ${HOME} 'quoted text' then echo cd 'quoted text' 'quoted text'
+export awk export printf then "$1" test |
+export 'quoted text'
+done | --verbose "$1" "$1" 'quoted text' --verbose | "$1" x=1
+"$@" local echo $(pwd) -eu readonly x=1 readonly "$1" grep x=1 2>/dev/null
+cd test test && $(pwd) test readonly local | grep 'quoted text' sed "$@"
+		${HOME} x=1 export "$@" "$1" export --verbose test
+then /usr/bin "$@" "$@" | --verbose -eu 2>/dev/null cd $(pwd) grep done
+echo -eu test 'quoted text' /usr/bin
+printf grep x=1 cd && "$1" readonly && test export echo
+	'quoted text' echo | -eu grep x=1 -eu $(pwd) readonly $(pwd) "$1" local local
+	${HOME} "$@" test local /usr/bin $(pwd) test "$1" done 'quoted text' -eu
+		--verbose local | sed
+	sed sed ${HOME} then export /usr/bin test -eu cd export ${HOME} | $(pwd) x=1
+		readonly grep printf done
+	x=1 done -eu export | && done && then printf
+		done export 'quoted text' sed readonly $(pwd) "$1" -eu local awk 2>/dev/null
+	export | /usr/bin 2>/dev/null done sed sed done /usr/bin "$1" && readonly
+		readonly readonly /usr/bin local
+$(pwd) export export /usr/bin then export local x=1 && 'quoted text'
+	echo export local export cd
+	echo 'quoted text' grep "$@" ${HOME} /usr/bin --verbose "$1" -eu readonly echo
+	local echo 'quoted text' 2>/dev/null sed --verbose && printf
+	| test ${HOME} | $(pwd) --verbose "$1" awk grep && printf then -eu --verbose
+	then echo -eu && x=1 'quoted text' grep --verbose
+		awk 2>/dev/null -eu ${HOME} | --verbose ${HOME}
+		cd awk printf echo echo done awk ${HOME} sed | /usr/bin | ${HOME} echo "$1"
+	readonly local "$1" x=1 "$1" --verbose local -eu x=1 done
+'quoted text' --verbose ${HOME} $(pwd) sed
+	sed "$@" "$1" --verbose local && local sed /usr/bin test /usr/bin "$1"
+		grep readonly $(pwd) $(pwd) readonly sed 2>/dev/null
+		then ${HOME} ${HOME} 'quoted text'
+	$(pwd) 2>/dev/null 'quoted text' cd
+	sed -eu then && "$1" && ${HOME} cd "$@" echo
+	test cd $(pwd) 'quoted text' grep | test printf x=1 x=1 2>/dev/null
+&& $(pwd) sed echo cd -eu sed echo /usr/bin "$@" | && done
+	grep export "$@" -eu grep grep --verbose grep 2>/dev/null sed printf grep echo
+		readonly ${HOME} x=1 'quoted text'
+	-eu /usr/bin awk x=1 ${HOME}
+	local -eu 'quoted text' ${HOME} export "$@"
+then awk 'quoted text' then echo test
+		"$1" "$1" echo 'quoted text' readonly grep | "$@"
+x=1 grep x=1 | -eu done "$1"
+printf x=1 -eu readonly && && "$1" awk --verbose done printf
+	then grep awk x=1 local -eu x=1 "$@" $(pwd) x=1 /usr/bin printf
+	/usr/bin -eu sed 2>/dev/null --verbose "$1" cd
+		echo | export "$1" /usr/bin printf
+	2>/dev/null 'quoted text'
+	x=1 grep ${HOME} /usr/bin done 'quoted text'
+done done sed readonly then "$1" cd readonly $(pwd)
+"$@" test 2>/dev/null --verbose /usr/bin /usr/bin done then grep local test
+		"$@" x=1 grep | --verbose 2>/dev/null --verbose "$@"
+then --verbose 2>/dev/null sed $(pwd) /usr/bin "$1" sed | 'quoted text' $(pwd)
+	export && awk cd local readonly
+		sed printf ${HOME} local
+	-eu test then 2>/dev/null /usr/bin "$@" x=1 sed done grep | -eu --verbose --verbose
+${HOME} test 'quoted text' x=1 $(pwd) x=1
+printf 2>/dev/null printf x=1 cd -eu "$1" 2>/dev/null x=1
+	--verbose "$1" local sed echo x=1 test cd echo sed 2>/dev/null "$@"
+	-eu done awk local -eu test ${HOME} grep readonly 'quoted text' -eu "$@" echo
+	done | local echo /usr/bin
+local --verbose x=1 awk -eu 'quoted text'
+	-eu grep echo then then
+-eu $(pwd) export sed /usr/bin grep awk | sed -eu then awk x=1 printf x=1
+	"$@" test /usr/bin /usr/bin test
+test && local /usr/bin then then readonly
+	-eu printf -eu echo --verbose
+		printf 2>/dev/null echo -eu | export test "$1" then then test printf
+	/usr/bin done awk --verbose 2>/dev/null --verbose ${HOME} test /usr/bin done
+&& cd test && printf done
+	/usr/bin "$1" done 'quoted text'
+		| awk printf "$@" -eu "$1" cd local then done --verbose 2>/dev/null
+		| 'quoted text' --verbose
+		local 2>/dev/null cd "$1" "$@" | x=1 ${HOME}
+		| export export --verbose export sed 'quoted text' awk
+		-eu done ${HOME} "$@" -eu cd x=1 $(pwd) cd $(pwd) awk $(pwd) "$@" "$@"
+	"$1" cd done readonly "$1" "$@"
+then local readonly printf readonly awk local test echo test cd export --verbose
+printf then awk $(pwd) test | readonly awk &&
+grep done | local --verbose printf $(pwd) readonly
+	"$@" && "$@" grep $(pwd) then
+printf "$@" grep awk grep "$@" /usr/bin test | "$@" sed cd && export 2>/dev/null
+		cd 2>/dev/null --verbose | echo "$@" done
+		--verbose test --verbose && export echo && export
+	2>/dev/null local "$1" -eu local echo x=1 "$1" -eu grep | done && local "$1" test
+test awk | readonly test ${HOME} | "$@" /usr/bin
+grep grep cd $(pwd) export local
+	| awk grep awk $(pwd) | sed export "$1" done
+printf export local done 2>/dev/null then readonly /usr/bin "$1" grep
+printf done readonly printf test local $(pwd)
+		| -eu done readonly cd echo
+		export ${HOME} done export export test cd then --verbose /usr/bin export cd "$@"
+		grep cd test sed export 2>/dev/null $(pwd) --verbose readonly sed
+x=1 local cd test && sed grep -eu "$@" awk cd "$1" x=1 grep 2>/dev/null
+${HOME} done test -eu /usr/bin --verbose | &&
+	| cd x=1 2>/dev/null test local | --verbose local 'quoted text' x=1
+		${HOME} /usr/bin printf export 2>/dev/null printf
+	'quoted text' 'quoted text' local x=1 sed x=1 awk local 2>/dev/null test
+-eu grep local "$1" x=1 cd /usr/bin | -eu $(pwd) cd awk done
+		'quoted text' "$1" | "$1"
+		$(pwd) local then 2>/dev/null local grep --verbose printf export
+		test --verbose "$1" export grep "$1" "$@"
+		grep sed export "$1" 'quoted text' awk done export 2>/dev/null 'quoted text'
+	${HOME} && $(pwd) -eu sed test echo $(pwd) ${HOME} ${HOME} "$@" | x=1 test
+	test "$1" done done local readonly --verbose --verbose done
+$(pwd) readonly sed local $(pwd) ${HOME} | then
+awk local --verbose 2>/dev/null printf awk
+	grep && readonly 'quoted text' local export x=1 && cd
+export /usr/bin printf 2>/dev/null "$@" sed --verbose /usr/bin "$1" && 'quoted text'
+cd --verbose ${HOME} grep 'quoted text' --verbose "$1" then awk done -eu
+	export 'quoted text' "$@" $(pwd) cd --verbose local "$@" 'quoted text'
+		'quoted text' printf printf -eu test 'quoted text' "$1" sed export
+		-eu test readonly done 'quoted text' && export then -eu x=1
+		export printf --verbose 2>/dev/null awk echo --verbose cd done then
+		then -eu x=1 && ${HOME} | /usr/bin then local 'quoted text'
+	--verbose cd $(pwd) x=1 printf export /usr/bin "$@"
+		export | awk echo then --verbose printf "$@" 2>/dev/null
+printf local printf "$@" echo done /usr/bin /usr/bin
+	/usr/bin $(pwd) 2>/dev/null x=1
+	grep /usr/bin x=1 x=1 then grep sed echo $(pwd) sed
+grep cd /usr/bin cd readonly readonly
+		$(pwd) grep local -eu local 2>/dev/null
+2>/dev/null "$@" echo done awk $(pwd) readonly test
+		$(pwd) 'quoted text' local x=1 "$@"
+	awk then | $(pwd) ${HOME} | local x=1 export
+	echo /usr/bin local test awk test done printf x=1
+cd cd export then sed x=1 printf sed echo done printf local && "$1" $(pwd)
+		local && grep local | test
+awk && echo x=1 test /usr/bin export
+	'quoted text' && | && x=1 "$@" grep local "$@" grep | 'quoted text' $(pwd)
+		${HOME} test local local
+local | && export export done awk && echo echo printf
+	readonly then /usr/bin echo $(pwd) --verbose
+$(pwd) awk "$@" "$1" --verbose then then 'quoted text' cd /usr/bin "$1" && "$@"
+readonly test grep sed x=1 "$1" echo printf 'quoted text' x=1
+		| echo grep echo test done && grep
+-eu "$@" then $(pwd) sed cd | $(pwd) 2>/dev/null cd "$1" local
+| printf readonly --verbose grep $(pwd) $(pwd) test
+		test "$@" | echo then && -eu done ${HOME} | sed && 'quoted text'
+		echo grep $(pwd) awk then local /usr/bin
+		readonly grep test && test $(pwd) test && grep
+	grep x=1 cd export local $(pwd) then cd
+local /usr/bin "$@" printf echo then | done
+		| x=1 done echo printf readonly test ${HOME} 'quoted text'
+		test /usr/bin readonly ${HOME} 2>/dev/null export /usr/bin grep test -eu
+		$(pwd) /usr/bin printf x=1 /usr/bin grep | "$@" 2>/dev/null
+awk --verbose local 2>/dev/null "$1"
+	$(pwd) | "$1" export grep "$@" 2>/dev/null x=1 | 2>/dev/null sed
+export ${HOME} printf cd x=1 && /usr/bin grep $(pwd) sed ${HOME}
+		export $(pwd) then x=1 then --verbose readonly | printf 2>/dev/null
+	$(pwd) awk -eu done -eu printf done done "$1" done
+		readonly -eu ${HOME} "$@" "$1" awk "$@" ${HOME} | awk -eu cd 2>/dev/null | ${HOME}
+		export echo $(pwd) x=1 printf
+x=1 /usr/bin -eu printf
+	'quoted text' -eu cd grep then --verbose local
+	sed --verbose "$@" grep local
+printf local ${HOME} sed awk readonly | 2>/dev/null awk awk $(pwd) local
+-eu grep | -eu "$1" export /usr/bin sed printf
+		"$@" echo printf grep export readonly done 2>/dev/null cd /usr/bin "$1"
+		echo grep test awk | "$@" && readonly export sed "$1" sed awk &&
+		local local $(pwd) grep /usr/bin
+	grep echo grep 2>/dev/null readonly
+		&& "$1" /usr/bin | local | --verbose cd
+		x=1 && x=1 done echo sed "$@" 'quoted text'
+		done done readonly local | | grep && printf "$@" "$1"
+	then test x=1 --verbose awk ${HOME}
+		export 2>/dev/null --verbose printf -eu && local done | awk $(pwd)
+grep $(pwd) ${HOME} 'quoted text' then "$1" "$@" x=1 x=1 cd awk ${HOME} -eu
+${HOME} --verbose sed awk && && x=1
+echo "$1" echo "$1" cd 2>/dev/null --verbose
+	/usr/bin then then test then echo echo
+export done | "$1" 'quoted text' grep | --verbose cd x=1 sed local /usr/bin
+		$(pwd) cd "$1" --verbose grep /usr/bin then
+		x=1 -eu cd && local 2>/dev/null local done local 2>/dev/null | test 'quoted text'
+		-eu test cd 2>/dev/null done ${HOME} x=1 /usr/bin cd cd export export grep
+	cd "$1" cd ${HOME} --verbose "$1" local 'quoted text'
+	"$1" then sed | x=1 ${HOME} 2>/dev/null export --verbose
+		-eu test local -eu "$1" | 'quoted text' $(pwd)
+	then -eu cd /usr/bin cd && grep test | export cd grep | /usr/bin $(pwd) local /usr/bin
+	awk -eu then sed 'quoted text'
+	| local readonly echo
+	grep -eu --verbose export "$1" export
+	grep local 2>/dev/null 2>/dev/null sed grep test $(pwd) then 'quoted text'
+		x=1 $(pwd) && cd "$@" sed local sed
+sed x=1 'quoted text' grep -eu grep then grep --verbose ${HOME} done sed test
+	local 2>/dev/null "$1" printf -eu 2>/dev/null cd
+| $(pwd) done && x=1 | echo --verbose printf $(pwd)
+&& --verbose "$@" && && -eu readonly ${HOME} test cd test grep 'quoted text'
+	grep --verbose grep export
+echo "$@" --verbose sed printf export readonly
+	echo local cd /usr/bin grep 'quoted text'
+		x=1 echo awk x=1 $(pwd)
+echo /usr/bin "$1" 'quoted text' done x=1 readonly done
+/usr/bin local | readonly "$@" --verbose && x=1 &&
+		then cd /usr/bin cd ${HOME} sed cd /usr/bin printf
+awk $(pwd) 'quoted text' awk ${HOME} -eu grep
+'quoted text' "$1" ${HOME} done sed
+sed 'quoted text' "$1" $(pwd) then done x=1 sed x=1 then "$1" done sed echo
+		x=1 export 2>/dev/null done sed
+		printf -eu -eu sed sed test --verbose printf local awk /usr/bin cd && 2>/dev/null
+		-eu && echo "$1" echo then 2>/dev/null "$@" 'quoted text' -eu local 2>/dev/null
+	awk "$1" "$@" then 2>/dev/null cd test
+&& readonly ${HOME} $(pwd) sed awk && "$@" local grep
+		sed echo cd test /usr/bin echo local x=1 -eu readonly "$@" then
+echo grep awk sed done --verbose | sed "$@"
+	then $(pwd) local cd $(pwd)
+done 'quoted text' 'quoted text' export local | "$@"
+	done then -eu | echo readonly
+grep && x=1 test "$1" 2>/dev/null
+	"$@" && x=1 $(pwd) grep x=1 sed
+		-eu echo done sed printf awk then ${HOME} 'quoted text' 'quoted text'
+		printf -eu cd /usr/bin sed "$1" export $(pwd) test
+		cd "$1" printf then && sed cd
+sed then echo ${HOME} | then
+	${HOME} $(pwd) awk sed -eu readonly
+	"$@" echo ${HOME} ${HOME} then
+		| test local && 2>/dev/null
+	-eu local | local $(pwd) 2>/dev/null 2>/dev/null
+		sed sed -eu echo then test && "$@" x=1
+	| cd export printf "$1" 'quoted text' --verbose
+| test 'quoted text' grep printf --verbose
+/usr/bin "$@" readonly local readonly $(pwd) echo done x=1
+		--verbose awk 2>/dev/null then sed "$@" | sed x=1 cd sed cd
+	"$@" export "$1" 2>/dev/null local printf
+x=1 cd echo --verbose echo -eu $(pwd) grep awk then done x=1 local
+	x=1 local test grep "$@" done ${HOME} then echo done
+'quoted text' 'quoted text' cd export "$1" -eu then printf awk awk
+		sed awk local grep ${HOME} /usr/bin "$1" export && then "$1"
+		sed --verbose "$@" 2>/dev/null then done
+		readonly -eu $(pwd) sed readonly --verbose
+'quoted text' local grep cd readonly readonly then done
+printf 'quoted text' | "$1" && done --verbose readonly printf printf
+	local test 'quoted text' awk printf local printf "$@" grep grep printf
+	local readonly echo x=1 test printf ${HOME}
+		printf cd | cd export 'quoted text' 2>/dev/null "$@" --verbose | "$1" cd sed |
+--verbose x=1 $(pwd) ${HOME} then readonly
+	then test export echo readonly -eu then $(pwd)
+	cd export export && export cd | cd | sed "$1" echo done cd echo readonly
+	'quoted text' 2>/dev/null echo
+/usr/bin printf grep echo --verbose then
+printf export -eu local ${HOME}
+	sed | sed test && $(pwd) echo printf echo /usr/bin echo --verbose
+	grep export --verbose ${HOME} awk 2>/dev/null x=1 echo | export --verbose local
+		| ${HOME} echo echo then awk readonly readonly
+"$1" "$1" awk grep sed | awk
+test -eu done awk grep cd cd $(pwd) | echo then
+test test test sed readonly "$1" /usr/bin then "$1" then cd | ${HOME}
+		--verbose --verbose | test
+		readonly sed sed cd sed
+export readonly grep done test then 2>/dev/null local | && "$1" && done --verbose
+	readonly $(pwd) sed grep cd then && "$@" 'quoted text' -eu awk then cd test
+	grep sed "$1" then printf
+x=1 then done "$@" local cd printf echo $(pwd)
+readonly | --verbose export printf readonly | printf "$@"
+$(pwd) --verbose ${HOME} --verbose ${HOME} cd 2>/dev/null -eu | ${HOME}
+	'quoted text' $(pwd) "$@" ${HOME} readonly
+"$1" "$1" "$1" echo echo /usr/bin | then "$@" test /usr/bin test sed then readonly
+		done $(pwd) "$1" done readonly ${HOME} /usr/bin echo -eu awk
+	local readonly printf sed && ${HOME} $(pwd) readonly awk x=1 -eu local
+2>/dev/null $(pwd) 2>/dev/null done x=1 awk x=1 printf && cd local
+test 'quoted text' -eu 'quoted text' "$@" /usr/bin
+| grep echo "$1" "$@" export | awk echo printf 'quoted text'
+${HOME} awk 'quoted text' 2>/dev/null
+done 2>/dev/null test | | --verbose sed x=1 cd 'quoted text' --verbose -eu
+		"$@" printf test --verbose --verbose $(pwd) &&
+	cd test $(pwd) done then test | echo --verbose echo 'quoted text' test /usr/bin
+	readonly 'quoted text'
+		readonly 'quoted text' grep
+		${HOME} 'quoted text' export /usr/bin | printf /usr/bin | 2>/dev/null
+	local readonly test 'quoted text' "$@"
+	'quoted text' "$@" done done --verbose "$1" readonly "$1" echo --verbose export
+cd "$@" test cd $(pwd) ${HOME} local
+		'quoted text' cd export "$1" grep printf then
+grep x=1 | done local readonly printf "$1"
+		| 2>/dev/null /usr/bin export
+cd cd -eu 2>/dev/null 2>/dev/null x=1 local test ${HOME} /usr/bin
+&& --verbose echo 2>/dev/null
+		${HOME} readonly printf printf done done sed printf done --verbose
+&& readonly "$@" readonly /usr/bin local x=1 export x=1 "$@" "$@"
+awk cd test --verbose grep 'quoted text' sed
+		echo done sed readonly cd x=1 "$1" test && awk export 2>/dev/null | sed $(pwd)
+	"$@" export cd /usr/bin echo 2>/dev/null
+	local && | echo then --verbose readonly
+${HOME} then --verbose readonly printf "$1" "$1" sed "$1"
+	then export && export readonly echo echo -eu then local -eu
+		${HOME} test && x=1 && grep ${HOME} 2>/dev/null awk
+$(pwd) echo -eu test && --verbose printf
+		grep $(pwd) 'quoted text' --verbose -eu 2>/dev/null
+-eu -eu done export awk ${HOME} 'quoted text'
+	--verbose $(pwd) && grep "$1" -eu awk -eu --verbose x=1
+		awk "$@" 'quoted text' readonly --verbose test grep "$1" printf | local "$@" local
+local | x=1 ${HOME} 2>/dev/null sed
+	&& awk done then then ${HOME} ${HOME} 'quoted text' cd ${HOME} ${HOME}
+	x=1 'quoted text' 2>/dev/null 2>/dev/null local 2>/dev/null
+	sed /usr/bin -eu && echo 'quoted text' "$1" cd
+		test sed readonly -eu x=1 && $(pwd)
+"$1" echo && echo echo -eu && "$@" | export sed echo
+	printf then cd 2>/dev/null cd 'quoted text' test "$1" 2>/dev/null
+		2>/dev/null cd done | awk done then | cd printf printf local cd "$@" cd "$1"
+		$(pwd) printf grep && awk done --verbose
+/usr/bin grep --verbose 'quoted text' 2>/dev/null "$@" echo | "$1" cd | "$1" test
+		echo "$1" ${HOME} grep local x=1 /usr/bin cd 2>/dev/null -eu readonly --verbose
+		readonly | | ${HOME} awk sed done $(pwd) | echo && /usr/bin
+2>/dev/null awk printf 'quoted text' export then --verbose ${HOME} ${HOME}
+done test grep -eu "$@" local /usr/bin awk readonly then export
+/usr/bin echo ${HOME} x=1 -eu
+	-eu "$@" cd x=1 export && cd awk && $(pwd) x=1 echo test /usr/bin
+	"$1" local done ${HOME} && &&
+export export cd printf grep awk cd "$1" test echo | done x=1 -eu
+	${HOME} readonly done export grep grep awk readonly grep 'quoted text' --verbose
+	x=1 grep /usr/bin export "$@" then x=1
+		"$1" echo sed --verbose
+		grep printf sed printf
+		then "$@" then export && echo sed sed $(pwd) ${HOME} --verbose cd grep test test
+	&& grep test export && "$@" /usr/bin sed x=1 echo
+export "$1" grep readonly test | awk -eu done | local printf then
+	$(pwd) sed done && awk -eu 'quoted text' 2>/dev/null 'quoted text' 2>/dev/null
+		readonly test 2>/dev/null done grep ${HOME}
+		readonly "$@" x=1 x=1 "$@" sed done && then done printf readonly &&
+2>/dev/null ${HOME} export && && export 2>/dev/null
+		sed | | cd ${HOME} $(pwd) ${HOME} done printf /usr/bin echo | | local
+	done 2>/dev/null test sed export
+	${HOME} grep export sed --verbose export test "$1"
+		"$1" test "$1" echo | readonly 'quoted text' test sed 2>/dev/null -eu
+readonly "$@" readonly "$@" grep done "$@" | local test test
+	$(pwd) 2>/dev/null "$1" |
+		grep then then awk done -eu awk
+	local "$1" /usr/bin x=1 "$@" && "$1" ${HOME} | readonly --verbose
+	--verbose "$1" && -eu echo cd local cd && "$@" local && -eu && then ${HOME}
+		"$@" printf awk /usr/bin printf
+		/usr/bin export done awk readonly then
+sed 'quoted text' -eu readonly 2>/dev/null test | $(pwd) readonly printf
+		grep -eu "$1" -eu sed cd test | $(pwd) local awk 'quoted text'
+grep $(pwd) "$@" cd 'quoted text'
+	"$1" then test grep export export then then
+		done grep /usr/bin export &&
+	'quoted text' "$1" export sed 'quoted text' 'quoted text'
+	test printf && "$@" local cd local x=1 "$1" awk test "$1" echo local -eu
+		then 2>/dev/null echo cd -eu "$1"
+		awk /usr/bin readonly then echo x=1 local printf && -eu | /usr/bin grep
+${HOME} && grep test test ${HOME} /usr/bin
+		printf awk --verbose printf awk ${HOME} printf export test cd -eu readonly
+	echo -eu then awk printf grep readonly
+	"$1" awk "$@" | ${HOME} 2>/dev/null test grep echo grep /usr/bin printf sed "$1"
+		'quoted text' test grep
+echo export readonly done grep grep $(pwd) export printf test && --verbose printf
+	/usr/bin 2>/dev/null awk sed | --verbose
+then done -eu /usr/bin awk printf
+		cd x=1 "$1" readonly && 'quoted text' sed /usr/bin | awk then "$1"
+		&& sed awk $(pwd) sed cd awk cd && printf 2>/dev/null
+2>/dev/null --verbose && done readonly done ${HOME}
+awk "$1" "$1" cd ${HOME} grep test sed /usr/bin readonly "$@"
+		export /usr/bin then x=1 | test printf export 2>/dev/null --verbose
+	2>/dev/null test local | -eu then local 2>/dev/null
+	${HOME} | grep readonly then readonly && readonly "$@" $(pwd)
+&& export 'quoted text' awk
+"$@" done "$@" | grep | printf x=1 sed -eu --verbose then /usr/bin
+cd ${HOME} sed "$@" test sed /usr/bin x=1 awk grep
+"$1" x=1 $(pwd) echo printf "$1" x=1 cd then "$@" grep
+'quoted text' ${HOME} "$1" awk 2>/dev/null 'quoted text' readonly
+	--verbose 2>/dev/null grep
+	awk $(pwd) --verbose 'quoted text' cd | x=1 'quoted text' echo
+2>/dev/null echo "$@" | local
+	cd echo test /usr/bin $(pwd) readonly echo local sed done /usr/bin "$1"
+	x=1 awk then "$1" readonly export | && $(pwd)
+	done grep grep -eu then local "$1" cd readonly then printf
+x=1 printf $(pwd) sed -eu local &&
+		local test local "$1" local local $(pwd)
+		export local --verbose
+then | | local /usr/bin $(pwd) export "$@" readonly
+		local x=1 export $(pwd) 'quoted text'
+		then then sed && then printf 'quoted text'
+		-eu cd $(pwd) awk local 2>/dev/null -eu
+local echo awk && -eu test "$1" "$@" "$1" done 'quoted text' local ${HOME} test
+		2>/dev/null 'quoted text' x=1 printf then 'quoted text' grep
+local /usr/bin 'quoted text' 'quoted text' | --verbose
+	-eu 2>/dev/null done x=1 grep /usr/bin
+	printf 2>/dev/null ${HOME} grep 2>/dev/null x=1 readonly done printf 2>/dev/null
+	--verbose "$1" done local echo /usr/bin "$1" | /usr/bin 'quoted text'
+		echo readonly export x=1 local test ${HOME} "$1" x=1 --verbose | 2>/dev/null
+&& -eu 2>/dev/null readonly
+		readonly export sed awk printf -eu
+	x=1 /usr/bin readonly 'quoted text' -eu export then ${HOME} "$@" awk grep done
+		export 'quoted text' 2>/dev/null
+	readonly "$@" echo grep test ${HOME} then -eu x=1 2>/dev/null
+then then | echo sed done echo done printf done grep
+	test ${HOME} grep $(pwd) awk test $(pwd) sed $(pwd) ${HOME} 2>/dev/null 2>/dev/null
+	grep 2>/dev/null printf test
+	readonly local $(pwd) awk cd then && $(pwd) then done local x=1 --verbose
+	| --verbose test echo ${HOME} readonly test sed "$1" grep cd "$@"
+	echo grep readonly local x=1 then ${HOME} 2>/dev/null "$@" | 2>/dev/null
+		test export 2>/dev/null local ${HOME}
+	sed grep sed sed echo -eu
+'quoted text' 2>/dev/null /usr/bin x=1 readonly && done -eu then | "$1"
+	printf then $(pwd) --verbose
+		export export done done ${HOME} x=1 --verbose sed
+	test "$@" ${HOME} test done awk --verbose x=1 "$1" local printf
+cd sed x=1 done x=1 printf x=1 done grep &&
+	2>/dev/null then --verbose
+		then "$1" 2>/dev/null $(pwd) --verbose x=1 awk -eu ${HOME} "$@" echo 2>/dev/null
+	"$1" grep cd printf "$@" $(pwd) 'quoted text' 2>/dev/null 2>/dev/null
+	-eu sed cd ${HOME} | -eu printf done --verbose -eu /usr/bin
+printf /usr/bin printf "$@" echo sed printf then
+sed echo then done then "$@" && readonly echo awk
+		| awk 'quoted text' done
+		/usr/bin "$@" sed --verbose readonly "$1" printf
+	$(pwd) $(pwd) --verbose grep "$1" awk --verbose
+/usr/bin ${HOME} "$1" $(pwd) | export
+	test /usr/bin done "$1"
+		echo "$1" && "$@" "$@" | "$@" /usr/bin printf
+	readonly 2>/dev/null echo --verbose
+"$@" cd $(pwd) /usr/bin | "$1" $(pwd) awk export cd /usr/bin awk
+$(pwd) sed cd /usr/bin $(pwd) $(pwd) "$1" sed /usr/bin
+${HOME} grep sed $(pwd) /usr/bin && "$@"
+	sed then ${HOME} ${HOME} -eu then "$@" test ${HOME} readonly
+		"$1" export grep 2>/dev/null
+"$@" grep readonly printf -eu readonly 'quoted text' 2>/dev/null 'quoted text'
+test readonly && x=1 && && printf -eu local printf 2>/dev/null | export 'quoted text'
+	echo /usr/bin x=1 -eu --verbose /usr/bin
+	x=1 && test test | readonly $(pwd) | $(pwd) done sed
+local 'quoted text' "$@" x=1 2>/dev/null cd
+	grep printf 'quoted text' "$1" 'quoted text' | export echo
+	$(pwd) --verbose then echo awk then 2>/dev/null "$@"
+		"$1" sed 'quoted text' printf awk local local awk 'quoted text' "$1"
+printf echo /usr/bin
+	sed sed x=1 -eu 'quoted text' export 'quoted text' "$1" local done
+x=1 awk $(pwd) /usr/bin ${HOME} export
+		$(pwd) export 2>/dev/null then readonly && --verbose printf
+	echo --verbose ${HOME} export x=1 /usr/bin export 'quoted text' -eu done
+"$1" /usr/bin awk $(pwd) grep 2>/dev/null 'quoted text' -eu
+	x=1 && printf "$1" "$@" && test "$@" 'quoted text' &&
+	--verbose echo 2>/dev/null cd local local --verbose export ${HOME}
+		--verbose ${HOME} printf 'quoted text'
+		done x=1 test grep 2>/dev/null echo -eu done | "$@" awk export ${HOME}
+		"$1" test x=1 2>/dev/null -eu export readonly cd &&
+readonly then 'quoted text' readonly "$@" readonly
+	${HOME} local "$@" "$@"
+test printf test test sed echo awk then "$1" "$@" ${HOME} sed --verbose
+		then grep x=1 | local "$1" &&
+done local cd then echo 2>/dev/null "$@" then
+$(pwd) readonly awk 'quoted text' local readonly x=1 2>/dev/null export printf
+		printf echo /usr/bin 2>/dev/null
+	$(pwd) "$1" done awk echo /usr/bin x=1 2>/dev/null
+	| printf x=1 /usr/bin readonly $(pwd) echo
+| $(pwd) "$@" readonly x=1 "$@" 2>/dev/null /usr/bin
+	${HOME} grep test test awk x=1 --verbose $(pwd) then
+	cd -eu done | "$@" echo "$1" $(pwd)
+	x=1 ${HOME} grep --verbose local --verbose --verbose sed grep
+/usr/bin | then $(pwd) --verbose readonly echo && grep /usr/bin -eu
+done grep | printf test local --verbose sed readonly
+sed sed "$1" -eu | "$@" export x=1 local export grep
+	done done 'quoted text' && cd 'quoted text'
+		test echo 2>/dev/null grep -eu ${HOME}
+		printf -eu grep && test -eu
+	local /usr/bin export | /usr/bin cd
+	echo test grep echo -eu export export "$1" awk
+		awk "$1" ${HOME} ${HOME} awk x=1 "$@" echo
+	readonly | "$@" 'quoted text' printf echo "$1"
+	"$1" grep -eu test echo
+		x=1 readonly "$1" readonly "$@"
+	"$@" $(pwd) 'quoted text' cd &&
+${HOME} grep $(pwd) sed awk readonly echo | local "$@"
+		x=1 && "$@" | export --verbose | export awk --verbose x=1 echo local | sed printf
+	sed && printf --verbose "$@" awk local grep printf done test ${HOME} awk
+2>/dev/null awk local | grep --verbose cd
+		-eu "$1" ${HOME} test /usr/bin -eu
+done test | grep x=1 done awk -eu cd done grep cd ${HOME}
+2>/dev/null readonly cd | | x=1 done echo 'quoted text'
+	2>/dev/null x=1 "$@" "$1" test ${HOME} sed
+		'quoted text' --verbose | local readonly done
+	'quoted text' ${HOME} $(pwd)
+		x=1 then "$@" sed /usr/bin 'quoted text' readonly $(pwd)
+readonly local -eu "$1" 2>/dev/null readonly local --verbose
+		$(pwd) $(pwd) 'quoted text'
+readonly awk local --verbose x=1 'quoted text' grep done "$@" test
+	/usr/bin "$1" 2>/dev/null then 2>/dev/null && 'quoted text' local
+test && grep sed test "$1" -eu && echo | awk sed 2>/dev/null
+cd -eu local then cd echo local "$1" echo "$1" x=1 "$@" test export cd --verbose
+	echo awk echo | echo awk
+"$@" local sed -eu echo ${HOME}
+	-eu export awk 2>/dev/null "$@" --verbose 'quoted text' then ${HOME}
+&& readonly awk echo 'quoted text' echo awk awk test cd 'quoted text'
+	cd printf | "$@" export local x=1 --verbose printf "$1" "$1" /usr/bin
+echo $(pwd) ${HOME} then export test "$@" --verbose
+2>/dev/null | $(pwd) awk 'quoted text'
+	echo | printf grep then readonly --verbose
+	--verbose test local ${HOME} sed /usr/bin 2>/dev/null ${HOME} x=1 ${HOME} awk
+"$@" test x=1 echo test --verbose
+local /usr/bin $(pwd) --verbose
+echo "$1" "$1" --verbose echo -eu "$@" test $(pwd) done awk "$1" $(pwd) grep
+		cd ${HOME} x=1 -eu /usr/bin 'quoted text'
+		--verbose sed cd grep "$@" awk echo && awk $(pwd) | -eu ${HOME}
+test sed local local "$1" test | then 2>/dev/null
+		"$1" done printf "$@" awk /usr/bin "$@" && printf
+--verbose $(pwd) test 'quoted text'
+		${HOME} ${HOME} x=1 test printf readonly
+		readonly echo --verbose && cd -eu 2>/dev/null
+	readonly ${HOME} 2>/dev/null 2>/dev/null 2>/dev/null
+--verbose x=1 'quoted text' test local x=1 2>/dev/null cd | cd echo
+awk -eu echo "$@" test && awk export "$1" "$@" sed sed done && x=1
+		local ${HOME} 2>/dev/null printf
+2>/dev/null awk cd test test --verbose sed readonly -eu && readonly x=1 echo
+	echo readonly sed export readonly
+cd then x=1 echo readonly cd echo then done
+readonly then --verbose awk
+		-eu echo sed -eu grep test echo $(pwd) grep
+	test then x=1 ${HOME} -eu --verbose
+grep --verbose 2>/dev/null local grep export | $(pwd) awk | 'quoted text'
+export cd "$@" ${HOME} cd
+		${HOME} -eu export test grep sed test
+	/usr/bin 'quoted text' local -eu x=1 then awk awk "$1" "$1" done x=1 $(pwd) "$@"
+		x=1 sed local grep /usr/bin 2>/dev/null export printf | /usr/bin done && test
+awk grep done test test echo local --verbose done export
+	readonly "$@" x=1 test "$1" -eu done local echo -eu export --verbose
+	awk then -eu 2>/dev/null printf 2>/dev/null then "$1" echo "$@" test cd 2>/dev/null
+"$1" awk "$@" "$@" then then echo | cd cd && printf "$@" then && cd | readonly
+		'quoted text' ${HOME} then $(pwd)
+		x=1 test grep /usr/bin $(pwd) -eu 2>/dev/null sed cd readonly cd
+		| echo readonly 'quoted text' --verbose done ${HOME}
+	cd awk readonly | local -eu -eu awk sed && 2>/dev/null -eu
+	$(pwd) sed sed /usr/bin export echo -eu local
+-eu x=1 echo echo sed local | export grep -eu && grep
+	awk 2>/dev/null grep /usr/bin sed
+	awk && local x=1 $(pwd) local --verbose 'quoted text'
+	local test /usr/bin -eu "$1" cd echo export printf echo && | && -eu 'quoted text'
+	/usr/bin ${HOME} 2>/dev/null printf then x=1 /usr/bin sed echo "$@" export -eu
+		cd --verbose && /usr/bin export grep readonly
+		$(pwd) test cd local cd test local "$1" 2>/dev/null readonly export --verbose
+	--verbose echo $(pwd) done export ${HOME}
+cd | printf | done cd awk test
+		'quoted text' local echo awk printf test 2>/dev/null ${HOME} done
+		grep -eu echo local /usr/bin sed
+export export export done $(pwd) /usr/bin $(pwd) export "$1" readonly
+/usr/bin export echo echo sed 2>/dev/null x=1 grep ${HOME} "$1" -eu printf
+	done readonly printf grep local
+	| -eu test then sed export
+		local && awk grep --verbose 'quoted text' grep "$1" awk ${HOME}
+$(pwd) | x=1 local && "$1" $(pwd) --verbose --verbose --verbose
+		readonly | printf export printf
+		2>/dev/null "$@" && $(pwd) printf grep x=1
+	"$@" 2>/dev/null x=1 export cd grep x=1 -eu test sed readonly x=1 /usr/bin then
+printf printf x=1 done test export && ${HOME}
+	awk x=1 test /usr/bin ${HOME} "$@" local grep $(pwd) $(pwd) ${HOME} 'quoted text'
+		sed --verbose test "$@" -eu grep
+		"$1" && -eu "$1" ${HOME} echo grep --verbose | && "$1" grep then "$@" "$1"
+	--verbose sed | 2>/dev/null echo cd /usr/bin
+--verbose grep 2>/dev/null ${HOME} /usr/bin
+	--verbose "$1" $(pwd) sed done x=1 -eu test then sed -eu $(pwd)
+		| printf "$@" printf export ${HOME} printf "$@" "$1" echo sed readonly 'quoted text'
+		--verbose local export awk export then && 2>/dev/null /usr/bin
+		then test && done test 2>/dev/null export ${HOME} awk done test && export test
+	grep local 'quoted text' echo local awk echo x=1 local
+"$1" 'quoted text' "$1" cd && 'quoted text'
+		test "$@" /usr/bin | $(pwd) /usr/bin "$@" 2>/dev/null
+x=1 | "$@" grep awk grep "$@" then "$@" export | && readonly
+		| /usr/bin test done | readonly -eu 'quoted text' -eu /usr/bin test awk -eu
+cd ${HOME} /usr/bin /usr/bin "$1" "$@" readonly ${HOME} grep sed -eu then export
+$(pwd) local $(pwd) 'quoted text' "$1" "$1" done export echo export
+	| "$1" "$1" sed "$1" | echo local "$@" 2>/dev/null "$1"
+		then grep "$@" /usr/bin "$1" | grep 'quoted text'
+grep done | then /usr/bin local x=1 "$1" &&
+sed --verbose "$1" "$1" sed printf test 2>/dev/null --verbose
+		echo /usr/bin export && | grep 2>/dev/null "$1" grep /usr/bin then
+sed -eu then $(pwd) local
+	2>/dev/null /usr/bin --verbose printf /usr/bin x=1 "$@" test local export
+	"$@" | "$1" grep "$@" /usr/bin $(pwd) then && then
+	grep then echo awk readonly export cd sed 'quoted text'
+then 2>/dev/null echo | done | 'quoted text' awk
+		"$1" test echo cd done "$1" -eu sed grep -eu cd local
+	local grep local test grep echo 'quoted text' "$1" ${HOME} awk awk "$1"
+		"$@" $(pwd) "$1" "$@" -eu readonly then "$@" printf ${HOME}
+	echo | x=1 test --verbose sed grep /usr/bin echo && -eu grep grep | readonly
+		'quoted text' readonly sed $(pwd) | 'quoted text' local
+"$@" "$1" readonly grep 2>/dev/null 2>/dev/null
+	--verbose && "$@" x=1 -eu done -eu then
+	then /usr/bin && cd -eu $(pwd) -eu "$1" readonly
+		export "$1" "$1" echo sed ${HOME} x=1 then 2>/dev/null 2>/dev/null
+		cd --verbose ${HOME} -eu export local local "$1" echo awk then x=1 "$1"
+		2>/dev/null printf local -eu $(pwd) "$@" test "$1" 2>/dev/null && --verbose echo
+		&& then readonly -eu grep test
+	grep awk grep "$1" readonly export cd "$1" --verbose 'quoted text'
+sed $(pwd) export x=1 /usr/bin
+	cd "$1" ${HOME} -eu awk then x=1 "$1" "$@" "$1" done 'quoted text'
+awk local grep -eu done ${HOME}
+		'quoted text' $(pwd) done ${HOME}
+x=1 grep /usr/bin x=1 local -eu cd printf x=1 "$1"
+	"$1" export test 2>/dev/null echo awk readonly
+		cd | | /usr/bin awk "$@" local cd
+grep local export awk -eu --verbose test
+awk test export $(pwd) 'quoted text' | && --verbose readonly | --verbose x=1 x=1
+	x=1 "$1" | && local 2>/dev/null
+		local sed "$@" && /usr/bin done 2>/dev/null $(pwd) && | done
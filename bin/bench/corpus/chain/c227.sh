@@ -0,0 +1,2001 @@
+		${HOME} "$1" "$@" 2>/dev/null --verbose -eu /usr/bin
+/usr/bin echo x=1 sed done
+"$@" test readonly cd done 2>/dev/null $(pwd) cd | sed local -eu $(pwd) then
+--verbose "$1" && grep -eu readonly
+grep local $(pwd) done grep grep printf echo cd
+/usr/bin cd | readonly | export export cd
+-eu x=1 done && "$1" /usr/bin
+		readonly export 2>/dev/null test grep 2>/dev/null cd
+		awk --verbose then echo test then sed "$1" echo 'quoted text' done && ${HOME}
+&& test /usr/bin 'quoted text' readonly then "$1"
+	export grep cd 2>/dev/null test ${HOME}
+		printf /usr/bin echo | --verbose 2>/dev/null
+		$(pwd) test && "$@" --verbose --verbose 2>/dev/null $(pwd) readonly done readonly
+&& --verbose /usr/bin test
+done "$@" 2>/dev/null cd then sed /usr/bin
+"$@" sed 2>/dev/null readonly export export local sed local
+local $(pwd) export then "$@" -eu local then /usr/bin
+	${HOME} local 2>/dev/null --verbose sed local | x=1 x=1 | printf
+		2>/dev/null 2>/dev/null done "$@" ${HOME}
+	awk $(pwd) grep | grep --verbose
+	cd then test then "$@" sed awk $(pwd) 2>/dev/null echo 'quoted text'
+	test "$1" -eu printf local 'quoted text'
+	test awk cd then -eu sed awk | test 2>/dev/null 2>/dev/null readonly
+	"$1" "$@" "$1" | "$@" "$1" export printf ${HOME} --verbose test
+	"$@" test local then awk --verbose
+		local test cd ${HOME} "$1" && $(pwd) x=1 sed local
+		| local grep done sed 'quoted text'
+	/usr/bin sed $(pwd) local printf 'quoted text' "$1" && -eu
+	--verbose test /usr/bin local ${HOME} | test export echo 'quoted text' /usr/bin
+	export /usr/bin x=1 awk $(pwd)
+awk then 2>/dev/null echo then $(pwd) export awk echo test
+${HOME} echo x=1 -eu 'quoted text' export done /usr/bin "$@"
+		"$@" cd && grep then "$1" 2>/dev/null --verbose
+		x=1 "$@" "$@" 'quoted text' local local 2>/dev/null printf local then done
+		grep grep 2>/dev/null done echo "$1" ${HOME}
+		done "$1" 2>/dev/null done | 2>/dev/null
+	readonly /usr/bin done x=1 test "$1" awk local | $(pwd) cd test export local
+		'quoted text' then /usr/bin export grep
+grep local -eu $(pwd) export 'quoted text' awk ${HOME} -eu echo echo awk
+	local 'quoted text' done awk 'quoted text' && -eu cd
+		grep readonly -eu then 2>/dev/null 2>/dev/null
+		| ${HOME} readonly ${HOME} 2>/dev/null
+	cd printf x=1 printf --verbose echo 2>/dev/null echo
+	x=1 "$@" "$@" -eu grep readonly sed cd sed then --verbose sed awk printf done --verbose
+"$1" | $(pwd) export sed
+		printf "$@" done 'quoted text'
+		$(pwd) $(pwd) export && /usr/bin
+export sed "$@" x=1 done 'quoted text'
+-eu test sed x=1 echo "$1" 2>/dev/null -eu "$1" ${HOME} readonly "$1" test local
+		2>/dev/null | | done | 2>/dev/null readonly && ${HOME} printf printf done 2>/dev/null
+		done printf $(pwd) 2>/dev/null "$1" grep then sed done 'quoted text'
+		"$1" "$@" done /usr/bin done /usr/bin -eu
+	$(pwd) cd sed /usr/bin
+	done /usr/bin "$1" --verbose && 2>/dev/null
+awk $(pwd) "$1" 'quoted text'
+		export | -eu sed ${HOME} "$@" sed | "$1" ${HOME} done "$@" awk readonly ${HOME}
+"$@" && sed awk --verbose /usr/bin --verbose
+		grep "$@" export awk ${HOME} "$@" sed -eu then 'quoted text' test | local readonly
+sed done ${HOME} && readonly && grep --verbose echo "$1" x=1 'quoted text'
+		cd printf $(pwd) ${HOME} -eu then test export 2>/dev/null done "$1" printf then
+		| grep grep $(pwd) 2>/dev/null "$@" printf awk 2>/dev/null test printf
+${HOME} printf awk local
+sed | echo 'quoted text' $(pwd) "$@" "$@" -eu export awk test then x=1 $(pwd)
+		-eu printf sed ${HOME} echo export "$@" /usr/bin | readonly then done ${HOME}
+	test sed echo -eu echo done "$@" -eu grep "$1" grep ${HOME}
+	${HOME} ${HOME} x=1 --verbose readonly -eu | --verbose x=1 --verbose then then
+/usr/bin x=1 echo grep done
+${HOME} && && awk then "$1" done readonly sed
+	readonly done /usr/bin cd /usr/bin echo 2>/dev/null done grep
+		--verbose cd local x=1 printf sed test /usr/bin
+/usr/bin "$1" sed -eu printf 'quoted text' awk export
+export 'quoted text' printf "$1"
+		done printf then grep "$1" sed ${HOME} -eu x=1 2>/dev/null then printf --verbose
+		done test sed local test | 'quoted text' readonly awk grep export $(pwd)
+	export test awk $(pwd) done "$1"
+/usr/bin readonly | grep then 'quoted text' export
+/usr/bin && --verbose $(pwd) done -eu grep
+		readonly --verbose | cd -eu && 2>/dev/null awk | done readonly test cd 2>/dev/null
+export 'quoted text' ${HOME} 2>/dev/null 2>/dev/null cd -eu $(pwd) /usr/bin
+	-eu readonly $(pwd) "$@" done echo && awk local 2>/dev/null printf
+		grep then -eu cd --verbose --verbose 2>/dev/null then grep | done -eu ${HOME}
+		2>/dev/null 'quoted text' grep then test ${HOME}
+		readonly export then && readonly $(pwd) printf export $(pwd) echo
+		cd --verbose 2>/dev/null sed "$1" local "$1" sed ${HOME} $(pwd) sed
+		local 'quoted text' awk local
+		test done "$1" local readonly awk 2>/dev/null
+awk done $(pwd) /usr/bin then local echo awk
+	sed ${HOME} --verbose /usr/bin -eu x=1 sed /usr/bin
+		printf test printf | cd 'quoted text' then && readonly
+		then readonly test "$@" "$@" $(pwd)
+		${HOME} $(pwd) sed | | done && $(pwd) 2>/dev/null 'quoted text' -eu | &&
+		echo ${HOME} "$1" then -eu cd x=1 test
+		"$1" awk grep | 'quoted text' x=1 grep test export
+		grep sed 2>/dev/null sed 2>/dev/null done $(pwd) 2>/dev/null test cd awk
+		cd grep test export /usr/bin grep printf sed printf grep x=1 readonly
+	echo | -eu cd x=1 && awk export
+	&& sed x=1 | printf 'quoted text'
+	--verbose 'quoted text' readonly local x=1 local readonly "$1" echo then $(pwd)
+		printf /usr/bin sed --verbose 'quoted text' test
+	-eu local -eu test "$1" grep export cd cd printf -eu grep
+readonly $(pwd) awk sed x=1 grep --verbose
+| awk awk then "$@" done $(pwd) readonly && 'quoted text'
+	${HOME} grep ${HOME} printf test export echo 2>/dev/null sed -eu done sed ${HOME}
+	done echo printf readonly echo test
+done export sed -eu /usr/bin "$1" x=1 grep --verbose /usr/bin
+		grep done cd 2>/dev/null sed echo x=1 "$@"
+awk cd && then -eu x=1 "$@"
+printf --verbose -eu export /usr/bin printf
+/usr/bin && x=1 2>/dev/null /usr/bin printf export
+	$(pwd) 'quoted text' -eu $(pwd) | -eu test export
+cd $(pwd) x=1 ${HOME} awk /usr/bin
+		echo 'quoted text' "$1" "$@" /usr/bin done grep
+	sed awk test done "$1" done test
+		readonly cd "$1" local && "$1" readonly local printf cd x=1 done awk done
+"$@" printf 'quoted text' echo "$@" export done local done awk
+	cd ${HOME} then --verbose sed --verbose grep test awk readonly -eu
+		local && ${HOME} /usr/bin && $(pwd) test test ${HOME} "$@" printf 2>/dev/null
+	cd done 'quoted text' -eu ${HOME} awk
+| "$@" -eu grep readonly 2>/dev/null local printf export -eu cd
+		awk 'quoted text' test --verbose cd -eu test 'quoted text'
+"$@" local "$1" $(pwd) echo echo local readonly $(pwd)
+	2>/dev/null grep ${HOME}
+cd done $(pwd) --verbose then done /usr/bin "$1" --verbose x=1 then sed
+		"$1" local local $(pwd) -eu printf
+	done then && export -eu
+	x=1 ${HOME} "$@" done export /usr/bin --verbose
+		| printf 2>/dev/null -eu 2>/dev/null cd | readonly echo ${HOME}
+"$1" "$@" test --verbose test readonly test local -eu
+	2>/dev/null "$1" cd | cd "$@" export $(pwd) export 2>/dev/null
+		echo | readonly 2>/dev/null ${HOME} local echo $(pwd)
+	cd $(pwd) x=1 readonly | done x=1 2>/dev/null
+2>/dev/null | local x=1 2>/dev/null --verbose | export $(pwd) && "$@"
+cd --verbose | then test ${HOME} cd done 2>/dev/null
+	"$@" cd printf awk awk grep cd then then 2>/dev/null sed 2>/dev/null
+	awk "$1" awk "$@" && x=1 x=1
+	export -eu then ${HOME} $(pwd) ${HOME} ${HOME} readonly
+"$1" local 'quoted text'
+	$(pwd) ${HOME} sed local cd
+	-eu x=1 ${HOME} done export ${HOME} local 'quoted text' sed cd grep | awk test
+		readonly sed export -eu "$@" export | echo && awk awk -eu
+	echo "$1" && echo then done cd local x=1 "$1" x=1 local awk ${HOME}
+/usr/bin && x=1 echo 2>/dev/null 'quoted text'
+	"$1" --verbose $(pwd) awk
+	"$1" grep cd x=1 ${HOME} | export
+	readonly $(pwd) && ${HOME} cd echo
+		"$1" cd | grep $(pwd) then
+	readonly then then sed
+then test done x=1 "$1" grep --verbose $(pwd)
+-eu /usr/bin test 2>/dev/null "$1" x=1 ${HOME} cd "$1" /usr/bin ${HOME} echo
+readonly awk cd --verbose local sed printf ${HOME}
+grep -eu 'quoted text'
+	'quoted text' $(pwd) /usr/bin done "$1" local export then echo export
+	"$1" x=1 sed | | /usr/bin
+x=1 'quoted text' export /usr/bin local cd done --verbose --verbose cd
+		awk && 'quoted text' -eu x=1 test sed then --verbose grep awk test awk readonly
+sed $(pwd) printf | | printf printf test $(pwd) readonly
+		printf --verbose /usr/bin
+		readonly export /usr/bin -eu ${HOME} "$1" awk --verbose x=1 awk printf awk "$1"
+	x=1 cd -eu 2>/dev/null && | done export local awk --verbose
+"$1" $(pwd) printf echo echo sed test 'quoted text' && sed awk then awk readonly
+	| --verbose "$1" local local then -eu 'quoted text' x=1 -eu | "$1"
+	readonly $(pwd) x=1 "$1" 'quoted text' "$1" then ${HOME} ${HOME} -eu "$1" test
+grep export 2>/dev/null 'quoted text' grep test
+done echo export /usr/bin test printf readonly
+		awk "$1" "$1" sed --verbose test ${HOME} "$1" "$@" ${HOME} "$1" /usr/bin export
+		cd awk -eu --verbose 2>/dev/null export
+/usr/bin --verbose | then "$1" awk 2>/dev/null export echo then "$1" $(pwd)
+"$1" --verbose && test $(pwd) | cd printf readonly 2>/dev/null
+then printf printf cd done awk --verbose test $(pwd) test /usr/bin
+local local 'quoted text' x=1 "$@" test "$@" grep export x=1 awk
+2>/dev/null --verbose x=1 "$1" export grep printf $(pwd)
+		awk --verbose cd --verbose test 2>/dev/null "$@" ${HOME}
+cd then echo local 2>/dev/null /usr/bin then grep local 2>/dev/null
+${HOME} "$@" 2>/dev/null --verbose --verbose cd && "$1" &&
+		$(pwd) printf awk -eu ${HOME} then --verbose
+		done export --verbose export printf then 'quoted text' readonly readonly
+		readonly x=1 test readonly sed printf sed printf export && 'quoted text'
+		grep cd | ${HOME} printf readonly cd export 'quoted text' x=1
+		printf printf "$1" grep 2>/dev/null test done 2>/dev/null grep $(pwd)
+		grep grep /usr/bin readonly
+	$(pwd) 2>/dev/null -eu 2>/dev/null "$1" readonly
+		export done 'quoted text' 'quoted text'
+		--verbose 2>/dev/null grep sed -eu grep echo echo /usr/bin done
+$(pwd) ${HOME} local "$1"
+	cd test local | test --verbose grep local "$1" "$1"
+	cd export export ${HOME} $(pwd) printf cd ${HOME} printf
+		local x=1 printf then "$1" cd "$@" 'quoted text' "$1"
+/usr/bin -eu --verbose done
+local 'quoted text' x=1 "$@" test "$@" ${HOME} sed printf
+	| --verbose local 2>/dev/null
+	'quoted text' then --verbose
+${HOME} --verbose "$1" readonly grep readonly grep then awk "$1" printf local
+	"$1" --verbose x=1 /usr/bin --verbose /usr/bin test $(pwd) --verbose export "$@"
+		readonly done /usr/bin ${HOME} export printf cd local ${HOME}
+&& ${HOME} -eu 2>/dev/null x=1 printf
+printf $(pwd) cd awk sed x=1 && /usr/bin grep $(pwd) --verbose cd
+	/usr/bin readonly awk test awk -eu then | $(pwd) readonly $(pwd) "$1"
+	${HOME} sed then cd readonly local then echo grep && test "$1" cd 'quoted text'
+grep awk awk "$@" echo x=1 x=1 echo sed &&
+"$@" "$@" local readonly -eu sed then readonly x=1 awk ${HOME}
+	2>/dev/null export x=1 --verbose "$1" done
+		--verbose "$@" /usr/bin
+	--verbose ${HOME} done 2>/dev/null /usr/bin | | "$@" -eu sed
+		done cd x=1 printf && ${HOME} ${HOME} export --verbose
+${HOME} --verbose $(pwd) ${HOME} sed grep && local sed then then awk "$1" | sed
+	done done done local | sed printf
+	"$1" echo x=1 test grep x=1 test done x=1 local --verbose --verbose awk
+then printf "$1" local cd export $(pwd) $(pwd) awk -eu sed
+cd readonly sed readonly awk test cd x=1 done echo /usr/bin &&
+		readonly "$@" | export 2>/dev/null -eu 2>/dev/null 2>/dev/null cd ${HOME}
+	then /usr/bin test /usr/bin $(pwd) x=1 -eu local then grep
+	export x=1 $(pwd) test export cd && local "$1" done && x=1
+		&& 'quoted text' then test then awk printf local done export awk 2>/dev/null
+awk awk "$@" readonly "$@" then readonly 2>/dev/null
+	"$@" then export "$1" | "$@" "$@" && grep local
+	then "$@" printf "$1" 'quoted text' grep | ${HOME} test
+| test echo $(pwd) sed printf "$@" sed
+readonly export && 'quoted text'
+"$1" test grep then "$@" readonly 2>/dev/null $(pwd) then
+		/usr/bin 'quoted text' | awk ${HOME} awk $(pwd) 2>/dev/null && --verbose
+--verbose -eu 'quoted text' 2>/dev/null local export then $(pwd) |
+x=1 "$@" 2>/dev/null cd echo then local
+echo echo grep sed grep done | "$@"
+	cd "$1" ${HOME} "$1" --verbose local $(pwd) "$@" sed awk "$@" echo awk ${HOME}
+printf sed local awk 2>/dev/null
+	${HOME} "$@" printf sed ${HOME} test sed then cd local 'quoted text'
+x=1 done done | cd 2>/dev/null local
+	| done grep "$1" printf && 'quoted text' grep --verbose
+	done sed "$1" test -eu && awk awk test -eu
+	&& grep printf 2>/dev/null /usr/bin "$@" "$1" 2>/dev/null
+	&& 'quoted text' "$@"
+printf test "$@" --verbose --verbose done echo "$@" ${HOME} 2>/dev/null
+	--verbose awk "$@" printf local sed local | x=1 grep
+		printf 2>/dev/null done test /usr/bin grep --verbose -eu
+		sed grep --verbose done grep readonly ${HOME} && export "$1" && && --verbose
+	grep printf awk "$1" export readonly 2>/dev/null x=1 && echo $(pwd) done
+&& | readonly sed 'quoted text' $(pwd)
+		local | export sed "$1" --verbose
+		sed 'quoted text' 'quoted text' local && awk | local
+		sed -eu printf "$1" x=1 printf --verbose export local "$@" | cd
+done awk 2>/dev/null sed local "$1" && printf readonly awk --verbose export local
+	test grep | local 'quoted text'
+		cd --verbose done && --verbose ${HOME}
+	"$@" "$1" 2>/dev/null readonly export "$1" |
+x=1 sed sed readonly 'quoted text' sed
+	/usr/bin printf "$@" printf cd then printf && $(pwd) 'quoted text'
+	sed local ${HOME} --verbose
+	done "$1" x=1 | cd /usr/bin -eu --verbose cd
+	-eu $(pwd) then /usr/bin x=1 readonly printf "$1"
+	$(pwd) x=1 then ${HOME} grep ${HOME} then x=1 ${HOME} |
+-eu "$1" 2>/dev/null --verbose
+	"$@" readonly echo | && awk sed cd printf then grep printf export | x=1
+${HOME} awk --verbose -eu grep readonly ${HOME} --verbose test
+echo grep awk /usr/bin && $(pwd) 'quoted text' readonly &&
+		local -eu "$@" grep /usr/bin "$1" 'quoted text' grep awk echo | x=1 --verbose
+	local --verbose /usr/bin "$@" cd test
+		$(pwd) grep done $(pwd) then cd | grep ${HOME} grep cd printf
+test 2>/dev/null $(pwd) printf | export cd "$@" echo sed && 2>/dev/null
+printf grep echo && 2>/dev/null export echo
+	test ${HOME} ${HOME} done $(pwd) grep /usr/bin | "$@" printf "$@"
+	&& grep ${HOME} cd printf "$1" readonly
+grep sed export && $(pwd) --verbose 'quoted text' ${HOME} $(pwd)
+	local x=1 x=1 /usr/bin
+		printf $(pwd) awk printf 2>/dev/null readonly "$@" local done | 'quoted text' ${HOME}
+		awk awk awk test done /usr/bin
+"$1" 'quoted text' echo 'quoted text' export "$@" echo /usr/bin grep test cd x=1
+2>/dev/null 'quoted text' printf ${HOME} cd -eu
+	-eu sed done export sed ${HOME} local "$@" | -eu awk local sed |
+		| local ${HOME} done | && /usr/bin 2>/dev/null /usr/bin then then
+--verbose echo "$1" export -eu ${HOME} && && --verbose
+	then -eu -eu "$@" local | awk $(pwd) grep "$@" 'quoted text'
+then $(pwd) 'quoted text' && then
+		done local readonly test | /usr/bin -eu echo cd "$1"
+		2>/dev/null readonly "$@" "$1" /usr/bin sed done | $(pwd) 'quoted text' $(pwd)
+	sed "$@" -eu done readonly sed
+		sed local "$@" local local -eu echo echo sed then cd done readonly done grep
+		&& x=1 --verbose -eu sed -eu grep "$1" grep && $(pwd) grep
+awk sed /usr/bin local then local "$1" printf then readonly test cd readonly /usr/bin
+		--verbose 'quoted text' | export local /usr/bin
+		&& cd done sed "$1" export | printf x=1 export --verbose $(pwd) 'quoted text'
+		cd x=1 && --verbose readonly export --verbose --verbose
+cd grep ${HOME} test printf test $(pwd) $(pwd) export x=1
+echo printf 'quoted text' awk then -eu x=1
+test ${HOME} done && $(pwd) | readonly /usr/bin "$@" ${HOME} awk "$1" awk
+	sed then && awk | export awk /usr/bin x=1 echo 2>/dev/null /usr/bin -eu
+	x=1 sed 'quoted text' x=1 printf
+printf ${HOME} $(pwd) | printf --verbose "$@" sed /usr/bin
+	test test | $(pwd) awk test awk 'quoted text' $(pwd) done echo &&
+	'quoted text' ${HOME} --verbose -eu ${HOME} echo "$1" 2>/dev/null $(pwd) /usr/bin
+	"$@" x=1 | && readonly && cd test
+	&& ${HOME} "$@" ${HOME} | 2>/dev/null --verbose $(pwd) "$1" x=1
+	sed --verbose "$1" test done local
+local 'quoted text' test echo && done ${HOME} x=1
+		-eu test test ${HOME} grep then --verbose grep /usr/bin | ${HOME}
+	echo x=1 && "$1" x=1 ${HOME} export ${HOME}
+	| -eu "$1" readonly printf readonly readonly "$1" done x=1
+		echo x=1 readonly --verbose readonly /usr/bin $(pwd) test "$@" "$@" /usr/bin
+'quoted text' | "$1" export cd echo export "$@" printf test
+		printf cd --verbose "$@" grep then && printf
+export cd then echo cd done ${HOME} "$@" "$@" awk
+		"$@" export printf && cd sed $(pwd) "$1"
+	x=1 "$1" --verbose --verbose /usr/bin sed test done 'quoted text'
+'quoted text' cd $(pwd) | awk 2>/dev/null cd | "$1"
+cd 2>/dev/null $(pwd) $(pwd) $(pwd) cd export $(pwd) test "$@" $(pwd) ${HOME}
+	${HOME} | test test --verbose printf -eu /usr/bin test then
+"$1" "$1" -eu "$@" |
+	done test "$1" 2>/dev/null "$@" grep cd local --verbose readonly 'quoted text'
+	grep local local x=1 echo --verbose "$@" 'quoted text' 'quoted text' done && ${HOME}
+	-eu ${HOME} x=1 "$1" done "$@" && 'quoted text' -eu
+echo readonly then $(pwd) readonly 'quoted text'
+		echo sed $(pwd) --verbose grep awk && -eu sed -eu 2>/dev/null cd "$@" grep
+	"$1" export test echo 2>/dev/null 2>/dev/null | && cd -eu
+		test echo x=1 "$1" cd grep readonly grep "$1"
+${HOME} local /usr/bin sed && sed sed grep 2>/dev/null -eu sed readonly
+2>/dev/null export -eu | | 'quoted text' then x=1 2>/dev/null
+	done awk cd local x=1 awk local && "$@" test | 'quoted text' | cd
+	x=1 printf /usr/bin export x=1 2>/dev/null
+		"$@" printf x=1 sed sed awk && $(pwd) local grep "$1" export ${HOME}
+	sed | done local cd echo echo local printf test awk
+		printf grep --verbose $(pwd) test readonly
+test --verbose done cd test awk printf then -eu then grep /usr/bin
+${HOME} test 2>/dev/null --verbose echo
+	sed && test local sed done && 'quoted text' $(pwd) 'quoted text'
+&& awk test "$1" 2>/dev/null ${HOME}
+	&& grep | then --verbose "$@" --verbose 'quoted text'
+'quoted text' $(pwd) sed readonly 2>/dev/null done printf --verbose && sed grep
+readonly readonly done export local readonly
+$(pwd) readonly then $(pwd) readonly /usr/bin
+		then /usr/bin printf "$1" 2>/dev/null 'quoted text' -eu -eu test
+grep "$1" printf cd test export -eu --verbose "$1" export readonly -eu grep printf
+		$(pwd) printf test local -eu export done ${HOME} x=1 cd "$@" then $(pwd)
+		echo printf 'quoted text' then $(pwd) done /usr/bin awk cd $(pwd) local 'quoted text'
+	awk awk x=1 "$@" $(pwd) | export printf && readonly printf echo 2>/dev/null local
+		--verbose x=1 "$1" grep 2>/dev/null
+-eu test export then
+	${HOME} done test then 'quoted text' cd -eu 2>/dev/null test local done
+--verbose awk cd done test "$@" echo then readonly "$1"
+	$(pwd) readonly export --verbose | cd printf local 2>/dev/null local /usr/bin "$1"
+sed | done && x=1 cd export echo cd --verbose export
+		export "$@" "$@" "$@" --verbose
+"$1" "$1" /usr/bin $(pwd) 'quoted text' sed sed
+	local then test sed export readonly $(pwd) -eu -eu
+printf && awk "$1" /usr/bin grep "$@" echo
+		then "$@" | "$@" x=1 "$@" "$1" | done cd awk $(pwd) sed -eu && "$1" /usr/bin
+	'quoted text' echo ${HOME} cd --verbose $(pwd) --verbose sed "$1" done
+		export -eu grep -eu --verbose /usr/bin local echo ${HOME}
+		"$1" "$@" x=1 test export grep then 'quoted text'
+		cd 2>/dev/null echo $(pwd) grep 2>/dev/null -eu --verbose
+		export readonly "$1" printf printf test | ${HOME} 'quoted text' readonly
+2>/dev/null "$1" /usr/bin "$1" "$1"
+	local "$@" local && x=1 $(pwd) echo
+"$@" grep local "$1" $(pwd) cd test then then -eu && sed x=1 2>/dev/null echo
+		| test ${HOME} test cd readonly
+		$(pwd) cd ${HOME} grep 'quoted text' ${HOME} $(pwd)
+		sed sed $(pwd) echo /usr/bin
+'quoted text' $(pwd) x=1 "$1" grep 'quoted text'
+/usr/bin /usr/bin done && printf readonly && echo done done export
+	export grep "$@" -eu export
+sed 2>/dev/null --verbose --verbose && $(pwd) sed local /usr/bin printf
+		test && 'quoted text' local
+		printf echo "$1" local ${HOME} $(pwd)
+		done $(pwd) local 2>/dev/null | $(pwd) $(pwd)
+	done awk | done --verbose && sed awk test test printf then echo "$@" --verbose
+		cd test | local sed 2>/dev/null printf
+		local grep && echo awk | $(pwd) && --verbose --verbose awk /usr/bin && --verbose
+${HOME} test export readonly
+		echo ${HOME} done then export
+		readonly x=1 printf "$1" ${HOME} 'quoted text'
+export "$1" local ${HOME} readonly x=1 --verbose "$1" "$@" cd readonly 'quoted text'
+	readonly grep && grep cd $(pwd) sed echo sed sed
+		grep done sed 2>/dev/null $(pwd)
+		echo 2>/dev/null sed ${HOME}
+printf 'quoted text' x=1 then export then local -eu --verbose local sed
+		'quoted text' awk && cd &&
+echo 'quoted text' echo "$@" ${HOME} export
+$(pwd) | 2>/dev/null local then 'quoted text'
+sed -eu x=1 && -eu grep
+'quoted text' ${HOME} && then && then grep export test readonly
+		printf "$@" ${HOME} --verbose
+	-eu printf && export grep --verbose && x=1 x=1 $(pwd) ${HOME} "$1" cd
+${HOME} echo "$1" $(pwd) awk
+cd "$@" cd echo 'quoted text' sed awk /usr/bin "$1" x=1 local done awk
+	readonly echo readonly grep awk
+readonly readonly /usr/bin then | "$@"
+then 2>/dev/null "$@" done | awk /usr/bin x=1 printf readonly
+awk "$@" -eu $(pwd) then 'quoted text' /usr/bin
+| && && printf then grep
+	-eu 2>/dev/null readonly echo echo
+2>/dev/null sed "$1" export printf local ${HOME}
+printf done cd ${HOME} printf -eu local test export | | 'quoted text'
+&& $(pwd) 2>/dev/null readonly 'quoted text'
+test "$@" readonly ${HOME} sed && $(pwd) then done cd -eu then
+		--verbose grep then readonly test
+	"$@" test 2>/dev/null "$@" then && readonly ${HOME}
+$(pwd) test -eu readonly cd grep echo x=1 -eu --verbose $(pwd) 2>/dev/null
+		'quoted text' && sed export echo &&
+	readonly "$1" awk export local -eu awk sed grep cd "$@" 'quoted text'
+		/usr/bin ${HOME} "$@" readonly grep printf /usr/bin
+		test "$1" grep export x=1 then 2>/dev/null grep cd "$@" then -eu "$@" "$@"
+		grep awk grep 2>/dev/null test awk x=1 test sed $(pwd)
+2>/dev/null /usr/bin "$1" export 'quoted text' x=1 local "$@" 'quoted text'
+	readonly printf ${HOME} grep 'quoted text' export x=1
+	cd awk "$1" grep -eu awk ${HOME} "$1" | local ${HOME} "$1" done grep local
+		$(pwd) printf echo done done "$1" 'quoted text' -eu -eu -eu done 2>/dev/null
+	printf ${HOME} cd "$@" "$@" export
+	| then awk | ${HOME} $(pwd) export test "$@" "$@"
+cd printf export readonly printf | "$1" $(pwd)
+sed done 2>/dev/null | --verbose cd -eu printf $(pwd)
+	local "$@" "$1" grep -eu "$1" && x=1 "$1" && done then echo | "$1"
+	--verbose echo readonly cd ${HOME}
+		export printf export cd ${HOME} /usr/bin readonly $(pwd) echo "$@"
+x=1 printf local -eu test
+	then echo test printf test && awk /usr/bin
+"$@" local cd awk ${HOME} grep x=1 grep grep printf sed awk "$@" readonly
+'quoted text' -eu 2>/dev/null "$@" printf -eu "$@" cd ${HOME} |
+	${HOME} then cd --verbose echo "$1" grep | readonly export 'quoted text'
+		test x=1 export "$1" grep export local test ${HOME} ${HOME} cd -eu
+/usr/bin echo "$@" done "$1" done "$@" test local -eu
+	'quoted text' sed $(pwd) echo /usr/bin test
+/usr/bin 2>/dev/null printf -eu 'quoted text'
+		"$@" /usr/bin x=1 -eu cd grep 'quoted text' test echo x=1
+		-eu $(pwd) --verbose && readonly 2>/dev/null
+		sed && then then ${HOME} "$1" ${HOME}
+		--verbose then | 2>/dev/null
+'quoted text' echo --verbose && /usr/bin
+		/usr/bin -eu export | local x=1 done -eu "$1" printf cd && ${HOME} sed then
+	printf $(pwd) grep --verbose "$@" done grep
+	cd local local && $(pwd) echo "$1" cd --verbose awk
+	--verbose ${HOME} --verbose "$@" then /usr/bin
+readonly -eu | --verbose
+$(pwd) cd test done sed cd -eu printf local echo /usr/bin export $(pwd) echo printf
+	"$1" cd && done --verbose -eu echo $(pwd)
+		$(pwd) awk grep 'quoted text' then x=1 readonly readonly
+export export 'quoted text' test cd
+'quoted text' "$@" printf "$@"
+x=1 'quoted text' readonly ${HOME} export export done grep
+	echo 'quoted text' ${HOME} cd 'quoted text' 'quoted text' local 2>/dev/null
+	'quoted text' test "$@" | --verbose 2>/dev/null x=1 -eu printf --verbose |
+		x=1 readonly awk ${HOME} $(pwd) readonly
+	test 'quoted text' "$@" cd cd grep | "$1" && then --verbose "$@" ${HOME} -eu
+		then "$@" local printf printf grep -eu
+		echo | local -eu $(pwd) local printf
+		"$@" ${HOME} printf export readonly readonly /usr/bin export $(pwd) awk $(pwd) sed
+	cd $(pwd) /usr/bin printf grep export
+| sed 2>/dev/null /usr/bin /usr/bin --verbose $(pwd) $(pwd)
+test ${HOME} x=1 test echo awk sed awk export "$1" -eu grep 'quoted text'
+		cd 'quoted text' local && test x=1 "$@" printf "$1" cd 'quoted text'
+	test test sed -eu $(pwd) $(pwd) local && /usr/bin ${HOME}
+	cd done /usr/bin | $(pwd) x=1 echo export sed local x=1
+		2>/dev/null ${HOME} -eu -eu | -eu
+		${HOME} done 2>/dev/null $(pwd) export /usr/bin cd awk sed
+		echo /usr/bin grep done cd readonly 2>/dev/null && local --verbose "$1" cd -eu
+	export | "$1" local --verbose local then echo "$1"
+	export | /usr/bin ${HOME} --verbose sed ${HOME} then awk export awk awk local
+x=1 readonly $(pwd) ${HOME} --verbose
+	cd x=1 "$1" done local done
+then /usr/bin test --verbose 'quoted text'
+then cd 2>/dev/null -eu test && cd printf /usr/bin && printf sed printf
+"$1" awk && -eu grep --verbose grep done awk
+		local test /usr/bin "$@" /usr/bin && awk -eu then ${HOME} local
+		"$@" -eu "$1" $(pwd) cd
+	$(pwd) --verbose printf "$1" $(pwd) cd done ${HOME} "$1" test then
+	export readonly done x=1 export "$@" awk "$@" printf
+		sed readonly | --verbose sed -eu --verbose
+		echo "$1" export && export --verbose --verbose "$1" "$@" x=1 echo $(pwd)
+		done cd /usr/bin && printf
+		| export -eu 2>/dev/null 2>/dev/null "$@" awk awk 'quoted text' ${HOME}
+		"$1" awk then done done sed --verbose
+		echo $(pwd) echo export local "$@" echo && local && local "$1" && &&
+		awk test $(pwd) test "$@" ${HOME} grep /usr/bin "$@" then test "$1" && "$1"
+		${HOME} | /usr/bin /usr/bin
+	${HOME} then && sed "$@" echo 'quoted text' x=1 export -eu local "$1"
+	2>/dev/null sed done /usr/bin done 'quoted text' $(pwd) $(pwd) awk
+	| --verbose "$1" echo local readonly -eu export echo local
+/usr/bin | cd 'quoted text' ${HOME} 2>/dev/null && sed ${HOME} -eu ${HOME}
+	then "$@" echo grep -eu echo x=1 test 2>/dev/null "$@"
+'quoted text' test done && 'quoted text' 'quoted text' x=1 x=1 local test && "$1"
+	${HOME} 2>/dev/null && awk | sed $(pwd) "$@" sed && && && 'quoted text'
+done test x=1 /usr/bin --verbose -eu readonly grep
+		${HOME} readonly test x=1 readonly 2>/dev/null readonly export sed "$1"
+	${HOME} "$@" && /usr/bin
+$(pwd) 'quoted text' ${HOME} export cd done 2>/dev/null test awk readonly
+		"$1" ${HOME} export sed "$1" readonly
+		echo done sed awk ${HOME} /usr/bin echo
+		printf 'quoted text' 'quoted text' ${HOME} "$@"
+	2>/dev/null printf | test cd test | sed readonly x=1
+	'quoted text' | | echo -eu --verbose $(pwd) readonly
+		export local test ${HOME} $(pwd)
+		${HOME} -eu cd x=1 test ${HOME}
+	${HOME} 2>/dev/null test $(pwd) 2>/dev/null
+printf | ${HOME} 2>/dev/null $(pwd) cd -eu
+		awk /usr/bin ${HOME} && done echo readonly | printf "$@" -eu ${HOME}
+printf 2>/dev/null 2>/dev/null export --verbose -eu
+local then 2>/dev/null $(pwd) cd then readonly -eu && then ${HOME} local
+test "$@" 2>/dev/null
+		"$@" cd printf awk --verbose sed -eu echo
+	readonly 'quoted text'
+		/usr/bin /usr/bin --verbose | | ${HOME} done then
+		"$@" "$@" | sed cd echo grep
+grep sed cd test sed && cd grep && export $(pwd) 'quoted text'
+grep x=1 2>/dev/null test && 'quoted text' done ${HOME}
+grep done x=1 printf | "$1" "$@" grep local export awk cd cd ${HOME} cd grep --verbose
+	| && local | -eu ${HOME} 2>/dev/null test done -eu sed done awk x=1
+${HOME} "$1" /usr/bin /usr/bin
+	readonly readonly | grep && readonly
+		"$@" ${HOME} cd local test
+echo 2>/dev/null local test sed -eu cd 2>/dev/null /usr/bin $(pwd) sed echo
+		-eu -eu done local 'quoted text' --verbose --verbose 2>/dev/null export "$@" cd
+		-eu && ${HOME} cd awk $(pwd) grep
+	-eu readonly x=1 /usr/bin done printf printf sed readonly then local readonly
+	2>/dev/null -eu printf awk grep --verbose export sed export
+test ${HOME} printf /usr/bin 2>/dev/null test readonly then ${HOME} export echo
+grep test | x=1 $(pwd) sed | grep printf done "$@" |
+		export x=1 local awk test -eu ${HOME} | export then printf
+	"$1" | done 2>/dev/null readonly && printf "$@" local printf 'quoted text'
+sed echo grep then $(pwd) printf grep test "$1" 'quoted text' export
+	done $(pwd) && local awk "$@" awk awk | --verbose "$@" sed
+	echo awk "$1" test export x=1 | printf printf
+	&& && grep then sed | grep cd 2>/dev/null then done "$1" && readonly
+		"$1" /usr/bin test then "$1" "$1" "$@" done
+	x=1 cd /usr/bin sed && readonly ${HOME} "$@"
+		--verbose /usr/bin local test grep
+printf | readonly echo "$1" "$@"
+"$@" printf $(pwd) test --verbose
+		${HOME} x=1 | "$@" sed sed 'quoted text'
+sed "$1" && "$@" local done x=1 done ${HOME} &&
+		x=1 done -eu export x=1 | 2>/dev/null done local 'quoted text'
+export export export -eu done | export -eu "$1" /usr/bin test ${HOME} then
+test local echo test local awk grep cd ${HOME} ${HOME} x=1 awk export
+		&& && printf "$@" done "$1"
+		export printf sed "$1" 'quoted text' cd ${HOME}
+	export local export ${HOME} --verbose
+-eu "$1" readonly x=1 && awk -eu |
+	awk echo $(pwd) awk 2>/dev/null "$@"
+'quoted text' $(pwd) | then x=1 local $(pwd) -eu --verbose | cd -eu
+	test $(pwd) awk printf test readonly echo /usr/bin done
+	export x=1 echo ${HOME}
+test -eu printf printf -eu local export 'quoted text'
+		then 'quoted text' sed "$@" echo local "$1" sed export sed /usr/bin local
+grep /usr/bin $(pwd) x=1 cd sed then grep grep && sed readonly
+"$@" "$@" sed "$@" sed test done sed local 'quoted text' 'quoted text'
+	grep 2>/dev/null sed /usr/bin $(pwd) 'quoted text' 'quoted text' awk "$@" done
+		printf -eu 'quoted text' "$@" sed 'quoted text' -eu ${HOME} sed grep local done
+"$1" --verbose ${HOME} 'quoted text' "$1" $(pwd) then x=1 /usr/bin
+&& then -eu && echo x=1 cd $(pwd) local done readonly printf 'quoted text' x=1
+| | $(pwd) then $(pwd) cd sed awk x=1 done
+	2>/dev/null ${HOME} printf "$1" 'quoted text' printf $(pwd) x=1 printf readonly
+		-eu 2>/dev/null --verbose | --verbose &&
+$(pwd) | readonly sed 2>/dev/null
+		printf readonly local grep "$1" /usr/bin test --verbose echo awk sed printf
+local /usr/bin /usr/bin --verbose
+		--verbose 'quoted text'
+		awk local awk readonly done sed /usr/bin local "$@" cd
+		"$1" awk awk x=1 2>/dev/null -eu readonly grep cd /usr/bin
+local printf export echo grep export sed grep export readonly
+done local /usr/bin echo "$@" -eu then "$@" /usr/bin
+"$@" done done "$@" $(pwd) printf cd
+test --verbose $(pwd) 'quoted text' "$1"
+&& done printf --verbose /usr/bin | x=1 /usr/bin awk x=1 echo local 2>/dev/null
+readonly readonly export
+	test done done test local done "$@" &&
+		echo export "$@" printf "$1" then
+	awk $(pwd) /usr/bin test
+readonly local printf 2>/dev/null -eu "$@" test echo cd "$1" sed test --verbose
+awk --verbose export --verbose
+		$(pwd) $(pwd) -eu awk done export echo cd $(pwd) --verbose
+		echo sed $(pwd) && grep
+		'quoted text' && cd "$1" -eu local sed $(pwd) -eu local --verbose
+echo /usr/bin && grep echo /usr/bin -eu $(pwd)
+${HOME} sed "$@" grep
+		then cd ${HOME} 2>/dev/null 2>/dev/null then "$1" 2>/dev/null
+		test "$1" 2>/dev/null "$@" && --verbose then
+		"$1" "$@" -eu awk $(pwd) "$1" test grep ${HOME} cd printf printf $(pwd)
+	export /usr/bin "$1" local 2>/dev/null --verbose cd
+x=1 2>/dev/null test echo test $(pwd) readonly
+	export grep then done local echo local echo /usr/bin "$@" local printf then
+readonly --verbose printf cd && readonly 'quoted text'
+"$@" $(pwd) | ${HOME} echo awk printf awk grep cd done printf
+		cd local grep --verbose sed && 2>/dev/null x=1 sed x=1 test
+		readonly awk then readonly
+		&& x=1 then 2>/dev/null --verbose
+	"$1" then then /usr/bin --verbose
+		"$@" | then /usr/bin x=1 done
+grep "$@" x=1 && "$@" 'quoted text' grep /usr/bin
+test --verbose echo ${HOME} 2>/dev/null export test
+		$(pwd) export $(pwd) cd && test local sed printf sed printf test "$1" && "$1"
+done 2>/dev/null --verbose -eu done sed readonly /usr/bin "$@" ${HOME} "$1"
+	${HOME} x=1 cd ${HOME} done then $(pwd) /usr/bin sed then export 2>/dev/null printf
+		test $(pwd) $(pwd) test /usr/bin sed 2>/dev/null
+		| export x=1 | /usr/bin grep test export | ${HOME} | 2>/dev/null readonly "$@" grep
+	--verbose "$@" cd cd $(pwd) cd -eu readonly 2>/dev/null x=1 export
+		local "$@" $(pwd) test $(pwd) local export awk --verbose ${HOME}
+		sed ${HOME} && printf $(pwd) /usr/bin x=1 awk cd "$1" sed && 'quoted text'
+		sed ${HOME} 'quoted text' awk export test then
+		--verbose 2>/dev/null 'quoted text' x=1
+		readonly export test $(pwd) --verbose done
+then && test ${HOME} 'quoted text'
+		&& sed "$1" | | 2>/dev/null 2>/dev/null readonly /usr/bin
+	then awk done printf awk --verbose grep export local cd x=1 then grep echo
+'quoted text' $(pwd) echo done ${HOME} $(pwd) 'quoted text' --verbose --verbose
+| 2>/dev/null then cd /usr/bin done && done 2>/dev/null
+	2>/dev/null -eu local done cd
+export "$@" local awk --verbose printf local 2>/dev/null done "$@" then /usr/bin
+	&& "$@" grep then 2>/dev/null --verbose grep --verbose
+		export then /usr/bin readonly cd /usr/bin && echo $(pwd) export $(pwd)
+		-eu | local && cd awk test ${HOME} test -eu | ${HOME} x=1
+	$(pwd) sed awk sed awk printf sed then -eu -eu test
+&& x=1 2>/dev/null done
+grep x=1 grep cd "$1" sed -eu ${HOME} 2>/dev/null cd local "$1" sed -eu done 2>/dev/null
+	echo test grep echo printf | awk /usr/bin grep then echo $(pwd) --verbose
+		"$1" grep sed --verbose then awk x=1 local export -eu then 2>/dev/null
+${HOME} 'quoted text' && done echo
+| then 2>/dev/null --verbose
+cd x=1 sed printf | ${HOME} "$1" 'quoted text' && ${HOME} readonly cd done
+	export -eu 'quoted text' --verbose test echo | done grep grep
+		&& ${HOME} 2>/dev/null /usr/bin grep
+		awk 'quoted text' grep done 2>/dev/null "$1" sed &&
+	grep 'quoted text' then grep /usr/bin local -eu local echo
+		'quoted text' local --verbose /usr/bin awk awk awk --verbose printf export
+cd "$@" done done awk awk "$@" 'quoted text' echo
+	--verbose "$@" awk -eu readonly /usr/bin x=1 readonly sed --verbose done -eu
+grep local printf -eu sed echo x=1 test
+		awk local done && printf /usr/bin /usr/bin
+	then | $(pwd) sed --verbose | printf done sed readonly
+	"$@" -eu ${HOME} -eu ${HOME}
+		then "$@" $(pwd) readonly /usr/bin then export --verbose && sed
+		'quoted text' printf awk sed readonly
+		echo done ${HOME} test --verbose awk /usr/bin /usr/bin
+	'quoted text' done done echo x=1 "$1" printf | --verbose done
+		readonly -eu 2>/dev/null -eu -eu grep awk cd $(pwd) $(pwd)
+	then ${HOME} awk then 2>/dev/null /usr/bin
+$(pwd) ${HOME} done cd $(pwd) $(pwd) then cd "$@" export
+		'quoted text' awk then echo $(pwd) $(pwd) done
+-eu && then echo export test -eu 'quoted text'
+	local --verbose 'quoted text' "$@" "$1" done | /usr/bin readonly
+	cd grep printf cd -eu printf done 'quoted text'
+${HOME} --verbose local x=1 'quoted text'
+		| grep | cd 2>/dev/null -eu --verbose cd 2>/dev/null echo
+	&& grep && done readonly local && "$@" $(pwd) export
+		&& x=1 then test test /usr/bin
+	"$1" sed then local export 'quoted text' 'quoted text' && then /usr/bin
+printf then sed local printf $(pwd) --verbose export printf readonly echo
+$(pwd) local local /usr/bin | then -eu awk /usr/bin
+	${HOME} then ${HOME} "$1" sed --verbose awk && local echo 2>/dev/null
+		local | local echo grep done 2>/dev/null --verbose
+		awk test export "$1" ${HOME} "$1" sed ${HOME} export awk local x=1 && cd sed
+	grep awk /usr/bin 'quoted text' done -eu
+	-eu done x=1 local "$1" $(pwd) /usr/bin readonly --verbose | $(pwd) x=1 export
+	awk x=1 "$1" echo export 'quoted text' then ${HOME} local sed x=1
+	local echo 2>/dev/null done 2>/dev/null 'quoted text' && x=1 ${HOME}
+		cd 'quoted text' test echo
+		--verbose local ${HOME} printf readonly -eu
+echo grep "$@" 2>/dev/null $(pwd) local &&
+grep -eu ${HOME} then local /usr/bin "$1" echo done | | /usr/bin export export
+	awk $(pwd) 'quoted text' test awk test cd echo "$1" printf | | done then export
+awk $(pwd) -eu -eu awk /usr/bin grep export awk ${HOME} export x=1 ${HOME}
+done then /usr/bin ${HOME} sed local | --verbose cd local cd
+	readonly local && done export done
+		export printf "$1" export x=1
+		$(pwd) done readonly echo ${HOME} export done grep "$1" /usr/bin readonly awk ${HOME}
+"$@" grep 'quoted text' echo then "$1" then cd then done $(pwd) 2>/dev/null
+x=1 printf readonly then printf | | cd cd ${HOME} ${HOME} local test -eu cd 'quoted text'
+		"$@" $(pwd) "$@" done local readonly sed cd | export local /usr/bin | && echo then
+	local 2>/dev/null 'quoted text' cd
+		export x=1 readonly ${HOME} 'quoted text' test 2>/dev/null sed
+	'quoted text' grep 2>/dev/null sed 'quoted text' 'quoted text'
+	$(pwd) -eu 'quoted text' local export --verbose
+	"$1" ${HOME} readonly printf /usr/bin grep awk
+'quoted text' --verbose && "$1" x=1 then echo "$1"
+		sed printf local x=1 printf "$1" test --verbose
+	$(pwd) sed /usr/bin -eu awk cd readonly printf printf && $(pwd) -eu done
+	done local -eu sed sed ${HOME} ${HOME}
+${HOME} sed cd -eu then --verbose "$1" /usr/bin then
+		${HOME} "$@" test done && "$@" printf done
+		"$1" x=1 /usr/bin -eu "$1" readonly
+		'quoted text' done 2>/dev/null ${HOME} -eu test awk
+printf done echo x=1 x=1 then echo 2>/dev/null
+	${HOME} | cd test cd test echo "$@" &&
+	"$@" -eu readonly | x=1 $(pwd) && && local /usr/bin --verbose
+	test --verbose readonly printf $(pwd)
+		sed x=1 --verbose cd 2>/dev/null 'quoted text'
+	/usr/bin 'quoted text' local awk grep awk local export cd sed
+		/usr/bin done sed grep grep -eu "$@" export test $(pwd) "$1" readonly sed done
+	--verbose printf ${HOME} then "$1" then grep "$@"
+test | "$@" | printf x=1 'quoted text'
+then then printf && 2>/dev/null && echo readonly cd sed $(pwd) done
+		'quoted text' echo export ${HOME} -eu readonly |
+echo /usr/bin --verbose awk 2>/dev/null readonly "$1" && test 2>/dev/null
+		echo && printf printf 'quoted text' ${HOME} echo then grep grep cd then
+	cd readonly && -eu printf grep $(pwd) done echo 'quoted text'
+		&& x=1 'quoted text' export "$@" $(pwd) cd 2>/dev/null readonly
+	local test "$@" /usr/bin export "$1" export grep cd cd awk -eu
+		readonly | readonly cd printf | /usr/bin "$@" printf local awk local /usr/bin echo
+	grep grep -eu sed $(pwd) x=1 awk awk echo -eu done sed cd /usr/bin cd /usr/bin
+	'quoted text' printf /usr/bin x=1 local export --verbose ${HOME}
+/usr/bin 2>/dev/null grep --verbose local echo -eu export readonly
+cd awk "$1" sed 'quoted text' then "$@" && "$1" 'quoted text'
+		$(pwd) ${HOME} test && "$1" cd 'quoted text' echo ${HOME}
+		"$@" 2>/dev/null | 'quoted text' readonly x=1 awk grep local done readonly 2>/dev/null
+	done sed ${HOME} "$@" echo sed cd ${HOME} $(pwd) |
+readonly "$1" sed -eu test readonly
+		export printf sed ${HOME} done --verbose local --verbose local test -eu
+	readonly -eu test "$1" then x=1 echo ${HOME} $(pwd) --verbose
+x=1 /usr/bin then echo cd | printf done -eu cd test $(pwd) test "$@" local --verbose
+then "$1" $(pwd) --verbose | | done then grep $(pwd) "$@" awk
+readonly $(pwd) 'quoted text' | "$@"
+		done echo 2>/dev/null 'quoted text'
+	export ${HOME} local /usr/bin sed && local export local awk
+	"$1" local --verbose then then awk -eu sed
+		'quoted text' $(pwd) x=1 done sed /usr/bin then then
+echo --verbose readonly ${HOME} x=1 test readonly /usr/bin local
+	| sed ${HOME} x=1 2>/dev/null && readonly --verbose -eu readonly
+	awk export "$@" cd ${HOME} done printf sed readonly "$@" echo ${HOME} printf
+		export && "$@" cd echo -eu then awk x=1
+	test then "$1" then printf x=1 then
+		-eu "$@" "$1" export 'quoted text' /usr/bin x=1 && 2>/dev/null
+awk 'quoted text' cd /usr/bin $(pwd) then local 2>/dev/null
+		test echo 2>/dev/null 2>/dev/null /usr/bin local echo echo sed grep then 2>/dev/null
+		| then /usr/bin grep /usr/bin
+&& x=1 export /usr/bin -eu local done test 2>/dev/null
+	sed x=1 printf test "$1" -eu &&
+	echo && awk x=1 printf
+	-eu readonly 2>/dev/null then then awk x=1 'quoted text' test sed -eu
+	x=1 then x=1 grep 2>/dev/null sed 2>/dev/null test "$@" done
+awk local && "$@" sed readonly
+	awk echo done echo echo local &&
+		x=1 $(pwd) cd "$@" then x=1 ${HOME} test && $(pwd) "$@" x=1 ${HOME}
+2>/dev/null "$1" printf x=1 grep export grep -eu readonly "$1" echo test
+	$(pwd) && "$1" | then sed
+	${HOME} readonly | sed $(pwd) ${HOME} readonly --verbose
+test readonly cd 2>/dev/null readonly /usr/bin sed then sed test test
+sed grep sed 'quoted text' -eu then readonly $(pwd)
+	done done cd awk readonly --verbose /usr/bin 2>/dev/null printf local printf
+		"$1" test readonly readonly -eu && grep readonly
+	"$1" -eu && --verbose 2>/dev/null
+x=1 "$@" --verbose readonly | x=1 --verbose "$1" done echo awk ${HOME}
+	"$@" 'quoted text' readonly echo readonly "$@" $(pwd) readonly
+/usr/bin "$@" "$@" sed test && --verbose 2>/dev/null
+	$(pwd) export /usr/bin grep done /usr/bin
+sed $(pwd) test --verbose $(pwd) -eu "$@" test
+	sed "$1" /usr/bin "$@" sed 2>/dev/null 2>/dev/null 2>/dev/null then
+	| 2>/dev/null "$1" readonly cd
+	x=1 | x=1 /usr/bin then ${HOME} echo
+	then readonly --verbose awk 2>/dev/null
+		done /usr/bin export local sed local --verbose printf 'quoted text'
+		'quoted text' printf readonly readonly awk $(pwd) 2>/dev/null
+		$(pwd) -eu "$@" cd 'quoted text' printf "$@" grep printf cd cd $(pwd) ${HOME}
+then x=1 test test then awk readonly /usr/bin "$1" readonly export
+		x=1 then /usr/bin ${HOME} printf
+	test && "$1" awk local sed
+		then "$1" --verbose then export echo sed echo && /usr/bin then "$@"
+cd test awk x=1 sed "$@" grep /usr/bin "$@" local | 'quoted text' "$@"
+	"$@" "$@" $(pwd) then ${HOME} echo export 'quoted text'
+	echo ${HOME} then --verbose && readonly x=1 /usr/bin
+2>/dev/null 2>/dev/null "$1" "$1" ${HOME} "$@"
+	x=1 export then 'quoted text' awk sed
+	${HOME} /usr/bin /usr/bin awk grep x=1 grep x=1 ${HOME} | -eu | awk local
+sed && ${HOME} done -eu sed --verbose && && 'quoted text'
+		"$@" | "$@" /usr/bin --verbose printf x=1 x=1 sed cd && /usr/bin
+done readonly test 2>/dev/null && |
+		x=1 $(pwd) "$1" | /usr/bin "$@" "$@" awk 'quoted text'
+		done awk | 2>/dev/null grep test 'quoted text'
+readonly readonly && -eu && x=1 x=1 cd awk
+then $(pwd) | 'quoted text' printf awk local sed
+	'quoted text' then cd then && awk sed -eu sed -eu 'quoted text' local
+printf export readonly echo | 2>/dev/null --verbose
+		done test test local --verbose 'quoted text' && awk 'quoted text' 'quoted text'
+echo | readonly sed -eu cd "$1" 'quoted text'
+done echo echo && awk ${HOME} /usr/bin local 2>/dev/null x=1
+$(pwd) export 'quoted text'
+		"$1" readonly | done "$1" readonly "$@" 2>/dev/null
+		"$1" done test local printf && && -eu awk local echo $(pwd)
+--verbose cd -eu sed "$@" "$1" awk ${HOME} "$1" "$@" "$1" /usr/bin /usr/bin test
+&& done export test printf cd "$1" sed ${HOME} && | local awk ${HOME}
+	local local x=1 sed && ${HOME} export "$@" "$@" local done test -eu "$@"
+	'quoted text' --verbose $(pwd) awk | sed 2>/dev/null
+		-eu | 'quoted text' /usr/bin done 'quoted text' sed test
+		echo $(pwd) local export |
+printf done export /usr/bin -eu sed then echo $(pwd) --verbose
+local "$@" test readonly done "$@" printf readonly done echo /usr/bin
+		readonly /usr/bin -eu echo cd sed | readonly
+	--verbose /usr/bin -eu 'quoted text' echo -eu /usr/bin ${HOME}
+	local x=1 ${HOME} test grep test done echo readonly
+export "$1" readonly ${HOME}
+	--verbose readonly "$@" test /usr/bin printf $(pwd)
+local grep "$@" | then done --verbose ${HOME} cd cd 2>/dev/null
+	"$@" /usr/bin 2>/dev/null
+readonly local cd local export local | echo cd && 'quoted text'
+	readonly 2>/dev/null echo "$@" echo export 2>/dev/null
+	'quoted text' /usr/bin /usr/bin local export awk done $(pwd) echo
+&& local local test then done
+x=1 then --verbose test | --verbose --verbose | grep 'quoted text' test 'quoted text'
+grep 'quoted text' $(pwd)
+		'quoted text' then export
+then $(pwd) awk grep cd --verbose test sed && "$1" awk 'quoted text'
+	&& printf export echo -eu
+	cd x=1 grep ${HOME} -eu sed -eu then && 'quoted text' && grep
+		x=1 "$1" 2>/dev/null test -eu export printf cd sed 'quoted text' | "$1" 'quoted text'
+	${HOME} readonly cd printf local --verbose grep
+awk ${HOME} && --verbose then local export && --verbose /usr/bin
+	export export /usr/bin grep x=1 cd export
+		2>/dev/null --verbose $(pwd) done export grep test echo grep then grep readonly
+	local /usr/bin awk $(pwd) sed 'quoted text' ${HOME} ${HOME} awk
+		$(pwd) "$@" "$@" --verbose /usr/bin --verbose $(pwd) | local test printf "$1"
+grep | echo x=1 $(pwd) "$@" awk done printf
+grep 'quoted text' ${HOME} readonly export 2>/dev/null printf "$1" awk export |
+	done local && readonly test awk | 2>/dev/null $(pwd) done | && cd local | "$1"
+	readonly grep 2>/dev/null -eu export test -eu test test --verbose
+then && && sed printf printf -eu /usr/bin 2>/dev/null
+printf "$@" done sed x=1 "$@" ${HOME} cd export done x=1
+	x=1 echo printf 2>/dev/null test
+		| local test cd export x=1 x=1 readonly local awk -eu | x=1 && "$1"
+-eu done "$@" grep -eu grep printf && "$1" cd readonly export --verbose
+/usr/bin "$@" grep sed -eu grep done
+grep 2>/dev/null printf --verbose
+		| ${HOME} /usr/bin -eu local local readonly "$1" --verbose printf export printf
+	&& export && local export sed printf then "$1" 'quoted text'
+		sed grep $(pwd) "$1" printf $(pwd) awk ${HOME} && "$1"
+	"$@" readonly -eu "$1" ${HOME} 2>/dev/null --verbose
+	then && readonly echo local |
+	sed 2>/dev/null ${HOME} echo test sed local sed cd ${HOME} cd printf
+	/usr/bin "$@" sed /usr/bin | --verbose
+		grep 'quoted text' 'quoted text' grep local echo echo local
+-eu done then cd local cd export echo -eu grep
+done awk 2>/dev/null "$@" grep x=1 x=1 | test 'quoted text'
+		2>/dev/null | printf local readonly echo readonly
+	local && then sed test /usr/bin printf readonly
+		-eu cd -eu sed ${HOME} && -eu test printf
+		/usr/bin | echo /usr/bin echo cd local
+$(pwd) && | export "$1" 2>/dev/null sed sed grep && -eu export | awk "$@"
+"$1" | test grep $(pwd) "$@" then --verbose
+	/usr/bin 'quoted text' grep | "$1" then readonly printf local
+		readonly x=1 done ${HOME} /usr/bin | test -eu --verbose |
+		/usr/bin then --verbose x=1 /usr/bin cd done $(pwd) done 2>/dev/null
+--verbose $(pwd) awk "$@" && echo -eu readonly
+		2>/dev/null ${HOME} readonly ${HOME} printf test && --verbose
+	awk export test awk $(pwd) -eu sed readonly done test 2>/dev/null
+'quoted text' test /usr/bin $(pwd) "$1" test 'quoted text'
+"$1" echo printf printf 2>/dev/null /usr/bin 2>/dev/null "$@" --verbose
+-eu then local "$@" done test awk && ${HOME}
+	&& ${HOME} readonly 2>/dev/null | readonly readonly $(pwd) 'quoted text' --verbose
+		test test awk cd | printf
+${HOME} grep | "$1" export then printf
+		2>/dev/null --verbose readonly local
+		&& ${HOME} test x=1 'quoted text'
+		grep /usr/bin $(pwd) printf $(pwd) $(pwd) done done local sed test
+		then "$1" 2>/dev/null /usr/bin test $(pwd) | /usr/bin
+		export ${HOME} local awk
+echo cd 'quoted text' export 'quoted text' "$1" sed cd x=1 'quoted text'
+--verbose local "$1" /usr/bin /usr/bin
+	&& grep local && grep test grep
+	"$@" done printf /usr/bin cd $(pwd) --verbose readonly echo awk && local
+echo && "$@" && -eu local
+		--verbose ${HOME} readonly && 'quoted text' test test ${HOME} echo sed cd done
+	then readonly test $(pwd)
+awk then --verbose x=1 'quoted text' --verbose
+		grep && && ${HOME} && echo ${HOME} "$@" && /usr/bin --verbose && printf printf
+sed $(pwd) echo /usr/bin 'quoted text' test printf export export readonly /usr/bin
+		| | 2>/dev/null $(pwd) local 2>/dev/null --verbose "$1" |
+		sed -eu printf sed then -eu done --verbose export "$1" | "$1" 'quoted text' &&
+	2>/dev/null printf then sed --verbose
+echo sed $(pwd) awk local awk x=1 ${HOME} done
+cd awk $(pwd) echo sed cd echo /usr/bin then
+	readonly 2>/dev/null 2>/dev/null 'quoted text' grep
+	then readonly "$@" readonly "$1" grep echo /usr/bin $(pwd) echo then echo
+"$@" /usr/bin /usr/bin then done printf readonly | then "$@" echo awk printf
+awk test && printf /usr/bin 'quoted text' grep --verbose 2>/dev/null
+printf local ${HOME} x=1 "$@" ${HOME} local grep "$@" echo ${HOME} --verbose
+local $(pwd) /usr/bin export done echo ${HOME} awk /usr/bin x=1 echo echo /usr/bin
+		local -eu | -eu readonly "$@" $(pwd)
+&& printf done 2>/dev/null "$@" readonly 'quoted text'
+printf export export && grep
+awk 'quoted text' --verbose then -eu readonly test
+	&& export --verbose local "$@" ${HOME} "$1" sed "$1"
+	"$@" -eu -eu grep readonly test
+grep grep export cd cd cd readonly echo export done echo then && ${HOME}
+	${HOME} $(pwd) echo awk done echo 2>/dev/null
+	cd $(pwd) $(pwd) export ${HOME} | && && sed done /usr/bin echo --verbose
+		local "$1" test /usr/bin readonly
+	/usr/bin x=1 /usr/bin then $(pwd) "$@" "$@" "$1" test
+&& $(pwd) $(pwd) /usr/bin "$@"
+grep --verbose test test 2>/dev/null x=1 echo readonly $(pwd) | $(pwd) done
+	echo local export awk /usr/bin grep export | done cd -eu sed && "$1"
+		| -eu --verbose "$@" local $(pwd) export then 'quoted text' export
+	export ${HOME} 'quoted text' echo done cd x=1
+	sed done then echo "$1"
+		test export x=1 "$@" "$@" | "$1" 2>/dev/null done cd 'quoted text'
+		echo then 'quoted text' | grep local echo awk "$@"
+	local cd then 'quoted text' echo -eu --verbose sed cd grep
+		printf | done ${HOME} | 'quoted text' | ${HOME} export && awk
+done local | /usr/bin -eu test --verbose
+&& x=1 sed local --verbose
+$(pwd) done local $(pwd) test cd local /usr/bin grep
+	then awk --verbose --verbose readonly
+	&& ${HOME} | x=1 export echo export | awk then "$@" 2>/dev/null local
+		done $(pwd) awk 'quoted text' cd ${HOME}
+		2>/dev/null -eu && ${HOME} done printf printf /usr/bin -eu
+	printf grep /usr/bin then
+	'quoted text' -eu x=1 "$1"
+		"$@" awk awk x=1 && 2>/dev/null
+	test 'quoted text' && ${HOME} $(pwd) export x=1 echo awk 2>/dev/null $(pwd) grep
+--verbose then ${HOME} --verbose ${HOME} readonly test done done -eu export export
+		done local x=1 printf /usr/bin x=1 local
+		grep $(pwd) cd readonly --verbose
+	-eu $(pwd) && readonly local export "$@" then done then grep echo
+echo | "$1" "$1" && $(pwd) cd 'quoted text' /usr/bin
+| test "$@" printf cd awk readonly
+	"$@" /usr/bin -eu echo readonly
+	printf sed readonly then cd "$@" export ${HOME} x=1
+sed sed awk local sed $(pwd) 2>/dev/null 'quoted text'
+		/usr/bin sed $(pwd) test
+printf --verbose echo "$@" 'quoted text' /usr/bin | grep "$1"
+		test readonly 'quoted text' readonly --verbose export x=1 'quoted text' --verbose
+	cd awk | test printf awk -eu awk 2>/dev/null sed /usr/bin then
+--verbose echo 'quoted text' sed sed printf done --verbose
+-eu 'quoted text' export test | x=1 local readonly "$1" cd awk done printf cd
+	2>/dev/null awk awk && readonly "$1" export test &&
+$(pwd) export && sed $(pwd) local
+echo $(pwd) 'quoted text' x=1 -eu --verbose "$1" x=1 2>/dev/null
+		printf cd grep 2>/dev/null cd -eu 'quoted text'
+	grep export echo export ${HOME} done /usr/bin awk
+		2>/dev/null printf sed 'quoted text' then readonly local done test sed
+	grep "$1" "$1" echo readonly && 2>/dev/null x=1
+done 2>/dev/null readonly readonly "$1" awk $(pwd) printf -eu /usr/bin
+readonly "$1" /usr/bin --verbose x=1 sed
+	grep echo "$@" --verbose grep $(pwd) then awk && "$1"
+$(pwd) "$@" | "$1" local test x=1 readonly "$@"
+		readonly export --verbose echo test local readonly
+x=1 done local echo 'quoted text' printf done
+		'quoted text' && then "$@" "$@"
+	&& /usr/bin ${HOME} x=1 "$1" echo local sed then 'quoted text' --verbose echo
+'quoted text' sed cd $(pwd) sed 'quoted text' ${HOME} --verbose done
+		--verbose printf local ${HOME} local && done printf | $(pwd) cd test ${HOME}
+		readonly 2>/dev/null test 2>/dev/null
+$(pwd) local -eu && cd
+	sed then sed 2>/dev/null grep grep readonly --verbose then awk
+		2>/dev/null sed "$1" echo readonly local
+		&& 'quoted text' grep cd test done sed readonly echo
+		local 2>/dev/null printf printf test echo "$1" local test
+	export sed awk 2>/dev/null $(pwd) && readonly done --verbose
+local --verbose | local cd local 2>/dev/null && "$@" grep
+		"$@" export printf export awk /usr/bin awk done awk echo readonly
+		printf export x=1 sed cd -eu echo printf
+printf "$@" ${HOME} ${HOME} x=1 ${HOME}
+		2>/dev/null "$1" --verbose test
+	printf echo 2>/dev/null $(pwd) "$1"
+test 2>/dev/null "$@" sed cd printf
+	grep export -eu printf 'quoted text' then echo
+		&& local && then --verbose "$1" printf
+		readonly awk 2>/dev/null /usr/bin readonly ${HOME}
+readonly 2>/dev/null ${HOME} then "$@" local
+		--verbose x=1 sed "$1" && awk readonly test --verbose
+		awk 2>/dev/null -eu --verbose "$1" grep grep
+sed "$@" ${HOME} done done then awk && printf
+		local done --verbose x=1 --verbose --verbose
+		${HOME} sed x=1 --verbose
+		--verbose x=1 "$@" ${HOME} && 'quoted text'
+		grep awk export 'quoted text' | 2>/dev/null 'quoted text'
+		2>/dev/null --verbose printf | ${HOME} test 'quoted text' printf sed done
+		local printf 2>/dev/null test cd --verbose awk
+		| local done awk "$@" "$1" awk export sed "$@" then
+		"$1" awk echo test sed test | grep done
+	'quoted text' 2>/dev/null done && "$1"
+		--verbose readonly printf $(pwd) then && "$@"
+		local ${HOME} local "$1" grep printf /usr/bin x=1 'quoted text'
+test --verbose then readonly local cd 'quoted text' printf | "$@" --verbose
+		x=1 ${HOME} $(pwd) --verbose "$@" "$@" printf 'quoted text'
+	2>/dev/null local cd cd echo sed cd 'quoted text' /usr/bin echo awk --verbose
+	&& "$1" | 2>/dev/null $(pwd) printf x=1 echo export x=1 "$1" 'quoted text'
+| grep && --verbose "$1" $(pwd) 'quoted text' sed local
+		&& && printf "$1" x=1 export
+		| sed test ${HOME} sed -eu grep /usr/bin printf echo ${HOME} awk printf
+	grep cd x=1 readonly
+	printf sed x=1 local ${HOME} "$@" printf x=1 printf then x=1 --verbose 2>/dev/null
+	readonly awk $(pwd) then "$1" sed done done sed
+cd && ${HOME} --verbose test -eu readonly
+		&& echo x=1 sed 2>/dev/null
+	"$@" && "$@" "$1" export echo /usr/bin done ${HOME} awk -eu 'quoted text' $(pwd)
+	then cd 'quoted text' && readonly $(pwd) --verbose && "$@"
+	readonly "$1" "$1" /usr/bin x=1 $(pwd) export awk | then "$1" printf
+/usr/bin echo | then awk "$@" local grep printf && "$@" && "$@" | /usr/bin
+		&& $(pwd) ${HOME} done grep ${HOME} && test
+		| then echo export x=1 then "$1" 2>/dev/null export /usr/bin
+	printf done awk --verbose cd readonly
+		grep | 2>/dev/null sed then x=1 --verbose export --verbose printf done
+	2>/dev/null "$@" ${HOME} | readonly /usr/bin | /usr/bin | "$1"
+	'quoted text' -eu grep $(pwd) --verbose 'quoted text' | ${HOME} then readonly
+readonly local ${HOME} /usr/bin printf test | echo --verbose
+	then --verbose local | local "$@" $(pwd) ${HOME} awk test 2>/dev/null --verbose
+export export cd printf && grep readonly test
+		"$1" awk local export ${HOME}
+	$(pwd) test echo sed printf done /usr/bin sed --verbose -eu x=1 x=1 /usr/bin
+	echo sed grep ${HOME} awk "$1" done x=1 printf printf export 'quoted text'
+		| x=1 export --verbose
+	cd echo x=1 readonly 2>/dev/null awk readonly $(pwd) echo then grep "$@" printf
+		cd "$1" "$1" echo echo echo grep 'quoted text' -eu test echo printf 2>/dev/null
+	test ${HOME} echo printf 2>/dev/null grep /usr/bin
+then cd | cd | export export cd export export
+sed done --verbose -eu 'quoted text' --verbose readonly local printf
+		cd "$1" -eu ${HOME} readonly test local && local 'quoted text' x=1 done
+#include c228.sh
+	| test 'quoted text' "$1" local done
+	printf printf export cd printf ${HOME} local
+--verbose done "$1" --verbose ${HOME} cd
+| && export "$1" test
+	"$@" "$1" awk | -eu cd "$1" && then $(pwd)
+export done grep done cd "$1" local "$@" $(pwd) 'quoted text' "$1" grep
+	&& | awk | "$1" sed x=1 2>/dev/null local "$@" local "$1"
+	done /usr/bin --verbose x=1 ${HOME} $(pwd) done ${HOME} -eu -eu x=1 --verbose
+$(pwd) done cd echo --verbose done && 'quoted text' -eu readonly $(pwd) grep 2>/dev/null
+		${HOME} 2>/dev/null "$1" --verbose 2>/dev/null then test
+&& cd echo && awk "$1" awk 'quoted text' $(pwd)
+	export ${HOME} | export ${HOME}
+		test echo ${HOME} -eu $(pwd) x=1 $(pwd)
+		readonly awk sed "$@" -eu && && 'quoted text'
+/usr/bin echo sed && grep awk sed "$1" sed "$@" export echo awk export
+'quoted text' awk then readonly awk "$@" --verbose
+	/usr/bin export $(pwd) x=1 --verbose readonly /usr/bin 2>/dev/null
+		"$1" -eu then "$1" "$1"
+x=1 && then then 'quoted text' /usr/bin && 2>/dev/null
+printf grep awk "$1" local done readonly | x=1 sed | test -eu test printf
+printf test export "$1" sed 2>/dev/null -eu -eu "$@" readonly echo -eu
+	then "$1" $(pwd) export /usr/bin
+		echo "$@" "$1" "$1" | x=1 | -eu 2>/dev/null then cd echo /usr/bin printf cd test
+	/usr/bin -eu && $(pwd) awk sed
+	-eu local --verbose test sed local "$@" x=1 readonly printf readonly
+| grep -eu x=1 x=1 'quoted text' 2>/dev/null echo grep | export
+	awk then done --verbose
+cd cd cd 'quoted text' awk local test 2>/dev/null
+	grep $(pwd) done local printf "$@"
+		2>/dev/null x=1 local export done local "$@" && grep 'quoted text' "$1"
+cd -eu x=1 -eu cd local export ${HOME} local /usr/bin
+x=1 /usr/bin "$1" cd /usr/bin 'quoted text'
+	cd readonly cd test readonly then grep /usr/bin
+		/usr/bin --verbose done "$@" sed $(pwd)
+then "$@" $(pwd) 2>/dev/null && echo -eu grep then then local
+export 'quoted text' "$1"
+done | test awk --verbose cd -eu
+		| ${HOME} then x=1 /usr/bin $(pwd) test /usr/bin -eu "$1" sed
+		&& done then local done --verbose "$1" "$1" "$@" -eu $(pwd) ${HOME} then
+| -eu readonly 'quoted text' x=1 then done && $(pwd) 2>/dev/null
+local awk -eu awk "$@" cd | grep && test readonly grep test grep
+	local then | readonly then 'quoted text'
+		--verbose /usr/bin && "$1" sed then "$1" $(pwd)
+	&& && sed -eu && ${HOME} sed -eu
+		2>/dev/null done then export then 2>/dev/null | readonly
+awk --verbose /usr/bin -eu x=1 "$@" && local echo "$@" /usr/bin
+done local -eu 'quoted text' readonly --verbose awk then test
+	${HOME} "$1" 'quoted text' -eu $(pwd) ${HOME} awk awk test export
+printf 'quoted text' cd
+		test export x=1 /usr/bin -eu
+| /usr/bin 2>/dev/null grep done local | then /usr/bin export
+	done 'quoted text' grep 'quoted text'
+x=1 echo awk test export awk then /usr/bin cd $(pwd) x=1 test
+	grep cd local "$1" 2>/dev/null local x=1 2>/dev/null 'quoted text'
+--verbose export 2>/dev/null local export "$1" test | grep $(pwd) x=1 done
+local "$@" local --verbose | then -eu && && $(pwd)
+		"$@" x=1 ${HOME} export $(pwd) x=1 local 2>/dev/null
+	echo "$1" && ${HOME} sed && then cd --verbose
+		&& $(pwd) readonly | echo x=1 | export "$1" grep awk local grep awk awk
+&& 2>/dev/null /usr/bin local
+	x=1 export "$1" --verbose done
+x=1 printf ${HOME} -eu /usr/bin then sed echo x=1 "$@" && -eu
+	$(pwd) local -eu echo /usr/bin awk export | awk readonly
+	sed /usr/bin sed 'quoted text' 2>/dev/null then ${HOME} awk "$@" grep
+	--verbose x=1 printf --verbose "$@"
+	cd readonly local awk grep -eu /usr/bin
+local $(pwd) 2>/dev/null printf then echo
+		| "$@" && | done 'quoted text' $(pwd) grep printf -eu
+	x=1 -eu test 2>/dev/null printf
+	"$1" done ${HOME} ${HOME} echo | readonly awk ${HOME} then
+	awk test 'quoted text' export x=1 && 2>/dev/null /usr/bin && 2>/dev/null 2>/dev/null
+	printf -eu cd sed readonly | sed cd $(pwd) 2>/dev/null
+awk $(pwd) "$@" -eu 2>/dev/null /usr/bin "$1" 'quoted text' 2>/dev/null test
+${HOME} grep readonly echo -eu 'quoted text'
+		2>/dev/null 2>/dev/null | test export sed ${HOME} test
+readonly grep test awk "$@" /usr/bin awk &&
+		then && | x=1 test export "$@" echo --verbose
+done "$1" export 'quoted text' done | sed /usr/bin "$1" cd x=1 'quoted text'
+	readonly done export $(pwd)
+	then local "$@" "$1" "$@"
+cd /usr/bin export export sed echo export x=1 x=1 && "$1" awk awk x=1 cd
+	sed grep readonly done export
+	test "$1" && printf "$1" grep readonly echo "$@" --verbose then && printf "$1"
+	"$@" echo && && export local then then 2>/dev/null sed --verbose --verbose
+		/usr/bin awk export 'quoted text'
+	/usr/bin export $(pwd) /usr/bin local local $(pwd) "$@" local
+test 'quoted text' && ${HOME} test readonly
+'quoted text' printf 'quoted text' local && sed -eu cd cd "$1" echo
+awk | --verbose -eu local | awk local ${HOME} "$1" 'quoted text' "$1"
+	&& cd readonly "$1" "$1" $(pwd) local printf test 'quoted text' test test
+	"$1" $(pwd) awk then local cd echo -eu awk export cd /usr/bin && 'quoted text'
+x=1 /usr/bin -eu printf test local && grep cd echo 2>/dev/null
+grep --verbose x=1 x=1 $(pwd) done $(pwd) && done grep cd --verbose
+		-eu /usr/bin readonly x=1 cd local grep "$1" 2>/dev/null -eu | "$1" "$1"
+		${HOME} "$1" done x=1 "$@" 'quoted text'
+		| sed done then "$@" local grep "$1" cd -eu readonly then --verbose
+		'quoted text' local | readonly
+/usr/bin cd | "$1" done test
+		-eu export awk done -eu test cd ${HOME} && ${HOME} && then then ${HOME}
+x=1 local $(pwd) /usr/bin -eu sed ${HOME}
+	"$1" -eu --verbose grep "$1" awk then echo /usr/bin "$@" then printf "$1" local
+	-eu x=1 /usr/bin readonly
+	/usr/bin cd test sed echo local /usr/bin
+		"$@" "$1" /usr/bin $(pwd) printf local -eu readonly
+		'quoted text' | grep test export --verbose export cd
+		local then printf done -eu done 2>/dev/null
+		"$1" --verbose printf x=1 2>/dev/null && cd test "$1" "$@" done 2>/dev/null
+	echo /usr/bin x=1 "$@" && then
+		--verbose export && cd
+--verbose cd then -eu done --verbose done echo test 'quoted text' printf
+		| export echo sed export 2>/dev/null
+awk then 'quoted text' then 'quoted text' echo && && export export
+	/usr/bin printf readonly done test && $(pwd) export local test
+x=1 grep x=1 "$@" && && cd cd local test awk export then --verbose
+	"$@" readonly test -eu
+	-eu grep x=1 'quoted text' | printf done
+		${HOME} ${HOME} $(pwd) grep x=1 local
+		"$@" sed 'quoted text' local done
+	&& test done awk | --verbose "$@" -eu grep | then | 'quoted text' grep local
+	printf then cd local --verbose then sed
+grep local done export done local readonly ${HOME} ${HOME} x=1 local awk "$1"
+awk sed grep 2>/dev/null printf "$1" local test --verbose
+"$1" "$1" $(pwd) awk printf grep done export
+	awk test | "$1" test | $(pwd) | /usr/bin local readonly
+readonly --verbose ${HOME} $(pwd) sed 'quoted text' "$@" && export /usr/bin
+	'quoted text' local awk ${HOME} sed
+	-eu echo cd x=1 -eu && test test 'quoted text' --verbose /usr/bin
+	readonly then done echo --verbose /usr/bin sed printf 2>/dev/null readonly
+2>/dev/null -eu test sed local sed 2>/dev/null ${HOME} readonly
+	x=1 -eu awk && "$@" printf | $(pwd) echo ${HOME} 'quoted text' printf 2>/dev/null
+readonly grep $(pwd) "$@"
+		printf $(pwd) printf cd && -eu $(pwd) awk grep "$1" --verbose test
+then test echo 'quoted text' "$@" x=1 awk cd && echo sed grep 'quoted text' x=1
+awk done export ${HOME} cd | done readonly /usr/bin export test printf && grep
+		"$@" then 2>/dev/null printf -eu /usr/bin
+		local $(pwd) sed local -eu
+	cd echo $(pwd) 'quoted text'
+	&& ${HOME} ${HOME} | ${HOME} cd printf test ${HOME}
+		grep printf test -eu test ${HOME} cd test done -eu /usr/bin
+"$1" then sed | -eu ${HOME} "$1" readonly 'quoted text'
+--verbose then echo sed cd awk then x=1 ${HOME} awk cd --verbose
+"$@" -eu sed test && ${HOME} done local 'quoted text' cd sed cd test ${HOME} grep
+	local then local done printf x=1
+/usr/bin echo /usr/bin "$1" 'quoted text'
+	2>/dev/null local done
+		awk grep test echo "$1" readonly "$1" && local then ${HOME} --verbose
+done --verbose grep test readonly
+	$(pwd) /usr/bin printf cd local local ${HOME}
+	local "$@" printf export "$@" $(pwd) echo echo "$1" $(pwd) | awk ${HOME} local
+		$(pwd) readonly --verbose $(pwd) "$@" printf "$1" /usr/bin
+		2>/dev/null export ${HOME} done "$@" export then cd && | test /usr/bin
+| /usr/bin test 'quoted text' sed test readonly
+awk --verbose done "$1" --verbose 'quoted text' then readonly done cd then echo
+		awk export awk local awk readonly
+		x=1 sed echo | ${HOME} test test x=1 "$@" then echo
+		cd then -eu $(pwd) /usr/bin readonly 2>/dev/null -eu then && awk
+sed --verbose then export done --verbose --verbose
+		-eu done export grep $(pwd)
+	cd 'quoted text' echo /usr/bin cd local printf -eu x=1 --verbose
+printf readonly test | "$1" cd
+	$(pwd) 2>/dev/null 'quoted text'
+		-eu sed --verbose readonly sed echo "$@" awk
+grep $(pwd) test ${HOME} export done echo echo grep /usr/bin echo awk test
+	x=1 "$@" && then echo -eu awk /usr/bin && cd done printf
+	$(pwd) ${HOME} then 2>/dev/null $(pwd) && "$@" "$1"
+		done done printf | | awk echo ${HOME} local $(pwd) 2>/dev/null test x=1 cd
+	${HOME} /usr/bin readonly | test printf local local "$@"
+	| "$@" printf 2>/dev/null $(pwd) --verbose sed local awk cd "$1"
+		&& sed 2>/dev/null && test ${HOME}
+/usr/bin cd $(pwd) local
+	sed ${HOME} done /usr/bin local readonly local
+	export grep export /usr/bin | local && printf grep -eu /usr/bin /usr/bin --verbose
+readonly readonly test "$@" sed awk "$1"
+2>/dev/null awk 'quoted text' $(pwd) local && 2>/dev/null sed awk
+"$@" then then awk $(pwd) x=1
+	done -eu echo "$@" x=1 /usr/bin then -eu export "$1" 2>/dev/null
+--verbose 2>/dev/null local && /usr/bin && | printf
+	--verbose | cd 2>/dev/null
+--verbose "$1" sed && readonly && test
+		readonly | export export done | | 'quoted text' 2>/dev/null "$1" --verbose
+	'quoted text' /usr/bin then awk "$1" "$1" x=1 echo awk "$1" test sed
+		test -eu $(pwd) local readonly /usr/bin echo awk sed 2>/dev/null
+		${HOME} printf printf printf --verbose | --verbose local --verbose awk echo echo
+grep && 'quoted text' 'quoted text' then
+export test "$@" /usr/bin ${HOME} x=1 /usr/bin sed test && 2>/dev/null
+/usr/bin local "$1" 2>/dev/null $(pwd) ${HOME} --verbose readonly awk export
+cd x=1 grep --verbose test
+		'quoted text' /usr/bin readonly export && /usr/bin
+	x=1 "$@" awk awk 'quoted text' awk grep --verbose export 2>/dev/null
+done readonly /usr/bin && ${HOME} -eu then x=1 $(pwd) | cd | |
+		sed done /usr/bin echo "$@" cd then local | /usr/bin --verbose echo printf cd
+/usr/bin && && done readonly done readonly -eu awk
+		/usr/bin local /usr/bin sed sed test -eu
+		printf printf /usr/bin $(pwd) 2>/dev/null x=1 | 'quoted text'
+"$@" awk grep grep done "$@" "$1" sed sed test test test 'quoted text' ${HOME}
+		awk 'quoted text' /usr/bin 'quoted text'
+		-eu awk awk cd 2>/dev/null -eu cd "$1" --verbose export "$1"
+		"$1" grep test then "$1"
+2>/dev/null local "$1" then && readonly /usr/bin cd echo readonly /usr/bin
+		then ${HOME} "$@" 2>/dev/null grep cd /usr/bin 'quoted text' printf done | done
+| $(pwd) 'quoted text' cd done --verbose sed
+	-eu cd sed readonly 2>/dev/null
+		echo awk 'quoted text' awk grep echo grep $(pwd) grep "$@" done 'quoted text'
+readonly "$@" "$1" test
+local && "$1" echo grep ${HOME} printf -eu echo local
+test cd && then 2>/dev/null --verbose 2>/dev/null -eu -eu $(pwd) /usr/bin
+test && 'quoted text' echo
+	'quoted text' printf export local sed ${HOME} then test | && ${HOME} | && then
+		echo ${HOME} /usr/bin printf readonly /usr/bin
+		printf $(pwd) awk done awk
+	$(pwd) cd test -eu test cd | | printf --verbose test readonly grep -eu x=1 grep
+		'quoted text' local 2>/dev/null echo ${HOME} --verbose readonly && done export
+&& 'quoted text' 'quoted text' sed test
+		$(pwd) done awk test /usr/bin -eu --verbose echo readonly done -eu then awk
+awk x=1 sed "$1" test -eu x=1 | $(pwd) echo test "$1" sed grep cd
+		echo test echo sed done
+		test | $(pwd) x=1 'quoted text' | export
+	/usr/bin /usr/bin && sed sed 'quoted text' 'quoted text'
+readonly then local $(pwd) 2>/dev/null "$@" /usr/bin
+		/usr/bin --verbose test done readonly
+		${HOME} 'quoted text' printf | awk "$@" "$@" /usr/bin 2>/dev/null then "$1" -eu
+		x=1 "$1" export | sed --verbose test sed awk sed readonly
+		2>/dev/null readonly x=1 $(pwd)
+	printf awk readonly x=1 printf ${HOME} done then "$@" "$@" /usr/bin
+readonly "$@" $(pwd) &&
+		grep awk ${HOME} cd 2>/dev/null -eu x=1 sed "$1" | readonly /usr/bin export
+&& cd grep "$1" ${HOME} 2>/dev/null export /usr/bin export awk export
+	--verbose $(pwd) awk ${HOME} cd printf $(pwd) "$@" test x=1 -eu export awk
+	echo "$1" echo awk /usr/bin sed "$@" readonly "$@" 2>/dev/null
+	"$1" sed "$@" 2>/dev/null readonly 'quoted text' $(pwd) cd done
+		echo echo test $(pwd)
+		grep 2>/dev/null 2>/dev/null export "$@"
+	${HOME} x=1 "$1" cd 2>/dev/null readonly grep grep grep then --verbose 'quoted text'
+	grep printf | ${HOME} echo
+	local -eu done 'quoted text' printf "$1" done -eu
+"$@" test done echo cd -eu 2>/dev/null printf ${HOME} local && then --verbose
+local $(pwd) then printf readonly $(pwd) then awk printf && -eu sed 2>/dev/null
+	test "$@" && readonly "$1" sed -eu -eu local readonly
+	-eu echo local && $(pwd) --verbose && echo |
+	$(pwd) "$@" printf $(pwd) "$@" readonly then test awk /usr/bin done 2>/dev/null
+local export --verbose echo $(pwd) 'quoted text' export readonly && cd --verbose
+		x=1 'quoted text' | && cd $(pwd) 2>/dev/null
+		--verbose readonly && $(pwd) /usr/bin readonly readonly
+	'quoted text' cd local x=1 echo -eu 2>/dev/null test 2>/dev/null
+		"$@" $(pwd) test "$@" -eu awk && $(pwd) local
+done export grep sed ${HOME} cd sed grep && grep cd done 2>/dev/null --verbose
+		"$1" -eu $(pwd) "$1" "$1" printf printf x=1 export
+		export 'quoted text' x=1 && --verbose 2>/dev/null 'quoted text'
+	-eu then -eu --verbose readonly "$@" done printf /usr/bin echo cd 'quoted text'
+done done export then printf "$@" ${HOME} ${HOME} 'quoted text' 'quoted text'
+		printf 2>/dev/null /usr/bin $(pwd) ${HOME} -eu done local echo "$@" | echo
+$(pwd) ${HOME} -eu /usr/bin
+		2>/dev/null && sed readonly $(pwd) -eu
+		grep -eu | $(pwd) test done "$@" -eu "$1" cd test
+		| test sed "$@" done $(pwd) done export && sed x=1
+grep test /usr/bin printf $(pwd) sed /usr/bin sed "$1" echo readonly
+&& | -eu local "$1" -eu -eu test -eu then && | cd grep 'quoted text'
+$(pwd) -eu "$@" --verbose
+&& sed && echo printf echo readonly local ${HOME} printf /usr/bin x=1 then
+	cd | export grep export
+	done sed export readonly cd done 2>/dev/null printf 'quoted text'
+echo 'quoted text' x=1 echo "$1" awk then $(pwd) -eu test
+awk local then ${HOME} test /usr/bin echo done "$@" && local "$@" 2>/dev/null
+		"$1" printf printf "$@" printf awk export | x=1 test grep then done "$@" then
+	readonly "$@" readonly && 'quoted text'
+	export /usr/bin "$1" cd $(pwd) printf local echo -eu -eu x=1 local | echo &&
+echo x=1 sed then "$1" done then done sed $(pwd)
+	$(pwd) echo grep export sed 2>/dev/null
+	local test cd && -eu cd "$@" cd done export "$1" grep export x=1 2>/dev/null
+-eu cd -eu printf awk local printf "$1" $(pwd)
+	$(pwd) 'quoted text' then grep "$1" "$1" 'quoted text' cd sed export
+	'quoted text' "$1" $(pwd) local export $(pwd) cd && done 2>/dev/null $(pwd) ${HOME}
+		done then "$1" cd printf 2>/dev/null export
+	| ${HOME} grep export "$@"
+awk local done | ${HOME} 'quoted text' /usr/bin
+		echo "$1" then --verbose ${HOME} -eu test local $(pwd)
+	x=1 $(pwd) grep && cd $(pwd)
+		2>/dev/null sed then cd export $(pwd) awk "$1" /usr/bin
+test --verbose readonly awk echo echo cd printf "$@" readonly
+		'quoted text' 'quoted text'
+	printf readonly echo $(pwd) --verbose
+local readonly local "$@"
+	local "$@" && --verbose test sed --verbose "$1" ${HOME}
+--verbose && | 2>/dev/null --verbose cd test test test -eu
+	export printf readonly local --verbose $(pwd) test
+grep 2>/dev/null awk grep awk then "$@" printf | "$1" --verbose
+	2>/dev/null "$1" export
+	"$@" readonly x=1 x=1 awk printf -eu done export
+	cd 'quoted text' sed done done | | sed export $(pwd)
+cd 2>/dev/null sed 2>/dev/null readonly sed --verbose printf readonly
+	echo sed 'quoted text' test $(pwd) grep cd cd readonly cd then printf x=1 sed grep
+		echo ${HOME} ${HOME} -eu ${HOME} test && awk grep done awk $(pwd) then
+	-eu test printf "$@" | cd grep | "$@" "$1" -eu done "$1"
+		x=1 export test "$1" then ${HOME} echo done local ${HOME} 'quoted text'
+	awk sed done local done "$1" | echo /usr/bin x=1 echo
+		$(pwd) test | | sed --verbose local 2>/dev/null ${HOME} "$@" &&
+done 'quoted text' done | local "$1" printf awk awk /usr/bin export
+	awk "$1" -eu 2>/dev/null ${HOME} | x=1 && -eu /usr/bin done "$@" && && ${HOME}
+	readonly -eu cd echo "$1" -eu
+"$1" printf readonly grep printf "$@" cd sed printf x=1 "$1" sed printf
+local "$1" -eu awk x=1 /usr/bin done /usr/bin --verbose ${HOME}
+	$(pwd) 'quoted text' 'quoted text' /usr/bin |
+	local export -eu x=1 awk awk | && grep "$1" done test x=1 sed grep
+	"$@" awk 2>/dev/null && 2>/dev/null printf sed local /usr/bin /usr/bin export echo
+	/usr/bin readonly grep "$1" --verbose "$1" done test
+then done sed readonly local 'quoted text' awk echo 'quoted text'
+	grep readonly | "$@" $(pwd) 2>/dev/null
+		/usr/bin grep "$1" done --verbose ${HOME} done printf readonly grep grep grep
+		&& then export test done local "$@" && && && | 'quoted text' $(pwd)
+		sed sed --verbose printf | "$@" | 'quoted text' 2>/dev/null "$@" | $(pwd) cd done
+	readonly && done $(pwd) 'quoted text' ${HOME} "$@" test /usr/bin export echo
+		x=1 sed printf cd test "$1" "$@" test && /usr/bin cd 'quoted text'
+	grep --verbose "$@" grep done | awk -eu done $(pwd)
+		awk test 'quoted text' ${HOME} "$@"
+		--verbose 'quoted text' sed $(pwd)
+-eu "$@" readonly 2>/dev/null echo ${HOME} awk && | "$1" && ${HOME} cd | 2>/dev/null
+| /usr/bin /usr/bin export export 2>/dev/null done 'quoted text' -eu x=1
+		&& done done && done readonly printf -eu echo && then then printf "$@"
+		&& && export | --verbose /usr/bin x=1 then ${HOME}
+	&& echo local "$@" echo awk --verbose local ${HOME} done test $(pwd) readonly
+		done grep then && test $(pwd) echo sed cd "$@" | 'quoted text'
+	cd | 2>/dev/null cd ${HOME} echo local
+'quoted text' "$@" ${HOME} then sed readonly readonly $(pwd) echo
+'quoted text' cd /usr/bin 'quoted text'
+	done cd printf readonly ${HOME} awk 2>/dev/null
+		"$1" x=1 then then echo 2>/dev/null 'quoted text' grep cd export test
+		sed -eu $(pwd) x=1 "$@" echo $(pwd) sed awk "$1" local | x=1
+--verbose 'quoted text' local --verbose "$1"
+${HOME} "$@" done printf cd -eu
+--verbose 2>/dev/null then then -eu
+	test done /usr/bin --verbose "$@" printf
+		awk x=1 export echo cd test test sed sed
+		2>/dev/null then sed | echo x=1 local 2>/dev/null local export done printf
+	--verbose -eu --verbose -eu x=1 sed export readonly $(pwd)
+		&& local --verbose echo "$@" awk $(pwd) awk cd "$@"
+local echo $(pwd) "$1" readonly 'quoted text' sed | local 2>/dev/null 'quoted text'
+/usr/bin && --verbose /usr/bin export 2>/dev/null "$@" sed
+x=1 then && export --verbose done && /usr/bin "$@"
+		readonly grep grep done && "$@" x=1 $(pwd)
+	'quoted text' /usr/bin "$@" "$1" readonly echo grep echo
+		echo awk grep local && printf done ${HOME} /usr/bin export export /usr/bin
+		| printf export sed --verbose --verbose echo readonly done --verbose --verbose
+sed grep -eu ${HOME} "$@" test done
+	printf && /usr/bin && "$@" printf | "$1" awk test
+	local && done awk printf echo awk ${HOME} /usr/bin
+	/usr/bin readonly echo local done && $(pwd) 2>/dev/null $(pwd) -eu | readonly
+$(pwd) $(pwd) "$1" local $(pwd) then test "$@" sed local 2>/dev/null cd
+		cd readonly export echo local export then "$@"
+		then x=1 | -eu /usr/bin | ${HOME} test cd && printf "$@"
+export --verbose "$@" cd ${HOME} | export then readonly
+	| $(pwd) grep then sed 'quoted text' echo "$@" 2>/dev/null
+		printf /usr/bin echo echo | test $(pwd) local local && cd done 2>/dev/null test
+	'quoted text' 2>/dev/null printf test 'quoted text'
+		grep grep x=1 -eu -eu "$@" done test | grep
+	readonly && 'quoted text'
+		-eu printf sed echo sed test "$1" local
+		awk && && /usr/bin awk echo
+done test grep test test grep $(pwd) test grep x=1 printf $(pwd)
+grep done done -eu x=1 sed 2>/dev/null
+		awk cd sed test "$1" 2>/dev/null /usr/bin done -eu
+		"$@" grep 2>/dev/null $(pwd) | 'quoted text' test -eu x=1 "$1" "$1" |
+-eu | "$1" | local 'quoted text' test grep printf
+echo "$@" /usr/bin | "$1" export -eu printf grep grep
+done $(pwd) cd $(pwd) cd then
+		&& x=1 | && export && -eu && -eu --verbose test
+	"$@" $(pwd) grep test test 2>/dev/null
+		&& then 2>/dev/null grep --verbose printf
+	2>/dev/null -eu $(pwd) "$@" grep
+		readonly ${HOME} --verbose done test then ${HOME}
+x=1 x=1 --verbose cd export echo
+'quoted text' | grep sed 'quoted text' done
+		awk export | "$@" done -eu echo
+		'quoted text' export
+		export echo test printf $(pwd) export 'quoted text'
+	sed local export && echo export /usr/bin 2>/dev/null --verbose local $(pwd) awk
+		${HOME} grep grep ${HOME} echo "$@" &&
+| readonly $(pwd) -eu test /usr/bin ${HOME} $(pwd) grep local export x=1 then ${HOME}
+		printf grep -eu /usr/bin -eu sed 'quoted text' then test 'quoted text'
+		then /usr/bin && && test test $(pwd) x=1 then sed ${HOME} grep
+		$(pwd) done then done awk --verbose /usr/bin x=1 sed ${HOME} export awk --verbose
+	"$1" | echo cd readonly /usr/bin readonly readonly
+/usr/bin readonly printf ${HOME} readonly local
+-eu "$@" echo -eu awk done done | 'quoted text' ${HOME} 2>/dev/null /usr/bin
+${HOME} "$@" echo readonly 'quoted text' cd "$1" done export sed test export
+awk export export ${HOME} $(pwd) 2>/dev/null sed echo "$1" cd
+readonly $(pwd) awk export /usr/bin then cd echo readonly then && grep 2>/dev/null
+	then /usr/bin -eu export
+	then -eu then awk test 'quoted text' 2>/dev/null cd
+		export /usr/bin done test echo printf export 'quoted text'
+		"$1" x=1 x=1 x=1 /usr/bin then | echo readonly
+	$(pwd) 'quoted text' x=1
+--verbose then -eu "$@" grep && readonly readonly 2>/dev/null && echo readonly
+	local awk | x=1 2>/dev/null | awk /usr/bin sed
+	x=1 "$@" $(pwd) echo grep then ${HOME} -eu then echo && sed awk then 2>/dev/null
+		-eu 2>/dev/null then export && /usr/bin -eu export test cd echo echo /usr/bin
+	sed done /usr/bin | grep
+	echo grep | done $(pwd) echo printf readonly
+	${HOME} grep then "$1" done && "$1" then --verbose cd
+		export then local 2>/dev/null --verbose grep grep $(pwd) $(pwd)
+		printf /usr/bin "$1" "$1" test local ${HOME} -eu "$1"
+x=1 ${HOME} test x=1 /usr/bin readonly && /usr/bin test
+		export cd echo /usr/bin 'quoted text'
+		"$1" | 2>/dev/null -eu grep
+		cd printf $(pwd) printf ${HOME} && $(pwd) sed /usr/bin
+	readonly local | x=1 echo awk sed test $(pwd) grep x=1 "$@" "$1"
+		-eu -eu /usr/bin -eu grep grep x=1 $(pwd) -eu sed 2>/dev/null
+	printf x=1 awk $(pwd) x=1 echo printf done ${HOME} then
+	local /usr/bin sed 'quoted text' --verbose "$1" cd | test sed sed --verbose 2>/dev/null
+"$@" /usr/bin echo printf printf local 'quoted text'
+local "$@" 2>/dev/null readonly local test /usr/bin then export
+		/usr/bin ${HOME} x=1 printf | done
+	2>/dev/null cd "$@" printf 2>/dev/null
+		-eu && test done then export --verbose
+	test export local echo awk printf --verbose awk
+2>/dev/null --verbose | sed -eu 2>/dev/null export
+	x=1 -eu "$1" local $(pwd)
+	-eu grep cd -eu export cd ${HOME}
+	$(pwd) sed cd then | $(pwd) test done cd readonly "$@" grep x=1 "$@" export
+"$1" ${HOME} cd "$@" export readonly --verbose cd local "$1" awk ${HOME} $(pwd)
+printf cd /usr/bin then && -eu grep cd test
+		/usr/bin $(pwd) sed readonly && then
+'quoted text' --verbose x=1 awk -eu sed done export "$@" "$@" test
+		/usr/bin 'quoted text' | -eu cd then export | $(pwd)
+		cd $(pwd) "$@" local
+	then | | | 2>/dev/null done $(pwd) -eu
+/usr/bin local ${HOME} 'quoted text' readonly
+	"$@" cd export | /usr/bin readonly grep test "$@" ${HOME} ${HOME} 'quoted text'
+| done --verbose 2>/dev/null
+	x=1 "$1" "$1" 2>/dev/null
+		cd ${HOME} test done && /usr/bin export | && 'quoted text'
+echo grep ${HOME} ${HOME} | 2>/dev/null --verbose
+		then "$@" | test -eu sed echo readonly | test "$@" awk | echo --verbose
+export done grep ${HOME} echo sed done echo export
+-eu && /usr/bin readonly -eu
+printf printf test done --verbose printf test
+		grep $(pwd) /usr/bin printf cd /usr/bin done $(pwd)
+		grep 2>/dev/null -eu local cd done
+	--verbose readonly && cd awk --verbose /usr/bin cd $(pwd) 2>/dev/null
+echo && 'quoted text' readonly x=1 /usr/bin sed $(pwd) export $(pwd) 'quoted text'
+'quoted text' test then 'quoted text'
+echo /usr/bin 'quoted text' x=1 echo 'quoted text' 'quoted text' then
+		"$1" local "$@" && sed awk then 'quoted text' "$1" /usr/bin "$1" x=1 then done ${HOME}
+		'quoted text' done awk echo local awk printf export echo
+	cd cd x=1 'quoted text'
+	echo readonly done 2>/dev/null awk printf "$1" 'quoted text' test $(pwd)
+	${HOME} ${HOME} readonly /usr/bin 'quoted text' ${HOME} printf
+	2>/dev/null grep export x=1 -eu cd cd && done --verbose readonly 'quoted text'
+grep 2>/dev/null export /usr/bin "$@" 'quoted text' $(pwd)
+	local printf -eu "$1" export -eu local grep cd && x=1 "$@" cd awk ${HOME}
+	$(pwd) $(pwd) local test | local printf done export awk 'quoted text' cd && --verbose
+	&& echo echo "$1" /usr/bin sed readonly | cd && then test -eu printf -eu
+	$(pwd) local awk local x=1
+	| echo --verbose "$1"
+		/usr/bin && | export "$1" done
+		| echo test | test echo 'quoted text' grep test readonly -eu
+		readonly -eu done export echo "$1"
+done /usr/bin readonly export "$@"
+		-eu && 'quoted text' export -eu local then echo then /usr/bin
+	${HOME} x=1 -eu | "$1" --verbose local readonly
+cd && test grep grep awk 'quoted text' 'quoted text' | grep printf
+		| "$1" printf --verbose local "$@" "$@" readonly 'quoted text'
+		echo readonly 'quoted text' "$@" then
+	sed cd 'quoted text' done printf cd &&
+sed /usr/bin -eu local printf
+sed done ${HOME} printf -eu readonly && export $(pwd) -eu
+x=1 'quoted text' local "$1" $(pwd) readonly
+printf "$1" local then awk /usr/bin local 2>/dev/null ${HOME}
+		echo 2>/dev/null grep test | "$@" cd awk | -eu
+	test grep awk grep printf "$1" echo x=1 -eu 2>/dev/null x=1 && awk "$1" ${HOME}
+		${HOME} | $(pwd) cd 2>/dev/null then -eu
+		$(pwd) x=1 $(pwd) sed grep --verbose printf then done "$1" 2>/dev/null
+echo done ${HOME} export done "$1" 'quoted text' 'quoted text'
+		test /usr/bin && 2>/dev/null 'quoted text' local grep
+x=1 local printf awk sed -eu printf
+printf && echo echo --verbose
+grep x=1 2>/dev/null $(pwd) && local ${HOME}
+		printf x=1 -eu test "$@" export -eu | 'quoted text' grep export 2>/dev/null
+cd && 2>/dev/null 2>/dev/null sed
+		test printf /usr/bin "$@" then $(pwd) /usr/bin
+		x=1 awk "$1" readonly export sed awk export
+		cd --verbose ${HOME} /usr/bin awk --verbose cd $(pwd)
+	/usr/bin local -eu readonly export local $(pwd)
+then printf | grep "$1" | 'quoted text'
+echo done local test local sed then "$1" export test
+		done --verbose local "$1" "$@" && ${HOME}
+/usr/bin "$1" ${HOME} awk local ${HOME}
+	echo test "$1" grep /usr/bin x=1 cd 'quoted text'
+"$1" grep && -eu cd x=1 && sed then /usr/bin awk
+&& "$1" "$@" grep -eu ${HOME} sed | readonly printf grep then
+	${HOME} readonly | awk echo
+		awk --verbose awk readonly echo local sed echo x=1 ${HOME}
+"$@" test /usr/bin 2>/dev/null x=1 2>/dev/null
+then $(pwd) x=1 test --verbose done then x=1 done echo echo cd x=1 awk
+${HOME} done | awk export --verbose -eu test local /usr/bin
+	$(pwd) "$@" 'quoted text'
+then cd --verbose sed -eu -eu ${HOME} 'quoted text'
+		export done && "$@" ${HOME} ${HOME} then sed
+	printf -eu readonly "$@" local printf $(pwd) awk then ${HOME} done
+	grep ${HOME} cd sed cd grep readonly "$@" cd readonly "$1" awk "$1" "$@"
+		${HOME} then printf cd cd 2>/dev/null sed sed
+&& sed grep ${HOME} /usr/bin
+printf grep -eu printf then awk -eu sed test echo awk ${HOME}
+		cd $(pwd) cd sed && | "$1" awk printf echo echo -eu done test
+	'quoted text' && test ${HOME} 2>/dev/null grep "$1" then ${HOME} --verbose
+'quoted text' 2>/dev/null sed sed echo
+sed $(pwd) $(pwd) -eu test readonly --verbose -eu "$@" -eu ${HOME} awk test readonly
+		sed export && --verbose grep ${HOME} ${HOME}
+	test 2>/dev/null | done -eu done "$1" 'quoted text'
+		2>/dev/null $(pwd) done "$@" $(pwd) | then grep ${HOME} 'quoted text' awk test done
+		$(pwd) x=1 && /usr/bin --verbose | 'quoted text'
+	done x=1 "$1" test 2>/dev/null
+		$(pwd) cd awk x=1 local awk cd ${HOME} done local printf
+	$(pwd) && && echo "$1" export grep
+	"$1" "$1" "$@" done local $(pwd) test
+| x=1 "$1" "$@" -eu ${HOME} test ${HOME} 'quoted text'
+	cd test && --verbose printf sed grep ${HOME}
+	--verbose test echo done ${HOME}
+		export echo -eu done then | $(pwd)
+-eu x=1 "$1" $(pwd) grep test printf 2>/dev/null $(pwd) local
+	awk export /usr/bin echo $(pwd)
+local | test x=1 x=1 echo ${HOME}
+grep 'quoted text' $(pwd) awk awk /usr/bin "$1" echo local 'quoted text' echo
+		-eu /usr/bin sed x=1 test echo -eu 2>/dev/null printf /usr/bin
+	local -eu ${HOME} test export ${HOME} awk awk "$@" $(pwd)
+		done 'quoted text' cd export x=1 "$@" awk
+		grep -eu readonly done then echo && 2>/dev/null
+		--verbose then grep ${HOME} x=1 && ${HOME} then | 'quoted text' test --verbose
+		'quoted text' 'quoted text' local | sed readonly ${HOME} $(pwd) "$@" ${HOME}
+echo local 'quoted text' -eu --verbose test ${HOME} && readonly ${HOME} then 'quoted text'
+		--verbose cd $(pwd) "$@"
+test then readonly "$@" -eu test --verbose done export "$1" grep awk && /usr/bin
+$(pwd) /usr/bin echo cd
+$(pwd) test -eu done && /usr/bin then echo done export then local
+		$(pwd) done 2>/dev/null local printf
+	printf 2>/dev/null test readonly x=1 sed x=1 test then echo
+"$1" grep x=1 2>/dev/null echo --verbose export 'quoted text' 'quoted text'
+		2>/dev/null cd && local "$@" -eu && grep
+	done echo ${HOME} sed /usr/bin
+		local ${HOME} awk grep then /usr/bin
+		readonly 'quoted text' local echo readonly
+&& grep printf sed ${HOME} then -eu printf "$1" $(pwd)
+	&& printf awk x=1 && "$1" local
+awk 'quoted text' done && $(pwd) sed "$1" $(pwd) printf then "$@" done
+x=1 done /usr/bin ${HOME} --verbose $(pwd) local sed export
+then | && $(pwd) awk done then echo "$@"
+		"$@" awk test "$1" awk ${HOME} $(pwd)
+		x=1 "$1" grep /usr/bin && sed 2>/dev/null
+		--verbose local "$@" ${HOME} -eu 2>/dev/null "$@" printf ${HOME} export
+-eu readonly export | test echo grep sed ${HOME}
+		export --verbose local 2>/dev/null awk then ${HOME}
+printf /usr/bin 'quoted text' local "$1" printf readonly 'quoted text'
+	awk readonly cd printf test && cd awk readonly ${HOME} export
+		x=1 "$1" "$1" "$@" then readonly x=1 ${HOME} && printf done done
+	grep --verbose echo test $(pwd) then -eu
+export ${HOME} cd cd | "$1" x=1 "$1" $(pwd) ${HOME} x=1 cd readonly
+		x=1 "$1" "$@" 'quoted text'
+	readonly export awk done sed cd sed local then grep /usr/bin done
+"$1" x=1 echo then 2>/dev/null /usr/bin
+	--verbose x=1 export ${HOME} printf echo | -eu "$1" "$1" && echo awk local --verbose
+		then "$1" ${HOME} done awk 2>/dev/null x=1 2>/dev/null
+	$(pwd) sed then 'quoted text' sed test
+		x=1 -eu echo printf | x=1 export 'quoted text' | echo /usr/bin
+		2>/dev/null then echo ${HOME} awk grep done readonly -eu /usr/bin
+done ${HOME} sed sed sed readonly 'quoted text' cd "$@" --verbose
+printf awk sed "$1" export && -eu readonly 'quoted text' 'quoted text' | x=1
+		local $(pwd) printf --verbose export 2>/dev/null local ${HOME} cd --verbose cd
+--verbose grep test && printf -eu test
+${HOME} x=1 x=1 'quoted text' sed test -eu -eu readonly done x=1 readonly ${HOME}
+$(pwd) "$@" /usr/bin then "$@" sed local ${HOME} export
+		local -eu "$@" grep sed | printf test 'quoted text' "$@" 'quoted text'
+		grep x=1 'quoted text' 2>/dev/null readonly "$1" test sed 2>/dev/null
+awk awk /usr/bin readonly
+		export $(pwd) 2>/dev/null ${HOME} then readonly ${HOME} printf "$@"
+2>/dev/null ${HOME} readonly sed done "$1" -eu awk 2>/dev/null
+		awk --verbose local x=1 test "$@" grep printf
+	"$@" "$1" $(pwd) awk test /usr/bin printf grep 2>/dev/null echo 2>/dev/null test
+		2>/dev/null then cd grep "$1" echo export && cd 2>/dev/null
+	--verbose export local sed sed
+		sed test readonly export ${HOME} cd test
+	/usr/bin then 'quoted text' --verbose /usr/bin $(pwd) --verbose sed 2>/dev/null
+	-eu grep $(pwd) readonly awk && sed "$1" echo x=1
+&& done ${HOME} echo printf grep "$1"
+		-eu | then cd x=1 --verbose local readonly
+	printf grep echo export /usr/bin --verbose grep x=1 "$@" done && --verbose
+	${HOME} readonly readonly "$1" grep printf x=1
+	"$1" echo then awk "$@" "$@"
+		readonly local awk done test echo done $(pwd) -eu
+cd local 'quoted text' echo
+		test printf "$@" sed --verbose
+-eu 2>/dev/null readonly | local "$1" x=1 awk done $(pwd)
+	| cd printf "$@" export then
+		export -eu && --verbose 'quoted text' awk done printf
+		"$1" | --verbose | test ${HOME}
+		/usr/bin 'quoted text' sed $(pwd) local | printf && cd --verbose
+printf --verbose -eu export && printf then --verbose printf done
+	local cd cd local && && && "$@"
+		$(pwd) ${HOME} done --verbose test --verbose
+${HOME} test printf sed sed sed -eu /usr/bin
+	readonly x=1 export "$1" -eu export printf | printf 2>/dev/null echo export sed
+printf 'quoted text' x=1 printf -eu then "$1" echo --verbose local
+export -eu printf "$@" awk awk -eu --verbose && readonly readonly cd sed && echo
+	-eu /usr/bin export /usr/bin "$@" x=1 cd local awk grep | /usr/bin
+export local readonly local
+--verbose readonly grep $(pwd) then 'quoted text' -eu
+	${HOME} done printf printf
+	x=1 sed local /usr/bin then $(pwd) | cd 2>/dev/null
+		"$1" $(pwd) printf awk x=1 printf echo grep cd readonly
+	then $(pwd) | then then
+	2>/dev/null printf echo grep cd && done /usr/bin
+	2>/dev/null x=1 "$@" && 2>/dev/null
+		printf "$@" test export cd &&
+"$@" /usr/bin printf ${HOME}
+	$(pwd) cd $(pwd) sed awk local echo 2>/dev/null test "$@"
+		&& -eu $(pwd) printf 'quoted text'
+then readonly done done $(pwd) test sed done test cd -eu
+		'quoted text' $(pwd) test awk printf | grep
+		'quoted text' cd 'quoted text' readonly local && printf && grep ${HOME} then
+		"$1" echo ${HOME} done test && sed grep test local
+	printf then export done done "$1" && 2>/dev/null
+	awk then sed awk x=1 then
+${HOME} $(pwd) local done 'quoted text' test export
+'quoted text' cd | done printf "$@" && "$@"
+		echo /usr/bin readonly | test readonly local
+		"$1" cd /usr/bin | echo $(pwd) "$1"
+	'quoted text' awk 2>/dev/null grep echo --verbose 'quoted text'
+	then echo readonly x=1 -eu $(pwd) 2>/dev/null ${HOME} -eu /usr/bin
+	2>/dev/null ${HOME} $(pwd) export done grep x=1 test /usr/bin sed && -eu awk
+		&& printf "$@" && cd -eu "$1" "$1" && then echo local
+then /usr/bin test awk then sed sed ${HOME} -eu awk
+	'quoted text' echo then /usr/bin -eu echo x=1 /usr/bin
+	printf then /usr/bin --verbose && --verbose "$@" local
+	x=1 $(pwd) readonly done | -eu "$1" cd && "$@" echo x=1 --verbose
+| /usr/bin local --verbose
+	echo "$1" x=1 printf test -eu cd export $(pwd) $(pwd) "$@" $(pwd)
+		then awk | readonly x=1 "$1" awk 'quoted text' -eu
+		local -eu "$1" export test echo "$@" /usr/bin echo "$1" done grep
+		${HOME} x=1 test $(pwd) | readonly readonly
+| cd 2>/dev/null grep printf x=1 "$1" done ${HOME}
+-eu "$@" grep export "$@" $(pwd) local -eu /usr/bin awk
+	-eu x=1 x=1 grep then sed sed
+		then 2>/dev/null --verbose sed echo export
+/usr/bin "$1" then awk echo readonly "$1"
+local export printf then export /usr/bin done "$1"
+2>/dev/null cd "$@" "$@" "$@" &&
+		grep /usr/bin grep 2>/dev/null cd test 'quoted text' x=1 -eu
+local $(pwd) -eu | ${HOME}
+	&& grep export "$1" -eu 2>/dev/null "$1" then export "$1" | sed readonly
+local readonly test "$@" $(pwd) awk export
+		awk sed ${HOME} 'quoted text' sed cd done done local test | readonly /usr/bin
+done $(pwd) --verbose 'quoted text' ${HOME} 2>/dev/null "$1" ${HOME}
+	x=1 export 2>/dev/null export && sed "$1" 2>/dev/null done then "$1" export export
+cd cd x=1 export cd readonly printf sed $(pwd) awk printf
+	then done "$1" grep /usr/bin --verbose $(pwd) awk echo $(pwd)
+		&& awk | export then then /usr/bin --verbose 'quoted text' /usr/bin $(pwd)
+		${HOME} local test awk
+		sed awk export then "$1" echo $(pwd) "$1" /usr/bin ${HOME}
+		2>/dev/null && -eu then /usr/bin 2>/dev/null echo test echo done
+readonly --verbose cd export "$@" 2>/dev/null
+		test sed 'quoted text' x=1 local printf "$1"
+$(pwd) done 'quoted text' readonly echo -eu echo 2>/dev/null "$1" "$1"
+printf test echo sed printf "$1" /usr/bin /usr/bin printf readonly
+readonly readonly cd && -eu then
+'quoted text' 'quoted text' then -eu --verbose printf cd "$@" 2>/dev/null
+printf x=1 | && -eu $(pwd) printf -eu $(pwd) grep printf
+	export done | "$1" -eu grep local sed | export grep
+		echo -eu "$1" local local 2>/dev/null test awk local && sed -eu
+		${HOME} sed export awk local grep test then "$@" export
+	grep cd -eu 'quoted text' printf done sed "$@" --verbose 2>/dev/null echo readonly
+	-eu "$@" -eu | sed local awk 2>/dev/null "$@" --verbose "$1" /usr/bin cd $(pwd)
+	${HOME} test $(pwd) | then test | echo --verbose export sed $(pwd)
+	local 'quoted text' -eu test
+	cd done readonly 2>/dev/null done -eu printf && "$1" "$@" /usr/bin
+	then cd | 2>/dev/null "$@" sed
+$(pwd) 'quoted text' 'quoted text' cd -eu then sed ${HOME}
+	readonly $(pwd) | cd awk "$1" cd awk "$@" echo readonly grep
+	&& | awk local test echo --verbose test
+		2>/dev/null 'quoted text' --verbose 2>/dev/null
+	"$@" sed -eu cd printf x=1 export 'quoted text' $(pwd) awk awk
+local cd awk -eu cd | done export local grep x=1 | && "$1" /usr/bin
+		x=1 && done 'quoted text' x=1 $(pwd) awk 2>/dev/null cd
+		$(pwd) "$1" readonly then printf "$@" export ${HOME} grep
+		${HOME} ${HOME} | "$@" --verbose
+	'quoted text' printf 2>/dev/null awk $(pwd) test readonly /usr/bin 'quoted text'
+-eu printf --verbose grep echo export awk readonly export
+| --verbose cd local export "$1" "$@"
+	-eu cd -eu ${HOME} ${HOME}
+	&& x=1 done then "$1" "$@" done printf -eu export /usr/bin
+echo ${HOME} -eu test awk done grep export done
+	test printf local sed
+	'quoted text' then sed grep -eu $(pwd) grep | $(pwd) done /usr/bin awk x=1
+		awk "$1" $(pwd) echo test
+		local /usr/bin export done ${HOME} x=1 local "$@" && x=1 done 'quoted text'
+		&& local sed -eu "$1" sed "$1" then | export awk "$1" "$@" echo
+	done grep && -eu echo "$1" done readonly
+	local --verbose awk | | local awk 'quoted text' awk | x=1 "$@" readonly
+		done 'quoted text' --verbose "$@"
+cd printf echo "$@" /usr/bin -eu then -eu "$@" && grep "$@"
+"$1" readonly grep x=1 ${HOME} export |
+export export awk grep printf cd test 2>/dev/null done
+		$(pwd) 2>/dev/null cd awk -eu export
+2>/dev/null local "$@" 'quoted text' sed sed /usr/bin readonly -eu
+		-eu readonly 2>/dev/null done printf | /usr/bin
+${HOME} -eu | && x=1 && --verbose then sed $(pwd) done x=1 awk then done |
+grep 'quoted text' 'quoted text' readonly
+'quoted text' echo export "$1" readonly grep echo local
+		then test && /usr/bin --verbose 2>/dev/null echo && /usr/bin
+	--verbose test 2>/dev/null $(pwd) /usr/bin echo
+	&& -eu ${HOME} done then done ${HOME}
+	$(pwd) && 'quoted text' ${HOME} then 2>/dev/null readonly ${HOME} /usr/bin "$1"
+	2>/dev/null test readonly && $(pwd) -eu sed "$1" ${HOME} sed local 'quoted text'
+		| printf cd then grep | "$1" ${HOME} local readonly cd then then
+	"$1" -eu "$1" && && awk sed /usr/bin cd printf x=1 | $(pwd) then 2>/dev/null
+		test -eu -eu 'quoted text' --verbose then "$1" 2>/dev/null export test
+		awk local cd 'quoted text' 'quoted text' done /usr/bin local $(pwd) test
+		export readonly 'quoted text' x=1 ${HOME}
+		-eu local sed sed printf /usr/bin ${HOME}
+cd cd "$1" ${HOME} "$1" 2>/dev/null
+	| && "$1" cd local "$@" 'quoted text'
+	"$@" test echo --verbose x=1 test -eu | --verbose
+then export "$1" local 'quoted text' test done /usr/bin
+&& then 2>/dev/null cd && && then 2>/dev/null grep ${HOME} sed
+x=1 "$1" grep then -eu "$@" grep | done /usr/bin cd ${HOME} echo
+		echo local sed /usr/bin "$1" $(pwd) "$1" "$@" 2>/dev/null
+	$(pwd) done echo printf ${HOME} local
+		| && --verbose local 'quoted text' echo awk 2>/dev/null
+	&& ${HOME} local | 'quoted text' $(pwd) done then readonly
+	sed | /usr/bin done awk 2>/dev/null
+-eu "$@" printf sed -eu 'quoted text' ${HOME}
+	local export 'quoted text' "$@" printf x=1 cd | 'quoted text' test
+		test "$1" -eu "$@" $(pwd) echo awk /usr/bin ${HOME}
+		/usr/bin test grep --verbose 2>/dev/null done $(pwd) $(pwd) awk -eu readonly
+	-eu export awk --verbose
+	${HOME} done done && && 2>/dev/null --verbose export export readonly
+${HOME} --verbose "$1" grep 2>/dev/null -eu -eu
+	${HOME} echo local 2>/dev/null $(pwd) $(pwd) then "$@" done "$@" test printf
+done echo 2>/dev/null x=1 test readonly test ${HOME} awk 'quoted text'
+local grep ${HOME} readonly awk x=1 cd ${HOME} test local done
+		cd $(pwd) "$@" && export done x=1
+		x=1 $(pwd) grep cd "$1" $(pwd)
+		/usr/bin done ${HOME} ${HOME} &&
+	test 'quoted text' awk --verbose && | 2>/dev/null "$@" export x=1 echo x=1
+		${HOME} readonly 2>/dev/null 2>/dev/null readonly 2>/dev/null grep export echo
+	&& sed test local cd "$1" then "$1" | "$@" "$@"
+cd --verbose readonly echo "$@" cd local test ${HOME} sed export
+		/usr/bin $(pwd) /usr/bin --verbose | test x=1 done done export 2>/dev/null
+echo 2>/dev/null "$1" 2>/dev/null
+then /usr/bin ${HOME} sed | grep awk
+		test /usr/bin $(pwd) --verbose awk | ${HOME} "$1" x=1 -eu
+/usr/bin readonly test ${HOME} x=1 cd &&
+local printf printf &&
+'quoted text' done then "$1" grep "$@" cd 'quoted text'
+local -eu --verbose x=1 export export printf && /usr/bin
+&& 'quoted text' cd sed cd | grep "$@" $(pwd) --verbose awk export
+	-eu cd 2>/dev/null grep ${HOME} cd 'quoted text' then "$@" echo printf printf
+	sed x=1 'quoted text' local | local -eu $(pwd) then export 2>/dev/null echo
+		${HOME} 2>/dev/null $(pwd) test -eu sed awk ${HOME} 2>/dev/null "$@" awk grep
+		${HOME} x=1 | awk test 2>/dev/null 2>/dev/null
+export awk -eu printf x=1 x=1 | printf
+		export then 'quoted text' printf echo /usr/bin export "$1" then
+--verbose export sed && test readonly $(pwd)
+	'quoted text' | --verbose --verbose awk | sed echo grep "$@" awk
+	&& echo grep x=1 done "$@" export | then done cd x=1 done /usr/bin $(pwd)
+	printf awk then x=1 "$1" $(pwd) --verbose && printf ${HOME} |
+		"$1" cd --verbose 2>/dev/null --verbose && -eu --verbose done
+-eu 'quoted text' ${HOME}
+		local | --verbose /usr/bin
+export test | 2>/dev/null "$@" ${HOME} x=1 local readonly
+		-eu done sed --verbose x=1 grep -eu cd $(pwd) && awk && x=1 "$@" "$@" grep /usr/bin
+	grep "$@" $(pwd) echo sed $(pwd) 'quoted text' test | | echo "$@" /usr/bin grep
+awk --verbose x=1 $(pwd) echo ${HOME}
+	${HOME} grep readonly
+"$@" ${HOME} -eu test
+export test then && readonly "$@"
+		"$@" "$@" grep test |
+		"$1" $(pwd) done readonly awk $(pwd) sed grep 2>/dev/null test &&
+"$@" then "$1" /usr/bin then sed cd sed &&
+		printf $(pwd) test readonly | --verbose export grep local 2>/dev/null --verbose
+	${HOME} test printf /usr/bin
+"$1" /usr/bin sed "$@" grep --verbose
+2>/dev/null 'quoted text' -eu awk local 'quoted text' --verbose
+	awk && /usr/bin done cd
+		--verbose | "$1" 2>/dev/null | && /usr/bin done readonly
+	printf --verbose --verbose | &&
+	-eu sed cd then $(pwd) echo printf test
+		$(pwd) 'quoted text' printf "$@" then awk done cd sed awk then
+--verbose local x=1 "$1" export x=1 x=1 cd readonly 2>/dev/null
+		export awk done 'quoted text' echo x=1
+| ${HOME} -eu ${HOME} sed $(pwd)
+	"$@" "$1" ${HOME} "$1" "$@" awk -eu awk $(pwd) readonly
+		export awk done local $(pwd) -eu ${HOME} test local test printf export
+	printf $(pwd) /usr/bin local 'quoted text'
+local "$@" sed awk done
+		export done --verbose export ${HOME} local export sed "$1" then export
+"$@" /usr/bin && /usr/bin done
+"$@" 'quoted text' x=1 --verbose
+"$@" | 'quoted text' 'quoted text' /usr/bin grep --verbose -eu $(pwd) | echo
+		sed 2>/dev/null then printf x=1
+cd local awk | grep 'quoted text' readonly "$1" | /usr/bin local x=1 test
+	| /usr/bin echo ${HOME}
+	| export $(pwd) readonly readonly
+		x=1 printf /usr/bin 2>/dev/null
+		| sed done then 2>/dev/null && grep |
+grep export echo 'quoted text' awk export
+		&& cd /usr/bin ${HOME}
+x=1 2>/dev/null --verbose sed readonly grep && grep
+		then 'quoted text' sed /usr/bin printf cd -eu grep test
+	local sed && awk echo cd readonly $(pwd) -eu echo test readonly "$@" $(pwd)
+"$1" "$@" "$1" cd local printf grep
+	printf 'quoted text' sed $(pwd) grep -eu 'quoted text'
+echo x=1 'quoted text' $(pwd) /usr/bin
+awk export awk 2>/dev/null local cd
+	| local 2>/dev/null 'quoted text' $(pwd) sed
+		| test 'quoted text' "$1" local then 2>/dev/null x=1 /usr/bin /usr/bin
+		x=1 printf cd sed sed readonly 'quoted text'
+		sed $(pwd) awk sed grep --verbose
+		--verbose sed echo grep --verbose 2>/dev/null grep sed ${HOME} local -eu
+	awk grep 2>/dev/null 2>/dev/null ${HOME}
+	'quoted text' --verbose grep
+	"$@" local && "$@" readonly ${HOME} test 'quoted text' readonly /usr/bin then --verbose
+grep readonly 'quoted text' then 'quoted text'
+		${HOME} "$@" test printf "$1" "$1"
+test awk echo 2>/dev/null --verbose
+		/usr/bin local $(pwd) sed readonly ${HOME} /usr/bin readonly 'quoted text'
+		/usr/bin readonly ${HOME}
+	$(pwd) && cd done 'quoted text' "$1" cd x=1
+	echo $(pwd) sed echo 'quoted text'
+	x=1 $(pwd) --verbose /usr/bin echo then test then sed 'quoted text' grep
+	readonly x=1 export /usr/bin echo ${HOME} sed | "$1" printf
+| -eu printf && ${HOME} | test 'quoted text'
+		awk done | | "$1" x=1 ${HOME} "$1" done /usr/bin
+		&& "$1" | 'quoted text' /usr/bin grep x=1 printf /usr/bin 'quoted text'
+	${HOME} grep "$@" "$@" then $(pwd) /usr/bin
+cd grep printf awk cd | export --verbose printf "$@" grep x=1 done printf
+	-eu && --verbose printf -eu ${HOME} readonly | then local
+-eu sed awk -eu x=1 -eu done -eu done sed 2>/dev/null 'quoted text'
+	$(pwd) ${HOME} done | echo "$1" readonly
+export sed export grep 2>/dev/null done export readonly && "$@"
+		awk && $(pwd) | 2>/dev/null | -eu
+	done export $(pwd) echo printf ${HOME} test cd | grep readonly --verbose local
+		readonly local done --verbose
+	'quoted text' then -eu 2>/dev/null ${HOME} test --verbose $(pwd) echo awk
+		--verbose "$1" export readonly && readonly "$1" cd /usr/bin
+cd && then --verbose | echo /usr/bin readonly printf awk
+	"$@" export export x=1 && done "$@" | "$1" | $(pwd) "$1" readonly $(pwd) test printf
+		then 'quoted text' done /usr/bin grep
+$(pwd) $(pwd) printf --verbose $(pwd) "$1" | echo readonly
+&& grep "$1" --verbose 'quoted text' /usr/bin ${HOME} "$1" cd 'quoted text'
+	then readonly awk && ${HOME} && | cd readonly local sed && x=1
+done && "$1" grep "$1" -eu readonly test done printf x=1 'quoted text' ${HOME}
+	then && /usr/bin sed && done 2>/dev/null awk x=1
+		/usr/bin --verbose then && 'quoted text'
+		| grep "$1" | echo then x=1 | 'quoted text'
+${HOME} "$1" sed awk 'quoted text' ${HOME} "$1" then "$1"
+echo ${HOME} $(pwd) ${HOME} | awk
+		'quoted text' sed test test 'quoted text'
+		cd /usr/bin -eu -eu export
+| done test && done -eu local done $(pwd) grep "$@"
+	2>/dev/null local | 'quoted text' grep /usr/bin
+		awk 2>/dev/null test 'quoted text' done "$1" /usr/bin -eu $(pwd)
+done 'quoted text' printf 2>/dev/null "$1" $(pwd)
+		x=1 cd cd grep grep "$@" readonly 'quoted text' && local awk readonly
+done cd cd echo $(pwd) awk -eu readonly export "$@" $(pwd)
+		export /usr/bin -eu printf ${HOME} 'quoted text' printf
+		export done echo printf -eu && sed $(pwd) x=1 2>/dev/null done
+		echo /usr/bin printf /usr/bin
+		${HOME} x=1 --verbose | cd -eu test | then "$1" x=1 cd printf cd then --verbose
+		readonly --verbose awk
+		local "$@" 2>/dev/null export test printf done -eu "$1" echo
+	| test printf "$@" 'quoted text' 2>/dev/null readonly &&
+		${HOME} awk "$@" test --verbose 2>/dev/null export
+	cd then echo export local /usr/bin
+	| "$1" then done sed "$@" echo test /usr/bin
+		/usr/bin echo "$1" /usr/bin test $(pwd)
+		${HOME} x=1 cd "$@" $(pwd)
+		local 2>/dev/null "$1" x=1 test -eu then done 'quoted text' --verbose
+sed "$1" "$@" 'quoted text' echo "$1" done then ${HOME} && | $(pwd)
+&& then awk && export /usr/bin "$@"
+		"$1" "$@" $(pwd) ${HOME} cd
+		printf 'quoted text' printf local echo export $(pwd) cd cd && export readonly
+		--verbose done grep sed cd awk grep "$@" test --verbose
+		x=1 grep then test && export "$@"
+'quoted text' sed $(pwd) cd printf --verbose
+	printf printf cd "$1" $(pwd) echo 'quoted text' | -eu 2>/dev/null --verbose
+		"$@" test printf test readonly && $(pwd) local && grep -eu grep
+"$@" --verbose x=1 2>/dev/null "$1" grep -eu 'quoted text' sed local ${HOME}
+		-eu cd ${HOME} $(pwd) "$@" sed grep --verbose awk test then "$1"
+		local /usr/bin then /usr/bin echo echo local awk sed --verbose
+		sed awk done readonly --verbose "$@" sed $(pwd) | export done
+x=1 ${HOME} "$@" | /usr/bin /usr/bin /usr/bin "$@" grep
+	"$1" printf local readonly --verbose sed export sed x=1 echo | $(pwd) --verbose
+	test cd /usr/bin cd test export $(pwd) $(pwd) test export export -eu
+		"$@" awk test && | awk then "$1" sed "$1" -eu awk sed $(pwd) $(pwd)
+readonly printf 'quoted text' test x=1 local
+		-eu awk then "$1" then --verbose -eu
+| export cd x=1 $(pwd) printf test
+		sed done ${HOME} readonly echo 2>/dev/null ${HOME} printf "$1"
+		awk $(pwd) /usr/bin done ${HOME} export $(pwd) readonly 'quoted text'
+"$1" grep local printf ${HOME} | printf -eu x=1 "$1" echo
+/usr/bin x=1 readonly x=1 "$1" 'quoted text' /usr/bin 'quoted text'
+		done | echo sed awk --verbose --verbose x=1 && "$@" awk "$@"
+	| sed echo echo "$1" done readonly sed local "$@" cd cd $(pwd) test /usr/bin export
+awk | /usr/bin x=1 2>/dev/null
+${HOME} grep ${HOME} then grep local x=1 --verbose 2>/dev/null
+grep readonly echo "$@" readonly sed | "$1" cd export 'quoted text' grep
+grep echo then cd 'quoted text' ${HOME}
+		2>/dev/null && printf $(pwd) "$@" 2>/dev/null 2>/dev/null grep local test
+		$(pwd) grep /usr/bin $(pwd) "$1" done ${HOME}
+	| cd done -eu local sed 2>/dev/null && --verbose
+	cd "$@" then 'quoted text' && printf local export
+		awk sed | then test "$@"
+	echo 2>/dev/null $(pwd) awk $(pwd) readonly cd -eu awk
+export && then 2>/dev/null cd then
+		export 2>/dev/null readonly
+		echo && ${HOME} printf grep x=1 awk "$@" "$1" x=1 test
+	awk --verbose done local local grep
+then awk | sed ${HOME} --verbose done -eu 2>/dev/null | local export cd "$1"
+		sed readonly cd then cd x=1 grep
+x=1 printf --verbose && $(pwd) | $(pwd) sed then x=1 "$@" test export --verbose
+local /usr/bin "$1" | cd sed printf export &&
+	"$1" export test -eu | cd 2>/dev/null --verbose ${HOME} x=1 cd /usr/bin then
+/usr/bin readonly grep echo awk then readonly awk test --verbose then local
+		$(pwd) "$@" then 2>/dev/null local "$@" "$1" /usr/bin --verbose
+		| 2>/dev/null && $(pwd) echo x=1 /usr/bin
+printf && export 'quoted text' && -eu export printf --verbose
+	local awk local local printf cd "$1" x=1 /usr/bin
+		&& local | ${HOME} 'quoted text'
+awk --verbose test readonly -eu local $(pwd) then local | && local | grep
+"$@" cd 2>/dev/null done ${HOME} "$1" sed $(pwd) /usr/bin /usr/bin /usr/bin
+	export echo "$1" "$1" | 2>/dev/null && x=1 done test --verbose test --verbose
+		| "$@" 2>/dev/null /usr/bin readonly 2>/dev/null export printf
+"$1" 2>/dev/null $(pwd) printf --verbose done cd
+		/usr/bin x=1 $(pwd) ${HOME} "$1" grep "$1"
+		'quoted text' 'quoted text' --verbose cd "$@" "$@" sed "$@" x=1 local echo
+	2>/dev/null echo && "$@" "$@" grep | echo ${HOME} done
+		2>/dev/null sed && local $(pwd) -eu echo "$@" "$@" done export
+	${HOME} readonly "$1" -eu awk | done /usr/bin --verbose
+	"$1" sed test local x=1 "$1" 'quoted text' sed readonly export grep ${HOME} "$@"
+		"$@" /usr/bin 2>/dev/null echo | grep --verbose ${HOME}
+		echo then && local local | | echo local "$1" "$@" cd then local test && sed && "$@"
+		then ${HOME} done -eu sed && ${HOME} local done --verbose $(pwd) done
+	done grep "$@" 'quoted text' echo /usr/bin awk grep --verbose printf cd
+cd export local --verbose 'quoted text'
+then "$1" local readonly grep 'quoted text'
+2>/dev/null /usr/bin readonly 2>/dev/null sed printf readonly
+	echo && -eu x=1 then sed cd export
+		export --verbose grep echo 'quoted text' ${HOME} export export x=1 then
+grep $(pwd) -eu 'quoted text' | export -eu x=1 $(pwd)
+	2>/dev/null -eu ${HOME} printf export printf cd done grep export 'quoted text'
+then && 2>/dev/null && /usr/bin then local | readonly /usr/bin
+awk test ${HOME} "$1" ${HOME} /usr/bin
+		$(pwd) $(pwd) -eu -eu then grep $(pwd) --verbose -eu done done 'quoted text'
+	/usr/bin sed export | test "$@" /usr/bin cd then
+	printf -eu /usr/bin --verbose test export test grep grep readonly x=1 cd sed
+		'quoted text' 2>/dev/null readonly local test 2>/dev/null sed "$1"
+awk awk sed local --verbose 2>/dev/null --verbose
+| | test grep /usr/bin done 2>/dev/null $(pwd) local sed 'quoted text'
+	-eu | 2>/dev/null echo export printf --verbose 'quoted text'
+		$(pwd) test 'quoted text' local $(pwd)
+-eu awk echo "$@" awk echo ${HOME} grep "$@" --verbose echo
+	"$1" printf -eu 'quoted text' then $(pwd) then 2>/dev/null
+	'quoted text' $(pwd) ${HOME} --verbose -eu then readonly local /usr/bin
+		-eu printf --verbose sed echo
+	done done sed printf 'quoted text' | "$1" && grep -eu 'quoted text'
+sed readonly readonly /usr/bin 'quoted text'
+		readonly | "$1" "$@" grep --verbose 'quoted text'
+| 2>/dev/null sed then && | cd 2>/dev/null echo -eu --verbose cd && 2>/dev/null
+		${HOME} then x=1 readonly /usr/bin | "$1" echo "$1" readonly && then
+| | readonly done | sed --verbose $(pwd) awk awk x=1 done x=1 export cd
+done -eu local test -eu &&
+	"$1" grep then echo && printf
+cd $(pwd) $(pwd) $(pwd) export readonly /usr/bin "$1" -eu sed done "$@" local
+| ${HOME} /usr/bin x=1 printf --verbose printf awk | 2>/dev/null ${HOME}
+		cd then $(pwd) then "$1" "$1" 'quoted text'
+		then export cd 'quoted text' readonly echo
+readonly sed cd "$1" printf $(pwd) export
+	export done x=1 echo done
+	readonly ${HOME} awk printf echo -eu 'quoted text'
+		awk --verbose | sed cd export 2>/dev/null 'quoted text' cd
+	'quoted text' --verbose test "$1" 'quoted text' export grep cd printf x=1
+		awk test "$@" test -eu 'quoted text'
+		done $(pwd) /usr/bin | x=1 done 2>/dev/null export done sed
+		&& then x=1 done then "$1" && grep readonly &&
+		--verbose grep done ${HOME} ${HOME} printf export --verbose
+		${HOME} local export cd "$@" local export
+	grep done cd /usr/bin 'quoted text' awk test "$1"
+echo then "$1" /usr/bin && 2>/dev/null
+		local awk export --verbose printf export grep && 2>/dev/null
+		export "$1" readonly readonly "$1" ${HOME} local && printf
+		"$@" x=1 "$1" 2>/dev/null done $(pwd) x=1
+2>/dev/null && sed | x=1
+local test then printf "$@" | x=1 test grep grep "$1" test /usr/bin printf
+	${HOME} cd cd test 2>/dev/null "$@" local grep
+	test test 2>/dev/null 2>/dev/null
+		awk $(pwd) 'quoted text' grep done && "$1"
+'quoted text' awk /usr/bin | readonly
+then grep -eu readonly export | done "$@" "$@" awk 'quoted text' 2>/dev/null
+		awk -eu echo ${HOME} grep echo printf local readonly $(pwd) cd 2>/dev/null
+		'quoted text' grep -eu -eu awk done
+		echo grep --verbose awk done /usr/bin readonly local
+	"$1" sed grep local && --verbose 2>/dev/null printf $(pwd)
@@ -0,0 +1,2001 @@
+x=1 "$@" -eu grep export && "$1" readonly ${HOME} export
+2>/dev/null test $(pwd) export readonly echo x=1 done --verbose "$1" done && x=1
+	export | --verbose local done ${HOME} local echo 2>/dev/null
+		x=1 awk ${HOME} export printf "$@" ${HOME} done echo --verbose sed "$1" local
+	cd "$@" done ${HOME} $(pwd) && | readonly "$1"
+	test sed $(pwd) grep cd && test 2>/dev/null
+		"$@" export | -eu done && "$@" test cd "$1" | done echo 'quoted text' done -eu
+	awk 2>/dev/null done awk awk 'quoted text' test ${HOME} awk 'quoted text'
+		--verbose cd awk ${HOME} 'quoted text' readonly grep test grep -eu export
+	| -eu "$@" && then echo | && | "$@" "$@" grep "$@"
+	then done 'quoted text' -eu sed /usr/bin readonly cd awk
+	-eu 'quoted text' cd local x=1 done --verbose local && --verbose
+		2>/dev/null "$1" | echo
+	sed grep done then x=1 local && local awk export 'quoted text'
+	"$@" readonly && "$@" local 2>/dev/null 2>/dev/null 2>/dev/null $(pwd) awk
+	then -eu -eu 2>/dev/null $(pwd) readonly | /usr/bin cd | sed 'quoted text'
+		'quoted text' echo -eu -eu cd ${HOME} 2>/dev/null
+		| sed $(pwd) "$@" grep readonly /usr/bin grep && then readonly grep
+	export x=1 | 2>/dev/null "$1" ${HOME} readonly x=1 $(pwd)
+	"$1" /usr/bin grep 2>/dev/null
+local /usr/bin -eu $(pwd) 'quoted text' printf test x=1
+		"$1" --verbose local sed "$1" $(pwd) awk readonly echo test awk ${HOME} export
+		done done grep "$@" test ${HOME} && --verbose "$1" --verbose
+	'quoted text' "$@" echo export "$@"
+| -eu --verbose awk && echo "$@" echo $(pwd) x=1 readonly then --verbose
+		| export x=1 then | test | -eu sed
+| awk x=1 | /usr/bin cd echo awk 2>/dev/null
+		awk awk 'quoted text' $(pwd) $(pwd) ${HOME} awk local readonly
+		x=1 grep readonly && readonly done "$@" |
+printf /usr/bin sed test local && 2>/dev/null "$1" cd awk x=1 readonly
+		"$@" && then cd 'quoted text' | then grep -eu 'quoted text'
+	$(pwd) grep "$1" && ${HOME} $(pwd) /usr/bin awk sed && x=1 cd local
+		printf $(pwd) 2>/dev/null
+	printf grep export local --verbose local local readonly $(pwd)
+		&& done x=1 --verbose && && | && "$1" then grep cd /usr/bin "$@" 'quoted text'
+		awk | 2>/dev/null $(pwd) printf echo printf /usr/bin | cd x=1 export $(pwd)
+		grep 2>/dev/null "$@" 'quoted text' $(pwd) readonly then export /usr/bin
+echo --verbose then "$@" then export --verbose x=1 sed
+		grep | export cd ${HOME} 2>/dev/null $(pwd)
+2>/dev/null printf ${HOME}
+done -eu test then ${HOME} sed && cd readonly $(pwd)
+export readonly -eu done
+	x=1 grep -eu awk awk 'quoted text'
+printf awk readonly "$1" test | 'quoted text' x=1 readonly /usr/bin
+--verbose $(pwd) && "$1" $(pwd) && x=1 test sed "$1" test "$1"
+'quoted text' "$1" | printf 2>/dev/null local printf | --verbose
+		awk grep | printf "$1" x=1 'quoted text' 2>/dev/null && &&
+	local test 2>/dev/null x=1 && -eu
+		echo x=1 -eu x=1 printf then |
+printf awk "$@" | then x=1 "$1" grep readonly /usr/bin
+		sed $(pwd) local -eu ${HOME} "$1" --verbose done done
+	done | /usr/bin printf | printf /usr/bin
+export awk 'quoted text' done grep x=1 && echo $(pwd) then -eu sed
+	local awk | grep "$@" 'quoted text' -eu /usr/bin echo
+		"$@" | --verbose readonly awk "$@" printf then 'quoted text' "$@"
+	${HOME} done ${HOME} x=1 cd /usr/bin printf -eu readonly "$@" $(pwd)
+sed /usr/bin $(pwd) grep export |
+	$(pwd) echo -eu "$@" $(pwd) printf -eu | local ${HOME} grep cd readonly $(pwd)
+	test echo local -eu ${HOME} cd x=1 x=1 test x=1 then | 2>/dev/null
+-eu printf $(pwd) "$@" --verbose && grep printf 'quoted text' 2>/dev/null &&
+$(pwd) then test $(pwd) x=1 grep test && then
+		&& "$1" printf awk readonly
+	cd "$1" done echo x=1 cd 'quoted text'
+		readonly done "$@" echo export 'quoted text' cd
+		"$1" | grep 'quoted text' "$1" x=1 'quoted text' "$@" grep x=1 readonly printf
+	awk | 'quoted text' grep 'quoted text' --verbose
+		--verbose 2>/dev/null "$@" x=1 | | local then sed "$1" && readonly done grep
+	2>/dev/null 'quoted text' $(pwd) sed
+	then 'quoted text' 'quoted text' then x=1 cd readonly
+'quoted text' --verbose x=1 readonly 2>/dev/null 'quoted text'
+	/usr/bin export | | x=1 -eu sed
+		printf --verbose x=1 test x=1
+	test ${HOME} "$1" "$1" printf /usr/bin x=1 then done readonly "$@" 'quoted text'
+sed "$@" | readonly "$@" then readonly "$@"
+2>/dev/null then -eu local 'quoted text' x=1
+		/usr/bin printf printf grep --verbose ${HOME} local export
+		done x=1 printf && grep x=1 sed -eu -eu ${HOME} test
+then then readonly local $(pwd) 2>/dev/null
+"$1" test printf 'quoted text'
+export 2>/dev/null printf readonly done cd readonly printf then cd done echo
+-eu $(pwd) $(pwd) sed x=1 x=1 sed
+readonly done printf && 2>/dev/null
+awk | then readonly export ${HOME} | /usr/bin awk grep sed 2>/dev/null test 2>/dev/null
+readonly echo 'quoted text' then printf $(pwd) && | cd done 'quoted text'
+		then local | test 'quoted text' awk 2>/dev/null 2>/dev/null test
+| export echo "$@" export ${HOME} ${HOME} x=1 then printf sed readonly printf -eu
+	2>/dev/null readonly then readonly export then export 'quoted text'
+		readonly /usr/bin done then 2>/dev/null x=1 awk x=1
+	awk cd $(pwd) test export cd $(pwd)
+	printf printf "$@" 'quoted text' done sed grep && export $(pwd) test x=1 --verbose
+local | 2>/dev/null echo | awk x=1 ${HOME}
+test cd grep done --verbose |
+		&& echo "$1" ${HOME} 'quoted text' printf
+&& test /usr/bin 'quoted text' test x=1 printf "$1"
+	export $(pwd) printf ${HOME} printf printf grep ${HOME} ${HOME}
+grep readonly --verbose test x=1
+		then x=1 test | cd x=1 2>/dev/null -eu readonly | | /usr/bin $(pwd)
+	sed "$@" printf then x=1 | "$@" --verbose
+	readonly $(pwd) /usr/bin /usr/bin then $(pwd) -eu done cd ${HOME}
+		awk then "$1" | printf sed ${HOME} readonly /usr/bin 2>/dev/null echo
+	sed x=1 /usr/bin test 'quoted text'
+		/usr/bin cd readonly cd 'quoted text'
+grep cd x=1 x=1 x=1 -eu awk 2>/dev/null grep --verbose
+	local local --verbose /usr/bin "$@" ${HOME} --verbose readonly
+		awk grep $(pwd) -eu x=1 2>/dev/null then readonly done local
+		--verbose 'quoted text' export ${HOME} local "$@" 2>/dev/null
+	then export local awk done local
+		echo done export sed 'quoted text' test sed
+		test && grep /usr/bin $(pwd) cd printf export
+		"$1" | 2>/dev/null -eu export
+-eu sed sed x=1 ${HOME} awk "$1" echo /usr/bin readonly 2>/dev/null --verbose
+x=1 "$1" then /usr/bin -eu test | "$@" sed
+&& -eu readonly sed 'quoted text' -eu
+	readonly local x=1 "$1" $(pwd) "$1" cd then
+		--verbose "$1" ${HOME} x=1 cd ${HOME} -eu x=1 echo "$1" echo
+cd && $(pwd) export /usr/bin --verbose
+		local echo readonly test awk "$@" cd -eu readonly
+	--verbose test 'quoted text' | "$1" 'quoted text' "$1"
+		'quoted text' --verbose 2>/dev/null x=1 --verbose printf then "$@"
+	${HOME} /usr/bin /usr/bin 2>/dev/null "$@" readonly grep -eu readonly | echo "$@"
+"$1" -eu | grep local 'quoted text' --verbose ${HOME}
+	done 2>/dev/null done 2>/dev/null
+echo cd 2>/dev/null echo /usr/bin | $(pwd) cd done "$@" echo "$1" 2>/dev/null sed
+	then "$1" $(pwd) $(pwd) "$@" awk x=1
+	readonly then 2>/dev/null $(pwd) test done then -eu export
+		awk grep "$1" cd grep cd readonly export test readonly x=1 ${HOME} awk 2>/dev/null
+	grep cd $(pwd) 'quoted text' x=1 x=1 export sed export
+	"$1" | done local ${HOME} x=1 -eu "$@"
+		-eu $(pwd) local /usr/bin "$@"
+		cd printf "$1" local awk
+x=1 -eu ${HOME} x=1 "$1" then /usr/bin then 'quoted text'
+	$(pwd) ${HOME} "$1" | -eu "$@" printf --verbose
+&& 2>/dev/null readonly awk ${HOME}
+		2>/dev/null --verbose 'quoted text'
+export "$@" x=1 grep cd && 'quoted text' test echo echo
+		done grep grep done test /usr/bin then then &&
+	printf | | 'quoted text' cd "$@" sed &&
+done && "$1" | /usr/bin | /usr/bin grep --verbose done x=1 "$1" local grep
+		export -eu x=1 cd local readonly ${HOME} echo
+sed | --verbose "$1" "$@"
+	--verbose $(pwd) awk done $(pwd) /usr/bin readonly
+	'quoted text' cd test readonly
+		"$1" local grep export
+	&& export echo x=1 --verbose grep /usr/bin /usr/bin "$1" echo then "$1" |
+x=1 export | && echo awk local $(pwd) readonly 2>/dev/null
+	export test x=1 awk sed | --verbose done | local "$1"
+		x=1 'quoted text' echo /usr/bin cd printf $(pwd) cd printf
+| cd && printf "$1" | export | x=1 x=1
+"$@" cd | "$1" -eu "$@" --verbose readonly /usr/bin done --verbose
+		then local grep $(pwd) ${HOME} grep readonly
+	sed test export $(pwd) local ${HOME} done grep ${HOME} /usr/bin printf
+		$(pwd) 'quoted text' test done printf then
+	export grep -eu /usr/bin | readonly then cd grep done then /usr/bin cd x=1 sed
+cd "$@" then test $(pwd) $(pwd) done 'quoted text'
+		$(pwd) readonly /usr/bin $(pwd)
+		readonly local awk x=1 x=1 && sed 'quoted text' && echo test
+		| && grep | local "$@" readonly cd $(pwd) awk $(pwd) /usr/bin
+$(pwd) export echo local echo done && && sed -eu
+		echo sed $(pwd) sed -eu test x=1 2>/dev/null
+		${HOME} -eu --verbose x=1 x=1 && test export ${HOME} local
+		x=1 2>/dev/null cd /usr/bin local "$@" 2>/dev/null
+awk sed | /usr/bin done 2>/dev/null | printf 'quoted text'
+	test 2>/dev/null "$1" | test sed grep readonly "$@" printf
+		"$1" then -eu printf awk 2>/dev/null readonly 'quoted text' $(pwd) --verbose -eu
+done cd --verbose sed | awk done
+		readonly sed --verbose done /usr/bin
+		echo local printf 'quoted text' -eu -eu printf printf -eu 2>/dev/null test
+		&& 2>/dev/null ${HOME} export awk /usr/bin grep echo "$@" export readonly
+		awk | then export grep local then -eu awk test && test |
+		local ${HOME} "$@" --verbose
+	'quoted text' && | "$@" sed ${HOME} local $(pwd) x=1 local printf
+local echo "$1" awk test x=1 "$1" x=1 --verbose "$1" "$1" "$@"
+		$(pwd) sed sed "$1" echo test then && echo then
+	"$@" test export "$@" test echo done && "$1" test "$1"
+	"$@" local $(pwd) && done | awk $(pwd) x=1 local sed local x=1 --verbose 'quoted text'
+		done test x=1 | 'quoted text'
+&& readonly --verbose --verbose sed echo 2>/dev/null &&
+	&& "$1" done x=1 echo 'quoted text' done x=1 -eu cd "$@" local "$1" 2>/dev/null
+		| cd echo && x=1 local "$@" echo
+export cd awk local "$@" then --verbose grep --verbose 2>/dev/null readonly
+	| "$1" readonly grep 'quoted text'
+	-eu /usr/bin then export /usr/bin
+		cd "$1" test ${HOME} /usr/bin
+	awk ${HOME} printf 'quoted text'
+	done "$@" grep "$@" 2>/dev/null echo then cd test $(pwd) ${HOME} local
+	'quoted text' | ${HOME} export cd --verbose 2>/dev/null "$@" /usr/bin
+	readonly $(pwd) | && $(pwd) done cd echo cd local /usr/bin --verbose "$@" test
+	test done cd done 2>/dev/null x=1
+		$(pwd) --verbose export local --verbose readonly readonly
+		$(pwd) grep /usr/bin "$1" && "$@" x=1 cd done -eu done | -eu echo 2>/dev/null
+		| "$1" "$1" x=1 && readonly -eu /usr/bin && x=1
+		-eu printf $(pwd) "$1" /usr/bin export sed --verbose --verbose |
+echo && export 'quoted text' "$1" echo sed then ${HOME} 2>/dev/null echo export
+$(pwd) printf printf x=1 test export $(pwd) sed "$@" && ${HOME}
+--verbose /usr/bin 2>/dev/null --verbose local $(pwd) then cd
+	"$@" test echo --verbose local printf "$1" echo $(pwd) awk && 'quoted text'
+readonly echo /usr/bin printf "$@" cd cd echo | $(pwd) done
+	2>/dev/null 'quoted text' 'quoted text' "$@" x=1 then then done 2>/dev/null
+		"$@" ${HOME} ${HOME} --verbose then /usr/bin awk | sed
+	-eu 'quoted text' cd | readonly
+	echo -eu grep export x=1 -eu x=1 readonly grep | then test 2>/dev/null
+		&& awk 2>/dev/null -eu $(pwd) | "$1" cd
+/usr/bin 'quoted text' then /usr/bin -eu && test echo grep local echo then
+		sed x=1 --verbose echo printf /usr/bin
+		"$@" "$@" test awk then ${HOME}
+readonly readonly --verbose grep awk "$@" export echo | x=1 awk echo
+	x=1 | echo ${HOME} export export test /usr/bin export cd |
+	${HOME} printf | $(pwd) ${HOME} 2>/dev/null 'quoted text'
+"$@" && /usr/bin "$1" ${HOME} local echo grep $(pwd) ${HOME} local printf ${HOME}
+sed 2>/dev/null cd "$@" | "$1"
+	&& done done then then /usr/bin --verbose
+local 'quoted text' && --verbose sed cd $(pwd)
+	then -eu 'quoted text'
+	-eu sed --verbose "$@" export awk -eu && cd sed then
+		grep 'quoted text' "$@" "$1" $(pwd) -eu test 2>/dev/null
+&& x=1 awk "$1" "$1" --verbose
+		sed 'quoted text' 'quoted text' $(pwd)
+	echo && && done "$1" readonly
+		export awk ${HOME} awk -eu sed ${HOME} printf && "$1"
+done /usr/bin "$@" && --verbose
+cd readonly "$@" sed printf && $(pwd) 'quoted text' printf
+	test $(pwd) && cd x=1 then
+		printf --verbose -eu test x=1 cd ${HOME} $(pwd)
+cd ${HOME} then ${HOME} && printf -eu && readonly
+		grep test --verbose /usr/bin -eu
+	${HOME} grep x=1 "$@" -eu cd "$1" $(pwd) -eu export /usr/bin readonly
+x=1 printf grep sed awk echo | awk x=1 && test /usr/bin
+	cd x=1 readonly /usr/bin
+"$1" local sed --verbose grep | && 2>/dev/null
+"$@" grep test 'quoted text' then | readonly /usr/bin x=1 sed
+		2>/dev/null 'quoted text' "$@"
+	printf awk then && printf readonly then awk cd echo -eu grep local 'quoted text'
+readonly | | readonly test --verbose cd "$@" $(pwd)
+test ${HOME} echo 'quoted text' local echo
+		done echo printf cd x=1 'quoted text' "$@" export 'quoted text' cd ${HOME}
+	export readonly printf then "$@" /usr/bin ${HOME}
+		grep "$1" /usr/bin sed && | /usr/bin
+		x=1 $(pwd) test "$1" && printf 2>/dev/null x=1 done /usr/bin x=1 readonly $(pwd)
+		awk sed grep test 2>/dev/null grep /usr/bin /usr/bin ${HOME}
+	| then && readonly done -eu cd test --verbose | echo
+		readonly test 'quoted text' --verbose
+	sed "$1" "$@" local echo cd
+test cd /usr/bin local echo --verbose
+printf x=1 -eu /usr/bin done readonly test sed test done $(pwd) -eu printf
+	printf ${HOME} test $(pwd)
+	printf | ${HOME} readonly --verbose
+	test done x=1 printf readonly | sed grep
+		| done x=1 x=1 'quoted text'
+| && "$@" "$@" 2>/dev/null echo
+		"$@" 'quoted text' x=1 $(pwd) ${HOME} readonly 'quoted text' readonly | cd "$1"
+		"$@" x=1 "$@" cd echo && cd done 'quoted text'
+done $(pwd) /usr/bin --verbose ${HOME} cd awk x=1 -eu awk "$@" cd $(pwd) 'quoted text'
+	readonly $(pwd) ${HOME}
+then printf 2>/dev/null $(pwd) -eu -eu readonly
+		readonly -eu 2>/dev/null && && test readonly ${HOME} --verbose
+	/usr/bin readonly /usr/bin export awk && cd "$1" awk ${HOME} $(pwd) $(pwd) /usr/bin
+local cd | export test | -eu
+		test --verbose test 2>/dev/null && /usr/bin local "$@" awk && "$@" printf
+		cd echo "$@" x=1 echo done
+	"$@" 2>/dev/null local then $(pwd) grep | ${HOME} grep
+	&& then "$@" printf x=1 "$@" printf echo echo x=1 printf x=1 export
+		done && -eu then test done | cd done "$1" then -eu x=1
+		then awk printf echo | 'quoted text' sed grep test ${HOME} grep -eu
+printf then ${HOME} -eu | export "$@" $(pwd) -eu 'quoted text' local
+"$1" awk /usr/bin printf 'quoted text' "$@"
+done x=1 done printf sed --verbose 2>/dev/null | x=1 2>/dev/null
+"$@" sed ${HOME} local x=1 | | grep $(pwd) printf readonly echo $(pwd) | "$1"
+"$1" grep test cd cd awk --verbose | echo then ${HOME} export -eu "$1" export
+export /usr/bin $(pwd) && "$1" | test sed grep --verbose echo grep "$1" 'quoted text'
+	local export done export awk && echo x=1 ${HOME}
+	sed && | export printf
+	printf echo cd echo -eu ${HOME} 'quoted text' $(pwd) grep --verbose "$1"
+		awk local --verbose x=1 grep | awk /usr/bin "$1" 'quoted text'
+		printf 2>/dev/null then ${HOME} 'quoted text'
+	readonly test 2>/dev/null 'quoted text' --verbose "$1" ${HOME} local done
+		2>/dev/null printf 2>/dev/null | done /usr/bin -eu "$@" 'quoted text' 2>/dev/null
+grep "$@" 2>/dev/null echo
+	2>/dev/null 2>/dev/null 2>/dev/null sed && awk 2>/dev/null 2>/dev/null local
+'quoted text' "$@" ${HOME} grep --verbose 2>/dev/null grep 'quoted text'
+	echo | $(pwd) ${HOME} awk --verbose awk "$1" sed export sed $(pwd) test && printf
+		'quoted text' awk readonly
+	--verbose sed cd "$@" export
+		readonly done local && local echo
+then 'quoted text' "$@" done sed grep 2>/dev/null | sed --verbose
+	2>/dev/null ${HOME} printf printf -eu 'quoted text' cd --verbose
+		${HOME} 'quoted text' "$@" export then -eu awk -eu "$@" && test && sed
+	awk | done | && "$1" readonly "$1" export "$1" then && --verbose x=1 "$1"
+2>/dev/null local grep grep then test -eu readonly
+	${HOME} then sed -eu /usr/bin && && cd cd printf readonly test local "$1" grep
+export sed cd 2>/dev/null sed /usr/bin local ${HOME}
+-eu -eu "$1" "$1" cd && --verbose echo | "$1" export test awk && 2>/dev/null
+		'quoted text' sed /usr/bin ${HOME} awk --verbose readonly
+	sed $(pwd) export /usr/bin cd sed cd -eu test local done then cd && /usr/bin
+local done awk done -eu
+		$(pwd) then grep export
+		export "$@" local "$1" ${HOME} 'quoted text' readonly
+	test grep 2>/dev/null printf -eu --verbose readonly sed echo test "$1" cd local
+then export -eu | echo echo done local export 2>/dev/null -eu /usr/bin /usr/bin
+		sed grep then /usr/bin cd x=1 /usr/bin 'quoted text'
+${HOME} x=1 /usr/bin 'quoted text' "$1" "$@" $(pwd) awk readonly
+	&& export printf 2>/dev/null
+		'quoted text' grep sed printf -eu
+readonly "$@" "$1" /usr/bin then local -eu echo --verbose
+"$@" --verbose 'quoted text' grep ${HOME} && | && $(pwd)
+x=1 done 2>/dev/null done | $(pwd) --verbose then 'quoted text'
+		grep x=1 done then 2>/dev/null
+		x=1 "$@" x=1 $(pwd) | awk printf 'quoted text'
+	| 2>/dev/null echo sed $(pwd) export test sed sed local 2>/dev/null "$1"
+-eu printf /usr/bin /usr/bin sed export awk cd then sed x=1 ${HOME} test
+test ${HOME} -eu 2>/dev/null cd | 'quoted text' /usr/bin $(pwd) done done
+		/usr/bin 'quoted text'
+&& cd /usr/bin test done -eu 2>/dev/null | -eu x=1 'quoted text'
+"$1" sed 2>/dev/null echo && awk readonly export
+"$1" done cd "$1" readonly ${HOME} x=1 awk grep "$1" 'quoted text'
+	cd --verbose done | | done "$@" cd local /usr/bin grep 2>/dev/null printf
+cd then x=1 -eu | --verbose x=1 awk --verbose readonly
+-eu test --verbose done
+		awk ${HOME} sed /usr/bin cd 2>/dev/null printf
+cd /usr/bin x=1 readonly && $(pwd) grep | $(pwd)
+printf "$1" --verbose awk grep local 2>/dev/null printf
+	-eu "$@" -eu $(pwd) test ${HOME} export /usr/bin awk echo | grep echo
+		awk then /usr/bin done printf export awk then
+		'quoted text' then test ${HOME} $(pwd) done | then printf awk
+		x=1 export printf --verbose -eu ${HOME} 'quoted text' 'quoted text' test &&
+export cd cd 2>/dev/null 'quoted text'
+$(pwd) --verbose test printf grep && x=1 printf "$@" readonly
+	then --verbose "$1" echo --verbose test | local
+		export --verbose -eu readonly $(pwd) x=1 echo cd ${HOME}
+/usr/bin echo -eu x=1 sed "$1" cd printf
+echo sed test cd printf cd --verbose export printf
+grep local echo && 2>/dev/null /usr/bin grep x=1 --verbose "$1"
+2>/dev/null /usr/bin x=1 && echo --verbose
+	test 'quoted text' export -eu export export
+	done awk printf done $(pwd)
+		'quoted text' --verbose --verbose then $(pwd) -eu
+local sed done /usr/bin "$@" | 2>/dev/null done /usr/bin --verbose
+	x=1 'quoted text' x=1 ${HOME} done /usr/bin 2>/dev/null
+		printf local x=1 && ${HOME} /usr/bin cd "$1" $(pwd) test local
+		printf grep cd local export 2>/dev/null
+then "$1" export grep | | awk && "$@" echo
+		local local awk local printf grep 'quoted text' local 'quoted text' local
+		export then && export ${HOME} grep 2>/dev/null export /usr/bin printf
+"$@" --verbose readonly --verbose x=1 awk | readonly printf --verbose cd grep export
+		&& sed grep 'quoted text' && --verbose /usr/bin | printf
+export && "$@" cd /usr/bin 2>/dev/null printf local /usr/bin echo printf
+		echo 'quoted text' 'quoted text' local $(pwd) --verbose cd && printf x=1 x=1
+2>/dev/null cd 'quoted text' "$1" 'quoted text' $(pwd) local readonly
+		awk cd echo printf grep "$@" cd "$@" && --verbose printf ${HOME} ${HOME} sed
+	"$@" $(pwd) $(pwd) then grep "$@"
+then "$1" cd ${HOME} readonly 2>/dev/null local 2>/dev/null then grep x=1 "$@"
+		local "$@" readonly 'quoted text' &&
+	export grep then 2>/dev/null echo printf "$1" readonly
+	'quoted text' export grep | then readonly 2>/dev/null 2>/dev/null
+cd printf /usr/bin -eu /usr/bin local 2>/dev/null
+cd readonly cd $(pwd) | local -eu awk
+		test ${HOME} sed awk "$@" sed cd 2>/dev/null then | /usr/bin echo ${HOME}
+	2>/dev/null test ${HOME} grep "$1" && readonly $(pwd) -eu x=1 echo
+done ${HOME} readonly cd 2>/dev/null local $(pwd) x=1 2>/dev/null then "$@" $(pwd)
+&& /usr/bin printf --verbose 2>/dev/null grep printf
+	then "$@" 2>/dev/null x=1 grep local awk test
+sed awk export ${HOME} /usr/bin printf
+readonly 2>/dev/null 'quoted text'
+		"$@" printf --verbose then printf cd $(pwd) test 'quoted text'
+		/usr/bin echo "$1" cd readonly /usr/bin "$@" "$@" cd 'quoted text' test echo grep
+${HOME} echo test -eu 2>/dev/null "$@" ${HOME} | sed ${HOME}
+		grep "$1" -eu sed printf "$@"
+${HOME} -eu ${HOME} | "$1" | export | "$@" then | x=1 printf
+	export ${HOME} then $(pwd) -eu cd awk -eu local then && $(pwd) test x=1 $(pwd)
+&& /usr/bin 2>/dev/null printf
+	&& awk readonly cd done awk /usr/bin
+export local test /usr/bin grep "$@" export awk
+/usr/bin test done --verbose
+sed ${HOME} grep 2>/dev/null --verbose test 'quoted text' export
+	grep 'quoted text' then sed
+		awk sed test local echo x=1 sed done 'quoted text'
+		'quoted text' printf done -eu printf 2>/dev/null "$@" --verbose
+	2>/dev/null 2>/dev/null test readonly test printf 2>/dev/null
+	/usr/bin "$1" done then awk local ${HOME} | | "$@"
+	grep && then "$@" x=1 $(pwd) export awk "$1" -eu -eu x=1 sed echo export
+		${HOME} local then "$1" ${HOME} $(pwd) then awk then -eu sed done done 2>/dev/null
+readonly "$@" cd echo 'quoted text' "$@"
+		cd | -eu test $(pwd) x=1 x=1 awk then /usr/bin 2>/dev/null
+		grep && awk x=1 ${HOME} test sed | readonly readonly "$1" awk export
+		grep printf 'quoted text' printf
+		| $(pwd) export readonly cd 'quoted text' export printf echo cd
+	2>/dev/null done 'quoted text' | "$1" echo readonly printf && $(pwd) ${HOME} grep
+grep x=1 printf test local | "$1" && "$@" awk "$1" --verbose "$1" "$1"
+		2>/dev/null then test echo done 2>/dev/null -eu local "$@" grep "$1" then readonly
+	local awk && readonly "$1" grep local /usr/bin sed echo | --verbose "$1"
+done echo $(pwd) echo "$1" $(pwd) local "$@" && then local /usr/bin test test readonly
+sed readonly $(pwd) x=1 "$@" local export | done cd awk --verbose export
+--verbose sed done printf /usr/bin readonly ${HOME} awk echo
+		printf export "$1" cd readonly awk sed echo then printf ${HOME} export
+	-eu /usr/bin cd "$1" sed "$@" -eu echo 2>/dev/null "$1" 'quoted text'
+	export | | then && done x=1 x=1 grep
+	&& "$@" readonly readonly awk local export printf grep printf && sed 'quoted text'
+	| export "$@" test cd x=1 then local printf test --verbose --verbose -eu grep sed
+	'quoted text' printf then printf
+	then x=1 "$1" grep sed "$1" x=1 printf cd --verbose then
+	local local sed readonly $(pwd)
+		2>/dev/null 2>/dev/null | | 2>/dev/null echo readonly && | "$1" readonly readonly
+		$(pwd) 2>/dev/null awk local cd "$@" printf
+		${HOME} $(pwd) test sed local sed
+		grep printf sed local printf "$1" 'quoted text' printf cd grep --verbose
+${HOME} "$1" "$@" cd /usr/bin && "$1" 'quoted text'
+	then -eu 2>/dev/null 2>/dev/null readonly awk readonly grep
+		${HOME} readonly then cd -eu x=1 "$1" --verbose 2>/dev/null then
+"$1" /usr/bin && ${HOME} test readonly grep
+export 2>/dev/null --verbose "$1" 'quoted text' $(pwd)
+readonly /usr/bin 'quoted text' -eu ${HOME} grep
+&& echo $(pwd) --verbose sed 2>/dev/null
+	"$@" then done echo then
+	printf x=1 2>/dev/null export -eu then sed grep ${HOME}
+2>/dev/null x=1 then awk done local "$@" printf && "$1" done test && readonly
+	then test then echo done && | x=1 /usr/bin "$@" 2>/dev/null export local
+		x=1 -eu "$@" test local ${HOME} export "$1" $(pwd)
+		export printf sed printf $(pwd) 'quoted text' && /usr/bin echo
+	&& sed export then echo /usr/bin 2>/dev/null $(pwd) export && readonly
+| then echo 'quoted text' | test x=1 grep awk --verbose local
+local /usr/bin --verbose printf readonly cd sed readonly --verbose awk "$@"
+local cd sed echo readonly -eu --verbose export "$1" done sed test grep readonly
+		local /usr/bin done local done --verbose && grep echo
+		test "$@" "$1" printf ${HOME} grep -eu echo sed awk sed readonly export
+done cd | awk "$1" /usr/bin test 'quoted text'
+		export done 'quoted text' ${HOME} "$@" 2>/dev/null 'quoted text'
+"$@" then test local ${HOME} &&
+done then printf echo "$1" local ${HOME} $(pwd) $(pwd) sed "$@"
+export local then $(pwd)
+2>/dev/null && grep x=1 echo sed 2>/dev/null 'quoted text'
+| -eu 'quoted text' then /usr/bin cd ${HOME} x=1 && grep cd sed && sed 2>/dev/null
+${HOME} ${HOME} "$@" then ${HOME} then echo grep
+	sed --verbose ${HOME} && "$1" sed grep cd -eu printf && awk then done
+local && ${HOME} $(pwd)
+"$@" 'quoted text' done $(pwd) $(pwd) export 2>/dev/null readonly x=1
+${HOME} local --verbose --verbose "$@" export x=1 2>/dev/null /usr/bin
+2>/dev/null ${HOME} echo $(pwd)
+		-eu awk x=1 local x=1 2>/dev/null 'quoted text' ${HOME} echo readonly printf
+&& x=1 test test grep $(pwd) then /usr/bin x=1 echo 'quoted text' readonly
+		| /usr/bin 2>/dev/null ${HOME}
+	sed printf 2>/dev/null local && | then then then /usr/bin done /usr/bin awk echo
+	| grep printf | $(pwd) --verbose /usr/bin
+then | "$1" "$1" ${HOME} 'quoted text' -eu 2>/dev/null sed awk
+		local ${HOME} cd | "$1"
+	printf 'quoted text' | "$@" cd awk "$@" && readonly
+printf then && readonly export grep cd | sed
+		| "$1" local cd export --verbose test test
+| "$1" ${HOME} "$1" awk --verbose
+	test awk | 'quoted text' --verbose test grep 2>/dev/null && done
+	--verbose /usr/bin readonly then 2>/dev/null then ${HOME} 'quoted text'
+		awk then done x=1 --verbose export
+		$(pwd) "$@" && 2>/dev/null cd -eu
+local test export $(pwd)
+		| done 'quoted text' | local "$@" 'quoted text' /usr/bin -eu printf test
+	sed cd grep readonly printf 'quoted text'
+	test $(pwd) && --verbose "$@"
+		test readonly test -eu x=1 readonly local | awk $(pwd)
+sed | "$@" && grep --verbose
+	printf /usr/bin "$1" export grep echo export echo
+	"$1" && x=1 grep test "$@" cd echo
+	printf done echo echo sed
+x=1 test echo grep readonly |
+		-eu grep && 'quoted text' test /usr/bin "$1" grep sed
+		grep grep readonly awk test --verbose
+/usr/bin $(pwd) awk | "$@" "$@" ${HOME} "$1" test grep | grep done | cd
+test then awk "$1" /usr/bin "$@" local awk cd --verbose
+	test -eu --verbose sed 2>/dev/null x=1 ${HOME} grep test --verbose
+		2>/dev/null | then test printf && cd export /usr/bin 2>/dev/null readonly
+"$1" local done local printf grep $(pwd) sed test printf
+sed cd "$@" echo test /usr/bin 2>/dev/null sed
+	echo 2>/dev/null 'quoted text'
+export printf cd --verbose then readonly
+${HOME} grep && then cd export $(pwd) "$1" export
+'quoted text' | && x=1 -eu "$1" && "$@" local
+	$(pwd) readonly 'quoted text' printf then export "$1" echo echo cd x=1
+	sed "$1" 'quoted text' x=1 2>/dev/null
+	test grep awk 'quoted text' x=1 x=1 2>/dev/null grep -eu && sed && test
+$(pwd) sed -eu ${HOME} local $(pwd) "$@" 2>/dev/null
+		printf | local grep $(pwd) "$1"
+		'quoted text' /usr/bin cd sed
+'quoted text' readonly printf | readonly x=1 x=1 printf sed done /usr/bin
+		then printf grep done "$@" done cd echo then grep /usr/bin then
+	printf $(pwd) cd 2>/dev/null /usr/bin done "$@" export
+		done --verbose then 'quoted text' "$1" echo && echo test -eu echo && ${HOME} "$@"
+	--verbose export echo done && "$1" printf grep then /usr/bin
+test grep export grep then | echo readonly cd then sed /usr/bin
+done grep 2>/dev/null $(pwd) 'quoted text' sed | local echo x=1
+/usr/bin cd readonly x=1 && echo
+	x=1 cd -eu "$@" cd echo readonly test 'quoted text'
+awk then x=1 "$@" sed --verbose awk "$1" && printf test readonly "$1"
+		'quoted text' -eu then export readonly -eu 2>/dev/null "$1" --verbose
+sed local "$@" -eu $(pwd) -eu cd "$1"
+		sed 'quoted text' -eu 2>/dev/null readonly local | --verbose $(pwd)
+/usr/bin then "$1" sed /usr/bin /usr/bin
+		--verbose awk readonly && grep x=1 ${HOME} | sed "$@" && echo
+--verbose then awk "$@" then export ${HOME} ${HOME}
+	readonly done /usr/bin 'quoted text'
+		-eu "$@" local "$1" && local $(pwd) done test
+	done /usr/bin $(pwd) readonly ${HOME} && --verbose test
+		/usr/bin x=1 -eu echo then
+		2>/dev/null | done printf x=1 done echo $(pwd) 2>/dev/null grep && sed "$1"
+		-eu sed then /usr/bin "$@" /usr/bin cd $(pwd) grep
+	&& 2>/dev/null 'quoted text' awk $(pwd) | && 'quoted text' 'quoted text'
+		/usr/bin cd grep 2>/dev/null sed "$1" "$@" then
+sed | ${HOME} 2>/dev/null local printf sed && export
+		${HOME} ${HOME} local --verbose -eu "$@" echo cd export sed 'quoted text' sed
+	2>/dev/null && printf then $(pwd) ${HOME} awk
+printf ${HOME} awk | 2>/dev/null
+		printf awk "$@" 2>/dev/null then 'quoted text' $(pwd) then "$1" printf
+	/usr/bin then x=1 /usr/bin ${HOME} echo
+		local "$1" -eu 2>/dev/null local && x=1
+	done /usr/bin --verbose local
+-eu /usr/bin then x=1 local
+	printf /usr/bin "$1" "$1" test "$1" done --verbose | x=1
+&& && test -eu then x=1
+		"$@" then grep printf $(pwd) $(pwd) 'quoted text' "$@" cd
+--verbose awk 'quoted text' grep 2>/dev/null local "$@" sed sed | "$@" export
+		x=1 | printf then -eu
+echo local $(pwd) test readonly test /usr/bin awk --verbose readonly
+	${HOME} -eu printf export /usr/bin printf -eu /usr/bin
+	printf | grep local local && readonly
+&& $(pwd) --verbose printf local echo ${HOME} /usr/bin grep awk
+		/usr/bin && $(pwd) cd echo 2>/dev/null
+2>/dev/null 2>/dev/null readonly 'quoted text' 2>/dev/null --verbose
+		grep "$@" --verbose --verbose readonly -eu sed awk cd readonly x=1 "$1" | "$1"
+| done ${HOME} 'quoted text' x=1 readonly ${HOME} export test -eu
+		grep && | printf /usr/bin && echo grep 2>/dev/null
+		readonly awk readonly -eu grep done | export 'quoted text'
+| $(pwd) -eu awk printf done test "$1" x=1 $(pwd) $(pwd) export
+	${HOME} -eu cd printf 2>/dev/null test --verbose cd awk "$1" local cd export printf
+	$(pwd) awk 2>/dev/null sed test | --verbose --verbose echo $(pwd) | then /usr/bin
+	grep 2>/dev/null && | grep printf /usr/bin --verbose test
+		awk export --verbose -eu x=1 printf $(pwd) test $(pwd) export readonly /usr/bin
+	printf local printf "$@" $(pwd) $(pwd) then echo echo --verbose "$@"
+awk cd export && ${HOME} -eu
+local then /usr/bin x=1 grep $(pwd) test --verbose
+	--verbose && test done | "$1" 2>/dev/null done
+		$(pwd) sed echo && awk --verbose
+$(pwd) local printf 2>/dev/null
+	echo 2>/dev/null cd done "$@" then sed
+"$1" printf grep 2>/dev/null cd 'quoted text'
+/usr/bin done export then cd done export $(pwd) local "$1" export local
+		x=1 -eu sed printf test done x=1 done local printf
+		then printf | test cd test grep 'quoted text' /usr/bin --verbose
+done 2>/dev/null "$@" $(pwd) cd
+$(pwd) readonly $(pwd) test export x=1 "$@" awk printf local test
+| $(pwd) export export ${HOME} echo
+	cd done readonly printf echo readonly awk ${HOME} sed
+"$1" $(pwd) local sed /usr/bin ${HOME} | x=1 2>/dev/null
+awk awk printf 'quoted text' | x=1 2>/dev/null
+		"$@" echo local awk --verbose then
+${HOME} test readonly "$@" printf
+awk /usr/bin cd cd --verbose then test "$1" | ${HOME} /usr/bin
+readonly echo then readonly
+	grep awk cd x=1 sed "$1"
+	-eu readonly ${HOME} sed | -eu ${HOME} grep ${HOME} --verbose ${HOME}
+		x=1 then local --verbose | $(pwd) grep | sed $(pwd) done cd test
+		-eu ${HOME} test done --verbose test done export | printf ${HOME} "$1"
+	| readonly awk echo -eu "$@" x=1 printf 2>/dev/null readonly sed
+	x=1 && then then "$1" readonly
+	x=1 "$@" awk cd "$1" 2>/dev/null local /usr/bin readonly "$@" --verbose
+		-eu awk && /usr/bin ${HOME} cd ${HOME} local sed sed 'quoted text'
+test awk /usr/bin printf export | 2>/dev/null "$1" $(pwd) $(pwd) ${HOME} 2>/dev/null
+		grep awk grep test printf then
+grep grep ${HOME} 'quoted text' grep 2>/dev/null -eu readonly cd
+	&& done | ${HOME} local && $(pwd) cd x=1 &&
+		-eu "$@" 'quoted text' "$@" "$@" && cd
+then readonly /usr/bin x=1 grep && && 'quoted text' $(pwd) "$1" cd readonly
+	test test --verbose awk echo "$@" local "$@" readonly sed 'quoted text'
+		${HOME} | --verbose --verbose
+awk export 2>/dev/null then sed ${HOME}
+	'quoted text' then ${HOME} x=1 && local export --verbose
+$(pwd) $(pwd) "$@" ${HOME} $(pwd) sed cd export 2>/dev/null | done
+	x=1 x=1 "$@" 'quoted text' 2>/dev/null export
+		$(pwd) | && $(pwd) local done awk then --verbose "$1"
+	x=1 "$1" ${HOME} cd /usr/bin $(pwd) echo -eu | 'quoted text' && test then
+		export $(pwd) /usr/bin --verbose grep test
+		--verbose done cd "$@" then "$@" local $(pwd) 'quoted text' $(pwd) --verbose $(pwd)
+	then $(pwd) printf ${HOME}
+2>/dev/null then /usr/bin awk cd then export "$@" awk $(pwd) | --verbose grep
+	export 'quoted text' cd $(pwd) readonly sed -eu "$@"
+		local echo $(pwd) cd awk cd export sed
+printf local $(pwd) awk -eu 'quoted text' --verbose then --verbose
+grep test export -eu "$@" 2>/dev/null export then $(pwd)
+	echo awk printf echo && x=1 -eu "$1"
+	$(pwd) echo then awk done && sed ${HOME} echo grep
+	&& done done sed 'quoted text'
+	cd && local export 'quoted text'
+		/usr/bin readonly cd | done export ${HOME}
+	then sed test "$@" test 'quoted text' then /usr/bin awk then ${HOME}
+		| 'quoted text' export export local grep /usr/bin then ${HOME}
+		grep done then 2>/dev/null sed test &&
+		'quoted text' 2>/dev/null "$@" && sed 2>/dev/null $(pwd) readonly then
+		| echo printf | 'quoted text' echo $(pwd) cd export
+'quoted text' -eu ${HOME} 2>/dev/null && awk 2>/dev/null
+	/usr/bin printf cd "$1" /usr/bin local "$@" $(pwd) "$@" then awk
+		--verbose "$1" "$1" $(pwd) test then "$1" --verbose grep sed "$1" export
+grep /usr/bin readonly
+		printf export 2>/dev/null echo echo test
+	test x=1 | echo cd sed grep $(pwd) && readonly
+printf /usr/bin "$@" then x=1 "$1"
+		done readonly | done export $(pwd) grep test
+	awk then local readonly grep echo sed echo "$1" awk --verbose | then
+		$(pwd) sed test && "$@" grep grep ${HOME} | local -eu
+then readonly /usr/bin then
+	readonly sed done grep /usr/bin readonly local echo local printf x=1 |
+		then x=1 local done then local -eu 2>/dev/null
+		done /usr/bin then echo "$1" "$@" export
+local x=1 | readonly "$1" printf
+	$(pwd) sed | awk cd -eu x=1 'quoted text' "$1" 'quoted text' | cd
+		cd done "$@" "$@" local test && grep then
+	--verbose awk | && && --verbose 2>/dev/null done awk done
+2>/dev/null /usr/bin then ${HOME} export
+		sed printf x=1 printf printf && export x=1 echo
+		--verbose echo then --verbose cd "$1" awk -eu test cd 'quoted text'
+		then export test $(pwd) x=1 printf --verbose cd "$1" -eu printf 'quoted text'
+	done cd /usr/bin x=1 export "$1" ${HOME}
+sed printf cd && printf $(pwd) grep x=1 --verbose /usr/bin
+'quoted text' cd $(pwd) 'quoted text' readonly test x=1 'quoted text' done ${HOME}
+sed /usr/bin /usr/bin x=1 /usr/bin test export grep local &&
+	grep --verbose | sed local echo "$1"
+"$@" test "$@" x=1 export "$@" then echo x=1 sed && $(pwd) done 2>/dev/null
+		grep 'quoted text' grep && readonly
+		"$1" | -eu test ${HOME} printf then 'quoted text' $(pwd) grep grep && 'quoted text'
+	"$1" --verbose "$@" done | "$1"
+	cd ${HOME} && printf ${HOME} $(pwd) "$@" printf "$@" --verbose ${HOME} printf
+	x=1 && cd test local "$@" | ${HOME} "$1" export /usr/bin ${HOME} readonly
+	awk readonly x=1 export --verbose export x=1
+		local readonly local && $(pwd) readonly done --verbose
+	awk readonly "$@" local ${HOME} readonly --verbose cd $(pwd)
+export x=1 --verbose test ${HOME} printf $(pwd)
+	awk then "$@" "$@" awk echo && /usr/bin "$1" 2>/dev/null -eu
+		export test $(pwd) readonly then cd
+	echo ${HOME} x=1 ${HOME} cd $(pwd) printf && --verbose ${HOME} test cd -eu
+/usr/bin --verbose 'quoted text' -eu "$1" readonly ${HOME}
+		/usr/bin local ${HOME} && && x=1 sed test then sed awk then readonly done
+		"$@" grep local && echo readonly test grep 2>/dev/null done -eu export local
+export -eu --verbose cd awk ${HOME} "$1" 2>/dev/null
+	grep "$@" then printf echo
+		done echo grep -eu readonly cd printf
+2>/dev/null grep 2>/dev/null sed | 'quoted text'
+	${HOME} "$1" "$@" printf /usr/bin && grep -eu
+		-eu then x=1 "$1" -eu sed "$@" 'quoted text' then sed
+awk cd cd cd -eu "$1" && then 'quoted text' awk readonly
+	printf -eu test && awk "$1" -eu export $(pwd)
+'quoted text' done done export | local sed "$@" $(pwd) && export ${HOME}
+/usr/bin export cd test $(pwd) -eu x=1 awk x=1 -eu
+		done 2>/dev/null local /usr/bin grep 'quoted text'
+	sed echo && sed /usr/bin printf x=1 ${HOME} awk x=1 done cd grep 'quoted text'
+echo --verbose done printf printf "$@" "$@" local export x=1
+		x=1 export "$1" test 2>/dev/null cd sed then -eu
+&& grep awk -eu && $(pwd)
+		| 2>/dev/null readonly $(pwd) export grep done then "$@" local
+sed printf x=1 done && grep export awk "$@"
+		then 'quoted text' ${HOME} "$1" done ${HOME} $(pwd) 'quoted text' printf then
+	'quoted text' "$@" $(pwd) 2>/dev/null 2>/dev/null 'quoted text'
+		sed 2>/dev/null cd echo "$1" 'quoted text' done grep echo grep printf done $(pwd)
+		printf 'quoted text' test echo
+grep "$1" grep printf echo "$1" "$1" 'quoted text' 2>/dev/null
+		local readonly "$1" echo export -eu 'quoted text' 'quoted text' "$1" 2>/dev/null
+		-eu --verbose 'quoted text'
+		&& test -eu ${HOME} test
+"$1" --verbose "$@" local --verbose 'quoted text' cd 2>/dev/null export awk /usr/bin
+	test awk then done /usr/bin
+		2>/dev/null then ${HOME} test echo readonly cd done 2>/dev/null -eu sed /usr/bin
+$(pwd) local x=1 $(pwd) -eu "$@"
+echo export && local local
+		printf 'quoted text' ${HOME} printf awk && cd cd done cd -eu $(pwd)
+'quoted text' x=1 then 2>/dev/null && readonly -eu awk done echo local
+-eu sed local ${HOME} printf 'quoted text'
+		2>/dev/null /usr/bin x=1 grep $(pwd) printf printf printf "$1" --verbose "$1" "$1"
+	--verbose 2>/dev/null readonly export x=1 'quoted text' | done "$1" export
+	done sed awk | 2>/dev/null x=1
+	echo ${HOME} local printf printf awk
+test test 'quoted text' echo
+	2>/dev/null then x=1 && "$@" && | echo test && && x=1 ${HOME} 'quoted text' 2>/dev/null
+sed echo -eu /usr/bin export export local done
+		/usr/bin readonly x=1 cd
+		echo test grep "$1" awk done printf ${HOME} x=1 cd then -eu -eu test export then
+		grep && printf "$@" --verbose --verbose done ${HOME}
+	/usr/bin local cd local
+printf 'quoted text' "$1" ${HOME} x=1 && echo /usr/bin 2>/dev/null
+echo "$1" && && done /usr/bin export && echo 'quoted text' $(pwd) awk test local
+done then x=1 grep | grep
+		readonly export then echo && x=1 ${HOME} export local test /usr/bin
+awk sed echo export cd awk 'quoted text' && $(pwd) && sed 'quoted text' then
+	done export ${HOME} then sed -eu export sed
+"$1" | && done "$@" echo "$1" echo
+		&& printf | ${HOME} cd "$1" --verbose
+		${HOME} && awk /usr/bin done cd cd --verbose ${HOME} -eu echo -eu
+		x=1 grep readonly ${HOME} ${HOME} printf
+	${HOME} sed $(pwd) 2>/dev/null printf
+	2>/dev/null echo $(pwd) printf awk -eu grep ${HOME} ${HOME} local
+		-eu done export then grep "$@" test export sed 2>/dev/null sed --verbose -eu export
+	x=1 printf readonly /usr/bin
+	sed then -eu --verbose printf 2>/dev/null | 2>/dev/null "$@" "$1" sed 'quoted text'
+		printf local 'quoted text' && awk 2>/dev/null "$@" /usr/bin cd --verbose local
+		--verbose then ${HOME} $(pwd) -eu then local cd test done readonly echo done
+local ${HOME} "$@" "$@" done ${HOME} "$@" ${HOME} then --verbose cd readonly
+"$@" done sed printf cd sed 2>/dev/null --verbose export
+	done sed test grep -eu readonly
+		local echo awk sed readonly -eu --verbose 2>/dev/null readonly "$@"
+| echo /usr/bin sed && readonly ${HOME} --verbose "$@"
+awk cd && printf printf /usr/bin
+grep && -eu ${HOME} -eu printf then 2>/dev/null local 'quoted text'
+	$(pwd) local -eu readonly
+$(pwd) && /usr/bin | export
+		| test x=1 | 2>/dev/null local
+cd /usr/bin "$1" x=1 $(pwd) x=1 cd printf "$@" -eu echo local
+'quoted text' "$1" readonly ${HOME} 2>/dev/null /usr/bin grep echo && test
+export done local -eu sed local && /usr/bin cd $(pwd)
+		| "$1" && "$@" test && awk 'quoted text'
+		cd local done printf test cd
+		printf "$1" cd x=1 then --verbose grep done export
+done "$1" printf done 'quoted text' done | echo "$1" $(pwd) done
+/usr/bin export export 'quoted text'
+	then awk test grep -eu ${HOME}
+grep test done --verbose && 'quoted text' awk awk
+cd sed sed sed 'quoted text' echo 'quoted text'
+		"$@" awk export /usr/bin export && "$@" readonly
+grep x=1 test printf echo export x=1 x=1 echo | $(pwd)
+export -eu --verbose --verbose | --verbose
+		${HOME} done "$@" 2>/dev/null echo $(pwd) grep grep echo /usr/bin cd cd done
+	${HOME} printf $(pwd) -eu && && readonly
+		export --verbose cd -eu test echo | readonly printf awk 'quoted text'
+		x=1 awk 2>/dev/null /usr/bin cd sed --verbose
+		then readonly local local ${HOME} && "$@" "$@" cd cd test readonly cd "$@" sed
+	/usr/bin test done export --verbose && /usr/bin /usr/bin 'quoted text'
+	$(pwd) $(pwd) cd "$1" "$1" printf $(pwd) export
+		local local $(pwd) x=1 printf | cd ${HOME} "$1" echo "$1"
+grep sed "$@" $(pwd) cd --verbose then ${HOME} 'quoted text' x=1 test
+&& x=1 done /usr/bin 2>/dev/null -eu then --verbose "$1" x=1 readonly
+		${HOME} local export cd ${HOME} | x=1 sed && $(pwd) then "$@" 2>/dev/null cd then
+	'quoted text' test -eu "$@" --verbose done done x=1 'quoted text' then
+test --verbose | ${HOME} 2>/dev/null 2>/dev/null
+	done export sed 'quoted text'
+		local export then x=1 export then && --verbose
+/usr/bin printf done sed echo
+	| grep export readonly export x=1 export grep sed -eu echo $(pwd) grep test
+printf test done 2>/dev/null cd && && echo | then && done 2>/dev/null | done -eu
+		2>/dev/null cd ${HOME} | x=1 x=1 printf sed "$1" x=1 cd awk "$@" $(pwd) cd
+then test then x=1 readonly /usr/bin then printf -eu sed echo
+"$@" | done $(pwd) awk --verbose grep 2>/dev/null test
+	| 2>/dev/null "$1" sed grep --verbose awk echo 2>/dev/null export
+	-eu && /usr/bin "$@" grep && /usr/bin sed grep grep "$1" x=1 -eu
+		export test x=1 sed | | && local "$1" sed cd
+echo --verbose "$@" grep awk | cd done -eu
+	awk "$@" echo | done printf sed
+	printf done echo 'quoted text' readonly $(pwd)
+| x=1 | x=1 printf readonly --verbose test readonly
+		-eu && 2>/dev/null 2>/dev/null awk 2>/dev/null echo -eu ${HOME} readonly
+	export echo x=1 then && done then "$@" | local ${HOME} --verbose x=1
+		echo "$1" then export export done --verbose && done "$1" local x=1 "$@"
+x=1 printf 'quoted text' echo 'quoted text'
+export awk grep && grep -eu -eu && readonly readonly done
+		$(pwd) then test --verbose x=1 && done "$1" local test
+	test 2>/dev/null export "$@" export && "$@" then "$@" 'quoted text' "$@" printf
+		done "$1" x=1 sed "$@" $(pwd) | $(pwd) done test
+	local cd 2>/dev/null | export $(pwd) echo | $(pwd) echo printf
+/usr/bin "$1" then --verbose 'quoted text' /usr/bin cd "$@" 'quoted text'
+		awk awk readonly test test --verbose
+x=1 grep --verbose awk 2>/dev/null /usr/bin test local
+| --verbose | -eu 'quoted text'
+		/usr/bin printf "$1" | sed export readonly
+grep --verbose | && awk awk local readonly grep sed test "$@" export | "$1"
+	sed export readonly sed cd -eu --verbose
+		echo 2>/dev/null done ${HOME}
+	/usr/bin x=1 export --verbose sed && export
+	readonly done --verbose "$1" ${HOME} | printf x=1 'quoted text'
+then awk | sed "$@" test cd $(pwd) $(pwd) --verbose
+	done then ${HOME} export $(pwd) export
+		grep readonly grep then printf "$@" then /usr/bin 2>/dev/null awk echo
+		--verbose done ${HOME} sed readonly x=1 cd sed /usr/bin test
+	then 2>/dev/null /usr/bin then done printf /usr/bin "$@" $(pwd) sed 'quoted text'
+${HOME} echo ${HOME} test "$1" done export 2>/dev/null "$1" x=1 done cd
+	echo awk 'quoted text' /usr/bin sed /usr/bin readonly ${HOME} grep
+	-eu -eu --verbose -eu test $(pwd) then grep && $(pwd) done local then /usr/bin
+export "$@" readonly x=1 local
+then done test sed x=1 done done sed grep echo echo 2>/dev/null test 2>/dev/null
+		"$@" printf then && --verbose test done printf grep cd grep
+		readonly awk -eu /usr/bin --verbose && sed echo -eu "$@" "$1" "$1" export
+	export $(pwd) /usr/bin echo test awk echo
+| grep 'quoted text' local && "$1"
+		readonly 2>/dev/null export $(pwd)
+		--verbose readonly $(pwd)
+echo 'quoted text' readonly 'quoted text' printf
+"$@" local 'quoted text' --verbose readonly
+-eu | grep /usr/bin $(pwd) 2>/dev/null /usr/bin
+		$(pwd) grep --verbose ${HOME} ${HOME} readonly export then --verbose sed
+	sed | && x=1 /usr/bin $(pwd) && sed cd $(pwd) grep $(pwd)
+awk done | x=1 -eu "$@" -eu
+	echo 2>/dev/null x=1 -eu export sed /usr/bin /usr/bin export | --verbose awk |
+"$@" awk 'quoted text' "$1" 2>/dev/null local local printf export grep export
+sed "$@" export | sed test then local readonly then awk -eu done /usr/bin
+	/usr/bin "$1" echo $(pwd) 2>/dev/null 2>/dev/null then echo &&
+	readonly done 2>/dev/null then readonly $(pwd) test printf | "$1" export /usr/bin
+| cd then x=1 && readonly then "$@" /usr/bin /usr/bin sed "$1" ${HOME} -eu
+	export then then | $(pwd) done 'quoted text' grep | done test
+	"$@" | grep -eu grep local --verbose test export then --verbose printf done | cd
+cd $(pwd) && --verbose test then "$@" --verbose $(pwd)
+	"$@" "$@" "$@" readonly done && local
+x=1 export cd ${HOME} -eu "$@" && test -eu sed sed local --verbose
+	$(pwd) -eu grep echo /usr/bin readonly /usr/bin local local local grep local
+done | awk "$1" readonly grep
+		local 2>/dev/null export ${HOME} $(pwd) ${HOME} readonly
+		/usr/bin readonly 'quoted text' $(pwd) /usr/bin then "$1"
+	done 2>/dev/null "$@" then 2>/dev/null --verbose 'quoted text'
+		$(pwd) --verbose echo | "$1" "$@" x=1 x=1 readonly 2>/dev/null
+echo grep grep $(pwd) echo 2>/dev/null
+		/usr/bin grep local cd grep
+--verbose 'quoted text' test printf printf
+	| x=1 local echo "$@" "$1" --verbose export
+"$@" cd printf then then grep cd x=1 | then x=1 ${HOME}
+sed x=1 echo printf then $(pwd) grep | export awk
+	printf cd "$1" 2>/dev/null
+grep x=1 printf printf printf
+	&& 'quoted text' -eu $(pwd) echo | | 2>/dev/null export test printf test
+--verbose grep done 'quoted text' echo cd echo sed awk
+local grep $(pwd) && readonly sed then -eu sed --verbose x=1 done echo
+	export done ${HOME} $(pwd) | awk 2>/dev/null "$@" then
+		test x=1 then x=1 'quoted text'
+	printf "$@" sed 'quoted text' "$@" --verbose export echo x=1 test x=1
+	cd 'quoted text' grep then -eu export 'quoted text' readonly $(pwd) ${HOME}
+	"$@" local | test done $(pwd) then
+	| "$1" export sed ${HOME} echo "$@" printf "$@" 2>/dev/null grep printf cd
+		'quoted text' 2>/dev/null "$@" grep && 2>/dev/null
+	'quoted text' awk 2>/dev/null
+	'quoted text' test "$@" cd then cd "$1" --verbose | test test
+local x=1 | sed --verbose ${HOME} readonly printf test /usr/bin /usr/bin sed "$@"
+	-eu sed export cd sed sed grep then --verbose | echo
+x=1 local sed 2>/dev/null
+	local x=1 then cd "$@" 2>/dev/null "$@" && /usr/bin ${HOME} export
+		awk /usr/bin -eu x=1 && awk $(pwd)
+	'quoted text' | 'quoted text' local 2>/dev/null grep sed
+x=1 "$@" 'quoted text' --verbose
+		cd echo && -eu 'quoted text'
+--verbose cd "$@" 'quoted text' | sed awk "$1" -eu --verbose
+		export x=1 /usr/bin $(pwd) x=1 awk 'quoted text'
+--verbose then "$1" export
+"$@" test | local cd 2>/dev/null printf echo then cd /usr/bin done | "$@"
+	"$@" local sed "$@" -eu ${HOME} $(pwd)
+		sed cd 2>/dev/null grep cd | "$@" cd grep --verbose sed then echo
+	/usr/bin then printf 'quoted text' 'quoted text'
+test grep grep x=1 /usr/bin && grep printf printf test sed 'quoted text' "$@"
+		local done awk done x=1
+		2>/dev/null ${HOME} "$1" --verbose then
+	then awk grep -eu && awk local cd "$1" done x=1
+		test readonly "$1" test 2>/dev/null /usr/bin awk test awk -eu 'quoted text'
+		local ${HOME} local done test "$1" "$@" --verbose done local echo 'quoted text'
+		awk && cd grep ${HOME} cd readonly
+--verbose local local 2>/dev/null done --verbose
+	awk grep "$1" --verbose ${HOME} -eu 'quoted text'
+		x=1 | grep cd printf --verbose 2>/dev/null x=1 local
+| then x=1 local --verbose x=1
+$(pwd) export local /usr/bin then awk printf
+'quoted text' export awk export
+		/usr/bin ${HOME} 'quoted text' 'quoted text'
+--verbose 'quoted text' then ${HOME} printf && grep | test readonly
+		${HOME} "$@" 'quoted text' grep then
+		$(pwd) cd local echo $(pwd) -eu done sed -eu cd 2>/dev/null printf -eu -eu
+	echo cd | 'quoted text' export && /usr/bin readonly $(pwd) ${HOME}
+&& 'quoted text' grep 2>/dev/null
+x=1 local /usr/bin 'quoted text'
+export 'quoted text' x=1 $(pwd) && /usr/bin
+		&& readonly then printf "$1" local "$1"
+		'quoted text' -eu then sed ${HOME} --verbose export local grep
+$(pwd) $(pwd) "$@" /usr/bin "$1"
+	done local export export ${HOME} 2>/dev/null
+--verbose "$@" printf then ${HOME} "$@" cd 2>/dev/null ${HOME}
+		| then local $(pwd) cd 'quoted text' "$@" ${HOME} export
+&& --verbose 'quoted text' ${HOME}
+'quoted text' "$1" local echo ${HOME} grep cd cd -eu | -eu 2>/dev/null
+export 'quoted text' ${HOME}
+	printf | readonly ${HOME} done x=1 "$1" && /usr/bin "$1" "$@" "$1" test --verbose
+2>/dev/null "$@" /usr/bin printf -eu sed x=1 && echo ${HOME} --verbose
+		awk grep 'quoted text' && awk readonly "$1" --verbose
+	&& x=1 printf -eu x=1 "$@" sed then "$1"
+	test local cd done readonly
+		echo grep "$1" | --verbose echo local awk 'quoted text' done
+-eu /usr/bin "$1" sed echo && ${HOME} $(pwd) 2>/dev/null
+	grep echo 2>/dev/null test $(pwd) | ${HOME} printf ${HOME} echo
+	done /usr/bin awk done && printf grep && 'quoted text'
+	$(pwd) sed export done /usr/bin --verbose test awk
+export then && cd test "$@" "$@" --verbose $(pwd) then sed then test sed sed
+	2>/dev/null $(pwd) sed awk --verbose printf
+		"$@" "$@" printf cd awk cd test ${HOME}
+"$@" | then grep local $(pwd) -eu && 'quoted text'
+		export test test test x=1 readonly export printf 'quoted text' -eu --verbose
+"$1" cd cd then echo grep
+	cd 'quoted text' -eu export "$1" /usr/bin readonly local /usr/bin sed -eu "$@"
+	2>/dev/null "$@" 2>/dev/null -eu 2>/dev/null
+		&& /usr/bin x=1 x=1 $(pwd) && test 2>/dev/null local then -eu && "$1" done
+	'quoted text' local | && "$@" test $(pwd)
+	$(pwd) "$1" 'quoted text'
+	test "$1" grep test sed $(pwd) then done export
+echo --verbose ${HOME} 'quoted text'
+${HOME} && x=1 "$1" "$1" && 'quoted text' | ${HOME} awk "$1" cd then
+echo "$@" echo then readonly grep echo "$1" "$1" done echo export | 'quoted text'
+		sed awk test awk "$1" 'quoted text' 'quoted text' -eu -eu |
+echo "$1" done x=1 "$@" | 2>/dev/null 'quoted text'
+		&& $(pwd) then "$@" export "$@" -eu x=1 "$@" --verbose "$1" | 2>/dev/null printf
+	'quoted text' | x=1 /usr/bin
+		--verbose readonly | |
+	"$@" readonly then cd local && && sed sed test printf $(pwd) "$@"
+sed 2>/dev/null $(pwd) cd
+		then awk /usr/bin awk sed
+	"$1" --verbose -eu ${HOME} test x=1 -eu && test
+		${HOME} test local 'quoted text'
+	test "$1" 'quoted text' echo "$@" -eu export 2>/dev/null printf local test 'quoted text'
+	export ${HOME} x=1 cd && "$@" "$@" 2>/dev/null grep then then grep | x=1
+		sed -eu test | export 'quoted text' done sed grep x=1
+export export $(pwd) 'quoted text' --verbose sed $(pwd)
+	grep ${HOME} /usr/bin --verbose grep x=1 test awk printf grep -eu readonly
+		cd | $(pwd) x=1 sed local && local echo "$1" | printf done $(pwd) cd x=1 echo
+		readonly --verbose x=1 --verbose
+		done && 2>/dev/null local 'quoted text' cd done cd "$@" export then | then
+		cd sed then done awk ${HOME} -eu sed sed "$@" -eu
+	done test done awk "$@" grep export
+then grep grep && | printf readonly 'quoted text' 2>/dev/null
+	sed then then echo 2>/dev/null && awk readonly echo ${HOME}
+"$@" ${HOME} x=1 export echo | echo export
+x=1 && cd done cd sed readonly awk
+grep echo "$1" -eu --verbose /usr/bin
+	| readonly "$@" sed x=1 readonly cd 'quoted text'
+grep echo readonly /usr/bin export "$1" --verbose grep | printf
+		echo && readonly /usr/bin echo && 2>/dev/null 2>/dev/null
+	test export --verbose "$1" | && printf export local
+		then test | 2>/dev/null export "$1" $(pwd)
+		local export && then cd printf echo printf "$1" | readonly
+	"$1" sed printf echo 2>/dev/null
+x=1 grep x=1 readonly -eu awk done
+	readonly /usr/bin && cd test $(pwd) sed "$1" ${HOME} ${HOME}
+		'quoted text' awk grep test ${HOME} --verbose $(pwd)
+		awk cd grep | ${HOME} cd test "$1" printf "$@" export
+	2>/dev/null x=1 2>/dev/null export local sed /usr/bin
+$(pwd) ${HOME} test sed sed "$@" ${HOME} awk export
+	awk done readonly -eu 'quoted text'
+		&& "$@" awk "$@" 2>/dev/null export done -eu export /usr/bin echo 2>/dev/null
+	'quoted text' x=1 | 2>/dev/null
+	then local grep printf /usr/bin -eu awk readonly
+	printf done done local 2>/dev/null
+local /usr/bin 2>/dev/null readonly "$@" readonly
+	readonly 2>/dev/null test awk 2>/dev/null "$1"
+--verbose export done local awk printf |
+test done | 2>/dev/null "$@" printf $(pwd) test x=1
+		printf done --verbose readonly test | ${HOME}
+		then echo "$1" echo "$@" printf ${HOME} && local
+		export then local 'quoted text' test ${HOME} && --verbose test -eu
+	readonly 2>/dev/null echo
+cd printf /usr/bin test readonly "$1" done local x=1 'quoted text'
+$(pwd) 'quoted text' export $(pwd)
+		then x=1 'quoted text' &&
+	x=1 printf local done $(pwd) awk sed --verbose /usr/bin export
+readonly 2>/dev/null | then cd -eu export | | /usr/bin --verbose | sed --verbose
+/usr/bin 2>/dev/null echo | 'quoted text' sed "$1" 'quoted text'
+		/usr/bin local "$1" grep local grep "$1" done awk
+	2>/dev/null --verbose echo sed test export
+		/usr/bin "$1" --verbose /usr/bin $(pwd) readonly awk
+	cd cd /usr/bin "$@" /usr/bin readonly
+		"$1" "$@" export && done awk test 2>/dev/null local -eu --verbose export ${HOME}
+cd ${HOME} ${HOME} "$1" $(pwd) grep done ${HOME} test readonly
+/usr/bin | x=1 grep && -eu 'quoted text' printf then 2>/dev/null ${HOME}
+	| && x=1 2>/dev/null local x=1 && local export ${HOME} ${HOME} readonly
+		&& grep cd ${HOME} printf && -eu printf local printf
+		printf export "$1" "$@" then awk ${HOME} awk --verbose
+		sed export --verbose local local export /usr/bin "$@" 2>/dev/null
+grep awk awk grep $(pwd) export test echo
+		x=1 "$1" "$@" readonly export done ${HOME}
+		grep | -eu && | printf && then printf done printf readonly
+	/usr/bin printf cd test -eu --verbose cd x=1 /usr/bin &&
+		local sed readonly export test && then "$@" | awk readonly "$@" |
+		export printf test && --verbose
+local sed $(pwd) done done done sed readonly local
+	"$1" | 'quoted text' && local
+		/usr/bin grep 2>/dev/null x=1 grep "$@" 'quoted text'
+2>/dev/null /usr/bin test grep awk echo export /usr/bin test readonly 'quoted text'
+	awk && readonly "$1" 'quoted text' --verbose then
+		local local printf test test $(pwd) "$@" local 'quoted text'
+	'quoted text' local && done local then x=1 x=1 2>/dev/null ${HOME}
+		"$@" test 'quoted text' awk && cd "$1" cd --verbose awk export
+		readonly awk cd -eu 'quoted text' ${HOME} then | &&
+local then cd "$@" grep echo | sed readonly && test printf
+| local then | --verbose then local -eu local &&
+		echo local readonly ${HOME} $(pwd) 2>/dev/null done done grep 2>/dev/null x=1 2>/dev/null
+echo grep "$@" ${HOME} 2>/dev/null $(pwd) then grep readonly | --verbose printf
+	cd x=1 /usr/bin | -eu 'quoted text' done sed then
+		"$@" x=1 cd --verbose test --verbose export x=1 2>/dev/null readonly local
+		"$1" x=1 grep test grep --verbose $(pwd) printf sed /usr/bin --verbose x=1
+	sed printf echo test local --verbose local test export grep cd grep
+test $(pwd) done 2>/dev/null local --verbose grep && cd cd
+		/usr/bin --verbose "$@" test echo done
+	"$@" awk test && | /usr/bin done export /usr/bin sed then x=1 "$@"
+		test cd test 'quoted text' && export
+--verbose ${HOME} ${HOME} done | test local --verbose ${HOME} test "$1"
+sed export "$1" local grep awk then x=1 awk
+	'quoted text' -eu ${HOME}
+		grep awk $(pwd) then cd "$1" echo | x=1
+	test test then echo printf x=1 x=1 done -eu
+		--verbose local ${HOME} --verbose export | awk awk
+	'quoted text' x=1 /usr/bin export -eu test | done x=1 local 'quoted text' ${HOME}
+	grep "$1" done "$@" awk readonly 'quoted text' 'quoted text'
+#include c229.sh
+		| /usr/bin done grep -eu readonly done printf then done printf "$@" 2>/dev/null
+		${HOME} echo test /usr/bin export 'quoted text'
+	2>/dev/null grep --verbose printf cd sed awk 'quoted text'
+-eu done /usr/bin -eu readonly --verbose | -eu printf export "$1" printf
+x=1 $(pwd) test "$1" 2>/dev/null done sed ${HOME} 2>/dev/null
+		'quoted text' 2>/dev/null x=1 2>/dev/null
+&& cd readonly readonly $(pwd) 2>/dev/null "$1" "$1" 'quoted text'
+local readonly /usr/bin ${HOME} --verbose /usr/bin x=1 x=1
+	sed /usr/bin /usr/bin 2>/dev/null "$1" --verbose echo grep -eu 'quoted text'
+| 2>/dev/null sed readonly 'quoted text'
+	echo $(pwd) "$1" "$1" readonly
+	| grep && readonly cd $(pwd) awk 'quoted text'
+	local -eu "$1" then then sed done "$1" "$1" local export /usr/bin echo $(pwd)
+	'quoted text' -eu -eu "$1" printf | test grep -eu
+	'quoted text' done awk grep 2>/dev/null $(pwd) --verbose echo /usr/bin export
+		export $(pwd) | grep local done awk "$@"
+	${HOME} /usr/bin && "$1" 'quoted text' 2>/dev/null 2>/dev/null then $(pwd)
+	${HOME} --verbose awk export readonly -eu awk sed grep --verbose
+		2>/dev/null echo printf 'quoted text'
+'quoted text' printf done 2>/dev/null 2>/dev/null | -eu $(pwd) sed grep $(pwd)
+		--verbose local sed 2>/dev/null
+		$(pwd) 'quoted text' /usr/bin && sed --verbose
+		${HOME} && local readonly printf | "$@" /usr/bin
+		export "$@" local --verbose $(pwd) sed -eu && --verbose
+readonly ${HOME} export sed --verbose && local sed $(pwd) sed export
+		$(pwd) echo "$1" $(pwd) local export "$1" 'quoted text'
+		-eu then done "$1" 'quoted text' echo
+awk readonly $(pwd) readonly
+	x=1 'quoted text' "$@" --verbose --verbose "$1" x=1 'quoted text' test
+-eu 2>/dev/null local "$1" /usr/bin sed sed printf test cd --verbose
+		awk && && "$1" export | echo grep local 2>/dev/null 'quoted text' 2>/dev/null
+sed awk $(pwd) "$1" "$@" | x=1 grep -eu | readonly x=1 ${HOME} echo sed 'quoted text'
+		awk grep then $(pwd) echo sed "$1" export export echo then | 2>/dev/null
+	readonly -eu local 'quoted text' test local awk "$@" echo grep 'quoted text'
+-eu 'quoted text' echo cd | then
+	sed "$@" "$@" awk awk then x=1 local 2>/dev/null
+"$@" grep grep "$@" awk test -eu sed export export cd done
+'quoted text' && $(pwd) $(pwd) "$@" echo printf local test awk 'quoted text' &&
+echo ${HOME} 2>/dev/null grep test | local x=1 && then --verbose done grep
+		"$1" 2>/dev/null done -eu done ${HOME} --verbose readonly "$@" awk 2>/dev/null
+		'quoted text' 2>/dev/null
+	'quoted text' cd "$@" ${HOME} $(pwd) && --verbose
+		then grep export export awk test cd 2>/dev/null
+	&& done 2>/dev/null export
+then /usr/bin printf sed awk "$@" readonly "$1" "$@" --verbose printf --verbose
+		${HOME} "$@" test 'quoted text' then && export then ${HOME} echo
+		--verbose "$1" sed readonly
+	done local $(pwd) cd local 2>/dev/null "$1" "$@" | -eu export
+done "$@" | grep --verbose ${HOME} readonly 2>/dev/null cd grep echo
+	"$1" done && local --verbose ${HOME} sed grep -eu then
+	2>/dev/null /usr/bin --verbose
+	"$1" 2>/dev/null x=1 then ${HOME} test
+		${HOME} awk "$@" echo printf printf local && && readonly
+${HOME} ${HOME} | -eu x=1 --verbose awk ${HOME}
+		"$@" && ${HOME} $(pwd) cd grep sed ${HOME} &&
+	"$@" sed --verbose cd -eu export test local ${HOME}
+		test "$1" export done grep local "$1" local
+		$(pwd) --verbose cd local ${HOME} test export readonly ${HOME} $(pwd) export done
+test "$@" test -eu done x=1 sed | "$1" done "$@" grep grep "$@" export test
+awk | --verbose x=1 readonly awk echo
+	| local | "$@" /usr/bin "$1" x=1 export
+grep "$1" ${HOME} $(pwd) local test && && test 2>/dev/null "$@" readonly done
+-eu | 'quoted text' 'quoted text' readonly x=1 readonly x=1 -eu
+		/usr/bin && "$1" | then "$1" cd echo "$1" test -eu cd 2>/dev/null
+readonly awk cd echo awk readonly
+		| awk /usr/bin $(pwd) ${HOME} --verbose readonly ${HOME} grep -eu readonly
+		--verbose "$@" readonly "$@" $(pwd) printf 2>/dev/null $(pwd) $(pwd) 'quoted text'
+		grep done then $(pwd) "$@" local grep grep sed 2>/dev/null "$1" printf $(pwd) 2>/dev/null
+	export /usr/bin then "$1" done
+		"$1" "$@" readonly done export cd /usr/bin grep
+		"$@" $(pwd) "$1" sed printf -eu
+"$1" readonly /usr/bin -eu
+	printf cd x=1 --verbose then x=1 --verbose x=1 /usr/bin
+&& --verbose cd then export grep test echo sed done "$1" cd
+		export /usr/bin /usr/bin done echo grep grep
+-eu -eu 2>/dev/null && awk 'quoted text' -eu printf 'quoted text'
+		export && local "$@" export ${HOME} test /usr/bin test echo
+printf echo awk ${HOME} printf then 2>/dev/null "$@" $(pwd)
+awk --verbose export grep done 2>/dev/null -eu export readonly export
+	'quoted text' local local | | -eu && x=1 test readonly test grep -eu
+		local echo local test x=1 printf 'quoted text'
+	2>/dev/null done cd /usr/bin
+--verbose then cd grep /usr/bin export local
+cd readonly 2>/dev/null awk $(pwd)
+		x=1 grep -eu test $(pwd) 'quoted text' local export done sed && "$1"
+printf done printf 'quoted text' export
+		cd $(pwd) cd echo test readonly grep 'quoted text'
+		local /usr/bin sed export export $(pwd) export test | sed export echo /usr/bin
+printf echo $(pwd) /usr/bin readonly $(pwd) 2>/dev/null
+x=1 echo grep printf /usr/bin
+		then 2>/dev/null "$@" then
+	2>/dev/null local 'quoted text'
+		/usr/bin | test printf awk cd /usr/bin
+echo ${HOME} $(pwd) done -eu
+		cd "$@" --verbose -eu -eu echo cd local 'quoted text'
+${HOME} local then cd then grep --verbose readonly
+test -eu echo && test /usr/bin "$1" awk -eu && "$@" printf local && sed local
+	x=1 awk && printf ${HOME} sed ${HOME} export 'quoted text' "$1"
+cd sed x=1 | && x=1 ${HOME} --verbose echo ${HOME}
+		awk $(pwd) "$1" $(pwd) export
+		2>/dev/null awk -eu -eu local "$@" 2>/dev/null "$@" 2>/dev/null
+	| /usr/bin echo test grep readonly
+	-eu | readonly "$1" then printf local $(pwd) $(pwd) --verbose
+echo then grep export "$@" --verbose | grep done grep $(pwd) |
+		${HOME} sed local export printf grep && printf local --verbose x=1 local
+	2>/dev/null -eu sed then 'quoted text' test readonly done done --verbose
+"$1" done x=1 && cd test && readonly -eu awk grep 'quoted text'
+${HOME} printf "$@" awk x=1 | awk readonly $(pwd) printf
+2>/dev/null "$@" && -eu test | $(pwd) --verbose 'quoted text'
+		| then printf done "$1" awk sed awk x=1
+		${HOME} printf -eu then local 2>/dev/null && sed ${HOME} then
+		| x=1 sed test x=1 cd /usr/bin sed 'quoted text'
+-eu 2>/dev/null | --verbose then 'quoted text' sed | echo $(pwd) awk "$1" 'quoted text'
+		done /usr/bin --verbose | test /usr/bin done x=1
+	$(pwd) cd "$@" readonly 'quoted text' printf ${HOME} cd --verbose
+		2>/dev/null grep printf
+	printf test cd done 'quoted text' done export readonly "$@" local
+done && export echo 2>/dev/null 'quoted text' echo "$1" "$@" 2>/dev/null
+		echo done then -eu ${HOME} echo grep sed /usr/bin awk | "$@" done "$@"
+$(pwd) $(pwd) test "$1" readonly ${HOME}
+/usr/bin "$@" /usr/bin 2>/dev/null grep -eu 'quoted text' echo &&
+then cd echo done cd "$@" 2>/dev/null awk readonly
+x=1 test 'quoted text' echo done local /usr/bin echo "$1" echo
+		grep 'quoted text' grep printf -eu ${HOME} "$@" &&
+then 'quoted text' | | grep
+	sed awk local "$1" grep
+	done "$@" grep awk ${HOME} 2>/dev/null export 'quoted text' x=1 then grep readonly
+		done then sed x=1 --verbose readonly 'quoted text' awk echo x=1 done
+	--verbose 'quoted text' 'quoted text' printf awk readonly readonly cd export
+&& test -eu done | local 2>/dev/null /usr/bin 2>/dev/null echo | sed x=1 awk readonly
+		-eu cd awk grep 'quoted text'
+	2>/dev/null 2>/dev/null ${HOME} cd
+printf $(pwd) then | done 2>/dev/null test then x=1
+--verbose local printf $(pwd) readonly done grep
+	"$@" 'quoted text' x=1 "$1" ${HOME} local
+echo local --verbose grep 'quoted text'
+$(pwd) x=1 2>/dev/null
+	x=1 -eu then printf "$@" local echo local "$1" 2>/dev/null
+	then && --verbose "$@" sed --verbose ${HOME}
+cd done done ${HOME} grep local awk
+	awk 'quoted text' sed 'quoted text' awk awk "$1"
+	-eu awk 2>/dev/null sed
+then awk done 'quoted text' ${HOME} readonly
+	printf then 'quoted text' done /usr/bin
+		x=1 && --verbose /usr/bin local
+readonly sed -eu local --verbose printf awk printf readonly
+&& printf --verbose -eu ${HOME} $(pwd) done done awk sed -eu done
+	grep local printf cd $(pwd) sed 2>/dev/null
+		${HOME} then sed local "$@" && printf printf x=1 |
+	printf "$1" /usr/bin export printf "$@" export
+		sed cd local /usr/bin sed cd "$@" "$@" echo --verbose local echo
+		${HOME} export "$1" "$1" grep
+		cd ${HOME} $(pwd) --verbose
+	printf cd "$1" readonly "$1" export "$1" | then --verbose readonly
+	"$1" --verbose cd awk readonly
+		"$@" -eu awk 2>/dev/null done -eu cd $(pwd) echo
+		done && test test then
+	/usr/bin export $(pwd) -eu x=1 "$1" then
+	2>/dev/null "$@" $(pwd) "$@" && "$1" sed /usr/bin $(pwd)
+		local /usr/bin | ${HOME}
+		--verbose && $(pwd) && export
+		echo readonly /usr/bin "$@" $(pwd) test export x=1 &&
+'quoted text' cd ${HOME} readonly export then x=1 'quoted text' -eu && printf export
+awk 'quoted text' then && printf ${HOME} test --verbose printf readonly -eu
+	| grep export cd --verbose && x=1 --verbose && grep 'quoted text' export
+	export awk x=1 awk test -eu $(pwd) printf
+	-eu "$1" sed printf --verbose printf cd then test $(pwd) 2>/dev/null
+		${HOME} printf echo echo x=1 awk awk 2>/dev/null test
+	"$@" awk export /usr/bin local cd x=1 export cd awk -eu
+	-eu awk | cd then sed readonly
+		'quoted text' $(pwd) $(pwd) "$@" test awk local -eu x=1 readonly
+	local sed printf x=1 awk x=1 awk
+	done 'quoted text' x=1 cd x=1 export $(pwd) printf --verbose grep awk then
+${HOME} cd $(pwd) | cd export grep /usr/bin readonly grep ${HOME}
+	cd echo awk -eu echo "$1" awk test echo -eu echo ${HOME}
+	then ${HOME} echo x=1 "$@" $(pwd) awk | /usr/bin "$1" awk test --verbose awk
+local awk ${HOME} echo readonly | grep then --verbose /usr/bin
+then done "$@" printf cd 2>/dev/null
+$(pwd) done 'quoted text' then
+	cd "$1" | && cd 'quoted text' 2>/dev/null | grep -eu "$@"
+"$1" ${HOME} "$@" /usr/bin test "$1" test export
+	-eu cd grep -eu local echo -eu 2>/dev/null "$1" done sed "$1" 'quoted text'
+		echo echo local 'quoted text' export | "$@" -eu then /usr/bin readonly -eu
+		x=1 && cd x=1 $(pwd) local
+	-eu test x=1 cd test readonly /usr/bin done /usr/bin
+cd ${HOME} echo 2>/dev/null local
+	done /usr/bin $(pwd) export ${HOME} grep "$@" cd then
+sed printf readonly -eu -eu awk --verbose then then awk awk
+	2>/dev/null local printf | then export "$1" "$@"
+		--verbose "$1" cd x=1 sed && /usr/bin ${HOME} x=1 printf
+		awk x=1 sed "$1" x=1 grep ${HOME} test readonly
+/usr/bin test done "$@" && cd $(pwd) && /usr/bin awk 2>/dev/null
+| && ${HOME} x=1 then -eu && echo cd local "$@" 'quoted text' done | &&
+	sed awk -eu export cd grep --verbose sed cd
+then local $(pwd) -eu x=1 'quoted text' x=1 2>/dev/null awk && cd done
+/usr/bin then && sed cd --verbose -eu -eu printf -eu echo x=1 "$@" grep | cd 2>/dev/null
+		'quoted text' "$1" /usr/bin then ${HOME} grep | local
+	"$@" echo done 'quoted text' /usr/bin test
+awk printf 'quoted text'
+	x=1 $(pwd) cd test 'quoted text' then test readonly
+awk "$1" | x=1 -eu "$1" x=1 export --verbose | 2>/dev/null test
+		readonly cd | grep "$@" readonly export -eu "$@" "$@"
+	'quoted text' x=1 x=1 awk
+	then x=1 $(pwd) --verbose
+local echo test --verbose | 2>/dev/null done readonly -eu readonly 'quoted text'
+	export /usr/bin --verbose readonly --verbose
+	x=1 cd done | -eu sed x=1 cd ${HOME} /usr/bin
+	/usr/bin echo sed | "$@" ${HOME} readonly cd "$@" printf $(pwd)
+&& "$@" x=1 printf sed x=1 'quoted text'
+		test then x=1 printf | echo export x=1 export $(pwd) printf
+then "$@" ${HOME} /usr/bin && sed $(pwd) awk
+local test export then
+		'quoted text' then cd cd done | x=1 x=1 readonly -eu
+	x=1 printf printf export
+then "$@" export "$@" &&
+	readonly /usr/bin cd 'quoted text' test ${HOME}
+	awk "$@" 'quoted text' -eu
+&& | printf local $(pwd) --verbose
+"$@" --verbose -eu ${HOME} ${HOME} --verbose grep 'quoted text' sed "$@" readonly
+		| x=1 sed | echo grep local "$@" printf --verbose
+	readonly printf $(pwd) then test echo --verbose 2>/dev/null
+sed ${HOME} && done cd cd "$1" grep "$@" echo export $(pwd) --verbose
+		readonly ${HOME} cd ${HOME} awk 'quoted text' 2>/dev/null
+x=1 local 'quoted text' | ${HOME}
+local then $(pwd) /usr/bin ${HOME} "$1" -eu printf
+		readonly then 2>/dev/null sed "$@" readonly echo awk
+done echo "$@" ${HOME} sed 2>/dev/null done export | | sed printf echo "$@"
+${HOME} ${HOME} x=1 'quoted text' 2>/dev/null local done done
+export printf 2>/dev/null grep -eu awk sed 2>/dev/null $(pwd) sed
+	'quoted text' && "$1" | printf test x=1 then local grep 2>/dev/null
+test --verbose -eu 'quoted text'
+test readonly done x=1 2>/dev/null 'quoted text'
+	/usr/bin 'quoted text' && && && $(pwd) 'quoted text'
+	printf 'quoted text' | export
+cd readonly done --verbose then x=1 "$1" "$1" /usr/bin | then
+x=1 test "$1" "$1" readonly x=1 export printf sed sed -eu
+test then grep "$@" x=1 sed local grep "$@" export sed
+	echo /usr/bin "$@" /usr/bin printf awk done "$1" grep local
+		readonly /usr/bin sed --verbose
+		${HOME} --verbose grep local $(pwd) done then grep 2>/dev/null
+printf 2>/dev/null x=1 --verbose 2>/dev/null grep done done local && then
+&& then -eu sed done "$@" x=1 x=1 /usr/bin then cd && export 2>/dev/null
+grep /usr/bin $(pwd) | --verbose $(pwd) cd export
+		export then 'quoted text' printf ${HOME} 'quoted text' -eu awk
+		done printf "$1" && -eu awk ${HOME}
+sed ${HOME} ${HOME} local x=1 sed printf grep
+	2>/dev/null && then "$@" -eu awk 'quoted text' | x=1 "$@" | echo /usr/bin
+grep awk readonly /usr/bin echo then readonly then grep then local echo -eu
+grep -eu x=1 then printf local grep echo -eu "$@" printf "$@" 'quoted text' --verbose
+	printf --verbose done done -eu | "$@" $(pwd)
+		printf x=1 awk /usr/bin sed awk then 'quoted text'
+	&& ${HOME} | $(pwd) "$1" readonly test 'quoted text' -eu printf
+	then --verbose | awk -eu sed 'quoted text' | echo ${HOME} local
+	local grep /usr/bin then --verbose export then echo
+		${HOME} "$1" export done cd x=1 cd | "$@" 'quoted text'
+		sed cd printf readonly sed printf
+x=1 | then grep readonly $(pwd) cd && printf local then
+		x=1 done readonly test | sed sed
+		2>/dev/null test export done sed local awk
+&& export printf && ${HOME}
+printf grep --verbose /usr/bin export --verbose
+		$(pwd) 'quoted text' done -eu -eu export | done 'quoted text' echo
+		then echo "$@" sed printf ${HOME} "$@"
+--verbose "$1" ${HOME} | sed 'quoted text' 2>/dev/null && $(pwd)
+export "$@" ${HOME} cd cd ${HOME}
+echo sed --verbose | /usr/bin | done ${HOME} 'quoted text' /usr/bin printf cd sed
+	readonly $(pwd) x=1 /usr/bin $(pwd)
+		then "$@" awk -eu then local local readonly $(pwd) "$@" "$1" $(pwd) then
+${HOME} /usr/bin "$1" printf readonly awk grep --verbose
+		done awk export /usr/bin && awk --verbose && cd | --verbose echo | |
+	/usr/bin | local --verbose ${HOME} awk -eu /usr/bin ${HOME}
+		sed "$1" readonly test ${HOME} local grep && sed $(pwd) "$@"
+	"$1" export readonly 2>/dev/null local "$@"
+		sed test 'quoted text' grep
+		readonly ${HOME} --verbose "$@" done --verbose
+awk cd test --verbose 2>/dev/null | $(pwd) export readonly | /usr/bin
+	export | ${HOME} && export local 'quoted text' 2>/dev/null | grep "$@" ${HOME}
+printf x=1 -eu x=1 'quoted text' then done && 'quoted text' "$1" 'quoted text'
+	printf --verbose | -eu then 2>/dev/null sed done --verbose x=1 echo then
+		-eu export export $(pwd) done awk
+| export 2>/dev/null sed --verbose
+	grep ${HOME} readonly "$@" echo && x=1 echo ${HOME} "$@" echo 'quoted text'
+${HOME} export && "$@" test grep x=1 export
+	sed cd && export then echo echo /usr/bin
+2>/dev/null readonly --verbose
+x=1 then cd $(pwd) x=1 $(pwd) 'quoted text' 2>/dev/null
+		done cd grep --verbose then grep "$1" cd
+	echo && 2>/dev/null sed x=1 local 'quoted text' grep export grep sed cd
+	| readonly 2>/dev/null local then x=1 test then --verbose ${HOME} export $(pwd)
+	$(pwd) sed test ${HOME} $(pwd) | /usr/bin cd 'quoted text' "$@" then
+| sed -eu $(pwd) grep /usr/bin awk done --verbose --verbose done
+--verbose ${HOME} grep "$1" grep
+then grep "$@" "$@" ${HOME} $(pwd) export /usr/bin sed && test cd
+		grep done export /usr/bin -eu printf "$@" test test grep test && local cd --verbose
+2>/dev/null 'quoted text' export printf printf
+	done awk test awk printf | $(pwd) awk printf then | "$1" | /usr/bin
+		readonly -eu "$1" printf test echo then sed 'quoted text' cd
+printf "$@" x=1 export printf -eu /usr/bin -eu 2>/dev/null
+	readonly echo then ${HOME} test awk "$1" then test "$1" done echo readonly | | readonly
+		awk && printf 'quoted text' -eu grep
+"$@" "$1" awk 'quoted text' export
+	"$@" ${HOME} --verbose "$@"
+	cd awk $(pwd) 'quoted text'
+		cd && "$@" test --verbose sed test
+	&& /usr/bin echo awk -eu export 2>/dev/null readonly /usr/bin echo awk cd 2>/dev/null
+	export echo -eu ${HOME} 'quoted text' --verbose awk -eu 'quoted text'
+then /usr/bin -eu -eu test local done --verbose cd awk x=1 cd x=1 printf cd $(pwd)
+"$@" && done echo sed ${HOME} printf test 'quoted text' done ${HOME} -eu
+		"$@" "$1" cd && local $(pwd) -eu "$@" grep then "$@" ${HOME} | awk $(pwd)
+	"$1" done && --verbose export && /usr/bin x=1 /usr/bin /usr/bin
+&& "$1" "$@" readonly sed -eu && 'quoted text' 2>/dev/null
+	x=1 printf ${HOME} | sed x=1 sed grep x=1 | "$@" grep cd
+	then 'quoted text' 2>/dev/null cd then local -eu test sed "$@" readonly
+local -eu cd /usr/bin then && --verbose
+echo --verbose then $(pwd) test test && "$@" $(pwd)
+grep x=1 'quoted text' awk -eu && then | ${HOME} --verbose "$1" x=1 cd | /usr/bin
+	sed x=1 done | 2>/dev/null local 2>/dev/null
+&& local --verbose "$1" /usr/bin export grep "$1" /usr/bin "$1" --verbose
+	&& test test "$1" -eu cd | ${HOME} /usr/bin
+"$@" local export test echo echo awk -eu done then awk readonly
+		test printf awk --verbose sed x=1 sed | "$@"
+	echo 2>/dev/null x=1 'quoted text' "$@" "$1" awk ${HOME} | $(pwd) |
+		"$1" grep $(pwd) x=1 x=1 "$@" grep printf done grep
+	| "$1" cd cd cd local done readonly | "$@"
+${HOME} readonly -eu done --verbose | "$1" then
+'quoted text' && cd --verbose
+--verbose echo -eu ${HOME} $(pwd) grep export
+		&& 'quoted text' "$@" $(pwd) "$1" export readonly /usr/bin test done "$@" then
+printf then | grep ${HOME} ${HOME}
+cd cd export export done local && sed &&
+		"$@" echo $(pwd) grep printf
+		printf readonly echo && then | local grep test grep
+		"$@" echo x=1 -eu && echo && && /usr/bin cd export
+	printf local ${HOME} sed ${HOME} echo export ${HOME} "$@" 2>/dev/null
+local echo | done done cd done /usr/bin echo
+		done export -eu test ${HOME} x=1
+	echo sed 2>/dev/null 2>/dev/null test 'quoted text'
+		sed then then echo --verbose /usr/bin /usr/bin
+-eu export echo ${HOME} 2>/dev/null $(pwd) echo done
+		&& cd x=1 | awk --verbose 2>/dev/null | -eu local readonly
+		'quoted text' $(pwd)
+		x=1 && ${HOME} /usr/bin
+x=1 'quoted text' "$@" $(pwd) readonly
+	"$1" printf export awk 2>/dev/null 2>/dev/null
+$(pwd) "$1" 2>/dev/null ${HOME} "$1" -eu 2>/dev/null
+		'quoted text' "$1" grep then cd 'quoted text'
+	-eu readonly | printf printf grep local x=1 2>/dev/null
+	$(pwd) export $(pwd) "$@" | test sed readonly 2>/dev/null grep sed
+--verbose cd "$1" "$1"
+		cd export local /usr/bin readonly -eu sed done x=1 done "$1" && "$@"
+$(pwd) $(pwd) "$1" $(pwd) 2>/dev/null sed
+	done then "$@" export 2>/dev/null readonly && export $(pwd)
+sed printf | /usr/bin $(pwd) | x=1 printf "$1" echo && test printf
+		sed export | 'quoted text' export 2>/dev/null
+	cd && echo echo 2>/dev/null grep | readonly readonly --verbose "$1"
+test "$@" "$@" --verbose readonly "$1" 'quoted text' /usr/bin
+${HOME} ${HOME} x=1 'quoted text' awk "$1"
+	local ${HOME} 'quoted text' | export --verbose ${HOME} awk cd 'quoted text' --verbose
+		/usr/bin readonly test 2>/dev/null grep
+echo | "$1" "$@" x=1 | --verbose x=1 local
+"$@" --verbose sed test 2>/dev/null | 2>/dev/null
+then "$@" 'quoted text' && awk | grep $(pwd) done sed
+&& 'quoted text' cd 2>/dev/null x=1
+		then sed printf -eu 2>/dev/null grep
+		readonly grep /usr/bin 2>/dev/null echo
+| test readonly then awk "$@" 2>/dev/null ${HOME}
+grep then x=1 ${HOME} awk -eu "$@" grep /usr/bin --verbose
+awk 'quoted text' readonly x=1 export
+		then grep echo done 'quoted text' && awk cd | test -eu
+	printf then ${HOME} awk readonly
+/usr/bin $(pwd) readonly
+		grep grep "$1" test test cd && && "$1"
+		&& --verbose && then then readonly 2>/dev/null test local "$1" export readonly
+awk x=1 sed "$1" 2>/dev/null sed x=1 cd ${HOME} x=1 | | 'quoted text'
+	$(pwd) "$1" 'quoted text'
+| 'quoted text' $(pwd) ${HOME} "$1" then "$1" 'quoted text' echo local
+	cd printf done /usr/bin ${HOME}
+	--verbose | "$1" "$@" readonly
+		"$1" cd x=1 printf awk done $(pwd) export cd x=1 cd sed -eu readonly
+		--verbose grep cd sed readonly /usr/bin local export 'quoted text'
+		sed && "$@" readonly 'quoted text' -eu printf
+		echo done 'quoted text' local awk then done "$1" grep test --verbose
+	2>/dev/null x=1 'quoted text' --verbose done readonly x=1 $(pwd) then
+		-eu "$@" $(pwd) test | "$1" $(pwd) test -eu | awk
+	then && readonly test $(pwd)
+/usr/bin grep awk local ${HOME} grep 2>/dev/null
+		cd grep ${HOME} echo /usr/bin export $(pwd)
+echo grep echo grep --verbose local echo test 2>/dev/null sed $(pwd)
+local grep --verbose | "$1" test && "$1" awk cd 'quoted text' test 2>/dev/null
+		'quoted text' echo done printf printf "$@" /usr/bin "$1" $(pwd) $(pwd)
+readonly /usr/bin readonly printf 'quoted text' /usr/bin
+		'quoted text' sed "$@" printf
+	x=1 --verbose "$@" $(pwd)
+	cd printf test local done test local grep printf
+		$(pwd) "$1" | sed 'quoted text' $(pwd) printf
+	local 2>/dev/null 2>/dev/null | && 2>/dev/null | /usr/bin ${HOME} -eu printf "$@"
+$(pwd) awk then 'quoted text'
+then echo test sed test readonly
+		-eu 'quoted text' test $(pwd) awk
+		sed --verbose sed | x=1 awk -eu x=1
+		cd export cd "$1" local
+	printf --verbose echo export && cd /usr/bin | x=1 readonly printf
+export readonly --verbose -eu ${HOME} "$1" export --verbose ${HOME} x=1
+then then done printf done
+		"$@" | && printf "$1"
+export then -eu cd | 'quoted text' $(pwd) --verbose | $(pwd) grep $(pwd)
+export $(pwd) -eu then grep test then echo -eu "$@" 2>/dev/null awk
+	printf local grep sed awk grep "$1" /usr/bin $(pwd)
+	printf --verbose awk grep | sed echo $(pwd) | local --verbose
+	sed && ${HOME} "$@" x=1 grep echo echo && /usr/bin
+		printf | -eu --verbose && ${HOME} echo ${HOME} readonly cd && grep
+	done local test "$@" echo echo -eu local then echo test cd
+grep "$@" -eu "$1" printf grep
+sed printf grep then | echo
+	/usr/bin done --verbose x=1 export "$1" $(pwd) awk local --verbose --verbose
+		"$@" sed 2>/dev/null "$@" test grep
+	| test test 2>/dev/null $(pwd) export | /usr/bin $(pwd)
+export | 2>/dev/null echo test "$1" | ${HOME} local ${HOME} sed
+	--verbose echo sed -eu readonly x=1 then "$@" awk
+	2>/dev/null done | 2>/dev/null
+	&& export ${HOME} $(pwd) grep 2>/dev/null test "$1" test $(pwd) local done done
+		cd /usr/bin done test ${HOME}
+		$(pwd) && 2>/dev/null 2>/dev/null then
+"$1" | done printf && --verbose "$@" | grep export cd -eu /usr/bin
+done readonly local 'quoted text'
+		--verbose test local test "$1" done test | "$1" awk
+	grep readonly -eu && 'quoted text' local &&
+	printf local && export && $(pwd) grep 'quoted text'
+	-eu readonly then "$@" /usr/bin readonly
+		echo "$1" cd readonly
+"$1" ${HOME} $(pwd) echo | && /usr/bin
+${HOME} "$@" "$1" sed $(pwd) && 'quoted text' $(pwd) test 2>/dev/null --verbose
+		/usr/bin 'quoted text' 'quoted text'
+		echo "$@" grep ${HOME} 2>/dev/null 2>/dev/null done ${HOME}
+	${HOME} 'quoted text' local grep echo && awk --verbose
+		cd ${HOME} "$1" readonly /usr/bin $(pwd) grep test echo echo echo readonly
+/usr/bin "$1" && test awk cd ${HOME}
+		'quoted text' "$1" done awk cd echo "$1" test -eu readonly
+	sed && 'quoted text' "$1" test x=1 2>/dev/null "$@" 'quoted text'
+done printf then readonly readonly export then
+	local -eu -eu | readonly ${HOME} "$@" then printf grep /usr/bin
+cd awk -eu "$1" 2>/dev/null --verbose 2>/dev/null
+	x=1 echo grep echo 'quoted text'
+	"$1" done --verbose /usr/bin export 2>/dev/null done echo --verbose
+		local x=1 grep $(pwd)
+2>/dev/null && readonly "$1" /usr/bin then "$1" then echo
+| x=1 then 2>/dev/null 2>/dev/null cd x=1 grep grep && export x=1 "$1" grep
+		"$@" $(pwd) cd --verbose test "$1" ${HOME} /usr/bin | $(pwd) 'quoted text'
+		"$1" test then 'quoted text' /usr/bin
+		'quoted text' "$1" | then export printf && printf --verbose
+then readonly done echo local
+	local cd "$1" x=1 printf sed
+	then awk awk 2>/dev/null |
+	test export && awk 'quoted text' printf "$@" "$1" sed $(pwd) 'quoted text' 2>/dev/null
+printf printf 2>/dev/null
+export export -eu sed ${HOME} 2>/dev/null 'quoted text' test
+grep readonly awk && awk export && ${HOME} --verbose
+	export $(pwd) /usr/bin done
+	x=1 export 2>/dev/null printf
+	printf cd done grep && local && sed then "$1" local sed -eu cd readonly
+		$(pwd) local cd echo && export && local 2>/dev/null cd x=1 && -eu /usr/bin
+echo "$@" "$@" export "$1" export then test -eu ${HOME}
+	--verbose done local -eu export | | printf "$@" && cd readonly
+	readonly x=1 --verbose grep awk 'quoted text' done
+		done /usr/bin $(pwd) printf ${HOME} cd
+		"$1" printf && "$1" then --verbose -eu
+"$1" echo 'quoted text' /usr/bin
+		${HOME} "$@" awk -eu && test 2>/dev/null --verbose &&
+		-eu 2>/dev/null readonly export awk sed sed -eu x=1 /usr/bin
+	done | ${HOME} grep then awk sed 'quoted text'
+export awk -eu grep --verbose 2>/dev/null
+		--verbose x=1 grep echo 2>/dev/null test cd $(pwd)
+	| | test sed then sed readonly --verbose && -eu test test local grep $(pwd) /usr/bin
+then cd "$@" 'quoted text' printf echo $(pwd) ${HOME} "$1"
+		echo then cd $(pwd) "$@" awk sed | printf | && 'quoted text'
+grep grep 2>/dev/null local ${HOME} "$@" | --verbose /usr/bin 'quoted text'
+	&& && test --verbose done grep /usr/bin sed $(pwd) ${HOME} /usr/bin printf echo
+		/usr/bin export then echo
+printf /usr/bin | $(pwd) $(pwd)
+export "$@" | done $(pwd)
+		"$@" ${HOME} "$1" && readonly
+	--verbose "$1" grep echo --verbose && /usr/bin sed done /usr/bin --verbose
+		-eu /usr/bin --verbose "$1"
+		"$@" | ${HOME} then "$1" echo then x=1 sed ${HOME}
+	grep then cd && awk x=1 x=1 test "$1" local --verbose
+sed done then sed cd awk "$1" --verbose && awk awk
+	2>/dev/null "$1" then printf sed done awk sed readonly 'quoted text'
+sed awk grep "$1" grep 2>/dev/null done ${HOME} 2>/dev/null "$1" "$@" 2>/dev/null
+	done 'quoted text' sed "$1" --verbose x=1 ${HOME}
+	"$@" cd -eu printf printf /usr/bin 2>/dev/null
+	sed then ${HOME} readonly "$@" "$@" 2>/dev/null $(pwd) readonly
+	| 'quoted text' awk | sed cd export done "$1" done
+		echo x=1 done awk awk "$@" echo export && sed
+		then local readonly -eu cd ${HOME} readonly readonly sed awk "$1"
+	&& export "$1" --verbose awk x=1 done x=1 local 'quoted text'
+		printf done echo printf -eu 'quoted text' $(pwd) sed readonly done 'quoted text'
+export "$1" grep awk then done 'quoted text'
+		&& grep export "$@" $(pwd) "$@" echo grep
+/usr/bin done | grep local done export grep "$@" /usr/bin echo /usr/bin readonly
+		--verbose | --verbose "$1" && "$@" cd $(pwd) test export -eu export
+		'quoted text' "$@" --verbose 'quoted text' 'quoted text' 2>/dev/null awk 2>/dev/null
+	local echo "$@" test "$@" 'quoted text' cd $(pwd)
+		--verbose 'quoted text' 2>/dev/null test cd awk
+	/usr/bin grep -eu x=1 /usr/bin 2>/dev/null "$@" -eu printf 'quoted text'
+		awk $(pwd) --verbose /usr/bin readonly
+/usr/bin local echo && echo printf readonly awk echo
+/usr/bin echo x=1 done "$@" | 'quoted text' test printf echo cd
+readonly /usr/bin -eu --verbose cd --verbose export local local printf
+		grep readonly cd /usr/bin local | done
+x=1 --verbose done export local awk
+		"$@" 2>/dev/null cd ${HOME} done x=1 /usr/bin ${HOME} x=1 "$1" printf export
+awk /usr/bin grep test | local 'quoted text' --verbose cd
+grep local 'quoted text' test grep
+		sed then export then ${HOME} 'quoted text' x=1 $(pwd) /usr/bin done /usr/bin 2>/dev/null
+	"$@" --verbose done 'quoted text' $(pwd) grep |
+$(pwd) "$1" --verbose |
+${HOME} printf echo $(pwd) "$@" -eu readonly /usr/bin "$@" /usr/bin
+x=1 /usr/bin printf grep test test | ${HOME} ${HOME} then && test test
+		2>/dev/null test test -eu then readonly
+	export echo done "$@" sed ${HOME} echo ${HOME} | local | $(pwd)
+	printf /usr/bin -eu export "$1"
+	-eu done test local awk 'quoted text'
+		grep readonly $(pwd) then /usr/bin | grep 'quoted text' --verbose && sed x=1
+	test -eu $(pwd) readonly && && then
+		test grep "$@" then printf --verbose 'quoted text' export awk --verbose echo
+	--verbose export readonly x=1
+	'quoted text' test sed printf /usr/bin $(pwd) then test ${HOME} local $(pwd)
+		&& printf "$1" 2>/dev/null cd -eu local
+		| test echo grep echo 2>/dev/null $(pwd)
+	done printf $(pwd) $(pwd) readonly
+	done printf /usr/bin "$1" sed done | awk done 2>/dev/null done 'quoted text'
+	x=1 export "$1" --verbose x=1
+grep "$1" test readonly /usr/bin grep test x=1
+	readonly /usr/bin "$@" ${HOME} --verbose $(pwd)
+echo $(pwd) 2>/dev/null printf && awk 2>/dev/null
+export printf "$1" echo printf echo
+		readonly done "$@" | $(pwd) export --verbose --verbose
+sed cd sed -eu /usr/bin && readonly
+grep | sed local done $(pwd) -eu | "$@" readonly 'quoted text'
+x=1 cd && awk awk 2>/dev/null awk sed echo test export ${HOME} printf
+$(pwd) echo readonly local test ${HOME} then "$@" $(pwd) grep "$@" $(pwd)
+cd then $(pwd) -eu | export cd 2>/dev/null 2>/dev/null
+--verbose "$@" local then 2>/dev/null done local done 2>/dev/null "$@" &&
+readonly "$@" x=1 ${HOME} /usr/bin 'quoted text' "$1" sed
+	'quoted text' then $(pwd) local export printf && ${HOME} done
+		grep ${HOME} printf sed awk echo cd x=1 && "$@" done "$1" | done "$@" /usr/bin
+&& -eu 2>/dev/null test echo && -eu "$1" --verbose sed cd "$@" "$@" echo --verbose
+		'quoted text' grep -eu ${HOME}
+local ${HOME} 2>/dev/null cd readonly
+--verbose $(pwd) local export
+local sed grep /usr/bin |
+test grep awk ${HOME} -eu && grep
+	then readonly "$1" export | && | --verbose ${HOME}
+	--verbose -eu sed && then cd printf 'quoted text' export /usr/bin
+		-eu /usr/bin cd x=1 "$1" "$1" cd local test sed sed
+done local "$@" ${HOME} local sed then sed
+	x=1 test export 'quoted text' /usr/bin "$1" printf "$1" local | | 2>/dev/null
+		'quoted text' -eu echo 2>/dev/null 'quoted text' test x=1 'quoted text'
+		then echo then readonly then
+		sed local ${HOME} x=1 sed --verbose test sed test | $(pwd) --verbose
+awk "$@" 2>/dev/null awk
+		"$1" sed export cd test awk
+"$@" "$1" awk awk x=1 'quoted text' printf echo |
+		/usr/bin "$@" "$@" grep 'quoted text'
+		test local ${HOME} /usr/bin 'quoted text'
+grep && -eu x=1 export sed /usr/bin "$@" && test then x=1 local
+		"$1" 2>/dev/null sed cd ${HOME} printf
+	test | done && printf test --verbose x=1 && cd
+grep --verbose -eu cd $(pwd) -eu x=1 x=1 then $(pwd) ${HOME} echo
+x=1 && && awk "$1" done x=1 export
+		printf sed "$@" local | grep | sed done awk "$1" readonly
+		/usr/bin grep && echo && &&
+x=1 'quoted text' export x=1 x=1 awk printf printf test sed awk export
+		test 2>/dev/null && x=1 && ${HOME} then 'quoted text' | /usr/bin 2>/dev/null
+		/usr/bin --verbose ${HOME} echo done
+		local ${HOME} awk && printf 'quoted text'
+		cd cd /usr/bin done 2>/dev/null "$@"
+	test grep "$1" "$1" && $(pwd)
+		"$1" && cd awk x=1 ${HOME} printf export | test "$1" ${HOME} test
+	export 2>/dev/null echo -eu x=1 /usr/bin
+		cd 'quoted text' export $(pwd) printf awk "$@" export cd done ${HOME} awk export
+	local sed readonly cd printf
+		then then --verbose --verbose -eu local done "$1" "$1" then
+	2>/dev/null "$@" $(pwd) done "$@" 'quoted text' -eu awk grep /usr/bin $(pwd)
+	&& test $(pwd) --verbose printf x=1 then -eu then sed awk printf 2>/dev/null readonly
+	test cd $(pwd) /usr/bin
+	2>/dev/null export readonly --verbose --verbose grep "$1" grep /usr/bin 2>/dev/null
+	${HOME} grep printf done
+	&& then "$1" echo cd grep "$1"
+-eu cd local "$1" --verbose --verbose
+	sed printf 'quoted text' grep test sed printf echo --verbose
+		--verbose grep 'quoted text' "$@" "$@" export /usr/bin cd readonly
+"$@" 2>/dev/null cd -eu
+${HOME} $(pwd) readonly then 'quoted text' readonly then "$1" "$1" sed "$1" local
+		&& x=1 awk export x=1 ${HOME} 'quoted text' local "$@" export /usr/bin
+	| ${HOME} test cd then x=1 grep
+--verbose 'quoted text' "$1" && done done test then 2>/dev/null ${HOME} cd
+		test grep -eu done /usr/bin readonly done awk then
+grep /usr/bin "$1" awk 2>/dev/null done echo test then echo awk
+	printf 'quoted text'
+		'quoted text' printf $(pwd) x=1 x=1 ${HOME} grep &&
+echo x=1 cd echo readonly
+local | "$1" --verbose -eu local
+	awk | --verbose done sed -eu printf test "$@" local --verbose 'quoted text' 'quoted text'
+		${HOME} && "$1" local | /usr/bin then x=1 "$1" test awk cd | printf
+		then test export | readonly grep "$1" "$@" | "$1" --verbose
+awk /usr/bin then /usr/bin local grep x=1 /usr/bin -eu | grep -eu ${HOME}
+		'quoted text' x=1 && then done export printf grep sed 'quoted text'
+grep sed cd export cd --verbose 2>/dev/null "$@" $(pwd) "$1" -eu 2>/dev/null
+sed "$1" awk echo "$1" | --verbose then --verbose test awk readonly
+		-eu grep echo export awk test awk readonly export $(pwd)
+	"$@" --verbose x=1 $(pwd) test
+	--verbose readonly grep done sed printf 'quoted text'
+cd readonly | awk x=1 local test
+| cd -eu test export local 'quoted text' echo
+		/usr/bin awk 2>/dev/null $(pwd) $(pwd) /usr/bin sed
+	-eu ${HOME} cd && awk /usr/bin ${HOME} awk local awk test
+export test sed then x=1 printf cd | "$@" /usr/bin then printf then test cd grep
+		export test local cd ${HOME} && test sed 2>/dev/null "$@" sed && printf -eu "$@"
+$(pwd) "$1" 2>/dev/null $(pwd)
+sed cd awk /usr/bin readonly ${HOME} -eu --verbose
+		export sed 'quoted text' printf echo && "$@"
+	| x=1 readonly export done
+	grep --verbose sed $(pwd) then 2>/dev/null -eu -eu cd ${HOME} export printf
+	| "$@" --verbose test 2>/dev/null printf grep
+		done test done then --verbose local
+${HOME} sed 'quoted text' local $(pwd) && export printf 'quoted text' 2>/dev/null
+	"$1" grep /usr/bin 2>/dev/null
+		cd 2>/dev/null readonly printf export printf grep awk 2>/dev/null 2>/dev/null
+2>/dev/null "$@" ${HOME} -eu ${HOME} "$1" cd | $(pwd) readonly
+	echo done printf done && "$@" grep cd printf sed test 2>/dev/null
+		local $(pwd) test cd -eu echo --verbose echo done /usr/bin
+		grep $(pwd) x=1 x=1 -eu | readonly grep
+grep test | test cd grep then grep done
+done grep | awk x=1 "$1"
+		2>/dev/null export cd cd --verbose awk --verbose readonly --verbose
+x=1 printf sed && /usr/bin 'quoted text' awk | test export
+	grep grep printf 'quoted text'
+	$(pwd) cd $(pwd) sed echo printf test then echo
+	--verbose && awk grep
+		--verbose sed --verbose ${HOME} local local echo done && echo readonly | --verbose
+done cd 2>/dev/null $(pwd) readonly
+	"$@" | "$1" ${HOME} then cd awk test then 2>/dev/null $(pwd) awk echo done /usr/bin
+		$(pwd) && printf x=1 "$1" grep cd done "$1" awk export sed awk local awk done
+sed 'quoted text' readonly $(pwd) --verbose done "$1" 'quoted text' x=1
+then cd then /usr/bin ${HOME} readonly echo readonly "$@" "$@" cd then echo
+$(pwd) export export --verbose 2>/dev/null grep export | "$@" readonly
+	--verbose ${HOME} x=1 ${HOME} export awk done 'quoted text'
+	sed cd export $(pwd) printf $(pwd) $(pwd) "$@" local readonly --verbose
+		awk test | then | | | awk ${HOME} export
+	test $(pwd) | printf echo test done $(pwd) done sed echo /usr/bin awk sed x=1
+		/usr/bin cd 'quoted text' ${HOME} export
+	2>/dev/null test /usr/bin && test local test done readonly then && test
+/usr/bin grep export grep echo
+	| awk grep "$1" grep then awk done -eu 2>/dev/null export echo /usr/bin $(pwd)
+		then done echo ${HOME} --verbose
+		echo then 'quoted text' echo echo $(pwd) ${HOME} export 'quoted text' readonly
+x=1 $(pwd) /usr/bin then $(pwd) 'quoted text' && then 2>/dev/null
+x=1 readonly cd test test export 'quoted text' "$1" export awk 'quoted text'
+$(pwd) "$1" readonly export readonly awk 'quoted text' echo && echo && /usr/bin
+'quoted text' grep ${HOME} printf then test "$@" export "$1" $(pwd) cd 'quoted text'
+		-eu 'quoted text' --verbose /usr/bin grep cd $(pwd) echo export
+x=1 "$1" cd -eu local then -eu /usr/bin printf 2>/dev/null readonly export
+	then /usr/bin then done $(pwd) && printf sed "$@" sed && ${HOME} grep x=1 && -eu
+		readonly sed "$1" --verbose --verbose "$@" ${HOME} grep
+2>/dev/null $(pwd) sed 'quoted text' cd readonly x=1 test then export
+	grep export x=1 "$@" "$1" /usr/bin x=1 readonly | --verbose echo | printf
+		printf local --verbose 'quoted text' test grep readonly awk
+	export printf x=1 grep grep | echo -eu test && | echo grep readonly
+	test test readonly then | then $(pwd)
+	export 'quoted text' export | echo done -eu readonly -eu grep cd -eu $(pwd) cd "$1"
+	--verbose --verbose 'quoted text' readonly local "$@" awk cd --verbose
+| export /usr/bin local /usr/bin "$@"
+"$1" echo | "$@" /usr/bin 'quoted text' --verbose --verbose $(pwd) -eu test
+		done sed printf readonly export echo cd x=1 echo && then ${HOME}
+done sed local sed export export
+	&& cd export | sed ${HOME} | $(pwd) readonly "$1" -eu x=1 cd test ${HOME} $(pwd)
+	done local && echo grep 2>/dev/null printf "$1" -eu awk | then local sed 'quoted text'
+"$1" export printf --verbose 2>/dev/null
+export | then echo grep
+"$1" 'quoted text' 'quoted text' && && then export then $(pwd)
+		echo "$@" local "$1" x=1 ${HOME} | ${HOME}
+cd readonly x=1 printf x=1 'quoted text' awk then
+		/usr/bin x=1 2>/dev/null -eu cd "$1" /usr/bin
+printf -eu readonly x=1 readonly export
+${HOME} cd printf 'quoted text' done /usr/bin | grep
+	$(pwd) done readonly local
+awk printf -eu "$@" awk export "$1" echo readonly printf local 'quoted text'
+	grep echo -eu 2>/dev/null
+printf test cd x=1 'quoted text'
+done grep 2>/dev/null "$@" x=1 --verbose readonly |
+local done "$@" | local $(pwd) cd | printf 'quoted text' | && export
+${HOME} sed "$@" test local local done --verbose | ${HOME}
+		/usr/bin x=1 x=1 printf export cd "$@" --verbose awk 2>/dev/null --verbose "$@"
+	done echo sed /usr/bin
+		${HOME} "$@" 2>/dev/null | export printf
+-eu sed local 2>/dev/null sed local sed
+		printf local --verbose printf export awk ${HOME} done x=1
+then printf cd -eu ${HOME}
+		&& readonly x=1 x=1 cd 'quoted text' --verbose -eu -eu grep export printf
+	cd && 2>/dev/null "$1" && && readonly then
+		local --verbose readonly x=1 && 'quoted text' 2>/dev/null cd local then
+-eu done ${HOME} | then awk then $(pwd) 'quoted text' cd printf 'quoted text'
+		-eu ${HOME} ${HOME} --verbose
+		echo ${HOME} test cd "$@" "$@" grep export printf test sed
+	local 2>/dev/null sed -eu awk --verbose local 'quoted text'
+		-eu $(pwd) readonly awk printf export
+	grep -eu --verbose printf
+	done echo local 2>/dev/null sed test cd 'quoted text'
+		awk test local "$@" "$1" export "$1" | x=1
+		sed /usr/bin -eu export ${HOME} "$1" && && -eu readonly export readonly
+	--verbose 'quoted text' done awk "$@" done local test 'quoted text' "$@"
+		'quoted text' 2>/dev/null export
+	awk "$1" then grep --verbose x=1 | awk ${HOME} $(pwd)
+"$@" x=1 test "$1" 'quoted text' grep
+	x=1 -eu x=1 grep --verbose $(pwd) "$1" printf x=1 -eu echo cd export --verbose
+	done sed $(pwd) readonly 'quoted text'
+		${HOME} test $(pwd) export export | then
+	/usr/bin /usr/bin local cd --verbose
+	sed --verbose 'quoted text' test awk then local
+--verbose $(pwd) cd 2>/dev/null done ${HOME} printf
+awk done sed && readonly "$@" grep local echo readonly x=1 export ${HOME} && ${HOME}
+		echo awk | "$1" sed test readonly done done then sed x=1 ${HOME} local
+sed 'quoted text' sed 'quoted text'
+	${HOME} export x=1 | |
+grep local x=1 local test
+		sed done -eu ${HOME} x=1 then local echo 'quoted text' x=1 export "$1"
+readonly -eu awk sed 'quoted text'
+test /usr/bin /usr/bin awk $(pwd) local test 'quoted text'
+	awk sed readonly 2>/dev/null | 2>/dev/null printf $(pwd) x=1 awk
+	| local test local then cd "$1" --verbose ${HOME} && then grep x=1 | readonly
+	-eu grep ${HOME} $(pwd) x=1 printf test
+		echo && 2>/dev/null "$1" && -eu
+		grep local cd -eu printf 'quoted text' "$@" export
+readonly "$1" x=1 grep "$1" grep "$1" 2>/dev/null | --verbose cd -eu x=1
+		x=1 --verbose x=1 cd echo 2>/dev/null /usr/bin
+		2>/dev/null then x=1 awk "$@" awk | awk x=1 | export echo cd printf
+'quoted text' /usr/bin -eu export test --verbose sed -eu && export
+"$1" then printf cd local awk awk && /usr/bin
+readonly "$1" /usr/bin ${HOME} done grep 2>/dev/null export printf readonly
+	'quoted text' | then x=1
+awk x=1 echo printf readonly
+x=1 | cd 2>/dev/null test local export awk "$1" awk grep "$@" x=1 grep "$1"
+		sed "$@" local "$@" x=1 grep readonly "$1"
+		cd --verbose 2>/dev/null "$@" -eu echo test then "$1" ${HOME} export
+	awk x=1 export printf /usr/bin $(pwd) -eu "$1" $(pwd)
+| then readonly --verbose then --verbose done
+		2>/dev/null export export -eu sed test printf done printf
+		"$1" $(pwd) --verbose done &&
+test echo cd && && done awk
+'quoted text' $(pwd) 'quoted text'
+		/usr/bin 'quoted text' test $(pwd) --verbose
+	then readonly readonly ${HOME} then done local grep
+	"$@" awk ${HOME} && local -eu ${HOME} awk printf done readonly ${HOME} ${HOME}
+"$@" -eu export export "$@" --verbose --verbose grep
+echo --verbose grep x=1 --verbose /usr/bin readonly "$1" "$1" cd ${HOME}
+	printf && x=1 && | grep && sed cd sed "$@" --verbose ${HOME}
+x=1 then cd local cd | readonly "$1"
+		/usr/bin grep grep "$@" $(pwd) cd grep
+then then export printf ${HOME} /usr/bin
+"$1" ${HOME} | 2>/dev/null sed grep x=1 "$@" done
+sed awk done echo "$@" sed done sed | then cd local | then $(pwd) && 'quoted text'
+	x=1 'quoted text' echo then grep $(pwd) cd --verbose done "$@" x=1 done
+	--verbose local readonly then 2>/dev/null then "$1" awk awk 2>/dev/null
+grep "$1" /usr/bin ${HOME} export
+export "$@" awk "$1" 2>/dev/null then |
+| $(pwd) local -eu | echo then printf printf -eu | echo /usr/bin
+	-eu x=1 && x=1 "$1" -eu sed done -eu 'quoted text' -eu done -eu /usr/bin
+readonly -eu awk cd 2>/dev/null 'quoted text'
+	/usr/bin grep done awk
+local printf ${HOME} "$@" printf done $(pwd)
+	2>/dev/null -eu readonly -eu local export ${HOME} cd x=1 test export
+		awk | awk && grep printf 'quoted text' readonly echo readonly ${HOME} 2>/dev/null
+2>/dev/null test "$@" readonly echo
+		awk then export local grep x=1 printf readonly export awk "$1" sed cd "$1"
+		"$@" /usr/bin "$@" cd ${HOME} --verbose readonly ${HOME} $(pwd) grep grep 2>/dev/null
+grep "$@" "$@" grep -eu x=1 test done readonly printf
+awk cd sed 2>/dev/null x=1 test
+	'quoted text' x=1 printf --verbose test grep readonly ${HOME} x=1
+"$@" --verbose -eu | ${HOME} printf printf echo
+		"$1" "$1" done ${HOME} local
+		| && readonly readonly -eu x=1 2>/dev/null done awk echo test done "$@"
+		echo "$@" 2>/dev/null export | "$1"
+		"$1" local test readonly printf printf /usr/bin readonly 2>/dev/null awk | --verbose
+"$@" sed cd local local echo printf "$1"
+	${HOME} /usr/bin 2>/dev/null export
+	cd $(pwd) "$@" $(pwd) test
+done 'quoted text' | "$@"
+printf 2>/dev/null "$1" /usr/bin printf echo
+sed | readonly printf x=1 /usr/bin local "$1" printf awk then
+		2>/dev/null readonly echo printf $(pwd) 2>/dev/null "$1" then
+		cd export grep "$@" readonly x=1 printf 2>/dev/null then sed printf 'quoted text'
+		"$1" ${HOME} ${HOME} --verbose --verbose $(pwd) cd grep test && ${HOME}
+		$(pwd) readonly sed export cd done
+	$(pwd) && test 'quoted text' | x=1 /usr/bin grep | then
+		2>/dev/null 2>/dev/null /usr/bin local
+		sed $(pwd) x=1 -eu cd 'quoted text'
+	--verbose 'quoted text' | readonly && -eu export 'quoted text' then cd awk
+		'quoted text' && test /usr/bin ${HOME} 'quoted text' then
+&& sed awk grep --verbose
+		"$@" 'quoted text' && test then $(pwd) grep printf done --verbose
+local then grep echo printf --verbose cd 'quoted text'
+| echo grep $(pwd) /usr/bin echo done sed grep awk 'quoted text' 'quoted text'
+	'quoted text' cd && awk "$1" awk echo $(pwd) local && readonly
+	then "$@" x=1 x=1 'quoted text' "$@" echo 2>/dev/null "$1" local test && awk
+		| | local cd $(pwd) then x=1 test readonly
+2>/dev/null x=1 $(pwd) 2>/dev/null x=1 test sed --verbose awk cd done printf cd
+		cd "$@" 2>/dev/null then export
+then x=1 export done | local /usr/bin "$1" grep
+	awk ${HOME} "$@" /usr/bin /usr/bin awk ${HOME} ${HOME} x=1 x=1 awk "$@" $(pwd)
+	grep --verbose cd echo 'quoted text'
+	done 'quoted text' "$@" $(pwd) x=1 -eu done done ${HOME} awk then echo ${HOME} export
+export | 'quoted text' sed cd && "$1" && sed
+		2>/dev/null printf 'quoted text' $(pwd)
+grep export | /usr/bin "$1" cd /usr/bin awk $(pwd) sed ${HOME} 'quoted text'
+	"$@" ${HOME} readonly cd -eu done awk x=1 then --verbose
+then then x=1 cd --verbose echo test cd | sed /usr/bin x=1 cd awk echo
+export sed 2>/dev/null echo cd sed awk $(pwd) $(pwd) 'quoted text' export sed test
+		'quoted text' --verbose export $(pwd) | "$1"
+local grep export awk test awk done && && test 'quoted text'
+&& 'quoted text' && "$1" --verbose $(pwd) cd export
+-eu --verbose echo done "$@" /usr/bin && -eu local 'quoted text' --verbose awk
+	"$1" -eu readonly 'quoted text' -eu readonly
+export -eu then cd && echo 'quoted text' "$@"
+printf then -eu 2>/dev/null "$1" cd 'quoted text' done /usr/bin local
+		cd local /usr/bin && awk readonly export sed printf 'quoted text'
+--verbose done 2>/dev/null -eu /usr/bin awk echo x=1 grep printf readonly
+grep done "$@" cd ${HOME} 'quoted text' "$1" 'quoted text' sed -eu echo test
+		2>/dev/null "$@" 2>/dev/null ${HOME} printf && echo done awk /usr/bin local done
+	local 2>/dev/null 'quoted text'
+--verbose export cd --verbose sed echo
+	/usr/bin 'quoted text' 'quoted text' && grep
+done awk | -eu printf cd test awk printf test 2>/dev/null echo then
+$(pwd) | cd "$1" readonly local done then ${HOME} && /usr/bin 2>/dev/null
+	printf export "$@" "$@" cd 2>/dev/null -eu ${HOME} export 2>/dev/null awk local
+		2>/dev/null ${HOME} echo /usr/bin -eu "$@"
+	2>/dev/null $(pwd) echo then then then | grep cd sed grep $(pwd)
+export awk -eu then | cd ${HOME} "$@" && ${HOME} awk export printf "$@" then
+readonly --verbose 2>/dev/null printf
+	then ${HOME} sed echo ${HOME} done local "$@" readonly echo /usr/bin awk test
+echo "$1" ${HOME} printf local ${HOME} awk
+${HOME} -eu /usr/bin | -eu "$1" | 2>/dev/null sed
+echo && then printf | local "$@" awk
+then done export awk printf local "$@" local
+	cd 2>/dev/null 2>/dev/null $(pwd) readonly "$@" 'quoted text' printf printf
+	grep /usr/bin readonly then --verbose -eu | --verbose "$1" "$@" then
+then printf done printf --verbose 2>/dev/null then local $(pwd) -eu | printf
+${HOME} "$@" 'quoted text' && "$1" $(pwd) "$@" done ${HOME}
+	printf echo --verbose | 'quoted text' && sed --verbose printf
+		local readonly ${HOME} sed readonly 2>/dev/null $(pwd)
+echo /usr/bin 'quoted text' --verbose
+export && /usr/bin x=1 'quoted text' export
+	cd local awk $(pwd) grep "$1" test --verbose $(pwd) "$1" $(pwd) -eu
+		grep local local readonly -eu cd done "$@" "$1" /usr/bin --verbose
+		then "$1" x=1 cd "$1" done test readonly sed local /usr/bin
+	test done cd x=1 --verbose "$@" /usr/bin export readonly
+		2>/dev/null export x=1 sed export 2>/dev/null
+		awk | "$1" printf then export readonly readonly
+		grep | test "$@" 'quoted text' local
+		cd 'quoted text' sed local export cd -eu "$1" ${HOME} readonly
+2>/dev/null done --verbose done then test && grep | grep
+awk x=1 && printf cd done 2>/dev/null 2>/dev/null
+	x=1 2>/dev/null /usr/bin -eu "$1" printf 'quoted text' "$1" /usr/bin
+		readonly grep /usr/bin export awk then readonly grep cd test cd | grep echo x=1
+	awk 'quoted text' x=1 cd 'quoted text'
+		sed "$1" printf $(pwd) awk --verbose "$1" "$1" --verbose
+	export done awk | test "$1" done test --verbose
+		grep sed test && && readonly awk x=1 "$1" done --verbose
+		2>/dev/null local done then then "$@" ${HOME} test done /usr/bin
+		test | 2>/dev/null then | ${HOME} cd cd grep echo grep
+	-eu grep grep done local sed
+		sed /usr/bin -eu "$@" "$@" sed "$@"
+		readonly echo then printf $(pwd) 2>/dev/null
+"$@" awk ${HOME} ${HOME} local x=1 && && x=1
+	'quoted text' 2>/dev/null printf done && sed -eu sed -eu 'quoted text'
+$(pwd) | test cd x=1 --verbose -eu "$1" export
+-eu cd awk cd $(pwd) sed sed printf
+		${HOME} && ${HOME} && awk
+		--verbose printf "$1" test awk
+		done && /usr/bin done readonly "$1"
+		local && 'quoted text' sed 'quoted text'
+	/usr/bin cd /usr/bin /usr/bin local
+	test "$1" printf test ${HOME}
+		echo | -eu test readonly then x=1 readonly local export "$1" grep test readonly
+sed "$@" test "$1" /usr/bin
+	sed local 2>/dev/null local -eu sed && local
+	readonly sed echo -eu | sed 2>/dev/null
+	$(pwd) done && test readonly 'quoted text' "$@" export awk "$@" then
+&& | 2>/dev/null -eu awk readonly awk local done test
+$(pwd) "$1" awk -eu sed -eu echo 'quoted text' "$@" sed 2>/dev/null readonly
+	cd && test then awk /usr/bin grep printf
+/usr/bin readonly test
+		$(pwd) /usr/bin local test
+	local echo export "$@" local echo readonly && -eu then
+		| -eu done export /usr/bin local $(pwd) cd then sed /usr/bin
+		'quoted text' | 'quoted text'
+	local -eu local 'quoted text' ${HOME} | && done && local -eu | export
+	sed "$@" printf 'quoted text'
+	then 'quoted text' test readonly printf 2>/dev/null cd then --verbose ${HOME}
+		echo awk awk | x=1 x=1 awk | /usr/bin test /usr/bin /usr/bin cd &&
+		&& cd then && export test 'quoted text'
+"$@" /usr/bin ${HOME} --verbose sed 2>/dev/null $(pwd) && grep 2>/dev/null
+	then "$1" 2>/dev/null | /usr/bin -eu $(pwd) /usr/bin
+-eu test | readonly readonly awk 'quoted text'
+		-eu grep "$@" done 2>/dev/null -eu "$@" sed
+local export "$1" local 'quoted text' echo awk sed test --verbose "$@"
+	readonly readonly $(pwd) "$1" $(pwd) grep sed done 2>/dev/null &&
+readonly 'quoted text' awk grep grep echo sed "$@" test readonly
+	sed sed /usr/bin ${HOME} "$@" ${HOME} 'quoted text' 'quoted text'
+--verbose then export echo
+	grep 'quoted text' done export | 2>/dev/null echo | cd test $(pwd)
+	local --verbose echo --verbose | printf awk grep $(pwd) test /usr/bin local
+	--verbose ${HOME} "$1" grep printf grep && --verbose
+	then --verbose | sed awk awk /usr/bin export --verbose /usr/bin local && printf
+		"$@" "$1" done $(pwd) export "$@"
+		| --verbose $(pwd) -eu local awk "$1" /usr/bin local then
+	done && -eu readonly | grep then echo then -eu && awk printf
+	grep $(pwd) printf | grep && printf | sed -eu "$1" "$1" cd /usr/bin
+grep export $(pwd) test echo $(pwd) cd export 'quoted text' 'quoted text'
+local test awk grep | awk 2>/dev/null "$1" cd --verbose --verbose grep done
+	$(pwd) $(pwd) "$@" 'quoted text' "$1" printf /usr/bin
+	export then "$@" "$1" done awk --verbose local
+		&& printf sed printf test done
+sed | ${HOME} && local ${HOME}
+	--verbose x=1 export local local -eu done
+		2>/dev/null "$1" sed readonly awk grep printf
+		then awk ${HOME} cd local awk "$@" /usr/bin 2>/dev/null sed | && ${HOME} grep
+	grep printf "$1" --verbose "$1" printf --verbose /usr/bin $(pwd) cd &&
+		awk local sed done then && readonly | "$@" $(pwd) test ${HOME}
+		echo test 2>/dev/null && 'quoted text'
+		-eu done /usr/bin test readonly --verbose awk cd grep
+		/usr/bin ${HOME} -eu ${HOME} echo | 2>/dev/null echo local printf export
+	readonly -eu && 2>/dev/null &&
+	printf 2>/dev/null ${HOME} then then awk printf ${HOME} test readonly readonly
+	grep then /usr/bin 'quoted text' && "$@" -eu printf -eu then printf
+	"$1" $(pwd) "$1" printf grep ${HOME} awk sed 2>/dev/null "$@" echo awk $(pwd)
+local 2>/dev/null export --verbose cd local ${HOME} x=1 done --verbose x=1
+2>/dev/null sed -eu cd echo printf x=1 echo echo 'quoted text'
+	done ${HOME} 2>/dev/null grep
+		'quoted text' 2>/dev/null /usr/bin
+		done then printf ${HOME} "$@" test local 2>/dev/null test cd local echo
+		2>/dev/null $(pwd) /usr/bin "$1" then | ${HOME}
+	grep printf /usr/bin x=1 export
+done sed awk readonly "$1" "$1" "$1" "$1" | -eu printf readonly export
+${HOME} 2>/dev/null grep | -eu
+cd grep test done grep 'quoted text' done printf test x=1 done sed awk $(pwd) /usr/bin
+		local && 2>/dev/null 2>/dev/null
+	x=1 | ${HOME} 2>/dev/null 'quoted text'
+		sed $(pwd) /usr/bin grep --verbose | echo printf /usr/bin readonly
+/usr/bin export cd && "$@" x=1 "$@" 'quoted text' echo 2>/dev/null then /usr/bin
+		readonly printf printf -eu "$1" local then
+		--verbose -eu export "$1" --verbose
+		then local printf 'quoted text' 'quoted text' local readonly
+	"$1" | "$@" x=1 grep "$@"
+&& test -eu 2>/dev/null --verbose done
+	grep ${HOME} "$1" | && $(pwd)
+		2>/dev/null $(pwd) cd sed x=1 ${HOME} ${HOME} grep && 'quoted text' test then readonly
+		"$@" x=1 "$1" --verbose echo done ${HOME} printf 'quoted text' echo
+	grep "$@" "$@" $(pwd) -eu ${HOME} x=1 ${HOME}
+grep cd echo export done done local grep "$@"
+		then --verbose local "$1" $(pwd)
+	$(pwd) grep local then -eu echo grep local
+	awk | cd test local "$@" then
+local cd "$1" export readonly | "$1" grep |
+		awk -eu "$1" done then test test sed && printf 2>/dev/null readonly "$@"
+local readonly 'quoted text'
+${HOME} local $(pwd) grep awk test test sed 2>/dev/null then
+	then ${HOME} | 'quoted text' && readonly cd && echo cd done cd $(pwd)
+	"$@" /usr/bin done awk cd | export && grep -eu ${HOME} cd ${HOME} ${HOME}
+		grep "$1" 2>/dev/null --verbose test grep | /usr/bin test
+		then ${HOME} cd ${HOME} test local 'quoted text' "$@" echo $(pwd) readonly
+		export done 'quoted text' sed $(pwd) "$@" --verbose sed readonly
+	echo /usr/bin sed test | awk test sed test readonly
+		printf $(pwd) /usr/bin && ${HOME} grep "$@" local
+${HOME} x=1 echo "$1" --verbose then grep sed
+&& printf "$@" "$@" cd cd done 2>/dev/null "$1" echo ${HOME}
+		echo cd && "$@" --verbose done echo $(pwd) export x=1 grep /usr/bin |
+/usr/bin "$@" --verbose "$1" awk "$@" test echo -eu sed 'quoted text' --verbose
+		readonly 'quoted text' 'quoted text' 'quoted text'
+| && cd sed x=1 --verbose then --verbose awk cd
+'quoted text' printf 2>/dev/null test
+		readonly local echo "$1" x=1 cd $(pwd) awk readonly --verbose $(pwd) /usr/bin done
+local "$@" x=1 echo 2>/dev/null
+	echo /usr/bin | then readonly && x=1 cd "$1"
+		-eu /usr/bin -eu done 'quoted text' echo sed test 2>/dev/null
+		local && readonly -eu 'quoted text'
+		$(pwd) $(pwd) echo "$1" readonly "$@" sed cd 2>/dev/null
+	readonly --verbose local done sed echo ${HOME} $(pwd) -eu done local "$1" 2>/dev/null
+		'quoted text' 'quoted text'
+		"$@" test done -eu sed awk --verbose && echo "$@" x=1 --verbose readonly
+	awk --verbose ${HOME} grep export echo 'quoted text' --verbose
+	sed 2>/dev/null | 'quoted text' && printf
+'quoted text' -eu 2>/dev/null --verbose
+		x=1 done cd sed printf echo "$1" awk local export /usr/bin readonly printf && done
+		readonly done x=1 printf && -eu -eu cd 'quoted text'
+/usr/bin sed 2>/dev/null x=1 x=1 | cd x=1 /usr/bin local "$@" done
+	$(pwd) ${HOME} grep | ${HOME} cd grep /usr/bin done done "$@" cd && local 2>/dev/null
+		cd test && grep test cd 2>/dev/null awk 2>/dev/null
+sed --verbose test && ${HOME} local local 2>/dev/null
+	--verbose then test 2>/dev/null ${HOME} -eu 2>/dev/null
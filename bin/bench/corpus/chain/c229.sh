@@ -0,0 +1,2001 @@
+x=1 ${HOME} awk done awk -eu done then -eu x=1 "$@" 2>/dev/null x=1
+	readonly printf printf 'quoted text' awk -eu printf
+		| awk then echo 'quoted text' test then awk x=1 $(pwd) /usr/bin test export
+		export readonly cd printf grep /usr/bin
+sed cd && --verbose readonly && printf 2>/dev/null local
+	$(pwd) $(pwd) done done 'quoted text' x=1 echo awk --verbose
+	local grep && grep printf ${HOME}
+	/usr/bin export x=1 test $(pwd) --verbose && /usr/bin grep export
+	awk sed then /usr/bin cd done $(pwd) printf then cd readonly
+		--verbose readonly "$1" test | "$@" awk readonly then ${HOME} x=1
+		&& printf -eu "$@" printf done | 2>/dev/null "$@" local echo x=1
+	&& ${HOME} local ${HOME} /usr/bin x=1 cd x=1 readonly cd
+| printf 'quoted text' awk local cd cd ${HOME} done 2>/dev/null --verbose |
+readonly "$@" test export cd ${HOME}
+	awk x=1 /usr/bin "$1" readonly x=1 grep && ${HOME} local printf
+	export "$1" ${HOME} test printf then done x=1 awk |
+readonly --verbose "$1" printf && echo && done awk "$@" 'quoted text' grep
+grep 'quoted text' 2>/dev/null ${HOME} x=1 x=1 $(pwd) echo local
+$(pwd) readonly then | | grep
+		2>/dev/null $(pwd) grep 'quoted text' $(pwd) "$@" printf "$1"
+	$(pwd) export awk 2>/dev/null done test readonly x=1 | /usr/bin "$@" && $(pwd)
+&& "$@" test export /usr/bin ${HOME}
+		'quoted text' readonly test then -eu cd ${HOME}
+	printf --verbose -eu done ${HOME} 'quoted text' then ${HOME}
+	export grep readonly --verbose /usr/bin export && 2>/dev/null "$1" sed local 2>/dev/null
+	"$@" printf | 2>/dev/null | cd sed grep "$1" 'quoted text' test test grep
+test && "$1" && local export
+	"$@" cd "$@" sed | printf ${HOME}
+	&& --verbose --verbose 'quoted text'
+	grep grep readonly 'quoted text' "$1" /usr/bin
+		&& cd && export $(pwd) cd && echo echo awk printf && "$1" export 2>/dev/null
+printf 2>/dev/null test /usr/bin $(pwd) local --verbose
+test sed readonly readonly done printf --verbose
+"$1" --verbose awk ${HOME} printf printf done -eu echo then --verbose "$@"
+	| grep && 2>/dev/null awk local --verbose
+export then 'quoted text'
+test | awk readonly echo $(pwd) export test cd "$1"
+		awk "$@" -eu | grep printf cd "$1" sed grep 2>/dev/null sed -eu && -eu
+		"$@" ${HOME} && --verbose -eu cd /usr/bin $(pwd) 'quoted text'
+	x=1 grep done then awk
+	${HOME} export $(pwd) then -eu --verbose
+cd then "$@" "$1" --verbose -eu 2>/dev/null 'quoted text'
+	-eu 'quoted text' grep x=1 -eu printf awk readonly
+		echo grep grep cd $(pwd)
+	echo ${HOME} 'quoted text'
+	| 2>/dev/null cd 'quoted text' && -eu then then x=1 'quoted text'
+	&& "$@" export | | export x=1 echo sed --verbose printf
+	sed export cd $(pwd) test x=1 grep
+	--verbose 'quoted text'
+--verbose echo 'quoted text' cd cd && $(pwd) readonly
+	-eu grep test x=1 printf local && /usr/bin awk readonly ${HOME}
+	| x=1 printf "$1" export "$1" 'quoted text' --verbose x=1 | awk ${HOME}
+${HOME} -eu 2>/dev/null -eu local sed printf $(pwd) then
+'quoted text' ${HOME} --verbose /usr/bin x=1 echo done local echo test awk
+	grep x=1 sed | && local 2>/dev/null 'quoted text' --verbose --verbose local
+test export done "$@" awk /usr/bin
+		printf $(pwd) x=1 'quoted text'
+		local -eu --verbose then 'quoted text' done
+	done export -eu sed ${HOME} done
+cd printf readonly echo $(pwd) /usr/bin && cd ${HOME} sed awk
+		--verbose /usr/bin printf awk && then -eu 'quoted text'
+		"$@" 2>/dev/null grep ${HOME} local test
+		$(pwd) done sed grep grep | && "$1" --verbose
+"$1" local readonly sed "$@" cd echo
+| export ${HOME} | cd local
+		readonly "$1" -eu /usr/bin sed x=1 "$@" --verbose -eu $(pwd) then 2>/dev/null
+		then echo ${HOME} echo sed $(pwd) && test done then done ${HOME} 'quoted text'
+cd echo "$@" /usr/bin && 2>/dev/null && cd "$1" export --verbose then sed
+grep printf test x=1 /usr/bin "$@" grep sed sed x=1
+		"$1" $(pwd) "$1" "$1" readonly | "$@" export export 2>/dev/null
+		printf then -eu ${HOME} then sed /usr/bin /usr/bin "$@"
+${HOME} "$@" printf 2>/dev/null 'quoted text' cd "$1" readonly "$1" $(pwd) |
+	grep grep && local sed readonly $(pwd) 2>/dev/null
+"$1" --verbose local readonly "$1" awk
+		awk done done ${HOME} ${HOME}
+	export ${HOME} --verbose | test cd
+	$(pwd) 'quoted text' x=1 readonly && 'quoted text' "$@"
+	grep "$1" ${HOME} printf export grep cd local then /usr/bin $(pwd)
+		$(pwd) printf printf cd
+	"$1" 2>/dev/null ${HOME} x=1 then done | -eu --verbose
+		--verbose 'quoted text' "$@" echo /usr/bin | awk 2>/dev/null then
+sed ${HOME} x=1 then | grep cd printf x=1 sed --verbose sed "$1"
+		2>/dev/null && echo awk -eu ${HOME} x=1 test
+		test --verbose awk | "$1" readonly /usr/bin ${HOME}
+&& --verbose --verbose "$@" -eu readonly
+awk 2>/dev/null export ${HOME} --verbose readonly -eu
+		"$@" done cd $(pwd) printf /usr/bin cd /usr/bin awk 'quoted text' done 'quoted text'
+	readonly | grep ${HOME} | -eu -eu
+	awk grep readonly readonly sed $(pwd) "$@" && /usr/bin cd sed ${HOME}
+| readonly -eu 2>/dev/null "$1" test -eu echo && cd "$@" "$1" -eu --verbose
+	$(pwd) then cd "$@" grep
+		"$1" sed then printf 2>/dev/null x=1 then | grep
+		then then | $(pwd) "$1" printf awk printf 'quoted text' -eu --verbose -eu
+		2>/dev/null 2>/dev/null | local local sed sed && $(pwd) test echo grep echo
+| local local printf /usr/bin grep "$1" printf echo
+		done export done cd -eu 'quoted text' cd awk x=1 done printf
+"$1" -eu awk export --verbose -eu x=1 export /usr/bin echo cd
+x=1 "$1" x=1 "$@" "$@" 'quoted text'
+		x=1 --verbose /usr/bin && export cd
+		"$1" cd 2>/dev/null -eu local && --verbose -eu then | "$@" "$@"
+printf grep $(pwd) then --verbose
+		x=1 'quoted text' 'quoted text' export done echo export echo 2>/dev/null
+${HOME} x=1 2>/dev/null export then
+		export printf then test --verbose echo
+${HOME} cd /usr/bin cd cd
+	x=1 && cd -eu 'quoted text' grep -eu &&
+$(pwd) cd done "$@" local readonly then grep -eu
+		| "$@" $(pwd) done 'quoted text' 2>/dev/null test $(pwd) "$1" &&
+	/usr/bin readonly then readonly
+cd --verbose /usr/bin local
+		/usr/bin echo echo cd $(pwd) 'quoted text' "$1" ${HOME} printf 2>/dev/null
+	2>/dev/null then local --verbose cd ${HOME} export awk echo &&
+		sed readonly $(pwd) $(pwd) echo test local
+cd "$1" awk local ${HOME}
+echo test readonly x=1 | -eu -eu local 2>/dev/null $(pwd) printf echo local $(pwd)
+	&& then | x=1 $(pwd) cd /usr/bin then printf --verbose 'quoted text'
+		then sed --verbose export ${HOME} awk -eu 'quoted text' printf
+		grep local $(pwd) echo readonly
+	$(pwd) "$1" sed 'quoted text'
+	${HOME} readonly export 2>/dev/null echo
+awk "$@" readonly 2>/dev/null
+	local local /usr/bin --verbose cd /usr/bin --verbose test /usr/bin --verbose
+	grep --verbose export grep | sed "$1" test readonly
+	/usr/bin printf readonly then grep local export "$@" $(pwd)
+awk 'quoted text' "$1" then readonly x=1 $(pwd) then ${HOME} grep | 'quoted text'
+	export then export 'quoted text'
+	readonly /usr/bin $(pwd) echo done $(pwd)
+	-eu | sed cd 'quoted text' test echo --verbose "$@" echo awk -eu
+		$(pwd) sed "$1" 'quoted text'
+	echo done 'quoted text' readonly sed then | /usr/bin
+	done && then | printf readonly echo test -eu
+		awk ${HOME} done local grep cd 2>/dev/null
+	"$@" export readonly test x=1
+$(pwd) --verbose printf 2>/dev/null grep | local 'quoted text'
+		2>/dev/null /usr/bin ${HOME} echo awk 'quoted text'
+2>/dev/null && export then x=1 test echo x=1 sed $(pwd) echo
+		readonly | 'quoted text' then /usr/bin done
+/usr/bin awk printf export 'quoted text' $(pwd) export 2>/dev/null cd 'quoted text'
+	x=1 && export grep grep $(pwd) --verbose "$@" echo
+		done --verbose awk --verbose then then cd -eu local && 'quoted text' echo 'quoted text'
+test awk && 'quoted text' grep cd "$1" $(pwd) | test
+	-eu "$1" "$1" readonly | export 2>/dev/null x=1 printf
+		| awk local 'quoted text' /usr/bin "$@" readonly -eu then
+		echo --verbose echo /usr/bin echo local export 2>/dev/null printf ${HOME}
+done awk ${HOME} test grep awk ${HOME} sed readonly export
+		-eu sed grep cd -eu export
+	sed 2>/dev/null $(pwd)
+| 2>/dev/null "$1" grep 2>/dev/null 2>/dev/null cd done 2>/dev/null 'quoted text'
+		printf 'quoted text' printf export | export x=1 "$1" echo grep -eu ${HOME} && sed
+	readonly printf "$1" grep "$@" then grep x=1 done local grep
+		/usr/bin sed "$1" x=1
+		done | --verbose $(pwd) 2>/dev/null
+test awk done grep echo grep ${HOME} export -eu --verbose
+		-eu echo "$@" && "$@" /usr/bin "$1"
+	${HOME} cd /usr/bin 2>/dev/null
+	2>/dev/null readonly export $(pwd) export 'quoted text'
+	/usr/bin $(pwd) printf printf readonly
+		x=1 $(pwd) && export "$@" export ${HOME} printf "$1" then ${HOME}
+readonly done echo sed export local /usr/bin x=1 /usr/bin
+"$@" echo /usr/bin x=1
+		printf --verbose x=1 2>/dev/null cd printf /usr/bin awk |
+	2>/dev/null 'quoted text' export "$@" sed awk --verbose && $(pwd) -eu x=1
+${HOME} 2>/dev/null ${HOME} $(pwd) printf
+		-eu x=1 && local "$1" echo
+		&& local 'quoted text' readonly sed -eu /usr/bin sed 2>/dev/null
+	| --verbose cd /usr/bin --verbose x=1 local export --verbose cd x=1 local
+	&& grep ${HOME} && printf then awk readonly /usr/bin $(pwd) | awk
+test ${HOME} awk | --verbose 'quoted text' x=1 'quoted text' ${HOME} $(pwd)
+	--verbose | awk done printf && "$1"
+		done export cd && test export sed 2>/dev/null "$@" | done "$1"
+		awk awk "$@" printf readonly x=1 && echo done && readonly printf
+"$@" "$1" awk awk echo
+		export --verbose then readonly done /usr/bin export echo 2>/dev/null
+		grep "$1" export awk readonly local grep 'quoted text'
+	--verbose export done -eu printf $(pwd)
+		| done readonly | cd export cd 2>/dev/null
+	--verbose local cd readonly "$1" done --verbose --verbose
+test test 2>/dev/null ${HOME} ${HOME} $(pwd) test
+	${HOME} done printf -eu export && test readonly local -eu then
+	'quoted text' /usr/bin $(pwd) "$@" awk readonly
+	--verbose readonly test "$@" "$1" printf 'quoted text'
+	$(pwd) 2>/dev/null "$1" grep -eu grep done 'quoted text' sed $(pwd) sed $(pwd)
+	export $(pwd) x=1 grep awk "$1" ${HOME} 'quoted text'
+	${HOME} | local /usr/bin printf then /usr/bin /usr/bin 2>/dev/null --verbose
+-eu /usr/bin "$1" readonly local printf cd echo
+	x=1 | printf && /usr/bin grep then $(pwd) echo cd local /usr/bin then | $(pwd)
+	then --verbose echo /usr/bin -eu "$1" sed --verbose -eu 'quoted text'
+		readonly local printf | printf ${HOME} printf awk echo --verbose export cd local
+	grep --verbose | grep 2>/dev/null "$1" printf test $(pwd) | "$@" ${HOME} -eu
+		x=1 grep --verbose done | && -eu readonly readonly grep ${HOME}
+grep /usr/bin x=1 awk /usr/bin test readonly --verbose ${HOME} export readonly
+	'quoted text' local | x=1 $(pwd) "$@"
+		export "$@" && awk test "$1" then $(pwd)
+awk "$@" cd echo sed | local printf -eu done $(pwd)
+		export 'quoted text' 2>/dev/null -eu ${HOME} printf
+	x=1 cd && 'quoted text' x=1 printf grep cd local awk
+		"$@" --verbose $(pwd) ${HOME} /usr/bin x=1 x=1 -eu 'quoted text'
+	--verbose --verbose sed --verbose local local "$@" done
+local $(pwd) export && $(pwd) | 2>/dev/null $(pwd) 2>/dev/null 2>/dev/null
+	echo x=1 'quoted text'
+		x=1 sed cd "$@" $(pwd) readonly
+&& | --verbose cd 'quoted text' printf --verbose awk ${HOME}
+&& -eu cd then 'quoted text' /usr/bin export echo 'quoted text' $(pwd)
+	x=1 cd $(pwd) cd sed printf 'quoted text' ${HOME} --verbose
+	export printf echo grep --verbose echo ${HOME} then sed awk test "$@" then
+	sed export sed --verbose
+		readonly | test -eu printf $(pwd)
+	/usr/bin echo | --verbose awk "$1" test --verbose export /usr/bin awk
+--verbose "$@" printf "$@" | cd done
+then | echo awk cd readonly local
+		"$@" sed export ${HOME} done awk then ${HOME}
+		&& -eu $(pwd) grep /usr/bin
+		'quoted text' ${HOME} grep ${HOME} echo export sed 2>/dev/null
+	2>/dev/null done 'quoted text' && then done sed $(pwd) | /usr/bin
+	then awk readonly 'quoted text' x=1 'quoted text'
+		readonly && 2>/dev/null cd grep echo printf echo /usr/bin export ${HOME}
+		&& echo echo done sed printf printf grep x=1 echo 'quoted text' 2>/dev/null
+	$(pwd) awk test ${HOME} x=1 'quoted text' -eu 'quoted text'
+echo 'quoted text' readonly readonly printf
+		test 2>/dev/null 2>/dev/null
+export 2>/dev/null echo then printf grep
+printf sed awk grep printf --verbose
+--verbose "$1" test 2>/dev/null
+		2>/dev/null printf | "$@" local --verbose local then $(pwd) $(pwd) done
+		--verbose readonly local --verbose 'quoted text'
+	"$1" $(pwd) echo --verbose -eu -eu cd done local awk /usr/bin echo "$1" 2>/dev/null
+	grep 2>/dev/null grep /usr/bin echo
+		echo 'quoted text' && then
+		x=1 "$1" "$@" --verbose then && "$@" "$@" /usr/bin | cd 2>/dev/null
+	test export done /usr/bin local $(pwd) -eu 'quoted text' x=1 awk
+		'quoted text' --verbose && then cd echo --verbose
+		'quoted text' 'quoted text' /usr/bin
+	readonly cd grep 'quoted text' ${HOME} grep ${HOME}
+2>/dev/null done --verbose cd grep $(pwd) -eu 2>/dev/null /usr/bin
+	"$1" "$@" cd done sed && 'quoted text' then awk 'quoted text' | local cd local
+awk printf && ${HOME} export sed local
+test | "$@" export "$1" 2>/dev/null |
+		--verbose && | sed export x=1 echo --verbose
+test -eu local /usr/bin echo && awk "$@" grep done --verbose --verbose
+	'quoted text' --verbose $(pwd) "$1" sed echo printf grep test "$@" awk --verbose
+	printf "$1" /usr/bin awk printf
+		'quoted text' grep test 'quoted text' sed x=1 echo -eu x=1 grep
+	grep local -eu /usr/bin ${HOME} --verbose local 'quoted text' readonly -eu --verbose
+then printf export | awk printf local $(pwd) local ${HOME} && readonly
+/usr/bin x=1 sed then then && /usr/bin 'quoted text' grep grep ${HOME}
+	test awk 'quoted text' cd x=1 -eu local "$1" $(pwd) x=1 --verbose
+		awk test then /usr/bin test cd --verbose
+		printf | readonly $(pwd) "$@" local
+done $(pwd) test test --verbose awk echo 'quoted text' awk "$1" -eu 'quoted text'
+	$(pwd) export && export local -eu readonly "$@"
+		echo cd then -eu | "$@" -eu && sed
+x=1 ${HOME} | printf -eu
+grep grep x=1 -eu "$1" /usr/bin grep ${HOME} 'quoted text' echo echo 2>/dev/null
+$(pwd) sed export echo "$@" 2>/dev/null x=1 --verbose 'quoted text'
+	then | x=1 'quoted text' done
+then && "$@" sed --verbose |
+		-eu "$@" then 2>/dev/null cd sed cd grep export sed 2>/dev/null
+	${HOME} "$@" echo cd local x=1 | then | |
+	printf /usr/bin test | then $(pwd) done
+	printf "$@" 2>/dev/null | 'quoted text' sed && cd ${HOME} done then --verbose
+	printf "$1" --verbose echo $(pwd) ${HOME} && sed echo sed local local local |
+	cd && $(pwd) sed cd ${HOME} "$@" 'quoted text' $(pwd)
+	export --verbose export x=1 && ${HOME} export "$@" cd 2>/dev/null export
+&& grep cd test -eu /usr/bin test
+'quoted text' local $(pwd) grep --verbose then local
+	then "$@" --verbose printf | cd "$@" cd
+	sed | printf && done sed sed readonly ${HOME} local sed sed "$1" 'quoted text'
+		$(pwd) done "$1" local $(pwd) | 2>/dev/null /usr/bin && "$@" then
+	done $(pwd) done local echo 2>/dev/null echo | --verbose export
+	awk | /usr/bin test ${HOME} readonly
+	$(pwd) then -eu "$1" sed sed /usr/bin --verbose /usr/bin sed export done test
+		printf | | grep grep "$1" 2>/dev/null
+	test --verbose sed --verbose "$1" sed $(pwd) printf
+done grep | cd printf done done /usr/bin x=1 "$@" local x=1 $(pwd)
+		awk ${HOME} -eu $(pwd) 'quoted text' 'quoted text' awk local --verbose test
+| 'quoted text' local echo "$1" --verbose done
+sed printf echo awk ${HOME} $(pwd)
+/usr/bin x=1 sed then
+cd "$1" $(pwd) test cd done printf /usr/bin awk && test /usr/bin /usr/bin
+	| /usr/bin then printf cd echo cd test printf test ${HOME}
+export ${HOME} awk ${HOME} sed then
+	2>/dev/null local done cd $(pwd) awk sed | ${HOME} awk ${HOME}
+	local grep test && grep readonly /usr/bin cd echo /usr/bin 2>/dev/null
+	--verbose "$1" grep $(pwd) -eu local local "$1" -eu cd export then
+		export grep awk done export /usr/bin done
+		'quoted text' cd done ${HOME} -eu 2>/dev/null done cd
+	awk printf /usr/bin ${HOME} awk -eu sed
+/usr/bin && grep -eu 2>/dev/null
+printf "$@" then ${HOME} "$@" cd sed done then --verbose
+readonly && test then then "$@" "$1" printf cd -eu ${HOME} 2>/dev/null
+		cd test awk sed /usr/bin
+$(pwd) 2>/dev/null printf done && echo sed sed test "$1" | local readonly cd
+x=1 ${HOME} ${HOME} awk echo 2>/dev/null readonly 'quoted text'
+		grep | /usr/bin -eu echo
+		readonly ${HOME} 'quoted text' sed 'quoted text'
+		done sed --verbose then cd "$1" readonly "$1" test ${HOME}
+		"$@" test -eu done grep export then export "$@"
+	x=1 && -eu $(pwd) export export "$1" test done "$1" done x=1 then $(pwd) sed
+"$1" test test --verbose | cd sed awk readonly $(pwd)
+x=1 done grep --verbose 'quoted text' sed /usr/bin test cd echo grep test done grep
+grep $(pwd) readonly && test printf readonly cd "$1"
+"$@" test readonly cd local $(pwd) "$@"
+		2>/dev/null then 'quoted text' "$1"
+	$(pwd) && printf && export cd x=1 && /usr/bin "$@"
+	"$1" test | printf && 2>/dev/null then printf | "$@" && then awk then ${HOME}
+		grep "$1" sed x=1 "$@" done awk readonly test cd printf "$1" echo
+	test then /usr/bin -eu ${HOME} && test echo then
+| test grep grep awk 'quoted text' 2>/dev/null sed ${HOME} printf local $(pwd)
+	&& echo /usr/bin grep | 2>/dev/null local test sed printf printf
+${HOME} /usr/bin "$@" awk 2>/dev/null --verbose && /usr/bin sed
+"$@" $(pwd) sed "$@" readonly printf cd | $(pwd)
+&& "$1" --verbose /usr/bin | --verbose echo 2>/dev/null
+local test x=1 awk "$1" export $(pwd) export ${HOME} /usr/bin export
+		"$@" echo local cd /usr/bin "$@" "$1" "$1" local
+	cd && test done cd then awk --verbose grep -eu
+		sed 'quoted text' done then x=1 &&
+		'quoted text' test local done local test
+		x=1 sed printf /usr/bin 2>/dev/null
+	test printf echo | /usr/bin | cd printf done export then --verbose
+	local readonly $(pwd) | 'quoted text' printf grep x=1 done done
+	done --verbose awk "$1" echo -eu 'quoted text' local cd && --verbose
+	printf export export "$1" awk awk | test /usr/bin "$@" ${HOME} | --verbose
+then export echo /usr/bin test ${HOME}
+"$@" done awk readonly "$@" ${HOME} test --verbose ${HOME} sed
+"$1" echo --verbose printf ${HOME} sed --verbose local | echo x=1 then grep ${HOME}
+		local readonly readonly done grep cd done 2>/dev/null local x=1 --verbose
+	cd done grep 2>/dev/null sed then x=1 "$1" 2>/dev/null grep /usr/bin grep awk "$@"
+		done "$@" printf sed 2>/dev/null ${HOME} --verbose
+	echo grep -eu /usr/bin 2>/dev/null printf
+		-eu printf "$@" && /usr/bin /usr/bin -eu readonly --verbose 2>/dev/null
+/usr/bin --verbose export && echo
+--verbose && 2>/dev/null | grep cd printf test && local /usr/bin
+cd 'quoted text' done cd test then
+		--verbose "$1" -eu readonly x=1 x=1 2>/dev/null ${HOME} 'quoted text' sed grep
+${HOME} --verbose | ${HOME} "$@" echo -eu && printf 'quoted text' $(pwd)
+sed 'quoted text' grep grep local "$1" printf sed done --verbose
+	/usr/bin --verbose export
+2>/dev/null 2>/dev/null
+		local "$@" x=1 x=1 done && printf grep local local test x=1 awk
+&& x=1 cd | --verbose -eu printf grep test "$1" local /usr/bin "$1" readonly
+"$@" /usr/bin /usr/bin then awk
+done done ${HOME} | readonly readonly sed local cd
+		local sed && x=1 && local awk test then x=1 && readonly ${HOME}
+		$(pwd) $(pwd) cd local 2>/dev/null $(pwd) then
+readonly "$1" 'quoted text'
+--verbose then -eu grep | awk $(pwd) then
+printf "$@" export readonly then
+		then awk sed echo sed sed echo local then cd then readonly local /usr/bin printf
+"$@" readonly grep /usr/bin -eu --verbose
+	--verbose awk test -eu then -eu 'quoted text' then --verbose
+		$(pwd) "$1" && x=1 echo x=1 local
+2>/dev/null grep ${HOME} sed ${HOME}
+		export local then /usr/bin /usr/bin x=1 'quoted text' --verbose -eu grep -eu "$1"
+readonly grep && readonly echo awk x=1 sed $(pwd) awk ${HOME} 2>/dev/null 'quoted text'
+		awk then echo "$@" --verbose x=1 grep local 'quoted text' | 'quoted text' "$1" then
+		grep cd test cd -eu 2>/dev/null $(pwd) 'quoted text'
+cd /usr/bin $(pwd) grep x=1 --verbose -eu 'quoted text'
+		'quoted text' awk -eu printf 2>/dev/null
+"$1" sed && $(pwd) test --verbose grep
+	local /usr/bin $(pwd) && 2>/dev/null cd 'quoted text' sed $(pwd) 'quoted text'
+	echo grep export local cd x=1 ${HOME} printf /usr/bin awk 2>/dev/null
+-eu 2>/dev/null sed $(pwd) 'quoted text'
+	sed grep | test echo test done printf then | export
+		echo $(pwd) export sed $(pwd) "$1" printf readonly readonly
+-eu test x=1 echo readonly sed ${HOME} x=1 awk done echo awk test done -eu
+		test x=1 && grep export --verbose && grep && x=1 | cd 2>/dev/null
+$(pwd) printf export echo test 2>/dev/null sed test 'quoted text'
+	/usr/bin "$@" -eu export "$1" printf export
+export /usr/bin $(pwd) | done /usr/bin sed
+	cd "$@" awk echo "$1" done "$1" "$1"
+	then && 2>/dev/null printf awk | test $(pwd) readonly sed && printf "$1" grep
+	2>/dev/null awk /usr/bin sed awk $(pwd) export "$@" echo x=1 awk printf readonly
+"$1" done 'quoted text' -eu readonly "$1" awk | local
+/usr/bin -eu 2>/dev/null grep export "$1"
+echo 2>/dev/null /usr/bin && | && done "$@" /usr/bin 2>/dev/null "$1"
+	local awk grep --verbose then | grep "$@" awk $(pwd) test echo readonly
+2>/dev/null export 'quoted text' printf sed test x=1 grep
+		/usr/bin sed x=1 'quoted text' 'quoted text'
+	--verbose local -eu export local printf grep export then 'quoted text' awk
+	"$1" then awk ${HOME} /usr/bin ${HOME} ${HOME} test "$@" sed
+done test then --verbose 2>/dev/null $(pwd) 'quoted text' $(pwd) then sed 'quoted text'
+		&& -eu awk "$@" done cd awk local
+	done -eu 'quoted text' local cd test
+	sed "$@" awk | done -eu sed readonly cd
+readonly -eu --verbose test | "$@" cd awk
+	2>/dev/null ${HOME} then sed done sed | /usr/bin "$@" | && local local
+	awk 'quoted text' 'quoted text' --verbose "$@" cd "$1" ${HOME}
+$(pwd) $(pwd) done cd then /usr/bin
+		sed grep sed --verbose "$1" printf $(pwd)
+x=1 2>/dev/null 'quoted text' 2>/dev/null awk | x=1 | $(pwd) awk
+		then readonly awk then grep "$1" 'quoted text' 'quoted text' grep x=1
+	awk 2>/dev/null --verbose | "$@" then $(pwd) echo
+		${HOME} test ${HOME} grep grep $(pwd) test export local done
+	${HOME} grep done done --verbose grep --verbose done 2>/dev/null
+		'quoted text' awk local
+readonly then -eu "$1" test done readonly
+		"$@" sed 2>/dev/null awk printf && -eu grep readonly -eu awk then "$@" awk
+awk "$@" echo "$@" cd then /usr/bin 'quoted text' 2>/dev/null | cd x=1
+		"$1" -eu --verbose awk
+	x=1 sed 'quoted text' && -eu 2>/dev/null 2>/dev/null x=1 ${HOME} test test
+	awk local && -eu -eu printf 'quoted text' /usr/bin done 'quoted text'
+	test cd /usr/bin /usr/bin 'quoted text'
+	2>/dev/null local readonly test sed test grep grep grep export awk readonly ${HOME}
+/usr/bin x=1 sed $(pwd) awk --verbose grep then done grep "$1" readonly
+x=1 awk -eu 'quoted text' export "$@" 2>/dev/null
+		export readonly "$@" cd echo awk grep $(pwd) && test 'quoted text' readonly
+| x=1 done sed | export && grep | /usr/bin
+	readonly local then $(pwd) "$@" 2>/dev/null
+		printf then export printf && then -eu 'quoted text' readonly export test awk
+--verbose done then sed awk sed | "$1" -eu then && /usr/bin then
+	"$1" echo printf -eu test
+'quoted text' readonly
+$(pwd) ${HOME} local awk echo sed 2>/dev/null then awk
+local grep ${HOME} x=1 /usr/bin export awk
+		echo cd "$1" 'quoted text' /usr/bin
+		$(pwd) $(pwd) awk ${HOME} --verbose
+	--verbose 2>/dev/null grep --verbose
+echo x=1 "$1" local done
+'quoted text' sed cd "$@" /usr/bin cd sed -eu "$1" done "$@" $(pwd)
+readonly --verbose --verbose echo ${HOME} grep "$1" then "$1" |
+		grep grep test cd && x=1 && 'quoted text' $(pwd) done && -eu readonly | grep
+	done x=1 && && local awk grep export test 2>/dev/null readonly "$@" test done x=1
+"$1" printf echo "$@" readonly -eu $(pwd) x=1 $(pwd) export
+done readonly then "$1" readonly export --verbose test sed export
+		/usr/bin ${HOME} sed readonly readonly test ${HOME} "$1"
+"$@" "$1" "$@" grep -eu then 'quoted text' readonly /usr/bin ${HOME}
+		x=1 'quoted text' -eu
+	'quoted text' | export
+	"$1" test "$1" && "$@" 2>/dev/null /usr/bin
+		printf ${HOME} $(pwd) | printf
+${HOME} local "$1" | && awk ${HOME} local cd test test echo $(pwd)
+		sed $(pwd) then "$1" sed $(pwd) echo && printf "$1" 'quoted text' /usr/bin
+"$1" -eu | ${HOME} | awk test x=1 -eu /usr/bin done "$1" done
+"$@" sed printf export printf &&
+${HOME} local ${HOME} local
+"$@" sed test echo readonly 2>/dev/null
+		test test -eu grep "$1" cd
+sed /usr/bin "$1" then "$@" | awk sed x=1 'quoted text' local | $(pwd) /usr/bin
+readonly local test cd 'quoted text'
+x=1 echo export done done --verbose cd "$1" x=1 export && 'quoted text'
+&& test -eu | export awk "$@" ${HOME} export done "$1" awk 'quoted text'
+		--verbose test x=1 printf && test grep cd printf echo done test cd test local 'quoted text'
+		printf local echo test -eu && x=1 $(pwd) grep 'quoted text'
+		'quoted text' $(pwd) export test &&
+printf then awk grep $(pwd)
+		$(pwd) local -eu --verbose ${HOME} readonly printf 2>/dev/null
+		export echo grep then then awk local
+		local ${HOME} 2>/dev/null grep x=1 | x=1
+		2>/dev/null cd /usr/bin "$1" "$1" /usr/bin /usr/bin $(pwd) && test && grep 'quoted text'
+		2>/dev/null --verbose cd readonly printf sed -eu
+		grep then /usr/bin test readonly
+	cd "$1" --verbose cd && readonly sed 2>/dev/null 'quoted text'
+		-eu then done 'quoted text' /usr/bin local 2>/dev/null $(pwd) $(pwd) grep
+	done local sed done "$1"
+		'quoted text' awk ${HOME} -eu awk
+	x=1 done echo /usr/bin x=1 && sed 2>/dev/null
+		local echo "$@" $(pwd) /usr/bin x=1 echo test && ${HOME} "$1"
+	${HOME} | ${HOME} -eu sed /usr/bin echo x=1 then $(pwd) local test "$1" sed | then
+		grep ${HOME} local 'quoted text' 2>/dev/null awk then test readonly "$1" x=1
+	-eu cd | 2>/dev/null | --verbose cd && cd $(pwd) echo local
+	test printf 'quoted text'
+export "$1" grep && readonly then readonly ${HOME} x=1 | cd printf
+	${HOME} sed printf 2>/dev/null sed 2>/dev/null cd test
+2>/dev/null done sed echo ${HOME}
+printf "$@" "$@" --verbose grep /usr/bin -eu
+		echo 2>/dev/null readonly 2>/dev/null | 2>/dev/null $(pwd)
+2>/dev/null -eu then --verbose done 2>/dev/null grep x=1 cd
+	"$1" --verbose awk -eu grep
+	2>/dev/null 2>/dev/null /usr/bin export
+		2>/dev/null ${HOME} 'quoted text' "$1" then
+		"$@" -eu 'quoted text' x=1 then printf
+	awk "$@" test && x=1 export awk -eu echo ${HOME} sed "$1" && printf "$1" test
+	${HOME} echo $(pwd) cd "$1" --verbose
+	/usr/bin /usr/bin && awk
+	&& $(pwd) -eu 2>/dev/null "$@" $(pwd)
+		printf grep awk readonly then echo x=1 2>/dev/null then then
+2>/dev/null readonly sed && 2>/dev/null $(pwd)
+		echo local ${HOME} printf echo
+export "$@" "$1" awk x=1 'quoted text' 2>/dev/null
+--verbose test x=1 cd $(pwd) export -eu echo 2>/dev/null then
+	${HOME} /usr/bin test cd
+		test echo $(pwd) 'quoted text' 2>/dev/null 2>/dev/null
+awk awk "$1" x=1 local && echo && sed 'quoted text'
+		grep then grep done 'quoted text'
+"$1" echo "$1" /usr/bin then /usr/bin -eu 2>/dev/null
+echo "$@" x=1 /usr/bin && | && /usr/bin echo
+		readonly "$1" printf "$@" ${HOME} done 2>/dev/null -eu printf export test
+	--verbose local test sed cd
+	then --verbose 'quoted text' --verbose -eu awk /usr/bin ${HOME} readonly
+2>/dev/null ${HOME} awk grep | local done "$1" ${HOME} x=1 2>/dev/null echo ${HOME}
+	local then echo cd cd 2>/dev/null
+readonly -eu "$1" "$1" export x=1 export readonly
+2>/dev/null local test "$1" readonly x=1 "$@" 'quoted text'
+	cd | ${HOME} -eu | grep local awk readonly printf export local --verbose
+	${HOME} local | export x=1 --verbose 2>/dev/null printf done 'quoted text'
+		/usr/bin 2>/dev/null $(pwd) 2>/dev/null awk
+		x=1 grep /usr/bin local -eu /usr/bin local ${HOME}
+	printf | "$1" x=1 printf ${HOME} "$@" && done x=1
+		readonly export test -eu -eu /usr/bin echo
+	printf test export /usr/bin done 'quoted text'
+| --verbose sed 'quoted text' ${HOME} printf --verbose 'quoted text'
+	cd && -eu --verbose cd ${HOME} 'quoted text' 2>/dev/null local
+	'quoted text' test 2>/dev/null printf
+"$1" -eu then ${HOME} | -eu cd | && x=1 x=1 test $(pwd)
+		"$1" --verbose | sed readonly export local printf x=1 cd echo /usr/bin
+	cd cd | printf /usr/bin echo printf
+'quoted text' then "$1" 2>/dev/null grep $(pwd) x=1 "$@"
+printf --verbose --verbose
+		x=1 'quoted text' cd printf
+2>/dev/null --verbose cd "$1" cd grep export ${HOME} done awk then
+	&& done local --verbose export $(pwd) && "$@" local then ${HOME} done x=1
+done export 2>/dev/null readonly
+cd readonly && done --verbose -eu "$1" "$1" export -eu local x=1 awk test cd sed
+		2>/dev/null cd echo sed done /usr/bin then ${HOME} readonly
+'quoted text' then $(pwd) readonly "$1" awk -eu export | -eu x=1 done readonly
+local 2>/dev/null sed export
+| 2>/dev/null | --verbose cd | 'quoted text' 2>/dev/null
+local printf /usr/bin
+"$@" grep -eu $(pwd) --verbose readonly printf "$1" echo $(pwd) done awk
+'quoted text' local -eu -eu | 'quoted text' --verbose readonly
+	${HOME} grep -eu readonly && &&
+		-eu /usr/bin grep | x=1 -eu --verbose
+${HOME} ${HOME} grep ${HOME}
+		'quoted text' && $(pwd) sed | local && grep done
+/usr/bin then $(pwd) && && 2>/dev/null -eu local echo /usr/bin "$1"
+	$(pwd) cd 'quoted text' export x=1 'quoted text'
+	&& "$@" "$1" sed done awk readonly printf readonly
+printf $(pwd) cd awk && grep
+test readonly "$@" 'quoted text' sed
+	| -eu cd grep local done $(pwd) echo export $(pwd) && local "$@" && | 2>/dev/null
+then x=1 awk && -eu local "$1" local
+x=1 'quoted text' 'quoted text' --verbose cd export /usr/bin
+	"$@" then 'quoted text' "$1" awk x=1 ${HOME} cd done
+'quoted text' 'quoted text' 'quoted text' -eu /usr/bin "$1" export
+	then -eu $(pwd) cd readonly 2>/dev/null
+		printf -eu | done && 2>/dev/null local "$@" ${HOME} grep local
+	${HOME} done readonly 'quoted text' 2>/dev/null && export cd
+		| echo echo 2>/dev/null 'quoted text'
+		'quoted text' $(pwd) sed printf printf 'quoted text' "$@" export
+	"$1" test "$@" /usr/bin "$@" printf
+printf "$@" grep readonly
+${HOME} --verbose --verbose
+test then "$@" | export | then then readonly $(pwd) printf echo 2>/dev/null
+	x=1 done sed 2>/dev/null
+echo | local /usr/bin "$1" local cd 'quoted text'
+	cd && printf sed echo $(pwd) 'quoted text' "$@" cd grep --verbose "$1" awk
+	echo "$1" then "$1" -eu "$1" $(pwd) 'quoted text' done printf export
+		then 'quoted text' then awk x=1 | then echo local cd sed test then
+test readonly sed | cd cd x=1 --verbose ${HOME} /usr/bin local x=1
+'quoted text' 2>/dev/null export cd export 'quoted text'
+	"$1" sed 2>/dev/null echo 'quoted text' "$1" && done /usr/bin x=1
+"$1" "$1" test done printf 2>/dev/null readonly test && printf
+		printf readonly && 'quoted text' 'quoted text' done x=1
+	2>/dev/null "$1" $(pwd) "$1" then --verbose done && && | ${HOME} -eu 2>/dev/null
+${HOME} | cd "$@" done grep printf "$@" local export cd && test
+		"$1" local local test done 2>/dev/null --verbose x=1 done "$1" grep
+--verbose printf cd grep echo done 'quoted text' $(pwd) -eu $(pwd)
+		| ${HOME} done | -eu echo printf && done 2>/dev/null awk
+		${HOME} sed grep -eu local -eu | grep awk readonly --verbose
+cd | test "$1" local sed
+-eu local echo --verbose | $(pwd) && readonly test test -eu
+	x=1 $(pwd) $(pwd) then "$1" 2>/dev/null /usr/bin awk cd
+		then awk cd sed ${HOME} sed 'quoted text'
+done -eu export grep | $(pwd) echo
+	x=1 ${HOME} --verbose "$1"
+	x=1 --verbose sed "$1" readonly --verbose awk export 2>/dev/null
+--verbose test /usr/bin | $(pwd) --verbose 2>/dev/null -eu cd "$@" sed cd local
+		done && --verbose 'quoted text' test awk cd readonly
+2>/dev/null readonly sed export sed readonly printf /usr/bin
+	| local "$1" 'quoted text' x=1 grep "$1"
+	2>/dev/null x=1 x=1 $(pwd) then sed export readonly test 2>/dev/null
+		printf && $(pwd) -eu cd ${HOME} && export /usr/bin readonly then readonly ${HOME}
+	&& | | --verbose -eu --verbose
+	"$1" $(pwd) awk --verbose readonly 2>/dev/null --verbose 'quoted text'
+		| echo 2>/dev/null echo 'quoted text'
+then local --verbose "$@" grep $(pwd) local export
+	--verbose --verbose then x=1 export done 2>/dev/null "$@" local x=1 'quoted text'
+		"$@" cd x=1 local /usr/bin 'quoted text'
+/usr/bin done echo 'quoted text'
+awk && local /usr/bin && /usr/bin grep 2>/dev/null echo sed /usr/bin
+	'quoted text' ${HOME} done test readonly &&
+		test "$1" export local grep grep $(pwd) && sed -eu
+	export 'quoted text' --verbose ${HOME} 2>/dev/null "$@" then 'quoted text'
+	2>/dev/null grep --verbose --verbose test 2>/dev/null echo && 'quoted text' 2>/dev/null
+	cd export "$@" echo $(pwd) cd test awk "$1" cd
+		x=1 readonly printf sed $(pwd) 2>/dev/null local $(pwd)
+		sed cd && 'quoted text' $(pwd) echo awk $(pwd) grep echo done done printf
+	printf ${HOME} echo 2>/dev/null 'quoted text' cd /usr/bin $(pwd)
+		&& 'quoted text' /usr/bin grep printf 2>/dev/null grep "$1"
+$(pwd) && /usr/bin sed | cd -eu | "$@" export 'quoted text' cd printf awk sed
+-eu readonly local --verbose $(pwd) "$@" done cd test --verbose done --verbose
+--verbose 2>/dev/null awk awk done "$1" then 2>/dev/null
+x=1 2>/dev/null --verbose cd echo /usr/bin done
+	printf export $(pwd) grep local grep "$1" readonly cd local
+		awk readonly then /usr/bin
+"$@" echo 2>/dev/null && x=1 test grep x=1 --verbose
+done $(pwd) done readonly done done 'quoted text' grep readonly grep x=1
+/usr/bin ${HOME} | readonly echo test -eu cd echo awk echo then ${HOME} local
+		echo test echo /usr/bin printf --verbose export 2>/dev/null export printf
+	&& $(pwd) 2>/dev/null done 2>/dev/null test x=1 readonly
+		"$1" then readonly export cd && 2>/dev/null && awk
+	${HOME} echo export then x=1 | x=1 ${HOME} ${HOME} | "$1" $(pwd) ${HOME} grep "$@"
+	/usr/bin | | awk 'quoted text' export
+	printf export grep local awk && sed ${HOME} -eu "$1" test grep ${HOME} echo
+		local awk && local local 2>/dev/null && export local /usr/bin "$@"
+	then export printf awk $(pwd) test sed export
+"$@" 'quoted text' export
+	test && x=1 'quoted text' echo done awk $(pwd) "$1" local export local grep echo
+/usr/bin then -eu --verbose then -eu then ${HOME} 2>/dev/null $(pwd)
+2>/dev/null && "$@" && "$@" && ${HOME} -eu /usr/bin
+/usr/bin test "$@" x=1 readonly x=1
+		echo export local local /usr/bin 2>/dev/null awk
+"$1" "$1" printf readonly cd 'quoted text' --verbose
+		--verbose /usr/bin local 2>/dev/null
+done sed readonly "$1" && | -eu 2>/dev/null /usr/bin then export printf
+		awk x=1 sed export && 'quoted text' then cd then | local then
+	cd awk ${HOME} awk "$1" cd 2>/dev/null
+	/usr/bin --verbose awk -eu then && cd readonly then
+	&& "$1" readonly readonly awk && readonly done $(pwd) test /usr/bin
+	x=1 grep | local "$@" && 2>/dev/null --verbose | grep awk test
+	x=1 -eu done $(pwd) readonly cd && && x=1 printf
+		grep readonly -eu "$@" 2>/dev/null 'quoted text'
+	echo | x=1 local printf then awk /usr/bin
+	test printf test 2>/dev/null printf
+sed cd cd $(pwd) "$@" $(pwd) cd 2>/dev/null readonly "$@"
+	2>/dev/null --verbose 'quoted text' 2>/dev/null test | "$@"
+	cd cd printf grep then 2>/dev/null ${HOME} x=1 "$@" then printf "$1" echo
+		awk $(pwd) 2>/dev/null --verbose -eu sed cd /usr/bin $(pwd) then echo printf --verbose
+		export local test awk done export done echo printf /usr/bin
+	cd -eu readonly | 'quoted text' cd "$1" 2>/dev/null 2>/dev/null sed
+	/usr/bin | awk x=1 then awk "$@" then test grep /usr/bin "$@" export 'quoted text'
+		echo ${HOME} grep -eu readonly
+	awk 2>/dev/null "$@" done echo readonly readonly &&
+		${HOME} --verbose readonly /usr/bin
+-eu then awk readonly printf --verbose then cd
+		"$@" readonly done 'quoted text' -eu done "$1" readonly local
+	done export -eu -eu ${HOME} x=1
+	2>/dev/null test -eu awk cd then x=1 then --verbose sed
+	2>/dev/null sed test 'quoted text' readonly test x=1 "$@" awk echo sed
+	echo sed awk 'quoted text' grep -eu /usr/bin
+		readonly grep done then echo
+done /usr/bin | sed printf
+		done grep sed printf "$@" grep grep 'quoted text' $(pwd) done -eu --verbose
+	cd | local cd && "$1" -eu awk
+		--verbose then | x=1 sed &&
+	2>/dev/null echo test "$1" echo export
+2>/dev/null sed "$1" && "$@" --verbose && done "$@" "$@"
+${HOME} /usr/bin "$1" --verbose export $(pwd)
+	grep readonly x=1 | test -eu local $(pwd) 'quoted text'
+	${HOME} cd ${HOME} sed test "$1" | x=1 && /usr/bin x=1 export
+		--verbose && then 2>/dev/null
+		x=1 | then x=1 $(pwd) local grep 2>/dev/null | --verbose -eu awk $(pwd)
+	done sed export -eu -eu awk ${HOME} 2>/dev/null cd
+| readonly done grep export -eu then export sed $(pwd)
+	"$@" | ${HOME} awk "$1" test ${HOME} test 'quoted text'
+cd -eu --verbose ${HOME} && 'quoted text' 'quoted text' /usr/bin
+		then | x=1 'quoted text' export sed ${HOME} "$1"
+		&& "$@" 'quoted text' -eu printf readonly echo $(pwd)
+/usr/bin echo readonly 2>/dev/null /usr/bin 'quoted text'
+awk | export $(pwd) /usr/bin printf /usr/bin
+x=1 && test && --verbose cd | 2>/dev/null
+	-eu --verbose done local $(pwd) | | then test /usr/bin $(pwd) -eu local cd done
+	sed then done | printf "$@" readonly
+	then "$@" echo ${HOME} /usr/bin
+		printf "$1" cd then done ${HOME} export cd done done
+	printf readonly 2>/dev/null then ${HOME} "$1" readonly $(pwd) "$@" "$@" --verbose
+"$@" --verbose /usr/bin /usr/bin sed
+export $(pwd) readonly readonly done printf | then test -eu then --verbose ${HOME}
+2>/dev/null sed export then
+	grep export "$1" 2>/dev/null local echo ${HOME} "$@" done ${HOME} local $(pwd)
+"$@" /usr/bin printf | then ${HOME} export readonly
+then done grep 'quoted text' 2>/dev/null
+		then $(pwd) x=1 cd echo awk then "$@" awk
+	$(pwd) "$1" cd grep "$@" /usr/bin echo done && "$1" | ${HOME} --verbose readonly
+	grep | /usr/bin ${HOME} -eu 2>/dev/null
+done ${HOME} --verbose "$1" cd printf awk export readonly then /usr/bin export
+		echo -eu x=1 "$1" && | export 2>/dev/null --verbose readonly -eu 'quoted text'
+		&& --verbose awk sed then /usr/bin ${HOME} -eu cd awk /usr/bin grep "$@" grep
+		$(pwd) "$@" /usr/bin test ${HOME} then "$@"
+local "$@" && export done 2>/dev/null export x=1 x=1 "$1"
+cd printf -eu sed printf 2>/dev/null --verbose --verbose
+		done awk -eu export ${HOME} /usr/bin local -eu "$@" 2>/dev/null ${HOME}
+local 2>/dev/null "$1" test echo "$1" grep then $(pwd) echo done printf
+	awk "$@" readonly && test ${HOME} | readonly then grep /usr/bin 'quoted text'
+	2>/dev/null echo $(pwd) awk $(pwd) then $(pwd) -eu 'quoted text'
+'quoted text' printf /usr/bin $(pwd) /usr/bin printf | ${HOME}
+&& sed sed "$1" echo printf -eu awk then 2>/dev/null
+echo x=1 -eu $(pwd) "$@" echo 'quoted text'
+	export printf | -eu done echo | readonly
+	--verbose "$1" local then -eu export /usr/bin printf grep
+x=1 --verbose sed | 2>/dev/null done done cd && export $(pwd) "$1" done sed
+	then 2>/dev/null --verbose ${HOME}
+		printf && -eu "$@" grep export
+	printf "$1" test sed /usr/bin readonly echo
+	"$@" then export -eu local grep readonly x=1
+--verbose | done /usr/bin -eu
+	local sed x=1 | test x=1 $(pwd) local readonly local
+	printf cd sed x=1 printf then done ${HOME} x=1 "$1" grep sed | done readonly
+| done && "$@" export 'quoted text'
+	&& local awk echo | /usr/bin local 2>/dev/null then cd grep $(pwd) /usr/bin
+		printf sed cd printf readonly echo test ${HOME} x=1 test cd readonly
+		2>/dev/null "$1" "$1" | local ${HOME} ${HOME} && x=1 2>/dev/null
+	2>/dev/null export /usr/bin "$@" cd ${HOME} ${HOME}
+		/usr/bin --verbose cd echo /usr/bin then done echo sed local then
+		grep 'quoted text' "$1" --verbose
+		local | grep 2>/dev/null done
+		$(pwd) "$1" "$@" 2>/dev/null
+	--verbose /usr/bin readonly x=1 x=1 'quoted text' test sed
+		${HOME} grep && done grep local
+echo $(pwd) -eu export readonly printf done --verbose x=1 local done /usr/bin sed
+-eu sed sed 2>/dev/null
+		/usr/bin x=1 grep test 'quoted text' test awk && local &&
+	2>/dev/null $(pwd) grep awk "$@"
+		awk printf cd --verbose export done 'quoted text' "$@"
+		export "$1" 2>/dev/null $(pwd)
+		done printf x=1 sed then grep -eu then cd readonly --verbose
+	| awk --verbose "$@" && export sed
+readonly readonly done && "$@" ${HOME} readonly
+/usr/bin $(pwd) "$@" grep then -eu
+echo sed "$1" cd 2>/dev/null done && awk "$@" $(pwd)
+'quoted text' -eu && x=1 --verbose /usr/bin
+		readonly ${HOME} export printf x=1 --verbose printf "$1" 2>/dev/null
+		"$1" then $(pwd) done 'quoted text' echo && test --verbose
+echo 'quoted text' /usr/bin
+	x=1 x=1 echo 'quoted text' 2>/dev/null "$@" printf readonly --verbose
+then 'quoted text' sed 2>/dev/null echo 'quoted text' /usr/bin test awk sed
+	echo x=1 $(pwd) "$1" echo cd $(pwd)
+	test && grep -eu test 'quoted text' awk then 'quoted text'
+	done --verbose && local
+		local grep echo x=1 -eu "$1"
+	readonly /usr/bin echo readonly
+2>/dev/null local then test -eu "$1" local "$1" done && test awk &&
+"$1" "$1" echo sed | sed echo ${HOME} printf 2>/dev/null | export grep
+	"$@" echo readonly export --verbose cd 2>/dev/null ${HOME} then
+	x=1 export printf cd echo
+		printf done x=1 -eu done
+		2>/dev/null awk --verbose then test printf awk
+'quoted text' done && cd --verbose ${HOME} awk | $(pwd) "$1" x=1 $(pwd)
+"$@" cd test readonly test $(pwd) 2>/dev/null ${HOME} local 'quoted text'
+	cd && cd "$1" local export x=1
+-eu then -eu /usr/bin "$1" grep readonly echo local
+test sed | 2>/dev/null "$@" $(pwd)
+readonly ${HOME} export cd "$1" "$@" && printf
+		readonly done done ${HOME} cd ${HOME} 2>/dev/null done ${HOME}
+'quoted text' $(pwd) grep
+		test test done local then $(pwd) cd done then sed | cd local grep "$@"
+	awk export export cd local test "$@" 2>/dev/null -eu "$1" grep -eu 2>/dev/null
+	"$@" 2>/dev/null /usr/bin printf 'quoted text' local "$1"
+		x=1 $(pwd) $(pwd) export local done grep grep -eu "$1" export
+	${HOME} ${HOME} 2>/dev/null
+awk x=1 local then x=1 sed sed x=1 | $(pwd) local x=1 "$@"
+		2>/dev/null awk && readonly printf sed $(pwd)
+grep done local readonly then printf -eu 2>/dev/null
+--verbose test 2>/dev/null
+"$@" $(pwd) awk readonly
+done -eu local "$1" cd then /usr/bin sed && ${HOME} --verbose "$@" test | x=1
+		printf -eu test --verbose test readonly done readonly
+		cd /usr/bin 'quoted text' echo
+&& $(pwd) && --verbose x=1 ${HOME} printf x=1
+"$1" export grep readonly printf "$@" 'quoted text' --verbose 'quoted text'
+	/usr/bin ${HOME} /usr/bin ${HOME} echo printf -eu then x=1 'quoted text'
+		"$1" /usr/bin export --verbose done /usr/bin echo cd
+2>/dev/null local "$@" -eu test 2>/dev/null echo 2>/dev/null
+	local test && | awk export "$@" --verbose
+	--verbose -eu sed --verbose -eu awk --verbose -eu -eu
+	printf sed ${HOME} local "$1" export readonly
+-eu ${HOME} && ${HOME} -eu
+		/usr/bin then cd then x=1
+'quoted text' 2>/dev/null echo
+	| 2>/dev/null echo --verbose -eu
+	'quoted text' printf local then 'quoted text' && 2>/dev/null printf
+sed -eu | local printf cd "$1"
+test printf sed x=1 x=1 2>/dev/null sed done awk awk && readonly "$@"
+		${HOME} export cd echo
+	grep grep echo /usr/bin echo test
+	done then --verbose then ${HOME} echo x=1 -eu | grep
+printf printf cd test readonly --verbose 2>/dev/null "$@" &&
+	done printf | ${HOME} cd 'quoted text' && grep then x=1 then printf /usr/bin
+"$@" /usr/bin ${HOME} export sed -eu | cd /usr/bin x=1
+		&& echo x=1 echo cd readonly
+		then /usr/bin readonly && "$@" $(pwd) grep awk 'quoted text'
+		/usr/bin grep test 2>/dev/null printf awk sed cd | | sed awk export awk readonly
+	$(pwd) /usr/bin 'quoted text' $(pwd) "$@" "$1"
+		export printf sed && export cd local ${HOME} printf | done
+export awk "$1" $(pwd) done 'quoted text' x=1 sed "$@" cd done
+	-eu local test && printf then | then echo
+		grep 2>/dev/null cd $(pwd) "$1" then readonly printf ${HOME}
+	echo --verbose printf --verbose x=1 "$@"
+	x=1 grep cd --verbose "$1"
+	-eu done grep test grep x=1 'quoted text' done readonly $(pwd)
+done done awk awk "$1" grep echo grep "$@"
+$(pwd) && 'quoted text' /usr/bin &&
+	${HOME} grep && $(pwd) | x=1 ${HOME}
+		grep 'quoted text' grep done export printf
+		${HOME} -eu local local readonly -eu ${HOME}
+then 'quoted text' 2>/dev/null ${HOME}
+$(pwd) "$@" sed 'quoted text' export --verbose
+	"$1" && 'quoted text' sed x=1 test 'quoted text' echo grep "$@" grep cd /usr/bin
+		local 2>/dev/null sed "$@" -eu then && awk
+	grep cd awk done x=1 echo then grep printf "$@" test then awk --verbose local
+x=1 done printf grep test echo cd 'quoted text'
+	-eu | awk echo printf x=1 | sed cd
+	grep 2>/dev/null export --verbose printf test "$@" 2>/dev/null
+		--verbose test export test
+	echo && $(pwd) "$1" /usr/bin
+	$(pwd) echo then ${HOME} 2>/dev/null "$@" && grep | export local 'quoted text'
+	/usr/bin x=1 export export && 'quoted text'
+printf cd awk done grep -eu cd printf sed sed --verbose
+	sed --verbose awk /usr/bin && "$1" /usr/bin cd "$@"
+		then 'quoted text' export "$@" $(pwd) $(pwd)
+		readonly $(pwd) readonly -eu x=1 'quoted text' 2>/dev/null
+	done grep sed /usr/bin
+	cd export "$@" export /usr/bin x=1 && then local "$1" x=1 test export
+		readonly 2>/dev/null ${HOME} -eu "$@" | 2>/dev/null x=1 cd cd export then --verbose
+	'quoted text' grep sed && --verbose 2>/dev/null sed $(pwd) export x=1
+		"$@" local export 2>/dev/null cd grep --verbose 2>/dev/null
+		export export x=1 x=1 "$@" 'quoted text' ${HOME} printf "$@" export grep
+export --verbose local awk "$1" local 'quoted text' x=1 --verbose echo "$1" then
+	sed "$@" && done 2>/dev/null
+readonly readonly done grep $(pwd)
+		"$@" "$@" done $(pwd) done cd && done 'quoted text'
+--verbose printf "$1" --verbose sed --verbose awk --verbose
+"$@" grep "$1" | echo -eu && --verbose 'quoted text' x=1 "$@" 'quoted text'
+	test -eu && ${HOME} local "$1" --verbose
+	-eu | | local done x=1 sed ${HOME} done ${HOME}
+	cd awk ${HOME} -eu 'quoted text' -eu "$@" done
+		local test 'quoted text' done | x=1 done $(pwd) readonly
+	-eu 2>/dev/null && && grep done export
+		done test then sed readonly "$@" /usr/bin "$@" then
+	-eu && readonly | 'quoted text' "$@" cd readonly
+		printf x=1 local "$1" printf $(pwd) x=1
+test cd $(pwd) -eu export local test | cd done
+	"$@" "$@" export printf then $(pwd) 2>/dev/null
+'quoted text' readonly test 2>/dev/null awk awk ${HOME}
+	test ${HOME} | echo 'quoted text' && -eu test done "$1" test
+	cd -eu ${HOME} "$1" "$1" x=1 grep cd "$@"
+		printf cd test x=1 'quoted text' echo "$1" ${HOME} done
+"$@" sed x=1 printf then
+printf printf "$@" 'quoted text' $(pwd) readonly awk "$@" ${HOME} printf
+grep --verbose --verbose ${HOME}
+--verbose | 'quoted text' then local done "$1" export -eu | export 'quoted text'
+&& -eu --verbose awk export done cd
+	export -eu "$@" --verbose "$1" ${HOME} export grep
+		| then ${HOME} 'quoted text' echo sed 'quoted text'
+--verbose printf readonly
+		local echo --verbose x=1 echo echo --verbose export
+		local 'quoted text' 2>/dev/null
+then cd ${HOME} /usr/bin $(pwd) -eu then ${HOME} && grep ${HOME} && "$1"
+	echo echo "$@" grep /usr/bin
+	export --verbose "$1" sed &&
+	--verbose test test && -eu awk test grep "$@" --verbose sed
+grep cd | printf echo /usr/bin echo printf readonly "$1"
+	"$@" local /usr/bin sed test x=1 export sed | grep &&
+/usr/bin ${HOME} grep x=1 'quoted text'
+		--verbose test "$@" cd done -eu test "$1" --verbose && test
+--verbose then | done test 2>/dev/null grep && 'quoted text'
+	--verbose local echo awk 2>/dev/null
+	export $(pwd) grep x=1 --verbose export /usr/bin --verbose cd awk 'quoted text'
+	export --verbose awk --verbose /usr/bin
+		2>/dev/null done then
+	grep sed x=1 test "$@" $(pwd) ${HOME} "$@" printf /usr/bin ${HOME} ${HOME}
+--verbose printf awk echo done "$1" export $(pwd) x=1 done
+		local echo --verbose "$@" $(pwd) -eu && x=1 readonly
+		awk readonly test cd sed $(pwd) && ${HOME} $(pwd)
+		echo local cd x=1 local printf x=1 ${HOME} ${HOME}
+echo -eu $(pwd) sed && -eu
+done readonly sed 'quoted text' $(pwd)
+	local 'quoted text' local /usr/bin
+grep test "$@" --verbose cd test "$@" grep then 'quoted text'
+	| printf "$@" /usr/bin export x=1 x=1 test "$@" done printf cd grep echo
+	/usr/bin done awk awk local awk /usr/bin awk --verbose
+		done -eu local --verbose --verbose readonly
+		/usr/bin test 'quoted text' -eu export ${HOME}
+printf sed ${HOME} test "$@" x=1 then
+		grep readonly readonly sed readonly | 'quoted text' -eu "$1" && 'quoted text'
+	export --verbose ${HOME} cd export 2>/dev/null grep readonly awk
+x=1 test test ${HOME} $(pwd) awk grep
+	| cd && cd grep "$1" cd x=1 grep
+	x=1 awk --verbose cd /usr/bin awk ${HOME} printf export $(pwd)
+/usr/bin "$@" "$1" readonly -eu "$@" awk 2>/dev/null x=1 test
+		grep test 'quoted text' x=1 --verbose echo done "$@" grep 'quoted text'
+	printf done export ${HOME}
+x=1 'quoted text' grep printf
+readonly $(pwd) ${HOME} && done --verbose
+/usr/bin done 2>/dev/null x=1 2>/dev/null export test readonly awk
+x=1 | --verbose sed "$1" printf then x=1 cd done 'quoted text'
+		x=1 export then "$1" "$@" --verbose && "$1" printf 'quoted text' then local echo
+	$(pwd) ${HOME} then test done 2>/dev/null
+	grep readonly done --verbose 2>/dev/null --verbose
+	sed printf readonly cd local "$1" awk 2>/dev/null export test then
+cd 'quoted text' --verbose "$@" --verbose then
+sed echo sed done 2>/dev/null ${HOME} readonly echo /usr/bin local
+	echo then done /usr/bin x=1 readonly
+	echo "$@" | test then && -eu printf "$1" $(pwd) ${HOME} "$@" | local
+	'quoted text' readonly | printf | sed export sed printf | -eu -eu grep export
+local done test echo test test "$@" export readonly
+	| grep 2>/dev/null x=1 | "$1" 'quoted text' awk sed
+	| 'quoted text' then 2>/dev/null x=1
+test --verbose then echo cd ${HOME}
+		x=1 'quoted text' 'quoted text'
+"$@" 'quoted text' sed test echo cd cd readonly local -eu local x=1 grep
+	echo x=1 export && cd echo ${HOME} grep
+2>/dev/null "$@" x=1 printf export /usr/bin ${HOME}
+-eu 'quoted text' "$1" "$@" cd /usr/bin export -eu local | export
+	"$@" | readonly then grep export 2>/dev/null done --verbose
+		x=1 ${HOME} | 'quoted text' sed x=1 sed "$@" 'quoted text'
+		'quoted text' && echo --verbose
+cd awk 'quoted text' -eu export grep | 2>/dev/null then
+	2>/dev/null 'quoted text' /usr/bin test done $(pwd) printf 'quoted text'
+	export 'quoted text' /usr/bin ${HOME} cd && printf
+then | ${HOME} sed && printf 'quoted text' "$1" sed /usr/bin
+	echo "$@" 2>/dev/null -eu done /usr/bin echo readonly --verbose -eu "$1" test
+-eu test "$1" /usr/bin done cd test && 'quoted text' 2>/dev/null test 'quoted text'
+		local done cd -eu local -eu 2>/dev/null x=1 | $(pwd) /usr/bin export x=1 "$@"
+sed grep | 'quoted text' sed echo test 'quoted text' printf
+		--verbose grep -eu grep ${HOME} 2>/dev/null
+	export ${HOME} cd $(pwd) 'quoted text' $(pwd) "$1" cd
+-eu awk | sed /usr/bin --verbose test printf
+		| -eu printf cd export && printf /usr/bin ${HOME}
+	| && "$1" "$@" -eu ${HOME} then 'quoted text' "$1" 2>/dev/null
+		then -eu /usr/bin then sed | "$1" local ${HOME} "$@" echo cd /usr/bin
+	local export local cd sed
+x=1 then 'quoted text' x=1 done
+"$1" echo done 2>/dev/null
+		--verbose done --verbose --verbose --verbose "$@" x=1 x=1 &&
+	grep then readonly $(pwd) | readonly awk awk echo
+		cd cd $(pwd) then -eu cd grep x=1 --verbose && echo local
+	awk 2>/dev/null sed done x=1 "$@" awk 2>/dev/null --verbose
+then -eu $(pwd) readonly "$@" echo 'quoted text' "$@" |
+		${HOME} 2>/dev/null sed --verbose && -eu readonly $(pwd) --verbose awk "$1" test
+		"$1" local "$1" /usr/bin printf then echo awk awk
+	awk done readonly /usr/bin 2>/dev/null test cd then done -eu echo && --verbose
+		readonly -eu && "$@" cd /usr/bin awk -eu x=1
+	--verbose && $(pwd) $(pwd) -eu export then export -eu "$@"
+		"$1" -eu export ${HOME} ${HOME} ${HOME}
+		2>/dev/null x=1 cd "$1" "$1" && done awk grep && awk local test done echo printf
+"$@" $(pwd) -eu test -eu "$@" local done local $(pwd) "$@"
+		printf -eu x=1 --verbose grep echo
+	2>/dev/null /usr/bin 2>/dev/null ${HOME} --verbose /usr/bin
+		${HOME} x=1 awk "$@" grep --verbose sed 'quoted text'
+	printf sed then 2>/dev/null -eu echo
+done readonly grep echo sed then local done awk -eu $(pwd) "$@" local local printf
+		awk grep -eu echo 2>/dev/null "$1" test && x=1
+	&& -eu /usr/bin | 2>/dev/null readonly
+		x=1 ${HOME} done 2>/dev/null then sed 2>/dev/null "$@" && /usr/bin
+		then local sed /usr/bin then /usr/bin $(pwd) "$1" --verbose sed "$@" done
+	cd echo printf ${HOME} -eu grep && "$@" sed grep echo
+printf $(pwd) | awk ${HOME} echo readonly
+'quoted text' 'quoted text' | 'quoted text' awk 'quoted text' test done
+	then $(pwd) /usr/bin local "$@"
+	"$@" cd grep x=1 awk echo sed -eu sed 'quoted text'
+cd cd grep test done awk 'quoted text' printf test echo then | echo 2>/dev/null
+	done "$1" local ${HOME} | sed | local local ${HOME} $(pwd) 2>/dev/null
+		readonly awk awk && x=1 -eu "$@" "$1" 'quoted text' && 2>/dev/null ${HOME} done
+	done done test && grep "$@" $(pwd) 2>/dev/null
+readonly printf --verbose 'quoted text' "$@" "$1"
+	'quoted text' ${HOME} done awk local --verbose ${HOME} "$@" readonly test
+		"$@" cd done cd 'quoted text' "$@" local sed
+		test x=1 -eu awk awk local && export grep x=1 grep "$1" done sed local
+&& && then awk test && "$@" /usr/bin $(pwd) export ${HOME}
+	"$1" 'quoted text' awk /usr/bin $(pwd) $(pwd) sed
+		then test $(pwd) awk sed $(pwd) --verbose cd $(pwd)
+		"$@" test then cd ${HOME} printf 'quoted text'
+	echo grep grep done "$1" grep local
+sed 2>/dev/null ${HOME} "$@" done "$@" "$1" grep --verbose done local /usr/bin
+		awk ${HOME} then awk cd | ${HOME} test test 2>/dev/null --verbose 2>/dev/null
+then readonly export local local export export printf $(pwd)
+		/usr/bin 2>/dev/null export grep printf "$1" cd 'quoted text'
+readonly echo "$@" local printf "$@"
+	x=1 'quoted text' done printf "$@" --verbose
+		test printf sed sed then echo cd awk readonly | done sed | --verbose then sed
+		"$@" test local 'quoted text'
+/usr/bin "$@" -eu | local | -eu local done
+"$@" && /usr/bin --verbose $(pwd) -eu /usr/bin && "$@" export
+	cd ${HOME} readonly 2>/dev/null
+2>/dev/null cd --verbose local sed 2>/dev/null test
+sed then done ${HOME} --verbose done 2>/dev/null
+		cd "$@" done sed printf ${HOME} grep cd && test local awk --verbose ${HOME}
+cd grep test /usr/bin x=1 && "$1" -eu x=1
+readonly 2>/dev/null $(pwd) printf readonly /usr/bin sed --verbose
+grep 'quoted text' export local test cd echo "$@" printf ${HOME}
+	awk sed "$1" cd x=1 'quoted text'
+local --verbose && sed done "$@" "$1" export "$@" cd cd /usr/bin sed awk then test
+${HOME} 'quoted text' grep -eu
+awk 2>/dev/null "$@" && | printf readonly
+	local cd grep "$@" 'quoted text'
+export ${HOME} "$@" --verbose
+		cd local readonly awk | --verbose --verbose done && $(pwd) 'quoted text'
+		-eu grep echo --verbose readonly export sed -eu
+then -eu awk readonly cd --verbose 'quoted text'
+cd "$1" local $(pwd) 'quoted text'
+awk test --verbose local "$1" local ${HOME} --verbose done printf 2>/dev/null
+	cd 2>/dev/null ${HOME} 'quoted text'
+		readonly then /usr/bin --verbose --verbose echo awk then cd grep readonly
+	done 'quoted text' | ${HOME} test
+${HOME} done -eu readonly local sed readonly
+	awk awk $(pwd) awk printf local --verbose
+		${HOME} x=1 sed readonly local
+		sed readonly echo readonly
+	cd --verbose /usr/bin 2>/dev/null --verbose 2>/dev/null
+#include c230.sh
+then ${HOME} awk && | 2>/dev/null local echo -eu export "$@" awk
+		printf x=1 -eu --verbose "$1" awk awk readonly
+		then local awk /usr/bin 'quoted text' --verbose
+	| "$1" 'quoted text' "$@" x=1 printf | ${HOME} sed readonly printf grep readonly
+local /usr/bin "$1" "$1" && $(pwd) export -eu x=1 "$1" done "$@"
+	x=1 --verbose 'quoted text' sed readonly cd "$1" 'quoted text' done
+	/usr/bin 2>/dev/null $(pwd)
+"$1" grep 'quoted text' test
+		done test /usr/bin $(pwd) "$@" x=1 2>/dev/null -eu readonly
+	x=1 x=1 readonly --verbose ${HOME} local
+$(pwd) -eu test sed grep ${HOME} awk sed 2>/dev/null
+printf x=1 "$1" export x=1 /usr/bin cd export export sed readonly
+-eu $(pwd) local sed test "$@" sed
+	printf --verbose /usr/bin local cd /usr/bin sed
+	done --verbose 'quoted text' readonly
+		cd then "$1" ${HOME} cd printf cd cd 2>/dev/null "$1"
+		then then "$@" cd --verbose $(pwd) 2>/dev/null done readonly $(pwd) readonly "$@"
+	then "$@" 2>/dev/null echo cd "$@"
+-eu /usr/bin $(pwd) | grep printf
+awk ${HOME} echo | readonly 2>/dev/null awk local local
+		${HOME} printf "$1" "$1" --verbose /usr/bin "$1" grep then
+		| test test cd $(pwd) done
+		echo $(pwd) x=1 awk readonly test $(pwd) ${HOME} echo ${HOME} ${HOME} export
+done $(pwd) cd 2>/dev/null export sed sed 'quoted text'
+x=1 "$@" test 2>/dev/null
+	cd -eu | /usr/bin echo sed ${HOME}
+		"$@" --verbose x=1 printf sed x=1 local
+	x=1 "$1" x=1 local then cd /usr/bin /usr/bin export then --verbose
+		'quoted text' grep $(pwd) /usr/bin x=1 2>/dev/null
+		printf /usr/bin 2>/dev/null echo done ${HOME} test awk awk -eu
+sed readonly sed local done printf grep done local
+	then awk 2>/dev/null /usr/bin echo test local | && 'quoted text'
+		export $(pwd) test | export x=1 readonly --verbose cd test /usr/bin then awk &&
+cd export export | cd -eu done | echo then local 'quoted text'
+-eu "$1" | 2>/dev/null sed ${HOME} test x=1 2>/dev/null
+echo then readonly "$@" --verbose awk
+	&& sed grep printf printf then awk ${HOME} cd "$@" && then --verbose
+"$1" -eu 'quoted text' /usr/bin && echo test sed
+		then echo test grep local x=1 x=1 "$@"
+	echo printf && export && grep local "$@" "$1" 'quoted text' $(pwd) x=1 then printf
+		sed "$1" x=1 x=1 'quoted text' local "$1"
+then test done $(pwd) echo echo
+		${HOME} awk echo && sed
+done | | $(pwd) -eu done
+		export -eu local local local 'quoted text' $(pwd) cd awk "$1" 'quoted text'
+	x=1 && /usr/bin $(pwd) ${HOME} export
+	printf cd grep echo then
+2>/dev/null export then local
+	| "$@" x=1 | export --verbose test /usr/bin
+$(pwd) --verbose "$@"
+		sed x=1 --verbose && readonly sed
+$(pwd) local 'quoted text' readonly /usr/bin sed echo printf
+	&& 'quoted text' done --verbose
+	printf awk cd cd 'quoted text' grep 2>/dev/null 2>/dev/null "$1" cd echo 'quoted text'
+done done test readonly "$1" printf
+	--verbose -eu sed readonly "$1" 'quoted text'
+		printf readonly "$1" "$@" /usr/bin x=1 | awk local test 2>/dev/null printf
+then printf 2>/dev/null | sed printf awk -eu
+		&& ${HOME} /usr/bin ${HOME} then x=1 "$@" -eu && &&
+	| /usr/bin done && printf
+	then awk cd readonly "$1" 'quoted text'
+		test cd x=1 /usr/bin local --verbose "$1" 2>/dev/null $(pwd)
+		echo "$1" sed && ${HOME} x=1 2>/dev/null
+		/usr/bin done "$1" ${HOME} ${HOME} cd && done | echo "$@" grep --verbose 'quoted text'
+'quoted text' ${HOME} "$1" echo readonly
+		done -eu 2>/dev/null $(pwd) export sed $(pwd) done 'quoted text' export grep
+	&& sed then echo sed test | ${HOME} -eu | 'quoted text' cd
+	sed cd then "$@" -eu export
+		done sed sed then sed echo /usr/bin
+		then done cd local | awk && /usr/bin
+		printf --verbose sed && "$@"
+		test export ${HOME} printf -eu cd test readonly cd sed /usr/bin
+	printf cd grep done readonly echo $(pwd) --verbose export then
+		x=1 && sed | done | 'quoted text' printf
+		sed /usr/bin local printf 'quoted text'
+printf export cd 2>/dev/null
+		'quoted text' sed local | "$1" export
+	| 2>/dev/null cd echo grep && cd then cd readonly
+${HOME} "$@" --verbose done grep sed readonly x=1 'quoted text' -eu grep export
+		--verbose /usr/bin --verbose | $(pwd)
+	awk cd readonly --verbose cd echo /usr/bin | -eu cd echo
+done printf | grep &&
+	cd "$1" "$@" local $(pwd) x=1 export x=1 sed $(pwd) ${HOME} awk local
+		echo cd printf $(pwd) grep $(pwd) /usr/bin $(pwd) | then sed awk awk done "$@" sed
+-eu sed /usr/bin readonly sed "$1" --verbose test $(pwd) --verbose export
+	test local "$@" local x=1 "$1" 2>/dev/null cd cd echo 'quoted text'
+grep ${HOME} local && | grep cd then sed printf | sed && 2>/dev/null
+		/usr/bin cd /usr/bin && done 'quoted text'
+		cd local export cd cd /usr/bin 'quoted text' export -eu cd awk cd grep "$1" -eu
+-eu 'quoted text' grep test /usr/bin "$@" export export "$1" test
+		then cd 'quoted text' awk grep --verbose
+echo printf "$@" && cd -eu grep then
+then 'quoted text' sed then $(pwd) x=1
+		2>/dev/null export 'quoted text'
+local export done sed sed sed local x=1 /usr/bin "$1" then
+		then -eu awk cd | /usr/bin 'quoted text' "$1"
+	grep $(pwd) 2>/dev/null sed readonly 2>/dev/null 2>/dev/null 'quoted text'
+		printf ${HOME} printf awk export then "$1" "$1" done local test $(pwd) done
+--verbose x=1 -eu grep sed awk done 'quoted text' export $(pwd)
+awk awk "$1" test $(pwd) test local then then readonly printf echo $(pwd)
+$(pwd) 'quoted text' $(pwd) grep test x=1 ${HOME} awk x=1 "$@"
+	local $(pwd) test x=1 && "$@" | 2>/dev/null cd
+"$1" done --verbose sed /usr/bin test
+	echo sed ${HOME} 2>/dev/null grep export
+	cd "$1" x=1 --verbose --verbose ${HOME} 'quoted text'
+		2>/dev/null awk then awk cd then | awk local
+	2>/dev/null awk local local --verbose
+		$(pwd) $(pwd) 'quoted text' -eu export "$1"
+	"$@" awk 'quoted text' ${HOME} grep awk ${HOME} local ${HOME} ${HOME}
+	--verbose --verbose /usr/bin cd readonly export "$@" printf
+	awk "$@" done test done done export 2>/dev/null
+		'quoted text' awk -eu -eu printf --verbose local
+cd && x=1 -eu --verbose $(pwd) | done
+	"$@" done "$@" test | /usr/bin /usr/bin /usr/bin $(pwd) "$1" printf
+	test && 'quoted text' 2>/dev/null test && printf readonly printf awk 'quoted text'
+		grep --verbose 2>/dev/null
+		$(pwd) sed $(pwd) done sed test x=1 "$1" export ${HOME} x=1 export --verbose
+	readonly x=1 | 'quoted text' printf
+printf 2>/dev/null printf --verbose echo awk local
+		-eu export sed readonly 'quoted text' -eu grep grep
+		done -eu export x=1 "$1" export x=1 "$1" readonly "$1" | test | grep |
+	cd cd $(pwd) sed $(pwd) local
+2>/dev/null test echo grep export --verbose cd
+		sed export test export -eu 'quoted text' 2>/dev/null readonly /usr/bin printf
+		--verbose /usr/bin then 'quoted text' ${HOME} readonly sed
+"$@" test sed printf "$1" ${HOME} local
+	readonly /usr/bin export /usr/bin echo 2>/dev/null
+		done local && 'quoted text' "$@" done echo "$@" ${HOME}
+	"$@" grep | then /usr/bin | --verbose local "$1"
+	"$@" test done 'quoted text' printf grep
+		"$1" test && --verbose && | x=1 -eu printf sed "$@"
+		"$1" -eu cd -eu && -eu $(pwd)
+	$(pwd) $(pwd) ${HOME} $(pwd) printf --verbose ${HOME} -eu printf | awk
+		echo | "$1" /usr/bin |
+		then awk then 2>/dev/null ${HOME} printf readonly | sed printf printf
+"$@" echo sed awk -eu printf 'quoted text' --verbose cd echo -eu 2>/dev/null 'quoted text'
+2>/dev/null echo x=1 'quoted text' "$@" sed "$@" grep 'quoted text' grep test -eu
+		'quoted text' 2>/dev/null --verbose ${HOME} local $(pwd) echo
+	2>/dev/null | 2>/dev/null $(pwd) readonly
+	--verbose test "$@" && echo "$1" sed x=1 -eu grep /usr/bin echo echo
+	--verbose local readonly -eu -eu $(pwd)
+--verbose awk $(pwd) readonly
+	printf "$@" x=1 x=1 export
+done ${HOME} && && && done then 'quoted text' | export cd grep -eu
+		x=1 export grep grep x=1 readonly test local | then ${HOME}
+	local | done then $(pwd) x=1 awk test
+	/usr/bin --verbose && "$1" 2>/dev/null cd x=1 "$1" /usr/bin
+"$1" printf echo sed awk ${HOME} cd | -eu && awk readonly local 2>/dev/null
+test then local x=1 2>/dev/null then awk x=1 export "$@"
+		done $(pwd) grep 2>/dev/null local "$@"
+		readonly | x=1 test readonly
+		sed awk local ${HOME} export sed printf
+		printf grep -eu -eu --verbose
+2>/dev/null grep | sed ${HOME} x=1 cd 'quoted text' grep readonly | local
+		-eu echo readonly export done 'quoted text' sed awk echo 'quoted text'
+${HOME} export test printf "$1" /usr/bin -eu test "$@" -eu sed done
+$(pwd) /usr/bin grep 2>/dev/null ${HOME}
+	local 2>/dev/null -eu -eu "$@" $(pwd) export "$@" export readonly local
+export ${HOME} 'quoted text'
+		2>/dev/null export | 'quoted text' readonly grep "$1" readonly && readonly printf
+local done done --verbose ${HOME} readonly ${HOME}
+export printf sed -eu 'quoted text' "$@" "$1" export cd && awk readonly
+	sed sed done $(pwd) printf
+	test awk -eu awk && grep $(pwd) 'quoted text' 'quoted text' awk readonly ${HOME}
+done $(pwd) /usr/bin | "$1" --verbose then grep 2>/dev/null
+	'quoted text' then local awk
+'quoted text' "$@" | x=1 readonly cd 'quoted text' && sed --verbose ${HOME}
+	$(pwd) "$1" then && test "$1" -eu /usr/bin echo grep export echo then
+		/usr/bin done cd 'quoted text' $(pwd) readonly then x=1 ${HOME} $(pwd)
+		| && sed 2>/dev/null local done | "$1" 2>/dev/null --verbose 'quoted text' "$@"
+	sed then done then | "$1" 'quoted text' "$1"
+sed 2>/dev/null | ${HOME} echo local
+	"$@" cd ${HOME} readonly sed x=1
+		${HOME} 2>/dev/null "$1" echo x=1 ${HOME} -eu
+	$(pwd) sed --verbose x=1
+		2>/dev/null sed --verbose test && "$@" -eu then x=1 -eu /usr/bin local
+		"$1" cd then then | readonly local "$@" /usr/bin
+$(pwd) readonly export awk readonly readonly ${HOME}
+/usr/bin awk readonly /usr/bin done done --verbose $(pwd)
+	$(pwd) /usr/bin sed grep cd local $(pwd) sed grep && grep ${HOME} && /usr/bin
+local test --verbose awk "$1" 2>/dev/null sed local "$@"
+"$@" echo echo sed $(pwd) | export
+		${HOME} 2>/dev/null readonly
+	then sed awk --verbose printf --verbose cd
+	sed echo test grep grep | then -eu 2>/dev/null
+		${HOME} grep /usr/bin echo --verbose --verbose "$1" grep "$@" then then
+-eu 2>/dev/null cd awk echo /usr/bin test awk awk ${HOME} ${HOME}
+	sed printf done local "$@" -eu 'quoted text' $(pwd) cd sed local
+		/usr/bin 'quoted text' readonly ${HOME}
+		test "$@" -eu grep then sed "$@" test $(pwd) local
+	printf printf 2>/dev/null printf echo /usr/bin ${HOME} $(pwd)
+	local --verbose local readonly |
+	${HOME} 'quoted text' | "$1" done
+grep local readonly "$1" echo then cd done awk 2>/dev/null then awk
+		'quoted text' x=1 then --verbose
+		done ${HOME} then local && 'quoted text' sed export
+	export printf awk test 'quoted text'
+	| /usr/bin /usr/bin awk 'quoted text' local then sed --verbose
+	${HOME} awk done then echo
+		x=1 echo "$@" && | ${HOME}
+/usr/bin grep && | $(pwd) cd local "$1" echo readonly "$@" x=1 ${HOME}
+printf printf "$1" | 2>/dev/null grep x=1 sed
+2>/dev/null readonly awk x=1 cd printf sed awk 2>/dev/null "$1" readonly
+$(pwd) "$1" awk printf test test ${HOME}
+	sed | grep --verbose then export awk 2>/dev/null awk
+done done local "$@" | printf echo
+		2>/dev/null awk sed | --verbose $(pwd) --verbose readonly
+		x=1 awk echo sed "$@" ${HOME} printf export --verbose cd sed ${HOME} 2>/dev/null
+		sed printf done && sed x=1 $(pwd) && then 2>/dev/null && --verbose
+		2>/dev/null readonly $(pwd) 2>/dev/null local 'quoted text' printf ${HOME}
+cd && --verbose 2>/dev/null 2>/dev/null
+		cd "$@" x=1 2>/dev/null --verbose cd awk
+		done ${HOME} x=1 "$@" then 'quoted text' cd then | --verbose --verbose $(pwd)
+		$(pwd) printf /usr/bin awk x=1 test echo then "$1" | "$1" x=1 'quoted text'
+${HOME} grep test test 'quoted text' readonly && sed
+		"$1" 'quoted text' x=1 --verbose test done ${HOME} done &&
+		x=1 /usr/bin awk /usr/bin awk 'quoted text' then awk 'quoted text' printf
+then -eu 'quoted text' awk printf --verbose export
+		x=1 "$1" && printf done test export export && echo awk printf echo | && --verbose
+awk /usr/bin awk cd x=1 | local ${HOME} cd printf echo
+		test "$1" x=1 printf ${HOME} local
+		$(pwd) | then "$@" test | printf
+		"$@" then sed -eu 2>/dev/null x=1 export
+/usr/bin sed | 2>/dev/null &&
+	then echo readonly sed 'quoted text' export --verbose awk
+	sed $(pwd) --verbose awk $(pwd)
+	'quoted text' cd test /usr/bin sed
+		echo then then --verbose done grep -eu readonly
+cd | export export 'quoted text' sed "$@"
+		local readonly -eu 2>/dev/null echo done | printf
+"$1" 'quoted text' printf && done ${HOME} "$1" /usr/bin awk export ${HOME}
+		grep printf -eu awk printf /usr/bin then
+	readonly "$1" 2>/dev/null "$@" -eu && printf local "$@" then local && printf
+printf done echo ${HOME}
+		-eu echo x=1 $(pwd) x=1 printf | "$1" -eu then done local then "$1" "$@"
+		readonly echo && | done /usr/bin x=1 awk then awk
+	done grep && printf then echo readonly export export local readonly cd 'quoted text'
+-eu awk grep --verbose echo readonly ${HOME}
+		echo then then awk local
+		local /usr/bin "$@" 2>/dev/null
+	awk | readonly grep then then done printf cd export
+&& readonly $(pwd) "$@" "$@" grep test done "$@" -eu |
+	-eu done $(pwd) then grep
+cd -eu echo grep sed x=1 ${HOME} sed awk $(pwd) | local printf 'quoted text'
+| | test readonly sed printf --verbose ${HOME}
+done | ${HOME} test $(pwd) | 'quoted text' test 'quoted text' --verbose $(pwd) awk
+2>/dev/null then echo sed /usr/bin echo echo 'quoted text' readonly
+		readonly test printf x=1 then awk ${HOME} "$1" --verbose
+	done printf "$1" /usr/bin test
+"$@" && x=1 | export "$@" cd cd echo test local -eu x=1 cd && printf 'quoted text'
+		printf grep sed readonly awk done done | then "$@" printf sed sed && /usr/bin
+2>/dev/null cd readonly done sed &&
+		-eu | readonly printf export
+		--verbose -eu local 2>/dev/null echo && printf sed grep | x=1 readonly --verbose
+		"$1" && export test 2>/dev/null
+		done export readonly then printf local 2>/dev/null && grep
+'quoted text' 'quoted text'
+		cd export && -eu -eu test "$@" printf then cd /usr/bin x=1 echo
+$(pwd) && x=1 $(pwd) 'quoted text' | "$1" then $(pwd) grep $(pwd)
+readonly /usr/bin cd printf
+| sed local 'quoted text' then awk $(pwd) grep sed sed
+${HOME} /usr/bin then && awk export printf done done
+	x=1 /usr/bin test cd sed | "$@" -eu
+		-eu 2>/dev/null -eu readonly -eu x=1 sed $(pwd) | local
+/usr/bin "$@" local export
+'quoted text' -eu -eu /usr/bin -eu $(pwd) echo $(pwd) | "$1" grep done
+	-eu cd "$1" -eu && 2>/dev/null -eu printf
+		echo "$1" -eu && sed awk cd ${HOME} | | /usr/bin -eu |
+-eu $(pwd) && "$1" awk x=1 grep sed
+echo && awk test awk cd test readonly cd /usr/bin 2>/dev/null
+		${HOME} x=1 printf | echo cd done
+	grep ${HOME} printf x=1 | 'quoted text' 2>/dev/null
+	"$@" done export ${HOME} export "$@" local then done ${HOME} printf 'quoted text'
+	grep local x=1 -eu 'quoted text' then printf test cd /usr/bin local
+		readonly /usr/bin test awk export
+cd grep "$1" /usr/bin printf
+	grep grep -eu readonly test ${HOME} readonly "$1" sed --verbose && -eu "$@"
+		done ${HOME} test readonly printf "$1"
+		"$1" --verbose then | ${HOME}
+--verbose "$1" test -eu echo then $(pwd) && awk 2>/dev/null test -eu
+&& export $(pwd) export awk &&
+${HOME} sed -eu 'quoted text' "$1" sed done $(pwd)
+		$(pwd) echo printf -eu export cd echo
+local $(pwd) --verbose then printf -eu --verbose awk /usr/bin echo export
+	&& test local --verbose "$1" test local && 'quoted text' && $(pwd)
+	echo /usr/bin /usr/bin -eu sed done "$@"
+		$(pwd) grep "$1" cd done "$@" 'quoted text'
+"$@" printf --verbose && | "$@" done done export
+	${HOME} sed printf "$1" readonly "$@" echo "$@" awk --verbose test readonly
+		cd x=1 grep test then printf local test grep /usr/bin readonly "$1" ${HOME}
+done printf 2>/dev/null "$1" --verbose done 2>/dev/null | $(pwd)
+		local export ${HOME} grep /usr/bin
+awk /usr/bin cd x=1 --verbose -eu $(pwd) 2>/dev/null
+	local 2>/dev/null then x=1 ${HOME} "$1"
+	${HOME} done cd --verbose "$1" done
+		then grep ${HOME} grep 'quoted text' ${HOME}
+cd printf --verbose cd -eu sed 2>/dev/null x=1
+	export "$1" ${HOME} | 'quoted text'
+awk sed echo sed ${HOME} cd -eu sed 'quoted text' test -eu done printf sed export
+		awk sed 2>/dev/null x=1 | readonly readonly ${HOME} 'quoted text'
+	grep $(pwd) done awk "$@"
+| cd done readonly cd /usr/bin then && --verbose "$1" export done cd cd
+	"$@" $(pwd) /usr/bin then test | then readonly | -eu printf
+		--verbose awk && readonly x=1
+	readonly then then "$1" cd
+echo && /usr/bin done export echo done -eu "$@" --verbose then
+	cd local grep printf readonly "$1" done /usr/bin awk $(pwd)
+		readonly export echo readonly readonly -eu
+		&& -eu readonly ${HOME} 2>/dev/null
+2>/dev/null sed | 'quoted text' 'quoted text'
+		'quoted text' $(pwd) then local ${HOME} grep ${HOME} x=1 done "$1" x=1 awk
+/usr/bin readonly test then sed && then readonly cd readonly
+		cd grep done test test --verbose readonly && && then sed --verbose
+	--verbose cd 2>/dev/null -eu test 2>/dev/null printf
+		${HOME} "$@" readonly $(pwd) test then 2>/dev/null 'quoted text'
+		"$1" 'quoted text' echo |
+2>/dev/null local 'quoted text' echo $(pwd) "$1"
+		readonly | echo "$1" "$@" $(pwd)
+'quoted text' 'quoted text'
+	| --verbose printf awk grep cd test
+		x=1 readonly done /usr/bin local && "$1" "$1"
+		| cd cd ${HOME} done /usr/bin 2>/dev/null /usr/bin | sed awk cd /usr/bin x=1 |
+readonly 'quoted text'
+	x=1 cd readonly 2>/dev/null
+| printf /usr/bin done printf
+| | ${HOME} --verbose
+awk $(pwd) /usr/bin x=1 sed ${HOME} && | printf readonly readonly -eu
+		2>/dev/null sed /usr/bin done | $(pwd) "$@"
+		grep -eu && test readonly "$1" awk echo
+		local then printf local readonly /usr/bin
+		printf -eu readonly done done | x=1 --verbose then "$@" ${HOME} x=1
+		awk grep $(pwd) ${HOME} | "$@" -eu grep
+		printf /usr/bin $(pwd) x=1 && echo
+		test test x=1 x=1 --verbose
+		sed -eu --verbose grep printf export export $(pwd) echo export 'quoted text' test
+	'quoted text' x=1 sed printf 'quoted text' $(pwd) local export --verbose
+then test --verbose export $(pwd) /usr/bin "$@" "$@" $(pwd)
+"$@" -eu test 'quoted text' -eu grep local
+${HOME} && ${HOME} sed -eu test grep cd sed "$1" "$@" printf cd local sed -eu test
+sed then readonly 2>/dev/null echo printf readonly
+		test echo "$1" then "$@"
+		grep readonly && 'quoted text' printf "$1"
+		"$1" test && local done then $(pwd) | sed ${HOME} printf -eu -eu --verbose
+	"$@" --verbose --verbose ${HOME} 2>/dev/null | readonly then local
+grep | | | ${HOME} export ${HOME} /usr/bin test sed $(pwd) grep cd grep
+sed test && -eu export $(pwd)
+		export "$@" cd && -eu
+		local grep --verbose x=1 'quoted text' readonly | sed cd $(pwd) done -eu
+	awk 'quoted text' done
+		echo grep --verbose grep "$@" |
+test 2>/dev/null x=1 sed grep && grep /usr/bin
+${HOME} awk grep ${HOME} "$1" awk "$1" awk "$1" | grep ${HOME} | export
+	readonly echo printf -eu 'quoted text' printf echo /usr/bin sed /usr/bin
+	local --verbose echo 2>/dev/null -eu grep printf
+		&& printf ${HOME} -eu "$@" $(pwd) /usr/bin ${HOME} export --verbose 'quoted text'
+	then grep test sed sed grep sed /usr/bin sed printf
+x=1 grep printf -eu x=1 done grep &&
+	$(pwd) "$1" "$1" export /usr/bin sed test
+	-eu then "$1" 'quoted text' then "$1" /usr/bin readonly --verbose
+		| grep awk 'quoted text'
+		cd ${HOME} local done 'quoted text' echo | 'quoted text' 2>/dev/null
+	done && ${HOME} then ${HOME} export --verbose && grep --verbose
+local 2>/dev/null 2>/dev/null
+		--verbose 2>/dev/null grep done awk local awk ${HOME} printf "$1" then | /usr/bin
+	test "$@" then then printf printf ${HOME} done local grep sed readonly ${HOME}
+	test export test x=1 "$@" /usr/bin "$1" "$@" --verbose
+		done awk sed then done | readonly 2>/dev/null -eu
+$(pwd) -eu printf echo -eu "$@" --verbose
+export awk awk printf echo ${HOME} echo local $(pwd) 'quoted text' 2>/dev/null
+		-eu then printf /usr/bin export grep --verbose "$1" printf
+	printf "$1" 'quoted text' sed
+readonly local readonly readonly readonly cd &&
+grep /usr/bin -eu sed test sed 2>/dev/null
+| --verbose readonly cd --verbose grep export printf -eu local
+		grep "$@" "$@" done "$@" -eu 2>/dev/null | grep export "$@"
+	local ${HOME} "$1" "$1" "$1"
+		then "$@" | test then /usr/bin 2>/dev/null $(pwd) -eu | local ${HOME} grep
+		${HOME} 2>/dev/null --verbose done && export --verbose 2>/dev/null ${HOME}
+		test test && echo cd x=1 echo printf awk 2>/dev/null 'quoted text' | grep local
+		local $(pwd) echo && && awk grep echo printf sed test "$@" | ${HOME}
+		$(pwd) grep sed grep -eu local echo
+	export $(pwd) readonly ${HOME} -eu cd echo && "$@"
+		printf grep grep | then "$1" && cd /usr/bin awk local
+		test -eu | ${HOME} "$@"
+		| | local local $(pwd) 2>/dev/null 2>/dev/null
+	&& x=1 test cd cd "$1" /usr/bin 'quoted text'
+-eu local done printf $(pwd)
+${HOME} then /usr/bin local local
+		$(pwd) | $(pwd) | /usr/bin $(pwd) export grep ${HOME} awk done x=1 test -eu 2>/dev/null
+		"$1" test && /usr/bin "$1" | then
+	/usr/bin $(pwd) then grep && ${HOME}
+	readonly sed "$@" /usr/bin sed echo ${HOME}
+		$(pwd) export grep -eu readonly -eu --verbose
+local /usr/bin echo echo && --verbose echo readonly 2>/dev/null
+	2>/dev/null done $(pwd) 'quoted text' 'quoted text' x=1 --verbose | "$@" done
+	test $(pwd) export cd readonly 2>/dev/null
+	"$@" readonly sed --verbose
+readonly sed && x=1 export
+test | | x=1 export /usr/bin sed --verbose
+		awk "$@" --verbose cd then awk awk export printf grep
+export readonly /usr/bin export cd local $(pwd) export && 'quoted text'
+	local grep $(pwd) "$@" test then awk test cd done --verbose sed x=1
+	--verbose $(pwd) && | $(pwd) echo export "$1" test $(pwd) ${HOME}
+--verbose "$@" test done printf printf
+	x=1 "$@" echo "$@" 'quoted text' /usr/bin done ${HOME} -eu x=1 ${HOME} grep
+		2>/dev/null | awk local ${HOME} $(pwd) 2>/dev/null cd ${HOME}
+	--verbose "$@" 2>/dev/null
+		readonly test grep sed ${HOME} 2>/dev/null
+	x=1 -eu grep --verbose sed "$1" awk 'quoted text' echo "$1" -eu
+		'quoted text' sed x=1 cd export --verbose x=1 -eu export echo --verbose export
+	--verbose local /usr/bin "$@" 2>/dev/null | echo x=1 test test --verbose
+readonly echo ${HOME} "$@" | cd then readonly "$@" 'quoted text'
+		"$1" --verbose echo awk | $(pwd) then echo
+	sed && 'quoted text' 2>/dev/null readonly echo -eu && printf cd cd
+	--verbose awk /usr/bin printf /usr/bin
+cd echo && cd | 'quoted text'
+		'quoted text' printf cd awk
+printf awk && export
+		sed readonly "$@" --verbose local 2>/dev/null --verbose echo readonly 'quoted text'
+	local --verbose then echo cd then cd $(pwd) 2>/dev/null -eu
+		-eu "$1" x=1 'quoted text' $(pwd) 'quoted text'
+test "$1" sed readonly done "$1"
+		cd && /usr/bin $(pwd) printf "$1" x=1 ${HOME} readonly x=1
+		-eu $(pwd) /usr/bin test readonly readonly test grep -eu export readonly
+done "$@" local ${HOME} x=1 $(pwd) "$1" cd "$@" local 2>/dev/null
+	local awk "$@" ${HOME} $(pwd) x=1 ${HOME} 'quoted text' $(pwd) sed grep ${HOME}
+	2>/dev/null grep grep awk then ${HOME} 'quoted text' -eu "$@"
+		"$1" 2>/dev/null test grep printf done && done echo $(pwd)
+		grep --verbose sed x=1 grep
+	${HOME} cd -eu /usr/bin awk grep /usr/bin readonly sed done then readonly
+		printf sed && sed "$@" grep "$1" grep then
+"$@" -eu x=1 local --verbose
+		"$1" local local x=1 /usr/bin then /usr/bin $(pwd)
+"$@" "$1" export /usr/bin $(pwd) -eu done cd done sed test && readonly
+		x=1 -eu cd then grep cd local && test readonly then printf x=1 2>/dev/null awk $(pwd)
+export "$1" grep cd grep "$@" "$1" $(pwd)
+		test printf 2>/dev/null
+	x=1 2>/dev/null then local
+		${HOME} printf x=1 printf ${HOME} printf then /usr/bin && done local 2>/dev/null
+		done --verbose awk -eu echo /usr/bin "$@"
+		grep -eu 'quoted text' "$@" "$1"
+awk 2>/dev/null printf ${HOME} 'quoted text'
+	echo grep readonly -eu export readonly echo "$@" test then done
+	${HOME} 'quoted text' "$1" printf awk local echo awk
+$(pwd) done --verbose cd done
+		grep sed "$1" "$1" awk then local readonly /usr/bin sed printf && -eu grep
+		-eu grep then done echo --verbose
+	x=1 awk --verbose "$@" --verbose
+cd 'quoted text' ${HOME}
+		awk "$1" --verbose done
+local "$@" test echo test | test export done /usr/bin "$1" x=1 $(pwd) -eu cd then
+		&& 'quoted text' then then && /usr/bin "$@" --verbose ${HOME} echo export awk
+		/usr/bin $(pwd) && x=1 ${HOME} then /usr/bin "$@" | done awk /usr/bin && x=1
+	then /usr/bin export 'quoted text' ${HOME} -eu 2>/dev/null awk sed 2>/dev/null
+		printf 2>/dev/null awk $(pwd) readonly && test
+	"$1" | readonly && export
+	sed | then sed sed | readonly readonly echo readonly && grep readonly printf cd
+${HOME} 2>/dev/null --verbose
+		--verbose | done /usr/bin $(pwd) local /usr/bin && /usr/bin printf
+	test printf --verbose readonly cd /usr/bin x=1 ${HOME} ${HOME}
+grep echo cd 2>/dev/null
+		done readonly readonly 'quoted text' then "$1" awk -eu -eu grep
+		printf awk && cd --verbose done grep 2>/dev/null readonly |
+x=1 then x=1 -eu cd 2>/dev/null /usr/bin cd | echo readonly |
+	echo "$1" sed 'quoted text' /usr/bin -eu cd export "$@" && sed "$@"
+awk printf sed $(pwd) printf 'quoted text' /usr/bin --verbose 2>/dev/null
+	readonly -eu && grep "$1" | 2>/dev/null export --verbose -eu "$@" 2>/dev/null
+	| 2>/dev/null $(pwd) cd readonly
+/usr/bin --verbose -eu
+"$@" $(pwd) then printf
+	&& | 2>/dev/null "$@" export test /usr/bin then | x=1 export -eu -eu x=1
+		readonly && done | cd awk
+	"$1" done "$@" x=1 | 2>/dev/null cd echo grep
+		sed && then sed 2>/dev/null "$1" awk "$@" 'quoted text'
+	| 'quoted text' local "$@" "$@" then cd local test
+		done "$@" grep cd /usr/bin local 'quoted text' "$1" "$@"
+/usr/bin local local awk printf ${HOME} done
+		then | $(pwd) export done
+	echo && then --verbose /usr/bin awk "$1" ${HOME} echo 2>/dev/null cd then readonly
+	sed sed done export cd && && done
+'quoted text' "$@" done 2>/dev/null
+	"$@" cd "$@" sed echo --verbose printf awk done then awk printf
+	x=1 "$1" printf done
+		--verbose cd awk echo then test export $(pwd) echo /usr/bin
+	${HOME} export sed printf done grep test /usr/bin 2>/dev/null 'quoted text'
+awk /usr/bin ${HOME} cd -eu test done 2>/dev/null
+sed test x=1 --verbose
+		echo 'quoted text' 'quoted text' printf | export --verbose x=1 awk awk "$@"
+		--verbose local printf $(pwd) cd echo --verbose x=1 /usr/bin
+	/usr/bin "$@" "$1" then 'quoted text' 2>/dev/null |
+readonly then | --verbose && ${HOME}
+grep export -eu 'quoted text' local done awk ${HOME} $(pwd) readonly | |
+	${HOME} cd test x=1 $(pwd) printf done x=1 sed local cd "$1"
+	cd --verbose $(pwd) readonly ${HOME} | --verbose | export
+		2>/dev/null "$1" readonly
+test awk sed cd /usr/bin /usr/bin local echo --verbose 2>/dev/null x=1 local
+cd /usr/bin cd $(pwd) /usr/bin echo $(pwd) echo grep -eu readonly
+awk 2>/dev/null 2>/dev/null awk printf readonly $(pwd)
+	cd done grep test done 'quoted text' then awk
+		sed printf "$1" echo && && local 2>/dev/null local
+&& done test -eu sed done grep export 2>/dev/null
+&& "$@" /usr/bin printf echo "$1"
+	x=1 "$1" --verbose "$@" x=1 -eu printf "$@"
+	${HOME} grep 2>/dev/null export printf grep grep
+	export $(pwd) ${HOME}
+done /usr/bin awk "$1" "$@" cd readonly readonly test
+		/usr/bin "$@" sed export test cd printf --verbose 2>/dev/null done -eu
+done 2>/dev/null 'quoted text' echo 'quoted text'
+		&& readonly test -eu x=1 then --verbose | --verbose printf grep
+	--verbose cd local 2>/dev/null /usr/bin
+printf 2>/dev/null 'quoted text' /usr/bin readonly
+	$(pwd) sed $(pwd) cd awk -eu x=1 cd grep /usr/bin
+	2>/dev/null readonly --verbose ${HOME} -eu 2>/dev/null local "$1" test cd
+| test ${HOME} export "$@" -eu grep done printf
+	x=1 sed | 2>/dev/null && ${HOME} ${HOME}
+	grep awk grep export ${HOME} echo && 2>/dev/null -eu /usr/bin then "$@" $(pwd)
+"$1" x=1 awk readonly awk then cd "$1" $(pwd) --verbose test cd
+	'quoted text' awk 2>/dev/null "$@" awk printf /usr/bin "$@" 'quoted text'
+2>/dev/null printf test /usr/bin $(pwd) "$1" echo
+"$@" && done awk echo 'quoted text' printf local done 'quoted text' done 2>/dev/null
+2>/dev/null --verbose grep "$@" 2>/dev/null sed
+${HOME} export export readonly echo "$@" readonly x=1 sed readonly then 2>/dev/null
+		-eu printf then --verbose
+&& done 'quoted text' /usr/bin "$@" awk echo then export printf readonly
+"$1" awk x=1 awk test x=1 sed then 2>/dev/null -eu -eu echo echo
+then test 'quoted text' -eu | 'quoted text'
+		${HOME} 2>/dev/null "$1" echo --verbose "$1" echo local sed cd echo export
+--verbose --verbose /usr/bin
+		${HOME} "$@" grep done "$1" ${HOME} grep cd
+	2>/dev/null done 2>/dev/null "$1" -eu printf && export && x=1
+	--verbose x=1 /usr/bin done local local
+	test /usr/bin 'quoted text' done 'quoted text' sed then printf ${HOME} && test
+		"$1" "$1" awk -eu /usr/bin && grep | readonly grep x=1 test x=1 done
+--verbose | sed readonly
+--verbose sed awk -eu /usr/bin && && /usr/bin x=1 /usr/bin echo $(pwd) | /usr/bin
+'quoted text' "$@" && 'quoted text' x=1 local test printf readonly export
+| "$1" done grep local |
+&& test export -eu "$1" sed "$@" 'quoted text' readonly
+	${HOME} 2>/dev/null sed test grep
+	readonly awk && 2>/dev/null -eu printf done 2>/dev/null echo --verbose
+		2>/dev/null grep -eu echo test --verbose $(pwd) awk
+then /usr/bin readonly /usr/bin | --verbose sed x=1 $(pwd) then local test
+	grep local "$1" cd cd
+${HOME} grep sed export echo grep x=1 "$@"
+readonly 'quoted text' -eu 'quoted text'
+	local --verbose done ${HOME} "$1" awk then test
+printf /usr/bin 2>/dev/null readonly test | local local test && 'quoted text' |
+sed 2>/dev/null /usr/bin -eu printf grep test | 'quoted text' "$@" readonly
+2>/dev/null export ${HOME} -eu --verbose cd sed /usr/bin printf then --verbose
+done export -eu done 2>/dev/null -eu export "$1"
+	--verbose sed echo $(pwd) -eu "$@" cd x=1 echo local x=1 ${HOME} "$1"
+	sed && awk cd 'quoted text' grep "$@" $(pwd) readonly export "$@" && test $(pwd)
+		"$@" cd awk x=1 'quoted text' 2>/dev/null /usr/bin printf grep
+		-eu printf done printf echo export cd awk printf 2>/dev/null
+	test grep --verbose "$1" /usr/bin 'quoted text' -eu local "$1"
+		cd export local | test awk readonly sed cd ${HOME} printf ${HOME} | ${HOME}
+		| done cd test /usr/bin | sed done printf
+then 'quoted text' 'quoted text' local cd && cd --verbose -eu cd
+	then readonly sed $(pwd) local then -eu -eu export grep grep | 'quoted text'
+		cd sed x=1 cd $(pwd) sed sed then /usr/bin sed && /usr/bin "$1"
+		printf $(pwd) 'quoted text' test test done /usr/bin x=1 grep cd "$@"
+		export printf --verbose 'quoted text'
+	"$1" then done $(pwd) then
+	$(pwd) test echo "$1" 2>/dev/null
+		$(pwd) 2>/dev/null "$1" test $(pwd) 2>/dev/null | export printf printf
+		&& && $(pwd) echo echo "$@" printf ${HOME}
+	"$@" "$1" "$@" sed then local 'quoted text' test echo done x=1 'quoted text'
+x=1 printf export /usr/bin local done echo "$@" local
+export printf done then done 'quoted text'
+		awk local grep "$@" | /usr/bin sed export x=1 && $(pwd) done "$1"
+		x=1 ${HOME} sed && local | "$1" then echo -eu local "$1" then done 2>/dev/null
+		grep "$1" x=1 awk --verbose cd $(pwd) 2>/dev/null 2>/dev/null
+-eu echo /usr/bin "$1" echo grep
+printf /usr/bin /usr/bin grep cd echo "$1" done printf test "$@" readonly ${HOME}
+		cd done /usr/bin test /usr/bin "$@" $(pwd) 'quoted text' 2>/dev/null
+	'quoted text' done x=1 "$1" ${HOME} grep
+then export sed $(pwd) echo
+	grep | cd /usr/bin local -eu -eu $(pwd) && && $(pwd) readonly "$@" "$1" 'quoted text'
+x=1 'quoted text' grep echo 'quoted text' test readonly 'quoted text' sed grep
+		x=1 echo grep "$1" "$1" printf
+then ${HOME} 'quoted text' cd
+	readonly 2>/dev/null ${HOME} && /usr/bin grep 2>/dev/null
+		x=1 grep then | ${HOME} echo --verbose x=1 2>/dev/null x=1
+export --verbose readonly sed "$@" then export
+		&& --verbose 2>/dev/null --verbose 2>/dev/null "$1" | /usr/bin sed sed
+	"$@" --verbose echo x=1 readonly
+		'quoted text' && && done "$@" "$1" grep done 'quoted text' readonly awk 'quoted text'
+'quoted text' then local
+		cd printf /usr/bin --verbose printf awk /usr/bin 2>/dev/null
+	awk grep awk --verbose awk cd local cd | readonly ${HOME} --verbose 'quoted text'
+		printf grep cd /usr/bin /usr/bin && $(pwd) /usr/bin readonly then local printf
+	printf $(pwd) /usr/bin awk -eu readonly | $(pwd) awk | sed
+		local x=1 done /usr/bin local | "$1" --verbose 'quoted text' --verbose
+	sed && $(pwd) test echo | x=1
+		x=1 'quoted text' 2>/dev/null | awk printf cd -eu done local x=1 test x=1
+	-eu ${HOME} test awk printf cd
+	| -eu -eu --verbose cd 'quoted text'
+$(pwd) $(pwd) then test echo grep "$1" echo local 'quoted text' then x=1
+-eu "$1" printf readonly echo | then --verbose $(pwd) awk printf -eu
+/usr/bin echo readonly "$1" test "$@" echo local export local sed 2>/dev/null
+	| 2>/dev/null sed sed grep awk /usr/bin done 2>/dev/null done export export
+		'quoted text' $(pwd) printf cd local sed ${HOME}
+		${HOME} 2>/dev/null --verbose x=1 2>/dev/null echo test &&
+2>/dev/null done local x=1 sed awk readonly awk
+	grep x=1 local echo 'quoted text'
+		| /usr/bin test -eu ${HOME} local cd printf -eu done /usr/bin
+	local local then local local printf && | -eu 'quoted text'
+done local $(pwd) test "$1" -eu then
+$(pwd) | then test --verbose awk ${HOME} "$@" awk done local -eu test
+	2>/dev/null export && 2>/dev/null awk
+		test then /usr/bin ${HOME} cd && 2>/dev/null printf awk echo "$1" readonly awk echo
+"$@" export --verbose export export done "$1" x=1
+		--verbose /usr/bin test local readonly $(pwd) -eu "$@" local then
+	export "$@" then then awk printf
+	--verbose awk printf echo x=1 export awk echo export
+printf then printf | cd local | done then 2>/dev/null test test
+echo grep sed "$1" && -eu $(pwd) 2>/dev/null test echo --verbose
+awk "$@" awk "$1" 'quoted text'
+		done grep 'quoted text' --verbose x=1 'quoted text' printf grep
+		local 'quoted text' grep done && "$1" --verbose x=1 "$1" grep 'quoted text'
+done x=1 local grep -eu grep
+		--verbose echo x=1 then
+		$(pwd) export "$@" $(pwd)
+echo printf ${HOME} readonly "$1" awk done local grep 'quoted text'
+	readonly cd && /usr/bin awk
+	-eu local 'quoted text' then export done "$1" echo awk local && done then "$@"
+	test test ${HOME} --verbose && $(pwd) "$@" /usr/bin readonly "$1"
+	"$1" readonly test echo done ${HOME} then | test then ${HOME} local local "$1"
+	${HOME} --verbose "$@" test then
+'quoted text' /usr/bin echo "$@" cd readonly
+x=1 done "$@" -eu && cd "$@" awk done test $(pwd)
+	awk done grep "$1" | export $(pwd)
+'quoted text' 2>/dev/null | $(pwd) local 2>/dev/null echo --verbose
+	2>/dev/null -eu $(pwd) cd $(pwd) export
+		/usr/bin cd /usr/bin "$@" ${HOME} ${HOME} printf sed --verbose "$1"
+		| test cd printf done
+done then "$1" grep && -eu $(pwd) --verbose $(pwd) ${HOME}
+printf 'quoted text' x=1 2>/dev/null
+"$@" --verbose /usr/bin --verbose 'quoted text' printf test && "$@" ${HOME} $(pwd)
+	sed echo "$1" && 'quoted text'
+	grep --verbose export x=1 awk
+	/usr/bin --verbose /usr/bin
+	$(pwd) awk local "$1" export echo done
+		'quoted text' 2>/dev/null
+		-eu export export "$1" then && && awk awk awk sed done
+	sed --verbose 'quoted text' 'quoted text' readonly "$@" 'quoted text' /usr/bin
+	"$1" printf test $(pwd) grep "$1" printf export cd then test && | x=1
+	grep printf 'quoted text' --verbose
+		${HOME} && --verbose awk
+export -eu 'quoted text'
+		| cd test "$1" done 'quoted text' then "$@" local test 2>/dev/null
+		| echo cd printf local awk grep 'quoted text' readonly test readonly echo cd
+		$(pwd) test local --verbose
+		then local cd echo /usr/bin
+then readonly printf printf
+		"$@" sed "$1" ${HOME} awk $(pwd) local local
+	export "$@" printf cd $(pwd)
+"$@" --verbose grep -eu --verbose /usr/bin printf "$@" echo -eu awk
+		&& printf done "$1" echo local 'quoted text' ${HOME} awk
+grep local test x=1 ${HOME} echo readonly awk then
+"$1" | sed ${HOME} sed "$1" echo x=1 $(pwd) done grep grep grep
+done 2>/dev/null /usr/bin local && /usr/bin -eu 'quoted text'
+	cd 2>/dev/null --verbose -eu "$@"
+		2>/dev/null then -eu done
+		awk grep awk done done x=1 /usr/bin export then 'quoted text'
+local grep "$1" && 2>/dev/null printf "$@" "$1" $(pwd) 'quoted text'
+		echo $(pwd) --verbose x=1 then echo readonly |
+	x=1 sed grep printf 'quoted text' x=1 | local
+-eu "$1" done /usr/bin grep test sed awk /usr/bin
+	echo export readonly ${HOME} "$1" "$1" awk 'quoted text' readonly 2>/dev/null
+		| --verbose ${HOME} --verbose export echo x=1 echo
+	-eu 2>/dev/null /usr/bin sed 'quoted text' && $(pwd) grep local | awk awk x=1
+done sed printf x=1 export x=1 x=1 local -eu echo $(pwd)
+		--verbose /usr/bin done ${HOME} "$1" --verbose /usr/bin /usr/bin
+	echo sed $(pwd) | test grep awk then grep then done
+		readonly echo sed -eu
+	awk $(pwd) x=1 ${HOME} then
+$(pwd) /usr/bin export
+	&& sed test then 'quoted text' sed x=1 --verbose "$@" ${HOME} &&
+		export sed | awk sed
+		&& x=1 "$1" --verbose awk 'quoted text'
+		--verbose cd readonly done $(pwd) grep local sed -eu --verbose
+printf done then $(pwd) | && | x=1 echo 'quoted text' echo cd 'quoted text'
+		test 'quoted text' ${HOME} -eu then printf -eu $(pwd)
+	-eu "$@" "$1" "$1" cd -eu test cd && test printf
+	grep x=1 cd -eu --verbose export test /usr/bin awk sed |
+		readonly grep ${HOME} cd "$@" | && awk sed cd sed $(pwd)
+	"$1" cd export sed echo grep "$@" local /usr/bin
+		cd /usr/bin | awk test x=1 then readonly &&
+	then "$@" "$1" local sed 'quoted text' "$@" "$@" sed 'quoted text'
+		cd "$@" local awk sed /usr/bin | 'quoted text' x=1 sed local readonly
+2>/dev/null local printf $(pwd) | --verbose $(pwd)
+	&& echo -eu cd local -eu export printf awk "$@" 'quoted text' 2>/dev/null
+	cd export $(pwd) printf
+&& ${HOME} "$1" ${HOME} | then awk && | printf -eu "$1"
+awk export echo grep -eu then
+		'quoted text' grep sed 'quoted text' x=1 --verbose "$@" "$@" /usr/bin
+--verbose | cd printf
+/usr/bin 'quoted text' /usr/bin
+	/usr/bin "$1" && x=1 x=1 | printf printf local sed local grep echo -eu "$1"
+		2>/dev/null /usr/bin | $(pwd) /usr/bin | readonly readonly echo
+	&& "$@" awk /usr/bin x=1 $(pwd) done
+--verbose awk && then | grep ${HOME} local 2>/dev/null /usr/bin local
+	test ${HOME} done "$1" grep export done cd local grep
+$(pwd) cd 2>/dev/null echo $(pwd) ${HOME} && awk -eu "$@" "$1" local && --verbose
+readonly sed --verbose echo --verbose
+		-eu done && grep awk 'quoted text'
+x=1 && test && && "$@" awk
+	$(pwd) cd 'quoted text'
+--verbose | printf sed /usr/bin ${HOME}
+	printf x=1 cd test | | -eu ${HOME} x=1 echo x=1 printf
+	echo && $(pwd) then sed cd "$@" export $(pwd) awk awk "$@" cd cd local ${HOME}
+	&& -eu | local echo "$1" $(pwd) "$@" /usr/bin
+		awk readonly sed grep echo printf ${HOME} /usr/bin export -eu echo
+done then 2>/dev/null --verbose printf
+	'quoted text' test local cd
+		&& done sed awk ${HOME} | printf x=1 then "$@" cd x=1 /usr/bin --verbose
+	${HOME} $(pwd) test x=1 done done "$@" 2>/dev/null x=1 2>/dev/null
+	--verbose -eu $(pwd) export ${HOME} && readonly | && 'quoted text'
+-eu test --verbose -eu then cd 2>/dev/null
+'quoted text' | local "$@" local "$1" x=1 --verbose
+	"$@" -eu x=1 then -eu | $(pwd) export $(pwd) awk "$1"
+awk test ${HOME} awk readonly done
+	sed x=1 test --verbose $(pwd) printf | 2>/dev/null --verbose
+	awk done -eu ${HOME} sed echo "$@" printf then 2>/dev/null local 2>/dev/null
+		/usr/bin && 'quoted text'
+	export cd && done 2>/dev/null
+2>/dev/null grep ${HOME} echo then local cd ${HOME} local local readonly
+	/usr/bin --verbose grep
+-eu 2>/dev/null done 2>/dev/null
+		readonly readonly test test "$@"
+		2>/dev/null then readonly "$1" 2>/dev/null $(pwd) 2>/dev/null
+'quoted text' | 2>/dev/null test export | "$@" sed "$1" export grep sed then
+		sed /usr/bin echo echo
+		echo grep cd /usr/bin "$@" test
+		local grep test 'quoted text' | sed && printf done test | -eu
+	then 2>/dev/null sed printf local
+	"$1" sed "$@" 'quoted text' 'quoted text' cd printf
+--verbose "$1" grep then
+	${HOME} readonly x=1 --verbose sed --verbose grep $(pwd) test 'quoted text'
+	cd done grep sed $(pwd) printf && "$1" --verbose then "$@" done export
+	| local | echo awk "$1" export ${HOME} done && cd
+${HOME} then 'quoted text' /usr/bin
+echo printf printf /usr/bin cd sed awk printf
+	readonly "$@" cd echo export && /usr/bin && | local
+	awk echo 2>/dev/null echo $(pwd) cd then x=1 then "$1" cd local 2>/dev/null
+	$(pwd) --verbose local "$@" printf $(pwd)
+		2>/dev/null "$1" readonly done cd grep grep
+	/usr/bin ${HOME} $(pwd) ${HOME} grep "$@" "$@" ${HOME} cd x=1 then $(pwd) -eu
+		&& then then export && |
+	2>/dev/null | local "$@" x=1 | /usr/bin |
+	sed readonly --verbose 2>/dev/null
+	| | 2>/dev/null ${HOME} awk 2>/dev/null x=1 then x=1 readonly local cd x=1
+2>/dev/null readonly /usr/bin export "$@" test && -eu "$1" readonly
+	cd awk export ${HOME}
+/usr/bin 'quoted text' then
+		x=1 echo "$@" && ${HOME} then
+test then 2>/dev/null cd done -eu "$1"
+printf $(pwd) -eu grep readonly then && 'quoted text' "$@" then
+		-eu then ${HOME} readonly $(pwd) 'quoted text'
+'quoted text' && /usr/bin sed done 2>/dev/null --verbose "$@" --verbose | /usr/bin
+	local 2>/dev/null --verbose | sed echo | | export local
+${HOME} awk ${HOME} echo $(pwd) done sed 2>/dev/null ${HOME} $(pwd)
+	'quoted text' ${HOME} echo 'quoted text' 'quoted text' 2>/dev/null
+	/usr/bin | $(pwd) "$1" echo cd sed test sed test /usr/bin local $(pwd) 2>/dev/null
+awk done readonly --verbose 2>/dev/null then printf test /usr/bin local local
+export --verbose "$1" /usr/bin /usr/bin sed $(pwd) cd -eu
+	--verbose done && "$@"
+'quoted text' readonly readonly sed "$1" sed && done grep echo -eu printf
+		-eu readonly sed cd "$1" cd | $(pwd) 2>/dev/null
+		readonly /usr/bin "$1" x=1 then printf ${HOME} export
+	echo test && | && echo grep export x=1 test sed cd --verbose 'quoted text' ${HOME}
+		local printf then readonly done grep readonly "$@" $(pwd)
+${HOME} /usr/bin cd && ${HOME} "$1"
+	"$@" 2>/dev/null echo x=1 2>/dev/null
+		&& 2>/dev/null readonly grep /usr/bin
+		"$@" export "$@" sed printf $(pwd)
+	cd printf 'quoted text' cd | then then "$1" readonly
+		$(pwd) --verbose printf printf test $(pwd) $(pwd) then
+	x=1 ${HOME} -eu test | export export 'quoted text' ${HOME} local && export "$1"
+		x=1 2>/dev/null readonly echo -eu grep /usr/bin
+grep | "$@" "$1" x=1 export && readonly 'quoted text' -eu readonly
+	grep $(pwd) sed "$@" "$1" export done
+	local printf export local export printf
+	awk "$@" ${HOME} && done then ${HOME} grep
+	x=1 "$@" --verbose grep -eu 2>/dev/null readonly
+		awk printf cd "$1" -eu
+cd local x=1 && local | grep "$@" readonly $(pwd) sed done export 'quoted text'
+	done 'quoted text' "$1" export local -eu then awk
+	done 'quoted text' export
+	-eu then done $(pwd) -eu 'quoted text' cd export && test "$@" /usr/bin
+$(pwd) 2>/dev/null "$@" 2>/dev/null --verbose test
+	printf local cd echo | ${HOME} cd echo grep 2>/dev/null awk then cd
+echo --verbose local readonly
+sed $(pwd) && && export /usr/bin local && $(pwd) 'quoted text' grep --verbose
+grep $(pwd) --verbose $(pwd) printf then export ${HOME} | 'quoted text'
+sed printf local "$@"
+	echo | ${HOME} export "$@" -eu "$1" echo awk $(pwd)
+		test grep -eu -eu --verbose done sed --verbose $(pwd) sed echo "$@" x=1
+	sed "$@" local printf -eu $(pwd) echo readonly grep 2>/dev/null
+	awk printf printf sed "$1" then --verbose test
+		/usr/bin ${HOME} $(pwd) export export then export sed test
+		then x=1 printf printf test --verbose export "$@" sed 'quoted text'
+	cd --verbose export export "$@" ${HOME} done done x=1 2>/dev/null export sed
+	-eu 2>/dev/null | test printf grep 'quoted text' echo grep | readonly
+		done | local 2>/dev/null && echo | sed grep ${HOME} grep x=1 /usr/bin ${HOME}
+	--verbose 2>/dev/null export $(pwd) "$1" "$1" export grep x=1
+	printf 2>/dev/null cd x=1 x=1
+export echo --verbose x=1 export ${HOME} test && printf /usr/bin x=1 -eu
+	$(pwd) test grep $(pwd) "$1" sed x=1 export export --verbose ${HOME} 'quoted text'
+		then grep awk x=1 x=1 | "$@" sed awk ${HOME}
+	${HOME} $(pwd) | test $(pwd) readonly "$1" "$1" ${HOME} 2>/dev/null awk $(pwd)
+		readonly sed awk echo test awk /usr/bin then ${HOME} x=1 sed $(pwd) then readonly
+	'quoted text' /usr/bin readonly 'quoted text'
+	readonly --verbose then ${HOME} then then $(pwd) readonly $(pwd) /usr/bin --verbose
+local ${HOME} 2>/dev/null sed local cd "$@" 'quoted text' done grep local ${HOME}
+	"$1" ${HOME} && x=1 | --verbose | --verbose
+	&& sed then cd grep $(pwd) cd "$@" cd --verbose
+	then && test /usr/bin 'quoted text' && x=1 grep -eu | done readonly export
+echo && sed sed "$@" awk export local --verbose cd grep awk
+	awk grep export export $(pwd) echo --verbose
+		&& --verbose 'quoted text' cd && then ${HOME} sed $(pwd) --verbose
+		--verbose printf done -eu $(pwd) awk test && 'quoted text' done awk ${HOME}
+	-eu then export "$1" "$1" -eu | awk /usr/bin printf readonly
+		"$1" -eu x=1 cd -eu x=1 'quoted text' test --verbose
+'quoted text' 'quoted text' printf /usr/bin -eu 'quoted text' |
+cd printf "$1" 'quoted text' x=1 local
+	"$1" test ${HOME} echo echo
+		${HOME} readonly done awk export local "$@"
+echo "$@" then then 2>/dev/null $(pwd) "$1" 'quoted text' 'quoted text' &&
+	awk test $(pwd) then done awk printf && printf readonly printf done awk ${HOME}
+	'quoted text' cd 'quoted text' ${HOME}
+sed grep $(pwd) -eu 'quoted text'
+		sed "$1" cd $(pwd) test | -eu "$@" | $(pwd) then local --verbose local
+	${HOME} -eu "$@" | | then sed awk 2>/dev/null
+		then | "$@" x=1 | ${HOME} -eu "$@" --verbose
+	'quoted text' printf | done $(pwd) -eu test cd ${HOME} export
+&& printf printf $(pwd) grep --verbose readonly "$1" awk readonly echo awk
+"$@" awk cd then "$@" $(pwd) local local
+	test /usr/bin ${HOME} test awk 'quoted text' export /usr/bin | ${HOME} "$1" export
+	"$1" readonly grep 2>/dev/null
+		readonly sed export "$@" /usr/bin printf test
+	&& /usr/bin x=1 grep grep "$1" cd done printf && && "$@" sed
+/usr/bin | ${HOME} printf && then $(pwd) && /usr/bin
+done /usr/bin $(pwd) | $(pwd) done ${HOME} printf | done x=1
+		sed $(pwd) "$1" ${HOME} $(pwd) /usr/bin echo "$1" printf
+	echo readonly ${HOME} grep local export "$@" sed awk
+	done 2>/dev/null "$@" local "$1" readonly export local local
+		&& /usr/bin | grep awk
+		printf -eu grep grep | -eu local
+		${HOME} 2>/dev/null printf done cd ${HOME} cd && then --verbose
+		awk | x=1 export local $(pwd) "$@" -eu -eu readonly grep cd then && test /usr/bin
+	&& -eu $(pwd) $(pwd) export "$1" 'quoted text' then $(pwd) 2>/dev/null x=1 --verbose
+		"$@" echo printf done done 2>/dev/null ${HOME} export 'quoted text'
+	--verbose x=1 awk test 'quoted text' printf && | 'quoted text' awk
+		readonly /usr/bin /usr/bin grep then ${HOME} cd $(pwd)
+printf --verbose && printf grep
+"$@" x=1 'quoted text' 'quoted text' grep awk $(pwd) sed local awk
+$(pwd) 'quoted text'
+		x=1 grep export /usr/bin local "$@" -eu | | "$1" ${HOME} printf x=1 test 2>/dev/null
+		/usr/bin printf readonly && --verbose sed $(pwd) "$@" grep echo local sed
+	'quoted text' sed export 2>/dev/null readonly $(pwd) && test --verbose
+	"$@" | cd 2>/dev/null x=1 export /usr/bin 'quoted text' echo /usr/bin cd local
+"$@" | awk done printf "$@" local
+echo test test test then cd local "$1" test -eu
+		--verbose 'quoted text' readonly 2>/dev/null | $(pwd) echo readonly local cd
+	done grep /usr/bin test local ${HOME} cd 'quoted text' cd printf 2>/dev/null
+		'quoted text' done "$1" grep printf local
+${HOME} test "$1" export echo
+		| awk "$1" "$1" "$1" 'quoted text' then 2>/dev/null x=1 cd && "$1" test then export
+	2>/dev/null sed $(pwd) "$@" "$1" grep cd /usr/bin done 2>/dev/null $(pwd) printf
+&& ${HOME} | test $(pwd) | awk x=1 awk -eu
+	test $(pwd) /usr/bin "$@" -eu "$@" 2>/dev/null "$1" "$1"
+		"$@" "$@" cd echo then sed test
+'quoted text' /usr/bin sed --verbose 'quoted text' sed grep
+	x=1 'quoted text' -eu --verbose readonly test echo 2>/dev/null
+| 'quoted text' ${HOME} -eu "$@" cd --verbose "$1" "$@" done $(pwd)
+${HOME} sed awk cd grep
+	awk grep && $(pwd) && echo | "$1"
+local $(pwd) "$1" /usr/bin /usr/bin x=1 sed then /usr/bin
+		awk local local then 'quoted text' export && test "$@" 'quoted text' ${HOME}
+		test then cd then printf /usr/bin --verbose export -eu && echo
+		&& x=1 -eu printf "$@" echo ${HOME}
+	x=1 grep x=1 export ${HOME} grep readonly grep -eu awk
+		cd 2>/dev/null done then "$1" local --verbose test done "$1" | x=1
+	x=1 "$1" ${HOME} 2>/dev/null /usr/bin
+		-eu | sed --verbose readonly
+		printf ${HOME} cd done sed ${HOME} 'quoted text'
+		&& sed echo local grep awk --verbose -eu grep 'quoted text' $(pwd) /usr/bin
+test "$1" grep | -eu local
+		-eu cd 2>/dev/null sed -eu echo x=1 "$1" x=1 local export printf echo "$@"
+		cd cd x=1 /usr/bin --verbose
+done --verbose && ${HOME} x=1 $(pwd) local sed readonly
+	"$@" --verbose printf awk awk sed /usr/bin && echo awk cd
+		/usr/bin -eu then done "$1" grep then sed "$@"
+&& 'quoted text' | $(pwd) $(pwd)
+		readonly 2>/dev/null | ${HOME} then x=1 cd test 2>/dev/null
+		export awk && /usr/bin --verbose readonly grep export echo echo x=1 "$@" "$@"
+2>/dev/null export readonly 'quoted text' test && "$1" grep "$1" x=1 "$1" 2>/dev/null
+| local | printf local &&
+	readonly 'quoted text' export cd grep done | local done test &&
+	--verbose test /usr/bin grep printf
+--verbose -eu 2>/dev/null
+	cd "$@" -eu done "$@" export --verbose 'quoted text' 2>/dev/null
+sed $(pwd) then $(pwd) 2>/dev/null x=1 /usr/bin 'quoted text'
+then --verbose "$1" ${HOME} && "$1" test 2>/dev/null
+x=1 -eu 'quoted text' "$@" local done done -eu echo --verbose local export
+cd then export readonly printf export
+		then then --verbose "$@" -eu
+		"$@" local x=1 then $(pwd) readonly cd
+$(pwd) 'quoted text' awk -eu -eu $(pwd) local sed cd "$1" "$1"
+	then sed cd --verbose test "$@" ${HOME} x=1
+echo then -eu --verbose /usr/bin grep printf "$1" awk done --verbose
+	2>/dev/null ${HOME} then ${HOME} && --verbose "$@" && grep cd x=1 export /usr/bin
+	cd x=1 'quoted text' test && awk done cd && ${HOME} cd /usr/bin
+export "$1" -eu export sed x=1 2>/dev/null --verbose 2>/dev/null
+export local local test done
+2>/dev/null 'quoted text' printf ${HOME} export --verbose readonly
+		| local local $(pwd) local export
+	readonly grep x=1 && 2>/dev/null ${HOME} echo awk export echo cd "$@"
+	&& -eu readonly awk done "$@" --verbose done ${HOME} $(pwd) /usr/bin
+readonly /usr/bin --verbose 2>/dev/null
+		x=1 grep "$1" awk readonly printf local "$1" -eu $(pwd) x=1
+		echo ${HOME} done printf printf "$1" x=1 && 2>/dev/null ${HOME} --verbose "$@" |
+	sed ${HOME} 'quoted text'
+		| | awk && x=1 x=1 readonly
+sed 2>/dev/null local sed echo 2>/dev/null -eu "$@"
+		sed grep && 'quoted text' then x=1 grep then export
+	-eu done --verbose grep printf
+/usr/bin 2>/dev/null grep "$1" readonly sed -eu $(pwd) grep awk
+-eu "$@" export 2>/dev/null readonly export "$1"
+	test && ${HOME} | awk x=1 --verbose cd awk && "$1" -eu
+	readonly readonly /usr/bin $(pwd) "$@" done 2>/dev/null
+	--verbose --verbose echo awk done then ${HOME} grep
+		local 2>/dev/null --verbose
+		-eu /usr/bin done /usr/bin ${HOME} /usr/bin export /usr/bin && 'quoted text'
+		${HOME} /usr/bin $(pwd)
+	"$1" printf -eu then awk 2>/dev/null sed 'quoted text'
+test && echo ${HOME}
+awk && export | awk --verbose 'quoted text' -eu
+	echo cd 2>/dev/null awk local
+| test export "$1" echo sed echo export "$1"
+done 'quoted text' then | sed awk sed -eu | export ${HOME} local
+	&& $(pwd) ${HOME} 'quoted text' --verbose
+		done readonly echo test done x=1 awk 'quoted text' local awk 2>/dev/null then
+| -eu cd "$1" cd local | printf test $(pwd) --verbose sed
+	-eu printf printf | $(pwd) 2>/dev/null printf /usr/bin
+		printf x=1 done done then readonly local
+	"$1" readonly && sed then echo echo printf 'quoted text' test
+sed 2>/dev/null grep 2>/dev/null readonly
+		"$@" export test x=1 | readonly
+test x=1 $(pwd) sed readonly --verbose 2>/dev/null -eu x=1 -eu 2>/dev/null
+	"$1" 'quoted text' grep | 2>/dev/null
+		--verbose /usr/bin echo export --verbose
+$(pwd) sed export x=1 done local echo export
+2>/dev/null awk local $(pwd) echo -eu grep ${HOME} test ${HOME} then
+	-eu && 'quoted text' printf grep && grep export ${HOME} |
+cd grep printf x=1 ${HOME} export $(pwd) ${HOME} 'quoted text' &&
+	printf sed $(pwd) readonly readonly && -eu echo
+'quoted text' /usr/bin && /usr/bin awk awk --verbose readonly 2>/dev/null
+	echo test cd 2>/dev/null test test /usr/bin done local sed export /usr/bin
+--verbose then awk done -eu -eu /usr/bin sed printf echo "$1" "$@" &&
+		"$1" x=1 export local cd done 2>/dev/null "$1" export
+grep awk "$1" grep ${HOME} test done awk printf "$1" "$@" readonly 2>/dev/null
+$(pwd) sed export readonly x=1 printf 2>/dev/null -eu sed -eu cd 2>/dev/null
+	${HOME} 2>/dev/null && -eu -eu cd -eu printf test local $(pwd)
+		then "$1" $(pwd) local readonly printf
+test grep test $(pwd) --verbose printf export "$1"
+		sed 'quoted text' x=1
+		test then "$@" -eu --verbose sed 'quoted text'
+	'quoted text' sed readonly 'quoted text'
+		2>/dev/null $(pwd) awk export /usr/bin echo readonly
+$(pwd) -eu && /usr/bin 'quoted text' x=1
+cd "$1" 2>/dev/null grep -eu "$@" export echo "$1" cd
+		local "$1" "$@" then -eu echo 2>/dev/null sed echo export $(pwd) | export 2>/dev/null
+	"$1" then ${HOME} echo 'quoted text' /usr/bin |
+		/usr/bin --verbose test "$1" -eu 2>/dev/null 'quoted text' sed ${HOME} &&
+		grep cd test && grep grep grep "$@" grep 2>/dev/null 2>/dev/null
+		"$@" cd sed --verbose awk x=1 x=1 export ${HOME}
+	done 2>/dev/null | then && then /usr/bin test
+		$(pwd) readonly 2>/dev/null ${HOME} sed
+then && then then --verbose
+echo 'quoted text' && sed sed test
+		$(pwd) grep sed && awk ${HOME} -eu ${HOME} printf $(pwd) 'quoted text'
+x=1 $(pwd) printf then sed cd local then echo "$1" $(pwd) printf
+	then ${HOME} then -eu -eu printf /usr/bin
+		x=1 2>/dev/null --verbose readonly grep && && --verbose awk /usr/bin ${HOME}
+		2>/dev/null then echo export readonly
+		done sed readonly readonly $(pwd) printf $(pwd) printf
+/usr/bin grep readonly $(pwd) done /usr/bin $(pwd) test echo x=1 test
+	-eu && | 'quoted text' awk local local /usr/bin
+--verbose done test test | | ${HOME} then $(pwd) --verbose
+	&& 2>/dev/null echo -eu x=1 ${HOME} && printf --verbose done echo
+		grep -eu $(pwd) --verbose printf /usr/bin echo
+		cd "$1" cd cd 'quoted text' awk 2>/dev/null
+	done && | then done "$@" readonly readonly done test sed -eu local readonly
+		readonly $(pwd) 'quoted text' test test -eu readonly 2>/dev/null
+		cd "$@" && echo grep ${HOME}
+		"$1" cd local "$1" && done readonly | /usr/bin $(pwd)
+		&& --verbose printf x=1 2>/dev/null 2>/dev/null
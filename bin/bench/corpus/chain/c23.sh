@@ -0,0 +1,2001 @@
+		${HOME} readonly local readonly
+	done then test 'quoted text' ${HOME} cd
+		--verbose then "$@" x=1 'quoted text' -eu grep
+test local grep grep test
+${HOME} local --verbose test --verbose cd "$1"
+		cd grep then --verbose grep "$@" grep grep -eu ${HOME} cd
+	&& then cd printf readonly | awk sed grep done 2>/dev/null printf $(pwd) then
+x=1 2>/dev/null then local local test 'quoted text'
+	export printf then 'quoted text' printf cd cd export /usr/bin local $(pwd)
+&& 'quoted text' grep test test
+printf && | readonly | "$1" 'quoted text' $(pwd) local export /usr/bin
+	test echo test "$@" $(pwd) local 2>/dev/null readonly done 'quoted text' x=1 |
+	/usr/bin && "$@" && ${HOME} printf 2>/dev/null echo 'quoted text'
+awk /usr/bin then --verbose 2>/dev/null then printf && sed
+x=1 | then readonly $(pwd) readonly awk --verbose
+	test && $(pwd) export -eu sed "$1" -eu then grep then 2>/dev/null
+		done done 2>/dev/null 2>/dev/null $(pwd) cd test cd && "$@"
+	--verbose "$1" grep 'quoted text' echo sed test
+printf /usr/bin && then
+	cd "$1" x=1 readonly echo sed printf /usr/bin 2>/dev/null
+readonly 'quoted text' "$1" test | done printf | test local readonly x=1 2>/dev/null
+	"$1" -eu cd test 2>/dev/null then
+		cd $(pwd) done cd /usr/bin readonly export export --verbose local
+		test awk readonly then then sed
+		x=1 ${HOME} | 'quoted text' cd /usr/bin "$1" | /usr/bin
+then readonly done local 2>/dev/null readonly
+"$1" ${HOME} test "$@"
+/usr/bin && -eu cd "$@" test "$@" printf
+	${HOME} done echo printf | test 2>/dev/null 2>/dev/null grep x=1 $(pwd)
+		grep && grep printf "$1"
+-eu sed printf -eu echo awk -eu -eu ${HOME} /usr/bin
+done test ${HOME} $(pwd) | readonly readonly export grep printf
+cd | echo echo echo && echo test "$@" "$@" "$1" | && awk
+${HOME} && --verbose
+	/usr/bin printf --verbose export $(pwd) grep
+	--verbose "$1" "$1" "$1" then awk 2>/dev/null /usr/bin grep 'quoted text'
+done echo cd export cd then "$1" grep && 2>/dev/null |
+	${HOME} ${HOME} echo sed | 'quoted text'
+	"$@" then readonly printf "$@" 'quoted text' x=1 "$1"
+grep x=1 test | printf $(pwd)
+		awk 'quoted text' | x=1 && echo cd 2>/dev/null cd 'quoted text'
+"$1" printf | export | grep awk readonly && readonly -eu cd cd grep "$@"
+done | && sed export $(pwd) then | printf grep --verbose 2>/dev/null local
+		printf | readonly local cd /usr/bin
+cd -eu 'quoted text' readonly | 2>/dev/null
+		-eu grep 2>/dev/null cd "$@" -eu | 'quoted text' readonly 2>/dev/null
+	/usr/bin $(pwd) export readonly "$@" then awk "$1" done 2>/dev/null
+	| then printf -eu | /usr/bin awk local ${HOME} &&
+	x=1 then done && /usr/bin -eu export printf -eu -eu export readonly x=1 sed printf
+	grep -eu grep /usr/bin then awk
+		/usr/bin sed done | "$1" local "$1" cd readonly test export readonly "$@" sed
+-eu "$@" "$1" "$1" | printf --verbose then test sed
+	2>/dev/null --verbose x=1 then awk --verbose "$@"
+		echo | | printf ${HOME} done ${HOME}
+	then test awk /usr/bin 'quoted text'
+		&& "$1" grep 2>/dev/null test "$1" 'quoted text' sed export
+		export sed "$@" done | then ${HOME}
+	awk sed | then | cd 'quoted text' cd && && $(pwd) && printf local printf | test
+	export then ${HOME} | 'quoted text' && 2>/dev/null sed printf ${HOME}
+	echo sed --verbose x=1 "$@" sed printf test
+	--verbose --verbose awk -eu test cd cd "$@" local -eu "$@" 2>/dev/null
+done "$@" cd "$1" "$@" grep && "$@" $(pwd) ${HOME} then then "$1" echo
+		sed echo grep | done -eu cd | export local
+	then 'quoted text' 2>/dev/null
+		| "$1" && awk -eu cd "$1" sed done sed local | $(pwd) --verbose then 'quoted text'
+		cd /usr/bin grep ${HOME} cd | x=1 ${HOME} && readonly 2>/dev/null done
+	-eu "$1" printf ${HOME} -eu x=1
+	echo 'quoted text' "$@" /usr/bin
+	'quoted text' awk 2>/dev/null grep done
+readonly 2>/dev/null "$@" echo test done awk readonly $(pwd) local
+	then readonly -eu /usr/bin awk test 'quoted text' 2>/dev/null 'quoted text'
+		then -eu 'quoted text' && awk grep then x=1 readonly
+local | echo ${HOME} cd test --verbose
+	export | "$@" grep "$1" cd echo done && awk done | | printf -eu done export
+		grep 'quoted text' cd
+		&& done "$@" export /usr/bin "$@" && "$1" 2>/dev/null
+	"$@" 'quoted text' "$@" | local cd ${HOME} done
+$(pwd) awk sed 2>/dev/null
+sed 2>/dev/null local test done
+		echo -eu awk awk | x=1 2>/dev/null | local 'quoted text'
+		done ${HOME} | then $(pwd) echo -eu 2>/dev/null "$@" printf then "$1" 'quoted text'
+	'quoted text' local echo x=1 "$@" -eu local $(pwd) "$1" echo
+		sed 'quoted text' "$@" | | && | "$1" | $(pwd) echo x=1 local 2>/dev/null test --verbose
+	awk /usr/bin ${HOME} -eu readonly && && /usr/bin cd sed /usr/bin x=1 'quoted text'
+readonly printf --verbose "$@" awk done readonly done 2>/dev/null awk
+	'quoted text' done ${HOME} -eu "$@" cd | 'quoted text' done -eu
+sed readonly local ${HOME} echo && done x=1 grep grep
+sed "$@" export $(pwd) readonly ${HOME} readonly --verbose
+	sed | ${HOME} "$1" --verbose done $(pwd) local export --verbose
+		test printf && "$@" done test test "$1" /usr/bin
+		cd printf && export echo $(pwd) cd $(pwd) && done
+local cd local grep local local
+		--verbose -eu sed 'quoted text' -eu && | export then
+		printf && /usr/bin x=1 -eu sed awk cd done awk cd /usr/bin
+		done "$@" "$@" done /usr/bin 2>/dev/null then x=1 ${HOME} awk
+	"$1" cd --verbose printf echo 'quoted text' &&
+	--verbose cd cd awk --verbose printf sed 'quoted text' sed
+done test --verbose cd readonly done ${HOME} sed
+"$@" && ${HOME} "$@" | 2>/dev/null /usr/bin "$1" /usr/bin sed local done grep
+	export grep sed -eu done
+	export export export then local echo x=1 /usr/bin "$@" grep export local
+	--verbose test grep 2>/dev/null export echo && grep 2>/dev/null done $(pwd) &&
+| -eu | printf printf sed | /usr/bin -eu --verbose "$1" -eu cd echo | 2>/dev/null
+| $(pwd) "$1" x=1 done $(pwd) --verbose
+2>/dev/null sed done then $(pwd) | $(pwd) test | readonly awk
+		| cd done ${HOME} then -eu export /usr/bin $(pwd) readonly echo awk
+		then local export "$@"
+		"$1" awk grep $(pwd) awk printf readonly /usr/bin
+	"$1" sed done && | echo printf "$@" readonly test ${HOME} grep | sed $(pwd)
+grep echo sed echo $(pwd) echo then local "$@" sed /usr/bin
+sed local && x=1 ${HOME} grep "$1" grep /usr/bin "$@" grep
+export /usr/bin x=1 && ${HOME} then
+		"$@" x=1 test awk 'quoted text' then awk then
+		&& export $(pwd) "$1" grep /usr/bin "$1" --verbose echo
+	$(pwd) 2>/dev/null 'quoted text' local export && awk export "$@" sed $(pwd) awk
+		sed --verbose "$@" cd
+		then 'quoted text' export 'quoted text' export done grep
+sed done cd && | && test /usr/bin /usr/bin /usr/bin test
+		done grep cd $(pwd) "$1" --verbose then
+x=1 "$1" local awk printf ${HOME} sed then /usr/bin
+x=1 done "$1" | printf x=1 x=1 awk && done | ${HOME} -eu /usr/bin echo
+		/usr/bin 2>/dev/null x=1 2>/dev/null 2>/dev/null | export awk done
+	--verbose x=1 ${HOME} grep grep --verbose | /usr/bin
+		grep done awk $(pwd) local | /usr/bin awk awk ${HOME} then 'quoted text'
+	x=1 "$1" done echo readonly
+		sed cd "$1" /usr/bin 2>/dev/null
+	readonly "$1" done ${HOME} && 2>/dev/null "$1" echo /usr/bin 'quoted text'
+	"$@" readonly "$1" x=1 "$@" 'quoted text'
+grep test --verbose done /usr/bin $(pwd) test "$1" printf cd grep && | "$1"
+		"$@" && x=1 "$1" then then "$1" printf ${HOME}
+		--verbose readonly -eu "$1" | printf 2>/dev/null ${HOME} ${HOME} --verbose
+	grep cd && then 2>/dev/null readonly --verbose
+		test "$@" grep 'quoted text' test readonly ${HOME}
+	export "$1" -eu test cd cd local --verbose
+		$(pwd) && ${HOME} cd printf x=1 2>/dev/null /usr/bin 2>/dev/null
+		--verbose /usr/bin test local /usr/bin
+local export awk -eu ${HOME} then grep 2>/dev/null export && sed cd local
+		echo export done 'quoted text' printf /usr/bin readonly
+	"$@" awk "$@" "$@" then && awk --verbose
+		$(pwd) printf test ${HOME} -eu done echo printf readonly
+	grep local ${HOME} local local awk 2>/dev/null /usr/bin awk
+		$(pwd) echo test 2>/dev/null x=1
+	'quoted text' ${HOME} 'quoted text'
+		/usr/bin /usr/bin 2>/dev/null /usr/bin $(pwd) cd echo
+'quoted text' "$@" test x=1 sed && local 2>/dev/null && ${HOME}
+	$(pwd) 2>/dev/null | printf && cd
+		sed 'quoted text' local $(pwd) "$1" $(pwd) then sed printf
+		2>/dev/null test readonly "$@" $(pwd) sed
+grep readonly sed 2>/dev/null local echo && export 'quoted text' test 2>/dev/null
+		| awk -eu echo echo echo cd 'quoted text' $(pwd) readonly 'quoted text' awk &&
+	sed echo echo sed local export awk cd grep test 2>/dev/null x=1 grep
+	sed echo 2>/dev/null 'quoted text' --verbose sed && local ${HOME} sed "$1" "$1"
+	$(pwd) cd readonly | awk --verbose local
+		done | --verbose printf sed then "$@"
+	x=1 | grep "$1" then local test sed test /usr/bin done echo done
+| done sed ${HOME} ${HOME} 'quoted text'
+		then 'quoted text' && ${HOME} then grep ${HOME}
+--verbose test local echo awk
+	grep done "$1" sed "$1" "$1" -eu /usr/bin | x=1 local
+	| 'quoted text' done | printf 2>/dev/null 'quoted text' grep grep
+&& "$1" export sed "$1" -eu --verbose readonly -eu then $(pwd) done awk then
+"$1" "$@" "$@" x=1 export then
+		local readonly echo && echo test $(pwd) readonly printf awk --verbose
+${HOME} echo --verbose then | export "$1" "$@" awk &&
+		&& --verbose then printf awk
+	awk /usr/bin $(pwd) test $(pwd)
+	x=1 && printf done 'quoted text' $(pwd) -eu grep then echo
+		&& printf awk 'quoted text' "$@" sed --verbose echo grep sed "$@" /usr/bin
+readonly "$@" 'quoted text'
+awk 2>/dev/null done "$1" 'quoted text' printf printf
+	printf "$@" $(pwd) 2>/dev/null local sed export readonly local echo /usr/bin
+		then printf echo awk $(pwd) awk $(pwd) $(pwd) 2>/dev/null test
+	"$@" "$@" grep /usr/bin local
+"$1" 2>/dev/null printf done --verbose && "$1" $(pwd) printf readonly "$1"
+		--verbose -eu --verbose then
+then cd 2>/dev/null awk /usr/bin ${HOME} test && readonly
+sed then cd awk cd && x=1 printf awk "$@" echo -eu x=1 readonly ${HOME}
+	sed sed 'quoted text' $(pwd) readonly -eu local /usr/bin "$@"
+--verbose awk $(pwd) 'quoted text'
+	2>/dev/null "$1" printf awk test sed
+		sed x=1 local printf echo ${HOME} test awk
+	"$@" readonly test cd $(pwd)
+--verbose ${HOME} 2>/dev/null sed printf grep export readonly
+local export --verbose echo x=1
+	done test then $(pwd) 'quoted text'
+| local -eu test x=1 "$@" export
+		-eu 2>/dev/null echo "$1" | x=1 readonly grep awk "$@" 'quoted text'
+'quoted text' "$1" "$1" local awk -eu "$@" awk $(pwd)
+		done x=1 --verbose 'quoted text'
+		2>/dev/null local 'quoted text' then 'quoted text' -eu && printf --verbose
+	${HOME} ${HOME} cd && -eu sed readonly then | 'quoted text'
+		readonly done done readonly
+		sed /usr/bin /usr/bin sed 'quoted text' awk grep echo && $(pwd) ${HOME} &&
+	${HOME} "$@" grep printf "$@" sed export cd $(pwd) printf awk "$@" awk printf
+		$(pwd) "$1" test x=1 readonly 'quoted text' test x=1 && ${HOME} --verbose
+		/usr/bin readonly grep
+	test echo awk | | test /usr/bin done readonly 2>/dev/null
+&& && test --verbose test printf export readonly local
+		test test && | sed echo test -eu
+		2>/dev/null /usr/bin awk done ${HOME}
+		2>/dev/null cd done printf then then "$@" --verbose
+		/usr/bin 2>/dev/null local x=1 --verbose
+cd x=1 && "$1" "$@" test --verbose echo
+	/usr/bin 2>/dev/null echo printf local --verbose -eu $(pwd) readonly
+export 2>/dev/null "$@"
+		done $(pwd) sed export 'quoted text' --verbose done && cd then then -eu
+export "$@" | x=1 sed grep $(pwd) 2>/dev/null
+	grep ${HOME} -eu "$1" "$@" x=1 $(pwd)
+		"$1" "$1" && export readonly done sed
+	grep done && readonly 2>/dev/null printf /usr/bin then cd
+		${HOME} $(pwd) ${HOME} printf cd x=1 grep echo
+	local done $(pwd) x=1 readonly local echo 'quoted text' | && | echo printf
+--verbose cd && local
+	local echo | then && && test then
+		&& "$1" test then "$@" local test 2>/dev/null
+	printf 'quoted text' grep
+	'quoted text' ${HOME} -eu && test --verbose x=1 done 2>/dev/null then
+${HOME} sed "$1" done readonly
+-eu grep && export "$1" ${HOME} --verbose export
+/usr/bin sed awk then --verbose 2>/dev/null sed 'quoted text' | awk $(pwd)
+"$1" ${HOME} -eu printf cd export --verbose 2>/dev/null sed local "$@"
+		sed && /usr/bin cd done -eu 2>/dev/null readonly
+		"$@" echo 2>/dev/null sed $(pwd) awk
+test $(pwd) 'quoted text' x=1 -eu && x=1 printf $(pwd) | 2>/dev/null
+		then awk | cd --verbose printf
+	&& $(pwd) -eu 'quoted text' printf ${HOME} printf
+2>/dev/null then && /usr/bin export cd x=1 cd ${HOME} grep 'quoted text'
+test local ${HOME} test "$@" x=1 test 2>/dev/null
+		--verbose sed done $(pwd) -eu 'quoted text' ${HOME}
+&& then "$1" echo export /usr/bin export cd | 'quoted text'
+		done readonly | x=1 /usr/bin "$@"
+	sed -eu local /usr/bin grep && local --verbose
+	done awk test -eu export -eu | /usr/bin 'quoted text'
+	--verbose 'quoted text' test sed ${HOME} x=1 "$@" test --verbose
+--verbose -eu -eu -eu --verbose "$@" "$1" -eu done 'quoted text'
+	${HOME} "$1" "$1" printf 'quoted text' readonly 2>/dev/null grep grep
+	/usr/bin readonly $(pwd) "$@" 'quoted text' awk -eu readonly ${HOME}
+local then "$1" echo /usr/bin echo readonly then done
+		echo /usr/bin --verbose x=1 "$@" --verbose
+echo && $(pwd) printf export 'quoted text' echo --verbose
+		| readonly /usr/bin done 2>/dev/null printf ${HOME}
+awk --verbose readonly grep export $(pwd)
+	'quoted text' /usr/bin awk echo done $(pwd) $(pwd) &&
+		${HOME} local awk local local 2>/dev/null
+	'quoted text' ${HOME} | export "$@" test test printf echo grep
+| -eu | 'quoted text' /usr/bin --verbose 'quoted text'
+		'quoted text' && sed x=1
+done cd printf export ${HOME} local && export awk -eu "$1" x=1 -eu
+		done grep $(pwd) | grep local && test echo "$@"
+		test grep x=1 -eu 'quoted text' sed local done then "$@" cd test readonly
+	awk 'quoted text' test | echo local printf $(pwd) $(pwd) readonly
+	test && | grep echo printf -eu -eu && "$1" /usr/bin --verbose "$@" $(pwd) -eu sed
+"$@" export --verbose | printf awk readonly local /usr/bin export echo ${HOME}
+	x=1 && sed awk then 2>/dev/null 'quoted text'
+	| -eu then 'quoted text' -eu local
+	| awk --verbose x=1 sed "$1" ${HOME} grep awk --verbose 2>/dev/null cd "$1" export
+readonly && "$1" -eu "$@" --verbose "$1" test && echo x=1 printf done printf
+	grep --verbose $(pwd) 2>/dev/null && local export --verbose grep sed
+-eu ${HOME} echo export --verbose -eu && ${HOME} export echo $(pwd)
+	echo /usr/bin 2>/dev/null sed test readonly
+		"$@" awk x=1 "$1" readonly local test | ${HOME} echo --verbose
+sed x=1 awk x=1 test x=1 ${HOME} 'quoted text' local done echo export && "$@"
+then "$1" "$1" "$1" local /usr/bin
+		"$@" grep -eu ${HOME} /usr/bin
+	$(pwd) readonly done grep
+	-eu -eu x=1 test test grep 2>/dev/null awk |
+x=1 readonly ${HOME} test
+"$1" awk | ${HOME} test x=1
+	$(pwd) readonly readonly grep 2>/dev/null awk "$1"
+		printf test grep | $(pwd) "$@"
+readonly /usr/bin && cd "$1" test 2>/dev/null
+		| x=1 2>/dev/null -eu /usr/bin
+"$1" $(pwd) then | test 'quoted text' x=1 x=1 "$@" local grep --verbose
+		| ${HOME} sed 'quoted text' && readonly cd export sed
+	echo -eu export local 'quoted text' ${HOME}
+-eu awk printf "$@" /usr/bin 'quoted text'
+		"$@" ${HOME} --verbose grep x=1 -eu local ${HOME} done local | test "$@"
+		awk then ${HOME} grep echo && -eu then $(pwd) test && | export local
+		$(pwd) 'quoted text' export &&
+		"$1" local then grep sed && sed sed "$@" sed
+		grep /usr/bin echo sed 2>/dev/null local awk 'quoted text'
+		--verbose /usr/bin printf 'quoted text' sed awk --verbose $(pwd) export "$1"
+		readonly "$@" export done
+	'quoted text' grep done && echo /usr/bin
+done export done -eu /usr/bin "$1" | echo done --verbose echo |
+	x=1 sed export awk | 'quoted text' test grep 'quoted text'
+		test readonly -eu readonly "$1" 2>/dev/null 'quoted text' && test /usr/bin
+	then -eu done -eu then -eu local $(pwd) done sed
+"$@" ${HOME} --verbose printf
+		&& echo x=1 export | then
+		test local 'quoted text' && echo | 2>/dev/null sed export
+test export | test --verbose 2>/dev/null --verbose done $(pwd) -eu
+test then sed awk | && grep --verbose sed then local 'quoted text' 'quoted text'
+		sed $(pwd) echo test ${HOME} export printf grep export echo grep readonly
+done local 'quoted text' then "$@" awk 2>/dev/null cd cd ${HOME} then
+	$(pwd) --verbose -eu 2>/dev/null local && 'quoted text'
+		sed | 'quoted text' 'quoted text' cd "$1"
+		&& awk 'quoted text' printf x=1 local x=1 ${HOME} "$@" readonly
+'quoted text' test | | | sed ${HOME} grep test echo -eu
+		${HOME} export ${HOME} then 'quoted text' then "$1" 'quoted text'
+		--verbose && then x=1 ${HOME} cd 2>/dev/null $(pwd)
+readonly local x=1 'quoted text' local 2>/dev/null ${HOME} test 'quoted text'
+		awk printf "$1" cd "$@" | awk done $(pwd)
+		/usr/bin grep /usr/bin ${HOME} done done | grep
+	local done && "$@" printf awk test export export sed sed
+		readonly && /usr/bin readonly then echo -eu done echo | test 2>/dev/null
+then "$@" | local awk /usr/bin printf | && cd awk && test
+--verbose sed x=1 /usr/bin
+		awk /usr/bin awk readonly cd sed /usr/bin
+export printf sed x=1 printf printf 'quoted text' export then then && && /usr/bin
+	then ${HOME} test grep readonly --verbose sed "$@" -eu "$1" done x=1 awk --verbose
+"$@" readonly awk ${HOME} grep "$1" local
+| local $(pwd) local x=1 export export readonly test
+export done readonly export && grep "$@" echo -eu -eu test 'quoted text'
+		done printf ${HOME} readonly x=1 $(pwd) cd cd sed
+&& $(pwd) | $(pwd) ${HOME} -eu awk x=1 readonly
+	printf echo echo sed printf "$@" -eu /usr/bin test test $(pwd)
+		printf /usr/bin ${HOME} "$1" /usr/bin printf export readonly echo echo readonly
+awk then "$@" 'quoted text' printf then
+'quoted text' $(pwd) x=1 awk $(pwd) echo "$1" ${HOME} 'quoted text'
+sed --verbose "$1" /usr/bin local
+		2>/dev/null sed grep x=1 && sed done done
+${HOME} sed && local export
+test --verbose done | sed done
+	grep $(pwd) echo --verbose --verbose
+		/usr/bin local -eu |
+	export echo -eu awk x=1 awk local
+		test --verbose -eu sed done sed grep
+cd readonly -eu /usr/bin then 'quoted text' sed
+	sed "$@" "$@" --verbose -eu $(pwd)
+local sed x=1 x=1 then printf done then
+		| /usr/bin /usr/bin sed -eu then --verbose readonly
+	--verbose /usr/bin printf echo && "$1" x=1 done "$1" x=1 /usr/bin
+	-eu test printf done sed | && export "$1" grep then done readonly
+		--verbose cd | "$1" awk 'quoted text'
+"$1" x=1 x=1 test 'quoted text'
+	${HOME} 2>/dev/null --verbose "$1" && export
+| "$@" "$@" done x=1 sed export && $(pwd) then export
+	echo 'quoted text' test echo cd "$@" --verbose
+done then --verbose ${HOME} 2>/dev/null --verbose local /usr/bin 'quoted text'
+		--verbose echo awk $(pwd) then
+	printf local /usr/bin readonly --verbose x=1 /usr/bin ${HOME} grep test grep local
+done 2>/dev/null x=1 readonly && printf echo --verbose echo local readonly
+		grep $(pwd) x=1 "$1" 'quoted text' ${HOME}
+	sed echo 'quoted text' test readonly
+		awk cd done "$@" "$@" echo && done test export -eu done sed grep local -eu
+		&& -eu awk grep cd && ${HOME} done && printf
+		x=1 --verbose done 2>/dev/null
+		awk local "$@" export echo $(pwd) printf -eu /usr/bin | x=1
+	done export sed local 2>/dev/null -eu printf then sed echo && cd | printf
+		x=1 "$@" printf && awk | cd awk ${HOME} ${HOME} 2>/dev/null
+		-eu --verbose readonly awk cd cd --verbose && ${HOME} $(pwd)
+	awk x=1 readonly sed x=1 printf 'quoted text' /usr/bin test "$1" printf x=1
+cd 2>/dev/null && "$1" awk $(pwd) sed
+	${HOME} local readonly cd local echo -eu
+	$(pwd) readonly grep --verbose
+	"$@" grep cd x=1 test awk 2>/dev/null done "$1" grep grep
+		/usr/bin -eu --verbose "$@" -eu local
+		echo local cd readonly x=1 "$1" printf ${HOME} printf "$@" --verbose
+		'quoted text' awk -eu "$1"
+		test readonly 2>/dev/null awk sed printf --verbose export $(pwd) cd local
+		grep grep cd test readonly | 'quoted text' 2>/dev/null "$@" awk /usr/bin
+		awk sed echo 2>/dev/null
+	"$1" $(pwd) readonly printf cd then
+	grep awk "$@" "$@" ${HOME}
+		readonly grep -eu test "$@" -eu --verbose printf readonly && awk done
+		"$1" /usr/bin grep ${HOME} "$@" local awk | | test sed
+	'quoted text' local then 'quoted text'
+	| && "$1" "$@" x=1 x=1 && "$1" grep x=1 -eu local readonly |
+export x=1 /usr/bin | awk x=1 x=1 test test readonly export awk sed
+		printf export cd export echo grep && "$@" $(pwd)
+then local export sed echo grep --verbose
+done 2>/dev/null "$@" "$@" 'quoted text' "$1" done export /usr/bin
+	"$@" test ${HOME} sed cd /usr/bin
+	"$1" "$@" printf | 2>/dev/null $(pwd) cd "$@"
+		'quoted text' cd | ${HOME} echo
+/usr/bin -eu export echo "$@" "$@" test awk -eu $(pwd) test x=1
+		printf local 'quoted text' grep
+	export /usr/bin ${HOME} test export sed ${HOME} test test x=1
+	grep done printf cd echo | -eu awk grep sed export --verbose sed --verbose "$@"
+		${HOME} x=1 echo test --verbose --verbose && printf ${HOME} cd 2>/dev/null
+	| "$@" awk $(pwd) "$1" cd ${HOME} x=1 --verbose "$1" printf
+	cd printf 2>/dev/null grep then
+	2>/dev/null x=1 'quoted text' && sed
+		$(pwd) grep grep sed x=1 readonly sed
+		| && 'quoted text' "$@" "$1" grep printf 2>/dev/null && -eu -eu
+"$@" x=1 done sed /usr/bin && then local grep ${HOME}
+		-eu cd && local grep cd ${HOME} printf --verbose printf
+	readonly cd ${HOME} -eu sed 2>/dev/null
+	&& x=1 --verbose 2>/dev/null
+	cd awk echo echo "$@" ${HOME} --verbose /usr/bin test $(pwd)
+		| "$1" 'quoted text' $(pwd) $(pwd) -eu done readonly export ${HOME} printf
+sed echo 'quoted text' 'quoted text' printf local printf done /usr/bin done
+	echo readonly | test "$1" /usr/bin | readonly 2>/dev/null --verbose "$1"
+	local "$1" "$1" echo export readonly grep cd done -eu | then sed $(pwd)
+		done export "$@" /usr/bin
+grep 2>/dev/null grep printf $(pwd) 2>/dev/null
+printf && "$@" export ${HOME} local | done
+		2>/dev/null && printf printf
+&& /usr/bin awk x=1 --verbose 'quoted text' awk | | local 'quoted text' ${HOME}
+export cd test printf grep 2>/dev/null
+		"$1" | $(pwd) | cd $(pwd) /usr/bin cd done
+2>/dev/null $(pwd) grep then && done 2>/dev/null
+		export 2>/dev/null echo readonly -eu 2>/dev/null 'quoted text' echo $(pwd)
+		cd local /usr/bin $(pwd) cd grep "$1" done
+		"$1" /usr/bin export "$@" local
+		sed cd echo readonly |
+--verbose local printf then then && x=1 ${HOME} export -eu export
+		"$@" then 'quoted text' awk $(pwd) sed then sed x=1 -eu "$@"
+	"$@" done test ${HOME}
+	test readonly x=1 sed test ${HOME} 2>/dev/null | /usr/bin test
+		--verbose /usr/bin /usr/bin 2>/dev/null 'quoted text'
+		then test echo x=1 cd readonly done "$@" $(pwd) x=1 2>/dev/null 2>/dev/null
+	local /usr/bin echo x=1 then export sed "$@" "$@" echo
+&& sed done "$@" grep printf "$1" then "$1" done x=1 && printf
+		"$1" echo printf /usr/bin then /usr/bin then done grep printf 2>/dev/null -eu
+		grep | x=1 then $(pwd) | --verbose
+		"$@" echo readonly && 2>/dev/null -eu grep cd cd /usr/bin
+	-eu 'quoted text' -eu "$1" readonly
+"$1" done then "$1" awk readonly local ${HOME} printf $(pwd) grep && -eu 2>/dev/null
+| ${HOME} && | && export test readonly
+	2>/dev/null grep x=1 | readonly sed "$1" awk /usr/bin readonly sed done test
+-eu then $(pwd) printf echo
+		'quoted text' $(pwd) --verbose 'quoted text' then test sed -eu awk then |
+		| done /usr/bin $(pwd) x=1 "$1" 'quoted text' "$1" /usr/bin /usr/bin ${HOME} cd
+	| local -eu test "$@"
+		awk --verbose "$@" then grep
+		test done x=1 readonly $(pwd) ${HOME} && then 2>/dev/null
+-eu cd x=1 && ${HOME} awk ${HOME} x=1 echo 'quoted text'
+$(pwd) done grep --verbose local export grep done && 2>/dev/null
+		readonly test 'quoted text' $(pwd) /usr/bin readonly ${HOME}
+	cd ${HOME} | done cd test local
+cd 'quoted text' printf ${HOME} "$@" && sed
+	done sed $(pwd) grep && "$@" local /usr/bin
+		/usr/bin local x=1 | 2>/dev/null cd grep 2>/dev/null --verbose 'quoted text'
+	awk x=1 grep x=1 grep then 'quoted text'
+export readonly /usr/bin
+		echo "$1" printf --verbose 'quoted text' --verbose
+	awk | x=1 test ${HOME} ${HOME} readonly ${HOME} | local local cd /usr/bin sed printf
+		readonly then && | && printf x=1 -eu x=1 $(pwd) then --verbose echo
+readonly x=1 --verbose && && "$1" cd then then 'quoted text'
+	export readonly sed test
+		grep x=1 echo readonly -eu | -eu local /usr/bin done ${HOME}
+	done | awk "$1" awk "$@" sed grep $(pwd) test local 2>/dev/null
+	'quoted text' export grep awk printf
+&& /usr/bin then echo done -eu then "$@" then
+	x=1 then export $(pwd) cd then echo x=1
+/usr/bin /usr/bin /usr/bin 'quoted text'
+	printf export export 'quoted text' | cd && cd ${HOME} | --verbose &&
+		cd echo local $(pwd) readonly then awk sed export $(pwd) x=1 grep
+	then done cd awk cd cd /usr/bin $(pwd) sed /usr/bin x=1 local &&
+		--verbose --verbose 'quoted text'
+	| "$@" --verbose readonly -eu ${HOME}
+-eu grep x=1 readonly /usr/bin
+		--verbose readonly test echo awk awk "$1" export done echo &&
+		sed 'quoted text' ${HOME} local -eu readonly
+		cd 2>/dev/null $(pwd) "$1" 'quoted text' | echo echo x=1 "$1" $(pwd)
+		done ${HOME} x=1 /usr/bin then printf --verbose
+	echo test "$1" readonly echo cd /usr/bin
+	'quoted text' echo echo && 'quoted text' done export x=1 readonly
+'quoted text' && local awk ${HOME} 'quoted text' local -eu test "$@" done
+"$@" | x=1 sed "$1" export x=1 --verbose export | "$1"
+--verbose 'quoted text' test ${HOME} "$@" export
+		done 2>/dev/null ${HOME} cd local
+		test awk readonly export echo grep | printf local export ${HOME} readonly done
+cd | "$@" readonly 2>/dev/null local echo sed "$1" -eu /usr/bin
+local test readonly sed local
+	done /usr/bin then echo -eu | awk -eu cd done 2>/dev/null --verbose
+/usr/bin test awk awk 2>/dev/null "$@" grep -eu "$@" printf 'quoted text' done
+	--verbose then $(pwd) $(pwd) printf $(pwd) cd test
+local sed sed test x=1 | sed ${HOME} && cd
+	sed 'quoted text' | ${HOME} --verbose readonly local
+		then readonly local sed then cd test 'quoted text' grep readonly local
+$(pwd) -eu readonly 2>/dev/null printf done /usr/bin done
+x=1 export | grep echo sed "$1" test x=1
+	x=1 local echo cd /usr/bin && echo "$@" | readonly sed "$@" $(pwd) done readonly
+		cd x=1 /usr/bin done awk test awk | 'quoted text' printf $(pwd) --verbose /usr/bin
+-eu local sed | done 'quoted text' -eu 2>/dev/null
+		echo export sed awk && /usr/bin -eu readonly
+		awk done x=1 cd echo test grep awk done
+'quoted text' done readonly awk 'quoted text'
+	done 'quoted text' then 2>/dev/null $(pwd) awk echo printf
+	"$1" x=1 && "$@" -eu awk x=1 /usr/bin printf $(pwd) --verbose printf cd "$@"
+"$@" | ${HOME} local printf test | && sed cd "$1" done test $(pwd)
+${HOME} test 2>/dev/null "$@" test && ${HOME} 2>/dev/null
+x=1 test readonly $(pwd) printf && test "$1" test /usr/bin
+"$1" test x=1 sed ${HOME} /usr/bin local then ${HOME} echo "$@" test
+		done echo && done --verbose 'quoted text' grep "$@" echo test "$1" ${HOME}
+	readonly x=1 | && awk "$1" readonly x=1 "$@" sed sed done awk printf echo 2>/dev/null
+printf export x=1 -eu awk x=1 x=1
+export printf grep done "$1" 'quoted text' | sed && 2>/dev/null
+	"$1" then "$@" "$@" export printf --verbose local done printf /usr/bin "$1"
+	then cd "$@" done x=1 | readonly $(pwd) $(pwd) done grep
+	printf "$@" "$@" grep test grep && -eu 2>/dev/null "$1"
+then -eu cd grep then
+export awk "$1" "$1" then cd awk 2>/dev/null
+	echo local | sed x=1 ${HOME} printf 'quoted text' then && "$1" | ${HOME}
+sed echo test $(pwd) $(pwd)
+		$(pwd) printf grep && "$@" awk printf test echo export ${HOME} then grep local
+/usr/bin local grep && 'quoted text' printf --verbose
+	-eu then test /usr/bin | $(pwd) "$1" sed test /usr/bin
+		export echo 2>/dev/null /usr/bin then x=1 grep -eu
+echo 2>/dev/null ${HOME} printf 2>/dev/null
+		local sed cd 2>/dev/null printf
+		sed done 'quoted text' then printf then grep x=1 echo printf | sed cd /usr/bin
+then -eu sed /usr/bin done $(pwd) 'quoted text'
+x=1 then --verbose /usr/bin readonly
+$(pwd) grep --verbose 'quoted text'
+		local grep export -eu sed | | ${HOME} test then -eu
+echo done sed "$1" --verbose 'quoted text'
+		"$1" --verbose done 2>/dev/null printf done local --verbose
+	-eu && local test | ${HOME} ${HOME} | printf test printf echo -eu 'quoted text'
+	"$@" local -eu sed cd awk ${HOME}
+	--verbose printf test -eu
+awk --verbose echo grep sed done -eu sed done ${HOME} test test
+	printf awk readonly "$1" && test done 'quoted text'
+'quoted text' $(pwd) echo --verbose
+	export x=1 done 2>/dev/null local
+		-eu $(pwd) "$@" printf
+	done $(pwd) ${HOME} ${HOME} ${HOME} "$1" 2>/dev/null grep test && sed
+"$1" | --verbose "$@" export && "$@" local awk printf $(pwd)
+grep local printf 'quoted text' local x=1 test
+"$@" echo && 2>/dev/null grep "$@" cd "$@" 'quoted text' local readonly readonly
+	x=1 cd -eu cd $(pwd) export $(pwd)
+		$(pwd) sed test grep awk printf /usr/bin done && awk
+/usr/bin local 2>/dev/null | test x=1 "$1" sed "$1" cd ${HOME} cd
+	sed test local | $(pwd) --verbose "$1" 2>/dev/null cd &&
+	"$1" grep ${HOME} awk sed /usr/bin $(pwd) then cd test test 2>/dev/null
+${HOME} grep /usr/bin then then
+'quoted text' test | /usr/bin
+	x=1 2>/dev/null cd printf x=1 |
+	test 2>/dev/null --verbose cd printf awk cd ${HOME} | then local --verbose
+	test grep | printf $(pwd)
+	test && grep sed sed -eu x=1 export test grep cd --verbose && $(pwd)
+		2>/dev/null -eu grep ${HOME}
+&& sed 2>/dev/null local ${HOME} test local done "$@" sed $(pwd) &&
+${HOME} | readonly grep sed |
+	'quoted text' printf --verbose awk 'quoted text' | then cd && sed test 'quoted text'
+		x=1 then /usr/bin awk ${HOME} sed $(pwd)
+	'quoted text' ${HOME} x=1 x=1 /usr/bin --verbose grep
+x=1 echo export && sed | | printf && $(pwd) done 2>/dev/null awk -eu 'quoted text'
+		test done export awk awk export 'quoted text' then done export
+		cd test && -eu ${HOME} | cd -eu x=1 grep sed readonly local -eu export 'quoted text'
+	x=1 local local awk ${HOME} readonly local then /usr/bin local 'quoted text'
+readonly "$1" $(pwd) local 2>/dev/null cd $(pwd)
+echo x=1 'quoted text' 'quoted text'
+test echo grep /usr/bin sed 2>/dev/null $(pwd) grep then
+	2>/dev/null $(pwd) x=1 awk ${HOME} ${HOME} test "$@" "$1" readonly
+grep readonly 'quoted text' then printf
+		"$@" /usr/bin 'quoted text' cd done
+	"$@" "$1" local x=1 test 'quoted text' done done echo |
+-eu | readonly echo test then
+	cd test --verbose $(pwd) $(pwd) /usr/bin echo sed x=1
+		2>/dev/null cd done "$@" x=1 /usr/bin
+	${HOME} awk echo -eu 'quoted text' sed echo then
+	'quoted text' awk echo 'quoted text' 'quoted text'
+done $(pwd) -eu readonly done
+	"$@" && && cd --verbose
+then test export && readonly
+		-eu test test test grep "$1" ${HOME} grep awk x=1 2>/dev/null sed --verbose
+	-eu readonly ${HOME} awk 'quoted text' /usr/bin --verbose
+export /usr/bin done /usr/bin "$1" $(pwd) /usr/bin 'quoted text'
+echo 2>/dev/null sed --verbose sed
+		$(pwd) echo printf local echo done 2>/dev/null $(pwd) grep /usr/bin --verbose
+		awk cd -eu sed readonly sed printf --verbose -eu readonly -eu
+-eu cd ${HOME} --verbose done 'quoted text'
+		then awk grep -eu readonly done
+"$@" && && --verbose
+x=1 test /usr/bin grep -eu ${HOME} -eu echo export --verbose sed
+grep printf sed export /usr/bin $(pwd) awk echo echo awk grep
+| export echo awk done printf
+		printf --verbose | | done 'quoted text' --verbose && --verbose
+"$1" test cd grep /usr/bin printf 2>/dev/null
+	'quoted text' "$1" export export local "$@" 2>/dev/null 2>/dev/null ${HOME}
+	'quoted text' echo grep printf cd awk
+local local awk ${HOME} sed sed "$1" export
+$(pwd) "$1" export done 'quoted text'
+		2>/dev/null printf $(pwd) && printf && --verbose | "$1" 'quoted text'
+	2>/dev/null then "$@" | readonly readonly -eu 'quoted text' local export
+	'quoted text' test test export "$@" "$@"
+	"$1" awk readonly /usr/bin awk export export 'quoted text'
+		'quoted text' "$1" sed export then
+	&& x=1 $(pwd) -eu cd --verbose sed done --verbose then echo echo done echo | -eu
+		| grep 2>/dev/null readonly
+	'quoted text' x=1 done $(pwd) printf
+sed $(pwd) printf echo readonly /usr/bin 2>/dev/null test 'quoted text'
+"$@" $(pwd) readonly sed cd local | |
+	--verbose sed "$1" local "$@" ${HOME} printf export && && /usr/bin
+export x=1 echo $(pwd) cd readonly && readonly | test done grep
+	${HOME} && echo echo /usr/bin grep | 'quoted text' x=1 awk awk
+	done 2>/dev/null test && "$1" -eu awk test
+	awk $(pwd) 2>/dev/null $(pwd) $(pwd)
+	local -eu --verbose printf -eu export awk 2>/dev/null sed
+2>/dev/null $(pwd) done 'quoted text' cd -eu local printf "$1" awk test
+/usr/bin -eu --verbose && test then 'quoted text' echo
+cd local -eu readonly grep "$@" $(pwd) export printf
+	x=1 ${HOME} test 'quoted text' && "$1" ${HOME} done | then &&
+	test -eu local && 2>/dev/null
+| "$1" && readonly | "$1" echo cd awk local awk && sed
+		done 2>/dev/null export local /usr/bin /usr/bin
+	grep "$1" readonly x=1 $(pwd) | then
+| cd awk cd awk readonly 2>/dev/null awk ${HOME} sed && grep done local
+printf export | sed test echo done x=1
+	sed export test printf --verbose 2>/dev/null readonly
+"$1" awk awk awk awk local | sed sed -eu $(pwd) readonly x=1 x=1 ${HOME}
+	2>/dev/null /usr/bin awk 'quoted text' | echo awk x=1 --verbose
+	local awk test local && && done export
+"$1" ${HOME} "$1" then awk test sed then grep 'quoted text'
+		-eu echo sed done ${HOME} test -eu
+		grep test /usr/bin then sed printf ${HOME}
+		cd 'quoted text' then export && readonly -eu /usr/bin
+		/usr/bin && 'quoted text' printf
+		test "$1" x=1 readonly | "$1" sed "$@" done echo echo
+done --verbose /usr/bin $(pwd) x=1 test awk done local
+x=1 cd | local test "$1" awk
+		done sed | echo $(pwd) grep
+	grep grep sed readonly readonly cd /usr/bin && printf --verbose
+		echo grep echo --verbose "$@"
+	'quoted text' --verbose cd grep -eu sed --verbose $(pwd) ${HOME}
+	"$@" awk && "$@" | sed sed "$1" "$@" local 'quoted text'
+cd test $(pwd) ${HOME} --verbose /usr/bin x=1 "$@" -eu 2>/dev/null
+	grep export local --verbose 2>/dev/null
+		&& 2>/dev/null readonly export --verbose cd "$@" local then cd /usr/bin local cd
+		"$@" x=1 test echo export "$@" --verbose
+		"$1" awk sed echo $(pwd) 'quoted text' done
+done "$1" && then local --verbose "$1" | -eu grep cd
+		printf printf readonly && $(pwd) export "$@" awk local ${HOME} local | then
+	then x=1 $(pwd) 2>/dev/null $(pwd)
+	$(pwd) grep awk -eu | -eu "$@" awk readonly $(pwd)
+	${HOME} cd then echo $(pwd)
+	done $(pwd) /usr/bin local local ${HOME} x=1
+		printf printf "$@" 'quoted text' cd /usr/bin x=1 -eu
+		'quoted text' test export cd "$1" --verbose x=1 "$1" test awk
+	awk printf "$1" --verbose /usr/bin local grep sed printf export "$@" --verbose export
+	awk 'quoted text' ${HOME} | readonly 2>/dev/null awk done
+	"$@" "$@" "$1" printf "$@" ${HOME} ${HOME} local "$@" --verbose
+| test sed test && ${HOME} awk --verbose
+	awk cd "$@" sed grep cd | done "$1" $(pwd) test sed x=1 test | x=1 readonly --verbose
+	| cd done 2>/dev/null x=1 "$@" /usr/bin cd -eu echo export 'quoted text'
+		cd local grep "$1" -eu grep -eu /usr/bin
+-eu && awk printf sed /usr/bin $(pwd) readonly ${HOME}
+	awk test 2>/dev/null then && done
+&& done "$1" x=1 test export printf "$1" done printf
+	done 'quoted text' $(pwd)
+done grep local && "$@" && | cd
+		export -eu echo -eu "$@"
+$(pwd) then then readonly "$1" --verbose done x=1 grep
+		then done "$1" -eu x=1 "$1" 2>/dev/null "$@" "$@" -eu
+	"$1" && grep readonly echo 'quoted text' printf --verbose
+	$(pwd) --verbose "$@" "$@"
+| $(pwd) awk "$@" x=1 export | readonly local | 2>/dev/null readonly export /usr/bin
+	| $(pwd) 2>/dev/null export x=1 ${HOME} && test cd 'quoted text' test ${HOME}
+		export && /usr/bin sed $(pwd) --verbose $(pwd) then
+	export -eu | 2>/dev/null grep 2>/dev/null done --verbose
+		test export --verbose "$@" sed ${HOME} echo
+2>/dev/null grep done export
+x=1 $(pwd) local then --verbose sed --verbose
+		echo --verbose then sed then printf then
+		cd awk readonly test then 'quoted text' 2>/dev/null cd | awk 'quoted text' printf
+	printf 'quoted text' ${HOME} echo export local /usr/bin local $(pwd) x=1
+cd cd export "$1" | local && x=1 $(pwd) readonly
+	test then --verbose cd export $(pwd)
+	${HOME} grep done 2>/dev/null done printf cd printf && export 2>/dev/null
+grep -eu sed $(pwd) "$1"
+		$(pwd) readonly x=1 /usr/bin
+	--verbose && sed cd | --verbose | -eu -eu then -eu cd | --verbose | "$@"
+		/usr/bin test x=1 readonly readonly ${HOME} -eu echo echo
+$(pwd) /usr/bin "$1" printf "$@" awk then /usr/bin awk readonly /usr/bin
+x=1 /usr/bin /usr/bin awk 'quoted text'
+cd then grep ${HOME} ${HOME} | sed readonly 2>/dev/null
+		2>/dev/null local cd $(pwd) "$@" 2>/dev/null
+	cd "$@" && -eu 'quoted text' | $(pwd) 'quoted text' cd /usr/bin
+	sed 2>/dev/null local then echo
+	export | awk cd 2>/dev/null test grep && local awk done printf
+		done && done "$@" -eu x=1 awk printf local "$1" local then grep
+done export --verbose "$@" x=1 x=1 test --verbose readonly
+		printf 2>/dev/null echo local cd x=1 done x=1 grep -eu x=1 sed test ${HOME}
+	test --verbose /usr/bin readonly | | readonly awk && "$@" local export done
+	echo printf sed done ${HOME} readonly
+export awk local x=1 $(pwd) | "$@" cd awk 'quoted text' test -eu readonly
+	"$1" x=1 'quoted text' -eu test local
+		2>/dev/null grep "$@" 'quoted text' readonly cd
+	${HOME} echo -eu test | 2>/dev/null "$1" echo awk && test grep ${HOME} printf printf
+-eu export -eu readonly -eu export export
+		grep grep local 'quoted text' "$@" printf && sed | printf
+		grep && done && $(pwd) ${HOME} grep local "$@" /usr/bin
+	${HOME} cd && local cd x=1 readonly sed local
+	then 'quoted text' --verbose cd -eu
+	local | 'quoted text' | export test
+	sed ${HOME} "$@" $(pwd) grep then ${HOME} && cd cd cd x=1 /usr/bin
+		| --verbose ${HOME} done 'quoted text' then $(pwd) test
+printf $(pwd) export ${HOME} echo 'quoted text' sed grep done local awk ${HOME}
+--verbose local x=1 -eu cd | x=1
+		"$@" readonly && echo -eu echo "$@"
+echo "$@" sed readonly 'quoted text' printf 2>/dev/null /usr/bin
+	| ${HOME} then printf local sed then -eu grep 'quoted text'
+		--verbose ${HOME} "$1"
+printf -eu --verbose grep test done cd -eu done echo printf && 'quoted text'
+		$(pwd) test | readonly awk readonly -eu
+	grep $(pwd) --verbose && readonly test
+echo --verbose && 2>/dev/null export printf ${HOME} 2>/dev/null -eu
+test -eu ${HOME} "$1" x=1
+	printf readonly 'quoted text' ${HOME}
+	${HOME} "$1" test | 'quoted text' done grep
+	cd "$1" local x=1 then test $(pwd)
+	2>/dev/null "$@" /usr/bin
+		"$1" local && test ${HOME} 'quoted text'
+	&& printf awk awk ${HOME}
+	x=1 readonly awk 2>/dev/null
+sed $(pwd) --verbose 2>/dev/null grep done x=1 test awk 'quoted text'
+	/usr/bin echo ${HOME} /usr/bin grep awk readonly
+export "$@" awk --verbose -eu "$@" grep local then readonly readonly
+	x=1 -eu done x=1 /usr/bin test -eu cd $(pwd) ${HOME} export 2>/dev/null
+echo sed test 2>/dev/null 2>/dev/null 2>/dev/null "$1"
+	$(pwd) --verbose done "$1" | /usr/bin -eu then
+		&& ${HOME} sed "$@" export && ${HOME} /usr/bin --verbose grep printf
+${HOME} cd then awk test "$1" grep $(pwd) "$@" local
+		'quoted text' 'quoted text' printf /usr/bin export echo
+		-eu sed -eu export $(pwd) && export ${HOME} readonly readonly x=1 local $(pwd)
+export echo -eu printf --verbose &&
+		grep awk && sed --verbose awk 'quoted text'
+	cd test && "$1" | test | sed printf test "$1" readonly then export $(pwd) echo
+&& readonly cd export printf --verbose grep export --verbose /usr/bin
+		then $(pwd) ${HOME} 'quoted text'
+awk 2>/dev/null done /usr/bin printf 'quoted text' $(pwd) awk export
+then export test then awk local local
+		readonly && && 'quoted text'
+		done x=1 printf done 'quoted text' export $(pwd) "$@"
+		2>/dev/null 2>/dev/null cd printf
+readonly cd awk && export sed test
+	&& $(pwd) export local "$1" sed
+	local echo 'quoted text' "$1" x=1
+	-eu x=1 printf ${HOME} awk 2>/dev/null ${HOME} local cd | /usr/bin done /usr/bin
+	sed && --verbose grep cd --verbose --verbose /usr/bin "$1" x=1 $(pwd) "$1"
+-eu --verbose local $(pwd)
+	2>/dev/null printf sed awk $(pwd) readonly /usr/bin ${HOME}
+| test 2>/dev/null "$1" --verbose
+	/usr/bin readonly printf
+	sed ${HOME} echo ${HOME}
+2>/dev/null x=1 local awk grep export /usr/bin
+--verbose sed x=1 test printf
+	test grep printf done |
+	done -eu grep "$@" /usr/bin cd local "$1" "$1" test 2>/dev/null "$@" readonly
+	/usr/bin $(pwd) then | && /usr/bin done
+x=1 && local printf "$1"
+		printf $(pwd) /usr/bin x=1
+		then $(pwd) "$@" test x=1 echo | printf | x=1 -eu then -eu -eu
+cd --verbose export local local local --verbose
+	echo then && 'quoted text' printf sed grep printf ${HOME} readonly
+		test "$1" awk "$@" 2>/dev/null done done "$@" && $(pwd) "$1" 2>/dev/null 2>/dev/null
+sed ${HOME} sed && awk | export readonly local awk && export test --verbose cd
+	/usr/bin | local sed --verbose then x=1 x=1 'quoted text'
+&& readonly x=1 cd echo "$1" done
+		awk test $(pwd) then /usr/bin "$1" 2>/dev/null test echo "$1" local export
+"$@" sed "$@" local then then cd 'quoted text'
+		awk --verbose done done
+		grep awk echo "$@" "$1"
+		sed export "$1" awk printf done
+		done local awk "$@" 'quoted text' then | local $(pwd)
+		/usr/bin printf "$1" -eu $(pwd) "$@" 2>/dev/null /usr/bin cd done grep sed then
+	echo --verbose test grep
+		echo ${HOME} --verbose then local cd sed awk "$1" cd cd
+grep | echo cd printf ${HOME} sed $(pwd) /usr/bin printf readonly
+	&& | "$@" 'quoted text' printf 'quoted text' $(pwd) | && 2>/dev/null "$@"
+	echo then $(pwd) export test 2>/dev/null local
+		'quoted text' -eu grep "$@" grep $(pwd) export printf then --verbose sed $(pwd)
+		readonly test done sed
+	${HOME} echo local done | && -eu local awk then
+		${HOME} grep 2>/dev/null -eu cd test "$1"
+	export 'quoted text' grep | --verbose
+done test printf && "$@"
+"$@" local 'quoted text' echo awk && local x=1 x=1 "$@" ${HOME} then export
+	export readonly /usr/bin done
+--verbose sed cd awk x=1 && then sed -eu awk
+cd echo awk /usr/bin export printf sed $(pwd) local 'quoted text'
+done 'quoted text' "$1" --verbose printf then 2>/dev/null local done
+		"$1" && x=1 printf grep cd "$@" sed "$1" ${HOME} export cd test then then
+export | /usr/bin "$@" then cd awk sed cd grep local "$@" | 2>/dev/null echo
+	2>/dev/null --verbose "$@" 'quoted text'
+local /usr/bin /usr/bin x=1 done | "$@" printf export /usr/bin
+		local && "$1" --verbose
+		${HOME} awk echo printf $(pwd)
+		sed | 2>/dev/null x=1 cd "$1" ${HOME} ${HOME} test echo done
+		$(pwd) /usr/bin 2>/dev/null readonly test $(pwd)
+		--verbose local test && x=1 test cd then 'quoted text'
+	echo export 'quoted text' "$@" then test echo -eu "$@" echo sed | printf 2>/dev/null
+local awk 2>/dev/null 2>/dev/null then
+/usr/bin 2>/dev/null /usr/bin grep && ${HOME} $(pwd)
+	| awk done grep done /usr/bin grep echo $(pwd)
+		done then ${HOME} | "$1" export cd /usr/bin readonly
+-eu $(pwd) cd printf ${HOME} /usr/bin 'quoted text' local test then
+printf awk /usr/bin "$@" "$1" export readonly
+	x=1 -eu echo test 2>/dev/null /usr/bin local done
+$(pwd) "$1" $(pwd) ${HOME} 'quoted text'
+grep && printf awk -eu $(pwd) done $(pwd) test "$@" /usr/bin && 'quoted text'
+"$1" | test | "$1" /usr/bin test ${HOME} x=1 then printf --verbose
+	awk 2>/dev/null awk then x=1 printf readonly "$@"
+export local $(pwd) 2>/dev/null
+then $(pwd) -eu /usr/bin
+	printf local | done then test 'quoted text' x=1 ${HOME} 'quoted text' 'quoted text'
+	printf printf readonly /usr/bin then then
+	/usr/bin 2>/dev/null readonly | "$@" readonly awk then export /usr/bin local
+		awk done cd "$@" export local cd --verbose
+	export readonly echo
+	export -eu sed test cd |
+x=1 readonly 'quoted text' echo
+echo echo 2>/dev/null echo readonly echo export grep --verbose
+local echo done test && | $(pwd) export
+"$@" /usr/bin test && then
+	done readonly | test cd /usr/bin grep "$@" awk export done printf local echo cd
+	&& "$@" --verbose -eu "$1" && 2>/dev/null
+	echo "$@" done local echo readonly ${HOME} local local readonly
+		local readonly $(pwd) x=1 "$@" printf 2>/dev/null | done x=1 cd
+echo && sed printf "$1" --verbose done ${HOME} printf
+		&& done local ${HOME} awk test printf x=1 done
+	then printf /usr/bin readonly readonly readonly $(pwd) "$1" export
+	export "$1" sed && grep awk export
+	&& cd printf 2>/dev/null cd --verbose
+	$(pwd) printf export | $(pwd)
+grep awk --verbose x=1 sed -eu sed done test 'quoted text'
+	readonly 'quoted text' export local 'quoted text'
+printf "$1" 2>/dev/null done test ${HOME} 'quoted text'
+	cd x=1 /usr/bin /usr/bin test 'quoted text' local test 2>/dev/null
+echo | -eu /usr/bin echo $(pwd)
+echo printf sed --verbose 'quoted text' echo awk then "$1" x=1
+	'quoted text' local 'quoted text' export x=1 "$1" sed readonly
+test echo && printf then /usr/bin grep readonly sed readonly
+		"$@" printf echo sed "$@" export 'quoted text' test
+		"$@" /usr/bin echo && awk then | awk -eu | "$1" printf then 'quoted text' export
+		&& export done -eu --verbose export $(pwd) awk done sed && test && x=1 printf ${HOME}
+	cd export 'quoted text' 'quoted text'
+	then local export readonly done x=1 local | ${HOME} 'quoted text'
+		"$1" ${HOME} && && done cd sed "$@" done 2>/dev/null
+2>/dev/null grep readonly | ${HOME} awk 'quoted text'
+2>/dev/null readonly && 'quoted text' --verbose local
+		x=1 -eu sed 2>/dev/null then local cd grep 'quoted text' 'quoted text'
+		| grep $(pwd) then then echo sed test
+	${HOME} -eu 'quoted text' --verbose 2>/dev/null
+	printf $(pwd) --verbose readonly ${HOME} test 'quoted text' x=1 cd then
+	"$@" cd "$1" awk awk then done x=1 awk --verbose readonly
+2>/dev/null export "$1" awk grep
+printf $(pwd) -eu readonly x=1 x=1 "$@" printf
+	cd ${HOME} -eu -eu sed "$@" 'quoted text'
+	sed $(pwd) "$1" "$1" 'quoted text' 'quoted text' "$@"
+	awk then "$@" ${HOME} then printf 'quoted text' export 2>/dev/null
+	"$1" -eu awk x=1 | 2>/dev/null | | test awk grep
+	printf grep -eu awk && "$1" /usr/bin test cd
+		export | x=1 | done test printf | --verbose
+	sed export -eu then awk "$1"
+	--verbose | grep awk readonly echo
+	done grep 'quoted text' 'quoted text'
+--verbose cd 2>/dev/null
+| test x=1 $(pwd) test x=1 | then -eu grep &&
+	${HOME} awk then $(pwd) then export
+	local export && printf local then echo awk
+		2>/dev/null sed export awk
+	echo | local 2>/dev/null "$@" "$1" /usr/bin
+		--verbose $(pwd) printf | 'quoted text' 2>/dev/null
+	'quoted text' $(pwd) awk then
+		&& echo "$1" readonly grep printf test awk readonly
+	echo then ${HOME} then then echo --verbose sed local
+	&& /usr/bin then | cd printf
+		-eu 'quoted text' --verbose local cd readonly
+		-eu then --verbose "$@" awk | sed test test | cd done
+	grep test /usr/bin -eu $(pwd) then sed | grep 'quoted text' "$1" test && printf
+	$(pwd) echo printf test x=1 done 2>/dev/null readonly --verbose
+	"$1" x=1 then cd printf "$1" "$1"
+		/usr/bin export --verbose done echo grep test awk "$@" $(pwd) ${HOME} export
+export grep export then /usr/bin ${HOME} && 'quoted text'
+	'quoted text' echo cd "$@" awk $(pwd) echo "$@" 'quoted text' ${HOME} 'quoted text'
+	"$@" /usr/bin done 'quoted text' sed echo /usr/bin --verbose && cd
+sed export "$@" /usr/bin "$1" 2>/dev/null ${HOME} echo cd test readonly printf
+	x=1 && -eu 2>/dev/null done --verbose local "$1"
+/usr/bin test 2>/dev/null ${HOME} && --verbose echo
+test sed grep sed | /usr/bin
+echo -eu /usr/bin echo "$@" |
+		'quoted text' x=1 | cd cd 2>/dev/null x=1 grep test cd local grep done export cd
+	&& "$@" then sed readonly $(pwd) local readonly
+sed done printf test awk 2>/dev/null "$@" then awk "$1" | && readonly
+		x=1 echo && x=1 cd 2>/dev/null 2>/dev/null grep
+		test x=1 export grep 2>/dev/null printf /usr/bin printf x=1 ${HOME} grep /usr/bin
+	readonly cd /usr/bin --verbose /usr/bin local | x=1 export echo
+	echo local /usr/bin test
+	grep local sed cd printf cd sed 2>/dev/null local
+printf cd local "$@" "$@" export test echo done grep
+	printf && --verbose && "$@" sed |
+	then /usr/bin | cd "$1" awk | "$1" sed && printf done cd $(pwd) x=1
+		--verbose awk done sed 2>/dev/null && --verbose 'quoted text' /usr/bin
+		printf export && grep readonly 'quoted text' export export sed sed sed printf cd
+	then export done grep echo cd then 'quoted text'
+		cd grep printf local sed $(pwd) grep "$1" && cd awk done "$@" then then
+	-eu x=1 grep done printf then readonly export then "$@" x=1 local ${HOME} local
+		"$1" 'quoted text' $(pwd) grep grep printf --verbose -eu 2>/dev/null
+		"$@" readonly /usr/bin | awk awk export done grep sed then /usr/bin /usr/bin
+	test /usr/bin | $(pwd) x=1 2>/dev/null
+${HOME} /usr/bin test awk && done
+done 2>/dev/null x=1 $(pwd) printf cd readonly echo
+		echo readonly | "$@" ${HOME} "$@" --verbose
+		/usr/bin 2>/dev/null &&
+$(pwd) cd done echo awk cd && /usr/bin awk | 2>/dev/null echo readonly export
+		"$1" && -eu --verbose ${HOME} x=1 readonly |
+	grep sed "$1" $(pwd) "$@" then done awk /usr/bin
+	-eu sed && "$@" done grep /usr/bin awk then readonly
+		x=1 echo 2>/dev/null --verbose local readonly 2>/dev/null x=1 awk -eu 'quoted text'
+	done 2>/dev/null awk /usr/bin
+2>/dev/null ${HOME} cd done echo "$1" &&
+	sed 2>/dev/null done "$1" && -eu "$1" sed
+	local x=1 --verbose && x=1 "$@" "$@" x=1 sed then -eu "$1" readonly grep done done
+		readonly sed done done export ${HOME} echo printf "$1" readonly
+'quoted text' "$1" echo --verbose sed "$@"
+		$(pwd) readonly 'quoted text' export && test export export grep /usr/bin
+$(pwd) test 2>/dev/null done
+sed printf echo local local grep awk && export done --verbose
+	'quoted text' "$1" awk 2>/dev/null test -eu | x=1 /usr/bin test local --verbose
+	cd "$1" "$1" "$@" done cd local ${HOME} "$@" --verbose | 'quoted text'
+	-eu | -eu 'quoted text' ${HOME} "$1" && done --verbose
+		awk $(pwd) done $(pwd) awk /usr/bin ${HOME} local cd
+done export export done 2>/dev/null local ${HOME} readonly sed printf echo grep
+		test x=1 then 'quoted text' test --verbose | ${HOME} 2>/dev/null done -eu
+	"$1" local -eu awk printf | /usr/bin 'quoted text' sed $(pwd) readonly $(pwd) sed
+cd 2>/dev/null printf 2>/dev/null && "$1" echo 2>/dev/null
+"$1" 2>/dev/null sed /usr/bin then ${HOME}
+'quoted text' /usr/bin 'quoted text' x=1 | "$1" && 'quoted text' /usr/bin
+	local sed /usr/bin awk then test --verbose -eu sed
+	2>/dev/null "$1" | cd "$1" 'quoted text' then ${HOME} then
+echo /usr/bin echo local printf --verbose grep export 'quoted text' then awk
+	grep export then export $(pwd) readonly
+done 'quoted text' sed readonly && 2>/dev/null local awk ${HOME} --verbose --verbose
+	$(pwd) sed test local --verbose -eu 'quoted text'
+$(pwd) /usr/bin "$1" local -eu 2>/dev/null then /usr/bin export
+		cd 2>/dev/null export "$1" /usr/bin test -eu awk $(pwd) then echo
+	${HOME} ${HOME} /usr/bin then cd export && | awk export 'quoted text' 2>/dev/null
+	readonly && && readonly grep export
+		$(pwd) cd sed then | && local && printf readonly && export --verbose
+		--verbose 2>/dev/null --verbose sed 'quoted text' && export /usr/bin "$1"
+		2>/dev/null -eu awk grep $(pwd) "$1" test cd ${HOME} done
+		readonly x=1 2>/dev/null echo x=1 -eu | 'quoted text' cd ${HOME} x=1
+		printf | readonly export ${HOME} x=1 echo 2>/dev/null
+		2>/dev/null x=1 awk awk export printf done 2>/dev/null
+2>/dev/null $(pwd) 2>/dev/null 'quoted text' printf /usr/bin -eu
+	"$1" cd | cd x=1 "$1" /usr/bin export local
+2>/dev/null "$@" export "$@" done done && "$@" | ${HOME} export "$1"
+	readonly test ${HOME} -eu printf $(pwd) 2>/dev/null
+	sed printf --verbose ${HOME}
+		then 2>/dev/null && "$1" sed 'quoted text' printf "$@" printf
+"$@" echo cd "$1" done 'quoted text' "$@" local done x=1 "$1" ${HOME} then printf
+	test "$1" -eu cd readonly -eu 2>/dev/null 'quoted text' -eu
+	then "$@" then sed 'quoted text' /usr/bin local export grep -eu done done cd |
+	echo done then test done
+| && /usr/bin printf cd 'quoted text'
+	awk $(pwd) readonly 'quoted text' grep
+"$1" test then sed export -eu "$1" | -eu ${HOME} 2>/dev/null export sed
+	export "$@" --verbose printf x=1 awk test && && x=1 export grep
+		grep test ${HOME} "$1" /usr/bin done export "$1" /usr/bin | awk | done done awk
+		test "$1" --verbose x=1 --verbose $(pwd) $(pwd)
+		$(pwd) printf done --verbose
+| 2>/dev/null done --verbose cd | awk awk export
+	"$1" printf test then -eu local sed local then
+	done local awk && awk done readonly 2>/dev/null
+	echo sed ${HOME} sed echo local test 'quoted text' export
+	readonly 'quoted text'
+		'quoted text' readonly x=1 'quoted text'
+		"$1" sed /usr/bin /usr/bin "$@" 2>/dev/null export echo && $(pwd)
+	/usr/bin ${HOME} $(pwd) awk grep readonly
+'quoted text' && grep "$1" then grep -eu $(pwd) cd export "$@" done local cd
+'quoted text' "$@" test ${HOME} "$1" echo ${HOME} local
+"$1" test ${HOME} $(pwd) | --verbose 2>/dev/null
+		printf ${HOME} done grep local awk $(pwd) | grep then "$1" sed -eu 'quoted text'
+		export 2>/dev/null readonly /usr/bin | "$@" awk && "$@"
+		"$@" printf && x=1 export ${HOME}
+&& /usr/bin awk cd $(pwd) ${HOME} 2>/dev/null awk && echo awk /usr/bin cd test
+	test "$@" ${HOME} awk awk $(pwd) /usr/bin readonly x=1 ${HOME} -eu ${HOME}
+| sed grep 2>/dev/null cd
+	x=1 test 'quoted text' -eu export done && $(pwd) test grep awk /usr/bin test awk
+export x=1 export && cd 'quoted text' cd local cd sed /usr/bin cd 'quoted text'
+	"$@" /usr/bin echo --verbose grep sed grep readonly export --verbose x=1
+	sed cd test readonly && echo /usr/bin --verbose
+		then then then export printf grep $(pwd) then $(pwd) done awk 'quoted text'
+		/usr/bin done sed && grep | export "$1" | awk cd export echo cd 'quoted text'
+awk export | && "$@" local
+export awk | sed test cd "$1" awk x=1 ${HOME} x=1 "$1" --verbose
+		grep /usr/bin && -eu export
+awk sed -eu done -eu sed printf awk export "$@" 'quoted text'
+		"$1" done awk export then &&
+		export local then | ${HOME}
+	sed local done | "$1" test export x=1 cd readonly --verbose | x=1
+local && $(pwd) --verbose $(pwd) then done cd printf sed
+	readonly echo ${HOME} "$1" 2>/dev/null
+	x=1 /usr/bin done --verbose $(pwd) "$@" "$1" 'quoted text' --verbose
+		sed cd $(pwd) sed | | grep then local /usr/bin 'quoted text'
+	'quoted text' 2>/dev/null
+local 'quoted text' --verbose done 'quoted text'
+done done /usr/bin 'quoted text' readonly
+	grep && "$1" "$1" test "$@" done awk 2>/dev/null 'quoted text' $(pwd) ${HOME}
+grep "$@" --verbose |
+		sed test x=1 ${HOME}
+${HOME} x=1 test $(pwd)
+'quoted text' && echo 'quoted text'
+		done | awk --verbose "$1" "$@" | $(pwd) && export awk ${HOME} then $(pwd) test
+		done cd echo readonly local 2>/dev/null "$@" cd "$1" $(pwd) --verbose done -eu
+#include c24.sh
+		local export sed && printf $(pwd) 'quoted text' | sed "$1" 2>/dev/null "$1"
+sed 2>/dev/null readonly $(pwd) "$1" 2>/dev/null -eu printf cd then done
+	"$1" local --verbose "$@" && x=1 ${HOME}
+echo 'quoted text' -eu cd printf 2>/dev/null
+	test sed grep sed 2>/dev/null printf
+	awk -eu -eu && then local
+		echo awk && grep grep "$@" x=1
+test ${HOME} 2>/dev/null export grep
+		readonly ${HOME} -eu |
+grep printf --verbose x=1 "$@" readonly && ${HOME} $(pwd) -eu /usr/bin "$@"
+		done printf sed $(pwd) "$1" x=1 awk echo echo && | "$@"
+		printf cd awk cd 'quoted text' -eu grep cd grep echo /usr/bin -eu
+cd "$1" 2>/dev/null ${HOME} done cd printf
+		$(pwd) x=1 readonly "$@" grep then local
+	printf && test done ${HOME} grep
+"$1" --verbose echo printf cd ${HOME} printf sed x=1 | /usr/bin ${HOME}
+		grep | readonly /usr/bin
+done -eu ${HOME} readonly export test x=1 printf then "$@" 2>/dev/null 'quoted text'
+--verbose done export printf cd readonly "$@" readonly $(pwd) x=1
+	readonly echo local && done $(pwd)
+	"$1" /usr/bin readonly cd ${HOME} -eu 'quoted text' -eu done $(pwd) | local
+		awk -eu grep readonly x=1 readonly $(pwd) $(pwd)
+--verbose test "$1" echo | | export 2>/dev/null "$1" test printf --verbose
+	| | echo test "$1" x=1 -eu printf test -eu -eu "$1" $(pwd) 'quoted text' x=1
+		'quoted text' test 'quoted text' test x=1 "$@" cd cd 'quoted text' echo -eu x=1
+		sed echo && printf | -eu echo printf echo "$1" | test export
+		$(pwd) --verbose -eu x=1 export "$1" "$1" test echo 'quoted text'
+		then cd --verbose test -eu "$1" readonly
+echo /usr/bin $(pwd) x=1 ${HOME} 'quoted text' then then /usr/bin x=1 local
+readonly 'quoted text'
+| | sed cd "$@" ${HOME} then awk 2>/dev/null
+		printf 'quoted text' $(pwd) "$1" "$1" 2>/dev/null 2>/dev/null printf "$@" printf
+		awk && test x=1 "$1" local -eu "$1" "$1" sed 2>/dev/null x=1 x=1 done /usr/bin
+| -eu sed ${HOME} echo /usr/bin echo "$1" 'quoted text'
+		${HOME} "$1" | $(pwd) /usr/bin test sed echo x=1 local awk grep then
+	readonly done readonly test | cd cd local cd 2>/dev/null
+	'quoted text' "$@" && "$1" echo echo printf && -eu $(pwd) then
+	"$@" local /usr/bin 2>/dev/null $(pwd) "$@"
+		printf -eu then local cd cd sed x=1 printf
+		cd x=1 grep awk grep 'quoted text' --verbose $(pwd)
+"$1" then -eu /usr/bin readonly sed $(pwd) x=1 awk $(pwd) export echo
+done x=1 printf x=1 $(pwd) sed grep x=1 awk awk "$1" done --verbose /usr/bin
+x=1 "$@" local grep -eu && /usr/bin sed 'quoted text'
+		test --verbose export echo "$@" /usr/bin grep export done --verbose "$@" done /usr/bin
+	/usr/bin 2>/dev/null x=1 export local | then cd readonly
+		"$1" -eu x=1 then printf printf export
+		--verbose x=1 test echo "$@" local 'quoted text' "$1" echo cd x=1 cd
+		x=1 "$1" $(pwd) then done "$@" sed export awk 2>/dev/null
+		grep sed echo echo test --verbose awk /usr/bin && export printf --verbose local
+		echo ${HOME} "$@" local 'quoted text' --verbose readonly
+		readonly | 'quoted text'
+		2>/dev/null cd local $(pwd) grep 'quoted text'
+&& awk 'quoted text' ${HOME} -eu local /usr/bin cd $(pwd) $(pwd) --verbose
+"$@" test done -eu sed then && "$@" then
+${HOME} /usr/bin -eu "$1" sed 2>/dev/null "$1" && --verbose 'quoted text'
+		printf $(pwd) done "$@" sed
+		grep x=1 printf done awk echo /usr/bin grep $(pwd) echo test export done readonly
+/usr/bin grep test 2>/dev/null
+test sed grep awk -eu "$1" /usr/bin sed test test sed sed $(pwd) -eu export export
+sed grep local -eu && 2>/dev/null done
+	awk export grep $(pwd) cd /usr/bin sed
+		x=1 | --verbose test 2>/dev/null | "$@" --verbose cd grep && echo 2>/dev/null
+then 'quoted text' --verbose
+		"$1" 2>/dev/null 'quoted text'
+	${HOME} local local echo sed awk 2>/dev/null /usr/bin
+		readonly /usr/bin sed && 2>/dev/null /usr/bin printf /usr/bin
+echo done "$@" | grep readonly /usr/bin /usr/bin
+		echo grep grep export | /usr/bin
+	sed test -eu $(pwd) /usr/bin done readonly test cd
+	then | ${HOME} && 2>/dev/null "$1" $(pwd) then | then 2>/dev/null
+		cd then echo awk sed test cd x=1 /usr/bin -eu then
+		$(pwd) 'quoted text' --verbose "$1" cd | | test $(pwd) --verbose printf
+sed --verbose done then grep local 2>/dev/null
+	export -eu 'quoted text' export
+		export "$1" /usr/bin |
+	echo 2>/dev/null printf "$@" awk "$@" sed -eu awk
+		export awk cd sed echo && export done /usr/bin x=1
+	done | x=1 grep 2>/dev/null ${HOME}
+		${HOME} local "$@" export grep sed ${HOME} test 'quoted text'
+		"$1" $(pwd) printf then printf
+		$(pwd) export awk | 'quoted text'
+	${HOME} "$@" 'quoted text' readonly /usr/bin
+	done --verbose 'quoted text' $(pwd) -eu export
+	${HOME} --verbose "$1" readonly grep echo | "$1" printf --verbose
+"$1" test --verbose readonly -eu awk /usr/bin test echo 2>/dev/null
+	cd | grep 2>/dev/null $(pwd) then local && 'quoted text'
+		sed grep x=1 awk /usr/bin done grep | grep && then
+	&& test echo cd /usr/bin --verbose readonly done x=1 | cd | /usr/bin
+export echo export done 'quoted text' echo echo export
+	test cd grep export echo readonly local 'quoted text'
+		readonly awk then local grep printf local done && readonly
+	local cd local awk -eu /usr/bin echo "$1" export 2>/dev/null cd
+		local "$1" test echo test /usr/bin awk /usr/bin && grep -eu cd readonly export
+test /usr/bin printf x=1 printf echo "$@" test readonly readonly
+		then readonly && cd cd cd test "$@" echo echo x=1 done grep test "$1" local
+	| local then readonly --verbose ${HOME} sed awk grep ${HOME}
+		awk sed 'quoted text' readonly ${HOME} 2>/dev/null x=1
+		printf "$1" readonly export 'quoted text' -eu test done grep local
+	2>/dev/null /usr/bin && x=1 echo /usr/bin
+		--verbose done local --verbose 'quoted text' ${HOME} x=1 /usr/bin
+	test then then x=1 grep printf x=1 2>/dev/null echo
+		readonly echo /usr/bin printf
+	local "$@" $(pwd) --verbose ${HOME}
+		cd local test && readonly then 2>/dev/null export x=1 grep printf local | /usr/bin
+	/usr/bin printf "$@" --verbose export local readonly
+		local "$1" ${HOME} 2>/dev/null done cd "$@" x=1 sed "$@" 2>/dev/null cd $(pwd) "$1"
+echo 'quoted text' "$@" x=1 "$1" readonly -eu sed grep 2>/dev/null
+-eu $(pwd) 2>/dev/null awk x=1 export local awk test readonly sed /usr/bin
+	-eu "$1" --verbose then awk
+		echo x=1 | ${HOME} /usr/bin export then 2>/dev/null awk printf echo
+		"$1" ${HOME} sed grep
+	awk export -eu grep export -eu 2>/dev/null "$1"
+		&& test && -eu done cd export --verbose && test
+2>/dev/null && grep printf then done test then "$@" awk echo readonly
+export echo local export
+x=1 -eu $(pwd) 'quoted text'
+	awk test cd $(pwd) sed export -eu readonly x=1 | printf done | 2>/dev/null
+export && ${HOME} "$@" "$@" x=1
+printf sed printf && done -eu "$1"
+	"$@" 'quoted text' export awk ${HOME} sed --verbose
+		"$1" readonly x=1 --verbose cd | cd then 'quoted text' 'quoted text' 2>/dev/null
+cd cd export /usr/bin local echo done cd -eu test 'quoted text'
+		awk export readonly x=1 /usr/bin cd cd grep cd $(pwd) -eu echo
+-eu test | ${HOME} then 'quoted text'
+		/usr/bin sed -eu -eu "$@" 'quoted text' export && 2>/dev/null
+		| then test then $(pwd) export | awk $(pwd) $(pwd) export /usr/bin | done
+'quoted text' readonly local "$@" $(pwd) done 'quoted text'
+	| -eu echo cd | /usr/bin sed
+	local cd grep x=1 export 'quoted text' cd export
+printf local export | /usr/bin -eu x=1 'quoted text' readonly
+&& $(pwd) 2>/dev/null x=1 /usr/bin printf
+		2>/dev/null grep /usr/bin "$@" printf $(pwd) 'quoted text' cd local 'quoted text'
+-eu printf 2>/dev/null "$1" echo /usr/bin -eu readonly 2>/dev/null echo &&
+sed 2>/dev/null then x=1 --verbose 'quoted text' awk 'quoted text'
+printf sed cd /usr/bin export "$1" | $(pwd) 2>/dev/null printf
+"$1" -eu && "$@" x=1 awk 'quoted text' ${HOME} done readonly
+	echo printf "$1" 2>/dev/null
+		sed $(pwd) 2>/dev/null | sed then -eu ${HOME}
+	readonly local test ${HOME} $(pwd)
+		local then done && x=1 sed /usr/bin
+		2>/dev/null export "$1" awk -eu 2>/dev/null "$1" -eu test
+		&& 2>/dev/null printf awk /usr/bin printf cd 2>/dev/null grep /usr/bin
+	test /usr/bin printf local "$@" local && $(pwd) -eu echo cd 'quoted text'
+	'quoted text' echo /usr/bin --verbose
+	local cd $(pwd) "$@" test export $(pwd) test x=1
+		sed grep "$1" echo 'quoted text' 'quoted text' echo /usr/bin
+--verbose test --verbose x=1 echo 2>/dev/null ${HOME} done "$@" test sed
+then sed sed /usr/bin $(pwd) x=1 printf -eu | export
+	2>/dev/null cd readonly x=1
+'quoted text' done awk -eu awk ${HOME} sed -eu 'quoted text' "$1" /usr/bin
+		export --verbose awk test awk --verbose 'quoted text'
+		| "$@" ${HOME} x=1 done -eu /usr/bin sed 'quoted text' && 'quoted text'
+	"$1" -eu cd done 'quoted text' "$@" ${HOME}
+"$@" "$@" grep readonly $(pwd) /usr/bin done x=1 | readonly
+		-eu --verbose awk test x=1 --verbose done && "$@" -eu --verbose ${HOME} 'quoted text'
+	awk grep 'quoted text' then ${HOME} --verbose cd $(pwd) ${HOME} test 'quoted text'
+	test cd --verbose x=1 "$@" test then
+	then awk 'quoted text' sed printf readonly 'quoted text' done printf
+	--verbose then echo "$@" printf -eu ${HOME} grep export awk
+	2>/dev/null | done -eu printf local x=1 -eu | | x=1 grep test done done
+	'quoted text' "$@" /usr/bin /usr/bin --verbose awk awk grep
+		"$@" ${HOME} --verbose local echo 2>/dev/null 'quoted text'
+"$@" cd | done awk /usr/bin x=1 grep awk 'quoted text'
+	test ${HOME} readonly echo done echo 'quoted text' "$@" export local
+	test then "$1" 2>/dev/null
+		export x=1 "$1" $(pwd) cd "$@" local 'quoted text'
+then 'quoted text' ${HOME} printf readonly sed sed export readonly
+	printf x=1 "$1" test |
+| readonly test grep 'quoted text'
+-eu awk "$1" export --verbose awk --verbose ${HOME}
+	| sed ${HOME} readonly 2>/dev/null "$@" --verbose &&
+	readonly /usr/bin printf
+	echo -eu awk done printf -eu $(pwd) --verbose local 'quoted text' test | x=1
+	readonly ${HOME} && done export then local echo then "$1" -eu
+		local cd /usr/bin export "$@" test done --verbose export "$@" export
+local export 2>/dev/null | $(pwd) /usr/bin export && --verbose
+		/usr/bin local -eu "$@" sed 2>/dev/null export
+'quoted text' printf x=1
+	cd --verbose sed --verbose && grep $(pwd) $(pwd) readonly "$1" x=1 $(pwd)
+	awk $(pwd) | /usr/bin 'quoted text'
+sed awk "$@" | ${HOME} readonly grep 'quoted text'
+		"$@" /usr/bin && readonly then echo printf awk $(pwd)
+		local x=1 echo x=1 echo /usr/bin grep "$1" printf 'quoted text'
+test -eu 2>/dev/null x=1 printf
+	awk export && x=1 "$1" echo readonly local test done -eu /usr/bin
+		-eu /usr/bin awk "$@" local
+export "$1" cd -eu 'quoted text' printf local
+		awk test ${HOME} grep printf printf echo test | cd ${HOME} awk awk
+		"$1" "$@" echo "$1" 2>/dev/null export --verbose
+then then | x=1 test "$@" local $(pwd) | printf awk /usr/bin "$1"
+		x=1 --verbose | x=1 2>/dev/null 2>/dev/null echo export local
+	'quoted text' sed | 2>/dev/null && $(pwd) grep ${HOME} echo "$1" ${HOME} sed "$@"
+printf sed grep export "$@" -eu "$1" ${HOME} && grep test awk test
+	$(pwd) export done sed | sed --verbose --verbose x=1 'quoted text' /usr/bin
+	test echo done cd 2>/dev/null printf readonly
+printf printf printf /usr/bin export export done done x=1 'quoted text'
+	awk /usr/bin "$@" && x=1 | "$1" "$@" x=1 echo echo awk $(pwd) awk done done "$@"
+then 2>/dev/null && grep grep awk
+awk -eu "$1" --verbose "$@"
+then && readonly echo awk 'quoted text' printf
+		grep cd readonly $(pwd) -eu x=1 awk 2>/dev/null 2>/dev/null && 'quoted text'
+	then local 2>/dev/null grep --verbose 2>/dev/null
+	"$@" test 2>/dev/null export sed /usr/bin 'quoted text' x=1 $(pwd) echo
+		done "$1" echo done grep ${HOME} local "$@" readonly $(pwd) cd 2>/dev/null local
+	"$@" x=1 grep 'quoted text'
+"$1" awk local export "$1" -eu then
+test done printf $(pwd) "$1" local awk --verbose test sed done ${HOME} "$1" $(pwd)
+		grep "$1" cd local echo
+	"$@" x=1 | done awk | export x=1 grep $(pwd) /usr/bin && echo | x=1 &&
+		test awk then sed $(pwd) $(pwd) "$@" x=1
+	then local printf | readonly printf && grep "$1" | done
+${HOME} cd -eu /usr/bin 2>/dev/null
+		done export test test /usr/bin "$@" "$@"
+test x=1 && | | x=1 | $(pwd) awk $(pwd)
+	"$1" 'quoted text' sed $(pwd) done /usr/bin
+	"$@" printf --verbose "$@" cd printf readonly $(pwd)
+"$1" awk then local printf
+	readonly x=1 readonly grep 'quoted text' readonly "$@" test local "$1" test
+sed | | --verbose awk 'quoted text' 2>/dev/null 2>/dev/null 'quoted text'
+		-eu x=1 ${HOME} "$@" readonly export --verbose test x=1 2>/dev/null export readonly
+-eu --verbose echo printf echo sed x=1 $(pwd) cd x=1
+$(pwd) -eu x=1 "$@" x=1 then x=1 export 2>/dev/null -eu then 2>/dev/null
+"$@" 'quoted text' export then grep grep x=1 'quoted text' $(pwd) $(pwd)
+2>/dev/null -eu -eu grep -eu
+	--verbose --verbose printf then then
+		done test --verbose grep 'quoted text'
+&& grep 'quoted text' $(pwd) done x=1 $(pwd) "$@" echo grep
+&& "$1" done "$1" 'quoted text'
+		grep sed $(pwd) | echo ${HOME}
+awk x=1 export ${HOME} x=1 | awk /usr/bin
+/usr/bin printf | /usr/bin awk && readonly test sed "$@" awk /usr/bin
+		cd && ${HOME} local readonly
+grep $(pwd) echo "$1" 'quoted text' readonly && "$@" /usr/bin then then
+	"$1" | ${HOME} $(pwd) "$@"
+	&& /usr/bin readonly --verbose done readonly then test -eu awk "$@" | ${HOME}
+readonly --verbose "$@" done done x=1 grep printf
+sed grep --verbose awk echo printf
+	"$@" x=1 -eu echo "$@" -eu readonly test then done "$1"
+--verbose 'quoted text' test --verbose 2>/dev/null /usr/bin 'quoted text'
+		2>/dev/null ${HOME} printf export x=1 local echo | 2>/dev/null | 2>/dev/null
+		done $(pwd) printf test
+&& 'quoted text' printf | echo
+sed "$1" x=1 then sed 'quoted text' awk local x=1 ${HOME} "$1" local $(pwd)
+		printf echo && then x=1 x=1 "$@" $(pwd)
+	-eu export && "$@" test then /usr/bin $(pwd)
+	'quoted text' /usr/bin export -eu 'quoted text' printf $(pwd) printf ${HOME}
+	--verbose awk export done done readonly
+	readonly test readonly cd echo then 2>/dev/null export --verbose export
+"$@" export test printf 'quoted text' "$@" echo awk local -eu -eu awk 'quoted text'
+cd grep x=1 awk echo x=1 awk test $(pwd)
+	then $(pwd) awk /usr/bin awk && -eu x=1 ${HOME} readonly ${HOME} grep printf
+	echo done sed echo "$1" grep $(pwd) then -eu | 2>/dev/null cd grep
+-eu readonly local cd readonly x=1 2>/dev/null
+	&& | printf awk ${HOME} export
+	readonly x=1 export && -eu | ${HOME} local echo | | $(pwd)
+&& --verbose | local printf done readonly 'quoted text'
+sed | -eu x=1 sed done done sed | export awk export x=1 $(pwd) $(pwd) readonly
+	"$1" then "$@" "$1" "$@" readonly x=1
+done cd /usr/bin done sed "$1" then "$@" printf | x=1 export
+		'quoted text' ${HOME} cd cd --verbose 'quoted text'
+	| $(pwd) 'quoted text' done sed
+	x=1 test "$@" local /usr/bin test then export then cd /usr/bin | -eu done then
+sed | 'quoted text' then readonly -eu --verbose "$1" &&
+	grep ${HOME} echo grep ${HOME} | $(pwd) echo x=1 2>/dev/null
+	grep $(pwd) sed local sed && --verbose export local ${HOME} printf --verbose
+	local $(pwd) printf export "$1"
+		"$1" 'quoted text' done sed &&
+	$(pwd) echo readonly echo echo ${HOME}
+		$(pwd) $(pwd) /usr/bin local
+readonly local awk then test
+		readonly echo local grep awk printf cd && cd /usr/bin sed awk
+	&& -eu x=1 && $(pwd) export $(pwd) ${HOME} --verbose
+&& then awk | test 2>/dev/null test ${HOME} 'quoted text' | /usr/bin export
+		sed && "$@" "$1" awk awk "$@" x=1 -eu -eu cd grep ${HOME}
+		local local printf "$@" test then | "$1" "$@" && sed test then --verbose "$@"
+		--verbose && ${HOME} printf local done sed grep printf
+	-eu local export 'quoted text' echo ${HOME} test
+	test grep $(pwd) 2>/dev/null awk export readonly -eu grep test readonly -eu grep
+		awk && grep awk "$1" grep export grep 'quoted text' grep
+sed export "$1" done cd "$1" $(pwd)
+-eu echo ${HOME} /usr/bin "$@" x=1 grep && ${HOME} sed x=1 /usr/bin echo /usr/bin
+		readonly then sed echo | test x=1 --verbose -eu /usr/bin
+		export awk --verbose 'quoted text' x=1 --verbose cd cd x=1 ${HOME}
+cd test x=1 ${HOME} | printf 2>/dev/null
+		| 'quoted text' /usr/bin x=1
+		grep grep export printf $(pwd) local cd x=1 sed 'quoted text'
+-eu export "$@" cd test printf | && done 'quoted text' /usr/bin
+readonly test "$1" 'quoted text' printf grep /usr/bin
+		2>/dev/null 'quoted text' "$@" readonly export export readonly printf then 'quoted text'
+	then echo "$1" --verbose echo "$1" 'quoted text'
+		-eu 'quoted text' "$@" -eu
+		2>/dev/null local "$@" -eu
+		echo 2>/dev/null test printf echo done readonly test ${HOME}
+export export && then $(pwd) "$1" && printf export awk printf $(pwd) cd
+		echo "$@" grep then -eu /usr/bin
+| echo printf cd readonly readonly -eu && $(pwd) "$1" local "$@" --verbose 'quoted text'
+	awk then 2>/dev/null ${HOME} ${HOME} && sed 2>/dev/null $(pwd) x=1 done x=1
+${HOME} && then x=1 sed printf x=1 "$1" then "$1" awk readonly "$@"
+		x=1 cd awk && test ${HOME} /usr/bin "$1" /usr/bin "$@" then -eu readonly
+		/usr/bin | printf -eu x=1 done
+--verbose test --verbose
+		local /usr/bin sed printf $(pwd)
+	done grep "$@" && local -eu x=1 test "$@" 'quoted text'
+		awk "$1" echo --verbose "$1" 2>/dev/null "$@" $(pwd) local test /usr/bin
+		awk | then then 'quoted text'
+awk export "$@" sed | -eu sed cd sed "$@" sed export done && "$1" local
+	sed --verbose x=1 grep sed 'quoted text' done --verbose test test && ${HOME}
+export $(pwd) then local done | "$1" 2>/dev/null printf "$@" awk readonly
+		&& --verbose printf "$@" printf echo then 2>/dev/null echo printf then
+		2>/dev/null ${HOME} ${HOME} test local $(pwd) sed "$1" local /usr/bin
+		'quoted text' printf -eu grep ${HOME} --verbose 'quoted text' cd "$@" --verbose
+	test sed grep ${HOME} readonly ${HOME} ${HOME} then cd then local ${HOME}
+		then 'quoted text' done test 'quoted text' local cd echo 'quoted text'
+	-eu --verbose --verbose export
+	cd 'quoted text' awk ${HOME} ${HOME} 'quoted text' done 2>/dev/null readonly 'quoted text'
+"$1" printf done 'quoted text' cd | |
+cd "$1" echo echo readonly export echo export export
+	2>/dev/null -eu && x=1 echo then -eu "$1" $(pwd) done cd -eu
+	2>/dev/null echo done export | --verbose -eu $(pwd) $(pwd) export test | printf
+		export 'quoted text' cd sed
+	"$@" sed export x=1 then && local 'quoted text' $(pwd) ${HOME}
+	printf readonly "$1" export cd /usr/bin 2>/dev/null
+| "$1" test cd echo done test $(pwd) cd 2>/dev/null
+&& grep then "$@" done 2>/dev/null
+2>/dev/null then cd x=1 cd ${HOME} /usr/bin done /usr/bin awk
+		'quoted text' readonly echo done local /usr/bin export x=1
+		"$1" $(pwd) awk readonly printf export local
+	cd ${HOME} | then && $(pwd) | /usr/bin
+		-eu test -eu done sed echo cd
+		cd then test x=1 cd local ${HOME} readonly printf 2>/dev/null
+	export export printf -eu /usr/bin ${HOME} cd grep ${HOME} export ${HOME}
+'quoted text' --verbose grep awk
+		$(pwd) export x=1 echo $(pwd) export 'quoted text' awk
+cd done | -eu awk then printf ${HOME} test && local ${HOME} then 'quoted text'
+		-eu 'quoted text' -eu sed export -eu then $(pwd)
+done sed local && -eu export ${HOME} /usr/bin "$1" sed | echo local readonly
+	local "$1" sed printf "$1" 2>/dev/null printf grep readonly
+	local | echo export then export x=1 printf echo /usr/bin export export 2>/dev/null
+local -eu grep export test /usr/bin x=1 x=1 awk ${HOME}
+| printf $(pwd) $(pwd) 2>/dev/null x=1 readonly $(pwd) /usr/bin done 2>/dev/null
+		2>/dev/null local sed 'quoted text' grep echo "$1" $(pwd)
+		${HOME} echo sed /usr/bin /usr/bin readonly -eu "$@" 'quoted text'
+		'quoted text' done "$@" && x=1 ${HOME} cd readonly ${HOME} "$1" $(pwd)
+test "$1" 'quoted text' --verbose --verbose sed then "$@" printf $(pwd) x=1
+	/usr/bin echo done "$@" 2>/dev/null
+	printf x=1 then printf awk ${HOME} 2>/dev/null x=1 printf local
+	$(pwd) -eu grep test x=1 "$@" grep cd awk | printf
+	test x=1 && x=1 'quoted text' 2>/dev/null 2>/dev/null
+		&& readonly local | && awk && local export grep test test printf "$@" /usr/bin
+		test 2>/dev/null printf done export | x=1 export then x=1
+		readonly && "$@" local
+	done && printf 'quoted text'
+		$(pwd) test --verbose grep awk $(pwd) readonly
+	${HOME} test local ${HOME} echo | --verbose | "$@" 'quoted text'
+		export done $(pwd) done /usr/bin grep ${HOME} -eu cd test test "$1" 2>/dev/null
+	"$1" awk && test -eu 2>/dev/null echo
+2>/dev/null grep done -eu test echo
+	export then $(pwd) sed 2>/dev/null
+		export ${HOME} $(pwd) && done echo --verbose export /usr/bin x=1
+	--verbose -eu local $(pwd) awk echo export test
+	cd grep done "$1" | x=1 readonly
+	sed $(pwd) grep 2>/dev/null done printf done "$@" awk "$1" then local ${HOME}
+${HOME} -eu printf cd grep
+then -eu -eu local export cd | local --verbose sed export /usr/bin | "$@" x=1 x=1
+		echo done ${HOME} && sed echo readonly 2>/dev/null
+/usr/bin echo done awk "$1" x=1 then cd "$@" |
+	cd "$1" 'quoted text' export sed -eu | "$@" test
+printf "$@" readonly test | printf | test sed x=1 2>/dev/null grep
+		then /usr/bin "$1" done ${HOME} 2>/dev/null export 'quoted text' 'quoted text'
+$(pwd) test local x=1 2>/dev/null echo "$1" 'quoted text' export
+	grep readonly awk awk printf sed | /usr/bin cd "$@" test awk ${HOME}
+then "$1" --verbose then export export ${HOME} "$@" $(pwd) &&
+cd 2>/dev/null done 'quoted text' printf then printf
+--verbose echo | readonly
+		'quoted text' test --verbose grep echo printf done cd "$@" 'quoted text'
+	local then local $(pwd) test sed 'quoted text'
+echo | cd | cd && x=1 "$1" && local | cd printf $(pwd) && awk && --verbose
+$(pwd) $(pwd) grep local 2>/dev/null readonly readonly sed sed
+		"$@" -eu -eu -eu done -eu
+	2>/dev/null -eu ${HOME} cd 'quoted text' 'quoted text' | 2>/dev/null | "$@" "$@"
+awk /usr/bin then then done echo "$1"
+		grep "$@" | printf $(pwd)
+	2>/dev/null cd x=1 export -eu -eu ${HOME} readonly $(pwd) x=1 | --verbose 2>/dev/null
+		'quoted text' awk | printf echo printf done cd && done "$@" | -eu "$1"
+		echo ${HOME} -eu "$1" test | sed echo 2>/dev/null
+| sed printf export ${HOME} echo sed test sed readonly
+		awk awk export grep -eu then then grep printf
+$(pwd) readonly echo local
+$(pwd) export | echo echo x=1 && echo done $(pwd) "$1" awk "$1" -eu &&
+		| local local echo readonly
+		export -eu $(pwd) grep done readonly 'quoted text' | $(pwd) printf --verbose -eu
+	grep then /usr/bin readonly | --verbose && then x=1 cd test grep sed ${HOME}
+printf readonly cd cd export grep
+		local cd sed | "$1" readonly --verbose 'quoted text' readonly
+grep $(pwd) test ${HOME} test echo local export sed printf cd
+	2>/dev/null 2>/dev/null sed "$@" cd "$@" --verbose sed $(pwd)
+printf local echo grep sed test $(pwd) readonly x=1 grep -eu readonly ${HOME}
+	printf test cd sed "$1" then local "$@" then | grep then ${HOME} grep readonly
+		$(pwd) -eu export ${HOME} --verbose awk cd sed then ${HOME} done "$@" 2>/dev/null
+readonly test && ${HOME} awk printf local
+	/usr/bin --verbose echo x=1
+	${HOME} awk | /usr/bin printf local awk && grep
+	done echo export done && then test cd ${HOME} "$@" $(pwd) local export 'quoted text'
+		done cd x=1 'quoted text' 'quoted text' readonly awk /usr/bin
+		x=1 "$1" "$@" local | 'quoted text' "$1" export
+		"$@" && readonly cd ${HOME} cd && -eu "$1" |
+		| cd 'quoted text' local local /usr/bin
+		done test cd /usr/bin
+export | printf /usr/bin /usr/bin --verbose "$@" ${HOME} /usr/bin awk
+cd test echo x=1 "$1" local --verbose grep
+		test sed 2>/dev/null cd | grep printf
+test 2>/dev/null grep -eu "$@" | printf --verbose sed printf grep "$@"
+		'quoted text' -eu grep readonly && done
+	echo printf 2>/dev/null /usr/bin export
+$(pwd) awk ${HOME} cd sed && "$@" ${HOME}
+	-eu sed local test x=1 "$@" && readonly x=1 -eu local $(pwd) cd
+		grep printf && /usr/bin
+	x=1 --verbose readonly $(pwd) 'quoted text' "$1" done ${HOME} sed then x=1 readonly
+	| awk "$@" 2>/dev/null
+'quoted text' | printf --verbose
+		test | test 2>/dev/null "$@" "$1" printf
+	then done 2>/dev/null 2>/dev/null /usr/bin awk then grep 2>/dev/null
+	/usr/bin "$1" local echo -eu $(pwd) export "$1" sed then grep -eu ${HOME}
+	echo && /usr/bin awk then ${HOME} test --verbose -eu local test done -eu echo
+cd x=1 sed ${HOME} sed --verbose sed then && printf local "$1" awk ${HOME}
+	printf "$1" --verbose | done printf && printf --verbose grep awk ${HOME} awk /usr/bin
+		cd then 'quoted text' /usr/bin
+		printf 2>/dev/null | && echo -eu export
+	printf awk /usr/bin --verbose awk test 2>/dev/null
+done --verbose -eu /usr/bin -eu
+		&& test then "$@" $(pwd) readonly readonly
+	grep echo export "$1" sed grep -eu readonly readonly done
+		/usr/bin "$@" ${HOME} x=1 grep then | local local then ${HOME} | 2>/dev/null
+	echo printf printf printf
+		then "$1" local then grep 'quoted text' done "$@" ${HOME} echo cd local 2>/dev/null
+	echo /usr/bin -eu 2>/dev/null local awk 'quoted text' cd echo "$@" done --verbose
+	done grep local awk cd "$1" printf 2>/dev/null readonly
+	readonly "$1" -eu sed grep
+printf 'quoted text' ${HOME} /usr/bin sed local printf sed sed ${HOME} ${HOME}
+		local awk 2>/dev/null /usr/bin -eu then test export sed --verbose done
+${HOME} test --verbose /usr/bin $(pwd) done grep printf /usr/bin echo test
+	cd echo -eu echo 2>/dev/null
+| 2>/dev/null echo | "$@" "$@" | 2>/dev/null x=1 "$@"
+		-eu 2>/dev/null && 'quoted text' readonly then "$@" done -eu printf awk
+echo "$@" | && grep -eu
+	"$@" "$1" then cd 2>/dev/null "$1" $(pwd) --verbose awk
+	local "$@" x=1 'quoted text' sed && done
+cd $(pwd) "$1" 2>/dev/null "$@" export echo
+printf printf | then awk local $(pwd) /usr/bin
+		"$@" readonly -eu printf test printf grep awk "$1" "$1" done printf --verbose grep
+	awk && 'quoted text' x=1 ${HOME} grep 2>/dev/null echo cd ${HOME} printf
+		printf && echo x=1 readonly readonly 'quoted text' echo printf
+		cd echo local grep 2>/dev/null x=1 echo
+	'quoted text' | "$1" sed ${HOME}
+export && cd 2>/dev/null | export -eu sed test readonly 'quoted text' /usr/bin
+		echo test /usr/bin &&
+		| local --verbose readonly
+local "$1" --verbose readonly -eu "$@" /usr/bin
+	cd /usr/bin done && /usr/bin readonly awk done sed ${HOME} export then
+$(pwd) export echo cd readonly --verbose | x=1 export "$@" -eu done &&
+/usr/bin x=1 cd | then x=1 then then sed --verbose 2>/dev/null
+test /usr/bin ${HOME}
+		cd ${HOME} awk local cd then awk cd readonly "$@" "$1" | && 2>/dev/null | printf
+readonly test local then sed then "$@" 2>/dev/null export
+"$1" $(pwd) printf cd 'quoted text' printf ${HOME}
+	local && "$@" --verbose "$1" test /usr/bin /usr/bin ${HOME}
+$(pwd) readonly cd awk ${HOME} 2>/dev/null ${HOME} sed grep x=1 -eu 2>/dev/null
+printf x=1 export printf -eu awk x=1 && "$@" cd readonly
+		"$@" /usr/bin 'quoted text' --verbose
+local export /usr/bin local awk 'quoted text' export local ${HOME} done --verbose
+cd cd printf local --verbose
+	then ${HOME} ${HOME} && readonly && then export awk awk local
+| 2>/dev/null ${HOME} "$@" && then ${HOME} "$@"
+local "$@" done echo "$1" && cd $(pwd) readonly
+	grep cd 2>/dev/null test --verbose export "$@"
+		grep -eu test | ${HOME} printf 2>/dev/null
+	export printf ${HOME} export grep test
+cd echo "$@" | sed done $(pwd) ${HOME} ${HOME} then
+then && then printf local "$@" -eu export awk awk test 2>/dev/null
+	--verbose 2>/dev/null 2>/dev/null
+	echo local -eu --verbose $(pwd) -eu "$@" cd
+cd x=1 ${HOME} readonly x=1 "$1" --verbose grep sed "$@"
+	"$1" && "$@" -eu 2>/dev/null awk grep 'quoted text' done cd --verbose then
+		'quoted text' -eu | /usr/bin test export 2>/dev/null local
+readonly echo "$1" -eu "$1" ${HOME} done test export "$1"
+	| --verbose sed cd readonly
+-eu | then then x=1 | readonly 2>/dev/null
+		&& | $(pwd) && "$@" $(pwd) $(pwd) local -eu 2>/dev/null then
+	printf ${HOME} 'quoted text'
+	done echo then grep ${HOME} 2>/dev/null
+-eu awk then && grep | | /usr/bin $(pwd) /usr/bin test
+	cd -eu then $(pwd) --verbose 'quoted text' grep then | 2>/dev/null local -eu
+		sed 'quoted text' sed 'quoted text' sed -eu local
+		&& 'quoted text' printf echo /usr/bin -eu export && local grep
+	grep $(pwd) echo 2>/dev/null ${HOME} done
+cd sed local then "$@" /usr/bin readonly &&
+--verbose readonly -eu echo "$1" done export "$@" x=1 /usr/bin
+		${HOME} done -eu $(pwd)
+		x=1 local "$@" /usr/bin | "$1" printf local ${HOME}
+		${HOME} "$@" sed "$1" | /usr/bin | ${HOME} | printf ${HOME} 2>/dev/null
+export printf "$@" && "$@" test --verbose $(pwd) 'quoted text'
+x=1 ${HOME} -eu awk | echo grep sed cd "$1" then
+x=1 grep "$@" -eu awk "$@" -eu "$@" export
+		test 2>/dev/null then readonly done 'quoted text' test grep export sed && export
+--verbose cd test cd -eu x=1 cd sed x=1 test |
+--verbose echo printf awk -eu 'quoted text'
+	readonly "$1" | | local awk
+	'quoted text' "$@" --verbose $(pwd) grep local sed 'quoted text' local
+&& grep --verbose | -eu sed ${HOME} $(pwd) awk cd
+		${HOME} "$@" readonly
+	/usr/bin echo cd export test "$@" "$@" ${HOME} echo
+local awk x=1 | ${HOME} local $(pwd) echo "$1" 2>/dev/null grep cd printf ${HOME}
+		$(pwd) awk grep grep 'quoted text' echo x=1
+echo local cd grep && cd done export | ${HOME} then local cd -eu x=1 then echo "$1"
+"$1" readonly local && && ${HOME} sed grep local echo cd cd "$@" 2>/dev/null
+-eu grep --verbose && echo sed "$1" $(pwd) ${HOME} 'quoted text'
+	&& local "$1" ${HOME} echo
+&& cd readonly readonly $(pwd) grep sed local readonly 2>/dev/null 'quoted text'
+	printf readonly && export
+	"$@" --verbose test ${HOME} && | $(pwd) cd
+	test grep | && ${HOME} "$@" $(pwd)
+		then ${HOME} ${HOME} $(pwd) -eu /usr/bin local | && local "$1"
+		x=1 sed awk then /usr/bin 2>/dev/null /usr/bin
+	--verbose ${HOME} && printf $(pwd) "$1"
+	-eu x=1 x=1 "$@" 2>/dev/null /usr/bin /usr/bin | /usr/bin
+		$(pwd) $(pwd) sed --verbose echo test done done -eu x=1 printf test && $(pwd)
+		grep 'quoted text' echo && export echo "$@"
+cd test && -eu ${HOME} x=1 --verbose
+	echo cd "$@" -eu "$1" done local
+		$(pwd) --verbose | echo local 2>/dev/null
+	| readonly done "$1" done -eu "$1" 'quoted text' local -eu printf
+	x=1 "$@" "$@" && export readonly "$1" $(pwd) done export /usr/bin --verbose ${HOME}
+		-eu 2>/dev/null --verbose sed printf 2>/dev/null "$1" "$1" test -eu -eu
+		printf $(pwd) local --verbose --verbose -eu readonly x=1 $(pwd) $(pwd) --verbose
+'quoted text' | sed echo grep sed sed local done "$@" ${HOME}
+	x=1 local grep --verbose echo
+	/usr/bin -eu x=1 'quoted text'
+	test -eu --verbose printf -eu ${HOME}
+readonly "$1" $(pwd) cd export "$@" 2>/dev/null grep /usr/bin 2>/dev/null $(pwd)
+	readonly printf readonly grep
+printf local local export sed then awk
+		$(pwd) printf readonly | sed 2>/dev/null
+test 2>/dev/null "$1" cd sed awk local
+--verbose 2>/dev/null 'quoted text' done
+		export && -eu ${HOME} $(pwd) sed | | $(pwd) cd sed 'quoted text'
+		printf grep done 'quoted text' echo then
+readonly && /usr/bin 'quoted text' | x=1 --verbose printf done
+		echo ${HOME} && readonly --verbose --verbose ${HOME} /usr/bin
+		"$1" readonly --verbose awk grep "$1"
+	echo && "$@" local then awk "$@"
+	-eu readonly printf test
+done $(pwd) awk test local && done && && then "$@" ${HOME}
+		grep done sed export export local /usr/bin awk "$@" "$1" $(pwd)
+x=1 /usr/bin awk 'quoted text' export test
+	sed $(pwd) ${HOME} sed --verbose
+-eu local printf awk test sed /usr/bin
+/usr/bin $(pwd) local local --verbose awk $(pwd) awk printf x=1
+	${HOME} ${HOME} test printf $(pwd)
+		$(pwd) /usr/bin $(pwd) export "$1" printf grep ${HOME}
+readonly test readonly && echo 'quoted text' x=1 then "$@" ${HOME} export
+		awk readonly done grep ${HOME}
+	-eu /usr/bin ${HOME} "$@" export done
+		awk 'quoted text' "$@" -eu printf ${HOME} awk grep printf printf $(pwd)
+--verbose awk ${HOME} echo cd "$1" then "$@" -eu && awk 2>/dev/null "$@" sed 'quoted text'
+	export | ${HOME} echo export "$1" printf local -eu test
+	then "$1" export echo local then
+		echo echo /usr/bin readonly &&
+	${HOME} $(pwd) -eu 2>/dev/null test 'quoted text'
+		--verbose grep /usr/bin | then printf 2>/dev/null awk "$@" readonly grep -eu |
+	test "$@" /usr/bin "$@" readonly echo 'quoted text'
+	"$1" cd grep export && test && cd awk ${HOME} sed /usr/bin
+		--verbose "$1" "$1" test grep /usr/bin
+		2>/dev/null awk $(pwd) awk grep x=1 x=1 -eu cd --verbose /usr/bin grep
+	done "$1" awk awk then sed readonly
+	sed export 'quoted text' | test /usr/bin "$1" -eu
+x=1 cd --verbose cd then local awk sed 2>/dev/null --verbose local x=1 then
+-eu ${HOME} printf sed readonly then
+	export test local 'quoted text' echo && "$1" --verbose then && test ${HOME}
+	echo local cd local ${HOME} && && awk -eu -eu awk /usr/bin
+		export then && -eu "$1" test grep done
+		grep 2>/dev/null printf grep local
+	/usr/bin export done 2>/dev/null && x=1 printf "$@"
+"$@" 'quoted text' /usr/bin test && /usr/bin
+		| ${HOME} && test | && test awk test printf
+		done cd echo done echo awk -eu printf
+--verbose 2>/dev/null printf
+	"$1" export x=1 x=1 echo "$1" "$1" -eu then --verbose
+readonly /usr/bin --verbose -eu "$@" test $(pwd)
+		| "$1" sed 'quoted text' test export cd done test grep then readonly
+echo cd "$@" /usr/bin export grep
+done && export "$@" --verbose test "$@" sed x=1 'quoted text' sed 'quoted text'
+grep --verbose sed grep -eu then x=1 awk grep x=1 sed test awk /usr/bin -eu grep
+awk "$1" ${HOME} ${HOME} grep x=1
+		export $(pwd) 2>/dev/null -eu -eu
+	local cd ${HOME} "$1" --verbose "$@" printf 'quoted text' local $(pwd)
+	local local "$1" cd cd --verbose
+		printf ${HOME} then | "$1" "$1" printf | test
+	2>/dev/null && -eu /usr/bin
+test cd -eu $(pwd) && ${HOME} awk then ${HOME} printf "$1"
+	${HOME} grep -eu export /usr/bin
+| grep "$@" 2>/dev/null awk "$1" local awk readonly cd export
+		"$@" 2>/dev/null grep x=1 'quoted text'
+sed export ${HOME} done test --verbose grep
+	'quoted text' /usr/bin && awk echo --verbose /usr/bin
+	done done test awk awk echo -eu "$@" --verbose echo local $(pwd) echo
+-eu cd "$@" sed then printf 2>/dev/null test 'quoted text'
+		| sed -eu readonly cd cd ${HOME} ${HOME}
+		| readonly echo grep ${HOME} "$1" /usr/bin echo grep awk then echo "$@" /usr/bin
+/usr/bin export done local sed test --verbose 'quoted text' sed test ${HOME}
+	grep 2>/dev/null local test
+		then printf "$@" 2>/dev/null printf local
+x=1 --verbose 'quoted text' ${HOME} then 2>/dev/null $(pwd) | -eu
+		-eu 'quoted text' grep awk ${HOME}
+	export x=1 'quoted text'
+	export grep $(pwd) then "$@" grep $(pwd) ${HOME} grep sed $(pwd)
+		-eu then x=1 export $(pwd) awk "$@" cd echo sed printf then && "$@"
+	${HOME} -eu 'quoted text' -eu --verbose then export grep
+	cd && echo echo -eu -eu -eu /usr/bin x=1 sed 2>/dev/null
+	"$@" then 2>/dev/null 2>/dev/null x=1 awk ${HOME} $(pwd) 2>/dev/null readonly
+		"$1" sed readonly | done ${HOME}
+&& readonly | sed test $(pwd) local | grep echo
+local done readonly sed then printf awk readonly cd "$1"
+-eu | local awk echo grep echo 2>/dev/null sed "$@" x=1
+	2>/dev/null test $(pwd) then awk $(pwd) export ${HOME} 'quoted text' cd awk 'quoted text'
+	awk ${HOME} x=1 2>/dev/null "$@" done then cd done && --verbose
+		"$@" local sed $(pwd) 2>/dev/null done && | 'quoted text' echo "$1" ${HOME}
+cd "$@" /usr/bin "$1" grep cd "$@" readonly "$1" x=1 printf -eu then /usr/bin
+		&& | export echo test export x=1 export ${HOME}
+		printf 'quoted text' && sed --verbose -eu sed && readonly
+-eu local -eu then ${HOME} printf done test cd $(pwd)
+	export local then local cd 2>/dev/null
+		-eu printf export "$@" | echo local grep | printf
+	done && | x=1 printf cd | export echo
+test && $(pwd) local | /usr/bin printf && awk && then then $(pwd)
+		-eu 2>/dev/null export done echo x=1 then test -eu awk readonly sed 'quoted text'
+		export sed | echo $(pwd) export local then /usr/bin -eu done export test 'quoted text'
+		printf -eu x=1 ${HOME} "$@" test done grep x=1 ${HOME} test readonly x=1 $(pwd)
+$(pwd) echo local printf echo "$1" && export echo ${HOME} local
+printf printf "$1" echo /usr/bin
+"$@" awk printf printf 2>/dev/null cd | 'quoted text' grep $(pwd) done done
+local awk done 2>/dev/null
+/usr/bin /usr/bin 2>/dev/null sed 'quoted text' ${HOME} done
+	grep test -eu | -eu "$1" awk x=1 export
+sed /usr/bin export cd echo
+	awk awk -eu "$1" x=1 -eu printf export
+		$(pwd) -eu printf --verbose test
+	grep 'quoted text' test sed "$@" sed awk &&
+printf -eu --verbose export "$1" && local echo echo
+'quoted text' export ${HOME} local readonly readonly export
+/usr/bin done ${HOME} grep x=1 test $(pwd) grep
+	then "$1" | echo && printf
+		then printf -eu "$1" /usr/bin
+"$@" printf awk awk ${HOME} "$@" local $(pwd) awk readonly
+sed && "$@" echo awk test --verbose -eu | then && done
+		sed $(pwd) --verbose 2>/dev/null cd readonly test $(pwd) $(pwd) cd
+awk $(pwd) ${HOME} readonly
+	then printf | --verbose --verbose
+'quoted text' local x=1
+		awk local "$@" sed /usr/bin "$1" 'quoted text' 2>/dev/null | "$1"
+	2>/dev/null && "$1" "$@" $(pwd) export 2>/dev/null "$@"
+	x=1 printf printf then
+printf local 2>/dev/null ${HOME} echo then
+		'quoted text' local echo
+local cd && x=1 x=1 grep then readonly "$@" "$1" --verbose /usr/bin
+		$(pwd) cd "$1" then x=1 && | echo awk sed --verbose export sed x=1
+	grep $(pwd) "$@" ${HOME} local echo local -eu --verbose $(pwd) grep && readonly
+printf 'quoted text' ${HOME} awk echo /usr/bin sed done export readonly
+"$@" test /usr/bin printf export && -eu "$@" grep awk
+awk local "$@" cd /usr/bin && $(pwd) --verbose
+${HOME} --verbose "$1" --verbose /usr/bin && sed ${HOME} /usr/bin grep
+	then test "$1" "$1" export echo x=1 cd awk -eu -eu | awk local && local
+	&& awk awk ${HOME} export "$@" "$1" export | export
+	$(pwd) then --verbose done readonly -eu grep readonly | echo test ${HOME}
+	${HOME} -eu && printf x=1 2>/dev/null echo 2>/dev/null test echo then 'quoted text'
+		done --verbose "$@" /usr/bin grep printf
+| --verbose x=1 && cd echo then test done "$@" local
+$(pwd) ${HOME} && export
+		"$1" export then sed test awk sed readonly 2>/dev/null
+	test "$@" && 'quoted text' $(pwd) done
+		cd x=1 awk grep 'quoted text'
+x=1 -eu /usr/bin 'quoted text'
+	| ${HOME} readonly export grep cd awk test ${HOME} && cd ${HOME}
+	readonly done | "$@" | export local test "$1"
+		printf export "$@" /usr/bin cd 'quoted text' then "$@" test 'quoted text' "$1" readonly
+	readonly local ${HOME} echo echo ${HOME} readonly "$@" test --verbose then $(pwd)
+$(pwd) cd sed && export sed "$1" "$@"
+	test ${HOME} -eu 'quoted text' 'quoted text' x=1 x=1 ${HOME}
+--verbose test local grep sed -eu grep local
+	&& export && echo --verbose
+	then grep 2>/dev/null 2>/dev/null grep awk grep /usr/bin
+-eu x=1 x=1 x=1 grep -eu /usr/bin 2>/dev/null grep $(pwd) sed test
+-eu grep test $(pwd) x=1 readonly export
+&& then then x=1 -eu cd --verbose "$@" export done printf
+		test "$@" /usr/bin test grep echo done local sed
+		$(pwd) | printf ${HOME} $(pwd) printf done && done done
+	/usr/bin 'quoted text' ${HOME} 2>/dev/null awk echo x=1
+	"$@" sed cd then -eu "$@" ${HOME} | awk printf $(pwd) printf then printf ${HOME}
+sed grep cd test readonly done local 2>/dev/null -eu 'quoted text'
+	${HOME} readonly echo echo 2>/dev/null done test -eu /usr/bin then ${HOME} readonly
+	$(pwd) readonly test readonly 2>/dev/null local | 'quoted text'
+	export then readonly && local sed cd done $(pwd) ${HOME}
+		2>/dev/null --verbose sed 'quoted text' /usr/bin
+-eu test "$@" $(pwd) export local 2>/dev/null test export -eu -eu printf echo readonly
+	awk "$1" 2>/dev/null && awk -eu readonly
+	cd 2>/dev/null "$@" ${HOME} $(pwd) grep then readonly
+		export ${HOME} readonly
+	grep awk cd export --verbose
+"$1" grep && local cd $(pwd) | export $(pwd) --verbose
+		&& export --verbose | cd test x=1 cd 2>/dev/null printf ${HOME} awk
+readonly then then 2>/dev/null local
+		sed | ${HOME} "$1" ${HOME} export cd test --verbose "$@"
+	| -eu x=1 test 'quoted text' $(pwd)
+$(pwd) export && test grep -eu test x=1 "$@" 'quoted text'
+	"$1" 2>/dev/null | cd sed $(pwd) then "$1" "$1" readonly
+x=1 "$1" local then ${HOME}
+-eu -eu ${HOME} -eu "$@" then | echo test grep then cd export readonly
+"$1" "$1" local "$@" export local test local
+		test $(pwd) -eu done ${HOME} sed sed "$1" grep
+		sed x=1 x=1 ${HOME} sed done then sed sed test "$@"
+		| && "$@" local echo --verbose then then sed --verbose
+		'quoted text' awk test then
+x=1 done x=1 printf $(pwd) 'quoted text' sed /usr/bin test grep test | local
+'quoted text' test done test test /usr/bin local then && "$@" export 2>/dev/null
+test "$@" sed awk echo then ${HOME} then test export && "$1" | --verbose
+"$1" --verbose --verbose x=1 'quoted text' awk -eu 2>/dev/null export "$1"
+	sed "$1" echo sed cd "$@" -eu cd /usr/bin && | 2>/dev/null
+		local export cd $(pwd)
+	local x=1 readonly -eu $(pwd) ${HOME} "$@" then grep &&
+"$1" readonly sed "$@" "$1" grep --verbose then $(pwd) $(pwd) 'quoted text' &&
+-eu cd sed --verbose test && 'quoted text' ${HOME} printf 'quoted text' $(pwd) readonly
+	"$1" $(pwd) "$1" sed ${HOME} | $(pwd)
+-eu echo echo --verbose done 'quoted text' awk | | ${HOME} printf
+	x=1 test echo readonly /usr/bin $(pwd) test /usr/bin && "$1" $(pwd) $(pwd)
+	done "$1" done && $(pwd) 2>/dev/null "$1" echo printf printf awk x=1 echo
+	local --verbose "$1" printf 'quoted text' 'quoted text' 'quoted text'
+		"$@" "$@" "$@" ${HOME} printf printf echo $(pwd) grep /usr/bin sed --verbose 'quoted text'
+	done export && sed $(pwd)
+${HOME} local awk 2>/dev/null "$1" $(pwd) grep &&
+cd --verbose /usr/bin export done grep -eu printf --verbose x=1 cd printf "$@"
+		awk printf "$@" && 'quoted text' 2>/dev/null
+"$1" -eu "$1" test cd --verbose --verbose then /usr/bin && done
+"$1" "$@" x=1 x=1 "$@" done then cd done awk "$1" | -eu $(pwd)
+"$1" done && "$@" "$1" && "$@" $(pwd)
+$(pwd) ${HOME} /usr/bin -eu printf x=1 readonly ${HOME} grep
+		readonly 'quoted text' awk x=1 'quoted text' "$@" ${HOME} export ${HOME}
+	readonly then export -eu 'quoted text' --verbose x=1
+		sed | "$@" && local done export printf
+	/usr/bin sed /usr/bin readonly 'quoted text' 'quoted text'
+		2>/dev/null && then "$@" local --verbose 2>/dev/null
+sed $(pwd) then x=1 cd readonly then then then printf test /usr/bin
+		-eu sed test printf echo $(pwd) "$@" grep printf local $(pwd)
+		-eu ${HOME} awk | echo ${HOME} "$@" 2>/dev/null --verbose && && awk && done &&
+'quoted text' done readonly
+readonly sed ${HOME} "$1" local
+		'quoted text' && 2>/dev/null printf readonly export
+		'quoted text' --verbose awk -eu && 2>/dev/null | awk x=1 grep sed 'quoted text'
+2>/dev/null $(pwd) cd | cd /usr/bin "$@" /usr/bin $(pwd) export
+	${HOME} && export "$@" local | "$@" export /usr/bin && "$@" 'quoted text'
+		cd cd export $(pwd) | done && done cd test
+${HOME} readonly --verbose x=1 "$@" sed x=1
+		printf echo "$1" grep $(pwd) echo /usr/bin
+	local test grep 2>/dev/null export
+	-eu echo test --verbose && echo printf
+export x=1 x=1 "$1" grep local done readonly && "$@"
+		-eu "$1" ${HOME} ${HOME} 'quoted text' 'quoted text'
+sed "$1" "$1" "$@" "$1" | awk then echo test && 'quoted text' 'quoted text'
+		test /usr/bin --verbose test then test done grep x=1 echo /usr/bin
+"$@" readonly | echo 'quoted text' x=1 x=1 echo ${HOME} awk /usr/bin export
+		"$@" then -eu local echo test cd --verbose
+/usr/bin sed 'quoted text' "$@" awk grep x=1 2>/dev/null grep
+cd grep sed $(pwd) test readonly
+	"$1" | --verbose printf test cd readonly "$@" "$@" ${HOME} readonly "$1" --verbose
+	grep /usr/bin 2>/dev/null x=1 export export export awk printf grep
+	--verbose export done then echo echo cd 'quoted text'
+done awk && 2>/dev/null local | -eu cd done readonly test done cd 'quoted text'
+&& sed sed echo awk /usr/bin | /usr/bin
+	$(pwd) "$1" export readonly | done /usr/bin
+printf ${HOME} -eu x=1
+-eu awk 'quoted text' sed "$@" -eu /usr/bin 'quoted text'
+		sed awk --verbose test "$1" "$1" awk
+		$(pwd) --verbose awk 'quoted text' "$1" && cd 2>/dev/null x=1 2>/dev/null
+	printf /usr/bin sed export x=1 readonly grep | printf awk --verbose && --verbose
+echo "$1" done sed && --verbose "$@" $(pwd)
+	awk echo sed -eu echo ${HOME} x=1 --verbose sed /usr/bin
+		echo -eu $(pwd) sed $(pwd) -eu $(pwd) --verbose
+		${HOME} | export sed echo x=1 grep
+	${HOME} echo then done $(pwd) 'quoted text' printf echo && 2>/dev/null awk
+		${HOME} export grep printf
+	echo awk x=1 --verbose printf then | ${HOME} --verbose sed 'quoted text'
+	| "$@" -eu "$@" "$@" 'quoted text' $(pwd) grep echo /usr/bin
+	local echo export /usr/bin | --verbose printf
+-eu echo "$1" | && done x=1 sed "$1" | | cd /usr/bin
+	test export "$1" ${HOME} local local 2>/dev/null x=1
+	${HOME} $(pwd) 'quoted text' 'quoted text' printf readonly | awk
+	${HOME} "$1" export local ${HOME} echo x=1 "$1" 2>/dev/null 'quoted text' sed
+	/usr/bin grep readonly export x=1 /usr/bin -eu test 2>/dev/null ${HOME}
+		"$1" export test "$@" && x=1 grep
+	echo "$@" && export then
+		"$@" $(pwd) ${HOME} && cd | echo 2>/dev/null
+		test "$1" /usr/bin "$1" $(pwd) 2>/dev/null | $(pwd) 'quoted text' --verbose readonly
+		x=1 readonly ${HOME} test export 'quoted text' |
+-eu done --verbose sed && && cd
+	2>/dev/null local "$1" sed local
+&& "$@" cd x=1 echo cd
+	${HOME} "$@" readonly printf 'quoted text' test sed "$1" then printf
+		$(pwd) 2>/dev/null | && && grep export | echo echo /usr/bin export
+		test readonly awk export "$1" -eu grep
+awk then sed then "$@" $(pwd) | "$@" "$1" cd x=1 "$@" echo "$@" cd "$1" export
+		2>/dev/null && sed --verbose echo 2>/dev/null
+grep grep grep echo $(pwd) x=1 export ${HOME} "$@" ${HOME} $(pwd) |
+		done --verbose cd "$1" 2>/dev/null $(pwd)
+	grep export awk test then ${HOME} readonly sed -eu
+	export readonly echo $(pwd) 'quoted text' -eu
+		echo local "$@" "$@" "$1" cd && done /usr/bin $(pwd) done printf -eu cd cd
+2>/dev/null cd grep export echo done cd export readonly
+	"$1" echo sed --verbose "$@" grep test
+-eu 2>/dev/null x=1 local "$1" test
+		printf "$@" test grep && ${HOME} /usr/bin && x=1 --verbose "$1" echo export
+	then -eu then echo $(pwd) | printf x=1 readonly echo awk grep
+done 2>/dev/null sed 'quoted text' "$@" awk done --verbose local sed readonly
+		readonly test 'quoted text' test | printf done
+	local awk /usr/bin done sed echo readonly export 2>/dev/null echo 'quoted text'
+	'quoted text' export test -eu printf printf ${HOME}
+| cd export "$1" /usr/bin cd grep then
+	&& --verbose sed echo | done --verbose x=1 sed cd export --verbose
+done 2>/dev/null "$@" printf export readonly "$@" sed -eu local $(pwd) grep
+		local "$@" done "$1" | 2>/dev/null
+2>/dev/null sed --verbose -eu test printf && local "$1" local
+--verbose 2>/dev/null ${HOME} sed local
+	2>/dev/null test sed && printf export done test readonly $(pwd) awk 2>/dev/null
+-eu test cd 2>/dev/null test
+/usr/bin readonly done then && echo local done echo awk awk then
+		readonly /usr/bin -eu local cd export cd export 2>/dev/null
+	$(pwd) && export then
+/usr/bin | readonly awk then --verbose readonly && done sed 'quoted text'
+	readonly then export $(pwd) echo ${HOME} then ${HOME} 2>/dev/null 2>/dev/null
+		local echo 'quoted text' | $(pwd) 'quoted text' printf
+done grep ${HOME} ${HOME} --verbose /usr/bin echo local awk /usr/bin --verbose
+		readonly then cd cd "$@" grep printf printf | done
+echo test 2>/dev/null $(pwd) 'quoted text' awk export echo done "$@" test
+grep x=1 ${HOME} "$@" 2>/dev/null && echo ${HOME}
+then | /usr/bin cd $(pwd) printf /usr/bin /usr/bin 2>/dev/null
+	${HOME} printf export grep ${HOME} cd then cd --verbose
+grep export | done 'quoted text' export cd awk printf /usr/bin
+		'quoted text' readonly -eu echo 'quoted text'
+	/usr/bin && sed "$@" then cd printf grep
+$(pwd) then --verbose -eu x=1 | ${HOME} "$@" && cd |
+	x=1 then sed done 2>/dev/null export grep
+${HOME} && grep awk printf done cd x=1 local /usr/bin ${HOME}
+${HOME} grep grep export awk printf "$@" cd 2>/dev/null
+		awk cd cd printf echo done awk | printf readonly $(pwd) done
+		"$1" grep echo printf awk && done --verbose sed done -eu readonly 'quoted text'
+	-eu -eu "$@" awk | && cd printf $(pwd) cd local grep 2>/dev/null
+| then && 2>/dev/null grep x=1 then /usr/bin 'quoted text'
+'quoted text' 2>/dev/null
+		&& -eu $(pwd) 'quoted text' echo printf test
+"$@" cd readonly readonly "$1"
+'quoted text' --verbose "$1" --verbose printf sed "$@" done 'quoted text'
+		&& awk echo export readonly done 2>/dev/null
+		"$@" "$1" printf x=1 export printf readonly && export test x=1
+	&& awk 2>/dev/null 2>/dev/null sed awk done 'quoted text' then x=1 && -eu 'quoted text'
+		test "$1" | readonly | "$@" cd /usr/bin printf $(pwd) export readonly
+	readonly export ${HOME} printf awk done echo --verbose && x=1
+		/usr/bin x=1 && ${HOME} "$1" cd | printf done --verbose local x=1 | 'quoted text'
+	local grep "$1" awk x=1 done 'quoted text' "$@" 'quoted text' grep echo x=1
+		2>/dev/null done -eu ${HOME} && --verbose
+test $(pwd) sed then echo readonly
+		x=1 sed sed 2>/dev/null sed then sed done sed -eu
+	--verbose readonly then local sed
+'quoted text' $(pwd) test cd --verbose x=1 echo ${HOME} | |
+	sed printf x=1 then --verbose echo then readonly && grep 'quoted text'
+	${HOME} /usr/bin && export -eu "$@" -eu |
+done printf ${HOME} awk then -eu -eu ${HOME} local echo "$@" -eu $(pwd)
+export readonly /usr/bin $(pwd) sed | export $(pwd) /usr/bin x=1 test awk
+		-eu printf export cd -eu 'quoted text' grep printf "$1" | -eu awk
+	&& -eu ${HOME} readonly $(pwd)
+cd x=1 cd /usr/bin test
+		readonly readonly test | --verbose grep cd
+	sed -eu grep echo 2>/dev/null cd cd 2>/dev/null readonly
+cd "$@" echo 'quoted text' 2>/dev/null local
+	"$@" ${HOME} | echo test 'quoted text' ${HOME} sed done awk --verbose
+$(pwd) echo awk --verbose x=1 && local
+"$1" export sed echo ${HOME} readonly readonly
+	x=1 'quoted text' 2>/dev/null && x=1 x=1 && ${HOME} cd
+	"$1" && 2>/dev/null sed && sed "$1" "$@" 2>/dev/null echo local local ${HOME}
+	cd /usr/bin local --verbose
+sed export -eu x=1 then && x=1 $(pwd) export local -eu 'quoted text' $(pwd)
+"$1" awk sed test "$@" ${HOME} awk
+		"$1" local local echo 2>/dev/null
+	done cd done --verbose done -eu awk 2>/dev/null "$1" done export
+-eu echo done | export done "$@" done cd cd &&
+test then printf printf x=1 -eu "$@" -eu x=1 --verbose
+		"$1" test "$@" "$1" /usr/bin && cd 2>/dev/null
+x=1 awk then | cd done cd /usr/bin x=1 | echo | "$1" cd &&
+	--verbose x=1 "$1" x=1 grep
+sed then --verbose readonly --verbose
+		&& export sed | cd && --verbose local 'quoted text' | done 'quoted text'
+"$1" 2>/dev/null test $(pwd)
+		export awk done awk -eu grep sed test && test 'quoted text'
+"$1" 'quoted text' | done printf $(pwd)
+${HOME} done "$@" && done readonly 2>/dev/null /usr/bin /usr/bin
+		&& 'quoted text' test then grep cd "$@" sed grep && export then | x=1 done "$1"
+		--verbose cd printf $(pwd) "$1" done
+	--verbose grep export readonly export awk ${HOME}
+2>/dev/null export test $(pwd) then | && awk done 'quoted text'
+		2>/dev/null $(pwd) test local /usr/bin 'quoted text' then then
+		grep done export awk test readonly grep cd
+		then cd 'quoted text' grep grep grep /usr/bin 2>/dev/null ${HOME} readonly
+/usr/bin test cd 'quoted text'
+--verbose sed $(pwd) --verbose -eu grep echo test awk 2>/dev/null
+	then readonly echo readonly then awk x=1 ${HOME} printf
+readonly then test grep
+		export $(pwd) test grep test $(pwd) printf test sed --verbose awk 2>/dev/null
+		printf local x=1 /usr/bin then done --verbose && cd awk
+		--verbose -eu && echo cd done sed -eu test done /usr/bin sed $(pwd) /usr/bin
+		"$@" && grep ${HOME} echo awk printf --verbose && | export
+		${HOME} printf local -eu local 2>/dev/null test && --verbose
+	done -eu ${HOME} test 'quoted text' done /usr/bin printf --verbose
+	cd | "$@" x=1 test /usr/bin then export export 'quoted text' cd | "$@" sed
+		| awk --verbose 2>/dev/null cd awk cd grep $(pwd) 'quoted text'
+	"$@" local awk awk printf ${HOME} readonly x=1 grep test "$1" echo echo -eu
+"$@" readonly -eu done test awk
+	2>/dev/null x=1 --verbose done sed --verbose ${HOME} | local /usr/bin ${HOME}
+	&& x=1 export cd printf printf | x=1 printf | 'quoted text' "$@" done | readonly
+	--verbose cd ${HOME} printf local then 'quoted text' readonly echo 2>/dev/null
+		&& "$1" --verbose export x=1 sed
+	x=1 local done ${HOME}
+		--verbose -eu done export x=1 | 'quoted text' 2>/dev/null /usr/bin
+"$1" grep then awk awk export local "$1" --verbose
+		printf --verbose $(pwd) test 2>/dev/null
+	grep then awk done x=1 test $(pwd) && 2>/dev/null
+	test -eu -eu cd "$@" | "$1" then awk awk 2>/dev/null 'quoted text' 2>/dev/null
+	$(pwd) done && $(pwd) test cd "$@" done printf "$@"
+readonly done echo then ${HOME} local awk grep awk -eu readonly cd 'quoted text'
+		cd | 2>/dev/null "$@" /usr/bin then "$1" done
+	/usr/bin sed grep ${HOME} then done grep "$1" | then -eu -eu $(pwd)
+		--verbose printf $(pwd) /usr/bin printf local /usr/bin test
+	grep $(pwd) export done printf cd then | echo test && --verbose export
+printf awk awk awk && | done local test /usr/bin printf -eu
+		"$@" $(pwd) printf local ${HOME} --verbose --verbose printf cd 'quoted text'
+	-eu cd printf cd printf local "$@"
+$(pwd) echo 2>/dev/null
+then --verbose cd test $(pwd) && test local
+		cd local grep sed cd "$@"
+${HOME} /usr/bin ${HOME} "$@" "$1" -eu test
+local --verbose awk readonly
+	"$1" x=1 2>/dev/null -eu x=1 awk ${HOME} -eu export ${HOME} export cd
+printf grep -eu "$@" then "$@" | test /usr/bin printf && sed local
+		local -eu "$1" test done export grep test printf /usr/bin
+		cd /usr/bin | x=1 grep grep sed done cd ${HOME}
+		--verbose 'quoted text' x=1 "$1" ${HOME} readonly awk readonly | ${HOME} done --verbose
+	sed done export "$@" readonly 2>/dev/null
+	x=1 -eu -eu "$@" 2>/dev/null && cd ${HOME} grep x=1
+	| 2>/dev/null cd readonly readonly readonly echo cd printf cd 2>/dev/null ${HOME}
+		cd cd ${HOME} 'quoted text' readonly
+| printf then $(pwd) -eu test
+'quoted text' local test cd 'quoted text'
+cd | ${HOME} x=1 grep $(pwd) local && ${HOME} readonly printf cd 'quoted text'
+cd printf awk grep /usr/bin test then /usr/bin
+	then 'quoted text' export export | local x=1 x=1 "$1" ${HOME} 'quoted text'
+		echo export ${HOME} cd local ${HOME} -eu ${HOME} /usr/bin
+	grep 2>/dev/null grep then test printf printf test test $(pwd) /usr/bin
+/usr/bin /usr/bin printf readonly ${HOME}
+done export sed -eu test 'quoted text' done 'quoted text'
+printf ${HOME} /usr/bin echo "$@" then
+		'quoted text' then /usr/bin && export && test ${HOME} printf printf "$@" readonly
+awk awk local grep ${HOME}
+readonly cd test ${HOME}
+--verbose done && local then readonly then done local /usr/bin sed local -eu sed
+		"$1" 'quoted text' cd local -eu "$1"
+		export && printf sed done awk --verbose
+"$1" && echo 'quoted text' ${HOME} /usr/bin awk done "$1" "$@" cd 'quoted text'
+test -eu export readonly /usr/bin
+	sed $(pwd) /usr/bin done && "$@" ${HOME} local "$1" done export |
+	-eu test cd 'quoted text' 'quoted text' $(pwd)
+test local 'quoted text'
+${HOME} /usr/bin grep /usr/bin /usr/bin
+x=1 | --verbose 2>/dev/null done && x=1 x=1
+test awk "$1" -eu cd done sed $(pwd) grep
+	then then 2>/dev/null local local -eu 2>/dev/null cd -eu export 2>/dev/null
+/usr/bin readonly x=1 export export printf readonly
+	then --verbose x=1 readonly | echo 'quoted text'
+		then "$@" export printf awk ${HOME} $(pwd) && cd readonly
+	grep ${HOME} echo test cd cd export && echo done sed ${HOME} "$1" sed -eu
+"$1" grep $(pwd) echo printf
+		-eu "$@" --verbose -eu 2>/dev/null grep printf
+local sed -eu && | local echo printf grep
+	done 'quoted text' -eu printf echo echo ${HOME} then echo --verbose
+cd ${HOME} $(pwd) --verbose
+--verbose grep local then x=1 echo -eu $(pwd) cd export test done sed grep --verbose
+	then "$@" cd && "$@" awk readonly 'quoted text' ${HOME} | 'quoted text'
+		awk /usr/bin awk 'quoted text' local then | then "$@" awk done
+		-eu "$@" 'quoted text' echo "$@" /usr/bin "$@" /usr/bin cd test "$@" $(pwd)
+/usr/bin -eu grep sed 2>/dev/null /usr/bin "$1" done done "$1"
+"$1" local /usr/bin cd printf | done /usr/bin printf "$@" echo
+x=1 | 2>/dev/null | -eu x=1 x=1 sed | export local && ${HOME} then "$1" readonly
+	| ${HOME} printf test $(pwd) grep readonly x=1 "$@" readonly -eu export
+readonly | ${HOME} readonly then ${HOME} -eu test /usr/bin cd cd
+		"$@" echo "$@" /usr/bin -eu local grep cd printf /usr/bin x=1 $(pwd)
+		"$1" ${HOME} ${HOME} x=1 readonly ${HOME} 'quoted text'
@@ -0,0 +1,2001 @@
+		$(pwd) ${HOME} -eu export 2>/dev/null "$@"
+		"$1" export "$1" done export readonly | --verbose echo done "$@" 'quoted text'
+${HOME} local x=1 -eu 2>/dev/null "$@" /usr/bin grep grep -eu 'quoted text'
+&& test $(pwd) 'quoted text' x=1 sed "$@" grep 'quoted text' grep grep
+	test "$1" && export --verbose "$1"
+	--verbose printf done ${HOME}
+${HOME} grep readonly then x=1 2>/dev/null
+		done sed awk readonly readonly cd awk grep ${HOME} /usr/bin test grep cd printf
+then readonly $(pwd) -eu echo
+export awk ${HOME} "$@" && --verbose 2>/dev/null
+	'quoted text' 2>/dev/null readonly && /usr/bin --verbose 'quoted text'
+	--verbose printf then --verbose "$@" && -eu ${HOME} | grep test readonly
+| $(pwd) export local readonly awk readonly -eu x=1
+	-eu ${HOME} cd test local --verbose --verbose
+		$(pwd) 2>/dev/null grep local /usr/bin
+	grep export test printf cd $(pwd)
+grep export then ${HOME}
+/usr/bin cd grep ${HOME} x=1 done --verbose "$1" grep
+	-eu printf "$@" 2>/dev/null | $(pwd) 2>/dev/null --verbose | readonly
+		x=1 printf -eu 2>/dev/null && test 2>/dev/null test sed printf printf
+		$(pwd) 2>/dev/null x=1 grep then then then 'quoted text' -eu ${HOME} "$1" 2>/dev/null
+		'quoted text' "$@" "$@" 2>/dev/null grep grep echo printf
+| echo && export && awk --verbose x=1 x=1 && printf sed 'quoted text'
+done "$@" local 2>/dev/null
+		done awk 'quoted text' local ${HOME} 'quoted text' "$@" $(pwd)
+	done x=1 "$1" && then --verbose
+"$@" 2>/dev/null cd export printf 'quoted text' printf
+	cd done local | echo -eu "$@" done echo local cd awk test
+then ${HOME} test local echo /usr/bin
+	local 'quoted text' awk | "$1"
+${HOME} /usr/bin ${HOME} 'quoted text' ${HOME} --verbose cd $(pwd) 'quoted text'
+	$(pwd) ${HOME} printf | 2>/dev/null sed $(pwd) && readonly grep
+	--verbose && grep local done awk "$@" 'quoted text' -eu
+${HOME} -eu echo "$1" printf ${HOME} then $(pwd) printf --verbose awk export
+	cd /usr/bin printf then done && && awk $(pwd) /usr/bin test
+x=1 readonly ${HOME} echo export --verbose
+	export x=1 local $(pwd)
+	&& ${HOME} --verbose done 2>/dev/null --verbose
+		/usr/bin then readonly --verbose
+2>/dev/null readonly | && sed then $(pwd) sed
+local --verbose then grep done grep
+		| test local then x=1 'quoted text'
+printf export awk | "$@" grep && then export 2>/dev/null done "$@"
+then sed export echo --verbose && cd sed echo cd grep 2>/dev/null then 'quoted text'
+	"$@" | | grep printf "$1" cd "$1" 'quoted text'
+		cd then awk echo /usr/bin sed "$@"
+		| "$1" 2>/dev/null local /usr/bin
+		&& readonly -eu "$@" $(pwd) local grep grep awk printf
+sed echo sed awk local && sed /usr/bin cd test
+	echo then awk && printf echo printf grep
+${HOME} awk "$@" printf test sed then cd echo | x=1 echo awk
+sed x=1 cd test awk x=1 -eu then done done ${HOME} $(pwd)
+2>/dev/null -eu 2>/dev/null local "$1" cd export then "$@" 2>/dev/null
+printf awk $(pwd) then | sed
+		--verbose -eu 2>/dev/null printf x=1 cd && | | && cd "$@"
+		sed awk grep 'quoted text'
+	done test 2>/dev/null sed done echo
+	"$@" grep /usr/bin --verbose echo 2>/dev/null
+		"$1" done echo --verbose test
+	'quoted text' readonly && test "$1" sed awk /usr/bin
+		&& "$1" ${HOME} readonly cd test grep
+	"$@" $(pwd) && test "$1" "$@" echo /usr/bin test grep
+test 'quoted text' printf local $(pwd) 'quoted text' 'quoted text' --verbose
+	"$@" $(pwd) printf 'quoted text'
+sed test -eu awk 2>/dev/null local test
+'quoted text' "$1" export readonly printf | cd --verbose
+	test 'quoted text' "$@"
+		"$1" -eu done done grep printf
+test $(pwd) /usr/bin cd
+	"$@" 'quoted text' cd sed sed echo x=1
+awk $(pwd) readonly "$1" local echo "$1" --verbose test 'quoted text'
+echo x=1 ${HOME} "$1" ${HOME} printf $(pwd) printf local
+done done -eu && done
+		printf test /usr/bin "$1" then 2>/dev/null /usr/bin cd echo -eu printf
+cd grep cd awk local then -eu local test "$@" awk local
+| done "$1" /usr/bin 2>/dev/null ${HOME} sed
+"$1" printf x=1 x=1 "$@" local -eu then printf test
+	| -eu echo --verbose readonly
+echo 'quoted text' done grep test readonly
+	"$1" test /usr/bin 'quoted text' export printf -eu awk && && sed
+		"$@" x=1 2>/dev/null -eu /usr/bin --verbose ${HOME} 2>/dev/null x=1
+$(pwd) awk $(pwd) 2>/dev/null readonly --verbose readonly
+	${HOME} $(pwd) sed --verbose grep "$@" ${HOME}
+		&& sed 'quoted text' awk x=1 $(pwd) /usr/bin printf then -eu --verbose echo
+	"$1" readonly grep sed x=1 | cd -eu 2>/dev/null done awk && && | awk "$@"
+	test grep 'quoted text' /usr/bin "$1" grep
+	"$1" readonly echo test local | --verbose grep "$@" readonly x=1 && -eu grep
+	/usr/bin "$@" local && $(pwd) done 2>/dev/null printf cd && cd cd
+'quoted text' $(pwd) ${HOME} "$1" 'quoted text'
+	&& printf "$1" --verbose && "$@" 'quoted text' grep awk cd echo && cd
+"$@" 'quoted text' then grep printf cd export $(pwd) then cd
+		&& echo 2>/dev/null done "$@" grep local done ${HOME}
+	'quoted text' "$@" printf /usr/bin x=1 'quoted text'
+	grep --verbose readonly $(pwd) echo --verbose local 'quoted text' then
+		-eu readonly "$@" 'quoted text' grep -eu readonly
+	local test 'quoted text' /usr/bin -eu
+		awk "$1" printf echo "$1" printf "$@" sed | cd readonly
+	&& grep | -eu then 2>/dev/null x=1 test then printf awk echo
+	then export local "$@" ${HOME}
+	2>/dev/null cd "$1" printf cd done local 'quoted text'
+		sed done 'quoted text' sed "$1" readonly
+	${HOME} && export done done x=1 readonly --verbose
+		2>/dev/null $(pwd) cd "$1"
+	'quoted text' -eu 'quoted text' then $(pwd)
+	&& awk "$1" 'quoted text' echo
+		"$@" -eu printf grep local "$1" test sed done grep echo test "$@" local local
+"$1" /usr/bin grep sed then $(pwd) "$@" echo grep grep done && printf cd sed readonly
+	-eu -eu export export 2>/dev/null
+	'quoted text' "$@" cd cd echo printf cd ${HOME}
+2>/dev/null ${HOME} awk && export ${HOME}
+		--verbose then "$@" cd then local && printf && done printf 'quoted text'
+		-eu /usr/bin cd sed done then /usr/bin $(pwd) test done sed then grep --verbose
+x=1 sed done export printf awk done 2>/dev/null sed then | 2>/dev/null
+	&& readonly awk "$1" /usr/bin echo awk 2>/dev/null readonly "$@" --verbose
+		| test cd -eu done then sed grep local $(pwd) "$1" then test export readonly
+	cd | done x=1 x=1 -eu readonly readonly -eu done x=1 --verbose | "$@" export ${HOME}
+		then awk && /usr/bin done
+done test local ${HOME} done 2>/dev/null 'quoted text' | local
+| awk grep $(pwd) readonly done then x=1 done
+export test grep grep then done ${HOME} awk sed "$1" --verbose awk 'quoted text'
+sed printf | $(pwd) then echo sed | /usr/bin then awk "$@" awk "$@" "$@" && export
+	$(pwd) --verbose && local x=1 readonly
+-eu x=1 2>/dev/null local $(pwd)
+		done then x=1 /usr/bin export grep 2>/dev/null
+local x=1 "$1" --verbose -eu /usr/bin sed -eu test
+	sed sed "$1" && x=1 cd && grep echo awk done -eu sed 'quoted text' readonly
+		export echo local 'quoted text' local export
+	then -eu readonly test /usr/bin | readonly local echo printf
+		"$@" sed 'quoted text' x=1 x=1 local test $(pwd) sed test -eu | 2>/dev/null
+	--verbose 'quoted text' 'quoted text' -eu --verbose -eu
+		${HOME} x=1 test $(pwd) x=1 done
+${HOME} readonly test 'quoted text' done done && cd export
+sed export --verbose --verbose done && awk "$1" cd local then /usr/bin
+	--verbose printf && ${HOME} 'quoted text' $(pwd) /usr/bin
+"$@" | then grep printf export grep grep | printf cd "$1" && cd
+		export | echo awk x=1 readonly readonly test "$@" echo --verbose
+		echo sed "$@" echo printf --verbose 'quoted text' "$1"
+readonly grep sed then awk /usr/bin cd ${HOME} /usr/bin | printf --verbose
+--verbose echo -eu "$@" readonly 2>/dev/null | readonly
+		grep then sed x=1 sed local
+		readonly then x=1 then "$1" 2>/dev/null
+x=1 sed "$1" ${HOME} echo 2>/dev/null x=1 export
+	x=1 "$@" $(pwd) printf cd local done printf echo /usr/bin
+	-eu 2>/dev/null && &&
+	--verbose done cd --verbose 2>/dev/null export local readonly 2>/dev/null 2>/dev/null
+	export cd sed then && 2>/dev/null
+	2>/dev/null ${HOME} then x=1 2>/dev/null
+${HOME} | echo "$@" export echo 2>/dev/null /usr/bin
+	awk awk x=1 /usr/bin local test "$@" -eu export
+	sed 'quoted text' readonly
+		done test "$1" grep x=1 done printf export
+/usr/bin printf echo sed |
+	sed "$1" echo "$1" -eu then printf 2>/dev/null then readonly
+-eu | done export then sed local readonly test --verbose test --verbose
+export echo 2>/dev/null echo 2>/dev/null
+grep x=1 ${HOME} local | 2>/dev/null
+readonly local && readonly | 'quoted text' 'quoted text' echo ${HOME}
+printf cd awk grep -eu -eu ${HOME} ${HOME} export
+/usr/bin $(pwd) cd --verbose readonly -eu
+readonly | 'quoted text' "$@" cd awk && test sed readonly readonly done x=1
+x=1 export "$@" then "$1" x=1
+		grep sed --verbose done local "$@" ${HOME} && readonly grep grep
+		test && cd --verbose &&
+	awk test export | x=1 cd 'quoted text' 'quoted text' awk awk done /usr/bin
+grep done $(pwd) --verbose done ${HOME} /usr/bin local
+		x=1 $(pwd) "$1" then "$@" --verbose local sed $(pwd) 2>/dev/null export x=1 echo
+		export "$@" done ${HOME} readonly test local export -eu "$@" && sed awk x=1 sed
+		/usr/bin "$1" local cd local --verbose /usr/bin "$@" "$@" --verbose
+	"$@" "$1" 'quoted text'
+/usr/bin && sed -eu "$@" test local local 2>/dev/null
+		sed x=1 printf -eu awk echo --verbose
+	printf test grep test /usr/bin 'quoted text' --verbose -eu grep $(pwd)
+		cd awk "$1" 'quoted text' | printf "$1" printf 'quoted text' "$1" && done
+	done | $(pwd) --verbose $(pwd) echo readonly test then local
+	'quoted text' $(pwd) cd
+	awk sed --verbose awk ${HOME} readonly
+done awk export grep readonly sed printf --verbose readonly
+		cd cd && local printf local $(pwd) readonly "$@" 'quoted text'
+	$(pwd) done 'quoted text' "$1" 'quoted text' local done
+	'quoted text' && readonly local 'quoted text' test "$1" ${HOME} echo
+		"$1" -eu ${HOME} ${HOME} /usr/bin $(pwd) x=1 local printf local
+'quoted text' cd then readonly then /usr/bin then 2>/dev/null
+		/usr/bin 2>/dev/null awk /usr/bin then "$1" $(pwd) readonly &&
+'quoted text' | 'quoted text' -eu echo awk sed |
+| ${HOME} sed echo then then awk 2>/dev/null --verbose 2>/dev/null
+	-eu cd /usr/bin | ${HOME} 2>/dev/null /usr/bin "$@" test | test printf export
+	local /usr/bin 2>/dev/null awk export | readonly
+readonly 2>/dev/null "$@"
+x=1 $(pwd) local printf readonly $(pwd) 'quoted text' sed readonly
+		2>/dev/null grep 2>/dev/null cd sed printf echo grep test
+x=1 'quoted text' "$@"
+		echo "$@" local awk printf echo
+	local ${HOME} awk export -eu $(pwd) && "$@" && && -eu x=1 echo export
+	test export "$1" printf echo /usr/bin awk export awk 'quoted text'
+	2>/dev/null echo /usr/bin
+cd ${HOME} awk $(pwd) && /usr/bin 'quoted text' -eu readonly
+	&& then "$@" echo "$@" 'quoted text' then "$@" export echo grep
+	x=1 done export -eu | printf test 'quoted text' printf -eu ${HOME} /usr/bin
+readonly "$@" local 2>/dev/null cd printf export /usr/bin
+| cd local 2>/dev/null /usr/bin local | 2>/dev/null
+readonly then /usr/bin $(pwd) local export printf $(pwd) test 'quoted text' /usr/bin
+	echo --verbose test 2>/dev/null done awk "$1" -eu done $(pwd) awk --verbose
+	awk | ${HOME} done "$@" --verbose export
+	test sed ${HOME} awk readonly --verbose readonly cd /usr/bin -eu printf sed 2>/dev/null
+-eu $(pwd) test ${HOME} 2>/dev/null
+		printf x=1 -eu done sed && $(pwd)
+	"$@" $(pwd) sed local ${HOME} echo sed -eu -eu
+	export ${HOME} readonly export local |
+	&& $(pwd) grep 'quoted text'
+		echo 2>/dev/null local then | grep | 'quoted text' |
+readonly 2>/dev/null x=1 /usr/bin | awk /usr/bin then /usr/bin $(pwd) then
+--verbose test test echo
+done sed ${HOME} -eu /usr/bin echo done done then x=1 cd cd readonly "$@"
+		x=1 /usr/bin local -eu cd 2>/dev/null 2>/dev/null test export export
+grep | | export x=1 local readonly cd ${HOME}
+	${HOME} test | | sed then "$@" local x=1
+readonly readonly $(pwd) "$1"
+sed printf | ${HOME} | "$1" | test local --verbose &&
+export -eu $(pwd) readonly && 2>/dev/null
+		-eu 2>/dev/null cd $(pwd) 2>/dev/null && "$1"
+done /usr/bin then cd x=1 /usr/bin | ${HOME} x=1 echo --verbose
+	cd ${HOME} awk readonly test grep
+/usr/bin /usr/bin | ${HOME} then
+	"$1" && test echo 2>/dev/null
+/usr/bin then grep | x=1 cd 'quoted text' -eu cd
+	awk ${HOME} done sed printf
+sed 2>/dev/null grep test readonly "$@" 'quoted text' "$@" sed
+		then && 'quoted text'
+		printf x=1 x=1 cd x=1 export then test awk local
+readonly && x=1 && $(pwd) then "$@" | printf "$1" then "$1" awk done
+		test | "$@" export | local "$@" "$1" && | && test cd grep 2>/dev/null
+	/usr/bin 'quoted text' grep readonly x=1 | done && test
+2>/dev/null test $(pwd) --verbose
+		echo echo /usr/bin export
+${HOME} local local --verbose
+	readonly local then printf printf sed printf
+	sed "$@" ${HOME} readonly --verbose && "$1"
+		grep "$1" --verbose cd sed | "$1" "$1" local
+	cd grep export grep then
+		/usr/bin $(pwd) $(pwd) then awk --verbose /usr/bin && export export
+	-eu -eu awk done readonly
+/usr/bin readonly -eu readonly sed sed readonly
+		| --verbose x=1 --verbose $(pwd) /usr/bin "$@" 2>/dev/null -eu x=1 done done
+		-eu 'quoted text' printf then cd readonly /usr/bin -eu | readonly
+${HOME} "$@" | local cd local grep 'quoted text'
+| sed grep $(pwd) test cd $(pwd) local "$@" | --verbose
+awk test sed 'quoted text' /usr/bin
+		grep 2>/dev/null --verbose ${HOME} export | "$@" /usr/bin awk --verbose
+x=1 && sed /usr/bin grep done sed done -eu printf done printf
+	sed x=1 awk awk cd 'quoted text' sed 'quoted text' export /usr/bin | cd printf
+/usr/bin done 'quoted text' --verbose export local local /usr/bin awk readonly printf
+echo cd 2>/dev/null $(pwd)
+	cd 2>/dev/null "$@" 'quoted text'
+	sed $(pwd) --verbose done
+grep && test | "$@" awk readonly "$1" /usr/bin ${HOME}
+	local grep grep "$1" "$@" awk printf
+		"$1" $(pwd) "$@" echo local "$@" test grep export sed | ${HOME} -eu
+	2>/dev/null ${HOME} awk 'quoted text'
+		/usr/bin done cd test local --verbose
+test readonly cd && x=1 'quoted text' ${HOME} $(pwd)
+		-eu test ${HOME} $(pwd) then test -eu /usr/bin
+sed then local 2>/dev/null echo | "$1"
+grep echo --verbose export -eu grep $(pwd) awk ${HOME}
+		done /usr/bin 2>/dev/null test readonly export 2>/dev/null | $(pwd)
+		2>/dev/null readonly sed | local export test "$@"
+--verbose awk echo && "$1" sed awk cd printf test ${HOME} --verbose then $(pwd)
+		2>/dev/null /usr/bin "$1" done
+done -eu awk x=1 /usr/bin 'quoted text'
+'quoted text' | readonly export /usr/bin /usr/bin --verbose sed
+	'quoted text' sed -eu 'quoted text' /usr/bin test readonly local
+-eu echo then /usr/bin echo && local ${HOME}
+	"$1" awk -eu "$@" "$@" local
+	$(pwd) ${HOME} printf cd
+2>/dev/null sed printf ${HOME} -eu x=1 'quoted text' | ${HOME} 2>/dev/null
+	'quoted text' ${HOME} cd /usr/bin readonly echo 2>/dev/null done sed done
+		done && export 2>/dev/null 'quoted text' $(pwd) "$1" readonly 'quoted text'
+	awk 'quoted text' 2>/dev/null
+		&& export readonly $(pwd) cd grep 2>/dev/null | done -eu
+		printf test /usr/bin && printf then
+		2>/dev/null then 'quoted text' echo echo 2>/dev/null export
+&& $(pwd) "$1" printf readonly 'quoted text'
+/usr/bin readonly /usr/bin $(pwd) x=1 printf export "$@"
+sed cd then 'quoted text' "$1" --verbose
+		then && | x=1 "$1" && 'quoted text' 'quoted text' then /usr/bin 2>/dev/null
+readonly awk printf "$@" sed test "$1" | --verbose && grep 'quoted text' /usr/bin
+	"$1" printf grep -eu --verbose grep 2>/dev/null 'quoted text' cd
+-eu export 'quoted text' sed awk sed sed sed
+		grep export grep awk --verbose
+		$(pwd) && export && -eu then then 'quoted text' sed x=1 --verbose
+printf "$1" /usr/bin echo /usr/bin then export 'quoted text' 2>/dev/null readonly
+		grep ${HOME} export /usr/bin $(pwd) | ${HOME} cd 2>/dev/null ${HOME}
+		-eu 2>/dev/null $(pwd) test export done then printf "$@" | test 2>/dev/null
+	${HOME} export grep sed grep
+	grep /usr/bin local -eu 'quoted text' local
+&& 'quoted text' /usr/bin /usr/bin done /usr/bin
+	done cd printf | "$1" 'quoted text' grep -eu
+awk $(pwd) test $(pwd) | 'quoted text'
+	export awk $(pwd) && local -eu export x=1 -eu awk 2>/dev/null
+	readonly 'quoted text' --verbose
+2>/dev/null export then cd ${HOME} /usr/bin done
+	sed $(pwd) local 2>/dev/null | x=1 ${HOME} cd cd readonly -eu /usr/bin $(pwd)
+&& readonly ${HOME} 'quoted text'
+$(pwd) cd "$@" echo x=1
+local done grep && sed then -eu sed -eu printf && | then $(pwd)
+	done "$1" echo "$1" sed test echo
+		/usr/bin cd -eu then sed readonly 'quoted text' --verbose ${HOME}
+		local then done "$1" $(pwd)
+	done 'quoted text' export done 'quoted text' test done x=1
+"$@" | local readonly
+done $(pwd) $(pwd) printf readonly
+		export "$@" readonly sed 2>/dev/null "$1" local awk export /usr/bin
+"$1" local 'quoted text' "$@" sed
+		then local x=1 grep readonly | readonly
+	x=1 'quoted text' ${HOME} then x=1 /usr/bin done printf grep --verbose /usr/bin
+	local awk export "$1" echo
+		'quoted text' "$@" grep -eu cd --verbose ${HOME} grep $(pwd) 2>/dev/null
+	sed then done readonly ${HOME} echo then | done 2>/dev/null
+	readonly "$@" "$1" test
+awk local -eu done cd sed cd local test ${HOME} "$@"
+		test grep "$@" x=1 printf | 'quoted text' printf test then
+"$1" 'quoted text' ${HOME} -eu local --verbose "$@"
+	-eu grep then export echo -eu cd grep 'quoted text' export sed 'quoted text'
+		test --verbose then --verbose | cd grep ${HOME}
+	done 'quoted text' done 2>/dev/null
+		"$@" export x=1 then ${HOME} local
+	printf cd sed ${HOME} awk sed test awk ${HOME} && export grep local printf
+--verbose "$1" local grep
+	done && 2>/dev/null grep
+	2>/dev/null "$@" "$1" --verbose && cd local
+cd test grep readonly grep $(pwd) printf /usr/bin export printf
+-eu "$1" | export x=1 $(pwd) 2>/dev/null
+"$1" local $(pwd) grep -eu 2>/dev/null printf awk 2>/dev/null
+		"$1" cd --verbose sed export 2>/dev/null then local done awk /usr/bin then "$@"
+done awk printf 'quoted text' 'quoted text' 'quoted text'
+		awk test local 2>/dev/null 'quoted text' ${HOME} 2>/dev/null
+	then --verbose sed awk "$@" export printf
+		then test cd ${HOME} --verbose && "$1" then x=1 done sed printf test && | printf
+--verbose && $(pwd) 2>/dev/null && printf ${HOME} awk printf -eu done
+		--verbose --verbose 'quoted text'
+'quoted text' local readonly export -eu cd echo awk $(pwd) && "$1" grep readonly
+		done x=1 printf export grep
+		export local --verbose && --verbose
+	--verbose done echo grep cd export then cd then echo
+readonly cd $(pwd) $(pwd) grep
+test --verbose local ${HOME} sed local export
+done /usr/bin /usr/bin $(pwd) echo && 'quoted text' --verbose
+2>/dev/null local export readonly
+		2>/dev/null /usr/bin "$1" "$1" -eu echo test x=1 x=1 "$@" export x=1 local
+	sed ${HOME} export awk 2>/dev/null
+readonly echo -eu ${HOME}
+echo $(pwd) then cd "$@" 'quoted text'
+		local $(pwd) $(pwd) printf | test 'quoted text' sed
+	${HOME} done then --verbose && grep sed /usr/bin "$@" "$@" && 'quoted text'
+echo printf | printf done && test local cd echo "$1"
+	-eu 'quoted text' ${HOME} awk grep
+$(pwd) x=1 awk "$1" readonly
+test "$1" cd local $(pwd) --verbose --verbose sed local "$@" 2>/dev/null
+"$@" readonly "$@" local sed x=1 grep 2>/dev/null | "$@" ${HOME} 2>/dev/null sed
+	"$1" "$1" ${HOME} echo cd sed x=1 --verbose printf
+		&& sed printf /usr/bin printf ${HOME}
+		done $(pwd) local export cd readonly echo $(pwd) ${HOME}
+	/usr/bin printf sed grep "$@" -eu --verbose
+"$@" $(pwd) done cd awk local local sed echo cd done
+		echo sed awk cd printf sed sed sed ${HOME} "$1" 2>/dev/null "$@" awk sed
+		$(pwd) ${HOME} /usr/bin "$1" cd awk test test "$1" "$@" printf "$@" -eu /usr/bin
+	grep sed cd echo | 2>/dev/null
+		--verbose then export readonly cd "$1" then done export -eu -eu | awk "$1"
+test sed sed "$1" -eu local export local 'quoted text' grep sed test grep
+	&& "$1" sed echo $(pwd) awk
+readonly awk cd test awk echo
+	--verbose printf echo "$1" $(pwd) -eu 'quoted text' done
+		printf test --verbose sed 'quoted text' 'quoted text'
+--verbose grep --verbose grep sed
+		echo test export $(pwd) -eu cd grep x=1 x=1
+	"$@" -eu 'quoted text' --verbose awk $(pwd) $(pwd)
+	${HOME} "$1" printf readonly "$@" ${HOME} printf
+export echo sed ${HOME} -eu "$1" export printf --verbose ${HOME} sed
+		printf -eu --verbose cd ${HOME} echo --verbose 'quoted text' local cd
+'quoted text' x=1 | x=1 then sed sed "$1" local readonly export echo 'quoted text'
+	/usr/bin printf readonly sed readonly done && test -eu |
+		printf -eu export done /usr/bin export then 'quoted text'
+export export /usr/bin echo done 2>/dev/null "$1" -eu done
+		"$@" echo echo "$1" | -eu readonly "$@" && cd export readonly local printf
+	--verbose export readonly export awk printf export --verbose
+${HOME} | printf "$@" /usr/bin readonly 2>/dev/null
+		-eu done --verbose echo then local
+	echo -eu -eu "$1" x=1 sed then echo export sed 2>/dev/null
+		"$1" export grep ${HOME} then --verbose sed $(pwd) && /usr/bin | &&
+	printf "$@" /usr/bin ${HOME} local --verbose test --verbose "$1" local
+		printf grep "$1" cd ${HOME} export echo && ${HOME}
+		x=1 x=1 x=1 | --verbose "$@" export grep $(pwd) readonly /usr/bin
+	done cd awk test ${HOME} then local -eu | then test export "$@" test
+		-eu 'quoted text' cd | x=1 "$@" echo cd awk "$@" 2>/dev/null readonly && sed
+cd sed /usr/bin then test then sed cd x=1 printf "$1" cd echo ${HOME}
+2>/dev/null sed done then then /usr/bin local local 2>/dev/null local
+		"$1" 2>/dev/null 'quoted text' "$1" && "$1"
+		| 2>/dev/null local 'quoted text' && readonly
+	-eu 2>/dev/null /usr/bin cd 'quoted text' awk $(pwd) export $(pwd) cd -eu test
+test 2>/dev/null local awk readonly --verbose
+local 'quoted text' ${HOME}
+2>/dev/null grep done done local
+readonly x=1 export cd cd
+	awk "$@" && ${HOME} export ${HOME} echo x=1 export ${HOME} $(pwd) sed /usr/bin
+	&& -eu export x=1 local "$@" | printf 'quoted text' readonly
+	'quoted text' sed x=1 2>/dev/null
+	done 'quoted text' $(pwd) x=1 awk -eu echo done sed readonly cd done
+-eu readonly /usr/bin sed cd echo $(pwd) done 'quoted text' cd grep x=1 2>/dev/null
+grep 'quoted text' then | awk 2>/dev/null echo
+	$(pwd) | $(pwd) 2>/dev/null awk -eu $(pwd) ${HOME}
+	export /usr/bin ${HOME} sed $(pwd) $(pwd) sed --verbose ${HOME} /usr/bin
+	${HOME} awk 2>/dev/null done echo x=1 test &&
+	-eu "$1" | export 'quoted text'
+${HOME} 2>/dev/null readonly test grep printf then test
+$(pwd) $(pwd) x=1 test export &&
+	"$@" local 'quoted text' sed printf $(pwd)
+-eu sed 2>/dev/null | readonly $(pwd) printf printf then /usr/bin x=1 ${HOME}
+	done x=1 local test && grep grep
+awk --verbose printf $(pwd) 'quoted text'
+export sed x=1 then | grep printf -eu export done grep 2>/dev/null echo "$@"
+	'quoted text' local $(pwd) 'quoted text' ${HOME}
+		-eu awk awk awk printf grep && $(pwd) grep echo -eu
+	printf -eu $(pwd) cd ${HOME} /usr/bin awk 2>/dev/null printf echo readonly
+	&& /usr/bin then awk readonly $(pwd) local --verbose test
+		printf 'quoted text' local ${HOME} x=1 readonly sed sed sed
+		cd test && -eu readonly /usr/bin export 'quoted text'
+	readonly x=1 x=1 export
+readonly "$@" 2>/dev/null "$@" "$1" 2>/dev/null
+	readonly /usr/bin echo
+2>/dev/null cd "$@" echo /usr/bin 2>/dev/null local echo "$1" printf done "$@"
+"$@" grep cd 'quoted text' cd grep
+export sed $(pwd) grep ${HOME} x=1 && "$@" $(pwd) grep sed cd
+	echo export x=1 grep 'quoted text'
+"$@" readonly && x=1 grep x=1 export readonly readonly
+		echo printf printf x=1 /usr/bin
+	--verbose -eu done 'quoted text' $(pwd)
+	done "$@" done readonly -eu /usr/bin awk x=1 done "$@"
+		$(pwd) awk /usr/bin test $(pwd) | sed export 'quoted text' printf -eu
+	awk 2>/dev/null $(pwd) --verbose
+		grep then 'quoted text'
+		--verbose local printf "$1" grep
+	local test sed x=1 | "$@" export && && 'quoted text'
+	| awk readonly echo |
+	-eu --verbose ${HOME} grep 'quoted text' printf grep && printf done &&
+		x=1 "$@" awk export $(pwd) done then
+	--verbose local sed local --verbose export export cd printf sed sed
+'quoted text' export done $(pwd) 'quoted text'
+${HOME} readonly 2>/dev/null -eu $(pwd) $(pwd) printf /usr/bin test echo "$1" 2>/dev/null
+export $(pwd) sed export then readonly 'quoted text' export
+awk readonly && printf 'quoted text' then local grep
+test -eu "$@" ${HOME} --verbose local sed readonly
+		test test 'quoted text' 'quoted text' export /usr/bin "$@" sed sed x=1
+		x=1 then then "$@" $(pwd) sed local ${HOME} sed readonly echo "$1" 2>/dev/null
+awk | -eu printf export -eu readonly -eu 2>/dev/null x=1 && /usr/bin x=1 ${HOME}
+	'quoted text' "$@" then /usr/bin ${HOME} x=1 local 'quoted text' && ${HOME}
+		then grep readonly done cd "$1" --verbose
+cd -eu 'quoted text' test /usr/bin cd "$@" then grep ${HOME} --verbose --verbose
+	done test 'quoted text'
+/usr/bin && printf sed 2>/dev/null export -eu cd export export export readonly
+		test | "$@" done "$@" ${HOME}
+then readonly 'quoted text' $(pwd)
+	grep then done done "$@" awk printf
+| x=1 local cd | x=1 2>/dev/null | 'quoted text' "$@" --verbose
+"$@" echo "$@" ${HOME} done echo && grep grep ${HOME} sed | --verbose
+-eu /usr/bin -eu done printf local --verbose sed local "$1" ${HOME} test printf
+		printf && cd "$@" $(pwd) cd printf "$1"
+export /usr/bin | printf && cd && "$1" x=1 cd /usr/bin
+"$1" cd x=1 then ${HOME}
+		readonly readonly grep "$@" printf
+	test cd /usr/bin readonly
+		-eu echo then | readonly /usr/bin local 2>/dev/null
+		--verbose x=1 /usr/bin printf echo printf | 2>/dev/null x=1 local export x=1 x=1
+awk 2>/dev/null sed $(pwd) echo /usr/bin 2>/dev/null
+	&& /usr/bin sed done |
+printf readonly "$1" done "$@" echo export --verbose
+	$(pwd) "$1" readonly readonly cd local printf
+	test done "$1" sed -eu
+-eu -eu 2>/dev/null ${HOME} local 'quoted text'
+		grep "$1" test /usr/bin && 'quoted text' 2>/dev/null done
+/usr/bin printf "$@" cd ${HOME} grep
+		local && /usr/bin --verbose readonly local "$@" x=1 grep echo $(pwd)
+	grep echo ${HOME} x=1 --verbose "$1" "$1"
+	echo echo local then readonly
+		'quoted text' awk done cd sed readonly $(pwd) local echo
+sed $(pwd) cd && && 'quoted text' export | -eu "$1" "$@" 2>/dev/null export
+${HOME} awk && 2>/dev/null /usr/bin
+	| awk $(pwd) "$1" then done && cd awk grep then ${HOME} --verbose printf 'quoted text'
+	export && awk /usr/bin awk x=1 "$@"
+grep grep printf x=1 echo echo awk && 2>/dev/null
+		then && 2>/dev/null -eu then ${HOME} && "$@"
+"$@" /usr/bin grep ${HOME} sed x=1 readonly export printf awk grep --verbose
+		| | /usr/bin && sed -eu ${HOME} --verbose && /usr/bin grep test cd done && echo
+		'quoted text' "$1" 'quoted text' $(pwd) -eu /usr/bin && "$@" "$@" "$1" && |
+export printf grep "$1" grep 'quoted text' readonly local cd printf awk export
+	$(pwd) $(pwd) ${HOME} test /usr/bin printf "$1"
+	/usr/bin then awk $(pwd)
+		| -eu local cd | cd 'quoted text' local 2>/dev/null printf grep echo && 'quoted text'
+		$(pwd) $(pwd) then then -eu then --verbose 2>/dev/null readonly &&
+&& x=1 local /usr/bin awk /usr/bin
+		/usr/bin --verbose ${HOME} echo --verbose echo
+	&& awk --verbose "$@"
+		echo sed done 2>/dev/null && -eu ${HOME} grep cd cd
+	readonly local printf 2>/dev/null
+	'quoted text' 'quoted text' $(pwd) grep && "$@" 2>/dev/null $(pwd)
+	-eu export x=1 2>/dev/null cd grep --verbose test
+	| printf sed x=1 sed $(pwd) grep && -eu | 2>/dev/null echo
+&& printf test | 2>/dev/null done "$1" export sed $(pwd) cd local
+		awk | echo "$1" done done
+		'quoted text' /usr/bin -eu -eu /usr/bin &&
+sed x=1 readonly cd cd -eu then "$1" test readonly
+/usr/bin && x=1 grep "$1" readonly
+x=1 /usr/bin "$1" grep grep done && -eu | cd -eu grep awk && awk sed cd
+		"$@" 2>/dev/null && /usr/bin x=1 'quoted text' --verbose
+"$1" awk "$@" --verbose -eu cd ${HOME} readonly ${HOME}
+-eu /usr/bin export grep cd --verbose then awk
+		"$@" sed 2>/dev/null "$@" done
+		export done 2>/dev/null done "$1" && x=1 sed -eu | $(pwd)
+		2>/dev/null $(pwd) && echo --verbose
+'quoted text' cd "$@" && awk /usr/bin grep $(pwd) | -eu 'quoted text'
+	awk --verbose 2>/dev/null printf
+		test then ${HOME} | 'quoted text' readonly && printf
+grep x=1 $(pwd) ${HOME} awk awk echo then && printf
+x=1 export echo "$1" done -eu |
+		"$@" awk printf readonly awk 2>/dev/null then -eu
+		"$1" test && 2>/dev/null "$@" x=1 grep grep 2>/dev/null --verbose $(pwd)
+	$(pwd) && ${HOME} local echo grep done --verbose
+		cd && done grep && awk
+export test /usr/bin --verbose
+2>/dev/null awk "$@" --verbose ${HOME} echo sed printf | x=1 cd
+		&& ${HOME} awk sed done local "$@" readonly --verbose grep printf
+		x=1 /usr/bin local export sed
+	--verbose local grep printf x=1 $(pwd) done x=1 2>/dev/null | readonly local export
+--verbose echo -eu -eu local sed | printf 'quoted text' grep 2>/dev/null local
+readonly | -eu done local /usr/bin test grep test $(pwd) 'quoted text'
+		--verbose local local cd awk 'quoted text' printf
+		export 'quoted text' && sed 'quoted text' "$@"
+"$1" /usr/bin --verbose grep awk grep -eu
+		$(pwd) cd sed local then ${HOME} local x=1 echo /usr/bin
+2>/dev/null $(pwd) x=1 test cd readonly cd cd ${HOME} ${HOME} /usr/bin
+		printf test grep cd done
+		'quoted text' ${HOME} "$@" readonly | "$1" export --verbose "$@"
+x=1 sed $(pwd) export "$@" readonly cd cd echo |
+		"$1" | "$1" && sed 2>/dev/null done printf 2>/dev/null done x=1
+	| 'quoted text' x=1 x=1
+		awk awk /usr/bin x=1 local "$1" "$1" export then -eu && $(pwd) test readonly
+	grep 2>/dev/null echo && cd export $(pwd) test done -eu awk
+sed | then -eu | awk printf ${HOME} --verbose
+		readonly sed | "$1" -eu | | $(pwd) sed grep test "$1" --verbose
+"$@" $(pwd) sed awk $(pwd) x=1 "$1" -eu export && done /usr/bin ${HOME}
+		&& --verbose done local sed /usr/bin
+		'quoted text' test "$1" --verbose
+awk /usr/bin --verbose grep "$@" awk | sed
+		--verbose $(pwd) "$1" /usr/bin 2>/dev/null
+	$(pwd) $(pwd) 'quoted text' -eu && ${HOME} "$@" test 2>/dev/null
+		x=1 2>/dev/null local sed &&
+	then ${HOME} local -eu "$@" x=1 ${HOME} $(pwd) test "$1"
+	export /usr/bin 2>/dev/null | readonly readonly 'quoted text'
+		then $(pwd) | cd 2>/dev/null echo local |
+	'quoted text' echo x=1 && && 'quoted text' echo
+	x=1 awk "$1" -eu "$1" ${HOME} grep 'quoted text' sed ${HOME} | then readonly
+	awk && "$@" then awk awk test -eu ${HOME} printf ${HOME} then
+		/usr/bin -eu "$@" grep $(pwd) "$@" readonly
+x=1 local -eu ${HOME} -eu && --verbose done $(pwd) ${HOME} /usr/bin 2>/dev/null
+	cd && sed export $(pwd) grep printf test test
+	/usr/bin export x=1 -eu -eu | x=1 grep &&
+	test cd echo export ${HOME} grep x=1 grep echo
+	/usr/bin test printf readonly /usr/bin /usr/bin
+done 2>/dev/null echo "$1" --verbose awk | |
+		export -eu test --verbose
+		2>/dev/null --verbose 'quoted text'
+		printf /usr/bin -eu echo 2>/dev/null | printf x=1 $(pwd) "$@" /usr/bin
+readonly 2>/dev/null awk local export && --verbose test 'quoted text' /usr/bin
+	${HOME} grep 'quoted text' sed grep
+	&& test "$1" "$1" "$1" 'quoted text'
+local then 'quoted text' then cd $(pwd) done
+		readonly ${HOME} done /usr/bin
+awk ${HOME} then awk cd echo
+		"$1" readonly && cd ${HOME} export cd printf readonly local
+	done cd "$@" && printf then /usr/bin -eu "$1" | printf local grep
+		'quoted text' ${HOME} sed readonly
+	-eu awk "$1" -eu sed 'quoted text' -eu
+		readonly test echo $(pwd) done ${HOME} "$1" cd export printf
+--verbose cd export $(pwd) --verbose sed -eu cd test "$@" export printf
+${HOME} x=1 local test sed x=1 "$1" "$@" export "$1" local
+"$@" x=1 --verbose x=1 /usr/bin grep grep then |
+	printf && grep && done $(pwd) echo local then echo 2>/dev/null && sed
+		/usr/bin cd printf "$@" sed
+		printf printf 2>/dev/null echo local /usr/bin
+${HOME} 'quoted text' 'quoted text' cd "$1" x=1
+		export local sed local | then --verbose
+		export grep echo 'quoted text' --verbose | readonly sed ${HOME}
+	done -eu x=1 local && printf test
+	then --verbose echo done cd | export "$@" ${HOME} -eu -eu sed -eu
+		done sed "$1" | --verbose 2>/dev/null local local echo && printf
+${HOME} readonly "$@" "$@"
+		"$@" "$@" awk awk echo local --verbose readonly printf awk
+	printf | 'quoted text'
+	--verbose then | test 2>/dev/null && readonly "$@" test ${HOME} echo then
+	awk x=1 printf --verbose cd echo "$1" test echo grep cd /usr/bin sed -eu cd
+		${HOME} local "$@" cd done test /usr/bin 'quoted text' grep then
+2>/dev/null "$@" echo x=1 && test
+		readonly 'quoted text' cd readonly /usr/bin x=1 /usr/bin
+	echo sed done grep test sed cd x=1 "$@" local
+	test grep /usr/bin echo "$@" done x=1 --verbose && && echo export
+	local "$1" done /usr/bin -eu 2>/dev/null --verbose && ${HOME} "$1" then
+	2>/dev/null awk --verbose awk "$@" | cd printf awk test
+	then cd 'quoted text' echo "$@" done done 2>/dev/null
+		local sed test printf awk $(pwd) test --verbose export --verbose
+echo x=1 awk 'quoted text' grep then
+	awk x=1 | 2>/dev/null ${HOME} "$@"
+2>/dev/null /usr/bin cd test local cd 2>/dev/null
+	readonly grep echo 'quoted text' -eu echo 2>/dev/null test echo then grep
+		"$@" grep "$1" | | grep sed export --verbose "$1" done readonly
+	&& "$@" && local 2>/dev/null "$1" readonly
+		sed sed "$@" local 2>/dev/null ${HOME}
+	awk grep grep done sed awk cd printf "$1" ${HOME}
+	printf test grep grep ${HOME} done --verbose
+	$(pwd) -eu export /usr/bin sed grep
+	2>/dev/null grep && "$1"
+--verbose /usr/bin done printf cd sed then cd printf printf
+	| && then --verbose awk grep &&
+cd echo local x=1 test local --verbose cd -eu printf cd -eu
+	then /usr/bin done 2>/dev/null /usr/bin -eu grep "$1"
+'quoted text' $(pwd) echo sed ${HOME} test then "$1" /usr/bin ${HOME}
+	local echo export local "$@" export ${HOME} --verbose
+		| -eu x=1 && echo $(pwd) readonly
+		&& $(pwd) | test grep sed export 2>/dev/null readonly sed "$@" ${HOME}
+echo "$1" --verbose done 2>/dev/null echo awk grep
+		printf printf readonly 'quoted text' ${HOME} printf export $(pwd) "$@"
+&& echo grep done x=1 2>/dev/null
+		sed --verbose cd then $(pwd) 2>/dev/null
+		| awk 'quoted text' local readonly /usr/bin sed | "$1" $(pwd) -eu echo ${HOME}
+		&& export awk 'quoted text' then -eu $(pwd) 'quoted text' awk ${HOME}
+		$(pwd) printf 'quoted text' 'quoted text'
+		cd 'quoted text' cd sed awk export | 'quoted text' x=1
+	"$@" local done $(pwd) echo awk ${HOME} /usr/bin 2>/dev/null x=1 cd "$@" /usr/bin
+cd sed test cd -eu readonly printf ${HOME}
+test $(pwd) export "$@" done ${HOME} echo export echo awk /usr/bin sed local then
+	/usr/bin awk -eu test ${HOME} 2>/dev/null $(pwd) | | -eu $(pwd)
+		${HOME} /usr/bin echo readonly
+	then "$@" grep 'quoted text' export
+x=1 cd /usr/bin 2>/dev/null $(pwd) "$@" then
+	'quoted text' $(pwd) local
+"$@" done sed printf x=1 export -eu cd |
+&& test sed export done then ${HOME} --verbose
+	done awk "$1" && sed grep
+		local "$1" --verbose then /usr/bin --verbose sed --verbose
+'quoted text' done 'quoted text'
+sed echo then ${HOME} | done --verbose "$1" $(pwd)
+cd && then done ${HOME} && |
+	local -eu -eu then ${HOME} 2>/dev/null echo grep
+	&& /usr/bin export local export 2>/dev/null | && $(pwd) /usr/bin export done
+	then grep cd readonly grep x=1 "$1" echo /usr/bin | printf
+		export ${HOME} 'quoted text' cd cd grep sed
+		awk awk $(pwd) grep sed echo printf --verbose sed ${HOME} "$@" printf 2>/dev/null
+	awk /usr/bin cd printf $(pwd) echo 'quoted text' done
+then $(pwd) && ${HOME} --verbose && -eu /usr/bin
+	printf x=1 test $(pwd) then
+	printf | x=1 sed cd local readonly | "$@" done && 2>/dev/null grep
+		x=1 "$@" grep | 2>/dev/null 2>/dev/null "$@" echo
+		done then cd done 2>/dev/null && 'quoted text' |
+	grep grep sed | | "$@" $(pwd) "$1"
+	printf 'quoted text' /usr/bin done $(pwd) done -eu 2>/dev/null
+	x=1 local /usr/bin 'quoted text' && $(pwd) cd | x=1 && local /usr/bin grep readonly
+		&& readonly export readonly 2>/dev/null "$@" echo done && sed cd
+		then /usr/bin $(pwd) /usr/bin echo grep && 2>/dev/null awk && ${HOME}
+		"$@" printf && sed cd && "$@" --verbose
+test then grep test grep cd ${HOME} /usr/bin sed /usr/bin
+	done && test then 'quoted text'
+grep -eu done && export sed local -eu $(pwd) $(pwd) export echo sed && readonly
+	'quoted text' $(pwd) printf readonly ${HOME}
+		${HOME} readonly --verbose sed then local
+		done grep --verbose local export "$1" /usr/bin test then cd
+		cd -eu printf -eu test echo echo test grep -eu local readonly cd | ${HOME}
+	test awk then -eu local grep local "$@" then 'quoted text' | local then "$@"
+		grep done cd local "$@" 'quoted text' test
+'quoted text' readonly test done sed
+		awk then printf readonly x=1 'quoted text' export 2>/dev/null echo ${HOME}
+		echo "$1" sed done $(pwd) "$@" local readonly 2>/dev/null then
+	"$1" test 'quoted text' export x=1
+	then 2>/dev/null -eu && ${HOME} -eu x=1 test
+	test 'quoted text' echo cd 'quoted text' x=1
+&& echo | 2>/dev/null "$1" printf sed then then "$@" sed ${HOME} sed printf
+		"$1" x=1 sed grep done sed -eu ${HOME}
+		'quoted text' | 2>/dev/null
+	--verbose -eu grep test done "$@" 2>/dev/null | local then local $(pwd)
+	cd 2>/dev/null ${HOME} test then cd "$@"
+		printf 2>/dev/null readonly awk sed printf
+		printf test -eu --verbose /usr/bin "$1" ${HOME} 'quoted text' -eu "$@" "$@" /usr/bin
+printf && ${HOME} grep export then test x=1 grep "$1" test |
+		$(pwd) printf export done grep awk /usr/bin 'quoted text'
+cd ${HOME} printf ${HOME} | 2>/dev/null x=1 -eu grep
+	echo echo export 2>/dev/null 'quoted text'
+	"$1" awk 2>/dev/null ${HOME} awk && grep test 'quoted text'
+		&& test x=1 'quoted text' -eu /usr/bin x=1 /usr/bin "$1" 'quoted text' awk
+		echo ${HOME} awk x=1 --verbose | sed local awk sed
+done -eu echo "$@" local && 2>/dev/null
+readonly sed readonly /usr/bin && "$@" cd cd && test local test
+grep /usr/bin "$@" --verbose awk awk printf -eu test 2>/dev/null echo export grep
+done local | echo /usr/bin local x=1 echo | cd | echo $(pwd) | readonly cd -eu
+		export echo cd local sed readonly sed "$@"
+		sed "$@" -eu awk local "$1" x=1 $(pwd) --verbose awk 'quoted text'
+-eu readonly "$1" ${HOME} readonly echo
+	${HOME} local awk && /usr/bin cd then "$@" /usr/bin echo test | 'quoted text'
+		&& test ${HOME} "$1" local
+		export 2>/dev/null -eu && export cd printf
+	local && test cd cd sed && done | grep && export --verbose
+	sed --verbose readonly
+readonly cd "$@" test done export "$@"
+	2>/dev/null local "$@" then --verbose 2>/dev/null -eu $(pwd) cd
+${HOME} "$@" "$1" x=1 export echo "$1" printf "$@" 2>/dev/null export
+	'quoted text' grep sed local local printf ${HOME} test &&
+		x=1 then 'quoted text' awk &&
+$(pwd) x=1 "$@" "$1" then $(pwd) --verbose x=1 'quoted text' "$@" cd printf ${HOME}
+echo "$1" echo "$@" grep then -eu echo
+grep cd x=1 -eu export --verbose readonly --verbose readonly readonly
+		$(pwd) printf sed echo echo "$@" --verbose /usr/bin
+2>/dev/null | ${HOME} export "$1" then /usr/bin "$1" echo "$@"
+	export 'quoted text' "$1" x=1
+$(pwd) "$1" readonly test then printf test readonly $(pwd) "$1"
+echo grep grep echo done export done $(pwd) printf then printf
+then | awk | printf | local x=1
+		test /usr/bin printf | sed "$@" done 2>/dev/null --verbose 2>/dev/null
+	$(pwd) -eu && echo --verbose readonly 'quoted text'
+readonly done && | test local done --verbose
+	test then awk --verbose done $(pwd) sed local
+	echo --verbose 'quoted text' sed echo awk $(pwd) && 2>/dev/null
+	2>/dev/null done "$@" sed 'quoted text'
+cd "$@" ${HOME} "$@" sed grep "$1" ${HOME} x=1 'quoted text'
+| "$1" printf && test 'quoted text'
+		/usr/bin export x=1 done sed ${HOME} /usr/bin && &&
+		${HOME} printf awk 2>/dev/null 'quoted text'
+	-eu --verbose --verbose ${HOME} done "$1" awk local "$@" local
+		echo test test 'quoted text' | && "$1" "$1" $(pwd) then -eu
+cd test /usr/bin done $(pwd) export && awk && /usr/bin
+	-eu awk local awk --verbose
+	then "$1" test echo "$1" /usr/bin then local --verbose
+	$(pwd) test x=1 test /usr/bin $(pwd) test $(pwd) grep 'quoted text'
+	2>/dev/null sed /usr/bin /usr/bin && export echo "$1" 2>/dev/null
+-eu echo grep echo local printf readonly printf
+	export awk ${HOME} /usr/bin sed /usr/bin
+		--verbose "$1" readonly $(pwd) readonly $(pwd)
+	sed 'quoted text' | $(pwd) && -eu --verbose sed
+${HOME} printf local sed test $(pwd) local
+sed grep /usr/bin readonly then sed && echo
+"$@" echo then && awk | test grep echo done "$@" test export $(pwd)
+	export echo && printf /usr/bin
+		local && "$@" && /usr/bin ${HOME}
+test then test export cd 'quoted text' test ${HOME}
+	&& 'quoted text' local ${HOME} "$@" "$1" export local $(pwd) sed "$@" awk sed
+	export local 'quoted text' /usr/bin
+| -eu 'quoted text' readonly grep export -eu ${HOME} sed readonly x=1 then
+| ${HOME} done grep test local --verbose export | awk
+readonly x=1 grep readonly ${HOME} 'quoted text' && then
+		local | local x=1 2>/dev/null 2>/dev/null
+x=1 then 'quoted text' export 2>/dev/null
+		done sed echo "$1" echo "$1" ${HOME} --verbose
+	echo printf x=1 x=1 2>/dev/null --verbose /usr/bin
+		awk ${HOME} readonly && done /usr/bin && sed $(pwd) local
+	local export | echo ${HOME} echo | 2>/dev/null export
+	-eu --verbose && | && -eu export $(pwd) echo
+	cd x=1 2>/dev/null 'quoted text' printf readonly
+export "$@" 'quoted text' $(pwd) 2>/dev/null
+		awk "$1" cd && readonly --verbose --verbose ${HOME} ${HOME}
+	grep x=1 printf done cd 2>/dev/null cd done test --verbose
+		-eu --verbose && 'quoted text' --verbose cd printf
+awk x=1 ${HOME} /usr/bin 2>/dev/null /usr/bin then && $(pwd) awk
+readonly cd x=1 done sed readonly awk readonly
+		export printf $(pwd) /usr/bin awk
+		x=1 done "$@" grep 2>/dev/null
+		test /usr/bin 2>/dev/null awk local
+	cd --verbose sed cd printf | grep 2>/dev/null
+grep readonly readonly $(pwd) readonly x=1 --verbose "$@" echo cd export ${HOME}
+		2>/dev/null "$@" --verbose awk /usr/bin "$@" grep && 'quoted text'
+echo "$@" cd printf printf printf
+-eu x=1 then then readonly "$1" /usr/bin local x=1
+		-eu readonly | --verbose awk "$@"
+	grep done sed x=1 -eu -eu ${HOME} grep /usr/bin
+	then 2>/dev/null local grep readonly readonly awk cd x=1 /usr/bin
+	"$@" grep "$1" cd | && readonly echo /usr/bin grep then $(pwd) ${HOME} sed
+		"$@" grep ${HOME} "$@" cd awk
+		local local /usr/bin -eu
+readonly && | x=1 -eu x=1 readonly "$@" local cd export
+	'quoted text' local $(pwd) && "$1" ${HOME} "$1" awk ${HOME} | -eu printf
+	"$@" "$1" echo cd -eu --verbose
+		-eu 2>/dev/null --verbose x=1 "$1" local test readonly /usr/bin $(pwd) done /usr/bin
+	| -eu /usr/bin | test cd /usr/bin cd done
+awk readonly && awk test 'quoted text' && $(pwd)
+| cd -eu x=1 -eu export done && printf then
+	| "$@" cd $(pwd) local "$1" &&
+		$(pwd) --verbose && printf $(pwd) printf export /usr/bin
+awk 'quoted text' grep cd "$1" -eu 2>/dev/null cd ${HOME} x=1 -eu
+"$1" grep grep --verbose readonly 2>/dev/null
+		local -eu cd done && readonly readonly /usr/bin "$@" -eu readonly "$@" 'quoted text'
+		done readonly $(pwd) /usr/bin 'quoted text'
+test /usr/bin echo done readonly
+		then 2>/dev/null && export ${HOME} done -eu /usr/bin cd -eu then printf
+	grep test printf 'quoted text' readonly done echo printf awk test echo --verbose
+test x=1 export printf test sed test --verbose -eu awk | test echo printf
+		cd ${HOME} export readonly "$1" $(pwd)
+	local done printf local && then "$@" ${HOME}
+		${HOME} grep -eu x=1 -eu grep local "$1" x=1 sed 2>/dev/null sed /usr/bin
+		test 2>/dev/null /usr/bin x=1 ${HOME} $(pwd) -eu x=1 sed --verbose test /usr/bin
+	$(pwd) then printf grep x=1 --verbose ${HOME} ${HOME} | | cd echo x=1
+		'quoted text' printf grep | -eu --verbose readonly
+		printf then && sed grep
+	grep grep sed test printf && "$@" cd | $(pwd) done ${HOME} awk 'quoted text'
+then echo test printf grep 2>/dev/null && -eu printf /usr/bin
+		--verbose printf cd printf
+	"$@" sed then 'quoted text' -eu --verbose awk then 2>/dev/null ${HOME} export
+	readonly ${HOME} $(pwd) "$@" sed ${HOME} 'quoted text'
+	/usr/bin $(pwd) done -eu
+${HOME} --verbose 2>/dev/null sed cd "$@" done /usr/bin grep awk
+"$@" export "$1" | local grep x=1
+grep echo export /usr/bin awk && x=1 printf printf 'quoted text'
+	| grep "$1" local then sed export | awk printf sed "$1" --verbose --verbose &&
+		export printf && grep ${HOME} "$1" "$@" local test -eu x=1
+	echo export x=1 export --verbose local echo
+	"$@" readonly export -eu then sed sed grep ${HOME}
+${HOME} x=1 -eu then sed x=1 && "$1"
+"$@" printf readonly -eu --verbose 2>/dev/null --verbose then
+$(pwd) export sed 2>/dev/null "$@" --verbose grep -eu -eu "$@"
+	export && local done printf 'quoted text' ${HOME} && "$1" test ${HOME} $(pwd)
+	awk "$1" cd local -eu printf "$1" "$@" awk
+	done && ${HOME} x=1 "$@" $(pwd) && -eu readonly printf local cd ${HOME}
+readonly cd local 2>/dev/null 2>/dev/null
+		local then awk readonly cd local 'quoted text' && 2>/dev/null 2>/dev/null
+	grep awk --verbose && then 'quoted text'
+	${HOME} "$@" /usr/bin awk local export && cd grep printf awk grep export
+	-eu test local done then "$1"
+echo ${HOME} 'quoted text' 'quoted text' 2>/dev/null $(pwd)
+		printf 'quoted text' "$1" 'quoted text'
+		export $(pwd) ${HOME} test --verbose
+	awk && sed then "$1"
+	done && | sed -eu cd "$1"
+		x=1 --verbose export /usr/bin local $(pwd) | cd
+		local 'quoted text' --verbose
+	| printf "$@" echo printf ${HOME} printf | test
+test export "$1" 2>/dev/null "$1" 'quoted text'
+		&& cd export local readonly grep -eu printf sed -eu readonly printf /usr/bin
+		/usr/bin -eu 'quoted text' grep awk echo cd "$1" ${HOME}
+2>/dev/null echo 'quoted text' sed ${HOME}
+	/usr/bin /usr/bin export "$@" "$@" 'quoted text'
+"$1" awk 'quoted text' 2>/dev/null
+-eu "$1" done readonly cd -eu "$1" cd && -eu echo
+${HOME} "$@" echo /usr/bin sed test /usr/bin readonly --verbose test
+done done grep --verbose | echo echo ${HOME} /usr/bin done
+		done then grep /usr/bin && local echo
+	${HOME} ${HOME} | cd x=1
+${HOME} | awk then test local /usr/bin /usr/bin 'quoted text'
+	--verbose /usr/bin cd echo
+	"$@" ${HOME} grep printf "$1" "$1" 2>/dev/null /usr/bin cd then echo
+		&& sed $(pwd) x=1 echo export readonly
+	${HOME} export --verbose "$@" x=1 readonly test && printf cd 'quoted text'
+		"$1" done --verbose | readonly test $(pwd) $(pwd) test ${HOME}
+	test echo ${HOME} export --verbose test
+		echo awk local sed test "$1" done $(pwd) then x=1 echo done
+		/usr/bin "$@" then sed --verbose export
+	cd grep "$@" 'quoted text' cd readonly
+	readonly $(pwd) printf $(pwd) --verbose --verbose ${HOME} export x=1 &&
+	echo --verbose readonly x=1 "$@" export export -eu export "$@"
+		then readonly $(pwd) echo x=1 printf then
+	'quoted text' sed 'quoted text' sed $(pwd) | sed x=1 done printf --verbose
+done -eu --verbose /usr/bin done /usr/bin grep echo printf 'quoted text'
+		local && /usr/bin grep
+	awk 'quoted text' sed done printf | -eu --verbose done
+		done ${HOME} then -eu readonly test local
+$(pwd) test cd echo /usr/bin x=1 /usr/bin
+		awk cd grep echo && done ${HOME} test | |
+		done && "$1" /usr/bin awk
+		awk awk export 'quoted text' x=1 done ${HOME}
+	then $(pwd) -eu then printf | export
+	export local && 'quoted text' grep grep awk 2>/dev/null
+	$(pwd) ${HOME} ${HOME} "$@" 'quoted text' && export 'quoted text' cd
+export "$1" "$1" echo $(pwd) done && && "$@"
+--verbose ${HOME} ${HOME} export cd $(pwd) /usr/bin test
+sed 'quoted text' ${HOME} ${HOME} echo printf cd "$@"
+	'quoted text' test -eu /usr/bin --verbose test $(pwd) --verbose
+		export awk 2>/dev/null awk sed done --verbose test 'quoted text' "$@" "$@"
+	printf 'quoted text' cd local local awk grep cd | && grep | grep x=1 cd grep export
+grep && 2>/dev/null test -eu 2>/dev/null echo printf
+	| --verbose cd ${HOME} done printf $(pwd) local grep /usr/bin cd echo /usr/bin
+		export x=1 grep | | 'quoted text'
+	awk x=1 /usr/bin /usr/bin cd | done ${HOME} --verbose awk cd /usr/bin awk cd
+--verbose "$1" | "$1" test echo | -eu 2>/dev/null cd then done 2>/dev/null
+local $(pwd) then x=1 -eu 2>/dev/null -eu export
+	done done $(pwd) echo cd x=1 printf
+	test printf 'quoted text' | "$1" local cd ${HOME} "$1" then "$@" export 2>/dev/null
+		then x=1 grep | "$1" 'quoted text' x=1 "$1" sed printf readonly
+	$(pwd) sed -eu | | done 2>/dev/null
+	printf | local $(pwd) ${HOME} && awk | ${HOME} "$@" cd /usr/bin test && then
+"$@" awk done sed /usr/bin local "$@" grep cd "$@"
+${HOME} echo echo x=1 cd -eu test $(pwd)
+	x=1 awk cd | printf $(pwd) /usr/bin cd echo awk
+	${HOME} "$@" grep $(pwd) local sed "$1" &&
+2>/dev/null ${HOME} sed && export test && local test local
+-eu export $(pwd) printf 2>/dev/null $(pwd) 'quoted text'
+	"$1" readonly test -eu "$@" export grep done --verbose
+	--verbose "$@" x=1 cd test && grep done 2>/dev/null
+		awk grep /usr/bin 'quoted text'
+	"$1" echo -eu --verbose /usr/bin export export sed sed sed
+		printf done done $(pwd) | local readonly test sed
+/usr/bin then /usr/bin echo x=1 ${HOME} cd readonly | cd cd done --verbose local
+		readonly "$1" "$@" "$1" 'quoted text' /usr/bin 2>/dev/null test test && done $(pwd)
+	local "$@" ${HOME} 2>/dev/null 2>/dev/null then
+echo | -eu $(pwd) x=1
+	done $(pwd) 2>/dev/null readonly then export test "$1" grep local 2>/dev/null
+	done 2>/dev/null ${HOME} | -eu ${HOME}
+local grep cd ${HOME} 2>/dev/null
+		done "$@" then local printf readonly
+	awk cd 2>/dev/null --verbose done
+echo sed "$@" export && 2>/dev/null echo export readonly grep && --verbose --verbose
+		&& 'quoted text' "$1" ${HOME} awk && test then grep /usr/bin readonly
+echo 'quoted text' "$1" 2>/dev/null
+test test cd grep sed "$@" test sed then cd then
+	2>/dev/null readonly x=1 "$@"
+awk printf printf readonly printf
+		x=1 grep echo ${HOME} 2>/dev/null 'quoted text' printf sed | awk | local "$1"
+awk x=1 && cd 2>/dev/null local -eu &&
+		'quoted text' ${HOME} "$@" local
+--verbose done "$@" cd -eu 2>/dev/null
+		echo 2>/dev/null "$@" grep 'quoted text' "$@" sed 'quoted text' "$@" cd -eu 2>/dev/null
+		grep then "$@" | cd done grep
+x=1 -eu "$@" && ${HOME} 'quoted text' --verbose
+		cd 2>/dev/null -eu "$@"
+		$(pwd) "$1" x=1 cd | readonly "$1"
+		local -eu -eu awk awk export
+2>/dev/null --verbose echo awk 2>/dev/null -eu 'quoted text'
+	local --verbose local
+		export echo readonly "$1" printf test 2>/dev/null export done
+	echo sed ${HOME} echo grep
+	sed local grep ${HOME} export test 2>/dev/null then test test echo
+--verbose readonly local local
+sed "$@" && sed "$1" sed test 2>/dev/null grep | done x=1
+		| ${HOME} awk grep export local then readonly
+printf $(pwd) done test x=1 sed /usr/bin export -eu x=1 --verbose && "$@"
+		-eu printf 2>/dev/null awk echo /usr/bin export cd "$@" echo
+		2>/dev/null 'quoted text' 2>/dev/null cd then done grep --verbose
+	$(pwd) "$@" "$@" -eu awk -eu echo /usr/bin
+	echo && && done ${HOME} printf x=1 x=1 local -eu /usr/bin 'quoted text' echo
+done -eu ${HOME} awk && "$@" x=1
+	/usr/bin x=1 "$@" sed export
+echo $(pwd) "$@" awk x=1 2>/dev/null
+	grep && echo ${HOME} $(pwd) | 2>/dev/null |
+-eu && cd grep echo -eu echo printf echo test && then test done sed cd echo printf
+awk printf "$1" local readonly 'quoted text' echo -eu /usr/bin "$1"
+"$1" /usr/bin "$1" readonly | "$@" done
+		test "$1" done --verbose --verbose | done
+		2>/dev/null sed printf done ${HOME} &&
+	awk grep cd printf x=1 "$@" /usr/bin local echo "$1" 'quoted text' -eu export
+		$(pwd) sed 'quoted text' x=1 ${HOME} printf
+	then printf readonly --verbose
+done $(pwd) /usr/bin
+		x=1 cd /usr/bin "$@" ${HOME}
+	| printf /usr/bin grep 'quoted text' --verbose awk cd &&
+	done test local && local then local "$1" x=1 /usr/bin echo --verbose
+		echo "$@" 2>/dev/null -eu | export
+${HOME} done export printf done export
+"$@" ${HOME} sed readonly export
+	--verbose | "$@" && 2>/dev/null grep echo test 'quoted text' "$1"
+		local test -eu $(pwd) then grep 'quoted text' sed /usr/bin
+	"$1" printf grep sed awk 'quoted text' x=1 readonly
+	"$@" /usr/bin export
+done "$@" sed export && | 2>/dev/null export test grep ${HOME} local
+		/usr/bin awk 2>/dev/null "$1" then && readonly && --verbose
+	local sed -eu /usr/bin done readonly grep printf
+--verbose && && 'quoted text' ${HOME} 'quoted text'
+		cd grep sed printf $(pwd) && x=1 -eu grep readonly "$1"
+		/usr/bin cd | $(pwd) "$@" /usr/bin
+	export 2>/dev/null awk cd ${HOME} cd 'quoted text' "$@" "$@" awk $(pwd)
+| awk 2>/dev/null readonly ${HOME} grep -eu test done ${HOME}
+		&& ${HOME} sed printf "$@" $(pwd) 'quoted text'
+		2>/dev/null test /usr/bin local printf "$@" $(pwd) 'quoted text'
+export awk awk echo -eu echo sed export then | echo grep local
+-eu /usr/bin 2>/dev/null | echo
+	2>/dev/null $(pwd) 2>/dev/null sed "$1" export printf
+		awk "$@" local echo test grep test && echo grep | cd test sed /usr/bin printf
+cd local /usr/bin 'quoted text' echo then x=1
+	x=1 -eu /usr/bin "$@"
+${HOME} cd "$1" test grep readonly
+		done grep -eu local 'quoted text' $(pwd) then /usr/bin && readonly --verbose --verbose
+		export printf test test "$1" && && |
+		awk ${HOME} export awk export grep ${HOME} ${HOME} "$1" 2>/dev/null local grep
+	| done 2>/dev/null ${HOME} 'quoted text' cd done | /usr/bin --verbose
+	x=1 readonly -eu "$1" echo sed "$1" done export
+	then x=1 test 2>/dev/null done /usr/bin then $(pwd) test ${HOME} test "$1" done
+		${HOME} printf x=1 cd then test local 'quoted text'
+&& export --verbose then 'quoted text' echo
+readonly awk awk printf $(pwd) sed printf
+	readonly /usr/bin 2>/dev/null /usr/bin
+	-eu cd test readonly grep sed | grep grep sed echo
+		${HOME} export 2>/dev/null readonly
+--verbose printf echo "$1"
+awk readonly 'quoted text' printf -eu "$1"
+	awk readonly printf && printf ${HOME} printf
+local "$1" 2>/dev/null echo "$1" 'quoted text'
+awk && awk grep | "$1" then readonly ${HOME} echo readonly x=1 echo
+	&& | "$1" 'quoted text' "$1"
+then echo local awk ${HOME} | x=1 test 'quoted text' && 2>/dev/null
+${HOME} cd export x=1 test echo local && ${HOME}
+		awk 'quoted text' 2>/dev/null test "$1" $(pwd) export sed sed done && awk
+#include c231.sh
+		/usr/bin -eu --verbose "$1" sed awk 'quoted text'
+awk 'quoted text' awk /usr/bin | -eu && printf && done "$@" && export "$@" grep
+	then then cd echo test cd test
+2>/dev/null | 2>/dev/null
+	test -eu -eu "$@" awk printf echo $(pwd) --verbose cd sed done
+		printf 'quoted text' local awk printf $(pwd) 2>/dev/null
+local local local then local printf -eu export export 'quoted text' test
+	test "$1" /usr/bin then --verbose test test
+| grep "$1" readonly -eu ${HOME} /usr/bin /usr/bin x=1 grep $(pwd)
+	printf && $(pwd) -eu 2>/dev/null x=1
+		2>/dev/null test printf | -eu cd 2>/dev/null "$1" awk && $(pwd)
+	2>/dev/null then | /usr/bin cd 'quoted text' grep
+sed export cd /usr/bin -eu echo 2>/dev/null test grep --verbose grep x=1 && ${HOME}
+export && 2>/dev/null echo cd && -eu done --verbose
+&& ${HOME} | 2>/dev/null sed 2>/dev/null
+		/usr/bin --verbose "$@"
+		export test cd sed export local readonly | grep then | ${HOME} readonly
+awk echo $(pwd) export printf 2>/dev/null cd done export export
+	printf done 'quoted text' ${HOME} sed $(pwd)
+	${HOME} 'quoted text' export sed 2>/dev/null $(pwd) x=1 | export
+/usr/bin /usr/bin $(pwd) | echo sed local
+		/usr/bin --verbose "$1" 2>/dev/null "$1" grep grep "$@" "$@" cd awk
+export -eu test && $(pwd) 2>/dev/null export "$@" "$1" --verbose readonly
+	test test readonly "$1" local then export sed sed
+	grep sed 'quoted text' 2>/dev/null local ${HOME} && printf sed echo printf
+	cd $(pwd) printf cd --verbose
+	--verbose /usr/bin x=1 then printf awk readonly -eu
+		--verbose awk grep -eu local "$@" -eu && $(pwd) -eu -eu $(pwd) 2>/dev/null |
+	test awk -eu | | readonly "$1"
+		'quoted text' /usr/bin sed cd $(pwd) grep done readonly
+test cd cd sed 'quoted text'
+		x=1 readonly export awk --verbose --verbose done
+readonly $(pwd) | | $(pwd) test 2>/dev/null test && $(pwd)
+		sed export | $(pwd) test readonly
+		| test | awk --verbose awk awk printf $(pwd) cd grep "$@" --verbose -eu cd
+done "$@" --verbose local ${HOME}
+local echo awk -eu then /usr/bin |
+		grep test then sed printf sed export
+	echo local grep x=1 $(pwd) then local printf --verbose
+	/usr/bin then "$1" "$@" echo -eu "$1" echo "$@"
+		test /usr/bin | sed 'quoted text' echo export x=1 ${HOME} awk sed readonly
+		cd --verbose $(pwd) 2>/dev/null && test 2>/dev/null --verbose done ${HOME} cd
+	cd 'quoted text' "$@" local echo done ${HOME} done "$@" local
+cd "$@" 'quoted text' test | 2>/dev/null awk done ${HOME} awk "$1" then
+| cd awk -eu then 'quoted text' $(pwd) local | -eu
+	local then "$@" echo "$@" cd "$@" grep 2>/dev/null
+		cd done export $(pwd) "$1" cd local test 'quoted text' sed readonly
+		"$1" /usr/bin readonly awk test printf
+printf "$1" grep -eu | then ${HOME} readonly grep "$1" test x=1 echo
+echo local grep export grep awk test readonly x=1 awk ${HOME} ${HOME}
+		printf /usr/bin test $(pwd) $(pwd) 2>/dev/null ${HOME}
+		done done then done export $(pwd) "$@" ${HOME} ${HOME} awk readonly local -eu
+	| | 'quoted text' && && local awk | printf $(pwd) x=1 && readonly
+&& echo 'quoted text' 2>/dev/null 'quoted text' export readonly
+	/usr/bin $(pwd) -eu sed $(pwd) ${HOME} cd --verbose cd -eu
+		/usr/bin $(pwd) ${HOME} $(pwd) printf 'quoted text' local ${HOME} echo
+	printf local done ${HOME} cd && 2>/dev/null local readonly grep
+		grep -eu cd "$1" ${HOME} then local
+printf export -eu awk --verbose echo 2>/dev/null --verbose
+		'quoted text' | sed ${HOME} printf export -eu cd echo grep --verbose
+		then x=1 $(pwd) $(pwd) -eu awk test echo -eu | && done 'quoted text' test "$1"
+readonly -eu readonly cd export /usr/bin
+/usr/bin printf printf
+--verbose "$1" awk local grep 2>/dev/null then echo
+		readonly $(pwd) then then sed local "$@" /usr/bin "$@" local ${HOME} local then
+	&& --verbose export && echo ${HOME} "$@" "$1" ${HOME} -eu
+done cd /usr/bin echo "$@" | done sed ${HOME}
+	test ${HOME} echo 2>/dev/null
+		$(pwd) cd echo 2>/dev/null local | --verbose grep done ${HOME}
+	2>/dev/null printf done printf --verbose printf grep cd && "$1" "$1"
+		awk then ${HOME} "$@" test
+&& cd 'quoted text' then
+		'quoted text' 'quoted text' readonly $(pwd) awk 2>/dev/null grep echo grep
+	"$@" x=1 test then && --verbose 2>/dev/null "$1" test
+/usr/bin "$@" done awk "$@" | cd then $(pwd) awk &&
+${HOME} cd cd awk test local $(pwd) grep "$@" 2>/dev/null -eu test then
+2>/dev/null 'quoted text' awk 'quoted text' readonly
+		| "$@" readonly local 'quoted text' local
+local done cd && --verbose
+"$1" ${HOME} "$@" 'quoted text'
+&& 2>/dev/null grep grep --verbose --verbose
+	printf | readonly printf /usr/bin
+	x=1 | local cd awk printf
+"$1" | export readonly sed printf -eu grep then grep local
+		echo -eu $(pwd) export cd cd then
+	readonly "$1" then | 2>/dev/null
+${HOME} cd 2>/dev/null then done | "$1" then /usr/bin then ${HOME} then |
+		--verbose x=1 sed cd $(pwd) && && | echo done
+		/usr/bin printf echo readonly grep 'quoted text' readonly 'quoted text'
+	"$@" awk -eu cd x=1 'quoted text' 'quoted text' cd | grep
+	readonly && readonly "$1" "$@" readonly local readonly
+		${HOME} x=1 "$@" sed 2>/dev/null cd export
+	--verbose readonly 'quoted text' then
+		| test | 2>/dev/null
+	test /usr/bin 2>/dev/null cd x=1 2>/dev/null export x=1
+	"$@" /usr/bin export awk
+		printf && x=1 && awk export && export 'quoted text' --verbose test $(pwd) 2>/dev/null
+		then then export echo 'quoted text' then /usr/bin readonly --verbose | printf printf
+	local 2>/dev/null | && export done done export | local 'quoted text' awk
+	&& readonly -eu test 2>/dev/null 'quoted text'
+	| ${HOME} readonly 'quoted text' done export 2>/dev/null done
+		-eu -eu | --verbose printf sed ${HOME} -eu printf
+	x=1 local x=1 "$1" cd ${HOME} export done "$1" 2>/dev/null "$1" ${HOME} 'quoted text'
+--verbose "$@" "$@" && && --verbose echo ${HOME} "$1" cd
+		'quoted text' -eu local awk $(pwd) x=1 echo | local done awk && awk
+	cd then cd ${HOME} grep readonly x=1 printf | 'quoted text' | export ${HOME}
+	echo test -eu | local sed
+	export test | test cd $(pwd)
+		&& awk local /usr/bin cd "$@" | grep test
+	awk ${HOME} "$@" /usr/bin /usr/bin
+	cd "$@" then then test local cd 'quoted text' cd sed | "$@" 'quoted text'
+	test printf echo then echo x=1 -eu | -eu awk -eu "$1" | local 'quoted text'
+	export /usr/bin --verbose awk "$1" && cd | ${HOME} x=1 x=1
+		x=1 grep /usr/bin && export ${HOME} 2>/dev/null && ${HOME}
+grep readonly printf local local --verbose export && readonly local
+--verbose | "$1" sed $(pwd) -eu printf /usr/bin
+/usr/bin "$@" /usr/bin 2>/dev/null
+		"$1" "$1" $(pwd) then export
+&& readonly done "$1" ${HOME} cd
+		printf && ${HOME} "$1" --verbose
+	"$1" 'quoted text' then "$@" --verbose echo --verbose "$1"
+printf test /usr/bin local -eu awk /usr/bin "$@" $(pwd)
+x=1 ${HOME} /usr/bin export readonly printf readonly echo "$@" cd
+		2>/dev/null local --verbose |
+	${HOME} | local done cd
+		export ${HOME} x=1 local | test /usr/bin 2>/dev/null "$@"
+		then -eu -eu --verbose cd | readonly done
+"$@" "$@" done x=1 -eu 'quoted text'
+	--verbose then ${HOME} && | echo export test done "$@" cd 'quoted text'
+	'quoted text' x=1 "$1"
+awk "$1" printf --verbose "$1" "$1" &&
+		"$1" "$@" done "$@" printf /usr/bin test then
+echo test echo $(pwd) -eu --verbose 2>/dev/null grep test echo
+		grep "$1" /usr/bin done -eu grep then local -eu /usr/bin
+	awk printf x=1 'quoted text' && sed "$@"
+"$1" && readonly | awk printf /usr/bin -eu --verbose
+		sed "$1" done "$@" "$1" local awk sed /usr/bin
+		${HOME} readonly && ${HOME} && -eu "$1" /usr/bin
+then printf local /usr/bin
+	sed done 'quoted text' 2>/dev/null "$@"
+	"$@" grep | /usr/bin && --verbose $(pwd) "$1" readonly |
+grep && --verbose 2>/dev/null printf 2>/dev/null "$@"
+	local && && echo $(pwd) sed readonly sed awk "$1"
+		local -eu sed local local then sed
+		"$@" | cd export local $(pwd) sed test printf grep sed -eu echo
+x=1 "$@" then local && 'quoted text' test 2>/dev/null 2>/dev/null
+		readonly 'quoted text' awk /usr/bin x=1 sed ${HOME} --verbose printf export
+x=1 /usr/bin --verbose echo local cd printf readonly test
+${HOME} "$1" cd awk printf $(pwd) 'quoted text' ${HOME}
+"$@" sed -eu cd --verbose 2>/dev/null
+	x=1 grep echo /usr/bin ${HOME} grep | 'quoted text'
+"$1" "$@" echo printf awk --verbose 'quoted text' done awk
+		/usr/bin printf ${HOME} x=1 cd cd ${HOME} x=1 echo x=1 grep --verbose
+	-eu "$1" done export | cd printf
+		then 'quoted text' ${HOME} awk "$1"
+		| printf && test test grep local 'quoted text' local 'quoted text' export ${HOME}
+		-eu awk readonly && -eu awk "$1" printf printf awk --verbose
+	2>/dev/null grep && grep 2>/dev/null && cd then readonly awk 'quoted text'
+		readonly test -eu "$1" readonly x=1 grep sed "$1"
+		--verbose test export export sed sed 2>/dev/null -eu test export awk sed
+		readonly local test grep printf test && grep && "$@" | /usr/bin
+	x=1 ${HOME} then export test printf | awk printf cd done /usr/bin
+export printf | x=1 $(pwd) 'quoted text' ${HOME}
+		echo export sed x=1 printf --verbose test --verbose
+'quoted text' x=1 && test sed sed /usr/bin cd $(pwd) 2>/dev/null x=1 'quoted text'
+		"$@" export then -eu ${HOME} && ${HOME} then -eu ${HOME}
+	| | export /usr/bin local local awk x=1 export x=1 && done "$@"
+		"$1" test awk grep 'quoted text' $(pwd) $(pwd) sed then 'quoted text' /usr/bin
+		cd && x=1 then --verbose printf
+		--verbose /usr/bin 'quoted text'
+--verbose 'quoted text' echo "$1" done local 'quoted text' printf
+	"$@" test /usr/bin "$@" x=1 -eu done /usr/bin "$@" "$1" echo awk echo --verbose
+		readonly && awk local | "$1" ${HOME} && local
+	"$1" test "$@" x=1 "$@" 'quoted text'
+	awk && && -eu grep awk done printf /usr/bin awk cd && export x=1 grep local | x=1
+| && sed export x=1 "$@" export sed echo done | local export "$1" export grep
+	-eu export cd sed -eu export | awk test "$1" readonly printf
+		cd sed awk grep done "$@"
+printf then -eu 'quoted text' done test grep awk ${HOME}
+	then then 'quoted text' "$1" local && && test "$@" awk --verbose
+| 2>/dev/null --verbose
+	export export && 2>/dev/null
+	done ${HOME} then then test done 'quoted text' export 'quoted text'
+		done 'quoted text' done /usr/bin export "$1"
+printf "$@" done "$@" && "$1"
+	grep "$1" grep $(pwd) /usr/bin ${HOME} test |
+	2>/dev/null ${HOME} awk printf
+-eu "$1" done printf printf
+grep printf export $(pwd) && awk echo done
+		local 'quoted text' -eu && /usr/bin awk awk awk
+then cd done done then
+		then --verbose sed --verbose x=1 "$1" echo readonly $(pwd) readonly done --verbose
+readonly x=1 "$1" $(pwd) local $(pwd) x=1 'quoted text' | 'quoted text'
+	$(pwd) 'quoted text' $(pwd) awk awk echo sed x=1 readonly
+		awk --verbose readonly
+grep printf then /usr/bin local
+		grep ${HOME} echo 2>/dev/null cd export export local cd done local
+awk --verbose "$1" grep test -eu 2>/dev/null grep test export
+		test "$1" | awk | | "$1" 'quoted text'
+	test | local printf sed 2>/dev/null --verbose ${HOME} && "$@" -eu
+	"$@" cd printf done cd then /usr/bin --verbose "$1" $(pwd) --verbose
+	echo test x=1 | cd grep ${HOME}
+&& /usr/bin local grep awk --verbose
+		echo x=1 test /usr/bin test echo 2>/dev/null
+&& 'quoted text' echo -eu && export then cd
+	&& 'quoted text' x=1 2>/dev/null | 'quoted text'
+	-eu x=1 x=1 "$1" && /usr/bin $(pwd)
+local --verbose done awk --verbose "$1"
+		--verbose && 'quoted text' $(pwd) /usr/bin echo | |
+		-eu "$@" local $(pwd) -eu local
+then echo awk -eu sed $(pwd) grep grep printf | --verbose
+${HOME} && "$1" /usr/bin -eu "$1" echo test then | readonly
+		test cd -eu echo ${HOME} --verbose grep
+		-eu test -eu export grep readonly
+	grep awk test --verbose x=1 ${HOME} |
+$(pwd) 'quoted text' sed local then -eu 'quoted text' awk cd sed
+sed export awk awk $(pwd) readonly
+	x=1 echo awk -eu awk 2>/dev/null printf
+	export local printf "$@" test awk x=1 printf test "$@" printf readonly local cd
+readonly | local echo done | readonly $(pwd) /usr/bin
+test "$@" sed local printf "$@" && test test printf
+	"$@" export && printf done ${HOME} "$1" local cd then printf 2>/dev/null
+	export "$@" && done 2>/dev/null -eu readonly
+cd $(pwd) sed grep "$1"
+'quoted text' echo done -eu local ${HOME} cd -eu --verbose
+		done ${HOME} cd sed sed done readonly
+	${HOME} printf done && awk sed readonly x=1 x=1 x=1 cd 'quoted text' cd && $(pwd)
+&& 2>/dev/null 2>/dev/null
+	-eu "$@" 2>/dev/null echo x=1 done local
+	awk /usr/bin readonly export "$1" "$@" 'quoted text' echo ${HOME}
+		export -eu && 2>/dev/null test --verbose grep 'quoted text' --verbose 2>/dev/null
+printf /usr/bin export
+		x=1 sed ${HOME} "$@" | "$@" awk
+		/usr/bin ${HOME} local local "$1" done
+	awk ${HOME} "$1" --verbose | readonly local echo /usr/bin then && grep
+		$(pwd) 2>/dev/null ${HOME} "$@" 2>/dev/null
+$(pwd) printf export local "$@" cd echo -eu 2>/dev/null -eu ${HOME}
+readonly ${HOME} export -eu "$@" test "$1" printf done x=1 test
+-eu readonly cd cd --verbose sed -eu | $(pwd) "$1" $(pwd) 2>/dev/null "$@" grep
+	&& awk printf | "$1" awk --verbose
+'quoted text' x=1 /usr/bin export /usr/bin 2>/dev/null
+readonly 2>/dev/null grep 'quoted text'
+		grep "$@" printf --verbose
+	-eu -eu then x=1 $(pwd) 'quoted text' local "$@"
+done "$@" echo ${HOME} done 2>/dev/null ${HOME}
+/usr/bin 'quoted text' cd local readonly 2>/dev/null test 'quoted text'
+printf then 'quoted text' "$@" cd /usr/bin "$@" "$1" ${HOME} && "$@" 'quoted text'
+	"$1" 'quoted text' then "$@" | "$1" cd -eu ${HOME}
+export readonly "$1" done 2>/dev/null 2>/dev/null
+readonly && ${HOME} echo then -eu ${HOME} /usr/bin && test cd "$1" x=1 cd "$@"
+		local export done $(pwd) "$1" echo printf ${HOME} "$1" printf
+then then "$1" -eu export -eu | x=1 test "$@" export
+	"$@" grep then readonly done sed printf readonly && /usr/bin 'quoted text'
+	awk echo && test 2>/dev/null echo 2>/dev/null then done $(pwd) $(pwd) /usr/bin
+| /usr/bin "$1" readonly | $(pwd) echo echo --verbose
+		/usr/bin $(pwd) printf $(pwd) then grep sed readonly echo
+		readonly /usr/bin /usr/bin ${HOME} done grep then
+		--verbose /usr/bin done printf -eu | local done | 'quoted text' sed "$1" export
+	2>/dev/null x=1 "$1" 'quoted text' readonly 'quoted text' 2>/dev/null printf awk
+		x=1 /usr/bin "$@" "$@" export local then 'quoted text'
+cd "$1" printf "$@" x=1 ${HOME} cd $(pwd)
+	printf echo ${HOME} export local $(pwd) "$@" echo export
+local "$1" $(pwd) printf readonly && echo --verbose local
+	local awk | "$@" --verbose cd --verbose
+	$(pwd) grep export && && sed ${HOME} "$1" grep done then 'quoted text'
+		| x=1 local readonly sed && then export 'quoted text' 'quoted text' | && readonly
+-eu export awk x=1 ${HOME} /usr/bin x=1 /usr/bin readonly
+		awk awk --verbose --verbose
+-eu /usr/bin -eu x=1 "$@" 'quoted text' x=1 && local
+		then grep echo "$1" --verbose -eu local --verbose | -eu sed
+		then done cd /usr/bin && /usr/bin printf
+${HOME} cd --verbose done awk echo "$@" ${HOME} | grep
+		"$@" echo printf local 'quoted text'
+	printf 'quoted text' | && | ${HOME} awk 2>/dev/null test -eu then echo
+		local -eu 2>/dev/null grep
+		awk echo -eu "$1" --verbose && echo 'quoted text'
+/usr/bin | export cd grep && "$1" "$@" local "$@" ${HOME} ${HOME} awk
+	test -eu done sed | grep awk
+	local done ${HOME} readonly sed done
+		then ${HOME} then 2>/dev/null | readonly
+		done --verbose local echo /usr/bin test readonly x=1 ${HOME} -eu 2>/dev/null
+		--verbose "$@" readonly "$@" done cd $(pwd) echo ${HOME} sed printf then x=1
+${HOME} local then grep "$@" printf | local 'quoted text'
+		--verbose && 2>/dev/null "$1"
+--verbose done grep 'quoted text'
+readonly test && awk x=1 /usr/bin && printf "$1" test --verbose
+	grep && printf x=1 echo printf done echo then --verbose
+	"$@" $(pwd) -eu local echo x=1 export sed awk sed && 'quoted text'
+	2>/dev/null | --verbose --verbose -eu awk /usr/bin readonly 'quoted text'
+		cd cd | --verbose then 'quoted text' local -eu then then 2>/dev/null
+"$1" done local "$1" awk 2>/dev/null
+	--verbose cd 2>/dev/null sed then echo sed x=1 cd x=1 /usr/bin
+	echo echo 2>/dev/null --verbose 'quoted text' "$@" --verbose
+	&& readonly --verbose | /usr/bin
+		${HOME} x=1 x=1 cd grep printf printf echo export printf
+		2>/dev/null /usr/bin grep then $(pwd) cd
+	/usr/bin grep sed && "$1" && awk 'quoted text' && awk "$@" then $(pwd)
+	2>/dev/null "$1" done -eu cd /usr/bin --verbose && --verbose |
+		then ${HOME} 'quoted text' readonly
+	then test sed | readonly ${HOME} done
+	x=1 done echo "$1" "$@" "$@" --verbose
+		| then grep awk x=1 then "$@" "$@"
+		printf cd | readonly done printf x=1 done cd ${HOME} -eu x=1 local echo
+then grep readonly /usr/bin x=1 x=1 -eu local -eu ${HOME}
+awk done cd && | grep /usr/bin --verbose --verbose readonly x=1 /usr/bin
+		-eu && -eu $(pwd) grep $(pwd) export x=1 x=1
+	local 'quoted text' 'quoted text'
+then 2>/dev/null cd -eu cd echo cd cd --verbose local awk printf printf "$@"
+${HOME} echo --verbose 'quoted text' && x=1 "$@" sed
+		x=1 --verbose grep 'quoted text'
+	--verbose x=1 x=1 grep test
+grep export cd | test echo ${HOME} 'quoted text' | 2>/dev/null
+export readonly printf printf $(pwd) --verbose "$@" && awk local done test
+	"$1" /usr/bin -eu -eu --verbose /usr/bin --verbose
+		readonly "$@" /usr/bin printf && --verbose
+'quoted text' sed cd export
+		x=1 echo | ${HOME} --verbose -eu "$1" "$1" awk done &&
+awk local printf echo grep --verbose export
+		local sed $(pwd) && echo 2>/dev/null local local local $(pwd) test -eu /usr/bin
+		awk | sed "$@" -eu "$1" echo 2>/dev/null
+		export test --verbose $(pwd) 'quoted text'
+done x=1 "$@" test echo awk then /usr/bin
+"$@" sed | | echo awk
+printf export cd awk ${HOME} awk readonly 2>/dev/null readonly
+		readonly echo "$@" awk awk printf ${HOME} -eu "$1" "$1" "$1"
+		| then printf awk awk | export ${HOME} 2>/dev/null
+	grep awk done 2>/dev/null 2>/dev/null
+		$(pwd) -eu 'quoted text' ${HOME} then printf "$@" echo printf local
+	then awk --verbose awk done && "$@" sed
+"$1" readonly local grep sed "$@" echo sed
+		export printf --verbose 'quoted text' --verbose grep 'quoted text' ${HOME}
+		-eu awk "$@" then | | cd cd printf echo 'quoted text' sed 'quoted text'
+		sed x=1 "$@" /usr/bin export export 2>/dev/null export ${HOME} awk printf awk
+		2>/dev/null -eu $(pwd) export -eu printf ${HOME} ${HOME}
+		readonly awk grep test awk --verbose export readonly
+	/usr/bin test -eu -eu $(pwd) $(pwd) readonly readonly
+		"$@" && echo 'quoted text' awk | /usr/bin then ${HOME} -eu printf |
+&& then "$1" readonly /usr/bin readonly
+2>/dev/null printf "$1" cd $(pwd)
+		'quoted text' grep $(pwd) awk x=1 ${HOME} | grep && local "$1" ${HOME} ${HOME}
+	-eu 2>/dev/null echo export
+/usr/bin -eu grep "$1" 2>/dev/null $(pwd) |
+local test /usr/bin readonly -eu
+	cd local | echo then local x=1 then --verbose ${HOME}
+		local ${HOME} /usr/bin printf sed done export x=1 then printf x=1
+		"$@" done "$@" 'quoted text' 'quoted text'
+		'quoted text' 'quoted text'
+	cd "$1" "$1" 'quoted text' awk awk -eu 2>/dev/null 'quoted text' x=1 2>/dev/null
+	"$1" readonly sed printf export local | done 'quoted text'
+	echo ${HOME} cd printf $(pwd) "$1" printf x=1
+		&& | cd 2>/dev/null local local grep && $(pwd) --verbose x=1 printf ${HOME} done
+-eu export | local x=1 ${HOME}
+	2>/dev/null done echo | echo readonly "$1" /usr/bin
+		2>/dev/null --verbose x=1 grep then && awk printf readonly "$@" "$@" done
+	${HOME} test 'quoted text' printf printf "$1" echo -eu | && test
+${HOME} -eu "$@" then 'quoted text' "$1" 'quoted text' printf local
+	cd -eu --verbose sed 'quoted text' sed "$1" sed export /usr/bin | printf "$@"
+		&& && local "$1" && done test 2>/dev/null local
+		-eu /usr/bin then sed readonly export 2>/dev/null "$1" done cd local done "$@"
+		${HOME} -eu done echo
+		/usr/bin local $(pwd) done x=1 ${HOME} /usr/bin x=1 "$@"
+x=1 "$1" x=1 "$@" /usr/bin sed 'quoted text' done then test
+"$@" printf 2>/dev/null "$@" printf readonly 'quoted text' done | export &&
+	sed cd cd && local $(pwd) test -eu $(pwd) "$@" cd local done $(pwd)
+		sed export awk sed export awk grep echo printf export cd 2>/dev/null
+&& 2>/dev/null grep /usr/bin 'quoted text'
+		/usr/bin echo sed | then
+	-eu echo cd awk echo "$1" done then "$@" "$@"
+		readonly sed readonly sed "$1" /usr/bin readonly readonly grep readonly
+	cd --verbose 2>/dev/null /usr/bin readonly export
+test "$1" 2>/dev/null 'quoted text'
+$(pwd) | x=1 grep ${HOME} grep | cd cd echo x=1 --verbose local test
+'quoted text' sed "$1" &&
+	&& awk readonly readonly printf
+	x=1 cd "$1" "$@" | grep grep 'quoted text'
+	readonly test $(pwd) awk test $(pwd) "$@" local
+	done && local local local -eu
+awk && $(pwd) 2>/dev/null ${HOME} && done && readonly then /usr/bin
+"$@" $(pwd) "$1" done export awk awk x=1 cd --verbose "$@"
+awk cd export "$@" && echo
+	2>/dev/null readonly /usr/bin cd local "$1" $(pwd) 2>/dev/null x=1
+		-eu readonly done ${HOME} 2>/dev/null done "$@" "$1"
+--verbose grep done cd /usr/bin &&
+	-eu cd "$1" readonly ${HOME} grep "$@" | echo cd | echo && -eu x=1 printf
+	${HOME} done ${HOME} $(pwd) | grep && then 2>/dev/null grep /usr/bin local done
+	then | | && $(pwd) --verbose local /usr/bin echo sed cd "$1" echo echo /usr/bin
+	&& sed grep test --verbose cd awk export test export | "$@" readonly
+		'quoted text' grep 'quoted text' export
+	2>/dev/null "$1" awk 2>/dev/null local test
+	test sed $(pwd) done printf $(pwd) export done | local /usr/bin
+printf /usr/bin export && "$1" cd local test | --verbose $(pwd) awk 2>/dev/null
+	-eu "$1" 2>/dev/null $(pwd) then "$1" grep readonly "$@" readonly done
+"$1" 2>/dev/null echo test done export
+cd echo cd then /usr/bin local && /usr/bin
+	| --verbose sed | "$@" then "$1" 'quoted text' x=1 "$@" awk "$@"
+		${HOME} | | --verbose readonly echo readonly 'quoted text' local "$@" $(pwd)
+$(pwd) "$1" 'quoted text' $(pwd) echo echo 2>/dev/null && --verbose | | done
+sed local "$1" "$@" export awk done echo
+		local test --verbose ${HOME} sed -eu printf && echo echo --verbose
+done printf awk x=1 cd awk readonly /usr/bin sed awk 'quoted text' test
+	readonly echo "$@" && /usr/bin 'quoted text' "$1" 2>/dev/null
+--verbose export cd 'quoted text' 'quoted text' 2>/dev/null
+	-eu awk export then "$1" test "$@" | done sed sed $(pwd) 2>/dev/null then cd
+-eu "$@" grep ${HOME} done sed ${HOME} test cd cd --verbose sed x=1 printf
+	local "$1" /usr/bin x=1
+	&& -eu done 'quoted text' then grep x=1 then grep 2>/dev/null 'quoted text'
+then printf test then echo printf "$1" then -eu awk /usr/bin done echo printf
+	awk && cd ${HOME} "$1"
+		local 'quoted text' "$@" | && echo "$1" "$@" sed printf export
+		--verbose echo local "$@" "$@"
+| --verbose local $(pwd) $(pwd) /usr/bin
+-eu /usr/bin test 2>/dev/null done test grep -eu 'quoted text'
+	$(pwd) local sed awk local
+	awk "$@" local | readonly sed local awk echo x=1 -eu --verbose "$1"
+	cd sed --verbose test x=1 test export --verbose printf
+		"$@" | then echo $(pwd) "$1" && "$1" ${HOME} ${HOME}
+	cd export export ${HOME} awk
+	export 2>/dev/null cd grep cd then printf $(pwd)
+		'quoted text' "$@" test && --verbose test
+export /usr/bin 2>/dev/null cd local
+		local && sed | 2>/dev/null x=1 | x=1 printf
+'quoted text' cd echo | $(pwd) $(pwd)
+	awk echo && awk then ${HOME} x=1 cd export && 'quoted text' readonly -eu local
+		x=1 && x=1 readonly done /usr/bin /usr/bin "$@" export then grep
+	${HOME} local grep --verbose awk x=1 "$1" | grep awk
+export export $(pwd) export
+	"$@" 2>/dev/null grep && then $(pwd) "$@" x=1 test awk test test readonly
+	$(pwd) ${HOME} echo test then x=1 $(pwd) printf x=1 $(pwd) $(pwd) echo done
+--verbose then 2>/dev/null /usr/bin 2>/dev/null x=1
+	2>/dev/null ${HOME} readonly readonly
+export test readonly | /usr/bin
+	-eu awk && awk done sed awk --verbose
+	awk "$@" --verbose local
+cd && "$1" done local 'quoted text' 2>/dev/null
+	"$1" -eu echo | | sed --verbose cd
+	awk "$@" local readonly 'quoted text' export awk
+	then && --verbose echo cd "$@" done "$1" sed ${HOME} | ${HOME} "$1" ${HOME}
+done printf | export && ${HOME} | grep grep && readonly cd readonly "$@" test printf
+	"$1" printf -eu "$@" ${HOME} done --verbose "$@" grep /usr/bin grep | /usr/bin
+${HOME} cd then $(pwd) | export readonly sed readonly readonly
+		x=1 cd test x=1 --verbose
+		then | cd --verbose 'quoted text' $(pwd) test done
+	| awk | --verbose grep x=1 printf sed
+		done --verbose -eu export && -eu sed 'quoted text' --verbose 2>/dev/null sed "$1"
+export --verbose "$1" local test /usr/bin cd local
+export 2>/dev/null "$@" export | ${HOME} done
+	echo "$@" && then echo -eu ${HOME} | 2>/dev/null x=1 ${HOME}
+	grep --verbose 'quoted text' x=1 --verbose local $(pwd) "$1" "$1" ${HOME} printf
+export | x=1 echo sed test printf printf awk awk test then /usr/bin
+		sed done && done sed -eu
+	"$1" grep printf awk grep echo awk --verbose
+	2>/dev/null test awk done export /usr/bin -eu cd sed -eu sed | printf
+		| "$1" sed done export --verbose -eu
+sed then && --verbose grep readonly local printf
+		local "$1" "$1" awk 'quoted text'
+	2>/dev/null --verbose local /usr/bin 2>/dev/null && ${HOME} --verbose
+		--verbose $(pwd) --verbose && ${HOME}
+		test grep grep printf 2>/dev/null test
+	2>/dev/null ${HOME} ${HOME} "$@"
+"$1" then && local | echo readonly --verbose echo
+sed readonly readonly --verbose echo readonly "$@"
+	"$1" printf then then echo "$1"
+	readonly x=1 "$1" then readonly
+	grep done cd test printf export
+	awk readonly sed "$1" 2>/dev/null --verbose local "$@" --verbose "$1"
+		cd -eu readonly && echo grep local "$@" printf ${HOME} ${HOME} grep
+		readonly "$1" echo export $(pwd) "$1" "$1" done
+	done done | readonly x=1 printf /usr/bin grep
+		"$1" 'quoted text' /usr/bin
+export export x=1 echo then export
+		cd grep | x=1 sed sed grep
+	'quoted text' ${HOME} local export awk then --verbose |
+	export 'quoted text' 2>/dev/null --verbose --verbose local 2>/dev/null
+test awk $(pwd) /usr/bin printf then x=1 awk
+		export /usr/bin | ${HOME} "$1" "$1" test ${HOME} echo /usr/bin
+		echo x=1 export | awk echo cd -eu | awk grep echo $(pwd) grep readonly sed local
+readonly grep local /usr/bin | 'quoted text' 2>/dev/null && grep 'quoted text'
+		sed export "$@" printf local "$@" local -eu /usr/bin done "$1" /usr/bin
+done done awk $(pwd) -eu | then test then && export ${HOME}
+	/usr/bin 'quoted text' ${HOME} $(pwd) echo done x=1 2>/dev/null grep
+x=1 cd $(pwd) test local 2>/dev/null 2>/dev/null awk awk awk grep "$1" "$@"
+echo test export ${HOME} "$@" -eu export then $(pwd) grep | sed export
+--verbose 2>/dev/null readonly local
+	awk printf printf cd readonly sed printf -eu "$1"
+	echo --verbose -eu && ${HOME} readonly printf test readonly $(pwd)
+local -eu printf readonly -eu done --verbose local $(pwd) grep && done
+readonly x=1 x=1 --verbose local $(pwd) $(pwd) echo local "$@" x=1 ${HOME}
+	x=1 test ${HOME} grep sed echo awk 2>/dev/null 'quoted text'
+then readonly grep $(pwd) cd /usr/bin readonly
+		printf "$1" echo $(pwd)
+		"$@" -eu export "$@" && grep done awk --verbose "$1" "$@"
+readonly && "$@" ${HOME} x=1 /usr/bin then awk
+--verbose printf then /usr/bin $(pwd)
+		readonly readonly readonly "$1" "$@" --verbose &&
+		"$1" x=1 sed then test printf local readonly ${HOME} local echo export | "$@"
+		${HOME} export $(pwd) test readonly test awk cd
+2>/dev/null 2>/dev/null test grep | local sed /usr/bin
+		printf ${HOME} | cd printf test echo $(pwd) x=1 --verbose ${HOME}
+test printf /usr/bin ${HOME} echo then $(pwd) /usr/bin 2>/dev/null cd x=1 done grep
+		'quoted text' export grep awk printf /usr/bin $(pwd) cd "$@" grep -eu | x=1
+	"$@" 'quoted text' printf printf ${HOME} done
+	echo test sed 'quoted text' $(pwd) | ${HOME} "$1" --verbose test | $(pwd)
+grep grep grep 'quoted text' done "$@" /usr/bin then printf then "$1" cd
+readonly --verbose -eu cd ${HOME} "$1" | /usr/bin printf -eu
+		x=1 export "$@" x=1 awk "$@" cd awk /usr/bin local printf done
+		'quoted text' then x=1 "$@" -eu && echo "$1" "$@" "$1" local cd printf sed
+echo export $(pwd) sed echo done
+	${HOME} "$1" && && sed --verbose export "$@"
+2>/dev/null -eu -eu local printf "$@"
+		/usr/bin cd && && printf ${HOME} test
+	${HOME} done "$@" echo x=1 test
+		x=1 readonly local -eu x=1 printf echo x=1 x=1 -eu printf readonly done x=1 --verbose
+	awk && | export test "$@" x=1 done
+	"$@" awk done done printf sed --verbose local
+		--verbose $(pwd) "$@" grep x=1 --verbose 'quoted text' grep /usr/bin 2>/dev/null
+	grep "$@" then "$1" then readonly
+	test export local --verbose printf test readonly && "$@" && printf x=1 2>/dev/null
+	local done "$@" "$@" test $(pwd) readonly
+"$1" then grep "$@" -eu x=1 | "$@" export awk x=1 x=1 && /usr/bin "$1"
+		then echo readonly sed readonly /usr/bin
+	test printf "$1" ${HOME} grep "$1"
+sed "$1" grep awk awk then export
+		/usr/bin "$1" ${HOME} 'quoted text'
+		${HOME} | "$@" test done --verbose && "$@" printf -eu
+	"$1" export /usr/bin x=1 cd echo | x=1 | "$@"
+	then then 'quoted text' &&
+	echo x=1 2>/dev/null --verbose "$1" | "$@" | -eu grep then done sed x=1
+	$(pwd) echo echo echo 'quoted text' awk ${HOME} printf cd "$1" readonly /usr/bin
+		cd local && ${HOME} readonly done test sed test /usr/bin test done test "$1"
+		x=1 'quoted text' grep "$@" echo 2>/dev/null
+x=1 echo -eu echo awk 'quoted text' | && -eu x=1
+done awk awk && done readonly done x=1 readonly
+		local done test && --verbose && awk echo "$@"
+		'quoted text' echo grep -eu echo -eu
+		sed "$@" | | printf printf $(pwd) export x=1
+printf -eu $(pwd) test export ${HOME} local $(pwd) done echo 'quoted text' 2>/dev/null
+cd done x=1 "$1" export --verbose printf done && then
+		test --verbose cd | "$@" "$@" 2>/dev/null "$1" $(pwd)
+		"$1" readonly --verbose then sed 'quoted text'
+'quoted text' -eu /usr/bin x=1 export export echo then
+	"$@" && grep -eu done 'quoted text' sed &&
+--verbose --verbose --verbose
+'quoted text' | then --verbose $(pwd) cd "$1" "$1" 'quoted text' test "$@"
+		2>/dev/null 'quoted text' "$1" --verbose x=1 then $(pwd) "$@"
+		--verbose x=1 /usr/bin cd $(pwd)
+	-eu -eu cd "$@" ${HOME} --verbose 2>/dev/null local |
+		grep sed printf done | 'quoted text' awk --verbose done grep
+	-eu printf 'quoted text' && printf readonly ${HOME} readonly done
+		readonly test -eu 'quoted text' grep "$@" $(pwd)
+	export awk ${HOME} /usr/bin awk /usr/bin sed readonly "$@" $(pwd)
+readonly x=1 sed -eu export local done "$1" awk | "$1" 2>/dev/null 2>/dev/null
+		2>/dev/null awk 'quoted text' local && export local 2>/dev/null test | ${HOME} export
+	"$@" readonly 'quoted text'
+	--verbose -eu 2>/dev/null printf 2>/dev/null echo | local -eu && export
+	${HOME} test echo ${HOME} 'quoted text' ${HOME} "$@" && | | test then && sed
+		awk -eu --verbose test 2>/dev/null sed then x=1 grep --verbose printf
+	2>/dev/null x=1 2>/dev/null readonly | $(pwd) then cd ${HOME} awk then
+sed | cd grep printf export local 'quoted text' "$1" -eu | 'quoted text'
+&& cd /usr/bin "$@" cd awk done echo test
+		${HOME} export cd local "$1" "$@" ${HOME} | test 2>/dev/null
+x=1 cd ${HOME} "$@" done printf cd grep $(pwd) 'quoted text' sed test $(pwd)
+printf && "$1" 'quoted text' test export 'quoted text' export awk awk --verbose
+		done printf /usr/bin done "$@" cd cd test cd
+		"$@" | cd 'quoted text' local echo "$@" $(pwd) 'quoted text' --verbose grep
+	sed printf $(pwd) --verbose "$@"
+		"$1" ${HOME} export local /usr/bin sed ${HOME} 'quoted text'
+	-eu awk && awk printf "$@"
+	2>/dev/null readonly export | "$1" done && export then test export
+	2>/dev/null --verbose awk sed ${HOME} | /usr/bin
+		${HOME} ${HOME} x=1 echo | cd export 'quoted text' /usr/bin x=1
+		readonly grep test grep /usr/bin
+	x=1 "$@" "$@" test ${HOME}
+		sed /usr/bin /usr/bin -eu
+	cd 2>/dev/null x=1 awk test x=1 'quoted text' grep 'quoted text' done done -eu
+	'quoted text' 'quoted text' printf readonly $(pwd) -eu "$1" | && grep done $(pwd)
+		'quoted text' grep && "$1" "$@" local awk then
+		then --verbose test echo && "$1" readonly
+&& test printf "$1" echo printf sed | "$1" -eu "$1" | export | awk then echo ${HOME}
+		then --verbose && readonly -eu
+	grep $(pwd) grep grep grep "$@"
+export echo -eu sed -eu && printf -eu 2>/dev/null test sed 'quoted text'
+		then echo 'quoted text' printf -eu "$@" && x=1 -eu cd
+	"$1" grep readonly readonly
+grep "$1" cd done grep && grep sed -eu -eu
+		'quoted text' export -eu
+	/usr/bin printf 'quoted text' grep /usr/bin x=1 && "$1"
+| --verbose -eu --verbose ${HOME} $(pwd) "$1" && /usr/bin
+export $(pwd) test /usr/bin "$@" $(pwd) 'quoted text'
+		cd "$1" /usr/bin export export |
+sed echo test /usr/bin local -eu printf then awk
+	readonly echo | test test echo cd grep "$@"
+		done 2>/dev/null | x=1 done
+		echo awk -eu "$1" export
+		$(pwd) echo /usr/bin grep sed readonly sed ${HOME} --verbose printf "$@"
+		&& export readonly export local then | echo printf
+	x=1 export --verbose | /usr/bin --verbose | --verbose "$@" local -eu done echo
+${HOME} /usr/bin "$@" $(pwd) ${HOME} export test sed awk $(pwd) echo
+		&& && "$1" printf 2>/dev/null "$1"
+		$(pwd) ${HOME} -eu "$1" x=1 | export x=1 printf printf grep grep printf
+	printf test cd sed --verbose /usr/bin 2>/dev/null
+		&& echo 'quoted text' grep printf 2>/dev/null echo && then $(pwd) && "$@"
+	done awk then readonly local /usr/bin awk readonly /usr/bin
+		done echo sed /usr/bin ${HOME} test 2>/dev/null cd grep
+test "$1" "$1" x=1 then export && done test x=1 printf "$@" grep "$@" test
+	export then "$1" x=1 local printf "$@" awk local sed echo
+'quoted text' x=1 readonly local grep awk "$@" ${HOME}
+	${HOME} && 2>/dev/null test x=1
+		done local "$@" | "$@" grep local local export done ${HOME}
+	export readonly --verbose && test 2>/dev/null readonly export && 'quoted text'
+	--verbose export 'quoted text' 2>/dev/null readonly 'quoted text'
+		| grep -eu local $(pwd) -eu
+"$1" local grep done awk && --verbose grep 2>/dev/null 2>/dev/null
+		| ${HOME} export export test "$@" 2>/dev/null
+	/usr/bin ${HOME} local cd "$@" ${HOME} readonly cd local | readonly grep /usr/bin
+		&& then sed 2>/dev/null -eu echo ${HOME} x=1 export ${HOME} && echo
+		| $(pwd) printf "$1" sed export done "$@" | local | ${HOME} awk export
+grep /usr/bin readonly sed | readonly /usr/bin
+		then "$1" local | 'quoted text' sed "$@" | awk 2>/dev/null "$1" -eu --verbose
+"$1" "$@" /usr/bin awk /usr/bin | sed cd "$@" "$@" "$1"
+		awk done "$@" ${HOME} 'quoted text'
+	&& "$@" 2>/dev/null readonly /usr/bin export 2>/dev/null
+	| x=1 --verbose grep --verbose
+		then done test -eu sed local local | export printf
+	local --verbose "$@" then local "$1" sed --verbose | | 'quoted text' 2>/dev/null
+		x=1 x=1 awk && export sed done 'quoted text'
+${HOME} done --verbose --verbose
+		-eu 'quoted text' -eu && 2>/dev/null && local local then $(pwd)
+	readonly cd printf readonly 'quoted text' "$@" cd then then -eu 2>/dev/null ${HOME}
+		"$@" cd x=1 echo "$@" done "$1" | x=1 $(pwd) grep x=1 local grep "$@"
+		local | 'quoted text' | 'quoted text'
+		export cd sed 'quoted text' 'quoted text' local done cd && done "$@"
+		awk --verbose readonly --verbose && cd grep then 2>/dev/null
+	echo grep awk local echo done ${HOME} && && sed 2>/dev/null $(pwd) "$@" --verbose
+		--verbose ${HOME} readonly grep 2>/dev/null
+readonly ${HOME} readonly /usr/bin "$1" local
+		local grep $(pwd) test grep | $(pwd)
+/usr/bin printf 2>/dev/null && test awk awk
+sed cd done grep 'quoted text' local export 'quoted text' printf $(pwd)
+		test then 'quoted text' cd --verbose
+--verbose /usr/bin awk local ${HOME} printf /usr/bin
+	"$@" then cd && echo export
+		awk export /usr/bin cd -eu done && readonly
+readonly printf cd 2>/dev/null local -eu
+	readonly export --verbose "$1" readonly
+		echo 'quoted text' then ${HOME} $(pwd)
+cd readonly x=1 -eu --verbose
+"$1" "$1" then local "$@" done "$@" -eu sed $(pwd) done printf
+		"$@" ${HOME} sed local --verbose 'quoted text'
+--verbose sed | 2>/dev/null ${HOME} "$1" test then "$@" $(pwd)
+"$@" /usr/bin "$@" readonly done -eu
+		$(pwd) 'quoted text' 2>/dev/null
+		/usr/bin grep local 2>/dev/null grep readonly
+		cd printf /usr/bin && "$@"
+		&& test 2>/dev/null local
+export ${HOME} -eu x=1 --verbose done | -eu 'quoted text' 'quoted text'
+	sed export 'quoted text' sed 2>/dev/null $(pwd) /usr/bin /usr/bin
+sed 'quoted text' readonly printf -eu printf grep echo readonly --verbose
+	done test && && "$1" "$@" x=1 done ${HOME} "$1" $(pwd) awk | then
+	"$1" "$@" 2>/dev/null ${HOME} awk && --verbose 'quoted text' --verbose
+	2>/dev/null export test | awk "$1" ${HOME} local --verbose printf awk echo then
+cd awk --verbose | "$@" test
+		"$1" $(pwd) export echo export echo cd
+	'quoted text' | done $(pwd) | done --verbose export cd && $(pwd)
+"$1" export --verbose | x=1 | local readonly ${HOME}
+	&& | echo readonly "$@" -eu "$@" local awk grep export grep && -eu
+readonly --verbose readonly --verbose echo "$1" x=1 ${HOME} "$@"
+		cd readonly --verbose --verbose && /usr/bin "$1"
+	cd && | printf --verbose printf && readonly grep local done then ${HOME}
+echo grep ${HOME} 'quoted text' | --verbose $(pwd) awk
+export export "$1" x=1 'quoted text'
+		done --verbose x=1 readonly 2>/dev/null echo
+		'quoted text' cd | | $(pwd) "$@" export
+		awk x=1 ${HOME} then | 2>/dev/null printf -eu -eu ${HOME}
+	${HOME} cd readonly "$@" sed readonly
+	awk x=1 "$@" awk $(pwd) local "$@" then && done --verbose readonly
+		test "$1" && | | -eu export grep ${HOME} done grep done
+"$@" 'quoted text' cd cd readonly "$@"
+	$(pwd) awk test | done 2>/dev/null then -eu
+		then test "$1" printf done test then export | | awk -eu
+		readonly | x=1 sed $(pwd) --verbose sed | && | $(pwd) -eu x=1
+	awk 2>/dev/null local readonly sed export test grep "$@" ${HOME} ${HOME}
+	-eu echo printf | x=1 cd awk x=1 printf awk x=1 ${HOME}
+		export readonly then -eu echo awk sed x=1
+		sed then printf -eu grep | echo local export sed
+${HOME} grep 'quoted text' test 2>/dev/null x=1 "$@" export awk
+	local test readonly local ${HOME} readonly local
+	2>/dev/null printf printf "$1" /usr/bin test cd done "$1"
+	sed | grep readonly readonly ${HOME}
+		$(pwd) x=1 grep --verbose && x=1 printf readonly awk done cd | /usr/bin "$1" /usr/bin
+${HOME} echo cd then $(pwd) local echo 2>/dev/null
+local grep x=1 cd -eu export "$1" grep $(pwd) grep && sed printf export "$1" grep
+		$(pwd) ${HOME} | 'quoted text' | test "$1" readonly awk local test ${HOME} ${HOME}
+	test cd --verbose 'quoted text' local
+	/usr/bin echo $(pwd) /usr/bin $(pwd) echo "$@"
+${HOME} test "$1" awk awk cd ${HOME} local /usr/bin 'quoted text'
+cd x=1 awk readonly "$1" --verbose 2>/dev/null 2>/dev/null
+		awk printf /usr/bin -eu test awk -eu
+		-eu ${HOME} x=1 awk cd echo "$@" grep done
+${HOME} 2>/dev/null ${HOME} "$@" grep
+	x=1 printf printf ${HOME}
+	readonly $(pwd) done then -eu local
+		-eu then -eu /usr/bin test done --verbose cd 'quoted text' x=1 | cd export
+/usr/bin ${HOME} awk 2>/dev/null export
+'quoted text' export $(pwd) readonly export 2>/dev/null 2>/dev/null
+		printf sed 'quoted text' cd x=1 grep printf $(pwd) grep then test "$1"
+		'quoted text' 'quoted text' -eu
+--verbose -eu then /usr/bin && "$@" "$@" && test 'quoted text'
+		"$1" 2>/dev/null "$@" export test /usr/bin
+echo grep "$@" printf then "$1" test test
+local | sed local | | sed echo /usr/bin 'quoted text' awk $(pwd)
+		local cd && x=1 && | -eu echo cd --verbose then readonly sed "$@"
+printf "$@" echo "$@" local
+		test grep "$1" export "$1" 2>/dev/null "$1" printf
+		x=1 --verbose printf test ${HOME} awk grep cd sed echo -eu echo sed
+&& 2>/dev/null "$1" "$1" grep printf --verbose $(pwd) done /usr/bin /usr/bin
+		'quoted text' $(pwd) x=1 "$1" cd cd grep && grep readonly | ${HOME} echo sed $(pwd)
+test export done readonly
+	-eu cd | "$1" /usr/bin | export $(pwd) readonly
+		cd test local cd then | echo | grep echo $(pwd) | printf cd $(pwd) 2>/dev/null
+	x=1 --verbose awk "$@" then --verbose local $(pwd) awk echo readonly
+		local sed printf 2>/dev/null "$1" ${HOME} test 'quoted text'
+	2>/dev/null $(pwd) --verbose done export export local grep
+	--verbose local ${HOME} local cd "$1" done | done -eu 2>/dev/null sed
+		'quoted text' ${HOME} ${HOME} then readonly done --verbose "$@"
+		cd "$1" export && $(pwd) grep 2>/dev/null
+-eu then && sed $(pwd) "$@" | echo cd test ${HOME} | /usr/bin
+/usr/bin 'quoted text' ${HOME}
+--verbose "$1" echo then && x=1 grep /usr/bin test then $(pwd) $(pwd)
+${HOME} cd 2>/dev/null awk ${HOME} /usr/bin /usr/bin && ${HOME} sed "$1" 'quoted text'
+		done "$1" cd "$1" "$1" -eu x=1 $(pwd) test $(pwd) --verbose
+'quoted text' sed printf echo --verbose 2>/dev/null test readonly
+	local test 2>/dev/null --verbose ${HOME} export ${HOME}
+	echo done printf --verbose sed x=1 'quoted text'
+		readonly export grep --verbose
+	done readonly export grep
+		awk export "$1" test grep "$@" test x=1 sed && --verbose
+&& | cd export && export sed local ${HOME} && 'quoted text' local | cd grep export
+	local awk 2>/dev/null 2>/dev/null "$@" test then | then -eu
+| readonly printf export local then /usr/bin grep -eu $(pwd) test test
+| printf sed x=1 sed ${HOME} sed grep ${HOME} 'quoted text'
+		sed && awk then then $(pwd) local --verbose cd 'quoted text' x=1
+	printf awk then grep --verbose echo grep test sed local "$@" "$1" cd x=1
+'quoted text' then "$1"
+		$(pwd) test cd then grep grep $(pwd) printf
+	${HOME} $(pwd) -eu "$1" printf
+	--verbose cd cd --verbose "$1" printf && sed grep 2>/dev/null echo x=1
+		"$1" grep sed export -eu --verbose then cd --verbose
+'quoted text' echo && export grep cd --verbose
+		readonly 'quoted text' echo "$1" "$@" printf grep ${HOME}
+local readonly done test printf "$@" ${HOME} "$@" 'quoted text' x=1
+		| then /usr/bin cd export -eu /usr/bin done grep readonly -eu ${HOME}
+/usr/bin x=1 cd echo done printf && $(pwd) 'quoted text' cd grep 'quoted text'
+		grep grep local 'quoted text'
+then printf done -eu | &&
+export -eu "$1" local "$@" --verbose $(pwd)
+		${HOME} x=1 && --verbose ${HOME} -eu "$1" test 'quoted text'
+	"$1" printf 'quoted text' 'quoted text' echo x=1 local export
+	local && awk local /usr/bin local echo -eu done 2>/dev/null x=1 sed 'quoted text'
+grep test "$1" cd awk 2>/dev/null sed
+done --verbose test "$1" -eu awk then 'quoted text' grep -eu "$@"
+2>/dev/null printf done "$@" local $(pwd) echo grep ${HOME} x=1 'quoted text' "$@"
+	-eu test "$1" then printf awk printf ${HOME}
+		readonly grep awk 2>/dev/null grep done --verbose
+		&& readonly test then local awk readonly grep --verbose --verbose
+		${HOME} done x=1 printf x=1 local /usr/bin "$@" /usr/bin
+--verbose ${HOME} 2>/dev/null "$1" export /usr/bin test /usr/bin then /usr/bin
+		done $(pwd) x=1 sed "$1" ${HOME} && cd printf "$1" grep && echo export printf
+		local test --verbose readonly
+${HOME} ${HOME} | local $(pwd) echo 2>/dev/null local test -eu
+-eu local test test $(pwd)
+${HOME} local export done | echo local && 2>/dev/null /usr/bin test echo 'quoted text'
+		${HOME} ${HOME} --verbose | done then
+		done done grep -eu sed x=1 && && awk $(pwd) cd 'quoted text'
+sed done 'quoted text' done sed "$@" printf done 'quoted text' done 'quoted text'
+test /usr/bin "$1" cd readonly printf grep $(pwd) && awk ${HOME} "$1"
+	then 'quoted text' --verbose --verbose local | 'quoted text'
+	done 'quoted text' "$@" /usr/bin cd $(pwd) grep && /usr/bin
+${HOME} /usr/bin x=1 -eu echo export ${HOME}
+	2>/dev/null -eu export --verbose local done ${HOME} awk printf --verbose
+test x=1 local "$@" 'quoted text'
+	--verbose $(pwd) && cd x=1 then "$@" echo grep sed printf
+"$1" x=1 awk -eu then awk sed x=1 local printf --verbose 2>/dev/null
+	sed done -eu sed sed --verbose ${HOME} awk awk ${HOME} 2>/dev/null $(pwd) grep
+		2>/dev/null export test awk ${HOME} x=1 --verbose -eu 2>/dev/null done
+		x=1 awk export "$1" 2>/dev/null awk readonly 2>/dev/null x=1 sed "$@" echo
+	| sed awk then 2>/dev/null | x=1 "$1" grep test
+		x=1 done awk x=1 "$@" test $(pwd) done | export "$1" awk readonly readonly
+	'quoted text' grep "$@" sed | readonly awk
+export /usr/bin test readonly
+	sed then cd awk "$1" $(pwd) /usr/bin |
+| -eu "$@" echo grep 'quoted text'
+		test then "$@" export awk awk -eu grep
+		grep -eu | export local cd ${HOME} 2>/dev/null export
+	"$@" --verbose ${HOME} awk
+local readonly "$@" x=1 grep "$1" readonly -eu
+		x=1 sed echo printf printf | 'quoted text' then /usr/bin sed && x=1 echo
+x=1 x=1 'quoted text' echo | && "$1" export grep
+sed cd -eu -eu echo --verbose cd 'quoted text' echo && then "$1"
+	'quoted text' /usr/bin $(pwd) && $(pwd) "$1" "$@"
+		| ${HOME} test grep echo /usr/bin $(pwd)
+		cd 2>/dev/null "$@" 2>/dev/null readonly awk "$1" && cd readonly awk 'quoted text'
+		then 2>/dev/null 'quoted text' export
+		&& grep 2>/dev/null cd awk readonly export x=1 printf local "$1" done
+--verbose test --verbose 'quoted text' then ${HOME} sed "$@"
+${HOME} ${HOME} local echo cd then readonly | printf
+	${HOME} awk 2>/dev/null awk sed x=1 echo
+		awk sed -eu /usr/bin x=1 $(pwd) ${HOME} grep done --verbose 2>/dev/null
+	/usr/bin printf export cd "$1" awk readonly "$@" 'quoted text'
+		"$@" ${HOME} awk local awk ${HOME} ${HOME} 2>/dev/null && x=1 --verbose local /usr/bin
+--verbose cd | && sed done 'quoted text'
+		cd readonly 'quoted text' ${HOME} /usr/bin $(pwd)
+		--verbose -eu $(pwd) "$1" local export $(pwd) awk 'quoted text' grep
+echo --verbose sed sed then /usr/bin 'quoted text' /usr/bin grep done export
+/usr/bin echo awk awk x=1 "$1" && $(pwd)
+	"$1" -eu echo readonly echo "$@" | export awk $(pwd)
+	printf -eu --verbose done test -eu ${HOME} printf export ${HOME}
+	cd printf ${HOME} done local
+	&& $(pwd) && echo cd $(pwd) /usr/bin /usr/bin
+	${HOME} then | $(pwd)
+"$@" | echo printf cd "$1" echo /usr/bin /usr/bin 2>/dev/null
+local 2>/dev/null x=1 $(pwd) then readonly awk echo test cd echo local
+	/usr/bin sed && "$1" echo grep test export export test 2>/dev/null
+then awk ${HOME} local x=1 done sed && -eu
+local local then then 2>/dev/null test export /usr/bin
+		test x=1 grep | test -eu export && "$@" sed cd awk --verbose | | "$@"
+grep -eu ${HOME} cd then awk 'quoted text' then
+		$(pwd) local sed && -eu awk grep awk -eu 2>/dev/null local sed
+export sed cd test "$1" "$1" "$1" printf printf "$1" "$@" printf
+		local "$1" then --verbose readonly
+		x=1 then --verbose x=1 ${HOME} -eu --verbose export "$1" ${HOME} $(pwd)
+echo && -eu then 2>/dev/null sed done export local && -eu sed sed $(pwd)
+		/usr/bin 2>/dev/null | "$@" $(pwd) grep "$@" | --verbose
+done $(pwd) grep ${HOME} grep | "$1" local -eu | "$1" --verbose
+		-eu readonly export /usr/bin && echo awk && /usr/bin readonly printf "$1" "$1" "$1"
+done done test sed sed $(pwd)
+		2>/dev/null 'quoted text' -eu export then awk readonly "$1"
+		/usr/bin readonly "$1" x=1 done printf local grep
+		&& --verbose 'quoted text'
+	then sed export cd export printf local
+		awk then printf /usr/bin "$1" && then grep test done | local printf sed
+		/usr/bin sed 2>/dev/null printf && --verbose "$@" local
+printf then $(pwd) ${HOME} sed
+		&& "$1" done | done --verbose test
+	--verbose && | "$@" grep then cd export sed | /usr/bin
+		then x=1 done | awk x=1 --verbose cd | grep
+"$1" grep cd 'quoted text' x=1 x=1 printf test /usr/bin 2>/dev/null sed | awk
+	test cd sed cd "$1" --verbose
+	awk printf printf 2>/dev/null 'quoted text' then 2>/dev/null /usr/bin done
+	printf test awk x=1 test echo ${HOME} sed sed x=1
+	2>/dev/null sed 'quoted text'
+/usr/bin export export 'quoted text' 'quoted text' /usr/bin awk sed printf
+		done x=1 --verbose -eu then /usr/bin done grep local -eu -eu awk
+	cd readonly "$1" echo export echo | 'quoted text' readonly x=1 echo "$1"
+test "$1" done done awk readonly
+		then local $(pwd) done
+		grep $(pwd) | ${HOME} --verbose 2>/dev/null local sed /usr/bin
+${HOME} x=1 --verbose 2>/dev/null 'quoted text' then sed grep "$1"
+'quoted text' readonly --verbose /usr/bin printf grep && test "$1"
+$(pwd) x=1 -eu echo export local local ${HOME} 2>/dev/null cd awk $(pwd) test
+	"$1" cd -eu x=1 "$1" && done cd printf echo
+	-eu x=1 2>/dev/null && $(pwd) "$@" awk ${HOME} local cd /usr/bin "$@" test
+		| x=1 | test --verbose -eu | ${HOME} awk readonly awk && grep test readonly 2>/dev/null
+	"$1" x=1 -eu $(pwd) printf ${HOME} x=1 cd "$1" "$@"
+	then test "$@" sed done cd $(pwd) then
+		readonly 'quoted text' local 2>/dev/null x=1
+	then readonly && grep local
+		--verbose grep && then local 'quoted text' && --verbose awk then
+		2>/dev/null then && 2>/dev/null x=1 then x=1 --verbose | &&
+	2>/dev/null "$@" $(pwd) local | printf x=1
+	| grep echo "$@" awk "$@" && then awk $(pwd) ${HOME} ${HOME} ${HOME} local x=1
+| ${HOME} local local ${HOME} cd /usr/bin /usr/bin
+	"$@" && /usr/bin "$@" echo $(pwd) 2>/dev/null ${HOME} ${HOME}
+		--verbose x=1 grep /usr/bin local grep /usr/bin x=1 -eu -eu awk --verbose
+awk $(pwd) -eu 'quoted text' "$1" test
+	readonly "$@" cd "$1" 2>/dev/null printf x=1
+		/usr/bin 2>/dev/null test -eu test
+		"$@" | cd awk x=1 sed done ${HOME} printf --verbose
+-eu 'quoted text' 2>/dev/null /usr/bin "$1" "$1" | 2>/dev/null x=1
+		2>/dev/null ${HOME} "$@" awk /usr/bin
+	&& done /usr/bin export "$@"
+	--verbose x=1 --verbose done --verbose done local cd "$1" --verbose
+&& --verbose x=1 test printf
+		&& $(pwd) done x=1 then /usr/bin 2>/dev/null /usr/bin done readonly readonly
+		awk readonly readonly x=1 "$1" /usr/bin && --verbose export awk export && local
+	--verbose done done local x=1
+	"$1" "$1" | -eu -eu /usr/bin 'quoted text'
+		x=1 --verbose 'quoted text' x=1
+		/usr/bin --verbose 2>/dev/null 'quoted text' cd
+		2>/dev/null readonly done 2>/dev/null 'quoted text'
+		test $(pwd) printf 'quoted text' grep
+		"$1" ${HOME} grep export
+-eu cd 'quoted text' cd x=1 /usr/bin
+	--verbose --verbose | 2>/dev/null --verbose | cd | "$1" echo --verbose /usr/bin
+2>/dev/null /usr/bin | /usr/bin x=1 test x=1 'quoted text'
+	-eu local local sed cd
+	$(pwd) | local export "$@" grep $(pwd) 2>/dev/null x=1 $(pwd)
+&& printf ${HOME} done
+x=1 printf 'quoted text' /usr/bin
+grep "$@" 'quoted text' echo
+sed done test cd test "$@"
+awk 'quoted text' then "$1" done
+	"$@" readonly $(pwd) awk local test sed 2>/dev/null
+		| grep echo export "$@" x=1 sed "$1" export done "$@" local --verbose
+	export "$1" echo sed cd "$@" local $(pwd) cd cd readonly $(pwd) x=1 export
+	printf | && "$1" printf ${HOME} readonly awk cd
+	/usr/bin $(pwd) "$@" --verbose awk local --verbose x=1 export x=1 -eu printf
+	test | grep x=1 "$@" local echo x=1 | readonly ${HOME} /usr/bin awk
+	grep --verbose sed -eu /usr/bin awk 'quoted text'
+		local ${HOME} 2>/dev/null $(pwd) sed awk x=1 cd x=1 printf
+	"$1" "$@" grep 'quoted text' ${HOME} | grep -eu
+"$@" -eu $(pwd) printf grep then x=1 | cd then sed $(pwd) -eu 2>/dev/null
+cd then done done 2>/dev/null grep echo -eu
+		"$1" && readonly ${HOME} then
+local "$1" "$@" sed x=1 cd sed /usr/bin local /usr/bin
+		"$@" grep readonly 'quoted text' readonly export /usr/bin
+	/usr/bin export "$@" export -eu "$1" 'quoted text' ${HOME} | -eu
+2>/dev/null /usr/bin cd export
+		--verbose readonly && "$@" done && readonly local $(pwd) "$1" grep grep
+		/usr/bin /usr/bin local readonly cd -eu 2>/dev/null -eu printf $(pwd)
+done 'quoted text' /usr/bin done test done $(pwd) "$@" "$@" "$@" 2>/dev/null
+		"$1" $(pwd) "$1" "$1" cd done --verbose readonly "$1" done sed sed
+		/usr/bin "$1" 2>/dev/null "$1" cd grep "$@" then readonly x=1
+	"$1" | 'quoted text' --verbose test "$1"
+		x=1 test $(pwd) && then | 'quoted text' 2>/dev/null 2>/dev/null --verbose
+		echo done export echo export "$@" echo cd && done --verbose test
+cd echo 'quoted text' /usr/bin | -eu done awk 'quoted text'
+"$@" x=1 x=1 x=1 /usr/bin $(pwd) "$1" awk readonly readonly cd awk then local
+/usr/bin readonly local then cd done x=1 /usr/bin awk --verbose
+		'quoted text' done --verbose ${HOME} then grep "$@" --verbose cd awk -eu && readonly
+		then then local ${HOME} echo 'quoted text' cd readonly -eu 'quoted text'
+sed echo awk export "$1" -eu
+"$1" test then ${HOME} x=1 printf awk readonly cd done
+		cd 2>/dev/null printf x=1 'quoted text' && export | 2>/dev/null export
+		${HOME} "$1" --verbose -eu grep $(pwd)
+		local "$@" --verbose -eu test awk done --verbose
+	2>/dev/null 2>/dev/null && sed then "$1" sed grep done
+		$(pwd) export readonly grep | 2>/dev/null grep printf $(pwd) grep
+		local $(pwd) local $(pwd) -eu --verbose test -eu ${HOME} ${HOME} --verbose
+		done 'quoted text' | sed done local readonly done 'quoted text'
+	export 'quoted text' 2>/dev/null sed sed awk export --verbose printf printf
+	readonly && /usr/bin grep ${HOME} printf
+		export 'quoted text' readonly
+		"$1" test echo test /usr/bin readonly sed $(pwd) grep then echo 2>/dev/null x=1
+		${HOME} /usr/bin x=1 sed test 'quoted text' cd | && printf
+echo echo echo printf /usr/bin
+echo export cd echo 'quoted text' printf 'quoted text' "$1" | "$1" printf
+		cd "$@" sed $(pwd) --verbose $(pwd) readonly cd 2>/dev/null grep grep export
+	export done local $(pwd) export "$1"
+	test -eu x=1 -eu grep 2>/dev/null done
+	2>/dev/null | awk sed echo /usr/bin awk readonly printf 'quoted text'
+		x=1 sed cd test local $(pwd) ${HOME} export printf readonly then 'quoted text'
+		test 2>/dev/null 'quoted text' -eu sed x=1 --verbose printf
+		-eu awk -eu sed && readonly local readonly --verbose
+		/usr/bin 2>/dev/null /usr/bin && test readonly x=1 grep cd grep readonly -eu
+	local "$1" "$1" awk && grep 'quoted text' ${HOME} ${HOME} && done |
+		-eu grep x=1 "$@" then x=1 grep grep test test readonly test cd cd "$@"
+	done 2>/dev/null test 'quoted text'
+		cd --verbose "$@" $(pwd) then && cd --verbose -eu 2>/dev/null done && printf &&
+${HOME} awk test 2>/dev/null readonly x=1 2>/dev/null 'quoted text' /usr/bin 'quoted text'
+awk 'quoted text' done echo grep -eu cd echo
+		--verbose local cd "$1" 'quoted text' done sed ${HOME} printf
+export readonly $(pwd) x=1 "$1" $(pwd) done export
+sed awk local 2>/dev/null
+	-eu local "$1" | 2>/dev/null
+"$@" awk && echo 2>/dev/null cd grep 'quoted text' then readonly --verbose test
+		local && then readonly "$@" sed echo "$@" && readonly 'quoted text'
+	--verbose $(pwd) awk then && "$@" 2>/dev/null export then printf printf
+awk /usr/bin "$@" 2>/dev/null sed grep 'quoted text' "$@" && test "$@"
+--verbose readonly done 'quoted text'
+	"$1" grep sed cd 'quoted text' $(pwd) 'quoted text' then local awk printf
+--verbose -eu test 2>/dev/null "$@" "$@" "$1" readonly test && cd readonly export
+	"$1" "$@" awk sed && export export -eu export /usr/bin readonly
+	--verbose 'quoted text' $(pwd) cd $(pwd) "$1" done $(pwd) "$1" 2>/dev/null
+&& ${HOME} grep 'quoted text' export printf
+	'quoted text' then -eu 2>/dev/null $(pwd) readonly printf
+	printf echo sed "$@" printf grep /usr/bin export printf 'quoted text' local
+	done done /usr/bin | then done 'quoted text' "$@" -eu -eu then
+done "$@" done ${HOME} readonly done | readonly x=1 printf test cd
+		local ${HOME} export grep "$@" | 'quoted text' x=1 "$@" ${HOME} 2>/dev/null cd
+2>/dev/null then | "$@" 2>/dev/null awk awk
+awk ${HOME} cd /usr/bin "$@" x=1 local then 'quoted text'
+	sed grep readonly awk readonly /usr/bin then
+		/usr/bin cd /usr/bin $(pwd) printf | /usr/bin
+awk printf local sed local "$@" "$@" "$1" test --verbose
+		${HOME} /usr/bin -eu /usr/bin
+	'quoted text' test cd then
+	done then 2>/dev/null local
+readonly readonly 2>/dev/null 'quoted text' -eu -eu awk sed echo readonly
+	"$@" $(pwd) sed && then awk x=1 done cd --verbose ${HOME}
+		echo readonly --verbose "$@"
+2>/dev/null "$1" /usr/bin && sed | "$@"
+		awk --verbose 2>/dev/null then done /usr/bin sed echo local x=1 done $(pwd)
+local /usr/bin then cd grep $(pwd) | done then ${HOME} done -eu x=1 && cd awk
+echo $(pwd) "$@" local
+		$(pwd) grep readonly /usr/bin /usr/bin then | test --verbose export done readonly
+		-eu done --verbose test && ${HOME} "$@" x=1 --verbose
+	test then /usr/bin $(pwd) "$@" x=1 readonly 2>/dev/null
+		cd -eu x=1 printf /usr/bin readonly /usr/bin
+cd echo "$@" sed export export 'quoted text' sed printf
+	done cd local -eu cd awk $(pwd) --verbose && x=1
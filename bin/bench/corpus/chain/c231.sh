@@ -0,0 +1,2001 @@
+$(pwd) 'quoted text' then && -eu | "$@" x=1 ${HOME}
+$(pwd) echo $(pwd) cd test done | awk done 2>/dev/null
+'quoted text' cd --verbose cd "$@" | -eu then echo grep "$@"
+	$(pwd) test "$@" /usr/bin "$@" then "$@" &&
+	| | ${HOME} ${HOME} cd ${HOME} awk local export
+		then /usr/bin && done readonly local then "$1" --verbose --verbose
+awk then /usr/bin sed x=1 printf echo --verbose local $(pwd) 'quoted text'
+	-eu cd x=1 export && "$1" -eu 'quoted text' echo sed 'quoted text'
+cd export -eu done /usr/bin |
+	echo echo x=1 done && export --verbose awk | "$@"
+		"$@" x=1 printf $(pwd) "$1" x=1 test sed done
+$(pwd) sed done awk --verbose -eu && "$1" test $(pwd)
+	| | x=1 && local sed done | | && && local
+	done --verbose grep readonly ${HOME} done
+		local "$1" /usr/bin cd --verbose | x=1 grep && readonly grep
+		/usr/bin $(pwd) "$1" done done test done 'quoted text' x=1
+--verbose readonly /usr/bin export done /usr/bin printf
+${HOME} export -eu export test && readonly && done
+	test /usr/bin sed readonly then sed | awk awk test export ${HOME}
+		| ${HOME} echo 2>/dev/null done readonly printf awk 2>/dev/null "$1"
+	${HOME} 2>/dev/null "$1" test export --verbose 'quoted text'
+	then readonly 2>/dev/null test sed -eu sed sed
+	-eu /usr/bin cd ${HOME} -eu x=1 "$@" "$@" x=1 'quoted text'
+	x=1 && -eu 'quoted text' /usr/bin && cd sed 2>/dev/null then cd ${HOME} 'quoted text'
+| "$@" --verbose 2>/dev/null sed readonly ${HOME} "$1" x=1 ${HOME} then
+-eu "$@" local then ${HOME}
+		grep grep local done awk $(pwd) ${HOME} awk local readonly test 'quoted text'
+		x=1 export $(pwd) 'quoted text'
+--verbose then -eu "$1" && x=1
+	-eu export grep x=1 test "$1" done "$1" echo test x=1 "$@"
+export test --verbose done && 'quoted text'
+	export 'quoted text' done "$@" | echo grep printf -eu cd x=1 echo "$1" echo
+		export "$1" export grep /usr/bin | "$@" awk | awk echo
+	"$@" | local test 2>/dev/null sed done test $(pwd) -eu 'quoted text' local ${HOME}
+"$@" | sed x=1 --verbose | readonly -eu "$@" 2>/dev/null
+		${HOME} 2>/dev/null done 2>/dev/null ${HOME}
+	"$1" cd export echo echo test 'quoted text'
+		-eu grep /usr/bin $(pwd) ${HOME} | printf "$@" --verbose
+	'quoted text' 'quoted text' --verbose x=1 "$1" done "$1" cd $(pwd) --verbose $(pwd)
+		-eu done 'quoted text' cd test awk /usr/bin done export export
+test grep "$@" local local 'quoted text'
+	cd printf | echo "$1" echo x=1 local grep awk $(pwd) cd
+		export "$@" sed x=1 2>/dev/null
+--verbose "$@" | export 2>/dev/null
+	${HOME} ${HOME} $(pwd) readonly done echo -eu "$@" /usr/bin
+test cd "$1" cd 2>/dev/null /usr/bin -eu | printf "$@" x=1 local 'quoted text'
+	local "$@" readonly --verbose x=1 awk sed $(pwd) 'quoted text'
+${HOME} "$@" printf 'quoted text' x=1 printf
+	awk then awk | printf ${HOME} ${HOME}
+		| echo x=1 readonly test test $(pwd) "$@" ${HOME} grep /usr/bin
+		local --verbose grep ${HOME} grep /usr/bin ${HOME} then grep
+"$1" 2>/dev/null -eu export
+		2>/dev/null grep /usr/bin printf awk -eu readonly readonly ${HOME} printf
+printf then "$@" --verbose awk $(pwd) cd $(pwd) 2>/dev/null 2>/dev/null
+	'quoted text' grep -eu cd then -eu grep -eu then printf export grep grep && -eu
+	readonly printf /usr/bin | export $(pwd) x=1 awk awk awk
+2>/dev/null done readonly
+	export export sed sed 'quoted text' export --verbose done sed printf $(pwd) printf
+		awk x=1 /usr/bin 2>/dev/null export test 2>/dev/null echo --verbose 2>/dev/null
+		test /usr/bin local --verbose $(pwd)
+	| "$1" awk x=1 | awk grep /usr/bin --verbose export "$1" -eu local x=1 then
+	/usr/bin done 'quoted text' 'quoted text'
+	x=1 'quoted text' test && grep && -eu test --verbose test -eu
+		-eu local readonly echo | then /usr/bin 2>/dev/null
+		/usr/bin $(pwd) 'quoted text' ${HOME} /usr/bin
+		"$@" readonly done -eu awk awk 'quoted text' cd
+-eu ${HOME} $(pwd) -eu awk sed awk grep readonly x=1 "$@" "$1"
+		export grep "$1" then 'quoted text'
+test local --verbose grep readonly sed x=1 | local export printf done 2>/dev/null
+		awk local then readonly grep
+		export ${HOME} "$@" ${HOME} cd cd "$@"
+"$@" cd awk done then awk then
+	export local sed then sed --verbose export 2>/dev/null ${HOME} local -eu $(pwd)
+	printf "$1" awk "$1" | test && readonly 2>/dev/null echo $(pwd) grep -eu x=1 --verbose
+		2>/dev/null /usr/bin 'quoted text' test local
+	export 'quoted text' echo sed --verbose
+		'quoted text' $(pwd) "$1" echo then local
+	awk 'quoted text' 'quoted text' readonly done -eu /usr/bin
+		export export printf echo "$1" cd -eu cd --verbose --verbose
+		test -eu test "$@" cd &&
+	readonly && | echo &&
+echo ${HOME} 'quoted text' x=1 readonly && -eu grep x=1 local
+local && readonly "$@" printf --verbose ${HOME} done $(pwd) /usr/bin
+2>/dev/null done printf awk ${HOME} sed | && grep awk sed sed "$1" cd
+/usr/bin done sed $(pwd) done | echo echo cd /usr/bin | ${HOME} /usr/bin && awk
+		"$@" $(pwd) -eu ${HOME} awk local export 'quoted text' 'quoted text'
+		/usr/bin cd --verbose "$@" echo -eu cd "$@" export ${HOME}
+		local --verbose $(pwd) "$1" /usr/bin then /usr/bin
+then x=1 x=1 cd echo && /usr/bin test cd $(pwd)
+		local -eu 'quoted text' && test local cd readonly test
+	printf echo local awk sed awk ${HOME} then -eu cd 'quoted text'
+	then ${HOME} | export done export printf "$@" printf
+		"$1" "$1" $(pwd) && 2>/dev/null echo readonly readonly done then
+x=1 local ${HOME} && export --verbose cd -eu && printf awk "$@" && awk readonly
+	test ${HOME} && export sed cd --verbose /usr/bin
+		${HOME} 'quoted text' ${HOME} test done done printf
+"$@" x=1 readonly export grep cd --verbose cd printf export 2>/dev/null
+		echo grep --verbose x=1 ${HOME} --verbose done "$1" "$1" && grep cd 2>/dev/null
+	"$1" && sed awk cd cd "$@" sed
+	cd "$@" echo x=1 "$@" local cd cd |
+&& awk x=1 test test then done done sed && grep
+sed grep && x=1 x=1 2>/dev/null x=1 x=1 export
+then "$@" local --verbose 'quoted text' "$@" cd -eu then -eu | && "$@"
+test 2>/dev/null $(pwd)
+	readonly local local /usr/bin printf && 2>/dev/null --verbose /usr/bin done
+${HOME} x=1 2>/dev/null echo then -eu 'quoted text'
+		'quoted text' $(pwd) /usr/bin ${HOME} awk grep grep $(pwd)
+		"$@" $(pwd) done sed | -eu printf -eu --verbose
+${HOME} echo -eu ${HOME} done local /usr/bin --verbose export
+		| && "$@" then test && awk cd printf readonly local then cd test
+		awk "$@" then done done export "$@" | printf export 2>/dev/null
+done readonly "$@" printf sed readonly
+	--verbose x=1 'quoted text' test
+$(pwd) && 2>/dev/null "$1" grep readonly sed cd export --verbose && sed readonly
+		grep --verbose cd grep
+	/usr/bin 2>/dev/null /usr/bin cd then |
+		"$@" x=1 --verbose echo 2>/dev/null "$1" cd x=1 readonly
+		-eu test printf ${HOME} then -eu 'quoted text' cd --verbose
+-eu cd -eu readonly x=1 export readonly && awk x=1 /usr/bin ${HOME} "$@" 'quoted text'
+		"$@" 'quoted text' ${HOME}
+	test local --verbose
+	grep $(pwd) --verbose | awk $(pwd) ${HOME} -eu -eu /usr/bin
+		printf | then export 2>/dev/null
+		cd awk 2>/dev/null --verbose awk 'quoted text' awk readonly
+	-eu awk export printf --verbose 2>/dev/null
+		readonly readonly ${HOME} then 'quoted text'
+	&& "$@" grep /usr/bin "$1" "$@" |
+	$(pwd) x=1 done "$1" local &&
+	test && -eu $(pwd) local export ${HOME} --verbose sed && /usr/bin
+2>/dev/null "$@" echo --verbose /usr/bin then awk
+export -eu awk && echo cd --verbose done "$@" $(pwd)
+		x=1 $(pwd) /usr/bin sed -eu
+		${HOME} "$@" sed ${HOME}
+	$(pwd) $(pwd) export 'quoted text' echo awk then 2>/dev/null
+done "$1" "$@" export "$1" | 2>/dev/null local
+		-eu sed && grep local -eu && printf 2>/dev/null
+		sed "$1" cd ${HOME} local then
+	then grep 'quoted text' | printf export done grep
+--verbose | done then 2>/dev/null "$1" export "$@" test -eu done then $(pwd) "$@"
+		readonly /usr/bin x=1 test test export
+done export sed 'quoted text'
+	"$1" && "$@" sed -eu test -eu cd /usr/bin test sed 2>/dev/null x=1
+		readonly awk 'quoted text' test cd readonly $(pwd) ${HOME} grep
+		printf ${HOME} 'quoted text' | then readonly readonly $(pwd) echo $(pwd) 2>/dev/null
+"$@" | echo && "$@" grep grep && local local local
+	${HOME} x=1 then "$@" 'quoted text' export printf grep export
+	2>/dev/null 2>/dev/null "$1" $(pwd) sed
+cd ${HOME} grep grep grep x=1 --verbose grep ${HOME} readonly
+	$(pwd) grep && /usr/bin done $(pwd) grep ${HOME} 'quoted text'
+		then | && $(pwd) then
+cd | $(pwd) cd -eu "$@" awk printf
+then printf cd | printf ${HOME} 2>/dev/null readonly
+x=1 -eu sed ${HOME} echo done --verbose then
+	grep test grep "$@" export
+		export printf -eu awk done ${HOME} cd echo done
+		| -eu echo cd 2>/dev/null export done readonly ${HOME} $(pwd) grep
+awk | grep $(pwd) --verbose 'quoted text' $(pwd) "$@" cd "$@"
+	"$1" export -eu x=1 echo then -eu
+	"$1" 'quoted text' printf done --verbose | cd readonly ${HOME}
+test done "$1" test test awk
+	$(pwd) grep -eu cd --verbose ${HOME} "$@" 2>/dev/null ${HOME} --verbose |
+/usr/bin --verbose "$1"
+	cd "$@" -eu 'quoted text' echo --verbose "$@" echo x=1 local -eu local awk "$1"
+sed readonly -eu readonly "$1" "$@" ${HOME} printf then export x=1
+		export x=1 "$1" printf test x=1 'quoted text'
+		printf 'quoted text' 'quoted text' "$@"
+		cd echo export 2>/dev/null readonly test awk
+		&& cd x=1 local printf x=1 test /usr/bin
+'quoted text' --verbose cd "$@" grep then | && ${HOME} 2>/dev/null
+		| /usr/bin awk "$@" done --verbose test test | 2>/dev/null
+		x=1 printf local test ${HOME} sed 2>/dev/null
+		&& then -eu x=1 -eu 2>/dev/null 'quoted text' then /usr/bin 2>/dev/null grep
+	${HOME} $(pwd) | /usr/bin x=1 "$1" | done ${HOME} cd | -eu done "$@" /usr/bin
+"$@" done then -eu && $(pwd) local awk | cd $(pwd) --verbose
+		then readonly printf 'quoted text' then readonly grep then test
+${HOME} sed done cd local --verbose
+$(pwd) echo ${HOME} ${HOME} test
+		sed grep $(pwd) then | $(pwd) awk "$1" done readonly sed x=1 then $(pwd) 2>/dev/null
+done 'quoted text' test
+	local "$@" then awk -eu && cd sed && ${HOME} local --verbose then --verbose
+2>/dev/null -eu grep 'quoted text' done | ${HOME} --verbose ${HOME} local
+	sed -eu $(pwd) export "$@" readonly 'quoted text' then test echo
+	"$1" printf local "$@" readonly
+	readonly grep $(pwd) then --verbose "$1" export 'quoted text'
+	2>/dev/null printf ${HOME} -eu && readonly
+"$@" 2>/dev/null --verbose | sed --verbose
+printf echo -eu ${HOME} cd sed "$1" $(pwd)
+		2>/dev/null test grep echo then | done ${HOME} | local done -eu 'quoted text'
+	printf | 'quoted text' && readonly export "$@" x=1
+	awk echo echo grep x=1 ${HOME} awk then ${HOME} export
+		printf ${HOME} echo readonly echo
+"$1" printf readonly
+export local ${HOME} grep -eu $(pwd) local /usr/bin test awk
+	$(pwd) 'quoted text' "$@" echo /usr/bin /usr/bin
+	--verbose cd ${HOME} echo test /usr/bin echo -eu local "$1" local
+	printf x=1 'quoted text'
+		'quoted text' readonly | --verbose | 2>/dev/null local
+	$(pwd) echo && x=1 printf cd && test echo printf printf readonly
+	cd awk --verbose echo /usr/bin awk readonly /usr/bin
+		--verbose test readonly export test "$1" cd 2>/dev/null export readonly
+	&& export cd "$1" printf test local --verbose
+	2>/dev/null printf x=1 2>/dev/null && cd awk -eu done test | x=1 && cd
+	"$1" $(pwd) then /usr/bin cd readonly
+'quoted text' done echo done printf
+	done echo local 2>/dev/null -eu grep local x=1 && --verbose
+done --verbose cd readonly --verbose awk -eu /usr/bin
+	${HOME} echo local local
+	$(pwd) export -eu test sed x=1 "$1" export
+"$1" printf "$@" && echo
+		local test awk ${HOME}
+		test cd grep 2>/dev/null sed "$@" done
+		printf export grep awk then then grep "$@" "$@" printf printf done test readonly
+"$@" | export 2>/dev/null --verbose 'quoted text'
+	awk export ${HOME} readonly then x=1 local echo grep cd grep
+local local sed 'quoted text' then 2>/dev/null awk export "$@"
+	printf $(pwd) $(pwd) grep "$@" local 'quoted text' "$1" ${HOME} sed $(pwd) then
+	then 2>/dev/null "$1" 2>/dev/null cd printf cd --verbose $(pwd) cd
+then x=1 readonly printf then cd printf ${HOME} echo /usr/bin
+	x=1 | sed then -eu | cd $(pwd) test -eu x=1 echo | then -eu export x=1 x=1
+cd export -eu readonly grep "$1" awk printf
+	${HOME} ${HOME} && cd sed sed
+test echo "$@" ${HOME} ${HOME} readonly "$1" grep --verbose printf
+	${HOME} sed grep 2>/dev/null | grep ${HOME} export test --verbose printf
+		awk done 'quoted text' printf grep local 2>/dev/null then | 2>/dev/null grep
+		$(pwd) readonly sed printf | readonly -eu local readonly
+	awk echo 'quoted text' /usr/bin x=1 /usr/bin 'quoted text' 'quoted text'
+		${HOME} export && test readonly awk sed x=1 awk
+		"$@" --verbose printf local
+	"$1" "$1" readonly ${HOME}
+		then | 'quoted text' 2>/dev/null 'quoted text'
+2>/dev/null test done echo "$@"
+		/usr/bin done 'quoted text' local && --verbose readonly export awk echo then --verbose
+		cd ${HOME} echo export | printf export $(pwd)
+	cd "$1" then printf test
+		done $(pwd) awk done && readonly
+		export 'quoted text' sed readonly $(pwd) then echo then 2>/dev/null
+		${HOME} readonly echo then
+	readonly cd x=1 echo done ${HOME} echo then printf 'quoted text' done | export
+--verbose awk /usr/bin echo
+grep cd done --verbose 2>/dev/null
+printf cd 2>/dev/null then awk echo
+		echo grep ${HOME} awk /usr/bin cd ${HOME} 'quoted text' "$@" grep ${HOME} cd
+printf 'quoted text' local --verbose --verbose test
+		awk local 'quoted text' then done then printf
+	&& test done ${HOME} ${HOME} cd x=1 "$@" echo /usr/bin /usr/bin awk
+		&& /usr/bin 'quoted text' 'quoted text' && grep printf /usr/bin
+${HOME} /usr/bin /usr/bin && ${HOME}
+		echo 2>/dev/null printf printf
+awk then local && readonly
+	done export ${HOME} 2>/dev/null echo x=1 x=1 "$1" grep "$1" readonly awk export
+	${HOME} done 'quoted text' sed sed ${HOME} "$@" x=1
+		x=1 awk --verbose local "$@" "$@" printf "$@" test && then printf local then
+${HOME} printf && $(pwd) local | then cd $(pwd) export --verbose
+	echo ${HOME} x=1 x=1 | cd grep && awk printf awk done cd done
+		sed x=1 | printf /usr/bin test test --verbose 2>/dev/null
+	--verbose "$@" export awk awk "$1"
+		| printf 2>/dev/null -eu | | grep done | printf
+		grep grep test x=1 local && --verbose local local ${HOME} x=1
+		printf ${HOME} ${HOME} cd 'quoted text' local printf /usr/bin
+		readonly sed ${HOME} 2>/dev/null /usr/bin export echo
+	test x=1 x=1 && done && /usr/bin -eu awk
+		| | "$1" $(pwd) /usr/bin x=1 2>/dev/null
+	sed printf then awk cd ${HOME} /usr/bin
+		cd cd $(pwd) x=1 sed --verbose echo
+	test 2>/dev/null cd sed sed x=1 readonly --verbose "$@" sed echo then
+	"$@" readonly 2>/dev/null && echo export
+x=1 printf && -eu test echo done test && echo sed readonly --verbose x=1 cd 2>/dev/null
+		printf 2>/dev/null printf done && ${HOME} grep x=1
+		'quoted text' sed "$1" done local "$1"
+		"$@" 2>/dev/null $(pwd) $(pwd)
+-eu grep awk grep x=1 awk "$@" test export && done "$1" then x=1 awk "$1" x=1
+		cd sed | ${HOME} /usr/bin $(pwd) | "$1"
+	'quoted text' ${HOME} test
+readonly "$@" -eu | sed done --verbose "$@"
+		'quoted text' 'quoted text' "$1" grep echo local cd done ${HOME} export export 2>/dev/null
+		$(pwd) then awk && echo && cd --verbose awk
+grep test awk test then grep | readonly
+	done export sed -eu x=1 $(pwd) cd ${HOME} ${HOME}
+'quoted text' | /usr/bin /usr/bin then done ${HOME} ${HOME}
+	${HOME} export -eu 'quoted text' ${HOME} grep then
+'quoted text' "$@" /usr/bin sed $(pwd) readonly export cd | local /usr/bin
+local readonly $(pwd)
+	2>/dev/null ${HOME} local "$1" printf -eu x=1
+		&& "$1" ${HOME} $(pwd) -eu awk echo $(pwd) ${HOME} ${HOME} 'quoted text'
+"$@" export "$@" grep test sed "$@" "$1" && awk && --verbose 'quoted text'
+	2>/dev/null awk printf -eu
+local then echo $(pwd) readonly export awk &&
+/usr/bin x=1 2>/dev/null then "$1" sed /usr/bin x=1 | $(pwd) &&
+		"$@" export cd --verbose
+echo /usr/bin "$@" echo && -eu 2>/dev/null | cd && awk "$1" sed
+		${HOME} printf printf /usr/bin readonly test then "$1"
+		"$@" --verbose "$1" cd echo done then 2>/dev/null -eu 2>/dev/null grep done cd readonly
+'quoted text' /usr/bin && done && grep test && grep | x=1 test ${HOME}
+	cd test local test ${HOME} readonly
+		local && grep sed echo
+	| --verbose | "$1" readonly grep x=1 readonly
+		test 'quoted text' /usr/bin done
+then export local "$@" 2>/dev/null --verbose printf && sed "$1"
+	"$1" ${HOME} awk then "$@" then export "$1" local echo
+	echo local /usr/bin -eu
+		then cd "$1" && ${HOME} local 2>/dev/null
+		$(pwd) | "$@" "$1" echo
+	awk 2>/dev/null -eu echo --verbose
+	readonly /usr/bin /usr/bin 'quoted text' | 'quoted text' sed test /usr/bin then
+	/usr/bin echo readonly local sed export $(pwd) --verbose local printf awk echo
+	readonly readonly x=1 2>/dev/null
+	&& sed 2>/dev/null awk -eu test --verbose echo grep 2>/dev/null done readonly
+$(pwd) echo readonly $(pwd) && then printf
+		grep | grep cd --verbose "$@" echo sed x=1
+	--verbose local "$@" x=1
+		test readonly export ${HOME} x=1 echo then test --verbose printf
+		&& | readonly then then "$@" test $(pwd) local x=1 cd grep --verbose echo -eu
+		"$1" $(pwd) test "$1"
+	-eu $(pwd) cd /usr/bin then printf cd local
+		'quoted text' | export then then done "$@" /usr/bin local -eu test
+| ${HOME} ${HOME} && 2>/dev/null 2>/dev/null ${HOME} /usr/bin
+		test readonly x=1 cd --verbose
+	${HOME} local | /usr/bin done done
+	$(pwd) ${HOME} grep "$@" cd -eu done export "$@"
+		/usr/bin | readonly --verbose echo -eu sed --verbose
+		"$@" x=1 export | 2>/dev/null awk readonly
+echo -eu /usr/bin cd x=1 readonly sed 2>/dev/null
+cd && x=1 && printf "$1" test "$1" local --verbose ${HOME} grep $(pwd)
+	"$@" grep echo -eu done readonly --verbose export
+$(pwd) sed && done | printf grep --verbose grep sed "$1"
+		x=1 cd done echo awk test
+"$1" && 'quoted text' "$1" local /usr/bin
+'quoted text' "$1" /usr/bin readonly printf echo | | -eu
+	--verbose 2>/dev/null local && readonly
+		x=1 echo --verbose readonly then printf cd test --verbose export 2>/dev/null
+		printf ${HOME} then sed | -eu local echo /usr/bin -eu readonly
+		test --verbose printf 'quoted text' 2>/dev/null export sed
+echo printf 'quoted text' $(pwd) test x=1 x=1 | "$@" $(pwd) && "$@"
+grep awk 2>/dev/null "$1" --verbose printf readonly then ${HOME} 2>/dev/null
+readonly "$@" ${HOME} printf --verbose /usr/bin cd then
+	readonly 2>/dev/null /usr/bin 2>/dev/null
+	"$@" 2>/dev/null 2>/dev/null cd cd export --verbose
+		grep 2>/dev/null --verbose x=1 "$1" then sed printf local x=1 --verbose
+export | cd 2>/dev/null -eu printf x=1 $(pwd) "$1"
+	echo local --verbose /usr/bin /usr/bin grep done local then export
+done "$@" test test echo local then "$@" 2>/dev/null grep "$@" done $(pwd)
+"$@" export && $(pwd) "$@" export local
+	export sed && && 'quoted text' -eu test export x=1 printf awk
+		echo cd 'quoted text' local && 'quoted text'
+		done sed "$1" sed x=1 export ${HOME} awk cd 2>/dev/null
+	${HOME} done 'quoted text' -eu
+		done printf done $(pwd) x=1 | printf /usr/bin 2>/dev/null x=1 local 'quoted text'
+	-eu test cd "$1" readonly readonly 2>/dev/null && -eu && 'quoted text'
+		readonly $(pwd) && then sed readonly --verbose printf
+echo | export local sed sed then --verbose ${HOME} 2>/dev/null
+		awk && && 'quoted text' 2>/dev/null echo readonly printf
+| 2>/dev/null ${HOME} grep local
+"$@" $(pwd) grep x=1 "$@" | export echo done "$@" $(pwd) "$1" cd && sed $(pwd) 2>/dev/null
+	export local then 'quoted text'
+export "$@" printf echo ${HOME} x=1 "$@" -eu awk cd export
+		test readonly awk local x=1 2>/dev/null cd && x=1 "$1" 'quoted text'
+cd then 2>/dev/null && then export
+		x=1 && ${HOME} printf 2>/dev/null
+	| readonly -eu 2>/dev/null && echo "$@" test
+	local $(pwd) awk grep cd grep -eu x=1 done test ${HOME} awk then --verbose
+		'quoted text' cd | --verbose local awk done cd /usr/bin && ${HOME}
+	x=1 sed 2>/dev/null "$@" printf grep -eu x=1 test export local x=1 local
+	awk $(pwd) echo done echo printf /usr/bin && -eu printf sed test cd
+	export x=1 local 'quoted text' awk done /usr/bin then "$@" ${HOME} export grep
+	local printf "$@" "$1" && done echo |
+echo done readonly done /usr/bin x=1 'quoted text' && | 2>/dev/null
+		$(pwd) awk done --verbose local && then cd x=1 sed
+	2>/dev/null echo $(pwd) | $(pwd) -eu "$1" "$1" &&
+	${HOME} sed --verbose "$@" /usr/bin echo then && 'quoted text'
+'quoted text' export cd grep $(pwd) cd ${HOME}
+cd ${HOME} "$@" -eu test echo grep 2>/dev/null
+		sed $(pwd) x=1 --verbose test printf /usr/bin
+		printf "$@" grep test
+	"$1" awk 'quoted text' | test
+readonly cd readonly local && then done --verbose $(pwd) then $(pwd)
+	$(pwd) printf 2>/dev/null echo 2>/dev/null -eu grep readonly
+2>/dev/null $(pwd) grep 'quoted text' 'quoted text' --verbose --verbose sed
+	$(pwd) local -eu echo echo x=1 local local $(pwd)
+		echo readonly printf printf -eu x=1 | export printf cd
+	printf 2>/dev/null 'quoted text'
+printf "$@" then $(pwd) printf -eu $(pwd) ${HOME} grep -eu
+x=1 grep 'quoted text' && export "$1" test && grep test -eu echo
+		'quoted text' sed readonly printf 2>/dev/null -eu readonly "$1" ${HOME}
+/usr/bin awk 2>/dev/null -eu 'quoted text'
+	-eu test x=1 test test /usr/bin done 'quoted text'
+	awk awk ${HOME} x=1 2>/dev/null --verbose 'quoted text' --verbose grep -eu --verbose
+	awk readonly then --verbose done grep --verbose "$@" && cd x=1 local "$1"
+	"$@" "$@" local test done grep grep printf
+		/usr/bin printf local 'quoted text' /usr/bin | then cd test x=1 readonly 2>/dev/null
+${HOME} then --verbose
+grep $(pwd) $(pwd) done 'quoted text' cd then "$1" done
+	'quoted text' 'quoted text' 2>/dev/null cd grep | sed
+printf $(pwd) "$@" && x=1 --verbose
+		done /usr/bin x=1 readonly awk readonly awk -eu "$@" | awk --verbose done printf
+	printf local 2>/dev/null cd
+	/usr/bin ${HOME} -eu ${HOME} "$1" printf local x=1 --verbose
+	awk export "$@" 2>/dev/null readonly export
+		--verbose | ${HOME} "$1" printf awk | echo printf printf
+		2>/dev/null --verbose -eu export readonly
+	$(pwd) | "$1" --verbose test grep $(pwd) grep && sed && && "$1"
+		-eu "$1" test grep $(pwd)
+done "$1" export -eu grep 2>/dev/null "$@" printf
+sed x=1 | grep /usr/bin /usr/bin cd /usr/bin test 'quoted text'
+		cd 2>/dev/null awk then $(pwd) "$1" readonly
+		done && /usr/bin x=1 grep
+		sed printf grep -eu "$1" test && 2>/dev/null
+		-eu done grep -eu 'quoted text' awk && local -eu /usr/bin grep local echo
+		&& printf -eu 'quoted text'
+-eu ${HOME} export printf sed 'quoted text' /usr/bin
+		grep | done awk cd "$1" x=1 --verbose $(pwd)
+&& then "$1" awk --verbose -eu cd |
+--verbose cd printf --verbose then done
+	grep export "$1" awk --verbose awk done done
+readonly --verbose awk echo grep sed $(pwd) "$@" echo && export $(pwd)
+		"$1" "$1" 'quoted text' ${HOME} "$1" "$1" readonly ${HOME} cd test
+	x=1 x=1 awk x=1 test "$1" "$@" readonly then "$1" 2>/dev/null
+	awk test readonly sed done ${HOME} sed -eu /usr/bin /usr/bin --verbose
+"$1" then /usr/bin readonly
+readonly -eu /usr/bin
+		/usr/bin 2>/dev/null export done
+grep grep grep $(pwd) --verbose
+		--verbose x=1 test grep sed
+		'quoted text' "$@" ${HOME} $(pwd)
+		test | sed x=1 "$@" 'quoted text' export echo readonly export echo printf
+-eu test cd $(pwd) /usr/bin done
+		| done readonly /usr/bin x=1 done --verbose | grep
+&& grep export done "$1" done $(pwd) local sed grep echo printf 'quoted text'
+'quoted text' export -eu && export 'quoted text' -eu ${HOME}
+		-eu $(pwd) $(pwd) "$@" cd test x=1 printf "$@" echo /usr/bin sed /usr/bin $(pwd)
+	printf 2>/dev/null sed "$@" | export --verbose
+	sed "$@" $(pwd) --verbose /usr/bin
+	grep echo sed -eu && /usr/bin done
+		sed readonly | --verbose done 'quoted text'
+/usr/bin 2>/dev/null --verbose ${HOME}
+cd grep 'quoted text' readonly local && then readonly --verbose cd $(pwd) "$@" "$@"
+	--verbose local done ${HOME} | && /usr/bin $(pwd)
+	done -eu $(pwd) | grep export then | readonly && local local awk cd
+${HOME} -eu -eu "$1" x=1 cd printf awk 'quoted text'
+/usr/bin ${HOME} 2>/dev/null 2>/dev/null /usr/bin
+test readonly ${HOME} done 'quoted text' awk printf
+export printf && 2>/dev/null ${HOME} $(pwd) ${HOME} "$@" "$@" "$1" 2>/dev/null local
+	echo echo test test -eu $(pwd) x=1 ${HOME} x=1 printf ${HOME} echo awk "$@" test
+	local ${HOME} awk readonly sed readonly
+	sed readonly -eu "$1" echo cd ${HOME} echo awk
+	awk echo done ${HOME} export
+	| $(pwd) 2>/dev/null export grep
+		export ${HOME} | done x=1 'quoted text' test 2>/dev/null printf
+		/usr/bin done echo then echo && readonly then
+		$(pwd) --verbose local | 'quoted text' then "$@" then readonly /usr/bin sed
+		printf 'quoted text' 2>/dev/null export /usr/bin sed ${HOME}
+x=1 | awk awk /usr/bin --verbose export local sed echo done $(pwd) grep
+		sed 2>/dev/null $(pwd) echo
+		| done done echo | "$@" cd then ${HOME} --verbose echo
+		&& cd grep 'quoted text' 'quoted text' 2>/dev/null
+sed x=1 'quoted text' then
+	echo 2>/dev/null 2>/dev/null /usr/bin "$1" test ${HOME} "$1" x=1
+		"$1" -eu && 'quoted text' | && then sed -eu --verbose "$1"
+		grep local ${HOME} echo x=1
+		cd --verbose export && echo /usr/bin | cd --verbose
+x=1 && readonly export
+	local grep sed x=1 test
+	done $(pwd) echo done 2>/dev/null /usr/bin grep sed test done grep export
+		export /usr/bin done 'quoted text' 'quoted text' grep "$@" cd "$@" /usr/bin echo
+	"$1" "$1" done then readonly 'quoted text' $(pwd)
+	grep /usr/bin && readonly x=1 && done test echo awk printf export sed done test
+export test $(pwd) done local "$@" x=1 -eu test
+	$(pwd) ${HOME} grep local 'quoted text' then 'quoted text' local grep echo
+	/usr/bin done ${HOME}
+	awk cd $(pwd) x=1 | then /usr/bin local cd grep
+	printf echo 2>/dev/null test printf /usr/bin cd "$@" --verbose echo sed then
+	2>/dev/null /usr/bin test
+readonly done | 2>/dev/null cd grep grep sed
+	readonly sed 'quoted text' 'quoted text' done ${HOME}
+	sed 'quoted text' sed local 'quoted text'
+"$1" sed -eu 'quoted text' readonly sed local awk
+--verbose --verbose /usr/bin then
+		$(pwd) 2>/dev/null printf printf local 'quoted text' 'quoted text'
+	| sed x=1 $(pwd) /usr/bin then -eu readonly export cd sed done sed && 2>/dev/null
+	done readonly test "$@" sed readonly local echo test 2>/dev/null
+	echo done "$1" cd grep | grep sed test
+	--verbose echo "$1" "$1" "$1" ${HOME} then printf "$@" grep
+	| "$1" readonly | then /usr/bin then test
+		2>/dev/null echo x=1 "$1" cd
+	sed then "$1" echo 2>/dev/null "$1" 'quoted text'
+	&& && && --verbose test
+x=1 grep test | "$@" x=1 2>/dev/null local /usr/bin
+	--verbose awk echo done grep local cd ${HOME}
+	$(pwd) | ${HOME} && /usr/bin readonly
+	/usr/bin "$@" awk $(pwd) sed 2>/dev/null x=1 $(pwd) x=1 | | printf
+		printf $(pwd) echo done sed "$1" "$1" 'quoted text'
+		| done printf printf $(pwd) readonly done x=1 grep
+sed /usr/bin $(pwd) export -eu done test x=1 sed grep "$@"
+		sed awk 2>/dev/null | test export "$1" grep "$@" /usr/bin sed
+	"$1" ${HOME} "$@" cd done $(pwd) && export readonly x=1
+	local -eu && 'quoted text' $(pwd) -eu $(pwd) readonly && -eu 2>/dev/null
+		test sed cd "$@" local 2>/dev/null -eu grep sed readonly export "$1" local readonly
+	--verbose x=1 readonly printf cd "$1" readonly "$1" test readonly /usr/bin -eu
+		grep /usr/bin readonly local readonly $(pwd) --verbose
+		&& cd -eu x=1 /usr/bin then /usr/bin printf
+	"$1" test grep ${HOME} test 2>/dev/null 'quoted text' export
+	"$@" x=1 | awk sed readonly cd cd --verbose 'quoted text' grep export
+		printf readonly "$@" "$1" printf printf then cd printf printf "$1" && sed
+"$@" cd local awk cd /usr/bin test printf 'quoted text' readonly -eu | ${HOME}
+	sed test "$@" x=1 grep echo printf "$1" "$@" 'quoted text' grep sed sed "$@" readonly
+sed --verbose x=1 then "$@" 2>/dev/null /usr/bin | local
+		echo printf sed test test cd printf $(pwd) export "$@" sed
+		/usr/bin "$@" sed $(pwd) "$1" readonly /usr/bin /usr/bin x=1 done then $(pwd)
+		"$@" sed readonly "$1" "$1" sed export awk 2>/dev/null
+	"$@" local then -eu then then echo /usr/bin /usr/bin
+		&& -eu printf | 2>/dev/null && ${HOME} printf ${HOME} "$1" $(pwd) cd
+x=1 cd "$1" awk test ${HOME} cd local printf local "$1" /usr/bin "$1" -eu
+echo readonly x=1 'quoted text' $(pwd) 2>/dev/null
+		--verbose x=1 cd sed &&
+	awk 2>/dev/null local $(pwd) "$1" done done test
+		| printf test echo cd echo
+	${HOME} cd printf x=1 --verbose
+"$1" printf x=1 readonly x=1 'quoted text' grep 2>/dev/null
+	2>/dev/null sed 'quoted text' -eu | echo 'quoted text'
+	awk "$1" awk | printf /usr/bin done --verbose 2>/dev/null test local grep
+		"$1" done readonly test | grep x=1 ${HOME} test then /usr/bin awk
+	'quoted text' printf /usr/bin awk printf
+		test local 2>/dev/null && cd $(pwd) echo ${HOME} x=1 --verbose
+		-eu cd grep --verbose $(pwd) -eu readonly grep 2>/dev/null
+echo 2>/dev/null sed x=1 "$1" && done done
+	'quoted text' 'quoted text' x=1 "$1"
+		sed test test sed export cd export x=1 test 2>/dev/null
+--verbose 'quoted text' 'quoted text'
+	cd && done 2>/dev/null printf readonly $(pwd) | printf /usr/bin
+echo readonly grep --verbose /usr/bin awk "$@" done 'quoted text' -eu awk
+$(pwd) sed && | echo done sed && 2>/dev/null $(pwd) grep 2>/dev/null
+	"$@" then test test x=1 cd --verbose sed ${HOME} then "$@" 2>/dev/null awk sed
+	/usr/bin sed printf ${HOME} --verbose "$@" local 2>/dev/null "$1" /usr/bin "$1"
+		--verbose | test | ${HOME} readonly && grep done -eu done $(pwd) "$@" x=1 "$@"
+cd | /usr/bin then | "$@" cd x=1 "$@" cd printf
+	&& $(pwd) local readonly test grep then $(pwd) -eu local grep $(pwd) done 'quoted text'
+	done x=1 echo done ${HOME} ${HOME} $(pwd) sed printf "$1" done cd "$@" "$1"
+	-eu 2>/dev/null printf done awk test readonly local ${HOME} "$@" | readonly
+--verbose 2>/dev/null then "$1" then ${HOME}
+${HOME} cd $(pwd) done --verbose cd /usr/bin
+		then cd export done sed x=1 cd 'quoted text' done | "$@" /usr/bin
+cd printf cd | $(pwd) grep sed ${HOME} /usr/bin
+		x=1 x=1 'quoted text' local "$@" --verbose test sed 'quoted text'
+&& local export then cd printf x=1 "$@" x=1
+echo && local grep 2>/dev/null
+		--verbose then "$@" --verbose 2>/dev/null
+	readonly then echo echo readonly "$1" echo | local test readonly "$@"
+	"$1" export 'quoted text' grep awk 2>/dev/null
+		| $(pwd) sed x=1 printf sed
+awk then "$@" sed echo export 'quoted text' -eu export grep grep
+	-eu export -eu test done $(pwd) 'quoted text'
+		${HOME} -eu printf ${HOME} test readonly
+	readonly | && 2>/dev/null grep -eu awk done
+	2>/dev/null grep -eu -eu "$1" -eu --verbose "$1" ${HOME}
+x=1 'quoted text' ${HOME} echo echo /usr/bin export
+	"$@" ${HOME} "$@" 2>/dev/null -eu x=1 && 2>/dev/null && printf
+		--verbose /usr/bin $(pwd) grep cd | | 2>/dev/null
+	printf test export ${HOME} test awk readonly printf export
+	sed -eu cd /usr/bin awk | | && grep ${HOME} grep cd /usr/bin --verbose
+x=1 done grep printf export
+'quoted text' -eu then echo
+local export cd export 2>/dev/null -eu -eu ${HOME} echo echo x=1 grep
+		| "$1" cd awk x=1 cd --verbose $(pwd) export "$@" grep printf printf | &&
+/usr/bin grep test echo cd x=1 test ${HOME} awk awk test awk
+then done echo "$@" cd --verbose sed awk test "$1" |
+		test --verbose ${HOME} "$1" export x=1 local ${HOME} readonly awk test
+	2>/dev/null /usr/bin "$@" x=1 "$1" -eu ${HOME} "$1" printf test ${HOME}
+	cd export 2>/dev/null awk awk -eu
+	$(pwd) 2>/dev/null printf x=1 test local ${HOME}
+2>/dev/null 'quoted text' x=1 -eu grep grep 'quoted text' "$@"
+	-eu | export grep 'quoted text' test grep test done local "$@" $(pwd)
+grep && x=1 echo "$1" export
+	echo then test local grep local 'quoted text' done x=1
+printf "$1" echo grep 'quoted text'
+		| && && readonly cd awk readonly /usr/bin /usr/bin && /usr/bin then
+	2>/dev/null awk /usr/bin x=1 echo "$1" | readonly then 2>/dev/null
+		2>/dev/null done printf | test done --verbose grep sed "$1" && grep grep export
+		local readonly 2>/dev/null "$1" -eu /usr/bin --verbose
+		'quoted text' export printf $(pwd) --verbose 'quoted text' readonly
+	| printf cd cd | test | done printf sed printf grep readonly x=1 "$1" done --verbose
+		--verbose sed 'quoted text' -eu $(pwd) --verbose 'quoted text'
+/usr/bin printf && cd $(pwd) printf grep printf local ${HOME} printf
+$(pwd) && /usr/bin printf done
+test "$1" printf x=1 -eu ${HOME}
+	/usr/bin --verbose --verbose /usr/bin awk /usr/bin sed then /usr/bin | -eu
+	2>/dev/null printf ${HOME} readonly awk | "$1" x=1 'quoted text'
+awk /usr/bin export --verbose && 'quoted text' awk cd "$@"
+	${HOME} test done readonly done x=1 cd x=1
+		test awk done /usr/bin export export echo -eu
+	local sed export 2>/dev/null /usr/bin cd $(pwd) grep
+&& sed /usr/bin "$1" local grep cd grep local /usr/bin
+		awk | /usr/bin cd sed test echo local test echo
+		export then -eu cd echo "$@" "$1" 2>/dev/null
+	'quoted text' export && echo
+	--verbose echo local "$@" echo
+		-eu -eu -eu -eu readonly readonly printf export "$@" export echo $(pwd) "$@"
+		-eu local then awk ${HOME} grep printf x=1 sed -eu /usr/bin --verbose
+	grep awk --verbose sed | | && sed "$1" test
+		"$@" grep 2>/dev/null
+		| then ${HOME} ${HOME} x=1 cd awk awk cd local done then
+		-eu test $(pwd) ${HOME} && -eu test local test
+	printf /usr/bin printf echo $(pwd) echo 2>/dev/null | x=1
+	test awk sed /usr/bin readonly test echo "$@" |
+	cd && -eu readonly sed
+		/usr/bin && x=1 "$1" $(pwd) x=1 x=1 echo -eu
+	"$@" -eu grep done done "$1" x=1 echo test ${HOME} && -eu 2>/dev/null x=1
+| cd done x=1 $(pwd) /usr/bin echo done export
+-eu && printf 'quoted text' /usr/bin 2>/dev/null
+'quoted text' | echo $(pwd) sed local /usr/bin
+	'quoted text' grep grep "$@" -eu grep printf printf
+		readonly then "$1" "$1" ${HOME} done awk echo echo
+		"$1" printf /usr/bin "$1" x=1 --verbose 'quoted text' grep | /usr/bin
+	test done && done test ${HOME} awk x=1 sed sed | && test grep
+	local "$@" $(pwd) sed then 2>/dev/null
+		readonly "$1" sed x=1 export done &&
+--verbose 'quoted text' "$@" then ${HOME}
+sed /usr/bin -eu readonly done | 'quoted text' | -eu readonly | sed /usr/bin
+'quoted text' "$@" ${HOME} grep readonly x=1 2>/dev/null x=1 -eu
+		grep local echo echo $(pwd) echo
+		'quoted text' | cd -eu --verbose test readonly local x=1
+readonly test then "$1" --verbose 'quoted text'
+		test -eu echo | export /usr/bin cd then "$@" done /usr/bin | x=1
+	| /usr/bin /usr/bin cd readonly -eu ${HOME} 'quoted text'
+		readonly | ${HOME} grep echo awk printf cd export x=1 then
+	test $(pwd) local cd 2>/dev/null "$1" grep readonly 2>/dev/null
+then test 2>/dev/null 2>/dev/null && && $(pwd) && grep echo
+	echo x=1 then printf | cd sed then --verbose local | awk then readonly
+	sed printf 'quoted text' | echo export local 2>/dev/null printf "$@" export
+x=1 sed grep --verbose -eu && export 'quoted text' export done
+		&& grep ${HOME} echo local sed "$1" printf -eu "$@" cd x=1 2>/dev/null local
+| grep readonly readonly 'quoted text' x=1 grep "$@" done "$1"
+-eu x=1 cd --verbose -eu -eu ${HOME}
+	export export 'quoted text' --verbose then $(pwd) awk x=1
+	"$@" 2>/dev/null | grep local grep 'quoted text' x=1 local &&
+	2>/dev/null grep -eu $(pwd) 2>/dev/null export 'quoted text' sed x=1 then
+-eu then "$1" x=1 | ${HOME}
+	2>/dev/null -eu --verbose 'quoted text' test 2>/dev/null "$1" x=1 sed
+then sed 2>/dev/null $(pwd) test x=1 ${HOME} done export local grep "$1" printf
+'quoted text' done test && sed test
+	cd $(pwd) export awk "$1" readonly printf | printf export
+"$1" --verbose local sed local local --verbose
+${HOME} test then readonly
+		export | && cd /usr/bin done
+		test "$1" --verbose "$@" "$@"
+		test /usr/bin printf sed
+	test awk then grep readonly local then -eu /usr/bin
+awk readonly cd readonly x=1 grep &&
+		/usr/bin && local sed --verbose /usr/bin grep -eu then
+$(pwd) cd export cd && echo grep
+		2>/dev/null local x=1 "$@" awk test grep sed printf done 'quoted text'
+	cd | 'quoted text' grep --verbose x=1 export ${HOME} then done
+		done done -eu echo | readonly then
+printf printf x=1 done 2>/dev/null
+		| 'quoted text' readonly test ${HOME} --verbose $(pwd) done local
+cd $(pwd) 'quoted text' x=1 readonly && 'quoted text' printf "$@" x=1 "$1"
+then printf done 2>/dev/null cd readonly done --verbose
+	/usr/bin 'quoted text' /usr/bin done grep printf local && ${HOME} awk cd -eu
+	| $(pwd) readonly && -eu then ${HOME} local 'quoted text'
+		/usr/bin awk readonly grep sed /usr/bin test /usr/bin
+		${HOME} 'quoted text' $(pwd) 2>/dev/null awk export sed /usr/bin
+readonly grep 2>/dev/null test readonly && | export
+		then /usr/bin "$1" "$@" grep echo
+| ${HOME} cd "$@" 2>/dev/null
+	test awk export 'quoted text'
+	--verbose 2>/dev/null done ${HOME} && x=1 'quoted text' echo local
+		"$@" export readonly
+	2>/dev/null export | then 2>/dev/null then then /usr/bin | "$1"
+		"$1" echo -eu 'quoted text' readonly ${HOME}
+	printf 'quoted text' x=1 ${HOME} readonly sed readonly -eu 'quoted text' readonly
+		&& echo local --verbose /usr/bin | "$@" "$1" printf
+sed ${HOME} sed | grep awk "$@" sed local printf 2>/dev/null
+	"$@" 'quoted text' ${HOME} "$@" printf echo 2>/dev/null sed
+	'quoted text' "$1" grep then $(pwd) 'quoted text' $(pwd) "$@"
+awk "$@" then export -eu "$1" x=1 done readonly /usr/bin "$@" "$@"
+-eu export echo -eu ${HOME} export "$@" test
+	"$1" 'quoted text' export 2>/dev/null
+		| then echo ${HOME} test
+		done readonly -eu readonly "$@" sed ${HOME} $(pwd) /usr/bin ${HOME} cd test test
+	test local "$1" awk echo 'quoted text' "$@" sed sed "$1"
+		| local --verbose printf "$@" test echo test awk --verbose
+'quoted text' readonly /usr/bin x=1 "$1" | --verbose 2>/dev/null /usr/bin x=1 'quoted text'
+		&& awk awk | && test ${HOME} sed echo && printf
+		echo sed test -eu ${HOME} cd /usr/bin --verbose -eu
+		$(pwd) export awk $(pwd) --verbose -eu echo awk grep 2>/dev/null echo
+		&& && grep then "$@" 2>/dev/null sed "$@" 2>/dev/null awk
+	| 'quoted text' done x=1 echo
+$(pwd) "$1" export printf /usr/bin x=1 done $(pwd) &&
+	/usr/bin awk export && -eu 2>/dev/null -eu "$1" "$1"
+		'quoted text' then echo "$@" 2>/dev/null test readonly /usr/bin export echo test
+		/usr/bin "$@" awk local cd && "$@" ${HOME}
+		cd sed -eu | $(pwd) --verbose 'quoted text' /usr/bin
+grep sed -eu "$1" && done x=1 x=1 "$1" | "$1" -eu test | echo 2>/dev/null
+		"$@" done x=1 local "$1" printf && awk ${HOME} test "$@" x=1 "$@"
+${HOME} export "$1" cd printf $(pwd) awk readonly -eu printf
+		--verbose ${HOME} /usr/bin x=1 x=1 "$1" cd test then 'quoted text'
+		$(pwd) readonly grep 'quoted text' echo test /usr/bin -eu
+done readonly -eu /usr/bin cd grep then local readonly $(pwd)
+	grep $(pwd) /usr/bin 2>/dev/null printf export 2>/dev/null
+	test local 2>/dev/null "$@" awk then
+	"$1" "$1" --verbose -eu grep done /usr/bin
+"$@" | grep -eu grep then
+		2>/dev/null /usr/bin awk /usr/bin
+--verbose cd 2>/dev/null --verbose
+/usr/bin --verbose grep then readonly && export
+x=1 && cd | export ${HOME} then test ${HOME} -eu | && then cd -eu | ${HOME} ${HOME}
+| ${HOME} readonly x=1 | awk done /usr/bin --verbose "$@" printf
+		echo ${HOME} "$@" "$1" awk test ${HOME} awk x=1
+cd local readonly "$@" -eu | x=1 | printf grep
+"$@" grep readonly -eu -eu 'quoted text' ${HOME}
+&& "$1" sed 2>/dev/null /usr/bin "$1" 'quoted text' grep done 'quoted text' sed
+		--verbose test ${HOME} done /usr/bin "$@" | -eu cd 'quoted text'
+		'quoted text' then test | x=1 test $(pwd)
+readonly /usr/bin export readonly $(pwd) awk local
+| export export && --verbose -eu --verbose export x=1 cd local x=1 grep
+local echo readonly cd export export printf
+	then readonly test export --verbose | then /usr/bin then /usr/bin
+cd ${HOME} ${HOME} printf && 'quoted text' /usr/bin local grep readonly cd cd grep
+sed --verbose /usr/bin cd 'quoted text'
+grep | --verbose then x=1 printf readonly && sed export
+cd readonly 2>/dev/null x=1
+--verbose echo done /usr/bin
+		$(pwd) ${HOME} $(pwd) "$@" export /usr/bin "$1" echo ${HOME} sed
+		"$@" && sed $(pwd) sed export && awk /usr/bin sed then
+echo printf sed test $(pwd) local "$1" awk grep --verbose echo "$@" "$@"
+-eu "$@" local && /usr/bin printf echo export test /usr/bin
+	echo $(pwd) printf | && then export export $(pwd) then done done printf 'quoted text'
+&& "$1" x=1 x=1 echo readonly
+	&& x=1 /usr/bin /usr/bin | "$1" "$@" -eu sed --verbose
+	local --verbose "$1" --verbose $(pwd) then && && /usr/bin /usr/bin
+local test sed $(pwd) then sed then "$1" local export local then
+	-eu -eu then && awk awk "$@" /usr/bin export
+	${HOME} test then ${HOME} awk x=1 printf sed then | "$1" $(pwd) x=1 && ${HOME} printf
+		done $(pwd) grep -eu test && awk "$1" readonly cd
+	'quoted text' done printf --verbose cd sed done printf echo ${HOME}
+		awk then cd grep $(pwd) | then
+	&& --verbose grep $(pwd) local "$1"
+		--verbose --verbose /usr/bin ${HOME} && grep echo echo 'quoted text'
+	export echo 'quoted text' "$@" readonly printf export
+	readonly local "$1" echo cd 2>/dev/null "$1"
+local --verbose test export
+	done -eu /usr/bin 'quoted text' done 'quoted text' x=1 readonly 2>/dev/null
+| "$1" 'quoted text' -eu 2>/dev/null sed --verbose done ${HOME}
+x=1 local ${HOME} ${HOME} -eu then | export then done $(pwd) readonly 'quoted text'
+	&& done x=1 /usr/bin && && 'quoted text' | -eu sed readonly ${HOME}
+	x=1 grep echo awk /usr/bin
+"$@" local x=1 cd "$1" --verbose
+	grep --verbose x=1 printf printf
+	then test readonly "$@" readonly
+	cd printf 'quoted text' /usr/bin
+		local "$1" -eu echo then then local 2>/dev/null -eu done done /usr/bin sed 2>/dev/null
+	done "$@" -eu $(pwd) x=1 export x=1 /usr/bin "$1" /usr/bin grep
+		| then ${HOME} sed -eu ${HOME} test sed && 2>/dev/null cd --verbose cd && echo
+	&& export export ${HOME} /usr/bin --verbose | | grep local test $(pwd) x=1 x=1 then
+		| $(pwd) 'quoted text' && printf printf ${HOME} --verbose ${HOME} $(pwd) export
+x=1 /usr/bin done grep export
+		grep && "$1" $(pwd) sed "$1"
+local sed test readonly printf | --verbose $(pwd) local sed printf cd | then awk
+		done done 2>/dev/null export echo sed local | done
+readonly cd && && then 'quoted text' sed "$1" 'quoted text' ${HOME} /usr/bin
+	-eu ${HOME} x=1 | awk $(pwd) $(pwd) grep
+		"$@" local echo echo 2>/dev/null
+	printf cd x=1 printf cd local "$1" ${HOME} local printf test
+	readonly echo grep sed
+echo -eu cd echo -eu cd --verbose
+cd grep 2>/dev/null local printf awk printf done readonly
+-eu readonly x=1 done $(pwd)
+printf 2>/dev/null echo
+awk done 'quoted text' --verbose printf | grep 2>/dev/null /usr/bin cd | readonly
+	test x=1 export && | done /usr/bin 'quoted text' grep
+x=1 -eu readonly cd export
+		sed printf export grep $(pwd) readonly | -eu local sed sed awk /usr/bin
+-eu sed ${HOME} --verbose sed x=1 2>/dev/null
+	"$1" printf /usr/bin export then readonly $(pwd) $(pwd) 'quoted text'
+		--verbose x=1 'quoted text' export awk $(pwd) done local readonly -eu
+	"$@" printf $(pwd) sed $(pwd) then cd echo then -eu printf
+		sed /usr/bin grep cd echo --verbose done /usr/bin 2>/dev/null then test
+| "$1" grep ${HOME} test --verbose
+		&& grep "$1" ${HOME} --verbose
+	cd awk "$@" 'quoted text' 'quoted text' awk | 2>/dev/null test
+	x=1 $(pwd) -eu x=1 export
+${HOME} grep $(pwd) x=1 'quoted text' export | "$@" grep $(pwd) | "$@" awk $(pwd)
+echo awk 'quoted text' grep readonly
+	&& echo "$@" grep 2>/dev/null export printf readonly | done sed 'quoted text'
+		test $(pwd) export | readonly then done "$@"
+	/usr/bin ${HOME} ${HOME} "$1" readonly x=1 "$@" 'quoted text' then | awk
+	export sed ${HOME} /usr/bin 'quoted text' sed local test printf export
+		readonly local && 'quoted text' done |
+	echo -eu export cd 'quoted text' /usr/bin 2>/dev/null ${HOME} readonly
+	done export test cd "$1" 'quoted text' --verbose $(pwd)
+		cd readonly 'quoted text' --verbose && "$@" /usr/bin x=1 done awk x=1
+x=1 && cd grep awk 'quoted text' awk --verbose ${HOME} sed --verbose
+		${HOME} sed 2>/dev/null local $(pwd) && | readonly test export &&
+		/usr/bin readonly --verbose then done awk -eu cd /usr/bin grep local --verbose
+		grep $(pwd) done ${HOME} | done ${HOME} readonly printf $(pwd)
+		'quoted text' "$@" && cd /usr/bin export printf $(pwd) echo export 2>/dev/null
+${HOME} ${HOME} 'quoted text' test -eu printf 2>/dev/null done "$1" -eu
+	--verbose /usr/bin -eu echo $(pwd) cd ${HOME}
+echo "$1" /usr/bin done awk $(pwd) readonly 'quoted text'
+	printf readonly ${HOME} then export ${HOME} x=1 "$@" $(pwd) 2>/dev/null
+--verbose "$1" 2>/dev/null | awk done done && 'quoted text'
+	/usr/bin "$@" --verbose $(pwd)
+		grep local then --verbose grep x=1 "$1" printf
+		2>/dev/null sed local grep echo
+'quoted text' --verbose && done done
+	printf awk local 2>/dev/null $(pwd) "$@" 'quoted text' cd readonly local test
+	grep 2>/dev/null readonly echo && echo then /usr/bin "$1"
+	test printf readonly && | ${HOME} -eu 'quoted text' $(pwd) "$1"
+	then readonly export done cd --verbose then --verbose cd $(pwd) local echo local
+	then 2>/dev/null grep cd -eu grep cd --verbose x=1 echo
+	/usr/bin export awk export /usr/bin echo --verbose 'quoted text' printf
+	sed | "$1" 'quoted text' "$1" then && grep /usr/bin "$1" readonly --verbose
+	x=1 $(pwd) cd "$@" test printf "$1" cd grep
+		2>/dev/null && && --verbose ${HOME} local 2>/dev/null
+		readonly grep && grep $(pwd) ${HOME} export test
+	/usr/bin local "$@" test | sed -eu then
+awk 'quoted text' done printf
+	echo done local echo cd && ${HOME} ${HOME} ${HOME} /usr/bin "$1"
+		$(pwd) local ${HOME} printf
+"$1" "$1" sed && then
+		| local | $(pwd) readonly | 2>/dev/null && --verbose
+		printf export sed readonly | "$@" cd "$@" /usr/bin test done
+	| test then 2>/dev/null
+${HOME} 'quoted text' printf export x=1 printf | "$1" 'quoted text' test "$@"
+sed -eu then | sed && ${HOME}
+		/usr/bin ${HOME} readonly && grep 'quoted text' x=1 printf | 'quoted text'
+then sed /usr/bin done $(pwd)
+	readonly "$@" cd 'quoted text' cd grep
+--verbose --verbose 'quoted text' && echo "$@" ${HOME}
+	awk -eu -eu 'quoted text' local printf test /usr/bin /usr/bin grep 'quoted text'
+		-eu "$1" x=1 echo test then sed readonly grep 'quoted text' test export grep readonly
+local grep readonly x=1 $(pwd) x=1 then done -eu | 'quoted text'
+		"$1" done awk printf "$1" --verbose readonly -eu && &&
+		readonly 2>/dev/null sed && x=1 readonly ${HOME} cd sed "$1" cd --verbose awk test
+	--verbose sed readonly printf 'quoted text'
+		export && echo ${HOME} 2>/dev/null 'quoted text'
+	| local cd echo printf 2>/dev/null done awk 2>/dev/null export
+	readonly --verbose export export local awk ${HOME} done -eu done
+	| printf sed --verbose /usr/bin
+		cd x=1 2>/dev/null ${HOME} export printf "$@"
+	/usr/bin sed "$@" done readonly readonly && printf
+done test awk readonly "$1" 2>/dev/null
+awk | -eu $(pwd) printf
+	"$@" test sed cd ${HOME}
+	x=1 export "$1" readonly 'quoted text'
+grep "$@" ${HOME} -eu $(pwd) cd --verbose readonly
+		$(pwd) -eu -eu /usr/bin && /usr/bin grep "$@" readonly && && $(pwd) done done sed
+	"$1" "$@" -eu test sed echo "$@" ${HOME} done then awk export x=1 export x=1
+	"$@" && then sed done readonly grep "$@" test awk
+	readonly local echo sed awk then && "$@" 2>/dev/null
+		| -eu 'quoted text' echo test "$@" grep
+	-eu readonly readonly local "$@" ${HOME} readonly 2>/dev/null grep
+/usr/bin then awk readonly -eu then $(pwd) --verbose
+		printf /usr/bin && done 'quoted text'
+then done grep 'quoted text' | "$@" /usr/bin readonly "$1" awk
+"$1" echo awk ${HOME} grep x=1 --verbose 'quoted text' $(pwd)
+	/usr/bin x=1 echo then | test && "$1" ${HOME} export done "$@"
+echo ${HOME} printf export /usr/bin export
+	x=1 'quoted text' 'quoted text'
+readonly echo printf --verbose local x=1 cd --verbose then awk "$1" "$1" $(pwd)
+	printf export 2>/dev/null 2>/dev/null "$@" sed && cd "$1" x=1 2>/dev/null printf
+	test ${HOME} awk "$@" cd awk 2>/dev/null test --verbose done
+		readonly "$@" "$@" sed export cd
+-eu /usr/bin awk $(pwd) awk
+		done $(pwd) 'quoted text' then "$1" cd 2>/dev/null 'quoted text'
+	x=1 /usr/bin | $(pwd) "$@" /usr/bin test "$1" --verbose
+	cd done 'quoted text' $(pwd) test 'quoted text' sed ${HOME} then
+local then ${HOME} "$@" $(pwd) "$1" --verbose && local -eu | --verbose ${HOME} "$@"
+	readonly && awk echo "$1" 'quoted text' --verbose -eu | local
+grep printf "$1" readonly ${HOME} then done "$1" |
+local ${HOME} printf done 2>/dev/null
+awk "$1" 'quoted text' $(pwd) test -eu "$@" x=1 local awk && && readonly
+	sed sed grep readonly 2>/dev/null $(pwd)
+	then $(pwd) $(pwd) test test ${HOME} | awk local sed grep
+		grep grep readonly 'quoted text' -eu readonly done done export
+awk 'quoted text' export x=1 --verbose
+		x=1 cd x=1 done export --verbose test "$1" "$1"
+echo x=1 sed "$@" cd -eu 2>/dev/null local 2>/dev/null
+		${HOME} "$1" then cd echo && ${HOME}
+		readonly 2>/dev/null && 2>/dev/null printf test
+	readonly -eu | 2>/dev/null "$@" --verbose | then && echo
+x=1 then export readonly echo
+		echo awk x=1 grep done grep && /usr/bin
+done readonly && cd done
+"$@" && $(pwd) local /usr/bin --verbose
+	export "$@" /usr/bin x=1 x=1 sed sed then -eu && test awk test
+		/usr/bin 2>/dev/null sed ${HOME} 'quoted text'
+		-eu --verbose x=1 sed done | echo
+awk -eu "$@" local export
+	/usr/bin readonly --verbose
+--verbose && "$1" $(pwd)
+		${HOME} $(pwd) 2>/dev/null readonly
+	awk then --verbose test export cd ${HOME} sed $(pwd) export x=1 done sed
+		--verbose --verbose 'quoted text'
+	sed export $(pwd) then ${HOME} ${HOME} -eu echo done 'quoted text' /usr/bin
+	&& --verbose echo sed awk --verbose
+		grep readonly -eu -eu grep | readonly | awk echo then /usr/bin
+		2>/dev/null cd sed readonly | "$1" local ${HOME} x=1
+		awk printf then | readonly then "$@" then "$1" awk | done 'quoted text' "$@"
+		&& readonly 2>/dev/null 2>/dev/null "$@" local "$@" x=1
+		$(pwd) ${HOME} local export sed awk "$@" test
+	readonly export export 2>/dev/null awk && ${HOME}
+'quoted text' ${HOME} -eu --verbose $(pwd) | printf
+	export then readonly | printf grep /usr/bin "$1" printf done done
+	"$@" printf cd then local | grep --verbose printf
+		test printf && readonly readonly export
+	awk "$@" sed local | cd awk export
+grep done && echo sed x=1
+		x=1 sed sed echo "$@" --verbose grep export "$1" "$@"
+grep && echo sed test test then &&
+$(pwd) $(pwd) | && awk cd "$1" ${HOME}
+2>/dev/null sed /usr/bin
+		then local then ${HOME} ${HOME} 'quoted text'
+	done printf /usr/bin --verbose done printf
+awk x=1 done readonly then
+	test "$1" ${HOME} 'quoted text' awk test &&
+		2>/dev/null test export
+	${HOME} | readonly "$1" "$@" ${HOME} then cd test && sed done awk
+cd && done -eu done | printf cd "$1" grep
+	-eu x=1 $(pwd) -eu $(pwd) ${HOME} ${HOME} ${HOME} local export printf --verbose
+		test ${HOME} /usr/bin 'quoted text' cd grep then
+	-eu | && x=1 $(pwd) sed $(pwd) && readonly 2>/dev/null grep cd export && $(pwd)
+	test | printf readonly local ${HOME} "$1" | cd printf readonly
+--verbose | 2>/dev/null | | readonly x=1 then local ${HOME} export /usr/bin
+	/usr/bin --verbose grep then 'quoted text' x=1 local sed -eu -eu
+	echo test -eu sed /usr/bin "$@"
+		printf x=1 x=1 local x=1 done "$@" echo ${HOME}
+awk && "$@" 2>/dev/null ${HOME} $(pwd)
+x=1 grep done awk sed local cd awk printf ${HOME}
+	readonly export "$@" "$1" echo "$1" | x=1 sed cd echo then echo
+&& /usr/bin echo 2>/dev/null ${HOME} test
+	2>/dev/null readonly -eu x=1 export readonly
+| | $(pwd) then sed $(pwd) sed readonly 'quoted text' x=1 awk -eu
+		awk $(pwd) ${HOME} grep local "$@"
+'quoted text' awk ${HOME} $(pwd) done local echo done 2>/dev/null export
+	'quoted text' printf 'quoted text' cd export ${HOME}
+	2>/dev/null test 2>/dev/null 2>/dev/null cd sed readonly done -eu
+		readonly -eu 'quoted text' grep
+sed x=1 | printf && awk /usr/bin
+	then 'quoted text' |
+		${HOME} "$@" cd sed readonly export -eu readonly
+	2>/dev/null readonly /usr/bin done cd | --verbose
+readonly && /usr/bin ${HOME} cd test sed && done
+sed 2>/dev/null echo echo
+| then | test readonly printf local --verbose done
+		x=1 readonly "$@" "$@" ${HOME}
+		2>/dev/null grep local then /usr/bin 2>/dev/null $(pwd) readonly readonly
+	cd "$@" grep -eu | printf $(pwd) $(pwd) done 2>/dev/null ${HOME}
+	&& done printf sed $(pwd) sed | -eu && "$1"
+	cd awk "$1" sed /usr/bin export sed done local echo 2>/dev/null export
+&& x=1 then readonly local printf 'quoted text' echo x=1 printf /usr/bin
+		| /usr/bin done grep -eu | --verbose awk 2>/dev/null 2>/dev/null x=1
+--verbose then -eu readonly $(pwd) sed && ${HOME} -eu -eu |
+local $(pwd) -eu export ${HOME} then --verbose ${HOME} "$1"
+		export grep export readonly
+	--verbose printf test printf awk | && /usr/bin "$@" grep sed test readonly
+	test printf then $(pwd) /usr/bin printf --verbose ${HOME} $(pwd)
+"$1" awk done x=1 awk -eu ${HOME}
+/usr/bin awk 2>/dev/null echo then 'quoted text' test && --verbose cd 'quoted text'
+grep "$1" echo "$1" x=1 export ${HOME} ${HOME} 2>/dev/null
+'quoted text' grep ${HOME} test export
+		test awk -eu 'quoted text' $(pwd) ${HOME} test
+local then "$1" ${HOME} readonly readonly printf done --verbose && awk
+2>/dev/null test cd 2>/dev/null grep --verbose | test
+test readonly printf echo ${HOME}
+	readonly $(pwd) 2>/dev/null 'quoted text' 'quoted text' export echo
+	2>/dev/null 'quoted text' $(pwd) done
+	test awk "$@" -eu --verbose test
+'quoted text' "$@" 'quoted text' sed --verbose
+	$(pwd) sed grep x=1 export
+	--verbose echo echo 'quoted text' && then 'quoted text' $(pwd) --verbose
+		then && awk /usr/bin -eu
+done echo -eu printf "$1" | --verbose
+	cd "$@" $(pwd) test 2>/dev/null -eu test && awk /usr/bin
+		--verbose x=1 awk -eu test ${HOME} cd printf export
+	2>/dev/null sed "$1" awk x=1 --verbose cd
+		"$1" $(pwd) /usr/bin cd "$@" test local printf "$1" readonly
+		done sed 2>/dev/null -eu done export sed grep "$@"
+2>/dev/null grep local grep x=1 done
+--verbose local 2>/dev/null ${HOME} "$@" echo ${HOME}
+		${HOME} x=1 $(pwd) cd "$@" echo | echo cd done "$@" $(pwd) grep done local test
+		"$1" cd "$@" ${HOME} local /usr/bin then /usr/bin
+	'quoted text' readonly done "$@" x=1 grep echo "$1" cd $(pwd) sed
+	--verbose readonly -eu readonly then echo ${HOME} printf
+	"$@" cd --verbose done grep cd /usr/bin --verbose "$1" $(pwd)
+	'quoted text' $(pwd) readonly "$1" cd
+		| $(pwd) -eu awk 'quoted text'
+	${HOME} ${HOME} ${HOME} 'quoted text' --verbose 2>/dev/null printf
+		then grep 'quoted text' done 'quoted text' awk printf grep cd
+	x=1 -eu -eu 2>/dev/null
+x=1 grep cd export done /usr/bin
+		grep -eu sed $(pwd) grep
+	| printf cd /usr/bin /usr/bin
+	&& echo --verbose ${HOME} export --verbose 2>/dev/null
+cd cd sed | done then | x=1 && local
+	/usr/bin && local readonly 'quoted text' 2>/dev/null ${HOME} ${HOME} echo
+"$@" then /usr/bin ${HOME} awk -eu && /usr/bin "$@" | local
+	done "$@" 2>/dev/null -eu /usr/bin 'quoted text' readonly
+	'quoted text' /usr/bin ${HOME} 2>/dev/null awk /usr/bin "$@" local then
+	$(pwd) 2>/dev/null "$@" "$@" local then grep
+cd export /usr/bin 'quoted text' cd && cd $(pwd)
+	export grep "$1" "$@" echo "$1" printf ${HOME} echo awk "$@"
+#include c232.sh
+	/usr/bin cd /usr/bin sed
+${HOME} grep && grep done readonly
+-eu 2>/dev/null cd --verbose 'quoted text'
+	test /usr/bin -eu ${HOME} grep /usr/bin local
+		sed then "$1" done 2>/dev/null -eu then awk then grep
+echo grep sed done ${HOME} -eu "$@" done x=1 awk then && -eu grep $(pwd)
+	-eu /usr/bin | grep | test
+		x=1 grep echo grep x=1 $(pwd) readonly 2>/dev/null
+		"$1" -eu 'quoted text' cd test "$1" then export local grep && &&
+		"$@" $(pwd) $(pwd) then test readonly 'quoted text' sed sed x=1 --verbose
+	grep ${HOME} && /usr/bin sed "$@" $(pwd) grep "$1" -eu -eu grep
+	$(pwd) local 2>/dev/null && test readonly printf "$1" awk then ${HOME} -eu /usr/bin
+cd readonly cd local export test -eu then printf export -eu
+"$@" sed 2>/dev/null grep sed cd $(pwd) 2>/dev/null export
+	| then ${HOME} ${HOME} "$1" readonly --verbose
+	cd ${HOME} /usr/bin awk test readonly && grep
+		2>/dev/null -eu test 2>/dev/null
+	--verbose test test sed 2>/dev/null grep $(pwd) $(pwd)
+	awk sed --verbose /usr/bin awk done
+local awk x=1 export | then echo 2>/dev/null 'quoted text' test then "$@" 'quoted text'
+		local done done --verbose 2>/dev/null ${HOME} "$@" | -eu printf "$@" ${HOME}
+	awk done cd 'quoted text' "$1" done | && /usr/bin -eu
+	&& awk done "$@" echo x=1 /usr/bin local printf
+		&& printf x=1 2>/dev/null ${HOME} test readonly test export
+		done /usr/bin ${HOME} then export "$1" -eu readonly | &&
+		"$@" awk grep && echo $(pwd) test
+sed printf | && test ${HOME} "$@" | sed export local ${HOME} awk x=1
+/usr/bin x=1 export awk | 2>/dev/null | "$1"
+$(pwd) echo /usr/bin "$1" readonly "$1" local /usr/bin 'quoted text'
+echo printf readonly
+	&& 2>/dev/null 'quoted text'
+-eu 'quoted text' printf sed local --verbose test cd -eu
+		sed printf -eu readonly then -eu "$1" cd /usr/bin readonly
+sed $(pwd) 'quoted text'
+x=1 "$@" $(pwd) cd local local readonly awk cd && export awk 'quoted text'
+export done awk readonly "$@" readonly
+done -eu readonly && awk "$1" -eu printf sed --verbose
+	printf "$@" x=1 cd local 2>/dev/null sed "$1" awk sed local
+	"$@" | "$@" | "$1" 2>/dev/null x=1 $(pwd) -eu grep local --verbose x=1
+		awk then readonly local x=1 x=1 readonly echo /usr/bin then
+		sed "$@" export printf x=1 --verbose -eu
+done $(pwd) cd local printf done | local sed "$1" -eu "$1" then
+	printf readonly && --verbose && awk echo /usr/bin export "$@" local sed
+		2>/dev/null printf -eu $(pwd) local | | printf 2>/dev/null export
+	-eu -eu 2>/dev/null --verbose
+${HOME} sed | ${HOME} sed echo export $(pwd) readonly -eu sed ${HOME}
+test grep -eu "$@" awk && "$1" local printf export readonly "$1" /usr/bin ${HOME}
+	x=1 /usr/bin /usr/bin grep export grep readonly ${HOME}
+sed "$@" then done x=1 "$@" /usr/bin 2>/dev/null printf grep cd "$1" local
+		x=1 echo awk "$@" local readonly /usr/bin readonly 2>/dev/null
+/usr/bin awk "$@" awk readonly
+awk "$1" done done -eu grep readonly "$@" readonly x=1 x=1 export readonly
+2>/dev/null ${HOME} then 2>/dev/null cd then |
+	$(pwd) grep export -eu test x=1 |
+x=1 --verbose readonly 'quoted text' printf echo echo export
+	awk "$1" readonly "$@" echo 2>/dev/null 'quoted text' then | | export
+		"$@" 'quoted text' -eu echo then
+		sed 'quoted text' grep 2>/dev/null --verbose done readonly
+	-eu printf awk cd then then local echo
+local -eu x=1 echo readonly echo
+	printf "$@" then readonly
+&& "$@" cd 2>/dev/null sed cd awk then done | echo && x=1 local /usr/bin
+&& 2>/dev/null export cd ${HOME}
+echo then grep -eu export "$1" --verbose | -eu /usr/bin then readonly test cd
+	cd sed /usr/bin -eu printf sed $(pwd) "$1" printf then "$@" "$1" export
+then then "$@" 2>/dev/null echo cd $(pwd) done --verbose readonly /usr/bin
+		-eu x=1 printf "$@" grep test
+awk grep "$1" grep cd awk grep
+		&& && $(pwd) x=1 printf --verbose | "$@" $(pwd)
+	grep ${HOME} ${HOME} then
+2>/dev/null grep readonly 2>/dev/null && export 'quoted text'
+&& printf $(pwd) | "$@" grep ${HOME} cd cd x=1 echo -eu echo
+		${HOME} | printf done test awk grep "$@" x=1 ${HOME}
+	"$@" /usr/bin export "$1" 2>/dev/null 2>/dev/null
+		'quoted text' sed 'quoted text' grep local local test test local -eu cd done
+		$(pwd) x=1 -eu --verbose then "$@" x=1 awk ${HOME} cd local --verbose
+	"$1" printf awk readonly /usr/bin local --verbose
+		'quoted text' "$@" grep 2>/dev/null $(pwd) 'quoted text' sed
+	--verbose echo local test grep readonly 2>/dev/null "$1" -eu
+	--verbose done "$1" "$@" sed sed | | /usr/bin && 2>/dev/null
+		awk test "$@" | then /usr/bin printf -eu $(pwd) "$@"
+	"$@" --verbose local cd --verbose done 'quoted text' --verbose 2>/dev/null
+readonly test | | echo x=1 then -eu $(pwd) awk awk grep ${HOME} sed 'quoted text'
+$(pwd) /usr/bin $(pwd) done && ${HOME} sed && readonly awk --verbose cd | local
+		then test "$@" /usr/bin && $(pwd) | printf sed done 'quoted text'
+	awk -eu local 'quoted text' grep test
+		-eu local export "$1" grep 2>/dev/null $(pwd) then
+		'quoted text' then ${HOME} grep | test then -eu readonly grep sed "$@"
+echo export ${HOME} ${HOME} echo $(pwd)
+		cd ${HOME} && local sed printf awk
+	sed printf "$1" printf -eu | local export 2>/dev/null
+&& export -eu $(pwd) -eu local grep && test export
+	&& awk then | awk x=1 awk --verbose
+	printf "$1" grep --verbose 2>/dev/null local printf 2>/dev/null
+		"$1" cd | test cd "$@" && x=1 printf -eu && &&
+sed export && 2>/dev/null echo x=1
+test then local export 2>/dev/null printf /usr/bin && /usr/bin
+	${HOME} local | cd -eu /usr/bin then
+	--verbose done x=1 cd 'quoted text' "$1" "$1" export printf
+		then then then x=1 --verbose test && echo /usr/bin 'quoted text' readonly
+	'quoted text' local && grep sed readonly 'quoted text'
+then local then /usr/bin
+		$(pwd) $(pwd) 2>/dev/null && grep x=1 echo "$1" grep -eu echo echo local
+		grep awk awk "$@" done -eu -eu
+	"$@" 2>/dev/null then /usr/bin
+		cd -eu "$@" printf done | && 'quoted text' -eu awk local
+	-eu --verbose sed 2>/dev/null test | echo sed
+	x=1 --verbose awk test echo cd echo "$@"
+	--verbose $(pwd) --verbose | "$@" grep 'quoted text' |
+	sed $(pwd) x=1 'quoted text' printf && done | cd ${HOME} cd -eu x=1 ${HOME}
+${HOME} done export local /usr/bin local readonly /usr/bin echo
+x=1 printf $(pwd) && done | done done sed $(pwd) grep
+$(pwd) "$1" "$@" --verbose
+		2>/dev/null export echo printf
+sed grep sed cd "$1" awk -eu x=1 export && $(pwd) "$1" && "$1" sed | readonly
+	--verbose 'quoted text' 2>/dev/null "$@" && 'quoted text'
+readonly "$@" local -eu awk local cd local printf done
+2>/dev/null then $(pwd) export "$@" && awk export
+		${HOME} sed 2>/dev/null | $(pwd) done
+-eu echo done "$@" done x=1 sed --verbose test $(pwd) 2>/dev/null export grep -eu
+local cd readonly | grep $(pwd) --verbose x=1 --verbose 2>/dev/null done --verbose
+$(pwd) 'quoted text' ${HOME} done
+		| local done readonly | /usr/bin then test then 'quoted text'
+		done 2>/dev/null test test echo ${HOME} local x=1 cd then
+	readonly /usr/bin | -eu
+test readonly $(pwd) cd done "$@" test 'quoted text' readonly 'quoted text'
+	"$1" local test && ${HOME}
+		export local "$1" 2>/dev/null && printf 2>/dev/null 'quoted text'
+		done done | readonly readonly awk -eu
+		$(pwd) echo && sed "$1" then export "$@" ${HOME} readonly
+	-eu readonly /usr/bin --verbose local $(pwd) cd cd awk printf
+	2>/dev/null 2>/dev/null /usr/bin x=1
+	--verbose readonly "$@" 2>/dev/null | /usr/bin test local grep grep
+		export x=1 && local echo 2>/dev/null && awk 2>/dev/null | local --verbose --verbose
+		-eu test $(pwd) "$1" 2>/dev/null /usr/bin printf echo /usr/bin done printf
+	-eu 'quoted text' "$@" readonly && done "$1" x=1 grep awk -eu 'quoted text'
+"$@" 'quoted text' local
+		awk 2>/dev/null -eu cd sed sed x=1 --verbose | printf
+	--verbose "$@" /usr/bin export 'quoted text' 2>/dev/null /usr/bin && /usr/bin
+		"$@" | 2>/dev/null /usr/bin && 'quoted text' local /usr/bin "$1"
+	| | export cd cd ${HOME} cd sed printf $(pwd) x=1 --verbose done sed "$@" 'quoted text'
+	"$1" 2>/dev/null grep printf "$@" done grep local printf --verbose
+		readonly local then -eu "$@" --verbose "$1" ${HOME} "$@" echo
+	grep $(pwd) "$1" awk cd && ${HOME} --verbose 2>/dev/null 2>/dev/null
+	readonly -eu export /usr/bin readonly sed --verbose
+	/usr/bin done && done --verbose | then echo export echo export local sed
+done awk "$1" readonly | awk
+"$1" echo echo | readonly -eu grep "$@" grep "$@" done then 'quoted text'
+export 'quoted text' test --verbose | cd readonly "$@" awk readonly 2>/dev/null
+echo sed readonly readonly | sed "$1" then
+	test echo ${HOME} /usr/bin local x=1 then grep local printf "$1" printf
+printf --verbose 'quoted text' readonly grep ${HOME} $(pwd)
+export done --verbose -eu export "$@" && 2>/dev/null grep /usr/bin test
+echo ${HOME} --verbose grep local --verbose cd --verbose
+/usr/bin printf --verbose grep readonly ${HOME} then export cd "$@" $(pwd) "$@"
+$(pwd) --verbose x=1 cd | echo "$@"
+		2>/dev/null sed readonly sed echo && $(pwd)
+		sed ${HOME} "$@" printf awk done test ${HOME} printf test grep cd --verbose then
+	--verbose $(pwd) echo
+x=1 then readonly cd cd readonly
+	cd printf done --verbose $(pwd) grep "$1"
+		-eu && ${HOME} -eu done local
+&& x=1 "$1" --verbose echo echo /usr/bin --verbose $(pwd) awk "$@" $(pwd)
+echo /usr/bin readonly
+--verbose "$1" grep cd test x=1 local done grep --verbose 'quoted text' sed
+cd 'quoted text' "$1" --verbose -eu sed
+	/usr/bin cd printf -eu grep
+		then export && ${HOME} test grep sed ${HOME} export
+	echo && export "$1" awk 2>/dev/null done grep ${HOME}
+		sed x=1 local awk done grep ${HOME} awk ${HOME} local local && awk printf
+printf local | printf /usr/bin
+		"$@" /usr/bin | 'quoted text'
+		$(pwd) 2>/dev/null done
+	awk -eu 'quoted text'
+readonly --verbose && ${HOME} | /usr/bin $(pwd) -eu grep
+"$1" then grep 2>/dev/null grep 'quoted text' /usr/bin 'quoted text' 2>/dev/null
+	printf echo done cd sed "$@" readonly ${HOME} "$1" cd x=1 /usr/bin
+awk local readonly printf awk "$1" 2>/dev/null
+		| 2>/dev/null -eu --verbose
+	&& echo x=1 ${HOME} test x=1 grep done && done local -eu x=1
+		/usr/bin "$1" then 'quoted text' | awk awk local 2>/dev/null "$1" 'quoted text'
+	printf | /usr/bin --verbose awk grep export test x=1 -eu
+2>/dev/null done && grep grep -eu 'quoted text' then
+"$1" /usr/bin sed export
+"$@" && && 2>/dev/null ${HOME} echo
+'quoted text' printf then x=1 export -eu "$1" export $(pwd) -eu ${HOME} $(pwd) printf
+	echo echo /usr/bin $(pwd)
+		"$1" readonly $(pwd) -eu
+echo echo local $(pwd) && -eu then /usr/bin $(pwd) 'quoted text' readonly
+-eu && export readonly echo | done echo | /usr/bin then
+		sed local cd local cd readonly grep export test local grep
+	export grep export local then && --verbose
+2>/dev/null sed awk test --verbose sed test "$1"
+-eu sed sed then "$@" readonly "$1" printf | grep x=1 -eu echo -eu
+2>/dev/null sed --verbose then "$@" sed
+readonly x=1 --verbose then /usr/bin awk
+2>/dev/null sed 2>/dev/null ${HOME} | cd "$1" -eu readonly "$@" test sed then
+test sed | cd && | cd 2>/dev/null readonly $(pwd) sed $(pwd) /usr/bin
+	test 2>/dev/null local export
+$(pwd) readonly "$1" 2>/dev/null
+		grep grep x=1 | --verbose cd echo "$1" ${HOME}
+	grep && $(pwd) --verbose cd /usr/bin cd /usr/bin && done printf "$1"
+		awk printf | local cd local 'quoted text'
+	&& grep done && $(pwd) 2>/dev/null readonly
+		${HOME} "$1" cd x=1 /usr/bin grep 'quoted text' --verbose 'quoted text' "$1" grep
+	then sed test --verbose ${HOME} grep export
+		| awk export awk 2>/dev/null cd x=1 awk echo readonly
+		-eu && test 'quoted text'
+sed readonly grep export -eu x=1 grep "$@" local "$@"
+	x=1 awk test ${HOME} sed sed echo
+--verbose awk then then cd -eu sed "$1" && &&
+grep | -eu ${HOME} test awk 'quoted text' awk printf -eu grep
+/usr/bin test echo 'quoted text' local && awk printf
+sed then "$1" cd | && grep cd --verbose cd readonly export && test
+	x=1 "$1" grep "$1" readonly
+	readonly $(pwd) awk done "$@" $(pwd) 2>/dev/null 'quoted text' awk
+echo done echo $(pwd) cd && done x=1 -eu test
+	${HOME} echo 'quoted text' local
+		readonly cd --verbose done awk 2>/dev/null && grep $(pwd) 2>/dev/null
+		| 2>/dev/null export ${HOME} cd done ${HOME}
+		x=1 x=1 x=1 ${HOME} -eu local /usr/bin
+		"$@" export then local readonly $(pwd) echo echo printf readonly
+local /usr/bin 'quoted text' printf readonly
+	/usr/bin local 'quoted text' 'quoted text'
+		$(pwd) "$@" --verbose x=1 $(pwd) awk awk readonly --verbose
+	/usr/bin --verbose export printf | cd | echo cd -eu "$1" sed x=1 printf
+	echo ${HOME} grep readonly awk ${HOME} $(pwd)
+		/usr/bin then local grep grep /usr/bin test awk awk done then | printf
+		2>/dev/null "$@" sed sed "$1" "$@" test awk cd done printf
+		export export | export -eu done echo sed -eu "$1" &&
+/usr/bin printf 2>/dev/null echo
+	"$1" printf 2>/dev/null x=1 done echo x=1 "$@"
+--verbose 2>/dev/null local $(pwd) $(pwd) "$@" cd grep $(pwd) cd "$@" grep
+		--verbose local ${HOME} done 'quoted text'
+printf sed cd x=1 grep x=1
+		local readonly && done awk
+done 'quoted text' printf ${HOME} "$@"
+		local $(pwd) grep echo readonly cd -eu 'quoted text' cd 'quoted text' 'quoted text'
+		done 'quoted text' readonly "$@" 2>/dev/null test export 2>/dev/null printf
+echo awk -eu printf printf sed && readonly
+		printf -eu printf awk grep 'quoted text' 2>/dev/null then echo then
+		x=1 /usr/bin "$@" local done cd grep then sed echo -eu
+		${HOME} 2>/dev/null x=1 "$@" then --verbose cd sed ${HOME} $(pwd)
+		-eu /usr/bin && grep awk && awk
+	2>/dev/null | echo echo -eu then
+	awk 2>/dev/null -eu --verbose export /usr/bin x=1 ${HOME} local && --verbose
+	$(pwd) printf local ${HOME} local grep && export
+		'quoted text' $(pwd) readonly
+	echo 2>/dev/null "$@" /usr/bin readonly done
+"$1" echo test 2>/dev/null sed echo test test sed "$@" && sed echo grep "$1" cd
+	grep awk "$@" grep printf sed &&
+		local && readonly $(pwd) test x=1
+test 'quoted text' then ${HOME} sed /usr/bin then "$1" 2>/dev/null 'quoted text'
+${HOME} sed $(pwd) test local ${HOME} x=1 printf | $(pwd) sed /usr/bin readonly
+'quoted text' && cd 2>/dev/null && 'quoted text'
+	&& --verbose /usr/bin $(pwd) readonly x=1 awk -eu export printf sed && ${HOME}
+&& -eu $(pwd) echo --verbose export printf "$1" printf
+cd local then $(pwd) sed x=1 then ${HOME} local 'quoted text'
+	echo readonly 'quoted text' test echo local sed readonly -eu
+"$@" 'quoted text' $(pwd)
+		'quoted text' sed $(pwd) "$@" | "$1" "$@" echo cd
+	${HOME} local done "$@" local && $(pwd) readonly "$1" grep
+	grep --verbose && awk && ${HOME} awk 2>/dev/null readonly
+	--verbose readonly readonly cd awk ${HOME} printf "$@" done
+--verbose done "$1" "$@" echo export then readonly export
+/usr/bin echo | export x=1 export && export
+		${HOME} cd /usr/bin then 'quoted text' 2>/dev/null cd "$@" then awk
+echo "$1" done grep /usr/bin 'quoted text' -eu "$@" 'quoted text'
+test $(pwd) printf then "$1" 2>/dev/null readonly
+	&& test 'quoted text' then awk | grep $(pwd) "$1" printf && | local --verbose echo
+test printf done "$@" "$1" -eu readonly readonly sed
+		cd readonly export awk && local 'quoted text' /usr/bin export
+		--verbose local echo /usr/bin cd sed -eu 2>/dev/null
+test done 'quoted text' x=1 then test 2>/dev/null cd test "$1" grep $(pwd) 2>/dev/null
+	awk 'quoted text' cd ${HOME} echo
+2>/dev/null x=1 grep | export x=1 printf x=1
+		--verbose export 2>/dev/null export sed local awk 2>/dev/null readonly readonly
+readonly | awk 'quoted text' echo sed local readonly awk /usr/bin
+		cd awk /usr/bin --verbose ${HOME}
+2>/dev/null local grep x=1 2>/dev/null
+	'quoted text' | $(pwd) "$1" "$1" 2>/dev/null grep 'quoted text' test readonly
+		${HOME} then local local readonly "$@"
+	then /usr/bin 'quoted text' awk $(pwd) && && "$1"
+$(pwd) ${HOME} 'quoted text' done x=1 grep export
+		echo $(pwd) export test "$1" x=1 /usr/bin sed 2>/dev/null local local printf
+		readonly grep /usr/bin echo echo export -eu readonly printf $(pwd)
+	&& awk readonly x=1 -eu | 2>/dev/null cd echo
+		&& "$1" "$1" x=1 done $(pwd) 'quoted text' local then /usr/bin
+	awk sed local grep cd x=1 --verbose $(pwd) $(pwd) printf
+	test "$@" cd sed 'quoted text' local local 'quoted text' then grep && done done
+--verbose x=1 grep && awk then
+echo echo /usr/bin awk export grep $(pwd) test && x=1 echo done local /usr/bin
+"$1" 2>/dev/null printf grep $(pwd)
+	echo && printf 2>/dev/null grep && /usr/bin ${HOME} sed
+sed x=1 sed sed printf readonly
+	printf test x=1 done -eu done 2>/dev/null echo "$@" |
+grep ${HOME} 2>/dev/null "$1" ${HOME} &&
+"$@" export && -eu $(pwd) 'quoted text' sed $(pwd) grep local -eu
+	grep sed readonly test -eu awk local echo grep sed | then
+--verbose done && awk $(pwd) && then
+then -eu ${HOME} readonly
+	done 'quoted text' --verbose readonly | test cd printf echo sed readonly
+2>/dev/null echo "$@" $(pwd) "$@"
+cd done readonly "$@" 'quoted text' done --verbose echo readonly
+	$(pwd) 2>/dev/null $(pwd) --verbose && $(pwd) --verbose /usr/bin test /usr/bin
+	test $(pwd) && cd sed sed x=1 'quoted text' /usr/bin "$1" then
+export local $(pwd) done x=1 then ${HOME} $(pwd) --verbose
+		"$1" readonly -eu test
+printf 'quoted text' 2>/dev/null test "$1" && ${HOME} done readonly grep
+	test -eu ${HOME} | | sed
+	then export ${HOME} printf readonly grep grep && echo export local cd readonly
+${HOME} 'quoted text' /usr/bin echo -eu $(pwd) 'quoted text'
+	export ${HOME} ${HOME} cd
+		cd ${HOME} x=1 then printf --verbose | grep printf "$1" 'quoted text'
+2>/dev/null sed -eu echo
+export export --verbose done $(pwd)
+		readonly export /usr/bin export
+		done -eu done 'quoted text' test sed | test /usr/bin "$@" "$@"
+		'quoted text' awk --verbose local "$@" printf | export awk -eu test done
+		/usr/bin -eu local "$@" /usr/bin printf 'quoted text'
+/usr/bin cd x=1 ${HOME}
+	done grep $(pwd) test
+		awk "$1" echo | 'quoted text' 2>/dev/null then export export local -eu
+		sed /usr/bin cd "$1" then $(pwd) 'quoted text' readonly
+awk printf /usr/bin && -eu /usr/bin cd "$@" then
+	readonly "$1" readonly readonly
+		| ${HOME} "$1" test done
+awk local local "$1" readonly "$1" then test 'quoted text' printf
+		grep x=1 grep export -eu test echo cd test /usr/bin awk
+		local "$1" awk $(pwd) cd --verbose done && 2>/dev/null printf
+		printf local && local --verbose grep sed ${HOME} then done echo
+"$1" ${HOME} $(pwd) 2>/dev/null cd local then done cd readonly
+		"$@" --verbose /usr/bin awk ${HOME} awk ${HOME}
+$(pwd) printf $(pwd) grep --verbose x=1 sed && --verbose /usr/bin -eu export
+-eu readonly | 'quoted text' printf 2>/dev/null awk grep done ${HOME} echo done
+		readonly "$1" /usr/bin $(pwd) --verbose -eu "$@" export printf 2>/dev/null
+	"$@" $(pwd) printf -eu echo sed echo
+&& printf && 'quoted text' local sed sed ${HOME}
+$(pwd) -eu -eu --verbose 2>/dev/null --verbose
+		sed "$@" test sed "$1" export x=1 awk 2>/dev/null
+		readonly export then awk ${HOME} ${HOME} cd test done && x=1 sed --verbose 'quoted text'
+$(pwd) sed readonly "$@" export sed readonly $(pwd) $(pwd)
+local ${HOME} echo && /usr/bin 2>/dev/null
+	--verbose readonly grep sed 'quoted text' -eu "$@" export then then
+local "$@" 'quoted text' echo done --verbose
+		| "$@" /usr/bin echo "$@" 'quoted text' done $(pwd) $(pwd)
+	readonly /usr/bin | -eu local
+	sed cd -eu cd export /usr/bin &&
+		x=1 2>/dev/null 'quoted text' --verbose 'quoted text' "$1"
+		--verbose -eu grep export --verbose x=1 ${HOME}
+		echo -eu cd -eu sed "$@" done && local 2>/dev/null readonly
+/usr/bin readonly "$@" x=1 sed sed grep printf "$@" grep echo awk echo export
+		cd local ${HOME} /usr/bin test echo --verbose test ${HOME} awk
+		awk 2>/dev/null test printf $(pwd) awk grep ${HOME} cd /usr/bin
+		local && printf done done local
+sed && awk "$@" $(pwd) local grep test echo | | cd ${HOME} cd
+$(pwd) "$1" export "$@" -eu sed x=1 $(pwd)
+	test grep && | | /usr/bin echo
+	x=1 then ${HOME} && "$1" then cd cd $(pwd) sed && | ${HOME}
+'quoted text' local then --verbose
+		${HOME} cd test "$1"
+		x=1 --verbose test /usr/bin done sed "$@" x=1 printf grep readonly
+		&& -eu sed | "$@" -eu test --verbose $(pwd) then
+		export cd -eu then /usr/bin cd then grep -eu x=1 "$1" test 2>/dev/null
+2>/dev/null | | grep -eu
+	awk $(pwd) /usr/bin ${HOME} then /usr/bin
+"$@" readonly export 'quoted text'
+grep /usr/bin 2>/dev/null 2>/dev/null readonly 2>/dev/null
+		&& -eu readonly local done -eu
+"$1" export && -eu awk done "$@" readonly sed "$1" sed -eu --verbose
+		cd done awk x=1 local printf "$@" 2>/dev/null && sed then then /usr/bin
+	export | "$1" sed --verbose "$1" then cd --verbose "$1"
+"$@" x=1 printf echo "$@" 'quoted text' sed readonly
+'quoted text' /usr/bin
+readonly && sed 2>/dev/null 2>/dev/null 2>/dev/null $(pwd) sed /usr/bin 2>/dev/null
+readonly then awk echo ${HOME} -eu printf 'quoted text' done ${HOME} printf
+x=1 grep sed test export printf -eu x=1 ${HOME} "$@" | ${HOME} test sed
+		printf | 2>/dev/null ${HOME} x=1 "$1" && test readonly ${HOME}
+cd done ${HOME} local then /usr/bin "$@"
+	grep export -eu "$@" $(pwd) 2>/dev/null ${HOME} readonly && printf 'quoted text'
+	"$@" | /usr/bin echo export then sed 'quoted text' sed "$@" then 2>/dev/null
+	/usr/bin && sed awk local $(pwd) done cd local "$@" done cd readonly 'quoted text'
+/usr/bin printf 'quoted text'
+		then /usr/bin /usr/bin "$1" test
+		cd grep 2>/dev/null readonly readonly grep printf echo readonly
+&& | "$1" grep printf export readonly export
+	echo readonly done printf then local /usr/bin && done ${HOME}
+	"$1" grep /usr/bin test | awk local ${HOME} awk export printf done echo --verbose
+		"$1" -eu && "$1" done test readonly "$@" sed done "$1"
+2>/dev/null export cd /usr/bin test export done cd done && test $(pwd)
+		${HOME} 'quoted text' --verbose 2>/dev/null test then ${HOME} $(pwd) sed "$1"
+		then readonly $(pwd) 2>/dev/null
+		x=1 $(pwd) awk awk 2>/dev/null ${HOME} awk echo export echo
+		x=1 "$1" grep printf grep --verbose
+	"$1" sed | export -eu /usr/bin x=1 && --verbose
+export x=1 2>/dev/null local sed
+	&& test readonly grep "$1" readonly --verbose /usr/bin
+	readonly readonly | && sed
+		-eu sed printf | printf 2>/dev/null
+		$(pwd) then printf 'quoted text' then ${HOME} -eu ${HOME}
+--verbose cd sed | /usr/bin 2>/dev/null export $(pwd) readonly
+		awk sed done "$1" && test done echo readonly readonly readonly "$@"
+	x=1 done cd done cd local sed awk sed sed export
+	--verbose "$1" && test --verbose export
+	printf "$@" "$1" readonly sed -eu echo 2>/dev/null readonly --verbose local cd test
+		then printf export test local printf x=1 -eu then | "$1" printf
+	2>/dev/null 'quoted text' then awk local /usr/bin grep then local
+awk "$1" done echo then | 'quoted text'
+awk then 'quoted text' "$1" && && && 2>/dev/null
+		cd grep 2>/dev/null "$1" $(pwd) ${HOME}
+-eu /usr/bin export readonly export 2>/dev/null then
+		awk "$1" printf awk --verbose
+echo | "$1" test /usr/bin
+--verbose $(pwd) printf "$@" readonly awk readonly awk done | |
+	&& && readonly export sed $(pwd) done
+		--verbose ${HOME} /usr/bin 'quoted text' /usr/bin -eu then "$@" "$1"
+grep 2>/dev/null grep 2>/dev/null
+		2>/dev/null then "$@" test then | then export sed
+		2>/dev/null test echo awk && && "$@" done cd /usr/bin | readonly /usr/bin --verbose
+	$(pwd) cd cd x=1 echo "$1" export done cd
+		readonly done cd sed done -eu sed $(pwd) cd ${HOME} 'quoted text' done done awk
+sed -eu then echo 'quoted text' 'quoted text' awk "$1" $(pwd)
+local 2>/dev/null -eu && local printf "$1"
+		'quoted text' -eu ${HOME} cd "$1" $(pwd) "$1" -eu 2>/dev/null
+		x=1 ${HOME} $(pwd) /usr/bin sed x=1 test awk
+	readonly -eu export test ${HOME} cd | ${HOME} ${HOME} ${HOME} 2>/dev/null
+		done ${HOME} x=1 cd 'quoted text' printf && printf
+	"$@" --verbose echo x=1 cd --verbose
+2>/dev/null 2>/dev/null export export
+export readonly -eu x=1 test cd | "$1" $(pwd) done local 2>/dev/null grep
+		export 2>/dev/null /usr/bin local "$1" -eu ${HOME} then &&
+	local printf 2>/dev/null x=1 "$1" cd cd --verbose $(pwd) --verbose printf ${HOME}
+	-eu && "$@" $(pwd) cd --verbose
+		${HOME} $(pwd) local
+	x=1 export readonly export export awk
+		done -eu cd && | export printf
+	then cd awk 'quoted text' test readonly 'quoted text' grep 'quoted text'
+	--verbose done 2>/dev/null $(pwd) && test printf done
+| cd local 'quoted text' printf --verbose
+		&& "$1" ${HOME} readonly 2>/dev/null x=1 sed readonly
+	then ${HOME} echo readonly "$@" local $(pwd) "$1" -eu ${HOME} ${HOME}
+	printf $(pwd) x=1 ${HOME} readonly sed $(pwd) /usr/bin
+| then | sed "$@" then 'quoted text' sed /usr/bin
+grep "$@" readonly x=1 echo 2>/dev/null --verbose awk && x=1 echo $(pwd) then
+		/usr/bin /usr/bin -eu export x=1 -eu $(pwd) grep
+		awk printf test 'quoted text' && ${HOME} echo -eu /usr/bin --verbose
+-eu grep export ${HOME} $(pwd) --verbose then echo done cd "$1"
+readonly x=1 readonly | printf --verbose
+	"$@" test x=1 $(pwd) /usr/bin
+x=1 $(pwd) 2>/dev/null "$1" $(pwd) "$1" -eu then sed echo sed export x=1 sed
+sed then x=1 2>/dev/null echo then then local 2>/dev/null local echo 2>/dev/null
+grep $(pwd) /usr/bin local x=1 done 2>/dev/null then done "$@"
+	"$@" 'quoted text' export awk test test
+local grep x=1 echo done test ${HOME}
+		cd awk done export then sed cd 2>/dev/null --verbose echo cd /usr/bin
+	then | $(pwd) done "$1" then sed export
+		test | && "$1" printf x=1 export
+	&& $(pwd) --verbose local done then local printf --verbose 2>/dev/null
+	readonly readonly -eu --verbose && ${HOME} then /usr/bin
+		test -eu local "$1" echo cd | test then sed test grep echo | sed
+2>/dev/null export 2>/dev/null
+	$(pwd) "$@" export | $(pwd)
+printf done | export then ${HOME} grep awk cd cd 'quoted text'
+		local done 2>/dev/null
+printf && 2>/dev/null "$@" cd then test sed awk 2>/dev/null $(pwd)
+	${HOME} cd test export "$1" ${HOME} local /usr/bin x=1 printf local
+	export "$1" 'quoted text' export local printf -eu
+		export readonly --verbose done echo && test x=1 cd "$1"
+		grep echo done awk cd /usr/bin
+	"$1" $(pwd) 2>/dev/null
+	/usr/bin | test /usr/bin grep ${HOME} local done && export 2>/dev/null
+		-eu done && "$1" test "$1" ${HOME} awk | cd "$1" /usr/bin "$1" cd sed export
+		done echo | awk x=1 export export x=1
+		sed awk 2>/dev/null test ${HOME} done export export sed 2>/dev/null
+	'quoted text' then test
+"$@" echo --verbose echo -eu export
+	sed "$@" x=1 cd && "$1" cd | "$1" local "$@" cd &&
+		$(pwd) --verbose ${HOME} awk 2>/dev/null "$@" printf 2>/dev/null
+	grep 2>/dev/null readonly $(pwd) local done --verbose ${HOME} "$1" local "$1"
+	'quoted text' -eu done -eu "$1" "$1" "$1" echo "$@" --verbose
+	| "$1" && && ${HOME} test && | /usr/bin x=1 readonly grep grep grep
+		local | grep "$1" grep readonly
+$(pwd) "$@" export cd printf export echo
+		echo sed printf "$@" done
+done then -eu $(pwd) export done then echo awk
+echo 2>/dev/null 'quoted text' --verbose echo echo
+2>/dev/null awk local awk ${HOME} x=1 "$@" 2>/dev/null then awk x=1 -eu
+$(pwd) awk echo /usr/bin sed --verbose 'quoted text' test grep "$@" $(pwd) readonly
+	grep grep /usr/bin awk
+--verbose --verbose "$@" then "$@" 2>/dev/null
+| test then "$1" printf cd $(pwd) ${HOME} local readonly export -eu x=1
+		then 2>/dev/null grep 'quoted text' --verbose && /usr/bin
+		test 'quoted text' /usr/bin grep 'quoted text' "$@" "$1"
+	awk --verbose -eu printf
+"$@" readonly && --verbose x=1 then awk && printf "$1" grep 'quoted text'
+test export done printf readonly "$1" "$1" "$1" $(pwd) echo grep
+	export x=1 'quoted text' export $(pwd) cd done --verbose && x=1 && $(pwd)
+	echo printf local echo ${HOME} 'quoted text' x=1 -eu 2>/dev/null printf /usr/bin
+		/usr/bin echo x=1 echo printf grep done ${HOME} -eu echo grep then
+		readonly printf /usr/bin
+	x=1 echo && x=1 cd printf
+		test test ${HOME} 2>/dev/null sed "$1" x=1 awk x=1 ${HOME} echo
+	printf 2>/dev/null --verbose
+		${HOME} printf awk --verbose -eu
+	awk sed ${HOME} 2>/dev/null "$@" then awk sed ${HOME} sed cd
+/usr/bin "$@" x=1 --verbose -eu test
+"$1" printf "$1" $(pwd) | echo readonly echo 2>/dev/null awk sed 2>/dev/null
+${HOME} 2>/dev/null grep export --verbose done
+		'quoted text' readonly then cd /usr/bin export 'quoted text'
+		done awk cd echo && | then awk /usr/bin local /usr/bin --verbose "$@" 2>/dev/null
+test awk $(pwd) done grep -eu x=1 then export export cd "$1" echo grep grep &&
+$(pwd) then 'quoted text' "$1" awk test printf | echo ${HOME} | && $(pwd) export
+grep readonly -eu awk test readonly 2>/dev/null
+		readonly sed test $(pwd) x=1
+--verbose readonly export cd "$@" sed grep awk "$1" cd 'quoted text'
+	grep readonly --verbose test | 2>/dev/null export 2>/dev/null then
+		test test awk sed export && "$1"
+--verbose ${HOME} local
+grep sed printf 'quoted text' awk "$@" then cd --verbose then /usr/bin
+printf && export readonly | && --verbose /usr/bin test 'quoted text' x=1 'quoted text'
+		$(pwd) $(pwd) sed grep local "$@" echo "$1" echo sed
+test ${HOME} ${HOME} --verbose echo ${HOME} -eu
+-eu $(pwd) readonly x=1 local 'quoted text' | && done done then 2>/dev/null
+	awk && export export "$1" sed export grep x=1 "$1"
+		local | --verbose --verbose | 2>/dev/null
+awk "$1" "$@" $(pwd) readonly && "$1" $(pwd) done x=1 &&
+2>/dev/null "$1" ${HOME} && -eu | sed "$1" printf 'quoted text' --verbose
+		/usr/bin export 2>/dev/null /usr/bin "$@" ${HOME} echo "$@" then --verbose
+--verbose readonly printf sed "$1" done local sed awk
+	done 2>/dev/null sed 'quoted text' grep 'quoted text' grep
+grep $(pwd) && export local grep echo then
+	2>/dev/null /usr/bin then then && 2>/dev/null -eu
+		test done then sed printf done awk 'quoted text' -eu 2>/dev/null sed --verbose
+	$(pwd) echo local cd --verbose /usr/bin --verbose done ${HOME} | "$1"
+		echo grep 'quoted text' --verbose 2>/dev/null echo ${HOME} done
+awk awk "$1" -eu "$@" awk cd | --verbose test then && export sed -eu /usr/bin
+		printf local cd $(pwd) ${HOME} && 2>/dev/null /usr/bin
+	readonly awk sed readonly
+	cd x=1 'quoted text' echo test $(pwd)
+sed 2>/dev/null export grep x=1 "$@" x=1
+/usr/bin && /usr/bin $(pwd) printf awk cd | | /usr/bin grep then echo 2>/dev/null
+		sed -eu ${HOME} /usr/bin 'quoted text' "$@" 2>/dev/null -eu awk sed | -eu
+	/usr/bin then 'quoted text' x=1 2>/dev/null $(pwd) $(pwd)
+		done awk readonly x=1 x=1 x=1 -eu -eu readonly cd export /usr/bin | then echo
+		echo ${HOME} && ${HOME} then ${HOME} $(pwd) 'quoted text' done $(pwd)
+		$(pwd) x=1 local awk test printf $(pwd)
+		&& $(pwd) --verbose "$1" "$@" sed /usr/bin 2>/dev/null ${HOME}
+	'quoted text' printf done
+local "$1" 'quoted text' then then -eu test && | printf cd echo cd grep
+	${HOME} $(pwd) test readonly --verbose export
+	"$@" -eu readonly && /usr/bin 'quoted text' | /usr/bin /usr/bin 'quoted text'
+local done 2>/dev/null export
+grep "$1" -eu local printf
+2>/dev/null sed $(pwd) "$1" -eu export then then echo 2>/dev/null
+	awk grep x=1 local && 'quoted text' 2>/dev/null grep
+		then grep sed && 'quoted text' "$1" local printf
+		test -eu "$1" 'quoted text' cd /usr/bin
+cd printf | $(pwd) -eu && /usr/bin
+	'quoted text' test --verbose "$1" sed readonly 'quoted text'
+	'quoted text' x=1 done printf readonly 2>/dev/null
+		$(pwd) cd printf && "$@" /usr/bin "$1" done sed then sed grep done 2>/dev/null
+		x=1 printf ${HOME} done grep 'quoted text' awk | -eu printf grep echo
+	'quoted text' test 'quoted text' local grep x=1 "$@" awk then grep /usr/bin
+	awk echo readonly "$1" echo
+		| echo awk local -eu done readonly export
+readonly local "$@" x=1 done && awk
+	| ${HOME} $(pwd) awk --verbose test | cd x=1 && then local "$@" export $(pwd)
+		printf local export && awk 2>/dev/null 'quoted text' done test readonly 2>/dev/null
+| /usr/bin printf "$1" cd test echo readonly
+		2>/dev/null && awk $(pwd) /usr/bin cd --verbose grep -eu grep then printf
+	${HOME} 'quoted text' "$1" then 'quoted text' "$@" | awk test 2>/dev/null
+		2>/dev/null && export echo grep awk "$@" echo awk done printf
+echo then test --verbose "$@" "$1" done sed export && readonly
+readonly "$@" -eu done cd /usr/bin "$1" $(pwd)
+		&& echo local -eu ${HOME} readonly ${HOME}
+		printf sed $(pwd) done | test cd printf /usr/bin -eu --verbose
+echo && echo $(pwd) 2>/dev/null export ${HOME} ${HOME} printf cd -eu ${HOME} echo
+		--verbose sed x=1 | "$1" && /usr/bin test then then sed local test test printf
+'quoted text' done --verbose grep grep
+	awk && then 'quoted text' /usr/bin local local 'quoted text' export
+	done grep grep | sed $(pwd) --verbose awk --verbose --verbose sed "$@"
+&& 'quoted text' x=1 cd local cd x=1 x=1 cd "$@" 'quoted text'
+--verbose | printf grep cd
+then awk | grep "$1" done
+	"$@" printf echo | x=1 "$1" $(pwd) /usr/bin "$1" "$@" then printf local
+	$(pwd) grep echo done -eu "$@" "$1" | then then $(pwd) x=1
+		echo export $(pwd) --verbose
+	then then 'quoted text' then readonly echo test && grep "$@" --verbose grep |
+		&& echo -eu echo x=1 "$@" 2>/dev/null then readonly -eu 2>/dev/null test readonly
+		grep 2>/dev/null sed local && 'quoted text'
+		-eu awk done then local | awk $(pwd)
+&& grep "$1" export /usr/bin echo printf local
+local then grep ${HOME} x=1 done "$1" | echo "$@" 'quoted text'
+	| printf test local export echo cd
+	echo | $(pwd) export x=1 local ${HOME} echo "$1" export printf 2>/dev/null /usr/bin
+		sed "$1" --verbose readonly
+	sed grep printf --verbose x=1 "$@" printf
+		/usr/bin grep 'quoted text' grep export echo -eu 2>/dev/null
+		"$@" | test --verbose
+		echo readonly ${HOME} && then ${HOME} "$1" readonly grep && --verbose test grep
+export local "$@" readonly grep local printf "$@" ${HOME} cd awk local $(pwd)
+--verbose -eu done "$1" 'quoted text' -eu echo
+&& grep grep sed && echo
+	x=1 "$@" "$1" awk --verbose done export /usr/bin then grep done "$1" then then
+	cd x=1 echo awk "$@" "$1" sed && /usr/bin --verbose 2>/dev/null
+		readonly local grep then grep then 2>/dev/null readonly
+	${HOME} "$@" grep sed sed 2>/dev/null
+	&& /usr/bin ${HOME} 2>/dev/null
+		${HOME} -eu local test echo readonly -eu echo "$1" 2>/dev/null
+--verbose local readonly echo 2>/dev/null then
+	test | local "$1" echo x=1 'quoted text' && readonly
+	$(pwd) x=1 "$@" export 2>/dev/null test
+	x=1 "$1" $(pwd) local then sed cd awk then readonly
+	awk "$@" /usr/bin export printf awk "$1" "$@" done then
+echo | test readonly /usr/bin local $(pwd) $(pwd) 2>/dev/null -eu awk sed
+		export 2>/dev/null /usr/bin echo
+	x=1 x=1 x=1 then 'quoted text' 2>/dev/null export 'quoted text' --verbose
+	test && ${HOME} test --verbose $(pwd) printf readonly |
+x=1 done "$1" done "$@" -eu $(pwd) printf export done sed done readonly grep
+--verbose awk "$@" test "$@"
+cd 'quoted text' 2>/dev/null && export test /usr/bin
+local local 'quoted text' printf x=1 grep done then test readonly cd test | --verbose
+		${HOME} awk -eu then export --verbose | readonly local
+	export | /usr/bin ${HOME} 2>/dev/null printf echo echo | | 'quoted text'
+${HOME} 2>/dev/null echo "$1" 2>/dev/null then echo 2>/dev/null
+	${HOME} "$1" readonly -eu && export printf "$@" | then 2>/dev/null | done echo
+		local awk done --verbose test
+$(pwd) echo ${HOME} grep "$@" $(pwd) printf
+		export $(pwd) ${HOME} -eu --verbose
+		grep printf -eu local sed /usr/bin cd export done export "$1" --verbose
+--verbose export 2>/dev/null x=1 -eu ${HOME}
+&& "$1" cd echo cd test printf "$@" local 'quoted text' cd $(pwd) test export
+		--verbose 'quoted text' then grep /usr/bin 'quoted text' "$@" -eu printf
+		/usr/bin readonly $(pwd) awk then -eu -eu cd export awk readonly
+"$1" 2>/dev/null printf done done --verbose local
+		awk --verbose echo "$1" x=1 /usr/bin -eu -eu "$@" readonly -eu
+	&& && cd grep awk cd cd export
+	$(pwd) --verbose && "$@" "$@" | done -eu 'quoted text' printf export /usr/bin
+		test && echo --verbose && | | -eu ${HOME} printf ${HOME} x=1 grep -eu
+	done x=1 x=1 local ${HOME} 2>/dev/null | --verbose awk -eu 2>/dev/null "$1" grep
+"$1" "$1" x=1 sed -eu grep readonly grep
+--verbose && awk then grep
+	grep 'quoted text' cd
+export printf awk "$1" "$1" 2>/dev/null awk ${HOME}
+		done cd $(pwd) --verbose x=1 done 2>/dev/null
+echo then export $(pwd) awk "$@" x=1 "$@" "$1"
+"$1" $(pwd) "$1" 2>/dev/null /usr/bin --verbose local -eu then 'quoted text'
+		-eu test && readonly export "$1" --verbose then $(pwd) awk sed grep
+	echo --verbose sed x=1 | sed | "$1" echo export readonly
+done printf x=1 test grep && test $(pwd) cd 2>/dev/null readonly
+done local --verbose cd echo
+	x=1 "$1" awk local | printf /usr/bin export 2>/dev/null
+"$1" "$1" "$1" then grep then && export | cd ${HOME}
+	"$@" readonly awk ${HOME} then readonly && $(pwd)
+	--verbose test ${HOME} then readonly 'quoted text' printf readonly
+	awk sed -eu echo grep 'quoted text' readonly
+	export && /usr/bin && && export -eu 'quoted text' 2>/dev/null | ${HOME} $(pwd)
+printf echo echo then cd "$1" export ${HOME} "$@" && /usr/bin
+	export readonly $(pwd) then
+		printf "$@" 2>/dev/null awk ${HOME} awk export echo done /usr/bin
+		--verbose readonly local ${HOME} -eu -eu 2>/dev/null
+		x=1 ${HOME} sed 2>/dev/null && 2>/dev/null grep sed then sed printf
+--verbose ${HOME} echo test echo x=1 local
+printf 2>/dev/null /usr/bin "$1" 'quoted text' 2>/dev/null
+		sed awk "$1" /usr/bin done $(pwd) test then | "$1" 2>/dev/null
+done done then cd /usr/bin "$1" then printf "$1"
+		-eu | echo --verbose awk "$1" 2>/dev/null awk --verbose ${HOME}
+local readonly "$@" | grep | 'quoted text' $(pwd)
+	x=1 ${HOME} awk 2>/dev/null test printf local export grep
+		/usr/bin test --verbose done x=1 2>/dev/null awk local "$@" awk echo
+x=1 --verbose 2>/dev/null 2>/dev/null "$1" | "$@" local readonly awk ${HOME}
+	readonly 'quoted text' -eu export export then readonly
+	sed "$@" readonly ${HOME} echo 'quoted text' done
+"$1" readonly | 'quoted text' ${HOME}
+	grep ${HOME} ${HOME} grep /usr/bin sed
+		&& cd | $(pwd) ${HOME} -eu | local readonly
+	2>/dev/null 'quoted text' awk && test --verbose local "$1"
+	"$@" $(pwd) then "$1" && x=1 test && 'quoted text' -eu &&
+		test "$1" --verbose then cd awk readonly sed
+		done 'quoted text' grep done 2>/dev/null -eu "$@" test ${HOME}
+		| -eu --verbose printf x=1 sed local -eu && grep "$@" readonly
+		readonly echo printf then "$@"
+	${HOME} readonly then awk /usr/bin --verbose --verbose cd 'quoted text' test 'quoted text'
+		awk grep export done test ${HOME} x=1 2>/dev/null printf | then awk $(pwd) ${HOME}
+test printf x=1 && readonly echo --verbose awk done local -eu done 2>/dev/null
+echo export 2>/dev/null echo sed
+		grep local x=1 test /usr/bin
+"$@" local x=1 grep ${HOME}
+		"$@" "$1" export awk done
+		grep $(pwd) export then local echo
+sed readonly 2>/dev/null printf done printf --verbose
+		sed export readonly then echo $(pwd) x=1 printf $(pwd) awk
+	readonly grep local ${HOME} cd printf
+		echo echo cd -eu local sed --verbose /usr/bin printf grep "$1" grep
+test grep sed && /usr/bin printf -eu "$1"
+	x=1 2>/dev/null 'quoted text' && && -eu test
+	2>/dev/null && && cd readonly x=1 awk /usr/bin 'quoted text'
+	/usr/bin sed && readonly test 'quoted text'
+--verbose readonly awk cd export ${HOME} x=1 readonly readonly -eu awk
+2>/dev/null 2>/dev/null /usr/bin | grep awk 'quoted text'
+		local 2>/dev/null local && -eu export export "$@" readonly
+	&& -eu export export -eu x=1 done done --verbose export test /usr/bin awk
+	x=1 done "$@" export awk |
+		grep 'quoted text' cd && awk 2>/dev/null $(pwd) local "$1" $(pwd) && done readonly
+		-eu sed 'quoted text' readonly grep "$@" --verbose
+readonly then cd "$@" x=1 cd printf export "$1" "$@" "$@" readonly --verbose
+		'quoted text' | grep "$@" awk awk local grep
+| done /usr/bin echo readonly $(pwd) printf printf
+then test test /usr/bin --verbose 2>/dev/null awk "$1" printf
+'quoted text' export cd /usr/bin then local awk ${HOME} --verbose
+	| "$1" -eu done done awk $(pwd) && "$1" && 2>/dev/null
+| then --verbose readonly -eu && $(pwd) "$@" sed sed printf
+		"$@" printf readonly -eu echo awk "$1" --verbose $(pwd) export printf "$@"
+readonly | grep 'quoted text' 2>/dev/null
+		done --verbose export
+	awk $(pwd) export "$1" local /usr/bin ${HOME} echo $(pwd)
+/usr/bin export /usr/bin 'quoted text'
+| | x=1 then test export grep then echo --verbose
+	grep echo local | ${HOME} -eu 'quoted text' grep x=1 cd -eu then cd done awk |
+/usr/bin awk ${HOME} $(pwd) grep -eu "$1" readonly
+	printf sed $(pwd) 2>/dev/null then x=1 $(pwd) sed
+-eu && -eu readonly 'quoted text' 'quoted text'
+	echo printf 'quoted text'
+sed then 2>/dev/null local $(pwd) "$1" cd printf 2>/dev/null
+		"$1" | export x=1 then test -eu printf 2>/dev/null --verbose sed test awk
+	printf grep "$1" done "$@" echo printf cd sed x=1 --verbose sed 'quoted text'
+	sed x=1 sed ${HOME} printf then 2>/dev/null printf cd grep &&
+	$(pwd) --verbose export readonly grep sed test x=1 sed && sed
+| local 'quoted text' readonly "$1" awk test /usr/bin printf ${HOME} test echo
+		"$1" 2>/dev/null "$@" --verbose "$@" awk --verbose /usr/bin awk 'quoted text'
+		--verbose export awk "$1" | ${HOME} cd echo grep
+-eu done grep printf grep grep "$1" -eu grep sed done /usr/bin "$1" local
+	test ${HOME} done grep --verbose printf
+grep "$@" $(pwd) readonly local export /usr/bin test sed 2>/dev/null
+	-eu $(pwd) | then $(pwd) | -eu $(pwd) readonly $(pwd) cd "$@" echo
+		'quoted text' $(pwd) "$@" /usr/bin --verbose
+		awk | awk ${HOME} /usr/bin "$@" -eu | x=1 export -eu local "$@" -eu local "$1"
+printf done 2>/dev/null
+	awk readonly ${HOME} export 2>/dev/null
+--verbose $(pwd) export cd printf awk x=1 export grep
+echo ${HOME} "$@" grep printf done /usr/bin printf
+		'quoted text' x=1 | $(pwd) | awk "$1" && grep printf 'quoted text'
+	| echo -eu /usr/bin readonly
+	cd readonly --verbose readonly
+		--verbose echo $(pwd) 2>/dev/null done 'quoted text' "$@" readonly $(pwd)
+		local echo awk && x=1 x=1 "$@" local
+		then -eu -eu ${HOME} 'quoted text'
+	--verbose test && $(pwd) sed
+	then printf awk printf | 'quoted text'
+awk x=1 export "$1" --verbose 'quoted text' | 'quoted text' export grep echo x=1
+	test awk grep cd then grep /usr/bin ${HOME} sed done
+test awk "$1" done | export
+	echo local echo 'quoted text' printf "$1" cd 2>/dev/null done local test "$@"
+		test awk then then -eu --verbose awk $(pwd) ${HOME} ${HOME} done $(pwd) grep ${HOME}
+	sed done $(pwd) /usr/bin done then printf
+	"$1" /usr/bin 'quoted text' awk && /usr/bin sed
+printf && ${HOME} done awk | printf x=1
+2>/dev/null /usr/bin $(pwd) awk awk
+2>/dev/null echo -eu | echo cd |
+		test | "$1" "$1" echo ${HOME} cd local && -eu && printf 2>/dev/null
+		--verbose /usr/bin then awk $(pwd) /usr/bin /usr/bin printf local export test
+		then export cd readonly "$@" awk "$@" awk cd "$1" local
+		sed test export grep cd readonly $(pwd) grep then local grep $(pwd) -eu |
+	grep /usr/bin 'quoted text' readonly test then printf printf $(pwd) done && x=1
+		2>/dev/null echo grep /usr/bin "$@" grep grep
+		-eu done grep cd $(pwd)
+readonly sed readonly sed x=1 -eu --verbose
+/usr/bin readonly export "$1" done 'quoted text' grep x=1 -eu "$@"
+		&& done "$1" done local && /usr/bin then
+${HOME} "$1" -eu 'quoted text'
+printf printf -eu --verbose sed
+$(pwd) printf grep --verbose /usr/bin | | 'quoted text' test then
+		/usr/bin $(pwd) "$1" $(pwd) | /usr/bin $(pwd) echo ${HOME}
+	'quoted text' $(pwd) ${HOME} then | local "$@" echo test /usr/bin
+		printf test export then $(pwd) readonly 'quoted text' $(pwd) $(pwd) --verbose
+sed test cd 'quoted text' $(pwd) --verbose local then 'quoted text' test printf
+"$@" grep "$@" 'quoted text' done then x=1 awk printf 'quoted text' "$1" printf
+	'quoted text' "$@" done ${HOME} $(pwd) export -eu 2>/dev/null
+		/usr/bin && 2>/dev/null 2>/dev/null
+	echo ${HOME} cd awk x=1 ${HOME} local sed cd /usr/bin export "$1" -eu
+		grep printf | done -eu sed awk test test "$@"
+	$(pwd) --verbose test x=1 done
+	grep readonly printf 'quoted text' $(pwd) 2>/dev/null x=1 local printf
+		local --verbose grep 'quoted text' $(pwd) /usr/bin -eu readonly 2>/dev/null $(pwd)
+		/usr/bin grep sed sed 2>/dev/null then /usr/bin grep $(pwd) sed sed "$1"
+| grep /usr/bin "$@" cd then local ${HOME} printf --verbose
+	grep x=1 local /usr/bin echo x=1 local grep
+	local test --verbose 'quoted text'
+	--verbose export && cd $(pwd) export
+	--verbose ${HOME} | "$@" printf | cd grep 2>/dev/null 'quoted text'
+	done awk export ${HOME} && grep grep 2>/dev/null
+	x=1 done | grep 2>/dev/null x=1 'quoted text' echo echo sed && export
+${HOME} | 'quoted text' "$1" && 2>/dev/null "$1" "$1" grep && test
+		-eu x=1 awk /usr/bin awk grep done test "$1" cd && ${HOME} readonly
+	'quoted text' -eu | export
+| "$@" done -eu sed export 2>/dev/null ${HOME} "$@" /usr/bin then /usr/bin
+	test /usr/bin grep export cd test --verbose "$1" printf awk $(pwd) test test
+		/usr/bin done test -eu awk -eu | "$@" ${HOME} awk "$@" "$@"
+grep then 2>/dev/null echo grep sed awk "$1" 2>/dev/null
+		printf "$1" readonly then "$@" 'quoted text' cd x=1 x=1 2>/dev/null
+	2>/dev/null ${HOME} cd awk cd | sed && then
+		${HOME} "$@" --verbose readonly 'quoted text' local "$1"
+		export printf then && ${HOME} "$@" | sed 2>/dev/null echo ${HOME}
+awk local awk -eu "$1" "$1" /usr/bin /usr/bin 2>/dev/null "$@" 'quoted text'
+	${HOME} x=1 grep test awk echo x=1 'quoted text'
+		--verbose echo -eu export
+	'quoted text' local "$@" readonly local /usr/bin sed grep readonly
+test -eu sed test cd 2>/dev/null echo done x=1 "$@"
+	x=1 local --verbose "$1" ${HOME} "$1" awk "$@" done local
+x=1 awk 'quoted text' local --verbose done 'quoted text'
+&& -eu grep local -eu "$1" export /usr/bin grep done /usr/bin export printf 'quoted text'
+	| awk awk -eu "$1" then grep 2>/dev/null 'quoted text' ${HOME} grep done && |
+/usr/bin ${HOME} local printf "$1" export
+	grep ${HOME} x=1 test readonly then sed
+		--verbose ${HOME} "$1" x=1 then cd /usr/bin "$1"
+	-eu | sed printf --verbose readonly --verbose sed ${HOME} x=1 "$1"
+local && export -eu printf x=1 | cd local then
+	echo local ${HOME} "$@" -eu then printf $(pwd) | readonly local done readonly
+x=1 sed printf echo export 2>/dev/null ${HOME} grep "$@" --verbose
+export $(pwd) echo cd /usr/bin -eu export
+		then local "$1" sed /usr/bin /usr/bin && | sed -eu | $(pwd) echo export local "$1"
+local local then printf | -eu 2>/dev/null "$@" -eu readonly readonly | 2>/dev/null
+/usr/bin 'quoted text' -eu readonly -eu | x=1 done --verbose
+echo | | sed local then | test cd "$@" "$@" $(pwd) && grep test -eu "$@"
+	/usr/bin readonly -eu echo then printf 'quoted text' --verbose
+"$1" sed x=1 | printf 'quoted text' readonly
+	test done cd && cd test "$1" sed $(pwd) export export --verbose
+-eu /usr/bin "$1" /usr/bin readonly done "$1" $(pwd) $(pwd) x=1 local
+		&& 2>/dev/null $(pwd) && awk | -eu && cd sed $(pwd) then &&
+-eu /usr/bin echo test export && "$@" "$1"
+		--verbose grep grep grep x=1
+	"$@" 2>/dev/null awk | cd | "$1" printf "$1" then then "$@" $(pwd) done "$1"
+'quoted text' readonly /usr/bin
+test then local awk x=1 export then cd sed sed 'quoted text' echo "$@" sed echo
+x=1 && readonly readonly x=1 echo $(pwd) readonly readonly export
+${HOME} && | 2>/dev/null /usr/bin printf awk
+	readonly --verbose export
+		/usr/bin cd | x=1 "$1" /usr/bin echo x=1 $(pwd) 2>/dev/null echo
+	sed cd sed x=1 export readonly then -eu grep
+&& export && test -eu 2>/dev/null
+		done "$@" awk --verbose
+test --verbose | && echo readonly ${HOME} echo && sed --verbose awk
+	"$1" 'quoted text' printf
+	$(pwd) cd && cd "$1" /usr/bin then
+	x=1 test sed "$1" 2>/dev/null local grep sed | grep --verbose
+cd x=1 ${HOME} /usr/bin then |
+done 'quoted text' "$1" sed
+	/usr/bin then x=1 test 'quoted text'
+$(pwd) printf x=1 /usr/bin 2>/dev/null
+-eu test 'quoted text' "$1" -eu echo ${HOME} cd
+"$@" -eu 2>/dev/null local then local /usr/bin
+		done | "$1" local awk readonly 2>/dev/null awk --verbose /usr/bin
+		done awk x=1 'quoted text' 'quoted text'
+	| readonly 'quoted text' | "$@" awk "$1" echo 'quoted text' done
+--verbose grep echo export
+&& | done export /usr/bin 2>/dev/null grep | awk 2>/dev/null 'quoted text'
+echo test 'quoted text' && -eu local done
+	then && then | printf local && 2>/dev/null grep "$@" awk sed --verbose
+sed | /usr/bin export echo "$@" echo then -eu -eu -eu && cd test
+	done then -eu export echo test --verbose cd | /usr/bin 2>/dev/null
+	grep -eu ${HOME} sed awk sed local awk sed && readonly
+	x=1 export sed echo export grep
+		done awk ${HOME} echo test 'quoted text' done && readonly
+done --verbose done -eu then $(pwd)
+	test echo test /usr/bin $(pwd) x=1 | echo -eu readonly
+	echo done | "$@" /usr/bin 2>/dev/null 2>/dev/null
+		local 'quoted text' 'quoted text' awk x=1 2>/dev/null cd done awk test
+x=1 && "$@" --verbose grep /usr/bin "$@" done
+test then x=1 printf /usr/bin "$1" $(pwd) /usr/bin awk x=1 'quoted text'
+&& local done -eu "$@" ${HOME} ${HOME} && 'quoted text'
+		/usr/bin test && echo "$@" $(pwd) 2>/dev/null grep /usr/bin /usr/bin 2>/dev/null
+		echo local -eu ${HOME} readonly &&
+readonly echo local "$@" "$@" "$@"
+	${HOME} 2>/dev/null done test ${HOME} cd 'quoted text'
+test grep readonly then "$@" x=1 $(pwd) 2>/dev/null
+	readonly "$1" x=1 && $(pwd) done awk then readonly
+		local "$1" 'quoted text' -eu echo --verbose test "$1" local 'quoted text' awk cd
+-eu export sed 'quoted text' cd local $(pwd) then then done ${HOME}
+		$(pwd) readonly --verbose readonly "$1" -eu ${HOME} "$@" awk ${HOME}
+		cd printf $(pwd) done $(pwd)
+	done "$@" export && local echo done ${HOME} cd 2>/dev/null sed readonly
+test --verbose readonly "$1" awk
+	printf ${HOME} export cd readonly --verbose
+readonly $(pwd) cd test cd grep -eu readonly readonly echo export "$1" $(pwd)
+readonly then grep "$@" -eu $(pwd) local x=1 test awk --verbose
+2>/dev/null grep && grep 2>/dev/null ${HOME}
+printf $(pwd) "$1" ${HOME} && export printf &&
+		"$@" x=1 then export $(pwd) grep done "$1" 2>/dev/null readonly
+		x=1 x=1 then $(pwd) 'quoted text' local done done printf local && done
+	$(pwd) readonly cd awk echo
+	&& printf grep "$1" export "$@" done --verbose printf | /usr/bin
+	$(pwd) && "$@" --verbose grep local grep echo "$1" sed done cd "$1"
+/usr/bin "$1" test 2>/dev/null 2>/dev/null test && then 'quoted text' && "$1"
+	${HOME} "$1" echo "$@" printf
+	awk --verbose | test "$@" x=1 sed 'quoted text' && awk ${HOME}
+		export printf grep local 'quoted text' 2>/dev/null
+	local then done echo sed sed cd && && /usr/bin --verbose --verbose
+		then export echo 'quoted text' echo "$@" done then -eu printf awk "$1"
+| | grep local "$1" | cd 'quoted text' 2>/dev/null "$1" /usr/bin -eu
+	'quoted text' printf 'quoted text' done test 'quoted text' local cd /usr/bin x=1
+		$(pwd) grep ${HOME} /usr/bin sed && printf 'quoted text' echo
+	grep local 2>/dev/null 2>/dev/null grep
+	local local cd printf && then 'quoted text'
+	readonly "$1" /usr/bin && "$1" -eu grep 2>/dev/null
+	echo x=1 then awk "$1" test local
+	readonly sed local local && && echo "$@" "$@" test printf -eu done
+2>/dev/null grep 'quoted text' awk test sed grep test $(pwd) x=1 export
+		/usr/bin 'quoted text' echo -eu -eu export ${HOME}
+		/usr/bin cd | -eu cd printf then sed sed awk
+		readonly 2>/dev/null cd test awk printf 'quoted text'
+then 2>/dev/null x=1 "$1" echo then "$1" done sed "$1" echo
+cd && x=1 ${HOME} printf 'quoted text' awk cd "$@" then cd echo "$@" test printf
+	then --verbose "$@" sed grep $(pwd) | grep -eu 2>/dev/null
+x=1 sed readonly ${HOME} cd grep
+		cd cd then && ${HOME} cd export ${HOME} 2>/dev/null 2>/dev/null
+	'quoted text' done local && awk test readonly readonly "$@" readonly
+x=1 ${HOME} 2>/dev/null 'quoted text'
+	"$1" | printf 'quoted text' sed local "$@" cd readonly export
+	/usr/bin x=1 && && 'quoted text'
+"$@" /usr/bin "$@" | 2>/dev/null /usr/bin && | readonly sed awk
+	"$@" --verbose ${HOME} awk local x=1 && grep "$@" echo 2>/dev/null
+	| test "$1" "$1" x=1 echo && local
+	${HOME} echo cd 2>/dev/null test | then
+		"$@" awk awk /usr/bin local done printf "$@" $(pwd) grep ${HOME} awk
+${HOME} 2>/dev/null done $(pwd)
+		done | | then cd sed "$1" $(pwd)
+		'quoted text' "$@" done /usr/bin $(pwd) test cd ${HOME}
+	local grep "$@" ${HOME} test grep && && $(pwd)
+	sed grep printf echo x=1 done ${HOME} test ${HOME} test readonly |
+| 2>/dev/null printf test -eu -eu /usr/bin test x=1 printf ${HOME}
+	echo done printf echo readonly 'quoted text' done && ${HOME}
+		sed done printf -eu | grep $(pwd) test 2>/dev/null readonly then
+	then -eu x=1 "$@" x=1 grep test -eu && then --verbose done
+		grep test done "$@" /usr/bin && ${HOME} readonly
+--verbose 2>/dev/null | readonly test x=1 done --verbose /usr/bin echo readonly
+${HOME} done export then 'quoted text' echo sed done | | printf
+		printf | $(pwd) /usr/bin ${HOME} && $(pwd) echo 2>/dev/null
+	${HOME} "$1" "$@" awk 2>/dev/null "$@" && done x=1 $(pwd) done 'quoted text'
+		grep cd readonly test echo readonly "$1" 'quoted text'
+		then $(pwd) /usr/bin cd cd printf /usr/bin
+		--verbose "$1" readonly local test 'quoted text' local
+		-eu readonly echo done | done done -eu grep echo
+"$@" export done "$1" sed test $(pwd) "$1" 2>/dev/null
+"$@" && x=1 awk ${HOME}
+	local --verbose | test then /usr/bin export 2>/dev/null /usr/bin 2>/dev/null
+	echo test grep echo export $(pwd) 2>/dev/null
+		${HOME} printf ${HOME} printf awk sed ${HOME} "$@" echo readonly export done grep
+${HOME} test printf echo done --verbose --verbose done "$@" 2>/dev/null
+x=1 "$@" "$@" 2>/dev/null then done x=1 2>/dev/null
+--verbose grep 2>/dev/null "$@" && 2>/dev/null "$@" "$1"
+	awk cd /usr/bin $(pwd) test local
+		"$@" | then | echo sed printf then done "$@" then -eu --verbose awk x=1 $(pwd)
+		then "$@" export $(pwd) -eu grep done 2>/dev/null -eu -eu --verbose "$@"
+	'quoted text' sed printf sed local --verbose
+	/usr/bin 'quoted text' echo local then awk ${HOME} x=1 && printf &&
+done echo echo 2>/dev/null
+	export local 2>/dev/null | sed export grep sed 2>/dev/null then
+		x=1 2>/dev/null 2>/dev/null then local --verbose -eu /usr/bin local /usr/bin
+awk cd "$@" readonly awk "$@" test --verbose && sed -eu test
+	"$@" local 2>/dev/null "$@" cd | ${HOME} grep $(pwd) && | "$@" -eu test readonly
+	/usr/bin done test cd 'quoted text' | x=1 done cd awk
+-eu readonly then "$@" 'quoted text' "$@" ${HOME} done readonly --verbose cd
+	sed && then cd x=1 cd
+		export "$1" grep then x=1 2>/dev/null local "$@" -eu
+		echo printf -eu 2>/dev/null echo | then x=1 local 2>/dev/null
+${HOME} ${HOME} local | echo export
+		sed ${HOME} cd $(pwd) readonly
+		readonly 'quoted text' $(pwd) | --verbose "$1" echo
+done $(pwd) readonly /usr/bin --verbose 2>/dev/null
+"$1" readonly test awk cd sed awk ${HOME} ${HOME} grep printf then -eu printf "$@"
+	&& test cd sed && 'quoted text'
+		sed then then cd echo test done then grep then echo --verbose
+		-eu --verbose local sed export sed echo
+		$(pwd) export awk 2>/dev/null "$1"
+		&& ${HOME} awk ${HOME} | -eu sed | /usr/bin grep readonly --verbose then
+&& export x=1 echo sed
+/usr/bin -eu 2>/dev/null 2>/dev/null 2>/dev/null echo /usr/bin
+		cd grep done x=1 -eu awk
+${HOME} && "$@" local local $(pwd) awk 2>/dev/null cd
+		${HOME} done test x=1 readonly --verbose export --verbose sed sed $(pwd) printf
+readonly test readonly grep
+sed local $(pwd) /usr/bin sed 2>/dev/null test test
+test --verbose x=1 readonly printf local readonly 2>/dev/null
+	local cd grep "$1" then && 'quoted text' echo "$@" printf export
+${HOME} /usr/bin 2>/dev/null then
+		-eu 'quoted text' echo
+$(pwd) cd -eu 2>/dev/null
+"$1" x=1 x=1 $(pwd) ${HOME}
+		cd local /usr/bin printf then "$1" done test sed
+	local x=1 readonly export export sed echo test "$1" awk sed grep test
+sed printf cd grep done echo done /usr/bin
+awk -eu --verbose "$1" export then then 2>/dev/null 2>/dev/null
+'quoted text' local readonly 'quoted text' export /usr/bin 2>/dev/null then printf
+	'quoted text' cd | /usr/bin -eu
+	export 'quoted text' --verbose -eu
+	&& x=1 $(pwd) then export
+	--verbose -eu awk /usr/bin done 2>/dev/null
+	sed local done printf
+		awk --verbose then test local done awk 2>/dev/null "$@" -eu local
+		&& | /usr/bin /usr/bin printf ${HOME} "$1"
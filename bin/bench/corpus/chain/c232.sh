@@ -0,0 +1,2001 @@
+/usr/bin test $(pwd) printf | awk 'quoted text'
+		/usr/bin | -eu x=1 test "$@" /usr/bin then awk printf export 'quoted text' test
+		done -eu && /usr/bin "$1" readonly sed ${HOME}
+		'quoted text' cd 2>/dev/null "$1" export then local
+${HOME} $(pwd) awk local done export
+	grep awk ${HOME} local $(pwd) /usr/bin x=1 ${HOME} x=1 x=1 && "$1" grep /usr/bin
+		printf 'quoted text' $(pwd) /usr/bin cd export $(pwd)
+	| local then printf local && test -eu && done echo export | 'quoted text' && "$1"
+		2>/dev/null ${HOME} readonly $(pwd) /usr/bin --verbose export readonly awk local
+| x=1 'quoted text' -eu printf awk sed then x=1 grep sed export done /usr/bin /usr/bin
+	awk readonly x=1 'quoted text' x=1 --verbose
+echo /usr/bin | "$@" cd then cd /usr/bin then /usr/bin sed
+test --verbose | export x=1 test printf
+$(pwd) /usr/bin echo 2>/dev/null readonly 2>/dev/null
+-eu "$1" | then then local 'quoted text'
+		local /usr/bin test readonly local then 'quoted text' 'quoted text' export echo
+${HOME} cd | then then ${HOME} && awk then echo sed cd
+		"$1" echo "$@" -eu 2>/dev/null "$1" awk x=1 awk x=1 | 2>/dev/null
+/usr/bin 2>/dev/null x=1 then /usr/bin local export 2>/dev/null 'quoted text'
+	then cd | export ${HOME} "$1" test 2>/dev/null 2>/dev/null 2>/dev/null && -eu
+	printf echo 2>/dev/null "$1" && /usr/bin "$@" cd done /usr/bin 'quoted text'
+		test sed awk printf 'quoted text' local "$@" grep readonly
+sed test | grep 2>/dev/null
+"$1" --verbose /usr/bin local export grep --verbose 'quoted text' printf cd
+		/usr/bin 'quoted text' sed | -eu export ${HOME} "$@" echo export 2>/dev/null
+		--verbose "$1" test echo
+local ${HOME} sed echo "$1" ${HOME} sed awk echo then "$@" grep
+2>/dev/null ${HOME} export --verbose && test && sed done
+/usr/bin && then /usr/bin 'quoted text' /usr/bin 'quoted text'
+	awk 'quoted text' | export done export | x=1
+${HOME} "$1" readonly 2>/dev/null export | -eu local export readonly then test
+		echo 'quoted text' ${HOME} local 'quoted text' test /usr/bin ${HOME}
+	"$@" ${HOME} "$1" done /usr/bin | awk | readonly echo echo
+	--verbose $(pwd) done && local export
+		2>/dev/null /usr/bin grep sed -eu && x=1 -eu ${HOME} done 'quoted text'
+		local ${HOME} readonly
+	x=1 | --verbose && cd -eu grep test cd readonly && ${HOME}
+awk done 2>/dev/null ${HOME} printf && "$@"
+	x=1 /usr/bin cd awk then
+cd awk x=1 'quoted text' -eu done --verbose x=1 awk
+then export ${HOME} && readonly -eu test
+		-eu then printf 'quoted text'
+	readonly export 2>/dev/null echo
+	2>/dev/null && | printf && --verbose --verbose local echo readonly
+		-eu sed awk 2>/dev/null 2>/dev/null
+		&& test | -eu local 2>/dev/null 2>/dev/null && grep awk -eu
+"$@" -eu 2>/dev/null 'quoted text'
+		| 'quoted text' /usr/bin x=1 echo -eu x=1 export --verbose x=1 | readonly x=1
+printf test && --verbose 'quoted text' && grep readonly
+/usr/bin 'quoted text' export grep grep printf 'quoted text'
+export $(pwd) $(pwd) "$1" --verbose --verbose
+| awk test x=1 printf then | sed local awk $(pwd)
+	${HOME} ${HOME} --verbose "$1" grep "$1" test && ${HOME} local
+	printf export "$@" export
+"$1" export grep $(pwd) 'quoted text' "$@" readonly
+		done /usr/bin cd ${HOME} 'quoted text' cd
+		"$@" "$@" echo x=1 -eu $(pwd)
+	then $(pwd) done echo done sed test x=1
+		"$1" test echo $(pwd) sed | --verbose "$@" | grep echo done
+&& done echo --verbose $(pwd) 2>/dev/null
+	-eu done export grep "$1" printf local ${HOME} then /usr/bin
+		"$@" /usr/bin "$@" then --verbose
+	"$@" "$1" --verbose --verbose "$1" -eu then grep --verbose
+	echo printf cd printf cd 2>/dev/null then | cd export
+		local done cd grep echo | ${HOME} export awk readonly 'quoted text' done
+	--verbose $(pwd) echo 2>/dev/null
+		--verbose 2>/dev/null 'quoted text' cd 2>/dev/null x=1 cd 2>/dev/null
+		/usr/bin grep echo --verbose /usr/bin cd local grep export
+		grep done done export ${HOME} sed readonly --verbose
+	'quoted text' export "$@" printf
+	export | --verbose && && && printf /usr/bin test printf local done done /usr/bin
+		"$1" done sed then | readonly "$1" /usr/bin $(pwd) "$1" readonly
+-eu "$@" readonly /usr/bin 'quoted text' "$1" awk
+	awk --verbose --verbose test then | "$@" export --verbose cd sed local
+		-eu "$@" "$1" printf 'quoted text' local export test x=1 x=1
+	local && awk test then test local --verbose && x=1
+done echo --verbose "$@" -eu | grep awk local awk ${HOME} export grep | export
+	readonly /usr/bin local 'quoted text'
+cd sed && local then then 'quoted text'
+		printf printf printf ${HOME} "$1" /usr/bin $(pwd)
+done "$1" -eu x=1 | cd cd awk export x=1 export grep $(pwd) ${HOME} done
+	'quoted text' && ${HOME} /usr/bin
+"$1" test cd && cd /usr/bin done 'quoted text'
+| readonly echo done "$1" --verbose 2>/dev/null "$@"
+		/usr/bin echo grep 2>/dev/null done grep 'quoted text'
+	'quoted text' x=1 ${HOME} readonly | local export
+	awk export $(pwd) $(pwd) done ${HOME} readonly && awk $(pwd) printf echo 'quoted text'
+		/usr/bin awk 'quoted text' "$1" local printf
+&& | awk grep "$1" 2>/dev/null "$1" --verbose awk printf awk echo $(pwd) local
+| cd echo /usr/bin then export "$1"
+	printf /usr/bin /usr/bin && readonly $(pwd) x=1 'quoted text'
+	done test --verbose --verbose
+		test grep --verbose --verbose 'quoted text'
+		/usr/bin -eu local x=1 export
+2>/dev/null cd echo test readonly grep done
+awk awk 'quoted text' 2>/dev/null -eu "$@"
+		-eu -eu echo "$@" grep then export --verbose test &&
+| -eu done ${HOME} && local "$@" sed
+"$1" x=1 $(pwd) awk cd 'quoted text' | cd ${HOME} 2>/dev/null /usr/bin 'quoted text'
+	readonly readonly echo test && $(pwd) -eu cd printf done &&
+	| echo export awk 'quoted text' export
+	local export --verbose -eu printf $(pwd) echo ${HOME} "$@" 2>/dev/null "$1"
+sed --verbose cd -eu export echo && 2>/dev/null
+		test local --verbose cd grep then
+	"$@" printf test && printf x=1
+		'quoted text' done test then "$1" export x=1 done grep "$1" local
+readonly x=1 readonly sed 2>/dev/null && 2>/dev/null
+	local test grep readonly /usr/bin local done local
+	'quoted text' sed -eu "$1" printf awk "$1" grep awk ${HOME} readonly
+	"$@" echo sed ${HOME} 'quoted text'
+$(pwd) export && then && cd --verbose | x=1 cd | --verbose then "$1" export
+		$(pwd) "$@" --verbose "$@" | printf printf
+sed local --verbose grep sed && 'quoted text' 2>/dev/null then
+	local 2>/dev/null sed --verbose
+	"$1" printf && --verbose cd grep export test export cd
+		-eu test $(pwd) then sed printf
+	done "$1" sed ${HOME} printf cd grep
+local -eu echo /usr/bin 'quoted text' export 'quoted text' -eu cd local done
+$(pwd) then "$@" $(pwd) "$1" export &&
+printf "$@" 'quoted text' awk done /usr/bin && 2>/dev/null $(pwd) "$1"
+readonly readonly done ${HOME} && x=1 local export
+	test ${HOME} readonly
+		grep local export printf cd ${HOME} printf cd | export printf "$1"
+	awk cd 2>/dev/null 2>/dev/null
+x=1 test grep test 2>/dev/null cd printf 2>/dev/null --verbose ${HOME}
+sed && "$1" ${HOME} |
+	done then x=1 'quoted text' 'quoted text' && 'quoted text' local "$1"
+'quoted text' 2>/dev/null /usr/bin -eu then "$1" local test | && readonly export
+'quoted text' | $(pwd)
+test "$1" /usr/bin /usr/bin then awk 2>/dev/null "$1" grep printf
+	2>/dev/null cd export 'quoted text'
+"$@" awk awk $(pwd) cd 2>/dev/null | awk printf cd -eu local ${HOME}
+"$@" cd | printf readonly -eu 2>/dev/null 'quoted text'
+printf | local export | --verbose
+$(pwd) done "$@" local echo local /usr/bin done && $(pwd) "$1"
+		$(pwd) export grep | $(pwd) readonly cd && --verbose "$1" local
+done ${HOME} cd | "$@" readonly "$1" readonly readonly "$1" awk then
+done -eu && -eu sed awk x=1 x=1 && --verbose
+		x=1 local then x=1 "$1" "$1" echo ${HOME} done
+/usr/bin cd -eu then --verbose done test --verbose "$1" printf sed local
+		--verbose done echo | cd $(pwd) "$1" 'quoted text'
+printf then --verbose echo | --verbose local "$@" "$@" "$1" -eu /usr/bin 'quoted text'
+		printf then export grep /usr/bin "$@" sed printf
+		sed 'quoted text' export awk --verbose readonly echo export
+		grep export ${HOME} 2>/dev/null test
+	sed 2>/dev/null test "$1" 2>/dev/null
+done 2>/dev/null "$@" grep then grep "$1" export readonly 2>/dev/null then readonly
+	cd readonly /usr/bin then
+		&& && | $(pwd) done 2>/dev/null "$@" | echo --verbose ${HOME} | 'quoted text'
+		--verbose local then &&
+	&& /usr/bin readonly readonly x=1 && cd local local $(pwd) 2>/dev/null
+		printf sed done export "$@"
+	then sed | --verbose -eu then sed $(pwd) --verbose export /usr/bin
+		readonly 2>/dev/null export
+	2>/dev/null readonly ${HOME} local local grep sed sed awk done local grep
+	printf | then then local --verbose -eu -eu -eu --verbose sed --verbose
+local grep -eu grep -eu test readonly
+"$1" test then printf "$@" "$@" ${HOME} "$@"
+/usr/bin "$1" test 2>/dev/null cd "$@" awk x=1 awk then grep test test
+		then -eu done grep sed "$@" 'quoted text' 2>/dev/null readonly export export
+/usr/bin x=1 cd | awk "$@" printf readonly 'quoted text' test
+	'quoted text' 2>/dev/null test local readonly $(pwd) then ${HOME} --verbose
+-eu cd ${HOME} awk cd 2>/dev/null grep done grep
+		local sed $(pwd) | | local export -eu ${HOME} done export sed
+printf && cd ${HOME} /usr/bin | export && local --verbose 2>/dev/null
+printf export | -eu && readonly cd
+	"$1" $(pwd) 2>/dev/null readonly then cd
+grep -eu "$@" awk | local x=1 x=1 sed
+--verbose $(pwd) "$1" export readonly -eu cd awk $(pwd) sed test 2>/dev/null
+	2>/dev/null then "$1" 2>/dev/null
+echo export cd test export readonly test
+		sed -eu readonly "$@" 2>/dev/null
+2>/dev/null --verbose "$@" awk echo test "$1" printf local --verbose
+local then "$1" awk sed sed cd then &&
+		echo sed echo $(pwd) /usr/bin 'quoted text'
+	$(pwd) $(pwd) then local $(pwd) echo "$@" test readonly
+$(pwd) -eu test --verbose | | sed
+	'quoted text' cd grep
+	2>/dev/null "$1" cd echo "$1" then
+grep ${HOME} x=1 export sed awk $(pwd) $(pwd)
+	grep sed readonly local readonly 2>/dev/null /usr/bin "$1" "$1" | sed
+		echo export "$@" readonly /usr/bin local $(pwd)
+		&& awk ${HOME} x=1 grep "$@" echo echo "$1" --verbose
+		"$@" readonly echo sed | echo test grep "$@" sed cd /usr/bin
+	"$1" local "$@" && -eu grep
+"$1" cd awk x=1 printf ${HOME}
+local awk "$@" local sed done && printf awk awk "$@" && 'quoted text'
+	export | x=1 awk local echo printf test sed /usr/bin
+		local /usr/bin x=1 | grep readonly readonly grep
+sed 2>/dev/null | ${HOME} -eu cd test "$@" -eu | --verbose 'quoted text'
+	2>/dev/null grep done
+	| sed "$1" test local 'quoted text' x=1 cd x=1 readonly
+	2>/dev/null | echo 'quoted text'
+	echo local sed 2>/dev/null export "$1"
+	then export echo done ${HOME} --verbose awk -eu -eu printf export
+	cd sed awk echo 'quoted text' then ${HOME} readonly awk 'quoted text'
+		awk awk grep readonly /usr/bin --verbose awk
+		${HOME} --verbose test then
+done done echo && local local --verbose && /usr/bin x=1
+readonly $(pwd) done local "$@" -eu done x=1 awk echo awk then
+	"$@" local grep done done echo $(pwd) --verbose grep
+-eu "$@" sed $(pwd) x=1 export ${HOME} 2>/dev/null printf
+	readonly cd --verbose done 'quoted text' && cd ${HOME} test $(pwd)
+awk | | 'quoted text' 'quoted text' /usr/bin done 'quoted text' sed
+		local printf -eu awk 'quoted text' ${HOME} |
+echo -eu local printf done ${HOME} echo export grep
+sed | /usr/bin done echo /usr/bin awk test 2>/dev/null 'quoted text'
+		"$1" done printf done x=1 -eu | readonly
+export readonly -eu "$@" "$@" -eu -eu 2>/dev/null export awk $(pwd) ${HOME} printf
+		${HOME} awk awk --verbose --verbose
+		"$@" export test x=1 echo ${HOME} grep then 2>/dev/null sed readonly 'quoted text'
+		cd awk /usr/bin cd "$@" echo cd export 'quoted text' 2>/dev/null
+	awk ${HOME} $(pwd) export then -eu "$@" done 2>/dev/null 'quoted text' /usr/bin
+	grep export | 'quoted text' $(pwd) "$@"
+	local echo "$@" | "$1" printf local cd ${HOME} -eu 'quoted text'
+echo local test --verbose cd 2>/dev/null then cd
+	2>/dev/null done sed 2>/dev/null
+		x=1 local /usr/bin ${HOME} printf $(pwd) ${HOME} x=1 export sed
+		--verbose -eu awk 2>/dev/null --verbose "$@" "$1" awk
+		test test grep export --verbose
+	printf then test readonly "$@" local 'quoted text' sed cd
+	test "$1" readonly cd 2>/dev/null grep echo && "$1"
+test done --verbose && $(pwd) /usr/bin
+	2>/dev/null readonly done local grep sed 'quoted text'
+	done "$@" grep readonly test --verbose
+--verbose local && | then ${HOME}
+	| readonly | then && --verbose ${HOME} 2>/dev/null 'quoted text'
+done echo local /usr/bin echo export echo | && awk export
+/usr/bin test | done --verbose test $(pwd) sed then awk local 2>/dev/null
+local printf grep awk local sed readonly then --verbose awk printf && readonly
+test readonly | local printf x=1 grep readonly test awk cd awk
+		'quoted text' && ${HOME} grep "$1" cd "$@" 2>/dev/null "$@" sed
+	awk then | "$1" && 2>/dev/null
+sed cd echo "$@" 'quoted text' cd --verbose x=1 | readonly
+	--verbose printf test sed 'quoted text'
+		sed grep done $(pwd) $(pwd) "$@" awk --verbose --verbose
+	| 2>/dev/null test grep /usr/bin ${HOME} -eu readonly /usr/bin | export local
+	"$1" done sed "$1" readonly echo test
+	&& --verbose --verbose 2>/dev/null
+		x=1 then awk done ${HOME} test local
+awk printf --verbose ${HOME} test "$1" --verbose readonly && && then grep "$1"
+$(pwd) -eu /usr/bin --verbose awk /usr/bin 2>/dev/null | "$@" done local
+echo x=1 cd $(pwd) --verbose --verbose local readonly | test
+	local sed /usr/bin /usr/bin 2>/dev/null
+--verbose && export sed cd -eu printf "$@" x=1 ${HOME}
+cd awk x=1 && ${HOME} -eu 'quoted text'
+		awk export ${HOME} /usr/bin | 'quoted text' test
+		| echo 2>/dev/null | /usr/bin /usr/bin cd sed test /usr/bin readonly sed done awk
+-eu printf awk test echo 'quoted text' $(pwd) "$1" echo readonly readonly x=1
+cd grep awk --verbose readonly
+	| echo 'quoted text' | test cd awk "$1" $(pwd) 'quoted text' cd "$1" cd
+	x=1 sed echo awk cd awk grep sed "$1" local awk test done "$@" echo
+	local | "$@" cd local awk then --verbose echo then && | local sed "$1" $(pwd)
+		x=1 sed local test awk readonly -eu /usr/bin $(pwd) --verbose export 'quoted text'
+		--verbose "$@" | grep --verbose && local ${HOME} "$@" ${HOME}
+echo export grep done sed cd
+		sed -eu -eu done sed export | grep
+		&& 'quoted text' local ${HOME} 2>/dev/null 2>/dev/null
+	export echo printf printf printf x=1 awk
+	2>/dev/null cd then && $(pwd) readonly 'quoted text'
+done echo done "$1" $(pwd) done 'quoted text' printf --verbose sed local
+		"$@" test /usr/bin local "$@" --verbose sed echo --verbose sed "$1"
+"$@" --verbose done 'quoted text'
+	grep echo -eu ${HOME} 'quoted text' | /usr/bin test sed 'quoted text' | done
+	${HOME} "$@" echo grep readonly printf done "$@" "$1"
+	"$@" test sed sed local | then $(pwd) cd
+		grep 2>/dev/null "$@" printf test -eu then -eu
+local && awk 'quoted text'
+		"$1" cd ${HOME} test -eu | done "$@" 'quoted text' grep "$@" "$1"
+	cd "$1" -eu grep | -eu $(pwd) $(pwd) done && -eu local
+	printf x=1 "$1" echo local &&
+		"$@" done -eu grep grep local readonly 2>/dev/null printf
+"$@" awk sed then 2>/dev/null
+export readonly 'quoted text' test readonly 2>/dev/null
+	cd "$@" "$1" "$@" x=1 'quoted text'
+	echo then cd test ${HOME}
+	"$@" ${HOME} /usr/bin 'quoted text' readonly && local test
+		--verbose awk grep local then && | /usr/bin --verbose export
+	printf /usr/bin | && awk "$@" "$1" export awk done printf sed /usr/bin
+	--verbose grep 'quoted text' "$@" $(pwd) readonly done done "$@"
+		echo done readonly x=1 test grep cd --verbose cd echo cd -eu 2>/dev/null printf
+$(pwd) $(pwd) $(pwd) test done export && --verbose export
+	echo $(pwd) grep done test done -eu sed $(pwd) local 'quoted text' "$1" "$1"
+		sed awk grep done readonly cd --verbose
+"$@" done /usr/bin local /usr/bin --verbose "$@" /usr/bin
+| $(pwd) done "$@" x=1 'quoted text'
+cd /usr/bin 2>/dev/null /usr/bin grep -eu
+		readonly x=1 awk readonly "$@" 2>/dev/null 2>/dev/null test echo then export 2>/dev/null
+	done awk "$1" --verbose /usr/bin 2>/dev/null export --verbose "$1" "$1" export
+	$(pwd) awk awk | /usr/bin cd | --verbose ${HOME} --verbose -eu awk
+	--verbose && x=1 readonly ${HOME} grep | then then local "$@" "$@" sed $(pwd) ${HOME}
+		--verbose && 'quoted text' echo 'quoted text' export /usr/bin
+		grep x=1 echo cd printf sed then --verbose 2>/dev/null
+	| test && test 'quoted text' 2>/dev/null
+		"$1" readonly -eu 2>/dev/null then then "$1"
+readonly then sed "$1" | printf $(pwd) | readonly x=1 local -eu ${HOME}
+		echo "$1" "$1" | -eu && printf 'quoted text' x=1 grep sed awk awk readonly
+		| 'quoted text' printf x=1 x=1 "$1" sed && then "$@" done local
+		--verbose && printf /usr/bin local sed
+${HOME} export printf 'quoted text' 'quoted text' ${HOME} ${HOME}
+local grep readonly grep 'quoted text' cd printf echo test awk &&
+		x=1 x=1 $(pwd) sed printf
+		local awk | local 2>/dev/null printf
+readonly $(pwd) printf 'quoted text' done x=1 grep grep
+	--verbose "$1" echo $(pwd) done sed 'quoted text' local echo | x=1 then ${HOME}
+	sed export printf "$1" "$1" printf
+	test test readonly cd
+		| grep x=1 readonly $(pwd) printf printf 2>/dev/null local /usr/bin
+"$@" local $(pwd) "$1" --verbose export 2>/dev/null done && grep then "$@" --verbose
+--verbose export cd -eu test | cd echo grep printf echo awk
+	test x=1 2>/dev/null -eu | local 'quoted text' ${HOME}
+	test grep /usr/bin "$1" grep then
+	x=1 then local $(pwd) $(pwd) sed && awk "$@" echo |
+		printf | && -eu --verbose ${HOME} | sed
+		awk echo x=1 $(pwd) echo -eu awk local echo then && cd "$@" cd
+		awk local cd $(pwd) /usr/bin readonly
+		done export /usr/bin 'quoted text' export "$1" local
+	"$1" && sed 'quoted text' test --verbose
+	printf 2>/dev/null "$@" sed
+awk local cd sed ${HOME} grep && -eu grep "$1" printf export done /usr/bin
+test printf && 2>/dev/null /usr/bin
+	--verbose "$1" -eu export awk export
+		done export x=1 "$@" -eu | then readonly "$@" 'quoted text' printf echo
+	${HOME} 2>/dev/null 'quoted text'
+		done export /usr/bin && ${HOME}
+"$1" $(pwd) export 2>/dev/null awk readonly sed | export awk grep
+grep "$1" readonly sed /usr/bin export /usr/bin
+cd sed 'quoted text' cd ${HOME}
+| sed awk local export /usr/bin 2>/dev/null sed -eu "$@"
+		/usr/bin --verbose && awk cd printf "$1" ${HOME} -eu ${HOME} $(pwd) | $(pwd)
+	printf "$1" sed -eu printf readonly sed printf | printf && then grep
+-eu test && x=1 local /usr/bin x=1 grep grep printf
+		test export && echo export | x=1 ${HOME}
+--verbose printf /usr/bin -eu "$@" "$@" "$@"
+"$1" | && /usr/bin then sed sed 2>/dev/null
+readonly readonly echo 'quoted text' --verbose local
+x=1 export x=1 awk grep then
+	done 2>/dev/null export echo done export echo printf test done | &&
+/usr/bin 2>/dev/null ${HOME} cd && echo sed printf ${HOME} x=1 ${HOME} done
+		2>/dev/null /usr/bin grep
+	"$1" $(pwd) local "$@" 2>/dev/null ${HOME} local test "$@" 'quoted text'
+echo $(pwd) | local && test echo
+	--verbose 2>/dev/null && done local test
+		'quoted text' 2>/dev/null cd x=1 $(pwd) 2>/dev/null echo sed 'quoted text'
+	readonly local grep sed
+		cd -eu -eu "$1" printf then ${HOME}
+	x=1 grep local sed echo -eu 2>/dev/null && cd && --verbose
+	--verbose cd -eu then test 2>/dev/null test export echo
+	-eu grep awk -eu x=1 printf local
+	'quoted text' "$@" printf ${HOME} 2>/dev/null echo
+	x=1 && printf "$@" done && export cd export
+		cd echo -eu | test && $(pwd) && ${HOME} local ${HOME} | readonly /usr/bin test
+${HOME} export --verbose done cd -eu 2>/dev/null printf then
+		echo 2>/dev/null printf /usr/bin echo readonly
+	cd awk 2>/dev/null && | echo /usr/bin awk awk 2>/dev/null 2>/dev/null 'quoted text'
+--verbose "$@" cd printf ${HOME} x=1 x=1
+awk /usr/bin -eu grep
+2>/dev/null sed 2>/dev/null 'quoted text' -eu grep cd
+		--verbose then ${HOME} printf ${HOME}
+2>/dev/null cd $(pwd) 'quoted text'
+	local sed printf $(pwd)
+		"$@" --verbose then cd readonly --verbose done grep ${HOME}
+grep readonly local awk x=1 then local export | |
+'quoted text' readonly grep printf 'quoted text' /usr/bin 2>/dev/null test readonly
+		'quoted text' test done done export sed done
+	export grep test awk "$1" readonly printf cd cd sed 'quoted text' --verbose
+&& test $(pwd) readonly test printf x=1 cd
+		-eu readonly 2>/dev/null 2>/dev/null test printf
+	printf /usr/bin "$1" 'quoted text' &&
+--verbose awk local readonly | cd then
+		"$1" --verbose 'quoted text' -eu cd cd readonly
+		printf $(pwd) | grep local 'quoted text'
+		"$@" "$1" printf test ${HOME} /usr/bin /usr/bin export then && readonly
+	echo printf 2>/dev/null cd grep --verbose awk $(pwd) --verbose
+	/usr/bin | && ${HOME} test 'quoted text' export "$@" "$1"
+	sed 'quoted text' "$@" awk awk 'quoted text' --verbose --verbose
+done export --verbose 2>/dev/null printf grep printf "$@" done ${HOME} 2>/dev/null
+		echo | ${HOME} && export done "$@" "$@"
+	&& | $(pwd) echo --verbose x=1 printf awk echo 2>/dev/null $(pwd)
+	2>/dev/null test printf local then "$1" 2>/dev/null 2>/dev/null done 'quoted text'
+		export /usr/bin cd && readonly
+	/usr/bin export -eu sed echo then "$@" local done readonly
+		-eu test 2>/dev/null | cd test local $(pwd) && x=1 $(pwd) -eu
+	echo echo export ${HOME} grep echo echo
+"$@" export /usr/bin done export cd
+		echo awk 2>/dev/null grep echo export /usr/bin && 2>/dev/null readonly |
+	done ${HOME} local $(pwd) grep --verbose x=1 $(pwd) then &&
+		"$1" --verbose -eu cd | readonly
+	| export /usr/bin | printf printf awk "$@" sed ${HOME}
+	printf printf -eu done && x=1 x=1 test
+		done awk awk done "$1" $(pwd) 2>/dev/null
+	| ${HOME} echo awk 'quoted text' cd ${HOME}
+	2>/dev/null "$@" done 'quoted text' readonly
+		awk export && /usr/bin export local echo "$1" 'quoted text'
+		| export test readonly --verbose "$1" 'quoted text' /usr/bin
+	test ${HOME} 'quoted text' export && sed local test | cd 2>/dev/null
+	then x=1 'quoted text' cd then $(pwd)
+	&& ${HOME} awk x=1 --verbose x=1 then local readonly export echo local
+	| "$1" export "$@" ${HOME} /usr/bin awk
+	2>/dev/null ${HOME} readonly readonly
+echo $(pwd) 2>/dev/null sed 2>/dev/null grep cd "$@" "$1" local
+	awk && test ${HOME} echo 'quoted text'
+	'quoted text' cd ${HOME} then grep ${HOME} done 'quoted text' 'quoted text'
+		${HOME} 'quoted text' then cd 2>/dev/null echo && "$@" then
+	readonly ${HOME} test | printf echo
+		$(pwd) ${HOME} cd printf 'quoted text' $(pwd) readonly 2>/dev/null printf cd
+	grep printf then local && cd $(pwd) /usr/bin && sed
+		echo local export awk /usr/bin 'quoted text' export 'quoted text' 2>/dev/null
+	"$@" then 'quoted text' --verbose "$@" then x=1
+		sed done printf /usr/bin --verbose --verbose "$1"
+--verbose x=1 "$1" "$1" ${HOME} test readonly
+	| printf /usr/bin x=1 && cd "$1" "$@" ${HOME} /usr/bin 'quoted text'
+		x=1 test export readonly 'quoted text' awk
+"$1" grep done local x=1 --verbose -eu grep
+printf | /usr/bin $(pwd) done echo awk 'quoted text' done "$@"
+	then /usr/bin cd local ${HOME} grep cd "$@" "$1" | cd "$1" cd 'quoted text'
+	| export 2>/dev/null 2>/dev/null grep awk | --verbose ${HOME} x=1 $(pwd)
+	--verbose && --verbose sed local | local
+$(pwd) $(pwd) done awk && /usr/bin awk
+then then echo | x=1 2>/dev/null && awk grep 2>/dev/null test grep sed | local
+		/usr/bin printf local printf echo $(pwd) "$1" cd echo |
+	2>/dev/null test awk ${HOME} && ${HOME} "$@" "$@" echo /usr/bin done test test
+&& /usr/bin ${HOME} local $(pwd) done && cd | x=1 awk test
+		readonly x=1 && printf printf -eu printf -eu /usr/bin --verbose then then awk x=1
+		test test readonly -eu echo sed done $(pwd) 'quoted text' grep then export
+	/usr/bin 'quoted text' export
+	echo printf local | sed $(pwd) readonly readonly awk cd | --verbose
+	2>/dev/null "$@" "$1" -eu "$@" sed then test cd test | export 'quoted text'
+		'quoted text' grep --verbose && ${HOME} sed sed &&
+		x=1 x=1 local -eu --verbose cd export echo awk local
+${HOME} ${HOME} grep && | test "$1"
+		echo x=1 /usr/bin done done 'quoted text' then -eu 'quoted text' printf
+		$(pwd) awk then $(pwd) /usr/bin
+$(pwd) -eu test local "$1" done "$1" then -eu "$1" readonly
+	| | readonly "$@" grep x=1
+	2>/dev/null cd grep done --verbose $(pwd) grep | --verbose /usr/bin
+		--verbose echo export x=1 2>/dev/null local $(pwd) 2>/dev/null
+	$(pwd) sed "$@" | sed local x=1 export printf export 'quoted text' printf
+-eu "$1" 2>/dev/null export cd done
+	/usr/bin x=1 /usr/bin && 2>/dev/null export 'quoted text' cd echo
+		2>/dev/null echo test test local 2>/dev/null
+	&& 2>/dev/null grep /usr/bin readonly echo printf sed cd && done test --verbose
+	&& sed /usr/bin test 2>/dev/null
+cd /usr/bin ${HOME} echo /usr/bin grep awk && readonly test "$@" --verbose
+grep x=1 && echo test readonly "$@" done
+export sed readonly ${HOME} cd echo
+	done "$1" test "$1" grep $(pwd) && then export -eu 2>/dev/null | grep | 2>/dev/null
+	'quoted text' echo /usr/bin sed readonly 'quoted text' local
+	/usr/bin done ${HOME} done test ${HOME} --verbose
+		done $(pwd) printf "$1" awk && 'quoted text'
+	then export /usr/bin | ${HOME} "$1" /usr/bin readonly
+x=1 2>/dev/null cd && 2>/dev/null export export grep cd grep awk
+		| 'quoted text' "$@" && test -eu 2>/dev/null $(pwd) -eu local
+		readonly then echo --verbose test local 2>/dev/null -eu "$1" $(pwd) test 2>/dev/null
+		--verbose $(pwd) && 2>/dev/null
+	done done then printf
+sed awk awk done done then -eu | echo echo cd 'quoted text' readonly
+		2>/dev/null x=1 done grep awk echo 2>/dev/null | $(pwd) cd $(pwd) -eu done "$@"
+then "$@" test && done 2>/dev/null export /usr/bin 'quoted text' /usr/bin /usr/bin
+'quoted text' --verbose && "$@" awk | "$1" printf test 'quoted text'
+	export 2>/dev/null readonly sed $(pwd) 'quoted text' "$1" | 2>/dev/null test
+	--verbose /usr/bin --verbose
+		${HOME} cd local grep local && grep "$1" --verbose test printf
+		sed awk done --verbose test -eu done &&
+	sed export readonly | echo "$1" -eu
+		local && readonly then echo ${HOME} 'quoted text'
+sed printf sed grep "$@" then 2>/dev/null /usr/bin | awk x=1 sed 2>/dev/null
+		$(pwd) sed readonly printf
+	then x=1 export --verbose x=1 | sed printf -eu export readonly done x=1 local
+	${HOME} cd "$1" $(pwd) grep then 2>/dev/null grep $(pwd) test $(pwd)
+	-eu awk --verbose --verbose
+"$1" $(pwd) done -eu sed awk
+awk x=1 'quoted text' ${HOME} cd --verbose "$@" --verbose "$@"
+		$(pwd) readonly cd awk done --verbose 2>/dev/null export awk awk 'quoted text'
+		x=1 local && | "$1" && --verbose then done
+	/usr/bin 'quoted text' readonly $(pwd)
+		'quoted text' x=1 sed grep -eu | | readonly
+		"$@" grep 'quoted text' 'quoted text' awk
+		cd cd --verbose && "$@" $(pwd) readonly "$@" printf x=1 readonly $(pwd)
+cd local 'quoted text' awk readonly ${HOME} readonly
+	readonly printf done ${HOME} readonly
+	"$@" done printf "$@" --verbose
+		"$1" x=1 test && && 'quoted text' -eu 2>/dev/null local
+	readonly then && x=1 && then $(pwd) /usr/bin $(pwd) | local
+		2>/dev/null $(pwd) grep | done "$@" $(pwd)
+export export | done awk awk ${HOME} readonly | cd /usr/bin awk $(pwd)
+		echo cd $(pwd) ${HOME} export test readonly export test /usr/bin ${HOME} "$@"
+		&& $(pwd) echo 'quoted text' && | -eu readonly /usr/bin test readonly ${HOME}
+	local "$@" cd ${HOME} --verbose awk && sed $(pwd)
+		test export grep ${HOME} export -eu test -eu done sed sed 2>/dev/null
+done "$@" && /usr/bin 2>/dev/null echo
+	-eu ${HOME} x=1 done then done ${HOME} /usr/bin then /usr/bin grep cd /usr/bin
+		&& done test sed test --verbose 2>/dev/null test
+		cd test printf "$@" local && cd 2>/dev/null $(pwd) test $(pwd) | 'quoted text'
+"$1" cd x=1 --verbose grep readonly awk && -eu test export local &&
+		sed && "$@" test --verbose
+local 'quoted text' echo | grep readonly "$@" export done
+	-eu printf readonly /usr/bin $(pwd) printf echo echo --verbose && awk
+done sed ${HOME} 'quoted text' local ${HOME} done "$1" done cd
+		x=1 local "$@" sed local test $(pwd) test
+		grep && "$1" echo /usr/bin && done "$@" ${HOME} | printf /usr/bin sed && /usr/bin
+awk -eu --verbose 2>/dev/null x=1 test grep readonly 2>/dev/null ${HOME}
+"$1" -eu readonly | --verbose done
+	2>/dev/null && sed "$1" | "$1" export
+	${HOME} done --verbose && && sed echo x=1 export echo sed /usr/bin && /usr/bin
+2>/dev/null | 'quoted text' export done --verbose sed && echo test /usr/bin
+	x=1 done sed local echo readonly then ${HOME} && then "$1" test echo then
+	test echo grep 'quoted text' done x=1 local /usr/bin
+"$1" ${HOME} cd sed grep 'quoted text' local ${HOME} printf local
+	"$@" sed echo 'quoted text' ${HOME}
+	2>/dev/null "$@" readonly 2>/dev/null readonly 'quoted text' ${HOME}
+	awk export printf "$@" && then /usr/bin --verbose
+		printf | printf readonly then sed awk awk | && x=1 then | /usr/bin readonly
+		local test readonly ${HOME} && ${HOME} done readonly export "$@"
+		2>/dev/null sed cd x=1 sed readonly | --verbose "$1" then done -eu echo export
+		x=1 echo --verbose done echo sed 'quoted text' done | awk sed awk ${HOME} 2>/dev/null
+	sed cd --verbose 'quoted text'
+		printf "$1" ${HOME} x=1 'quoted text' 'quoted text' test | printf | x=1
+		"$@" "$@" printf /usr/bin export --verbose "$1" -eu local cd
+	--verbose test echo printf test x=1 local done /usr/bin "$@" then awk
+		cd then --verbose -eu "$1" cd awk /usr/bin ${HOME} export
+"$@" x=1 cd -eu grep /usr/bin awk sed | sed sed done test test
+"$1" done ${HOME} ${HOME} local 2>/dev/null cd grep --verbose
+awk test then echo x=1 printf grep 'quoted text'
+		"$@" 2>/dev/null grep sed export 'quoted text' readonly
+-eu $(pwd) -eu done sed &&
+		"$1" grep "$1" /usr/bin awk readonly done --verbose test
+		readonly cd && local cd x=1 then awk /usr/bin
+	done test ${HOME} then cd --verbose ${HOME} 2>/dev/null
+2>/dev/null ${HOME} printf
+/usr/bin x=1 && awk $(pwd) ${HOME}
+echo "$@" --verbose cd export "$@" "$@" 'quoted text' readonly "$1"
+		cd readonly cd local awk cd cd export $(pwd) local $(pwd) 2>/dev/null
+		awk $(pwd) "$@" "$@" ${HOME} && "$1" 'quoted text' $(pwd) export /usr/bin printf
+		"$@" export 'quoted text'
+/usr/bin cd && echo "$@" | $(pwd) done readonly "$@"
+		&& test printf local "$1" readonly "$1" x=1 sed
+	2>/dev/null "$1" readonly
+		"$@" "$@" done done awk echo awk printf $(pwd) x=1 printf done
+$(pwd) grep printf "$@" grep test ${HOME} "$@" sed local printf then
+		cd done echo $(pwd) awk
+"$1" && grep echo /usr/bin export readonly
+grep $(pwd) | -eu 'quoted text' sed /usr/bin
+		test awk $(pwd) 'quoted text' 'quoted text' then 'quoted text'
+then -eu local grep echo done "$1"
+		$(pwd) 2>/dev/null ${HOME} export printf printf $(pwd) && sed "$@" "$1"
+$(pwd) local && printf
+	/usr/bin test grep cd $(pwd) 2>/dev/null
+	awk "$@" --verbose && done grep
+	x=1 | readonly local grep
+	test && then 'quoted text' ${HOME} cd 'quoted text'
+awk ${HOME} readonly done $(pwd) echo ${HOME}
+		"$@" export sed $(pwd) "$1" export ${HOME} "$@" export test /usr/bin
+	&& then test cd sed -eu && x=1 grep "$1" ${HOME} $(pwd) local grep local
+		readonly x=1 done --verbose "$@" && cd -eu 'quoted text' --verbose "$@" /usr/bin
+	x=1 cd -eu test export && && sed && readonly sed then /usr/bin
+	2>/dev/null test && -eu -eu /usr/bin
+export local sed readonly 'quoted text'
+	awk then readonly 'quoted text' done x=1 "$@" "$1" /usr/bin
+	"$1" ${HOME} printf --verbose "$@" && awk $(pwd)
+"$1" /usr/bin /usr/bin "$1" then "$1" | && --verbose | sed -eu echo
+		/usr/bin $(pwd) export done printf 'quoted text' awk
+	/usr/bin "$1" ${HOME} local echo done local cd $(pwd) export x=1 --verbose --verbose
+test awk 2>/dev/null
+then then 'quoted text' --verbose
+	$(pwd) -eu /usr/bin --verbose --verbose --verbose
+	local "$1" /usr/bin grep | -eu export test cd "$@" --verbose
+		then grep cd printf && && export test $(pwd) test readonly echo $(pwd)
+	&& ${HOME} "$1" readonly readonly -eu printf "$1" local | | cd "$1" test then
+	printf "$1" readonly && cd local $(pwd) local awk && export $(pwd) /usr/bin
+	printf --verbose "$@" readonly
+	/usr/bin local done cd && cd --verbose /usr/bin $(pwd) sed "$1" local
+		$(pwd) printf awk echo test | test "$1" grep ${HOME} | && test sed
+sed sed --verbose then readonly && awk export x=1 sed export grep export | sed
+printf /usr/bin printf 'quoted text' sed then grep "$@" export awk $(pwd) "$1"
+		/usr/bin export echo 2>/dev/null sed export sed --verbose
+		sed --verbose done ${HOME} cd && 'quoted text' then local /usr/bin echo /usr/bin
+		then awk 'quoted text' --verbose sed
+	$(pwd) 'quoted text' ${HOME} "$@" test
+		sed $(pwd) local $(pwd) awk $(pwd) /usr/bin -eu local printf "$@" "$1" grep
+	${HOME} grep awk "$1" --verbose
+		grep export && grep printf -eu 2>/dev/null | && local done |
+x=1 "$1" ${HOME} cd && ${HOME} export -eu readonly
+		x=1 2>/dev/null | sed printf
+	${HOME} grep done -eu local then printf
+		local cd echo readonly --verbose echo local ${HOME} grep
+then awk done x=1 echo ${HOME} export $(pwd) x=1 test $(pwd) grep
+		x=1 | "$@" sed --verbose readonly
+		cd "$@" test --verbose grep
+		'quoted text' ${HOME} cd && 'quoted text'
+	$(pwd) 2>/dev/null echo | x=1 'quoted text' /usr/bin --verbose
+		-eu 'quoted text' then && /usr/bin "$@" |
+		export /usr/bin | readonly | 2>/dev/null --verbose
+	export local 2>/dev/null sed "$@" cd 'quoted text' then 'quoted text'
+awk --verbose && done printf /usr/bin "$1" 2>/dev/null ${HOME}
+	&& test "$@" grep local echo "$@" 'quoted text' /usr/bin && --verbose --verbose
+export readonly readonly
+		| sed "$1" 'quoted text' ${HOME} cd
+	'quoted text' done sed export | grep done cd 'quoted text'
+export cd awk "$@" printf 2>/dev/null /usr/bin | "$1" 2>/dev/null "$@" local
+export /usr/bin printf $(pwd) then "$1" cd sed local sed sed test
+export --verbose 'quoted text' $(pwd) awk 2>/dev/null
+grep echo x=1 $(pwd) awk -eu /usr/bin
+	-eu done local 2>/dev/null printf && grep
+	| /usr/bin awk echo sed
+		/usr/bin local local awk && -eu 2>/dev/null sed echo "$1" "$@" done cd /usr/bin
+		printf readonly test export
+| x=1 "$1" --verbose $(pwd) -eu export test awk export
+		$(pwd) grep "$@" grep sed export "$@" cd ${HOME} then then
+	&& then export done printf /usr/bin -eu -eu done -eu sed "$@" grep
+		x=1 echo "$1" then x=1 -eu printf
+		local | sed 'quoted text' -eu local done local export
+		sed -eu x=1 | test done "$@" ${HOME} -eu 'quoted text' done printf "$1" && export
+sed local local sed -eu
+		'quoted text' export | done local | readonly
+test -eu local && 2>/dev/null echo 'quoted text' sed | local /usr/bin echo then
+	${HOME} sed cd "$1" then 'quoted text' grep awk /usr/bin awk 'quoted text'
+x=1 local then done local "$@" awk --verbose
+"$1" x=1 grep -eu test grep ${HOME} 2>/dev/null
+		sed printf /usr/bin sed 2>/dev/null done printf awk done /usr/bin
+cd sed ${HOME} "$1" awk readonly local 2>/dev/null grep 2>/dev/null "$1" --verbose
+$(pwd) "$1" -eu "$@" -eu printf echo -eu "$1"
+$(pwd) local sed sed 'quoted text' --verbose done | grep printf ${HOME}
+		echo x=1 && local export done readonly
+		export then then done /usr/bin "$@" local echo | x=1
+		-eu export 'quoted text' "$1" "$@" $(pwd)
+		&& 2>/dev/null 'quoted text' -eu | "$1"
+x=1 sed echo echo echo ${HOME} ${HOME} done
+		${HOME} then awk cd $(pwd) && -eu test 'quoted text'
+		--verbose x=1 --verbose "$@"
+	then 2>/dev/null --verbose && -eu sed | export 2>/dev/null --verbose
+		${HOME} x=1 ${HOME} sed ${HOME} 'quoted text'
+x=1 echo grep done awk && 'quoted text' /usr/bin
+cd x=1 printf "$@" done
+		&& $(pwd) done grep "$@" /usr/bin echo echo 'quoted text' export printf grep
+		sed echo 2>/dev/null done readonly
+	sed 2>/dev/null cd $(pwd) x=1 grep printf
+		echo --verbose | test done --verbose "$1" local 2>/dev/null
+		then echo -eu /usr/bin -eu local readonly readonly
+	done then test "$@" 'quoted text' done test printf "$1" -eu done export ${HOME}
+	echo test 2>/dev/null printf -eu && ${HOME}
+		then -eu done export
+export grep echo grep readonly awk "$1" -eu | "$@" export sed
+"$@" export grep 'quoted text' "$@" sed
+&& then then 'quoted text' echo
+cd $(pwd) /usr/bin -eu /usr/bin 'quoted text'
+	cd test awk test --verbose 'quoted text' export
+local -eu grep printf "$1"
+		sed /usr/bin $(pwd) /usr/bin | ${HOME} 2>/dev/null ${HOME} "$1" | then done
+cd ${HOME} 2>/dev/null ${HOME} echo $(pwd) awk ${HOME} x=1 -eu x=1
+	export printf -eu done echo /usr/bin
+	--verbose readonly "$@" ${HOME} "$1"
+done $(pwd) awk $(pwd) --verbose ${HOME} 2>/dev/null $(pwd) then readonly awk
+		awk cd 'quoted text' echo && x=1 grep echo echo export echo 2>/dev/null
+	test /usr/bin && -eu --verbose awk 2>/dev/null --verbose 2>/dev/null
+	'quoted text' grep awk test --verbose
+	| 'quoted text' test echo
+		${HOME} "$1" && done test done export readonly printf export printf
+	${HOME} grep printf -eu export cd export && && then readonly sed /usr/bin &&
+		"$@" export "$1" printf --verbose "$@" local x=1
+test then x=1 && -eu done
+		| then export "$1" 'quoted text'
+		cd | -eu /usr/bin --verbose test sed test echo
+printf -eu | 'quoted text' printf | $(pwd)
+	${HOME} 'quoted text' --verbose && $(pwd) -eu 'quoted text'
+	awk $(pwd) export printf --verbose
+		$(pwd) local && done ${HOME} readonly && x=1 $(pwd) | export x=1
+local cd echo --verbose --verbose done
+&& grep 2>/dev/null echo local
+"$1" test readonly grep $(pwd) 2>/dev/null readonly
+'quoted text' local /usr/bin echo 'quoted text'
+	printf awk $(pwd) ${HOME} printf -eu x=1 test cd "$@" -eu local
+${HOME} --verbose test ${HOME} | -eu
+$(pwd) test echo x=1 2>/dev/null
+	then x=1 /usr/bin local ${HOME} sed
+	awk ${HOME} printf echo --verbose $(pwd)
+	'quoted text' local echo | "$@" x=1
+awk done /usr/bin ${HOME} local export printf awk "$@" --verbose
+then printf /usr/bin cd readonly echo x=1 2>/dev/null -eu
+		cd printf sed 'quoted text' /usr/bin ${HOME}
+		cd sed readonly ${HOME} ${HOME}
+		/usr/bin local done local test cd -eu sed export sed "$@" echo readonly then
+	| printf done --verbose --verbose ${HOME} 2>/dev/null $(pwd) 'quoted text' --verbose
+		done printf local done export 'quoted text'
+		export grep x=1 test awk ${HOME} then cd then readonly export 2>/dev/null then
+	$(pwd) "$1" "$1" | ${HOME}
+	done export grep sed $(pwd) && /usr/bin
+	--verbose echo readonly export grep
+	'quoted text' 2>/dev/null
+	&& test then "$@" ${HOME}
+		readonly "$@" | test grep awk cd "$@" /usr/bin awk sed test
+		readonly done done then 2>/dev/null "$1" echo "$1" grep 2>/dev/null done
+x=1 grep printf done /usr/bin readonly /usr/bin "$1" x=1 printf
+"$@" cd x=1 then | local $(pwd) cd -eu 'quoted text' cd $(pwd) | grep export grep
+then "$1" sed local then 'quoted text' "$1" --verbose x=1 $(pwd) awk readonly printf
+awk local done "$@" export --verbose
+	'quoted text' test awk 2>/dev/null 'quoted text' cd cd sed | sed --verbose
+	${HOME} grep awk ${HOME} then export ${HOME} then done $(pwd)
+		printf printf grep "$1" printf $(pwd) | echo /usr/bin
+	-eu readonly done -eu then test | export x=1 awk --verbose grep 'quoted text'
+		then && local 'quoted text'
+grep -eu && /usr/bin x=1 "$1" local cd echo "$@" --verbose
+		&& done x=1 "$1" 'quoted text' local --verbose awk cd local "$@" echo
+	/usr/bin ${HOME} test "$@" ${HOME} -eu done -eu x=1 printf -eu
+		then export sed printf --verbose | cd echo 'quoted text'
+2>/dev/null --verbose | --verbose then -eu readonly 'quoted text' "$@"
+| sed "$@" local "$1" test
+	local | $(pwd) 'quoted text' --verbose readonly sed cd | $(pwd)
+		"$@" then printf readonly
+	export --verbose -eu 'quoted text' grep | 'quoted text' "$1" "$1"
+test local -eu cd grep && &&
+	readonly ${HOME} | awk export $(pwd)
+	2>/dev/null 'quoted text'
+		-eu local 2>/dev/null then
+	"$1" awk test then /usr/bin
+	${HOME} $(pwd) echo 2>/dev/null && sed $(pwd) --verbose --verbose
+		--verbose 2>/dev/null /usr/bin awk x=1 echo cd -eu
+		readonly awk export -eu echo test then printf sed $(pwd) $(pwd)
+	--verbose && -eu $(pwd) grep echo
+	cd --verbose grep "$@"
+'quoted text' --verbose x=1 x=1 echo
+		| 'quoted text' test readonly
+	echo $(pwd) x=1 local local
+		readonly "$@" test x=1 -eu grep
+		grep echo printf done && --verbose ${HOME}
+printf export then cd -eu -eu
+--verbose 2>/dev/null
+		"$@" $(pwd) sed test
+grep 2>/dev/null -eu -eu echo &&
+export readonly then --verbose 2>/dev/null sed sed | test
+export test -eu local | 2>/dev/null awk then
+		printf done grep test x=1 grep test awk test printf sed $(pwd)
+	local $(pwd) test x=1 ${HOME} printf local "$1" x=1 grep
+	sed && local test export x=1 && readonly 'quoted text' "$@" grep && export x=1 grep
+		then "$1" /usr/bin sed printf /usr/bin echo
+	awk x=1 ${HOME} cd export export export && awk cd --verbose test sed
+	test $(pwd) export echo test "$1" test
+	export /usr/bin && done | 2>/dev/null
+	&& -eu -eu grep "$1" echo --verbose -eu
+		cd $(pwd) x=1 x=1 /usr/bin cd $(pwd) "$@" -eu --verbose 2>/dev/null
+		'quoted text' $(pwd) cd -eu awk "$1" | | echo
+		local && 2>/dev/null -eu cd awk | cd then ${HOME} ${HOME} "$1" 2>/dev/null
+		| printf 2>/dev/null -eu "$1" local
+	&& cd | && | printf && 'quoted text' readonly
+		local && local "$@" readonly | test /usr/bin 2>/dev/null
+cd printf readonly /usr/bin && test sed --verbose
+--verbose "$1" "$@" $(pwd) awk printf 2>/dev/null test "$@"
+	awk x=1 --verbose echo local --verbose
+	grep done cd then then done readonly done $(pwd) "$1" grep --verbose ${HOME}
+		awk $(pwd) 2>/dev/null readonly --verbose
+		echo | x=1 grep export --verbose then cd awk local then printf then local echo
+	awk /usr/bin export $(pwd)
+	grep awk 2>/dev/null /usr/bin "$@" sed printf
+readonly grep awk "$@" ${HOME} cd x=1 'quoted text' --verbose | "$@"
+		cd sed "$@" export && ${HOME} x=1 && export
+		"$@" then awk done printf -eu x=1 grep --verbose sed &&
+test -eu "$@" "$1" grep
+2>/dev/null local then | readonly
+		&& "$@" x=1 x=1 'quoted text' && && "$1" sed cd "$1"
+	grep export sed test 'quoted text' $(pwd) 'quoted text' | 'quoted text'
+	"$1" -eu 2>/dev/null awk awk then grep && done | $(pwd)
+		x=1 | sed printf readonly echo ${HOME} | 2>/dev/null && --verbose
+		/usr/bin /usr/bin 2>/dev/null then ${HOME} cd test $(pwd)
+		${HOME} x=1 sed x=1 2>/dev/null done export readonly done done "$@"
+	cd | $(pwd) export /usr/bin export /usr/bin
+	$(pwd) grep $(pwd) done local grep
+	done done "$1" readonly $(pwd)
+	| printf ${HOME} echo echo then printf ${HOME} 2>/dev/null done then
+	test awk && --verbose echo echo x=1 /usr/bin
+		/usr/bin echo printf 2>/dev/null /usr/bin
+	then "$1" cd done | awk && -eu export "$@" 2>/dev/null 'quoted text'
+/usr/bin done test then "$@" 2>/dev/null sed "$1" 'quoted text'
+	2>/dev/null sed export printf test --verbose ${HOME} cd then export
+	| export echo x=1 export grep | | local awk | printf test --verbose
+	"$@" sed --verbose 2>/dev/null x=1 && export export
+	export x=1 done ${HOME} printf /usr/bin -eu ${HOME} ${HOME} sed 2>/dev/null awk
+		x=1 readonly ${HOME} readonly done /usr/bin then && awk ${HOME} grep $(pwd) --verbose
+grep $(pwd) /usr/bin && | $(pwd) && done 'quoted text' echo done sed
+&& && echo local /usr/bin readonly 'quoted text' | "$@" test "$1"
+x=1 2>/dev/null /usr/bin /usr/bin grep cd grep
+	grep awk /usr/bin done
+then x=1 && --verbose "$@" printf readonly 'quoted text' && ${HOME}
+	${HOME} x=1 ${HOME} awk export /usr/bin x=1 done done -eu sed
+		grep sed then test /usr/bin /usr/bin then -eu $(pwd) then | "$@" $(pwd) cd -eu
+	cd && sed done awk export echo -eu --verbose
+		sed 2>/dev/null awk cd awk "$1" then awk test && /usr/bin --verbose
+$(pwd) local readonly printf 2>/dev/null export grep /usr/bin sed $(pwd) x=1
+cd --verbose local printf "$@"
+		readonly -eu $(pwd) printf -eu "$@" | --verbose x=1 -eu sed /usr/bin sed
+		test printf --verbose echo export "$1" 2>/dev/null
+		test done grep export $(pwd) test cd --verbose
+	done -eu "$1" printf test --verbose ${HOME} echo sed test
+		| cd /usr/bin /usr/bin awk export 'quoted text' 2>/dev/null x=1 grep cd
+		$(pwd) done export echo awk
+sed local $(pwd) printf ${HOME} -eu 2>/dev/null printf then sed export export
+		export -eu --verbose | grep "$1" 'quoted text' echo &&
+printf /usr/bin 'quoted text' ${HOME} echo | then "$@" && && printf printf then
+		'quoted text' test 2>/dev/null x=1
+"$1" printf 2>/dev/null test
+		-eu $(pwd) --verbose printf /usr/bin -eu | sed echo "$@" sed printf
+	grep /usr/bin ${HOME} test echo then done sed "$1" --verbose
+	x=1 $(pwd) test /usr/bin local done /usr/bin printf sed $(pwd)
+	grep -eu test readonly test test local "$1" done awk "$@" grep 'quoted text' sed
+--verbose --verbose readonly $(pwd) sed grep 2>/dev/null export /usr/bin $(pwd)
+		"$1" && cd test sed 2>/dev/null awk done
+	$(pwd) cd x=1 local cd local "$1" --verbose cd && awk --verbose
+"$1" test awk "$@" printf -eu sed /usr/bin 'quoted text'
+&& $(pwd) && then "$@" -eu grep
+test 2>/dev/null "$@" $(pwd)
+	${HOME} ${HOME} local /usr/bin x=1
+		2>/dev/null cd local "$1" awk readonly | sed "$@" | test grep
+		"$@" -eu readonly readonly
+export printf done sed sed printf /usr/bin -eu export echo echo test
+${HOME} then --verbose | done 2>/dev/null "$1" readonly
+test done 'quoted text' awk "$@" 2>/dev/null grep echo local | echo
+sed /usr/bin | | --verbose 'quoted text' grep 2>/dev/null then test /usr/bin
+readonly local --verbose ${HOME} 'quoted text'
+&& sed $(pwd) then 2>/dev/null done "$1" then export then grep ${HOME}
+	test printf awk grep echo export test "$@" "$1" printf printf done ${HOME}
+		"$@" local local export done test $(pwd) ${HOME} && ${HOME} | then
+		printf local export $(pwd) done && readonly awk done sed && -eu
+	then sed export $(pwd) 'quoted text' "$@" 'quoted text' awk $(pwd) x=1 printf
+		/usr/bin $(pwd) 2>/dev/null
+${HOME} local cd 'quoted text' export done
+		readonly test && readonly cd "$1" then "$1" grep "$1" $(pwd) "$@" |
+${HOME} /usr/bin /usr/bin $(pwd) awk 2>/dev/null local --verbose "$@" | x=1 &&
+		"$1" awk then 2>/dev/null && sed -eu printf
+$(pwd) then 2>/dev/null /usr/bin then /usr/bin cd local then
+&& sed readonly awk export readonly
+	export test sed echo 2>/dev/null
+readonly test done export done /usr/bin cd sed sed 2>/dev/null readonly
+	sed local local | export
+local -eu echo && "$1" "$@" sed grep | && && "$1" && 'quoted text' /usr/bin
+done 'quoted text' "$@" sed 'quoted text' done local
+		x=1 /usr/bin local /usr/bin sed echo
+"$1" awk /usr/bin awk cd && --verbose "$1" /usr/bin local awk done "$1"
+cd x=1 "$1" sed awk cd &&
+		export echo "$1" 'quoted text'
+done then /usr/bin 'quoted text' then
+	printf $(pwd) export --verbose test then /usr/bin $(pwd) /usr/bin
+		printf done | test -eu
+		awk x=1 cd 2>/dev/null $(pwd) echo 'quoted text' /usr/bin readonly sed x=1 "$@"
+	/usr/bin done grep | local
+		"$@" export ${HOME} readonly && sed grep test awk test local export readonly
+	readonly --verbose --verbose -eu
+		cd done /usr/bin --verbose
+		x=1 then printf readonly
+		| readonly awk local echo grep ${HOME}
+	$(pwd) && echo 'quoted text' readonly $(pwd) printf sed "$1" test $(pwd)
+		done echo 2>/dev/null printf /usr/bin
+printf --verbose export awk
+/usr/bin "$1" /usr/bin cd awk done --verbose test | && then test "$@" test
+	x=1 ${HOME} sed --verbose -eu x=1 test "$1" 2>/dev/null
+	"$1" done then 2>/dev/null
+		test export && awk && export then x=1 then $(pwd) export
+	'quoted text' x=1 2>/dev/null
+		--verbose ${HOME} "$1" "$1" 2>/dev/null
+${HOME} export export readonly done local done 2>/dev/null
+		test --verbose export ${HOME}
+/usr/bin 2>/dev/null --verbose
+		printf done ${HOME} then && readonly
+		$(pwd) readonly export local -eu readonly done sed done cd local "$@" readonly
+		echo x=1 /usr/bin $(pwd) done ${HOME} done /usr/bin
+		"$1" test "$1" ${HOME} "$1" && awk ${HOME} then
+"$1" awk test export sed "$1" echo "$1" then
+	$(pwd) 2>/dev/null awk "$@" awk 2>/dev/null 'quoted text' 'quoted text' export
+		cd | sed "$1" 'quoted text' --verbose $(pwd) echo export $(pwd) "$@" x=1
+	local then "$@" echo grep ${HOME} cd ${HOME} "$@" $(pwd) then
+done /usr/bin -eu -eu done grep x=1 then "$@" done
+		done | ${HOME} --verbose grep printf cd && 'quoted text'
+done cd awk grep test
+		then -eu ${HOME} export /usr/bin --verbose readonly echo x=1 --verbose
+	"$1" ${HOME} cd $(pwd) $(pwd) grep "$1"
+2>/dev/null export echo 2>/dev/null
+	-eu --verbose "$1" export done --verbose export --verbose && | sed $(pwd)
+	'quoted text' printf sed && echo "$1" /usr/bin
+	awk -eu local 2>/dev/null cd "$1" echo test cd
+		'quoted text' x=1 export "$1" sed /usr/bin test
+echo --verbose readonly awk && local local done 2>/dev/null sed 'quoted text'
+export x=1 /usr/bin "$1" $(pwd)
+	$(pwd) then "$1" --verbose /usr/bin awk "$1" "$1" "$@" 2>/dev/null
+x=1 readonly --verbose x=1 ${HOME}
+local awk awk cd export
+	${HOME} /usr/bin echo | ${HOME} readonly printf | "$@"
+test local printf then readonly printf "$1" awk && -eu 2>/dev/null then printf
+-eu ${HOME} readonly then test readonly export readonly cd /usr/bin /usr/bin
+		export done ${HOME} test x=1 awk grep sed
+	grep echo "$1" /usr/bin x=1 2>/dev/null export readonly /usr/bin x=1
+| awk printf --verbose sed $(pwd) export "$1" ${HOME} done echo
+awk "$@" "$@" test | --verbose x=1 "$@" $(pwd) cd cd test echo --verbose
+	x=1 $(pwd) sed awk cd 'quoted text'
+	${HOME} readonly test local -eu sed cd --verbose 2>/dev/null
+		2>/dev/null sed test test --verbose --verbose local echo "$@" -eu test
+		local 2>/dev/null then ${HOME} 2>/dev/null "$1" x=1 && $(pwd) 2>/dev/null
+	-eu export $(pwd) x=1 awk printf -eu grep echo 2>/dev/null -eu test "$1" sed x=1
+	export export test x=1 'quoted text' "$@" grep grep local
+-eu echo readonly cd grep x=1 readonly "$@" readonly
+	--verbose && local cd test x=1 awk then test
+		2>/dev/null x=1 2>/dev/null done test | | readonly readonly
+		${HOME} local readonly ${HOME}
+		${HOME} 'quoted text' 'quoted text' export "$1"
+		'quoted text' "$1" done then && done /usr/bin echo $(pwd) -eu local
+	-eu cd done 2>/dev/null "$1" -eu -eu 2>/dev/null ${HOME} 'quoted text'
+	readonly readonly /usr/bin
+		${HOME} awk echo | && awk cd | ${HOME}
+"$@" grep export awk 'quoted text'
+		printf "$@" "$@" 2>/dev/null printf 'quoted text' awk | $(pwd) done export
+2>/dev/null 'quoted text' sed 2>/dev/null ${HOME}
+		2>/dev/null sed 2>/dev/null printf "$1" awk 2>/dev/null
+		cd 'quoted text' readonly sed /usr/bin printf | grep
+	-eu -eu 2>/dev/null -eu then "$@" sed sed && test cd /usr/bin
+	echo local test "$1"
+	sed cd export export readonly
+		cd && 2>/dev/null 2>/dev/null printf cd then && |
+	export export readonly $(pwd) readonly
+--verbose cd -eu "$1" "$@" cd readonly done /usr/bin echo
+	${HOME} echo done test ${HOME} --verbose cd $(pwd)
+&& awk | | --verbose done export 2>/dev/null
+		grep awk local x=1 printf export "$@" | && && sed readonly 'quoted text'
+local "$@" "$1" echo done readonly --verbose
+		x=1 2>/dev/null local local done
+"$@" $(pwd) 2>/dev/null sed -eu | ${HOME}
+		echo grep 2>/dev/null 'quoted text' -eu export then test x=1 --verbose
+local ${HOME} --verbose awk | -eu local |
+printf sed $(pwd) then "$1" then
+	'quoted text' --verbose
+	| "$@" cd x=1 test | ${HOME} then | printf ${HOME}
+		'quoted text' export local
+		${HOME} /usr/bin "$@" $(pwd) | done local then x=1 ${HOME} x=1
+	grep printf "$1" awk x=1 $(pwd) test export then export --verbose
+$(pwd) 2>/dev/null test then grep then test | cd readonly readonly
+		sed sed /usr/bin "$1" ${HOME} export then readonly x=1 echo grep local export
+		x=1 readonly sed test 2>/dev/null
+	--verbose | local ${HOME} 2>/dev/null
+readonly done local export awk
+		awk export 'quoted text' 2>/dev/null x=1 && | "$@" done echo
+		"$1" grep | readonly && echo $(pwd) ${HOME} grep "$1" cd
+"$1" --verbose awk done -eu ${HOME} local 'quoted text' local readonly /usr/bin
+local $(pwd) "$@" sed $(pwd) sed /usr/bin export grep 2>/dev/null awk
+		local local local test then | 'quoted text' test ${HOME} --verbose grep
+		2>/dev/null --verbose cd 2>/dev/null "$1" sed -eu sed $(pwd) --verbose
+$(pwd) 'quoted text' | x=1 ${HOME} awk ${HOME} grep test
+	-eu | $(pwd) sed test done
+		"$@" && printf && && then | $(pwd)
+		${HOME} | echo $(pwd) done /usr/bin
+	| 'quoted text' then 'quoted text' 2>/dev/null then | readonly
+x=1 2>/dev/null 2>/dev/null done && sed local 2>/dev/null -eu awk
+cd 'quoted text' test 2>/dev/null 2>/dev/null && -eu "$@" then $(pwd) -eu
+	| x=1 $(pwd) && 2>/dev/null
+		x=1 awk cd x=1 "$@" 2>/dev/null grep 'quoted text' && /usr/bin /usr/bin
+		--verbose /usr/bin "$@" grep export /usr/bin cd readonly export cd done
+		--verbose 'quoted text' echo printf /usr/bin "$@" sed done
+		test then | sed && awk readonly
+| $(pwd) cd grep x=1 "$@" --verbose
+		awk sed echo awk local export cd printf | "$@" --verbose printf
+	then then test sed "$@" "$@" 'quoted text' $(pwd) sed --verbose
+	$(pwd) echo export export readonly sed x=1 | then "$1" export local printf cd
+awk x=1 "$1" cd | local sed $(pwd) test
+readonly grep x=1 -eu $(pwd) awk awk ${HOME} export
+		2>/dev/null x=1 x=1 awk echo
+		-eu --verbose awk cd $(pwd) cd x=1
+echo && awk /usr/bin printf awk export && /usr/bin
+sed sed "$@" | | printf /usr/bin export 'quoted text' /usr/bin ${HOME} awk ${HOME}
+2>/dev/null echo done x=1 then 2>/dev/null "$@" && local x=1 grep readonly
+	'quoted text' then local printf echo grep /usr/bin awk sed local then
+		echo echo 2>/dev/null grep $(pwd) 'quoted text' 2>/dev/null --verbose readonly
+		$(pwd) local echo "$1" local ${HOME} awk && export then
+	echo grep printf 2>/dev/null
+$(pwd) local ${HOME} && --verbose
+		${HOME} export ${HOME} grep "$1" 2>/dev/null sed done
+		export grep $(pwd) ${HOME} grep awk 2>/dev/null
+2>/dev/null ${HOME} sed awk awk printf "$1" $(pwd) 2>/dev/null done "$@"
+		then && 'quoted text' $(pwd) --verbose readonly grep export awk then /usr/bin
+		readonly grep --verbose cd
+		export -eu echo readonly --verbose local awk
+	'quoted text' "$1" then printf 'quoted text' done
+		then awk awk x=1 x=1 then /usr/bin | | $(pwd)
+cd then printf sed then /usr/bin -eu export | then readonly echo readonly
+	2>/dev/null local "$1" "$1" readonly printf "$1" "$1" then sed $(pwd)
+grep awk cd sed local then x=1 && | 'quoted text' && test
+done 'quoted text' local then then "$@" | | ${HOME}
+		"$1" done test && $(pwd)
+		done then | done readonly printf cd 2>/dev/null
+		-eu /usr/bin 'quoted text' ${HOME} "$@" readonly ${HOME} readonly $(pwd) "$@" export
+readonly grep "$1" grep awk cd
+	awk | export --verbose 'quoted text' awk $(pwd) sed $(pwd)
+'quoted text' "$1" grep done grep "$1" awk ${HOME} "$1" local x=1 $(pwd) then x=1
+	'quoted text' echo echo "$1" sed grep x=1 'quoted text'
+	sed local | export readonly sed $(pwd) &&
+	awk done readonly /usr/bin && | $(pwd) && test --verbose
+	echo 'quoted text' | x=1 test $(pwd) printf
+		cd && x=1 'quoted text' /usr/bin
+	$(pwd) --verbose "$@" awk grep -eu 'quoted text' then x=1 x=1 done
+		grep cd sed 'quoted text'
+"$1" then then $(pwd) 2>/dev/null
+		&& "$1" readonly | && local printf 'quoted text' then cd test sed "$@" awk
+done 'quoted text' "$@" test
+| "$1" local --verbose printf ${HOME} then /usr/bin
+'quoted text' 'quoted text' "$1" local export $(pwd) "$@" /usr/bin 'quoted text'
+		/usr/bin "$@" && /usr/bin /usr/bin printf echo grep awk local
+#include c233.sh
+x=1 echo sed $(pwd) && test awk ${HOME} done "$1" grep 'quoted text' -eu &&
+	${HOME} sed done /usr/bin done local "$1" -eu echo sed sed /usr/bin
+		export "$@" readonly | 'quoted text' "$@" printf -eu ${HOME}
+		x=1 /usr/bin | then 2>/dev/null then readonly "$1" grep /usr/bin ${HOME}
+then 'quoted text' "$@" then x=1 readonly awk local awk then x=1 then
+		/usr/bin /usr/bin 2>/dev/null readonly -eu sed x=1 "$@" sed | 2>/dev/null -eu
+done 'quoted text' local "$@" printf | then printf grep printf "$@" &&
+		"$@" 'quoted text' printf 2>/dev/null "$@" -eu cd echo
+		&& -eu | done echo export test && then local 'quoted text' cd 2>/dev/null grep
+		&& ${HOME} "$1" readonly grep printf x=1 done grep /usr/bin test 'quoted text'
+	readonly --verbose "$1" x=1
+	2>/dev/null then -eu grep
+	echo 2>/dev/null $(pwd) ${HOME} awk
+	/usr/bin /usr/bin x=1 awk -eu
+	${HOME} printf | 2>/dev/null grep local --verbose
+'quoted text' ${HOME} /usr/bin /usr/bin then -eu test x=1 ${HOME}
+	x=1 /usr/bin test -eu export 'quoted text'
+x=1 2>/dev/null 2>/dev/null | awk $(pwd) test readonly 'quoted text'
+	&& local --verbose --verbose && "$1" cd -eu --verbose cd then readonly | |
+		x=1 local && "$@" && grep
+		export grep readonly grep ${HOME} grep
+echo local export && "$@"
+done cd && "$@" echo echo export "$1" test --verbose
+		/usr/bin 'quoted text' readonly 'quoted text' 2>/dev/null echo x=1 | export
+	export -eu "$1" 'quoted text' 'quoted text' --verbose "$1" local /usr/bin
+grep /usr/bin echo /usr/bin 'quoted text' cd sed && awk done 2>/dev/null
+	--verbose "$@" test sed "$1" /usr/bin "$1" sed cd echo grep cd local done
+	&& --verbose printf readonly | readonly sed $(pwd)
+"$@" done "$@" export && printf readonly $(pwd) "$1" export -eu
+x=1 then export x=1 local echo readonly 'quoted text'
+/usr/bin $(pwd) ${HOME} 2>/dev/null 2>/dev/null |
+		grep x=1 x=1 --verbose readonly | $(pwd) grep x=1 then awk test
+		readonly printf -eu /usr/bin
+awk $(pwd) printf -eu /usr/bin x=1 echo awk "$1" $(pwd) && done readonly $(pwd)
+		export then then done readonly export "$@" "$1" awk 2>/dev/null
+local then 'quoted text' cd --verbose
+grep /usr/bin && awk awk grep done awk | /usr/bin
+x=1 done -eu readonly local --verbose ${HOME} "$1" grep --verbose
+		--verbose | /usr/bin x=1 x=1 -eu echo echo 'quoted text'
+		--verbose grep /usr/bin printf local grep then -eu
+	"$1" --verbose awk 'quoted text' awk
+		awk 2>/dev/null done local grep local test test sed sed
+test "$@" "$@" local readonly
+		local readonly done && /usr/bin sed printf test grep printf cd "$1"
+		"$@" export /usr/bin /usr/bin && 'quoted text' "$1" 'quoted text' local test
+local readonly $(pwd) grep readonly echo
+/usr/bin test ${HOME} grep awk awk && sed "$1" x=1 awk grep grep then --verbose
+		'quoted text' sed | cd ${HOME} awk grep -eu export
+sed | && 'quoted text' "$@" awk $(pwd)
+		grep 2>/dev/null ${HOME} ${HOME} printf
+	sed local test --verbose done test 'quoted text' awk --verbose $(pwd) then |
+	"$@" x=1 awk "$@" awk 'quoted text' awk test /usr/bin
+	| "$@" "$1" cd $(pwd) ${HOME} "$@" echo local "$@" -eu printf "$@" ${HOME} printf
+x=1 cd sed grep -eu "$1" x=1
+	x=1 "$1" echo cd printf readonly /usr/bin export then ${HOME} $(pwd) "$1" cd
+	grep ${HOME} x=1 export --verbose printf
+	awk | "$1" ${HOME} printf printf -eu
+		local grep && "$@" --verbose | grep export "$1" "$@"
+		local test x=1 local "$@" $(pwd) && "$1" sed "$@" awk | && ${HOME}
+	&& export "$1" grep $(pwd) -eu && export $(pwd) awk 2>/dev/null sed
+then $(pwd) awk -eu sed --verbose 'quoted text' test sed x=1 test 'quoted text'
+		-eu printf grep test sed printf awk 'quoted text' done ${HOME} local x=1
+	done $(pwd) local cd sed done /usr/bin
+		echo 2>/dev/null && grep test 'quoted text' test echo 2>/dev/null "$1" done
+"$@" && 'quoted text' test readonly
+		-eu printf sed then "$@" "$@" "$1" $(pwd)
+	$(pwd) "$1" done export /usr/bin
+test /usr/bin 2>/dev/null
+	"$@" test $(pwd) echo 2>/dev/null
+sed && test sed /usr/bin printf grep x=1 grep cd -eu test
+	done -eu cd done "$@" done local 'quoted text' x=1 then export 2>/dev/null
+		"$1" awk --verbose /usr/bin readonly cd awk -eu test awk
+	${HOME} | done /usr/bin
+		/usr/bin echo grep cd test --verbose /usr/bin export "$@" then "$1" /usr/bin "$1"
+		'quoted text' | export ${HOME} "$1" done local
+grep -eu export grep printf echo && /usr/bin x=1 echo $(pwd) 'quoted text'
+		$(pwd) 'quoted text' -eu printf grep /usr/bin
+	$(pwd) cd echo cd awk &&
+&& sed echo readonly /usr/bin readonly printf awk --verbose $(pwd) "$@" && "$@"
+'quoted text' "$@" export && readonly && | readonly
+	printf local sed $(pwd) "$1" 'quoted text' | && cd local export
+		grep x=1 printf ${HOME} local $(pwd)
+	local "$1" printf ${HOME}
+export -eu done x=1 cd printf
+${HOME} x=1 echo export grep | readonly
+	printf export then awk sed done $(pwd) x=1 x=1 -eu sed "$@" local printf /usr/bin
+		then sed | ${HOME} "$@" /usr/bin && export grep /usr/bin -eu
+'quoted text' export sed sed printf x=1 printf -eu then -eu
+&& "$@" $(pwd) 2>/dev/null --verbose echo x=1
+	--verbose awk $(pwd) /usr/bin export sed sed grep
+	x=1 "$1" printf ${HOME} printf --verbose ${HOME}
+--verbose "$@" "$@" x=1 | export local readonly
+	"$@" -eu x=1 test test local /usr/bin
+test then --verbose export 2>/dev/null ${HOME} 'quoted text' readonly
+	'quoted text' $(pwd) local "$@" && then sed test export
+		cd $(pwd) --verbose sed sed x=1 --verbose then
+${HOME} -eu cd --verbose grep $(pwd)
+cd | x=1 done test then 'quoted text' "$@" /usr/bin export x=1 x=1 | -eu
+		x=1 --verbose local "$1" --verbose readonly $(pwd) && test &&
+	export "$@" then | ${HOME} x=1 then && 2>/dev/null | grep printf grep x=1
+	grep export done printf "$@" local
+		'quoted text' then ${HOME} readonly local
+grep "$@" | 2>/dev/null ${HOME} printf sed then grep $(pwd) cd
+cd done awk "$@" ${HOME} ${HOME} "$@" 'quoted text'
+	printf local /usr/bin --verbose x=1
+		"$1" 2>/dev/null ${HOME} readonly
+	"$@" "$1" x=1 then export
+		"$1" | && readonly done printf --verbose "$1"
+	then --verbose | 'quoted text' readonly cd
+sed && "$1" --verbose -eu "$1" export --verbose | ${HOME} 'quoted text'
+awk "$@" && 'quoted text' x=1
+test export test /usr/bin /usr/bin echo awk 2>/dev/null /usr/bin
+test "$@" --verbose cd echo cd local export 'quoted text'
+		"$1" printf x=1 -eu test awk x=1 echo |
+		${HOME} export test done
+		grep 'quoted text' 2>/dev/null cd local --verbose $(pwd) awk
+		| 2>/dev/null x=1 cd 2>/dev/null echo readonly "$@" export then | awk "$1"
+&& local done then "$@" --verbose ${HOME} test | test awk "$@" 'quoted text'
+		printf /usr/bin printf "$@" readonly
+		x=1 local --verbose "$@" sed grep readonly | local && grep x=1 2>/dev/null
+2>/dev/null awk local "$1" -eu | $(pwd)
+	test | /usr/bin "$@" grep -eu local test echo ${HOME} local | 2>/dev/null
+		2>/dev/null 2>/dev/null --verbose export sed local -eu
+	done -eu echo --verbose awk -eu export then test "$1" 'quoted text' | | local
+		'quoted text' export sed 'quoted text' awk
+2>/dev/null --verbose cd done ${HOME} --verbose
+	done "$@" awk && cd -eu local export sed printf 2>/dev/null "$@"
+'quoted text' local x=1 export cd
+	x=1 $(pwd) 2>/dev/null && 'quoted text' $(pwd) 'quoted text'
+		"$@" done -eu 'quoted text' x=1 "$@" 'quoted text' done
+done | cd --verbose awk && grep then 'quoted text' then /usr/bin
+-eu cd echo export awk "$@" export test then echo "$@" ${HOME} && awk export
+export $(pwd) echo "$@" done
+	local | awk && echo printf export x=1
+local && "$@" test /usr/bin /usr/bin printf $(pwd) -eu 'quoted text'
+	printf test ${HOME} --verbose 'quoted text' /usr/bin 'quoted text' /usr/bin
+/usr/bin 2>/dev/null awk echo then 2>/dev/null test "$1" -eu 2>/dev/null
+	| $(pwd) printf awk test && then awk $(pwd) sed --verbose echo grep test
+printf done "$1" 'quoted text' readonly then export sed /usr/bin then readonly
+done 2>/dev/null done done local
+		x=1 cd 2>/dev/null local test ${HOME}
+	readonly awk cd sed grep then && -eu
+	x=1 then && printf | cd test 'quoted text' --verbose export $(pwd) 2>/dev/null
+	2>/dev/null test printf 'quoted text'
+		export "$1" readonly local printf -eu readonly x=1 ${HOME} --verbose
+	readonly local export | "$1" cd "$1" local export "$1" x=1
+	readonly ${HOME} 2>/dev/null sed ${HOME} | "$1" /usr/bin
+	/usr/bin /usr/bin -eu grep "$1" --verbose awk local readonly
+x=1 cd ${HOME} | awk "$@" 2>/dev/null
+| && sed -eu readonly "$@" -eu done then done test local && readonly 'quoted text'
+	test | $(pwd) printf printf printf readonly grep local "$@" sed x=1 export
+		sed /usr/bin ${HOME} echo 'quoted text'
+export 'quoted text' test printf
+		test --verbose x=1 printf local
+	"$@" 'quoted text' export printf -eu awk x=1 grep |
+$(pwd) --verbose test "$@" 'quoted text' local awk test echo "$1" export ${HOME}
+		"$@" ${HOME} "$@" local awk -eu readonly
+	"$1" readonly $(pwd) $(pwd) $(pwd) done readonly test && cd "$@" export x=1 echo
+		--verbose 'quoted text' && "$1" 'quoted text' && test readonly grep test echo grep
+		"$1" /usr/bin echo 2>/dev/null test awk "$@" $(pwd) cd -eu test x=1 test
+test x=1 $(pwd) printf sed test sed "$@" --verbose
+	awk readonly readonly then && --verbose echo cd grep "$@" 'quoted text' done
+	local then -eu "$1" /usr/bin 'quoted text' awk $(pwd) --verbose -eu
+sed echo 2>/dev/null echo
+done /usr/bin test 'quoted text'
+		2>/dev/null printf echo "$1" x=1
+	${HOME} test | grep done
+		done x=1 | cd "$@" -eu /usr/bin
+	readonly local x=1 $(pwd) "$1" && then 2>/dev/null
+		&& local $(pwd) x=1 sed 'quoted text'
+		x=1 | x=1 printf cd /usr/bin awk x=1 readonly
+		-eu /usr/bin | printf sed readonly awk
+export sed test --verbose local export &&
+		printf awk cd -eu local | awk echo then $(pwd) "$1"
+		$(pwd) export $(pwd) 2>/dev/null test 'quoted text'
+	--verbose x=1 --verbose readonly test echo --verbose
+readonly "$1" then then export | local
+cd done done printf printf readonly readonly done -eu
+echo | x=1 printf $(pwd) 2>/dev/null cd "$1" test export 'quoted text'
+	-eu awk 2>/dev/null printf
+	sed echo 'quoted text' local local local $(pwd)
+		&& export sed local sed $(pwd) echo sed then export
+	&& awk -eu test done $(pwd) export x=1 "$1" test x=1 cd done done cd --verbose
+	cd awk done "$@" done printf x=1 $(pwd) "$@" $(pwd) "$1"
+x=1 "$@" test /usr/bin export 'quoted text' test
+	| /usr/bin "$@" 2>/dev/null grep | --verbose --verbose -eu export
+'quoted text' sed x=1 export
+printf $(pwd) test --verbose
+	2>/dev/null 'quoted text'
+		printf done local 2>/dev/null 2>/dev/null ${HOME} "$1" printf
+	printf grep done then grep awk done /usr/bin printf sed "$@" ${HOME} && cd 2>/dev/null
+		2>/dev/null 'quoted text' awk readonly printf
+	/usr/bin export 2>/dev/null sed $(pwd) cd then grep
+		"$@" "$@" | sed done readonly then x=1
+	2>/dev/null x=1 /usr/bin then test 'quoted text' "$1" readonly sed
+	$(pwd) readonly /usr/bin ${HOME}
+	cd export -eu "$1" 2>/dev/null cd cd local printf test readonly
+-eu $(pwd) 'quoted text' 2>/dev/null && sed "$@" export "$1"
+		sed readonly | 2>/dev/null awk 'quoted text' printf test ${HOME} readonly
+	then --verbose "$@" then -eu
+	printf printf "$@" 2>/dev/null "$@" -eu && local printf && export -eu cd awk
+		'quoted text' /usr/bin x=1 | readonly printf
+local cd awk printf grep then --verbose
+		| --verbose grep export 2>/dev/null grep
+--verbose && test && grep $(pwd) test done readonly local cd x=1 --verbose
+'quoted text' export test export
+	echo | echo grep x=1 ${HOME} ${HOME} | done $(pwd) $(pwd) -eu -eu | grep echo
+		| sed export x=1 $(pwd) echo local -eu local cd ${HOME} awk /usr/bin
+	${HOME} printf && cd awk | "$1" 'quoted text' then cd
+| printf ${HOME} /usr/bin printf readonly cd /usr/bin | awk "$@" local --verbose
+	/usr/bin 2>/dev/null --verbose /usr/bin printf then done | "$@" --verbose
+	grep $(pwd) cd awk then x=1 &&
+| | "$@" echo sed readonly then $(pwd) x=1
+	echo "$@" "$1" test 'quoted text' awk export "$1" done then -eu local ${HOME}
+	sed x=1 ${HOME} x=1 test && "$@" -eu test 2>/dev/null $(pwd)
+	-eu export test 2>/dev/null echo awk "$@"
+	"$1" done grep grep -eu "$1" 2>/dev/null
+test awk "$1" ${HOME} "$@" -eu awk
+		&& cd cd "$1" 2>/dev/null test
+	x=1 export grep done then $(pwd) ${HOME} "$1" done test 2>/dev/null ${HOME}
+	"$@" then /usr/bin --verbose
+--verbose ${HOME} readonly grep "$1" x=1
+		2>/dev/null local grep echo
+	${HOME} local awk cd readonly ${HOME} 2>/dev/null && export export x=1 --verbose
+		done sed 'quoted text' /usr/bin cd x=1 printf | 'quoted text' echo && then
+local then export ${HOME} | "$1" 2>/dev/null x=1 2>/dev/null export printf | /usr/bin
+local --verbose export
+	awk test ${HOME} --verbose export -eu
+	"$1" done x=1 | grep "$@"
+printf export x=1 2>/dev/null 'quoted text'
+		/usr/bin sed export cd | ${HOME} "$@" -eu /usr/bin grep "$1" "$@" | ${HOME}
+${HOME} 2>/dev/null /usr/bin $(pwd) 'quoted text' test echo grep /usr/bin printf
+echo -eu test 2>/dev/null grep | ${HOME} awk sed
+	${HOME} /usr/bin | && echo test echo grep
+		export -eu echo sed sed "$@" /usr/bin ${HOME} echo x=1 then done "$@" echo then
+--verbose echo | ${HOME} -eu echo $(pwd) then awk "$@" "$@" done cd && x=1 "$1"
+		done grep && local "$1" export | ${HOME} done test --verbose /usr/bin 'quoted text'
+		test then echo 2>/dev/null | then | 2>/dev/null
+		'quoted text' export then printf then then export readonly cd awk test 'quoted text'
+	done local $(pwd) "$1" --verbose grep
+	export "$1" cd ${HOME} 'quoted text' --verbose
+"$@" readonly 'quoted text' printf 'quoted text'
+		then sed 'quoted text' echo sed printf
+sed 2>/dev/null readonly grep awk readonly
+		&& export cd && x=1 awk printf sed /usr/bin ${HOME} then ${HOME} 'quoted text'
+		${HOME} "$1" readonly cd && $(pwd) ${HOME} cd ${HOME} $(pwd) readonly cd
+		done -eu grep sed readonly 2>/dev/null
+		-eu readonly "$@" $(pwd) /usr/bin
+-eu cd test "$1" printf x=1 printf "$1"
+sed cd ${HOME} -eu | export awk then ${HOME} cd "$1"
+		test sed sed && "$@" && test test "$@" awk
+		"$@" export -eu "$1" 2>/dev/null export
+		grep echo && --verbose "$1" then /usr/bin readonly done readonly echo
+		-eu "$1" 2>/dev/null grep test && awk printf 'quoted text' $(pwd) grep sed
+&& "$@" then sed 'quoted text' sed test "$1"
+		done --verbose grep export --verbose
+	test -eu readonly test --verbose
+		'quoted text' local --verbose "$@" 'quoted text' local
+	"$@" test x=1 2>/dev/null | then "$@" $(pwd) readonly test grep | 2>/dev/null
+export local awk x=1 cd done && ${HOME}
+		--verbose "$@" --verbose "$1" cd | cd then ${HOME} printf "$@" 'quoted text'
+'quoted text' "$1" awk cd x=1 /usr/bin
+		/usr/bin -eu local && cd test
+		/usr/bin $(pwd) sed sed echo done printf test "$@" done "$1" grep | -eu readonly
+export sed --verbose /usr/bin local done --verbose | $(pwd)
+		done local test printf 2>/dev/null done then grep "$@" grep x=1
+		sed test x=1 export 2>/dev/null 'quoted text' -eu 'quoted text' grep test grep
+	then --verbose "$@" 'quoted text' -eu done local "$1"
+done --verbose grep ${HOME} 'quoted text'
+		cd | cd 'quoted text' done then cd 'quoted text' then | /usr/bin
+	"$@" printf | 2>/dev/null /usr/bin echo "$@" | printf x=1 local done | grep done
+		"$@" sed test echo then local 'quoted text' $(pwd) local local 2>/dev/null
+	"$@" local export printf 'quoted text' "$@" 'quoted text'
+	export x=1 readonly printf awk test local printf 'quoted text'
+		cd -eu | | "$@" | awk sed test echo test readonly --verbose /usr/bin
+		$(pwd) --verbose sed /usr/bin 2>/dev/null echo readonly ${HOME} local
+"$1" awk ${HOME} awk $(pwd) sed $(pwd) local ${HOME} test done export
+		sed export readonly done --verbose 'quoted text'
+	sed -eu 'quoted text' --verbose &&
+	local done then test awk
+sed | sed -eu "$@" cd &&
+| test done "$1" export then ${HOME} printf
+	/usr/bin && /usr/bin sed test && x=1 "$1"
+	$(pwd) --verbose x=1 printf "$@"
+	| | "$1" export --verbose then 'quoted text'
+		then "$1" && grep echo done export export --verbose
+--verbose done cd x=1 2>/dev/null echo "$@" export then printf -eu test /usr/bin
+	readonly --verbose done local "$1"
+		${HOME} awk grep readonly "$1" /usr/bin ${HOME} test "$@"
+	local /usr/bin awk printf then done awk export then export
+--verbose awk sed "$1" done cd
+	export done "$1" sed sed echo | then ${HOME} then ${HOME}
+		printf "$@" | done x=1 'quoted text' "$@" cd | cd awk local
+		printf --verbose && | printf readonly -eu awk done "$1" local "$1" -eu $(pwd)
+		-eu -eu 'quoted text' ${HOME} --verbose -eu | ${HOME}
+	echo 2>/dev/null 2>/dev/null grep ${HOME} cd "$1" awk
+		local printf --verbose 'quoted text' then echo cd ${HOME} "$1" "$1" cd cd echo
+	"$@" then awk | local --verbose then
+	/usr/bin printf awk readonly "$@" 2>/dev/null awk awk ${HOME} --verbose
+		'quoted text' $(pwd) -eu grep cd "$1" -eu ${HOME} $(pwd) export
+	then --verbose export | 'quoted text'
+local x=1 export awk 'quoted text' grep 2>/dev/null done then echo printf
+	grep 2>/dev/null && /usr/bin "$1" 2>/dev/null && /usr/bin 'quoted text' echo
+	readonly 'quoted text' "$@" export -eu -eu
+	${HOME} echo x=1 x=1 x=1
+	then 2>/dev/null "$@" sed test printf ${HOME} cd local
+		x=1 "$1" "$1" then echo ${HOME} -eu "$@" cd printf export awk 2>/dev/null
+		awk export echo local printf printf
+"$1" && | 2>/dev/null grep sed /usr/bin readonly printf 'quoted text' readonly
+		-eu 'quoted text' && local export
+printf x=1 awk | && $(pwd) $(pwd) awk local "$@" readonly
+	readonly "$@" 'quoted text' then
+${HOME} then -eu test 2>/dev/null grep
+printf readonly awk x=1 2>/dev/null 'quoted text' /usr/bin $(pwd)
+$(pwd) echo cd 2>/dev/null /usr/bin "$1" x=1 grep -eu echo 2>/dev/null
+		&& --verbose 'quoted text' && ${HOME}
+		test export $(pwd) $(pwd)
+	sed sed && "$@" ${HOME} 'quoted text' && 'quoted text'
+		&& test sed x=1 ${HOME} test done && $(pwd) printf x=1 2>/dev/null
+$(pwd) | ${HOME} "$1" x=1 2>/dev/null && x=1
+		local -eu $(pwd) cd ${HOME} "$1" readonly $(pwd) readonly
+	export cd cd "$1" sed done --verbose printf done grep then
+	done then readonly test readonly export /usr/bin 2>/dev/null 'quoted text'
+awk x=1 done done && echo x=1 | printf | 'quoted text' test 2>/dev/null
+	"$1" | sed | -eu test /usr/bin $(pwd) test | ${HOME}
+printf "$1" printf x=1 test "$@" /usr/bin echo
+		export -eu | ${HOME} && echo --verbose x=1 test test /usr/bin --verbose
+	done awk --verbose && sed readonly
+--verbose 'quoted text' /usr/bin "$1" x=1 2>/dev/null sed awk printf export
+		echo /usr/bin readonly export
+	"$@" grep -eu && grep grep test echo printf 'quoted text' -eu
+		'quoted text' x=1 export awk /usr/bin --verbose | test 'quoted text' && $(pwd)
+	sed awk "$1" "$@" /usr/bin 'quoted text'
+readonly 'quoted text'
+		export x=1 awk local local && echo | $(pwd) $(pwd) done local
+| then | && printf cd && done export
+	x=1 awk "$1" then awk awk && && readonly readonly && ${HOME} export
+	echo "$1" readonly --verbose echo printf awk -eu /usr/bin
+	grep /usr/bin "$1" done --verbose printf done --verbose cd
+cd -eu awk local ${HOME} done
+		done -eu x=1 done --verbose test done local -eu
+'quoted text' x=1 done -eu $(pwd) && awk --verbose readonly
+	printf $(pwd) local grep 2>/dev/null grep | 2>/dev/null local -eu awk echo
+	sed done /usr/bin | ${HOME} $(pwd) printf
+	&& test /usr/bin /usr/bin | grep "$@" local x=1 ${HOME} echo export "$1"
+--verbose | then awk
+	export --verbose done then x=1 -eu local 2>/dev/null
+		--verbose test then awk
+	export export | "$1" test $(pwd) 2>/dev/null /usr/bin 'quoted text' test && -eu
+	x=1 cd "$@" /usr/bin awk local 2>/dev/null $(pwd) $(pwd) cd "$1" "$1"
+		test test test then -eu readonly --verbose && done ${HOME} cd 2>/dev/null then
+		-eu | && test x=1 $(pwd) "$@" && grep
+		$(pwd) x=1 printf awk && readonly && "$@" test 'quoted text'
+${HOME} printf cd readonly -eu awk grep --verbose
+local "$@" $(pwd) local cd readonly -eu "$1" done 'quoted text' && echo
+		/usr/bin then | local sed awk 'quoted text'
+		| local printf "$1" sed test
+		export done && 'quoted text' 2>/dev/null --verbose --verbose
+	then /usr/bin printf ${HOME} then --verbose --verbose | 'quoted text' && sed sed
+		cd grep x=1 export printf
+	sed cd $(pwd) export ${HOME} printf /usr/bin
+		cd local test $(pwd) $(pwd) 'quoted text' 2>/dev/null 'quoted text' x=1 /usr/bin
+	-eu grep then /usr/bin done
+x=1 -eu test readonly local $(pwd) -eu 'quoted text' ${HOME} awk --verbose
+2>/dev/null then grep printf --verbose 2>/dev/null
+		"$1" 'quoted text' "$1" grep
+x=1 readonly export local grep --verbose && && 2>/dev/null cd grep /usr/bin
+	'quoted text' awk done then "$1" test $(pwd) /usr/bin --verbose --verbose sed
+		2>/dev/null /usr/bin local readonly awk "$@"
+	echo grep 'quoted text' sed export x=1 $(pwd)
+done then ${HOME} export awk cd 2>/dev/null sed grep /usr/bin ${HOME} done
+		readonly export "$1" 'quoted text' test
+sed -eu awk grep grep "$@" 'quoted text' "$@" sed printf | echo local
+done grep $(pwd) ${HOME} sed x=1 test /usr/bin done /usr/bin
+local then $(pwd) 'quoted text' sed cd printf
+$(pwd) printf 'quoted text'
+2>/dev/null cd --verbose x=1 ${HOME} 'quoted text' printf "$@" echo awk done printf
+	export ${HOME} printf /usr/bin --verbose
+	printf /usr/bin grep grep printf "$1"
+	done cd test && then ${HOME} -eu test
+${HOME} done ${HOME} | --verbose awk x=1 x=1 2>/dev/null
+printf printf /usr/bin -eu export cd 2>/dev/null
+--verbose ${HOME} printf echo test "$@" "$1" "$@" sed 'quoted text' x=1
+done sed readonly /usr/bin cd "$@" readonly grep export "$1" sed -eu | done
+"$1" readonly x=1 ${HOME} then && sed --verbose test "$1" awk grep awk
+&& | "$1" export --verbose grep "$@" sed then test 2>/dev/null cd x=1
+--verbose -eu local "$@" done readonly "$1" 'quoted text'
+done test sed done 2>/dev/null sed 2>/dev/null awk echo
+		x=1 sed "$1" done sed cd export "$@" readonly grep 'quoted text' "$@" printf
+&& then /usr/bin "$@" readonly "$1" test
+done x=1 readonly done
+	$(pwd) | /usr/bin printf sed readonly export awk cd "$1"
+	export sed | 2>/dev/null /usr/bin "$@" 2>/dev/null -eu --verbose export
+readonly done 'quoted text' 2>/dev/null -eu sed done local -eu | done test local
+	cd $(pwd) then export test test /usr/bin 'quoted text'
+2>/dev/null cd awk /usr/bin local echo /usr/bin "$@" |
+		readonly | "$1" 'quoted text' local export readonly $(pwd) grep grep cd |
+x=1 'quoted text' export && echo "$@" "$@"
+then -eu && "$1" 2>/dev/null ${HOME} awk | sed then 'quoted text'
+		grep $(pwd) -eu readonly awk
+		"$@" ${HOME} local /usr/bin done | echo readonly awk
+readonly readonly then readonly 2>/dev/null export --verbose $(pwd) local test
+printf /usr/bin then ${HOME} 2>/dev/null awk -eu -eu awk 'quoted text' sed
+"$@" then sed x=1 --verbose
+	printf export --verbose | awk grep export export
+readonly -eu "$@" awk grep
+		&& /usr/bin local printf ${HOME} export $(pwd)
+	grep | readonly /usr/bin x=1 readonly $(pwd) grep test printf test done
+	-eu -eu sed echo | test "$@" test "$@" $(pwd) 2>/dev/null
+		readonly | && 'quoted text'
+-eu test awk local "$1" /usr/bin -eu sed done sed /usr/bin export --verbose
+| grep test then "$1" test $(pwd) done sed cd | && grep x=1 "$@" sed x=1 test
+done awk 2>/dev/null done | then
+$(pwd) grep 2>/dev/null && | ${HOME} -eu
+	-eu export export awk ${HOME} /usr/bin local x=1 export
+$(pwd) then test export |
+echo grep "$@" 2>/dev/null export grep then local then 2>/dev/null
+		2>/dev/null readonly /usr/bin cd echo test -eu
+		'quoted text' --verbose --verbose
+	grep $(pwd) /usr/bin grep cd export "$1" export
+		awk $(pwd) x=1 then "$1" done printf x=1 "$1" ${HOME} test -eu "$1" readonly |
+	cd printf cd "$@" echo cd printf printf -eu x=1 sed /usr/bin
+	| | printf x=1 then "$@" x=1 2>/dev/null && local ${HOME} grep "$1" | && x=1
+export && 'quoted text' grep && "$@" awk -eu /usr/bin
+printf "$1" grep readonly "$@" done 2>/dev/null
+		grep printf 2>/dev/null x=1 done x=1 'quoted text' "$@"
+| export awk printf 'quoted text' -eu readonly cd local cd cd 'quoted text'
+		2>/dev/null && "$@" done $(pwd) printf local test /usr/bin test $(pwd) grep &&
+	&& ${HOME} readonly 'quoted text' cd sed
+		-eu $(pwd) 2>/dev/null sed x=1 grep
+		test 2>/dev/null done 2>/dev/null 2>/dev/null x=1 printf
+		--verbose local "$1" && "$1" && && printf /usr/bin
+	'quoted text' done 'quoted text' ${HOME} done cd done sed then /usr/bin
+	&& printf test test grep
+"$@" awk ${HOME} x=1 | cd grep 'quoted text' local done && "$@" 'quoted text'
+		grep readonly | grep 2>/dev/null then test /usr/bin
+	$(pwd) $(pwd) x=1 /usr/bin export /usr/bin
+		x=1 2>/dev/null printf test x=1 x=1 --verbose done | done "$@" printf && done 'quoted text'
+cd cd /usr/bin 'quoted text' export ${HOME}
+	cd echo cd echo 2>/dev/null $(pwd) readonly then x=1 -eu
+		test "$@" readonly ${HOME} awk export x=1 local readonly grep export --verbose
+		echo sed readonly 2>/dev/null
+	grep | local -eu printf ${HOME} 2>/dev/null $(pwd) cd cd ${HOME}
+		cd test -eu ${HOME} readonly local export done -eu done 'quoted text' awk printf
+'quoted text' sed then x=1 x=1 $(pwd) | cd echo local readonly
+	local sed "$1" -eu test export readonly test
+cd echo cd sed /usr/bin local ${HOME} x=1 then ${HOME}
+		awk 2>/dev/null done sed | then readonly /usr/bin | echo local
+		--verbose "$1" sed awk "$1" sed local sed done "$@" sed $(pwd) cd && grep "$1"
+	"$1" --verbose local readonly export ${HOME}
+		awk "$1" $(pwd) 2>/dev/null readonly export /usr/bin then | sed printf $(pwd)
+		${HOME} cd && ${HOME} | test
+x=1 -eu printf echo -eu test local local test printf
+	then -eu 2>/dev/null "$1" x=1 x=1 then 2>/dev/null readonly
+cd x=1 /usr/bin local echo 'quoted text'
+'quoted text' cd $(pwd) -eu local ${HOME} /usr/bin "$@" "$@" 'quoted text' &&
+	sed test done then awk awk awk export
+		"$@" -eu "$1" 'quoted text' grep local 'quoted text'
+	$(pwd) $(pwd) /usr/bin awk x=1 awk
+		done ${HOME} test 2>/dev/null grep printf done "$@" 2>/dev/null
+		x=1 $(pwd) "$1" x=1 | printf --verbose
+then "$1" local "$1" --verbose "$@"
+		echo $(pwd) /usr/bin awk test --verbose $(pwd)
+	$(pwd) $(pwd) x=1 /usr/bin sed $(pwd) x=1
+		then readonly x=1 /usr/bin && --verbose printf cd "$@" export 2>/dev/null echo
+	readonly ${HOME} "$1" awk grep $(pwd)
+		done 'quoted text' readonly readonly test "$1" 'quoted text' then printf
+		printf --verbose done x=1 printf cd $(pwd)
+		2>/dev/null 'quoted text' $(pwd) then 'quoted text' readonly ${HOME} --verbose
+		local export ${HOME} 2>/dev/null awk x=1 -eu printf 2>/dev/null sed
+echo export printf readonly "$@" 'quoted text' "$@" then test cd && sed 2>/dev/null
+	'quoted text' echo grep $(pwd) printf -eu test "$1" then
+	done cd x=1 -eu readonly sed awk echo local 'quoted text' sed test
+done readonly --verbose "$@" $(pwd) done 'quoted text'
+	awk $(pwd) "$@" /usr/bin
+		"$1" $(pwd) printf 'quoted text' test ${HOME} done && -eu && grep cd $(pwd)
+		--verbose echo --verbose local cd echo local awk -eu x=1 "$@" printf $(pwd) ${HOME}
+--verbose -eu ${HOME} ${HOME} x=1 2>/dev/null
+		cd cd /usr/bin echo | --verbose 2>/dev/null sed local --verbose
+		test && readonly "$1" readonly readonly done readonly then
+		echo readonly --verbose done printf cd readonly | -eu readonly done
+	--verbose $(pwd) done awk -eu export
+		done awk sed --verbose --verbose awk 'quoted text'
+/usr/bin -eu test done "$1" grep --verbose cd 2>/dev/null grep $(pwd)
+		'quoted text' ${HOME} then x=1 $(pwd) ${HOME} awk 2>/dev/null export printf
+	done printf | test local cd ${HOME} /usr/bin
+		"$@" && && awk awk $(pwd)
+	grep test -eu -eu sed cd awk grep echo done ${HOME} 'quoted text'
+		| printf $(pwd) sed local awk export cd /usr/bin then ${HOME}
+&& 'quoted text' 2>/dev/null done readonly test /usr/bin x=1 -eu printf 'quoted text'
+		then /usr/bin | /usr/bin "$1" 2>/dev/null local x=1 awk
+	'quoted text' "$1" local $(pwd) | x=1 "$1" cd --verbose echo readonly "$@"
+		&& readonly x=1 ${HOME} 'quoted text' awk /usr/bin export
+		echo | grep grep readonly cd | grep && /usr/bin &&
+sed "$@" /usr/bin 'quoted text' /usr/bin cd "$1" | printf export | $(pwd) "$@"
+2>/dev/null printf 'quoted text' readonly
+	${HOME} then then local cd echo done test echo
+	test test done done "$1" printf export --verbose grep /usr/bin
+--verbose then export | test --verbose test cd 2>/dev/null printf done x=1
+		/usr/bin --verbose cd $(pwd)
+		"$@" cd x=1 | cd done done "$@" 2>/dev/null
+awk export grep then "$1" cd test --verbose echo cd | && awk | cd 'quoted text'
+	readonly x=1 sed echo $(pwd) sed
+$(pwd) | cd export | --verbose printf cd --verbose --verbose
+done "$1" "$1" awk 'quoted text' /usr/bin readonly
+	--verbose printf 'quoted text'
+--verbose printf "$@" ${HOME} $(pwd) && "$1" test | awk -eu readonly test
+	--verbose awk then cd echo grep
+-eu test echo test awk --verbose done echo cd |
+	--verbose && test | | done 2>/dev/null | /usr/bin test
+	x=1 then test printf sed done x=1 done cd 2>/dev/null done --verbose
+		$(pwd) /usr/bin readonly "$@" && sed "$@" --verbose
+	awk ${HOME} | cd ${HOME} export && 2>/dev/null && --verbose
+		"$1" awk grep done echo 'quoted text' "$1" done sed $(pwd)
+		done "$1" printf local grep sed then "$@" local grep cd -eu && awk readonly
+	printf grep "$@" awk 'quoted text' echo test /usr/bin 'quoted text'
+		| x=1 2>/dev/null $(pwd) printf
+	grep test cd 2>/dev/null test grep --verbose
+	export | /usr/bin export export 'quoted text' /usr/bin awk done
+		-eu && test $(pwd) ${HOME} printf $(pwd) x=1
+		done done 'quoted text' cd cd sed /usr/bin "$@" grep $(pwd) "$@" grep export
+x=1 --verbose ${HOME} local
+		grep grep /usr/bin ${HOME} 2>/dev/null "$1" readonly
+		local ${HOME} echo "$1" | 2>/dev/null /usr/bin local ${HOME}
+then readonly awk $(pwd) | grep ${HOME} readonly export
+export grep then test 2>/dev/null done 2>/dev/null | test local awk x=1
+	${HOME} awk $(pwd) grep x=1 "$1" /usr/bin readonly 2>/dev/null
+	then 2>/dev/null local 'quoted text' export
+	printf /usr/bin readonly export readonly -eu printf grep printf 2>/dev/null done
+	2>/dev/null then local | done -eu sed test --verbose
+	2>/dev/null 'quoted text'
+	cd | done 2>/dev/null --verbose grep awk done cd
+		awk "$1" 'quoted text' | export
+done then echo local cd ${HOME} ${HOME} /usr/bin cd 'quoted text' awk x=1 'quoted text'
+		'quoted text' grep 2>/dev/null
+then $(pwd) local x=1 then "$1" && grep export
+	${HOME} test -eu readonly "$@" "$@" test
+	awk awk $(pwd) grep readonly done done awk test
+printf "$@" && ${HOME}
+	2>/dev/null sed ${HOME} grep 'quoted text' grep
+	${HOME} echo x=1 x=1 ${HOME} local echo -eu awk 2>/dev/null -eu
+sed readonly printf 'quoted text' readonly
+		readonly cd awk && grep done "$1" grep printf export --verbose grep printf "$1"
+	x=1 ${HOME} $(pwd) then then cd $(pwd) | 2>/dev/null echo 2>/dev/null
+readonly x=1 'quoted text' test 2>/dev/null $(pwd) test && "$@" local sed grep export
+awk test readonly printf "$1" cd test ${HOME}
+'quoted text' x=1 && -eu sed awk ${HOME}
+		2>/dev/null ${HOME} test test awk grep done /usr/bin
+	x=1 /usr/bin 2>/dev/null grep printf export $(pwd) echo then readonly export
+	"$@" then printf awk ${HOME} 2>/dev/null
+		grep ${HOME} printf -eu printf 'quoted text' printf "$1" awk -eu done local
+	then sed printf && export
+readonly -eu $(pwd) /usr/bin /usr/bin local
+	"$1" $(pwd) readonly readonly && test | awk
+--verbose readonly $(pwd) 'quoted text' "$@" echo readonly
+printf --verbose then x=1 readonly 'quoted text' awk x=1 ${HOME}
+x=1 test /usr/bin 'quoted text' echo 2>/dev/null "$1"
+	done awk export | 'quoted text' local printf "$1" "$@"
+	grep ${HOME} 'quoted text' $(pwd)
+	echo then then $(pwd) /usr/bin
+grep grep export sed 2>/dev/null -eu local echo then 'quoted text'
+"$1" /usr/bin awk local local "$@" grep 'quoted text'
+		awk echo local 'quoted text' | x=1 x=1 --verbose
+then 2>/dev/null then grep
+	"$@" "$@" 2>/dev/null "$@" 2>/dev/null echo x=1 | printf -eu echo $(pwd) |
+local x=1 test 2>/dev/null export
+	2>/dev/null $(pwd) local done x=1 --verbose | "$@" sed -eu /usr/bin test "$1" x=1
+	$(pwd) local grep | printf then readonly sed -eu && awk export | --verbose
+	-eu "$@" sed done echo local ${HOME} x=1 /usr/bin --verbose /usr/bin awk cd --verbose
+		$(pwd) "$@" grep --verbose "$1" printf local -eu -eu awk /usr/bin then
+	grep grep test awk x=1 ${HOME} ${HOME} echo -eu cd
+		grep -eu then $(pwd) x=1 export awk cd cd printf x=1 cd cd awk | --verbose
+echo done grep cd cd export
+	then | $(pwd) cd "$1"
+readonly /usr/bin "$@" test test
+"$@" echo --verbose sed grep echo -eu $(pwd)
+echo --verbose x=1 grep sed "$1" grep awk x=1 sed awk /usr/bin awk then test |
+	x=1 echo done grep "$@" --verbose cd
+&& ${HOME} awk && /usr/bin done ${HOME} -eu then echo
+then printf -eu && export echo && "$1" grep awk then echo && grep done
+	readonly grep | echo "$1" 'quoted text' cd
+test "$1" echo local cd 2>/dev/null then --verbose $(pwd) "$@" "$@" 2>/dev/null
+	sed "$@" && then | x=1 |
+		'quoted text' "$@" "$@" "$@" readonly printf echo echo $(pwd) export cd 'quoted text'
+/usr/bin done -eu x=1 && /usr/bin $(pwd) export export
+	$(pwd) export grep "$@"
+readonly ${HOME} done | "$1" local "$1" "$1" | done 2>/dev/null
+awk printf | echo "$@" grep echo && /usr/bin local "$@" grep sed --verbose ${HOME}
+"$1" x=1 "$@" grep --verbose
+x=1 grep grep cd test echo | | test readonly echo readonly
+printf awk /usr/bin then ${HOME}
+	/usr/bin --verbose local && awk awk awk export readonly 2>/dev/null
+	done ${HOME} && "$1" awk test echo x=1 then cd local
+done x=1 $(pwd) test -eu -eu "$1"
+	awk readonly ${HOME} ${HOME} x=1 cd printf --verbose /usr/bin
+		test --verbose $(pwd) --verbose
+	"$@" then x=1 | $(pwd)
+	'quoted text' --verbose $(pwd) awk 2>/dev/null awk test local x=1 local ${HOME}
+		sed "$@" --verbose awk | export done --verbose "$1" done local
+	"$@" $(pwd) $(pwd) && x=1 sed "$@" && -eu printf -eu &&
+test awk printf grep grep 'quoted text' ${HOME}
+x=1 sed 2>/dev/null ${HOME} local 'quoted text' && ${HOME}
+		-eu --verbose /usr/bin | --verbose done awk $(pwd) test x=1 "$@" then $(pwd) -eu
+--verbose cd cd "$1" awk sed ${HOME} sed printf --verbose 'quoted text'
+		${HOME} && local printf | && done ${HOME} cd sed awk 2>/dev/null
+	test $(pwd) grep x=1 test "$@" "$1" "$1" readonly 'quoted text'
+export ${HOME} cd sed grep local cd readonly printf "$1" awk
+	${HOME} readonly cd grep done sed
+		awk ${HOME} && /usr/bin printf sed then -eu
+local test echo test /usr/bin
+		'quoted text' awk printf printf "$1" test local done export export export
+		$(pwd) local --verbose printf local "$1" readonly x=1 $(pwd) --verbose
+		"$1" 2>/dev/null && | "$@" sed ${HOME}
+	printf && printf x=1
+	then done $(pwd) --verbose
+/usr/bin grep 'quoted text'
+	$(pwd) $(pwd) printf -eu then test
+/usr/bin readonly then x=1 /usr/bin "$@" --verbose
+"$@" --verbose readonly "$@" x=1
+--verbose | "$@" grep export x=1 x=1 test "$@" test readonly echo /usr/bin
+	local "$1" && && grep then ${HOME} awk && done sed $(pwd)
+		| "$@" echo --verbose ${HOME} "$1" /usr/bin echo
+		"$@" cd export grep awk grep printf && && "$@" done x=1 local sed 2>/dev/null
+		/usr/bin 2>/dev/null grep "$@" -eu awk test export
+2>/dev/null 2>/dev/null grep | readonly awk local /usr/bin cd sed test 2>/dev/null
+$(pwd) $(pwd) -eu ${HOME} export && -eu -eu done export printf $(pwd)
+	x=1 ${HOME} --verbose done export 'quoted text' "$1" x=1
+		printf 'quoted text' done then
+		2>/dev/null done 'quoted text' 'quoted text' $(pwd) -eu /usr/bin then "$@" /usr/bin
+done then /usr/bin echo ${HOME} export $(pwd) 'quoted text'
+	-eu sed sed "$@" printf
+	/usr/bin readonly printf ${HOME} | then x=1 && --verbose readonly $(pwd) then echo
+		--verbose test 'quoted text' test done 'quoted text' echo "$@" printf readonly -eu
+test done "$1" /usr/bin
+	${HOME} "$@" $(pwd) sed $(pwd) "$1" | --verbose 2>/dev/null local
+		local test ${HOME} sed | /usr/bin &&
+	test -eu 'quoted text' readonly "$@" $(pwd) | x=1 -eu "$@" awk
+		then awk export $(pwd) ${HOME}
+$(pwd) grep then cd test $(pwd) $(pwd) -eu 2>/dev/null
+"$1" ${HOME} "$1" ${HOME} done printf done x=1 /usr/bin "$1" | "$1"
+"$@" $(pwd) printf local "$@" x=1 $(pwd) readonly ${HOME} grep --verbose
+cd /usr/bin $(pwd) export then 'quoted text' /usr/bin x=1 cd printf readonly
+	local awk x=1 awk echo --verbose then
+		export echo sed "$1" "$@" "$@" ${HOME} "$1" then "$@" $(pwd)
+		awk done | | done 2>/dev/null awk
+--verbose done $(pwd) /usr/bin ${HOME}
+test && --verbose ${HOME} printf then printf
+		local grep | local cd 'quoted text' then 2>/dev/null
+		'quoted text' sed && -eu "$1" --verbose -eu sed printf | | /usr/bin --verbose
+		cd x=1 /usr/bin $(pwd) export
+"$@" echo ${HOME} && $(pwd)
+test 'quoted text' -eu grep --verbose "$@" readonly 'quoted text'
+sed local done --verbose export "$@" -eu then readonly done /usr/bin done
+	awk local && "$@" x=1 ${HOME} 2>/dev/null | -eu 2>/dev/null sed
+	awk cd /usr/bin awk done then | && export 'quoted text' --verbose
+	-eu local sed "$1" local then readonly
+		$(pwd) "$1" "$1" --verbose 'quoted text'
+"$1" --verbose ${HOME} local x=1 "$1" && sed 2>/dev/null test && grep 2>/dev/null
+		${HOME} ${HOME} $(pwd) grep echo readonly $(pwd) echo readonly sed --verbose /usr/bin
+	printf x=1 /usr/bin cd 'quoted text' ${HOME} 'quoted text' --verbose
+		done /usr/bin done cd done done 'quoted text' test $(pwd) then $(pwd) ${HOME}
+done test local 2>/dev/null | ${HOME} $(pwd) 'quoted text' | "$@" local readonly
+		done /usr/bin ${HOME} ${HOME} test x=1 awk cd && $(pwd) grep printf echo
+		${HOME} sed "$@" awk local awk awk ${HOME} x=1
+	/usr/bin cd x=1 local $(pwd) x=1 $(pwd) cd test "$1" export export --verbose
+| done "$@" grep export 'quoted text' local echo awk 'quoted text'
+		awk cd 'quoted text' /usr/bin local "$@" grep echo ${HOME}
+	readonly done 'quoted text'
+echo && grep 'quoted text' -eu | readonly $(pwd)
+	'quoted text' done $(pwd) then | done && 2>/dev/null "$1" $(pwd) /usr/bin done
+	grep sed test "$1" sed local printf done export cd awk
+	'quoted text' then local awk cd cd sed
+	awk --verbose done | --verbose
+-eu grep "$@" export sed 2>/dev/null then "$@" --verbose readonly x=1 export
+readonly grep --verbose local "$@" sed ${HOME} printf
+		local 'quoted text' x=1 ${HOME} --verbose -eu then -eu &&
+sed local then echo done echo cd export
+		done "$@" done "$1" test cd /usr/bin && echo /usr/bin "$1" 2>/dev/null
+	test readonly test --verbose 2>/dev/null
+		x=1 grep x=1 then sed "$1" echo grep printf
+	'quoted text' local test /usr/bin 2>/dev/null export $(pwd) cd local then "$@"
+		export x=1 grep x=1 export readonly printf
+	"$@" 2>/dev/null 'quoted text' 2>/dev/null x=1
+		local | /usr/bin "$1" /usr/bin "$@"
+	cd then /usr/bin grep done test x=1 | echo local sed | 2>/dev/null "$@" sed
+sed 2>/dev/null "$@" export $(pwd) sed awk x=1 echo printf
+2>/dev/null readonly echo x=1 grep printf done --verbose
+		-eu --verbose echo | printf awk
+	$(pwd) | printf readonly readonly done --verbose local $(pwd)
+local sed then $(pwd) 2>/dev/null printf ${HOME} export
+&& printf cd && cd /usr/bin local
+x=1 cd | $(pwd) export "$1" 2>/dev/null done export
+	x=1 grep | export x=1 sed grep test /usr/bin $(pwd) local local /usr/bin
+local x=1 done -eu printf ${HOME} sed awk x=1 x=1
+then cd then echo | grep ${HOME} -eu | echo -eu && ${HOME}
+	printf && && export /usr/bin ${HOME} $(pwd) -eu grep "$@" test
+/usr/bin cd ${HOME} x=1 "$1"
+		/usr/bin "$1" | "$@" ${HOME} 'quoted text'
+	${HOME} -eu awk "$1" && export local 2>/dev/null x=1 export
+		echo "$@" cd /usr/bin ${HOME} printf /usr/bin sed 'quoted text' /usr/bin "$1"
+	local export grep "$1" x=1 cd "$1"
+	test echo printf then echo cd echo
+	--verbose awk "$1" | 'quoted text' | echo && echo readonly x=1
+		export cd grep grep awk done done readonly "$@" /usr/bin done export
+	echo local "$@" $(pwd) 2>/dev/null readonly "$1" cd | 2>/dev/null
+"$1" --verbose && ${HOME} cd awk echo
+	-eu sed | --verbose echo | local "$@" 'quoted text' local /usr/bin
+local done grep "$1" printf done 'quoted text'
+	-eu --verbose readonly /usr/bin
+		${HOME} done awk && $(pwd) x=1 then then export test local "$@" 2>/dev/null
+	x=1 2>/dev/null "$@" "$1" && ${HOME} then
+'quoted text' awk readonly cd "$1"
+		-eu sed cd && grep readonly awk export
+		| 'quoted text' printf test
+		then --verbose awk "$1" x=1 /usr/bin
+local test test -eu sed local && -eu && cd --verbose grep /usr/bin
+		"$@" $(pwd) "$@" 2>/dev/null "$@" cd 2>/dev/null "$@" awk sed $(pwd) local /usr/bin
+		2>/dev/null printf x=1 then
+		sed export grep 2>/dev/null sed cd
+then /usr/bin 'quoted text' test test local local -eu printf
+x=1 -eu && "$1" && x=1 cd local -eu $(pwd) done ${HOME} 'quoted text'
+/usr/bin printf ${HOME} 2>/dev/null --verbose awk printf
+export cd -eu grep "$@" 'quoted text' cd sed "$1"
+		export $(pwd) x=1 echo -eu --verbose export "$@"
+printf | x=1 /usr/bin export done ${HOME}
+	"$1" --verbose grep /usr/bin awk sed $(pwd) readonly
+		&& --verbose export grep $(pwd) -eu "$1" readonly
+test x=1 ${HOME} /usr/bin readonly echo export $(pwd)
+grep /usr/bin cd $(pwd) 2>/dev/null echo sed "$@" ${HOME}
+		'quoted text' 'quoted text' "$@"
+sed echo cd test awk 'quoted text'
+	2>/dev/null 'quoted text' export done /usr/bin
+		then done grep --verbose grep cd /usr/bin | -eu 2>/dev/null test
+		&& | local "$@" grep -eu ${HOME}
+		x=1 local "$@" "$@" 'quoted text' test ${HOME} 2>/dev/null
+		2>/dev/null | sed grep sed grep readonly $(pwd) test
+	awk awk export sed printf && local 2>/dev/null -eu test | test printf readonly
+	'quoted text' x=1 --verbose "$@" 2>/dev/null -eu readonly local | grep "$@" | "$@"
+2>/dev/null ${HOME} --verbose local test test ${HOME} printf "$@" x=1 cd x=1
+	readonly -eu test $(pwd) $(pwd) 'quoted text'
+	awk sed && local readonly readonly local 2>/dev/null then printf $(pwd) 2>/dev/null
+		done local done awk export
+	done readonly 'quoted text' /usr/bin grep done "$1" 'quoted text'
+	grep local grep 2>/dev/null 'quoted text'
+printf printf /usr/bin 2>/dev/null
+		--verbose sed -eu /usr/bin test "$1" cd printf
+		'quoted text' then cd then export && 2>/dev/null -eu 2>/dev/null echo
+	/usr/bin printf $(pwd) ${HOME}
+		-eu echo $(pwd) then /usr/bin sed printf "$@" --verbose | --verbose sed
+		sed $(pwd) -eu grep awk
+		| awk local --verbose -eu export export test "$1" | test export echo printf
+	| echo echo done then grep
+awk export "$@" 'quoted text' then "$@" local echo x=1 ${HOME}
+		&& awk cd --verbose --verbose 'quoted text' done "$1" "$@"
+/usr/bin cd printf readonly awk "$1" awk echo -eu
+	export x=1 $(pwd) ${HOME} local "$@" /usr/bin done printf "$@" readonly x=1 awk
+'quoted text' ${HOME} local /usr/bin awk 'quoted text' sed $(pwd)
+	/usr/bin --verbose | ${HOME} awk cd export printf
+echo echo echo test --verbose
+		"$1" then "$1" $(pwd) --verbose
+&& "$1" /usr/bin sed x=1 cd local "$1" awk echo cd 'quoted text'
+	'quoted text' ${HOME} export export
+		'quoted text' printf --verbose sed && readonly -eu 2>/dev/null
+		'quoted text' export "$1" -eu echo "$@"
+	readonly then 2>/dev/null 2>/dev/null grep "$@" then /usr/bin
+--verbose && x=1 2>/dev/null readonly readonly ${HOME} -eu /usr/bin local
+		--verbose ${HOME} grep local ${HOME} readonly | echo sed export 'quoted text'
+local readonly $(pwd) | $(pwd) "$1" cd -eu
+printf "$@" $(pwd) export sed x=1 export | echo "$@" "$1" sed
+		${HOME} awk ${HOME} printf test test /usr/bin x=1 && local
+		cd ${HOME} then then 2>/dev/null export ${HOME} cd then "$@"
+	done x=1 readonly /usr/bin echo $(pwd) | ${HOME} readonly && cd test -eu | 2>/dev/null
+		x=1 grep 'quoted text' sed "$@" --verbose
+2>/dev/null readonly grep 'quoted text'
+		done --verbose readonly
+'quoted text' "$@" | grep && "$@" cd echo 'quoted text' printf export
+-eu && "$@" x=1 cd sed readonly test 2>/dev/null export grep /usr/bin grep /usr/bin
+		/usr/bin ${HOME} && test grep export sed ${HOME} test "$@" x=1 "$@" | $(pwd)
+${HOME} awk ${HOME} test local -eu "$@" test cd printf readonly printf
+printf test then then --verbose ${HOME} ${HOME} 'quoted text' --verbose
+		then awk local x=1 printf awk /usr/bin
+	test ${HOME} /usr/bin then && --verbose | 'quoted text'
+	readonly awk cd x=1 2>/dev/null awk done "$1"
+cd cd printf sed -eu "$@" cd grep then awk -eu "$1" done $(pwd) ${HOME}
+$(pwd) test 'quoted text'
+	test $(pwd) 2>/dev/null 2>/dev/null printf | grep grep /usr/bin
+"$@" done x=1 export done test && -eu $(pwd) -eu
+		/usr/bin then 2>/dev/null $(pwd) done $(pwd)
+	export test test cd -eu cd "$@" x=1
+	printf "$@" -eu local
+		$(pwd) local local readonly readonly
+| export grep /usr/bin x=1 | printf && "$1"
+	2>/dev/null --verbose $(pwd) "$1" printf grep -eu /usr/bin
+	grep /usr/bin "$@" test test test -eu "$@" --verbose local local readonly
+		2>/dev/null printf 'quoted text'
+		x=1 echo echo /usr/bin &&
+	grep "$@" "$1" export /usr/bin done -eu then "$@" readonly
+		'quoted text' awk readonly x=1 then "$@" then awk
+readonly /usr/bin local test | cd cd cd readonly "$@"
+done readonly "$1" readonly
+awk local -eu -eu cd $(pwd) 2>/dev/null grep
+		$(pwd) | cd local x=1 export -eu readonly "$@" sed test awk
+		2>/dev/null awk done local && printf test local
+local echo cd 'quoted text' test sed readonly "$1" "$1" /usr/bin cd x=1 echo
+done export readonly then sed --verbose printf
+		export export awk x=1 grep
+readonly grep awk cd then printf | x=1 test 'quoted text' ${HOME} 'quoted text'
+	cd && --verbose cd --verbose then
+	'quoted text' "$1" $(pwd) && "$1" 2>/dev/null done "$1" cd sed "$@" grep
+done /usr/bin --verbose --verbose "$@" printf grep 'quoted text'
+| export grep ${HOME} 2>/dev/null
+local "$@" local "$1" sed $(pwd) awk --verbose sed
+	"$1" then local "$@" awk export awk
+		sed ${HOME} ${HOME} --verbose awk "$1" 'quoted text'
+sed grep x=1 readonly $(pwd) test printf ${HOME}
+'quoted text' $(pwd) 2>/dev/null 2>/dev/null test awk printf 'quoted text'
+	$(pwd) ${HOME} 'quoted text' "$@" --verbose
+	printf awk /usr/bin readonly local
+	echo grep awk echo /usr/bin
+"$1" -eu echo "$@" | export
+	local echo "$1" ${HOME} local export && -eu then printf $(pwd) grep 2>/dev/null
+/usr/bin 'quoted text' "$@" readonly
+	printf 'quoted text' /usr/bin echo | ${HOME} sed 'quoted text'
+		cd printf "$@" --verbose
+	test echo sed 'quoted text' 2>/dev/null x=1 | ${HOME} done local
+		sed local | export echo "$1"
+	/usr/bin readonly test cd --verbose printf
+		"$@" cd | then "$@" local awk -eu && readonly "$@" -eu cd
+	&& cd /usr/bin "$@" awk done 2>/dev/null local export cd | grep --verbose x=1
+		2>/dev/null "$1" done echo awk export && awk echo export ${HOME}
+	test export "$@" readonly -eu
+	"$@" 'quoted text' local x=1 -eu | --verbose ${HOME}
+		&& ${HOME} export "$@" cd && test done
+		awk cd 'quoted text' export 2>/dev/null
+		then -eu printf local --verbose
+	grep awk then test test 'quoted text' done --verbose
+readonly local -eu grep x=1 awk "$1" done
+/usr/bin local cd "$1" --verbose $(pwd)
+	&& -eu cd sed printf awk
+		test cd export | "$1" echo printf then x=1 --verbose done -eu --verbose done
+		echo -eu printf | | 'quoted text' export
+	/usr/bin sed cd x=1 $(pwd) printf -eu sed -eu
+		"$@" 'quoted text' && 2>/dev/null
+	x=1 --verbose printf printf /usr/bin --verbose awk "$1" 2>/dev/null
+		--verbose export local readonly then 2>/dev/null "$1" test
+	'quoted text' -eu /usr/bin "$@"
+export readonly "$1" && 2>/dev/null done local test
+	cd sed cd sed then /usr/bin
+		sed x=1 "$1" 2>/dev/null done done awk echo -eu awk test test "$@" 2>/dev/null
+		sed test -eu awk grep done | $(pwd)
+	| /usr/bin "$1" test printf cd sed "$1" done cd "$1" done ${HOME} then
+--verbose awk done sed x=1 cd $(pwd) && 2>/dev/null 2>/dev/null $(pwd) "$1"
+	grep | sed done then sed /usr/bin
+awk then --verbose then local local | grep "$@" | done echo cd 2>/dev/null echo
+	-eu "$1" && && echo grep done $(pwd) /usr/bin 2>/dev/null grep
+		"$1" export echo echo $(pwd) export /usr/bin | && | printf
+		-eu grep grep echo $(pwd) "$@" export 2>/dev/null printf "$1" && --verbose
+	done echo 2>/dev/null echo x=1 | | && x=1 2>/dev/null
+'quoted text' sed ${HOME} && sed 2>/dev/null cd sed cd echo cd 2>/dev/null awk
+	awk x=1 grep awk test done then
+		sed cd "$@" cd readonly && | x=1 --verbose printf -eu done cd ${HOME} | x=1
+		export $(pwd) -eu $(pwd) then $(pwd) local printf "$@" cd done cd && | grep cd
+x=1 "$1" | printf 'quoted text' 'quoted text' -eu sed /usr/bin
+readonly | awk x=1 && ${HOME} "$@" then then
+	local x=1 /usr/bin cd grep $(pwd) $(pwd) ${HOME} -eu awk test local grep echo
+	${HOME} readonly | $(pwd) 2>/dev/null done cd && && "$1" $(pwd) /usr/bin
+		-eu $(pwd) sed local $(pwd) "$1" --verbose printf cd "$1" awk awk -eu echo grep
+		then sed && grep "$@" sed x=1 grep "$1" sed local 'quoted text' awk
+&& | 2>/dev/null awk /usr/bin $(pwd) sed -eu
+		${HOME} done cd && echo $(pwd)
+	&& printf x=1 then awk export $(pwd)
+	$(pwd) 2>/dev/null -eu && done
+	local && export readonly local 'quoted text' $(pwd) --verbose $(pwd) $(pwd) /usr/bin
+		printf then && readonly $(pwd)
+		--verbose /usr/bin 'quoted text' test readonly
+--verbose export then ${HOME} "$1"
+	test "$1" | grep ${HOME}
+export local local printf "$@" echo 'quoted text'
+	done awk then export --verbose --verbose sed
+		/usr/bin readonly --verbose /usr/bin --verbose
+	/usr/bin test local 2>/dev/null local readonly printf "$@"
+2>/dev/null test 2>/dev/null "$@" grep --verbose sed local &&
+'quoted text' done /usr/bin
+local done done x=1 printf --verbose x=1
+		export echo then cd 'quoted text'
+"$@" "$1" export -eu | --verbose done readonly x=1 /usr/bin 'quoted text'
+test | "$@" ${HOME} done -eu echo test sed "$@" printf
+sed && --verbose test "$1" | 2>/dev/null -eu | --verbose
+		"$@" grep test then printf readonly sed
+		${HOME} test then --verbose --verbose ${HOME} echo done /usr/bin --verbose
+	readonly readonly test awk
+${HOME} "$@" then cd test && then $(pwd) "$@" grep cd cd &&
+$(pwd) x=1 grep 'quoted text'
+test local "$1" -eu printf grep "$@" "$@" $(pwd) /usr/bin
+		/usr/bin | /usr/bin "$@" sed readonly
+awk local 2>/dev/null local local readonly /usr/bin x=1 echo cd "$@" sed $(pwd)
+	${HOME} | export sed
+		cd export 2>/dev/null then cd /usr/bin test 'quoted text' readonly grep
+	'quoted text' && echo $(pwd) $(pwd) "$@" && test "$1"
+2>/dev/null | 'quoted text' "$@"
+	then && grep /usr/bin awk ${HOME} sed export
+	local && "$@" sed x=1 ${HOME} && && /usr/bin
+printf local grep export 'quoted text' "$1" /usr/bin 'quoted text'
+		local 'quoted text' readonly 2>/dev/null done && "$@" local && echo
+		'quoted text' sed "$1" 2>/dev/null "$@" "$1" cd cd printf x=1 export then
+		sed printf && test then
+		'quoted text' printf &&
+		'quoted text' done ${HOME} awk echo grep export ${HOME} "$@" export x=1
+	test 2>/dev/null awk local /usr/bin
+awk /usr/bin ${HOME} grep "$@" awk test ${HOME}
+	awk "$@" x=1 cd then printf sed | export && 'quoted text' local
+		'quoted text' /usr/bin $(pwd) 'quoted text'
+	printf done test x=1 sed local x=1 /usr/bin && && "$@" /usr/bin export
+		--verbose readonly cd
+"$1" readonly --verbose --verbose readonly
+		export local grep sed $(pwd) && x=1 ${HOME} export --verbose awk 2>/dev/null
+		| && /usr/bin export export grep export
+		$(pwd) && ${HOME} -eu
+	readonly test readonly
+		echo echo cd readonly local 2>/dev/null /usr/bin -eu printf "$1" awk
+		sed --verbose echo awk x=1 cd readonly /usr/bin && --verbose -eu 2>/dev/null
+		"$1" cd $(pwd) cd echo local 'quoted text'
+	-eu done done then 2>/dev/null local ${HOME} grep printf sed test
+--verbose x=1 grep test then 2>/dev/null local
+	grep "$1" --verbose export
+--verbose 'quoted text' then echo --verbose awk x=1 |
+${HOME} ${HOME} --verbose readonly $(pwd) "$1" $(pwd) $(pwd)
+	then "$@" --verbose x=1
+	cd /usr/bin done 2>/dev/null
+export echo printf 'quoted text' 2>/dev/null
+	"$@" echo "$1" ${HOME} 'quoted text' | | --verbose ${HOME}
+	awk export 'quoted text' 'quoted text' cd readonly readonly
+		-eu 'quoted text' "$@" then 2>/dev/null
+		local x=1 -eu echo local printf export
+		printf then done "$1" && printf -eu export then /usr/bin && && then | ${HOME}
+	grep export x=1 cd --verbose --verbose then export printf
+grep --verbose --verbose --verbose "$@" grep | echo printf test
+-eu cd readonly | && --verbose local then -eu 2>/dev/null ${HOME} "$1"
+		export 'quoted text' export awk ${HOME}
+test test "$@" local local then "$1" 'quoted text'
+echo 'quoted text' ${HOME} readonly readonly test "$@"
+		printf sed test "$@" "$@"
+	printf printf readonly
+	-eu local export x=1 cd local readonly echo printf export
+	2>/dev/null printf "$1" -eu $(pwd)
+		2>/dev/null --verbose | 2>/dev/null | grep "$@" 'quoted text' printf
+	sed done printf && cd cd echo export done | grep awk awk grep 2>/dev/null
+		export echo x=1 awk test grep
+		$(pwd) grep && "$@" 2>/dev/null 'quoted text' test local 'quoted text' 'quoted text'
+"$1" echo local sed 'quoted text' "$@" grep grep /usr/bin | then readonly
+	"$@" | | 'quoted text' | "$@" grep x=1 local x=1 2>/dev/null
+	printf | $(pwd) 2>/dev/null local awk test 'quoted text' "$1" $(pwd) ${HOME} |
+then printf cd then ${HOME} ${HOME} awk awk awk x=1 | "$1" $(pwd) -eu 2>/dev/null
+	| test done local $(pwd) && "$1" sed
+	2>/dev/null -eu cd x=1 export "$@" cd --verbose cd -eu readonly
+	${HOME} grep printf sed --verbose
+local /usr/bin 2>/dev/null $(pwd) ${HOME} x=1 export ${HOME} | && test test
+		$(pwd) local -eu printf done awk 'quoted text' done $(pwd) awk awk $(pwd) ${HOME}
+		then awk x=1 done 'quoted text'
+		$(pwd) echo x=1 then done then echo |
+${HOME} test | "$@" | -eu export "$1" test grep x=1
+		-eu sed readonly 2>/dev/null "$@" ${HOME} /usr/bin -eu awk then "$1" echo --verbose
+	grep --verbose "$1" awk && /usr/bin cd -eu done
+	&& export 'quoted text' test
+	2>/dev/null awk sed grep sed local sed done echo $(pwd)
+then done && ${HOME} ${HOME} done grep -eu &&
+then test x=1 then then then test
+	test x=1 ${HOME} "$1" "$1" -eu grep --verbose
+${HOME} 2>/dev/null grep test --verbose
+grep echo "$1" printf && "$1" then && /usr/bin
+		export && sed test /usr/bin "$1"
+	readonly sed awk awk readonly $(pwd) echo printf local awk && printf
+	"$@" readonly printf sed grep grep test export printf export &&
+	'quoted text' /usr/bin echo
+	--verbose then "$@" 2>/dev/null export readonly export done --verbose awk then
+${HOME} grep test "$1" x=1 printf then cd grep readonly awk | --verbose
+done && then sed cd then done readonly printf --verbose ${HOME} export export
+	cd $(pwd) "$1" test -eu awk && --verbose cd awk "$1" x=1 cd
+	echo export sed "$1" ${HOME} ${HOME} && readonly readonly cd
+'quoted text' "$1" | grep
+sed local export sed test awk export awk ${HOME} $(pwd) "$@" 'quoted text'
+	test -eu sed ${HOME} then done | awk local echo done ${HOME} echo && then
+	2>/dev/null done then cd then -eu grep cd then -eu readonly awk x=1 "$1" cd --verbose
+test test sed --verbose
+	-eu /usr/bin printf awk printf 'quoted text' echo test grep test
+		awk done 2>/dev/null cd x=1 local | cd x=1 'quoted text' "$1" x=1 awk sed -eu
+2>/dev/null /usr/bin local export
+		| /usr/bin cd grep readonly
+grep "$1" export cd 'quoted text' awk
+		awk | && printf grep --verbose readonly -eu export $(pwd)
+	done done then /usr/bin --verbose
+		local | ${HOME} cd x=1 then printf 2>/dev/null
+		"$@" 2>/dev/null printf x=1 x=1 local readonly 2>/dev/null
+		${HOME} "$@" then printf 2>/dev/null
+		--verbose readonly 2>/dev/null export export 2>/dev/null
+		'quoted text' readonly --verbose 'quoted text'
+	x=1 sed cd test $(pwd) ${HOME} done cd echo "$1" grep
+grep printf then grep -eu "$@" ${HOME} grep | local x=1 local then 2>/dev/null
+&& 2>/dev/null "$1" 2>/dev/null sed awk export $(pwd) | "$1"
+		then printf $(pwd) --verbose "$@" && x=1 grep done
@@ -0,0 +1,2001 @@
+	--verbose local x=1 awk x=1 export "$1" "$1"
+		"$@" grep cd test printf "$1"
+	"$1" export "$@" cd done grep && then readonly
+	sed /usr/bin -eu 'quoted text' x=1 && --verbose && sed
+test x=1 | $(pwd) test grep x=1 2>/dev/null
+	done && $(pwd) readonly cd done export
+readonly x=1 'quoted text'
+"$@" sed "$1" $(pwd) 'quoted text' awk then printf "$@" cd
+readonly "$@" 2>/dev/null x=1
+	$(pwd) printf ${HOME} cd && sed grep sed "$1" readonly "$1" 'quoted text'
+		sed grep 'quoted text' /usr/bin export 'quoted text' echo --verbose readonly
+		| awk readonly $(pwd) 'quoted text' x=1 test test readonly awk && "$@" printf
+"$@" export sed | "$@" x=1 'quoted text' $(pwd) 2>/dev/null sed test
+	export echo printf && && done $(pwd) cd readonly 2>/dev/null grep
+		test --verbose $(pwd) "$1" --verbose export "$@" readonly x=1 done "$1" $(pwd) local
+		--verbose test -eu then grep x=1
+		&& --verbose $(pwd) readonly x=1 "$1" readonly readonly $(pwd) x=1
+	&& 2>/dev/null -eu -eu then echo done && done &&
+		test awk --verbose && 2>/dev/null echo ${HOME} echo done cd printf
+sed 'quoted text' ${HOME} && done echo "$1" x=1 awk test "$@" --verbose test "$@"
+	grep readonly grep 'quoted text' 'quoted text' echo sed "$@" cd printf echo done
+cd local ${HOME} /usr/bin printf printf then --verbose
+	"$@" done "$@" 'quoted text' -eu 2>/dev/null echo readonly /usr/bin
+	-eu done -eu test x=1 printf ${HOME} -eu
+export --verbose sed sed test readonly then 2>/dev/null "$@"
+	grep then && && readonly "$1" awk test cd test
+2>/dev/null printf "$1" then done test
+	&& x=1 ${HOME} /usr/bin 'quoted text' | test
+	&& echo printf cd grep local echo
+local "$@" echo local "$1" echo export --verbose | local
+		--verbose local -eu --verbose 'quoted text'
+	then echo then ${HOME} export
+2>/dev/null done sed awk | sed cd grep -eu 2>/dev/null "$1" $(pwd) "$@"
+awk /usr/bin 'quoted text' -eu awk $(pwd) --verbose
+	cd $(pwd) done printf 2>/dev/null /usr/bin -eu ${HOME} awk "$@"
+then grep local readonly test /usr/bin "$@" awk printf cd
+	2>/dev/null 2>/dev/null readonly cd x=1 export readonly | $(pwd)
+		readonly grep ${HOME}
+	'quoted text' local test $(pwd) /usr/bin cd "$@" "$@" --verbose export | -eu
+		then $(pwd) 'quoted text' 2>/dev/null "$@" 'quoted text' 'quoted text'
+"$1" "$@" printf --verbose "$1" ${HOME} awk echo cd 2>/dev/null 2>/dev/null
+export | ${HOME} | readonly echo "$@" $(pwd) "$1" && readonly
+		local "$1" local readonly cd readonly 2>/dev/null
+	printf printf printf local | ${HOME} 'quoted text' local
+sed --verbose | printf --verbose ${HOME} printf
+	then export && && $(pwd) test done cd local /usr/bin && readonly
+	| | test cd -eu export --verbose
+		local done readonly cd 2>/dev/null x=1 2>/dev/null
+	"$1" -eu grep awk -eu $(pwd) --verbose
+		printf --verbose cd done
+		${HOME} ${HOME} done /usr/bin grep done test echo printf printf 'quoted text'
+test "$@" sed then echo --verbose sed cd
+	"$@" x=1 sed then echo /usr/bin readonly
+&& export "$1" 'quoted text' x=1 readonly
+	"$1" -eu "$@" sed done "$@" cd printf
+		x=1 x=1 | then $(pwd) 2>/dev/null 'quoted text' local
+	local "$1" --verbose $(pwd) grep export test 2>/dev/null
+		cd "$@" readonly 2>/dev/null test then "$1"
+	2>/dev/null grep printf $(pwd) test $(pwd) readonly
+test awk x=1 ${HOME} x=1 readonly &&
+readonly sed awk "$@" 'quoted text' printf test then readonly awk cd sed
+		readonly 'quoted text' sed readonly local
+	-eu | $(pwd) "$@" && "$@" done /usr/bin test grep printf
+	sed local | && -eu /usr/bin && -eu -eu test done grep
+	"$1" done -eu 'quoted text' x=1 x=1 -eu x=1 then done
+		cd sed x=1 2>/dev/null awk awk 2>/dev/null
+2>/dev/null --verbose grep -eu test awk ${HOME}
+	readonly export then echo then x=1 | 'quoted text'
+		awk grep -eu --verbose x=1 export sed sed && "$@" "$@" ${HOME} echo
+awk local | done sed "$1" sed --verbose
+		sed /usr/bin grep then local -eu
+	&& | cd /usr/bin "$1" x=1 cd grep $(pwd) local ${HOME}
+readonly $(pwd) $(pwd) readonly readonly echo then echo grep
+		export awk x=1 2>/dev/null printf test "$1" 2>/dev/null && test ${HOME}
+		readonly test cd sed test export grep readonly
+		| "$@" awk readonly "$@" local awk local then x=1 then 'quoted text'
+		local grep -eu --verbose grep echo awk echo grep readonly echo
+	${HOME} awk 2>/dev/null "$@" 'quoted text'
+${HOME} test printf x=1 readonly | x=1 sed readonly echo
+	readonly -eu printf echo && test awk | 'quoted text' "$@" done done test /usr/bin
+		x=1 grep awk readonly x=1 grep -eu && local local && 'quoted text' then grep
+	-eu 2>/dev/null -eu |
+		${HOME} grep printf --verbose grep 2>/dev/null printf $(pwd) cd --verbose
+		done readonly done && ${HOME} "$1" 'quoted text'
+	${HOME} grep test -eu 'quoted text'
+grep test echo --verbose ${HOME}
+	printf && | echo echo | test printf cd $(pwd) "$1" "$@"
+local $(pwd) export && awk -eu "$1"
+--verbose sed "$1" 2>/dev/null 'quoted text' /usr/bin ${HOME} /usr/bin
+		/usr/bin sed cd cd "$@" awk "$@" &&
+-eu local export sed $(pwd) export
+		sed echo done "$@" sed
+"$1" printf awk /usr/bin cd -eu ${HOME}
+		then readonly export readonly "$@" -eu x=1 done printf /usr/bin
+	sed sed 2>/dev/null sed sed |
+	sed sed local | export ${HOME} grep then then local
+		sed "$1" ${HOME} 'quoted text' 2>/dev/null
+		&& | 'quoted text' $(pwd) readonly /usr/bin x=1 then sed "$@" ${HOME}
+	'quoted text' awk readonly awk "$@" "$@"
+		done 2>/dev/null -eu $(pwd) 'quoted text'
+		$(pwd) -eu "$1" "$1" x=1 -eu then then | -eu -eu export readonly
+	"$@" "$1" | ${HOME} && 2>/dev/null /usr/bin export echo
+then done --verbose grep --verbose then export 2>/dev/null
+	-eu awk cd then | awk then $(pwd) ${HOME} $(pwd) "$@" cd $(pwd) local awk
+		'quoted text' cd 2>/dev/null 2>/dev/null grep x=1 | test echo
+	'quoted text' $(pwd) grep echo $(pwd) awk printf "$1" done
+	&& ${HOME} x=1 x=1 /usr/bin
+	&& local local then "$1" then --verbose -eu local printf "$@" ${HOME} && $(pwd)
+$(pwd) cd test echo $(pwd) readonly x=1 local 2>/dev/null
+		awk cd 2>/dev/null && grep awk | /usr/bin && | && | export sed then | export
+then 2>/dev/null local | cd | "$1" export /usr/bin
+	local grep x=1 awk 'quoted text' -eu local -eu x=1 "$@" then | export export /usr/bin
+	sed ${HOME} 2>/dev/null 2>/dev/null printf
+	test | grep "$1" 'quoted text' x=1 --verbose -eu done $(pwd) awk
+		2>/dev/null sed sed | $(pwd) | | /usr/bin /usr/bin printf
+/usr/bin test printf ${HOME} 2>/dev/null $(pwd)
+	'quoted text' export | export -eu "$1" $(pwd)
+		'quoted text' x=1 "$1"
+	local printf export awk printf && 2>/dev/null x=1 ${HOME}
+		sed x=1 | echo echo | export x=1 | 'quoted text'
+		local $(pwd) x=1 'quoted text' 2>/dev/null cd --verbose sed readonly
+		sed "$@" echo test x=1 local done done then local /usr/bin
+		| x=1 grep x=1 local sed
+awk | test test "$1" "$@" test /usr/bin printf "$1" awk readonly
+		&& /usr/bin local echo --verbose 2>/dev/null
+		x=1 local done x=1 x=1 | "$@" 'quoted text' /usr/bin
+		local | local test printf then | awk done sed --verbose awk $(pwd) /usr/bin
+		test echo x=1 $(pwd) export awk local export then &&
+		2>/dev/null readonly
+	${HOME} readonly 2>/dev/null
+$(pwd) export export done 'quoted text' local | local echo test 'quoted text'
+	grep | | | cd test 'quoted text' && /usr/bin ${HOME} 'quoted text' x=1 "$@"
+	awk x=1 echo 2>/dev/null awk $(pwd) x=1 echo cd "$1" cd done awk ${HOME} grep "$1"
+	-eu then readonly 'quoted text' x=1 done && | 2>/dev/null
+export then printf test
+		$(pwd) export then sed local && /usr/bin
+		export | --verbose "$1" local && | | -eu /usr/bin
+awk 2>/dev/null cd --verbose
+$(pwd) readonly awk 'quoted text'
+done "$1" /usr/bin x=1 export grep readonly
+		local local done "$1" awk 2>/dev/null
+	echo echo $(pwd) /usr/bin local 2>/dev/null printf --verbose "$1" test grep done
+/usr/bin sed | grep 2>/dev/null grep export 2>/dev/null
+	done printf local 2>/dev/null cd cd $(pwd) ${HOME} export ${HOME} $(pwd) done |
+	--verbose --verbose printf "$@" awk done echo --verbose x=1 ${HOME}
+	printf test /usr/bin $(pwd) sed done x=1 readonly
+		then local x=1 $(pwd) 2>/dev/null --verbose
+$(pwd) 2>/dev/null awk grep export cd x=1 | 'quoted text'
+local -eu | test /usr/bin awk local test cd ${HOME} then -eu awk "$@" export |
+		readonly done test then test done echo "$1" -eu printf "$1" cd
+	-eu awk ${HOME} local -eu --verbose $(pwd) grep -eu
+	awk | local local done grep test done --verbose ${HOME} printf x=1 2>/dev/null
+	awk then readonly printf cd x=1 sed "$@" && echo
+		readonly sed test test export 'quoted text'
+	--verbose 'quoted text' | printf echo -eu 'quoted text'
+		${HOME} local "$1" /usr/bin | /usr/bin && x=1
+"$1" $(pwd) then done awk -eu printf
+	grep readonly x=1 grep cd local echo test local then ${HOME} "$1" done
+		"$@" then local local "$1" echo x=1
+	&& "$1" x=1 done export $(pwd) "$1" printf "$1"
+$(pwd) "$@" "$1" echo "$1" | awk cd
+test echo printf 'quoted text'
+	then done /usr/bin | test && printf x=1 local test | done
+	grep && echo -eu $(pwd) x=1 | export
+	$(pwd) | 'quoted text' -eu x=1 grep test test $(pwd)
+		/usr/bin ${HOME} 'quoted text' "$@" local done cd done echo x=1
+	--verbose echo --verbose "$@" 2>/dev/null /usr/bin -eu readonly
+printf done 'quoted text' then test readonly test -eu --verbose grep echo
+$(pwd) --verbose /usr/bin export 2>/dev/null
+		"$1" 'quoted text' $(pwd) "$1" | test
+"$1" -eu readonly -eu x=1 --verbose | ${HOME} && echo awk readonly local "$1"
+		&& then /usr/bin ${HOME} grep 2>/dev/null local echo ${HOME}
+'quoted text' -eu printf $(pwd) then x=1 "$@" local done -eu | && &&
+printf awk x=1 grep readonly
+	-eu grep readonly echo -eu -eu 'quoted text'
+$(pwd) sed /usr/bin echo printf done
+echo | -eu cd local printf --verbose "$1" echo "$1" ${HOME}
+grep ${HOME} done && x=1 ${HOME} echo x=1 /usr/bin test cd awk test export
+&& ${HOME} sed echo echo | 'quoted text'
+	--verbose export awk sed /usr/bin ${HOME} x=1 "$@" "$1" printf
+		$(pwd) sed awk export test 2>/dev/null "$1" printf
+	then awk | x=1 grep readonly test
+grep readonly readonly echo 2>/dev/null
+2>/dev/null then /usr/bin x=1
+	cd --verbose $(pwd) 2>/dev/null --verbose done x=1 printf 'quoted text'
+-eu echo printf local && "$1" && cd "$1"
+		export grep grep "$@"
+		readonly /usr/bin x=1 readonly 'quoted text' local export $(pwd) /usr/bin
+	&& --verbose x=1 && && readonly awk /usr/bin "$1" awk
+| export grep then 'quoted text' /usr/bin readonly grep ${HOME} echo
+	"$@" then readonly printf && "$1"
+test sed $(pwd) printf printf $(pwd) x=1 awk test export
+		$(pwd) --verbose local && printf printf readonly grep /usr/bin
+local "$@" printf local $(pwd) sed "$1" -eu "$@" readonly ${HOME}
+"$@" test cd then done then /usr/bin
+	done awk ${HOME} cd "$1" test cd x=1 local
+grep export 2>/dev/null "$1" /usr/bin sed "$@" grep readonly sed --verbose "$@"
+		readonly 2>/dev/null local $(pwd) echo
+		grep cd | 'quoted text' "$1" 'quoted text'
+	${HOME} test local --verbose -eu x=1 then -eu cd "$@" x=1 grep 'quoted text'
+		sed | sed -eu readonly "$@" then 'quoted text'
+		echo && -eu sed && 2>/dev/null x=1 cd x=1 x=1 printf printf
+		${HOME} local $(pwd) -eu readonly
+test -eu done awk /usr/bin ${HOME} test then "$@" "$1"
+		awk echo ${HOME} test --verbose
+		"$@" ${HOME} $(pwd) /usr/bin -eu "$1" sed local
+	&& sed printf sed /usr/bin awk printf test ${HOME} --verbose 'quoted text'
+		echo x=1 done x=1 | export local test grep readonly test grep then
+	test grep 'quoted text' cd x=1 local 2>/dev/null
+	${HOME} sed then 2>/dev/null then test "$1" printf echo "$@" printf
+printf x=1 && "$@" /usr/bin awk done awk -eu /usr/bin
+2>/dev/null local sed grep /usr/bin --verbose
+		printf "$@" ${HOME} grep readonly cd $(pwd) readonly "$@" "$1" --verbose local
+"$@" then printf done awk printf 2>/dev/null "$1" local
+		then test export | echo /usr/bin --verbose cd awk 'quoted text'
+	readonly printf printf printf printf "$1" echo "$@" export
+/usr/bin "$@" readonly cd awk --verbose echo done readonly
+--verbose export awk local x=1
+${HOME} sed echo -eu printf
+	/usr/bin printf then local echo awk readonly printf local echo cd then /usr/bin
+	--verbose -eu 2>/dev/null -eu done then grep awk
+		--verbose && printf /usr/bin
+		"$@" printf 'quoted text'
+x=1 -eu local $(pwd) | echo printf printf printf sed 'quoted text' x=1 echo
+awk sed cd -eu export export /usr/bin test
+echo local grep | awk then done -eu readonly export then readonly
+	printf then done 2>/dev/null then x=1 /usr/bin 'quoted text'
+		${HOME} && grep echo && $(pwd)
+	2>/dev/null test -eu cd echo /usr/bin then 2>/dev/null
+		${HOME} then -eu local then x=1 printf "$1" printf
+		--verbose 'quoted text' local x=1 | echo && && echo /usr/bin --verbose readonly
+		--verbose cd /usr/bin readonly grep "$@" test "$1"
+	awk printf readonly done export export echo
+		sed done -eu export then 2>/dev/null
+		${HOME} then "$1" 2>/dev/null && /usr/bin && then
+		echo done | x=1 | echo printf then "$1" local printf -eu test x=1 test printf
+	then && 2>/dev/null printf "$1" grep
+${HOME} 'quoted text' local awk done 'quoted text' $(pwd) local done sed cd local
+		"$1" readonly "$1" grep test local | printf then sed /usr/bin
+	'quoted text' && | test ${HOME} awk --verbose done readonly "$@"
+'quoted text' /usr/bin
+cd "$@" local awk /usr/bin awk $(pwd)
+readonly "$@" | | printf x=1 $(pwd) echo 'quoted text' x=1 2>/dev/null $(pwd)
+	awk echo printf "$1" 'quoted text' printf $(pwd) && /usr/bin "$1"
+	2>/dev/null -eu export
+		sed x=1 | sed then /usr/bin x=1 grep
+		printf echo awk cd -eu awk test 2>/dev/null
+	printf $(pwd) cd && --verbose /usr/bin 'quoted text'
+grep export && readonly cd /usr/bin 2>/dev/null done && done "$1" | echo
+	readonly done grep ${HOME} x=1 && | done -eu export $(pwd) $(pwd) 'quoted text'
+	test "$@" "$1" 'quoted text'
+	sed done grep printf test -eu --verbose local && "$@" ${HOME} test
+		export 'quoted text' then
+		grep && $(pwd) x=1 cd readonly | 2>/dev/null $(pwd) sed -eu local
+		| x=1 ${HOME} $(pwd) -eu --verbose $(pwd) cd --verbose sed sed
+&& "$@" /usr/bin && --verbose
+--verbose $(pwd) x=1 local 'quoted text'
+		done then local -eu x=1
+sed readonly done && 'quoted text' &&
+		local grep /usr/bin export
+		'quoted text' | ${HOME} sed $(pwd) "$@" "$1" grep echo test | 2>/dev/null
+-eu awk sed echo ${HOME} 2>/dev/null readonly
+grep local grep 2>/dev/null awk 'quoted text' "$@" done then local
+	"$@" 2>/dev/null | | $(pwd) -eu
+x=1 cd /usr/bin $(pwd) export && $(pwd)
+readonly grep x=1 done -eu grep local done readonly echo export then /usr/bin
+	local cd grep "$1" export | 2>/dev/null readonly -eu readonly
+	test sed test readonly grep
+local | done x=1 --verbose printf 2>/dev/null 2>/dev/null grep cd
+		echo "$1" export "$@" | &&
+	awk grep && "$@" done 'quoted text' readonly /usr/bin
+		${HOME} local test "$1" test local 2>/dev/null /usr/bin awk
+-eu awk readonly echo test | /usr/bin test
+	$(pwd) "$@" ${HOME} export 2>/dev/null | 2>/dev/null cd ${HOME} done | cd
+		2>/dev/null 'quoted text' $(pwd) "$@" export cd 'quoted text'
+x=1 /usr/bin "$@" echo "$1" test grep
+grep test | "$1" readonly echo
+	cd -eu awk && $(pwd) export && && cd ${HOME} readonly -eu sed 2>/dev/null
+		&& grep then "$1" export printf
+	/usr/bin echo ${HOME} "$@" /usr/bin
+2>/dev/null local -eu done then | 'quoted text' -eu export grep
+cd then --verbose $(pwd) export x=1 readonly ${HOME} 'quoted text' "$@" 2>/dev/null
+		"$@" /usr/bin 'quoted text' ${HOME} /usr/bin
+${HOME} echo export 2>/dev/null echo
+		| /usr/bin "$1" -eu sed --verbose "$@" /usr/bin then export 2>/dev/null local
+then 2>/dev/null echo local sed then readonly
+	2>/dev/null x=1 2>/dev/null --verbose cd done
+2>/dev/null /usr/bin awk local "$@" grep cd printf --verbose && 'quoted text'
+	${HOME} x=1 printf 2>/dev/null
+done /usr/bin readonly && readonly printf
+		"$1" 2>/dev/null "$@" --verbose awk export -eu $(pwd) --verbose
+		${HOME} awk cd /usr/bin grep x=1 "$1" -eu cd readonly
+local awk sed 2>/dev/null echo printf echo 2>/dev/null x=1
+"$@" done sed -eu local | -eu echo test /usr/bin
+grep ${HOME} local then test 'quoted text' -eu $(pwd)
+		/usr/bin "$1" local local awk /usr/bin export "$@" local 'quoted text'
+		${HOME} ${HOME} sed local test -eu local sed | /usr/bin "$@" done $(pwd)
+local ${HOME} --verbose x=1 sed done 2>/dev/null awk --verbose
+	echo $(pwd) cd local x=1 sed cd -eu then test /usr/bin 'quoted text' |
+	${HOME} echo cd grep 'quoted text' awk echo awk awk 2>/dev/null
+		"$1" /usr/bin ${HOME} done /usr/bin grep /usr/bin --verbose
+sed grep -eu local /usr/bin -eu 'quoted text' done
+local $(pwd) 'quoted text' sed x=1
+		"$1" echo cd | /usr/bin sed echo grep x=1 -eu then then
+$(pwd) | awk -eu $(pwd) "$1" grep "$@" --verbose "$1" echo then
+	x=1 local readonly grep test 'quoted text' x=1 echo readonly
+		-eu --verbose "$@" printf ${HOME} sed ${HOME} 'quoted text' "$@" then 2>/dev/null
+2>/dev/null /usr/bin "$@" 'quoted text' x=1 $(pwd)
+		"$@" "$1" ${HOME} 2>/dev/null printf
+	| printf $(pwd) -eu ${HOME} --verbose "$@" printf done test cd export && readonly
+		'quoted text' --verbose 2>/dev/null cd echo 2>/dev/null /usr/bin 2>/dev/null test
+done local grep sed echo sed "$@" local /usr/bin sed --verbose grep printf
+	printf grep local local /usr/bin 'quoted text' local test ${HOME} && local
+		${HOME} sed /usr/bin readonly awk awk 'quoted text' && local "$@" x=1 echo 2>/dev/null
+x=1 && "$1" awk test then "$1" then local grep -eu local awk -eu -eu local
+		--verbose | "$1" "$@" cd | then /usr/bin && awk
+	readonly then x=1 $(pwd) echo "$1" test -eu && -eu
+then && "$1" /usr/bin test local -eu --verbose awk export then 'quoted text'
+		$(pwd) "$@" readonly sed 'quoted text' && ${HOME}
+x=1 2>/dev/null local x=1 cd --verbose --verbose cd
+| $(pwd) | ${HOME} /usr/bin printf &&
+$(pwd) "$1" "$@" local sed 2>/dev/null
+		then ${HOME} sed ${HOME} grep export
+	done sed x=1 /usr/bin export "$1" /usr/bin
+	2>/dev/null grep printf
+		printf /usr/bin readonly &&
+--verbose && "$@" 'quoted text'
+		test local then "$@" && x=1
+		| | /usr/bin local echo 2>/dev/null sed cd sed 2>/dev/null export && ${HOME}
+2>/dev/null test /usr/bin export
+		sed sed --verbose then /usr/bin local ${HOME} x=1 2>/dev/null
+-eu grep sed 'quoted text'
+${HOME} grep then --verbose
+		${HOME} grep "$@" done echo printf 2>/dev/null then echo
+		test && $(pwd) 'quoted text' sed grep /usr/bin && 'quoted text'
+	x=1 ${HOME} readonly sed 'quoted text' ${HOME} ${HOME} local readonly $(pwd) grep
+		${HOME} $(pwd) x=1 2>/dev/null readonly local printf --verbose
+	readonly "$1" local ${HOME} readonly | sed grep test done
+&& /usr/bin ${HOME} awk readonly test done readonly done cd x=1 printf
+/usr/bin ${HOME} | /usr/bin sed export /usr/bin sed "$@" awk export ${HOME}
+awk x=1 'quoted text' awk
+	export readonly 'quoted text' readonly grep readonly
+		sed sed 2>/dev/null local then sed /usr/bin grep --verbose export | && x=1
+		-eu printf 'quoted text' echo
+local "$@" done readonly
+${HOME} /usr/bin "$1" export cd local | printf
+awk awk export done 'quoted text'
+then x=1 /usr/bin sed grep sed "$1" grep grep -eu | -eu &&
+		"$1" $(pwd) -eu local 'quoted text' grep awk export readonly --verbose
+		cd ${HOME} x=1 local then done --verbose awk export awk "$@" then cd then $(pwd)
+'quoted text' | readonly readonly export export $(pwd) test echo sed &&
+readonly "$@" local then $(pwd) grep
+grep printf && readonly cd "$1"
+	--verbose local --verbose && $(pwd) local then
+/usr/bin ${HOME} then x=1 printf
+	'quoted text' grep then --verbose
+		${HOME} done 2>/dev/null printf readonly
+	'quoted text' sed 'quoted text' "$@" sed | | readonly ${HOME} "$@" local done
+		test $(pwd) cd local then 2>/dev/null x=1 |
+cd x=1 /usr/bin --verbose ${HOME} local echo && /usr/bin "$1" done then $(pwd) sed
+	${HOME} --verbose 2>/dev/null
+		readonly 2>/dev/null readonly export -eu export ${HOME} done
+test -eu ${HOME} --verbose test 2>/dev/null cd $(pwd) cd | awk "$1" --verbose done
+	'quoted text' "$1" | test --verbose cd awk readonly 'quoted text'
+-eu readonly 'quoted text' readonly "$@" export done printf "$@" ${HOME} -eu
+	/usr/bin then x=1 printf done grep /usr/bin
+	sed ${HOME} sed echo && $(pwd) done echo done echo | /usr/bin
+"$1" sed test 2>/dev/null ${HOME} done 2>/dev/null
+then ${HOME} awk sed cd && export ${HOME} sed then awk && grep printf done readonly
+then echo 'quoted text' local grep -eu printf
+	| ${HOME} test grep ${HOME} $(pwd) && done 2>/dev/null ${HOME}
+/usr/bin readonly readonly 2>/dev/null -eu local && x=1 'quoted text'
+then readonly cd export awk grep export grep && then 2>/dev/null
+		grep $(pwd) ${HOME} ${HOME} /usr/bin x=1 then "$1"
+	"$@" done --verbose done done
+/usr/bin local grep --verbose ${HOME}
+echo /usr/bin 2>/dev/null test 2>/dev/null x=1 cd cd -eu x=1 ${HOME}
+		"$1" test awk | grep 'quoted text'
+done x=1 then then done ${HOME} "$1" readonly | sed -eu
+		cd cd 'quoted text' -eu test | "$@" done then --verbose
+/usr/bin --verbose awk export awk && grep "$@" sed readonly ${HOME} $(pwd)
+&& ${HOME} /usr/bin sed done readonly 2>/dev/null "$@" done
+readonly $(pwd) "$1" && 'quoted text'
+${HOME} /usr/bin $(pwd) printf x=1 --verbose /usr/bin readonly local readonly
+		${HOME} "$1" grep --verbose done ${HOME}
+		printf 2>/dev/null then test x=1 readonly
+		-eu grep | export sed
+cd ${HOME} sed -eu --verbose /usr/bin echo test cd ${HOME} printf x=1
+		&& 2>/dev/null 'quoted text' awk | /usr/bin
+	'quoted text' && echo $(pwd) x=1 && export "$1"
+	2>/dev/null 2>/dev/null done echo test test "$1" x=1 grep && -eu $(pwd)
+		x=1 -eu done cd && 2>/dev/null
+		$(pwd) -eu "$1" 'quoted text' x=1
+	${HOME} grep sed $(pwd) awk 'quoted text' test -eu
+x=1 x=1 && sed 'quoted text' 2>/dev/null /usr/bin
+	${HOME} | printf done readonly x=1 local --verbose
+'quoted text' printf /usr/bin "$1" printf --verbose
+		awk echo 'quoted text' $(pwd) 2>/dev/null
+		cd 'quoted text' grep "$@" readonly cd && local && ${HOME} x=1 readonly
+		grep --verbose then -eu
+		cd -eu && && awk 'quoted text' test
+		test test then ${HOME} && "$@"
+${HOME} x=1 "$1" local export
+	2>/dev/null awk local grep --verbose sed x=1 export then grep sed --verbose
+x=1 $(pwd) --verbose $(pwd) -eu awk readonly export test echo grep
+awk echo x=1 --verbose /usr/bin 'quoted text' -eu then | && $(pwd)
+2>/dev/null && printf --verbose | -eu echo $(pwd) $(pwd)
+		$(pwd) awk | | awk readonly "$1" /usr/bin
+		| 2>/dev/null x=1 2>/dev/null
+	printf echo "$@" test "$1" readonly
+local echo local x=1 export x=1 "$@" --verbose 2>/dev/null
+${HOME} test | local -eu --verbose /usr/bin --verbose local test
+-eu "$@" cd "$1" 'quoted text' local "$@" awk done echo grep
+"$1" /usr/bin $(pwd) ${HOME} printf sed 2>/dev/null readonly printf sed
+		$(pwd) grep "$1" test 'quoted text' x=1 test
+$(pwd) sed local 2>/dev/null
+		test test sed printf readonly 'quoted text' local readonly 'quoted text'
+		readonly 2>/dev/null "$@" 'quoted text'
+${HOME} 'quoted text' awk grep $(pwd) done --verbose awk printf
+export printf ${HOME} -eu 'quoted text' "$1" |
+'quoted text' x=1 awk local 'quoted text'
+		x=1 ${HOME} "$@" printf | export
+		| sed | --verbose "$1" export test
+		x=1 "$1" echo test && cd 'quoted text' /usr/bin awk x=1 "$@" | awk "$1" "$1" done
+${HOME} then export awk done && && -eu --verbose grep then "$1" test --verbose
+	2>/dev/null && local -eu cd "$1" done /usr/bin | printf test
+	x=1 /usr/bin local /usr/bin 2>/dev/null awk "$1"
+	/usr/bin test printf local grep 2>/dev/null
+		"$1" sed then 2>/dev/null "$1" done sed local --verbose "$1" 'quoted text'
+	$(pwd) && x=1 test 2>/dev/null
+	--verbose -eu then -eu 2>/dev/null | awk /usr/bin "$1" readonly "$1" $(pwd) /usr/bin
+	| awk ${HOME} --verbose 2>/dev/null 2>/dev/null ${HOME}
+		cd echo $(pwd) --verbose 2>/dev/null then then test
+readonly "$1" "$1" x=1 test
+		'quoted text' grep readonly
+	&& "$1" $(pwd) done --verbose test awk -eu test 'quoted text'
+	x=1 then -eu "$1" done /usr/bin echo 'quoted text' && echo
+		"$@" echo $(pwd) x=1 ${HOME} && awk && | awk echo
+		${HOME} echo && echo "$@" cd /usr/bin printf awk 'quoted text'
+readonly && echo test test --verbose
+	x=1 done local x=1 "$@" "$1" done export echo "$1" $(pwd) then -eu printf $(pwd)
+sed "$@" && local readonly 'quoted text' &&
+	x=1 grep "$@" ${HOME} $(pwd) ${HOME} | export export
+done grep 'quoted text' echo "$@" awk "$1" sed then && 2>/dev/null cd --verbose
+| ${HOME} grep ${HOME} ${HOME} ${HOME}
+	"$1" $(pwd) 2>/dev/null --verbose test
+		awk export echo x=1 done && export $(pwd) "$1"
+		$(pwd) 2>/dev/null 'quoted text' then --verbose
+		/usr/bin done /usr/bin then /usr/bin
+	"$1" "$@" readonly 'quoted text'
+	'quoted text' echo x=1 -eu done printf "$1" awk awk 2>/dev/null /usr/bin
+	awk "$1" cd sed --verbose "$1" local $(pwd) echo 2>/dev/null "$1" "$1" 'quoted text'
+	printf ${HOME} done readonly printf echo 2>/dev/null
+		grep echo echo grep "$1" printf
+	export grep 'quoted text' 2>/dev/null | readonly grep --verbose
+	grep local $(pwd) then test cd local | | $(pwd) x=1 $(pwd) | "$@" 2>/dev/null
+${HOME} 2>/dev/null "$1" $(pwd) "$@" --verbose readonly test 'quoted text' ${HOME}
+	/usr/bin sed "$@" then "$1" printf "$@"
+	sed awk x=1 cd "$@" sed x=1 /usr/bin -eu
+	printf x=1 2>/dev/null printf cd $(pwd) done then ${HOME}
+	"$1" | local --verbose done local "$1" local
+	"$1" 'quoted text' 'quoted text' cd sed -eu cd
+		--verbose ${HOME} 'quoted text' test export sed done echo
+		readonly local local local --verbose
+		cd sed 2>/dev/null awk printf 2>/dev/null 2>/dev/null
+		sed done | printf && done
+| then sed readonly | readonly readonly ${HOME}
+	awk | awk 2>/dev/null awk "$1" $(pwd)
+echo cd 'quoted text' $(pwd)
+	/usr/bin /usr/bin | "$@" echo awk echo awk 'quoted text'
+		$(pwd) then $(pwd) printf cd sed cd readonly && readonly sed printf |
+		--verbose /usr/bin && && 'quoted text' ${HOME} --verbose 'quoted text'
+		| | grep --verbose test $(pwd) test "$@" sed cd | export readonly
+awk --verbose readonly printf --verbose export local 'quoted text'
+		echo "$@" | export printf | --verbose
+		test && $(pwd) | && "$@" cd
+	"$1" -eu grep sed --verbose 2>/dev/null readonly sed local /usr/bin
+| sed local --verbose /usr/bin local && $(pwd) echo cd "$@" "$1" sed
+"$1" "$1" then 'quoted text'
+		grep awk 'quoted text' && export cd "$@" done awk "$@" -eu export
+		$(pwd) "$@" -eu local sed $(pwd) done
+	sed ${HOME} readonly ${HOME} /usr/bin "$@" "$@" $(pwd) -eu 2>/dev/null
+-eu local $(pwd) x=1 /usr/bin 2>/dev/null "$1" | grep "$1" -eu
+	&& $(pwd) /usr/bin cd 2>/dev/null
+		${HOME} grep x=1 cd ${HOME} echo | done --verbose export $(pwd) then "$1"
+		echo printf export "$@" then && ${HOME} local $(pwd) ${HOME} done cd then awk
+	"$@" then -eu -eu cd export
+--verbose done /usr/bin
+then "$@" "$@" && test done awk $(pwd) 'quoted text' cd awk 'quoted text' test
+		then cd cd "$@" local "$@" cd ${HOME}
+--verbose ${HOME} awk sed 'quoted text' test printf
+		grep -eu echo export 'quoted text' echo "$@" /usr/bin | ${HOME}
+	&& test --verbose readonly "$@" --verbose test cd "$1" x=1 "$@"
+		done --verbose x=1 readonly &&
+		&& && $(pwd) test ${HOME} then 'quoted text' && printf 'quoted text' "$1" printf
+	sed --verbose export | --verbose
+		x=1 export sed cd local awk awk test 'quoted text' ${HOME} && printf
+awk --verbose awk awk
+	/usr/bin export cd echo sed local printf 'quoted text' $(pwd)
+		-eu sed && grep awk then -eu /usr/bin local awk --verbose "$1" 2>/dev/null done
+	printf awk | | grep "$1" awk then readonly export printf then printf
+		export export cd --verbose sed export sed ${HOME}
+awk export grep cd && "$@" -eu /usr/bin test local awk ${HOME} local
+	--verbose $(pwd) test -eu awk readonly /usr/bin done
+	grep | local ${HOME} echo --verbose
+	readonly -eu /usr/bin 2>/dev/null
+		2>/dev/null local | -eu test $(pwd) export
+		test "$1" | awk /usr/bin && done -eu 'quoted text'
+/usr/bin $(pwd) 'quoted text' printf cd test done
+		/usr/bin test 2>/dev/null local awk 2>/dev/null readonly /usr/bin /usr/bin
+		&& export export awk --verbose test "$1" ${HOME} then 'quoted text'
+/usr/bin grep cd sed 'quoted text'
+	$(pwd) "$@" --verbose echo cd
+	grep local printf cd -eu printf /usr/bin readonly echo
+-eu --verbose printf local export -eu grep x=1 -eu ${HOME}
+	2>/dev/null --verbose 'quoted text' test -eu
+printf -eu "$1" sed local &&
+		then | printf "$@" cd cd ${HOME} readonly x=1 && --verbose readonly readonly
+done export 2>/dev/null 2>/dev/null then local then export "$1" 'quoted text'
+"$1" sed done $(pwd) cd 2>/dev/null then
+	'quoted text' && | "$@" test $(pwd) && --verbose
+		&& export done "$@" done | export echo printf
+	printf awk echo x=1 /usr/bin x=1
+		/usr/bin "$1" $(pwd) sed -eu cd sed printf readonly then readonly "$1" 'quoted text'
+	test && /usr/bin $(pwd) "$@" x=1 | 2>/dev/null $(pwd) cd
+	echo x=1 done --verbose 'quoted text' ${HOME} awk export && local | cd && local
+	test 2>/dev/null cd $(pwd) x=1 awk ${HOME} printf
+	x=1 cd "$1" && cd sed export
+	test 'quoted text' readonly awk "$@" $(pwd) --verbose
+/usr/bin echo $(pwd) "$@" echo
+		-eu cd 'quoted text' done grep sed ${HOME} $(pwd) cd
+cd x=1 && printf "$1" /usr/bin
+		printf "$1" echo && $(pwd) readonly
+	printf "$1" 2>/dev/null "$1" "$@" readonly 'quoted text' 'quoted text' sed
+readonly readonly && 'quoted text'
+--verbose grep | "$@" grep
+$(pwd) /usr/bin x=1 x=1 grep test
+	'quoted text' echo | awk --verbose "$@" | export
+		$(pwd) 'quoted text' echo sed /usr/bin x=1 echo
+		then awk 'quoted text' | grep
+		test local --verbose ${HOME} -eu test test printf "$1"
+	'quoted text' readonly ${HOME} printf 2>/dev/null && /usr/bin
+		export $(pwd) 2>/dev/null && $(pwd)
+		2>/dev/null ${HOME} "$1"
+	cd readonly sed readonly && cd
+		"$1" ${HOME} grep && awk "$1" done | | -eu done $(pwd) 2>/dev/null test
+		/usr/bin grep test echo export export done x=1 readonly &&
+	printf $(pwd) echo ${HOME} "$@" $(pwd) 'quoted text' local /usr/bin
+-eu "$1" grep done readonly export | --verbose | printf "$@" 'quoted text' $(pwd)
+		cd && --verbose grep then test cd then -eu printf
+&& grep printf x=1 ${HOME} cd grep &&
+echo -eu awk sed -eu readonly && cd printf then $(pwd) cd --verbose done && then
+	/usr/bin cd 2>/dev/null export done | then 2>/dev/null
+		awk grep -eu -eu 'quoted text' && 'quoted text' export ${HOME} printf
+awk 'quoted text' "$@" local -eu grep
+	awk "$@" sed awk echo awk readonly x=1 printf && local -eu 2>/dev/null -eu && local
+done cd grep "$1" readonly -eu
+	-eu ${HOME} then $(pwd) awk
+	| export export printf "$1" --verbose echo ${HOME}
+		--verbose 2>/dev/null && $(pwd) echo $(pwd) ${HOME}
+		${HOME} 2>/dev/null "$@" "$1" then "$1" awk export 'quoted text' awk test printf
+		grep && 2>/dev/null local
+		echo awk cd "$@" "$1" test
+	/usr/bin -eu "$@" awk echo "$@" test $(pwd) "$@" then then "$1" readonly
+		"$1" $(pwd) | sed "$1" then export cd cd ${HOME} then sed ${HOME}
+		| printf local echo grep $(pwd) $(pwd) x=1 echo -eu grep export
+		2>/dev/null 'quoted text' then done echo "$1" grep "$@" 'quoted text' awk
+		then local 'quoted text' awk 'quoted text' echo grep ${HOME} printf
+		export awk 'quoted text' "$@" then && readonly /usr/bin grep printf test
+	sed export "$1" printf echo test -eu grep "$@" && --verbose | grep 2>/dev/null
+	--verbose cd grep awk awk | then x=1 local $(pwd) --verbose
+		printf export "$@" $(pwd) readonly -eu sed /usr/bin echo -eu done readonly
+	echo --verbose done local test printf then 'quoted text'
+		export $(pwd) printf 2>/dev/null sed && "$@" 'quoted text' echo $(pwd) then
+	cd test 2>/dev/null grep cd x=1 ${HOME} x=1 $(pwd)
+	'quoted text' test 2>/dev/null && | 2>/dev/null local then local 2>/dev/null
+		awk -eu "$1" "$@" --verbose "$1" awk then export sed x=1 x=1 "$@" -eu cd 'quoted text'
+		cd export cd grep 2>/dev/null $(pwd) done ${HOME} export then x=1 export
+export sed && readonly 2>/dev/null "$1" echo 2>/dev/null /usr/bin 'quoted text'
+test "$1" "$1" cd && && test then echo sed then then /usr/bin
+${HOME} sed $(pwd) then "$1" 'quoted text' $(pwd) then && echo
+x=1 cd $(pwd) awk then 2>/dev/null
+		awk 'quoted text' "$1" readonly "$@" readonly awk sed export sed sed done
+	readonly echo echo test "$1" $(pwd)
+		cd then grep "$@" && $(pwd)
+	echo "$1" local $(pwd)
+	printf | x=1 'quoted text' grep test
+		echo sed done --verbose cd "$1" test export && "$1" export grep done local $(pwd)
+	'quoted text' sed printf cd
+		&& && export -eu 2>/dev/null local sed | --verbose | local readonly x=1
+	${HOME} | done cd $(pwd) "$@" done readonly
+		echo /usr/bin --verbose sed -eu
+		/usr/bin "$1" then /usr/bin cd "$@" "$@"
+		2>/dev/null x=1 done --verbose
+	done "$@" "$1" awk cd local printf
+printf 'quoted text' local awk -eu then --verbose
+	2>/dev/null echo "$1" x=1 readonly $(pwd) ${HOME} readonly readonly cd done /usr/bin
+$(pwd) $(pwd) ${HOME} test "$@" | --verbose $(pwd) export awk "$1" --verbose
+	echo export test local awk "$@" then "$1" $(pwd) ${HOME} && done "$@" |
+cd printf $(pwd) $(pwd) "$1" $(pwd) then 2>/dev/null
+	x=1 && && && "$1" && -eu readonly "$1" echo "$@" x=1 $(pwd) then test
+cd then "$@" 2>/dev/null cd "$1" printf && readonly "$1" local test awk "$1"
+		then -eu printf -eu export $(pwd) sed --verbose
+then readonly printf grep awk sed export printf sed $(pwd) $(pwd)
+${HOME} -eu echo readonly
+	/usr/bin /usr/bin export then printf 2>/dev/null x=1
+		'quoted text' --verbose grep echo echo && "$1"
+		readonly echo awk awk ${HOME} "$@"
+printf echo test cd "$1" | | /usr/bin echo awk -eu ${HOME}
+	/usr/bin 'quoted text' echo x=1 readonly awk -eu
+	export 2>/dev/null $(pwd) local local awk ${HOME}
+	&& x=1 /usr/bin 2>/dev/null && grep "$@" echo 'quoted text' $(pwd)
+	sed "$1" test $(pwd) then | test --verbose x=1 printf cd | x=1 readonly
+		printf printf awk ${HOME} cd readonly
+		printf 2>/dev/null && done sed done grep | export printf /usr/bin -eu grep test
+-eu awk 2>/dev/null export then --verbose
+/usr/bin 'quoted text' ${HOME} 'quoted text' done x=1 /usr/bin
+grep /usr/bin "$@" sed done 2>/dev/null | "$1" 2>/dev/null
+cd local "$@" | x=1 x=1 $(pwd) then | ${HOME} then
+	done done --verbose x=1 echo printf local "$@" | awk cd
+| echo && readonly && ${HOME} sed 2>/dev/null "$@" --verbose
+2>/dev/null grep awk x=1 export export
+		done 2>/dev/null -eu && | --verbose x=1 ${HOME} readonly awk then
+		printf "$1" test echo then done | then && $(pwd)
+		&& echo local sed readonly echo -eu ${HOME} awk --verbose
+	&& -eu printf readonly cd then | awk $(pwd) export -eu && "$1" then "$1"
+		'quoted text' 'quoted text' ${HOME} awk grep
+	export 2>/dev/null && echo "$@" | -eu x=1 local sed | /usr/bin local ${HOME}
+	printf done readonly
+		x=1 printf printf 2>/dev/null readonly awk test done 'quoted text' test printf
+	readonly then local --verbose then sed && | local then
+| test echo cd then awk | 2>/dev/null && -eu
+done "$1" then test then | then sed && then
+'quoted text' 'quoted text' readonly
+	sed && printf 2>/dev/null /usr/bin readonly ${HOME} awk x=1 x=1 'quoted text'
+	awk "$@" 'quoted text' test printf echo grep 'quoted text' $(pwd) | ${HOME}
+-eu local readonly 'quoted text' ${HOME} readonly
+		2>/dev/null 2>/dev/null "$@" x=1 printf
+"$1" then "$1" export echo -eu "$1"
+	x=1 "$1" cd $(pwd) echo ${HOME} /usr/bin
+		| /usr/bin x=1 then 'quoted text'
+		awk && | 'quoted text' awk && awk local && cd test then "$@" 'quoted text' $(pwd)
+	x=1 2>/dev/null "$1"
+		/usr/bin grep printf done | "$@" grep test
+"$@" --verbose x=1 local "$1"
+	local awk && 2>/dev/null printf 2>/dev/null echo | "$@"
+2>/dev/null "$1" sed test export awk "$@" |
+echo echo --verbose done && x=1 2>/dev/null
+		done -eu 'quoted text' 2>/dev/null
+cd export cd test local then 2>/dev/null sed --verbose "$@" $(pwd)
+		2>/dev/null test done export sed done
+	readonly $(pwd) 2>/dev/null done 'quoted text' awk $(pwd)
+		printf then && then local local sed readonly "$1"
+export awk done -eu | grep 2>/dev/null
+	then --verbose $(pwd) -eu -eu "$@" readonly
+		2>/dev/null echo | printf 'quoted text' "$1" grep
+done sed ${HOME} done |
+		printf $(pwd) local --verbose ${HOME} local "$@" done local
+	test local cd -eu && readonly
+	printf sed -eu && then -eu "$1" then 2>/dev/null && 2>/dev/null 2>/dev/null
+export export -eu /usr/bin -eu "$1"
+	--verbose test cd awk cd /usr/bin 2>/dev/null then && test
+done | cd local awk cd x=1 printf
+		done 'quoted text' && done grep -eu echo 'quoted text' printf ${HOME} x=1 readonly
+grep 2>/dev/null x=1 2>/dev/null -eu 2>/dev/null echo
+		x=1 then cd $(pwd) readonly
+	test test $(pwd) 2>/dev/null | "$1" test echo "$1"
+| export done export ${HOME} && 2>/dev/null ${HOME}
+	grep "$1" cd -eu --verbose && then 'quoted text'
+		/usr/bin export | then test "$@" export | | -eu echo echo cd then
+		${HOME} 2>/dev/null -eu "$@"
+	awk printf grep -eu local done readonly
+	printf printf 'quoted text' ${HOME} then cd /usr/bin 2>/dev/null /usr/bin grep
+	-eu done echo sed awk --verbose ${HOME} sed && 2>/dev/null "$1"
+"$@" echo --verbose /usr/bin /usr/bin
+	awk | test "$1" "$@" cd sed test --verbose
+		printf && export done --verbose local awk "$1" grep -eu echo "$1" readonly | 2>/dev/null
+		"$1" export "$@" 2>/dev/null "$1" "$@" echo local export cd printf "$1"
+"$@" echo then "$1" | test echo x=1 sed then 2>/dev/null echo "$1"
+	sed done grep "$@" awk readonly
+x=1 x=1 -eu readonly echo test
+	test "$@" sed test "$1" grep local readonly 2>/dev/null
+	awk "$@" readonly readonly /usr/bin awk -eu local -eu 2>/dev/null then ${HOME}
+		test 2>/dev/null echo /usr/bin 'quoted text' sed "$@" x=1 2>/dev/null awk readonly
+	&& && "$@" x=1 printf
+	&& "$@" $(pwd) /usr/bin x=1 -eu awk $(pwd) local printf readonly /usr/bin &&
+		${HOME} cd printf "$1" "$@" sed readonly printf local then export "$@" grep cd --verbose
+&& done --verbose readonly cd readonly "$@" printf $(pwd) --verbose "$1" 2>/dev/null
+	done test /usr/bin "$1" test | $(pwd)
+	--verbose printf $(pwd) done export sed sed 2>/dev/null done -eu
+then && then sed done && grep done echo done "$@" test 'quoted text'
+test 'quoted text' then 2>/dev/null echo export local | awk cd sed && sed --verbose
+done cd /usr/bin sed printf
+	--verbose x=1 x=1 sed local
+test sed export /usr/bin
+		local -eu "$@" $(pwd) sed | echo x=1 readonly | sed && readonly
+		'quoted text' readonly cd $(pwd) sed then ${HOME}
+	local done && 2>/dev/null /usr/bin export --verbose export
+'quoted text' readonly 2>/dev/null
+		cd export 'quoted text' echo "$@" "$1" && awk done $(pwd) printf echo printf
+echo readonly && export test export grep export readonly "$@" printf awk -eu
+		cd "$@" $(pwd) x=1 | cd | ${HOME} echo then export && | $(pwd) 2>/dev/null $(pwd)
+		sed x=1 $(pwd) 'quoted text' printf 2>/dev/null local awk then local "$1"
+		readonly $(pwd) done | awk | && | done sed cd printf then
+done $(pwd) local grep ${HOME} "$1" /usr/bin $(pwd) | "$@" $(pwd)
+		export --verbose && cd 2>/dev/null 2>/dev/null | sed ${HOME} "$@" -eu then
+		done && 'quoted text'
+	2>/dev/null awk "$@" test "$1" echo /usr/bin $(pwd) --verbose printf then cd
+	/usr/bin ${HOME} test ${HOME} local sed grep
+	awk cd printf --verbose -eu /usr/bin &&
+test grep 2>/dev/null export
+		'quoted text' echo local local sed done 'quoted text' echo
+readonly printf ${HOME} ${HOME} && ${HOME} done echo 2>/dev/null
+	printf printf local echo ${HOME} $(pwd) ${HOME} done test readonly test
+"$@" sed -eu --verbose then readonly ${HOME} -eu
+		test x=1 grep "$@" done local /usr/bin
+		/usr/bin awk export --verbose
+		$(pwd) | "$@" --verbose export $(pwd)
+	x=1 | then $(pwd) --verbose printf readonly 'quoted text'
+		"$@" | export $(pwd) "$@" "$@" echo readonly awk 2>/dev/null export export
+export /usr/bin "$@" local printf x=1 local
+		&& /usr/bin 'quoted text' printf
+	test "$@" test /usr/bin | 2>/dev/null echo && | sed printf
+	x=1 ${HOME} printf export ${HOME}
+		export -eu | 2>/dev/null $(pwd) cd printf | x=1 local test export $(pwd)
+	local test --verbose then export grep && | grep sed readonly
+		--verbose printf then done /usr/bin then 'quoted text' sed
+readonly readonly 2>/dev/null | 'quoted text'
+/usr/bin printf | ${HOME} readonly --verbose "$@" grep 2>/dev/null
+	2>/dev/null ${HOME} 2>/dev/null grep local echo
+		-eu "$@" -eu export | local --verbose /usr/bin local cd && done --verbose grep
+	awk local awk export | "$@" ${HOME} cd | local grep $(pwd)
+${HOME} "$@" awk then local $(pwd) awk then
+	echo $(pwd) /usr/bin echo x=1 sed sed --verbose
+'quoted text' echo done 2>/dev/null "$1" $(pwd) "$@" x=1 /usr/bin
+sed test local cd test local --verbose
+${HOME} -eu 2>/dev/null ${HOME} 'quoted text' grep | export
+then echo done done local 'quoted text' -eu && | 'quoted text' test
+grep readonly && "$1" local && $(pwd) cd | echo
+		2>/dev/null "$@" "$@" echo cd && done 2>/dev/null
+readonly readonly | test -eu /usr/bin readonly x=1
+"$1" grep "$@" then export /usr/bin test printf then -eu $(pwd) printf -eu
+		echo ${HOME} readonly readonly done $(pwd) awk
+${HOME} --verbose awk "$1" ${HOME} $(pwd) export | x=1 $(pwd) sed 2>/dev/null
+	echo && printf $(pwd)
+"$1" sed export | done grep /usr/bin && | printf --verbose $(pwd) -eu "$@" ${HOME}
+	2>/dev/null cd && ${HOME} awk cd --verbose export
+		--verbose printf done local $(pwd) grep echo echo awk sed $(pwd)
+	| readonly local readonly printf -eu test "$1" 2>/dev/null sed ${HOME}
+"$@" $(pwd) ${HOME} then ${HOME}
+		"$1" ${HOME} done then
+		then $(pwd) 'quoted text' readonly awk grep echo /usr/bin x=1 $(pwd)
+local | ${HOME} done grep "$1" $(pwd) sed 'quoted text' cd ${HOME} test
+printf echo local cd cd test local then test "$1" "$@" awk | $(pwd) sed "$1"
+	echo grep 'quoted text' 2>/dev/null
+	2>/dev/null /usr/bin $(pwd) awk local sed /usr/bin done echo sed cd
+		printf readonly $(pwd) awk "$@" then test ${HOME} done
+		/usr/bin | 'quoted text' cd cd sed readonly readonly grep export
+		echo | 2>/dev/null x=1 x=1
+		printf && cd grep $(pwd) "$@" grep --verbose
+	x=1 --verbose export grep sed done
+readonly 2>/dev/null
+export | then grep $(pwd) x=1 2>/dev/null
+	cd sed awk -eu --verbose 'quoted text'
+		-eu "$@" grep then awk then x=1 echo 'quoted text'
+	/usr/bin "$@" awk -eu test x=1 then readonly local grep |
+	x=1 done 2>/dev/null done printf sed local -eu printf echo x=1 echo sed cd echo
+		export x=1 "$1" "$1" test cd awk $(pwd)
+	awk | ${HOME} "$1" export
+		awk ${HOME} | printf readonly sed export && cd awk -eu done x=1 'quoted text'
+	&& local sed "$@" grep export readonly $(pwd) 'quoted text'
+then "$@" | local ${HOME} 'quoted text' readonly then "$@"
+test 'quoted text' cd local /usr/bin grep then then sed printf grep | readonly
+	test awk test -eu test then printf x=1 printf done export then local cd
+		local printf echo 'quoted text'
+--verbose ${HOME} -eu grep echo | "$@" readonly
+sed test echo -eu x=1 "$@" 2>/dev/null
+	export -eu | "$@" sed | export cd && -eu done local
+		local | cd $(pwd) && x=1 | sed test
+	grep x=1 x=1 /usr/bin grep awk
+		-eu "$1" --verbose --verbose -eu ${HOME}
+		echo local x=1 then printf then cd ${HOME} echo /usr/bin
+sed echo "$1" 2>/dev/null test 'quoted text' "$@" readonly $(pwd) printf
+/usr/bin "$1" $(pwd) sed sed echo -eu done
+awk ${HOME} printf readonly readonly
+done 2>/dev/null "$1" 2>/dev/null -eu
+		readonly then then | && awk
+	sed export cd /usr/bin sed printf then echo
+	${HOME} $(pwd) 2>/dev/null
+	/usr/bin then -eu cd local ${HOME} ${HOME} -eu
+		then $(pwd) printf --verbose && | then printf
+		test done -eu 'quoted text'
+	printf --verbose x=1 $(pwd) printf "$1" /usr/bin
+	printf grep "$1" --verbose readonly -eu "$1"
+	"$1" sed ${HOME} printf printf "$@"
+		"$1" --verbose printf /usr/bin x=1 echo ${HOME} sed echo sed
+		awk export ${HOME} export
+then --verbose test 'quoted text' grep $(pwd) $(pwd) awk | x=1
+		cd "$@" readonly awk x=1 cd sed grep &&
+		done x=1 ${HOME} printf "$@" --verbose --verbose --verbose "$@" then -eu cd | sed
+	${HOME} 2>/dev/null x=1 local
+		test local "$@" sed local x=1 ${HOME} test 2>/dev/null
+		echo -eu ${HOME} /usr/bin 2>/dev/null -eu sed cd
+	done -eu cd 'quoted text' x=1 "$@" local readonly grep grep echo
+	export local printf x=1
+		cd "$@" 2>/dev/null 'quoted text' echo $(pwd) echo then
+		done x=1 grep grep echo --verbose
+		done printf ${HOME} readonly /usr/bin
+		'quoted text' "$1" 2>/dev/null ${HOME} export "$@" awk test -eu export /usr/bin
+	then done done 'quoted text' sed echo /usr/bin x=1 x=1 done
+		export awk readonly 'quoted text' 2>/dev/null local ${HOME}
+	sed printf 'quoted text' then -eu export $(pwd) 2>/dev/null | printf
+done echo test sed ${HOME} export grep grep
+test test test cd local 'quoted text' "$@" -eu | -eu --verbose
+	| 'quoted text' then printf
+		-eu $(pwd) cd readonly && test test printf local 'quoted text'
+	local sed local && -eu export $(pwd) 2>/dev/null done ${HOME}
+	local 2>/dev/null awk x=1
+		--verbose local export ${HOME}
+| 'quoted text' export /usr/bin ${HOME} --verbose local grep grep
+	grep grep | grep sed 'quoted text' cd "$1" cd echo 'quoted text' $(pwd) printf
+done readonly awk test test readonly
+		awk "$1" readonly export test $(pwd) /usr/bin x=1 ${HOME}
+		"$1" "$1" test local export $(pwd) ${HOME} 2>/dev/null x=1 $(pwd) | x=1
+		"$@" $(pwd) then then -eu readonly ${HOME} echo && ${HOME} awk &&
+	cd sed "$@" "$1" 2>/dev/null -eu /usr/bin export local printf --verbose
+	"$@" --verbose done "$1" export --verbose "$@" sed then echo -eu --verbose
+x=1 && sed | 'quoted text' $(pwd) x=1 --verbose -eu | --verbose cd echo
+printf test grep printf awk 'quoted text' test test local cd "$1" ${HOME}
+	-eu printf && cd 'quoted text' cd "$@" readonly -eu grep
+		-eu && printf /usr/bin 2>/dev/null x=1 /usr/bin
+		"$1" cd awk printf local readonly 'quoted text'
+		sed "$1" && --verbose -eu awk | && -eu | x=1 /usr/bin -eu readonly /usr/bin
+| -eu && echo -eu ${HOME} done 2>/dev/null
+export --verbose sed sed $(pwd) test cd readonly "$1" --verbose
+readonly "$1" && sed cd cd grep echo echo ${HOME} done test sed done then test
+"$1" then then readonly
+		local 2>/dev/null readonly 'quoted text'
+		"$@" printf 'quoted text' echo -eu printf awk /usr/bin echo ${HOME}
+	--verbose readonly /usr/bin "$@" --verbose ${HOME} then $(pwd) then "$@"
+grep x=1 "$@" | -eu x=1 done ${HOME} --verbose cd awk readonly "$1"
+		echo then 2>/dev/null sed -eu grep $(pwd) awk local "$1" then then
+	| /usr/bin $(pwd) printf echo printf /usr/bin /usr/bin printf awk readonly |
+awk grep && 'quoted text' awk ${HOME}
+	done export cd printf && sed echo 'quoted text' sed export
+	${HOME} 'quoted text' $(pwd) test x=1 2>/dev/null && --verbose x=1 grep
+sed | awk export 'quoted text' then then done cd | done local cd "$@"
+--verbose export export /usr/bin ${HOME}
+grep echo readonly grep cd done grep
+		echo cd local 2>/dev/null awk /usr/bin
+| --verbose test "$@" readonly /usr/bin ${HOME} "$@" x=1 2>/dev/null then
+	$(pwd) | 2>/dev/null -eu -eu export --verbose
+	--verbose /usr/bin && local "$1" -eu ${HOME} printf /usr/bin
+sed done test local /usr/bin grep echo /usr/bin
+		printf 'quoted text' ${HOME} echo $(pwd) sed cd awk sed --verbose 2>/dev/null
+		x=1 test && test grep $(pwd) $(pwd) grep 'quoted text'
+		-eu ${HOME} x=1 "$@" && | 2>/dev/null
+	x=1 "$@" echo 2>/dev/null 2>/dev/null x=1 local && cd
+	printf -eu awk "$1" && grep awk 'quoted text'
+${HOME} /usr/bin readonly $(pwd) echo sed readonly local x=1 sed
+	&& /usr/bin sed -eu --verbose then grep echo awk "$1" cd 'quoted text' then export
+		then echo grep /usr/bin echo done then
+	-eu && grep --verbose --verbose then printf "$@"
+${HOME} /usr/bin | | /usr/bin "$1" done
+-eu readonly grep cd local 2>/dev/null
+'quoted text' printf sed done "$1" printf local readonly local
+		cd && echo x=1 printf grep grep grep --verbose ${HOME} echo then ${HOME} |
+		printf "$@" "$1" export $(pwd) printf "$@" sed
+${HOME} then local | "$1" "$@" $(pwd)
+&& /usr/bin echo echo done test done readonly
+"$1" readonly --verbose echo test --verbose && --verbose $(pwd) x=1
+		then "$@" "$@" cd printf 2>/dev/null export ${HOME}
+		sed && awk 2>/dev/null printf -eu
+		"$1" readonly 'quoted text' && cd --verbose ${HOME} done ${HOME} 2>/dev/null cd
+	2>/dev/null ${HOME} sed "$1" -eu -eu --verbose
+		2>/dev/null ${HOME} test cd cd --verbose
+	2>/dev/null sed then test ${HOME} x=1 awk && --verbose test $(pwd) "$@" cd
+	readonly | done local -eu --verbose
+${HOME} "$1" printf local printf ${HOME} --verbose
+awk $(pwd) x=1 | $(pwd) grep printf done x=1 echo /usr/bin awk 2>/dev/null
+		awk echo --verbose cd && awk --verbose readonly $(pwd) x=1 export x=1
+		"$1" cd -eu readonly "$1" /usr/bin printf &&
+	test && done local readonly
+'quoted text' | local ${HOME} x=1 export sed export then "$1" echo
+	local export x=1 readonly 2>/dev/null cd echo export "$1" test | "$@" |
+	| export awk readonly done | export "$@" echo 'quoted text' ${HOME} cd | /usr/bin
+"$1" "$1" test 'quoted text'
+	grep done local then grep echo $(pwd) echo 'quoted text' /usr/bin
+grep then x=1 grep /usr/bin
+		cd readonly && export done sed | export &&
+done export -eu && 2>/dev/null 'quoted text' printf
+sed awk sed ${HOME} test /usr/bin | awk -eu readonly ${HOME}
+sed local "$@" local && local | readonly done awk ${HOME} $(pwd)
+	done done -eu /usr/bin then 'quoted text' 2>/dev/null
+		&& /usr/bin | 2>/dev/null -eu "$1" readonly /usr/bin /usr/bin sed export 'quoted text'
+		echo then 2>/dev/null "$@" --verbose
+	sed then local test --verbose cd awk ${HOME} 'quoted text' export 2>/dev/null "$@"
+		x=1 local ${HOME} -eu local ${HOME} /usr/bin ${HOME} cd ${HOME} export
+		| done awk $(pwd) export $(pwd) awk x=1 local $(pwd) 2>/dev/null printf
+	readonly then grep 2>/dev/null /usr/bin grep ${HOME} test grep
+	cd sed readonly sed ${HOME} --verbose cd local readonly local 'quoted text'
+		--verbose "$@" --verbose --verbose 'quoted text' then 'quoted text'
+x=1 sed --verbose then readonly --verbose
+"$1" x=1 sed readonly $(pwd) -eu -eu test
+x=1 echo sed readonly "$@" sed local awk 2>/dev/null "$@" | $(pwd) echo sed
+		${HOME} --verbose test export done awk
+		test $(pwd) "$@" readonly cd "$@" test
+	grep ${HOME} awk x=1 sed done $(pwd) test
+export /usr/bin ${HOME} grep 2>/dev/null echo x=1 sed --verbose printf export
+export 'quoted text' -eu cd sed --verbose "$@" "$@" then cd readonly
+		"$@" 2>/dev/null -eu then | done grep printf
+	done done grep --verbose then 'quoted text'
+		&& test $(pwd) /usr/bin --verbose && ${HOME} && then "$1" x=1 export
+local && --verbose $(pwd) /usr/bin export 2>/dev/null 'quoted text' |
+	test export --verbose 2>/dev/null readonly | test ${HOME}
+	cd -eu grep local ${HOME} | /usr/bin awk 2>/dev/null local |
+	cd && 'quoted text' sed "$@" echo "$@" | "$@" sed /usr/bin | readonly -eu && /usr/bin
+		sed grep then done sed export readonly "$1" "$1" grep echo echo --verbose
+	cd x=1 sed export printf --verbose test $(pwd) local "$1" then x=1 $(pwd)
+export echo $(pwd) $(pwd) ${HOME} -eu &&
+		${HOME} && | && "$1" "$1" --verbose echo
+	"$1" echo grep "$1" "$@" | | readonly 'quoted text'
+	| then grep printf readonly "$1"
+$(pwd) awk done ${HOME} grep printf local x=1
+		readonly 2>/dev/null "$@" export "$1"
+		"$1" /usr/bin test cd /usr/bin | echo grep /usr/bin 'quoted text' x=1 &&
+&& 2>/dev/null $(pwd) 2>/dev/null "$1" awk readonly --verbose
+		"$1" | then readonly /usr/bin ${HOME} grep x=1 printf test x=1 'quoted text'
+		x=1 test --verbose sed --verbose readonly echo local
+	&& local "$@" awk | /usr/bin sed export -eu $(pwd) awk local printf
+	/usr/bin x=1 local ${HOME} sed "$1" export -eu && x=1
+	echo export sed cd $(pwd) export grep sed
+	cd awk /usr/bin x=1 /usr/bin && $(pwd) 2>/dev/null --verbose "$@" test
+	export 'quoted text' sed readonly $(pwd) 'quoted text' done
+	export echo cd ${HOME} sed local then echo awk "$1" --verbose sed then printf
+		"$1" printf sed local sed test "$@" x=1 "$@" done done | 2>/dev/null
+test then | awk --verbose 'quoted text' -eu /usr/bin 2>/dev/null "$1" 'quoted text'
+cd | ${HOME} awk grep then local printf x=1
+		grep printf readonly printf sed "$@" -eu readonly
+		sed | printf "$1" --verbose $(pwd)
+	${HOME} readonly echo 'quoted text'
+then x=1 local cd --verbose
+	then "$@" && then grep "$@" cd -eu "$1" && grep echo local
+-eu printf export done sed 2>/dev/null "$1" && export local 'quoted text'
+	--verbose sed && local then "$@" "$@"
+	${HOME} printf local printf 2>/dev/null test local cd local
+		x=1 2>/dev/null -eu export "$1" test grep && local cd cd "$1" ${HOME}
+		then local && grep -eu sed "$1" | 2>/dev/null /usr/bin /usr/bin local
+		'quoted text' local echo /usr/bin awk printf "$1" readonly echo
+/usr/bin awk --verbose 'quoted text' echo then
+	/usr/bin 'quoted text' readonly grep printf $(pwd) /usr/bin cd --verbose local "$1"
+$(pwd) x=1 test done &&
+		test --verbose grep 2>/dev/null
+export echo "$1" && echo -eu awk then then /usr/bin $(pwd) echo ${HOME}
+	grep 'quoted text' 'quoted text' printf done done done printf sed
+		--verbose printf local then
+		test then && local ${HOME}
+		"$@" ${HOME} "$@" done export ${HOME} ${HOME} /usr/bin done /usr/bin
+$(pwd) done readonly $(pwd) ${HOME} "$1" sed readonly
+	--verbose then ${HOME} "$@" --verbose 'quoted text'
+printf --verbose | 2>/dev/null | export "$1" awk local test done | done |
+	"$1" | /usr/bin test 'quoted text'
+	readonly 2>/dev/null x=1 awk -eu ${HOME} ${HOME} grep echo && done echo ${HOME}
+-eu "$1" sed && $(pwd) printf export export 2>/dev/null
+	readonly -eu && local x=1 local echo test test
+sed cd 'quoted text' /usr/bin 2>/dev/null $(pwd) echo | export
+local done printf readonly grep x=1 printf | then $(pwd) cd local awk "$@"
+		x=1 test local $(pwd) printf
+local grep 2>/dev/null
+	/usr/bin x=1 readonly cd 2>/dev/null readonly readonly grep | awk 'quoted text'
+	test then cd "$1" 2>/dev/null 2>/dev/null 2>/dev/null x=1 && -eu 'quoted text'
+		"$@" cd done local | grep x=1 done readonly cd test
+		echo && "$@" export -eu cd "$@" readonly 2>/dev/null ${HOME}
+		sed then printf done 2>/dev/null | then grep cd "$1"
+--verbose && cd ${HOME} export readonly then then then done -eu "$1"
+done echo then -eu printf
+		"$1" /usr/bin done echo cd "$1" $(pwd) $(pwd) grep 2>/dev/null
+x=1 readonly export 2>/dev/null --verbose "$1" local "$1" grep
+		--verbose ${HOME} export awk export awk | --verbose sed "$@" --verbose x=1
+awk "$@" ${HOME} sed grep awk
+		readonly ${HOME} awk -eu readonly cd then then echo
+local 2>/dev/null "$@" $(pwd) 2>/dev/null -eu && | "$@" echo 'quoted text' "$@"
+${HOME} echo 'quoted text' /usr/bin then "$1" "$@" x=1 printf awk echo 'quoted text'
+grep export local x=1 --verbose done export $(pwd) "$1" 'quoted text'
+	2>/dev/null /usr/bin -eu awk 'quoted text' | | export then printf
+	2>/dev/null "$1" done 2>/dev/null && printf /usr/bin done "$@" test printf
+readonly "$1" 2>/dev/null | --verbose 2>/dev/null
+	${HOME} test readonly
+	local "$1" awk then done cd grep echo local | done sed
+		-eu --verbose --verbose done ${HOME} x=1 test $(pwd) 'quoted text' printf readonly
+	local printf | x=1 x=1
+	awk awk "$1" sed | "$@" local -eu cd --verbose && test | cd local sed
+	printf awk 'quoted text' --verbose 2>/dev/null local
+		--verbose readonly ${HOME}
+	awk then export 'quoted text' cd printf $(pwd) "$@" "$1" echo printf awk | done
+		"$1" x=1 /usr/bin export x=1 | x=1 printf --verbose printf cd export 2>/dev/null
+	grep 'quoted text' done -eu readonly "$1" "$@" done printf
+	&& sed cd export --verbose
+		'quoted text' local | "$@" $(pwd) --verbose printf
+		done $(pwd) /usr/bin "$1" 'quoted text' sed readonly
+#include c234.sh
+		sed | 'quoted text' printf done then
+/usr/bin ${HOME} && -eu $(pwd)
+/usr/bin sed cd /usr/bin cd readonly awk test cd 2>/dev/null local x=1
+2>/dev/null --verbose | echo 'quoted text'
+&& readonly | "$@" then
+		test readonly awk sed sed readonly
+cd then 'quoted text' local x=1 echo $(pwd) "$1" local 'quoted text'
+		readonly $(pwd) "$@" test grep awk ${HOME} test 'quoted text' 'quoted text'
+		readonly "$@" $(pwd) "$@" printf "$1" && | awk --verbose test "$1"
+--verbose && x=1 printf /usr/bin export awk $(pwd) cd x=1 export
+	-eu export readonly readonly sed sed cd test
+		| | grep sed "$1" | 2>/dev/null | "$1" awk --verbose awk 'quoted text'
+echo 2>/dev/null && | printf x=1 sed
+-eu /usr/bin 2>/dev/null test x=1 then readonly
+		then local local export x=1 cd sed $(pwd) awk test 2>/dev/null printf
+	then 'quoted text' sed 'quoted text' 'quoted text' readonly
+	grep $(pwd) readonly readonly
+cd test -eu sed && export test awk done sed 2>/dev/null x=1
+	printf then cd -eu grep cd x=1 /usr/bin test echo "$@" && awk done local
+		"$1" | export local readonly grep
+		| && x=1 cd --verbose export awk
+	local && then /usr/bin cd 2>/dev/null 2>/dev/null
+	"$1" -eu then cd awk export 'quoted text'
+local 'quoted text' sed 'quoted text'
+		awk test $(pwd) /usr/bin done --verbose local "$1" -eu "$@"
+		"$1" && -eu 'quoted text' 2>/dev/null
+2>/dev/null printf test export ${HOME} "$@" x=1 | | $(pwd) --verbose
+x=1 readonly local --verbose --verbose export test
+		cd $(pwd) x=1 | $(pwd) test --verbose -eu $(pwd) sed -eu |
+		${HOME} test local $(pwd) --verbose
+	local "$@" export 'quoted text' 'quoted text' then awk grep --verbose
+'quoted text' echo "$@"
+local | sed | "$1" awk 2>/dev/null grep echo 2>/dev/null -eu 2>/dev/null
+		2>/dev/null printf sed $(pwd) awk | export awk
+		-eu local grep done ${HOME} done echo test test $(pwd) --verbose awk x=1 ${HOME}
+"$1" "$1" export "$@" echo echo echo
+cd $(pwd) test "$@" cd /usr/bin | --verbose sed test
+		$(pwd) x=1 "$1" printf printf echo ${HOME} then "$1" | echo -eu
+-eu -eu $(pwd) sed | export 2>/dev/null ${HOME} --verbose 'quoted text'
+		/usr/bin ${HOME} "$@" 'quoted text' test -eu test export "$@" -eu ${HOME} "$@"
+	export awk readonly local 'quoted text' test
+	${HOME} 'quoted text' printf printf x=1
+		test "$@" then 'quoted text' $(pwd) awk $(pwd) awk "$1" local ${HOME}
+	local "$@" 2>/dev/null done x=1 | /usr/bin test awk -eu
+	| 2>/dev/null printf readonly "$@" done &&
+/usr/bin -eu local "$1" 2>/dev/null $(pwd) cd then -eu | awk
+		&& | export grep export x=1 "$@" "$@" local then then test 'quoted text' printf
+		| echo printf && echo printf
+&& sed sed 2>/dev/null done | "$@" awk
+	echo --verbose "$@" &&
+		${HOME} done export "$1" printf cd ${HOME} && -eu |
+cd readonly then | x=1 2>/dev/null awk
+		-eu && "$@" printf awk 2>/dev/null done local $(pwd)
+	"$1" "$1" readonly done grep export export local $(pwd) | "$1" /usr/bin
+	test sed /usr/bin 'quoted text' | readonly
+		"$1" "$@" ${HOME} 2>/dev/null "$1" awk
+then cd awk && cd x=1 ${HOME} /usr/bin echo $(pwd) printf awk /usr/bin
+		cd 'quoted text' 2>/dev/null && cd grep $(pwd) && $(pwd) test readonly cd readonly
+${HOME} then ${HOME} printf awk $(pwd)
+	printf x=1 cd --verbose 2>/dev/null cd |
+		${HOME} && && 'quoted text' printf sed test
+| done | local done awk awk done /usr/bin "$@"
+echo export -eu readonly grep "$@" export 'quoted text'
+		2>/dev/null export 2>/dev/null && && test && 'quoted text' "$@" -eu then grep
+-eu test grep sed echo /usr/bin
+	x=1 2>/dev/null awk echo then local
+	local export "$@" x=1 awk $(pwd) sed local -eu cd
+	echo grep -eu -eu echo done x=1 local awk sed awk test 2>/dev/null
+	done echo test then done x=1 ${HOME} then readonly sed cd
+		grep ${HOME} -eu then -eu awk -eu awk grep then grep | printf
+	readonly $(pwd) ${HOME} sed
+		then export /usr/bin /usr/bin readonly -eu export grep grep | printf ${HOME}
+awk printf | --verbose ${HOME} ${HOME} -eu x=1 cd --verbose cd "$1" awk grep
+	'quoted text' ${HOME} 'quoted text'
+awk readonly echo -eu /usr/bin printf "$@" && printf
+		sed -eu && $(pwd) $(pwd) local echo "$1" /usr/bin readonly echo readonly 'quoted text'
+	local ${HOME} ${HOME} 2>/dev/null 'quoted text' /usr/bin echo
+| echo 'quoted text' local "$1" -eu
+-eu $(pwd) 2>/dev/null "$1" echo ${HOME} done "$1" --verbose /usr/bin
+awk 'quoted text' --verbose "$1"
+	&& export export | "$@" -eu
+		local local local cd echo
+	x=1 /usr/bin 'quoted text' cd awk && cd ${HOME}
+		$(pwd) test test done awk test 'quoted text' grep done 2>/dev/null
+	done ${HOME} export local done | | "$1"
+		--verbose 2>/dev/null export -eu "$@"
+		/usr/bin ${HOME} /usr/bin then $(pwd) grep done then echo x=1 && local echo
+		${HOME} "$@" /usr/bin x=1 $(pwd) /usr/bin 2>/dev/null
+		awk x=1 then echo printf cd "$1" --verbose 'quoted text' readonly awk sed cd
+	export test cd local -eu -eu done "$@" printf cd "$1" && x=1 echo x=1
+awk --verbose echo grep 2>/dev/null "$@" "$@"
+	&& 2>/dev/null "$1" grep echo /usr/bin printf printf export x=1 ${HOME}
+then -eu echo 2>/dev/null 2>/dev/null x=1 echo grep -eu then x=1 --verbose
+"$1" printf then /usr/bin local echo readonly "$1"
+		x=1 -eu then awk grep sed "$1" sed awk 'quoted text'
+	"$@" $(pwd) grep /usr/bin local echo grep done printf sed 2>/dev/null "$1" echo
+'quoted text' grep export then readonly $(pwd)
+then | cd printf && grep
+	cd --verbose -eu printf /usr/bin test x=1 done x=1 |
+cd 'quoted text' 'quoted text' sed "$1" -eu echo ${HOME}
+	grep /usr/bin printf test --verbose local "$@" awk "$@" sed --verbose
+	/usr/bin 2>/dev/null test x=1 readonly && test 'quoted text' 'quoted text'
+	echo -eu --verbose readonly --verbose && 2>/dev/null 2>/dev/null x=1 /usr/bin
+"$1" printf export test
+		cd --verbose cd && done --verbose | export echo test --verbose | export 2>/dev/null
+$(pwd) -eu cd export printf then && awk done cd awk readonly
+done printf $(pwd) awk test cd done printf
+x=1 readonly /usr/bin sed -eu export awk ${HOME}
+		awk then local ${HOME} "$@" sed cd done done | test export --verbose
+		"$@" printf local done /usr/bin 2>/dev/null sed 2>/dev/null echo cd
+echo "$1" done echo "$@" then
+${HOME} echo $(pwd) --verbose readonly --verbose
+'quoted text' readonly readonly export
+		$(pwd) cd echo awk then && | test "$@" 'quoted text' awk local /usr/bin done
+		-eu printf export then 'quoted text' -eu ${HOME}
+export | then grep readonly done 2>/dev/null
+		--verbose $(pwd) $(pwd) sed grep --verbose --verbose
+	echo /usr/bin done $(pwd) x=1 cd readonly /usr/bin done local 2>/dev/null
+		done && 'quoted text' $(pwd) awk sed x=1 x=1 test "$1" local local 2>/dev/null
+	/usr/bin sed 'quoted text' "$1" "$1" awk -eu $(pwd) $(pwd) $(pwd) | grep printf
+--verbose readonly export && readonly sed done 'quoted text'
+	${HOME} "$1" test 2>/dev/null printf done done -eu ${HOME} grep
+awk 'quoted text' export
+awk local sed export echo then
+		"$@" echo x=1 export cd /usr/bin cd printf readonly | printf
+then sed -eu test done /usr/bin echo "$@" done -eu readonly awk /usr/bin
+		| echo $(pwd) echo grep -eu readonly --verbose -eu "$1" export "$@" /usr/bin
+		x=1 echo | "$1" local $(pwd) | /usr/bin "$@" --verbose test grep printf echo
+		grep -eu "$1" test then --verbose echo grep && local local then $(pwd) x=1 2>/dev/null
+then cd /usr/bin test test $(pwd) sed test --verbose
+	${HOME} then export local export
+		export echo echo && ${HOME} | "$@"
+| readonly readonly printf -eu $(pwd) cd -eu x=1 "$@" readonly local
+		echo && then -eu | -eu 2>/dev/null
+test grep echo sed echo then export ${HOME} /usr/bin -eu /usr/bin "$1" ${HOME}
+		/usr/bin 2>/dev/null done | readonly
+awk readonly echo /usr/bin printf local ${HOME} -eu done local cd then sed cd
+		awk | "$1" sed grep cd "$@" --verbose -eu "$@" grep x=1 export grep local echo
+	x=1 printf --verbose "$1" -eu readonly export x=1 /usr/bin export test
+x=1 -eu export -eu -eu 2>/dev/null readonly test
+		--verbose -eu 'quoted text' then -eu "$@" sed printf
+		awk /usr/bin && local sed "$1"
+x=1 then test "$1" x=1 x=1 && | test grep ${HOME} "$1" | cd cd
+	grep grep /usr/bin ${HOME} "$@" /usr/bin done awk done test cd export
+		printf export export echo "$@" 'quoted text' grep export
+	echo /usr/bin test grep sed /usr/bin local x=1 echo awk x=1 --verbose export
+		grep printf ${HOME} x=1 awk sed | | 'quoted text' 'quoted text' export export
+'quoted text' $(pwd) $(pwd) local done readonly export /usr/bin $(pwd)
+echo 2>/dev/null && sed cd readonly | 'quoted text' printf
+sed --verbose "$1" cd done then local && local --verbose ${HOME}
+		-eu echo sed 'quoted text' export --verbose /usr/bin
+	$(pwd) readonly | export echo cd | then
+		echo 2>/dev/null 2>/dev/null grep && echo 2>/dev/null "$1"
+		'quoted text' echo local x=1 -eu printf
+		then grep export then 'quoted text' -eu export test
+		export printf $(pwd)
+		/usr/bin -eu grep then done readonly cd printf export grep
+/usr/bin /usr/bin 'quoted text' echo "$@" "$@" export
+	grep /usr/bin local "$@" test sed && sed readonly --verbose
+	| /usr/bin && then && $(pwd) 2>/dev/null ${HOME} done -eu
+x=1 grep printf 'quoted text'
+	/usr/bin $(pwd) "$1" -eu export 'quoted text' x=1 'quoted text' 'quoted text'
+	/usr/bin awk echo -eu --verbose
+${HOME} 'quoted text' printf && $(pwd)
+		local | --verbose "$1" | local --verbose then test awk cd && done
+	local test cd x=1 echo done /usr/bin printf "$@" cd
+	$(pwd) test ${HOME} && done printf export then x=1 done cd echo
+	--verbose "$@" | export grep
+'quoted text' export && $(pwd) then | done --verbose
+cd awk "$@" done && -eu 'quoted text' cd 'quoted text'
+export "$@" grep "$1" then /usr/bin /usr/bin printf x=1 $(pwd)
+${HOME} sed /usr/bin | export ${HOME} /usr/bin && 'quoted text'
+local ${HOME} readonly then x=1 /usr/bin test sed grep "$1" then
+&& export grep export -eu done awk then awk then cd /usr/bin
+| -eu local cd readonly local cd && export "$@" test local | "$1"
+		readonly --verbose ${HOME} local grep -eu $(pwd) echo
+		local --verbose printf --verbose export 2>/dev/null
+awk sed 'quoted text' /usr/bin readonly grep $(pwd) --verbose echo
+	done cd "$@" printf sed x=1 done awk x=1 | done echo --verbose x=1
+	/usr/bin 2>/dev/null "$@" 2>/dev/null printf test $(pwd)
+		grep readonly awk local 'quoted text'
+"$1" x=1 ${HOME} "$@" x=1
+	| then ${HOME} 2>/dev/null "$1" 'quoted text'
+"$@" | | ${HOME} sed then
+	sed done export ${HOME} local test 2>/dev/null then export
+then "$1" ${HOME} readonly $(pwd) test "$1"
+	cd printf -eu ${HOME} "$1" export
+	cd && "$1" -eu cd $(pwd) ${HOME} done -eu 'quoted text'
+	done awk cd then local awk 2>/dev/null $(pwd) readonly
+	-eu readonly 'quoted text'
+		'quoted text' cd && awk 2>/dev/null x=1 sed
+		awk cd readonly $(pwd) $(pwd) local 2>/dev/null
+test --verbose "$1" test /usr/bin echo
+test export "$@" ${HOME} -eu 2>/dev/null
+"$1" export 2>/dev/null -eu "$1" printf cd "$@" --verbose "$@" /usr/bin
+then local sed then cd echo && export | && x=1 --verbose cd grep
+printf x=1 -eu /usr/bin then test -eu export /usr/bin then readonly
+	${HOME} grep cd -eu ${HOME} local
+		'quoted text' "$1" local "$@" 'quoted text' done cd | $(pwd) 2>/dev/null
+		"$1" local test 2>/dev/null 2>/dev/null "$@" "$@" sed
+	-eu readonly /usr/bin done "$1" -eu echo -eu --verbose sed x=1 grep
+${HOME} grep readonly /usr/bin
+		printf local readonly readonly
+	2>/dev/null -eu awk ${HOME} ${HOME} awk cd local 2>/dev/null
+		&& | | && awk $(pwd) printf "$@" 2>/dev/null
+		test test "$1" echo -eu export | test ${HOME} awk printf ${HOME} -eu awk
+$(pwd) "$1" printf 'quoted text' && && "$@"
+	echo export export printf "$@" cd export /usr/bin -eu
+		printf cd grep "$1" -eu done 2>/dev/null 2>/dev/null readonly
+		grep done done "$@" sed sed 2>/dev/null
+test echo "$1" sed $(pwd) grep "$@" /usr/bin grep export cd
+	2>/dev/null x=1 done local awk "$1" cd 2>/dev/null ${HOME} test then x=1 export
+$(pwd) "$1" export readonly x=1 -eu echo /usr/bin 2>/dev/null && readonly
+then -eu cd "$@" export awk --verbose readonly ${HOME} x=1 test test
+echo echo && echo local local printf 'quoted text'
+		2>/dev/null 2>/dev/null awk 'quoted text' "$@" 'quoted text'
+test && then x=1 x=1 printf && --verbose
+sed test | --verbose && "$@" done 'quoted text' printf done | "$1" echo
+		echo x=1 readonly grep done $(pwd) grep export then grep $(pwd) sed
+		sed --verbose readonly awk done
+		grep printf --verbose "$1" | 'quoted text' awk | 'quoted text' then
+	'quoted text' printf ${HOME} test 2>/dev/null
+		printf "$@" ${HOME} | done echo grep
+		export && echo | echo /usr/bin
+	grep cd local echo ${HOME}
+		export cd "$@" test "$1" echo | grep sed /usr/bin printf sed && "$1"
+	done && then export cd awk "$@"
+	readonly done sed readonly cd "$1" 2>/dev/null done | 2>/dev/null
+		"$@" local && local export
+	"$@" local | export awk ${HOME} test sed grep --verbose printf "$@"
+| | test ${HOME} /usr/bin done 2>/dev/null
+		/usr/bin sed ${HOME} &&
+		2>/dev/null | awk ${HOME} export
+--verbose | x=1 /usr/bin then export x=1 'quoted text' 'quoted text' cd 2>/dev/null
+awk 'quoted text' export done test
+	${HOME} "$1" 2>/dev/null "$1" && /usr/bin sed
+		$(pwd) 2>/dev/null /usr/bin test x=1 $(pwd) 2>/dev/null $(pwd) export grep
+local | echo then grep export
+printf $(pwd) grep "$@" sed "$1" && $(pwd)
+		-eu sed /usr/bin && then
+		"$@" done ${HOME} 'quoted text' && readonly "$@" local /usr/bin 'quoted text'
+${HOME} | 2>/dev/null 'quoted text' done 2>/dev/null
+cd --verbose -eu && awk awk "$@" 2>/dev/null then x=1 "$1" local |
+		'quoted text' local cd 'quoted text' grep 2>/dev/null && test ${HOME} cd then
+	2>/dev/null "$@" then
+	awk /usr/bin -eu "$1" "$@" /usr/bin
+	test then readonly $(pwd) test --verbose
+2>/dev/null | test /usr/bin "$@" -eu $(pwd) $(pwd) done export |
+$(pwd) grep local && --verbose && --verbose awk printf grep
+		$(pwd) "$@" echo 'quoted text' cd 2>/dev/null cd "$1" "$1" readonly
+cd local then -eu cd --verbose | test echo &&
+'quoted text' local && export cd local grep grep | sed grep done --verbose
+local 2>/dev/null | 'quoted text'
+2>/dev/null && readonly 2>/dev/null && x=1 readonly
+	${HOME} test x=1 readonly readonly "$@" grep
+&& | sed done done && x=1 printf "$@" grep x=1 local awk grep -eu |
+	readonly ${HOME} $(pwd) 'quoted text'
+	awk sed export ${HOME} $(pwd) --verbose 2>/dev/null "$@" | grep 'quoted text'
+cd test local local test grep 2>/dev/null
+local grep && 2>/dev/null test "$1" sed echo done --verbose && grep then 2>/dev/null
+	${HOME} then $(pwd) echo printf -eu "$1" ${HOME} | 'quoted text'
+		done local "$1" done test --verbose grep cd readonly awk 'quoted text'
+	"$@" -eu echo grep awk echo printf -eu --verbose
+		printf --verbose then grep awk cd export
+		export --verbose echo local $(pwd) ${HOME} test export
+	--verbose readonly "$@" export ${HOME} && cd ${HOME} grep awk
+	test $(pwd) -eu printf && test
+	readonly echo /usr/bin then then sed readonly then
+sed -eu readonly grep export "$1" --verbose -eu -eu ${HOME} echo
+		export x=1 echo "$@" 2>/dev/null && -eu 2>/dev/null -eu sed local 2>/dev/null
+	export | test export 2>/dev/null
+--verbose x=1 --verbose 2>/dev/null && sed echo
+		then then test -eu $(pwd) sed ${HOME} "$@" done printf "$@"
+test cd grep grep local x=1 x=1
+	cd 'quoted text' "$@" test grep "$@" -eu | done awk printf 'quoted text'
+"$1" -eu echo /usr/bin | 'quoted text'
+done "$@" "$1" readonly && test ${HOME} 2>/dev/null 'quoted text' "$@"
+	readonly 2>/dev/null cd printf sed "$1" "$1" done
+	then "$@" x=1 export test x=1 2>/dev/null "$1" && local 'quoted text'
+--verbose 'quoted text' export grep export printf && -eu | awk
+--verbose grep echo sed /usr/bin x=1 2>/dev/null
+-eu export "$@" -eu ${HOME} awk | /usr/bin printf
+x=1 test | /usr/bin $(pwd) local printf
+	test $(pwd) | grep local done x=1 $(pwd) cd 'quoted text'
+"$@" then grep "$@" 2>/dev/null export readonly
+		&& printf awk then done x=1
+		sed readonly test "$1" echo -eu export -eu | done grep cd sed awk then
+	$(pwd) | x=1 ${HOME} local && test x=1 done -eu done $(pwd) "$1" --verbose $(pwd)
+		grep then printf -eu $(pwd) | cd x=1 local printf
+sed printf test done 'quoted text' awk $(pwd) | --verbose 2>/dev/null
+test "$1" 2>/dev/null | test echo awk --verbose "$1" | export 'quoted text' export
+		$(pwd) cd 2>/dev/null done "$1" local test readonly
+| | echo "$1" readonly $(pwd)
+	'quoted text' "$1" cd /usr/bin -eu readonly
+	$(pwd) then grep echo export 2>/dev/null then echo test x=1 2>/dev/null
+"$@" 2>/dev/null 'quoted text' "$1" test test | "$1" ${HOME} local
+	x=1 echo x=1 | "$1" test "$@" $(pwd) readonly --verbose | echo -eu
+	'quoted text' export $(pwd) sed sed "$@" ${HOME} "$1" then 2>/dev/null && done sed
+	test && cd "$@" -eu echo && $(pwd) export test 2>/dev/null
+	'quoted text' ${HOME} $(pwd) $(pwd) grep export -eu /usr/bin done && | cd printf
+		cd -eu local printf sed 2>/dev/null | 'quoted text' grep "$@"
+		grep 2>/dev/null export -eu
+test readonly x=1 then /usr/bin awk echo readonly
+		x=1 printf ${HOME} test $(pwd) | x=1
+export x=1 then then 2>/dev/null test local grep "$@" | "$@" sed cd
+	done ${HOME} 'quoted text' local printf sed test printf
+"$@" && cd $(pwd) && | /usr/bin $(pwd) done
+-eu cd "$1" then local
+&& ${HOME} done && printf -eu local --verbose
+sed export export 'quoted text'
+-eu awk 2>/dev/null | readonly -eu done export "$1" test test local
+		2>/dev/null | ${HOME} | -eu --verbose local done 'quoted text'
+		2>/dev/null | "$1" | "$@"
+-eu | 'quoted text' --verbose "$1" 2>/dev/null
+		local "$1" "$@" printf "$@" sed -eu awk x=1 2>/dev/null sed test readonly && done
+	sed awk cd $(pwd) 'quoted text' "$@" local cd "$@" grep | "$@" cd test
+		"$@" 2>/dev/null | local
+local /usr/bin test --verbose grep 2>/dev/null $(pwd) local
+'quoted text' local --verbose
+/usr/bin readonly /usr/bin && test readonly 2>/dev/null local done
+local done 'quoted text' local 2>/dev/null 'quoted text' grep printf
+$(pwd) awk cd /usr/bin echo ${HOME} /usr/bin ${HOME} local 2>/dev/null -eu
+cd then local cd $(pwd) cd cd ${HOME} 'quoted text' 2>/dev/null echo grep && awk
+&& --verbose && ${HOME} | 'quoted text' x=1 'quoted text' grep local printf ${HOME}
+cd -eu -eu $(pwd) --verbose | done
+		&& | "$@" --verbose then
+		"$1" echo $(pwd) --verbose done "$1" export done local -eu "$1"
+		x=1 grep /usr/bin 2>/dev/null
+		local export sed export | | $(pwd) --verbose
+${HOME} grep "$@" -eu --verbose readonly sed readonly "$@" ${HOME}
+echo export | sed 2>/dev/null sed
+"$@" | -eu awk --verbose done && "$1" $(pwd) "$1" test ${HOME} then "$1" $(pwd)
+printf cd done $(pwd) printf echo grep
+		grep -eu local printf export "$1" -eu 'quoted text'
+	${HOME} export "$1" sed printf $(pwd) x=1 /usr/bin
+		awk "$@" ${HOME} printf | export
+		echo done $(pwd) && readonly --verbose awk printf && /usr/bin "$1" -eu | grep
+	readonly readonly ${HOME} then 2>/dev/null | grep
+	cd printf --verbose | local export awk $(pwd) printf echo
+&& /usr/bin "$@" "$1" local &&
+		&& echo | $(pwd) -eu test x=1 | done echo then x=1 awk readonly
+| test /usr/bin "$1" $(pwd) 'quoted text' -eu | then done
+	echo test | "$1" && printf "$@" 2>/dev/null
+		export 2>/dev/null awk cd printf
+	'quoted text' cd awk x=1 echo --verbose
+	cd "$1" -eu 2>/dev/null --verbose x=1 'quoted text'
+local readonly ${HOME} done ${HOME} -eu
+export readonly x=1 local export "$@" 'quoted text' | x=1 x=1 "$@" $(pwd)
+		&& grep /usr/bin done readonly local cd test ${HOME} readonly
+then 2>/dev/null /usr/bin $(pwd) cd x=1 grep "$1" x=1 cd sed 2>/dev/null
+	${HOME} | printf then printf done done x=1 cd 'quoted text' readonly printf x=1
+export && x=1 export /usr/bin sed 2>/dev/null
+		done export then test sed $(pwd) export grep sed awk
+	echo /usr/bin "$1" cd printf "$1"
+'quoted text' $(pwd) echo readonly
+then 2>/dev/null 2>/dev/null printf
+done cd "$1" -eu -eu -eu x=1 cd sed ${HOME} printf x=1
+| && done done test 2>/dev/null done "$1" ${HOME}
+		printf sed x=1 sed "$1" then x=1 "$@" cd cd test awk
+		"$1" /usr/bin printf export
+	--verbose sed "$@" awk "$1" 2>/dev/null then 'quoted text' "$1" "$1"
+'quoted text' ${HOME} printf echo sed printf
+	export grep 2>/dev/null | cd
+&& | done cd ${HOME} printf test export -eu /usr/bin --verbose sed | grep test 2>/dev/null
+${HOME} 2>/dev/null /usr/bin sed grep
+local printf sed then x=1 grep 2>/dev/null
+		| test echo export sed readonly 2>/dev/null
+		$(pwd) test --verbose local test
+		grep "$@" | done done "$1" awk "$@" readonly then done grep echo readonly
+--verbose done "$@" test
+sed test "$1" readonly test | "$1" | test local "$1" printf sed -eu
+	done done "$@" $(pwd) $(pwd) awk -eu echo ${HOME} "$1" then && export
+done sed awk echo awk "$@" local | "$@" --verbose
+	export echo done | then --verbose export "$@" done ${HOME} "$1" x=1 --verbose
+		$(pwd) local export /usr/bin ${HOME} 'quoted text'
+done cd /usr/bin readonly 'quoted text'
+	2>/dev/null --verbose "$@" grep awk test /usr/bin
+		local printf 'quoted text' test awk echo "$@" x=1 -eu 2>/dev/null awk "$1" 'quoted text'
+	/usr/bin sed echo 2>/dev/null
+	$(pwd) x=1 done /usr/bin $(pwd) $(pwd) printf -eu sed
+		&& echo test ${HOME} x=1 test readonly then grep grep --verbose $(pwd)
+	export export x=1 'quoted text' ${HOME} $(pwd) && local then
+local printf x=1 | -eu x=1 awk "$@" local awk echo x=1 local "$@"
+		2>/dev/null "$1" ${HOME} "$1" x=1 test && /usr/bin x=1 "$1"
+	cd 2>/dev/null sed $(pwd) | grep
+		2>/dev/null --verbose
+		&& cd && && "$1" && /usr/bin
+"$@" local test sed 'quoted text' then --verbose $(pwd) awk /usr/bin /usr/bin
+sed --verbose "$@" --verbose "$1" awk awk ${HOME} echo -eu readonly
+grep $(pwd) $(pwd) 2>/dev/null test awk -eu 'quoted text' 'quoted text'
+local $(pwd) local test |
+--verbose "$1" | sed readonly
+-eu | /usr/bin ${HOME} ${HOME}
+		awk 'quoted text' printf ${HOME} 2>/dev/null
+	test $(pwd) "$1" done sed
+		local local awk grep grep $(pwd) sed | awk sed echo printf
+	| cd $(pwd) printf /usr/bin ${HOME}
+	readonly 2>/dev/null "$1" local then
+test ${HOME} -eu then readonly 2>/dev/null "$@" sed "$1" x=1 awk
+--verbose | printf && && | export
+	| printf && export grep cd test
+		&& | --verbose $(pwd) awk local /usr/bin sed sed local $(pwd) | --verbose && echo
+		local "$@" awk local awk $(pwd) "$1" local test "$@" export local printf -eu
+		/usr/bin $(pwd) "$@" sed export /usr/bin -eu && /usr/bin then
+		$(pwd) sed test 2>/dev/null 'quoted text' $(pwd) 2>/dev/null
+		| sed cd printf readonly export x=1 export readonly /usr/bin local
+	-eu grep grep x=1 ${HOME} export
+printf sed /usr/bin echo export cd
+	"$1" echo sed 2>/dev/null "$@" readonly
+'quoted text' printf "$1" cd printf "$@" /usr/bin
+		x=1 export -eu ${HOME} /usr/bin x=1 'quoted text'
+		cd ${HOME} "$1" cd readonly then --verbose -eu then awk awk -eu export $(pwd)
+	cd printf then 2>/dev/null readonly x=1 export grep 2>/dev/null
+		--verbose grep readonly printf grep
+	${HOME} 'quoted text' grep
+	"$@" done 'quoted text' echo "$1" done readonly /usr/bin
+&& printf ${HOME} && readonly printf
+x=1 ${HOME} | -eu printf then
+--verbose test /usr/bin cd | -eu /usr/bin
+	export cd --verbose 'quoted text' $(pwd) export
+		"$@" readonly | /usr/bin sed /usr/bin test readonly && ${HOME} done sed
+		/usr/bin export export then "$@" test 'quoted text' local export
+sed export done 2>/dev/null local 2>/dev/null /usr/bin printf $(pwd) 2>/dev/null
+	&& -eu && test export $(pwd) sed --verbose done --verbose
+	readonly /usr/bin /usr/bin "$@" sed && test grep "$1" done | /usr/bin grep ${HOME}
+sed 2>/dev/null && /usr/bin printf awk
+	readonly test readonly sed
+		awk test sed sed printf 2>/dev/null "$1" echo done
+export --verbose x=1
+		test -eu export && -eu grep printf "$@" "$@" local export
+		${HOME} test "$1" test sed export local 'quoted text' echo ${HOME}
+	${HOME} 2>/dev/null "$1" /usr/bin 'quoted text' sed grep $(pwd) grep ${HOME}
+	grep local --verbose awk done | echo awk ${HOME}
+"$@" local cd ${HOME} local $(pwd) printf test && readonly 'quoted text'
+		readonly && $(pwd) | then $(pwd) x=1 && "$1" local done "$@" --verbose
+		"$@" x=1 --verbose local readonly awk /usr/bin sed 'quoted text' 2>/dev/null
+| test ${HOME} test "$@" ${HOME} done --verbose x=1 2>/dev/null
+echo printf ${HOME} "$1" export "$@" readonly 2>/dev/null then
+awk && && readonly readonly export local then
+	grep echo --verbose 'quoted text' echo grep
+$(pwd) cd ${HOME} cd 2>/dev/null export printf sed grep sed "$1" cd echo done
+	printf test test readonly
+2>/dev/null export done echo grep "$@" local &&
+		-eu x=1 /usr/bin | echo test "$1" $(pwd) then local export echo
+		readonly awk then printf --verbose -eu ${HOME} $(pwd) ${HOME} grep && -eu
+		"$1" -eu 'quoted text' ${HOME} export done cd "$1" printf grep -eu 'quoted text'
+		printf printf x=1 printf | done done
+2>/dev/null cd export "$@" | 'quoted text' printf then readonly
+sed /usr/bin 'quoted text' local cd cd ${HOME} -eu cd $(pwd) | -eu
+		cd $(pwd) -eu 'quoted text' awk
+/usr/bin done grep /usr/bin | --verbose && ${HOME} printf cd cd cd "$@" | local
+	${HOME} x=1 --verbose test local "$@" printf
+"$1" x=1 grep then cd --verbose &&
+		readonly grep printf "$@" $(pwd) ${HOME} --verbose
+readonly export 2>/dev/null "$1" done export test
+	awk "$@" sed ${HOME} grep grep sed echo
+		then ${HOME} done done 2>/dev/null sed ${HOME}
+--verbose && 'quoted text' printf
+	--verbose | x=1 'quoted text' 'quoted text' -eu printf cd printf
+	| $(pwd) printf && printf 2>/dev/null grep
+		-eu -eu "$1" x=1 2>/dev/null /usr/bin
+		/usr/bin -eu sed grep grep export echo grep /usr/bin 2>/dev/null
+&& printf x=1 export test $(pwd) grep 'quoted text' printf cd | awk local awk
+	/usr/bin echo readonly "$@" /usr/bin
+	"$@" "$@" $(pwd) --verbose done ${HOME} /usr/bin then && done ${HOME} readonly done
+"$1" 'quoted text' then --verbose | printf test
+		done sed && | "$@" $(pwd) "$@" /usr/bin local "$1" awk
+local test /usr/bin echo echo cd export | local
+$(pwd) "$1" 2>/dev/null test readonly x=1 -eu "$@"
+		export | cd echo echo 'quoted text' awk local | 'quoted text' then ${HOME}
+	'quoted text' echo 'quoted text' /usr/bin "$@" export --verbose $(pwd) 2>/dev/null
+readonly sed x=1 printf awk -eu x=1 "$1" local grep
+	done export ${HOME} grep $(pwd)
+		then ${HOME} "$@" "$@" awk echo sed done then printf then readonly
+"$@" "$@" readonly ${HOME} "$@" test && && --verbose
+		export --verbose readonly 'quoted text' readonly grep $(pwd) readonly
+grep "$@" test echo readonly $(pwd) ${HOME} && printf && ${HOME} local done x=1
+	local done grep /usr/bin --verbose | ${HOME} test
+sed "$@" "$@" echo "$1" done cd && 'quoted text' ${HOME} && 'quoted text'
+		"$1" test && 'quoted text' && "$1"
+test export -eu printf $(pwd) printf $(pwd) done 2>/dev/null 2>/dev/null
+	--verbose export "$@" awk readonly then echo | readonly
+	$(pwd) | echo x=1 && local "$1" done
+	x=1 /usr/bin awk local test cd
+	x=1 $(pwd) /usr/bin grep test awk -eu then test local && grep 'quoted text'
+'quoted text' -eu local sed local done
+2>/dev/null --verbose sed then
+	grep ${HOME} /usr/bin /usr/bin | sed echo /usr/bin grep
+2>/dev/null done $(pwd) | -eu $(pwd)
+| "$1" test readonly -eu done
+		readonly x=1 $(pwd) --verbose then printf printf 2>/dev/null done "$1" then
+	readonly local done then 2>/dev/null grep 'quoted text' ${HOME} awk
+	printf | x=1 sed cd "$@" 'quoted text'
+	/usr/bin -eu $(pwd) ${HOME}
+x=1 sed cd && ${HOME} && 'quoted text' done sed done sed
+		echo "$1" sed awk /usr/bin sed /usr/bin readonly "$@" -eu "$1" printf x=1
+		--verbose "$1" "$@" cd && x=1 /usr/bin sed echo
+		local -eu 'quoted text' "$1" printf
+	| printf export test -eu "$1"
+		&& ${HOME} echo --verbose cd grep awk done test
+	--verbose "$@" ${HOME} readonly x=1 cd "$@" cd /usr/bin "$@" "$@"
+		cd && "$1" grep echo done -eu
+		'quoted text' cd cd test
+		| echo 2>/dev/null awk -eu -eu sed "$@" && --verbose echo export sed then
+	readonly 2>/dev/null echo grep
+"$@" sed /usr/bin test grep x=1 | x=1 test
+	echo then --verbose "$@" "$1" local | done printf /usr/bin 2>/dev/null
+"$@" local awk readonly sed 2>/dev/null echo
+		&& then done -eu sed local cd "$1" awk then --verbose
+		export printf 2>/dev/null | 2>/dev/null $(pwd) --verbose local
+	$(pwd) --verbose sed
+$(pwd) $(pwd) && ${HOME} readonly sed grep
+printf ${HOME} sed | then ${HOME} | | sed test local
+then ${HOME} sed $(pwd) && --verbose readonly "$1" cd awk
+		"$@" ${HOME} awk done awk && ${HOME} /usr/bin $(pwd)
+	grep sed /usr/bin /usr/bin /usr/bin --verbose printf 'quoted text' printf
+		grep 2>/dev/null export x=1 /usr/bin --verbose $(pwd)
+		"$@" 2>/dev/null ${HOME} -eu x=1
+done echo ${HOME} awk cd | done export | echo printf sed printf
+	x=1 | /usr/bin 'quoted text' "$1" cd ${HOME}
+done local -eu grep --verbose --verbose
+	x=1 readonly export && test "$1" "$@" sed ${HOME} -eu local
+	| readonly 'quoted text' ${HOME} /usr/bin "$1" local readonly
+	'quoted text' readonly 2>/dev/null /usr/bin $(pwd)
+		"$1" -eu -eu local x=1 x=1 -eu x=1 local export done ${HOME}
+&& $(pwd) $(pwd) x=1 $(pwd) test && grep x=1 -eu echo | local
+		grep grep "$1" | sed cd && x=1 $(pwd) $(pwd) "$1" awk cd local --verbose sed
+	local "$1" "$1" sed sed export -eu printf then then /usr/bin test 2>/dev/null
+	then echo 2>/dev/null 2>/dev/null
+		&& -eu done -eu grep x=1 && grep awk 'quoted text' 2>/dev/null readonly
+		"$1" awk done printf done echo printf awk --verbose test done done echo x=1
+	cd -eu -eu 'quoted text' printf awk x=1 2>/dev/null
+		awk 2>/dev/null export local -eu sed | export $(pwd) printf done "$1" $(pwd)
+		cd test | printf $(pwd) 2>/dev/null sed awk && readonly "$@" awk
+		echo echo awk grep 2>/dev/null
+	local 2>/dev/null 2>/dev/null | test /usr/bin awk "$@" ${HOME} printf
+		echo 2>/dev/null done 'quoted text'
+		sed | then /usr/bin --verbose | readonly
+printf "$1" done readonly 'quoted text' echo sed "$1" --verbose sed grep 'quoted text'
+then 'quoted text' --verbose
+awk x=1 "$1" $(pwd) x=1 sed x=1 --verbose awk --verbose
+grep | ${HOME} done done export local local "$1" local
+	then awk | x=1 done printf export x=1
+echo local readonly then local 'quoted text'
+	&& then 2>/dev/null /usr/bin -eu -eu 2>/dev/null
+	"$@" printf local done export 'quoted text' --verbose
+		local "$1" x=1 sed 2>/dev/null cd test
+x=1 x=1 /usr/bin done then awk 'quoted text'
+		"$@" printf | && grep --verbose printf 'quoted text' && && $(pwd)
+	grep readonly 'quoted text' /usr/bin -eu | --verbose && sed test readonly /usr/bin
+2>/dev/null sed grep | x=1 x=1 x=1 && export local cd
+--verbose /usr/bin "$@" "$@"
+${HOME} /usr/bin done test "$1" local
+--verbose --verbose ${HOME} test readonly
+	-eu awk $(pwd) "$@" then $(pwd) --verbose
+test then 'quoted text' | local /usr/bin && ${HOME} x=1 then
+	readonly | ${HOME} 'quoted text' "$1" echo
+		then | && awk $(pwd) readonly sed "$@" 'quoted text' readonly
+	done export sed ${HOME} readonly 'quoted text' $(pwd) -eu
+	grep test readonly | --verbose
+echo 2>/dev/null x=1 2>/dev/null "$1" "$1" cd "$@" 'quoted text' sed sed
+	sed "$1" -eu ${HOME} grep then $(pwd) x=1 printf && then ${HOME} --verbose
+		local local ${HOME} /usr/bin cd done
+	then local && awk grep echo -eu x=1 -eu echo ${HOME}
+		x=1 "$@" --verbose then cd readonly then && local /usr/bin awk
+/usr/bin awk && printf grep | --verbose export | printf
+done readonly local local | 2>/dev/null
+	"$1" echo 'quoted text' printf export | echo
+local $(pwd) test cd grep done
+done then echo awk 'quoted text'
+		"$1" export /usr/bin | $(pwd)
+x=1 sed | test -eu done "$@" done x=1 test
+	awk then test | "$@" "$1" ${HOME} "$@" 2>/dev/null
+	awk done /usr/bin -eu /usr/bin | sed done x=1 2>/dev/null echo
+		"$1" "$1" export /usr/bin && ${HOME} /usr/bin export grep
+printf echo sed awk 2>/dev/null
+		grep /usr/bin sed export --verbose test
+export echo export local
+	&& printf 2>/dev/null "$@" --verbose
+--verbose printf && 'quoted text' 'quoted text' awk echo 'quoted text' $(pwd)
+$(pwd) awk && done cd cd export
+	grep /usr/bin -eu local echo /usr/bin printf | /usr/bin
+		--verbose then export done 'quoted text'
+cd | local "$1" && --verbose --verbose
+		/usr/bin --verbose printf && cd grep then readonly
+		awk 'quoted text' export cd export | export then test then | export ${HOME}
+printf grep 2>/dev/null --verbose $(pwd)
+	cd grep cd echo readonly
+2>/dev/null local --verbose export && cd "$@" 2>/dev/null
+	2>/dev/null done done test --verbose echo 'quoted text' awk printf
+	readonly && sed awk | /usr/bin "$@" /usr/bin
+		grep "$1" x=1 "$1" "$1" x=1 --verbose test /usr/bin 2>/dev/null x=1 ${HOME}
+sed printf ${HOME} "$@" grep -eu grep && sed "$1" printf --verbose test && --verbose
+'quoted text' echo local /usr/bin ${HOME} done $(pwd) -eu cd /usr/bin
+	echo ${HOME} printf sed test |
+local /usr/bin test 'quoted text' test | 'quoted text' grep sed && grep -eu
+		$(pwd) test export done ${HOME}
+		--verbose test 'quoted text' grep local test 'quoted text' test 'quoted text'
+&& sed awk sed printf 'quoted text' "$1" export printf test ${HOME}
+	&& local "$1" export then export done
+		done test "$1" && && "$1" sed
+	printf grep export -eu cd 2>/dev/null printf then
+		$(pwd) && ${HOME} ${HOME} local ${HOME} -eu echo 2>/dev/null
+	x=1 test printf /usr/bin "$@"
+		export readonly 'quoted text' echo local | test x=1 | printf then awk
+		echo test test --verbose sed ${HOME} echo
+export then -eu 2>/dev/null export 'quoted text' "$@" x=1 awk then export
+	local cd 'quoted text' test readonly 2>/dev/null 'quoted text' then $(pwd)
+		test /usr/bin printf x=1 && $(pwd) local --verbose ${HOME} export "$1"
+/usr/bin --verbose test -eu && sed ${HOME} --verbose "$@" sed "$@" $(pwd) ${HOME}
+printf "$@" | awk 2>/dev/null /usr/bin -eu "$@" awk "$1" test ${HOME}
+"$@" cd printf test local "$1" sed export
+printf readonly $(pwd) 'quoted text' grep test
+		done done --verbose local done && "$1" && 2>/dev/null
+		printf 'quoted text'
+		x=1 test $(pwd) -eu readonly then done "$1" "$1" --verbose then |
+&& ${HOME} ${HOME} then 'quoted text'
+		"$@" readonly $(pwd) sed 2>/dev/null 2>/dev/null &&
+		| && ${HOME} --verbose export sed done x=1 ${HOME}
+		cd $(pwd) export ${HOME} then grep test then -eu
+		test echo 2>/dev/null cd | echo ${HOME}
+	'quoted text' 2>/dev/null grep
+echo local export done && "$1" local "$@" "$1" /usr/bin local done && cd /usr/bin
+then "$@" sed $(pwd) done awk --verbose readonly -eu awk test grep $(pwd) $(pwd)
+	2>/dev/null awk ${HOME} local export printf "$1" $(pwd) done then sed 2>/dev/null
+| ${HOME} ${HOME} --verbose
+		'quoted text' then export x=1 "$@" printf test
+"$@" ${HOME} awk $(pwd) /usr/bin --verbose awk "$@" &&
+done /usr/bin 'quoted text' export awk awk
+export then x=1 && 2>/dev/null readonly ${HOME} grep "$@"
+readonly 'quoted text' then ${HOME} | /usr/bin awk sed then done ${HOME}
+	done readonly "$1" 2>/dev/null | x=1 export "$@" | then done -eu --verbose
+export --verbose sed printf "$@" grep --verbose cd /usr/bin x=1 'quoted text'
+		${HOME} printf 2>/dev/null readonly done /usr/bin 2>/dev/null ${HOME} export
+readonly echo done readonly 'quoted text' echo
+		"$@" | ${HOME} sed then $(pwd) | /usr/bin && sed "$@" "$1"
+		cd | --verbose 'quoted text' then cd echo printf
+cd "$@" 2>/dev/null /usr/bin ${HOME} /usr/bin /usr/bin | /usr/bin | ${HOME} sed
+		'quoted text' | sed cd readonly "$@" && 'quoted text' | readonly ${HOME} awk cd
+		awk 'quoted text' | /usr/bin export grep readonly done
+		echo then 'quoted text' done ${HOME} done
+		test done then grep /usr/bin readonly cd done --verbose --verbose
+printf local $(pwd) "$1" awk sed $(pwd) readonly --verbose sed | /usr/bin
+	done local readonly x=1
+		local 'quoted text' awk "$1" --verbose
+		'quoted text' "$@" ${HOME}
+grep ${HOME} sed x=1 "$1" sed sed | "$1" -eu "$@" cd /usr/bin export
+		grep /usr/bin -eu awk then "$@" printf grep test then x=1 sed grep then
+"$1" x=1 sed export 2>/dev/null "$@" $(pwd)
+test done | $(pwd) ${HOME} test
+		-eu "$@" done /usr/bin
+	done sed cd "$1" cd 2>/dev/null cd /usr/bin "$1" -eu "$@"
+	grep 2>/dev/null cd grep cd readonly export cd --verbose test
+local sed export local /usr/bin 'quoted text' then | 2>/dev/null /usr/bin
+-eu --verbose -eu test grep && local awk
+	2>/dev/null local sed 'quoted text' 'quoted text' printf readonly done
+'quoted text' cd test grep x=1 readonly --verbose "$@" | printf | echo "$@" done
+		printf "$1" --verbose "$@" awk cd echo ${HOME} export local cd local then
+		readonly ${HOME} then ${HOME} "$@" "$1" /usr/bin 2>/dev/null
+$(pwd) export cd "$1" --verbose echo $(pwd) && then
+	&& export "$1" grep "$@" cd printf && /usr/bin export
+	then 'quoted text' grep "$@" x=1 test 2>/dev/null
+sed sed "$1" cd cd then awk cd grep local printf export sed test | awk --verbose
+	"$@" && grep && | ${HOME} | ${HOME} | /usr/bin local local sed 'quoted text'
+	then -eu sed 2>/dev/null $(pwd) | x=1 test
+test readonly cd -eu --verbose "$@" ${HOME} sed done echo
+	| echo 'quoted text' awk "$1" test then "$1" x=1 $(pwd) $(pwd) export
+export grep ${HOME} sed -eu awk --verbose export "$1" sed local
+/usr/bin 2>/dev/null x=1 done -eu ${HOME}
+		-eu echo && export 2>/dev/null && /usr/bin test /usr/bin ${HOME} awk
+		"$1" cd cd && && x=1 grep "$@" echo printf x=1 --verbose
+		x=1 "$@" local "$1" 'quoted text'
+		"$@" local x=1 "$1" ${HOME} awk done x=1
+x=1 export printf x=1 /usr/bin then
+done local --verbose /usr/bin export 'quoted text' /usr/bin --verbose
+		| "$1" done && local readonly then awk printf readonly test sed x=1 $(pwd)
+	2>/dev/null --verbose -eu /usr/bin
+-eu --verbose printf -eu && && then ${HOME} grep
+		'quoted text' then 'quoted text' readonly "$@" sed "$1"
+	export && /usr/bin --verbose
+/usr/bin then --verbose printf grep awk printf grep done 'quoted text' $(pwd)
+"$@" printf sed 'quoted text'
+	${HOME} "$1" 'quoted text' local
+"$1" grep -eu test sed "$1" sed cd 2>/dev/null && test $(pwd) 'quoted text' local
+	${HOME} x=1 ${HOME} -eu "$1" then
+		echo test export "$@" ${HOME} sed ${HOME} export -eu ${HOME} -eu
+	--verbose --verbose ${HOME} && printf | ${HOME} /usr/bin
+	then grep printf && && --verbose 2>/dev/null test readonly printf &&
+	done "$@" grep test /usr/bin | grep printf echo /usr/bin test
+--verbose local then then -eu 2>/dev/null --verbose
+	local | then sed echo printf
+	&& -eu x=1 "$1" /usr/bin "$1" echo sed $(pwd) cd x=1 readonly
+		sed x=1 cd echo then 2>/dev/null awk
+	printf --verbose then
+		2>/dev/null /usr/bin x=1 ${HOME} awk "$@" -eu
+	done local ${HOME} done && test &&
+	$(pwd) local | /usr/bin echo cd /usr/bin | x=1 cd /usr/bin x=1 "$1" local
+-eu then 2>/dev/null x=1 x=1 $(pwd)
+		awk $(pwd) export "$1" printf $(pwd)
+	2>/dev/null | --verbose grep --verbose --verbose -eu sed then $(pwd)
+	"$@" sed 'quoted text'
+		sed grep export /usr/bin 'quoted text' grep printf echo /usr/bin
+		printf $(pwd) $(pwd) cd && echo "$@" 'quoted text' x=1
+	cd then then /usr/bin sed grep
+		grep printf ${HOME} echo 2>/dev/null "$@" grep export then
+export ${HOME} sed $(pwd) cd "$1" cd "$@" echo grep readonly
+cd "$@" x=1 readonly done | && "$@" awk sed local $(pwd) ${HOME} 'quoted text'
+	awk sed echo awk printf test /usr/bin && grep "$@" /usr/bin
+	$(pwd) then awk "$1" /usr/bin
+awk ${HOME} export $(pwd) printf -eu ${HOME} sed
+	then ${HOME} done awk 'quoted text' $(pwd) && "$1" grep local cd "$@" sed
+| && readonly "$1" ${HOME}
+| export $(pwd) --verbose
+awk grep "$1" readonly && 2>/dev/null /usr/bin
+	awk x=1 awk /usr/bin ${HOME} -eu export awk "$@" echo $(pwd) "$@" "$1"
+	2>/dev/null | cd echo awk --verbose printf cd | printf
+cd x=1 x=1 awk 'quoted text' export
+then "$@" --verbose x=1 ${HOME} printf $(pwd) export -eu 'quoted text'
+		| x=1 "$@" -eu grep | /usr/bin
+"$@" && ${HOME} $(pwd) 'quoted text'
+		sed ${HOME} ${HOME} 2>/dev/null awk
+	$(pwd) sed | 2>/dev/null "$1" test printf --verbose
+awk /usr/bin local && ${HOME} grep
+	grep x=1 2>/dev/null then test test grep local done awk then 'quoted text'
+grep printf | x=1 /usr/bin echo echo -eu "$@" --verbose /usr/bin
+		readonly && printf --verbose cd --verbose readonly -eu && -eu printf grep
+export | local echo printf test printf done ${HOME} "$1" 'quoted text'
+	&& "$1" local --verbose export ${HOME} sed x=1 cd test && 'quoted text'
+		2>/dev/null "$@" $(pwd) test x=1 -eu ${HOME} cd sed -eu printf local $(pwd) 2>/dev/null
+/usr/bin x=1 grep sed -eu "$1" sed local grep "$@" then
+		local $(pwd) 2>/dev/null | && --verbose $(pwd) then $(pwd) then 2>/dev/null
+	-eu export -eu sed test && --verbose test echo x=1 cd sed grep "$@"
+		cd $(pwd) | --verbose grep --verbose then export cd --verbose /usr/bin -eu
+	${HOME} $(pwd) echo printf echo local "$@" export --verbose && done
+	readonly export test ${HOME} "$@" && 2>/dev/null
+	"$@" $(pwd) --verbose | awk
+		2>/dev/null -eu ${HOME} local -eu then
+x=1 then local cd --verbose
+2>/dev/null | "$@" test "$@" 2>/dev/null && test ${HOME} then
+	-eu done && /usr/bin 'quoted text' awk done export test test test --verbose
+		sed awk awk cd $(pwd) 'quoted text'
+		awk ${HOME} -eu x=1 && "$1" grep sed /usr/bin
+		export awk awk then 2>/dev/null then echo /usr/bin /usr/bin
+		done /usr/bin grep then 2>/dev/null local "$@" --verbose
+		/usr/bin --verbose done -eu $(pwd) awk echo sed x=1 done export then readonly
+		done export --verbose -eu
+		local $(pwd) x=1 /usr/bin /usr/bin awk then $(pwd) -eu "$1"
+printf cd "$@" | /usr/bin sed 2>/dev/null
+	awk export -eu "$@" export ${HOME} "$1"
+	export export printf 2>/dev/null 2>/dev/null -eu grep
+	local --verbose ${HOME} echo sed test printf printf /usr/bin /usr/bin x=1 awk echo
+		--verbose $(pwd) -eu --verbose
+| done $(pwd) export /usr/bin local done readonly echo /usr/bin | readonly sed
+		grep local printf sed --verbose
+"$@" sed echo done $(pwd) then 2>/dev/null "$@" --verbose
+test "$1" local -eu "$1"
+	"$@" ${HOME} readonly $(pwd) grep 2>/dev/null -eu --verbose test ${HOME}
+		echo 2>/dev/null -eu echo -eu done
+awk local 'quoted text' -eu export 'quoted text' local | 'quoted text'
+		export echo ${HOME} export "$@" ${HOME} readonly sed
+"$@" export -eu awk && done
+&& x=1 local echo 2>/dev/null echo "$@" "$1" "$@"
+	$(pwd) -eu echo sed | done done | --verbose -eu cd --verbose then then
+		"$1" -eu $(pwd) echo export "$@" | cd export 2>/dev/null local cd readonly 2>/dev/null
+		awk printf /usr/bin test "$@" awk 2>/dev/null readonly sed 'quoted text'
+	test sed "$@" "$1" then ${HOME} 'quoted text'
+	/usr/bin then export | -eu readonly "$1" "$@" 2>/dev/null
+	readonly 'quoted text' awk printf export | -eu 2>/dev/null
+echo done then export done | 2>/dev/null cd -eu /usr/bin printf export test then
+		/usr/bin local | /usr/bin awk test local printf readonly awk | $(pwd)
+	--verbose -eu sed local && readonly awk then -eu then x=1 $(pwd) awk export "$@"
+&& 2>/dev/null --verbose $(pwd) && -eu echo export export
+		"$1" && -eu && --verbose 2>/dev/null 'quoted text'
+	| then "$1" $(pwd) then printf /usr/bin awk then grep -eu sed cd readonly && | readonly
+		cd -eu test local "$1" sed readonly --verbose test
+		readonly then -eu echo
+	readonly awk readonly printf x=1 readonly "$1"
+-eu -eu x=1 grep /usr/bin -eu "$@" x=1 | 2>/dev/null
+	export cd grep echo x=1 grep ${HOME} $(pwd) echo --verbose
+	done sed done awk 'quoted text'
+		sed readonly cd "$1" "$@" grep
+	then awk test readonly
+		'quoted text' --verbose cd grep echo printf awk then then "$1"
+		grep x=1 test cd | done echo --verbose
+	| printf --verbose 2>/dev/null grep x=1 'quoted text' echo 'quoted text'
+		/usr/bin readonly export && sed readonly export
+	grep echo && done done "$@" echo -eu 2>/dev/null
+		printf && x=1 'quoted text' $(pwd) | printf test /usr/bin
+	printf cd awk && /usr/bin | sed export grep && | awk test sed
+${HOME} printf /usr/bin sed local $(pwd) "$1" x=1 printf test && grep awk -eu
+		local local | ${HOME} printf echo cd
+	then export 2>/dev/null local grep | x=1 echo -eu -eu | --verbose
+		$(pwd) grep | readonly
+	then awk "$1" awk echo 2>/dev/null
+	sed 'quoted text' $(pwd) then -eu -eu grep test local export "$1" --verbose /usr/bin
+echo grep x=1 /usr/bin -eu awk --verbose -eu
+		| "$1" "$@" export "$1" echo $(pwd) ${HOME} echo local printf
+then test export "$1" && "$@" readonly ${HOME} "$1" readonly
+		cd && echo echo x=1 echo cd /usr/bin sed 'quoted text'
+"$1" printf printf x=1 -eu done | | x=1 | x=1 && 2>/dev/null -eu --verbose done
+&& grep $(pwd) 2>/dev/null 'quoted text' readonly cd awk
+		--verbose -eu awk --verbose "$1" ${HOME}
+		readonly grep "$@" test | test cd export | | sed x=1
+		echo printf "$1" test test $(pwd) 'quoted text' then
+&& local && /usr/bin && /usr/bin 'quoted text' /usr/bin local sed /usr/bin grep
+	| readonly awk $(pwd) $(pwd) 2>/dev/null && then local
+	'quoted text' && then sed | x=1 sed $(pwd) 'quoted text'
+	${HOME} --verbose 2>/dev/null 'quoted text'
+		| "$1" "$@" && then ${HOME}
+${HOME} printf 2>/dev/null cd | printf local sed local | test "$@" echo cd then
+	"$1" printf awk sed then export printf -eu $(pwd) ${HOME} 2>/dev/null done
+printf 2>/dev/null --verbose
+	sed echo printf grep local then
+${HOME} awk local "$@" 'quoted text'
+		then cd local 'quoted text'
+	"$1" 'quoted text' && /usr/bin x=1 printf
+	printf sed 2>/dev/null /usr/bin x=1 /usr/bin $(pwd)
+	--verbose x=1 -eu then echo test x=1 grep then
+-eu readonly done x=1 echo
+	then 'quoted text' -eu "$1" ${HOME} printf $(pwd)
+$(pwd) ${HOME} | echo done ${HOME}
+$(pwd) awk test echo export 'quoted text' readonly
+export echo "$1" echo ${HOME} "$@" 2>/dev/null ${HOME}
+	test test echo "$1" $(pwd) -eu
+		${HOME} done then awk 'quoted text' echo then grep echo
+awk ${HOME} "$@" done printf export awk done test
+sed $(pwd) -eu x=1 export printf
+		| && readonly ${HOME} && ${HOME}
+	grep /usr/bin sed "$1" 'quoted text' && echo
+		printf readonly /usr/bin test $(pwd) x=1 $(pwd)
+test --verbose ${HOME} done then --verbose
+/usr/bin printf cd 'quoted text'
+${HOME} then -eu $(pwd) sed sed printf cd /usr/bin
+&& 2>/dev/null local printf done && /usr/bin done test echo --verbose
+		'quoted text' cd done grep printf cd x=1 "$@" cd cd echo echo readonly
+	"$@" ${HOME} | local &&
+		done local grep x=1 /usr/bin $(pwd)
+		cd local 2>/dev/null
+		x=1 export ${HOME} -eu -eu local --verbose 2>/dev/null export done
+		| export readonly /usr/bin
+	echo "$1" /usr/bin "$@" cd -eu readonly awk sed done
+	'quoted text' sed $(pwd) local
+	test "$1" local $(pwd) 'quoted text' "$@" 2>/dev/null printf printf $(pwd)
+		2>/dev/null then test --verbose sed echo cd "$1" export && --verbose /usr/bin
+		test $(pwd) export printf "$1" $(pwd) export /usr/bin && readonly
+echo cd 'quoted text' $(pwd) -eu ${HOME} cd 'quoted text'
+		grep && echo /usr/bin then done -eu export /usr/bin local "$1"
+	then 'quoted text' test "$@" local "$@" grep sed awk
+		printf export then | -eu $(pwd) /usr/bin ${HOME}
+	&& local 2>/dev/null awk echo "$1" "$@" "$1" "$1" cd awk test && 'quoted text'
+	awk --verbose awk 'quoted text' $(pwd) local
+		printf sed 'quoted text' export ${HOME} /usr/bin readonly echo readonly
+		test then test /usr/bin 'quoted text'
+	"$@" done /usr/bin done test 'quoted text'
+	-eu x=1 2>/dev/null readonly grep 'quoted text' /usr/bin 'quoted text' -eu
+"$@" && x=1 printf sed "$@" printf "$@" --verbose | $(pwd) && export 'quoted text'
+		sed sed then x=1 --verbose
+		&& test 'quoted text' awk $(pwd) then 2>/dev/null | test done
+readonly export $(pwd) local
+		$(pwd) printf awk awk awk printf
+		$(pwd) x=1 /usr/bin then "$1" ${HOME} readonly local "$1" readonly 2>/dev/null
+--verbose 2>/dev/null echo "$@" done x=1
+	grep awk readonly $(pwd) | sed && x=1 &&
+/usr/bin "$1" readonly awk 'quoted text' 2>/dev/null sed && cd
+cd ${HOME} $(pwd) local export && grep
+x=1 "$@" ${HOME} "$1" readonly
+	${HOME} && awk 'quoted text' /usr/bin && printf ${HOME} -eu
+	grep "$1" printf $(pwd)
+		grep 'quoted text' readonly | --verbose "$@" $(pwd) test export echo then
+	cd echo then grep echo awk local export
+	local /usr/bin x=1 cd readonly readonly awk $(pwd) printf then
+		readonly awk test 2>/dev/null 2>/dev/null
+printf then grep && "$1" x=1 "$1" readonly sed
+		test x=1 sed 'quoted text' then export && echo 'quoted text'
+		'quoted text' done 2>/dev/null sed readonly export 'quoted text' then local
+	--verbose x=1 | grep export local test awk test export /usr/bin sed "$@" x=1 2>/dev/null
+export test $(pwd) local
+readonly --verbose --verbose grep export sed cd "$@" done -eu awk 'quoted text'
+		then printf done done x=1
+		"$@" test sed "$@" done test -eu && printf -eu 2>/dev/null
+		&& then 2>/dev/null export then
+		then | printf then cd done 2>/dev/null local sed --verbose "$@" test | test
+	$(pwd) --verbose | /usr/bin
+	done test echo 2>/dev/null grep done printf 2>/dev/null then cd --verbose
+then test sed done 'quoted text' echo "$@" test then
+	--verbose then ${HOME}
+		-eu x=1 | done readonly | --verbose "$@" ${HOME} -eu &&
+		local sed -eu 'quoted text' 2>/dev/null 'quoted text' local printf done
+	'quoted text' grep readonly grep 2>/dev/null export echo local test
+		-eu ${HOME} /usr/bin sed grep awk "$@" "$@" | export awk export awk echo readonly
+		/usr/bin sed /usr/bin "$1" "$1" $(pwd) readonly done
+		test /usr/bin 'quoted text' | | ${HOME}
+	"$1" local "$@" local x=1 test export 2>/dev/null sed x=1 'quoted text'
+	done --verbose done 2>/dev/null
+then "$1" then export ${HOME} cd then test 'quoted text' -eu grep awk echo test
+'quoted text' | readonly
+		-eu done ${HOME} local 'quoted text' /usr/bin done sed
+	then test "$@" | "$1" printf readonly && printf
+		"$1" echo $(pwd) awk echo "$1" $(pwd) /usr/bin echo test && | sed 'quoted text'
+		-eu then readonly "$1" --verbose && ${HOME} 2>/dev/null 2>/dev/null
+	printf cd readonly export sed test test test "$1" done ${HOME}
+cd -eu 'quoted text' $(pwd) --verbose
+	/usr/bin printf | export /usr/bin ${HOME} $(pwd)
+		sed --verbose "$1" readonly --verbose export awk -eu --verbose && export
+	sed 2>/dev/null --verbose
+	export printf ${HOME} sed ${HOME}
+		--verbose 'quoted text' "$@" printf ${HOME} local cd x=1 "$@"
+	cd local done awk --verbose -eu cd echo ${HOME} "$@"
+		test "$@" /usr/bin 'quoted text' readonly "$@" cd printf | local /usr/bin
+	readonly sed --verbose ${HOME} $(pwd) cd "$@" sed /usr/bin /usr/bin
+		$(pwd) cd echo 'quoted text' $(pwd) readonly /usr/bin
+	2>/dev/null ${HOME} cd -eu test grep sed
+		printf sed then $(pwd) "$1" local --verbose 2>/dev/null
+		$(pwd) --verbose | printf sed | 2>/dev/null sed | export test 2>/dev/null
+		'quoted text' --verbose "$@" x=1 then export test /usr/bin
+	$(pwd) 'quoted text' local export
+	"$1" -eu $(pwd) -eu readonly "$1" x=1 "$@" grep cd
+		awk --verbose local $(pwd) "$@" -eu grep "$1" readonly readonly awk 2>/dev/null
+/usr/bin "$1" sed | 2>/dev/null
+	test test then readonly $(pwd) && readonly && && $(pwd) grep then
+		sed printf $(pwd) "$1" && && printf grep
+		| 'quoted text' /usr/bin grep 2>/dev/null $(pwd) done | 2>/dev/null
+cd /usr/bin local /usr/bin 'quoted text'
+done $(pwd) echo cd ${HOME} -eu $(pwd)
+	$(pwd) --verbose ${HOME} grep "$1" cd
+&& printf 2>/dev/null printf cd then "$1" -eu $(pwd) /usr/bin
+		| awk export ${HOME} export readonly
+		then | --verbose cd $(pwd) 2>/dev/null awk x=1 grep 'quoted text' local export
+		then grep --verbose 2>/dev/null done awk echo ${HOME} 2>/dev/null then done
+awk --verbose "$@" cd --verbose sed && /usr/bin export ${HOME} --verbose
+	test sed done && echo done awk -eu then -eu 'quoted text'
+		sed readonly grep $(pwd) grep --verbose sed -eu 2>/dev/null && test awk 'quoted text'
+		${HOME} echo printf local readonly grep $(pwd)
+"$1" $(pwd) done cd cd $(pwd)
+$(pwd) local "$@" sed --verbose sed export sed 2>/dev/null /usr/bin
+| done grep then test 2>/dev/null awk echo "$@" sed test
+	${HOME} then "$1" readonly x=1 cd awk done "$@" 2>/dev/null cd grep printf
+		"$@" | readonly then -eu grep then printf readonly done && then | "$1" ${HOME}
+	echo | ${HOME} cd "$1" | /usr/bin -eu done x=1 2>/dev/null && then
+'quoted text' cd echo x=1 printf test awk "$1" readonly sed sed ${HOME} "$@"
+		echo "$1" readonly ${HOME} && && "$1" then --verbose sed x=1 sed 2>/dev/null
+	2>/dev/null sed then --verbose done "$1" printf ${HOME} /usr/bin
+-eu printf readonly /usr/bin printf echo test printf echo -eu | 2>/dev/null
+		export 'quoted text' "$@" done awk
+		echo --verbose readonly 2>/dev/null /usr/bin cd local | then awk done /usr/bin
+		2>/dev/null "$@" grep echo
+${HOME} -eu awk sed -eu ${HOME} local awk --verbose $(pwd) grep
+local -eu 'quoted text' printf
+		grep local "$@" printf -eu then --verbose export 'quoted text'
+local /usr/bin test x=1 printf 2>/dev/null sed $(pwd) && then cd
+	x=1 -eu /usr/bin cd export test echo "$1" "$1" -eu echo | ${HOME} test awk |
+		"$@" ${HOME} 'quoted text' "$@" -eu --verbose
+"$1" $(pwd) /usr/bin local cd done local $(pwd)
+&& /usr/bin 2>/dev/null then
+	local done awk cd /usr/bin
+		sed -eu --verbose $(pwd) --verbose echo -eu grep local ${HOME}
+cd /usr/bin done "$1" then readonly printf export echo
+		done readonly -eu "$1" && awk 'quoted text'
+	echo 2>/dev/null 2>/dev/null $(pwd) grep local $(pwd) grep export 'quoted text'
+"$1" sed awk "$@" awk awk && $(pwd) done readonly sed
+echo --verbose "$1" | /usr/bin cd grep "$@" sed 2>/dev/null
+	'quoted text' "$1" $(pwd) sed 'quoted text' "$1" test grep --verbose export
+printf sed echo 'quoted text' grep
+	"$1" "$@" test then -eu grep export "$1" printf sed echo x=1
+&& export grep $(pwd) 'quoted text' echo printf
+	then done && local x=1 /usr/bin awk done
+--verbose "$@" | awk echo printf
+		cd readonly "$@" echo test grep --verbose readonly /usr/bin
+export export $(pwd) ${HOME} printf --verbose done | printf
+		/usr/bin export $(pwd) sed test | test 'quoted text' $(pwd) export | then
+	${HOME} ${HOME} 'quoted text'
+local test sed awk 2>/dev/null x=1 x=1 cd && readonly "$@" --verbose done $(pwd)
+| 'quoted text' $(pwd) readonly sed printf printf x=1 sed | ${HOME}
+/usr/bin $(pwd) 2>/dev/null
+	test && /usr/bin readonly readonly ${HOME}
+		then printf 'quoted text' && grep test --verbose export
+		done done "$1" x=1 grep test readonly 'quoted text' && "$@" "$1" 2>/dev/null
+	'quoted text' echo then
+	| "$1" printf $(pwd) echo | cd
+		awk echo awk | local echo cd -eu | test sed cd $(pwd) local --verbose
+	echo $(pwd) readonly grep && echo then $(pwd) 2>/dev/null | | x=1 awk
+		awk grep test "$1" awk && readonly
+		$(pwd) -eu local then cd cd "$1" test | x=1 echo cd 2>/dev/null
+	then "$@" printf /usr/bin grep echo && -eu readonly 2>/dev/null /usr/bin -eu
+		sed -eu -eu 'quoted text'
+		grep done cd "$1" 'quoted text'
+		printf done echo 'quoted text'
+--verbose echo printf echo | $(pwd) --verbose "$@" 'quoted text' echo done awk
+--verbose printf printf export
+"$@" && cd "$@" "$1" cd /usr/bin
+	export echo ${HOME} 2>/dev/null x=1 export | printf $(pwd) grep
+		awk local done x=1 grep "$@" local done grep "$1" test --verbose
+	grep "$1" then test /usr/bin cd "$1" && printf
+	"$1" awk readonly | cd export local -eu && awk local /usr/bin local
+printf && awk "$1" | | --verbose "$@" -eu ${HOME} | awk "$@" "$1" printf
+		local 'quoted text' echo grep ${HOME} $(pwd) grep 2>/dev/null
+		done awk "$1" x=1 ${HOME} | local | && awk 'quoted text' x=1
+		--verbose awk -eu awk echo then 'quoted text'
+	grep grep cd -eu cd 'quoted text' export cd /usr/bin /usr/bin
+		-eu --verbose && cd "$1" readonly 'quoted text' --verbose 2>/dev/null
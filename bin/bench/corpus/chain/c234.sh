@@ -0,0 +1,2001 @@
+		$(pwd) echo x=1 grep echo $(pwd) && echo
+	$(pwd) $(pwd) --verbose awk | x=1 "$@" --verbose export
+	${HOME} $(pwd) then echo local local test
+&& export && grep readonly then test
+&& sed export --verbose /usr/bin cd
+echo readonly awk grep export --verbose
+	2>/dev/null printf export awk
+		&& --verbose echo sed grep /usr/bin 'quoted text' "$1" | readonly local &&
+readonly && echo readonly $(pwd)
+	then cd local cd -eu echo 'quoted text' awk $(pwd) $(pwd) x=1 readonly
+		local done local 'quoted text' echo export | |
+		| test printf 'quoted text' grep grep
+		grep $(pwd) done test export printf grep ${HOME}
+		--verbose | sed printf &&
+		printf ${HOME} then then ${HOME} /usr/bin
+echo readonly printf printf
+export 2>/dev/null x=1 test "$@" cd then grep
+"$1" cd $(pwd) -eu -eu local cd done export cd | awk grep awk export done
+${HOME} sed test 2>/dev/null
+		printf -eu "$@" then "$@" x=1 then sed 'quoted text' test echo x=1
+	local 'quoted text' local x=1 then sed -eu
+	then "$1" | export local awk && 'quoted text'
+		--verbose cd export test x=1 ${HOME} /usr/bin /usr/bin
+'quoted text' cd "$@" x=1 test x=1 --verbose ${HOME} awk then
+printf -eu export readonly done done grep --verbose
+		x=1 'quoted text' printf sed printf echo && --verbose x=1 x=1
+	test printf readonly && 2>/dev/null readonly 'quoted text'
+&& /usr/bin /usr/bin && ${HOME} -eu $(pwd) $(pwd)
+		printf awk export "$@" ${HOME} | cd ${HOME} --verbose awk ${HOME} x=1
+cd "$@" echo cd --verbose ${HOME} "$1" grep $(pwd) echo $(pwd)
+	x=1 printf echo -eu "$@" -eu
+	$(pwd) -eu echo printf local && printf
+${HOME} echo 'quoted text' then "$1" x=1 local
+		$(pwd) x=1 export test echo
+	export 2>/dev/null local done local x=1 echo /usr/bin sed
+awk $(pwd) /usr/bin ${HOME} ${HOME} export
+local echo x=1 x=1 done grep done | then grep
+	"$@" /usr/bin "$@" -eu && x=1 done $(pwd)
+	2>/dev/null export x=1 grep "$@" -eu awk
+	echo $(pwd) "$@" ${HOME} "$1" done x=1 done grep printf x=1 "$1" | cd printf "$@"
+		x=1 --verbose local --verbose local 'quoted text' sed then -eu 'quoted text'
+grep readonly "$@" | ${HOME} "$1" grep grep && | cd test ${HOME} grep
+	-eu readonly readonly test | $(pwd) then $(pwd) /usr/bin
+"$@" $(pwd) local -eu local grep --verbose "$1" then /usr/bin echo then
+	/usr/bin 'quoted text' then local export local $(pwd)
+--verbose ${HOME} | "$@" --verbose &&
+"$1" export x=1 grep test
+	/usr/bin grep grep "$1" test grep 'quoted text'
+		/usr/bin && done awk "$@" && x=1 "$@" -eu done sed /usr/bin
+test local awk -eu awk readonly readonly
+		/usr/bin sed local $(pwd)
+grep then done --verbose ${HOME} readonly
+	| x=1 "$@" readonly && ${HOME} x=1 done awk && then 2>/dev/null 2>/dev/null
+		export | x=1 export cd "$1" export readonly ${HOME} /usr/bin 'quoted text' done
+sed echo ${HOME} local | --verbose awk echo sed echo x=1 2>/dev/null done
+		awk then awk "$@" $(pwd) "$1" then then printf done "$1" $(pwd) $(pwd) --verbose
+	"$1" "$1" cd readonly "$@" 2>/dev/null test
+printf -eu /usr/bin echo --verbose 'quoted text' $(pwd)
+		readonly readonly readonly test -eu sed
+&& grep 'quoted text'
+		then cd sed && /usr/bin && ${HOME} grep "$@" /usr/bin /usr/bin
+	"$1" awk awk /usr/bin echo echo 2>/dev/null awk readonly 2>/dev/null
+		-eu /usr/bin ${HOME} /usr/bin /usr/bin 2>/dev/null
+	printf awk && && 'quoted text' local ${HOME} -eu local cd
+	${HOME} -eu $(pwd) export readonly test "$@" done 'quoted text'
+		then awk $(pwd) -eu done -eu "$1" sed "$@" && ${HOME} test then done | printf "$1"
+then "$1" printf "$1" 'quoted text' $(pwd) sed test test | readonly
+		printf "$1" awk x=1 x=1 -eu && 'quoted text'
+	${HOME} -eu test local cd 2>/dev/null 2>/dev/null
+		export | && x=1 "$1" export printf export
+-eu awk 2>/dev/null "$1"
+	grep /usr/bin /usr/bin printf local 'quoted text' sed ${HOME} printf
+		"$@" cd local "$1" "$@" /usr/bin
+	"$@" local "$@" echo printf readonly
+		${HOME} done printf 2>/dev/null test sed cd cd 'quoted text'
+	local x=1 -eu 2>/dev/null | awk /usr/bin --verbose ${HOME} then ${HOME}
+	${HOME} grep then /usr/bin export done
+	"$1" && test ${HOME} then printf -eu then ${HOME} awk && "$@" -eu -eu &&
+local grep printf -eu cd local done export export readonly
+		"$@" printf /usr/bin done test export local 2>/dev/null 2>/dev/null
+		/usr/bin echo 2>/dev/null
+		awk test cd done export && 2>/dev/null "$1" sed sed "$@" ${HOME} -eu "$1" done
+	${HOME} /usr/bin && ${HOME} grep x=1 | export /usr/bin
+x=1 ${HOME} 2>/dev/null "$@"
+	--verbose /usr/bin grep readonly sed $(pwd) --verbose ${HOME}
+	&& grep | sed x=1 2>/dev/null echo 2>/dev/null
+		grep readonly awk then -eu grep 2>/dev/null local grep readonly -eu
+		--verbose x=1 cd "$@" x=1 grep test test export readonly cd export
+	$(pwd) /usr/bin -eu done "$1" export sed readonly
+	&& readonly readonly --verbose
+"$1" x=1 then cd | x=1 done cd "$1" x=1 /usr/bin --verbose grep
+readonly "$1" "$1" then test -eu x=1 --verbose && | sed cd echo readonly
+		"$1" 2>/dev/null 'quoted text' "$@" | && /usr/bin 2>/dev/null sed done cd 'quoted text'
+&& local x=1 test 'quoted text' 2>/dev/null awk /usr/bin printf
+		readonly echo && grep ${HOME} readonly then $(pwd) --verbose
+	'quoted text' grep 2>/dev/null
+-eu /usr/bin && cd printf ${HOME} 2>/dev/null printf
+		printf | local /usr/bin readonly
+		--verbose readonly | sed awk echo 2>/dev/null awk grep export /usr/bin echo awk
+		export | -eu /usr/bin echo done echo /usr/bin
+		done "$1" "$@" -eu done echo
+		test then x=1 x=1 echo printf export readonly 'quoted text'
+	"$1" x=1 awk export sed sed "$1" cd "$@" "$1" export grep -eu done 'quoted text'
+	awk ${HOME} $(pwd) | x=1 echo export --verbose ${HOME} grep | sed cd x=1 ${HOME}
+		echo 2>/dev/null sed -eu && 2>/dev/null "$@" "$1"
+		$(pwd) 'quoted text' awk --verbose 'quoted text'
+done && --verbose --verbose local local readonly cd x=1 ${HOME} x=1 'quoted text'
+sed --verbose test cd && "$1"
+&& done grep "$1" x=1 readonly done
+"$1" readonly | "$1" local test test -eu readonly
+test grep ${HOME} printf --verbose $(pwd) export
+	--verbose -eu awk echo $(pwd)
+		$(pwd) export ${HOME}
+'quoted text' test "$@" local export &&
+		2>/dev/null grep echo awk "$@" /usr/bin -eu /usr/bin
+		printf 'quoted text' awk local printf
+		awk 'quoted text' ${HOME} done x=1 'quoted text'
+"$@" $(pwd) local cd local |
+/usr/bin echo then --verbose -eu --verbose test
+/usr/bin done export local then --verbose x=1 sed local "$@"
+	test sed awk printf | --verbose
+		local printf printf done awk ${HOME} | && && sed test 'quoted text'
+	readonly sed grep local readonly test readonly
+		awk ${HOME} | printf printf sed printf 2>/dev/null --verbose
+export "$1" cd printf grep -eu awk sed $(pwd)
+		"$@" echo test export -eu sed readonly -eu printf
+		-eu ${HOME} "$@" export printf export grep 'quoted text'
+		"$@" local grep $(pwd) done printf test $(pwd) && /usr/bin ${HOME} export
+	printf awk local readonly export printf echo export done
+grep grep cd then echo readonly -eu printf x=1 $(pwd) $(pwd) local
+		local grep 2>/dev/null -eu done test then x=1 echo /usr/bin local "$@" "$1" 2>/dev/null
+readonly awk --verbose sed $(pwd) sed printf --verbose sed grep test
+	'quoted text' -eu -eu echo done then 2>/dev/null
+"$1" echo --verbose /usr/bin local 'quoted text'
+		printf local awk done ${HOME} && printf && sed $(pwd)
+		--verbose sed | readonly && then
+		--verbose then sed printf 2>/dev/null &&
+done | sed printf /usr/bin ${HOME}
+"$1" awk cd cd "$@" local -eu readonly sed
+test grep then -eu printf /usr/bin $(pwd) && then then awk sed --verbose
+	awk test 2>/dev/null done ${HOME}
+x=1 'quoted text' $(pwd) grep $(pwd) 'quoted text' --verbose x=1
+		printf export --verbose -eu x=1 grep
+	"$@" sed x=1 test local awk cd export x=1 cd awk readonly echo --verbose
+	cd printf 'quoted text' x=1 && export
+	export awk then done readonly 2>/dev/null printf 2>/dev/null sed "$@" ${HOME}
+		export /usr/bin export "$1" "$@" -eu "$@" "$1" sed grep
+&& | echo printf --verbose -eu
+'quoted text' readonly $(pwd) test -eu
+		sed awk "$@" 2>/dev/null | cd "$1" sed sed x=1 done done $(pwd)
+		test echo cd 2>/dev/null sed | |
+		grep then $(pwd) cd local /usr/bin -eu echo echo readonly --verbose
+		sed sed cd awk | "$1" then awk "$1" ${HOME}
+	readonly readonly awk && -eu
+		&& ${HOME} then --verbose awk && ${HOME} && "$1" /usr/bin echo sed 'quoted text'
+	'quoted text' 'quoted text'
+	$(pwd) $(pwd) done grep && readonly printf done sed /usr/bin --verbose
+	then readonly then local | sed x=1 printf test test
+	test /usr/bin ${HOME} --verbose export "$@" $(pwd) export export done grep
+		"$@" export then grep printf local --verbose awk 'quoted text' "$@"
+	&& x=1 $(pwd) test test done $(pwd) -eu --verbose 'quoted text'
+		/usr/bin $(pwd) then "$@" printf test --verbose
+	${HOME} && echo export && 2>/dev/null
+	printf done export grep ${HOME} $(pwd)
+	export -eu readonly grep | ${HOME} -eu echo done | 'quoted text'
+	${HOME} "$@" cd /usr/bin test export
+		echo /usr/bin 2>/dev/null sed export 'quoted text' "$@" | sed test x=1
+test export 2>/dev/null 2>/dev/null x=1 --verbose cd "$@" test cd
+	--verbose x=1 readonly
+	2>/dev/null export x=1 "$@" 'quoted text'
+then && | --verbose sed then test then cd ${HOME} done ${HOME} | sed readonly
+		local local --verbose --verbose grep "$1" ${HOME} echo
+	"$@" export awk sed && printf -eu
+2>/dev/null local "$@" awk readonly x=1 done "$1" $(pwd)
+--verbose 2>/dev/null export echo test | ${HOME} readonly test "$1" sed "$1" -eu
+	readonly --verbose local then | /usr/bin 'quoted text' ${HOME}
+local /usr/bin readonly 'quoted text' && cd awk test
+		echo | --verbose readonly "$1" done awk
+test echo sed readonly then test
+		"$@" ${HOME} sed test awk awk grep
+		sed --verbose printf 2>/dev/null readonly && x=1 x=1 test readonly
+/usr/bin awk x=1 "$1" printf --verbose 'quoted text' "$1"
+local --verbose -eu $(pwd) local echo
+export | ${HOME} "$1"
+		"$1" $(pwd) --verbose "$@" export grep
+		| test sed 'quoted text' | export "$@"
+"$1" --verbose x=1 --verbose then 'quoted text' --verbose $(pwd) echo 2>/dev/null
+		grep "$1" "$@" | 2>/dev/null /usr/bin printf
+		cd grep x=1 cd test ${HOME} /usr/bin test test printf
+		then 'quoted text' grep /usr/bin | then done
+		$(pwd) x=1 "$@" readonly then echo &&
+-eu local "$1" test printf done $(pwd) --verbose
+cd sed sed "$@" test done cd ${HOME} && grep -eu readonly awk export $(pwd) echo
+		--verbose 'quoted text' echo 'quoted text'
+	--verbose "$@" /usr/bin
+		then sed echo local 'quoted text' 2>/dev/null cd --verbose test local $(pwd) 2>/dev/null
+	"$@" export done 'quoted text'
+printf local local printf -eu
+	'quoted text' export echo 2>/dev/null
+		cd cd -eu export "$1" ${HOME} ${HOME} $(pwd) --verbose local readonly grep /usr/bin
+		${HOME} "$@" done "$1" then done grep /usr/bin --verbose
+		sed grep readonly 2>/dev/null x=1 'quoted text'
+"$1" "$@" "$@" local export --verbose readonly "$1"
+printf grep sed sed ${HOME} printf then 2>/dev/null echo local 2>/dev/null | 2>/dev/null
+	export then echo && test awk echo | test export readonly readonly awk printf
+	cd "$@" echo echo x=1 local 2>/dev/null
+		x=1 done then test done $(pwd) $(pwd) -eu
+		done then awk /usr/bin
+		cd printf x=1 echo echo ${HOME} $(pwd) 2>/dev/null
+	-eu $(pwd) sed $(pwd) 2>/dev/null grep export 'quoted text'
+		&& done "$1" printf /usr/bin local export x=1 "$@" /usr/bin "$@" done echo
+| local ${HOME} cd "$1" cd "$@" "$@" ${HOME} readonly done then done x=1 sed done
+	sed done test echo ${HOME} done local printf local cd local
+		x=1 printf "$1" /usr/bin awk 'quoted text'
+		export --verbose test grep "$1" readonly printf
+		grep /usr/bin ${HOME} then cd export "$1" 'quoted text' x=1 sed | /usr/bin grep
+		test local ${HOME} grep x=1 --verbose export cd /usr/bin grep sed -eu test
+"$@" /usr/bin ${HOME} local 2>/dev/null cd $(pwd) x=1 "$1" /usr/bin
+$(pwd) readonly --verbose printf awk then --verbose awk
+test ${HOME} export awk test 'quoted text' sed export
+		-eu x=1 | echo local -eu "$1" readonly && done | "$@" -eu
+export && done $(pwd) test --verbose
+		readonly done 'quoted text'
+grep cd /usr/bin --verbose && ${HOME} printf ${HOME} -eu "$@" ${HOME}
+-eu echo "$@" "$@" then grep --verbose && echo grep local test /usr/bin awk x=1
+"$@" ${HOME} readonly echo ${HOME}
+	-eu grep "$1" | grep 2>/dev/null
+/usr/bin && && 'quoted text'
+		local test done "$@" readonly --verbose grep
+	export /usr/bin grep 'quoted text' 'quoted text'
+	echo then grep local "$@" test 2>/dev/null local test
+		$(pwd) echo x=1 sed --verbose
+		then awk grep 'quoted text' cd "$1" $(pwd) "$@" printf | readonly --verbose cd
+	export 2>/dev/null export test awk readonly export ${HOME} readonly | grep export
+	/usr/bin && 2>/dev/null then echo local 2>/dev/null export
+		done --verbose 'quoted text' ${HOME} --verbose
+then -eu then export sed $(pwd) --verbose echo
+		done | echo then --verbose
+	sed local 2>/dev/null -eu "$@" done printf printf x=1 done export &&
+echo "$@" test -eu readonly
+		&& | grep && readonly printf ${HOME} test /usr/bin cd
+		grep printf local cd sed && -eu test
+		"$1" grep printf export | done x=1
+sed export sed local 'quoted text' --verbose sed grep printf | 2>/dev/null
+$(pwd) 'quoted text' cd /usr/bin
+/usr/bin "$@" ${HOME} awk local local sed awk test sed printf
+		done sed --verbose printf then | export then
+'quoted text' then done "$1" awk && printf --verbose awk test && "$1" 2>/dev/null
+readonly ${HOME} cd -eu 'quoted text' "$1" --verbose
+then 'quoted text' sed ${HOME} | --verbose
+		cd local x=1 printf readonly
+		then "$1" awk -eu local sed
+/usr/bin --verbose -eu "$@" cd x=1 "$1" test local sed
+awk then 'quoted text'
+		$(pwd) grep test awk "$@" grep
+	"$@" printf /usr/bin local cd -eu printf export done ${HOME} "$1" ${HOME} local
+		2>/dev/null 'quoted text' cd 'quoted text' sed "$1"
+	| cd ${HOME} printf export && local then sed x=1 --verbose test then
+	&& 'quoted text' sed awk && && then 2>/dev/null
+	then --verbose $(pwd) "$1" done printf /usr/bin "$1"
+readonly awk -eu local
+"$@" /usr/bin ${HOME} test export then x=1 /usr/bin x=1 done -eu
+	/usr/bin $(pwd) then -eu /usr/bin echo done
+x=1 printf /usr/bin /usr/bin "$@" $(pwd) done cd
+	test /usr/bin $(pwd) "$1" local | done "$1" cd "$1" test echo
+	echo cd /usr/bin 'quoted text' export
+		2>/dev/null then "$@" echo
+-eu $(pwd) /usr/bin x=1 sed /usr/bin /usr/bin "$1" echo awk --verbose
+		$(pwd) 2>/dev/null --verbose then test "$@" && ${HOME} x=1 sed --verbose
+	test readonly ${HOME} | "$@" ${HOME} | cd -eu "$1" $(pwd) done && readonly grep
+		-eu awk $(pwd) readonly export -eu then sed -eu cd
+		2>/dev/null printf && "$@" "$1"
+sed sed local export | echo -eu readonly /usr/bin 'quoted text' -eu local grep then
+		&& $(pwd) 'quoted text' x=1 2>/dev/null 2>/dev/null "$@" && 2>/dev/null
+test ${HOME} awk done 'quoted text'
+	| x=1 -eu done /usr/bin | $(pwd) grep 2>/dev/null test cd "$@" | "$1"
+	"$@" -eu x=1 done && cd done && awk -eu test && awk then cd sed then --verbose
+	readonly 2>/dev/null test /usr/bin
+test echo awk readonly 2>/dev/null test then 'quoted text'
+		${HOME} x=1 ${HOME} then /usr/bin | cd readonly awk "$1"
+	local --verbose printf 'quoted text' && "$@" grep done && /usr/bin cd &&
+	export then $(pwd) local $(pwd) && local x=1 local &&
+	--verbose printf sed | echo local && ${HOME}
+2>/dev/null export test -eu printf cd done && $(pwd) --verbose
+	export 'quoted text' test 2>/dev/null sed printf readonly &&
+	export -eu /usr/bin ${HOME} "$1" 'quoted text' "$@" | "$@" test
+		grep --verbose awk "$1" && && echo $(pwd)
+	/usr/bin local --verbose $(pwd) grep
+x=1 -eu && then then /usr/bin
+	readonly --verbose 2>/dev/null $(pwd) "$1" cd then && && 'quoted text'
+	2>/dev/null /usr/bin grep ${HOME} then local -eu /usr/bin done 'quoted text' "$1"
+echo $(pwd) "$1" "$@" --verbose && "$@" --verbose --verbose export $(pwd)
+	$(pwd) --verbose done local && echo /usr/bin -eu echo awk local printf
+${HOME} cd "$@" then && echo 'quoted text' then test local
+		sed && $(pwd) sed printf 'quoted text' test done /usr/bin
+		awk test $(pwd) -eu x=1 printf
+		test 2>/dev/null export readonly "$@" echo $(pwd) readonly
+	--verbose --verbose x=1 echo 2>/dev/null
+		test done awk ${HOME} "$@" /usr/bin readonly
+		2>/dev/null x=1 cd grep readonly test "$@" /usr/bin sed 'quoted text' && &&
+echo cd sed 2>/dev/null printf "$@" $(pwd)
+	cd echo awk printf && local /usr/bin ${HOME} sed "$1" && $(pwd) &&
+${HOME} test then -eu export x=1 "$@" done 'quoted text' cd
+	local 'quoted text' ${HOME} sed ${HOME} $(pwd) -eu 2>/dev/null 'quoted text'
+	done "$@" $(pwd) "$@" awk sed 2>/dev/null cd --verbose
+done sed x=1 echo then x=1 cd
+		test awk "$@" then x=1
+	/usr/bin && grep -eu --verbose echo "$@" && $(pwd) printf sed ${HOME}
+		x=1 2>/dev/null "$@" sed | 2>/dev/null readonly local done awk && ${HOME}
+		echo awk "$@" readonly |
+grep /usr/bin ${HOME} done && && "$1"
+	2>/dev/null && done then printf echo printf test x=1 cd --verbose then
+		printf export --verbose 2>/dev/null && 2>/dev/null
+		-eu grep test readonly awk "$@" done "$1" 'quoted text'
+		"$1" awk "$@" grep 2>/dev/null -eu readonly && awk test
+		x=1 && x=1 /usr/bin "$@" local "$@" cd awk local readonly
+&& 'quoted text' local
+	"$1" | then echo --verbose printf echo done test printf echo test echo
+	2>/dev/null /usr/bin x=1 "$@" $(pwd) export 2>/dev/null
+	done x=1 readonly done "$1" echo -eu --verbose ${HOME} && $(pwd) done local
+		sed -eu "$@" "$@" grep x=1 && then x=1 "$@" sed | 'quoted text'
+	echo done ${HOME} $(pwd) echo cd x=1
+		${HOME} -eu "$@" sed 'quoted text' | printf cd ${HOME} /usr/bin printf ${HOME}
+done x=1 done local /usr/bin "$@" done readonly local test
+	awk printf sed /usr/bin printf
+	--verbose then 2>/dev/null local ${HOME}
+	2>/dev/null local sed
+		"$@" done printf | readonly ${HOME} printf export cd /usr/bin
+cd grep 'quoted text'
+	local $(pwd) --verbose 2>/dev/null
+$(pwd) "$@" printf 2>/dev/null "$1" sed sed grep | -eu ${HOME} sed done printf
+		${HOME} "$1" cd -eu echo test --verbose test done test -eu
+		${HOME} echo "$@" local readonly echo
+		x=1 sed sed then ${HOME} /usr/bin "$1" 2>/dev/null done done echo sed | -eu 2>/dev/null
+		--verbose && readonly grep grep echo && awk echo awk
+		"$1" then grep | export test cd x=1 2>/dev/null
+		awk "$1" "$@" local "$@" awk $(pwd) then --verbose printf readonly && grep local
+	"$@" readonly test awk ${HOME} && sed grep -eu $(pwd) awk readonly readonly
+x=1 | x=1 -eu "$1" "$1" readonly
+	&& 'quoted text' -eu readonly sed export | "$@" 'quoted text' awk "$1"
+	printf $(pwd) x=1 awk 'quoted text'
+	$(pwd) then done done echo ${HOME} awk
+then "$1" export $(pwd) 2>/dev/null
+${HOME} $(pwd) && 2>/dev/null local && printf | "$@" printf /usr/bin
+		-eu --verbose cd sed x=1 "$@" 2>/dev/null --verbose then ${HOME}
+		&& cd && ${HOME} sed sed | "$1" echo test ${HOME}
+"$1" readonly test "$@" 'quoted text' echo cd "$1" && printf test && /usr/bin
+		done 'quoted text' local /usr/bin
+		local -eu cd export done ${HOME} "$@" done
+		test /usr/bin 2>/dev/null then x=1 | readonly
+	| -eu "$@" x=1 awk ${HOME} grep --verbose
+2>/dev/null ${HOME} && grep | echo done 2>/dev/null test grep "$@"
+cd local local x=1 x=1 && x=1 printf "$1" sed 'quoted text'
+	local cd 2>/dev/null readonly --verbose grep ${HOME} $(pwd)
+		readonly readonly /usr/bin
+	echo 'quoted text' x=1 cd /usr/bin echo "$@" "$1" -eu awk 'quoted text' -eu
+--verbose ${HOME} /usr/bin
+	2>/dev/null awk grep $(pwd) /usr/bin cd ${HOME} echo -eu then 2>/dev/null
+awk "$1" 2>/dev/null done -eu "$@" then test x=1 cd then cd test local && grep
+then readonly done x=1 sed 2>/dev/null && grep
+	done "$@" /usr/bin -eu -eu
+	--verbose readonly printf $(pwd) 2>/dev/null sed $(pwd) echo printf && 'quoted text'
+		-eu local printf test x=1 export -eu x=1 then 2>/dev/null
+	awk ${HOME} done /usr/bin $(pwd)
+	cd 'quoted text' grep ${HOME} x=1 export 2>/dev/null
+		readonly test grep echo | export echo
+&& && 2>/dev/null readonly then printf cd --verbose
+		/usr/bin echo $(pwd) awk sed -eu -eu | 'quoted text'
+		sed | ${HOME} | | sed && local -eu test local
+	local echo /usr/bin echo
+		/usr/bin echo 'quoted text' x=1 echo x=1 ${HOME} local "$1" then done
+	local export $(pwd) ${HOME} grep echo
+	| echo local "$1" "$@" && local export --verbose echo then
+'quoted text' /usr/bin echo readonly
+2>/dev/null done ${HOME} test x=1 "$1"
+'quoted text' local 'quoted text' local x=1 cd export -eu x=1 x=1 echo -eu
+	"$1" --verbose echo "$1" "$1" test awk printf -eu sed x=1 local test
+		local | done local "$1" 2>/dev/null
+	--verbose "$@" "$@" sed printf
+		'quoted text' --verbose local local cd $(pwd) export done 'quoted text'
+		'quoted text' /usr/bin readonly then "$@" ${HOME} export --verbose
+sed "$1" sed sed 'quoted text'
+		readonly readonly --verbose then -eu --verbose then then "$@" /usr/bin
+		awk grep then ${HOME} 'quoted text' sed printf printf cd printf /usr/bin awk export
+x=1 'quoted text' awk echo
+	sed "$1" readonly ${HOME} sed grep "$@" "$1" export test
+		$(pwd) $(pwd) ${HOME} readonly awk readonly awk 'quoted text'
+	-eu printf $(pwd) cd && | cd awk readonly
+'quoted text' ${HOME} 2>/dev/null 2>/dev/null /usr/bin done grep
+	/usr/bin printf cd "$@" -eu $(pwd) --verbose -eu then done
+	${HOME} local 'quoted text' ${HOME} awk 2>/dev/null
+	done "$1" 2>/dev/null 2>/dev/null
+cd export done then sed 'quoted text' && echo
+&& test && readonly 'quoted text' test $(pwd) cd ${HOME}
+cd then /usr/bin readonly
+printf /usr/bin /usr/bin cd sed $(pwd)
+	-eu ${HOME} --verbose /usr/bin printf $(pwd) printf printf 'quoted text'
+test sed printf sed echo done /usr/bin local "$@" "$1" $(pwd) ${HOME} 2>/dev/null
+		2>/dev/null awk awk echo 2>/dev/null --verbose then awk -eu
+readonly cd done cd cd printf 'quoted text'
+	&& --verbose $(pwd) "$1" echo ${HOME} awk awk local then 2>/dev/null
+	then "$@" awk x=1 test
+	${HOME} | readonly awk | sed grep readonly --verbose
+		done awk then && 'quoted text' x=1 grep ${HOME} sed --verbose printf
+	"$@" grep /usr/bin 2>/dev/null then $(pwd) cd -eu awk x=1 then readonly
+		2>/dev/null echo local "$@" "$1" readonly 2>/dev/null then
+readonly awk readonly && | done export readonly test --verbose /usr/bin then
+		"$@" "$@" awk done $(pwd) awk x=1 awk --verbose sed
+		"$@" --verbose --verbose grep | ${HOME} && awk "$1" printf && ${HOME}
+	local printf then 2>/dev/null
+		$(pwd) readonly grep then awk 2>/dev/null x=1 awk readonly readonly
+	done printf "$@" sed 'quoted text' | /usr/bin "$1" export "$1" $(pwd) /usr/bin
+		$(pwd) "$@" && grep readonly
+	awk sed then | sed && 2>/dev/null local "$1" ${HOME} 'quoted text' "$1"
+		test local -eu done cd | echo /usr/bin -eu && test "$1" awk | done -eu readonly
+${HOME} printf readonly ${HOME} -eu 'quoted text' then
+		test | grep readonly "$@" ${HOME} then --verbose 2>/dev/null
+	"$@" x=1 then test cd done && && sed done /usr/bin printf
+"$@" awk done 'quoted text' -eu test 'quoted text' /usr/bin
+	--verbose export 'quoted text' export
+echo then echo readonly readonly
+	| then 2>/dev/null 'quoted text' "$1" done /usr/bin x=1 awk echo test "$@" -eu
+grep printf /usr/bin printf awk cd ${HOME} --verbose
+	&& $(pwd) then | grep && readonly done $(pwd) local local
+		export export grep /usr/bin then "$@" 'quoted text' echo
+	then cd $(pwd) export sed cd /usr/bin done "$1" awk test "$@" ${HOME}
+--verbose 2>/dev/null readonly test grep 2>/dev/null
+	$(pwd) echo -eu $(pwd) ${HOME} awk | cd 2>/dev/null
+		sed test grep readonly "$@" ${HOME} readonly printf /usr/bin
+		"$1" $(pwd) /usr/bin --verbose grep awk -eu "$1" 'quoted text' grep
+grep printf echo -eu /usr/bin
+readonly test echo export echo /usr/bin readonly | sed local -eu /usr/bin
+2>/dev/null 'quoted text' && cd 2>/dev/null --verbose
+echo local 2>/dev/null | /usr/bin $(pwd)
+--verbose printf | done | &&
+		'quoted text' --verbose echo sed done awk
+		done --verbose readonly echo "$@" -eu &&
+		export readonly local sed awk export readonly "$@" printf test
+-eu export awk -eu -eu 'quoted text' export "$1" local
+/usr/bin x=1 ${HOME} /usr/bin grep
+	${HOME} sed local ${HOME} "$@" sed readonly grep && done $(pwd)
+	x=1 2>/dev/null then --verbose
+"$@" --verbose done "$1" && | sed $(pwd) $(pwd) "$1" local | test echo 'quoted text'
+	"$1" done awk sed test sed && sed test test export
+	then export export export
+done then done test $(pwd) $(pwd) && x=1 cd -eu /usr/bin | export readonly awk
+	export "$@" export readonly readonly readonly sed "$@"
+then 2>/dev/null echo "$1" cd | && then
+		/usr/bin printf awk export readonly echo sed
+		awk cd then && --verbose && /usr/bin readonly $(pwd) ${HOME} x=1 && -eu sed "$1"
+	done then echo --verbose local -eu printf /usr/bin "$1" "$1" local | sed 'quoted text'
+"$@" then --verbose --verbose
+test sed x=1 && sed $(pwd) 2>/dev/null
+	2>/dev/null awk x=1 x=1 export 2>/dev/null cd x=1 local 'quoted text'
+test $(pwd) /usr/bin 2>/dev/null "$1" cd 2>/dev/null done 'quoted text'
+		${HOME} -eu -eu awk awk grep sed readonly x=1
+		/usr/bin x=1 test /usr/bin /usr/bin $(pwd) && ${HOME} done ${HOME}
+	printf sed 'quoted text' echo /usr/bin ${HOME} "$1"
+printf ${HOME} local awk $(pwd) | export echo "$1" --verbose
+	test | cd awk readonly local printf then cd export "$@" "$@" && ${HOME}
+	cd -eu 2>/dev/null --verbose /usr/bin readonly done -eu /usr/bin 2>/dev/null --verbose
+	/usr/bin ${HOME} echo x=1 sed | export "$@" $(pwd) local cd
+		grep sed export "$1" readonly x=1 then /usr/bin $(pwd) "$1" && /usr/bin
+		${HOME} --verbose export grep test echo readonly
+		readonly -eu "$@" export echo awk 2>/dev/null test local cd printf
+awk test test | test awk /usr/bin
+then then 2>/dev/null "$1" -eu
+	-eu "$@" $(pwd) | 'quoted text' awk grep awk -eu then sed done test local "$1"
+| && --verbose -eu "$@" test $(pwd)
+	printf readonly x=1 "$1" done cd --verbose --verbose
+		cd 2>/dev/null "$1" ${HOME}
+done "$@" $(pwd) && 'quoted text' 2>/dev/null ${HOME}
+	$(pwd) done then $(pwd) "$1" 'quoted text' then "$@" sed local export 2>/dev/null
+	"$1" -eu "$1" echo awk 2>/dev/null awk 2>/dev/null /usr/bin echo
+	readonly grep | done "$1" && sed done x=1 2>/dev/null "$@" "$@" x=1 cd done
+	export | grep $(pwd) $(pwd) | $(pwd) echo echo 2>/dev/null
+		echo 2>/dev/null awk ${HOME} echo local "$@" "$@" sed test awk local local --verbose
+		export grep ${HOME} echo cd --verbose
+${HOME} test x=1 grep "$1" "$1" grep
+		echo "$@" readonly printf grep export
+&& ${HOME} local export $(pwd) | export && test awk then 2>/dev/null
+	sed printf /usr/bin then local $(pwd) $(pwd) && -eu echo && -eu then
+test && then "$@" x=1 printf $(pwd)
+	then sed sed ${HOME} export export x=1 | export 'quoted text'
+/usr/bin printf | 2>/dev/null echo
+	"$1" test cd -eu $(pwd) export ${HOME} | echo "$1" then "$@" cd then test then
+	sed 2>/dev/null then readonly
+		cd then x=1 done -eu done /usr/bin then grep 2>/dev/null
+		local --verbose done local ${HOME}
+	done test 'quoted text' cd
+		'quoted text' ${HOME} -eu readonly
+		x=1 printf local readonly
+		awk sed echo local readonly 2>/dev/null sed /usr/bin -eu test $(pwd)
+cd ${HOME} export cd awk -eu
+	sed | grep "$@" export cd "$1" sed 'quoted text' readonly ${HOME}
+	cd test 'quoted text' -eu "$@" test && && awk /usr/bin "$1" awk
+	sed echo /usr/bin then test cd test
+		readonly --verbose | export done "$@" -eu "$1" echo --verbose -eu | "$@" test
+awk 'quoted text' --verbose x=1
+	'quoted text' local $(pwd) awk printf awk printf "$@" $(pwd)
+	sed local "$1" grep then /usr/bin
+		echo printf local | then -eu cd sed awk export sed && test awk
+		readonly --verbose test local 'quoted text' ${HOME} 2>/dev/null
+		${HOME} then -eu && && "$@" cd test
+$(pwd) "$@" export "$1" ${HOME}
+	2>/dev/null 2>/dev/null
+cd export x=1 | printf local
+	&& 'quoted text' readonly export printf x=1 /usr/bin done
+		"$@" "$1" 'quoted text' sed awk printf 'quoted text'
+"$1" ${HOME} awk 'quoted text' test
+readonly test | done -eu $(pwd) then cd export grep -eu -eu 2>/dev/null readonly
+"$1" printf grep awk "$@" ${HOME}
+&& then grep 2>/dev/null
+		awk local cd test grep sed 2>/dev/null "$@" /usr/bin --verbose cd 'quoted text'
+		then export export --verbose x=1 "$1" then x=1 sed local local sed ${HOME}
+readonly "$1" x=1 awk /usr/bin done $(pwd) sed test done ${HOME}
+"$1" export x=1 --verbose 2>/dev/null readonly 2>/dev/null 'quoted text'
+${HOME} grep 'quoted text' readonly ${HOME} | /usr/bin x=1 readonly ${HOME}
+		${HOME} /usr/bin | cd && /usr/bin then cd readonly cd
+/usr/bin echo "$1" ${HOME} 2>/dev/null 'quoted text' export then
+${HOME} && && grep --verbose
+/usr/bin --verbose ${HOME} && $(pwd)
+	sed cd grep "$@" local | $(pwd) export --verbose local
+		printf echo "$@" ${HOME} && && ${HOME} awk $(pwd) "$@"
+$(pwd) grep "$@" && | local $(pwd) "$@"
+		then cd awk awk printf cd export done readonly
+	awk grep "$@" local -eu local
+--verbose "$1" readonly awk test echo ${HOME} 2>/dev/null sed done
+		echo | | 2>/dev/null ${HOME} echo printf ${HOME} $(pwd) grep && -eu sed
+	cd local | grep ${HOME}
+grep ${HOME} x=1 printf 'quoted text' "$1" ${HOME} /usr/bin then grep awk
+2>/dev/null echo $(pwd) | awk /usr/bin then x=1 printf
+"$@" sed /usr/bin awk ${HOME} -eu sed --verbose
+		then 2>/dev/null test sed local "$1"
+"$1" echo | cd "$@" "$1" echo 2>/dev/null awk $(pwd)
+		readonly 'quoted text' -eu "$@" | $(pwd)
+		grep x=1 awk $(pwd) --verbose readonly done "$@" ${HOME} echo awk 'quoted text'
+	${HOME} --verbose "$1" test 'quoted text'
+'quoted text' x=1 awk ${HOME} test grep grep readonly grep "$@" 'quoted text'
+	/usr/bin sed ${HOME} ${HOME} x=1 $(pwd) | 'quoted text' "$@" test then then sed
+		test ${HOME} "$@" -eu printf | test
+	"$@" printf then sed | x=1 done "$1" -eu printf readonly cd awk then echo local
+then 2>/dev/null grep x=1 x=1 'quoted text' printf export
+		$(pwd) x=1 /usr/bin ${HOME} "$@" &&
+$(pwd) -eu echo && -eu then grep ${HOME} done local && /usr/bin
+		grep cd grep 2>/dev/null 'quoted text' grep 'quoted text' --verbose | $(pwd)
+test -eu /usr/bin printf cd sed readonly "$1" grep
+-eu x=1 done then /usr/bin "$1" 'quoted text' 'quoted text' awk /usr/bin
+readonly then grep 'quoted text' /usr/bin
+		/usr/bin grep | 2>/dev/null then "$@"
+done 'quoted text' x=1 done done $(pwd)
+echo awk done && ${HOME} | -eu sed && | /usr/bin grep | grep readonly ${HOME} "$1"
+		&& echo echo readonly -eu ${HOME} x=1 echo printf done && export grep echo
+	then echo awk awk 'quoted text' sed awk readonly /usr/bin cd local
+		printf awk --verbose 'quoted text' done -eu local cd &&
+		echo export && /usr/bin done
+		sed awk echo awk awk printf ${HOME}
+${HOME} /usr/bin ${HOME}
+		done done 2>/dev/null readonly
+	&& "$1" export cd && "$@" $(pwd) $(pwd)
+		"$1" 2>/dev/null sed | --verbose $(pwd) -eu sed x=1
+	"$1" grep awk | grep 'quoted text'
+	"$1" "$1" echo sed "$@" sed test local && local /usr/bin readonly
+	"$1" x=1 $(pwd) then test cd cd done $(pwd) | /usr/bin readonly done
+	sed then readonly cd ${HOME} sed "$1" grep ${HOME} && "$@" $(pwd) then /usr/bin
+/usr/bin sed --verbose grep $(pwd) grep printf done /usr/bin printf ${HOME}
+$(pwd) then readonly && readonly /usr/bin done "$1" done
+		cd $(pwd) sed && echo then
+	done -eu then x=1 /usr/bin /usr/bin
+grep x=1 --verbose echo 2>/dev/null ${HOME} "$@" then printf && export
+	done then cd --verbose 'quoted text' done
+	echo then $(pwd) test /usr/bin && test local echo 2>/dev/null done -eu --verbose
+2>/dev/null printf /usr/bin ${HOME} cd
+		"$@" $(pwd) x=1 $(pwd) readonly awk 2>/dev/null test x=1 echo
+2>/dev/null grep printf "$1" x=1 grep
+		-eu local test 2>/dev/null readonly $(pwd) /usr/bin && grep echo cd --verbose
+	then "$1" export x=1 "$@" 2>/dev/null then then
+	readonly echo | sed $(pwd)
+		2>/dev/null $(pwd) ${HOME} printf export $(pwd)
+| x=1 x=1 awk --verbose export x=1 "$1" grep && --verbose
+	readonly -eu export "$1" awk printf
+	printf test cd /usr/bin -eu then 2>/dev/null
+sed ${HOME} ${HOME} cd local 2>/dev/null
+	--verbose -eu -eu then echo ${HOME} $(pwd) --verbose
+		&& echo ${HOME} $(pwd) ${HOME} /usr/bin "$1" test -eu | printf cd "$@"
+	grep "$@" done ${HOME}
+	-eu test "$1" sed x=1 ${HOME}
+2>/dev/null && awk done printf echo export done ${HOME}
+test echo test /usr/bin --verbose
+		then | /usr/bin /usr/bin readonly
+		awk "$1" sed "$@" grep printf
+		&& $(pwd) | then awk local && cd printf ${HOME} /usr/bin /usr/bin
+		local done sed then 2>/dev/null
+	test test "$@" grep done | done && then awk cd sed $(pwd) then | --verbose |
+		/usr/bin grep sed ${HOME} ${HOME} 2>/dev/null "$1" ${HOME}
+		test x=1 export awk -eu echo then test
+	&& export printf "$1" $(pwd) local test test 'quoted text' 2>/dev/null
+x=1 ${HOME} test grep test local ${HOME} "$@" -eu cd sed local export | $(pwd) /usr/bin
+		readonly "$@" done grep sed -eu $(pwd)
+| | "$@" && "$@" | done -eu grep "$1" local
+export | 'quoted text' grep printf grep
+		done -eu readonly export grep cd echo local 'quoted text' test then x=1 echo
+		awk 2>/dev/null $(pwd) awk test x=1 printf export --verbose test --verbose
+	"$1" | | 2>/dev/null "$@" "$1" --verbose
+	"$@" cd then 2>/dev/null grep 'quoted text'
+&& sed $(pwd) /usr/bin ${HOME} ${HOME} 'quoted text'
+export && && | | $(pwd)
+		"$@" 'quoted text' printf test
+	grep /usr/bin echo sed 2>/dev/null echo x=1
+		grep echo printf cd --verbose
+	export printf x=1 echo $(pwd) -eu local sed local "$1" -eu -eu grep | grep
+	grep echo -eu "$1" printf
+	'quoted text' x=1 test sed -eu && test then printf && -eu readonly /usr/bin
+	local then export export printf local cd 2>/dev/null
+	"$@" echo -eu x=1 /usr/bin then && export echo "$@" -eu then 2>/dev/null
+		"$1" /usr/bin -eu $(pwd) "$@" readonly x=1 /usr/bin
+printf printf echo done ${HOME} && sed -eu -eu 2>/dev/null x=1 'quoted text'
+	'quoted text' sed /usr/bin
+		"$1" local cd local "$1" test -eu ${HOME} x=1 x=1 readonly /usr/bin
+		"$@" $(pwd) grep echo 2>/dev/null
+"$@" 'quoted text' /usr/bin readonly awk then /usr/bin
+		/usr/bin done local 'quoted text' /usr/bin printf x=1 2>/dev/null
+2>/dev/null readonly ${HOME} 'quoted text' done awk grep cd echo test ${HOME} local
+		printf ${HOME} grep 2>/dev/null "$@"
+-eu | && "$@" 2>/dev/null awk "$@" && local /usr/bin grep printf local export
+awk echo then "$1" then x=1 /usr/bin | "$1" ${HOME} awk sed export $(pwd)
+	$(pwd) 2>/dev/null x=1 grep
+		cd then x=1 ${HOME} "$1"
+		'quoted text' 'quoted text' x=1 ${HOME} export x=1 /usr/bin export
+		export && --verbose readonly --verbose 'quoted text' cd printf done "$1"
+		"$1" $(pwd) test "$@" | done 'quoted text' printf x=1 -eu export | grep
+		--verbose test --verbose | | $(pwd) export ${HOME} "$@"
+	"$1" ${HOME} sed echo grep x=1 x=1 --verbose "$@"
+		awk --verbose --verbose "$1" sed local export $(pwd) x=1 && grep
+		test 'quoted text' readonly readonly done sed "$@" ${HOME} printf
+2>/dev/null "$@" -eu x=1 local awk awk ${HOME} awk sed 'quoted text'
+		${HOME} "$1" /usr/bin done 2>/dev/null 'quoted text'
+${HOME} -eu 'quoted text' awk then x=1 2>/dev/null
+		export "$1" && "$1" export
+	'quoted text' then done export --verbose /usr/bin --verbose "$@"
+		cd "$1" cd printf export local 'quoted text' printf && sed test "$@" test
+$(pwd) cd $(pwd) | -eu printf --verbose --verbose 2>/dev/null /usr/bin sed
+printf then "$1" readonly awk grep --verbose readonly $(pwd) "$@" cd "$1"
+	printf cd ${HOME} ${HOME} "$1" &&
+x=1 $(pwd) export done then ${HOME} done then $(pwd)
+		| 'quoted text' "$1" $(pwd) readonly "$1" export done local
+	sed awk cd 2>/dev/null done done then 'quoted text' 2>/dev/null awk export |
+		${HOME} ${HOME} $(pwd) done export ${HOME} grep export done
+	readonly done test grep $(pwd) printf sed /usr/bin
+		local 'quoted text' sed echo -eu | "$@" local --verbose 'quoted text'
+&& cd $(pwd) test --verbose | export -eu
+		--verbose x=1 local echo test "$1" $(pwd) printf export awk /usr/bin
+		printf then done /usr/bin ${HOME}
+readonly x=1 readonly cd --verbose
+		echo readonly "$1" && 2>/dev/null 'quoted text' --verbose 2>/dev/null
+	done /usr/bin "$1" local && local readonly -eu | | then "$@"
+		cd --verbose then | printf $(pwd) export && readonly $(pwd)
+	grep | then ${HOME} x=1 "$@" readonly
+${HOME} local 2>/dev/null echo -eu local 2>/dev/null printf /usr/bin /usr/bin
+		printf cd "$@" done local echo export echo sed done $(pwd) $(pwd) $(pwd)
+		&& 'quoted text' done done sed sed "$@" echo ${HOME} sed cd test 2>/dev/null
+test test x=1 2>/dev/null readonly cd awk
+	${HOME} $(pwd) export cd printf then echo local "$@"
+	grep awk $(pwd) && printf cd && "$1" then export test -eu /usr/bin done cd &&
+--verbose && 2>/dev/null awk readonly | "$@" "$@" done
+		cd cd ${HOME} 'quoted text' echo
+	| $(pwd) then local export then export printf export sed grep
+		&& test -eu 'quoted text' x=1 "$@" | "$1" $(pwd)
+		printf $(pwd) ${HOME} ${HOME} x=1 grep
+	$(pwd) "$@" echo printf echo "$@" test "$@" "$1" 'quoted text'
+	x=1 readonly ${HOME} printf && --verbose grep echo x=1 grep |
+		printf local test && 'quoted text' 'quoted text' cd 'quoted text' readonly
+sed --verbose test && then done echo done echo export "$@"
+		${HOME} printf && /usr/bin grep x=1
+	then ${HOME} ${HOME} && cd readonly
+awk printf awk then -eu
+	done done -eu /usr/bin -eu | && cd &&
+/usr/bin --verbose readonly local readonly -eu $(pwd) --verbose export printf
+	/usr/bin $(pwd) ${HOME} "$1" readonly local local echo grep --verbose
+sed --verbose "$@" | ${HOME} then test "$@"
+	"$@" done $(pwd) printf printf echo && ${HOME} "$@" "$@"
+--verbose ${HOME} grep "$1" done x=1 x=1 done 'quoted text'
+	local readonly cd printf
+$(pwd) local "$1" grep | printf 'quoted text' done grep awk export
+"$1" then "$@" readonly cd test cd | printf export && "$1" echo test readonly
+	'quoted text' 2>/dev/null -eu printf -eu && ${HOME} echo /usr/bin done
+"$@" sed local 2>/dev/null export readonly done then "$@"
+	echo -eu ${HOME} echo then
+		printf awk "$1" "$1" 2>/dev/null sed test readonly "$@" $(pwd) local 2>/dev/null
+'quoted text' $(pwd) /usr/bin 2>/dev/null /usr/bin
+		awk echo --verbose ${HOME} | x=1 --verbose printf export readonly 2>/dev/null
+	done printf echo | grep readonly
+		${HOME} export "$1" awk --verbose 2>/dev/null grep export x=1 export cd 'quoted text'
+&& /usr/bin cd test sed 'quoted text'
+	"$@" test 2>/dev/null 2>/dev/null echo "$@"
+		--verbose grep ${HOME} readonly then && | x=1
+	test "$@" ${HOME} && echo export
+	/usr/bin local "$1" ${HOME} ${HOME} export done
+	x=1 readonly echo local printf
+		/usr/bin --verbose grep $(pwd) $(pwd) local grep
+	echo cd awk $(pwd) 2>/dev/null local 2>/dev/null grep
+		"$1" echo | then "$@"
+grep grep cd cd /usr/bin
+		x=1 x=1 x=1 test test "$1" x=1 then export printf --verbose
+		echo && then readonly -eu
+test sed --verbose test $(pwd) 'quoted text'
+		2>/dev/null awk grep cd cd cd x=1 /usr/bin 'quoted text' then then
+		"$1" && readonly 'quoted text' readonly
+	awk printf export && done local /usr/bin readonly echo awk
+	2>/dev/null awk grep sed cd test then $(pwd) printf
+		--verbose 'quoted text' echo $(pwd) local 'quoted text' export ${HOME}
+awk sed --verbose "$1" printf export -eu "$@" | $(pwd) -eu -eu cd export
+		${HOME} 'quoted text' then grep
+	echo -eu "$1" then grep "$1"
+readonly | ${HOME} awk printf $(pwd)
+	$(pwd) done $(pwd) "$1" echo | grep test 2>/dev/null $(pwd)
+		awk done done grep then test --verbose "$@"
+x=1 done "$@" --verbose
+x=1 grep 2>/dev/null x=1 cd
+	echo "$@" grep export && test 2>/dev/null 2>/dev/null test
+sed && /usr/bin then 2>/dev/null 2>/dev/null cd echo awk printf echo 'quoted text'
+	--verbose sed sed /usr/bin done awk grep /usr/bin "$1" x=1 ${HOME}
+cd grep | "$@" ${HOME} echo --verbose 2>/dev/null
+| ${HOME} printf /usr/bin grep
+		then readonly awk done cd -eu done 'quoted text'
+	| | export "$@" "$@" printf | ${HOME}
+/usr/bin local && x=1 done echo ${HOME} sed 2>/dev/null cd grep
+	'quoted text' echo export --verbose echo echo sed "$@" && | readonly
+x=1 'quoted text' export test /usr/bin test && then 'quoted text'
+	done /usr/bin | && 'quoted text'
+	-eu | then 2>/dev/null then
+		'quoted text' ${HOME} printf printf "$1" cd readonly "$1" | echo readonly sed 'quoted text'
+		-eu ${HOME} done test "$1" printf
+		--verbose $(pwd) grep sed /usr/bin printf
+2>/dev/null "$@" /usr/bin awk then /usr/bin --verbose test test printf readonly
+		cd readonly echo then ${HOME} test 2>/dev/null
+	done then cd 'quoted text' local "$1" && x=1
+	done --verbose -eu "$@" then printf
+		printf ${HOME} $(pwd) 2>/dev/null && test ${HOME} "$@" printf
+		echo /usr/bin awk grep "$1" readonly local 'quoted text' grep export 'quoted text'
+| | x=1 x=1 export 'quoted text'
+		printf x=1 x=1 done export then 2>/dev/null then 'quoted text' 'quoted text' grep
+-eu && sed | readonly readonly x=1 --verbose 'quoted text' then
+$(pwd) grep ${HOME} && "$@" test /usr/bin -eu /usr/bin
+-eu /usr/bin readonly grep && --verbose export
+		-eu then /usr/bin $(pwd) grep test "$@" grep -eu && printf /usr/bin export
+		cd "$1" done -eu /usr/bin | $(pwd) $(pwd) ${HOME} -eu "$@"
+		echo -eu "$1" x=1 sed sed 'quoted text'
+		then x=1 printf test printf && printf /usr/bin done sed
+		&& 2>/dev/null 'quoted text' -eu ${HOME} $(pwd) --verbose
+	$(pwd) cd x=1 sed test --verbose sed "$@" readonly awk local test sed
+	| readonly local && "$@" | export
+done | "$1" awk && 'quoted text'
+	'quoted text' "$@" ${HOME} test cd -eu x=1 export "$@" then
+export echo printf 'quoted text' done "$1"
+test --verbose "$@" printf export readonly grep grep /usr/bin 2>/dev/null
+		echo 'quoted text' -eu | grep test x=1 "$@" then awk -eu echo ${HOME} printf
+	$(pwd) && x=1 --verbose /usr/bin
+		&& export grep echo --verbose printf
+	"$1" ${HOME} awk sed 2>/dev/null echo readonly export
+		$(pwd) then then x=1 | done
+test | /usr/bin sed $(pwd) echo "$1" sed "$@"
+		printf sed ${HOME} --verbose 'quoted text' -eu
+cd 2>/dev/null done then export grep
+	then | sed && printf ${HOME} -eu
+then echo 2>/dev/null $(pwd) sed /usr/bin /usr/bin $(pwd) "$1" export awk
+cd "$1" --verbose 2>/dev/null -eu awk grep "$1"
+		awk sed local then grep $(pwd) done "$@" export 2>/dev/null
+	--verbose echo | | done echo awk
+	sed printf cd 2>/dev/null printf grep x=1 "$@" readonly x=1 "$@" /usr/bin done grep
+export echo x=1 echo | export then 'quoted text'
+	test echo printf 'quoted text'
+	awk grep grep export $(pwd)
+		&& readonly -eu "$1" readonly readonly awk test test
+		--verbose done && 2>/dev/null done --verbose "$@" then ${HOME} "$1" cd $(pwd)
+	"$1" grep readonly then "$@" -eu cd sed "$@" cd --verbose | x=1 then "$@"
+		"$@" "$1" /usr/bin cd local awk ${HOME} -eu /usr/bin | ${HOME}
+	2>/dev/null --verbose printf cd 2>/dev/null "$1" echo then 2>/dev/null
+		-eu then "$@" local && "$1" cd
+	readonly awk ${HOME} "$1" 2>/dev/null export ${HOME} "$1"
+sed awk echo done export -eu local
+	-eu test test 'quoted text' /usr/bin $(pwd)
+	--verbose grep sed awk "$@" | echo $(pwd) sed sed readonly 'quoted text'
+		printf test export "$@" /usr/bin grep | 2>/dev/null done sed "$1"
+grep then $(pwd) done done
+	$(pwd) $(pwd) "$@" "$1"
+-eu $(pwd) /usr/bin $(pwd) test test "$@"
+done --verbose readonly echo local "$1" -eu -eu $(pwd) 2>/dev/null
+	printf 'quoted text' "$@" done export --verbose readonly ${HOME} $(pwd)
+		printf x=1 readonly test export echo /usr/bin local
+	printf /usr/bin grep 'quoted text'
+	&& && cd local grep && --verbose then ${HOME} local 2>/dev/null
+		"$@" /usr/bin --verbose cd | awk readonly | 'quoted text'
+	readonly then sed ${HOME} printf --verbose ${HOME}
+	"$@" test 'quoted text' "$@" local cd "$@" sed done "$1"
+2>/dev/null && "$@" --verbose done export
+		export local readonly awk readonly && | --verbose cd readonly
+		"$1" sed $(pwd) 2>/dev/null echo grep readonly echo export
+		&& 'quoted text' $(pwd) test | -eu 'quoted text' test test "$@" then /usr/bin
+	'quoted text' export 'quoted text' awk export ${HOME}
+	readonly printf && && readonly test $(pwd)
+	then | 2>/dev/null local ${HOME} test x=1 cd "$1" readonly ${HOME}
+sed echo ${HOME} 2>/dev/null
+	${HOME} /usr/bin printf ${HOME} 'quoted text'
+		cd then readonly local --verbose --verbose printf
+		export 'quoted text' 'quoted text' /usr/bin && grep /usr/bin then
+		sed grep "$@" $(pwd) | sed test "$@" 2>/dev/null cd /usr/bin printf export
+done --verbose echo 'quoted text' awk export | echo
+		local /usr/bin cd -eu then printf cd done "$@"
+	grep grep 2>/dev/null grep export 'quoted text' "$1" 'quoted text' test readonly
+	&& readonly local 2>/dev/null grep "$1" --verbose readonly sed cd "$1" "$@" cd
+x=1 cd sed awk "$@" && then cd --verbose -eu cd
+&& printf export | grep --verbose cd ${HOME} x=1 test sed grep sed cd
+		done $(pwd) test -eu then cd cd grep printf | printf
+"$1" 2>/dev/null sed "$@" sed $(pwd)
+	local echo awk --verbose test sed x=1 local
+	local grep sed grep 2>/dev/null |
+	awk "$@" then grep 'quoted text' /usr/bin
+		cd test echo local export sed && local --verbose grep printf 'quoted text'
+| "$1" 'quoted text' /usr/bin -eu cd test 2>/dev/null /usr/bin
+"$1" sed /usr/bin readonly | readonly "$@" "$1"
+$(pwd) 'quoted text' test && local /usr/bin echo printf printf
+		/usr/bin test && && test local export $(pwd) sed 2>/dev/null grep
+	| x=1 $(pwd) | /usr/bin 2>/dev/null grep "$1"
+		"$1" printf --verbose 2>/dev/null done 'quoted text' grep "$1"
+test ${HOME} /usr/bin echo "$@" test "$1" "$@" local -eu then --verbose
+	done $(pwd) /usr/bin "$1" x=1 echo -eu /usr/bin local x=1 sed && grep
+then cd then /usr/bin --verbose local done
+"$1" -eu cd awk --verbose /usr/bin done grep printf
+	echo "$1" --verbose local | 2>/dev/null
+	awk sed 'quoted text' -eu | | -eu /usr/bin sed done x=1 done readonly
+		printf /usr/bin && /usr/bin echo 2>/dev/null
+${HOME} 2>/dev/null /usr/bin grep | echo "$1" &&
+test ${HOME} readonly --verbose sed awk export 'quoted text' printf
+		| local && local printf 'quoted text'
+	cd awk sed -eu "$1" local then ${HOME} export awk --verbose done awk -eu
+		"$1" -eu x=1 done then local readonly awk awk export
+	--verbose cd grep "$@" /usr/bin cd sed 'quoted text' -eu "$@" /usr/bin --verbose
+		&& grep then awk | local awk x=1 2>/dev/null
+	awk export $(pwd) printf | ${HOME} cd grep x=1 echo test 'quoted text' cd
+		"$@" 'quoted text' then printf sed then -eu x=1 ${HOME}
+readonly readonly printf $(pwd) test 'quoted text' local then | --verbose --verbose
+		printf --verbose cd "$@" sed 'quoted text' | "$1"
+then $(pwd) -eu /usr/bin -eu ${HOME} done local /usr/bin
+export "$1" grep ${HOME} -eu grep
+		test done ${HOME} 2>/dev/null done local --verbose sed ${HOME} test awk
+		cd | ${HOME} 2>/dev/null "$1" ${HOME} echo printf grep /usr/bin "$1"
+	done "$1" $(pwd) && 'quoted text'
+echo x=1 readonly "$@"
+		$(pwd) 'quoted text' export export
+		printf printf "$1" awk echo ${HOME} x=1 export readonly | awk --verbose printf
+test test $(pwd) "$@" -eu -eu test ${HOME} -eu awk grep
+		grep && | x=1 awk grep export
+	| then ${HOME} then $(pwd) sed export 'quoted text'
+	export x=1 x=1 2>/dev/null x=1 sed ${HOME} "$@" "$@" export /usr/bin done
+x=1 && 'quoted text' grep --verbose -eu grep readonly
+	-eu cd printf echo local && echo --verbose
+		'quoted text' /usr/bin "$@" 'quoted text' export awk test /usr/bin
+echo sed grep 'quoted text' x=1 sed "$1" -eu printf 2>/dev/null echo &&
+		-eu test $(pwd) grep
+| grep awk --verbose printf echo done
+/usr/bin "$1" local 'quoted text' $(pwd)
+2>/dev/null ${HOME} 2>/dev/null done echo printf -eu |
+done --verbose done export /usr/bin echo
+	then "$@" && test -eu grep then awk cd local
+		${HOME} x=1 "$1" cd x=1 done export then awk grep "$1" awk -eu x=1
+&& printf grep -eu then -eu 2>/dev/null $(pwd) x=1 awk -eu ${HOME}
+${HOME} export test 2>/dev/null done then "$@" sed "$1" cd -eu --verbose echo $(pwd)
+		test local readonly export test && echo awk $(pwd) then printf
+	local "$@" x=1 awk 'quoted text' "$1" --verbose "$1"
+	x=1 x=1 x=1 | export x=1 /usr/bin /usr/bin then then done grep && -eu export
+readonly test ${HOME} export awk -eu
+	sed -eu awk $(pwd) export /usr/bin $(pwd) --verbose
+--verbose ${HOME} --verbose -eu echo
+| && /usr/bin readonly cd
+printf printf grep printf x=1 'quoted text'
+		echo -eu $(pwd) local /usr/bin | awk grep $(pwd) --verbose sed
+	cd done cd | && --verbose then done
+printf done awk 'quoted text' x=1 | && | then $(pwd) echo done 'quoted text'
+		"$1" x=1 echo echo printf --verbose then
+	awk printf local readonly 'quoted text' printf then cd ${HOME} "$1" then
+/usr/bin printf $(pwd) grep cd grep cd test export
+		--verbose local test -eu sed local ${HOME} x=1 export local 2>/dev/null
+		2>/dev/null x=1 grep x=1 "$1" --verbose then export x=1 "$1"
+		readonly sed done export && "$@"
+	'quoted text' "$1" "$1" local awk then local &&
+x=1 "$1" export cd grep && $(pwd) --verbose $(pwd) ${HOME} grep "$1" printf
+	export ${HOME} "$@" readonly 2>/dev/null
+		grep then cd local "$1" export 'quoted text' "$1" export
+then -eu && "$@" then readonly x=1 'quoted text' cd /usr/bin then readonly
+${HOME} -eu export --verbose local
+	$(pwd) done /usr/bin test grep grep cd readonly | && cd
+	"$@" 2>/dev/null printf -eu test && readonly ${HOME} "$1" ${HOME}
+		| readonly test readonly sed /usr/bin "$@" grep export sed | local sed sed export
+awk test grep then && printf test | grep $(pwd) $(pwd) /usr/bin
+		grep "$1" sed printf awk sed "$@" /usr/bin ${HOME} "$1" ${HOME} |
+	"$@" $(pwd) local then ${HOME} export /usr/bin
+		"$1" && printf awk 'quoted text' x=1 local
+-eu readonly cd --verbose readonly done | ${HOME} done 'quoted text' --verbose
+		x=1 "$1" "$@" --verbose /usr/bin awk readonly
+		printf sed --verbose local then | local ${HOME} sed -eu then local
+then export test echo -eu |
+${HOME} then "$@" echo test x=1 $(pwd) ${HOME} -eu
+then "$1" cd x=1 sed ${HOME}
+	x=1 export sed -eu /usr/bin then echo
+		readonly cd 'quoted text' done "$@" x=1 'quoted text' x=1 'quoted text'
+printf 'quoted text' sed
+${HOME} readonly export then /usr/bin
+	--verbose /usr/bin $(pwd) done $(pwd) echo echo then export export && local then
+grep -eu x=1 echo --verbose
+	$(pwd) $(pwd) "$@" | "$1" -eu test x=1 test sed -eu 'quoted text'
+		then $(pwd) grep echo $(pwd) echo
+		export x=1 /usr/bin grep $(pwd) readonly ${HOME} --verbose local "$@" --verbose
+'quoted text' --verbose --verbose
+printf ${HOME} sed 'quoted text' printf | -eu -eu $(pwd) x=1
+	export -eu -eu "$@" export
+		x=1 local export grep 2>/dev/null "$1" -eu
+-eu && then "$1" export ${HOME} grep readonly
+		echo cd sed -eu --verbose "$@" $(pwd)
+		grep test -eu echo cd done then x=1 "$1" ${HOME}
+&& $(pwd) 2>/dev/null export echo export 2>/dev/null
+echo x=1 awk awk "$@" && | "$1" 2>/dev/null x=1 test local then
+	test /usr/bin echo cd test sed "$@" $(pwd) ${HOME} 'quoted text'
+	"$1" echo $(pwd) "$1" ${HOME} echo
+	export test local printf then awk done awk sed awk local test
+	test readonly && $(pwd) x=1 echo
+	export ${HOME} --verbose export -eu "$1" | export cd $(pwd) -eu local x=1
+| readonly local x=1 x=1 export -eu --verbose ${HOME}
+test test readonly "$@" echo echo | --verbose grep -eu && done
+		sed 2>/dev/null ${HOME} readonly cd "$1" printf export /usr/bin
+	awk /usr/bin | && awk awk
+		"$@" && local /usr/bin test | 2>/dev/null x=1 x=1 "$1"
+	grep test | /usr/bin echo --verbose x=1 --verbose export cd | "$@" 2>/dev/null
+		grep test readonly then ${HOME} test awk --verbose printf done readonly
+	| ${HOME} export $(pwd) 2>/dev/null
+test echo done printf --verbose test sed printf done cd
+	x=1 sed 2>/dev/null | 2>/dev/null "$@" local grep $(pwd) "$1" cd
+grep 2>/dev/null export cd "$@" "$1"
+	x=1 x=1 done printf awk printf "$1" awk /usr/bin
+	printf x=1 printf --verbose
+	grep -eu cd 'quoted text' readonly x=1 awk --verbose echo grep $(pwd) then
+-eu printf /usr/bin /usr/bin x=1 then $(pwd) -eu printf
+then "$1" -eu sed /usr/bin && then "$1" awk && | sed awk sed &&
+	export x=1 grep sed ${HOME} x=1 && grep x=1 sed $(pwd) 2>/dev/null
+/usr/bin sed x=1 cd 2>/dev/null printf
+	awk x=1 readonly export ${HOME} "$1"
+		'quoted text' "$@" cd $(pwd) sed "$1" then awk awk readonly --verbose grep
+&& -eu export 'quoted text' $(pwd) local local done
+		&& echo && x=1 ${HOME} local
+		"$1" local export | "$@" "$1" readonly echo export
+2>/dev/null cd ${HOME} /usr/bin && readonly
+	"$1" readonly cd 2>/dev/null
+		"$@" 2>/dev/null local --verbose sed done
+		'quoted text' done x=1 -eu test 2>/dev/null $(pwd) local then done &&
+	'quoted text' echo "$@" "$@" grep x=1 && && local readonly export sed "$@" awk
+	grep --verbose export then
+	local -eu ${HOME} 2>/dev/null cd -eu readonly
+		test printf sed echo 2>/dev/null ${HOME} grep | export sed
+/usr/bin 'quoted text' "$@" grep "$1" 2>/dev/null
+		grep then "$1" ${HOME}
+	2>/dev/null awk | grep sed printf printf 'quoted text'
+then | cd awk readonly printf /usr/bin readonly
+"$1" ${HOME} grep 2>/dev/null grep "$@" printf grep && 'quoted text'
+printf cd 2>/dev/null $(pwd) cd "$@" -eu "$1"
+echo sed | "$1" awk x=1
+	&& $(pwd) cd x=1 echo then awk awk printf export echo sed /usr/bin
+readonly && done 2>/dev/null | readonly sed 2>/dev/null
+x=1 echo x=1 test $(pwd) $(pwd) -eu -eu readonly
+	readonly && 'quoted text' test x=1 local echo
+		test then 'quoted text' test done readonly ${HOME} then
+		grep readonly "$1" local then then local "$@" local /usr/bin x=1 readonly "$@" ${HOME}
+		local $(pwd) ${HOME} 2>/dev/null 'quoted text' local grep grep 2>/dev/null awk
+		${HOME} ${HOME} x=1 then $(pwd) /usr/bin $(pwd) 2>/dev/null
+	readonly local done /usr/bin
+cd awk "$1" 'quoted text' cd --verbose local && 2>/dev/null printf sed awk
+		--verbose --verbose $(pwd) awk sed /usr/bin printf local sed printf printf
+		cd 'quoted text' 2>/dev/null readonly printf $(pwd) test awk && cd 2>/dev/null
+		| 2>/dev/null export grep ${HOME} then 2>/dev/null -eu local "$@" readonly
+&& printf "$1" 2>/dev/null -eu 2>/dev/null
+	| && && $(pwd) cd && printf | export $(pwd) awk local "$1" export
+printf $(pwd) -eu export cd -eu test cd | 'quoted text' echo printf cd
+$(pwd) $(pwd) /usr/bin echo x=1 export "$@" 2>/dev/null printf
+&& 'quoted text' grep "$@" 2>/dev/null
+	export awk x=1 --verbose local
+x=1 grep cd && 'quoted text' sed ${HOME} ${HOME} 2>/dev/null export readonly local
+	printf printf grep 'quoted text' grep /usr/bin then "$@" local
+echo echo printf readonly /usr/bin ${HOME} grep
+'quoted text' 'quoted text' awk $(pwd) 2>/dev/null "$1" test
+x=1 --verbose --verbose /usr/bin ${HOME} export export printf x=1 printf -eu
+		--verbose printf /usr/bin test sed && export 2>/dev/null
+		2>/dev/null "$1" ${HOME} readonly $(pwd) /usr/bin "$1" cd test /usr/bin
+	export cd export cd then $(pwd) "$@" awk local $(pwd) | | 2>/dev/null "$@" echo
+	grep sed readonly "$@" | /usr/bin x=1 export 2>/dev/null echo readonly local
+"$1" printf 2>/dev/null then x=1 $(pwd) then readonly -eu --verbose awk
+local printf awk "$@" | --verbose --verbose
+		"$1" printf cd 'quoted text' $(pwd) test "$1" awk cd local | grep readonly
+done $(pwd) grep "$@" readonly ${HOME} sed echo grep ${HOME} --verbose ${HOME} "$1"
+		echo grep -eu grep | "$@" cd local local awk awk 'quoted text'
+&& local | /usr/bin test "$@" --verbose "$1" --verbose
+		x=1 "$@" x=1 "$@" x=1 'quoted text' | then -eu 'quoted text'
+#include c235.sh
+	echo && x=1 then -eu | "$1" /usr/bin printf grep 'quoted text'
+2>/dev/null -eu cd local awk cd -eu "$1" --verbose "$@" done 'quoted text'
+$(pwd) x=1 ${HOME} -eu "$1" grep awk
+	cd local export 2>/dev/null "$@" test local $(pwd) --verbose ${HOME} then
+	&& | echo sed then local awk readonly ${HOME} export
+	sed --verbose && ${HOME} awk | $(pwd) grep test x=1 /usr/bin
+'quoted text' sed printf echo export
+		sed -eu then 2>/dev/null | "$1" -eu export
+		2>/dev/null local "$@" echo | sed && ${HOME}
+		x=1 sed test "$@" cd ${HOME} done readonly x=1 grep
+		| -eu export sed local x=1 then readonly
+		"$@" $(pwd) $(pwd) ${HOME} | readonly test echo local --verbose
+/usr/bin awk "$@" awk /usr/bin && 'quoted text' 'quoted text' $(pwd)
+"$1" done then 2>/dev/null x=1 export printf /usr/bin then then 2>/dev/null
+		${HOME} 'quoted text' ${HOME}
+	${HOME} sed --verbose "$1" "$@" -eu readonly
+'quoted text' local export ${HOME} -eu
+	/usr/bin sed $(pwd) x=1 "$1" done readonly 2>/dev/null | test 2>/dev/null
+		--verbose readonly cd ${HOME} 'quoted text' awk $(pwd) ${HOME} "$1" 2>/dev/null
+	"$@" /usr/bin readonly && readonly readonly ${HOME} 2>/dev/null 'quoted text'
+	printf && printf 2>/dev/null grep awk local then awk test then "$@" sed grep x=1
+		&& x=1 2>/dev/null /usr/bin $(pwd) readonly
+awk -eu test test $(pwd) printf local done readonly readonly -eu -eu | --verbose
+--verbose $(pwd) readonly
+"$@" 2>/dev/null readonly ${HOME} echo done | then x=1 | x=1 export grep done
+		grep cd --verbose 'quoted text'
+	awk test ${HOME} 2>/dev/null | "$1" echo test ${HOME} 'quoted text'
+		&& x=1 export grep | &&
+		| grep "$@" local cd 2>/dev/null local -eu local
+		/usr/bin --verbose && 2>/dev/null x=1 /usr/bin 2>/dev/null --verbose
+"$@" 'quoted text' awk then "$1" ${HOME}
+readonly sed ${HOME} && /usr/bin cd x=1 cd -eu $(pwd) ${HOME} "$@" awk
+	2>/dev/null 2>/dev/null 'quoted text' then export /usr/bin then "$1" && | cd export
+	x=1 export readonly export "$1" | && grep -eu grep
+		--verbose cd readonly echo cd export "$@" /usr/bin cd "$@" awk "$@" cd
+		echo /usr/bin test sed x=1 | ${HOME}
+	echo x=1 export ${HOME} readonly $(pwd) sed sed ${HOME} /usr/bin export
+done sed 'quoted text' printf then
+local cd then "$1" "$1" export -eu "$1" printf | echo readonly "$@" 'quoted text'
+	printf /usr/bin 2>/dev/null 2>/dev/null 'quoted text'
+	export x=1 echo $(pwd) 'quoted text'
+cd "$1" export 2>/dev/null cd grep
+'quoted text' test then 'quoted text' local && ${HOME} printf
+export x=1 2>/dev/null "$@" $(pwd)
+	/usr/bin --verbose 'quoted text' $(pwd) "$@" sed && /usr/bin
+	-eu echo cd test 2>/dev/null | then -eu cd 'quoted text'
+local 2>/dev/null readonly 'quoted text' echo cd 'quoted text'
+	then /usr/bin echo -eu done sed | printf x=1 grep
+	--verbose printf cd && && sed export printf | 2>/dev/null echo done | -eu local
+		then then local -eu 'quoted text' && | $(pwd) then --verbose x=1 sed then
+	readonly test -eu /usr/bin x=1 sed $(pwd) 2>/dev/null | 'quoted text'
+test && sed cd cd export --verbose
+		"$@" awk | grep cd printf -eu ${HOME} done awk /usr/bin ${HOME}
+2>/dev/null --verbose readonly local
+"$@" /usr/bin grep x=1 ${HOME} cd
+| cd export $(pwd) | echo $(pwd) --verbose echo "$@"
+	printf /usr/bin readonly printf then $(pwd)
+		"$1" ${HOME} $(pwd) --verbose
+local local "$1" "$@" --verbose x=1 -eu 2>/dev/null
+echo done ${HOME} grep "$1" "$1" ${HOME} && -eu ${HOME} grep x=1 export
+	"$@" -eu ${HOME} done readonly /usr/bin
+	"$1" -eu -eu test | --verbose 'quoted text' grep readonly --verbose "$@" local
+	x=1 cd ${HOME} --verbose
+		"$1" --verbose 2>/dev/null then readonly sed readonly awk
+'quoted text' && awk readonly 'quoted text' |
+${HOME} done | done "$@" ${HOME} "$@" local
+		echo awk /usr/bin local export
+	local /usr/bin --verbose
+export echo x=1 echo && cd done ${HOME} sed sed echo then grep
+readonly then cd readonly | printf 'quoted text' --verbose
+cd test x=1 test cd x=1 'quoted text' x=1 done && local /usr/bin
+	-eu cd && cd cd sed x=1 readonly cd "$@" cd awk sed | grep test export $(pwd) export
+	/usr/bin $(pwd) readonly test readonly printf
+	2>/dev/null export awk 'quoted text' cd "$1" x=1 2>/dev/null then grep readonly
+grep done x=1 'quoted text' $(pwd)
+--verbose sed readonly then grep /usr/bin /usr/bin -eu $(pwd) $(pwd) && echo
+"$@" 'quoted text' local test "$1" done 'quoted text' x=1 printf | "$@"
+		then -eu ${HOME} /usr/bin 'quoted text' /usr/bin local echo echo
+	$(pwd) readonly $(pwd) printf $(pwd) awk readonly readonly sed &&
+		echo sed cd local x=1 done 2>/dev/null
+	"$1" "$1" --verbose "$1" readonly
+"$1" printf test cd ${HOME} sed "$1" sed echo echo $(pwd) /usr/bin local "$1"
+		&& $(pwd) 2>/dev/null -eu ${HOME}
+	${HOME} $(pwd) echo -eu x=1 echo awk && ${HOME} cd x=1 echo
+	--verbose sed echo /usr/bin export cd /usr/bin | 'quoted text' printf echo
+		| x=1 x=1 -eu readonly sed "$1" /usr/bin "$1" ${HOME} --verbose readonly | 'quoted text'
+sed printf x=1 sed /usr/bin /usr/bin && test -eu test
+	${HOME} sed cd --verbose printf $(pwd) awk test
+then "$@" 2>/dev/null local
+		"$@" echo done 'quoted text' | readonly readonly
+cd 'quoted text' | x=1 test grep cd 2>/dev/null echo
+	'quoted text' && $(pwd) done test $(pwd) printf grep local
+| grep cd printf done -eu printf test && readonly then test --verbose
+	printf echo 2>/dev/null /usr/bin && done
+2>/dev/null -eu sed then export
+	| then --verbose && | --verbose /usr/bin | /usr/bin export cd /usr/bin
+test --verbose printf printf /usr/bin local && awk export cd awk
+x=1 x=1 cd -eu $(pwd) -eu "$1" | cd
+		'quoted text' done -eu /usr/bin 2>/dev/null 'quoted text' /usr/bin
+		| 2>/dev/null -eu cd then &&
+sed && cd grep -eu | "$1" x=1 local 2>/dev/null && $(pwd)
+local "$@" 'quoted text' awk grep readonly --verbose printf printf --verbose
+		"$@" | test "$@" cd "$@" local "$1" done awk
+test ${HOME} local echo x=1 /usr/bin local --verbose export awk --verbose
+	&& && ${HOME} cd printf 2>/dev/null
+		-eu cd awk printf && done x=1 sed && -eu
+	sed then local sed --verbose readonly ${HOME} readonly && local && 'quoted text'
+	--verbose | --verbose | --verbose grep done echo | /usr/bin
+		${HOME} grep /usr/bin cd test && local $(pwd) ${HOME} ${HOME}
+grep grep 2>/dev/null test | readonly /usr/bin grep cd then --verbose
+		then | "$@" done local 2>/dev/null -eu test /usr/bin /usr/bin readonly grep
+		| | then -eu local test 2>/dev/null
+	| sed then done cd printf && then "$@" "$1" local 2>/dev/null printf readonly
+		x=1 grep readonly test
+		"$@" $(pwd) x=1 /usr/bin
+		"$@" 2>/dev/null 2>/dev/null $(pwd) --verbose "$@" sed sed sed ${HOME}
+done ${HOME} test 2>/dev/null /usr/bin printf x=1
+	readonly then grep local ${HOME} x=1 sed cd sed &&
+	test echo && awk then printf done $(pwd)
+		"$@" awk "$1" 2>/dev/null printf 2>/dev/null readonly
+	cd "$@" -eu -eu done local ${HOME} printf sed $(pwd) --verbose
+	grep grep | export then ${HOME}
+	-eu "$@" "$1" ${HOME} awk ${HOME} test cd cd x=1 awk test -eu
+-eu ${HOME} awk 2>/dev/null ${HOME} && 2>/dev/null /usr/bin then $(pwd)
+		echo 'quoted text' --verbose readonly x=1 cd sed -eu /usr/bin
+	'quoted text' echo "$@" then sed 'quoted text'
+"$@" export -eu --verbose then "$@" $(pwd)
+		| 2>/dev/null 'quoted text'
+	export test done grep --verbose
+	/usr/bin x=1 sed printf /usr/bin -eu cd
+		test echo && -eu | --verbose cd "$@" cd | export 2>/dev/null -eu local | echo /usr/bin
+$(pwd) echo 2>/dev/null awk printf echo --verbose printf echo x=1
+	echo -eu 'quoted text' then test ${HOME} local -eu
+		export | readonly -eu
+/usr/bin then -eu sed --verbose | done ${HOME} /usr/bin 2>/dev/null
+		"$@" x=1 'quoted text' test -eu local
+	2>/dev/null test printf && "$1" /usr/bin printf "$@" 'quoted text' local awk
+		| local && ${HOME} /usr/bin echo
+then printf && 2>/dev/null then printf local export sed readonly 'quoted text'
+		echo | 2>/dev/null "$@" ${HOME} | sed
+	then ${HOME} -eu x=1 grep test -eu /usr/bin -eu | export cd /usr/bin
+	"$1" 'quoted text' echo "$@" grep /usr/bin
+		-eu test echo echo test ${HOME} 'quoted text'
+		awk echo | then test | awk printf -eu export | $(pwd) /usr/bin
+| printf | printf done -eu awk --verbose $(pwd) &&
+	test 2>/dev/null $(pwd) export "$@" test
+done grep x=1 local cd done && done then awk "$1" "$@" done 'quoted text'
+	&& && awk x=1 local export
+local then cd cd sed grep 2>/dev/null $(pwd)
+	local test --verbose && x=1 /usr/bin /usr/bin
+		awk local 2>/dev/null /usr/bin sed export cd ${HOME} sed then
+-eu 'quoted text' cd export x=1 /usr/bin "$@" grep
+	&& local | then sed grep ${HOME} --verbose sed awk export echo done $(pwd) sed
+		&& export "$@" echo test grep "$1" "$@" export
+		/usr/bin local "$1" then
+		export awk | export "$@" "$1" awk export
+	/usr/bin printf --verbose sed "$1" 'quoted text' awk export done
+		/usr/bin awk readonly cd 2>/dev/null echo ${HOME}
+		printf "$1" -eu awk awk $(pwd) /usr/bin readonly --verbose
+	echo cd grep cd "$1" readonly readonly
+		$(pwd) local test -eu $(pwd)
+	/usr/bin test 2>/dev/null x=1 grep 'quoted text'
+cd readonly 2>/dev/null /usr/bin test -eu
+		export | $(pwd) -eu sed sed echo echo x=1 -eu /usr/bin cd cd readonly cd export
+		local awk cd /usr/bin --verbose export local cd -eu grep local grep -eu
+	x=1 /usr/bin grep && cd | -eu $(pwd) readonly echo /usr/bin
+		$(pwd) cd ${HOME} "$1" sed grep 2>/dev/null && test cd ${HOME} x=1 export
+	local readonly $(pwd) echo readonly "$1" printf "$@" cd sed 'quoted text'
+		done && --verbose local
+		$(pwd) then local cd 2>/dev/null export && readonly
+	grep grep && export cd ${HOME} ${HOME} && awk readonly
+local x=1 grep grep /usr/bin local && done export --verbose x=1 -eu x=1
+	/usr/bin echo | echo | export printf
+		done then test export 'quoted text' 2>/dev/null grep --verbose "$@" $(pwd) cd
+	&& --verbose test "$1"
+		${HOME} local local "$1" 'quoted text' local --verbose sed export "$@" grep | then
+	"$1" ${HOME} -eu "$1" && | ${HOME} grep sed sed $(pwd) cd ${HOME} && 'quoted text'
+echo 2>/dev/null x=1 -eu done sed --verbose local
+		--verbose | "$@" export then readonly
+	/usr/bin x=1 local ${HOME} $(pwd)
+	test then echo $(pwd) export
+cd ${HOME} --verbose --verbose
+	readonly readonly test then --verbose cd export 2>/dev/null
+	echo --verbose && ${HOME} grep
+		then x=1 echo $(pwd)
+$(pwd) "$1" && && "$@" readonly then "$1" awk 'quoted text'
+		printf awk | local "$1" 'quoted text' -eu grep && readonly
+-eu --verbose ${HOME} "$@" then "$1" then 'quoted text' echo --verbose
+	--verbose then 2>/dev/null done printf awk "$@" readonly "$@" sed "$1"
+sed grep --verbose 'quoted text' 'quoted text' && awk echo sed readonly
+		export grep "$1" | ${HOME}
+		2>/dev/null grep 'quoted text'
+	then sed "$1" printf grep cd sed sed 'quoted text'
+	awk printf test /usr/bin 2>/dev/null "$1" | printf 2>/dev/null then printf
+-eu --verbose sed printf
+		$(pwd) local | "$@" 2>/dev/null | done echo grep && -eu ${HOME}
+	readonly 'quoted text' cd $(pwd)
+		| "$1" && x=1 export /usr/bin export "$1" local
+		export export ${HOME} -eu -eu echo cd "$1"
+-eu /usr/bin /usr/bin ${HOME} | test "$1" "$1" readonly awk done
+		${HOME} export x=1 then sed awk export /usr/bin awk grep 'quoted text' /usr/bin
+	local x=1 --verbose awk local ${HOME} "$@"
+	export cd 2>/dev/null cd -eu sed | sed /usr/bin
+		cd printf "$@" "$@" --verbose echo && /usr/bin x=1 $(pwd)
+$(pwd) local x=1 ${HOME} then
+2>/dev/null $(pwd) -eu 'quoted text'
+2>/dev/null done done export printf --verbose sed ${HOME} "$1" awk cd ${HOME}
+	| && $(pwd) awk | ${HOME} cd grep ${HOME} done cd /usr/bin
+cd done $(pwd) x=1 test readonly | printf ${HOME} readonly printf x=1 "$@"
+	awk | grep /usr/bin 'quoted text' test -eu 'quoted text' cd
+x=1 done local /usr/bin --verbose grep test
+		"$1" then done readonly && -eu printf "$@" echo x=1 sed
+local awk -eu /usr/bin /usr/bin $(pwd) then -eu && "$1" printf
+echo awk x=1 $(pwd) "$@" then grep
+&& 2>/dev/null ${HOME} printf 'quoted text' awk then ${HOME} awk 2>/dev/null
+&& && awk | | "$@" export readonly local -eu ${HOME}
+	cd readonly "$1" x=1 export test -eu x=1 $(pwd) /usr/bin "$@"
+		2>/dev/null x=1 test --verbose && ${HOME} -eu test x=1 echo test readonly grep
+readonly export "$1" -eu
+		--verbose "$1" --verbose grep cd "$1" "$1" echo awk test sed ${HOME}
+	readonly --verbose sed && cd "$1" sed "$1" test
+	"$@" printf test "$1"
+	awk | | && && "$@" test -eu -eu
+--verbose export done local echo "$@" "$@" | --verbose -eu
+		sed export then printf /usr/bin --verbose --verbose 'quoted text'
+		'quoted text' cd x=1 ${HOME}
+sed x=1 'quoted text' awk && then export --verbose | awk export
+'quoted text' && readonly x=1 2>/dev/null
+		local grep --verbose echo x=1 x=1 printf sed
+sed cd x=1 $(pwd) grep /usr/bin --verbose grep | && /usr/bin 'quoted text' echo
+printf export printf "$1" ${HOME} 2>/dev/null
+	test cd --verbose ${HOME} 2>/dev/null $(pwd)
+		&& x=1 $(pwd) --verbose 'quoted text' local sed ${HOME} sed grep
+		then --verbose awk sed
+		"$1" 2>/dev/null printf | grep sed "$1" readonly
+	printf export 2>/dev/null awk && awk test awk grep &&
+		echo | $(pwd) "$@" --verbose ${HOME} export ${HOME} echo
+${HOME} sed test test
+		--verbose local awk printf printf grep $(pwd) echo
+export x=1 then && local printf 2>/dev/null
+	awk echo $(pwd) --verbose awk $(pwd) local
+	export "$@" readonly $(pwd) local | local cd $(pwd) | local 2>/dev/null export
+	readonly sed $(pwd) echo ${HOME} then
+	x=1 -eu cd test done x=1 then $(pwd) $(pwd) | grep export local
+	printf $(pwd) /usr/bin /usr/bin ${HOME} sed --verbose /usr/bin
+grep printf | && "$@" export then
+"$1" -eu 2>/dev/null "$@" "$@"
+	then $(pwd) printf && /usr/bin sed "$1"
+2>/dev/null "$1" local awk && ${HOME} export then cd /usr/bin done
+		local "$@" /usr/bin test export then awk
+		done test printf "$1" readonly ${HOME} then -eu printf
+		done printf $(pwd) cd sed cd
+		export "$@" awk "$@" --verbose test echo echo local
+		local then printf 2>/dev/null | grep /usr/bin 2>/dev/null
+	&& echo --verbose awk sed 2>/dev/null export echo "$1" echo -eu ${HOME} awk done
+		'quoted text' "$1" done
+	awk test && x=1 readonly local then then 2>/dev/null
+"$1" /usr/bin "$1" "$1" 'quoted text' "$1"
+export 'quoted text' | then echo printf test $(pwd)
+${HOME} ${HOME} x=1 && ${HOME} local
+		echo export | sed "$1" "$1" local && test then
+echo && test --verbose sed test readonly --verbose
+printf export --verbose printf "$@" printf test grep echo
+done awk ${HOME} done printf --verbose ${HOME} printf
+	export && sed echo "$1" x=1 readonly local then
+		local && x=1 readonly local x=1 done $(pwd) then done echo && --verbose local cd
+${HOME} readonly cd awk local echo local --verbose
+	grep "$1" grep ${HOME} "$@" && done | export 2>/dev/null
+	2>/dev/null export printf -eu test -eu /usr/bin
+		export grep "$@" 2>/dev/null x=1 x=1 done 2>/dev/null then | then
+	echo $(pwd) ${HOME} -eu readonly
+	export printf echo export --verbose
+		cd readonly awk then x=1 2>/dev/null
+		cd "$@" /usr/bin then then test "$1"
+	echo --verbose readonly --verbose test echo
+	-eu -eu && awk local export x=1 sed local "$1" local
+		"$@" --verbose local --verbose
+		'quoted text' && "$1" && awk test ${HOME} readonly && export printf sed
+		then --verbose x=1 done export -eu sed | | grep
+2>/dev/null done then | test | test local local grep export
+		x=1 ${HOME} sed x=1 x=1 local /usr/bin
+| ${HOME} echo awk 'quoted text' -eu -eu x=1 /usr/bin sed 'quoted text'
+	"$@" awk --verbose ${HOME} ${HOME} printf
+test "$1" printf export --verbose 'quoted text' 2>/dev/null printf
+		readonly /usr/bin then done cd -eu echo awk readonly "$@" awk 'quoted text' readonly
+	test ${HOME} readonly sed ${HOME} grep
+	export -eu x=1 x=1 test
+		${HOME} x=1 $(pwd) echo cd "$@"
+	x=1 echo x=1 "$@" | cd done printf x=1 "$1" "$1" local "$1" done readonly "$@"
+		awk cd awk readonly "$@" local echo cd printf 'quoted text'
+	readonly ${HOME} "$@" test done /usr/bin cd x=1 then test grep grep
+$(pwd) done "$1" 2>/dev/null test --verbose then readonly local readonly
+	'quoted text' echo 'quoted text' readonly readonly && -eu /usr/bin 2>/dev/null
+local /usr/bin /usr/bin "$@" x=1 printf && done echo readonly
+		2>/dev/null --verbose $(pwd) &&
+		then export --verbose sed readonly then then ${HOME} 'quoted text'
+2>/dev/null awk "$1" --verbose
+		"$1" x=1 | readonly cd local $(pwd) local 2>/dev/null 'quoted text'
+		$(pwd) printf | local "$@" 2>/dev/null
+awk test readonly cd local | done
+		export "$1" sed --verbose && local
+$(pwd) /usr/bin $(pwd) export grep printf 2>/dev/null then test -eu awk x=1
+2>/dev/null then echo grep "$@" ${HOME} sed readonly
+		x=1 grep printf readonly local $(pwd)
+--verbose $(pwd) readonly local && $(pwd) ${HOME}
+	export echo export local
+x=1 /usr/bin "$1" x=1 done --verbose "$@" then "$@" $(pwd)
+	-eu 2>/dev/null $(pwd)
+x=1 x=1 -eu done | export "$@" then && export
+		2>/dev/null export echo 2>/dev/null
+printf 2>/dev/null 2>/dev/null && printf export
+	sed test $(pwd) readonly | 'quoted text' --verbose awk $(pwd) --verbose "$@"
+2>/dev/null local 'quoted text'
+2>/dev/null --verbose printf
+		-eu | -eu cd readonly 2>/dev/null test ${HOME} "$1" export then "$@" /usr/bin export
+then test export && /usr/bin $(pwd) /usr/bin 2>/dev/null && 'quoted text' readonly
+then then -eu echo -eu then --verbose "$@" $(pwd)
+done sed sed test done && test awk then | export -eu readonly local
+		sed /usr/bin echo /usr/bin | printf && awk local grep 2>/dev/null
+		export local ${HOME} printf grep --verbose 2>/dev/null | done && 2>/dev/null
+	2>/dev/null test cd | test "$1" "$1"
+	--verbose echo printf "$@" x=1 printf readonly done -eu then -eu "$1"
+		x=1 echo cd local -eu /usr/bin $(pwd) export $(pwd)
+/usr/bin done done test -eu x=1 printf --verbose 2>/dev/null
+2>/dev/null cd "$@" "$1" "$@" export
+2>/dev/null sed "$@" export then then test then 'quoted text' x=1 && ${HOME}
+local 2>/dev/null grep sed export /usr/bin then echo done
+		echo x=1 sed export /usr/bin "$@" 'quoted text'
+	/usr/bin export then grep | sed cd local readonly && -eu sed && local done "$@"
+		sed grep awk echo x=1 "$1" awk printf
+${HOME} -eu --verbose && /usr/bin done cd && x=1 | cd -eu $(pwd) readonly
+	| --verbose $(pwd) awk "$1"
+		export test done then $(pwd) export -eu awk grep
+x=1 local $(pwd) local then test awk printf sed export
+	2>/dev/null grep export grep printf | "$@"
+		-eu export echo && printf echo then x=1 ${HOME} "$@" 'quoted text' export cd
+local printf sed local printf
+	grep && | printf ${HOME} awk 'quoted text' ${HOME} sed awk printf grep --verbose
+		cd export done printf $(pwd) -eu --verbose cd $(pwd) sed "$1" sed 2>/dev/null
+test awk done then ${HOME} awk done x=1 printf 2>/dev/null 2>/dev/null readonly
+-eu test awk --verbose $(pwd) export printf printf
+	done export -eu awk -eu test 'quoted text' && done
+	awk cd then export readonly /usr/bin "$@" export sed && test "$1" --verbose "$1"
+		cd | "$@" echo test x=1 | done readonly echo sed "$@" sed ${HOME}
+| "$1" "$1" $(pwd) local "$@" then "$1" /usr/bin readonly printf test --verbose
+		test cd test --verbose readonly awk ${HOME} sed done --verbose
+		&& "$1" --verbose 'quoted text'
+	--verbose readonly "$1" sed "$1" ${HOME} "$@"
+	&& "$@" -eu | -eu grep readonly export --verbose local && done
+		x=1 readonly export echo
+	sed cd && "$@" grep test x=1 cd $(pwd) printf done grep sed /usr/bin
+	grep cd sed grep 'quoted text' awk "$1" ${HOME} cd /usr/bin -eu local export
+$(pwd) export --verbose && local awk
+"$1" /usr/bin "$@" && printf test grep && then local x=1 cd
+awk $(pwd) && test sed test "$@" 'quoted text' -eu
+		grep "$1" --verbose test cd echo /usr/bin 2>/dev/null
+	then export echo -eu ${HOME} 2>/dev/null local --verbose
+"$1" "$@" $(pwd) 'quoted text'
+| test test 2>/dev/null awk cd $(pwd) printf
+	"$@" then $(pwd) 'quoted text' echo ${HOME} local local grep then test
+'quoted text' $(pwd) test echo 2>/dev/null ${HOME} cd done
+	printf readonly awk done /usr/bin
+sed awk x=1 x=1 test test -eu 2>/dev/null printf --verbose
+grep && printf sed printf cd export 2>/dev/null printf
+x=1 printf test $(pwd) 'quoted text' x=1
+		printf echo readonly then grep /usr/bin
+"$@" -eu test readonly "$@" local -eu test local
+x=1 "$@" && --verbose cd x=1 x=1
+	| done cd "$1" printf
+		awk test /usr/bin local export
+	&& echo cd /usr/bin --verbose -eu printf "$@" done -eu export local $(pwd)
+	test "$1" && ${HOME} awk done cd awk cd sed export readonly
+	done test 'quoted text' awk "$1" 'quoted text' test | | "$1"
+'quoted text' $(pwd) | 'quoted text' grep
+		x=1 && -eu printf sed $(pwd) ${HOME} local export
+echo --verbose 'quoted text' grep
+		${HOME} test 2>/dev/null ${HOME} ${HOME} awk
+	then 'quoted text' sed 2>/dev/null done "$1" echo readonly
+	"$1" -eu --verbose then --verbose then $(pwd) "$1" -eu echo ${HOME} -eu | awk sed
+		cd 2>/dev/null readonly /usr/bin then grep grep $(pwd) "$@" local x=1 cd printf
+	-eu then 'quoted text' local echo sed export && x=1 done sed readonly
+	cd ${HOME} 2>/dev/null echo done test ${HOME} x=1 ${HOME} then 2>/dev/null
+		&& $(pwd) echo -eu grep 2>/dev/null ${HOME} printf echo grep 2>/dev/null "$1"
+		test -eu --verbose test cd "$@" /usr/bin 'quoted text'
+echo -eu readonly readonly ${HOME} -eu
+sed local "$@" export grep export 'quoted text' -eu "$@" test &&
+	-eu local sed done then sed export "$@"
+	awk && --verbose export cd -eu local
+		"$@" "$@" && /usr/bin export "$1" 2>/dev/null echo -eu x=1
+--verbose awk done ${HOME} grep export export grep
+		awk awk printf 2>/dev/null printf "$1"
+		test export printf cd awk "$@" --verbose "$1" sed --verbose
+echo --verbose then -eu local echo awk local grep cd $(pwd)
+		then printf "$@" awk && sed 'quoted text' test 'quoted text' test printf
+"$1" awk grep readonly | ${HOME} | then export
+		2>/dev/null -eu export done ${HOME} $(pwd) | x=1 x=1 local export done
+then ${HOME} export printf readonly local readonly
+test "$1" ${HOME} done grep /usr/bin | echo awk done sed done cd local | cd 2>/dev/null
+	then /usr/bin --verbose 2>/dev/null export then printf "$1" --verbose /usr/bin -eu
+		"$1" export "$1" -eu /usr/bin
+		| "$@" grep 'quoted text' grep
+	printf local -eu awk export --verbose /usr/bin
+		grep --verbose cd $(pwd) cd --verbose
+	printf echo cd /usr/bin
+2>/dev/null -eu grep | cd --verbose
+	test "$@" readonly -eu ${HOME}
+| /usr/bin ${HOME} sed /usr/bin "$1" $(pwd) 2>/dev/null
+export /usr/bin awk awk 2>/dev/null then
+		echo ${HOME} done --verbose done test /usr/bin x=1 cd $(pwd)
+		done ${HOME} --verbose -eu then done
+		2>/dev/null readonly "$1" local ${HOME} --verbose cd | echo $(pwd)
+/usr/bin then $(pwd) local
+local && && export && "$@" printf
+		$(pwd) done | then sed x=1 "$@" test awk ${HOME} done | ${HOME} export
+cd | test 2>/dev/null -eu ${HOME} local printf test --verbose
+	${HOME} 'quoted text' 'quoted text' grep && --verbose grep
+		export echo "$@" then echo | 2>/dev/null /usr/bin "$@"
+		$(pwd) "$1" echo $(pwd) test done $(pwd) echo then test cd | export
+		--verbose printf local /usr/bin echo "$1" printf x=1 x=1 'quoted text'
+printf /usr/bin then 2>/dev/null -eu /usr/bin test sed echo
+	cd --verbose 'quoted text'
+		export -eu done && cd $(pwd) /usr/bin
+	sed done 'quoted text' readonly
+--verbose -eu done 'quoted text' echo
+		--verbose | awk local readonly --verbose
+2>/dev/null done ${HOME} $(pwd) "$@" grep awk awk test -eu --verbose $(pwd)
+	export 2>/dev/null $(pwd) local sed readonly
+awk $(pwd) ${HOME} $(pwd) -eu "$@" local 2>/dev/null cd ${HOME} readonly
+export | ${HOME} sed --verbose 'quoted text' x=1 x=1 && --verbose
+cd | --verbose sed grep awk "$@"
+		done "$1" /usr/bin cd -eu done sed local $(pwd) printf
+${HOME} readonly | /usr/bin 'quoted text'
+	&& then $(pwd) printf
+		cd local | -eu /usr/bin | local "$@" -eu export | export /usr/bin local
+	2>/dev/null done && |
+local test cd echo x=1 | sed cd "$1" && printf --verbose | printf
+-eu test x=1 'quoted text' then test $(pwd) readonly
+export printf 'quoted text' ${HOME} cd $(pwd)
+		${HOME} done 'quoted text' awk | "$@" "$1" "$@" test
+		grep then 2>/dev/null grep printf cd sed grep readonly
+&& local printf ${HOME} printf --verbose --verbose "$@" done grep "$@" printf &&
+"$@" export readonly 2>/dev/null /usr/bin && sed x=1
+		$(pwd) local | test --verbose echo readonly x=1 grep export printf
+		readonly && /usr/bin
+	| grep 'quoted text' local awk printf --verbose | done --verbose 'quoted text'
+then && echo done ${HOME} "$@" readonly 2>/dev/null
+		/usr/bin -eu /usr/bin && export "$1" ${HOME} readonly &&
+		x=1 echo test /usr/bin x=1 "$1" then local "$1" printf local
+	awk export then -eu then readonly awk export
+echo export grep local $(pwd) && -eu cd local ${HOME}
+		"$@" export 'quoted text' 2>/dev/null then 'quoted text' export test printf
+	readonly x=1 "$@" 'quoted text' cd
+export && 2>/dev/null $(pwd) | /usr/bin
+		cd "$1" echo cd x=1 grep export -eu $(pwd)
+	test printf 2>/dev/null && echo | cd done export --verbose readonly
+	-eu cd echo awk then $(pwd) export export
+		echo "$1" $(pwd) 2>/dev/null 'quoted text' then $(pwd) && then test $(pwd)
+	--verbose 2>/dev/null printf $(pwd) awk then -eu 'quoted text' /usr/bin $(pwd)
+sed local 'quoted text' then readonly echo
+		local 'quoted text' 2>/dev/null
+		test test grep 'quoted text' then /usr/bin done done then test
+		sed | export echo -eu -eu then 'quoted text'
+		"$1" echo local -eu export
+		"$@" test "$@" && x=1 awk $(pwd) 'quoted text' | done -eu
+		done --verbose "$1" -eu sed x=1 done printf ${HOME} | "$@"
+		then ${HOME} echo -eu printf ${HOME}
+/usr/bin "$@" local "$1"
+		$(pwd) export 'quoted text'
+	"$1" $(pwd) -eu readonly --verbose && grep "$@" cd
+x=1 grep readonly export
+		echo x=1 readonly x=1 -eu readonly export grep $(pwd) /usr/bin
+"$1" echo echo awk cd 2>/dev/null cd printf && cd awk
+		export test grep ${HOME}
+	$(pwd) echo | --verbose echo test done | sed x=1 grep | echo 'quoted text' local
+"$@" printf "$@" printf grep && readonly export cd $(pwd) -eu "$@"
+&& ${HOME} awk -eu echo sed export local printf 'quoted text' awk
+/usr/bin printf -eu done
+		local --verbose grep test awk then readonly export done cd echo ${HOME} printf
+		printf ${HOME} grep grep test "$1" --verbose
+		--verbose sed test test export x=1 printf "$@" 2>/dev/null "$1" x=1
+| ${HOME} 'quoted text' /usr/bin $(pwd) x=1 then export
+"$1" done readonly printf "$@" && local x=1 done "$@"
+	--verbose export printf
+	-eu "$@" /usr/bin -eu /usr/bin "$1" && 'quoted text' awk
+		'quoted text' local | --verbose x=1 test echo readonly test x=1 | ${HOME}
+	done done awk export /usr/bin grep | "$@" x=1 export --verbose printf cd
+	printf awk cd /usr/bin /usr/bin local test -eu x=1 awk grep | /usr/bin $(pwd) export
+	--verbose local x=1 awk x=1 'quoted text' | echo local /usr/bin ${HOME}
+test echo | readonly
+${HOME} 'quoted text' $(pwd) readonly then sed then && "$1"
+	'quoted text' sed test && local "$1" "$@" sed done readonly &&
+		awk cd export then done 'quoted text' export
+2>/dev/null cd -eu sed export $(pwd) 2>/dev/null grep && echo && --verbose 2>/dev/null
+x=1 echo "$1" export awk /usr/bin
+	export "$@" 2>/dev/null /usr/bin
+	local 'quoted text' grep $(pwd) readonly export
+	'quoted text' grep done | local printf x=1
+		$(pwd) awk --verbose | -eu "$1"
+	"$@" && export cd grep printf local 2>/dev/null
+	&& grep then $(pwd) -eu printf x=1 && "$@"
+		printf done 'quoted text' | --verbose awk local cd done "$@"
+		echo "$@" 'quoted text'
+		done grep done local done "$@" grep -eu 'quoted text' then -eu echo
+| readonly 'quoted text' "$1" local "$@" && | echo then
+		/usr/bin 2>/dev/null printf cd /usr/bin cd export 'quoted text'
+		"$1" 2>/dev/null done && "$1" readonly echo cd export x=1 done sed
+		"$1" awk ${HOME} done -eu "$@" awk &&
+		x=1 && cd awk && printf /usr/bin cd done $(pwd)
+		export "$@" readonly export $(pwd) x=1 "$@" done /usr/bin -eu
+	--verbose /usr/bin /usr/bin -eu "$1" then $(pwd) cd sed
+	cd echo local --verbose export echo /usr/bin local test /usr/bin test
+	printf local /usr/bin
+sed local printf --verbose | test --verbose
+	done awk done "$1" ${HOME} cd local "$@" "$@" 'quoted text'
+	sed awk /usr/bin grep cd -eu ${HOME} then done done "$1" cd
+		awk 'quoted text' grep --verbose awk ${HOME} | /usr/bin
+2>/dev/null ${HOME} printf x=1 ${HOME}
+		&& cd readonly ${HOME} ${HOME} done -eu "$1" sed x=1 x=1
+	cd 2>/dev/null printf && printf
+/usr/bin local /usr/bin awk -eu --verbose | local printf then export printf
+2>/dev/null /usr/bin awk
+		readonly "$@" grep $(pwd) then done cd grep done done $(pwd) 2>/dev/null
+		'quoted text' $(pwd) done test done printf sed x=1 then $(pwd) 'quoted text'
+		readonly then /usr/bin export
+	local export cd && done awk
+	local then 2>/dev/null then
+		$(pwd) | awk local test export test |
+		done done export local sed
+&& then readonly echo $(pwd) readonly
+		--verbose x=1 $(pwd) "$1" --verbose "$1" echo echo --verbose
+	cd grep "$@" --verbose grep then $(pwd) -eu cd --verbose "$1" x=1 cd grep
+	&& 2>/dev/null -eu x=1 | 2>/dev/null 2>/dev/null awk | local
+		local -eu 2>/dev/null 'quoted text' /usr/bin echo 2>/dev/null 2>/dev/null
+$(pwd) readonly && printf "$1" sed $(pwd) /usr/bin
+		local printf then awk 2>/dev/null "$1" $(pwd) && "$@" then
+$(pwd) --verbose ${HOME}
+	local export 2>/dev/null 2>/dev/null readonly 'quoted text'
+	echo ${HOME} done test "$1" done grep
+--verbose x=1 /usr/bin
+		${HOME} sed $(pwd) && -eu "$@" "$1" -eu /usr/bin --verbose printf
+	local /usr/bin export sed
+		then $(pwd) | "$1" local $(pwd) test printf readonly /usr/bin --verbose
+	| sed "$@" grep export printf -eu -eu 'quoted text' done export
+sed cd export printf --verbose -eu 2>/dev/null then | printf "$1" local
+		${HOME} grep done ${HOME} "$@" "$1" then echo 2>/dev/null x=1 readonly
+		$(pwd) ${HOME} x=1 /usr/bin echo grep /usr/bin ${HOME} "$@" echo | && then
+		${HOME} && $(pwd) cd printf | && local ${HOME} x=1 readonly
+		${HOME} 'quoted text' x=1 $(pwd) readonly /usr/bin 'quoted text'
+	/usr/bin ${HOME} $(pwd) echo 2>/dev/null export then readonly
+		2>/dev/null x=1 echo ${HOME} readonly && test x=1 /usr/bin
+"$@" readonly -eu /usr/bin 'quoted text' awk --verbose readonly
+		/usr/bin sed /usr/bin local -eu "$1" /usr/bin
+test export printf ${HOME} | grep | --verbose x=1 "$1" "$@" grep | then awk sed
+	"$@" "$@" awk then export grep $(pwd) grep
+		sed --verbose sed grep awk printf echo /usr/bin sed "$@" sed local /usr/bin
+		echo "$@" awk 2>/dev/null echo cd cd $(pwd) x=1 x=1 /usr/bin sed test
+		awk readonly 'quoted text'
+		'quoted text' cd sed test echo echo
+2>/dev/null then local x=1 "$1" --verbose printf local local x=1
+	&& --verbose 2>/dev/null /usr/bin
+	readonly | /usr/bin grep | /usr/bin $(pwd) awk ${HOME} done printf then
+&& ${HOME} printf readonly "$1" printf echo
+		awk $(pwd) $(pwd) grep grep "$@" 'quoted text' local
+		export done done printf echo
+		printf x=1 ${HOME} echo awk && --verbose
+	printf sed "$1" 'quoted text' awk 'quoted text'
+		awk x=1 $(pwd) | then 2>/dev/null --verbose ${HOME}
+then sed grep 2>/dev/null grep awk printf local --verbose test 'quoted text'
+awk printf | printf sed then
+cd local cd ${HOME} -eu awk "$1" export done "$@" ${HOME} awk printf --verbose
+	echo "$1" 'quoted text' sed "$@" awk --verbose readonly
+	'quoted text' -eu grep && local
+		done export done export sed echo export 'quoted text' export grep sed
+		/usr/bin -eu $(pwd) -eu ${HOME} readonly &&
+	| x=1 /usr/bin | && x=1 grep $(pwd) then
+	test "$1" /usr/bin ${HOME}
+printf 2>/dev/null grep | echo cd sed "$1" 2>/dev/null readonly then echo -eu
+		"$@" echo printf then "$@"
+		/usr/bin | readonly /usr/bin readonly printf
+then cd sed done && then export done grep $(pwd) readonly 2>/dev/null "$1" test
+		then grep x=1 export sed grep then
+		awk -eu /usr/bin ${HOME} $(pwd) done --verbose ${HOME}
+	awk 'quoted text' 2>/dev/null x=1 $(pwd)
+		test "$1" "$1" grep && 2>/dev/null && printf && printf cd grep $(pwd) local
+/usr/bin export local grep | cd ${HOME} cd sed /usr/bin
+&& "$1" test ${HOME} local "$@" 2>/dev/null "$1" cd "$@"
+		done 'quoted text' grep "$1" 2>/dev/null $(pwd) ${HOME} "$1"
+		readonly 2>/dev/null 2>/dev/null --verbose sed printf
+		2>/dev/null readonly /usr/bin "$@" x=1 awk then
+sed printf x=1 sed printf x=1 2>/dev/null then x=1 --verbose | ${HOME} &&
+export done grep $(pwd) --verbose echo awk && then -eu sed
+	then && ${HOME} "$@" export ${HOME} "$1" echo -eu ${HOME}
+	/usr/bin grep "$1" sed | | 2>/dev/null cd 2>/dev/null $(pwd) x=1 test
+local sed --verbose local echo 'quoted text' sed
+	2>/dev/null done grep test sed 'quoted text' 2>/dev/null export
+		export awk export awk echo printf done done "$@" grep | printf grep
+	"$1" "$@" && cd awk "$1" awk -eu | x=1 /usr/bin "$@" x=1 awk $(pwd) | export
+	2>/dev/null 2>/dev/null
+	--verbose "$@" -eu awk sed $(pwd) then $(pwd) "$@"
+	/usr/bin test 'quoted text'
+cd "$@" -eu /usr/bin "$@" | printf cd | 'quoted text' awk sed export
+		awk printf | echo "$1" awk readonly readonly -eu
+	/usr/bin echo printf awk
+	test | ${HOME} readonly && "$@" ${HOME} --verbose then local -eu --verbose readonly
+	readonly done sed sed "$@" local grep done /usr/bin --verbose
+	local x=1 done awk test sed cd --verbose sed
+printf awk echo test sed done sed "$1"
+		export /usr/bin cd $(pwd) grep sed printf then "$1" "$1"
+		&& then printf cd then "$@" export ${HOME} --verbose
+		local done export sed grep readonly
+		export $(pwd) printf echo x=1 then ${HOME}
+	export 'quoted text' grep local "$1"
+	x=1 'quoted text' test test grep && then awk local $(pwd) "$@" -eu sed
+readonly awk printf readonly ${HOME} readonly | test grep test printf
+done /usr/bin "$@" --verbose
+		/usr/bin grep readonly 2>/dev/null ${HOME} x=1 cd 'quoted text' 'quoted text'
+		echo ${HOME} | test 2>/dev/null readonly awk printf -eu grep sed echo
+		-eu $(pwd) && awk && "$1" 'quoted text'
+x=1 export "$1" -eu printf
+awk test cd readonly /usr/bin /usr/bin
+local sed grep echo local ${HOME} local printf printf
+	'quoted text' /usr/bin cd readonly cd -eu $(pwd) "$@"
+${HOME} test readonly /usr/bin cd test
+	then 'quoted text' done
+	done test printf sed | -eu test
+export --verbose | printf $(pwd) done 2>/dev/null ${HOME} $(pwd)
+x=1 echo 'quoted text' -eu "$@" then awk
+cd cd echo x=1 x=1 'quoted text'
+		done 'quoted text' 2>/dev/null test grep x=1 --verbose export awk $(pwd) test |
+	"$@" 2>/dev/null 'quoted text' --verbose grep readonly cd -eu local
+--verbose | echo x=1 x=1 -eu then ${HOME} -eu 'quoted text' grep cd local
+test readonly readonly local then "$@"
+		'quoted text' --verbose echo "$@" test 2>/dev/null
+		then 2>/dev/null echo local 'quoted text' /usr/bin grep cd printf
+${HOME} local done ${HOME} ${HOME} "$@" sed awk done 2>/dev/null export
+"$1" 2>/dev/null && readonly
+$(pwd) grep 2>/dev/null "$1" grep "$1" done --verbose $(pwd) 2>/dev/null
+		readonly awk "$1" sed then x=1
+	done printf 'quoted text' x=1 "$@" x=1 ${HOME} --verbose echo test &&
+cd /usr/bin --verbose local -eu done cd printf cd grep then echo
+		sed sed && ${HOME} local 2>/dev/null "$1" grep export done awk
+		sed export awk 2>/dev/null "$@" ${HOME} sed test printf x=1 awk --verbose
+		sed echo readonly x=1 awk awk awk $(pwd)
+	awk awk 2>/dev/null /usr/bin "$@" then done readonly
+	sed grep $(pwd) sed done
+"$1" sed cd test done local ${HOME}
+2>/dev/null "$@" awk "$1" | x=1 done /usr/bin test /usr/bin sed echo export
+		echo | "$1" | awk "$1" then readonly done | awk awk
+		then /usr/bin then cd local $(pwd) /usr/bin sed test cd | grep
+	x=1 awk done "$1" "$@" | done export grep /usr/bin && -eu --verbose --verbose
+	awk readonly readonly 2>/dev/null local 2>/dev/null echo readonly x=1
+/usr/bin 'quoted text' -eu && awk
+2>/dev/null 2>/dev/null awk local 'quoted text' done && cd /usr/bin 2>/dev/null
+		'quoted text' export sed 'quoted text' local test -eu sed
+	done cd grep 'quoted text' done test sed then
+		test /usr/bin readonly local awk
+	2>/dev/null grep /usr/bin local --verbose then done
+		x=1 --verbose echo local readonly -eu local "$@" "$1"
+	grep grep grep local $(pwd) | test awk ${HOME} $(pwd) readonly
+	${HOME} printf | 'quoted text' grep done "$1"
+"$1" printf cd -eu printf
+done ${HOME} awk then local | test | cd | "$1" --verbose grep export "$1" export
+	| test 'quoted text' done done cd $(pwd) 'quoted text' cd ${HOME}
+		x=1 -eu echo 'quoted text' --verbose /usr/bin $(pwd) printf ${HOME} cd /usr/bin
+	test | "$1" sed done --verbose $(pwd) printf export | export "$1" x=1 &&
+	awk test -eu 2>/dev/null | | /usr/bin
+		/usr/bin /usr/bin x=1 2>/dev/null
+		'quoted text' readonly $(pwd) test "$@" "$@" test 2>/dev/null export test -eu "$@"
+grep printf "$1" then then
+		"$@" local -eu echo "$1" sed $(pwd) 2>/dev/null
+	2>/dev/null test ${HOME} && then && export test test | sed -eu
+		then done echo done then -eu "$1" echo done 2>/dev/null
+		echo $(pwd) "$1" awk cd export && cd $(pwd) printf -eu "$@"
+		2>/dev/null && local echo printf local && then ${HOME} test $(pwd)
+		"$1" then sed "$@" grep grep awk
+		grep readonly $(pwd) "$1" | 2>/dev/null
+cd grep --verbose export sed grep echo export --verbose -eu "$1" test test
+2>/dev/null "$1" 'quoted text'
+&& 2>/dev/null | sed export done 2>/dev/null cd /usr/bin -eu cd "$@" done echo
+		"$@" ${HOME} sed --verbose | grep cd -eu then
+'quoted text' echo -eu x=1 x=1 printf export
+	'quoted text' "$1" 2>/dev/null
+cd printf sed && ${HOME} cd echo export
+	/usr/bin echo x=1 then 'quoted text'
+	then 'quoted text' export "$@" /usr/bin $(pwd) | -eu -eu export then then then
+/usr/bin test x=1 printf echo local cd /usr/bin && export local
+	awk cd sed test grep export grep -eu x=1 $(pwd)
+	grep "$1" sed /usr/bin local printf
+		then 2>/dev/null cd grep readonly
+	'quoted text' "$1" then 2>/dev/null | awk "$1" printf "$@" cd $(pwd) readonly test
+2>/dev/null test | awk ${HOME} printf "$@" readonly done -eu
+		$(pwd) && local printf | then echo awk awk cd grep --verbose
+		export --verbose --verbose "$1" then
+		export readonly echo export ${HOME} /usr/bin 2>/dev/null awk grep
+${HOME} && sed echo readonly grep export done "$@"
+2>/dev/null readonly "$@" done local printf local cd echo 'quoted text'
+	$(pwd) | echo then test ${HOME}
+		awk local --verbose 2>/dev/null printf /usr/bin test
+x=1 export then "$@" grep $(pwd) | readonly x=1 cd export --verbose
+--verbose awk awk "$@" x=1
+		done done ${HOME} cd awk export then printf && ${HOME} 'quoted text'
+		${HOME} x=1 "$1" cd then
+awk sed export | $(pwd) then --verbose
+		sed then sed --verbose ${HOME} local 2>/dev/null cd "$@" "$@" x=1 x=1 'quoted text'
+	x=1 readonly test 'quoted text' printf local
+	&& "$@" then | 2>/dev/null /usr/bin
+	x=1 grep 'quoted text' awk export x=1 printf echo /usr/bin local local
+		awk x=1 awk cd ${HOME} "$@" ${HOME} "$@" | x=1 readonly printf
+-eu readonly 2>/dev/null cd done done done && /usr/bin grep
+done x=1 $(pwd) cd then "$1" /usr/bin printf sed cd
+local --verbose 'quoted text' 2>/dev/null export && -eu 2>/dev/null
+		grep test done local ${HOME}
+	"$@" && readonly "$@" then --verbose printf test test test /usr/bin
+	printf echo 2>/dev/null readonly sed /usr/bin
+| | && "$1" 'quoted text' awk done | -eu /usr/bin -eu done then "$@"
+		test echo grep | $(pwd) printf grep | sed readonly /usr/bin -eu -eu test local
+	grep echo sed $(pwd) /usr/bin "$1" "$@" readonly 2>/dev/null readonly
+"$1" export then cd awk 'quoted text'
+${HOME} export && --verbose 'quoted text'
+	sed local | -eu grep && sed x=1 done x=1 cd local then 'quoted text'
+		readonly printf done 2>/dev/null test
+	readonly $(pwd) awk readonly | export
+	readonly export awk "$1" "$@"
+	awk readonly echo 'quoted text' && 'quoted text' "$@" --verbose local
+-eu done printf grep then echo printf
+"$@" --verbose then then ${HOME} export cd "$@" test grep
+		sed ${HOME} echo awk $(pwd) "$@" "$1" echo readonly && grep --verbose then export
+		local export local x=1 "$@" printf "$1" local -eu readonly
+awk test then export $(pwd) grep grep test awk echo local then
+then "$1" ${HOME} readonly test
+	test awk awk sed ${HOME} cd
+		$(pwd) ${HOME} | ${HOME} -eu && | awk then
+	readonly "$1" && local awk --verbose --verbose
+"$1" then -eu export printf local --verbose
+grep awk awk grep $(pwd) grep | export local printf $(pwd) -eu
+grep /usr/bin done done "$@" "$1" /usr/bin then $(pwd) echo cd | echo && && -eu
+		2>/dev/null sed | local $(pwd) /usr/bin
+	then -eu x=1 "$1" $(pwd) "$1" test 'quoted text' readonly
+-eu printf test "$@" -eu && | test then cd "$@" local echo -eu $(pwd) -eu test
+	| readonly | 'quoted text'
+	/usr/bin /usr/bin done local
+cd test 2>/dev/null "$1" $(pwd) echo
+		local sed sed | $(pwd) cd --verbose /usr/bin && sed grep printf 2>/dev/null
+	cd /usr/bin cd then grep -eu 2>/dev/null sed $(pwd) "$1" --verbose
+	2>/dev/null test "$@" -eu "$1" | 2>/dev/null
+	test then sed printf then printf "$1" echo done --verbose done done 'quoted text'
+echo --verbose --verbose cd ${HOME}
+/usr/bin 2>/dev/null grep echo && export echo done
+		printf echo awk readonly | test x=1 sed grep then awk && "$1"
+		-eu -eu 'quoted text' awk local grep && --verbose | sed -eu "$@" local awk "$1"
+echo local cd awk echo 'quoted text' then printf then && sed
+		/usr/bin "$@" printf local then local grep $(pwd) x=1 |
+		--verbose grep grep cd echo
+grep grep | $(pwd) echo --verbose
+		sed then "$@" x=1 --verbose "$1" grep done export awk && sed 2>/dev/null
+		'quoted text' | "$@" sed 2>/dev/null 'quoted text' sed
+		"$@" printf "$1" "$@" export | then cd "$1" x=1 -eu "$1" x=1
+		export 'quoted text' --verbose ${HOME} grep local 'quoted text'
+		x=1 "$@" export sed | awk $(pwd)
+		2>/dev/null -eu export done
+		printf echo echo readonly "$@" grep awk | -eu readonly readonly --verbose readonly
+grep 2>/dev/null 'quoted text'
+sed "$@" then export sed && /usr/bin "$@" && /usr/bin -eu "$@" "$@" ${HOME}
+		$(pwd) "$@" awk --verbose grep grep 2>/dev/null ${HOME} test test ${HOME} test
+${HOME} 2>/dev/null sed /usr/bin test
+		/usr/bin local readonly ${HOME} test awk local ${HOME}
+-eu && done ${HOME} 'quoted text' sed readonly ${HOME} readonly
+"$1" --verbose "$1" && cd readonly 2>/dev/null && done sed -eu local --verbose
+$(pwd) /usr/bin echo -eu 'quoted text' readonly $(pwd) export 'quoted text' local
+		2>/dev/null echo && export grep grep -eu ${HOME} $(pwd)
+	awk --verbose readonly --verbose x=1 echo -eu
+	printf /usr/bin -eu -eu echo local | "$@"
+	'quoted text' readonly done "$@" ${HOME} then echo $(pwd) /usr/bin test
+		then "$@" export test ${HOME} ${HOME}
+2>/dev/null "$1" "$@" "$@" 'quoted text' awk
+'quoted text' $(pwd) awk awk test x=1 test x=1 /usr/bin $(pwd) readonly ${HOME}
+		readonly x=1 2>/dev/null x=1 echo /usr/bin then cd "$@" --verbose | printf |
+	x=1 ${HOME} $(pwd) printf $(pwd) echo -eu x=1 | test ${HOME}
+awk /usr/bin awk && | awk cd printf
+	readonly | $(pwd) /usr/bin sed sed grep
+		test test /usr/bin x=1 done export ${HOME} x=1 && printf
+	local then x=1 $(pwd) echo then readonly sed export
+	'quoted text' grep local | echo -eu -eu echo sed ${HOME} local
+		$(pwd) export x=1 export test done x=1 "$@" 'quoted text'
+printf printf "$@" --verbose $(pwd)
+	export grep 'quoted text' export "$1" sed done 2>/dev/null "$@" awk cd printf
+export printf "$1" && $(pwd)
+test readonly echo "$1" grep $(pwd) "$@" x=1 "$@" readonly ${HOME} x=1
+"$@" ${HOME} $(pwd) grep local /usr/bin done cd "$1" && test sed
+		'quoted text' printf done /usr/bin
+		/usr/bin done grep "$@" local
+then echo sed 'quoted text'
+done "$@" $(pwd) grep cd local then awk printf ${HOME} grep
+	| sed readonly 2>/dev/null "$@" done
+		"$1" done sed -eu 2>/dev/null done $(pwd) | && ${HOME}
+		then readonly done ${HOME} cd local readonly $(pwd) && local
+	printf -eu export "$1" sed /usr/bin printf local && done cd "$1" x=1
+		"$@" readonly cd "$1" then echo awk 'quoted text' awk
+		test echo ${HOME} grep test grep awk sed
+&& grep local 2>/dev/null export "$@" /usr/bin then test then awk echo -eu grep
+| grep 2>/dev/null cd x=1 'quoted text' 2>/dev/null "$@" awk 'quoted text' "$@"
+/usr/bin -eu ${HOME} /usr/bin readonly
+	test echo sed "$1" echo export 'quoted text' test "$@" x=1 ${HOME} $(pwd)
+		/usr/bin done export echo -eu ${HOME} readonly sed test ${HOME} then /usr/bin readonly
+		"$1" then grep "$1" && 'quoted text' /usr/bin --verbose awk x=1 ${HOME}
+"$1" cd | 'quoted text' "$1" test export
+local cd $(pwd) && x=1 "$1"
+		$(pwd) cd x=1 test done
+	local test x=1 printf "$@" export local && cd 2>/dev/null 'quoted text'
+		-eu --verbose $(pwd) --verbose | x=1 x=1
+	"$@" sed && -eu local printf printf /usr/bin 2>/dev/null
+	sed test sed 'quoted text' done awk "$@" readonly
+	sed printf test 2>/dev/null 2>/dev/null test printf x=1 2>/dev/null awk
+		awk awk && printf printf awk readonly
+		local 'quoted text' done 2>/dev/null
+		-eu --verbose $(pwd) && export /usr/bin
+	sed /usr/bin printf "$@" ${HOME} cd cd export | "$1" sed
+--verbose -eu | "$@" -eu x=1 sed awk &&
+done 'quoted text' "$1" cd -eu | grep readonly --verbose test
+done 2>/dev/null done cd then && /usr/bin
+	-eu --verbose "$@" 'quoted text' printf echo
+	'quoted text' -eu && | local
+	$(pwd) ${HOME} awk 'quoted text' -eu sed && test then "$1" test x=1 -eu -eu "$@"
+	'quoted text' done awk grep grep ${HOME} "$@" x=1 then echo cd "$1" 'quoted text'
+&& grep printf 'quoted text' /usr/bin x=1 cd && grep $(pwd)
+		-eu "$1" local -eu test printf /usr/bin --verbose
+cd echo then --verbose sed --verbose export awk readonly
+		local $(pwd) awk readonly sed done readonly done "$@"
+	--verbose 'quoted text' --verbose
+printf /usr/bin cd awk "$@" && sed
+	awk | ${HOME} | awk "$@" -eu
+-eu test "$@" "$1" -eu --verbose /usr/bin && 2>/dev/null
+	&& test 'quoted text' export sed test
+		-eu -eu test awk printf ${HOME} awk local
+	/usr/bin ${HOME} export
+readonly readonly x=1 done export x=1
+2>/dev/null done export grep "$@" "$@" $(pwd) | then | --verbose
+		$(pwd) printf export cd printf --verbose grep
+		then && printf ${HOME} /usr/bin readonly 'quoted text'
+printf | --verbose awk "$1" && "$@" "$@" /usr/bin |
+		$(pwd) x=1 2>/dev/null /usr/bin "$@" grep awk cd --verbose grep sed ${HOME} sed
+		${HOME} printf /usr/bin export $(pwd) then local export sed
+readonly done 2>/dev/null && echo "$@"
+	| echo $(pwd) done export --verbose then local
+	sed local --verbose awk 2>/dev/null | 2>/dev/null echo "$1"
+	echo test cd then test echo "$@" grep
+		echo awk cd --verbose ${HOME} awk &&
+x=1 "$1" printf export 'quoted text'
+		2>/dev/null export ${HOME} | export awk $(pwd) "$1" then x=1 readonly && /usr/bin
+		then --verbose readonly
+	echo grep grep 2>/dev/null readonly
+	&& 2>/dev/null local -eu test 'quoted text' 'quoted text' then --verbose
+	$(pwd) sed grep awk printf | | cd readonly printf "$@" x=1 cd && /usr/bin --verbose
+awk --verbose printf | grep $(pwd) done -eu "$@" awk local && $(pwd) sed
+export && echo 'quoted text'
+grep x=1 2>/dev/null "$@" 'quoted text' local cd cd -eu grep x=1 cd "$1"
+	${HOME} "$@" /usr/bin $(pwd) --verbose readonly
+	"$1" export readonly done grep x=1 'quoted text' && sed -eu test | && ${HOME}
+	grep 'quoted text' readonly $(pwd) 'quoted text' then
+$(pwd) "$@" echo && test done -eu "$1"
+		${HOME} echo 2>/dev/null $(pwd) echo then $(pwd) sed done export export $(pwd)
+then cd | echo echo sed cd --verbose test local $(pwd) && grep
+test ${HOME} sed echo 2>/dev/null && local $(pwd) && && awk test x=1
+		local 'quoted text' x=1
+	$(pwd) local --verbose "$1" x=1 sed 2>/dev/null && cd /usr/bin "$1" echo echo
+		--verbose /usr/bin -eu done x=1
+${HOME} -eu ${HOME} "$1" "$@" ${HOME} "$1" sed echo then | $(pwd) 'quoted text'
+-eu done echo awk $(pwd) "$@" 2>/dev/null printf x=1 x=1 readonly done test
+	&& done done 2>/dev/null "$@" export /usr/bin export
+	2>/dev/null && && "$1" 2>/dev/null ${HOME} | awk
+	"$@" test then --verbose 2>/dev/null "$@" grep ${HOME} awk printf
+	--verbose sed ${HOME} cd printf awk export
+/usr/bin /usr/bin echo grep -eu 'quoted text' done test x=1
+		| sed readonly awk x=1 sed sed export done "$@" "$1" 2>/dev/null --verbose
+	-eu sed && readonly x=1
+then x=1 then -eu readonly grep x=1 'quoted text'
+--verbose echo | $(pwd) ${HOME} ${HOME} /usr/bin 'quoted text' cd readonly $(pwd)
+	"$1" sed cd local then sed local 'quoted text' echo
+		${HOME} echo local "$@"
+/usr/bin sed "$@" cd echo "$@" --verbose "$1" cd
+	-eu awk --verbose local sed
+	2>/dev/null grep ${HOME} --verbose
+	"$@" export | grep --verbose then 2>/dev/null
+	-eu x=1 cd done then cd 'quoted text' then 2>/dev/null echo
+/usr/bin test $(pwd) ${HOME} "$@" ${HOME} readonly printf
+		echo echo x=1 then cd then 2>/dev/null grep
+	$(pwd) ${HOME} printf done sed "$@" then --verbose cd 2>/dev/null "$@" grep
+		sed printf x=1 cd cd --verbose awk /usr/bin
+local "$1" -eu then then ${HOME} 'quoted text'
+	'quoted text' 'quoted text' x=1 2>/dev/null x=1
+	local export grep then done then test done readonly "$@" echo
+local "$1" cd awk && done local
+		-eu local 'quoted text' x=1 sed readonly printf printf readonly -eu
+	&& $(pwd) then grep grep
+2>/dev/null ${HOME} printf
+		| 'quoted text' 'quoted text' --verbose cd --verbose done ${HOME}
+	printf printf awk | cd local
+	${HOME} x=1 "$@" awk grep
+local "$@" then "$@" /usr/bin /usr/bin done test awk | echo done 'quoted text'
+x=1 grep -eu $(pwd) then sed 'quoted text'
+$(pwd) test echo done | 'quoted text' "$@" /usr/bin grep "$1" then local
+	test done /usr/bin /usr/bin cd x=1
+		cd awk 'quoted text'
+${HOME} readonly then 'quoted text'
+done -eu $(pwd) "$@" ${HOME} "$1" | local printf --verbose 2>/dev/null "$@" "$@"
+		cd printf then x=1 x=1 grep export printf
+		$(pwd) done echo sed ${HOME} $(pwd) export export done 2>/dev/null 2>/dev/null
+	"$1" cd 2>/dev/null then
+	cd export awk printf 'quoted text'
+	${HOME} export awk printf
+		then && cd && 'quoted text' ${HOME} "$@" readonly "$1" -eu test
+		readonly printf | echo export
+test x=1 local printf export sed printf sed 'quoted text' 2>/dev/null 2>/dev/null
+		--verbose readonly local 2>/dev/null cd local && 'quoted text' "$@"
+	grep then 2>/dev/null cd ${HOME} "$1" 2>/dev/null x=1 export cd export
+	grep readonly 'quoted text' | then "$@" echo export
+	done "$1" echo then ${HOME} "$@" printf x=1 export grep x=1 readonly
+		'quoted text' "$1" $(pwd) readonly -eu cd --verbose test 'quoted text'
+	done grep sed /usr/bin printf 'quoted text' readonly grep awk 2>/dev/null
+	--verbose "$@" cd grep local cd echo
+x=1 --verbose ${HOME} x=1 "$@" readonly 'quoted text' echo
+		sed | x=1 -eu | echo $(pwd) "$@" -eu echo
+		awk grep readonly --verbose then $(pwd) |
+grep && sed 'quoted text' /usr/bin cd 'quoted text'
+-eu 2>/dev/null sed && export 2>/dev/null
+		| "$@" test && && 'quoted text' cd $(pwd) && readonly
+		| printf --verbose readonly && && cd /usr/bin printf "$@" test "$1" test
+	$(pwd) --verbose --verbose
+		${HOME} awk "$@" local readonly sed x=1 grep local grep -eu /usr/bin /usr/bin
+sed readonly grep 2>/dev/null sed then | test printf -eu readonly x=1 x=1 /usr/bin
+	2>/dev/null | awk /usr/bin export -eu printf awk x=1 "$1" -eu -eu 'quoted text'
+		2>/dev/null 2>/dev/null grep 2>/dev/null /usr/bin --verbose
+	"$1" readonly $(pwd) then then 2>/dev/null test 2>/dev/null --verbose
+		grep x=1 ${HOME} | 2>/dev/null $(pwd) x=1 | 2>/dev/null $(pwd) printf echo readonly
+test sed then then test export $(pwd) sed test done
+/usr/bin local local --verbose 2>/dev/null sed
+		--verbose -eu local export -eu
+	echo echo 'quoted text'
+	local readonly ${HOME} --verbose done then
+	cd 'quoted text' ${HOME} && | awk export /usr/bin test readonly "$1" readonly 'quoted text'
+test sed export "$1" && $(pwd)
+		&& export 'quoted text' $(pwd) cd sed export
+awk $(pwd) done printf awk -eu then readonly /usr/bin
+	then $(pwd) done printf ${HOME}
+grep && grep --verbose $(pwd) 2>/dev/null echo printf "$1" /usr/bin
+		sed ${HOME} done /usr/bin local
+| awk | test /usr/bin then readonly --verbose
+		'quoted text' readonly -eu
+"$1" 2>/dev/null sed grep "$1"
+	| sed readonly 2>/dev/null $(pwd) export then | $(pwd)
+		cd local then sed && --verbose export 2>/dev/null
+	echo test && ${HOME} 2>/dev/null 'quoted text'
+		echo done "$@" readonly $(pwd) "$@"
+	readonly --verbose --verbose cd 'quoted text' printf then -eu grep && ${HOME}
+	$(pwd) 'quoted text' -eu cd sed test local printf "$1"
+	| echo cd $(pwd) then export
+		$(pwd) export --verbose cd export grep echo 2>/dev/null
+		echo | awk test 'quoted text' 'quoted text'
+		grep "$1" && x=1 done local --verbose awk "$@"
+$(pwd) ${HOME} then grep --verbose 'quoted text' grep "$1" ${HOME} | cd done
+	awk "$@" "$1" cd awk export readonly local echo "$@"
+/usr/bin export local grep | local "$1" "$@" "$1" x=1 $(pwd)
+export printf readonly 'quoted text' /usr/bin cd | 'quoted text'
+	$(pwd) echo readonly local printf "$1" && 2>/dev/null done test grep local /usr/bin
+	local 'quoted text' test -eu $(pwd) -eu
+		2>/dev/null done awk 'quoted text'
+	2>/dev/null test awk --verbose grep readonly x=1 done echo && | echo x=1
+local awk cd local echo x=1 export
+	printf /usr/bin cd printf x=1 awk 'quoted text'
+		done test -eu sed && export local done echo 'quoted text' readonly grep sed grep
+		local "$1" -eu "$@" printf cd export ${HOME} -eu 'quoted text'
+	sed sed | ${HOME} x=1 readonly cd -eu ${HOME} printf | awk ${HOME} cd
+	awk readonly grep local | -eu readonly x=1 -eu -eu ${HOME}
+	&& grep -eu then echo done printf cd $(pwd) done "$@" -eu
+		printf x=1 -eu export && "$1" local -eu "$1"
+	sed readonly x=1 then --verbose awk | ${HOME} awk | export 'quoted text' then
+		| local 2>/dev/null "$1" local "$1" cd then x=1 ${HOME} awk 2>/dev/null export
+printf then readonly export printf "$@" local $(pwd)
+then sed "$@" export readonly 'quoted text' 'quoted text' "$@" local
+		--verbose | test 2>/dev/null
+2>/dev/null grep grep "$@" then | local ${HOME} echo "$1" /usr/bin test
+		grep -eu local "$@" | then test --verbose && local "$1" printf -eu export
+		sed $(pwd) $(pwd) printf cd local 2>/dev/null
+	then sed "$1" local "$@" local ${HOME} readonly
+		awk local local local awk sed export grep
+	sed export -eu done then done readonly "$1" 2>/dev/null
+${HOME} 2>/dev/null --verbose then x=1 cd &&
+local test 2>/dev/null export | cd test && && sed readonly -eu test cd -eu --verbose
+		-eu -eu 2>/dev/null local && 2>/dev/null --verbose done ${HOME}
+	local -eu readonly then grep export awk cd cd awk --verbose $(pwd) 'quoted text'
+		printf | awk "$1" export 'quoted text' readonly "$1"
+		grep cd --verbose | printf cd 2>/dev/null awk cd 'quoted text'
+	sed readonly "$@" sed -eu local done test
+	--verbose sed x=1 done awk done 'quoted text'
+"$@" sed done 2>/dev/null 2>/dev/null awk cd --verbose x=1 export | | --verbose
+	'quoted text' "$@" && test awk
+readonly local 2>/dev/null -eu export then printf local local
+"$@" "$1" printf "$@" then /usr/bin
+		awk printf "$1" done && 2>/dev/null && -eu 'quoted text' | 2>/dev/null
+		x=1 "$1" 'quoted text' x=1 2>/dev/null
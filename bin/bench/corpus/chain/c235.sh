@@ -0,0 +1,2001 @@
+		awk ${HOME} /usr/bin "$1" -eu local grep done /usr/bin
+awk 'quoted text' done export 2>/dev/null --verbose local
+		&& && awk ${HOME} $(pwd) export awk readonly awk awk "$1" echo cd && local x=1 -eu
+	done cd | -eu export /usr/bin &&
+		"$1" "$1" 'quoted text' echo readonly --verbose done sed
+	done $(pwd) printf --verbose grep
+		--verbose grep sed $(pwd) ${HOME} x=1 "$@" grep $(pwd) readonly |
+	printf then local 'quoted text' test done printf $(pwd) -eu 'quoted text'
+		local test && 'quoted text' grep --verbose
+	$(pwd) done "$@" -eu cd grep "$1" "$@"
+echo grep | cd /usr/bin readonly then printf test export
+	cd $(pwd) /usr/bin --verbose /usr/bin 2>/dev/null
+	echo $(pwd) "$1" test readonly
+		"$1" ${HOME} "$@" echo -eu done sed /usr/bin ${HOME} awk cd 'quoted text'
+		readonly then /usr/bin
+grep ${HOME} printf ${HOME} --verbose printf test export
+	printf printf cd --verbose test | --verbose --verbose --verbose
+	printf local sed test ${HOME} -eu then done printf &&
+	${HOME} local sed x=1 grep test $(pwd) --verbose
+		export 2>/dev/null ${HOME} 2>/dev/null -eu test $(pwd)
+	$(pwd) printf echo readonly
+	grep ${HOME} --verbose
+		-eu then readonly $(pwd) --verbose done $(pwd)
+		printf && /usr/bin --verbose --verbose export readonly "$@" test export
+	2>/dev/null test printf -eu 2>/dev/null
+export printf /usr/bin awk awk grep export
+		readonly export "$@" "$1" ${HOME} local done x=1 echo ${HOME} echo
+	then x=1 /usr/bin "$@" then "$@" then
+| x=1 2>/dev/null local $(pwd) grep 'quoted text' cd readonly
+	&& && 'quoted text' echo ${HOME}
+	x=1 echo | --verbose 2>/dev/null
+	awk 'quoted text' --verbose --verbose 'quoted text' readonly | ${HOME}
+	local then local /usr/bin -eu ${HOME} && cd sed ${HOME}
+cd sed && sed awk done $(pwd) 'quoted text' | $(pwd) readonly
+| "$@" -eu --verbose /usr/bin --verbose | 2>/dev/null
+/usr/bin echo local && $(pwd) x=1 | echo cd | ${HOME}
+	x=1 test /usr/bin 'quoted text' then done x=1 $(pwd) 'quoted text'
+	grep grep echo ${HOME} --verbose /usr/bin
+	&& printf printf then cd test -eu | $(pwd) "$@" | printf
+	2>/dev/null "$@" x=1 sed /usr/bin x=1 /usr/bin
+	2>/dev/null cd 'quoted text' printf local awk sed && && printf |
+		printf -eu then readonly export -eu "$1" | echo cd then ${HOME} then --verbose
+	${HOME} test $(pwd) "$1" printf ${HOME}
+-eu ${HOME} ${HOME} ${HOME} $(pwd) grep "$@" sed -eu
+		cd "$1" x=1 local local echo export
+awk done readonly then printf && readonly local
+		/usr/bin | 'quoted text' sed && 2>/dev/null
+		readonly && test -eu readonly
+	"$1" then grep $(pwd) done
+${HOME} "$@" done $(pwd) x=1 echo && 2>/dev/null
+--verbose x=1 ${HOME} --verbose
+		'quoted text' then export
+		&& x=1 'quoted text' local 2>/dev/null --verbose cd
+sed printf export test 'quoted text' done
+		test /usr/bin /usr/bin test export echo
+	--verbose cd grep then
+local ${HOME} && 'quoted text' 'quoted text' "$@" printf local "$1" printf grep
+	local grep ${HOME} echo 2>/dev/null
+		-eu awk 'quoted text' awk grep echo printf
+readonly test echo export sed
+cd echo "$@" 'quoted text' x=1 echo test readonly | export test | -eu "$1"
+	/usr/bin export /usr/bin cd done $(pwd) printf
+'quoted text' echo | "$1" "$@" cd $(pwd) ${HOME} done export x=1 awk done local
+		| 2>/dev/null -eu --verbose sed ${HOME} readonly local printf "$@" $(pwd) 2>/dev/null
+printf x=1 awk awk $(pwd) -eu /usr/bin
+export test && done && then then | $(pwd)
+	--verbose x=1 "$@" cd --verbose then
+		awk printf test 2>/dev/null "$@" printf cd local
+	--verbose echo "$@" done --verbose -eu $(pwd)
+	${HOME} "$1" ${HOME} /usr/bin cd ${HOME} grep readonly | export
+	echo -eu test "$1" echo grep
+		export ${HOME} | ${HOME} "$@" ${HOME} 'quoted text'
+test printf done printf printf printf 'quoted text'
+/usr/bin 'quoted text' cd awk then $(pwd) sed "$1"
+		test done --verbose 2>/dev/null | export | 'quoted text'
+	$(pwd) 2>/dev/null local ${HOME} grep awk cd done awk $(pwd)
+		readonly && grep 2>/dev/null export grep echo awk "$@"
+		$(pwd) export "$@" && cd 2>/dev/null
+		-eu "$@" --verbose "$@" ${HOME} readonly x=1 grep --verbose && test "$1"
+		/usr/bin local grep $(pwd) $(pwd) $(pwd) cd /usr/bin
+		printf 2>/dev/null --verbose export x=1 done sed
+	"$1" /usr/bin && x=1 /usr/bin $(pwd) local sed -eu /usr/bin
+		readonly -eu cd "$@" $(pwd) done "$@" echo awk awk "$1" printf
+	/usr/bin sed then grep grep done "$1"
+"$1" | printf local echo "$1" /usr/bin
+	| then -eu printf /usr/bin
+		cd "$1" "$1" export $(pwd) readonly && test awk grep
+		grep x=1 done echo echo sed then 2>/dev/null x=1 "$1" "$@" printf
+2>/dev/null then ${HOME} printf awk $(pwd) | --verbose
+		x=1 awk x=1 ${HOME} -eu echo --verbose
+echo grep local cd readonly
+	grep --verbose 2>/dev/null | --verbose awk then then
+/usr/bin "$1" done $(pwd) test | printf printf 'quoted text'
+&& 'quoted text' -eu echo /usr/bin 2>/dev/null sed $(pwd) 'quoted text' | local
+	"$@" 2>/dev/null && x=1 $(pwd) -eu then 2>/dev/null && local
+		export /usr/bin test -eu done
+		${HOME} test test 'quoted text' /usr/bin 'quoted text' awk
+awk && 'quoted text' echo ${HOME} then "$@" 'quoted text' --verbose
+grep awk cd "$1" printf ${HOME} --verbose cd awk readonly && x=1
+		sed 'quoted text' awk "$1" 2>/dev/null done awk
+-eu "$@" grep -eu done && local then /usr/bin
+	'quoted text' && echo local done "$@" done local
+	"$@" "$1" "$@" 'quoted text' $(pwd) "$@" printf
+| local echo done "$1" readonly export
+		"$@" local | $(pwd) grep then then then ${HOME} export
+	printf readonly echo cd done /usr/bin | "$1" then then 'quoted text' test && /usr/bin
+		test printf grep local | 'quoted text' readonly
+sed cd awk cd local grep local x=1 printf done -eu local 2>/dev/null ${HOME} printf
+		readonly local $(pwd) "$1" -eu -eu $(pwd) && done --verbose done "$@" |
+sed cd --verbose printf -eu echo sed done
+		2>/dev/null -eu grep /usr/bin grep
+	"$1" then -eu 'quoted text' && -eu printf cd grep "$1" printf
+/usr/bin -eu 'quoted text' grep --verbose x=1 grep done $(pwd) then | grep
+		$(pwd) printf printf grep test | x=1 -eu test export "$@"
+	printf sed readonly grep "$1" $(pwd) sed readonly
+cd then sed readonly ${HOME} "$1" | grep && $(pwd) 2>/dev/null sed grep && printf
+/usr/bin grep "$1" test ${HOME} "$@" then local export
+		sed awk test --verbose then awk local $(pwd)
+$(pwd) printf /usr/bin cd
+&& sed done local --verbose readonly test readonly cd
+"$1" | "$1" cd 2>/dev/null $(pwd)
+		--verbose done $(pwd) 'quoted text' sed 'quoted text'
+		${HOME} printf 'quoted text' ${HOME} local 'quoted text' /usr/bin
+		grep cd grep 2>/dev/null done echo "$@" awk printf
+		${HOME} | "$1" "$1" echo ${HOME} awk sed | test export 'quoted text'
+	'quoted text' $(pwd) -eu /usr/bin "$1" done "$@" ${HOME} && | /usr/bin "$@" echo
+		echo printf printf $(pwd) x=1 readonly readonly x=1 "$@" grep grep printf sed 2>/dev/null
+	sed /usr/bin "$@" awk "$@" grep x=1 grep readonly echo printf
+	"$@" x=1 -eu readonly --verbose --verbose then
+	grep then test then test x=1 test "$@" local cd /usr/bin
+then --verbose then local awk -eu "$@" x=1 test grep done --verbose
+cd "$1" -eu ${HOME} then && done | readonly
+	"$@" test printf test done then 'quoted text'
+	cd | sed 'quoted text' test
+-eu /usr/bin local echo awk readonly x=1 echo "$@"
+	echo && -eu test "$@"
+${HOME} grep export done /usr/bin --verbose 'quoted text'
+2>/dev/null readonly echo grep
+		grep "$@" cd | --verbose readonly test test ${HOME} grep
+echo echo cd then | "$1" $(pwd) 'quoted text'
+	2>/dev/null printf test /usr/bin x=1 2>/dev/null printf
+	"$1" --verbose /usr/bin 'quoted text' x=1 test local $(pwd) grep "$1" -eu printf
+| local echo done | cd done 'quoted text'
+		test grep x=1 awk --verbose && $(pwd)
+		/usr/bin readonly x=1 "$1" test then printf 'quoted text'
+		export awk ${HOME} local printf 'quoted text' sed
+	test local then "$@" done 2>/dev/null ${HOME} test "$1" -eu
+	echo ${HOME} -eu --verbose "$1" 'quoted text' -eu
+		&& then "$@" -eu grep -eu /usr/bin
+		&& then echo --verbose sed | export cd readonly export then printf awk then --verbose
+		readonly local 'quoted text' echo | awk awk --verbose x=1 then sed
+	export local && 2>/dev/null export 'quoted text'
+	-eu -eu "$1" readonly --verbose 'quoted text'
+x=1 /usr/bin "$@" && "$@" grep echo /usr/bin printf done ${HOME} "$@" x=1 export
+	${HOME} test && grep awk | x=1 cd export grep local | local -eu
+	/usr/bin readonly "$1" cd grep echo /usr/bin && $(pwd) "$1" -eu grep $(pwd) grep
+		grep local "$@" sed -eu test printf x=1 "$@" /usr/bin echo "$1" test ${HOME}
+	readonly $(pwd) "$@" grep /usr/bin local $(pwd) grep --verbose -eu 'quoted text'
+		-eu 'quoted text' ${HOME} /usr/bin then -eu --verbose then
+		cd "$@" 2>/dev/null done 2>/dev/null
+		test "$@" then && done "$1"
+	local local echo printf printf cd 2>/dev/null -eu | ${HOME} "$@" export echo x=1
+		readonly "$@" | /usr/bin x=1 export awk && cd export sed 2>/dev/null /usr/bin
+cd echo then 'quoted text' "$1" then readonly sed $(pwd)
+		test | export $(pwd) "$@" /usr/bin "$@" grep --verbose --verbose
+		/usr/bin cd sed echo /usr/bin --verbose
+		2>/dev/null 2>/dev/null echo |
+/usr/bin grep export sed --verbose
+		done -eu 2>/dev/null local && local echo printf then "$1"
+		'quoted text' test awk
+	echo "$1" 'quoted text' 'quoted text'
+	'quoted text' grep export local echo done
+		cd export readonly /usr/bin
+	local /usr/bin done && --verbose 'quoted text'
+	2>/dev/null export 2>/dev/null $(pwd) && export then cd x=1 printf readonly
+		local $(pwd) echo sed ${HOME} readonly done "$1"
+readonly /usr/bin && then x=1 | $(pwd) local awk echo
+		export local test --verbose && 'quoted text' && done /usr/bin
+--verbose local export sed 2>/dev/null sed "$1" test "$1" export
+	readonly 'quoted text' x=1 -eu grep x=1
+		done done local 'quoted text' echo test export | ${HOME} -eu $(pwd) printf
+	${HOME} readonly "$@" echo "$1" --verbose x=1
+	echo readonly printf printf echo | test export 2>/dev/null
+		cd export export awk -eu 2>/dev/null export printf
+		cd readonly readonly test test sed done
+		x=1 "$@" /usr/bin grep then
+echo x=1 local | ${HOME} $(pwd) /usr/bin grep &&
+		test test $(pwd) cd export /usr/bin done 'quoted text'
+"$1" echo "$1" local ${HOME} ${HOME} $(pwd) readonly printf --verbose
+$(pwd) echo local grep && local "$@" && echo export /usr/bin 'quoted text'
+		'quoted text' sed ${HOME} "$1" local $(pwd) done grep && grep
+	sed "$1" 2>/dev/null "$@"
+	readonly --verbose 'quoted text' 'quoted text'
+		--verbose ${HOME} --verbose local printf x=1 awk cd ${HOME} echo
+readonly local x=1 'quoted text' --verbose test grep 2>/dev/null "$1" "$1" |
+-eu export test sed done done echo then "$1" done sed
+		${HOME} 'quoted text' then && $(pwd) "$@" grep cd $(pwd) |
+	${HOME} x=1 cd x=1 done ${HOME} awk grep sed sed echo -eu ${HOME} --verbose
+export 2>/dev/null 2>/dev/null
+	sed -eu -eu x=1 printf 'quoted text' sed "$1" && awk
+x=1 test export awk cd --verbose
+		-eu $(pwd) 2>/dev/null --verbose x=1 2>/dev/null printf then x=1 readonly
+		| | "$1" "$1" "$1" then $(pwd) x=1
+${HOME} export "$@" export cd ${HOME} readonly test test ${HOME} x=1 printf
+export local && "$1" "$@"
+	$(pwd) export ${HOME} export "$@" local | && && /usr/bin done local "$1" printf
+	printf test echo -eu grep /usr/bin -eu export printf
+-eu grep "$@" $(pwd) /usr/bin "$@" "$1" 2>/dev/null test
+export test done 'quoted text' /usr/bin 'quoted text' local
+		readonly | -eu test -eu && /usr/bin local test echo && readonly sed grep
+		${HOME} | printf cd then $(pwd) "$@" done x=1 | echo 2>/dev/null
+test 'quoted text' 'quoted text' printf local "$1" x=1 test cd cd then local cd
+	done "$1" && && readonly ${HOME} awk printf done && 2>/dev/null
+	$(pwd) x=1 readonly echo x=1 && $(pwd) then && readonly 'quoted text' -eu
+printf /usr/bin echo "$1" $(pwd) readonly test && local done readonly ${HOME}
+		&& readonly 'quoted text' cd done | awk | then done
+		${HOME} local /usr/bin "$1" then && $(pwd) | sed
+| export awk test test test sed "$@" done readonly 'quoted text'
+readonly /usr/bin $(pwd) awk done local --verbose readonly
+x=1 printf 2>/dev/null --verbose cd 'quoted text'
+done 'quoted text' test --verbose done -eu 2>/dev/null done echo
+		/usr/bin | test echo $(pwd) && -eu test local 2>/dev/null && sed $(pwd)
+local ${HOME} -eu cd ${HOME} test test -eu cd -eu && export then readonly ${HOME}
+| readonly 'quoted text'
+		$(pwd) done printf export --verbose readonly 'quoted text' done printf
+local && echo 'quoted text' /usr/bin readonly sed echo echo x=1 readonly
+		echo "$1" --verbose && sed cd -eu --verbose -eu sed grep echo cd grep
+2>/dev/null export readonly then /usr/bin
+${HOME} 'quoted text' --verbose | echo -eu test 2>/dev/null
+		sed sed awk grep ${HOME} 2>/dev/null export 'quoted text'
+	test printf -eu ${HOME} cd
+	x=1 printf printf "$1" 2>/dev/null
+		2>/dev/null then cd done
+--verbose done && --verbose /usr/bin --verbose /usr/bin awk export
+	-eu 2>/dev/null x=1 readonly &&
+		"$1" "$1" printf 2>/dev/null export local export --verbose
+	${HOME} x=1 readonly "$1" 2>/dev/null
+/usr/bin $(pwd) ${HOME} && grep -eu 'quoted text' -eu "$1" ${HOME} 2>/dev/null x=1
+		"$1" cd $(pwd) "$@" local grep "$1"
+"$1" | readonly readonly test echo &&
+	2>/dev/null echo echo --verbose
+		2>/dev/null printf && 2>/dev/null sed | ${HOME}
+		awk then 'quoted text' $(pwd) | cd ${HOME} grep test "$1"
+done "$@" sed 2>/dev/null $(pwd) | readonly --verbose
+	cd "$@" then local then done
+	export | | /usr/bin --verbose awk "$@" cd 'quoted text' --verbose readonly "$1"
+'quoted text' readonly -eu echo $(pwd) cd grep local then local echo x=1
+		'quoted text' 'quoted text' done
+-eu test export export 'quoted text'
+		--verbose export local $(pwd) && && echo grep
+		| ${HOME} test 2>/dev/null
+		printf /usr/bin awk sed test done printf
+	grep ${HOME} test -eu && $(pwd) 'quoted text'
+		--verbose 'quoted text' export echo readonly -eu export awk readonly export
+		done grep && && echo "$1" then "$@" x=1 local --verbose && readonly "$1"
+	| --verbose awk $(pwd) export $(pwd) -eu /usr/bin /usr/bin x=1 /usr/bin readonly
+grep local echo --verbose && sed
+	&& --verbose && $(pwd) readonly -eu && 'quoted text' x=1 echo /usr/bin printf
+$(pwd) done sed readonly printf && sed grep x=1 'quoted text'
+		cd cd /usr/bin test ${HOME} readonly echo
+	echo export cd local /usr/bin cd echo
+	printf awk | /usr/bin export 'quoted text' readonly x=1 then grep 'quoted text'
+&& awk "$@" done && printf 2>/dev/null printf export readonly sed ${HOME}
+		"$1" $(pwd) && awk sed local --verbose
+		"$@" --verbose echo "$@" test x=1 $(pwd) "$1" | | printf
+		then printf x=1 readonly --verbose "$@" echo --verbose --verbose
+		cd | done done then done ${HOME} "$1" /usr/bin |
+		cd -eu done printf echo echo local test
+		local done sed 2>/dev/null ${HOME} printf x=1 done -eu then "$@"
+	--verbose x=1 then local readonly awk "$@" done
+readonly /usr/bin then "$1" then $(pwd) ${HOME} echo -eu --verbose sed
+	awk echo readonly ${HOME} cd $(pwd) sed readonly 2>/dev/null
+${HOME} | ${HOME} then export printf --verbose 2>/dev/null
+cd readonly awk awk export
+	done 2>/dev/null grep -eu "$1" echo grep $(pwd) test export sed --verbose printf
+	$(pwd) "$1" test 'quoted text' local
+		| test printf grep "$1" | done then test 'quoted text' cd "$1" "$@"
+		2>/dev/null /usr/bin ${HOME}
+	"$@" export 2>/dev/null "$1" readonly
+	x=1 cd $(pwd) grep 2>/dev/null --verbose
+		done cd cd -eu cd | grep
+	"$@" && 2>/dev/null 'quoted text' grep
+	export grep x=1 readonly && | awk 2>/dev/null export cd grep readonly cd
+	local -eu /usr/bin ${HOME} ${HOME} 'quoted text' local readonly 2>/dev/null
+echo $(pwd) awk printf readonly -eu x=1 && grep readonly --verbose cd -eu
+/usr/bin then then cd local awk && local test local test && $(pwd)
+sed -eu printf export "$@" test "$@" | ${HOME} sed 'quoted text' |
+printf done | /usr/bin then cd local
+	-eu test local printf then export $(pwd)
+'quoted text' x=1 export "$@" echo
+	--verbose readonly ${HOME} test x=1
+		${HOME} test | done printf readonly "$@"
+cd --verbose x=1 x=1 awk sed sed sed readonly
+	awk then printf && "$1" && export
+		--verbose test echo grep
+x=1 2>/dev/null local cd local grep local "$1" awk --verbose
+	then then printf test x=1 && test readonly -eu printf awk 2>/dev/null
+		/usr/bin done test export export | readonly cd /usr/bin
+sed readonly 2>/dev/null printf | ${HOME} printf
+	export && done readonly echo awk ${HOME} x=1
+		-eu 2>/dev/null cd x=1 local grep sed awk done "$@" && "$1" grep $(pwd)
+	${HOME} printf done local --verbose printf
+		readonly then echo awk export
+	awk then local then done | /usr/bin
+		sed "$1" local ${HOME} | cd && awk && readonly -eu /usr/bin
+	echo printf local $(pwd) cd --verbose ${HOME} export local
+		--verbose && cd "$@" test $(pwd) sed "$@" printf | | $(pwd) export done echo
+		grep then test 'quoted text' && /usr/bin test
+-eu | grep done cd cd /usr/bin grep grep export cd && printf echo
+		"$1" 'quoted text' 'quoted text' sed grep 'quoted text'
+x=1 -eu done awk --verbose cd test
+	done test -eu cd | sed
+${HOME} export grep x=1 then echo "$@" 'quoted text'
+		| cd "$1" sed /usr/bin cd "$1" echo export then
+-eu sed 2>/dev/null "$1" cd x=1 local sed sed "$@" $(pwd) ${HOME}
+		grep --verbose /usr/bin cd readonly readonly 'quoted text'
+		sed | 2>/dev/null "$@" "$1" echo done printf x=1 'quoted text'
+	echo test awk /usr/bin "$@" sed export readonly cd ${HOME}
+		--verbose local 'quoted text' local
+${HOME} cd $(pwd) "$1" printf 2>/dev/null "$1" local "$1" "$@" --verbose sed "$1"
+	then sed then test then echo grep | -eu cd test --verbose cd 'quoted text' local
+		-eu && && && "$1" | done grep done local | "$1" && /usr/bin sed
+&& test printf -eu printf -eu x=1 test && "$@" cd $(pwd) 'quoted text' $(pwd)
+	/usr/bin /usr/bin cd sed $(pwd) sed 2>/dev/null
+		grep && done -eu "$1" "$1" "$@" 'quoted text'
+	echo cd | done $(pwd) echo done ${HOME} echo x=1 awk "$1"
+		sed test export $(pwd) printf test $(pwd) then then cd
+		done local 'quoted text' test awk test grep sed grep
+	'quoted text' $(pwd) local -eu x=1 x=1 export echo -eu readonly sed 2>/dev/null
+		sed cd | "$1" ${HOME} echo $(pwd) readonly -eu test done "$@"
+"$@" | echo sed "$1" --verbose 2>/dev/null echo 2>/dev/null
+		x=1 x=1 "$1" done cd readonly done printf ${HOME} printf
+| "$@" local $(pwd) done -eu ${HOME}
+	awk test 2>/dev/null "$1" -eu done ${HOME}
+	local 2>/dev/null grep cd -eu 2>/dev/null "$1" printf
+	&& -eu readonly "$1" local 2>/dev/null
+		2>/dev/null then /usr/bin then ${HOME} grep $(pwd)
+	2>/dev/null ${HOME} test /usr/bin grep -eu -eu "$@"
+	done echo sed readonly /usr/bin 'quoted text' "$1" && 'quoted text' /usr/bin
+	${HOME} test cd 2>/dev/null 'quoted text' done
+	2>/dev/null && test x=1 awk 'quoted text' sed grep && test $(pwd) "$1"
+	local echo --verbose "$@" | /usr/bin
+	awk local awk awk grep "$1"
+	${HOME} -eu then "$@" --verbose
+		'quoted text' --verbose readonly export done
+		echo -eu && && printf test
+		readonly ${HOME} "$1" export readonly ${HOME}
+		/usr/bin "$@" && --verbose
+export 'quoted text' $(pwd) echo ${HOME} 'quoted text'
+	/usr/bin echo | cd echo "$1" x=1 -eu 'quoted text'
+		-eu local x=1 then done "$1" then done /usr/bin -eu sed export "$1" -eu
+		&& x=1 grep grep -eu 2>/dev/null
+		local echo -eu cd readonly awk export then cd 'quoted text'
+${HOME} "$1" ${HOME} ${HOME} ${HOME} 'quoted text' sed &&
+export test awk x=1 grep sed done test
+		then | grep -eu local done x=1 /usr/bin x=1 "$@"
+$(pwd) sed --verbose "$@" 2>/dev/null $(pwd) "$1" export ${HOME} done
+	cd --verbose then printf test printf grep /usr/bin export sed cd export /usr/bin
+	cd cd /usr/bin echo local
+		/usr/bin "$1" --verbose local export
+		x=1 'quoted text' grep local export grep | | echo done --verbose
+		-eu && -eu local -eu --verbose 'quoted text' grep 2>/dev/null ${HOME} ${HOME}
+printf 'quoted text' "$@" awk local -eu /usr/bin then
+cd /usr/bin ${HOME} 2>/dev/null export --verbose
+		| x=1 readonly export 'quoted text' -eu local ${HOME} 2>/dev/null ${HOME} sed
+	echo readonly "$1" 2>/dev/null test --verbose /usr/bin
+--verbose echo echo export --verbose | ${HOME} && export test "$1"
+grep readonly sed grep $(pwd) local grep local printf ${HOME} ${HOME} | 'quoted text'
+	-eu grep done echo sed ${HOME} echo printf local grep echo | ${HOME} "$@"
+local --verbose grep awk 'quoted text'
+		/usr/bin && readonly
+--verbose ${HOME} 2>/dev/null local
+		x=1 export "$1" done readonly "$@" $(pwd) export /usr/bin readonly sed
+2>/dev/null /usr/bin printf
+		export --verbose readonly then --verbose echo
+		test echo && 'quoted text' 2>/dev/null -eu awk 2>/dev/null
+	--verbose x=1 cd export 'quoted text'
+	"$1" | sed cd awk --verbose | done cd echo 2>/dev/null &&
+	local sed -eu echo && $(pwd) /usr/bin grep cd && printf --verbose 'quoted text'
+	sed then printf && then --verbose export done then
+2>/dev/null "$@" awk test /usr/bin
+&& -eu && local ${HOME} 'quoted text' "$1" ${HOME} echo
+		"$1" done ${HOME} test -eu export test --verbose then && then x=1
+		grep local readonly readonly
+	printf | -eu $(pwd) local awk ${HOME} test local test
+done readonly readonly local test cd 'quoted text' test $(pwd) ${HOME}
+x=1 done 2>/dev/null /usr/bin echo export grep -eu 'quoted text' sed "$@"
+		2>/dev/null "$1" sed readonly readonly export -eu done awk then done
+2>/dev/null 'quoted text' -eu 2>/dev/null
+		local 2>/dev/null echo test --verbose $(pwd) -eu 2>/dev/null
+	cd printf echo local | | /usr/bin grep sed then 'quoted text'
+		export "$@" grep export
+	"$@" sed -eu readonly grep local local sed "$@" export
+		then $(pwd) grep $(pwd) $(pwd)
+	export --verbose then -eu cd ${HOME} --verbose /usr/bin readonly $(pwd)
+2>/dev/null "$@" local sed --verbose
+grep --verbose 2>/dev/null done readonly x=1 'quoted text' export awk cd "$@" "$1"
+		2>/dev/null then done readonly done 'quoted text'
+		local -eu printf readonly readonly --verbose
+		x=1 then sed 'quoted text' cd "$1" ${HOME} then && cd export x=1 $(pwd)
+	2>/dev/null ${HOME} readonly "$@" test local sed --verbose "$@" local
+		&& export then ${HOME} $(pwd) $(pwd) export --verbose grep &&
+	2>/dev/null local readonly grep --verbose then then readonly
+		echo ${HOME} grep printf then "$1" test sed "$@" then awk sed -eu 2>/dev/null
+		readonly 2>/dev/null $(pwd) printf then test --verbose $(pwd) "$1"
+2>/dev/null local | -eu x=1 grep 'quoted text' export
+cd x=1 2>/dev/null --verbose "$1" ${HOME} export
+done $(pwd) then cd done
+	readonly && | printf
+sed readonly then export export
+	"$@" readonly export "$@" x=1 printf
+		"$1" -eu export awk echo --verbose 2>/dev/null /usr/bin printf
+	grep awk done test awk cd
+awk --verbose -eu $(pwd) -eu readonly "$1" /usr/bin printf readonly then
+	"$1" readonly ${HOME} -eu grep echo 'quoted text' local
+echo local sed "$1" sed -eu ${HOME} --verbose cd grep readonly grep 'quoted text'
+	then printf awk done | "$@" readonly readonly --verbose test $(pwd) done 2>/dev/null
+	then -eu grep readonly printf | echo awk cd && sed cd | $(pwd) grep --verbose
+	done "$1" 'quoted text' cd 'quoted text' 2>/dev/null |
+export grep 'quoted text' x=1 --verbose /usr/bin awk
+| local test --verbose x=1 sed 'quoted text' /usr/bin grep --verbose awk
+	-eu | sed export && -eu then awk "$1" awk
+		readonly echo done awk && "$@" local && awk $(pwd) x=1 --verbose -eu --verbose
+echo local | 'quoted text' readonly
+	grep readonly cd export x=1 &&
+--verbose cd | "$@" --verbose
+	test awk $(pwd) then "$@" grep
+local sed | --verbose /usr/bin echo ${HOME}
+		export | printf -eu | | then --verbose grep --verbose done cd && awk
+	grep done test sed --verbose readonly ${HOME} | echo ${HOME} test | echo x=1 |
+		${HOME} 'quoted text' --verbose
+then done grep && /usr/bin grep && | cd "$1" awk cd sed "$1" awk
+		echo echo | $(pwd) 'quoted text' export 2>/dev/null
+| "$1" "$@" then export readonly && $(pwd) /usr/bin
+		echo ${HOME} grep readonly local "$@" awk
+		export then 2>/dev/null export x=1 readonly $(pwd) &&
+sed x=1 test 2>/dev/null -eu 'quoted text'
+	$(pwd) local && "$@" "$1" "$1" local done done /usr/bin then /usr/bin
+x=1 readonly sed "$@" ${HOME} /usr/bin 'quoted text'
+	2>/dev/null 'quoted text' local printf ${HOME} test echo sed "$1" readonly
+		$(pwd) export 'quoted text' test cd
+readonly echo cd 'quoted text' /usr/bin "$@" 2>/dev/null export
+	printf grep -eu echo
+	printf ${HOME} -eu echo x=1
+	printf "$1" grep "$@" 'quoted text' test $(pwd)
+	export local 2>/dev/null then echo then x=1 readonly echo x=1 'quoted text' $(pwd)
+	sed cd x=1 ${HOME} --verbose "$1" readonly "$@"
+		then sed --verbose awk $(pwd) awk 'quoted text'
+	--verbose then readonly
+then awk echo awk | && sed readonly -eu cd sed | local done then printf cd echo
+/usr/bin done readonly | awk --verbose awk then readonly done | | /usr/bin
+		${HOME} && echo 'quoted text' export
+		&& export done awk test /usr/bin printf | /usr/bin |
+	done x=1 export local local test printf /usr/bin test /usr/bin && $(pwd)
+x=1 | then "$1" grep ${HOME} awk | readonly && /usr/bin && sed echo
+	readonly readonly cd --verbose | export printf "$@" test | readonly -eu
+		-eu --verbose /usr/bin export local | | -eu printf $(pwd) echo printf done "$1"
+	then ${HOME} "$1" ${HOME} 'quoted text' --verbose x=1 grep | then local $(pwd)
+	${HOME} "$@" grep 'quoted text' local export
+		export | export awk then 2>/dev/null
+echo then cd readonly grep
+	/usr/bin -eu then test cd $(pwd) cd x=1
+		| test echo readonly done 2>/dev/null -eu cd cd printf && /usr/bin done
+	2>/dev/null done printf echo --verbose
+		'quoted text' x=1 2>/dev/null printf test awk 2>/dev/null readonly
+	x=1 then printf printf -eu
+grep done 'quoted text' grep
+-eu echo readonly cd "$@" cd /usr/bin
+-eu ${HOME} --verbose awk $(pwd) printf then export 2>/dev/null $(pwd) /usr/bin
+		$(pwd) "$@" readonly then readonly test &&
+		echo --verbose -eu "$1" sed printf local -eu printf
+		test done readonly grep then x=1 cd ${HOME} grep cd -eu test -eu local
+	readonly "$1" export awk done test | printf
+	printf -eu export 'quoted text' awk 2>/dev/null printf -eu 'quoted text'
+	export export done $(pwd) awk 'quoted text'
+"$@" 2>/dev/null /usr/bin done cd local
+&& -eu && printf test
+sed sed $(pwd) --verbose "$1" | /usr/bin readonly -eu /usr/bin && awk
+		awk done --verbose grep echo /usr/bin grep
+		2>/dev/null "$@" /usr/bin sed 2>/dev/null && "$1" && -eu test | printf
+-eu 2>/dev/null then then /usr/bin $(pwd) /usr/bin "$@"
+	x=1 'quoted text' --verbose -eu "$@" test grep "$@" awk
+		/usr/bin local sed ${HOME} "$1" awk "$@" done 2>/dev/null
+"$1" awk done --verbose $(pwd) then printf then $(pwd) "$1" export done readonly
+"$@" 'quoted text' printf
+	then 2>/dev/null /usr/bin sed ${HOME} x=1 && echo 'quoted text'
+${HOME} sed | ${HOME} cd test x=1 x=1 && $(pwd) sed $(pwd)
+2>/dev/null printf --verbose 2>/dev/null readonly awk && export export $(pwd)
+$(pwd) sed sed | --verbose x=1 export | 'quoted text'
+		awk $(pwd) export $(pwd) /usr/bin printf $(pwd) grep echo done "$@" | "$@"
+grep 'quoted text' ${HOME} x=1 local cd awk awk /usr/bin export
+	"$1" --verbose | /usr/bin --verbose cd 'quoted text' x=1 readonly sed
+		-eu 'quoted text' printf "$@" /usr/bin readonly | /usr/bin then 2>/dev/null export
+cd export readonly && -eu grep test cd local
+		printf local $(pwd) &&
+		x=1 "$@" export cd done printf ${HOME}
+2>/dev/null awk 2>/dev/null readonly echo
+test then && grep done echo export
+readonly -eu ${HOME} awk x=1 $(pwd) /usr/bin local --verbose
+"$@" 'quoted text' export /usr/bin 'quoted text' $(pwd) ${HOME} sed 'quoted text'
+	-eu export echo && "$1" export | then "$@" -eu /usr/bin echo printf
+	then sed && $(pwd) export echo echo printf then export -eu
+"$1" test ${HOME} printf | cd cd echo
+export $(pwd) "$@" done | /usr/bin grep
+		2>/dev/null "$1" local x=1 awk then sed 'quoted text' echo x=1 cd 'quoted text'
+local grep local -eu | | sed grep -eu cd && && awk --verbose export readonly export
+	&& then grep awk sed /usr/bin | "$1" 2>/dev/null
+		&& then /usr/bin echo readonly "$@" done "$@" cd 2>/dev/null && | "$1"
+	printf then printf readonly printf 'quoted text' sed 2>/dev/null sed x=1 $(pwd)
+		| 'quoted text' /usr/bin then && grep cd export grep
+	${HOME} printf $(pwd) grep printf
+		readonly 'quoted text' --verbose --verbose ${HOME} | x=1
+		x=1 --verbose --verbose sed
+	sed awk then /usr/bin then printf --verbose
+	"$1" done echo export -eu && | local | | -eu test printf ${HOME} $(pwd)
+	'quoted text' "$@" export then cd $(pwd) | readonly echo test test --verbose ${HOME}
+printf 2>/dev/null test 2>/dev/null local awk export | $(pwd) grep && done
+		'quoted text' local cd readonly done done printf | printf readonly
+	/usr/bin "$@" ${HOME} awk "$@" grep readonly
+		&& "$1" 2>/dev/null "$1" /usr/bin test awk printf sed export -eu
+	test echo then export | --verbose readonly 'quoted text' 'quoted text'
+test then $(pwd) test export 2>/dev/null /usr/bin -eu readonly 2>/dev/null
+		awk awk done -eu done cd export awk grep ${HOME} readonly 'quoted text'
+		"$1" echo awk grep local "$@" $(pwd) x=1 | done
+	"$@" readonly cd grep ${HOME} "$1" test done | echo ${HOME} $(pwd)
+	"$@" local 'quoted text' $(pwd) sed awk done x=1 export local x=1 printf
+	local "$1" --verbose | /usr/bin export 2>/dev/null && -eu echo then readonly
+cd then $(pwd) done "$@" -eu --verbose
+| local then 2>/dev/null export test grep cd "$@" -eu echo 'quoted text'
+then printf x=1 done readonly
+		export $(pwd) | readonly sed grep sed --verbose grep export printf then done awk
+	then 'quoted text' -eu local
+	--verbose test cd test awk && $(pwd) printf 2>/dev/null ${HOME} grep
+		x=1 local x=1 "$1" done printf 2>/dev/null 'quoted text'
+	test "$@" $(pwd) awk echo -eu $(pwd)
+		readonly export | $(pwd) 'quoted text' "$@" printf 2>/dev/null 2>/dev/null 2>/dev/null
+	x=1 printf 2>/dev/null echo local -eu export local local then cd echo x=1 $(pwd)
+	| "$@" 'quoted text' "$1" ${HOME} $(pwd) readonly
+		-eu -eu grep local local "$1" "$@" "$1" echo test
+	${HOME} cd --verbose printf cd && echo /usr/bin grep done | && 'quoted text'
+sed printf grep 2>/dev/null --verbose local
+	test && 2>/dev/null "$@" cd done done then export $(pwd) "$1"
+	$(pwd) grep awk $(pwd) test 'quoted text'
+	local cd /usr/bin "$@" 'quoted text' local
+/usr/bin export --verbose
+2>/dev/null $(pwd) /usr/bin | test grep test readonly awk 'quoted text' done sed
+local && /usr/bin awk |
+	then grep /usr/bin then test local export "$@"
+	'quoted text' -eu 'quoted text' printf /usr/bin "$@" x=1 local test echo
+	-eu 'quoted text' "$1" | test /usr/bin awk 2>/dev/null cd $(pwd) readonly
+	-eu && echo test cd 2>/dev/null grep x=1 $(pwd)
+cd 'quoted text' $(pwd) test "$1" && && echo ${HOME} printf
+local "$@" "$1" --verbose test $(pwd)
+	${HOME} | awk -eu awk printf printf test then
+printf -eu /usr/bin x=1 export
+		export "$1" cd 2>/dev/null local readonly test cd then
+cd export /usr/bin 'quoted text' export x=1 printf then &&
+		--verbose local /usr/bin "$1" "$@" | /usr/bin
+	then -eu printf $(pwd) x=1 /usr/bin "$1"
+		sed "$1" cd ${HOME} && "$1" sed $(pwd) grep cd
+x=1 local && printf export /usr/bin /usr/bin cd "$@" x=1 ${HOME}
+		"$@" 2>/dev/null 'quoted text' grep cd then --verbose "$@" awk local
+then test x=1 cd | test "$@" export readonly local awk sed &&
+grep readonly "$@" echo "$@" then 2>/dev/null
+		| 'quoted text' --verbose readonly sed local echo x=1 done x=1
+		test 'quoted text' local 2>/dev/null
+		sed then x=1 then --verbose $(pwd)
+| | cd sed -eu readonly export 2>/dev/null printf
+		local -eu "$@" done x=1 awk
+awk /usr/bin cd awk -eu local | readonly && "$1" x=1 sed sed then "$1" /usr/bin
+		printf && cd echo ${HOME} done done cd /usr/bin 'quoted text' local | sed
+		done readonly then ${HOME} 2>/dev/null -eu
+2>/dev/null 'quoted text'
+'quoted text' "$1" then "$@" && then
+&& cd grep $(pwd) test printf readonly echo
+		readonly echo ${HOME} "$@" cd test x=1 local "$@" test local $(pwd)
+		"$@" x=1 $(pwd) awk 'quoted text'
+then "$1" 2>/dev/null test printf -eu && awk 'quoted text' grep test
+awk awk then export local sed readonly && -eu done done
+-eu test "$@" test test /usr/bin | "$@" printf test "$@" | "$@"
+x=1 | local 2>/dev/null
+2>/dev/null $(pwd) x=1 x=1 done awk 'quoted text' -eu 2>/dev/null "$1" -eu
+	printf && 2>/dev/null echo "$@" then --verbose x=1 ${HOME} done local "$@"
+'quoted text' grep "$@" x=1 2>/dev/null local ${HOME} grep
+		2>/dev/null 2>/dev/null awk -eu then awk 'quoted text' local
+	2>/dev/null export --verbose /usr/bin echo 'quoted text'
+local test -eu x=1 readonly -eu printf ${HOME} "$@" $(pwd)
+	then "$1" && "$@" x=1 x=1 grep 2>/dev/null echo then 2>/dev/null |
+	test $(pwd) export test cd test $(pwd)
+2>/dev/null && test done 2>/dev/null
+	echo /usr/bin done grep --verbose
+	/usr/bin $(pwd) done test grep "$@" export -eu 2>/dev/null &&
+	export "$@" $(pwd) readonly sed readonly 2>/dev/null local
+echo local sed && export --verbose echo | && cd -eu $(pwd) export --verbose sed
+| "$@" readonly then sed
+		x=1 local "$@" $(pwd) test grep then done "$@" printf | echo grep test &&
+export ${HOME} readonly printf
+sed 2>/dev/null -eu 'quoted text'
+		x=1 printf "$@" 'quoted text' local test grep then awk awk then test x=1
+"$1" 2>/dev/null /usr/bin grep 'quoted text' cd echo sed 'quoted text'
+test export --verbose local
+		export x=1 "$1" "$1" x=1 grep done x=1 local "$@" awk cd
+sed echo cd "$1" x=1 x=1 awk printf local cd cd $(pwd) cd "$@" ${HOME}
+	'quoted text' printf | printf | && $(pwd) echo test printf
+	test "$@" "$1" sed /usr/bin test echo printf /usr/bin
+&& 2>/dev/null sed sed sed done awk then
+&& 'quoted text' $(pwd) /usr/bin
+awk ${HOME} "$@" -eu sed awk echo x=1 | "$@" && then
+		readonly x=1 && test $(pwd) /usr/bin test "$1" printf printf 2>/dev/null | printf
+	test test test /usr/bin 'quoted text' cd x=1 done ${HOME}
+readonly cd local -eu sed readonly awk "$@" 2>/dev/null /usr/bin local
+		grep local done | 'quoted text' ${HOME}
+		/usr/bin | awk cd && 2>/dev/null awk x=1 ${HOME} grep ${HOME} x=1
+	then cd --verbose echo readonly /usr/bin $(pwd) /usr/bin local echo
+		"$1" | grep readonly | test then
+		-eu "$1" then "$1" then $(pwd) ${HOME} local
+readonly echo $(pwd) awk echo sed export -eu $(pwd) grep && awk x=1 --verbose
+		"$1" -eu -eu /usr/bin && "$1"
+	| x=1 'quoted text' awk echo grep "$@" "$@" then grep echo 'quoted text'
+export "$1" x=1 | echo $(pwd) readonly cd -eu "$@"
+	then -eu "$@" readonly awk awk "$1" 2>/dev/null done grep 2>/dev/null
+	readonly done /usr/bin "$1" awk "$@" export readonly echo then
+		cd awk cd then done done && -eu then "$@" x=1 readonly done
+	local export local test ${HOME} 2>/dev/null | export printf
+		-eu grep 'quoted text' export 2>/dev/null $(pwd) -eu sed
+		/usr/bin --verbose /usr/bin 'quoted text'
+	readonly 'quoted text' "$1" "$1" /usr/bin x=1 cd | 'quoted text' done
+/usr/bin sed done x=1 --verbose -eu 'quoted text' /usr/bin "$1" then ${HOME} grep
+	&& 2>/dev/null ${HOME} ${HOME} && done --verbose
+	done /usr/bin && ${HOME} | | x=1 local cd 2>/dev/null printf
+		${HOME} --verbose test -eu
+	--verbose local 'quoted text' sed awk ${HOME} done local local test export
+		| cd printf sed 2>/dev/null --verbose printf done readonly local local
+	export && 'quoted text' local --verbose sed 'quoted text' cd
+export "$@" local grep
+	cd x=1 && | "$1" 'quoted text' 'quoted text' test cd then readonly
+	echo sed local export "$1" export cd
+grep grep grep "$@" 2>/dev/null cd export awk ${HOME} printf
+${HOME} done --verbose readonly
+readonly grep grep x=1 printf export x=1 /usr/bin
+	'quoted text' test printf -eu "$1" && readonly $(pwd) x=1 2>/dev/null
+	cd "$1" test echo && -eu readonly "$@" "$@" "$@" 'quoted text'
+		export then -eu "$@" printf 'quoted text' test /usr/bin local then
+	local test done x=1 ${HOME} readonly
+	export "$1" && cd awk cd x=1 export -eu "$@" awk
+	"$1" then sed test readonly
+| --verbose awk 'quoted text' --verbose 'quoted text'
+	/usr/bin x=1 readonly x=1 /usr/bin then awk
+	"$1" /usr/bin printf grep echo -eu echo awk 2>/dev/null ${HOME} /usr/bin
+		"$1" "$1" sed echo --verbose cd ${HOME} done test grep "$1" local 2>/dev/null
+	cd /usr/bin local && cd local test printf readonly -eu test 'quoted text' "$1" &&
+	test | cd | | then 2>/dev/null $(pwd) $(pwd) cd && local "$1" export x=1 local
+	'quoted text' sed printf local cd ${HOME} done --verbose echo done
+-eu cd -eu grep cd sed -eu 2>/dev/null cd done x=1 2>/dev/null readonly
+		x=1 cd ${HOME} awk grep "$1" export
+	2>/dev/null | && | | "$@" "$@" grep readonly | -eu test printf -eu grep
+	printf 'quoted text' "$@" $(pwd) echo printf $(pwd) && done
+		readonly echo 'quoted text' && "$1" x=1 /usr/bin sed 2>/dev/null
+"$@" $(pwd) export echo --verbose | sed --verbose x=1 test "$1"
+	done "$@" 'quoted text' x=1 done then awk done
+printf sed --verbose "$@" done x=1 sed
+		'quoted text' then local "$@" echo cd -eu --verbose printf 'quoted text'
+local $(pwd) -eu x=1 done then x=1 cd 2>/dev/null test && cd export $(pwd) --verbose
+| --verbose 2>/dev/null | awk 'quoted text' test --verbose test
+		local $(pwd) && ${HOME} grep readonly local readonly -eu test | done printf
+	"$1" 2>/dev/null --verbose | $(pwd) "$@" /usr/bin export 'quoted text'
+'quoted text' 'quoted text'
+	export 2>/dev/null export export x=1 'quoted text' local sed 'quoted text'
+	$(pwd) echo sed local /usr/bin &&
+-eu x=1 grep done -eu --verbose echo then "$1" && /usr/bin /usr/bin local
+test "$1" sed then sed sed -eu
+local done ${HOME} x=1 done done printf
+	echo "$1" export 'quoted text' done awk /usr/bin readonly /usr/bin grep grep $(pwd)
+awk "$1" then done export 2>/dev/null done x=1 --verbose awk export printf
+		local done echo 2>/dev/null then $(pwd) readonly echo local
+		"$1" -eu cd | done sed | "$1" awk /usr/bin printf test --verbose --verbose
+$(pwd) awk 'quoted text' printf export /usr/bin done $(pwd)
+	echo | then printf export -eu -eu
+		export /usr/bin $(pwd) then printf export ${HOME} --verbose "$@"
+		then | && export ${HOME} && "$1" then "$1" then "$@" awk "$1" echo
+	grep done readonly grep export printf then
+		$(pwd) 2>/dev/null ${HOME} ${HOME} done "$1" readonly test 2>/dev/null
+/usr/bin echo -eu | cd export $(pwd) local --verbose readonly
+		then "$1" x=1 cd local cd then | --verbose | "$1" sed
+		| $(pwd) -eu --verbose 'quoted text'
+		| sed /usr/bin "$1" "$1" 'quoted text' then $(pwd) -eu --verbose "$1" sed
+cd printf "$1" then local -eu 'quoted text' then -eu $(pwd) "$@" && then
+readonly | "$1" 'quoted text' |
+	then && readonly echo "$1" test --verbose | "$1" cd printf x=1 export 'quoted text'
+'quoted text' sed sed && echo 2>/dev/null | export
+		grep x=1 test readonly test ${HOME} 2>/dev/null ${HOME}
+export | export done grep awk test readonly
+cd && printf cd "$@" readonly ${HOME} -eu done 'quoted text' $(pwd) "$1"
+	local local export -eu
+echo sed ${HOME} grep -eu grep | done $(pwd) echo ${HOME} 'quoted text'
+		&& ${HOME} printf -eu $(pwd) &&
+	$(pwd) ${HOME} 2>/dev/null done -eu
+		printf -eu test sed --verbose echo echo -eu ${HOME} 2>/dev/null grep local
+	| /usr/bin done grep test local "$@"
+$(pwd) /usr/bin -eu readonly printf
+		"$1" 2>/dev/null 2>/dev/null cd sed export && done printf then echo
+		"$@" then cd local --verbose readonly
+echo export awk cd then "$@" echo 2>/dev/null readonly && printf grep awk echo
+	2>/dev/null /usr/bin local $(pwd)
+		| export echo ${HOME} "$@" /usr/bin sed
+echo "$1" awk readonly then && 'quoted text' done $(pwd) /usr/bin
+	$(pwd) local 'quoted text'
+"$@" $(pwd) local readonly 'quoted text' "$@"
+		sed local echo ${HOME} sed local
+&& --verbose 2>/dev/null cd "$@"
+'quoted text' printf 2>/dev/null
+		2>/dev/null x=1 x=1 x=1 awk &&
+"$1" 2>/dev/null -eu 2>/dev/null "$1" 'quoted text' /usr/bin -eu then --verbose
+	echo "$1" 2>/dev/null "$@" /usr/bin /usr/bin "$@" && | sed
+	"$@" export sed export done --verbose done x=1 readonly --verbose
+-eu grep then 'quoted text' "$@" done ${HOME} x=1 "$@" --verbose /usr/bin printf
+	cd "$1" grep 2>/dev/null sed test
+		local "$1" then | grep 2>/dev/null "$1" echo
+		done --verbose x=1 2>/dev/null local awk | export
+$(pwd) --verbose test export 2>/dev/null then
+	/usr/bin readonly ${HOME} grep readonly 'quoted text' cd /usr/bin
+test echo --verbose 2>/dev/null printf $(pwd) grep test readonly ${HOME} /usr/bin
+	| | done echo | ${HOME} | -eu | printf -eu sed echo sed cd cd test done | --verbose
+cd done && test local readonly
+	cd echo -eu "$1" readonly
+/usr/bin x=1 --verbose test | ${HOME} test done sed
+"$1" printf echo 2>/dev/null echo
+/usr/bin sed $(pwd) local $(pwd) ${HOME} "$@"
+	'quoted text' 2>/dev/null && printf "$1" awk
+printf "$1" ${HOME} 2>/dev/null /usr/bin done -eu export /usr/bin -eu
+	cd sed 2>/dev/null "$1" | echo
+local "$@" "$1" readonly then
+	'quoted text' awk ${HOME}
+	-eu ${HOME} && echo ${HOME} x=1 local cd export grep 'quoted text' 2>/dev/null
+	"$1" cd done sed -eu && test "$@" -eu awk cd awk
+		'quoted text' sed awk 2>/dev/null x=1 --verbose readonly
+then cd done && $(pwd) "$1" awk -eu --verbose echo export /usr/bin done cd /usr/bin
+${HOME} grep --verbose done --verbose cd -eu local
+	2>/dev/null grep 'quoted text' "$@" local sed
+	${HOME} echo | export x=1 done $(pwd) "$@" export --verbose
+/usr/bin grep | export && x=1 readonly | cd --verbose export --verbose cd test
+		$(pwd) done --verbose then local local $(pwd) "$@" then then --verbose x=1
+		${HOME} | sed "$1" readonly $(pwd) | export 'quoted text'
+	-eu x=1 /usr/bin then | export /usr/bin $(pwd)
+		local x=1 --verbose "$@" awk 'quoted text' "$1" export
+	export | done awk local | ${HOME} echo readonly
+x=1 sed x=1 | done /usr/bin sed printf done readonly $(pwd) then
+done ${HOME} 'quoted text' export -eu local --verbose | "$1" grep printf test &&
+		printf "$@" export local local x=1 done done $(pwd)
+'quoted text' x=1 printf cd test echo
+test "$@" then x=1 && sed grep done --verbose |
+"$@" cd local && 'quoted text' done done then printf test "$@"
+		cd test 'quoted text' -eu /usr/bin local --verbose 'quoted text'
+		grep --verbose done 2>/dev/null then "$@" grep sed /usr/bin | printf 'quoted text'
+		--verbose cd export test export local x=1 grep 'quoted text'
+test printf echo cd then test test
+readonly grep ${HOME} done && printf export printf done /usr/bin local "$@" && echo
+then export grep echo
+		${HOME} export --verbose /usr/bin test | $(pwd) printf printf done then then
+grep echo x=1 "$1" $(pwd)
+		${HOME} ${HOME} sed cd "$@"
+		echo x=1 readonly | "$@" local $(pwd) printf -eu ${HOME} cd && awk export ${HOME}
+'quoted text' ${HOME} then printf $(pwd) 2>/dev/null
+		| ${HOME} printf 'quoted text'
+export $(pwd) printf ${HOME} readonly printf "$1" echo awk
+	printf readonly ${HOME} test x=1 x=1 --verbose
+	echo test sed $(pwd) awk test
+	| export awk readonly --verbose local grep |
+/usr/bin --verbose sed 'quoted text' echo
+--verbose ${HOME} test | 'quoted text' sed 2>/dev/null
+		sed echo ${HOME} -eu sed echo local printf -eu && /usr/bin 2>/dev/null && x=1
+	"$@" 2>/dev/null $(pwd) test local 'quoted text' $(pwd) 2>/dev/null cd then grep
+| 2>/dev/null awk 'quoted text' 'quoted text' $(pwd) sed /usr/bin
+	export "$1" "$@" "$1" /usr/bin then echo export $(pwd) local x=1 export readonly
+$(pwd) ${HOME} --verbose then grep 'quoted text' ${HOME} -eu /usr/bin "$1"
+		readonly printf grep printf awk -eu "$1" printf
+		$(pwd) && readonly test x=1 sed
+		--verbose x=1 echo 2>/dev/null 2>/dev/null test export done export
+		test x=1 x=1 cd | "$1" && cd && printf export echo | done export ${HOME}
+-eu test 2>/dev/null done $(pwd) && 2>/dev/null awk local && readonly
+done && $(pwd) /usr/bin -eu readonly --verbose grep
+sed 2>/dev/null printf "$@" echo 'quoted text' ${HOME} echo "$1" | then x=1
+--verbose test local && then then export cd sed 'quoted text' local 'quoted text'
+then /usr/bin && "$1" /usr/bin --verbose "$@" test test 2>/dev/null
+		local printf grep echo echo grep test && /usr/bin
+-eu readonly then "$1" | export printf $(pwd) test x=1 "$1" 2>/dev/null printf done
+		x=1 2>/dev/null -eu $(pwd) local sed done then | test $(pwd) "$1" printf grep
+		test sed cd then 'quoted text' grep local
+	printf "$1" 'quoted text' test "$@" export -eu export local "$@" printf
+		/usr/bin cd cd ${HOME} x=1 awk --verbose echo ${HOME} ${HOME} 'quoted text'
+		cd ${HOME} sed test sed && test readonly $(pwd)
+	printf test printf 'quoted text'
+--verbose "$@" then local "$@" 'quoted text' | readonly
+		local done $(pwd) export awk | sed grep echo test printf sed grep
+"$@" /usr/bin printf ${HOME} x=1 export cd grep && cd x=1 export
+sed --verbose grep awk export cd local | cd readonly readonly export
+	"$1" local "$@" echo $(pwd) ${HOME}
+2>/dev/null "$1" && | 2>/dev/null
+"$@" awk grep "$1" readonly grep 2>/dev/null printf "$@"
+	done sed local x=1 && /usr/bin ${HOME}
+	awk then -eu x=1 export "$@" && printf cd | "$@" /usr/bin --verbose
+'quoted text' test | cd readonly awk
+	"$@" && $(pwd) --verbose $(pwd) | 2>/dev/null
+	| && "$@" 2>/dev/null 'quoted text'
+		test -eu echo && && readonly $(pwd) /usr/bin x=1
+		&& then then 'quoted text' x=1 export sed test sed | && then && 2>/dev/null
+cd --verbose printf awk --verbose awk then echo sed /usr/bin readonly
+readonly $(pwd) 2>/dev/null echo sed -eu 2>/dev/null $(pwd) cd export
+	-eu /usr/bin awk cd 'quoted text' | readonly awk then x=1 ${HOME} sed
+"$@" local done --verbose grep awk
+		${HOME} /usr/bin "$@" ${HOME} grep test && "$1"
+	'quoted text' then "$1" sed grep done local "$1" cd local
+	then cd -eu && then && cd printf 2>/dev/null
+then readonly readonly && printf --verbose 'quoted text' printf "$1" 2>/dev/null
+'quoted text' x=1 /usr/bin --verbose
+	grep readonly --verbose readonly awk awk test 2>/dev/null
+		$(pwd) 2>/dev/null -eu local local /usr/bin then
+readonly local -eu awk --verbose | cd export -eu
+		test && done -eu sed cd export $(pwd) /usr/bin
+		-eu export && local awk ${HOME} echo export export x=1
+	'quoted text' $(pwd) local sed
+	export readonly -eu | "$@" $(pwd) ${HOME} "$1" /usr/bin cd
+		readonly /usr/bin readonly then --verbose sed --verbose &&
+	awk export readonly test done
+		"$@" awk "$1" awk x=1 readonly done test "$1" awk x=1
+		export | sed local ${HOME} ${HOME} cd 2>/dev/null
+	${HOME} 'quoted text' &&
+		export printf done export
+	'quoted text' | grep 'quoted text'
+local local echo awk echo /usr/bin
+		"$1" "$1" local 'quoted text' echo sed awk done grep x=1 2>/dev/null printf cd
+	"$@" cd $(pwd) "$@" cd readonly awk "$1" cd cd
+	"$1" ${HOME} --verbose export test 2>/dev/null --verbose x=1 | grep x=1 then echo
+grep "$@" "$1" readonly ${HOME} $(pwd) grep
+		then done then readonly printf 'quoted text' done sed export
+${HOME} test test sed 'quoted text'
+	'quoted text' test 'quoted text' export
+	"$@" "$@" "$1" x=1 echo --verbose 'quoted text'
+x=1 x=1 --verbose export
+		--verbose "$@" sed test test | "$1" | "$@" done test test --verbose
+	x=1 cd awk | printf export done x=1 done sed | test cd
+"$@" x=1 grep -eu grep done cd echo 2>/dev/null "$1" local "$1"
+	test | readonly && "$1" grep echo /usr/bin $(pwd)
+test && sed sed grep -eu test x=1 grep export 'quoted text' "$@"
+		done then 'quoted text' x=1 test && local 'quoted text' $(pwd) done
+		awk $(pwd) local x=1 then ${HOME} /usr/bin
+		--verbose -eu 2>/dev/null export cd "$1"
+	printf sed ${HOME} test && && 'quoted text' | readonly test local then
+		${HOME} cd readonly done echo
+	${HOME} test done then --verbose readonly sed "$@" awk cd
+	"$@" awk x=1 local readonly && x=1 test printf | done x=1 echo 'quoted text' export
+		cd "$@" test $(pwd) echo && && test export
+"$@" && "$1" -eu sed "$1" printf ${HOME} local "$@" "$1" readonly /usr/bin x=1
+	${HOME} "$1" | /usr/bin local -eu grep test local "$1" -eu -eu "$1" local
+		export x=1 test done /usr/bin local | done
+		then grep readonly | ${HOME} "$@"
+	"$1" awk "$1" "$1" printf $(pwd) test cd | cd local ${HOME} local -eu
+		export test "$@" "$1" cd export ${HOME} /usr/bin
+"$@" "$1" awk grep 2>/dev/null local readonly printf
+	-eu /usr/bin readonly test --verbose printf
+readonly ${HOME} -eu grep done x=1 done test "$@" test test sed && --verbose
+$(pwd) test printf $(pwd) sed cd
+	awk ${HOME} 'quoted text' 'quoted text' grep x=1 sed grep local grep test readonly
+	x=1 awk $(pwd) awk then readonly echo /usr/bin
+	awk | echo "$@" x=1 'quoted text' local sed /usr/bin grep
+	/usr/bin export --verbose export
+		--verbose done sed export
+&& cd | then then awk done x=1 --verbose x=1 readonly then
+	x=1 printf printf sed /usr/bin readonly
+'quoted text' done "$@" 'quoted text'
+$(pwd) && grep printf cd 2>/dev/null test "$1" cd sed $(pwd) then readonly
+	echo echo "$1" | sed local 2>/dev/null --verbose export cd echo
+export x=1 done readonly
+	/usr/bin | echo sed x=1
+	export printf sed grep | done awk then grep ${HOME} printf x=1 sed "$@" grep
+	--verbose local --verbose
+/usr/bin -eu readonly printf test sed x=1 awk then grep "$@"
+printf then export grep
+	awk "$1" readonly 2>/dev/null then test "$@" readonly
+| awk then then cd sed grep done 2>/dev/null
+&& done readonly $(pwd) test done then done local --verbose 'quoted text'
+		"$1" grep local cd local
+		done export test then local && /usr/bin printf "$1" x=1 && then x=1 printf export
+		$(pwd) --verbose grep --verbose -eu "$1" ${HOME}
+	echo done -eu local ${HOME} readonly sed awk 'quoted text'
+awk && "$1" local sed sed test readonly printf echo
+		readonly "$1" "$1" cd cd grep && local printf done echo "$@"
+	echo /usr/bin && awk 'quoted text'
+	'quoted text' done x=1 cd export "$@"
+readonly 2>/dev/null --verbose readonly /usr/bin 'quoted text'
+		sed && | ${HOME} "$1" ${HOME} && sed cd done sed local "$@" export
+	2>/dev/null grep sed echo | local "$1" printf 'quoted text'
+${HOME} | done cd "$@" sed cd x=1 sed cd printf ${HOME}
+	done then echo echo then $(pwd) then $(pwd) x=1 done export "$1" echo ${HOME}
+x=1 --verbose grep --verbose "$@" x=1 $(pwd) x=1 "$@" "$@" printf
+echo sed printf /usr/bin export readonly cd awk
+	'quoted text' "$1" /usr/bin then ${HOME} x=1 printf $(pwd)
+-eu --verbose 2>/dev/null readonly
+	then -eu cd done && /usr/bin x=1 readonly "$1"
+		cd cd x=1 && --verbose | "$1" "$1" cd awk
+test then x=1 ${HOME} printf grep readonly cd "$1" x=1 sed done test sed grep
+-eu cd --verbose local | awk --verbose test echo then "$@"
+		/usr/bin x=1 2>/dev/null --verbose /usr/bin --verbose $(pwd)
+&& | grep /usr/bin /usr/bin grep echo ${HOME} && printf echo --verbose
+	echo readonly test done && export export awk
+	'quoted text' $(pwd) echo 'quoted text' | /usr/bin sed sed ${HOME} cd
+		--verbose cd /usr/bin test /usr/bin then echo && | awk
+	-eu ${HOME} 2>/dev/null x=1 test cd cd x=1 done $(pwd) x=1 | test
+		readonly /usr/bin grep grep && x=1 --verbose export ${HOME} export 2>/dev/null
+readonly && done -eu grep done then --verbose 2>/dev/null
+	${HOME} grep 'quoted text' cd test cd readonly 'quoted text'
+		local /usr/bin then && readonly 2>/dev/null
+		sed cd x=1 | /usr/bin done readonly ${HOME} then 2>/dev/null awk $(pwd)
+		${HOME} 2>/dev/null ${HOME}
+	x=1 awk awk sed echo local && awk ${HOME} cd --verbose cd $(pwd) | export --verbose
+${HOME} "$1" grep done $(pwd) grep grep
+	'quoted text' && ${HOME}
+		$(pwd) cd /usr/bin sed printf export
+		test printf "$1" --verbose export --verbose x=1 export readonly
+	"$1" then echo 'quoted text' ${HOME} --verbose
+		$(pwd) then echo local cd printf 'quoted text' done | printf echo
+		"$@" $(pwd) && 'quoted text' --verbose "$@" echo printf -eu -eu local --verbose
+		done cd done readonly 2>/dev/null sed 2>/dev/null | export export local /usr/bin
+cd grep | export x=1 2>/dev/null /usr/bin cd -eu awk -eu --verbose
+		sed --verbose awk --verbose awk echo readonly 'quoted text' export |
+		local "$1" && readonly test ${HOME} 'quoted text' 2>/dev/null awk "$@" done
+-eu sed grep /usr/bin sed 2>/dev/null ${HOME} awk sed awk --verbose ${HOME}
+	then sed cd echo done grep awk export 'quoted text' cd
+		| ${HOME} local sed /usr/bin printf 2>/dev/null x=1
+awk 2>/dev/null readonly ${HOME} echo
+${HOME} readonly 'quoted text' "$1" --verbose cd | then "$1" printf done
+	done awk /usr/bin "$@" test --verbose "$1" grep printf
+"$1" -eu awk done -eu && test awk --verbose
+sed /usr/bin && test local then "$@" "$@"
+		cd done echo "$1" readonly --verbose && done readonly
+grep sed 'quoted text' awk local test "$@" done 'quoted text' echo 'quoted text'
+"$@" done ${HOME} x=1 printf
+&& done sed 'quoted text' /usr/bin printf
+	--verbose sed sed sed 2>/dev/null grep x=1 2>/dev/null test 2>/dev/null
+	'quoted text' grep grep grep 2>/dev/null 2>/dev/null
+grep grep test 'quoted text' printf export &&
+x=1 printf ${HOME} "$@" --verbose ${HOME}
+		&& "$@" | 'quoted text' echo test x=1 | grep && $(pwd) cd -eu --verbose cd sed
+		"$1" "$@" && printf awk export $(pwd) --verbose
+	cd test export 2>/dev/null readonly test "$@" && $(pwd) | 'quoted text'
+	echo 2>/dev/null awk sed done
+		-eu grep cd ${HOME} test ${HOME} | ${HOME} printf local awk 2>/dev/null
+		"$1" /usr/bin /usr/bin then x=1 awk -eu
+-eu awk awk | ${HOME} local "$1" -eu cd 'quoted text'
+		2>/dev/null "$@" export
+	'quoted text' | -eu /usr/bin awk $(pwd) grep 2>/dev/null --verbose
+-eu sed 2>/dev/null printf cd local export "$1" $(pwd) /usr/bin
+	cd then "$@" | --verbose 'quoted text'
+	'quoted text' x=1 && -eu 2>/dev/null cd sed
+cd x=1 awk echo && | readonly export && done readonly --verbose echo -eu
+		export ${HOME} printf then test x=1 --verbose done 'quoted text' readonly awk
+x=1 cd -eu --verbose x=1 readonly echo x=1 /usr/bin done | export grep $(pwd)
+		then $(pwd) && sed awk "$@" "$1" printf
+local export ${HOME} --verbose grep ${HOME} /usr/bin --verbose "$@" grep
+		sed 'quoted text' $(pwd) sed --verbose then
+&& "$1" grep | --verbose then
+	&& export awk echo "$1" done /usr/bin local ${HOME}
+		done local 2>/dev/null ${HOME} local local done x=1 && export --verbose done local
+		x=1 printf cd $(pwd) done test | ${HOME} readonly
+		export && --verbose export awk x=1 done printf x=1 readonly 'quoted text'
+$(pwd) $(pwd) -eu awk 2>/dev/null
+	-eu && test awk cd 2>/dev/null --verbose
+	grep printf && grep readonly
+	'quoted text' awk done --verbose | export then readonly
+		readonly "$1" x=1 then /usr/bin /usr/bin then then printf
+		then readonly /usr/bin cd -eu
+done done sed 'quoted text' /usr/bin local
+2>/dev/null "$@" $(pwd) grep
+		"$1" readonly local | local local -eu sed -eu && done
+grep local 2>/dev/null cd 'quoted text'
+	${HOME} | x=1 2>/dev/null "$@" test sed then $(pwd) test --verbose
+		-eu printf x=1 sed "$1" local export test echo sed "$1"
+"$@" local done 2>/dev/null done
+		cd sed test ${HOME} test cd 'quoted text' "$1" "$1" printf 2>/dev/null ${HOME}
+'quoted text' 2>/dev/null
+		| local then cd echo cd 'quoted text' test
+$(pwd) awk local | local
+	test readonly sed then $(pwd) | /usr/bin $(pwd) --verbose && --verbose
+"$1" awk $(pwd) /usr/bin echo && 2>/dev/null readonly -eu sed
+'quoted text' --verbose x=1 x=1 sed local printf x=1
+		grep "$@" readonly && /usr/bin -eu /usr/bin echo /usr/bin ${HOME} awk sed readonly
+	${HOME} -eu -eu local export export --verbose $(pwd) 'quoted text' test
+	-eu printf cd export $(pwd) then /usr/bin "$@" awk -eu done $(pwd)
+		readonly grep done readonly grep cd readonly test then grep 'quoted text'
+		| ${HOME} readonly | local && grep readonly awk sed test ${HOME} x=1
+	cd x=1 then cd --verbose echo "$1" export
+	/usr/bin local test grep grep printf "$@" sed ${HOME} -eu grep --verbose
+	/usr/bin local readonly echo --verbose done 2>/dev/null awk
+	--verbose /usr/bin /usr/bin --verbose
+		echo sed --verbose cd | x=1 "$@" sed echo sed local cd -eu done | | --verbose
+	cd x=1 ${HOME} 2>/dev/null "$1" 'quoted text' test
+	| -eu | -eu | ${HOME} awk /usr/bin "$1" && awk -eu 'quoted text' export local
+	'quoted text' echo printf printf export done test test awk then
+		2>/dev/null test | done "$@" && /usr/bin
+	cd | export grep ${HOME} then cd then readonly 'quoted text'
+#include c236.sh
+		"$1" test | 2>/dev/null x=1 grep
+	-eu readonly x=1 export && local local cd test "$@" --verbose
+	readonly "$@" echo cd x=1 | test local && --verbose
+${HOME} then 'quoted text' local -eu grep
+		local | && echo local export ${HOME} awk awk echo done 'quoted text'
+done --verbose | sed -eu printf sed
+		readonly local ${HOME} awk
+	done && ${HOME} && test sed export | /usr/bin grep /usr/bin && ${HOME}
+		then | cd cd printf sed ${HOME} local readonly echo 2>/dev/null "$1"
+	export printf x=1 $(pwd) test $(pwd) $(pwd) ${HOME} grep -eu 2>/dev/null
+		then "$@" sed local test done test grep printf "$@" done grep readonly
+		$(pwd) x=1 awk $(pwd) done 'quoted text' echo awk sed | awk readonly
+		printf cd awk done "$@" | awk awk readonly 2>/dev/null "$1" && ${HOME}
+	export ${HOME} "$1" | "$@" sed then | test | awk "$1"
+awk test cd 'quoted text' --verbose grep
+		2>/dev/null export "$1" done | 'quoted text' readonly cd awk
+		grep cd | ${HOME} printf test then test x=1 local export awk ${HOME} local printf
+	awk 'quoted text' grep test && sed 2>/dev/null 'quoted text'
+		then then ${HOME} --verbose
+		done printf --verbose x=1
+sed 2>/dev/null done -eu --verbose -eu then printf done test then --verbose
+		sed export done then --verbose printf grep "$1" 2>/dev/null 2>/dev/null --verbose
+-eu && && | ${HOME} ${HOME} x=1 sed "$1" "$1" then -eu sed cd readonly
+		done then sed export --verbose 2>/dev/null 2>/dev/null
+	local awk /usr/bin && /usr/bin sed /usr/bin ${HOME} 2>/dev/null
+x=1 /usr/bin ${HOME} local -eu 'quoted text'
+	${HOME} | "$@" -eu | -eu x=1 test $(pwd)
+	echo export $(pwd) sed then
+sed readonly cd $(pwd) && $(pwd) then local sed grep "$1" readonly
+"$@" then done "$1" printf
+		"$@" sed export --verbose ${HOME} test | ${HOME} --verbose "$@" test test -eu local
+cd ${HOME} awk cd 2>/dev/null $(pwd) $(pwd) "$1" test export local "$@" "$@" -eu
+		"$@" export export && done printf test ${HOME} --verbose /usr/bin -eu /usr/bin &&
+	| x=1 2>/dev/null x=1
+/usr/bin | local -eu /usr/bin readonly grep done cd -eu test ${HOME} echo then then
+		$(pwd) $(pwd) | /usr/bin $(pwd) then printf grep "$@" local -eu
+${HOME} $(pwd) /usr/bin readonly
+		-eu x=1 export printf ${HOME}
+		--verbose sed --verbose --verbose $(pwd) sed ${HOME} 2>/dev/null
+readonly 'quoted text' grep awk "$@" $(pwd) ${HOME} "$@"
+		test echo /usr/bin grep test then | 'quoted text' 'quoted text' then local
+	x=1 readonly "$@" readonly echo
+	echo && readonly 2>/dev/null cd ${HOME} x=1 readonly printf printf
+/usr/bin $(pwd) --verbose grep printf $(pwd) ${HOME} && && 'quoted text'
+		-eu printf 2>/dev/null grep then local "$1" done /usr/bin | test | 2>/dev/null
+		done --verbose "$@" 2>/dev/null echo then /usr/bin done grep
+	sed ${HOME} "$@" /usr/bin
+		sed --verbose $(pwd) $(pwd) "$@"
+sed local grep | --verbose
+		export then echo grep then echo done grep --verbose
+	--verbose cd readonly && done then cd awk echo "$1" export x=1 2>/dev/null
+echo $(pwd) 2>/dev/null cd | sed "$@" x=1 --verbose readonly && "$@" test
+	cd local --verbose echo printf --verbose
+local done /usr/bin printf $(pwd) "$@"
+	local awk /usr/bin /usr/bin cd printf "$@" x=1 test printf
+	--verbose local echo ${HOME} grep done test 2>/dev/null done sed awk
+| ${HOME} printf --verbose | printf -eu /usr/bin local awk /usr/bin
+		x=1 | awk /usr/bin export printf then then "$1" printf "$1" sed
+	cd test 2>/dev/null local --verbose then $(pwd) cd
+	"$@" cd $(pwd) ${HOME} cd readonly "$@" | grep export | x=1 --verbose ${HOME} /usr/bin
+	2>/dev/null awk ${HOME} 2>/dev/null local
+cd | -eu 'quoted text' local -eu grep "$1" printf
+	--verbose done "$@" awk "$@" sed sed export
+		done grep && readonly export && test
+	export sed export "$@" ${HOME} export 2>/dev/null printf ${HOME}
+"$1" --verbose "$@" /usr/bin -eu | readonly printf echo --verbose
+--verbose readonly then then test cd
+		2>/dev/null done | test && printf done "$@" readonly
+		printf 'quoted text' awk "$@" | ${HOME} sed /usr/bin test grep
+		--verbose x=1 then ${HOME} echo
+2>/dev/null 'quoted text' --verbose
+		then 2>/dev/null local 2>/dev/null x=1 "$1" && test
+'quoted text' readonly x=1 && -eu "$1" readonly export export 'quoted text'
+x=1 readonly cd --verbose awk awk ${HOME}
+${HOME} | ${HOME} | 'quoted text' local echo printf && -eu test local echo
+${HOME} -eu "$1" x=1 sed $(pwd) 2>/dev/null export readonly
+	${HOME} test && sed x=1 ${HOME} && sed
+2>/dev/null | $(pwd) "$@"
+	2>/dev/null -eu $(pwd) -eu grep $(pwd) awk export $(pwd) 'quoted text'
+	export ${HOME} printf "$1" && then local /usr/bin /usr/bin printf --verbose /usr/bin
+	grep export done 'quoted text' 'quoted text' 'quoted text'
+"$1" 'quoted text' done "$@" "$1" "$@" $(pwd) test done --verbose
+/usr/bin | | awk readonly | --verbose 2>/dev/null awk "$@" local
+		cd "$1" 'quoted text' export
+		'quoted text' then "$1" "$@" printf done | done /usr/bin test export
+| printf "$@" -eu 'quoted text' export && --verbose done x=1 $(pwd)
+grep "$@" cd --verbose x=1 | readonly -eu "$@" cd ${HOME} 2>/dev/null | "$1" local
+		2>/dev/null 2>/dev/null done -eu /usr/bin echo printf then | | readonly --verbose
+--verbose sed echo "$@" echo && | -eu sed sed x=1 awk
+	2>/dev/null /usr/bin --verbose sed "$@"
+	test /usr/bin $(pwd) then --verbose
+awk 'quoted text' export && cd "$1" | export x=1 sed readonly
+	"$@" done cd --verbose echo x=1 --verbose "$1" 'quoted text' test awk 'quoted text'
+	"$1" export ${HOME} && printf "$@" echo sed --verbose printf cd 'quoted text'
+awk readonly export -eu grep cd grep -eu "$1" then echo | | done
+		&& awk "$@" -eu test --verbose /usr/bin export sed local 'quoted text' 2>/dev/null
+		done done awk "$@" awk printf echo /usr/bin
+$(pwd) local "$1" $(pwd) ${HOME} printf then $(pwd) test --verbose
+'quoted text' /usr/bin sed echo echo test done -eu then done /usr/bin
+	cd local readonly done $(pwd) awk -eu echo ${HOME} | -eu awk
+--verbose sed 'quoted text' && "$1" "$@" test
+	printf -eu sed echo export grep $(pwd) test /usr/bin --verbose | test
+	local $(pwd) sed 2>/dev/null echo printf awk | && grep &&
+sed cd sed ${HOME} export | printf 'quoted text' then x=1 test sed
+		cd grep /usr/bin 'quoted text' done then awk | cd
+&& cd /usr/bin $(pwd) cd done x=1 sed
+		awk "$@" 2>/dev/null && ${HOME} printf | | /usr/bin x=1 $(pwd)
+	$(pwd) -eu /usr/bin && 'quoted text' grep "$@" "$@"
+readonly export then -eu ${HOME} -eu test grep sed
+| echo && && x=1 printf --verbose done export --verbose "$@" test echo
+sed $(pwd) /usr/bin $(pwd) grep local x=1 local ${HOME} "$@" 'quoted text'
+"$@" sed cd ${HOME} test /usr/bin export sed then && readonly sed $(pwd)
+sed printf echo --verbose local $(pwd) && $(pwd) awk printf "$@" 'quoted text'
+$(pwd) printf 2>/dev/null x=1 grep /usr/bin x=1 "$1"
+"$@" 2>/dev/null "$1" local ${HOME}
+		local done "$@" test export -eu
+${HOME} printf readonly done
+	&& /usr/bin | --verbose echo grep --verbose "$@" 2>/dev/null
+		then awk && then /usr/bin echo done sed done -eu "$@"
+	local "$1" 'quoted text' readonly
+	'quoted text' 'quoted text' $(pwd) -eu 'quoted text'
+"$@" 'quoted text' "$1" "$@" local done 'quoted text' printf --verbose
+	then --verbose done test echo 2>/dev/null x=1 'quoted text'
+done $(pwd) 2>/dev/null test readonly ${HOME} awk
+		then && 2>/dev/null readonly printf ${HOME} 2>/dev/null
+	&& cd then cd | awk && "$1" 'quoted text'
+2>/dev/null cd /usr/bin ${HOME} $(pwd) cd echo x=1 export /usr/bin test test printf
+		awk test /usr/bin sed
+		--verbose 2>/dev/null done ${HOME} export readonly | 2>/dev/null
+'quoted text' awk readonly
+"$@" sed done /usr/bin && local printf printf grep done -eu && && x=1
+done sed --verbose awk done grep /usr/bin
+		grep printf --verbose export awk grep printf -eu x=1 echo local printf echo then
+		grep readonly x=1 printf 2>/dev/null readonly sed | "$@"
+		export export export x=1 "$@" ${HOME} "$1" x=1 then x=1 sed
+	'quoted text' 'quoted text' -eu echo 'quoted text' then cd | 2>/dev/null
+&& echo then x=1 | x=1 test x=1 --verbose
+		readonly export sed "$@" --verbose x=1 sed printf 2>/dev/null
+	grep /usr/bin then grep $(pwd) grep echo awk
+		${HOME} done sed /usr/bin ${HOME} awk done --verbose export
+	export printf && $(pwd) "$1" 'quoted text' -eu $(pwd) printf && test cd
+		$(pwd) printf "$1" grep
+${HOME} x=1 "$1" grep /usr/bin local echo -eu x=1 sed | done "$1" then 'quoted text'
+export echo 'quoted text' export "$1" grep "$1"
+		2>/dev/null x=1 sed "$@" export && readonly $(pwd) grep
+	2>/dev/null "$@" then readonly 2>/dev/null export $(pwd) awk | "$1" --verbose
+${HOME} test "$@" && 'quoted text' $(pwd) then /usr/bin && readonly export
+	awk 2>/dev/null 2>/dev/null $(pwd) readonly && then done cd 'quoted text'
+"$1" readonly ${HOME} "$@" x=1 local | readonly awk "$1" echo --verbose
+		"$@" 2>/dev/null test /usr/bin export cd done awk --verbose export "$1" ${HOME}
+x=1 x=1 readonly -eu
+	then done readonly ${HOME} "$1" cd $(pwd)
+		"$1" -eu sed | x=1 echo printf ${HOME} export local --verbose sed test 2>/dev/null
+export ${HOME} 2>/dev/null "$@" 'quoted text'
+"$1" printf -eu 2>/dev/null export 2>/dev/null | /usr/bin | test 2>/dev/null
+		--verbose echo grep test -eu done printf $(pwd)
+2>/dev/null test test "$@" "$@" --verbose done "$1"
+		export "$1" done && --verbose && "$@" then awk x=1 grep
+		2>/dev/null test --verbose awk 'quoted text'
+&& grep done readonly /usr/bin 2>/dev/null -eu 2>/dev/null /usr/bin
+	sed "$@" export && sed local readonly test 2>/dev/null test
+		"$1" export test cd 'quoted text' && 'quoted text' echo then $(pwd)
+"$1" "$1" done | sed -eu --verbose echo
+		/usr/bin 2>/dev/null
+	&& test then then test && done cd 'quoted text'
+	printf 2>/dev/null export
+		"$@" grep grep ${HOME} then cd test sed --verbose
+	readonly readonly "$1" grep "$1" done | /usr/bin
+		&& printf && then --verbose awk -eu
+	$(pwd) readonly 2>/dev/null cd x=1 x=1
+	export | then --verbose then x=1 'quoted text'
+'quoted text' grep 2>/dev/null readonly then $(pwd) done -eu printf echo /usr/bin
+	printf awk 'quoted text' $(pwd) -eu &&
+		local printf cd x=1 local awk export "$1" sed printf && sed
+		awk --verbose --verbose | "$1" grep test ${HOME} sed export export grep && echo
+		printf ${HOME} /usr/bin /usr/bin $(pwd) export local done readonly | "$1"
+	readonly 2>/dev/null echo readonly grep && grep -eu then 2>/dev/null readonly
+then grep printf 'quoted text'
+&& then && done 'quoted text' cd export grep export cd $(pwd) sed
+		/usr/bin "$@" grep echo grep /usr/bin awk cd |
+		--verbose sed then sed local -eu cd test echo --verbose
+sed readonly "$1" 2>/dev/null 2>/dev/null /usr/bin
+	--verbose | readonly ${HOME} printf 'quoted text' ${HOME}
+	| done export x=1 | local --verbose
+$(pwd) printf /usr/bin
+	readonly 2>/dev/null export
+echo done -eu test grep printf
+	awk --verbose x=1 /usr/bin cd sed done --verbose | echo | awk awk
+	cd done sed 'quoted text'
+	then cd | "$@" --verbose --verbose
+		$(pwd) echo ${HOME} then sed cd 2>/dev/null
+	$(pwd) echo --verbose "$1" done awk "$1" "$1" grep 'quoted text' ${HOME}
+-eu "$1" export echo readonly --verbose ${HOME}
+		printf x=1 $(pwd) $(pwd) sed && 'quoted text'
+		test -eu --verbose test x=1
+		grep x=1 grep -eu 2>/dev/null
+	'quoted text' /usr/bin -eu
+&& /usr/bin test readonly test 2>/dev/null cd local --verbose
+$(pwd) then $(pwd) done x=1 "$@" x=1 --verbose local -eu cd | x=1 cd
+		"$@" sed | x=1 "$@" "$@" "$@"
+	export export local --verbose /usr/bin
+		readonly sed sed local "$@"
+'quoted text' cd 2>/dev/null test && --verbose
+		/usr/bin 'quoted text' 'quoted text' "$1" -eu
+	2>/dev/null 'quoted text' "$@" cd sed then done 2>/dev/null
+	export grep export printf "$@" | $(pwd) grep | -eu export
+	| $(pwd) local readonly | cd && echo test readonly $(pwd) "$@" echo /usr/bin
+		2>/dev/null --verbose "$1" sed printf printf && readonly ${HOME} --verbose grep
+awk echo 'quoted text' readonly | awk && cd grep
+	-eu printf done x=1 grep "$@" --verbose readonly --verbose --verbose | | $(pwd)
+cd /usr/bin | x=1 /usr/bin --verbose -eu test
+	&& cd sed cd 'quoted text' $(pwd) x=1 $(pwd) -eu
+	2>/dev/null grep ${HOME} "$@" -eu "$1" then echo ${HOME}
+readonly "$1" then echo export | 2>/dev/null done "$@" echo x=1 readonly echo
+	"$@" && readonly local "$@" local $(pwd) | local
+test cd sed done grep $(pwd) echo $(pwd)
+-eu && cd grep /usr/bin local | x=1 cd test test local "$@" readonly
+sed awk echo readonly awk --verbose -eu "$@"
+echo sed printf $(pwd) --verbose | 2>/dev/null
+readonly "$1" cd 'quoted text'
+	export "$@" -eu "$@" export done then local then then test "$1"
+		sed export printf local echo -eu && | echo then 2>/dev/null
+local | $(pwd) ${HOME} grep readonly --verbose | test local $(pwd)
+		x=1 --verbose | readonly 2>/dev/null &&
+		$(pwd) readonly done /usr/bin then
+x=1 $(pwd) test grep "$1" done 'quoted text' then readonly then
+/usr/bin grep ${HOME}
+test echo && readonly test export cd ${HOME}
+grep x=1 "$1" && ${HOME} 2>/dev/null 2>/dev/null 'quoted text' | export
+		2>/dev/null then --verbose
+		${HOME} sed && grep echo "$@" $(pwd) local awk sed 'quoted text' readonly
+	then ${HOME} cd /usr/bin $(pwd) --verbose
+| printf then /usr/bin ${HOME} ${HOME} test export -eu local "$1"
+	$(pwd) 'quoted text' test grep | cd $(pwd) test readonly 2>/dev/null "$1"
+	done $(pwd) export export test echo 2>/dev/null --verbose --verbose
+	sed 2>/dev/null ${HOME} echo
+		echo local "$@" --verbose
+		x=1 cd echo x=1 done local ${HOME} sed sed
+grep 2>/dev/null | done ${HOME} readonly sed grep
+export printf readonly "$1" done readonly done $(pwd) export | 'quoted text'
+	grep 2>/dev/null then export test
+		done /usr/bin done 2>/dev/null sed 2>/dev/null x=1 && | then 'quoted text' $(pwd)
+	--verbose | sed /usr/bin awk printf 'quoted text'
+		printf echo printf printf --verbose x=1 x=1 cd "$1"
+		then grep echo 2>/dev/null
+	${HOME} echo | export "$1" echo "$@"
+x=1 && $(pwd) 2>/dev/null
+x=1 export local "$1" --verbose && --verbose && 2>/dev/null test sed /usr/bin
+	| test then cd printf ${HOME} "$@" | done echo $(pwd) grep
+		readonly "$@" printf then done x=1 done | local done | &&
+"$1" echo readonly -eu grep done readonly -eu ${HOME} && test echo echo
+	then -eu -eu test grep cd awk /usr/bin --verbose cd
+then 2>/dev/null echo test /usr/bin && ${HOME} x=1 grep echo | done done
+cd --verbose -eu sed printf sed | cd done "$@" grep
+		-eu 'quoted text' cd local "$@" readonly cd 2>/dev/null -eu cd export 'quoted text'
+		${HOME} $(pwd) /usr/bin 2>/dev/null ${HOME} --verbose
+	"$@" then "$@" awk test 2>/dev/null 'quoted text' echo 2>/dev/null
+	2>/dev/null export | printf "$1" ${HOME} ${HOME} test then "$1" grep readonly
+		"$@" awk && local && test awk export
+	"$@" /usr/bin -eu && --verbose then x=1 grep sed readonly printf sed done --verbose
+		cd done "$@" -eu echo sed --verbose 'quoted text' x=1 /usr/bin awk
+printf 'quoted text' awk $(pwd) $(pwd) local
+	| ${HOME} /usr/bin -eu -eu done grep cd grep 2>/dev/null 2>/dev/null
+	'quoted text' cd then test && echo
+	cd 2>/dev/null "$@" cd $(pwd) sed $(pwd) 'quoted text' ${HOME} sed
+		awk printf 'quoted text' export
+"$1" "$@" | local 'quoted text'
+cd printf && export $(pwd) ${HOME} /usr/bin | --verbose && && --verbose 'quoted text'
+local printf "$@" --verbose ${HOME} printf x=1 printf x=1 2>/dev/null "$@"
+	grep grep -eu | 2>/dev/null printf
+	2>/dev/null /usr/bin 'quoted text' | cd sed 2>/dev/null
+		${HOME} echo x=1 done
+${HOME} test awk cd then && local $(pwd) then local 2>/dev/null
+	grep then 2>/dev/null 'quoted text' local | readonly --verbose
+		done ${HOME} | $(pwd) 'quoted text' -eu awk --verbose
+then test 'quoted text'
+/usr/bin then awk printf printf ${HOME} awk -eu done "$@"
+	/usr/bin grep cd test sed readonly
+		${HOME} echo echo --verbose ${HOME} x=1 printf /usr/bin
+	&& printf $(pwd) /usr/bin then
+	$(pwd) then readonly "$@" cd test sed /usr/bin
+export $(pwd) awk && echo --verbose
+| | x=1 $(pwd) cd grep sed
+	/usr/bin sed "$@" x=1 -eu "$@" cd /usr/bin
+	export export cd x=1 export | then
+	printf done ${HOME} export $(pwd) awk 2>/dev/null
+		echo "$1" export -eu then -eu cd --verbose
+local ${HOME} printf sed printf "$1" /usr/bin
+export /usr/bin grep /usr/bin 'quoted text' awk printf && readonly
+	2>/dev/null $(pwd) readonly "$@" "$@" -eu &&
+		grep "$@" 'quoted text' readonly ${HOME} export awk |
+		awk awk /usr/bin | /usr/bin -eu readonly printf
+grep readonly | then ${HOME} --verbose done export ${HOME} grep x=1 'quoted text'
+		&& local echo "$@" /usr/bin readonly x=1
+		local done ${HOME} test | && export -eu then | export $(pwd) "$1" /usr/bin | |
+&& echo export export then then --verbose cd grep 2>/dev/null
+	echo 2>/dev/null local cd x=1 printf && 'quoted text'
+	"$@" "$@" local sed local $(pwd) /usr/bin /usr/bin 2>/dev/null
+		"$@" x=1 "$@" x=1 awk "$@" $(pwd) && grep 2>/dev/null
+		${HOME} sed | echo local "$1" sed | printf echo done sed "$@" --verbose
+		local && --verbose "$1"
+	echo 'quoted text' ${HOME} "$@" cd "$@" $(pwd)
+local "$1" awk grep done --verbose
+"$@" awk echo x=1 | export -eu echo | done
+	grep echo ${HOME} | "$1" awk local --verbose
+sed && 'quoted text' x=1 && then printf "$1" grep $(pwd) grep
+	then 2>/dev/null --verbose /usr/bin
+	grep grep readonly local --verbose "$1" readonly printf readonly grep
+"$@" /usr/bin sed cd printf readonly 'quoted text' 2>/dev/null done local readonly
+		--verbose "$1" then 'quoted text' x=1 'quoted text'
+"$1" readonly -eu test $(pwd) local x=1 export echo sed 2>/dev/null
+		test test 2>/dev/null awk 'quoted text' /usr/bin test
+		printf done x=1 test export export done grep ${HOME} then
+	&& -eu "$1" awk "$@" grep readonly "$@" then -eu "$@" "$@" cd readonly /usr/bin
+-eu test readonly $(pwd) x=1
+	-eu echo | x=1 awk readonly local ${HOME} sed echo
+	then local then 2>/dev/null -eu done -eu printf "$@" && grep -eu $(pwd)
+		printf -eu --verbose cd "$1"
+		"$@" 2>/dev/null grep /usr/bin "$@" $(pwd) grep readonly printf cd cd && &&
+		echo readonly grep grep export --verbose
+		"$1" 2>/dev/null "$@" grep grep x=1 x=1 cd "$@" export
+	readonly "$@" readonly cd readonly 'quoted text' awk &&
+	/usr/bin awk && ${HOME} 2>/dev/null export && grep 2>/dev/null awk x=1 $(pwd)
+"$1" "$@" ${HOME} test "$@" x=1 $(pwd) "$@" readonly sed --verbose
+-eu $(pwd) sed --verbose && 2>/dev/null | printf printf test printf | readonly "$1"
+	"$@" && readonly sed then grep test export awk
+export -eu readonly /usr/bin then 2>/dev/null test export
+	printf -eu test awk 'quoted text' -eu printf
+	--verbose 'quoted text' grep x=1 "$1" 2>/dev/null
+	cd cd then echo "$@" && done readonly
+awk done export readonly $(pwd) echo grep ${HOME} -eu "$@" readonly --verbose
+	awk readonly /usr/bin local 'quoted text' -eu -eu sed 'quoted text'
+		readonly 'quoted text' awk echo export 'quoted text' then 2>/dev/null local awk
+sed export -eu test 2>/dev/null "$@" readonly 2>/dev/null
+	test && test export local export test export /usr/bin
+printf x=1 readonly then "$1"
+		| | "$1" cd then done export test local | x=1 then x=1 $(pwd) ${HOME}
+	test "$@" export && -eu cd x=1 --verbose readonly "$@" echo -eu "$@" test
+	--verbose then export ${HOME} awk awk cd | readonly
+		sed x=1 awk grep cd export |
+&& | "$1" grep awk cd awk "$@"
+		readonly -eu echo 'quoted text' test readonly
+		$(pwd) /usr/bin 'quoted text' grep 'quoted text' readonly local -eu echo
+	"$1" /usr/bin grep done then sed sed
+	done test -eu "$1" echo 2>/dev/null x=1
+x=1 printf then cd cd grep export x=1 -eu readonly
+readonly export readonly "$1" printf grep then test readonly cd 'quoted text'
+	-eu /usr/bin sed sed grep ${HOME} 2>/dev/null local export "$1" "$1" test --verbose
+		-eu export awk -eu 'quoted text' "$@" printf x=1
+	| /usr/bin then $(pwd) grep
+	export sed awk | x=1
+		/usr/bin done awk cd 'quoted text' grep "$@" done test x=1 ${HOME}
+/usr/bin then 'quoted text' 2>/dev/null test test local export /usr/bin /usr/bin
+	then grep done cd printf ${HOME} ${HOME} | sed local
+done /usr/bin 'quoted text'
+	printf --verbose "$@" && $(pwd)
+| --verbose x=1 | grep | x=1 /usr/bin
+$(pwd) ${HOME} /usr/bin --verbose | 'quoted text' sed
+	then export 2>/dev/null echo grep
+		local local awk local
+	--verbose x=1 x=1 printf ${HOME} then && grep echo /usr/bin test && | local grep
+x=1 "$@" && export | grep readonly awk $(pwd) /usr/bin done
+done 2>/dev/null "$@" awk "$@" cd readonly echo awk sed
+		test test && printf && export 'quoted text'
+		test sed sed grep /usr/bin echo sed then "$1" done local "$1" local 2>/dev/null
+grep awk test $(pwd) local echo "$@" 'quoted text' ${HOME} export printf
+		test 2>/dev/null echo 'quoted text' sed done 'quoted text' local
+		echo grep awk local 2>/dev/null local -eu
+		awk grep x=1 | cd $(pwd) /usr/bin --verbose grep awk
+		$(pwd) $(pwd) -eu then printf sed --verbose test cd |
+local grep then "$@" | /usr/bin && export
+-eu | export "$1" awk local done $(pwd) -eu x=1 readonly
+		-eu readonly done --verbose local 'quoted text'
+	'quoted text' 2>/dev/null x=1 sed test readonly ${HOME} | test && | cd export /usr/bin
+'quoted text' test | grep
+	2>/dev/null ${HOME} sed
+local export readonly
+	/usr/bin done 'quoted text'
+sed 'quoted text' /usr/bin && cd printf x=1
+		cd readonly done then readonly 'quoted text' && then -eu $(pwd)
+		done export 2>/dev/null sed printf && && printf -eu readonly x=1
+local "$@" $(pwd) x=1 "$@"
+		| | local && x=1 $(pwd) printf then local export
+cd 'quoted text' "$1" 'quoted text' -eu $(pwd) printf --verbose $(pwd) 2>/dev/null
+		grep "$1" local -eu echo ${HOME}
+		export export -eu 'quoted text' 'quoted text'
+local echo ${HOME} export then 'quoted text'
+	x=1 2>/dev/null awk awk
+	sed && -eu local cd printf --verbose local grep | sed then
+		$(pwd) grep 'quoted text'
+		2>/dev/null echo | echo && "$@" 2>/dev/null --verbose 'quoted text'
+| "$@" echo local then test echo
+	| export --verbose sed 'quoted text' printf "$@"
+&& sed echo done printf printf done "$1" export export -eu sed | sed local test
+	grep 2>/dev/null test printf /usr/bin && test -eu 'quoted text' x=1 done $(pwd)
+	awk then sed grep printf grep 'quoted text' test 'quoted text' sed awk
+		2>/dev/null -eu local local "$@" --verbose readonly ${HOME} done "$@" $(pwd)
+	'quoted text' done echo --verbose 2>/dev/null 2>/dev/null
+then --verbose echo | then grep local "$1" "$@" grep 2>/dev/null readonly
+	awk -eu sed printf test /usr/bin 'quoted text'
+${HOME} /usr/bin 'quoted text' "$1" "$@" "$@" readonly | done -eu && grep "$@" $(pwd)
+		$(pwd) cd grep sed "$@" echo done 2>/dev/null done
+2>/dev/null | --verbose /usr/bin
+grep -eu --verbose then -eu --verbose -eu grep --verbose
+	&& ${HOME} sed cd ${HOME} done test local "$@" 2>/dev/null "$@" echo cd
+	$(pwd) sed test --verbose test | test ${HOME}
+		| x=1 done 2>/dev/null "$@" "$1" then
+		'quoted text' readonly export local "$@" &&
+		sed readonly "$@" done | -eu 'quoted text' done export --verbose 'quoted text'
+		${HOME} done $(pwd) test readonly /usr/bin $(pwd)
+/usr/bin test awk done printf sed ${HOME} && local 2>/dev/null
+	test awk ${HOME} export grep --verbose
+"$@" $(pwd) sed -eu | "$1"
+/usr/bin grep cd --verbose && ${HOME} done
+	| && x=1 then cd done printf echo echo cd readonly
+awk cd -eu local ${HOME} test awk /usr/bin done grep grep /usr/bin printf
+		printf ${HOME} ${HOME} then test "$1" done $(pwd) -eu
+echo echo --verbose $(pwd) awk && grep |
+2>/dev/null then then /usr/bin local
+		&& $(pwd) then "$1" readonly -eu $(pwd) sed sed echo awk local sed --verbose
+		export -eu awk && readonly && done 'quoted text'
+| && printf /usr/bin test "$@" cd export printf done
+--verbose local printf printf grep --verbose export
+x=1 ${HOME} echo -eu echo echo awk "$1" /usr/bin --verbose --verbose
+	test printf | cd awk x=1 "$1" test then ${HOME} ${HOME} 2>/dev/null then awk --verbose
+		${HOME} sed awk --verbose awk local
+		${HOME} printf export --verbose
+	sed cd -eu test 2>/dev/null test sed && 'quoted text' grep awk local echo local
+		readonly ${HOME} test x=1 grep echo ${HOME} /usr/bin "$@" grep then cd 2>/dev/null
+then "$@" awk x=1 readonly 'quoted text'
+cd 'quoted text' -eu --verbose cd
+test 'quoted text' "$1" awk ${HOME} /usr/bin -eu printf ${HOME} -eu x=1 sed awk
+x=1 echo 2>/dev/null | -eu "$1" awk echo
+	${HOME} done ${HOME}
+export readonly local local grep $(pwd) printf -eu 2>/dev/null
+		2>/dev/null export cd -eu "$1" test --verbose
+local $(pwd) echo ${HOME} cd local
+		${HOME} then grep "$1" --verbose then cd test $(pwd) export grep /usr/bin
+cd ${HOME} ${HOME} 2>/dev/null 'quoted text'
+	"$@" printf "$@" awk x=1 grep export sed awk test done local | --verbose echo
+/usr/bin $(pwd) "$1" done | printf x=1 /usr/bin then x=1 local "$1"
+"$1" sed | test "$@" 2>/dev/null echo 2>/dev/null export && done
+		"$@" /usr/bin export "$@" /usr/bin cd -eu x=1 $(pwd) export && local "$1"
+		--verbose $(pwd) sed $(pwd) -eu --verbose
+'quoted text' export export test && grep
+		${HOME} --verbose done printf local | 2>/dev/null sed echo
+	sed then then --verbose printf 2>/dev/null ${HOME} /usr/bin /usr/bin awk $(pwd)
+2>/dev/null ${HOME} -eu local printf sed /usr/bin then --verbose
+	awk --verbose awk x=1 && "$1" "$@" --verbose --verbose
+cd echo /usr/bin printf "$1" "$@" && sed done "$@" done grep readonly -eu echo
+	awk sed 'quoted text' grep export printf $(pwd) 'quoted text'
+x=1 "$@" $(pwd) printf grep readonly local sed -eu sed test "$@"
+	awk && grep cd /usr/bin readonly cd readonly x=1 awk then sed
+	then | export printf --verbose printf echo 2>/dev/null
+	done export --verbose printf "$1" then $(pwd) x=1 readonly 'quoted text' 2>/dev/null
+	sed export then /usr/bin ${HOME} --verbose printf grep done awk ${HOME}
+${HOME} /usr/bin | "$1" echo export -eu awk | --verbose test then "$@" "$1" "$1"
+	--verbose test cd "$1" done $(pwd) sed cd echo then ${HOME} echo
+		test 'quoted text' printf
+		$(pwd) test export grep -eu $(pwd) && 'quoted text' test x=1
+		&& then cd --verbose then && --verbose | test "$1" -eu cd /usr/bin printf
+		| echo sed 'quoted text' --verbose grep /usr/bin ${HOME}
+		x=1 done local x=1 sed
+	done && ${HOME} then sed grep export
+test "$1" --verbose -eu export local echo /usr/bin awk --verbose grep
+&& test export "$1" 2>/dev/null echo 'quoted text' printf
+	then 'quoted text' test then sed done ${HOME} sed 'quoted text' cd "$1" "$@" cd
+		printf grep ${HOME} && $(pwd) "$@"
+	$(pwd) readonly /usr/bin
+${HOME} local then -eu && 2>/dev/null "$1" "$1" -eu cd $(pwd) done export "$@"
+--verbose "$1" sed awk test --verbose | --verbose readonly
+local $(pwd) cd grep
+		${HOME} export then "$@" export x=1 awk then test local echo grep --verbose
+		$(pwd) test printf sed awk --verbose | "$1"
+cd x=1 "$@" $(pwd) 2>/dev/null
+${HOME} x=1 awk echo awk export export --verbose echo
+		grep printf -eu export "$1" -eu local | readonly ${HOME}
+		| printf echo cd && --verbose awk $(pwd) sed sed --verbose grep sed
+		printf | cd && /usr/bin && local "$@" | 2>/dev/null
+cd /usr/bin -eu && then echo
+		${HOME} "$1" echo readonly ${HOME} local && local export test sed --verbose local
+awk done "$@" | ${HOME} readonly grep "$1"
+	test cd sed test readonly cd echo then test then 2>/dev/null "$1" echo
+	'quoted text' done 2>/dev/null "$1" echo $(pwd) awk then sed -eu &&
+		-eu 2>/dev/null then grep "$@" "$@" -eu echo 'quoted text'
+		grep /usr/bin "$1" echo && awk | "$@" --verbose -eu done | export
+		"$@" | readonly $(pwd) x=1 sed "$1" local then ${HOME} "$@" && awk $(pwd) $(pwd)
+	--verbose | sed && "$1" $(pwd) --verbose && $(pwd) grep && "$1" export x=1
+test && sed | printf "$@" cd test
+	grep grep echo grep 2>/dev/null grep --verbose --verbose local readonly
+echo /usr/bin ${HOME} export
+	/usr/bin local 2>/dev/null x=1 ${HOME}
+		-eu ${HOME} printf 'quoted text' | /usr/bin awk cd 2>/dev/null grep --verbose
+	printf x=1 -eu | local --verbose x=1 sed done
+	-eu echo sed then readonly then printf local test -eu 'quoted text' test
+x=1 local local test echo export export grep x=1 sed cd then
+	printf local readonly $(pwd) done "$@" readonly $(pwd) then && "$1"
+local done done export /usr/bin 2>/dev/null "$1" echo
+	'quoted text' test /usr/bin 2>/dev/null
+		readonly cd /usr/bin && ${HOME} readonly "$@" 'quoted text' x=1 "$1" test 2>/dev/null
+	--verbose awk test then done
+		done && $(pwd) 2>/dev/null awk test cd export "$@" x=1 | --verbose
+		2>/dev/null printf printf cd echo sed done cd readonly echo sed | -eu /usr/bin
+		test done ${HOME} cd
+		/usr/bin ${HOME} done awk $(pwd) then
+	x=1 printf "$1" export x=1 printf "$@" | done
+grep grep then x=1 --verbose test 2>/dev/null /usr/bin
+cd /usr/bin && test printf awk sed --verbose local | sed
+"$@" test "$1" awk printf echo then /usr/bin /usr/bin sed /usr/bin
+		x=1 test x=1 | echo sed 2>/dev/null /usr/bin printf
+	| --verbose export 'quoted text' | awk awk printf
+cd --verbose "$@" printf done -eu "$@" x=1 2>/dev/null readonly
+	$(pwd) /usr/bin -eu --verbose sed awk sed ${HOME} x=1 then
+		local /usr/bin then readonly 2>/dev/null
+		"$@" export $(pwd) export 'quoted text'
+		"$1" readonly 'quoted text' grep
+local -eu -eu test "$@" x=1 echo
+		done test $(pwd) printf sed export awk "$@"
+		printf then | sed grep awk "$@" --verbose --verbose cd readonly awk grep
+		-eu grep /usr/bin | cd && test 'quoted text' awk 'quoted text' test
+export ${HOME} awk then --verbose 2>/dev/null 'quoted text' | x=1 2>/dev/null
+	awk ${HOME} echo -eu x=1 "$@" grep done readonly
+then $(pwd) "$1" $(pwd) -eu then | && readonly export
+		${HOME} test --verbose "$@" test awk /usr/bin test done && $(pwd) printf
+		${HOME} sed local 'quoted text'
+	2>/dev/null --verbose $(pwd) -eu cd x=1 $(pwd) then then $(pwd) ${HOME} $(pwd)
+&& local awk $(pwd) done ${HOME} readonly test awk "$@" cd awk
+	local --verbose cd $(pwd) x=1
+	x=1 printf ${HOME} -eu ${HOME}
+then "$1" /usr/bin echo --verbose readonly echo -eu
+	"$1" "$@" "$1" 2>/dev/null
+		export done done | printf && test cd local sed
+		x=1 && "$1" "$@" grep -eu printf echo ${HOME} ${HOME} export
+		cd /usr/bin ${HOME} 2>/dev/null $(pwd) -eu test && done /usr/bin
+		/usr/bin $(pwd) awk "$1"
+	&& printf export grep 2>/dev/null ${HOME} printf done
+	test "$@" printf 'quoted text'
+		then ${HOME} cd ${HOME}
+	'quoted text' -eu && --verbose export
+'quoted text' x=1 printf test --verbose
+	printf && 2>/dev/null
+	-eu done export "$@" sed sed printf
+	export grep cd cd local printf
+"$1" printf printf awk readonly --verbose $(pwd) export sed 'quoted text'
+		echo x=1 test test --verbose "$1" echo /usr/bin --verbose
+printf echo export --verbose awk export cd "$1" export grep
+grep 2>/dev/null grep awk ${HOME} /usr/bin 'quoted text'
+	-eu echo readonly export done 'quoted text' sed 'quoted text'
+		--verbose "$1" export sed then /usr/bin -eu
+sed awk "$@" local ${HOME} export cd export readonly 2>/dev/null $(pwd) sed
+"$@" sed readonly grep echo awk echo $(pwd)
+	/usr/bin cd ${HOME} grep && "$@" done cd x=1 "$@" export
+	cd "$1" "$1" done --verbose awk sed --verbose grep then done
+	then 2>/dev/null ${HOME} "$@" test 'quoted text' readonly | x=1 "$@" /usr/bin
+local -eu sed awk done 2>/dev/null
+		2>/dev/null grep printf $(pwd)
+		"$@" sed done grep "$1" && 'quoted text' local then "$@" ${HOME}
+echo x=1 awk 'quoted text' cd "$1" local ${HOME} readonly grep done echo
+		test $(pwd) /usr/bin export x=1
+'quoted text' sed printf ${HOME}
+		| done 2>/dev/null local x=1 'quoted text' awk
+	${HOME} 'quoted text' awk sed 'quoted text'
+		printf then export sed "$1" readonly grep "$@" "$1" echo $(pwd)
+cd printf ${HOME} | --verbose grep && "$@" &&
+cd $(pwd) 'quoted text' awk local awk cd cd 2>/dev/null readonly
+		echo cd /usr/bin | printf grep -eu then done done grep
+	"$1" sed cd awk 'quoted text' -eu cd /usr/bin
+	&& "$1" 2>/dev/null local 'quoted text' x=1 cd readonly awk ${HOME} grep
+readonly 'quoted text' | -eu local test cd done /usr/bin
+local then cd --verbose 'quoted text' awk done && ${HOME}
+${HOME} 2>/dev/null "$@" echo "$@" "$1" "$@" then
+	sed readonly test awk | sed then echo ${HOME} -eu grep
+export && 'quoted text' export local $(pwd) | /usr/bin test done x=1 "$1" /usr/bin
+	'quoted text' done sed x=1 && ${HOME} grep readonly awk 2>/dev/null echo "$1"
+'quoted text' /usr/bin awk && done echo grep -eu && test
+	printf && then readonly awk printf grep -eu x=1 sed $(pwd) cd /usr/bin local
+$(pwd) cd awk -eu $(pwd) readonly grep ${HOME} | ${HOME} 'quoted text'
+		test x=1 2>/dev/null done 2>/dev/null 2>/dev/null printf
+cd then 'quoted text' --verbose
+	readonly | grep printf printf
+--verbose cd export 'quoted text' /usr/bin /usr/bin &&
+printf readonly -eu /usr/bin && "$@" cd cd --verbose cd printf /usr/bin x=1 cd
+	${HOME} ${HOME} $(pwd) readonly
+	-eu test $(pwd) 2>/dev/null /usr/bin export export "$@" test export | export
+"$1" local grep echo cd local -eu ${HOME}
+		grep ${HOME} test | cd ${HOME}
+"$@" test export --verbose --verbose -eu $(pwd) sed $(pwd) ${HOME}
+export test awk cd cd ${HOME}
+	done cd test ${HOME} export sed cd -eu && printf
+	2>/dev/null 2>/dev/null x=1 "$@" --verbose
+export ${HOME} 'quoted text' local then 'quoted text' 2>/dev/null x=1
+-eu awk printf $(pwd) cd echo "$1" /usr/bin
+	done ${HOME} $(pwd) sed sed grep /usr/bin -eu then sed awk | && $(pwd) cd 2>/dev/null
+done echo cd --verbose
+		done echo | ${HOME} $(pwd) && then awk test --verbose ${HOME} && 2>/dev/null
+		2>/dev/null 'quoted text' 'quoted text' grep
+	printf "$@" && -eu export awk x=1
+		readonly x=1 "$@" printf /usr/bin 'quoted text' 'quoted text' x=1 printf
+	cd export "$@" 'quoted text' x=1 printf "$1" /usr/bin
+test readonly && && test /usr/bin echo then cd readonly
+		/usr/bin test 2>/dev/null grep -eu
+		export echo grep ${HOME}
+		then "$@" export /usr/bin -eu export "$1" done then
+		printf "$@" local -eu then then "$1" then 2>/dev/null then
+x=1 x=1 'quoted text' export test --verbose | | -eu done "$1" awk sed local
+printf readonly then | grep 2>/dev/null x=1 && grep x=1 'quoted text' awk
+		"$1" local "$1" done then && sed done 2>/dev/null readonly $(pwd) done echo
+$(pwd) ${HOME} readonly export done readonly done /usr/bin readonly export then
+--verbose $(pwd) export 'quoted text' awk
+"$@" sed | && local --verbose 2>/dev/null cd | |
+/usr/bin grep 'quoted text' 'quoted text' ${HOME} test awk 2>/dev/null
+done 2>/dev/null cd readonly ${HOME}
+		${HOME} echo $(pwd) /usr/bin 'quoted text' done printf 2>/dev/null --verbose printf
+test grep readonly "$@" readonly 'quoted text' | --verbose
+"$@" done test -eu export sed done 2>/dev/null
+		then $(pwd) echo grep x=1 awk echo echo cd 'quoted text' "$@" printf printf
+${HOME} x=1 then export local /usr/bin readonly
+echo 2>/dev/null /usr/bin
+		done printf printf x=1 ${HOME}
+printf test -eu cd $(pwd) $(pwd) && /usr/bin ${HOME} echo grep --verbose ${HOME}
+	echo | grep awk printf local echo done --verbose readonly awk test
+${HOME} --verbose grep /usr/bin | "$@"
+${HOME} "$1" sed 'quoted text'
+		echo "$1" cd "$@" export cd "$1" --verbose export | sed done $(pwd) cd test $(pwd)
+		test echo x=1 x=1 'quoted text' export 'quoted text' x=1 x=1 ${HOME} awk local
+${HOME} local "$1" then -eu sed then printf -eu 'quoted text'
+	"$1" ${HOME} echo grep --verbose export "$1" then $(pwd)
+cd "$1" "$1" local x=1 export "$1" ${HOME} sed x=1 --verbose /usr/bin cd then
+grep test local test ${HOME} --verbose | echo sed "$@" done ${HOME} "$1"
+		sed 2>/dev/null ${HOME} grep local 'quoted text' /usr/bin export
+	awk -eu -eu --verbose sed local --verbose
+		2>/dev/null "$@" readonly export
+		echo | && "$@" ${HOME} then "$@" sed echo printf
+	awk ${HOME} 2>/dev/null cd export $(pwd) | -eu 2>/dev/null
+		then readonly local local test x=1 readonly
+		echo --verbose readonly ${HOME} /usr/bin awk $(pwd)
+| /usr/bin readonly awk then export 'quoted text' cd then
+		'quoted text' 2>/dev/null -eu then
+	"$1" ${HOME} $(pwd) | 2>/dev/null
+| | | 'quoted text' "$1" cd then
+		${HOME} sed local grep $(pwd) 2>/dev/null printf cd "$@"
+		sed && | then awk grep done /usr/bin
+		${HOME} printf sed ${HOME} x=1 grep "$@" --verbose awk 2>/dev/null
+test done awk "$1" "$1"
+		awk export grep done -eu test awk x=1 grep done cd | sed -eu export
+cd local readonly ${HOME} 'quoted text' done x=1 printf
+		&& test 2>/dev/null 2>/dev/null
+	2>/dev/null 2>/dev/null -eu printf -eu printf /usr/bin | echo && done
+	"$1" awk cd "$@" awk -eu awk sed local x=1
+	/usr/bin sed ${HOME} 'quoted text' echo 2>/dev/null $(pwd) | ${HOME} "$@" 'quoted text'
+| readonly && && /usr/bin $(pwd) && -eu 'quoted text'
+printf ${HOME} sed ${HOME} readonly echo "$@" /usr/bin | &&
+x=1 -eu cd then then test test local then awk --verbose -eu && 2>/dev/null readonly
+	--verbose done --verbose then $(pwd) readonly echo 'quoted text' local
+	/usr/bin cd -eu "$@" 'quoted text' sed awk /usr/bin
+		readonly "$@" local "$@" sed test /usr/bin
+		${HOME} $(pwd) done cd "$1" local then 2>/dev/null "$@" local -eu echo 'quoted text'
+cd sed printf echo 2>/dev/null -eu sed ${HOME} "$@" cd grep -eu |
+		$(pwd) /usr/bin "$@" $(pwd) ${HOME}
+-eu "$@" $(pwd) "$@" "$@" cd grep cd --verbose test x=1 local 'quoted text'
+	done grep printf sed | "$@" 'quoted text'
+	export ${HOME} | grep sed /usr/bin done ${HOME} -eu "$@"
+&& grep -eu echo $(pwd) x=1 sed "$@" local local /usr/bin "$@" && awk test
+	grep awk -eu -eu "$1" echo export x=1 printf | $(pwd) printf
+	| grep 2>/dev/null local done | "$1" test ${HOME}
+local $(pwd) ${HOME} printf | "$1"
+		readonly cd export -eu /usr/bin cd awk echo export printf readonly
+	2>/dev/null --verbose --verbose then cd printf ${HOME} awk export awk
+test cd --verbose 'quoted text'
+		then grep then cd "$@" printf then 'quoted text' done export sed
+		"$1" --verbose x=1 grep --verbose 'quoted text' done /usr/bin /usr/bin && echo
+	readonly && 2>/dev/null --verbose /usr/bin
+	| grep --verbose then grep readonly test readonly
+	export done test then readonly readonly x=1
+'quoted text' "$1" export cd 'quoted text' done export && readonly printf
+	printf test && $(pwd) sed -eu "$@"
+		echo && /usr/bin "$@" "$@"
+		then "$@" then x=1 local 2>/dev/null --verbose readonly
+	done | test echo export ${HOME} && printf "$@"
+2>/dev/null ${HOME} printf 2>/dev/null
+	$(pwd) $(pwd) $(pwd) 2>/dev/null cd $(pwd) readonly 'quoted text' cd 'quoted text'
+		--verbose test 'quoted text' "$1"
+		'quoted text' grep "$1" "$@" then 'quoted text' echo awk grep then test
+	&& --verbose $(pwd) local echo "$1" cd export "$@" printf then
+&& $(pwd) test test x=1 sed && then printf then --verbose "$@" awk --verbose
+		then cd -eu readonly cd test cd "$@" x=1
+'quoted text' done 2>/dev/null test | "$@" awk ${HOME}
+		echo printf -eu && then local echo
+grep grep sed 'quoted text' "$1" sed echo 2>/dev/null $(pwd)
+	readonly readonly $(pwd) then x=1 2>/dev/null
+		local printf 'quoted text' $(pwd) | --verbose
+sed sed readonly 2>/dev/null
+		test done then grep x=1 cd awk grep && printf /usr/bin 'quoted text'
+	printf grep && export | x=1 -eu && /usr/bin
+echo 2>/dev/null /usr/bin cd /usr/bin
+		/usr/bin awk done cd then cd grep grep x=1 local sed "$@" ${HOME} -eu cd ${HOME}
+	"$1" 'quoted text' 'quoted text' readonly /usr/bin
+	cd grep ${HOME} readonly local local 'quoted text' x=1 ${HOME}
+		2>/dev/null then local local printf cd export awk awk printf ${HOME} 'quoted text'
+	then /usr/bin grep export --verbose /usr/bin
+printf "$1" --verbose done echo then echo -eu 'quoted text' grep test
+		done && then -eu test done export -eu echo 'quoted text' -eu
+then local 2>/dev/null local cd local "$1" | sed /usr/bin readonly
+	cd 'quoted text' grep | sed local awk cd "$@" then awk readonly readonly
+cd "$1" /usr/bin ${HOME} done then cd export done /usr/bin
+	"$1" -eu then x=1 cd x=1 'quoted text' /usr/bin /usr/bin $(pwd)
+	echo 2>/dev/null then "$1" "$@" -eu "$@" 2>/dev/null
+	awk "$1" && /usr/bin -eu |
+	done x=1 awk /usr/bin local export /usr/bin | /usr/bin test -eu
+	local export then test 'quoted text' 2>/dev/null ${HOME}
+		awk printf && export readonly grep && ${HOME} "$@" /usr/bin echo local local
+echo readonly 'quoted text'
+	$(pwd) --verbose /usr/bin $(pwd) done test export "$1" sed -eu
+		export /usr/bin grep -eu
+		&& echo local local test export
+	sed --verbose 2>/dev/null x=1
+${HOME} grep cd awk 'quoted text' echo printf
+		readonly cd echo local echo
+done "$@" "$1" echo --verbose local then done
+		test $(pwd) 2>/dev/null -eu export
+		$(pwd) then awk "$@" | --verbose sed echo && done ${HOME}
+${HOME} x=1 sed ${HOME} local local
+		${HOME} awk "$1" readonly echo printf 'quoted text'
+		export grep cd test | -eu ${HOME} awk printf x=1 2>/dev/null
+	awk -eu -eu printf --verbose test grep &&
+	--verbose test 'quoted text' awk sed printf x=1 "$1" $(pwd) readonly
+		test 2>/dev/null awk --verbose readonly | && sed grep readonly cd 'quoted text'
+		"$1" readonly ${HOME} local echo
+		local printf $(pwd) test $(pwd) grep
+		readonly grep && 'quoted text' ${HOME} | echo printf /usr/bin /usr/bin
+		then cd echo -eu 2>/dev/null done sed grep 'quoted text'
+		| cd x=1 export && --verbose | -eu then "$@" grep printf -eu
+	/usr/bin x=1 "$@" 2>/dev/null $(pwd) local
+"$@" cd x=1 && "$1" ${HOME} x=1 --verbose test
+		sed /usr/bin echo echo done readonly 2>/dev/null grep
+		awk then 'quoted text' echo "$@" "$@"
+"$1" --verbose "$@" | echo 2>/dev/null
+	echo readonly done $(pwd) done grep
+		${HOME} && echo $(pwd) echo /usr/bin grep 2>/dev/null x=1 done
+echo readonly sed awk echo awk ${HOME} x=1 "$@" "$1"
+		${HOME} readonly awk readonly then | done && "$1" x=1 2>/dev/null
+	grep grep 'quoted text' grep awk 'quoted text' $(pwd) "$1" cd "$1" --verbose done
+	local $(pwd) ${HOME} local x=1 && echo --verbose echo
+		"$@" /usr/bin "$1" $(pwd) /usr/bin echo
+-eu readonly 2>/dev/null "$@" $(pwd) test && done 2>/dev/null --verbose /usr/bin
+--verbose /usr/bin done 2>/dev/null
+		2>/dev/null 2>/dev/null printf then export "$@" local
+then awk awk | echo -eu 'quoted text' test readonly awk --verbose
+		-eu 2>/dev/null | "$@" /usr/bin 'quoted text' printf grep export echo /usr/bin
+sed export ${HOME} -eu 'quoted text'
+	--verbose done cd export $(pwd) $(pwd) readonly cd cd $(pwd) local &&
+	grep $(pwd) grep 'quoted text'
+		grep readonly 'quoted text' awk
+	awk | cd 2>/dev/null | awk grep -eu grep /usr/bin -eu --verbose $(pwd)
+	x=1 -eu printf readonly 2>/dev/null test && 2>/dev/null
+| done printf readonly "$@" 'quoted text'
+		2>/dev/null /usr/bin && && printf /usr/bin 2>/dev/null
+| grep then "$1" then x=1 2>/dev/null local grep grep
+		${HOME} /usr/bin cd "$@" local 'quoted text'
+		then 2>/dev/null grep 2>/dev/null
+		grep printf echo "$1" done echo "$1" | && local x=1 2>/dev/null awk | awk --verbose
+		x=1 -eu sed sed done | readonly -eu -eu
+-eu test local x=1 | export $(pwd) test 2>/dev/null cd sed
+		| done awk local | $(pwd) 'quoted text' $(pwd) x=1 grep
+printf printf cd 'quoted text'
+		--verbose | | then "$1" grep "$@" && | -eu "$@" done sed "$@" cd test --verbose
+	test grep readonly cd /usr/bin then export 'quoted text'
+done | printf | $(pwd) 'quoted text' then "$1" awk "$@" /usr/bin echo | echo ${HOME}
+x=1 awk grep ${HOME} -eu local grep
+/usr/bin readonly then 2>/dev/null -eu ${HOME} cd --verbose 2>/dev/null
+cd done | 2>/dev/null then sed test "$1" "$@"
+		grep x=1 "$@" "$1" echo
+		x=1 2>/dev/null "$1" 2>/dev/null $(pwd)
+/usr/bin export --verbose then 'quoted text' local readonly $(pwd)
+	'quoted text' done echo echo done then local && then --verbose
+		'quoted text' 2>/dev/null "$@" 2>/dev/null 2>/dev/null echo done -eu
+		/usr/bin grep echo $(pwd)
+	printf && -eu grep $(pwd) test 'quoted text' export && | ${HOME}
+		"$@" awk sed printf echo then local $(pwd) cd --verbose cd grep sed "$1"
+		| cd export then $(pwd) "$1" "$1" /usr/bin && test echo
+		${HOME} "$1" then $(pwd) test && "$@"
+local echo "$@" readonly cd sed export
+${HOME} local ${HOME} awk ${HOME} $(pwd) /usr/bin export "$1" local
+		'quoted text' $(pwd) readonly 2>/dev/null awk printf && awk ${HOME} echo 2>/dev/null
+echo 'quoted text' ${HOME} local grep -eu done | ${HOME} readonly /usr/bin && awk
+		printf x=1 -eu "$1" awk test printf x=1 -eu x=1
+		awk cd test echo 2>/dev/null test
+		/usr/bin grep local sed done 'quoted text'
+"$1" test grep local | 'quoted text' export
+	export export "$1" sed readonly "$@" $(pwd) && "$1" 'quoted text'
+cd readonly 2>/dev/null grep -eu printf --verbose 2>/dev/null
+local x=1 done $(pwd) export echo grep "$@" 'quoted text' export /usr/bin
+	echo echo | x=1 'quoted text' printf
+	printf grep local echo $(pwd) "$1" $(pwd) ${HOME} 'quoted text'
+${HOME} x=1 | local done
+		-eu echo --verbose | --verbose 'quoted text'
+	-eu 'quoted text' export test local ${HOME} 'quoted text' done
+		--verbose "$@" ${HOME} "$@" x=1 /usr/bin && x=1 -eu ${HOME} then
+${HOME} grep | cd /usr/bin then /usr/bin local $(pwd) export then 2>/dev/null
+export ${HOME} awk sed cd 'quoted text' "$@" local 2>/dev/null
+		printf | test test --verbose 2>/dev/null
+		awk && then local then sed $(pwd)
+		test local done | && echo export printf | echo "$@" "$1" printf export done
+cd readonly readonly /usr/bin "$1" done 'quoted text' test 'quoted text'
+${HOME} && "$1" "$1" ${HOME} x=1 "$1" $(pwd) echo
+	| done printf --verbose "$@" local "$1" && x=1 $(pwd) && ${HOME} x=1 2>/dev/null
+		${HOME} export $(pwd) export
+"$@" grep "$@" "$1" printf awk ${HOME} then local --verbose
+		awk && ${HOME} -eu test grep /usr/bin echo -eu awk 'quoted text'
+		done 'quoted text' done
+local done awk export awk | grep $(pwd) /usr/bin /usr/bin --verbose readonly
+	grep "$1" done then x=1 echo echo export /usr/bin awk | sed sed 'quoted text'
+		cd done readonly x=1 ${HOME} cd -eu | then cd readonly readonly 2>/dev/null
+2>/dev/null "$1" then /usr/bin readonly --verbose then readonly 'quoted text'
+	then test x=1 cd echo echo /usr/bin
+	| $(pwd) done then 'quoted text' cd printf export export export | echo x=1 grep
+		"$@" 'quoted text' 'quoted text' done $(pwd) awk printf
+done "$1" printf /usr/bin | echo
+	test /usr/bin -eu --verbose then done 'quoted text' x=1 cd ${HOME}
+		local done echo test printf x=1 echo x=1 echo sed 2>/dev/null cd && && cd export
+	sed "$@" then --verbose cd --verbose -eu then then --verbose grep x=1
+	--verbose readonly $(pwd)
+	x=1 sed ${HOME} then 'quoted text'
+x=1 readonly ${HOME} 'quoted text' /usr/bin cd printf 2>/dev/null
+		-eu then $(pwd) 'quoted text' local x=1 -eu sed 2>/dev/null cd echo local grep
+	"$@" $(pwd) then "$1"
+		done then then grep awk test
+&& local local readonly && awk readonly ${HOME} sed --verbose x=1 local
+	&& test export export | readonly --verbose /usr/bin printf awk done
+then echo "$1" "$1" then "$@" echo test -eu $(pwd) "$1" -eu
+		echo test && "$@" local
+		'quoted text' sed cd "$1"
+	/usr/bin /usr/bin grep printf 2>/dev/null test printf $(pwd)
+	&& 'quoted text' sed --verbose done grep export ${HOME}
+		"$1" cd cd readonly test 2>/dev/null --verbose then export cd -eu echo
+	printf ${HOME} -eu cd sed ${HOME} done done $(pwd) local export
+x=1 /usr/bin "$1" readonly "$@" ${HOME} echo
+		cd 2>/dev/null 2>/dev/null export "$@" ${HOME}
+x=1 ${HOME} -eu grep printf "$1"
+		echo then test ${HOME} 2>/dev/null -eu | awk test -eu "$1" --verbose then x=1
+${HOME} sed | test test | 'quoted text' ${HOME} ${HOME} readonly ${HOME} sed
+--verbose --verbose readonly
+echo 2>/dev/null readonly done grep echo 2>/dev/null
+	${HOME} 2>/dev/null 'quoted text' local "$@" printf && $(pwd) printf ${HOME}
+	"$@" then export echo test echo ${HOME} sed
+/usr/bin printf x=1 /usr/bin readonly 'quoted text' local 'quoted text'
+		2>/dev/null --verbose && 2>/dev/null -eu cd | test test echo test 2>/dev/null
+		"$@" /usr/bin "$1" echo /usr/bin export test |
+	/usr/bin sed grep --verbose done
+		grep $(pwd) test cd readonly x=1 then printf | then test
+		test x=1 echo 2>/dev/null --verbose readonly -eu $(pwd) done /usr/bin "$1" export
+	-eu printf -eu cd readonly 2>/dev/null then $(pwd) && && "$1"
+		'quoted text' -eu /usr/bin cd local | --verbose
+		cd 'quoted text' export && "$1" cd then echo test local $(pwd) 2>/dev/null
+	/usr/bin test 'quoted text' done |
+	--verbose ${HOME} printf | 'quoted text' echo printf --verbose | readonly && done
+	&& local /usr/bin local cd test then 'quoted text' $(pwd) "$@"
+	test 2>/dev/null printf echo $(pwd) sed /usr/bin echo "$@" | ${HOME}
+"$@" && sed -eu "$@" && 2>/dev/null && x=1 'quoted text' sed
+	then /usr/bin 'quoted text' readonly 'quoted text' x=1
+		-eu -eu -eu && printf cd grep 2>/dev/null echo
+		sed readonly "$@" echo "$1" 2>/dev/null 'quoted text' "$1" "$@" echo
+	done "$1" sed | | test export cd 2>/dev/null -eu
+		x=1 then | grep test sed 'quoted text' /usr/bin 'quoted text' export
+	"$@" && | "$1" 2>/dev/null export
+	| $(pwd) && readonly test cd 2>/dev/null readonly | 2>/dev/null "$1"
+	${HOME} export 2>/dev/null local local then echo local export echo -eu sed local
+		echo echo test echo /usr/bin done 'quoted text' done "$@" awk
+printf | $(pwd) printf printf --verbose readonly
+'quoted text' done awk 'quoted text' readonly "$@" | sed "$1"
+		export done test x=1 'quoted text' "$1" done 'quoted text' $(pwd) test -eu
+--verbose | printf test
+	then readonly awk 'quoted text' /usr/bin 'quoted text' readonly echo /usr/bin
+		"$1" | | then then printf ${HOME} $(pwd) printf 2>/dev/null
+"$@" && echo "$1" test done printf export
+then readonly x=1 2>/dev/null
+readonly sed export local
+		printf sed $(pwd) printf && echo "$1"
+		&& -eu readonly $(pwd) --verbose 2>/dev/null printf
+	-eu test grep /usr/bin x=1 test awk
+		x=1 sed export /usr/bin /usr/bin printf -eu cd /usr/bin echo readonly
+	-eu "$@" readonly echo grep "$1" /usr/bin local done
+	awk | 2>/dev/null ${HOME} ${HOME} grep 2>/dev/null
+	awk grep export local /usr/bin test 'quoted text' readonly
+		&& readonly /usr/bin | x=1 --verbose awk test && local printf
+		"$@" ${HOME} x=1 cd done then | cd ${HOME} $(pwd) local $(pwd) local readonly
+	readonly /usr/bin "$1" test ${HOME} local readonly && ${HOME} | readonly
+		grep ${HOME} $(pwd) grep local -eu --verbose
+		| readonly awk sed --verbose && --verbose -eu $(pwd)
+	done local then $(pwd) 'quoted text' 'quoted text'
+	'quoted text' --verbose grep awk awk done "$1" echo "$@" /usr/bin
+		"$@" "$@" cd /usr/bin $(pwd)
+		export --verbose "$@" sed echo "$1" "$1" | "$1" done
+		sed cd | cd ${HOME} awk 2>/dev/null "$@" ${HOME} local
+		| local | printf local x=1 2>/dev/null echo sed "$1" | --verbose | x=1
+	done sed local x=1 -eu awk
+	awk printf local awk && export local 2>/dev/null local export
+	local done done test then sed test | "$1" export printf "$1" export local && "$1"
+	$(pwd) done printf x=1 awk sed grep |
+	2>/dev/null | printf awk echo done
+"$1" 2>/dev/null /usr/bin sed export --verbose ${HOME} -eu 2>/dev/null grep -eu
+	printf ${HOME} test ${HOME}
+	cd grep done printf ${HOME}
+	echo done $(pwd) 'quoted text' /usr/bin -eu x=1 test | | readonly
+echo echo grep --verbose $(pwd)
+		awk ${HOME} $(pwd) && /usr/bin "$@" printf /usr/bin local test done readonly
+	done -eu cd then 'quoted text' | export --verbose echo && readonly /usr/bin 'quoted text'
+		sed test awk /usr/bin ${HOME} | | test local /usr/bin ${HOME} test "$1"
+		cd -eu && ${HOME} then && | --verbose --verbose
+		$(pwd) readonly sed readonly x=1 then 2>/dev/null -eu readonly
+		"$@" x=1 grep "$@" awk local then
+		export x=1 readonly 'quoted text' "$@" /usr/bin --verbose "$1" printf
+2>/dev/null /usr/bin echo --verbose sed ${HOME} grep export done 2>/dev/null
+| -eu /usr/bin sed -eu cd export export
+	cd 'quoted text' test 2>/dev/null awk
+	echo $(pwd) /usr/bin && export "$@" | cd done printf
+	then x=1 /usr/bin cd && x=1 done "$1"
+		$(pwd) printf $(pwd) ${HOME} "$1" ${HOME} "$@" sed && awk -eu
+	--verbose cd | then 'quoted text' | echo x=1 export export
+--verbose printf /usr/bin then grep -eu test echo
+		sed "$1" ${HOME} test echo echo 2>/dev/null
+echo cd done /usr/bin x=1 awk sed "$@" $(pwd) local ${HOME}
+	"$@" export export readonly 2>/dev/null done echo grep | -eu 'quoted text'
+	'quoted text' echo test test "$@" local awk /usr/bin
+	| -eu "$1" 2>/dev/null printf local
+x=1 | cd 2>/dev/null test 'quoted text' echo cd 'quoted text' ${HOME}
+		"$1" && "$@" awk then 'quoted text'
+	then x=1 printf echo "$@"
+		awk /usr/bin cd grep $(pwd) "$1" cd export printf && printf sed
+	then cd "$1" $(pwd) awk local printf 'quoted text'
+done then readonly x=1 | 'quoted text'
+		echo 2>/dev/null /usr/bin "$1" sed | 'quoted text'
+'quoted text' 2>/dev/null 'quoted text' -eu -eu
+--verbose grep grep grep 2>/dev/null then sed awk "$@" cd --verbose
+	"$1" grep "$1" sed /usr/bin sed "$1" sed "$1" test
+		sed "$1" && printf then "$@" printf --verbose
+done export local sed sed awk printf grep
+grep readonly 'quoted text' "$@" 2>/dev/null
+	'quoted text' sed sed grep 'quoted text' /usr/bin
+done printf -eu x=1 then -eu ${HOME} /usr/bin $(pwd) --verbose local then readonly
+		$(pwd) ${HOME} echo grep "$1"
+-eu 2>/dev/null -eu cd
+| printf "$@" readonly local "$1" grep 'quoted text'
+	sed printf local | awk then -eu | -eu 2>/dev/null -eu sed echo 'quoted text' $(pwd)
+2>/dev/null awk ${HOME} && --verbose export --verbose
+	/usr/bin done $(pwd) echo
+	2>/dev/null -eu x=1 grep && ${HOME} 2>/dev/null
+2>/dev/null -eu sed 2>/dev/null $(pwd) printf
+	"$@" x=1 then awk ${HOME} | readonly
+--verbose echo then readonly ${HOME} awk awk readonly
+		/usr/bin -eu test cd | done -eu | echo sed x=1 export
+		"$@" printf ${HOME} sed 'quoted text' -eu "$1" export local then local
+	'quoted text' "$1" | /usr/bin cd "$@" -eu
+	'quoted text' ${HOME} then $(pwd) awk then --verbose
+	then echo ${HOME} printf
+	${HOME} /usr/bin readonly test sed x=1 ${HOME} x=1
+		2>/dev/null readonly test cd printf 'quoted text' test
+	$(pwd) test readonly echo /usr/bin test 2>/dev/null -eu grep echo readonly x=1 echo
+2>/dev/null then --verbose 2>/dev/null
+	done readonly "$@" done | printf --verbose test 'quoted text' awk printf
+	awk readonly done export printf export done test x=1 local
+		export && | "$@" "$1" done echo
+then local -eu export awk /usr/bin export
+then echo local then printf local | && -eu 'quoted text' cd local ${HOME} local
+		local export printf export ${HOME} echo /usr/bin
+	&& "$1" readonly x=1 grep export
+		$(pwd) "$1" sed cd /usr/bin done && grep "$@" /usr/bin
+	done | done cd echo /usr/bin
+	"$@" /usr/bin x=1 printf
+		export local cd export 2>/dev/null ${HOME} 'quoted text'
+	"$1" done x=1 echo awk 'quoted text' "$@" sed echo test printf readonly
+		'quoted text' | && export done cd test ${HOME} $(pwd) awk 2>/dev/null $(pwd)
+test test export awk 2>/dev/null local done echo grep "$1" then ${HOME}
+	&& done --verbose sed --verbose readonly readonly
+		cd --verbose /usr/bin
+test x=1 echo && local cd done x=1 2>/dev/null
+export done | awk 2>/dev/null
+		--verbose cd 2>/dev/null x=1 test 'quoted text' printf && local -eu "$@" echo -eu
+	echo test | "$@" done test ${HOME} then x=1 readonly done export printf
+	-eu readonly "$@" then done printf
+		&& done local | echo sed awk done sed ${HOME} export readonly echo done "$1"
+	sed && printf -eu "$1" $(pwd) then ${HOME} && sed -eu test
+"$@" --verbose 2>/dev/null x=1 &&
+	printf ${HOME} awk done echo cd "$1" "$@" readonly x=1 x=1 &&
+	test $(pwd) grep then printf | then local | "$1" x=1 done /usr/bin |
+		sed x=1 /usr/bin --verbose test --verbose then
+		'quoted text' cd 'quoted text' /usr/bin
+		-eu "$@" -eu test local test done "$@"
+printf grep /usr/bin "$@" 2>/dev/null done
+2>/dev/null test echo done done awk
+cd "$1" readonly x=1 $(pwd) | "$@" done && echo
+	export 'quoted text' && then | local
+	export export "$1" ${HOME}
+then --verbose test echo echo done cd test done grep -eu 2>/dev/null
+x=1 --verbose export --verbose
+	&& 'quoted text' "$@" readonly /usr/bin -eu sed grep grep x=1 'quoted text' "$1"
+| -eu sed readonly "$1" grep --verbose sed export sed --verbose
+	x=1 "$1" "$1" $(pwd) 'quoted text' -eu then printf export
+		echo then local "$@" x=1 -eu cd -eu test 'quoted text' $(pwd) then 'quoted text'
+	${HOME} && export x=1 export ${HOME} $(pwd)
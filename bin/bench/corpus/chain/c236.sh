@@ -0,0 +1,2001 @@
+	"$1" "$@" grep x=1 grep grep echo --verbose "$@"
+	$(pwd) --verbose x=1 readonly
+		"$1" ${HOME} done 'quoted text' x=1 2>/dev/null printf x=1
+grep "$@" "$1" local test ${HOME} then grep cd printf sed | |
+	then "$1" then grep --verbose /usr/bin 'quoted text' grep
+2>/dev/null sed 'quoted text' cd && local /usr/bin
+	local 2>/dev/null $(pwd) cd grep cd | && 2>/dev/null grep local 'quoted text' done
+	-eu done local export /usr/bin cd -eu
+		test done "$@" ${HOME} awk 2>/dev/null awk printf
+	x=1 test cd echo "$1" readonly done
+		echo -eu && "$@" printf "$@" awk 2>/dev/null --verbose && -eu 2>/dev/null
+		readonly echo then printf && printf cd --verbose grep done 2>/dev/null
+	2>/dev/null export then test sed sed
+test && -eu 'quoted text' --verbose --verbose ${HOME} test &&
+		x=1 "$@" && echo x=1 -eu "$@" --verbose $(pwd) grep && x=1 'quoted text' && /usr/bin
+		$(pwd) echo local printf printf ${HOME} done readonly cd grep --verbose
+--verbose && "$1" readonly -eu sed "$@" -eu
+		/usr/bin --verbose test "$@" printf --verbose $(pwd)
+		"$1" --verbose x=1 test
+		done awk grep export readonly export --verbose | 'quoted text' /usr/bin |
+done "$1" done 2>/dev/null --verbose
+	/usr/bin 'quoted text' -eu sed 2>/dev/null "$1" | awk readonly printf
+'quoted text' ${HOME} | local --verbose done local
+	sed then cd done test -eu local
+'quoted text' cd done cd ${HOME} --verbose
+		--verbose printf export ${HOME} test /usr/bin local sed then done local readonly
+'quoted text' echo &&
+	echo done local test "$1" 2>/dev/null
+| -eu /usr/bin local x=1 'quoted text' grep test | && test
+cd 2>/dev/null echo "$@" 'quoted text' --verbose
+	-eu export /usr/bin ${HOME} $(pwd) cd
+		'quoted text' 2>/dev/null ${HOME} printf done /usr/bin
+		done cd /usr/bin awk grep then /usr/bin
+		done $(pwd) $(pwd) export local sed "$1" then "$@" readonly done
+--verbose cd /usr/bin done test 2>/dev/null
+	/usr/bin 'quoted text' grep done
+		readonly 'quoted text' awk export awk printf $(pwd) | | then test
+	"$1" printf readonly 'quoted text' grep export $(pwd) | "$1" awk 2>/dev/null
+&& echo -eu export export ${HOME} grep sed grep --verbose
+	echo 'quoted text' 2>/dev/null local echo sed done "$@" readonly test done
+'quoted text' grep export printf "$@" /usr/bin done sed awk 'quoted text'
+		done sed then readonly 'quoted text' --verbose | printf "$@" | grep grep
+$(pwd) then test 'quoted text' --verbose export readonly /usr/bin "$@" sed
+2>/dev/null | -eu done x=1 printf "$1" --verbose && export ${HOME} grep 2>/dev/null
+	cd /usr/bin cd /usr/bin /usr/bin done sed /usr/bin sed awk done $(pwd) -eu ${HOME}
+		&& "$1" | ${HOME} 2>/dev/null && 'quoted text'
+	| grep 2>/dev/null readonly --verbose
+${HOME} $(pwd) "$1" 'quoted text' sed "$1" x=1 echo readonly
+	echo readonly -eu test readonly 2>/dev/null "$1" 'quoted text'
+		/usr/bin then "$1" "$1" test export
+	export done "$@" printf test x=1 'quoted text'
+readonly | test local then | then
+	/usr/bin /usr/bin 2>/dev/null --verbose 2>/dev/null
+x=1 --verbose sed done 2>/dev/null printf
+	$(pwd) | printf --verbose export | --verbose
+		test readonly x=1 2>/dev/null then $(pwd) && x=1 |
+		echo ${HOME} $(pwd) $(pwd)
+		x=1 --verbose cd then $(pwd) /usr/bin local local -eu echo awk
+		then -eu sed sed printf printf done then then printf local grep
+	done sed printf export "$1" "$1" sed
+		"$@" export awk test local sed "$@"
+		x=1 readonly done && sed --verbose /usr/bin
+readonly test --verbose grep && x=1 done test done -eu 'quoted text'
+	"$@" awk then grep | awk --verbose 'quoted text' "$1" sed printf | | readonly
+		&& sed readonly readonly 'quoted text'
+		"$1" local printf test printf
+		export test 'quoted text' grep cd && x=1 grep local printf
+		printf --verbose $(pwd) sed readonly
+	&& ${HOME} local | awk $(pwd) awk cd sed -eu ${HOME} 'quoted text' "$1" grep
+		'quoted text' export && | /usr/bin -eu | sed readonly "$1" --verbose readonly
+--verbose readonly then grep export done awk
+done 2>/dev/null ${HOME} 'quoted text' --verbose sed ${HOME} &&
+	echo echo /usr/bin cd 2>/dev/null "$@" "$1" /usr/bin awk ${HOME} readonly grep
+	local awk cd test grep ${HOME}
+	/usr/bin 2>/dev/null local "$1" grep 'quoted text' --verbose
+$(pwd) then sed done 'quoted text' 2>/dev/null ${HOME} cd "$1" /usr/bin x=1
+	'quoted text' printf test echo test awk readonly
+		done then readonly 'quoted text'
+		local "$1" "$@" echo -eu /usr/bin local | && $(pwd) --verbose
+	${HOME} 2>/dev/null ${HOME} |
+	--verbose local $(pwd) $(pwd) 'quoted text' "$@"
+	echo sed readonly -eu then 'quoted text' "$@" local $(pwd) grep grep 2>/dev/null
+then 2>/dev/null grep test "$@" /usr/bin sed readonly done --verbose
+	--verbose "$1" awk sed -eu &&
+	export awk | readonly | /usr/bin then printf
+x=1 --verbose "$1" printf 2>/dev/null
+		"$1" 'quoted text' grep echo ${HOME} export then
+		grep $(pwd) printf sed grep && readonly test echo test
+		$(pwd) awk "$1" x=1 then | local test echo
+	then /usr/bin 'quoted text' local cd then export sed
+&& 'quoted text' --verbose export cd ${HOME} export "$1" cd "$@" x=1
+readonly $(pwd) sed sed then -eu && -eu sed ${HOME} /usr/bin
+	export local local x=1 readonly echo awk "$@" | 2>/dev/null &&
+	$(pwd) "$1" echo | echo sed | 2>/dev/null sed | 'quoted text' cd "$@"
+-eu local grep then echo local x=1 "$1" readonly
+echo --verbose done awk done grep local /usr/bin cd echo
+	cd --verbose -eu test printf |
+	cd | export "$1" done --verbose test
+	'quoted text' done -eu | 'quoted text' 2>/dev/null done done 2>/dev/null
+echo 2>/dev/null done readonly then $(pwd) grep $(pwd)
+		then export local grep
+		&& echo export | grep export awk
+		&& "$1" ${HOME} --verbose echo | local 2>/dev/null $(pwd)
+	&& local readonly grep && "$@" awk readonly x=1 printf printf
+-eu | 2>/dev/null --verbose
+	$(pwd) awk then test echo
+/usr/bin then 'quoted text' cd local grep grep $(pwd) sed
+		&& | sed /usr/bin 'quoted text'
+--verbose printf cd x=1 printf test --verbose x=1 test &&
+	cd local "$@" ${HOME} ${HOME} x=1 "$@" readonly awk --verbose
+		export test --verbose cd --verbose then local readonly sed
+	2>/dev/null printf grep 'quoted text' "$@" export ${HOME} "$1" printf
+grep "$1" grep 2>/dev/null
+	sed /usr/bin "$@" cd /usr/bin export local sed test readonly
+cd | ${HOME} export sed echo -eu && "$1" printf done then $(pwd) export
+		&& printf local 'quoted text' grep "$@"
+		/usr/bin --verbose --verbose | awk readonly
+	then "$1" readonly "$@" cd ${HOME} awk printf printf | awk local local
+	"$1" export export "$1" readonly sed ${HOME} ${HOME} && "$1" sed test awk | cd
+	--verbose echo $(pwd) -eu 'quoted text' then 'quoted text' --verbose readonly --verbose
+${HOME} echo done readonly
+		readonly 'quoted text' cd then printf -eu && export
+		/usr/bin ${HOME} 'quoted text' "$@" echo test
+local "$@" -eu -eu then |
+-eu ${HOME} printf grep
+"$@" "$1" 'quoted text' 2>/dev/null then export && export $(pwd)
+	grep done grep readonly -eu "$@" && local "$1" 'quoted text' | sed done ${HOME}
+$(pwd) test sed "$1" "$1" echo && done readonly --verbose x=1 | done
+printf "$1" && cd readonly x=1 test echo test -eu -eu /usr/bin
+		sed && echo export awk | --verbose
+	sed $(pwd) "$1" x=1 local /usr/bin /usr/bin awk "$1" /usr/bin
+		"$1" --verbose ${HOME} $(pwd) --verbose cd grep /usr/bin && export then test
+"$@" 'quoted text' && && "$@"
+export $(pwd) sed done 2>/dev/null 'quoted text' 2>/dev/null $(pwd) -eu /usr/bin
+		$(pwd) readonly 'quoted text' sed readonly |
+	2>/dev/null --verbose "$@"
+local ${HOME} grep echo export readonly ${HOME} "$1" $(pwd) printf echo export
+		-eu 2>/dev/null ${HOME} printf x=1 --verbose
+	readonly ${HOME} "$1" test sed | test awk
+	${HOME} --verbose --verbose
+	printf /usr/bin cd grep grep "$1" /usr/bin grep --verbose
+		cd x=1 grep printf 'quoted text'
+	--verbose readonly sed x=1 "$@" export then x=1 'quoted text'
+	done done --verbose printf "$1"
+x=1 --verbose done ${HOME}
+printf echo "$@" cd ${HOME} test -eu grep "$1" readonly readonly grep
+	then "$1" local | done done awk | export local $(pwd) done
+	${HOME} test local --verbose export echo x=1 x=1 printf sed 2>/dev/null 2>/dev/null
+grep awk local grep then awk cd echo /usr/bin cd grep test cd x=1
+	$(pwd) 'quoted text' && /usr/bin then local 'quoted text' "$1"
+	"$@" readonly | export then readonly
+grep x=1 /usr/bin 'quoted text'
+/usr/bin then echo -eu cd ${HOME} then awk test echo "$1" && printf test export
+-eu awk then x=1 awk "$1" echo grep /usr/bin 2>/dev/null printf done awk 2>/dev/null
+test && | echo | ${HOME} && --verbose printf
+grep 2>/dev/null --verbose -eu | "$@" printf "$1" export ${HOME} cd -eu 'quoted text'
+	awk awk -eu sed "$1" local awk "$@" cd grep cd | -eu --verbose then
+		${HOME} "$1" -eu --verbose "$@" 'quoted text' sed --verbose readonly
+		awk 2>/dev/null local ${HOME} -eu 2>/dev/null grep echo readonly 'quoted text' sed
+$(pwd) readonly sed 'quoted text' cd && -eu ${HOME} done local -eu "$1" && then
+	--verbose $(pwd) echo grep echo 2>/dev/null local ${HOME}
+"$1" grep cd awk /usr/bin printf then "$@" && cd
+		cd export grep echo awk /usr/bin awk "$1" test done echo local
+	cd ${HOME} done printf && echo then test -eu 2>/dev/null x=1 done
+	'quoted text' test test
+done -eu "$@" 2>/dev/null then x=1 "$1" /usr/bin
+		cd echo 'quoted text' "$1" x=1 then && $(pwd) "$@" then && awk echo x=1 --verbose
+local $(pwd) sed $(pwd) | && awk x=1 printf local "$@" test $(pwd)
+		local "$@" ${HOME} | sed sed x=1 /usr/bin printf
+-eu awk then grep done | test sed test
+then awk /usr/bin /usr/bin local awk then 'quoted text' -eu
+	x=1 ${HOME} "$1" "$1" -eu done awk then && && test test /usr/bin
+awk && awk then grep $(pwd) export done ${HOME}
+	sed $(pwd) && x=1 && && done awk $(pwd) sed awk echo "$1"
+		local local /usr/bin readonly "$1" local grep echo
+x=1 "$1" x=1 "$1" ${HOME} --verbose | then cd | readonly --verbose test export
+		x=1 2>/dev/null grep 'quoted text' "$1" | export export awk local -eu
+	printf x=1 $(pwd) awk
+	| "$1" cd local $(pwd) && then && cd export 'quoted text' | "$@"
+	readonly awk done --verbose cd -eu
+		/usr/bin printf "$@" echo readonly 2>/dev/null
+	| 'quoted text' printf 2>/dev/null 2>/dev/null x=1 "$@" local done x=1
+cd readonly "$1" grep | -eu local awk test sed 2>/dev/null
+		2>/dev/null grep then x=1 x=1 sed local $(pwd) cd && done
+then printf then test --verbose cd $(pwd) printf
+		test done | printf export 2>/dev/null ${HOME} printf | then && then local
+echo | $(pwd) cd cd echo "$@" 2>/dev/null ${HOME} ${HOME}
+	| ${HOME} 'quoted text' ${HOME} awk x=1 "$1" "$1"
+	${HOME} echo x=1 --verbose "$1" x=1 test --verbose printf printf
+	${HOME} $(pwd) 'quoted text' local -eu /usr/bin | then x=1 ${HOME} -eu sed
+		readonly readonly local export then "$@"
+	'quoted text' 'quoted text' x=1
+	awk | local then | ${HOME} cd "$1" then done
+| test "$@" 'quoted text' test local test
+	awk -eu awk test "$@" export cd ${HOME}
+	awk local local local printf then /usr/bin
+	export 'quoted text' then x=1 local grep test
+		&& | done awk $(pwd) export && 2>/dev/null
+		"$1" "$1" echo && printf -eu --verbose then 'quoted text' readonly
+test 'quoted text' grep --verbose cd printf && grep -eu --verbose
+	test --verbose export export cd readonly -eu 'quoted text' export
+&& done 'quoted text' | printf echo /usr/bin && grep "$1" echo
+	grep local then then "$1" x=1 -eu -eu awk awk printf "$@" local
+local && done && done "$@" /usr/bin $(pwd) 'quoted text'
+		"$@" ${HOME} test /usr/bin 2>/dev/null /usr/bin "$1"
+-eu 2>/dev/null local echo ${HOME} grep
+/usr/bin done export $(pwd) readonly done grep test 2>/dev/null 'quoted text'
+${HOME} sed "$1" 'quoted text' /usr/bin then
+awk awk then export /usr/bin done readonly then sed readonly
+"$1" -eu && x=1 /usr/bin 'quoted text' $(pwd) printf grep | --verbose
+		cd "$1" done local local export
+	printf "$1" x=1 grep && x=1 "$@" 2>/dev/null test local
+export x=1 cd "$@" test "$1" --verbose 'quoted text' then /usr/bin
+	test 'quoted text' $(pwd) done $(pwd)
+"$@" done sed test export && -eu sed
+	test 2>/dev/null test 2>/dev/null
+sed done 2>/dev/null awk done /usr/bin && local echo "$1" -eu printf
+		printf printf $(pwd) then "$1" "$1" "$@" grep readonly
+	sed awk -eu printf grep test echo --verbose done test test 'quoted text'
+	'quoted text' test ${HOME} printf "$@" 2>/dev/null
+	printf echo x=1 "$@" 'quoted text' test local $(pwd) 'quoted text'
+	'quoted text' sed -eu 'quoted text' $(pwd) 2>/dev/null
+		test export readonly test 2>/dev/null awk "$@" then && --verbose "$@" -eu
+2>/dev/null test | readonly echo test done printf sed printf 'quoted text'
+	$(pwd) test "$1" x=1 $(pwd) | /usr/bin local --verbose awk export
+	&& "$1" then test echo grep ${HOME} awk
+x=1 --verbose then readonly && echo | then awk /usr/bin test then 'quoted text'
+then awk done -eu 2>/dev/null
+		test local sed $(pwd) 'quoted text'
+	export test echo x=1 test /usr/bin -eu
+	test /usr/bin 2>/dev/null /usr/bin $(pwd) local "$@"
+cd awk --verbose printf echo
+printf echo echo grep grep grep test echo then --verbose
+sed 'quoted text' readonly && && test then -eu x=1 $(pwd)
+		"$@" echo "$1" "$@" local grep && sed $(pwd) cd
+&& $(pwd) export --verbose 2>/dev/null
+/usr/bin x=1 printf && export $(pwd)
+		local test "$1" ${HOME} sed "$1" readonly export cd -eu export readonly test
+		${HOME} then 2>/dev/null --verbose "$@" /usr/bin sed
+--verbose cd "$1" | 'quoted text'
+$(pwd) "$@" local && 2>/dev/null && | x=1 ${HOME} --verbose then
+/usr/bin then export "$1" ${HOME}
+	-eu done $(pwd) /usr/bin --verbose
+	then printf -eu 2>/dev/null -eu ${HOME} echo cd "$1" "$@" ${HOME}
+		then x=1 echo done done | --verbose readonly $(pwd) test && local local --verbose
+	readonly readonly --verbose awk awk grep --verbose --verbose 'quoted text'
+test echo "$1" done /usr/bin done readonly
+cd -eu local grep ${HOME}
+"$@" /usr/bin -eu awk x=1 "$1" | x=1 echo && --verbose 2>/dev/null export
+		local -eu ${HOME} cd grep printf local export awk then -eu x=1 echo
+		'quoted text' --verbose /usr/bin | /usr/bin
+	2>/dev/null 2>/dev/null grep test | cd export -eu -eu /usr/bin
+-eu && /usr/bin "$1" readonly readonly "$@" local export
+echo && "$1" readonly -eu sed | -eu && $(pwd) 2>/dev/null
+"$@" cd printf local grep done then local "$1" 'quoted text' "$1" x=1 "$@" 2>/dev/null
+	local test "$@" && && 2>/dev/null 2>/dev/null "$1"
+		grep "$@" --verbose done local echo then --verbose --verbose "$@" x=1 'quoted text'
+		grep 2>/dev/null | done test --verbose $(pwd)
+"$@" "$1" ${HOME} x=1 2>/dev/null $(pwd) local echo -eu x=1 /usr/bin x=1 --verbose
+then printf 'quoted text' sed -eu
+awk && cd "$@" -eu --verbose --verbose awk done $(pwd) --verbose "$@"
+$(pwd) local --verbose -eu 'quoted text' done sed
+-eu cd /usr/bin ${HOME} --verbose -eu
+		awk 'quoted text' --verbose /usr/bin sed then | then 2>/dev/null /usr/bin
+	${HOME} local && cd readonly awk "$@" "$@" done
+2>/dev/null done "$@" "$@" test ${HOME} 2>/dev/null 'quoted text' 2>/dev/null
+		$(pwd) export x=1 export --verbose "$@" /usr/bin grep
+	sed 2>/dev/null | 2>/dev/null
+	$(pwd) cd local 2>/dev/null
+	cd | && cd --verbose x=1 ${HOME} sed --verbose -eu | --verbose done done
+		readonly export x=1 x=1 then 'quoted text' grep --verbose --verbose
+		"$@" 'quoted text' test | echo sed -eu x=1 sed grep -eu cd | export awk
+		/usr/bin "$1" $(pwd) local export --verbose /usr/bin done | export
+		then then awk printf cd export 'quoted text' readonly
+		echo && awk local 'quoted text' --verbose
+		printf && test ${HOME} sed readonly 2>/dev/null
+	2>/dev/null test "$1" "$1" 2>/dev/null --verbose
+"$1" readonly local | 'quoted text' printf cd echo "$@" printf $(pwd) then
+&& echo ${HOME} && echo "$1" ${HOME} "$@" | --verbose --verbose
+	test --verbose done echo
+		&& "$@" then readonly export test sed awk
+		grep done awk local printf then readonly "$1" awk local -eu local export sed
+		cd export done done done done /usr/bin && awk readonly $(pwd) -eu done test
+local grep cd 'quoted text' 'quoted text'
+printf grep printf test done sed
+	cd awk local --verbose echo --verbose
+| then --verbose 'quoted text' x=1 test sed "$1" && sed &&
+	"$1" grep sed $(pwd) $(pwd) printf 'quoted text' local ${HOME}
+	test /usr/bin printf test | local export
+		awk -eu readonly 'quoted text' grep "$@" awk 2>/dev/null ${HOME}
+	-eu echo x=1 2>/dev/null "$@" grep "$@" "$@" 'quoted text' local "$1" "$@"
+		/usr/bin sed "$@" awk $(pwd) local ${HOME} printf sed -eu awk "$@" sed $(pwd)
+		${HOME} awk cd sed export awk --verbose then
+readonly printf | readonly "$@" local /usr/bin $(pwd) done
+then && 2>/dev/null grep export local 2>/dev/null
+	then 2>/dev/null -eu 'quoted text' echo /usr/bin cd "$1"
+	$(pwd) local $(pwd) then "$1" sed test local sed $(pwd) --verbose
+		awk | /usr/bin local | | local
+sed /usr/bin cd "$@" | x=1 "$1" -eu then printf cd readonly echo
+then done "$1" readonly grep readonly local "$1" done grep
+	x=1 grep "$@" 2>/dev/null ${HOME} x=1 "$1" readonly
+	sed --verbose grep awk local then $(pwd) $(pwd)
+	printf export --verbose echo readonly printf export
+		then test test done readonly 'quoted text' $(pwd)
+		&& 2>/dev/null sed cd ${HOME} x=1 && $(pwd) ${HOME}
+	export | local awk printf grep test "$1" /usr/bin | then -eu then
+	sed then ${HOME} "$@" | "$@" | | | 'quoted text' local "$1" | cd awk $(pwd)
+&& printf ${HOME} awk done
+		| 2>/dev/null $(pwd) printf x=1 echo "$1" 'quoted text' "$1" echo cd -eu 'quoted text'
+done --verbose printf ${HOME} "$1" 2>/dev/null 'quoted text'
+	x=1 grep cd printf /usr/bin
+printf 'quoted text' "$1" then test && -eu local done export -eu test
+readonly | local 2>/dev/null
+	${HOME} 2>/dev/null ${HOME} echo $(pwd) readonly $(pwd) 'quoted text' test
+| $(pwd) grep cd printf then local $(pwd) "$1" $(pwd) printf cd 'quoted text'
+		x=1 awk export -eu readonly export test export awk |
+		printf -eu --verbose grep
+	echo "$@" "$@" cd sed sed
+		$(pwd) test cd sed $(pwd) cd --verbose awk --verbose
+	x=1 'quoted text' done x=1 grep printf
+	x=1 x=1 printf --verbose
+	export && -eu cd "$@" "$1" export done grep awk ${HOME} 2>/dev/null grep
+	&& printf 2>/dev/null export grep && then cd | echo 'quoted text' cd readonly
+awk cd $(pwd) grep 2>/dev/null | 'quoted text' 2>/dev/null done
+local test "$@" printf awk 2>/dev/null sed readonly
+		sed -eu awk awk local --verbose
+		awk export "$@" --verbose -eu 'quoted text'
+		2>/dev/null readonly grep readonly | && grep printf && sed printf sed
+test echo x=1 local done cd sed then "$1" | && test "$1" $(pwd) x=1 echo
+	readonly /usr/bin local $(pwd) test 'quoted text' echo printf echo
+echo "$1" "$1" readonly local "$@" awk x=1 && --verbose && /usr/bin 'quoted text'
+		2>/dev/null local done -eu test done cd done "$@" cd "$@" --verbose
+'quoted text' readonly 2>/dev/null "$@" test awk test cd
+| export --verbose export -eu printf echo then
+export then -eu printf $(pwd) 2>/dev/null echo ${HOME}
+	export x=1 awk 2>/dev/null sed 2>/dev/null local
+cd | --verbose "$@" $(pwd) done echo
+		"$@" export local "$1" ${HOME} 'quoted text'
+	x=1 "$1" cd sed echo export
+	/usr/bin 'quoted text' cd -eu local echo awk readonly
+	sed echo 'quoted text' -eu "$1" | x=1
+		awk 2>/dev/null | | echo "$1" test grep export readonly -eu $(pwd) 'quoted text'
+		sed cd /usr/bin /usr/bin 2>/dev/null grep readonly /usr/bin
+local -eu "$1" $(pwd) then 'quoted text' export sed /usr/bin
+	$(pwd) $(pwd) | cd export "$@" test x=1 sed done grep local $(pwd) "$@" ${HOME}
+readonly "$1" "$1" $(pwd) && $(pwd) | printf export then 2>/dev/null | awk
+		"$1" printf /usr/bin grep then readonly /usr/bin awk "$@" then -eu --verbose
+	readonly x=1 readonly -eu
+sed -eu 2>/dev/null 'quoted text' grep $(pwd) readonly readonly
+	x=1 sed 2>/dev/null readonly
+	x=1 -eu --verbose test ${HOME} 'quoted text'
+'quoted text' then then done --verbose 2>/dev/null cd ${HOME}
+cd readonly then done grep test export test "$1" -eu
+		-eu export grep ${HOME} echo echo printf
+"$1" $(pwd) ${HOME} | sed 'quoted text' x=1 test
+		2>/dev/null local /usr/bin /usr/bin --verbose x=1 grep local
+	| /usr/bin "$1" 'quoted text' ${HOME} x=1 done "$@"
+		&& 'quoted text' test grep 2>/dev/null export "$@" readonly x=1 |
+| ${HOME} x=1 "$@" $(pwd) test -eu cd | 'quoted text' then "$@" "$@" local
+	awk readonly printf local ${HOME} sed local
+	"$1" printf && $(pwd) readonly && "$@" readonly
+		2>/dev/null echo readonly printf -eu 2>/dev/null --verbose cd local 'quoted text'
+grep --verbose local cd echo "$@" printf "$1" echo
+		x=1 readonly awk x=1 x=1
+		/usr/bin done sed 'quoted text' readonly -eu readonly awk
+	2>/dev/null sed --verbose sed 'quoted text' echo --verbose awk | echo
+	awk && -eu cd awk "$1" cd "$1" done awk done test
+done export local && ${HOME} "$1" readonly
+	$(pwd) $(pwd) -eu sed export printf "$1" x=1
+done export grep test ${HOME} awk printf
+local x=1 | sed echo sed "$@"
+	"$@" "$@" --verbose x=1 "$1"
+-eu export echo "$@" /usr/bin awk echo printf local
+/usr/bin awk grep printf ${HOME} | printf done done echo "$1"
+		"$@" awk local cd export
+| -eu readonly cd ${HOME} $(pwd) export "$@" echo printf cd local && export
+		--verbose export /usr/bin "$1" cd cd cd local -eu printf
+		then 2>/dev/null 'quoted text' $(pwd) local done export cd then local
+		2>/dev/null sed printf -eu
+/usr/bin test && 'quoted text' local sed /usr/bin "$@" | $(pwd)
+| readonly | | /usr/bin
+		printf echo then grep local x=1 test /usr/bin then
+		/usr/bin readonly $(pwd) printf awk ${HOME} awk printf -eu $(pwd)
+		export grep x=1 | sed printf $(pwd)
+	$(pwd) --verbose /usr/bin cd done readonly grep awk "$@" echo && done --verbose
+| | then 2>/dev/null local 2>/dev/null
+		| awk | echo "$@" local awk sed 2>/dev/null then ${HOME} "$1"
+	| x=1 done grep 2>/dev/null sed printf "$1" --verbose
+	-eu $(pwd) 'quoted text'
+"$@" test printf x=1 readonly x=1 readonly
+		"$@" "$1" && && $(pwd) -eu | x=1 printf $(pwd) --verbose then test 2>/dev/null
+		test && | printf "$1" export ${HOME}
+	--verbose done "$1" echo x=1
+	echo done echo && $(pwd) echo printf --verbose --verbose
+sed grep x=1 local readonly grep | "$1" && -eu then done grep done | printf
+local echo | 'quoted text' -eu --verbose | test
+	--verbose cd readonly -eu echo
+	cd x=1 x=1 /usr/bin local x=1 ${HOME} | -eu grep -eu $(pwd) ${HOME} sed --verbose
+		printf --verbose then && x=1 test
+echo x=1 $(pwd) 'quoted text'
+"$1" x=1 && then then /usr/bin then --verbose $(pwd) then awk 2>/dev/null
+'quoted text' done 2>/dev/null ${HOME} awk grep grep && test grep
+		then $(pwd) x=1 'quoted text'
+-eu done "$1" ${HOME} grep done 'quoted text' /usr/bin
+printf $(pwd) | local ${HOME} cd sed x=1 sed 'quoted text' cd ${HOME} test x=1
+&& readonly /usr/bin test export sed $(pwd) printf readonly export
+x=1 readonly echo $(pwd)
+	--verbose grep -eu sed printf --verbose
+		cd -eu done -eu local ${HOME} printf readonly local printf
+	test test ${HOME} sed $(pwd) local $(pwd) echo
+	test local echo done -eu 2>/dev/null -eu then cd sed echo sed x=1 printf
+export && && 2>/dev/null readonly $(pwd) && | cd awk printf
+'quoted text' grep echo x=1 local
+		readonly readonly && export -eu 2>/dev/null
+test ${HOME} then $(pwd) local echo echo local
+		-eu printf /usr/bin then | grep cd printf $(pwd)
+	local -eu && "$1" 2>/dev/null
+	$(pwd) | /usr/bin printf cd $(pwd) ${HOME} /usr/bin "$@"
+x=1 printf "$1" then "$@" awk /usr/bin done readonly printf export
+	sed echo x=1 "$1" test printf test -eu local local sed 'quoted text'
+	&& echo "$@" export awk "$1" 2>/dev/null "$@" echo
+&& ${HOME} /usr/bin readonly && --verbose
+awk -eu done echo local 'quoted text' && "$@"
+	test echo cd 2>/dev/null cd | -eu sed
+		export then 2>/dev/null
+		-eu 'quoted text' sed --verbose then 2>/dev/null "$1" ${HOME} cd && | | "$1"
+| $(pwd) echo local awk 'quoted text' 'quoted text' done | grep ${HOME}
+	--verbose "$1" ${HOME} --verbose && export then test ${HOME} then printf
+	cd export -eu --verbose ${HOME} then "$@" | done x=1 local --verbose sed
+grep 'quoted text' echo test -eu ${HOME} "$1" /usr/bin /usr/bin $(pwd)
+"$1" awk 'quoted text' $(pwd) awk | $(pwd) printf && |
+		local | ${HOME} echo cd then --verbose ${HOME} export $(pwd)
+		"$@" && "$1" "$1" cd printf done
+	"$@" "$1" x=1 awk done ${HOME}
+cd awk 'quoted text' awk $(pwd)
+	printf export | then 2>/dev/null
+	2>/dev/null $(pwd) cd /usr/bin $(pwd) -eu && 2>/dev/null /usr/bin export x=1
+	done 'quoted text' export readonly export | sed grep printf sed cd 2>/dev/null
+local echo sed then 'quoted text' local
+	x=1 grep readonly ${HOME} x=1 local x=1
+		| test /usr/bin awk 'quoted text' $(pwd) export cd $(pwd) export
+		done && done cd readonly | printf
+		--verbose x=1 done /usr/bin readonly then 2>/dev/null
+		export then "$@" export x=1 export 'quoted text' "$@"
+	x=1 test sed readonly 2>/dev/null grep sed ${HOME} | 'quoted text' x=1 && printf
+	/usr/bin echo awk export --verbose
+	x=1 | ${HOME} local then $(pwd) | done
+	sed --verbose /usr/bin "$@" 'quoted text' sed /usr/bin grep
+$(pwd) x=1 readonly && then done done && then grep $(pwd) local
+	-eu awk x=1 "$@" grep grep
+"$@" done "$1" export && sed "$@" | /usr/bin /usr/bin $(pwd) printf --verbose $(pwd)
+		| ${HOME} ${HOME} echo then -eu awk done test test then "$@" test /usr/bin |
+	export grep then echo | --verbose -eu
+		awk ${HOME} printf "$1" ${HOME}
+/usr/bin grep "$1" printf
+		printf && | export "$1" export /usr/bin | $(pwd) then local test
+"$1" cd done "$1" ${HOME}
+sed --verbose 2>/dev/null ${HOME} $(pwd) done
+x=1 done x=1 'quoted text' | x=1 export
+	test --verbose cd echo "$@" done "$@" readonly
+	/usr/bin sed | grep | --verbose
+		sed $(pwd) ${HOME} --verbose
+	local sed echo ${HOME} awk local cd awk --verbose
+		export then cd done -eu 'quoted text'
+echo "$@" -eu $(pwd) printf done done "$1" --verbose 'quoted text' 'quoted text'
+		done cd 'quoted text' && | 2>/dev/null x=1 sed test
+then -eu x=1 x=1 grep done readonly export
+		${HOME} ${HOME} && awk cd test
+done 'quoted text' "$@"
+| ${HOME} "$@" export then
+		local --verbose | --verbose
+	-eu --verbose /usr/bin readonly $(pwd) && cd "$1" awk readonly readonly 2>/dev/null
+		cd cd --verbose export --verbose grep "$@" export -eu --verbose
+	export "$@" sed 'quoted text'
+printf then "$@" 2>/dev/null test awk echo then awk test echo "$@" local
+		--verbose && test printf echo test /usr/bin
+local /usr/bin /usr/bin awk x=1 | /usr/bin readonly awk sed
+		cd echo test ${HOME} awk "$1" "$1" ${HOME} ${HOME} then
+	echo sed "$@" $(pwd) printf then cd readonly
+		then readonly --verbose readonly grep printf echo 2>/dev/null then "$1" 2>/dev/null
+"$@" echo sed --verbose "$1" | then 2>/dev/null
+	"$1" && "$@" && export printf x=1 local echo 2>/dev/null grep $(pwd) -eu echo
+		--verbose && printf -eu awk 'quoted text' && test done "$@" done "$@" grep done
+		x=1 test x=1 sed ${HOME} export then x=1 | cd && sed | 'quoted text' export
+&& "$@" x=1 awk awk $(pwd) -eu x=1 echo 'quoted text'
+	readonly 2>/dev/null cd "$@" echo && cd /usr/bin
+2>/dev/null $(pwd) /usr/bin export ${HOME}
+	sed 2>/dev/null test done
+		${HOME} $(pwd) awk local --verbose
+		done local | x=1 x=1 x=1 && --verbose then local test grep 2>/dev/null
+		sed local ${HOME} --verbose 2>/dev/null test ${HOME} awk --verbose ${HOME}
+		--verbose /usr/bin --verbose | -eu
+		test | 2>/dev/null | grep test export
+local done local readonly
+	readonly 'quoted text' x=1
+	grep sed then awk $(pwd) then test $(pwd) ${HOME} sed local
+printf printf ${HOME} cd readonly printf export 'quoted text' export awk
+		2>/dev/null && /usr/bin grep printf "$@" readonly
+	local test echo printf done printf "$1"
+$(pwd) export printf then "$1" 2>/dev/null 'quoted text'
+"$1" then --verbose 'quoted text' readonly
+sed export 'quoted text' readonly
+	printf $(pwd) grep 'quoted text' test grep done then --verbose export
+		printf sed echo echo cd && /usr/bin done | export ${HOME} sed
+	&& /usr/bin 'quoted text' awk 2>/dev/null
+	then 2>/dev/null x=1 cd grep ${HOME} x=1 then echo "$@" ${HOME} echo
+		--verbose -eu grep | echo done grep done 'quoted text' x=1
+		"$1" | $(pwd) grep &&
+		"$@" x=1 readonly -eu then sed
+	&& printf && done cd x=1 cd && export cd test printf "$1" ${HOME}
+		| | printf cd && done 2>/dev/null -eu grep $(pwd) $(pwd) grep -eu | local
+	2>/dev/null test done printf 'quoted text' x=1
+"$1" 'quoted text' x=1 2>/dev/null cd x=1 echo "$1" -eu "$1"
+	then 'quoted text' "$1" ${HOME} printf readonly echo 'quoted text'
+	x=1 test "$@" -eu awk grep /usr/bin
+	readonly "$1" grep printf $(pwd) test sed grep
+		--verbose done && then test awk 2>/dev/null
+	cd cd readonly cd | "$1" export 'quoted text' 2>/dev/null
+printf 'quoted text' && echo 2>/dev/null readonly | 'quoted text' sed
+		export readonly | -eu grep "$@" $(pwd) cd cd
+	echo printf test "$1" "$1" &&
+	sed && | -eu -eu test -eu printf && --verbose "$1" 2>/dev/null
+		/usr/bin grep /usr/bin -eu 2>/dev/null then cd $(pwd) /usr/bin done readonly
+	test /usr/bin local grep 'quoted text' "$1"
+sed export $(pwd) cd export ${HOME} --verbose local x=1 local --verbose
+	/usr/bin --verbose | cd done grep export /usr/bin printf grep readonly $(pwd) |
+		then readonly $(pwd) then echo cd test && $(pwd) && ${HOME} $(pwd) "$@" grep
+done then grep export awk done | --verbose sed 2>/dev/null 'quoted text' cd
+${HOME} test awk -eu awk done /usr/bin local x=1 test done
+		| awk readonly test sed 2>/dev/null test 'quoted text' 'quoted text'
+		done -eu 'quoted text' --verbose && export then
+	x=1 && "$@" $(pwd) printf export -eu local && --verbose --verbose then ${HOME}
+		cd test local cd readonly ${HOME} -eu grep | $(pwd) 'quoted text'
+		'quoted text' 'quoted text' echo /usr/bin | cd sed | /usr/bin "$@" "$1"
+		printf 'quoted text' &&
+test $(pwd) -eu echo done $(pwd) "$1" cd "$1" printf
+	done 'quoted text' export
+	echo awk ${HOME} "$1" | ${HOME} echo export x=1 | 2>/dev/null
+test 2>/dev/null ${HOME} "$@" test
+echo --verbose export export --verbose grep
+		'quoted text' awk local export
+	then "$@" local 'quoted text' && cd $(pwd) done "$@" test test
+	x=1 "$1" $(pwd) "$1" test /usr/bin
+printf -eu cd -eu then 'quoted text' local /usr/bin
+	cd "$@" -eu printf local test ${HOME} grep x=1 export 'quoted text' ${HOME}
+		readonly echo 'quoted text' cd awk $(pwd) 2>/dev/null test
+$(pwd) sed grep awk then /usr/bin
+$(pwd) printf -eu x=1 then awk export
+	-eu echo ${HOME} grep /usr/bin cd export x=1 | printf 'quoted text'
+	"$1" echo 2>/dev/null "$@"
+&& local -eu "$@" $(pwd)
+		echo "$@" grep /usr/bin && "$@" x=1 && printf sed test grep export | -eu /usr/bin
+		${HOME} | ${HOME} | | $(pwd) --verbose $(pwd) 'quoted text' echo x=1 grep
+	awk --verbose "$@" | grep export -eu local echo sed x=1 grep
+	2>/dev/null 'quoted text' 'quoted text' /usr/bin grep -eu 2>/dev/null
+		&& -eu 2>/dev/null test x=1 /usr/bin 2>/dev/null readonly
+		sed test | -eu done /usr/bin
+	--verbose && test "$@" export /usr/bin x=1 local readonly
+	test && echo | test printf echo "$1" "$1" local sed && 'quoted text'
+then && then awk ${HOME} then "$1" 2>/dev/null && 2>/dev/null
+test 'quoted text' awk awk echo sed
+	done grep --verbose 2>/dev/null $(pwd) "$1" "$@" 'quoted text' cd then
+		awk $(pwd) | readonly "$@" local "$1"
+	x=1 then /usr/bin "$@" x=1 test 2>/dev/null 2>/dev/null && then
+		&& x=1 ${HOME} --verbose && --verbose then 2>/dev/null | && $(pwd)
+echo "$1" 'quoted text' echo echo 'quoted text'
+		awk ${HOME} 2>/dev/null grep 2>/dev/null 2>/dev/null awk echo cd then 2>/dev/null
+	--verbose test printf $(pwd) awk | "$1" 2>/dev/null
+	cd "$@" awk -eu printf export && printf x=1 printf | -eu echo
+		${HOME} printf echo -eu then "$@" 2>/dev/null
+		| printf ${HOME} && && test test export done done readonly -eu local
+"$@" 'quoted text' && test /usr/bin printf "$1" && ${HOME}
+echo export export export x=1 'quoted text' test "$@" && local $(pwd)
+		'quoted text' awk grep $(pwd) 2>/dev/null 2>/dev/null 2>/dev/null "$1"
+	x=1 test awk readonly "$@"
+		&& printf | -eu test x=1 printf $(pwd) -eu export readonly
+sed echo "$@" echo readonly "$1" x=1 done "$@" && then local readonly
+$(pwd) done && ${HOME} sed &&
+		done done "$@" then cd "$@" | "$@" grep --verbose /usr/bin printf then $(pwd)
+readonly | "$@" /usr/bin export printf -eu ${HOME} "$1" done
+	&& ${HOME} && && -eu readonly 2>/dev/null
+		&& 2>/dev/null $(pwd) && 'quoted text' 'quoted text' local
+-eu readonly x=1 done -eu && 'quoted text' readonly | ${HOME}
+		sed then x=1 sed test done -eu export $(pwd) sed sed && "$@"
+--verbose cd sed "$1" "$@" "$1" echo "$1" | sed && -eu -eu export
+		then export printf "$@" echo && local
+	"$@" | awk "$@" done awk
+	grep cd then 2>/dev/null readonly echo 2>/dev/null test sed then "$@" 'quoted text'
+	"$1" | "$@" awk grep 2>/dev/null | printf echo
+	export --verbose /usr/bin /usr/bin
+grep x=1 then ${HOME} ${HOME} | export
+	then cd export | -eu awk sed cd sed ${HOME}
+-eu echo awk -eu test && printf
+	${HOME} printf ${HOME} "$@" 'quoted text' ${HOME} grep
+		/usr/bin && local done cd /usr/bin 2>/dev/null sed
+done --verbose x=1 $(pwd) && then --verbose readonly
+		test sed local ${HOME} "$@" readonly awk
+	printf local local readonly then
+	test "$@" readonly then ${HOME} $(pwd) "$@" done && /usr/bin then awk done /usr/bin
+		grep readonly && "$@" | echo && "$@" "$@" 'quoted text' awk readonly ${HOME}
+2>/dev/null ${HOME} /usr/bin
+		"$1" "$1" echo test 'quoted text' 'quoted text' printf && 'quoted text' sed readonly
+		grep "$@" 'quoted text' printf x=1 | 'quoted text'
+&& x=1 "$@" $(pwd) 'quoted text' then 2>/dev/null
+		grep cd readonly --verbose
+		done echo printf awk echo local x=1 /usr/bin --verbose
+	test done -eu grep x=1 cd printf 2>/dev/null /usr/bin x=1 2>/dev/null /usr/bin
+		awk echo echo && /usr/bin test awk
+	readonly sed "$@" awk "$1" --verbose
+	-eu printf /usr/bin 'quoted text' ${HOME} readonly cd 'quoted text'
+done 2>/dev/null sed ${HOME} awk
+	then export 'quoted text' x=1 cd "$@" 'quoted text' 'quoted text'
+	printf done sed test awk awk
+-eu -eu "$@" "$@" | printf export /usr/bin local sed "$@" awk echo --verbose sed
+		$(pwd) then --verbose done cd grep $(pwd) | ${HOME} ${HOME} && 2>/dev/null
+	echo 'quoted text' printf awk local /usr/bin
+echo /usr/bin printf | test "$@" ${HOME} "$1" "$1" readonly "$@" awk
+	export local x=1 2>/dev/null "$1" "$@" echo echo echo done
+		sed cd export done ${HOME}
+		readonly 'quoted text' 'quoted text' "$@" ${HOME} x=1 --verbose
+-eu local 2>/dev/null /usr/bin
+	awk test test ${HOME} 'quoted text' printf "$1" ${HOME} ${HOME}
+	echo 2>/dev/null --verbose 'quoted text' printf local "$1"
+	echo /usr/bin export 'quoted text' test done local ${HOME} readonly "$@" /usr/bin
+	printf 2>/dev/null cd done "$@" grep 2>/dev/null export local 'quoted text' awk
+	x=1 done /usr/bin echo 2>/dev/null --verbose
+		'quoted text' export $(pwd)
+		readonly "$1" x=1 sed done 'quoted text'
+		x=1 $(pwd) x=1 "$@" done grep
+test $(pwd) ${HOME} readonly $(pwd) grep grep readonly cd test "$@" echo 'quoted text'
+		"$1" | 'quoted text' x=1 -eu /usr/bin -eu export cd readonly awk x=1 ${HOME} export
+		"$1" printf 'quoted text' export x=1 local --verbose "$@" x=1
+		'quoted text' test ${HOME} -eu sed readonly --verbose echo echo echo /usr/bin
+	then "$1" /usr/bin /usr/bin
+	/usr/bin then echo -eu cd --verbose 2>/dev/null
+export readonly done then x=1 "$@" "$1" --verbose
+	awk readonly readonly
+	printf && sed 'quoted text' --verbose x=1 2>/dev/null grep "$@" done "$@" local
+		"$1" cd "$@" 'quoted text'
+/usr/bin | --verbose $(pwd) grep $(pwd) cd /usr/bin
+cd sed -eu cd "$1" -eu "$@" printf sed awk "$1" awk "$1" printf
+	&& printf done 'quoted text'
+	/usr/bin x=1 "$@" printf local -eu cd &&
+/usr/bin "$1" "$1" readonly printf printf export "$1" printf /usr/bin
+local done | readonly done echo done done $(pwd) 'quoted text' done 2>/dev/null
+readonly -eu then awk
+	--verbose done echo -eu grep awk printf | | ${HOME}
+"$1" printf sed && done -eu 2>/dev/null $(pwd) local
+	echo done "$1" local sed -eu printf
+sed -eu -eu echo cd 'quoted text' 2>/dev/null test 2>/dev/null 2>/dev/null
+	then done echo | && ${HOME} x=1 then done $(pwd) 2>/dev/null
+		then echo export printf test | --verbose
+		printf awk cd echo && x=1 printf ${HOME} local grep
+| --verbose | printf echo --verbose sed sed grep 2>/dev/null
+	'quoted text' $(pwd) --verbose sed
+	export echo $(pwd) | done --verbose
+		grep grep "$1" grep printf printf /usr/bin "$1" "$@" test x=1
+	'quoted text' ${HOME} test x=1 local -eu /usr/bin
+	"$1" test --verbose && 'quoted text'
+		sed | export awk awk
+"$1" done readonly -eu then cd done -eu x=1 | echo
+| local 2>/dev/null grep sed echo x=1 echo cd -eu done then readonly 'quoted text'
+		"$@" $(pwd) done 2>/dev/null
+	done local cd awk printf /usr/bin echo
+	awk echo awk && 2>/dev/null done readonly sed
+	2>/dev/null --verbose 'quoted text'
+	awk awk && 2>/dev/null 2>/dev/null 2>/dev/null "$1" then && cd | cd $(pwd)
+		grep $(pwd) $(pwd) readonly "$1" | grep sed
+	grep sed export done x=1 /usr/bin --verbose x=1 cd grep 2>/dev/null
+		awk 'quoted text' awk && cd
+		/usr/bin 2>/dev/null && --verbose $(pwd) echo readonly "$@" $(pwd) grep /usr/bin
+		echo ${HOME} 'quoted text' done printf
+	sed test printf local grep done test "$1" "$1" cd -eu --verbose then "$1"
+"$@" grep /usr/bin 'quoted text'
+	sed export then echo ${HOME} sed export grep /usr/bin grep
+	export readonly ${HOME} readonly -eu &&
+&& local export 2>/dev/null test && 'quoted text' && done export local sed
+		then 'quoted text' grep export
+		${HOME} echo $(pwd) test $(pwd) echo && test 'quoted text' test ${HOME} 2>/dev/null
+	awk | grep $(pwd) done &&
+	export "$1" test sed cd "$@" $(pwd) echo echo export printf
+	awk /usr/bin printf echo grep local export ${HOME} x=1 awk /usr/bin
+		readonly --verbose then --verbose $(pwd) $(pwd) printf /usr/bin
+readonly && --verbose /usr/bin local x=1 && ${HOME} echo
+		"$@" done test cd | readonly
+		echo 2>/dev/null readonly local && $(pwd)
+	/usr/bin grep grep /usr/bin 'quoted text'
+	grep ${HOME} | | | ${HOME} ${HOME} x=1 echo printf readonly local --verbose
+	$(pwd) test then 2>/dev/null done awk awk -eu readonly 2>/dev/null
+	echo local export awk grep readonly
+$(pwd) x=1 $(pwd) then readonly
+	&& test 2>/dev/null sed
+	x=1 sed then printf -eu | readonly
+	echo x=1 "$1" 2>/dev/null done local 'quoted text' ${HOME}
+	readonly done export | ${HOME} echo $(pwd) cd && cd -eu grep local --verbose
+readonly x=1 -eu 'quoted text' -eu readonly
+&& x=1 local -eu -eu then printf cd | local /usr/bin awk | done
+readonly local ${HOME}
+	sed ${HOME} 2>/dev/null grep $(pwd)
+		local cd /usr/bin /usr/bin grep export 2>/dev/null | "$@"
+		local local done local test
+		/usr/bin grep | echo --verbose -eu && 2>/dev/null then sed $(pwd) $(pwd) printf
+		2>/dev/null x=1 readonly done --verbose "$1" /usr/bin awk sed 2>/dev/null readonly
+	grep | -eu /usr/bin x=1 local "$1" local 'quoted text' sed echo local cd /usr/bin
+"$@" "$1" then && awk
+	&& -eu test | /usr/bin ${HOME} && echo sed "$@" 2>/dev/null printf local --verbose
+	| && 'quoted text' done done 2>/dev/null x=1 grep then "$1" ${HOME}
+	"$@" 'quoted text' grep export awk printf
+		"$1" grep readonly $(pwd) done && | test cd sed 2>/dev/null done sed echo $(pwd)
+cd x=1 "$1" done 'quoted text' then 2>/dev/null /usr/bin sed
+${HOME} "$@" done x=1 done ${HOME}
+	echo cd grep then x=1 cd -eu && sed 'quoted text' /usr/bin export /usr/bin
+		then 2>/dev/null sed | -eu awk done $(pwd) printf
+	cd local $(pwd) cd -eu 'quoted text' -eu 'quoted text' && done done 'quoted text'
+		'quoted text' 2>/dev/null "$@" "$@" --verbose done -eu ${HOME}
+	| local sed echo --verbose /usr/bin x=1 --verbose 'quoted text'
+	x=1 then /usr/bin local sed awk 'quoted text'
+	readonly test printf 'quoted text' && /usr/bin cd readonly
+		readonly sed | grep cd echo then ${HOME} "$1" 'quoted text' awk done sed grep done
+		-eu 'quoted text' done test awk local
+	awk ${HOME} /usr/bin then -eu then 2>/dev/null
+		printf /usr/bin 2>/dev/null
+	sed "$1" then ${HOME} sed readonly "$@" 'quoted text' /usr/bin
+		| test && ${HOME} x=1 "$1" "$1" grep -eu test readonly readonly
+grep done 2>/dev/null local 2>/dev/null
+		$(pwd) 2>/dev/null test 2>/dev/null then sed /usr/bin echo 2>/dev/null
+	| export --verbose sed readonly
+	"$@" ${HOME} | awk -eu sed readonly 2>/dev/null test ${HOME}
+		&& grep | --verbose "$1" sed awk "$1" 'quoted text' && ${HOME} local export
+	x=1 "$1" "$1" awk sed --verbose 2>/dev/null | printf
+		test x=1 x=1 -eu cd -eu /usr/bin /usr/bin "$@" export export 'quoted text'
+export done | -eu cd | grep "$@" -eu sed -eu 2>/dev/null printf then test awk
+	done printf -eu sed $(pwd) "$1" then "$@" --verbose export then | ${HOME}
+test $(pwd) ${HOME} export --verbose 2>/dev/null
+		${HOME} echo cd then "$1" x=1
+		local "$1" && printf local --verbose x=1 export && local then
+	test cd then -eu 2>/dev/null x=1 $(pwd) sed --verbose sed
+$(pwd) 2>/dev/null | echo $(pwd) 'quoted text' grep test && cd sed x=1 awk
+awk done cd --verbose $(pwd) $(pwd) 'quoted text'
+done /usr/bin echo printf local test local | grep | ${HOME} readonly done
+| local awk done test "$@" "$@" test export
+test printf then $(pwd)
+x=1 "$@" printf awk printf && local --verbose /usr/bin ${HOME} | -eu
+	echo x=1 local readonly then done /usr/bin -eu readonly then done done done
+printf /usr/bin ${HOME} test test -eu echo "$@" -eu local --verbose
+	x=1 sed done local grep "$@" local awk "$@" sed 2>/dev/null
+grep local "$@" readonly cd "$@" | test sed "$1" /usr/bin
+		awk sed local printf
+	cd awk sed 2>/dev/null local local 'quoted text' -eu local 'quoted text'
+		grep test echo local x=1 printf
+		then awk awk $(pwd) /usr/bin
+local && echo /usr/bin "$1" local ${HOME} $(pwd) "$@" --verbose
+	"$1" --verbose cd --verbose && done
+		$(pwd) echo readonly | grep x=1 $(pwd) printf awk then
+	export $(pwd) grep sed done cd 2>/dev/null awk ${HOME} readonly
+		/usr/bin cd | test echo $(pwd) | export 2>/dev/null ${HOME}
+		--verbose awk | then cd test local
+	x=1 sed then | cd $(pwd) /usr/bin
+		| cd "$1" done $(pwd) done echo && done "$@" test
+		2>/dev/null 2>/dev/null x=1
+awk && ${HOME} sed ${HOME} printf
+--verbose printf x=1 x=1 awk printf grep 'quoted text' /usr/bin --verbose
+sed cd done cd 'quoted text' 'quoted text' 'quoted text' then done export test
+	"$@" printf ${HOME} "$@" --verbose $(pwd) local
+		x=1 printf $(pwd) done test 2>/dev/null && /usr/bin
+sed export | printf export -eu test
+		then ${HOME} --verbose printf 2>/dev/null -eu readonly 2>/dev/null --verbose awk
+	-eu /usr/bin grep 2>/dev/null test echo
+	2>/dev/null ${HOME} export sed grep $(pwd) done test "$1" &&
+		done && grep test "$1" local awk ${HOME} readonly --verbose local
+		awk grep grep 2>/dev/null -eu local "$1" cd /usr/bin
+	"$1" $(pwd) cd && printf readonly cd
+	x=1 2>/dev/null local "$@" grep export
+/usr/bin "$1" && x=1 && /usr/bin $(pwd) x=1 "$1" then
+--verbose done "$@" then -eu ${HOME} echo export
+	"$1" 2>/dev/null x=1 && grep "$1" cd x=1 grep cd sed /usr/bin | 2>/dev/null
+		then grep "$@" && sed local export 2>/dev/null export export x=1
+		${HOME} -eu local echo --verbose local grep readonly x=1 "$@" 2>/dev/null ${HOME}
+		export echo echo ${HOME} &&
+		/usr/bin printf echo 'quoted text' done $(pwd) local x=1 cd
+	readonly printf --verbose x=1 printf then /usr/bin export
+		&& test "$@" echo 2>/dev/null
+	"$@" x=1 $(pwd) /usr/bin 'quoted text' "$@" cd "$1" sed done x=1 then awk grep 2>/dev/null
+		/usr/bin sed 'quoted text' cd
+${HOME} /usr/bin export
+		export x=1 test done grep local sed 2>/dev/null test && sed
+| grep $(pwd) printf /usr/bin test done 2>/dev/null then
+test cd export | cd cd
+	"$1" "$@" test 2>/dev/null export && | readonly "$1" /usr/bin /usr/bin -eu
+		--verbose test printf /usr/bin $(pwd) -eu x=1 $(pwd) echo
+		echo readonly awk readonly then 2>/dev/null |
+cd x=1 sed awk local sed && "$@" echo done printf
+		then export 'quoted text' ${HOME} | "$@"
+	${HOME} done | grep | local done echo --verbose -eu ${HOME}
+	export && export awk local $(pwd) x=1 "$@" /usr/bin 'quoted text'
+x=1 /usr/bin echo /usr/bin /usr/bin export
+| 2>/dev/null cd sed "$1"
+		awk done local awk ${HOME} sed --verbose $(pwd) -eu
+	cd 2>/dev/null | grep x=1 ${HOME} && readonly cd export local
+		awk readonly grep "$1" awk ${HOME} -eu done awk export then && done
+		grep export "$1" x=1 sed $(pwd) test -eu /usr/bin /usr/bin test grep awk cd cd 'quoted text'
+	test /usr/bin cd local --verbose /usr/bin grep then 2>/dev/null grep x=1
+		awk ${HOME} readonly done grep --verbose test cd local local 2>/dev/null
+'quoted text' /usr/bin grep export "$1" sed sed
+		"$1" sed ${HOME} awk "$@" awk &&
+		${HOME} x=1 grep export awk sed "$1" ${HOME} $(pwd)
+local echo then test printf --verbose 'quoted text' /usr/bin
+	export && 'quoted text' readonly --verbose | printf "$@" readonly ${HOME} 2>/dev/null
+		--verbose -eu then local 'quoted text' grep --verbose
+	readonly export cd 'quoted text' export && echo "$@"
+		2>/dev/null printf --verbose readonly echo -eu 2>/dev/null && test
+	x=1 grep "$1" cd && 'quoted text' test ${HOME} "$1" done readonly "$1"
+	$(pwd) 'quoted text' echo cd local cd then 2>/dev/null $(pwd) local test awk 2>/dev/null
+/usr/bin && | -eu done cd -eu sed sed
+${HOME} done ${HOME} | && && 2>/dev/null -eu cd 'quoted text'
+cd local 2>/dev/null echo 'quoted text' local test "$1" x=1 sed echo readonly
+${HOME} then 2>/dev/null 2>/dev/null export done
+	| local cd && ${HOME} && sed $(pwd) readonly "$@" then -eu | grep cd 'quoted text'
+	--verbose 2>/dev/null test
+		/usr/bin /usr/bin 'quoted text' "$1" "$1" readonly "$@"
+	printf x=1 local then "$@" --verbose | awk
+/usr/bin grep test grep echo awk && x=1 | test cd
+	test --verbose "$1" $(pwd) --verbose 'quoted text' x=1 --verbose x=1 printf
+grep "$@" x=1 $(pwd) awk | && /usr/bin cd export x=1 $(pwd) 2>/dev/null
+		x=1 "$1" done -eu printf test 2>/dev/null echo echo x=1 /usr/bin done
+		"$1" awk sed done readonly local | 'quoted text' awk 2>/dev/null
+	awk && 'quoted text' sed test cd ${HOME} printf grep cd awk grep cd
+&& cd "$@" done $(pwd) ${HOME} export local printf printf printf
+	test sed readonly "$@" local ${HOME} done && test awk "$1" ${HOME} 'quoted text'
+		-eu "$1" readonly "$@" echo done then
+		/usr/bin 2>/dev/null $(pwd)
+		'quoted text' echo $(pwd) 'quoted text' done "$@"
+		-eu awk -eu echo awk then $(pwd) "$1" grep test then /usr/bin "$@" "$1"
+	-eu "$1" -eu ${HOME} && --verbose --verbose x=1 printf export
+	-eu printf done test local
+	done "$@" readonly grep && export
+		&& echo test 2>/dev/null printf "$@" x=1 /usr/bin then echo /usr/bin
+	printf && && "$1" grep -eu cd done && printf --verbose
+		&& export then "$1" -eu $(pwd) 2>/dev/null | test "$1" awk 2>/dev/null /usr/bin
+		printf $(pwd) --verbose 2>/dev/null
+	2>/dev/null && printf test done && x=1
+	'quoted text' 2>/dev/null 2>/dev/null
+grep awk -eu sed then "$1" local grep "$1" ${HOME}
+	awk cd x=1 grep sed ${HOME}
+	printf x=1 grep && then "$@" && "$@" grep
+	"$@" "$@" "$@" cd done export "$@" --verbose /usr/bin
+	--verbose awk "$1" sed 'quoted text' test export local readonly then 'quoted text'
+	x=1 "$1" grep x=1 /usr/bin cd x=1 | $(pwd) done printf 2>/dev/null done "$@"
+$(pwd) printf --verbose awk readonly
+	readonly local ${HOME} x=1 | 'quoted text' cd printf local && done
+--verbose then awk | cd -eu 2>/dev/null awk readonly grep done
+then 2>/dev/null awk -eu export "$1" && done then "$@" 2>/dev/null done --verbose
+	$(pwd) local readonly 'quoted text' --verbose x=1 --verbose readonly grep
+	local 2>/dev/null test echo -eu | echo x=1 "$@" 2>/dev/null awk printf cd grep
+"$@" && x=1 | awk done 'quoted text' echo test && 2>/dev/null ${HOME} 'quoted text'
+	$(pwd) -eu grep | sed readonly |
+	local awk "$@" then done 'quoted text' cd then readonly ${HOME}
+cd && x=1 --verbose echo cd awk ${HOME} x=1 awk sed &&
+		local /usr/bin grep $(pwd) "$1" "$1" grep
+		printf 2>/dev/null "$1" $(pwd) grep sed 2>/dev/null
+		'quoted text' cd test 2>/dev/null
+	awk grep | export /usr/bin ${HOME} printf && then local 'quoted text' && &&
+then $(pwd) -eu grep "$@" test -eu /usr/bin
+	-eu /usr/bin test 2>/dev/null 'quoted text' awk test sed 'quoted text' ${HOME}
+readonly awk sed grep "$@" "$@" then 'quoted text'
+		--verbose && done awk grep 2>/dev/null readonly "$1" export
+		grep /usr/bin grep x=1 awk cd
+echo then && then | && /usr/bin -eu
+	local export printf && $(pwd) sed awk printf | 2>/dev/null printf
+		then "$1" then -eu printf then printf local --verbose
+		done --verbose test export "$1" --verbose local $(pwd) local test
+	"$1" 2>/dev/null 'quoted text'
+	awk sed readonly $(pwd) ${HOME} "$1" done grep ${HOME} /usr/bin ${HOME} local
+		grep sed -eu "$@" 2>/dev/null printf ${HOME}
+		awk 2>/dev/null grep then "$1"
+awk grep -eu --verbose x=1 "$1" done --verbose test |
+awk grep "$1" ${HOME} && -eu x=1 export echo
+		awk grep ${HOME} -eu && ${HOME} echo /usr/bin done ${HOME} local x=1 readonly
+	2>/dev/null "$1" test export 2>/dev/null && test x=1 /usr/bin 'quoted text'
+${HOME} ${HOME} cd $(pwd) x=1 sed sed x=1 cd done
+local --verbose grep echo awk --verbose "$@"
+local readonly --verbose "$1" "$@" &&
+	readonly x=1 "$@" -eu x=1 local -eu readonly then sed awk grep
+		${HOME} "$1" $(pwd) && awk "$@" "$1" cd ${HOME} /usr/bin x=1
+done done 'quoted text' 'quoted text' awk x=1 | -eu "$1" test $(pwd)
+| && && && readonly done grep ${HOME} printf && ${HOME}
+		"$@" cd && ${HOME} ${HOME} $(pwd) awk
+	printf printf -eu test
+		'quoted text' echo && readonly $(pwd) test /usr/bin $(pwd) then
+		${HOME} test "$@" awk x=1 "$@" 2>/dev/null $(pwd) --verbose local $(pwd) $(pwd)
+2>/dev/null export done --verbose export x=1 test x=1 -eu && echo then grep
+	'quoted text' export readonly local
+		then /usr/bin readonly export awk then -eu cd ${HOME} grep
+	then done "$@" echo grep --verbose | grep -eu 2>/dev/null
+		${HOME} test --verbose 2>/dev/null done x=1 printf grep test /usr/bin -eu "$1"
+&& test cd | export "$1" $(pwd) echo
+"$1" export readonly $(pwd) 'quoted text' sed -eu -eu done "$@"
+		sed && cd readonly echo | /usr/bin
+		done local $(pwd) sed local $(pwd) "$1" 'quoted text' then x=1 'quoted text'
+	&& then test $(pwd) echo export export && sed readonly local $(pwd)
+		| 'quoted text' cd $(pwd) test readonly "$@" cd |
+echo && then | export $(pwd) -eu sed grep cd /usr/bin awk "$1" test 'quoted text'
+readonly cd then test local /usr/bin "$1" -eu && echo
+	printf x=1 "$1" $(pwd) -eu then ${HOME}
+test cd echo -eu && /usr/bin local test 2>/dev/null export 2>/dev/null readonly
+echo 'quoted text' cd "$1" 2>/dev/null echo | && printf
+		sed awk grep cd "$1" cd "$1"
+echo 'quoted text' printf x=1 cd --verbose readonly
+		printf ${HOME} --verbose 'quoted text'
+	sed awk cd sed cd 2>/dev/null readonly test $(pwd) 'quoted text'
+		${HOME} && awk export sed grep x=1 -eu
+		export done readonly then grep $(pwd)
+	done then cd then cd "$1" -eu && && ${HOME} ${HOME}
+		/usr/bin $(pwd) readonly done "$1" awk local then $(pwd)
+&& "$@" $(pwd) 'quoted text' "$1" ${HOME} awk
+	'quoted text' local echo "$1" echo 2>/dev/null
+printf $(pwd) --verbose && /usr/bin sed local sed /usr/bin 2>/dev/null | cd |
+	$(pwd) ${HOME} "$1" 2>/dev/null sed then awk readonly ${HOME} readonly --verbose
+	done test cd ${HOME} ${HOME} printf && "$1" grep -eu echo awk &&
+	grep then awk 2>/dev/null 'quoted text' ${HOME} awk printf 2>/dev/null
+		printf done $(pwd) && readonly $(pwd)
+		| --verbose cd readonly cd done printf
+	then printf done cd 2>/dev/null
+		/usr/bin then done done sed
+	cd 2>/dev/null | $(pwd) readonly --verbose
+x=1 x=1 $(pwd) awk x=1 /usr/bin echo
+		awk && "$1" -eu | "$1" -eu 2>/dev/null $(pwd) test export test test awk $(pwd)
+		"$1" /usr/bin sed awk /usr/bin local "$@"
+sed cd --verbose export echo "$1" echo -eu && then | --verbose --verbose | --verbose
+	grep echo cd 'quoted text' -eu && sed --verbose /usr/bin "$1" then then awk cd cd
+	&& local printf $(pwd) "$1" ${HOME} 'quoted text' --verbose readonly then
+	| ${HOME} echo readonly "$1" printf --verbose awk test test
+	'quoted text' /usr/bin $(pwd) -eu "$@" sed 'quoted text' /usr/bin --verbose
+&& --verbose -eu 'quoted text' local
+	local readonly 2>/dev/null -eu ${HOME}
+	'quoted text' awk sed "$1"
+		-eu --verbose echo readonly 'quoted text' printf | then awk printf
+		awk "$@" | 2>/dev/null then echo
+	&& then test then && "$1" readonly echo
+	x=1 test ${HOME} 'quoted text' test sed awk grep local
+		local awk export && cd "$@" 'quoted text' echo -eu --verbose readonly
+	| x=1 'quoted text' readonly "$1" "$@" cd 'quoted text'
+		$(pwd) /usr/bin readonly done printf /usr/bin awk awk readonly
+/usr/bin readonly -eu export | ${HOME} /usr/bin
+		cd cd --verbose $(pwd) export && printf cd 'quoted text'
+		cd x=1 --verbose awk export local 2>/dev/null "$1" /usr/bin "$@"
+	${HOME} done export /usr/bin readonly done printf
+	| grep && /usr/bin /usr/bin /usr/bin
+		x=1 2>/dev/null x=1 x=1 -eu 2>/dev/null "$1" printf printf
+	grep --verbose readonly | printf grep readonly "$1" ${HOME} /usr/bin -eu export
+	test awk $(pwd) printf echo -eu grep
+printf -eu 'quoted text' && local $(pwd) then 'quoted text' x=1 readonly
+	local echo grep done grep | grep "$1" 2>/dev/null | | test grep printf | awk 'quoted text'
+		export && local test local && "$@" awk | grep --verbose
+--verbose done ${HOME} "$@" /usr/bin |
+	then "$1" printf --verbose sed then test "$@" export x=1 'quoted text'
+	'quoted text' "$1" local test sed then grep readonly local ${HOME} $(pwd)
+| 'quoted text' cd -eu cd readonly local -eu | --verbose -eu $(pwd) then 'quoted text'
+$(pwd) $(pwd) | done 2>/dev/null /usr/bin ${HOME} echo ${HOME} awk
+	export readonly awk printf /usr/bin then local
+		"$1" readonly readonly export test cd "$@" sed test $(pwd) x=1 readonly
+		local x=1 export -eu && 2>/dev/null
+	readonly 'quoted text' then |
+		-eu --verbose "$1" echo "$@" -eu local printf sed 'quoted text'
+awk cd readonly $(pwd) sed done sed
+	done readonly $(pwd) awk then ${HOME} "$@" $(pwd) "$1" && $(pwd) 2>/dev/null
+cd then test x=1 && echo "$@" done echo then ${HOME} x=1 local
+	then done awk then --verbose "$1" awk local test --verbose
+	&& $(pwd) done ${HOME} /usr/bin
+	done ${HOME} export --verbose "$@" ${HOME} then then && "$1" && "$1" sed /usr/bin
+		x=1 2>/dev/null 2>/dev/null $(pwd) /usr/bin $(pwd) readonly
+	&& sed sed 'quoted text' awk && readonly "$1" /usr/bin grep -eu readonly "$1"
+		echo test "$@" -eu $(pwd)
+	$(pwd) -eu export /usr/bin awk 'quoted text' local printf 2>/dev/null
+		done cd "$@" local awk | printf
+	/usr/bin readonly local cd readonly 2>/dev/null export printf
+		/usr/bin | "$1" ${HOME} local awk ${HOME}
+		done $(pwd) cd export grep then && printf |
+		cd "$1" $(pwd) $(pwd) && grep /usr/bin readonly grep
+	printf && cd cd cd printf --verbose
+"$@" printf 'quoted text' sed $(pwd) local "$@" local
+		echo --verbose 'quoted text'
+--verbose "$@" then grep then
+		"$@" awk grep then ${HOME} ${HOME} awk printf export x=1 echo
+		--verbose $(pwd) 2>/dev/null awk then local && -eu done readonly
+done awk grep cd --verbose
+| printf echo cd 'quoted text' ${HOME} cd printf "$1" "$@"
+echo printf done cd -eu "$@"
+sed awk done "$1" | export && "$@" "$@" local
+${HOME} echo sed $(pwd) ${HOME} "$@" x=1 --verbose awk /usr/bin cd then test
+	2>/dev/null --verbose
+sed /usr/bin printf | && test x=1 sed
+local cd sed local | sed cd export 'quoted text' "$1"
+	-eu && "$1" readonly test then readonly
+		local /usr/bin /usr/bin $(pwd) x=1 test awk && 2>/dev/null grep ${HOME}
+		done ${HOME} -eu test "$1" "$@" "$1" then then then -eu test done
+$(pwd) ${HOME} 2>/dev/null test
+printf && echo "$@" printf echo $(pwd)
+		"$@" "$1" --verbose -eu export 2>/dev/null
+test echo "$@" test sed | export local then export awk echo echo --verbose
+#include c237.sh
+	test sed 'quoted text' 'quoted text' grep | --verbose local done printf
+	awk -eu x=1 cd export local /usr/bin /usr/bin readonly
+		/usr/bin ${HOME} 'quoted text' -eu | "$@"
+	test /usr/bin $(pwd) then -eu 2>/dev/null
+	echo export test readonly /usr/bin export echo sed && 'quoted text'
+		'quoted text' awk $(pwd) readonly awk awk readonly 2>/dev/null --verbose
+		-eu grep /usr/bin sed -eu
+	2>/dev/null -eu x=1 | test test "$1" test
+$(pwd) -eu 'quoted text' cd "$1" export then x=1
+$(pwd) grep sed then echo $(pwd) then --verbose 2>/dev/null ${HOME} && "$1" grep
+		x=1 awk "$@" 'quoted text' then echo local cd grep "$@" export then && echo printf
+test readonly --verbose 'quoted text'
+cd readonly awk echo "$1" grep echo "$1" cd done
+test cd awk ${HOME} "$1" local readonly echo $(pwd)
+		awk ${HOME} 'quoted text' ${HOME} awk grep readonly done readonly ${HOME} -eu then
+printf awk x=1 2>/dev/null local "$1" sed 'quoted text'
+sed 'quoted text' x=1 done ${HOME} x=1 && | local then 2>/dev/null
+	"$@" local "$1" awk done then
+awk then awk local printf -eu echo
+grep grep printf x=1 local printf 'quoted text'
+	"$1" then done local "$1" printf &&
+		echo ${HOME} --verbose export test "$1" ${HOME} echo
+		--verbose export sed test && done printf readonly
+2>/dev/null $(pwd) local /usr/bin cd && "$@"
+done "$1" | "$1" -eu then ${HOME} cd grep && local
+		"$1" grep x=1 echo export "$@" 'quoted text' /usr/bin printf | then | && sed -eu
+--verbose done export 'quoted text' done local test awk $(pwd) done "$@" "$@"
+	&& ${HOME} 2>/dev/null x=1 local readonly test
+then --verbose --verbose echo
+	local done --verbose 'quoted text' x=1 done | --verbose
+x=1 "$1" local $(pwd) done grep then ${HOME} x=1 local 2>/dev/null export
+		local awk "$@" 'quoted text' x=1 local | "$@" ${HOME}
+		awk | grep grep sed 2>/dev/null | echo echo readonly local printf
+	${HOME} && && readonly $(pwd)
+export && awk 'quoted text' --verbose test ${HOME} && readonly
+--verbose readonly "$1" local awk then then
+	x=1 printf 'quoted text' --verbose
+		local | ${HOME} --verbose
+	&& ${HOME} readonly $(pwd)
+grep readonly done readonly printf | test ${HOME} 2>/dev/null -eu
+		done readonly /usr/bin then grep test grep printf
+--verbose export then printf $(pwd) ${HOME} /usr/bin sed 'quoted text' sed awk
+| | 2>/dev/null grep x=1 cd "$1" readonly ${HOME} 'quoted text' | $(pwd) echo
+	then -eu --verbose ${HOME} grep "$1" 'quoted text' ${HOME}
+	"$1" awk 'quoted text'
+	then $(pwd) 2>/dev/null $(pwd) 'quoted text' 'quoted text'
+		${HOME} sed -eu $(pwd) 2>/dev/null | -eu x=1 /usr/bin then local | x=1
+	cd --verbose sed printf readonly readonly
+&& awk test && grep 2>/dev/null grep export grep 2>/dev/null x=1 $(pwd) 2>/dev/null
+	&& readonly | --verbose printf export awk printf done test $(pwd) "$1"
+		local x=1 local "$1" done 2>/dev/null cd "$@"
+	local | test echo $(pwd) export test done "$1" x=1 2>/dev/null done sed
+	local 'quoted text' export x=1 /usr/bin "$@" test awk ${HOME} "$1" x=1 grep ${HOME}
+sed | | test "$@" done grep echo 'quoted text'
+		/usr/bin test echo export cd echo | "$1" 2>/dev/null $(pwd)
+		2>/dev/null /usr/bin ${HOME} | x=1 awk
+local echo then cd 'quoted text' | -eu -eu --verbose
+		echo local echo 2>/dev/null echo 2>/dev/null done $(pwd)
+-eu "$1" | "$@" "$@" local done 2>/dev/null 'quoted text' then 'quoted text'
+		--verbose export done x=1 local then -eu && then --verbose test x=1 export
+'quoted text' cd printf 'quoted text' done "$1" export &&
+printf /usr/bin readonly then test done readonly ${HOME}
+	echo ${HOME} export echo test 2>/dev/null readonly echo local
+printf then ${HOME} | x=1 -eu 2>/dev/null
+	awk --verbose grep $(pwd)
+	${HOME} 'quoted text' cd printf done local --verbose sed echo 2>/dev/null
+2>/dev/null done export --verbose printf readonly test grep local
+	| /usr/bin grep grep sed "$1"
+		awk --verbose grep awk then 'quoted text' x=1 ${HOME}
+sed export $(pwd) export "$@"
+$(pwd) sed /usr/bin "$1" echo "$1" "$1" grep done /usr/bin
+| ${HOME} $(pwd) printf x=1 ${HOME}
+		done then -eu echo | test echo printf test "$1" && ${HOME} export
+	awk 2>/dev/null ${HOME} /usr/bin 2>/dev/null
+	awk ${HOME} /usr/bin ${HOME} ${HOME}
+"$@" 2>/dev/null cd local "$@" then local x=1 local | -eu local awk then
+	local -eu local cd readonly /usr/bin
+	"$1" && 2>/dev/null 2>/dev/null $(pwd) && | awk export $(pwd) test "$1"
+${HOME} /usr/bin --verbose /usr/bin then awk -eu done awk local printf
+		x=1 then -eu printf local grep x=1 readonly local
+		x=1 ${HOME} && export sed printf grep $(pwd)
+-eu --verbose 2>/dev/null local 'quoted text' "$1" --verbose -eu cd local
+"$1" printf $(pwd) awk --verbose readonly ${HOME} cd then x=1 test /usr/bin
+	"$1" /usr/bin awk done /usr/bin -eu "$@" 2>/dev/null awk test -eu local "$1"
+		$(pwd) 2>/dev/null awk
+	readonly sed test && test "$1" cd x=1 export sed readonly local test then -eu
+		x=1 sed readonly cd /usr/bin readonly ${HOME}
+		${HOME} /usr/bin 'quoted text' -eu export
+2>/dev/null /usr/bin grep x=1 ${HOME} --verbose x=1
+	-eu export sed $(pwd) echo /usr/bin done cd --verbose export sed ${HOME} "$1"
+	&& --verbose $(pwd) && done local readonly printf done "$1"
+"$1" 'quoted text' awk readonly done
+	${HOME} grep $(pwd) awk "$@"
+	done 2>/dev/null done -eu echo cd test $(pwd) echo echo test
+	"$@" $(pwd) sed && /usr/bin readonly
+	done grep test printf readonly -eu
+--verbose 2>/dev/null $(pwd) "$1" sed readonly "$@"
+		export grep $(pwd) sed grep
+		local export && sed "$1" "$@" test awk "$1"
+		then sed printf /usr/bin done $(pwd) --verbose 'quoted text' readonly $(pwd)
+	/usr/bin x=1 "$@" -eu done test 2>/dev/null --verbose
+2>/dev/null readonly local echo echo && sed "$1" awk ${HOME} sed grep awk "$@"
+	-eu /usr/bin "$1" done done test ${HOME}
+		x=1 awk && $(pwd) cd test done cd done echo sed -eu awk done readonly --verbose
+"$@" export x=1 ${HOME} 2>/dev/null local test awk grep "$@"
+	&& then readonly sed /usr/bin export | /usr/bin cd grep
+test | /usr/bin echo local export 'quoted text'
+		| "$@" ${HOME} | && grep $(pwd) done echo /usr/bin done test 2>/dev/null
+		--verbose /usr/bin grep 'quoted text' sed cd $(pwd) local 2>/dev/null sed "$1"
+		&& readonly awk done local readonly echo export
+		export "$@" sed awk test /usr/bin x=1 /usr/bin done
+done local echo test awk 2>/dev/null $(pwd) "$1" | cd -eu --verbose
+	${HOME} printf printf done && export done awk | ${HOME} printf && test
+cd /usr/bin printf export grep grep "$@" grep
+		${HOME} 2>/dev/null readonly
+	awk awk "$@" -eu awk export cd "$1" test
+	awk test && && sed export "$@" "$1" then
+/usr/bin "$1" readonly done 2>/dev/null
+--verbose 2>/dev/null ${HOME}
+	"$@" test export echo
+	2>/dev/null echo -eu sed echo ${HOME}
+		local grep then -eu local then cd 'quoted text' "$1" done done
+	export test -eu done /usr/bin "$@" "$@" $(pwd) then -eu && $(pwd) --verbose
+		readonly printf ${HOME} /usr/bin sed "$@" x=1 "$@" test --verbose printf
+		"$@" | $(pwd) local readonly awk readonly cd "$1" awk
+	then x=1 printf echo cd cd
+		${HOME} done echo readonly "$@" then -eu "$1" --verbose export $(pwd) 2>/dev/null
+grep 2>/dev/null 'quoted text' | --verbose
+	"$@" --verbose --verbose 2>/dev/null
+"$1" x=1 --verbose printf
+		echo x=1 then export ${HOME} sed echo printf test local awk | && then readonly
+| done 'quoted text' grep readonly ${HOME}
+grep grep cd -eu 2>/dev/null
+--verbose x=1 'quoted text' then cd "$@" export awk export 2>/dev/null
+	sed $(pwd) /usr/bin "$@"
+		-eu ${HOME} | done "$1" 2>/dev/null
+		/usr/bin ${HOME} test 'quoted text' && test && -eu awk "$1"
+	&& printf awk ${HOME} -eu export
+	--verbose test $(pwd) "$1" x=1 echo x=1 | /usr/bin echo "$@" -eu done
+x=1 done $(pwd) 'quoted text'
+	cd test "$1" printf ${HOME} sed test export "$1" /usr/bin ${HOME} done
+		then 'quoted text' |
+	test printf grep cd "$1" "$1" ${HOME} "$@" readonly 'quoted text' x=1 "$@" grep
+done "$1" sed cd readonly then $(pwd) | --verbose export
+	export --verbose grep test 2>/dev/null
+/usr/bin 'quoted text'
+		-eu && "$1" echo cd 2>/dev/null printf 2>/dev/null sed
+	test export local local "$@" ${HOME} | sed /usr/bin test "$@" readonly
+	readonly sed echo | readonly 2>/dev/null 2>/dev/null && ${HOME} readonly "$1"
+	/usr/bin readonly done
+	/usr/bin export readonly --verbose ${HOME} local test "$1" export
+		test /usr/bin awk --verbose ${HOME} then "$@" x=1 cd
+		awk then && /usr/bin readonly grep grep awk echo
+	| cd --verbose "$@" | -eu x=1 ${HOME} --verbose && cd "$@" --verbose grep printf
+| $(pwd) ${HOME} printf | cd then ${HOME} printf then
+		local -eu /usr/bin test grep done 'quoted text'
+		-eu awk export printf | grep printf
+		export then done export /usr/bin sed 'quoted text' export
+		cd -eu awk done "$@" test cd cd echo local --verbose 'quoted text'
+test echo $(pwd) 2>/dev/null "$1"
+	readonly $(pwd) ${HOME} test grep ${HOME} done printf
+printf local ${HOME} /usr/bin x=1
+	/usr/bin then /usr/bin "$@" local
+		-eu $(pwd) grep test /usr/bin export sed cd sed printf then "$@"
+	&& 'quoted text' ${HOME} | test sed export $(pwd) 'quoted text'
+		| "$1" -eu test $(pwd) --verbose 2>/dev/null local | echo /usr/bin x=1 grep
+	'quoted text' "$@" awk done "$@" done awk test -eu ${HOME} /usr/bin
+		&& "$1" | local grep then readonly
+	test export | done grep --verbose
+&& 'quoted text' x=1 2>/dev/null test -eu printf cd $(pwd) --verbose local
+"$1" then then echo "$@"
+		"$@" export awk done "$1" 'quoted text' test --verbose "$@" x=1 grep --verbose
+		"$1" $(pwd) --verbose readonly sed cd /usr/bin grep readonly | done 'quoted text'
+	$(pwd) grep "$1" 2>/dev/null sed test done x=1 2>/dev/null echo echo then ${HOME}
+		local echo 'quoted text'
+2>/dev/null ${HOME} 'quoted text' $(pwd) done awk done && $(pwd) sed readonly
+${HOME} "$1" ${HOME} x=1 echo done
+		&& /usr/bin | readonly 2>/dev/null
+--verbose | export x=1 awk 'quoted text' --verbose readonly
+	local test test echo then "$1" export
+	echo printf test && local 2>/dev/null local cd done done then
+$(pwd) then ${HOME} sed --verbose && -eu x=1 export local 2>/dev/null
+&& cd /usr/bin ${HOME} local local | --verbose
+done | /usr/bin sed --verbose sed
+| grep | grep echo && export | then --verbose local && 2>/dev/null
+	"$@" readonly "$1" test then && 'quoted text'
+	'quoted text' /usr/bin | test cd "$@" echo grep 2>/dev/null
+cd /usr/bin then $(pwd) done |
+		readonly -eu --verbose x=1
+		echo && cd awk echo echo sed -eu "$1" "$1" printf test echo 2>/dev/null echo
+	printf && printf cd readonly local readonly printf -eu -eu local echo
+"$@" /usr/bin awk sed export ${HOME} -eu 2>/dev/null cd "$1"
+	&& export 'quoted text' x=1 cd $(pwd) sed $(pwd) cd awk /usr/bin /usr/bin -eu
+export --verbose readonly cd sed cd grep export export
+		printf grep printf local 'quoted text' done
+--verbose | -eu $(pwd) echo local
+2>/dev/null 2>/dev/null $(pwd)
+	sed x=1 "$@" x=1 | -eu export printf -eu ${HOME}
+--verbose --verbose /usr/bin ${HOME} &&
+		${HOME} && grep 2>/dev/null |
+	"$@" printf awk export $(pwd) --verbose awk done test 2>/dev/null
+		then grep && "$1" $(pwd) /usr/bin 2>/dev/null
+| 2>/dev/null && x=1 -eu local ${HOME} && test printf x=1
+		readonly awk /usr/bin $(pwd) then test $(pwd) grep export $(pwd)
+		'quoted text' && export
+		&& -eu $(pwd) test /usr/bin test | awk
+readonly cd x=1 readonly echo sed ${HOME} cd ${HOME}
+	2>/dev/null awk then "$@" awk done x=1 echo echo echo grep &&
+		$(pwd) test readonly cd 2>/dev/null ${HOME} $(pwd) grep sed /usr/bin
+${HOME} grep cd sed sed done
+&& | 2>/dev/null x=1 sed export readonly -eu
+echo /usr/bin readonly export
+done readonly done && -eu awk local && test test
+"$1" export export "$@" /usr/bin x=1
+	$(pwd) grep cd then 2>/dev/null --verbose
+done --verbose --verbose readonly awk | | --verbose | echo test --verbose
+		"$1" "$1" echo /usr/bin test done then then sed awk | done
+	local && --verbose /usr/bin
+		test && readonly "$@" then -eu && cd ${HOME}
+printf printf "$1" sed
+-eu ${HOME} --verbose 2>/dev/null 2>/dev/null cd
+	awk cd /usr/bin grep readonly 'quoted text' /usr/bin
+	"$@" echo done echo printf "$1"
+		$(pwd) -eu export local -eu printf 2>/dev/null 2>/dev/null test export "$1"
+printf --verbose x=1 then then export test 'quoted text' 'quoted text'
+		&& && "$1" echo then local /usr/bin "$@" grep | grep
+		then export done readonly cd $(pwd) "$@" readonly ${HOME} awk "$@" --verbose
+	$(pwd) sed test /usr/bin local
+	test --verbose ${HOME} x=1 sed test x=1 local local cd then done local
+echo sed "$1" x=1 cd | readonly printf --verbose
+		done printf $(pwd) cd grep 'quoted text' readonly sed done then
+	| readonly $(pwd) printf /usr/bin awk "$@" | -eu --verbose cd ${HOME} printf
+	"$@" && readonly | cd --verbose && 'quoted text' export $(pwd)
+	"$@" /usr/bin && /usr/bin -eu awk export cd readonly echo test echo export printf
+		readonly -eu "$@" --verbose awk test /usr/bin ${HOME} x=1 -eu local 2>/dev/null
+readonly && test $(pwd) x=1 "$@" awk sed -eu echo && export $(pwd) $(pwd) --verbose
+	then printf "$1" local export test
+done local sed sed x=1 $(pwd) grep cd 'quoted text'
+	printf local export --verbose
+"$@" echo printf "$1" --verbose readonly -eu local /usr/bin ${HOME} ${HOME}
+		awk | "$1" cd printf 'quoted text' printf 'quoted text'
+$(pwd) /usr/bin -eu printf awk sed && test awk
+	local ${HOME} -eu local --verbose echo -eu /usr/bin
+export | export then /usr/bin printf local && then 2>/dev/null awk "$1" && printf
+| test x=1 grep done cd ${HOME} printf
+	printf 'quoted text' /usr/bin ${HOME}
+| test grep && x=1 cd export
+		printf x=1 && -eu then $(pwd) sed readonly ${HOME}
+	&& "$1" readonly readonly readonly | -eu grep
+	x=1 printf done done printf 'quoted text' awk /usr/bin 2>/dev/null $(pwd) x=1
+		-eu done local $(pwd) $(pwd) then --verbose && "$@" "$@" awk then awk x=1 cd local
+	'quoted text' && 'quoted text' then -eu $(pwd) local -eu local
+--verbose then echo then grep local && | awk /usr/bin
+		echo 'quoted text' sed x=1 "$1" "$@" $(pwd) x=1 "$1" export awk && --verbose
+	cd && 2>/dev/null export echo test --verbose awk awk -eu && "$1" /usr/bin 'quoted text'
+then ${HOME} /usr/bin ${HOME} printf /usr/bin awk test cd 'quoted text'
+	then echo "$1" done readonly
+	done readonly awk "$1" cd awk ${HOME} && -eu export
+		"$@" 2>/dev/null export x=1
+grep test "$@" printf -eu "$@"
+	-eu 2>/dev/null cd then echo awk && export grep
+	readonly then echo x=1
+		local done awk printf /usr/bin export then x=1 cd 'quoted text' ${HOME} echo
+		"$@" 2>/dev/null -eu done /usr/bin 'quoted text' echo then readonly
+		'quoted text' cd test "$1" then test export "$@" export $(pwd) /usr/bin
+		--verbose 'quoted text' printf
+	x=1 "$1" "$1" 'quoted text'
+printf -eu "$1" | /usr/bin export printf | /usr/bin | echo awk
+		x=1 awk ${HOME} -eu printf && "$1" sed echo | printf
+	-eu echo -eu 2>/dev/null 'quoted text' awk then
+cd sed test "$1" cd sed then "$@" x=1 'quoted text'
+		grep ${HOME} --verbose awk 'quoted text'
+done 2>/dev/null 'quoted text' cd && sed awk awk done awk "$@" x=1
+		sed export && test 2>/dev/null
+'quoted text' grep --verbose then -eu sed grep 'quoted text'
+${HOME} export -eu printf done readonly | x=1 && test 2>/dev/null && test /usr/bin
+--verbose then readonly "$@" && then "$@" "$1" sed echo --verbose done
+		-eu "$1" local test done echo
+		"$1" | x=1 | export echo grep awk readonly -eu | done ${HOME}
+--verbose | /usr/bin 2>/dev/null done "$1"
+"$1" /usr/bin test sed test
+	test /usr/bin then --verbose cd "$1" -eu
+	printf done /usr/bin "$@"
+		| -eu && /usr/bin printf | --verbose export $(pwd) $(pwd) && sed local "$1"
+	x=1 sed | done "$1" -eu && done ${HOME}
+	${HOME} && local 2>/dev/null then ${HOME} 'quoted text'
+-eu grep printf cd grep | x=1 "$@" --verbose
+	printf && x=1 echo cd test
+		/usr/bin readonly && 2>/dev/null 2>/dev/null done cd grep "$1" readonly local
+	/usr/bin sed /usr/bin grep cd export 2>/dev/null
+		test readonly --verbose --verbose -eu 'quoted text' 2>/dev/null
+	--verbose done "$1" ${HOME} readonly
+	readonly | printf test && "$1" export | local "$1"
+		printf $(pwd) 2>/dev/null /usr/bin $(pwd) printf then x=1
+		then awk sed echo "$@" --verbose ${HOME} "$@"
+	cd done "$@" then "$@" --verbose grep cd 'quoted text' sed 2>/dev/null
+	done local && -eu readonly local /usr/bin --verbose
+test awk local sed --verbose -eu x=1 done
+'quoted text' $(pwd) x=1 "$@" printf
+"$@" echo readonly local x=1 awk export
+$(pwd) sed then grep /usr/bin export 'quoted text' "$@" readonly x=1 sed
+		x=1 awk "$@" | done | --verbose 'quoted text' 'quoted text' | readonly
+readonly ${HOME} x=1 test test ${HOME} cd awk grep -eu then ${HOME}
+		grep export 'quoted text' 'quoted text' "$1" sed && sed $(pwd)
+		grep -eu /usr/bin test local $(pwd) -eu cd then done 2>/dev/null
+done then awk 2>/dev/null x=1 test 2>/dev/null awk sed
+		readonly "$@" | grep readonly 'quoted text' sed --verbose then
+		readonly "$1" ${HOME} readonly 2>/dev/null export done "$1"
+		/usr/bin then 'quoted text' 'quoted text' test export --verbose
+cd readonly echo -eu && ${HOME} "$@" readonly 'quoted text' awk test done
+		cd "$@" 'quoted text' x=1 -eu -eu && -eu local awk
+printf /usr/bin done echo $(pwd) ${HOME} grep test 2>/dev/null
+done 2>/dev/null sed "$1" "$@" $(pwd) --verbose awk sed /usr/bin
+		sed printf echo readonly -eu local grep -eu x=1 ${HOME} | done x=1 readonly
+		2>/dev/null grep "$@" --verbose awk
+x=1 | -eu sed $(pwd) 'quoted text' grep awk sed 'quoted text' done "$@" 2>/dev/null
+x=1 echo "$@" $(pwd) readonly
+cd cd "$1" 'quoted text' awk "$@" cd | ${HOME} | | done readonly "$@" /usr/bin
+	'quoted text' 2>/dev/null export | --verbose 'quoted text'
+		done x=1 /usr/bin then
+x=1 -eu test export --verbose readonly 2>/dev/null readonly /usr/bin local && $(pwd)
+| "$1" export x=1 "$1" "$@" echo
+&& then | awk then then then echo echo
+done --verbose -eu ${HOME} $(pwd) readonly cd echo local
+local -eu awk "$@" && -eu ${HOME} 'quoted text' test --verbose
+		| x=1 printf grep local | then "$1" /usr/bin
+printf "$1" ${HOME} ${HOME} | -eu | test "$1" -eu awk awk "$@"
+		x=1 /usr/bin x=1 $(pwd) -eu "$@" "$1" -eu readonly
+	2>/dev/null "$@" /usr/bin echo done grep then
+	&& echo echo done test ${HOME} readonly "$1" readonly then --verbose awk echo
+		--verbose x=1 then test grep echo /usr/bin readonly export && awk | -eu |
+	&& | grep "$1" "$@" && done $(pwd) awk
+	| -eu local ${HOME} cd export printf x=1 awk x=1 x=1 cd done --verbose --verbose
+		x=1 grep /usr/bin awk /usr/bin printf then /usr/bin
+		'quoted text' "$1" local --verbose awk grep ${HOME} echo done export
+cd ${HOME} $(pwd) export export export && "$1" sed sed "$@" echo 2>/dev/null
+		test 'quoted text' --verbose
+	$(pwd) cd then 'quoted text' --verbose -eu
+		| x=1 $(pwd) -eu sed "$1" --verbose printf sed export cd | "$1" x=1
+	--verbose -eu $(pwd) sed export
+done ${HOME} -eu readonly 'quoted text' done grep ${HOME} ${HOME}
+		-eu 2>/dev/null "$@" export cd grep "$1" awk
+awk readonly export echo -eu x=1 sed sed local && --verbose "$@" test $(pwd) |
+&& echo | | $(pwd) readonly 2>/dev/null
+readonly -eu /usr/bin 'quoted text' sed printf local 2>/dev/null x=1 -eu
+	"$1" "$@" sed sed readonly readonly
+		| -eu /usr/bin export -eu |
+$(pwd) | -eu | sed | sed echo done then "$1" "$1" "$@" printf | then
+	echo grep cd "$1" awk local echo readonly --verbose -eu && $(pwd) cd
+		/usr/bin printf done && awk echo grep -eu
+		local echo $(pwd) x=1 cd readonly 2>/dev/null
+sed ${HOME} | local "$@" 2>/dev/null done
+		"$1" 2>/dev/null && --verbose ${HOME}
+		&& ${HOME} export export
+export export && $(pwd) --verbose
+		done sed 'quoted text'
+	export $(pwd) "$@" grep --verbose x=1 2>/dev/null -eu readonly readonly
+--verbose && echo then test printf printf awk then cd sed readonly
+${HOME} echo "$@" | sed local test echo $(pwd) "$1" x=1
+		--verbose ${HOME} /usr/bin grep echo
+awk /usr/bin awk /usr/bin --verbose x=1 then grep && -eu "$@" /usr/bin
+	"$1" test "$@" | --verbose then && sed /usr/bin grep test x=1
+awk "$@" x=1 | | cd then "$@" local export echo x=1 then readonly
+	printf /usr/bin readonly export readonly $(pwd) grep
+${HOME} readonly grep $(pwd) echo 2>/dev/null
+		local test "$@" done | printf --verbose readonly cd export echo
+"$@" $(pwd) test sed export cd && done local awk 'quoted text'
+		sed export ${HOME} cd
+		"$1" then test ${HOME} done |
+		awk "$@" then 2>/dev/null | echo ${HOME} | cd export done /usr/bin done
+		/usr/bin echo grep "$1" "$1" readonly done "$@"
+		readonly | printf done sed "$1" printf && /usr/bin
+		printf | | -eu --verbose sed --verbose echo cd x=1 then done echo 'quoted text'
+		then export printf export
+		x=1 grep export 'quoted text' && "$@" ${HOME} "$1" awk ${HOME} awk
+x=1 --verbose "$1" awk then | $(pwd) --verbose -eu awk ${HOME}
+	cd ${HOME} echo cd readonly awk readonly "$1" sed /usr/bin readonly local $(pwd)
+local | "$1" done "$1" "$1" readonly done --verbose then -eu "$@" $(pwd)
+	done 2>/dev/null ${HOME} test 'quoted text' printf -eu export
+	| done -eu test grep readonly /usr/bin
+	export local "$1" awk done ${HOME} $(pwd) echo x=1
+		done done echo -eu then local 2>/dev/null
+	export "$@" "$@" local awk "$1" 2>/dev/null then sed
+/usr/bin cd x=1 readonly 2>/dev/null ${HOME} then x=1 grep printf
+	test cd x=1 sed awk --verbose local export export
+done && export local 'quoted text' 'quoted text'
+		"$@" && sed x=1 awk echo -eu grep --verbose
+		grep 'quoted text' --verbose test ${HOME} /usr/bin
+local /usr/bin test echo $(pwd)
+"$1" x=1 grep $(pwd) grep 'quoted text' && "$@" $(pwd) test $(pwd) ${HOME}
+echo "$1" cd "$@" awk sed then | awk sed "$1"
+	--verbose local export ${HOME} $(pwd)
+		-eu then grep x=1 echo 'quoted text' echo awk && ${HOME} test
+		echo "$1" readonly /usr/bin "$1" done /usr/bin
+| printf $(pwd) && --verbose done
+		$(pwd) --verbose then /usr/bin test local
+		cd "$@" x=1 "$1" export x=1 "$@" /usr/bin $(pwd)
+		'quoted text' 2>/dev/null awk && --verbose readonly ${HOME} | 'quoted text'
+	awk local "$1" awk awk | echo echo -eu
+		/usr/bin cd done local printf --verbose test echo awk sed awk $(pwd) awk done 2>/dev/null
+	awk awk 'quoted text' then sed
+		${HOME} printf "$@" -eu /usr/bin /usr/bin local sed test grep then
+	"$1" awk ${HOME} $(pwd) ${HOME}
+x=1 sed readonly local x=1 then readonly
+-eu "$1" -eu done && grep echo && awk 'quoted text'
+	cd 2>/dev/null done 2>/dev/null done
+${HOME} then && cd grep
+	grep done /usr/bin $(pwd) 'quoted text' x=1 'quoted text'
+	awk local | -eu "$1" then | x=1 export && x=1 grep
+echo then 'quoted text' && local echo
+		echo && then cd local grep ${HOME} "$1" --verbose "$@" done
+		'quoted text' "$@" "$1" ${HOME}
+awk sed -eu echo 2>/dev/null
+		awk local printf --verbose $(pwd) local echo $(pwd) /usr/bin | echo | echo 2>/dev/null
+"$1" $(pwd) "$@" /usr/bin ${HOME} -eu awk echo grep 'quoted text' awk "$@" &&
+		${HOME} "$1" export x=1 then sed export done done --verbose
+"$@" x=1 x=1 cd && -eu ${HOME} "$1" 2>/dev/null "$1" readonly 'quoted text'
+local done export readonly readonly
+	--verbose -eu "$1" done &&
+"$1" awk export x=1 export sed
+	echo x=1 test | grep /usr/bin | cd "$1"
+${HOME} x=1 -eu && done awk printf test -eu "$@"
+		$(pwd) /usr/bin -eu readonly echo "$1" awk --verbose -eu "$@"
+	grep cd readonly grep "$1" echo 'quoted text'
+		export && 'quoted text' awk then "$1" 2>/dev/null /usr/bin x=1 --verbose
+'quoted text' export
+x=1 | && "$1" | 'quoted text' test 2>/dev/null export ${HOME} && grep
+		| then readonly printf "$@" $(pwd) "$1"
+	"$@" export echo -eu then ${HOME} && echo test local
+"$1" "$1" test printf done
+		"$1" grep readonly 'quoted text' "$1" ${HOME}
+/usr/bin echo ${HOME} /usr/bin printf ${HOME} | local echo grep
+x=1 | && ${HOME} printf x=1 grep
+then done awk && sed local grep awk echo awk --verbose &&
+sed | then done echo /usr/bin local echo done
+${HOME} awk /usr/bin --verbose /usr/bin readonly printf
+	/usr/bin printf awk /usr/bin --verbose then $(pwd) cd
+done readonly export test /usr/bin "$1" "$@" ${HOME} ${HOME} done readonly
+	sed printf $(pwd) grep echo ${HOME} local done &&
+	"$@" --verbose --verbose grep printf ${HOME} echo done --verbose
+done "$@" --verbose local -eu cd && ${HOME} awk echo /usr/bin
+		awk done export 'quoted text'
+/usr/bin x=1 echo "$@" "$@" readonly local -eu then
+export ${HOME} echo 2>/dev/null
+grep "$@" -eu export $(pwd)
+"$1" export | | done "$@" local echo /usr/bin && printf 'quoted text'
+		&& ${HOME} cd $(pwd) test /usr/bin test 'quoted text' "$@" ${HOME} "$@"
+		-eu "$1" | "$@" /usr/bin 'quoted text' && 2>/dev/null
+	x=1 local && readonly then "$1" $(pwd) test local sed "$@" echo 'quoted text'
+	local export sed 'quoted text' grep 2>/dev/null
+	awk | cd && grep test ${HOME} test test sed && done sed export
+printf "$1" 2>/dev/null readonly |
+'quoted text' test grep -eu "$@" printf printf
+		sed ${HOME} && $(pwd) --verbose
+	awk /usr/bin local ${HOME} 2>/dev/null 'quoted text'
+'quoted text' echo awk done sed /usr/bin && "$@" 'quoted text'
+		local printf awk "$@" && done
+${HOME} done $(pwd) "$1" awk then printf --verbose printf echo
+		sed export $(pwd) 2>/dev/null "$1" done printf grep
+		"$1" | $(pwd) x=1 printf done ${HOME} echo
+		awk /usr/bin awk && export
+	${HOME} "$@" 2>/dev/null "$@" readonly --verbose grep then -eu | -eu
+	x=1 ${HOME} export $(pwd) x=1 /usr/bin --verbose awk then /usr/bin -eu cd
+	grep export done ${HOME} export 2>/dev/null local done then grep --verbose ${HOME}
+	${HOME} printf grep /usr/bin ${HOME} -eu test ${HOME} "$1" "$1"
+export --verbose 'quoted text' $(pwd) -eu export /usr/bin /usr/bin local export
+"$1" 'quoted text' | ${HOME} | test ${HOME} $(pwd) done
+	export | then printf /usr/bin echo done -eu grep readonly
+	printf cd "$1" then x=1 grep printf
+		x=1 test ${HOME} awk && echo grep grep done 2>/dev/null sed test
+x=1 cd echo export echo cd echo /usr/bin test 'quoted text' export
+		awk "$1" echo --verbose -eu done --verbose 'quoted text' && "$1" "$@" -eu
+	x=1 export awk readonly then 2>/dev/null printf test x=1 readonly
+-eu "$1" | 'quoted text' /usr/bin
+	"$@" "$1" local export awk test --verbose cd sed cd readonly then --verbose
+| grep sed sed printf $(pwd) /usr/bin awk done "$1" test
+readonly x=1 printf then "$1" export | | | && "$1" 2>/dev/null then sed cd
+	printf 2>/dev/null readonly done x=1 export $(pwd) cd export
+	cd printf -eu then export cd x=1 then export export local
+| "$@" 2>/dev/null test then cd printf then cd printf cd
+printf grep awk export done echo printf cd printf "$@" "$1" awk $(pwd)
+2>/dev/null awk ${HOME}
+x=1 awk -eu $(pwd) cd $(pwd) printf 'quoted text' awk 2>/dev/null x=1 2>/dev/null
+	${HOME} --verbose /usr/bin "$1" "$1" export
+		$(pwd) $(pwd) | test sed printf
+	local echo 'quoted text' "$1" "$@" ${HOME} && grep ${HOME} test "$1" sed
+		then echo x=1 --verbose sed done echo --verbose readonly printf
+		printf ${HOME} $(pwd) cd test "$1" then readonly grep
+done 'quoted text' ${HOME} 'quoted text' sed "$1" grep then "$@" /usr/bin
+echo "$1" $(pwd) echo "$1" printf printf grep echo then ${HOME}
+echo sed export local echo
+	'quoted text' echo ${HOME} readonly readonly /usr/bin "$1" --verbose
+		then 2>/dev/null printf done sed printf /usr/bin /usr/bin -eu
+cd export --verbose test -eu test /usr/bin then | | printf && test $(pwd) x=1
+		echo /usr/bin done readonly --verbose --verbose printf
+	&& local $(pwd) echo then -eu readonly x=1 $(pwd) sed x=1 "$@" 2>/dev/null
+	then "$1" then grep done x=1 && done $(pwd)
+		x=1 'quoted text' $(pwd) --verbose
+printf "$1" then then 'quoted text' echo printf then local -eu /usr/bin 'quoted text'
+	awk 2>/dev/null $(pwd)
+	readonly awk "$1" printf grep then
+		-eu readonly local "$@" test done && | cd 'quoted text' -eu printf test sed export
+		awk awk grep readonly echo "$@" | 2>/dev/null && export awk
+printf printf "$1" export x=1 -eu test cd awk printf x=1
+		sed "$1" export --verbose done then "$@" $(pwd) cd test
+	"$@" | cd ${HOME} echo test test 'quoted text'
+		"$@" 2>/dev/null echo && cd --verbose
+${HOME} $(pwd) done done 2>/dev/null sed export echo --verbose $(pwd)
+	echo $(pwd) awk cd "$1"
+	x=1 'quoted text' && ${HOME} grep --verbose test sed && 2>/dev/null
+	readonly ${HOME} "$1" $(pwd) export
+		'quoted text' 'quoted text'
+	"$1" cd cd "$@" local --verbose cd readonly printf
+	test | 'quoted text' 2>/dev/null cd sed && grep "$1" echo
+		'quoted text' -eu export then test cd "$@" printf awk
+		| done x=1 export 'quoted text' export awk
+x=1 test local "$@" then then ${HOME} printf 2>/dev/null local printf
+		test && awk && /usr/bin && sed echo echo
+	"$@" test 2>/dev/null local
+	/usr/bin $(pwd) -eu local awk --verbose "$1" | local echo
+	sed 'quoted text' "$1" $(pwd) --verbose
+	"$@" grep local "$@" 'quoted text' -eu done --verbose grep | then printf
+	then 2>/dev/null ${HOME} /usr/bin 'quoted text'
+	echo local 'quoted text' 'quoted text'
+	"$1" ${HOME} 2>/dev/null /usr/bin 'quoted text'
+readonly test /usr/bin echo 2>/dev/null test cd "$@"
+	test grep readonly x=1 x=1 printf done && 2>/dev/null local /usr/bin then sed
+	test awk 'quoted text' local ${HOME} export $(pwd) then "$@"
+		awk done readonly "$1" export | cd
+		echo local $(pwd) done done readonly && 'quoted text'
+		-eu ${HOME} /usr/bin echo
+		| local x=1 ${HOME} 2>/dev/null 2>/dev/null "$1" /usr/bin
+/usr/bin 'quoted text' done cd done then readonly
+		"$@" test /usr/bin x=1 /usr/bin printf local 'quoted text' /usr/bin
+	done 2>/dev/null 'quoted text'
+	'quoted text' cd "$1" export readonly && then 2>/dev/null
+		sed x=1 printf && grep "$@" "$@" sed local && -eu --verbose
+		sed $(pwd) printf "$@" done then $(pwd) ${HOME} /usr/bin
+"$@" then 'quoted text' --verbose x=1 local
+		-eu "$1" "$1" 2>/dev/null
+		&& && printf ${HOME}
+		cd printf -eu x=1 done --verbose $(pwd) then /usr/bin
+	x=1 "$1" ${HOME} test export sed
+		${HOME} export export $(pwd)
+	/usr/bin test awk cd then "$1" local ${HOME} sed
+		"$@" grep cd 'quoted text' 2>/dev/null
+		export awk 'quoted text' && printf -eu
+		sed $(pwd) readonly export local x=1
+	sed 2>/dev/null local -eu x=1 readonly export grep echo "$1" /usr/bin
+	"$1" test $(pwd) printf printf "$@" && done export /usr/bin
+done local | grep test 2>/dev/null
+$(pwd) readonly "$@" 2>/dev/null 2>/dev/null
+		local -eu 'quoted text' sed && -eu x=1
+		grep -eu 2>/dev/null --verbose sed | --verbose -eu
+	"$@" "$1" sed x=1 printf grep x=1 "$@"
+	local --verbose --verbose export local readonly grep "$@" x=1 | 2>/dev/null
+		export x=1 test then sed
+	-eu printf grep "$1" awk export $(pwd) x=1 readonly ${HOME}
+	/usr/bin test done printf readonly
+	| then -eu awk printf x=1
+${HOME} -eu 2>/dev/null sed readonly
+	&& readonly done ${HOME} test
+printf cd sed -eu "$@" 'quoted text'
+		-eu awk "$@" awk 2>/dev/null "$1" /usr/bin sed | ${HOME}
+export | sed --verbose && readonly done cd sed readonly --verbose
+sed --verbose x=1 local $(pwd) && echo "$@" test then test ${HOME} local
+	/usr/bin "$1" $(pwd) done "$@" "$1" "$1" x=1 $(pwd) "$@" 2>/dev/null
+sed x=1 'quoted text' awk cd printf x=1 -eu awk grep awk
+cd grep "$@" | "$@" grep printf
+test done done x=1 echo cd -eu | then 2>/dev/null -eu
+	"$@" done 'quoted text' --verbose
+cd done local echo "$@" test awk sed then
+		sed 'quoted text' awk test readonly
+&& && --verbose sed local
+		test | x=1 done export local x=1 "$@" awk -eu done --verbose then awk sed
+		cd done readonly export export echo x=1
+	export export x=1 x=1 | export
+		sed done x=1 /usr/bin x=1 2>/dev/null sed grep echo 2>/dev/null
+${HOME} test export 2>/dev/null "$@" 'quoted text'
+test 'quoted text' awk 2>/dev/null sed test | local ${HOME} 'quoted text' then
+		then 'quoted text' grep echo && echo 'quoted text' "$1" ${HOME} printf "$1"
+		2>/dev/null && printf echo cd readonly ${HOME}
+		| sed printf --verbose "$1"
+'quoted text' "$@" -eu cd && printf local done done /usr/bin ${HOME}
+		"$@" -eu sed -eu x=1 ${HOME} echo /usr/bin -eu | --verbose | then "$@" sed sed done
+	'quoted text' readonly 'quoted text' | "$1" echo awk -eu x=1 printf cd
+	printf -eu awk printf cd echo | | echo export && export awk readonly
+		2>/dev/null echo sed | --verbose grep awk $(pwd) ${HOME} -eu 'quoted text' readonly
+		then ${HOME} | ${HOME} test awk
+x=1 grep -eu echo ${HOME} grep x=1 -eu awk cd "$1" export echo test 'quoted text'
+	"$@" grep local local | 'quoted text' 2>/dev/null 'quoted text'
+		echo 2>/dev/null then echo -eu --verbose cd /usr/bin "$@" done
+		test && 'quoted text' 'quoted text' cd
+	&& /usr/bin x=1 --verbose awk then printf
+		'quoted text' "$1" grep grep export $(pwd) $(pwd) "$1"
+	local printf 2>/dev/null 'quoted text' && grep local awk 2>/dev/null readonly
+		export ${HOME} sed | awk /usr/bin /usr/bin -eu $(pwd) test then
+	"$@" "$1" ${HOME} 'quoted text' readonly printf
+	"$@" readonly | grep "$1" ${HOME} awk "$1" sed $(pwd) -eu $(pwd) | "$1"
+	then awk ${HOME} $(pwd) -eu grep && $(pwd) cd 'quoted text' 2>/dev/null $(pwd)
+		'quoted text' --verbose 2>/dev/null | /usr/bin | then awk | -eu
+		done --verbose then printf
+	printf | && $(pwd) done -eu ${HOME} export x=1 && test test | printf x=1 awk
+	done | awk local readonly --verbose ${HOME} sed done ${HOME}
+	/usr/bin then printf -eu done then 2>/dev/null done ${HOME} done
+	"$@" cd $(pwd) 'quoted text'
+	grep | grep cd "$1" grep 'quoted text' export printf 2>/dev/null
+		cd 2>/dev/null echo cd local awk done "$@" -eu "$1" 2>/dev/null
+		done local x=1 --verbose echo
+		grep /usr/bin && "$1" $(pwd) awk 'quoted text' $(pwd)
+	| readonly awk ${HOME} 2>/dev/null cd && --verbose $(pwd)
+		'quoted text' then x=1 -eu
+	test | x=1 test $(pwd) export
+		test awk x=1 "$@" -eu cd 'quoted text' ${HOME} sed --verbose grep
+'quoted text' done 2>/dev/null
+| "$@" 'quoted text' $(pwd) done export | sed test
+grep ${HOME} $(pwd) $(pwd) && "$1" test cd "$@" x=1 grep export /usr/bin -eu
+	cd $(pwd) echo echo 'quoted text' 2>/dev/null 'quoted text' && sed local
+| local x=1 then readonly | then /usr/bin
+		done sed 2>/dev/null local sed echo "$1" && -eu local /usr/bin 'quoted text'
+	test x=1 | awk sed grep 'quoted text' 2>/dev/null 'quoted text' sed echo && "$@"
+		awk "$@" && readonly $(pwd) test readonly x=1 | done
+readonly 2>/dev/null $(pwd)
+		'quoted text' readonly 2>/dev/null
+		export local export x=1 local awk && grep x=1 'quoted text' -eu
+		x=1 cd /usr/bin grep 2>/dev/null 'quoted text' 2>/dev/null
+	$(pwd) "$1" local "$@" $(pwd) /usr/bin
+	export test echo readonly readonly -eu $(pwd) export awk readonly x=1
+		-eu readonly local x=1 -eu &&
+		local sed x=1 grep 2>/dev/null
+		"$@" | cd export && echo done -eu 'quoted text' test grep --verbose "$@"
+${HOME} 2>/dev/null cd export ${HOME} /usr/bin $(pwd) export
+		"$@" export $(pwd) cd export cd then x=1 echo local
+	cd "$@" then 'quoted text' ${HOME}
+		sed "$@" $(pwd) ${HOME} ${HOME} "$1" -eu printf 'quoted text'
+"$1" awk local "$@" sed local --verbose echo $(pwd)
+	${HOME} x=1 && && test export /usr/bin
+	"$@" /usr/bin 'quoted text' x=1
+		$(pwd) then test local awk "$1"
+		&& echo "$1" /usr/bin cd echo done
+	"$@" "$1" && --verbose x=1 local printf
+		"$@" "$@" ${HOME} export test --verbose $(pwd)
+2>/dev/null then "$@" echo done --verbose test && "$1"
+x=1 --verbose test local $(pwd) sed
+	echo $(pwd) -eu awk done
+awk 2>/dev/null grep grep | awk $(pwd) export done "$1" awk done cd 2>/dev/null
+	grep cd --verbose -eu "$1" echo 'quoted text'
+		readonly printf "$1" "$@" test then export ${HOME} x=1 x=1 ${HOME}
+		-eu "$@" /usr/bin cd $(pwd) "$@" awk | | 'quoted text' | sed -eu &&
+readonly $(pwd) 'quoted text' then
+${HOME} "$1" readonly test done then awk $(pwd) local readonly readonly
+x=1 ${HOME} 2>/dev/null readonly && | $(pwd) 'quoted text'
+		test 'quoted text' 'quoted text' /usr/bin
+| then /usr/bin cd printf 2>/dev/null
+		${HOME} readonly test echo x=1 printf 2>/dev/null cd
+	| -eu && grep awk "$1" 'quoted text'
+then $(pwd) echo sed |
+		&& readonly then 'quoted text' grep -eu
+done sed export ${HOME} done readonly x=1 local
+	readonly cd /usr/bin then /usr/bin ${HOME} readonly "$1" 'quoted text' $(pwd)
+"$1" /usr/bin then 2>/dev/null grep /usr/bin export
+	grep 'quoted text' sed --verbose printf
+	awk then ${HOME} -eu 'quoted text'
+	local "$1" --verbose local grep /usr/bin
+	grep readonly local sed grep cd
+then test printf ${HOME} local grep -eu "$@" awk -eu export test --verbose
+		&& x=1 ${HOME} grep 'quoted text' readonly 2>/dev/null "$@" | printf
+		2>/dev/null test readonly
+	test printf /usr/bin sed -eu printf then 'quoted text'
+		done "$@" test "$1" -eu test then ${HOME} awk /usr/bin /usr/bin
+		printf echo /usr/bin export "$@" --verbose
+	test export ${HOME} readonly
+	printf grep "$@" then
+		then cd readonly test && done
+		| && --verbose ${HOME} awk awk local local test 'quoted text' /usr/bin -eu /usr/bin
+$(pwd) /usr/bin --verbose then ${HOME} x=1 local
+	cd "$@" export --verbose done
+	test "$1" then | grep "$1" awk done --verbose | echo x=1 sed
+	"$1" x=1 grep /usr/bin export
+-eu test "$@" 'quoted text' /usr/bin -eu "$@" printf local then && "$@" awk
+	x=1 echo echo /usr/bin -eu 'quoted text' "$@" && done 'quoted text'
+	"$1" echo done readonly awk export test then sed 2>/dev/null
+		&& grep printf test readonly x=1 && done | awk /usr/bin
+"$1" cd cd -eu readonly ${HOME}
+		local awk then then 'quoted text'
+		| 'quoted text' x=1 2>/dev/null
+	"$1" "$@" done ${HOME} readonly 'quoted text' done 'quoted text' /usr/bin
+| readonly 'quoted text' && && $(pwd) && done 2>/dev/null && "$1"
+	"$@" /usr/bin test x=1
+sed 'quoted text' $(pwd) done local echo "$1" "$@" "$@"
+readonly ${HOME} grep local cd test echo -eu local "$1" 'quoted text' test sed
+$(pwd) 'quoted text' --verbose
+		then local | --verbose local then test --verbose --verbose echo cd -eu
+		local awk -eu test x=1 "$1" sed done readonly test grep 2>/dev/null
+	$(pwd) echo export --verbose
+		'quoted text' $(pwd) "$@" "$1" x=1 /usr/bin /usr/bin grep x=1 export "$1" $(pwd)
+		${HOME} awk export 'quoted text'
+	readonly $(pwd) export export readonly then && export awk
+	then cd echo done $(pwd) readonly
+		echo "$1" "$@" $(pwd) sed 2>/dev/null echo cd
+	grep | --verbose /usr/bin ${HOME} echo 'quoted text' && done
+export 'quoted text' echo $(pwd) cd --verbose ${HOME} test |
+$(pwd) printf "$@" readonly awk 2>/dev/null echo readonly "$@" 2>/dev/null
+x=1 && -eu awk awk local x=1 && 'quoted text'
+	test && echo cd awk x=1 "$@" && cd grep "$1" cd 2>/dev/null $(pwd) "$@"
+		export && 'quoted text' | x=1 ${HOME} local --verbose then && cd
+echo export readonly export
+		printf export printf /usr/bin "$@" 'quoted text' $(pwd)
+	'quoted text' echo | --verbose printf x=1 awk local | "$@" then done | -eu
+/usr/bin awk --verbose ${HOME}
+		x=1 readonly | readonly done "$1" sed echo ${HOME}
+	done test grep readonly sed | cd ${HOME} export
+	"$1" /usr/bin "$1" x=1 ${HOME} ${HOME} $(pwd) readonly -eu
+		"$@" sed && x=1 cd test
+		awk && cd sed grep printf
+local readonly local -eu 2>/dev/null
+		"$@" "$1" | grep local x=1 | test cd sed "$@" x=1 cd export echo
+	test done test "$@" local 'quoted text' && 2>/dev/null "$@" printf --verbose
+done "$1" local awk /usr/bin export
+	&& /usr/bin "$@" /usr/bin readonly sed && sed | done "$@"
+echo -eu 2>/dev/null export 2>/dev/null readonly | awk local x=1 "$@" local
+${HOME} readonly done | ${HOME} then
+"$1" test printf then local readonly x=1
+		-eu 'quoted text' "$1" -eu done grep awk 2>/dev/null "$1" 2>/dev/null test export
+	done 'quoted text' $(pwd) "$1" ${HOME} sed /usr/bin
+		--verbose cd then printf -eu printf then then
+		-eu $(pwd) local $(pwd) x=1 ${HOME}
+&& awk /usr/bin local then --verbose /usr/bin export 2>/dev/null local
+		"$1" 'quoted text' sed 2>/dev/null test sed sed grep --verbose local x=1 export
+	awk && echo "$1" then | done | export grep 2>/dev/null sed grep -eu /usr/bin
+done $(pwd) /usr/bin printf done $(pwd) "$1" && "$1" "$1"
+-eu /usr/bin "$@" echo test "$1" "$1" sed x=1
+		export 2>/dev/null 2>/dev/null 'quoted text' 'quoted text' x=1
+	export cd cd 'quoted text' then | 'quoted text' && then $(pwd)
+/usr/bin && x=1 then --verbose cd then 2>/dev/null sed -eu printf
+		x=1 done 2>/dev/null awk $(pwd) /usr/bin
+		| x=1 grep test ${HOME} sed awk x=1 ${HOME} x=1 then done awk echo echo
+	then test x=1 cd sed --verbose | sed printf done && echo
+		&& echo test then x=1
+	'quoted text' "$1" | --verbose
+done then cd export --verbose cd grep "$1" --verbose | "$@"
+grep 2>/dev/null --verbose $(pwd) grep 'quoted text'
+'quoted text' -eu test -eu local
+| grep printf ${HOME} --verbose ${HOME} &&
+		x=1 readonly then -eu done
+/usr/bin -eu 'quoted text' /usr/bin cd echo cd 'quoted text' -eu x=1 grep printf
+	| x=1 printf 'quoted text' --verbose --verbose sed awk | 2>/dev/null x=1 done
+	grep "$1" readonly cd then then ${HOME} x=1 x=1 done /usr/bin echo test $(pwd) -eu
+		$(pwd) printf done "$@" cd local | local "$1" "$@" "$1"
+	printf 2>/dev/null local "$1" sed --verbose "$@" then --verbose | 'quoted text'
+		${HOME} x=1 ${HOME} ${HOME} "$1" awk 'quoted text' "$@" awk -eu | $(pwd)
+		local "$@" /usr/bin done sed 'quoted text' $(pwd) sed -eu && $(pwd)
+"$@" done | export ${HOME} $(pwd) grep export 'quoted text'
+-eu then x=1 $(pwd) 2>/dev/null awk "$@" &&
+		cd grep 2>/dev/null test ${HOME} grep cd printf x=1 then cd then done
+	${HOME} && 'quoted text' "$@" 'quoted text' test ${HOME} grep export "$1" then
+		| echo 2>/dev/null awk local export "$1"
+		export | 2>/dev/null local
+	"$@" /usr/bin 'quoted text' awk test 2>/dev/null 2>/dev/null
+echo x=1 $(pwd) | $(pwd) -eu 'quoted text' -eu export "$@" local awk "$@" export
+	"$1" export then "$1" export /usr/bin awk test awk export
+	/usr/bin done readonly local "$@" -eu
+export "$@" then cd awk cd readonly cd export export 'quoted text'
+	test ${HOME} sed 2>/dev/null "$@" ${HOME} --verbose export
+	-eu cd printf echo done
+/usr/bin cd awk x=1 | readonly printf "$1" 2>/dev/null
+		${HOME} "$@" grep sed readonly grep 'quoted text' && echo --verbose
+/usr/bin /usr/bin done "$1" ${HOME}
+test && --verbose export readonly then readonly $(pwd) readonly
+export x=1 export && local awk echo cd | then grep 2>/dev/null
+		${HOME} "$1" test -eu x=1
+"$@" 'quoted text' cd "$1" test test sed local export "$1" awk | test "$1"
+readonly then && $(pwd) readonly
+		printf export printf local grep "$1" -eu cd 'quoted text'
+| && "$@" local sed export --verbose &&
+/usr/bin sed export x=1 -eu /usr/bin export cd grep $(pwd) readonly
+$(pwd) readonly x=1 test /usr/bin && "$1" done
+	echo 2>/dev/null /usr/bin printf echo ${HOME}
+then && grep readonly ${HOME} grep echo $(pwd) $(pwd)
+		then | /usr/bin grep cd echo $(pwd)
+	export then $(pwd) then 2>/dev/null --verbose &&
+then export sed $(pwd) "$1" printf
+	done printf export -eu local local export
+		grep /usr/bin "$@" awk 2>/dev/null --verbose cd echo done | "$1" |
+	2>/dev/null printf echo | $(pwd) grep readonly then /usr/bin -eu printf ${HOME}
+		$(pwd) export then ${HOME} cd then grep sed $(pwd) test cd cd local
+then done ${HOME} 'quoted text' cd test local 2>/dev/null export local
+		export | then readonly
+		"$1" && --verbose test "$1" 2>/dev/null then grep then /usr/bin readonly
+	sed then sed awk "$1" && ${HOME} test
+local local && cd $(pwd) test | "$@" /usr/bin "$@" done export sed
+	$(pwd) ${HOME} "$1" sed && sed grep 2>/dev/null x=1 grep -eu readonly test cd
+	2>/dev/null "$1" export export && cd 2>/dev/null 'quoted text' local /usr/bin
+${HOME} && sed done | | test $(pwd) local x=1 /usr/bin
+"$@" --verbose "$@" 'quoted text' done
+export 2>/dev/null $(pwd) cd then
+		printf grep "$@" /usr/bin "$@" "$@" sed echo "$1"
+awk ${HOME} && /usr/bin then -eu then | done ${HOME} test readonly done
+		echo test done cd printf --verbose "$1" echo local test
+		| done echo x=1 2>/dev/null x=1 then -eu 2>/dev/null sed
+		test sed export && ${HOME} cd
+cd grep done sed then 2>/dev/null export
+	printf test 2>/dev/null grep $(pwd)
+	export x=1 --verbose x=1 sed done /usr/bin done echo export ${HOME}
+"$@" then ${HOME} cd /usr/bin 'quoted text' "$@"
+		"$@" printf "$1" test && echo done grep
+-eu -eu done && printf sed /usr/bin cd export test /usr/bin then | cd x=1
+	readonly --verbose local export /usr/bin cd awk "$@" "$1"
+export local then awk --verbose awk |
+echo echo echo done readonly 'quoted text' 2>/dev/null then local
+test | sed printf printf export
+	&& local x=1 x=1 local
+	/usr/bin local | 2>/dev/null done $(pwd) echo local readonly 'quoted text'
+		grep 'quoted text' ${HOME} sed "$@" done
+		--verbose readonly -eu && 2>/dev/null readonly &&
+	| "$@" --verbose echo --verbose 2>/dev/null "$@" sed echo test /usr/bin
+then 2>/dev/null then --verbose awk $(pwd) echo --verbose sed /usr/bin then --verbose
+	| $(pwd) && readonly then 2>/dev/null export x=1 2>/dev/null printf done "$1"
+		| -eu $(pwd) done grep cd echo grep
+		readonly $(pwd) 'quoted text' | readonly local
+		&& grep done awk awk "$@" grep local cd /usr/bin --verbose
+	/usr/bin cd printf && sed x=1 ${HOME} $(pwd) grep "$1" export
+	cd x=1 && export grep echo 2>/dev/null test sed "$1" "$1" test local "$1" | /usr/bin
+		"$@" -eu test export -eu awk done -eu $(pwd) && --verbose ${HOME}
+	&& cd "$@" export $(pwd)
+		$(pwd) --verbose readonly x=1 | sed "$1" | && cd local local awk x=1 then export
+	done && grep "$@" ${HOME} done | echo
+	"$@" sed --verbose $(pwd) ${HOME} export ${HOME} 2>/dev/null ${HOME} printf
+		--verbose --verbose export x=1 done "$@" 'quoted text' echo
+		$(pwd) --verbose export echo test 'quoted text'
+local $(pwd) export then | 2>/dev/null 'quoted text'
+-eu done done && then then
+		2>/dev/null 'quoted text' 2>/dev/null $(pwd) "$1" --verbose
+awk 2>/dev/null $(pwd) readonly export && sed && done
+--verbose cd 'quoted text' grep
+	printf && test export export 2>/dev/null sed -eu | "$@" export "$@" /usr/bin local
+'quoted text' /usr/bin --verbose "$@" "$@" /usr/bin echo 2>/dev/null
+	awk | export readonly 'quoted text'
+		${HOME} $(pwd) done test ${HOME} && ${HOME} $(pwd) export cd then local export
+		cd local --verbose test x=1 "$1" printf 'quoted text' $(pwd) --verbose awk -eu
+export ${HOME} | echo && cd test ${HOME} sed "$1" then printf local $(pwd) 'quoted text'
+"$1" x=1 echo /usr/bin printf "$@" local cd readonly cd echo local
+		2>/dev/null ${HOME} "$@" 2>/dev/null --verbose
+		local | 'quoted text' ${HOME}
+		test -eu local cd export export 'quoted text' awk
+"$1" echo readonly 'quoted text' --verbose export && cd 'quoted text'
+		'quoted text' test grep test printf 2>/dev/null $(pwd) grep 2>/dev/null
+2>/dev/null "$1" test 2>/dev/null cd cd ${HOME}
+		export ${HOME} && 2>/dev/null awk printf done
+		2>/dev/null /usr/bin export && test printf test cd printf
+		done export $(pwd) $(pwd) 'quoted text' /usr/bin | && 'quoted text'
+	export 'quoted text' | /usr/bin 'quoted text' 'quoted text'
+export | "$1" /usr/bin readonly | | "$1" | done test printf export | test 2>/dev/null
+/usr/bin grep awk test test x=1 'quoted text'
+	x=1 sed -eu 2>/dev/null sed cd awk awk sed test ${HOME}
+	local --verbose | && | 'quoted text' && sed done
+		$(pwd) | | "$@" | echo awk then x=1 /usr/bin
+-eu test echo export printf ${HOME}
+		'quoted text' cd /usr/bin sed sed 2>/dev/null
+		${HOME} cd ${HOME} -eu $(pwd) echo local /usr/bin
+	printf then "$@" cd export 2>/dev/null export printf $(pwd) test ${HOME}
+2>/dev/null "$1" sed grep sed --verbose
+		cd done -eu local "$@" test printf && sed printf "$@" 2>/dev/null
+		export $(pwd) local then -eu
+local echo -eu 2>/dev/null 2>/dev/null x=1
+2>/dev/null /usr/bin cd 2>/dev/null awk readonly "$1" cd ${HOME} "$@" test --verbose
+	x=1 local export "$1" 'quoted text' cd readonly "$@" then
+		2>/dev/null readonly awk --verbose sed done local "$@" -eu -eu printf local printf
+	done then --verbose $(pwd) /usr/bin /usr/bin -eu && echo export cd
+		$(pwd) 2>/dev/null /usr/bin then ${HOME} sed then awk
+printf -eu printf awk "$@"
+		done local ${HOME} -eu -eu ${HOME} 'quoted text'
+local done --verbose $(pwd) x=1 test $(pwd)
+		${HOME} then cd | $(pwd) awk && "$@" echo
+		"$1" test | x=1 x=1 'quoted text' "$1" && -eu 2>/dev/null printf
+export 'quoted text' && done "$1" local ${HOME}
+		readonly /usr/bin ${HOME} done --verbose && export grep then "$@" && then
+readonly "$@" test readonly local --verbose readonly awk x=1 | then $(pwd)
+		2>/dev/null awk echo export x=1 "$@" test | -eu 2>/dev/null
+grep echo sed then 'quoted text' 2>/dev/null | 'quoted text'
+	grep 2>/dev/null --verbose echo --verbose && sed
+printf readonly "$@" ${HOME} done printf then "$1" local "$1" grep |
+		awk sed 2>/dev/null printf | echo && 'quoted text' awk cd $(pwd) awk readonly &&
+	--verbose "$1" $(pwd) done cd echo
+	x=1 echo x=1 export $(pwd) "$1" -eu awk grep grep grep export printf
+export echo /usr/bin local ${HOME}
+		cd "$@" 'quoted text' ${HOME}
+	2>/dev/null $(pwd) awk "$1" | then
+		x=1 test ${HOME} /usr/bin /usr/bin local | test test then
+test ${HOME} echo test done ${HOME} x=1 grep $(pwd) printf grep test 2>/dev/null
+	| $(pwd) 2>/dev/null $(pwd) -eu 'quoted text' "$1"
+	sed printf "$@" cd ${HOME} $(pwd) export "$1" cd | $(pwd)
+/usr/bin | $(pwd) x=1 readonly
+		-eu done cd readonly "$1" "$@" 2>/dev/null "$@" 2>/dev/null && then then /usr/bin
+grep done export echo
+		'quoted text' printf "$1" x=1 && ${HOME} /usr/bin
+		&& --verbose cd sed awk
+--verbose local cd then ${HOME}
+		${HOME} -eu awk awk done 2>/dev/null cd export local awk test
+	${HOME} printf export test ${HOME} done 'quoted text' "$@" "$@"
+awk | ${HOME} /usr/bin -eu local 2>/dev/null "$1" $(pwd)
+	"$@" awk --verbose awk 'quoted text'
+		x=1 local "$@" "$@" readonly --verbose then sed $(pwd) 2>/dev/null 2>/dev/null
+		awk export echo $(pwd) ${HOME} local | sed then awk | && x=1 echo local
+	printf /usr/bin export cd readonly "$1" 2>/dev/null /usr/bin "$@"
+		echo 'quoted text' local echo done grep readonly then ${HOME}
+	test local "$1" "$@" grep | ${HOME} export | $(pwd) awk
+	then printf done 2>/dev/null && 2>/dev/null 'quoted text' /usr/bin && 2>/dev/null
+	printf 2>/dev/null && --verbose printf sed cd echo 'quoted text' local $(pwd) "$@"
+		/usr/bin 2>/dev/null "$1" | "$@" local 2>/dev/null readonly
+	printf readonly $(pwd) && printf $(pwd) awk echo 2>/dev/null
+		&& awk | grep echo 'quoted text'
+	--verbose export local done 2>/dev/null
+		cd /usr/bin /usr/bin /usr/bin -eu x=1 local
+		done $(pwd) | sed local "$1" test "$@" then 'quoted text' done grep grep
+		cd | cd /usr/bin 'quoted text' $(pwd) test
+	export | done -eu $(pwd)
+		&& then ${HOME} "$1" readonly
+		sed readonly 'quoted text' done export -eu export $(pwd) test "$@" then
+		$(pwd) readonly export 'quoted text' sed "$@" /usr/bin && test local sed
+	"$1" --verbose x=1 grep $(pwd)
+local echo awk grep -eu $(pwd) "$@"
+2>/dev/null 'quoted text' &&
+	done 2>/dev/null export
+	2>/dev/null awk ${HOME} cd 'quoted text'
+awk x=1 ${HOME} done echo test "$1" 'quoted text' $(pwd)
+		-eu 'quoted text' local test | "$1" "$@" sed cd
+-eu -eu ${HOME} test | test "$1"
+		--verbose awk /usr/bin sed $(pwd) then "$@" cd done | 'quoted text' export export
+		"$1" | /usr/bin ${HOME} && -eu -eu 2>/dev/null printf
+2>/dev/null export then "$1" then
+	done printf cd local --verbose awk --verbose
+		test x=1 'quoted text' then && ${HOME}
+printf && done $(pwd) --verbose "$@" grep 2>/dev/null x=1 'quoted text'
+export 2>/dev/null && done
+/usr/bin x=1 awk echo echo $(pwd) done -eu
+	echo awk 2>/dev/null then grep
+	test done $(pwd) echo 2>/dev/null awk then --verbose --verbose
+		then -eu 2>/dev/null --verbose
+		done --verbose "$@" export | awk
+		${HOME} grep 2>/dev/null | | done echo local local /usr/bin ${HOME} -eu test
+		local local /usr/bin 2>/dev/null /usr/bin
+	readonly cd grep /usr/bin
+	test local "$@" readonly
+	2>/dev/null ${HOME} --verbose | done done |
+-eu then && echo | | /usr/bin 2>/dev/null
+--verbose --verbose --verbose echo sed awk $(pwd) echo awk local "$1"
+	then "$@" local ${HOME} awk export readonly local "$1"
+2>/dev/null grep /usr/bin then && | "$1"
+		"$1" awk | grep && export printf 2>/dev/null cd "$1" "$@" --verbose 'quoted text'
+	local 2>/dev/null x=1 2>/dev/null test readonly "$@" export --verbose test -eu
+		export local awk done printf echo local x=1 $(pwd) "$1" readonly grep readonly echo
+	"$1" && readonly && sed "$1" done && x=1 readonly x=1 $(pwd) "$1" test
+		x=1 printf test /usr/bin && cd 2>/dev/null | sed grep && cd
+		test echo printf local printf 2>/dev/null
+		test grep $(pwd) test ${HOME} test 2>/dev/null
+${HOME} ${HOME} /usr/bin done "$@"
+readonly test then local /usr/bin x=1 | printf
+		x=1 -eu "$1" printf grep sed
+	grep -eu sed readonly && export 'quoted text' grep "$@" done /usr/bin
+"$1" && && readonly "$@" done readonly ${HOME} done export
+$(pwd) printf 2>/dev/null | ${HOME} done readonly local printf | $(pwd) echo
+		then export test "$1" && 'quoted text' grep awk readonly echo 'quoted text'
+		awk "$@" -eu && --verbose
+	&& && 'quoted text' "$1" "$@" | | 'quoted text'
+		-eu "$1" ${HOME} $(pwd) $(pwd)
+	sed test cd /usr/bin sed printf test local "$@" printf cd printf -eu $(pwd)
+	"$1" 2>/dev/null done 'quoted text'
+&& && "$1" -eu $(pwd) grep
+$(pwd) cd && then /usr/bin done export then done local && readonly
+2>/dev/null --verbose 2>/dev/null sed x=1 test echo
+	"$@" $(pwd) readonly 'quoted text' test done
+		printf grep printf printf printf then && grep
+	printf /usr/bin && "$1" printf echo cd done sed "$@" | | awk "$@"
+--verbose ${HOME} export printf local printf echo ${HOME}
+	| printf /usr/bin cd 2>/dev/null
+	then local printf sed ${HOME} | /usr/bin done local readonly 'quoted text'
+	printf cd test 2>/dev/null 2>/dev/null cd 'quoted text'
+	--verbose /usr/bin cd done awk "$1" echo "$1" "$1" awk local -eu && readonly
+	--verbose 2>/dev/null 'quoted text' cd && ${HOME} -eu
+		awk /usr/bin sed && echo sed done | local sed x=1 readonly awk /usr/bin
+	export readonly ${HOME}
+		$(pwd) printf then echo 2>/dev/null 2>/dev/null && $(pwd)
+awk 2>/dev/null 2>/dev/null test
+printf awk x=1 awk echo "$@" && && /usr/bin $(pwd)
+		x=1 test echo $(pwd) sed readonly
+2>/dev/null | --verbose sed echo done then
+		echo "$1" done /usr/bin test -eu | 'quoted text'
+	-eu | printf cd local echo export
+	"$1" --verbose $(pwd) awk test --verbose printf "$1"
+		echo printf $(pwd) grep $(pwd) --verbose awk /usr/bin
+	${HOME} 2>/dev/null /usr/bin then
+		sed 2>/dev/null x=1 --verbose grep then ${HOME} then && 2>/dev/null echo
+		-eu | printf x=1 then test /usr/bin
+export -eu /usr/bin $(pwd) $(pwd)
+	"$@" grep | -eu sed | done -eu
+		printf 'quoted text' printf readonly x=1 readonly sed
+		export grep && /usr/bin ${HOME}
+		local then 'quoted text' test cd 'quoted text'
+	readonly --verbose | --verbose -eu ${HOME} done $(pwd) /usr/bin printf
@@ -0,0 +1,2001 @@
+	$(pwd) echo | 2>/dev/null export x=1 then "$@" 2>/dev/null 2>/dev/null test "$1"
+		&& readonly ${HOME} export local -eu done
+		export test printf export "$1" export -eu | echo 2>/dev/null
+cd --verbose then cd | 'quoted text' $(pwd) && awk local printf -eu test
+	readonly readonly 2>/dev/null 2>/dev/null echo export 2>/dev/null "$1"
+		/usr/bin then ${HOME} && cd /usr/bin "$@" done
+		awk 2>/dev/null readonly awk | -eu | x=1 local test "$@" test |
+"$1" "$1" printf 2>/dev/null "$1" $(pwd)
+-eu test sed done | then done
+grep readonly x=1 grep test | 'quoted text' $(pwd) --verbose
+	echo awk grep 2>/dev/null local printf readonly
+printf grep /usr/bin cd "$@"
+x=1 /usr/bin "$@" local echo "$1" "$@"
+grep local echo cd export $(pwd) 2>/dev/null
+--verbose done "$1" echo local echo /usr/bin -eu ${HOME} ${HOME} ${HOME}
+	x=1 --verbose done local -eu sed printf cd awk sed
+		done ${HOME} awk 2>/dev/null | /usr/bin -eu | ${HOME} cd
+then export sed --verbose
+		| 2>/dev/null export ${HOME} /usr/bin readonly x=1 export
+	grep "$@" local -eu | done done echo cd printf printf | 'quoted text'
+	awk ${HOME} /usr/bin local test /usr/bin export
+x=1 export && $(pwd) awk local
+awk echo sed 'quoted text' test sed /usr/bin local
+		'quoted text' readonly readonly local grep && | done "$@" ${HOME} | ${HOME}
+'quoted text' 'quoted text' printf "$1" printf $(pwd) 'quoted text' awk test
+		test then then test ${HOME} then "$1" | 'quoted text'
+	&& done $(pwd) local --verbose echo then | 'quoted text' printf
+	"$1" local && "$@" local awk -eu $(pwd) && 'quoted text'
+'quoted text' | $(pwd) test $(pwd) x=1 -eu grep ${HOME}
+		printf 2>/dev/null cd done | "$1" printf
+		sed test 'quoted text' sed export awk grep $(pwd)
+/usr/bin done --verbose
+cd test $(pwd) readonly
+		$(pwd) echo readonly ${HOME} $(pwd) readonly
+		grep --verbose $(pwd) "$@" awk sed grep export $(pwd) then test
+		x=1 readonly /usr/bin && 2>/dev/null cd
+	"$1" sed cd done readonly awk export awk x=1 printf export
+'quoted text' --verbose echo then test && printf printf test
+"$@" readonly echo | "$1" sed then x=1 sed sed
+		test && 'quoted text' 2>/dev/null
+readonly ${HOME} $(pwd) --verbose --verbose
+done 2>/dev/null test -eu cd $(pwd) readonly readonly done
+sed ${HOME} awk export $(pwd) $(pwd) -eu 'quoted text'
+-eu 'quoted text' ${HOME}
+		&& -eu 2>/dev/null ${HOME} echo awk --verbose ${HOME}
+printf sed readonly awk "$@" done awk echo grep
+	"$@" done then $(pwd) grep $(pwd) && --verbose "$@" x=1 'quoted text'
+		export local 2>/dev/null "$@" ${HOME} && printf | grep 'quoted text'
+		echo | /usr/bin awk --verbose local then x=1 | x=1 done sed readonly x=1 "$1"
+done /usr/bin 2>/dev/null readonly
+/usr/bin x=1 "$@" local && export 2>/dev/null grep
+local echo /usr/bin echo printf 2>/dev/null then cd test printf
+local 2>/dev/null 2>/dev/null printf
+	echo grep awk x=1 --verbose "$1"
+		cd echo cd cd "$1" readonly grep sed sed
+		test grep grep x=1 export 'quoted text' grep readonly 2>/dev/null |
+		then local awk sed export /usr/bin ${HOME} x=1 /usr/bin
+	x=1 "$1" "$@" awk && export --verbose ${HOME} local x=1 && readonly sed sed
+		"$@" done ${HOME} -eu "$1" 2>/dev/null local echo printf echo /usr/bin grep grep
+"$1" $(pwd) ${HOME} cd 2>/dev/null
+		${HOME} then 2>/dev/null readonly printf export --verbose
+		echo x=1 echo /usr/bin x=1 -eu printf
+		awk awk $(pwd) done 'quoted text'
+		echo readonly --verbose $(pwd) readonly
+echo test grep 'quoted text' readonly echo && | cd
+readonly awk then "$1" --verbose --verbose local
+"$@" x=1 /usr/bin | echo $(pwd) echo local 2>/dev/null ${HOME}
+	printf readonly x=1 test export --verbose | $(pwd) "$1"
+	"$@" /usr/bin then $(pwd) sed x=1
+local 'quoted text' grep cd printf "$1" then awk readonly
+| "$1" echo x=1 test && $(pwd) ${HOME} echo echo
+cd /usr/bin --verbose grep sed sed printf then printf | test echo "$1" | grep echo
+"$1" export readonly grep echo printf "$1" "$1" cd "$@" 2>/dev/null grep 'quoted text'
+	local test -eu && echo grep awk printf "$@" "$@" export $(pwd) grep /usr/bin
+| echo -eu grep then --verbose done "$@" cd -eu local
+		readonly -eu $(pwd) grep done | | sed readonly echo grep awk sed echo sed done
+	cd "$1" test then export awk | | grep test ${HOME}
+		awk -eu grep | printf local grep -eu grep /usr/bin done done test x=1 sed
+${HOME} then cd --verbose ${HOME} ${HOME} cd /usr/bin | grep then
+then printf then readonly readonly echo sed done cd cd
+	export local && then ${HOME} && --verbose --verbose 'quoted text'
+	-eu cd done awk grep "$1" sed local local $(pwd) cd cd /usr/bin sed sed "$@" -eu
+		readonly ${HOME} x=1 -eu
+		echo grep "$@" "$1" cd 'quoted text' | sed 'quoted text' export done cd -eu
+	$(pwd) then test "$1" test $(pwd) echo then sed $(pwd) $(pwd) cd -eu awk
+"$1" && then readonly 2>/dev/null && awk grep grep local test export echo local
+cd awk echo -eu cd grep -eu test -eu | -eu | -eu awk "$1" "$1" -eu then grep
+	test $(pwd) && cd sed 2>/dev/null readonly local
+	sed test x=1 'quoted text' -eu ${HOME} sed "$@"
+		grep | done done local sed then "$1"
+		-eu echo done printf "$1" done /usr/bin
+	grep && "$1" "$@" /usr/bin | 'quoted text'
+-eu | --verbose x=1 echo
+export readonly $(pwd) /usr/bin -eu /usr/bin sed /usr/bin | readonly
+	sed && $(pwd) local "$1" awk --verbose cd /usr/bin $(pwd) echo /usr/bin awk
+		/usr/bin printf && grep readonly
+	-eu grep /usr/bin local sed cd echo -eu test readonly done 'quoted text'
+	$(pwd) echo printf "$1" "$1" "$1" 'quoted text'
+2>/dev/null done done local --verbose "$@" 2>/dev/null sed echo
+"$@" done | && echo awk awk 'quoted text' $(pwd) then printf
+		-eu && echo x=1 awk 2>/dev/null --verbose
+done grep && then && then x=1 2>/dev/null sed test printf --verbose local cd
+-eu cd --verbose awk && echo local readonly sed /usr/bin local x=1 test export
+	readonly /usr/bin "$1" grep
+${HOME} "$@" "$@" ${HOME} done printf -eu sed readonly
+then cd x=1 && local | -eu test
+	${HOME} grep printf then printf local /usr/bin printf x=1
+		printf x=1 $(pwd) awk --verbose ${HOME} -eu printf -eu $(pwd) 'quoted text'
+		-eu echo grep echo "$1" printf done | "$1" cd
+		test done test $(pwd) 'quoted text' $(pwd) "$1" ${HOME}
+$(pwd) readonly export "$@"
+	-eu done test awk then
+		then printf ${HOME} printf readonly && --verbose done export export awk -eu
+	grep "$@" x=1 "$1" echo local sed 2>/dev/null
+		readonly 'quoted text' 'quoted text' awk x=1 printf
+cd local "$@" printf /usr/bin local | ${HOME} |
+		export grep | 'quoted text' "$1" 2>/dev/null | --verbose 'quoted text' "$1"
+	test x=1 "$1" x=1 then awk test grep then export -eu sed local
+	2>/dev/null sed x=1 | "$@" printf local local -eu test -eu "$@" /usr/bin
+		-eu "$@" grep awk 2>/dev/null cd
+	--verbose 'quoted text' 2>/dev/null /usr/bin grep && grep then
+	/usr/bin -eu local $(pwd) | "$1" then -eu
+	export awk 'quoted text' $(pwd) ${HOME} --verbose
+		printf local 'quoted text' local -eu /usr/bin && "$@" -eu sed grep ${HOME}
+		$(pwd) && --verbose "$1" 2>/dev/null
+cd --verbose readonly /usr/bin export test export done printf ${HOME} x=1
+		sed grep -eu test "$@" $(pwd) "$@" -eu sed x=1 ${HOME} grep
+then cd 2>/dev/null $(pwd) sed ${HOME} --verbose test "$1" /usr/bin sed sed test
+x=1 2>/dev/null grep grep x=1 echo readonly
+		grep awk ${HOME} grep echo 2>/dev/null | 2>/dev/null 'quoted text' ${HOME} local
+	echo -eu x=1 "$1" echo
+	2>/dev/null --verbose x=1 2>/dev/null
+		export grep $(pwd) 2>/dev/null echo sed sed local echo grep grep readonly
+		&& grep then && test 'quoted text' readonly "$1"
+		readonly 'quoted text' 2>/dev/null sed x=1 $(pwd) export x=1 -eu 2>/dev/null
+printf awk "$@" "$@" 'quoted text'
+'quoted text' $(pwd) awk --verbose | /usr/bin x=1 grep | echo
+--verbose | local then ${HOME}
+		/usr/bin $(pwd) x=1 local awk sed /usr/bin awk test "$@" echo local local
+		"$1" 'quoted text' grep 2>/dev/null "$@" 2>/dev/null
+	echo /usr/bin awk 'quoted text' "$1" printf test readonly
+	$(pwd) --verbose -eu echo sed "$1" then x=1 local cd 2>/dev/null
+local "$@" -eu "$1" awk && /usr/bin done -eu --verbose then awk sed done | "$@"
+/usr/bin | then $(pwd) x=1 /usr/bin "$1" printf
+		'quoted text' test awk sed local | cd readonly then && ${HOME}
+	x=1 'quoted text' done readonly
+	printf awk local done sed export 2>/dev/null $(pwd)
+--verbose 'quoted text' printf local $(pwd) ${HOME}
+awk -eu x=1 "$@" 'quoted text' cd 2>/dev/null && /usr/bin
+	printf local $(pwd) printf done
+		2>/dev/null readonly local printf "$1" 'quoted text' && 'quoted text' echo
+		then grep -eu && /usr/bin $(pwd)
+		"$1" grep awk /usr/bin -eu awk "$@"
+	export --verbose --verbose done -eu awk local --verbose awk | && local done
+	grep "$1" /usr/bin 'quoted text' sed x=1 awk local
+	-eu awk 'quoted text' test done ${HOME} "$1" cd /usr/bin ${HOME} then
+	done cd test grep | "$@" awk
+		awk "$1" export awk done done | 2>/dev/null && "$1" readonly
+		"$1" export 'quoted text' export "$1" printf printf cd "$@" cd cd ${HOME} 'quoted text'
+	done /usr/bin printf "$@" export -eu 'quoted text' awk export grep done export
+	${HOME} --verbose echo printf /usr/bin readonly
+	export -eu done awk 'quoted text'
+		2>/dev/null then cd x=1
+		then awk awk x=1 sed cd 2>/dev/null sed printf test readonly
+		local && 'quoted text' readonly
+	${HOME} echo printf printf local sed --verbose |
+		then x=1 cd test && "$@" x=1 x=1 awk cd sed -eu
+readonly awk 2>/dev/null "$1" | printf export
+"$1" printf then -eu "$@" then then grep local printf
+		${HOME} 'quoted text' --verbose export then grep
+		grep $(pwd) ${HOME} "$1" done
+		2>/dev/null local ${HOME} cd ${HOME} awk grep /usr/bin "$@"
+	local export sed readonly ${HOME} /usr/bin sed then -eu x=1 | 'quoted text' local
+		${HOME} done "$@" then 2>/dev/null grep export sed echo test ${HOME} cd
+		| awk readonly sed x=1 ${HOME} test local 2>/dev/null x=1 then local printf
+printf printf test "$1" local ${HOME}
+	sed readonly awk /usr/bin x=1 grep local
+export $(pwd) 'quoted text' | && ${HOME} -eu 2>/dev/null -eu -eu $(pwd)
+		${HOME} local export && ${HOME} cd "$1" -eu | done export $(pwd) printf
+-eu 'quoted text' sed echo "$@" x=1 grep
+cd | $(pwd) 'quoted text' $(pwd) && "$@" --verbose
+		echo local | "$@" $(pwd) 2>/dev/null -eu
+		--verbose 2>/dev/null $(pwd) awk printf /usr/bin then "$@" local "$@" grep
+	awk && /usr/bin awk awk -eu 2>/dev/null -eu local
+	readonly -eu 2>/dev/null -eu echo cd $(pwd)
+		'quoted text' 'quoted text' test | then sed 2>/dev/null
+	&& grep then done cd x=1 ${HOME} $(pwd) done && x=1 grep test ${HOME}
+	done grep awk && awk ${HOME} "$1" then x=1 printf ${HOME} printf "$@" readonly
+		/usr/bin done sed sed | cd readonly local awk test cd
+	then then "$1" test local x=1 done then test export 2>/dev/null
+done awk --verbose cd readonly $(pwd) -eu --verbose
+"$@" ${HOME} awk echo printf | && done
+	grep 'quoted text' test "$@" grep "$@" "$@" sed |
+		-eu 2>/dev/null readonly $(pwd) sed sed readonly
+		awk sed $(pwd) && awk 2>/dev/null test /usr/bin $(pwd) awk
+		sed "$1" then --verbose /usr/bin &&
+		printf done 'quoted text' local
+grep awk printf cd "$@" 'quoted text' cd | grep && /usr/bin $(pwd) ${HOME}
+		readonly sed "$1" echo grep && cd sed then
+		readonly /usr/bin echo echo 2>/dev/null x=1 x=1 'quoted text' awk $(pwd)
+done grep test && grep echo grep
+	test local 2>/dev/null 2>/dev/null
+	test done awk "$1" --verbose ${HOME} "$1" sed x=1 /usr/bin $(pwd) local --verbose
+		echo cd then cd local cd x=1 then 2>/dev/null awk /usr/bin done cd && 2>/dev/null
+	done then "$@" sed echo "$@" "$@" printf readonly
+	done && awk grep | local $(pwd) local awk cd x=1 awk && test 'quoted text'
+	sed done /usr/bin local cd grep done export ${HOME} test "$1" /usr/bin printf
+	"$1" --verbose cd "$1" echo echo | x=1 awk sed test done export export -eu printf
+		"$@" -eu awk local && sed sed done test awk
+	readonly -eu 'quoted text' /usr/bin
+2>/dev/null readonly awk export readonly cd --verbose
+sed local $(pwd) "$@" 'quoted text' readonly
+		printf | $(pwd) /usr/bin grep 'quoted text' awk -eu printf
+		| "$@" readonly 'quoted text' -eu echo 'quoted text' cd echo
+--verbose /usr/bin 'quoted text' echo x=1 sed --verbose -eu ${HOME} test
+	then x=1 done export test readonly readonly then export
+	'quoted text' && local test 'quoted text' awk 'quoted text' echo grep
+	done x=1 grep sed $(pwd) -eu done
+		echo ${HOME} test cd "$1" "$1" --verbose
+	'quoted text' grep && 2>/dev/null export "$@" $(pwd)
+${HOME} local echo printf 'quoted text'
+		export printf echo && ${HOME} readonly && sed ${HOME} cd echo $(pwd)
+		test 2>/dev/null /usr/bin grep grep --verbose
+		| && awk 2>/dev/null then 2>/dev/null local
+		--verbose export sed
+		| then && awk "$1" 'quoted text' echo test | --verbose test "$1"
+done export "$@" echo sed export
+		${HOME} $(pwd) /usr/bin done "$@" | test echo sed awk
+	awk grep grep 2>/dev/null
+		x=1 awk $(pwd) export awk 2>/dev/null
+		then export 2>/dev/null printf cd grep cd done 2>/dev/null | sed ${HOME}
+${HOME} sed 'quoted text' done 'quoted text' "$@" test echo printf | $(pwd) grep
+	"$@" -eu $(pwd) --verbose x=1 export 2>/dev/null readonly printf
+echo test -eu $(pwd) awk
+	&& $(pwd) local --verbose 2>/dev/null --verbose --verbose
+	-eu readonly "$@" /usr/bin local x=1 readonly grep grep -eu done "$1" | "$1"
+"$1" 2>/dev/null -eu
+		cd ${HOME} $(pwd) test && readonly &&
+done 2>/dev/null grep | readonly grep
+	${HOME} && echo x=1 awk $(pwd) sed test local
+	$(pwd) 2>/dev/null | /usr/bin then ${HOME} 2>/dev/null
+		${HOME} x=1 2>/dev/null && --verbose printf echo --verbose
+	grep | then /usr/bin done x=1 2>/dev/null 'quoted text' 2>/dev/null 'quoted text'
+		awk "$1" -eu --verbose 2>/dev/null && export local "$@" export 'quoted text'
+$(pwd) -eu local echo sed test -eu -eu -eu "$1" sed
+	"$1" readonly -eu local readonly done readonly | sed export
+	then "$@" readonly cd sed export $(pwd)
+		&& printf echo "$1" 'quoted text' readonly
+		export test /usr/bin -eu printf then printf 2>/dev/null export
+"$1" local awk --verbose x=1 | | awk "$1" then readonly x=1 x=1 local
+		test readonly "$1" then "$1" done "$1"
+		then readonly | printf 2>/dev/null
+	sed then readonly local
+	"$@" 'quoted text' printf cd 2>/dev/null
+		printf cd test 'quoted text' && grep "$@" done ${HOME} | local && -eu |
+local grep --verbose then export done
+		$(pwd) 2>/dev/null echo grep -eu test
+	echo grep grep ${HOME} $(pwd) cd 'quoted text' grep awk
+	"$@" readonly $(pwd) done test awk "$@" | 'quoted text'
+	2>/dev/null grep readonly ${HOME} cd "$1" local --verbose --verbose
+	cd printf 2>/dev/null then done then export echo "$@" "$1" "$1" --verbose test
+	| /usr/bin x=1 sed echo /usr/bin awk awk
+local -eu printf done
+		'quoted text' /usr/bin "$@" test readonly --verbose export local ${HOME}
+	then "$1" 'quoted text' grep
+	then /usr/bin && printf done "$@" done echo done /usr/bin awk awk
+		$(pwd) local "$1" local x=1
+		-eu /usr/bin --verbose /usr/bin ${HOME} local sed printf 2>/dev/null
+sed then sed sed local export $(pwd) local 2>/dev/null && export $(pwd)
+		-eu ${HOME} "$@" awk "$1" -eu awk $(pwd)
+	done grep local 'quoted text' $(pwd) export /usr/bin
+	--verbose --verbose && test local 2>/dev/null "$1"
+		&& readonly cd readonly /usr/bin
+local "$1" cd cd "$@" readonly -eu echo 'quoted text'
+	--verbose echo local "$@" && grep 'quoted text' $(pwd) -eu readonly grep echo
+	-eu $(pwd) $(pwd) echo -eu x=1 "$1"
+		local done -eu then export
+	-eu local cd $(pwd) /usr/bin
+	readonly 'quoted text' export && $(pwd) "$1" "$@" sed local "$1"
+		printf test "$1" printf export done && x=1 then /usr/bin --verbose
+		/usr/bin echo ${HOME} x=1 /usr/bin "$1" $(pwd) /usr/bin
+2>/dev/null 2>/dev/null "$1" export && "$@" cd "$@" && | grep ${HOME}
+	/usr/bin sed test test cd x=1 test echo grep grep
+	grep --verbose $(pwd) && "$1" $(pwd) && | x=1 echo cd sed |
+	/usr/bin "$1" /usr/bin 'quoted text' cd sed sed printf 'quoted text'
+		'quoted text' grep ${HOME}
+		awk awk sed x=1 grep cd done /usr/bin
+	${HOME} local cd readonly 2>/dev/null $(pwd)
+--verbose "$1" awk echo echo
+2>/dev/null $(pwd) "$@" $(pwd) test local | 2>/dev/null /usr/bin "$1" x=1
+done && | "$1" --verbose readonly test "$1" local done readonly 2>/dev/null
+	--verbose then readonly --verbose then "$1" -eu cd awk "$1" test -eu grep
+		printf printf done local 'quoted text'
+	awk then readonly 2>/dev/null
+		-eu then 'quoted text' grep
+		-eu /usr/bin then grep $(pwd) then sed local | cd sed x=1 test
+cd done && readonly 'quoted text' export -eu |
+x=1 cd "$@" x=1 sed cd cd /usr/bin
+		sed "$1" grep cd "$@" | ${HOME} /usr/bin then 'quoted text'
+"$1" /usr/bin "$@" 2>/dev/null printf "$1" export awk cd echo $(pwd) ${HOME} local
+	then cd && | export readonly readonly
+-eu export readonly && && cd -eu test
+awk export x=1 cd "$1" readonly /usr/bin "$1" printf ${HOME}
+		2>/dev/null awk test done cd export $(pwd) then
+readonly test sed test 'quoted text' local cd /usr/bin
+		"$@" readonly then ${HOME} | printf --verbose echo
+	then 2>/dev/null /usr/bin test --verbose sed printf ${HOME} "$1" --verbose 2>/dev/null
+	'quoted text' then test readonly test 2>/dev/null
+	"$@" 'quoted text' x=1 'quoted text'
+	-eu export x=1 x=1 local
+	sed readonly local && echo -eu x=1 export printf readonly
+	/usr/bin ${HOME} sed awk ${HOME}
+	printf | awk ${HOME} grep cd 'quoted text' 2>/dev/null printf
+		local done local grep readonly "$1" /usr/bin local then x=1 local
+		--verbose test awk ${HOME}
+done sed echo local "$1" export awk then test export printf
+		test 2>/dev/null --verbose "$@" printf sed /usr/bin
+		cd 'quoted text' x=1 ${HOME} test local | echo test 'quoted text'
+&& echo local done readonly x=1 then then cd export $(pwd) "$1" readonly
+| readonly $(pwd) test then -eu && sed 2>/dev/null "$1"
+	2>/dev/null | && export --verbose 'quoted text' printf "$1" ${HOME} printf
+		export awk | ${HOME} --verbose test
+		then echo cd --verbose /usr/bin local /usr/bin --verbose
+done x=1 readonly $(pwd) then local cd printf "$1" local ${HOME}
+$(pwd) /usr/bin 'quoted text'
+local "$@" 'quoted text' -eu export sed
+		printf grep awk printf cd readonly readonly then 'quoted text' "$@" awk cd sed
+	test && "$@" readonly then readonly echo /usr/bin
+		readonly test ${HOME} echo 2>/dev/null 2>/dev/null
+	grep grep /usr/bin "$1" "$1" awk | test && 2>/dev/null -eu local
+printf done done -eu "$@" done cd awk then done --verbose /usr/bin
+		--verbose done 'quoted text'
+then grep export 2>/dev/null
+		/usr/bin export echo test readonly printf done ${HOME}
+		&& 2>/dev/null readonly $(pwd)
+2>/dev/null /usr/bin test /usr/bin printf awk $(pwd)
+local awk 2>/dev/null 'quoted text' "$@" printf "$@" then "$@"
+x=1 ${HOME} x=1 grep local --verbose 2>/dev/null echo
+printf then 2>/dev/null then 2>/dev/null
+	printf awk $(pwd) && grep 2>/dev/null local cd "$1" readonly --verbose
+	then printf ${HOME} 'quoted text' /usr/bin readonly sed sed test
+&& 'quoted text' echo test done readonly export export
+		&& x=1 cd local grep cd /usr/bin readonly echo cd then $(pwd)
+then done awk $(pwd) awk 'quoted text'
+cd then cd 2>/dev/null then done sed 'quoted text'
+&& | echo sed grep 'quoted text' export
+	sed done echo awk sed awk printf | x=1 local /usr/bin then local
+	grep test 'quoted text' readonly ${HOME} && test local cd $(pwd) sed
+		&& echo export readonly echo | 2>/dev/null && 'quoted text' cd ${HOME} awk
+awk local cd then $(pwd) test cd "$@" 'quoted text'
+		2>/dev/null local then /usr/bin grep x=1 $(pwd) cd printf
+	&& printf readonly readonly grep test local done readonly ${HOME}
+&& cd /usr/bin /usr/bin 2>/dev/null local awk grep "$1" readonly
+echo done /usr/bin local "$1" ${HOME} test && x=1
+		"$@" --verbose test echo "$@" local echo then echo -eu local &&
+	cd 2>/dev/null ${HOME} $(pwd)
+		export 'quoted text' /usr/bin x=1 ${HOME} cd | sed "$1" ${HOME} | cd ${HOME} readonly
+	awk awk awk readonly && grep done export
+		--verbose 'quoted text' x=1 readonly
+		sed printf sed echo -eu awk "$@" | printf cd readonly
+		--verbose /usr/bin readonly grep done awk awk
+		'quoted text' readonly 'quoted text' /usr/bin ${HOME}
+	sed -eu awk then test then export local "$@" printf
+		'quoted text' -eu --verbose && ${HOME} 'quoted text' $(pwd) 2>/dev/null
+-eu "$@" sed awk then grep && grep $(pwd) done x=1 -eu -eu "$@" test
+x=1 'quoted text' export -eu /usr/bin -eu echo && | test
+		done local 'quoted text' x=1
+		"$@" done /usr/bin --verbose awk sed /usr/bin printf 2>/dev/null
+	&& "$1" test && cd "$@" "$1" --verbose awk export | echo 2>/dev/null
+		sed ${HOME} | 2>/dev/null echo "$1"
+readonly done printf -eu readonly grep ${HOME} 'quoted text' 'quoted text' awk
+grep ${HOME} local echo readonly awk 2>/dev/null ${HOME} /usr/bin grep then x=1
+	cd -eu then then 'quoted text' -eu test readonly
+cd --verbose sed test printf x=1 grep grep readonly -eu "$@" x=1 | "$1" done |
+then $(pwd) -eu /usr/bin echo then grep $(pwd) printf done x=1
+	"$1" /usr/bin printf 2>/dev/null 'quoted text'
+--verbose awk echo grep -eu export local
+		done | printf local "$1" done printf $(pwd) ${HOME} cd --verbose "$1"
+		readonly /usr/bin | x=1 "$@" 'quoted text'
+		| -eu /usr/bin && grep then 'quoted text'
+| printf then && "$1" cd echo readonly && /usr/bin
+	echo readonly grep printf then 'quoted text'
+$(pwd) 'quoted text' grep ${HOME} printf
+	test echo /usr/bin 2>/dev/null && cd "$1" readonly
+	echo grep echo awk readonly /usr/bin
+		cd "$@" | export sed && echo $(pwd)
+	local test readonly x=1 x=1 && ${HOME} export /usr/bin "$@"
+		readonly cd cd $(pwd) "$@"
+test --verbose ${HOME} ${HOME} 2>/dev/null done
+		test -eu readonly sed export 2>/dev/null && --verbose
+	-eu /usr/bin "$1" "$@" export grep 2>/dev/null
+		echo --verbose readonly sed "$1" 2>/dev/null | "$1" local echo
+		"$@" | $(pwd) && "$@" 'quoted text' /usr/bin done echo && then
+		"$1" grep ${HOME} awk && sed /usr/bin --verbose
+	cd local && grep --verbose 'quoted text' && done done $(pwd)
+		printf && grep "$@" test 'quoted text'
+&& x=1 sed /usr/bin | readonly -eu local echo -eu "$@" 2>/dev/null
+	"$1" done done /usr/bin
+		x=1 "$@" -eu 'quoted text' "$1" sed &&
+		awk test echo "$@" 'quoted text' $(pwd) /usr/bin --verbose
+$(pwd) then "$@" "$@" x=1 local ${HOME} printf
+sed done grep -eu test | /usr/bin awk local $(pwd)
+	done 'quoted text' awk then echo $(pwd) then && echo sed | ${HOME} -eu export
+x=1 ${HOME} cd local printf
+	${HOME} && ${HOME} awk 2>/dev/null && "$1" /usr/bin then printf grep
+2>/dev/null awk grep echo readonly awk export test /usr/bin export $(pwd)
+--verbose printf && echo $(pwd) cd done x=1 printf 2>/dev/null
+		x=1 cd 2>/dev/null echo sed echo -eu cd | sed export |
+awk readonly /usr/bin then "$1" echo "$1" | awk
+	"$@" then ${HOME} x=1 "$1"
+	local "$1" printf echo test test ${HOME}
+	-eu "$1" $(pwd) x=1 sed cd
+		/usr/bin cd local /usr/bin then sed local --verbose readonly --verbose
+		| x=1 then 2>/dev/null local test --verbose printf
+	/usr/bin x=1 ${HOME} "$1" "$@"
+printf export $(pwd) --verbose readonly
+		grep "$@" 2>/dev/null ${HOME} 2>/dev/null "$@" x=1 "$1" cd export /usr/bin
+	"$1" /usr/bin $(pwd) test && ${HOME} printf grep x=1 /usr/bin
+	cd 'quoted text' "$1" /usr/bin sed "$@" test grep "$1" cd
+	readonly test "$1" /usr/bin && "$@" && | echo 'quoted text' && local grep
+		-eu $(pwd) | | cd 2>/dev/null $(pwd) readonly --verbose grep echo $(pwd) --verbose
+${HOME} ${HOME} printf readonly | 'quoted text' then test "$@" done
+	echo then x=1 | readonly 2>/dev/null -eu grep ${HOME} 2>/dev/null
+		x=1 cd && "$1" --verbose local /usr/bin
+		export sed printf printf && then local $(pwd) echo ${HOME} -eu
+	--verbose readonly export local "$1" grep -eu cd 2>/dev/null export |
+readonly | sed | sed --verbose readonly then sed /usr/bin
+$(pwd) sed printf cd "$1" echo $(pwd) && x=1 awk then done $(pwd) /usr/bin grep
+		/usr/bin x=1 "$1" 'quoted text' grep | cd local x=1 cd readonly --verbose
+	done /usr/bin | done test test then local
+grep ${HOME} 2>/dev/null --verbose &&
+-eu done 'quoted text' grep done
+${HOME} x=1 && grep 'quoted text'
+	then "$@" sed ${HOME} /usr/bin "$@" && then
+		sed | grep /usr/bin "$1" 2>/dev/null 2>/dev/null
+		printf export -eu "$1" local grep
+	&& echo /usr/bin "$@" --verbose cd test cd echo "$1" local echo sed then -eu
+"$@" && sed export "$1" export grep cd sed printf && -eu ${HOME} test /usr/bin
+	&& "$1" -eu 'quoted text' --verbose awk -eu grep export
+		--verbose test --verbose 2>/dev/null local readonly /usr/bin grep && test $(pwd)
+2>/dev/null then local 2>/dev/null
+test local "$1" printf x=1
+	readonly "$@" awk cd printf 'quoted text' awk sed ${HOME} -eu then cd ${HOME} -eu
+	$(pwd) local test export && readonly
+2>/dev/null awk printf ${HOME} -eu export 2>/dev/null
+	x=1 echo sed echo 2>/dev/null then 'quoted text' /usr/bin
+		-eu cd 'quoted text' export printf printf "$@" grep 'quoted text'
+		local 'quoted text' echo "$1" echo awk ${HOME} ${HOME}
+		'quoted text' local readonly ${HOME} | printf ${HOME} ${HOME}
+cd -eu test then then grep echo
+grep x=1 cd "$1" export /usr/bin
+echo /usr/bin | ${HOME} 'quoted text' /usr/bin sed export -eu -eu
+	'quoted text' done echo /usr/bin && echo --verbose test 'quoted text'
+		| local grep /usr/bin echo grep
+"$@" "$@" export grep 2>/dev/null test then $(pwd) "$1" local |
+--verbose && /usr/bin --verbose --verbose --verbose
+--verbose && done /usr/bin x=1
+sed -eu echo then /usr/bin 'quoted text' local grep sed
+		printf export $(pwd) x=1 grep | 2>/dev/null
+export local && "$1" export "$1" /usr/bin test "$@" --verbose
+		done printf x=1 echo readonly | grep $(pwd) ${HOME} 2>/dev/null
+--verbose printf "$@" /usr/bin && then ${HOME} "$@" local | 'quoted text'
+	x=1 'quoted text' ${HOME} && x=1 local done -eu awk
+		done "$@" grep test 2>/dev/null $(pwd) readonly "$@" then "$@" 2>/dev/null readonly
+then grep done awk ${HOME} "$1" local readonly done "$@" test ${HOME}
+	${HOME} --verbose "$1" -eu awk cd x=1 printf done 2>/dev/null "$1" -eu | /usr/bin
+	-eu $(pwd) export -eu grep
+	${HOME} "$@" $(pwd) --verbose grep grep ${HOME} | local export && 'quoted text'
+	done /usr/bin "$1" export done echo ${HOME} cd local && && 2>/dev/null sed
+		x=1 echo /usr/bin echo
+	test local then local 2>/dev/null test x=1 echo printf then awk sed 2>/dev/null
+x=1 "$@" readonly sed --verbose readonly export printf && then | x=1 $(pwd)
+printf 'quoted text' printf "$@" && export grep readonly echo
+		'quoted text' printf printf
+/usr/bin test local 'quoted text' awk cd x=1 awk local
+	${HOME} then --verbose --verbose
+		"$1" --verbose awk sed /usr/bin cd /usr/bin echo echo export
+	sed "$1" -eu -eu "$1" test $(pwd) $(pwd) local 2>/dev/null "$1" && 2>/dev/null
+/usr/bin 2>/dev/null then x=1 done done printf printf
+		"$1" 2>/dev/null $(pwd) sed && sed then cd readonly -eu grep printf cd
+/usr/bin cd echo printf grep --verbose local
+"$1" x=1 echo done "$@" 2>/dev/null readonly
+readonly && 2>/dev/null
+		"$1" 'quoted text' cd 'quoted text' $(pwd) cd awk | "$1"
+	awk export sed ${HOME} then 2>/dev/null -eu printf awk && "$@" -eu local 'quoted text'
+		local 'quoted text' export echo "$1" && awk cd x=1 then printf
+grep export "$1" && --verbose x=1 'quoted text' readonly
+export local cd && cd /usr/bin "$1" /usr/bin readonly --verbose x=1 cd
+	| --verbose $(pwd) "$@" --verbose 'quoted text'
+test "$@" local "$@" x=1 export
+	-eu awk "$@" test local done sed done echo x=1 then sed && --verbose
+	printf 'quoted text' | 2>/dev/null
+		printf test echo cd then $(pwd) "$1"
+		done awk printf awk echo printf export grep readonly printf "$@" /usr/bin
+	local export export $(pwd) local "$1" "$1"
+		--verbose cd grep -eu readonly then local 2>/dev/null -eu
+	-eu | sed 'quoted text' grep printf
+	test $(pwd) | cd cd | local && --verbose local
+		test done --verbose echo export test then printf test printf ${HOME}
+	${HOME} grep -eu grep $(pwd) && && x=1 "$@" export
+		cd sed sed cd 'quoted text' x=1 printf local 'quoted text' x=1 "$@" "$@"
+		echo -eu | x=1 | ${HOME} local && x=1 | -eu x=1 then "$1" done cd 'quoted text'
+	| | x=1 /usr/bin test "$@" ${HOME} "$@" done echo test 2>/dev/null
+		readonly "$1" | x=1 -eu x=1 printf test printf echo readonly
+	--verbose awk sed readonly "$@" export
+	"$1" export -eu done $(pwd) test | $(pwd) ${HOME}
+sed -eu then $(pwd) grep
+readonly | echo -eu | $(pwd) ${HOME}
+sed awk $(pwd) export ${HOME} sed echo
+		2>/dev/null | $(pwd) test && x=1
+	then /usr/bin "$@" readonly
+		test done "$1" awk sed export sed x=1 /usr/bin
+	awk 2>/dev/null export "$1" "$@" echo |
+"$1" echo --verbose "$1" "$1" readonly echo | 'quoted text'
+cd /usr/bin x=1 -eu ${HOME} export
+		2>/dev/null readonly -eu printf $(pwd) test -eu printf
+	${HOME} cd test sed ${HOME} awk done
+	cd 'quoted text' x=1 export local cd
+	--verbose done ${HOME} then "$@" && x=1
+	x=1 done "$@" --verbose 'quoted text'
+	sed 'quoted text' cd awk sed printf cd
+		grep && printf && 'quoted text' sed
+local && $(pwd) 'quoted text' | readonly readonly && readonly
+"$@" ${HOME} 2>/dev/null sed sed x=1 cd
+"$@" export && cd export ${HOME} 'quoted text' then
+	/usr/bin "$1" sed sed ${HOME} sed echo | export
+		sed readonly sed export export "$@" $(pwd) ${HOME} local then x=1
+"$1" 2>/dev/null done /usr/bin grep ${HOME} echo cd sed export grep local local
+cd ${HOME} "$1" then sed cd grep export 2>/dev/null --verbose
+"$1" --verbose "$@" ${HOME}
+		then | cd "$1" $(pwd) cd 'quoted text' sed | "$1" done "$@" grep | 'quoted text'
+awk then awk "$@" sed "$@" local "$1" 'quoted text' printf cd readonly
+	--verbose ${HOME} 2>/dev/null x=1 x=1 x=1 export cd && ${HOME}
+test $(pwd) done grep echo ${HOME} && && awk && then "$@" printf
+		test readonly done readonly --verbose
+done ${HOME} --verbose then 'quoted text'
+2>/dev/null x=1 grep test awk test x=1 'quoted text' then sed &&
+	-eu sed x=1 'quoted text' test done test 'quoted text' sed readonly grep
+	local $(pwd) "$1" then awk
+		/usr/bin -eu /usr/bin readonly "$@" grep ${HOME} 'quoted text'
+	"$1" done && grep 2>/dev/null /usr/bin
+		readonly x=1 2>/dev/null test "$1" && && x=1 test -eu "$@"
+'quoted text' then test local -eu 'quoted text'
+		2>/dev/null x=1 cd | | printf | then "$1" $(pwd) /usr/bin ${HOME} local 2>/dev/null
+	done grep awk --verbose done echo done 'quoted text'
+done | local cd $(pwd) -eu /usr/bin cd "$1" test
+&& x=1 "$1" echo readonly 2>/dev/null grep
+		${HOME} awk cd x=1 local test test
+		local 'quoted text' | /usr/bin grep
+		readonly grep "$1" ${HOME} 2>/dev/null
+		echo --verbose /usr/bin x=1 then "$@" ${HOME} && 'quoted text'
+$(pwd) x=1 /usr/bin -eu cd "$@" sed cd ${HOME} grep $(pwd) -eu
+		export printf then --verbose -eu printf
+		readonly 'quoted text' && "$1" "$@" grep sed $(pwd) awk test -eu 'quoted text'
+local done echo printf grep $(pwd) x=1 'quoted text' test cd x=1 readonly
+		"$1" 'quoted text' export grep 2>/dev/null x=1 printf ${HOME}
+		/usr/bin grep 2>/dev/null ${HOME} "$@"
+		2>/dev/null ${HOME} 2>/dev/null
+	| ${HOME} $(pwd) done x=1 ${HOME} -eu sed | $(pwd)
+	echo $(pwd) ${HOME} "$1" 'quoted text' test test
+	| awk ${HOME} done ${HOME} done then 2>/dev/null test -eu
+	readonly && /usr/bin x=1 --verbose 2>/dev/null /usr/bin test local && then awk
+	export "$@" && readonly | | x=1 x=1 readonly echo export
+	export 2>/dev/null | /usr/bin
+	/usr/bin 'quoted text' ${HOME}
+		--verbose local test 2>/dev/null $(pwd) x=1 grep "$1" 'quoted text' ${HOME} grep
+		printf awk export sed x=1 x=1 echo /usr/bin && echo echo
+	sed cd then "$@" $(pwd) cd awk local grep
+	sed x=1 grep "$@" printf done sed 2>/dev/null
+'quoted text' readonly "$@" 'quoted text'
+		&& x=1 x=1 'quoted text' then -eu printf $(pwd) | awk export local 'quoted text'
+		x=1 cd | $(pwd) grep x=1 | export echo awk done
+| awk then /usr/bin grep printf ${HOME} echo ${HOME}
+readonly $(pwd) && -eu
+		"$1" ${HOME} x=1 test echo awk then readonly
+	${HOME} awk ${HOME} grep test -eu test printf -eu -eu "$1" printf && --verbose
+	"$@" echo then $(pwd) x=1 grep --verbose && --verbose
+	local printf $(pwd) local cd | 'quoted text' ${HOME}
+readonly test awk -eu export --verbose local -eu then readonly local readonly
+done 2>/dev/null test "$@"
+	-eu /usr/bin 2>/dev/null echo
+		x=1 $(pwd) done && sed -eu test x=1 | $(pwd) -eu 2>/dev/null
+"$@" readonly echo then readonly
+${HOME} local --verbose test --verbose
+		test cd "$1" ${HOME} "$@" 'quoted text'
+done 'quoted text' then ${HOME} cd x=1 ${HOME} awk cd local cd && readonly
+	done echo echo -eu done grep done "$1" cd readonly grep --verbose cd --verbose
+	sed done sed --verbose echo --verbose 'quoted text' done readonly $(pwd)
+sed "$1" $(pwd) x=1 'quoted text' "$1" echo local export
+		printf awk "$1" sed 2>/dev/null
+		--verbose local 'quoted text'
+		readonly test cd ${HOME} "$@" grep
+		'quoted text' 2>/dev/null sed printf
+grep awk "$1" grep echo -eu ${HOME} 2>/dev/null sed
+	"$1" printf 2>/dev/null 2>/dev/null done grep -eu grep local echo --verbose
+printf awk x=1 printf then "$1" printf -eu "$@"
+${HOME} done done 'quoted text' --verbose
+	test --verbose | awk && grep local "$@" printf 2>/dev/null "$1"
+		$(pwd) echo cd then then "$1" | "$1" $(pwd) cd x=1 cd "$@" echo grep 'quoted text'
+${HOME} then done done ${HOME} readonly -eu grep done ${HOME} echo grep "$1"
+/usr/bin export echo --verbose echo 2>/dev/null "$@" 2>/dev/null cd "$@"
+&& done export --verbose cd ${HOME} -eu echo $(pwd) 'quoted text'
+	${HOME} -eu --verbose -eu
+x=1 2>/dev/null echo done /usr/bin local
+printf /usr/bin --verbose x=1 $(pwd)
+	'quoted text' "$@" && readonly
+	local cd awk done -eu "$1" local
+	printf test test --verbose "$1" -eu && | 2>/dev/null && export
+		local | 2>/dev/null /usr/bin --verbose grep awk echo 2>/dev/null
+	export export x=1 local test local export awk 2>/dev/null
+		cd test 2>/dev/null ${HOME} /usr/bin "$1" 2>/dev/null export grep --verbose readonly
+		grep test readonly 2>/dev/null test echo test
+		'quoted text' grep /usr/bin
+&& export grep awk && grep --verbose done printf grep
+done 2>/dev/null ${HOME} "$1" test test then echo echo && --verbose
+	-eu 2>/dev/null && ${HOME} 2>/dev/null readonly cd then export done grep &&
+		"$1" x=1 'quoted text' sed grep $(pwd)
+cd && awk "$@" && 2>/dev/null && printf
+	echo done echo -eu readonly x=1
+	awk 2>/dev/null x=1 | printf test
+--verbose 'quoted text' --verbose readonly sed && then x=1 export 'quoted text'
+	awk printf then then && export
+		"$@" ${HOME} /usr/bin sed readonly done echo awk ${HOME} $(pwd)
+then cd x=1 | done readonly x=1 awk /usr/bin
+	"$1" printf /usr/bin test echo echo printf printf "$@" -eu && "$1" readonly
+		'quoted text' echo local grep printf --verbose grep 2>/dev/null test test printf
+	--verbose -eu then && sed ${HOME} awk "$1" 'quoted text' x=1
+cd test 2>/dev/null | | --verbose && "$1" $(pwd)
+test grep 'quoted text' printf && echo readonly -eu $(pwd)
+		readonly test 'quoted text' printf
+	cd | done export test done printf readonly awk printf x=1 awk local echo 'quoted text'
+grep -eu readonly -eu | export done
+&& x=1 'quoted text' awk then printf
+echo | awk 'quoted text' echo
+		$(pwd) sed 'quoted text'
+	done done "$1" export local readonly
+		printf ${HOME} grep && x=1 then /usr/bin printf ${HOME}
+	| ${HOME} printf && 2>/dev/null
+printf 2>/dev/null sed cd then | done -eu
+		printf test -eu cd ${HOME}
+	/usr/bin echo printf --verbose then cd 2>/dev/null 2>/dev/null && 2>/dev/null awk
+		local grep 2>/dev/null test readonly && "$@" cd cd $(pwd) local then then export
+${HOME} | local grep then x=1 x=1
+	local cd $(pwd) grep "$1" /usr/bin $(pwd) -eu | grep --verbose
+	done "$1" "$1" x=1 x=1 -eu "$1" export ${HOME}
+		done "$@" then "$@" then 'quoted text'
+		readonly then "$@" grep "$1" 'quoted text' "$@" echo cd
+	readonly "$@" done 'quoted text' grep "$1" test $(pwd) "$1" echo /usr/bin
+		&& --verbose "$1" -eu echo $(pwd) sed && done sed --verbose "$1" "$@"
+--verbose readonly 2>/dev/null
+"$1" | printf "$@" awk done readonly 'quoted text' /usr/bin sed
+	&& -eu $(pwd) -eu grep 2>/dev/null 2>/dev/null local
+		&& grep "$1" && test cd ${HOME} -eu -eu "$1"
+		cd 'quoted text' /usr/bin export | local --verbose $(pwd) | awk echo 2>/dev/null
+sed "$@" x=1 grep 'quoted text' readonly
+	local sed 'quoted text' local
+/usr/bin ${HOME} --verbose
+	'quoted text' -eu sed sed /usr/bin grep 2>/dev/null
+		export --verbose --verbose readonly
+	then export -eu ${HOME} -eu $(pwd) 'quoted text' ${HOME} -eu local then sed done
+	echo local "$1" test && awk && printf done
+		x=1 local then $(pwd) 'quoted text'
+	$(pwd) done && local --verbose x=1 /usr/bin then readonly cd awk readonly &&
+awk -eu 2>/dev/null $(pwd) 2>/dev/null sed grep
+${HOME} /usr/bin test then /usr/bin $(pwd) &&
+sed printf /usr/bin echo export
+done awk && local 2>/dev/null echo
+then cd local 'quoted text' x=1 "$@" &&
+		'quoted text' x=1 awk done 2>/dev/null
+local ${HOME} grep readonly 'quoted text'
+	test then grep readonly export "$1" readonly printf
+| ${HOME} | printf "$1" /usr/bin
+		test "$1" 2>/dev/null /usr/bin then 'quoted text' --verbose "$@"
+		/usr/bin awk x=1 $(pwd) sed test 2>/dev/null
+"$@" "$1" | readonly echo test --verbose readonly cd 'quoted text' && |
+		"$@" | && $(pwd) awk grep local done /usr/bin local ${HOME} test
+	awk -eu /usr/bin cd -eu cd ${HOME} echo echo export echo x=1
+	| printf test -eu 2>/dev/null readonly && "$1" done --verbose && /usr/bin awk
+	"$1" local done printf test printf sed printf
+"$@" local cd | grep ${HOME} x=1 test -eu $(pwd) done printf
+	${HOME} 'quoted text' cd "$1" | cd then $(pwd) && $(pwd) done
+cd ${HOME} 2>/dev/null cd 2>/dev/null -eu printf
+		$(pwd) "$1" export grep /usr/bin | ${HOME} test sed ${HOME} echo local -eu
+	done test done then export sed sed x=1 --verbose local /usr/bin then local
+awk test sed 2>/dev/null && export ${HOME}
+		awk readonly $(pwd) awk ${HOME} ${HOME} /usr/bin
+&& grep done /usr/bin $(pwd)
+	grep grep $(pwd) grep /usr/bin then $(pwd) "$1" --verbose
+'quoted text' -eu local "$@" && ${HOME} $(pwd) ${HOME}
+		local x=1 readonly ${HOME} ${HOME} --verbose grep "$@" done /usr/bin "$1" 2>/dev/null
+local cd then | "$1" --verbose "$1" x=1 --verbose "$1"
+echo "$1" $(pwd) /usr/bin grep
+		"$1" echo echo -eu readonly "$1" ${HOME} "$1" export
+then printf -eu ${HOME} ${HOME} grep echo -eu sed test | readonly readonly
+/usr/bin test test cd $(pwd) --verbose ${HOME} readonly awk $(pwd) 2>/dev/null &&
+		/usr/bin local cd && export
+	readonly ${HOME} && local "$1" ${HOME}
+	"$1" done then printf 2>/dev/null readonly local "$@" echo readonly
+done awk $(pwd) local "$1" x=1 cd | awk readonly x=1 readonly printf
+		readonly ${HOME} awk 'quoted text' /usr/bin printf && | "$1" export
+local grep readonly test export
+	local "$1" x=1 echo /usr/bin
+local -eu readonly 2>/dev/null | sed /usr/bin
+printf -eu $(pwd) 'quoted text' grep readonly
+	$(pwd) export | local && echo && done /usr/bin export ${HOME}
+		then | ${HOME} "$@" ${HOME} then x=1 cd 'quoted text' printf printf --verbose sed
+--verbose export | /usr/bin
+cd | cd sed sed echo grep
+2>/dev/null cd then && export x=1
+		readonly 2>/dev/null && | | readonly 'quoted text' printf 2>/dev/null
+x=1 /usr/bin printf sed -eu && /usr/bin x=1 readonly export
+		/usr/bin test $(pwd) 2>/dev/null
+	$(pwd) local --verbose -eu "$@"
+		/usr/bin done local done local
+		/usr/bin test "$@" | readonly test sed x=1 2>/dev/null
+	printf cd && $(pwd) printf &&
+-eu printf cd --verbose /usr/bin 2>/dev/null done
+		"$@" -eu then x=1 printf | awk --verbose x=1
+	done test $(pwd) "$@" $(pwd) && grep done echo "$@" done
+	${HOME} cd printf printf --verbose /usr/bin grep | 'quoted text'
+cd | cd sed && && then -eu done export "$@" | test test 'quoted text' "$1"
+	2>/dev/null ${HOME} test x=1 2>/dev/null
+		cd ${HOME} -eu printf 'quoted text'
+		2>/dev/null export cd printf sed "$1" 'quoted text' ${HOME}
+cd ${HOME} echo readonly $(pwd) echo 'quoted text' readonly then
+		local test cd "$1" /usr/bin local "$@" readonly x=1 -eu
+	then $(pwd) echo -eu | 2>/dev/null
+x=1 test && printf cd x=1 printf echo /usr/bin 2>/dev/null 'quoted text'
+		then x=1 awk sed ${HOME} export printf printf
+	test --verbose /usr/bin "$1" grep /usr/bin cd grep local "$1" sed
+		-eu awk local --verbose awk $(pwd) "$@" "$@" test
+		echo --verbose ${HOME} test 2>/dev/null
+		/usr/bin export awk 'quoted text' && --verbose
+grep x=1 echo readonly 2>/dev/null $(pwd) "$@" awk cd $(pwd) echo &&
+		sed | 2>/dev/null done sed ${HOME}
+| sed -eu awk export /usr/bin local test cd cd grep 2>/dev/null
+		awk /usr/bin cd readonly $(pwd) 2>/dev/null
+		awk awk ${HOME} local done ${HOME} sed cd then x=1 2>/dev/null
+	| done echo sed && echo cd cd readonly sed "$@" readonly readonly ${HOME} test
+		sed $(pwd) && export && test awk "$1"
+	readonly | done local /usr/bin printf
+		export 'quoted text' readonly echo printf sed "$@" "$1" sed /usr/bin grep
+echo local $(pwd) "$@" then | x=1 x=1 test /usr/bin && export ${HOME} printf done
+	readonly readonly 2>/dev/null
+&& export printf done -eu -eu echo awk
+	cd | ${HOME} /usr/bin sed ${HOME} ${HOME}
+"$@" 2>/dev/null "$@" ${HOME} 'quoted text' -eu $(pwd)
+	$(pwd) test "$1" local "$1" grep
+	2>/dev/null printf --verbose echo /usr/bin ${HOME} "$@" test grep
+export | then echo export printf /usr/bin printf /usr/bin done sed /usr/bin
+		| 2>/dev/null && export "$1" test cd then export
+		grep local | "$@" echo export "$1" x=1
+	$(pwd) "$1" readonly "$1" x=1 echo x=1 sed cd sed cd $(pwd)
+"$@" -eu "$1" printf sed cd x=1 grep awk $(pwd) $(pwd) $(pwd)
+${HOME} done readonly $(pwd) $(pwd) /usr/bin |
+sed grep local 2>/dev/null $(pwd) 2>/dev/null cd
+		$(pwd) cd readonly echo then
+${HOME} "$@" sed ${HOME} "$1" $(pwd) awk --verbose --verbose
+	| && --verbose "$1" -eu 'quoted text' printf local 2>/dev/null 'quoted text'
+	printf $(pwd) printf x=1 --verbose
+		&& echo cd local ${HOME} "$@" 2>/dev/null echo /usr/bin cd --verbose local done
+	$(pwd) && -eu 'quoted text' -eu local export awk local /usr/bin | 2>/dev/null
+		/usr/bin then --verbose printf awk echo awk 'quoted text' cd grep ${HOME} x=1
+		"$@" ${HOME} "$@" done then "$1" grep
+		-eu 'quoted text' && 2>/dev/null
+	done local ${HOME} cd
+	"$@" --verbose $(pwd) awk sed "$1" x=1 2>/dev/null readonly $(pwd) /usr/bin readonly
+		${HOME} -eu echo --verbose test 2>/dev/null && "$1" then x=1
+	test grep 'quoted text' -eu sed then && local then /usr/bin
+		2>/dev/null /usr/bin "$@" local
+		test "$@" ${HOME} grep
+	printf x=1 test readonly awk awk -eu x=1 grep done echo test then test test x=1
+	--verbose ${HOME} local -eu done sed sed test 'quoted text' sed then $(pwd)
+	sed grep done 'quoted text' /usr/bin "$@" then && sed ${HOME} $(pwd)
+&& x=1 grep readonly -eu local -eu "$1" readonly
+| "$@" "$@" 2>/dev/null cd cd awk grep test "$@" done done
+		then "$1" -eu grep $(pwd) 'quoted text'
+awk | 2>/dev/null 'quoted text' readonly done "$@" export test 2>/dev/null
+then grep | export --verbose echo x=1 $(pwd) /usr/bin
+		awk -eu 2>/dev/null x=1 readonly grep -eu
+	&& test ${HOME} then done then --verbose | grep readonly local
+echo done sed awk grep && $(pwd) && | --verbose sed &&
+	awk cd grep && $(pwd) printf -eu "$@"
+printf export "$1" "$1" test | $(pwd) 2>/dev/null awk "$@" cd --verbose
+	${HOME} then /usr/bin
+sed --verbose && --verbose --verbose test x=1 2>/dev/null && cd cd readonly
+	"$@" | ${HOME} && echo
+--verbose cd ${HOME} | grep awk "$@" printf -eu "$@" /usr/bin
+	'quoted text' && -eu "$@" readonly export "$1" | printf x=1 && /usr/bin
+	"$1" x=1 x=1 "$@" && awk
+	$(pwd) && x=1 cd $(pwd) -eu
+-eu printf --verbose then grep ${HOME} cd local "$@" "$1" grep
+--verbose ${HOME} local --verbose "$1" --verbose -eu /usr/bin && "$1"
+test echo 'quoted text' $(pwd) awk echo /usr/bin
+	'quoted text' grep -eu test ${HOME} done export && done | then
+	local export x=1 echo ${HOME} -eu && ${HOME} done local -eu done
+		test && cd grep ${HOME} sed | export echo grep echo printf grep echo && test
+		done ${HOME} export awk awk
+		export export echo export local 2>/dev/null
+	awk --verbose "$1" "$@" -eu test test $(pwd) "$@" test 'quoted text'
+	test 2>/dev/null 2>/dev/null echo echo grep /usr/bin "$1" then awk
+2>/dev/null export then printf awk cd -eu done | export x=1
+	sed 2>/dev/null printf $(pwd) ${HOME}
+'quoted text' 2>/dev/null readonly
+		printf $(pwd) && ${HOME} -eu
+		| cd && --verbose done /usr/bin "$@" && /usr/bin "$@" echo
+	2>/dev/null -eu | -eu 'quoted text' sed local readonly
+	x=1 2>/dev/null done 2>/dev/null test echo --verbose cd --verbose export awk
+	"$1" "$@" echo 'quoted text' | sed
+	&& | cd "$@" readonly local done then
+sed --verbose done 'quoted text' 'quoted text'
+2>/dev/null && "$@" sed && 2>/dev/null done done awk
+		--verbose "$1" "$@" --verbose ${HOME} printf
+		then then export cd awk 2>/dev/null "$1" &&
+		sed --verbose --verbose ${HOME}
+then ${HOME} ${HOME} then x=1 grep ${HOME} -eu export x=1 echo
+--verbose 'quoted text' done cd readonly
+	${HOME} /usr/bin export
+	then --verbose echo /usr/bin cd && printf export --verbose local $(pwd) --verbose
+	2>/dev/null done printf 2>/dev/null -eu "$@" printf
+	local echo readonly | cd cd cd then echo readonly test $(pwd)
+| 2>/dev/null echo echo export | sed "$1" && local local "$1" grep then
+		test local | $(pwd) $(pwd) echo local 2>/dev/null | "$@" cd done | --verbose done
+export test sed --verbose awk awk echo local 2>/dev/null $(pwd) done
+	readonly x=1 grep export /usr/bin /usr/bin
+	-eu "$1" grep ${HOME} cd x=1 "$1" "$1"
+done ${HOME} | /usr/bin x=1 export grep $(pwd)
+${HOME} | test | test | then | && "$@" | printf -eu test done printf
+		/usr/bin readonly $(pwd)
+	/usr/bin done 'quoted text' "$@" local
+		/usr/bin done then "$1" && && ${HOME} /usr/bin local
+		grep $(pwd) 'quoted text' 2>/dev/null -eu 2>/dev/null test
+done readonly $(pwd) export
+		awk "$@" --verbose $(pwd)
+awk "$1" /usr/bin | $(pwd) -eu /usr/bin x=1 --verbose then 'quoted text'
+--verbose then awk test export ${HOME} done |
+/usr/bin ${HOME} awk "$@" $(pwd) $(pwd) --verbose
+'quoted text' && printf ${HOME} done echo 2>/dev/null | awk "$1" ${HOME}
+	sed grep 2>/dev/null /usr/bin printf x=1 x=1 && "$@" readonly ${HOME} readonly
+x=1 printf test /usr/bin "$1" /usr/bin ${HOME}
+		"$@" then && -eu export "$1" grep export done test export "$1" then test
+	$(pwd) printf grep 2>/dev/null grep then "$@" | sed /usr/bin then test x=1
+${HOME} done && grep --verbose
+		cd && local -eu x=1 'quoted text' export x=1 $(pwd)
+x=1 readonly "$1" | echo && local
+	| -eu x=1 export readonly echo | then readonly done 2>/dev/null x=1 printf
+		readonly 2>/dev/null | printf sed | export x=1 cd x=1 && sed /usr/bin ${HOME}
+sed --verbose grep x=1 -eu export | echo grep export echo test done
+"$@" readonly echo grep | export local readonly /usr/bin ${HOME} readonly --verbose
+		readonly export ${HOME} 2>/dev/null printf 'quoted text' export
+	| 'quoted text' x=1 grep ${HOME} done "$1" cd awk 'quoted text'
+		"$1" awk $(pwd) done done x=1 -eu /usr/bin done then
+/usr/bin done readonly readonly --verbose
+	--verbose echo 'quoted text' awk
+2>/dev/null test 2>/dev/null test done
+awk 'quoted text' && 'quoted text' readonly --verbose
+	printf "$1" 'quoted text' local x=1 grep --verbose
+	echo "$@" && ${HOME} ${HOME} && x=1 then ${HOME} "$@" then
+done awk 'quoted text' -eu ${HOME} local | && | ${HOME} then echo -eu 'quoted text'
+	done cd 'quoted text' $(pwd)
+&& $(pwd) awk x=1 $(pwd) 'quoted text' then sed then $(pwd) 2>/dev/null --verbose
+		"$@" echo "$@" $(pwd) /usr/bin -eu echo | | "$1" then $(pwd)
+		readonly --verbose readonly cd readonly
+	awk ${HOME} local then echo | ${HOME}
+export then test ${HOME} printf local printf cd readonly 2>/dev/null
+'quoted text' && "$@" "$1" 'quoted text' export export echo "$1"
+		cd -eu echo /usr/bin 'quoted text' "$1" awk --verbose awk grep readonly "$1"
+	"$@" readonly local --verbose done
+		'quoted text' "$@" grep
+		-eu awk export --verbose /usr/bin 'quoted text' export test
+		&& then "$@" then local x=1 readonly
+	grep done 2>/dev/null | x=1 && awk 'quoted text' then 'quoted text' --verbose
+	$(pwd) $(pwd) grep -eu grep && x=1 readonly "$1" "$1" && $(pwd) done 'quoted text'
+	done then cd test "$@"
+		sed -eu readonly export 2>/dev/null "$@" 'quoted text' test sed /usr/bin &&
+	/usr/bin -eu printf grep readonly test $(pwd) && grep readonly export
+"$1" printf 'quoted text' cd grep test x=1 local
+	echo | then | sed echo sed /usr/bin grep
+	sed printf --verbose 'quoted text'
+	done x=1 test && local ${HOME} grep 2>/dev/null
+	'quoted text' /usr/bin cd export readonly "$@"
+		${HOME} 2>/dev/null printf "$1" x=1 --verbose
+test x=1 'quoted text' "$@" grep cd "$@"
+	"$@" local $(pwd) /usr/bin readonly printf grep cd -eu sed local
+		test 2>/dev/null -eu test $(pwd) export /usr/bin
+	'quoted text' /usr/bin
+	--verbose 2>/dev/null "$@"
+		${HOME} -eu x=1 'quoted text' && readonly 'quoted text'
+		sed "$@" local export sed cd &&
+	printf 2>/dev/null 'quoted text'
+		cd grep cd x=1 "$1" 2>/dev/null sed
+x=1 printf readonly ${HOME} sed x=1 test
+grep sed printf sed sed $(pwd) printf 'quoted text'
+		"$1" "$1" export --verbose cd ${HOME} ${HOME} then $(pwd) sed | readonly
+awk --verbose done "$1" -eu "$1" export $(pwd)
+	awk export "$@" sed test "$@" awk echo
+		2>/dev/null sed 2>/dev/null readonly local printf
+	"$1" echo 'quoted text' printf export 'quoted text' /usr/bin printf --verbose
+		echo ${HOME} 2>/dev/null printf echo sed "$1"
+local ${HOME} /usr/bin test export "$@"
+grep | cd local sed --verbose
+		-eu echo && | printf ${HOME}
+-eu done "$@" -eu $(pwd) readonly cd | --verbose ${HOME} test | printf
+&& then x=1 x=1 export awk readonly printf readonly echo
+		printf awk $(pwd) 'quoted text' | 2>/dev/null sed awk
+	test | -eu sed done then
+-eu /usr/bin grep "$1" 'quoted text' echo done "$1" awk /usr/bin done
+		then x=1 'quoted text' readonly $(pwd) done export ${HOME} $(pwd) done
+$(pwd) $(pwd) /usr/bin sed /usr/bin
+| | grep grep | "$@" readonly awk then "$1" 2>/dev/null /usr/bin x=1 then echo
+		--verbose -eu sed $(pwd) ${HOME} local
+	echo export "$1" "$@" && -eu grep awk test
+		export x=1 done test ${HOME} 'quoted text'
+readonly | printf test /usr/bin "$@" | /usr/bin | cd test "$1"
+	echo | grep grep local local export
+test "$@" export sed grep readonly cd local /usr/bin 2>/dev/null
+		test grep 'quoted text' 'quoted text' "$@" | cd done --verbose /usr/bin then
+"$1" readonly done $(pwd) -eu printf
+done "$1" readonly export export local awk "$1" local -eu
+		awk ${HOME} 'quoted text'
+		| export && export sed | done "$@" ${HOME} x=1 test sed sed then 2>/dev/null
+	&& test "$1" readonly
+	local readonly --verbose 'quoted text' export cd
+		/usr/bin echo export -eu export sed x=1 && cd 2>/dev/null | done ${HOME} sed &&
+$(pwd) 'quoted text' sed readonly |
+local cd 2>/dev/null 2>/dev/null | test echo awk printf x=1 readonly
+	export sed "$1" then | $(pwd) $(pwd) echo awk readonly --verbose done then awk
+awk then local $(pwd)
+	then then sed /usr/bin /usr/bin
+		local awk sed ${HOME} "$1" 'quoted text'
+echo sed readonly --verbose 2>/dev/null "$@" cd awk
+| readonly sed local local echo done && test export then then
+	${HOME} then /usr/bin grep -eu grep
+	grep -eu /usr/bin cd grep -eu export readonly /usr/bin
+		awk then "$@" grep export awk printf 2>/dev/null --verbose readonly /usr/bin "$@"
+	/usr/bin cd 2>/dev/null done export awk 2>/dev/null echo done
+	${HOME} readonly x=1 done readonly export "$1" "$@" /usr/bin
+		test grep sed --verbose "$@" "$1" printf done && $(pwd) grep "$1" test then
+		awk "$1" /usr/bin --verbose test then printf "$1" 2>/dev/null /usr/bin
+	awk awk then export /usr/bin grep printf
+awk -eu -eu --verbose export test done cd 2>/dev/null grep --verbose && echo
+	2>/dev/null printf echo ${HOME} && done grep --verbose
+readonly then 'quoted text' -eu
+2>/dev/null && echo export
+"$@" printf $(pwd) 'quoted text'
+awk test | -eu echo "$1" grep | test done sed local ${HOME} x=1 "$@" $(pwd)
+printf export sed awk --verbose printf && | readonly
+	grep && then grep export cd cd readonly sed x=1 "$@" export
+	-eu printf && ${HOME} done sed /usr/bin 'quoted text' then readonly x=1 "$@"
+		/usr/bin --verbose ${HOME} sed
+	'quoted text' local $(pwd) $(pwd)
+		cd 2>/dev/null done "$1"
+x=1 printf -eu --verbose test readonly
+		local then grep "$1" && -eu then local "$@" export cd "$1" | then ${HOME}
+		export cd -eu awk 'quoted text'
+local | sed grep test $(pwd) echo
+		"$1" /usr/bin "$@" -eu export "$@" readonly done sed then echo readonly
+	echo then 2>/dev/null 'quoted text' 2>/dev/null | 'quoted text'
+"$1" x=1 done 'quoted text' ${HOME} test
+grep grep then test --verbose && local echo sed printf 2>/dev/null
+readonly export 'quoted text' &&
+$(pwd) printf "$@" "$@" then then test
+	--verbose sed ${HOME} awk x=1
+	'quoted text' local "$1" awk done done x=1 export --verbose grep "$1" ${HOME} readonly
+${HOME} test && local readonly "$1" readonly x=1 && echo grep test
+		echo $(pwd) sed "$@" -eu /usr/bin -eu awk | cd
+	-eu printf "$@" cd export &&
+printf "$1" x=1 test -eu | "$@" cd
+	--verbose "$@" sed readonly 'quoted text' x=1 | awk
+	2>/dev/null && 'quoted text' grep /usr/bin 2>/dev/null
+		&& | cd "$@" sed sed --verbose
+		-eu printf export --verbose grep 2>/dev/null awk x=1 cd "$@" "$1" test
+awk $(pwd) awk test | cd then sed echo awk "$1"
+		done then 'quoted text' 'quoted text'
+	local | printf cd "$@" echo ${HOME} grep
+		| x=1 $(pwd) readonly done "$@" --verbose
+		x=1 done export export awk ${HOME} cd -eu test "$1" done
+'quoted text' $(pwd) echo grep done printf 2>/dev/null
+		&& grep readonly then "$@" sed /usr/bin "$1" 2>/dev/null export "$@"
+local test x=1 2>/dev/null grep printf
+		--verbose then ${HOME} && /usr/bin 2>/dev/null sed then done -eu cd --verbose
+		echo "$@" $(pwd) 'quoted text'
+		--verbose 2>/dev/null x=1 x=1 2>/dev/null
+	printf export printf readonly test sed cd test awk grep test "$1" && $(pwd) test
+	2>/dev/null awk cd "$1" | readonly --verbose sed
+sed ${HOME} "$1" "$@" then
+readonly "$@" $(pwd) grep
+	done cd then 2>/dev/null | 'quoted text' $(pwd) 2>/dev/null
+		then cd x=1 then 2>/dev/null printf export 2>/dev/null sed test
+	done -eu sed ${HOME} local
+		readonly --verbose done 'quoted text' sed local printf
+	test /usr/bin -eu && 'quoted text' local sed
+	"$@" echo then && cd --verbose -eu "$@" echo
+"$@" ${HOME} done local | x=1
+		awk x=1 2>/dev/null && awk -eu --verbose printf 2>/dev/null cd && "$@" /usr/bin
+	sed printf awk done -eu awk test cd
+		then test 2>/dev/null ${HOME} 2>/dev/null
+--verbose 2>/dev/null then test | done test local 2>/dev/null
+test readonly local /usr/bin
+	then readonly -eu 2>/dev/null "$@" test
+#include c238.sh
+	"$@" && readonly then cd sed "$@" | then /usr/bin "$@" then
+cd printf x=1 grep test "$1" --verbose cd then /usr/bin
+		sed awk | 'quoted text' done | "$@"
+--verbose cd | "$@" sed then --verbose
+awk x=1 $(pwd) cd /usr/bin then | 'quoted text'
+		2>/dev/null --verbose 'quoted text' awk && 2>/dev/null x=1 2>/dev/null
+	then test "$@" "$@" --verbose printf awk grep then 'quoted text'
+	--verbose ${HOME} test then export done
+	/usr/bin ${HOME} sed local ${HOME} printf /usr/bin ${HOME}
+&& "$1" printf "$1" cd printf 'quoted text' cd then 2>/dev/null
+		'quoted text' -eu test then test "$@" 2>/dev/null
+	cd sed "$1" --verbose | local && "$1" "$@" "$1" 'quoted text' local
+	then sed sed --verbose
+&& && done $(pwd) echo done | awk awk local readonly /usr/bin ${HOME}
+echo --verbose export 'quoted text'
+	sed /usr/bin 'quoted text' ${HOME} $(pwd) 'quoted text'
+| x=1 | sed local "$1" cd sed "$@" local cd readonly
+&& readonly readonly readonly export done 'quoted text' sed
+		-eu sed 2>/dev/null done awk printf awk && sed then
+		'quoted text' | then | x=1 -eu export | $(pwd) done --verbose printf grep local
+&& --verbose $(pwd) grep | grep ${HOME} echo x=1 sed x=1 "$1"
+	awk "$@" local test sed echo
+'quoted text' 'quoted text' $(pwd) test $(pwd) awk then export
+		-eu -eu printf printf then readonly then readonly
+export test "$1" 2>/dev/null && "$@" --verbose
+		export cd --verbose echo
+printf "$@" test -eu done | 'quoted text' "$1" ${HOME} awk grep echo sed "$@"
+		"$1" readonly 'quoted text' x=1 cd "$@" x=1 x=1 then grep
+echo "$@" readonly awk printf grep "$1" | done ${HOME} "$@" ${HOME}
+	echo echo local 2>/dev/null then --verbose x=1 'quoted text'
+grep echo -eu readonly --verbose printf | export test done test
+	$(pwd) ${HOME} -eu test x=1 export export grep "$1" cd test 2>/dev/null awk test
+-eu printf awk local | "$@"
+--verbose then then "$@" | 'quoted text' |
+	| && /usr/bin 2>/dev/null 2>/dev/null && then | cd 2>/dev/null
+		/usr/bin grep x=1 --verbose awk 'quoted text'
+&& && "$@" | 'quoted text' "$1" readonly export "$1" ${HOME} echo
+	/usr/bin printf 2>/dev/null 2>/dev/null printf "$@" 'quoted text'
+${HOME} "$1" cd test "$@" awk --verbose
+	local $(pwd) readonly "$1"
+'quoted text' readonly done grep sed cd x=1 2>/dev/null test "$1"
+then 'quoted text' done then 'quoted text'
+	cd ${HOME} ${HOME} export then ${HOME} 'quoted text' cd test
+echo sed -eu then readonly "$@" && "$@" ${HOME} && --verbose printf
+	export "$@" -eu cd "$@" local ${HOME} &&
+		printf printf "$1" --verbose
+	echo && done | --verbose awk && awk /usr/bin export sed "$1" --verbose cd ${HOME}
+	-eu 2>/dev/null done ${HOME}
+	"$1" grep --verbose -eu "$1" "$@"
+		awk readonly done done local
+		${HOME} x=1 printf grep grep
+	done x=1 'quoted text' local
+	echo --verbose --verbose | /usr/bin /usr/bin ${HOME} $(pwd) "$@" $(pwd) done echo
+	--verbose 'quoted text' local cd -eu -eu awk awk 2>/dev/null
+	"$@" /usr/bin 'quoted text' ${HOME} /usr/bin
+	then ${HOME} echo cd echo && grep local cd test
+		printf x=1 export $(pwd) export readonly -eu test echo "$@" printf 2>/dev/null awk
+	2>/dev/null printf /usr/bin done
+		/usr/bin --verbose readonly cd export 'quoted text' | export
+printf "$@" then then printf -eu -eu "$1" then &&
+	awk 2>/dev/null export 'quoted text'
+	readonly cd then "$@" awk
+	sed awk printf test ${HOME} "$1" test sed sed done --verbose 'quoted text'
+	cd -eu && | /usr/bin sed then cd local x=1 "$1" -eu -eu local done
+test echo --verbose x=1 && ${HOME} 2>/dev/null
+	${HOME} $(pwd) ${HOME} && x=1 then then $(pwd) "$1"
+		export && /usr/bin $(pwd) echo done $(pwd) printf -eu cd printf "$@"
+	local /usr/bin "$@" readonly "$@" && readonly $(pwd) | -eu then 2>/dev/null
+	| then | local awk $(pwd) -eu 'quoted text' test local then --verbose
+		awk grep /usr/bin | $(pwd) sed local cd -eu then local "$@" | printf
+	-eu test grep echo cd then ${HOME}
+		'quoted text' sed 2>/dev/null --verbose 'quoted text'
+	export then sed "$1" done
+		grep done && then test 'quoted text' "$1" | /usr/bin
+		printf && done | && 2>/dev/null "$1" ${HOME}
+		cd $(pwd) test cd | 2>/dev/null grep --verbose
+	sed && 'quoted text' /usr/bin grep sed ${HOME} local printf 'quoted text'
+printf 'quoted text' awk && ${HOME} "$@" readonly "$@" -eu then printf grep
+$(pwd) done then cd x=1 2>/dev/null -eu local 2>/dev/null
+echo awk export --verbose && $(pwd) /usr/bin && 2>/dev/null echo cd
+		-eu ${HOME} && $(pwd) cd --verbose test sed ${HOME}
+	printf awk test "$1" local ${HOME} -eu -eu test 'quoted text' cd &&
+		cd done --verbose printf -eu "$1" echo "$@" --verbose x=1 printf x=1
+		export local readonly done local sed && ${HOME} printf $(pwd) awk ${HOME}
+		local sed printf echo local done $(pwd) 2>/dev/null awk export
+local -eu printf x=1 grep cd test grep "$1" $(pwd)
+	cd printf && sed awk awk readonly then local sed "$@"
+		cd awk x=1 2>/dev/null -eu done echo 2>/dev/null sed 'quoted text' echo 2>/dev/null
+echo 'quoted text' x=1 | | /usr/bin /usr/bin --verbose readonly
+		"$1" ${HOME} done 2>/dev/null
+		cd /usr/bin 'quoted text' readonly echo | grep awk "$@" export
+grep export ${HOME} grep -eu cd | cd
+export done x=1 export export $(pwd) "$@"
+		awk cd readonly grep test 2>/dev/null local echo 'quoted text' readonly
+	&& "$1" 2>/dev/null echo
+		"$@" && printf printf "$1" "$1" x=1
+		awk "$1" /usr/bin $(pwd) --verbose --verbose
+grep /usr/bin "$@" | "$1" printf 2>/dev/null readonly 'quoted text' printf
+	cd ${HOME} sed 2>/dev/null
+	then -eu --verbose then && ${HOME} ${HOME} 'quoted text' test cd |
+	then sed test export grep
+	export test 'quoted text' x=1 ${HOME} "$@" local sed && readonly local
+	then ${HOME} 'quoted text' 2>/dev/null x=1 "$1" export x=1 readonly
+		$(pwd) ${HOME} -eu echo export && echo
+	sed | ${HOME} test cd local "$@"
+then | then -eu "$1" --verbose sed "$@" 'quoted text' 2>/dev/null
+		local test awk readonly | "$1" done local export sed && printf 'quoted text'
+	/usr/bin | --verbose done ${HOME} "$1" sed export
+	--verbose cd grep ${HOME} cd x=1 && done echo sed printf echo && /usr/bin
+2>/dev/null readonly echo echo readonly && printf /usr/bin
+		grep then echo "$@" x=1 ${HOME} && -eu echo 2>/dev/null echo test
+	"$@" awk --verbose && "$@" --verbose
+		| -eu test grep 'quoted text'
+		readonly printf done sed x=1
+		local printf echo "$1" && local -eu printf awk echo
+printf 'quoted text' printf x=1 | sed done export readonly ${HOME} cd ${HOME}
+	then $(pwd) export local
+2>/dev/null test "$1" "$1" --verbose echo readonly "$1" local /usr/bin
+	done | awk | | -eu $(pwd) cd $(pwd) "$1" done ${HOME}
+${HOME} $(pwd) 'quoted text' /usr/bin test | x=1 /usr/bin
+		--verbose cd && readonly | "$@" echo done | echo 'quoted text'
+		"$@" "$@" --verbose -eu sed export export printf --verbose then | /usr/bin
+		&& echo awk done awk 2>/dev/null done cd printf awk cd $(pwd) done 2>/dev/null
+-eu && && "$@" readonly echo readonly awk then --verbose -eu then then
+	awk cd done done 'quoted text' --verbose -eu grep /usr/bin
+	test sed awk --verbose done --verbose export
+		grep | --verbose $(pwd) | awk x=1 && echo
+	echo export ${HOME} "$1"
+	&& then printf x=1 readonly /usr/bin then --verbose
+		echo cd export /usr/bin cd "$@" 'quoted text' "$1" readonly | $(pwd)
+	-eu echo --verbose "$1" "$@" cd --verbose
+then readonly 2>/dev/null -eu && "$@" awk export local local
+${HOME} export -eu readonly
+		'quoted text' echo "$1" export then
+		awk | 'quoted text' 2>/dev/null x=1 "$1" then test grep 'quoted text'
+printf | printf --verbose readonly
+test echo done "$1" awk
+	export ${HOME} -eu x=1 readonly echo ${HOME} $(pwd) x=1 --verbose | then
+	local grep then /usr/bin && grep then awk
+	cd /usr/bin x=1 $(pwd) awk "$1" -eu 2>/dev/null local
+	export local local --verbose export readonly | x=1 'quoted text'
+		test 2>/dev/null echo done -eu sed awk done 'quoted text'
+	echo -eu -eu && && "$1"
+		/usr/bin test printf cd --verbose cd ${HOME} awk local "$@" -eu readonly
+printf grep /usr/bin awk /usr/bin -eu x=1 &&
+		test 'quoted text' ${HOME}
+	${HOME} sed echo awk /usr/bin done x=1 then
+	'quoted text' ${HOME} then sed | sed printf 2>/dev/null awk x=1 --verbose ${HOME}
+$(pwd) | grep then local "$@" printf | | then "$@" | local
+	--verbose sed /usr/bin
+		/usr/bin awk test 'quoted text' test "$@" -eu ${HOME} --verbose
+		export -eu && "$1" | printf ${HOME} sed sed "$@"
+"$1" grep export "$@" ${HOME} 'quoted text'
+	--verbose --verbose | sed awk grep
+cd $(pwd) printf $(pwd) sed cd cd awk x=1 test "$@" readonly
+		2>/dev/null -eu cd 2>/dev/null done grep --verbose
+	$(pwd) ${HOME} cd 2>/dev/null test then $(pwd) $(pwd) x=1 | cd printf
+	&& printf 'quoted text' awk && done echo "$@" readonly
+--verbose printf sed /usr/bin | 2>/dev/null -eu /usr/bin -eu $(pwd) grep
+cd && test done && && | "$@" awk 2>/dev/null then readonly export $(pwd)
+done "$@" readonly printf
+	then readonly "$@" | echo test x=1 -eu "$@" then cd
+		cd -eu readonly 2>/dev/null "$1" 2>/dev/null --verbose cd --verbose /usr/bin
+		echo | -eu "$@" local local test local
+then | then --verbose "$@" "$@" /usr/bin | $(pwd) export cd test
+		2>/dev/null awk cd readonly 'quoted text' printf
+awk sed readonly grep /usr/bin | "$1" ${HOME} x=1 | x=1 awk --verbose export
+	then ${HOME} ${HOME} 2>/dev/null ${HOME} $(pwd) "$@" --verbose
+	${HOME} echo /usr/bin 'quoted text' --verbose sed done
+		awk cd $(pwd) x=1 echo echo "$1" ${HOME}
+		export | grep "$@" -eu
+		2>/dev/null x=1 local "$@" cd local export sed &&
+		&& "$1" | 'quoted text' awk ${HOME} &&
+cd export test $(pwd) sed -eu $(pwd) awk cd /usr/bin readonly "$1" export then awk
+		local export -eu awk awk echo readonly && grep done printf 2>/dev/null --verbose
+	sed cd x=1 echo cd --verbose printf cd && "$1" --verbose
+		cd x=1 x=1 then grep cd -eu printf
+	"$1" x=1 | && then echo x=1 ${HOME} $(pwd)
+'quoted text' 'quoted text' ${HOME} ${HOME} then
+		done -eu cd 'quoted text' -eu then
+	"$@" test "$1" echo /usr/bin awk grep 2>/dev/null printf -eu then export
+		local -eu /usr/bin -eu $(pwd) "$@" export
+		export && "$@" cd | --verbose /usr/bin --verbose
+		echo "$@" 'quoted text' 'quoted text' echo 'quoted text' "$1" &&
+		readonly done done export && x=1 echo | ${HOME}
+test sed done $(pwd) "$1" --verbose sed $(pwd) readonly
+awk "$@" | "$1" readonly --verbose test echo --verbose /usr/bin
+		test x=1 2>/dev/null | readonly x=1 test ${HOME} echo
+		sed export x=1 awk done 2>/dev/null awk echo then awk
+		readonly && ${HOME} readonly |
+		"$@" -eu 2>/dev/null
+		"$1" /usr/bin done --verbose
+done $(pwd) ${HOME} printf local x=1 awk grep "$1"
+		printf $(pwd) cd "$@" ${HOME} printf $(pwd)
+'quoted text' printf /usr/bin
+		cd sed export printf export
+		/usr/bin x=1 echo grep
+2>/dev/null --verbose $(pwd)
+	'quoted text' printf grep $(pwd) "$@" then readonly && ${HOME} done
+readonly --verbose echo ${HOME} -eu
+echo x=1 -eu then 'quoted text' then -eu
+test echo printf ${HOME} echo local /usr/bin -eu readonly test cd --verbose
+	sed x=1 cd readonly "$@" export 2>/dev/null
+	local printf echo then ${HOME} then 'quoted text' "$@" 2>/dev/null /usr/bin
+		| --verbose then export then local then cd printf test "$@"
+		"$1" -eu x=1 | 2>/dev/null && echo "$@" |
+	cd --verbose $(pwd) /usr/bin $(pwd) awk --verbose readonly ${HOME}
+	printf awk cd cd 'quoted text' done 'quoted text'
+cd local sed readonly then 2>/dev/null ${HOME} && printf "$1" && x=1
+sed x=1 awk local local test "$@" test
+export test awk printf echo
+		awk sed done x=1 x=1 && | awk --verbose ${HOME} echo "$1" export export readonly
+	"$1" "$1" ${HOME} -eu | | then
+	x=1 "$1" cd printf test sed "$@" awk /usr/bin $(pwd) readonly "$1" test $(pwd)
+echo /usr/bin export | test "$@" "$1" awk "$1"
+		-eu sed sed -eu export x=1 | grep export cd done
+		"$@" test sed test readonly test 'quoted text' local 'quoted text' awk
+		awk 'quoted text' grep test
+		cd export "$1" && --verbose
+		cd 'quoted text' -eu done x=1 cd readonly 2>/dev/null
+	${HOME} -eu 2>/dev/null 'quoted text' && test x=1 ${HOME}
+&& 'quoted text' && $(pwd) "$1" grep 'quoted text' --verbose cd local
+	printf $(pwd) local grep done then
+--verbose grep /usr/bin done local
+cd awk test local "$@" x=1 grep grep printf ${HOME} $(pwd)
+done 2>/dev/null local x=1 /usr/bin cd
+export --verbose sed ${HOME} &&
+--verbose echo && /usr/bin export ${HOME} done grep "$1" 2>/dev/null done
+	| "$@" && /usr/bin echo $(pwd)
+		grep local --verbose "$@" echo "$1"
+		$(pwd) --verbose readonly "$@" $(pwd) local /usr/bin grep export "$1"
+		"$1" local /usr/bin done grep done
+	awk x=1 ${HOME} "$1" "$1" | cd then 'quoted text' 2>/dev/null -eu
+${HOME} 'quoted text' $(pwd) | /usr/bin "$1" cd cd x=1 local 2>/dev/null echo
+	x=1 | $(pwd) sed sed ${HOME} ${HOME} readonly && export
+	2>/dev/null /usr/bin printf "$1" $(pwd)
+echo | grep local ${HOME}
+		test echo /usr/bin done export printf done then "$@" cd --verbose test
+"$@" 'quoted text' x=1 'quoted text'
+	"$1" sed readonly $(pwd) 2>/dev/null 2>/dev/null
+	awk $(pwd) then grep export | cd && /usr/bin "$@" readonly | printf x=1
+		"$@" -eu sed then "$@" grep
+	x=1 echo x=1 export | && && x=1 export local | local "$1" local "$@" "$@"
+| ${HOME} then --verbose x=1 awk x=1 cd awk "$@" /usr/bin "$@" --verbose -eu
+test "$1" "$1" "$1" $(pwd) export echo local "$@" | 2>/dev/null readonly && echo
+		${HOME} then && -eu then 2>/dev/null
+		echo local 'quoted text'
+	--verbose x=1 awk x=1 ${HOME} /usr/bin x=1 /usr/bin "$1" echo
+test grep then echo $(pwd)
+	--verbose x=1 awk -eu readonly echo | /usr/bin 'quoted text' grep "$1" test
+		done x=1 x=1 x=1 then then echo /usr/bin readonly awk
+| sed cd then 2>/dev/null -eu export grep "$1" ${HOME} "$@" sed -eu readonly
+	${HOME} done test --verbose awk cd export x=1 export x=1 echo export
+		'quoted text' then cd printf --verbose | then --verbose readonly
+	-eu 'quoted text' awk "$@" done | printf echo awk $(pwd) awk x=1 test "$1" test
+	"$1" readonly $(pwd) readonly --verbose /usr/bin "$1" "$@" grep grep awk x=1 2>/dev/null
+	cd local test done cd "$1" done
+	cd $(pwd) 'quoted text' "$1" 'quoted text'
+/usr/bin done $(pwd) export | | export awk
+		${HOME} printf readonly cd ${HOME} --verbose | "$1" local grep "$@" printf
+cd grep sed echo then
+		"$@" x=1 done cd && echo ${HOME} --verbose sed --verbose
+	local then done && grep -eu ${HOME} done x=1 | --verbose readonly
+	echo | done done readonly
+		readonly then $(pwd) ${HOME}
+2>/dev/null && -eu && x=1 test 'quoted text' export x=1 export
+	--verbose sed "$1" test 'quoted text'
+then echo $(pwd) "$1" /usr/bin readonly
+		/usr/bin test 'quoted text' $(pwd) printf
+		grep && export sed echo grep then then ${HOME} grep
+"$@" awk | grep && test --verbose -eu readonly cd awk readonly
+then readonly sed -eu "$1" -eu
+		done done && --verbose awk
+		x=1 echo && --verbose |
+		test local --verbose $(pwd) cd done 'quoted text' awk grep done 'quoted text'
+cd awk done ${HOME} readonly done cd printf --verbose 2>/dev/null cd printf
+cd test "$1" /usr/bin sed echo $(pwd) $(pwd) done -eu
+	readonly readonly test 'quoted text' sed then x=1 $(pwd)
+		grep printf "$1" x=1 2>/dev/null local sed ${HOME} grep readonly
+-eu --verbose "$1" && then "$1" x=1 && sed $(pwd)
+grep cd sed grep done readonly printf "$1"
+		sed && && && x=1 echo $(pwd) --verbose
+		x=1 $(pwd) test test ${HOME} "$1" && export $(pwd) sed 2>/dev/null
+'quoted text' echo local sed
+printf local 2>/dev/null $(pwd) $(pwd) grep "$1" /usr/bin
+local x=1 grep echo 2>/dev/null --verbose grep test sed done "$1" /usr/bin
+export test then then "$@" 'quoted text' readonly printf test
+		$(pwd) | -eu "$1" readonly
+done "$1" "$1" x=1 /usr/bin | then
+	${HOME} sed "$1" 'quoted text' sed
+		sed -eu x=1 "$@" -eu echo
+/usr/bin sed echo 2>/dev/null local local then grep sed x=1 awk --verbose --verbose
+	-eu cd "$1" "$1" && 2>/dev/null x=1 /usr/bin /usr/bin "$1" ${HOME}
+2>/dev/null -eu readonly sed done $(pwd) readonly printf done done
+	2>/dev/null cd done -eu echo test printf |
+awk --verbose printf -eu test
+		-eu "$1" then awk then grep awk -eu then printf readonly x=1 sed echo
+		--verbose ${HOME} --verbose local $(pwd) then readonly awk /usr/bin
+printf x=1 readonly local test test done
+		awk echo "$@" then local "$@" /usr/bin done &&
+	'quoted text' /usr/bin awk /usr/bin
+done 'quoted text' then x=1 "$@" test awk cd 2>/dev/null 2>/dev/null
+	grep "$1" printf ${HOME} /usr/bin
+local "$@" && --verbose 2>/dev/null x=1 sed printf echo
+	grep grep test export x=1
+		2>/dev/null 'quoted text' $(pwd) /usr/bin readonly 'quoted text'
+then echo then 'quoted text' && "$1" grep | echo printf --verbose export &&
+		/usr/bin | then && -eu | "$1" cd then printf test x=1 printf 'quoted text'
+	"$@" done "$1" local printf echo 'quoted text' then
+	export awk --verbose $(pwd) $(pwd) /usr/bin "$@" export -eu then --verbose -eu
+printf then 2>/dev/null /usr/bin ${HOME} "$1" && -eu
+x=1 -eu awk $(pwd) -eu then x=1 x=1 printf
+	"$@" cd $(pwd) cd local && --verbose then "$1" done 'quoted text' && cd echo $(pwd)
+&& ${HOME} local export awk sed printf cd && printf "$@"
+		$(pwd) sed grep test $(pwd) local 2>/dev/null test
+	grep local done done
+"$1" "$@" test awk -eu $(pwd) 2>/dev/null 'quoted text' export sed echo sed
+2>/dev/null "$@" awk cd sed echo grep awk | printf local printf
+		export /usr/bin local readonly then done export ${HOME}
+--verbose ${HOME} && local /usr/bin /usr/bin ${HOME} then -eu awk printf done
+	cd 'quoted text' $(pwd) awk export --verbose test
+	2>/dev/null local readonly echo grep test readonly ${HOME} x=1 2>/dev/null
+grep /usr/bin printf export awk awk
+awk then /usr/bin echo test x=1 then sed /usr/bin --verbose && "$@" awk grep
+	| grep $(pwd) then /usr/bin
+	cd 2>/dev/null readonly --verbose grep /usr/bin cd readonly test
+		test awk 'quoted text' printf && "$1"
+	echo "$@" && | awk -eu $(pwd) 2>/dev/null 'quoted text' 'quoted text' 'quoted text'
+		then done /usr/bin printf cd grep /usr/bin ${HOME} sed test
+&& grep ${HOME} "$1" -eu /usr/bin echo awk 'quoted text' awk readonly
+	grep ${HOME} then 2>/dev/null local cd cd test test
+		cd sed && test then &&
+		-eu "$@" 2>/dev/null local "$@" /usr/bin awk $(pwd)
+	--verbose then export then test
+awk $(pwd) sed -eu --verbose ${HOME} echo test 'quoted text' readonly | sed
+		"$1" echo echo ${HOME} /usr/bin
+echo && done /usr/bin done awk "$1" awk /usr/bin /usr/bin x=1 grep | 2>/dev/null
+awk 2>/dev/null "$@" 'quoted text' done echo ${HOME} printf && ${HOME} then grep
+'quoted text' printf 'quoted text' --verbose | then test
+		echo readonly --verbose awk 2>/dev/null --verbose /usr/bin 'quoted text'
+$(pwd) 2>/dev/null printf printf
+		'quoted text' $(pwd) awk awk sed 2>/dev/null done 'quoted text' 2>/dev/null
+	sed "$1" /usr/bin /usr/bin done readonly readonly
+x=1 "$1" printf 'quoted text' 2>/dev/null readonly
+	awk | echo test echo awk --verbose local $(pwd) printf $(pwd) "$1"
+	done test $(pwd) readonly | $(pwd) && $(pwd)
+		-eu "$1" local test test | ${HOME} readonly "$@" | $(pwd) "$1" "$1" awk $(pwd)
+done grep then grep sed
+		then ${HOME} 2>/dev/null test 'quoted text' ${HOME} "$@" /usr/bin then local
+		"$@" done x=1 -eu x=1 $(pwd) "$1" sed done x=1 /usr/bin
+		"$@" x=1 --verbose | | done local "$@" sed "$@" local $(pwd) done -eu
+readonly 2>/dev/null --verbose && export "$1" 'quoted text' -eu echo
+	test 2>/dev/null local /usr/bin done "$@"
+	done -eu -eu grep "$1" 'quoted text' sed --verbose /usr/bin local | ${HOME}
+		/usr/bin printf then && &&
+-eu cd grep local echo "$@" export "$1" 'quoted text' -eu then readonly ${HOME}
+echo printf 'quoted text' sed printf /usr/bin then /usr/bin
+	'quoted text' awk sed sed "$@" readonly
+cd --verbose /usr/bin readonly
+	sed /usr/bin local | "$@" local -eu cd echo x=1 x=1 grep then
+	awk readonly 2>/dev/null $(pwd) x=1
+		test --verbose then local sed awk $(pwd) grep cd export cd | 'quoted text'
+	${HOME} | echo done "$1" && done /usr/bin && printf printf && $(pwd)
+		--verbose ${HOME} && /usr/bin readonly grep echo grep ${HOME} ${HOME}
+		test export x=1 readonly --verbose 'quoted text' | | test printf 'quoted text'
+	x=1 export | && echo "$1"
+	then readonly echo printf
+	-eu echo sed sed sed grep 2>/dev/null local "$1" readonly
+printf echo echo test cd test "$@" done -eu --verbose
+awk "$@" export -eu readonly echo ${HOME}
+printf printf --verbose "$@" /usr/bin $(pwd) && x=1 ${HOME} 'quoted text'
+	sed echo echo export done cd sed local 2>/dev/null local && "$@"
+		cd && local 'quoted text' "$1" 2>/dev/null done echo echo then "$1" readonly "$1"
+	readonly export grep x=1 /usr/bin x=1 readonly test $(pwd) /usr/bin
+&& awk --verbose && --verbose sed 'quoted text' -eu | && done
+printf sed x=1 printf && -eu printf readonly sed -eu | awk -eu done printf
+then /usr/bin export /usr/bin then awk test local "$1" sed done grep "$1" test /usr/bin
+printf cd | echo $(pwd) echo && "$1" ${HOME} --verbose $(pwd)
+		awk echo ${HOME} local local x=1 local | | done x=1 printf --verbose
+	2>/dev/null then 2>/dev/null
+awk && test 'quoted text' readonly
+'quoted text' test "$@" ${HOME} then "$@" readonly
+	awk awk /usr/bin export "$1" sed --verbose
+		&& && local sed ${HOME} then 2>/dev/null /usr/bin export cd 'quoted text' sed
+	--verbose readonly grep --verbose local readonly /usr/bin printf sed awk
+test "$1" --verbose "$1" local 2>/dev/null x=1 then printf test
+	2>/dev/null sed $(pwd) x=1 export 2>/dev/null
+		awk cd 2>/dev/null 2>/dev/null done ${HOME} export | /usr/bin
+		"$1" -eu local -eu export awk -eu grep && && /usr/bin
+	2>/dev/null sed $(pwd) echo export 2>/dev/null
+	awk --verbose export then |
+'quoted text' cd -eu $(pwd) sed 'quoted text' $(pwd) then cd export readonly
+printf x=1 cd | grep $(pwd) printf "$1" readonly $(pwd) "$@" awk "$@"
+sed x=1 $(pwd) ${HOME} x=1 -eu ${HOME} local -eu x=1 | | local then
+	echo grep sed ${HOME} x=1 'quoted text'
+		${HOME} -eu 2>/dev/null echo "$1" --verbose && -eu /usr/bin
+local ${HOME} sed x=1 sed local sed cd "$@" x=1 "$1" awk && 'quoted text'
+		done 'quoted text' x=1 done && /usr/bin
+	export export readonly x=1 "$1" local export
+${HOME} then done /usr/bin x=1 | -eu
+2>/dev/null printf then | -eu done test export
+		test $(pwd) && export
+		$(pwd) local awk --verbose local "$@" 2>/dev/null && test export
+then awk local grep /usr/bin -eu
+	cd /usr/bin "$@" sed done --verbose awk $(pwd)
+	"$@" printf "$@" then awk "$@" local grep export $(pwd)
+	/usr/bin && --verbose x=1 printf ${HOME} ${HOME} local x=1
+'quoted text' && --verbose test
+	'quoted text' $(pwd) grep $(pwd) then cd "$1" local $(pwd) -eu 'quoted text'
+		$(pwd) local -eu then && 2>/dev/null printf | 'quoted text'
+	"$1" printf awk local grep awk "$1" test echo "$1" local
+		local sed test && $(pwd) | $(pwd)
+	"$1" printf && awk done then done then 'quoted text' ${HOME} done 'quoted text'
+		--verbose "$1" x=1 sed | cd && "$1" awk sed 2>/dev/null echo 'quoted text'
+-eu export sed | readonly awk 2>/dev/null "$@" echo then then 2>/dev/null
+	sed ${HOME} "$@" /usr/bin "$@"
+	| "$@" cd -eu $(pwd) done cd "$1" done $(pwd) done ${HOME}
+		cd export $(pwd) "$1"
+	&& echo done export | -eu printf grep -eu --verbose 2>/dev/null then
+-eu readonly readonly readonly sed
+	${HOME} cd 2>/dev/null cd echo sed && 'quoted text' sed echo && ${HOME}
+done local awk awk cd && awk echo ${HOME}
+	sed awk | -eu 'quoted text' "$@" sed echo --verbose readonly
+	--verbose 2>/dev/null local $(pwd) test && export cd "$@" then
+	--verbose cd "$@" done 'quoted text'
+printf awk && then awk printf test printf 'quoted text' --verbose grep done
+	"$@" done echo /usr/bin test echo
+		"$@" && $(pwd) then readonly echo cd awk
+${HOME} -eu && printf $(pwd) 2>/dev/null --verbose done cd echo ${HOME}
+	"$@" cd "$@" /usr/bin export cd | ${HOME} then echo $(pwd)
+		/usr/bin 2>/dev/null readonly "$@" --verbose awk sed 2>/dev/null then done printf
+	'quoted text' -eu awk x=1 cd local --verbose then --verbose sed /usr/bin
+		cd --verbose echo -eu --verbose 2>/dev/null
+		printf x=1 $(pwd) "$@" 'quoted text' then echo
+	| printf local | -eu awk local 2>/dev/null echo local grep sed export
+	"$1" then 2>/dev/null /usr/bin 2>/dev/null x=1 $(pwd) /usr/bin
+-eu && 2>/dev/null -eu local x=1 "$@" cd --verbose --verbose $(pwd)
+		then -eu cd "$@" sed 2>/dev/null grep done x=1 readonly "$1"
+		-eu $(pwd) $(pwd) grep done 'quoted text' ${HOME}
+printf /usr/bin -eu | ${HOME} ${HOME} "$@" awk
+	"$@" done printf ${HOME}
+		test test | cd readonly grep x=1 cd awk readonly
+	sed ${HOME} then sed sed "$1" export
+test export readonly echo test /usr/bin readonly readonly then $(pwd) awk
+	grep && "$1" export grep
+cd /usr/bin | echo /usr/bin "$@" -eu sed printf local local
+awk $(pwd) ${HOME} "$1" x=1 printf export $(pwd) printf then
+export echo && 2>/dev/null export cd ${HOME} --verbose | done
+	$(pwd) readonly cd echo
+2>/dev/null readonly local 'quoted text' /usr/bin readonly grep ${HOME} then
+	/usr/bin then local sed export done readonly "$1" 'quoted text'
+--verbose then sed export | 2>/dev/null ${HOME} readonly sed "$1" sed 'quoted text'
+		2>/dev/null | $(pwd) x=1
+		export readonly grep 2>/dev/null
+	readonly /usr/bin grep done && ${HOME} --verbose sed "$1" echo grep echo
+		awk awk done echo "$1" ${HOME} printf done grep
+		sed && cd test echo readonly sed /usr/bin then sed |
+		grep echo ${HOME} 2>/dev/null $(pwd) -eu local
+	echo x=1 -eu then local awk then | then -eu printf
+printf && printf then /usr/bin printf done cd export -eu "$1" "$1" &&
+		local /usr/bin /usr/bin x=1 echo echo -eu $(pwd) -eu echo $(pwd) export test
+	cd done printf cd /usr/bin awk awk cd
+		grep readonly then 'quoted text' /usr/bin done cd done --verbose
+grep sed export printf cd done test --verbose /usr/bin -eu local "$1" cd grep grep
+	sed -eu && printf /usr/bin /usr/bin && /usr/bin
+	readonly cd cd readonly $(pwd) cd "$@" readonly local
+		then cd then | readonly "$1" grep echo -eu test
+sed sed "$1" 'quoted text' echo
+	test test /usr/bin test local grep echo "$@" 'quoted text' 2>/dev/null
+"$@" cd awk && x=1 ${HOME} "$1" echo grep
+		readonly ${HOME} awk cd sed "$1" printf echo $(pwd) "$1" cd
+		2>/dev/null /usr/bin echo /usr/bin
+	readonly local $(pwd) grep /usr/bin printf x=1
+		/usr/bin grep test cd /usr/bin echo done then x=1 2>/dev/null done $(pwd) then
+grep export readonly "$@" test awk done printf ${HOME} test --verbose
+	readonly echo -eu grep
+	readonly printf "$@" grep -eu echo
+	'quoted text' $(pwd) local "$@" sed cd -eu then sed export awk /usr/bin
+	sed sed local export
+	${HOME} ${HOME} $(pwd) "$@"
+cd readonly done | done then --verbose 'quoted text' then "$@" -eu
+local | 2>/dev/null awk done $(pwd) x=1 'quoted text' 2>/dev/null x=1
+"$1" readonly x=1 sed export echo x=1 test awk
+		&& done /usr/bin 2>/dev/null "$@" awk test test 2>/dev/null readonly | $(pwd)
+| /usr/bin awk --verbose printf $(pwd) --verbose
+		awk ${HOME} local readonly local grep | local printf then "$@" then && /usr/bin
+done "$1" then echo -eu && 'quoted text' awk cd done awk done done
+	'quoted text' -eu 2>/dev/null
+	grep | "$1" x=1 --verbose local echo
+	"$1" "$@" export "$@" printf done printf printf awk "$1" "$@" export awk 'quoted text'
+	awk ${HOME} awk 2>/dev/null test then export printf
+		done readonly sed cd grep grep "$@"
+test done "$1" /usr/bin sed | 2>/dev/null "$1" "$1"
+"$@" 2>/dev/null then grep "$@" readonly cd printf sed sed echo
+	then /usr/bin $(pwd) /usr/bin done 'quoted text' $(pwd)
+grep export printf awk | 2>/dev/null export
+	awk -eu done && $(pwd) export local echo && /usr/bin
+		echo grep grep "$@" && $(pwd) export "$@" export -eu then grep
+cd && done $(pwd) readonly cd $(pwd) && "$1" printf "$@" $(pwd) echo "$1" --verbose
+	export grep && sed "$@" then
+	awk 'quoted text' 'quoted text' echo
+	readonly --verbose export 'quoted text' $(pwd)
+	awk grep readonly printf -eu then 'quoted text' echo $(pwd) "$@" sed "$1"
+		&& /usr/bin printf && -eu x=1
+		awk x=1 readonly grep done awk ${HOME} export $(pwd) ${HOME} cd echo
+	printf --verbose grep printf |
+cd readonly $(pwd) sed --verbose grep echo "$@"
+	/usr/bin 2>/dev/null done -eu -eu awk echo
+		awk readonly 'quoted text' "$@"
+		&& cd "$@" echo x=1 done | $(pwd) local && x=1 export
+test 'quoted text' --verbose printf | grep --verbose
+		grep 'quoted text' $(pwd)
+		${HOME} -eu $(pwd) then /usr/bin
+| sed "$@" -eu test x=1 cd grep cd | test "$1" --verbose printf echo $(pwd)
+	cd local --verbose grep
+$(pwd) && local --verbose grep printf ${HOME} printf awk
+| sed $(pwd) "$@" "$1" local
+export x=1 | "$1" x=1 readonly local test "$@" echo && done "$@" then
+	2>/dev/null ${HOME} $(pwd) echo -eu then test printf
+	x=1 x=1 /usr/bin | export awk | then 2>/dev/null | | "$@" ${HOME} readonly -eu
+cd "$1" --verbose | test x=1
+		cd grep export /usr/bin | export x=1 done cd done ${HOME} -eu
+	grep -eu "$1" ${HOME} "$1" | -eu
+		&& 'quoted text' ${HOME} export && printf $(pwd)
+echo echo ${HOME} --verbose cd local local && -eu export "$1" printf export -eu
+2>/dev/null 'quoted text' awk printf -eu "$1" $(pwd) local cd --verbose grep
+	export x=1 echo readonly
+x=1 x=1 test "$@" x=1 echo /usr/bin export && grep "$1" cd local printf awk grep
+		x=1 awk done "$@" | awk /usr/bin done "$1"
+		readonly awk 2>/dev/null --verbose && 2>/dev/null readonly then sed x=1
+"$@" sed "$1" "$@" local grep
+		2>/dev/null test /usr/bin cd test /usr/bin awk x=1 | | -eu
+echo then -eu done "$1" echo "$1" && printf "$1" readonly
+	echo test grep x=1 | /usr/bin awk 'quoted text'
+| printf "$1" $(pwd) export
+		'quoted text' printf sed "$1" cd grep
+		-eu --verbose | "$@" | cd grep "$1" && cd "$@" -eu echo | --verbose
+		&& --verbose ${HOME} && local readonly | done awk 2>/dev/null
+		${HOME} && export grep 2>/dev/null awk
+	then "$@" cd readonly
+done && && cd then "$1" echo local echo echo export | grep sed "$@" echo then
+		$(pwd) 'quoted text' echo "$@" -eu -eu $(pwd)
+	export /usr/bin 'quoted text' x=1 readonly test
+	$(pwd) 'quoted text' $(pwd) /usr/bin 2>/dev/null /usr/bin ${HOME} /usr/bin
+		done sed && x=1 x=1 $(pwd) export test awk sed export && && "$1" export
+		done "$1" /usr/bin "$1" /usr/bin --verbose $(pwd)
+done x=1 grep awk | "$@" cd export ${HOME} &&
+	printf 'quoted text' echo cd printf "$@" echo
+		2>/dev/null grep awk printf x=1 export -eu && echo then /usr/bin
+		echo /usr/bin export x=1 $(pwd) test then
+		"$@" echo x=1 --verbose 2>/dev/null sed --verbose
+		--verbose $(pwd) | && | echo local x=1 --verbose cd /usr/bin echo export ${HOME}
+	readonly --verbose x=1 "$1" grep 2>/dev/null -eu
+	"$1" grep readonly export
+| /usr/bin grep $(pwd) test 'quoted text'
+		"$1" /usr/bin $(pwd) readonly done | 'quoted text' "$1" awk sed sed readonly x=1
+	then ${HOME} test ${HOME} -eu printf done x=1 export --verbose then local
+		printf 2>/dev/null | echo
+	x=1 /usr/bin export ${HOME} |
+	awk export printf x=1 echo $(pwd) x=1 ${HOME} -eu local export local then |
+	"$@" printf cd -eu test then /usr/bin export test local
+	sed ${HOME} $(pwd) readonly --verbose sed ${HOME} echo cd "$1" printf
+		/usr/bin && grep -eu sed done x=1 printf && x=1 export "$@" done
+&& awk then sed $(pwd) export
+/usr/bin grep -eu "$@" printf "$@" | sed $(pwd) "$@" && done
+		-eu done cd then then -eu | /usr/bin "$@" grep
+	$(pwd) -eu then export /usr/bin && && export /usr/bin
+		sed test test local 2>/dev/null /usr/bin 2>/dev/null
+		then 2>/dev/null && local /usr/bin -eu $(pwd) sed readonly
+awk echo then export /usr/bin
+		-eu x=1 --verbose "$@" sed && awk echo 2>/dev/null x=1
+		then | done test awk cd cd grep /usr/bin readonly
+		x=1 /usr/bin "$@" test grep cd grep export
+	local done -eu sed readonly /usr/bin /usr/bin --verbose /usr/bin "$@"
+	test /usr/bin printf test cd cd then --verbose | then test && "$1"
+"$1" export ${HOME} sed x=1 export 2>/dev/null && && /usr/bin "$@" "$1" "$1" awk
+		done | | readonly && grep -eu | | grep 'quoted text'
+sed test printf done x=1 "$@"
+	readonly grep cd echo sed
+local | echo -eu 'quoted text' "$@" sed grep echo awk local 'quoted text'
+	-eu cd ${HOME} cd && local | $(pwd) --verbose
+-eu test && cd /usr/bin "$@"
+	&& test printf | "$@" 2>/dev/null 2>/dev/null
+	/usr/bin export readonly 2>/dev/null printf 2>/dev/null grep
+${HOME} 2>/dev/null x=1 'quoted text' awk && local x=1 export test
+		'quoted text' $(pwd) 2>/dev/null
+	$(pwd) export 'quoted text' "$1" sed printf "$@" "$1" 'quoted text'
+	local "$@" 'quoted text' printf ${HOME}
+readonly | local local sed "$1" export sed x=1 "$@" cd printf printf 'quoted text'
+--verbose "$1" done cd grep then --verbose $(pwd) readonly
+		then -eu x=1 echo | then | $(pwd)
+		grep 2>/dev/null test 'quoted text'
+sed printf test export && ${HOME} 'quoted text' sed x=1 export
+	| | readonly /usr/bin sed grep
+		export readonly && "$1" "$@" 2>/dev/null then echo 'quoted text'
+		echo --verbose test printf grep printf then "$1" cd done 'quoted text'
+sed echo && 'quoted text' then $(pwd)
+	printf local printf 2>/dev/null ${HOME} readonly -eu 'quoted text'
+local test $(pwd) && "$@" "$@" "$@" --verbose x=1 readonly sed $(pwd)
+	"$1" local 'quoted text' readonly -eu /usr/bin ${HOME} printf
+		grep cd ${HOME} readonly $(pwd) grep test
+		--verbose done ${HOME} awk then | sed 'quoted text' x=1 readonly awk done grep
+		done cd then 'quoted text' local done printf grep awk && cd "$@"
+test ${HOME} test ${HOME}
+	test sed done then --verbose | "$@" $(pwd) grep --verbose
+cd ${HOME} grep $(pwd) echo awk --verbose sed then $(pwd) 'quoted text'
+	-eu "$@" /usr/bin /usr/bin
+		| test x=1 export ${HOME} export 2>/dev/null readonly
+		sed && --verbose export /usr/bin /usr/bin &&
+	x=1 'quoted text' -eu | export grep ${HOME}
+		sed grep && awk ${HOME} local local && export export 2>/dev/null readonly --verbose
+printf ${HOME} then awk | $(pwd)
+	&& grep 2>/dev/null && $(pwd) 2>/dev/null x=1 done 2>/dev/null
+then grep 'quoted text' "$@"
+		"$1" grep cd 'quoted text' local then 2>/dev/null test 2>/dev/null
+		test "$@" grep then 2>/dev/null | cd sed sed /usr/bin grep
+	done && /usr/bin $(pwd) $(pwd) x=1 local "$1" local
+	awk grep sed x=1 sed $(pwd) | $(pwd) readonly done x=1 local /usr/bin
+	then printf 'quoted text' echo printf echo 'quoted text' /usr/bin echo cd &&
+	sed cd && readonly cd 2>/dev/null awk
+	then grep awk done test 2>/dev/null "$@" done /usr/bin
+		readonly 2>/dev/null local "$1" "$1" done printf
+	test awk "$1" 'quoted text' printf $(pwd) x=1 sed
+	| /usr/bin test && 2>/dev/null sed then done then 'quoted text' ${HOME}
+"$@" printf awk export ${HOME} test echo $(pwd) sed awk 2>/dev/null export 2>/dev/null
+	readonly export 2>/dev/null printf -eu readonly --verbose | test cd
+	$(pwd) readonly local test 2>/dev/null "$@" printf 'quoted text'
+		local then export awk && 2>/dev/null --verbose &&
+		grep 2>/dev/null && sed then export ${HOME}
+	${HOME} test ${HOME} 2>/dev/null sed -eu cd then then 2>/dev/null
+		x=1 x=1 printf /usr/bin 2>/dev/null
+	/usr/bin readonly /usr/bin printf
+	&& x=1 cd local cd | "$@"
+then printf awk $(pwd) cd local
+		readonly /usr/bin grep --verbose test /usr/bin awk ${HOME}
+		--verbose 'quoted text' ${HOME} printf cd done cd
+awk export printf printf
+$(pwd) echo $(pwd) test $(pwd) "$1" 2>/dev/null
+		awk /usr/bin 'quoted text' && printf echo
+printf ${HOME} cd x=1 echo ${HOME} "$@" "$1" && grep "$1" then
+local grep x=1 done x=1 'quoted text' "$@" test then done 'quoted text' "$@" &&
+readonly awk readonly x=1 "$1" cd
+then | $(pwd) --verbose --verbose /usr/bin 2>/dev/null printf printf && awk done
+	echo test echo x=1 local printf grep "$1" && local
+	printf -eu --verbose grep 'quoted text' x=1 2>/dev/null
+	echo -eu | test cd "$1" done echo "$1"
+/usr/bin printf grep 2>/dev/null
+awk awk /usr/bin "$1" readonly
+local 'quoted text' readonly && cd && sed "$@" x=1 sed && awk done export
+	echo "$@" "$@" printf done printf --verbose cd x=1 local sed ${HOME} 'quoted text'
+	--verbose -eu then /usr/bin printf printf awk sed grep --verbose
+	local x=1 'quoted text' awk "$1" test echo "$1" awk export sed 'quoted text'
+done printf then grep "$1" printf "$1" /usr/bin 2>/dev/null "$@"
+	printf 'quoted text' export awk local --verbose
+		echo cd $(pwd) ${HOME} cd echo
+x=1 done printf | cd 'quoted text'
+	--verbose test ${HOME}
+	x=1 done | grep | $(pwd) --verbose --verbose sed /usr/bin
+	"$@" printf | && readonly
+		then /usr/bin /usr/bin
+		sed grep then $(pwd) echo echo local sed | test
+	echo 2>/dev/null readonly
+$(pwd) ${HOME} && then | --verbose /usr/bin cd /usr/bin
+then echo "$@" awk --verbose test ${HOME} ${HOME} grep printf
+	sed readonly --verbose
+	2>/dev/null $(pwd) printf local grep -eu done printf "$1" sed done 2>/dev/null
+		"$@" x=1 ${HOME} $(pwd) "$1"
+	printf 2>/dev/null $(pwd) test 2>/dev/null echo
+export printf test awk /usr/bin x=1 'quoted text' ${HOME} test printf printf
+cd "$1" /usr/bin then x=1 then /usr/bin | cd 2>/dev/null sed then
+		${HOME} ${HOME} /usr/bin test test readonly cd
+	then done readonly local "$@" test "$1" -eu /usr/bin | -eu x=1 done local
+'quoted text' ${HOME} readonly test | then 2>/dev/null printf grep $(pwd) $(pwd)
+	readonly awk awk "$@" $(pwd) readonly --verbose 'quoted text' "$@" export
+'quoted text' 'quoted text' $(pwd) "$@" then grep
+		2>/dev/null && 2>/dev/null cd -eu | grep cd 'quoted text'
+sed --verbose -eu local awk cd /usr/bin printf --verbose
+	"$@" ${HOME} export printf ${HOME} then "$@" "$@"
+		then test then grep 2>/dev/null
+	readonly readonly -eu
+		echo && /usr/bin 'quoted text' && -eu grep "$@"
+	"$1" readonly then local -eu echo --verbose local then 2>/dev/null
+		test printf && 2>/dev/null
+printf "$@" "$@" printf -eu echo awk && -eu then test echo -eu x=1 /usr/bin "$@"
+		printf local $(pwd) test && -eu "$@" grep echo readonly "$@" then
+	then | awk done test then $(pwd) done test /usr/bin
+	| cd --verbose x=1 -eu 2>/dev/null --verbose
+sed | awk ${HOME} export ${HOME} done done grep "$@" $(pwd) --verbose
+	awk "$1" -eu cd -eu ${HOME} /usr/bin printf export
+	export && then readonly
+		$(pwd) $(pwd) --verbose test test echo sed echo export "$1"
+echo ${HOME} local --verbose export 2>/dev/null 2>/dev/null "$1" then
+	&& ${HOME} done | --verbose
+	sed readonly --verbose $(pwd) local -eu local test | /usr/bin
+		export awk 2>/dev/null
+	$(pwd) awk $(pwd) "$@" 'quoted text' -eu 'quoted text' echo done /usr/bin
+	&& then x=1 --verbose $(pwd) local --verbose $(pwd) awk
+	"$1" $(pwd) awk -eu 2>/dev/null done test then 'quoted text'
+		'quoted text' export echo awk awk /usr/bin awk
+| x=1 local | ${HOME} printf "$1" /usr/bin /usr/bin x=1 echo
+	-eu readonly /usr/bin $(pwd) done then --verbose
+-eu $(pwd) "$@" grep grep --verbose then test "$1" && --verbose cd awk export
+	$(pwd) 2>/dev/null then done /usr/bin /usr/bin /usr/bin readonly done printf
+		export /usr/bin echo sed x=1 ${HOME}
+	test echo --verbose cd x=1
+2>/dev/null -eu local local -eu --verbose 2>/dev/null
+		-eu ${HOME} 2>/dev/null sed
+	2>/dev/null printf $(pwd) export done "$@"
+	cd test export echo x=1 test && local x=1 | local test test awk
+		local test grep $(pwd)
+		local readonly sed /usr/bin test export echo awk && | 'quoted text' grep
+		echo $(pwd) ${HOME} done export sed readonly export
+		done /usr/bin ${HOME} ${HOME} "$@" | 2>/dev/null 'quoted text'
+-eu -eu cd $(pwd) /usr/bin 'quoted text' cd grep "$@" && 2>/dev/null
+$(pwd) done echo local done
+		x=1 --verbose cd local local grep $(pwd) "$1" "$@" test $(pwd)
+done 'quoted text' && "$1" then awk x=1 x=1 readonly "$1" "$@" x=1 then printf done
+	&& printf ${HOME} --verbose awk local
+	-eu --verbose export readonly then x=1 test x=1 "$@" awk awk printf readonly
+	&& /usr/bin && | -eu readonly
+		x=1 | cd && grep "$@" printf awk --verbose grep cd grep "$1"
+		&& "$@" "$1" "$@" "$@" "$@" local echo $(pwd) printf x=1 $(pwd) --verbose "$1"
+	readonly then /usr/bin test $(pwd) -eu /usr/bin local --verbose x=1 ${HOME}
+	export $(pwd) export | cd echo $(pwd)
+awk readonly ${HOME} 2>/dev/null --verbose && test local -eu done /usr/bin
+$(pwd) sed cd test export awk "$1" ${HOME} x=1 'quoted text'
+		"$@" local x=1 readonly x=1 x=1 echo "$1" printf | awk 'quoted text' awk
+		test -eu awk echo then ${HOME} ${HOME} 'quoted text' sed 2>/dev/null
+	done && --verbose /usr/bin /usr/bin ${HOME} "$@" readonly readonly export
+cd awk then 'quoted text' /usr/bin cd
+		local awk ${HOME} sed test cd export $(pwd) "$1" --verbose echo | ${HOME}
+		test local export export
+	printf -eu "$@" awk && $(pwd) readonly then cd echo sed 2>/dev/null | printf printf
+		awk --verbose cd "$1" --verbose export cd -eu printf /usr/bin
+	-eu test readonly done ${HOME} "$1" grep
+printf sed cd -eu cd test sed export awk "$@"
+$(pwd) | "$1" awk local printf && done export
+		&& --verbose then ${HOME} awk printf
+	| "$1" 'quoted text'
+2>/dev/null 'quoted text' done done awk grep echo $(pwd) ${HOME} echo local
+		"$1" $(pwd) echo awk "$@" && "$1" ${HOME} "$1" "$@"
+		"$@" "$1" 'quoted text' 2>/dev/null $(pwd) $(pwd) | then export then
+	export ${HOME} --verbose x=1 local grep
+'quoted text' && awk ${HOME} local readonly echo --verbose sed ${HOME} | grep
+	${HOME} local grep test awk 'quoted text'
+"$1" | "$@" grep grep printf awk $(pwd) cd echo export x=1 readonly && sed
+"$@" --verbose --verbose 2>/dev/null local "$@" -eu cd
+	"$@" --verbose then 'quoted text' done --verbose x=1 done | -eu
+	"$1" readonly then awk readonly ${HOME} readonly sed done test then
+	test done ${HOME} $(pwd)
+sed printf 'quoted text' ${HOME} awk readonly && /usr/bin
+"$1" "$@" echo local sed "$@"
+		sed then $(pwd) echo local printf readonly -eu 'quoted text'
+-eu sed done /usr/bin
+	test done "$1" awk 2>/dev/null ${HOME} cd done then cd done test
+	| ${HOME} test $(pwd) grep --verbose awk local awk local ${HOME} echo
+"$@" cd cd -eu export
+	&& then | cd $(pwd) local --verbose test readonly grep cd | cd readonly /usr/bin
+	--verbose x=1 --verbose printf
+	sed sed -eu export | export "$1" printf /usr/bin && $(pwd) readonly cd /usr/bin
+		"$1" export grep "$1" 'quoted text' x=1 --verbose awk
+		local && readonly /usr/bin local echo local done "$@" $(pwd)
+	sed printf | echo /usr/bin "$@" awk then export awk
+"$1" sed awk sed then local x=1 awk --verbose awk printf
+		echo cd sed done printf
+		-eu cd done test /usr/bin "$@" printf
+sed printf local readonly --verbose grep export $(pwd) x=1 awk x=1 printf ${HOME}
+		| "$1" --verbose test $(pwd) printf
+		printf "$@" done then export export x=1 cd cd ${HOME} sed ${HOME}
+		local test test && --verbose sed sed done cd | x=1 done echo
+$(pwd) done sed readonly $(pwd) ${HOME} cd $(pwd) /usr/bin local "$@" "$1"
+		printf 2>/dev/null x=1 -eu echo && printf local "$@"
+		x=1 "$@" cd sed done readonly test --verbose
+	/usr/bin -eu readonly readonly 2>/dev/null
+		sed awk | -eu grep test cd cd x=1 awk x=1 local local 'quoted text'
+	export done printf && test echo
+		readonly cd cd done -eu local "$@" readonly awk local ${HOME}
+		| x=1 test | awk x=1 "$1" && && /usr/bin
+		x=1 -eu /usr/bin grep readonly awk
+/usr/bin grep && then -eu 2>/dev/null grep done $(pwd)
+	| ${HOME} printf export -eu export "$1" echo local
+test echo ${HOME} cd grep test then sed grep export 'quoted text'
+		local --verbose done test awk -eu test done $(pwd) sed readonly
+		2>/dev/null /usr/bin export done "$1" --verbose test test $(pwd)
+	readonly "$@" printf 2>/dev/null 'quoted text' --verbose
+		| 'quoted text' | done && 'quoted text' && echo echo -eu
+--verbose --verbose 'quoted text' cd done readonly awk sed grep
+		| | then awk /usr/bin then export awk then "$1" cd 2>/dev/null readonly sed
+'quoted text' "$@" export -eu "$@" export
+local 2>/dev/null test "$@" awk --verbose awk 2>/dev/null
+then awk $(pwd) done -eu ${HOME} --verbose 'quoted text'
+	echo echo | readonly awk then done sed "$1" $(pwd) $(pwd) readonly --verbose
+done $(pwd) x=1 sed echo export -eu done 'quoted text'
+		test 'quoted text' printf 2>/dev/null -eu printf
+	"$@" sed cd 'quoted text' grep | && grep sed && awk | test
+		'quoted text' 2>/dev/null 'quoted text' "$@" done readonly grep cd
+		grep /usr/bin sed done 2>/dev/null 'quoted text' x=1 -eu "$1" "$1"
+		test 'quoted text' printf --verbose awk "$@" sed
+export echo 'quoted text' cd then done | && $(pwd) grep --verbose ${HOME}
+		&& done "$1" /usr/bin echo | | && -eu sed local export
+awk sed $(pwd) then "$1" grep "$@" sed readonly --verbose readonly printf
+x=1 readonly test /usr/bin
+	then then ${HOME} test then | 2>/dev/null x=1 /usr/bin --verbose cd $(pwd) done
+	sed && awk && ${HOME} --verbose export cd
+"$1" -eu local -eu readonly ${HOME} grep readonly x=1 --verbose
+	done grep test | awk then /usr/bin cd /usr/bin then
+-eu /usr/bin printf --verbose && cd ${HOME} then local
+	/usr/bin 'quoted text' local printf
+sed awk -eu then echo then export printf $(pwd) echo readonly
+	grep /usr/bin export "$@" 'quoted text'
+		echo printf | done echo cd done readonly echo export cd local test export export
+	$(pwd) 2>/dev/null -eu sed sed -eu
+		printf ${HOME} 'quoted text' $(pwd)
+	cd awk ${HOME} test then --verbose -eu "$1" "$@" cd /usr/bin /usr/bin /usr/bin
+	-eu ${HOME} local readonly readonly then x=1 $(pwd)
+		grep cd then done "$1" -eu x=1 echo
+	'quoted text' "$@" done export
+printf done grep sed
+		done local cd 'quoted text' 'quoted text' /usr/bin grep &&
+	-eu $(pwd) ${HOME} --verbose awk 2>/dev/null
+		/usr/bin export grep awk cd $(pwd) 'quoted text' && done "$1" --verbose
+readonly grep printf && echo /usr/bin printf ${HOME} local 'quoted text'
+		sed x=1 sed ${HOME} then grep && --verbose done local
+	echo 'quoted text' 2>/dev/null /usr/bin
+		awk -eu "$@" "$1" -eu cd printf sed local
+"$1" awk local export $(pwd) echo && && done "$@" test | x=1 -eu "$1" -eu local
+		sed $(pwd) ${HOME} export /usr/bin "$1"
+	done then cd --verbose local export --verbose grep "$1"
+		2>/dev/null /usr/bin $(pwd) then printf "$@" cd done awk echo export readonly
+'quoted text' "$1" grep readonly then x=1 x=1 local done local /usr/bin
+	awk awk done $(pwd) done awk
+		'quoted text' export 'quoted text'
+readonly readonly export echo grep x=1
+	grep export -eu "$1" ${HOME} 'quoted text' export then awk $(pwd) echo
+		then awk ${HOME} 'quoted text' 'quoted text' local
+		test test x=1 ${HOME} export export printf local x=1 grep done
+		echo | printf sed | test --verbose /usr/bin
+	then awk printf sed | test | printf $(pwd)
+	cd test test -eu --verbose local sed "$@" done echo /usr/bin
+test 'quoted text' /usr/bin $(pwd) x=1
+2>/dev/null local | 'quoted text'
+${HOME} cd done ${HOME} export ${HOME} local x=1 ${HOME} done
+		grep then ${HOME} && grep grep then | --verbose grep grep
+	"$@" echo | | then printf
+		${HOME} 2>/dev/null readonly "$@" | |
+		then /usr/bin "$@" x=1 readonly 'quoted text' readonly
+		"$@" export then && then cd x=1 ${HOME}
+"$1" awk x=1 readonly echo 'quoted text' export | printf test done cd
+printf $(pwd) done 2>/dev/null
+cd --verbose 2>/dev/null $(pwd) $(pwd)
+	then 2>/dev/null export /usr/bin cd sed grep
+		'quoted text' test then printf x=1 "$@" printf then "$@" -eu done readonly
+		2>/dev/null 2>/dev/null -eu 2>/dev/null
+/usr/bin "$1" "$@" grep
+${HOME} local test awk x=1 && | x=1 export done sed 2>/dev/null x=1 done -eu
+	readonly grep 2>/dev/null grep "$@" 'quoted text' awk
+done grep 'quoted text' grep x=1 --verbose printf then && test && && -eu x=1
+		-eu local x=1 printf "$1"
+		awk echo -eu done cd readonly 2>/dev/null $(pwd)
+-eu /usr/bin readonly readonly then --verbose then printf
+"$1" x=1 ${HOME} then cd readonly awk | && test awk printf && 'quoted text'
+		${HOME} $(pwd) readonly
+export $(pwd) local test $(pwd) "$1" sed awk echo local $(pwd) readonly 'quoted text'
+		export done 'quoted text' readonly printf echo test && "$1" 2>/dev/null
+	readonly && --verbose 'quoted text' echo ${HOME}
+	grep 'quoted text' -eu --verbose "$1" done ${HOME} && echo $(pwd) "$1"
+echo awk 2>/dev/null -eu 'quoted text' x=1 --verbose 'quoted text'
+then then "$1" $(pwd) echo --verbose awk done x=1 && sed then
+		then cd then sed grep grep 2>/dev/null
+| 2>/dev/null "$1" awk export then local ${HOME}
+'quoted text' awk sed local test 2>/dev/null
+	done 'quoted text' then cd "$1" --verbose local "$@" test
+		$(pwd) sed test "$1" "$1" sed echo echo
+done && "$@" readonly cd --verbose /usr/bin awk /usr/bin
+		grep /usr/bin --verbose sed then grep 'quoted text' | sed test
+		sed test echo grep && awk export export
+export awk sed ${HOME} 'quoted text' awk x=1 2>/dev/null "$1" printf ${HOME} &&
+		then && | "$@" -eu then readonly | -eu sed && "$@" readonly printf awk export
+	readonly ${HOME} -eu readonly "$@" "$1" && awk --verbose test awk
+x=1 -eu echo test done | sed 2>/dev/null $(pwd) cd 'quoted text' export
+x=1 test /usr/bin $(pwd) /usr/bin --verbose "$1" cd x=1 export sed --verbose
+sed 'quoted text' awk sed cd printf $(pwd) cd "$@" && "$1" echo 2>/dev/null "$1"
+	sed "$@" local $(pwd) readonly readonly 'quoted text' readonly export
+	"$@" 2>/dev/null awk $(pwd) "$1" 'quoted text' awk done 'quoted text' readonly
+&& ${HOME} sed awk grep -eu
+	then echo --verbose ${HOME} && sed /usr/bin local
+	echo /usr/bin export test test local test |
+		export "$1" /usr/bin echo grep
+&& 'quoted text' local --verbose test export -eu cd awk grep then
+	echo export echo && readonly test done sed 'quoted text' printf -eu cd
+		test x=1 2>/dev/null --verbose printf "$1" 2>/dev/null grep $(pwd) $(pwd) then
+	| -eu echo x=1 echo cd then x=1 ${HOME} ${HOME} "$1" readonly sed
+echo test echo test done x=1 export
+		--verbose local 2>/dev/null x=1 done
+	printf readonly printf test printf ${HOME} grep echo
+		/usr/bin readonly test local 'quoted text' done readonly test done
+		"$1" -eu then 2>/dev/null $(pwd) then -eu cd x=1 | -eu sed awk --verbose echo
+	"$1" "$1" --verbose awk then -eu readonly | printf --verbose
+	cd 2>/dev/null local 'quoted text' $(pwd) printf
+local "$@" export local readonly
+		test /usr/bin x=1 readonly $(pwd) x=1 done && /usr/bin && /usr/bin
+		$(pwd) $(pwd) awk $(pwd) done | done printf done /usr/bin 2>/dev/null
+	printf readonly 2>/dev/null 'quoted text' $(pwd) then | printf
+		then --verbose cd export | ${HOME} -eu then test test grep sed &&
+echo --verbose done cd && && -eu 2>/dev/null
+		x=1 /usr/bin 'quoted text' export done test ${HOME} $(pwd) readonly then
+x=1 2>/dev/null --verbose local awk readonly readonly printf
+		${HOME} x=1 $(pwd) ${HOME} ${HOME} ${HOME} "$1" $(pwd) | | 2>/dev/null
+		&& x=1 printf cd x=1 && export done 'quoted text' | cd x=1 x=1 cd grep local
+		test printf then --verbose | local echo /usr/bin readonly echo ${HOME} ${HOME}
+	| -eu 2>/dev/null done ${HOME} | export
+		/usr/bin "$@" /usr/bin -eu grep local 2>/dev/null then export
+-eu "$1" "$@" grep grep "$1" /usr/bin x=1 "$@" && "$@" printf sed grep test
+"$@" 'quoted text' x=1 readonly readonly
+		| awk --verbose -eu "$@" cd test
+	cd then 2>/dev/null -eu && $(pwd) grep cd "$1"
+	'quoted text' /usr/bin sed 'quoted text'
+	x=1 -eu printf test /usr/bin 2>/dev/null "$1"
+	printf echo && readonly cd -eu --verbose readonly
+/usr/bin local awk 'quoted text' readonly
+		/usr/bin test && local 2>/dev/null
+	grep echo --verbose then sed --verbose test grep
+	sed 'quoted text' awk then test export 2>/dev/null printf x=1 'quoted text'
+	'quoted text' && echo printf /usr/bin
+	'quoted text' | 'quoted text' ${HOME} echo cd echo then -eu $(pwd) readonly
+	done ${HOME} readonly
+		-eu readonly grep $(pwd)
+readonly && $(pwd) readonly awk 2>/dev/null
+		-eu && 2>/dev/null -eu
+		"$@" $(pwd) echo test /usr/bin /usr/bin test 2>/dev/null
+then done 2>/dev/null $(pwd)
+2>/dev/null 2>/dev/null export --verbose sed then
+	then 2>/dev/null then cd test | $(pwd) test readonly | "$1" done --verbose
+	cd "$@" 2>/dev/null echo 2>/dev/null -eu "$1"
+done ${HOME} -eu 'quoted text' readonly ${HOME} readonly then export |
+	readonly cd sed "$1" done /usr/bin test
+		$(pwd) export then /usr/bin export awk done awk
+| sed $(pwd) /usr/bin -eu done x=1
+	'quoted text' x=1 "$1" ${HOME} cd export ${HOME} sed -eu -eu
+		-eu -eu test grep then | | ${HOME}
+	awk test ${HOME} echo -eu export
+		2>/dev/null ${HOME} 2>/dev/null x=1 --verbose
+	test "$1" $(pwd) x=1 sed /usr/bin ${HOME} echo cd sed grep export sed "$@" ${HOME}
+		2>/dev/null $(pwd) 2>/dev/null 'quoted text' 2>/dev/null $(pwd) "$@"
+	cd then x=1 echo $(pwd) readonly echo cd -eu cd
+	'quoted text' 'quoted text' readonly
+	cd sed 2>/dev/null 'quoted text' echo --verbose
+		| printf echo $(pwd) 'quoted text' printf local --verbose /usr/bin readonly
+	${HOME} test --verbose local "$1" 'quoted text'
+		${HOME} done $(pwd) local 2>/dev/null -eu sed awk printf "$@" x=1 awk awk
+		"$1" ${HOME} 2>/dev/null sed sed "$1" export grep /usr/bin awk printf && /usr/bin
+-eu grep readonly grep "$1" readonly "$1" | readonly 'quoted text' ${HOME}
+		"$@" awk "$1" local --verbose -eu ${HOME}
+		"$1" grep 'quoted text' echo 2>/dev/null ${HOME} export test && -eu
+		export awk && grep echo readonly sed test printf "$1" 2>/dev/null printf
+	sed -eu echo "$1" "$@"
+		echo "$@" awk "$@" grep "$@" x=1 readonly "$@" /usr/bin --verbose
+local grep printf export export awk awk 2>/dev/null
+		test $(pwd) then then "$@" local readonly done $(pwd)
+	2>/dev/null export echo -eu export then then && echo ${HOME} sed 'quoted text'
+		&& --verbose "$1" then awk /usr/bin x=1
+	"$1" export --verbose ${HOME} x=1 $(pwd)
+	"$1" grep cd then ${HOME} -eu "$@" echo echo awk $(pwd) echo awk x=1
+	| -eu export grep -eu "$1" then then grep | | awk ${HOME} --verbose
+"$@" done --verbose done sed 'quoted text' grep ${HOME} readonly ${HOME} 'quoted text'
+"$@" awk echo "$1" echo echo --verbose cd "$1" sed && --verbose echo
+	'quoted text' | echo echo "$@" 2>/dev/null $(pwd) $(pwd) readonly
+	"$@" 'quoted text' "$1" done then 'quoted text' ${HOME} readonly
+then "$1" "$1" then "$@" printf | grep printf cd sed then "$@"
+| $(pwd) readonly $(pwd) printf "$@" done "$1"
+printf "$1" test done "$1" "$@" -eu echo cd $(pwd) 2>/dev/null sed | --verbose
+awk done x=1 awk --verbose $(pwd)
+	readonly 'quoted text' test then | grep done local awk grep test cd 'quoted text'
+--verbose readonly --verbose
+	awk done x=1 grep test grep "$1" "$@"
+"$@" 'quoted text' test grep printf $(pwd) "$1" grep
+printf done 'quoted text' x=1 | 'quoted text'
+		"$1" && readonly ${HOME} then cd
+	awk sed readonly -eu | -eu test | x=1 && 2>/dev/null printf grep then --verbose
+| sed test local x=1 local 'quoted text'
+echo $(pwd) | printf && sed "$1" cd grep grep --verbose
+	/usr/bin x=1 readonly export done
+		"$1" cd done awk then -eu /usr/bin local test done 2>/dev/null --verbose | -eu
+then /usr/bin "$1" | "$@" "$@" cd printf
+-eu readonly 2>/dev/null then x=1 'quoted text'
+	${HOME} && x=1 grep grep sed done local
+	printf /usr/bin -eu -eu grep cd x=1 "$@" 'quoted text' printf 2>/dev/null awk done
+printf ${HOME} sed 2>/dev/null then done export | x=1 && ${HOME} "$1" -eu printf
+&& | echo local done test sed echo cd /usr/bin
+export && done awk awk readonly test echo && --verbose readonly
+		-eu sed && -eu 'quoted text' $(pwd) "$@" local /usr/bin
+readonly ${HOME} | x=1 'quoted text' | done export
+		then grep then ${HOME} test done test printf x=1 ${HOME}
+		'quoted text' 2>/dev/null "$@" readonly ${HOME} sed x=1 /usr/bin "$@"
+	&& cd printf "$1" "$1" then grep
+		cd 'quoted text' done 2>/dev/null
+	/usr/bin 2>/dev/null readonly 'quoted text' && awk 2>/dev/null then
+grep -eu then local readonly x=1 "$1" /usr/bin done printf
+	test readonly then 'quoted text'
+x=1 "$@" readonly then test sed 'quoted text' --verbose
@@ -0,0 +1,2001 @@
+grep /usr/bin grep ${HOME} grep printf cd
+2>/dev/null test -eu 2>/dev/null -eu test --verbose grep x=1
+	awk sed 'quoted text' echo "$@" 'quoted text' sed && local "$@" cd awk "$@" grep
+		done --verbose -eu test
+	$(pwd) done local grep done "$1" x=1 then $(pwd) --verbose
+	"$@" /usr/bin "$1" test cd --verbose
+	test awk 2>/dev/null | 2>/dev/null cd cd "$1" sed echo --verbose
+		--verbose $(pwd) x=1 ${HOME} grep $(pwd) done printf local readonly
+printf /usr/bin readonly echo -eu
+awk && export then cd "$@" 'quoted text'
+$(pwd) "$@" -eu printf 'quoted text' printf export local $(pwd)
+		"$@" x=1 done local export 2>/dev/null 'quoted text'
+		-eu readonly then echo 'quoted text' 'quoted text'
+	-eu x=1 cd "$@" 2>/dev/null "$@" $(pwd) readonly grep
+		"$1" ${HOME} grep 'quoted text' /usr/bin
+/usr/bin printf then x=1 sed export | echo "$@"
+	&& --verbose readonly local grep 2>/dev/null done
+cd 2>/dev/null 'quoted text'
+awk --verbose echo && awk -eu
+		grep cd "$1" done export "$1"
+		--verbose --verbose awk ${HOME} && export cd x=1 $(pwd)
+		2>/dev/null done then ${HOME}
+	$(pwd) "$1" awk local awk x=1 grep -eu then then done then --verbose
+		"$@" && 'quoted text' awk | printf grep local local 'quoted text' ${HOME} test
+		done printf local | awk grep "$@" --verbose
+	done 2>/dev/null local test $(pwd) sed then "$1" cd echo echo 'quoted text'
+	awk && ${HOME} export x=1 2>/dev/null
+		| echo export grep 2>/dev/null $(pwd)
+		awk echo /usr/bin sed test 2>/dev/null printf printf /usr/bin --verbose sed
+awk | grep grep printf then 2>/dev/null
+done local sed readonly
+		${HOME} x=1 /usr/bin local grep /usr/bin then x=1 printf export then | ${HOME}
+'quoted text' local awk printf then grep echo
+	'quoted text' /usr/bin sed | export
+	sed test $(pwd) ${HOME} echo test
+	export done --verbose test
+printf x=1 --verbose done echo cd
+echo && -eu --verbose /usr/bin readonly
+		"$1" /usr/bin && 'quoted text'
+	"$@" 2>/dev/null done 2>/dev/null "$1" echo "$@" readonly
+	/usr/bin then cd ${HOME} 'quoted text' x=1 readonly "$1" $(pwd) "$1" $(pwd)
+awk readonly cd printf --verbose "$@"
+echo && export local "$@" echo grep --verbose -eu --verbose local printf test
+local local -eu printf then grep | local -eu 'quoted text'
+		"$@" "$@" sed "$@" local ${HOME} then
+		export /usr/bin /usr/bin "$1" 2>/dev/null "$1" x=1 | | export
+&& export export cd grep && 'quoted text' | sed | export
+		readonly printf ${HOME} cd awk --verbose /usr/bin echo
+&& export -eu -eu done then x=1 local ${HOME} x=1 grep x=1 | test 'quoted text'
+echo /usr/bin echo test grep /usr/bin
+		then cd ${HOME} 'quoted text' done export
+	local -eu "$1" cd echo && cd ${HOME} sed
+		${HOME} readonly local test $(pwd) && ${HOME} grep grep -eu readonly test done
+		/usr/bin test grep --verbose x=1 /usr/bin echo sed && awk sed "$@"
+done ${HOME} ${HOME}
+	then awk "$1" ${HOME} echo ${HOME}
+		/usr/bin printf grep test
+	done | done | echo "$1" printf cd then local && -eu printf cd && grep
+2>/dev/null "$@" test && grep $(pwd) --verbose
+		cd grep && grep "$@" --verbose sed -eu then printf then readonly
+/usr/bin test local /usr/bin /usr/bin
+-eu -eu grep done -eu echo
+	/usr/bin /usr/bin sed --verbose /usr/bin 'quoted text' 2>/dev/null
+	-eu awk awk x=1 test --verbose
+		sed grep "$1" "$1" done echo then export sed export
+		${HOME} sed cd grep /usr/bin | awk
+test && /usr/bin sed done x=1 "$1" then 'quoted text' | awk then "$@"
+	done grep && x=1 done printf
+	echo grep "$@" local "$@" then awk 2>/dev/null printf
+awk awk && local grep $(pwd) $(pwd)
+		test export then printf "$1" "$1"
+echo "$@" /usr/bin awk -eu cd export "$1" 'quoted text' "$@" "$@" test
+printf printf export test x=1 "$1" 2>/dev/null printf test
+x=1 /usr/bin export x=1 done export export sed "$@"
+	readonly test printf then grep echo -eu
+	cd grep test grep test done "$@"
+	cd /usr/bin grep ${HOME} 'quoted text' done $(pwd)
+	$(pwd) ${HOME} echo | x=1 local "$1" "$@"
+	$(pwd) grep --verbose | --verbose
+		'quoted text' ${HOME} sed -eu -eu cd sed -eu sed cd cd echo
+${HOME} export "$@" 2>/dev/null && | $(pwd) -eu
+	test "$@" export | awk
+	sed echo done echo "$1" 'quoted text' grep echo cd 'quoted text'
+"$1" -eu done grep printf x=1
+${HOME} sed printf done /usr/bin grep ${HOME} $(pwd) awk readonly
+--verbose | 'quoted text'
+	echo cd | /usr/bin 'quoted text' export "$1" "$@" echo | /usr/bin test
+	--verbose 'quoted text' "$@" 2>/dev/null sed printf
+"$1" | ${HOME} && 2>/dev/null awk 'quoted text' $(pwd) --verbose cd echo grep
+	done done echo grep --verbose "$@" cd "$@" test -eu ${HOME} echo /usr/bin
+		| "$@" grep sed cd /usr/bin cd | 2>/dev/null sed && test 2>/dev/null
+		test cd echo --verbose grep sed && "$1" cd x=1 "$@" done
+	$(pwd) ${HOME} "$1" x=1 export /usr/bin 2>/dev/null 'quoted text' grep done
+	'quoted text' /usr/bin -eu
+	printf export 2>/dev/null 'quoted text' grep readonly "$@" awk "$@" 'quoted text'
+	export done 'quoted text' export grep then then export echo echo cd 2>/dev/null
+test test ${HOME} x=1 $(pwd) then export && x=1 local readonly
+'quoted text' 'quoted text' done then $(pwd) export -eu 2>/dev/null x=1 cd sed
+	'quoted text' cd grep done
+	| then grep 'quoted text' export
+	x=1 then local | "$1" grep -eu "$@" grep grep /usr/bin printf printf printf sed
+cd local 2>/dev/null echo awk --verbose sed readonly "$1" local
+	x=1 then x=1 cd | printf export "$@" 'quoted text' cd
+		$(pwd) /usr/bin -eu | export
+	sed grep readonly export local
+	${HOME} readonly --verbose grep
+then $(pwd) done "$1" test
+		-eu then 'quoted text' /usr/bin echo
+cd "$1" export local then local "$@" then 2>/dev/null test | local cd
+	then "$@" printf test cd readonly
+&& /usr/bin done cd grep test then
+	"$@" $(pwd) -eu 2>/dev/null
+--verbose grep printf "$@" ${HOME} -eu && grep ${HOME} 2>/dev/null readonly
+	grep | x=1 ${HOME} export echo then -eu local echo 2>/dev/null
+		cd readonly cd ${HOME} "$@" readonly local done 'quoted text' done local 2>/dev/null
+		${HOME} test "$@" x=1 x=1 --verbose
+		local local grep test x=1 printf export readonly
+$(pwd) export ${HOME} x=1 printf then sed grep printf -eu export $(pwd) sed "$1"
+		readonly grep 'quoted text' -eu "$@"
+		then printf echo sed "$@" -eu test printf
+sed --verbose /usr/bin done $(pwd) done && /usr/bin
+export cd $(pwd) "$1" && done then ${HOME} -eu echo /usr/bin
+sed x=1 local cd awk x=1 "$1" -eu
+		2>/dev/null awk | done | /usr/bin export
+	"$1" "$1" awk x=1 grep /usr/bin 2>/dev/null echo | export
+sed ${HOME} x=1 && readonly
+	"$1" 2>/dev/null printf cd grep -eu 2>/dev/null echo test -eu cd grep --verbose
+	local /usr/bin then local readonly echo sed test --verbose cd && readonly &&
+	test grep local "$@" export
+	/usr/bin then cd "$1" 2>/dev/null x=1 x=1 x=1 export echo echo
+		printf "$@" && then printf | ${HOME} ${HOME} $(pwd) local 'quoted text' local
+/usr/bin echo 'quoted text' then --verbose printf done echo | done --verbose
+	echo grep "$1" $(pwd) printf --verbose
+		2>/dev/null local printf "$1" test -eu local
+	/usr/bin "$1" sed "$1" --verbose readonly | cd /usr/bin x=1 grep ${HOME}
+	&& --verbose 'quoted text'
+cd then /usr/bin 'quoted text'
+	/usr/bin x=1 cd --verbose sed export readonly sed cd 'quoted text' local awk 'quoted text'
+		export 'quoted text' | x=1 "$@" --verbose /usr/bin local
+		local done sed ${HOME} echo 'quoted text' && export --verbose 2>/dev/null
+test $(pwd) -eu /usr/bin ${HOME} echo --verbose $(pwd) test -eu && x=1 then
+		${HOME} printf $(pwd) /usr/bin "$@" done cd | | export "$@" echo -eu
+	x=1 done grep "$1" test /usr/bin then -eu -eu 2>/dev/null | --verbose
+	&& done local grep 'quoted text' grep
+	then awk echo done echo done ${HOME} echo && --verbose local /usr/bin && "$@"
+		then local test $(pwd) 2>/dev/null export echo
+	done /usr/bin ${HOME} then awk $(pwd) --verbose 2>/dev/null &&
+		-eu ${HOME} && --verbose 2>/dev/null -eu sed
+	awk done 'quoted text'
+		x=1 "$@" then /usr/bin --verbose done awk -eu done 2>/dev/null
+	export readonly readonly --verbose done test
+	'quoted text' readonly 2>/dev/null
+printf echo done x=1 done local test test
+		readonly awk "$1" local x=1 echo readonly readonly $(pwd) /usr/bin x=1
+	&& -eu /usr/bin 'quoted text' /usr/bin x=1
+-eu echo /usr/bin test /usr/bin cd 2>/dev/null grep $(pwd) printf
+x=1 "$1" 2>/dev/null local
+		local done local ${HOME} 2>/dev/null x=1 test awk -eu done 'quoted text'
+	local export then -eu then &&
+	--verbose printf echo 'quoted text' readonly test cd "$1"
+	then readonly sed -eu awk awk cd ${HOME} grep
+export done test then ${HOME} --verbose ${HOME} ${HOME}
+echo grep grep 'quoted text' /usr/bin done x=1 done | cd
+	readonly readonly printf awk printf $(pwd) -eu
+	"$1" | x=1 export then $(pwd) ${HOME} grep -eu &&
+		x=1 "$1" sed ${HOME} -eu printf "$@"
+		echo cd local "$1" grep then export "$@" awk /usr/bin awk x=1 cd
+		cd awk "$@" ${HOME} x=1 then 'quoted text'
+		2>/dev/null printf "$@" readonly test ${HOME} 'quoted text' | --verbose awk 2>/dev/null
+	/usr/bin | then sed printf | ${HOME} awk && $(pwd) local then then --verbose
+2>/dev/null 'quoted text' x=1 "$@" 2>/dev/null | readonly
+	readonly then readonly awk
+"$1" 'quoted text' readonly
+		echo readonly test $(pwd) $(pwd) test x=1 -eu test
+$(pwd) && "$@" /usr/bin ${HOME} cd $(pwd) ${HOME} x=1 readonly
+		"$@" 2>/dev/null && $(pwd) printf /usr/bin readonly then printf 2>/dev/null
+export export -eu grep then printf && ${HOME} ${HOME} "$@"
+2>/dev/null "$@" | printf -eu grep "$@" readonly ${HOME} $(pwd) | ${HOME}
+'quoted text' 'quoted text' awk
+then sed /usr/bin "$@" export ${HOME} printf
+"$1" -eu && "$@" done local 2>/dev/null sed
+-eu local awk done export -eu "$@" awk
+cd x=1 -eu "$1" sed 'quoted text' --verbose readonly export && cd && local -eu
+		cd grep | --verbose cd echo readonly test
+	then printf ${HOME} echo echo done 'quoted text' "$1" done x=1 cd
+test echo /usr/bin && | local awk ${HOME} printf
+	-eu 'quoted text' -eu "$@" export awk $(pwd) test && 2>/dev/null
+echo | export -eu grep "$@" echo grep $(pwd)
+	test "$1" grep "$1" readonly readonly readonly cd sed printf 'quoted text' test
+		test "$1" echo readonly export x=1 awk readonly readonly sed $(pwd) cd awk sed
+	then readonly ${HOME} export sed
+then test grep printf | ${HOME} grep 'quoted text' sed "$@" grep printf "$@" cd
+	'quoted text' readonly local "$@" echo ${HOME} "$@" | | readonly x=1 && local
+		"$1" cd echo && $(pwd) "$@" 'quoted text' sed printf export |
+grep done sed $(pwd) $(pwd)
+"$1" 2>/dev/null cd "$1" readonly $(pwd) printf printf
+then echo printf "$1" -eu /usr/bin x=1 awk
+		'quoted text' 'quoted text' test readonly
+	then "$@" local grep 'quoted text'
+then "$1" echo cd then sed && sed
+		local | readonly cd x=1 'quoted text' "$1" readonly ${HOME} export printf
+		export then "$1" sed awk done sed "$1" ${HOME} sed local
+		-eu /usr/bin cd x=1 | x=1 then printf
+		2>/dev/null readonly | "$@" local test cd ${HOME} grep grep && /usr/bin grep ${HOME}
+	2>/dev/null done cd 'quoted text' "$1" awk x=1 --verbose test 2>/dev/null test test
+		echo $(pwd) readonly awk "$@" 2>/dev/null then "$@" /usr/bin $(pwd) then then export
+printf export printf done 'quoted text' sed echo export "$@" "$1"
+grep test readonly /usr/bin printf 2>/dev/null
+	cd test test -eu 'quoted text' cd 'quoted text'
+	| grep 'quoted text' 'quoted text' printf printf printf 2>/dev/null printf readonly
+		cd readonly export local readonly printf -eu /usr/bin local
+		awk then local $(pwd) test /usr/bin
+	then cd then 'quoted text' export local "$@"
+		then printf /usr/bin grep /usr/bin $(pwd)
+then export /usr/bin 'quoted text' && ${HOME} sed "$1" echo x=1 echo ${HOME}
+		echo $(pwd) done 'quoted text' done -eu 'quoted text'
+2>/dev/null 'quoted text' --verbose export done x=1 readonly x=1 export
+then && $(pwd) && $(pwd) 'quoted text' 'quoted text'
+		&& export cd 'quoted text' test readonly local cd test "$@" done
+	sed echo && done cd then | x=1 -eu -eu 'quoted text' awk echo /usr/bin
+		&& -eu local printf cd x=1 echo
+	grep && then cd readonly $(pwd) 2>/dev/null export export 'quoted text' --verbose
+		readonly 2>/dev/null then test --verbose grep
+	then export $(pwd) && ${HOME} 2>/dev/null echo test "$@" 'quoted text' | export
+		done 'quoted text' $(pwd) local
+	cd sed 'quoted text' "$1" x=1 done "$1" "$1"
+	done --verbose done sed ${HOME} then
+	x=1 awk readonly awk "$@" then then cd local
+		export awk cd echo done | export 'quoted text' echo $(pwd)
+done done "$@" cd ${HOME} sed -eu printf
+		--verbose --verbose test && test -eu
+		/usr/bin ${HOME} awk ${HOME} "$1" x=1 then "$1" readonly
+		readonly "$@" then --verbose $(pwd) ${HOME} "$@" "$@"
+	test x=1 "$1" 2>/dev/null "$1" local && x=1
+export echo "$@" $(pwd) cd sed "$@" --verbose
+	export grep export --verbose x=1 /usr/bin cd x=1 readonly
+	--verbose --verbose "$@" sed local
+		done printf sed printf then cd
+		grep sed "$1" 2>/dev/null done cd 2>/dev/null
+	awk ${HOME} | "$@" grep test readonly && printf grep echo
+		'quoted text' "$1" sed then | readonly echo then $(pwd)
+	--verbose sed "$@" cd 2>/dev/null "$1" $(pwd) 'quoted text' awk then
+		test then $(pwd) 'quoted text' &&
+printf cd "$1" --verbose $(pwd) && 'quoted text'
+	test then local $(pwd) printf export && printf test --verbose sed /usr/bin
+$(pwd) done done --verbose test sed && test then -eu /usr/bin && sed && awk
+-eu sed readonly ${HOME} grep cd sed local printf -eu export done &&
+	printf then printf 2>/dev/null /usr/bin grep test /usr/bin
+		then done "$@" echo /usr/bin
+done $(pwd) && "$1" echo grep done then
+--verbose then x=1 $(pwd)
+	done "$@" 2>/dev/null printf --verbose x=1 printf --verbose
+/usr/bin printf echo local --verbose readonly export x=1 export && && -eu awk
+&& done $(pwd) ${HOME} | x=1 done awk printf 2>/dev/null then grep printf
+		x=1 awk then grep local grep $(pwd)
+	done grep sed cd cd sed | ${HOME} grep x=1
+"$1" then --verbose grep printf echo cd local "$@" awk 'quoted text' cd printf
+		"$1" done sed 2>/dev/null --verbose && 2>/dev/null /usr/bin && --verbose
+		readonly "$1" cd 2>/dev/null grep echo -eu x=1 sed | echo
+	cd /usr/bin x=1 $(pwd) local -eu test cd --verbose awk $(pwd) export echo echo
+		${HOME} test test awk local |
+	2>/dev/null --verbose -eu done && printf &&
+		"$@" "$1" export --verbose $(pwd) printf echo "$1" "$1" x=1 | readonly &&
+	done 2>/dev/null local "$@" then
+	-eu "$1" sed "$@" echo printf export $(pwd) cd /usr/bin && awk
+	--verbose awk "$@" --verbose
+	"$1" $(pwd) 'quoted text' "$@" grep /usr/bin
+		printf done "$@" awk readonly -eu cd &&
+grep -eu 'quoted text' /usr/bin
+		'quoted text' "$1" "$1" readonly $(pwd) 2>/dev/null -eu $(pwd) cd export done readonly
+		sed 'quoted text' "$@" awk --verbose -eu echo
+		then printf "$@" 'quoted text' test 2>/dev/null ${HOME} x=1 "$@" 'quoted text'
+		| cd sed "$@" done x=1 'quoted text' grep "$@"
+&& local x=1 echo 2>/dev/null echo printf export --verbose /usr/bin
+	| printf cd 2>/dev/null $(pwd) x=1 "$@" x=1 awk | grep 2>/dev/null
+		$(pwd) test printf printf test 2>/dev/null
+		2>/dev/null 'quoted text' -eu "$@" readonly --verbose
+readonly x=1 echo | 'quoted text' grep ${HOME} /usr/bin x=1 awk $(pwd)
+	export ${HOME} test --verbose readonly cd sed
+$(pwd) grep awk "$@" 'quoted text' && sed awk echo awk
+	"$1" export printf test /usr/bin /usr/bin sed 'quoted text' x=1
+		| | x=1 2>/dev/null "$@" export
+		--verbose done ${HOME} -eu "$1" awk /usr/bin export -eu x=1 --verbose 2>/dev/null
+	done /usr/bin "$@" grep "$@" sed | ${HOME}
+	then "$@" | 'quoted text' x=1 2>/dev/null $(pwd) $(pwd)
+	| 'quoted text' x=1 | 'quoted text'
+	done export test --verbose export "$@" "$@"
+		grep | then && -eu && test done -eu readonly test local | sed $(pwd) 2>/dev/null
+${HOME} cd local x=1 "$@" --verbose export /usr/bin 2>/dev/null
+		then printf && local
+		test $(pwd) readonly $(pwd) echo local && local && x=1 sed
+		-eu printf export printf grep local echo sed | x=1 && ${HOME} "$@"
+sed 'quoted text' "$1" && && 2>/dev/null test | "$1" | done -eu grep
+		echo echo /usr/bin readonly /usr/bin cd "$@" $(pwd) cd 2>/dev/null --verbose
+"$1" done 'quoted text' -eu "$@" 2>/dev/null
+	&& 'quoted text' then x=1 "$@" printf printf export readonly -eu x=1 --verbose
+		x=1 x=1 -eu export 2>/dev/null readonly echo test echo export export -eu -eu $(pwd)
+${HOME} 'quoted text' /usr/bin done /usr/bin done local printf readonly
+		&& --verbose export "$1" export /usr/bin $(pwd) | printf x=1
+x=1 cd x=1 -eu "$1" -eu export grep printf 'quoted text' readonly local $(pwd)
+		--verbose echo printf
+	&& --verbose 2>/dev/null && test
+		"$1" awk local printf local && test
+		printf cd test -eu test cd test $(pwd) printf
+	echo done local $(pwd) --verbose sed
+&& 'quoted text' 'quoted text'
+&& test cd done | ${HOME} printf sed readonly /usr/bin
+	"$@" local then local test $(pwd)
+		/usr/bin export "$@" awk export 2>/dev/null /usr/bin grep 2>/dev/null
+awk "$1" | readonly "$@" 2>/dev/null 2>/dev/null sed "$@"
+		local export awk test /usr/bin x=1 done 2>/dev/null | done then
+	printf test /usr/bin awk
+	readonly 'quoted text' sed echo test "$1" /usr/bin "$1" done "$1"
+		--verbose then readonly
+	"$@" /usr/bin readonly sed -eu "$@" -eu local "$@" echo readonly test
+	${HOME} export sed then "$1" export local echo ${HOME} && done 'quoted text'
+	cd | test awk "$1" 2>/dev/null -eu 'quoted text' 'quoted text'
+awk readonly sed then && 2>/dev/null
+		&& x=1 cd --verbose export $(pwd) readonly -eu then 2>/dev/null cd | echo
+readonly printf grep 'quoted text' $(pwd) done /usr/bin
+	cd printf --verbose && awk "$@" 'quoted text'
+printf readonly export grep "$1" -eu awk 2>/dev/null $(pwd) |
+		cd 'quoted text' local done $(pwd) ${HOME} && -eu echo 2>/dev/null ${HOME}
+	"$@" x=1 awk | awk sed readonly readonly awk local /usr/bin
+printf awk echo awk export local cd
+&& --verbose test --verbose done
+		"$@" 'quoted text' cd cd
+	| && --verbose cd test
+	printf grep printf x=1 $(pwd) local local 2>/dev/null x=1
+		test ${HOME} export x=1 'quoted text' -eu sed local /usr/bin --verbose
+	export printf ${HOME} readonly --verbose 2>/dev/null readonly awk /usr/bin
+$(pwd) /usr/bin cd | readonly readonly test 'quoted text' /usr/bin
+printf /usr/bin x=1 "$1" | --verbose
+		&& ${HOME} --verbose /usr/bin echo awk awk echo
+grep 2>/dev/null "$@" grep test
+readonly grep sed test done test grep grep | echo readonly
+awk grep "$1" echo awk /usr/bin export 2>/dev/null then 2>/dev/null
+awk /usr/bin $(pwd) /usr/bin done echo "$1" | sed cd ${HOME} ${HOME} then
+		"$1" 'quoted text' "$@" "$1" sed ${HOME} | /usr/bin
+		local echo --verbose readonly readonly --verbose test --verbose
+	&& "$@" done sed echo awk test export && test test
+	done 2>/dev/null $(pwd) -eu 2>/dev/null sed local
+	printf $(pwd) && echo grep "$1" -eu export
+	awk "$@" cd -eu "$1" done cd $(pwd) "$1" test "$@" --verbose
+sed -eu "$@" export "$@" echo $(pwd) awk 'quoted text'
+		x=1 --verbose export cd 2>/dev/null ${HOME}
+export --verbose -eu && printf --verbose
+awk 'quoted text' ${HOME} sed printf | done awk grep /usr/bin done
+$(pwd) /usr/bin ${HOME} x=1 then export | export
+		printf grep x=1 done readonly
+grep cd then local "$@" cd && test
+	2>/dev/null export | then x=1 2>/dev/null $(pwd) 'quoted text' -eu ${HOME}
+test && echo 2>/dev/null
+	cd local "$1" echo && 'quoted text' ${HOME} local
+	-eu export test /usr/bin then awk "$@" $(pwd) $(pwd)
+		test test sed "$@" ${HOME} printf x=1
+x=1 $(pwd) "$1" cd readonly && 2>/dev/null -eu local echo
+		${HOME} local readonly --verbose
+		"$@" echo "$@" /usr/bin echo done export done cd --verbose 'quoted text' then
+	"$1" "$1" readonly then printf grep 'quoted text' x=1 | echo awk echo export
+2>/dev/null readonly printf x=1 sed printf
+echo && x=1 'quoted text'
+&& sed then "$@" 2>/dev/null
+grep test --verbose "$1" 2>/dev/null
+		/usr/bin awk echo --verbose ${HOME} -eu 'quoted text'
+		&& -eu printf && test printf printf export | --verbose done test grep 2>/dev/null
+		/usr/bin 2>/dev/null | 'quoted text' done --verbose readonly done | /usr/bin test
+	grep && done $(pwd) then cd -eu readonly &&
+then then x=1 2>/dev/null awk --verbose $(pwd) 2>/dev/null echo
+		echo done --verbose printf --verbose --verbose
+		then readonly /usr/bin ${HOME} /usr/bin
+	${HOME} ${HOME} cd 'quoted text'
+		cd && export ${HOME} local x=1
+	--verbose 'quoted text' cd x=1 && done "$@" readonly awk cd "$@" 'quoted text'
+	awk readonly awk && done echo x=1 $(pwd) $(pwd)
+		done ${HOME} local then local 2>/dev/null
+${HOME} local test printf --verbose | x=1 ${HOME} echo cd
+x=1 cd /usr/bin --verbose readonly
+	x=1 2>/dev/null 'quoted text' echo
+		| awk "$1" -eu ${HOME} echo cd "$@" done
+	'quoted text' done -eu ${HOME}
+	'quoted text' then $(pwd) && "$1" "$@" ${HOME} 'quoted text'
+"$@" x=1 sed done $(pwd) -eu /usr/bin | sed ${HOME}
+	done | printf "$@" $(pwd)
+2>/dev/null 2>/dev/null
+echo $(pwd) x=1 done echo 2>/dev/null grep then sed
+awk sed --verbose "$1" | "$1" then test sed && /usr/bin /usr/bin 'quoted text'
+'quoted text' readonly test | readonly done --verbose x=1 readonly test --verbose
+	-eu echo 'quoted text' /usr/bin ${HOME} -eu "$@" test export grep
+	cd cd export "$1" cd grep -eu printf cd readonly test test
+	${HOME} printf ${HOME} "$1" -eu | echo $(pwd) && then "$1" && /usr/bin then 2>/dev/null
+	${HOME} "$1" printf printf echo "$1" /usr/bin sed 'quoted text' test
+		/usr/bin ${HOME} $(pwd)
+${HOME} readonly x=1 then grep then then cd 2>/dev/null grep done |
+	cd 2>/dev/null ${HOME} && 'quoted text' export grep x=1 | ${HOME} /usr/bin
+	| | export sed test x=1 printf ${HOME} ${HOME}
+		cd sed grep x=1 cd awk --verbose -eu --verbose 'quoted text' -eu 2>/dev/null
+		sed --verbose --verbose done then $(pwd) | cd sed ${HOME} x=1
+		readonly test | | cd readonly && local grep readonly cd 'quoted text' 2>/dev/null
+	| sed "$@" then done printf export
+		'quoted text' readonly 'quoted text' ${HOME} local sed $(pwd) echo /usr/bin
+/usr/bin readonly grep
+	done | 2>/dev/null && grep ${HOME} x=1 2>/dev/null printf --verbose
+	done done "$@" -eu --verbose -eu 2>/dev/null sed ${HOME} && sed ${HOME} 'quoted text'
+		2>/dev/null 'quoted text' -eu 'quoted text'
+	readonly readonly sed done export | local sed --verbose test sed
+echo local test | -eu export 'quoted text'
+printf grep "$@" -eu sed sed && readonly 'quoted text'
+"$@" cd "$@" test x=1 sed 2>/dev/null x=1 /usr/bin -eu cd | --verbose
+		test --verbose /usr/bin 2>/dev/null x=1 grep && $(pwd) test sed ${HOME} cd
+		x=1 done echo export done readonly export test sed test
+	echo $(pwd) awk "$1" echo ${HOME} export export | then /usr/bin
+test local awk then test "$1" x=1 export cd echo local grep grep && sed --verbose
+grep done -eu -eu "$@" "$1" echo $(pwd) | "$1"
+2>/dev/null 2>/dev/null && 'quoted text' x=1 2>/dev/null printf "$@" "$@" printf
+	"$@" awk $(pwd) grep 'quoted text'
+		echo 2>/dev/null ${HOME} readonly awk cd 'quoted text' x=1 | grep /usr/bin
+${HOME} grep 'quoted text' | then
+	export test local x=1 cd /usr/bin ${HOME} /usr/bin
+printf echo ${HOME} -eu $(pwd) 'quoted text'
+grep --verbose local then export readonly && done cd /usr/bin sed | done awk
+	local local 'quoted text' 'quoted text' local $(pwd) | local /usr/bin 'quoted text'
+	sed echo /usr/bin --verbose cd | "$@" /usr/bin printf /usr/bin
+	done "$@" awk 2>/dev/null 'quoted text'
+cd $(pwd) test local "$@" echo
+grep -eu readonly | "$@" grep local -eu 'quoted text'
+		sed ${HOME} --verbose printf $(pwd)
+	sed $(pwd) 'quoted text' cd --verbose test "$1" printf $(pwd) $(pwd)
+grep /usr/bin grep "$1"
+$(pwd) then test "$1" grep cd test then printf x=1 ${HOME} && "$@" printf
+'quoted text' ${HOME} printf export cd && && done 2>/dev/null -eu export -eu cd
+	echo export | readonly echo cd "$@" test
+--verbose then local local then export readonly
+sed export printf sed /usr/bin done printf awk cd then echo $(pwd)
+printf readonly ${HOME} -eu printf /usr/bin awk done "$@" x=1 local /usr/bin readonly
+readonly ${HOME} 'quoted text' --verbose "$@" ${HOME} local
+		sed then printf ${HOME} | $(pwd) --verbose local sed --verbose grep 2>/dev/null
+	&& printf 'quoted text'
+	grep sed cd echo "$1" x=1
+/usr/bin export readonly x=1 export awk --verbose
+export $(pwd) 2>/dev/null | ${HOME} $(pwd) && grep sed
+	readonly ${HOME} echo | 2>/dev/null 'quoted text' awk
+	"$@" grep ${HOME} export -eu "$@" "$@" x=1 awk
+"$1" -eu "$1" --verbose echo awk printf cd 'quoted text' ${HOME}
+	"$@" local done "$1" awk $(pwd) sed local -eu 'quoted text' done
+	x=1 grep /usr/bin sed "$1" sed grep x=1 printf local printf export
+		"$@" printf ${HOME} | /usr/bin readonly "$@" x=1 | awk 2>/dev/null
+&& 'quoted text' readonly | then export printf cd | done sed
+		$(pwd) /usr/bin export echo awk cd printf $(pwd)
+readonly export | awk 'quoted text' echo
+		local done $(pwd) awk | --verbose -eu awk then x=1 'quoted text'
+test "$@" printf /usr/bin then ${HOME} ${HOME}
+		-eu 'quoted text' "$@" /usr/bin $(pwd) cd ${HOME}
+	| 2>/dev/null ${HOME} | -eu --verbose
+	export && -eu readonly && local -eu /usr/bin
+printf echo echo "$@" "$@" | export printf /usr/bin grep && --verbose 'quoted text'
+	&& export test echo 'quoted text'
+${HOME} -eu test echo readonly printf export
+local readonly "$@" then printf --verbose
+		2>/dev/null 2>/dev/null "$1" export
+echo ${HOME} done printf x=1 --verbose ${HOME} then grep ${HOME} done
+	grep "$@" sed && -eu /usr/bin --verbose then readonly export
+'quoted text' sed "$1" 'quoted text' grep echo --verbose && x=1 x=1 printf $(pwd)
+	export echo "$@" grep ${HOME} -eu test readonly cd test grep test local 2>/dev/null
+	2>/dev/null then 2>/dev/null awk $(pwd) done echo test export grep /usr/bin /usr/bin
+		"$1" readonly "$1" 2>/dev/null export ${HOME}
+		-eu ${HOME} export x=1
+		/usr/bin test -eu $(pwd) grep
+	local "$@" awk test readonly ${HOME} then then grep | 2>/dev/null $(pwd)
+		/usr/bin readonly test readonly readonly "$1"
+	2>/dev/null local done awk && "$@" ${HOME} | | local $(pwd) then x=1 printf
+| then cd readonly then -eu printf printf
+		-eu cd && -eu "$1" "$@" ${HOME} then then x=1 "$1"
+		sed && echo /usr/bin then "$@" "$1"
+test export | "$1" test done "$@" $(pwd) grep grep /usr/bin ${HOME}
+x=1 export ${HOME} export 2>/dev/null && then && grep $(pwd) export "$1" --verbose
+grep && ${HOME} then x=1 "$1" grep cd done printf --verbose "$@"
+sed 'quoted text' "$1" awk --verbose $(pwd) readonly cd 2>/dev/null
+test "$1" grep ${HOME} readonly printf /usr/bin -eu "$1" readonly
+cd | x=1 2>/dev/null then done then sed "$1"
+cd "$1" ${HOME} awk 2>/dev/null -eu grep -eu && echo $(pwd)
+	-eu /usr/bin cd local awk readonly local "$@" test local "$1" x=1
+	printf local echo done readonly
+		sed $(pwd) 'quoted text' printf grep 2>/dev/null
+"$1" echo "$@" --verbose
+		test | printf x=1 /usr/bin "$@" echo grep && 'quoted text'
+		/usr/bin readonly then x=1 local && --verbose 'quoted text' 2>/dev/null
+echo "$@" 2>/dev/null 'quoted text'
+		echo test export done "$1" readonly
+		echo sed test test echo grep
+"$1" --verbose --verbose export export
+then echo -eu x=1 $(pwd) --verbose test readonly cd /usr/bin "$1" sed
+export local && --verbose sed /usr/bin ${HOME} local --verbose $(pwd) printf /usr/bin
+	$(pwd) 2>/dev/null "$1" | ${HOME}
+2>/dev/null ${HOME} "$1" local done done -eu /usr/bin
+		${HOME} echo grep ${HOME} echo x=1 x=1 printf --verbose
+		sed echo x=1 "$1" x=1 grep printf local done local $(pwd) /usr/bin
+2>/dev/null done 2>/dev/null local export --verbose export
+printf test /usr/bin readonly x=1
+x=1 readonly x=1 -eu echo $(pwd) 2>/dev/null | /usr/bin
+done x=1 grep export "$1" export awk then then cd x=1 -eu "$1" 'quoted text'
+printf "$@" 2>/dev/null && test readonly cd --verbose
+		then "$@" test "$1" export --verbose cd 2>/dev/null
+		done echo grep $(pwd) sed then --verbose
+		cd | && sed export 'quoted text'
+		then echo 2>/dev/null grep --verbose then x=1 done 'quoted text'
+	cd ${HOME} done readonly done then
+	--verbose ${HOME} echo local /usr/bin -eu printf
+| -eu && 'quoted text' ${HOME} x=1 printf echo local $(pwd) | | ${HOME}
+		test --verbose awk awk --verbose
+	test done "$@" export local x=1 && test x=1
+		awk | x=1 --verbose sed sed sed &&
+local && $(pwd) test x=1 /usr/bin 'quoted text' /usr/bin echo
+	local $(pwd) "$@" 2>/dev/null then sed /usr/bin && --verbose sed --verbose
+		then "$1" | ${HOME} awk 'quoted text'
+/usr/bin grep readonly printf printf printf
+	printf 'quoted text' $(pwd) /usr/bin sed "$1" /usr/bin
+	| readonly --verbose test | 2>/dev/null -eu x=1 test echo echo
+	2>/dev/null -eu ${HOME} echo printf printf cd test 'quoted text'
+		awk sed ${HOME} | -eu grep 2>/dev/null
+		--verbose grep readonly awk 'quoted text' | grep export
+		&& -eu then -eu "$@" ${HOME} /usr/bin --verbose readonly x=1 done
+	export grep echo $(pwd) x=1
+	local 2>/dev/null $(pwd) printf -eu "$@" cd "$@" "$@" then then 2>/dev/null
+	-eu --verbose "$1" && awk grep readonly awk 'quoted text'
+		printf grep then then ${HOME}
+		sed --verbose -eu ${HOME} $(pwd) done && sed /usr/bin
+		-eu echo -eu printf 2>/dev/null export --verbose awk
+local sed /usr/bin sed "$@" local ${HOME} printf
+	/usr/bin export awk /usr/bin sed done "$1"
+		done test ${HOME} awk 'quoted text' test
+		then echo x=1 echo awk ${HOME} export $(pwd) ${HOME}
+		${HOME} 'quoted text' && -eu | 'quoted text'
+		&& --verbose awk && "$1" x=1 readonly readonly -eu local printf
+	&& export --verbose 2>/dev/null $(pwd) -eu --verbose -eu | "$@" sed local
+	-eu ${HOME} test awk echo 'quoted text'
+		| grep /usr/bin done cd printf
+$(pwd) export && grep 2>/dev/null x=1 |
+	then grep printf -eu printf then sed x=1 printf /usr/bin echo done 'quoted text'
+| "$@" cd 'quoted text' -eu printf 2>/dev/null
+		--verbose test printf 'quoted text' done export echo done | x=1
+		then ${HOME} && export export export 2>/dev/null 'quoted text' export ${HOME}
+		cd -eu ${HOME} cd readonly then then 2>/dev/null
+cd && 2>/dev/null /usr/bin test $(pwd) x=1 /usr/bin "$1"
+"$1" echo $(pwd) then grep grep awk && printf --verbose export --verbose
+		${HOME} "$1" readonly x=1 "$1" done 'quoted text' grep cd cd 2>/dev/null --verbose
+		'quoted text' test 'quoted text'
+/usr/bin test && then cd "$@" then
+then "$1" done 'quoted text' x=1 export echo
+	then then $(pwd) export "$1" readonly && done ${HOME}
+		readonly cd 'quoted text' then echo readonly -eu done 2>/dev/null
+done && ${HOME} && 'quoted text' echo then done grep sed "$@" "$@" --verbose done
+	2>/dev/null local $(pwd) /usr/bin cd
+	local --verbose awk 2>/dev/null
+		"$1" -eu awk 2>/dev/null local --verbose grep readonly
+	echo printf x=1 then test then 2>/dev/null 2>/dev/null then x=1 "$1" then local
+		printf && test -eu "$1" export printf 2>/dev/null x=1 export echo printf cd
+printf test test 'quoted text' awk cd grep $(pwd) echo
+	printf /usr/bin done printf "$1" "$1" | 2>/dev/null grep
+		readonly cd 2>/dev/null export 'quoted text' grep then 2>/dev/null
+| local readonly && sed x=1 awk sed | 2>/dev/null
+$(pwd) 2>/dev/null | then "$1"
+		&& x=1 ${HOME} && done readonly printf grep export 'quoted text'
+	done $(pwd) && printf 2>/dev/null 'quoted text'
+"$1" printf readonly ${HOME}
+		x=1 echo "$@" 2>/dev/null && sed $(pwd) x=1 local "$@" readonly
+		then local export /usr/bin ${HOME} $(pwd)
+--verbose readonly && awk sed echo -eu then x=1 printf sed awk
+		$(pwd) echo | -eu 'quoted text' --verbose
+	$(pwd) export 2>/dev/null
+	/usr/bin done /usr/bin $(pwd) printf export printf x=1 | 2>/dev/null
+	--verbose /usr/bin --verbose then -eu
+	readonly then /usr/bin 'quoted text' ${HOME} export test echo
+	grep grep -eu export --verbose sed awk ${HOME}
+"$@" "$@" --verbose | done --verbose
+	'quoted text' 2>/dev/null grep grep grep x=1
+	-eu && /usr/bin && sed cd export printf awk -eu sed then x=1 && export 'quoted text'
+		test cd x=1 cd x=1 readonly && $(pwd) 2>/dev/null && "$@" then printf "$@" 2>/dev/null
+	sed grep x=1 cd && --verbose then cd cd | /usr/bin $(pwd) echo
+-eu printf echo x=1 sed $(pwd) cd "$1" 2>/dev/null
+		export echo cd 2>/dev/null awk test -eu && /usr/bin "$1" sed "$1" readonly export
+	then "$1" 'quoted text' then && --verbose $(pwd) then
+	local then readonly /usr/bin then 'quoted text'
+		awk $(pwd) grep sed grep readonly echo printf
+		x=1 "$@" 'quoted text' test 'quoted text' && done awk ${HOME}
+$(pwd) export "$@" sed sed sed echo /usr/bin 'quoted text' $(pwd)
+		"$@" test /usr/bin done echo "$1"
+	&& --verbose | test --verbose --verbose 2>/dev/null
+"$1" /usr/bin sed --verbose "$@" export export "$@" && 2>/dev/null "$1" 2>/dev/null
+	then --verbose test readonly $(pwd)
+awk then grep awk done "$@"
+done echo --verbose export | cd x=1 $(pwd) export test
+		grep cd sed sed readonly cd export
+		sed test grep && cd local x=1 /usr/bin grep printf
+	readonly test 2>/dev/null | x=1 2>/dev/null | then awk then test grep
+	then 'quoted text' cd | awk done | sed echo "$@" ${HOME}
+	"$@" grep -eu sed $(pwd) sed local 'quoted text'
+	then && local $(pwd) "$@" grep local ${HOME} export printf export test
+		readonly $(pwd) -eu && then x=1 then test printf
+awk && 'quoted text' | awk 2>/dev/null | grep cd && --verbose && test printf
+"$@" 'quoted text' 2>/dev/null $(pwd)
+		cd ${HOME} sed --verbose echo 2>/dev/null
+		test "$1" awk "$1" readonly local readonly 2>/dev/null
+done 2>/dev/null ${HOME} export done
+		local done readonly "$@" -eu && done /usr/bin grep then 'quoted text'
+	/usr/bin 'quoted text' cd | 2>/dev/null awk grep
+"$1" readonly "$@" 2>/dev/null
+		echo -eu /usr/bin export readonly
+		$(pwd) --verbose sed "$@" sed readonly printf readonly ${HOME}
+	--verbose | x=1 x=1 | 2>/dev/null $(pwd) printf
+then done printf readonly /usr/bin --verbose test awk | /usr/bin | --verbose
+		'quoted text' readonly "$@" sed 'quoted text'
+then /usr/bin --verbose done awk | "$@" then
+grep sed local export sed printf x=1 then | x=1
+		sed local x=1 'quoted text' x=1 2>/dev/null
+"$1" echo local then | local 'quoted text' --verbose
+${HOME} awk done awk ${HOME} test
+done /usr/bin ${HOME} ${HOME} "$@" sed $(pwd) $(pwd) | 'quoted text' "$@" 'quoted text'
+	export then grep "$1" done "$1" "$1" "$@" done $(pwd) printf $(pwd)
+		echo ${HOME} readonly ${HOME} /usr/bin grep && --verbose awk /usr/bin
+	${HOME} ${HOME} printf export 2>/dev/null awk "$1" /usr/bin "$@" 'quoted text'
+test x=1 "$1" local test readonly x=1 cd echo readonly awk 2>/dev/null test x=1
+		/usr/bin 2>/dev/null done local cd 2>/dev/null /usr/bin && echo sed
+	export awk x=1 then $(pwd) local 'quoted text' test && done
+		| "$1" && test | grep && then && | 2>/dev/null --verbose
+${HOME} test "$@" echo cd x=1 | test test printf | then 'quoted text'
+	-eu cd test export test --verbose -eu then cd readonly x=1 echo "$@"
+	"$1" grep "$1" done awk done grep /usr/bin "$1" 'quoted text'
+"$1" | then sed && ${HOME} -eu "$@" $(pwd) echo
+awk grep awk cd test 'quoted text' grep /usr/bin sed export --verbose
+then 'quoted text' export ${HOME} -eu --verbose
+	&& local export ${HOME} grep --verbose /usr/bin
+done readonly ${HOME} grep printf sed -eu readonly
+--verbose then ${HOME} /usr/bin | export export test awk x=1 cd --verbose export
+cd local /usr/bin test test
+	&& 'quoted text' local local grep --verbose $(pwd) && export "$@"
+${HOME} | ${HOME} 'quoted text' 2>/dev/null sed -eu | 2>/dev/null
+echo 'quoted text' --verbose $(pwd) -eu ${HOME}
+	printf test cd "$1" 'quoted text' test | 2>/dev/null export -eu
+	${HOME} local local readonly grep 'quoted text' 2>/dev/null then echo -eu sed --verbose
+"$1" cd test "$@" export done 2>/dev/null -eu --verbose printf
+		"$1" done printf export x=1
+		'quoted text' local then
+		readonly "$1" ${HOME} "$1" 'quoted text'
+	done --verbose ${HOME} sed "$1" done then
+	'quoted text' echo $(pwd) && $(pwd) && echo /usr/bin $(pwd) $(pwd) x=1 local --verbose
+		/usr/bin export 2>/dev/null "$@" "$@" echo awk /usr/bin | x=1
+	echo readonly awk local readonly local cd "$@" then ${HOME} $(pwd) "$@" 2>/dev/null
+local sed 'quoted text' /usr/bin 2>/dev/null done $(pwd)
+		sed grep test export -eu "$@" printf then "$@" | ${HOME} $(pwd) test local
+	cd x=1 local x=1 && 'quoted text'
+--verbose then then awk awk -eu x=1 done grep /usr/bin && echo -eu
+		readonly echo "$@" 'quoted text' ${HOME} ${HOME} $(pwd) echo done
+grep 'quoted text' test local printf "$@" printf readonly sed readonly "$@" then
+	local -eu x=1 readonly
+test $(pwd) 2>/dev/null cd awk && sed --verbose awk 'quoted text' 'quoted text'
+	--verbose grep test | x=1 && 2>/dev/null
+	local cd test 'quoted text'
+	readonly && && readonly --verbose "$@" | && $(pwd) "$1" export
+		$(pwd) then "$@" local && /usr/bin readonly "$1"
+	"$@" "$@" -eu done done printf cd sed "$@" then then echo
+	--verbose export local ${HOME} cd --verbose
+printf 2>/dev/null 2>/dev/null awk grep cd -eu grep done
+		test echo local && $(pwd) printf "$1" /usr/bin echo
+test -eu 2>/dev/null sed sed test $(pwd) -eu done "$1" awk cd |
+local x=1 cd then 'quoted text' x=1 2>/dev/null
+		sed test cd /usr/bin /usr/bin grep test "$@" && printf
+		grep local test 2>/dev/null /usr/bin --verbose grep
+$(pwd) grep grep 2>/dev/null readonly echo ${HOME} /usr/bin test sed && 'quoted text'
+-eu "$@" grep export readonly "$1" -eu "$@" x=1 -eu readonly
+		'quoted text' local printf 2>/dev/null awk printf ${HOME} done ${HOME} sed
+		export $(pwd) awk -eu cd awk then 'quoted text' test -eu then
+		--verbose --verbose ${HOME} ${HOME} "$@" "$1" readonly $(pwd) cd done export
+	-eu x=1 'quoted text' | && "$1" grep test
+		"$1" ${HOME} sed test local 2>/dev/null grep grep grep $(pwd) "$1" local 'quoted text'
+awk | sed && && grep grep then x=1 | 'quoted text' "$1" && sed /usr/bin | local
+	/usr/bin awk grep | $(pwd) | ${HOME} --verbose export && cd printf test sed
+	awk export | && cd | grep grep --verbose
+	x=1 $(pwd) grep readonly 2>/dev/null test ${HOME} --verbose 'quoted text' ${HOME}
+&& --verbose cd --verbose -eu $(pwd) |
+	echo $(pwd) "$@" grep printf cd -eu | && readonly local "$1"
+		/usr/bin export echo local grep ${HOME} /usr/bin $(pwd)
+		--verbose printf "$@" cd grep readonly -eu
+		--verbose echo $(pwd) | "$@"
+/usr/bin -eu --verbose printf local 'quoted text' --verbose --verbose printf
+${HOME} /usr/bin "$@" 2>/dev/null "$1" awk grep test test cd sed
+x=1 x=1 awk cd $(pwd) $(pwd) $(pwd)
+export -eu grep --verbose ${HOME} test | x=1 /usr/bin /usr/bin && cd grep
+	$(pwd) awk test 'quoted text' echo
+done "$@" 'quoted text' /usr/bin export echo --verbose | cd
+		sed then sed x=1 x=1 ${HOME} /usr/bin 'quoted text'
+grep -eu local export export test grep $(pwd) echo
+	"$@" | printf x=1 test | ${HOME} grep -eu --verbose | "$@" 'quoted text'
+		$(pwd) 2>/dev/null printf readonly local echo $(pwd) &&
+		then echo "$1" sed ${HOME} ${HOME} $(pwd) -eu "$1" printf sed -eu ${HOME}
+	done local -eu done awk local
+test echo readonly cd readonly x=1 printf ${HOME} | "$@" 'quoted text'
+	awk cd /usr/bin && --verbose done x=1
+		then echo -eu echo awk --verbose grep 'quoted text'
+		printf sed | test -eu x=1 "$@" |
+		&& readonly echo | local && | export sed && $(pwd) /usr/bin
+		x=1 ${HOME} test "$1" ${HOME} /usr/bin "$1" x=1 ${HOME} test |
+		then /usr/bin --verbose
+echo done grep readonly | --verbose ${HOME}
+	"$@" done then 2>/dev/null readonly
+"$@" "$@" local "$@" "$1" then "$@" 'quoted text'
+${HOME} readonly --verbose cd readonly then /usr/bin x=1 2>/dev/null -eu done awk
+printf --verbose sed | export grep && "$1" "$1"
+		$(pwd) /usr/bin && cd x=1 local | 'quoted text' printf
+echo export -eu | --verbose x=1
+cd grep local x=1 | echo awk echo ${HOME} printf done 'quoted text'
+then "$@" "$@" x=1 then 2>/dev/null ${HOME} readonly --verbose --verbose
+		'quoted text' "$@" then /usr/bin $(pwd) test test test $(pwd)
+grep | readonly "$1" /usr/bin sed printf --verbose
+&& && grep readonly echo then -eu 'quoted text'
+		&& awk $(pwd) grep cd done --verbose /usr/bin --verbose -eu then done cd "$1"
+		| awk readonly "$1" local cd grep test "$1"
+	"$@" "$1" sed cd local && -eu 2>/dev/null
+printf && readonly export cd --verbose
+local local export /usr/bin then && ${HOME} test "$@" done sed
+"$1" done -eu "$@" echo --verbose awk echo
+readonly cd readonly cd ${HOME} export "$1"
+		local | /usr/bin 'quoted text' && export && export
+	2>/dev/null -eu 'quoted text' -eu "$1" done && 'quoted text' done awk "$1"
+	-eu export && && grep -eu awk export test --verbose local sed
+	awk x=1 then ${HOME} | "$@" 2>/dev/null
+	${HOME} printf printf x=1 test grep && "$1" 2>/dev/null $(pwd) cd
+&& local x=1 --verbose printf readonly
+	done done test $(pwd) sed test export local readonly 2>/dev/null
+	/usr/bin local "$1" then ${HOME} sed 'quoted text'
+sed local echo awk | --verbose test --verbose -eu 'quoted text'
+		2>/dev/null sed cd --verbose
+		readonly grep /usr/bin -eu sed &&
+		done done 2>/dev/null readonly export -eu -eu done "$1" -eu echo
+	-eu printf /usr/bin --verbose done grep && export
+	${HOME} "$1" 2>/dev/null readonly | 2>/dev/null && 2>/dev/null $(pwd) readonly
+		${HOME} test --verbose x=1 /usr/bin | done readonly ${HOME}
+test awk readonly && ${HOME} 2>/dev/null "$1"
+		"$@" $(pwd) "$@" ${HOME} local test test test then "$1" --verbose
+	-eu readonly sed x=1 sed $(pwd) echo 'quoted text' done then x=1
+		readonly export cd sed done x=1 export x=1 test 'quoted text'
+		x=1 /usr/bin printf -eu done --verbose
+	then awk grep "$1" local awk then
+		printf ${HOME} "$@" && 2>/dev/null -eu /usr/bin echo --verbose x=1 $(pwd)
+	x=1 "$1" ${HOME} awk $(pwd)
+/usr/bin "$1" awk export && $(pwd)
+local "$1" then sed cd ${HOME} "$1" cd grep /usr/bin echo sed echo test
+	awk printf test echo x=1 "$@" -eu && printf "$1" 2>/dev/null "$1" 2>/dev/null
+	2>/dev/null awk grep x=1 export
+	--verbose export then
+${HOME} | then grep ${HOME} awk then "$@" sed "$1" -eu x=1 'quoted text' readonly
+	sed $(pwd) 2>/dev/null done x=1 "$@" x=1 x=1 --verbose
+awk echo "$@" cd x=1 --verbose then ${HOME}
+		test awk /usr/bin then grep awk awk printf export $(pwd) && "$@" readonly
+	readonly -eu | done sed sed echo
+2>/dev/null --verbose sed readonly export
+&& readonly readonly local --verbose sed && ${HOME} x=1 /usr/bin grep ${HOME}
+	&& grep -eu "$1" local test printf
+${HOME} "$@" | echo export 'quoted text' printf && x=1
+--verbose /usr/bin done $(pwd) test 2>/dev/null --verbose
+done && then readonly "$@" test local echo ${HOME} export
+		"$1" "$@" -eu ${HOME} done grep 'quoted text' -eu "$1" -eu
+cd && readonly sed ${HOME} printf
+	'quoted text' grep test |
+		awk $(pwd) test cd awk -eu 'quoted text' cd "$1" "$@" local && x=1 then /usr/bin
+-eu test 'quoted text' ${HOME}
+		awk echo | 'quoted text' readonly sed export readonly
+	'quoted text' "$@" done ${HOME} 2>/dev/null grep &&
+		$(pwd) 'quoted text' 2>/dev/null
+		local $(pwd) export "$1" /usr/bin "$@"
+"$@" 'quoted text' 2>/dev/null
+		echo 2>/dev/null export readonly then && ${HOME} awk test "$@" cd test
+	awk local /usr/bin grep -eu grep 2>/dev/null cd x=1 x=1 grep echo
+	${HOME} 2>/dev/null "$@" awk x=1 -eu grep readonly done | test | "$1" 2>/dev/null
+	| cd readonly awk export 'quoted text' then
+	done "$@" local | local awk printf test
+	cd then sed awk cd "$@" -eu export printf awk readonly /usr/bin grep
+sed echo "$1" /usr/bin awk awk x=1 /usr/bin echo $(pwd) /usr/bin
+	export $(pwd) && sed export
+	"$1" "$1" export 'quoted text' done 2>/dev/null
+	"$1" 2>/dev/null grep export local --verbose
+	grep echo grep ${HOME} echo "$1" export readonly cd awk test sed
+$(pwd) sed x=1 $(pwd) 'quoted text' 'quoted text'
+	/usr/bin | readonly printf -eu $(pwd) /usr/bin local test -eu ${HOME}
+then sed && "$@" test grep printf sed then x=1 x=1 && readonly cd /usr/bin sed
+grep export && -eu 2>/dev/null --verbose then then
+&& then awk $(pwd) && ${HOME} $(pwd) 'quoted text' --verbose ${HOME}
+		awk --verbose test ${HOME}
+	echo export awk 'quoted text' /usr/bin echo 2>/dev/null echo x=1
+		&& then 'quoted text' && readonly "$@" 'quoted text' --verbose
+$(pwd) test 'quoted text' sed sed local | then -eu "$@"
+	cd cd echo local | --verbose export cd && 'quoted text'
+	local awk done sed echo && export "$@" ${HOME} done echo -eu /usr/bin
+	| | "$1" test "$1" readonly grep "$1" then 2>/dev/null export export /usr/bin
+	sed sed grep ${HOME} x=1 local echo export awk -eu
+	done readonly && local ${HOME} $(pwd) /usr/bin && awk then "$@" x=1 sed
+		local "$1" cd x=1 readonly export printf
+		export then 'quoted text' 2>/dev/null 2>/dev/null done -eu /usr/bin
+	'quoted text' x=1 ${HOME} 2>/dev/null
+sed 2>/dev/null export ${HOME}
+x=1 $(pwd) readonly export 2>/dev/null
+	test $(pwd) then $(pwd) done printf done /usr/bin 2>/dev/null done export ${HOME}
+readonly grep ${HOME} then -eu "$1" readonly
+	"$1" /usr/bin $(pwd) done /usr/bin printf x=1 && then
+	test "$1" local && /usr/bin export -eu ${HOME} test x=1 x=1 awk
+		then readonly local 2>/dev/null cd | grep x=1 printf 2>/dev/null
+'quoted text' /usr/bin | | then $(pwd) echo x=1 sed $(pwd) "$@" "$1" readonly
+2>/dev/null echo awk grep "$@" grep /usr/bin local
+		export x=1 grep sed ${HOME} ${HOME}
+/usr/bin -eu "$1" echo cd cd echo | awk
+		grep sed --verbose cd | sed 'quoted text'
+	-eu sed x=1 sed test export -eu test echo
+	awk then then "$1" && export ${HOME}
+		readonly ${HOME} | --verbose 'quoted text' "$1" then then -eu test && sed /usr/bin
+	'quoted text' printf test
+	"$1" | readonly printf sed printf export "$@" --verbose
+		"$@" echo x=1 $(pwd) $(pwd) "$@" "$@" export grep && -eu /usr/bin readonly $(pwd)
+	$(pwd) test sed test done "$1" printf awk done
+		--verbose 'quoted text' then local echo -eu x=1 export 2>/dev/null
+		'quoted text' test echo
+test "$1" | "$@" awk readonly "$1" --verbose
+		test --verbose --verbose sed grep local sed /usr/bin
+		2>/dev/null $(pwd) /usr/bin 'quoted text' cd | export /usr/bin
+'quoted text' "$1" echo x=1 ${HOME} export | test readonly
+		x=1 sed export | export echo readonly local -eu ${HOME}
+cd sed | cd "$@" printf done echo $(pwd) grep 'quoted text'
+	&& grep $(pwd) 'quoted text' cd
+	--verbose 2>/dev/null done | "$1" 'quoted text' /usr/bin --verbose
+		echo then /usr/bin | | awk /usr/bin readonly
+		"$1" grep export local /usr/bin && local /usr/bin sed 'quoted text'
+	"$1" grep && export echo echo /usr/bin readonly "$1" echo export printf test
+		"$1" cd $(pwd) cd sed local /usr/bin
+		echo 'quoted text' | cd /usr/bin 2>/dev/null
+		test && /usr/bin --verbose /usr/bin printf awk "$1" 2>/dev/null
+	done local $(pwd) "$@" sed 2>/dev/null ${HOME} done
+/usr/bin && ${HOME} 2>/dev/null && -eu sed "$@" then 2>/dev/null
+then cd readonly sed echo local -eu then then -eu ${HOME} echo sed printf
+	sed "$1" awk echo export cd readonly then | $(pwd) echo awk sed printf
+		--verbose | grep echo printf | grep /usr/bin --verbose /usr/bin
+	$(pwd) readonly | awk $(pwd) $(pwd) local local --verbose awk test 2>/dev/null
+	readonly && 'quoted text' grep then x=1 sed local -eu ${HOME} printf echo | grep
+echo grep "$@" export /usr/bin x=1
+		export 2>/dev/null readonly awk 2>/dev/null /usr/bin "$1"
+	grep x=1 && 2>/dev/null && "$@"
+${HOME} then grep cd 'quoted text'
+		echo printf /usr/bin cd local |
+	echo -eu grep 2>/dev/null grep 2>/dev/null x=1 /usr/bin 'quoted text'
+	then readonly --verbose grep done ${HOME} then
+		&& --verbose "$1" then printf awk --verbose cd test test
+		then -eu "$@" readonly echo awk awk sed -eu echo readonly test
+readonly export --verbose --verbose test 2>/dev/null -eu "$1"
+		/usr/bin export test test x=1
+	${HOME} "$1" x=1 "$@"
+		test cd done echo "$1" 'quoted text'
+		'quoted text' echo &&
+	then grep done then awk | printf "$1" x=1 export echo "$1" -eu export -eu done
+	sed export cd sed x=1 printf 2>/dev/null echo $(pwd) local
+	--verbose /usr/bin 'quoted text' readonly | test ${HOME} $(pwd) readonly -eu
+	${HOME} then -eu echo x=1 'quoted text' /usr/bin && grep | local
+		2>/dev/null x=1 local grep ${HOME} done ${HOME} awk "$@" awk /usr/bin 2>/dev/null
+/usr/bin "$@" export -eu done | $(pwd) x=1 local x=1 sed -eu sed /usr/bin export
+&& done x=1 grep grep echo export ${HOME} 'quoted text' then "$1"
+readonly readonly awk sed export test cd x=1 echo cd test "$@" ${HOME}
+	&& && sed done grep $(pwd) grep
+sed readonly x=1 && printf 2>/dev/null printf /usr/bin awk sed done echo
+		'quoted text' /usr/bin
+grep then sed done test --verbose /usr/bin 'quoted text' export 'quoted text'
+${HOME} --verbose test /usr/bin 2>/dev/null ${HOME} 2>/dev/null
+	--verbose cd 2>/dev/null done awk local export && printf "$1" "$@" --verbose
+&& /usr/bin local "$@" cd "$1" grep done awk $(pwd) readonly
+		done awk | printf -eu local sed cd then "$@" export awk
+/usr/bin ${HOME} 'quoted text' awk 2>/dev/null echo
+		&& ${HOME} "$1" -eu echo $(pwd) sed cd x=1 ${HOME}
+	readonly readonly echo
+	$(pwd) ${HOME} done ${HOME} -eu 2>/dev/null ${HOME} cd "$1" 2>/dev/null test
+"$@" cd | export --verbose
+	local ${HOME} -eu then "$1" "$@" x=1 export test
+'quoted text' | 'quoted text' -eu echo /usr/bin "$@" echo export
+done $(pwd) printf x=1 readonly | printf cd test | sed then then /usr/bin
+		awk | /usr/bin 'quoted text' x=1 done echo -eu x=1 readonly
+printf cd readonly | --verbose
+	export local cd "$@" -eu | printf 2>/dev/null echo 2>/dev/null
+		&& "$1" -eu $(pwd) && 2>/dev/null
+/usr/bin -eu grep x=1 ${HOME} /usr/bin sed -eu $(pwd) awk then ${HOME} awk
+	sed x=1 $(pwd) test 'quoted text' readonly printf sed local
+2>/dev/null printf $(pwd) echo sed done echo printf
+		echo grep && "$1" /usr/bin 2>/dev/null ${HOME} &&
+${HOME} printf grep printf test "$@" "$1" then 2>/dev/null readonly
+	/usr/bin 'quoted text' && && --verbose
+	'quoted text' export test 'quoted text' 2>/dev/null then echo
+sed sed awk then cd && then x=1 cd printf -eu 2>/dev/null then
+'quoted text' /usr/bin cd "$1"
+	| grep 2>/dev/null 2>/dev/null
+	'quoted text' sed "$@" done 2>/dev/null && /usr/bin --verbose | test | ${HOME}
+/usr/bin test then readonly echo awk printf --verbose x=1 local 2>/dev/null
+	"$@" done printf cd | awk
+	export printf x=1 awk done "$1"
+		grep awk "$1" echo ${HOME}
+		$(pwd) export -eu readonly cd printf export
+	readonly export 'quoted text' 2>/dev/null "$1" printf
+		local x=1 2>/dev/null 'quoted text' x=1 'quoted text'
+	--verbose -eu cd then $(pwd) awk &&
+		--verbose then 2>/dev/null local /usr/bin echo export test 'quoted text'
+	echo readonly grep && 'quoted text' | cd printf export "$1" local
+	x=1 ${HOME} done && sed sed export local test cd $(pwd) export $(pwd) export ${HOME}
+echo sed "$@" "$1" "$1" done
+| grep && && && 'quoted text' $(pwd) echo local "$1" 'quoted text'
+	&& $(pwd) local grep /usr/bin $(pwd) local "$1" done cd test
+	| $(pwd) ${HOME} x=1 --verbose
+2>/dev/null cd "$1" 'quoted text' test | ${HOME} /usr/bin export done cd cd printf
+		awk && cd done readonly printf 2>/dev/null ${HOME} export --verbose
+		--verbose "$1" && "$1" cd --verbose $(pwd) $(pwd) ${HOME} $(pwd) printf
+	x=1 -eu done sed local sed "$@" done "$@" 2>/dev/null 2>/dev/null printf readonly
+		then /usr/bin 'quoted text' then awk
+	sed grep awk echo 2>/dev/null grep test done 'quoted text' -eu -eu
+	"$@" local local --verbose test "$1" x=1 export
+echo done then sed awk readonly /usr/bin "$1" done 'quoted text'
+	test /usr/bin "$1" ${HOME} printf printf export $(pwd) --verbose cd then
+	'quoted text' done "$@" "$@" 2>/dev/null
+'quoted text' /usr/bin export cd awk grep
+"$1" "$@" then done echo $(pwd) "$@"
+awk echo 'quoted text' /usr/bin sed then /usr/bin -eu
+	2>/dev/null --verbose sed -eu done && echo | echo $(pwd) echo "$@"
+printf sed 2>/dev/null 'quoted text'
+	test cd 'quoted text' then ${HOME} printf
+		| echo local local done cd -eu
+	--verbose -eu "$1" echo /usr/bin -eu | | then "$1" --verbose printf
+	| readonly readonly readonly
+'quoted text' ${HOME} cd "$1" 2>/dev/null
+local "$1" printf test $(pwd)
+		&& done sed echo then "$@" 'quoted text'
+	export export awk test /usr/bin --verbose $(pwd) echo x=1
+local readonly export 2>/dev/null
+	-eu grep sed printf -eu
+cd printf local ${HOME} sed $(pwd) --verbose
+	done done /usr/bin cd /usr/bin local local cd && export
+		$(pwd) sed -eu "$@" readonly sed readonly "$1"
+	test ${HOME} then $(pwd)
+$(pwd) "$@" -eu awk "$@" "$1" echo cd $(pwd) "$@" export 2>/dev/null readonly
+done /usr/bin awk grep 'quoted text'
+printf local 'quoted text' "$@"
+done done then printf test grep
+		printf 2>/dev/null 2>/dev/null local done -eu | x=1 2>/dev/null printf
+		printf grep echo "$@" 2>/dev/null
+		readonly test ${HOME} 'quoted text'
+		x=1 --verbose "$1" then grep sed "$1" cd export --verbose
+	"$@" echo cd echo -eu x=1 | echo cd sed "$1" printf
+local && done sed grep export done -eu local
+	/usr/bin --verbose local
+		2>/dev/null awk /usr/bin --verbose -eu awk $(pwd) sed $(pwd) ${HOME} done -eu 'quoted text'
+	then printf done x=1 ${HOME} "$@" echo x=1
+		"$1" ${HOME} local && awk printf && --verbose 'quoted text'
+x=1 --verbose ${HOME} x=1 echo --verbose readonly test /usr/bin 2>/dev/null
+2>/dev/null local 2>/dev/null
+		test | -eu && sed /usr/bin &&
+cd | awk x=1 "$1" readonly local
+		echo /usr/bin cd awk -eu local 2>/dev/null -eu
+		2>/dev/null local sed 'quoted text' test
+local export /usr/bin awk x=1 /usr/bin grep readonly readonly
+		"$1" printf -eu 2>/dev/null | awk readonly readonly echo sed && --verbose
+	$(pwd) | 2>/dev/null "$1" done $(pwd) 'quoted text'
+echo -eu "$1" readonly test
+	"$1" -eu grep -eu echo /usr/bin printf --verbose export readonly
+	-eu --verbose --verbose -eu "$@" test -eu grep test 2>/dev/null
+		--verbose printf $(pwd) test ${HOME} awk
+	export test 'quoted text' export &&
+$(pwd) printf local 2>/dev/null 'quoted text' done
+echo sed /usr/bin /usr/bin 'quoted text' test then
+	awk 'quoted text' export local done then done export grep local --verbose
+	&& then awk then --verbose "$1" ${HOME} echo 2>/dev/null
+	x=1 'quoted text' sed
+cd 2>/dev/null grep readonly ${HOME} printf $(pwd) then
+		"$1" then grep ${HOME} && && $(pwd) grep | readonly
+	cd x=1 "$@" 'quoted text' then sed printf --verbose x=1 --verbose
+	then readonly grep local printf /usr/bin local -eu | $(pwd) 'quoted text'
+	grep sed printf && 'quoted text' $(pwd) then
+		'quoted text' /usr/bin printf
+local 'quoted text' "$1"
+		"$1" echo --verbose readonly |
+	"$1" echo && | && grep && awk printf readonly "$1" | echo -eu $(pwd)
+		awk sed echo cd 2>/dev/null
+echo --verbose export ${HOME} "$1" --verbose
+${HOME} grep cd -eu local grep
+	sed --verbose "$1" test echo "$@" /usr/bin then | $(pwd) then sed -eu
+		&& echo "$1" local local "$@" && echo /usr/bin ${HOME} sed awk
+		"$@" x=1 printf cd -eu 'quoted text' "$@" x=1 "$1" readonly sed ${HOME} /usr/bin
+2>/dev/null $(pwd) test "$1" && --verbose sed test x=1
+		readonly sed readonly sed readonly readonly then readonly
+	| ${HOME} grep done done sed | -eu awk "$@" 2>/dev/null
+	-eu awk x=1 echo done ${HOME} 2>/dev/null
+	-eu x=1 ${HOME} && | ${HOME}
+		echo echo done echo test /usr/bin 'quoted text' awk x=1
+local $(pwd) then "$@" x=1 export cd export
+		&& ${HOME} echo echo echo "$@" -eu echo "$@" readonly done then echo test "$@"
+		'quoted text' readonly "$@" done cd x=1 && export then cd echo 2>/dev/null
+		printf readonly done readonly 'quoted text'
+	/usr/bin done "$@" test printf readonly --verbose x=1 readonly export cd grep
+		"$@" | cd x=1 $(pwd) --verbose ${HOME} -eu test /usr/bin 'quoted text'
+	$(pwd) local "$@" 'quoted text'
+'quoted text' && --verbose ${HOME} &&
+#include c239.sh
+	grep echo $(pwd) && printf "$@" -eu -eu /usr/bin $(pwd) /usr/bin done readonly
+/usr/bin /usr/bin --verbose -eu then done echo && "$@" "$@"
+x=1 --verbose 'quoted text'
+	"$1" x=1 "$@" "$@" done -eu readonly "$@" "$1"
+	test local grep 2>/dev/null export $(pwd) local grep
+	${HOME} sed readonly then export
+	${HOME} ${HOME} -eu &&
+	/usr/bin done 2>/dev/null test -eu readonly -eu sed x=1 --verbose readonly export
+		awk | printf cd x=1 "$@" export
+	export export readonly ${HOME} --verbose echo "$@" test "$@" readonly cd then
+	x=1 -eu printf 'quoted text' sed
+--verbose printf echo then "$1" $(pwd) "$@" printf "$1" cd done
+$(pwd) awk --verbose 2>/dev/null grep readonly readonly done && 'quoted text' grep
+$(pwd) then && 2>/dev/null cd
+		test && then cd echo --verbose echo x=1 local x=1 sed "$@" cd readonly
+		done grep grep x=1 $(pwd) cd sed sed done awk sed /usr/bin local readonly
+done 2>/dev/null readonly x=1
+		done done --verbose cd --verbose --verbose -eu --verbose
+	export && "$@" local "$@" "$1" grep readonly grep export
+then $(pwd) printf readonly
+	&& done 2>/dev/null echo -eu awk "$1" cd
+done ${HOME} export sed ${HOME} test 'quoted text'
+cd grep x=1 /usr/bin x=1 'quoted text' export x=1 --verbose
+	export ${HOME} printf "$1" 2>/dev/null test 'quoted text'
+		export "$1" printf done 2>/dev/null x=1 --verbose
+		| 'quoted text' test readonly x=1 ${HOME} test "$1"
+x=1 2>/dev/null -eu 2>/dev/null test "$1" | awk export
+	test printf printf then local ${HOME} test test
+	2>/dev/null echo -eu /usr/bin --verbose local echo /usr/bin x=1 -eu "$@"
+		sed grep "$@" printf 'quoted text'
+	echo ${HOME} test $(pwd) then -eu $(pwd) "$@" awk test done | && done local
+	-eu x=1 done cd 2>/dev/null ${HOME} && 'quoted text' "$1" echo $(pwd) printf
+	grep "$@" export 'quoted text' readonly "$@" local local "$@" awk 'quoted text'
+then printf | $(pwd) ${HOME} awk cd cd done x=1 test x=1
+		then sed /usr/bin 'quoted text'
+sed then echo grep test ${HOME} && | 2>/dev/null done awk
+	grep ${HOME} done | awk && readonly grep cd 2>/dev/null test test $(pwd) /usr/bin
+export readonly 'quoted text'
+awk done export /usr/bin grep cd $(pwd) 2>/dev/null 2>/dev/null
+cd awk ${HOME} awk | then 2>/dev/null awk grep /usr/bin cd test 'quoted text'
+	readonly $(pwd) printf "$@" /usr/bin
+	test /usr/bin grep ${HOME} $(pwd)
+		$(pwd) test x=1 "$1" printf cd local --verbose done
+export then done | export $(pwd)
+	$(pwd) ${HOME} sed then 'quoted text' x=1 echo grep ${HOME} then 2>/dev/null
+"$1" 'quoted text' /usr/bin 2>/dev/null
+printf 'quoted text' "$@" /usr/bin then "$1" x=1 && "$@" ${HOME} printf
+	&& export $(pwd) "$@" | /usr/bin x=1 $(pwd) sed echo awk grep sed
+| done export 2>/dev/null "$@" grep local
+		export /usr/bin then printf
+		-eu -eu echo $(pwd) "$1" -eu 2>/dev/null
+	${HOME} 'quoted text' ${HOME} awk cd 2>/dev/null sed
+-eu -eu done then local
+	&& /usr/bin /usr/bin "$1"
+	then "$1" readonly readonly grep 'quoted text' ${HOME} test cd export | --verbose
+		done /usr/bin "$@" test /usr/bin "$@" cd $(pwd) --verbose
+	then --verbose "$@" && export "$1" | -eu export --verbose /usr/bin
+&& test -eu readonly $(pwd) 2>/dev/null printf ${HOME}
+		x=1 /usr/bin ${HOME} ${HOME} local "$1" test "$@" printf /usr/bin echo
+	"$1" -eu $(pwd) printf ${HOME} local x=1 |
+	${HOME} done "$@" -eu "$@" "$@" cd "$1"
+		sed cd 2>/dev/null readonly export "$@" "$@" done "$@" printf export
+done readonly -eu ${HOME} export done 2>/dev/null
+/usr/bin then "$1" /usr/bin local local cd echo -eu ${HOME} printf
+export sed "$@" grep 'quoted text'
+	"$1" --verbose --verbose --verbose
+		x=1 "$1" "$@" 2>/dev/null /usr/bin printf 2>/dev/null test
+		then /usr/bin && ${HOME} && readonly /usr/bin
+"$@" sed | ${HOME} 'quoted text'
+	-eu "$@" 'quoted text'
+		--verbose "$1" readonly
+sed printf export | cd then cd local x=1 && 'quoted text'
+'quoted text' test | grep grep local printf "$@" local test
+		'quoted text' echo "$1" $(pwd) readonly cd /usr/bin | --verbose
+	awk -eu /usr/bin then && cd local
+	export awk 'quoted text' && cd test export cd && --verbose
+		cd /usr/bin export awk cd | test /usr/bin readonly grep "$@" -eu && 2>/dev/null
+x=1 readonly local x=1 local done cd echo printf
+	done "$1" test printf x=1 ${HOME} awk
+	'quoted text' && --verbose | "$1" grep "$1" 2>/dev/null
+	${HOME} export sed /usr/bin | awk && ${HOME} awk | x=1 printf && done -eu -eu
+	&& "$@" && | local 2>/dev/null
+		grep export | /usr/bin cd done $(pwd) test
+		${HOME} printf --verbose printf
+		${HOME} 'quoted text' printf /usr/bin
+	| awk 2>/dev/null local ${HOME} && -eu "$1" awk 2>/dev/null
+		export printf && cd --verbose readonly
+		| | readonly readonly sed local echo $(pwd)
+	echo x=1 done $(pwd) done --verbose then 'quoted text'
+		${HOME} "$1" sed local x=1 readonly /usr/bin -eu "$1" 'quoted text' sed 'quoted text'
+	export readonly export grep
+	x=1 cd grep echo echo printf then sed sed then "$1" local readonly
+"$1" awk 2>/dev/null then "$@" /usr/bin cd local &&
+awk ${HOME} $(pwd) cd then done x=1 ${HOME}
+-eu /usr/bin grep local readonly
+	printf then then 'quoted text' echo 2>/dev/null awk done ${HOME} "$1" done "$@"
+		/usr/bin export 2>/dev/null done -eu local echo local cd then
+2>/dev/null | local $(pwd)
+		echo printf /usr/bin sed grep $(pwd) "$@" grep
+/usr/bin && awk printf
+	grep sed then echo | "$@" "$1" "$@" readonly 2>/dev/null &&
+done awk local awk grep $(pwd) ${HOME} -eu printf
+	'quoted text' -eu && | echo
+		export | ${HOME} --verbose done && ${HOME} 2>/dev/null
+printf grep 2>/dev/null --verbose 'quoted text'
+	awk && local local sed echo --verbose "$1"
+/usr/bin cd done printf export
+	"$@" printf grep "$1" readonly ${HOME} printf sed 2>/dev/null /usr/bin done done
+grep grep $(pwd) done "$@" then echo export
+	done test | $(pwd) ${HOME} sed echo then -eu --verbose | ${HOME} 'quoted text'
+	sed grep cd export cd sed
+		| "$1" $(pwd) printf printf test
+awk cd local ${HOME} readonly test --verbose
+	readonly && awk sed awk $(pwd) ${HOME}
+	sed sed -eu done awk printf export "$@" | 2>/dev/null local done test
+		-eu export printf "$@" $(pwd) /usr/bin 2>/dev/null local export "$@" local
+grep x=1 awk sed readonly echo done --verbose
+		2>/dev/null $(pwd) export
+	/usr/bin --verbose 'quoted text'
+	printf $(pwd) cd then && --verbose "$@"
+	echo sed /usr/bin 2>/dev/null x=1 x=1 printf
+		export then && done 'quoted text' ${HOME} echo /usr/bin
+	$(pwd) "$1" then printf awk sed 2>/dev/null "$1" printf then $(pwd)
+	${HOME} ${HOME} then ${HOME} test printf
+	readonly $(pwd) -eu readonly local -eu | ${HOME} local sed | cd && sed
+local -eu printf local local awk 'quoted text' x=1 readonly "$1"
+	echo "$1" "$@" echo -eu 2>/dev/null
+	2>/dev/null --verbose test grep sed then test /usr/bin echo x=1 readonly grep $(pwd)
+${HOME} ${HOME} $(pwd) -eu awk
+cd "$@" --verbose sed local "$@" $(pwd) readonly export local /usr/bin $(pwd) done
+done printf awk echo awk | printf x=1 test sed "$@" readonly then printf "$@"
+--verbose cd 'quoted text' "$1" export local local "$@" echo awk export export
+	sed then 'quoted text' printf sed readonly "$@" cd /usr/bin
+sed "$@" 2>/dev/null echo readonly --verbose
+		/usr/bin export 2>/dev/null readonly readonly then x=1
+$(pwd) local echo done -eu export | done && printf
+printf "$1" "$@" export readonly 'quoted text'
+local /usr/bin --verbose then 2>/dev/null readonly ${HOME} export x=1 x=1 echo
+		done sed ${HOME} --verbose "$1" grep /usr/bin
+		awk local done cd ${HOME} local --verbose printf x=1 'quoted text' /usr/bin
+	'quoted text' "$@" | export echo &&
+		printf readonly ${HOME} x=1 && awk "$1" printf export 'quoted text'
+		awk cd /usr/bin ${HOME} 'quoted text' -eu local awk sed sed -eu done /usr/bin
+	echo x=1 "$1" cd | $(pwd) grep "$1" cd ${HOME}
+&& && done --verbose done --verbose "$@" done printf 'quoted text' ${HOME}
+then sed then "$@" awk --verbose $(pwd) /usr/bin
+	"$@" $(pwd) test ${HOME} test 'quoted text' printf echo | then "$1"
+awk | printf --verbose 2>/dev/null "$1" $(pwd) done
+		echo echo 2>/dev/null export echo | "$@" local "$@"
+	/usr/bin echo test --verbose printf | /usr/bin
+"$@" /usr/bin --verbose | "$1" -eu $(pwd) "$@" 'quoted text' done |
+awk awk readonly sed x=1 grep cd
+		-eu -eu done echo readonly | /usr/bin
+readonly printf sed test test ${HOME} ${HOME} x=1 && export test grep
+		'quoted text' 'quoted text' -eu 2>/dev/null echo test /usr/bin cd /usr/bin "$@"
+	awk readonly test -eu done done x=1 x=1 export ${HOME} cd
+		-eu "$1" ${HOME} -eu "$1" readonly "$@" cd test local --verbose sed printf
+		cd "$@" /usr/bin test | local export -eu
+		done x=1 "$@" grep ${HOME} ${HOME} | cd "$@" then /usr/bin -eu x=1 --verbose
+		sed readonly grep export printf "$1" grep "$@"
+x=1 done export local 2>/dev/null ${HOME} -eu --verbose
+	2>/dev/null x=1 2>/dev/null --verbose --verbose
+"$@" readonly awk /usr/bin sed export && x=1 export then 2>/dev/null
+		local done 'quoted text' /usr/bin awk export then test cd
+		${HOME} test local | awk
+	x=1 done ${HOME} -eu 'quoted text' 2>/dev/null export printf printf
+	${HOME} ${HOME} --verbose x=1 --verbose sed readonly x=1 awk echo
+	readonly done $(pwd) | sed && printf &&
+		echo "$@" "$1" printf --verbose | 2>/dev/null sed 'quoted text' $(pwd) $(pwd)
+cd --verbose local && "$@" cd && cd x=1 | "$@" 'quoted text' test
+	then --verbose then 2>/dev/null 'quoted text' printf done
+		-eu 2>/dev/null $(pwd) 'quoted text' awk
+"$@" ${HOME} awk awk | "$@" awk |
+	| then awk 'quoted text' 2>/dev/null | readonly grep
+		grep then test /usr/bin ${HOME} /usr/bin done awk "$@"
+		-eu --verbose "$1" cd awk -eu x=1 awk "$@" then 2>/dev/null
+echo "$@" "$1" echo done x=1 ${HOME}
+	then export then grep x=1 readonly grep |
+test sed awk $(pwd) && && &&
+cd --verbose "$1" then grep printf sed done then 2>/dev/null
+		sed | done "$@" then export x=1 cd "$@" /usr/bin grep 2>/dev/null local 'quoted text'
+${HOME} export "$1" then | ${HOME} /usr/bin
+	--verbose grep sed && $(pwd)
+		awk export --verbose sed /usr/bin then ${HOME} awk done awk printf
+cd $(pwd) awk 'quoted text' readonly sed --verbose grep sed ${HOME} $(pwd)
+2>/dev/null grep printf awk awk echo $(pwd) --verbose
+		cd cd sed /usr/bin test --verbose && grep && x=1 x=1 2>/dev/null $(pwd) readonly
+		--verbose printf readonly export "$1" cd "$1" cd
+| awk awk 2>/dev/null $(pwd) /usr/bin
+		echo sed -eu printf export grep && local 'quoted text' "$1" 'quoted text'
+		"$1" ${HOME} cd 2>/dev/null $(pwd) awk $(pwd) test $(pwd) $(pwd)
+| then "$1" ${HOME} "$1" export cd
+--verbose -eu grep && /usr/bin
+	export sed export x=1 done test x=1 printf /usr/bin done
+	export 2>/dev/null && local -eu 'quoted text' sed 2>/dev/null &&
+${HOME} --verbose ${HOME} echo ${HOME} done /usr/bin local
+cd "$@" echo --verbose | local test -eu
+${HOME} ${HOME} -eu grep printf cd then done sed readonly cd then
+-eu --verbose export awk readonly
+		/usr/bin -eu sed export --verbose grep export --verbose sed $(pwd) $(pwd) done
+		test sed export printf && 'quoted text'
+/usr/bin test /usr/bin /usr/bin -eu echo -eu "$@" awk
+		"$1" | done readonly --verbose
+/usr/bin /usr/bin "$1" cd
+		done export -eu export sed export
+	export -eu export && grep echo awk then
+	readonly cd /usr/bin test
+	| grep done | "$1" && grep done
+	"$@" awk "$@" local grep ${HOME}
+	--verbose awk | x=1 export x=1 then echo test readonly
+	"$1" $(pwd) test then $(pwd) x=1 /usr/bin
+		grep cd grep then then &&
+		cd grep && printf && cd /usr/bin awk echo test export -eu awk /usr/bin 'quoted text'
+	"$@" local -eu then grep readonly echo &&
+done -eu --verbose echo
+${HOME} then test readonly ${HOME}
+2>/dev/null x=1 then /usr/bin local "$@"
+	/usr/bin x=1 printf x=1 'quoted text' done | test
+grep "$@" local readonly local 'quoted text'
+cd printf readonly 'quoted text'
+		${HOME} $(pwd) grep -eu -eu && 'quoted text'
+awk echo /usr/bin | awk | -eu sed grep grep printf cd /usr/bin --verbose $(pwd)
+	test --verbose grep printf /usr/bin readonly /usr/bin "$@"
+	sed 2>/dev/null | "$@" | "$@" cd printf readonly
+"$1" "$1" cd "$@" && x=1 'quoted text' | readonly cd | 2>/dev/null awk ${HOME}
+"$1" done -eu --verbose done export done local echo x=1 grep x=1
+		printf test awk -eu local | readonly "$@" printf export | $(pwd) 'quoted text'
+"$@" 'quoted text' sed $(pwd) $(pwd) ${HOME} | sed
+	-eu sed cd echo --verbose then grep x=1 && awk 2>/dev/null
+| grep local /usr/bin "$@" | -eu
+then "$@" "$@" -eu $(pwd) test test | local
+	x=1 && printf test ${HOME} "$@" /usr/bin "$1"
+${HOME} then ${HOME} echo then done export local readonly 2>/dev/null grep
+"$1" && then 2>/dev/null "$@" x=1 cd echo "$1"
+	awk readonly printf awk ${HOME} 2>/dev/null export done cd done &&
+	-eu --verbose $(pwd) $(pwd) "$1" echo 'quoted text' done
+	sed 'quoted text' cd /usr/bin
+	export -eu 'quoted text' ${HOME} then local x=1 --verbose
+done /usr/bin /usr/bin done 2>/dev/null readonly local 'quoted text'
+	x=1 $(pwd) local sed cd then && "$1" x=1 cd awk local
+${HOME} /usr/bin cd && --verbose | "$1" readonly awk echo cd local local | "$@"
+sed --verbose $(pwd) -eu test export readonly ${HOME}
+		test echo then export 'quoted text'
+readonly "$@" echo "$@" && "$@" /usr/bin awk export && 'quoted text' printf
+	/usr/bin 2>/dev/null ${HOME} --verbose grep
+		"$1" "$1" "$@" test /usr/bin grep
+grep "$@" sed awk then 'quoted text' grep && x=1 x=1 export then -eu
+	readonly 2>/dev/null "$@" && 2>/dev/null x=1 echo export "$@" local sed
+		grep export /usr/bin cd
+	| then | local printf $(pwd) then --verbose
+	| -eu "$1" "$@" grep /usr/bin ${HOME} --verbose
+	local 'quoted text' echo && done echo awk
+		then awk local cd "$@" "$@" awk grep then && test local readonly done -eu test
+	grep x=1 | 'quoted text' /usr/bin sed && awk "$@" 'quoted text' awk
+awk cd --verbose local cd sed "$1" ${HOME} echo /usr/bin
+		then "$1" && | "$1" ${HOME} test
+	2>/dev/null | | readonly export 2>/dev/null 'quoted text'
+done local x=1 awk && awk
+	"$@" 'quoted text' "$@" "$1" printf -eu --verbose
+export | ${HOME} sed 2>/dev/null local done sed
+${HOME} readonly $(pwd) printf
+done x=1 grep echo readonly sed | echo readonly done | echo printf | 'quoted text'
+	'quoted text' cd x=1 local $(pwd) cd && cd -eu ${HOME} readonly
+		printf readonly --verbose cd cd --verbose 'quoted text' && done done $(pwd) 'quoted text'
+	cd ${HOME} && 'quoted text' then
+		echo grep x=1 2>/dev/null --verbose /usr/bin
+	| done "$@" "$@" then && ${HOME} -eu
+	done 2>/dev/null test cd && awk printf
+printf "$1" cd readonly local ${HOME} --verbose -eu $(pwd) printf
+		local done /usr/bin done
+		"$1" | | test -eu $(pwd) | export "$@" "$1" printf "$1" test "$@" then echo
+		2>/dev/null $(pwd) ${HOME} test 'quoted text' grep then /usr/bin
+		echo printf | x=1 grep sed && x=1 'quoted text' | grep awk then "$@" "$1" ${HOME}
+--verbose 'quoted text' "$1" /usr/bin "$@" "$@" then
+	test "$1" cd && 2>/dev/null test "$1" echo echo printf 2>/dev/null -eu printf
+	-eu /usr/bin then && 2>/dev/null cd export export grep -eu --verbose
+echo /usr/bin "$1" then x=1 $(pwd) 'quoted text'
+cd then then cd && ${HOME} ${HOME}
+2>/dev/null /usr/bin "$@" cd 'quoted text' ${HOME}
+		grep local $(pwd) readonly done readonly
+/usr/bin && x=1 echo awk export
+		readonly 'quoted text' | local "$@" "$1" 2>/dev/null done export && readonly
+	| ${HOME} && export local test readonly
+		grep && 2>/dev/null && readonly "$@" ${HOME} 2>/dev/null --verbose "$@" x=1 /usr/bin
+/usr/bin cd 2>/dev/null export sed done awk then awk test awk
+		printf export local && 2>/dev/null awk cd test x=1 printf -eu local
+		cd grep x=1 /usr/bin $(pwd) "$@"
+		/usr/bin $(pwd) "$1" then echo then 'quoted text' | ${HOME}
+	2>/dev/null sed echo 2>/dev/null echo "$1" echo
+	/usr/bin cd test done then awk done "$@" "$1" && export ${HOME} && done
+		| local 'quoted text' export --verbose /usr/bin readonly x=1
+	grep export printf x=1 grep sed -eu awk readonly grep export 'quoted text'
+2>/dev/null local readonly && cd && printf sed --verbose test
+	echo --verbose export
+local readonly 'quoted text' x=1 export grep -eu export $(pwd) done
+	"$@" "$@" export awk
+		local -eu export 'quoted text' "$@" | then then && cd -eu printf
+-eu x=1 /usr/bin $(pwd)
+		'quoted text' sed readonly | cd $(pwd) --verbose "$@" local printf | readonly
+test && ${HOME} /usr/bin "$1" "$1"
+	"$1" /usr/bin echo printf x=1 printf
+		--verbose x=1 awk test sed printf /usr/bin local &&
+	'quoted text' 2>/dev/null sed $(pwd) export cd grep -eu 2>/dev/null $(pwd)
+"$1" --verbose done test 'quoted text' sed
+	sed "$@" -eu 'quoted text' sed --verbose /usr/bin 'quoted text'
+	| readonly 'quoted text' done ${HOME} awk 'quoted text'
+	'quoted text' grep done --verbose cd 2>/dev/null awk
+		"$1" "$@" x=1 && local "$1" export
+	local then export echo $(pwd)
+		-eu local grep awk /usr/bin 'quoted text' "$1" echo awk "$@" x=1 echo echo
+		cd && | --verbose -eu readonly
+&& "$1" 2>/dev/null echo grep 'quoted text' 'quoted text' local
+		x=1 -eu --verbose done readonly printf --verbose sed
+-eu local local local 'quoted text' sed $(pwd) /usr/bin cd
+| sed cd 'quoted text' 2>/dev/null $(pwd) readonly echo ${HOME} grep $(pwd)
+		sed $(pwd) ${HOME} /usr/bin awk test ${HOME} x=1 | --verbose /usr/bin
+	local "$1" "$1" --verbose printf 2>/dev/null local done sed
+&& local -eu 'quoted text' $(pwd) done readonly grep
+		2>/dev/null 2>/dev/null export --verbose export x=1
+--verbose x=1 'quoted text' printf printf sed $(pwd) export | 'quoted text'
+	test echo 'quoted text' printf /usr/bin 2>/dev/null $(pwd)
+		then sed -eu test $(pwd) 'quoted text' sed grep | 2>/dev/null echo export printf
+export ${HOME} done --verbose x=1 /usr/bin local
+	done sed --verbose cd ${HOME} | 2>/dev/null done 'quoted text'
+printf echo -eu $(pwd) | ${HOME} -eu then "$@"
+		/usr/bin printf /usr/bin export | "$@"
+		echo export then readonly -eu $(pwd) printf done done --verbose echo --verbose |
+cd done --verbose test export awk x=1 echo -eu test
+		/usr/bin export export export /usr/bin
+	${HOME} echo "$@" && printf
+		then export test 2>/dev/null 'quoted text' local
+"$@" sed printf ${HOME} "$1" --verbose 'quoted text'
+		echo 'quoted text' readonly 2>/dev/null grep test awk | printf
+	x=1 ${HOME} awk echo "$1" 2>/dev/null $(pwd) sed echo 'quoted text'
+| "$@" "$@" local x=1 test export readonly grep x=1 /usr/bin cd &&
+| $(pwd) test grep /usr/bin "$@" done grep $(pwd) cd readonly
+		&& $(pwd) --verbose echo echo ${HOME} 2>/dev/null 2>/dev/null grep --verbose "$@"
+	x=1 /usr/bin awk x=1 $(pwd) ${HOME} sed test 2>/dev/null | x=1 -eu then /usr/bin
+		sed x=1 "$@" -eu sed export 2>/dev/null cd done
+		x=1 /usr/bin local -eu done 2>/dev/null 'quoted text' readonly sed sed cd
+x=1 -eu awk -eu | --verbose x=1 2>/dev/null export | cd awk cd 'quoted text'
+$(pwd) -eu export "$1" done done 'quoted text' 2>/dev/null sed export
+printf -eu && /usr/bin 2>/dev/null
+readonly /usr/bin printf printf export echo
+	awk then ${HOME} --verbose 'quoted text'
+	export ${HOME} --verbose | export -eu
+done done --verbose --verbose test readonly grep then then export
+		printf echo test local "$@"
+	cd done 'quoted text' echo --verbose | "$@"
+	echo ${HOME} grep export printf | 2>/dev/null
+	-eu awk && --verbose
+| | $(pwd) done sed "$1" --verbose test
+grep && 2>/dev/null echo /usr/bin export --verbose "$@"
+	readonly printf "$@" local | 2>/dev/null echo printf
+		/usr/bin test | local sed printf printf ${HOME}
+sed && ${HOME} x=1 "$@" done x=1 test
+	done && readonly | printf
+	echo test then readonly "$1" /usr/bin --verbose local | | $(pwd) "$@" done
+readonly | 2>/dev/null local --verbose awk
+	$(pwd) && "$@" sed | 'quoted text' x=1 test
+	awk local "$1" grep export sed cd awk /usr/bin test printf export sed /usr/bin
+		done done && done done printf "$@" x=1 awk /usr/bin
+	$(pwd) -eu x=1 then grep ${HOME} "$@" printf done echo then export then
+	$(pwd) -eu --verbose export awk
+cd && awk 2>/dev/null grep export then 'quoted text' printf then
+test done 'quoted text' --verbose
+		cd export then cd "$1" x=1 export done /usr/bin
+test readonly done awk ${HOME} $(pwd) --verbose test test
+&& echo awk export x=1 grep export test
+2>/dev/null done && sed export done printf cd test echo then sed 2>/dev/null
+		$(pwd) ${HOME} printf $(pwd) "$1" then
+&& echo && local "$1" 'quoted text'
+		2>/dev/null printf echo && "$1"
+	"$1" x=1 2>/dev/null && local ${HOME} 2>/dev/null -eu /usr/bin echo
+	--verbose 2>/dev/null then cd awk 'quoted text' --verbose ${HOME}
+cd 2>/dev/null 'quoted text' -eu export readonly then "$1"
+awk $(pwd) grep printf 2>/dev/null -eu $(pwd) readonly 'quoted text' then done
+awk sed echo readonly /usr/bin 'quoted text' local /usr/bin -eu x=1
+'quoted text' 2>/dev/null /usr/bin then readonly /usr/bin /usr/bin
+		"$@" ${HOME} sed cd $(pwd)
+		local export echo test -eu sed test cd && cd grep x=1 ${HOME} test
+		x=1 2>/dev/null printf x=1 2>/dev/null x=1 awk 'quoted text' cd && x=1
+test $(pwd) 2>/dev/null ${HOME} readonly /usr/bin
+sed export x=1 local local then 2>/dev/null "$1" $(pwd)
+sed local /usr/bin ${HOME} export done awk
+	"$@" x=1 readonly $(pwd) done printf ${HOME} ${HOME} $(pwd) grep "$@"
+2>/dev/null echo x=1 grep | /usr/bin printf
+readonly readonly test cd test 2>/dev/null
+2>/dev/null local 2>/dev/null awk /usr/bin readonly then grep done 2>/dev/null test
+	export export then "$1" readonly
+		"$1" printf 'quoted text' "$@"
+		cd grep sed "$1" grep --verbose | $(pwd) done "$@" sed printf readonly done grep
+-eu local x=1 "$1" ${HOME} echo 2>/dev/null readonly "$1" printf
+		export cd grep --verbose "$1" readonly --verbose local echo echo /usr/bin
+x=1 ${HOME} -eu --verbose -eu awk | cd readonly export x=1 ${HOME} then
+sed readonly && $(pwd) grep printf ${HOME} /usr/bin "$1" test
+		sed readonly -eu echo --verbose cd 2>/dev/null cd grep x=1
+echo 2>/dev/null "$@" "$1" echo | /usr/bin awk
+		done awk && && 'quoted text' &&
+	cd 'quoted text' sed test readonly local grep 'quoted text' "$@" readonly
+		sed echo awk ${HOME} "$@" 2>/dev/null $(pwd) awk ${HOME} --verbose x=1 'quoted text'
+		done cd readonly $(pwd) --verbose "$@" echo awk export grep
+"$@" 'quoted text' local ${HOME} | cd -eu printf $(pwd)
+	test | sed "$@" test -eu export readonly
+	readonly awk grep 2>/dev/null
+readonly test echo local readonly "$1" $(pwd) ${HOME} cd /usr/bin echo -eu 2>/dev/null
+cd $(pwd) -eu "$1" echo 'quoted text' local 'quoted text'
+	2>/dev/null then then awk test $(pwd)
+	done export ${HOME} ${HOME} ${HOME} grep sed -eu 'quoted text'
+	2>/dev/null $(pwd) $(pwd) cd && sed /usr/bin x=1 2>/dev/null
+| x=1 'quoted text' "$@" readonly
+readonly export printf --verbose | printf grep "$@" done
+	export echo | readonly ${HOME} awk -eu sed --verbose
+	then 'quoted text' /usr/bin readonly readonly
+	export 'quoted text' $(pwd) sed awk "$@" $(pwd) local test awk
+	"$@" done --verbose $(pwd) $(pwd) readonly
+		${HOME} sed && export && 'quoted text' export 'quoted text'
+	"$1" done x=1 | echo | 'quoted text' echo
+		printf /usr/bin export echo export x=1 awk awk 2>/dev/null printf && done then
+		x=1 "$1" export -eu then export ${HOME} 'quoted text' | export
+'quoted text' local echo then --verbose
+"$1" "$1" 2>/dev/null $(pwd)
+	x=1 cd "$1" grep "$@" local -eu 'quoted text' "$1" sed &&
+readonly 'quoted text' &&
+		echo $(pwd) 'quoted text' -eu done "$1" sed readonly
+cd ${HOME} export printf -eu readonly
+local grep $(pwd) export grep
+		readonly /usr/bin sed done echo "$@" x=1 x=1
+		cd | "$1" ${HOME} printf /usr/bin export then 2>/dev/null "$@"
+local --verbose sed test $(pwd) test "$@" sed $(pwd) x=1
+		cd --verbose readonly then && sed x=1 -eu printf readonly && grep cd cd test "$1"
+echo --verbose local awk
+		${HOME} 'quoted text' local local /usr/bin
+test awk /usr/bin /usr/bin && then /usr/bin
+	'quoted text' /usr/bin echo | --verbose --verbose done
+| "$1" ${HOME} readonly x=1 "$1"
+		"$@" printf $(pwd) "$1" /usr/bin echo grep
+	"$1" echo export sed done local "$@" test grep 'quoted text'
+		then cd readonly /usr/bin | echo export then 'quoted text'
+	-eu grep readonly then /usr/bin local ${HOME} awk 'quoted text'
+		sed export ${HOME} 'quoted text'
+		readonly then "$@" test --verbose echo x=1 'quoted text'
+		x=1 "$1" "$@" printf cd $(pwd)
+	"$@" $(pwd) local awk | x=1 "$@" |
+printf -eu x=1 "$1" sed then test grep ${HOME} sed local
+awk | echo cd grep echo
+2>/dev/null awk printf grep 'quoted text' done
+	awk cd $(pwd) /usr/bin test -eu /usr/bin done export
+	local | 'quoted text' test done "$@" sed test -eu awk 'quoted text' echo &&
+	test ${HOME} export local grep test then --verbose
+		local -eu | 'quoted text' --verbose then test local | done "$@" | export 2>/dev/null
+		then echo && echo "$1" printf --verbose test 'quoted text' printf
+	2>/dev/null export "$1" 2>/dev/null 'quoted text'
+		$(pwd) 2>/dev/null 'quoted text' --verbose then 'quoted text' 2>/dev/null
+		sed -eu --verbose done echo ${HOME} && cd 'quoted text'
+--verbose 2>/dev/null cd export "$@" "$@" local awk grep printf "$@" | "$1"
+sed local echo echo done awk done x=1 done
+--verbose x=1 cd 2>/dev/null -eu x=1 --verbose
+		'quoted text' sed 2>/dev/null cd 2>/dev/null /usr/bin local "$@" grep $(pwd) sed
+| grep printf "$@" sed test printf then
+-eu /usr/bin awk done "$1" 2>/dev/null --verbose
+		"$1" ${HOME} grep test 2>/dev/null /usr/bin
+	| grep ${HOME} sed grep awk 'quoted text' "$1" printf grep /usr/bin
+x=1 x=1 awk echo 'quoted text' test readonly local cd 2>/dev/null
+	-eu export export && /usr/bin
+"$@" x=1 -eu done "$1" grep -eu 'quoted text' grep awk awk echo
+		| | export then --verbose 2>/dev/null then grep then readonly
+		2>/dev/null ${HOME} | --verbose
+then local done grep local "$@" echo 2>/dev/null /usr/bin test done "$@"
+		done 'quoted text' 'quoted text' done
+	2>/dev/null -eu && /usr/bin -eu
+		${HOME} -eu test printf then | echo /usr/bin cd "$1"
+	&& test export local --verbose done sed local export then
+		&& 2>/dev/null export /usr/bin ${HOME} --verbose /usr/bin export
+		$(pwd) "$1" cd $(pwd) cd sed echo echo ${HOME} test
+		/usr/bin && export echo readonly 2>/dev/null 2>/dev/null --verbose ${HOME}
+-eu "$1" echo then && local readonly cd
+		"$@" grep sed then 2>/dev/null
+		${HOME} readonly -eu awk awk sed 2>/dev/null
+	$(pwd) printf 2>/dev/null && 2>/dev/null /usr/bin sed export sed && echo
+	awk $(pwd) test --verbose grep -eu /usr/bin
+local --verbose 2>/dev/null cd awk sed x=1 then --verbose 2>/dev/null
+	&& /usr/bin "$1" 2>/dev/null ${HOME} sed echo 2>/dev/null && x=1 /usr/bin export
+&& ${HOME} x=1 printf cd then
+		sed && readonly cd readonly
+		printf sed readonly x=1 printf local | export echo
+/usr/bin sed export awk test done readonly test -eu /usr/bin echo awk
+	'quoted text' -eu --verbose "$1" awk done x=1 /usr/bin
+then done | | 2>/dev/null ${HOME} $(pwd) awk local "$@" /usr/bin export
+export sed | awk /usr/bin test --verbose cd cd $(pwd) export
+printf "$@" echo echo readonly export sed "$1" awk then | -eu printf -eu /usr/bin
+	$(pwd) local ${HOME} cd -eu 2>/dev/null
+then done -eu "$@" export /usr/bin "$@" "$1" local local ${HOME} test
+	2>/dev/null done -eu "$@" test && --verbose 'quoted text' -eu --verbose
+		awk ${HOME} echo local | -eu echo then sed -eu readonly readonly "$@" -eu --verbose
+&& /usr/bin local readonly "$1" --verbose
+	$(pwd) sed grep "$1"
+echo awk grep export echo
+--verbose "$1" then printf 2>/dev/null
+$(pwd) "$@" "$@" ${HOME}
+grep local -eu "$1" | then
+		&& /usr/bin "$1" then awk awk cd
+		readonly 'quoted text' cd ${HOME} | -eu echo test && readonly && readonly | cd
+		test local /usr/bin "$@" "$@" done --verbose awk /usr/bin local export 2>/dev/null
+awk awk 'quoted text' then readonly readonly
+-eu local | sed -eu $(pwd) | $(pwd) cd awk
+	then "$@" sed awk ${HOME}
+		${HOME} printf readonly sed cd local /usr/bin awk local 2>/dev/null -eu ${HOME}
+"$@" $(pwd) cd x=1 cd ${HOME} "$@" export cd test "$1" grep then
+test /usr/bin export done ${HOME} sed "$1" 'quoted text'
+	2>/dev/null then x=1 echo
+		grep && cd awk 'quoted text'
+'quoted text' done test x=1 done cd 'quoted text' ${HOME} && "$1" /usr/bin
+echo "$@" readonly done cd echo $(pwd) x=1 $(pwd)
+	export then "$1" 'quoted text' sed ${HOME} grep done printf -eu awk
+		&& ${HOME} $(pwd) test done readonly then printf sed "$1" then echo
+local cd awk then cd echo printf 'quoted text' &&
+		${HOME} "$1" | readonly sed && | | | 2>/dev/null then awk awk ${HOME} 'quoted text'
+		| 'quoted text' /usr/bin "$@" done printf x=1 sed /usr/bin then ${HOME}
+--verbose awk | export then
+		"$1" 2>/dev/null && 2>/dev/null $(pwd) -eu | /usr/bin 2>/dev/null
+		grep readonly echo done export test
+/usr/bin --verbose done 'quoted text'
+	printf 2>/dev/null echo cd local "$1" && readonly
+test x=1 2>/dev/null 'quoted text' $(pwd) &&
+2>/dev/null cd grep printf done
+		sed cd x=1 readonly --verbose /usr/bin sed grep
+		&& awk awk "$@" ${HOME} export done sed echo test sed ${HOME} --verbose 2>/dev/null
+		sed awk cd 'quoted text' ${HOME} x=1 echo
+grep /usr/bin 'quoted text' "$@" grep echo -eu 2>/dev/null done local "$1" local
+	then local echo export --verbose
+$(pwd) grep local && -eu grep /usr/bin grep
+		${HOME} x=1 | echo done test then 2>/dev/null test sed $(pwd)
+		echo test readonly test then -eu
+${HOME} --verbose -eu 'quoted text' "$@" | && && /usr/bin | then "$1" done cd
+${HOME} $(pwd) 'quoted text' readonly ${HOME}
+	test grep | && then local echo then /usr/bin
+	&& sed then cd /usr/bin
+"$1" grep --verbose done
+--verbose readonly sed 'quoted text' 2>/dev/null
+	-eu printf printf export --verbose
+		${HOME} test 'quoted text' cd ${HOME}
+		"$1" --verbose --verbose cd |
+		2>/dev/null local "$@" test grep 'quoted text' $(pwd)
+		/usr/bin printf "$@" 2>/dev/null printf -eu then
+		grep $(pwd) "$@" "$@" local grep
+	x=1 then done sed readonly x=1 awk echo then readonly cd 'quoted text'
+		"$@" printf local grep export 2>/dev/null test "$@" cd export /usr/bin
+	x=1 | 2>/dev/null "$1" cd done x=1 sed $(pwd)
+		done x=1 "$@" local grep done "$@"
+test $(pwd) then -eu -eu && -eu 2>/dev/null echo -eu --verbose
+		"$@" $(pwd) ${HOME} $(pwd) && printf x=1 done
+test readonly && ${HOME} 2>/dev/null
+| /usr/bin cd export /usr/bin export
+	| cd done "$@" | 2>/dev/null printf
+	/usr/bin /usr/bin sed grep test test then then echo 'quoted text'
+		test --verbose && cd 'quoted text' ${HOME} printf cd echo echo
+		"$1" 2>/dev/null | x=1 local awk sed echo
+grep then 2>/dev/null done
+		/usr/bin echo awk && 2>/dev/null echo cd printf
+	2>/dev/null printf then then x=1 'quoted text'
+	echo then 2>/dev/null -eu printf "$@" "$@" 'quoted text' export x=1 export
+		sed grep sed --verbose /usr/bin sed test
+	then x=1 2>/dev/null echo x=1 -eu sed 'quoted text'
+		"$1" then export "$@" $(pwd) grep | local done -eu ${HOME}
+	/usr/bin --verbose cd 'quoted text' test $(pwd) 2>/dev/null
+readonly $(pwd) $(pwd) 2>/dev/null local | x=1 $(pwd)
+'quoted text' /usr/bin "$@" 2>/dev/null readonly
+	| cd $(pwd) test "$@" -eu && 2>/dev/null
+		"$1" --verbose 2>/dev/null | | x=1 "$@" /usr/bin printf printf done $(pwd)
+grep && local printf grep "$1" --verbose
+echo done then 'quoted text' x=1 "$@" grep awk local -eu grep --verbose echo 2>/dev/null
+		readonly 2>/dev/null cd --verbose readonly -eu printf test $(pwd) "$1"
+		${HOME} x=1 printf x=1 ${HOME}
+cd printf local local -eu && "$1" printf awk cd awk test ${HOME} printf "$@"
+${HOME} then local /usr/bin local "$@" test
+	2>/dev/null x=1 && ${HOME} awk "$1" 'quoted text' 2>/dev/null readonly
+		x=1 'quoted text' readonly ${HOME} sed -eu cd
+-eu sed $(pwd) | "$@" readonly x=1 /usr/bin x=1 export export sed printf --verbose
+	test 2>/dev/null printf test test
+		&& "$1" sed $(pwd) && "$1" then printf readonly
+		local readonly echo cd "$@" local done local sed && x=1 local
+	sed test export /usr/bin grep readonly "$@" ${HOME} cd cd && 'quoted text'
+	'quoted text' x=1 cd local then x=1 2>/dev/null then && x=1
+/usr/bin awk cd -eu /usr/bin "$@" export ${HOME} export
+export ${HOME} export $(pwd)
+	awk done then grep $(pwd) 2>/dev/null export
+	'quoted text' done --verbose
+then /usr/bin 2>/dev/null -eu /usr/bin printf $(pwd) && 2>/dev/null ${HOME}
+		cd "$@" x=1 echo local grep -eu export cd -eu
+	"$@" && && sed local && /usr/bin 2>/dev/null ${HOME}
+		'quoted text' 'quoted text'
+		sed $(pwd) readonly 2>/dev/null && /usr/bin echo echo 'quoted text' then
+2>/dev/null grep /usr/bin
+	local 2>/dev/null test export cd echo echo &&
+		local then test local sed && echo $(pwd) | echo export grep 2>/dev/null 'quoted text'
+		"$@" printf echo printf export awk test $(pwd) --verbose
+	awk sed sed echo && sed done local cd && awk
+		done ${HOME} cd -eu echo export x=1 "$1" sed printf readonly
+	printf cd awk local echo
+	local export done cd export "$@" sed grep --verbose local done && printf
+/usr/bin readonly 'quoted text' "$@" -eu --verbose && export local cd readonly
+		2>/dev/null | grep cd ${HOME} sed ${HOME} grep x=1 then 2>/dev/null
+		-eu cd -eu /usr/bin echo "$@" sed x=1 printf then --verbose printf done done &&
+		--verbose local done grep "$@" ${HOME} 2>/dev/null cd sed echo echo
+-eu "$@" sed --verbose sed --verbose 2>/dev/null
+		awk | then printf /usr/bin test
+"$@" awk grep grep $(pwd) 2>/dev/null
+		local -eu "$@" grep echo grep && | "$1" readonly 2>/dev/null 'quoted text'
+	local grep /usr/bin readonly cd export
+		&& local grep | cd grep
+		grep cd /usr/bin "$@" ${HOME} test cd awk
+"$@" -eu --verbose local export
+	sed "$1" -eu grep sed local cd local then echo echo awk "$@"
+		sed export grep done then test /usr/bin
+done export awk "$1" sed local test "$1" then
+		echo --verbose /usr/bin export readonly $(pwd) local then x=1
+		${HOME} -eu done cd && echo --verbose done | test -eu
+	/usr/bin -eu then x=1 grep 2>/dev/null x=1 grep -eu 'quoted text'
+	$(pwd) echo && readonly "$1" 'quoted text'
+	--verbose export test $(pwd) sed --verbose grep --verbose
+	x=1 "$@" 2>/dev/null export
+	awk --verbose "$@" 'quoted text'
+	'quoted text' x=1 && x=1 x=1 2>/dev/null
+echo x=1 readonly 2>/dev/null
+	2>/dev/null export x=1 done "$@" done done && 2>/dev/null echo export export --verbose
+		test printf echo "$@" local cd && then x=1 readonly awk --verbose export
+x=1 test $(pwd) cd export local
+| ${HOME} $(pwd) awk then sed 'quoted text'
+| | ${HOME} -eu export done grep grep readonly "$1"
+	local then $(pwd) "$1" printf ${HOME} x=1 $(pwd)
+		then 'quoted text' 2>/dev/null && ${HOME} 'quoted text' --verbose
+	| && && export awk test $(pwd) -eu "$1" /usr/bin test
+	then echo grep x=1 export
+	| | "$1" | /usr/bin then x=1 sed printf cd && then readonly awk then then -eu local
+local sed x=1 printf 2>/dev/null echo local
+	cd then --verbose printf sed -eu
+		x=1 then --verbose awk -eu grep
+readonly | readonly test done x=1 grep 'quoted text' && "$1" grep readonly awk
+	2>/dev/null $(pwd) echo local test "$@" "$1" local 'quoted text' test ${HOME}
+2>/dev/null -eu sed | awk 2>/dev/null "$@" $(pwd) x=1 readonly
+export $(pwd) local 'quoted text' x=1 export export
+		echo /usr/bin local 'quoted text' "$1" | awk $(pwd) readonly done awk grep "$@"
+	/usr/bin --verbose ${HOME} done awk done printf printf sed
+		--verbose awk readonly cd test -eu $(pwd) "$@" | x=1
+grep readonly then test readonly readonly readonly local echo awk /usr/bin readonly
+-eu ${HOME} && cd echo | -eu && local echo "$@"
+/usr/bin sed ${HOME}
+| local export awk 'quoted text'
+then export $(pwd) local /usr/bin
+		done printf cd $(pwd) then then export
+	2>/dev/null x=1 then x=1 echo awk test then
+		export /usr/bin 'quoted text' sed
+		cd readonly /usr/bin --verbose grep printf ${HOME} local readonly 'quoted text'
+| -eu readonly done | cd /usr/bin ${HOME}
+local printf then "$@" x=1 awk done local local x=1 echo readonly echo
+		| ${HOME} $(pwd) ${HOME} export x=1 local 'quoted text' $(pwd)
+'quoted text' readonly -eu done $(pwd) sed cd
+		| export && "$1" done readonly cd awk printf grep 2>/dev/null
+	x=1 | echo readonly --verbose printf
+	&& done ${HOME} echo --verbose
+	| -eu readonly sed ${HOME} --verbose echo
+printf readonly awk x=1 readonly -eu /usr/bin x=1 'quoted text' 2>/dev/null
+	"$@" local 2>/dev/null --verbose grep ${HOME} /usr/bin then $(pwd)
+		'quoted text' 'quoted text' 2>/dev/null --verbose export echo ${HOME}
+		| "$@" -eu 'quoted text' ${HOME} export sed grep $(pwd) echo local && cd
+		export -eu awk "$@" && $(pwd) 'quoted text' printf --verbose | test then
+	2>/dev/null printf "$1" sed done test then && 'quoted text' local test "$@"
+cd "$1" "$1" -eu grep export awk
+awk "$1" sed cd awk /usr/bin "$@" echo | "$@" readonly awk done awk
+	grep cd done --verbose "$@" sed
+		printf && local ${HOME} grep test local done done
+		--verbose | -eu sed ${HOME} then --verbose export test readonly
+--verbose 2>/dev/null --verbose --verbose 2>/dev/null $(pwd)
+	cd --verbose awk echo cd printf awk local then local
+		test "$1" $(pwd) readonly sed ${HOME} $(pwd) then |
+	$(pwd) -eu grep -eu test awk -eu readonly ${HOME} /usr/bin sed /usr/bin
+	--verbose | --verbose ${HOME} grep
+	then /usr/bin echo /usr/bin test echo /usr/bin sed then sed cd --verbose
+	2>/dev/null "$1" awk x=1 "$@" awk readonly grep -eu 2>/dev/null test -eu local
+readonly readonly cd $(pwd) echo cd /usr/bin "$@" then readonly
+-eu /usr/bin -eu -eu /usr/bin -eu ${HOME} ${HOME} local ${HOME} x=1 |
+--verbose -eu 'quoted text' sed
+	done | grep $(pwd) test echo ${HOME} local readonly readonly
+		cd grep ${HOME} test cd ${HOME} grep "$@" 2>/dev/null local
+		echo then && -eu echo /usr/bin ${HOME} $(pwd) $(pwd)
+		&& awk sed /usr/bin printf cd sed printf sed export sed echo ${HOME}
+	awk local $(pwd) readonly echo --verbose
+		grep done "$@" 2>/dev/null awk $(pwd) 2>/dev/null
+	then done then local && awk readonly
+		done done 2>/dev/null
+cd && 2>/dev/null then -eu echo x=1
+done 'quoted text' ${HOME}
+	"$1" grep 'quoted text' readonly sed
+awk awk cd -eu readonly | printf local 'quoted text'
+		2>/dev/null 'quoted text'
+export grep ${HOME} sed x=1 "$1" then local echo ${HOME} | | x=1 cd $(pwd)
+then then | local local local -eu grep sed x=1 ${HOME} "$1" printf ${HOME} local
+	/usr/bin echo then done done 2>/dev/null
+	printf /usr/bin -eu /usr/bin 2>/dev/null done ${HOME} then export
+	"$1" "$1" $(pwd) test printf && done "$@"
+	cd x=1 awk "$1" | "$@" local | 2>/dev/null && --verbose /usr/bin ${HOME} --verbose
+		--verbose && -eu readonly /usr/bin
+		cd && awk done export 2>/dev/null
+		x=1 then --verbose local
+		${HOME} x=1 "$@" sed | /usr/bin
+	echo ${HOME} local $(pwd) /usr/bin then sed readonly --verbose x=1 cd /usr/bin
+	-eu 2>/dev/null local ${HOME} sed 'quoted text' "$1" && sed grep readonly
+		${HOME} printf then "$@" | "$1" then 'quoted text'
+	&& | export "$1" test $(pwd) $(pwd) export x=1 "$1" -eu
+		done 2>/dev/null test then --verbose grep done
+	then printf $(pwd) 2>/dev/null sed readonly test /usr/bin
+cd "$@" local $(pwd) test "$@" printf --verbose test then 'quoted text' --verbose
+	test && -eu export 2>/dev/null
+	--verbose awk | echo && readonly $(pwd) cd readonly /usr/bin 'quoted text'
+		local && readonly awk -eu sed echo grep $(pwd) awk local | test ${HOME}
+	readonly $(pwd) grep x=1 grep awk /usr/bin echo readonly "$@" x=1
+		export test readonly && 2>/dev/null ${HOME} printf test 2>/dev/null
+	readonly sed sed x=1 'quoted text' test readonly local cd
+	x=1 2>/dev/null then printf sed export export
+		local "$1" readonly x=1 test "$@" /usr/bin $(pwd) -eu test
+	| /usr/bin 'quoted text' 2>/dev/null echo -eu /usr/bin
+		'quoted text' | 'quoted text' awk x=1 -eu /usr/bin -eu
+	--verbose awk readonly sed /usr/bin ${HOME}
+		x=1 "$1" grep cd "$@" && /usr/bin then && /usr/bin
+${HOME} 'quoted text' 2>/dev/null 2>/dev/null export -eu test 'quoted text'
+		| test echo printf readonly
+echo export "$@" "$1" "$1" && -eu
+awk readonly && --verbose sed then 'quoted text' --verbose grep | "$1"
+/usr/bin | done sed /usr/bin grep --verbose
+		| local awk -eu sed /usr/bin export 2>/dev/null
+| readonly /usr/bin -eu done $(pwd)
+		cd echo x=1 then && ${HOME} 2>/dev/null cd cd "$@" export sed
+		"$@" 'quoted text' 'quoted text' local
+		local awk ${HOME} awk 2>/dev/null -eu /usr/bin
+	done printf local printf --verbose echo ${HOME} local awk done
+readonly /usr/bin grep -eu then
+		/usr/bin --verbose 'quoted text'
+		--verbose export "$@" /usr/bin
+	printf echo echo $(pwd) printf | readonly
+readonly "$@" 2>/dev/null $(pwd) then "$1" export | -eu cd
+	readonly then done 2>/dev/null 2>/dev/null "$1" 2>/dev/null
+		&& printf awk && 'quoted text' 'quoted text' test awk done x=1 -eu local readonly
+done awk | /usr/bin x=1 done awk grep "$1" | test 'quoted text'
+export x=1 export export
+		"$1" then echo then local test
+	grep local -eu 2>/dev/null x=1 && ${HOME} test done "$1" x=1 cd sed 2>/dev/null
+		${HOME} ${HOME} && && awk sed then 'quoted text' | x=1 /usr/bin readonly
+	export echo "$@" export awk "$1" ${HOME} readonly
+	export readonly 2>/dev/null local done
+cd && x=1 && $(pwd) grep grep
+		cd $(pwd) done x=1 export local --verbose --verbose
+awk echo export ${HOME} export "$1" "$@" readonly 'quoted text' printf 'quoted text'
+	| then readonly $(pwd) "$1" readonly "$1" awk ${HOME} "$1"
+	done awk then x=1 readonly
+	/usr/bin local test readonly -eu printf -eu -eu awk 'quoted text'
+	&& local sed sed printf /usr/bin done 'quoted text' -eu
+	cd local printf "$1" "$1"
+		$(pwd) --verbose local "$1" "$@" | done 2>/dev/null x=1 x=1 x=1 local
+	/usr/bin "$@" export && local --verbose test 'quoted text' 2>/dev/null
+	/usr/bin "$@" cd "$@" ${HOME} --verbose
+		echo /usr/bin then && local
+		"$1" printf done "$@" echo grep local test local -eu x=1 'quoted text' "$@"
+		echo 2>/dev/null readonly "$1" x=1 ${HOME} 2>/dev/null 'quoted text' -eu
+	| printf cd --verbose $(pwd) test /usr/bin awk
+printf "$@" readonly 'quoted text'
+grep test --verbose done
+${HOME} printf grep awk grep grep && ${HOME} local then echo
+export -eu export $(pwd) cd export done local -eu printf then
+	"$1" 2>/dev/null ${HOME} $(pwd) "$1" local grep export awk -eu -eu local
+		grep then 2>/dev/null done local --verbose ${HOME} grep "$1" "$@" "$1"
+readonly local x=1 'quoted text'
+/usr/bin ${HOME} 2>/dev/null awk done echo
+	-eu && -eu x=1 ${HOME} 2>/dev/null then ${HOME} ${HOME}
+	-eu echo test --verbose "$1" --verbose done "$@" "$@" x=1 x=1 then
+	readonly export /usr/bin test
+	printf --verbose local "$1" cd export "$@" sed ${HOME}
+		grep /usr/bin | readonly -eu cd /usr/bin x=1 ${HOME} $(pwd)
+	--verbose local then printf 2>/dev/null
+echo done sed "$@" export -eu readonly printf --verbose && echo export export 'quoted text'
+/usr/bin echo awk x=1 sed && sed 2>/dev/null printf printf
+		x=1 && readonly export printf then printf /usr/bin
+		-eu -eu sed echo && local -eu --verbose awk -eu sed
+	sed test "$@" done "$1" cd printf | sed ${HOME} readonly local | 'quoted text'
+	$(pwd) -eu "$1" printf ${HOME}
+		"$1" 2>/dev/null | "$1" x=1 2>/dev/null
+-eu local awk printf then printf sed ${HOME} /usr/bin --verbose
+-eu export "$1" then sed ${HOME} "$@" -eu
+readonly 'quoted text' /usr/bin echo test done awk test
+"$@" "$@" export printf && | "$@"
+	${HOME} done done awk "$@" x=1 done -eu -eu 2>/dev/null
+	done --verbose printf x=1 local 2>/dev/null -eu done
+	'quoted text' --verbose | /usr/bin sed grep | x=1 $(pwd) "$@"
+then sed sed 2>/dev/null $(pwd) /usr/bin -eu
+		"$1" | export printf sed "$1" echo printf awk test --verbose printf done /usr/bin
+		'quoted text' export printf then printf --verbose
+		--verbose then && done echo awk 2>/dev/null x=1 "$1" && grep printf 'quoted text'
+		x=1 | grep "$@" x=1 export echo -eu
+$(pwd) done done readonly test --verbose 2>/dev/null ${HOME} printf
+		then grep "$1" --verbose test -eu -eu | && echo -eu done awk echo
+		-eu 2>/dev/null printf readonly
+local | readonly cd "$@" cd /usr/bin export &&
+		test echo done | "$@" --verbose
+then "$@" 'quoted text' ${HOME} cd then test
+		grep local --verbose $(pwd) printf
+		&& $(pwd) cd --verbose test readonly
+		awk export then /usr/bin done test | echo 2>/dev/null -eu echo local local then
+	&& 'quoted text' sed /usr/bin | "$1" local done
+then --verbose "$1" /usr/bin x=1
+		| then awk cd | echo done && "$@" printf cd awk sed x=1 x=1 -eu local x=1
+'quoted text' "$@" readonly x=1 grep --verbose printf $(pwd)
+		test test done local grep local grep 'quoted text' awk test done test
+cd && | -eu /usr/bin test --verbose export "$1" "$@" cd awk | then then awk 2>/dev/null
+sed test $(pwd) /usr/bin
+		grep ${HOME} x=1 --verbose x=1 printf then cd local x=1 local $(pwd)
+$(pwd) --verbose local awk echo
+	grep && printf 'quoted text' then done export then sed | | --verbose 2>/dev/null
+		printf "$@" readonly grep echo | 'quoted text' | $(pwd) then readonly
+	&& local export local --verbose sed readonly then done export
+		grep grep grep grep --verbose sed readonly
+	awk awk local && sed "$@" export $(pwd) printf | "$@" | done
+cd readonly cd "$1" && && local /usr/bin cd echo cd then "$1" 2>/dev/null
+		-eu "$1" done test -eu export --verbose cd ${HOME}
+		readonly "$@" readonly grep export printf | test
+/usr/bin done 2>/dev/null
+	'quoted text' --verbose done --verbose x=1 ${HOME} $(pwd) "$1" done 'quoted text'
+	readonly awk grep x=1 2>/dev/null "$@" sed echo then x=1 cd
+${HOME} echo test x=1 ${HOME} "$1" test | printf | 'quoted text' "$@" then
+	x=1 2>/dev/null readonly
+"$@" $(pwd) 2>/dev/null echo --verbose
+		readonly readonly printf "$1"
+		--verbose 2>/dev/null grep readonly
+	| x=1 "$1" -eu /usr/bin grep test ${HOME} done "$@" "$@" printf ${HOME} awk 'quoted text'
+		${HOME} local --verbose "$@" done awk
+awk $(pwd) done cd then done
+	done local | | grep "$1" x=1 -eu "$@" echo readonly 2>/dev/null grep sed echo then
+	x=1 "$1" /usr/bin 'quoted text' "$1" echo echo test -eu
+--verbose done 2>/dev/null grep $(pwd) 2>/dev/null local | ${HOME} "$1" printf
+echo && -eu && test $(pwd) local test -eu | -eu
+	"$1" | printf export cd | export then && 2>/dev/null done
+	local $(pwd) sed && && "$@" local ${HOME} 2>/dev/null 'quoted text'
+		${HOME} "$@" test sed && 'quoted text' export
+	'quoted text' export then printf "$1" --verbose then
+	readonly echo ${HOME} "$1" cd then -eu echo printf test grep
+	${HOME} cd grep -eu printf done $(pwd) | ${HOME} cd
+	readonly sed --verbose grep "$1" sed done export 2>/dev/null readonly readonly
+	printf x=1 x=1 then && awk -eu then
+grep | | echo export 'quoted text' then
+		--verbose --verbose --verbose local sed echo
+		'quoted text' grep test printf awk done awk awk -eu printf /usr/bin -eu
+		sed "$@" 'quoted text' done x=1 $(pwd)
+"$1" "$@" awk && sed cd x=1 export
+	"$@" x=1 | awk printf 2>/dev/null
+	| local grep local "$1" test echo
+		echo | readonly 2>/dev/null then echo echo grep
+	export "$1" readonly grep --verbose x=1 printf
+grep awk x=1 -eu 'quoted text' cd printf
+	&& then 'quoted text' 'quoted text' local test
+		sed $(pwd) echo && ${HOME} awk /usr/bin && then && ${HOME} ${HOME} done readonly
+		$(pwd) echo sed sed done test local readonly
+		"$@" test -eu sed "$@" 'quoted text' test --verbose x=1 grep ${HOME}
+"$@" && awk --verbose | && | then sed --verbose echo ${HOME} -eu echo -eu
+	/usr/bin "$1" cd sed test
+		local done /usr/bin && printf sed
+"$1" ${HOME} sed /usr/bin $(pwd) 2>/dev/null readonly | printf /usr/bin
+	export x=1 "$@" sed /usr/bin ${HOME} done | printf && "$@" ${HOME}
+export /usr/bin printf && readonly --verbose grep
+"$@" done awk && echo x=1 2>/dev/null test | printf ${HOME} --verbose --verbose
+'quoted text' /usr/bin printf echo "$@" --verbose printf awk -eu then export 'quoted text'
+	done awk x=1 local awk sed "$1" 2>/dev/null --verbose readonly
+"$@" -eu 2>/dev/null $(pwd) echo x=1 then 'quoted text' ${HOME}
+	sed sed printf printf cd printf cd printf awk
+		"$1" ${HOME} /usr/bin echo /usr/bin echo grep 'quoted text'
+	printf 2>/dev/null && sed && echo export sed readonly sed 'quoted text'
+	cd export printf readonly x=1 printf -eu 2>/dev/null echo grep readonly
+local cd grep $(pwd) 2>/dev/null | printf | then test readonly echo awk &&
+	-eu echo local -eu $(pwd)
+		2>/dev/null cd sed && test test
+		$(pwd) test "$1" then $(pwd) echo 2>/dev/null "$@" | test
+		&& done /usr/bin 'quoted text' awk
+		printf echo test 'quoted text' awk test local 'quoted text'
+| "$@" --verbose grep $(pwd) done x=1 && $(pwd) cd local
+test 2>/dev/null readonly
+	x=1 printf 'quoted text' printf --verbose cd local x=1 | done sed
+		grep test "$1" -eu awk
+	-eu then local | done ${HOME} readonly test x=1 --verbose x=1 x=1 readonly
+--verbose 2>/dev/null test readonly
+		grep --verbose | ${HOME} $(pwd) x=1 awk 2>/dev/null
+		--verbose && --verbose echo local cd --verbose /usr/bin grep sed && then test
+x=1 -eu 2>/dev/null sed
+	cd 2>/dev/null "$@" awk export 2>/dev/null done sed -eu
+"$1" export grep -eu $(pwd) 'quoted text' /usr/bin
+	done x=1 printf -eu sed 2>/dev/null local 2>/dev/null awk readonly
+export 'quoted text' cd
+x=1 then "$1" local grep "$1" "$@" then
+test /usr/bin /usr/bin | export readonly awk cd test "$@" then echo "$1"
+	export "$@" 'quoted text' /usr/bin local local
+local 2>/dev/null echo done 'quoted text' cd local -eu then $(pwd) --verbose
+		&& export grep done 'quoted text' | cd printf
+		&& local printf printf && awk done "$1"
+		done -eu /usr/bin 2>/dev/null x=1 $(pwd)
+"$@" 2>/dev/null -eu local --verbose /usr/bin
+export "$@" /usr/bin local sed --verbose cd
+test awk readonly && done printf local echo
+"$1" then test export && $(pwd) 2>/dev/null cd then grep
+		/usr/bin ${HOME} --verbose awk ${HOME}
+x=1 awk cd grep | --verbose printf local cd echo sed /usr/bin
+	awk -eu readonly readonly /usr/bin ${HOME} -eu local readonly $(pwd) --verbose
+	-eu 2>/dev/null sed --verbose
+	--verbose /usr/bin -eu export | ${HOME} cd "$@" export 'quoted text' --verbose
+	sed local $(pwd) grep /usr/bin local local "$@"
+		then 'quoted text' then then 2>/dev/null 2>/dev/null readonly
+	x=1 $(pwd) | /usr/bin done
+		'quoted text' "$1" readonly &&
+	--verbose test local 'quoted text' 2>/dev/null x=1 export | "$@" export test printf
+	export awk grep --verbose printf | then readonly awk
+&& then 'quoted text' awk
+	done grep x=1 awk --verbose x=1 grep
+	$(pwd) export 2>/dev/null done "$@" grep "$1" printf done grep --verbose --verbose
+		sed --verbose test done then 2>/dev/null then x=1 /usr/bin export --verbose local
+	&& printf $(pwd) 2>/dev/null awk test -eu awk awk --verbose echo && sed /usr/bin
+2>/dev/null readonly -eu test export x=1 /usr/bin
+| "$1" then cd "$@" /usr/bin /usr/bin x=1 x=1 ${HOME} "$1" readonly
+	cd --verbose local 2>/dev/null printf test done
+"$1" "$1" local x=1 export 'quoted text' awk x=1
+	"$@" export cd -eu export done /usr/bin sed "$@" x=1 done && | local
+echo "$1" ${HOME} | export x=1 ${HOME} --verbose
+| ${HOME} -eu done printf | | awk sed "$1" local sed $(pwd) ${HOME} 2>/dev/null
+test "$1" readonly grep $(pwd) -eu echo readonly export --verbose
+2>/dev/null | export $(pwd) 'quoted text' sed done
+	| --verbose ${HOME} x=1 --verbose local awk
+test awk test done then "$@"
+		/usr/bin echo -eu export
+then --verbose $(pwd) && export x=1 && ${HOME} sed ${HOME}
+		/usr/bin echo /usr/bin "$1" grep
+	then && done --verbose export then $(pwd) -eu then | "$1" local export
+echo sed grep sed $(pwd) "$@" "$@" done --verbose
+readonly done -eu ${HOME} cd ${HOME} local done && x=1 then
+	export && | 'quoted text'
+&& then --verbose test grep --verbose printf test then "$1" -eu $(pwd)
+'quoted text' x=1 awk awk cd done -eu grep grep "$1" /usr/bin
+		printf awk test "$1" /usr/bin sed "$1" "$@" export 2>/dev/null 'quoted text' x=1
+2>/dev/null --verbose echo cd /usr/bin cd "$1" x=1 /usr/bin local "$1" -eu
+	export "$@" local cd ${HOME} | | -eu -eu then "$@" sed | test test ${HOME} | $(pwd)
+$(pwd) 2>/dev/null cd "$@" ${HOME} /usr/bin
+		then done | printf done -eu --verbose "$1"
+		readonly 2>/dev/null --verbose printf export local then then export
+then && -eu $(pwd) then --verbose && ${HOME} 'quoted text'
+'quoted text' grep ${HOME} cd 'quoted text'
+	| awk done | grep readonly 'quoted text' grep
+cd test local | printf test echo && sed awk "$@" cd "$1" cd "$@" | /usr/bin
+-eu sed | test awk echo "$1" /usr/bin && 2>/dev/null x=1 ${HOME} $(pwd) --verbose
+	"$@" --verbose --verbose local ${HOME}
+done readonly --verbose /usr/bin 2>/dev/null && 2>/dev/null
+/usr/bin done then test
+	local printf printf 'quoted text'
+		then /usr/bin $(pwd) export "$1" | "$1" test echo ${HOME} echo | "$@"
+	/usr/bin export cd 'quoted text'
+		"$@" sed ${HOME} "$1" local local "$@" $(pwd) awk test -eu
+	| /usr/bin -eu printf 2>/dev/null 2>/dev/null export then cd ${HOME} x=1 sed
+	/usr/bin $(pwd) ${HOME} then local 'quoted text' test printf
+		&& test echo && /usr/bin
+		/usr/bin -eu done export ${HOME} cd /usr/bin ${HOME} --verbose done
+--verbose --verbose --verbose
+printf test local "$1" export awk x=1 cd --verbose x=1 -eu --verbose 2>/dev/null
+	export 2>/dev/null 2>/dev/null echo "$@" | printf
+		cd -eu && ${HOME} "$1" -eu 2>/dev/null 2>/dev/null readonly
+	awk x=1 "$1" sed 2>/dev/null grep /usr/bin local
+echo -eu export cd --verbose $(pwd) && local test
+-eu export grep 'quoted text' printf cd sed "$1" grep then
+	export $(pwd) 'quoted text' -eu "$1" echo 'quoted text' "$@" sed readonly
+		readonly printf -eu && readonly then export then readonly 'quoted text'
+	readonly export -eu "$1" echo done sed 'quoted text'
+		cd grep awk x=1 export printf readonly 2>/dev/null local | local cd
+	2>/dev/null -eu test 2>/dev/null /usr/bin awk $(pwd) /usr/bin
+		2>/dev/null echo printf | local done readonly echo cd grep | cd export
+		&& x=1 'quoted text' echo -eu readonly awk awk
+	--verbose cd export -eu printf "$@" && 2>/dev/null local | | local
+"$@" --verbose local local sed printf | grep -eu grep ${HOME}
+	--verbose readonly "$1"
+	"$@" x=1 readonly cd printf -eu sed done grep awk done /usr/bin /usr/bin
+then && /usr/bin then local awk echo local grep grep
+	&& -eu test grep | x=1 --verbose export
+		| "$1" cd local readonly |
+"$1" printf printf local readonly "$@" | | 2>/dev/null cd && x=1 local
+		&& /usr/bin done awk && x=1 echo
+	grep "$@" | echo sed x=1 local sed local -eu done $(pwd) | printf
+&& -eu test echo x=1 "$@" echo test /usr/bin cd "$@" printf
+export 2>/dev/null test test -eu export $(pwd) 2>/dev/null
+	"$@" printf | 'quoted text' printf
+	printf 2>/dev/null $(pwd) awk "$@" awk x=1 'quoted text'
+	grep export 2>/dev/null cd
+sed /usr/bin 2>/dev/null 2>/dev/null then
+	readonly 'quoted text' x=1 cd 2>/dev/null /usr/bin awk readonly -eu cd grep
+	echo cd awk sed -eu readonly echo && test cd "$1" 'quoted text'
+	'quoted text' x=1 export then
+2>/dev/null then export sed sed export
+	awk test export "$@" && "$@" x=1 printf /usr/bin x=1 x=1
+--verbose then "$@" -eu --verbose ${HOME} cd export
+		2>/dev/null then cd ${HOME} done
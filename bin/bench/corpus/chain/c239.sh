@@ -0,0 +1,2001 @@
+		"$@" printf | awk export sed 'quoted text' printf cd done done "$1"
+&& echo export && sed -eu /usr/bin export done /usr/bin sed
+		readonly && x=1 export x=1 export && sed test
+		local ${HOME} "$@" grep 2>/dev/null local done cd -eu export 2>/dev/null
+	echo echo /usr/bin printf 'quoted text' awk grep test
+	$(pwd) | ${HOME} ${HOME} printf local printf
+/usr/bin then /usr/bin test ${HOME} x=1 ${HOME}
+		local printf ${HOME} readonly | printf then
+		-eu echo $(pwd) 2>/dev/null cd done "$1" cd local grep echo ${HOME} grep sed
+		cd readonly && | && printf
+		sed && $(pwd) grep 'quoted text' readonly && "$1"
+grep grep -eu cd cd "$@" /usr/bin
+		echo done then awk test
+printf x=1 awk export echo 2>/dev/null cd readonly -eu $(pwd) export "$@" |
+done $(pwd) local export export "$1"
+&& done sed -eu ${HOME} echo 2>/dev/null sed
+		$(pwd) then "$@" printf 'quoted text' printf export printf x=1 sed /usr/bin
+${HOME} -eu "$1" export grep awk echo echo printf awk
+	test "$@" sed ${HOME} echo sed local "$1" test -eu
+		cd "$1" 2>/dev/null grep awk awk "$1" && sed "$1" readonly
+awk echo x=1 2>/dev/null export 'quoted text' -eu &&
+		then grep test printf test cd && done test sed /usr/bin grep | readonly $(pwd)
+"$@" local cd -eu echo "$1" cd test awk "$@" "$1" readonly printf cd awk ${HOME}
+		echo $(pwd) awk awk 'quoted text' /usr/bin echo awk local /usr/bin cd --verbose
+		then done cd && sed -eu 2>/dev/null "$@" /usr/bin "$@"
+	sed test local 'quoted text' "$1" --verbose "$1" sed
+local then ${HOME} $(pwd) $(pwd) grep /usr/bin done
+grep /usr/bin test $(pwd)
+		local grep awk then && 2>/dev/null done 2>/dev/null && /usr/bin
+		local echo export "$@" test "$@" "$1" printf printf && awk --verbose && export echo
+printf awk x=1 'quoted text' /usr/bin 2>/dev/null cd 2>/dev/null
+		test $(pwd) grep /usr/bin $(pwd)
+	done "$1" local then 2>/dev/null
+		"$1" $(pwd) awk 2>/dev/null | printf test sed test cd "$@" sed && printf --verbose
+printf && x=1 "$@" grep $(pwd) --verbose x=1 "$@" -eu x=1 ${HOME} | "$@" /usr/bin
+test test ${HOME} then local 'quoted text'
+test test && "$@" local sed local "$1" echo --verbose export
+	export awk $(pwd) local && done | echo grep done
+2>/dev/null --verbose && $(pwd) "$@" local "$@" -eu "$@" /usr/bin 'quoted text'
+		grep "$@" && -eu sed 2>/dev/null 'quoted text' grep grep | export
+		| "$1" cd done /usr/bin echo
+	$(pwd) --verbose "$@" 2>/dev/null ${HOME} "$1" -eu grep cd -eu ${HOME} done
+	export local && test test then && awk -eu
+printf && --verbose printf test then test && sed
+	export printf --verbose printf
+		cd --verbose && $(pwd) ${HOME} sed export export done --verbose ${HOME} grep 'quoted text'
+x=1 $(pwd) x=1 then ${HOME}
+		'quoted text' echo /usr/bin export && readonly export 'quoted text'
+	printf done sed cd /usr/bin | cd |
+	'quoted text' local "$1" test $(pwd)
+		done test "$@" ${HOME} done local
+	-eu ${HOME} 'quoted text' done | "$1" export -eu grep $(pwd)
+	-eu $(pwd) cd --verbose then readonly "$1" export then
+"$1" $(pwd) "$1" "$@" sed test echo "$1" | x=1 x=1 -eu
+test sed "$1" "$@" x=1 readonly then -eu export echo sed export test
+		/usr/bin && sed && 'quoted text' readonly test && local | local
+"$1" grep grep 2>/dev/null grep
+local --verbose printf 'quoted text'
+		then awk 2>/dev/null awk &&
+	then -eu --verbose && "$1" test |
+		--verbose && x=1 sed "$1" export
+readonly done ${HOME} $(pwd) ${HOME}
+	'quoted text' x=1 --verbose x=1 x=1 $(pwd) 'quoted text' local printf test local
+		export "$@" done local sed awk done "$1" 2>/dev/null sed sed cd "$@" readonly
+local readonly 'quoted text' 2>/dev/null
+	cd -eu 2>/dev/null done local "$@" done readonly
+		local export x=1 test $(pwd) awk cd then | $(pwd)
+		x=1 printf && then export 2>/dev/null /usr/bin
+	sed echo echo --verbose test readonly "$1" "$1" $(pwd) export "$@"
+	export /usr/bin then readonly && sed local grep x=1
+	then ${HOME} then --verbose x=1 -eu 'quoted text' readonly
+		cd then test "$@" -eu grep local
+	"$1" "$@" awk then -eu readonly x=1
+	&& ${HOME} cd "$@" --verbose 2>/dev/null test echo
+2>/dev/null --verbose /usr/bin then ${HOME} cd "$1" readonly printf --verbose
+		readonly sed $(pwd) && sed cd grep printf cd | awk -eu /usr/bin --verbose
+	x=1 local --verbose done echo done $(pwd) x=1 "$@" | grep 'quoted text'
+		'quoted text' && grep && local /usr/bin printf done
+	2>/dev/null export sed readonly | /usr/bin && test && --verbose grep local sed
+cd echo && test readonly 2>/dev/null readonly 'quoted text'
+		| /usr/bin "$@" export then
+--verbose awk && "$1" readonly test "$1" grep $(pwd) readonly 2>/dev/null
+	done $(pwd) sed ${HOME} echo x=1
+	done printf sed export 'quoted text' cd 'quoted text' ${HOME} &&
+${HOME} awk awk x=1 x=1 printf | "$1"
+${HOME} "$1" $(pwd) x=1 ${HOME} && "$1" 2>/dev/null export | 'quoted text'
+	printf 'quoted text' sed readonly x=1 ${HOME} grep printf then "$@" x=1 readonly
+--verbose test 2>/dev/null 2>/dev/null "$@" x=1
+| awk echo readonly && /usr/bin local && -eu then /usr/bin
+	awk cd 'quoted text' &&
+		grep x=1 -eu test 'quoted text' --verbose local
+grep awk -eu -eu sed --verbose export echo local printf then local
+--verbose printf then awk echo local echo local $(pwd) 'quoted text'
+	awk cd grep then x=1 && cd grep readonly
+	then 'quoted text' done
+	"$1" local x=1 "$@" 2>/dev/null
+	then $(pwd) export then ${HOME} echo readonly /usr/bin
+		test /usr/bin awk done done x=1 grep
+${HOME} readonly test sed echo grep export "$1" "$1" printf echo
+		done printf grep | $(pwd) "$1" printf readonly x=1 awk test && printf
+	test -eu /usr/bin done export
+	test grep grep x=1 sed "$@" && $(pwd)
+		${HOME} grep awk && x=1 "$1" 'quoted text' && test
+done --verbose export test export readonly echo grep | "$@" --verbose export
+		printf /usr/bin grep "$1" x=1 printf && echo awk printf | local -eu awk echo
+		| 2>/dev/null | sed echo -eu && export -eu ${HOME} /usr/bin printf
+	local x=1 ${HOME} 'quoted text' ${HOME} "$1"
+		then -eu local /usr/bin x=1 x=1 echo /usr/bin 2>/dev/null
+"$1" && grep printf readonly ${HOME}
+		--verbose export --verbose local && grep done sed readonly
+readonly | 2>/dev/null printf
+&& $(pwd) readonly $(pwd) grep printf /usr/bin grep x=1 'quoted text'
+	printf done "$@" $(pwd) then
+test x=1 --verbose --verbose awk printf done readonly 2>/dev/null "$1" done
+	-eu x=1 "$@" && awk echo awk awk printf sed 2>/dev/null "$@" x=1 printf local
+printf /usr/bin local "$@" sed ${HOME} 2>/dev/null
+	2>/dev/null $(pwd) done 2>/dev/null -eu printf sed cd ${HOME}
+	$(pwd) | cd then 2>/dev/null 'quoted text' 'quoted text' printf $(pwd)
+		then 2>/dev/null readonly 2>/dev/null x=1 "$@" /usr/bin readonly readonly "$1"
+		export echo && grep 'quoted text' /usr/bin
+	readonly cd ${HOME} then grep awk printf -eu export x=1 && printf
+	2>/dev/null test ${HOME} --verbose done
+printf "$1" 'quoted text' -eu sed echo export grep awk cd grep 2>/dev/null
+	| | awk /usr/bin 2>/dev/null $(pwd) x=1 2>/dev/null | grep
+	2>/dev/null done "$1" "$1" printf $(pwd) local printf && ${HOME}
+		2>/dev/null 'quoted text' grep
+		${HOME} grep /usr/bin awk test ${HOME}
+		'quoted text' awk && printf sed --verbose && "$1" then ${HOME} x=1 sed "$@" done
+		&& sed -eu then local sed
+		2>/dev/null then | done readonly awk
+	grep printf grep then awk && local done done "$@" --verbose cd ${HOME}
+/usr/bin 2>/dev/null $(pwd) -eu "$@" && x=1 $(pwd) echo 'quoted text'
+		printf -eu export "$1" local awk | then echo sed readonly "$1" awk export
+		'quoted text' echo then ${HOME} then
+done 2>/dev/null && readonly local grep x=1 then 'quoted text'
+&& then test $(pwd) printf --verbose grep sed grep x=1 2>/dev/null
+	/usr/bin done awk awk then echo -eu echo "$1" printf local
+"$1" export "$1" grep -eu "$@" 'quoted text' --verbose --verbose ${HOME} readonly
+		echo $(pwd) $(pwd) export -eu x=1 "$@" grep awk local | export local sed printf
+		test then printf readonly "$@" $(pwd) local sed echo echo -eu | /usr/bin
+		then local export x=1 done grep /usr/bin 2>/dev/null | 'quoted text' 'quoted text'
+	"$@" local echo --verbose local && 'quoted text' readonly && /usr/bin cd "$1"
+		echo readonly && then /usr/bin $(pwd)
+	"$@" grep grep printf &&
+-eu sed | x=1 | --verbose grep grep 'quoted text' /usr/bin printf --verbose
+	printf -eu local "$1" -eu printf
+		/usr/bin sed | then readonly ${HOME} /usr/bin done $(pwd)
+		| local readonly "$@" test "$1" ${HOME} echo local 'quoted text'
+	test x=1 /usr/bin | test printf
+&& "$1" awk cd -eu done cd 2>/dev/null && cd
+		2>/dev/null local -eu then readonly local 2>/dev/null
+		local export 'quoted text' --verbose awk -eu then "$1"
+		export "$@" local --verbose printf
+		printf sed /usr/bin printf local then ${HOME} grep export sed cd done cd
+	/usr/bin 'quoted text' done test /usr/bin done
+--verbose awk | 2>/dev/null 'quoted text'
+	echo export readonly -eu "$@" 'quoted text'
+local then x=1 "$1" test cd "$@" then &&
+		export test --verbose printf ${HOME} grep awk "$@"
+	export "$1" "$@" --verbose "$@" cd sed 'quoted text' | ${HOME}
+	then --verbose echo test /usr/bin | 2>/dev/null done -eu 'quoted text' done
+	grep readonly export 2>/dev/null
+| then readonly awk echo 2>/dev/null export 'quoted text' $(pwd)
+		"$@" -eu readonly echo
+	done x=1 export 2>/dev/null grep printf 2>/dev/null
+	readonly $(pwd) echo -eu "$1" && "$1" && test test -eu $(pwd) export export
+		then test "$@" x=1 /usr/bin
+	--verbose -eu awk awk export $(pwd) x=1 readonly && export test ${HOME} ${HOME}
+		export done local done 2>/dev/null
+test done x=1 printf echo x=1 readonly
+	/usr/bin && then echo sed done export done "$1" local cd /usr/bin printf grep done
+	then sed test grep export cd -eu sed "$1" echo done test then ${HOME} readonly
+		local x=1 "$1" sed done |
+printf 'quoted text' cd "$1" 'quoted text'
+	&& x=1 echo -eu sed --verbose echo "$1" printf "$1" --verbose test
+	grep printf 'quoted text' x=1 printf && /usr/bin
+	&& echo /usr/bin | /usr/bin && cd 2>/dev/null echo && test export readonly
+	done "$1" printf x=1 sed | then local then done | then sed 'quoted text'
+export /usr/bin --verbose 2>/dev/null $(pwd) printf then grep
+		"$@" awk sed grep awk grep test sed x=1 sed echo 2>/dev/null local && test
+	"$1" sed sed -eu awk ${HOME} "$1" && then
+grep /usr/bin test "$1" /usr/bin
+	| test cd x=1 --verbose printf
+	printf /usr/bin $(pwd) test test local
+		local cd 'quoted text' grep x=1 -eu awk 2>/dev/null sed && grep printf
+	local echo printf "$1" /usr/bin -eu awk 2>/dev/null $(pwd) grep export
+sed --verbose export |
+test echo --verbose "$1" cd $(pwd) then /usr/bin
+"$@" awk 'quoted text'
+grep test 2>/dev/null done 2>/dev/null
+		'quoted text' /usr/bin then cd --verbose "$1" export printf awk
+	cd echo echo x=1 readonly $(pwd) then && && echo -eu "$@"
+	2>/dev/null && sed "$1" printf /usr/bin
+/usr/bin then then done then readonly sed printf x=1 cd 'quoted text'
+		&& sed && "$@" /usr/bin printf echo ${HOME}
+		$(pwd) && | -eu printf | "$1" cd then echo test export awk
+	${HOME} $(pwd) done $(pwd) ${HOME} | ${HOME} printf
+&& "$@" --verbose grep echo x=1 sed ${HOME} "$1" /usr/bin
+		'quoted text' -eu grep "$1" "$1" readonly "$@" -eu
+		&& awk "$1" "$@" local "$@"
+		echo ${HOME} export export awk "$@" grep --verbose
+		--verbose "$1" awk test sed readonly $(pwd) && $(pwd) awk awk
+		sed then awk | x=1 'quoted text'
+		export local ${HOME} echo x=1 && -eu $(pwd) local export --verbose grep 'quoted text'
+		printf then 'quoted text' test
+	then printf grep awk 2>/dev/null
+sed /usr/bin x=1 done ${HOME} then | local 2>/dev/null
+2>/dev/null local && grep x=1 /usr/bin export $(pwd) awk 'quoted text'
+		cd "$1" readonly --verbose printf
+		${HOME} done /usr/bin -eu
+local /usr/bin "$1" "$1" sed done readonly
+	sed grep cd printf ${HOME} done 'quoted text' ${HOME} grep /usr/bin
+	sed local $(pwd) -eu "$@" done test readonly x=1 test done "$@" 2>/dev/null
+		done export local awk test
+		readonly done awk awk 2>/dev/null ${HOME} sed readonly 'quoted text' 'quoted text'
+"$@" | | ${HOME} /usr/bin "$@" local export --verbose awk local
+		/usr/bin echo grep 'quoted text' cd cd ${HOME} printf
+	/usr/bin | $(pwd) --verbose awk $(pwd) echo
+printf awk --verbose sed 2>/dev/null ${HOME} test then | "$@" sed cd then
+	'quoted text' --verbose "$1" --verbose
+	"$@" -eu "$1" cd readonly readonly
+export -eu /usr/bin -eu readonly $(pwd) grep ${HOME} then | "$1" x=1
+	sed "$1" && awk awk cd 'quoted text' grep "$@" 'quoted text' echo --verbose
+		then "$1" then 'quoted text' export grep local export 'quoted text' cd
+$(pwd) export local && --verbose ${HOME} readonly sed | cd sed printf --verbose
+	'quoted text' awk "$@" $(pwd) ${HOME}
+	cd export echo test | printf "$@" -eu $(pwd) -eu "$@" done x=1 export | 'quoted text'
+	local -eu sed && | cd $(pwd) "$1" echo -eu sed 'quoted text' x=1 "$1" printf
+	done export awk /usr/bin ${HOME} local && cd grep 2>/dev/null
+	$(pwd) echo $(pwd) --verbose export --verbose echo ${HOME} printf | cd | then
+	local done then x=1 then -eu echo echo local
+test awk printf readonly done grep awk readonly -eu 'quoted text' ${HOME} && /usr/bin
+"$@" readonly $(pwd) test "$@" --verbose "$1" printf $(pwd)
+	cd -eu readonly $(pwd) /usr/bin local printf done "$@" 'quoted text'
+$(pwd) | done && | then && x=1 cd local printf -eu test grep
+		x=1 grep | 'quoted text' ${HOME} --verbose -eu --verbose printf
+echo /usr/bin /usr/bin
+x=1 local readonly then | awk grep printf -eu grep local sed printf ${HOME} /usr/bin
+		test --verbose test local echo 2>/dev/null && done
+	/usr/bin echo export $(pwd) --verbose "$@" /usr/bin ${HOME} --verbose export
+$(pwd) test --verbose | sed
+		${HOME} "$1" cd then then $(pwd) echo && "$@" x=1 sed "$1"
+test grep 'quoted text' && x=1 | echo test then x=1 readonly echo 2>/dev/null
+awk export printf "$@" grep | readonly | echo "$1" echo
+		awk $(pwd) awk /usr/bin 'quoted text' echo done export
+		then "$1" --verbose 2>/dev/null
+sed test && 2>/dev/null x=1 export x=1 local grep
+readonly ${HOME} --verbose 'quoted text' "$@" readonly
+| cd sed $(pwd) then ${HOME} test local export export local export
+	2>/dev/null readonly readonly 'quoted text' 2>/dev/null echo
+		/usr/bin local awk 'quoted text'
+	"$@" echo $(pwd) echo sed --verbose echo --verbose
+${HOME} readonly test -eu local awk /usr/bin ${HOME} ${HOME} "$1"
+	'quoted text' sed 'quoted text' 2>/dev/null
+	"$@" grep x=1 export printf && /usr/bin --verbose echo
+export 2>/dev/null sed "$1" -eu && 'quoted text'
+		-eu x=1 'quoted text' test
+		readonly export ${HOME} test then
+		2>/dev/null then awk done 'quoted text' cd grep -eu ${HOME} /usr/bin
+		grep ${HOME} "$@" /usr/bin test sed "$@" local && && 'quoted text' /usr/bin
+	-eu --verbose ${HOME} | "$1" then $(pwd) | readonly printf readonly
+-eu ${HOME} /usr/bin export grep /usr/bin printf grep | "$1" ${HOME}
+		-eu done -eu cd awk ${HOME} ${HOME} awk awk | local --verbose export | "$@" -eu
+		sed -eu 'quoted text' 'quoted text' "$1" readonly
+sed done 'quoted text' export echo | ${HOME} --verbose export x=1 then
+		/usr/bin readonly --verbose sed local local --verbose done -eu && x=1 2>/dev/null
+		${HOME} export then then local $(pwd) readonly x=1 /usr/bin awk
+readonly printf --verbose ${HOME} cd export
+	test grep $(pwd) "$1" then 2>/dev/null /usr/bin then then
+	"$@" readonly grep "$@" && -eu | echo 2>/dev/null
+		"$1" grep done /usr/bin grep awk
+	"$1" x=1 'quoted text' x=1 export /usr/bin then cd echo awk local then test /usr/bin
+	-eu then echo -eu 2>/dev/null ${HOME} echo
+local $(pwd) /usr/bin "$1" x=1 "$1" readonly readonly
+		export cd $(pwd) | && sed awk "$@"
+	"$1" grep awk cd awk sed cd | export $(pwd) 'quoted text'
+printf test then | printf printf /usr/bin done grep readonly
+	"$@" test done grep x=1 'quoted text'
+		"$1" done "$@" ${HOME} echo -eu
+		"$1" local done done then done sed sed "$1" printf readonly
+		"$1" x=1 then local sed export "$@" grep local then 2>/dev/null printf sed ${HOME}
+	printf --verbose grep && && x=1 echo readonly /usr/bin test then
+		'quoted text' export --verbose -eu x=1 "$@" printf && | $(pwd) 2>/dev/null
+		${HOME} && local --verbose
+cd -eu | cd "$1" cd | printf x=1 local 2>/dev/null
+		then --verbose awk printf printf "$@"
+	test "$@" sed ${HOME} grep echo echo
+| $(pwd) | cd /usr/bin cd printf "$1" printf "$1" local
+| test readonly "$1" 'quoted text' awk grep echo sed grep export /usr/bin
+echo 'quoted text' printf && done echo awk 2>/dev/null cd readonly
+		${HOME} local local "$@" -eu cd awk sed done printf grep printf
+export done done 'quoted text' cd
+--verbose ${HOME} awk | $(pwd) cd then && grep
+		then | -eu echo 2>/dev/null "$1" printf echo "$@" then 'quoted text' local
+	2>/dev/null "$@" $(pwd) grep echo awk x=1 readonly readonly
+		/usr/bin export readonly then sed -eu 'quoted text' done
+		x=1 sed "$@" test $(pwd) "$1" sed x=1 test /usr/bin local local then
+		$(pwd) $(pwd) then printf
+	grep && printf sed x=1 grep
+		"$@" done | done test 'quoted text' && x=1
+	test grep local 'quoted text' grep /usr/bin
+	then done $(pwd) readonly readonly test "$@" "$1" -eu echo
+	"$@" readonly && x=1 readonly $(pwd) local
+	x=1 $(pwd) echo sed && -eu 'quoted text' ${HOME} awk "$@" echo printf -eu && then
+	"$@" /usr/bin export "$1" "$@" test && /usr/bin 2>/dev/null
+	printf local sed readonly echo "$@" local $(pwd) sed && sed x=1 -eu
+	cd echo 2>/dev/null x=1 ${HOME} -eu ${HOME} sed echo "$@" 'quoted text'
+	$(pwd) --verbose "$1" printf
+		"$1" "$1" awk 'quoted text' then -eu then grep
+readonly test grep cd 'quoted text' printf && sed | test cd export then local
+	"$1" printf grep /usr/bin then local $(pwd) 'quoted text'
+	export /usr/bin -eu then grep then test "$1" printf export "$1"
+		/usr/bin echo | done -eu printf readonly export printf sed cd readonly grep echo
+		x=1 local && local -eu x=1 2>/dev/null sed local
+then grep local x=1 grep awk done | "$@" "$@" grep
+	printf awk done "$@" printf then "$1"
+	'quoted text' cd | 'quoted text' ${HOME}
+	sed test done sed -eu -eu && printf
+		export x=1 then 2>/dev/null test grep
+	"$@" -eu printf readonly done done
+	awk local cd --verbose readonly
+sed awk "$@" 'quoted text' && && "$@" &&
+		'quoted text' "$@" -eu 2>/dev/null
+-eu sed | $(pwd) export -eu done done done -eu grep awk readonly
+		echo awk ${HOME} "$@" done printf awk sed done sed 'quoted text' then
+		echo 2>/dev/null awk then 'quoted text' awk awk sed
+$(pwd) "$1" printf export --verbose
+export export sed echo /usr/bin test printf local $(pwd) /usr/bin &&
+		grep "$1" "$1" ${HOME} grep $(pwd) then awk | $(pwd) test readonly 2>/dev/null
+done "$@" local echo export grep x=1 test --verbose --verbose
+		&& $(pwd) $(pwd) echo && x=1 "$1" grep done then printf -eu
+x=1 then export --verbose /usr/bin
+echo echo echo x=1 printf 2>/dev/null export then printf $(pwd)
+		x=1 | 2>/dev/null "$1" sed readonly x=1 && ${HOME} awk cd local -eu /usr/bin
+		sed /usr/bin printf x=1 2>/dev/null
+	--verbose echo -eu && done "$1" x=1 --verbose
+	-eu sed -eu -eu then grep grep x=1 test --verbose readonly
+		cd -eu sed readonly "$@" $(pwd)
+'quoted text' local -eu grep grep ${HOME} x=1 ${HOME} "$1" x=1 && 2>/dev/null
+$(pwd) 'quoted text' test echo
+${HOME} awk readonly done ${HOME} ${HOME} sed awk "$@" -eu sed grep
+"$@" 2>/dev/null grep cd awk printf echo done
+	printf /usr/bin /usr/bin
+		grep && && done export grep --verbose done ${HOME} &&
+		x=1 'quoted text' then "$@" cd /usr/bin "$@" | x=1 x=1 export cd readonly
+grep awk echo 2>/dev/null $(pwd) sed 'quoted text' printf test grep grep readonly
+"$1" local printf awk 2>/dev/null "$@"
+	done echo export /usr/bin
+		export printf $(pwd) local readonly grep 'quoted text' echo
+	| export readonly $(pwd) -eu /usr/bin | $(pwd) 2>/dev/null
+	test grep 2>/dev/null cd -eu echo done readonly then echo
+2>/dev/null cd echo $(pwd)
+		&& -eu grep && $(pwd) 2>/dev/null -eu echo cd /usr/bin | -eu export "$@" /usr/bin
+		readonly 2>/dev/null $(pwd) 'quoted text' x=1
+awk local awk 2>/dev/null x=1 local awk 'quoted text'
+cd local ${HOME} awk printf test &&
+local | echo printf | grep
+sed && "$1" 2>/dev/null readonly echo ${HOME} readonly done echo
+test cd test && then done --verbose done "$@" done -eu "$@" "$@" awk ${HOME}
+done awk --verbose 2>/dev/null local
+		${HOME} sed 2>/dev/null /usr/bin grep local echo awk local awk -eu
+		| sed export printf && readonly test local done &&
+		then cd 'quoted text' export x=1 x=1 x=1 awk --verbose export 2>/dev/null
+	'quoted text' $(pwd) printf && x=1 grep "$1" echo "$1" sed
+		2>/dev/null done sed "$@" export sed sed ${HOME} "$1" done grep done
+		then local -eu --verbose grep x=1 readonly awk 2>/dev/null 'quoted text' 2>/dev/null
+"$1" printf export awk done cd --verbose echo sed test 2>/dev/null
+	grep ${HOME} done export then && --verbose --verbose $(pwd)
+export then readonly --verbose test local
+	x=1 | echo printf | echo local printf | --verbose
+		2>/dev/null && export | "$@" then local
+		/usr/bin -eu -eu grep -eu cd /usr/bin | then export && $(pwd) awk | test
+then 2>/dev/null done test local /usr/bin "$@" 'quoted text' export export done
+	'quoted text' -eu && | echo && local printf 'quoted text'
+	2>/dev/null x=1 printf awk && done printf ${HOME} | awk then
+		"$1" printf awk then -eu ${HOME} local "$1" export export
+	--verbose 'quoted text' grep then local "$1" 2>/dev/null local
+		grep done grep $(pwd) awk awk done && test export cd $(pwd)
+	local test "$1" -eu sed /usr/bin /usr/bin
+		done local printf test "$1" sed /usr/bin then ${HOME} awk 2>/dev/null
+	export "$1" | 2>/dev/null then /usr/bin /usr/bin then echo "$@" 2>/dev/null | done
+	test grep awk local done ${HOME} | printf
+$(pwd) /usr/bin /usr/bin done
+		cd readonly "$1" 2>/dev/null test ${HOME} export export readonly
+		"$@" /usr/bin $(pwd) local readonly $(pwd) 2>/dev/null && cd /usr/bin /usr/bin
+x=1 $(pwd) printf && 2>/dev/null /usr/bin
+	${HOME} 'quoted text' done printf readonly test echo export sed && sed --verbose
+	"$@" echo sed readonly --verbose awk cd && echo "$@" -eu
+	echo && 'quoted text' sed --verbose test "$@" echo -eu sed 'quoted text'
+		test 'quoted text' printf readonly -eu test echo export "$1" done --verbose
+		local echo x=1 x=1 -eu 2>/dev/null test
+		| $(pwd) --verbose test && "$1" awk then then then
+2>/dev/null awk then ${HOME}
+		'quoted text' $(pwd) export cd | export /usr/bin --verbose
+then grep | 2>/dev/null --verbose /usr/bin 'quoted text' sed awk "$@"
+		2>/dev/null echo printf export ${HOME} done 'quoted text'
+		'quoted text' local echo 'quoted text' awk awk ${HOME}
+		"$1" && -eu echo cd cd local sed x=1 test
+--verbose cd local 'quoted text' 2>/dev/null echo printf local
+"$@" && /usr/bin && sed done 'quoted text' printf local
+'quoted text' | ${HOME} local local 'quoted text' && x=1 $(pwd) export readonly
+readonly && x=1 ${HOME} local cd | readonly echo sed test
+	echo local "$1" -eu export "$@" test --verbose
+		"$@" 2>/dev/null && "$@" 2>/dev/null -eu "$@" grep cd -eu | 'quoted text' printf
+'quoted text' | | x=1 'quoted text' | --verbose
+		done "$@" | "$@" done /usr/bin
+		done x=1 sed grep local
+	awk -eu /usr/bin /usr/bin -eu test local done
+readonly printf export 2>/dev/null | sed done --verbose
+		| local local 'quoted text' test "$1" echo echo -eu local /usr/bin ${HOME}
+| test 2>/dev/null done cd readonly "$@" 2>/dev/null -eu echo
+sed 'quoted text' grep cd --verbose
+	2>/dev/null export ${HOME} -eu | awk export awk printf
+	-eu x=1 "$1" grep sed 'quoted text' /usr/bin && cd 'quoted text'
+		cd -eu readonly "$1" local 2>/dev/null
+		--verbose 2>/dev/null local --verbose cd "$1" x=1 awk
+$(pwd) $(pwd) then $(pwd) printf |
+	then x=1 grep export done "$1" then sed "$@" ${HOME} done readonly
+	| grep $(pwd) --verbose then test sed then -eu "$1" /usr/bin then then echo sed
+	| then "$1" export printf echo cd --verbose sed echo 2>/dev/null
+	echo readonly --verbose awk "$@" awk 'quoted text' grep $(pwd) x=1 /usr/bin
+		cd cd && echo | export sed done grep printf "$@" --verbose
+-eu awk awk "$1" /usr/bin
+		test printf 'quoted text' local test then 'quoted text' printf -eu printf echo
+		-eu /usr/bin && local 'quoted text' /usr/bin --verbose
+export grep printf cd cd export test then $(pwd)
+		/usr/bin then readonly 'quoted text'
+	-eu awk then 'quoted text'
+		-eu --verbose echo export awk /usr/bin
+		cd echo x=1 grep sed
+		"$@" printf printf sed local "$1" export
+		cd local local | && export test echo awk done
+"$1" local done done done "$@" "$1" "$1"
+"$1" printf x=1 "$1" |
+		"$@" grep cd readonly done -eu $(pwd) |
+	"$@" && 'quoted text' x=1 -eu -eu 'quoted text' grep ${HOME} test
+${HOME} x=1 'quoted text' grep
+		| sed then grep echo "$@" -eu "$1" printf --verbose
+		/usr/bin $(pwd) awk x=1 printf echo "$@" done
+	"$@" printf printf echo done grep --verbose done x=1 done 'quoted text'
+	| "$@" readonly | readonly local printf
+		$(pwd) -eu local awk grep local "$@" && ${HOME} echo local -eu
+	$(pwd) test 2>/dev/null grep export sed 'quoted text' "$@" "$@" export
+		grep ${HOME} $(pwd) ${HOME} test -eu
+"$@" local | -eu $(pwd) 'quoted text' ${HOME} echo readonly sed cd $(pwd)
+		test && 'quoted text' awk $(pwd) then | awk printf cd 2>/dev/null
+local sed sed 2>/dev/null grep /usr/bin done export echo awk
+		test "$1" --verbose ${HOME} /usr/bin | awk "$@" sed -eu | &&
+		readonly 'quoted text'
+	--verbose $(pwd) local "$@" echo
+	cd /usr/bin readonly grep x=1 export $(pwd) then readonly test local
+awk done echo 2>/dev/null && test
+'quoted text' local "$1" x=1 echo test readonly cd x=1 $(pwd) echo echo $(pwd)
+| test /usr/bin done cd export grep readonly
+	then -eu 2>/dev/null --verbose x=1 /usr/bin
+		grep "$@" test sed export export cd readonly printf printf readonly readonly
+		sed "$@" sed $(pwd) export /usr/bin x=1 ${HOME} ${HOME} sed
+${HOME} echo x=1 /usr/bin 2>/dev/null --verbose done
+	$(pwd) "$@" echo $(pwd) --verbose ${HOME} && printf export -eu
+		echo "$@" 'quoted text' readonly grep 2>/dev/null 2>/dev/null
+		test && test echo ${HOME} /usr/bin local $(pwd) -eu echo $(pwd) "$@" done
+	/usr/bin $(pwd) grep awk 'quoted text' readonly sed
+	--verbose 'quoted text' local $(pwd)
+test printf readonly "$1" | awk done /usr/bin ${HOME} ${HOME}
+		sed $(pwd) ${HOME} readonly grep --verbose
+	--verbose then ${HOME} test echo $(pwd) "$1"
+cd && "$1" readonly printf awk "$@" readonly | | export 'quoted text' "$1" "$1"
+		'quoted text' "$@" test -eu $(pwd) $(pwd) grep ${HOME} | 'quoted text'
+		${HOME} --verbose /usr/bin $(pwd)
+	"$@" done 'quoted text' cd readonly local "$@" $(pwd) x=1 then 'quoted text' readonly
+		${HOME} && -eu awk readonly "$1" --verbose --verbose && "$1" local printf 'quoted text'
+/usr/bin ${HOME} readonly x=1 "$@" $(pwd) readonly
+		awk cd -eu then readonly awk 2>/dev/null
+		awk cd -eu | /usr/bin "$1" printf
+	--verbose grep local local then echo local then /usr/bin echo
+export export sed echo | $(pwd) export /usr/bin echo $(pwd) 2>/dev/null
+	echo 'quoted text' cd readonly cd awk
+		'quoted text' --verbose && awk printf "$@" 2>/dev/null "$@" && test -eu export
+${HOME} | awk test done | 2>/dev/null
+		$(pwd) cd echo awk then then echo "$@" export echo export readonly
+	$(pwd) "$@" readonly /usr/bin "$@" -eu done
+"$@" ${HOME} | sed done && awk grep readonly
+cd /usr/bin | printf ${HOME} "$1" | readonly -eu cd 2>/dev/null --verbose
+echo then sed sed "$1" readonly "$1" /usr/bin
+		done echo 2>/dev/null --verbose done 2>/dev/null
+export | /usr/bin | readonly grep "$1" && | x=1 cd readonly 'quoted text'
+-eu export awk | /usr/bin -eu ${HOME} awk echo printf then --verbose
+	then 2>/dev/null grep x=1 test echo "$1"
+	$(pwd) ${HOME} ${HOME} then test sed
+		test readonly then --verbose 'quoted text' "$@"
+	printf then readonly /usr/bin "$1" printf /usr/bin --verbose test
+printf "$@" /usr/bin ${HOME}
+		then echo | 'quoted text' -eu ${HOME} awk --verbose |
+	grep echo && cd x=1 then awk 2>/dev/null &&
+"$1" --verbose export ${HOME} x=1 printf sed ${HOME} cd 2>/dev/null awk
+${HOME} "$1" sed readonly
+		sed 2>/dev/null --verbose awk sed ${HOME} "$1" && | export
+grep /usr/bin -eu test readonly && ${HOME} awk grep export 2>/dev/null
+		echo 'quoted text' ${HOME} printf ${HOME}
+		cd $(pwd) cd export -eu
+"$@" echo ${HOME} 'quoted text' 2>/dev/null && 'quoted text' ${HOME}
+		grep ${HOME} | export
+		local $(pwd) --verbose test test sed /usr/bin
+		-eu export && 'quoted text'
+	"$@" done awk export echo ${HOME} /usr/bin | --verbose
+$(pwd) 'quoted text' 2>/dev/null local && 2>/dev/null
+	sed readonly ${HOME} then printf
+$(pwd) | ${HOME} ${HOME} done done
+	"$@" /usr/bin local 'quoted text' export ${HOME} awk /usr/bin
+		x=1 ${HOME} x=1 done "$@" 2>/dev/null 'quoted text' x=1 ${HOME}
+	| /usr/bin "$1" test grep sed | local -eu | echo export
+		2>/dev/null ${HOME} sed -eu -eu local test readonly
+		local readonly && --verbose | echo && "$@" readonly cd 2>/dev/null 'quoted text'
+readonly export test cd done
+"$@" "$@" && /usr/bin cd cd "$1" "$@" ${HOME} --verbose
+	printf ${HOME} done awk readonly --verbose "$1"
+		done test 'quoted text' cd printf echo awk | printf ${HOME} then
+	&& -eu "$@" /usr/bin local local 'quoted text' -eu printf | x=1 printf sed
+		local cd local x=1 -eu --verbose --verbose local -eu ${HOME} 'quoted text'
+	done local echo /usr/bin grep $(pwd) "$1" local
+		export 'quoted text' done "$@" local &&
+export x=1 "$1" readonly x=1 --verbose "$1" 'quoted text'
+		echo --verbose "$1" printf test printf
+echo 2>/dev/null $(pwd) $(pwd) printf 2>/dev/null 2>/dev/null
+	local --verbose sed then readonly local test local 'quoted text' && printf
+	readonly "$@" printf local 2>/dev/null readonly
+	cd "$1" awk "$1" then x=1 echo echo echo "$1" test 'quoted text' cd cd echo
+		printf test /usr/bin awk && export --verbose 'quoted text' cd --verbose $(pwd)
+		export 'quoted text' local -eu /usr/bin awk sed $(pwd) test local x=1 local
+	$(pwd) printf "$1" 'quoted text' "$1"
+$(pwd) -eu -eu grep printf printf
+cd readonly echo "$1" | 2>/dev/null local "$1" readonly -eu && "$@" readonly
+	echo 'quoted text' local | --verbose echo $(pwd) grep
+awk $(pwd) "$@" grep echo sed "$@" export /usr/bin $(pwd) printf 'quoted text'
+-eu cd 2>/dev/null "$@" --verbose $(pwd)
+		'quoted text' /usr/bin 'quoted text' "$1" sed | grep ${HOME} readonly |
+	| ${HOME} -eu printf "$@" -eu cd cd grep ${HOME} 2>/dev/null echo printf awk
+	local --verbose echo cd 'quoted text' then echo "$@"
+	| export -eu sed awk then /usr/bin ${HOME} $(pwd) export 2>/dev/null
+done -eu 2>/dev/null "$1"
+		/usr/bin 'quoted text' sed ${HOME} "$@" done -eu 'quoted text'
+		$(pwd) grep "$@" && grep $(pwd)
+	awk readonly readonly sed 'quoted text' cd x=1 | done echo
+grep "$1" -eu awk done ${HOME} -eu "$1" then ${HOME} && -eu done 'quoted text' --verbose
+then "$@" $(pwd) grep x=1 2>/dev/null grep ${HOME} echo $(pwd) readonly
+		--verbose sed test awk awk local
+	cd $(pwd) -eu echo -eu cd "$1" "$@" 'quoted text'
+'quoted text' done cd 2>/dev/null
+		| printf | $(pwd) "$1" export | -eu "$@" echo awk test cd done cd $(pwd)
+		local && ${HOME} export $(pwd) 2>/dev/null sed done local echo &&
+| "$1" cd export cd 2>/dev/null /usr/bin && awk
+	x=1 sed echo -eu done awk cd ${HOME} awk 2>/dev/null
+-eu ${HOME} -eu then cd local test export readonly ${HOME} test printf
+	-eu 'quoted text' export printf local && export local $(pwd) x=1 "$@" $(pwd)
+	local /usr/bin grep done readonly printf local -eu x=1
+		--verbose sed -eu grep test | /usr/bin
+		test -eu printf -eu test test && grep sed awk && "$1" grep export
+		export 'quoted text' printf local printf "$@" test test printf then done test
+	sed "$1" $(pwd) --verbose -eu readonly
+		x=1 "$@" --verbose 'quoted text' /usr/bin && test done cd | cd then && | grep sed
+	"$@" grep then awk grep "$1" grep
+	"$@" | done done 2>/dev/null 'quoted text' printf test cd && readonly 'quoted text'
+	--verbose -eu "$1" /usr/bin "$@" awk "$@" ${HOME} export 2>/dev/null local
+done echo $(pwd) printf grep cd done "$1" grep 'quoted text' test then -eu local
+	${HOME} export local | cd | && -eu cd printf $(pwd)
+	sed 2>/dev/null export 'quoted text' x=1 'quoted text' done
+	export && grep -eu export $(pwd) ${HOME} && ${HOME} done grep --verbose
+	--verbose test cd printf printf --verbose 'quoted text'
+		x=1 local 'quoted text' -eu awk sed readonly printf -eu cd then then
+	then grep | done awk --verbose
+readonly "$1" echo --verbose
+		"$@" local "$1" 2>/dev/null readonly 2>/dev/null
+"$1" awk | awk cd --verbose grep sed 'quoted text' export
+	"$@" test 2>/dev/null 'quoted text' then then /usr/bin awk done
+	2>/dev/null cd /usr/bin awk printf && then sed ${HOME}
+'quoted text' -eu && echo
+	grep /usr/bin sed printf --verbose ${HOME} export x=1 x=1 'quoted text' awk
+cd awk awk 2>/dev/null $(pwd) 'quoted text' local printf
+	done | -eu ${HOME} printf "$@"
+	awk 'quoted text' | "$1"
+		"$@" done test readonly test awk 'quoted text' /usr/bin echo printf && /usr/bin
+		awk local --verbose $(pwd)
+		export export cd done && cd "$1" "$@" export $(pwd) local && |
+		--verbose $(pwd) && grep then
+2>/dev/null grep x=1 local 'quoted text' x=1 "$1" sed cd awk && $(pwd) local /usr/bin
+		local readonly grep 2>/dev/null readonly
+		&& cd printf grep echo readonly printf &&
+		echo $(pwd) readonly awk echo "$1" /usr/bin
+		${HOME} ${HOME} 2>/dev/null
+		&& export sed | test /usr/bin -eu | done 'quoted text' ${HOME} export 2>/dev/null
+		-eu sed cd -eu --verbose -eu then "$@" --verbose
+		echo export 'quoted text' && -eu test readonly --verbose && then then then
+		"$1" 'quoted text' /usr/bin echo awk sed | ${HOME}
+	test "$1" /usr/bin 'quoted text' -eu sed export --verbose echo | awk
+grep cd done /usr/bin && -eu sed "$@" test && grep --verbose readonly sed awk printf
+		cd $(pwd) export 'quoted text' "$1" -eu x=1 grep ${HOME} local done ${HOME}
+		then --verbose | | -eu test | readonly $(pwd) grep "$@" 2>/dev/null done then grep
+	'quoted text' ${HOME} 'quoted text'
+		$(pwd) test grep 'quoted text'
+"$@" echo done "$1" grep -eu x=1
+	echo "$@" grep /usr/bin then grep -eu && x=1 'quoted text' readonly
+$(pwd) --verbose printf "$1" && $(pwd) grep export && $(pwd) ${HOME}
+	"$@" readonly local -eu grep --verbose
+		test 'quoted text' "$1" readonly
+		--verbose 'quoted text' 'quoted text' then test export x=1 "$1" test
+	then && grep ${HOME} readonly cd local awk
+	printf 2>/dev/null | 2>/dev/null ${HOME} --verbose readonly 'quoted text'
+		${HOME} test test local readonly "$@" --verbose done grep export "$@" done
+		sed grep ${HOME} awk ${HOME} 2>/dev/null
+		readonly | && grep awk printf test done sed "$1" 'quoted text' /usr/bin
+"$1" 2>/dev/null local grep ${HOME} test cd 'quoted text' x=1 ${HOME} export
+"$@" then local readonly test readonly "$1" --verbose "$1" printf
+		--verbose ${HOME} ${HOME} test sed -eu
+	readonly cd readonly echo readonly export test sed x=1 printf 'quoted text' export
+cd export 'quoted text' --verbose /usr/bin
+		cd export then x=1 echo printf printf x=1
+-eu then cd readonly x=1 --verbose
+	$(pwd) 2>/dev/null 'quoted text'
+		&& echo export echo /usr/bin local done "$@" printf sed
+	$(pwd) --verbose "$@" echo grep -eu cd cd test 'quoted text'
+		then | test && ${HOME} "$@" echo && $(pwd) $(pwd) cd sed cd x=1 ${HOME} $(pwd)
+${HOME} ${HOME} --verbose cd test && --verbose ${HOME} export test test local
+| test "$1" "$@" 2>/dev/null
+		${HOME} sed awk readonly then /usr/bin
+awk /usr/bin $(pwd) echo grep grep
+		grep $(pwd) test --verbose ${HOME} then |
+2>/dev/null ${HOME} |
+		2>/dev/null done echo test test readonly test echo sed awk -eu cd "$@" -eu export
+		local && sed export test readonly /usr/bin done ${HOME}
+-eu awk x=1 && ${HOME} "$1" x=1 --verbose |
+	${HOME} cd $(pwd) ${HOME} 'quoted text' $(pwd) "$@" x=1 grep done export
+		2>/dev/null sed --verbose "$1" "$@" awk printf then
+$(pwd) export "$@" done readonly then then
+cd sed ${HOME} "$@" --verbose awk --verbose cd export ${HOME} 'quoted text'
+		test ${HOME} "$1" -eu cd then
+	test grep "$1" echo done /usr/bin x=1 test grep && "$1" 'quoted text'
+&& awk /usr/bin then done test readonly awk "$1" $(pwd) echo test /usr/bin
+		"$1" cd "$1" x=1 local then --verbose readonly sed
+local echo then "$@" echo readonly test echo readonly |
+	readonly readonly grep printf local
+${HOME} export "$1" && local
+		--verbose && "$@" x=1 then export sed 2>/dev/null -eu && awk
+	cd /usr/bin readonly awk "$@" then echo local readonly export then
+		test /usr/bin echo -eu sed x=1 2>/dev/null ${HOME} printf export local $(pwd)
+| printf "$@" cd then $(pwd) "$1" "$@" | 2>/dev/null /usr/bin readonly awk printf
+x=1 ${HOME} echo "$@" done local printf printf echo printf printf "$1" 'quoted text'
+	sed echo cd x=1 ${HOME} grep ${HOME} echo && "$@" "$@" $(pwd)
+	'quoted text' export /usr/bin && sed done then --verbose awk ${HOME} $(pwd)
+		cd --verbose export then awk
+sed x=1 2>/dev/null && printf done readonly /usr/bin
+	sed -eu | x=1 | && test then ${HOME} done | readonly $(pwd)
+/usr/bin grep export local cd
+	then local done local sed
+	$(pwd) "$@" $(pwd) export
+	local grep cd -eu printf "$@" -eu -eu grep 'quoted text' &&
+/usr/bin then /usr/bin then printf
+	test awk export readonly -eu ${HOME} /usr/bin sed readonly
+	-eu sed --verbose awk sed done 'quoted text'
+		-eu readonly -eu -eu $(pwd)
+		&& test then export /usr/bin
+	${HOME} ${HOME} 2>/dev/null /usr/bin && done 2>/dev/null
+		export $(pwd) --verbose $(pwd) "$1" grep
+awk readonly /usr/bin /usr/bin printf grep test
+		export sed "$1" && x=1 awk -eu cd test awk --verbose readonly "$1" && cd
+	cd -eu "$1" "$@" local test test echo then "$@" grep --verbose
+| export 'quoted text' x=1 x=1 export "$@" && --verbose ${HOME} local
+		"$1" --verbose export x=1 local grep $(pwd) echo echo "$@"
+	test ${HOME} "$@" printf "$@"
+sed local grep | ${HOME} $(pwd) sed "$1" grep --verbose
+		done ${HOME} cd 'quoted text' export readonly ${HOME} local -eu
+	x=1 test cd 2>/dev/null | then "$@" 'quoted text'
+'quoted text' /usr/bin readonly done sed
+	local --verbose done cd -eu "$1" 'quoted text' /usr/bin
+readonly readonly cd done printf
+		sed /usr/bin "$1" readonly then /usr/bin local 2>/dev/null --verbose
+	x=1 --verbose ${HOME} && 2>/dev/null 2>/dev/null
+	printf ${HOME} -eu -eu grep $(pwd) --verbose done ${HOME} awk
+		sed 2>/dev/null $(pwd) /usr/bin awk awk /usr/bin
+printf sed ${HOME} sed readonly | 2>/dev/null sed -eu done | 'quoted text'
+2>/dev/null /usr/bin "$@" /usr/bin "$1" test && local x=1
+	--verbose x=1 | x=1 x=1 awk 'quoted text'
+		test readonly echo grep 'quoted text' printf local $(pwd) 2>/dev/null
+	&& "$1" "$@" echo sed | -eu ${HOME} local /usr/bin ${HOME} echo
+${HOME} 'quoted text' local cd done sed printf /usr/bin done awk 2>/dev/null
+'quoted text' $(pwd) sed /usr/bin printf awk 2>/dev/null "$@" awk /usr/bin
+	test echo then echo ${HOME} && printf printf
+${HOME} x=1 echo sed 'quoted text' echo x=1 done x=1 done then 2>/dev/null 'quoted text'
+local $(pwd) "$@" then -eu printf 2>/dev/null "$1"
+	readonly local sed --verbose then awk 2>/dev/null --verbose awk $(pwd)
+		sed export | && --verbose echo ${HOME}
+		"$1" | "$1" awk x=1 readonly "$@" cd | local 2>/dev/null -eu export printf
+	"$1" echo --verbose $(pwd) grep "$@" 'quoted text'
+		test "$@" && | then $(pwd) $(pwd) "$1" cd printf /usr/bin local
+$(pwd) readonly 2>/dev/null /usr/bin
+	| "$@" "$1" sed x=1 && awk done cd
+	cd then export && 2>/dev/null $(pwd) sed 2>/dev/null
+		${HOME} x=1 "$@" $(pwd) x=1 x=1 cd "$@" readonly
+		sed && 2>/dev/null echo printf
+		"$1" echo export | ${HOME} test grep cd --verbose ${HOME} /usr/bin then readonly
+	cd cd "$@" /usr/bin -eu done x=1 x=1 cd --verbose 'quoted text'
+	readonly && grep "$1" echo x=1
+		'quoted text' export sed && /usr/bin "$1" -eu --verbose
+$(pwd) test printf test --verbose $(pwd) | readonly "$@"
+	&& 'quoted text' grep 'quoted text'
+	2>/dev/null cd x=1 | readonly $(pwd) test awk done
+	'quoted text' echo awk && 'quoted text' $(pwd) $(pwd) && printf printf
+done -eu "$1" "$1" -eu x=1 $(pwd) | "$@" test |
+		grep echo ${HOME} sed echo done 2>/dev/null
+&& done "$1" "$@" readonly then ${HOME} ${HOME} done
+then done "$@" x=1 printf echo $(pwd) x=1 && then
+	echo export -eu grep readonly -eu cd -eu export echo local 2>/dev/null
+printf 2>/dev/null export sed "$@" readonly test x=1 | echo echo sed echo $(pwd)
+2>/dev/null $(pwd) x=1 done printf done test "$1"
+	&& sed echo readonly then awk 2>/dev/null local
+cd done --verbose /usr/bin readonly 'quoted text' /usr/bin
+		-eu "$1" printf awk && "$@" echo "$@"
+	"$@" sed readonly then then printf local x=1 done
+-eu | export awk echo export
+x=1 2>/dev/null 'quoted text' -eu printf printf printf 2>/dev/null grep
+local echo local /usr/bin x=1 /usr/bin "$1" printf export "$@" ${HOME}
+	x=1 local /usr/bin 'quoted text'
+	${HOME} --verbose readonly "$1" printf then export --verbose
+"$@" grep 'quoted text' local -eu x=1 $(pwd) && readonly local $(pwd) readonly
+$(pwd) x=1 x=1 done "$@" | cd grep ${HOME} readonly "$1" cd | -eu printf
+		test export echo awk local
+awk echo readonly cd 'quoted text' sed | readonly
+	'quoted text' && readonly done export printf then cd then export
+	cd 2>/dev/null awk local | grep echo | awk --verbose x=1 $(pwd) echo
+grep cd printf 'quoted text' awk awk
+${HOME} x=1 x=1 "$1" "$@" && | sed $(pwd) "$1"
+		&& 'quoted text' ${HOME} | && sed export cd done --verbose -eu
+	then echo 2>/dev/null ${HOME}
+		"$@" awk echo "$@" done test | printf sed "$1" cd then then printf done "$1" "$1"
+readonly then x=1 grep test then /usr/bin x=1 | 'quoted text'
+		/usr/bin ${HOME} readonly
+		export export --verbose echo --verbose sed local && 2>/dev/null local /usr/bin
+	"$1" /usr/bin printf echo 2>/dev/null $(pwd) done sed sed sed echo done
+	-eu then 2>/dev/null local | $(pwd) grep "$1" then grep x=1 echo echo
+$(pwd) | | cd && readonly 2>/dev/null "$@" export -eu 'quoted text' grep ${HOME}
+then readonly cd echo test "$@" $(pwd) sed sed
+"$@" readonly readonly ${HOME} | x=1
+export $(pwd) echo then -eu grep
+test /usr/bin && test 2>/dev/null
+x=1 "$1" printf "$1" ${HOME} "$@" readonly /usr/bin
+	then export -eu "$@" readonly x=1 --verbose printf 2>/dev/null /usr/bin test
+'quoted text' cd $(pwd) awk "$1" 'quoted text' $(pwd) grep && x=1
+"$1" readonly && test grep --verbose "$1" $(pwd) "$1" "$1" echo
+--verbose awk ${HOME} --verbose 'quoted text' -eu printf printf test 'quoted text'
+		x=1 && "$1" && awk echo readonly 2>/dev/null then
+		/usr/bin export -eu readonly grep export cd cd | done awk && awk x=1
+	${HOME} $(pwd) | awk 2>/dev/null /usr/bin | export printf ${HOME}
+export $(pwd) export "$1" "$@" done then /usr/bin ${HOME}
+		export | grep echo cd --verbose awk test "$1" cd readonly "$1" readonly ${HOME}
+${HOME} ${HOME} readonly x=1 grep --verbose -eu | -eu sed
+	$(pwd) && cd --verbose "$1" echo "$@" export test
+	"$@" printf "$@" "$1" $(pwd)
+| local -eu ${HOME} "$1" local
+		"$@" export "$@" ${HOME} awk readonly
+	done | printf grep --verbose "$@" test /usr/bin done
+		"$1" "$1" export local test
+	${HOME} cd /usr/bin grep $(pwd) grep then x=1 then export
+		/usr/bin grep 'quoted text' | done grep /usr/bin "$@" readonly sed done
+		export readonly cd grep done -eu awk --verbose $(pwd) sed grep then printf ${HOME}
+	$(pwd) grep --verbose local
+	awk /usr/bin -eu "$1" awk local grep 2>/dev/null
+echo awk -eu ${HOME} 'quoted text'
+test done /usr/bin cd /usr/bin local 2>/dev/null /usr/bin "$1" /usr/bin
+		printf done readonly printf
+"$@" x=1 'quoted text' readonly test "$1" "$@" 2>/dev/null
+		-eu x=1 --verbose then && 2>/dev/null /usr/bin ${HOME} x=1 sed 'quoted text'
+x=1 echo awk printf local
+test 'quoted text' echo export test 'quoted text'
+'quoted text' x=1 cd local && echo "$@" awk
+		x=1 echo echo export |
+		cd sed export ${HOME} /usr/bin readonly awk "$1" grep then printf echo
+x=1 --verbose test then 2>/dev/null
+"$@" x=1 local -eu awk test export then | | | cd grep echo awk 2>/dev/null echo
+		| sed export then $(pwd) $(pwd)
+		readonly 'quoted text' test 2>/dev/null $(pwd) test done grep ${HOME} printf
+		"$1" export sed export test $(pwd) /usr/bin done /usr/bin local
+	| grep then "$@" readonly
+	| "$@" ${HOME} x=1 done $(pwd) "$1"
+		awk awk ${HOME} readonly 'quoted text' /usr/bin
+		readonly done sed -eu 2>/dev/null
+	| grep && test then x=1 awk test "$1" printf
+	readonly cd local --verbose test
+		$(pwd) test local $(pwd) readonly sed $(pwd)
+	${HOME} done && | -eu readonly
+	"$@" cd | test -eu x=1 cd done ${HOME} && $(pwd) export -eu local sed grep local
+printf done printf export test /usr/bin awk
+		${HOME} 2>/dev/null 'quoted text' export cd 'quoted text' && readonly
+/usr/bin export grep readonly echo 2>/dev/null printf x=1 sed grep /usr/bin
+/usr/bin local x=1 cd 2>/dev/null | awk
+	"$@" then x=1 "$1" done sed local && 2>/dev/null
+		echo $(pwd) $(pwd) grep ${HOME} local echo
+-eu $(pwd) -eu "$1" then | ${HOME} | sed grep "$1" local /usr/bin sed
+		then -eu awk done export /usr/bin then
+	-eu awk 'quoted text' "$@" readonly local local printf echo
+	test 2>/dev/null /usr/bin ${HOME} | done /usr/bin
+sed grep $(pwd) sed && done $(pwd) grep "$@"
+	grep done "$1" local && cd export 2>/dev/null x=1 "$1" export
+&& test --verbose ${HOME} --verbose $(pwd) | sed local && 2>/dev/null
+	'quoted text' /usr/bin -eu --verbose /usr/bin
+		${HOME} $(pwd) /usr/bin x=1 x=1 ${HOME} "$@" sed then --verbose awk 2>/dev/null
+grep $(pwd) awk | done readonly export 'quoted text' 2>/dev/null export -eu -eu
+		/usr/bin -eu echo export -eu 2>/dev/null grep
+		done --verbose printf x=1 then ${HOME}
+		local $(pwd) ${HOME} -eu --verbose | readonly local
+test done --verbose readonly readonly | "$@" grep --verbose then sed readonly
+sed --verbose done /usr/bin
+test -eu --verbose printf /usr/bin test |
+$(pwd) /usr/bin $(pwd) -eu -eu 2>/dev/null then
+		| "$@" grep "$@" 'quoted text' done $(pwd) export
+	done -eu printf && /usr/bin sed cd --verbose test && export grep
+	x=1 export 'quoted text' && awk then && 2>/dev/null
+/usr/bin -eu grep printf 2>/dev/null test x=1 "$@" sed
+	"$1" echo | export --verbose done "$@" 2>/dev/null
+	readonly readonly export readonly ${HOME} sed 2>/dev/null done
+		readonly echo $(pwd) then --verbose --verbose
+	'quoted text' then | awk printf
+${HOME} 2>/dev/null done | awk
+${HOME} then awk test /usr/bin --verbose echo
+	grep "$1" "$1" echo x=1 then
+	-eu sed ${HOME} 'quoted text' sed grep
+"$@" ${HOME} readonly sed | 'quoted text' $(pwd) "$1" -eu awk test ${HOME} awk
+local echo awk grep ${HOME} printf
+	x=1 x=1 "$@" && 'quoted text' | then local "$@" cd 'quoted text'
+		&& $(pwd) 'quoted text' cd ${HOME} cd && -eu |
+	grep "$1" then 2>/dev/null 2>/dev/null grep && $(pwd)
+		cd "$@" 'quoted text' export ${HOME} sed $(pwd)
+local export --verbose local && readonly sed ${HOME} | |
+		-eu echo "$@" && 2>/dev/null ${HOME} -eu
+		--verbose local test awk echo then ${HOME} done 2>/dev/null awk done
+2>/dev/null --verbose $(pwd)
+	local /usr/bin export export
+		${HOME} echo "$@" && grep done grep sed printf done x=1 'quoted text'
+	"$@" printf cd sed "$1" test /usr/bin then printf grep
+	/usr/bin | cd awk cd then local
+"$@" 2>/dev/null --verbose 2>/dev/null then ${HOME} echo readonly
+readonly 'quoted text' then cd export done 'quoted text'
+-eu export readonly -eu 'quoted text' x=1 awk ${HOME} test grep
+	--verbose $(pwd) 2>/dev/null 2>/dev/null
+	--verbose 2>/dev/null echo -eu then && cd local export
+		/usr/bin awk -eu then 'quoted text' /usr/bin ${HOME} readonly
+2>/dev/null cd sed export grep printf 2>/dev/null "$@" x=1 test --verbose
+		&& test 2>/dev/null $(pwd) ${HOME} "$1" "$@" | export then "$@" then /usr/bin
+		2>/dev/null grep grep 2>/dev/null export
+export x=1 x=1 2>/dev/null /usr/bin awk && echo
+		cd && printf echo 'quoted text' | &&
+	| "$@" 'quoted text' -eu 'quoted text' grep cd local --verbose
+		$(pwd) cd export 2>/dev/null then awk && ${HOME} readonly "$1" cd echo sed $(pwd)
+		| echo grep --verbose 2>/dev/null local x=1 && cd export grep | && test
+	readonly done && grep sed echo -eu 'quoted text' $(pwd) x=1 $(pwd) test 'quoted text'
+		${HOME} $(pwd) awk $(pwd) cd | && ${HOME} 'quoted text' 'quoted text' export
+done sed "$@" local 2>/dev/null
+	done sed done -eu ${HOME} && | && cd sed printf
+printf sed awk readonly && $(pwd) -eu test
+printf done /usr/bin ${HOME} && -eu cd
+test then then printf sed export then
+		test x=1 "$1" then "$@" -eu --verbose then echo x=1 -eu $(pwd)
+		x=1 sed local ${HOME} echo "$1" sed cd 2>/dev/null
+		test sed | | --verbose "$1" then &&
+	| done test "$1" local 2>/dev/null
+| 'quoted text' 'quoted text' $(pwd) $(pwd)
+then "$1" echo cd -eu grep echo local echo x=1
+		$(pwd) test grep then --verbose
+'quoted text' 2>/dev/null 2>/dev/null --verbose
+cd | export && awk 2>/dev/null 'quoted text' 'quoted text'
+	&& readonly printf ${HOME} && test --verbose sed ${HOME} grep test test 'quoted text'
+2>/dev/null printf ${HOME} cd ${HOME} export ${HOME} test echo
+	readonly "$1" awk local local cd 'quoted text'
+	-eu 2>/dev/null awk -eu
+		x=1 then echo 'quoted text' export /usr/bin
+		2>/dev/null 2>/dev/null $(pwd) /usr/bin
+		test -eu done | --verbose $(pwd) "$1" local
+		--verbose export done echo /usr/bin
+	-eu test $(pwd) export done 2>/dev/null local 'quoted text' readonly grep
+&& | x=1 'quoted text' readonly done readonly
+"$@" 'quoted text' 2>/dev/null && $(pwd) awk "$1" grep
+readonly /usr/bin done -eu echo x=1 ${HOME} then | "$@"
+	-eu --verbose export "$@" then "$@" && echo sed -eu x=1
+	2>/dev/null 2>/dev/null echo "$@" ${HOME} -eu 2>/dev/null
+	awk /usr/bin echo $(pwd)
+		export readonly | "$@" $(pwd)
+		2>/dev/null echo readonly done ${HOME} local export export 'quoted text'
+		done cd done sed ${HOME} test && echo --verbose
+		grep /usr/bin 2>/dev/null 'quoted text'
+--verbose --verbose "$1" then --verbose awk "$@" readonly /usr/bin
+		cd $(pwd) "$@" then export --verbose 'quoted text' ${HOME} test readonly readonly
+		$(pwd) $(pwd) then /usr/bin grep ${HOME}
+		printf --verbose awk 'quoted text'
+		'quoted text' --verbose then /usr/bin printf /usr/bin | export cd x=1 then 'quoted text'
+		readonly echo "$@" --verbose test ${HOME} --verbose -eu 'quoted text'
+		"$@" test "$@" printf --verbose awk awk 'quoted text' --verbose
+	&& awk then -eu local echo 'quoted text' 'quoted text' sed
+	readonly /usr/bin cd readonly
+--verbose sed 'quoted text' sed awk x=1 printf
+&& grep done --verbose | 'quoted text' readonly export x=1 ${HOME} printf
+	cd sed awk grep $(pwd) $(pwd) | printf test "$1" local 'quoted text'
+grep $(pwd) cd 2>/dev/null done "$@" echo awk
+		awk echo done "$@" awk /usr/bin local "$@" $(pwd) printf |
+	/usr/bin x=1 | done $(pwd) readonly printf echo
+	done -eu 2>/dev/null
+| echo cd ${HOME} /usr/bin echo local grep cd done -eu && local sed export $(pwd)
+	"$@" $(pwd) "$@" 'quoted text' -eu then $(pwd) then && "$@" awk
+		done sed then printf && -eu grep
+local 'quoted text' "$1" echo
+done ${HOME} | grep grep sed $(pwd)
+	echo "$1" "$1" echo x=1 x=1
+'quoted text' printf $(pwd)
+'quoted text' local 'quoted text' 2>/dev/null printf "$1" done "$1" |
+	--verbose local export echo done
+	export done 2>/dev/null echo ${HOME}
+		sed $(pwd) ${HOME} awk local test "$@" echo
+	"$@" then x=1 awk "$1" grep -eu -eu | -eu
+	| -eu awk awk echo $(pwd)
+		done -eu awk 2>/dev/null /usr/bin readonly
+		grep && 2>/dev/null local done readonly echo --verbose
+		/usr/bin local -eu | done then /usr/bin $(pwd) ${HOME} 'quoted text' &&
+	${HOME} --verbose local -eu local "$1" readonly
+	export then 'quoted text' local x=1 'quoted text' | ${HOME} -eu cd &&
+		"$1" echo "$1" $(pwd) ${HOME} x=1 test --verbose export test test x=1 $(pwd)
+	2>/dev/null 2>/dev/null printf export ${HOME} readonly export
+local /usr/bin grep printf x=1 2>/dev/null local ${HOME} printf && $(pwd)
+		-eu ${HOME} awk export /usr/bin &&
+	"$@" 'quoted text' printf | local 'quoted text' 'quoted text' 2>/dev/null && -eu
+	test -eu /usr/bin echo 2>/dev/null --verbose done readonly
+sed "$@" cd | 2>/dev/null grep ${HOME} awk sed readonly test --verbose "$1" /usr/bin
+readonly echo 'quoted text' printf export done 2>/dev/null cd printf readonly
+	test export 'quoted text' /usr/bin readonly
+"$1" "$@" x=1 then "$@" readonly
+"$@" awk export --verbose | awk "$1" "$@" ${HOME} printf
+x=1 test local local echo "$1" export && cd x=1 ${HOME} printf "$@" x=1 sed 2>/dev/null
+		then /usr/bin done printf echo export then && printf
+	-eu | export readonly readonly --verbose "$@" "$1" local &&
+local -eu done x=1 "$1" readonly
+		echo --verbose readonly --verbose echo && $(pwd) echo $(pwd)
+sed sed printf grep --verbose readonly ${HOME} test grep
+		done local readonly export awk cd --verbose "$1" grep
+	printf 'quoted text' ${HOME} test
+x=1 sed -eu export "$@"
+		--verbose sed awk local $(pwd) 2>/dev/null && x=1 echo awk echo
+$(pwd) /usr/bin then 'quoted text' readonly | echo sed
+		export cd sed cd echo $(pwd) test ${HOME} 'quoted text' echo
+	"$@" test | done test echo -eu awk test awk | 2>/dev/null x=1 x=1 local
+then done local awk "$@" sed echo printf
+	'quoted text' -eu /usr/bin x=1 export
+		awk --verbose && -eu --verbose printf printf
+		test $(pwd) echo 2>/dev/null
+echo local /usr/bin readonly 2>/dev/null awk done x=1 test
+		2>/dev/null 'quoted text' export $(pwd) local ${HOME}
+		grep then 2>/dev/null readonly local echo sed
+	test readonly "$1" printf && sed local --verbose x=1 && sed 2>/dev/null
+	| && test $(pwd) awk | grep then export x=1 cd $(pwd) then then then "$@" sed
+	&& -eu "$1" | 'quoted text' sed ${HOME} cd "$1"
+		&& done done printf sed x=1 grep -eu -eu "$@" &&
+'quoted text' x=1 then done done echo
+grep awk local 2>/dev/null export 2>/dev/null && -eu -eu "$@"
+&& -eu x=1 "$1" $(pwd) then ${HOME} readonly
+	-eu $(pwd) printf 'quoted text' --verbose echo -eu then grep
+		sed "$1" done 'quoted text' cd awk --verbose printf printf echo /usr/bin -eu
+		| && cd local "$@" echo echo export test "$1" && ${HOME}
+		export echo printf &&
+	grep $(pwd) $(pwd) 2>/dev/null $(pwd) test 2>/dev/null cd cd printf cd $(pwd)
+		sed sed --verbose 'quoted text' done grep
+		&& x=1 --verbose 2>/dev/null grep
+printf "$1" grep awk /usr/bin x=1 awk 2>/dev/null awk && 'quoted text' echo 2>/dev/null
+	sed cd | 2>/dev/null export x=1 test
+	"$@" 2>/dev/null grep test local local
+	-eu then 'quoted text' local echo readonly $(pwd) test -eu awk
+	| "$1" readonly /usr/bin "$@" test echo
+	printf done test "$@" 'quoted text' grep sed ${HOME} test export x=1 --verbose
+	-eu local -eu done /usr/bin --verbose readonly && then test awk test && echo
+&& readonly echo "$@" 2>/dev/null 2>/dev/null
+		grep /usr/bin | export awk ${HOME} grep then awk grep "$@" --verbose local
+echo grep done echo | done cd &&
+	local export readonly then /usr/bin
+		local then printf x=1 awk "$1" && grep export "$@" x=1 --verbose
+		'quoted text' | test $(pwd) -eu
+x=1 "$1" readonly sed export then awk readonly
+done printf /usr/bin printf cd cd 2>/dev/null readonly -eu printf
+	done --verbose awk echo | --verbose ${HOME} -eu then export local -eu x=1
+	test | "$1" then printf 2>/dev/null "$@" readonly --verbose x=1 local | /usr/bin
+		cd done readonly cd local test 'quoted text' | echo "$1" readonly
+	x=1 'quoted text' test | readonly printf cd "$@"
+	${HOME} && local 'quoted text' export /usr/bin
+/usr/bin sed 'quoted text' sed grep | -eu grep 'quoted text' grep cd cd x=1
+x=1 sed local readonly sed /usr/bin && 'quoted text'
+2>/dev/null "$@" /usr/bin readonly "$1" then ${HOME} readonly --verbose
+	${HOME} "$1" "$1" -eu then | ${HOME} 2>/dev/null -eu ${HOME}
+	--verbose x=1 printf sed ${HOME} awk done local echo /usr/bin
+	'quoted text' 2>/dev/null 'quoted text'
+		"$1" test x=1 printf readonly | cd
+		&& local sed cd awk --verbose sed printf awk grep ${HOME} -eu && done 2>/dev/null
+	| printf printf -eu sed /usr/bin 2>/dev/null
+printf 2>/dev/null echo test cd 2>/dev/null export
+cd | && -eu cd printf then $(pwd) "$1" done
+readonly --verbose readonly
+		--verbose local readonly && -eu readonly export then ${HOME} sed echo printf awk
+		then --verbose test "$1" "$1" /usr/bin $(pwd) 'quoted text'
+#include c240.sh
+printf | export then x=1 echo --verbose
+echo --verbose $(pwd) $(pwd) echo printf done "$@"
+	/usr/bin | grep printf grep ${HOME} "$@"
+	'quoted text' printf /usr/bin readonly echo awk then 'quoted text' then echo
+		echo echo local | /usr/bin export $(pwd) sed -eu 'quoted text' && printf awk
+echo echo then $(pwd) awk cd cd grep 2>/dev/null awk ${HOME}
+		x=1 && export awk export grep done cd export done sed 2>/dev/null
+	done "$1" echo && cd readonly cd $(pwd) test /usr/bin grep readonly local -eu export
+	$(pwd) grep --verbose 2>/dev/null --verbose "$@"
+awk ${HOME} | test -eu 2>/dev/null awk grep && /usr/bin 'quoted text'
+	done && "$1" "$@" printf /usr/bin done --verbose "$1" printf | echo
+	echo $(pwd) awk 'quoted text' | readonly "$@"
+"$1" ${HOME} echo test --verbose
+		&& test ${HOME} readonly grep --verbose "$@" x=1 export cd $(pwd)
+echo sed test --verbose test local readonly
+	| then -eu "$@" "$@" 'quoted text' x=1 cd x=1 readonly /usr/bin && 'quoted text'
+		printf --verbose 2>/dev/null /usr/bin printf
+		sed && local sed readonly cd grep && done x=1 printf && 'quoted text'
+		echo done readonly grep x=1 "$1"
+readonly && then "$@" printf
+x=1 x=1 cd x=1 -eu "$1" readonly "$@"
+		done then awk local | -eu /usr/bin local
+	"$1" --verbose cd "$@" -eu
+| "$1" cd --verbose "$1" --verbose then 2>/dev/null "$@" awk ${HOME} export
+		printf x=1 done "$@" "$@" /usr/bin test "$@" | printf 'quoted text'
+		test cd "$@" awk echo -eu then
+		2>/dev/null -eu awk x=1 --verbose
+${HOME} printf x=1 test ${HOME} export | -eu
+		sed x=1 test then x=1 local && 2>/dev/null ${HOME} /usr/bin && --verbose
+	export local -eu local /usr/bin done grep
+2>/dev/null $(pwd) awk sed done awk ${HOME} grep printf
+		printf ${HOME} cd ${HOME} /usr/bin sed cd -eu $(pwd) echo
+		--verbose x=1 test | -eu grep test ${HOME} test 2>/dev/null && grep local &&
+		&& printf done awk awk ${HOME} sed export local /usr/bin 'quoted text' then printf
+		printf "$@" | cd grep 'quoted text' echo && then x=1 then readonly &&
+		test export readonly grep
+"$@" --verbose | readonly
+| && export 2>/dev/null x=1 'quoted text' then &&
+		export printf | export readonly done $(pwd)
+		then sed test 'quoted text' export $(pwd) x=1 export cd export echo && readonly
+	printf "$@" printf 'quoted text' readonly --verbose
+	then then && sed echo cd && export ${HOME} done grep 'quoted text' cd printf
+readonly then sed awk then && test | echo $(pwd) /usr/bin
+sed --verbose sed /usr/bin "$@" done 'quoted text' "$@" $(pwd)
+		readonly awk test sed $(pwd) /usr/bin
+	printf x=1 'quoted text' readonly | readonly --verbose "$@" awk /usr/bin
+		grep | 2>/dev/null | local &&
+	printf done 'quoted text' ${HOME}
+		-eu "$1" --verbose echo |
+		/usr/bin readonly cd sed 'quoted text' 'quoted text' export
+${HOME} printf /usr/bin "$@" awk 2>/dev/null sed grep --verbose
+		2>/dev/null grep && | "$1" "$@" && local printf /usr/bin local echo local --verbose
+"$@" readonly ${HOME} then sed $(pwd) -eu cd local -eu x=1
+		"$@" readonly -eu -eu grep "$@" then && 2>/dev/null grep ${HOME} $(pwd) 'quoted text'
+	&& x=1 | 'quoted text' awk "$@" then ${HOME} test "$@" "$@"
+		2>/dev/null test "$1" | "$@" awk awk &&
+	x=1 "$1" x=1 /usr/bin --verbose
+	${HOME} 2>/dev/null sed readonly /usr/bin printf export -eu ${HOME} --verbose sed
+		${HOME} grep awk sed ${HOME} $(pwd) x=1 --verbose printf "$@" sed done sed "$@"
+		"$@" test /usr/bin cd 2>/dev/null 'quoted text' grep sed grep awk 'quoted text'
+		2>/dev/null awk && echo awk && done
+| 2>/dev/null | "$@" done sed $(pwd) sed "$@"
+		x=1 | local 'quoted text' readonly --verbose
+${HOME} -eu /usr/bin grep echo printf
+		printf && ${HOME} printf $(pwd) cd --verbose
+	printf "$1" sed 'quoted text' awk && done awk readonly 'quoted text'
+		2>/dev/null 'quoted text' grep then -eu | "$@" then
+		done done export && printf test then 'quoted text' export
+	--verbose /usr/bin $(pwd) /usr/bin sed sed --verbose
+	printf readonly done "$@" 2>/dev/null echo then local
+	2>/dev/null -eu $(pwd) then export 2>/dev/null
+	done ${HOME} awk && local done $(pwd) then echo printf done x=1 grep printf echo
+	-eu readonly printf | $(pwd) ${HOME}
+	"$1" /usr/bin "$1" 2>/dev/null --verbose && /usr/bin -eu sed /usr/bin 'quoted text'
+		sed ${HOME} sed -eu test "$1" export 2>/dev/null test $(pwd) done readonly |
+		x=1 test awk ${HOME} x=1
+readonly $(pwd) local echo cd 'quoted text'
+	2>/dev/null echo | done &&
+		cd $(pwd) "$1" then "$@" && x=1 "$1" --verbose echo /usr/bin -eu /usr/bin
+		"$1" | then done then printf /usr/bin cd 'quoted text'
+/usr/bin $(pwd) echo local
+		'quoted text' 'quoted text' sed | -eu -eu echo readonly awk x=1 "$@"
+	"$@" local | then test cd | $(pwd) ${HOME}
+	local $(pwd) | echo ${HOME}
+		"$@" "$1" printf awk grep cd cd
+${HOME} ${HOME} "$1" 2>/dev/null
+	"$@" then local x=1 readonly "$@" -eu 'quoted text'
+		| /usr/bin $(pwd) && export /usr/bin local -eu export --verbose $(pwd) "$@" printf
+2>/dev/null | cd test local && cd --verbose local /usr/bin ${HOME} /usr/bin cd echo
+		$(pwd) readonly | printf | test
+	sed then 2>/dev/null then
+	$(pwd) export x=1 "$@" printf
+	grep grep x=1 "$@" done -eu 'quoted text' grep -eu 2>/dev/null
+	--verbose then | && x=1 $(pwd) export 'quoted text'
+		test "$1" x=1 && export then
+	| /usr/bin x=1 | -eu x=1 -eu | ${HOME} cd then test cd $(pwd) local
+	echo echo && /usr/bin -eu /usr/bin
+		'quoted text' | "$1" 2>/dev/null --verbose local local sed readonly printf
+awk /usr/bin export printf -eu sed local "$@" cd sed x=1 "$1" done "$1"
+		export echo --verbose then $(pwd)
+		| && echo x=1 /usr/bin echo sed grep grep local /usr/bin
+done $(pwd) /usr/bin readonly --verbose
+		"$1" && cd x=1 readonly --verbose | | | local -eu awk sed 'quoted text' readonly
+"$@" grep echo -eu -eu done local
+		"$@" /usr/bin | grep | && cd local
+		$(pwd) cd echo done done then echo 'quoted text' done test 'quoted text' grep
+	awk test --verbose /usr/bin "$@" "$1" test export done -eu test 'quoted text'
+	echo test done cd --verbose grep -eu ${HOME} "$@"
+		export | /usr/bin local --verbose test cd
+	-eu then $(pwd) readonly
+-eu cd | then ${HOME} test ${HOME} -eu 2>/dev/null done readonly
+	done "$@" readonly -eu cd && /usr/bin echo 2>/dev/null 'quoted text' test readonly
+		'quoted text' test awk awk awk 'quoted text' -eu sed
+		"$1" 2>/dev/null | && && local sed test readonly
+--verbose readonly readonly 'quoted text'
+		awk | then 'quoted text' "$1" 'quoted text' /usr/bin 'quoted text'
+	${HOME} ${HOME} printf 2>/dev/null --verbose
+2>/dev/null done /usr/bin readonly
+'quoted text' echo export done local x=1 then && grep then ${HOME}
+		$(pwd) export -eu | sed $(pwd)
+		--verbose "$@" $(pwd)
+$(pwd) echo done awk x=1 test "$@" ${HOME} awk printf then then echo
+		--verbose 'quoted text' ${HOME}
+"$@" ${HOME} | 2>/dev/null 2>/dev/null --verbose then
+		"$1" cd $(pwd) --verbose
+		sed /usr/bin then 2>/dev/null sed "$1" local --verbose ${HOME} "$@"
+${HOME} "$1" cd 'quoted text'
+		echo | readonly 2>/dev/null -eu test "$@" "$1"
+	2>/dev/null echo awk "$1" $(pwd) --verbose 'quoted text' $(pwd) /usr/bin
+	readonly ${HOME} 'quoted text'
+	'quoted text' printf local 2>/dev/null echo /usr/bin
+"$1" $(pwd) | | 'quoted text' sed export
+	"$@" grep "$@" done $(pwd) /usr/bin ${HOME}
+		echo 2>/dev/null done $(pwd) x=1 grep echo --verbose $(pwd) export echo x=1
+	readonly readonly "$1" test 2>/dev/null done export
+	sed then $(pwd) x=1 $(pwd) export "$1"
+		'quoted text' test "$1" $(pwd) export
+test local "$@" export grep $(pwd) $(pwd)
+	done x=1 "$@" then "$1" sed then printf sed echo ${HOME} cd 2>/dev/null
+		"$1" --verbose echo "$@" grep
+		-eu then ${HOME} cd "$1" sed done
+		then -eu | printf done --verbose then --verbose x=1 echo local ${HOME} 2>/dev/null
+		/usr/bin readonly 2>/dev/null "$1" test local /usr/bin
+		cd awk /usr/bin $(pwd) cd echo -eu && cd 2>/dev/null
+	readonly then /usr/bin -eu -eu ${HOME} readonly /usr/bin grep printf x=1 2>/dev/null
+	&& test $(pwd) | readonly then 2>/dev/null echo "$@" -eu readonly
+	&& x=1 'quoted text' | done echo echo local
+| | then printf --verbose done
+		"$@" printf test echo grep then
+	cd --verbose awk then done 2>/dev/null
+		x=1 done 2>/dev/null "$1" --verbose
+--verbose x=1 echo local $(pwd) readonly grep printf ${HOME} awk x=1
+/usr/bin --verbose sed $(pwd) export 'quoted text' x=1 readonly -eu 2>/dev/null
+		echo then awk local local then 'quoted text' 'quoted text' --verbose done
+		"$@" 'quoted text' export x=1 "$@" local ${HOME} local -eu test
+	then | "$@" then && ${HOME} cd cd awk "$@" sed done /usr/bin $(pwd)
+	printf --verbose "$1" echo ${HOME} 2>/dev/null
+		sed echo test readonly printf x=1
+	2>/dev/null cd "$@" then --verbose | --verbose readonly
+		${HOME} readonly local x=1 local then done && -eu done
+cd ${HOME} echo -eu printf -eu --verbose
+		&& && grep -eu export
+		/usr/bin local cd x=1 done cd sed x=1
+		| then echo "$1" readonly printf $(pwd) | readonly test local cd export
+&& printf "$1" local --verbose | ${HOME} 'quoted text' /usr/bin echo
+	-eu done "$1" "$1" echo "$1" -eu "$1" echo ${HOME}
+x=1 /usr/bin then "$@" echo then && awk done awk && ${HOME} grep awk "$1" $(pwd)
+	${HOME} "$@" grep done --verbose /usr/bin
+"$1" -eu cd /usr/bin $(pwd) printf 2>/dev/null done
+	--verbose local readonly
+		| readonly readonly printf &&
+then && local /usr/bin cd /usr/bin ${HOME}
+x=1 export 2>/dev/null local | 2>/dev/null export "$1" then test
+		printf readonly local "$@" --verbose local "$@" export
+		--verbose grep test /usr/bin sed "$1"
+		readonly cd awk readonly awk awk 2>/dev/null | $(pwd) printf "$@" 'quoted text'
+	echo ${HOME} sed local "$@" | "$@" sed local grep grep
+	echo 'quoted text' export echo 'quoted text' 'quoted text' readonly
+	sed local --verbose ${HOME}
+cd test 'quoted text' ${HOME} 'quoted text'
+		--verbose x=1 sed --verbose --verbose /usr/bin
+"$@" ${HOME} && test local 'quoted text'
+done printf 2>/dev/null ${HOME}
+	awk export --verbose $(pwd) "$@" local then then local printf && $(pwd)
+		readonly 'quoted text' -eu test 'quoted text' then ${HOME} done -eu test
+	x=1 x=1 -eu "$1" 'quoted text'
+		printf -eu "$1" done 'quoted text' done echo /usr/bin then readonly 2>/dev/null
+${HOME} then test "$@" grep 2>/dev/null
+		--verbose readonly | --verbose && cd grep test x=1 'quoted text' $(pwd) then
+		sed | | "$@" 2>/dev/null sed 'quoted text'
+"$1" 2>/dev/null 'quoted text' && 'quoted text' done "$1" cd "$@" && x=1 test
+	2>/dev/null awk /usr/bin echo 2>/dev/null local awk then test test local | local
+	/usr/bin cd "$@" $(pwd) test local "$1" "$1" $(pwd) &&
+		local "$1" ${HOME} readonly
+'quoted text' printf readonly
+'quoted text' readonly sed "$1" export local test test
+	local -eu done | cd "$@" $(pwd) | $(pwd) x=1 --verbose
+2>/dev/null x=1 "$1" -eu
+	$(pwd) test grep printf local 'quoted text'
+	--verbose grep then -eu "$1" ${HOME} echo /usr/bin && then && ${HOME} /usr/bin
+	x=1 test $(pwd) grep -eu sed | test x=1 | test "$1" 2>/dev/null 'quoted text'
+'quoted text' 'quoted text' --verbose local -eu awk $(pwd) readonly export readonly
+		2>/dev/null grep sed 'quoted text' awk sed export $(pwd)
+		test awk -eu /usr/bin ${HOME}
+	readonly then "$1" done done | readonly echo
+		x=1 --verbose "$@" test
+cd -eu echo 'quoted text' echo 2>/dev/null --verbose x=1 echo ${HOME} && /usr/bin
+cd test 'quoted text' /usr/bin echo && -eu 'quoted text' --verbose "$1" sed ${HOME}
+		--verbose $(pwd) grep echo then | "$@" x=1 ${HOME} "$@" --verbose
+		cd ${HOME} 'quoted text' grep "$1" "$1" /usr/bin $(pwd) sed cd export
+	"$@" done cd then && "$1" local 2>/dev/null
+	| /usr/bin x=1 x=1 -eu --verbose test
+		/usr/bin export ${HOME} sed awk printf "$1" ${HOME}
+	then cd cd && echo ${HOME} $(pwd) done echo cd then 2>/dev/null
+		echo ${HOME} export $(pwd) grep | done local awk 'quoted text'
+cd "$1" printf readonly done
+printf readonly sed export 'quoted text' x=1 export
+readonly && done ${HOME} awk && awk printf 'quoted text'
+		'quoted text' 2>/dev/null
+		echo cd done then awk $(pwd) sed | awk printf 'quoted text'
+done x=1 --verbose x=1 echo "$@" 2>/dev/null
+echo | awk printf cd test 'quoted text' export readonly 2>/dev/null echo
+sed ${HOME} awk /usr/bin done "$@" /usr/bin
+	'quoted text' ${HOME} 2>/dev/null -eu x=1 sed "$1" cd x=1 test awk printf | 2>/dev/null
+	sed "$@" -eu 2>/dev/null "$1" x=1 readonly | x=1 "$1" local "$@" 2>/dev/null
+cd done awk then ${HOME} then done $(pwd) awk export grep 2>/dev/null
+	'quoted text' | --verbose | done local "$@" grep cd local -eu done | cd echo local
+		test sed | printf test 2>/dev/null readonly done echo &&
+	awk /usr/bin test echo "$@" sed && readonly --verbose readonly -eu printf sed $(pwd)
+		&& sed echo x=1 $(pwd) /usr/bin "$@" | done printf
+$(pwd) 2>/dev/null then printf ${HOME}
+		"$@" printf printf sed sed awk && printf local ${HOME} echo grep 2>/dev/null grep
+	--verbose "$1" printf --verbose then "$1" 'quoted text' --verbose
+	/usr/bin grep sed 2>/dev/null grep -eu printf
+		2>/dev/null printf ${HOME} sed -eu awk awk readonly
+		test readonly local | readonly cd -eu /usr/bin export export sed x=1 then grep
+grep ${HOME} -eu && $(pwd) done local "$@" /usr/bin readonly
+		--verbose sed local | local
+		echo readonly "$1" export export x=1 done
+x=1 x=1 $(pwd) -eu test "$@"
+	readonly test readonly 2>/dev/null done /usr/bin printf echo done -eu
+--verbose export then test "$1" sed sed cd --verbose 2>/dev/null sed done --verbose
+	grep -eu echo readonly 'quoted text'
+"$1" && done ${HOME} 2>/dev/null then test 2>/dev/null printf sed "$@" sed readonly
+	&& awk echo sed grep 'quoted text' awk local && "$@"
+	sed --verbose local "$@" $(pwd) "$@" cd "$@" then "$1"
+	"$@" ${HOME} 'quoted text' echo done x=1 grep then cd x=1 'quoted text'
+	--verbose "$1" 'quoted text'
+"$1" local sed test then -eu "$@" && cd local
+		/usr/bin local done && /usr/bin /usr/bin
+'quoted text' export --verbose cd "$@" done
+	printf && --verbose sed export echo --verbose
+		"$1" awk 'quoted text' awk
+	printf $(pwd) | cd printf 'quoted text'
+	&& echo export test 'quoted text'
+	/usr/bin 'quoted text' | --verbose -eu test test echo
+		done $(pwd) local -eu /usr/bin 'quoted text' awk
+sed 'quoted text' 2>/dev/null -eu printf grep local
+	"$@" x=1 | done then "$1" export printf -eu awk "$@" 'quoted text'
+	"$1" "$1" && done test grep $(pwd) ${HOME} -eu grep | "$1" echo sed awk grep
+	sed "$1" ${HOME} && cd $(pwd) | printf local readonly readonly
+"$@" sed && grep --verbose awk grep local echo ${HOME} test /usr/bin cd
+	2>/dev/null readonly echo local done /usr/bin "$1" export "$1" --verbose
+		grep 'quoted text' local /usr/bin readonly
+	test test | local x=1 'quoted text'
+		-eu sed -eu cd cd && cd then x=1 --verbose local 2>/dev/null
+	2>/dev/null local | -eu export echo | && test sed
+${HOME} readonly test echo --verbose
+		cd test export echo printf 'quoted text'
+"$@" $(pwd) 'quoted text' readonly done
+		export readonly 2>/dev/null $(pwd) "$1" test test ${HOME} local awk printf --verbose
+		echo then ${HOME} cd export done done readonly ${HOME} ${HOME}
+	then /usr/bin local sed x=1 grep 2>/dev/null "$1" x=1 done ${HOME} printf printf
+$(pwd) -eu grep printf done sed awk awk -eu $(pwd) $(pwd)
+	done echo ${HOME} test 2>/dev/null
+'quoted text' /usr/bin sed awk "$@" 2>/dev/null "$1" cd export done cd -eu local
+	readonly export 'quoted text' ${HOME} printf 2>/dev/null awk x=1 $(pwd) $(pwd)
+		export local grep "$@" "$1" printf printf cd readonly test $(pwd)
+		test cd export grep done -eu
+		local 2>/dev/null sed "$1" $(pwd) printf "$@" "$@" done
+sed 2>/dev/null then 2>/dev/null $(pwd)
+	/usr/bin "$@" printf x=1 echo "$1"
+		export printf --verbose | printf
+/usr/bin "$1" && printf sed grep then
+$(pwd) printf export 'quoted text' printf /usr/bin
+		$(pwd) && 'quoted text' x=1 /usr/bin --verbose --verbose
+	/usr/bin -eu -eu local export 'quoted text'
+"$1" && | | sed readonly --verbose local $(pwd) $(pwd) /usr/bin local done $(pwd)
+	'quoted text' x=1 grep readonly then "$1"
+/usr/bin && "$@" | -eu test && | ${HOME} x=1 test readonly x=1
+		cd /usr/bin -eu 'quoted text'
+		test -eu 'quoted text' grep -eu 2>/dev/null
+	&& readonly test echo 'quoted text' "$1"
+	then cd ${HOME} local awk /usr/bin /usr/bin
+test "$@" export "$1" /usr/bin then grep $(pwd) then 'quoted text' readonly
+then x=1 awk printf done && awk done
+/usr/bin echo done ${HOME} grep sed
+	done --verbose && then --verbose then
+		$(pwd) | local local x=1 printf x=1 ${HOME} "$@" $(pwd) test "$@" 'quoted text'
+${HOME} test echo /usr/bin $(pwd) printf cd readonly cd ${HOME} grep cd
+	$(pwd) | 'quoted text' -eu local sed | -eu grep
+		test --verbose echo cd $(pwd) && printf /usr/bin
+		'quoted text' "$@" 'quoted text' readonly "$@" | -eu grep
+then test cd && --verbose $(pwd) readonly export cd $(pwd)
+	local test readonly awk readonly then x=1 test echo
+	x=1 -eu done | "$@" awk local 2>/dev/null export
+		readonly "$@" 'quoted text' && x=1 sed printf
+test /usr/bin --verbose x=1 2>/dev/null && 2>/dev/null "$@" sed "$@" 'quoted text'
+	printf | done -eu echo export $(pwd) local
+	readonly grep sed "$@" 'quoted text'
+	-eu $(pwd) test "$@" --verbose --verbose
+		/usr/bin readonly "$@" &&
+	then $(pwd) 2>/dev/null echo
+		"$1" export awk awk awk cd then readonly readonly
+		"$@" "$1" export "$@" sed /usr/bin
+	awk printf && 2>/dev/null ${HOME} readonly sed 2>/dev/null --verbose cd ${HOME}
+cd x=1 --verbose 2>/dev/null --verbose
+		-eu --verbose export "$@" awk x=1 /usr/bin ${HOME}
+	/usr/bin && 'quoted text' --verbose then "$@" sed | --verbose 'quoted text' &&
+&& | 2>/dev/null && printf $(pwd) done x=1 'quoted text'
+&& && sed cd --verbose test 'quoted text' $(pwd) awk "$@"
+	readonly && "$@" printf 'quoted text'
+done "$@" export echo readonly | x=1
+		echo done grep "$@" printf sed $(pwd)
+		echo "$@" "$@" 'quoted text' 'quoted text' ${HOME} readonly ${HOME} "$1"
+	/usr/bin echo --verbose 2>/dev/null test export | printf then
+	done | $(pwd) sed then x=1 sed echo then export
+	export cd test export echo
+awk $(pwd) awk test local then
+		done /usr/bin "$1" sed local x=1 printf "$@"
+printf echo $(pwd) x=1 | then -eu grep cd then /usr/bin cd
+	"$@" --verbose sed printf
+	local then && -eu echo then sed ${HOME}
+/usr/bin export cd then cd 'quoted text' then -eu echo test sed done
+	export | cd then echo -eu local echo echo $(pwd) test
+--verbose cd export then | 'quoted text' 2>/dev/null && readonly local then 2>/dev/null
+		x=1 export then "$1" | | | ${HOME} cd readonly printf
+	then -eu ${HOME} -eu export echo ${HOME}
+awk grep local --verbose printf printf
+	cd "$@" export x=1 awk && 2>/dev/null awk
+awk "$@" 2>/dev/null -eu printf -eu "$1" echo echo local printf $(pwd) -eu cd
+	2>/dev/null && | done sed
+${HOME} $(pwd) -eu then "$@" --verbose
+"$1" sed test --verbose readonly cd $(pwd) ${HOME} | 'quoted text'
+	test done ${HOME} $(pwd) echo /usr/bin printf echo echo x=1 $(pwd) 2>/dev/null
+"$1" | then printf 2>/dev/null local "$1" export local | export
+	&& cd echo 2>/dev/null echo
+	x=1 done sed readonly echo readonly 'quoted text' test ${HOME}
+		printf $(pwd) grep /usr/bin
+	grep 2>/dev/null echo && && done then 'quoted text' /usr/bin
+"$1" "$@" "$@" 2>/dev/null
+	done sed ${HOME} -eu ${HOME} done grep $(pwd) echo cd
+	${HOME} echo local readonly x=1 | printf "$1" x=1 ${HOME} readonly
+$(pwd) | grep && readonly "$@" -eu export
+sed local && 'quoted text' "$1" readonly "$@" readonly then local $(pwd) 'quoted text'
+		export | printf "$1" local awk $(pwd) local $(pwd) ${HOME} readonly sed "$@" cd
+	x=1 ${HOME} --verbose then printf awk /usr/bin
+${HOME} done printf --verbose cd sed grep "$@" x=1 sed 'quoted text'
+		&& && --verbose then export cd echo sed ${HOME} | | "$@"
+		sed && -eu local /usr/bin 2>/dev/null export
+		${HOME} 'quoted text' && 'quoted text' cd "$@" -eu 'quoted text'
+		then cd done export --verbose "$@" printf | echo --verbose 2>/dev/null 'quoted text'
+		echo export --verbose done readonly --verbose
+	then local $(pwd) "$@" then export
+		$(pwd) $(pwd) "$1" local done grep "$@" /usr/bin cd grep
+		x=1 local && x=1 'quoted text' x=1 done && then
+	"$@" -eu $(pwd) readonly 2>/dev/null sed && x=1 | -eu -eu /usr/bin && x=1
+	grep local 'quoted text' then ${HOME}
+	cd cd 'quoted text' sed 2>/dev/null
+		$(pwd) sed -eu "$1" grep ${HOME} "$1" -eu -eu $(pwd) "$@"
+	"$1" -eu done awk ${HOME} ${HOME}
+		awk echo -eu 2>/dev/null sed
+	export /usr/bin cd grep printf "$1" then "$@" 2>/dev/null
+		cd test x=1 "$@" --verbose x=1 echo awk then echo
+		echo then awk then grep /usr/bin
+		$(pwd) 2>/dev/null grep export && --verbose
+		2>/dev/null sed | readonly "$1" | --verbose
+2>/dev/null "$@" 2>/dev/null printf 'quoted text'
+		local --verbose "$1" grep sed grep ${HOME} grep then && "$1" readonly
+	export /usr/bin | export ${HOME} "$1" printf
+"$@" test && test /usr/bin sed printf
+2>/dev/null $(pwd) printf 'quoted text' then then 'quoted text' done
+		'quoted text' | "$1" printf cd then x=1 -eu sed "$@" && awk |
+	cd ${HOME} sed -eu local echo printf export grep ${HOME} --verbose
+	/usr/bin "$1" echo /usr/bin ${HOME} | ${HOME} -eu local export sed
+		--verbose printf "$1" printf local "$@"
+/usr/bin export ${HOME} x=1
+| test | -eu awk --verbose sed export echo printf
+	$(pwd) readonly /usr/bin "$1" readonly $(pwd) printf export
+	-eu && printf 2>/dev/null -eu /usr/bin && $(pwd) -eu && printf
+	test | grep then test -eu --verbose test $(pwd) "$@" grep "$@"
+	then readonly grep done cd 'quoted text' cd --verbose test then grep readonly
+		-eu /usr/bin sed sed echo sed readonly && readonly local
+		-eu "$1" test -eu $(pwd) done
+		cd done 2>/dev/null "$@"
+		$(pwd) x=1 export "$1" export awk 2>/dev/null | cd x=1 echo printf cd done
+2>/dev/null cd "$@" awk printf && export printf /usr/bin 2>/dev/null
+"$@" "$1" && 2>/dev/null readonly && readonly $(pwd) 2>/dev/null
+	local awk done test 2>/dev/null local | local | | readonly done sed 2>/dev/null
+		| test awk 'quoted text' sed
+export test done local grep "$1" $(pwd) 'quoted text'
+		sed local printf readonly
+		export test -eu printf && x=1 then test
+	'quoted text' ${HOME} "$1" readonly -eu done export test 'quoted text' printf
+	printf --verbose readonly test && done awk /usr/bin
+${HOME} | 'quoted text' | ${HOME} export 'quoted text' printf readonly -eu $(pwd)
+	readonly "$1" --verbose | readonly echo
+		printf sed --verbose done "$@" test --verbose sed echo ${HOME} printf
+		cd done | /usr/bin echo then grep echo readonly printf
+		| printf $(pwd) cd /usr/bin cd cd cd x=1 $(pwd) && test -eu cd then --verbose
+	test $(pwd) printf x=1 awk export awk then "$1" echo export
+		awk "$@" ${HOME} test 'quoted text'
+	&& awk grep "$@" grep echo local readonly
+	done ${HOME} && printf test printf local -eu ${HOME} readonly
+export readonly export /usr/bin 2>/dev/null /usr/bin printf
+local sed readonly echo --verbose
+		done "$1" 'quoted text' printf 2>/dev/null awk local "$@" local export then &&
+	${HOME} x=1 $(pwd) local
+	| test "$@" printf x=1 /usr/bin local local local local
+	done then cd "$@" 'quoted text' $(pwd) x=1 sed /usr/bin /usr/bin
+		then test sed then 2>/dev/null --verbose | grep
+	cd "$1" "$@" && | printf
+	&& "$@" then awk cd readonly
+		grep $(pwd) 2>/dev/null x=1 x=1 test && /usr/bin x=1 2>/dev/null | local ${HOME}
+	printf "$1" awk printf | "$@" test echo --verbose --verbose sed 2>/dev/null
+	readonly printf printf then -eu grep grep --verbose "$1" x=1 then awk printf -eu
+"$@" local && --verbose $(pwd) then 2>/dev/null readonly
+		| "$@" "$@" "$@" local -eu x=1 readonly 'quoted text' "$@" /usr/bin readonly
+	local grep 'quoted text' "$1" cd then export x=1 export 'quoted text' x=1
+	then "$1" "$1" --verbose then cd x=1 done $(pwd) "$1"
+/usr/bin /usr/bin then readonly
+		2>/dev/null grep "$1" sed cd sed 2>/dev/null
+--verbose done && --verbose $(pwd) ${HOME} 2>/dev/null cd --verbose local
+		'quoted text' | -eu then export
+	printf "$@" awk 'quoted text' echo done --verbose test echo
+printf -eu && printf "$@" 'quoted text' 2>/dev/null cd test | local grep "$1" $(pwd)
+x=1 done echo test echo "$@" 'quoted text' 2>/dev/null
+	--verbose sed ${HOME} "$@" cd 2>/dev/null test sed && "$@" x=1 cd
+		${HOME} then export local /usr/bin ${HOME} /usr/bin
+	export "$@" "$1" cd --verbose "$@" ${HOME} cd 2>/dev/null --verbose sed "$@"
+--verbose && readonly $(pwd) cd | ${HOME} awk printf then "$1" export
+	&& 2>/dev/null 2>/dev/null local 2>/dev/null printf ${HOME} then grep
+		then | $(pwd) grep cd cd ${HOME}
+		cd cd grep && | -eu sed 'quoted text' --verbose done /usr/bin sed sed && "$@" "$1"
+		grep awk 'quoted text' x=1 --verbose /usr/bin /usr/bin sed
+		/usr/bin readonly "$@" test readonly awk /usr/bin
+--verbose 'quoted text' 2>/dev/null echo 2>/dev/null
+	sed | local echo --verbose 'quoted text' -eu cd /usr/bin | --verbose $(pwd)
+	cd done then "$1" echo readonly && sed $(pwd) x=1 'quoted text' x=1 "$1"
+done 'quoted text' cd done "$1"
+sed awk awk --verbose 2>/dev/null sed done 2>/dev/null printf 'quoted text' export
+		-eu readonly echo sed test awk ${HOME}
+| awk && | done printf
+		sed sed && printf done cd test /usr/bin local
+export $(pwd) printf readonly export "$@" /usr/bin cd ${HOME} export -eu export
+	/usr/bin "$@" test 2>/dev/null awk local export --verbose && then
+	2>/dev/null test | echo "$1" /usr/bin local --verbose export 2>/dev/null
+		${HOME} x=1 printf x=1 awk &&
+	--verbose $(pwd) then /usr/bin awk /usr/bin
+		--verbose grep sed test
+	--verbose local "$1" awk done printf sed -eu sed grep /usr/bin "$@" 'quoted text'
+	/usr/bin ${HOME} /usr/bin readonly 'quoted text'
+	&& /usr/bin echo /usr/bin cd "$@" "$1" echo readonly cd
+		"$1" x=1 printf grep grep sed export local cd awk export "$1" test printf
+	awk /usr/bin 'quoted text' 'quoted text' awk x=1 export
+		local && echo x=1 x=1 grep test test "$1" echo
+	/usr/bin /usr/bin -eu && cd done -eu then 2>/dev/null
+done local printf /usr/bin local export && printf
+		'quoted text' printf $(pwd) /usr/bin 'quoted text'
+		"$@" sed test grep awk 'quoted text' $(pwd)
+		test ${HOME} 2>/dev/null done "$1" --verbose cd grep --verbose then ${HOME}
+sed -eu $(pwd) 'quoted text' x=1 $(pwd) awk $(pwd) local
+--verbose awk && $(pwd) awk grep test done && grep "$1" 2>/dev/null && grep
+${HOME} -eu local ${HOME} && 'quoted text' sed "$1" readonly $(pwd) echo && --verbose
+	| | "$1" | sed then test grep /usr/bin sed "$@"
+	$(pwd) /usr/bin --verbose awk printf "$1" awk then done x=1 /usr/bin x=1
+		export ${HOME} 2>/dev/null export readonly grep echo export 2>/dev/null
+	sed "$1" ${HOME} 2>/dev/null
+	grep awk 'quoted text' | ${HOME} ${HOME} printf local --verbose
+readonly printf cd then then && local 'quoted text' && awk
+| --verbose grep "$1" local 'quoted text'
+echo 2>/dev/null printf echo 'quoted text' printf test ${HOME}
+awk --verbose && /usr/bin printf cd readonly cd
+awk echo sed /usr/bin local "$1" && 'quoted text'
+		$(pwd) | "$1" printf test
+	printf --verbose $(pwd) "$1" 2>/dev/null printf test sed 'quoted text' readonly
+		&& local grep "$@" 2>/dev/null
+	${HOME} grep /usr/bin "$1" ${HOME} readonly
+	printf export --verbose "$1" readonly readonly
+		$(pwd) printf sed sed local --verbose cd local 2>/dev/null $(pwd)
+		$(pwd) readonly ${HOME} readonly "$@" export cd "$1" then
+	${HOME} then cd /usr/bin | local 2>/dev/null
+	cd sed -eu sed awk --verbose grep done -eu grep echo export "$1" printf then
+-eu export "$@" export "$1" readonly echo readonly awk cd export then
+		"$@" ${HOME} export printf 2>/dev/null | done | local
+		grep grep grep ${HOME} $(pwd) --verbose awk test test grep ${HOME}
+	export export "$1" grep grep sed --verbose
+		cd cd local export grep readonly printf awk 2>/dev/null
+		grep /usr/bin readonly | export echo printf -eu
+printf && awk && "$@" export local
+	"$@" awk --verbose --verbose -eu $(pwd) export x=1
+&& cd /usr/bin && 2>/dev/null
+		then --verbose "$@" awk "$1" /usr/bin --verbose x=1 then x=1 echo | $(pwd)
+$(pwd) readonly awk export "$1"
+readonly ${HOME} "$@" | 'quoted text' --verbose test /usr/bin
+test 2>/dev/null | -eu printf
+readonly x=1 readonly cd
+		cd $(pwd) "$1" readonly -eu awk | | 2>/dev/null
+	$(pwd) | awk sed 'quoted text'
+2>/dev/null --verbose /usr/bin "$1"
+"$1" then $(pwd) awk 2>/dev/null -eu /usr/bin /usr/bin
+2>/dev/null x=1 local 2>/dev/null then
+	--verbose done cd export $(pwd) awk
+		--verbose $(pwd) | "$@" --verbose "$@" && printf done awk /usr/bin
+2>/dev/null local "$@" "$1" export x=1 -eu && readonly ${HOME} $(pwd) sed
+/usr/bin 2>/dev/null echo export then cd 'quoted text' x=1 | readonly $(pwd)
+	test export then "$@" cd $(pwd) "$1" "$1" $(pwd) -eu x=1 -eu cd readonly 'quoted text'
+	readonly ${HOME} export local export grep -eu
+		&& printf x=1 readonly /usr/bin echo cd /usr/bin x=1 "$1" 'quoted text'
+	sed 'quoted text' x=1 printf test local "$@" export test --verbose readonly
+	"$1" /usr/bin then $(pwd) --verbose then sed --verbose printf
+	echo --verbose "$1" "$1" --verbose $(pwd) done 'quoted text' /usr/bin
+		awk "$1" done cd ${HOME} cd done printf 'quoted text' && sed local "$@"
+		x=1 -eu then ${HOME} local
+		x=1 --verbose sed | readonly
+	'quoted text' x=1 grep 2>/dev/null local export export
+		grep -eu echo 2>/dev/null awk
+		readonly export awk x=1 readonly -eu local done awk && echo export test printf
+		"$1" ${HOME} printf sed export printf x=1
+	awk -eu x=1 /usr/bin then grep local sed $(pwd) $(pwd) -eu grep
+	-eu sed 2>/dev/null export x=1 --verbose 'quoted text' local sed awk 'quoted text'
+	readonly "$@" -eu export echo then
+test ${HOME} grep /usr/bin awk -eu &&
+		/usr/bin printf printf "$1" 'quoted text' 2>/dev/null
+	echo export then then export done
+local | && "$1" "$@" --verbose
+	--verbose 'quoted text' | | "$1" test "$1" "$@"
+x=1 x=1 test $(pwd) --verbose "$@" | echo then sed "$@"
+		awk 2>/dev/null grep "$1" grep
+awk /usr/bin echo local x=1 echo ${HOME} sed
+export && $(pwd) echo awk /usr/bin
+		x=1 local local 2>/dev/null sed grep && then grep test /usr/bin
+	then /usr/bin 'quoted text' ${HOME}
+	| /usr/bin sed /usr/bin -eu local echo printf | "$1" done "$@" done 'quoted text'
+| cd local grep "$@" 2>/dev/null
+		-eu done -eu cd done export printf cd export --verbose
+		"$@" printf cd 2>/dev/null 'quoted text'
+		--verbose ${HOME} x=1 "$@" -eu
+readonly && 'quoted text' local awk printf done then printf awk 2>/dev/null
+--verbose "$1" cd export x=1 awk export
+	--verbose && | 'quoted text'
+printf ${HOME} grep test "$1" $(pwd) sed local sed -eu ${HOME} | -eu 2>/dev/null
+printf 'quoted text' "$1" ${HOME} echo awk then grep -eu printf --verbose
+	${HOME} local sed test 2>/dev/null local test "$@" grep done
+		then echo -eu cd readonly "$@" test local x=1
+	${HOME} "$@" done local /usr/bin ${HOME} "$@" "$@" | 2>/dev/null
+	--verbose awk cd sed ${HOME} sed readonly && echo
+echo readonly 'quoted text' && x=1 grep $(pwd) echo && -eu ${HOME}
+		--verbose test "$@" x=1 grep test --verbose done grep $(pwd)
+	2>/dev/null "$@" export 2>/dev/null done 2>/dev/null local local ${HOME}
+	readonly cd --verbose /usr/bin then --verbose then 2>/dev/null printf | /usr/bin
+"$@" local sed ${HOME} cd cd export "$1" readonly local --verbose
+		${HOME} export -eu &&
+	/usr/bin ${HOME} 'quoted text'
+echo readonly test | then 'quoted text'
+	awk export sed && /usr/bin "$@"
+	$(pwd) export test readonly
+	echo ${HOME} export &&
+done $(pwd) export test export ${HOME} local sed --verbose cd test | done
+		grep sed "$@" local echo test 'quoted text'
+readonly echo cd | test
+"$@" ${HOME} grep "$1" then | done readonly -eu readonly
+printf local cd cd local x=1 grep done x=1 x=1 ${HOME} /usr/bin echo done
+export ${HOME} cd awk grep
+grep export readonly cd ${HOME} $(pwd) "$1" "$1" &&
+		"$1" sed /usr/bin cd 'quoted text' -eu
+${HOME} /usr/bin 2>/dev/null test x=1 --verbose cd x=1 grep awk 'quoted text'
+--verbose --verbose "$1" --verbose readonly /usr/bin grep printf /usr/bin printf
+		x=1 test 2>/dev/null "$@" $(pwd) awk grep awk && cd "$1" cd local
+	x=1 cd cd cd 2>/dev/null && echo -eu -eu grep ${HOME} local cd -eu -eu $(pwd)
+echo test $(pwd) --verbose
+	printf -eu done "$1" $(pwd) cd awk | then
+		${HOME} local then local
+/usr/bin && done then printf echo local then
+	'quoted text' grep $(pwd) grep "$1" awk "$1" printf printf grep printf readonly
+${HOME} --verbose then export
+		export export printf local "$1"
+		then && 2>/dev/null 'quoted text' done
+	awk | ${HOME} --verbose readonly test cd && --verbose
+then | local /usr/bin -eu 2>/dev/null printf done 'quoted text' |
+	then readonly --verbose
+	$(pwd) export local x=1 cd 2>/dev/null x=1 && 'quoted text'
+	grep 'quoted text' -eu sed && readonly --verbose then ${HOME} | $(pwd) | x=1
+&& sed test "$1" awk printf | echo sed 2>/dev/null ${HOME}
+test echo local export "$@" done 2>/dev/null printf "$1"
+--verbose $(pwd) local then
+		readonly /usr/bin | "$@" /usr/bin local $(pwd)
+		"$1" && cd done x=1 | ${HOME} && ${HOME} "$@" ${HOME}
+	local test readonly 'quoted text' done /usr/bin test
+done then local cd $(pwd) /usr/bin test then 2>/dev/null
+		local "$@" test done "$@" awk printf sed | grep
+		local x=1 2>/dev/null /usr/bin grep grep 2>/dev/null -eu grep "$@" --verbose
+		local done printf awk "$@" $(pwd)
+	sed local ${HOME} sed printf cd 2>/dev/null 'quoted text' echo then done $(pwd)
+		&& 'quoted text' --verbose
+	--verbose export echo done
+	readonly local echo "$@" then ${HOME} printf $(pwd) awk /usr/bin done
+	sed readonly "$1" grep | /usr/bin done "$1" /usr/bin $(pwd)
+	"$@" readonly x=1 sed test done test "$1" x=1 cd
+		export readonly cd -eu ${HOME} 'quoted text'
+		-eu local && export cd export
+		export awk "$@" -eu sed awk x=1 printf export | readonly | "$1" awk
+-eu --verbose "$1" test echo --verbose "$1"
+cd awk | awk cd --verbose | awk 'quoted text' /usr/bin readonly grep && sed printf
+	"$1" cd readonly ${HOME} then ${HOME} && | /usr/bin echo readonly 2>/dev/null
+		$(pwd) /usr/bin -eu -eu awk echo && export $(pwd) /usr/bin | x=1 then
+sed ${HOME} export 2>/dev/null done done test echo 2>/dev/null sed 2>/dev/null then
+	echo done "$@" then x=1 readonly | export x=1
+		export echo test --verbose done done readonly
+	--verbose awk --verbose export awk awk | x=1 ${HOME} sed 'quoted text'
+2>/dev/null | && echo sed && cd printf awk readonly
+echo --verbose --verbose --verbose sed cd /usr/bin then test "$@" $(pwd)
+	readonly awk readonly $(pwd) awk local then
+x=1 --verbose $(pwd) cd $(pwd)
+		grep $(pwd) 'quoted text' local
+		sed done echo ${HOME}
+sed sed -eu readonly grep "$@" -eu awk ${HOME} "$1" $(pwd) /usr/bin
+		'quoted text' grep $(pwd) "$@" done grep "$@" readonly --verbose
+echo | test awk -eu echo --verbose --verbose grep /usr/bin -eu sed
+$(pwd) | "$@" readonly local test -eu "$1" 2>/dev/null echo "$@" grep 'quoted text'
+	awk && printf export /usr/bin
+awk 2>/dev/null awk -eu -eu printf
+	2>/dev/null done echo done -eu && readonly echo
+	&& "$1" "$@" 2>/dev/null "$1" local $(pwd) "$@"
+done x=1 grep /usr/bin readonly | | readonly 'quoted text' "$@"
+'quoted text' "$@" 2>/dev/null $(pwd) 2>/dev/null /usr/bin
+	$(pwd) --verbose 'quoted text' /usr/bin x=1 done echo && "$@"
+		$(pwd) grep grep 2>/dev/null done $(pwd) export --verbose
+then cd printf x=1 grep | echo awk echo done cd cd 'quoted text' grep awk "$@"
+| export done awk ${HOME} | -eu --verbose 'quoted text' 'quoted text'
+grep test test export awk x=1 "$@" done test | test 'quoted text'
+	sed $(pwd) && printf cd $(pwd) "$@" sed -eu sed ${HOME}
+		export then sed 'quoted text' done 'quoted text'
+		grep /usr/bin --verbose local | test /usr/bin $(pwd)
+		"$@" then local && printf
+	done -eu 'quoted text' x=1
+&& 2>/dev/null && grep $(pwd) --verbose awk "$@" /usr/bin printf && "$1"
+		printf $(pwd) done test done cd printf "$1" then echo 2>/dev/null
+	-eu awk 'quoted text' 2>/dev/null
+	export cd && cd local 2>/dev/null --verbose local echo test printf
+		then cd | ${HOME} test sed cd echo printf done
+	cd $(pwd) readonly -eu 'quoted text' 2>/dev/null
+printf then 2>/dev/null "$@" awk "$1" --verbose x=1 "$@" done echo
+	| export 'quoted text' -eu
+test 2>/dev/null printf export &&
+	test done export grep --verbose
+	"$@" $(pwd) "$1" "$@" -eu | 2>/dev/null | grep /usr/bin
+		printf printf grep then ${HOME} $(pwd) done | printf 'quoted text' then
+	/usr/bin "$1" | && export sed readonly done local 2>/dev/null
+		-eu --verbose /usr/bin
+'quoted text' --verbose 'quoted text' ${HOME} --verbose | "$@"
+		&& awk 2>/dev/null "$@" | local
+	readonly sed /usr/bin 2>/dev/null echo export
+local grep readonly grep awk x=1 /usr/bin test
+		"$@" 2>/dev/null 'quoted text' printf "$1" -eu readonly
+	local --verbose /usr/bin printf grep /usr/bin
+	/usr/bin done | -eu local
+		"$@" local readonly 2>/dev/null echo test 'quoted text' -eu 2>/dev/null && test
+		'quoted text' --verbose
+		echo local then grep done
+		sed "$@" "$@" test awk --verbose
+	${HOME} -eu ${HOME} | -eu printf | "$@" awk cd "$@" sed local | local grep
+		/usr/bin export x=1 awk $(pwd) cd ${HOME} 2>/dev/null readonly 2>/dev/null
+	sed printf readonly export
+readonly cd "$@" -eu -eu
+		awk "$@" then 2>/dev/null "$@" done 2>/dev/null
+&& 'quoted text' local readonly echo export cd
+sed grep echo x=1 local -eu export "$@" echo test "$1" /usr/bin --verbose &&
+		printf awk 2>/dev/null grep sed x=1 sed ${HOME} --verbose then sed 2>/dev/null
+		x=1 "$@" awk readonly sed awk test && "$@"
+		cd echo x=1 "$1" cd readonly | local sed "$1" "$@" sed echo
+		&& 2>/dev/null local --verbose ${HOME} export
+		readonly cd sed export printf "$@" /usr/bin grep -eu "$@" --verbose -eu grep
+	--verbose readonly /usr/bin sed
+		/usr/bin --verbose cd 2>/dev/null local test "$1" && grep export local
+"$@" done "$@" export cd grep export && | --verbose && awk grep
+	grep done done export grep --verbose
+	| x=1 2>/dev/null "$@" /usr/bin
+then $(pwd) done cd sed x=1 $(pwd) echo awk
+	cd awk grep sed && sed sed printf readonly x=1 'quoted text'
+$(pwd) test "$@" | -eu cd echo x=1
+	export done && -eu --verbose "$1" /usr/bin "$@" done local ${HOME} test --verbose
+	done awk sed then --verbose awk export done test sed && 'quoted text' done cd
+done sed /usr/bin 'quoted text' x=1 sed $(pwd) sed ${HOME}
+awk then then local grep awk ${HOME} awk grep ${HOME} "$@"
+	test -eu export sed awk local export grep awk
+	x=1 && grep then /usr/bin /usr/bin $(pwd) grep sed test readonly
+	"$@" "$@" test $(pwd) 2>/dev/null "$@" done awk
+		printf "$1" ${HOME} echo 'quoted text'
+		printf then printf --verbose /usr/bin ${HOME} $(pwd) readonly
+then cd then export grep -eu readonly printf
+		grep then 2>/dev/null x=1 done 2>/dev/null
+"$@" echo grep readonly grep "$@" echo --verbose 2>/dev/null printf
+	awk grep /usr/bin | $(pwd) /usr/bin cd printf test x=1 'quoted text' --verbose
+	sed 2>/dev/null 'quoted text' awk cd readonly $(pwd) local grep | awk done ${HOME}
+	local 2>/dev/null 'quoted text' sed ${HOME} ${HOME} local
+		"$1" grep test $(pwd) -eu readonly sed sed "$1" done $(pwd)
+readonly export $(pwd) done -eu cd && then -eu then && echo /usr/bin then x=1
+		$(pwd) 2>/dev/null awk grep readonly
+		| 2>/dev/null then grep export 2>/dev/null cd grep "$@" ${HOME} "$1" 'quoted text'
+		&& export cd ${HOME} $(pwd) "$1" 2>/dev/null export grep echo -eu -eu export "$1"
+	${HOME} done "$1" printf "$@" && && x=1 | echo && $(pwd) | cd $(pwd)
+	echo printf sed | | printf && echo x=1
+"$1" echo 'quoted text' x=1 grep export -eu && done
+cd -eu sed /usr/bin local
+	cd | $(pwd) export && --verbose --verbose ${HOME} then --verbose && 2>/dev/null
+sed local x=1 echo then echo done && cd awk -eu printf "$@" then test export
+	local then cd printf -eu local &&
+| --verbose 'quoted text' sed 'quoted text' ${HOME} | printf 2>/dev/null
+		'quoted text' printf readonly | x=1 --verbose
+&& "$@" echo --verbose --verbose
+then --verbose $(pwd) "$@" grep test export
+	"$@" $(pwd) 'quoted text' x=1 sed test x=1 | "$@" sed "$1" $(pwd) echo then
+test test local "$@" then /usr/bin sed 'quoted text' sed test echo 2>/dev/null "$@"
+	echo "$1" 'quoted text' "$@"
+	awk $(pwd) sed x=1 cd x=1 test && done echo $(pwd)
+	-eu echo ${HOME} done -eu sed "$1" "$@" local done cd echo &&
+	awk --verbose --verbose 2>/dev/null then --verbose
+		| --verbose sed "$1" /usr/bin "$@" then /usr/bin done awk 2>/dev/null
+		2>/dev/null readonly 'quoted text'
+		"$1" 'quoted text' export 'quoted text' echo echo local x=1 -eu
+	'quoted text' $(pwd) /usr/bin done sed test "$1" "$1"
+	cd cd grep "$@" printf done "$1" printf test && sed test -eu
+		grep 2>/dev/null && done --verbose 'quoted text' -eu local
+		x=1 then cd printf test sed test local -eu cd done echo "$1" ${HOME} local
+		"$@" "$@" done | local grep && && && sed $(pwd) grep grep "$@" test
+printf -eu -eu sed cd export
+		&& -eu export "$1" --verbose "$@" awk grep cd cd echo $(pwd)
+sed readonly --verbose | | local x=1 readonly -eu $(pwd) && cd $(pwd) -eu --verbose
+"$1" x=1 && -eu test test awk "$1" ${HOME} && awk sed "$1" test
+		/usr/bin ${HOME} readonly sed readonly readonly
+cd test $(pwd) && test then | sed
+		2>/dev/null -eu export printf | /usr/bin echo "$@" "$1" "$@"
+	x=1 --verbose $(pwd) -eu export echo $(pwd) x=1 awk
+	2>/dev/null grep echo export $(pwd) | sed done
+	done && cd cd awk sed grep ${HOME}
+		readonly awk 'quoted text' "$@" local
+		export awk readonly then echo
+		then -eu 'quoted text' -eu done export 'quoted text'
+	export printf printf x=1 'quoted text' local --verbose --verbose
+		then /usr/bin "$@" $(pwd)
+		--verbose cd export then -eu -eu ${HOME} $(pwd) --verbose x=1 && ${HOME}
+export 2>/dev/null readonly readonly
+		-eu grep test printf local
+--verbose --verbose "$1" then 'quoted text' | "$@" /usr/bin ${HOME} local "$1"
+		printf "$@" cd done printf ${HOME} printf sed 'quoted text' test
+'quoted text' local printf export printf
+| | /usr/bin ${HOME} x=1 ${HOME} sed cd test ${HOME} readonly "$1"
+/usr/bin export sed done export export
+		$(pwd) && | 'quoted text' sed "$1" then sed echo
+then echo test cd 2>/dev/null echo printf printf
+		then ${HOME} x=1 x=1 "$1" local cd done awk
+		'quoted text' sed awk cd readonly grep && test $(pwd) printf readonly local test
+	export printf x=1 "$@" 2>/dev/null grep ${HOME} done --verbose && readonly
+	2>/dev/null echo | | x=1 then awk 2>/dev/null sed "$@" echo awk printf -eu
+	-eu local done x=1 ${HOME} done -eu |
+	/usr/bin && test awk ${HOME} --verbose "$1" awk 'quoted text' grep
+		x=1 && grep sed cd cd sed 'quoted text'
+	test echo | local | grep export x=1 echo &&
+-eu 2>/dev/null x=1 && then && grep
+	then readonly ${HOME} sed readonly --verbose echo test /usr/bin --verbose awk "$@"
+printf grep --verbose export grep export && 'quoted text'
+		then /usr/bin 'quoted text' ${HOME} && 2>/dev/null "$1" $(pwd) x=1 awk
+	done | "$1" --verbose sed export grep sed readonly printf 2>/dev/null
+	"$1" cd x=1 "$@" export awk "$@" -eu | printf printf awk sed echo readonly
+		x=1 'quoted text' then | 2>/dev/null sed x=1
+/usr/bin --verbose printf test then readonly ${HOME} $(pwd) then -eu export export
+		"$@" /usr/bin x=1 x=1 ${HOME} && 'quoted text' awk && -eu 2>/dev/null
+		then cd "$@" 2>/dev/null "$1"
+	${HOME} 2>/dev/null test --verbose --verbose
+	"$@" local done /usr/bin "$@" /usr/bin
+		/usr/bin x=1 $(pwd) /usr/bin export x=1 then 2>/dev/null local "$@"
+	grep sed $(pwd) cd 2>/dev/null local /usr/bin export
+	echo awk then local x=1 -eu readonly x=1
+		| readonly -eu && echo done x=1
+	&& "$@" x=1 | -eu 'quoted text' export printf $(pwd) printf
+	--verbose -eu echo done $(pwd) test cd 'quoted text'
+		test readonly "$@" x=1 && printf "$1"
+		/usr/bin printf -eu | printf 2>/dev/null x=1 -eu
+		2>/dev/null readonly cd readonly
+		done readonly 2>/dev/null local echo cd sed "$1" --verbose | local "$1" &&
+echo grep done awk test done "$@" && cd done local |
+test 'quoted text' ${HOME} done
+x=1 | printf export test -eu echo test then done x=1 'quoted text' awk
+		echo echo sed then awk "$1" $(pwd) 2>/dev/null
+		/usr/bin --verbose "$1" -eu cd awk test grep 2>/dev/null -eu
+		${HOME} "$@" ${HOME} -eu && test "$1"
+	x=1 x=1 'quoted text' 2>/dev/null
+/usr/bin cd printf 2>/dev/null 'quoted text' done sed /usr/bin && /usr/bin
+		awk | export "$1" -eu then "$1" readonly printf 2>/dev/null 2>/dev/null
+	sed cd export /usr/bin awk local "$1"
+	done x=1 ${HOME} /usr/bin "$1" then cd ${HOME} test
+grep cd 'quoted text' | local echo done
+		2>/dev/null sed export ${HOME} cd x=1 /usr/bin local
+	done cd grep awk export test | sed ${HOME} export x=1 x=1 -eu x=1 'quoted text'
+	| ${HOME} awk test test readonly sed -eu /usr/bin then /usr/bin &&
+		'quoted text' --verbose export --verbose printf x=1 grep --verbose local printf
+local echo printf -eu && ${HOME} 'quoted text'
+	sed "$1" -eu then printf $(pwd) sed printf printf
+	$(pwd) x=1 test readonly $(pwd) local | echo echo export grep echo
+		--verbose cd test /usr/bin printf then then cd | printf --verbose
+printf "$@" awk "$1" ${HOME} $(pwd) sed "$@" /usr/bin then | -eu 2>/dev/null
+	awk --verbose test "$1" /usr/bin 'quoted text' export cd test
+	done "$1" echo -eu grep sed done x=1 export readonly
+	echo printf && export -eu awk /usr/bin cd cd test test done ${HOME} --verbose echo
+	echo | --verbose 'quoted text' && sed && local --verbose /usr/bin | | 'quoted text'
+readonly grep 'quoted text' | && echo then export cd ${HOME} done
+	${HOME} readonly /usr/bin readonly 'quoted text' export
+then "$1" | grep $(pwd) ${HOME} "$@" ${HOME}
+grep "$@" && readonly /usr/bin printf echo awk echo export "$1"
+	--verbose 2>/dev/null "$@" export x=1 then done --verbose "$1" --verbose readonly
+	grep export /usr/bin sed sed
+	--verbose 2>/dev/null local --verbose /usr/bin local awk export export --verbose
+then 2>/dev/null readonly 2>/dev/null
+		awk then "$@" x=1 'quoted text' 2>/dev/null "$@"
+	then && grep && cd grep 2>/dev/null grep "$1" sed awk 2>/dev/null -eu
+	export "$@" && 2>/dev/null export -eu "$1" awk done printf readonly
+	'quoted text' "$@" then local grep then
+then done test /usr/bin sed /usr/bin && --verbose sed x=1
+	-eu printf local done | x=1 sed cd /usr/bin --verbose $(pwd)
+	$(pwd) test "$@" "$@" "$@" && "$1" then "$@" "$@" 2>/dev/null
+&& echo 2>/dev/null echo "$@" ${HOME} 2>/dev/null
+	then cd | readonly -eu done 2>/dev/null "$@" awk
+	sed readonly local test --verbose export | /usr/bin readonly $(pwd)
+${HOME} -eu readonly sed done printf printf sed | echo -eu cd awk "$@" -eu &&
+	done | sed readonly sed | printf
+	test local && test then cd grep /usr/bin "$@" then -eu x=1 readonly && readonly
+&& export then -eu readonly echo local test
+	--verbose ${HOME} "$@" | awk done sed "$1" export readonly local
+	then awk "$@" local export --verbose grep
+	x=1 export awk x=1 echo cd ${HOME} $(pwd) /usr/bin && --verbose local &&
+		$(pwd) printf ${HOME} "$1" test ${HOME} local cd /usr/bin readonly then test local
+		/usr/bin readonly | test grep echo sed
+--verbose grep awk sed | -eu export then /usr/bin
+	'quoted text' "$@" | test $(pwd) 2>/dev/null grep 'quoted text'
+test "$1" --verbose $(pwd)
+	readonly readonly "$1" local x=1 'quoted text'
+	| /usr/bin 2>/dev/null test && echo done test 'quoted text'
+done /usr/bin $(pwd) "$1" ${HOME}
+	/usr/bin readonly grep awk local test ${HOME} local 2>/dev/null
+	${HOME} ${HOME} -eu && cd readonly then then
+	done readonly export x=1 /usr/bin
+		printf then "$@" x=1 2>/dev/null | local /usr/bin -eu local
+	${HOME} x=1 'quoted text' awk $(pwd) --verbose "$1" done echo /usr/bin "$1" then
+/usr/bin 'quoted text' | "$1"
+	readonly echo /usr/bin && -eu local | -eu 2>/dev/null x=1 $(pwd) then
+	awk awk awk done awk local && "$1" | printf
+${HOME} /usr/bin x=1 x=1
+grep awk printf /usr/bin 'quoted text' 2>/dev/null
+readonly "$@" readonly /usr/bin
+		printf awk printf $(pwd) grep /usr/bin ${HOME}
+		${HOME} local | | "$1" --verbose test then && grep done "$@" export
+"$1" x=1 ${HOME} test grep --verbose done
+		'quoted text' readonly --verbose
+export -eu grep | sed grep x=1 then
+		/usr/bin printf --verbose export | echo -eu -eu
+	readonly $(pwd) grep 2>/dev/null done
+awk 2>/dev/null ${HOME} cd $(pwd) -eu 'quoted text'
+		sed ${HOME} "$1" local cd sed
+		done 2>/dev/null grep "$1" --verbose "$@" done ${HOME} test &&
+	awk && grep cd | $(pwd) done && export echo -eu readonly then "$1" 'quoted text'
+		test && /usr/bin echo -eu "$@" local
+		x=1 done printf done local 'quoted text' export $(pwd) sed local $(pwd)
+		export "$1" cd cd sed -eu local echo "$@"
+2>/dev/null x=1 "$@" cd export "$1" "$@" 2>/dev/null
+	/usr/bin ${HOME} -eu cd readonly $(pwd) test printf x=1 'quoted text' awk
+	awk done ${HOME} grep awk then grep
+		"$1" 'quoted text' done -eu 2>/dev/null local "$1"
+	| grep sed echo local x=1 ${HOME} done echo ${HOME} &&
+2>/dev/null local $(pwd) /usr/bin cd $(pwd) /usr/bin 'quoted text' awk
+'quoted text' readonly
+2>/dev/null --verbose --verbose ${HOME} echo ${HOME} readonly | cd
+"$1" printf then echo then local "$@" then grep done -eu x=1
+	done grep printf test local awk local awk done "$1" | 'quoted text'
+done readonly /usr/bin printf printf x=1 done cd awk cd 2>/dev/null && sed
+	sed printf "$1" && 'quoted text' && -eu --verbose readonly && &&
+	/usr/bin echo readonly 2>/dev/null
+"$1" awk then -eu sed local test
+export && 2>/dev/null done printf grep "$@" awk test "$@" test
+printf x=1 sed sed readonly echo then grep x=1 --verbose
+		readonly grep grep | && sed 2>/dev/null export then "$@" echo /usr/bin /usr/bin
+	| readonly /usr/bin -eu -eu
+	awk "$@" printf && sed local /usr/bin
+		&& printf 2>/dev/null export --verbose 'quoted text' x=1 2>/dev/null test --verbose
+		x=1 cd 2>/dev/null $(pwd) "$1" readonly 2>/dev/null "$1" -eu printf grep echo 2>/dev/null
+2>/dev/null readonly local test
+	--verbose done "$@" test then echo cd sed | printf | export
+		/usr/bin "$1" x=1 local /usr/bin
+	done 'quoted text' cd 2>/dev/null /usr/bin 'quoted text' "$1" ${HOME} 2>/dev/null
+cd done "$@" "$@" export awk $(pwd) -eu
+then cd x=1 ${HOME} -eu then /usr/bin local --verbose $(pwd) "$1"
+	sed cd sed "$@" readonly echo local then $(pwd) x=1 awk test "$@" ${HOME} export
+	export local done 'quoted text' sed done printf --verbose
+local --verbose cd grep test cd --verbose
+	${HOME} then cd cd then grep echo && awk grep --verbose export done
+	"$1" readonly readonly 2>/dev/null then
+	readonly /usr/bin -eu $(pwd)
+echo | x=1 'quoted text' done awk printf x=1 done --verbose awk x=1
+		${HOME} sed 'quoted text' $(pwd) sed -eu echo --verbose
+		$(pwd) done export | "$1" cd /usr/bin export 2>/dev/null done echo
+	'quoted text' 2>/dev/null sed done "$1" ${HOME} grep --verbose
+"$1" && x=1 then export && export
+	/usr/bin local | sed -eu cd "$1" sed $(pwd) x=1 2>/dev/null
+		local $(pwd) test done grep
+	readonly --verbose local $(pwd) --verbose export | echo
+awk cd $(pwd) && echo x=1 test
+cd done /usr/bin "$1" test
+		$(pwd) awk grep x=1 "$1" done 'quoted text' echo /usr/bin
+	sed 'quoted text' ${HOME} -eu test printf
+$(pwd) | /usr/bin awk | export then
+-eu local /usr/bin echo cd | | awk printf
+export --verbose -eu 2>/dev/null
+	$(pwd) echo ${HOME} | cd && awk awk && x=1 echo then -eu "$1"
+awk 2>/dev/null /usr/bin
+		$(pwd) cd 2>/dev/null export /usr/bin
+	echo test x=1 printf sed "$@" export -eu "$1" test
+--verbose done "$@" 'quoted text' -eu $(pwd) readonly
+readonly && echo x=1 -eu test && "$1" grep -eu sed && 2>/dev/null
+cd printf echo /usr/bin readonly "$@"
+export ${HOME} local sed /usr/bin -eu awk cd
+	readonly --verbose cd x=1 2>/dev/null
+		sed /usr/bin --verbose /usr/bin cd grep sed "$1" sed "$1" local then $(pwd)
+		/usr/bin cd "$1" grep 2>/dev/null /usr/bin
+		-eu cd then --verbose /usr/bin $(pwd) printf -eu /usr/bin "$1" local
+		test && export | "$@" cd sed sed "$@" | -eu $(pwd) echo readonly
+	2>/dev/null | cd -eu local | echo cd | grep ${HOME} x=1 ${HOME} && $(pwd) grep
+	"$@" 2>/dev/null --verbose && sed | printf && x=1 done 'quoted text'
+grep "$1" cd echo 'quoted text' export cd done test "$1" then
+		sed 'quoted text' echo "$1" ${HOME} grep "$1" grep
+export "$@" export sed grep ${HOME}
+--verbose x=1 -eu grep sed
+		--verbose test then awk 'quoted text' cd
+		-eu $(pwd) | test x=1 local test export awk local local -eu
+		printf /usr/bin readonly
+grep && x=1 /usr/bin
+	done && printf "$@" && 'quoted text' export 2>/dev/null 2>/dev/null sed
+then grep then sed --verbose "$@" -eu cd
+"$@" | && then "$1" awk grep
+		"$1" then && -eu done cd cd test 2>/dev/null -eu x=1 local awk "$1" --verbose
+		test printf done grep then x=1 "$@" $(pwd) "$1" cd grep 2>/dev/null
+	| local /usr/bin /usr/bin echo
+	$(pwd) "$@" awk sed 2>/dev/null cd ${HOME} local &&
+local && local done "$1" readonly 'quoted text' 'quoted text' printf ${HOME}
+	2>/dev/null $(pwd) 2>/dev/null && ${HOME} export $(pwd)
+	sed test done grep 2>/dev/null
+		then 2>/dev/null ${HOME} -eu test
+	sed sed sed done "$@" && sed printf $(pwd) done sed grep x=1 then local
+	&& -eu 2>/dev/null x=1 2>/dev/null readonly printf sed sed | 'quoted text'
+--verbose ${HOME} readonly
+	"$@" printf -eu -eu then "$1" awk && 'quoted text' readonly
+	$(pwd) && /usr/bin printf "$@" && x=1 sed 2>/dev/null
+		--verbose echo done test -eu "$1"
+		$(pwd) printf "$@" | ${HOME} printf ${HOME} local
+test cd test --verbose awk ${HOME} test ${HOME} "$1" -eu grep | test cd local printf
+		| readonly export "$@" 2>/dev/null x=1 then local awk -eu cd readonly 2>/dev/null
+		"$1" ${HOME} readonly local export $(pwd)
+		"$@" readonly echo printf test --verbose "$1" echo
+"$@" --verbose 2>/dev/null && 2>/dev/null
+printf -eu printf readonly done done x=1 awk 2>/dev/null "$1"
+2>/dev/null 2>/dev/null 'quoted text' cd &&
+		2>/dev/null awk readonly grep -eu "$1" /usr/bin cd x=1 $(pwd)
+		&& 2>/dev/null $(pwd) test awk cd $(pwd) -eu then then then "$@" 2>/dev/null
+	local sed | x=1 export "$1" -eu -eu "$1" echo 'quoted text'
+		--verbose readonly 'quoted text' echo -eu readonly local --verbose &&
+| test && awk "$@" local readonly 'quoted text' --verbose
+		sed 'quoted text' --verbose x=1 test done -eu awk && local local -eu export
+then x=1 awk -eu | "$1" /usr/bin -eu --verbose then -eu "$1" | 2>/dev/null
+x=1 "$@" 2>/dev/null "$@"
+readonly x=1 export awk --verbose test export printf "$1" && $(pwd)
+&& then | test "$1" x=1 -eu local test
+		echo done | | 'quoted text' x=1 --verbose
+		"$1" awk awk echo 'quoted text' 'quoted text'
+x=1 done sed 2>/dev/null "$1" && | export local export $(pwd)
+"$1" | cd test 'quoted text' && "$@" "$@"
+		2>/dev/null "$@" 2>/dev/null 'quoted text' awk awk
+	export then sed printf --verbose ${HOME} export local grep /usr/bin
+local readonly | 2>/dev/null "$@"
+cd then ${HOME} "$@" && export awk done readonly awk done then "$@" &&
+local /usr/bin echo x=1 /usr/bin x=1 'quoted text' | readonly grep
+&& --verbose "$@" -eu -eu x=1 "$1" 'quoted text'
+		test echo /usr/bin echo 2>/dev/null $(pwd) ${HOME}
+then | echo && 'quoted text' -eu x=1 awk local $(pwd) echo export x=1 printf
+	cd awk /usr/bin ${HOME} -eu "$1" test -eu -eu sed
+	| $(pwd) test "$1" then 'quoted text' then
+x=1 readonly --verbose cd local awk awk printf done sed ${HOME} 2>/dev/null printf
+printf cd export --verbose export done grep echo
+	readonly /usr/bin /usr/bin readonly export $(pwd) x=1 "$1" "$1" awk
+	| 'quoted text' sed echo /usr/bin /usr/bin printf
+		'quoted text' x=1 "$@" /usr/bin printf grep test 'quoted text' -eu printf
+	sed readonly | sed | 2>/dev/null readonly "$1" --verbose
@@ -0,0 +1,2001 @@
+test sed awk ${HOME} cd x=1 -eu
+printf /usr/bin && sed /usr/bin
+	cd "$1" $(pwd) 2>/dev/null && local $(pwd) test sed done | 2>/dev/null
+		x=1 local done grep printf | 2>/dev/null --verbose
+$(pwd) test local "$@" sed sed then readonly "$1" sed 2>/dev/null -eu
+		echo "$1" "$1" -eu echo "$1" local readonly --verbose echo
+	&& then 2>/dev/null printf -eu then "$1"
+"$@" | -eu cd 'quoted text' echo then local grep echo ${HOME} ${HOME} readonly
+		export $(pwd) "$@" x=1 test $(pwd) x=1 test |
+	done done printf 'quoted text' echo 2>/dev/null grep awk echo | $(pwd) sed -eu /usr/bin
+		"$@" done 'quoted text' done "$@" $(pwd) /usr/bin x=1
+		grep ${HOME} "$1" then sed printf 2>/dev/null
+	grep --verbose then cd export | grep
+export 'quoted text' "$1" then sed sed export "$@" 2>/dev/null
+awk then --verbose readonly cd $(pwd) -eu $(pwd) echo "$@"
+		2>/dev/null 2>/dev/null 'quoted text' cd 'quoted text'
+		2>/dev/null ${HOME} /usr/bin echo sed done
+	$(pwd) done "$1" awk && $(pwd) test x=1 |
+		/usr/bin test ${HOME} "$1" then ${HOME} export
+	local x=1 x=1 /usr/bin x=1 done local local 'quoted text' awk local
+		"$@" export printf --verbose 'quoted text' && "$@" test --verbose
+2>/dev/null local echo then /usr/bin done awk 2>/dev/null ${HOME}
+&& x=1 && printf $(pwd) printf grep x=1 x=1 && then $(pwd) awk test local -eu export
+		echo | 2>/dev/null ${HOME} export $(pwd) printf $(pwd)
+		sed test /usr/bin printf $(pwd) 'quoted text' local test local "$1"
+"$@" cd --verbose $(pwd) local "$1"
+	'quoted text' x=1 echo /usr/bin printf
+"$1" then readonly -eu then awk echo $(pwd)
+printf readonly then sed | -eu -eu x=1 2>/dev/null 'quoted text' test && local /usr/bin
+		-eu cd x=1 printf 2>/dev/null
+test --verbose | awk --verbose 2>/dev/null echo local export local
+	$(pwd) "$1" --verbose
+		x=1 -eu sed then export "$@" readonly done local
+'quoted text' -eu --verbose 'quoted text' readonly /usr/bin "$@" grep
+	--verbose test test 2>/dev/null -eu then awk 2>/dev/null -eu export
+	test readonly $(pwd) 2>/dev/null sed 2>/dev/null 'quoted text' cd sed
+		'quoted text' --verbose done ${HOME} echo echo grep then readonly 2>/dev/null
+	echo 2>/dev/null awk cd then -eu
+sed done "$1" export "$@" echo printf "$@" ${HOME}
+printf ${HOME} grep printf 2>/dev/null | export
+-eu cd "$1" "$@" | done && $(pwd) readonly
+		"$1" --verbose && done "$1" done && cd done /usr/bin local ${HOME}
+		test "$@" $(pwd) local then
+	x=1 readonly x=1 | "$@" -eu "$@" done --verbose | 'quoted text' -eu
+	/usr/bin echo grep /usr/bin printf $(pwd) -eu
+	awk cd -eu grep | cd test test "$1" grep readonly --verbose
+		-eu | cd done "$@" 'quoted text'
+		-eu test 'quoted text' x=1 done
+		then grep cd cd printf echo $(pwd) export $(pwd) awk echo
+	test printf --verbose
+export cd "$@" readonly done
+	"$@" grep grep grep awk $(pwd) cd "$1" "$1" done
+'quoted text' export grep "$@" x=1 ${HOME} export readonly cd 'quoted text'
+	"$1" sed 'quoted text' grep "$1"
+grep --verbose /usr/bin x=1
+		readonly echo 2>/dev/null export
+		"$1" "$@" | /usr/bin sed done /usr/bin ${HOME} test | 'quoted text'
+$(pwd) 'quoted text' test -eu | /usr/bin done readonly ${HOME}
+	"$@" && sed done ${HOME} test printf then | 2>/dev/null done ${HOME}
+		/usr/bin "$1" | local 2>/dev/null
+	/usr/bin cd test /usr/bin | printf ${HOME} ${HOME}
+		--verbose && -eu 2>/dev/null
+		x=1 sed local /usr/bin $(pwd) x=1 x=1 done ${HOME}
+		'quoted text' && printf 2>/dev/null readonly
+	/usr/bin cd printf -eu --verbose 'quoted text' --verbose readonly "$@"
+		export --verbose "$1" awk && test ${HOME} "$@" 2>/dev/null done "$@"
+	--verbose awk $(pwd) then 'quoted text'
+	readonly "$@" export /usr/bin && echo export grep then "$1"
+		test export ${HOME} export 2>/dev/null 2>/dev/null readonly export cd
+		2>/dev/null done 2>/dev/null 2>/dev/null grep grep | 2>/dev/null
+		grep /usr/bin test readonly --verbose local
+		local ${HOME} && export sed |
+		'quoted text' $(pwd) export &&
+	sed local 2>/dev/null "$@" $(pwd) local 'quoted text' sed
+x=1 --verbose -eu "$@" x=1 ${HOME} && --verbose then export && local
+	${HOME} grep -eu then x=1 then
+sed -eu /usr/bin done echo test | sed local ${HOME} then ${HOME} 'quoted text'
+	-eu && printf 2>/dev/null "$1" ${HOME} && awk sed -eu
+		"$@" test done readonly 'quoted text'
+	test grep awk /usr/bin awk --verbose cd | "$@" export "$@" test printf 2>/dev/null
+	readonly then 2>/dev/null 'quoted text' local ${HOME} export
+		done test && /usr/bin export x=1 'quoted text'
+		grep then printf "$1" then x=1 $(pwd) echo
+	| "$@" -eu -eu "$@" -eu sed
+		"$1" $(pwd) "$@" "$@" local ${HOME}
+		awk && cd readonly sed /usr/bin 'quoted text' /usr/bin 'quoted text' then
+'quoted text' sed then awk grep -eu -eu echo
+| -eu test --verbose export "$@" ${HOME} local printf
+cd --verbose $(pwd) $(pwd) done local | local export
+	&& cd sed x=1 && export x=1 ${HOME} "$1" done
+'quoted text' sed 'quoted text' done "$1" local --verbose x=1
+	cd -eu /usr/bin "$@" done -eu export x=1 -eu
+	| /usr/bin cd local printf "$1" local $(pwd)
+	test --verbose sed $(pwd) sed printf $(pwd) grep | export 2>/dev/null printf
+		readonly local && readonly cd local $(pwd) "$@" grep then | local "$@"
+	"$@" printf ${HOME} |
+		2>/dev/null export local grep 'quoted text'
+--verbose 'quoted text' "$@" $(pwd) 'quoted text' readonly
+		sed /usr/bin && done sed sed "$@" grep done printf test -eu
+	printf 2>/dev/null -eu then && done done "$@" x=1
+		test echo ${HOME} sed --verbose x=1 export $(pwd) x=1 2>/dev/null
+sed 2>/dev/null local $(pwd) printf
+cd test export | -eu "$1" export | sed then readonly
+		"$1" export then | "$1" "$@" "$@" &&
+"$1" printf | cd 'quoted text' 2>/dev/null local /usr/bin
+	sed | | done $(pwd) readonly done "$1" | "$@" "$@" export /usr/bin
+-eu x=1 readonly -eu done then grep printf "$@" x=1
+	grep awk done $(pwd) "$1" then
+"$@" $(pwd) ${HOME} && "$@" echo sed | grep grep 2>/dev/null --verbose
+grep "$@" echo sed sed done printf printf done $(pwd)
+		'quoted text' 'quoted text' done then readonly local --verbose test
+local "$@" local grep printf
+$(pwd) test --verbose echo $(pwd) export && cd ${HOME}
+-eu grep -eu 'quoted text' x=1 | ${HOME} "$1" echo $(pwd) printf
+		2>/dev/null ${HOME} --verbose local ${HOME} cd 'quoted text'
+test export done test | test cd -eu export echo cd
+export ${HOME} --verbose ${HOME}
+	test $(pwd) --verbose x=1 ${HOME} && echo "$1" | then
+--verbose export --verbose readonly x=1 echo | sed 'quoted text' "$1" &&
+	'quoted text' --verbose readonly printf done
+	done local -eu echo $(pwd) sed printf done
+		2>/dev/null | awk test 2>/dev/null | echo x=1 grep "$@" $(pwd) cd cd
+	printf $(pwd) | test then printf "$@" && "$@" cd grep && "$@" echo grep
+	| "$@" export local readonly -eu printf | 'quoted text'
+		-eu -eu /usr/bin /usr/bin 'quoted text'
+done ${HOME} grep cd echo sed local -eu /usr/bin local cd $(pwd) 2>/dev/null 'quoted text'
+	echo cd test awk 2>/dev/null done sed then grep
+		"$@" | export --verbose && /usr/bin $(pwd) echo test
+-eu cd export cd grep /usr/bin cd done grep /usr/bin
+		test cd printf x=1 echo cd | printf printf &&
+		x=1 cd -eu 2>/dev/null test 2>/dev/null readonly $(pwd) "$1" then "$@" readonly
+2>/dev/null grep grep export $(pwd)
+		test "$@" 2>/dev/null "$1" -eu export | "$@" sed awk --verbose
+	| sed x=1 "$@" | export /usr/bin 'quoted text' "$@" sed printf --verbose
+	--verbose echo export export grep
+	-eu then done printf test "$@" -eu ${HOME} x=1 printf local cd | ${HOME}
+$(pwd) -eu x=1 awk && /usr/bin x=1
+		awk | -eu && echo 2>/dev/null "$1" -eu
+	x=1 cd x=1 cd done 2>/dev/null
+	/usr/bin 2>/dev/null
+		awk echo then && 'quoted text' echo local "$@" | echo
+test ${HOME} done cd -eu
+		echo 2>/dev/null && echo local x=1 echo sed --verbose
+		local x=1 /usr/bin awk readonly done then
+	sed --verbose cd done readonly
+	readonly grep /usr/bin "$@" ${HOME} local /usr/bin sed
+test -eu "$@" export 'quoted text' "$@" "$1" done "$@" -eu printf "$1" /usr/bin
+	awk test "$@" echo "$1" test readonly | $(pwd) cd | /usr/bin readonly ${HOME}
+		cd local cd local && done readonly /usr/bin readonly ${HOME} sed
+2>/dev/null export -eu grep ${HOME} local &&
+${HOME} done awk 'quoted text' ${HOME} ${HOME} -eu echo
+done 2>/dev/null export x=1 | && local | && && && done done /usr/bin /usr/bin
+&& awk grep 'quoted text' $(pwd) local readonly echo 2>/dev/null -eu
+		| 2>/dev/null grep export done --verbose then | test echo grep 2>/dev/null
+		then then 'quoted text' "$@" sed --verbose
+local 'quoted text' "$1" "$1" $(pwd) test 'quoted text'
+		cd readonly ${HOME} printf "$@" 2>/dev/null awk "$1"
+local $(pwd) && test echo awk
+export export echo cd test sed export x=1 "$1" "$1" awk cd
+--verbose 2>/dev/null done 2>/dev/null echo local sed 2>/dev/null $(pwd) sed ${HOME}
+		-eu export 'quoted text' "$1" /usr/bin cd test export --verbose echo
+export awk export && "$@" --verbose readonly
+"$@" --verbose done then test | echo done --verbose $(pwd) echo
+	done awk | "$1" --verbose test /usr/bin $(pwd) 2>/dev/null
+	printf done | grep sed echo /usr/bin done --verbose
+then printf grep -eu ${HOME}
+		x=1 test printf local ${HOME} local export "$1" "$@" sed
+	/usr/bin test printf then $(pwd) grep --verbose
+local "$1" x=1 echo cd sed
+sed 'quoted text' --verbose 2>/dev/null /usr/bin | && grep cd x=1 'quoted text'
+		grep printf /usr/bin then --verbose export echo readonly grep readonly --verbose
+grep $(pwd) done done awk awk cd | printf && $(pwd) export 'quoted text'
+	"$1" --verbose ${HOME} readonly --verbose printf 2>/dev/null
+		'quoted text' echo 2>/dev/null
+test done local cd 'quoted text' awk
+		/usr/bin readonly -eu 'quoted text'
+2>/dev/null "$1" local done | | -eu 2>/dev/null &&
+	x=1 | 'quoted text' echo then ${HOME}
+		sed && && -eu --verbose $(pwd)
+	/usr/bin done export x=1 -eu 'quoted text' awk /usr/bin done "$@" test -eu
+	local x=1 "$1" /usr/bin "$1"
+then -eu cd && "$@" x=1 ${HOME} grep "$@" "$1" done test "$@"
+	cd 'quoted text' 'quoted text'
+		/usr/bin "$1" "$1" test then export readonly cd 2>/dev/null then
+		echo test cd then then -eu /usr/bin grep 2>/dev/null "$1" echo grep grep
+grep printf done --verbose
+		cd local ${HOME} test grep "$1" x=1 x=1 echo export
+	'quoted text' | "$1" cd
+echo "$1" done "$@" cd && printf "$@" --verbose | $(pwd) then 'quoted text'
+${HOME} /usr/bin x=1 cd 2>/dev/null export awk grep 'quoted text' grep readonly
+	test then ${HOME} local 2>/dev/null $(pwd) ${HOME} echo &&
+		export --verbose x=1 done /usr/bin --verbose
+	awk local export /usr/bin "$@" local /usr/bin 2>/dev/null
+	echo 'quoted text' -eu test 'quoted text' ${HOME} --verbose --verbose local
+	grep -eu -eu /usr/bin ${HOME} done "$1" /usr/bin && grep -eu then cd
+readonly "$1" "$@" readonly 2>/dev/null cd | then awk awk grep 2>/dev/null
+	cd 2>/dev/null 'quoted text' echo readonly awk | /usr/bin
+done 2>/dev/null 2>/dev/null 'quoted text'
+'quoted text' /usr/bin x=1 done x=1 && --verbose 2>/dev/null printf echo "$1"
+	test 'quoted text' export awk
+	then awk echo readonly printf && |
+| readonly "$1" echo x=1 | /usr/bin $(pwd) sed && test && cd test
+	| grep echo $(pwd) 2>/dev/null echo
+--verbose 'quoted text' && grep cd | done cd "$1" printf
+	$(pwd) | x=1 done cd && ${HOME} readonly awk grep printf printf
+	'quoted text' test sed export x=1 done
+-eu && --verbose cd sed readonly awk ${HOME} $(pwd)
+	printf export "$1" grep
+		$(pwd) --verbose test 2>/dev/null $(pwd) "$1" local "$1" printf 'quoted text'
+		done local echo done "$@" awk $(pwd) sed -eu cd sed
+-eu -eu done "$@" sed "$@"
+	sed awk && | && | grep done export
+$(pwd) -eu "$1" readonly then local cd sed readonly 'quoted text' &&
+		--verbose cd $(pwd) --verbose sed
+		"$1" cd x=1 x=1 printf "$@" 2>/dev/null cd 'quoted text'
+		-eu sed grep local grep sed printf done grep | "$1" echo sed then readonly
+	done && test test && sed
+$(pwd) 'quoted text' "$@" | $(pwd) | "$1" | cd --verbose done
+		$(pwd) 'quoted text' readonly && sed done "$1" 'quoted text' readonly sed $(pwd)
+		then 'quoted text' echo cd && $(pwd) sed cd export --verbose test export
+&& awk "$@" 2>/dev/null then -eu readonly grep --verbose 2>/dev/null
+"$@" ${HOME} $(pwd) $(pwd) readonly local cd echo /usr/bin
+export awk /usr/bin && 2>/dev/null then 'quoted text'
+	cd sed readonly done grep echo cd awk x=1 x=1 2>/dev/null
+awk -eu export local --verbose echo done awk "$@" echo then cd echo --verbose
+awk 2>/dev/null "$1" x=1 test "$@" printf -eu
+		grep 'quoted text' "$1" | grep /usr/bin "$@"
+		| test readonly test printf
+		"$1" grep test --verbose "$1" local test $(pwd) test export --verbose x=1 awk
+		2>/dev/null done $(pwd) cd
+--verbose && x=1 && ${HOME} local 'quoted text'
+	local | awk 2>/dev/null x=1 "$@" done $(pwd) 2>/dev/null /usr/bin --verbose
+	readonly local echo printf | awk ${HOME}
+/usr/bin x=1 && ${HOME} done echo -eu x=1 readonly sed ${HOME}
+"$@" && test $(pwd) ${HOME} 2>/dev/null $(pwd) 'quoted text'
+	export local awk sed 'quoted text' "$1" x=1 printf 'quoted text' sed
+-eu --verbose echo local test echo awk -eu -eu $(pwd) "$1"
+	echo sed then -eu then test readonly && "$1" -eu /usr/bin
+	awk -eu 'quoted text' /usr/bin test done sed awk "$1"
+		readonly done /usr/bin ${HOME} && awk x=1 'quoted text' done grep readonly
+--verbose echo | $(pwd) -eu done readonly /usr/bin x=1 'quoted text'
+		awk grep awk grep "$@" ${HOME} grep
+	test $(pwd) then /usr/bin ${HOME} /usr/bin cd "$@" --verbose local export
+		"$@" echo && export grep cd done "$1" $(pwd) --verbose
+sed then "$@" 'quoted text'
+done | printf /usr/bin 'quoted text' sed
+	${HOME} "$@" x=1 printf -eu
+		-eu $(pwd) -eu && /usr/bin
+test ${HOME} printf sed && cd echo && 'quoted text' --verbose 2>/dev/null $(pwd)
+test readonly x=1 /usr/bin sed ${HOME} 'quoted text' local
+	export done x=1 readonly ${HOME} --verbose && "$1"
+echo $(pwd) -eu ${HOME} awk then cd --verbose echo &&
+	local | done awk awk /usr/bin local 'quoted text' x=1 then then |
+cd readonly "$1" $(pwd) | awk printf awk 2>/dev/null "$1" grep | export
+	done 'quoted text' local 2>/dev/null /usr/bin x=1 "$1" then 2>/dev/null
+		then ${HOME} cd then $(pwd) "$1" grep ${HOME} && x=1 "$1"
+/usr/bin && 'quoted text' done printf /usr/bin test sed && grep then "$@"
+	"$@" export cd test awk ${HOME} then sed then then "$@" test 2>/dev/null echo
+2>/dev/null done grep /usr/bin done 'quoted text'
+"$1" | /usr/bin cd -eu x=1 -eu x=1 printf "$1" -eu sed readonly export
+"$@" grep awk readonly then -eu grep x=1 | "$1"
+export sed cd "$1" sed -eu local then /usr/bin cd export
+		"$1" 'quoted text' export x=1 /usr/bin
+	-eu --verbose export 2>/dev/null cd "$@" | readonly
+		test "$1" local awk printf ${HOME} /usr/bin | /usr/bin ${HOME} --verbose export
+echo /usr/bin test export --verbose /usr/bin ${HOME} test export x=1 -eu
+	x=1 "$1" grep sed test cd local sed x=1 export awk then sed readonly export
+	printf -eu then --verbose ${HOME} -eu "$@" "$1" printf awk grep
+	| printf && awk grep /usr/bin | ${HOME} /usr/bin $(pwd) grep local local
+		done printf export grep readonly
+		-eu "$1" awk "$1" sed 2>/dev/null sed grep awk "$@"
+		printf cd /usr/bin -eu && printf && cd "$1"
+	done "$@" /usr/bin --verbose "$@" sed -eu sed readonly | cd then
+	$(pwd) grep -eu test sed -eu 2>/dev/null cd && ${HOME} echo cd readonly
+	done x=1 grep sed 'quoted text'
+		'quoted text' && grep --verbose export 2>/dev/null
+	/usr/bin 2>/dev/null "$1" grep 'quoted text' printf
+		local grep && && echo $(pwd) done cd grep x=1 export
+done test done x=1 "$@" test --verbose $(pwd) 'quoted text'
+	printf && then "$@" $(pwd) cd "$@" "$@" done -eu
+		-eu printf /usr/bin test local export grep sed -eu && /usr/bin -eu
+	${HOME} -eu cd 2>/dev/null /usr/bin && test
+	--verbose awk -eu "$1" 'quoted text' x=1 --verbose export echo | grep
+local echo local grep readonly && export
+		awk "$@" cd awk grep export | cd 'quoted text' "$1" && $(pwd) | 'quoted text'
+printf readonly | "$1"
+		cd 'quoted text' 'quoted text' --verbose awk 'quoted text' ${HOME}
+	/usr/bin "$1" | grep x=1 2>/dev/null
+		grep awk | then 'quoted text' printf grep export local 2>/dev/null
+		2>/dev/null -eu x=1 local cd local done printf && grep
+'quoted text' 2>/dev/null "$@" sed | 2>/dev/null $(pwd)
+cd $(pwd) --verbose && -eu export 2>/dev/null && "$@" $(pwd)
+test local cd ${HOME} "$@" 2>/dev/null | 2>/dev/null && cd awk
+		done cd "$@" "$@" printf export export done cd --verbose 2>/dev/null
+	2>/dev/null readonly test 'quoted text' --verbose awk
+echo awk && cd -eu test "$@" $(pwd) ${HOME}
+	'quoted text' --verbose && && export
+		-eu && then sed local ${HOME} test local echo --verbose
+${HOME} /usr/bin "$1" printf test | echo awk test awk cd done --verbose
+	readonly 2>/dev/null readonly test printf local readonly $(pwd) $(pwd) test
+	&& $(pwd) printf local grep grep -eu --verbose done 'quoted text' export
+	"$1" export | printf /usr/bin | ${HOME} grep ${HOME} /usr/bin "$@" "$1"
+	done --verbose grep -eu then sed && grep 2>/dev/null
+	test x=1 /usr/bin sed 'quoted text' export
+	/usr/bin x=1 | test readonly done awk "$1" /usr/bin grep export echo local
+done x=1 -eu awk local sed export cd $(pwd) --verbose export export echo echo
+--verbose 2>/dev/null printf export then cd && sed 'quoted text' grep local
+local echo awk test export 2>/dev/null && /usr/bin | printf x=1 && printf -eu
+		cd -eu "$@" local then then local then
+-eu && | sed grep /usr/bin $(pwd) local | cd "$@" && && test --verbose
+		| echo ${HOME} 2>/dev/null printf --verbose grep | grep && 'quoted text'
+	grep grep sed export awk "$1" awk "$1"
+		done awk export test 'quoted text' && done &&
+done x=1 "$1" sed awk --verbose done
+local $(pwd) | 'quoted text' $(pwd) ${HOME} awk | && then local 'quoted text'
+		"$@" sed then test test "$1" done $(pwd) awk $(pwd) --verbose printf export
+	| done $(pwd) awk readonly ${HOME} | ${HOME} readonly awk /usr/bin
+sed local printf then -eu export "$@" && 2>/dev/null export
+		/usr/bin "$@" x=1 export done
+2>/dev/null 'quoted text' 'quoted text'
+	then "$1" readonly x=1 awk "$1" readonly sed "$@" && sed
+"$1" "$1" grep cd "$@" "$1" /usr/bin "$@" 'quoted text' $(pwd) && 2>/dev/null "$1"
+	grep then printf /usr/bin
+	$(pwd) x=1 && readonly ${HOME} x=1 cd awk
+		| readonly $(pwd) | 'quoted text' printf "$@"
+	done test $(pwd) && sed && 'quoted text' sed 2>/dev/null
+"$1" cd grep "$1" then
+		${HOME} x=1 awk export export && 'quoted text'
+2>/dev/null | awk $(pwd) readonly
+--verbose "$1" $(pwd) printf cd awk done then printf
+	test grep "$@" ${HOME} grep cd "$1" echo grep
+-eu && | $(pwd) echo then $(pwd) -eu 'quoted text'
+		local test export $(pwd) echo readonly "$@" $(pwd) /usr/bin 2>/dev/null
+	echo printf | then test 'quoted text' 'quoted text' cd printf 2>/dev/null
+'quoted text' export grep | printf export grep export done local "$1" local
+	awk grep test awk "$@" local
+	-eu awk sed $(pwd) awk --verbose "$1" $(pwd) echo cd "$@" local
+	x=1 sed | grep readonly
+		export x=1 test done /usr/bin sed 'quoted text'
+	2>/dev/null then | | /usr/bin
+	sed 'quoted text' readonly
+		$(pwd) x=1 printf readonly grep cd then export test ${HOME} --verbose
+	| done cd $(pwd) --verbose then awk awk export local
+	/usr/bin "$@" x=1 cd -eu $(pwd) | ${HOME} $(pwd) sed 2>/dev/null
+	/usr/bin 'quoted text' | awk export && /usr/bin done /usr/bin then printf | done
+awk 2>/dev/null then | /usr/bin echo local
+	cd local | grep | grep "$@" && ${HOME} done 'quoted text' export
+echo ${HOME} printf cd readonly cd local --verbose
+	-eu /usr/bin && local export && then
+		${HOME} 'quoted text' -eu readonly echo
+echo readonly export local --verbose ${HOME}
+		then export 2>/dev/null x=1 done | done export grep
+	grep 'quoted text' && export test export "$1" then | echo
+sed grep --verbose $(pwd) --verbose cd x=1 local /usr/bin printf echo
+		printf x=1 ${HOME} "$@" local | done cd awk readonly
+		"$1" $(pwd) printf -eu grep --verbose | ${HOME} 2>/dev/null
+	x=1 "$1" "$1" $(pwd) ${HOME} $(pwd) printf grep
+	cd --verbose readonly export /usr/bin 2>/dev/null then /usr/bin
+x=1 printf "$@" "$@" echo echo | "$1" echo /usr/bin
+${HOME} 'quoted text' $(pwd) test
+sed 2>/dev/null awk 2>/dev/null cd --verbose local "$@"
+		sed && $(pwd) cd && x=1
+awk x=1 2>/dev/null echo done then
+		'quoted text' printf x=1 | sed printf
+export cd test then "$@" local | grep local "$@" 'quoted text' then grep --verbose
+		cd cd --verbose | grep echo "$1" &&
+--verbose grep then then echo | readonly then
+	/usr/bin "$@" 2>/dev/null 'quoted text'
+sed $(pwd) "$1" echo sed grep cd then && then 2>/dev/null ${HOME}
+		/usr/bin awk cd export printf | "$@"
+	${HOME} echo cd printf | then -eu then "$1" test export ${HOME} --verbose
+${HOME} then then && grep "$1" && | test 2>/dev/null -eu readonly ${HOME}
+		x=1 local echo echo grep done awk cd export then cd 'quoted text' cd x=1 then grep
+	$(pwd) "$1" echo 2>/dev/null grep done
+done 'quoted text' -eu 2>/dev/null readonly x=1 2>/dev/null
+"$1" grep && "$1" --verbose | "$@" readonly awk ${HOME} ${HOME} -eu sed x=1
+then echo sed readonly echo export
+		&& 'quoted text' 'quoted text' local | /usr/bin
+	'quoted text' then echo echo local ${HOME} then echo --verbose
+cd test | && test && echo export /usr/bin awk printf -eu
+		echo 'quoted text' ${HOME} "$1"
+		x=1 && -eu "$1" && ${HOME} done /usr/bin done $(pwd) ${HOME} |
+2>/dev/null awk -eu printf $(pwd) x=1 "$1" local "$@" x=1 "$@" sed
+		done echo local sed 'quoted text' export printf --verbose "$@" 'quoted text'
+	then awk ${HOME} cd "$@" ${HOME} | test | 2>/dev/null echo 'quoted text'
+local done x=1 $(pwd) printf echo then done awk --verbose
+	"$1" 2>/dev/null | then 2>/dev/null grep -eu "$1" --verbose && 2>/dev/null
+sed x=1 "$@" echo cd awk /usr/bin "$@" 2>/dev/null
+printf /usr/bin local printf
+	"$@" done 2>/dev/null printf 'quoted text' x=1 --verbose
+grep awk $(pwd) "$1" 2>/dev/null printf 2>/dev/null
+awk x=1 | "$1" 2>/dev/null -eu local 'quoted text' $(pwd) sed
+		| 2>/dev/null echo test /usr/bin echo
+		local sed && 'quoted text' ${HOME} ${HOME} sed 'quoted text' cd 'quoted text'
+	&& cd "$1" -eu echo x=1
+		then test done test done grep sed "$@"
+	local ${HOME} sed grep sed local "$1" 'quoted text'
+		printf cd /usr/bin | done sed "$@" --verbose 2>/dev/null readonly done
+	test cd && && /usr/bin awk sed cd x=1
+	export $(pwd) awk && "$@" "$@" $(pwd)
+-eu 2>/dev/null done "$1" then /usr/bin x=1 printf local cd export grep | done sed
+2>/dev/null local cd x=1 export
+	'quoted text' && x=1 "$@" -eu /usr/bin 'quoted text' --verbose readonly done grep
+	'quoted text' | awk && printf
+		sed 'quoted text' 2>/dev/null done
+		"$@" local echo 2>/dev/null awk --verbose && export sed sed "$1" $(pwd)
+	| 2>/dev/null then readonly test printf
+	then test x=1 sed awk readonly
+		test --verbose "$@" $(pwd) ${HOME} ${HOME} cd readonly done export
+then "$@" x=1 "$1" grep grep ${HOME} export $(pwd)
+grep -eu x=1 done cd grep cd "$@" grep "$1" $(pwd) cd 'quoted text' export
+x=1 printf grep $(pwd) && 'quoted text' x=1 grep
+		export then readonly &&
+	export readonly local readonly export
+| "$1" x=1 --verbose grep readonly
+	readonly /usr/bin ${HOME} "$@" 'quoted text' 2>/dev/null
+		-eu | done --verbose export test $(pwd) awk $(pwd)
+	grep x=1 awk cd export then grep cd --verbose readonly printf then
+		then awk x=1 -eu printf export "$1" cd "$1" /usr/bin printf
+	printf sed 'quoted text' cd cd /usr/bin printf "$1" --verbose
+echo echo export grep echo ${HOME} done local
+local echo done --verbose grep 2>/dev/null $(pwd) local echo 'quoted text'
+	${HOME} ${HOME} x=1 | echo done sed $(pwd) && && local /usr/bin cd 2>/dev/null
+	$(pwd) $(pwd) sed export 'quoted text' cd x=1 sed -eu printf && /usr/bin
+printf "$1" cd then grep sed grep "$@" echo "$@" ${HOME}
+		--verbose 2>/dev/null 'quoted text' ${HOME} x=1 local
+	x=1 awk /usr/bin cd echo cd export echo readonly sed awk
+		grep printf done test echo $(pwd) then "$1" ${HOME}
+&& echo grep export && 2>/dev/null | /usr/bin
+/usr/bin /usr/bin local 2>/dev/null | local awk awk grep
+	2>/dev/null printf | /usr/bin 'quoted text'
+		/usr/bin 2>/dev/null --verbose printf done -eu grep awk done 'quoted text'
+		"$@" done cd cd grep awk then "$@"
+	printf printf cd ${HOME} ${HOME} sed awk printf printf
+		readonly -eu done cd /usr/bin sed 'quoted text' ${HOME}
+2>/dev/null printf grep awk awk export $(pwd) local cd "$1" -eu -eu
+	awk "$1" $(pwd) echo "$1" -eu
+		"$1" local --verbose -eu && ${HOME} x=1 test $(pwd) sed test ${HOME}
+&& printf then readonly | echo "$1" awk /usr/bin awk "$@" && readonly --verbose
+	then grep then x=1 sed x=1 then "$1" echo ${HOME}
+		cd && local grep awk &&
+	--verbose -eu sed grep grep printf echo local then $(pwd)
+local echo test readonly $(pwd) then then sed && -eu "$@"
+	2>/dev/null && then x=1 export grep grep cd "$1" 'quoted text'
+		--verbose local | --verbose readonly $(pwd) x=1 printf echo done grep "$1" awk echo
+awk test readonly | "$@" 2>/dev/null ${HOME} "$@" $(pwd) printf -eu
+$(pwd) /usr/bin 'quoted text' export
+/usr/bin readonly $(pwd) ${HOME} awk "$@" ${HOME} 2>/dev/null
+		&& --verbose test "$1" done done /usr/bin
+x=1 --verbose sed test local | printf then then export export
+		&& /usr/bin local grep -eu x=1
+	echo awk then printf export 'quoted text' printf
+test cd && 'quoted text'
+"$@" sed then local done $(pwd) ${HOME} awk done | "$1" done --verbose printf
+--verbose readonly /usr/bin x=1 echo 2>/dev/null readonly
+echo test $(pwd) sed --verbose sed x=1
+		2>/dev/null -eu -eu cd 2>/dev/null sed echo -eu "$@" 2>/dev/null
+awk /usr/bin && --verbose 'quoted text' 'quoted text' ${HOME}
+&& $(pwd) 'quoted text' done awk -eu done 'quoted text' $(pwd) local
+	local x=1 export | "$@"
+		"$@" --verbose | grep 'quoted text' sed local sed awk 2>/dev/null ${HOME}
+	2>/dev/null export printf
+	"$1" awk then -eu "$@" then sed then "$@" then
+		$(pwd) sed 2>/dev/null | 2>/dev/null test printf done x=1 then 'quoted text'
+		printf ${HOME} ${HOME} "$1" | cd
+	| /usr/bin echo x=1 "$1" -eu awk then
+		sed then export echo 'quoted text'
+	$(pwd) ${HOME} local --verbose then echo "$1" 2>/dev/null echo
+cd $(pwd) 'quoted text' -eu test readonly test
+		awk "$@" && 'quoted text' -eu then echo | test then readonly printf | $(pwd)
+"$1" $(pwd) $(pwd) done && /usr/bin 2>/dev/null local
+	2>/dev/null | echo printf grep export
+	readonly printf echo | export local
+	local test | then grep && sed readonly echo /usr/bin done 2>/dev/null
+		cd ${HOME} -eu local printf && "$@" printf ${HOME} /usr/bin echo
+	| local cd -eu sed awk $(pwd) | && local echo sed echo readonly x=1 echo ${HOME}
+		x=1 --verbose then echo 2>/dev/null
+printf test $(pwd) done readonly --verbose "$@" cd readonly
+		awk then ${HOME} /usr/bin -eu --verbose
+		sed printf echo ${HOME} grep | cd test $(pwd) export x=1 "$1"
+	export $(pwd) local export && done export cd sed awk && sed
+	export $(pwd) printf done sed
+	| readonly --verbose --verbose
+&& sed $(pwd) done test | printf && awk x=1 2>/dev/null --verbose local /usr/bin
+		echo awk sed printf awk test sed x=1 /usr/bin
+| echo then awk --verbose test x=1 | echo 'quoted text'
+	export --verbose sed "$1" "$@" 'quoted text' ${HOME} done "$1"
+		/usr/bin sed cd && /usr/bin echo then readonly 'quoted text' && cd ${HOME}
+		printf --verbose awk done 2>/dev/null
+2>/dev/null test done awk ${HOME} test -eu test echo 2>/dev/null
+		cd x=1 x=1 "$1" 'quoted text' | then test awk cd --verbose
+		2>/dev/null -eu done then readonly sed /usr/bin | local then awk awk "$1"
+		sed 'quoted text' echo
+		local 'quoted text' cd &&
+grep echo /usr/bin /usr/bin
+		"$1" x=1 export "$1" x=1 'quoted text'
+		done /usr/bin && grep then done echo && |
+		"$1" cd local x=1 test local awk
+test then sed export ${HOME} export awk | then 2>/dev/null
+	awk sed readonly then done awk awk ${HOME} -eu cd
+		$(pwd) local | awk "$1" then -eu /usr/bin -eu "$@" 2>/dev/null && /usr/bin
+	readonly "$@" ${HOME} cd local "$1" x=1 echo export ${HOME} --verbose
+	echo export && x=1 -eu done 2>/dev/null readonly
+x=1 'quoted text' 2>/dev/null echo "$@"
+"$1" local sed export grep printf /usr/bin awk "$@" echo readonly local x=1 "$@"
+	"$@" x=1 awk test echo | $(pwd) test readonly done $(pwd) printf test printf
+		"$1" && /usr/bin && readonly sed sed grep -eu
+echo $(pwd) done | $(pwd) local 'quoted text' readonly ${HOME}
+	&& export $(pwd) done 2>/dev/null
+		printf grep "$@" 2>/dev/null echo 'quoted text' then printf 2>/dev/null
+	test test "$1" -eu cd test && done local | 'quoted text' -eu printf x=1
+		readonly "$@" echo | printf sed grep x=1 readonly && "$@" echo 2>/dev/null
+/usr/bin | && "$1" && echo -eu
+awk "$@" && echo | && $(pwd) "$@" && x=1 "$@" cd export --verbose
+	/usr/bin awk echo 'quoted text' done x=1 export 'quoted text' 'quoted text'
+		| sed 'quoted text' "$1" cd readonly "$@" $(pwd)
+		/usr/bin awk done then echo awk -eu awk /usr/bin readonly
+2>/dev/null | x=1 sed printf then cd then cd 2>/dev/null
+	-eu $(pwd) done done done readonly
+		export --verbose awk "$@" local
+		local then cd then 'quoted text'
+	local -eu "$1" "$@" done echo echo && echo grep 'quoted text' /usr/bin
+	"$1" printf /usr/bin local -eu | then 2>/dev/null
+		--verbose readonly x=1 -eu cd test ${HOME}
+	/usr/bin "$1" then "$@"
+		"$1" "$@" done && $(pwd) echo
+		/usr/bin ${HOME} printf --verbose 'quoted text'
+	then awk test readonly export awk done "$1"
+		/usr/bin printf echo "$@" export done
+		2>/dev/null grep -eu then awk "$1" /usr/bin x=1 | readonly echo 'quoted text'
+	--verbose --verbose sed cd "$1" ${HOME}
+2>/dev/null then | -eu /usr/bin | 'quoted text' "$1" "$1" readonly --verbose
+	grep done sed export export /usr/bin
+	export test -eu $(pwd) done then sed x=1 "$1" && "$1" "$@" export awk
+		export awk ${HOME} "$@" /usr/bin
+	awk readonly 2>/dev/null printf sed local | -eu x=1 x=1 $(pwd) then awk test --verbose
+		&& $(pwd) grep 2>/dev/null $(pwd) local 2>/dev/null ${HOME} grep $(pwd)
+test awk $(pwd) export "$1" then ${HOME}
+		test then 2>/dev/null --verbose "$1" sed printf "$@"
+		'quoted text' --verbose
+'quoted text' "$1" echo "$1" printf -eu /usr/bin then /usr/bin x=1 done
+	test export readonly /usr/bin -eu 2>/dev/null
+		&& 2>/dev/null then printf $(pwd) ${HOME} ${HOME} echo --verbose
+		local /usr/bin sed "$@" "$1"
+	2>/dev/null $(pwd) --verbose test | echo | ${HOME} readonly local then
+| | /usr/bin && -eu then local | "$@" "$@"
+	awk test echo awk --verbose 'quoted text' && -eu readonly | test local "$@"
+	| x=1 'quoted text' x=1
+		"$@" sed awk export ${HOME}
+	${HOME} echo x=1 awk $(pwd) "$1" readonly && grep ${HOME} "$@"
+printf 'quoted text' -eu "$@" "$@" test $(pwd) echo
+${HOME} && ${HOME} $(pwd) cd echo test test "$1" export /usr/bin export
+awk readonly awk --verbose sed awk then
+${HOME} then printf awk
+	2>/dev/null x=1 "$1" printf 2>/dev/null -eu awk && && -eu 'quoted text'
+"$1" /usr/bin x=1 ${HOME} grep ${HOME}
+		then /usr/bin echo && awk local -eu sed | $(pwd) "$1" 'quoted text'
+	done -eu grep ${HOME} readonly "$@" | grep
+		grep export echo awk x=1 then
+		grep 2>/dev/null printf echo sed | awk | ${HOME}
+'quoted text' grep echo | done "$1" ${HOME}
+	2>/dev/null awk export -eu 2>/dev/null local
+		readonly && /usr/bin ${HOME} x=1
+	export 'quoted text' $(pwd)
+		awk sed | grep "$@" test | --verbose awk then ${HOME} --verbose echo local "$1"
+	export $(pwd) done $(pwd) "$@" awk awk readonly "$1" --verbose && done -eu awk
+	export -eu ${HOME} export export $(pwd)
+	readonly awk cd ${HOME} cd grep /usr/bin readonly $(pwd) | "$@"
+		"$@" $(pwd) export echo echo printf printf $(pwd) 'quoted text'
+grep "$@" $(pwd) -eu export
+	x=1 cd x=1 done "$1" local -eu done 2>/dev/null cd 2>/dev/null
+		export -eu readonly done done "$1"
+	-eu grep grep grep "$1" test awk
+		cd x=1 echo --verbose --verbose 'quoted text' 2>/dev/null
+		&& /usr/bin test --verbose test "$1" cd
+	export awk echo local then
+${HOME} -eu done export --verbose readonly then x=1 && grep echo echo awk export
+	test 'quoted text' --verbose "$1" export
+		echo && --verbose printf 'quoted text' printf readonly printf export
+-eu local -eu | | awk echo then "$1" ${HOME} && export /usr/bin local sed | echo
+		sed x=1 sed done -eu cd
+export echo x=1 test 'quoted text' cd sed sed $(pwd) readonly --verbose
+		echo x=1 "$1" export "$1" printf readonly echo $(pwd) "$1" export
+		sed test echo && /usr/bin --verbose then done echo readonly cd 2>/dev/null
+	2>/dev/null 'quoted text' /usr/bin "$1" awk
+		'quoted text' echo then | local grep --verbose grep local "$@" | $(pwd) -eu
+		cd awk printf x=1 --verbose "$1" readonly $(pwd)
+		2>/dev/null $(pwd) -eu "$@" sed grep | local && export ${HOME}
+	'quoted text' then | readonly | 2>/dev/null
+	grep echo "$1" /usr/bin $(pwd) x=1 | done export -eu cd sed done 'quoted text'
+"$1" grep readonly 'quoted text'
+		--verbose then awk then "$1" done x=1 | awk "$1" then awk $(pwd) ${HOME} "$@" "$1"
+		awk awk then --verbose cd | readonly local
+		| grep printf && -eu ${HOME} && --verbose x=1 sed /usr/bin test $(pwd) 2>/dev/null
+-eu readonly readonly then grep $(pwd) /usr/bin sed
+then test 2>/dev/null local sed 2>/dev/null sed cd && cd "$1" --verbose
+		--verbose "$@" | echo /usr/bin $(pwd)
+2>/dev/null --verbose && awk -eu cd cd export
+	'quoted text' grep local "$@" done ${HOME} test echo "$@" "$@" 'quoted text'
+done test printf x=1 $(pwd) "$1" done grep | 'quoted text'
+	$(pwd) test 'quoted text' -eu ${HOME} done sed 'quoted text' cd local 'quoted text'
+-eu readonly sed then done test printf sed /usr/bin x=1 ${HOME} x=1 sed $(pwd)
+		done 2>/dev/null readonly grep 'quoted text'
+		local -eu --verbose && -eu test test /usr/bin done "$1" --verbose
+		done test cd test -eu "$1" printf -eu done 'quoted text' grep | grep sed 'quoted text'
+		grep -eu done 2>/dev/null then local "$1" readonly 2>/dev/null
+local cd echo 'quoted text' "$@" local
+	awk 'quoted text' && "$@" done printf
+/usr/bin | local then /usr/bin ${HOME} "$1"
+	'quoted text' grep && readonly ${HOME}
+	done printf 'quoted text' 2>/dev/null
+	2>/dev/null $(pwd) 2>/dev/null "$@" echo ${HOME} x=1 sed
+		"$1" -eu x=1 awk cd x=1 then 2>/dev/null done 'quoted text'
+		$(pwd) --verbose ${HOME} -eu cd local
+		"$1" x=1 export "$1" 'quoted text' ${HOME} "$1" done -eu $(pwd) "$1" local x=1
+local "$@" --verbose && sed awk && then --verbose grep grep
+	then -eu sed done then sed local awk x=1 export echo 'quoted text'
+awk readonly readonly 2>/dev/null &&
+'quoted text' 2>/dev/null printf && printf | x=1 then x=1 $(pwd)
+		"$1" 2>/dev/null export awk "$@" cd ${HOME} export "$1" 2>/dev/null
+	$(pwd) readonly sed /usr/bin -eu test $(pwd)
+${HOME} 2>/dev/null ${HOME} /usr/bin $(pwd) && 2>/dev/null then $(pwd) done
+local sed | test "$1" "$1" readonly grep grep readonly $(pwd) 2>/dev/null
+	-eu -eu -eu /usr/bin cd export "$1" --verbose 'quoted text'
+${HOME} ${HOME} --verbose ${HOME} done /usr/bin 'quoted text'
+	| --verbose readonly then
+awk 2>/dev/null && done
+then -eu 2>/dev/null "$@" sed done
+	"$1" | "$1" export ${HOME} then
+sed export ${HOME} echo echo sed $(pwd) then local /usr/bin x=1 awk
+	grep grep test echo echo "$@" /usr/bin | 'quoted text' then
+		awk --verbose "$@" 'quoted text' echo export sed sed | then test -eu then echo
+readonly && sed then echo 2>/dev/null then readonly export && $(pwd)
+		local test 'quoted text' "$1" ${HOME} /usr/bin
+awk 2>/dev/null ${HOME} /usr/bin grep test grep "$1" | echo readonly echo
+awk sed local then test | grep local x=1 cd ${HOME} awk printf && then "$1"
+		then ${HOME} local $(pwd) ${HOME} readonly test /usr/bin done printf test
+	printf /usr/bin x=1 'quoted text'
+	"$1" cd done echo 2>/dev/null && x=1 /usr/bin --verbose readonly
+	done readonly test done -eu echo
+	"$@" awk test --verbose "$1" test awk ${HOME}
+		${HOME} test readonly /usr/bin sed 2>/dev/null x=1
+	$(pwd) sed --verbose echo awk 2>/dev/null 2>/dev/null 2>/dev/null 2>/dev/null &&
+		then /usr/bin done ${HOME} | export grep 2>/dev/null $(pwd) cd
+	export export done && "$@" ${HOME} local grep 2>/dev/null awk | | cd x=1
+	echo readonly -eu grep export local
+test then readonly ${HOME} 'quoted text' |
+"$1" readonly awk cd "$@"
+		printf printf && local 'quoted text' echo echo export 'quoted text' local grep
+cd export "$1" printf done 2>/dev/null grep printf cd --verbose sed $(pwd) sed grep
+		cd awk --verbose $(pwd) $(pwd) ${HOME} "$@" 2>/dev/null
+		${HOME} 'quoted text' 2>/dev/null
+'quoted text' "$@" cd "$1" --verbose printf
+--verbose cd | "$1" 2>/dev/null then printf sed "$@" 2>/dev/null grep 'quoted text'
+		export "$1" $(pwd) local local && --verbose /usr/bin
+	"$1" readonly local sed --verbose export
+		/usr/bin then export done local export sed
+test | "$1" && /usr/bin 2>/dev/null printf cd "$@"
+		${HOME} echo cd "$@" local 2>/dev/null | cd done --verbose
+	&& -eu && && | echo 'quoted text' 2>/dev/null test
+		"$@" done /usr/bin 2>/dev/null /usr/bin export x=1 local -eu | export 'quoted text'
+	x=1 && test -eu 'quoted text' $(pwd) /usr/bin cd awk && done test done |
+	sed done readonly test "$1" /usr/bin test $(pwd)
+		cd cd echo "$@" local "$@" then test printf $(pwd)
+		x=1 done | echo printf "$1" echo && | "$1" && printf /usr/bin
+	'quoted text' cd echo $(pwd) /usr/bin
+'quoted text' 2>/dev/null sed local $(pwd) ${HOME}
+		echo x=1 test sed echo grep printf 'quoted text'
+| 2>/dev/null grep -eu $(pwd) then x=1 grep "$@" /usr/bin
+	sed cd awk 'quoted text' ${HOME}
+	export grep --verbose
+	/usr/bin x=1 then ${HOME} -eu 'quoted text' echo export --verbose $(pwd) $(pwd)
+$(pwd) && awk awk x=1 grep --verbose
+export "$@" done echo sed
+		export "$1" "$@" -eu cd then cd local
+		test 'quoted text' test then printf "$@" test local export grep sed
+		grep grep -eu readonly /usr/bin done $(pwd)
+	cd local "$@" ${HOME} | && $(pwd)
+then 2>/dev/null printf echo export awk sed export
+| /usr/bin local test && "$@" /usr/bin awk printf /usr/bin
+	export $(pwd) "$@" readonly
+	"$@" "$@" done local x=1 /usr/bin "$1"
+local "$1" --verbose 'quoted text'
+		test $(pwd) local echo x=1 && -eu "$@"
+"$1" done "$@" && sed 'quoted text' echo --verbose "$@" cd 'quoted text' -eu
+	test | 'quoted text' | awk cd $(pwd) -eu 2>/dev/null grep printf "$@" grep
+grep 'quoted text' readonly
+	${HOME} /usr/bin x=1 /usr/bin grep && 2>/dev/null
+	cd 'quoted text' $(pwd) test "$@" test local local
+		readonly local 'quoted text' export "$@" local sed
+	echo && "$@" 2>/dev/null x=1 $(pwd) x=1 then 2>/dev/null "$@" | /usr/bin 2>/dev/null
+		$(pwd) awk /usr/bin readonly 'quoted text'
+		printf "$@" printf | ${HOME} $(pwd) /usr/bin x=1 then then done
+		-eu local 'quoted text' -eu --verbose awk test 'quoted text'
+		then printf cd echo /usr/bin /usr/bin
+	local grep then awk 'quoted text' export
+	--verbose | echo sed x=1 echo
+	"$1" then -eu grep echo
+	${HOME} ${HOME} cd x=1 'quoted text' 'quoted text' export | sed
+local echo /usr/bin sed test sed "$@" $(pwd) && "$1" /usr/bin "$@" awk x=1
+	/usr/bin awk local x=1 && --verbose
+		cd sed --verbose then $(pwd) sed export readonly echo "$@" $(pwd) printf $(pwd)
+		readonly readonly --verbose
+	printf export local ${HOME} readonly grep then grep -eu x=1
+&& "$@" then /usr/bin test grep
+	"$@" then "$@" "$1" 'quoted text' $(pwd)
+	/usr/bin readonly "$@" --verbose sed echo done echo
+		${HOME} cd echo $(pwd) 'quoted text' readonly
+	readonly "$1" --verbose grep local echo test x=1 printf 'quoted text'
+	export export export "$1" $(pwd) --verbose echo grep 'quoted text'
+x=1 awk "$@" "$@" | sed x=1 x=1 echo awk readonly printf echo
+		${HOME} export awk | -eu test && export && awk 2>/dev/null done awk
+2>/dev/null /usr/bin export grep "$@" sed awk ${HOME} printf done && 'quoted text'
+readonly echo local test 2>/dev/null
+		2>/dev/null "$1" 'quoted text' test sed "$@" cd grep -eu /usr/bin $(pwd)
+	echo x=1 x=1 "$1" sed | | "$1"
+		2>/dev/null done -eu "$1" ${HOME} /usr/bin
+		awk | echo "$1" readonly sed | then test export &&
+		echo sed -eu awk "$1" then
+	readonly $(pwd) --verbose sed grep test "$@" echo x=1 x=1 grep export
+		awk done && done | $(pwd) &&
+	grep then then local 'quoted text' awk && test cd awk $(pwd) awk
+$(pwd) 2>/dev/null 2>/dev/null --verbose grep local --verbose
+"$@" $(pwd) 'quoted text' -eu test done grep test x=1 $(pwd)
+		x=1 x=1 /usr/bin local "$@" cd done "$@" 2>/dev/null grep
+		grep cd sed cd 'quoted text' sed
+awk grep local x=1 cd
+--verbose printf $(pwd) ${HOME} done test sed --verbose
+x=1 /usr/bin test ${HOME}
+		&& echo cd readonly -eu echo | -eu
+	2>/dev/null then "$1" 2>/dev/null awk test
+echo export local readonly -eu printf ${HOME} awk $(pwd) --verbose
+		readonly readonly | && test -eu echo printf
+printf -eu readonly awk x=1 cd cd -eu -eu grep 2>/dev/null awk | export test --verbose
+		readonly printf local && local awk 2>/dev/null export cd cd -eu && ${HOME}
+	$(pwd) x=1 x=1 --verbose "$1" | sed local awk "$@" local /usr/bin then 'quoted text'
+	$(pwd) 'quoted text' cd "$1" /usr/bin
+		printf "$@" 2>/dev/null -eu 'quoted text' /usr/bin ${HOME} printf ${HOME}
+	${HOME} -eu && x=1 grep grep printf readonly echo echo &&
+		echo then readonly printf 'quoted text'
+2>/dev/null grep -eu 'quoted text'
+		sed "$@" printf cd | readonly done | x=1 ${HOME} -eu /usr/bin
+echo echo then $(pwd) test grep "$1" 2>/dev/null
+	-eu "$1" echo --verbose printf x=1 && x=1 ${HOME} cd done local "$1" grep printf
+		echo grep "$1" local x=1 echo $(pwd) sed readonly --verbose 2>/dev/null
+local /usr/bin "$1" "$1" --verbose local x=1 printf done
+		'quoted text' awk grep readonly
+	/usr/bin ${HOME} /usr/bin cd 2>/dev/null echo
+	echo | readonly awk done local
+	"$1" ${HOME} -eu sed 'quoted text' readonly
+"$1" 2>/dev/null printf cd echo readonly -eu x=1 echo done
+	readonly /usr/bin local 'quoted text' sed $(pwd) /usr/bin 2>/dev/null
+		2>/dev/null "$1" awk ${HOME} awk then 2>/dev/null sed x=1 --verbose
+		-eu | done awk awk cd readonly 2>/dev/null
+2>/dev/null printf readonly then grep "$1" export readonly
+		--verbose readonly echo sed cd --verbose --verbose --verbose then
+	printf test ${HOME} "$1" grep $(pwd) printf local
+		2>/dev/null | 'quoted text' printf local /usr/bin $(pwd)
+		echo local 2>/dev/null cd 'quoted text' sed 'quoted text' $(pwd) 'quoted text'
+	$(pwd) x=1 printf sed done readonly echo /usr/bin
+		local printf "$@" 2>/dev/null export "$1" "$@" done echo $(pwd)
+		"$1" $(pwd) readonly test 2>/dev/null
+'quoted text' /usr/bin then export
+2>/dev/null grep /usr/bin done | "$1" "$1" printf
+	2>/dev/null "$@" echo sed "$1" && export | then
+	test --verbose 'quoted text' local
+	then printf 2>/dev/null echo | 2>/dev/null printf 'quoted text' x=1 'quoted text'
+readonly readonly 2>/dev/null /usr/bin ${HOME} && ${HOME}
+		| "$1" echo cd 2>/dev/null echo --verbose | 2>/dev/null grep $(pwd) $(pwd)
+	grep grep local 'quoted text' "$@" local /usr/bin $(pwd)
+| sed readonly "$@" "$@" then awk grep ${HOME} ${HOME} /usr/bin && cd local
+	-eu /usr/bin local done --verbose
+		echo 2>/dev/null cd 'quoted text' export test
+then x=1 /usr/bin 'quoted text' awk -eu echo readonly 'quoted text'
+		awk awk printf "$@" ${HOME} echo then /usr/bin | echo
+	grep /usr/bin grep x=1 ${HOME} grep
+awk ${HOME} && readonly "$@" then printf test
+	grep -eu sed ${HOME} echo awk && 'quoted text'
+	x=1 ${HOME} cd local /usr/bin | && ${HOME} then "$1" --verbose test printf
+		then cd 2>/dev/null local readonly grep local done /usr/bin --verbose local
+	'quoted text' grep then /usr/bin
+	sed readonly "$@" $(pwd) $(pwd)
+"$1" -eu done /usr/bin sed 2>/dev/null --verbose
+	'quoted text' grep 'quoted text' && echo export ${HOME} | export | sed readonly
+${HOME} | local test /usr/bin 'quoted text' cd echo printf
+	then export 'quoted text' awk x=1
+		test readonly ${HOME} local then grep
+	export 'quoted text' -eu ${HOME} -eu ${HOME}
+		"$@" local local && then readonly cd printf | export echo then done echo
+		'quoted text' grep /usr/bin done awk export && $(pwd) then
+	$(pwd) "$@" && --verbose /usr/bin readonly readonly grep export
+$(pwd) 2>/dev/null 'quoted text'
+		x=1 x=1 local grep ${HOME}
+		${HOME} echo "$1" grep test --verbose printf ${HOME} "$@" then "$@" echo sed x=1
+/usr/bin ${HOME} "$1" ${HOME} -eu
+	$(pwd) x=1 "$@" -eu test && cd cd x=1
+		cd test "$1" test readonly local x=1 local cd
+sed cd local $(pwd) "$@" | --verbose && 'quoted text' echo x=1 $(pwd)
+	&& echo $(pwd) grep && "$1" --verbose
+	$(pwd) done test local 'quoted text'
+	| awk sed then sed && grep printf "$@" readonly && cd echo "$1" done
+	echo "$1" 'quoted text' done
+		cd sed | local local test sed awk /usr/bin printf
+		x=1 echo awk export export echo && "$1" grep | ${HOME} echo echo grep awk
+	"$1" cd grep echo ${HOME} grep printf
+	${HOME} -eu awk -eu 2>/dev/null "$1"
+		$(pwd) $(pwd) echo "$@" 'quoted text' then cd local
+		printf /usr/bin test "$1" then && /usr/bin 2>/dev/null readonly echo
+		$(pwd) --verbose 2>/dev/null
+	'quoted text' export ${HOME}
+awk -eu x=1 echo | done "$@" 'quoted text' export -eu
+		echo readonly --verbose local local local | local $(pwd) test "$@"
+cd | local done "$@" echo 'quoted text' test -eu printf
+	cd --verbose test then cd && 'quoted text' done printf /usr/bin && then cd
+	${HOME} ${HOME} cd ${HOME}
+	| -eu && grep && -eu sed x=1 done test awk awk
+		-eu printf ${HOME} grep awk printf local sed "$1"
+test | 'quoted text' then then 'quoted text' --verbose local
+		/usr/bin printf && 2>/dev/null -eu "$1" printf echo /usr/bin
+	${HOME} "$1" echo export &&
+${HOME} then echo "$@" 2>/dev/null then | cd cd sed -eu readonly printf /usr/bin
+readonly printf 2>/dev/null
+readonly cd then local $(pwd)
+		/usr/bin 2>/dev/null echo readonly then then --verbose $(pwd) grep
+	/usr/bin done --verbose "$1" grep "$@" printf awk $(pwd) local && 'quoted text'
+"$@" cd -eu echo --verbose local ${HOME}
+	$(pwd) echo export && test grep awk
+		printf readonly && echo "$@" -eu | /usr/bin readonly
+		then test export "$1" then readonly 2>/dev/null && local 'quoted text'
+	cd x=1 "$@" "$1" awk $(pwd) "$@" printf cd
+	"$1" $(pwd) 2>/dev/null sed
+		| cd "$1" local cd ${HOME} test printf then
+		echo "$1" "$@" then awk /usr/bin then cd "$@" awk -eu | /usr/bin done test echo
+"$1" x=1 sed --verbose awk |
+test ${HOME} 2>/dev/null grep awk grep "$@" export $(pwd) sed cd awk export x=1
+printf $(pwd) then $(pwd) ${HOME} | cd /usr/bin done x=1 printf done
+	"$1" awk $(pwd) done sed 2>/dev/null done sed then echo done | awk echo
+readonly export printf then local 2>/dev/null --verbose readonly echo
+	sed echo --verbose grep --verbose awk
+	local && 'quoted text' | /usr/bin printf grep ${HOME}
+	local x=1 then export done test then --verbose then grep export printf then
+		sed --verbose $(pwd)
+	&& echo sed /usr/bin local "$@" done readonly cd
+awk --verbose done 'quoted text' printf export | export local -eu
+		test test "$@" --verbose x=1 && readonly ${HOME} then then "$1" then /usr/bin
+		cd readonly export sed "$1" cd "$@" grep
+		printf then /usr/bin cd x=1 done 'quoted text' local && "$@" 2>/dev/null cd export
+| | ${HOME} --verbose ${HOME} done "$1" /usr/bin readonly
+'quoted text' readonly 'quoted text' sed /usr/bin grep cd printf
+	sed readonly local export done printf
+		&& 'quoted text' "$@" done
+	then local x=1 "$@" -eu printf grep --verbose
+	sed done awk then cd readonly | awk done readonly "$1"
+		x=1 | && /usr/bin | printf export printf grep "$@" echo $(pwd) -eu awk
+sed && awk grep readonly awk cd cd && -eu "$1" echo /usr/bin readonly
+"$1" sed 'quoted text' cd awk | sed then export && printf
+	grep 'quoted text' $(pwd) && sed
+		printf printf | then 'quoted text' printf 'quoted text' -eu local local ${HOME}
+	readonly test "$@" && echo /usr/bin printf
+2>/dev/null "$@" ${HOME} local readonly sed
+	$(pwd) then then readonly test | "$@" local then readonly 'quoted text' $(pwd)
+		$(pwd) readonly echo && export then readonly
+	test local "$1" sed awk ${HOME} 2>/dev/null --verbose $(pwd) 2>/dev/null
+	-eu export 2>/dev/null ${HOME} cd export sed export echo x=1 local
+-eu "$1" cd local "$1" cd $(pwd)
+		export --verbose export cd
+local local ${HOME} --verbose ${HOME}
+grep 2>/dev/null 2>/dev/null
+	done export "$@" test /usr/bin
+awk printf sed 2>/dev/null test 'quoted text' && grep 2>/dev/null
+echo x=1 echo cd -eu echo | x=1 test test | sed done 'quoted text' export
+		cd 'quoted text' grep ${HOME} then /usr/bin 2>/dev/null && ${HOME}
+	done awk "$1" /usr/bin sed grep local
+		&& awk local "$1" readonly sed --verbose "$@" ${HOME}
+	local ${HOME} printf /usr/bin sed
+	x=1 && -eu done sed cd awk | readonly $(pwd) readonly export local export
+		readonly local --verbose cd printf x=1 2>/dev/null
+		| done printf printf && "$1" | echo --verbose "$1" printf test | 'quoted text'
+		echo test 2>/dev/null done then
+	"$@" sed 'quoted text' -eu $(pwd) test -eu cd 'quoted text'
+	grep done export grep
+done grep --verbose ${HOME} -eu export
+| ${HOME} awk $(pwd) x=1 && $(pwd) | --verbose 'quoted text' sed grep local
+awk printf 2>/dev/null then then then done test x=1 cd
+	export grep /usr/bin && $(pwd)
+test echo echo printf test then then readonly grep -eu
+		sed export --verbose then --verbose --verbose
+/usr/bin then "$1" $(pwd) echo $(pwd) -eu grep && $(pwd) ${HOME} echo cd 'quoted text'
+		printf --verbose 2>/dev/null export test && 2>/dev/null && then
+		"$@" awk awk "$1" x=1 -eu local awk sed "$@" x=1 test cd && then printf 2>/dev/null
+		'quoted text' export -eu -eu "$@" x=1 "$1" | -eu echo ${HOME}
+		| cd /usr/bin /usr/bin ${HOME}
+		| x=1 cd readonly local ${HOME} printf printf
+	x=1 ${HOME} 2>/dev/null "$1" printf "$@" printf && local
+"$1" export "$@" --verbose | echo echo -eu "$@" export echo
+"$@" 'quoted text' printf echo printf export test then local
+/usr/bin cd ${HOME} 2>/dev/null 2>/dev/null awk
+x=1 | | cd readonly "$1" | ${HOME} x=1 -eu cd echo -eu test 2>/dev/null
+done sed "$@" 2>/dev/null local ${HOME} | && readonly local && ${HOME} sed grep
+&& ${HOME} readonly ${HOME} then local --verbose readonly then --verbose
+	export && then grep done readonly local x=1 --verbose | export
+		&& | "$1" done cd then -eu echo cd ${HOME}
+		grep 'quoted text' -eu "$@" grep /usr/bin $(pwd) --verbose -eu "$1"
+	/usr/bin ${HOME} | && readonly cd | cd sed awk x=1 then cd export
+	/usr/bin $(pwd) export --verbose
+		export ${HOME} 'quoted text'
+printf echo x=1 $(pwd) "$1" echo
+		"$1" done readonly export "$1" printf printf | export && --verbose x=1 readonly
+	&& sed local $(pwd) readonly | 'quoted text' | "$1" test test x=1 $(pwd) sed
+		export readonly export printf --verbose cd $(pwd) readonly x=1 readonly | -eu
+	'quoted text' export
+		sed && grep && 'quoted text' printf -eu echo -eu x=1 grep printf
+/usr/bin export then $(pwd) local -eu --verbose grep 2>/dev/null
+2>/dev/null then test grep echo sed 'quoted text'
+/usr/bin 2>/dev/null 2>/dev/null && ${HOME} cd local
+	local "$@" export sed "$1" printf export
+	readonly | -eu printf
+local /usr/bin export then sed $(pwd) done && export export done
+		local $(pwd) then local done && -eu grep awk grep
+		echo --verbose 'quoted text' local
+-eu /usr/bin readonly x=1 cd ${HOME}
+	test 2>/dev/null sed awk echo ${HOME} $(pwd) --verbose
+		"$1" --verbose | "$@" && sed awk done sed printf cd export
+'quoted text' then "$1" cd cd
+	&& /usr/bin x=1 printf x=1 done printf then /usr/bin && grep cd echo ${HOME}
+	/usr/bin readonly 'quoted text' local grep $(pwd) done 2>/dev/null sed
+	sed $(pwd) --verbose |
+test sed awk sed grep echo awk "$1" --verbose done awk | $(pwd) /usr/bin
+| export echo printf done readonly
+		2>/dev/null "$@" printf $(pwd) --verbose "$@" awk "$@" -eu && | echo
+		readonly awk --verbose 2>/dev/null local "$1" /usr/bin 'quoted text'
+/usr/bin x=1 'quoted text' $(pwd) 2>/dev/null grep "$@" ${HOME} export
+		printf ${HOME} && local --verbose export -eu readonly --verbose
+	export -eu test local awk x=1 ${HOME} 2>/dev/null test awk
+sed x=1 readonly cd --verbose sed "$1" readonly done && printf
+	-eu grep sed awk && -eu export -eu
+test then grep "$1" x=1 test x=1 /usr/bin ${HOME} printf done
+	&& && local awk | --verbose export $(pwd)
+		--verbose && test grep export then local
+grep "$1" export && then | && then test | local 2>/dev/null
+awk readonly echo readonly 2>/dev/null | -eu -eu then x=1 readonly local awk readonly
+awk sed -eu | awk test ${HOME}
+		echo printf 2>/dev/null grep done awk readonly test local -eu awk
+		x=1 printf printf export --verbose echo cd
+	x=1 $(pwd) awk cd local
+		readonly "$@" && 'quoted text' 'quoted text' x=1 2>/dev/null
+	"$1" "$1" 2>/dev/null && printf /usr/bin x=1 then | x=1 2>/dev/null
+	/usr/bin "$1" done --verbose --verbose
+&& cd local "$@" /usr/bin $(pwd) then $(pwd) "$1" 'quoted text' test printf &&
+	$(pwd) 'quoted text' printf test export x=1
+	grep then 'quoted text' "$@" $(pwd)
+		"$@" test export x=1 $(pwd) && -eu "$1" 2>/dev/null printf "$@" $(pwd) local
+	'quoted text' --verbose | 'quoted text'
+		sed local echo x=1 $(pwd)
+echo 'quoted text' grep test | 'quoted text' then cd readonly done readonly printf
+	then "$@" && local cd | local cd
+	--verbose grep test 2>/dev/null then
+	$(pwd) $(pwd) echo then x=1 then export grep local x=1 printf
+		&& echo test && ${HOME} awk printf -eu echo sed | awk test cd
+	grep then printf /usr/bin test x=1 -eu -eu | export
+		2>/dev/null --verbose grep $(pwd) grep awk 'quoted text'
+	readonly $(pwd) awk export 'quoted text'
+		"$@" sed | local && local "$1"
+	then "$1" | && echo --verbose printf x=1 | $(pwd) sed $(pwd) then "$1" -eu "$1"
+		local 'quoted text' "$@" -eu
+	then grep cd 'quoted text' export
+--verbose /usr/bin awk then test /usr/bin
+&& 2>/dev/null test 'quoted text'
+		"$@" --verbose grep then && test local
+		export test x=1 2>/dev/null $(pwd) -eu --verbose done /usr/bin
+-eu $(pwd) x=1 x=1 x=1 "$1" echo then
+		/usr/bin "$1" x=1 test grep --verbose --verbose $(pwd) done -eu "$@"
+$(pwd) $(pwd) local x=1 /usr/bin then then test -eu x=1 done 'quoted text'
+	${HOME} /usr/bin -eu 'quoted text' 2>/dev/null readonly test
+		printf local --verbose then --verbose grep sed readonly && 2>/dev/null 2>/dev/null
+--verbose 'quoted text' echo 'quoted text' cd cd readonly printf 2>/dev/null then
+	echo awk "$1" && readonly --verbose grep 'quoted text' awk
+		-eu cd ${HOME} 2>/dev/null local grep ${HOME} sed then x=1 sed $(pwd) "$@"
+2>/dev/null $(pwd) "$@" echo "$1"
+--verbose then "$1" cd awk done cd 'quoted text' "$@" cd 2>/dev/null "$@" then
+	${HOME} grep done sed -eu done -eu printf readonly readonly "$1"
+--verbose readonly ${HOME} cd local -eu printf /usr/bin
+export "$@" 2>/dev/null ${HOME} $(pwd) $(pwd)
+		$(pwd) ${HOME} x=1 done echo $(pwd) | -eu done x=1 --verbose x=1 "$1" 'quoted text'
+		sed awk -eu sed cd local 2>/dev/null x=1 -eu cd --verbose
+		then && sed done then && $(pwd) export
+$(pwd) | then then then /usr/bin 2>/dev/null ${HOME} sed export
+-eu export $(pwd) 2>/dev/null
+$(pwd) 2>/dev/null $(pwd) "$@" export x=1 grep ${HOME} printf then && done
+	2>/dev/null | /usr/bin local --verbose grep cd test "$1" test /usr/bin then
+echo $(pwd) awk "$@" done
+		| ${HOME} grep echo echo then | cd | export test
+	--verbose && export -eu /usr/bin /usr/bin 2>/dev/null
+	echo /usr/bin "$@" $(pwd) echo
+$(pwd) echo --verbose then /usr/bin
+		"$@" grep done done 2>/dev/null awk -eu export 'quoted text' test cd 'quoted text'
+		printf ${HOME} $(pwd) 'quoted text' /usr/bin grep sed readonly
+		readonly sed | cd test && /usr/bin local awk && then
+	readonly grep x=1 local
+local local awk readonly sed | | then readonly ${HOME} local cd |
+#include c25.sh
+&& local done export x=1 ${HOME} --verbose -eu test x=1 "$@" then /usr/bin
+		readonly x=1 sed readonly export export ${HOME} awk x=1 readonly
+/usr/bin --verbose local awk $(pwd) /usr/bin && done sed local
+sed x=1 && "$@" | export --verbose test $(pwd) | -eu
+		&& grep grep done "$@" test echo
+		then ${HOME} | printf done
+test done grep 'quoted text'
+		local sed /usr/bin awk && | done echo then x=1 -eu ${HOME} /usr/bin test $(pwd)
+"$@" grep "$@" done cd 2>/dev/null && export echo 'quoted text' sed sed "$1"
+	2>/dev/null grep | 'quoted text' grep -eu "$1"
+	'quoted text' --verbose sed "$1" x=1 printf "$1" | export ${HOME} readonly x=1
+	sed 'quoted text' readonly | x=1 sed
+		${HOME} grep cd done test export printf echo done readonly ${HOME}
+	"$1" export "$@" | sed $(pwd) x=1 --verbose x=1 grep 'quoted text' grep
+'quoted text' export done "$@" grep 'quoted text'
+grep grep printf readonly 'quoted text'
+	--verbose 2>/dev/null local readonly
+	printf /usr/bin printf done then cd
+--verbose ${HOME} && readonly then printf
+	&& "$@" readonly "$1" --verbose /usr/bin "$1" | local "$@" sed "$1" $(pwd) readonly
+--verbose "$1" export echo local $(pwd) -eu readonly 'quoted text'
+local 'quoted text' && | $(pwd) echo cd cd done && "$@"
+		-eu done awk grep x=1 test
+/usr/bin echo sed | done printf local ${HOME} x=1 $(pwd) --verbose
+	cd "$1" local sed ${HOME}
+		$(pwd) /usr/bin readonly /usr/bin echo --verbose
+		/usr/bin export && ${HOME} "$1" sed | then x=1 ${HOME} printf then ${HOME}
+readonly /usr/bin readonly 'quoted text' grep ${HOME} grep export
+	2>/dev/null printf | 'quoted text' cd --verbose /usr/bin
+		$(pwd) /usr/bin -eu test ${HOME} sed then "$@" sed
+		x=1 "$1" echo echo -eu "$@" printf x=1 sed test
+		/usr/bin -eu x=1 cd sed echo 'quoted text' echo 'quoted text'
+readonly $(pwd) /usr/bin
+"$1" done local sed grep
+	local && 'quoted text' local export /usr/bin sed sed /usr/bin printf done
+2>/dev/null -eu $(pwd) cd echo test "$1" ${HOME} "$1" | local readonly 'quoted text'
+		printf done then cd && -eu then /usr/bin 'quoted text'
+	-eu 'quoted text' x=1 done | 'quoted text' 2>/dev/null done
+		--verbose | 2>/dev/null | | cd test printf 'quoted text'
+done 2>/dev/null "$1" x=1 --verbose
+		done grep local export | echo --verbose
+	-eu printf --verbose grep export x=1 "$@" && export /usr/bin 'quoted text'
+	2>/dev/null local ${HOME} readonly echo $(pwd) ${HOME} -eu 2>/dev/null echo done
+grep | echo then 'quoted text' -eu local x=1 | done "$@" x=1
+	| ${HOME} --verbose awk export x=1 done "$1" -eu
+"$@" then export 'quoted text'
+&& /usr/bin test $(pwd) test sed -eu && $(pwd)
+	${HOME} export && local "$@" x=1 local cd --verbose
+/usr/bin sed done && local
+		echo 'quoted text' done
+	echo test done cd -eu &&
+	cd -eu 'quoted text' awk local printf /usr/bin export sed readonly local then &&
+then done /usr/bin $(pwd)
+	&& echo /usr/bin 2>/dev/null /usr/bin "$@" "$@" sed 2>/dev/null
+"$1" readonly "$@" ${HOME} ${HOME} cd && sed awk
+done "$1" local awk grep "$@" $(pwd)
+		$(pwd) local ${HOME} ${HOME} 'quoted text' test then ${HOME}
+	grep /usr/bin /usr/bin x=1 grep sed x=1
+		&& cd grep local local $(pwd) readonly $(pwd)
+	"$1" awk test --verbose "$@" "$1" $(pwd) /usr/bin
+/usr/bin grep export && cd 2>/dev/null echo
+&& 'quoted text' export then awk 2>/dev/null
+		test 2>/dev/null 'quoted text' test "$1" cd
+sed sed then x=1 2>/dev/null "$@" cd cd echo /usr/bin /usr/bin echo local readonly
+-eu -eu then awk local && sed 2>/dev/null readonly $(pwd)
+		&& grep --verbose cd /usr/bin export $(pwd) awk
+		local then echo then local "$1" export readonly
+		&& -eu $(pwd) 'quoted text' done $(pwd) sed sed -eu
+	${HOME} test && awk ${HOME} $(pwd) --verbose export local grep done awk ${HOME}
+	'quoted text' x=1 echo
+	then echo awk grep cd readonly
+awk "$1" echo --verbose && "$1" $(pwd) printf then then local 'quoted text'
+--verbose ${HOME} x=1 grep echo sed x=1 /usr/bin then $(pwd) "$@" 'quoted text'
+"$@" export sed 'quoted text' 'quoted text' done /usr/bin
+		/usr/bin 'quoted text' 'quoted text' x=1 test test x=1 && /usr/bin 'quoted text'
+| then && --verbose grep $(pwd) /usr/bin "$1" awk ${HOME}
+	readonly sed -eu --verbose cd 'quoted text' --verbose
+		test done grep && test $(pwd) echo x=1 export "$@" --verbose grep
+	'quoted text' && x=1 test
+		sed awk cd echo cd --verbose local test
+		local then echo ${HOME} "$@" then "$@" sed --verbose
+	-eu cd x=1 $(pwd) /usr/bin awk grep readonly
+		grep ${HOME} ${HOME} && cd done
+-eu echo /usr/bin 2>/dev/null | sed echo "$@" "$1"
+	then -eu x=1 "$1" awk awk readonly sed -eu echo --verbose done
+--verbose echo /usr/bin echo
+	| -eu grep printf cd /usr/bin readonly
+'quoted text' -eu echo | "$@" awk
+		readonly && ${HOME} then echo "$@" done 2>/dev/null grep printf readonly echo "$@"
+		-eu readonly "$@" printf export echo
+	/usr/bin --verbose "$1" "$@" test "$@" sed x=1 awk -eu test /usr/bin printf
+	awk /usr/bin done && grep && done awk 2>/dev/null ${HOME} -eu -eu
+done /usr/bin printf && test printf x=1 | 2>/dev/null
+'quoted text' -eu printf -eu test awk
+		${HOME} -eu grep test then echo && readonly sed "$1" 2>/dev/null
+	/usr/bin then local 2>/dev/null done "$@" awk -eu sed test
+	export echo test grep echo export "$1" cd && awk done 2>/dev/null
+	2>/dev/null 2>/dev/null cd
+	$(pwd) readonly grep echo printf ${HOME} x=1 | $(pwd) ${HOME} cd
+	readonly $(pwd) && && printf $(pwd) then grep cd x=1 --verbose
+--verbose 'quoted text' | x=1 readonly ${HOME} /usr/bin export 'quoted text'
+	printf test done $(pwd) "$@" "$1" cd printf
+grep awk test echo -eu awk done echo x=1 | echo
+| $(pwd) awk local x=1 readonly sed
+	printf printf awk grep cd /usr/bin test -eu "$@"
+	/usr/bin echo x=1 /usr/bin sed 2>/dev/null
+		sed awk awk x=1 done sed printf sed grep 2>/dev/null
+awk sed x=1 grep $(pwd) grep readonly then sed ${HOME} 'quoted text'
+$(pwd) 'quoted text' readonly
+	echo export grep | sed readonly 2>/dev/null cd printf "$1" grep "$@" $(pwd)
+		${HOME} done 'quoted text' /usr/bin readonly
+echo export "$1" -eu export && $(pwd) 'quoted text' --verbose
+	&& echo printf && cd sed 2>/dev/null
+	"$1" then awk "$1" ${HOME} awk /usr/bin && -eu
+	2>/dev/null && done x=1 "$1" local 2>/dev/null sed x=1 | sed /usr/bin -eu 'quoted text'
+--verbose && | --verbose ${HOME}
+		$(pwd) $(pwd) && /usr/bin echo done "$1" x=1 2>/dev/null
+	2>/dev/null $(pwd) local awk -eu awk | 'quoted text' then --verbose
+		export sed && 2>/dev/null 2>/dev/null sed echo export /usr/bin printf
+	| -eu 'quoted text' --verbose grep "$1" | echo && 2>/dev/null sed awk done
+/usr/bin ${HOME} $(pwd) "$@" &&
+	/usr/bin ${HOME} echo "$@" && && 'quoted text' echo && test ${HOME}
+	printf local awk 2>/dev/null 2>/dev/null "$@" awk readonly
+		then | 2>/dev/null echo ${HOME} "$@" then printf ${HOME}
+		'quoted text' --verbose awk --verbose echo 2>/dev/null ${HOME} test -eu then
+		$(pwd) cd then && /usr/bin echo "$1" && readonly "$@" /usr/bin
+		${HOME} then local ${HOME}
+		'quoted text' awk local sed | "$@" && export --verbose printf local "$@"
+		local readonly -eu ${HOME} then sed
+local 'quoted text' /usr/bin printf 2>/dev/null local -eu -eu grep echo
+	echo | ${HOME} /usr/bin "$@" 2>/dev/null
+	'quoted text' grep && 'quoted text' readonly
+printf "$1" ${HOME} "$@" ${HOME} cd cd ${HOME} --verbose printf ${HOME} "$1"
+"$@" ${HOME} && $(pwd) "$@"
+		$(pwd) awk && --verbose
+	local cd -eu done --verbose 2>/dev/null 2>/dev/null
+${HOME} "$@" ${HOME} x=1 printf test && ${HOME} -eu
+		local "$1" printf ${HOME} local
+		| cd grep local x=1 test grep export
+		then "$1" awk x=1 x=1 /usr/bin x=1 && awk grep --verbose
+$(pwd) readonly -eu ${HOME} awk grep /usr/bin -eu done awk readonly ${HOME}
+	export "$1" export ${HOME} printf | | "$1" echo printf echo local
+	| "$@" printf 2>/dev/null then "$1" readonly -eu | /usr/bin readonly done sed
+		-eu 2>/dev/null --verbose echo cd grep then --verbose
+"$@" echo -eu && 'quoted text' /usr/bin
+		sed test then "$1" grep cd --verbose x=1 $(pwd) printf $(pwd) awk then
+		export ${HOME} 2>/dev/null /usr/bin | 2>/dev/null | local $(pwd) printf "$@"
+		awk "$1" $(pwd) readonly | test 'quoted text' "$@" $(pwd) | test 'quoted text' local
+echo cd done "$@" done | local "$1" "$1" && printf | ${HOME} echo x=1 echo cd done
+	sed && $(pwd) 'quoted text' done 'quoted text'
+		cd awk --verbose "$@" awk printf done && awk awk --verbose awk local 'quoted text'
+		/usr/bin cd --verbose echo grep /usr/bin grep 2>/dev/null
+	'quoted text' grep local
+		'quoted text' "$@" "$@" export export sed sed
+cd printf sed 'quoted text'
+	done /usr/bin local done 2>/dev/null x=1
+		echo ${HOME} echo "$@" 2>/dev/null done then readonly local 2>/dev/null
+	'quoted text' 2>/dev/null local grep test "$@" | echo
+	cd 'quoted text' echo export cd readonly | test test 'quoted text'
+	"$1" && "$@" --verbose done done
+echo -eu printf export test readonly done x=1 then /usr/bin printf
+		printf $(pwd) --verbose done
+		"$1" local 'quoted text'
+	${HOME} $(pwd) local 2>/dev/null ${HOME}
+--verbose awk printf | readonly then echo --verbose local "$1" ${HOME} echo $(pwd)
+		readonly grep /usr/bin "$1" sed --verbose $(pwd) grep 'quoted text'
+	readonly 'quoted text' grep | echo echo && $(pwd) cd then test sed $(pwd)
+		2>/dev/null local cd $(pwd) $(pwd)
+	test --verbose $(pwd) "$@" local
+	--verbose /usr/bin ${HOME}
+readonly --verbose "$@" done then && ${HOME} cd /usr/bin --verbose export
+		cd 2>/dev/null && /usr/bin echo
+		cd echo $(pwd) /usr/bin awk /usr/bin test printf
+		'quoted text' awk x=1 local "$1" 'quoted text' "$@" then 2>/dev/null
+	awk ${HOME} done then local sed grep "$1" sed printf then
+	${HOME} | ${HOME} readonly
+		sed x=1 | /usr/bin sed local --verbose readonly "$@" cd $(pwd) grep x=1 echo local
+		"$1" "$1" awk /usr/bin local "$1" readonly 2>/dev/null awk sed x=1
+	echo --verbose 2>/dev/null --verbose /usr/bin
+		readonly -eu local | readonly grep && printf sed export export
+		$(pwd) "$@" cd && && sed local -eu "$1" test readonly printf
+grep 2>/dev/null && 2>/dev/null 'quoted text' sed --verbose $(pwd)
+		test local -eu --verbose awk ${HOME} | readonly printf -eu grep /usr/bin "$1"
+		--verbose -eu && readonly ${HOME} export -eu awk 2>/dev/null --verbose
+		grep awk --verbose | "$@" sed x=1 awk local -eu | awk && x=1 | && test
+	local done "$1" "$1" "$1" local done "$@" grep
+	| ${HOME} ${HOME} cd cd done done cd 2>/dev/null
+	cd ${HOME} --verbose /usr/bin cd awk printf "$@"
+	done then $(pwd) 2>/dev/null 'quoted text' echo "$@" then x=1 2>/dev/null
+printf test 'quoted text' export export sed
+	$(pwd) sed | echo sed awk printf -eu test test && done x=1 printf /usr/bin
+readonly test awk -eu grep
+		export x=1 2>/dev/null $(pwd)
+	then echo 2>/dev/null x=1 printf $(pwd) then printf sed "$@"
+		&& "$@" x=1 | ${HOME} export local then done local cd then $(pwd)
+	printf | printf test awk cd sed 'quoted text' sed "$@" $(pwd)
+	2>/dev/null then --verbose test sed readonly | test x=1 echo readonly "$1"
+		"$1" -eu readonly awk cd | printf | export test
+		--verbose -eu "$@" cd $(pwd)
+		local readonly /usr/bin grep --verbose -eu then && sed
+	${HOME} -eu ${HOME} export
+grep printf 'quoted text' local echo awk --verbose cd && ${HOME} |
+	"$@" 'quoted text' export x=1 'quoted text'
+	then x=1 2>/dev/null grep $(pwd) printf x=1 grep cd
+"$@" /usr/bin sed && awk sed
+awk x=1 then x=1 -eu && $(pwd) ${HOME} /usr/bin local "$@"
+	done x=1 then cd 2>/dev/null "$1" 2>/dev/null sed x=1 ${HOME} 'quoted text'
+echo "$1" && "$1" done /usr/bin grep ${HOME} readonly echo $(pwd) 'quoted text'
+'quoted text' | x=1 ${HOME}
+		"$1" | /usr/bin 'quoted text' | "$@" --verbose
+		-eu local 'quoted text' -eu printf
+	/usr/bin x=1 "$1" | printf printf awk then then
+printf local readonly readonly sed readonly $(pwd) $(pwd) cd
+		2>/dev/null awk then "$@" ${HOME} cd then awk
+	printf echo 'quoted text'
+		printf echo test local $(pwd) done -eu -eu "$@" "$1" done 'quoted text' local
+	&& readonly awk --verbose "$@" awk sed grep local then export then | ${HOME} -eu
+		sed -eu && awk sed x=1 2>/dev/null printf test echo
+local awk && x=1 export && echo readonly | x=1
+sed | 2>/dev/null echo $(pwd)
+"$1" --verbose echo "$@" echo test export awk echo
+sed $(pwd) cd then "$@" && ${HOME} readonly 'quoted text' awk then 'quoted text'
+		${HOME} 2>/dev/null -eu
+	test 'quoted text' -eu printf awk then readonly 2>/dev/null local then sed
+/usr/bin then readonly readonly grep --verbose readonly printf "$1" -eu awk "$1"
+		sed | "$1" echo echo done grep && "$1" ${HOME}
+	${HOME} "$@" echo cd $(pwd) | echo -eu 'quoted text' test awk test cd "$1" echo
+	echo then test awk echo echo "$1" printf
+cd ${HOME} "$@" "$1" /usr/bin && 2>/dev/null local "$1" 'quoted text'
+	$(pwd) "$@" ${HOME} 2>/dev/null
+local --verbose local --verbose readonly ${HOME}
+		| 'quoted text' export local 2>/dev/null -eu 'quoted text' then grep 'quoted text'
+echo export -eu grep echo 2>/dev/null awk awk --verbose x=1 -eu printf
+local -eu done readonly export "$@" export --verbose export x=1 2>/dev/null -eu
+		$(pwd) $(pwd) test "$1" --verbose then printf && test "$1" echo | --verbose -eu
+	readonly && x=1 x=1 2>/dev/null
+	${HOME} awk export readonly echo sed x=1
+		${HOME} test ${HOME} "$@" x=1 /usr/bin sed | cd 'quoted text'
+	then printf --verbose cd grep --verbose $(pwd) $(pwd)
+echo && $(pwd) 'quoted text' echo grep awk x=1 && 2>/dev/null
+printf ${HOME} local 'quoted text' 'quoted text' sed "$@" export test 'quoted text'
+readonly | readonly "$1" 'quoted text' then --verbose cd printf
+		"$1" /usr/bin "$@" sed 'quoted text' -eu "$1" x=1 test
+	grep && done then export local x=1 done then ${HOME} "$1" readonly awk
+		"$1" | ${HOME} 'quoted text' ${HOME} && &&
+		| "$@" awk sed 2>/dev/null 2>/dev/null local printf done $(pwd) local
+		awk grep ${HOME} echo readonly "$@" sed grep
+	cd | local test /usr/bin "$@" then
+test awk echo done then readonly cd 2>/dev/null cd "$1" 'quoted text' "$@"
+		readonly printf --verbose
+		done ${HOME} && local | && then readonly test 2>/dev/null cd readonly
+export awk --verbose ${HOME} -eu
+		--verbose export x=1 sed ${HOME} test /usr/bin echo "$@" export 2>/dev/null
+		local cd && $(pwd) ${HOME} test /usr/bin grep
+$(pwd) readonly sed local grep test local 'quoted text' test cd readonly awk
+readonly then then /usr/bin sed ${HOME} "$1"
+printf /usr/bin x=1 'quoted text' 'quoted text'
+		grep done ${HOME} | -eu /usr/bin echo ${HOME} then grep local && done awk
+"$@" "$@" printf /usr/bin $(pwd) $(pwd) awk
+test printf done $(pwd) "$1" then /usr/bin then /usr/bin done x=1 x=1
+		"$@" ${HOME} && 'quoted text' test x=1 2>/dev/null
+	--verbose "$@" "$@" printf awk ${HOME} | | grep echo ${HOME} | --verbose
+		done "$@" -eu $(pwd) local export ${HOME} $(pwd)
+		-eu sed --verbose sed -eu local /usr/bin
+		"$@" sed cd 2>/dev/null
+		-eu $(pwd) sed grep 'quoted text'
+	cd 2>/dev/null cd sed 2>/dev/null echo sed grep export /usr/bin then "$1" x=1 ${HOME}
+	readonly then then echo done 2>/dev/null
+	export "$@" $(pwd) local 2>/dev/null export | test sed
+		grep $(pwd) echo printf sed sed && | &&
+2>/dev/null && printf export export printf sed test export
+		/usr/bin cd -eu done "$@" 2>/dev/null --verbose
+	then readonly grep printf 2>/dev/null
+	readonly | $(pwd) echo done 2>/dev/null -eu test /usr/bin
+	2>/dev/null awk -eu "$1" awk && export grep 'quoted text' $(pwd) -eu sed export
+test $(pwd) x=1 readonly "$@" export export
+$(pwd) sed "$1" && 'quoted text' 'quoted text' | | export 'quoted text'
+| 2>/dev/null done "$@" local echo ${HOME} 2>/dev/null
+	x=1 readonly $(pwd) cd cd -eu done | readonly printf x=1 awk --verbose
+		2>/dev/null readonly done sed && --verbose then echo | echo
+	export "$@" export printf 2>/dev/null test "$@" /usr/bin
+--verbose local x=1 && awk done 'quoted text' "$1"
+	printf 'quoted text' printf
+readonly export done echo /usr/bin | -eu sed done 2>/dev/null
+	done --verbose "$@" echo 'quoted text' export "$@"
+		"$@" --verbose -eu grep $(pwd) $(pwd) && echo && echo echo export -eu ${HOME}
+		"$@" echo -eu readonly echo test x=1 awk -eu ${HOME} then
+		| export 2>/dev/null $(pwd) -eu done /usr/bin printf $(pwd) -eu | --verbose
+x=1 ${HOME} 2>/dev/null -eu awk echo --verbose
+	grep x=1 readonly $(pwd) 2>/dev/null echo done x=1 2>/dev/null
+	"$@" --verbose awk readonly local
+printf $(pwd) -eu then printf printf done readonly
+$(pwd) "$@" done test sed 2>/dev/null then | "$@" cd local /usr/bin && test /usr/bin
+		${HOME} 'quoted text' echo
+	echo grep $(pwd) --verbose -eu $(pwd) local awk ${HOME} test grep cd "$1" printf
+x=1 | readonly echo x=1 /usr/bin | x=1 printf "$1"
+		| /usr/bin cd done sed echo readonly done echo /usr/bin /usr/bin export $(pwd)
+	local readonly readonly $(pwd) export --verbose sed 2>/dev/null --verbose
+		-eu done export ${HOME} "$@"
+'quoted text' then x=1
+	"$@" "$@" x=1 grep | 'quoted text' echo echo printf /usr/bin x=1 "$@" x=1
+'quoted text' 2>/dev/null | echo export -eu done 'quoted text' && then 'quoted text'
+		then ${HOME} local sed awk printf cd $(pwd) grep
+		cd test sed sed --verbose then readonly --verbose ${HOME}
+/usr/bin 2>/dev/null local 'quoted text'
+echo done -eu ${HOME} ${HOME} printf | $(pwd)
+&& x=1 x=1 grep --verbose
+		local export "$@" done awk sed awk 'quoted text'
+		"$1" export | 2>/dev/null echo awk 'quoted text'
+"$@" 2>/dev/null readonly
+	"$@" -eu 2>/dev/null 'quoted text' echo 'quoted text' $(pwd) sed
+	export awk /usr/bin --verbose echo | | ${HOME} echo
+		--verbose test done x=1 -eu -eu cd sed done readonly --verbose &&
+		awk awk export | printf "$1" sed "$@" "$@" ${HOME} "$@" "$1"
+/usr/bin local printf "$@" && ${HOME} 'quoted text' "$1" x=1 test
+	test awk printf "$1" test
+	$(pwd) cd grep 2>/dev/null export && --verbose
+	$(pwd) x=1 sed 2>/dev/null cd test
+		readonly printf && readonly | ${HOME} echo
+		"$@" "$@" 2>/dev/null 2>/dev/null
+'quoted text' awk 'quoted text' echo $(pwd) --verbose readonly "$1"
+	${HOME} test test $(pwd) x=1 test awk $(pwd) "$1" cd "$1" "$@" "$1" printf
+	"$1" export done then x=1 'quoted text' ${HOME} $(pwd) -eu -eu awk "$1" printf
+	$(pwd) /usr/bin x=1 readonly grep --verbose export /usr/bin
+		cd readonly $(pwd) then then | $(pwd) echo echo sed sed
+		test local done echo grep -eu done 'quoted text' | awk /usr/bin $(pwd) then
+&& $(pwd) ${HOME} && "$1" echo 2>/dev/null -eu --verbose
+	test -eu /usr/bin awk grep printf echo 'quoted text' "$@" printf echo $(pwd)
+	'quoted text' local cd echo
+		x=1 x=1 /usr/bin "$@" 2>/dev/null printf
+		${HOME} "$@" echo cd 'quoted text' readonly
+	${HOME} sed --verbose --verbose
+x=1 cd cd "$@" x=1 printf cd local cd
+	test cd 2>/dev/null ${HOME} /usr/bin awk
+awk 2>/dev/null printf /usr/bin 'quoted text' printf -eu export
+grep then 2>/dev/null /usr/bin done -eu
+		2>/dev/null sed ${HOME} then local $(pwd) test $(pwd)
+x=1 local echo 'quoted text' "$@" && sed test 2>/dev/null export x=1 && awk
+		cd awk grep | $(pwd) "$1" local done then
+readonly && 'quoted text' 'quoted text' x=1 x=1 'quoted text' x=1 --verbose
+export /usr/bin awk then && ${HOME} /usr/bin
+| done done test printf readonly --verbose
+		awk $(pwd) export readonly
+local "$@" awk --verbose test
+${HOME} | local export then ${HOME} && /usr/bin | awk
+	awk "$@" export 2>/dev/null 'quoted text' grep done then
+	$(pwd) grep then ${HOME} cd
+		x=1 && done $(pwd) /usr/bin "$@" $(pwd) cd then && $(pwd)
+		sed 2>/dev/null printf --verbose awk cd local | -eu
+		awk $(pwd) test export printf $(pwd) -eu sed local done done
+grep printf 'quoted text' done $(pwd) && $(pwd)
+${HOME} echo /usr/bin sed readonly -eu
+	readonly "$@" awk -eu grep 2>/dev/null /usr/bin 'quoted text'
+	local grep "$1" -eu export sed
+	grep local export export /usr/bin &&
+		cd awk /usr/bin && sed test $(pwd) sed local --verbose printf awk
+sed x=1 echo echo $(pwd) /usr/bin cd then /usr/bin grep |
+		local printf export 'quoted text' $(pwd) local -eu
+2>/dev/null "$1" 2>/dev/null test
+	/usr/bin 'quoted text' cd -eu "$1"
+echo --verbose grep cd readonly "$@" -eu echo printf -eu cd cd then $(pwd)
+$(pwd) sed printf --verbose "$1" done export local
+	readonly $(pwd) 2>/dev/null 'quoted text'
+	--verbose /usr/bin $(pwd)
+$(pwd) done -eu $(pwd) x=1 --verbose && test echo x=1 'quoted text'
+		readonly export && test sed cd export
+| "$1" grep 'quoted text' done local export cd sed x=1 2>/dev/null 2>/dev/null
+	grep && cd -eu readonly
+	printf then local x=1 done readonly "$@" readonly export grep /usr/bin
+$(pwd) printf 2>/dev/null local echo echo /usr/bin "$1" awk local export &&
+| && --verbose printf awk && "$1" echo "$@" grep ${HOME}
+	echo $(pwd) -eu readonly done
+${HOME} then done ${HOME} "$@" readonly $(pwd)
+'quoted text' local awk 'quoted text' --verbose local "$@" --verbose cd
+echo readonly cd readonly test echo ${HOME}
+	sed "$1" readonly sed cd x=1 x=1 $(pwd) --verbose awk done && --verbose x=1
+	local echo awk $(pwd) --verbose
+x=1 x=1 ${HOME} | "$@" --verbose
+2>/dev/null sed cd x=1 then then ${HOME} printf /usr/bin "$1" x=1 "$1"
+test 'quoted text' done
+then "$@" awk --verbose ${HOME} x=1 printf printf grep local x=1 "$@" local
+		then local grep export done echo 'quoted text'
+	awk grep grep ${HOME} awk && -eu | export
+	then echo && --verbose $(pwd) --verbose /usr/bin printf
+	/usr/bin printf x=1 readonly grep echo export ${HOME} ${HOME} $(pwd)
+		local then 2>/dev/null $(pwd) cd sed x=1 "$1" | $(pwd) local --verbose
+		local export ${HOME} export grep sed
+'quoted text' $(pwd) $(pwd) "$1" printf cd 2>/dev/null grep
+	| done local printf && x=1 -eu export test 2>/dev/null grep && -eu && cd cd x=1
+	export 2>/dev/null sed ${HOME} && export sed echo sed x=1
+	/usr/bin local ${HOME} 'quoted text' test x=1 ${HOME} "$1" "$1" test
+		cd then && --verbose "$@" test done 2>/dev/null sed export cd --verbose then
+	readonly then sed x=1 readonly local $(pwd) x=1
+${HOME} local export done "$@" awk ${HOME} ${HOME} "$1" 2>/dev/null
+		export export test awk done grep && test /usr/bin cd echo
+'quoted text' x=1 cd printf
+| "$@" /usr/bin readonly printf grep
+		--verbose --verbose cd "$1" export done local printf test -eu /usr/bin
+		&& | export local x=1 grep readonly then | "$1" x=1 test -eu
+| "$1" local $(pwd) cd done test | export local echo grep
+		echo cd done "$@" && test echo test -eu 'quoted text' grep -eu readonly then
+	local x=1 echo readonly done --verbose
+	echo x=1 local $(pwd) local "$@" cd test | sed
+		local grep test echo done test "$@" $(pwd) 2>/dev/null | "$1" done 2>/dev/null
+	"$@" -eu grep grep sed echo done "$@" echo grep test done cd "$@" printf
+		&& 'quoted text' $(pwd) | export -eu -eu cd export local "$1" local
+&& then --verbose printf x=1 "$@" | echo grep test "$1" sed grep 'quoted text' ${HOME}
+grep -eu readonly -eu 2>/dev/null awk cd 'quoted text' done
+		&& done && sed export $(pwd) ${HOME} grep /usr/bin "$1" -eu 'quoted text'
+	then grep --verbose export
+	"$@" -eu ${HOME} printf
+		| readonly "$1" x=1 'quoted text' $(pwd) cd ${HOME} local test
+		--verbose export then export --verbose /usr/bin then "$1" local
+		done $(pwd) export then echo printf ${HOME} 'quoted text' readonly
+		| readonly cd "$@" x=1 && "$@" readonly ${HOME} && local test && local $(pwd)
+		sed printf grep test "$1" readonly
+export sed export awk export then | $(pwd)
+	/usr/bin ${HOME} printf done && export export
+		cd printf x=1 $(pwd) echo
+	$(pwd) then readonly x=1 local
+		--verbose $(pwd) grep | x=1 awk sed "$@" readonly echo -eu cd done done export
+cd /usr/bin x=1 -eu cd
+cd readonly /usr/bin echo cd 'quoted text' printf awk ${HOME} then test
+	local --verbose printf test readonly sed && export 2>/dev/null
+	sed echo && $(pwd) test "$1" sed
+	2>/dev/null awk --verbose awk cd x=1 awk "$1" printf
+		x=1 echo 'quoted text' cd 2>/dev/null cd awk --verbose done sed printf -eu "$1"
+export | x=1 x=1 export --verbose -eu then printf done x=1 "$1" grep echo
+	local grep cd printf readonly grep "$1" /usr/bin | 'quoted text' test grep
+		${HOME} printf then && --verbose export sed cd awk | /usr/bin $(pwd) printf then
+$(pwd) 'quoted text' then 2>/dev/null
+		grep /usr/bin awk echo $(pwd)
+		echo && "$@" 2>/dev/null awk local "$@" --verbose $(pwd)
+sed /usr/bin cd test /usr/bin
+		${HOME} "$1" $(pwd) 'quoted text' /usr/bin grep | && ${HOME} done 'quoted text'
+		&& ${HOME} echo "$1" --verbose "$1" grep "$@" -eu 2>/dev/null
+export readonly "$@" done -eu export cd "$@" -eu
+	readonly | awk /usr/bin sed awk awk test grep | cd echo /usr/bin
+cd then "$1" "$1" --verbose && 'quoted text'
+2>/dev/null "$@" export $(pwd)
+		/usr/bin awk printf sed /usr/bin && export | cd /usr/bin 2>/dev/null | x=1 x=1
+	sed echo x=1 2>/dev/null | $(pwd) done ${HOME} awk then
+	-eu echo | /usr/bin cd /usr/bin grep x=1 test then awk
+	test echo grep --verbose cd awk x=1 sed 'quoted text'
+	grep x=1 -eu awk "$1" readonly
+		"$1" export ${HOME} $(pwd) awk
+	grep grep --verbose readonly "$1" awk "$1"
+readonly "$@" -eu cd sed && grep cd 'quoted text'
+2>/dev/null -eu done then "$@" 'quoted text' && done | cd 2>/dev/null
+		x=1 local "$1" grep sed "$1" sed export --verbose
+	-eu --verbose "$1" readonly ${HOME} test /usr/bin | echo
+	'quoted text' done awk 2>/dev/null export
+		local export --verbose "$@" awk --verbose local test readonly --verbose
+		cd /usr/bin local $(pwd) $(pwd) ${HOME} echo && $(pwd) "$@" "$@" grep
+| /usr/bin test 'quoted text' -eu local /usr/bin "$@" grep cd
+-eu -eu $(pwd) "$1" /usr/bin -eu export
+		test grep 2>/dev/null grep x=1 "$1" export --verbose export awk "$1" test && readonly
+	printf then then x=1 export /usr/bin printf $(pwd) readonly
+		echo done -eu -eu ${HOME} --verbose
+	'quoted text' printf grep --verbose x=1 done "$@" $(pwd) 'quoted text' 2>/dev/null
+	grep test export 'quoted text' | 2>/dev/null
+cd $(pwd) printf cd -eu /usr/bin -eu "$1" 2>/dev/null readonly x=1
+${HOME} sed "$@" 2>/dev/null && /usr/bin test -eu
+		&& 2>/dev/null ${HOME} 2>/dev/null --verbose | sed /usr/bin
+--verbose grep x=1 readonly
+then -eu readonly cd printf "$1" ${HOME} cd grep ${HOME} -eu sed sed
+	'quoted text' /usr/bin ${HOME} then x=1 -eu done x=1 ${HOME} test sed
+		&& /usr/bin /usr/bin local sed done --verbose 2>/dev/null x=1
+		/usr/bin $(pwd) 2>/dev/null && export
+		grep "$@" 2>/dev/null x=1
+		done "$1" cd local x=1 && "$@"
+grep -eu $(pwd) x=1 done x=1 done | then test printf test && export -eu cd ${HOME}
+${HOME} readonly sed grep && $(pwd) local printf
+		echo 2>/dev/null export x=1 "$@" $(pwd) echo then -eu
+--verbose echo printf done ${HOME} "$@" /usr/bin
+	awk "$@" cd done ${HOME} --verbose readonly test done -eu x=1
+	then /usr/bin "$1" readonly
+	"$1" sed printf echo echo
+awk local -eu /usr/bin 'quoted text' $(pwd) 'quoted text' | $(pwd) | $(pwd)
+		| && | 2>/dev/null sed done printf readonly
+${HOME} ${HOME} | printf x=1 /usr/bin local awk 'quoted text' 'quoted text'
+sed x=1 -eu "$1" "$1" then /usr/bin x=1 test
+	cd awk cd test printf printf x=1 --verbose grep done -eu grep $(pwd)
+	&& cd $(pwd) test -eu x=1 "$@" "$@" && | 2>/dev/null local
+'quoted text' "$@" readonly readonly cd "$@" export | export x=1 /usr/bin printf
+	test cd printf echo 'quoted text' test 'quoted text' -eu
+		export echo -eu && readonly "$@" $(pwd) grep | then -eu
+		$(pwd) grep -eu /usr/bin | && "$1" "$@" awk readonly local && echo && local 'quoted text'
+grep 2>/dev/null done 'quoted text' "$1"
+cd "$@" echo ${HOME} then "$@"
+2>/dev/null $(pwd) cd 2>/dev/null
+	--verbose test sed then printf then test printf $(pwd) && sed printf
+		-eu "$1" then echo && ${HOME}
+	${HOME} printf "$1" then "$@" $(pwd) local
+	then cd local 2>/dev/null sed printf awk "$1" --verbose
+x=1 local done && readonly awk sed $(pwd) $(pwd) --verbose
+local awk "$1" x=1 test 'quoted text'
+		readonly echo awk --verbose export
+		cd done --verbose x=1 -eu cd ${HOME} then "$1" $(pwd) printf $(pwd) grep
+	done readonly readonly "$@" | $(pwd) | $(pwd) done sed x=1 awk grep local x=1 echo
+		done && --verbose ${HOME} ${HOME} "$1" readonly
+sed then "$@" test --verbose sed 'quoted text' then | 2>/dev/null x=1 | printf
+	'quoted text' echo grep awk -eu done local 2>/dev/null
+-eu "$1" "$@" then 2>/dev/null -eu local echo $(pwd) done awk echo
+echo local | x=1 done printf done test export
+		test local ${HOME} done cd awk printf ${HOME} -eu
+echo ${HOME} $(pwd) "$@" /usr/bin /usr/bin "$@" | /usr/bin $(pwd) x=1
+grep -eu -eu printf readonly 2>/dev/null
+	2>/dev/null -eu echo awk /usr/bin --verbose local "$1"
+readonly test grep cd done /usr/bin cd && /usr/bin cd local echo
+sed 2>/dev/null printf cd then -eu "$1" grep grep grep -eu cd local -eu
+		grep printf echo ${HOME} readonly 2>/dev/null
+		cd local && --verbose printf then x=1 grep awk -eu echo 2>/dev/null
+		/usr/bin echo | && local
+		${HOME} echo --verbose -eu cd export
+cd test export grep local cd "$@"
+grep printf 'quoted text' x=1 && cd test /usr/bin "$1" ${HOME} printf sed
+	"$1" grep grep done && sed
+done sed $(pwd) export /usr/bin && readonly grep |
+		'quoted text' /usr/bin x=1 readonly
+		cd 2>/dev/null cd cd local x=1 /usr/bin
+--verbose export then $(pwd) ${HOME} 2>/dev/null test
+		cd /usr/bin "$1" "$1" | sed awk
+| --verbose | /usr/bin done cd "$@" /usr/bin test echo --verbose -eu ${HOME}
+	grep export "$@" done 2>/dev/null cd 2>/dev/null | test then "$1" && then | printf
+local "$1" test local 'quoted text' -eu awk awk echo $(pwd) then
+	echo "$@" awk && /usr/bin then -eu -eu sed printf awk --verbose printf
+--verbose && "$1" 2>/dev/null grep | "$@" printf "$@" printf then x=1
+		/usr/bin grep cd 'quoted text' "$1"
+	sed ${HOME} ${HOME} "$@" "$1" 2>/dev/null 2>/dev/null printf sed readonly 2>/dev/null
+	/usr/bin -eu 2>/dev/null grep $(pwd) x=1 cd "$1" sed printf printf ${HOME} | export
+		local awk printf export 'quoted text' --verbose
+| /usr/bin cd && awk 2>/dev/null 2>/dev/null
+'quoted text' echo sed --verbose | ${HOME} -eu test --verbose
+		"$@" && --verbose sed local --verbose $(pwd)
+		$(pwd) && export local "$1" 'quoted text' local 'quoted text'
+		/usr/bin local then awk then local 2>/dev/null x=1 done sed
+echo awk echo "$@" sed awk test 2>/dev/null 'quoted text' printf
+		readonly cd cd then printf /usr/bin local echo echo grep
+	test cd echo test printf
+local "$@" sed -eu "$@" 'quoted text' readonly 2>/dev/null
+	awk 'quoted text' cd test awk sed sed && export readonly
+		printf cd echo grep |
+	awk test | 2>/dev/null readonly
+	grep x=1 cd $(pwd) then grep export
+		--verbose -eu echo echo 'quoted text' x=1 echo $(pwd) && sed | $(pwd) "$1" ${HOME}
+then $(pwd) && --verbose | -eu echo
+grep echo "$@" grep cd grep readonly test
+	$(pwd) grep "$@" grep /usr/bin
+		cd printf "$1" /usr/bin printf readonly
+		${HOME} "$@" -eu | "$@"
+$(pwd) cd 'quoted text' printf awk && | test export cd printf 'quoted text'
+printf "$@" -eu readonly
+	test /usr/bin local -eu test "$1" $(pwd) -eu sed "$1"
+		cd -eu "$@" printf readonly
+	-eu cd && 'quoted text' done 'quoted text' --verbose printf -eu | sed
+	/usr/bin grep x=1 grep /usr/bin --verbose
+		awk "$@" 2>/dev/null then done /usr/bin grep "$@" export test cd /usr/bin
+local grep then && 2>/dev/null "$1" then && printf "$@" | | done local --verbose
+		2>/dev/null --verbose
+		local grep readonly /usr/bin then test &&
+&& local /usr/bin "$1" readonly export done ${HOME} --verbose
+/usr/bin done "$@" $(pwd) --verbose
+awk local ${HOME} then test sed x=1 local && $(pwd) awk
+		done awk x=1 "$@" cd cd test /usr/bin "$@" grep
+		/usr/bin done | ${HOME} --verbose && "$1" /usr/bin
+		cd cd grep sed "$1" && then local
+		done echo "$@" | 2>/dev/null -eu ${HOME} "$@" printf cd $(pwd)
+	grep sed 2>/dev/null test --verbose echo $(pwd) done cd test awk x=1
+export /usr/bin local ${HOME} ${HOME} -eu 'quoted text'
+		&& /usr/bin local 2>/dev/null "$@" done 'quoted text' printf /usr/bin local
+	x=1 local printf | 'quoted text' -eu test | grep "$@" $(pwd) test
+	| done awk readonly 2>/dev/null "$@" test 'quoted text' $(pwd) then
+printf export | awk printf done 'quoted text'
+		| /usr/bin /usr/bin -eu ${HOME} x=1 && awk -eu sed grep /usr/bin grep printf sed
+	test awk 2>/dev/null "$@" readonly
+readonly sed -eu --verbose "$1" 'quoted text'
+	then "$@" grep then readonly
+2>/dev/null then sed export 'quoted text'
+printf "$1" && cd cd cd printf 2>/dev/null done cd done
+	then "$@" then -eu 'quoted text' $(pwd) grep cd --verbose
+	${HOME} awk done | sed export awk x=1 x=1 $(pwd) readonly readonly grep
+2>/dev/null "$@" && awk sed x=1 cd grep sed
+grep $(pwd) --verbose ${HOME} "$@" 2>/dev/null | done export grep x=1 -eu
+		echo $(pwd) awk awk local export 2>/dev/null "$@"
+awk | local x=1 2>/dev/null awk
+awk awk readonly grep 2>/dev/null
+cd sed "$@" sed && "$@" grep | | sed
+"$@" awk awk done $(pwd) /usr/bin "$1" awk && export export grep readonly
+	${HOME} echo "$@" | "$@" printf "$@" export test
+	-eu local cd test x=1 readonly "$@" cd echo cd readonly
+	&& -eu export readonly done then ${HOME} readonly
+${HOME} then echo grep export "$1"
+		/usr/bin echo x=1 echo test sed 'quoted text' /usr/bin grep "$@" $(pwd) "$@"
+		-eu printf -eu done /usr/bin cd test
+test "$1" 2>/dev/null cd test then printf
+--verbose -eu --verbose grep printf -eu x=1 -eu export
+readonly | "$1" cd awk "$1" done cd | export sed then "$1" sed
+		&& 2>/dev/null $(pwd) 'quoted text' |
+		--verbose then 'quoted text' -eu
+	local $(pwd) then grep echo cd sed --verbose x=1 local readonly export grep done
+test awk -eu -eu "$1" 2>/dev/null /usr/bin "$1" 2>/dev/null
+		done x=1 export | --verbose echo printf -eu | $(pwd) 'quoted text'
+	&& -eu sed && printf then 2>/dev/null test ${HOME}
+		readonly "$@" 'quoted text' printf then | awk -eu $(pwd) /usr/bin
+		/usr/bin | 2>/dev/null awk "$@" echo /usr/bin
+		then $(pwd) done $(pwd) "$1" then readonly grep done echo awk awk
+	cd $(pwd) && && cd "$@" ${HOME} readonly $(pwd) "$1" then 'quoted text'
+	| "$@" readonly export $(pwd) test then
+printf "$1" then 2>/dev/null && x=1 | printf $(pwd) x=1 local cd ${HOME}
+	2>/dev/null readonly test echo "$@" grep "$1" x=1 "$@" cd done "$1" "$@"
+	awk awk -eu --verbose "$1"
+echo echo && --verbose then local
+		-eu 'quoted text' done && printf "$1" readonly /usr/bin "$@"
+		${HOME} echo then sed -eu --verbose --verbose
+--verbose local sed test cd /usr/bin grep 'quoted text' export && 'quoted text'
+		echo 'quoted text' then cd awk test "$1" --verbose
+	echo done then | test test 2>/dev/null && "$1" grep then local cd then
+"$1" "$@" 'quoted text' printf cd grep -eu x=1 grep cd ${HOME}
+	local "$1" 'quoted text' export && 'quoted text' local 'quoted text' printf grep
+	sed && grep readonly test sed
+		--verbose --verbose -eu printf
+		/usr/bin 2>/dev/null printf $(pwd) "$1" ${HOME} "$1" -eu
+		grep 2>/dev/null | cd export then $(pwd) 2>/dev/null
+	| "$1" 2>/dev/null | ${HOME}
+readonly test --verbose x=1 'quoted text' cd echo test x=1 /usr/bin readonly echo
+		-eu echo $(pwd) grep 2>/dev/null
+$(pwd) -eu cd then "$1" -eu cd sed readonly test x=1 && /usr/bin 'quoted text'
+	test done test /usr/bin sed 2>/dev/null
+| cd test 'quoted text' --verbose cd 'quoted text' 'quoted text' ${HOME} sed grep
+awk 2>/dev/null local 2>/dev/null "$1" echo awk awk done then cd
+	sed readonly awk --verbose ${HOME} /usr/bin printf x=1 test
+grep test printf && /usr/bin ${HOME} echo sed | done
+	printf x=1 /usr/bin test "$1" then --verbose ${HOME} local
+		--verbose printf x=1 x=1 readonly 2>/dev/null ${HOME} x=1 /usr/bin | &&
+	done "$1" 2>/dev/null test --verbose readonly then
+		export "$@" /usr/bin
+		readonly export | test sed ${HOME} && 2>/dev/null done "$@" 'quoted text'
+	grep local then export export done | "$@" "$@" -eu && sed $(pwd) echo
+		test ${HOME} export done
+		export readonly export /usr/bin -eu local /usr/bin awk done done grep -eu |
+		$(pwd) 2>/dev/null "$1" ${HOME}
+		/usr/bin "$@" export -eu --verbose done 2>/dev/null
+	readonly local readonly local
+	${HOME} -eu export printf $(pwd) && grep local awk 2>/dev/null
+		| ${HOME} cd local echo test done export done 'quoted text' $(pwd)
+	&& sed ${HOME} grep --verbose
+		then && x=1 test awk 2>/dev/null cd local && done $(pwd) local 2>/dev/null awk
+test 'quoted text' 'quoted text' echo 'quoted text' printf export
+/usr/bin printf local 2>/dev/null | | test |
+| export cd done readonly test && printf then --verbose local /usr/bin "$1" readonly
+	export then grep echo && cd ${HOME} readonly grep "$@" cd
+export then cd test | x=1 ${HOME} $(pwd) local printf -eu awk 2>/dev/null
+	--verbose local ${HOME} then 2>/dev/null
+		test echo "$@" 2>/dev/null $(pwd) $(pwd) export test grep x=1 export echo
+	${HOME} "$1" ${HOME} export /usr/bin "$@" printf
+	then export sed $(pwd) printf cd local "$1" test awk && ${HOME}
+		'quoted text' readonly grep $(pwd) echo local done sed
+		--verbose --verbose readonly && local readonly --verbose grep export awk awk awk
+	printf "$@" | "$@" --verbose cd x=1 ${HOME} && grep | 2>/dev/null
+		sed "$@" readonly export done ${HOME} sed
+then sed printf export 2>/dev/null cd "$1" && printf "$@" | local
+local /usr/bin grep done printf
+"$@" -eu /usr/bin ${HOME} sed
+	awk x=1 2>/dev/null local readonly echo | test
+		${HOME} export --verbose "$@"
+sed --verbose "$1" | printf echo --verbose cd | local ${HOME} echo then
+	"$@" "$1" grep && | 2>/dev/null
+| sed sed export 'quoted text' | done -eu export printf
+		/usr/bin readonly awk done done done --verbose local echo
+	${HOME} "$1" sed test 'quoted text'
+	${HOME} --verbose export "$1" $(pwd) "$@" "$1"
+		"$1" readonly cd 'quoted text' 2>/dev/null
+		readonly readonly && 2>/dev/null readonly && readonly "$1" --verbose
+local sed export "$@" readonly "$1" export sed test -eu $(pwd) ${HOME}
+cd "$1" "$1" awk /usr/bin && printf sed test --verbose cd cd local echo
+"$1" sed echo 2>/dev/null | --verbose sed sed
+	$(pwd) then "$1" cd "$@" 2>/dev/null
+grep test -eu x=1 2>/dev/null grep ${HOME} $(pwd) &&
+	cd "$1" awk 'quoted text' 'quoted text' test echo sed -eu cd && "$@" local test
+	/usr/bin export "$@" 2>/dev/null | sed then
+	2>/dev/null | --verbose export
+		"$1" sed grep export ${HOME} printf "$@" sed
+		readonly x=1 "$@" done then readonly
+	${HOME} --verbose $(pwd) --verbose
+	/usr/bin local then readonly local | ${HOME} x=1 then /usr/bin
+		local --verbose $(pwd) && x=1 local 'quoted text' local /usr/bin $(pwd)
+sed test $(pwd) -eu --verbose x=1 "$1" echo local done awk && then
+&& 'quoted text' then export export then local /usr/bin | 'quoted text'
+	awk echo printf && grep 2>/dev/null
+		-eu echo export readonly sed ${HOME} "$1" 'quoted text' -eu
+	&& awk ${HOME} --verbose sed printf printf 2>/dev/null x=1
+"$@" --verbose done local && grep ${HOME}
+	/usr/bin 'quoted text' local done ${HOME} -eu done "$@" then local printf | $(pwd)
+| test local -eu 'quoted text'
+	cd ${HOME} --verbose && 'quoted text'
+	sed && grep echo ${HOME}
+| 'quoted text' grep --verbose then 'quoted text' export "$@" /usr/bin
+${HOME} "$@" "$@" "$@" $(pwd) 2>/dev/null readonly /usr/bin
+	$(pwd) && ${HOME} echo echo x=1 -eu local "$1" local /usr/bin
+	${HOME} awk echo -eu 'quoted text' "$@" --verbose && "$1"
+done /usr/bin "$@" /usr/bin awk then export done readonly ${HOME} 'quoted text'
+	'quoted text' && 2>/dev/null 2>/dev/null readonly x=1 x=1 local
+	"$1" && x=1 done 'quoted text' /usr/bin grep done test
+		--verbose x=1 done cd -eu 'quoted text' awk x=1 echo "$@" done awk
+test export local awk grep echo local echo
+&& --verbose export readonly ${HOME} echo 2>/dev/null
+then sed grep -eu awk local cd | && -eu "$1" -eu sed then
+	"$1" -eu "$@" 'quoted text' 2>/dev/null readonly /usr/bin
+	test ${HOME} 'quoted text' /usr/bin grep test grep export x=1 | test && "$1"
+sed awk cd local done printf sed "$@" ${HOME} printf
+done export awk sed awk local -eu 'quoted text'
+"$1" echo done 'quoted text' test sed then
+		-eu $(pwd) echo /usr/bin grep 2>/dev/null
+	/usr/bin $(pwd) echo x=1 --verbose | x=1 | /usr/bin grep --verbose
+		test $(pwd) $(pwd) "$1" -eu test --verbose 'quoted text'
+'quoted text' 2>/dev/null x=1 echo --verbose -eu printf -eu
+		done readonly --verbose --verbose printf $(pwd) -eu | ${HOME} done echo done x=1
+'quoted text' awk x=1 then /usr/bin && done export echo printf /usr/bin
+		"$@" grep cd test done 2>/dev/null "$@" awk | printf cd "$1"
+		| && /usr/bin -eu -eu ${HOME} x=1 grep test sed grep echo local
+		"$1" printf sed sed awk echo cd printf sed "$1" && readonly printf
+		${HOME} grep grep grep done sed x=1 /usr/bin 2>/dev/null
+	done && export x=1 x=1 then awk ${HOME} export && "$1" export | readonly
+	grep grep $(pwd) --verbose "$1"
+		$(pwd) --verbose ${HOME} readonly awk && grep done test ${HOME} printf awk x=1 test
+		export && awk then echo | then local awk && $(pwd)
+	/usr/bin export 'quoted text' /usr/bin
+	| ${HOME} --verbose /usr/bin && printf export | cd x=1
+	2>/dev/null grep printf --verbose echo printf export readonly local local
+-eu export | -eu /usr/bin ${HOME}
+		2>/dev/null done ${HOME} test printf 2>/dev/null
+test awk /usr/bin done ${HOME} -eu x=1 "$@" echo
+| 'quoted text' done done echo x=1 cd --verbose done local "$1" grep
+		done grep "$1" 2>/dev/null $(pwd) $(pwd) awk | grep "$@" done
+	${HOME} export echo $(pwd) grep cd ${HOME} -eu && 'quoted text'
+		then echo "$@" 'quoted text'
+| ${HOME} then && $(pwd) echo && "$@" -eu 2>/dev/null -eu $(pwd)
+	readonly then | 2>/dev/null printf --verbose test grep /usr/bin done done printf
+		&& "$1" "$1" $(pwd) $(pwd) 2>/dev/null done sed "$1"
+	| "$1" then sed echo && -eu export awk $(pwd) --verbose cd /usr/bin && --verbose
+cd $(pwd) --verbose awk
+		-eu -eu grep -eu | export export printf | export printf
+		"$1" awk | 2>/dev/null awk --verbose "$@" $(pwd) 2>/dev/null -eu
+		export export readonly /usr/bin x=1 sed done
+	/usr/bin | /usr/bin done
+/usr/bin local && readonly "$@"
+		awk then && "$1" done export local
+		--verbose cd -eu local $(pwd) done $(pwd) export
+		${HOME} --verbose 2>/dev/null x=1 -eu
+	&& printf "$@" ${HOME} local ${HOME}
+	-eu -eu "$1" sed "$@" echo 'quoted text'
+	--verbose ${HOME} export printf test --verbose | export printf
+test x=1 cd && ${HOME} $(pwd) "$@" $(pwd)
+	local grep ${HOME} done && cd test |
+		done x=1 x=1 x=1 "$@" $(pwd) | cd readonly 'quoted text' $(pwd) "$@"
+--verbose /usr/bin "$1"
+then /usr/bin ${HOME}
+	"$1" -eu cd --verbose "$@" x=1 | -eu -eu && readonly
+	&& /usr/bin 'quoted text' "$1" export 2>/dev/null awk && ${HOME} awk local
+/usr/bin /usr/bin /usr/bin /usr/bin readonly
+	--verbose export echo then --verbose grep sed test
+		readonly local then local -eu echo /usr/bin --verbose
+	sed 'quoted text' "$1" "$@" then "$1" "$1" | 'quoted text'
+		echo cd 2>/dev/null $(pwd) then ${HOME} /usr/bin x=1
+		2>/dev/null readonly printf echo -eu local cd local readonly && 2>/dev/null
+	| done x=1 "$1" | awk --verbose | 2>/dev/null
+test done local --verbose grep
+	| sed export awk -eu | awk "$1" test 'quoted text'
+	'quoted text' 2>/dev/null /usr/bin | awk echo --verbose test
+		done readonly then x=1 -eu readonly test ${HOME} then test
+		export cd --verbose --verbose
+	then printf "$@" x=1 2>/dev/null
+/usr/bin /usr/bin test 2>/dev/null
+export grep printf cd | test $(pwd) done 2>/dev/null
+		$(pwd) local 2>/dev/null $(pwd) ${HOME}
+	echo local test 2>/dev/null local
+"$@" ${HOME} printf done sed 2>/dev/null | sed ${HOME} && awk
+	echo --verbose ${HOME} /usr/bin printf
+		'quoted text' test grep printf && x=1 $(pwd) cd $(pwd) /usr/bin
+		/usr/bin -eu then printf sed
+	readonly cd cd -eu printf --verbose then
+${HOME} echo test /usr/bin
+	--verbose test echo local readonly sed
+done then readonly -eu readonly | printf 2>/dev/null
+&& 2>/dev/null export cd awk --verbose
+2>/dev/null "$@" then /usr/bin awk echo local -eu --verbose | printf 2>/dev/null
+${HOME} --verbose echo "$1" /usr/bin 2>/dev/null /usr/bin "$@" then x=1
+&& | echo --verbose --verbose echo then test
+--verbose -eu /usr/bin sed readonly readonly 2>/dev/null 'quoted text' grep test
+		sed x=1 grep -eu cd cd x=1 x=1
+		readonly cd sed && 'quoted text'
+--verbose sed $(pwd) /usr/bin "$@" ${HOME} awk 2>/dev/null x=1 'quoted text'
+		sed -eu done sed sed x=1 "$1" 'quoted text' 2>/dev/null export "$@" $(pwd)
+	"$1" -eu export readonly
+	x=1 export local "$1" test test 2>/dev/null -eu readonly
+		local done export 2>/dev/null && /usr/bin "$1" cd | -eu printf then "$1" 2>/dev/null
+	printf sed | "$@" cd ${HOME} /usr/bin "$1" local | printf && export | export
+-eu then local cd $(pwd) sed x=1 'quoted text' --verbose | $(pwd)
+		export && ${HOME} 2>/dev/null 'quoted text'
+		-eu done echo echo "$1" export export ${HOME} | --verbose 'quoted text' ${HOME}
+		printf awk x=1 $(pwd) printf 2>/dev/null
+	'quoted text' | /usr/bin export done /usr/bin 'quoted text' && local -eu
+grep printf 2>/dev/null
+		printf -eu $(pwd) echo $(pwd) local "$@"
+readonly --verbose && --verbose | && x=1 printf grep awk
+sed x=1 then done echo grep 'quoted text' /usr/bin readonly "$1" | --verbose
+sed "$1" printf readonly ${HOME} export then local done awk x=1 $(pwd)
+		local "$@" echo --verbose cd | "$@" then /usr/bin grep done
+	export local test local $(pwd) export /usr/bin | $(pwd) x=1 'quoted text'
+	done local local x=1 --verbose echo x=1 cd | export "$1"
+	local 'quoted text' printf grep x=1 2>/dev/null
+grep --verbose "$@" test
+"$1" printf readonly cd --verbose
+-eu "$1" then 2>/dev/null "$@" -eu
+	-eu export -eu "$@" echo export test ${HOME} x=1
+	$(pwd) awk then 2>/dev/null then x=1 cd awk | test && echo $(pwd) "$@"
+-eu /usr/bin && printf
+	awk && echo done 'quoted text' --verbose
+test echo local cd sed local cd awk done export grep
+	'quoted text' sed "$@" export x=1 echo local ${HOME} test
+awk cd --verbose --verbose
+	/usr/bin readonly | readonly "$@" sed ${HOME} echo
+sed export --verbose awk --verbose echo
+-eu local sed echo -eu ${HOME} x=1 | done echo local | | "$@" 'quoted text'
+	"$1" sed export 2>/dev/null test echo then cd
+x=1 /usr/bin 'quoted text' && printf $(pwd) grep readonly --verbose /usr/bin
+	'quoted text' $(pwd) readonly echo export "$1" "$1" | readonly -eu -eu $(pwd) 2>/dev/null
+		test && | printf -eu printf ${HOME} | test done cd cd x=1 --verbose
+	cd /usr/bin -eu awk x=1 awk then x=1 local
+	"$@" --verbose | printf local "$1" printf cd awk "$@" 'quoted text' cd cd printf
+--verbose /usr/bin test export && sed readonly cd awk 'quoted text' "$@"
+	cd readonly sed test sed -eu | export
+	"$1" /usr/bin then 'quoted text' && local && readonly then x=1 echo
+grep test cd readonly /usr/bin -eu echo export | printf | echo grep grep
+then echo -eu export cd "$1" && done then local sed $(pwd)
+		printf ${HOME} grep && local printf ${HOME} cd printf export | &&
+cd /usr/bin | local then "$1" then -eu echo test x=1 awk "$1"
+printf $(pwd) grep readonly | --verbose 2>/dev/null 2>/dev/null local then cd
+		awk "$1" "$@" ${HOME} grep 2>/dev/null 2>/dev/null && echo "$1" readonly
+		| local local done /usr/bin grep && --verbose
+	/usr/bin /usr/bin cd ${HOME} test test x=1 awk --verbose 2>/dev/null readonly
+	x=1 'quoted text' 'quoted text' test done printf | sed readonly && &&
+	local cd readonly /usr/bin printf "$@" x=1 then $(pwd)
+done x=1 && | "$@" "$@" 2>/dev/null
+	&& grep 2>/dev/null done -eu
+		${HOME} ${HOME} 'quoted text' ${HOME} x=1 then $(pwd)
+x=1 $(pwd) test local echo x=1 local local "$1"
+		-eu echo | echo 'quoted text' sed sed 2>/dev/null 'quoted text'
+		test "$1" printf grep -eu && "$@" 'quoted text'
+	--verbose && sed $(pwd) && 2>/dev/null
+	test echo then grep ${HOME} x=1 test
+	${HOME} "$@" && /usr/bin "$1" printf export ${HOME} 'quoted text'
+sed --verbose "$@" cd ${HOME} | readonly awk --verbose export
+		x=1 readonly /usr/bin then grep ${HOME} cd ${HOME} local then done grep
+	grep | export awk $(pwd) grep 2>/dev/null awk "$1" then
+-eu done readonly export "$1" | -eu done 2>/dev/null readonly 2>/dev/null
+-eu 'quoted text' --verbose
+		test cd "$@" x=1 printf printf
+| cd x=1 ${HOME} 2>/dev/null grep export printf | x=1 printf printf /usr/bin "$@"
+	&& cd echo then export readonly grep 'quoted text' local test local -eu
+awk done then | grep 'quoted text' cd 2>/dev/null
+| ${HOME} readonly "$1"
+"$1" done done done ${HOME} sed ${HOME} "$@" "$@" readonly
+		echo x=1 && readonly test sed grep "$1" cd cd "$@"
+	x=1 x=1 grep export $(pwd) printf ${HOME} | echo "$1"
+		${HOME} && test ${HOME} | printf echo $(pwd) "$@" "$@"
+"$1" echo ${HOME} 'quoted text' /usr/bin "$1" 2>/dev/null test test -eu 'quoted text'
+awk $(pwd) $(pwd) test grep ${HOME}
+		${HOME} readonly sed x=1 -eu 2>/dev/null | && then "$1" done 'quoted text'
+test readonly --verbose "$@" -eu echo printf x=1 "$@" grep sed sed done
+--verbose /usr/bin 2>/dev/null x=1 'quoted text'
+${HOME} done 2>/dev/null grep ${HOME}
+		done then readonly awk done -eu && printf | /usr/bin /usr/bin cd
+grep ${HOME} local export
+	-eu && --verbose grep x=1 'quoted text' $(pwd) | printf sed done $(pwd)
+		| "$@" | then local $(pwd) 'quoted text' test "$@" cd
+	test awk 'quoted text' ${HOME} 2>/dev/null 'quoted text' grep local
+	'quoted text' 2>/dev/null readonly export ${HOME}
+		--verbose echo awk then done ${HOME}
+		$(pwd) echo && "$@" --verbose echo --verbose
+| "$1" 2>/dev/null export cd readonly local 2>/dev/null
+	| local /usr/bin test 2>/dev/null && printf ${HOME} 'quoted text'
+	--verbose cd cd grep readonly export /usr/bin cd echo echo
+	"$@" ${HOME} done then
+	'quoted text' x=1 echo then then grep done
+	x=1 readonly local | printf then 'quoted text' "$1" 2>/dev/null test | export /usr/bin
+		${HOME} local $(pwd) done "$@" "$1" echo export x=1 local echo
+	&& local $(pwd) 2>/dev/null /usr/bin grep test -eu echo "$1" --verbose
+		2>/dev/null then local printf readonly local 'quoted text' done local
+x=1 | test | $(pwd) then cd /usr/bin x=1 sed "$@" && local awk 2>/dev/null
+	then printf 'quoted text' export && done printf $(pwd) then "$1" -eu printf
+	| grep && /usr/bin $(pwd) "$1" 2>/dev/null local export
+&& --verbose -eu "$@" --verbose
+2>/dev/null -eu echo done printf --verbose test $(pwd) "$1" /usr/bin
+		| -eu then local $(pwd) done readonly x=1 local test &&
+"$@" cd done export grep "$1" done -eu then awk then grep --verbose "$@" echo /usr/bin
+	"$@" /usr/bin "$1" ${HOME} | done 2>/dev/null | 'quoted text'
+		awk printf export echo grep test "$@" export sed x=1 printf && "$1"
+	"$1" sed cd then $(pwd) echo -eu sed awk echo -eu ${HOME} "$@"
+'quoted text' readonly 'quoted text' 2>/dev/null
+		then && "$@" then /usr/bin grep
+		2>/dev/null then "$1"
+	'quoted text' grep done echo --verbose
+	| 2>/dev/null done /usr/bin --verbose --verbose
+	echo ${HOME} "$1" 'quoted text'
+	/usr/bin --verbose cd -eu && cd -eu then $(pwd) printf done ${HOME} grep readonly
+		then export x=1 --verbose
+	echo awk 2>/dev/null cd -eu then cd sed printf "$1" printf done "$@"
+/usr/bin readonly "$1" sed -eu $(pwd) --verbose
+		sed test cd | "$1" done awk 2>/dev/null 2>/dev/null printf ${HOME}
+		cd grep -eu readonly 2>/dev/null then echo cd
+		test /usr/bin 'quoted text' ${HOME} --verbose && local then 'quoted text'
+x=1 2>/dev/null echo local sed 'quoted text' echo && then "$@" --verbose grep
+		$(pwd) --verbose test /usr/bin cd ${HOME} cd test $(pwd) grep cd --verbose
+local sed sed export "$1"
+	'quoted text' "$@" 2>/dev/null test --verbose "$1"
+	${HOME} && then sed readonly local
+		x=1 export test printf -eu grep x=1 2>/dev/null |
+readonly export | "$1" /usr/bin x=1 sed export
+cd printf sed readonly export 'quoted text' ${HOME} local readonly
+		done test -eu sed then readonly --verbose
+echo sed --verbose --verbose "$@" printf ${HOME} sed x=1
+sed x=1 grep --verbose "$1" readonly 2>/dev/null
+	awk /usr/bin awk | "$@" local awk && grep
+/usr/bin 'quoted text' "$1" awk cd --verbose grep 2>/dev/null local $(pwd)
+	&& then $(pwd) "$@" "$@" then sed -eu | | printf
+&& readonly $(pwd) "$@" printf
+	echo test | --verbose local done -eu test echo "$1" local $(pwd) "$@" cd "$@" cd
+		local 2>/dev/null x=1
+		awk /usr/bin /usr/bin "$1" 'quoted text' grep sed export --verbose $(pwd)
+	export export printf cd then export && local
+'quoted text' sed echo export ${HOME} 2>/dev/null "$1" --verbose cd $(pwd)
+	test -eu ${HOME} --verbose cd -eu cd 2>/dev/null x=1
+readonly test "$@" x=1 | -eu sed "$1" "$@" --verbose 2>/dev/null
+	then awk readonly $(pwd) awk cd --verbose sed
+		grep "$1" done $(pwd) x=1 grep | readonly && local
+	test $(pwd) printf readonly
+		2>/dev/null 'quoted text' cd --verbose done && cd readonly
+		x=1 readonly sed export
+&& && then ${HOME} export --verbose done echo | 'quoted text' ${HOME}
+	test "$1" awk --verbose "$@" readonly done local then readonly local ${HOME} /usr/bin
+readonly cd 'quoted text' --verbose "$@"
+	$(pwd) awk "$@" printf echo "$1"
+	&& awk 2>/dev/null ${HOME} 2>/dev/null printf ${HOME} export cd ${HOME}
+		readonly x=1 local echo grep --verbose --verbose grep
+	$(pwd) x=1 2>/dev/null "$@" && "$1" ${HOME} -eu x=1 done $(pwd) awk "$@" "$@"
+		local echo --verbose readonly --verbose
+/usr/bin ${HOME} "$@" local && "$1" grep then
+		then cd && cd export 'quoted text' readonly sed /usr/bin test grep
+	local --verbose printf $(pwd) ${HOME} "$1"
+| done 'quoted text' sed sed
+	x=1 awk 'quoted text' printf sed 'quoted text' 2>/dev/null
+		export cd cd grep awk ${HOME} grep
+then cd | sed sed sed export
+/usr/bin x=1 2>/dev/null test export 'quoted text' local --verbose
+"$1" sed test echo 'quoted text' export readonly
+printf then x=1 $(pwd) export | "$@" grep echo
+awk | ${HOME} test && done printf -eu && grep echo && "$1" ${HOME} 'quoted text'
+		local readonly local && 2>/dev/null "$1" then local && cd "$1" "$@" --verbose
+	awk "$@" readonly 'quoted text' grep
+	x=1 2>/dev/null x=1 printf
+		'quoted text' done printf done sed "$@" awk --verbose printf echo
+readonly "$1" export printf 'quoted text'
+	"$1" cd test --verbose cd "$@" echo x=1 -eu
+		test x=1 sed sed grep readonly then $(pwd) && cd local test
+		/usr/bin $(pwd) && local 'quoted text'
+	local readonly then "$@" -eu x=1 echo done printf
+then 'quoted text' 2>/dev/null
+	2>/dev/null x=1 printf awk "$@" echo
+	export then then awk awk local test 'quoted text' grep ${HOME} -eu "$@"
+		done local grep -eu sed sed local sed -eu -eu cd ${HOME} --verbose
+echo --verbose 'quoted text' then
+| done printf 2>/dev/null test $(pwd) /usr/bin 'quoted text' export awk
+	then "$1" test sed "$@" echo $(pwd) done cd -eu "$1" echo /usr/bin
+	readonly test $(pwd) "$1" local then done printf awk -eu printf readonly x=1
+local $(pwd) awk "$@" ${HOME} ${HOME} echo export done printf export done echo
+	printf | local $(pwd) $(pwd) x=1 'quoted text' readonly /usr/bin readonly cd
+	/usr/bin sed 'quoted text'
+		export "$@" local 'quoted text' 'quoted text' readonly printf x=1
+		2>/dev/null awk "$1" && $(pwd) echo readonly ${HOME} --verbose
+	done 2>/dev/null "$@" | then $(pwd)
+	export test export echo x=1 grep readonly test "$@" "$@" then printf "$1"
+--verbose /usr/bin && cd
+echo && 2>/dev/null done printf echo local cd test | ${HOME} 2>/dev/null grep
+	grep test local "$@" sed
+x=1 | | "$1" 2>/dev/null readonly | x=1 && done printf test
+		-eu then echo $(pwd) && ${HOME} $(pwd) --verbose local && x=1 sed test -eu export
+| test grep 'quoted text'
+export -eu | -eu /usr/bin $(pwd)
+	/usr/bin && cd 2>/dev/null $(pwd) $(pwd) printf -eu cd "$@" done
+then x=1 done "$@" sed done ${HOME} local grep x=1 then grep local grep
+		then -eu ${HOME} export $(pwd) /usr/bin | grep printf "$1" export cd
+test echo cd 2>/dev/null && sed done done sed done done ${HOME}
+sed sed | 2>/dev/null awk | printf awk sed && "$1" "$@" test local "$@"
+		--verbose && done 'quoted text' $(pwd) grep
+		-eu local 'quoted text' $(pwd) readonly done
+		${HOME} -eu export local sed ${HOME} echo | sed
+	grep printf echo 2>/dev/null export readonly --verbose 2>/dev/null awk
+		'quoted text' done local ${HOME} printf 2>/dev/null ${HOME} /usr/bin printf
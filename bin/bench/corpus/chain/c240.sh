@@ -0,0 +1,2001 @@
+	$(pwd) awk -eu cd 'quoted text' done printf printf done --verbose
+sed "$1" "$@" /usr/bin cd 2>/dev/null --verbose
+		&& test -eu "$1" "$1" sed then "$@" export
+		printf -eu $(pwd) "$@" printf --verbose echo grep | --verbose sed $(pwd) grep &&
+x=1 ${HOME} sed $(pwd) local local echo cd awk && -eu 'quoted text' local &&
+$(pwd) printf --verbose done "$@" ${HOME} "$@" ${HOME}
+		2>/dev/null sed then --verbose
+"$1" then "$1" -eu sed echo "$@" && cd 2>/dev/null local x=1 $(pwd) x=1 then
+'quoted text' "$1" test sed && awk && cd done test export "$1" echo
+	$(pwd) ${HOME} printf done local | 2>/dev/null sed export
+	2>/dev/null test export echo -eu /usr/bin
+	local grep --verbose 2>/dev/null
+		cd echo export echo -eu cd | cd -eu 2>/dev/null ${HOME} 2>/dev/null
+		| awk /usr/bin ${HOME} 2>/dev/null
+done --verbose printf local "$1" -eu
+		-eu -eu sed $(pwd) "$@" 'quoted text' printf awk done echo x=1 | local -eu
+		-eu "$@" $(pwd) sed ${HOME} "$@" local then printf local printf
+		grep grep cd sed local "$1" -eu grep export ${HOME} $(pwd) sed then cd then
+		then test export sed grep --verbose awk local "$@" echo
+"$1" readonly --verbose done grep
+'quoted text' $(pwd) 2>/dev/null
+	| cd readonly "$@" printf test done
+		grep /usr/bin awk 2>/dev/null
+	export local x=1 --verbose local cd 2>/dev/null local test && done cd
+	/usr/bin -eu --verbose 2>/dev/null
+readonly local --verbose "$@" printf "$@" -eu done
+	cd awk grep printf $(pwd) readonly echo printf done && export
+		${HOME} --verbose done readonly 'quoted text' -eu
+$(pwd) done -eu $(pwd) done local | ${HOME}
+readonly echo readonly x=1 then "$1" | printf /usr/bin test x=1 readonly
+		sed -eu $(pwd) sed readonly export sed echo readonly $(pwd) awk cd | printf
+		"$@" "$@" local printf sed --verbose
+		$(pwd) x=1 "$@" sed /usr/bin then
+2>/dev/null -eu | x=1 && grep export awk then awk && 'quoted text'
+		${HOME} x=1 then printf echo
+x=1 /usr/bin --verbose grep $(pwd) echo
+		echo --verbose && x=1 done --verbose "$@" "$1" "$@" sed 2>/dev/null
+		grep cd "$1" awk /usr/bin grep -eu $(pwd) /usr/bin echo printf
+'quoted text' cd -eu readonly
+		local readonly awk --verbose "$1" "$1" 2>/dev/null /usr/bin echo awk readonly ${HOME}
+		${HOME} export readonly | | "$@" /usr/bin
+	| grep -eu $(pwd) | /usr/bin
+		'quoted text' awk printf --verbose test $(pwd)
+	cd local then then grep done test --verbose
+then cd cd -eu readonly $(pwd) cd printf ${HOME} --verbose
+	&& sed grep sed sed grep x=1
+	/usr/bin awk local done /usr/bin
+	test readonly awk 2>/dev/null ${HOME} cd test /usr/bin
+sed $(pwd) 2>/dev/null
+		&& echo $(pwd) cd /usr/bin 'quoted text' then export
+export then $(pwd) done readonly ${HOME} grep printf -eu
+	sed x=1 printf sed test export test
+$(pwd) --verbose then local ${HOME} 'quoted text'
+		awk test test sed awk awk --verbose done
+| | 'quoted text' && /usr/bin
+	test test done echo done test readonly cd ${HOME} "$@" then done done export
+		done | done 2>/dev/null "$@" grep done x=1 done $(pwd) printf
+	sed local test awk 'quoted text' 'quoted text' | 2>/dev/null
+local cd local -eu sed $(pwd) "$1" local $(pwd) grep $(pwd)
+		export printf then x=1 /usr/bin /usr/bin then echo | done awk "$@"
+		'quoted text' -eu cd then && 2>/dev/null
+	| --verbose printf 'quoted text' cd $(pwd)
+	${HOME} --verbose echo /usr/bin 2>/dev/null sed then --verbose local printf
+	grep 'quoted text' && done 'quoted text' "$1" | test 'quoted text' printf readonly
+	x=1 ${HOME} | export readonly
+test sed && 2>/dev/null
+"$@" sed /usr/bin export /usr/bin
+	printf /usr/bin && x=1 echo printf /usr/bin grep $(pwd)
+		${HOME} && awk sed done | -eu --verbose
+		-eu "$1" export 'quoted text' printf ${HOME} export done readonly "$1"
+		--verbose ${HOME} --verbose test readonly
+	${HOME} sed done cd | sed "$@" --verbose $(pwd) done $(pwd) && 2>/dev/null | done
+	'quoted text' 'quoted text' cd echo test sed "$1" awk ${HOME} done
+$(pwd) sed grep readonly 2>/dev/null echo awk then then readonly awk sed test
+"$1" local 'quoted text' awk sed
+printf x=1 2>/dev/null test "$@" awk printf --verbose "$@" local done |
+	$(pwd) local printf done 'quoted text' "$@" done | /usr/bin
+	2>/dev/null ${HOME} "$@" $(pwd) grep export export awk test
+sed 'quoted text' 2>/dev/null -eu
+		x=1 sed 'quoted text' -eu local
+	'quoted text' 'quoted text' export awk ${HOME} export cd readonly 'quoted text'
+		"$1" sed grep cd done x=1 local then 2>/dev/null done 'quoted text'
+	local done cd done /usr/bin echo 'quoted text'
+	'quoted text' /usr/bin done export 'quoted text'
+'quoted text' /usr/bin awk then 'quoted text' test
+	| "$@" cd && --verbose local readonly 'quoted text' printf local 2>/dev/null
+		awk && then readonly /usr/bin readonly
+	done x=1 2>/dev/null export
+		-eu /usr/bin --verbose printf done $(pwd)
+	$(pwd) x=1 && -eu printf printf ${HOME} then export x=1 /usr/bin
+		grep cd -eu /usr/bin 'quoted text' x=1 'quoted text' 2>/dev/null grep
+	test test export 'quoted text' awk export "$@" readonly -eu -eu "$1"
+done grep /usr/bin ${HOME} x=1 printf 2>/dev/null readonly local
+		echo export ${HOME} sed x=1 echo
+	cd readonly printf echo cd grep readonly ${HOME} x=1
+	local then "$@" test 'quoted text'
+		2>/dev/null printf done && printf sed echo $(pwd) grep done --verbose
+		awk sed printf cd --verbose cd awk --verbose readonly "$1" done | then readonly
+		-eu echo done 'quoted text' -eu -eu
+	| grep && "$@" /usr/bin local printf readonly
+		local readonly grep export $(pwd)
+		export printf done x=1 then readonly
+	test export local $(pwd) grep readonly local x=1 awk --verbose
+		local awk /usr/bin then && awk cd --verbose test export test ${HOME} local
+		echo -eu --verbose | done --verbose
+&& done ${HOME} test awk 'quoted text' readonly $(pwd) -eu echo 'quoted text'
+		then x=1 cd then ${HOME} echo 2>/dev/null cd -eu grep /usr/bin | local
+	printf printf grep -eu sed export then /usr/bin x=1 -eu "$1" sed
+		| printf --verbose grep && awk test local test --verbose echo | && | then "$1"
+		--verbose awk test -eu printf readonly | export sed
+/usr/bin local 2>/dev/null done -eu x=1 then "$@" 'quoted text' readonly
+sed printf -eu local awk "$1" export $(pwd) --verbose $(pwd) 2>/dev/null
+	then --verbose -eu export
+${HOME} | && "$1" "$1" then --verbose then "$@" ${HOME} -eu && then 2>/dev/null
+		"$@" echo "$@" x=1 ${HOME} awk && "$1" -eu $(pwd) $(pwd) /usr/bin
+		then cd $(pwd) /usr/bin $(pwd) ${HOME}
+		${HOME} readonly echo --verbose /usr/bin 'quoted text' ${HOME}
+		readonly grep 'quoted text' readonly --verbose sed ${HOME}
+	echo readonly "$1" export then 2>/dev/null /usr/bin cd "$1" $(pwd) /usr/bin
+		${HOME} "$@" printf 2>/dev/null "$@" printf -eu sed 'quoted text' echo 'quoted text'
+		"$1" done 'quoted text' --verbose
+		&& x=1 /usr/bin --verbose sed export -eu
+		x=1 "$@" echo | local | cd x=1 done grep
+done 'quoted text' awk printf export cd 'quoted text'
+printf printf $(pwd) local -eu "$1" cd printf && printf test "$@" $(pwd) echo
+cd local ${HOME} -eu test readonly echo local cd then --verbose
+		"$@" --verbose printf $(pwd) x=1 readonly echo sed printf "$1"
+	awk $(pwd) -eu grep "$1" local printf /usr/bin 'quoted text' sed "$1" then
+grep --verbose then && local x=1 -eu && sed &&
+		&& "$@" printf && done -eu printf sed | done grep printf | 2>/dev/null
+		2>/dev/null grep done done /usr/bin cd readonly "$1" readonly "$1" "$1"
+echo grep echo 'quoted text' echo then $(pwd) test "$@" readonly "$@" then
+		&& printf sed 2>/dev/null export then x=1 grep local test -eu then
+	/usr/bin $(pwd) --verbose
+/usr/bin "$@" grep "$@" then test | | && cd printf local && 2>/dev/null
+	awk 'quoted text' /usr/bin readonly
+		/usr/bin awk done grep $(pwd) ${HOME} local 2>/dev/null echo
+	readonly "$@" 'quoted text' local cd grep /usr/bin then echo sed --verbose
+		| printf x=1 $(pwd) "$@" grep $(pwd) sed && $(pwd) printf echo
+test cd cd /usr/bin 2>/dev/null 'quoted text' 2>/dev/null $(pwd) sed
+then 2>/dev/null done ${HOME} | awk readonly /usr/bin 2>/dev/null
+"$1" --verbose ${HOME} echo awk grep
+awk ${HOME} --verbose 'quoted text' export | cd awk echo /usr/bin "$@" done
+		x=1 /usr/bin readonly ${HOME} export
+	done 'quoted text' then $(pwd) readonly "$@" && && "$@" readonly
+		cd --verbose ${HOME} && 2>/dev/null
+	echo 'quoted text' | printf x=1 "$1" cd | ${HOME} "$1"
+		sed awk echo grep "$@" /usr/bin 2>/dev/null readonly ${HOME} x=1
+		export local 2>/dev/null -eu test done "$@" awk echo local
+	cd "$1" x=1 grep export $(pwd) $(pwd) $(pwd) readonly
+		/usr/bin done echo grep /usr/bin x=1 $(pwd) 2>/dev/null --verbose sed
+		awk --verbose local awk
+		test -eu 'quoted text' then 2>/dev/null ${HOME} cd cd done export local |
+/usr/bin 2>/dev/null $(pwd) cd test /usr/bin | then
+	printf 'quoted text' export --verbose "$@" then local "$@" grep 'quoted text' cd
+x=1 export -eu -eu x=1 /usr/bin x=1 printf
+echo /usr/bin grep -eu cd && 2>/dev/null x=1 | cd | grep done ${HOME}
+		cd 2>/dev/null done --verbose
+2>/dev/null $(pwd) then x=1 printf
+		'quoted text' | done 'quoted text' $(pwd) cd 2>/dev/null 'quoted text'
+2>/dev/null ${HOME} test local cd readonly ${HOME} x=1 local /usr/bin echo
+		sed grep "$@" $(pwd) awk /usr/bin
+		sed /usr/bin local --verbose
+	printf /usr/bin "$1" | ${HOME} 'quoted text' -eu $(pwd) -eu "$@" done
+	/usr/bin && | && done printf grep $(pwd) local done 2>/dev/null
+	readonly printf awk test
+	--verbose cd && 2>/dev/null sed done $(pwd) grep grep
+	"$@" grep readonly awk grep "$1" 'quoted text' done readonly
+&& test readonly export cd then "$1" ${HOME} 2>/dev/null readonly
+cd test && test "$@" "$1" awk --verbose | 'quoted text'
+| 'quoted text' $(pwd) ${HOME} then awk
+	&& readonly --verbose --verbose readonly sed local
+	--verbose --verbose |
+	sed test -eu test grep done 2>/dev/null -eu test -eu then x=1 readonly readonly
+	--verbose 2>/dev/null | && local "$@" x=1 "$1" local $(pwd) printf
+	sed && echo && echo test ${HOME} "$1" grep $(pwd)
+	done then "$@" -eu test grep printf && export printf then
+		"$1" printf 'quoted text' "$@" "$@" echo
+-eu grep 2>/dev/null /usr/bin "$1" -eu then grep export "$1" test cd
+	printf readonly awk ${HOME} --verbose printf &&
+	--verbose then | x=1 export then grep local sed | /usr/bin
+		awk -eu | test local local cd done "$1" local awk ${HOME} sed ${HOME} printf
+local && echo cd test awk $(pwd)
+	then /usr/bin local printf echo grep then ${HOME}
+	| 'quoted text' x=1 && && readonly
+		'quoted text' export && cd readonly local printf sed /usr/bin cd test 2>/dev/null
+		-eu local 'quoted text' -eu 'quoted text'
+${HOME} "$@" readonly 2>/dev/null "$@" then local "$1" printf
+		-eu readonly ${HOME} | --verbose ${HOME} --verbose
+	awk cd 'quoted text' test test grep -eu sed
+		--verbose x=1 2>/dev/null awk &&
+		cd readonly echo export $(pwd) "$1"
+export 2>/dev/null --verbose && | && "$1" $(pwd) x=1 then /usr/bin
+$(pwd) ${HOME} -eu | 'quoted text' then grep
+	sed && "$1" /usr/bin readonly ${HOME} 2>/dev/null $(pwd) && sed /usr/bin grep echo
+	awk cd echo cd printf "$@" export done
+	readonly "$1" then 'quoted text' --verbose done 2>/dev/null test $(pwd)
+&& $(pwd) cd awk "$@"
+		test && readonly 2>/dev/null cd ${HOME} 'quoted text'
+	| 2>/dev/null done sed x=1 then "$@" then
+	-eu awk done printf -eu "$@" /usr/bin
+		printf then awk done ${HOME} "$@" --verbose readonly readonly -eu export printf
+		echo /usr/bin x=1 cd "$@" local 'quoted text'
+-eu | cd cd /usr/bin awk done
+	${HOME} "$1" --verbose awk local printf done test /usr/bin export
+sed done done /usr/bin awk sed ${HOME} $(pwd) sed grep $(pwd) then
+	then 'quoted text' x=1 --verbose
+--verbose test 'quoted text' local | 'quoted text' 2>/dev/null awk
+echo grep grep echo ${HOME} x=1
+"$1" "$1" 2>/dev/null echo test echo $(pwd) ${HOME} printf
+	$(pwd) 'quoted text' test /usr/bin sed
+	/usr/bin x=1 export && printf
+done --verbose printf test ${HOME}
+		"$@" cd "$@" 'quoted text' | test printf
+	"$@" "$1" done done "$1" x=1 $(pwd) $(pwd) && export "$@"
+'quoted text' /usr/bin $(pwd) /usr/bin "$@"
+		readonly readonly then local test test done 'quoted text' --verbose $(pwd) readonly
+		"$1" test /usr/bin export done echo
+--verbose "$@" printf local
+cd echo printf 2>/dev/null done x=1 then /usr/bin
+		'quoted text' local grep x=1 ${HOME} 2>/dev/null done 2>/dev/null
+readonly ${HOME} sed grep readonly && grep
+--verbose 'quoted text'
+then --verbose readonly local printf ${HOME} -eu 2>/dev/null test done echo ${HOME}
+	/usr/bin cd -eu "$@" printf readonly ${HOME} awk -eu "$1" sed sed -eu
+	done 'quoted text' readonly | && readonly
+		local export cd 2>/dev/null local /usr/bin export
+	grep done sed sed printf $(pwd) grep then ${HOME} sed
+x=1 ${HOME} printf sed $(pwd) | export cd echo
+		| echo /usr/bin test "$@" x=1 "$@" "$1" "$@" then done printf printf "$@"
+	-eu printf && -eu && "$1" cd done 2>/dev/null done -eu $(pwd) $(pwd) $(pwd) awk
+	echo readonly $(pwd) && "$@" export test && sed sed /usr/bin
+		sed 'quoted text' /usr/bin "$@" cd done cd -eu
+cd done then echo readonly --verbose && echo && export local
+		sed "$@" "$@" ${HOME} done
+cd awk export local awk done then echo echo grep
+	local /usr/bin awk readonly done done
+sed then /usr/bin export | sed $(pwd) "$@" then "$1"
+2>/dev/null printf printf grep
+	/usr/bin $(pwd) && && grep then sed done sed local x=1 cd $(pwd) && "$1" /usr/bin
+	echo "$1" local 2>/dev/null
+x=1 awk --verbose "$1" 2>/dev/null ${HOME}
+	$(pwd) readonly then "$1" ${HOME} "$1" cd done awk awk "$1"
+	export export test export x=1 readonly ${HOME} "$1" 2>/dev/null
+readonly done export "$1" $(pwd)
+$(pwd) awk "$@" export then "$1" x=1 -eu /usr/bin local done && && ${HOME}
+		$(pwd) printf export && /usr/bin echo x=1 cd 'quoted text'
+		cd 2>/dev/null "$@" awk && ${HOME} printf 'quoted text'
+	grep "$@" "$1" && printf
+	"$@" && export printf export | 'quoted text'
+		${HOME} "$@" local --verbose x=1 local echo echo cd | $(pwd) -eu
+		'quoted text' then 2>/dev/null sed -eu printf /usr/bin 'quoted text'
+	sed printf local printf x=1 echo test
+	${HOME} "$@" ${HOME} then printf 2>/dev/null done | 2>/dev/null $(pwd) echo readonly
+		--verbose && -eu readonly "$1" -eu 'quoted text' test --verbose
+		$(pwd) 'quoted text' && readonly && 2>/dev/null
+		then awk $(pwd) 2>/dev/null $(pwd) cd --verbose --verbose done
+	$(pwd) readonly local && printf test local x=1 ${HOME} cd 'quoted text'
+local -eu readonly 2>/dev/null |
+grep -eu | "$@" -eu /usr/bin ${HOME} $(pwd) 2>/dev/null
+	readonly | echo 'quoted text'
+2>/dev/null printf | sed echo done "$@" grep --verbose
+		done && "$@" 'quoted text' then grep local cd
+	2>/dev/null -eu printf && 'quoted text' echo test awk x=1 sed /usr/bin
+	test export cd && -eu ${HOME} local readonly --verbose cd | then /usr/bin
+		x=1 sed test cd echo local
+'quoted text' 'quoted text' --verbose cd -eu -eu awk grep echo test echo awk
+then echo --verbose readonly
+		2>/dev/null printf 'quoted text' $(pwd) --verbose
+	test --verbose done grep x=1
+/usr/bin readonly then sed then ${HOME} echo
+	then test $(pwd) x=1 done test && --verbose done then echo cd 'quoted text' local
+	grep 2>/dev/null then -eu x=1 2>/dev/null | --verbose $(pwd) $(pwd) "$1" cd export
+		readonly done --verbose && --verbose
+awk export export "$1" local 'quoted text'
+	"$@" printf echo "$@" done awk grep grep sed 'quoted text'
+sed test 2>/dev/null | grep 'quoted text'
+	grep local ${HOME} &&
+	echo test x=1 local export x=1 $(pwd) sed | echo
+printf && grep export printf $(pwd) export grep export sed echo 2>/dev/null
+	echo readonly awk done 'quoted text'
+sed "$1" "$1" awk x=1 'quoted text'
+		echo local export && cd x=1 --verbose
+printf 'quoted text' 2>/dev/null awk echo printf
+	export done && then test cd $(pwd)
+cd "$1" | local done 'quoted text'
+	x=1 && test awk export grep grep 'quoted text' test export
+		$(pwd) then ${HOME} --verbose 'quoted text' ${HOME}
+	/usr/bin "$@" readonly done -eu
+	-eu cd then | grep awk --verbose ${HOME} readonly
+/usr/bin sed grep export done x=1
+		cd "$@" readonly cd export then export done "$1" && ${HOME} ${HOME} --verbose
+	$(pwd) done 2>/dev/null $(pwd) "$1" | x=1 grep x=1 "$@" then grep "$@" echo
+awk $(pwd) -eu -eu printf /usr/bin readonly test readonly readonly 'quoted text'
+-eu --verbose test "$1" 'quoted text'
+	x=1 ${HOME} echo "$1"
+		test grep | export echo sed x=1 "$1" export readonly 2>/dev/null echo $(pwd)
+	export awk sed test test ${HOME} readonly | cd sed
+	echo "$1" "$@" echo /usr/bin sed && "$1" export grep done
+	2>/dev/null x=1 $(pwd) cd --verbose $(pwd) $(pwd) -eu $(pwd) readonly
+		then echo && 'quoted text'
+		-eu sed $(pwd) readonly -eu 2>/dev/null
+	/usr/bin export sed grep awk echo echo cd awk /usr/bin x=1 local
+		grep printf x=1 echo /usr/bin sed echo cd | "$@" echo 2>/dev/null
+printf sed $(pwd) -eu test sed sed done | 2>/dev/null cd sed 'quoted text'
+	export echo && echo && 'quoted text' done $(pwd) $(pwd) export
+	then printf done export printf grep /usr/bin ${HOME}
+	"$@" 2>/dev/null grep cd test done 'quoted text' "$@" grep cd "$@" /usr/bin
+	$(pwd) -eu printf then export
+| export readonly --verbose cd --verbose then "$@"
+	then awk ${HOME} printf "$@" then | echo /usr/bin
+		-eu sed test && "$1" /usr/bin
+	'quoted text' -eu 'quoted text' "$1" "$1" --verbose done sed done done --verbose
+		local echo 'quoted text' then "$1" ${HOME} | ${HOME} echo done --verbose cd ${HOME}
+		${HOME} awk awk readonly "$@" sed --verbose local | && "$@" | | 'quoted text'
+	| grep $(pwd) && | "$1"
+	export export -eu 2>/dev/null x=1 /usr/bin local printf local printf --verbose
+local x=1 printf done | $(pwd) /usr/bin done readonly "$1" cd grep then
+	"$1" ${HOME} awk 'quoted text' 'quoted text'
+	&& | sed x=1 'quoted text' awk cd $(pwd) sed && $(pwd)
+sed done grep readonly && 'quoted text' printf /usr/bin x=1 "$@" ${HOME} sed
+		x=1 readonly grep | 2>/dev/null readonly
+sed sed done printf test sed -eu cd
+	local readonly export | cd 'quoted text'
+	"$@" printf ${HOME} printf && /usr/bin cd then -eu 2>/dev/null --verbose readonly
+	2>/dev/null echo $(pwd) readonly readonly 'quoted text'
+	local -eu "$1" local grep cd export | sed local /usr/bin test x=1 /usr/bin /usr/bin
+-eu | readonly --verbose echo /usr/bin $(pwd) sed test 2>/dev/null test
+$(pwd) printf -eu --verbose 'quoted text'
+	${HOME} sed | x=1 x=1 sed && cd cd
+echo | x=1 | echo printf awk sed test && ${HOME} cd awk
+	done local export sed grep then "$1" echo echo readonly
+then "$1" 'quoted text' 'quoted text' grep printf cd readonly
+export local 'quoted text' done 2>/dev/null && printf | awk ${HOME} 2>/dev/null
+done test sed $(pwd) ${HOME} | | && done $(pwd) --verbose
+	-eu /usr/bin -eu "$@" $(pwd) 'quoted text' then "$1"
+readonly grep then printf 2>/dev/null cd $(pwd)
+		2>/dev/null | local test export
+	grep echo done -eu done echo -eu ${HOME} echo && then awk
+		x=1 sed test x=1 ${HOME} sed -eu echo echo 'quoted text'
+	readonly awk "$1" x=1 "$1" $(pwd) -eu -eu | --verbose
+	sed done test echo test then 2>/dev/null "$@"
+&& export then echo ${HOME}
+	grep export /usr/bin test grep && /usr/bin "$1" "$1" 2>/dev/null then
+		done ${HOME} --verbose --verbose 'quoted text' x=1
+		cd /usr/bin printf 2>/dev/null sed export sed local test export done 'quoted text'
+		&& echo "$1" test export grep done "$@" done 2>/dev/null
+local ${HOME} x=1 then "$1" $(pwd) && test $(pwd) grep echo x=1 readonly
+	readonly -eu awk x=1 readonly readonly x=1 sed $(pwd) ${HOME} $(pwd) grep /usr/bin
+	2>/dev/null cd sed && export printf test readonly "$@" done 2>/dev/null cd
+"$@" -eu readonly 'quoted text' /usr/bin /usr/bin | awk sed
+		&& /usr/bin grep local
+"$1" -eu "$1" 'quoted text' "$@" awk grep readonly
+done sed done then grep -eu -eu cd readonly cd /usr/bin local printf then
+	export test grep && then then ${HOME} x=1 done "$1" 'quoted text' "$@" | x=1
+		&& ${HOME} "$@" done grep 'quoted text'
+	readonly $(pwd) 'quoted text' awk echo done printf sed
+/usr/bin echo awk && local -eu export then grep printf --verbose
+test printf && readonly | "$@" 'quoted text' then test "$@" $(pwd)
+done printf export ${HOME} 2>/dev/null grep | echo grep 'quoted text'
+grep printf export x=1 readonly
+		"$@" 2>/dev/null | export sed test printf x=1 "$1" sed test | readonly /usr/bin
+echo --verbose export 2>/dev/null && then x=1 --verbose awk printf "$@"
+	then export echo export then "$1"
+done echo ${HOME} test local -eu export 'quoted text'
+		'quoted text' sed "$@" && "$1" && readonly "$@" done 2>/dev/null "$@" echo
+	-eu ${HOME} /usr/bin readonly
+		cd done cd sed && $(pwd) test echo printf $(pwd) x=1 done -eu cd local 2>/dev/null
+		printf $(pwd) printf echo echo | 'quoted text'
+x=1 printf && /usr/bin -eu cd done 2>/dev/null ${HOME} printf local readonly
+		-eu echo -eu echo test 'quoted text' | sed ${HOME} cd
+--verbose awk && x=1 awk x=1 cd local cd test echo test local --verbose
+		2>/dev/null ${HOME} test "$@" readonly awk
+	${HOME} | echo sed local readonly
+		&& 2>/dev/null printf "$@" grep sed echo | 'quoted text'
+readonly /usr/bin "$1" awk cd
+test --verbose -eu "$1" ${HOME} test test "$1" -eu
+	$(pwd) sed export readonly --verbose cd
+	awk && "$@" $(pwd) done "$1" echo /usr/bin then && done local x=1
+	x=1 2>/dev/null printf local 2>/dev/null export x=1 sed local awk
+	then --verbose grep "$@" 2>/dev/null awk x=1 | 2>/dev/null ${HOME}
+test echo awk sed awk local /usr/bin printf /usr/bin awk readonly
+		| ${HOME} test grep | | printf then awk --verbose cd "$1" grep --verbose
+		printf echo cd awk then echo export test /usr/bin 'quoted text' echo
+"$1" then awk ${HOME} export x=1 --verbose awk echo sed 'quoted text' readonly
+	then readonly && -eu grep printf -eu
+	"$1" test && /usr/bin ${HOME} printf test test $(pwd) "$1"
+echo awk done test awk $(pwd) /usr/bin echo --verbose -eu printf &&
+		readonly x=1 local cd "$@" $(pwd) grep readonly "$@" 2>/dev/null readonly -eu test
+		'quoted text' printf | test grep "$1" grep $(pwd) test &&
+		${HOME} x=1 | awk 2>/dev/null grep
+	echo then then "$@" --verbose -eu x=1 awk | "$@" sed printf grep readonly printf
+&& printf "$1" && readonly export test --verbose "$@" 'quoted text'
+	x=1 echo "$1" | && | $(pwd) /usr/bin readonly -eu then awk ${HOME} sed readonly
+		cd "$@" sed ${HOME} echo 'quoted text'
+		done local "$@" local done --verbose awk && 2>/dev/null
+		x=1 sed "$@" echo grep "$1"
+	"$1" awk && then readonly 'quoted text' local grep x=1
+		grep "$@" 2>/dev/null --verbose export --verbose "$@"
+grep test cd export | 'quoted text' "$1" --verbose cd && "$1" awk then readonly
+	export done echo awk -eu --verbose awk cd /usr/bin readonly
+x=1 && awk 2>/dev/null -eu && 'quoted text'
+		${HOME} /usr/bin readonly | printf "$1" /usr/bin
+cd 2>/dev/null done readonly "$@"
+${HOME} echo x=1 awk local $(pwd)
+	'quoted text' sed /usr/bin 2>/dev/null $(pwd) test then | && ${HOME}
+	"$1" "$1" then ${HOME} --verbose $(pwd) printf --verbose echo ${HOME} -eu printf
+	'quoted text' test local test && 2>/dev/null -eu
+		awk awk "$1" printf -eu grep local local && done /usr/bin "$1" test
+		cd sed 'quoted text' test 2>/dev/null "$@" done "$@" awk local grep 2>/dev/null
+	2>/dev/null "$1" && "$1" /usr/bin echo "$@" readonly $(pwd)
+local /usr/bin -eu grep cd printf cd printf "$1" export
+	&& grep "$1" awk -eu printf 'quoted text'
+	cd then cd "$@" printf --verbose $(pwd) /usr/bin
+	'quoted text' cd x=1 | done "$1" && ${HOME} x=1 && x=1 ${HOME} && then
+${HOME} $(pwd) echo done 'quoted text' sed x=1 ${HOME} grep readonly done
+sed $(pwd) grep done readonly x=1
+test echo "$@" done grep done x=1
+		done ${HOME} /usr/bin 'quoted text' cd cd ${HOME} printf ${HOME} readonly &&
+		&& readonly grep $(pwd) --verbose $(pwd) test then echo --verbose cd readonly
+		/usr/bin awk local ${HOME} | x=1 x=1 --verbose $(pwd) printf ${HOME} "$@" printf
+	sed "$@" awk -eu awk /usr/bin 'quoted text' local ${HOME} 'quoted text' --verbose
+		"$@" /usr/bin echo readonly
+	grep | awk echo x=1 /usr/bin
+	/usr/bin printf awk readonly test $(pwd) /usr/bin
+		'quoted text' readonly cd --verbose sed local $(pwd)
+echo "$1" x=1 readonly /usr/bin 'quoted text' echo 'quoted text' && echo -eu "$1"
+	echo grep cd $(pwd) /usr/bin done export &&
+echo awk && 2>/dev/null test && grep grep x=1 test sed "$1" grep grep
+		-eu printf | | printf done test $(pwd) printf &&
+	printf "$1" && readonly readonly
+-eu ${HOME} cd readonly local cd local then echo sed --verbose ${HOME} done
+	awk done 2>/dev/null export $(pwd) local x=1 "$1" /usr/bin
+	awk export 'quoted text' printf -eu test $(pwd) 2>/dev/null 'quoted text' 2>/dev/null
+"$@" "$@" x=1 'quoted text' then 'quoted text' then readonly sed | printf
+		sed awk local export "$@" grep awk export "$@" echo readonly 'quoted text' echo
+		2>/dev/null grep local then test --verbose && x=1 grep then "$@"
+	awk | "$1" awk done "$@" $(pwd)
+	--verbose --verbose done awk $(pwd) test printf local -eu export
+	--verbose 2>/dev/null done test
+		"$@" awk /usr/bin -eu awk x=1 test && /usr/bin
+echo readonly 'quoted text' test && "$@" sed
+	cd --verbose 2>/dev/null 'quoted text' $(pwd) done done
+		2>/dev/null 2>/dev/null -eu x=1 readonly local
+		cd export local -eu 'quoted text' echo "$@" then "$1"
+echo --verbose x=1 | local && --verbose x=1 'quoted text'
+	test x=1 test ${HOME} local then echo local 'quoted text'
+	then done local $(pwd) sed -eu local /usr/bin 2>/dev/null -eu -eu sed 'quoted text'
+/usr/bin export 2>/dev/null x=1 cd /usr/bin 2>/dev/null sed then
+		awk "$@" echo && $(pwd) $(pwd) "$1" awk awk cd then
+${HOME} sed then && cd x=1 sed 2>/dev/null local done then done "$@" grep
+	2>/dev/null 2>/dev/null sed "$@" ${HOME} -eu $(pwd) ${HOME}
+	$(pwd) -eu ${HOME} awk export ${HOME} then test | cd export sed cd cd done
+		"$@" cd local 'quoted text' "$1" "$@" printf
+	local test then x=1 'quoted text' awk awk | 'quoted text' && $(pwd) export
+		awk 2>/dev/null --verbose $(pwd) $(pwd) readonly "$1" &&
+	'quoted text' 'quoted text' ${HOME} local
+printf 'quoted text' echo && cd && "$@" "$1" done echo cd x=1 then printf export
+		2>/dev/null "$1" --verbose local
+	2>/dev/null echo -eu ${HOME} --verbose
+2>/dev/null 'quoted text' 'quoted text' then 2>/dev/null
+&& done grep sed export "$@" then 'quoted text'
+	2>/dev/null printf x=1 echo then $(pwd) /usr/bin printf "$@" 'quoted text'
+'quoted text' readonly | "$@" cd done
+	"$@" done -eu export | cd
+	$(pwd) printf cd echo $(pwd) test "$@" local /usr/bin cd local readonly
+	&& then readonly echo echo awk export /usr/bin local "$@" test awk x=1 echo export
+		echo sed done ${HOME} grep local export cd 2>/dev/null
+	cd export grep "$@" ${HOME}
+		done printf $(pwd) then "$@" x=1 2>/dev/null | "$1" local
+		export 'quoted text' test x=1 ${HOME} cd | then /usr/bin
+		--verbose test /usr/bin ${HOME} then local --verbose
+	| cd "$1" "$1" -eu cd grep
+"$1" then /usr/bin cd ${HOME}
+		"$@" local test /usr/bin readonly done grep ${HOME} -eu --verbose "$@" && 'quoted text'
+cd "$1" | echo | export printf 2>/dev/null echo && && && sed
+sed 2>/dev/null x=1 /usr/bin
+--verbose awk done -eu -eu "$@"
+	sed awk awk -eu 'quoted text' readonly "$@" -eu && test awk
+cd cd printf && "$@" awk echo local
+x=1 ${HOME} sed -eu "$1" readonly ${HOME} test -eu -eu ${HOME} "$@" 'quoted text'
+"$@" --verbose test then cd 2>/dev/null readonly /usr/bin awk
+	-eu && export awk grep --verbose ${HOME} ${HOME} echo
+'quoted text' ${HOME} /usr/bin --verbose && done "$1" local grep
+	&& -eu readonly local test --verbose /usr/bin
+echo local done "$1" "$@" --verbose grep | | printf ${HOME}
+	cd export x=1 'quoted text'
+		grep "$1" then then sed
+		"$@" x=1 readonly grep /usr/bin test "$@" then cd grep 2>/dev/null readonly test
+then | | "$@" export 2>/dev/null 'quoted text' done grep awk
+sed 'quoted text' awk then then /usr/bin then cd | | cd 'quoted text'
+export then --verbose && "$@" x=1 then 2>/dev/null | then cd done | --verbose
+		then awk done /usr/bin 2>/dev/null grep 'quoted text' export 'quoted text' done
+	then "$@" done done test "$@" 'quoted text'
+		--verbose -eu echo done "$@" | $(pwd) "$1" | printf cd cd echo awk then x=1 awk
+$(pwd) done -eu 2>/dev/null done grep
+printf readonly then local sed -eu "$1"
+"$@" $(pwd) sed grep then $(pwd) done test cd test ${HOME}
+test local --verbose 2>/dev/null "$@" grep
+		| --verbose export "$1" awk x=1 local 'quoted text' then
+"$1" ${HOME} && 2>/dev/null test then local
+awk 2>/dev/null awk --verbose echo ${HOME} readonly && | "$@" ${HOME} test
+	--verbose test local ${HOME} 'quoted text'
+		'quoted text' awk done "$@" export grep grep export 2>/dev/null
+grep x=1 /usr/bin printf
+"$@" ${HOME} done && && 'quoted text' printf -eu export export x=1 -eu awk
+awk cd 2>/dev/null cd then | then export ${HOME} cd echo then
+		export grep 2>/dev/null --verbose grep | awk done readonly
+		${HOME} printf local ${HOME} grep awk ${HOME} $(pwd) x=1 "$1" ${HOME} local
+		-eu "$1" 'quoted text' $(pwd) grep then printf readonly
+		readonly readonly readonly "$@" grep echo x=1 2>/dev/null -eu 2>/dev/null
+awk x=1 printf local cd ${HOME} done awk 'quoted text'
+cd local sed grep done cd echo done awk done
+&& /usr/bin awk --verbose export
+2>/dev/null cd printf cd local then export
+test local sed $(pwd) && sed local 2>/dev/null $(pwd) && export $(pwd)
+--verbose "$1" grep x=1 $(pwd) | then
+awk local export 2>/dev/null
+		--verbose && ${HOME} $(pwd) -eu && awk "$@" printf ${HOME}
+		"$1" echo "$1" "$1" "$@" x=1 $(pwd) "$1" done awk 'quoted text' "$1" echo
+		local local 2>/dev/null $(pwd) && -eu | grep
+		awk --verbose export "$1" "$@" then sed x=1
+		cd cd | then printf && -eu sed
+	"$1" 'quoted text' -eu echo && cd -eu "$1" done then
+		'quoted text' grep -eu local /usr/bin 'quoted text'
+	"$@" "$1" 2>/dev/null 2>/dev/null
+		printf local local local cd printf
+done readonly "$1" test 2>/dev/null
+	x=1 -eu 2>/dev/null $(pwd) export cd cd then x=1 grep "$1"
+	&& /usr/bin test | local
+echo echo -eu x=1 ${HOME} $(pwd) sed printf export /usr/bin grep "$@" ${HOME}
+	export cd "$@" readonly local | sed cd ${HOME}
+		printf then ${HOME} "$1" -eu echo && x=1 && export readonly /usr/bin done
+		printf readonly -eu ${HOME} 2>/dev/null then awk /usr/bin sed -eu -eu
+	local echo then echo sed "$1" --verbose local "$1" then awk local && ${HOME}
+/usr/bin "$@" 2>/dev/null awk && done awk -eu $(pwd) |
+then && readonly && export "$@"
+		printf cd sed sed ${HOME}
+	"$@" done x=1 grep echo -eu
+		2>/dev/null -eu export --verbose local grep
+	awk echo test cd ${HOME} printf sed then x=1 sed 'quoted text' --verbose x=1 'quoted text'
+		x=1 then export "$@" $(pwd) 2>/dev/null awk -eu then local sed 2>/dev/null
+		/usr/bin 2>/dev/null -eu done
+	| | | awk awk -eu 2>/dev/null 2>/dev/null test ${HOME} echo /usr/bin /usr/bin cd
+export then && local then echo | readonly readonly grep then
+	${HOME} sed awk then printf test export | "$@" 'quoted text'
+awk $(pwd) 2>/dev/null "$@" printf -eu 'quoted text' | --verbose
+	2>/dev/null -eu x=1 | printf export /usr/bin
+grep then -eu | local export readonly
+		/usr/bin done export 2>/dev/null
+		readonly test then readonly then sed "$1" 2>/dev/null export && local "$1" /usr/bin
+test /usr/bin cd then "$1"
+		'quoted text' echo done echo cd awk sed local $(pwd) export 2>/dev/null
+		awk 2>/dev/null && local echo && cd | -eu ${HOME} 2>/dev/null 'quoted text'
+	"$@" cd sed local $(pwd) echo local && awk awk grep "$@" done readonly
+	&& echo | ${HOME} test test 2>/dev/null && x=1 x=1 then local sed
+	--verbose awk test --verbose ${HOME} cd "$1" echo awk
+		-eu cd echo done "$1"
+	${HOME} sed x=1 /usr/bin export x=1 local
+readonly cd | printf && awk | | $(pwd) /usr/bin done ${HOME} $(pwd) ${HOME} |
+${HOME} x=1 local /usr/bin echo
+		/usr/bin then | 'quoted text' export "$1" test /usr/bin test x=1 |
+	"$@" echo 2>/dev/null 2>/dev/null
+		grep | $(pwd) printf grep echo ${HOME} done | cd --verbose
+	cd && echo test x=1 awk local | export local --verbose readonly grep printf
+	then | test cd done $(pwd) grep ${HOME}
+	echo export 'quoted text' 2>/dev/null
+${HOME} x=1 "$@" | $(pwd) "$1" readonly echo -eu then test readonly 2>/dev/null
+		awk cd sed readonly | 'quoted text' -eu readonly
+/usr/bin echo "$@" "$@" /usr/bin "$@" 2>/dev/null
+$(pwd) sed 'quoted text' export 2>/dev/null "$@" -eu grep
+cd | awk "$1" "$@" "$@"
+		cd test cd "$@" local grep export readonly done $(pwd)
+	then -eu export done grep x=1 ${HOME} ${HOME}
+	cd -eu awk printf $(pwd) readonly
+	-eu ${HOME} /usr/bin $(pwd) --verbose $(pwd) 2>/dev/null
+	printf && grep then "$1" export printf done cd -eu export 2>/dev/null --verbose
+	-eu printf readonly awk test sed 'quoted text' --verbose readonly | 'quoted text'
+		/usr/bin "$@" done grep test ${HOME}
+	/usr/bin && -eu local x=1 export "$@" echo readonly --verbose test --verbose
+readonly cd ${HOME} -eu readonly "$@" grep
+		"$1" && cd cd -eu $(pwd) cd export
+		then cd echo | readonly "$@" local grep cd readonly cd local "$1" done echo
+then --verbose | -eu && echo
+		'quoted text' done then x=1 2>/dev/null $(pwd) sed then test
+${HOME} 2>/dev/null && awk 'quoted text' && readonly cd 2>/dev/null --verbose
+	test "$1" echo && done awk grep 'quoted text' then echo done then "$@" $(pwd) test
+		export awk grep printf readonly readonly done cd sed
+	awk sed $(pwd) 'quoted text' echo done x=1 cd awk /usr/bin
+		--verbose printf /usr/bin test &&
+'quoted text' export ${HOME} grep && printf test done readonly echo -eu /usr/bin
+--verbose printf sed -eu -eu 'quoted text' && /usr/bin ${HOME} echo
+		awk x=1 echo printf "$1" export -eu echo echo cd --verbose
+echo local sed done -eu then export done export echo "$@" local "$@"
+		echo --verbose done printf test 2>/dev/null
+		readonly /usr/bin /usr/bin printf && awk test test
+		'quoted text' then && cd
+	"$@" -eu grep readonly echo $(pwd) cd x=1 --verbose
+	--verbose --verbose | sed grep grep
+		/usr/bin -eu then "$1" /usr/bin printf
+		--verbose test $(pwd) "$@" awk ${HOME} then cd /usr/bin -eu $(pwd) then
+	awk /usr/bin /usr/bin done cd "$1" echo
+export export | --verbose "$@" x=1 "$@" then --verbose $(pwd)
+	grep | "$1" && grep 2>/dev/null test sed test ${HOME} awk sed
+	"$1" sed -eu readonly readonly printf && "$1" ${HOME} grep
+echo export readonly -eu grep --verbose echo "$1"
+	printf "$@" ${HOME} && then |
+		grep echo echo done ${HOME}
+done sed | 2>/dev/null
+/usr/bin cd && done printf "$1" --verbose "$1" && awk test awk ${HOME} export
+	echo 2>/dev/null readonly 2>/dev/null awk test -eu test grep printf
+| cd --verbose readonly 2>/dev/null export test x=1 export -eu awk 'quoted text'
+	"$@" test "$1" test ${HOME} grep
+		readonly awk "$@" cd readonly --verbose
+	--verbose sed grep awk 2>/dev/null
+	awk /usr/bin "$1" ${HOME} grep 'quoted text'
+export $(pwd) $(pwd) local cd readonly test local test --verbose export then cd
+	sed printf cd cd then "$@" 2>/dev/null
+${HOME} && export echo 'quoted text' test echo /usr/bin grep
+	then awk grep && readonly echo | test $(pwd) printf
+		export then ${HOME} 2>/dev/null | && printf awk |
+	readonly ${HOME} awk -eu test -eu /usr/bin test /usr/bin export ${HOME} readonly
+		&& grep export 'quoted text' test then 'quoted text' then done 2>/dev/null | awk
+| $(pwd) done "$1" -eu
+$(pwd) $(pwd) ${HOME} echo echo grep printf "$@" then
+		sed awk local echo -eu test printf cd && -eu
+${HOME} "$1" ${HOME} "$1" x=1 echo cd test x=1 then | --verbose
+then echo && test "$1" test then export printf |
+	awk echo "$1" sed ${HOME} --verbose -eu awk 2>/dev/null export ${HOME} sed --verbose
+"$1" --verbose test x=1 export test cd 2>/dev/null readonly ${HOME} sed -eu grep
+&& readonly done then readonly
+--verbose export ${HOME} cd 'quoted text'
+	--verbose printf then -eu -eu test sed --verbose grep
+cd --verbose export --verbose test -eu echo cd awk $(pwd) && sed
+		&& $(pwd) x=1 ${HOME} && grep printf test grep export 2>/dev/null
+--verbose | 2>/dev/null local
+	${HOME} then readonly && /usr/bin printf readonly cd -eu x=1 local -eu
+	grep ${HOME} then /usr/bin echo "$@" echo printf ${HOME} grep | test readonly
+	'quoted text' cd | awk then /usr/bin sed | sed --verbose --verbose sed
+		export "$@" && "$@" sed 2>/dev/null --verbose
+	grep echo && sed "$1" && "$1" | printf
+	/usr/bin "$1" | | awk $(pwd) sed --verbose echo 2>/dev/null
+		-eu echo then 'quoted text' printf && grep local && --verbose printf 2>/dev/null
+		export ${HOME} ${HOME} && ${HOME} ${HOME}
+	x=1 $(pwd) x=1 $(pwd) local readonly | echo done test export sed grep
+	sed done cd "$1" | -eu
+	${HOME} grep 'quoted text' done awk $(pwd) | test x=1 local readonly -eu done
+	${HOME} && readonly awk -eu -eu then then
+		echo done 'quoted text' export
+		done 2>/dev/null local | x=1 awk $(pwd) && then cd grep 2>/dev/null
+	readonly awk done test done
+	sed local echo ${HOME} | test && export sed echo cd awk | "$1" $(pwd)
+${HOME} export x=1 export /usr/bin /usr/bin
+	local 'quoted text' 'quoted text' 2>/dev/null && | awk printf
+	test -eu readonly export export -eu &&
+		then "$1" sed x=1 --verbose
+test ${HOME} readonly local done awk sed
+"$1" ${HOME} /usr/bin ${HOME} echo local ${HOME} x=1 then then printf -eu
+		local echo sed 2>/dev/null
+	&& local sed local ${HOME} $(pwd) sed readonly awk /usr/bin printf
+"$@" $(pwd) $(pwd) 2>/dev/null grep awk awk readonly
+		--verbose "$@" x=1 local readonly cd then awk test "$1"
+export | sed readonly $(pwd) && local export x=1 awk $(pwd) done awk
+done 2>/dev/null 'quoted text' 'quoted text' local && --verbose
+export cd sed test -eu readonly
+	"$@" ${HOME} ${HOME} sed
+		'quoted text' echo grep 2>/dev/null then --verbose readonly x=1 $(pwd)
+	local "$1" cd grep -eu local echo export
+printf export /usr/bin 2>/dev/null sed
+printf done local -eu sed test sed sed readonly test ${HOME}
+"$1" "$1" && test ${HOME} | "$@" "$@" && $(pwd)
+printf 'quoted text' export test "$1"
+	cd sed sed "$@" ${HOME}
+| --verbose awk x=1 'quoted text' x=1 export printf --verbose | && "$1" "$1"
+	"$1" sed echo && $(pwd) && test /usr/bin ${HOME} grep export export
+		x=1 && $(pwd) awk -eu grep then grep 'quoted text' 'quoted text' 2>/dev/null
+		&& "$1" && $(pwd) x=1 "$1" done $(pwd) --verbose
+2>/dev/null awk --verbose test local x=1 /usr/bin cd cd export &&
+then -eu grep && "$@" 'quoted text' echo
+&& x=1 x=1 $(pwd) test printf | grep export done
+		/usr/bin && ${HOME} "$@" done 'quoted text' export printf
+		echo grep awk grep 'quoted text' printf "$@" "$1"
+		/usr/bin -eu 2>/dev/null ${HOME} -eu |
+		test "$1" echo --verbose $(pwd) --verbose printf printf ${HOME} readonly "$1"
+	/usr/bin --verbose readonly -eu -eu -eu
+cd -eu sed readonly $(pwd) && x=1 ${HOME} local "$@" 'quoted text'
+cd grep /usr/bin --verbose
+		then /usr/bin export | --verbose local | --verbose $(pwd) test x=1
+		"$@" cd x=1 "$@" 2>/dev/null printf /usr/bin echo -eu /usr/bin /usr/bin
+	done "$@" then 'quoted text' && $(pwd) | "$1" grep $(pwd) printf
+	cd ${HOME} then $(pwd) ${HOME}
+'quoted text' test sed cd --verbose -eu local printf
+grep then "$@" "$1" then
+		2>/dev/null sed local /usr/bin local sed awk /usr/bin "$@" awk | local 2>/dev/null
+${HOME} cd cd sed "$1" then awk "$1" grep "$@"
+$(pwd) readonly printf cd then cd $(pwd)
+		--verbose /usr/bin cd 2>/dev/null export awk "$1" x=1 printf awk x=1 --verbose
+	"$@" ${HOME} $(pwd) echo /usr/bin 2>/dev/null | x=1 echo 2>/dev/null $(pwd) |
+"$@" cd printf --verbose && 2>/dev/null
+		local printf ${HOME} printf test ${HOME} ${HOME} awk /usr/bin
+	-eu && echo && x=1 awk --verbose
+		printf && done test echo /usr/bin /usr/bin done 2>/dev/null $(pwd) awk | done then
+		&& | ${HOME} ${HOME} /usr/bin
+printf done local local local echo 2>/dev/null && sed x=1
+	then grep --verbose grep then done ${HOME} ${HOME}
+$(pwd) local -eu cd local "$@" local cd printf
+'quoted text' test then echo echo && "$@" /usr/bin done echo
+		local -eu echo $(pwd) done | -eu 2>/dev/null readonly "$1" ${HOME} ${HOME}
+	&& $(pwd) $(pwd) cd /usr/bin local
+	readonly readonly test | ${HOME} 'quoted text'
+x=1 "$1" export "$1" $(pwd) x=1 ${HOME}
+printf ${HOME} awk awk echo awk --verbose cd
+cd --verbose sed grep 2>/dev/null $(pwd) -eu --verbose awk grep
+printf grep "$1" local readonly "$@" && "$1"
+readonly 2>/dev/null "$1" "$1" 2>/dev/null && $(pwd) grep x=1
+	echo readonly /usr/bin 2>/dev/null && cd done
+	&& sed $(pwd) ${HOME} "$@" x=1 export printf grep "$1"
+	'quoted text' export ${HOME} --verbose -eu 'quoted text' cd export
+	awk readonly $(pwd) && echo 2>/dev/null export && x=1 -eu awk done
+		printf x=1 'quoted text' --verbose
+	$(pwd) | then readonly /usr/bin && cd
+		readonly 2>/dev/null then 'quoted text' && readonly
+sed printf | 2>/dev/null grep export awk ${HOME} --verbose cd 'quoted text'
+	| x=1 cd readonly /usr/bin /usr/bin test "$@" --verbose done "$1"
+--verbose sed 'quoted text'
+		local | readonly cd sed awk readonly | "$1" x=1 --verbose
+		"$1" awk local 2>/dev/null "$@" local test awk -eu "$1" 2>/dev/null done
+grep grep "$1" $(pwd) then done -eu
+	cd x=1 $(pwd) test then readonly sed then ${HOME} | readonly awk export $(pwd)
+	awk test printf grep 'quoted text' /usr/bin | local echo awk grep then then
+test --verbose /usr/bin x=1 2>/dev/null printf sed | "$1" | x=1 sed sed
+	"$@" then grep echo ${HOME} x=1 "$1" test
+		sed sed /usr/bin echo echo && 2>/dev/null
+	printf sed export 'quoted text'
+		'quoted text' 2>/dev/null -eu $(pwd)
+	"$@" --verbose cd $(pwd) printf /usr/bin sed 2>/dev/null
+	local export --verbose done readonly local --verbose
+		$(pwd) sed -eu local export echo 2>/dev/null
+readonly done grep 2>/dev/null && test
+local then then then ${HOME} awk
+2>/dev/null done 2>/dev/null
+done "$@" /usr/bin cd done awk 2>/dev/null readonly awk
+awk done 'quoted text' cd cd export
+		sed | awk test "$@" "$@" grep 'quoted text' --verbose 'quoted text' x=1 cd 2>/dev/null
+grep printf export awk 2>/dev/null test "$@" export printf readonly
+	awk --verbose -eu test x=1 -eu && printf && echo
+	test && "$1" echo && && grep sed grep printf awk "$1"
+	test $(pwd) ${HOME} readonly x=1
+	export 'quoted text' $(pwd) grep x=1 done echo && --verbose
+x=1 'quoted text' grep sed awk export awk "$1" readonly | awk $(pwd) test
+/usr/bin echo | echo readonly sed done done ${HOME}
+awk sed "$1" echo -eu printf | "$1" 2>/dev/null ${HOME} 2>/dev/null &&
+	/usr/bin test && echo ${HOME} ${HOME} test readonly printf
+		sed cd -eu 'quoted text' -eu "$@"
+	2>/dev/null x=1 printf $(pwd) export
+		| test done done $(pwd) --verbose printf | awk 'quoted text'
+	&& /usr/bin cd /usr/bin
+awk "$1" test "$@" --verbose readonly
+| export printf "$@" printf 2>/dev/null "$@" done export $(pwd) 2>/dev/null
+	readonly local $(pwd) printf && 'quoted text'
+		"$@" sed ${HOME} cd "$@" readonly grep -eu local ${HOME} grep
+done ${HOME} then x=1 local printf -eu && -eu -eu grep /usr/bin
+export "$@" | ${HOME} done $(pwd) 2>/dev/null grep
+		&& grep awk 2>/dev/null --verbose
+		cd 2>/dev/null ${HOME} "$@" "$@" sed 2>/dev/null grep | export "$1" export | readonly
+	2>/dev/null done printf ${HOME} "$@" awk readonly $(pwd) -eu local
+	${HOME} /usr/bin -eu 'quoted text' ${HOME} "$1" export local -eu awk export
+"$1" grep readonly --verbose echo readonly && 2>/dev/null awk /usr/bin
+		--verbose awk 'quoted text' x=1 /usr/bin 2>/dev/null grep 2>/dev/null
+	-eu x=1 | && /usr/bin cd ${HOME}
+		done readonly 'quoted text' sed ${HOME} done "$@" /usr/bin
+	--verbose $(pwd) then ${HOME} | $(pwd)
+$(pwd) printf -eu "$1" ${HOME} sed "$1" printf sed &&
+	2>/dev/null printf 'quoted text' 2>/dev/null cd printf cd 2>/dev/null readonly
+&& awk $(pwd) "$@" local cd "$1" test -eu --verbose readonly sed printf grep
+	echo echo printf grep sed cd && grep | "$1" -eu sed x=1 'quoted text'
+	readonly x=1 sed cd done
+	/usr/bin "$1" ${HOME} 'quoted text'
+		x=1 --verbose x=1 $(pwd) done 2>/dev/null export
+awk local -eu "$@" readonly awk x=1 | echo cd
+"$1" export done test printf echo export local $(pwd)
+	$(pwd) printf 2>/dev/null
+&& /usr/bin cd local $(pwd) then /usr/bin local && $(pwd) test 2>/dev/null
+		readonly "$1" test readonly
+-eu /usr/bin done printf export export 'quoted text' local --verbose | ${HOME}
+	then awk && | 'quoted text' test $(pwd) $(pwd) -eu /usr/bin
+-eu test | ${HOME} "$@" done -eu done sed $(pwd)
+		$(pwd) export then cd done
+"$1" && x=1 2>/dev/null && && "$@" test cd "$@" | "$@" grep awk
+		then /usr/bin 2>/dev/null x=1 | 2>/dev/null
+	printf 2>/dev/null "$1" done local ${HOME} done ${HOME}
+"$@" printf test ${HOME} echo sed -eu local 'quoted text'
+		echo /usr/bin grep sed && | sed then cd done sed sed "$@" $(pwd)
+	$(pwd) "$@" ${HOME} ${HOME} | test -eu
+		sed $(pwd) then done --verbose 'quoted text' -eu printf && "$1" readonly
+		--verbose test cd ${HOME} test 2>/dev/null 2>/dev/null awk export export
+		then "$1" /usr/bin && $(pwd) ${HOME} && awk $(pwd)
+local -eu 2>/dev/null then | printf done then done ${HOME} readonly export printf
+	echo 'quoted text' echo local 'quoted text' 'quoted text' /usr/bin 'quoted text'
+	readonly -eu 2>/dev/null ${HOME} done then sed "$1" "$@" /usr/bin "$1"
+		test readonly test /usr/bin readonly x=1
+	&& 2>/dev/null done export
+		"$@" export "$1" 2>/dev/null cd readonly 'quoted text' export "$1" 'quoted text'
+	'quoted text' then sed $(pwd) readonly then echo --verbose
+		grep $(pwd) export local $(pwd) printf
+	&& -eu x=1 'quoted text' x=1
+	then 'quoted text' readonly x=1 $(pwd) readonly
+	echo grep /usr/bin done "$@" | "$1"
+		'quoted text' cd x=1 export ${HOME} "$@" "$@" $(pwd)
+$(pwd) 'quoted text' /usr/bin 2>/dev/null then then export test grep
+awk sed && 'quoted text' $(pwd) cd 'quoted text' echo grep echo 'quoted text'
+printf | done awk | done cd export test
+export $(pwd) then readonly 'quoted text'
+		test -eu grep -eu "$@" printf /usr/bin -eu grep echo -eu printf --verbose done
+		sed "$1" awk -eu test "$@" /usr/bin -eu cd sed 'quoted text' awk "$1"
+	-eu "$@" 2>/dev/null "$1" -eu sed sed /usr/bin printf then cd
+	${HOME} $(pwd) cd 'quoted text' grep readonly | 'quoted text'
+		-eu grep --verbose | then local local test /usr/bin "$@" done "$1"
+	test readonly awk awk | grep done ${HOME}
+		${HOME} readonly local "$@" readonly
+echo && awk cd readonly && | done -eu test $(pwd) x=1
+	x=1 awk | "$@" -eu | export grep sed -eu echo ${HOME} done 'quoted text'
+		test /usr/bin printf echo $(pwd) sed /usr/bin cd grep awk echo "$1" awk
+readonly echo 2>/dev/null local printf
+		test 2>/dev/null 2>/dev/null -eu "$1" readonly
+	local awk -eu printf x=1 x=1 ${HOME} 'quoted text' echo printf x=1 printf sed
+	$(pwd) done ${HOME} then printf | local --verbose grep local done
+	--verbose test ${HOME} grep "$@" --verbose
+	export awk && 2>/dev/null "$@" --verbose
+		/usr/bin then --verbose cd /usr/bin $(pwd) echo awk sed awk
+/usr/bin cd $(pwd) grep --verbose local sed "$1" ${HOME} 2>/dev/null
+"$1" -eu -eu test export test && | 2>/dev/null
+		"$@" --verbose export -eu
+	--verbose $(pwd) grep x=1 done test local done
+	printf export -eu readonly && x=1
+		| $(pwd) /usr/bin | grep 'quoted text'
+&& done "$@" "$@" --verbose cd printf --verbose readonly "$@" then -eu then
+	export "$1" awk test sed | /usr/bin
+		-eu x=1 then $(pwd) local echo && sed cd readonly -eu | grep $(pwd) awk
+		export x=1 cd | x=1 /usr/bin "$@" ${HOME} 2>/dev/null export | printf
+	x=1 | -eu test "$1" "$1" --verbose && sed printf "$@" test
+		2>/dev/null then x=1 2>/dev/null ${HOME} | echo printf | 'quoted text'
+done then done grep "$@" /usr/bin sed export
+/usr/bin echo export $(pwd) echo 2>/dev/null
+test export cd cd test cd "$1" -eu sed then $(pwd)
+		local 2>/dev/null --verbose cd grep x=1 | sed | done printf sed grep cd
+		-eu grep --verbose $(pwd) 2>/dev/null
+	cd "$1" echo test $(pwd) $(pwd) sed x=1 export --verbose "$@"
+&& 2>/dev/null grep local export "$1" /usr/bin --verbose
+	x=1 export && 'quoted text' local sed local awk
+	"$@" readonly grep then readonly awk x=1 then "$@"
+| 'quoted text' /usr/bin 'quoted text' -eu
+	then | "$@" readonly "$@" awk -eu
+		export -eu 'quoted text' -eu /usr/bin ${HOME} /usr/bin test $(pwd) cd awk
+	-eu --verbose "$1" then 'quoted text' readonly
+		-eu 2>/dev/null sed /usr/bin
+	done printf export /usr/bin echo ${HOME} "$1" 2>/dev/null && test then -eu
+		printf printf test $(pwd) test ${HOME} 2>/dev/null
+&& "$1" echo printf x=1 "$1" test local
+${HOME} sed awk sed && $(pwd) awk printf
+		awk readonly test 'quoted text' readonly && | awk -eu sed echo
+	readonly | | "$@" awk -eu $(pwd) 2>/dev/null
+"$1" done -eu test x=1 sed cd printf export 'quoted text' | done
+		$(pwd) test --verbose && --verbose -eu 'quoted text'
+		readonly /usr/bin export echo test | ${HOME}
+-eu awk then -eu then -eu export -eu "$@" cd done | printf local grep test
+	grep "$@" cd sed awk x=1
+		echo done "$1" x=1 done "$1" local awk done && -eu "$1"
+	readonly ${HOME} | -eu && x=1 && x=1 readonly "$1" | local
+	awk x=1 done sed 'quoted text' grep printf /usr/bin grep --verbose then awk
+	sed 'quoted text' -eu "$1" "$@" -eu && test test | grep
+	x=1 2>/dev/null readonly --verbose -eu local
+		then then test "$1" then x=1 printf then -eu "$1" && $(pwd)
+	then | test done grep "$@" cd 2>/dev/null
+		${HOME} readonly readonly ${HOME} grep grep readonly done x=1 'quoted text'
+	done done && -eu export printf --verbose "$1" -eu $(pwd) grep "$1" local 'quoted text'
+test --verbose echo 2>/dev/null ${HOME} cd export cd 'quoted text'
+		local then cd x=1 && "$@" test x=1 && echo
+| awk 'quoted text' "$1" local sed
+	grep -eu then export printf done ${HOME} sed echo ${HOME} ${HOME} "$1" 2>/dev/null
+printf "$1" export cd
+x=1 | awk -eu local $(pwd) x=1 readonly readonly grep "$@" x=1 --verbose --verbose
+	| x=1 awk ${HOME} -eu test -eu grep && --verbose ${HOME} 'quoted text'
+	export local printf done
+x=1 | local then "$@" echo then ${HOME}
+		x=1 "$1" grep echo x=1 $(pwd) x=1 && echo cd "$1" test /usr/bin /usr/bin
+sed readonly readonly echo 'quoted text'
+		done --verbose ${HOME} grep x=1 ${HOME} printf
+	"$@" then awk local ${HOME} local && printf 'quoted text'
+	then grep local /usr/bin x=1
+printf grep 'quoted text' export test x=1 sed then test grep | 2>/dev/null
+--verbose sed -eu export /usr/bin "$1" --verbose sed ${HOME} && test | && echo |
+"$1" readonly printf --verbose export --verbose "$@" sed local | -eu -eu --verbose
+x=1 echo && test echo local printf /usr/bin grep
+	export $(pwd) done awk then "$1" ${HOME}
+		then ${HOME} then "$@" done awk -eu grep
+${HOME} "$@" "$@" cd local
+	/usr/bin "$1" | test "$1" /usr/bin 2>/dev/null && 'quoted text' readonly
+		2>/dev/null echo echo grep printf | "$@"
+	grep -eu echo local && -eu 'quoted text' -eu then "$@"
+	sed test local grep ${HOME} | "$@" ${HOME} then readonly
+echo x=1 then ${HOME} done sed echo 2>/dev/null readonly done then export
+	readonly awk "$1" x=1 x=1 /usr/bin $(pwd) 2>/dev/null x=1 cd readonly -eu done
+		test /usr/bin readonly done cd then done "$1" done "$@" &&
+then | x=1 then | /usr/bin sed grep && "$1"
+		readonly then grep /usr/bin printf
+		${HOME} | cd done export
+	export awk 2>/dev/null export export
+		'quoted text' x=1 grep -eu 'quoted text' printf "$1" -eu readonly done && cd
+	"$1" 'quoted text' local "$@" sed --verbose | done test 2>/dev/null cd cd
+		sed grep readonly /usr/bin export /usr/bin | grep -eu /usr/bin
+		sed --verbose local local && "$@" printf local "$1" -eu
+awk $(pwd) readonly && -eu awk local "$1"
+	"$1" test 'quoted text' "$@" echo
+	${HOME} -eu sed 'quoted text' ${HOME} then export cd done -eu printf /usr/bin
+	sed done 'quoted text' /usr/bin readonly | x=1 --verbose x=1 awk -eu done cd
+/usr/bin cd && then x=1
+	--verbose $(pwd) | "$1" then
+	'quoted text' done printf && printf
+	x=1 "$1" echo x=1 x=1 export local
+awk 'quoted text' local | "$@"
+	done 'quoted text' "$@" export | grep ${HOME}
+		'quoted text' sed "$1" cd "$@" export done export --verbose 2>/dev/null echo "$1"
+		echo test 'quoted text' ${HOME}
+		cd readonly echo ${HOME} awk ${HOME} && test readonly "$@"
+		x=1 sed "$@" | sed echo $(pwd) "$1" /usr/bin awk
+		/usr/bin x=1 awk x=1 2>/dev/null 'quoted text'
+		$(pwd) $(pwd) -eu grep
+then sed "$@" echo $(pwd) /usr/bin $(pwd) done awk --verbose -eu 'quoted text'
+	"$@" 2>/dev/null done ${HOME} --verbose ${HOME} local then
+	"$@" ${HOME} echo test export /usr/bin readonly local done $(pwd) grep
+		test 2>/dev/null x=1 then then export --verbose "$1" then ${HOME} echo
+		echo readonly done readonly --verbose | 2>/dev/null 2>/dev/null /usr/bin
+	| | $(pwd) | --verbose awk
+| awk printf x=1 | test -eu echo readonly test awk "$@"
+		echo -eu "$@" $(pwd) test printf done && 'quoted text' 'quoted text'
+	grep /usr/bin ${HOME} 2>/dev/null | grep
+"$@" x=1 2>/dev/null local x=1 export ${HOME} grep export then readonly
+	export grep sed "$1" 2>/dev/null 'quoted text' test done /usr/bin
+		echo -eu done test ${HOME} test echo sed echo
+		"$1" test "$1" local local sed -eu $(pwd) "$1" --verbose -eu 'quoted text'
+	then $(pwd) "$1" /usr/bin && "$1" /usr/bin export ${HOME} sed /usr/bin
+"$1" echo $(pwd) done /usr/bin | grep $(pwd) ${HOME} ${HOME}
+		awk 'quoted text' 2>/dev/null | readonly 2>/dev/null $(pwd)
+awk readonly x=1 echo sed 'quoted text'
+	--verbose "$@" | "$1" readonly
+		x=1 sed "$1" 'quoted text' "$1" 'quoted text' "$1" | 2>/dev/null 'quoted text'
+	${HOME} sed --verbose "$1" "$@" "$1" --verbose -eu 2>/dev/null
+local ${HOME} done --verbose /usr/bin cd done | then local
+	echo /usr/bin 'quoted text' ${HOME} | "$@" -eu export
+${HOME} echo printf | 'quoted text' readonly $(pwd) sed readonly --verbose
+		"$1" local echo readonly 2>/dev/null grep local "$@" && test
+&& export printf done done && cd then /usr/bin
+	local /usr/bin "$@" 'quoted text' local "$1" /usr/bin sed echo sed 2>/dev/null
+	$(pwd) -eu --verbose then
+		cd done 2>/dev/null ${HOME} sed local -eu readonly readonly "$@"
+2>/dev/null 2>/dev/null -eu cd --verbose
+	grep awk -eu 2>/dev/null readonly 'quoted text' /usr/bin $(pwd)
+		'quoted text' local --verbose
+	test readonly ${HOME} 'quoted text'
+		/usr/bin "$@" "$1" test x=1 local then
+	&& ${HOME} cd local test test /usr/bin local 2>/dev/null grep test done
+		test cd --verbose x=1 "$1" | done -eu awk done && 'quoted text' x=1 export
+	readonly 2>/dev/null -eu && local awk done grep cd readonly
+	| printf cd echo sed done 2>/dev/null done echo local -eu "$1"
+		-eu test ${HOME} -eu awk /usr/bin $(pwd) && --verbose 'quoted text' printf
+export sed "$@" "$@" echo /usr/bin awk "$1" 2>/dev/null
+local awk $(pwd) awk $(pwd) "$@" cd /usr/bin --verbose sed 2>/dev/null
+2>/dev/null printf x=1 printf printf /usr/bin /usr/bin --verbose
+		grep 'quoted text' "$1" | --verbose local "$@" "$@" grep "$1"
+	"$@" && export x=1 grep then done export local -eu
+grep done cd test echo echo "$@" local -eu local then "$1" readonly 'quoted text'
+	cd grep grep -eu cd awk "$@" --verbose "$1"
+		"$@" export ${HOME} cd 2>/dev/null && 2>/dev/null 'quoted text'
+		--verbose sed "$1" printf grep $(pwd)
+		-eu x=1 local x=1 && 'quoted text' grep $(pwd) |
+		printf sed -eu | x=1 cd && printf
+	x=1 grep | $(pwd) /usr/bin && awk "$1" awk --verbose "$1" cd test
+	2>/dev/null echo x=1 "$@" ${HOME} export ${HOME} 2>/dev/null
+	local x=1 | | 2>/dev/null ${HOME}
+	test --verbose --verbose printf /usr/bin /usr/bin cd && test 2>/dev/null
+sed -eu sed done 'quoted text'
+	&& --verbose -eu /usr/bin readonly printf export grep then grep cd $(pwd)
+		&& local && --verbose grep local x=1 --verbose grep $(pwd) cd $(pwd)
+	then | -eu then /usr/bin export then "$@" "$1" "$1" -eu "$@" printf
+	readonly && ${HOME} --verbose
+		-eu done x=1 test then x=1 grep --verbose local
+	sed && echo | sed echo && awk && grep "$1" echo cd x=1 echo sed
+	&& "$1" awk 'quoted text' echo sed cd && readonly
+	echo ${HOME} echo readonly printf readonly cd 'quoted text' grep readonly
+		/usr/bin grep ${HOME} export $(pwd) grep
+		cd --verbose printf /usr/bin | local
+&& 'quoted text' readonly
+printf 'quoted text' --verbose | export readonly export export then cd -eu &&
+	$(pwd) grep local then -eu "$@" "$@" $(pwd)
+-eu | test && --verbose "$@" then sed awk 2>/dev/null
+	cd echo -eu cd test 2>/dev/null echo then readonly "$@"
+	"$1" --verbose 2>/dev/null readonly --verbose readonly 2>/dev/null
+${HOME} then | then "$@" 2>/dev/null 2>/dev/null "$@"
+	readonly sed sed cd done echo x=1 --verbose "$@" /usr/bin "$@" then /usr/bin
+#include c241.sh
+-eu | 'quoted text' x=1 --verbose x=1 export -eu cd echo 'quoted text'
+	readonly && /usr/bin then grep 'quoted text'
+awk ${HOME} grep /usr/bin cd "$@" echo then printf echo then readonly test
+		sed $(pwd) -eu done "$@" 2>/dev/null printf readonly cd $(pwd) test && 'quoted text'
+echo "$1" cd 'quoted text' done /usr/bin "$1" $(pwd) then
+'quoted text' x=1 'quoted text'
+		$(pwd) awk export --verbose printf x=1
+2>/dev/null local cd x=1 | "$@" --verbose test local echo "$1"
+		local grep done cd --verbose local $(pwd) x=1 export export readonly $(pwd) --verbose
+		2>/dev/null "$1" --verbose then | && | /usr/bin
+$(pwd) | 'quoted text' "$1" printf /usr/bin then local cd | test 2>/dev/null
+	&& export 2>/dev/null "$1" "$@" awk local echo
+	export local x=1 --verbose
+		--verbose /usr/bin then x=1 ${HOME} "$@" --verbose ${HOME} --verbose $(pwd)
+sed ${HOME} ${HOME} cd printf printf
+printf local | 2>/dev/null
+awk /usr/bin readonly readonly
+	/usr/bin cd export "$@" --verbose done 2>/dev/null cd
+		test done done sed "$@" test test test /usr/bin
+	cd printf -eu sed 'quoted text' done awk
+	/usr/bin --verbose "$@" export echo "$1" ${HOME}
+		2>/dev/null awk --verbose ${HOME}
+		${HOME} /usr/bin $(pwd) local readonly ${HOME} && readonly -eu done ${HOME}
+		then cd then $(pwd) $(pwd)
+		awk && /usr/bin ${HOME} "$@" grep x=1
+	2>/dev/null export grep readonly "$1" sed x=1 && | echo done $(pwd) echo sed
+	'quoted text' export export grep echo 2>/dev/null printf sed
+		awk done grep test ${HOME}
+test echo ${HOME} export local sed
+	awk test "$@" sed sed printf 2>/dev/null done readonly /usr/bin
+		printf done awk echo cd printf "$1" then export /usr/bin
+		readonly test $(pwd) done grep sed sed x=1 'quoted text'
+		cd then && $(pwd) ${HOME} then
+printf readonly ${HOME} then export cd done
+	-eu $(pwd) then "$@" /usr/bin "$1" $(pwd) ${HOME} 2>/dev/null
+	/usr/bin cd readonly test grep -eu awk grep --verbose ${HOME} 'quoted text'
+	"$1" | 2>/dev/null --verbose echo $(pwd)
+		export readonly grep x=1 | | printf x=1 "$1"
+	&& | sed done "$1" && | && /usr/bin cd x=1 "$@"
+$(pwd) 'quoted text' printf $(pwd) | | sed
+	echo grep awk $(pwd) "$1" readonly test cd
+		${HOME} && | /usr/bin grep local
+awk && -eu "$@" --verbose "$1" 'quoted text'
+	&& x=1 printf $(pwd) echo
+	"$1" readonly grep grep "$1" test 'quoted text' && --verbose
+	${HOME} cd && test $(pwd) --verbose
+		$(pwd) "$1" awk printf printf awk test | ${HOME} | done 2>/dev/null
+	test done awk && printf cd 2>/dev/null export done "$1" then
+		echo printf awk test awk awk readonly
+done "$@" -eu && awk export && test local "$1" ${HOME}
+	readonly done ${HOME} test $(pwd) | "$1" local
+	readonly ${HOME} ${HOME} ${HOME} cd
+test echo local ${HOME} then "$@" local -eu --verbose
+$(pwd) 'quoted text' ${HOME} -eu && done "$1" local printf
+done ${HOME} 2>/dev/null
+	"$1" readonly awk then local grep
+	then grep test 'quoted text' printf
+x=1 sed ${HOME} export --verbose printf echo 2>/dev/null
+	/usr/bin $(pwd) "$1" 'quoted text' then x=1 "$1" x=1
+sed $(pwd) -eu $(pwd) 2>/dev/null sed "$@" echo done -eu cd -eu && done
+sed "$1" then | readonly ${HOME} -eu echo grep --verbose /usr/bin
+	echo sed sed x=1 x=1 x=1
+		--verbose 2>/dev/null export echo ${HOME} --verbose printf grep export $(pwd)
+x=1 cd printf printf grep 'quoted text' done 'quoted text'
+	sed sed echo ${HOME} /usr/bin test && $(pwd)
+		| grep export sed then awk --verbose done export "$@" | local done
+		local then printf ${HOME} done export done && | --verbose
+		then ${HOME} ${HOME} export x=1 readonly
+done local -eu sed "$@" $(pwd) printf 'quoted text' "$1" /usr/bin
+"$1" echo local $(pwd) --verbose grep awk export done x=1 $(pwd)
+'quoted text' grep then &&
+		then sed grep export readonly ${HOME} test /usr/bin
+export 'quoted text' "$1" "$@" done -eu "$@" 2>/dev/null x=1
+		export x=1 local done | then 'quoted text'
+	x=1 grep $(pwd) sed local x=1 "$@" | awk export -eu --verbose cd
+		local readonly echo --verbose grep
+--verbose $(pwd) /usr/bin 2>/dev/null "$@" test printf printf
+		/usr/bin cd 'quoted text' then && grep readonly local export ${HOME}
+	"$@" printf /usr/bin && $(pwd)
+		test local 'quoted text' -eu readonly local echo --verbose 2>/dev/null test
+		local awk "$@" grep -eu readonly $(pwd) 2>/dev/null local ${HOME} grep local
+x=1 awk $(pwd) echo cd -eu test
+		echo export --verbose ${HOME} sed 2>/dev/null --verbose local
+echo test && x=1 $(pwd) 2>/dev/null echo 'quoted text' ${HOME}
+	echo && ${HOME} --verbose then
+| sed "$1" ${HOME} awk local echo | "$1" | x=1 test done
+	| awk /usr/bin awk $(pwd) grep ${HOME} /usr/bin | -eu grep readonly
+	-eu grep then then /usr/bin done grep --verbose echo printf printf readonly awk
+		printf sed x=1 "$@" grep ${HOME} /usr/bin local sed | local
+done awk x=1 echo "$@" echo x=1 grep cd | ${HOME} 2>/dev/null
+	export echo local then export done test cd done "$@" test export
+local echo echo $(pwd) 'quoted text' local grep sed "$1" --verbose 'quoted text'
+	&& 'quoted text' test printf $(pwd) grep
+		2>/dev/null test awk local cd /usr/bin printf
+	printf then local readonly 2>/dev/null awk grep ${HOME}
+-eu export printf awk cd local printf "$1" sed 2>/dev/null export awk --verbose
+	/usr/bin 'quoted text' echo -eu -eu
+		$(pwd) 2>/dev/null "$1" sed cd done then cd
+	x=1 cd then x=1 x=1 2>/dev/null 'quoted text' $(pwd) then "$1" cd -eu 2>/dev/null
+'quoted text' cd ${HOME} local 2>/dev/null sed done awk && echo readonly x=1 'quoted text'
+		| --verbose 2>/dev/null "$@" /usr/bin $(pwd)
+	export done "$@" 2>/dev/null cd
+		readonly readonly echo 2>/dev/null awk ${HOME} local
+		2>/dev/null 'quoted text' grep -eu readonly awk local
+		&& "$1" then cd | echo readonly then awk local awk printf echo &&
+	$(pwd) $(pwd) x=1 /usr/bin test then 2>/dev/null &&
+	"$1" "$@" awk local printf 2>/dev/null -eu 2>/dev/null $(pwd) "$@" |
+${HOME} echo printf export 'quoted text' cd readonly | ${HOME} "$@" awk "$1"
+		"$1" done done 'quoted text' 'quoted text' export then cd $(pwd) | --verbose
+		| ${HOME} sed sed --verbose awk readonly awk then 'quoted text' sed cd "$1"
+		printf grep /usr/bin ${HOME} 'quoted text' 2>/dev/null $(pwd) ${HOME}
+	$(pwd) grep && --verbose local /usr/bin printf
+		-eu sed 2>/dev/null cd --verbose 2>/dev/null
+		local -eu --verbose awk cd --verbose echo printf export
+		/usr/bin export cd readonly done export readonly $(pwd)
+		cd 2>/dev/null "$@" export "$1" readonly
+		| ${HOME} grep | && $(pwd) /usr/bin then --verbose
+		cd local | ${HOME} "$1" 'quoted text' awk echo cd /usr/bin local "$1" ${HOME} readonly
+	awk 'quoted text' echo &&
+grep cd grep cd 'quoted text' readonly
+sed "$@" printf /usr/bin test $(pwd)
+	$(pwd) export /usr/bin awk printf | readonly
+	2>/dev/null sed x=1 readonly
+	printf readonly echo $(pwd)
+echo && local "$@" local readonly cd echo sed printf ${HOME}
+		"$@" && then readonly
+		x=1 | awk local grep --verbose $(pwd) "$1" local awk ${HOME} done local echo $(pwd)
+	local && cd readonly export done "$1" 2>/dev/null
+2>/dev/null sed printf sed | echo -eu local | -eu 'quoted text' --verbose
+'quoted text' -eu then grep cd --verbose
+	/usr/bin export sed export awk 'quoted text' printf grep done
+readonly /usr/bin "$@" -eu grep readonly $(pwd)
+		2>/dev/null --verbose export export | "$1" printf
+	then -eu | 'quoted text' readonly
+done printf /usr/bin export then grep ${HOME} 2>/dev/null
+	--verbose "$@" done local awk 'quoted text'
+	done sed awk sed grep echo -eu readonly 2>/dev/null "$@" 2>/dev/null
+	echo awk | x=1 then ${HOME} "$1" /usr/bin 'quoted text' | awk
+"$@" /usr/bin done $(pwd) grep -eu grep $(pwd) | "$@" done cd sed then export
+	printf 2>/dev/null "$1" /usr/bin ${HOME} -eu /usr/bin
+	-eu then -eu readonly printf --verbose export grep /usr/bin $(pwd) then
+${HOME} x=1 cd x=1 test awk && done cd done readonly echo local
+	test x=1 cd -eu export sed test 'quoted text' sed 'quoted text'
+"$@" 'quoted text' $(pwd) --verbose test
+	${HOME} printf "$1" readonly
+printf "$1" local -eu /usr/bin ${HOME} local 2>/dev/null
+grep "$1" $(pwd) cd 'quoted text' /usr/bin 'quoted text'
+		| grep then readonly export --verbose -eu ${HOME} x=1 done 2>/dev/null awk -eu 2>/dev/null
+		&& cd grep "$@" local "$@"
+"$1" test /usr/bin echo done grep ${HOME} then "$@" 'quoted text' test then
+	/usr/bin --verbose awk x=1 /usr/bin echo printf local then "$@" "$1" 'quoted text'
+&& then awk echo printf
+		'quoted text' 2>/dev/null awk "$1" readonly $(pwd) local ${HOME} "$@" x=1 -eu cd
+	echo readonly x=1 printf /usr/bin
+		then local echo ${HOME} $(pwd) 'quoted text' 'quoted text'
+	x=1 echo "$@" cd test && -eu done -eu "$@" test
+	"$@" done x=1 then grep "$@" then --verbose sed "$1"
+		done x=1 export export cd "$@" ${HOME} cd |
+x=1 -eu done $(pwd) x=1 ${HOME} 'quoted text'
+&& printf 'quoted text' readonly export &&
+'quoted text' local "$1" printf -eu cd -eu "$@" export ${HOME} "$@"
+		export $(pwd) test --verbose printf then awk
+		2>/dev/null x=1 --verbose /usr/bin
+		echo 'quoted text' /usr/bin /usr/bin /usr/bin
+		export ${HOME} /usr/bin export x=1 then x=1
+then "$1" done && awk cd then grep 2>/dev/null --verbose -eu then 'quoted text'
+readonly 'quoted text' awk readonly grep printf done x=1 done "$@"
+/usr/bin cd && | x=1 test && awk local
+'quoted text' echo export test
+echo "$@" x=1 local grep sed "$1" echo printf | export
+	grep && 2>/dev/null echo -eu echo test export ${HOME} cd "$@" --verbose /usr/bin
+	test test awk ${HOME} "$@" then awk "$@" echo
+	local x=1 ${HOME} sed 2>/dev/null test sed readonly grep "$@"
+| /usr/bin | x=1 echo printf grep
+		| && test "$@" /usr/bin grep then $(pwd) done readonly
+		grep ${HOME} 'quoted text' then awk &&
+$(pwd) /usr/bin $(pwd) then $(pwd) cd sed cd readonly
+		sed done printf test export 2>/dev/null
+then ${HOME} $(pwd) readonly -eu awk export | done ${HOME} cd done printf sed
+		test local x=1 ${HOME} "$1" "$@" awk | | && grep
+	-eu printf echo local -eu | && 2>/dev/null $(pwd)
+readonly then then local 2>/dev/null 2>/dev/null -eu --verbose
+		"$1" $(pwd) | export readonly $(pwd) printf test
+	printf cd -eu && x=1 "$1" test grep sed --verbose 2>/dev/null
+echo awk export | --verbose --verbose | "$1"
+		| /usr/bin x=1 --verbose
+		$(pwd) 2>/dev/null done readonly "$1" sed grep ${HOME}
+| $(pwd) done test cd printf done local "$@" awk test -eu x=1 cd "$@" export
+&& done export | export -eu
+	'quoted text' x=1 awk local printf then local sed readonly
+	"$@" grep && x=1 ${HOME}
+awk "$@" sed then 'quoted text' ${HOME}
+		2>/dev/null awk -eu -eu readonly grep printf && grep 2>/dev/null -eu readonly
+	grep --verbose $(pwd) $(pwd) readonly -eu done "$1" then "$1"
+	--verbose export then awk cd awk done $(pwd) local test echo 2>/dev/null
+		then local printf done then 2>/dev/null printf "$1" then cd test $(pwd)
+		printf local then $(pwd) cd echo
+	echo grep "$1" "$@" x=1 echo echo grep readonly local && printf
+2>/dev/null awk --verbose grep
+	printf ${HOME} test --verbose && $(pwd) ${HOME}
+	test -eu x=1 grep printf echo "$@" ${HOME} grep test
+/usr/bin grep --verbose x=1 ${HOME}
+-eu ${HOME} /usr/bin test test ${HOME} sed &&
+test 2>/dev/null then cd printf readonly
+test local local grep "$1" /usr/bin readonly
+-eu 'quoted text' "$@" export
+	'quoted text' $(pwd) /usr/bin grep
+		printf ${HOME} then /usr/bin "$1" then readonly "$@" printf then
+| cd test cd echo then
+		then export 'quoted text' x=1 "$@" done x=1 "$@" /usr/bin x=1
+	| -eu 2>/dev/null x=1 test --verbose --verbose readonly 2>/dev/null cd | printf
+2>/dev/null | /usr/bin 2>/dev/null
+cd 2>/dev/null "$@" local x=1 grep
+		then $(pwd) export printf done ${HOME} done export -eu
+| /usr/bin done /usr/bin $(pwd) 2>/dev/null /usr/bin $(pwd) test then then &&
+		grep x=1 -eu test ${HOME} | sed printf && done /usr/bin "$1" --verbose ${HOME}
+		"$@" sed /usr/bin && | sed 2>/dev/null test 2>/dev/null && grep -eu local
+	awk export 2>/dev/null x=1 $(pwd) readonly printf awk
+printf cd printf export readonly awk readonly && printf
+	"$@" grep test $(pwd) && "$1" printf export test -eu awk
+"$1" echo export awk then cd "$1" awk readonly | echo -eu
+	done /usr/bin export | done grep ${HOME} x=1 x=1 "$1" readonly
+	"$1" echo $(pwd) test echo cd "$1" | x=1 grep grep test | readonly
+cd --verbose then ${HOME} /usr/bin awk "$@" local then -eu readonly test
+		$(pwd) "$1" echo local
+${HOME} printf export /usr/bin "$1" echo
+test readonly | grep
+		${HOME} awk echo "$1" cd | "$@"
+'quoted text' "$@" cd readonly local "$@" "$1" printf printf cd -eu export /usr/bin
+cd printf done cd 2>/dev/null ${HOME} local cd printf
+		"$1" test readonly x=1 done local test $(pwd) export cd /usr/bin done local test
+		printf readonly | cd grep
+	echo local | && local /usr/bin awk --verbose
+	/usr/bin local echo test --verbose done "$@" done ${HOME}
+		done 2>/dev/null awk printf printf -eu cd && --verbose
+	cd sed sed cd sed grep /usr/bin awk export then
+cd local 'quoted text' awk sed test "$1" /usr/bin cd grep test
+		done | test then | 2>/dev/null
+	printf cd awk && echo echo export x=1 echo then readonly sed grep --verbose
+	then 'quoted text' local "$@" | ${HOME} echo && readonly
+export readonly -eu 2>/dev/null ${HOME} test x=1 x=1 printf test
+	then readonly awk "$@" "$@" sed then "$@" sed "$1" x=1 x=1 local readonly -eu
+	local | "$@" sed "$1" awk $(pwd) local
+then done && test x=1 'quoted text' cd readonly 2>/dev/null printf ${HOME}
+test local grep sed /usr/bin awk && "$@" echo && done "$@" echo && $(pwd) echo
+		'quoted text' awk 'quoted text' done $(pwd) printf echo /usr/bin grep readonly
+	grep -eu then | local done ${HOME} grep grep cd printf
+x=1 sed 2>/dev/null -eu ${HOME} --verbose
+		awk then awk && "$@" /usr/bin done "$1" 2>/dev/null
+	"$@" ${HOME} x=1 "$@" test
+	2>/dev/null awk x=1 --verbose x=1 /usr/bin
+		x=1 --verbose then | | grep cd 'quoted text' "$1" local export export test
+	/usr/bin && 'quoted text' echo sed $(pwd)
+	local grep printf readonly "$@" awk --verbose echo -eu
+	then readonly cd --verbose
+export -eu 'quoted text' export -eu ${HOME} x=1 done export --verbose --verbose
+awk printf done "$@" ${HOME} local then test readonly
+| echo -eu "$1" /usr/bin
+		| then "$1" cd done echo /usr/bin printf "$@" test local
+		2>/dev/null /usr/bin awk awk awk | test
+-eu && readonly grep && test cd | $(pwd) && local | && cd 'quoted text' test
+		local -eu ${HOME} 2>/dev/null -eu grep /usr/bin local $(pwd) && "$@" echo
+	printf grep sed cd "$@" --verbose 2>/dev/null --verbose readonly
+'quoted text' done -eu "$1" x=1 done export "$@" $(pwd) then cd sed
+		2>/dev/null /usr/bin cd awk test | && local -eu 2>/dev/null
+	--verbose awk cd cd awk readonly
+		--verbose printf done -eu x=1
+	export /usr/bin sed "$@" && 'quoted text' | test 2>/dev/null
+	"$1" cd 2>/dev/null 'quoted text'
+"$1" --verbose -eu "$1" ${HOME} awk test -eu x=1 | test $(pwd)
+printf then test ${HOME} printf 'quoted text'
+		sed printf "$1" "$1" cd test awk 'quoted text' awk -eu echo done printf echo
+"$@" /usr/bin 2>/dev/null sed test "$@" ${HOME}
+	--verbose "$@" ${HOME} ${HOME}
+	readonly cd printf test test export awk --verbose
+${HOME} $(pwd) $(pwd) done 2>/dev/null ${HOME} echo
+	"$1" awk "$@" ${HOME} -eu then then && echo /usr/bin ${HOME} readonly done ${HOME}
+	/usr/bin --verbose x=1 cd printf test cd 2>/dev/null
+	readonly "$@" echo printf x=1
+awk 'quoted text' x=1 cd
+		done export local local done 'quoted text' 'quoted text'
+	awk --verbose readonly
+		-eu test sed && export "$1" test --verbose
+$(pwd) test local readonly readonly --verbose $(pwd) --verbose
+	"$@" echo ${HOME} sed test readonly && done -eu export
+x=1 --verbose 2>/dev/null $(pwd) ${HOME} then x=1 x=1 "$@" ${HOME}
+printf readonly readonly 2>/dev/null ${HOME}
+	printf 2>/dev/null /usr/bin
+		${HOME} test ${HOME}
+	grep --verbose readonly export sed
+$(pwd) export -eu | done then | done && /usr/bin done && cd cd $(pwd)
+		export 2>/dev/null "$1" 2>/dev/null -eu cd
+	'quoted text' sed then "$1" sed echo | x=1 "$1"
+		--verbose -eu -eu test grep 2>/dev/null sed x=1 ${HOME} echo
+-eu awk export echo 2>/dev/null done then 2>/dev/null then
+		export echo "$@" test echo --verbose
+	$(pwd) /usr/bin printf -eu grep -eu awk -eu 'quoted text'
+		--verbose grep echo "$@" && sed 2>/dev/null
+printf sed --verbose test -eu readonly printf local
+		done then grep echo echo export | "$@" local echo printf echo "$@"
+	${HOME} | test grep export echo sed ${HOME} 'quoted text' -eu
+	x=1 export ${HOME} ${HOME}
+echo test --verbose "$@" export ${HOME} echo readonly printf
+		/usr/bin grep printf test && printf $(pwd) 2>/dev/null
+x=1 echo export done $(pwd) printf awk sed test sed printf | --verbose
+then $(pwd) 'quoted text' grep "$@" "$1" cd echo -eu awk printf grep
+		| ${HOME} export -eu local /usr/bin "$@"
+then "$1" ${HOME} "$1" /usr/bin | sed echo "$@" cd sed then
+test grep awk sed awk x=1 --verbose done
+then x=1 | awk sed grep "$@" echo cd "$@" -eu "$@" $(pwd) &&
+	--verbose printf grep /usr/bin -eu export "$1"
+		then /usr/bin 'quoted text' done && cd
+		"$@" $(pwd) | done grep done "$@"
+${HOME} sed $(pwd) && | done x=1 local --verbose "$@" x=1 test "$@" 2>/dev/null
+	$(pwd) && export grep x=1 sed readonly test printf awk | $(pwd) 'quoted text'
+awk x=1 | --verbose && /usr/bin then $(pwd) --verbose then awk
+		--verbose awk sed local grep ${HOME} "$@" "$@" "$1" awk --verbose "$1"
+x=1 x=1 x=1 done $(pwd) cd grep printf echo "$1" test
+		export ${HOME} --verbose
+		cd "$1" export ${HOME} | "$1" local ${HOME} export 2>/dev/null
+		then && awk 2>/dev/null 'quoted text' /usr/bin --verbose echo
+	grep && test ${HOME} export ${HOME} export "$1" x=1 sed "$1" grep
+readonly 2>/dev/null && readonly grep ${HOME} readonly printf
+done printf $(pwd) echo then awk x=1 test local /usr/bin x=1 test local
+		$(pwd) 2>/dev/null ${HOME} "$1" x=1 cd then grep readonly -eu /usr/bin
+	then test readonly test test readonly /usr/bin x=1
+		'quoted text' /usr/bin cd && -eu export | export | grep 2>/dev/null | awk
+	awk done echo && "$1" ${HOME} $(pwd) --verbose sed 'quoted text' awk -eu $(pwd)
+		&& "$@" done | | x=1 $(pwd) echo sed then grep 'quoted text' done ${HOME} readonly
+		"$@" test awk ${HOME} 'quoted text'
+		sed "$1" ${HOME} awk ${HOME} cd "$1" then 2>/dev/null test then export $(pwd)
+| $(pwd) /usr/bin echo then "$1" x=1 2>/dev/null
+/usr/bin 'quoted text' "$@" "$@" 'quoted text'
+		grep ${HOME} echo | cd test && "$@" x=1 local x=1 "$1" && cd $(pwd) grep
+"$1" then cd printf cd "$1" 'quoted text' then cd 'quoted text'
+		printf 'quoted text' grep
+		| echo && | 'quoted text' export $(pwd)
+		&& 'quoted text' --verbose test x=1
+	-eu && ${HOME} "$@" | --verbose | --verbose printf echo echo sed
+	'quoted text' export && 'quoted text' 'quoted text' local
+export then ${HOME} sed done
+2>/dev/null grep ${HOME} --verbose x=1 -eu | echo ${HOME} test test | | x=1
+		printf done | "$@" awk sed then test 'quoted text' cd -eu sed
+	awk -eu --verbose /usr/bin local /usr/bin
+grep | && readonly x=1 "$@" done ${HOME} awk local 'quoted text'
+-eu 2>/dev/null /usr/bin printf x=1 grep
+		--verbose export 2>/dev/null
+	"$1" 2>/dev/null grep local "$@" test --verbose test
+'quoted text' cd grep export done --verbose then 'quoted text'
+printf then echo awk then "$1" "$@" ${HOME}
+		&& sed && x=1 test echo x=1 echo "$1" grep grep local cd grep
+${HOME} $(pwd) 'quoted text'
+test && readonly --verbose -eu && "$1" | 'quoted text'
+'quoted text' --verbose readonly
+	&& ${HOME} | awk $(pwd) grep $(pwd) local
+--verbose -eu echo | export
+$(pwd) awk x=1 | && --verbose printf local
+		--verbose -eu ${HOME} x=1 printf grep awk grep "$1" 'quoted text'
+then done local printf 'quoted text' | awk ${HOME} 'quoted text' cd local awk "$@"
+	then x=1 sed local --verbose export awk test export local then
+grep -eu done && cd grep "$@" echo "$1" "$1" cd 2>/dev/null
+		readonly 2>/dev/null printf cd && && | done grep $(pwd) --verbose
+	readonly -eu /usr/bin "$@" -eu --verbose | "$1" grep 2>/dev/null 2>/dev/null
+x=1 grep 'quoted text' ${HOME} ${HOME}
+		"$1" then -eu export sed cd sed $(pwd) test
+		"$1" "$1" printf -eu 'quoted text'
+'quoted text' x=1 echo x=1 echo 'quoted text'
+		&& /usr/bin 2>/dev/null 2>/dev/null x=1 'quoted text' done
+	--verbose readonly cd echo done done
+cd awk /usr/bin export awk $(pwd) echo
+	done ${HOME} && $(pwd) "$@"
+sed -eu -eu cd "$1" done
+		x=1 ${HOME} printf /usr/bin ${HOME} export export && "$1" -eu
+		grep $(pwd) sed awk "$1" | "$@" printf "$@" "$1" x=1 sed test readonly /usr/bin
+	printf "$1" -eu readonly --verbose
+done grep readonly 2>/dev/null
+		awk local /usr/bin echo awk | grep $(pwd) ${HOME} ${HOME} echo ${HOME}
+awk /usr/bin --verbose | printf x=1 test /usr/bin ${HOME} echo echo grep 'quoted text'
+readonly | awk | -eu sed printf -eu x=1
+done 2>/dev/null cd export "$1" test --verbose 'quoted text'
+		readonly local "$@" x=1 2>/dev/null test
+		--verbose x=1 done -eu --verbose printf "$1" 'quoted text'
+2>/dev/null echo && ${HOME} -eu export cd 2>/dev/null | done 'quoted text' "$@"
+"$@" export cd -eu readonly then local 2>/dev/null "$@" x=1 $(pwd) --verbose 2>/dev/null
+x=1 local "$1" awk local
+${HOME} test $(pwd) $(pwd) cd x=1 2>/dev/null
+		printf ${HOME} -eu -eu grep -eu cd sed
+	export && then "$@" echo awk -eu && grep --verbose local done
+		grep /usr/bin test then echo | $(pwd) x=1 x=1 "$1"
+	echo echo grep sed ${HOME} local
+	2>/dev/null /usr/bin test export then -eu /usr/bin export cd echo then local
+	'quoted text' $(pwd) x=1 --verbose
+printf x=1 done -eu awk --verbose grep | | awk
+	'quoted text' readonly
+		&& 'quoted text' done | --verbose export echo && grep "$@" && local
+&& cd test "$@" printf /usr/bin echo ${HOME}
+echo "$@" && readonly | test test grep readonly | test ${HOME} --verbose
+	then readonly ${HOME} -eu grep /usr/bin
+	/usr/bin | echo sed $(pwd) 'quoted text'
+	"$1" "$1" printf sed awk "$1" grep x=1 -eu awk | x=1 "$@" local -eu local done
+	--verbose then --verbose 2>/dev/null
+	&& /usr/bin && echo | cd then x=1 --verbose /usr/bin 2>/dev/null echo
+		awk local grep printf 2>/dev/null "$@" $(pwd) echo | then 2>/dev/null
+		&& local export && 'quoted text' x=1 awk export
+	readonly --verbose local done local printf
+done readonly echo export export && 2>/dev/null &&
+	--verbose sed 'quoted text' grep local -eu then
+		'quoted text' "$1" readonly /usr/bin &&
+	echo $(pwd) /usr/bin grep ${HOME} then && export &&
+		local sed local "$@" /usr/bin /usr/bin then local grep "$@" 'quoted text' x=1 then
+2>/dev/null 2>/dev/null test -eu cd awk done $(pwd) grep | then cd 2>/dev/null
+		&& export readonly readonly 2>/dev/null
+"$@" "$1" /usr/bin "$1" | then "$1" printf $(pwd) export
+		export "$@" 'quoted text' x=1 local 2>/dev/null /usr/bin cd ${HOME} /usr/bin printf
+echo then awk x=1 echo 2>/dev/null
+		$(pwd) "$1" printf $(pwd) local readonly test local | -eu
+x=1 grep sed grep "$1" | $(pwd) "$1" /usr/bin done then then cd "$@" && export
+		| "$@" 'quoted text' test -eu test awk 'quoted text' grep grep grep | "$@"
+	| grep --verbose readonly x=1 | "$@" "$@" &&
+		x=1 "$@" echo --verbose local grep export awk test then &&
+-eu awk done --verbose $(pwd) grep $(pwd)
+	then readonly && done printf && local awk printf "$1" "$@" "$@" x=1 x=1 | "$@"
+&& 2>/dev/null sed /usr/bin
+	echo test sed --verbose --verbose ${HOME} grep export test 'quoted text'
+	/usr/bin $(pwd) printf export echo ${HOME} x=1 done --verbose &&
+"$@" ${HOME} grep $(pwd) x=1 grep echo --verbose
+local readonly then sed "$@" export && ${HOME}
+grep echo echo local cd $(pwd) awk printf echo test readonly "$1" then
+		export echo sed --verbose awk /usr/bin grep && readonly $(pwd)
+	sed grep cd cd local -eu ${HOME} readonly | readonly awk done cd
+		sed readonly sed grep "$@" local
+	&& done echo --verbose --verbose
+		'quoted text' --verbose echo $(pwd) $(pwd) x=1 "$@" ${HOME} awk x=1
+	echo | readonly test -eu /usr/bin cd then "$1" grep 'quoted text' /usr/bin
+	x=1 printf "$@" "$1" export && 'quoted text'
+	grep test | echo done "$1" test && -eu readonly 'quoted text' done
+		| 'quoted text' awk x=1 ${HOME} /usr/bin
+	&& grep readonly echo 'quoted text' --verbose test && readonly sed test
+	2>/dev/null cd x=1 /usr/bin 'quoted text' && /usr/bin ${HOME} sed grep
+	done ${HOME} readonly done x=1 | -eu -eu && awk echo ${HOME} printf "$1" ${HOME}
+		echo $(pwd) 'quoted text' cd cd awk awk local "$@" local readonly local "$1"
+		cd -eu export $(pwd) grep echo cd echo "$1" $(pwd) -eu sed /usr/bin
+echo "$@" 'quoted text' "$@"
+		sed awk done sed /usr/bin readonly x=1
+x=1 awk /usr/bin local
+		local echo | /usr/bin 'quoted text' "$1" $(pwd) 2>/dev/null
+		$(pwd) grep done | ${HOME}
+		"$1" readonly "$@" test ${HOME} readonly readonly 'quoted text'
+'quoted text' cd && --verbose
+		local -eu "$1" printf local done local
+		${HOME} grep readonly grep x=1 test -eu "$@" grep 'quoted text' /usr/bin
+-eu readonly && ${HOME} 2>/dev/null | local -eu export echo $(pwd) 'quoted text'
+	$(pwd) x=1 awk cd grep awk grep then -eu grep
+readonly export --verbose "$@"
+	cd x=1 test "$@" test $(pwd) sed done --verbose awk ${HOME} test grep done
+${HOME} printf export test readonly $(pwd) awk 2>/dev/null x=1 then ${HOME}
+cd cd /usr/bin export /usr/bin then | "$@" printf test awk x=1 /usr/bin
+echo then export ${HOME}
+2>/dev/null --verbose -eu x=1
+		x=1 cd "$1" -eu sed "$@" cd ${HOME} sed "$@" test echo "$@"
+		local grep sed export /usr/bin --verbose
+	grep echo --verbose then readonly $(pwd) local readonly
+	export cd | export --verbose awk done /usr/bin
+	--verbose $(pwd) x=1 ${HOME} sed && sed | ${HOME} /usr/bin
+-eu test echo printf | 2>/dev/null awk /usr/bin
+	echo local done done 'quoted text'
+	x=1 && printf awk sed cd 2>/dev/null "$1" echo /usr/bin echo $(pwd)
+		readonly | /usr/bin printf grep printf | then cd x=1
+	$(pwd) "$@" --verbose $(pwd) && test sed 'quoted text' printf x=1 -eu
+	local 2>/dev/null 'quoted text' x=1 && grep sed x=1 awk --verbose
+readonly readonly awk /usr/bin
+"$@" printf cd echo then readonly
+	local grep && && && echo | grep
+	2>/dev/null then && "$1" printf sed test
+		&& /usr/bin printf ${HOME}
+awk 2>/dev/null /usr/bin ${HOME} -eu printf
+		"$1" export sed "$@" done x=1 export local x=1 echo --verbose &&
+		sed /usr/bin 2>/dev/null 2>/dev/null readonly cd local
+$(pwd) test 'quoted text' | 2>/dev/null
+local 'quoted text' test
+	echo test | export | -eu readonly /usr/bin $(pwd)
+'quoted text' ${HOME} "$@" "$1" test --verbose
+	&& echo && awk echo x=1 echo && awk && echo "$@" --verbose export
+		readonly echo -eu echo awk ${HOME} printf readonly /usr/bin
+		2>/dev/null done cd printf $(pwd) then grep
+"$1" awk --verbose 'quoted text' 'quoted text'
+	grep 2>/dev/null "$@" ${HOME} x=1 "$@" "$@" local done printf
+		2>/dev/null ${HOME} done $(pwd) $(pwd) 2>/dev/null sed readonly test test local
+		readonly ${HOME} "$1" x=1 -eu echo
+	x=1 awk cd | $(pwd) grep local -eu --verbose printf $(pwd) then grep --verbose
+	awk | awk 'quoted text' export x=1 readonly -eu ${HOME} 2>/dev/null "$@"
+	done test grep local sed 'quoted text' done 'quoted text'
+	x=1 "$@" sed printf && printf | "$1" readonly -eu
+		cd "$@" printf printf --verbose sed "$1" readonly
+grep | | ${HOME} | local sed /usr/bin sed "$@" && /usr/bin $(pwd)
+		2>/dev/null $(pwd) ${HOME} awk ${HOME} awk done -eu sed then 2>/dev/null
+${HOME} "$1" sed test $(pwd) echo done
+		-eu export 'quoted text' -eu
+2>/dev/null --verbose readonly echo grep "$@" | 2>/dev/null --verbose
+export -eu ${HOME} printf
+	| x=1 ${HOME} -eu awk && sed export x=1 export 'quoted text' grep ${HOME}
+	printf x=1 local -eu x=1 | x=1 sed --verbose done export && done /usr/bin 'quoted text'
+2>/dev/null done then printf | awk /usr/bin printf "$1"
+	&& && export awk -eu $(pwd) 'quoted text' x=1 awk printf then then -eu /usr/bin
+	done awk awk readonly $(pwd) then printf export "$1" then && 2>/dev/null
+		2>/dev/null /usr/bin "$@" export then printf
+'quoted text' then --verbose export | x=1 echo done 'quoted text'
+	/usr/bin test 'quoted text' /usr/bin grep -eu done &&
+		&& awk /usr/bin export
+	echo 2>/dev/null local "$1" grep /usr/bin printf local printf printf "$1" local
+readonly ${HOME} readonly grep local readonly grep | && | ${HOME} echo
+x=1 echo export echo export test done awk 2>/dev/null grep "$@" grep
+	grep printf ${HOME} --verbose | readonly export x=1 --verbose | "$1"
+		"$1" /usr/bin then awk "$1" $(pwd) done "$@" "$1" $(pwd)
+		printf "$1" $(pwd) 'quoted text' echo done awk grep awk
+	/usr/bin 2>/dev/null readonly | local -eu export done
+		/usr/bin export local printf -eu grep local
+	awk done sed $(pwd) readonly "$1" 'quoted text' && && then | awk 'quoted text'
+		printf awk x=1 /usr/bin readonly -eu $(pwd) echo $(pwd) grep $(pwd)
+	readonly | 2>/dev/null x=1 then $(pwd) local
+		--verbose readonly grep x=1 export then /usr/bin local grep local done
+		--verbose -eu cd 'quoted text'
+| ${HOME} grep x=1 printf printf echo grep export /usr/bin -eu test
+-eu local x=1 x=1 grep local | -eu $(pwd) "$1" done
+		export awk printf --verbose awk done then then /usr/bin 2>/dev/null $(pwd) "$@"
+	/usr/bin readonly sed
+		echo echo $(pwd) done grep echo "$@" readonly echo "$@" | --verbose
+"$1" export done test done ${HOME} printf --verbose grep then 2>/dev/null
+	local $(pwd) readonly cd done printf test test x=1 sed "$1" /usr/bin echo
+--verbose | $(pwd) awk cd "$@" export then grep "$1" local
+		${HOME} export awk done printf
+	x=1 then 'quoted text' sed awk cd 'quoted text' readonly
+readonly 2>/dev/null -eu 2>/dev/null echo "$1" sed test
+		'quoted text' export sed "$@" sed /usr/bin ${HOME} awk grep && then
+		export grep cd && $(pwd) cd ${HOME} | x=1 export
+sed grep awk readonly done
+	/usr/bin x=1 'quoted text' ${HOME} 'quoted text' cd awk sed readonly
+then awk x=1 local test /usr/bin test grep
+echo "$1" x=1 readonly && && "$@" 2>/dev/null done done | printf printf sed
+test sed cd "$@" "$@" echo --verbose local test 2>/dev/null
+	/usr/bin awk x=1 done x=1 -eu test
+		sed test x=1 local /usr/bin local local
+&& -eu && cd -eu && printf grep /usr/bin ${HOME} test local grep | awk
+		printf | 2>/dev/null readonly cd "$1" /usr/bin then "$@" "$@" | done 2>/dev/null
+		export | sed | "$1" readonly $(pwd) cd then "$@" sed 'quoted text' export /usr/bin
+		&& printf readonly local 2>/dev/null /usr/bin 'quoted text' "$1" then | 'quoted text'
+		&& x=1 local done "$1" 'quoted text'
+/usr/bin done echo $(pwd) awk /usr/bin
+$(pwd) sed then grep "$1" readonly -eu then
+		2>/dev/null | cd "$@" awk ${HOME}
+grep ${HOME} "$1" cd && printf | grep 'quoted text' "$1" "$1" && printf
+sed sed export awk cd $(pwd)
+	/usr/bin /usr/bin sed x=1 $(pwd) /usr/bin
+echo | "$1" readonly -eu | awk | "$1" | /usr/bin printf "$@" x=1 echo
+	local 'quoted text' sed $(pwd) grep "$@" $(pwd) 'quoted text'
+	export && ${HOME} 2>/dev/null echo "$1" -eu "$@" done --verbose
+x=1 "$@" 'quoted text' cd ${HOME} then printf --verbose cd "$@" then local then
+	${HOME} 'quoted text' sed readonly
+		&& cd 'quoted text' x=1 readonly -eu "$1" echo
+	grep "$1" 'quoted text' --verbose
+		export 'quoted text' -eu
+	readonly ${HOME} grep -eu cd && ${HOME} 'quoted text' cd
+	grep printf echo done | grep sed x=1 awk && export
+	printf /usr/bin -eu cd echo cd then "$1" echo /usr/bin echo /usr/bin done
+printf && x=1 --verbose | cd awk cd /usr/bin awk $(pwd) cd 'quoted text' 2>/dev/null
+	export printf 2>/dev/null "$@" "$1" sed readonly $(pwd) cd 2>/dev/null
+	cd x=1 "$@" then printf done echo test sed grep | ${HOME} sed /usr/bin "$1" --verbose
+		test -eu --verbose readonly && -eu 'quoted text' done
+		&& done --verbose cd 'quoted text' readonly export test export echo
+		| | done awk readonly grep
+	done | -eu test cd export local done awk "$1" test done local test /usr/bin
+	2>/dev/null 'quoted text' printf then then "$@" 2>/dev/null
+	printf x=1 echo echo 2>/dev/null then -eu readonly 2>/dev/null awk cd readonly
+x=1 ${HOME} local | 2>/dev/null | -eu | -eu $(pwd)
+	readonly "$@" then --verbose cd /usr/bin x=1 echo
+		export "$@" ${HOME} then 2>/dev/null done && then done ${HOME} test $(pwd)
+	"$@" --verbose awk 'quoted text' "$1" | sed 'quoted text'
+	cd ${HOME} -eu sed done cd done && | grep
+		export cd printf done echo awk local local
+	-eu then printf then | readonly printf 2>/dev/null test 'quoted text' --verbose
+		| | test -eu /usr/bin test readonly then sed 'quoted text' done && ${HOME} local
+	'quoted text' x=1 export && x=1 readonly cd --verbose then echo
+$(pwd) "$@" $(pwd) done sed 2>/dev/null 'quoted text' &&
+		"$@" 'quoted text' printf sed 2>/dev/null --verbose | "$1" done ${HOME}
+		/usr/bin | /usr/bin export awk cd | &&
+echo done grep 'quoted text' --verbose awk readonly
+	then test 2>/dev/null grep then local "$@" printf && x=1 echo export test
+	-eu test local x=1 awk -eu /usr/bin
+	'quoted text' grep export done 'quoted text'
+		grep cd echo 2>/dev/null printf local | readonly
+		2>/dev/null ${HOME} x=1
+	$(pwd) | done printf "$1" ${HOME} $(pwd) ${HOME} "$@" "$@" "$1" export ${HOME}
+/usr/bin test -eu grep
+--verbose export grep
+		awk awk x=1 readonly local | done --verbose sed echo 2>/dev/null
+	&& sed | sed -eu printf x=1 printf cd export "$1" x=1 grep test $(pwd)
+		grep /usr/bin | && | local export readonly $(pwd) echo 'quoted text'
+	x=1 --verbose done done printf ${HOME} then echo x=1 cd sed then
+	local readonly awk printf "$1" cd cd 2>/dev/null readonly
+	x=1 x=1 && --verbose "$1"
+		awk awk ${HOME} local sed awk | "$@" | 'quoted text'
+	local awk export "$@" --verbose
+		readonly x=1 then x=1 local grep x=1 ${HOME} awk sed test done sed "$@" cd readonly
+	"$1" test "$1" -eu -eu echo "$1" /usr/bin then "$@" local local && sed 'quoted text'
+2>/dev/null | x=1 "$@" readonly export echo printf
+	done && 2>/dev/null awk cd ${HOME} then $(pwd) echo /usr/bin export -eu /usr/bin
+cd then local && printf grep grep 2>/dev/null "$1"
+	grep echo sed sed readonly cd 'quoted text' && | done "$@" sed
+		'quoted text' sed awk ${HOME} local -eu readonly
+local then 2>/dev/null && -eu "$1"
+then "$1" cd local "$1" && awk /usr/bin local
+	done readonly --verbose export 'quoted text'
+	x=1 then $(pwd) sed 'quoted text' "$1"
+		2>/dev/null $(pwd) sed printf
+		sed readonly 'quoted text' "$@" test local 2>/dev/null
+	"$@" echo "$@" done 2>/dev/null --verbose
+test $(pwd) | grep then 2>/dev/null -eu awk cd x=1 printf 2>/dev/null
+		readonly -eu awk done sed export printf
+		local local 'quoted text' awk grep export
+		awk "$@" "$@" export then
+	-eu 2>/dev/null printf readonly
+test local "$@" 2>/dev/null
+		"$1" local local 2>/dev/null then "$@" $(pwd) --verbose grep
+$(pwd) test sed cd grep echo echo done
+	"$1" test cd local 'quoted text' $(pwd) --verbose 2>/dev/null /usr/bin local $(pwd)
+	"$@" echo awk grep /usr/bin done done readonly | x=1 ${HOME} 2>/dev/null
+echo then echo cd export
+cd export x=1 readonly
+grep then local $(pwd) readonly
+		"$1" $(pwd) grep "$@" cd && readonly test export && -eu cd 2>/dev/null
+	-eu 2>/dev/null 2>/dev/null sed "$1" export
+		test 2>/dev/null ${HOME} 2>/dev/null cd sed
+		x=1 | grep x=1 export cd local export readonly -eu | $(pwd) awk
+	x=1 export test echo --verbose
+		2>/dev/null printf echo echo
+	grep -eu 'quoted text' 2>/dev/null local local
+	"$1" awk awk --verbose && "$1" readonly awk /usr/bin local | sed
+readonly test "$1" x=1 then then /usr/bin 'quoted text' echo
+cd x=1 test --verbose then
+	grep ${HOME} 'quoted text' sed "$@" "$1" /usr/bin $(pwd)
+	grep "$@" ${HOME} awk
+	x=1 then /usr/bin echo "$@" test grep cd done local
+$(pwd) done readonly && cd
+		&& 2>/dev/null && printf grep cd done sed cd "$1" done &&
+		test cd && | -eu 'quoted text' "$@" local 'quoted text'
+		"$1" -eu && 'quoted text' --verbose echo
+| local done 'quoted text' 2>/dev/null test -eu
+then | awk | --verbose awk readonly readonly 2>/dev/null then then readonly
+	${HOME} -eu cd "$@" "$@" --verbose printf /usr/bin -eu | echo
+		done sed "$1" "$@" --verbose $(pwd) test grep "$1" echo local echo test
+-eu 2>/dev/null -eu -eu
+"$1" cd "$@" $(pwd) echo
+	test --verbose test $(pwd) "$1" cd && && 2>/dev/null echo awk cd sed cd done
+		test then --verbose sed "$@" ${HOME}
+	cd export "$@" $(pwd) --verbose "$1" "$1" x=1 readonly
+	awk $(pwd) "$1" && "$@" printf -eu | && readonly $(pwd) awk "$@" local
+	x=1 grep ${HOME} | /usr/bin | 2>/dev/null "$1" /usr/bin
+x=1 awk 2>/dev/null && --verbose grep ${HOME} export echo && 'quoted text'
+	sed x=1 /usr/bin local
+${HOME} x=1 printf local /usr/bin 2>/dev/null
+x=1 -eu /usr/bin local && printf 'quoted text'
+	readonly export 'quoted text' $(pwd)
+	sed 2>/dev/null -eu "$1" "$@" 2>/dev/null && -eu -eu echo awk 2>/dev/null
+echo printf 'quoted text' printf test readonly
+x=1 $(pwd) printf 'quoted text' && cd /usr/bin readonly /usr/bin
+	--verbose local test export
+	export printf cd | && x=1
+	x=1 /usr/bin echo readonly echo grep -eu
+	${HOME} printf then test "$@" done && done
+	--verbose -eu done cd --verbose
+	grep awk /usr/bin | grep 'quoted text' then 2>/dev/null x=1 ${HOME}
+		local local done awk 2>/dev/null echo
+		sed && $(pwd) done grep ${HOME} sed printf cd $(pwd) test
+done done 2>/dev/null then sed /usr/bin awk "$1" local
+export && awk readonly awk --verbose | grep --verbose
+	then test export export export test sed then 2>/dev/null printf
+		readonly printf ${HOME} --verbose local printf
+		${HOME} sed echo cd echo done export | ${HOME} && printf "$@" awk readonly
+local x=1 done grep "$@" then echo sed readonly
+	awk 2>/dev/null export test grep echo $(pwd) grep cd local
+		awk cd printf echo sed awk --verbose echo 'quoted text'
+		readonly awk export then printf
+	printf x=1 cd /usr/bin 'quoted text'
+	test x=1 "$@" readonly -eu export printf /usr/bin printf -eu sed && /usr/bin
+test awk echo test cd echo done grep x=1 local grep sed then
+test cd readonly local echo local readonly local
+sed done printf sed echo && && readonly
+"$@" then test echo printf cd done && 2>/dev/null local
+	"$@" -eu echo awk 2>/dev/null
+	-eu test x=1 | x=1 --verbose awk then /usr/bin "$@" && "$@" /usr/bin 2>/dev/null
+test | echo local 2>/dev/null test then local 2>/dev/null test
+local then awk $(pwd) $(pwd) export
+		${HOME} ${HOME} grep echo
+export "$@" --verbose "$1" sed "$1" | printf readonly -eu "$@" then 2>/dev/null
+		awk test printf 2>/dev/null | /usr/bin 'quoted text'
+$(pwd) sed $(pwd) sed "$@" then grep 'quoted text' $(pwd) readonly
+		printf local local printf
+&& then "$1" x=1 echo sed sed done test awk -eu "$@" test grep
+		"$1" local $(pwd) cd | && grep then printf
+		"$@" test sed -eu "$1" export && 'quoted text' -eu 2>/dev/null | readonly
+	cd --verbose /usr/bin grep done | echo $(pwd) test then printf --verbose local
+cd x=1 sed grep | echo "$1" then echo "$@" 2>/dev/null 'quoted text' then local
+	'quoted text' | then $(pwd) sed 2>/dev/null cd ${HOME} done
+		"$@" 'quoted text' x=1 | "$@" -eu then sed cd echo
+	printf --verbose x=1 /usr/bin then --verbose
+	x=1 readonly 'quoted text' readonly $(pwd) "$@" /usr/bin done awk "$1"
+readonly 2>/dev/null local
+		awk $(pwd) | readonly export then "$@" x=1 --verbose echo
+x=1 sed printf "$1" 'quoted text' export /usr/bin sed
+		sed readonly awk x=1 export /usr/bin 2>/dev/null
+		"$1" 'quoted text' done sed grep --verbose local && | then $(pwd)
+echo sed local $(pwd) echo $(pwd) x=1 "$1" echo -eu 2>/dev/null sed | /usr/bin
+		&& "$1" 2>/dev/null 2>/dev/null awk $(pwd) test "$1" awk sed | sed "$@" printf
+2>/dev/null printf $(pwd) ${HOME} 'quoted text'
+		export local x=1 sed awk | export /usr/bin
+	echo ${HOME} ${HOME} export grep export echo export readonly --verbose
+	--verbose export 'quoted text' "$1" awk "$@"
+		2>/dev/null ${HOME} local "$1" --verbose 'quoted text'
+		x=1 "$1" 2>/dev/null 2>/dev/null ${HOME} printf
+	test export 2>/dev/null 2>/dev/null readonly grep echo printf -eu done export
+grep && printf 'quoted text'
+		x=1 done && $(pwd) "$@" /usr/bin "$1" sed && sed | "$@" printf awk x=1
+		/usr/bin then "$1" &&
+		grep | /usr/bin $(pwd) 'quoted text' x=1 -eu test echo echo done grep
+	grep "$@" cd local /usr/bin then x=1 then -eu local printf export
+	"$@" readonly export sed then -eu
+		"$1" done ${HOME} cd echo awk "$1" echo readonly 'quoted text' 2>/dev/null "$@"
+		printf echo "$@" ${HOME} then -eu | readonly "$@" x=1 test sed
+	grep -eu -eu done "$@" export "$1" echo && readonly sed x=1 | local |
+test | sed "$1" 2>/dev/null
+printf "$@" --verbose && test "$@" 'quoted text' local ${HOME}
+		local readonly ${HOME} done --verbose $(pwd) "$@" printf -eu
+		2>/dev/null grep done cd
+echo --verbose 2>/dev/null
+		cd --verbose readonly "$1" readonly printf done printf cd awk
+export test cd 'quoted text' ${HOME} /usr/bin "$1" grep local printf -eu echo
+${HOME} 'quoted text' "$@"
+/usr/bin printf echo &&
+-eu "$@" /usr/bin --verbose done cd 2>/dev/null "$@" awk x=1 readonly grep
+	export x=1 2>/dev/null
+		awk cd grep then grep $(pwd) "$@" cd $(pwd) export
+		$(pwd) /usr/bin sed then readonly test x=1 | "$1"
+	readonly export printf test grep then echo $(pwd) 'quoted text' x=1
+	${HOME} "$@" readonly echo $(pwd) grep 2>/dev/null
+	/usr/bin sed | 2>/dev/null cd 2>/dev/null "$1" "$@" 'quoted text'
+sed grep test 2>/dev/null "$@" "$1" cd ${HOME} 2>/dev/null |
+export x=1 /usr/bin sed /usr/bin x=1 x=1 readonly test then
+readonly /usr/bin test then cd echo ${HOME} local x=1 "$1" && -eu $(pwd)
+x=1 | printf test grep then && | cd 'quoted text' done "$@"
+	done export 'quoted text' printf cd sed
+	export local -eu && local then "$1" 'quoted text' printf done ${HOME}
+"$1" grep readonly test awk export x=1 readonly
+	--verbose awk sed $(pwd) awk cd
+2>/dev/null sed readonly readonly --verbose
+	--verbose /usr/bin awk 'quoted text'
+awk --verbose | grep then grep export local x=1 | grep test && awk export | x=1
+	${HOME} -eu sed "$@" sed && /usr/bin readonly cd "$1" export
+		readonly $(pwd) done sed $(pwd) echo --verbose && test && readonly $(pwd)
+		/usr/bin && local export 2>/dev/null
+		'quoted text' test readonly && ${HOME} local
+	test "$1" export && local
+	"$@" x=1 -eu -eu sed readonly ${HOME} "$1"
+echo x=1 $(pwd) readonly printf --verbose | --verbose 'quoted text' cd x=1 &&
+"$1" x=1 done --verbose && export && awk echo awk 2>/dev/null ${HOME} "$1" awk
+	${HOME} then "$1" 'quoted text' | then test 2>/dev/null
+	'quoted text' echo -eu 2>/dev/null | "$1" then x=1 then 2>/dev/null && x=1 sed readonly
+		"$1" readonly cd cd echo awk
+then && 2>/dev/null export sed 2>/dev/null /usr/bin "$@" "$1" -eu done sed --verbose
+		grep echo 'quoted text' printf x=1 "$1" x=1 grep
+	${HOME} x=1 grep -eu 2>/dev/null
+		cd export done done export
+	grep --verbose "$1" grep $(pwd) grep | /usr/bin "$1"
+	'quoted text' && $(pwd) awk --verbose
+echo 2>/dev/null grep -eu awk 2>/dev/null ${HOME} ${HOME} export
+awk | 'quoted text' ${HOME} then done ${HOME} printf local printf
+	cd cd | --verbose && local --verbose grep readonly "$@" export "$@" "$1" local
+	--verbose $(pwd) printf done /usr/bin test export done -eu x=1 $(pwd) awk grep
+export | ${HOME} then $(pwd) then
+export "$1" readonly grep && awk local done | local && echo
+		export -eu 2>/dev/null awk /usr/bin done
+	cd then printf export echo
+		${HOME} 'quoted text' "$@"
+echo "$1" | 'quoted text' printf --verbose cd
+		echo x=1 -eu grep x=1 "$1" --verbose echo awk then cd
+		&& "$@" -eu 2>/dev/null ${HOME} x=1
+		-eu test | local -eu readonly "$@"
+	'quoted text' ${HOME}
+	local --verbose done then /usr/bin | done printf --verbose $(pwd)
+		$(pwd) readonly "$@" 2>/dev/null "$@" grep -eu
+"$1" cd 'quoted text' readonly "$1" | -eu x=1 cd "$1" local sed /usr/bin cd 2>/dev/null
+	local 'quoted text' $(pwd) 2>/dev/null
+		2>/dev/null $(pwd) | sed
+done test 'quoted text' --verbose echo grep
+		awk cd then then "$@" x=1 --verbose
+&& "$@" cd done -eu 'quoted text'
+		sed local --verbose 2>/dev/null x=1 readonly &&
+		done cd ${HOME} local awk -eu $(pwd) done sed x=1 /usr/bin printf
+echo /usr/bin test test echo "$1" grep cd -eu test printf
+grep export $(pwd) sed then ${HOME} "$@" then echo -eu then
+--verbose -eu readonly local echo x=1 awk grep cd
+done ${HOME} done sed test
+		sed "$1" | 2>/dev/null 'quoted text' grep printf then 2>/dev/null
+	${HOME} $(pwd) "$1" cd cd grep echo x=1
+		--verbose && "$@" && --verbose "$@" awk /usr/bin -eu -eu &&
+	sed then $(pwd) $(pwd) x=1 ${HOME} 'quoted text' test 'quoted text'
+		x=1 sed -eu then sed printf "$1" awk 'quoted text' x=1 local done 'quoted text'
+	export -eu local | && export cd
+		printf x=1 echo && 2>/dev/null printf --verbose test 2>/dev/null grep sed 'quoted text'
+sed test && && awk grep
+		"$1" export cd "$@" awk done
+	| /usr/bin x=1 test readonly 2>/dev/null
+		-eu grep done sed && sed --verbose export "$@" done 2>/dev/null ${HOME} ${HOME}
+		/usr/bin printf | local export
+		'quoted text' local echo printf 2>/dev/null | cd awk "$1" && awk awk
+"$1" then -eu "$1" 2>/dev/null
+		"$@" 2>/dev/null echo --verbose $(pwd) grep test
+$(pwd) --verbose printf awk ${HOME} 2>/dev/null printf | x=1 test test printf
+	sed 2>/dev/null && export local
+	"$1" done $(pwd) "$1" export awk 'quoted text'
+then sed cd "$1" cd $(pwd) local sed
+	export test export "$1" test 'quoted text'
+		'quoted text' && done "$@" /usr/bin local
+	export 2>/dev/null x=1 'quoted text' echo grep export
+&& 2>/dev/null | sed readonly done "$@" done cd 'quoted text' test
+	"$@" cd x=1 | x=1 sed /usr/bin $(pwd)
+		awk -eu "$@" "$1" -eu local --verbose local "$1" --verbose
+	then -eu export readonly 2>/dev/null x=1 --verbose /usr/bin grep test echo &&
+	test x=1 | printf printf "$1" "$@" 2>/dev/null
+		x=1 export test | sed "$1" $(pwd) test 'quoted text' 2>/dev/null
+awk sed then sed | && cd sed cd 'quoted text' sed test "$@" x=1 && 'quoted text'
+	awk sed test x=1 'quoted text' echo local 'quoted text' x=1 'quoted text' export
+		then "$1" ${HOME} echo printf -eu
+		printf readonly 2>/dev/null local
+	readonly x=1 done echo -eu $(pwd) /usr/bin cd && --verbose
+	| sed cd -eu && then done --verbose test
+cd --verbose local /usr/bin echo then sed x=1 done "$@" grep test local /usr/bin
+	-eu sed then export | sed grep grep -eu "$@" done
+	${HOME} | -eu export awk sed "$1" readonly
+2>/dev/null grep $(pwd) ${HOME} -eu readonly --verbose $(pwd) 'quoted text'
+		&& | --verbose 'quoted text' "$1" x=1 export && -eu $(pwd) test
+export "$@" awk ${HOME} /usr/bin
+	&& test /usr/bin -eu export echo test
+grep echo export readonly ${HOME} --verbose printf echo printf
+	test /usr/bin --verbose done --verbose sed grep awk ${HOME} "$@" grep
+--verbose sed cd then echo printf grep 'quoted text' 2>/dev/null then -eu x=1
+		&& done && && 2>/dev/null $(pwd) "$1" grep --verbose done
+		/usr/bin /usr/bin -eu -eu sed /usr/bin 2>/dev/null && awk $(pwd)
+	'quoted text' --verbose then readonly x=1 /usr/bin sed &&
+		'quoted text' export $(pwd)
+		"$@" printf cd cd sed 'quoted text' sed
+| then "$@" ${HOME} then
+		done local x=1 ${HOME} "$1" cd local test 'quoted text'
+test -eu then sed grep --verbose --verbose done
+x=1 grep ${HOME} grep "$@" readonly | ${HOME} test 'quoted text'
+'quoted text' printf readonly sed /usr/bin test 'quoted text' grep test && "$1"
+	| x=1 -eu test then export sed "$@" grep then /usr/bin --verbose then
+		| export export /usr/bin echo then "$1" grep test then
+	"$1" printf cd "$@" test 2>/dev/null &&
+		test $(pwd) export x=1 -eu x=1 -eu echo done printf
+	sed printf | cd local --verbose | export "$@" /usr/bin -eu cd
+		grep done 2>/dev/null echo echo then 2>/dev/null sed sed | printf
+		readonly test "$@" local test
+		${HOME} readonly sed 2>/dev/null 'quoted text' readonly
+	printf ${HOME} grep "$1" local cd cd grep
+		2>/dev/null --verbose ${HOME} awk printf done
+	'quoted text' x=1 test export cd 'quoted text' 'quoted text' cd |
+		--verbose awk x=1 x=1 echo test awk echo --verbose printf readonly 2>/dev/null ${HOME}
+--verbose sed echo sed then 'quoted text' cd ${HOME} --verbose printf printf
+		done "$@" /usr/bin sed export export $(pwd) printf
+	printf sed sed then ${HOME} sed readonly | cd $(pwd) done readonly
+		--verbose | readonly then ${HOME} local done
+	"$1" 'quoted text' readonly
+		--verbose $(pwd) --verbose export echo then grep grep awk echo export test x=1
+		test --verbose grep then echo readonly printf export /usr/bin done echo /usr/bin
+	sed done | local local readonly
+		"$@" test | printf ${HOME} cd -eu ${HOME} grep && grep sed x=1 --verbose
+sed 'quoted text' --verbose ${HOME} cd then
+	readonly test "$1" $(pwd) -eu -eu echo && &&
+2>/dev/null cd export test test "$@" && 'quoted text'
+		--verbose test | x=1 export printf
+"$1" -eu 'quoted text' export /usr/bin | awk done ${HOME}
+| echo "$@" && test readonly sed then readonly awk /usr/bin | grep
+		"$@" awk ${HOME} && --verbose cd sed then -eu test --verbose readonly
+	'quoted text' done test then grep 2>/dev/null -eu awk awk ${HOME} $(pwd)
+		2>/dev/null local $(pwd) | done echo then awk --verbose "$1" local export
+	export awk printf test --verbose "$@"
+	echo cd $(pwd) grep x=1 && test -eu readonly ${HOME} /usr/bin test
+		printf && sed 'quoted text' grep --verbose "$1" && x=1 readonly -eu awk awk
+		/usr/bin done test | echo then readonly 'quoted text' /usr/bin
+"$@" readonly local | echo printf | printf | export
+cd echo local then local
+	'quoted text' 'quoted text' | 'quoted text' --verbose sed
+		--verbose 2>/dev/null grep ${HOME} awk && cd ${HOME} "$@" 'quoted text'
+	"$1" then sed "$@" sed 2>/dev/null sed && --verbose
+| "$1" "$@" ${HOME} 2>/dev/null grep
+sed --verbose local printf
+--verbose local && ${HOME} -eu 2>/dev/null
+2>/dev/null --verbose cd -eu done cd $(pwd) grep 'quoted text'
+	local x=1 | then readonly sed -eu echo "$@" && -eu then |
+	2>/dev/null then /usr/bin
+/usr/bin printf local 'quoted text' readonly x=1
+		done done "$@" ${HOME} done cd "$1" sed 'quoted text' export "$1" 2>/dev/null
+${HOME} -eu grep && "$@" "$@"
+	x=1 | "$1" -eu readonly "$@" readonly
+	echo "$1" sed grep 'quoted text'
+	${HOME} readonly sed grep awk "$@"
+		--verbose then then /usr/bin
+		readonly sed -eu grep /usr/bin test "$@" 'quoted text'
+2>/dev/null | sed $(pwd)
+	sed printf 'quoted text' 2>/dev/null
+${HOME} --verbose 2>/dev/null grep test grep grep x=1 done | echo
+	$(pwd) && /usr/bin --verbose local local done
+echo awk "$@" 'quoted text' sed local sed "$@"
+	"$1" --verbose x=1 export
+	then printf | readonly --verbose
+	"$1" readonly printf $(pwd) sed grep "$1" 'quoted text' | echo ${HOME}
+		${HOME} echo "$1" | /usr/bin printf $(pwd) printf local -eu -eu sed readonly
+cd -eu "$@" readonly "$1" && grep printf export "$@" "$@" export local -eu
+echo cd && x=1 | $(pwd) readonly then printf -eu readonly echo 'quoted text'
+2>/dev/null 'quoted text' then /usr/bin | 2>/dev/null
+		test then grep printf sed then /usr/bin && 2>/dev/null
+		sed "$1" && --verbose cd 'quoted text' $(pwd) --verbose "$@" x=1 | printf
+		"$@" export $(pwd) sed x=1
+--verbose sed "$@" "$1" -eu ${HOME} "$1"
+cd /usr/bin "$1" awk awk ${HOME} sed "$@" ${HOME} test 2>/dev/null
+		$(pwd) ${HOME} "$@" 'quoted text' grep x=1 local | readonly
+	awk sed "$@" -eu -eu --verbose x=1 export export
+		cd "$@" | "$1" | cd "$1" /usr/bin x=1 cd readonly awk awk grep grep
+awk --verbose $(pwd) x=1 printf
+		cd --verbose printf local -eu /usr/bin -eu awk -eu local test "$@" ${HOME}
+local printf export && "$1" local /usr/bin /usr/bin echo $(pwd)
+sed readonly export "$@" awk "$@" readonly local --verbose x=1 /usr/bin test printf
+		$(pwd) readonly && "$1" $(pwd) ${HOME} done printf | awk -eu /usr/bin awk grep
+--verbose test -eu 'quoted text' local grep && export
+export "$1" awk echo sed $(pwd) "$1" then awk $(pwd) |
+		awk --verbose readonly printf
+	grep local $(pwd) printf 'quoted text'
+		done 'quoted text' ${HOME} -eu -eu done grep export --verbose awk $(pwd)
+	local local cd "$@" 'quoted text' grep
+		export cd -eu cd && then export /usr/bin
+		$(pwd) ${HOME} "$@" echo test --verbose 2>/dev/null 2>/dev/null
+--verbose local && 2>/dev/null then awk 'quoted text' -eu x=1 export local --verbose
+		sed | grep "$@" export "$@" test local
+readonly grep export done -eu local export sed local
+/usr/bin 'quoted text' awk --verbose test /usr/bin -eu --verbose
+		&& done 2>/dev/null local | 'quoted text' printf /usr/bin 'quoted text' grep
+		$(pwd) printf then then && export test local test /usr/bin export
+		cd ${HOME} grep && ${HOME} && 'quoted text' "$@"
+		'quoted text' --verbose /usr/bin export /usr/bin x=1 $(pwd)
+		'quoted text' then |
+local x=1 printf | "$@" "$@" local cd x=1 local local local test test
+		readonly -eu "$@" "$1" sed --verbose readonly readonly "$1" done test test
+2>/dev/null echo 2>/dev/null
+		-eu "$@" readonly && -eu $(pwd)
+		grep awk then sed | "$1" then $(pwd) 2>/dev/null done $(pwd)
+-eu --verbose x=1 cd ${HOME} grep test readonly printf x=1 echo $(pwd)
+	'quoted text' echo grep | export awk "$@" local | 'quoted text' export
+		awk ${HOME} --verbose && echo readonly
+	--verbose "$1" awk test $(pwd) sed -eu export "$@" awk
+done done | test $(pwd) -eu -eu cd
+	"$1" 'quoted text' done done
+$(pwd) "$@" 'quoted text' sed "$@" $(pwd) local grep "$@"
+	--verbose $(pwd) -eu | 'quoted text' printf test readonly --verbose
+	export ${HOME} ${HOME} echo echo "$1" grep && sed | x=1 printf x=1 local
+sed $(pwd) --verbose then local then "$@" printf ${HOME} local echo "$@" local
+		"$1" -eu cd | x=1 local --verbose -eu
+		printf "$1" sed sed -eu 'quoted text' $(pwd) printf
+		printf "$@" cd done --verbose | sed test /usr/bin | && ${HOME} printf
+awk done 'quoted text' --verbose x=1 printf "$1" test
+	test | local 2>/dev/null "$1" grep --verbose | --verbose x=1
+		readonly test && then ${HOME} 2>/dev/null ${HOME} "$1"
+&& && /usr/bin cd then
+		echo 'quoted text' printf
+	${HOME} ${HOME} readonly
+	$(pwd) grep /usr/bin test && --verbose awk 2>/dev/null $(pwd) printf
+"$1" printf export 2>/dev/null x=1 grep local /usr/bin
+	2>/dev/null local $(pwd) local 2>/dev/null "$@" ${HOME} -eu grep
+--verbose echo export "$@" "$1"
+export awk readonly local 2>/dev/null 'quoted text' -eu awk "$1" --verbose
+	printf $(pwd) "$@" /usr/bin $(pwd) local awk
+		'quoted text' done 'quoted text' then export "$1"
+		export "$1" $(pwd) "$@" echo ${HOME} then export "$@" then 'quoted text'
+	local then cd cd --verbose test /usr/bin printf 2>/dev/null 2>/dev/null export
+2>/dev/null done local printf readonly
+	"$1" --verbose $(pwd) && $(pwd) printf sed then /usr/bin grep --verbose awk
+		'quoted text' "$@" 2>/dev/null done &&
+		| && cd printf test sed local local done -eu --verbose
+cd readonly export x=1 /usr/bin local sed x=1 echo
+-eu then "$1" $(pwd) test export x=1 /usr/bin 2>/dev/null grep then
+	printf x=1 /usr/bin cd "$@" done then | --verbose sed cd test ${HOME} then
+	echo 2>/dev/null readonly echo 2>/dev/null 'quoted text' && grep
+		cd "$1" /usr/bin | grep printf export 'quoted text' -eu local ${HOME}
+x=1 /usr/bin "$@" -eu &&
+		x=1 printf $(pwd) export printf readonly
+	test "$@" x=1 "$@" "$@" export export test cd /usr/bin export done printf x=1
+$(pwd) then "$1" $(pwd) x=1 | 2>/dev/null
+		grep && /usr/bin 'quoted text' --verbose 'quoted text'
+		2>/dev/null | "$@" local && $(pwd) x=1 && -eu --verbose
+		"$@" /usr/bin 2>/dev/null "$1" then | grep
+		${HOME} export "$@" 2>/dev/null local --verbose
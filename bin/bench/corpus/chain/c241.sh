@@ -0,0 +1,2001 @@
+awk then 'quoted text' awk cd $(pwd)
+'quoted text' 2>/dev/null ${HOME} printf
+export export printf | sed printf local "$1" 2>/dev/null --verbose "$@" cd
+x=1 sed "$1" readonly 'quoted text' cd 'quoted text'
+$(pwd) sed && "$@" test 2>/dev/null 'quoted text' "$@" 2>/dev/null /usr/bin
+	cd --verbose echo export --verbose "$@" x=1 test /usr/bin
+2>/dev/null grep done local x=1 --verbose printf local
+		done cd "$1" "$@" export awk sed
+	then "$1" x=1 && cd cd sed --verbose ${HOME} x=1 test done done ${HOME} awk
+	&& then export /usr/bin sed grep done then echo readonly cd
+	"$1" "$1" local grep grep done test 'quoted text' cd sed 'quoted text' $(pwd)
+	x=1 'quoted text' ${HOME} 2>/dev/null local /usr/bin 2>/dev/null
+"$@" test done sed done "$1" printf local export local
+echo "$1" cd 2>/dev/null 2>/dev/null
+		echo --verbose /usr/bin --verbose printf test ${HOME} cd
+		then export awk cd export 'quoted text' 'quoted text'
+test awk "$1" grep then 2>/dev/null test --verbose then grep
+	done then "$@" done | 2>/dev/null "$1" export
+/usr/bin 'quoted text' then export echo | -eu -eu && test local awk
+		2>/dev/null awk "$@" cd grep /usr/bin "$@" 'quoted text'
+		/usr/bin grep grep sed /usr/bin ${HOME} "$@" --verbose
+&& $(pwd) export awk sed $(pwd)
+sed test cd printf test echo then cd readonly done && readonly then
+--verbose test test then ${HOME} readonly export --verbose &&
+	2>/dev/null then 'quoted text' printf done --verbose done
+then awk "$@" --verbose -eu | export readonly cd 2>/dev/null
+/usr/bin readonly /usr/bin 'quoted text' ${HOME} --verbose echo done done grep
+test "$@" x=1 --verbose --verbose printf printf printf $(pwd)
+	'quoted text' test export local /usr/bin /usr/bin then $(pwd) | test $(pwd)
+	cd grep ${HOME} readonly "$1" "$1" && awk
+	$(pwd) grep grep /usr/bin
+		'quoted text' done | echo --verbose "$@"
+${HOME} $(pwd) /usr/bin -eu 2>/dev/null echo printf done echo 'quoted text'
+		"$@" local | awk then then cd x=1 then && 'quoted text' then --verbose 'quoted text'
+		local && grep --verbose then $(pwd) grep 2>/dev/null ${HOME} done grep
+--verbose local echo done --verbose echo readonly ${HOME} $(pwd)
+		local echo test cd -eu 2>/dev/null awk
+	x=1 "$1" x=1 test /usr/bin local --verbose 'quoted text' printf
+		2>/dev/null echo /usr/bin 'quoted text' -eu echo local && 'quoted text'
+	echo then readonly && export local local
+		2>/dev/null sed done then sed cd 'quoted text'
+	/usr/bin cd export | ${HOME} /usr/bin readonly
+		export printf "$@" "$1" ${HOME}
+	'quoted text' local 2>/dev/null x=1 awk local 'quoted text' then sed then grep
+	-eu $(pwd) readonly $(pwd) cd done
+	"$@" printf printf 2>/dev/null 2>/dev/null awk
+		'quoted text' --verbose -eu | -eu | local cd local done
+	cd echo export then sed | awk done "$@" sed $(pwd) printf
+	cd --verbose "$1" test local readonly local test x=1 done sed x=1 awk /usr/bin
+--verbose printf local "$@" -eu local echo done --verbose | --verbose echo local
+	cd export test $(pwd) sed /usr/bin
+		printf done export done && readonly local | 'quoted text'
+		x=1 readonly /usr/bin "$@" local && awk
+		${HOME} && grep 2>/dev/null done --verbose "$@" "$1" awk 2>/dev/null
+	awk /usr/bin awk cd cd 'quoted text' "$1" x=1
+	echo "$@" printf ${HOME} $(pwd) x=1 2>/dev/null -eu | && --verbose --verbose
+export x=1 ${HOME} test /usr/bin grep cd test && cd 'quoted text'
+export awk "$@" sed readonly
+		echo echo "$1" x=1 "$@" echo local
+	local cd done 2>/dev/null awk /usr/bin -eu then printf && "$@" then sed
+		printf ${HOME} x=1 --verbose cd --verbose cd
+	echo export ${HOME} then "$1" 'quoted text'
+	$(pwd) export x=1 export $(pwd) /usr/bin 'quoted text' "$@" "$1" ${HOME} ${HOME}
+		done readonly printf export local $(pwd) export grep export cd
+		done 2>/dev/null then ${HOME} then then local | export
+		"$1" local sed test done 2>/dev/null $(pwd) 'quoted text' "$@" test 'quoted text'
+		2>/dev/null "$1" cd /usr/bin
+		then then cd echo -eu ${HOME} $(pwd) "$1" /usr/bin export test cd && printf cd done
+	"$1" -eu "$@" sed "$@" test grep 2>/dev/null 'quoted text' sed "$@" --verbose 'quoted text'
+	done grep test x=1 ${HOME} cd /usr/bin
+local | awk | grep cd test
+	--verbose cd x=1 cd export ${HOME}
+	&& 2>/dev/null then /usr/bin local
+		${HOME} "$1" "$@" echo cd "$@" awk | awk
+&& test awk $(pwd) echo export readonly test -eu "$@" sed --verbose
+"$@" x=1 "$1" done 2>/dev/null
+	cd $(pwd) printf printf ${HOME} test grep awk ${HOME}
+		test 2>/dev/null "$@" printf
+		| -eu && 2>/dev/null 'quoted text' 'quoted text' 2>/dev/null local 2>/dev/null
+		sed 2>/dev/null done done 2>/dev/null "$1" echo "$@" | done
+	sed && 2>/dev/null 2>/dev/null
+		printf export $(pwd) 2>/dev/null
+done "$@" then --verbose done && "$@" x=1 ${HOME} /usr/bin x=1 local
+	grep echo awk x=1 test | export echo export
+	sed -eu then /usr/bin echo echo sed x=1 sed
+		export grep awk cd "$@" test export done done "$@" printf test readonly done
+		${HOME} /usr/bin x=1 awk sed /usr/bin --verbose awk
+sed grep echo readonly readonly
+		2>/dev/null printf local x=1 /usr/bin
+	printf 'quoted text' | export && echo 2>/dev/null
+		"$@" ${HOME} 'quoted text' x=1
+	x=1 test cd cd /usr/bin
+	test 2>/dev/null readonly awk local $(pwd)
+		then 2>/dev/null "$@" "$@"
+	/usr/bin cd ${HOME} && local readonly local 2>/dev/null
+	&& printf $(pwd) $(pwd) readonly "$@" then | then cd
+		&& local x=1 "$@" && /usr/bin ${HOME} cd /usr/bin printf $(pwd) printf
+		/usr/bin && | 'quoted text' cd then -eu readonly then | $(pwd) -eu readonly test
+	'quoted text' test printf 'quoted text' "$1"
+	printf done x=1 export
+	then then then local "$@" "$@" x=1 readonly export then ${HOME} test printf
+&& ${HOME} --verbose awk grep grep
+		| done "$@" test -eu readonly awk && "$1" export | ${HOME} local test
+	awk /usr/bin sed x=1 export sed ${HOME} export
+	local 'quoted text' | printf awk cd --verbose local
+test then x=1 "$1" "$@" echo -eu awk && x=1 "$@" readonly
+		printf /usr/bin -eu 'quoted text' cd test && 2>/dev/null x=1 test
+${HOME} done cd sed readonly sed done | readonly -eu --verbose sed echo 'quoted text'
+	&& export awk sed $(pwd) echo
+		/usr/bin | "$@" "$1" printf local
+done "$1" --verbose readonly
+${HOME} 'quoted text' 'quoted text' -eu sed
+		&& 'quoted text' "$@" grep sed sed awk
+	export sed readonly x=1 echo | then echo -eu x=1
+--verbose sed printf "$1" && -eu sed && /usr/bin | local printf $(pwd)
+		local --verbose awk readonly
+'quoted text' printf $(pwd) echo ${HOME} "$1" export
+"$@" then 'quoted text' local then done | then 'quoted text'
+		$(pwd) awk $(pwd) cd ${HOME} 2>/dev/null local -eu grep test then readonly
+	grep done cd | local local | done && local
+done $(pwd) && echo then | 'quoted text'
+		| x=1 done local printf -eu export ${HOME}
+	grep | "$@" grep ${HOME} -eu done 'quoted text' awk $(pwd) "$1" && ${HOME}
+| echo done then readonly ${HOME} 'quoted text' "$@" export
+	done cd && awk readonly echo ${HOME} $(pwd) "$@" cd /usr/bin
+	cd then grep echo /usr/bin awk grep grep
+x=1 then "$@" x=1 then -eu -eu && ${HOME} sed "$1" printf
+		/usr/bin ${HOME} | done done test sed /usr/bin && cd then
+"$1" && sed echo "$@" /usr/bin "$1" then
+		--verbose export printf -eu 'quoted text' "$1" |
+export 'quoted text' echo /usr/bin "$1" ${HOME}
+echo --verbose export cd 2>/dev/null grep "$@" "$1"
+	printf | && 'quoted text' x=1 done readonly --verbose printf "$1" grep
+	"$@" && local export 2>/dev/null
+	${HOME} awk /usr/bin "$@" ${HOME} printf /usr/bin awk
+		$(pwd) test sed test done done --verbose x=1 awk && 'quoted text' /usr/bin
+		&& local 2>/dev/null x=1 test cd --verbose | | $(pwd) x=1 then -eu
+		echo test --verbose /usr/bin sed readonly
+$(pwd) /usr/bin readonly sed x=1 $(pwd) "$@"
+		local test awk /usr/bin awk local
+		"$@" cd local export --verbose then 'quoted text'
+		| local export ${HOME} && --verbose echo ${HOME} export "$@"
+/usr/bin then $(pwd) ${HOME} then sed
+	export "$@" 'quoted text' $(pwd) "$1" 'quoted text' | done
+echo local test echo /usr/bin x=1 $(pwd) ${HOME} --verbose
+	done $(pwd) -eu awk x=1 'quoted text'
+&& -eu ${HOME} readonly then local then readonly then sed grep $(pwd)
+	-eu local echo 'quoted text' sed "$1"
+/usr/bin sed echo "$@" x=1 2>/dev/null "$@" then
+		'quoted text' "$@" done
+		-eu readonly ${HOME} local echo --verbose | /usr/bin echo ${HOME} cd readonly
+awk grep x=1 | echo readonly awk 'quoted text'
+	-eu test done sed done 2>/dev/null test printf --verbose $(pwd)
+	-eu -eu 'quoted text' x=1 cd printf cd awk ${HOME} awk "$1" $(pwd)
+		/usr/bin | grep "$1" | $(pwd) --verbose
+	&& export 2>/dev/null grep printf sed
+		then then awk local "$@" /usr/bin ${HOME}
+	/usr/bin export $(pwd) grep printf grep export grep export &&
+		printf local printf 'quoted text' 2>/dev/null readonly 2>/dev/null
+		--verbose printf cd readonly /usr/bin
+	grep done 'quoted text' readonly $(pwd) grep 'quoted text'
+		awk /usr/bin "$1" 2>/dev/null then test
+		sed $(pwd) awk grep "$1" -eu sed cd ${HOME} then --verbose && /usr/bin
+	local /usr/bin "$@" done cd x=1 readonly
+		grep test cd export --verbose
+		echo done cd local $(pwd) -eu 2>/dev/null readonly sed export x=1 | test
+	test && && echo "$1" x=1 readonly cd test printf
+		printf | 2>/dev/null test test cd local readonly "$@"
+	then $(pwd) --verbose && sed 2>/dev/null sed
+	-eu /usr/bin export then cd sed 2>/dev/null
+	| export 2>/dev/null awk "$1" printf "$1" awk
+	awk "$@" "$@" export done | grep -eu ${HOME} -eu printf export
+		| export readonly ${HOME} then --verbose --verbose test export
+done --verbose grep then
+echo grep then export done
+	-eu grep done $(pwd) export --verbose ${HOME}
+test | printf export | 'quoted text' 'quoted text'
+test printf --verbose readonly x=1 2>/dev/null | --verbose
+-eu done -eu -eu | 'quoted text'
+		--verbose cd export sed sed sed "$1" printf done | awk test
+	test sed sed local local readonly export export /usr/bin then ${HOME} awk
+	"$1" local echo sed $(pwd) /usr/bin readonly
+		$(pwd) test sed done $(pwd)
+		${HOME} 'quoted text' | grep ${HOME} done readonly test ${HOME}
+	/usr/bin $(pwd) | export local printf && done
+	-eu readonly $(pwd) | readonly ${HOME}
+	&& readonly ${HOME} then x=1 'quoted text' -eu
+grep grep echo | echo "$@" -eu done x=1 "$1"
+grep -eu "$@" | readonly test x=1 'quoted text' "$@" | export echo grep
+		"$@" x=1 && "$1" local test echo readonly && "$@" readonly --verbose
+		awk x=1 -eu readonly "$1" export export grep export
+	2>/dev/null -eu --verbose
+		export -eu ${HOME} cd ${HOME} x=1 $(pwd) local /usr/bin $(pwd) ${HOME} local
+printf test /usr/bin printf done sed && export readonly test && readonly /usr/bin
+echo cd export readonly sed awk export 2>/dev/null 2>/dev/null | -eu
+		'quoted text' cd then | echo
+	"$@" 2>/dev/null export printf awk
+	done sed export local ${HOME} readonly 'quoted text'
+		then echo --verbose awk $(pwd)
+export x=1 2>/dev/null echo "$@" x=1 echo $(pwd) "$@" 2>/dev/null x=1
+--verbose "$1" test | /usr/bin --verbose test
+	${HOME} -eu readonly 2>/dev/null
+		then -eu /usr/bin local cd grep awk && | cd test x=1
+	2>/dev/null test done "$1" ${HOME} | --verbose awk then "$1"
+		local awk "$1" export printf echo | /usr/bin grep -eu
+'quoted text' sed $(pwd) awk && export 'quoted text' local echo sed sed readonly
+readonly | | grep x=1 grep ${HOME} sed && /usr/bin $(pwd) "$1"
+	sed local export ${HOME}
+&& "$@" 2>/dev/null printf "$@" ${HOME} "$1" -eu test -eu "$1" --verbose local
+		local "$@" -eu grep then 2>/dev/null $(pwd) then then cd 2>/dev/null readonly
+		echo && echo echo | then local printf $(pwd) /usr/bin sed --verbose "$@"
+		echo && "$1" /usr/bin 'quoted text'
+$(pwd) -eu 2>/dev/null readonly
+		| local | x=1 ${HOME} local sed -eu local echo
+test local | then "$@" echo "$1" 2>/dev/null cd then test
+		"$@" printf -eu export local export awk export
+	'quoted text' 'quoted text'
+awk local $(pwd) local grep export ${HOME} readonly export --verbose $(pwd)
+	export cd "$1" then -eu /usr/bin 2>/dev/null
+	| && --verbose done 2>/dev/null
+	| | | && --verbose local "$@" "$1" &&
+	grep local export x=1 /usr/bin awk 'quoted text' grep
+		test -eu /usr/bin x=1 | grep printf export grep | --verbose done
+	$(pwd) sed /usr/bin local echo $(pwd) "$@"
+		2>/dev/null awk local --verbose --verbose awk awk then "$@" 'quoted text'
+	printf export "$1" export
+echo sed then sed then cd "$1" done grep test x=1 printf awk 'quoted text'
+then "$@" local echo sed "$1" cd && echo
+		export 'quoted text' awk
+	then echo $(pwd) echo ${HOME} $(pwd) -eu
+	'quoted text' ${HOME}
+	x=1 done --verbose 'quoted text' "$@" x=1 && -eu && readonly done -eu
+	export printf "$1" 2>/dev/null
+	&& $(pwd) "$1" sed -eu printf awk x=1 cd "$1" 2>/dev/null && export grep
+		done --verbose "$@" $(pwd) "$1" "$1" echo $(pwd)
+		-eu done --verbose test && done /usr/bin export
+cd then then 'quoted text'
+sed printf $(pwd) done /usr/bin | 'quoted text'
+		test "$@" test done test 2>/dev/null
+	done echo awk x=1 echo
+	${HOME} echo echo --verbose grep awk -eu
+cd && export echo "$@" readonly done awk
+	done && echo && echo "$1" export --verbose done
+		cd test /usr/bin -eu export
+		test sed $(pwd) 'quoted text' echo 2>/dev/null sed
+		--verbose -eu && && && -eu grep awk x=1 'quoted text' 'quoted text' export
+		printf local "$1" "$1" /usr/bin | cd test sed sed export
+	| 2>/dev/null echo -eu && "$1" ${HOME} done done sed
+printf done sed printf echo test sed $(pwd) echo done grep echo
+		${HOME} then printf echo grep | sed -eu "$@" 'quoted text' "$1" "$1"
+		"$1" awk "$1" cd $(pwd)
+		done done local 2>/dev/null "$@"
+		printf "$1" 'quoted text'
+echo sed 2>/dev/null | local 2>/dev/null awk | /usr/bin readonly /usr/bin
+local grep sed ${HOME} ${HOME} 2>/dev/null && readonly --verbose echo
+	then "$@" x=1 -eu 2>/dev/null
+	&& --verbose local | --verbose echo awk x=1 x=1 --verbose | local grep /usr/bin
+x=1 | sed export printf cd done -eu export grep readonly grep awk
+-eu /usr/bin then "$1" then local x=1 test "$@" "$@" then local "$1" "$@" export
+	printf export awk printf printf grep "$@"
+		$(pwd) readonly then grep
+grep done x=1 echo grep grep /usr/bin "$1" done -eu --verbose ${HOME}
+done local --verbose test 'quoted text' ${HOME} local then
+		$(pwd) grep then export done "$@" then cd done $(pwd) echo echo 2>/dev/null | -eu
+	readonly -eu --verbose export && -eu $(pwd) -eu grep "$@"
+echo awk then grep test local
+		test $(pwd) | -eu 2>/dev/null then then readonly x=1 sed
+	printf echo 'quoted text' echo 'quoted text' grep 'quoted text' local sed sed
+		test -eu done export test $(pwd) printf export "$1" x=1 test test -eu
+	"$@" --verbose $(pwd) printf --verbose awk done ${HOME} echo done
+		then && | awk then "$@" cd -eu 2>/dev/null
+	&& test readonly 2>/dev/null 'quoted text' "$1" /usr/bin sed then -eu
+		echo grep echo x=1 $(pwd) "$1" /usr/bin 'quoted text'
+		'quoted text' && grep sed export /usr/bin "$@" && --verbose
+	then /usr/bin done export done /usr/bin
+		/usr/bin ${HOME} echo test | ${HOME} printf sed test 'quoted text'
+	readonly local grep cd export done x=1 local readonly 2>/dev/null grep |
+	2>/dev/null ${HOME} test
+'quoted text' local | cd x=1 $(pwd) awk $(pwd) printf | /usr/bin 2>/dev/null
+		&& export | echo x=1 "$@" grep echo echo done echo /usr/bin
+	${HOME} ${HOME} 'quoted text'
+		"$@" -eu cd grep export test /usr/bin
+		export ${HOME} done sed sed --verbose echo
+	/usr/bin done export export then local readonly
+2>/dev/null echo "$@" | 2>/dev/null "$1" grep local /usr/bin
+	awk --verbose "$1" -eu readonly x=1 grep cd readonly done --verbose then
+		x=1 local -eu printf 'quoted text'
+printf | /usr/bin test --verbose ${HOME} 'quoted text' --verbose done
+		&& then sed --verbose
+$(pwd) grep test sed "$@"
+	'quoted text' && 'quoted text' printf /usr/bin grep
+		sed cd cd cd && 2>/dev/null test --verbose $(pwd) x=1
+		done grep done echo local grep cd
+local readonly awk cd sed x=1 echo "$1" cd $(pwd) printf awk -eu -eu printf 2>/dev/null
+	printf "$@" x=1 then && sed /usr/bin then "$1"
+	$(pwd) grep awk && test "$1" 2>/dev/null
+		export echo awk --verbose cd | printf done echo x=1 cd done "$1" "$@"
+export local then x=1 readonly awk 2>/dev/null awk cd -eu
+$(pwd) "$@" printf $(pwd) "$@" printf local awk 'quoted text'
+		awk "$@" done ${HOME} done sed readonly
+	-eu 2>/dev/null then $(pwd) x=1 printf
+	readonly awk 'quoted text' awk cd && --verbose x=1 done readonly sed export
+export sed 2>/dev/null
+	x=1 grep x=1 printf /usr/bin x=1 done test --verbose
+	test | && test x=1 && awk 'quoted text' -eu cd cd -eu sed x=1 -eu
+echo -eu "$1" 2>/dev/null echo -eu 'quoted text'
+	done -eu x=1 "$@" 2>/dev/null x=1 2>/dev/null 'quoted text'
+&& echo export test /usr/bin $(pwd) -eu x=1 --verbose
+	sed "$@" printf test ${HOME} then done && test printf
+-eu grep grep export echo sed then ${HOME} && /usr/bin then grep cd then -eu
+		-eu /usr/bin --verbose ${HOME} x=1 test "$1" readonly test 'quoted text' "$1"
+"$1" 'quoted text' "$@" export $(pwd) "$1" sed ${HOME} sed echo
+		cd done readonly 2>/dev/null && printf 2>/dev/null then echo
+${HOME} test 2>/dev/null && printf x=1 --verbose
+-eu 2>/dev/null printf test | awk
+		--verbose 2>/dev/null 2>/dev/null ${HOME} printf "$1" x=1 echo export
+cd -eu export awk ${HOME} "$1" "$@" 2>/dev/null && | grep
+cd sed export local | test test x=1 && 'quoted text'
+		&& --verbose echo x=1 /usr/bin -eu export "$@" && readonly then $(pwd) readonly
+	| then $(pwd) grep 'quoted text' done readonly 2>/dev/null echo
+then echo test ${HOME} readonly /usr/bin readonly local local $(pwd)
+		-eu sed printf sed cd
+readonly grep export "$@" local
+		cd done x=1 test -eu ${HOME} echo then -eu awk 'quoted text' --verbose ${HOME}
+	local readonly echo grep $(pwd) "$1" | ${HOME} sed echo awk echo echo sed
+		/usr/bin -eu --verbose test /usr/bin then done test --verbose && sed -eu grep
+		2>/dev/null awk then 2>/dev/null
+	sed readonly -eu && "$@" ${HOME} &&
+		sed x=1 done readonly printf cd "$1" && export then echo
+	--verbose --verbose --verbose
+| $(pwd) cd "$1" test x=1 test awk
+		awk cd sed awk sed awk x=1 export done $(pwd) ${HOME}
+	export "$1" --verbose $(pwd) test readonly "$1" echo export readonly
+sed | readonly grep "$1" 'quoted text' local
+		${HOME} --verbose "$1" grep 'quoted text' test sed /usr/bin $(pwd)
+/usr/bin readonly --verbose test export
+		readonly | export awk printf
+	'quoted text' printf "$1" then printf "$1" awk --verbose 2>/dev/null
+2>/dev/null | test | 2>/dev/null -eu echo ${HOME}
+	2>/dev/null export ${HOME} ${HOME} 'quoted text' grep echo readonly readonly
+| $(pwd) sed echo -eu "$@" local grep printf
+local "$1" && "$1" cd readonly ${HOME} local cd | awk $(pwd) "$@" | &&
+2>/dev/null "$@" awk && readonly x=1 grep $(pwd) done /usr/bin
+		| local "$1" sed 2>/dev/null /usr/bin echo grep 'quoted text'
+	"$@" done /usr/bin echo --verbose test grep test $(pwd)
+local sed then then $(pwd) x=1 export echo then && "$1" --verbose
+		&& 'quoted text' $(pwd) readonly local readonly "$@" export grep grep $(pwd)
+		x=1 sed local ${HOME} --verbose /usr/bin --verbose "$@" grep export awk -eu
+	${HOME} cd readonly 2>/dev/null awk /usr/bin --verbose 2>/dev/null
+	export then x=1 cd -eu then && x=1 test echo grep --verbose
+		readonly printf test local && -eu ${HOME} "$@"
+	readonly cd && awk -eu local $(pwd) sed sed echo x=1 ${HOME} "$@"
+sed "$@" x=1 'quoted text' then $(pwd) done done cd local
+	x=1 x=1 | grep sed /usr/bin
+-eu printf then $(pwd) ${HOME}
+		"$1" ${HOME} grep readonly local -eu test grep
+	local 'quoted text' readonly export done 'quoted text'
+	echo grep printf | "$1" -eu done cd test printf | cd "$1" 'quoted text' --verbose
+	printf export "$@" sed $(pwd) ${HOME}
+| local $(pwd) export "$1" $(pwd) export x=1 -eu grep test | awk ${HOME}
+	"$1" printf export "$@" echo readonly -eu --verbose && echo grep
+	echo local awk echo --verbose --verbose 'quoted text' | "$@" test done ${HOME}
+		-eu --verbose readonly test local readonly readonly echo then $(pwd) echo readonly
+sed readonly printf /usr/bin awk x=1 export ${HOME} | export $(pwd) 2>/dev/null
+		export $(pwd) grep x=1 grep && -eu && | echo | 2>/dev/null
+		$(pwd) then sed -eu /usr/bin "$1" cd readonly grep printf cd awk
+		2>/dev/null "$@" -eu done /usr/bin ${HOME} export local
+		test | -eu 'quoted text' 2>/dev/null ${HOME} export cd 2>/dev/null | x=1
+done printf && grep export -eu x=1 "$@" cd readonly test then -eu x=1
+	${HOME} awk readonly
+| readonly "$@" $(pwd) "$1" "$@" test test grep --verbose
+	grep $(pwd) readonly "$1" export "$@" grep cd
+	x=1 --verbose /usr/bin
+		grep export x=1 2>/dev/null && "$@" cd export
+	echo sed ${HOME} 2>/dev/null awk local export "$1" x=1 -eu /usr/bin
+cd done $(pwd) awk sed local --verbose && test grep /usr/bin -eu x=1 'quoted text'
+		grep printf awk test done /usr/bin -eu ${HOME} awk grep | awk $(pwd)
+'quoted text' grep local printf x=1 test 2>/dev/null --verbose
+	&& cd "$1" -eu 2>/dev/null cd /usr/bin 'quoted text' then "$1" done "$1" sed
+	-eu $(pwd) then awk $(pwd) | ${HOME} awk readonly /usr/bin local x=1 sed sed
+	export sed 'quoted text' printf cd 'quoted text' test 2>/dev/null test
+	"$1" printf grep "$@"
+$(pwd) 'quoted text' then 2>/dev/null then echo cd done ${HOME} sed && &&
+	/usr/bin && printf -eu
+	readonly grep readonly -eu echo echo ${HOME} /usr/bin --verbose 'quoted text'
+		awk ${HOME} done $(pwd) "$@" 2>/dev/null printf
+		grep -eu sed --verbose test cd 'quoted text' -eu $(pwd) export /usr/bin
+		readonly grep grep echo sed export sed ${HOME} sed awk ${HOME} $(pwd) --verbose
+		${HOME} 'quoted text' "$1" --verbose done 'quoted text'
+		"$1" x=1 ${HOME} "$1" done awk 'quoted text'
+	cd | printf grep --verbose cd 2>/dev/null
+		"$1" "$1" cd | export x=1 printf
+		readonly -eu | then cd sed echo awk 2>/dev/null export
+	"$@" x=1 -eu $(pwd) "$@" done done ${HOME} x=1 grep
+	then -eu export x=1 printf -eu
+2>/dev/null printf &&
+"$@" awk test /usr/bin test "$@" "$@" then local && ${HOME} done --verbose | test
+		readonly then $(pwd) 2>/dev/null --verbose then
+	-eu | && echo then "$1" "$1" local
+	| cd "$1" local "$@" echo &&
+-eu $(pwd) export 2>/dev/null done -eu sed /usr/bin && export awk readonly
+	&& --verbose awk 'quoted text' | cd
+export -eu done "$1" 'quoted text' printf "$@" "$1" done ${HOME} test
+		${HOME} --verbose && "$1" export x=1 local test -eu 'quoted text'
+		grep 'quoted text' local cd readonly /usr/bin $(pwd) $(pwd) printf
+		awk done grep echo ${HOME} test 'quoted text'
+grep awk grep x=1 | awk "$@" export -eu local $(pwd)
+	test then echo awk local local
+		/usr/bin printf | sed local grep echo -eu awk sed | && cd x=1 | cd echo
+	"$1" -eu echo sed /usr/bin --verbose /usr/bin && grep echo
+		2>/dev/null printf -eu &&
+	&& x=1 --verbose grep x=1 readonly test export ${HOME} x=1 then /usr/bin echo $(pwd)
+		readonly $(pwd) awk 2>/dev/null test "$1" $(pwd) | | printf /usr/bin echo
+readonly echo "$1" -eu 'quoted text' cd 2>/dev/null -eu 2>/dev/null &&
+"$@" awk then x=1 printf
+	2>/dev/null "$@" printf && export ${HOME} 2>/dev/null
+-eu export $(pwd) local $(pwd) test readonly -eu | echo done grep
+--verbose readonly cd local ${HOME} printf then awk --verbose done cd
+		done -eu cd 'quoted text' readonly echo x=1 printf
+		then grep test 'quoted text' done "$1" awk
+awk 2>/dev/null --verbose readonly x=1 export cd export
+	| 2>/dev/null $(pwd) awk test | "$@" cd then | --verbose
+		&& readonly | ${HOME} readonly printf
+	x=1 test -eu && printf sed done
+	"$@" readonly -eu /usr/bin readonly done $(pwd)
+then sed awk local printf x=1 echo sed awk sed test -eu x=1 /usr/bin "$1"
+cd x=1 ${HOME} && "$@" "$1" x=1 echo 'quoted text' export then |
+		-eu then export done | printf cd sed then x=1 sed "$1"
+	"$@" $(pwd) 2>/dev/null sed "$@" --verbose $(pwd) test echo 'quoted text'
+	&& awk "$1" | then then 'quoted text'
+		| local done local 'quoted text' test x=1
+	"$@" then ${HOME} --verbose sed | awk /usr/bin $(pwd)
+		local echo /usr/bin 'quoted text' echo --verbose
+--verbose done "$@" -eu sed 'quoted text' $(pwd) $(pwd) "$1" ${HOME}
+x=1 x=1 done done done export
+	echo "$@" $(pwd) --verbose test
+	cd | test printf && && sed printf done --verbose /usr/bin | ${HOME} /usr/bin
+2>/dev/null -eu local "$1" test printf readonly
+grep -eu sed local local
+	sed awk /usr/bin echo then | done x=1 "$1" done "$1" printf done -eu
+&& awk local grep "$@" "$@" printf /usr/bin x=1 awk ${HOME} sed grep ${HOME}
+		readonly x=1 test awk -eu sed "$1" grep printf local
+test readonly test test echo | 2>/dev/null done $(pwd)
+/usr/bin test 'quoted text' /usr/bin grep --verbose && grep
+		$(pwd) cd /usr/bin echo cd echo done -eu ${HOME} then | sed
+awk ${HOME} printf $(pwd) && test test test x=1 /usr/bin echo printf awk
+		readonly && -eu ${HOME} grep /usr/bin "$1" "$1" "$@" 'quoted text' && $(pwd)
+&& 'quoted text' | cd local
+		readonly echo printf test --verbose grep then 'quoted text' readonly /usr/bin
+	"$1" "$1" && ${HOME} --verbose cd test printf cd "$@" "$@" -eu cd done
+	then ${HOME} sed x=1 local echo local x=1 x=1
+	"$1" done readonly x=1 "$@" cd "$1"
+		grep echo readonly && $(pwd) local "$1" "$1" $(pwd)
+		done echo 2>/dev/null /usr/bin /usr/bin && $(pwd) "$@" printf
+		"$1" $(pwd) echo 'quoted text' test sed readonly export 'quoted text' local
+readonly && | done done "$1" printf local /usr/bin cd /usr/bin
+	"$@" 2>/dev/null test export cd echo -eu grep /usr/bin
+		--verbose $(pwd) x=1 "$@"
+	"$1" --verbose "$1" done ${HOME} --verbose done awk --verbose
+		then $(pwd) | local $(pwd) cd readonly
+		| test echo then printf done awk sed -eu then then
+x=1 done $(pwd) grep "$@" 2>/dev/null && export cd --verbose
+		test export -eu --verbose /usr/bin "$1" readonly readonly
+		sed local ${HOME} --verbose awk | done echo
+		then --verbose done local
+cd | -eu then -eu readonly grep "$@" export sed | "$@" readonly
+-eu x=1 export grep printf grep -eu readonly grep x=1
+done local $(pwd) awk grep sed --verbose then awk && awk 2>/dev/null
+echo echo then | then readonly && local awk "$1" export
+test ${HOME} grep export /usr/bin
+awk done awk $(pwd) echo --verbose --verbose done
+	awk echo test -eu --verbose ${HOME} "$@" printf readonly
+2>/dev/null echo --verbose "$@" done -eu awk test export
+cd && --verbose echo $(pwd) /usr/bin 2>/dev/null awk echo ${HOME}
+	printf cd awk cd grep "$1" 'quoted text' echo readonly
+	/usr/bin awk awk test sed then 2>/dev/null
+	then local "$1" x=1 printf x=1 test export done readonly "$@" cd "$1"
+sed done then "$1" -eu export | echo local $(pwd) sed printf awk
+		export awk test 2>/dev/null done
+		$(pwd) && grep done $(pwd) then awk "$1" $(pwd) | sed
+	printf export | x=1 "$1" -eu $(pwd)
+	${HOME} grep then && test readonly
+	/usr/bin --verbose cd echo export "$@"
+	export sed "$@" --verbose "$1" x=1 --verbose ${HOME} then then -eu grep test printf
+"$@" sed 2>/dev/null grep ${HOME} done local
+	readonly | test && awk then ${HOME} 'quoted text' grep
+local echo 'quoted text' 2>/dev/null --verbose /usr/bin 2>/dev/null "$@"
+		/usr/bin local 2>/dev/null -eu ${HOME}
+		readonly local test $(pwd)
+	grep readonly echo $(pwd) local readonly sed $(pwd) "$1" local then
+sed export 2>/dev/null local sed awk --verbose
+	--verbose -eu sed -eu $(pwd) readonly -eu "$@" sed
+	cd readonly --verbose && awk | -eu 'quoted text' 'quoted text' local
+	2>/dev/null "$1" "$@" "$1" then ${HOME} cd --verbose | awk x=1
+		${HOME} sed $(pwd) sed "$@" grep sed "$@" export
+	"$@" grep echo 2>/dev/null "$1" export printf
+done 'quoted text' $(pwd) done cd $(pwd) test
+		test -eu export grep
+	echo && "$@" awk local
+	$(pwd) 2>/dev/null printf test -eu awk sed "$1" echo done
+		readonly sed "$1" printf local
+	${HOME} 2>/dev/null $(pwd) local && export echo local done export --verbose printf
+	"$1" && && sed done x=1 "$@" readonly
+	${HOME} 2>/dev/null local && 'quoted text' test printf 'quoted text'
+	local | "$1" done sed && echo | sed cd grep grep echo x=1 grep
+	'quoted text' cd --verbose printf "$@" cd 2>/dev/null
+| done /usr/bin cd then 2>/dev/null
+sed --verbose --verbose "$1" sed --verbose local
+		then /usr/bin "$@" ${HOME} x=1 export
+"$@" "$1" local --verbose ${HOME} && | $(pwd) export x=1 -eu -eu sed $(pwd)
+	/usr/bin "$1" awk 2>/dev/null echo ${HOME}
+		export awk then then awk "$@" printf test test && 'quoted text'
+grep "$@" echo local 'quoted text'
+		test $(pwd) && | "$1" $(pwd) | ${HOME} grep printf export 'quoted text' grep
+	"$@" $(pwd) -eu x=1 then cd awk $(pwd) sed
+then done --verbose done cd 2>/dev/null
+'quoted text' sed then export "$1" | | /usr/bin ${HOME} | --verbose "$1"
+	/usr/bin readonly | readonly readonly /usr/bin ${HOME} "$@" "$@"
+		export then "$1" sed grep "$1" x=1 done cd echo /usr/bin x=1
+		${HOME} "$@" readonly readonly export echo awk --verbose
+		local done 2>/dev/null 'quoted text' x=1 then 'quoted text'
+	echo then /usr/bin ${HOME} --verbose --verbose
+local /usr/bin printf 'quoted text' readonly "$@" printf 'quoted text'
+	--verbose sed /usr/bin $(pwd) test then grep awk ${HOME} cd ${HOME} -eu
+		$(pwd) then local echo printf test |
+		-eu "$@" local 'quoted text' echo && test ${HOME} $(pwd)
+	export sed "$1" printf then -eu local
+	cd "$@" printf then test sed export 2>/dev/null
+	sed "$@" "$@" sed test local 2>/dev/null awk 2>/dev/null done "$1" awk 2>/dev/null
+		then --verbose test /usr/bin
+		--verbose then /usr/bin then ${HOME} done /usr/bin local | echo && cd "$1" local
+		cd $(pwd) export "$1" echo | sed cd printf printf --verbose
+readonly 'quoted text' "$1" ${HOME} awk $(pwd) -eu x=1 done done local x=1
+sed && $(pwd) -eu ${HOME}
+	x=1 -eu readonly x=1 grep x=1 echo printf x=1 --verbose --verbose
+x=1 x=1 /usr/bin && echo | x=1 then grep echo --verbose then && /usr/bin
+	$(pwd) x=1 cd 2>/dev/null readonly 'quoted text' echo
+	&& export done $(pwd) --verbose x=1 local export sed awk -eu
+		/usr/bin | cd $(pwd) $(pwd) 2>/dev/null
+		printf echo | ${HOME} done done x=1 printf local $(pwd) then grep
+	'quoted text' sed x=1 'quoted text'
+readonly test grep --verbose printf
+		grep done grep 'quoted text'
+		awk then then sed /usr/bin 'quoted text'
+	--verbose then | readonly
+	x=1 test "$1" cd cd cd /usr/bin sed grep
+		/usr/bin 2>/dev/null local && then && awk "$@" done printf readonly readonly
+		test ${HOME} printf local local echo x=1 2>/dev/null awk x=1
+	$(pwd) done $(pwd) -eu $(pwd) x=1 echo grep
+	--verbose then 'quoted text' 2>/dev/null grep awk printf 'quoted text'
+"$@" | test grep awk readonly "$1" "$@"
+&& /usr/bin test cd awk sed x=1 "$1" grep grep grep --verbose
+		then local test export ${HOME} /usr/bin /usr/bin done | test && done
+	export 'quoted text' grep export "$@" "$@" local
+	done readonly test export | sed "$@" printf ${HOME} "$1" -eu test | readonly
+/usr/bin /usr/bin 'quoted text' readonly -eu done /usr/bin
+	${HOME} awk -eu "$1" then readonly x=1 readonly --verbose export
+grep $(pwd) ${HOME} test "$1" printf printf -eu 2>/dev/null $(pwd)
+		grep | grep x=1 --verbose --verbose 'quoted text' readonly
+		done 'quoted text' sed /usr/bin export 'quoted text'
+$(pwd) done then echo x=1 $(pwd)
+readonly -eu cd test done ${HOME} -eu then -eu "$@" /usr/bin grep readonly
+	export "$1" | export "$@"
+		$(pwd) /usr/bin ${HOME} && $(pwd) cd sed
+		grep && then cd echo grep 2>/dev/null readonly
+&& --verbose export awk readonly printf export grep 2>/dev/null
+'quoted text' printf test -eu && "$@" ${HOME} "$@" test export 'quoted text'
+local x=1 /usr/bin grep | --verbose
+		grep 'quoted text' printf $(pwd)
+	readonly "$@" sed $(pwd) test local x=1 "$@" 'quoted text' &&
+--verbose "$@" $(pwd) $(pwd) export
+	local then sed then readonly then $(pwd) test grep sed | $(pwd) awk done done 2>/dev/null
+		"$1" readonly echo test /usr/bin | "$@"
+echo 'quoted text' then then test echo
+	/usr/bin x=1 'quoted text' grep x=1 sed /usr/bin cd "$1" grep 'quoted text'
+	sed | done $(pwd) --verbose | echo sed
+		"$@" awk && 2>/dev/null /usr/bin cd
+	-eu && "$1" 2>/dev/null readonly
+		$(pwd) grep --verbose ${HOME} --verbose x=1 $(pwd) readonly
+		printf | cd "$1" | done $(pwd) ${HOME} local x=1 --verbose "$@"
+cd awk /usr/bin local export then --verbose readonly 'quoted text'
+		"$1" grep /usr/bin printf $(pwd) && | then --verbose local printf "$@"
+readonly grep && readonly "$1" ${HOME} sed --verbose then "$@" awk
+grep sed $(pwd) x=1 readonly export && grep echo 'quoted text'
+"$@" readonly export printf 2>/dev/null
+		echo cd cd && 2>/dev/null 'quoted text' ${HOME} grep "$@" --verbose readonly
+export printf readonly export --verbose 'quoted text' then sed grep
+		test printf export export printf done x=1 /usr/bin awk /usr/bin
+		--verbose 'quoted text' "$1" $(pwd) && -eu $(pwd) readonly | then
+		export echo then ${HOME} sed cd 'quoted text'
+	$(pwd) $(pwd) -eu printf printf echo --verbose | /usr/bin echo awk ${HOME} 'quoted text'
+	export grep && -eu $(pwd) then /usr/bin readonly 2>/dev/null
+	awk "$@" | -eu 'quoted text' &&
+	cd -eu printf readonly -eu done 'quoted text'
+local cd "$1" "$@" local
+		2>/dev/null printf then
+x=1 printf $(pwd) "$1" then then
+	${HOME} | echo 'quoted text' cd
+	$(pwd) readonly echo "$@" && 2>/dev/null export | echo x=1 | --verbose done
+		/usr/bin ${HOME} test done
+done printf grep "$1" $(pwd) $(pwd) /usr/bin
+		x=1 readonly -eu ${HOME} &&
+		| x=1 readonly | test printf then $(pwd) grep ${HOME} local x=1
+done -eu awk printf ${HOME} "$1" /usr/bin -eu /usr/bin
+"$1" "$1" local 2>/dev/null
+local 2>/dev/null test $(pwd) /usr/bin echo
+		2>/dev/null grep -eu grep ${HOME} x=1 | sed printf | 2>/dev/null $(pwd) echo -eu
+printf x=1 2>/dev/null printf -eu /usr/bin && x=1 $(pwd) awk && sed 2>/dev/null
+	export export 2>/dev/null grep sed "$@"
+/usr/bin export "$1" local printf test x=1 cd /usr/bin | awk | awk /usr/bin
+	export | x=1 sed && | 'quoted text' --verbose $(pwd) --verbose grep $(pwd)
+-eu grep test done grep | printf
+		x=1 export echo export 2>/dev/null awk "$@" awk && "$1" done grep "$@" ${HOME}
+printf awk 2>/dev/null $(pwd) test "$@" | 2>/dev/null
+	then printf cd then echo echo "$1" --verbose awk /usr/bin grep grep cd 'quoted text'
+'quoted text' echo readonly
+sed -eu /usr/bin --verbose done printf local cd ${HOME} "$@" x=1 cd /usr/bin
+		test 'quoted text' && printf sed cd cd test export cd local sed x=1 printf
+		export test readonly ${HOME}
+		"$1" printf export grep ${HOME} grep readonly
+	/usr/bin --verbose awk ${HOME} cd cd then ${HOME}
+		done readonly awk cd readonly "$1"
+awk readonly 2>/dev/null --verbose
+test local local ${HOME} && && readonly 'quoted text' -eu "$1" $(pwd)
+		then --verbose done x=1 printf "$@" --verbose
+"$@" ${HOME} sed then local | 2>/dev/null printf awk "$1" grep
+&& 'quoted text' 'quoted text' 2>/dev/null --verbose grep
+	| local ${HOME} 2>/dev/null sed "$@" $(pwd) "$1"
+${HOME} done $(pwd) done echo echo echo export x=1 --verbose 2>/dev/null
+	| x=1 ${HOME} --verbose "$1" -eu readonly "$1"
+	local cd --verbose cd printf
+-eu 'quoted text' test | && --verbose "$1" readonly /usr/bin "$1"
+	done then echo 2>/dev/null
+	$(pwd) then /usr/bin "$@" printf
+		echo "$1" export awk export
+2>/dev/null readonly | x=1 awk "$1" /usr/bin $(pwd) ${HOME} && "$@" done awk
+test 2>/dev/null -eu sed "$1" grep sed awk | awk export awk ${HOME}
+printf cd && && "$@" readonly 'quoted text'
+	$(pwd) test awk done $(pwd)
+&& sed -eu readonly --verbose done grep local cd --verbose -eu $(pwd) --verbose
+		x=1 $(pwd) local -eu done cd -eu grep && "$1" printf 2>/dev/null "$@" $(pwd)
+	cd | -eu | readonly awk local "$1" "$@"
+	--verbose $(pwd) ${HOME}
+	-eu then printf /usr/bin export cd -eu
+	printf then $(pwd) 2>/dev/null export "$1" awk && "$1" echo
+	&& $(pwd) $(pwd) -eu then | sed $(pwd) cd -eu export 'quoted text' /usr/bin
+&& printf 2>/dev/null ${HOME} ${HOME} /usr/bin done
+test 2>/dev/null grep cd | && $(pwd) && cd |
+		/usr/bin grep /usr/bin grep && x=1 printf "$@" echo
+local x=1 2>/dev/null sed local | grep local readonly
+		cd | cd echo --verbose test export cd awk $(pwd) echo export printf done 'quoted text'
+	"$@" echo grep test grep printf -eu then x=1 -eu local 2>/dev/null
+		${HOME} ${HOME} 2>/dev/null x=1 && | grep --verbose sed $(pwd) "$@"
+	grep --verbose export ${HOME} sed done readonly 'quoted text'
+	&& awk /usr/bin done --verbose printf /usr/bin
+local | local then grep "$1"
+	echo done && -eu cd x=1 printf "$@" 2>/dev/null
+&& cd sed -eu 'quoted text' $(pwd) printf 2>/dev/null export
+	-eu 'quoted text' printf $(pwd) done ${HOME} export done cd test test then
+		cd ${HOME} export && x=1 printf "$@" ${HOME} readonly
+		-eu test printf grep test done export test --verbose cd
+	readonly cd 'quoted text'
+	awk ${HOME} grep ${HOME} printf echo echo 'quoted text' test $(pwd) "$@"
+		"$1" sed local $(pwd) local local
+	/usr/bin -eu $(pwd) "$1" cd cd /usr/bin export awk readonly echo $(pwd)
+		readonly then export grep awk && ${HOME} readonly -eu done -eu --verbose
+		test then ${HOME} export 2>/dev/null x=1 printf |
+&& 'quoted text' echo readonly done 'quoted text'
+	readonly x=1 printf --verbose --verbose cd 2>/dev/null | test "$@" ${HOME} test
+grep local echo "$@" readonly x=1
+		local 'quoted text' | readonly readonly cd --verbose ${HOME} cd --verbose
+		export printf && export x=1 ${HOME} --verbose 2>/dev/null "$@" local
+	then test readonly "$1" sed ${HOME} x=1 then cd printf export && --verbose 2>/dev/null
+	local cd /usr/bin "$@" "$1" done && x=1 awk grep -eu awk done 'quoted text' export
+then export 2>/dev/null awk cd test --verbose x=1 "$1" echo
+	"$1" | cd /usr/bin export test cd echo sed echo
+		readonly x=1 grep local readonly cd "$1" --verbose /usr/bin
+	export sed && echo --verbose ${HOME} && /usr/bin -eu | "$1"
+		grep "$@" | "$@" echo | -eu 2>/dev/null
+		&& | test "$@" test readonly
+		| /usr/bin $(pwd) printf
+		readonly -eu /usr/bin printf && cd readonly 'quoted text'
+then cd -eu "$1" cd 'quoted text' done done readonly -eu local
+		done then then x=1 "$@" -eu && grep test
+		grep /usr/bin done 'quoted text' export x=1 ${HOME} printf "$1"
+		export export test cd $(pwd) cd
+		then test 'quoted text' readonly | 'quoted text' ${HOME} printf 'quoted text'
+done && test && echo export 'quoted text' -eu printf x=1 $(pwd) then export
+	cd cd awk export ${HOME} /usr/bin "$1" cd ${HOME} sed test sed ${HOME} then
+		-eu test export sed ${HOME} done && echo test grep readonly awk 'quoted text'
+echo $(pwd) awk --verbose "$@" "$@" ${HOME} "$@" $(pwd) sed --verbose
+		local 2>/dev/null "$1" cd cd "$1" -eu && | grep then local "$1" $(pwd) export echo
+	/usr/bin "$@" readonly local x=1 awk printf --verbose --verbose printf done readonly
+		readonly "$1" done printf readonly echo $(pwd) $(pwd) "$1" /usr/bin
+		--verbose then 2>/dev/null cd x=1 echo then 'quoted text'
+printf -eu readonly awk done && test 2>/dev/null
+	$(pwd) "$@" then "$1" done test -eu -eu export export local "$@"
+		then awk awk "$1" ${HOME} cd local test 2>/dev/null
+		${HOME} awk sed --verbose sed --verbose "$1" echo --verbose
+	export 'quoted text' x=1 export ${HOME} && echo printf --verbose | "$1"
+		awk 2>/dev/null awk x=1 grep printf echo printf | export "$1" /usr/bin
+		grep readonly x=1 "$1" printf /usr/bin grep grep 'quoted text' --verbose
+		done echo $(pwd) sed 'quoted text' awk 'quoted text' x=1
+	cd --verbose /usr/bin x=1 --verbose
+		sed readonly cd | /usr/bin
+	grep $(pwd) sed printf done 'quoted text' $(pwd) cd cd grep
+		sed test | --verbose 'quoted text' --verbose sed && 'quoted text' grep done
+$(pwd) sed --verbose -eu awk grep printf "$@" local &&
+echo test "$@" 2>/dev/null "$1" ${HOME} grep done /usr/bin
+	then test $(pwd) test local local "$@" "$@" sed ${HOME} awk then 'quoted text'
+		cd ${HOME} /usr/bin $(pwd) sed cd ${HOME}
+2>/dev/null test 2>/dev/null --verbose 2>/dev/null
+then local grep cd echo test sed printf
+	${HOME} ${HOME} "$@" ${HOME} x=1 | done sed readonly --verbose export
+printf 'quoted text' echo -eu x=1 "$@"
+	then readonly awk grep then done "$@" /usr/bin awk done readonly $(pwd)
+	'quoted text' export 'quoted text' echo $(pwd) test --verbose local
+		&& then grep done export echo 'quoted text'
+"$@" 'quoted text' && echo /usr/bin printf -eu test
+${HOME} readonly local cd then
+| cd readonly --verbose 'quoted text' sed ${HOME} export
+	/usr/bin ${HOME} 'quoted text' done cd "$@" awk local | grep local 'quoted text'
+		| -eu /usr/bin /usr/bin 'quoted text' local cd -eu $(pwd)
+-eu 2>/dev/null readonly "$@" printf sed export grep awk done -eu then &&
+		grep "$@" done local
+		-eu awk sed 2>/dev/null local
+	"$@" --verbose echo cd printf $(pwd)
+	"$@" x=1 2>/dev/null sed export cd done export -eu --verbose && && --verbose
+	$(pwd) awk test | && then awk done "$@" test awk 'quoted text' printf
+	x=1 export awk done echo readonly then then cd 2>/dev/null
+		-eu export readonly echo export "$1" --verbose "$@" awk echo awk $(pwd)
+readonly | "$@" /usr/bin x=1 "$@" 2>/dev/null &&
+sed sed "$1" export 'quoted text' ${HOME} ${HOME} awk test $(pwd) sed 'quoted text'
+		then export done x=1 ${HOME} echo --verbose cd /usr/bin --verbose
+"$@" /usr/bin --verbose 'quoted text' x=1 "$1" && done test
+	x=1 printf readonly sed /usr/bin
+"$@" test done $(pwd) "$@" grep --verbose $(pwd)
+done grep grep echo awk done done grep "$@" "$@" readonly -eu $(pwd) done &&
+-eu test cd export $(pwd)
+		--verbose then awk printf echo test
+| ${HOME} echo && -eu /usr/bin sed /usr/bin then printf done "$1"
+export readonly /usr/bin sed done echo x=1 then 'quoted text'
+	export | 2>/dev/null readonly sed --verbose -eu grep 2>/dev/null
+		done done echo done --verbose --verbose done
+&& local readonly readonly "$@" grep readonly
+	--verbose then done 2>/dev/null
+	"$@" export grep local $(pwd) cd local then
+'quoted text' $(pwd)
+-eu sed awk 'quoted text' -eu then echo -eu ${HOME} printf "$@"
+		x=1 awk $(pwd) 'quoted text' ${HOME} 'quoted text' -eu
+		x=1 local export "$1" grep 2>/dev/null "$1"
+		"$1" local local --verbose 'quoted text' $(pwd) x=1
+-eu printf x=1 $(pwd) sed $(pwd) local readonly $(pwd) && |
+	'quoted text' /usr/bin sed echo awk then echo echo "$@" printf 'quoted text'
+	"$1" awk printf "$@" -eu done local 'quoted text'
+"$1" grep awk && | --verbose --verbose echo cd sed awk "$1" && printf && local
+		${HOME} sed ${HOME} | -eu then /usr/bin /usr/bin ${HOME} done done && /usr/bin
+export 'quoted text' awk --verbose x=1 awk "$@" printf --verbose | "$@" /usr/bin
+		test local printf sed ${HOME} 2>/dev/null "$@"
+		$(pwd) $(pwd) cd then ${HOME} "$@" "$@" done --verbose then "$1" "$@" then
+-eu ${HOME} awk test ${HOME} echo export /usr/bin /usr/bin "$1" "$@"
+	${HOME} $(pwd) printf done then cd sed awk done export
+		then sed /usr/bin grep done 2>/dev/null printf cd x=1 local x=1 export cd readonly
+${HOME} "$1" echo test done readonly && x=1 --verbose done
+/usr/bin export printf --verbose cd done awk then
+	$(pwd) | "$@" done x=1 test /usr/bin /usr/bin cd /usr/bin test echo
+export echo sed test "$@" grep printf cd echo cd 'quoted text'
+cd /usr/bin "$1" awk ${HOME} awk && cd "$1" sed cd awk -eu && awk readonly
+		grep ${HOME} "$@" $(pwd) grep printf grep |
+echo printf "$1" --verbose export grep && readonly echo grep then "$1"
+		local 2>/dev/null local "$@" 2>/dev/null ${HOME}
+	--verbose --verbose grep echo printf grep
+"$@" cd x=1 -eu x=1 /usr/bin
+		readonly ${HOME} 2>/dev/null --verbose /usr/bin
+	/usr/bin x=1 echo export --verbose && export
+	cd && ${HOME} local sed then export -eu then printf
+grep ${HOME} ${HOME} /usr/bin $(pwd) awk grep echo
+printf awk then then "$@" "$1" echo local --verbose grep ${HOME} done | export
+		awk test "$@" /usr/bin 'quoted text'
+		${HOME} printf awk "$1" "$@" /usr/bin
+		"$1" && "$1" "$@" $(pwd) awk --verbose ${HOME}
+		&& "$1" readonly readonly local then printf --verbose
+&& printf grep 'quoted text'
+	cd --verbose "$1" "$1" "$@" local -eu done
+&& grep && 2>/dev/null ${HOME} ${HOME} done -eu 'quoted text'
+		'quoted text' 'quoted text' "$@" | echo readonly &&
+	echo | test export | echo then "$1" grep
+		'quoted text' --verbose 'quoted text'
+		"$1" "$@" awk awk x=1 $(pwd) sed export export x=1 readonly
+2>/dev/null sed echo local "$@" ${HOME} /usr/bin awk "$1" -eu 'quoted text'
+	awk readonly x=1 local
+	x=1 "$1" then | sed printf x=1 then echo awk local local | 2>/dev/null x=1
+		2>/dev/null awk | printf then --verbose readonly sed cd ${HOME} sed
+		'quoted text' "$@" 2>/dev/null then "$1" test echo grep --verbose
+	--verbose grep printf then sed
+		cd && local && echo $(pwd) awk printf printf 'quoted text'
+		"$1" done done 2>/dev/null "$1" --verbose cd done done grep readonly 2>/dev/null
+	x=1 x=1 echo sed cd -eu test cd test x=1 $(pwd) done awk | then && $(pwd)
+	awk 2>/dev/null grep /usr/bin test sed grep local "$1" ${HOME}
+		${HOME} "$1" 'quoted text'
+		/usr/bin echo local | then | --verbose done $(pwd) | awk $(pwd) 'quoted text'
+		then --verbose $(pwd) $(pwd) done echo then readonly
+	export | test local printf 'quoted text' x=1 test /usr/bin readonly sed 'quoted text'
+	| echo echo -eu /usr/bin && -eu sed export $(pwd) | then then
+		/usr/bin awk export "$1" readonly echo printf then 2>/dev/null printf x=1 $(pwd)
+then done awk then printf readonly ${HOME}
+	echo | cd "$1" -eu echo awk test
+		export 2>/dev/null readonly grep
+		local "$1" then 'quoted text' cd echo ${HOME} "$1"
+--verbose -eu printf local && cd export printf
+	--verbose x=1 'quoted text' "$1" readonly then $(pwd) cd test
+		echo ${HOME} | echo then echo cd grep readonly 'quoted text'
+	cd done -eu local readonly cd $(pwd) local then "$1" echo | -eu grep
+then "$1" /usr/bin 2>/dev/null test "$1" echo
+done "$1" 2>/dev/null printf 'quoted text' x=1 2>/dev/null -eu test
+		${HOME} printf export 'quoted text' /usr/bin && then
+		local "$@" echo done then -eu
+	echo grep export sed then export && ${HOME} "$1" | -eu ${HOME}
+	"$1" readonly -eu awk then local printf grep -eu
+		'quoted text' cd echo sed cd test -eu cd done printf 'quoted text'
+		readonly test cd "$@" 2>/dev/null done readonly x=1
+		"$1" export | | grep echo cd ${HOME} echo -eu done -eu
+awk --verbose && sed done -eu | done 'quoted text'
+		test cd $(pwd) /usr/bin
+	| grep /usr/bin cd 2>/dev/null | --verbose
+		--verbose -eu echo printf readonly done ${HOME} "$1" "$1" --verbose
+		test export then then grep echo x=1 "$@" done "$@" local "$@" 'quoted text'
+awk -eu 'quoted text' test grep
+	echo "$@" $(pwd) /usr/bin x=1 x=1 --verbose local
+		local cd /usr/bin readonly printf local local "$@" x=1 done
+		/usr/bin --verbose ${HOME} -eu readonly
+-eu awk printf $(pwd) --verbose local /usr/bin awk local -eu $(pwd) printf
+-eu -eu echo echo local $(pwd) ${HOME} cd then local cd
+		2>/dev/null local | sed | sed local sed grep test
+local printf 'quoted text' then 2>/dev/null --verbose
+-eu test then 2>/dev/null grep "$@" sed printf $(pwd) cd && /usr/bin
+grep --verbose sed local local
+		${HOME} x=1 $(pwd) --verbose local readonly test x=1 awk grep printf
+local test awk cd | sed -eu |
+		'quoted text' "$1" && then
+	'quoted text' done ${HOME}
+	--verbose --verbose grep "$1" sed echo cd "$1" printf
+		done x=1 | printf grep done ${HOME} export
+	export /usr/bin ${HOME} ${HOME}
+	&& grep awk printf awk 2>/dev/null /usr/bin x=1 /usr/bin test grep --verbose
+readonly grep readonly printf 'quoted text' sed local local
+		grep sed awk test x=1 awk readonly --verbose local
+	export local | awk $(pwd) 2>/dev/null --verbose
+		done awk "$1" grep --verbose echo
+"$1" export test && printf && /usr/bin echo then printf && grep cd
+		test x=1 /usr/bin awk $(pwd) printf 'quoted text' then
+"$@" grep ${HOME} then && -eu readonly --verbose readonly
+	done -eu local readonly
+		"$1" x=1 2>/dev/null local 2>/dev/null awk && -eu /usr/bin
+	$(pwd) "$1" cd x=1 awk && printf
+		done then sed x=1 "$1" export export
+test 'quoted text' awk 2>/dev/null
+	echo test /usr/bin $(pwd) "$@" 2>/dev/null --verbose
+printf done echo local "$@" x=1 then readonly export ${HOME} 'quoted text'
+--verbose && printf --verbose
+		"$1" sed readonly /usr/bin "$1" 2>/dev/null | cd
+		x=1 done sed readonly done then grep awk -eu &&
+	printf ${HOME} export x=1 && local then test echo && | echo grep ${HOME}
+'quoted text' $(pwd) "$1"
+	echo cd test awk "$@" "$@" sed cd --verbose printf sed |
+grep done 'quoted text'
+	"$@" grep test | done --verbose printf local done
+awk sed "$@" test | printf 2>/dev/null 'quoted text' awk -eu echo
+		readonly printf printf
+	local sed 2>/dev/null test grep /usr/bin
+	local | grep $(pwd) awk printf then test | 'quoted text'
+	"$@" done --verbose ${HOME} export
+		test echo cd awk ${HOME} export ${HOME} && readonly test then /usr/bin
+		awk ${HOME} export 'quoted text'
+		readonly printf && 'quoted text' 'quoted text' cd readonly test awk && $(pwd)
+		${HOME} 2>/dev/null done /usr/bin | grep
+	/usr/bin cd --verbose echo printf then -eu done 'quoted text' "$1" /usr/bin $(pwd)
+		&& 2>/dev/null readonly test --verbose
+	export readonly sed then printf
+	cd done sed test -eu 2>/dev/null
+	readonly echo test -eu export -eu -eu sed /usr/bin ${HOME} "$@" x=1 'quoted text'
+		-eu export $(pwd) then export --verbose 'quoted text'
+		2>/dev/null echo grep $(pwd) 'quoted text'
+		grep local awk local awk 2>/dev/null ${HOME} cd test 'quoted text' --verbose test
+	| "$@" $(pwd) echo echo 'quoted text'
+		2>/dev/null echo awk /usr/bin "$@"
+		$(pwd) ${HOME} "$@" | 'quoted text' "$@" readonly
+	'quoted text' test 2>/dev/null cd sed awk done $(pwd)
+awk test "$1" && /usr/bin "$@" x=1
+		readonly /usr/bin sed | ${HOME} export -eu
+"$@" /usr/bin echo echo
+	grep cd -eu grep $(pwd) -eu | cd /usr/bin x=1 cd 2>/dev/null
+	--verbose cd cd x=1 test ${HOME}
+export 2>/dev/null echo cd "$@" done local "$@" 'quoted text' $(pwd) /usr/bin
+${HOME} local 2>/dev/null awk local $(pwd) awk | echo
+'quoted text' ${HOME} awk &&
+2>/dev/null 2>/dev/null -eu "$@" export awk then sed --verbose
+&& local printf cd grep /usr/bin
+	then "$1" 2>/dev/null grep "$@" readonly then x=1 done done /usr/bin
+		sed && awk && local 'quoted text' ${HOME} -eu test done
+	&& test ${HOME} | x=1 -eu -eu printf echo cd test sed readonly
+	/usr/bin 2>/dev/null "$1" "$1" local 'quoted text'
+	grep "$@" -eu ${HOME} done 2>/dev/null --verbose
+	"$1" readonly sed -eu --verbose sed cd awk --verbose
+	echo export export --verbose /usr/bin ${HOME} readonly 2>/dev/null
+		then done test done then ${HOME} | x=1 ${HOME} cd
+--verbose "$1" cd /usr/bin awk
+	/usr/bin done | echo 'quoted text' /usr/bin export $(pwd)
+	/usr/bin then readonly export test && 2>/dev/null export
+		$(pwd) local x=1 -eu grep export cd
+		awk export /usr/bin readonly
+	"$1" echo 'quoted text' ${HOME} x=1 awk local "$1" grep
+readonly awk cd $(pwd) test -eu 'quoted text'
+		/usr/bin x=1 --verbose x=1 grep export "$@" | local awk "$1" $(pwd) cd
+	sed -eu $(pwd) ${HOME} && sed export sed && printf
+		/usr/bin 'quoted text' done sed "$1" test echo "$@" printf
+	-eu --verbose "$1" "$@" --verbose
+		done awk /usr/bin readonly | $(pwd)
+		-eu cd done sed then "$@" "$1" awk done cd local printf local "$@" done cd x=1
+		grep printf 'quoted text' echo export /usr/bin local 2>/dev/null cd ${HOME}
+		$(pwd) then test "$@" "$@" grep
+export x=1 --verbose local "$1" "$@" grep test printf
+	test then done local readonly awk --verbose x=1 "$@" export && /usr/bin
+		2>/dev/null sed done awk ${HOME} grep test
+		readonly echo awk done local $(pwd) grep $(pwd) cd 2>/dev/null then | test
+done local ${HOME} "$1" local 2>/dev/null
+	echo "$1" grep -eu done then grep /usr/bin
+awk readonly done then readonly printf echo local
+		x=1 "$1" 2>/dev/null local test test then test test test 'quoted text'
+${HOME} && awk "$1" && ${HOME} local
+awk readonly "$1" "$1" export "$1" test -eu echo sed "$@" readonly ${HOME} test
+		then export grep cd && cd | then -eu ${HOME}
+export ${HOME} | | echo grep 'quoted text'
+	"$1" export echo --verbose "$@" ${HOME} $(pwd) x=1 grep | test readonly && | awk
+	&& readonly cd $(pwd) 'quoted text' export
+x=1 -eu $(pwd) && echo local test local --verbose x=1 local "$1" 2>/dev/null
+		printf export --verbose 2>/dev/null
+		/usr/bin "$1" export /usr/bin echo grep | | 'quoted text'
+		${HOME} test $(pwd) printf /usr/bin
+		"$1" x=1 ${HOME} /usr/bin
+	test test x=1 readonly 2>/dev/null 'quoted text' 'quoted text' awk test 2>/dev/null
+	--verbose printf -eu ${HOME} done then 2>/dev/null | /usr/bin
+		export && local $(pwd) export --verbose test && printf /usr/bin | && x=1 -eu
+-eu echo -eu printf 'quoted text'
+then ${HOME} ${HOME} && x=1 'quoted text' export 2>/dev/null grep
+--verbose -eu "$@" && && grep sed done printf echo sed -eu $(pwd) echo x=1 --verbose
+	grep 'quoted text' then local 2>/dev/null
+		2>/dev/null -eu cd printf
+	echo local | /usr/bin export echo && -eu readonly 'quoted text'
+		$(pwd) --verbose echo awk $(pwd)
+		echo readonly 2>/dev/null /usr/bin then done ${HOME} readonly
+	export "$1" export awk
+cd then local sed /usr/bin --verbose local -eu /usr/bin printf "$@" export printf
+		local ${HOME} then export awk 'quoted text' | awk echo
+		echo readonly -eu --verbose sed ${HOME} x=1 export 'quoted text'
+	'quoted text' "$1" cd ${HOME} echo | /usr/bin && awk /usr/bin "$@" export 'quoted text'
+	2>/dev/null | x=1 readonly cd echo --verbose test
+	grep 'quoted text' "$@" /usr/bin
+		sed 'quoted text' export printf readonly ${HOME} export 2>/dev/null done "$1" cd
+		-eu ${HOME} "$@" "$@" x=1 export printf $(pwd) then cd 2>/dev/null
+then x=1 $(pwd) cd cd $(pwd) $(pwd) done
+	test && 'quoted text' sed export --verbose done echo cd export /usr/bin
+then readonly then grep awk export done --verbose
+	cd 'quoted text' && -eu
+${HOME} done grep "$@" --verbose
+		$(pwd) local "$1" 'quoted text'
+-eu "$1" done 'quoted text' sed /usr/bin -eu 2>/dev/null
+-eu x=1 then grep x=1 test readonly -eu then
+	readonly $(pwd) 2>/dev/null --verbose 2>/dev/null
+'quoted text' && test x=1 --verbose done
+	2>/dev/null | grep printf printf printf 2>/dev/null --verbose
+		x=1 grep sed sed --verbose grep echo local /usr/bin sed then
+$(pwd) grep readonly sed x=1 x=1 /usr/bin done 'quoted text'
+	$(pwd) /usr/bin -eu readonly "$@" then printf local "$1" "$1" export done "$1"
+then done && readonly && readonly
+&& test "$1" 'quoted text' 'quoted text' local
+		$(pwd) && export sed then then x=1 "$1" cd awk 'quoted text' awk cd grep test
+test done test x=1 2>/dev/null
+	-eu $(pwd) then 2>/dev/null awk awk echo echo then sed /usr/bin
+local local readonly done --verbose readonly 'quoted text' grep
+"$@" then sed x=1 /usr/bin -eu
+		sed --verbose -eu "$@" "$1"
+		x=1 2>/dev/null "$1" "$1" test test 'quoted text'
+		echo then local readonly awk 'quoted text' --verbose "$1" 2>/dev/null test /usr/bin
+${HOME} ${HOME} sed "$@" printf /usr/bin export sed grep test export
+	export 2>/dev/null done local test echo --verbose
+	${HOME} $(pwd) -eu -eu $(pwd) ${HOME} ${HOME} $(pwd)
+		sed $(pwd) grep printf cd "$@" "$1" x=1 readonly grep echo cd "$1" cd
+	done printf && "$1" ${HOME} x=1 sed ${HOME} $(pwd)
+		local awk $(pwd) "$1" done done cd "$1" 'quoted text' 2>/dev/null cd then |
+		"$1" cd done grep -eu
+	printf 2>/dev/null "$@" test "$1" echo 2>/dev/null echo
+		done "$1" awk && | --verbose x=1 grep "$1" echo $(pwd)
+		echo x=1 && then | readonly "$@" readonly readonly 2>/dev/null local
+${HOME} /usr/bin && echo export awk local
+	"$@" grep grep test grep -eu "$1" ${HOME} /usr/bin --verbose printf "$1"
+local "$@" printf local test
+local x=1 'quoted text' test cd echo | | 2>/dev/null echo sed printf awk then
+		x=1 sed echo grep "$@" then
+		printf local /usr/bin "$1" printf ${HOME} sed awk x=1 "$1" done 2>/dev/null
+#include c242.sh
+		2>/dev/null printf export test
+		&& awk --verbose done awk /usr/bin 'quoted text' then
+awk --verbose readonly grep test | $(pwd)
+awk $(pwd) /usr/bin "$@" awk cd grep | "$@" cd readonly export
+	local -eu then export /usr/bin --verbose echo x=1 done cd cd
+	then local -eu /usr/bin --verbose sed $(pwd) awk 2>/dev/null
+	export $(pwd) 'quoted text' cd
+	test then && 2>/dev/null local awk "$@" local test | | "$1" | grep "$1" ${HOME}
+grep readonly cd 'quoted text'
+		grep test 2>/dev/null $(pwd) export --verbose x=1 /usr/bin readonly
+"$1" done readonly done 2>/dev/null
+readonly && -eu ${HOME} /usr/bin done awk "$1" /usr/bin readonly
+		'quoted text' 2>/dev/null done
+/usr/bin "$@" "$@" | test && "$1" --verbose ${HOME} grep
+	export $(pwd) "$@" | then $(pwd)
+	2>/dev/null /usr/bin | x=1
+	sed awk awk grep cd /usr/bin 2>/dev/null
+		local readonly export -eu -eu "$1" local done local "$@" echo | export ${HOME}
+		2>/dev/null "$1" then cd ${HOME} echo test readonly printf
+done --verbose awk printf "$@" ${HOME}
+		local readonly | awk "$1" test done printf /usr/bin
+	then 'quoted text' export local local readonly ${HOME} "$1" --verbose
+		"$@" test echo sed printf --verbose export | "$@"
+	readonly local test x=1 then readonly --verbose
+x=1 && local cd sed 'quoted text' 2>/dev/null
+		test grep printf && export -eu readonly sed
+		${HOME} readonly export 2>/dev/null $(pwd)
+printf sed ${HOME} 'quoted text' /usr/bin
+	printf export echo awk "$@" echo export readonly grep -eu
+	sed sed sed cd $(pwd)
+	"$@" -eu $(pwd) 2>/dev/null /usr/bin local then ${HOME}
+	${HOME} cd ${HOME} x=1 -eu && done | ${HOME} ${HOME} "$1" | $(pwd)
+	done --verbose $(pwd) 'quoted text' grep readonly
+"$1" export x=1 grep grep grep awk echo sed -eu sed done 2>/dev/null
+	local --verbose | x=1 2>/dev/null done -eu 2>/dev/null &&
+		readonly cd echo "$1" "$1" local
+		${HOME} readonly grep | --verbose "$1" -eu ${HOME}
+then --verbose "$@" awk cd test export printf test | | | then readonly cd "$@" grep
+		cd test readonly readonly x=1 /usr/bin
+--verbose && export cd -eu printf -eu "$1"
+	sed /usr/bin export 2>/dev/null 'quoted text' sed ${HOME} awk sed $(pwd)
+	-eu && $(pwd) /usr/bin "$@" sed local 2>/dev/null
+		readonly | awk "$1" 2>/dev/null
+test readonly 2>/dev/null test "$@"
+/usr/bin -eu "$@" readonly
+		echo "$1" grep local 2>/dev/null echo grep | echo echo "$1" && --verbose |
+	done -eu && readonly then cd --verbose | cd
+	--verbose "$@" echo x=1 done test sed then 'quoted text'
+		$(pwd) 2>/dev/null | --verbose local 2>/dev/null echo
+	printf grep echo test --verbose &&
+	| awk 2>/dev/null then export 'quoted text' | /usr/bin $(pwd)
+test test ${HOME} 'quoted text' local | grep $(pwd) ${HOME} | "$@" done echo
+	awk awk ${HOME} then 'quoted text'
+-eu cd printf && | test ${HOME} printf /usr/bin && test --verbose
+		&& "$@" cd "$1" readonly | local -eu export sed done --verbose test -eu $(pwd)
+$(pwd) && grep "$1" $(pwd) x=1 cd | echo 'quoted text'
+		'quoted text' grep /usr/bin /usr/bin
+x=1 --verbose /usr/bin grep && cd /usr/bin readonly echo 2>/dev/null &&
+export x=1 echo printf local --verbose ${HOME}
+		printf | cd awk --verbose cd && | then --verbose done "$@" cd grep sed
+	done done -eu 'quoted text' | -eu /usr/bin test $(pwd) export
+		echo awk echo "$1" "$1" awk /usr/bin x=1 -eu "$1" && awk /usr/bin ${HOME}
+		readonly grep | then test
+then test local "$@" echo $(pwd) grep 'quoted text' grep readonly
+		/usr/bin 2>/dev/null 2>/dev/null awk echo "$@" done
+	export grep "$@" echo grep awk echo 'quoted text'
+		then 'quoted text' 'quoted text' --verbose sed cd printf
+echo awk 'quoted text' -eu then
+	&& awk "$@" /usr/bin x=1 printf
+printf 'quoted text' sed "$@" test awk 2>/dev/null | "$@"
+$(pwd) $(pwd) then sed 2>/dev/null $(pwd) grep
+sed 'quoted text' cd && local x=1 echo "$@" grep 'quoted text'
+	cd ${HOME} $(pwd) --verbose readonly
+		test /usr/bin export test x=1 awk echo then 2>/dev/null
+readonly local sed grep "$1" x=1 test ${HOME} then | && $(pwd) --verbose printf
+	"$1" "$@" $(pwd) export $(pwd) "$1" export echo then export
+test export --verbose cd $(pwd) -eu ${HOME} export "$@"
+	local done export printf "$1" | 2>/dev/null cd && -eu x=1 echo
+		${HOME} "$@" x=1 awk local test
+		&& printf grep echo export "$@" echo cd cd "$@" ${HOME}
+	export done | 'quoted text' echo
+		echo | cd -eu sed | printf --verbose /usr/bin sed /usr/bin sed x=1 -eu
+		&& export sed $(pwd) 2>/dev/null $(pwd) -eu readonly cd export
+		cd | /usr/bin test then
+	2>/dev/null ${HOME} readonly grep --verbose | grep then grep export test -eu x=1
+	2>/dev/null export local 'quoted text' local readonly x=1 && 2>/dev/null --verbose
+	2>/dev/null $(pwd) x=1 local /usr/bin local sed | | export
+local awk done x=1 2>/dev/null 'quoted text'
+export test ${HOME} -eu awk ${HOME} /usr/bin
+export local awk printf sed echo /usr/bin export
+$(pwd) echo "$1" | awk && ${HOME}
+readonly cd local export printf readonly done export readonly --verbose | 'quoted text'
+		sed local 2>/dev/null $(pwd) 'quoted text' && export grep done 'quoted text'
+${HOME} awk $(pwd) awk then $(pwd)
+2>/dev/null /usr/bin 2>/dev/null --verbose sed awk local done
+'quoted text' --verbose
+		"$1" && export printf cd echo local ${HOME} printf echo x=1 sed echo
+grep "$1" awk "$@" ${HOME} grep cd 2>/dev/null "$1" awk
+	$(pwd) awk -eu local "$1" ${HOME}
+	"$@" local local printf "$1" printf x=1 done --verbose
+		-eu local | sed ${HOME} x=1 | "$1"
+		printf readonly 2>/dev/null then
+		then /usr/bin $(pwd) sed
+cd readonly ${HOME} then grep "$1" | --verbose grep 2>/dev/null cd "$1"
+	"$@" readonly done 'quoted text' x=1 grep printf && then printf
+		$(pwd) x=1 -eu sed export awk /usr/bin 2>/dev/null
+	2>/dev/null 'quoted text' sed readonly 2>/dev/null
+		/usr/bin then $(pwd) grep awk "$1" export export
+	done grep -eu done sed ${HOME} 2>/dev/null "$@" x=1 "$1" done && sed printf
+2>/dev/null then "$@" "$1" echo x=1 cd done "$1" | readonly
+done x=1 x=1 && 'quoted text' sed | done readonly "$@" cd x=1 "$@" 'quoted text'
+		then printf local /usr/bin
+		sed | export 2>/dev/null sed
+	x=1 && printf done done readonly awk /usr/bin
+"$@" "$1" done local echo test 2>/dev/null export
+done readonly export --verbose
+| test /usr/bin test printf then then cd readonly -eu
+	${HOME} local readonly
+x=1 2>/dev/null local -eu ${HOME} x=1 ${HOME} done
+	$(pwd) sed readonly && readonly -eu echo ${HOME} sed export
+		${HOME} cd | "$@" "$1" | cd grep awk && --verbose
+		test printf cd "$1" cd "$1" local cd sed awk "$@" && export
+		${HOME} cd grep --verbose then 2>/dev/null
+	awk --verbose awk $(pwd) done echo
+local --verbose $(pwd) "$1" ${HOME} x=1 test readonly
+	then grep printf /usr/bin cd done cd /usr/bin
+	--verbose readonly grep
+	"$@" "$1" x=1 ${HOME} grep then test /usr/bin export | readonly
+| | --verbose export x=1 echo readonly $(pwd) readonly local export
+	"$@" readonly export 2>/dev/null
+sed -eu -eu "$@" /usr/bin readonly
+test then "$1" -eu && 2>/dev/null readonly test | awk --verbose
+	'quoted text' echo readonly sed
+	done grep test sed sed /usr/bin
+/usr/bin 2>/dev/null --verbose export readonly
+2>/dev/null 2>/dev/null export
+sed done /usr/bin then cd
+local sed "$@" 'quoted text'
+		-eu 2>/dev/null cd local --verbose
+	local | 2>/dev/null awk done
+		"$1" && readonly 'quoted text' test then local then /usr/bin
+cd cd && ${HOME} done --verbose
+cd ${HOME} cd && "$@" | awk --verbose done printf local && grep
+local -eu done then grep 'quoted text'
+		cd cd sed awk awk 2>/dev/null ${HOME}
+	readonly grep /usr/bin && grep then done local $(pwd)
+done local export echo local export local
+export "$1" /usr/bin then readonly $(pwd) cd cd test echo
+	export | printf awk &&
+		"$@" export /usr/bin | x=1 --verbose /usr/bin readonly cd --verbose
+	test 2>/dev/null test test 2>/dev/null
+"$@" printf "$@" test local test export
+		done printf readonly $(pwd) "$@" done
+"$1" $(pwd) cd -eu && x=1 /usr/bin echo $(pwd) printf cd export 2>/dev/null
+		done 'quoted text' cd $(pwd) | $(pwd) /usr/bin export $(pwd)
+&& printf then "$@" local ${HOME}
+echo cd -eu && cd export 'quoted text' "$@" x=1 && printf readonly test
+		-eu "$1" local grep test done
+		then printf /usr/bin local printf "$@" awk
+x=1 2>/dev/null export --verbose 2>/dev/null sed | ${HOME} /usr/bin | -eu cd
+		${HOME} /usr/bin echo "$1" -eu
+	cd $(pwd) /usr/bin $(pwd) local &&
+local x=1 /usr/bin readonly local x=1 echo test echo readonly 'quoted text' "$@"
+test printf cd ${HOME}
+		readonly /usr/bin $(pwd) | grep 2>/dev/null
+"$1" "$1" readonly awk readonly printf "$1" 'quoted text'
+		&& then readonly "$@" echo && sed readonly test grep echo local -eu -eu 'quoted text'
+		--verbose readonly readonly "$@" --verbose "$1" |
+	cd readonly cd echo test export --verbose 2>/dev/null x=1
+	cd "$@" 'quoted text' then -eu | x=1 'quoted text' ${HOME} "$1" --verbose && export
+		-eu 2>/dev/null sed then 2>/dev/null local -eu export "$@" test awk "$1"
+sed ${HOME} done awk test
+		local $(pwd) sed export $(pwd) 2>/dev/null ${HOME} awk grep 'quoted text'
+		export 'quoted text' x=1 $(pwd) "$1" echo sed -eu test printf cd cd -eu cd
+	test sed export cd grep "$1" $(pwd)
+		-eu then test awk then export then 2>/dev/null
+		then cd sed printf sed grep
+		printf | grep echo printf 2>/dev/null $(pwd) "$@" x=1 echo 'quoted text'
+	$(pwd) "$@" $(pwd) /usr/bin readonly grep ${HOME} awk done
+		printf local test grep sed /usr/bin cd | ${HOME} 'quoted text'
+		'quoted text' readonly "$1" cd then printf "$1"
+	&& /usr/bin export test printf readonly export 'quoted text' "$@"
+	test 2>/dev/null 2>/dev/null ${HOME} 2>/dev/null | /usr/bin printf &&
+		2>/dev/null done sed local $(pwd) ${HOME} x=1 2>/dev/null
+		/usr/bin readonly /usr/bin --verbose printf local $(pwd) export
+	2>/dev/null echo test readonly && /usr/bin echo /usr/bin
+awk 2>/dev/null cd && test /usr/bin sed echo 'quoted text' awk x=1 echo ${HOME}
+		$(pwd) readonly | "$@" awk "$@" sed local test readonly
+grep "$1" then printf -eu "$@" "$@" --verbose /usr/bin
+then echo export | && awk sed
+		readonly ${HOME} echo awk --verbose 'quoted text' | /usr/bin grep 2>/dev/null
+	--verbose "$1" 2>/dev/null /usr/bin test local awk
+		$(pwd) sed done echo local awk --verbose cd cd /usr/bin sed sed
+grep /usr/bin "$1" test grep printf grep "$1" export
+	grep grep ${HOME} | "$@" export awk export | x=1 cd "$1" done sed $(pwd)
+		${HOME} | $(pwd) | export --verbose done
+echo sed done x=1 export export echo export --verbose
+	'quoted text' && $(pwd) &&
+		readonly cd readonly && --verbose
+awk x=1 cd awk -eu local grep echo | export
+	grep test grep -eu echo then cd echo cd /usr/bin
+	test sed x=1 grep sed sed --verbose awk --verbose --verbose
+"$1" 'quoted text' x=1 2>/dev/null awk /usr/bin local
+		--verbose "$1" done 2>/dev/null
+		readonly | ${HOME} /usr/bin /usr/bin export "$1" --verbose
+		printf test /usr/bin test readonly 2>/dev/null cd awk export
+	2>/dev/null "$1" test x=1 "$@" awk cd echo printf
+	--verbose printf sed $(pwd) x=1 awk "$1" 2>/dev/null grep
+		then x=1 export ${HOME} "$@" grep | printf ${HOME} then --verbose
+"$1" -eu sed done readonly 'quoted text'
+		test "$1" -eu /usr/bin 2>/dev/null $(pwd) cd printf
+	export then /usr/bin local && awk echo printf local "$1" "$1" echo | ${HOME}
+	echo awk cd "$1" -eu 'quoted text'
+	grep local printf test ${HOME} test
+echo $(pwd) awk 2>/dev/null printf cd awk cd then grep "$1" | /usr/bin -eu
+		&& $(pwd) then readonly test printf export
+x=1 | -eu done -eu /usr/bin echo printf $(pwd)
+	local readonly cd sed export $(pwd) sed cd grep printf /usr/bin 'quoted text'
+		done echo export $(pwd) && echo cd sed test 2>/dev/null readonly
+-eu echo cd local sed ${HOME}
+"$1" export x=1 -eu cd | $(pwd) cd 'quoted text' | --verbose test sed cd
+		-eu done test cd sed test $(pwd) printf
+'quoted text' -eu grep
+		/usr/bin then readonly /usr/bin readonly done echo cd sed && readonly
+export "$@" cd && test
+sed sed grep | then --verbose /usr/bin export test awk done x=1
+awk --verbose /usr/bin test /usr/bin test sed "$@" "$1" 2>/dev/null then sed $(pwd)
+		2>/dev/null && echo test sed /usr/bin 'quoted text' done -eu x=1 then "$1"
+		-eu export 'quoted text' then done | grep -eu && printf &&
+		x=1 cd local echo 2>/dev/null done && && then cd $(pwd) awk "$@" sed cd sed "$@"
+		$(pwd) /usr/bin then export printf "$@" cd sed x=1 'quoted text' 'quoted text'
+	"$1" $(pwd) grep awk echo export 2>/dev/null --verbose "$1" echo "$1" && x=1
+"$1" awk readonly grep cd -eu test --verbose ${HOME} local
+		${HOME} | grep ${HOME} -eu then grep printf 'quoted text' sed readonly
+	done then --verbose 2>/dev/null "$@" x=1 local cd readonly x=1 done $(pwd)
+sed /usr/bin -eu | printf
+"$@" local then 'quoted text' printf && && "$@" | ${HOME} export
+		/usr/bin ${HOME} -eu "$@" x=1 "$@" 'quoted text'
+		grep --verbose x=1 'quoted text' then $(pwd)
+2>/dev/null && echo && /usr/bin
+	&& -eu printf "$@" local done awk
+		$(pwd) readonly | "$1" && | 'quoted text' export done 2>/dev/null "$1" 'quoted text'
+	x=1 x=1 grep readonly test x=1 local $(pwd) test | "$@" 2>/dev/null "$@"
+	test awk export | "$1" test echo ${HOME} /usr/bin
+-eu && cd -eu "$1" && /usr/bin && echo then export local /usr/bin
+		"$@" export export readonly echo
+"$1" echo cd "$1" sed 2>/dev/null x=1 local local
+		cd test echo "$1" cd --verbose ${HOME}
+	readonly ${HOME} echo /usr/bin ${HOME} test --verbose
+${HOME} awk 'quoted text' "$1" printf x=1 local then x=1 export
+		--verbose cd $(pwd) then "$1" test awk readonly 2>/dev/null "$1" grep ${HOME} &&
+		$(pwd) | --verbose 'quoted text'
+readonly sed $(pwd) && | test ${HOME}
+echo $(pwd) then cd then then sed ${HOME}
+		awk test grep "$@" local local
+then 'quoted text' --verbose test | "$@"
+cd 'quoted text' printf then x=1
+done local done readonly printf $(pwd)
+echo readonly grep echo local x=1 -eu readonly 'quoted text' 2>/dev/null
+local x=1 2>/dev/null x=1 2>/dev/null && ${HOME} ${HOME} x=1 local test cd sed
+--verbose /usr/bin -eu readonly export 2>/dev/null "$@" --verbose --verbose
+x=1 awk $(pwd) "$1" grep
+		${HOME} echo sed then && cd | "$@" test "$@" | then printf
+grep awk then local -eu ${HOME} cd
+		done test sed grep /usr/bin export
+	"$1" "$@" "$1" x=1 export readonly
+	printf local /usr/bin cd sed cd echo then then ${HOME}
+printf test "$1" cd ${HOME} | sed 2>/dev/null export sed x=1 /usr/bin -eu
+printf "$@" done export cd cd x=1 then && sed grep
+x=1 && -eu sed /usr/bin $(pwd) $(pwd) echo test $(pwd) "$@"
+		--verbose | grep local "$@" --verbose
+	'quoted text' --verbose cd $(pwd) /usr/bin $(pwd) printf local
+		sed cd local "$@" $(pwd) | local
+		| | /usr/bin export && test export && readonly 'quoted text' readonly
+	&& local awk test | test -eu
+		'quoted text' "$@" awk grep
+	/usr/bin /usr/bin $(pwd) sed done $(pwd) ${HOME} -eu
+/usr/bin awk ${HOME} 'quoted text'
+		&& sed --verbose echo && "$1" awk && --verbose
+	'quoted text' grep grep 'quoted text'
+	$(pwd) "$1" 'quoted text'
+	cd && x=1 -eu ${HOME} ${HOME}
+	"$1" | /usr/bin echo sed && 'quoted text'
+--verbose -eu export $(pwd) grep ${HOME} | "$@" cd $(pwd) export
+		test then then x=1 then sed | "$@" $(pwd) readonly
+sed $(pwd) local && grep |
+cd ${HOME} x=1 $(pwd) | ${HOME} x=1 'quoted text' 2>/dev/null echo -eu local
+printf awk x=1 printf test done grep $(pwd) grep local export local $(pwd) readonly
+	| "$1" readonly --verbose --verbose &&
+$(pwd) $(pwd) export 2>/dev/null -eu printf -eu $(pwd)
+export -eu $(pwd) -eu
+	"$1" /usr/bin x=1 local test
+		grep x=1 grep x=1 --verbose cd sed | done --verbose local "$1" readonly readonly
+export "$@" && 2>/dev/null cd readonly grep sed 2>/dev/null
+	printf test "$1" test ${HOME} readonly cd &&
+		printf && then x=1 cd test done /usr/bin local export done -eu "$@" ${HOME}
+test cd then -eu readonly then sed readonly done $(pwd) ${HOME} done && /usr/bin
+then echo "$@" cd export "$1" sed && 'quoted text'
+		cd grep x=1 $(pwd) printf 2>/dev/null test ${HOME} x=1
+	local | ${HOME} | cd 'quoted text' x=1 grep awk --verbose -eu &&
+-eu 2>/dev/null local "$1" test grep && --verbose
+	${HOME} | echo local /usr/bin echo && sed | test x=1 test /usr/bin
+-eu $(pwd) -eu test --verbose && then awk && local grep
+		-eu then export /usr/bin 'quoted text' x=1 then done --verbose readonly
+grep ${HOME} export sed $(pwd)
+	-eu sed printf 'quoted text' sed "$1" 2>/dev/null printf
+		$(pwd) done sed /usr/bin printf 'quoted text' then
+		"$1" test x=1 local export test test 2>/dev/null test sed awk x=1 local awk
+		export --verbose export $(pwd) cd readonly then /usr/bin | printf
+		echo local 'quoted text' x=1 sed export 2>/dev/null "$@" printf
+		export x=1 --verbose sed
+| readonly test "$1" x=1 done then echo printf 2>/dev/null
+	export then 2>/dev/null export test grep && x=1
+		$(pwd) ${HOME} then cd $(pwd) grep grep grep | -eu ${HOME}
+--verbose 2>/dev/null 2>/dev/null --verbose --verbose $(pwd)
+readonly "$@" printf "$1" printf test ${HOME} $(pwd) ${HOME}
+	test ${HOME} "$1" echo sed "$1" local ${HOME}
+	test $(pwd) printf 2>/dev/null
+		then test then sed $(pwd) "$1"
+then x=1 "$1" done readonly -eu && printf grep
+		awk | readonly && 2>/dev/null
+${HOME} printf && ${HOME} $(pwd) /usr/bin done "$1" printf sed readonly done
+		&& export /usr/bin "$1" /usr/bin readonly cd cd readonly sed 2>/dev/null
+		then "$@" sed awk readonly ${HOME} then $(pwd)
+'quoted text' x=1 | ${HOME}
+		awk /usr/bin x=1 printf then | printf "$1" printf && cd --verbose cd
+x=1 readonly 2>/dev/null readonly printf | -eu readonly
+	echo 'quoted text' && x=1 -eu x=1 -eu local sed export /usr/bin sed --verbose local
+		local x=1 sed && awk export cd $(pwd) readonly local ${HOME} awk echo
+		readonly --verbose "$@" --verbose echo done --verbose done done ${HOME} $(pwd)
+	echo ${HOME} done readonly
+	--verbose done cd /usr/bin 'quoted text'
+		x=1 cd printf | | printf awk
+	awk && && "$@" -eu ${HOME} x=1 cd -eu local printf echo /usr/bin
+	cd done --verbose then "$@" --verbose then export test export
+	grep done local && echo test echo export then && then 'quoted text' grep local
+echo 2>/dev/null "$@" awk printf
+then | x=1 export x=1 printf ${HOME} grep ${HOME} ${HOME} -eu "$@" local local
+	x=1 readonly export ${HOME} awk echo
+then 2>/dev/null awk readonly | then
+		then done $(pwd) $(pwd) "$@" $(pwd) readonly
+		export $(pwd) ${HOME} done x=1 -eu local 2>/dev/null "$@" export
+	--verbose then local printf | "$@" "$@" grep
+	2>/dev/null x=1 && && test "$1" ${HOME} ${HOME} echo sed "$@"
+	--verbose --verbose $(pwd) x=1 echo awk x=1 printf
+		${HOME} x=1 cd cd -eu "$@" ${HOME} local x=1
+		"$@" ${HOME} "$1" awk awk $(pwd) x=1 -eu
+		"$@" x=1 grep local sed export x=1 --verbose /usr/bin
+		"$1" readonly printf --verbose cd --verbose cd
+	${HOME} 2>/dev/null grep x=1 export
+	"$@" $(pwd) done && echo done "$1" -eu echo test
+	printf local && awk test "$1" grep readonly $(pwd)
+		then 2>/dev/null local sed x=1 2>/dev/null "$@" /usr/bin awk done
+	local 2>/dev/null $(pwd)
+		| test ${HOME} -eu && grep echo local readonly cd ${HOME} "$@" 2>/dev/null
+test test test echo x=1 --verbose then 2>/dev/null
+	"$1" "$@" x=1 cd export grep 'quoted text' "$@"
+&& 'quoted text' printf 'quoted text' cd test
+		--verbose test readonly local cd && --verbose then
+	&& test printf | /usr/bin grep cd $(pwd) grep ${HOME} && -eu "$1"
+	printf ${HOME} then 'quoted text' awk && ${HOME} ${HOME} done | /usr/bin printf
+	cd local | grep grep "$1" grep --verbose grep done local x=1 done readonly
+	done --verbose x=1 "$1" --verbose --verbose
+${HOME} x=1 "$@" 2>/dev/null printf "$@"
+		${HOME} --verbose printf test printf | echo x=1 'quoted text' readonly
+-eu "$1" /usr/bin | awk local |
+	sed readonly done awk export /usr/bin ${HOME} echo 'quoted text'
+/usr/bin -eu printf done grep
+		readonly sed "$@" export sed x=1 'quoted text' test "$@" readonly then then test
+test | "$1" ${HOME} local "$1" ${HOME} --verbose awk test sed
+	$(pwd) ${HOME} grep local
+	"$1" ${HOME} readonly then 2>/dev/null echo
+		x=1 | $(pwd) local x=1 export 'quoted text'
+	cd echo /usr/bin awk x=1 "$1" grep /usr/bin echo sed echo 'quoted text' printf
+/usr/bin ${HOME} --verbose readonly sed cd ${HOME} then
+export test "$1" $(pwd) awk then grep done 2>/dev/null
+x=1 done && "$1" --verbose export cd then test 2>/dev/null
+	sed "$@" && echo cd /usr/bin $(pwd) cd export test /usr/bin "$@" --verbose
+		${HOME} "$@" --verbose && export ${HOME} ${HOME} /usr/bin "$1" 'quoted text'
+		done done then readonly "$@" -eu test done | printf grep $(pwd) &&
+	sed export grep 2>/dev/null "$@"
+done then ${HOME} ${HOME} "$@" awk -eu echo ${HOME} ${HOME}
+		done cd grep | sed test then
+	"$@" awk test cd grep export done then sed done
+		x=1 readonly test local sed local readonly
+${HOME} test printf echo
+echo $(pwd) "$@" export x=1 ${HOME} cd then export "$1" test sed done | ${HOME}
+awk test test awk then printf grep printf then test | grep
+		then "$@" && -eu grep /usr/bin local then $(pwd) /usr/bin && 2>/dev/null 2>/dev/null
+		export sed export /usr/bin
+		printf x=1 grep printf "$1" && $(pwd) echo then --verbose
+then printf readonly printf test echo x=1 local 'quoted text'
+		grep --verbose export local sed $(pwd) | --verbose
+		echo && "$@" "$@" echo && then done printf echo && ${HOME} grep 'quoted text'
+test echo readonly -eu ${HOME} export
+		/usr/bin 2>/dev/null 2>/dev/null /usr/bin readonly printf echo echo cd
+	&& ${HOME} export done $(pwd) ${HOME} test cd
+	printf --verbose "$@" -eu export
+		test grep --verbose "$1" test --verbose
+	readonly awk 'quoted text'
+&& --verbose 'quoted text' $(pwd) readonly sed /usr/bin echo done awk then 'quoted text'
+	'quoted text' cd /usr/bin | 2>/dev/null awk | "$1" /usr/bin --verbose -eu test
+2>/dev/null "$1" $(pwd) then /usr/bin && test sed && done awk
+		sed local x=1 cd awk --verbose "$1" 2>/dev/null && 2>/dev/null
+	export echo sed ${HOME} local cd readonly &&
+		then x=1 readonly local grep local 'quoted text' printf done &&
+sed cd | echo export -eu test $(pwd) 'quoted text' --verbose
+	done "$1" --verbose local
+		2>/dev/null | readonly $(pwd) printf -eu 2>/dev/null
+		printf printf then $(pwd) && sed && x=1 && x=1 /usr/bin x=1 x=1 awk ${HOME}
+--verbose grep echo export --verbose test && && printf then local echo x=1
+readonly export "$@" export
+echo ${HOME} 'quoted text' --verbose awk cd cd export local export "$@" awk 'quoted text'
+		done awk done "$1" echo 2>/dev/null readonly $(pwd) && "$1" ${HOME} sed
+	/usr/bin cd local grep cd && sed --verbose test grep echo
+${HOME} /usr/bin done ${HOME}
+x=1 | test --verbose awk readonly ${HOME} echo "$1" export export export grep
+		${HOME} 'quoted text' | then sed sed grep then /usr/bin awk 2>/dev/null "$1" "$@"
+sed ${HOME} && "$1" /usr/bin
+		--verbose "$@" printf then export 2>/dev/null
+	awk /usr/bin readonly then done
+&& x=1 -eu "$1" && "$1" local x=1 -eu && "$@" $(pwd) ${HOME} export ${HOME}
+		cd -eu readonly | local sed 2>/dev/null echo echo
+		printf /usr/bin readonly export then "$1" $(pwd) awk "$@" echo then
+| | /usr/bin test echo awk
+	"$@" "$1" local echo "$@" --verbose ${HOME}
+		sed readonly sed cd --verbose --verbose printf x=1 --verbose
+		grep export done export readonly cd | && | readonly && test -eu x=1 &&
+	echo then && done local local readonly then echo x=1
+		then ${HOME} -eu test --verbose done | 2>/dev/null then done done
+		| x=1 "$1" sed && $(pwd) echo && sed readonly sed && --verbose
+	&& then done 2>/dev/null "$1" local local 'quoted text' readonly done 'quoted text'
+| echo 'quoted text' done readonly grep readonly test ${HOME}
+		local -eu "$@" then x=1 'quoted text' test 'quoted text'
+sed local -eu export then && echo | "$1" awk cd export
+		"$@" | | local 2>/dev/null grep echo test export test "$1" export /usr/bin
+		export grep | cd --verbose readonly x=1 /usr/bin echo "$@" done cd local
+&& done readonly done grep "$@" /usr/bin test readonly
+		sed echo local "$@" printf
+cd then test x=1 ${HOME}
+"$@" grep | grep "$@" --verbose
+	'quoted text' --verbose cd local ${HOME} printf -eu
+	local -eu cd "$1" | cd ${HOME} then /usr/bin test local 2>/dev/null
+	echo sed cd ${HOME} grep
+	done 'quoted text' export && "$@"
+	2>/dev/null 2>/dev/null "$@" -eu | "$@" 2>/dev/null printf
+	"$@" /usr/bin "$@" /usr/bin
+&& done printf x=1 "$1" ${HOME} && x=1 grep awk cd
+test /usr/bin 2>/dev/null done then
+		--verbose awk 2>/dev/null export -eu readonly grep grep 'quoted text'
+readonly readonly "$1" "$1" | local $(pwd) $(pwd) local printf | $(pwd)
+		done grep export local /usr/bin
+	awk local "$@" sed "$1" /usr/bin | sed cd awk -eu | sed "$1" /usr/bin readonly
+&& | awk --verbose readonly -eu then 2>/dev/null
+-eu "$1" "$1" awk done awk /usr/bin awk readonly readonly then cd $(pwd)
+	/usr/bin then sed --verbose
+echo local "$1" --verbose /usr/bin && && awk x=1 /usr/bin "$@"
+sed && echo printf /usr/bin
+	printf test | /usr/bin export -eu
+x=1 sed local done cd export /usr/bin | sed export
+	| readonly ${HOME} | x=1 ${HOME} export 2>/dev/null local done -eu "$1" 2>/dev/null
+		"$1" local x=1 test 'quoted text' /usr/bin && | /usr/bin -eu readonly
+		awk readonly cd done 'quoted text'
+cd "$1" test $(pwd) /usr/bin ${HOME} grep
+		echo echo "$@" test $(pwd) $(pwd) /usr/bin -eu echo grep awk
+		sed grep cd then local "$@" "$@" readonly ${HOME}
+		--verbose | -eu sed ${HOME} ${HOME} "$1" test "$1" grep $(pwd) local "$@"
+readonly -eu done export | | "$1" awk local 'quoted text' | x=1 readonly sed
+		printf local ${HOME} export then then && grep echo 'quoted text'
+	x=1 sed test sed 2>/dev/null test --verbose
+		"$1" && 'quoted text' 2>/dev/null "$1" printf x=1 readonly $(pwd)
+	"$@" cd cd awk ${HOME} done awk export --verbose then --verbose readonly 'quoted text'
+x=1 cd | | printf $(pwd) -eu local "$@" echo done test --verbose
+		done ${HOME} 2>/dev/null --verbose $(pwd) && /usr/bin "$@" ${HOME} ${HOME}
+		printf -eu done "$@" /usr/bin --verbose local readonly 2>/dev/null | x=1 "$@"
+local "$1" done ${HOME} "$@"
+		export export | awk sed then test
+		/usr/bin grep 2>/dev/null /usr/bin 'quoted text' local printf
+		printf 2>/dev/null grep 'quoted text' export sed 'quoted text' local && $(pwd)
+"$1" grep cd -eu readonly done 'quoted text' test grep /usr/bin
+	2>/dev/null x=1 ${HOME} 2>/dev/null test ${HOME}
+		-eu /usr/bin | $(pwd) cd "$1" "$1" 2>/dev/null
+${HOME} "$@" then readonly
+	printf then x=1 test cd "$1" then printf export readonly /usr/bin --verbose
+	&& x=1 2>/dev/null | local printf then x=1 ${HOME}
+--verbose 2>/dev/null printf
+	&& ${HOME} && ${HOME} --verbose cd then ${HOME} ${HOME} $(pwd) -eu printf readonly
+		sed sed then --verbose && "$1" "$1" awk 'quoted text' -eu -eu sed 2>/dev/null
+		test export "$1" $(pwd) /usr/bin | | then test echo cd echo local "$1" 2>/dev/null
+		then 2>/dev/null "$1" test 'quoted text' export test ${HOME} test awk
+	test local --verbose -eu
+'quoted text' 'quoted text' test export && awk echo echo 2>/dev/null 2>/dev/null
+		export --verbose done x=1 echo export x=1
+	2>/dev/null test local ${HOME} test echo printf x=1 'quoted text' then test
+	awk cd --verbose sed done 'quoted text'
+	printf sed ${HOME} grep
+		"$1" $(pwd) grep done cd then awk ${HOME} awk | export ${HOME} done
+-eu --verbose /usr/bin x=1 --verbose | sed done readonly
+	test export echo ${HOME} awk sed
+2>/dev/null "$@" local echo | export 2>/dev/null $(pwd) done test test ${HOME}
+		'quoted text' local sed 2>/dev/null "$1" local export cd cd x=1 then readonly
+		/usr/bin 'quoted text' 'quoted text' test readonly then test
+		${HOME} sed "$@" done awk cd then "$@"
+		x=1 done then 'quoted text' --verbose $(pwd) 'quoted text' 2>/dev/null
+		"$1" grep grep grep -eu --verbose awk --verbose x=1 && -eu "$1" "$1" local test
+		2>/dev/null printf x=1 then grep done echo 'quoted text'
+		done printf awk 2>/dev/null -eu export $(pwd) printf "$1"
+local sed && 'quoted text' -eu
+	sed $(pwd) grep --verbose awk --verbose /usr/bin "$1" done 2>/dev/null
+	| "$@" grep /usr/bin then printf "$1" ${HOME}
+	grep /usr/bin /usr/bin 'quoted text' awk readonly | | grep
+	2>/dev/null echo | ${HOME} "$@" && 'quoted text'
+/usr/bin "$@" cd then "$@" /usr/bin 2>/dev/null cd 2>/dev/null 'quoted text'
+-eu "$1" export $(pwd) $(pwd) echo 'quoted text' &&
+		grep 'quoted text' && readonly readonly awk && echo && grep 'quoted text' test
+--verbose 2>/dev/null awk grep echo echo test printf $(pwd) printf cd
+	2>/dev/null && x=1 grep local
+		&& export sed export grep /usr/bin 2>/dev/null printf readonly export test echo
+	'quoted text' done 'quoted text' "$1" cd echo grep 2>/dev/null
+${HOME} -eu local then export ${HOME}
+-eu 'quoted text' awk "$@" sed done && local
+	echo export echo then && sed awk readonly --verbose then echo readonly $(pwd)
+&& | 2>/dev/null readonly "$1" | sed "$@" grep cd 'quoted text' "$1" grep echo
+	printf ${HOME} -eu cd local printf 'quoted text' x=1 -eu | -eu echo 'quoted text'
+test done awk /usr/bin cd --verbose printf ${HOME} 2>/dev/null
+		cd awk | cd test awk printf done sed cd export
+	&& 2>/dev/null 2>/dev/null local echo cd readonly /usr/bin 'quoted text'
+	echo "$1" cd --verbose
+then --verbose /usr/bin done $(pwd)
+		--verbose test ${HOME} then export
+	-eu awk local -eu done cd local
+		grep /usr/bin ${HOME} sed $(pwd) --verbose ${HOME} /usr/bin
+echo local | test local | --verbose
+	'quoted text' /usr/bin export
+	readonly cd 2>/dev/null /usr/bin | 2>/dev/null "$1"
+	'quoted text' -eu $(pwd) done 2>/dev/null --verbose | cd cd cd done sed test
+printf -eu then awk | | sed
+then -eu then sed --verbose
+	'quoted text' --verbose test $(pwd) --verbose done local x=1 -eu cd &&
+$(pwd) -eu 2>/dev/null 'quoted text' grep
+		--verbose ${HOME} "$@" && test | done then test 2>/dev/null local done
+/usr/bin /usr/bin "$1" printf 'quoted text'
+		'quoted text' sed ${HOME} $(pwd) cd done | "$1" grep ${HOME}
+		&& ${HOME} grep | then then x=1 'quoted text' 2>/dev/null
+"$@" "$@" 2>/dev/null $(pwd)
+		test /usr/bin $(pwd) && sed /usr/bin 'quoted text'
+		export grep ${HOME} printf readonly && | && then export
+then --verbose 2>/dev/null &&
+		sed "$1" done x=1 test sed grep then x=1 grep 2>/dev/null
+	--verbose ${HOME} export readonly && 2>/dev/null grep grep $(pwd) -eu
+	grep ${HOME} sed done /usr/bin
+		${HOME} readonly grep test /usr/bin cd readonly sed
+		awk "$@" then $(pwd) readonly grep ${HOME} test grep cd local readonly
+		echo -eu printf cd done "$1" && "$@" "$@" printf
+	sed grep "$@" 2>/dev/null cd done && readonly then ${HOME} -eu
+x=1 "$1" 2>/dev/null test | "$1" readonly awk cd | "$@" "$@"
+	readonly readonly 'quoted text' printf | export 'quoted text' export 2>/dev/null
+&& export readonly cd -eu --verbose -eu sed /usr/bin 2>/dev/null "$1" cd
+awk printf test echo grep done local
+	printf done && 2>/dev/null readonly printf $(pwd) --verbose
+sed --verbose readonly export test && | awk "$1" local
+		${HOME} grep ${HOME} cd --verbose
+| | test local printf then -eu grep export
+		| readonly grep -eu | local cd $(pwd) 2>/dev/null 'quoted text'
+${HOME} then cd echo x=1 sed
+	done /usr/bin x=1 grep
+| then -eu "$1" echo done | "$1" "$@"
+'quoted text' test --verbose | x=1 'quoted text' printf export printf $(pwd) --verbose
+		&& printf awk 2>/dev/null grep grep "$@" 2>/dev/null -eu 2>/dev/null
+	done printf x=1 grep -eu local then readonly grep cd 'quoted text'
+		'quoted text' x=1 && x=1 local export 'quoted text'
+${HOME} then readonly local awk readonly
+		${HOME} 'quoted text' test $(pwd) -eu echo sed done then x=1 awk
+export "$@" 2>/dev/null echo done printf awk -eu
+	"$@" --verbose local /usr/bin --verbose /usr/bin
+	local x=1 echo -eu grep export printf
+	echo cd readonly "$@" /usr/bin
+printf -eu export printf | then 'quoted text'
+export "$@" printf ${HOME} 'quoted text'
+		cd local $(pwd) grep | grep "$1" sed &&
+	'quoted text' echo then "$@" cd $(pwd)
+	export | x=1 -eu /usr/bin | then printf && $(pwd) then readonly
+	then local x=1 local 'quoted text'
+		${HOME} $(pwd) sed local sed awk | then
+	awk $(pwd) 'quoted text' -eu "$1"
+printf test echo awk grep test 2>/dev/null && "$@" /usr/bin local 'quoted text'
+	${HOME} --verbose test --verbose --verbose local -eu done sed && awk &&
+	$(pwd) readonly ${HOME} "$1" /usr/bin && $(pwd) "$@" "$1" export test echo
+	x=1 awk "$@" && -eu export &&
+printf 'quoted text' printf "$1" 2>/dev/null "$@"
+		printf ${HOME} "$@" cd
+	printf readonly done /usr/bin ${HOME} echo echo "$1" grep 'quoted text'
+		x=1 "$@" sed ${HOME} "$1" sed | done readonly /usr/bin /usr/bin 2>/dev/null
+'quoted text' ${HOME} --verbose 2>/dev/null $(pwd)
+awk then 2>/dev/null done cd --verbose
+2>/dev/null readonly awk local done --verbose printf printf local then
+		-eu sed cd | --verbose $(pwd) "$1" | export cd $(pwd) awk /usr/bin
+	readonly x=1 done sed | "$1" local then test ${HOME} sed && --verbose awk echo
+	"$@" test cd --verbose grep test
+		${HOME} local 2>/dev/null echo sed x=1 /usr/bin
+		${HOME} 2>/dev/null | 2>/dev/null grep then printf
+		local grep x=1 "$@" ${HOME} then && awk
+		2>/dev/null then readonly "$@" local grep
+	$(pwd) then printf 2>/dev/null cd -eu readonly -eu | 'quoted text' "$@" test
+	then done then -eu cd 'quoted text' | $(pwd) cd -eu | "$1" cd echo
+2>/dev/null printf echo grep
+	sed then /usr/bin 2>/dev/null test test /usr/bin $(pwd) $(pwd) /usr/bin
+	&& readonly readonly echo then test local "$1"
+		--verbose "$@" export grep done local then readonly cd 'quoted text' export
+	grep sed | done test echo printf then --verbose
+then echo "$1" cd 'quoted text' && x=1 ${HOME} "$1" 2>/dev/null
+local sed test "$1" cd readonly done grep
+		export grep sed /usr/bin readonly grep /usr/bin | "$@" readonly
+		"$@" test echo printf $(pwd) test cd cd $(pwd) "$1" export --verbose
+		--verbose -eu ${HOME} test --verbose test -eu 2>/dev/null "$@" -eu
+sed 'quoted text' then grep "$@" x=1 readonly awk echo export "$1"
+		grep export test && awk --verbose ${HOME} awk echo 'quoted text'
+		/usr/bin export awk && -eu ${HOME}
+	2>/dev/null echo awk -eu export done test local
+		awk awk "$1" sed grep local
+	${HOME} then sed ${HOME} -eu /usr/bin local sed
+	grep echo awk awk export printf ${HOME}
+	local sed cd -eu $(pwd) x=1 ${HOME} --verbose echo --verbose "$1" && ${HOME} printf
+		2>/dev/null $(pwd) cd x=1 "$@" "$@" readonly test done --verbose 2>/dev/null /usr/bin
+/usr/bin local --verbose
+		--verbose printf "$1" | /usr/bin readonly /usr/bin test sed ${HOME} sed done
+done "$@" test export cd test awk /usr/bin done readonly
+then /usr/bin $(pwd) --verbose echo
+cd echo echo test echo echo
+	-eu awk awk /usr/bin -eu && /usr/bin then
+grep then 'quoted text' then cd --verbose
+		grep && $(pwd) -eu readonly then readonly 'quoted text'
+		x=1 export export sed awk echo && awk echo ${HOME} done sed "$@" | --verbose
+| test $(pwd) printf 2>/dev/null sed grep $(pwd)
+/usr/bin grep 'quoted text' -eu grep readonly done cd 2>/dev/null && --verbose
+		--verbose 'quoted text' awk grep "$@" 'quoted text' readonly | awk
+		test && awk "$1" "$1" ${HOME} && done readonly export && 'quoted text' test
+	2>/dev/null 'quoted text' local $(pwd) then "$@" then -eu test | --verbose |
+	cd sed printf grep export echo test -eu echo --verbose
+		printf x=1 && ${HOME} readonly test readonly
+	--verbose $(pwd) test -eu readonly
+${HOME} ${HOME} export test --verbose
+x=1 awk test awk 2>/dev/null
+&& && export sed test cd ${HOME}
+	done 'quoted text' then then "$1" 'quoted text'
+done done awk | echo 'quoted text' -eu readonly $(pwd) --verbose -eu then -eu
+"$@" cd export ${HOME} cd sed 2>/dev/null 'quoted text' "$@"
+grep test done sed echo test x=1 x=1 $(pwd) printf
+| echo echo | /usr/bin
+		echo | readonly /usr/bin then
+then local printf 2>/dev/null "$1" echo echo 2>/dev/null && local readonly | "$@"
+	awk 2>/dev/null echo done | then 2>/dev/null cd test sed then
+		-eu test "$1" x=1 /usr/bin
+readonly readonly sed -eu then && grep test
+test "$1" -eu && cd "$1" printf
+		"$@" ${HOME} then $(pwd) test sed
+readonly readonly "$@" x=1 /usr/bin "$1" ${HOME} --verbose | readonly
+	/usr/bin awk 2>/dev/null sed 2>/dev/null awk 2>/dev/null
+		'quoted text' local $(pwd) "$1" echo printf x=1 cd then
+	"$1" test -eu readonly done x=1
+-eu --verbose $(pwd) export | -eu cd echo
+	local awk sed -eu $(pwd)
+done 'quoted text' $(pwd) export 2>/dev/null
+readonly --verbose readonly export sed
+		&& printf grep "$@" ${HOME} awk export "$1" sed "$1"
+		"$@" cd test export test test
+		echo sed test printf printf -eu 'quoted text'
+	--verbose x=1 export ${HOME} 'quoted text' then
+	sed "$1" | local x=1 test 'quoted text'
+sed ${HOME} awk printf printf /usr/bin printf
+		done && ${HOME} done $(pwd) | test 2>/dev/null echo "$@"
+	test done x=1 "$@" awk printf /usr/bin
+		-eu && | "$@" x=1 export -eu cd 'quoted text' cd readonly
+&& then 'quoted text' $(pwd) export 2>/dev/null
+		&& grep "$@" 2>/dev/null local readonly --verbose "$1" "$1" cd 2>/dev/null
+	--verbose x=1 printf local printf "$@" -eu x=1 && --verbose
+		2>/dev/null 'quoted text' printf | awk /usr/bin -eu |
+		echo done export "$1" "$@" export awk
+		'quoted text' test test echo readonly /usr/bin done printf 'quoted text' test grep
+	test then local $(pwd) then test cd sed --verbose export readonly test cd printf
+	test test "$1" awk echo grep local -eu sed 'quoted text' done ${HOME} test
+"$@" grep sed awk readonly $(pwd) -eu export --verbose
+		grep cd cd | $(pwd) 2>/dev/null cd done awk ${HOME} --verbose awk echo
+		${HOME} sed local echo cd grep | export cd readonly awk 2>/dev/null
+	${HOME} && then cd /usr/bin then sed readonly
+		grep -eu -eu local awk done awk cd x=1 test echo
+		grep /usr/bin && /usr/bin /usr/bin -eu echo
+printf cd grep "$@" echo awk sed ${HOME} "$@" --verbose
+done 'quoted text' printf then sed echo sed 2>/dev/null
+$(pwd) done test cd x=1 echo 'quoted text' done sed
+grep $(pwd) printf "$1" $(pwd) "$1" | 2>/dev/null
+-eu local grep 'quoted text' "$@"
+		${HOME} --verbose local --verbose
+done -eu echo local export echo $(pwd) echo printf "$@" echo export printf
+	"$@" $(pwd) test awk done && then "$1" -eu local local export x=1 --verbose
+		then x=1 x=1 && 'quoted text' then printf
+		echo sed export "$1" ${HOME} sed local
+	sed then "$@" cd printf
+		sed cd /usr/bin export $(pwd) test -eu
+x=1 printf local | | grep grep echo 2>/dev/null 2>/dev/null
+		${HOME} "$1" then awk ${HOME} -eu
+		echo x=1 | local echo cd x=1 done -eu export 'quoted text'
+	export cd done export then ${HOME} /usr/bin awk --verbose "$1" $(pwd)
+		2>/dev/null | grep then "$1" x=1 echo awk sed 2>/dev/null
+		sed "$1" && test --verbose readonly done
+	done /usr/bin export "$@" readonly done && export cd && echo 2>/dev/null
+		sed $(pwd) "$1" grep ${HOME} x=1 /usr/bin awk cd -eu x=1 export | 2>/dev/null
+	"$1" ${HOME} echo "$@" echo sed then x=1
+/usr/bin export readonly ${HOME} "$@" "$@" then x=1 cd ${HOME}
+	echo $(pwd) "$@" 2>/dev/null 2>/dev/null done then export
+		&& awk sed echo readonly /usr/bin $(pwd) ${HOME} readonly --verbose "$1" local
+&& 2>/dev/null 2>/dev/null x=1 'quoted text' echo 2>/dev/null
+		-eu -eu sed grep printf readonly 'quoted text'
+readonly --verbose sed local
+| local sed $(pwd) readonly printf echo export /usr/bin
+		--verbose then $(pwd) /usr/bin then /usr/bin "$1" printf echo
+"$@" done "$1" "$@" | ${HOME} "$@" $(pwd) && awk echo done
+	sed then echo echo then
+		${HOME} "$1" x=1 "$1" test local 2>/dev/null
+echo readonly echo "$1" -eu x=1 x=1 $(pwd) "$@"
+--verbose /usr/bin sed
+		--verbose then readonly 'quoted text' grep x=1 cd "$@" cd readonly cd --verbose
+test 2>/dev/null awk 'quoted text'
+	2>/dev/null $(pwd) sed $(pwd) "$1" | x=1 printf then -eu printf printf
+		2>/dev/null cd done export && test awk && cd echo $(pwd) "$1" done 'quoted text'
+	&& export | -eu /usr/bin -eu echo grep
+${HOME} readonly local | x=1 "$@" test
+$(pwd) readonly "$@" 'quoted text' -eu
+$(pwd) 'quoted text' grep grep && "$1" echo cd echo /usr/bin
+		$(pwd) -eu printf /usr/bin export /usr/bin | $(pwd) done then && cd printf
+| "$@" printf readonly echo echo x=1 echo && x=1 sed export
+	&& echo cd --verbose sed
+	&& awk awk "$@" ${HOME} "$1" done sed "$@" then then
+	"$@" 2>/dev/null $(pwd) --verbose
+	--verbose "$1" done printf | printf export "$1"
+'quoted text' export 2>/dev/null local | ${HOME} ${HOME}
+	echo readonly readonly readonly then
+sed "$@" 'quoted text' "$1" "$@" $(pwd)
+	test local cd x=1 test -eu /usr/bin ${HOME} sed printf
+then $(pwd) done test export "$1" -eu awk | then then echo "$1" 2>/dev/null
+		done export -eu cd -eu "$@" done local ${HOME} -eu printf $(pwd)
+		-eu "$1" 2>/dev/null --verbose test sed
+sed echo | grep grep "$1" test done ${HOME}
+	--verbose /usr/bin local printf /usr/bin readonly export -eu --verbose
+	"$1" $(pwd) local --verbose export /usr/bin --verbose
+	sed /usr/bin printf && 'quoted text'
+		export grep export /usr/bin
+	"$1" && x=1 | cd test local awk done ${HOME} ${HOME} 'quoted text'
+		sed 'quoted text' x=1 2>/dev/null -eu "$1" done export "$@"
+&& x=1 cd 'quoted text' echo $(pwd) && readonly
+	printf x=1 readonly | printf 'quoted text'
+x=1 "$@" done $(pwd) "$1" echo
+		"$1" | | /usr/bin grep test ${HOME} $(pwd)
+		sed test --verbose && printf done $(pwd) test
+	sed printf "$1" grep "$1" 2>/dev/null
+x=1 cd "$@" readonly --verbose echo awk $(pwd) $(pwd) && readonly
+		--verbose awk grep awk 'quoted text' ${HOME} /usr/bin
+		local test readonly && && "$@"
+done then "$@" then readonly printf
+&& local export awk "$@" printf ${HOME} grep "$@" test "$1"
+	test /usr/bin | -eu "$1" $(pwd) ${HOME} && grep x=1 local export echo ${HOME} grep
+"$1" "$@" readonly 'quoted text'
+	test x=1 "$@" echo printf test
+	readonly 'quoted text' "$1" grep
+'quoted text' | && $(pwd) sed $(pwd)
+		| /usr/bin local then "$1" 2>/dev/null 'quoted text' cd $(pwd) /usr/bin
+		readonly $(pwd) 2>/dev/null cd printf done x=1 cd $(pwd) 2>/dev/null | x=1
+	/usr/bin sed local echo export sed /usr/bin
+	-eu "$@" x=1 'quoted text' --verbose 2>/dev/null local export grep
+| x=1 "$@" sed grep grep done 'quoted text' done
+export then readonly echo done && done
+		test grep export $(pwd) /usr/bin "$@"
+		grep 'quoted text' printf awk 'quoted text' 2>/dev/null
+	"$@" sed readonly grep /usr/bin $(pwd) echo echo /usr/bin "$1" && "$@" readonly
+		&& -eu "$1" readonly /usr/bin grep printf done printf /usr/bin 'quoted text'
+	export then done /usr/bin grep $(pwd)
+"$@" /usr/bin /usr/bin sed x=1 -eu done echo 2>/dev/null sed
+"$@" /usr/bin ${HOME} && printf local done $(pwd)
+		| readonly grep done grep awk readonly sed then "$1" test then export
+done "$@" local test printf cd local echo readonly 2>/dev/null
+	$(pwd) done readonly then $(pwd)
+done sed ${HOME} /usr/bin local cd export grep sed 2>/dev/null awk ${HOME}
+		'quoted text' test --verbose ${HOME} 2>/dev/null test "$@" cd
+echo readonly 2>/dev/null /usr/bin "$@" cd export export readonly && awk -eu
+'quoted text' --verbose export readonly local done
+then awk 2>/dev/null && printf && grep x=1 local "$1" grep && then echo
+	export ${HOME} awk printf sed 2>/dev/null printf "$@" grep
+local sed $(pwd) local
+		/usr/bin && then echo grep -eu "$@" -eu cd "$1" "$@" && x=1 "$1" && &&
+"$1" -eu awk test && 'quoted text'
+	| export ${HOME} done --verbose 2>/dev/null "$1" local
+	printf 'quoted text' then grep cd export grep
+--verbose 2>/dev/null ${HOME}
+		echo 'quoted text' 2>/dev/null
+awk readonly cd $(pwd) && grep && then printf
+		sed printf 2>/dev/null /usr/bin echo -eu ${HOME} readonly
+local printf cd && "$1" cd "$1" cd "$1"
+		awk 'quoted text' -eu then local then sed "$@"
+		printf && "$@" ${HOME}
+		$(pwd) sed readonly printf /usr/bin | done sed grep readonly test x=1 "$@" echo
+| 'quoted text' x=1 ${HOME} cd grep $(pwd)
+awk cd && --verbose --verbose
+awk && then sed test then --verbose "$1" 2>/dev/null
+awk echo x=1 readonly local cd /usr/bin -eu "$@" --verbose
+${HOME} local sed -eu 2>/dev/null done sed done done awk /usr/bin 2>/dev/null
+grep test /usr/bin -eu 'quoted text' | ${HOME} --verbose cd /usr/bin 2>/dev/null
+grep sed done awk test "$1" --verbose grep /usr/bin 2>/dev/null
+grep --verbose && test x=1 "$1" 'quoted text' ${HOME} $(pwd) done "$1"
+		-eu 'quoted text' grep export | | grep "$@" test -eu readonly export then 2>/dev/null
+	echo sed awk && awk ${HOME} /usr/bin 'quoted text' | done done "$1"
+	sed ${HOME} && "$@" --verbose printf
+echo grep "$1" -eu export $(pwd) done ${HOME} ${HOME} $(pwd) "$@" printf 'quoted text'
+${HOME} 2>/dev/null export 2>/dev/null && echo "$@" grep grep cd 'quoted text'
+		/usr/bin grep export /usr/bin 'quoted text' awk export && printf cd local local
+		x=1 /usr/bin -eu /usr/bin 'quoted text' "$1"
+	printf --verbose ${HOME} && "$@" test 'quoted text' test done 'quoted text'
+	then /usr/bin | /usr/bin test awk test && grep grep /usr/bin done
+		printf | | -eu done local $(pwd) | export 2>/dev/null "$@"
+	$(pwd) awk printf grep && -eu
+cd ${HOME} 2>/dev/null /usr/bin /usr/bin
+"$1" | awk /usr/bin awk "$1" | export readonly | sed ${HOME} awk
+grep readonly cd -eu --verbose 2>/dev/null local "$@"
+		then $(pwd) /usr/bin && x=1 "$1"
+	"$1" sed sed test readonly
+	sed $(pwd) local -eu ${HOME} test -eu local && "$1" grep -eu
+	2>/dev/null /usr/bin "$@" /usr/bin "$1" && ${HOME} printf -eu --verbose
+	grep local /usr/bin local --verbose test awk 'quoted text' sed
+	grep local then 2>/dev/null -eu "$1"
+	done ${HOME} 2>/dev/null local awk 'quoted text' test ${HOME}
+		--verbose $(pwd) then awk printf
+		grep export done local local echo
+		export export printf echo | "$1" readonly x=1 readonly -eu then
+		export echo local ${HOME} -eu | -eu --verbose
+	grep test x=1 /usr/bin export
+${HOME} 'quoted text' cd | -eu echo export 2>/dev/null "$1"
+		${HOME} 'quoted text' printf
+sed ${HOME} grep --verbose sed -eu $(pwd) -eu export printf
+	grep --verbose cd "$1"
+/usr/bin && cd && -eu printf $(pwd) /usr/bin
+	echo cd sed $(pwd) printf
+		awk grep cd printf "$1" then grep
+	export local 2>/dev/null export
+--verbose | "$1" done then local awk test
+	echo printf "$@" && sed x=1 && "$1" ${HOME} export readonly x=1
+	"$@" x=1 printf $(pwd) done && "$@" printf $(pwd) 'quoted text' ${HOME}
+printf x=1 awk sed | test --verbose 2>/dev/null x=1 "$1" awk "$@" export
+		printf local "$@" -eu -eu
+	--verbose "$@" cd sed "$@" readonly 'quoted text' $(pwd) --verbose $(pwd) printf
+		sed grep cd | /usr/bin grep 'quoted text'
+	done awk --verbose export printf local readonly
+	/usr/bin "$1" ${HOME} done "$@" "$@" "$@" sed 'quoted text'
+"$@" test && | $(pwd) "$@" sed x=1 -eu done local grep printf
+	printf done $(pwd) local local then x=1 "$@" cd grep /usr/bin
+		grep "$@" then grep -eu echo -eu /usr/bin
+		${HOME} grep --verbose x=1 $(pwd) 2>/dev/null 'quoted text' test export /usr/bin
+| local "$1" test done && grep export 2>/dev/null ${HOME} -eu 2>/dev/null
+echo 'quoted text' readonly ${HOME} done -eu $(pwd) /usr/bin $(pwd) cd
+	'quoted text' cd echo | && cd "$1" cd
+	cd awk test "$@" export 'quoted text' cd echo /usr/bin
+		awk export test x=1 sed
+		'quoted text' readonly x=1 'quoted text' test x=1 && done sed local 2>/dev/null
+		/usr/bin readonly export -eu done sed cd "$@" 2>/dev/null
+	${HOME} "$@" 2>/dev/null test done then ${HOME} x=1 export grep readonly -eu "$@"
+		--verbose test done test x=1 readonly done "$1" local printf awk printf
+	sed echo cd 'quoted text' --verbose "$@" && && | local then
+'quoted text' echo $(pwd) ${HOME} test
+	'quoted text' then "$@" 'quoted text'
+	"$@" printf && x=1 --verbose x=1 printf ${HOME} local
+local "$1" x=1 | done $(pwd) export -eu echo export awk grep readonly
+/usr/bin printf ${HOME} 'quoted text' cd $(pwd) test -eu done /usr/bin cd ${HOME}
+		$(pwd) local | "$1" local 2>/dev/null x=1
+		echo | -eu -eu printf test 'quoted text'
+	/usr/bin readonly | then cd "$1" export x=1 && x=1 sed export 2>/dev/null
+then -eu test 2>/dev/null $(pwd) sed sed awk local export
+	cd done readonly done sed local export cd
+done /usr/bin readonly 'quoted text' printf --verbose awk
+	$(pwd) awk cd echo test local "$1" printf "$@"
+export | done -eu "$@" grep awk 2>/dev/null printf echo ${HOME}
+	then export printf test then 2>/dev/null echo export
+/usr/bin $(pwd) | grep /usr/bin grep 'quoted text' -eu -eu "$@" | readonly sed
+'quoted text' done | export --verbose ${HOME} echo
+		local grep x=1 | --verbose readonly --verbose then then x=1 awk
+		&& && ${HOME} export "$1" local sed 'quoted text' /usr/bin echo --verbose
+	--verbose -eu -eu local awk ${HOME} x=1
+		${HOME} export ${HOME} awk test /usr/bin "$@" 'quoted text' "$1" cd echo
+--verbose 'quoted text' then export 2>/dev/null
+	sed awk grep awk local cd
+	$(pwd) "$@" $(pwd) && 'quoted text'
+	"$1" ${HOME} printf "$1" $(pwd) x=1 "$@" export sed $(pwd)
+	printf x=1 readonly cd done then 'quoted text' 2>/dev/null /usr/bin
+	2>/dev/null --verbose
+then done | cd "$@" readonly
+	cd awk $(pwd) echo test export test && export 2>/dev/null
+		test cd ${HOME} 'quoted text' test test "$1" then readonly
+	'quoted text' && then x=1
+		x=1 && cd x=1 cd -eu $(pwd)
+		grep 2>/dev/null x=1 | local awk $(pwd) ${HOME} done && cd sed
+printf cd cd echo awk
+	"$1" done "$@" x=1 printf grep local $(pwd) 'quoted text'
+	awk grep done | 2>/dev/null "$1" local ${HOME} local "$1" 2>/dev/null
+"$@" awk /usr/bin sed ${HOME}
+"$@" --verbose 'quoted text' --verbose echo "$1"
+test export $(pwd) /usr/bin sed readonly 'quoted text'
+		local && "$@" ${HOME} printf cd local
+	sed done "$@" "$1" grep 'quoted text' awk x=1 ${HOME} grep "$1" && /usr/bin
+local local -eu 'quoted text'
+	"$@" readonly --verbose cd 'quoted text' awk local ${HOME} printf "$@" "$1"
+	/usr/bin 2>/dev/null then x=1 2>/dev/null
+	echo test "$1" | /usr/bin $(pwd)
+	sed then done x=1 cd -eu local awk x=1 | echo | test x=1 'quoted text' local sed
+		readonly -eu && --verbose test && test x=1
+then export | readonly sed sed sed
+		printf --verbose x=1 done grep
+	2>/dev/null "$@" local "$1"
+		${HOME} | ${HOME} "$1" export awk --verbose 'quoted text'
+x=1 ${HOME} done 'quoted text'
+		sed grep echo /usr/bin
+		$(pwd) --verbose x=1 local readonly readonly 'quoted text' "$@" -eu -eu local
+	/usr/bin x=1 $(pwd) "$@" export printf 2>/dev/null echo /usr/bin done sed
+		x=1 "$1" --verbose 'quoted text'
+	local printf | grep printf echo echo ${HOME}
+awk done export sed export /usr/bin echo echo done -eu echo cd 'quoted text'
+2>/dev/null /usr/bin echo readonly "$@" then test -eu test printf $(pwd) &&
+		$(pwd) -eu --verbose $(pwd) printf &&
+		export grep /usr/bin 'quoted text' ${HOME}
+	awk awk x=1 printf &&
+		export && export -eu ${HOME} sed
+	&& local test && awk grep export readonly ${HOME}
+		--verbose $(pwd) | then $(pwd)
+readonly /usr/bin then printf echo -eu 'quoted text'
+	sed echo x=1 $(pwd) done && readonly
+-eu --verbose x=1 'quoted text'
+awk --verbose "$1" -eu test && -eu "$@" awk $(pwd) x=1 -eu export 2>/dev/null
+	'quoted text' "$@" ${HOME} readonly sed
+		local | local grep sed printf awk | printf readonly export readonly
+--verbose -eu | local x=1 local cd x=1 -eu /usr/bin -eu sed --verbose &&
+grep ${HOME} | cd cd cd printf done
+/usr/bin export cd ${HOME}
+&& "$@" done && test && test local "$1" x=1 local /usr/bin x=1
+	--verbose grep then done readonly x=1 | 2>/dev/null echo "$1" x=1 readonly readonly
+local x=1 2>/dev/null export grep 'quoted text' ${HOME}
+	readonly 2>/dev/null 'quoted text' | readonly "$@" done "$1" "$@" cd
+	test awk sed echo &&
+local readonly -eu $(pwd) then grep cd readonly /usr/bin export then
+-eu printf printf cd $(pwd) 2>/dev/null /usr/bin --verbose
+	local export "$@" printf ${HOME} export
+	cd export | | 2>/dev/null readonly -eu 'quoted text' ${HOME} x=1 test grep
+sed grep "$1" --verbose readonly local
+		grep done done x=1 export /usr/bin /usr/bin sed && awk
+	cd -eu grep local export cd 'quoted text' awk -eu
+awk printf then 2>/dev/null printf
+2>/dev/null "$1" awk 'quoted text' $(pwd) "$@" local /usr/bin /usr/bin
+	/usr/bin awk export --verbose
+'quoted text' cd "$1" "$1" /usr/bin export
+		| awk then grep && ${HOME} "$1" export 2>/dev/null 'quoted text' grep
+		/usr/bin /usr/bin test awk --verbose sed -eu readonly then 'quoted text'
+	$(pwd) test grep "$@" -eu test
+		-eu -eu awk awk 2>/dev/null done export "$@" "$@" echo x=1 |
+	export -eu -eu readonly "$@" export readonly -eu ${HOME}
+	printf done sed x=1 | --verbose 'quoted text' cd grep ${HOME} x=1 awk $(pwd) done
+		then sed then test && done 'quoted text' test 'quoted text' grep readonly -eu
+	"$1" 2>/dev/null readonly --verbose cd awk sed | sed 'quoted text' 'quoted text'
+		${HOME} | echo awk -eu echo awk printf
+		'quoted text' "$@" awk export | x=1 test | echo awk
+		readonly echo local && done "$@" echo
+		test sed awk x=1 awk $(pwd) $(pwd) "$1" x=1 readonly cd
+-eu grep | -eu local awk printf readonly | sed $(pwd) ${HOME}
+	echo $(pwd) readonly x=1 --verbose "$1" grep /usr/bin
+		'quoted text' echo awk sed test export "$@" awk cd 'quoted text' -eu x=1
+		grep /usr/bin 2>/dev/null "$@" "$1" cd sed grep && x=1 "$@" -eu 2>/dev/null
+	&& echo ${HOME} echo cd done then sed printf
+done local 'quoted text' printf
+| local sed readonly printf printf export done --verbose -eu then
+"$@" then "$@" done grep -eu grep /usr/bin
+		| done test $(pwd) && done awk printf
+	done grep "$@" cd export sed sed x=1 "$1"
+done echo -eu ${HOME} export printf test 'quoted text' done
+		printf printf 2>/dev/null $(pwd) /usr/bin
+		/usr/bin cd local awk awk printf readonly awk sed
+readonly 'quoted text' | 2>/dev/null
+		${HOME} ${HOME} printf $(pwd) done
+	export export export x=1 && done -eu cd export $(pwd)
+	$(pwd) local awk 'quoted text' test then export ${HOME}
+cd test /usr/bin $(pwd) printf
+		grep readonly export sed awk cd 2>/dev/null --verbose
+grep /usr/bin test "$@" -eu cd 2>/dev/null readonly &&
+test awk $(pwd) done | done echo "$@" x=1 x=1 done -eu
+		2>/dev/null cd ${HOME} test | x=1 echo && done echo && $(pwd) /usr/bin readonly
+	printf echo printf ${HOME} export echo printf test readonly
+x=1 && cd local -eu && done --verbose cd "$1" then | "$1" cd 'quoted text' then
+	"$1" | printf $(pwd) --verbose done --verbose
+		test grep 'quoted text' "$@" "$1" /usr/bin then ${HOME} 'quoted text' "$1" sed
+		| test export cd export local test $(pwd) |
+		printf sed $(pwd) /usr/bin -eu | printf
+sed printf done export cd ${HOME} 'quoted text'
+--verbose 2>/dev/null readonly grep -eu
+		grep awk x=1 'quoted text' done x=1 export 2>/dev/null
+		${HOME} "$@" && "$1" test sed awk printf sed x=1 export --verbose
+		done /usr/bin ${HOME} -eu "$@" done | "$1" $(pwd) awk cd export grep | local
+	${HOME} -eu ${HOME} cd $(pwd) | 'quoted text' then -eu printf 2>/dev/null
@@ -0,0 +1,2001 @@
+	done test ${HOME} then 'quoted text' /usr/bin readonly
+		sed export | 2>/dev/null grep && printf --verbose ${HOME} -eu then && test $(pwd)
+then echo local "$@" printf --verbose sed "$@" local 2>/dev/null done awk 2>/dev/null
+	cd --verbose --verbose printf && test test
+	/usr/bin -eu && done && awk -eu sed printf echo
+	--verbose grep then sed export "$1" && test 2>/dev/null "$1" | x=1 done
+		printf x=1 export "$@" sed done test
+| ${HOME} done ${HOME} -eu cd local cd test ${HOME} $(pwd) test $(pwd)
+	test /usr/bin export 2>/dev/null
+printf | test $(pwd) awk then && "$@" sed ${HOME} /usr/bin
+		"$1" ${HOME} awk x=1 export ${HOME} readonly --verbose --verbose | cd 2>/dev/null
+	export "$@" && then 'quoted text' --verbose 'quoted text' x=1
+	export readonly | readonly x=1 awk
+		"$@" export "$@" echo readonly 2>/dev/null
+${HOME} 'quoted text' local test
+		"$@" local awk | "$@" 2>/dev/null grep && -eu test $(pwd) ${HOME}
+	&& done 'quoted text' x=1 /usr/bin && then 'quoted text'
+	echo awk local awk -eu local echo
+	&& sed done --verbose
+		"$1" ${HOME} sed "$@" 'quoted text'
+		${HOME} grep ${HOME} test
+	--verbose local sed local then "$1" --verbose
+	export cd test local ${HOME} "$@" export
+		test "$@" printf ${HOME} test 2>/dev/null then 'quoted text' "$1" sed then
+		| sed test awk 'quoted text' 2>/dev/null echo local done cd --verbose -eu sed
+"$@" --verbose test /usr/bin cd $(pwd)
+cd readonly -eu "$1" ${HOME} printf local done cd awk readonly "$1" 'quoted text'
+	done /usr/bin readonly readonly "$@" 'quoted text' awk then then readonly
+| 2>/dev/null "$@" sed readonly 'quoted text' "$1"
+		test 2>/dev/null -eu local grep -eu cd "$@" grep echo 2>/dev/null --verbose
+"$@" awk local readonly printf cd "$@" 2>/dev/null
+		export /usr/bin local /usr/bin
+'quoted text' grep test readonly /usr/bin grep "$@" done
+$(pwd) local printf "$@" readonly printf grep local
+		$(pwd) done test printf ${HOME}
+		&& /usr/bin sed cd -eu local
+		done 2>/dev/null | 'quoted text' && awk sed && test done sed export
+2>/dev/null 'quoted text' local ${HOME} printf local --verbose $(pwd) test readonly
+	$(pwd) 2>/dev/null $(pwd) local export cd
+grep readonly ${HOME} "$@" awk --verbose "$@" cd "$1" readonly 2>/dev/null printf
+		readonly readonly -eu done awk sed /usr/bin
+	sed $(pwd) $(pwd) -eu done
+		-eu grep "$1" cd "$1" 'quoted text'
+		grep -eu local sed printf x=1 then printf 'quoted text' | local
+		then && echo local && 'quoted text' --verbose readonly awk then
+cd 2>/dev/null awk cd printf
+	| sed printf local echo --verbose
+"$@" ${HOME} 2>/dev/null
+		local /usr/bin grep sed "$@" x=1 /usr/bin "$@" grep then 2>/dev/null -eu /usr/bin
+	--verbose | "$1" echo "$@" x=1 -eu "$1" 2>/dev/null
+$(pwd) readonly echo grep 2>/dev/null sed -eu echo then echo readonly "$1"
+	-eu -eu printf awk then done x=1 awk /usr/bin echo 'quoted text'
+		readonly --verbose printf
+	done && "$1" x=1 -eu cd echo && export
+		${HOME} -eu --verbose 'quoted text' local readonly && --verbose awk local done
+	export -eu export local "$1" grep done sed
+		--verbose 2>/dev/null awk --verbose cd x=1 printf awk 2>/dev/null
+	cd sed then $(pwd) ${HOME} cd sed grep
+		/usr/bin | cd ${HOME} -eu readonly printf "$1" sed sed x=1 2>/dev/null
+sed --verbose local -eu done
+		&& 'quoted text' printf /usr/bin grep 2>/dev/null /usr/bin
+	&& cd | local local ${HOME} done "$1" local | | 2>/dev/null export | x=1 done
+		/usr/bin ${HOME} grep ${HOME}
+readonly sed | 2>/dev/null /usr/bin sed awk cd echo echo done
+	2>/dev/null cd 'quoted text' &&
+	grep export test readonly local ${HOME} sed awk && local done /usr/bin
+	"$@" && export /usr/bin x=1 grep && grep local printf
+		${HOME} sed -eu && 2>/dev/null grep | sed export
+	"$@" export grep 2>/dev/null export grep /usr/bin
+echo x=1 x=1 awk cd export readonly 2>/dev/null "$@" && |
+/usr/bin | "$@" readonly "$1" readonly printf local export
+	-eu cd then $(pwd) done "$@" cd x=1 awk done
+$(pwd) /usr/bin grep /usr/bin grep then 'quoted text'
+	"$1" cd | "$@" ${HOME} 'quoted text' ${HOME} -eu ${HOME} --verbose done
+readonly "$@" /usr/bin grep cd sed export --verbose
+		--verbose 'quoted text' printf 'quoted text' echo then readonly x=1 local
+	export done $(pwd) local sed then sed export local echo ${HOME} local 2>/dev/null
+		'quoted text' "$@" echo x=1 $(pwd) "$1" local && $(pwd) "$1" readonly
+done cd "$1" "$@" readonly ${HOME} "$@" && export $(pwd)
+local && && /usr/bin awk -eu then "$@" "$1" /usr/bin
+$(pwd) test awk && x=1 awk echo awk awk export "$@" echo
+echo $(pwd) local cd -eu then test local
+		export sed export done 2>/dev/null export
+sed awk "$@" ${HOME} export local x=1 --verbose 'quoted text'
+	| /usr/bin "$@" "$1" ${HOME} export "$1" | "$@" printf local
+export "$1" ${HOME} x=1 echo done -eu && 2>/dev/null ${HOME}
+	"$@" export ${HOME} 'quoted text' --verbose printf readonly grep done
+	| 2>/dev/null grep echo | "$@" readonly x=1 $(pwd) --verbose
+x=1 test readonly echo awk && grep export -eu 2>/dev/null /usr/bin --verbose
+	sed readonly --verbose test export
+		done 2>/dev/null echo --verbose /usr/bin export
+	printf "$@" export test readonly
+awk 'quoted text' && local -eu | readonly echo cd cd export
+	done awk sed readonly ${HOME}
+	cd | --verbose sed $(pwd) ${HOME} grep echo readonly
+then then 2>/dev/null done awk sed
+		'quoted text' "$@" ${HOME} printf cd then "$@" | 'quoted text'
+		printf echo cd done grep readonly
+		readonly "$1" ${HOME} then
+		$(pwd) 2>/dev/null | local $(pwd) "$@" then 'quoted text'
+-eu then --verbose -eu printf then | grep
+	"$@" ${HOME} -eu "$1" -eu cd --verbose $(pwd) local local --verbose echo
+		awk local readonly grep "$@" "$@" readonly
+	x=1 grep ${HOME} "$@" "$@" printf | "$1" -eu 'quoted text' test readonly
+	local x=1 readonly "$1"
+	--verbose --verbose ${HOME} && ${HOME} cd ${HOME} --verbose sed
+		'quoted text' done $(pwd) grep echo echo printf
+	&& printf cd | cd /usr/bin 2>/dev/null
+| x=1 "$@" -eu printf ${HOME} echo 'quoted text'
+		--verbose 2>/dev/null "$1" ${HOME} 'quoted text'
+		echo | then echo $(pwd) grep ${HOME} x=1 /usr/bin grep | export -eu | export
+--verbose test test -eu --verbose x=1 test 2>/dev/null -eu echo --verbose
+	sed echo "$1" 'quoted text' "$1" x=1 ${HOME} grep 2>/dev/null ${HOME}
+		cd local printf cd done done echo then echo && cd done sed readonly
+	done "$@" cd 2>/dev/null test then
+sed "$1" echo readonly 'quoted text' printf
+export readonly "$@" done 'quoted text'
+	awk printf echo export 2>/dev/null /usr/bin --verbose test
+	printf $(pwd) ${HOME} echo printf test "$@"
+2>/dev/null test printf "$@" /usr/bin
+	done 'quoted text' grep then echo echo
+		printf | /usr/bin ${HOME} then
+"$@" local grep readonly ${HOME} local "$1" printf
+export --verbose && grep sed export cd 'quoted text'
+	&& readonly printf 2>/dev/null local
+		echo local done local cd sed then grep 'quoted text' readonly $(pwd) test "$@"
+		then ${HOME} done $(pwd) then test cd --verbose -eu printf readonly -eu
+		2>/dev/null -eu /usr/bin done cd $(pwd) echo export done
+		local sed "$1" sed $(pwd) then echo then /usr/bin "$@" "$@" then export
+	-eu grep --verbose sed sed done cd awk sed &&
+		grep readonly local x=1 'quoted text' 2>/dev/null "$1" sed $(pwd) "$1"
+		--verbose echo | -eu $(pwd) cd --verbose /usr/bin x=1 "$1" then cd export x=1
+		&& cd done readonly 2>/dev/null | ${HOME} $(pwd) readonly | --verbose
+	echo x=1 "$1" x=1 done test local export cd echo
+2>/dev/null 2>/dev/null export echo -eu $(pwd) x=1
+		readonly --verbose /usr/bin
+| ${HOME} -eu x=1 | then | then | | 'quoted text' | awk --verbose && local 2>/dev/null
+printf readonly sed cd cd readonly 2>/dev/null ${HOME} awk readonly ${HOME} test
+		readonly printf $(pwd) | printf 'quoted text'
+sed test /usr/bin local
+		sed 2>/dev/null grep $(pwd) x=1 then done
+	${HOME} | test readonly sed $(pwd) export sed && -eu 'quoted text' local awk export
+test test printf 'quoted text' local cd test
+${HOME} | ${HOME} && printf /usr/bin awk echo local
+		'quoted text' then -eu --verbose | test then
+		&& 2>/dev/null local ${HOME} awk "$1" | echo sed 'quoted text'
+	export "$@" "$@" cd -eu local echo echo echo x=1
+&& done printf /usr/bin grep -eu export x=1 export $(pwd) "$1" && "$1" echo cd awk
+	awk "$@" $(pwd) echo ${HOME} | done
+		awk done x=1 local then awk "$@" $(pwd) /usr/bin ${HOME} "$1"
+local test --verbose sed export $(pwd)
+	&& x=1 "$@" grep grep $(pwd) awk echo -eu printf /usr/bin grep then printf readonly
+		done "$@" sed --verbose printf awk "$1" "$@" export
+then grep test /usr/bin printf ${HOME} test local -eu | export
+		--verbose cd grep cd local | grep
+		sed readonly $(pwd) echo /usr/bin printf 2>/dev/null then export readonly "$1"
+	${HOME} 2>/dev/null --verbose echo /usr/bin test 'quoted text' readonly local
+--verbose x=1 "$1" test $(pwd) 'quoted text' awk -eu then
+sed --verbose --verbose 2>/dev/null
+	x=1 2>/dev/null printf && x=1 sed done && && ${HOME} 'quoted text'
+		cd grep grep "$@" cd /usr/bin export test
+	echo export grep 2>/dev/null cd test "$@" export /usr/bin local $(pwd) &&
+	'quoted text' && | "$@"
+		x=1 export --verbose x=1 | test $(pwd) echo printf then && 2>/dev/null "$@" 'quoted text'
+		'quoted text' export --verbose readonly | then awk awk "$1" -eu echo 'quoted text'
+		'quoted text' then -eu && 'quoted text'
+"$@" "$1" then local /usr/bin
+		export local echo ${HOME} x=1 2>/dev/null
+sed cd $(pwd) | test cd "$@" awk "$@" done readonly 2>/dev/null --verbose
+${HOME} done done --verbose 'quoted text'
+		$(pwd) "$@" --verbose grep awk printf cd echo sed cd local readonly
+--verbose && "$1" done "$@" echo test sed "$@" x=1 printf cd awk x=1 -eu $(pwd)
+		export printf readonly then "$1" then
+sed -eu local cd then x=1 'quoted text' "$@" --verbose 'quoted text' -eu
+	export sed done done then readonly "$@" test done --verbose
+	local done local local 'quoted text' grep | "$1" grep then
+		2>/dev/null $(pwd) "$1" test x=1 sed grep
+local | grep echo echo "$@"
+x=1 x=1 awk "$1" test readonly test | $(pwd) 'quoted text'
+"$1" "$@" export cd then done
+		-eu awk grep -eu "$1"
+sed local cd --verbose "$@"
+		export local done printf cd test done "$1" echo then then grep x=1 echo then
+${HOME} "$@" 'quoted text' done
+awk echo local cd --verbose /usr/bin
+-eu local ${HOME} cd $(pwd) done -eu x=1 cd export sed export
+	local export printf | 2>/dev/null | 'quoted text' 2>/dev/null
+	grep "$@" "$@" && local "$@" grep ${HOME} export x=1
+-eu grep | awk "$1" "$@" export local export cd /usr/bin
+		sed && $(pwd) 2>/dev/null readonly "$1" "$@" x=1 && -eu printf "$@" printf
+readonly grep "$1" export sed done && done
+	grep 2>/dev/null grep x=1 sed export export 2>/dev/null 2>/dev/null
+		readonly done test 'quoted text' readonly --verbose /usr/bin "$1"
+2>/dev/null /usr/bin sed | done local 2>/dev/null $(pwd) readonly 2>/dev/null
+2>/dev/null grep sed 2>/dev/null $(pwd) readonly grep readonly
+		"$@" | grep cd export $(pwd) readonly $(pwd) 'quoted text' done grep
+	2>/dev/null "$@" awk printf printf echo $(pwd) export "$@" /usr/bin export
+		done local test echo export $(pwd) 2>/dev/null
+		then --verbose echo sed /usr/bin grep 'quoted text' then 2>/dev/null
+		&& export ${HOME} --verbose ${HOME} 'quoted text'
+		$(pwd) then then ${HOME} sed "$1" readonly "$@" cd | -eu printf
+cd sed readonly 2>/dev/null grep sed -eu 'quoted text' echo
+		"$1" x=1 printf /usr/bin printf
+	export -eu ${HOME} then
+&& test --verbose printf "$@" readonly "$1" printf 2>/dev/null done then
+	/usr/bin 2>/dev/null x=1 'quoted text' printf sed 2>/dev/null test cd x=1 x=1
+		export sed --verbose printf echo test cd -eu $(pwd) done "$1" local | && -eu "$1"
+$(pwd) ${HOME} 'quoted text'
+sed "$@" done --verbose && "$@"
+| && sed awk sed x=1 done test 'quoted text' grep && 'quoted text'
+	/usr/bin printf cd test x=1 export export then
+then readonly 'quoted text'
+then sed echo export --verbose
+'quoted text' ${HOME} | /usr/bin readonly echo
+		cd --verbose local local done awk readonly
+		/usr/bin /usr/bin -eu /usr/bin && export export
+	printf -eu "$@" cd 'quoted text'
+--verbose 'quoted text' && x=1
+	"$@" export $(pwd) readonly grep printf && "$@" test | echo awk then
+	"$@" echo $(pwd) 2>/dev/null 2>/dev/null cd -eu 2>/dev/null
+		"$1" ${HOME} export /usr/bin then 2>/dev/null "$1" test local
+	--verbose cd 2>/dev/null test grep x=1 | sed
+test $(pwd) awk done ${HOME} $(pwd) /usr/bin awk
+	local | 2>/dev/null $(pwd) -eu
+		'quoted text' cd local cd ${HOME}
+		'quoted text' then awk cd | "$1" printf printf local test /usr/bin test done
+	| sed "$1" export sed test $(pwd) ${HOME} test test
+${HOME} "$@" 'quoted text' && ${HOME} && readonly grep
+		$(pwd) && grep done x=1 -eu cd x=1 "$1" local readonly then local
+		done readonly | export test --verbose
+		awk x=1 -eu | --verbose x=1 test "$@" grep $(pwd) -eu awk echo && $(pwd)
+"$1" then grep readonly printf sed "$1" "$@" $(pwd) x=1 sed readonly ${HOME} "$@"
+--verbose && -eu ${HOME}
+test test x=1 2>/dev/null x=1 done
+	test ${HOME} 2>/dev/null "$1" | 2>/dev/null "$1" cd
+	printf cd then awk 2>/dev/null x=1
+awk done /usr/bin then 2>/dev/null && 'quoted text' cd echo grep -eu grep
+	local echo sed then "$@" "$1" local
+--verbose readonly 2>/dev/null "$1" "$@" | local readonly "$1" then "$@"
+		done printf 'quoted text' "$1" export awk x=1 x=1
+&& grep readonly export $(pwd)
+		cd printf readonly done 2>/dev/null awk | test "$1" x=1 | "$1" local grep -eu
+echo $(pwd) grep 'quoted text' export "$1" cd sed sed grep echo readonly
+"$@" grep grep grep echo
+local ${HOME} local -eu awk export x=1 awk then -eu
+	done test /usr/bin ${HOME} && test 'quoted text' readonly
+		"$1" 2>/dev/null 'quoted text' "$@" x=1 cd /usr/bin 'quoted text'
+	export x=1 test cd -eu 2>/dev/null
+| local ${HOME} then x=1 local
+	then && export done ${HOME} 2>/dev/null && "$@" awk grep printf sed then
+printf "$@" cd --verbose -eu printf export done --verbose export awk done
+		--verbose ${HOME} 'quoted text' local
+		2>/dev/null --verbose export sed /usr/bin printf awk printf readonly
+"$@" "$@" -eu cd x=1 -eu -eu -eu cd /usr/bin then
+		${HOME} then | && local $(pwd) ${HOME} printf 2>/dev/null 2>/dev/null
+		x=1 echo --verbose local | ${HOME} sed
+$(pwd) | -eu | "$1" sed local sed "$1" /usr/bin $(pwd) printf test --verbose |
+	x=1 /usr/bin && 'quoted text' x=1 --verbose -eu awk x=1 -eu 2>/dev/null |
+-eu local export ${HOME} --verbose x=1 printf
+		readonly grep ${HOME} "$@" && ${HOME} ${HOME}
+	--verbose /usr/bin cd --verbose 'quoted text' local grep awk
+sed -eu $(pwd) export echo grep "$@" $(pwd) export $(pwd) done local -eu ${HOME}
+	local local ${HOME} 2>/dev/null
+		$(pwd) && printf local ${HOME} printf | 2>/dev/null -eu "$@" && x=1 sed test
+2>/dev/null "$@" export echo 'quoted text' sed then x=1
+		printf --verbose x=1 export $(pwd) $(pwd) x=1 | echo then done export
+echo grep awk $(pwd) done awk /usr/bin 'quoted text' echo ${HOME} sed
+sed /usr/bin readonly | then ${HOME}
+		printf x=1 $(pwd) 'quoted text' "$@" local "$@" test ${HOME} test
+	done && local "$1" readonly
+	readonly awk "$@" x=1 sed --verbose echo -eu "$1"
+		$(pwd) printf "$@" /usr/bin then
+then local "$1" then cd ${HOME} x=1 readonly printf readonly local
+--verbose done 2>/dev/null cd | x=1 2>/dev/null ${HOME} local cd
+	awk /usr/bin /usr/bin "$@" grep /usr/bin "$1" export $(pwd) awk "$1" done test
+${HOME} "$@" | awk grep x=1 export test
+	-eu -eu "$1" local x=1 ${HOME} x=1 && done awk ${HOME} && ${HOME}
+2>/dev/null | printf "$1" printf 2>/dev/null
+'quoted text' 2>/dev/null 'quoted text' "$@" sed echo 2>/dev/null
+		'quoted text' local "$@" readonly -eu && readonly $(pwd) 'quoted text' | | printf
+		sed readonly -eu printf --verbose export local then $(pwd) 'quoted text' && local
+	-eu local ${HOME} "$1" ${HOME} -eu test echo && && printf "$@" "$@"
+		sed test | /usr/bin "$@" "$1" -eu x=1 "$1" printf /usr/bin local && && readonly
+	grep grep cd test then export test "$@" $(pwd) "$1" then | test readonly
+		export "$1" /usr/bin
+		x=1 cd cd 2>/dev/null cd printf local 2>/dev/null "$@"
+	export /usr/bin "$1" readonly x=1 --verbose local
+		local ${HOME} grep $(pwd) printf echo ${HOME} | "$1" then
+	test 2>/dev/null "$1" x=1 /usr/bin x=1 && $(pwd) then done "$1" awk --verbose
+	export test | | -eu echo local x=1 sed $(pwd) sed ${HOME} grep /usr/bin
+then --verbose sed grep x=1 && awk /usr/bin "$@" awk ${HOME} printf
+		cd "$@" | cd local printf sed sed printf
+	| echo $(pwd) ${HOME} $(pwd)
+		export test cd done ${HOME} grep /usr/bin 2>/dev/null x=1
+		export 2>/dev/null 2>/dev/null
+echo "$@" printf && printf x=1 then
+		$(pwd) awk ${HOME} awk && local export 2>/dev/null
+		then local readonly test export echo export then cd "$1" -eu grep && awk
+"$1" "$@" ${HOME} cd 'quoted text' ${HOME} -eu 2>/dev/null
+		printf --verbose grep 'quoted text' echo grep 'quoted text' "$1"
+	test "$1" echo -eu $(pwd) sed printf
+	test printf ${HOME} "$@" echo awk export test | 2>/dev/null ${HOME}
+cd awk $(pwd) && export x=1 local | readonly test export ${HOME}
+	x=1 "$1" printf cd local export readonly "$@" "$1"
+	echo -eu 2>/dev/null sed /usr/bin then $(pwd) "$@"
+		"$1" local local done done done
+grep export /usr/bin cd then /usr/bin printf sed export "$1" -eu awk
+		grep 2>/dev/null echo cd local | sed sed ${HOME}
+	awk test sed printf export 2>/dev/null $(pwd) grep
+/usr/bin $(pwd) cd export sed
+		$(pwd) echo cd x=1 cd
+	grep 'quoted text' awk ${HOME}
+		echo readonly sed grep done sed /usr/bin done "$1" then 'quoted text'
+	$(pwd) 'quoted text' $(pwd) then 'quoted text' then export
+	done 'quoted text' 'quoted text'
+		echo /usr/bin /usr/bin sed ${HOME} /usr/bin then /usr/bin
+printf ${HOME} x=1 cd test echo "$1" export grep grep
+	&& "$1" readonly "$@" -eu then 'quoted text'
+		printf && cd done $(pwd) local --verbose echo -eu awk local
+		$(pwd) $(pwd) readonly && awk "$@" sed --verbose && grep sed "$@"
+export "$1" ${HOME} x=1 done export export && | -eu ${HOME}
+'quoted text' -eu local "$@" 2>/dev/null test "$@"
+local -eu "$@" echo | export awk ${HOME}
+	echo 2>/dev/null done printf
+	"$@" && --verbose done then grep then /usr/bin sed printf /usr/bin
+	test printf && readonly $(pwd) $(pwd) x=1 export 2>/dev/null cd ${HOME}
+	$(pwd) /usr/bin "$@" "$@" "$1" -eu -eu ${HOME}
+	local done -eu --verbose printf x=1 && local test awk $(pwd) | sed export
+		export -eu test /usr/bin 2>/dev/null
+		| done then "$1" 'quoted text' test --verbose readonly 'quoted text'
+'quoted text' "$1" test test export done && local "$1" | "$@"
+	&& "$1" ${HOME} $(pwd) -eu export 'quoted text' echo sed readonly
+		-eu /usr/bin echo ${HOME} export done 'quoted text' $(pwd) cd
+	then && readonly "$@"
+		grep ${HOME} "$@" 2>/dev/null awk
+		local awk then ${HOME} --verbose
+	/usr/bin local /usr/bin -eu 2>/dev/null printf echo
+		cd /usr/bin ${HOME} ${HOME} "$1"
+		| 'quoted text' grep cd export readonly "$1" 2>/dev/null
+	'quoted text' echo x=1 then local cd 2>/dev/null printf ${HOME} readonly
+$(pwd) test && -eu printf export done "$@" "$1" -eu 'quoted text' x=1 done cd
+readonly echo | cd -eu local -eu "$1"
+		/usr/bin grep local $(pwd) cd export | export readonly echo
+		$(pwd) sed 2>/dev/null local x=1 sed readonly test --verbose awk $(pwd)
+		export -eu test --verbose 2>/dev/null awk cd done grep 2>/dev/null "$@"
+	export grep --verbose "$1" cd | local | $(pwd) readonly
+&& grep printf ${HOME} grep awk "$1" cd local echo --verbose test | sed awk awk
+		printf x=1 echo -eu echo grep x=1
+		grep awk done "$@" /usr/bin | awk done -eu
+"$@" ${HOME} done && test export cd "$1" awk -eu
+		/usr/bin grep && cd "$1"
+cd local -eu $(pwd) sed then test $(pwd) local 2>/dev/null
+	&& local x=1 -eu x=1 ${HOME} /usr/bin printf done "$@" readonly grep -eu -eu
+		local printf x=1 echo local -eu "$1" printf 'quoted text' then then 'quoted text'
+echo /usr/bin then done readonly
+		local "$1" "$1" grep /usr/bin sed -eu "$@" printf
+	echo done grep done "$@" && 2>/dev/null x=1 then &&
+readonly printf 'quoted text' "$@" ${HOME}
+	/usr/bin echo printf grep /usr/bin readonly $(pwd)
+		done grep grep /usr/bin sed 'quoted text' readonly done done /usr/bin
+"$@" 2>/dev/null ${HOME} && 'quoted text' test 'quoted text'
+	"$@" "$@" 2>/dev/null --verbose --verbose grep echo echo
+	${HOME} | && 2>/dev/null readonly local
+grep test grep "$1" cd awk
+--verbose 'quoted text' && cd readonly grep | printf ${HOME}
+"$@" then && readonly export grep 2>/dev/null export 2>/dev/null grep
+	cd --verbose awk $(pwd) --verbose readonly awk local echo -eu /usr/bin &&
+	'quoted text' && 2>/dev/null test then then | "$@" $(pwd) x=1 /usr/bin $(pwd)
+		awk then then readonly done test "$@" printf -eu /usr/bin | 2>/dev/null
+readonly --verbose "$@" && export
+	| done sed --verbose cd "$@" "$1" && | readonly
+		-eu 2>/dev/null cd x=1 "$@" printf test then readonly done sed readonly
+	test && && 2>/dev/null 2>/dev/null ${HOME} awk echo 'quoted text' done cd export
+2>/dev/null export "$1" x=1 cd grep cd sed x=1 echo echo "$1" "$1" export |
+${HOME} local printf x=1 readonly
+/usr/bin grep 2>/dev/null "$@" "$@"
+${HOME} sed readonly $(pwd) -eu | grep | printf awk ${HOME} --verbose 2>/dev/null
+		${HOME} x=1 sed -eu 2>/dev/null && awk $(pwd) awk -eu then sed sed /usr/bin sed
+	then "$@" x=1 "$1" /usr/bin
+2>/dev/null 'quoted text' ${HOME} && --verbose | "$@" --verbose
+	x=1 'quoted text' x=1 readonly -eu | "$@" export "$1"
+cd printf $(pwd) | awk then --verbose echo /usr/bin done test cd x=1 test readonly
+		-eu test grep local /usr/bin cd && sed
+printf && x=1 sed "$@" done 'quoted text' readonly
+echo echo printf cd done | then test
+cd /usr/bin | local && printf 'quoted text'
+		&& done ${HOME} -eu then
+	grep test cd /usr/bin sed awk "$1" x=1
+	'quoted text' export x=1 /usr/bin export x=1 sed "$1" cd ${HOME}
+grep then --verbose /usr/bin
+		| test cd x=1 cd printf done 2>/dev/null sed
+'quoted text' ${HOME} 2>/dev/null 2>/dev/null
+	2>/dev/null "$@" grep local | readonly printf
+	local "$@" printf done printf local test --verbose test
+-eu --verbose -eu then 'quoted text' export
+export "$1" x=1 printf export 'quoted text'
+		local "$@" "$@" 2>/dev/null
+	$(pwd) awk --verbose "$1" done local cd
+		test "$1" && && grep --verbose test readonly
+"$@" ${HOME} echo 2>/dev/null cd
+	"$@" && "$@" --verbose
+		local readonly "$@" echo 2>/dev/null
+	${HOME} awk x=1 2>/dev/null awk grep | test $(pwd) then
+	$(pwd) printf echo --verbose
+then awk 'quoted text' x=1 sed 'quoted text' && cd && -eu | x=1 "$@" && -eu 'quoted text'
+-eu sed "$1" printf x=1 awk cd && printf
+		then local --verbose x=1 "$1" test "$1" --verbose grep
+echo cd test sed sed $(pwd) readonly
+	test grep sed awk -eu
+		-eu done && sed /usr/bin 2>/dev/null 2>/dev/null test /usr/bin
+then ${HOME} done | done cd | $(pwd) x=1 done grep local
+	x=1 cd test test 2>/dev/null x=1
+"$@" readonly --verbose /usr/bin then
+done "$@" | "$@" sed done "$1" cd && test && cd "$@"
+	${HOME} done echo grep ${HOME}
+		--verbose x=1 test test "$1" ${HOME}
+	${HOME} readonly printf 2>/dev/null printf local then "$1"
+	cd cd /usr/bin -eu "$@" "$@" echo awk | && local $(pwd)
+		awk 'quoted text' -eu /usr/bin x=1 export cd printf 2>/dev/null x=1 sed done $(pwd)
+		awk local 'quoted text' "$@" readonly
+		&& printf echo --verbose sed readonly && grep local 'quoted text'
+	--verbose sed done awk done test x=1 ${HOME} done --verbose
+		"$1" 2>/dev/null printf sed done local done
+	/usr/bin 'quoted text' printf export echo test ${HOME}
+cd x=1 x=1 x=1 $(pwd) /usr/bin echo grep --verbose done $(pwd) "$@"
+		export x=1 local local echo grep local x=1 awk awk
+	then --verbose done grep local awk sed
+	test "$@" "$@" -eu cd done local --verbose $(pwd) x=1 grep awk x=1
+'quoted text' /usr/bin "$1" done grep
+		grep x=1 echo "$@" | readonly && sed --verbose x=1 'quoted text' echo ${HOME}
+	&& echo sed $(pwd) echo sed awk echo grep
+		x=1 x=1 'quoted text' && --verbose local export "$@" "$1" awk "$@"
+"$@" grep cd export && readonly
+	| local && ${HOME} $(pwd) then
+-eu -eu "$@" awk then $(pwd) grep "$1"
+		"$@" "$@" sed test local $(pwd) printf "$1" x=1 sed 2>/dev/null awk x=1 awk readonly
+then 2>/dev/null 2>/dev/null --verbose "$@" readonly | | 2>/dev/null done 2>/dev/null
+printf 'quoted text' then test $(pwd) then ${HOME} test echo local
+		| -eu readonly awk ${HOME} test && sed -eu
+	local local export grep --verbose
+	grep export cd export awk sed cd 'quoted text' "$@" ${HOME}
+export /usr/bin sed test readonly "$@" grep test 'quoted text' $(pwd)
+2>/dev/null /usr/bin echo done readonly ${HOME} $(pwd) "$1"
+	'quoted text' "$1" -eu cd --verbose printf
+		'quoted text' $(pwd) local $(pwd) local
+	printf 2>/dev/null ${HOME} --verbose 2>/dev/null local done 2>/dev/null
+	echo export export "$1" /usr/bin /usr/bin "$1"
+		'quoted text' printf cd
+	&& readonly local /usr/bin local readonly
+-eu "$@" 2>/dev/null 'quoted text'
+	--verbose 'quoted text'
+		done --verbose ${HOME} --verbose && printf && 2>/dev/null
+		test -eu /usr/bin ${HOME} --verbose readonly export
+		&& done grep $(pwd) $(pwd)
+		${HOME} --verbose local | local
+	then "$@" awk test /usr/bin && -eu printf printf | test /usr/bin cd | -eu local
+	$(pwd) sed printf x=1 printf export && grep local echo
+		&& local x=1 x=1 done -eu 'quoted text'
+	'quoted text' awk export /usr/bin awk 'quoted text' "$1" $(pwd) && "$@"
+cd grep --verbose printf then
+	printf ${HOME} readonly "$1" --verbose x=1 echo sed test echo cd
+		export then ${HOME} grep echo /usr/bin test $(pwd) local
+	test 2>/dev/null 'quoted text' readonly -eu local sed -eu test ${HOME}
+		2>/dev/null test awk /usr/bin awk "$1"
+done echo local grep "$@" ${HOME} cd ${HOME} && then | done sed --verbose $(pwd)
+	--verbose export readonly cd /usr/bin grep
+export done 2>/dev/null && done sed grep local then | 2>/dev/null
+		-eu printf test ${HOME} sed $(pwd) then x=1 /usr/bin 'quoted text'
+		"$@" 'quoted text' grep x=1 && cd test sed "$@" cd printf --verbose
+		-eu readonly 2>/dev/null readonly export export sed /usr/bin "$@" export done export
+		--verbose printf sed echo export "$1" 2>/dev/null test readonly && sed
+printf ${HOME} printf grep --verbose done | done readonly -eu local grep sed
+		$(pwd) 'quoted text' test $(pwd)
+		readonly readonly readonly export readonly
+then readonly "$@" test && echo
+-eu /usr/bin -eu awk awk 'quoted text' ${HOME} then $(pwd) | echo export then
+		--verbose export && "$@" && echo ${HOME} local
+		sed printf then then echo sed done grep 'quoted text' $(pwd) test "$1" $(pwd)
+	"$@" "$1" test export && sed "$1" ${HOME} done cd readonly ${HOME}
+		/usr/bin | local | awk $(pwd) -eu readonly "$@" local --verbose x=1
+		&& -eu echo local cd /usr/bin cd "$1"
+then done | && "$@" x=1 printf echo --verbose
+${HOME} /usr/bin 'quoted text' grep 'quoted text' echo printf grep export $(pwd)
+		$(pwd) -eu test --verbose export grep sed
+export readonly $(pwd) x=1 awk local grep -eu awk "$@" $(pwd) ${HOME} grep $(pwd)
+done -eu local /usr/bin && export then --verbose
+		local test 2>/dev/null | --verbose "$@"
+		local && echo /usr/bin
+		test export sed readonly $(pwd) export awk --verbose echo local
+		readonly readonly "$@" printf --verbose
+	"$1" 'quoted text' "$@" "$@" -eu then 'quoted text' export ${HOME}
+		grep printf 'quoted text' x=1 /usr/bin 'quoted text'
+	&& awk /usr/bin && /usr/bin
+	done "$@" ${HOME} printf 2>/dev/null export sed printf && cd echo /usr/bin
+	then x=1 grep x=1 && export
+		&& --verbose --verbose local echo sed echo $(pwd) readonly local
+	test readonly cd "$@" "$1" 'quoted text'
+		&& export export done | ${HOME} /usr/bin && readonly "$1" | grep awk
+		done sed "$@" | | echo awk awk echo "$1" grep ${HOME} printf
+	-eu x=1 2>/dev/null x=1 x=1 $(pwd) sed /usr/bin $(pwd) /usr/bin
+	$(pwd) done ${HOME} /usr/bin awk then && printf
+	"$@" --verbose grep awk export /usr/bin awk test "$1" "$1" test | --verbose
+		| 'quoted text' test -eu && then --verbose /usr/bin grep printf
+grep 'quoted text' "$1" --verbose
+$(pwd) awk sed && done export grep echo test -eu test
+		export local local -eu printf printf x=1 /usr/bin "$1" local
+/usr/bin export readonly --verbose export cd /usr/bin cd echo -eu x=1 "$1" &&
+		'quoted text' "$1" ${HOME} sed -eu 2>/dev/null
+cd "$1" sed echo export test
+		echo && -eu /usr/bin 2>/dev/null sed 'quoted text' -eu local | done cd 2>/dev/null
+	-eu printf 2>/dev/null local grep x=1 then 2>/dev/null
+	| printf --verbose 'quoted text' x=1 readonly printf 2>/dev/null "$1"
+	test sed readonly grep 'quoted text' ${HOME} 2>/dev/null /usr/bin 2>/dev/null
+	test --verbose printf export x=1 ${HOME} grep readonly test 2>/dev/null grep
+		2>/dev/null "$@" $(pwd) done && sed "$@" local local cd grep sed test
+	'quoted text' "$@" $(pwd) /usr/bin grep printf 'quoted text' cd $(pwd) awk
+		cd cd done printf -eu echo
+	local local && 2>/dev/null
+	local printf test ${HOME}
+	test x=1 printf test $(pwd) test
+		&& then local local ${HOME} && $(pwd) local local --verbose export
+	"$1" --verbose 2>/dev/null awk echo "$1" printf $(pwd) printf local
+		'quoted text' --verbose
+		sed then test x=1 then printf ${HOME} 2>/dev/null printf | local done sed grep
+x=1 grep echo cd ${HOME} done -eu sed "$1" grep /usr/bin
+/usr/bin export grep 'quoted text'
+	grep | && export ${HOME} grep && sed
+	/usr/bin "$1" printf "$@" "$@" -eu /usr/bin sed
+		'quoted text' printf local
+	&& && sed test ${HOME} && done sed then "$1" 2>/dev/null echo ${HOME}
+	awk 2>/dev/null sed test printf | 2>/dev/null test awk --verbose
+	--verbose | cd $(pwd) "$@"
+		awk $(pwd) 'quoted text' 'quoted text' export && && sed cd "$1" then local sed
+"$1" then "$@" 2>/dev/null && awk grep done $(pwd) "$1" "$1" | "$@" done readonly
+| "$1" local done && export done local
+&& printf "$1" then awk done $(pwd)
+	"$@" echo cd "$@" awk 2>/dev/null | /usr/bin "$@" 2>/dev/null
+$(pwd) --verbose && cd $(pwd) then then 'quoted text' ${HOME} grep export
+		grep | -eu 'quoted text' export cd "$@" sed -eu | then local 2>/dev/null
+--verbose | --verbose x=1 then export done ${HOME} -eu x=1 | x=1 sed local grep
+		2>/dev/null test sed test /usr/bin readonly printf 2>/dev/null /usr/bin
+	echo "$@" grep && grep readonly grep cd local cd 2>/dev/null && done
+		${HOME} -eu done --verbose ${HOME} test test
+done test printf grep 'quoted text' then -eu sed done
+local /usr/bin export && | /usr/bin && then awk "$@" 'quoted text' ${HOME}
+		then local 2>/dev/null "$@" awk done "$@" grep "$1" "$1" local x=1 export
+		export "$1" then 2>/dev/null printf awk && done 'quoted text' | $(pwd) grep
+	| sed ${HOME} cd awk printf
+		done --verbose 'quoted text' grep "$@" readonly $(pwd) test
+		--verbose --verbose -eu
+| readonly done printf && /usr/bin --verbose 2>/dev/null
+		--verbose && printf /usr/bin export sed readonly | 2>/dev/null
+	then test x=1 && "$1" "$@" awk 2>/dev/null grep -eu done 'quoted text' echo | |
+	echo && && echo export x=1 'quoted text'
+grep test x=1 then "$@" x=1 then readonly readonly 'quoted text' grep readonly
+	printf test -eu "$@" grep 'quoted text' cd
+	${HOME} awk readonly readonly --verbose local echo 'quoted text'
+		"$1" printf awk printf awk && "$@" 2>/dev/null
+"$@" | && grep -eu x=1 /usr/bin
+export then && test x=1
+		$(pwd) 2>/dev/null test echo local ${HOME} readonly
+	sed -eu $(pwd) --verbose ${HOME} --verbose /usr/bin
+		| printf "$@" test 'quoted text'
+	sed /usr/bin ${HOME} awk 2>/dev/null /usr/bin /usr/bin "$@"
+"$1" "$1" 2>/dev/null ${HOME} --verbose echo
+		"$@" ${HOME} $(pwd) -eu export $(pwd) sed local --verbose 2>/dev/null
+		2>/dev/null test -eu -eu sed test echo /usr/bin
+echo /usr/bin && awk sed 2>/dev/null local /usr/bin x=1 /usr/bin ${HOME}
+	test x=1 -eu readonly test
+	/usr/bin local ${HOME} 'quoted text' export export
+		done echo grep cd grep "$1" echo awk /usr/bin --verbose cd export "$1" "$@" grep
+grep printf -eu printf /usr/bin /usr/bin && 'quoted text'
+x=1 --verbose x=1 echo sed "$@"
+printf awk sed "$@" sed sed 'quoted text' then
+	done done printf done "$1" cd local /usr/bin awk ${HOME} x=1 | test 'quoted text'
+test done awk x=1 x=1 ${HOME}
+	"$@" $(pwd) 'quoted text' "$1" test echo cd done "$1" grep $(pwd) readonly
+	local awk -eu "$1" grep --verbose --verbose $(pwd) x=1 then cd "$1" 2>/dev/null
+		then done && local | /usr/bin
+grep 'quoted text' test 2>/dev/null export cd printf awk x=1 echo cd grep sed x=1
+		x=1 2>/dev/null && readonly sed ${HOME} then --verbose -eu cd -eu test local
+-eu local grep "$@" "$@" local cd 'quoted text' test
+		| "$@" test done done printf then x=1 'quoted text'
+x=1 2>/dev/null printf /usr/bin 'quoted text'
+		"$1" printf $(pwd) done 'quoted text'
+echo echo $(pwd) /usr/bin 2>/dev/null --verbose readonly && then |
+		then -eu "$@" /usr/bin grep done sed | export ${HOME} grep test
+${HOME} awk export awk readonly "$@" local test 'quoted text' printf
+2>/dev/null $(pwd) "$1" awk test sed
+		/usr/bin readonly | echo grep then test grep ${HOME} sed
+		/usr/bin local ${HOME} x=1 echo x=1
+		/usr/bin grep readonly 'quoted text' grep local x=1 'quoted text' /usr/bin
+	local "$@" grep test && "$1"
+		"$1" /usr/bin -eu ${HOME} | echo readonly
+	test --verbose x=1 awk
+	&& | $(pwd) cd -eu echo &&
+		"$1" test 'quoted text' x=1 then echo echo x=1 readonly readonly | $(pwd)
+		"$@" 2>/dev/null && awk export export | && "$1" then export
+		"$1" ${HOME} grep ${HOME} --verbose readonly sed $(pwd) x=1 readonly cd x=1
+	cd test test test "$@" readonly export
+test | "$1" local 'quoted text' test ${HOME} 'quoted text'
+${HOME} ${HOME} x=1 then 2>/dev/null done awk ${HOME} -eu done
+	'quoted text' ${HOME} "$1" | cd sed "$1" x=1 readonly && sed
+"$1" export | readonly /usr/bin ${HOME} 2>/dev/null
+'quoted text' grep --verbose echo then
+	/usr/bin local "$@" -eu 2>/dev/null
+	echo awk /usr/bin done sed
+		| awk 2>/dev/null sed 'quoted text' done
+	"$1" sed "$1" x=1 cd echo $(pwd) cd && readonly then then done readonly cd
+		| then sed local echo readonly export | readonly | printf echo
+${HOME} -eu echo sed /usr/bin x=1 $(pwd) then then export ${HOME} "$@" $(pwd)
+&& grep -eu grep local export printf printf /usr/bin && awk echo printf /usr/bin
+		local -eu echo then --verbose /usr/bin printf /usr/bin done then --verbose
+		| done /usr/bin --verbose then printf grep
+		x=1 cd 'quoted text' grep "$@" $(pwd) readonly "$1" readonly
+		${HOME} 2>/dev/null "$1" "$1" awk awk "$@" "$1"
+	$(pwd) /usr/bin grep -eu done 2>/dev/null "$1" readonly "$1" export
+	sed cd export echo x=1
+echo readonly -eu -eu
+	awk x=1 'quoted text' | x=1 cd done x=1 'quoted text' "$@" grep then "$@"
+"$1" ${HOME} done done grep $(pwd)
+then test printf && local awk then readonly 2>/dev/null && printf then "$@"
+		awk ${HOME} echo "$1" export /usr/bin "$1" /usr/bin "$@" x=1 x=1 cd
+		'quoted text' ${HOME} cd 'quoted text'
+		"$1" /usr/bin local 'quoted text'
+		| /usr/bin export then "$@" "$1" printf grep echo test sed readonly
+		'quoted text' /usr/bin readonly /usr/bin 2>/dev/null cd sed readonly "$@" echo
+		cd awk "$@" readonly done cd $(pwd) test ${HOME}
+	printf 'quoted text' echo grep grep &&
+		local sed echo printf
+awk export awk grep 2>/dev/null sed export --verbose done awk $(pwd) readonly
+readonly 'quoted text' "$1" cd x=1 awk sed x=1
+2>/dev/null export sed awk $(pwd) "$1" -eu x=1
+		"$@" echo sed local export then
+	/usr/bin --verbose ${HOME} cd /usr/bin export 'quoted text'
+	&& | done grep test cd cd "$1" done $(pwd) cd grep sed "$@"
+		printf -eu ${HOME} x=1 awk echo 2>/dev/null ${HOME} /usr/bin
+		export /usr/bin && | 2>/dev/null done echo --verbose echo export done
+	x=1 | 2>/dev/null grep ${HOME}
+		2>/dev/null readonly $(pwd) x=1 test local && -eu && /usr/bin awk readonly
+	"$@" "$1" export then then
+2>/dev/null $(pwd) sed export -eu --verbose | x=1 then -eu sed "$@" -eu
+2>/dev/null test -eu 'quoted text'
+	| --verbose -eu --verbose $(pwd) --verbose
+		| echo awk x=1 "$@" 'quoted text' -eu
+	then "$1" 2>/dev/null export local done
+	&& test local x=1 /usr/bin --verbose test cd
+-eu readonly $(pwd) 2>/dev/null printf cd $(pwd) echo 'quoted text'
+		--verbose export done 'quoted text' && printf
+	&& x=1 grep grep "$1" "$1" ${HOME} 'quoted text' done "$1" awk printf echo
+export && sed awk printf sed ${HOME} cd echo "$1" sed /usr/bin
+grep /usr/bin sed x=1 echo done | then then then awk
+	echo 2>/dev/null cd done /usr/bin local && local local && then | 2>/dev/null
+		grep awk awk /usr/bin $(pwd) 'quoted text' | x=1 'quoted text'
+	grep --verbose | done sed ${HOME} test export -eu $(pwd) && ${HOME} echo sed "$1"
+readonly "$@" readonly
+	"$1" awk echo echo then done --verbose
+	'quoted text' --verbose $(pwd) 2>/dev/null ${HOME} test ${HOME} export echo
+readonly awk ${HOME} echo | ${HOME}
+export x=1 sed then && awk /usr/bin grep
+	${HOME} "$1" "$1" printf awk cd 2>/dev/null local "$@"
+		$(pwd) test /usr/bin ${HOME} cd readonly | -eu done printf done done /usr/bin
+	$(pwd) readonly printf "$@" awk test sed
+		/usr/bin ${HOME} awk 2>/dev/null done sed --verbose grep --verbose
+		'quoted text' 2>/dev/null cd awk 2>/dev/null
+	2>/dev/null 'quoted text' echo && ${HOME} ${HOME}
+	echo && grep $(pwd) $(pwd) -eu 'quoted text'
+'quoted text' local "$@"
+	2>/dev/null echo echo cd --verbose export printf awk test cd readonly local readonly
+	then done then /usr/bin
+		$(pwd) --verbose 2>/dev/null | cd --verbose "$1" "$@" then test done echo
+		"$@" | 'quoted text' ${HOME} test
+	test $(pwd) x=1 done local sed local done awk grep cd export 2>/dev/null
+	$(pwd) done --verbose --verbose
+	sed echo "$@" done x=1 "$@"
+readonly | && | "$@" "$@" /usr/bin
+| && -eu | awk $(pwd) && /usr/bin test sed echo
+		test "$@" && grep 'quoted text' awk done | grep grep
+	x=1 test printf "$@" -eu grep awk local x=1 echo
+		awk -eu readonly echo echo
+x=1 export 'quoted text' $(pwd) 'quoted text' | 2>/dev/null
+	echo --verbose | printf awk
+		echo /usr/bin readonly test export test readonly 2>/dev/null /usr/bin
+		awk grep local --verbose -eu then |
+		x=1 printf cd awk awk cd -eu --verbose ${HOME} /usr/bin
+		"$1" done x=1 "$1" --verbose grep "$@" done then --verbose
+then && local local x=1 echo $(pwd)
+x=1 awk /usr/bin "$@" "$@" ${HOME} local /usr/bin echo ${HOME} 'quoted text'
+		x=1 x=1 sed done x=1 x=1 cd test readonly done printf echo readonly
+	local local export && 2>/dev/null
+printf "$@" local ${HOME} printf --verbose ${HOME} then ${HOME}
+	local sed --verbose then | "$@" && local --verbose awk then readonly then
+	local done /usr/bin "$@" /usr/bin $(pwd) /usr/bin
+	readonly done /usr/bin echo $(pwd) 2>/dev/null grep $(pwd) "$@" | test test printf
+awk x=1 && && "$@" sed ${HOME} echo 'quoted text' x=1 -eu local
+echo test /usr/bin 2>/dev/null
+	readonly printf echo /usr/bin local local "$@" /usr/bin
+		--verbose 2>/dev/null -eu 2>/dev/null
+		/usr/bin cd done grep export "$@" -eu "$@" done printf
+	/usr/bin echo export local readonly
+	&& cd "$@" 2>/dev/null printf sed "$@" "$1" 2>/dev/null
+	sed "$1" "$1" echo x=1 done local sed && && "$@" then test && | |
+		readonly && export done printf -eu ${HOME} local export
+	grep export awk /usr/bin then then
+	&& test sed awk /usr/bin | /usr/bin
+local local x=1 grep "$1" cd test ${HOME} --verbose
+	export local then -eu local then echo
+		sed test local ${HOME}
+	grep 'quoted text' --verbose cd 2>/dev/null $(pwd) "$@" grep
+${HOME} grep local export cd x=1 then printf cd cd "$@"
+	sed test --verbose cd readonly 'quoted text' readonly ${HOME} then
+		local $(pwd) awk $(pwd) x=1 echo awk readonly "$@" $(pwd) && sed ${HOME} test
+grep /usr/bin awk export sed && ${HOME}
+	2>/dev/null --verbose 'quoted text'
+2>/dev/null grep && test sed && 2>/dev/null echo "$1" -eu then "$@"
+	| -eu sed ${HOME} grep "$@" x=1 2>/dev/null sed local
+		test echo local echo 'quoted text' grep ${HOME}
+/usr/bin awk echo ${HOME}
+		echo x=1 cd local "$1" awk cd |
+done --verbose ${HOME} sed grep "$@" -eu --verbose "$1" &&
+	awk $(pwd) "$@" 'quoted text'
+	2>/dev/null local ${HOME} echo 2>/dev/null export x=1 awk sed then printf
+done echo awk readonly | /usr/bin test local -eu cd | test $(pwd) export -eu
+		cd local local -eu sed sed
+/usr/bin "$@" ${HOME} "$1" grep 'quoted text'
+x=1 grep grep echo -eu --verbose readonly test | test x=1 'quoted text'
+&& done x=1 $(pwd) then readonly then
+		test export 2>/dev/null sed readonly | --verbose export ${HOME} cd /usr/bin
+readonly readonly $(pwd) x=1 x=1 -eu && then && && ${HOME}
+	sed "$1" printf sed 2>/dev/null printf 2>/dev/null awk -eu
+	test /usr/bin x=1 sed 'quoted text'
+	x=1 grep test cd && echo 'quoted text' -eu readonly
+/usr/bin grep done test grep && printf
+	"$@" cd export export readonly $(pwd) x=1 then local cd
+test awk cd echo awk "$@" "$1" 'quoted text' /usr/bin "$@" -eu grep
+echo "$1" printf | --verbose
+		${HOME} "$@" "$1" test 2>/dev/null
+/usr/bin $(pwd) ${HOME} done echo && then && $(pwd) 'quoted text'
+	&& --verbose printf echo grep ${HOME} awk 2>/dev/null readonly
+	x=1 local -eu printf awk "$@"
+		echo test echo export then $(pwd) sed readonly ${HOME} then awk
+	then -eu && && 2>/dev/null test local $(pwd) printf export "$@" /usr/bin
+test local $(pwd) export done done --verbose 'quoted text'
+readonly x=1 $(pwd) $(pwd) grep sed
+		printf $(pwd) "$@" cd 'quoted text' done grep "$@" 'quoted text'
+		"$@" then /usr/bin sed | 2>/dev/null | /usr/bin echo
+		grep test /usr/bin /usr/bin $(pwd)
+		/usr/bin printf test $(pwd) echo printf export done /usr/bin /usr/bin "$1" sed echo
+test -eu | grep then --verbose && printf /usr/bin done printf local --verbose
+	printf local then local sed local
+	x=1 --verbose 2>/dev/null readonly
+then awk printf readonly
+		awk --verbose | test x=1 -eu export cd sed | && grep
+		$(pwd) awk --verbose $(pwd) | -eu && readonly $(pwd)
+		done test export export | | x=1 x=1 awk
+	x=1 sed --verbose readonly
+export echo 2>/dev/null echo 'quoted text' sed -eu --verbose done
+	&& "$1" "$@" && | -eu ${HOME} then && export sed
+	2>/dev/null echo cd done $(pwd) "$1" test /usr/bin local echo
+	echo "$@" -eu done -eu $(pwd)
+grep readonly echo export ${HOME}
+2>/dev/null then | readonly "$1" ${HOME}
+awk /usr/bin readonly
+	done readonly $(pwd) grep cd readonly done sed "$@" && -eu
+done $(pwd) echo x=1 readonly done -eu | -eu printf printf $(pwd)
+		-eu export export && grep local 'quoted text' test 2>/dev/null
+		/usr/bin printf ${HOME} done
+	awk && x=1 export cd 2>/dev/null x=1 echo x=1
+		echo test /usr/bin && done export then 2>/dev/null ${HOME} 'quoted text' done
+		--verbose 'quoted text' export ${HOME} test test $(pwd) |
+	${HOME} "$@" 2>/dev/null -eu -eu && grep ${HOME} --verbose done test readonly "$@"
+		done awk 'quoted text' -eu test printf cd "$@" echo done -eu 'quoted text'
+/usr/bin readonly sed -eu "$1" ${HOME}
+cd 2>/dev/null $(pwd) "$1" 'quoted text' printf
+	$(pwd) --verbose then sed 'quoted text' 2>/dev/null printf awk grep x=1
+done local 'quoted text' sed $(pwd) echo
+		&& $(pwd) test done x=1 then export printf
+		readonly x=1 "$1" grep printf done test "$@"
+-eu ${HOME} grep awk $(pwd) | | "$1" -eu "$1" test readonly && 'quoted text'
+		| cd local --verbose printf "$1" readonly
+grep done ${HOME} echo cd cd && -eu readonly sed && | export --verbose test done
+	echo "$@" test "$1" done
+		test done local /usr/bin "$1" then "$1" x=1 2>/dev/null /usr/bin then cd 'quoted text'
+	"$@" 2>/dev/null -eu ${HOME} x=1
+/usr/bin done test printf export /usr/bin ${HOME} x=1 cd /usr/bin
+		readonly grep local /usr/bin -eu x=1 printf
+"$@" cd grep x=1 $(pwd)
+		-eu && -eu grep ${HOME} && printf
+	awk grep grep awk "$1" /usr/bin
+	$(pwd) --verbose "$1" echo echo "$@" export
+	echo grep grep echo grep cd awk echo readonly --verbose
+printf && x=1 ${HOME} |
+		echo echo -eu done /usr/bin /usr/bin done local
+	x=1 -eu local printf -eu grep 2>/dev/null /usr/bin printf
+	grep awk printf readonly ${HOME} test cd ${HOME} && $(pwd) && printf awk then
+&& printf grep printf
+		"$@" cd x=1 local echo --verbose then /usr/bin 'quoted text'
+echo /usr/bin echo sed done grep
+	test awk test -eu sed /usr/bin "$1" "$@" /usr/bin export x=1
+		local /usr/bin export echo "$@" sed ${HOME} cd "$1" x=1 done | cd
+	${HOME} done readonly 2>/dev/null /usr/bin readonly local $(pwd) --verbose
+	/usr/bin done 'quoted text' "$1" test sed "$@" 'quoted text'
+		export test ${HOME} 2>/dev/null echo cd ${HOME} export -eu -eu x=1
+readonly readonly -eu "$1" 2>/dev/null sed "$@" "$@" &&
+		then x=1 "$1" sed --verbose "$@"
+printf test printf cd 'quoted text' done then
+	-eu "$@" test 'quoted text' local awk echo "$@" "$1" 'quoted text'
+done -eu cd x=1 'quoted text' x=1 /usr/bin export local done -eu
+	'quoted text' export done "$@" /usr/bin 'quoted text' /usr/bin
+	-eu 'quoted text' ${HOME} x=1 sed --verbose
+		${HOME} echo && sed export printf "$1" --verbose cd
+	printf "$1" "$1" $(pwd) then readonly sed
+cd then export awk /usr/bin awk $(pwd) local
+2>/dev/null echo 2>/dev/null
+		then local "$1" $(pwd) -eu grep
+	'quoted text' readonly printf
+"$1" $(pwd) -eu local && | /usr/bin | $(pwd) && sed done -eu "$@" 'quoted text'
+grep awk $(pwd) then x=1
+		"$@" -eu --verbose test then -eu printf "$1" cd echo
+	"$@" x=1 sed local | grep "$@" -eu sed
+awk local export /usr/bin --verbose awk "$@" $(pwd) cd local test export sed
+		export 'quoted text' "$1" local && grep cd sed awk
+		export grep export /usr/bin
+	x=1 2>/dev/null | then | x=1 'quoted text' export --verbose
+		${HOME} "$@" printf 'quoted text' then done "$1" awk sed sed &&
+		${HOME} "$1" readonly test cd "$@" grep x=1
+		-eu local local 'quoted text' ${HOME}
+	test | readonly --verbose
+	then && local readonly |
+	2>/dev/null export 2>/dev/null
+cd && echo readonly 'quoted text' && local then ${HOME}
+done local 2>/dev/null ${HOME}
+	sed x=1 local ${HOME} test local
+		cd echo awk test "$@" 'quoted text' && 2>/dev/null x=1 local && done --verbose
+		cd "$@" | 'quoted text' $(pwd) then awk ${HOME} echo "$1"
+-eu "$@" 'quoted text' "$1" printf
+	2>/dev/null cd | done then readonly 2>/dev/null 'quoted text'
+		${HOME} -eu | 'quoted text' echo "$1" echo then readonly
+	grep done $(pwd) grep 'quoted text' -eu export grep export
+		'quoted text' cd echo done "$1" awk grep 'quoted text' local &&
+	echo /usr/bin 'quoted text'
+		local test cd awk && 2>/dev/null "$@" printf ${HOME} local export
+	readonly "$@" | then then $(pwd)
+| x=1 grep done "$@"
+		cd -eu local export test 2>/dev/null
+		$(pwd) local then -eu $(pwd) ${HOME} 'quoted text' grep test test
+		printf /usr/bin readonly grep x=1 test export readonly ${HOME} /usr/bin
+		'quoted text' 2>/dev/null printf test readonly -eu
+	x=1 | /usr/bin then then test 'quoted text'
+		2>/dev/null sed 2>/dev/null sed && done "$1" 'quoted text' && cd ${HOME}
+	"$@" 2>/dev/null cd -eu /usr/bin --verbose
+		&& /usr/bin sed x=1 2>/dev/null echo done ${HOME}
+	/usr/bin done ${HOME} && export 2>/dev/null "$1" | grep ${HOME} cd 'quoted text'
+	then local readonly && 2>/dev/null
+readonly 2>/dev/null sed done "$@" done local
+	export export $(pwd) ${HOME}
+grep printf --verbose "$@" -eu export
+		${HOME} ${HOME} sed $(pwd) x=1 'quoted text' cd local $(pwd) test
+sed 2>/dev/null echo grep /usr/bin then --verbose --verbose grep $(pwd)
+		echo | then sed 'quoted text' "$@" $(pwd) printf awk
+2>/dev/null done printf test echo | export local "$@" test x=1 /usr/bin
+local && /usr/bin test
+	done $(pwd) $(pwd) && 2>/dev/null
+		printf 2>/dev/null $(pwd) /usr/bin "$1" $(pwd) sed sed
+		local cd echo echo 2>/dev/null && --verbose
+		${HOME} export local cd && sed 2>/dev/null 'quoted text'
+		test printf readonly cd readonly
+		${HOME} cd test test done sed printf sed --verbose x=1
+sed grep local ${HOME} cd --verbose -eu | export -eu printf
+	sed export 2>/dev/null then done && $(pwd)
+		sed x=1 readonly ${HOME} -eu done printf test printf | | 2>/dev/null
+		&& done | test printf done readonly | 'quoted text' $(pwd) printf
+		sed x=1 local export echo /usr/bin
+		"$1" awk echo then "$@" echo "$@" --verbose -eu done printf && 2>/dev/null
+		printf "$@" local export cd -eu 'quoted text' "$1" "$@" -eu "$1"
+	then export test 'quoted text' 'quoted text'
+	readonly 2>/dev/null -eu --verbose
+/usr/bin ${HOME} done ${HOME}
+		done sed ${HOME} | done | ${HOME} ${HOME} export sed done x=1 readonly readonly
+		--verbose readonly -eu grep cd local grep "$1" --verbose
+	then done && && -eu 'quoted text'
+grep export ${HOME} readonly awk printf then ${HOME} ${HOME} --verbose
+	${HOME} | 2>/dev/null "$1" 2>/dev/null
+	grep 'quoted text' -eu export $(pwd)
+	echo /usr/bin local awk done readonly
+cd export export | -eu /usr/bin 2>/dev/null "$1" &&
+cd "$1" -eu readonly done
+	"$@" then 'quoted text' --verbose "$1" --verbose 2>/dev/null ${HOME} printf
+	then /usr/bin "$@" done sed ${HOME} 2>/dev/null -eu printf cd echo &&
+	"$1" $(pwd) then cd sed
+	2>/dev/null $(pwd) /usr/bin 2>/dev/null $(pwd) printf
+	test local $(pwd) cd x=1 sed cd sed cd cd export /usr/bin cd awk
+then $(pwd) cd local $(pwd) -eu | cd | && readonly done grep
+export "$1" cd "$1" x=1 2>/dev/null test 2>/dev/null
+		done x=1 ${HOME} test sed awk echo 'quoted text' 2>/dev/null done | readonly then
+cd awk export then "$@" x=1 "$1" grep test
+	--verbose -eu "$1" "$1" readonly 'quoted text' --verbose 2>/dev/null echo readonly
+		/usr/bin echo $(pwd) test grep export -eu /usr/bin echo
+then --verbose done $(pwd)
+	$(pwd) then export | "$@"
+readonly && -eu && && awk x=1 sed then $(pwd)
+test grep | "$1" x=1 printf x=1
+		${HOME} test cd readonly then "$1" 'quoted text'
+"$1" | ${HOME} "$@" done grep printf "$1" readonly printf "$@" readonly
+	printf echo && export
+test | echo $(pwd) --verbose
+	"$@" && "$@" printf echo done sed "$1" ${HOME} grep x=1 printf 'quoted text' local
+		"$@" echo cd local echo -eu ${HOME}
+	'quoted text' awk | export export local done /usr/bin && x=1 awk
+	${HOME} && printf x=1 echo echo echo 'quoted text' then
+printf local readonly -eu cd local /usr/bin
+		&& then sed /usr/bin --verbose test x=1 "$1" awk --verbose $(pwd) --verbose
+"$@" -eu readonly "$@" 2>/dev/null
+export awk printf 'quoted text' 'quoted text'
+local ${HOME} $(pwd)
+	printf 2>/dev/null 2>/dev/null
+	test printf cd $(pwd) cd printf grep --verbose echo readonly grep && local -eu then
+	'quoted text' then ${HOME} -eu echo grep "$1" /usr/bin readonly
+		local grep readonly ${HOME} then "$@" echo ${HOME} cd readonly
+		then 'quoted text' /usr/bin
+		--verbose -eu "$@" --verbose $(pwd) $(pwd)
+		local sed 'quoted text' test cd grep test done x=1 printf printf && grep
+'quoted text' -eu && --verbose && local local /usr/bin -eu local
+		done test | /usr/bin cd 2>/dev/null
+		${HOME} --verbose readonly export && "$1" 'quoted text'
+		x=1 "$@" sed && x=1 cd test -eu 'quoted text' x=1 sed then
+		/usr/bin printf then test test test sed "$@" 2>/dev/null $(pwd) done
+		echo ${HOME} export $(pwd) "$1" echo
+printf grep /usr/bin echo x=1 grep -eu && then
+		grep then /usr/bin 2>/dev/null printf $(pwd) local $(pwd) x=1 local test done
+--verbose test "$1" /usr/bin 2>/dev/null | /usr/bin $(pwd) echo 'quoted text'
+		local ${HOME} sed export $(pwd) && readonly cd sed
+	sed "$1" grep && readonly done 2>/dev/null --verbose /usr/bin
+'quoted text' printf ${HOME} then | local done printf cd && grep readonly
+		--verbose done /usr/bin $(pwd) test -eu /usr/bin done cd 'quoted text' sed local
+		$(pwd) "$1" --verbose printf awk printf then 2>/dev/null "$@" x=1 /usr/bin
+		readonly cd readonly awk 'quoted text' sed done && then x=1
+		test grep then ${HOME} cd | -eu echo ${HOME} test sed printf $(pwd) printf --verbose
+then "$@" readonly && -eu local ${HOME} "$1" -eu done grep export
+		-eu export sed awk echo awk sed && x=1
+		$(pwd) awk local x=1 then sed cd "$@"
+	grep cd 'quoted text' cd -eu then ${HOME} then readonly
+	test export printf "$1" grep --verbose done then ${HOME}
+then sed && readonly 2>/dev/null 'quoted text'
+	"$@" 2>/dev/null 'quoted text' export local "$@" | "$@" awk sed
+	echo echo /usr/bin printf /usr/bin done awk readonly test grep local cd
+		done test /usr/bin && "$@" "$1" -eu
+		"$@" /usr/bin 'quoted text' "$@" test export -eu cd
+readonly awk grep | -eu "$1" /usr/bin
+	printf export $(pwd) x=1 && then --verbose local ${HOME} "$@" printf
+		--verbose done sed "$1" 'quoted text' ${HOME} cd --verbose test 2>/dev/null
+		&& echo cd "$@" printf awk cd local && awk printf | readonly
+cd cd 2>/dev/null local echo done test cd x=1 export grep "$@" && test
+	"$@" x=1 cd sed | -eu test grep local grep -eu cd
+		x=1 /usr/bin "$@" printf $(pwd) 2>/dev/null
+		readonly readonly 2>/dev/null
+		awk export done | x=1 --verbose
+	--verbose export "$1" 'quoted text'
+	cd local $(pwd) "$1" x=1 readonly readonly
+grep awk "$1" --verbose $(pwd) ${HOME} | "$@"
+		test | 'quoted text' sed x=1 then done x=1 "$1" awk | | | test sed /usr/bin
+	"$1" test echo printf awk /usr/bin -eu 2>/dev/null x=1 | "$@" awk echo 2>/dev/null
+		local && readonly x=1 && "$1" ${HOME} $(pwd) awk
+	-eu && test sed awk x=1 x=1 | /usr/bin "$@" | then ${HOME} ${HOME} "$@" printf
+$(pwd) 2>/dev/null readonly
+		"$@" 2>/dev/null then | -eu "$1" |
+		${HOME} && grep $(pwd) test --verbose readonly
+echo ${HOME} printf -eu "$@" ${HOME} -eu
+$(pwd) && export done
+cd grep done grep /usr/bin export "$1"
+"$@" done 2>/dev/null $(pwd) local 'quoted text' echo /usr/bin 'quoted text'
+		x=1 ${HOME} --verbose then done then x=1 sed "$1" printf | echo
+		--verbose "$1" done x=1 cd $(pwd)
+	'quoted text' printf export
+		/usr/bin printf readonly && export
+| printf sed then -eu printf "$1"
+	x=1 then sed echo /usr/bin awk ${HOME} readonly ${HOME} done | grep echo
+2>/dev/null done then cd 'quoted text' /usr/bin
+		awk x=1 awk cd local $(pwd) && awk "$@" cd sed | echo
+		/usr/bin cd done awk test
+| printf ${HOME} sed && sed readonly | 2>/dev/null done echo sed | readonly
+	${HOME} ${HOME} done 2>/dev/null
+		readonly ${HOME} /usr/bin local "$1" done
+	test 'quoted text' sed -eu 'quoted text' sed && test $(pwd) awk printf
+		2>/dev/null $(pwd) "$1" echo
+		"$1" awk grep echo && awk | local echo sed 2>/dev/null sed "$@"
+		sed 2>/dev/null -eu 2>/dev/null printf x=1 "$@"
+2>/dev/null cd "$1" | 'quoted text' sed | echo awk then -eu export
+		local /usr/bin /usr/bin --verbose | "$@" $(pwd)
+		sed /usr/bin local local 2>/dev/null 2>/dev/null "$1" printf --verbose
+	$(pwd) test 2>/dev/null
+local done then $(pwd) "$1" echo local
+	$(pwd) 'quoted text' -eu 'quoted text' readonly echo "$@" then export
+x=1 'quoted text' grep && then "$@" | 'quoted text' grep ${HOME}
+test -eu readonly done 'quoted text' awk then echo cd echo 2>/dev/null test
+		x=1 awk export /usr/bin -eu awk $(pwd) sed "$@" ${HOME}
+test /usr/bin sed awk then readonly sed ${HOME} cd $(pwd)
+		--verbose cd x=1 -eu --verbose test "$1"
+		test 'quoted text' x=1 'quoted text' test -eu | awk /usr/bin "$1" done
+		"$@" -eu $(pwd) export --verbose cd | --verbose | $(pwd)
+#include c243.sh
+		cd then test printf --verbose cd 2>/dev/null
+printf "$@" && done 2>/dev/null done $(pwd) x=1 $(pwd) 'quoted text'
+		awk local "$@" 'quoted text' "$1" /usr/bin --verbose sed 'quoted text'
+test cd 2>/dev/null then x=1 2>/dev/null --verbose done
+		--verbose /usr/bin | /usr/bin
+		&& then x=1 cd --verbose echo
+	$(pwd) readonly export echo test local "$@" then export
+		export "$1" 2>/dev/null "$@" sed printf export --verbose $(pwd)
+echo then && $(pwd) -eu --verbose --verbose local test --verbose
+		2>/dev/null 'quoted text' 2>/dev/null "$@" /usr/bin grep 'quoted text'
+		--verbose printf -eu ${HOME} printf x=1 x=1 --verbose ${HOME}
+		-eu export 'quoted text' | printf
+		&& awk 2>/dev/null -eu -eu test then | readonly -eu 2>/dev/null
+$(pwd) $(pwd) "$1" 'quoted text'
+done export 2>/dev/null printf printf && readonly $(pwd)
+		/usr/bin readonly 2>/dev/null x=1 cd x=1 ${HOME}
+2>/dev/null 'quoted text'
+	printf "$@" export 2>/dev/null x=1 printf 'quoted text' local
+"$@" sed export done export local x=1 ${HOME} x=1 | local 2>/dev/null
+--verbose export then /usr/bin cd "$1"
+		grep --verbose local printf "$@" && --verbose "$1" ${HOME} readonly --verbose
+		then 2>/dev/null "$1" grep sed awk
+printf printf -eu --verbose sed grep &&
+	grep printf "$@" echo ${HOME} sed /usr/bin then awk readonly
+local /usr/bin 'quoted text' 'quoted text' cd && "$1" readonly
+sed cd then echo 'quoted text' printf test 2>/dev/null
+		echo /usr/bin "$@" 2>/dev/null
+then cd export ${HOME} done sed sed && grep sed export awk done cd done
+	'quoted text' done "$@" test sed sed ${HOME} awk sed awk awk 2>/dev/null cd
+	| 'quoted text' export printf $(pwd) export |
+	-eu awk echo awk x=1 then
+then --verbose "$1" awk && awk test && "$1" then "$@" /usr/bin "$@" cd done
+	readonly printf "$1" grep awk 2>/dev/null "$@"
+export | printf done local x=1 /usr/bin
+	"$@" $(pwd) /usr/bin then readonly cd export --verbose
+	cd then "$@" cd ${HOME} grep "$@"
+grep $(pwd) --verbose /usr/bin export cd | --verbose
+		done 2>/dev/null cd 2>/dev/null ${HOME}
+		'quoted text' ${HOME} x=1 'quoted text'
+	readonly export /usr/bin 2>/dev/null export
+		"$1" grep grep echo then /usr/bin x=1 readonly $(pwd)
+	done "$@" "$1" ${HOME} x=1 ${HOME} | awk x=1 sed readonly done 'quoted text'
+	printf /usr/bin readonly 'quoted text' --verbose printf then
+		-eu grep "$1" awk -eu
+	done then --verbose test ${HOME} then sed done local 2>/dev/null
+	"$@" $(pwd) | --verbose
+awk "$@" cd printf sed local export
+		"$1" grep x=1 "$@" "$1" -eu echo && grep printf 2>/dev/null done cd
+		${HOME} done "$1" sed then cd x=1 && ${HOME}
+export printf --verbose x=1 test awk 2>/dev/null sed && $(pwd) readonly ${HOME}
+		export sed cd /usr/bin /usr/bin sed 'quoted text' /usr/bin $(pwd) echo
+	--verbose | --verbose "$@" "$1" "$@" ${HOME} 2>/dev/null
+-eu echo $(pwd) && "$1" grep --verbose
+local && /usr/bin $(pwd) done echo export sed printf export grep ${HOME} /usr/bin
+	"$1" && 'quoted text' echo done "$1" | --verbose local printf
+awk sed | test --verbose readonly cd then readonly printf then "$1" $(pwd)
+		echo --verbose /usr/bin awk ${HOME} && "$@"
+export readonly 2>/dev/null export && "$@" ${HOME} local 'quoted text'
+grep echo printf -eu echo "$@" readonly
+	echo grep then ${HOME} export $(pwd) then 'quoted text' $(pwd)
+awk export sed /usr/bin 2>/dev/null | export
+	local readonly "$@" | readonly sed -eu then readonly "$1"
+	then then x=1 then done ${HOME} done ${HOME} | then --verbose /usr/bin
+		printf | then $(pwd) test "$1" --verbose printf
+		readonly 'quoted text' "$1" local | printf
+	/usr/bin | cd /usr/bin test
+cd "$1" | /usr/bin "$1"
+	echo -eu 2>/dev/null local | test then test "$1" /usr/bin
+echo "$@" && $(pwd) 'quoted text' -eu awk /usr/bin $(pwd) grep
+test "$1" "$1" cd cd readonly -eu awk ${HOME}
+'quoted text' ${HOME} /usr/bin test local | export -eu local -eu "$1"
+		'quoted text' | -eu then grep cd 'quoted text'
+		cd | /usr/bin printf --verbose
+	printf -eu then awk "$@" local test awk grep --verbose
+		| | local -eu && 'quoted text' awk done 'quoted text' then
+echo printf local $(pwd) printf $(pwd) 'quoted text'
+readonly 2>/dev/null local $(pwd) 'quoted text' /usr/bin $(pwd)
+-eu grep 'quoted text' x=1 sed printf /usr/bin --verbose "$@" then awk /usr/bin
+		awk printf then && "$@" 'quoted text' && && 2>/dev/null "$@" awk echo --verbose
+		done test 'quoted text' awk printf 'quoted text' echo -eu echo awk ${HOME} 'quoted text'
+		| 'quoted text' ${HOME} ${HOME} done awk -eu &&
+		-eu && then grep done
+		&& printf cd local done "$@"
+-eu ${HOME} done --verbose 'quoted text' 2>/dev/null
+	x=1 "$1" printf test grep x=1
+	$(pwd) sed readonly readonly 'quoted text' awk "$1" printf -eu sed
+		'quoted text' then && -eu awk cd then awk export x=1 'quoted text'
+"$1" test $(pwd) readonly --verbose grep awk 2>/dev/null 2>/dev/null
+	"$1" -eu then --verbose cd "$@" && done done cd done "$1" done
+cd "$@" printf "$1" test "$1" "$@" done
+awk export x=1 echo | awk local | awk then
+echo 'quoted text' | /usr/bin export echo -eu grep | --verbose
+| grep /usr/bin export local && x=1 /usr/bin
+		x=1 readonly x=1 --verbose "$@" 2>/dev/null -eu 'quoted text'
+${HOME} done cd test /usr/bin "$@" sed 'quoted text' printf awk -eu | "$@"
+then --verbose awk readonly -eu then readonly cd then
+local $(pwd) "$@" "$@" printf x=1 sed done grep "$1" readonly "$@" grep
+	x=1 grep export export "$1" "$1" ${HOME}
+done readonly 'quoted text' awk local awk && printf -eu local
+	export 'quoted text' grep grep | 'quoted text' 'quoted text' | "$1" 'quoted text'
+	$(pwd) "$@" && then grep cd 'quoted text' --verbose awk printf cd then printf
+		sed $(pwd) local 2>/dev/null && | done sed 'quoted text'
+		2>/dev/null cd local readonly "$@" 'quoted text' cd | ${HOME}
+echo "$@" printf test local $(pwd) echo readonly local -eu
+		test done --verbose local echo x=1 awk --verbose
+		$(pwd) sed ${HOME} | local then awk 2>/dev/null
+		--verbose test --verbose 2>/dev/null -eu local
+	${HOME} done -eu && $(pwd) local && grep $(pwd)
+		"$@" test echo "$1" $(pwd) then -eu "$@" sed ${HOME} printf
+/usr/bin x=1 --verbose -eu $(pwd) x=1 2>/dev/null
+	2>/dev/null then "$@" awk export -eu ${HOME} $(pwd) grep then | 2>/dev/null
+		--verbose then /usr/bin &&
+	'quoted text' local test --verbose
+		local && "$@" grep x=1 ${HOME} done 2>/dev/null
+		sed -eu ${HOME} 2>/dev/null cd "$@" export ${HOME}
+	export export -eu "$@" "$@" printf
+readonly | grep printf test | export local -eu test ${HOME} readonly
+		test ${HOME} ${HOME} $(pwd) -eu done test readonly cd x=1
+		cd printf test && grep then && echo
+"$1" $(pwd) && then -eu "$@" --verbose | test | /usr/bin cd then
+		"$@" grep $(pwd) export $(pwd) awk then then /usr/bin awk awk $(pwd)
+cd -eu -eu | then sed --verbose local | --verbose -eu "$@" ${HOME} -eu
+		x=1 readonly test ${HOME} "$@" printf 2>/dev/null
+		test then sed -eu done awk cd echo test done
+		x=1 ${HOME} "$@" done "$@" awk $(pwd)
+		"$@" x=1 ${HOME} "$@" local && "$1" then cd local ${HOME} -eu done local printf
+	/usr/bin 2>/dev/null local done cd export then local grep 'quoted text' local
+	"$@" "$1" "$1" /usr/bin readonly x=1
+		then echo then --verbose cd awk export grep awk 2>/dev/null printf
+		2>/dev/null x=1 awk "$1" | && &&
+readonly && export sed test | then | "$1" 'quoted text' ${HOME} 'quoted text'
+		printf "$@" printf export
+		&& "$@" readonly sed | then grep x=1 ${HOME} cd $(pwd) sed
+export awk x=1 /usr/bin cd export $(pwd) /usr/bin
+local test -eu x=1 sed
+		-eu export export test -eu grep
+		printf 'quoted text' grep | cd cd local --verbose
+		2>/dev/null $(pwd) --verbose "$1" "$1"
+	--verbose readonly readonly
+'quoted text' then cd 'quoted text'
+	-eu sed ${HOME} x=1 'quoted text' grep && "$@" "$@" | -eu --verbose
+	$(pwd) --verbose 'quoted text' echo then ${HOME} done /usr/bin export
+	grep cd && -eu 2>/dev/null /usr/bin done $(pwd) sed ${HOME} cd x=1 /usr/bin | 2>/dev/null
+	${HOME} 2>/dev/null --verbose && grep export
+echo done --verbose ${HOME} cd ${HOME} test 'quoted text'
+| x=1 test local 'quoted text' cd x=1 -eu $(pwd) && cd "$@"
+	x=1 -eu $(pwd) then | printf
+	echo 'quoted text' $(pwd) sed test printf done test then awk /usr/bin printf |
+		/usr/bin echo then echo export printf -eu then sed sed -eu printf
+	${HOME} x=1 then | 2>/dev/null local readonly
+	local cd 'quoted text' && awk
+	-eu export 'quoted text' grep sed grep x=1 && "$@" "$@" &&
+		done test /usr/bin export echo && echo readonly awk | grep
+test printf local --verbose test 2>/dev/null "$1" 2>/dev/null /usr/bin "$@" awk
+"$1" -eu ${HOME} done -eu grep test done ${HOME}
+		/usr/bin readonly 2>/dev/null /usr/bin && cd test 'quoted text' local cd printf
+		done && export readonly 2>/dev/null local test test x=1 'quoted text' grep
+	echo awk 2>/dev/null then test -eu 'quoted text' test ${HOME} awk
+| 2>/dev/null then awk printf test local readonly local "$@" test local /usr/bin
+cd awk -eu -eu x=1 2>/dev/null awk sed
+		readonly grep done ${HOME} /usr/bin /usr/bin export cd ${HOME}
+cd export echo "$1" | 2>/dev/null /usr/bin printf export
+done sed local x=1 -eu
+	2>/dev/null && --verbose cd -eu
+		done -eu then | /usr/bin then 'quoted text' awk echo
+	"$@" then 'quoted text' cd
+	cd awk "$@" printf awk local "$1" 2>/dev/null awk -eu done echo grep
+		readonly | local $(pwd) "$@"
+printf export 'quoted text' echo 2>/dev/null
+		sed printf && $(pwd) | sed done 2>/dev/null --verbose
+echo /usr/bin "$1" && /usr/bin && export && local export -eu sed
+		x=1 then printf "$1" && --verbose sed
+		x=1 readonly sed 'quoted text' readonly
+| awk grep /usr/bin awk cd ${HOME} test test /usr/bin export done
+		| "$1" x=1 | "$@" echo $(pwd) /usr/bin /usr/bin
+/usr/bin sed --verbose readonly
+	readonly readonly export $(pwd) 2>/dev/null cd $(pwd) then local awk $(pwd)
+"$1" "$1" -eu /usr/bin printf awk /usr/bin test echo && ${HOME} && && awk --verbose
+-eu ${HOME} export --verbose
+		/usr/bin awk grep awk -eu test $(pwd) -eu "$1" cd "$@"
+		${HOME} -eu 'quoted text' -eu /usr/bin /usr/bin --verbose 2>/dev/null
+	| echo export "$1" echo | cd test
+	cd awk --verbose -eu "$1" export grep "$@" "$1" printf 2>/dev/null
+		then awk /usr/bin "$1" awk done printf test 'quoted text'
+		then x=1 grep local 2>/dev/null
+"$@" then --verbose 2>/dev/null local ${HOME} local readonly grep
+		awk test $(pwd) export
+	local printf sed done 'quoted text' sed readonly
+	awk && echo 'quoted text' 'quoted text'
+		readonly /usr/bin $(pwd) "$@" test printf | grep then cd then echo -eu cd cd
+	| /usr/bin ${HOME} grep awk /usr/bin | export "$@" done "$@" readonly | done
+grep grep /usr/bin then then grep
+		grep && readonly printf $(pwd) && -eu printf ${HOME}
+		'quoted text' $(pwd) sed awk /usr/bin
+'quoted text' grep && -eu test "$@" 2>/dev/null && 2>/dev/null printf
+		2>/dev/null echo awk test cd test -eu && readonly local printf
+		| 2>/dev/null then 2>/dev/null printf 2>/dev/null -eu | "$@" /usr/bin "$@"
+	&& done | -eu cd --verbose -eu "$@"
+		awk ${HOME} | "$1" local && local --verbose awk 2>/dev/null sed readonly
+	cd | "$@" && 2>/dev/null -eu x=1 2>/dev/null
+	sed "$1" x=1 then -eu $(pwd)
+grep --verbose grep ${HOME} then --verbose grep x=1 -eu readonly grep "$@" local
+	| | awk local cd grep $(pwd) then done --verbose
+		done "$@" --verbose --verbose printf /usr/bin ${HOME} x=1 printf 2>/dev/null done
+		test | /usr/bin cd --verbose 2>/dev/null grep
+		'quoted text' awk | -eu printf sed 'quoted text' 'quoted text'
+		done 'quoted text' echo grep readonly "$@" x=1 test ${HOME}
+		cd sed then export export ${HOME} | local ${HOME} sed local
+	test echo 'quoted text' local readonly && sed cd then | local local &&
+done echo sed "$1" | printf printf --verbose --verbose test /usr/bin 2>/dev/null
+then ${HOME} /usr/bin then ${HOME} 2>/dev/null grep cd cd echo
+2>/dev/null export 2>/dev/null
+	x=1 echo echo --verbose /usr/bin
+		-eu grep 2>/dev/null awk "$@" 2>/dev/null grep | done done x=1 | |
+	then "$1" sed -eu cd local | sed grep "$@" test
+	"$@" "$1" --verbose sed 'quoted text'
+	&& test readonly printf printf ${HOME} export
+	local ${HOME} && export echo ${HOME} | /usr/bin 'quoted text' export ${HOME}
+		x=1 local awk x=1 -eu 'quoted text' --verbose -eu
+		--verbose $(pwd) test "$@" printf echo x=1 -eu local -eu then
+awk $(pwd) awk readonly && cd local local grep
+-eu cd "$1" cd sed -eu readonly
+	"$1" done ${HOME} done local export awk $(pwd) local sed | 2>/dev/null
+echo && && then export 'quoted text' test
+	| /usr/bin local echo readonly x=1 | local sed
+--verbose export then readonly local then $(pwd) cd $(pwd)
+	grep printf -eu "$@" "$1" printf then sed grep $(pwd) -eu --verbose done
+readonly | $(pwd) x=1 && test echo cd
+		local cd cd "$1" printf |
+	echo then 'quoted text' sed local 2>/dev/null | 'quoted text' export done grep
+		grep ${HOME} --verbose 2>/dev/null "$@" sed
+local test && grep "$1" done "$@" echo grep echo x=1
+	2>/dev/null -eu local grep
+		--verbose && x=1 test 'quoted text' 'quoted text'
+		--verbose 2>/dev/null ${HOME}
+local sed local /usr/bin then test test done "$@" && echo
+2>/dev/null 2>/dev/null done /usr/bin -eu "$@"
+		grep ${HOME} && test $(pwd) readonly done | cd then
+	echo 2>/dev/null -eu 2>/dev/null export test x=1 "$@" "$1" -eu done echo awk
+	done grep x=1 /usr/bin 2>/dev/null 2>/dev/null ${HOME} -eu
+printf x=1 "$1" $(pwd) readonly
+grep "$@" -eu printf "$1" ${HOME}
+		"$1" grep export "$@" "$1" local done /usr/bin "$@" test ${HOME} $(pwd)
+		cd /usr/bin | 'quoted text' && export test ${HOME}
+		cd /usr/bin x=1 then local --verbose | /usr/bin printf | then
+	'quoted text' && -eu 2>/dev/null | "$@" local /usr/bin ${HOME} -eu cd -eu
+	"$1" test then --verbose grep "$1" printf && awk x=1 printf | echo "$@" 'quoted text'
+		"$1" export && sed -eu 'quoted text'
+test ${HOME} readonly cd readonly test grep export cd export
+	awk awk done local x=1 2>/dev/null
+		done local printf "$1" then sed readonly local | test then ${HOME}
+done readonly $(pwd) awk export sed test 'quoted text'
+awk readonly readonly printf && local "$@" x=1 done "$@"
+	cd "$1" "$1" | export -eu && printf | grep done
+	/usr/bin local $(pwd) && x=1 x=1 sed | x=1 ${HOME}
+		"$@" 2>/dev/null local 2>/dev/null
+	local -eu printf "$@" ${HOME} 'quoted text' "$1" x=1 /usr/bin "$@" "$1" $(pwd)
+		grep /usr/bin 2>/dev/null done
+		| x=1 printf ${HOME} sed x=1 printf export $(pwd) "$@"
+	2>/dev/null sed sed ${HOME} | -eu --verbose readonly local ${HOME}
+cd cd readonly $(pwd) readonly grep 'quoted text' awk --verbose "$@" done printf
+		readonly x=1 ${HOME} cd sed local
+		"$1" then export sed --verbose done done
+'quoted text' readonly printf echo export 2>/dev/null && /usr/bin sed | && grep
+		printf && awk readonly $(pwd) printf readonly 'quoted text' awk grep then sed
+	"$@" "$1" --verbose x=1 2>/dev/null ${HOME} test ${HOME} local done export /usr/bin
+		sed "$@" 'quoted text' ${HOME} 2>/dev/null done 2>/dev/null
+	--verbose awk --verbose export then -eu then | grep /usr/bin 2>/dev/null
+$(pwd) $(pwd) /usr/bin local /usr/bin | x=1 cd ${HOME} export x=1
+x=1 && "$1" /usr/bin cd | cd --verbose done sed local ${HOME} awk sed
+	export test "$@" awk export awk -eu "$@" /usr/bin | "$1" done echo
+test then cd test done
+	export "$1" test grep --verbose test /usr/bin 2>/dev/null
+	"$@" --verbose readonly x=1 $(pwd) grep done test 2>/dev/null test && readonly
+		done local "$1" grep printf
+	done done 2>/dev/null ${HOME} ${HOME} awk "$1" --verbose export export /usr/bin
+test -eu local "$@" grep echo ${HOME} awk then cd done echo local sed "$1" && grep
+	test "$@" done test "$1" | echo readonly export -eu sed 'quoted text' printf
+		--verbose grep /usr/bin -eu done 2>/dev/null test awk done 2>/dev/null export
+		/usr/bin | $(pwd) local ${HOME} cd printf $(pwd) then /usr/bin "$1" &&
+		sed && awk readonly grep && local /usr/bin readonly --verbose printf echo
+&& awk cd readonly readonly
+	'quoted text' | sed test -eu /usr/bin "$@" sed cd cd awk local test cd
+	export $(pwd) "$@" readonly | then ${HOME} printf cd echo | ${HOME} local
+	local x=1 "$@" --verbose --verbose
+		/usr/bin test readonly awk -eu $(pwd) echo
+	then && --verbose 2>/dev/null ${HOME} 'quoted text' ${HOME} readonly printf
+	sed echo 2>/dev/null "$@" local "$@" done ${HOME} $(pwd) sed $(pwd) then
+	echo /usr/bin export readonly
+	echo done then awk echo cd sed echo /usr/bin "$1" sed | "$1" /usr/bin printf
+	readonly ${HOME} --verbose && "$1" 2>/dev/null "$@" readonly grep grep | --verbose
+		grep test printf sed done ${HOME} "$1" $(pwd)
+		cd "$@" printf readonly readonly echo 2>/dev/null sed sed 'quoted text' printf
+$(pwd) done x=1 readonly ${HOME} local printf
+		readonly --verbose -eu then $(pwd) $(pwd) sed $(pwd) grep 'quoted text' -eu then
+local 'quoted text' grep readonly | grep $(pwd) local ${HOME} "$@"
+printf x=1 | cd x=1 readonly grep
+		${HOME} test then | --verbose
+	printf /usr/bin sed then local
+local awk awk 2>/dev/null | export cd
+	test export cd grep echo "$1" local
+		| printf grep echo "$@" grep | "$1" readonly
+		local && /usr/bin 'quoted text' readonly 2>/dev/null readonly
+	x=1 grep test ${HOME} --verbose readonly "$1" done --verbose /usr/bin
+/usr/bin /usr/bin done ${HOME} echo echo --verbose --verbose
+cd 'quoted text' awk "$1" /usr/bin 'quoted text' then readonly local
+		grep x=1 | x=1 | x=1 readonly $(pwd) printf echo echo export then 'quoted text'
+		grep "$@" sed --verbose awk
+	$(pwd) readonly test sed && awk "$@" export local ${HOME}
+		sed export /usr/bin done
+cd "$@" test --verbose "$@" sed --verbose && | awk ${HOME}
+		readonly sed sed grep && done 2>/dev/null |
+		grep && then echo export ${HOME} printf x=1 | local /usr/bin
+readonly printf "$@" 'quoted text'
+		sed 2>/dev/null && $(pwd) done
+		export 'quoted text' local awk readonly "$1" -eu && export cd "$1" sed 'quoted text'
+		then x=1 $(pwd) then 'quoted text' then then sed export | "$1" 'quoted text' "$1"
+		done x=1 && 2>/dev/null | | | | /usr/bin
+		sed cd test "$@" | && /usr/bin 'quoted text' readonly | |
+	local grep -eu "$1" $(pwd) $(pwd) export local echo
+--verbose | export 'quoted text'
+	-eu "$@" $(pwd) 'quoted text' awk x=1 then printf grep
+	2>/dev/null grep $(pwd) | x=1 x=1 /usr/bin 2>/dev/null echo 2>/dev/null done
+		--verbose 2>/dev/null local -eu local x=1 /usr/bin test grep x=1 echo "$1"
+echo 'quoted text' $(pwd) && then awk then | && printf grep awk printf
+sed printf readonly 2>/dev/null ${HOME} sed
+${HOME} grep echo /usr/bin sed cd readonly 'quoted text' test x=1 done "$@" $(pwd)
+		sed printf awk grep && local local 2>/dev/null test local
+	sed grep awk && export then test --verbose "$@"
+done "$1" x=1 "$1" x=1 export printf --verbose awk 2>/dev/null
+	done grep cd ${HOME} 2>/dev/null 2>/dev/null --verbose readonly
+	-eu $(pwd) 'quoted text' 2>/dev/null
+	$(pwd) | 'quoted text' --verbose export sed done
+local 2>/dev/null printf | && cd then | "$@" readonly cd sed awk $(pwd) | /usr/bin
+	echo | cd ${HOME} echo grep done 2>/dev/null $(pwd)
+	-eu sed awk export $(pwd) done test grep x=1 ${HOME}
+	$(pwd) "$@" local -eu 'quoted text' && | 'quoted text'
+then | then then x=1 "$1" readonly && -eu 'quoted text' local printf
+	awk /usr/bin sed 'quoted text'
+		'quoted text' printf test
+		export export ${HOME} printf --verbose cd test -eu grep
+		grep x=1 test cd sed then 2>/dev/null
+"$1" test printf "$@" then --verbose --verbose
+'quoted text' grep && grep
+	awk awk --verbose "$1" -eu done
+awk readonly | cd "$1" 2>/dev/null done
+cd cd local local grep then then test grep then 'quoted text' local x=1 echo | then
+	sed "$1" /usr/bin "$1" "$@" then printf
+		export cd export export --verbose readonly 2>/dev/null |
+	"$@" | x=1 awk echo test readonly local "$@" --verbose
+x=1 'quoted text' "$1"
+cd "$@" && 'quoted text' | echo "$1" x=1 then | --verbose ${HOME} $(pwd) readonly
+then then done awk awk && 2>/dev/null --verbose
+test $(pwd) done "$@" $(pwd) printf local 2>/dev/null
+	test awk ${HOME} local 'quoted text' ${HOME}
+		sed done $(pwd) 2>/dev/null $(pwd) --verbose
+		cd grep ${HOME} grep local awk awk 2>/dev/null export readonly awk 2>/dev/null
+sed awk sed 2>/dev/null ${HOME} test 2>/dev/null
+		| $(pwd) export readonly
+		echo x=1 x=1 $(pwd) printf then cd -eu sed
+&& "$@" test -eu export
+2>/dev/null then ${HOME}
+cd done printf awk sed test --verbose test | && awk grep grep
+	cd "$@" printf -eu local export local /usr/bin grep then
+		awk x=1 --verbose 2>/dev/null
+| test printf printf test | local $(pwd) ${HOME} 2>/dev/null
+export | /usr/bin readonly "$@" grep
+'quoted text' "$@" done $(pwd) awk awk "$1" x=1 cd $(pwd)
+		--verbose printf x=1 done awk ${HOME} awk test done "$1" echo sed done 'quoted text'
+		export printf then x=1 sed then --verbose x=1 $(pwd) &&
+		export done local awk done done 'quoted text'
+	${HOME} ${HOME} export readonly "$@" --verbose 'quoted text' done 2>/dev/null awk
+		readonly printf awk && && sed echo | readonly
+	done readonly x=1 export awk $(pwd) "$1" awk cd ${HOME} | 'quoted text' local
+	sed $(pwd) printf --verbose "$1" done
+		--verbose done export readonly /usr/bin --verbose ${HOME} 2>/dev/null echo export
+	echo && export 2>/dev/null export then then "$@" awk printf
+	grep echo grep test 2>/dev/null
+x=1 local 2>/dev/null $(pwd) "$@" readonly
+	then /usr/bin echo export
+		/usr/bin -eu then && test done "$1" local readonly
+printf $(pwd) x=1 ${HOME} grep | 2>/dev/null --verbose x=1 'quoted text'
+		grep cd | && printf "$@" readonly
+		$(pwd) echo "$1" "$@" $(pwd)
+	grep "$1" /usr/bin -eu $(pwd)
+		x=1 $(pwd) sed ${HOME} printf
+	awk 'quoted text' echo cd "$@" "$@" --verbose "$1" echo --verbose "$@" done readonly
+	| sed "$@" echo awk grep test "$@"
+	readonly 'quoted text' "$1" ${HOME} --verbose grep readonly && echo grep 2>/dev/null
+	readonly | $(pwd) -eu awk grep printf then | "$1"
+	| cd /usr/bin && | readonly "$1" echo "$1" "$@"
+	-eu echo /usr/bin cd printf awk
+awk readonly "$1" readonly local done awk 2>/dev/null
+	--verbose $(pwd) "$@" local x=1 -eu $(pwd) cd "$1" "$1" --verbose /usr/bin
+	done | export readonly && "$1" local x=1 done ${HOME}
+then printf export readonly done /usr/bin test $(pwd) done printf x=1 -eu ${HOME}
+	export | /usr/bin 'quoted text'
+	printf && cd export $(pwd)
+	local grep ${HOME} export then -eu -eu done && then done $(pwd) test --verbose
+	"$@" awk ${HOME} /usr/bin && 2>/dev/null
+		sed ${HOME} --verbose && sed then | then done cd export grep /usr/bin
+	/usr/bin test -eu grep && awk | done | test | "$1" --verbose
+		grep /usr/bin readonly readonly 'quoted text' "$1"
+		"$@" export echo 'quoted text'
+	grep readonly done readonly x=1 then local
+		$(pwd) | readonly then
+$(pwd) export x=1 && echo 2>/dev/null sed /usr/bin -eu echo "$@" x=1 then
+		&& $(pwd) 2>/dev/null test printf local
+	x=1 x=1 then ${HOME} export
+		"$1" | 'quoted text' export cd test test --verbose awk printf
+x=1 grep --verbose sed test sed && sed 'quoted text' x=1 then cd echo | grep
+local 'quoted text' $(pwd) test
+		test -eu -eu "$@" --verbose "$1" sed sed | $(pwd) grep "$1" then x=1 sed
+		done x=1 /usr/bin echo printf && export test sed && sed grep sed done local local
+		export awk readonly x=1 'quoted text' 2>/dev/null && --verbose test
+	--verbose -eu grep readonly printf "$1" printf echo grep && && grep "$@" sed &&
+		awk | printf | /usr/bin | cd
+	'quoted text' done then $(pwd) "$1" awk -eu test local | readonly /usr/bin
+	done 2>/dev/null sed cd printf x=1 readonly grep 'quoted text'
+		&& | "$@" grep grep echo sed then --verbose test echo done
+	-eu && test ${HOME} cd 'quoted text' readonly $(pwd) x=1 local then grep --verbose
+readonly && awk -eu awk test cd 'quoted text' echo printf $(pwd) -eu
+	$(pwd) 'quoted text' cd cd 2>/dev/null
+/usr/bin echo $(pwd) | grep grep done awk done
+		local | grep x=1 test sed 'quoted text'
+local awk export awk readonly 'quoted text' echo
+	echo && sed "$1" local 2>/dev/null
+test readonly sed echo 'quoted text'
+	'quoted text' && 'quoted text' "$1" $(pwd) then -eu &&
+	awk then 2>/dev/null "$1" grep done
+	printf export ${HOME} "$@" 2>/dev/null
+		/usr/bin sed $(pwd) 2>/dev/null sed 2>/dev/null printf
+sed local grep then $(pwd) awk | --verbose && echo echo sed
+	then awk awk | "$1" -eu
+readonly echo printf | printf --verbose
+		/usr/bin ${HOME} test x=1 export | test $(pwd) test
+	printf echo grep --verbose readonly grep local && $(pwd) 'quoted text' /usr/bin
+	awk cd readonly cd "$@" test /usr/bin
+"$@" export test cd 2>/dev/null
+grep then --verbose x=1 export readonly 2>/dev/null --verbose
+done then printf && cd ${HOME} printf then printf
+	export "$1" x=1 test 2>/dev/null sed ${HOME} ${HOME} export printf
+		$(pwd) readonly grep local 'quoted text' awk test
+"$1" /usr/bin $(pwd) cd grep 2>/dev/null --verbose
+	grep 2>/dev/null then "$@" "$1" local test test "$@"
+readonly "$1" awk awk $(pwd) && ${HOME} $(pwd) export /usr/bin done then
+	test awk --verbose printf /usr/bin
+--verbose | ${HOME} then
+		cd -eu sed | grep && local export | 2>/dev/null |
+	| 2>/dev/null $(pwd) x=1 awk | $(pwd) grep --verbose
+"$1" && cd 2>/dev/null awk /usr/bin echo printf
+	test readonly then echo sed x=1 /usr/bin
+	| 'quoted text' then awk | done -eu local --verbose export echo awk |
+done test test done && && "$@" ${HOME} 'quoted text' cd "$@"
+"$1" echo 'quoted text' "$@" awk test x=1 'quoted text'
+		test && "$@" local done | 'quoted text' grep
+/usr/bin --verbose grep ${HOME}
+	export 2>/dev/null echo x=1
+	$(pwd) then $(pwd) done then $(pwd) $(pwd) printf 'quoted text'
+		sed export "$1" "$@" awk test sed local $(pwd) test echo
+		/usr/bin "$1" done echo cd | then sed readonly
+'quoted text' "$@" then $(pwd) x=1 test $(pwd) test "$1" local x=1 test -eu 2>/dev/null
+| $(pwd) "$@" 2>/dev/null local 'quoted text'
+	-eu --verbose printf -eu --verbose
+	export echo -eu sed 'quoted text' test
+		| done | echo echo $(pwd) done done $(pwd) then "$1" | "$1" local local
+	cd export local local sed 'quoted text' echo sed | awk
+	printf export -eu echo local sed export local local printf --verbose
+	export done $(pwd) readonly
+$(pwd) done done local 'quoted text' 'quoted text' "$@" awk then test done
+		sed "$1" 'quoted text' printf test test | && 2>/dev/null
+export test "$1" test then x=1 --verbose local done $(pwd) ${HOME} "$1" "$1" | readonly
+		-eu "$@" | ${HOME} done awk -eu
+	export /usr/bin cd test -eu x=1 2>/dev/null sed -eu $(pwd) awk | /usr/bin "$@"
+cd sed "$1" grep ${HOME} echo export
+		sed local awk "$1" | $(pwd) done ${HOME}
+	echo then --verbose "$@" readonly
+	printf -eu ${HOME} -eu x=1 awk && "$@" done printf
+	--verbose /usr/bin awk "$1" && "$@" ${HOME} 'quoted text' --verbose "$@" sed
+	"$1" test | 2>/dev/null /usr/bin | echo -eu "$1" x=1 test test $(pwd)
+		echo -eu local --verbose export echo 'quoted text' export $(pwd) && ${HOME} 2>/dev/null
+		grep export ${HOME} "$@"
+/usr/bin echo sed "$1" test -eu printf ${HOME} 'quoted text' echo cd then 'quoted text'
+		'quoted text' && printf 'quoted text' ${HOME} --verbose then awk test ${HOME} x=1
+	sed $(pwd) awk done sed done local "$1" then /usr/bin
+cd --verbose /usr/bin ${HOME} --verbose grep grep
+		$(pwd) export test "$@" --verbose sed test | sed local sed cd "$1"
+	echo export sed printf /usr/bin local
+		readonly 'quoted text' 2>/dev/null
+	-eu --verbose sed | -eu test x=1 echo 2>/dev/null test done cd && printf
+		export sed 'quoted text'
+	"$1" -eu $(pwd) $(pwd) /usr/bin
+		test awk export sed printf 'quoted text' awk then x=1 grep readonly echo
+	echo then ${HOME} /usr/bin
+"$@" x=1 -eu readonly cd local echo cd | $(pwd)
+		| then done then | echo readonly done ${HOME} then "$@" && test "$@"
+	test then x=1 --verbose export
+	x=1 x=1 then done printf test ${HOME} "$@" ${HOME} 'quoted text' 'quoted text' &&
+	| 2>/dev/null | then
+&& $(pwd) printf test echo
+--verbose x=1 readonly x=1 2>/dev/null
+	grep local --verbose |
+		export ${HOME} "$@" "$1" 2>/dev/null -eu /usr/bin then --verbose done printf cd
+		printf sed cd then 'quoted text' "$1" $(pwd) -eu ${HOME} ${HOME} test 2>/dev/null
+		&& 'quoted text' -eu echo grep --verbose
+		readonly | then && export printf done printf $(pwd) ${HOME}
+	then echo export then "$1" -eu sed "$1" "$1" sed awk | local printf sed
+		echo local 2>/dev/null 'quoted text' echo then "$@" /usr/bin
+"$@" grep local x=1 2>/dev/null echo export
+	cd awk -eu readonly grep && readonly && printf cd
+	| /usr/bin 2>/dev/null done -eu export && | | --verbose
+	then grep export $(pwd) /usr/bin sed readonly cd readonly local x=1 cd
+		readonly sed test "$@" "$1" readonly
+		--verbose test "$1" ${HOME} x=1 then --verbose ${HOME} sed --verbose
+	--verbose awk sed "$@" grep ${HOME} 'quoted text' "$1" sed
+echo 2>/dev/null export x=1 sed test /usr/bin readonly printf "$@" sed
+		--verbose "$1" sed done export /usr/bin local | sed awk printf
+		2>/dev/null 2>/dev/null 2>/dev/null export local grep 'quoted text'
+	cd "$1" ${HOME} -eu export local printf printf
+		then sed $(pwd) cd $(pwd) --verbose awk "$@" sed | x=1 sed test
+		${HOME} echo /usr/bin /usr/bin
+	&& -eu 2>/dev/null readonly grep -eu
+2>/dev/null x=1 echo then readonly echo test
+		${HOME} /usr/bin | echo cd then awk export && $(pwd) awk local "$@" echo echo cd
+		2>/dev/null && --verbose 'quoted text' "$@" test export
+readonly ${HOME} then grep then readonly
+		awk -eu && awk echo cd echo --verbose | sed cd x=1 && --verbose
+	"$@" export local /usr/bin printf x=1 readonly sed $(pwd) test
+--verbose sed awk then 2>/dev/null awk $(pwd)
+export $(pwd) sed | /usr/bin awk test --verbose printf export
+'quoted text' export cd echo then test echo sed echo test echo
+	$(pwd) echo x=1 done ${HOME} $(pwd) && sed /usr/bin ${HOME}
+		done | awk x=1 cd && cd "$@" local --verbose "$@" --verbose export test
+		| echo "$@" "$@" local echo printf
+	sed done "$@" | x=1 x=1 cd -eu "$@" then cd readonly
+		| "$1" then && sed && local | "$@" "$@" | $(pwd) awk awk sed x=1 grep x=1
+		| 2>/dev/null --verbose "$@" | grep local readonly $(pwd) "$@" local --verbose $(pwd)
+${HOME} $(pwd) | readonly done 2>/dev/null
+awk grep | | /usr/bin done
+	export "$@" 'quoted text' cd ${HOME}
+x=1 echo -eu "$1" "$@" cd
+		"$@" $(pwd) readonly "$@" echo test $(pwd) -eu "$@"
+$(pwd) 2>/dev/null local
+		--verbose "$@" /usr/bin | local "$@" ${HOME} -eu printf -eu --verbose
+		'quoted text' --verbose | grep printf local /usr/bin printf readonly
+then then "$@" $(pwd) done | grep export readonly
+		'quoted text' "$1" | && "$1"
+		"$1" export cd export printf
+	2>/dev/null ${HOME} "$1" echo /usr/bin done "$1" 2>/dev/null | export
+		-eu printf ${HOME} "$1" && awk | 2>/dev/null printf "$@" 'quoted text'
+	| -eu "$@" 2>/dev/null done x=1 ${HOME}
+sed test readonly --verbose grep $(pwd)
+		"$@" 'quoted text' --verbose && "$@"
+		"$@" 'quoted text' grep | cd ${HOME} "$@" printf 'quoted text'
+local --verbose $(pwd) export
+	cd grep -eu && -eu 'quoted text' "$1" echo "$1" $(pwd) $(pwd)
+		readonly test "$1" readonly ${HOME} 2>/dev/null ${HOME}
+done test test grep "$1" done
+		--verbose | ${HOME} then done sed grep x=1 /usr/bin readonly echo $(pwd) /usr/bin
+	grep -eu test awk 'quoted text'
+	| echo x=1 | "$1" ${HOME} "$1" printf
+	export 2>/dev/null echo grep grep ${HOME} then done ${HOME}
+		export echo -eu done $(pwd) done 2>/dev/null sed printf test test
+	then awk test 'quoted text' -eu cd 2>/dev/null cd 'quoted text'
+		2>/dev/null printf local | "$1" printf
+		cd export -eu test | sed echo &&
+		then then | done "$@"
+readonly awk sed ${HOME} /usr/bin 'quoted text'
+		awk | awk printf echo test printf
+"$1" && local awk "$@"
+awk "$1" "$@" then $(pwd) x=1 cd /usr/bin readonly 'quoted text' test awk 2>/dev/null
+		test "$@" local grep 'quoted text'
+		-eu test | x=1 -eu sed &&
+/usr/bin then awk "$1" | awk echo --verbose /usr/bin
+	"$@" awk --verbose $(pwd) | echo 'quoted text'
+	--verbose | -eu cd grep then readonly
+		/usr/bin cd export x=1 readonly printf | cd 2>/dev/null "$1" export sed test
+x=1 /usr/bin | 2>/dev/null test | grep x=1 awk grep sed readonly 2>/dev/null
+	&& $(pwd) grep ${HOME} readonly $(pwd) awk 'quoted text'
+		${HOME} 'quoted text' readonly && --verbose /usr/bin /usr/bin done
+	awk readonly -eu | $(pwd) readonly /usr/bin
+local /usr/bin cd x=1 "$@" "$@" export
+		| --verbose /usr/bin "$@" x=1 export grep | 'quoted text' done /usr/bin test
+	-eu && 2>/dev/null && x=1 "$1" ${HOME}
+	test then ${HOME} -eu sed 'quoted text' | 'quoted text' ${HOME} test
+		"$1" 2>/dev/null ${HOME} "$@" 'quoted text'
+x=1 sed && done cd test test x=1 && && "$@" 'quoted text'
+&& 2>/dev/null x=1 --verbose /usr/bin echo
+	$(pwd) x=1 local awk | -eu then echo
+export && export sed cd done echo "$@" --verbose test 2>/dev/null --verbose |
+	echo 2>/dev/null echo export | "$@" awk /usr/bin -eu && -eu awk |
+		"$1" readonly awk sed 2>/dev/null 'quoted text' awk grep then 2>/dev/null
+	2>/dev/null --verbose then
+	"$1" -eu then 2>/dev/null grep
+		test /usr/bin ${HOME} --verbose sed ${HOME} && awk
+then $(pwd) x=1 done -eu printf --verbose "$1" "$@" &&
+		-eu then -eu ${HOME} /usr/bin sed local | echo | cd grep
+printf local 2>/dev/null awk
+&& $(pwd) export "$1" "$@" cd cd 'quoted text' grep done -eu then readonly
+--verbose done $(pwd) $(pwd) readonly echo x=1 'quoted text' /usr/bin -eu then
+x=1 --verbose readonly then
+${HOME} 2>/dev/null sed export local 'quoted text' awk echo cd
+	'quoted text' printf /usr/bin printf -eu test echo --verbose then cd /usr/bin
+then $(pwd) grep "$1" "$@" && && cd local cd "$@" 'quoted text' 'quoted text'
+	printf cd echo && | sed "$1"
+		awk "$@" 'quoted text' --verbose local
+	'quoted text' grep printf grep readonly test x=1
+then -eu grep echo "$1" 'quoted text' 'quoted text' awk cd then
+		cd "$1" awk x=1 then 'quoted text' /usr/bin ${HOME}
+"$@" printf export echo sed $(pwd) test
+&& /usr/bin --verbose "$@"
+		${HOME} grep done ${HOME} sed
+x=1 cd --verbose cd ${HOME} "$1" grep x=1 ${HOME}
+		'quoted text' -eu echo --verbose --verbose 'quoted text' sed && export awk grep
+		| grep awk echo test export awk && cd awk done awk 'quoted text' then
+	x=1 export then export "$1" sed x=1 cd 'quoted text' readonly
+--verbose export "$@" readonly
+test local printf "$@" 2>/dev/null "$1" awk done 2>/dev/null
+	readonly ${HOME} "$@" sed 'quoted text' --verbose
+	sed local ${HOME} | 2>/dev/null
+"$1" export local grep done printf test "$@" /usr/bin
+export ${HOME} -eu echo local
+		done x=1 --verbose "$@" "$@" local readonly cd | printf
+--verbose --verbose printf "$1" 2>/dev/null 2>/dev/null
+	then printf --verbose $(pwd) /usr/bin awk sed -eu
+		test -eu | /usr/bin done
+| && echo export export && 2>/dev/null 2>/dev/null cd printf awk readonly
+	printf x=1 grep echo grep /usr/bin cd then echo 2>/dev/null echo 2>/dev/null
+grep sed "$@" done $(pwd) $(pwd)
+	--verbose 2>/dev/null | printf "$1" printf
+		${HOME} 'quoted text' printf
+		local --verbose export $(pwd) 2>/dev/null echo 2>/dev/null sed $(pwd) done x=1 2>/dev/null
+test ${HOME} grep then echo "$@" echo test 2>/dev/null
+		local | && local 'quoted text' then readonly 2>/dev/null && local
+		cd export readonly readonly -eu x=1 test
+		done export grep 2>/dev/null then ${HOME} 'quoted text'
+		2>/dev/null readonly --verbose -eu local
+	done export awk $(pwd) grep "$1" | /usr/bin
+${HOME} /usr/bin && local "$@" then | && readonly $(pwd) "$1" local
+export cd 2>/dev/null export --verbose export export -eu
+	-eu sed 'quoted text' -eu export /usr/bin export readonly
+		"$@" | local 'quoted text' 'quoted text'
+	--verbose /usr/bin then | done 'quoted text' printf 'quoted text' 2>/dev/null
+&& export sed $(pwd) 'quoted text' "$1" echo $(pwd) then
+&& $(pwd) grep --verbose
+		&& /usr/bin printf | awk 'quoted text' | cd awk /usr/bin
+done -eu sed --verbose export ${HOME} done "$1" | export test
+&& then local "$1" sed printf then done test -eu && grep ${HOME}
+--verbose readonly -eu 2>/dev/null ${HOME} local then grep awk printf
+		then export awk done "$@" cd x=1 /usr/bin grep
+		done && -eu awk 2>/dev/null x=1 local "$1" /usr/bin "$1" x=1 cd done "$1" done ${HOME}
+	2>/dev/null export "$@" local echo awk awk ${HOME} then export 2>/dev/null
+		--verbose grep done grep | 'quoted text' x=1 test "$@" /usr/bin
+export readonly 2>/dev/null 'quoted text' && $(pwd) grep
+awk printf readonly awk awk then test test echo
+	local readonly local done x=1 grep && 'quoted text' export
+		sed export local cd /usr/bin readonly grep export /usr/bin then awk
+	x=1 | printf $(pwd) "$1" 2>/dev/null then $(pwd) 'quoted text' "$@" local
+		| echo 'quoted text' awk "$1" 'quoted text' $(pwd) && $(pwd) "$@" echo export
+		2>/dev/null | | 2>/dev/null
+		'quoted text' -eu $(pwd) "$@" awk printf -eu
+	awk test test export readonly "$@" local grep -eu local local cd
+&& x=1 sed printf grep --verbose
+		printf awk --verbose 'quoted text' | sed grep local
+-eu readonly $(pwd) then ${HOME} test
+-eu | | readonly x=1 "$1" "$1"
+done cd local awk | "$1" done sed --verbose readonly $(pwd) 'quoted text'
+$(pwd) -eu x=1 x=1 -eu "$@" echo | sed done echo local ${HOME} sed then ${HOME}
+		x=1 printf cd | --verbose local test -eu 'quoted text'
+	readonly readonly /usr/bin local 2>/dev/null $(pwd)
+2>/dev/null --verbose && local 2>/dev/null
+		local 'quoted text' "$1" grep cd "$1" "$1" --verbose "$@" grep printf --verbose
+		local printf local --verbose grep $(pwd) readonly
+	$(pwd) 'quoted text' && | printf sed awk grep echo ${HOME} then ${HOME} | 2>/dev/null
+		sed sed && | "$@" awk cd | cd readonly 2>/dev/null $(pwd)
+		-eu "$1" printf then readonly $(pwd) echo 2>/dev/null
+| 'quoted text' -eu "$1" /usr/bin
+--verbose local ${HOME} && x=1 /usr/bin 'quoted text'
+	"$1" | "$1" "$@" && cd done echo awk | | export x=1 --verbose ${HOME} then then
+2>/dev/null /usr/bin 'quoted text' export 2>/dev/null 2>/dev/null &&
+		| echo -eu done local 2>/dev/null printf 2>/dev/null ${HOME} 2>/dev/null
+	'quoted text' done && sed done ${HOME}
+${HOME} 2>/dev/null "$@" then
+x=1 'quoted text' -eu printf "$1" /usr/bin
+		| $(pwd) then test export "$1" | sed sed x=1 done "$@" echo ${HOME} done
+	printf $(pwd) /usr/bin
+"$1" export 2>/dev/null -eu
+${HOME} "$1" grep export then 'quoted text'
+-eu 'quoted text' | printf
+	local readonly export $(pwd)
+	-eu "$@" sed x=1 "$@" test then printf -eu
+readonly printf printf done local printf local echo && | awk printf readonly
+		/usr/bin x=1 test "$@" ${HOME} -eu cd printf ${HOME}
+		/usr/bin readonly -eu --verbose
+	$(pwd) x=1 awk /usr/bin echo x=1 grep printf then x=1 printf "$@" /usr/bin &&
+done ${HOME} printf | ${HOME} readonly $(pwd) --verbose /usr/bin
+		export grep ${HOME} -eu --verbose export -eu && sed x=1 | | "$1" export then
+"$1" export export cd 'quoted text'
+	readonly "$@" 2>/dev/null local awk "$@" $(pwd) ${HOME}
+		done awk printf 'quoted text' 2>/dev/null echo grep sed
+	sed --verbose test readonly ${HOME} then printf &&
+		grep test export ${HOME} $(pwd) --verbose then "$1"
+		"$1" export | test $(pwd)
+		test ${HOME} -eu x=1 2>/dev/null
+	"$@" -eu /usr/bin grep --verbose 'quoted text'
+		awk done --verbose test readonly printf 2>/dev/null
+		--verbose then x=1 -eu "$1" test test && ${HOME} sed "$1" awk
+"$1" | 2>/dev/null cd ${HOME} ${HOME} cd "$@" | ${HOME}
+	awk grep 'quoted text' | readonly x=1 $(pwd) cd ${HOME} x=1 | 2>/dev/null
+		printf 2>/dev/null --verbose
+		then x=1 test "$@" grep x=1 | -eu -eu $(pwd) export
+grep then 'quoted text' grep local 'quoted text' local "$@"
+		local done ${HOME} 2>/dev/null
+		/usr/bin cd echo 2>/dev/null local cd x=1 grep done "$1"
+	/usr/bin x=1 local 'quoted text'
+		x=1 -eu --verbose x=1 2>/dev/null 'quoted text' $(pwd) $(pwd) done "$1" 'quoted text'
+		--verbose local sed awk -eu && local done && readonly export cd local
+	"$1" then readonly 2>/dev/null test | && /usr/bin /usr/bin
+$(pwd) $(pwd) "$1" readonly readonly done | printf x=1 | 2>/dev/null
+		$(pwd) ${HOME} export --verbose then
+printf echo sed "$1"
+awk grep awk && local echo
+done sed 'quoted text' 2>/dev/null grep
+		echo x=1 && readonly | --verbose "$1"
+	x=1 cd printf $(pwd) grep 'quoted text' export awk ${HOME}
+		then /usr/bin echo -eu local readonly "$1" local readonly 'quoted text'
+	--verbose $(pwd) local 'quoted text' readonly
+		printf export sed sed --verbose awk 2>/dev/null
+		local local readonly awk ${HOME} export 'quoted text'
+local done printf 2>/dev/null
+readonly -eu "$@" test "$@" $(pwd) readonly
+printf test "$@" 2>/dev/null awk test awk done
+then $(pwd) "$@" readonly printf --verbose test $(pwd) export echo sed cd echo
+		export sed "$@" local $(pwd) 'quoted text' then readonly |
+test cd grep then awk --verbose /usr/bin && readonly -eu | $(pwd)
+--verbose --verbose 'quoted text'
+	printf done "$@" /usr/bin -eu "$@" 2>/dev/null readonly 'quoted text' test
+	"$@" cd --verbose && export awk done x=1 cd --verbose readonly echo $(pwd) |
+	"$1" $(pwd) grep /usr/bin /usr/bin
+		grep "$@" -eu ${HOME} echo awk done local grep x=1 "$1" awk done readonly
+"$1" cd --verbose $(pwd) awk readonly local x=1 printf 'quoted text'
+		"$1" readonly cd x=1 && echo |
+	$(pwd) /usr/bin x=1 'quoted text' 'quoted text'
+${HOME} test export printf printf
+		printf "$@" 'quoted text' $(pwd) test
+x=1 --verbose awk "$@" export done sed /usr/bin /usr/bin
+		sed done printf done local sed -eu awk then
+	"$1" 'quoted text' --verbose cd done printf
+	test local x=1 sed "$@"
+	then "$@" grep echo echo local readonly done test export
+		local test x=1 local cd export
+		local "$1" done /usr/bin "$@" 2>/dev/null $(pwd) readonly 'quoted text'
+		done "$1" cd export && cd done readonly 2>/dev/null
+"$1" readonly test done "$@" /usr/bin 2>/dev/null
+"$1" && export sed export
+	then --verbose awk x=1 | "$1" ${HOME} then $(pwd)
+done && cd -eu local "$@" local /usr/bin x=1
+		readonly sed printf printf && | grep echo | "$1" -eu printf x=1 "$1" cd $(pwd)
+test && echo /usr/bin -eu /usr/bin
+${HOME} -eu "$1" grep "$1" printf cd sed then echo test $(pwd) sed &&
+	done test -eu --verbose test 2>/dev/null x=1 /usr/bin echo
+		${HOME} --verbose awk x=1 printf && awk "$@" /usr/bin readonly test grep
+	2>/dev/null 2>/dev/null | done awk /usr/bin --verbose printf test
+cd -eu done 2>/dev/null grep
+		&& 2>/dev/null awk grep export -eu local
+		echo | "$1" --verbose 2>/dev/null test grep |
+local | printf printf echo $(pwd) -eu local 'quoted text' x=1 echo
+		--verbose cd -eu awk | && grep done echo printf
+awk 'quoted text' "$1" export readonly
+	"$@" ${HOME} x=1 grep test awk && 2>/dev/null
+		sed printf cd ${HOME}
+	then 2>/dev/null export && 2>/dev/null
+local "$@" grep grep "$1" && 2>/dev/null -eu awk then
+		"$@" export $(pwd) 2>/dev/null "$1" --verbose /usr/bin
+'quoted text' 'quoted text' 2>/dev/null "$@" | ${HOME} ${HOME}
+	| 'quoted text' --verbose awk test /usr/bin grep cd export grep && printf
+	${HOME} x=1 cd grep then printf /usr/bin
+"$1" -eu -eu ${HOME} echo test ${HOME} "$1" --verbose
+		--verbose awk $(pwd) grep cd export echo done test $(pwd) && done $(pwd)
+		sed local ${HOME} 'quoted text' && test local ${HOME} 2>/dev/null
+		sed 2>/dev/null then export echo readonly && printf x=1 --verbose
+	local local 2>/dev/null $(pwd) awk test local 'quoted text'
+		test /usr/bin printf grep
+		cd export | local "$1" export test "$@" "$@" export sed echo ${HOME} then x=1
+echo echo $(pwd) awk done 'quoted text' ${HOME} --verbose
+local echo -eu x=1 awk printf
+		sed x=1 export 2>/dev/null "$1" 'quoted text' then awk test export local then
+		"$1" cd local 2>/dev/null -eu --verbose x=1 ${HOME} printf
+	cd ${HOME} "$@" /usr/bin 2>/dev/null -eu
+		$(pwd) test x=1 printf sed ${HOME} && echo printf printf | 2>/dev/null then then
+	$(pwd) cd echo -eu grep /usr/bin then x=1 "$@" export --verbose "$1"
+	2>/dev/null grep echo 'quoted text' printf
+	2>/dev/null | | sed then export
+done -eu done echo awk "$@" 2>/dev/null
+		--verbose --verbose local x=1
+-eu 2>/dev/null readonly | -eu done grep printf
+local readonly "$@" ${HOME} ${HOME} test "$@" 2>/dev/null
+export 2>/dev/null && --verbose cd 2>/dev/null -eu sed
+printf -eu $(pwd) export "$1" echo /usr/bin
+x=1 printf /usr/bin test readonly awk | test printf x=1 then
+${HOME} 2>/dev/null | sed | ${HOME} /usr/bin --verbose
+-eu $(pwd) echo -eu local
+sed && 2>/dev/null /usr/bin awk local
+--verbose test | ${HOME} ${HOME} test grep export x=1 cd ${HOME}
+		"$1" "$@" test printf "$@" /usr/bin
+		${HOME} local /usr/bin local /usr/bin then
+		local echo && readonly echo export done ${HOME} local --verbose done /usr/bin
+echo grep | printf "$1" "$1" --verbose /usr/bin local $(pwd) x=1
+		grep 'quoted text' grep | cd "$1" export -eu && awk 'quoted text'
+"$@" export "$1" export "$1" "$1" x=1 done local ${HOME} | && $(pwd) ${HOME}
+| ${HOME} printf $(pwd) then sed local "$1" --verbose --verbose
+		--verbose "$@" cd /usr/bin
+	"$1" $(pwd) echo ${HOME} | sed -eu test /usr/bin | /usr/bin
+export 'quoted text' then "$@" x=1 'quoted text' --verbose
+readonly local local && echo | grep 2>/dev/null
+'quoted text' awk test "$1" --verbose then
+		${HOME} then test test done
+	"$@" 'quoted text' test
+		sed sed x=1 grep test "$@" cd -eu x=1 readonly
+	--verbose grep ${HOME} -eu awk ${HOME} 'quoted text' printf test
+	echo test done export grep sed done
+		"$@" "$1" export printf done then 2>/dev/null
+	'quoted text' cd 'quoted text'
+	cd ${HOME} export 'quoted text' $(pwd) 2>/dev/null
+printf "$@" done readonly /usr/bin -eu "$@" cd export 'quoted text'
+		cd cd /usr/bin cd | && sed local grep ${HOME} /usr/bin "$1" local $(pwd)
+		&& "$@" local done printf echo echo $(pwd) && sed 'quoted text'
+		${HOME} cd cd "$1" sed 2>/dev/null ${HOME}
+		echo | cd echo done test -eu |
+printf --verbose /usr/bin
+		export local grep sed ${HOME} export
+		| readonly then 'quoted text'
+		/usr/bin readonly local sed done -eu 'quoted text'
+	done done printf "$@" awk x=1 && local &&
+/usr/bin readonly echo local
+		"$@" "$@" printf echo 'quoted text' 'quoted text' printf --verbose then
+		printf && --verbose then ${HOME} $(pwd) $(pwd) done
+	${HOME} then /usr/bin cd
+		local "$@" export "$1"
+		cd cd sed --verbose test x=1 $(pwd) echo --verbose 2>/dev/null export echo $(pwd)
+awk local "$1" local test readonly && 'quoted text' test
+	sed "$1" | | -eu local --verbose 'quoted text' cd --verbose "$@" 'quoted text'
+grep && /usr/bin printf $(pwd) then | $(pwd) export "$@" x=1 readonly
+		awk done 'quoted text' ${HOME}
+	--verbose printf --verbose cd test local --verbose 'quoted text'
+&& "$@" "$1" /usr/bin -eu "$@" "$1" export | --verbose
+		| "$@" sed $(pwd) sed --verbose test $(pwd) done done sed -eu test done
+export 2>/dev/null --verbose test 2>/dev/null x=1 awk
+export cd readonly ${HOME} printf 'quoted text'
+	&& echo cd "$@" cd printf && readonly test export
+	| cd 2>/dev/null echo grep
+		test 2>/dev/null then /usr/bin printf && /usr/bin local 'quoted text' awk readonly
+echo && grep sed done local && 2>/dev/null export local awk
+&& /usr/bin | ${HOME} then test done then
+		grep local cd readonly test
+		'quoted text' x=1 sed local
+		echo sed x=1 | test x=1 echo "$@" x=1 $(pwd) sed done "$@" cd echo cd x=1 then |
+sed x=1 readonly grep && cd $(pwd) sed export test echo awk local
+local | sed | | test 2>/dev/null cd cd $(pwd) x=1 "$1" done -eu && export 'quoted text'
+--verbose x=1 "$1" test printf sed 2>/dev/null
+local ${HOME} $(pwd) test x=1
+		"$1" && --verbose /usr/bin /usr/bin awk local sed grep -eu grep sed $(pwd) && sed
+		cd sed printf ${HOME} export echo local && 2>/dev/null
+	2>/dev/null printf readonly
+	grep "$1" awk | --verbose "$1" ${HOME} && sed x=1 grep "$1" awk sed done
+		awk "$1" "$1" ${HOME} echo readonly sed /usr/bin grep 2>/dev/null
+		echo readonly -eu 2>/dev/null --verbose 'quoted text' readonly
+		2>/dev/null readonly sed export ${HOME}
+		export printf "$@" test readonly --verbose $(pwd) then /usr/bin --verbose $(pwd)
+sed grep --verbose /usr/bin then awk $(pwd) local done -eu awk /usr/bin "$1" readonly
+"$@" | sed && | awk test readonly
+		$(pwd) 'quoted text' awk $(pwd)
+		printf -eu printf done --verbose
+		$(pwd) local readonly then "$@" -eu printf 'quoted text' -eu
+		awk export then local x=1 export done x=1 2>/dev/null
+	x=1 awk echo test | grep ${HOME} echo then && grep $(pwd) test echo
+2>/dev/null echo export export sed local test |
+	"$@" 'quoted text' test awk -eu -eu && -eu ${HOME} 2>/dev/null 2>/dev/null
+${HOME} --verbose local
+local cd ${HOME} grep export done --verbose readonly awk cd "$1" cd export 'quoted text'
+printf --verbose done done echo then | test -eu
+		${HOME} "$@" awk | --verbose local /usr/bin done grep
+then export /usr/bin grep grep |
+		test 'quoted text' && echo
+		sed "$@" | test export grep 'quoted text' /usr/bin $(pwd) done
+		| test ${HOME} --verbose x=1
+sed awk local && awk $(pwd) sed test x=1 "$1"
+	sed x=1 echo readonly 2>/dev/null export --verbose
+	"$@" sed x=1 export -eu 2>/dev/null
+	local /usr/bin done awk readonly
+		"$1" awk ${HOME} readonly /usr/bin local /usr/bin awk 2>/dev/null sed | test
+		readonly printf --verbose | ${HOME}
+	2>/dev/null cd 2>/dev/null sed
+		'quoted text' awk --verbose grep
+		--verbose echo grep grep test done printf echo --verbose
+		$(pwd) 2>/dev/null 2>/dev/null grep
+	cd 'quoted text' done export $(pwd)
+		export $(pwd) grep -eu -eu test local
+		local printf readonly then |
+	x=1 ${HOME} grep export /usr/bin x=1 -eu done then cd cd ${HOME} then | -eu
+		--verbose --verbose echo cd readonly
+test "$1" | cd && then then awk -eu cd | "$1" awk "$1"
+readonly cd sed echo ${HOME} done test echo awk x=1 export sed /usr/bin &&
+| done awk /usr/bin grep sed /usr/bin x=1 awk 2>/dev/null local -eu awk
+	done $(pwd) ${HOME} readonly awk /usr/bin cd --verbose grep
+		awk 'quoted text' echo readonly 2>/dev/null
+readonly awk done cd export $(pwd) sed 2>/dev/null 2>/dev/null
+	cd /usr/bin /usr/bin "$1" && grep local x=1 sed /usr/bin
+		$(pwd) printf sed && then x=1 && -eu awk done echo "$@" "$@" cd
+2>/dev/null | -eu printf "$@" 'quoted text'
+		sed readonly 2>/dev/null
+		export printf $(pwd) done | then then && --verbose -eu $(pwd) sed done 2>/dev/null
+		awk | sed | sed export done
+		local echo /usr/bin cd local ${HOME} printf "$@" && 2>/dev/null 'quoted text' &&
+	grep grep readonly awk sed readonly cd awk --verbose
+		printf grep -eu --verbose cd 2>/dev/null then cd "$@" "$1" export
+		x=1 export /usr/bin awk | grep
+sed printf "$1" cd | readonly --verbose sed then done cd export
+${HOME} local sed echo cd
+${HOME} 'quoted text'
+		done export "$1" "$@" --verbose
+test x=1 "$1" $(pwd) readonly /usr/bin done printf
+&& printf 'quoted text' "$1" printf "$1" printf sed -eu sed printf
+readonly /usr/bin done $(pwd) ${HOME} awk sed export readonly grep printf
+		"$1" && -eu sed grep
+cd 'quoted text' "$1" && 'quoted text' local printf ${HOME} "$1" awk readonly
+	'quoted text' /usr/bin readonly 2>/dev/null export "$1" -eu echo 2>/dev/null "$1"
+cd | done awk 2>/dev/null readonly awk then readonly -eu --verbose
+		${HOME} x=1 export 2>/dev/null done echo
+	grep grep readonly "$1" echo cd | "$@" $(pwd)
+2>/dev/null grep -eu $(pwd) cd
+	awk local test ${HOME} printf echo -eu done && ${HOME} echo $(pwd)
+	sed done /usr/bin x=1 done awk $(pwd) echo "$@" $(pwd) x=1 sed printf
+		local $(pwd) "$@" echo local
+	${HOME} cd printf printf then "$@" then && done --verbose -eu
+test | /usr/bin local 'quoted text' "$@" printf grep /usr/bin sed --verbose
+${HOME} done done local printf "$@" -eu awk done printf sed local
+		echo | printf local --verbose x=1 --verbose 'quoted text' grep
+grep | "$@" test 'quoted text' readonly -eu done then "$@" done sed "$@"
+grep -eu && echo ${HOME}
+-eu printf "$@" $(pwd) local readonly 'quoted text'
+		grep ${HOME} 2>/dev/null
+local grep then x=1 --verbose sed | /usr/bin && done "$@" printf
+| then ${HOME} x=1 && && sed test 2>/dev/null
+	/usr/bin "$1" sed local /usr/bin export -eu cd test cd sed
+	readonly cd "$1" readonly x=1 && ${HOME} printf 2>/dev/null sed
+${HOME} 'quoted text' --verbose /usr/bin export test | x=1 'quoted text' 'quoted text'
+2>/dev/null -eu "$1" -eu | "$1" echo "$@" --verbose then &&
+		"$1" sed test x=1 cd | -eu printf export
+		x=1 sed grep --verbose then awk done "$@" "$@" awk | grep &&
+	done local "$1" && echo | sed printf readonly
+	local readonly printf && 'quoted text'
+	local && test ${HOME} local sed && readonly | echo --verbose readonly "$@"
+		awk cd "$1" export "$@" && echo export
+sed ${HOME} awk printf done "$@"
+"$@" "$1" local 'quoted text' local ${HOME} -eu then local && /usr/bin echo
+	"$1" test 'quoted text' echo /usr/bin
+	'quoted text' x=1 "$@" 2>/dev/null 2>/dev/null echo ${HOME} export
+		2>/dev/null done then readonly ${HOME}
+| && && readonly readonly awk 2>/dev/null printf && grep test cd
+export done /usr/bin local then --verbose "$1"
+x=1 "$@" --verbose readonly && then readonly
+		"$@" awk "$@" export sed 'quoted text' local | /usr/bin /usr/bin printf
+	&& export then sed local sed readonly
+	awk 2>/dev/null | cd sed | | $(pwd) done $(pwd)
+grep awk awk | x=1 $(pwd) then -eu test awk x=1 local cd done readonly
+		then export && "$1" readonly && done awk readonly $(pwd) export
+	| readonly local echo x=1 "$@" 2>/dev/null cd x=1 echo 'quoted text' export
+| awk export readonly local then /usr/bin local x=1
+2>/dev/null grep then awk grep test && awk readonly done x=1 cd &&
+export done && && then test done 2>/dev/null "$@" x=1 && printf export 2>/dev/null
+		2>/dev/null ${HOME} -eu
+		cd test && local $(pwd) readonly then &&
+	2>/dev/null done $(pwd) printf ${HOME} then
+		then "$@" $(pwd) -eu local cd ${HOME} x=1 readonly "$1" ${HOME}
+	test /usr/bin 'quoted text' 2>/dev/null ${HOME} printf cd --verbose
+	grep -eu test -eu sed done cd && sed sed $(pwd) grep
+		test readonly 2>/dev/null x=1 awk awk awk 2>/dev/null test
+printf done 2>/dev/null then export /usr/bin
+	$(pwd) $(pwd) cd | |
+		cd && 2>/dev/null sed then | ${HOME} --verbose test $(pwd) export
+then 'quoted text' | readonly 2>/dev/null /usr/bin test
+'quoted text' awk local printf awk done export
+grep "$1" test /usr/bin
+	then -eu echo done -eu grep 'quoted text' awk done ${HOME} "$1" 'quoted text'
+		$(pwd) /usr/bin ${HOME} "$@" "$1" export export
+	-eu -eu x=1 "$@" then then "$@" readonly grep x=1
+		${HOME} | local 2>/dev/null ${HOME} printf
+	/usr/bin done grep export "$@" echo ${HOME} -eu grep
+sed test grep /usr/bin cd echo /usr/bin /usr/bin ${HOME} "$1"
+	awk readonly readonly
+${HOME} /usr/bin && | | echo printf $(pwd)
+	x=1 done "$@" /usr/bin done ${HOME} /usr/bin awk then local ${HOME} | awk
+	| done local && sed "$1" 2>/dev/null awk
+echo /usr/bin ${HOME} "$@" printf | | "$@" export
+		${HOME} export export "$@" then test awk x=1 grep local
+	cd --verbose sed 2>/dev/null
+	| 'quoted text' "$1" ${HOME}
+--verbose --verbose /usr/bin
+	${HOME} test local $(pwd) local ${HOME} grep $(pwd)
@@ -0,0 +1,2001 @@
+		2>/dev/null x=1 'quoted text' then
+		"$1" && export then awk readonly cd sed cd
+"$1" test then awk cd export readonly test && 2>/dev/null $(pwd) local /usr/bin
+	'quoted text' "$1" done $(pwd) x=1 then readonly
+		test grep && | 'quoted text' "$1" "$@" ${HOME}
+"$@" export awk test then | && grep ${HOME} awk done printf &&
+	grep then grep readonly echo $(pwd) 2>/dev/null export
+		awk ${HOME} sed "$1" readonly test
+/usr/bin --verbose then -eu
+x=1 "$1" test 2>/dev/null x=1 sed grep echo test
+		done local | $(pwd) 2>/dev/null printf done
+	test sed export export local readonly sed done --verbose 2>/dev/null
+		printf x=1 export local done export local
+		$(pwd) 2>/dev/null 2>/dev/null "$@" -eu echo readonly sed
+		$(pwd) export /usr/bin -eu --verbose x=1 --verbose
+	sed done awk printf x=1 /usr/bin "$@" $(pwd) test 2>/dev/null 'quoted text'
+'quoted text' && printf printf awk readonly && 'quoted text'
+grep /usr/bin done export | local then test cd readonly
+		readonly "$1" readonly local && sed "$@" export 'quoted text' 2>/dev/null
+awk grep --verbose sed
+		awk printf --verbose local "$1" /usr/bin local |
+		sed local printf test "$1" && echo test && --verbose cd /usr/bin
+		| 2>/dev/null then echo grep local test $(pwd) export
+	done /usr/bin | awk x=1 | x=1 /usr/bin cd "$@" done --verbose echo ${HOME}
+echo | readonly $(pwd) "$@" echo
+	grep /usr/bin "$1" export -eu echo
+	echo test test /usr/bin "$1" grep 2>/dev/null
+	export | cd local $(pwd) $(pwd) sed sed
+readonly echo ${HOME} && then done && cd 2>/dev/null
+		/usr/bin x=1 grep --verbose
+		sed readonly local export
+-eu "$1" 2>/dev/null test "$1" then --verbose printf printf cd 'quoted text' /usr/bin
+awk awk done "$1" 2>/dev/null
+		'quoted text' sed readonly awk printf readonly ${HOME} cd
+		printf 2>/dev/null && echo 2>/dev/null readonly test -eu then grep $(pwd) readonly
+export && $(pwd) | local grep --verbose
+	then --verbose test 2>/dev/null grep sed awk && /usr/bin readonly "$1"
+--verbose ${HOME} export && echo sed done export
+		$(pwd) printf x=1 $(pwd) ${HOME} --verbose --verbose ${HOME}
+		'quoted text' "$@" -eu local done
+"$1" sed 'quoted text' done done "$1" 2>/dev/null export ${HOME}
+	"$@" readonly local grep x=1 echo
+then && | then 'quoted text' /usr/bin 'quoted text' /usr/bin /usr/bin /usr/bin
+	--verbose test awk then test 'quoted text'
+		echo | $(pwd) 'quoted text' echo readonly grep echo 2>/dev/null
+	--verbose ${HOME} x=1 grep "$1" $(pwd) awk $(pwd) printf then ${HOME} | sed done
+	x=1 cd done cd export cd "$@" echo | 2>/dev/null
+		2>/dev/null awk printf 2>/dev/null -eu ${HOME} 2>/dev/null
+		sed -eu $(pwd) echo echo "$1" done done -eu test printf "$1" --verbose "$@" &&
+cd then ${HOME} x=1 "$@" 2>/dev/null readonly
+2>/dev/null 2>/dev/null local awk
+	export local ${HOME} x=1 export -eu "$@" cd 2>/dev/null
+		sed export grep echo readonly readonly -eu 2>/dev/null
+		$(pwd) done "$@" printf test 'quoted text'
+	local --verbose | local $(pwd) -eu $(pwd)
+		${HOME} | ${HOME} then $(pwd) "$@" local $(pwd) | ${HOME} "$1" | echo readonly
+local export --verbose "$1" export ${HOME} --verbose ${HOME} $(pwd)
+	cd then echo $(pwd) 'quoted text' "$@"
+	done $(pwd) x=1 ${HOME} && ${HOME} && --verbose &&
+	readonly --verbose -eu ${HOME} 2>/dev/null
+	test 'quoted text' test $(pwd) --verbose
+sed readonly echo readonly 'quoted text' 2>/dev/null
+	${HOME} ${HOME} 'quoted text' echo test "$1" export
+printf test "$@" sed && readonly cd test readonly export --verbose
+	--verbose sed export -eu readonly "$1" awk then
+done done 'quoted text' x=1 --verbose printf export readonly cd
+	done --verbose local ${HOME}
+test && $(pwd) done "$1" "$1" x=1 then
+then ${HOME} local local export && cd
+		cd x=1 | then cd x=1 readonly | "$1" $(pwd)
+	local -eu ${HOME} test /usr/bin --verbose local awk echo
+	sed x=1 ${HOME} local 2>/dev/null
+		&& then grep grep awk cd awk export /usr/bin printf grep 'quoted text'
+	grep $(pwd) echo /usr/bin grep /usr/bin local readonly
+		local local echo grep local x=1 readonly
+2>/dev/null "$1" 2>/dev/null done export local 2>/dev/null x=1 "$1" ${HOME} sed
+		local ${HOME} echo done "$1" test | "$1" /usr/bin
+$(pwd) && done readonly "$@" local && cd grep
+test "$@" x=1 test printf /usr/bin 2>/dev/null cd 'quoted text' --verbose
+2>/dev/null echo 'quoted text' "$@" && && export $(pwd) echo 2>/dev/null && 'quoted text'
+	cd "$@" $(pwd) grep --verbose
+cd grep local | --verbose && --verbose test
+		awk x=1 cd "$@" awk | echo | grep /usr/bin test grep export
+	x=1 "$@" /usr/bin local grep awk
+		done cd -eu /usr/bin printf 2>/dev/null
+--verbose grep test cd --verbose grep && awk "$@" done --verbose /usr/bin /usr/bin
+		echo ${HOME} local x=1 2>/dev/null && grep cd | printf echo 'quoted text'
+echo awk grep 2>/dev/null export "$1" /usr/bin echo x=1 echo readonly
+		'quoted text' 2>/dev/null cd
+printf -eu local --verbose cd awk
+		sed $(pwd) "$@" --verbose awk then "$@" 'quoted text'
+		-eu cd 'quoted text' -eu --verbose sed test
+		echo "$1" $(pwd) then | "$1" test 'quoted text' test then 2>/dev/null export --verbose
+$(pwd) sed done x=1 $(pwd) "$1" $(pwd) awk export awk sed
+		grep sed "$1" done $(pwd) && $(pwd) 2>/dev/null 2>/dev/null && /usr/bin
+		export /usr/bin 'quoted text' export -eu echo readonly grep
+	| ${HOME} test readonly test 'quoted text'
+	printf "$@" echo -eu 2>/dev/null export x=1
+	done 'quoted text' -eu && readonly
+cd --verbose 2>/dev/null sed | --verbose echo 'quoted text' cd printf
+export grep done awk /usr/bin ${HOME} && -eu /usr/bin x=1
+-eu 2>/dev/null /usr/bin echo /usr/bin ${HOME} then grep cd 'quoted text'
+		"$1" 2>/dev/null printf done "$1" echo $(pwd) -eu
+		| cd "$1" sed awk done
+	"$1" /usr/bin then sed awk awk done printf export done awk x=1
+awk 'quoted text' x=1 | 2>/dev/null sed "$@" x=1 -eu -eu
+		then export local test done local local export awk 'quoted text'
+	"$@" local echo "$1" cd --verbose cd "$1" echo x=1 2>/dev/null 'quoted text'
+		printf "$1" --verbose sed test readonly printf -eu /usr/bin sed ${HOME}
+		--verbose sed test then && 'quoted text' $(pwd) export &&
+		awk ${HOME} | echo grep echo ${HOME} readonly local --verbose
+	$(pwd) --verbose then $(pwd)
+2>/dev/null then && $(pwd) cd then export $(pwd) echo | test 'quoted text'
+		then 'quoted text' readonly awk echo printf then "$@" local && -eu echo export
+		sed awk echo "$1" "$@" cd printf done "$@" --verbose echo "$1" -eu ${HOME} awk
+		2>/dev/null local cd done --verbose sed 'quoted text' "$@" 2>/dev/null
+	grep readonly test &&
+		"$@" 'quoted text' && cd cd --verbose
+		-eu local done /usr/bin sed test && "$@"
+"$1" x=1 'quoted text' 'quoted text'
+	| 'quoted text' readonly printf done 'quoted text' 2>/dev/null
+	printf | | ${HOME} printf -eu local local cd local done then printf export sed
+| grep --verbose grep --verbose | sed ${HOME} | sed export &&
+	${HOME} && "$1" echo "$1" && $(pwd) -eu x=1 --verbose then $(pwd) "$1"
+/usr/bin test $(pwd) 'quoted text'
+		then then /usr/bin local "$@" then done echo 2>/dev/null export --verbose && grep
+	"$1" export -eu --verbose x=1 cd "$@" &&
+local grep | --verbose /usr/bin "$@" --verbose readonly
+		$(pwd) x=1 "$@" awk "$1" 'quoted text' 2>/dev/null "$@" echo test ${HOME} printf
+	x=1 done -eu awk ${HOME} x=1 --verbose cd ${HOME} done cd readonly -eu test
+	local | -eu /usr/bin --verbose local ${HOME} grep sed ${HOME} readonly grep
+&& --verbose 'quoted text' printf | export /usr/bin
+	--verbose echo export cd sed $(pwd) && 'quoted text' "$1" ${HOME}
+		| echo -eu $(pwd) -eu then /usr/bin -eu | grep export
+	"$1" then 'quoted text' echo $(pwd)
+		test test x=1 then printf
+test local "$@" /usr/bin
+	grep readonly /usr/bin -eu grep cd awk | printf
+sed -eu | 'quoted text' then awk --verbose done echo test -eu local
+"$1" /usr/bin "$@" --verbose --verbose sed "$1" readonly sed 'quoted text'
+local echo 'quoted text' 2>/dev/null -eu ${HOME} $(pwd) sed test printf | echo
+	'quoted text' echo sed --verbose test echo done "$1" sed then local
+		export echo --verbose --verbose export && "$@"
+		done echo grep echo --verbose "$@" 'quoted text' /usr/bin "$1" echo cd ${HOME}
+echo test printf test 2>/dev/null $(pwd) awk local sed
+		printf awk /usr/bin echo | $(pwd) | 'quoted text'
+		local /usr/bin --verbose ${HOME}
+$(pwd) cd sed | "$@" readonly
+	export sed 2>/dev/null "$@" x=1 sed "$1" then local done | "$1"
+		test --verbose readonly --verbose echo
+2>/dev/null /usr/bin local awk
+export then awk export 'quoted text' grep
+		done x=1 /usr/bin -eu | -eu done awk && x=1
+readonly "$1" local test ${HOME} test 2>/dev/null $(pwd) export
+		'quoted text' test cd echo done
+/usr/bin then -eu 'quoted text' ${HOME}
+	| test ${HOME} export local | then "$@" grep
+	local x=1 ${HOME} --verbose
+test sed "$1" ${HOME} done done /usr/bin grep "$@" /usr/bin x=1
+	&& test | --verbose x=1 x=1 awk 2>/dev/null
+	2>/dev/null "$@" echo $(pwd) $(pwd) && then awk done
+		$(pwd) -eu 2>/dev/null printf "$1" x=1 grep
+		-eu cd && "$1" grep --verbose 'quoted text'
+&& local 'quoted text' /usr/bin readonly x=1 cd printf $(pwd)
+	local done && sed sed test sed then local test
+		export && ${HOME} $(pwd)
+	| sed | sed cd ${HOME} echo awk "$1" grep awk sed done
+	done | 'quoted text' $(pwd) awk && /usr/bin 2>/dev/null | --verbose -eu
+	readonly awk sed 2>/dev/null export awk then --verbose 2>/dev/null readonly
+		echo 2>/dev/null 'quoted text' "$@" 'quoted text' grep /usr/bin x=1 x=1 &&
+	printf test 2>/dev/null test $(pwd) printf echo --verbose /usr/bin
+	'quoted text' ${HOME} "$1" | export awk x=1 /usr/bin readonly
+		x=1 $(pwd) 'quoted text' && && local ${HOME}
+then x=1 | 'quoted text' | /usr/bin | printf export echo | ${HOME} --verbose
+	x=1 printf then cd x=1 2>/dev/null --verbose readonly "$@" -eu awk printf printf
+2>/dev/null readonly sed | sed ${HOME} x=1 && awk | local printf readonly printf
+	$(pwd) $(pwd) grep grep awk readonly done printf readonly /usr/bin
+readonly && sed 'quoted text' --verbose | --verbose echo 2>/dev/null
+done readonly /usr/bin done
+	test sed -eu then 'quoted text' cd "$@" /usr/bin 2>/dev/null test test
+	--verbose 'quoted text' ${HOME} --verbose printf $(pwd) | awk awk grep | readonly
+		'quoted text' ${HOME} printf
+	then cd cd ${HOME} --verbose 'quoted text' "$@" sed 'quoted text'
+	x=1 cd 'quoted text' | x=1 sed 2>/dev/null readonly sed /usr/bin printf
+	'quoted text' ${HOME} local 'quoted text' cd printf x=1 printf
+$(pwd) x=1 local awk x=1 cd ${HOME}
+		done printf grep echo $(pwd) cd
+	x=1 | printf --verbose echo sed -eu | -eu test echo $(pwd) "$@" --verbose
+sed --verbose then "$1" grep
+		$(pwd) x=1 -eu export readonly echo --verbose x=1
+"$1" "$1" grep done grep sed test readonly local /usr/bin echo then
+		/usr/bin readonly -eu "$@" 2>/dev/null -eu cd $(pwd) /usr/bin
+test test done awk 2>/dev/null echo cd cd export test cd local awk export
+2>/dev/null awk && export $(pwd) ${HOME} cd
+	-eu /usr/bin "$@" then
+		local done --verbose /usr/bin cd readonly
+	test printf "$@" 'quoted text' sed then grep --verbose "$@"
+	$(pwd) awk echo $(pwd) sed then "$@" then
+	"$@" cd then "$1" && done "$1" -eu test "$@" 'quoted text' | | /usr/bin
+test then "$@" printf /usr/bin --verbose | "$1"
+	local -eu echo | x=1 'quoted text' cd export && done 2>/dev/null then
+"$@" "$1" readonly printf then awk ${HOME} done | ${HOME} 2>/dev/null
+$(pwd) then /usr/bin local cd "$@" ${HOME} local | printf readonly local "$@"
+	grep 'quoted text' awk
+	"$1" export x=1 | 'quoted text' -eu x=1 local awk --verbose "$1" --verbose done
+	${HOME} done /usr/bin local "$1" cd cd --verbose
+		&& test done $(pwd) export /usr/bin x=1 "$@" -eu then
+echo 'quoted text' grep readonly export 2>/dev/null
+awk done | readonly -eu done ${HOME} test sed x=1 2>/dev/null
+cd $(pwd) readonly cd export x=1 done
+	2>/dev/null --verbose sed printf /usr/bin
+	sed 2>/dev/null then awk x=1 then "$1" -eu && ${HOME} local --verbose
+	"$@" && cd 'quoted text' then "$@" cd x=1 | cd echo
+| done 2>/dev/null | ${HOME} export 'quoted text' echo readonly cd | local
+"$1" && 2>/dev/null -eu export cd && "$@" 2>/dev/null
+$(pwd) echo && export "$1" grep /usr/bin export && done ${HOME} "$1" readonly sed
+	/usr/bin then $(pwd) test then --verbose awk
+$(pwd) done then $(pwd) local ${HOME} --verbose x=1 "$1" --verbose 'quoted text'
+| 'quoted text' done -eu awk printf readonly cd cd local x=1 grep sed
+		grep done cd awk | 2>/dev/null
+	&& local cd 'quoted text' 2>/dev/null test /usr/bin ${HOME}
+	'quoted text' export x=1 2>/dev/null cd x=1 "$@" export grep x=1 grep --verbose
+echo $(pwd) 'quoted text' readonly awk | 'quoted text'
+	-eu awk | "$1" $(pwd) cd cd then && /usr/bin $(pwd) ${HOME} 'quoted text' 'quoted text'
+		then "$1" && sed $(pwd) 'quoted text' x=1 awk && && $(pwd) -eu
+		2>/dev/null -eu "$1" export ${HOME} -eu 2>/dev/null test x=1 printf local
+	x=1 printf ${HOME} 'quoted text' ${HOME} awk $(pwd)
+done 'quoted text' export readonly done echo cd cd && 'quoted text' readonly x=1
+	readonly local sed awk x=1 --verbose ${HOME} printf
+	printf export $(pwd) sed grep readonly /usr/bin local printf
+		sed cd 'quoted text' done $(pwd) local export echo printf 'quoted text'
+		grep export --verbose && x=1 | 'quoted text' x=1 ${HOME}
+readonly grep cd export local
+printf local | | ${HOME} && grep 2>/dev/null /usr/bin export
+export sed | && 'quoted text' --verbose /usr/bin awk printf $(pwd)
+printf "$1" 2>/dev/null -eu && /usr/bin echo
+export echo then ${HOME} 'quoted text' then ${HOME} local grep
+grep x=1 export 'quoted text' "$@" export
+		'quoted text' readonly x=1 --verbose
+		done --verbose ${HOME} &&
+	then -eu ${HOME} sed cd 'quoted text' "$@" sed then $(pwd)
+local done readonly ${HOME} /usr/bin
+	-eu 2>/dev/null then x=1 | "$1" --verbose $(pwd) export sed test
+		x=1 sed && printf grep then ${HOME} | printf ${HOME}
+	echo -eu printf "$@" grep | ${HOME} | | && && export test x=1 && "$1" -eu
+${HOME} -eu echo local "$@" ${HOME} then x=1 'quoted text' "$@" awk test echo --verbose
+	done export sed echo done
+echo -eu awk awk export printf local export then |
+		readonly --verbose "$@" local $(pwd) x=1 grep then done
+	grep "$@" "$@" ${HOME} "$@" "$1" then then | echo 2>/dev/null echo x=1 && echo
+	printf | local cd 'quoted text' --verbose && cd
+		"$@" 'quoted text' --verbose | && "$@" /usr/bin $(pwd)
+	grep | 'quoted text' "$@" cd cd cd awk test && $(pwd) done -eu --verbose awk
+		${HOME} done echo -eu
+"$@" then readonly echo -eu readonly echo "$1" local test x=1
+	export then test awk awk test "$@" ${HOME}
+		export "$1" then cd grep ${HOME} $(pwd)
+		then awk grep export x=1 local local "$1" x=1 done
+		${HOME} done echo cd 'quoted text' 'quoted text' "$1" -eu &&
+grep x=1 sed --verbose
+		printf --verbose 2>/dev/null $(pwd)
+"$@" local | grep -eu echo $(pwd) ${HOME} done 'quoted text'
+	"$@" echo printf test local 'quoted text' ${HOME} test awk
+&& ${HOME} /usr/bin ${HOME} test "$@"
+cd then awk | done ${HOME} echo
+		then x=1 | "$1" --verbose sed readonly echo /usr/bin local done 2>/dev/null
+		${HOME} 'quoted text' -eu grep awk awk /usr/bin
+grep "$1" 2>/dev/null printf export 2>/dev/null
+printf grep local sed --verbose sed cd "$1" printf
+/usr/bin sed -eu | /usr/bin cd x=1 "$@" "$1" grep -eu local
+		x=1 --verbose --verbose /usr/bin
+	--verbose && local "$@" "$1" then --verbose
+| ${HOME} "$1" sed -eu 'quoted text' 'quoted text' /usr/bin readonly
+	test && then local export awk printf "$@" cd test /usr/bin grep printf ${HOME}
+	export grep | /usr/bin | export cd cd sed 2>/dev/null done sed /usr/bin
+local test "$1" then /usr/bin && $(pwd)
+	test grep "$@" awk done readonly x=1 | awk local --verbose "$@" printf | -eu printf
+/usr/bin -eu "$@" --verbose 'quoted text' 'quoted text' -eu echo
+		$(pwd) ${HOME} --verbose done export "$@"
+		$(pwd) && --verbose -eu -eu printf done test local -eu
+-eu awk printf "$@" done x=1 grep cd done test $(pwd)
+printf x=1 local grep awk /usr/bin ${HOME} "$@" cd -eu
+'quoted text' echo readonly local $(pwd) cd 'quoted text' ${HOME} grep grep
+	"$1" --verbose x=1 test 'quoted text' $(pwd) $(pwd) export
+	then 'quoted text' ${HOME} export "$@" 'quoted text'
+echo test sed export cd 2>/dev/null grep 2>/dev/null
+cd "$@" /usr/bin cd echo x=1 && ${HOME} x=1 | --verbose sed awk
+	&& ${HOME} local grep local local -eu awk
+		"$@" $(pwd) sed "$@" done && cd "$1" && cd grep x=1 test readonly
+	test printf && export sed "$@" --verbose | cd readonly echo then $(pwd) echo | echo
+	export /usr/bin local export grep /usr/bin printf local cd
+		&& cd --verbose test && printf && sed "$@" "$@" --verbose ${HOME} &&
+		-eu done readonly 'quoted text' printf /usr/bin echo
+	local 'quoted text' local | 2>/dev/null
+-eu 'quoted text' export local && 2>/dev/null -eu test
+	/usr/bin x=1 x=1 "$1" x=1 -eu then awk ${HOME} export echo printf readonly
+export $(pwd) grep x=1 ${HOME}
+cd echo cd grep done then readonly /usr/bin
+	grep -eu --verbose awk /usr/bin awk && done
+"$@" readonly echo then $(pwd) -eu &&
+	grep 'quoted text' awk done test x=1 2>/dev/null printf
+		then 2>/dev/null && echo then
+	"$@" local then awk 2>/dev/null test
+--verbose && export readonly local readonly
+		test then "$@" --verbose ${HOME} cd 'quoted text' echo sed $(pwd) 2>/dev/null
+	export /usr/bin echo grep printf "$@" "$1" export then --verbose && test
+		done 'quoted text' $(pwd) -eu -eu 'quoted text' export
+--verbose local awk 'quoted text' x=1 | /usr/bin
+test then sed /usr/bin "$@" grep local readonly -eu $(pwd) done | &&
+		2>/dev/null export done 'quoted text'
+${HOME} export | "$@" cd local
+--verbose "$1" | grep ${HOME} ${HOME} sed grep done
+		2>/dev/null grep --verbose | sed -eu 'quoted text'
+"$@" then cd -eu "$@" awk 'quoted text' echo && x=1
+	readonly sed /usr/bin cd ${HOME} | ${HOME} echo ${HOME}
+		"$@" ${HOME} && $(pwd) done readonly 2>/dev/null
+		grep awk readonly cd 2>/dev/null ${HOME} printf
+		-eu -eu grep $(pwd) local -eu local
+	test $(pwd) then export
+		x=1 ${HOME} test && readonly
+		sed done test grep /usr/bin echo test sed grep 2>/dev/null
+	echo echo echo cd test x=1 cd local readonly printf 2>/dev/null
+		2>/dev/null 'quoted text' printf && echo --verbose
+	'quoted text' 'quoted text' $(pwd) ${HOME} "$@" awk echo -eu echo --verbose
+		-eu then "$@" sed awk done
+		cd "$1" ${HOME} echo export 'quoted text' readonly printf echo "$1"
+	readonly "$@" readonly "$1" cd -eu && awk "$1" ${HOME}
+	&& readonly "$@" awk then ${HOME} && && awk test 2>/dev/null $(pwd)
+		then ${HOME} /usr/bin | --verbose
+		printf sed 'quoted text' $(pwd) "$@" echo /usr/bin -eu "$1" export
+awk --verbose readonly "$@" printf /usr/bin --verbose && && awk cd printf
+		grep then --verbose export
+	"$1" export cd /usr/bin printf then -eu cd echo printf /usr/bin
+		${HOME} readonly export printf then ${HOME} 2>/dev/null export awk 'quoted text'
+	then awk done test echo /usr/bin | awk "$1"
+		"$1" /usr/bin "$@" | readonly awk awk "$@" /usr/bin echo /usr/bin done echo
+		&& && x=1 | --verbose && | ${HOME}
+	-eu sed readonly && 'quoted text' then 'quoted text' test readonly awk x=1
+	local then | printf test /usr/bin ${HOME} /usr/bin echo then
+	export --verbose cd then
+		| "$@" sed local done /usr/bin done readonly && grep x=1 readonly then $(pwd)
+then done sed && sed | done cd ${HOME} -eu
+then --verbose ${HOME} 'quoted text' | then && grep $(pwd) awk readonly | test
+		$(pwd) awk --verbose printf 2>/dev/null /usr/bin export done --verbose printf
+		/usr/bin grep 2>/dev/null test 2>/dev/null cd readonly
+	test readonly test cd echo awk && awk local grep
+	| && local "$@" "$@" awk printf
+		2>/dev/null printf export done sed
+		awk echo "$1" export 'quoted text' | ${HOME} --verbose
+		/usr/bin "$1" x=1 ${HOME} ${HOME} ${HOME} | printf /usr/bin
+		printf readonly test cd then cd test -eu "$@" |
+sed grep 'quoted text' then printf 2>/dev/null export export grep -eu awk "$1"
+		awk 'quoted text' x=1 readonly echo done then ${HOME} then --verbose ${HOME}
+		| then local sed done cd | "$@" done "$1" "$@"
+		then printf $(pwd) 'quoted text' -eu | --verbose $(pwd)
+grep echo x=1 | 2>/dev/null -eu -eu 'quoted text' $(pwd) "$1"
+		test /usr/bin sed | awk then && echo printf local 'quoted text'
+		local then -eu done done "$@" cd --verbose
+	awk then export | sed sed awk "$1" cd printf test /usr/bin ${HOME}
+	readonly "$1" sed $(pwd) awk done | export "$@" $(pwd)
+	echo readonly test ${HOME} awk printf 'quoted text'
+	"$1" 'quoted text' done export sed printf && -eu
+| readonly --verbose sed echo /usr/bin && awk grep test echo "$@"
+		then awk 2>/dev/null --verbose
+"$@" x=1 x=1 x=1 && readonly
+	export "$@" 'quoted text' --verbose readonly sed ${HOME} --verbose
+	awk $(pwd) export sed readonly 'quoted text'
+	awk done --verbose | --verbose cd "$@"
+	${HOME} | awk done 'quoted text' test | --verbose --verbose
+	-eu test printf "$@" --verbose $(pwd) x=1
+export x=1 export && test done export local "$1" test
+'quoted text' | sed then then /usr/bin
+	echo test -eu export | "$@" /usr/bin test done local
+	grep $(pwd) -eu | local
+printf /usr/bin cd printf awk | grep /usr/bin grep local "$@" sed grep
+		sed x=1 'quoted text' -eu test "$1" "$@" -eu && | local local
+test "$@" && "$@" --verbose then echo awk && x=1 -eu export done 'quoted text'
+	${HOME} export cd test awk "$1" printf
+	done 'quoted text' awk test 2>/dev/null echo readonly
+	sed $(pwd) readonly grep grep echo | cd awk cd printf awk
+	sed x=1 echo ${HOME} --verbose /usr/bin test
+	"$@" readonly printf cd 2>/dev/null
+readonly 'quoted text' then done grep export printf echo export
+printf && $(pwd) done "$1" readonly export 2>/dev/null
+readonly test "$@" $(pwd) -eu local awk -eu "$@" $(pwd) echo ${HOME} 2>/dev/null
+	'quoted text' "$@" echo sed --verbose grep -eu grep
+	$(pwd) sed grep ${HOME} then /usr/bin echo awk echo 'quoted text' 'quoted text'
+export 'quoted text' local local -eu 2>/dev/null local export
+	test /usr/bin x=1 readonly x=1 done /usr/bin test | sed $(pwd) x=1 $(pwd)
+&& "$1" 2>/dev/null /usr/bin 2>/dev/null
+	awk /usr/bin test done sed local local sed
+		then echo grep readonly local /usr/bin cd "$1" x=1 export ${HOME}
+	| readonly "$@" cd 'quoted text' sed $(pwd) awk x=1 -eu &&
+echo --verbose then "$@" && grep -eu cd done printf
+'quoted text' 'quoted text' readonly cd 2>/dev/null "$@" echo
+		done ${HOME} $(pwd) then sed readonly 'quoted text' x=1 "$@"
+	"$@" "$@" printf && readonly x=1 grep 'quoted text' /usr/bin 2>/dev/null test /usr/bin
+--verbose echo 'quoted text' && | local test /usr/bin
+x=1 test x=1 readonly $(pwd) -eu 'quoted text' test printf
+--verbose -eu awk test
+	--verbose "$1" echo printf export $(pwd) --verbose 2>/dev/null && "$@" echo
+| -eu "$@" then ${HOME} grep readonly x=1
+done x=1 cd local "$@" then
+	"$@" test 2>/dev/null 2>/dev/null
+readonly | local grep test && -eu "$@" 'quoted text'
+	'quoted text' && $(pwd) awk local && test local
+	sed local done -eu | grep sed cd export 2>/dev/null |
+		"$1" 'quoted text' && export done printf | test 2>/dev/null test "$1" 'quoted text'
+		export sed done grep 2>/dev/null local grep --verbose | 2>/dev/null
+	${HOME} ${HOME} printf sed -eu echo ${HOME}
+	awk "$1" echo 'quoted text' done
+		then then export test &&
+	echo 2>/dev/null readonly "$1" export printf
+$(pwd) "$@" done echo -eu
+--verbose 'quoted text' then cd 'quoted text'
+$(pwd) readonly grep && -eu echo sed test -eu printf sed grep
+	printf export --verbose then grep export $(pwd)
+	2>/dev/null ${HOME} --verbose && then
+		x=1 done x=1 | -eu local 2>/dev/null ${HOME} local | grep --verbose
+		$(pwd) "$@" readonly --verbose 'quoted text' sed /usr/bin cd "$@"
+	printf echo /usr/bin test | && sed then "$1" local && cd printf $(pwd)
+--verbose printf && -eu then 2>/dev/null -eu --verbose | export ${HOME} "$1"
+		-eu && export local --verbose ${HOME} cd done x=1 $(pwd) && 'quoted text'
+cd test 2>/dev/null readonly local export 'quoted text' sed ${HOME}
+printf | sed /usr/bin
+		then -eu readonly done awk awk $(pwd) $(pwd) readonly
+	cd /usr/bin -eu -eu then && ${HOME} | sed
+		'quoted text' cd export cd ${HOME} sed ${HOME} local
+--verbose done printf readonly sed x=1 2>/dev/null awk local &&
+		echo echo ${HOME} -eu --verbose
+/usr/bin ${HOME} then ${HOME} "$@"
+		/usr/bin export grep && x=1 'quoted text' cd echo readonly | -eu -eu "$@" "$1"
+	"$1" printf printf done cd readonly "$@" x=1 && 'quoted text'
+cd printf export local "$@" /usr/bin
+	$(pwd) readonly sed --verbose "$@" $(pwd) readonly readonly awk echo awk printf
+	-eu test && cd 2>/dev/null local -eu 2>/dev/null 2>/dev/null /usr/bin
+2>/dev/null 2>/dev/null done readonly /usr/bin done awk test printf
+awk then grep grep -eu printf 2>/dev/null $(pwd) then
+		printf cd -eu 2>/dev/null printf export 'quoted text'
+	"$1" -eu test /usr/bin -eu x=1 /usr/bin
+/usr/bin --verbose -eu 'quoted text' /usr/bin
+		then /usr/bin readonly local test | 'quoted text'
+		export 2>/dev/null grep -eu x=1 grep --verbose local export /usr/bin readonly
+test local cd "$@" then sed 2>/dev/null "$1" echo /usr/bin cd local -eu --verbose
+	cd "$@" awk x=1 grep then awk export cd -eu --verbose 'quoted text' ${HOME}
+local grep cd test readonly "$1" sed awk cd "$1" 'quoted text'
+/usr/bin $(pwd) echo cd "$1" local printf
+	printf test "$@" readonly "$1" local
+		export done "$1" sed && grep done test ${HOME}
+		x=1 /usr/bin export 2>/dev/null -eu done
+		$(pwd) /usr/bin grep 'quoted text'
+		test readonly ${HOME} export
+		"$1" $(pwd) --verbose | printf test 2>/dev/null &&
+	export 'quoted text' ${HOME} 'quoted text' cd ${HOME} then then
+'quoted text' | 'quoted text' "$1" && printf awk 'quoted text'
+	"$@" sed x=1 && "$1" ${HOME} 2>/dev/null
+	"$1" | sed --verbose done 2>/dev/null
+		"$1" --verbose | --verbose "$@"
+		awk cd awk readonly cd x=1
+	printf && test 2>/dev/null 2>/dev/null ${HOME} 'quoted text' 2>/dev/null
+	test done done done awk 2>/dev/null -eu
+		local "$1" sed export $(pwd) printf
+&& && x=1 test sed /usr/bin printf && export && ${HOME} | export
+"$1" --verbose 'quoted text' $(pwd) -eu /usr/bin -eu $(pwd)
+export test readonly sed cd then grep | -eu | then
+		$(pwd) done grep 'quoted text' sed then done --verbose
+		done printf 'quoted text' test echo then x=1 awk then readonly 2>/dev/null
+		then -eu local cd 'quoted text'
+&& -eu cd 2>/dev/null echo local cd awk "$@"
+| 'quoted text' local /usr/bin local export awk then && &&
+		cd sed --verbose ${HOME} printf 2>/dev/null printf printf grep
+	export test readonly readonly sed /usr/bin done grep
+echo printf local printf --verbose 'quoted text'
+		--verbose then $(pwd) export ${HOME} done readonly then local
+	sed local awk then && 'quoted text' | sed grep 2>/dev/null
+	export "$@" then -eu /usr/bin printf && 2>/dev/null
+	"$1" then /usr/bin test then && x=1
+		'quoted text' x=1 cd x=1 -eu printf --verbose /usr/bin x=1
+		done ${HOME} -eu 'quoted text' export awk then
+test then sed export sed printf cd x=1 -eu "$@" && "$@" test grep
+	"$@" then cd done sed --verbose $(pwd)
+then 'quoted text' /usr/bin -eu
+&& /usr/bin /usr/bin "$@" | /usr/bin test -eu local awk
+echo "$@" cd local 2>/dev/null --verbose "$@"
+	done 'quoted text' export export /usr/bin test export
+	/usr/bin cd readonly 2>/dev/null 'quoted text' local
+cd ${HOME} 'quoted text' &&
+		grep cd x=1 /usr/bin && --verbose cd done grep export
+	done sed sed then grep --verbose printf x=1 /usr/bin "$@" /usr/bin -eu awk
+	${HOME} $(pwd) printf grep
+'quoted text' local 2>/dev/null grep readonly | |
+		"$1" x=1 printf "$@" echo && local x=1 local "$1" cd
+		test test -eu awk then $(pwd)
+	done && x=1 cd echo test "$@"
+		export awk export awk readonly readonly 'quoted text' $(pwd)
+	readonly export printf echo -eu then export /usr/bin then
+done ${HOME} awk ${HOME} 'quoted text' test ${HOME}
+		local x=1 "$1" 2>/dev/null
+	cd | local local readonly echo printf $(pwd) awk x=1 done echo --verbose test test
+		echo $(pwd) x=1 cd then "$1" done "$1" x=1
+$(pwd) local test local "$1" -eu $(pwd)
+		"$1" && export test "$1" x=1
+		grep x=1 sed 2>/dev/null done "$1" done --verbose x=1 then cd awk "$1"
+	export test --verbose echo x=1 printf --verbose then
+	sed && --verbose done test grep done grep local readonly && grep /usr/bin
+		then 'quoted text' cd printf $(pwd) /usr/bin $(pwd) sed sed printf
+&& sed "$@" grep awk done local sed grep x=1 | done readonly
+/usr/bin echo 'quoted text' /usr/bin
+		awk grep then -eu | 'quoted text'
+	&& --verbose x=1 --verbose sed ${HOME} "$1" then 2>/dev/null export ${HOME}
+	grep 'quoted text' done $(pwd) 'quoted text' echo cd readonly "$@" printf /usr/bin
+		${HOME} | 2>/dev/null cd cd local then sed sed /usr/bin readonly
+"$@" sed done /usr/bin -eu 'quoted text'
+		| x=1 readonly && cd test grep export "$1" then grep | | x=1 $(pwd) -eu
+	echo awk printf awk && -eu local cd test /usr/bin
+printf done readonly sed x=1 | 2>/dev/null 'quoted text' 'quoted text'
+/usr/bin done -eu cd "$@"
+	printf cd cd then /usr/bin && $(pwd) ${HOME} -eu then export -eu ${HOME} && $(pwd)
+		grep printf export printf
+		awk local sed "$1" then -eu grep ${HOME} export then printf grep
+		"$@" sed x=1 ${HOME} "$1" then 2>/dev/null printf then |
+		&& $(pwd) sed echo $(pwd) $(pwd) 'quoted text'
+printf -eu x=1 cd 2>/dev/null grep test
+		"$@" 2>/dev/null | printf readonly | grep 2>/dev/null test then echo
+		done ${HOME} "$1" local ${HOME} grep
+		| printf printf test ${HOME} $(pwd) --verbose 'quoted text' --verbose -eu export
+	grep cd then awk awk echo readonly /usr/bin
+		grep $(pwd) 2>/dev/null x=1 'quoted text' awk sed local --verbose --verbose
+		2>/dev/null | echo local printf 2>/dev/null -eu -eu printf x=1 cd
+'quoted text' "$@" $(pwd) done test -eu 2>/dev/null
+	&& cd 'quoted text' grep | 2>/dev/null
+		&& ${HOME} 2>/dev/null test /usr/bin then /usr/bin x=1 printf --verbose
+-eu local ${HOME} echo sed -eu readonly
+	$(pwd) export /usr/bin awk printf echo "$@"
+	test export grep test local && done "$@" cd local ${HOME} 'quoted text'
+	echo ${HOME} then readonly $(pwd)
+echo export grep -eu ${HOME} cd awk 'quoted text'
+	done x=1 grep printf $(pwd)
+	x=1 "$@" 2>/dev/null awk grep "$1" awk readonly awk printf "$@" printf local
+grep local test then -eu done export 'quoted text' export sed --verbose
+		echo test "$@" cd 2>/dev/null
+awk /usr/bin export sed local "$1" done -eu export awk echo echo /usr/bin
+	cd ${HOME} $(pwd) 2>/dev/null 'quoted text' export "$@" printf 2>/dev/null
+awk --verbose "$@" done 'quoted text' -eu
+	| -eu | local -eu echo test &&
+		x=1 test local "$@" /usr/bin && $(pwd) x=1 cd readonly
+		sed "$@" 'quoted text' | /usr/bin "$1" local
+| awk "$1" ${HOME} "$1" $(pwd) 2>/dev/null ${HOME}
+	x=1 grep "$1" && echo test then --verbose 2>/dev/null ${HOME}
+then awk ${HOME} printf && local done /usr/bin
+	local grep printf done -eu done --verbose echo 'quoted text'
+		| && -eu done 2>/dev/null && done test
+		2>/dev/null cd readonly test test "$@" export | echo "$@" -eu
+		${HOME} echo 2>/dev/null readonly grep "$@" export sed "$1" sed "$1" --verbose
+readonly cd local sed printf echo -eu x=1 then ${HOME} && sed
+x=1 -eu /usr/bin 'quoted text'
+		-eu done echo $(pwd) && echo "$1" /usr/bin x=1 done /usr/bin readonly
+		${HOME} cd export --verbose $(pwd) done && "$1"
+	| cd && 'quoted text' /usr/bin echo readonly test printf done readonly
+${HOME} $(pwd) 'quoted text' 'quoted text' --verbose ${HOME} && --verbose
+		${HOME} grep grep && grep
+	/usr/bin 'quoted text' ${HOME} x=1 --verbose
+		then grep 2>/dev/null awk 2>/dev/null 'quoted text' sed printf sed 2>/dev/null
+sed x=1 done $(pwd) "$@" grep printf test "$@" $(pwd) ${HOME} sed x=1
+	2>/dev/null "$1" && grep done done "$@" test sed
+	${HOME} && readonly test --verbose 2>/dev/null cd "$@" then
+	${HOME} cd "$1" echo done cd 2>/dev/null | then
+		/usr/bin test test 'quoted text' "$1" "$@" test "$@" ${HOME} printf test export
+	'quoted text' echo "$@" -eu cd cd x=1 test --verbose done local x=1 && then
+	readonly test awk sed echo 'quoted text' readonly 'quoted text' local sed echo
+		2>/dev/null then sed sed | --verbose
+2>/dev/null $(pwd) /usr/bin
+	awk /usr/bin export --verbose test test readonly 'quoted text' /usr/bin
+-eu awk export x=1 echo $(pwd) test "$1" -eu "$1" cd
+	awk ${HOME} cd export | --verbose && "$1" "$@" sed readonly grep
+printf /usr/bin | done ${HOME} 2>/dev/null awk
+		| readonly done 2>/dev/null sed "$1" $(pwd)
+	local echo printf -eu x=1 sed local /usr/bin grep 'quoted text' test ${HOME}
+		echo && x=1 --verbose 2>/dev/null && -eu
+-eu x=1 "$1" export && sed readonly 'quoted text'
+/usr/bin test x=1 $(pwd) readonly ${HOME} | | cd local grep printf done 'quoted text'
+		cd $(pwd) done "$@" export then 'quoted text' cd 2>/dev/null done local
+	'quoted text' awk printf printf -eu /usr/bin
+echo done export -eu readonly | then grep 2>/dev/null 'quoted text' export
+	-eu /usr/bin awk x=1 $(pwd)
+	"$1" test cd export "$1" "$@" /usr/bin grep echo test "$@" ${HOME} grep --verbose
+		export sed printf sed cd echo x=1 -eu $(pwd)
+		done -eu then local $(pwd) test 'quoted text' done
+local $(pwd) x=1 "$@" 2>/dev/null "$@" awk readonly
+		then 2>/dev/null test && x=1 grep export
+		x=1 && readonly cd readonly readonly "$@" readonly
+readonly -eu sed | /usr/bin "$1" awk -eu echo $(pwd)
+	then x=1 echo printf 'quoted text' --verbose
+2>/dev/null then then
+--verbose cd echo test 'quoted text' && then export 2>/dev/null
+"$1" sed ${HOME} 2>/dev/null test -eu test "$@" readonly "$1" local
+	export cd --verbose -eu grep export "$@"
+	2>/dev/null grep cd awk x=1 2>/dev/null cd done 2>/dev/null | /usr/bin
+	${HOME} 2>/dev/null awk ${HOME} ${HOME} --verbose grep cd
+		&& grep done --verbose -eu awk
+		readonly ${HOME} x=1 | 2>/dev/null
+&& -eu readonly 2>/dev/null local $(pwd) echo cd "$@"
+2>/dev/null export 'quoted text' | &&
+		&& -eu && | done cd printf
+	&& 'quoted text' x=1 sed
+	${HOME} done "$@" 2>/dev/null "$@" grep $(pwd) ${HOME} 'quoted text'
+		x=1 awk readonly local sed --verbose echo && cd export -eu -eu -eu test export
+		'quoted text' done --verbose test echo
+readonly /usr/bin sed --verbose 'quoted text' && | -eu && x=1 ${HOME}
+'quoted text' && cd sed export "$@" ${HOME} done "$@" "$@"
+		--verbose "$@" x=1 then | echo cd export grep
+	${HOME} 'quoted text' local then 'quoted text' && then 2>/dev/null
+readonly then 'quoted text' echo -eu cd cd local done x=1 ${HOME}
+	/usr/bin cd 2>/dev/null readonly sed export cd
+$(pwd) "$@" 'quoted text' readonly ${HOME} ${HOME} sed -eu grep 'quoted text'
+	$(pwd) awk then sed 'quoted text' then $(pwd) x=1 "$1" then
+		then readonly | grep awk "$@"
+	then sed 2>/dev/null echo && $(pwd) -eu /usr/bin
+		2>/dev/null /usr/bin then awk --verbose then
+		done test awk -eu | && cd 2>/dev/null awk | awk export "$1" awk ${HOME} printf
+	2>/dev/null /usr/bin printf echo readonly export 2>/dev/null
+	'quoted text' cd then && awk echo readonly readonly
+	"$1" $(pwd) | cd x=1 echo --verbose sed --verbose sed $(pwd) local $(pwd) local
+	grep ${HOME} grep x=1 "$1" awk echo
+		"$1" -eu | test 'quoted text' local -eu --verbose /usr/bin
+		-eu local "$@" | done "$1" x=1 printf $(pwd) "$@" local
+	export && test "$@" cd test test grep then then -eu
+		sed cd printf && ${HOME} grep | $(pwd) test done
+grep done awk echo cd awk x=1 | "$@" test &&
+		grep "$1" && $(pwd) test -eu printf $(pwd) sed readonly local
+	readonly cd echo "$@" &&
+		readonly sed sed export x=1 echo then sed && --verbose
+		done local done -eu $(pwd) test cd local cd local echo "$1" 2>/dev/null /usr/bin
+		/usr/bin && 2>/dev/null ${HOME} cd grep printf then sed | --verbose grep 'quoted text'
+&& --verbose | then "$1" grep then x=1 echo local -eu | then local sed && export
+printf 'quoted text' sed done -eu "$@"
+/usr/bin /usr/bin then -eu done echo "$1" awk readonly "$@" export printf
+	$(pwd) "$@" --verbose grep
+	grep test printf done awk printf ${HOME}
+	test grep --verbose -eu grep "$1" export test grep "$1" /usr/bin
+/usr/bin printf ${HOME} done grep done echo grep done readonly 'quoted text'
+		${HOME} awk "$@" done awk --verbose 2>/dev/null readonly test then
+	export cd export -eu cd
+	awk test 2>/dev/null | x=1 done then done sed then printf
+	2>/dev/null --verbose --verbose grep local | then -eu test
+		readonly $(pwd) "$1" --verbose /usr/bin
+		awk "$@" echo test awk echo
+		'quoted text' done x=1 printf export grep sed local readonly grep
+then readonly done done done --verbose /usr/bin
+		/usr/bin "$1" "$@" $(pwd)
+		/usr/bin | awk ${HOME} "$1" "$1" | && | done 2>/dev/null
+	echo ${HOME} printf "$@" /usr/bin
+	| "$@" sed grep 2>/dev/null x=1 done /usr/bin
+		"$1" "$@" echo $(pwd) 2>/dev/null 'quoted text'
+'quoted text' "$1" then | sed export awk readonly readonly grep then test 2>/dev/null
+/usr/bin x=1 then done local
+		"$1" local ${HOME} done cd ${HOME} "$@" x=1 sed test grep
+		-eu done test && printf 'quoted text'
+		'quoted text' "$@" "$1" "$1" done printf grep test | && --verbose /usr/bin
+	grep 'quoted text' /usr/bin export 'quoted text' | -eu "$1" 'quoted text'
+readonly $(pwd) ${HOME}
+--verbose sed -eu $(pwd) ${HOME} echo test test test -eu $(pwd) -eu /usr/bin
+	cd -eu grep 'quoted text' | echo 'quoted text'
+	--verbose printf grep cd --verbose cd printf grep 'quoted text' grep
+		export "$1" awk "$@" -eu x=1 sed --verbose
+	local 2>/dev/null "$@" | grep cd 2>/dev/null ${HOME} "$@" 'quoted text' local grep
+/usr/bin x=1 then cd readonly "$@" readonly "$1" && done sed $(pwd) 2>/dev/null
+$(pwd) | test | grep 'quoted text' cd "$1" "$@" ${HOME} test 'quoted text' |
+		cd then "$@" awk --verbose -eu done grep $(pwd) local export done 'quoted text'
+	/usr/bin done $(pwd) cd
+| $(pwd) test "$1" --verbose grep done test grep x=1 "$@"
+		readonly done done "$@" export then ${HOME}
+		${HOME} echo -eu "$1" -eu | grep && awk readonly awk awk export --verbose sed readonly
+		echo ${HOME} sed "$@" --verbose cd "$@" grep sed x=1 printf x=1 grep
+		then "$@" test "$@" echo 'quoted text' && export readonly | -eu 'quoted text'
+		--verbose grep test export $(pwd) cd -eu test printf sed echo test printf
+"$1" -eu awk -eu | | test export && x=1 readonly local sed sed
+echo readonly grep export local
+	&& x=1 sed "$1" export
+		sed /usr/bin 'quoted text'
+	"$@" done readonly -eu /usr/bin x=1 "$@"
+	"$@" ${HOME} test 'quoted text' "$1"
+"$1" cd test 'quoted text' "$@" grep done printf
+&& ${HOME} --verbose /usr/bin 'quoted text' echo then cd readonly /usr/bin
+| && echo readonly cd 'quoted text'
+		echo "$1" awk local local done $(pwd)
+		local --verbose sed 2>/dev/null && -eu awk then printf && then test export
+test local local done cd ${HOME}
+		sed $(pwd) local cd then --verbose $(pwd) echo ${HOME} awk readonly "$1"
+		${HOME} sed readonly --verbose
+${HOME} "$1" -eu test test && | cd local grep echo -eu cd grep 2>/dev/null
+"$@" echo | printf readonly "$@" x=1 x=1 "$@" printf local $(pwd)
+		2>/dev/null echo printf && $(pwd) printf awk grep 2>/dev/null export
+	done -eu grep "$1" $(pwd) | test 2>/dev/null
+	readonly "$@" then x=1 printf export
+/usr/bin 2>/dev/null 'quoted text' test
+export 2>/dev/null sed | $(pwd) echo
+		&& export ${HOME} then 2>/dev/null
+		sed printf "$1" && |
+		then && ${HOME} && "$@" | x=1 printf then "$1" --verbose --verbose
+		readonly "$@" | | test --verbose
+	-eu then printf | ${HOME} "$1" 2>/dev/null
+	/usr/bin | readonly 'quoted text' cd local 2>/dev/null
+		then ${HOME} then && 'quoted text' readonly
+		printf done $(pwd) printf ${HOME} 2>/dev/null grep export "$@" | /usr/bin
+printf 2>/dev/null $(pwd) export "$1" /usr/bin local echo ${HOME} printf
+		--verbose "$@" && x=1 x=1 | grep /usr/bin awk local export && done sed "$1"
+	then x=1 $(pwd) echo test "$@" grep readonly awk 2>/dev/null $(pwd)
+	${HOME} local awk cd 'quoted text' /usr/bin then sed "$1" -eu "$@" grep cd |
+	test x=1 then done cd sed "$1" "$1" done printf local
+		--verbose --verbose then sed then awk grep
+		-eu test ${HOME} /usr/bin |
+		awk awk cd && 2>/dev/null
+		| local /usr/bin 2>/dev/null | && "$@" echo cd "$1" "$@"
+/usr/bin awk export test awk done printf
+	printf sed | grep local done then then
+		done printf -eu local done awk && local | sed done printf
+		${HOME} && "$@" 2>/dev/null "$@" sed export cd local "$1" --verbose
+	awk then echo $(pwd) 2>/dev/null 2>/dev/null 'quoted text' "$1" 2>/dev/null
+		echo ${HOME} 2>/dev/null awk done done grep | x=1 x=1 | /usr/bin "$@" cd sed &&
+		--verbose | -eu "$@" 'quoted text' done printf ${HOME} | readonly test | done export
+grep then local export "$@" && x=1 grep 2>/dev/null -eu awk "$@" sed
+		| export readonly | --verbose printf export cd ${HOME}
+export export 2>/dev/null
+	'quoted text' | test sed test ${HOME}
+		-eu | then "$@" 2>/dev/null /usr/bin 2>/dev/null
+	--verbose "$@" "$@" 2>/dev/null local sed then /usr/bin -eu
+		cd echo grep -eu && $(pwd) x=1 echo awk grep echo && 'quoted text'
+awk printf && 'quoted text' x=1 awk awk awk
+-eu then sed local -eu then "$@" printf grep --verbose
+/usr/bin awk -eu | grep --verbose --verbose echo cd ${HOME} echo
+-eu x=1 sed sed $(pwd) -eu | x=1 done printf /usr/bin -eu 'quoted text' -eu
+| cd printf && readonly
+	--verbose then 'quoted text' done then $(pwd) printf local
+	2>/dev/null printf "$1"
+local cd "$1" 'quoted text' $(pwd) done /usr/bin cd /usr/bin local export
+| /usr/bin 'quoted text' "$@" 2>/dev/null && x=1 "$@" local && && test && awk x=1
+	$(pwd) local "$1" awk grep x=1 echo sed printf local
+grep grep "$1" ${HOME} echo done readonly && test | grep
+	test readonly echo -eu then 'quoted text' test export grep 'quoted text'
+	grep local printf echo grep then
+${HOME} -eu "$1" echo x=1 --verbose
+		done awk x=1 then export 'quoted text' test awk ${HOME} done "$@" x=1 "$1" then
+cd test printf grep | awk echo && done then done --verbose
+'quoted text' "$1" export $(pwd)
+		'quoted text' readonly $(pwd) cd && local echo echo awk
+		| printf echo /usr/bin
+		/usr/bin done done x=1 grep cd readonly x=1 | --verbose
+		done ${HOME} ${HOME} then
+		-eu 'quoted text' then --verbose readonly awk echo
+		x=1 printf sed readonly sed cd echo
+export "$1" test then grep awk done 2>/dev/null 'quoted text' awk
+	${HOME} | "$1" 'quoted text' --verbose cd $(pwd) done cd -eu done local
+	export export test local printf
+	then --verbose printf done -eu local 2>/dev/null then $(pwd)
+sed local awk then && cd "$1" 'quoted text' sed printf && -eu x=1 export
+	| x=1 printf cd export printf "$@" x=1 2>/dev/null echo
+		$(pwd) "$@" "$1" done then cd awk echo --verbose export
+		echo && sed && 2>/dev/null sed test local -eu x=1 local 2>/dev/null
+	done cd ${HOME} -eu && grep export readonly "$@" $(pwd)
+	2>/dev/null x=1 awk grep export printf -eu $(pwd) sed --verbose export done
+"$1" --verbose -eu cd --verbose && local grep | /usr/bin done 2>/dev/null sed
+readonly 'quoted text' /usr/bin "$1" 'quoted text' printf /usr/bin readonly test
+--verbose --verbose then && printf /usr/bin $(pwd)
+	"$@" readonly then then export --verbose awk test printf | ${HOME} x=1 | cd local
+	'quoted text' 'quoted text' "$@" export grep "$@" 'quoted text' -eu sed
+		&& local echo readonly grep 2>/dev/null /usr/bin grep then "$1"
+	$(pwd) $(pwd) x=1 'quoted text' 2>/dev/null export 2>/dev/null
+"$1" local cd "$1" cd cd
+x=1 then readonly then printf sed done readonly $(pwd) "$@" 'quoted text'
+		/usr/bin 2>/dev/null printf | grep test echo 'quoted text' sed export
+		awk /usr/bin export $(pwd) /usr/bin test
+done --verbose 2>/dev/null export /usr/bin |
+	"$1" sed cd printf local "$@" && awk 'quoted text' test x=1 "$@"
+echo --verbose x=1 readonly
+	printf export && 2>/dev/null grep done sed export 2>/dev/null sed
+		&& "$1" printf export $(pwd) awk x=1
+	grep 'quoted text' printf 'quoted text' $(pwd) printf -eu test readonly
+		test | grep /usr/bin && --verbose x=1 'quoted text' grep
+$(pwd) && /usr/bin /usr/bin | "$1" awk readonly
+		done "$@" | 'quoted text' test cd local echo
+	echo echo --verbose grep "$@" printf x=1 test sed then 2>/dev/null ${HOME}
+printf "$@" && readonly readonly
+		export done ${HOME} 2>/dev/null cd 2>/dev/null 'quoted text'
+local "$@" echo --verbose test
+		local -eu -eu 'quoted text'
+		'quoted text' "$@" awk x=1 $(pwd) then "$1" $(pwd) -eu printf
+		/usr/bin printf "$1" /usr/bin printf | $(pwd)
+	$(pwd) printf readonly then export grep
+	x=1 export x=1 && readonly local -eu
+"$@" --verbose x=1 | x=1 printf grep "$@" ${HOME} --verbose -eu 2>/dev/null
+	sed done x=1 local grep
+	/usr/bin done | "$1" --verbose && x=1 echo awk readonly "$1" printf
+'quoted text' awk done printf ${HOME}
+		echo readonly then 'quoted text' -eu x=1 test cd -eu export 'quoted text'
+	cd "$1" test "$@" 'quoted text' test -eu export sed local
+		grep done then local cd "$1" awk done sed x=1 sed readonly &&
+	printf cd "$@" cd | -eu readonly
+"$@" grep -eu awk ${HOME} 2>/dev/null
+	--verbose "$@" -eu sed "$@" awk sed awk -eu x=1 echo | "$@" /usr/bin
+	readonly $(pwd) 'quoted text' -eu sed then cd readonly | local printf -eu
+		"$@" then $(pwd) 2>/dev/null x=1 local && /usr/bin
+		x=1 | "$@" awk | grep &&
+/usr/bin local ${HOME} grep 2>/dev/null cd cd echo /usr/bin
+	cd 2>/dev/null "$1" -eu
+		/usr/bin x=1 /usr/bin ${HOME} 'quoted text' 2>/dev/null
+	"$@" done /usr/bin test --verbose "$@" 'quoted text'
+/usr/bin | readonly 2>/dev/null
+		done done readonly ${HOME} 2>/dev/null test local then && local awk sed 2>/dev/null
+	echo | readonly "$1" then export && "$1" local
+		| $(pwd) printf printf awk readonly cd export 'quoted text'
+	${HOME} /usr/bin then /usr/bin
+		&& cd && awk echo $(pwd) done local -eu ${HOME} | local
+		${HOME} test readonly printf
+	2>/dev/null export $(pwd) printf readonly
+then echo "$1" -eu done && "$@" done done local -eu sed
+&& done printf 2>/dev/null echo $(pwd) grep "$1" | cd readonly
+		grep printf cd -eu ${HOME} echo readonly cd
+	readonly $(pwd) local 2>/dev/null && then sed then -eu
+&& grep cd test cd test local echo awk 'quoted text'
+		awk cd sed "$@" echo -eu x=1
+local x=1 test readonly x=1 $(pwd)
+		| echo then printf "$@" 'quoted text'
+	then /usr/bin cd done "$1" /usr/bin sed awk then cd &&
+	"$@" && test /usr/bin then cd | "$@" --verbose
+	export --verbose awk --verbose local x=1 printf awk local echo echo
+	test printf readonly ${HOME} done local x=1 readonly $(pwd) readonly done printf
+&& grep echo sed done $(pwd) export | cd grep 'quoted text'
+/usr/bin 'quoted text' ${HOME} echo export test done && 'quoted text' 'quoted text'
+		"$@" printf "$1" "$@" ${HOME} grep export then export /usr/bin
+	echo then | export cd cd -eu done "$@" done 'quoted text'
+	echo --verbose && /usr/bin | then /usr/bin
+awk echo 2>/dev/null awk --verbose sed awk sed test /usr/bin /usr/bin
+grep grep "$1" sed $(pwd) /usr/bin test test ${HOME} readonly sed
+echo printf done printf x=1 local echo done /usr/bin "$1" -eu --verbose
+'quoted text' "$1" 2>/dev/null
+	"$1" sed done local -eu test local readonly then
+		2>/dev/null x=1 echo | readonly export echo | sed then printf
+	awk then sed ${HOME} readonly export readonly
+export --verbose ${HOME} --verbose | ${HOME}
+	sed $(pwd) awk --verbose ${HOME} 'quoted text'
+	readonly -eu cd x=1 cd --verbose 2>/dev/null | -eu -eu
+	awk sed && cd readonly -eu export then -eu | printf $(pwd) local printf
+	-eu && awk --verbose local export x=1
+export test sed printf then "$@" test 'quoted text' x=1
+		"$@" x=1 awk grep /usr/bin -eu /usr/bin grep 'quoted text'
+'quoted text' readonly done echo printf echo | sed readonly echo sed 'quoted text'
+		done export | "$@" test local /usr/bin then /usr/bin $(pwd) readonly
+	done && local sed -eu x=1 | echo | test x=1 then local test /usr/bin 2>/dev/null
+		x=1 x=1 ${HOME} -eu readonly "$1" test printf
+	sed | x=1 /usr/bin sed | export && printf printf --verbose "$@" sed sed
+		${HOME} $(pwd) --verbose sed $(pwd) readonly 2>/dev/null 2>/dev/null readonly then
+		"$@" done echo $(pwd) "$@" printf grep 'quoted text' | ${HOME} printf | then
+		$(pwd) "$@" then -eu cd ${HOME} awk test /usr/bin --verbose
+	"$@" echo printf x=1 x=1 cd grep /usr/bin --verbose
+	export printf test printf export awk ${HOME} readonly
+export x=1 cd readonly "$@" export --verbose --verbose 'quoted text'
+		test then x=1 /usr/bin printf "$@" printf cd test grep 'quoted text'
+$(pwd) "$@" && ${HOME} test cd done printf grep awk cd x=1 | -eu
+	echo | cd export 'quoted text' $(pwd) && grep printf ${HOME}
+		&& then 'quoted text' cd
+		awk | sed cd cd test x=1 export 2>/dev/null --verbose test grep
+		--verbose -eu export cd grep
+/usr/bin test | $(pwd)
+		"$@" done /usr/bin 2>/dev/null
+$(pwd) --verbose 2>/dev/null ${HOME} export
+	| readonly test "$@" local x=1 && grep "$1" ${HOME} sed
+		local grep echo --verbose
+"$@" x=1 readonly "$1" 'quoted text' && --verbose readonly test done && 2>/dev/null
+		"$1" && && sed && /usr/bin --verbose then $(pwd) echo sed --verbose echo
+awk $(pwd) grep then export && awk && awk -eu
+		awk "$1" readonly x=1 readonly 2>/dev/null -eu echo
+"$@" x=1 sed test sed readonly printf local "$1" cd x=1 awk 'quoted text'
+		awk -eu $(pwd) sed echo sed /usr/bin x=1 printf 'quoted text'
+		$(pwd) && test cd printf done readonly
+		&& test --verbose local readonly "$1" grep echo cd sed x=1 $(pwd)
+		${HOME} test local printf
+grep done test printf local x=1 -eu && --verbose cd printf test
+	${HOME} export export --verbose sed done printf
+	&& awk $(pwd) -eu sed 2>/dev/null "$1" printf x=1
+		2>/dev/null /usr/bin done x=1 "$1" export -eu local
+test test sed printf then readonly done $(pwd)
+test export && sed --verbose "$@" awk export readonly done printf cd echo
+		awk | 2>/dev/null ${HOME} $(pwd) && /usr/bin
+| | test | $(pwd) cd done awk export
+	"$@" 2>/dev/null 2>/dev/null $(pwd)
+	cd $(pwd) grep "$1" --verbose sed echo x=1 test export
+-eu | ${HOME} export "$@" cd --verbose "$@" readonly | printf awk
+		readonly | $(pwd) local awk && awk ${HOME} -eu grep ${HOME} local
+	printf test done awk grep "$1" "$1" "$1" printf done sed printf cd 2>/dev/null
+"$1" awk /usr/bin cd "$1" ${HOME} /usr/bin "$@" cd export 2>/dev/null
+	"$@" printf printf printf ${HOME} awk $(pwd) x=1 'quoted text' done
+	export x=1 /usr/bin test awk $(pwd) local && export
+		export && | grep test test printf
+	/usr/bin -eu local export /usr/bin then test
+		local test --verbose --verbose
+		$(pwd) | readonly export -eu sed ${HOME} --verbose x=1 ${HOME} local awk -eu
+	"$@" test ${HOME} grep x=1 --verbose sed | $(pwd)
+	&& local printf grep "$@" -eu export test export cd --verbose -eu
+	readonly -eu test "$1"
+	| test readonly -eu readonly then
+2>/dev/null --verbose readonly
+		export $(pwd) && 'quoted text' | | cd "$@" printf echo --verbose sed readonly
+	2>/dev/null "$1" readonly done sed export "$1" awk grep printf | export
+then grep && "$@" 'quoted text'
+--verbose local export ${HOME} awk $(pwd) export printf readonly
+echo | "$1" ${HOME} "$@" then done
+	2>/dev/null --verbose --verbose readonly x=1 cd then
+"$@" ${HOME} then local -eu x=1 -eu
+--verbose echo done echo grep cd done
+readonly grep printf echo
+		export "$@" cd grep /usr/bin
+	${HOME} awk grep && cd /usr/bin "$1" x=1 $(pwd) /usr/bin "$1"
+-eu awk && then 'quoted text' ${HOME} && awk x=1
+		printf done local test sed local local x=1 -eu awk && $(pwd) /usr/bin
+x=1 test cd sed && | test export done
+	x=1 ${HOME} test export x=1 $(pwd) export then /usr/bin
+	echo export ${HOME} /usr/bin $(pwd) printf readonly then | grep | $(pwd)
+		${HOME} "$1" awk awk && x=1 printf grep cd 'quoted text' test "$1"
+sed awk "$1" then grep 2>/dev/null local test readonly local
+"$1" "$1" && awk --verbose ${HOME}
+	"$@" /usr/bin "$1" 'quoted text' 'quoted text' "$1"
+		awk then | test x=1 "$1" ${HOME} | cd "$@" /usr/bin /usr/bin local readonly
+		--verbose awk echo echo echo $(pwd) done "$@" grep 'quoted text' cd export
+		| cd printf $(pwd) /usr/bin 2>/dev/null export x=1 done local "$1" -eu ${HOME}
+	sed && "$1" test test local done
+		export x=1 && cd ${HOME} 'quoted text' 'quoted text' done done local ${HOME}
+		local sed then 'quoted text' ${HOME} then test
+		export printf local && printf ${HOME}
+	grep printf "$1" cd readonly 2>/dev/null x=1 "$1"
+readonly readonly $(pwd) awk /usr/bin "$@" done echo
+	$(pwd) done 2>/dev/null export cd x=1 cd "$@" "$@" 'quoted text'
+	local "$1" readonly printf awk awk --verbose 2>/dev/null awk -eu -eu "$@" 'quoted text'
+		then sed grep 2>/dev/null grep --verbose export ${HOME} | 2>/dev/null
+done /usr/bin then done ${HOME} x=1 export /usr/bin export export local
+	local grep sed 2>/dev/null
+		${HOME} printf grep "$@" --verbose ${HOME} grep then test test
+		cd then ${HOME} local awk $(pwd) "$1" grep "$@" x=1 "$1" /usr/bin
+local 'quoted text' ${HOME} "$1"
+echo export readonly done then grep grep
+		&& readonly test done echo
+&& $(pwd) x=1 printf && grep echo test && /usr/bin cd printf echo export readonly
+	/usr/bin 'quoted text' grep $(pwd) export | done
+awk awk grep 'quoted text' 2>/dev/null x=1 local awk
+		&& -eu && cd local | "$@"
+/usr/bin $(pwd) x=1 /usr/bin then x=1 printf
+grep grep export cd then printf "$1" test 2>/dev/null cd sed && /usr/bin
+		printf -eu echo cd "$1"
+done --verbose readonly readonly && "$@" then then local
+	export $(pwd) 'quoted text' echo
+		sed 2>/dev/null /usr/bin /usr/bin "$1" "$1" done echo readonly
+	local --verbose cd test export
+	"$1" then -eu cd "$1" local 'quoted text' /usr/bin printf
+"$1" test && $(pwd) then "$1" && awk grep then
+${HOME} "$1" test 2>/dev/null --verbose awk echo printf grep "$@" && local printf
+	export sed awk test x=1 2>/dev/null grep x=1 printf awk x=1
+/usr/bin $(pwd) "$1" readonly readonly "$@" grep ${HOME} echo grep
+		-eu 2>/dev/null $(pwd) "$1" grep && -eu readonly /usr/bin |
+		sed ${HOME} && $(pwd) --verbose && 2>/dev/null "$1"
+	cd $(pwd) $(pwd) awk | sed 'quoted text'
+	'quoted text' local ${HOME} then cd ${HOME} ${HOME}
+		2>/dev/null then done done |
+cd /usr/bin done done grep "$1" done -eu 'quoted text' sed done --verbose export
+		/usr/bin -eu 2>/dev/null echo sed 'quoted text'
+	$(pwd) readonly local --verbose
+		/usr/bin | 2>/dev/null echo "$1" ${HOME} awk x=1 readonly cd done
+"$@" export done x=1 -eu -eu printf cd --verbose test echo ${HOME}
+readonly x=1 && export test local /usr/bin $(pwd) grep local x=1 'quoted text'
+	test awk ${HOME} /usr/bin cd "$@" done done 2>/dev/null test
+--verbose --verbose sed done --verbose "$1" | 2>/dev/null
+		| && readonly $(pwd) && $(pwd) 'quoted text' x=1 sed
+	| "$1" grep 'quoted text' readonly 'quoted text' test | /usr/bin "$@"
+${HOME} "$1" $(pwd) ${HOME} 2>/dev/null then "$1" sed printf | | then echo sed
+${HOME} readonly test test printf
+printf grep x=1 "$1" done readonly done awk 'quoted text' | "$@" echo
+	/usr/bin awk test ${HOME} cd ${HOME} && readonly
+sed x=1 && && --verbose 2>/dev/null
+	"$1" readonly --verbose export grep /usr/bin
+	$(pwd) 2>/dev/null cd readonly export /usr/bin 2>/dev/null
+		'quoted text' done "$@" echo awk "$@" echo cd then echo "$@" echo export x=1 printf
+		test cd local awk /usr/bin 2>/dev/null && readonly printf
+	&& "$1" 'quoted text' /usr/bin awk
+'quoted text' readonly sed
+printf "$1" readonly $(pwd) | cd local grep local echo then 2>/dev/null
+--verbose "$1" export 2>/dev/null "$@" "$1" "$1"
+		awk export awk sed cd && local x=1 readonly sed printf local printf
+	${HOME} printf export -eu --verbose ${HOME} grep done 'quoted text' | $(pwd) local
+	${HOME} echo --verbose 2>/dev/null x=1 test
+--verbose echo ${HOME} "$@" awk $(pwd) then awk done grep
+	then printf echo /usr/bin echo export printf
+		then -eu printf awk -eu 'quoted text'
+	awk sed -eu x=1 done --verbose local -eu ${HOME} echo grep -eu /usr/bin
+		echo /usr/bin awk printf $(pwd) 2>/dev/null
+	$(pwd) cd export cd local $(pwd) awk then &&
+	"$1" then | then export awk grep --verbose
+		x=1 --verbose test ${HOME} echo --verbose |
+-eu ${HOME} 'quoted text' export
+	"$1" grep "$@" done export test sed cd --verbose -eu echo sed --verbose x=1 done
+${HOME} $(pwd) cd 'quoted text' done
+	"$@" readonly --verbose "$1" 'quoted text' ${HOME} export local export
+#include c244.sh
+		readonly && "$1" 2>/dev/null -eu
+	then ${HOME} $(pwd) 2>/dev/null ${HOME} local echo then readonly -eu awk done then
+	then ${HOME} | echo export grep 'quoted text' "$@" then sed local printf
+	x=1 export $(pwd) test -eu "$@" test grep export /usr/bin cd 2>/dev/null && done
+		local cd 2>/dev/null 2>/dev/null $(pwd)
+	done test ${HOME} | test test && sed 'quoted text'
+--verbose | echo local printf && 'quoted text'
+		--verbose local sed sed "$@" test sed sed && "$1" "$1" | echo echo --verbose
+"$@" /usr/bin then && readonly echo -eu --verbose | test cd | echo "$@" 2>/dev/null
+	| printf echo then 'quoted text' awk grep sed export | "$@"
+		'quoted text' test && -eu
+	printf export cd "$1" "$1" printf ${HOME}
+		readonly grep echo 2>/dev/null readonly readonly 'quoted text' x=1 ${HOME}
+		then local 'quoted text' -eu test
+${HOME} awk 'quoted text'
+		| && done local && printf echo
+		--verbose | "$@" "$@" export
+2>/dev/null | && cd 2>/dev/null ${HOME} sed done local
+		2>/dev/null local local --verbose
+	2>/dev/null -eu 2>/dev/null "$@"
+test "$1" --verbose "$@" grep cd grep sed done "$@" | | $(pwd)
+	&& 'quoted text' sed 'quoted text' local readonly
+		grep "$1" "$@" | readonly test "$1" echo awk "$1" done x=1 export --verbose
+grep /usr/bin $(pwd) "$1" readonly test printf "$@" x=1 && export grep readonly
+		grep grep then 2>/dev/null
+${HOME} ${HOME} readonly 'quoted text'
+		cd readonly && 'quoted text' -eu readonly
+-eu $(pwd) printf test --verbose
+local -eu $(pwd) awk --verbose /usr/bin cd awk awk printf /usr/bin done sed
+	'quoted text' 2>/dev/null
+echo then done -eu echo 'quoted text'
+	export cd ${HOME} readonly export -eu 2>/dev/null 2>/dev/null cd 2>/dev/null test
+local "$@" cd echo cd done export printf
+		--verbose /usr/bin -eu then done test
+		${HOME} | done done export printf printf /usr/bin readonly
+		awk export ${HOME} test 'quoted text' --verbose ${HOME} "$1" done ${HOME} awk
+	"$1" awk printf then test $(pwd) done --verbose 2>/dev/null
+		awk /usr/bin local 'quoted text' && $(pwd) printf grep printf export
+	&& cd -eu $(pwd) "$1"
+		cd "$@" x=1 /usr/bin sed --verbose && test then test
+		x=1 awk sed $(pwd) --verbose x=1 grep local local --verbose
+/usr/bin awk $(pwd) done x=1 test 2>/dev/null done done awk 'quoted text'
+	done cd printf 'quoted text' echo readonly "$@" done cd | readonly $(pwd)
+	readonly grep "$@" export | && -eu x=1 sed readonly
+"$@" done local ${HOME} && test 2>/dev/null
+	--verbose cd test ${HOME} "$@" then x=1 "$1" 2>/dev/null 'quoted text' then
+	test sed ${HOME} grep ${HOME} x=1 -eu
+"$1" -eu readonly && grep local 'quoted text' ${HOME} ${HOME} local --verbose
+	2>/dev/null --verbose "$1" "$@" done "$@" grep "$@" done
+	then export | then sed --verbose
+	then cd readonly $(pwd) test "$1" --verbose | ${HOME} "$1" --verbose echo cd
+		printf echo $(pwd) cd readonly export awk && "$@" 'quoted text'
+		$(pwd) echo ${HOME} done && then grep $(pwd) x=1 cd
+		2>/dev/null | "$@" 2>/dev/null
+echo /usr/bin "$@" x=1 printf --verbose --verbose "$@" $(pwd)
+		test $(pwd) done $(pwd) -eu printf
+"$1" "$1" then echo awk grep "$1" -eu
+printf "$@" x=1 'quoted text' $(pwd) grep sed /usr/bin cd export
+| && ${HOME} readonly "$@" "$@" local printf 'quoted text' && "$@"
+	sed x=1 test local awk "$1" export ${HOME} then test 2>/dev/null "$1" done
+		--verbose "$@" export "$1" 'quoted text' --verbose
+		export then "$@" test
+	sed printf ${HOME} 'quoted text' readonly
+	"$@" 2>/dev/null ${HOME} | x=1 cd cd x=1
+	/usr/bin ${HOME} sed done 2>/dev/null --verbose then sed echo then then "$1"
+	| then printf -eu local 'quoted text' "$@" grep sed
+	readonly sed -eu ${HOME} "$1" 2>/dev/null 2>/dev/null awk --verbose test
+	cd then && echo then done
+	2>/dev/null /usr/bin sed x=1 local then /usr/bin --verbose "$1" | && printf
+test "$@" "$@" local grep local sed echo "$1" echo done awk
+awk test 'quoted text' --verbose sed | echo done readonly ${HOME}
+		echo local awk --verbose && cd ${HOME}
+	| ${HOME} | sed "$@" | /usr/bin test readonly printf grep echo
+local 2>/dev/null x=1 grep -eu test
+		| 2>/dev/null "$1" awk $(pwd) 2>/dev/null done --verbose "$@" "$@" local --verbose
+		done grep sed ${HOME} readonly /usr/bin x=1 cd | then 'quoted text'
+		/usr/bin test /usr/bin grep then grep awk
+		'quoted text' $(pwd) "$@"
+done x=1 --verbose readonly 'quoted text' printf sed 2>/dev/null
+--verbose "$@" readonly test && 'quoted text' test x=1 local x=1 $(pwd) 'quoted text'
+	export 2>/dev/null printf readonly grep
+awk -eu x=1 --verbose echo export cd 'quoted text' "$@" echo | then echo awk
+		awk local export test ${HOME} done x=1 x=1 'quoted text' export
+	x=1 --verbose cd ${HOME} | $(pwd)
+		--verbose -eu ${HOME} /usr/bin local
+		/usr/bin printf printf | /usr/bin x=1 ${HOME}
+	/usr/bin | cd then "$@" --verbose --verbose then cd --verbose sed printf
+		| done $(pwd) 2>/dev/null sed sed grep echo local export local ${HOME}
+		then 'quoted text' x=1 2>/dev/null /usr/bin -eu $(pwd) then export awk echo 'quoted text'
+		x=1 $(pwd) ${HOME} cd | ${HOME}
+	| /usr/bin --verbose -eu
+done awk grep echo --verbose ${HOME} grep
+	printf grep x=1 then /usr/bin readonly
+	${HOME} "$1" done cd local readonly --verbose test
+	printf done 2>/dev/null awk ${HOME} local 'quoted text' printf x=1 && sed sed local
+		sed grep test && readonly | printf printf cd then awk done then
+2>/dev/null "$1" local -eu then && /usr/bin && x=1 done export export test test
+local 'quoted text' local /usr/bin local -eu local printf x=1 x=1 'quoted text'
+		sed grep local ${HOME} "$@" export echo --verbose
+	/usr/bin 'quoted text'
+readonly "$@" echo readonly
+sed done printf "$@" printf "$@" then 'quoted text' sed ${HOME} awk
+		| sed awk "$1" then then && export
+	/usr/bin sed done /usr/bin grep then 2>/dev/null awk test then echo
+		cd -eu export "$1" then
+'quoted text' printf export echo "$1" $(pwd) grep readonly
+	export sed export "$@" ${HOME} grep echo -eu | printf "$@"
+--verbose && test done readonly local export then /usr/bin "$1" cd 'quoted text'
+		done sed sed --verbose done && export $(pwd) printf && test /usr/bin local
+		test ${HOME} --verbose export && local -eu | "$1" test sed /usr/bin
+	grep then 2>/dev/null local echo -eu done "$@" -eu test export export awk
+	'quoted text' /usr/bin cd test grep
+	printf --verbose readonly export export 2>/dev/null && then x=1 echo --verbose
+readonly echo && "$1" then awk ${HOME} done --verbose 2>/dev/null -eu | x=1
+		test 'quoted text' grep local awk "$@" 2>/dev/null awk
+	2>/dev/null "$@" /usr/bin test cd x=1 test echo $(pwd)
+		sed | -eu local readonly grep "$1" --verbose sed 'quoted text'
+	"$1" "$@" export printf "$1" 2>/dev/null done test ${HOME} "$@" then --verbose
+	$(pwd) 2>/dev/null local awk cd "$@" done | cd 2>/dev/null
+grep sed --verbose export done 2>/dev/null "$1" "$1" sed $(pwd)
+	| sed | x=1 sed ${HOME} /usr/bin
+		x=1 -eu done 2>/dev/null readonly sed | /usr/bin sed $(pwd) then $(pwd)
+		'quoted text' --verbose local awk cd readonly
+	-eu local echo --verbose
+		export -eu then sed grep && --verbose
+awk awk | "$@" 2>/dev/null export
+	awk -eu 'quoted text' ${HOME}
+	&& cd ${HOME} | grep "$1" 2>/dev/null export 'quoted text' export 'quoted text'
+	'quoted text' local cd printf | export done "$1" --verbose "$@" --verbose
+	&& printf cd grep "$1" awk awk sed local test -eu ${HOME}
+	| $(pwd) done grep x=1 awk $(pwd) readonly | then printf
+$(pwd) then awk grep "$1" readonly x=1 -eu awk "$1" echo
+done awk x=1 && sed | "$1" | $(pwd) test echo -eu
+		printf | /usr/bin then && awk 'quoted text'
+	then $(pwd) /usr/bin && "$1" --verbose x=1 "$1" then grep
+		awk "$@" then export "$@" done -eu
+		echo 2>/dev/null done
+x=1 sed done cd ${HOME} "$1" cd x=1 && x=1 cd /usr/bin echo awk
+local /usr/bin 'quoted text' $(pwd) "$1" export
+	done test export 2>/dev/null x=1 local 'quoted text' | sed ${HOME}
+		printf -eu 2>/dev/null | | echo test done done /usr/bin | awk
+		${HOME} awk cd done 'quoted text'
+	export ${HOME} awk $(pwd) export
+$(pwd) sed sed printf --verbose 2>/dev/null --verbose
+	printf $(pwd) cd ${HOME} "$@" && -eu then ${HOME} $(pwd) "$1"
+/usr/bin readonly x=1 --verbose readonly -eu
+		done then cd 2>/dev/null "$1" sed 2>/dev/null "$1"
+test then echo "$@" grep export | export
+printf ${HOME} | && ${HOME} -eu test awk test awk -eu --verbose awk |
+"$@" sed done -eu /usr/bin x=1 "$@" --verbose
+		readonly local $(pwd) | then
+		| export | local ${HOME} --verbose printf "$1" 2>/dev/null && echo
+x=1 "$1" printf grep printf ${HOME} | "$1" 'quoted text' cd -eu /usr/bin
+	cd test printf "$@" "$1" "$@" awk --verbose
+		/usr/bin cd readonly export readonly "$@" readonly cd
+		"$1" --verbose "$1" 2>/dev/null echo /usr/bin ${HOME}
+		"$1" readonly then --verbose /usr/bin
+		awk | | ${HOME} --verbose && -eu "$1" local ${HOME} test && awk readonly /usr/bin
+	cd /usr/bin awk --verbose sed awk cd export "$@" $(pwd) /usr/bin sed x=1
+	-eu ${HOME} /usr/bin local
+		x=1 2>/dev/null local && --verbose grep 2>/dev/null
+		cd cd sed then 'quoted text' $(pwd)
+-eu && -eu printf && /usr/bin grep done 'quoted text'
+		sed done "$@" -eu $(pwd) 'quoted text' |
+export 2>/dev/null 'quoted text'
+	awk test then $(pwd) ${HOME}
+		-eu x=1 done $(pwd) printf then then /usr/bin && export cd
+	grep sed cd printf then "$@" 'quoted text' cd
+		--verbose ${HOME} /usr/bin 'quoted text' printf
+done export $(pwd) test &&
+/usr/bin && export $(pwd) cd
+	"$1" 2>/dev/null echo cd echo x=1 then then awk sed printf | printf local
+sed then | $(pwd) printf 2>/dev/null /usr/bin readonly --verbose
+	sed x=1 local grep "$@" x=1 | local "$@" | test "$@" printf $(pwd) awk 'quoted text'
+	/usr/bin test 2>/dev/null test grep "$1" export ${HOME}
+		"$@" "$1" sed grep then $(pwd) echo
+		${HOME} printf awk local readonly cd local 2>/dev/null 2>/dev/null
+	test 'quoted text' echo then grep 'quoted text' then echo
+echo "$@" test "$1" export done --verbose grep export x=1 | x=1 local
+		echo echo 'quoted text' sed awk echo | /usr/bin
+grep then "$@" --verbose test then local cd sed awk then && -eu cd
+${HOME} "$@" 'quoted text' printf
+		${HOME} "$@" export | awk x=1 "$1" cd sed cd
+	$(pwd) done done $(pwd) echo --verbose ${HOME} cd ${HOME} echo
+		awk cd --verbose sed then "$1"
+		grep awk /usr/bin ${HOME} readonly done cd sed export sed --verbose -eu -eu "$@"
+		echo --verbose grep 2>/dev/null
+		'quoted text' readonly export echo grep |
+		${HOME} awk /usr/bin awk cd done "$1" | printf then /usr/bin "$@" export echo
+/usr/bin && x=1 echo 'quoted text' ${HOME} $(pwd) x=1 -eu 2>/dev/null
+-eu test ${HOME} ${HOME} grep 2>/dev/null -eu local ${HOME} $(pwd) readonly
+		&& "$@" 2>/dev/null "$@" ${HOME} done echo
+-eu export && printf echo "$1" cd
+		$(pwd) "$@" -eu done "$@" && /usr/bin
+	| printf 'quoted text' awk && awk printf export "$1" /usr/bin
+		done grep | | 2>/dev/null local sed "$@" $(pwd) test sed echo "$1"
+x=1 --verbose 2>/dev/null echo readonly && 2>/dev/null $(pwd) local
+	then echo | printf export done ${HOME} echo export --verbose echo
+	awk 'quoted text' "$1" sed ${HOME} grep done
+2>/dev/null -eu ${HOME}
+grep cd echo local echo local readonly local /usr/bin readonly
+		x=1 readonly 'quoted text' cd "$1" sed cd | printf done "$@" "$1" 2>/dev/null
+	-eu /usr/bin 'quoted text' /usr/bin
+"$1" | --verbose done test $(pwd) --verbose 2>/dev/null export
+		-eu done $(pwd) x=1 export sed awk export readonly awk
+awk 'quoted text' /usr/bin printf awk "$1" "$1" test /usr/bin
+	cd cd export sed export readonly
+'quoted text' $(pwd) --verbose export /usr/bin x=1 sed echo
+		${HOME} $(pwd) readonly
+		"$1" printf --verbose $(pwd) ${HOME} test x=1 cd 2>/dev/null
+/usr/bin echo awk cd export echo echo -eu 2>/dev/null echo grep | "$1" echo grep
+	x=1 cd cd awk -eu "$1" $(pwd) printf export --verbose done local $(pwd) -eu
+export echo grep export && x=1 -eu test x=1 printf echo
+	grep echo 2>/dev/null cd export
+"$@" "$@" then export readonly cd -eu --verbose grep test readonly "$1" readonly
+	"$@" grep -eu export grep awk ${HOME} readonly | awk --verbose
+		echo done test local "$1" readonly ${HOME}
+		test -eu cd && printf export echo printf | readonly x=1 cd -eu 'quoted text'
+		echo awk && then echo printf && "$@" test -eu 2>/dev/null
+		readonly "$1" sed echo printf then export then
+		awk $(pwd) 2>/dev/null x=1 echo cd cd
+test awk ${HOME} /usr/bin && "$1" done --verbose
+export local && "$@" -eu
+	2>/dev/null grep grep echo printf then test --verbose printf $(pwd) cd "$1" awk
+	readonly export /usr/bin 2>/dev/null readonly echo 'quoted text' export
+| --verbose test 'quoted text'
+	"$@" sed cd "$@" sed export sed then -eu done -eu x=1 cd local
+	cd sed | && echo $(pwd) grep then 'quoted text' x=1
+	sed sed "$1" "$1" export && --verbose test -eu awk "$@" $(pwd) x=1 awk ${HOME}
+${HOME} done "$1" 'quoted text' grep
+		'quoted text' export 2>/dev/null &&
+	then 2>/dev/null export test
+		local | printf sed | sed then printf $(pwd) test && export 'quoted text'
+		'quoted text' /usr/bin -eu export printf
+	sed --verbose && 'quoted text' then cd awk done
+| printf grep "$1" done
+		awk readonly && /usr/bin printf grep readonly export then readonly
+		done echo && done ${HOME} ${HOME} then -eu
+'quoted text' "$1" "$1" $(pwd) awk x=1 done "$1" done sed grep
+	awk | 'quoted text' 'quoted text' -eu x=1 awk --verbose
+		grep done "$@" -eu test sed --verbose
+then /usr/bin x=1 $(pwd) awk "$1" && echo /usr/bin
+		--verbose grep --verbose "$@" cd echo 'quoted text' cd export test x=1 -eu
+	awk $(pwd) echo grep grep test
+		-eu /usr/bin x=1 --verbose export
+		local /usr/bin test awk $(pwd) $(pwd) export 'quoted text'
+		printf cd /usr/bin cd cd grep echo local done
+echo echo grep done sed echo printf done cd -eu export
+		local done --verbose && then done
+		$(pwd) /usr/bin sed -eu done ${HOME} | readonly
+	$(pwd) test /usr/bin sed /usr/bin printf
+		${HOME} printf 'quoted text'
+	| printf && /usr/bin
+readonly then test awk then x=1 && then &&
+	local printf "$1" readonly "$@" printf && 2>/dev/null
+		then printf awk sed 2>/dev/null -eu test && grep $(pwd) done ${HOME}
+done "$1" && then awk test | 2>/dev/null
+then done echo -eu 2>/dev/null cd "$@" readonly /usr/bin then
+		"$1" cd then grep echo test "$1" echo && awk readonly -eu
+		printf printf export "$1" /usr/bin done x=1 readonly ${HOME} grep
+		"$@" 'quoted text' done done grep 2>/dev/null printf -eu cd 'quoted text'
+2>/dev/null --verbose && readonly | x=1 "$1" printf && readonly
+	&& sed cd $(pwd) && grep readonly x=1 $(pwd) --verbose /usr/bin grep ${HOME} $(pwd)
+x=1 -eu "$1" $(pwd) local $(pwd) readonly sed sed cd
+		| 2>/dev/null then sed 'quoted text' /usr/bin echo done local grep /usr/bin && readonly
+	$(pwd) -eu test 2>/dev/null readonly grep export $(pwd)
+x=1 /usr/bin | ${HOME} readonly grep
+	printf 2>/dev/null local then sed done cd | readonly awk $(pwd) "$1" --verbose
+		"$1" then x=1 then grep readonly $(pwd) awk then cd done export readonly
+	'quoted text' "$@" then "$@" printf awk cd "$@" local awk then export readonly
+grep | $(pwd) "$@" /usr/bin
+	2>/dev/null echo printf x=1 export echo grep
+	"$@" /usr/bin sed then ${HOME} 'quoted text' --verbose 'quoted text' | sed --verbose
+| sed 'quoted text' && $(pwd) test 2>/dev/null
+"$1" done test --verbose
+"$1" export local grep "$@" -eu
+		test done then 'quoted text' x=1 &&
+done $(pwd) --verbose awk readonly 'quoted text' $(pwd)
+	"$1" -eu grep 2>/dev/null | local ${HOME} awk echo 'quoted text' "$1"
+	awk | readonly 2>/dev/null "$1" &&
+readonly readonly grep echo
+echo && awk x=1 "$1" && && printf && test $(pwd) export /usr/bin "$@" x=1 | grep
+local x=1 "$@" $(pwd) "$@" x=1 "$@" export 2>/dev/null --verbose "$1" 'quoted text'
+		"$1" "$1" ${HOME} "$1" ${HOME} test
+		printf grep local --verbose sed "$@" echo cd awk then
+&& -eu /usr/bin -eu 2>/dev/null --verbose awk cd export printf printf
+		$(pwd) local 2>/dev/null | sed readonly
+sed x=1 2>/dev/null /usr/bin readonly
+		--verbose grep then --verbose test echo export "$@" test then $(pwd) x=1 echo
+	-eu awk "$1" 'quoted text' && x=1 printf /usr/bin
+	local done "$1" sed grep cd $(pwd) | 'quoted text'
+	readonly test /usr/bin -eu then cd /usr/bin sed "$1" awk then --verbose |
+	${HOME} local ${HOME} "$1" readonly readonly
+	x=1 local "$1" /usr/bin "$1" echo ${HOME}
+done "$1" done cd --verbose 'quoted text' 2>/dev/null 'quoted text'
+		test readonly done awk -eu
+${HOME} printf "$1" --verbose
+local | sed x=1 export then export 'quoted text'
+	export readonly | --verbose readonly "$@"
+x=1 | export sed test --verbose grep sed
+		test "$1" echo | export done x=1 && test --verbose "$@" -eu then
+test grep readonly 2>/dev/null
+	local readonly then local done test echo 2>/dev/null
+| $(pwd) -eu "$1" -eu x=1 --verbose | printf
+	then ${HOME} readonly printf cd readonly then awk ${HOME} cd
+	cd then awk "$@" 2>/dev/null --verbose test
+then readonly "$1" 'quoted text' 2>/dev/null --verbose ${HOME} /usr/bin
+		printf cd grep ${HOME} x=1 "$1" readonly
+--verbose awk $(pwd) -eu test 2>/dev/null "$@" 'quoted text' "$@"
+| local done && 2>/dev/null sed /usr/bin printf export done /usr/bin
+	then grep -eu && cd "$@" -eu ${HOME} "$@" export then local "$1" -eu "$1"
+"$@" test | --verbose sed export printf "$1" 'quoted text' ${HOME} |
+	'quoted text' sed x=1 test x=1 export echo
+&& 'quoted text' --verbose 'quoted text' | $(pwd) && ${HOME} sed 2>/dev/null
+then then sed sed --verbose
+	| --verbose local echo "$1" then "$1" /usr/bin ${HOME} && sed "$@" sed done ${HOME}
+	local printf /usr/bin ${HOME}
+	$(pwd) "$1" awk && && done | export /usr/bin test /usr/bin 'quoted text'
+	done local $(pwd) local "$1" "$1" then
+		'quoted text' then -eu printf 'quoted text' 'quoted text' && /usr/bin --verbose
+	'quoted text' /usr/bin then sed readonly local 2>/dev/null
+	cd grep -eu echo export 'quoted text' printf echo cd x=1 && done printf
+	sed then sed "$@" test sed echo readonly 2>/dev/null x=1
+${HOME} local echo printf && printf ${HOME} grep local sed printf
+grep then test "$1" test --verbose sed -eu 'quoted text'
+&& && export | -eu then
+/usr/bin 'quoted text' $(pwd) awk && printf export awk awk then /usr/bin local
+2>/dev/null $(pwd) $(pwd) echo printf $(pwd) cd echo --verbose
+		"$1" -eu x=1 /usr/bin "$@" /usr/bin | "$@" sed awk export
+		x=1 "$1" 'quoted text' -eu sed x=1 echo ${HOME} readonly x=1 done awk x=1
+		${HOME} awk 'quoted text' "$@" then printf sed
+sed cd echo ${HOME} | local ${HOME} "$@" -eu printf x=1 && printf ${HOME}
+--verbose awk readonly /usr/bin cd awk $(pwd) awk echo
+/usr/bin "$1" local done -eu 'quoted text' && "$@" 'quoted text'
+		--verbose readonly 2>/dev/null --verbose done $(pwd) test then cd
+	printf "$1" x=1 local local local /usr/bin ${HOME} readonly done local &&
+done sed grep done printf && echo /usr/bin
+		readonly --verbose | grep
+		$(pwd) printf export printf echo -eu && && "$@" awk && test done x=1 2>/dev/null
+	test export 2>/dev/null cd done | awk && 'quoted text'
+		test 2>/dev/null "$@" 'quoted text' "$@" done
+		export export cd 'quoted text' 2>/dev/null "$1" test 2>/dev/null
+		test readonly export export done
+		grep && readonly "$@" test 'quoted text' "$@" -eu 2>/dev/null
+--verbose done "$1" -eu 2>/dev/null awk readonly done awk printf readonly
+local printf "$@" sed | ${HOME} && x=1 /usr/bin printf "$@" /usr/bin x=1 then
+	| readonly /usr/bin $(pwd) then
+	${HOME} "$1" local printf 'quoted text' then grep $(pwd) "$@" && done done test
+	local done sed grep -eu test "$@" then 'quoted text'
+echo "$1" cd export 2>/dev/null /usr/bin then printf $(pwd) --verbose
+'quoted text' | --verbose sed then
+		"$@" done ${HOME} $(pwd)
+&& printf done grep |
+		2>/dev/null printf done "$1"
+"$1" ${HOME} printf "$1" --verbose $(pwd)
+/usr/bin ${HOME} echo echo -eu test export
+	$(pwd) --verbose 'quoted text' done | $(pwd) -eu readonly printf
+	'quoted text' /usr/bin | local cd cd && test awk then 'quoted text'
+	x=1 echo 'quoted text' "$1" ${HOME}
+sed /usr/bin 'quoted text' /usr/bin done
+	cd readonly sed then cd grep done
+		echo | "$@" readonly cd --verbose local local -eu ${HOME} -eu
+	then local | done "$@" x=1 -eu ${HOME} test readonly
+	echo $(pwd) ${HOME} done grep printf "$@" /usr/bin "$@" "$@" awk $(pwd) ${HOME}
+	--verbose $(pwd) awk printf printf 'quoted text'
+&& -eu done "$@" echo $(pwd) grep "$1" cd local "$@" export cd
+2>/dev/null sed then --verbose ${HOME} done $(pwd) done export x=1
+$(pwd) "$1" awk --verbose sed local 2>/dev/null -eu readonly | -eu "$@" printf
+		cd cd cd | 'quoted text' --verbose
+		local echo 2>/dev/null -eu --verbose "$@" awk awk echo
+local echo 2>/dev/null done $(pwd) grep x=1 ${HOME} awk test sed
+	local -eu x=1 sed export local test local $(pwd) echo test x=1 | local test
+		| | sed --verbose "$@" done && local cd echo 2>/dev/null readonly
+		"$@" $(pwd) cd x=1 sed 2>/dev/null 'quoted text'
+	then ${HOME} awk 'quoted text' && "$@" --verbose done readonly
+export cd | && $(pwd) awk done echo | "$1" /usr/bin export grep
+	$(pwd) awk echo readonly /usr/bin done $(pwd) ${HOME} sed $(pwd) "$1" echo |
+	printf 'quoted text' readonly /usr/bin && &&
+		then printf "$@" --verbose &&
+	cd echo --verbose /usr/bin sed grep cd -eu
+		echo $(pwd) | printf grep "$1" then local | grep sed cd sed "$@"
+	2>/dev/null sed ${HOME} ${HOME} --verbose grep then $(pwd) local ${HOME}
+	test test test x=1 2>/dev/null readonly
+2>/dev/null $(pwd) local ${HOME} x=1 awk x=1
+$(pwd) test then sed ${HOME} awk awk cd echo "$@" cd test then readonly export
+| x=1 local echo then echo x=1 "$1" /usr/bin
+	&& "$1" $(pwd) "$@" then local
+		"$@" --verbose awk then -eu x=1 --verbose
+grep && grep local | "$1" /usr/bin
+		done x=1 done export printf grep
+	printf readonly "$@" readonly grep sed awk grep local && -eu 2>/dev/null x=1
+"$1" ${HOME} cd printf x=1 test /usr/bin -eu /usr/bin 2>/dev/null
+2>/dev/null echo -eu -eu then -eu $(pwd) --verbose
+	done 2>/dev/null 'quoted text' --verbose | test "$1" ${HOME} export
+2>/dev/null export readonly
+	cd sed 2>/dev/null --verbose
+-eu echo /usr/bin then 2>/dev/null done $(pwd) grep -eu 2>/dev/null then
+/usr/bin awk readonly test readonly printf 2>/dev/null "$@" --verbose ${HOME}
+x=1 | awk 'quoted text' awk readonly printf sed sed done cd cd -eu grep /usr/bin
+		2>/dev/null export 'quoted text' then -eu
+		awk printf -eu x=1 'quoted text'
+echo ${HOME} echo -eu
+		grep grep then then grep local
+		done echo 2>/dev/null $(pwd) local local "$@" 'quoted text' /usr/bin export
+	"$1" $(pwd) "$1" echo test cd awk then
+grep "$1" sed x=1 sed done grep 2>/dev/null printf
+		grep ${HOME} done done done "$1" grep x=1 "$@" 2>/dev/null echo && 2>/dev/null
+		$(pwd) 'quoted text' test 'quoted text' printf test 'quoted text' then
+	test $(pwd) grep | -eu 2>/dev/null 2>/dev/null ${HOME}
+	-eu echo grep readonly test
+	awk done | $(pwd) "$1" done done cd
+	-eu 2>/dev/null export 2>/dev/null
+		${HOME} --verbose local "$@" && then sed cd cd && test echo cd | printf readonly
+		2>/dev/null "$@" cd awk ${HOME} "$1" "$1" awk
+done then ${HOME} ${HOME} 2>/dev/null printf
+echo "$@" grep && printf $(pwd) echo /usr/bin awk 'quoted text' $(pwd) ${HOME}
+	"$1" readonly readonly 'quoted text' "$1" 2>/dev/null /usr/bin awk printf
+	cd --verbose "$@" ${HOME} local | | test done
+${HOME} "$1" -eu done test export | readonly test test grep awk "$@" --verbose
+	awk $(pwd) ${HOME} sed /usr/bin printf ${HOME}
+		done awk | sed then readonly 'quoted text' readonly x=1 ${HOME} grep /usr/bin
+		$(pwd) sed && grep awk done x=1 echo 'quoted text'
+		printf grep ${HOME} -eu $(pwd) ${HOME} then
+	awk cd export 2>/dev/null cd ${HOME} "$@" sed 2>/dev/null
+echo x=1 2>/dev/null cd done -eu readonly 2>/dev/null then $(pwd) x=1
+	done "$1" then && printf
+		then test then x=1 echo export export sed then x=1 && "$1" /usr/bin
+-eu -eu echo /usr/bin printf "$@" x=1 --verbose
+		readonly "$@" ${HOME} x=1 test export local
+		then readonly "$@" grep echo /usr/bin awk -eu
+	${HOME} test cd | local 2>/dev/null 2>/dev/null "$1" 'quoted text' x=1 $(pwd)
+	x=1 sed printf done ${HOME} -eu | /usr/bin readonly
+	cd echo "$1" test test "$@" local
+	x=1 | --verbose "$@" 2>/dev/null done readonly test
+	&& $(pwd) && cd export printf
+cd export grep --verbose sed --verbose
+| --verbose ${HOME} "$1" sed sed "$1" $(pwd) local | echo --verbose
+		"$@" "$1" 'quoted text' ${HOME}
+export --verbose ${HOME} /usr/bin
+		local then printf local | export sed grep sed --verbose ${HOME} printf
+	export echo "$@" && then 'quoted text'
+| | "$@" awk then done printf
+	grep | printf /usr/bin /usr/bin | grep 'quoted text' ${HOME}
+| readonly ${HOME} readonly done | ${HOME} x=1 --verbose "$1"
+-eu echo "$1" 2>/dev/null grep ${HOME} ${HOME} cd then
+	grep test local awk $(pwd) x=1 awk 'quoted text' printf ${HOME} local readonly
+	-eu local 2>/dev/null grep local "$@" readonly export
+echo --verbose /usr/bin local done x=1 echo && /usr/bin
+2>/dev/null local "$1" awk test && ${HOME} x=1 grep export
+"$@" $(pwd) cd 2>/dev/null done grep grep && 'quoted text' ${HOME} printf
+		test 2>/dev/null local /usr/bin export
+	-eu export echo grep local echo export export 2>/dev/null "$1" && local
+	then | --verbose printf 2>/dev/null done 'quoted text' "$@" awk printf
+	done readonly sed then $(pwd) && ${HOME} sed sed "$1" done /usr/bin
+echo 'quoted text' then x=1 /usr/bin
+local $(pwd) done echo "$@" 2>/dev/null "$1" sed $(pwd) test | sed
+$(pwd) local cd export $(pwd) grep export printf /usr/bin
+		x=1 then cd /usr/bin echo ${HOME} grep 'quoted text' echo echo cd "$1" --verbose
+		sed "$1" /usr/bin /usr/bin
+		cd "$@" -eu -eu ${HOME} local printf --verbose "$1" -eu "$@" local
+	-eu && | ${HOME} "$@" test 'quoted text'
+	--verbose sed 'quoted text' done "$@" "$1" sed 'quoted text'
+		grep done test "$@" done local sed
+cd sed --verbose | "$1" awk --verbose readonly
+		echo ${HOME} awk test local then ${HOME}
+'quoted text' cd "$1" "$@"
+${HOME} printf 2>/dev/null
+"$1" $(pwd) --verbose
+		readonly cd awk --verbose echo test
+	cd cd "$@" 2>/dev/null "$@" | ${HOME} && grep ${HOME}
+done && awk sed 'quoted text'
+		sed /usr/bin grep $(pwd) sed | $(pwd) ${HOME} | then readonly
+-eu echo echo 'quoted text' /usr/bin -eu awk x=1 done | echo $(pwd)
+	&& then grep test ${HOME} cd "$@" ${HOME} /usr/bin test 2>/dev/null local cd | export
+cd local x=1 ${HOME} printf test && printf printf local x=1 readonly grep
+		$(pwd) "$1" && --verbose /usr/bin sed awk "$@" done test
+		printf && test readonly "$1" printf echo /usr/bin printf grep /usr/bin
+	cd x=1 x=1 awk 'quoted text'
+sed local then ${HOME} "$@" ${HOME}
+		${HOME} grep "$1" x=1 cd "$1" then --verbose export test
+		-eu "$@" --verbose grep printf echo --verbose
+		cd "$1" printf 'quoted text' printf readonly -eu sed && printf
+awk 2>/dev/null export && "$1" /usr/bin sed then 2>/dev/null printf
+		printf | | sed 2>/dev/null "$1" local readonly "$1" /usr/bin
+	sed grep local && readonly then "$1" -eu -eu "$1" echo cd echo "$@"
+readonly test local printf
+		export "$@" then ${HOME} test $(pwd) /usr/bin 'quoted text' local "$1" done
+	local /usr/bin readonly && echo && printf echo readonly | readonly readonly
+		echo readonly && awk 2>/dev/null $(pwd)
+		export done done ${HOME} | 2>/dev/null awk | -eu 2>/dev/null sed then
+	awk 'quoted text' --verbose "$1" grep grep 2>/dev/null readonly done ${HOME}
+	test grep local "$@" then 2>/dev/null readonly -eu export
+	2>/dev/null done x=1 test
+	local printf $(pwd) $(pwd) ${HOME} "$1" | /usr/bin cd
+		-eu cd /usr/bin "$@" local local grep
+readonly done 'quoted text' /usr/bin ${HOME} 'quoted text'
+	| echo sed "$1" "$1" grep 'quoted text'
+test awk export export export -eu 2>/dev/null local 'quoted text'
+done "$@" cd 2>/dev/null cd export x=1 export $(pwd) $(pwd) grep export
+	"$@" readonly | awk grep $(pwd)
+printf printf --verbose $(pwd) sed $(pwd) $(pwd) local 'quoted text'
+sed then cd "$@" -eu readonly
+-eu grep --verbose 2>/dev/null then
+		-eu cd then && echo "$1" sed && cd | awk test /usr/bin "$@" $(pwd) cd
+		$(pwd) --verbose "$1" then --verbose
+		export 'quoted text' done local
+		cd echo x=1 --verbose done test ${HOME} printf readonly "$1" ${HOME} "$@" readonly
+		test test then 'quoted text' x=1 "$@" $(pwd) "$@" test echo
+		cd printf | x=1 x=1 grep -eu local echo test /usr/bin x=1 done 'quoted text' --verbose
+cd cd printf --verbose $(pwd) readonly then grep | echo done 'quoted text'
+		/usr/bin echo | /usr/bin test 2>/dev/null
+awk readonly | $(pwd) 'quoted text'
+		test $(pwd) 'quoted text' ${HOME} readonly awk echo export 2>/dev/null 2>/dev/null
+	done export readonly cd echo test then -eu
+	"$1" printf $(pwd) sed done then local "$1" -eu
+echo awk x=1 cd printf printf
+	'quoted text' echo local awk | awk 2>/dev/null
+	test | x=1 printf done | done then -eu "$1" /usr/bin
+awk $(pwd) readonly ${HOME} x=1 awk readonly local
+readonly export "$1" echo export /usr/bin printf test local export echo
+/usr/bin /usr/bin "$@" readonly readonly -eu then | --verbose ${HOME}
+$(pwd) && 2>/dev/null cd /usr/bin grep printf
+${HOME} --verbose grep && 'quoted text' 2>/dev/null 2>/dev/null x=1 --verbose
+		$(pwd) "$@" | | local x=1 --verbose then cd awk && x=1
+		-eu local awk done local then $(pwd) printf then grep readonly printf readonly
+'quoted text' grep --verbose grep "$@" && awk test cd readonly awk "$1" -eu readonly
+echo local | local "$@" -eu && "$1" echo test | "$@" /usr/bin $(pwd) awk $(pwd)
+		"$1" && && -eu cd -eu cd x=1 x=1 && readonly "$1" ${HOME} 'quoted text'
+	${HOME} | "$@" test echo $(pwd) export 2>/dev/null
+		${HOME} cd "$1" readonly 'quoted text' readonly echo echo
+		"$@" --verbose test local && grep /usr/bin local "$@" ${HOME} 'quoted text'
+awk then cd "$@" $(pwd) -eu sed | grep "$1" sed cd printf readonly
+'quoted text' done "$1" $(pwd) cd x=1 grep | echo cd -eu -eu export
+/usr/bin "$@" x=1 "$@" echo printf 'quoted text' local
+x=1 $(pwd) "$1" then awk x=1 export sed --verbose awk done then grep local -eu
+		2>/dev/null done /usr/bin | "$1" awk "$@" echo "$@" then 2>/dev/null
+local 2>/dev/null then done grep $(pwd)
+		$(pwd) then /usr/bin sed ${HOME} ${HOME} echo | /usr/bin local done 2>/dev/null
+		cd --verbose test "$1" "$1"
+	export 2>/dev/null export -eu "$1" printf local 2>/dev/null
+	$(pwd) done --verbose 'quoted text' x=1 $(pwd) test /usr/bin --verbose --verbose
+	2>/dev/null awk $(pwd) echo cd x=1 --verbose awk then && 'quoted text'
+		readonly ${HOME} echo grep printf /usr/bin sed readonly readonly
+export | test -eu awk echo -eu
+	sed -eu | local $(pwd) ${HOME} grep x=1 "$1" grep x=1
+		readonly grep "$@" echo && done
+| local done && export
+	x=1 local grep done cd $(pwd) printf readonly
+	x=1 "$1" "$1" -eu x=1 /usr/bin "$@" --verbose export then grep x=1 | export echo
+printf done $(pwd) echo cd printf test awk | | /usr/bin $(pwd) done | sed done
+		export awk done sed x=1 --verbose readonly x=1 readonly export
+	| -eu readonly export
+	&& -eu local test && then | done export ${HOME} then
+	cd /usr/bin readonly printf local done
+export readonly export -eu export echo readonly 'quoted text' -eu then
+	readonly export readonly sed /usr/bin "$@" cd cd -eu -eu then ${HOME} export
+		2>/dev/null printf && grep grep |
+"$@" && $(pwd) echo x=1 | && "$@" -eu "$@"
+"$@" ${HOME} -eu grep "$1" ${HOME} x=1 --verbose then
+'quoted text' cd printf done $(pwd)
+	sed --verbose then printf sed printf | awk grep /usr/bin 'quoted text'
+	cd export readonly cd "$@"
+		&& then grep -eu 2>/dev/null x=1 && "$@" /usr/bin export "$1" "$@"
+	printf ${HOME} sed 2>/dev/null test
+&& --verbose 'quoted text' export readonly x=1
+		awk printf $(pwd) && local then echo echo
+		-eu "$@" export "$1" test x=1
+	'quoted text' 2>/dev/null | ${HOME}
+		readonly echo $(pwd) $(pwd) 'quoted text' x=1 2>/dev/null ${HOME}
+		grep "$1" && grep "$1" && done then cd /usr/bin
+$(pwd) x=1 sed 2>/dev/null && local printf 2>/dev/null && x=1
+	done local done export readonly $(pwd) $(pwd) then --verbose then then
+	cd cd done cd /usr/bin export
+done "$1" 'quoted text' "$1" printf test export /usr/bin export
+		2>/dev/null && 'quoted text' && then export done "$1" export -eu
+	local printf "$1" then 'quoted text'
+		sed -eu done cd then then x=1
+${HOME} then local export | printf 'quoted text'
+		grep /usr/bin cd grep export awk 'quoted text'
+	local x=1 && then then export export ${HOME} -eu "$@" ${HOME} grep $(pwd) x=1
+export grep then awk "$@" readonly
+		done "$1" ${HOME} readonly ${HOME} $(pwd) awk "$1" /usr/bin printf test then 2>/dev/null
+	-eu | done "$1" "$1" cd -eu | done | then -eu | grep && cd printf
+-eu 2>/dev/null -eu /usr/bin
+		then sed cd | | -eu readonly test export then | test awk x=1
+"$1" "$@" $(pwd) then 'quoted text' x=1 -eu sed
+		then cd | && test sed printf -eu | local /usr/bin
+		2>/dev/null 2>/dev/null sed cd local sed export
+export readonly echo "$1" ${HOME} sed local x=1 ${HOME} && local /usr/bin
+	--verbose then 2>/dev/null $(pwd) awk --verbose local readonly readonly 2>/dev/null
+	/usr/bin echo readonly $(pwd) ${HOME} cd --verbose done && "$1" && cd done
+	then "$1" awk "$@" && "$@" sed readonly 'quoted text'
+	"$@" export printf awk --verbose export --verbose sed "$@" "$1" $(pwd)
+	2>/dev/null awk printf
+		grep 'quoted text' export 'quoted text' done awk 'quoted text'
+		&& ${HOME} "$@" awk "$@"
+	"$@" --verbose echo local
+| then grep 2>/dev/null then awk && /usr/bin -eu echo awk test printf
+	&& --verbose cd 'quoted text' && /usr/bin && grep 'quoted text'
+	local ${HOME} grep printf done $(pwd)
+		"$@" ${HOME} export | -eu grep test cd 'quoted text'
+		-eu awk sed 2>/dev/null echo
+	2>/dev/null && 2>/dev/null | x=1 done
+		-eu local && cd done -eu printf "$1"
+		test readonly -eu -eu done
+		2>/dev/null "$1" /usr/bin echo "$1" "$1" grep "$1" echo grep "$@" local sed -eu
+	done x=1 printf ${HOME} echo readonly then | printf readonly /usr/bin
+grep --verbose grep local export test test
+		$(pwd) ${HOME} awk then local
+		export printf done local test
+readonly printf 'quoted text' then done "$@" -eu "$1" printf ${HOME} readonly
+		printf x=1 $(pwd) && sed echo x=1 export -eu test
+		${HOME} 'quoted text' x=1 test
+grep grep 2>/dev/null ${HOME} x=1 --verbose done then test local local awk
+		local test "$1" "$1" printf export ${HOME} grep 2>/dev/null
+	done local printf x=1 cd printf done local $(pwd) echo test sed
+grep 'quoted text' 'quoted text'
+"$1" cd done ${HOME} done done printf
+	2>/dev/null then cd ${HOME}
+x=1 -eu printf printf ${HOME} && then export && sed sed cd
+		--verbose echo && awk "$1" && -eu readonly "$1" | cd | /usr/bin
+		| test test | cd $(pwd) sed "$@" local $(pwd) x=1 echo done "$1" "$1" echo cd
+		then -eu "$@" 'quoted text' cd readonly ${HOME} echo local | --verbose
+2>/dev/null ${HOME} -eu cd then ${HOME} cd cd export grep 'quoted text'
+		&& $(pwd) /usr/bin "$@" done --verbose | cd awk readonly "$@" test $(pwd) $(pwd)
+		readonly printf local test
+	then 2>/dev/null | done "$@"
+	x=1 export test readonly --verbose 2>/dev/null
+	printf awk | | done 2>/dev/null && readonly echo
+	| export sed ${HOME} "$1" -eu awk -eu | -eu cd readonly
+	/usr/bin /usr/bin local -eu 'quoted text' printf printf
+readonly export cd $(pwd) $(pwd) --verbose awk export ${HOME} &&
+	echo done -eu awk "$1" test printf $(pwd) export $(pwd) printf -eu
+| then printf awk -eu echo && 'quoted text' | test sed done
+$(pwd) "$1" test x=1 cd $(pwd) grep ${HOME} 'quoted text' done
+		awk export export grep cd ${HOME} $(pwd) export sed readonly echo then test export
+/usr/bin printf | grep grep
+	&& && cd local --verbose
+"$1" -eu local grep printf -eu awk test done sed export "$1"
+awk "$1" readonly "$1" ${HOME} "$@" echo printf then ${HOME}
+		${HOME} 'quoted text' -eu -eu local grep && echo $(pwd) readonly export
+	"$@" --verbose done then /usr/bin -eu
+/usr/bin grep /usr/bin awk readonly printf
+		grep ${HOME} grep "$1" -eu cd sed sed echo $(pwd) "$1" done then "$1" 2>/dev/null
+		-eu ${HOME} sed cd echo | /usr/bin && awk "$@"
+	then done "$@" awk "$@" $(pwd) /usr/bin -eu readonly cd grep cd
+	printf 'quoted text' sed awk && ${HOME} -eu 'quoted text'
+		x=1 'quoted text' && export && grep local sed test 'quoted text'
+grep awk 2>/dev/null grep test | x=1 test cd local 'quoted text' "$@"
+	--verbose ${HOME} printf readonly ${HOME}
+test local 2>/dev/null grep then | x=1 -eu
+test then export "$@" echo | echo export 'quoted text' echo cd /usr/bin then
+then /usr/bin --verbose | printf echo --verbose readonly ${HOME} |
+		--verbose then grep x=1 ${HOME} | cd --verbose awk -eu cd
+		'quoted text' cd done cd test grep $(pwd) /usr/bin readonly echo
+	awk "$@" then x=1 local grep local /usr/bin readonly grep echo
+sed sed -eu done && ${HOME} | "$@" x=1 printf test then done local printf
+	done test local printf then 'quoted text' --verbose test "$1" sed "$@"
+	'quoted text' test done sed awk
+	cd echo readonly then readonly 2>/dev/null printf done local grep
+		x=1 readonly x=1 local test awk local test then ${HOME} x=1 awk "$1" export "$1"
+echo test printf --verbose --verbose x=1 sed $(pwd) cd awk test
+| && "$@" 2>/dev/null ${HOME} cd then
+	printf | then cd then local sed local sed ${HOME} test sed -eu cd sed
+		"$1" local sed then /usr/bin export "$@" 2>/dev/null
+		done && && ${HOME} "$@" | x=1 -eu
+		export ${HOME} awk 2>/dev/null "$1" 2>/dev/null
+--verbose "$@" 2>/dev/null
+		x=1 ${HOME} then x=1 test grep local printf 2>/dev/null
+	"$1" cd awk printf echo 2>/dev/null 'quoted text' then "$1" test 2>/dev/null -eu
+		&& 'quoted text' test x=1 /usr/bin /usr/bin readonly 'quoted text' x=1 test /usr/bin
+$(pwd) local echo ${HOME} && echo | readonly grep awk awk readonly readonly awk
+	"$1" awk sed "$1" grep local export x=1 readonly
+'quoted text' --verbose grep /usr/bin echo $(pwd) && echo -eu /usr/bin "$1"
+	--verbose "$@" $(pwd)
+	printf | "$@" 2>/dev/null
+	grep "$1" export | readonly /usr/bin $(pwd) "$@" echo /usr/bin 'quoted text'
+/usr/bin "$1" cd echo grep grep done 'quoted text'
+	local -eu done awk printf /usr/bin
+	"$@" then | test "$@" 2>/dev/null | -eu $(pwd) "$1" then x=1 readonly readonly
+	done $(pwd) --verbose 'quoted text' 'quoted text' local export
+		grep readonly sed "$1" "$@" 'quoted text'
+	then && echo readonly echo awk local ${HOME}
+		"$@" --verbose --verbose 2>/dev/null
+export "$@" awk printf awk 'quoted text' 'quoted text' then -eu done
+awk readonly then | x=1 x=1 /usr/bin ${HOME} then export --verbose x=1 readonly
+	${HOME} 'quoted text' 2>/dev/null
+	sed awk printf test printf $(pwd) grep
+	x=1 2>/dev/null 2>/dev/null local then test "$@" cd | printf -eu "$@"
+"$1" 2>/dev/null x=1 --verbose
+done && "$1" printf export printf
+	echo --verbose && ${HOME} printf -eu /usr/bin
+		readonly | export | $(pwd) /usr/bin ${HOME} test /usr/bin -eu "$1" printf 2>/dev/null
+		printf printf x=1 readonly && awk sed export then 'quoted text' -eu 2>/dev/null
+x=1 grep && 'quoted text' sed sed echo $(pwd) test $(pwd)
+"$1" /usr/bin sed -eu 'quoted text'
+		${HOME} done then then cd $(pwd) readonly "$@" x=1 awk cd | test
+	readonly echo "$1" sed printf | then test "$@" cd then export && then x=1 sed
+		echo ${HOME} printf -eu awk 2>/dev/null readonly 2>/dev/null --verbose
+done /usr/bin readonly "$@" readonly x=1 echo 'quoted text' ${HOME}
+	printf done x=1 readonly cd readonly printf 'quoted text'
+	readonly 'quoted text' ${HOME} x=1 ${HOME}
+	readonly local $(pwd) -eu echo readonly sed readonly echo
+	test -eu printf sed | -eu then "$1" done done 2>/dev/null
+	-eu done local && 2>/dev/null
+		x=1 2>/dev/null "$1" x=1 $(pwd) 2>/dev/null /usr/bin test --verbose x=1 cd
+		sed grep grep --verbose readonly export x=1 'quoted text' $(pwd)
+		-eu | && -eu readonly | &&
+	${HOME} sed 2>/dev/null
+	--verbose x=1 'quoted text' x=1 readonly x=1 done -eu "$@" ${HOME}
+	test "$@" done grep $(pwd) then ${HOME} echo done awk awk "$@" test && awk --verbose
+		&& local sed $(pwd) done "$1" awk cd x=1 local 'quoted text'
+	2>/dev/null local && local && | "$1" echo sed test
+x=1 && test local then 'quoted text' |
+		test cd 2>/dev/null "$1"
+	readonly "$@" test test sed export awk export
+readonly printf /usr/bin awk echo ${HOME} done awk readonly
+	echo grep -eu cd | x=1 awk
+	echo 'quoted text' cd printf then ${HOME} echo ${HOME} x=1
+printf awk x=1 done local done ${HOME} readonly $(pwd) "$1" test
+	grep "$1" && --verbose printf && grep test test /usr/bin readonly --verbose readonly
+	"$1" export echo echo readonly 2>/dev/null test ${HOME} local --verbose
+	grep 'quoted text' local "$@" ${HOME} echo sed && awk
+	$(pwd) readonly local sed /usr/bin 'quoted text'
+	| ${HOME} | | echo awk readonly ${HOME} export
+		local sed local grep done printf
+		$(pwd) /usr/bin "$1" printf "$@" cd "$1" --verbose 'quoted text' "$1"
+	export "$1" sed /usr/bin grep
+	"$1" $(pwd) "$@" --verbose
+		| local echo grep x=1 printf /usr/bin | ${HOME} $(pwd) awk
+readonly printf echo cd --verbose test
+	test -eu echo "$@" 2>/dev/null
+| test readonly printf grep awk -eu $(pwd) echo | done cd export cd | local
+2>/dev/null | echo x=1 sed -eu awk then "$@" ${HOME} printf grep then echo
+	$(pwd) sed then 2>/dev/null ${HOME} 2>/dev/null
+	local 'quoted text' $(pwd) local
+		sed "$1" readonly x=1
+		$(pwd) | "$@" ${HOME} "$1" export local awk x=1 echo cd awk done | done
+	"$@" /usr/bin 'quoted text'
+		"$@" ${HOME} && readonly cd echo test
+		readonly "$1" | test export 'quoted text'
+	"$1" 2>/dev/null ${HOME} ${HOME} 2>/dev/null 'quoted text' awk x=1
+		'quoted text' done x=1 cd $(pwd) export awk 'quoted text'
+$(pwd) then 2>/dev/null done ${HOME} --verbose $(pwd) local "$@"
+	"$1" printf "$1" awk echo awk &&
+done then sed && printf ${HOME} sed ${HOME} "$1" --verbose test grep local
+		export echo test ${HOME} -eu && "$@" ${HOME} readonly ${HOME}
+"$1" then cd awk echo 'quoted text'
+		test sed "$1" 'quoted text' printf done --verbose done "$1" export
+	--verbose 'quoted text'
+		awk local cd export echo
+cd x=1 "$1" readonly sed cd ${HOME} x=1 export printf x=1 printf "$@" printf
+| "$@" --verbose grep sed x=1 grep | | ${HOME} 'quoted text'
+	sed printf printf x=1 x=1 test cd && $(pwd) -eu --verbose printf &&
+		${HOME} --verbose ${HOME}
+$(pwd) readonly sed --verbose export sed awk awk grep ${HOME}
+		done "$1" --verbose 2>/dev/null
+		-eu && sed | export 2>/dev/null sed
+export then && 2>/dev/null /usr/bin /usr/bin sed | local --verbose done readonly
+		2>/dev/null -eu sed echo && /usr/bin
+		&& /usr/bin -eu --verbose -eu cd done done &&
+		&& "$1" | local printf $(pwd)
+		echo $(pwd) && local local sed awk then sed --verbose done done ${HOME} ${HOME}
+	2>/dev/null 2>/dev/null 'quoted text'
+		sed then /usr/bin -eu && "$@" ${HOME}
+		-eu done sed --verbose | export | cd $(pwd) 2>/dev/null local test 2>/dev/null
+		"$@" x=1 "$@" local "$@" local 'quoted text' "$@" 2>/dev/null
+	local | local echo test $(pwd) export
+/usr/bin x=1 echo "$1" local "$@" then | echo
+		'quoted text' test test awk x=1 "$@" awk cd "$@" then -eu test "$1"
+		"$1" local cd cd && "$1" --verbose /usr/bin printf
+	readonly 2>/dev/null then
+		local x=1 cd readonly && -eu /usr/bin then done sed then x=1 --verbose export
+		export printf export export && x=1 cd cd -eu -eu
+		export awk $(pwd) readonly printf printf /usr/bin grep ${HOME}
+	then grep 2>/dev/null 2>/dev/null
+		--verbose local 2>/dev/null printf | "$1" -eu local "$1" done export 2>/dev/null
+		&& ${HOME} -eu awk printf "$@" printf local -eu $(pwd) grep -eu
+"$1" | then done 2>/dev/null grep export sed readonly | done
+grep readonly 'quoted text' cd ${HOME} printf "$@" -eu done grep local 'quoted text'
+	sed && -eu local grep && 'quoted text'
+sed export export "$@" export "$1"
+		test sed 'quoted text' awk
+| awk printf printf ${HOME}
+	${HOME} && printf grep x=1 2>/dev/null
+| readonly "$1" $(pwd) &&
+2>/dev/null --verbose awk 2>/dev/null echo /usr/bin "$1" test -eu
+		echo readonly test "$@" && done then printf grep cd
+	$(pwd) printf done && $(pwd) 'quoted text'
+		done | readonly 'quoted text' 'quoted text' 'quoted text' awk then
+		local sed /usr/bin && readonly sed /usr/bin ${HOME}
+readonly && printf 'quoted text' "$@"
+	/usr/bin then printf done "$1" x=1
+		done then awk printf "$@" printf $(pwd) && done
+'quoted text' done && "$1" grep cd ${HOME} ${HOME} awk "$1" && test --verbose
+done | sed done grep test then readonly
+echo sed ${HOME} grep then done grep $(pwd) 2>/dev/null cd "$1" | local printf
+x=1 grep $(pwd) sed "$1" x=1 sed export
+test -eu done test ${HOME} 'quoted text' printf
+		-eu printf cd grep echo export | readonly "$@" test awk export sed test
+	awk --verbose | sed grep 'quoted text'
+| awk 2>/dev/null | && sed 2>/dev/null 'quoted text'
+	printf printf ${HOME} --verbose printf readonly --verbose local /usr/bin then
+	echo grep "$@" | readonly /usr/bin && "$@" grep
+	export --verbose test && "$@" sed ${HOME} | &&
+-eu | grep 2>/dev/null && cd 'quoted text' test -eu | $(pwd) --verbose
+		done sed x=1 "$@" 'quoted text'
+	sed local done -eu export 2>/dev/null awk local readonly ${HOME}
+-eu local "$1" --verbose echo $(pwd) then cd cd -eu awk ${HOME}
+	sed then 2>/dev/null
+	cd test x=1 local sed test $(pwd) awk /usr/bin "$1" "$1" test
+	then "$1" done done ${HOME}
+awk cd x=1 grep | -eu grep export export x=1 -eu
+/usr/bin sed 'quoted text' local done readonly printf && awk cd sed
+| test -eu "$@" local | awk -eu then
+test awk x=1 ${HOME} $(pwd) sed awk export
+	--verbose 2>/dev/null done done echo echo | x=1 $(pwd) 2>/dev/null test readonly
+	awk -eu 2>/dev/null | readonly /usr/bin export then then done
+		done local readonly cd
+	readonly x=1 'quoted text' printf grep local --verbose x=1 "$@" sed test test -eu
+		"$@" "$@" test /usr/bin test 2>/dev/null then then x=1 local
+		"$1" /usr/bin "$1" readonly 2>/dev/null cd readonly "$@"
+		--verbose cd 'quoted text' awk -eu cd | --verbose
+		export echo then sed "$@" printf 2>/dev/null --verbose
+		2>/dev/null x=1 grep test 2>/dev/null | done cd /usr/bin
+x=1 readonly sed awk test grep 'quoted text' $(pwd) test 2>/dev/null printf
+		/usr/bin "$1" "$1" export 2>/dev/null sed /usr/bin -eu --verbose printf |
+		$(pwd) $(pwd) | readonly 'quoted text' echo cd ${HOME} x=1 sed && &&
+		done grep printf 2>/dev/null test && readonly
+	export /usr/bin "$@" "$1" awk grep /usr/bin
+-eu sed x=1 ${HOME} x=1
+		2>/dev/null | local -eu cd echo sed awk echo echo awk --verbose
+-eu local ${HOME} 2>/dev/null
+	grep test local -eu test && awk grep awk "$1" $(pwd)
+grep export export --verbose grep "$@" readonly
+		/usr/bin printf && awk -eu
+${HOME} sed -eu | cd readonly $(pwd) x=1 2>/dev/null
+		grep local 2>/dev/null printf 'quoted text' export awk cd $(pwd) cd export
+	$(pwd) printf x=1 "$1" $(pwd) done then | | echo ${HOME} ${HOME}
+	'quoted text' | --verbose
+"$1" readonly && awk "$@" grep --verbose
+${HOME} test "$1" x=1 "$1" cd | readonly && ${HOME} printf ${HOME} export
+'quoted text' ${HOME} -eu "$@" local /usr/bin $(pwd)
+$(pwd) printf grep /usr/bin local
+	'quoted text' | 2>/dev/null sed sed /usr/bin "$1" x=1 -eu export
+		awk export then done 'quoted text' -eu && "$1" awk -eu readonly grep $(pwd)
+	awk export grep 'quoted text' done 'quoted text' ${HOME} 2>/dev/null done test
+export "$1" cd sed /usr/bin
+		echo x=1 "$1" -eu readonly grep export then then printf awk sed echo ${HOME} sed
+	grep 'quoted text' echo awk done x=1 grep export cd "$@" x=1 readonly ${HOME}
+	printf cd grep $(pwd) then --verbose "$1" | -eu cd "$1" x=1
+	cd --verbose $(pwd) then -eu printf test printf 'quoted text'
+		-eu sed && && ${HOME} then $(pwd) "$1" export --verbose
+	export | "$1" test cd sed awk then 2>/dev/null --verbose
+		export echo --verbose printf ${HOME}
+/usr/bin cd export x=1 then --verbose sed /usr/bin awk grep /usr/bin
+${HOME} /usr/bin ${HOME} then cd 'quoted text' && local
+		"$@" $(pwd) echo readonly echo "$@" && grep $(pwd) readonly $(pwd) printf
+		/usr/bin done grep "$@" then echo -eu && -eu
+"$@" local x=1 readonly && cd then grep $(pwd)
+		then export 'quoted text' --verbose echo "$@" readonly awk sed
+"$@" "$1" && test --verbose -eu "$1"
+${HOME} readonly awk "$@" 'quoted text'
+test awk echo -eu ${HOME} done export ${HOME} 'quoted text'
+		$(pwd) printf then && done 'quoted text' local 2>/dev/null
+	'quoted text' "$1" test "$@" -eu printf /usr/bin test | sed cd echo printf
+	done && export "$@" then 2>/dev/null printf
+	2>/dev/null ${HOME} test -eu /usr/bin export
+	local --verbose test export && | printf $(pwd) | | grep -eu "$@" grep
+		done test test readonly ${HOME} then 'quoted text' test
+	&& cd ${HOME} awk x=1
+		x=1 x=1 local cd && && done
+		--verbose printf local | echo
+/usr/bin --verbose sed awk export then
+	--verbose 2>/dev/null then printf readonly then -eu local x=1 x=1 local awk
+		cd /usr/bin "$1" printf export "$@" echo 2>/dev/null
+done 'quoted text' && export sed then awk "$1" 'quoted text' | echo --verbose
+		export echo cd awk cd
+then test done cd ${HOME} 'quoted text' $(pwd) x=1 $(pwd) --verbose echo
+printf $(pwd) local --verbose $(pwd) "$1" --verbose then test
+	sed 2>/dev/null ${HOME} sed $(pwd) --verbose awk cd -eu cd --verbose test
+	done grep x=1 cd ${HOME} then ${HOME} done
+readonly readonly x=1 "$1" "$1" && test cd | local
+${HOME} x=1 $(pwd) "$@" local "$1" printf $(pwd) &&
+		-eu && --verbose $(pwd) $(pwd) && 2>/dev/null cd then /usr/bin
+	'quoted text' 'quoted text' --verbose
+		then export then readonly done export local "$1" $(pwd)
+	sed grep -eu readonly echo "$1"
+		| local cd x=1 x=1 2>/dev/null test awk local then then x=1 && ${HOME} --verbose
+echo 'quoted text' local echo
+"$1" grep readonly x=1 /usr/bin readonly echo "$@" local "$1" "$@"
+	awk local | done "$@" sed awk 'quoted text' grep local && --verbose
+		done test | 'quoted text' 2>/dev/null sed $(pwd) ${HOME} grep ${HOME}
+	${HOME} then x=1 export "$1"
+		local done readonly $(pwd) then /usr/bin "$@" done
+	"$@" sed local x=1 2>/dev/null done
+	"$@" cd cd "$1" -eu local cd /usr/bin --verbose $(pwd) test "$@" $(pwd)
+	&& -eu done -eu local "$1" done grep 'quoted text' $(pwd)
+		"$@" cd ${HOME} /usr/bin $(pwd) export
+then printf local awk "$1" $(pwd) local local 'quoted text' /usr/bin
+		$(pwd) then $(pwd) ${HOME} ${HOME} done "$1" x=1 -eu
+		'quoted text' export && -eu && grep sed readonly done grep /usr/bin readonly 'quoted text'
+| echo then echo printf && cd awk local "$1" --verbose export
+	echo -eu ${HOME} -eu grep "$1" local local printf sed
+	${HOME} printf awk $(pwd) && ${HOME} 2>/dev/null "$1" "$@" 2>/dev/null
+	sed "$1" echo -eu x=1 cd then 2>/dev/null grep ${HOME} test
+	export --verbose then
+test cd $(pwd) /usr/bin done ${HOME} --verbose test
+	local "$1" "$@" cd readonly awk
+	test /usr/bin -eu awk cd cd readonly "$@" x=1
+	${HOME} echo sed sed -eu
+	--verbose awk grep readonly "$@" then 'quoted text'
+		--verbose cd /usr/bin cd grep awk local x=1 x=1 done cd "$1" 'quoted text' "$@"
+test cd && && export cd done test grep | export $(pwd) | grep $(pwd)
+	-eu 'quoted text' && readonly test "$1" export
+done /usr/bin && --verbose readonly
+		local "$1" test x=1 2>/dev/null sed printf && "$1" then echo
+		2>/dev/null export export "$1" then -eu test local local -eu -eu echo
+2>/dev/null done printf "$1"
+$(pwd) "$@" 2>/dev/null && $(pwd) ${HOME} $(pwd)
+"$1" readonly cd done ${HOME} then 2>/dev/null cd -eu 2>/dev/null sed
+	"$@" cd /usr/bin --verbose cd done export x=1
+	"$1" -eu test 'quoted text' done
+		/usr/bin awk grep grep 'quoted text' -eu test /usr/bin
+	x=1 "$1" /usr/bin awk | local echo printf printf 'quoted text' test
+done /usr/bin | ${HOME} --verbose ${HOME}
+		then /usr/bin 'quoted text' echo
+		test then grep /usr/bin readonly
+		done && awk "$1" awk $(pwd) --verbose grep 2>/dev/null test cd test sed /usr/bin
+printf echo printf sed
+		local printf /usr/bin | then test grep local echo "$1" --verbose
+	/usr/bin cd test | echo
+		"$1" | done awk readonly ${HOME} /usr/bin --verbose x=1 /usr/bin sed export test
+awk test export $(pwd) export cd awk echo $(pwd) 'quoted text' awk 2>/dev/null
+	export "$1" 2>/dev/null "$@"
+		| done awk ${HOME} then -eu
+	local && export 2>/dev/null then
+		test $(pwd) then "$1" echo $(pwd) awk
+| ${HOME} readonly readonly
+--verbose cd 2>/dev/null | done --verbose "$1" &&
+		done sed grep -eu 'quoted text' && "$1" && $(pwd) echo cd sed
+-eu done "$@" -eu test then
+		-eu sed x=1 then cd | $(pwd)
+		sed -eu "$@" grep x=1 export
+		2>/dev/null 'quoted text' --verbose test then 'quoted text'
+x=1 echo done sed cd grep
+test then echo x=1 export --verbose x=1 sed done done grep $(pwd) grep
+		&& -eu ${HOME} 'quoted text' then /usr/bin
+then "$1" && | readonly -eu "$@" x=1 && ${HOME} --verbose
+	echo --verbose cd grep ${HOME} 2>/dev/null
+	test "$@" sed then local $(pwd) sed -eu x=1 local /usr/bin
+'quoted text' readonly /usr/bin readonly grep -eu then readonly echo then --verbose
+'quoted text' test "$1" && 2>/dev/null /usr/bin
+| done "$@" echo local then $(pwd) && -eu
+	printf "$@" && export cd then test echo
+test echo sed --verbose "$1"
+	readonly $(pwd) echo then x=1 --verbose "$1" /usr/bin && echo 2>/dev/null then --verbose
+		cd /usr/bin 'quoted text' $(pwd)
+done "$@" "$1" -eu test grep ${HOME}
+	/usr/bin x=1 cd echo test printf ${HOME} test sed
+grep echo /usr/bin done echo --verbose
+	done readonly awk local
+x=1 "$1" cd local sed sed sed "$@" test "$1" local
+	"$@" export "$@" test test echo -eu grep export |
+		'quoted text' "$1" 'quoted text' done 2>/dev/null /usr/bin x=1 local "$1" printf
+		then export printf && awk grep export
+$(pwd) done export sed
+done 'quoted text' -eu done sed
+		readonly then 'quoted text' ${HOME} awk then $(pwd) awk grep then 2>/dev/null
+		-eu printf printf -eu "$1" | sed export
+"$1" test /usr/bin "$1" local 'quoted text' x=1 done 'quoted text'
+		'quoted text' cd /usr/bin cd "$@" --verbose "$1" 'quoted text' "$1"
+		x=1 export 2>/dev/null local readonly test then local done awk cd done
+	-eu grep $(pwd) /usr/bin echo test "$@" "$1" local 'quoted text' done awk "$@"
+x=1 x=1 export | printf "$1" "$1" 'quoted text' sed readonly then "$@"
+	'quoted text' "$@" -eu 2>/dev/null
+		sed awk cd $(pwd) "$1" 2>/dev/null sed readonly | | readonly $(pwd) ${HOME}
+'quoted text' | readonly 'quoted text'
+	test 2>/dev/null test local done -eu grep awk test -eu -eu "$1" /usr/bin
+awk 2>/dev/null 2>/dev/null cd echo then
+		$(pwd) "$1" local "$@" && then test awk local then
+x=1 export 2>/dev/null 2>/dev/null
+		export local ${HOME} 'quoted text' --verbose printf echo echo
+		${HOME} | cd "$1" test sed | --verbose 'quoted text' 'quoted text' /usr/bin
+then local /usr/bin $(pwd)
+	$(pwd) "$1" x=1 then -eu grep sed
+'quoted text' export echo test awk "$@" x=1 x=1 x=1 grep 'quoted text' export ${HOME}
+		'quoted text' export &&
+"$1" sed -eu sed 2>/dev/null ${HOME} awk | local export echo ${HOME} then test
+2>/dev/null | local /usr/bin "$@" awk x=1 echo awk cd readonly
+	${HOME} 2>/dev/null --verbose 'quoted text' ${HOME}
+sed ${HOME} 2>/dev/null
+		cd && x=1 2>/dev/null sed "$1" grep printf "$1"
+"$@" $(pwd) x=1 readonly "$@" -eu $(pwd) test local awk x=1 "$@" echo sed
+	test grep test 2>/dev/null grep
+$(pwd) "$1" echo -eu printf cd printf echo
+		cd awk && ${HOME} "$1"
+	/usr/bin 2>/dev/null ${HOME} test awk ${HOME} then cd 'quoted text' cd x=1
+	'quoted text' export done test x=1 x=1 --verbose done grep
+| grep echo "$1" | done --verbose 'quoted text' done 'quoted text' printf x=1
@@ -0,0 +1,2001 @@
+	awk "$1" -eu "$1" awk 'quoted text'
+	2>/dev/null then export test 'quoted text' grep local -eu $(pwd) cd 2>/dev/null
+	done readonly cd grep -eu printf printf
+		local printf echo sed && then && 2>/dev/null ${HOME} --verbose cd export
+$(pwd) x=1 echo done awk printf "$@" printf -eu awk --verbose -eu printf
+		x=1 -eu grep readonly "$1" local 2>/dev/null local cd "$@" | 'quoted text' "$1"
+grep | awk $(pwd) x=1 "$@" -eu done export /usr/bin printf
+	export printf done /usr/bin export export | $(pwd) 'quoted text' sed
+${HOME} /usr/bin "$@" "$@" printf done local echo grep
+		grep x=1 /usr/bin $(pwd) 2>/dev/null 'quoted text' -eu
+x=1 ${HOME} ${HOME} local 2>/dev/null sed | 'quoted text'
+		cd --verbose grep sed local
+	readonly -eu -eu export $(pwd) printf export ${HOME}
+	echo $(pwd) x=1 grep cd done export grep
+		awk printf echo done done
+	| test $(pwd) local "$1" |
+		--verbose test echo export 2>/dev/null --verbose
+grep ${HOME} 2>/dev/null 'quoted text' cd "$@"
+echo -eu x=1 printf ${HOME} x=1 sed "$1" x=1 grep && cd
+	grep "$1" 'quoted text' readonly x=1
+		local /usr/bin local grep export | done cd
+		readonly $(pwd) echo | local test /usr/bin then "$1" | readonly -eu grep
+		'quoted text' && 2>/dev/null 'quoted text' done then "$1" $(pwd)
+		2>/dev/null readonly && && cd && export --verbose
+cd -eu /usr/bin && ${HOME} done readonly test -eu --verbose
+	sed readonly "$1" local printf export | local export | 'quoted text' readonly
+		$(pwd) local && cd echo cd grep export -eu export echo
+	&& printf awk then && cd printf test 2>/dev/null sed export ${HOME}
+	${HOME} ${HOME} x=1 then done grep 'quoted text' grep /usr/bin 'quoted text'
+		--verbose "$1" awk 2>/dev/null && | x=1 awk readonly then -eu echo
+		--verbose /usr/bin 2>/dev/null $(pwd) && "$1" "$1"
+	export "$1" | readonly && /usr/bin /usr/bin -eu readonly local
+	printf -eu then && awk local echo
+--verbose "$@" $(pwd) readonly test $(pwd)
+	| local awk then ${HOME} ${HOME} 2>/dev/null done
+		awk -eu sed printf done | local "$1" cd grep sed ${HOME} awk
+		x=1 --verbose /usr/bin
+		done cd export export printf echo "$@" test 'quoted text' -eu then sed local
+	x=1 cd "$1" sed 'quoted text' /usr/bin x=1 export ${HOME} awk cd
+sed --verbose --verbose test "$1" readonly -eu readonly test
+		/usr/bin cd 2>/dev/null 'quoted text' awk printf "$1" done readonly ${HOME}
+then "$@" 'quoted text' && /usr/bin cd && then cd done --verbose grep &&
+	-eu done printf export -eu /usr/bin x=1 /usr/bin --verbose sed cd local sed done
+	x=1 $(pwd) done /usr/bin sed
+		export && cd grep ${HOME} done 2>/dev/null && test --verbose
+cd "$1" done | 2>/dev/null && x=1 | "$@" cd awk -eu grep test
+x=1 done sed && sed 2>/dev/null test echo local local cd cd
+x=1 cd -eu "$@" readonly then echo echo done export | readonly
+		grep sed 'quoted text' ${HOME} test echo local printf | grep
+printf 2>/dev/null then x=1 done
+	echo cd | ${HOME} && then 2>/dev/null
+		"$1" awk | sed export export done echo
+		2>/dev/null export sed /usr/bin --verbose echo && "$@" --verbose
+"$1" "$1" "$@" printf "$@" export local export 'quoted text'
+	/usr/bin echo -eu && local /usr/bin
+awk "$@" export local /usr/bin then sed echo export 2>/dev/null $(pwd)
+	then 2>/dev/null x=1 awk local echo x=1 echo
+	| x=1 $(pwd) test ${HOME}
+		| printf awk awk grep
+	awk export $(pwd) echo readonly | /usr/bin printf echo
+| export export cd /usr/bin $(pwd) 2>/dev/null
+printf then 'quoted text' test echo cd awk awk | --verbose local
+	-eu cd local && 2>/dev/null --verbose printf
+		/usr/bin x=1 then "$1" sed readonly 'quoted text'
+awk "$1" local local done
+	2>/dev/null readonly 'quoted text' && printf /usr/bin --verbose
+local x=1 local "$@" export ${HOME} cd cd sed sed && awk 'quoted text'
+	${HOME} echo local awk
+	done /usr/bin export export && 2>/dev/null ${HOME} 'quoted text' --verbose "$@"
+	cd x=1 "$1" sed $(pwd) export done 'quoted text' ${HOME} x=1 'quoted text'
+	| awk ${HOME} local --verbose 2>/dev/null
+sed 2>/dev/null then 2>/dev/null x=1 then | 2>/dev/null grep --verbose
+${HOME} ${HOME} done /usr/bin readonly awk export x=1 -eu readonly
+		echo printf ${HOME} 'quoted text'
+"$1" 2>/dev/null printf x=1 "$1" grep && ${HOME} "$@" cd then then "$@" 'quoted text'
+--verbose grep $(pwd) x=1 'quoted text' -eu readonly
+		done "$@" local "$1" cd x=1 export then grep | export cd | done then
+	local grep 'quoted text'
+		-eu ${HOME} && then done awk -eu awk "$1" echo sed x=1 $(pwd) | export
+'quoted text' ${HOME} echo local --verbose ${HOME} ${HOME} awk echo test ${HOME}
+cd --verbose sed printf && -eu /usr/bin printf
+		echo readonly then sed awk test test local test --verbose --verbose $(pwd)
+		grep readonly "$1" -eu echo
+		test && awk 'quoted text' done local
+		local grep test | echo echo test export grep
+		x=1 2>/dev/null readonly cd "$1" $(pwd) grep
+		2>/dev/null local -eu printf
+		'quoted text' ${HOME} -eu readonly "$1" readonly echo
+		echo -eu $(pwd) $(pwd) 'quoted text' cd --verbose --verbose /usr/bin ${HOME}
+-eu readonly "$1" 2>/dev/null /usr/bin | cd x=1 test x=1 /usr/bin x=1
+		export test 2>/dev/null --verbose "$@" export then
+	then --verbose readonly 'quoted text' ${HOME} sed
+		-eu awk done export echo
+awk done -eu cd 'quoted text' ${HOME}
+	echo "$1" test then | 'quoted text' done printf 'quoted text'
+	'quoted text' export
+	2>/dev/null $(pwd) cd readonly && grep printf --verbose 2>/dev/null then 2>/dev/null
+echo awk --verbose && local echo $(pwd)
+	x=1 x=1 'quoted text'
+		echo 2>/dev/null printf cd grep export done
+	readonly awk cd cd | 'quoted text'
+	test --verbose test echo export grep export ${HOME} -eu ${HOME}
+| ${HOME} echo $(pwd) export -eu readonly -eu "$1" 'quoted text'
+printf | grep readonly x=1 -eu --verbose 2>/dev/null test "$@" && -eu x=1
+then && 'quoted text' then /usr/bin
+then local -eu printf x=1 /usr/bin
+$(pwd) printf cd then export ${HOME} printf "$1" test ${HOME} done
+		-eu /usr/bin local && grep -eu cd x=1 done then "$1" awk /usr/bin awk -eu
+"$1" --verbose then local $(pwd) -eu -eu x=1 -eu
+	x=1 $(pwd) echo "$1" test test awk $(pwd) | echo "$1"
+		awk "$@" && 2>/dev/null /usr/bin 'quoted text' x=1
+		export local printf 2>/dev/null "$@" grep local 'quoted text' echo "$@" then awk
+	$(pwd) $(pwd) -eu done printf printf cd grep
+"$1" done -eu 2>/dev/null cd "$1" --verbose echo echo && then readonly
+--verbose "$1" 'quoted text' | $(pwd) | export cd awk --verbose 2>/dev/null | |
+grep done --verbose $(pwd) readonly && printf
+		export 'quoted text' 2>/dev/null
+"$@" && 2>/dev/null 'quoted text'
+	readonly done cd grep -eu done x=1 /usr/bin cd
+		local local sed x=1 cd x=1
+$(pwd) 'quoted text' $(pwd) 2>/dev/null test then 2>/dev/null
+	done --verbose /usr/bin && readonly ${HOME} |
+"$@" local -eu ${HOME} /usr/bin then done sed printf && sed --verbose
+	--verbose "$@" local then && readonly 'quoted text' "$@"
+x=1 test then -eu "$1" 'quoted text' readonly local && 2>/dev/null
+	/usr/bin done 'quoted text' | grep
+'quoted text' && export test "$1" -eu echo 2>/dev/null 2>/dev/null then test
+		export --verbose "$1" export sed grep done "$@" echo
+		$(pwd) done done "$@" awk readonly awk readonly $(pwd) cd $(pwd) printf
+'quoted text' "$1" /usr/bin done x=1 then 2>/dev/null "$1" grep 'quoted text'
+		--verbose --verbose printf awk printf
+readonly $(pwd) && sed then | done grep awk -eu "$1" grep $(pwd) test
+	$(pwd) test printf local awk test "$1" grep 'quoted text' /usr/bin echo local
+	"$1" local done ${HOME} grep readonly grep
+${HOME} done echo $(pwd) x=1 done "$1" grep "$1" 'quoted text' 2>/dev/null
+done | "$1" awk grep 'quoted text' /usr/bin readonly
+$(pwd) test export test ${HOME} awk printf
+		echo && sed "$1" | | /usr/bin -eu x=1 --verbose
+	echo sed grep printf export awk "$1" test
+	local /usr/bin local 'quoted text' "$@" -eu $(pwd) local printf -eu grep 2>/dev/null
+	done ${HOME} -eu x=1 /usr/bin && | export 'quoted text' export test local ${HOME}
+	'quoted text' sed awk printf $(pwd) ${HOME} test echo
+	local test $(pwd) test local
+"$@" | | "$1" "$@" && ${HOME} awk readonly
+awk cd awk readonly awk printf awk export 'quoted text' done
+/usr/bin export done x=1 local echo /usr/bin cd -eu grep local --verbose $(pwd)
+	| -eu awk --verbose local printf -eu --verbose local export readonly
+	$(pwd) x=1 --verbose
+readonly "$@" readonly test $(pwd) "$1" "$@" done
+| "$1" grep --verbose grep cd $(pwd) ${HOME} $(pwd) echo test
+	--verbose awk | echo test export grep "$1" "$@" "$@" ${HOME} export
+		${HOME} printf cd 'quoted text' then 2>/dev/null | done "$@" awk -eu
+	grep 2>/dev/null sed && printf x=1 /usr/bin done
+"$@" cd -eu x=1 grep readonly 'quoted text'
+test export echo 2>/dev/null ${HOME} test
+	$(pwd) | && local 'quoted text' awk && "$@" cd $(pwd) awk echo test
+		&& $(pwd) test && /usr/bin
+x=1 x=1 --verbose test cd export printf export
+done "$@" local && x=1 $(pwd) awk -eu 2>/dev/null $(pwd)
+cd 'quoted text' $(pwd) then x=1 sed echo then grep printf
+	test grep done /usr/bin 2>/dev/null done /usr/bin grep awk
+		-eu && awk echo $(pwd) then x=1 $(pwd) "$@"
+	local $(pwd) 2>/dev/null sed "$1" --verbose readonly -eu test test "$@"
+awk local awk readonly local done test cd /usr/bin --verbose done
+		-eu grep cd x=1 "$@" | --verbose
+		-eu export $(pwd) grep then printf printf done 'quoted text' x=1
+export | printf done cd local && | /usr/bin done then --verbose
+	"$1" echo export sed echo 'quoted text' ${HOME}
+	"$@" "$1" echo done sed echo then "$@" ${HOME} done
+grep $(pwd) local test | done x=1 ${HOME}
+	'quoted text' $(pwd) readonly
+	grep /usr/bin 'quoted text'
+	$(pwd) grep 2>/dev/null 'quoted text' echo 'quoted text' $(pwd) done
+	"$@" readonly /usr/bin then && 'quoted text' grep printf
+		2>/dev/null ${HOME} awk then ${HOME} sed 2>/dev/null
+		"$1" sed sed export 2>/dev/null ${HOME} awk && awk test && "$@" "$1" done
+		test 2>/dev/null "$@" done grep ${HOME} then sed then 2>/dev/null readonly
+	| cd test printf "$1" then test done
+		&& "$@" awk | $(pwd) 'quoted text' export echo
+	cd awk 2>/dev/null cd "$1" "$1" /usr/bin $(pwd)
+| 'quoted text' then then && /usr/bin x=1 grep
+	$(pwd) sed /usr/bin local | test done
+readonly -eu -eu awk $(pwd)
+| readonly && && --verbose
+	printf grep then 'quoted text'
+	grep cd then local | && done && test echo awk export 2>/dev/null -eu
+&& $(pwd) 2>/dev/null local -eu readonly 'quoted text' awk done &&
+		printf $(pwd) -eu test
+printf "$1" local --verbose done cd sed "$1" | cd | /usr/bin --verbose
+"$@" done "$1" /usr/bin readonly | 2>/dev/null
+	'quoted text' grep echo readonly
+grep readonly /usr/bin "$@" "$@" 'quoted text'
+	test 2>/dev/null test printf | echo "$@" &&
+		done sed x=1 -eu test -eu export echo test /usr/bin
+		x=1 -eu -eu then 'quoted text' local
+then $(pwd) x=1 grep export x=1 awk /usr/bin
+	awk test $(pwd) test 2>/dev/null x=1
+grep "$1" ${HOME} test then cd echo ${HOME} 'quoted text' test x=1
+	/usr/bin "$@" "$@" -eu sed readonly echo --verbose $(pwd) | x=1 | readonly test
+	2>/dev/null && then -eu --verbose $(pwd) printf grep
+		| | readonly test then && echo "$@" grep awk x=1 readonly
+		${HOME} awk "$@" x=1 | local $(pwd) awk done | && 'quoted text'
+--verbose | export export
+		local /usr/bin echo done /usr/bin then
+	sed && test x=1 | 2>/dev/null done x=1 "$1" $(pwd) x=1 2>/dev/null then
+		"$1" "$1" /usr/bin $(pwd) done ${HOME} 2>/dev/null "$1" done done printf echo
+		echo 2>/dev/null --verbose
+		echo && 2>/dev/null /usr/bin awk local "$1" --verbose local
+	awk "$@" --verbose 'quoted text' readonly -eu printf
+	${HOME} test done 2>/dev/null printf ${HOME} export sed
+	2>/dev/null --verbose
+		2>/dev/null grep "$@" export awk 'quoted text'
+	export x=1 sed --verbose -eu then awk local 2>/dev/null export
+		sed awk | awk awk printf --verbose 2>/dev/null
+then | printf done echo test x=1 'quoted text' x=1 2>/dev/null 2>/dev/null
+		x=1 done | /usr/bin local ${HOME} sed "$@" awk test ${HOME}
+/usr/bin sed /usr/bin ${HOME} --verbose
+	| export | sed readonly printf export -eu done /usr/bin
+| cd test 2>/dev/null "$@" x=1
+	"$1" grep echo "$@" 'quoted text'
+"$1" export x=1 readonly printf then printf "$@" sed export
+	&& && 'quoted text' export readonly
+		| -eu --verbose export export readonly cd local export
+	echo then export /usr/bin x=1 2>/dev/null /usr/bin local "$1" export 'quoted text'
+grep test local -eu ${HOME} grep 2>/dev/null "$@"
+		cd 2>/dev/null 2>/dev/null -eu awk printf test
+$(pwd) "$@" done -eu $(pwd)
+cd export then ${HOME} then x=1 "$@" x=1 local local export grep "$@" export "$@"
+	"$1" test 2>/dev/null cd 'quoted text' sed awk "$@" printf 'quoted text' -eu
+		$(pwd) "$@" 'quoted text' x=1 readonly echo readonly export /usr/bin
+		'quoted text' 'quoted text' 'quoted text' awk echo -eu && "$1" -eu echo
+		done then test $(pwd) echo | 2>/dev/null "$1" && awk 'quoted text'
+${HOME} sed | grep --verbose $(pwd) readonly x=1 echo sed export
+	--verbose "$@" test then "$@" then sed x=1 'quoted text'
+		"$1" /usr/bin "$@" sed 'quoted text' --verbose ${HOME} 2>/dev/null /usr/bin 'quoted text'
+	x=1 "$1" -eu readonly done | local --verbose readonly test ${HOME} test |
+		--verbose && "$1" done printf $(pwd) 'quoted text'
+${HOME} then test readonly
+		awk readonly export "$@" "$1" echo &&
+	2>/dev/null x=1 "$@" sed done sed "$@" sed echo local awk | printf sed
+echo --verbose 2>/dev/null export 2>/dev/null local local $(pwd) --verbose
+sed | done 'quoted text' sed cd 2>/dev/null $(pwd) sed
+		x=1 $(pwd) --verbose test
+		done cd "$1" x=1 export local x=1 test 'quoted text' awk ${HOME} export
+	&& export -eu && --verbose cd test ${HOME} cd "$@" 'quoted text'
+		&& "$@" | --verbose then
+local --verbose cd done -eu
+	${HOME} x=1 echo grep done printf --verbose "$1" 'quoted text' printf
+		--verbose --verbose -eu ${HOME} then
+		local local 'quoted text' readonly sed awk ${HOME}
+	cd local printf 2>/dev/null
+		--verbose readonly local
+		x=1 'quoted text' grep then ${HOME}
+		"$1" x=1 x=1 export readonly ${HOME} 'quoted text'
+done "$@" ${HOME} ${HOME} && echo then ${HOME} ${HOME} 'quoted text'
+	grep awk export x=1 2>/dev/null "$@" -eu $(pwd) sed grep
+		${HOME} -eu 'quoted text' readonly 'quoted text' echo test ${HOME} sed
+'quoted text' 2>/dev/null $(pwd) readonly export test test cd local "$@" 'quoted text'
+	"$1" echo cd | && x=1 $(pwd)
+		readonly cd --verbose sed
+	then readonly && $(pwd) done "$1" sed 2>/dev/null
+	x=1 ${HOME} awk sed /usr/bin then then printf readonly local 2>/dev/null | then
+		x=1 sed "$1" && local then "$1"
+"$@" -eu 'quoted text' echo -eu
+then done | export export echo local
+		printf done ${HOME} printf ${HOME}
+2>/dev/null export "$1" then readonly && 2>/dev/null | 'quoted text' $(pwd)
+		| echo x=1 then cd && awk sed local cd echo done && --verbose readonly --verbose
+	export local cd | test "$@" "$1" x=1 test test awk
+	export local $(pwd) && ${HOME} 'quoted text' cd readonly "$@"
+then -eu "$1" ${HOME} test "$@" | done x=1 -eu | ${HOME}
+		x=1 cd echo cd awk export $(pwd) ${HOME} 2>/dev/null
+	then ${HOME} local awk -eu cd grep /usr/bin "$@"
+		--verbose grep then | done test $(pwd) && /usr/bin "$@"
+		-eu cd awk x=1 sed 'quoted text' cd cd "$1" readonly x=1 "$1" then
+test --verbose ${HOME}
+	/usr/bin awk ${HOME} grep ${HOME}
+done cd cd "$1" echo "$@" "$@" grep then "$@" test ${HOME}
+		'quoted text' local sed awk
+printf local x=1 printf ${HOME} && && "$1" cd /usr/bin grep readonly export
+		grep cd done test && echo /usr/bin awk /usr/bin 'quoted text'
+	&& 'quoted text' | cd printf local then "$1" cd done ${HOME}
+	--verbose then 'quoted text' export
+	cd 2>/dev/null sed $(pwd) then x=1 export export
+		cd 'quoted text' x=1 sed -eu 2>/dev/null x=1 'quoted text' ${HOME} -eu echo echo
+"$@" grep test export && test
+	/usr/bin ${HOME} export local
+		-eu -eu then --verbose ${HOME} then --verbose awk done x=1
+x=1 done cd done grep --verbose
+	grep grep x=1 local cd cd done -eu printf ${HOME}
+cd && printf /usr/bin local | ${HOME} cd |
+	--verbose test local && done --verbose export echo awk export
+	cd test done cd then test cd
+	awk test 2>/dev/null echo | | cd export ${HOME} export
+		&& /usr/bin $(pwd) ${HOME} -eu $(pwd) "$@" export
+		2>/dev/null awk x=1 done done export export sed export test
+	$(pwd) | local | -eu /usr/bin -eu 'quoted text' grep "$1" sed
+cd ${HOME} awk sed grep 'quoted text' sed cd local done
+		'quoted text' $(pwd) 'quoted text' $(pwd) 2>/dev/null cd /usr/bin
+--verbose then | "$1" | echo "$@" sed test ${HOME} ${HOME} 'quoted text' echo |
+&& cd 'quoted text' awk
+	${HOME} | grep $(pwd) awk
+	then && local then ${HOME} -eu
+	local x=1 done export 2>/dev/null ${HOME} then then "$1" test -eu printf --verbose
+	"$@" 'quoted text' x=1 then && $(pwd)
+	readonly x=1 readonly sed echo 2>/dev/null && sed && && export test
+	awk printf printf 'quoted text' "$@" "$1" 'quoted text' x=1 --verbose
+		/usr/bin ${HOME} local 2>/dev/null readonly /usr/bin 'quoted text' sed $(pwd)
+		x=1 test 2>/dev/null readonly /usr/bin
+'quoted text' printf readonly
+		-eu readonly "$@" $(pwd) x=1 | ${HOME} grep printf export
+grep export export done "$1" sed $(pwd) echo done x=1 -eu done local $(pwd) sed
+done printf echo "$@" local
+		${HOME} x=1 x=1 test awk printf | /usr/bin --verbose
+-eu 'quoted text' /usr/bin /usr/bin "$@" && x=1 x=1 "$1" cd echo -eu --verbose
+		"$@" "$@" then then && printf awk echo awk then x=1 "$@" 2>/dev/null sed readonly
+		echo done then export local 2>/dev/null
+		then x=1 && test grep readonly
+		then export sed 'quoted text' awk printf printf
+	then awk /usr/bin 2>/dev/null x=1 && awk ${HOME}
+		${HOME} printf /usr/bin /usr/bin
+		export cd export /usr/bin $(pwd) x=1 -eu test "$@" echo test "$1" grep "$1"
+	printf local cd "$@" && then then | 'quoted text' | echo | -eu $(pwd) grep
+		cd -eu echo --verbose readonly | readonly --verbose
+'quoted text' awk | printf ${HOME} /usr/bin && 'quoted text' && then x=1
+		cd 'quoted text' export test local -eu echo && 2>/dev/null
+	--verbose awk echo local cd x=1 --verbose
+done $(pwd) echo done x=1 && ${HOME}
+	echo --verbose 2>/dev/null "$1" printf 2>/dev/null echo --verbose
+	-eu "$1" grep ${HOME} done ${HOME} then then export 2>/dev/null export 2>/dev/null
+		"$@" cd printf done ${HOME} sed grep test -eu export
+		&& sed "$1" /usr/bin test sed
+		printf ${HOME} | awk readonly export printf echo "$1" sed
+then "$@" local awk sed export ${HOME} done readonly
+-eu echo export "$@" export -eu local sed grep --verbose done ${HOME} /usr/bin
+	2>/dev/null printf sed | | test --verbose
+printf readonly echo grep "$@" "$@"
+		&& export grep -eu cd then "$1" grep -eu test 2>/dev/null "$@" "$1"
+local cd echo --verbose readonly echo 'quoted text'
+		x=1 'quoted text' export 2>/dev/null
+"$@" $(pwd) | echo cd readonly awk export
+cd "$@" sed --verbose --verbose "$@"
+	$(pwd) grep test ${HOME} "$@" grep
+		export echo echo then x=1 2>/dev/null
+done 'quoted text' $(pwd) "$@" 'quoted text' 'quoted text' ${HOME}
+	readonly then then "$@" 'quoted text' $(pwd) test export ${HOME}
+		$(pwd) $(pwd) -eu x=1 "$1" x=1 "$@" $(pwd) $(pwd)
+		'quoted text' test "$1" "$@" /usr/bin $(pwd) 2>/dev/null awk | -eu "$1"
+"$@" cd awk sed 'quoted text'
+sed 'quoted text' "$@" x=1 --verbose ${HOME}
+		x=1 local printf 'quoted text' -eu x=1 ${HOME} | x=1 2>/dev/null && local -eu
+--verbose | $(pwd) awk test | && echo readonly --verbose
+		local cd ${HOME} then then done
+"$@" grep 'quoted text' $(pwd) readonly $(pwd)
+		${HOME} 'quoted text' test 2>/dev/null test x=1 $(pwd) "$@"
+| --verbose then test cd echo done $(pwd) 2>/dev/null then
+		$(pwd) /usr/bin local $(pwd) 'quoted text' x=1 then done
+$(pwd) -eu cd x=1 grep done ${HOME} $(pwd)
+		--verbose 'quoted text' x=1 $(pwd) readonly cd readonly
+	echo -eu then && -eu local local ${HOME} echo /usr/bin awk && x=1 x=1 grep /usr/bin
+--verbose "$@" printf
+"$1" x=1 'quoted text' "$@"
+	2>/dev/null printf awk x=1 grep 2>/dev/null 2>/dev/null ${HOME} then x=1 'quoted text'
+		"$@" echo ${HOME} cd $(pwd) echo -eu
+		done test "$1" cd && /usr/bin sed test then "$1" "$@" 2>/dev/null "$@"
+local then readonly local awk -eu export printf
+	2>/dev/null --verbose | test ${HOME}
+	sed "$@" printf ${HOME} cd export local export x=1
+	--verbose --verbose readonly test
+echo 2>/dev/null grep $(pwd) /usr/bin done x=1 'quoted text' test "$1" --verbose
+		printf $(pwd) local -eu printf 2>/dev/null --verbose
+		--verbose cd "$1" && echo 'quoted text' local local
+	printf $(pwd) printf echo | done 'quoted text' cd ${HOME} export test ${HOME}
+		local grep test echo cd --verbose export cd printf
+	grep 2>/dev/null -eu --verbose | "$@"
+		&& awk "$@" grep done x=1 /usr/bin readonly 2>/dev/null export "$@" local printf
+		then cd export $(pwd) grep sed x=1 awk |
+		echo cd cd /usr/bin echo test
+	cd --verbose --verbose 'quoted text' test local
+local && 'quoted text' "$@"
+		/usr/bin local then awk x=1 $(pwd) done local done
+then awk -eu ${HOME} | test 2>/dev/null 2>/dev/null --verbose $(pwd) $(pwd)
+	echo "$1" "$@" && && then -eu $(pwd) sed awk printf
+		2>/dev/null | cd echo test -eu export readonly
+	$(pwd) /usr/bin grep awk
+echo && local "$1" echo --verbose local local awk grep 'quoted text'
+	${HOME} cd 'quoted text' sed x=1 echo x=1 awk &&
+	export -eu $(pwd) 2>/dev/null printf 2>/dev/null cd
+local "$1" 'quoted text' 2>/dev/null x=1 printf "$1" export test
+		done --verbose && | "$1" test printf | echo awk
+-eu then 'quoted text' | ${HOME}
+		done x=1 --verbose 'quoted text' -eu -eu $(pwd)
+	&& local sed sed --verbose echo "$@" 'quoted text' 'quoted text' readonly
+		${HOME} then 'quoted text' | x=1 local printf "$@" echo /usr/bin
+printf awk done 'quoted text' "$1" $(pwd) && -eu done awk done
+		$(pwd) export "$1" | local then cd sed && printf
+		${HOME} readonly cd export --verbose
+-eu test sed printf done /usr/bin && --verbose "$1" grep
+		sed test cd readonly export -eu then -eu sed $(pwd) 'quoted text' | sed x=1 awk
+		local cd x=1 awk | export sed sed 2>/dev/null awk
+		| grep echo /usr/bin then 'quoted text'
+"$@" done printf grep echo |
+${HOME} awk -eu sed && sed "$1" echo 2>/dev/null
+	${HOME} grep grep grep echo local ${HOME} /usr/bin
+	&& | 2>/dev/null "$1" && local /usr/bin ${HOME} sed && 'quoted text' | &&
+		local printf && sed done echo 2>/dev/null 'quoted text' 'quoted text' test local
+	&& "$1" export --verbose $(pwd) test readonly
+cd sed sed -eu 2>/dev/null then awk --verbose test /usr/bin readonly
+		cd /usr/bin x=1 then test --verbose --verbose "$1" export
+		done cd cd sed | grep printf export --verbose
+	2>/dev/null --verbose done /usr/bin 2>/dev/null
+	sed -eu cd ${HOME} 'quoted text'
+	$(pwd) awk 2>/dev/null && export
+	| export export grep readonly "$@" "$1" done done | "$@" awk grep test
+	echo echo $(pwd) sed 2>/dev/null 2>/dev/null
+	test readonly 'quoted text' cd "$1" export then cd 'quoted text'
+	grep awk local x=1 readonly 2>/dev/null "$1"
+	readonly done then && -eu awk cd export done printf
+		local | "$@" | ${HOME} awk sed test
+		done | echo -eu then -eu -eu -eu export echo grep "$@" sed grep "$1" && "$1"
+	"$@" readonly printf sed echo then "$1" | x=1 grep local
+		awk ${HOME} -eu /usr/bin | grep export 2>/dev/null | &&
+	x=1 $(pwd) local awk then $(pwd)
+grep export echo "$@" done test $(pwd) sed printf --verbose x=1 local then
+		awk 'quoted text' "$1" --verbose
+local "$1" test awk export | 2>/dev/null x=1
+test x=1 export | awk 2>/dev/null x=1 | printf /usr/bin "$1" 2>/dev/null ${HOME}
+	local cd awk "$@" export $(pwd) local printf | "$@"
+	"$1" | awk done -eu --verbose 2>/dev/null readonly | 2>/dev/null && --verbose sed
+	cd x=1 "$@" test done readonly /usr/bin grep cd cd -eu export
+	awk $(pwd) export -eu export 'quoted text' readonly export
+		readonly /usr/bin "$@" local cd cd x=1 test /usr/bin
+		'quoted text' ${HOME} done readonly done then 2>/dev/null
+		"$1" --verbose echo 2>/dev/null 'quoted text' cd awk -eu printf ${HOME} &&
+echo export export "$@" "$1" export cd ${HOME} 2>/dev/null
+x=1 ${HOME} grep 2>/dev/null
+		-eu printf ${HOME} test export then "$@" local --verbose cd then readonly
+	| /usr/bin --verbose export printf sed export && && done ${HOME}
+	then ${HOME} 'quoted text' 'quoted text'
+		printf | "$@" awk ${HOME} $(pwd) "$@" -eu /usr/bin
+		grep cd local cd grep local $(pwd)
+cd /usr/bin echo grep test 2>/dev/null -eu "$1" local export done $(pwd) -eu "$1"
+readonly 2>/dev/null "$1" export cd echo sed | 2>/dev/null
+	sed 'quoted text' local cd grep && 2>/dev/null sed printf /usr/bin ${HOME} --verbose
+	done local $(pwd) test 2>/dev/null /usr/bin "$@" -eu done
+cd printf test "$@" done && awk grep x=1 test export export
+	'quoted text' x=1 cd 'quoted text'
+	"$1" && "$@" $(pwd) -eu -eu sed "$@" -eu grep && test export printf
+	| then ${HOME} && sed then export
+'quoted text' echo cd && test | export done awk cd readonly | 2>/dev/null
+	done test /usr/bin x=1 done test
+test $(pwd) cd readonly 2>/dev/null x=1 echo | && grep sed export
+		--verbose x=1 $(pwd) printf && && x=1 && -eu "$1"
+	| ${HOME} ${HOME} sed --verbose cd export ${HOME} echo x=1 ${HOME} "$@"
+	${HOME} readonly --verbose 2>/dev/null
+sed test cd test "$1"
+	grep --verbose grep /usr/bin | sed /usr/bin
+		"$1" printf sed | export $(pwd) export 'quoted text'
+x=1 "$@" cd awk echo --verbose && && && && | &&
+	readonly /usr/bin $(pwd) test 'quoted text' && cd
+done done cd "$1" grep grep printf x=1 readonly
+	printf echo 'quoted text' 2>/dev/null 'quoted text'
+		/usr/bin printf 2>/dev/null /usr/bin sed /usr/bin
+		'quoted text' echo then --verbose && && "$1" printf local
+		2>/dev/null "$@" 'quoted text' then x=1 grep test 2>/dev/null
+		grep then $(pwd) sed grep export --verbose --verbose export
+awk | 2>/dev/null && grep local
+		export then "$@" ${HOME} then test "$@" /usr/bin cd ${HOME} printf test grep
+		export $(pwd) local sed grep x=1 test /usr/bin "$@" printf
+		'quoted text' export "$@" then
+		export x=1 echo | awk x=1 /usr/bin
+done && test done 2>/dev/null /usr/bin cd test echo $(pwd)
+| local x=1 grep "$@" printf local local
+	test x=1 "$1" && local x=1
+	/usr/bin $(pwd) x=1 then local x=1 sed -eu ${HOME} cd then test awk /usr/bin
+		export readonly "$1" /usr/bin
+&& done /usr/bin "$@" ${HOME} done ${HOME} x=1 done export printf echo echo awk
+	x=1 "$@" export | /usr/bin done local printf x=1 "$@" printf
+		--verbose cd ${HOME} awk awk then "$@" readonly 'quoted text'
+sed --verbose --verbose -eu
+local ${HOME} local $(pwd) grep x=1 "$1" --verbose cd printf --verbose printf "$@"
+x=1 sed $(pwd) done | then /usr/bin && 'quoted text'
+	grep cd "$1" -eu | "$@" done awk ${HOME} ${HOME}
+&& then export -eu awk
+export then && --verbose 'quoted text'
+	echo printf && printf /usr/bin | cd x=1 test
+| 2>/dev/null -eu awk local
+--verbose x=1 awk "$1" test echo test test then
+	awk done readonly readonly ${HOME} export test readonly then cd 'quoted text'
+awk grep echo 'quoted text' grep $(pwd) done -eu cd test --verbose "$@" done
+${HOME} sed $(pwd) test
+"$@" $(pwd) then done -eu cd 'quoted text' sed local "$1" echo "$1"
+		--verbose 2>/dev/null local local printf local /usr/bin --verbose
+	$(pwd) "$1" test ${HOME} --verbose printf 2>/dev/null export ${HOME}
+--verbose && done test x=1
+	export done sed 'quoted text'
+		/usr/bin awk 'quoted text' then grep sed export
+	$(pwd) echo readonly export "$@" "$1" echo sed 2>/dev/null
+		grep 2>/dev/null export export $(pwd) --verbose
+	'quoted text' echo x=1 2>/dev/null printf readonly done $(pwd) | local -eu
+"$1" "$@" | | ${HOME} echo /usr/bin
+awk cd export "$@" sed 2>/dev/null
+	&& test export && test then && awk grep awk local cd local -eu cd 'quoted text'
+	"$1" --verbose -eu local 2>/dev/null cd x=1 -eu 2>/dev/null ${HOME}
+"$1" && -eu 2>/dev/null cd awk then awk
+		echo 'quoted text' cd echo $(pwd) export "$@" 'quoted text' | sed 2>/dev/null
+	"$1" 2>/dev/null cd "$1" "$@" | | grep -eu 'quoted text' printf grep
+		-eu test awk then cd -eu test local /usr/bin done 2>/dev/null printf x=1 --verbose
+		cd x=1 echo sed echo --verbose 'quoted text' "$@" $(pwd)
+	&& x=1 cd readonly printf ${HOME} sed -eu sed readonly
+	'quoted text' && "$1" 2>/dev/null cd "$1" "$@" then
+		test then done 'quoted text' readonly
+	2>/dev/null 2>/dev/null grep /usr/bin | 2>/dev/null test
+	readonly awk cd && echo sed readonly 'quoted text' done sed
+		readonly | then test 2>/dev/null $(pwd) "$1" ${HOME} ${HOME} -eu
+/usr/bin sed "$@" readonly sed cd -eu grep | && x=1 /usr/bin "$1" then printf
+		| test ${HOME} --verbose /usr/bin "$@" awk &&
+	done --verbose | echo cd readonly --verbose
+	sed -eu cd 'quoted text' "$@" sed && 2>/dev/null sed /usr/bin readonly
+	grep local 'quoted text' 2>/dev/null 'quoted text' sed "$1"
+	done grep 2>/dev/null printf $(pwd) then test
+	then --verbose then | printf grep "$1" grep test $(pwd) "$1"
+x=1 x=1 cd | x=1 "$1" /usr/bin | 'quoted text' done x=1 "$1" cd 2>/dev/null
+	then ${HOME} ${HOME} done grep -eu
+sed --verbose $(pwd) readonly cd && "$1" awk local
+then test /usr/bin echo sed --verbose -eu "$1" 'quoted text' 'quoted text'
+grep 'quoted text' "$@" 'quoted text' /usr/bin x=1
+$(pwd) ${HOME} && awk echo readonly 'quoted text'
+		'quoted text' --verbose && grep ${HOME} echo
+	2>/dev/null done then grep export local "$1" then done "$@"
+	2>/dev/null ${HOME} sed test "$@" -eu "$1" ${HOME} | export readonly | $(pwd)
+		$(pwd) then $(pwd) export readonly printf --verbose
+local && awk 2>/dev/null sed /usr/bin
+		echo local sed 'quoted text' export "$1" export --verbose
+		awk test "$@" 'quoted text' then readonly
+	2>/dev/null done | then $(pwd) echo test
+		&& $(pwd) then then && printf
+		&& -eu /usr/bin && echo --verbose
+| $(pwd) local "$1" local readonly sed | "$@" awk "$1" sed test
+printf && local && ${HOME} done | && cd x=1 $(pwd) then $(pwd) test
+		-eu 2>/dev/null ${HOME} 'quoted text' grep
+		printf export local $(pwd) echo then cd echo /usr/bin
+then done ${HOME} sed ${HOME}
+		test /usr/bin local --verbose local awk /usr/bin 2>/dev/null printf x=1 "$@"
+	$(pwd) 2>/dev/null grep grep
+		export local awk cd sed --verbose "$1" sed
+		export && test readonly
+		then then 'quoted text'
+sed local done $(pwd) export
+echo local $(pwd) grep local local echo cd printf | -eu
+	&& printf "$@" x=1 readonly -eu && export "$1" echo /usr/bin awk "$@"
+	echo test | echo readonly sed then export && cd done sed "$@" cd done | | printf
+	cd $(pwd) | /usr/bin readonly
+	| local | printf x=1 local $(pwd) x=1 --verbose echo | done echo
+	"$1" cd sed sed x=1 sed | grep $(pwd) && cd printf readonly "$1" done cd sed | grep
+		done printf x=1 then readonly ${HOME} export 'quoted text' 2>/dev/null echo awk
+		"$@" local echo sed grep /usr/bin awk | sed --verbose local printf
+done sed done sed export $(pwd) $(pwd)
+		sed test "$1" -eu test grep printf test ${HOME}
+	"$1" test readonly readonly "$@" sed "$1" "$1"
+| echo "$@" "$@" cd /usr/bin "$1" /usr/bin "$@" done 2>/dev/null && 'quoted text'
+		| 'quoted text' printf local then grep export export cd grep --verbose local
+		sed export ${HOME} --verbose "$@" $(pwd) /usr/bin cd -eu awk grep x=1 'quoted text'
+--verbose local 2>/dev/null
+then printf printf $(pwd) x=1 done grep echo
+x=1 2>/dev/null readonly local $(pwd) then "$1" sed && "$@" x=1
+		then -eu awk 2>/dev/null printf then printf "$@" ${HOME} && then
+		printf readonly 2>/dev/null
+		test x=1 printf $(pwd) "$1" test "$1" "$@"
+-eu cd $(pwd) grep "$@" test /usr/bin done $(pwd) | then "$@" local 'quoted text'
+x=1 export x=1 printf "$@" done $(pwd)
+	readonly && printf test --verbose --verbose ${HOME} sed && done echo
+	test "$1" $(pwd) done echo "$1" 'quoted text' export local ${HOME} | && "$@"
+	cd printf cd $(pwd) printf ${HOME}
+$(pwd) grep x=1 echo awk grep | 2>/dev/null local "$1" awk ${HOME} /usr/bin && /usr/bin
+sed | grep local 2>/dev/null
+	cd local done $(pwd) "$@" --verbose /usr/bin sed
+	then printf readonly -eu /usr/bin 'quoted text'
+	test x=1 grep --verbose then --verbose readonly test grep grep /usr/bin
+| test printf grep x=1 test $(pwd) printf -eu
+		then -eu sed 'quoted text' /usr/bin printf "$1" test x=1 x=1 then /usr/bin
+	awk printf awk "$1" cd | ${HOME} readonly grep test
+| x=1 ${HOME} ${HOME} readonly grep local local $(pwd) "$@"
+		readonly test then $(pwd)
+readonly done test "$@" ${HOME} 2>/dev/null x=1
+	2>/dev/null 'quoted text'
+	x=1 sed printf local awk awk 2>/dev/null echo && awk test
+	-eu printf | export | && done readonly
+	local --verbose | export
+printf ${HOME} then -eu -eu
+	/usr/bin $(pwd) echo "$@" sed
+	$(pwd) $(pwd) --verbose /usr/bin export then
+&& local readonly echo local local sed && grep "$@"
+echo x=1 cd | /usr/bin test x=1 ${HOME} echo x=1
+	&& $(pwd) x=1 "$@" cd local cd test readonly
+--verbose readonly 'quoted text' awk then done sed x=1 sed --verbose cd printf
+	printf $(pwd) /usr/bin awk printf
+	| local then cd echo --verbose export readonly printf
+		then printf | && 'quoted text' readonly
+	-eu awk "$1" | $(pwd) printf
+		cd printf readonly $(pwd) echo grep then
+	cd && 'quoted text' grep "$1" grep echo -eu | done --verbose then $(pwd) awk
+		-eu "$1" ${HOME} awk grep "$@" x=1 "$@" export sed printf
+2>/dev/null local local printf && then echo /usr/bin 2>/dev/null
+grep done awk test echo
+	&& "$1" local $(pwd) echo done ${HOME} --verbose
+done "$1" echo && "$1"
+	export "$@" readonly -eu 'quoted text' awk export sed /usr/bin
+		"$1" | grep done -eu "$1" local
+then && | then awk $(pwd) local "$1" done grep x=1 | sed test local "$@" -eu
+done -eu printf echo then $(pwd) export printf --verbose awk 'quoted text'
+"$1" then awk grep --verbose
+		--verbose 'quoted text' "$@" done sed /usr/bin "$@" /usr/bin cd cd cd "$@" test
+		grep then "$1" printf sed local local cd local
+2>/dev/null 2>/dev/null awk ${HOME} readonly grep /usr/bin
+	export -eu $(pwd) ${HOME} x=1
+	echo grep | 2>/dev/null done -eu $(pwd) -eu sed then grep 'quoted text'
+		2>/dev/null done readonly "$@" 2>/dev/null
+		done -eu 2>/dev/null 'quoted text'
+		'quoted text' 2>/dev/null
+	test -eu && /usr/bin $(pwd) && grep cd 2>/dev/null cd cd "$1" "$@" then test 2>/dev/null
+		grep --verbose readonly done
+	printf $(pwd) --verbose 2>/dev/null ${HOME} /usr/bin
+	cd "$1" x=1 local -eu &&
+'quoted text' | | && echo
+	"$1" then 'quoted text' grep -eu sed 'quoted text' export --verbose grep --verbose
+		-eu 'quoted text' local printf echo
+cd "$1" done printf grep 2>/dev/null --verbose 'quoted text' grep 2>/dev/null cd
+	done then export x=1 grep --verbose then 2>/dev/null -eu
+		| readonly done /usr/bin local "$1" grep printf test && cd then
+	readonly grep -eu ${HOME} /usr/bin /usr/bin "$1" "$1"
+	${HOME} done --verbose "$@" /usr/bin x=1 echo awk local
+		echo x=1 awk /usr/bin test done $(pwd) "$1" cd 'quoted text' echo && echo "$@" "$1"
+	$(pwd) export /usr/bin && then && awk then grep "$@" then sed "$1" && test x=1
+		/usr/bin echo cd /usr/bin -eu cd then -eu /usr/bin && sed ${HOME}
+	"$@" && && /usr/bin printf test grep
+	export 'quoted text'
+	${HOME} then done test -eu echo printf
+export && sed $(pwd) export test && $(pwd) sed /usr/bin
+		"$1" readonly awk | sed sed $(pwd) $(pwd) grep sed 2>/dev/null
+readonly --verbose sed awk
+	x=1 done export sed && done
+	2>/dev/null printf "$@" 2>/dev/null grep sed "$1"
+-eu 2>/dev/null grep grep $(pwd) --verbose test done done grep $(pwd)
+		2>/dev/null test export x=1 grep -eu export done | grep x=1 grep $(pwd) done
+x=1 done "$1" 2>/dev/null awk 2>/dev/null --verbose
+	/usr/bin cd done readonly /usr/bin && readonly local 2>/dev/null
+--verbose --verbose x=1 then awk | readonly printf echo test export export 2>/dev/null
+then /usr/bin grep test | ${HOME} /usr/bin "$@" printf $(pwd) 2>/dev/null
+	/usr/bin cd then test x=1 local
+'quoted text' 'quoted text' local cd readonly
+		"$1" readonly "$@" done echo | -eu 2>/dev/null then 2>/dev/null $(pwd)
+	test local -eu -eu && cd "$1" printf cd $(pwd) && -eu $(pwd) /usr/bin
+		${HOME} --verbose --verbose ${HOME}
+readonly grep then local
+		"$@" local x=1 cd ${HOME} ${HOME} "$@" export x=1 /usr/bin printf echo export
+	readonly /usr/bin $(pwd) printf
+		"$1" cd $(pwd) printf grep && --verbose echo /usr/bin test sed &&
+		readonly printf export /usr/bin printf grep
+	printf local | "$1" printf then local 2>/dev/null
+--verbose "$@" "$@" export /usr/bin local echo grep /usr/bin -eu
+	"$1" "$@" printf printf readonly 2>/dev/null
+	"$1" printf --verbose --verbose done -eu test grep grep /usr/bin test
+	"$@" readonly test "$1" cd done "$1" printf sed && -eu echo test printf /usr/bin
+		2>/dev/null "$1" 'quoted text' echo "$@" awk test | ${HOME} && local grep
+	awk ${HOME} x=1 then && printf
+'quoted text' ${HOME} test
+--verbose grep grep /usr/bin
+	export printf grep cd cd 2>/dev/null export export grep /usr/bin | cd --verbose
+	cd ${HOME} /usr/bin ${HOME} $(pwd) test | $(pwd) -eu "$1"
+	echo $(pwd) -eu readonly -eu sed 'quoted text' | 2>/dev/null printf
+	/usr/bin awk done -eu test | grep echo cd
+	echo sed -eu cd export 'quoted text'
+	test && grep test ${HOME}
+		readonly -eu grep | "$@" x=1 -eu readonly
+printf "$1" "$@" && printf --verbose | && && $(pwd) test
+| then ${HOME} /usr/bin 2>/dev/null done 'quoted text' x=1 --verbose x=1 && 'quoted text'
+--verbose x=1 echo -eu test echo 2>/dev/null local -eu then echo local x=1 awk
+		done sed echo local done ${HOME}
+"$@" --verbose $(pwd) "$@" local printf cd $(pwd) grep local
+/usr/bin ${HOME} then sed && 2>/dev/null 'quoted text'
+		"$1" "$1" "$@" x=1 x=1 | $(pwd) $(pwd) then &&
+x=1 /usr/bin "$1" local grep -eu export
+sed printf done echo awk --verbose readonly --verbose /usr/bin x=1
+	printf | export x=1 readonly 'quoted text'
+		&& ${HOME} done export awk sed 'quoted text' printf
+		cd sed then 'quoted text' "$1" done
+	export /usr/bin export --verbose test -eu 'quoted text' --verbose readonly
+	2>/dev/null export -eu readonly && echo "$@" x=1 'quoted text' ${HOME} cd
+		printf local awk awk awk "$@" cd x=1 -eu
+		done printf printf grep x=1 "$1" local
+$(pwd) 'quoted text' 'quoted text' "$1" "$@"
+--verbose "$1" | 'quoted text'
+	cd then echo /usr/bin -eu done grep then done | | 'quoted text'
+		&& local cd readonly readonly sed cd
+	2>/dev/null test ${HOME} 2>/dev/null ${HOME}
+		${HOME} export $(pwd) then
+printf printf && echo sed "$@" export readonly then cd x=1 "$1" && printf
+	$(pwd) /usr/bin "$@" readonly awk ${HOME} echo then
+		-eu 2>/dev/null cd printf $(pwd) | --verbose
+	| "$1" grep sed cd 'quoted text'
+		${HOME} "$1" 'quoted text' /usr/bin | "$@" -eu cd x=1 test awk readonly
+		&& 2>/dev/null awk echo local x=1 printf "$1"
+		/usr/bin --verbose echo export then 'quoted text' -eu
+	-eu ${HOME} "$@" local test | $(pwd) | | /usr/bin ${HOME} /usr/bin
+cd done ${HOME} readonly | then ${HOME} local $(pwd) done /usr/bin
+'quoted text' | printf grep 'quoted text' local "$@" then awk cd cd then export
+-eu /usr/bin "$1" ${HOME} local $(pwd) printf --verbose
+		done echo printf export 'quoted text' 2>/dev/null
+"$1" grep && "$@" sed x=1 sed 2>/dev/null echo
+readonly | printf test -eu sed | sed awk grep && sed grep cd 'quoted text'
+	&& -eu echo export printf && export grep 'quoted text' test done | readonly
+		awk ${HOME} sed 'quoted text' sed ${HOME} export
+${HOME} readonly $(pwd) $(pwd) export local "$@" readonly then sed
+	cd /usr/bin awk && done awk -eu --verbose && then then "$@" printf "$@" 'quoted text'
+		| 'quoted text' printf
+x=1 readonly test local /usr/bin printf x=1 export cd $(pwd) echo then
+		local && done readonly --verbose
+	${HOME} --verbose 2>/dev/null grep --verbose ${HOME} test
+	readonly sed $(pwd) -eu $(pwd) then && ${HOME} -eu test done grep local test grep
+		/usr/bin $(pwd) cd export
+		grep x=1 /usr/bin readonly
+		/usr/bin "$1" export echo
+	/usr/bin export then /usr/bin sed && 2>/dev/null
+sed then --verbose | | /usr/bin --verbose /usr/bin
+		$(pwd) grep "$1" --verbose echo -eu
+test ${HOME} done && 'quoted text'
+export echo x=1 export ${HOME} sed ${HOME} | echo readonly readonly
+		-eu export --verbose then && && test /usr/bin
+export x=1 local local readonly echo | export | x=1 /usr/bin cd
+"$@" 'quoted text' done /usr/bin 'quoted text' awk
+	sed readonly | x=1 then done grep sed && cd "$@"
+&& x=1 'quoted text' grep x=1 && local readonly "$1" readonly grep && 2>/dev/null
+sed done 2>/dev/null grep 'quoted text' cd
+x=1 'quoted text' done && |
+2>/dev/null printf --verbose printf x=1 sed
+| echo | 'quoted text' grep /usr/bin -eu then ${HOME} readonly export done
+cd $(pwd) $(pwd) --verbose x=1 | awk --verbose | awk "$@" ${HOME} && done
+/usr/bin test done then 'quoted text'
+		then 2>/dev/null printf x=1 2>/dev/null x=1 local
+-eu then sed grep test printf sed "$1"
+	$(pwd) "$1" cd | $(pwd) "$@"
+-eu | sed awk echo cd local grep readonly cd cd 2>/dev/null export "$@" local cd
+		'quoted text' "$@" | done
+/usr/bin printf "$1" | --verbose && && sed ${HOME} sed local
+| local && sed $(pwd) -eu ${HOME} sed done "$@" /usr/bin readonly $(pwd) sed
+	2>/dev/null 2>/dev/null then /usr/bin
+&& --verbose --verbose 'quoted text'
+		x=1 -eu "$@" -eu 2>/dev/null grep
+sed "$@" ${HOME} awk x=1 test "$1" | readonly
+	test /usr/bin -eu printf printf printf
+		awk "$@" | 'quoted text' /usr/bin $(pwd)
+		| | test x=1 "$1" 2>/dev/null --verbose echo awk $(pwd)
+		--verbose echo test grep x=1 $(pwd) readonly $(pwd) 'quoted text' "$@" cd then
+		done cd "$1" cd $(pwd)
+"$1" $(pwd) done done /usr/bin
+		| 'quoted text' 'quoted text' export test printf grep 'quoted text'
+readonly export /usr/bin awk && readonly
+${HOME} $(pwd) $(pwd) /usr/bin 2>/dev/null local 2>/dev/null
+		$(pwd) x=1 then 2>/dev/null /usr/bin awk ${HOME} /usr/bin
+	printf grep grep export --verbose
+	/usr/bin done "$@" --verbose awk -eu && echo "$@" test cd ${HOME}
+	/usr/bin 'quoted text' awk local test cd readonly
+	local local /usr/bin "$1" export test "$@" printf 2>/dev/null x=1 x=1 /usr/bin
+		local $(pwd) done readonly --verbose then then awk export
+${HOME} done grep "$@" done 2>/dev/null readonly grep
+		| printf "$1" awk "$@" test grep grep
+	x=1 $(pwd) awk -eu $(pwd) echo --verbose
+	test cd awk | local | sed | cd export printf awk 'quoted text'
+		/usr/bin printf $(pwd) 'quoted text' "$@" "$1"
+$(pwd) echo ${HOME} ${HOME} printf printf
+	done x=1 printf sed -eu awk $(pwd) /usr/bin 'quoted text' grep local --verbose $(pwd)
+	$(pwd) && done echo readonly 'quoted text'
+grep "$@" local | x=1 && sed done done 2>/dev/null
+	x=1 done echo test done ${HOME} && awk
+		test test | && sed printf
+	sed then | done sed 'quoted text'
+echo test cd sed readonly export 2>/dev/null /usr/bin
+	awk export -eu -eu local | awk cd test done "$1"
+		--verbose "$1" | 'quoted text' 2>/dev/null export && printf /usr/bin local
+	done 'quoted text' "$@" x=1 then "$@" test && -eu echo done
+		awk then cd test 'quoted text' /usr/bin --verbose awk readonly
+x=1 cd -eu 2>/dev/null echo "$1"
+		grep | -eu awk "$@" | "$1" /usr/bin sed /usr/bin 'quoted text'
+	--verbose 2>/dev/null cd local | test ${HOME} sed && grep
+echo printf awk cd "$@" && test echo /usr/bin done | ${HOME}
+sed "$@" ${HOME} readonly sed awk printf /usr/bin
+		"$@" "$1" then 2>/dev/null
+	&& "$1" grep echo readonly ${HOME} --verbose then | local cd && local
+	&& "$@" /usr/bin export -eu then sed && 'quoted text'
+		&& readonly /usr/bin sed
+	local && && --verbose local sed echo && local 2>/dev/null |
+	'quoted text' awk sed printf readonly /usr/bin
+		x=1 x=1 printf 'quoted text'
+grep test echo then && -eu awk
+		"$@" cd --verbose -eu grep test "$1" 'quoted text'
+		readonly --verbose -eu grep
+	'quoted text' --verbose "$@" 'quoted text' $(pwd) && ${HOME}
+"$1" -eu awk "$@" echo --verbose | awk echo done -eu x=1 -eu readonly
+	-eu | done done readonly local /usr/bin x=1 test grep x=1 /usr/bin "$1" 2>/dev/null
+	done && printf -eu ${HOME}
+$(pwd) "$@" sed readonly export printf "$@" && /usr/bin
+	local test readonly "$1" x=1 'quoted text'
+export export printf x=1 echo local done sed "$@" done
+sed /usr/bin $(pwd) 2>/dev/null
+"$1" grep /usr/bin grep local export | --verbose done
+		sed done x=1 2>/dev/null ${HOME} "$@" awk local -eu "$@" "$@" awk echo awk ${HOME}
+	test awk echo && "$1" ${HOME} /usr/bin
+		--verbose "$1" sed "$@"
+	${HOME} $(pwd) done done grep x=1 cd local export then
+-eu sed done --verbose /usr/bin sed grep
+	&& | x=1 awk $(pwd) && ${HOME} x=1 test | /usr/bin ${HOME} cd readonly
+		printf test readonly -eu --verbose
+		local cd awk export grep
+	done "$@" | grep 2>/dev/null echo x=1 $(pwd)
+export printf "$1" echo grep
+$(pwd) awk && /usr/bin printf /usr/bin 'quoted text' then echo printf | "$1" ${HOME}
+	printf grep test /usr/bin -eu done echo sed -eu
+then $(pwd) grep done 2>/dev/null -eu awk grep
+readonly | sed "$1" $(pwd) ${HOME}
+	readonly "$@" | export 'quoted text' grep --verbose "$@" "$1" printf
+grep export "$1" done /usr/bin
+-eu done -eu "$1" done export awk ${HOME} cd 'quoted text' echo
+	printf "$@" --verbose 2>/dev/null 2>/dev/null "$@" done
+		&& done done grep printf "$1" grep awk echo done && 2>/dev/null
+grep cd "$@" local awk then && && --verbose 2>/dev/null
+		printf done ${HOME} then local then $(pwd) ${HOME}
+		/usr/bin export x=1 && 'quoted text' export grep readonly
+		echo $(pwd) --verbose readonly -eu sed printf -eu ${HOME} export -eu then -eu
+	--verbose ${HOME} 2>/dev/null sed && awk grep 2>/dev/null local grep
+		done then 'quoted text' "$@" --verbose export readonly then
+		grep 2>/dev/null --verbose awk cd --verbose grep sed "$1" $(pwd)
+		"$@" /usr/bin then | "$1" x=1 done grep then export export cd grep
+$(pwd) readonly sed -eu ${HOME} x=1 "$1" export ${HOME}
+awk local 'quoted text' && test local | readonly printf export --verbose
+		cd x=1 then ${HOME} test && /usr/bin "$1" 'quoted text' x=1 "$1" local
+'quoted text' --verbose grep export 'quoted text' grep
+	/usr/bin export test done echo 2>/dev/null $(pwd) --verbose export
+&& awk awk grep cd --verbose then 2>/dev/null ${HOME} && grep done local
+		test readonly printf 'quoted text' local local /usr/bin local
+"$@" printf "$1" done "$@" then printf | then 2>/dev/null
+		awk grep | local grep echo printf | export /usr/bin x=1 -eu $(pwd) printf &&
+cd readonly awk cd cd export done export printf echo
+${HOME} then done /usr/bin cd then
+	export && printf --verbose printf ${HOME}
+${HOME} local /usr/bin 2>/dev/null cd awk 'quoted text' grep "$@" printf
+	2>/dev/null && 2>/dev/null ${HOME}
+	printf echo /usr/bin local export grep printf --verbose -eu sed ${HOME} sed
+	export --verbose printf "$@" readonly grep then
+		--verbose --verbose cd done --verbose cd echo printf then -eu /usr/bin
+		local 'quoted text' export sed --verbose then grep cd local done "$1"
+	readonly x=1 "$1" $(pwd) && export done echo 2>/dev/null | x=1 then
+--verbose awk "$1" awk awk then ${HOME} grep readonly awk "$@"
+		readonly 2>/dev/null $(pwd)
+		--verbose export done grep /usr/bin "$@" cd x=1 awk $(pwd) sed
+	sed $(pwd) --verbose | cd ${HOME} $(pwd) printf local then && export
+		export local x=1 2>/dev/null && -eu cd sed "$1" ${HOME} local printf cd /usr/bin
+		cd cd local readonly awk then x=1 readonly
+		&& printf 2>/dev/null readonly
+	| --verbose test readonly readonly ${HOME}
+	echo "$@" /usr/bin --verbose --verbose --verbose "$1" |
+local 2>/dev/null printf grep
+done then printf echo ${HOME} -eu /usr/bin 'quoted text' | 'quoted text'
+	"$@" echo grep 'quoted text' -eu export
+	grep readonly | $(pwd) "$@"
+		grep test "$1" local sed "$@" && readonly
+export awk printf "$1" sed export grep done grep test $(pwd) ${HOME}
+	| --verbose -eu printf awk x=1 test | grep readonly grep
+	grep echo readonly "$1" done cd ${HOME}
+'quoted text' sed -eu ${HOME}
+	$(pwd) then done && 2>/dev/null --verbose | /usr/bin test local cd awk "$1"
+	sed -eu grep | 2>/dev/null test && export local export readonly
+'quoted text' /usr/bin sed "$@" export --verbose test 'quoted text' grep "$@"
+then then export done local then echo
+	printf && done 'quoted text'
+		readonly | --verbose then -eu export awk
+"$@" ${HOME} local grep grep 'quoted text' readonly grep
+		'quoted text' "$@" export -eu grep then
+2>/dev/null --verbose "$@" x=1 && grep
+| echo export sed ${HOME} printf echo sed then $(pwd) x=1 'quoted text' -eu
+		--verbose 2>/dev/null done
+	grep && | && 'quoted text' cd export echo done grep $(pwd) readonly readonly &&
+		done grep cd 'quoted text'
+		x=1 $(pwd) then printf export then /usr/bin
+"$@" printf | ${HOME} "$@" readonly 'quoted text' 'quoted text'
+printf 2>/dev/null -eu $(pwd)
+		done test test grep local
+		-eu sed done sed --verbose 'quoted text' 'quoted text' && -eu readonly echo
+${HOME} printf 2>/dev/null "$1" done echo then "$1" && export done "$1"
+then "$1" grep awk -eu done
+		'quoted text' --verbose
+		$(pwd) grep done test test done $(pwd) ${HOME} local export echo x=1 readonly
+	${HOME} printf ${HOME} 2>/dev/null sed printf cd grep then x=1 "$1" printf
+	awk --verbose 2>/dev/null | cd done ${HOME} && export 'quoted text'
+		test ${HOME} awk awk then local | 'quoted text' local 2>/dev/null | then export
+		echo sed readonly $(pwd) && printf --verbose printf done export
+		-eu done grep printf grep echo done test "$@" done readonly
+"$1" sed printf $(pwd) | awk cd
+export echo test cd $(pwd)
+		&& cd cd grep ${HOME} -eu x=1 readonly /usr/bin test echo cd 2>/dev/null echo
+		grep printf 2>/dev/null done x=1
+"$@" cd --verbose echo printf echo local x=1 ${HOME} --verbose | cd --verbose local
+local readonly test /usr/bin then ${HOME} /usr/bin /usr/bin printf
+		test "$1" printf sed $(pwd) && cd --verbose && then -eu && awk
+export 'quoted text' sed --verbose then cd sed
+2>/dev/null 'quoted text' -eu -eu export "$@" awk awk 2>/dev/null
+	sed export awk | ${HOME} "$@" then x=1 /usr/bin grep then readonly export
+	${HOME} local done awk awk | --verbose grep
+	cd export awk 2>/dev/null x=1 export
+		export 2>/dev/null echo sed -eu 'quoted text' local cd done printf
+x=1 sed echo x=1 && &&
+&& ${HOME} readonly sed echo then readonly
+		echo echo export && printf awk "$@" then | -eu echo
+test then "$@" echo | x=1 cd "$1"
+done "$@" x=1 -eu grep "$@" then
+	awk readonly local printf done grep x=1 -eu awk
+done -eu test -eu "$1" grep x=1 cd /usr/bin
+	grep --verbose "$1" done test
+		'quoted text' /usr/bin | x=1 printf readonly
+readonly done done echo echo | $(pwd) done --verbose ${HOME}
+	sed $(pwd) echo then printf "$@" awk 2>/dev/null ${HOME} grep grep 2>/dev/null
+-eu $(pwd) 'quoted text' sed x=1 ${HOME}
+		"$1" $(pwd) done /usr/bin cd export sed
+		export 2>/dev/null 'quoted text' then echo ${HOME} done export
+--verbose cd grep echo test 'quoted text' /usr/bin ${HOME} --verbose "$@" grep readonly
+	2>/dev/null export x=1 /usr/bin then sed
+		printf /usr/bin 'quoted text' "$@" "$1" then $(pwd) test done /usr/bin
+	export awk echo -eu "$@" && printf 'quoted text'
+		| printf ${HOME} $(pwd)
+		${HOME} 2>/dev/null 'quoted text' $(pwd) grep -eu "$@" done /usr/bin
+	${HOME} cd done cd /usr/bin $(pwd) "$1" /usr/bin | echo then sed "$1" then
+		printf done local readonly then
+		local ${HOME} 'quoted text' "$@" "$1"
+		$(pwd) sed x=1 sed x=1 echo local export "$@" 2>/dev/null
+		${HOME} echo $(pwd) then awk 'quoted text' "$1" | sed /usr/bin
+		readonly "$1" cd test x=1 export then
+		| "$@" 2>/dev/null echo | done -eu "$1" "$1" sed
+	'quoted text' 2>/dev/null 2>/dev/null export printf local 2>/dev/null done
+	/usr/bin ${HOME} "$1" local local then sed /usr/bin
+	printf $(pwd) grep 'quoted text' --verbose then "$1" export
+done -eu awk $(pwd) readonly | "$@" && x=1 "$1" sed "$@" cd cd echo readonly
+		x=1 then /usr/bin readonly 'quoted text' grep
+	$(pwd) readonly export echo cd sed echo echo readonly awk then test
+$(pwd) /usr/bin printf /usr/bin test grep -eu export 2>/dev/null local
+export /usr/bin "$@" 2>/dev/null
+		awk 'quoted text' cd then echo ${HOME} export
+test "$1" done --verbose grep
+$(pwd) ${HOME} "$@" export 'quoted text' export sed "$@" | awk | && $(pwd)
+	test cd 'quoted text' echo grep
+${HOME} $(pwd) /usr/bin -eu done ${HOME}
+	done readonly test x=1 "$1" --verbose "$@" "$@"
+		"$1" cd --verbose echo readonly
+		readonly done "$@" readonly 'quoted text' grep readonly
+	'quoted text' then test grep cd local $(pwd) printf --verbose local
+	x=1 test ${HOME} "$1" done printf "$1"
+		2>/dev/null | $(pwd) printf local 2>/dev/null awk readonly sed -eu echo | 2>/dev/null
+	/usr/bin test then ${HOME} printf
+	export printf -eu sed "$@" "$1" test x=1 printf
+		$(pwd) sed "$1" awk local grep then sed 2>/dev/null sed $(pwd)
+	test /usr/bin grep grep test "$1" $(pwd) printf readonly
+--verbose /usr/bin && cd 'quoted text' grep 2>/dev/null test
+	${HOME} "$1" x=1 && --verbose readonly
+"$@" "$1" export ${HOME} awk 'quoted text' 'quoted text'
+	test x=1 awk "$@" "$@" then sed ${HOME} done grep awk local 2>/dev/null /usr/bin
+	-eu then /usr/bin readonly
+	"$@" then local then sed cd local "$@" readonly then
+		export /usr/bin grep cd done 2>/dev/null ${HOME} /usr/bin
+	--verbose $(pwd) 'quoted text' x=1 sed 'quoted text' --verbose
+--verbose awk grep readonly -eu -eu /usr/bin x=1
+	| done && && 2>/dev/null -eu test --verbose
+$(pwd) export printf local "$@" | -eu x=1 "$1" done ${HOME} $(pwd) /usr/bin grep
+then 2>/dev/null readonly export ${HOME} sed
+"$@" local echo 2>/dev/null x=1 $(pwd) | readonly
+		--verbose readonly x=1 export cd /usr/bin 2>/dev/null cd /usr/bin --verbose
+		printf 2>/dev/null grep echo && local "$@" && printf
+export done readonly awk $(pwd) 2>/dev/null | printf sed cd 'quoted text'
+	sed "$1" test "$@" export 2>/dev/null awk export
+		printf readonly x=1 -eu export -eu | grep grep
+		2>/dev/null grep cd /usr/bin test then
+		&& 2>/dev/null readonly "$1" local $(pwd) | grep /usr/bin ${HOME} "$@" /usr/bin
+awk | readonly echo "$1" export 'quoted text' x=1 grep awk export |
+then ${HOME} local && 2>/dev/null
+"$@" cd done 2>/dev/null --verbose /usr/bin 'quoted text'
+		grep && ${HOME} /usr/bin $(pwd) 'quoted text'
+	'quoted text' -eu 'quoted text'
+	&& printf sed 2>/dev/null x=1 grep cd /usr/bin then --verbose
+		'quoted text' | 2>/dev/null
+echo local | && x=1 /usr/bin export printf x=1 "$1" x=1 -eu sed
+	readonly -eu echo $(pwd) done && local --verbose then readonly /usr/bin sed
+	/usr/bin readonly --verbose -eu $(pwd) /usr/bin test 2>/dev/null sed "$@"
+	echo $(pwd) readonly grep 'quoted text' sed
+&& 2>/dev/null awk awk 2>/dev/null test x=1 echo local
+2>/dev/null printf export cd
+		sed grep done "$@" grep awk --verbose
+--verbose "$1" "$1" grep
+	'quoted text' sed echo done 2>/dev/null export
+		/usr/bin readonly sed done echo ${HOME} grep && grep 'quoted text' sed
+	${HOME} 2>/dev/null 'quoted text' export --verbose --verbose
+echo test --verbose $(pwd) test
+	&& cd local $(pwd) local readonly 2>/dev/null --verbose done
+#include c245.sh
+	--verbose echo local sed then sed
+--verbose "$1" | sed $(pwd) export 'quoted text' "$1" awk local
+		$(pwd) printf export sed done -eu 'quoted text'
+	printf grep test done && --verbose "$@" grep ${HOME} export
+	readonly /usr/bin local $(pwd) printf then done && awk ${HOME}
+		-eu local echo && test "$1" 2>/dev/null
+	readonly sed 2>/dev/null
+--verbose ${HOME} $(pwd) "$@" $(pwd) && sed "$1" awk echo 'quoted text' --verbose
+		/usr/bin && local 2>/dev/null $(pwd) --verbose then "$@" && printf export
+cd done ${HOME} $(pwd) -eu grep | x=1 $(pwd) "$1"
+	export echo $(pwd) --verbose
+	sed done $(pwd) sed "$@"
+		local x=1 printf awk "$1" cd ${HOME} 2>/dev/null local grep
+	'quoted text' ${HOME} "$@" test "$1" local done readonly 2>/dev/null
+	done sed x=1 test readonly printf
+then "$1" 2>/dev/null $(pwd) /usr/bin
+	2>/dev/null test | echo 2>/dev/null echo test test $(pwd) 'quoted text' 'quoted text'
+	| readonly | | local sed
+awk readonly printf 2>/dev/null sed /usr/bin x=1 --verbose local
+		echo export done 'quoted text'
+		test readonly $(pwd) 2>/dev/null ${HOME}
+-eu 'quoted text' test "$1" $(pwd) cd ${HOME} x=1 echo -eu /usr/bin $(pwd)
+		"$1" ${HOME} cd awk /usr/bin --verbose | cd readonly then "$@" --verbose
+	"$@" then ${HOME} "$1" && echo test && "$@" && printf 2>/dev/null
+test ${HOME} grep done test echo x=1 awk --verbose "$@"
+grep test sed readonly then grep ${HOME} --verbose
+		awk local awk sed local "$@" cd awk | /usr/bin echo
+		echo -eu 'quoted text' cd && then sed "$1"
+	printf printf "$@" cd ${HOME} echo then printf done
+		test /usr/bin "$@" printf local $(pwd) && then 2>/dev/null && then "$@"
+$(pwd) x=1 awk awk /usr/bin grep export cd | readonly local export
+"$1" -eu local 'quoted text'
+	--verbose 'quoted text' x=1 "$1" export then echo cd grep /usr/bin --verbose
+		$(pwd) sed --verbose x=1 printf "$@" sed done -eu test done | "$1" ${HOME}
+		export then "$1" && echo then cd ${HOME}
+	${HOME} done printf /usr/bin "$@" 'quoted text'
+	done done printf "$1" cd --verbose && printf "$@" grep && awk 2>/dev/null
+		local printf sed /usr/bin --verbose && done export echo printf grep
+${HOME} /usr/bin "$1" --verbose -eu cd "$@"
+then test --verbose && /usr/bin cd test echo awk
+		/usr/bin sed --verbose 'quoted text' 'quoted text' export readonly 'quoted text'
+		sed awk 2>/dev/null then ${HOME} done sed done --verbose sed printf
+	then 2>/dev/null readonly "$@" sed cd printf ${HOME} cd grep
+done | $(pwd) --verbose ${HOME} done echo awk ${HOME} sed
+	"$1" then then local | $(pwd) 'quoted text'
+		echo echo awk ${HOME} --verbose x=1 cd $(pwd) export printf awk done
+		echo awk | echo sed local then x=1 awk "$@" x=1 readonly 'quoted text' x=1 "$1"
+sed && ${HOME} | grep "$1" 2>/dev/null ${HOME} && printf --verbose /usr/bin &&
+	echo 2>/dev/null grep awk 'quoted text' |
+		2>/dev/null "$@" $(pwd) done cd grep then | test
+	/usr/bin test echo cd -eu 2>/dev/null "$@"
+	done echo | --verbose cd | done sed ${HOME} $(pwd)
+	then $(pwd) echo echo echo --verbose grep 'quoted text'
+x=1 test "$1" "$1" x=1 then awk test done sed echo readonly then && printf
+echo sed "$@" "$@" export done 'quoted text' echo "$@"
+		then 2>/dev/null | 2>/dev/null | "$1" readonly --verbose "$1" "$1" export ${HOME}
+2>/dev/null -eu awk echo cd
+		-eu then export grep $(pwd) -eu done --verbose
+/usr/bin $(pwd) && && export test awk then readonly test readonly /usr/bin
+/usr/bin cd ${HOME} ${HOME} readonly
+		2>/dev/null cd local x=1 done ${HOME} ${HOME} then local /usr/bin
+/usr/bin x=1 local printf
+grep --verbose cd echo grep then --verbose "$1" 2>/dev/null "$@"
+	awk done | && "$1" $(pwd) test 'quoted text' then sed x=1 $(pwd) sed
+-eu /usr/bin printf && --verbose
+	grep x=1 2>/dev/null x=1 /usr/bin sed "$@" "$@" then $(pwd) 2>/dev/null ${HOME}
+cd 'quoted text' && /usr/bin | then && readonly
+grep test $(pwd) ${HOME} local --verbose && grep "$1" echo 'quoted text'
+"$@" echo done sed /usr/bin
+		${HOME} test -eu printf local ${HOME}
+grep && local --verbose ${HOME}
+readonly echo /usr/bin -eu test --verbose sed readonly cd done grep then
+${HOME} export test awk then echo printf test grep 2>/dev/null export export
+	local export printf cd x=1 echo cd 2>/dev/null
+	--verbose sed cd sed echo test $(pwd)
+	done local sed --verbose echo "$1" 'quoted text' --verbose | | then awk
+		readonly then "$@" local | 'quoted text' printf x=1 echo cd 2>/dev/null
+		x=1 2>/dev/null 2>/dev/null done --verbose && && -eu
+$(pwd) cd -eu then export done sed printf
+sed -eu readonly -eu sed -eu cd -eu "$1" ${HOME} export ${HOME}
+${HOME} | -eu done 'quoted text' awk 'quoted text' 'quoted text' | $(pwd)
+		"$@" awk local test x=1 -eu /usr/bin
+		"$@" echo /usr/bin x=1 | && $(pwd) test test echo
+	export echo done local awk awk export x=1 readonly ${HOME} 'quoted text' x=1
+	awk then done -eu local grep -eu awk
+		2>/dev/null $(pwd) 'quoted text' --verbose /usr/bin $(pwd)
+	"$@" -eu local readonly --verbose echo readonly then echo 2>/dev/null printf
+		then 2>/dev/null -eu then readonly readonly cd cd echo "$@"
+readonly x=1 /usr/bin export
+		$(pwd) ${HOME} awk -eu "$@" readonly 'quoted text'
+	"$1" export | done echo awk printf 'quoted text' echo | /usr/bin
+--verbose "$1" sed sed /usr/bin awk local x=1 | $(pwd)
+awk 'quoted text' 'quoted text' then echo local
+local sed -eu 2>/dev/null export printf done $(pwd) -eu /usr/bin
+	test readonly ${HOME}
+	-eu ${HOME} | /usr/bin done 2>/dev/null 2>/dev/null test
+	awk local echo ${HOME} cd | awk done printf local
+	readonly | local ${HOME} x=1 awk 2>/dev/null --verbose | $(pwd) printf 'quoted text'
+	${HOME} --verbose export
+		/usr/bin done | --verbose |
+cd then done ${HOME} "$1" x=1 done --verbose $(pwd) 2>/dev/null printf sed "$@"
+		"$@" && && cd awk /usr/bin cd x=1 done export "$@" -eu "$1" awk export && printf
+	'quoted text' test | cd test 'quoted text' "$@"
+x=1 $(pwd) echo -eu ${HOME}
+export printf echo grep "$@" then
+printf /usr/bin echo grep
+	-eu "$1" local then 'quoted text' /usr/bin awk done $(pwd) ${HOME} x=1
+	printf grep echo /usr/bin echo | x=1 -eu "$@" readonly local awk
+		$(pwd) 2>/dev/null x=1 $(pwd) ${HOME} local /usr/bin awk /usr/bin
+readonly && 'quoted text' grep echo grep echo local printf
+		local export echo echo sed 2>/dev/null cd
+2>/dev/null then export --verbose "$@" && && sed readonly export
+sed x=1 x=1 ${HOME} grep sed ${HOME} done ${HOME} export /usr/bin export && cd
+&& printf && cd $(pwd) 'quoted text' $(pwd)
+	printf sed x=1 ${HOME} awk readonly && local readonly x=1 echo readonly grep
+export /usr/bin x=1 | "$1" | done
+	printf grep then local readonly
+		"$1" readonly done 2>/dev/null
+	grep 2>/dev/null readonly | | ${HOME} 2>/dev/null
+echo sed && then readonly -eu cd ${HOME} "$1" 2>/dev/null x=1 echo then
+		$(pwd) test "$1" export -eu | echo "$@" done export /usr/bin export
+-eu local sed awk export export
+echo export $(pwd) 'quoted text' echo
+	grep awk echo printf /usr/bin && export cd 'quoted text' sed
+		sed grep -eu readonly grep --verbose --verbose /usr/bin cd printf
+	"$@" echo test 'quoted text' sed then ${HOME}
+echo then ${HOME} done --verbose readonly export "$1" /usr/bin &&
+	printf | sed "$@" x=1 sed && 2>/dev/null && grep
+	local awk readonly --verbose test grep 'quoted text' /usr/bin "$1" x=1 /usr/bin
+	${HOME} grep sed sed -eu echo sed then then && --verbose echo echo
+	cd | done /usr/bin /usr/bin ${HOME} "$1" 2>/dev/null /usr/bin
+		${HOME} echo echo /usr/bin "$1" ${HOME} export $(pwd) ${HOME}
+		sed && echo "$1" echo cd awk && then
+--verbose done && local
+		/usr/bin /usr/bin then && awk echo | cd cd readonly
+		x=1 then && sed export awk cd awk
+	$(pwd) && then 'quoted text' "$1" | "$1" "$1" readonly
+"$1" cd ${HOME} --verbose grep "$@" sed sed "$@" cd export awk then
+	x=1 export $(pwd) "$@" local --verbose -eu x=1 'quoted text'
+awk 2>/dev/null then --verbose
+	| grep sed --verbose test export x=1 2>/dev/null
+		--verbose then done done /usr/bin printf export then then echo sed awk done "$@"
+	test && x=1 done | "$1" --verbose && 2>/dev/null export grep &&
+		x=1 readonly grep 2>/dev/null
+'quoted text' --verbose ${HOME} | grep printf | grep then -eu "$@" 'quoted text'
+&& $(pwd) "$1" readonly ${HOME} -eu | readonly 'quoted text' --verbose echo && x=1
+-eu cd && local -eu -eu local 2>/dev/null
+sed then 2>/dev/null awk grep && ${HOME} ${HOME} then then grep | "$1"
+${HOME} then readonly then && printf --verbose done 'quoted text'
+	&& 2>/dev/null | "$1" then && test cd -eu
+	| && "$@" | awk 'quoted text' echo test grep grep sed awk readonly awk | grep
+		readonly test -eu export /usr/bin "$@" | ${HOME} ${HOME} 2>/dev/null test --verbose
+	export "$1" 'quoted text' grep
+	readonly --verbose 2>/dev/null $(pwd) readonly x=1
+		${HOME} then local test grep
+		$(pwd) x=1 | 'quoted text' /usr/bin grep 'quoted text'
+		2>/dev/null /usr/bin /usr/bin export done test
+		'quoted text' "$1" done awk then ${HOME} | sed
+	local readonly && --verbose test "$@" sed echo --verbose
+	local ${HOME} -eu cd /usr/bin x=1 test /usr/bin sed then /usr/bin
+		$(pwd) grep 2>/dev/null test ${HOME} ${HOME} /usr/bin
+	&& test then --verbose sed
+		&& -eu && echo x=1 export export printf $(pwd)
+	${HOME} done cd local && readonly test $(pwd) then
+		$(pwd) awk export "$1" x=1 "$@" awk x=1 -eu done sed echo then printf -eu then export
+		cd awk "$1" sed | /usr/bin sed awk "$1" ${HOME} awk
+	"$1" 2>/dev/null export "$1" printf local
+	2>/dev/null x=1 test && ${HOME} awk --verbose cd then local sed export
+then | | sed ${HOME} /usr/bin 'quoted text'
+grep done export ${HOME} done ${HOME} local | x=1 test export local local
+	| | grep x=1 test "$1" printf $(pwd) 2>/dev/null local 2>/dev/null cd
+	cd echo cd | readonly | "$1" 2>/dev/null
+	/usr/bin sed printf awk ${HOME} "$@"
+		"$1" | 2>/dev/null && "$@" /usr/bin 2>/dev/null 'quoted text'
+echo "$@" grep sed grep && readonly
+	/usr/bin "$@" "$@" ${HOME} 2>/dev/null
+	done && "$1" $(pwd) "$1" "$@" $(pwd) done then --verbose echo
+	2>/dev/null ${HOME} | 2>/dev/null $(pwd) --verbose | awk printf echo ${HOME}
+readonly readonly | printf && readonly
+	-eu done $(pwd) | && then && local --verbose 2>/dev/null
+		cd "$@" && && done && done && ${HOME} local test echo echo && local echo
+	-eu awk cd then /usr/bin
+awk ${HOME} test 2>/dev/null -eu local export /usr/bin export cd | && export $(pwd)
+	then && printf 2>/dev/null /usr/bin done |
+	local sed sed then $(pwd) echo sed 'quoted text'
+		| then awk ${HOME} local "$@" sed
+	"$1" --verbose sed 2>/dev/null
+'quoted text' "$@" "$1" awk --verbose readonly echo --verbose
+	test awk readonly grep test "$@" 2>/dev/null sed $(pwd) cd --verbose "$1"
+	done awk 'quoted text' -eu $(pwd) x=1 sed --verbose
+	echo --verbose echo test done -eu "$@"
+	cd 'quoted text' && /usr/bin local /usr/bin
+	then cd test test export 2>/dev/null ${HOME} 'quoted text' cd | && --verbose readonly
+local 'quoted text' | local local done | "$1" 'quoted text' test /usr/bin
+local readonly ${HOME} "$1" then
+		"$1" 'quoted text' done 2>/dev/null
+	-eu -eu test x=1 cd local readonly && then local
+	test -eu export test sed
+2>/dev/null -eu awk readonly && && local "$@" echo awk $(pwd)
+/usr/bin cd 2>/dev/null 'quoted text' 2>/dev/null test /usr/bin then -eu
+	sed export 'quoted text' "$1" $(pwd) then $(pwd) -eu ${HOME} printf
+		'quoted text' -eu printf grep | "$@" 'quoted text' --verbose
+	cd cd | "$@" cd ${HOME} test && "$1"
+printf cd 'quoted text' local grep printf
+	2>/dev/null test 'quoted text' ${HOME} awk -eu cd
+		"$@" done awk "$1" awk grep printf echo
+test cd ${HOME} "$1" printf grep
+		'quoted text' printf local && printf
+	/usr/bin then && -eu "$1" -eu -eu
+	x=1 readonly -eu echo $(pwd) grep "$@" done awk
+$(pwd) test then "$1" --verbose echo
+		readonly test -eu echo x=1 cd 2>/dev/null && readonly printf cd cd printf && x=1
+	readonly "$@" 2>/dev/null echo grep "$@" $(pwd) x=1 /usr/bin test && "$1"
+	cd echo /usr/bin then sed cd 'quoted text' 2>/dev/null local x=1 x=1 "$1"
+local done x=1 done echo
+		$(pwd) sed export export | "$@" x=1 done | grep printf echo
+"$1" 'quoted text' echo export awk -eu then | then cd local printf local
+	test awk sed "$@" grep echo
+	echo done echo ${HOME}
+		${HOME} cd /usr/bin done then awk done -eu export cd "$1"
+	'quoted text' ${HOME}
+&& "$@" 2>/dev/null 2>/dev/null awk awk /usr/bin "$@" 'quoted text' | && "$1"
+$(pwd) x=1 "$1" /usr/bin --verbose readonly
+&& test && "$1" | grep export -eu then then
+	local export | test printf local echo $(pwd) printf
+	local done && "$@" sed awk readonly then "$1" $(pwd)
+--verbose awk echo echo cd cd | -eu cd printf sed
+	grep then --verbose -eu 'quoted text' sed local then cd --verbose
+	export cd 'quoted text'
+		-eu $(pwd) awk -eu 2>/dev/null $(pwd) "$1" x=1 test | ${HOME} local readonly
+	done | 'quoted text' test /usr/bin
+		awk ${HOME} $(pwd) 2>/dev/null | ${HOME}
+| /usr/bin export && done -eu printf readonly
+	2>/dev/null --verbose "$1" ${HOME} "$1"
+	export "$@" && grep test "$@" awk 'quoted text'
+-eu sed ${HOME} $(pwd) ${HOME} $(pwd) && /usr/bin
+		local sed sed $(pwd) awk grep ${HOME} readonly "$@" awk $(pwd)
+"$1" test -eu | -eu && readonly export
+	export $(pwd) test -eu 2>/dev/null x=1 printf export echo then "$@" cd x=1 echo
+&& local "$@" 'quoted text' export cd readonly $(pwd) 2>/dev/null cd 'quoted text'
+	| awk echo && export readonly test "$@" x=1 $(pwd) 'quoted text'
+&& grep 2>/dev/null 2>/dev/null x=1 export 'quoted text' done
+--verbose sed readonly x=1 local local $(pwd)
+	-eu && && test echo cd readonly /usr/bin sed "$@" done x=1 export
+		2>/dev/null --verbose sed
+		test sed sed && | done sed ${HOME} "$1" x=1 --verbose "$1" "$1" /usr/bin
+		readonly 2>/dev/null grep cd sed awk sed test
+	grep && ${HOME} -eu /usr/bin "$1" x=1 done local x=1 done sed export cd |
+&& local cd readonly cd readonly | awk awk export ${HOME} x=1 done /usr/bin
+	then | x=1 /usr/bin cd /usr/bin && export awk 2>/dev/null echo test "$1"
+	| ${HOME} printf printf
+--verbose awk 2>/dev/null then 'quoted text' test | --verbose local echo
+		"$1" && "$1" && "$1" ${HOME} && awk export done
+export "$1" cd printf "$@"
+		${HOME} local x=1 "$1"
+		'quoted text' "$@" ${HOME} cd export readonly
+		/usr/bin cd /usr/bin | -eu | test x=1 | local && && echo ${HOME} export export
+	${HOME} 'quoted text' test --verbose "$1" echo ${HOME} awk then
+sed local printf done 'quoted text' export local $(pwd) x=1 local printf
+		&& grep printf printf --verbose awk /usr/bin sed
+		/usr/bin | 2>/dev/null x=1 echo ${HOME} grep "$1" ${HOME}
+		readonly | export ${HOME} echo local local /usr/bin x=1
+	grep --verbose awk awk x=1 /usr/bin "$1" then $(pwd) local -eu /usr/bin
+&& printf local awk 'quoted text' echo
+		cd echo /usr/bin grep | readonly "$1" $(pwd)
+		$(pwd) done test "$@" $(pwd) | echo ${HOME} $(pwd) echo x=1 readonly local echo
+		grep "$@" | ${HOME} 2>/dev/null then grep 'quoted text' cd readonly
+/usr/bin $(pwd) /usr/bin echo -eu 'quoted text' echo grep echo printf
+readonly && $(pwd) readonly | readonly "$1" "$@"
+		sed sed test test export
+'quoted text' -eu $(pwd) test sed grep
+	sed | awk printf export | 'quoted text' "$@" grep
+	2>/dev/null readonly | --verbose grep sed && sed
+	grep x=1 'quoted text' printf export grep local -eu readonly "$@" echo export
+		grep local done && done awk test ${HOME} x=1 | $(pwd) test test "$@" done ${HOME}
+		"$1" then test 'quoted text' -eu export then x=1 test "$1" local
+	"$@" -eu cd sed 'quoted text' readonly
+	2>/dev/null -eu awk && local x=1 | | test sed /usr/bin | -eu
+sed test then then readonly $(pwd)
+		| done -eu cd x=1 --verbose $(pwd) 'quoted text'
+		echo cd ${HOME} | readonly then grep /usr/bin readonly 2>/dev/null
+	awk | /usr/bin ${HOME} ${HOME} $(pwd) then 2>/dev/null x=1 "$1"
+	readonly test --verbose then sed /usr/bin done && "$@" "$@" "$@"
+&& test printf ${HOME} "$1" | ${HOME} test 2>/dev/null $(pwd) --verbose
+	sed export -eu test "$1" local "$1" 2>/dev/null
+	'quoted text' printf export 'quoted text' /usr/bin "$1" export /usr/bin
+	"$1" -eu printf ${HOME} readonly
+		--verbose 'quoted text' local done
+$(pwd) echo "$@" -eu ${HOME} then readonly
+	"$1" grep 'quoted text' local "$1" done
+x=1 readonly awk $(pwd) | ${HOME} then export --verbose | /usr/bin cd readonly
+		local awk awk awk "$1" test "$@" grep $(pwd) printf awk printf -eu &&
+		local printf export export
+printf cd 2>/dev/null -eu "$@"
+	2>/dev/null done sed x=1
+	sed cd export readonly "$1" && 'quoted text' ${HOME} ${HOME} local sed
+		/usr/bin $(pwd) cd echo
+--verbose "$1" -eu ${HOME} "$@" && printf cd x=1
+		export echo | "$1" ${HOME} then && && test echo -eu "$1"
+cd echo x=1 | --verbose readonly grep cd 'quoted text' sed /usr/bin cd printf
+printf sed 'quoted text' 'quoted text'
+x=1 test -eu export "$1" grep && then
+	local --verbose 2>/dev/null printf cd $(pwd) test printf x=1
+		sed readonly echo local "$@" -eu "$1"
+/usr/bin 2>/dev/null x=1 /usr/bin 2>/dev/null 'quoted text' sed && printf cd export
+	2>/dev/null "$@" then grep awk awk /usr/bin | 2>/dev/null grep
+	/usr/bin then $(pwd) --verbose
+	-eu -eu "$@" grep ${HOME} $(pwd) x=1
+	cd echo ${HOME} awk echo printf 2>/dev/null printf printf readonly
+		printf 2>/dev/null readonly ${HOME}
+	"$@" x=1 awk | 2>/dev/null local 2>/dev/null "$1" -eu cd
+	awk 2>/dev/null 2>/dev/null
+$(pwd) "$@" awk $(pwd) then
+	then --verbose then printf ${HOME} | printf $(pwd) 'quoted text'
+/usr/bin /usr/bin --verbose awk grep "$@" grep ${HOME}
+/usr/bin readonly $(pwd) /usr/bin echo "$@" 'quoted text' grep sed echo
+	done cd cd | $(pwd) ${HOME} then
+		2>/dev/null awk "$1" done x=1 readonly "$1" -eu ${HOME} sed done readonly 2>/dev/null
+	--verbose /usr/bin x=1 "$1" grep local then --verbose "$1" ${HOME}
+then sed /usr/bin 2>/dev/null
+	echo printf ${HOME} awk local
+	sed readonly then readonly "$1" "$@" sed test test /usr/bin
+	/usr/bin cd "$1" $(pwd)
+		sed $(pwd) -eu awk local awk grep awk 2>/dev/null x=1 export
+	local test printf "$@" 'quoted text'
+		--verbose readonly 2>/dev/null grep
+x=1 2>/dev/null then $(pwd)
+	done "$1" $(pwd) readonly
+		'quoted text' "$@" "$@" cd cd | $(pwd) printf "$@" | sed
+	2>/dev/null done sed x=1 export
+		test 'quoted text' echo ${HOME} "$@" echo 'quoted text'
+	done x=1 x=1 'quoted text' grep ${HOME} 'quoted text' &&
+	/usr/bin 2>/dev/null /usr/bin
+sed local 'quoted text'
+		"$1" -eu echo --verbose /usr/bin 2>/dev/null 'quoted text'
+2>/dev/null -eu echo test $(pwd) sed
+		$(pwd) echo x=1 cd ${HOME} sed awk x=1 local done "$1"
+		readonly local awk 'quoted text' -eu /usr/bin printf x=1
+		'quoted text' grep grep local then 'quoted text' done awk --verbose && printf
+	| printf test done -eu && --verbose /usr/bin 2>/dev/null
+"$1" printf done done sed x=1 readonly x=1 x=1 /usr/bin export printf "$@" test
+		"$@" 'quoted text' awk
+	${HOME} readonly printf grep ${HOME} "$1" ${HOME} $(pwd) 'quoted text' awk $(pwd)
+&& grep $(pwd) sed cd --verbose cd sed "$@" grep 'quoted text' awk printf test
+	-eu | -eu $(pwd) | echo "$1" local awk local
+	"$@" x=1 export then echo sed readonly /usr/bin cd test test then echo "$1"
+sed sed sed export done /usr/bin
+| done 2>/dev/null $(pwd) then local --verbose "$@" then
+		readonly cd test cd echo local /usr/bin
+		${HOME} readonly x=1 --verbose "$@" cd awk local test done local ${HOME}
+| printf "$1" then done /usr/bin --verbose
+then ${HOME} done /usr/bin test "$1"
+		cd readonly then awk readonly grep /usr/bin -eu x=1 -eu -eu --verbose
+		cd 2>/dev/null printf test local ${HOME} done done
+	echo | local -eu "$1" x=1 'quoted text' --verbose
+test readonly test "$@" test then echo then readonly
+		x=1 2>/dev/null 2>/dev/null local then export printf 2>/dev/null
+	x=1 readonly x=1 awk readonly $(pwd)
+	/usr/bin 'quoted text' cd sed -eu -eu local sed ${HOME} && "$@"
+done x=1 /usr/bin 2>/dev/null grep "$@" "$1" 2>/dev/null awk -eu
+	$(pwd) -eu local 'quoted text' 'quoted text' cd echo $(pwd) /usr/bin
+		awk 2>/dev/null -eu /usr/bin ${HOME} $(pwd) /usr/bin
+sed awk 2>/dev/null 'quoted text' echo readonly --verbose 2>/dev/null awk
+readonly export grep sed ${HOME} readonly cd --verbose /usr/bin -eu
+	grep x=1 | awk done echo
+		grep sed && awk /usr/bin local /usr/bin $(pwd) |
+	${HOME} cd --verbose | 'quoted text' --verbose /usr/bin 2>/dev/null readonly /usr/bin
+done "$@" done local test ${HOME} --verbose "$@"
+	"$1" cd grep 2>/dev/null local
+		done sed test cd grep 'quoted text' --verbose sed grep then "$1"
+		local printf --verbose "$@" test
+		"$1" then awk cd sed -eu readonly done grep export printf
+		awk 2>/dev/null -eu echo test --verbose echo grep printf printf test 'quoted text'
+	&& cd -eu test done local -eu "$1" then x=1 'quoted text' "$@" test grep
+		awk test sed | /usr/bin done ${HOME} then
+		printf sed | printf grep "$@"
+	local | 'quoted text' x=1 cd done ${HOME} test then 2>/dev/null
+		"$1" test then $(pwd) | awk "$1" --verbose x=1 2>/dev/null
+	| 2>/dev/null $(pwd) 2>/dev/null grep
+		awk cd "$@" awk --verbose $(pwd) --verbose -eu
+		"$1" --verbose && /usr/bin "$1" sed
+		'quoted text' cd ${HOME}
+	"$1" -eu printf then export printf readonly x=1 && "$1" 'quoted text'
+		grep echo "$@" awk ${HOME} --verbose
+&& done readonly grep -eu awk readonly 2>/dev/null -eu
+then ${HOME} "$1" | -eu test export sed
+	cd && readonly ${HOME} local then then ${HOME} done grep /usr/bin --verbose
+cd export --verbose --verbose "$@" printf local && printf 2>/dev/null
+		done /usr/bin printf test echo printf && echo echo sed "$@" test
+	x=1 echo done export readonly ${HOME} --verbose echo
+	local awk -eu echo readonly printf cd echo
+	grep awk 2>/dev/null && then $(pwd)
+		-eu echo 'quoted text' grep done -eu echo readonly awk printf
+printf 2>/dev/null local "$@" export export ${HOME}
+		awk export ${HOME} then && "$@" done readonly printf | --verbose 2>/dev/null readonly
+		2>/dev/null | grep --verbose local then export 'quoted text'
+grep then -eu test cd local echo $(pwd)
+	echo "$@" -eu readonly
+${HOME} cd done | -eu printf grep printf ${HOME} -eu "$@"
+	2>/dev/null "$1" export grep && $(pwd) grep
+		printf sed --verbose readonly
+	"$@" echo /usr/bin 2>/dev/null
+	test printf ${HOME} /usr/bin $(pwd) cd
+cd test awk export 2>/dev/null $(pwd) readonly 2>/dev/null ${HOME} export
+/usr/bin test grep 'quoted text' 'quoted text' --verbose done | sed export 2>/dev/null
+		local /usr/bin $(pwd) "$@" export grep x=1
+| readonly export /usr/bin | grep |
+local $(pwd) 'quoted text' | echo export cd --verbose grep x=1 export
+		echo /usr/bin cd x=1 test grep "$1"
+		2>/dev/null x=1 "$1" cd x=1 "$1" ${HOME} 'quoted text' --verbose
+		grep then export /usr/bin --verbose 'quoted text' local
+	cd 2>/dev/null printf ${HOME}
+		--verbose /usr/bin "$@" echo --verbose test --verbose 'quoted text' readonly
+	sed echo --verbose printf $(pwd) echo "$1" printf
+		"$1" export cd grep ${HOME} grep awk --verbose /usr/bin
+$(pwd) sed echo "$1" ${HOME} && test export -eu
+then done sed /usr/bin sed export grep local "$1" ${HOME}
+		grep $(pwd) printf $(pwd) 2>/dev/null 2>/dev/null 'quoted text' grep -eu test ${HOME}
+		printf grep $(pwd) echo $(pwd) x=1 ${HOME} test sed x=1 echo ${HOME}
+sed "$1" test local "$1" readonly
+readonly cd then test local 2>/dev/null local grep x=1 ${HOME} grep -eu
+	echo ${HOME} "$1" "$1" export 2>/dev/null ${HOME} && --verbose printf
+		grep printf grep printf awk 'quoted text'
+	2>/dev/null then export local 2>/dev/null 2>/dev/null grep
+	export cd ${HOME} ${HOME} 2>/dev/null 'quoted text' cd x=1 readonly | /usr/bin
+		"$1" 2>/dev/null echo x=1 echo --verbose | 2>/dev/null sed
+done then test awk local
+	local done done sed printf 2>/dev/null
+local 'quoted text' done "$@" $(pwd) -eu cd grep && 'quoted text'
+	then sed --verbose local sed done 2>/dev/null echo export x=1 $(pwd)
+	sed local | printf "$1"
+	then /usr/bin cd sed "$1" $(pwd) grep 'quoted text' 'quoted text' | local
+		$(pwd) /usr/bin x=1 2>/dev/null cd test | test -eu x=1 then 'quoted text'
+		2>/dev/null ${HOME} grep test done cd test test local -eu
+-eu 'quoted text' printf export
+		printf grep /usr/bin "$@" cd echo sed | 2>/dev/null printf "$1" readonly -eu local
+		printf echo awk -eu 2>/dev/null export sed printf "$1" && -eu export test /usr/bin
+	test -eu -eu $(pwd) /usr/bin 'quoted text' printf echo echo
+		${HOME} readonly -eu grep -eu /usr/bin --verbose then readonly cd /usr/bin
+"$1" $(pwd) printf printf $(pwd)
+done --verbose ${HOME} -eu awk 'quoted text'
+		${HOME} printf done export /usr/bin
+	local cd --verbose awk --verbose echo "$1" local
+	grep && awk done echo -eu done x=1 then
+		sed awk test printf sed readonly local "$@" echo "$1" sed
+		2>/dev/null awk ${HOME} 'quoted text'
+printf awk printf $(pwd) ${HOME} "$1" 2>/dev/null 'quoted text' "$@" 'quoted text'
+'quoted text' cd $(pwd) 'quoted text'
+		x=1 | | done --verbose then ${HOME} awk 2>/dev/null 'quoted text' echo echo echo
+printf local "$@" then /usr/bin echo then
+	${HOME} local readonly printf echo 'quoted text' readonly 2>/dev/null export
+		readonly x=1 local awk "$1" ${HOME} cd cd export | awk -eu test
+	&& cd $(pwd) "$@" 'quoted text' awk sed 'quoted text'
+		2>/dev/null export --verbose -eu export test "$@"
+	local ${HOME} echo export
+-eu 'quoted text' x=1 sed printf readonly | -eu local 'quoted text' 'quoted text'
+	awk done grep done cd 'quoted text' grep local --verbose | 'quoted text' then
+	awk echo $(pwd) 2>/dev/null
+test $(pwd) && echo ${HOME} export | && cd && "$1" "$@" awk "$1" export grep sed
+&& export --verbose done $(pwd) sed then /usr/bin
+	"$@" | -eu 2>/dev/null echo
+	| printf $(pwd) local then done export then local local printf --verbose
+printf "$@" export echo
+echo /usr/bin && | sed export
+2>/dev/null && | | printf x=1
+	local --verbose /usr/bin echo | -eu cd local
+		--verbose && "$1" 2>/dev/null $(pwd) echo readonly test --verbose sed export
+"$@" test x=1 x=1 ${HOME} "$1" /usr/bin
+"$1" local grep printf then 2>/dev/null printf "$1"
+	awk 2>/dev/null echo cd x=1
+		printf $(pwd) done done then && "$1" -eu 2>/dev/null local export sed 2>/dev/null
+		export awk then && x=1
+"$@" test echo readonly readonly
+	$(pwd) echo "$@" cd awk done ${HOME} done ${HOME}
+		local grep grep x=1 x=1 ${HOME}
+		${HOME} sed && readonly then awk ${HOME} echo done && --verbose "$1" test -eu &&
+$(pwd) "$@" 'quoted text' echo
+		x=1 2>/dev/null 'quoted text'
+	-eu | cd -eu --verbose $(pwd) then local && local 2>/dev/null
+	local local x=1 echo 2>/dev/null /usr/bin x=1
+2>/dev/null then cd --verbose awk grep
+		readonly sed -eu local echo "$1" awk done 'quoted text'
+		2>/dev/null && grep grep export x=1 cd && readonly test
+		| 2>/dev/null $(pwd) 'quoted text'
+		sed grep 2>/dev/null 2>/dev/null test /usr/bin
+	/usr/bin test ${HOME} printf /usr/bin sed sed cd grep ${HOME} -eu --verbose |
+		-eu grep then awk --verbose grep /usr/bin echo test /usr/bin
+	x=1 'quoted text' cd grep "$@" awk done export done x=1 done printf -eu readonly
+	${HOME} sed readonly $(pwd) echo x=1 && then awk
+		then echo readonly x=1 /usr/bin readonly $(pwd) ${HOME} done --verbose |
+done --verbose readonly cd cd ${HOME}
+		local $(pwd) then sed 'quoted text'
+		readonly then printf local local "$@"
+		printf readonly 'quoted text' x=1 $(pwd) grep test test "$1" export then --verbose
+	echo awk echo grep sed 'quoted text' local test && echo "$@"
+		local test export cd test grep "$1" $(pwd) "$@" "$@" local printf ${HOME}
+"$1" awk sed | echo sed local ${HOME}
+	readonly --verbose awk -eu
+export --verbose awk echo grep echo echo --verbose grep printf 2>/dev/null ${HOME}
+	x=1 ${HOME} export export sed echo readonly ${HOME} 'quoted text' x=1 sed
+grep --verbose then 'quoted text' done local echo
+export echo x=1 grep /usr/bin $(pwd) printf sed ${HOME} $(pwd) local
+	x=1 ${HOME} --verbose ${HOME} printf "$1" done --verbose awk --verbose
+-eu $(pwd) -eu sed -eu sed awk done export && sed 'quoted text' grep --verbose
+test cd ${HOME} 'quoted text' $(pwd) | cd awk echo sed 'quoted text'
+test local "$@" grep export local
+	grep && local awk $(pwd) "$1" done 'quoted text' ${HOME} -eu
+grep grep --verbose "$1" test -eu $(pwd)
+		'quoted text' x=1 local readonly
+		then local --verbose sed grep | x=1 ${HOME} readonly x=1 sed sed 2>/dev/null
+		test /usr/bin "$1" 2>/dev/null printf "$1" done "$1" awk /usr/bin sed
+		-eu /usr/bin done test 'quoted text'
+	&& 'quoted text' local --verbose
+	| test then x=1 sed test $(pwd)
+		local export test cd $(pwd) | 2>/dev/null 2>/dev/null local "$@" awk "$1"
+| done awk --verbose && | test "$@" echo printf -eu 'quoted text'
+export -eu | 2>/dev/null echo 'quoted text' then | grep --verbose grep "$1"
+		then printf -eu && 'quoted text' printf done 2>/dev/null done test "$1" /usr/bin
+	$(pwd) $(pwd) awk cd /usr/bin --verbose echo echo done then --verbose readonly
+	printf grep local done -eu "$@" --verbose -eu -eu export
+	grep printf awk x=1 then |
+/usr/bin readonly x=1 grep 'quoted text' && echo cd $(pwd) then
+		test | awk printf 'quoted text'
+		"$@" echo x=1 'quoted text' && cd export x=1 -eu | ${HOME} test
+cd echo sed local echo $(pwd) ${HOME} && sed then echo "$@" -eu grep 2>/dev/null
+	sed sed "$1" echo local local echo "$@" readonly test grep
+	${HOME} 2>/dev/null "$@" /usr/bin test
+local --verbose printf ${HOME}
+		echo local local "$@" $(pwd) done 'quoted text' "$1" done
+'quoted text' $(pwd) readonly awk done readonly --verbose done /usr/bin
+	x=1 export ${HOME} export ${HOME} $(pwd) echo then echo ${HOME} done | "$@"
+--verbose --verbose x=1 $(pwd)
+		$(pwd) grep export grep x=1 --verbose "$@" then 2>/dev/null -eu ${HOME}
+done test | -eu test ${HOME} printf echo
+x=1 "$@" "$@" ${HOME} "$1"
+	'quoted text' cd then done then "$@" $(pwd)
+done export local x=1 test $(pwd) | && grep ${HOME} export then
+	&& && x=1 --verbose cd done 'quoted text' awk done then &&
+	$(pwd) awk done done
+"$1" "$@" 'quoted text'
+local echo echo $(pwd) 'quoted text'
+		test readonly local "$@" /usr/bin
+		x=1 --verbose 2>/dev/null done grep printf sed export --verbose then then
+local | done /usr/bin ${HOME} /usr/bin -eu grep printf test ${HOME} then --verbose
+	done /usr/bin "$@" "$1" | sed /usr/bin /usr/bin
+'quoted text' grep $(pwd) sed "$@" grep test --verbose 2>/dev/null "$@"
+		/usr/bin printf awk sed x=1 awk sed 2>/dev/null --verbose 'quoted text'
+	printf ${HOME} 2>/dev/null --verbose test awk ${HOME} -eu readonly
+		readonly -eu readonly awk "$1" ${HOME}
+x=1 printf echo then "$1" export sed "$1" --verbose /usr/bin
+		test awk test echo && && -eu ${HOME}
+		2>/dev/null printf -eu echo
+		grep readonly local --verbose grep
+test 'quoted text' printf $(pwd) $(pwd) sed echo
+		readonly && && 2>/dev/null "$1" then "$@" export printf /usr/bin
+		$(pwd) "$@" --verbose sed cd awk done $(pwd) readonly | awk readonly -eu echo
+	then awk readonly x=1 | "$@" 'quoted text' && echo sed echo sed
+	export -eu echo -eu awk awk readonly
+-eu sed x=1 "$@" then ${HOME} echo | x=1 2>/dev/null sed export --verbose
+		| printf then x=1 grep | ${HOME} "$1" done export grep ${HOME} cd then done
+/usr/bin /usr/bin 'quoted text'
+		test "$@" then awk awk awk -eu --verbose -eu && local $(pwd) |
+	readonly echo "$@" awk && --verbose
+		${HOME} 2>/dev/null awk printf then $(pwd)
+x=1 -eu grep export 2>/dev/null
+export ${HOME} printf echo ${HOME}
+	x=1 grep --verbose ${HOME} readonly
+grep --verbose then "$1"
+		cd readonly "$@" awk printf --verbose && 2>/dev/null
+		local "$1" cd "$1" echo $(pwd) done -eu grep --verbose && -eu --verbose "$1" export
+		test /usr/bin done sed printf local "$1" awk x=1
+		"$@" | $(pwd) --verbose | /usr/bin
+	test && cd cd grep -eu sed -eu test --verbose
+'quoted text' --verbose 'quoted text' echo then test export
+"$1" awk awk local grep local echo --verbose /usr/bin local "$1"
+| 2>/dev/null --verbose --verbose | then "$@" echo &&
+		printf echo && /usr/bin export export sed ${HOME} grep printf "$1"
+		done ${HOME} sed x=1 readonly done --verbose 'quoted text' ${HOME} printf
+	/usr/bin x=1 local 2>/dev/null export | export readonly then
+	x=1 'quoted text' x=1 grep cd cd printf echo export
+		'quoted text' /usr/bin --verbose 2>/dev/null cd "$@" awk
+	awk 2>/dev/null export sed x=1 "$1" x=1 echo && /usr/bin
+	done awk export "$@" grep local test echo && done "$@" local 'quoted text'
+grep ${HOME} grep export /usr/bin x=1 x=1 | 2>/dev/null awk -eu 'quoted text'
+	grep test --verbose done x=1 sed export
+		--verbose 'quoted text' readonly echo done -eu then export local 2>/dev/null
+		--verbose /usr/bin then /usr/bin test printf "$@" echo awk 2>/dev/null
+		--verbose awk then 2>/dev/null then
+		then -eu $(pwd) readonly ${HOME} then test done $(pwd)
+		printf && --verbose printf
+	--verbose sed echo test sed echo x=1 cd "$@"
+	then then /usr/bin "$1"
+		sed cd then && | -eu readonly --verbose export grep grep cd
+	awk grep export export $(pwd) export grep 2>/dev/null printf readonly |
+		${HOME} -eu 2>/dev/null x=1 /usr/bin 'quoted text'
+x=1 cd test grep ${HOME} 'quoted text' 2>/dev/null "$@" cd 'quoted text'
+	"$1" test "$@" then && sed echo $(pwd) $(pwd)
+		x=1 $(pwd) | sed | local --verbose | sed &&
+		| --verbose 'quoted text' x=1 $(pwd) test sed export printf
+	readonly "$@" done --verbose "$1"
+test export x=1 echo
+		2>/dev/null $(pwd) --verbose "$@" $(pwd)
+		test printf 2>/dev/null grep grep then $(pwd)
+		export -eu 2>/dev/null echo test local /usr/bin printf grep 'quoted text'
+	grep $(pwd) grep awk $(pwd) x=1
+		cd export test /usr/bin && | && awk readonly x=1 export "$@" $(pwd) "$1"
+		test readonly --verbose x=1 2>/dev/null
+test local done cd local readonly && printf | readonly
+	readonly "$1" readonly /usr/bin export $(pwd) | --verbose x=1
+	local cd then readonly then done grep "$@" echo | sed
+		readonly then --verbose done | -eu 'quoted text'
+export 'quoted text' /usr/bin
+		grep 'quoted text' awk cd printf sed && printf cd ${HOME} sed "$@" awk sed 2>/dev/null
+	grep -eu sed 'quoted text' test readonly local sed $(pwd)
+	2>/dev/null awk x=1 export 2>/dev/null awk | /usr/bin grep echo "$1" --verbose
+		echo /usr/bin "$@" /usr/bin -eu sed grep echo printf grep readonly
+| | "$@" export | | -eu 2>/dev/null ${HOME}
+		&& echo echo x=1 sed 2>/dev/null then
+		then $(pwd) printf local sed 2>/dev/null grep $(pwd)
+	--verbose readonly --verbose readonly --verbose sed --verbose && $(pwd) grep
+'quoted text' "$1" ${HOME} awk done && 2>/dev/null
+		| grep x=1 "$1" sed --verbose grep test -eu | 'quoted text' -eu sed && 2>/dev/null
+	sed -eu 2>/dev/null sed local cd printf
+cd then | awk printf x=1 'quoted text' 'quoted text' export
+	/usr/bin cd cd readonly | export
+		grep cd echo "$1" echo done done echo
+/usr/bin printf | 'quoted text'
+		"$@" | ${HOME} "$@" 'quoted text' cd --verbose && sed "$1"
+	x=1 readonly --verbose
+		then export 2>/dev/null echo ${HOME}
+		$(pwd) sed cd cd grep echo readonly test grep local readonly
+		sed --verbose awk grep cd x=1 /usr/bin export printf "$@"
+	printf /usr/bin test && grep then done export x=1 --verbose
+		printf sed $(pwd) printf printf sed 2>/dev/null "$1" local cd 'quoted text'
+		then sed && export $(pwd) printf --verbose
+${HOME} $(pwd) x=1 then "$@" readonly
+		x=1 && "$@" --verbose "$1" grep done local
+	awk --verbose export "$1" test readonly $(pwd) awk cd
+		${HOME} ${HOME} local grep done "$@" ${HOME}
+		${HOME} test 2>/dev/null printf ${HOME} -eu 2>/dev/null
+		export "$@" --verbose | && printf x=1 /usr/bin
+'quoted text' x=1 printf export $(pwd) export awk "$@" cd -eu readonly /usr/bin
+		test ${HOME} ${HOME} readonly printf cd
+	2>/dev/null --verbose printf 'quoted text' awk grep -eu awk grep x=1 local
+		2>/dev/null sed readonly cd done readonly 'quoted text' | | "$1" x=1 cd then test
+	then echo then "$1" --verbose then ${HOME}
+		&& 'quoted text' readonly awk echo cd local 2>/dev/null
+	&& -eu /usr/bin 'quoted text' 2>/dev/null then "$@" -eu sed echo echo printf
+		x=1 ${HOME} sed --verbose test test echo grep
+$(pwd) grep ${HOME} export readonly export awk
+	readonly "$1" cd | cd local && /usr/bin -eu x=1 $(pwd)
+		then grep && test x=1
+	then | printf echo readonly && printf 2>/dev/null -eu grep | | 2>/dev/null
+	grep readonly x=1 && x=1 printf && grep -eu export "$1" awk test 2>/dev/null /usr/bin
+		'quoted text' printf 2>/dev/null export sed export done
+	awk then sed local grep
+export 'quoted text' && awk sed 'quoted text' echo export readonly then
+	echo done done test && grep $(pwd)
+sed awk | sed done done && -eu 2>/dev/null
+grep done grep test local 2>/dev/null
+| --verbose --verbose "$1" x=1 test awk sed local /usr/bin "$1"
+	local echo -eu "$@" | then $(pwd) 'quoted text' grep --verbose
+awk grep done echo "$@" sed 2>/dev/null printf local sed
+		-eu sed 'quoted text' x=1
+-eu awk local "$1" 'quoted text' export printf sed test
+awk readonly 'quoted text' $(pwd) grep "$1" printf local 2>/dev/null
+		readonly | x=1 cd "$1" x=1 then echo 'quoted text'
+then local awk sed "$1" -eu $(pwd) /usr/bin then printf 'quoted text'
+	export then export echo test $(pwd) local awk grep printf /usr/bin
+'quoted text' "$1" local -eu "$1" -eu printf $(pwd)
+		'quoted text' "$1" done x=1 && cd && local grep done "$1" 'quoted text' grep
+	cd "$@" /usr/bin -eu printf "$1"
+		local test test readonly
+		then 2>/dev/null "$@" $(pwd) local sed export | sed 2>/dev/null
+		export test && done export done
+		-eu awk grep test local --verbose 2>/dev/null
+	&& | test readonly |
+	${HOME} then echo ${HOME} | ${HOME} awk | x=1 "$1" then printf && done echo
+grep x=1 readonly $(pwd) sed
+		grep 'quoted text' x=1 done test | "$@"
+2>/dev/null "$1" -eu ${HOME} 2>/dev/null "$1" done printf cd sed "$@" &&
+sed $(pwd) then 'quoted text' export
+2>/dev/null printf 2>/dev/null printf $(pwd) awk -eu ${HOME}
+	&& 2>/dev/null | awk 2>/dev/null --verbose sed test printf x=1 done
+		'quoted text' "$1" grep export grep && grep -eu readonly echo local /usr/bin
+		$(pwd) printf /usr/bin -eu done /usr/bin
+	awk 2>/dev/null && export then | sed $(pwd) | ${HOME}
+	-eu then -eu grep 2>/dev/null
+	${HOME} awk grep --verbose cd 2>/dev/null && done local x=1 "$@" test grep
+		&& grep --verbose sed done && "$1" 2>/dev/null $(pwd) /usr/bin sed then
+	awk -eu cd $(pwd) done
+export 2>/dev/null $(pwd) x=1 done grep "$1" then local -eu "$1" /usr/bin
+/usr/bin --verbose /usr/bin done sed awk $(pwd)
+		| $(pwd) --verbose grep | printf $(pwd) --verbose echo "$1" ${HOME}
+test $(pwd) --verbose /usr/bin $(pwd) 'quoted text'
+	/usr/bin -eu done 'quoted text'
+		readonly "$@" /usr/bin | echo
+		readonly printf readonly local readonly | grep echo ${HOME} $(pwd)
+		grep sed 'quoted text' | -eu
+test awk && ${HOME} export done test grep done /usr/bin export --verbose |
+$(pwd) && "$1" --verbose "$1" && echo /usr/bin x=1 /usr/bin
+	'quoted text' 2>/dev/null && grep 'quoted text' "$@" awk ${HOME}
+		export readonly readonly export $(pwd) sed 2>/dev/null -eu awk local "$@" printf
+		2>/dev/null readonly | | readonly then x=1 /usr/bin echo "$1" readonly "$1"
+	cd then && sed grep -eu ${HOME} --verbose awk --verbose cd "$1" $(pwd) local $(pwd)
+		'quoted text' /usr/bin && local local 2>/dev/null test sed export | 'quoted text'
+	echo | "$@" $(pwd) "$@" "$@" $(pwd) local --verbose | grep cd local local "$1"
+	awk readonly test /usr/bin cd local export export
+	| x=1 awk -eu sed 'quoted text' done --verbose test && grep readonly cd
+'quoted text' $(pwd) /usr/bin -eu x=1 cd /usr/bin ${HOME} then cd x=1 done
+--verbose -eu /usr/bin
+	2>/dev/null "$1" "$1" && sed cd
+		awk | 2>/dev/null local && sed test then --verbose ${HOME} -eu /usr/bin && echo
+	sed done ${HOME} 2>/dev/null echo sed export
+	2>/dev/null 'quoted text' sed grep $(pwd) readonly cd "$@" sed done sed $(pwd)
+"$@" "$@" ${HOME} cd x=1 x=1
+	sed --verbose $(pwd) readonly ${HOME} | printf 2>/dev/null then awk
+	'quoted text' /usr/bin && export $(pwd) "$1" done 2>/dev/null
+		cd grep grep 2>/dev/null 'quoted text' 'quoted text'
+		&& awk $(pwd) done grep readonly readonly done 'quoted text' --verbose
+readonly --verbose done 'quoted text' 'quoted text' echo export sed done 2>/dev/null
+		grep $(pwd) done echo then "$@" "$1" then test $(pwd) test $(pwd) test ${HOME}
+	-eu 'quoted text' sed | grep then awk 'quoted text' local local awk -eu then printf
+	| 'quoted text' printf local ${HOME}
+	sed test export -eu readonly 'quoted text' done readonly awk done x=1 --verbose
+export cd readonly "$@" printf 'quoted text' "$@"
+x=1 x=1 /usr/bin x=1 printf x=1 grep test
+		readonly local | readonly done local local /usr/bin local
+	"$1" awk x=1 /usr/bin "$1" x=1 "$1" 'quoted text' awk
+		x=1 sed $(pwd) done sed sed test awk "$@" done then test -eu echo
+cd 2>/dev/null $(pwd) x=1 /usr/bin awk $(pwd) export echo /usr/bin --verbose
+sed echo --verbose grep awk && ${HOME} done then cd | ${HOME} 2>/dev/null then
+x=1 echo /usr/bin local x=1 export printf
+		export test $(pwd) -eu echo done "$1" cd sed printf --verbose
+	x=1 test 'quoted text' readonly "$1" cd ${HOME}
+	printf grep "$1" /usr/bin printf printf
+	--verbose awk x=1 "$@" readonly done test x=1 export then 2>/dev/null test sed
+	done && x=1 sed then /usr/bin test export cd | ${HOME} ${HOME} --verbose ${HOME}
+		cd --verbose ${HOME} /usr/bin awk x=1 "$@" "$@" test -eu ${HOME} then grep $(pwd)
+	grep "$@" grep "$1" "$1" cd 2>/dev/null printf local then export
+		readonly local 2>/dev/null sed $(pwd) --verbose then "$1" echo
+		sed test export awk && then $(pwd) 2>/dev/null readonly local "$@"
+		done "$@" done export 'quoted text'
+		| --verbose $(pwd) ${HOME} then ${HOME} | x=1 $(pwd)
+		"$@" sed local "$@" export 2>/dev/null sed test test && 'quoted text'
+done awk -eu --verbose printf /usr/bin grep "$@"
+readonly $(pwd) 'quoted text' test ${HOME} --verbose
+	done grep -eu then local /usr/bin grep
+sed cd -eu x=1 grep done readonly cd export
+	"$1" cd done cd 'quoted text' test ${HOME} echo ${HOME}
+	/usr/bin x=1 /usr/bin grep /usr/bin 'quoted text'
+		readonly grep cd && "$1" then printf | done /usr/bin readonly
+	2>/dev/null printf --verbose ${HOME} "$@" -eu "$@" sed then then && echo readonly
+		echo | readonly printf
+		'quoted text' && local printf $(pwd) local "$1" 2>/dev/null grep
+		cd 'quoted text' local printf done && | "$1" $(pwd) echo $(pwd)
+test $(pwd) "$1" cd printf x=1 readonly readonly 2>/dev/null
+	readonly --verbose done
+	readonly readonly echo
+	test --verbose local printf test -eu printf "$1" ${HOME} then x=1 "$@" done
+	local local | 'quoted text' then echo --verbose 2>/dev/null readonly sed
+		cd local printf "$1" awk sed printf sed local $(pwd) cd
+	x=1 -eu 2>/dev/null -eu then && awk echo && export grep printf printf sed ${HOME}
+sed awk "$@" | grep printf readonly 2>/dev/null "$1" "$1" readonly x=1 x=1 sed
+		'quoted text' --verbose --verbose --verbose x=1 -eu grep export cd grep done
+2>/dev/null then then then 'quoted text' --verbose
+grep ${HOME} ${HOME} /usr/bin
+		local sed then ${HOME} readonly
+export test cd then local sed && 2>/dev/null local 2>/dev/null
+		--verbose echo && ${HOME} export ${HOME} readonly
+	then --verbose test test sed echo $(pwd) sed && && then
+	-eu export && local | -eu ${HOME} awk sed done sed local awk "$@"
+&& awk /usr/bin cd $(pwd) done sed test ${HOME} printf sed -eu test sed done
+		"$1" printf echo && export cd "$1" grep sed then awk
+		echo -eu "$1" echo /usr/bin
+	/usr/bin grep echo ${HOME} 2>/dev/null && && cd local local 2>/dev/null echo "$1"
+local cd grep $(pwd) awk readonly cd echo x=1 | ${HOME} grep cd 2>/dev/null printf
+printf test --verbose printf
+local && echo export printf then | "$@" 'quoted text' $(pwd) x=1 printf &&
+	sed awk "$1" && --verbose then export
+	"$1" -eu | grep sed printf
+'quoted text' && export test done --verbose
+"$@" sed printf sed done
+"$@" done awk ${HOME} $(pwd) cd --verbose -eu local
+	| test echo readonly -eu 2>/dev/null 2>/dev/null /usr/bin ${HOME} test echo
+echo && readonly /usr/bin
+		&& /usr/bin local grep 2>/dev/null
+		grep -eu | then readonly $(pwd) /usr/bin
+		local /usr/bin $(pwd) test test
+		${HOME} echo x=1 x=1 ${HOME} local "$1" && x=1 "$@" sed printf test local
+		sed -eu done awk x=1 --verbose cd test
+sed "$1" $(pwd) | $(pwd) sed readonly --verbose -eu
+	sed readonly done cd sed then
+readonly grep && test done printf cd readonly cd echo 'quoted text' "$1" -eu
+		$(pwd) printf /usr/bin printf --verbose test x=1 awk
+	test printf then "$1" $(pwd) test "$1" "$1"
+	&& local cd 2>/dev/null | printf echo --verbose "$@" awk | $(pwd) 'quoted text'
+		sed echo test grep local "$1" "$1" x=1 awk 'quoted text'
+		done then /usr/bin 2>/dev/null cd sed
+| cd cd /usr/bin x=1 'quoted text'
+		echo test export x=1 readonly
+x=1 /usr/bin $(pwd) test && ${HOME} export /usr/bin echo done 'quoted text' --verbose
+		&& echo readonly && printf export export && /usr/bin echo "$1" && awk then
+	"$@" "$@" /usr/bin -eu then
+	cd 'quoted text' then "$1" $(pwd) awk awk $(pwd) done x=1
+-eu then printf cd printf
+		&& "$1" local "$1" grep export
+		'quoted text' export printf local echo sed export echo
+		cd echo then -eu /usr/bin then grep awk local --verbose printf --verbose x=1 'quoted text'
+'quoted text' --verbose export | --verbose test
+	"$1" ${HOME} "$1" -eu done --verbose done done 2>/dev/null "$@" -eu awk local
+	| && 2>/dev/null /usr/bin local grep sed ${HOME} printf
+sed "$1" test ${HOME} echo readonly 'quoted text' test
+		&& sed x=1 echo awk cd ${HOME}
+		"$1" done done -eu && /usr/bin export done awk
+		"$1" test echo ${HOME} printf
+2>/dev/null then /usr/bin grep &&
+	'quoted text' grep && x=1 test grep
+		| export /usr/bin then /usr/bin
+grep readonly 'quoted text' export -eu "$1" | /usr/bin local 'quoted text'
+	"$1" 'quoted text' $(pwd) then ${HOME} awk printf "$@" local
+		'quoted text' then "$1" | 2>/dev/null
+x=1 export echo awk then cd | sed ${HOME} sed done "$1" --verbose
+'quoted text' awk readonly local
+-eu && readonly "$@" "$1" done export x=1 cd --verbose
+	${HOME} grep then grep local $(pwd) cd awk 2>/dev/null readonly
+	echo grep test export "$1" x=1 test -eu /usr/bin echo echo cd 2>/dev/null
+		cd "$1" 'quoted text' echo
+	&& --verbose "$1" 'quoted text'
+printf echo echo export -eu /usr/bin -eu
+echo --verbose test echo done "$1" 'quoted text'
+	awk done awk -eu --verbose sed | x=1
+	/usr/bin /usr/bin -eu -eu 2>/dev/null done -eu
+		"$@" /usr/bin $(pwd) awk --verbose $(pwd) ${HOME} ${HOME} 2>/dev/null export grep
+--verbose x=1 sed | "$1" --verbose
+"$1" 2>/dev/null && -eu sed | test test 'quoted text' |
+		x=1 | then test "$@" sed printf cd /usr/bin then
+	$(pwd) done readonly --verbose readonly local printf echo grep /usr/bin local
+	| then /usr/bin test echo /usr/bin "$@" | export
+| awk echo sed 2>/dev/null 2>/dev/null ${HOME} --verbose sed $(pwd) cd export
+	$(pwd) ${HOME} /usr/bin echo readonly | -eu | echo
+		2>/dev/null "$@" sed ${HOME} readonly
+readonly printf x=1 ${HOME} awk export --verbose -eu "$@" "$1" then
+		"$@" done then x=1 ${HOME} export printf readonly "$@" | 'quoted text' |
+/usr/bin 2>/dev/null 2>/dev/null $(pwd) -eu ${HOME} ${HOME} cd local ${HOME} awk
+	'quoted text' $(pwd) "$1" ${HOME} ${HOME} grep ${HOME} 'quoted text'
+		sed printf "$1" ${HOME} test ${HOME} echo |
+		$(pwd) cd local done 2>/dev/null
+		grep 2>/dev/null /usr/bin $(pwd) | x=1 'quoted text'
+		${HOME} 2>/dev/null sed grep $(pwd)
+	2>/dev/null $(pwd) printf --verbose
+		awk then printf --verbose -eu "$@" test "$@" /usr/bin then
+sed | awk awk then ${HOME} export export 2>/dev/null x=1 ${HOME} readonly
+		readonly done export local readonly export
+		'quoted text' 2>/dev/null | "$1" x=1 printf sed
+		grep ${HOME} /usr/bin && $(pwd) done ${HOME} cd x=1 'quoted text'
+		'quoted text' "$1" | sed export ${HOME} grep /usr/bin ${HOME} $(pwd)
+		awk done | awk -eu ${HOME} printf -eu
+	test done test awk local grep "$@" test cd export "$1" -eu 'quoted text'
+		test $(pwd) grep -eu readonly 'quoted text' && 2>/dev/null
+export "$@" awk local $(pwd) x=1 printf printf "$1" $(pwd) grep printf local then
+		test awk echo cd awk export 'quoted text'
+	grep sed -eu -eu test
+	test grep 'quoted text' && readonly printf "$1" "$1" readonly printf printf
+	printf echo grep "$@" local
+	"$@" --verbose local export test
+x=1 -eu then && then local echo export export test --verbose readonly sed
+	local ${HOME} 2>/dev/null echo 'quoted text'
+${HOME} grep "$1" echo then then $(pwd) "$1" "$@" ${HOME}
+	printf printf cd readonly 'quoted text'
+	${HOME} done awk local -eu grep -eu readonly && sed ${HOME} /usr/bin
+		cd sed test test && readonly grep cd export export
+		/usr/bin sed ${HOME} "$@" then then 2>/dev/null export printf
+	done --verbose && && cd 2>/dev/null "$1" -eu export
+echo sed sed && echo "$1" grep then then -eu /usr/bin awk 2>/dev/null
+	${HOME} ${HOME} export local sed $(pwd) "$@" && -eu cd 'quoted text'
+	export awk grep echo awk test ${HOME} sed 'quoted text' cd ${HOME} printf
+		test ${HOME} awk grep $(pwd) then | test "$1" -eu
+		/usr/bin echo readonly readonly printf "$1" export &&
+	/usr/bin "$1" awk echo echo ${HOME} --verbose
+	x=1 echo sed local test done
+	${HOME} then "$@" grep && x=1 && &&
+	-eu x=1 && --verbose 'quoted text' $(pwd) 2>/dev/null
+	grep awk cd done && sed --verbose ${HOME} cd local $(pwd) ${HOME}
+	| $(pwd) 'quoted text' sed test "$@" "$1" awk grep grep cd 'quoted text'
+	echo "$1" sed 2>/dev/null echo export grep $(pwd) x=1
+	then awk done /usr/bin local | -eu echo then cd ${HOME}
+	/usr/bin "$1" --verbose then x=1 cd | -eu ${HOME} && export -eu then "$@"
+		'quoted text' "$@" printf printf -eu test ${HOME} "$@"
+	"$1" 2>/dev/null done awk grep 2>/dev/null then /usr/bin "$1" | done
+	export /usr/bin && local
+	local $(pwd) x=1 && /usr/bin "$1" /usr/bin -eu x=1
+		export x=1 ${HOME} printf test $(pwd) "$1" sed export
+then $(pwd) test -eu grep 2>/dev/null cd x=1 local
+	"$1" x=1 echo 'quoted text'
+-eu local done cd "$1" /usr/bin then then printf /usr/bin
+	"$@" cd 'quoted text' local ${HOME} grep | --verbose readonly then /usr/bin 'quoted text'
+		sed && readonly sed ${HOME} test 2>/dev/null echo ${HOME} --verbose | test
+		$(pwd) | && echo && |
+'quoted text' --verbose | 'quoted text' printf then export && "$@"
+	-eu x=1 | test sed x=1 local
+	readonly grep echo echo grep done x=1 done $(pwd) 2>/dev/null "$1"
+	${HOME} awk printf awk sed /usr/bin then then
+local sed cd -eu echo awk /usr/bin then awk grep /usr/bin
+		local "$@" && then -eu ${HOME} then printf ${HOME} awk grep then local
+		sed test done 'quoted text' $(pwd) grep --verbose readonly readonly
+2>/dev/null x=1 cd /usr/bin done cd "$1" | sed awk readonly && printf
+	&& done /usr/bin $(pwd) done $(pwd) 2>/dev/null ${HOME} printf awk awk
+		awk --verbose --verbose printf sed && "$@" "$1" readonly -eu "$1" awk
+	--verbose then x=1 2>/dev/null x=1 /usr/bin printf $(pwd) x=1 readonly 2>/dev/null
+	test sed then --verbose
+	--verbose /usr/bin done --verbose printf export awk && test "$@" export
+	cd | "$@" --verbose && local --verbose && x=1 2>/dev/null local readonly export
+		"$@" export export export readonly /usr/bin | echo printf readonly local echo
+	$(pwd) ${HOME} export -eu readonly $(pwd) grep local readonly awk x=1 2>/dev/null
+echo && 'quoted text' sed
+${HOME} sed local --verbose "$@" cd
+		| x=1 ${HOME} && x=1 "$1" /usr/bin awk cd
+"$@" "$1" $(pwd) && /usr/bin && 2>/dev/null test test ${HOME} readonly --verbose
+test ${HOME} sed cd 'quoted text' x=1 awk && "$@" sed -eu && ${HOME} then
+'quoted text' sed then 2>/dev/null export local $(pwd) "$@" "$@"
+	test done then ${HOME}
+	grep sed 2>/dev/null /usr/bin --verbose sed "$1" "$@" sed $(pwd) then echo
+echo then grep sed /usr/bin | $(pwd) then
+${HOME} $(pwd) ${HOME} test done echo
+	&& $(pwd) done $(pwd) then x=1 sed sed $(pwd) done awk done /usr/bin "$1" awk "$1"
+2>/dev/null 'quoted text' test grep
+		$(pwd) 'quoted text' then readonly grep local echo "$@" /usr/bin printf $(pwd)
+		x=1 export x=1 "$1" 'quoted text' "$@" x=1 printf then && export && "$1" --verbose
+		/usr/bin ${HOME} done 'quoted text'
+	done cd && export grep -eu -eu x=1 export ${HOME} grep
+		'quoted text' | test && "$1" /usr/bin
+readonly $(pwd) x=1 done "$1"
+		awk -eu printf export &&
+		| $(pwd) "$@" 2>/dev/null
+2>/dev/null 2>/dev/null local | grep "$@" readonly x=1 echo export sed
+readonly x=1 done cd ${HOME} local then sed /usr/bin
+		readonly $(pwd) readonly -eu && x=1 --verbose
+printf printf grep cd cd "$1" then
+		"$@" awk done $(pwd) && echo ${HOME}
+	-eu --verbose --verbose sed -eu then "$@" 2>/dev/null "$1"
+	'quoted text' then $(pwd)
+	cd cd grep 2>/dev/null | local /usr/bin x=1 | local export
+	awk echo echo sed grep local local
+		$(pwd) then "$1" | test cd then /usr/bin
+		readonly export awk 2>/dev/null -eu ${HOME} 'quoted text' | done 'quoted text'
+	grep sed readonly done | readonly | "$1" 'quoted text'
+	2>/dev/null test x=1 done local local ${HOME} grep x=1 printf x=1
+		export cd echo then && awk done "$1" awk cd sed "$@" $(pwd) grep 2>/dev/null
+		-eu test x=1 --verbose local ${HOME}
+--verbose grep --verbose done done export
+		| cd done "$@" 'quoted text' --verbose "$1" export | printf printf readonly
+export printf --verbose $(pwd)
+x=1 | "$@" sed awk && done
+	printf sed printf echo
+	awk 2>/dev/null "$1" echo echo "$1" echo /usr/bin
+${HOME} readonly 'quoted text' 'quoted text' echo x=1 export && 2>/dev/null
+		local sed sed --verbose $(pwd) "$1" /usr/bin
+	-eu 'quoted text' printf 2>/dev/null | local then sed grep "$@"
+	awk sed x=1 -eu && | | printf cd cd sed sed "$@" && done -eu test
+2>/dev/null --verbose -eu "$@" export 'quoted text' && --verbose |
+		printf readonly printf $(pwd) done
+	cd echo | export done
+		grep printf /usr/bin awk printf 2>/dev/null $(pwd)
+		| sed awk | export 'quoted text' awk x=1 then then ${HOME} --verbose
+'quoted text' done && ${HOME} then done /usr/bin x=1 --verbose awk 'quoted text'
+	sed export /usr/bin "$1" awk printf x=1 /usr/bin
+done export test grep -eu 2>/dev/null
+	grep -eu done export $(pwd) awk then 2>/dev/null 2>/dev/null
+	-eu "$@" /usr/bin /usr/bin "$1" done then cd --verbose
+		'quoted text' then grep readonly --verbose x=1 ${HOME} "$1" local
+		2>/dev/null x=1 cd --verbose x=1 sed done -eu grep then /usr/bin
+	test cd && test printf && 2>/dev/null awk then local 'quoted text'
+		local echo then "$@" && echo sed
+		then | done printf awk | ${HOME} readonly awk
+'quoted text' then x=1 -eu done "$1" "$1"
+printf ${HOME} printf grep echo x=1 awk 'quoted text'
+| "$@" echo "$@" ${HOME} -eu grep readonly $(pwd) --verbose
+$(pwd) then cd local sed readonly "$@" local ${HOME} readonly "$1" awk printf
+	readonly grep echo $(pwd) printf grep 2>/dev/null 'quoted text'
+		export local grep 2>/dev/null sed --verbose then && && sed local
+		readonly "$@" local local grep grep &&
+		done && 2>/dev/null local local test done &&
+	"$@" x=1 --verbose /usr/bin test $(pwd) done echo done | /usr/bin
+	--verbose $(pwd) echo done sed "$@" "$@"
+		awk readonly "$1" cd grep /usr/bin then $(pwd)
+	&& then -eu test echo $(pwd) --verbose
+2>/dev/null then test cd --verbose --verbose
+${HOME} printf "$@" grep ${HOME} printf 2>/dev/null
+		then done "$1" cd awk "$1" "$1" cd sed -eu readonly printf 'quoted text'
+'quoted text' test printf --verbose $(pwd) x=1 cd
+test local grep readonly 'quoted text'
+--verbose /usr/bin -eu --verbose cd /usr/bin "$@" export sed then --verbose
+		&& -eu done readonly -eu printf 'quoted text' /usr/bin x=1
+		$(pwd) --verbose /usr/bin "$1"
+	readonly x=1 --verbose printf x=1 export /usr/bin printf &&
+	grep --verbose cd cd sed ${HOME} sed x=1 | then
+	done | | 'quoted text' x=1 cd /usr/bin readonly local done readonly &&
+		cd 'quoted text' ${HOME} && $(pwd) $(pwd)
+cd then done 'quoted text' sed echo sed sed sed echo
@@ -0,0 +1,2001 @@
+readonly then done cd done printf -eu 2>/dev/null
+	sed $(pwd) ${HOME} local /usr/bin && -eu | && printf /usr/bin x=1
+		test "$@" export printf printf export ${HOME} printf grep readonly
+x=1 && cd "$1" readonly $(pwd) grep -eu local printf --verbose
+	echo test awk /usr/bin local -eu $(pwd) "$@" ${HOME}
+		--verbose then x=1 done && cd sed awk printf grep "$@"
+/usr/bin readonly done -eu /usr/bin
+	/usr/bin export sed "$1" --verbose sed 'quoted text' cd "$1" | | done /usr/bin
+	printf printf readonly printf local /usr/bin 2>/dev/null "$1" | then
+sed cd local sed export then grep | 2>/dev/null "$1" 'quoted text' then
+	"$1" /usr/bin ${HOME} readonly $(pwd)
+	${HOME} --verbose "$@" done grep sed && $(pwd) export
+		done $(pwd) done done ${HOME} "$1" /usr/bin
+	-eu 2>/dev/null printf
+	local export ${HOME} ${HOME} "$1" 2>/dev/null
+${HOME} export 2>/dev/null 'quoted text' echo then 'quoted text'
+export then test "$1" x=1 printf test local x=1 2>/dev/null
+$(pwd) local "$@" then "$@" export "$@"
+	| printf x=1 done x=1 sed sed && --verbose local
+		done readonly cd done /usr/bin grep done 'quoted text' test 2>/dev/null
+	-eu --verbose 2>/dev/null
+		| test | grep --verbose
+/usr/bin local local /usr/bin x=1 readonly /usr/bin && "$@" && sed done
+printf 'quoted text' readonly local grep "$1"
+		printf sed awk /usr/bin --verbose
+/usr/bin ${HOME} export 'quoted text' echo | export | readonly
+	&& readonly && echo printf done x=1
+x=1 /usr/bin printf --verbose awk /usr/bin test
+	x=1 sed printf local cd awk ${HOME} && export --verbose
+		--verbose readonly | $(pwd) grep sed sed x=1 grep
+		local local printf && x=1 "$@" printf
+		"$@" readonly sed export -eu "$@" sed x=1 /usr/bin ${HOME} && awk test
+		'quoted text' $(pwd) then && export local printf local
+		done test export -eu local readonly 'quoted text' && readonly
+	${HOME} grep done /usr/bin
+	'quoted text' sed cd printf 2>/dev/null "$@"
+		"$1" sed printf --verbose "$@"
+	"$@" printf done "$@" 2>/dev/null
+	printf export 2>/dev/null
+	export test export awk local /usr/bin
+&& awk 'quoted text' x=1 /usr/bin sed printf sed echo && $(pwd) printf cd ${HOME}
+		then /usr/bin cd awk | local readonly
+	'quoted text' 2>/dev/null printf export | /usr/bin grep x=1 readonly
+grep "$@" local $(pwd) 2>/dev/null printf local export 2>/dev/null ${HOME}
+		/usr/bin -eu && then then local $(pwd) cd export readonly cd echo
+"$@" readonly readonly | cd ${HOME} cd printf then awk "$@" cd test &&
+	cd "$@" awk sed then x=1 "$1" -eu grep 'quoted text' cd grep ${HOME}
+		$(pwd) /usr/bin cd $(pwd) done && x=1 local -eu readonly
+	export 2>/dev/null --verbose
+local 2>/dev/null -eu local $(pwd) local done /usr/bin
+	readonly done --verbose --verbose done
+		--verbose 2>/dev/null && then cd "$1" $(pwd) then readonly echo "$@" grep printf
+		"$1" 'quoted text' readonly readonly test done
+		grep 2>/dev/null echo | cd 2>/dev/null sed -eu 'quoted text'
+		2>/dev/null local cd readonly then awk "$@" ${HOME}
+		echo then "$@" then awk x=1 -eu printf
+| export export x=1 x=1 "$1" readonly ${HOME} printf printf awk x=1 && 2>/dev/null
+&& ${HOME} export ${HOME} /usr/bin ${HOME} &&
+-eu local readonly grep sed 2>/dev/null
+	local /usr/bin --verbose printf
+		x=1 x=1 ${HOME} && && awk "$1" | echo ${HOME}
+export 2>/dev/null awk
+		awk -eu readonly done test cd local printf sed 2>/dev/null
+echo x=1 -eu && awk | readonly -eu ${HOME} awk "$1" -eu /usr/bin
+		/usr/bin "$1" awk test then && --verbose cd "$1" /usr/bin
+	${HOME} local local export grep 2>/dev/null awk then then done 'quoted text'
+done x=1 ${HOME} awk grep then "$@" ${HOME} local &&
+	awk export $(pwd) cd echo "$@" 2>/dev/null done "$1" local local "$1" && x=1
+	/usr/bin export done sed then $(pwd) ${HOME} | awk cd printf 2>/dev/null 'quoted text'
+/usr/bin printf "$@" grep readonly && readonly done grep
+		| | ${HOME} sed -eu printf 2>/dev/null
+	&& 'quoted text' then then local && 2>/dev/null echo grep done test readonly &&
+	echo "$1" awk "$@" done export printf echo test $(pwd) readonly "$1" /usr/bin
+	/usr/bin ${HOME} export | | $(pwd) ${HOME}
+-eu $(pwd) | awk && cd local 'quoted text' then then $(pwd)
+	then then 2>/dev/null && export 'quoted text' export && --verbose done
+echo then grep awk test x=1 "$1" 'quoted text'
+--verbose "$1" ${HOME} sed printf "$@"
+	then cd -eu 2>/dev/null
+2>/dev/null --verbose "$1" -eu test done done -eu x=1 "$1" readonly
+then $(pwd) local printf then 2>/dev/null then export --verbose
+		$(pwd) ${HOME} echo readonly --verbose export cd echo sed local /usr/bin
+	done ${HOME} done test ${HOME} echo done local | echo
+	sed /usr/bin $(pwd) readonly then echo awk ${HOME} readonly "$1"
+readonly -eu then echo grep then cd export grep cd && sed "$1" echo
+	printf readonly done /usr/bin /usr/bin
+test ${HOME} awk --verbose /usr/bin export $(pwd)
+		/usr/bin printf -eu readonly
+	/usr/bin && export grep 'quoted text'
+		test $(pwd) 2>/dev/null --verbose "$1"
+		cd cd 2>/dev/null cd test --verbose ${HOME}
+	/usr/bin | 2>/dev/null local cd export then test 2>/dev/null printf done --verbose
+	local | -eu "$@" -eu x=1 /usr/bin done export test local done ${HOME} printf
+	/usr/bin then x=1 'quoted text' export x=1
+echo cd grep test ${HOME} sed ${HOME}
+	test local 'quoted text' done echo grep && 2>/dev/null
+		then 'quoted text' then 2>/dev/null cd readonly awk printf printf
+		grep $(pwd) then local -eu 2>/dev/null "$@" echo
+2>/dev/null export -eu sed then $(pwd) /usr/bin /usr/bin then &&
+		"$@" 'quoted text' 'quoted text' 2>/dev/null 'quoted text'
+		grep cd ${HOME} "$@" cd done "$1" 'quoted text' /usr/bin local export 'quoted text'
+	'quoted text' | x=1 ${HOME} x=1 readonly
+grep | 'quoted text' | grep 2>/dev/null
+	printf test && "$@" cd readonly -eu grep sed
+/usr/bin x=1 2>/dev/null ${HOME} printf printf
+	| "$@" done /usr/bin "$@" echo
+		sed test export cd "$1" -eu && local |
+/usr/bin $(pwd) 'quoted text' awk -eu printf grep cd /usr/bin
+	/usr/bin done && grep then x=1
+done then x=1 done && && -eu echo "$@" grep "$1"
+	readonly | cd local --verbose "$@" && echo "$1" 'quoted text' $(pwd) /usr/bin
+	"$1" "$@" then && x=1 echo awk --verbose
+	"$1" local sed 2>/dev/null x=1 "$@"
+--verbose | test | local 2>/dev/null local then 2>/dev/null
+	'quoted text' 2>/dev/null
+	sed grep printf readonly then
+	done 2>/dev/null && &&
+		| 2>/dev/null "$@" /usr/bin ${HOME} grep readonly /usr/bin
+grep local | 2>/dev/null grep sed
+		--verbose printf 'quoted text' /usr/bin "$@" "$1" test $(pwd) | ${HOME}
+	readonly ${HOME} export then local printf then && --verbose
+		then awk readonly grep 2>/dev/null "$@" ${HOME} readonly
+2>/dev/null export echo printf --verbose $(pwd) readonly "$@" sed x=1 sed cd
+/usr/bin echo --verbose /usr/bin printf grep sed
+	/usr/bin /usr/bin --verbose 2>/dev/null awk then x=1 && cd readonly
+	local /usr/bin && -eu ${HOME} x=1 $(pwd) cd readonly "$1"
+		--verbose "$@" "$1" readonly x=1 echo then printf printf done "$@" local
+		--verbose printf test && done readonly $(pwd) 2>/dev/null && echo
+	--verbose "$1" | 2>/dev/null x=1
+		cd /usr/bin echo --verbose
+		2>/dev/null -eu grep grep printf | printf
+		| echo printf "$1" "$1" x=1 printf
+done "$@" readonly -eu $(pwd) sed export "$@"
+	then readonly "$@" x=1
+"$@" awk --verbose readonly printf ${HOME} "$@" local
+local cd "$@" awk ${HOME} ${HOME} cd /usr/bin printf "$@" then
+${HOME} sed 'quoted text' &&
+		"$1" printf printf $(pwd) 2>/dev/null
+	$(pwd) then export sed 2>/dev/null --verbose local $(pwd)
+	--verbose 'quoted text' "$1" export sed awk echo "$@"
+		then x=1 "$@" done local awk grep echo | then
+		${HOME} sed awk 'quoted text' /usr/bin "$1" "$1" $(pwd) then /usr/bin
+-eu export && "$@" readonly then printf ${HOME} "$1"
+		test printf -eu test export grep
+	then test 2>/dev/null "$1"
+"$1" 2>/dev/null ${HOME} x=1 $(pwd) ${HOME} local 2>/dev/null
+-eu test echo echo | -eu && done
+		done "$1" $(pwd) export && -eu awk grep export 2>/dev/null printf -eu local
+		--verbose echo export echo && echo printf sed echo /usr/bin test /usr/bin
+readonly export done 'quoted text' awk printf cd export "$@" 'quoted text' --verbose
+	awk test "$@" 'quoted text' && -eu --verbose then test 2>/dev/null
+		&& local cd && printf ${HOME} 2>/dev/null grep $(pwd) ${HOME} /usr/bin
+	x=1 cd export | -eu x=1 $(pwd) 2>/dev/null
+		$(pwd) test then test readonly
+	printf test cd && local 2>/dev/null
+local x=1 | "$1" local x=1 printf --verbose ${HOME} cd awk
+	'quoted text' test /usr/bin /usr/bin
+		| then "$@" sed done -eu sed /usr/bin
+grep test test x=1 sed sed local grep local "$1" |
+export "$1" /usr/bin $(pwd) done echo ${HOME} local
+		--verbose test cd awk then "$@" cd
+&& readonly sed echo $(pwd) then then test
+		x=1 grep "$@" | -eu readonly x=1 echo local
+	grep 'quoted text' cd readonly && && 2>/dev/null local echo | 2>/dev/null $(pwd)
+/usr/bin | readonly sed $(pwd) --verbose
+		"$@" x=1 cd ${HOME} $(pwd) done sed grep -eu /usr/bin sed test
+		readonly --verbose 2>/dev/null local | $(pwd) --verbose readonly
+${HOME} /usr/bin $(pwd) echo local
+sed -eu --verbose local sed "$1" grep readonly
+		test local 2>/dev/null ${HOME} export /usr/bin -eu readonly local
+echo -eu | awk x=1 --verbose grep grep | /usr/bin x=1 "$1" 'quoted text'
+		echo $(pwd) --verbose -eu --verbose -eu $(pwd) x=1
+x=1 sed grep local ${HOME} --verbose "$1" awk $(pwd) awk 2>/dev/null
+		"$@" $(pwd) readonly --verbose grep grep $(pwd) awk "$@" $(pwd) "$1"
+"$@" done test -eu then $(pwd) /usr/bin echo readonly readonly | && &&
+export /usr/bin then awk | 2>/dev/null sed x=1 export 'quoted text'
+		readonly awk /usr/bin 2>/dev/null ${HOME} cd 2>/dev/null /usr/bin sed /usr/bin
+		/usr/bin cd cd echo ${HOME} ${HOME} local awk done x=1 printf readonly 2>/dev/null
+	${HOME} echo done /usr/bin printf 2>/dev/null && "$@" echo sed readonly $(pwd)
+cd local readonly grep then | --verbose cd x=1 2>/dev/null local
+sed readonly x=1 awk export test export "$@"
+	-eu ${HOME} sed /usr/bin x=1 &&
+	&& --verbose then | --verbose grep sed then $(pwd) && 'quoted text'
+	/usr/bin grep export awk printf done then
+x=1 $(pwd) "$@" "$1" done cd awk local awk ${HOME} export
+$(pwd) local cd | 2>/dev/null readonly echo sed test printf
+		printf "$1" 'quoted text' | $(pwd) 2>/dev/null ${HOME} $(pwd)
+"$1" echo test 2>/dev/null printf -eu test printf
+--verbose export "$@" then x=1 readonly grep grep echo echo "$1" 2>/dev/null
+	then $(pwd) | -eu | local /usr/bin "$@" /usr/bin then x=1 done test readonly 'quoted text'
+local awk 'quoted text' "$1" printf "$1" x=1 ${HOME}
+	test --verbose test 'quoted text'
+	test | 'quoted text' echo done | sed /usr/bin
+		--verbose cd 'quoted text' test /usr/bin "$@" cd local 2>/dev/null 'quoted text'
+	"$@" test x=1 | readonly local test sed then 2>/dev/null -eu printf
+	$(pwd) export -eu echo echo | cd && printf printf x=1 then 2>/dev/null
+then cd x=1 test | -eu 2>/dev/null /usr/bin
+export 'quoted text' test then printf sed "$@" cd -eu
+		"$1" done ${HOME} awk "$1" echo local grep grep readonly --verbose cd $(pwd)
+x=1 awk echo --verbose $(pwd) -eu
+	readonly $(pwd) 'quoted text' --verbose test sed 'quoted text' local cd echo
+		| --verbose | 'quoted text' cd --verbose
+done grep 2>/dev/null local awk /usr/bin readonly 'quoted text' $(pwd) grep
+		test --verbose awk && 2>/dev/null && grep then 'quoted text' sed
+awk then done echo && 2>/dev/null /usr/bin /usr/bin sed cd grep readonly export
+		then "$@" grep 2>/dev/null "$1" x=1 sed | "$1" echo sed local grep $(pwd)
+		"$1" test 'quoted text' $(pwd) 2>/dev/null 2>/dev/null -eu echo awk test awk
+	"$1" 'quoted text' grep | && 2>/dev/null | x=1 x=1
+		| 2>/dev/null x=1 -eu /usr/bin | cd grep done x=1 grep -eu ${HOME} "$1"
+	echo "$1" export export --verbose export
+	sed "$1" x=1 "$1" 'quoted text' printf printf | echo cd sed
+		done awk printf $(pwd) /usr/bin | local $(pwd) awk "$1" ${HOME} sed printf 2>/dev/null
+export | && 2>/dev/null export test 'quoted text' grep "$1" test
+	readonly ${HOME} grep /usr/bin
+echo 'quoted text' then export ${HOME} echo --verbose cd && && done then sed
+	'quoted text' test x=1 | then export 'quoted text'
+	${HOME} /usr/bin 2>/dev/null local 2>/dev/null "$@"
+		${HOME} test && then printf "$@" sed "$1" "$@" sed readonly then x=1 "$@" readonly
+	x=1 printf test "$1" then "$1" echo "$1" then "$@" | test grep
+		x=1 cd local cd -eu local x=1 && printf "$@" x=1 awk readonly test "$1" |
+echo --verbose test --verbose local local ${HOME} then "$@"
+local export cd then printf "$1" ${HOME} printf
+	sed grep $(pwd) grep echo && /usr/bin grep printf -eu sed export --verbose
+${HOME} done 2>/dev/null echo export /usr/bin grep 'quoted text'
+		test "$@" | awk cd "$@"
+		awk readonly $(pwd) &&
+${HOME} test export "$@" "$@" sed x=1 test export
+	"$@" x=1 "$@" done "$1"
+	printf readonly "$1" sed --verbose "$@" "$1" "$1" then then 'quoted text'
+		| done awk --verbose ${HOME}
+		"$@" local 2>/dev/null done && /usr/bin 'quoted text' x=1 awk
+"$@" export readonly export | awk
+	$(pwd) printf -eu -eu echo echo test /usr/bin /usr/bin export 'quoted text' &&
+		/usr/bin | "$@" $(pwd) /usr/bin
+/usr/bin -eu --verbose 2>/dev/null $(pwd) awk /usr/bin then test "$@" 2>/dev/null
+cd -eu ${HOME} printf readonly then "$@" sed sed
+	'quoted text' test grep 'quoted text' ${HOME}
+	-eu printf sed export
+echo x=1 echo && then $(pwd) awk grep /usr/bin $(pwd) ${HOME} /usr/bin
+	then "$1" sed then --verbose
+		--verbose done done $(pwd) cd -eu && awk | -eu printf echo "$@" cd -eu sed local
+		| --verbose $(pwd) export printf /usr/bin "$1" printf "$@" test readonly
+	done | x=1 grep echo --verbose --verbose sed test local x=1 2>/dev/null
+cd && test sed 2>/dev/null sed "$@" /usr/bin done sed | awk && x=1 /usr/bin export
+'quoted text' printf cd echo | readonly readonly && && export
+	'quoted text' -eu grep export then | echo awk awk export 2>/dev/null x=1 export
+	/usr/bin $(pwd) | export awk then echo --verbose
+	then awk --verbose 'quoted text' 'quoted text' local then echo
+/usr/bin "$1" test --verbose export sed local /usr/bin awk 'quoted text' local
+	&& && | "$@" "$@" echo "$1" && 2>/dev/null export export export test "$1" export
+done --verbose $(pwd)
+readonly echo echo x=1 | then awk test "$1" $(pwd)
+	${HOME} && x=1 printf ${HOME} /usr/bin
+	cd /usr/bin export echo --verbose x=1 grep echo echo --verbose 2>/dev/null
+		grep "$1" test "$@" local 2>/dev/null --verbose awk cd
+'quoted text' ${HOME} ${HOME} test grep done
+sed ${HOME} | /usr/bin && awk export
+	"$1" ${HOME} export $(pwd) --verbose 2>/dev/null
+	| 'quoted text' /usr/bin
+export grep export test done then then 'quoted text'
+	| -eu && /usr/bin --verbose /usr/bin done printf cd printf ${HOME} "$@" then
+	cd 2>/dev/null $(pwd) local cd 2>/dev/null readonly
+awk x=1 test readonly grep test && 2>/dev/null /usr/bin done x=1 ${HOME}
+export readonly echo "$@" -eu readonly x=1 sed
+		/usr/bin $(pwd) 'quoted text' awk sed "$@" sed
+		then 2>/dev/null /usr/bin ${HOME} -eu /usr/bin x=1 export test printf sed
+		"$1" export export --verbose awk ${HOME} /usr/bin /usr/bin test export test
+-eu | 2>/dev/null awk /usr/bin "$@" 2>/dev/null printf
+	test printf test --verbose awk grep then "$1" $(pwd) then export "$1"
+done then printf "$@" 2>/dev/null
+		printf grep export $(pwd) && sed | | 'quoted text' printf grep /usr/bin
+		export then done then x=1 then | x=1
+		cd printf "$1" -eu echo done printf "$1" grep /usr/bin --verbose -eu done then
+	sed ${HOME} done cd awk "$@" test sed cd ${HOME} done readonly cd printf export
+		awk "$@" done 'quoted text' "$1" then echo x=1 cd printf $(pwd) "$@" /usr/bin
+		cd awk grep then "$@" x=1 "$@" 'quoted text' local $(pwd) readonly grep
+done export printf test 2>/dev/null export
+	"$@" "$@" then cd then then then "$1" export then sed awk test awk "$@" grep
+cd echo --verbose -eu printf local 'quoted text'
+readonly awk 2>/dev/null --verbose
+		&& cd ${HOME} | sed ${HOME} && readonly done grep x=1 /usr/bin echo -eu
+awk -eu printf grep readonly readonly
+grep 'quoted text' ${HOME} echo $(pwd) -eu grep awk then
+	test then "$1" then awk
+	'quoted text' echo awk "$1" 'quoted text'
+--verbose sed then 'quoted text' ${HOME} 'quoted text' readonly
+		export $(pwd) "$@" grep
+		awk test cd "$1" | 2>/dev/null then awk grep cd printf echo && |
+		grep ${HOME} /usr/bin sed echo awk x=1 "$1" export done x=1 && readonly "$1" cd
+	then cd sed cd readonly "$@" && export
+		$(pwd) -eu 2>/dev/null -eu done
+		| | echo $(pwd) && printf local "$@" 2>/dev/null x=1 --verbose
+then 2>/dev/null echo --verbose --verbose -eu | local
+"$1" sed ${HOME} printf x=1 $(pwd) | "$1" then sed && then 2>/dev/null $(pwd)
+		/usr/bin echo echo awk done printf $(pwd) export printf /usr/bin ${HOME}
+"$1" done cd printf /usr/bin readonly readonly test local 2>/dev/null 'quoted text'
+awk sed export "$1" --verbose "$1"
+	export | "$1" then "$@" -eu "$1"
+	cd sed echo awk x=1 grep printf
+		/usr/bin local local && "$1" done echo awk "$1" readonly "$1" test | x=1 2>/dev/null
+${HOME} local 'quoted text'
+		-eu cd grep $(pwd) ${HOME} /usr/bin local /usr/bin local local "$1"
+	"$@" $(pwd) | -eu awk printf then 2>/dev/null x=1 "$1" local x=1 awk grep readonly
+	echo grep local ${HOME} cd 2>/dev/null --verbose /usr/bin /usr/bin
+printf then echo sed readonly /usr/bin && | then printf --verbose readonly
+	"$@" "$@" 'quoted text' grep -eu cd | $(pwd) $(pwd) 2>/dev/null | local awk
+		2>/dev/null export printf echo grep x=1
+		--verbose -eu 'quoted text' -eu then --verbose | grep /usr/bin x=1 /usr/bin "$@"
+	'quoted text' readonly $(pwd) | readonly
+	then 'quoted text' && readonly
+	done -eu 2>/dev/null awk cd then 2>/dev/null
+		awk cd x=1 x=1 cd sed &&
+2>/dev/null $(pwd) then x=1 'quoted text' 'quoted text' "$1"
+		"$@" 2>/dev/null local 2>/dev/null "$1" readonly /usr/bin "$1" && sed |
+	${HOME} printf | -eu readonly
+"$1" export sed test "$@" &&
+done ${HOME} export cd 'quoted text' -eu grep
+export export 2>/dev/null --verbose printf | readonly
+printf && | then "$1" sed then
+		cd awk export 'quoted text'
+		awk 2>/dev/null sed export then "$1" "$@" local /usr/bin awk local $(pwd) echo
+		${HOME} x=1 sed printf test then |
+		printf "$@" ${HOME} "$@" sed done --verbose 'quoted text' done 2>/dev/null -eu
+export awk done "$@" export /usr/bin test grep done
+		cd && /usr/bin readonly readonly x=1 $(pwd)
+		${HOME} /usr/bin 2>/dev/null
+		sed /usr/bin x=1 sed x=1 $(pwd) && "$@" $(pwd)
+	readonly printf grep -eu echo
+		--verbose "$1" done awk
+	x=1 2>/dev/null 'quoted text' "$@" ${HOME} "$1" 'quoted text' local sed export
+		--verbose printf readonly echo -eu "$@"
+--verbose printf -eu 'quoted text' 'quoted text' ${HOME} grep "$@" | "$1"
+	&& cd && "$1" echo then -eu export awk readonly
+/usr/bin export /usr/bin then test grep x=1 "$@" 2>/dev/null sed export
+	| printf && ${HOME} export test | -eu "$@" x=1 done
+		awk ${HOME} -eu 2>/dev/null 'quoted text' && x=1 done "$1" echo /usr/bin cd
+test 'quoted text' cd sed cd grep echo "$1" -eu 2>/dev/null test cd /usr/bin
+x=1 -eu export $(pwd) "$1" export echo
+local --verbose printf awk /usr/bin cd 2>/dev/null
+echo 'quoted text' cd local x=1
+	${HOME} then -eu x=1 echo done readonly export "$1" awk test &&
+then printf && /usr/bin awk grep "$@" "$1" $(pwd) -eu printf cd "$@" -eu export
+echo 2>/dev/null "$@" test readonly test | "$@" /usr/bin grep ${HOME}
+		${HOME} cd sed && 'quoted text' test echo export printf
+	2>/dev/null done readonly done printf awk echo then "$1"
+local 'quoted text' sed 'quoted text' --verbose $(pwd) 2>/dev/null then "$@"
+		sed sed "$1" x=1 export echo 'quoted text'
+	export then done local /usr/bin /usr/bin 2>/dev/null done cd
+	x=1 printf 'quoted text' "$1" readonly x=1 cd readonly export then "$@" x=1
+	| sed local cd test done
+		test done readonly cd test local $(pwd) "$1" sed --verbose "$@" printf
+	test && export 'quoted text'
+	'quoted text' sed printf sed
+		| echo ${HOME} awk export done ${HOME} && done cd awk sed then local /usr/bin
+'quoted text' echo /usr/bin
+"$1" $(pwd) then 2>/dev/null done export test
+	x=1 echo | "$1" sed echo x=1 awk
+		--verbose -eu | --verbose "$@" "$@" /usr/bin awk "$@" -eu test
+	awk local $(pwd) "$@" -eu grep --verbose 'quoted text' "$@" "$@" done
+		grep sed readonly sed 2>/dev/null
+sed -eu local local $(pwd) 2>/dev/null |
+readonly -eu "$@" sed /usr/bin local echo "$@" local && | --verbose --verbose
+"$1" | && awk && then 2>/dev/null
+	sed $(pwd) /usr/bin -eu 'quoted text' cd "$@" local
+	done export $(pwd) -eu x=1
+	test awk readonly /usr/bin
+	export grep test "$@" x=1 && awk && printf ${HOME} /usr/bin
+		printf readonly "$@" awk
+	"$@" sed awk && --verbose $(pwd) grep cd echo export test x=1
+	readonly 'quoted text' 'quoted text' --verbose 2>/dev/null --verbose
+	export "$1" "$1" sed "$@" /usr/bin
+	local export x=1 | done 2>/dev/null awk /usr/bin $(pwd)
+		done awk grep local | --verbose echo "$@" done local $(pwd) awk x=1 /usr/bin then
+	cd -eu printf 2>/dev/null ${HOME} test && --verbose | 'quoted text'
+	printf --verbose done "$@" done grep 2>/dev/null | readonly -eu /usr/bin 2>/dev/null
+		grep --verbose cd --verbose echo x=1 sed -eu echo local /usr/bin 'quoted text'
+/usr/bin "$@" sed export awk awk sed done | awk /usr/bin
+	$(pwd) printf -eu sed sed
+grep $(pwd) echo readonly cd "$@" grep test
+--verbose --verbose test && 'quoted text'
+	2>/dev/null && $(pwd) --verbose export sed
+		local echo | done echo then readonly sed echo grep
+test done "$1" x=1 /usr/bin then awk readonly test local && awk grep export
+		cd echo printf echo 2>/dev/null 'quoted text' done ${HOME}
+	test /usr/bin awk cd cd -eu $(pwd) /usr/bin
+	local readonly awk then cd done 'quoted text' local
+grep local then echo | | "$@" && "$1" export readonly | ${HOME} grep 2>/dev/null
+		done "$1" "$1" --verbose "$1" export ${HOME}
+		readonly 'quoted text' done "$@" $(pwd)
+		test cd ${HOME} test export && --verbose 2>/dev/null
+		${HOME} 'quoted text'
+sed echo -eu --verbose echo sed "$@" then "$@" -eu ${HOME}
+		printf export sed done local --verbose sed grep sed then echo -eu 'quoted text'
+		sed export | 'quoted text' "$@" sed awk local then && "$@" -eu printf local
+echo 'quoted text' readonly /usr/bin 'quoted text' echo awk
+	local x=1 local /usr/bin
+		readonly 2>/dev/null && $(pwd) cd grep "$@" /usr/bin
+"$1" | then /usr/bin done "$@" local "$1"
+		2>/dev/null "$@" awk --verbose
+"$1" -eu | grep -eu && 2>/dev/null ${HOME}
+-eu export "$@" x=1 && awk grep /usr/bin done "$@" grep
+		&& then "$1" "$1" echo export local -eu test 'quoted text' -eu "$@"
+"$@" test 'quoted text' | "$1" x=1
+sed export | export | cd --verbose done 'quoted text'
+	readonly -eu -eu grep 'quoted text'
+		--verbose /usr/bin ${HOME} 2>/dev/null --verbose printf cd 2>/dev/null && /usr/bin
+		${HOME} $(pwd) 2>/dev/null /usr/bin && "$@" awk printf test "$1"
+grep grep /usr/bin test -eu
+$(pwd) done "$@" local --verbose done then echo 2>/dev/null local grep done && echo
+		done | --verbose $(pwd) grep | sed export grep ${HOME} 2>/dev/null
+	echo cd --verbose grep "$1" x=1 readonly echo
+/usr/bin export "$1" echo then readonly
+	"$@" sed printf "$1" | 'quoted text' echo awk readonly "$@" local
+sed local cd "$1" && "$@" echo --verbose "$@" -eu 'quoted text' then awk 'quoted text'
+grep 'quoted text' /usr/bin printf echo /usr/bin test -eu test cd cd -eu && /usr/bin
+		'quoted text' x=1 grep --verbose 'quoted text' "$1" 2>/dev/null $(pwd) "$@" readonly
+${HOME} ${HOME} $(pwd) grep --verbose grep
+"$1" -eu done $(pwd) --verbose
+	then printf -eu 'quoted text' local done ${HOME} grep && sed 2>/dev/null "$1" sed
+	export printf 2>/dev/null grep --verbose then
+	awk 'quoted text' $(pwd) "$1" cd x=1 $(pwd) cd awk
+		x=1 cd done cd echo then grep 'quoted text' /usr/bin x=1
+	local local then sed echo printf done && "$@" "$1"
+		${HOME} export done export x=1 readonly
+	readonly /usr/bin "$@" test local grep done
+		'quoted text' $(pwd) grep then ${HOME}
+		$(pwd) awk local $(pwd) done | awk local export echo
+		then "$1" export --verbose then -eu /usr/bin -eu x=1 "$@" $(pwd)
+		awk awk "$@" printf -eu "$@" | then && awk local 'quoted text' --verbose /usr/bin
+readonly printf ${HOME}
+	"$1" 'quoted text' sed $(pwd) | -eu "$1" ${HOME} /usr/bin printf local
+		${HOME} && sed test awk sed done grep export readonly
+		| $(pwd) test $(pwd) test
+"$1" -eu sed printf | awk "$1" cd 2>/dev/null
+	&& /usr/bin --verbose 'quoted text' export ${HOME} $(pwd) x=1 local local
+2>/dev/null test grep && echo done && | --verbose awk printf /usr/bin
+	test $(pwd) then | grep && done | /usr/bin 2>/dev/null
+	cd $(pwd) export --verbose x=1 2>/dev/null local $(pwd)
+	echo then sed test /usr/bin /usr/bin &&
+export sed test awk sed printf awk /usr/bin "$@" $(pwd)
+	then echo 2>/dev/null x=1 export local $(pwd) 2>/dev/null $(pwd) 2>/dev/null
+sed 'quoted text' export grep "$1" test done "$1" cd cd --verbose x=1 ${HOME}
+/usr/bin grep grep sed && x=1 echo ${HOME} $(pwd)
+readonly -eu printf sed then then | local readonly cd readonly
+/usr/bin /usr/bin /usr/bin then 2>/dev/null -eu
+	local 'quoted text' ${HOME} done "$@" "$@" "$1" --verbose grep && -eu then
+	${HOME} readonly local cd "$@" awk readonly sed readonly
+-eu 2>/dev/null printf 2>/dev/null 2>/dev/null grep -eu && "$@" done
+--verbose readonly "$@" done printf readonly -eu x=1 grep
+		awk test grep /usr/bin && "$1" export "$1" "$1" echo printf grep echo $(pwd) "$1"
+	$(pwd) echo printf --verbose "$1" sed ${HOME} /usr/bin cd cd printf sed local
+"$1" /usr/bin -eu --verbose /usr/bin cd "$1" && x=1 2>/dev/null done
+done /usr/bin local -eu printf export $(pwd)
+		cd "$@" awk export --verbose cd 2>/dev/null
+		then local --verbose /usr/bin export "$@" --verbose
+	then grep /usr/bin readonly 2>/dev/null
+	2>/dev/null done grep /usr/bin done test 2>/dev/null
+x=1 "$@" printf -eu local "$@" && ${HOME} "$1" export test | --verbose x=1
+then x=1 awk then echo echo && "$@" grep test ${HOME}
+		cd done /usr/bin ${HOME} test | awk test $(pwd) "$@" 'quoted text' ${HOME} ${HOME}
+cd readonly 'quoted text' grep printf cd
+		readonly grep ${HOME} local --verbose --verbose ${HOME} export local
+	sed then 2>/dev/null echo ${HOME} sed test local
+sed done "$@" done $(pwd) && sed readonly grep "$1" sed ${HOME} echo test "$1"
+	echo "$@" 'quoted text'
+| awk 'quoted text' done "$@" awk grep local
+		readonly test then "$1" test
+		grep export --verbose grep $(pwd) export sed /usr/bin export
+then 2>/dev/null | then /usr/bin --verbose awk
+		grep cd --verbose local then export export cd -eu grep sed | export $(pwd) done
+		then export awk x=1 sed local && $(pwd) x=1 x=1 ${HOME} echo printf echo
+		export 'quoted text' done ${HOME}
+/usr/bin echo test echo -eu local x=1 printf "$@"
+		done grep grep sed awk awk test printf
+	2>/dev/null local test "$1" echo --verbose local ${HOME} local grep
+	sed grep "$1" 'quoted text' then local 'quoted text' 2>/dev/null
+		printf "$1" awk grep readonly ${HOME} test -eu /usr/bin sed "$@" test
+printf readonly ${HOME} echo then cd 2>/dev/null then
+	echo awk $(pwd) /usr/bin | --verbose sed grep "$1" 2>/dev/null $(pwd) sed 'quoted text'
+		export cd x=1 then done $(pwd)
+awk 'quoted text' local grep | 'quoted text'
+$(pwd) /usr/bin local awk cd | && readonly $(pwd) test
+	local then readonly export export awk printf && awk readonly ${HOME} | --verbose
+		done x=1 test sed printf printf local cd | && then grep -eu
+	$(pwd) ${HOME} ${HOME} done
+	printf 2>/dev/null echo
+	2>/dev/null 'quoted text' grep local
+/usr/bin "$1" local local printf printf -eu "$@" --verbose 'quoted text'
+	/usr/bin test && -eu "$1" then ${HOME} echo done /usr/bin --verbose ${HOME} 2>/dev/null
+		/usr/bin local then --verbose sed "$1" then test $(pwd) echo /usr/bin
+	'quoted text' cd export x=1 /usr/bin "$@" export 'quoted text'
+		--verbose echo 'quoted text' sed local sed 'quoted text' printf readonly
+		cd 'quoted text' --verbose 2>/dev/null
+echo x=1 local echo then "$1" | then sed --verbose grep 2>/dev/null readonly
+	&& $(pwd) test readonly
+	done cd cd 2>/dev/null $(pwd) ${HOME}
+	awk readonly 2>/dev/null test local | /usr/bin awk 2>/dev/null
+	done "$@" ${HOME} 'quoted text'
+	awk echo $(pwd) $(pwd) "$@"
+		$(pwd) "$@" && export readonly
+		local sed awk --verbose awk x=1 $(pwd) echo then cd | printf --verbose done
+	"$@" 'quoted text' awk
+&& "$@" sed "$@" 'quoted text' echo done readonly done sed x=1 grep sed done $(pwd)
+		readonly "$@" grep "$1" && "$@" | $(pwd)
+	/usr/bin printf --verbose "$@" 2>/dev/null "$@" test "$1"
+	cd ${HOME} local | $(pwd) /usr/bin sed $(pwd) awk | cd done 'quoted text' "$@"
+	printf 2>/dev/null 2>/dev/null done /usr/bin 'quoted text'
+$(pwd) $(pwd) awk "$@"
+test local 'quoted text' printf readonly done 2>/dev/null echo "$@" /usr/bin
+		| done ${HOME} ${HOME} printf export
+	--verbose echo --verbose echo $(pwd) printf 'quoted text' cd ${HOME} --verbose
+	&& echo test then local "$1" test printf && | printf grep done
+		test "$1" local readonly sed -eu ${HOME} ${HOME} && done echo
+		sed grep done echo echo then readonly local grep ${HOME} grep 'quoted text'
+export 2>/dev/null x=1 sed ${HOME} -eu $(pwd) done x=1 'quoted text'
+cd 2>/dev/null printf && cd echo | test test "$1" echo 'quoted text'
+grep then export export 'quoted text' && then /usr/bin
+		| ${HOME} 2>/dev/null export sed x=1 sed /usr/bin readonly /usr/bin | test local
+		grep "$1" /usr/bin 'quoted text'
+		&& x=1 | local x=1 then then export "$@"
+	echo && printf 'quoted text'
+/usr/bin then done "$1" cd |
+		export done -eu ${HOME}
+done cd awk x=1 --verbose test echo readonly $(pwd) cd ${HOME} echo sed sed
+		| local awk "$@" readonly 'quoted text'
+	/usr/bin grep 2>/dev/null $(pwd) --verbose /usr/bin 'quoted text'
+"$@" local printf printf $(pwd) --verbose ${HOME} "$@" ${HOME}
+	${HOME} export /usr/bin "$@" awk ${HOME} local echo cd echo sed
+		local "$1" /usr/bin readonly 2>/dev/null
+cd --verbose then ${HOME} $(pwd) awk grep then
+	done done awk grep 2>/dev/null "$@" printf readonly
+&& cd ${HOME} echo sed then readonly
+	readonly local "$1" grep 2>/dev/null && && done awk
+		grep x=1 test && export export done /usr/bin ${HOME}
+	2>/dev/null $(pwd) readonly done cd printf 2>/dev/null echo "$1"
+	"$1" --verbose test --verbose then "$1" printf printf
+	| grep x=1 readonly 2>/dev/null
+		"$1" 2>/dev/null "$1" cd printf "$1" "$@" awk $(pwd) --verbose
+	--verbose cd ${HOME} 'quoted text' 2>/dev/null && --verbose
+	x=1 printf | | "$1" echo grep grep "$@" sed awk local grep
+		printf then 'quoted text' cd /usr/bin $(pwd) readonly x=1 readonly --verbose
+		| awk test echo printf sed export /usr/bin /usr/bin
+	x=1 | readonly echo test readonly
+--verbose ${HOME} done local "$@" cd cd "$1" awk
+		| x=1 readonly echo awk
+	done -eu | && then /usr/bin 2>/dev/null 'quoted text' "$1" then printf
+	then /usr/bin printf "$@" test
+		export cd ${HOME} $(pwd) | sed 'quoted text' -eu
+		'quoted text' test printf "$@" grep
+		sed ${HOME} -eu --verbose -eu "$1"
+		'quoted text' grep export echo readonly
+	test $(pwd) "$@" "$1" done awk test
+	&& --verbose "$1" x=1 grep grep printf | then && "$1" ${HOME} "$@" echo | sed
+--verbose test 'quoted text'
+		"$1" awk $(pwd) x=1 export printf grep printf done --verbose "$1" && test x=1
+		printf -eu printf printf cd export
+	'quoted text' 'quoted text' sed awk cd 'quoted text' readonly
+		sed cd ${HOME} export printf
+2>/dev/null sed done $(pwd) awk
+		sed readonly 2>/dev/null
+		local /usr/bin grep sed 2>/dev/null /usr/bin awk awk -eu awk
+then done -eu "$1" 2>/dev/null awk readonly --verbose then
+		'quoted text' --verbose local
+		${HOME} readonly echo done readonly test "$1" sed readonly printf
+		export then grep done | then done x=1 | printf readonly
+		"$@" x=1 test -eu then test --verbose local
+grep printf "$@" echo test
+		$(pwd) x=1 --verbose echo "$1" $(pwd) -eu readonly
+	'quoted text' printf printf "$@" awk -eu export &&
+	test --verbose $(pwd) echo sed && "$1" readonly
+		done "$1" done done cd && local
+	"$1" export readonly awk -eu printf -eu readonly x=1 then then
+	sed x=1 then then 2>/dev/null --verbose then
+	local -eu $(pwd) ${HOME} then 'quoted text' readonly --verbose
+2>/dev/null x=1 test x=1
+		--verbose && && $(pwd) done 'quoted text'
+readonly readonly --verbose $(pwd) --verbose grep echo echo
+		test /usr/bin "$1" |
+cd cd export cd 'quoted text' local cd grep readonly 2>/dev/null /usr/bin 'quoted text'
+done && sed 2>/dev/null local test then echo --verbose cd /usr/bin
+	$(pwd) "$@" 2>/dev/null
+	2>/dev/null grep 'quoted text' local $(pwd) "$@" cd 'quoted text'
+	export awk local awk grep | readonly --verbose
+done done && printf cd -eu x=1 x=1 && done -eu test $(pwd)
+	&& | $(pwd) $(pwd) 2>/dev/null cd local 2>/dev/null done awk printf export
+/usr/bin done sed | 'quoted text' "$@" | local
+		'quoted text' done --verbose 2>/dev/null "$1" "$1" printf readonly
+		cd | grep printf 2>/dev/null export then 'quoted text' && /usr/bin cd
+		cd /usr/bin ${HOME} echo readonly
+awk --verbose sed | | export
+		--verbose done 'quoted text' test 2>/dev/null -eu test done awk
+	$(pwd) cd && grep 'quoted text'
+'quoted text' x=1 readonly readonly local && done
+		readonly cd $(pwd) /usr/bin sed
+	done grep cd /usr/bin readonly sed "$1" 'quoted text' grep -eu sed 'quoted text'
+-eu "$1" then -eu printf "$@" | x=1 test export
+	2>/dev/null done && -eu readonly x=1 'quoted text' grep --verbose 2>/dev/null test
+| /usr/bin --verbose --verbose awk | cd printf export printf done grep 2>/dev/null
+cd awk echo then x=1 grep printf x=1 2>/dev/null grep printf
+awk export 'quoted text' echo awk done sed && "$1" printf
+		| sed "$@" $(pwd) --verbose 'quoted text' /usr/bin local $(pwd) then | done &&
+local test local $(pwd) printf test local export grep grep 2>/dev/null
+	"$@" echo readonly cd "$1" 'quoted text' "$@" 2>/dev/null -eu test $(pwd) --verbose
+$(pwd) done grep awk then cd /usr/bin awk | grep && local then
+&& cd export /usr/bin
+		cd "$1" readonly readonly --verbose /usr/bin printf readonly
+-eu then done /usr/bin ${HOME} export 2>/dev/null
+"$@" "$1" "$1" | x=1 test echo "$@" awk x=1 done echo awk "$@" grep test local
+		echo 'quoted text' $(pwd) grep "$1" | then "$@" 2>/dev/null done awk printf
+		"$@" 2>/dev/null ${HOME} cd 'quoted text'
+export $(pwd) cd && sed /usr/bin
+	done local --verbose "$1" printf printf | readonly --verbose
+x=1 --verbose "$1" echo done cd cd echo 'quoted text'
+		printf 'quoted text' done -eu 2>/dev/null cd readonly readonly 2>/dev/null
+	'quoted text' awk "$@" readonly ${HOME}
+--verbose export awk --verbose done printf
+echo done printf && -eu cd echo $(pwd) echo
+		sed $(pwd) "$1" printf readonly
+	awk readonly && --verbose "$@" -eu /usr/bin
+then grep 2>/dev/null echo -eu printf /usr/bin "$1" ${HOME} /usr/bin | -eu
+		x=1 "$@" -eu awk x=1 $(pwd) grep ${HOME} done "$@" awk then cd --verbose
+	"$1" && then printf 2>/dev/null 'quoted text' done $(pwd) readonly
+local 2>/dev/null then cd --verbose cd ${HOME} 2>/dev/null "$@" && 'quoted text'
+		'quoted text' && cd "$@" echo 'quoted text' export /usr/bin awk 'quoted text'
+readonly "$1" done "$1"
+		done 2>/dev/null grep && && ${HOME} x=1 sed 'quoted text' then 'quoted text'
+done printf grep sed 2>/dev/null | | "$@" echo echo $(pwd) export "$@"
+awk 'quoted text' "$1" && x=1 printf ${HOME} $(pwd) cd export done "$@" export
+		printf 'quoted text' echo ${HOME} cd then printf done awk then
+		$(pwd) ${HOME} "$1" -eu local --verbose --verbose echo x=1 sed done sed
+x=1 'quoted text' test then ${HOME} done $(pwd) readonly "$@"
+		awk | awk 'quoted text' export -eu "$@" then local grep test "$@" cd test
+	grep done x=1 && then awk readonly
+	&& local /usr/bin local 2>/dev/null 2>/dev/null echo awk
+grep $(pwd) export --verbose test && && $(pwd) --verbose
+	awk 'quoted text' test local "$1" x=1 -eu then
+		'quoted text' x=1 /usr/bin then
+/usr/bin -eu cd 2>/dev/null 'quoted text' | cd 'quoted text' local
+		'quoted text' -eu then readonly && grep printf /usr/bin export cd ${HOME} cd
+$(pwd) printf -eu -eu "$@" done 2>/dev/null
+grep echo sed local "$1" && $(pwd) $(pwd) "$1" sed export export
+| 2>/dev/null readonly -eu | done | ${HOME}
+		sed --verbose $(pwd) 'quoted text'
+-eu sed cd -eu --verbose | ${HOME}
+	x=1 2>/dev/null && then
+echo --verbose $(pwd) && | echo --verbose readonly /usr/bin readonly echo /usr/bin
+		&& awk | echo cd sed then "$@" test echo
+	"$1" echo ${HOME} 'quoted text' cd /usr/bin echo
+		2>/dev/null export grep sed test then test export $(pwd) 'quoted text'
+		sed printf done x=1 --verbose $(pwd) | /usr/bin cd $(pwd)
+	readonly /usr/bin 2>/dev/null "$1" | --verbose
+		--verbose echo | x=1 ${HOME} then | -eu cd awk awk "$1" readonly
+	local sed 2>/dev/null $(pwd)
+"$1" local $(pwd) && $(pwd) /usr/bin $(pwd) -eu | 2>/dev/null
+echo -eu /usr/bin -eu -eu $(pwd) -eu done local /usr/bin grep sed
+grep then "$@" && "$@" --verbose echo $(pwd) printf sed
+-eu printf /usr/bin -eu then echo | ${HOME} ${HOME} echo then
+	readonly "$1" "$1" ${HOME} -eu awk sed -eu /usr/bin
+${HOME} --verbose echo --verbose echo then export sed export
+	echo 'quoted text' cd awk grep /usr/bin && printf
+		done -eu 'quoted text' export local done export local /usr/bin
+${HOME} then 2>/dev/null && cd export awk
+		readonly echo --verbose test | grep printf
+		export echo 'quoted text' --verbose export x=1 test && ${HOME} /usr/bin grep $(pwd)
+cd -eu done -eu ${HOME} readonly local 'quoted text' done local then echo -eu
+		x=1 export printf grep "$@"
+	--verbose cd 'quoted text' --verbose "$1"
+--verbose -eu 'quoted text' /usr/bin "$1" cd then "$1" then --verbose cd "$1"
+	sed done -eu $(pwd) then ${HOME} && test
+		&& then local && x=1 -eu then grep done /usr/bin
+	cd local readonly echo ${HOME}
+x=1 test "$@" 'quoted text'
+		"$1" "$@" readonly printf -eu echo "$1" printf local
+	export readonly | | awk --verbose readonly sed test "$@" "$@" $(pwd)
+	grep 2>/dev/null test export echo /usr/bin 'quoted text'
+		'quoted text' printf /usr/bin ${HOME} readonly 2>/dev/null x=1 /usr/bin
+	'quoted text' local printf
+	x=1 grep export /usr/bin printf
+		then grep test 'quoted text'
+	test /usr/bin -eu printf ${HOME} cd && export
+'quoted text' local 2>/dev/null --verbose
+		then readonly done "$@" sed $(pwd) readonly
+sed test readonly awk readonly -eu awk $(pwd)
+	"$1" awk then echo cd $(pwd) then readonly $(pwd) | test test $(pwd)
+		echo && then printf -eu /usr/bin $(pwd) grep then cd $(pwd) 'quoted text'
+${HOME} grep | export echo | "$@" && local "$1" awk readonly echo printf "$@"
+	2>/dev/null "$@" /usr/bin export export echo $(pwd) 'quoted text'
+	/usr/bin && -eu export then /usr/bin -eu "$@" grep x=1 "$1" cd then
+then ${HOME} 'quoted text' -eu $(pwd) && 'quoted text' 'quoted text'
+	--verbose grep $(pwd) $(pwd) readonly readonly sed test export echo | sed
+		test local printf -eu local sed export test local local
+		echo -eu && echo && 2>/dev/null -eu "$1" awk
+--verbose sed ${HOME} | cd printf sed local then
+		/usr/bin grep $(pwd) | done --verbose
+2>/dev/null /usr/bin echo readonly ${HOME} export /usr/bin "$1" | && 'quoted text'
+		then awk echo awk 'quoted text' awk then sed "$1" readonly
+	"$1" 'quoted text' local
+		${HOME} -eu -eu "$@" export test then && ${HOME} local test printf
+grep test readonly x=1 --verbose cd --verbose printf "$1" grep sed export cd
+readonly -eu echo awk ${HOME} --verbose | grep sed readonly "$1"
+		done local done "$@" awk | $(pwd)
+	2>/dev/null --verbose "$1" -eu awk -eu
+	export 'quoted text' && && sed done 2>/dev/null "$@" cd ${HOME} awk readonly
+"$@" grep test cd test export
+	cd printf cd x=1 | printf test then test then /usr/bin ${HOME} "$@" then
+	$(pwd) 2>/dev/null awk cd awk ${HOME} 2>/dev/null
+	test sed readonly local ${HOME} done sed readonly cd --verbose done readonly
+&& awk cd $(pwd) -eu sed sed grep "$@"
+	grep then "$1" && readonly test
+		local then | -eu export export
+$(pwd) readonly 2>/dev/null
+		/usr/bin $(pwd) $(pwd) local
+		'quoted text' --verbose readonly local sed then printf local "$1" cd --verbose 2>/dev/null
+		grep then echo x=1 done | export local /usr/bin awk /usr/bin test $(pwd)
+		"$@" test -eu "$1" x=1 printf then awk && "$@" ${HOME} 'quoted text' cd
+		test --verbose local echo grep 2>/dev/null && | test x=1 export local echo "$1"
+		${HOME} | /usr/bin | x=1 ${HOME} export awk readonly local
+	${HOME} --verbose /usr/bin --verbose awk export test awk export
+	export $(pwd) 2>/dev/null && -eu && cd readonly readonly test grep -eu -eu
+	test /usr/bin done "$1" 'quoted text'
+grep grep "$@" export then ${HOME} cd cd ${HOME} x=1
+	export readonly sed cd "$@"
+		then ${HOME} cd 2>/dev/null 'quoted text' grep "$@" readonly 2>/dev/null
+sed then sed x=1 | ${HOME} grep export /usr/bin 'quoted text'
+	local 'quoted text' then "$1"
+--verbose done local /usr/bin export
+		export printf readonly $(pwd) 'quoted text'
+test awk test done /usr/bin -eu cd "$1" sed x=1 readonly $(pwd) then
+--verbose /usr/bin 'quoted text' --verbose
+	| readonly printf local
+then x=1 echo export grep /usr/bin "$@" /usr/bin sed grep x=1
+x=1 "$@" grep test export cd | test
+grep $(pwd) test echo && $(pwd) /usr/bin test export echo echo then test "$1"
+		echo | awk --verbose &&
+	printf ${HOME} ${HOME} printf /usr/bin x=1 then x=1
+	&& test awk && done done ${HOME} 2>/dev/null ${HOME}
+	sed local awk local "$1" x=1 && printf 'quoted text'
+local grep 'quoted text' ${HOME} 'quoted text'
+done --verbose echo then x=1 'quoted text'
+		'quoted text' cd 2>/dev/null awk 2>/dev/null /usr/bin
+	test x=1 done readonly cd /usr/bin local -eu /usr/bin 2>/dev/null
+	"$1" 'quoted text' $(pwd) x=1 export export x=1 "$@"
+echo echo printf 'quoted text'
+	"$1" 2>/dev/null /usr/bin echo "$@" "$1" 2>/dev/null 2>/dev/null
+	local sed test "$@" x=1 --verbose "$1"
+		done $(pwd) readonly "$1" | 2>/dev/null cd
+		done sed && 2>/dev/null 'quoted text'
+		${HOME} --verbose "$@" 'quoted text' 'quoted text' 'quoted text' /usr/bin
+	x=1 printf && /usr/bin /usr/bin then echo printf | 'quoted text' export
+local $(pwd) $(pwd) /usr/bin awk sed "$@" && local export
+$(pwd) && printf "$1" $(pwd)
+	local awk && printf grep done "$@" grep sed
+		$(pwd) cd printf --verbose grep sed 2>/dev/null sed ${HOME} readonly 2>/dev/null
+$(pwd) "$@" x=1 /usr/bin cd $(pwd) 'quoted text' /usr/bin /usr/bin
+"$@" echo grep ${HOME} readonly
+		-eu awk | "$1" echo 'quoted text' /usr/bin awk 2>/dev/null
+		sed local printf readonly done sed | sed test /usr/bin | printf
+	sed local readonly awk export cd readonly sed $(pwd) x=1 x=1 &&
+	&& x=1 2>/dev/null grep "$@" x=1 awk "$@" echo local
+		grep awk ${HOME} 2>/dev/null -eu awk | cd echo ${HOME} readonly sed
+	2>/dev/null ${HOME} test local cd x=1 -eu 2>/dev/null local export 2>/dev/null
+	x=1 "$1" cd awk "$@" readonly
+"$@" then "$@" cd "$1" && /usr/bin 'quoted text' grep
+	/usr/bin grep --verbose x=1 then 'quoted text'
+-eu -eu awk x=1 "$1" --verbose sed x=1 awk export printf -eu
+	readonly grep echo ${HOME} --verbose echo
+export x=1 ${HOME} echo test export | 2>/dev/null --verbose
+local | ${HOME} printf 'quoted text' awk 2>/dev/null -eu 2>/dev/null
+		&& then "$1" sed 2>/dev/null
+	test $(pwd) && cd $(pwd) readonly cd then $(pwd) readonly x=1 'quoted text'
+2>/dev/null $(pwd) x=1 grep then cd x=1 awk done ${HOME} $(pwd) then
+done printf "$1" done 'quoted text' then $(pwd) | awk then 2>/dev/null
+	${HOME} 'quoted text' "$@" local sed awk x=1
+		export /usr/bin test | x=1 printf /usr/bin
+then 2>/dev/null local /usr/bin echo then 'quoted text' local --verbose ${HOME}
+	--verbose readonly then echo printf readonly 2>/dev/null printf 2>/dev/null
+		"$@" test echo then 'quoted text' "$@" -eu $(pwd) -eu echo
+--verbose printf -eu -eu printf then "$@" $(pwd) $(pwd) printf --verbose local export
+grep --verbose 2>/dev/null x=1 then
+	cd | $(pwd) echo cd "$1" then "$@" "$1" "$@" local -eu ${HOME} echo
+	"$1" && then test awk $(pwd) echo done sed | -eu
+		readonly /usr/bin awk "$@" done cd sed done sed 'quoted text'
+	| /usr/bin "$@" ${HOME} sed
+		-eu done | "$1" cd 2>/dev/null grep x=1 export export awk cd done export
+/usr/bin grep x=1 printf 'quoted text'
+"$@" printf "$1" done test -eu sed &&
+	awk export 'quoted text' ${HOME} done 2>/dev/null
+	done echo --verbose echo |
+	&& awk | cd test readonly /usr/bin export echo 'quoted text' && echo readonly
+${HOME} echo "$@" $(pwd) 2>/dev/null | printf /usr/bin --verbose awk
+test --verbose && "$@" | --verbose
+export echo /usr/bin x=1 x=1 && /usr/bin
+		echo $(pwd) 2>/dev/null
+"$1" --verbose cd done cd sed $(pwd) 2>/dev/null 'quoted text'
+readonly | grep -eu test awk grep readonly local awk grep grep 'quoted text'
+sed | /usr/bin sed done then -eu -eu local $(pwd) && awk readonly ${HOME} && "$1"
+	export awk "$1" "$@" && -eu
+		${HOME} echo --verbose then 2>/dev/null /usr/bin "$@" sed
+grep done 2>/dev/null echo /usr/bin ${HOME} -eu grep
+		"$@" $(pwd) /usr/bin test printf cd | done /usr/bin "$1"
+		sed local | readonly /usr/bin | && "$@" grep
+	'quoted text' printf "$@" "$1" readonly done -eu done awk $(pwd)
+sed | -eu "$@" "$1" local
+		test 'quoted text' x=1 "$@" test "$@"
+		| -eu test 2>/dev/null
+		"$@" then -eu echo then export sed grep "$@" && sed then x=1 2>/dev/null /usr/bin
+	$(pwd) 'quoted text' x=1
+		export "$1" x=1 "$@" test 'quoted text'
+		$(pwd) && printf sed echo "$@" 'quoted text' &&
+grep --verbose echo 2>/dev/null && cd -eu cd /usr/bin | sed
+		local then "$1" then awk readonly grep readonly $(pwd)
+	echo export x=1 printf "$@" "$1" 'quoted text'
+2>/dev/null sed sed 'quoted text' then echo x=1 readonly | ${HOME} sed sed ${HOME}
+		&& then x=1 x=1 then test done | sed export done 2>/dev/null ${HOME} local cd "$1"
+		readonly sed x=1 "$1" -eu cd -eu "$1" "$@" $(pwd) sed ${HOME} 'quoted text' done
+readonly -eu $(pwd) x=1 --verbose && local /usr/bin --verbose
+		done export echo ${HOME} sed echo test $(pwd) export grep | awk awk | cd sed
+--verbose x=1 awk sed 2>/dev/null 'quoted text'
+		readonly test sed 2>/dev/null test "$@" 2>/dev/null
+"$@" cd -eu 2>/dev/null cd ${HOME}
+		cd 2>/dev/null $(pwd) export x=1
+		grep sed 2>/dev/null $(pwd)
+		echo echo /usr/bin test test -eu 'quoted text' --verbose test
+		then 2>/dev/null grep /usr/bin 'quoted text' awk
+	printf cd "$@" export 2>/dev/null grep --verbose /usr/bin && sed | 2>/dev/null
+	'quoted text' 'quoted text'
+		&& sed then 'quoted text'
+		local awk 'quoted text' /usr/bin 'quoted text' awk grep
+	cd local done 'quoted text' ${HOME} then sed && "$1" 'quoted text'
+-eu readonly | grep test local 'quoted text' -eu local
+	echo x=1 "$1" | sed $(pwd) local && /usr/bin &&
+		--verbose done $(pwd) x=1 test | /usr/bin 'quoted text' ${HOME} grep 2>/dev/null
+	readonly echo --verbose test
+	x=1 && done cd && && local --verbose then local ${HOME} "$1" local
+		'quoted text' 2>/dev/null printf test local -eu /usr/bin export
+		local 2>/dev/null test -eu
+2>/dev/null $(pwd) test && printf /usr/bin
+local awk printf cd awk /usr/bin 'quoted text' export
+	echo "$1" /usr/bin grep ${HOME}
+sed -eu grep local then sed echo export /usr/bin cd "$@" x=1 awk export test
+awk && test | then printf awk cd grep test export "$@" x=1 export
+		grep echo | 'quoted text' --verbose "$1" done test && export "$1" done
+	export export /usr/bin sed -eu ${HOME} test echo printf export grep 2>/dev/null
+	done -eu sed readonly echo 2>/dev/null "$@" local awk "$1" 2>/dev/null readonly
+&& printf 'quoted text' --verbose "$1" cd sed "$1" local 'quoted text'
+		export $(pwd) /usr/bin printf /usr/bin
+${HOME} echo $(pwd) awk $(pwd) grep done
+		'quoted text' cd -eu "$@" then "$@" | "$@" then echo
+		printf "$@" export readonly done x=1 export "$@" echo
+		test awk | local --verbose readonly "$1"
+2>/dev/null /usr/bin x=1 2>/dev/null
+		sed cd 2>/dev/null "$1" x=1 --verbose printf "$@"
+then x=1 "$1" done ${HOME}
+grep awk test && echo readonly echo 2>/dev/null 2>/dev/null export
+done printf printf 2>/dev/null x=1 echo then | 2>/dev/null
+		$(pwd) readonly printf readonly
+	cd done awk local "$@" && 'quoted text' 2>/dev/null ${HOME} $(pwd)
+grep 2>/dev/null cd "$1" echo /usr/bin -eu then printf
+		&& /usr/bin test x=1 awk
+		/usr/bin ${HOME} $(pwd) /usr/bin readonly printf
+	cd then then then done echo --verbose echo 2>/dev/null sed test
+	printf "$1" && sed grep "$1" echo $(pwd) readonly $(pwd)
+	$(pwd) export /usr/bin -eu echo | 2>/dev/null && grep --verbose
+	done -eu local test readonly printf
+echo awk export "$@" --verbose test /usr/bin
+sed /usr/bin | done "$1" then readonly "$@" x=1 --verbose | then grep 'quoted text'
+-eu local -eu 'quoted text' | export local printf printf $(pwd) 2>/dev/null echo
+--verbose $(pwd) echo "$@" --verbose printf x=1 ${HOME}
+	printf awk grep done readonly 'quoted text' local |
+	awk export -eu | 2>/dev/null && then 2>/dev/null && |
+		printf x=1 && cd local cd then cd /usr/bin printf echo echo && awk | --verbose
+	test -eu /usr/bin printf
+'quoted text' awk awk x=1 awk 2>/dev/null done export test ${HOME}
+		export && $(pwd) cd $(pwd) grep export done /usr/bin awk ${HOME}
+		x=1 test 2>/dev/null 2>/dev/null 2>/dev/null && sed "$@" export
+	sed | "$1" export printf x=1 awk ${HOME} awk local grep
+		then test --verbose grep cd 2>/dev/null
+'quoted text' ${HOME} grep --verbose "$@" test test done "$1" ${HOME} export sed
+		export x=1 export printf
+	readonly 'quoted text' echo sed
+	/usr/bin done -eu echo readonly
+		then --verbose -eu echo sed awk ${HOME} $(pwd) export
+/usr/bin | -eu && | /usr/bin export
+		--verbose ${HOME} --verbose done -eu test printf readonly --verbose
+${HOME} printf 'quoted text' test grep && -eu x=1 grep ${HOME} cd grep grep -eu
+	-eu && test echo --verbose echo then "$@" echo readonly
+&& sed "$@" echo printf 'quoted text'
+done 2>/dev/null | x=1 "$1" | then -eu --verbose local then 2>/dev/null
+	sed cd done && x=1 x=1 then readonly $(pwd) test
+$(pwd) --verbose "$@" echo | && x=1 | echo | export echo && x=1
+"$@" done && cd then grep cd awk awk
+		readonly 2>/dev/null ${HOME} readonly readonly x=1 'quoted text'
+		echo then export printf grep 2>/dev/null && 'quoted text' cd cd sed $(pwd)
+	done --verbose ${HOME} local 'quoted text' printf
+then export done export local
+sed -eu grep grep test awk 'quoted text'
+		${HOME} readonly printf test printf 2>/dev/null
+		cd /usr/bin -eu | cd printf ${HOME}
+		local "$1" | --verbose | local 'quoted text' grep "$1" 'quoted text'
+	| done x=1 printf test
+		$(pwd) then 'quoted text'
+awk --verbose "$1" sed && readonly
+	grep local then "$@" done "$@"
+	/usr/bin "$@" "$1" printf --verbose cd 2>/dev/null grep
+		export x=1 2>/dev/null readonly "$@" $(pwd) cd echo cd awk then test grep "$1"
+		$(pwd) sed awk "$1" readonly &&
+printf awk export printf then $(pwd) done ${HOME} && export printf cd
+	local export local $(pwd) ${HOME}
+done -eu readonly sed 2>/dev/null 2>/dev/null && echo ${HOME}
+	awk ${HOME} 2>/dev/null sed readonly echo $(pwd)
+printf "$1" printf readonly readonly sed 'quoted text'
+	printf && 2>/dev/null awk readonly then grep awk printf awk
+		$(pwd) echo | grep --verbose local export | export --verbose sed export
+	sed awk readonly "$@" grep cd grep grep then 2>/dev/null &&
+export echo cd printf 2>/dev/null grep ${HOME}
+'quoted text' /usr/bin done $(pwd) test | 'quoted text'
+"$1" readonly $(pwd) "$1" readonly local cd x=1 --verbose "$1" -eu printf
+$(pwd) -eu printf echo x=1 && 2>/dev/null export
+	sed grep test export 'quoted text'
+		echo x=1 readonly x=1 export 'quoted text' done
+		sed 'quoted text' 'quoted text'
+	cd test -eu x=1 | /usr/bin ${HOME} "$@" | --verbose grep
+	done cd x=1 --verbose readonly
+-eu export then $(pwd) 2>/dev/null
+/usr/bin --verbose sed "$@" | readonly
+		local /usr/bin 'quoted text'
+local then done | done test test && -eu readonly export
+	sed $(pwd) /usr/bin export $(pwd) "$@"
+x=1 ${HOME} test 'quoted text' 'quoted text' done x=1 --verbose
+&& awk awk && done "$@" 2>/dev/null
+'quoted text' | grep awk awk "$1" cd "$1"
+	| then --verbose 'quoted text' 2>/dev/null
+	export | echo local ${HOME}
+	/usr/bin printf && 2>/dev/null readonly -eu 2>/dev/null /usr/bin
+	echo readonly && -eu test ${HOME} then && $(pwd) sed /usr/bin
+		done then readonly "$@"
+	then done | 'quoted text' 'quoted text'
+	readonly test local "$@" /usr/bin sed done -eu /usr/bin local "$@" 'quoted text'
+2>/dev/null then awk then | awk -eu awk export
+	grep ${HOME} then "$1" local echo $(pwd) cd test
+export printf export grep "$1" cd
+		awk "$1" then -eu then
+cd local /usr/bin readonly sed -eu 'quoted text' --verbose
+	'quoted text' local ${HOME} "$1" export test cd 'quoted text' -eu echo
+		awk export sed /usr/bin echo --verbose "$1" 'quoted text' grep
+		"$@" local ${HOME} /usr/bin
+		${HOME} /usr/bin local --verbose
+	then sed awk --verbose && readonly sed test --verbose 'quoted text'
+--verbose 'quoted text' sed local printf --verbose -eu "$1" awk then echo
+		${HOME} printf grep x=1 -eu $(pwd) --verbose
+	2>/dev/null local printf done -eu printf cd awk echo | "$1" 'quoted text' done
+	"$@" x=1 "$@" 'quoted text' then --verbose grep grep done /usr/bin readonly
+		done grep awk done "$@" awk test printf $(pwd) printf test |
+local "$@" -eu grep readonly "$@" -eu --verbose printf test then done
+--verbose export done /usr/bin test /usr/bin
+		cd && x=1 printf && -eu export export
+"$@" export 'quoted text' export readonly awk 2>/dev/null
+		-eu x=1 grep done 'quoted text'
+	sed 'quoted text' 'quoted text' -eu 'quoted text' x=1 echo awk 2>/dev/null --verbose
+	cd x=1 sed echo local /usr/bin awk
+	"$@" sed "$@" cd /usr/bin local test printf ${HOME}
+		sed echo export /usr/bin | awk local $(pwd)
+	cd grep grep --verbose test then awk
+	local done --verbose echo test | $(pwd) | grep
+	sed cd then echo "$1" export export -eu "$1" 'quoted text'
+local then && "$@" --verbose readonly 2>/dev/null "$@"
+"$1" cd export | "$@" -eu -eu then /usr/bin
+		readonly --verbose 2>/dev/null -eu /usr/bin
+		${HOME} printf echo local | test grep sed && local "$@" echo ${HOME} echo done
+		echo && local sed test local -eu grep $(pwd) | sed && export cd && cd x=1
+then "$@" readonly "$1" local echo local ${HOME} 'quoted text'
+then done printf local x=1 "$1" 'quoted text' sed 'quoted text'
+		'quoted text' awk done $(pwd) grep
+	done "$@" && printf awk cd awk
+done printf "$1" -eu echo cd $(pwd) x=1 $(pwd) "$1" ${HOME} && then x=1 2>/dev/null
+	&& ${HOME} sed "$1" sed then printf | done echo "$1" && -eu /usr/bin |
+readonly /usr/bin grep 2>/dev/null --verbose cd printf cd -eu awk -eu
+/usr/bin ${HOME} export done "$@" printf readonly ${HOME} --verbose awk /usr/bin
+	awk ${HOME} -eu export readonly ${HOME} test
+"$1" printf awk local printf && 'quoted text' echo local awk && done
+		printf --verbose local && "$@" readonly | grep awk 2>/dev/null "$1" x=1
+		2>/dev/null cd 2>/dev/null "$@" $(pwd) "$@" -eu /usr/bin && sed 'quoted text'
+	/usr/bin grep ${HOME} echo "$@" sed x=1 then
+x=1 2>/dev/null x=1 $(pwd) | awk ${HOME} $(pwd) 2>/dev/null x=1
+--verbose test local then $(pwd) ${HOME} sed done then 'quoted text'
+&& echo local cd awk sed ${HOME} export cd done
+	echo sed cd done test export
+&& sed $(pwd) readonly 2>/dev/null ${HOME} sed $(pwd) echo printf
+"$@" printf 'quoted text'
+export /usr/bin cd 'quoted text' "$@" test cd x=1 awk test 2>/dev/null
+echo && -eu --verbose test && -eu grep "$1"
+		cd /usr/bin "$1" x=1 export sed "$@" | $(pwd) && x=1 echo
+		readonly grep printf /usr/bin ${HOME}
+		cd export test done sed --verbose echo /usr/bin then local readonly awk
+awk grep 2>/dev/null export /usr/bin 'quoted text' && $(pwd)
+	grep ${HOME} printf readonly ${HOME} x=1
+'quoted text' done done && "$1" echo echo x=1 printf "$@"
+		"$1" export "$1" awk local x=1 echo -eu test then 2>/dev/null readonly
+		printf awk sed -eu echo done
+x=1 awk /usr/bin 'quoted text'
+#include c246.sh
+echo 2>/dev/null done --verbose ${HOME} "$@" ${HOME} grep readonly
+	then test export cd cd | ${HOME} export "$1" test local "$@"
+&& x=1 cd "$@" $(pwd) --verbose -eu | "$1" done 'quoted text'
+		"$1" then ${HOME} done local echo && awk awk
+grep x=1 'quoted text' "$1" ${HOME} grep done
+		readonly awk "$@" x=1 2>/dev/null test "$@" $(pwd) test sed x=1 -eu
+		"$1" printf awk echo test 'quoted text' done
+		"$@" -eu printf --verbose printf $(pwd) local awk x=1 'quoted text'
+		/usr/bin x=1 grep printf && | echo x=1
+		done done /usr/bin sed local printf sed
+		| local echo /usr/bin export 'quoted text' done echo --verbose
+	done /usr/bin -eu then $(pwd) local 2>/dev/null && local
+		"$1" && readonly then x=1 | /usr/bin "$@" awk
+		${HOME} test $(pwd) grep /usr/bin
+done done grep then readonly local x=1 ${HOME} $(pwd) test $(pwd)
+--verbose $(pwd) "$@" then then | "$1" "$@" $(pwd) -eu local readonly
+	done --verbose 2>/dev/null
+		done $(pwd) && "$@" 'quoted text'
+		then cd $(pwd) | | export
+		$(pwd) ${HOME} sed && ${HOME} cd ${HOME}
+		echo local --verbose --verbose readonly echo sed echo export awk &&
+		/usr/bin "$@" done readonly
+	done awk printf test local sed | -eu && 2>/dev/null $(pwd)
+-eu /usr/bin then grep
+		| readonly export export 'quoted text'
+		| cd export "$@" && printf readonly export then --verbose
+		&& "$1" readonly | echo sed -eu x=1 test grep "$1" -eu sed
+		awk x=1 ${HOME} --verbose /usr/bin sed printf readonly
+	/usr/bin export && sed export
+2>/dev/null grep grep |
+		then echo echo ${HOME} x=1 done local $(pwd) 'quoted text' --verbose --verbose
+	"$@" readonly cd | ${HOME} -eu | | 2>/dev/null
+export 2>/dev/null awk -eu export ${HOME} readonly echo sed done --verbose done
+	test "$@" cd "$1" printf local printf printf cd test "$1" | done local
+echo ${HOME} 2>/dev/null export x=1
+		echo readonly ${HOME} --verbose
+	&& /usr/bin -eu --verbose $(pwd) awk export "$1" export "$@" sed readonly grep "$@"
+	sed 'quoted text' done ${HOME} local | | --verbose test
+sed 'quoted text' x=1 | local done -eu 'quoted text' ${HOME} sed $(pwd) printf
+		${HOME} -eu grep cd 2>/dev/null
+$(pwd) readonly -eu 2>/dev/null "$@" ${HOME} export 'quoted text' done then
+2>/dev/null 'quoted text' "$1" --verbose printf awk awk /usr/bin cd x=1 /usr/bin
+		${HOME} 2>/dev/null sed
+${HOME} "$1" $(pwd) sed grep ${HOME}
+sed $(pwd) sed awk export x=1 cd $(pwd)
+		| $(pwd) $(pwd) 'quoted text' ${HOME}
+grep echo readonly && awk cd "$@" grep | grep
+2>/dev/null "$1" x=1 sed 'quoted text' printf done awk then sed
+x=1 2>/dev/null readonly 2>/dev/null
+	printf ${HOME} awk test "$@" 'quoted text' $(pwd) export
+readonly cd readonly sed $(pwd) grep -eu local -eu done sed "$1" printf
+	readonly /usr/bin 'quoted text' ${HOME} local ${HOME} grep echo cd test -eu grep
+		"$@" sed then ${HOME} grep ${HOME} $(pwd) "$@" printf cd $(pwd)
+		--verbose awk awk test then ${HOME}
+&& done echo && /usr/bin --verbose $(pwd) $(pwd) test
+-eu awk 'quoted text' awk 'quoted text' sed -eu && readonly printf export printf
+| echo x=1 x=1 "$1" && export then --verbose
+		cd /usr/bin sed ${HOME} export x=1 export && -eu && | local -eu test | && 2>/dev/null
+	cd cd sed $(pwd) x=1 sed "$@"
+	local export printf grep echo -eu cd
+	done 'quoted text' done then test
+	done sed "$@" cd grep x=1 -eu local 'quoted text'
+	"$1" $(pwd) local 'quoted text' "$@" "$@" --verbose /usr/bin -eu awk "$@"
+	x=1 printf then printf 2>/dev/null 2>/dev/null
+	printf 2>/dev/null cd "$@" 2>/dev/null readonly grep readonly | printf
+sed -eu local "$1" $(pwd) /usr/bin | test --verbose
+		awk export 2>/dev/null "$@" 2>/dev/null test | x=1 echo ${HOME}
+	cd "$1" 'quoted text' cd local ${HOME} 'quoted text' /usr/bin "$1"
+	echo -eu echo $(pwd) printf done 'quoted text'
+	"$1" "$@" $(pwd) export export
+		then done grep then 'quoted text' then cd then printf --verbose then "$@"
+		2>/dev/null done $(pwd) printf then x=1 | local sed
+	done | done $(pwd) && 2>/dev/null cd cd | --verbose $(pwd) sed
+| awk ${HOME} -eu printf done export grep
+		then local 'quoted text' done echo 2>/dev/null done -eu ${HOME}
+	readonly "$1" echo grep done 'quoted text' --verbose sed $(pwd)
+		"$@" 2>/dev/null grep test awk 'quoted text'
+	export "$@" then printf
+/usr/bin test | $(pwd) x=1 echo echo done
+awk export test 2>/dev/null done cd x=1 "$@" sed
+		local then echo | export ${HOME} awk echo && grep
+		printf awk done $(pwd) export then | done readonly awk "$1" done 2>/dev/null
+2>/dev/null printf --verbose export readonly /usr/bin
+	/usr/bin "$@" test grep sed readonly "$1" $(pwd)
+&& awk done printf | x=1 $(pwd) local $(pwd) "$1"
+		x=1 $(pwd) then /usr/bin
+awk 2>/dev/null done done x=1 x=1 local export test export && local "$@" done then
+	cd -eu -eu printf awk export /usr/bin
+	test | x=1 export echo
+	done readonly then local $(pwd)
+	/usr/bin --verbose --verbose ${HOME} printf 'quoted text'
+2>/dev/null echo | printf 2>/dev/null 2>/dev/null ${HOME} cd "$1" $(pwd)
+then sed && grep local && && --verbose ${HOME} /usr/bin
+done x=1 printf $(pwd) printf "$1" cd x=1 echo "$@" && 2>/dev/null
+readonly printf ${HOME} export "$1" cd export echo -eu --verbose 2>/dev/null
+export readonly 'quoted text' && $(pwd) ${HOME} 'quoted text' /usr/bin grep
+	then x=1 /usr/bin 'quoted text'
+grep -eu export local ${HOME}
+	sed readonly --verbose readonly done cd && readonly readonly echo
+"$@" -eu local printf ${HOME} echo then
+2>/dev/null /usr/bin && ${HOME} x=1 -eu "$1" $(pwd) then grep -eu | 2>/dev/null
+${HOME} /usr/bin 2>/dev/null && test ${HOME}
+/usr/bin then grep --verbose sed | echo local
+printf --verbose "$1" 'quoted text' test sed /usr/bin ${HOME}
+x=1 grep grep x=1 export -eu "$@" | | then $(pwd)
+		/usr/bin awk && test | ${HOME} export echo done sed
+	test sed done grep echo x=1 then $(pwd) 2>/dev/null ${HOME}
+	$(pwd) && echo test readonly /usr/bin export --verbose 2>/dev/null
+		&& export -eu sed printf done grep 'quoted text' x=1 done grep grep
+	| export && readonly && /usr/bin "$@" cd test awk -eu sed readonly | sed
+		echo awk test printf grep test -eu printf 2>/dev/null 'quoted text' sed grep
+	&& "$1" --verbose awk 2>/dev/null awk awk
+		2>/dev/null test 'quoted text' grep ${HOME} x=1 printf "$@"
+		2>/dev/null awk && | export -eu -eu --verbose then readonly "$@" -eu &&
+		&& "$1" $(pwd) echo | "$@" export 2>/dev/null then && cd printf
+		"$1" cd then "$@" && | then -eu | then | grep x=1 "$1" cd x=1 -eu --verbose --verbose
+	test sed then sed -eu
+	/usr/bin x=1 cd grep cd "$@" then -eu then
+		sed /usr/bin sed grep test then readonly
+awk local /usr/bin -eu
+	local done readonly export /usr/bin test && | "$1" cd | $(pwd) then $(pwd) 2>/dev/null
+	--verbose cd ${HOME} --verbose -eu | echo test export && /usr/bin -eu "$1"
+done "$1" readonly ${HOME} "$1" local "$@" | -eu
+	--verbose 'quoted text' $(pwd) grep "$@" test $(pwd)
+		printf awk 2>/dev/null "$1" cd printf -eu
+		&& --verbose printf | 2>/dev/null x=1 readonly
+		printf /usr/bin printf ${HOME} "$1" x=1 "$@"
+		"$1" done "$@" printf ${HOME} x=1 2>/dev/null
+		export then then then test --verbose test
+then $(pwd) printf awk 'quoted text'
+$(pwd) ${HOME} 'quoted text' "$@" -eu /usr/bin awk test cd sed cd sed done "$1"
+&& "$1" sed ${HOME} x=1 done readonly -eu | done local x=1 printf ${HOME}
+	echo done grep done test test 'quoted text' grep --verbose --verbose ${HOME}
+echo cd -eu --verbose test export cd export | $(pwd) export
+		cd echo printf export /usr/bin done | printf x=1 cd done ${HOME} | sed -eu
+		grep /usr/bin sed sed test export sed x=1 awk export grep test
+cd readonly "$@" /usr/bin export -eu "$@" | printf
+	--verbose readonly $(pwd) "$@" awk test
+		grep x=1 x=1 sed -eu printf $(pwd) test cd export && awk
+| /usr/bin test sed sed then /usr/bin "$@" 2>/dev/null --verbose
+		test sed /usr/bin 'quoted text' --verbose
+	sed "$1" 2>/dev/null local then done local printf 2>/dev/null grep echo 'quoted text'
+	&& done then test test 'quoted text' test | awk --verbose 2>/dev/null
+	echo sed then then export cd ${HOME} --verbose sed
+		--verbose then done --verbose && awk then -eu "$1" sed done 2>/dev/null
+local && export 2>/dev/null
+	test grep local -eu /usr/bin $(pwd) | /usr/bin "$1" printf ${HOME}
+-eu awk awk readonly test readonly sed then 2>/dev/null export
+	printf sed "$1" -eu cd "$@" $(pwd) /usr/bin "$1" cd "$@"
+	awk x=1 /usr/bin done local done --verbose echo "$1"
+test | grep cd export grep
+		'quoted text' -eu done readonly | "$@" x=1 $(pwd) local
+	| | export --verbose local awk $(pwd) "$@" printf export test printf
+local readonly --verbose test awk sed cd cd test 'quoted text' | readonly
+test echo awk local sed 'quoted text' 'quoted text'
+		sed "$1" then ${HOME} grep cd -eu done
+	| grep cd done 2>/dev/null readonly /usr/bin grep test awk grep readonly sed
+		local sed awk done awk local then echo "$1" test then "$@" "$@"
+	--verbose "$1" test "$@" /usr/bin readonly /usr/bin printf sed awk printf
+printf grep grep $(pwd) export sed ${HOME} && && echo --verbose
+	-eu printf "$1" grep --verbose
+	$(pwd) local "$@" && | grep printf
+	"$1" /usr/bin $(pwd) /usr/bin -eu sed then && done printf
+2>/dev/null export printf $(pwd) 2>/dev/null "$@" then /usr/bin
+	--verbose 'quoted text' sed 'quoted text'
+"$1" readonly local export
+/usr/bin && | test echo readonly x=1 grep | local sed x=1 x=1 x=1 'quoted text'
+		local && 2>/dev/null echo --verbose readonly --verbose
+		export test printf export 'quoted text'
+echo done ${HOME} | | cd awk
+awk -eu 'quoted text' -eu printf /usr/bin "$@" sed "$@" && "$1"
+	readonly local --verbose awk local /usr/bin && printf readonly cd awk
+		/usr/bin export x=1 cd ${HOME} readonly
+--verbose && | sed sed done grep -eu
+readonly done readonly sed
+	'quoted text' grep echo test x=1 done echo printf readonly
+	&& ${HOME} 'quoted text' printf grep local
+		$(pwd) local export x=1 --verbose done done
+		then x=1 cd export -eu
+		printf cd cd 2>/dev/null "$1" ${HOME}
+awk awk readonly awk export then --verbose then test export &&
+grep && | grep awk $(pwd) then x=1 -eu
+		local local readonly /usr/bin --verbose
+	-eu ${HOME} 2>/dev/null cd test $(pwd) cd grep "$@" && echo 'quoted text'
+grep --verbose && --verbose 'quoted text'
+	awk local test /usr/bin 2>/dev/null
+		&& 2>/dev/null 'quoted text'
+"$@" done x=1 $(pwd) ${HOME} 2>/dev/null
+'quoted text' 'quoted text'
+		--verbose 2>/dev/null sed /usr/bin readonly then -eu echo "$1" export
+	awk local export local grep cd && "$1"
+		sed then -eu export "$@" done printf -eu $(pwd) "$1" $(pwd) then printf grep
+printf $(pwd) ${HOME} "$@" "$1" sed done
+	"$@" 'quoted text' | done
+'quoted text' printf printf $(pwd) "$1" 'quoted text' readonly -eu done
+	then printf | --verbose $(pwd) ${HOME}
+		-eu sed cd printf grep then 2>/dev/null
+"$@" ${HOME} x=1 "$@" export | sed 'quoted text'
+	"$@" --verbose && | | cd 2>/dev/null && /usr/bin
+sed readonly 2>/dev/null && -eu "$@" -eu
+&& 2>/dev/null | printf cd awk "$@" 'quoted text' --verbose
+		"$1" printf export -eu sed done awk --verbose
+		"$@" readonly --verbose
+		done done then x=1 sed ${HOME} | printf
+printf && test local echo cd $(pwd)
+| echo && test test -eu readonly
+$(pwd) "$@" cd x=1 readonly /usr/bin 'quoted text'
+| -eu cd grep cd done 2>/dev/null
+		${HOME} echo printf ${HOME} readonly echo 'quoted text' && --verbose
+printf awk test && -eu then -eu readonly x=1 "$@" && ${HOME}
+	2>/dev/null awk awk sed ${HOME} readonly
+	| done cd "$@" then test export "$@" --verbose /usr/bin test && test -eu grep 'quoted text'
+"$@" sed awk 2>/dev/null
+	'quoted text' printf echo "$@" awk $(pwd) x=1 done $(pwd) /usr/bin
+echo 2>/dev/null done 'quoted text' $(pwd) local $(pwd) local readonly
+readonly local readonly cd then
+-eu then x=1 grep done
+	local local printf 'quoted text' echo test test printf /usr/bin test done echo 'quoted text'
+--verbose x=1 --verbose 2>/dev/null local cd | "$@" /usr/bin
+	| export test ${HOME} sed cd --verbose | readonly "$@" x=1 echo 'quoted text' $(pwd)
+	sed "$@" /usr/bin export
+readonly printf grep "$@" && printf readonly local 2>/dev/null
+	/usr/bin && "$1" readonly ${HOME} x=1 /usr/bin /usr/bin 2>/dev/null | "$1" &&
+| sed "$1" grep -eu "$@" readonly
+	"$1" done awk $(pwd) ${HOME} ${HOME} ${HOME} $(pwd)
+	then sed -eu export test grep local 'quoted text' && sed echo 2>/dev/null
+${HOME} | "$@" export readonly $(pwd) export --verbose sed test
+		sed done -eu 'quoted text' &&
+--verbose echo "$1" ${HOME} x=1 --verbose local ${HOME}
+		then "$1" x=1 grep && grep then printf local printf | 'quoted text'
+	"$1" && cd cd | test grep awk cd local && --verbose ${HOME} ${HOME} 'quoted text'
+		awk test && then cd | "$@" local cd -eu
+$(pwd) sed "$@" && test printf awk
+-eu then -eu && sed "$1" grep local x=1 echo
+echo export readonly --verbose done 'quoted text'
+	| "$@" done awk grep echo /usr/bin cd local /usr/bin ${HOME} 2>/dev/null "$@"
+	export $(pwd) readonly
+		-eu ${HOME} then export then readonly "$@" --verbose
+	awk echo --verbose sed x=1 done local local ${HOME} echo readonly x=1 $(pwd) ${HOME}
+local $(pwd) done grep readonly ${HOME} ${HOME}
+	printf echo $(pwd) readonly done | | test /usr/bin
+$(pwd) | -eu awk awk ${HOME} local
+		test "$@" | --verbose cd sed /usr/bin test /usr/bin /usr/bin
+| readonly readonly | "$@" cd grep "$1"
+	done ${HOME} /usr/bin --verbose /usr/bin
+test "$@" then && readonly local 2>/dev/null --verbose x=1 | then grep |
+	2>/dev/null $(pwd) cd 2>/dev/null 2>/dev/null echo ${HOME} 'quoted text'
+		printf && test echo printf | then
+"$1" grep 'quoted text' x=1 printf --verbose
+then export grep $(pwd) local grep test &&
+then grep /usr/bin then cd done /usr/bin && export printf --verbose | grep sed
+test ${HOME} /usr/bin export x=1 local readonly "$1" /usr/bin x=1 test then
+x=1 export -eu --verbose -eu && "$@" readonly cd
+cd 2>/dev/null grep cd test sed | awk --verbose $(pwd) test cd local
+		then 2>/dev/null && then export printf --verbose echo export
+	x=1 test ${HOME} /usr/bin "$1" 2>/dev/null $(pwd) printf ${HOME}
+		"$1" export --verbose --verbose printf done test readonly sed x=1
+		-eu -eu local done "$1" |
+x=1 echo $(pwd) | && echo 2>/dev/null
+| -eu 'quoted text' ${HOME} local echo --verbose "$1" done awk export
+	printf "$1" echo 'quoted text' --verbose readonly $(pwd)
+-eu 2>/dev/null then && export /usr/bin sed test test 'quoted text' "$1"
+	2>/dev/null 'quoted text' "$@" | -eu cd readonly && cd test --verbose export
+		printf export "$@" cd && x=1 export x=1 export grep echo
+		&& sed 'quoted text' sed "$1" | -eu
+x=1 -eu then -eu && 'quoted text' -eu grep $(pwd)
+export test "$1" 'quoted text' | 2>/dev/null
+	| ${HOME} export -eu sed /usr/bin done 'quoted text'
+	cd 'quoted text' && ${HOME} done test done /usr/bin x=1 readonly
+	2>/dev/null "$@" && 2>/dev/null test done
+	local "$1" ${HOME} local | --verbose
+		/usr/bin x=1 export export ${HOME} sed "$@" export "$1" cd done $(pwd)
+"$1" x=1 grep readonly "$@" 2>/dev/null export
+readonly "$1" 'quoted text' /usr/bin export /usr/bin sed 2>/dev/null export
+		then 'quoted text' "$1" -eu 2>/dev/null
+| "$@" local 'quoted text'
+sed 'quoted text' grep
+		"$1" sed export && test grep /usr/bin readonly printf sed echo grep test
+		"$@" | grep done cd -eu sed 'quoted text'
+	&& ${HOME} done grep $(pwd) 2>/dev/null "$@" "$@" cd readonly awk readonly
+	test && /usr/bin x=1 "$@" "$@" then
+awk done done done | "$1" | printf "$1" x=1 awk $(pwd) readonly readonly local
+		export && --verbose grep ${HOME} sed | sed readonly && test && -eu readonly
+&& grep sed "$1" echo /usr/bin export export then local | $(pwd) export
+		&& --verbose test && -eu printf ${HOME} readonly && 2>/dev/null "$1" |
+-eu awk "$1" x=1 cd export awk 2>/dev/null
+		awk && printf grep && readonly &&
+		awk echo awk awk -eu $(pwd) 'quoted text' readonly --verbose printf then then ${HOME}
+export echo | 'quoted text' export "$@" "$1"
+$(pwd) "$1" "$@" 2>/dev/null echo ${HOME} awk printf local -eu
+	awk "$@" then 2>/dev/null $(pwd)
+/usr/bin --verbose "$@" x=1 local 'quoted text' readonly -eu 2>/dev/null && "$1"
+		-eu cd 2>/dev/null /usr/bin export echo
+		readonly ${HOME} sed echo export then 2>/dev/null echo
+2>/dev/null | awk test ${HOME} sed cd awk &&
+		$(pwd) echo echo | && awk $(pwd) --verbose "$1" -eu readonly
+		&& | done ${HOME} test sed grep cd -eu awk
+	-eu sed export readonly test ${HOME} export cd test /usr/bin sed 'quoted text' cd
+		export sed "$1" $(pwd) x=1 ${HOME} 2>/dev/null x=1 | ${HOME} "$@" $(pwd)
+		"$@" && $(pwd) test grep export echo && readonly -eu /usr/bin export grep
+		"$@" && export readonly local | awk "$1" && echo "$@" echo -eu then
+-eu ${HOME} "$@" grep cd -eu $(pwd)
+local local local cd awk
+readonly then cd "$@" test x=1 cd --verbose test 'quoted text' $(pwd) echo
+	then sed "$1" 'quoted text' /usr/bin x=1 grep
+$(pwd) "$1" "$1" -eu export "$1" sed "$1" && --verbose echo 2>/dev/null
+	$(pwd) done sed && -eu "$1"
+| "$1" grep done "$@" cd --verbose 'quoted text' echo
+	x=1 readonly done printf "$1" printf local readonly grep $(pwd) local
+2>/dev/null echo test && echo test | 2>/dev/null
+&& x=1 x=1 printf cd printf done done "$@"
+	test test ${HOME} 2>/dev/null ${HOME}
+		-eu awk export "$1" printf awk awk /usr/bin test
+		printf $(pwd) sed printf local test | --verbose sed
+		readonly grep ${HOME} readonly | export ${HOME} export --verbose sed -eu
+		echo -eu cd local then awk cd echo 2>/dev/null "$1" sed $(pwd)
+	'quoted text' echo awk readonly
+x=1 2>/dev/null printf 'quoted text' sed
+		printf "$@" ${HOME} $(pwd) echo 2>/dev/null test readonly export
+-eu grep x=1 --verbose done x=1 test local 'quoted text' "$@" x=1
+	then done local x=1 echo
+		export sed export cd | --verbose
+	| readonly x=1 test -eu done test "$@" 'quoted text'
+-eu sed $(pwd) ${HOME} && 'quoted text' ${HOME} 'quoted text' test x=1 grep grep
+cd | echo then "$1" local --verbose "$1" readonly | 'quoted text' $(pwd)
+test sed cd awk printf grep /usr/bin done readonly ${HOME} "$@" ${HOME} /usr/bin
+	grep | | echo x=1 ${HOME} grep sed $(pwd)
+done readonly sed 'quoted text' --verbose done grep $(pwd)
+	test -eu done printf 2>/dev/null
+sed done 2>/dev/null "$@" awk "$1" export sed
+2>/dev/null readonly
+grep "$@" "$1" "$1" -eu
+grep readonly ${HOME} local local printf
+		readonly printf 2>/dev/null done echo $(pwd) export export
+	'quoted text' "$@" 2>/dev/null
+	--verbose printf "$1" $(pwd) test done cd printf ${HOME}
+"$1" printf echo "$1" then sed done
+--verbose --verbose --verbose cd done | x=1
+	"$@" $(pwd) printf then 2>/dev/null cd readonly grep -eu 'quoted text' done $(pwd)
+	sed "$@" -eu /usr/bin printf ${HOME}
+&& x=1 echo echo "$@" --verbose printf | "$@" grep local && export
+		2>/dev/null test "$@" "$1" sed test --verbose && test readonly grep | done "$1"
+then grep then then x=1 && sed sed /usr/bin
+		$(pwd) x=1 -eu local ${HOME} echo
+echo ${HOME} 2>/dev/null "$1" readonly
+x=1 cd "$1" x=1 "$@" x=1 awk "$1" && readonly test | --verbose "$1"
+	-eu "$1" sed echo export printf done 'quoted text' printf $(pwd) then grep
+printf grep | "$@" test
+-eu sed -eu 2>/dev/null x=1 sed "$1" --verbose "$1" ${HOME} "$1" cd awk printf
+		x=1 $(pwd) readonly awk --verbose
+	"$1" 2>/dev/null then local ${HOME} 2>/dev/null
+/usr/bin --verbose | ${HOME}
+	--verbose printf 2>/dev/null -eu sed $(pwd) ${HOME} 'quoted text' && --verbose
+	echo printf test export
+	x=1 x=1 && local x=1 grep readonly sed test 'quoted text'
+		'quoted text' echo awk /usr/bin | sed ${HOME} sed | "$@" cd sed /usr/bin
+	local echo "$1" readonly readonly readonly
+	cd cd x=1 "$1" x=1 echo readonly 2>/dev/null
+	2>/dev/null | printf sed "$1" x=1 /usr/bin
+	2>/dev/null then sed export
+		echo cd export --verbose
+		-eu && "$1" /usr/bin x=1 && | $(pwd) $(pwd) ${HOME} echo readonly done
+2>/dev/null && x=1 readonly "$@" printf echo readonly &&
+		awk "$@" x=1 grep readonly && -eu local "$@" then "$@" $(pwd) ${HOME} --verbose
+&& -eu && local printf grep x=1 $(pwd) 2>/dev/null
+	awk x=1 'quoted text' 'quoted text'
+	-eu "$@" $(pwd) test cd
+done done 'quoted text' | x=1 cd
+	"$1" echo then echo "$@" $(pwd)
+&& grep --verbose then /usr/bin 'quoted text' -eu --verbose printf cd awk done
+grep x=1 && "$1" readonly
+	"$1" -eu "$@" local echo 'quoted text' readonly test | then
+		"$@" 2>/dev/null export && ${HOME} printf
+		2>/dev/null "$@" && local x=1 "$@" --verbose
+| echo "$@" test readonly -eu ${HOME} local
+echo done ${HOME} "$@" "$@" /usr/bin then test "$1" "$1" --verbose awk $(pwd)
+	sed awk && local "$1" printf "$1" echo local /usr/bin
+echo done sed then $(pwd) "$1" then test x=1 x=1 --verbose
+	$(pwd) awk awk ${HOME} "$@" readonly /usr/bin done cd local awk
+		&& test ${HOME} && "$@" ${HOME} | cd grep --verbose grep readonly /usr/bin
+		sed "$1" test done sed readonly 'quoted text' then -eu | x=1 readonly
+	x=1 $(pwd) then awk 'quoted text'
+x=1 --verbose $(pwd) grep awk test x=1 'quoted text' awk then
+		sed local "$@" test test sed "$1" then
+	sed && $(pwd) echo ${HOME} "$@" printf export done echo
+	test export 2>/dev/null --verbose cd 2>/dev/null
+	/usr/bin sed | cd echo ${HOME}
+	grep export cd $(pwd) -eu readonly done export
+		$(pwd) && test printf cd sed then grep export "$@" -eu --verbose "$@" $(pwd)
+	grep then awk | readonly "$@"
+		echo local printf local
+	&& -eu awk test -eu awk "$1" && test test
+		${HOME} ${HOME} | "$1" | then x=1 | test printf then
+		then --verbose test "$1" readonly then && printf "$@"
+	-eu printf grep 'quoted text'
+| readonly $(pwd) -eu "$1"
+	printf x=1 --verbose local grep "$@" done cd sed $(pwd) -eu
+	2>/dev/null done "$1" printf 'quoted text' then ${HOME} sed test readonly x=1 done
+	| readonly sed awk 2>/dev/null -eu -eu &&
+printf export 2>/dev/null $(pwd) && sed "$1" export grep
+	"$1" | awk x=1 local | /usr/bin awk -eu export | x=1 done grep
+		test readonly | /usr/bin grep --verbose ${HOME} "$1" x=1 && echo "$@" sed 2>/dev/null
+| x=1 "$1" 'quoted text' export $(pwd) "$1" | --verbose
+		'quoted text' $(pwd) printf x=1 cd $(pwd) /usr/bin
+	test /usr/bin $(pwd) "$1" x=1 $(pwd) printf grep sed
+--verbose sed --verbose then grep then done echo "$1"
+		printf readonly local $(pwd) awk readonly
+done ${HOME} local $(pwd) "$@" readonly /usr/bin
+	"$@" local -eu -eu grep "$1"
+	/usr/bin $(pwd) then /usr/bin 2>/dev/null
+then 'quoted text' $(pwd) "$@" local test then 'quoted text'
+$(pwd) printf "$1" echo $(pwd) export --verbose /usr/bin sed $(pwd)
+	then local /usr/bin awk | --verbose 2>/dev/null grep test cd /usr/bin test
+	&& "$1" "$@" $(pwd) x=1 echo then echo test export awk done &&
+	x=1 awk readonly x=1 'quoted text' && x=1 2>/dev/null printf grep
+	/usr/bin 'quoted text' readonly test
+		--verbose "$1" cd printf awk --verbose | /usr/bin && 'quoted text' cd &&
+test 'quoted text' then sed $(pwd) --verbose | $(pwd)
+		awk 2>/dev/null awk done readonly export -eu echo export awk sed -eu test
+	sed --verbose cd 2>/dev/null echo awk done then && sed 2>/dev/null
+		&& 2>/dev/null readonly echo
+-eu | "$1" done 'quoted text' && x=1 test test sed
+		readonly echo --verbose $(pwd) 'quoted text'
+	then printf ${HOME} cd 'quoted text'
+'quoted text' $(pwd) -eu 2>/dev/null grep cd awk -eu readonly cd --verbose done
+local -eu ${HOME} $(pwd) echo $(pwd) then --verbose then &&
+		printf printf "$1" 2>/dev/null awk && grep 'quoted text'
+	grep local x=1 cd x=1 "$1" awk /usr/bin done "$@" awk | ${HOME} 'quoted text'
+| --verbose x=1 awk readonly
+then sed /usr/bin done printf echo "$@" "$@" sed echo /usr/bin printf
+		readonly "$@" && then
+--verbose 2>/dev/null
+		${HOME} -eu cd 'quoted text' printf $(pwd) test readonly
+		| "$1" -eu printf "$@" && done
+		| --verbose --verbose "$1" --verbose cd readonly /usr/bin
+	local $(pwd) sed $(pwd) done cd done "$1" awk cd printf $(pwd) test local
+		| sed readonly echo test done readonly 'quoted text'
+	test -eu sed done local sed "$@"
+		2>/dev/null echo "$@" then echo grep -eu readonly
+		readonly printf awk --verbose test | ${HOME} awk
+--verbose x=1 sed done $(pwd) ${HOME} --verbose "$1" 2>/dev/null x=1 -eu --verbose
+	sed readonly 'quoted text' "$1" 2>/dev/null
+		2>/dev/null --verbose export readonly ${HOME} -eu cd
+		readonly grep "$@" readonly && awk awk awk readonly local 'quoted text' ${HOME}
+	cd echo then $(pwd) /usr/bin "$1" 2>/dev/null "$@" printf 2>/dev/null echo echo
+done cd x=1 awk export awk done /usr/bin awk test printf /usr/bin --verbose local
+	x=1 done done awk /usr/bin
+		echo /usr/bin cd && cd 'quoted text'
+	"$1" printf echo cd done &&
+local "$@" printf && export x=1 && && $(pwd) 'quoted text' "$@" awk echo
+		sed 'quoted text' && grep | 'quoted text' -eu && cd test -eu awk &&
+	${HOME} sed test then export local export | local --verbose
+done echo "$1" local awk cd readonly
+		export "$1" echo local echo readonly x=1 echo awk test readonly -eu --verbose
+	then 'quoted text' echo readonly 'quoted text' 2>/dev/null export grep 'quoted text'
+echo ${HOME} --verbose --verbose done ${HOME} readonly grep x=1 cd readonly
+		readonly x=1 cd --verbose cd done /usr/bin "$1" x=1 readonly printf
+		--verbose /usr/bin echo /usr/bin awk awk && 'quoted text' && then test
+"$1" | "$1" readonly then then echo awk -eu done ${HOME}
+	local -eu 2>/dev/null "$1" cd $(pwd) $(pwd) cd then ${HOME} local -eu
+echo echo sed /usr/bin --verbose "$1" printf && local done /usr/bin
+	then sed echo echo then
+	export export awk && /usr/bin
+		&& sed "$1" x=1 then export done printf then
+then /usr/bin local "$@" cd 'quoted text'
+'quoted text' x=1 test grep test && printf test readonly | "$1"
+		"$@" "$1" ${HOME} printf /usr/bin "$@" -eu "$1" awk | --verbose awk cd 2>/dev/null
+	| 2>/dev/null echo -eu sed 2>/dev/null local export
+--verbose && then sed grep | sed ${HOME} printf
+		sed grep sed echo x=1 cd local done x=1 echo then "$1"
+${HOME} --verbose 'quoted text'
+	| x=1 awk $(pwd) export x=1 "$1"
+		--verbose echo $(pwd) -eu local test grep && printf x=1 local readonly 2>/dev/null
+	done ${HOME} test 2>/dev/null "$1" --verbose | --verbose
+		'quoted text' $(pwd) | then && readonly
+	-eu "$@" $(pwd) /usr/bin grep sed -eu
+readonly awk --verbose -eu "$@" grep readonly sed "$@" local -eu
+	then -eu | -eu x=1 "$@"
+		2>/dev/null done x=1 readonly -eu echo test
+		done -eu readonly $(pwd) "$@" done local readonly sed echo awk
+	awk test /usr/bin 2>/dev/null 2>/dev/null
+		sed 'quoted text' cd grep | $(pwd) export sed grep readonly grep local "$1"
+		grep then && grep test -eu readonly echo cd readonly grep 'quoted text'
+-eu "$@" --verbose -eu readonly cd "$1" 2>/dev/null --verbose
+${HOME} "$1" grep $(pwd) awk | done
+	2>/dev/null cd done -eu | -eu | /usr/bin export
+	"$1" /usr/bin /usr/bin printf readonly ${HOME} grep $(pwd) grep
+		export sed local awk 'quoted text'
+	'quoted text' printf sed readonly "$1" then x=1 --verbose
+cd awk | grep 2>/dev/null "$@" then sed test --verbose test -eu "$@" x=1
+	${HOME} then readonly x=1
+		-eu "$1" 'quoted text' x=1 "$@" echo test | "$1" ${HOME} cd readonly
+--verbose printf grep done readonly -eu sed done $(pwd) local readonly --verbose
+	x=1 grep readonly x=1 "$@" done --verbose
+	grep printf 'quoted text' test echo $(pwd) && $(pwd) cd
+awk && sed done grep grep "$1" test echo $(pwd) 'quoted text'
+then /usr/bin readonly $(pwd) echo $(pwd) cd | export 'quoted text'
+&& $(pwd) export grep x=1 2>/dev/null
+		readonly 2>/dev/null local awk ${HOME} local 2>/dev/null done cd cd --verbose
+	| export readonly sed 'quoted text' printf
+		done sed awk sed 'quoted text' printf "$@" grep && $(pwd) x=1 -eu $(pwd)
+/usr/bin x=1 2>/dev/null 2>/dev/null done sed local -eu export
+	$(pwd) test $(pwd) ${HOME} ${HOME} -eu "$1"
+		--verbose test --verbose && test "$1" sed --verbose grep /usr/bin
+printf "$1" x=1 "$@" "$1" cd sed
+2>/dev/null test && export readonly ${HOME} && --verbose
+	| test | local done grep
+-eu then done awk "$1" awk test grep "$@" --verbose done 'quoted text'
+		--verbose awk $(pwd) | "$@" then echo 2>/dev/null test cd -eu "$1" ${HOME} readonly
+		test 'quoted text' $(pwd) printf export local
+	'quoted text' /usr/bin test export "$1" printf sed 'quoted text' echo "$@"
+done readonly --verbose /usr/bin -eu x=1 "$1" cd done awk done "$1" $(pwd) cd -eu
+	&& x=1 --verbose -eu 'quoted text' export x=1 readonly cd && | grep then
+"$1" "$@" --verbose /usr/bin "$1" export ${HOME} /usr/bin "$@" | sed
+		grep "$@" | readonly /usr/bin
+		export -eu | "$1" echo readonly 2>/dev/null
+	"$1" /usr/bin -eu local -eu cd x=1 "$@" sed grep $(pwd) "$@" readonly awk
+		/usr/bin 'quoted text' readonly
+	--verbose $(pwd) cd 2>/dev/null done x=1 done readonly
+	test test -eu -eu ${HOME} /usr/bin && sed --verbose && /usr/bin "$1"
+${HOME} x=1 -eu ${HOME} "$1" $(pwd) "$1" "$1" -eu readonly
+		local "$@" /usr/bin | echo local 'quoted text' | cd 'quoted text'
+x=1 --verbose --verbose -eu 'quoted text' "$@" awk --verbose
+		&& awk awk export "$@" readonly echo
+		/usr/bin x=1 awk && test 'quoted text' readonly test
+"$1" done export -eu awk "$@" export --verbose done cd local 'quoted text'
+$(pwd) 2>/dev/null test local printf "$1" $(pwd) 2>/dev/null
+"$@" | | -eu && x=1 -eu grep readonly
+	${HOME} $(pwd) --verbose | sed done
+${HOME} $(pwd) local 2>/dev/null test readonly export x=1 'quoted text' cd &&
+		"$1" 'quoted text' $(pwd) export
+		--verbose /usr/bin printf $(pwd) export export "$@" done local
+	$(pwd) $(pwd) echo test "$1" -eu export | test readonly
+	| grep && printf 2>/dev/null sed
+	$(pwd) export local && --verbose readonly
+	2>/dev/null "$@" 'quoted text' x=1 grep test
+	export echo local test && $(pwd) 2>/dev/null
+cd && x=1 then | grep test echo | $(pwd) | grep /usr/bin
+		${HOME} $(pwd) cd echo && $(pwd) awk x=1 sed "$@" cd x=1 echo done
+	"$1" --verbose export awk 2>/dev/null echo ${HOME} "$@" sed
+/usr/bin 2>/dev/null -eu && "$@" echo -eu 'quoted text' test
+		done local echo readonly done grep
+done export readonly && ${HOME} echo readonly && awk
+done x=1 done ${HOME} local export 2>/dev/null && readonly
+grep export cd 'quoted text' readonly local echo echo --verbose x=1 done
+readonly ${HOME} then -eu "$1" 'quoted text' 'quoted text' --verbose
+		done "$1" echo export -eu grep
+		done && /usr/bin export then export export cd sed x=1 readonly 2>/dev/null
+		readonly --verbose cd echo grep local 2>/dev/null
+		test ${HOME} printf "$1" printf | sed --verbose done
+done printf /usr/bin grep 2>/dev/null local --verbose
+		grep done /usr/bin -eu | readonly cd test ${HOME}
+	then test ${HOME} | sed then then cd awk /usr/bin "$1"
+		done then local x=1 /usr/bin
+test test echo echo awk awk && then $(pwd) awk test awk echo && | --verbose
+	awk $(pwd) readonly ${HOME} grep test export grep
+	awk printf done "$@" x=1 $(pwd) done echo
+local echo | 'quoted text' -eu then export --verbose
+	readonly test echo &&
+	readonly 2>/dev/null sed
+&& "$1" -eu then done --verbose "$1" | 2>/dev/null
+	"$@" -eu | export --verbose 'quoted text'
+	test readonly "$1" x=1 --verbose
+printf echo "$1" "$1" echo
+		2>/dev/null && awk "$1" then "$@" -eu
+	| readonly "$1" readonly test x=1 done printf awk grep ${HOME} readonly 'quoted text'
+	awk grep sed $(pwd) then readonly readonly cd
+		| x=1 $(pwd) $(pwd) local "$@" x=1 "$@" then "$@" done && sed export test
+	"$1" readonly export grep printf 2>/dev/null grep local readonly printf done
+		test ${HOME} "$@" ${HOME}
+	$(pwd) && test ${HOME} "$@" readonly sed test
+awk "$@" grep 2>/dev/null && sed grep 2>/dev/null | local export cd echo
+	test 'quoted text' done /usr/bin done ${HOME}
+	echo 'quoted text' echo awk 'quoted text' x=1 grep
+		/usr/bin "$@" "$@" done "$@" -eu x=1 "$@" awk readonly ${HOME}
+	cd awk readonly /usr/bin 2>/dev/null "$1" local ${HOME} awk "$1" printf test
+		printf 'quoted text'
+"$@" x=1 "$1" test /usr/bin
+--verbose /usr/bin grep 'quoted text' test export sed awk "$@" x=1 'quoted text'
+	x=1 $(pwd) test test -eu "$@" && -eu export && 'quoted text' 'quoted text'
+	"$@" $(pwd) local printf && cd echo ${HOME}
+printf readonly --verbose local done 2>/dev/null && -eu awk
+	| printf --verbose export
+	test "$1" grep -eu test test && x=1 export
+	/usr/bin $(pwd) grep grep ${HOME}
+		done "$1" 'quoted text' "$@" printf readonly --verbose local "$1" -eu $(pwd)
+	readonly export done local /usr/bin echo export && -eu | 2>/dev/null 2>/dev/null
+"$@" "$1" $(pwd) awk sed printf export awk then cd 'quoted text'
+		"$1" && local awk "$1" "$1" -eu -eu && local | test 2>/dev/null readonly echo
+		-eu && then -eu --verbose 'quoted text' echo && done echo "$1" awk awk test
+	x=1 readonly echo $(pwd) local | awk then grep sed --verbose sed
+		grep then done "$1" readonly cd
+	-eu test readonly | printf printf export 2>/dev/null
+x=1 /usr/bin test ${HOME}
+awk && && 2>/dev/null readonly
+	x=1 local $(pwd) x=1 readonly 2>/dev/null ${HOME} | cd -eu ${HOME} 2>/dev/null
+		$(pwd) 'quoted text' x=1 --verbose 'quoted text'
+then ${HOME} && then local /usr/bin test ${HOME} |
+| test grep | | 2>/dev/null && ${HOME} then
+		${HOME} done cd export cd cd test
+		x=1 "$1" done x=1 | ${HOME} -eu readonly
+	test echo echo "$1" 2>/dev/null $(pwd) --verbose echo awk --verbose echo
+		x=1 ${HOME} --verbose test "$1" printf
+	printf local export &&
+	echo "$@" "$1" sed printf "$@" 'quoted text'
+readonly /usr/bin ${HOME}
+'quoted text' export ${HOME} && 2>/dev/null
+		printf 'quoted text' && /usr/bin then "$@" printf --verbose awk sed local -eu
+	/usr/bin /usr/bin readonly export "$@" cd readonly && printf
+		readonly 'quoted text' sed -eu printf $(pwd) grep
+		/usr/bin sed local $(pwd) | sed "$1" printf test then readonly test export
+local "$1" "$@" echo && then x=1 readonly sed sed
+awk then "$@" | readonly cd 'quoted text' /usr/bin cd
+$(pwd) $(pwd) -eu done 2>/dev/null "$1" | sed ${HOME} echo -eu export echo export
+echo "$1" -eu export "$@" test
+		done x=1 && grep test 2>/dev/null cd awk done /usr/bin
+&& done printf awk --verbose
+	${HOME} | echo 2>/dev/null --verbose
+	| /usr/bin 'quoted text'
+	export x=1 --verbose ${HOME} "$@" local "$1" $(pwd) export
+	local 'quoted text' | 'quoted text' sed done sed done 2>/dev/null grep echo done
+	-eu grep 2>/dev/null 2>/dev/null "$1"
+	printf | "$1" local cd $(pwd)
+		grep then x=1 $(pwd) -eu grep $(pwd) awk 'quoted text' echo ${HOME}
+	done grep export awk printf echo export cd readonly
+x=1 test echo cd "$1" done | readonly echo /usr/bin ${HOME} "$1" then
+echo cd --verbose local /usr/bin x=1 local readonly x=1 2>/dev/null
+		/usr/bin then && local /usr/bin "$1" && cd echo readonly
+grep x=1 'quoted text' readonly
+sed cd echo done 'quoted text'
+		awk cd && readonly done test
+		$(pwd) 2>/dev/null grep local |
+	2>/dev/null echo echo sed test awk grep done -eu "$1" -eu export sed sed ${HOME}
+		local ${HOME} --verbose -eu | printf grep readonly -eu grep
+${HOME} x=1 -eu awk && export $(pwd) 2>/dev/null &&
+readonly 'quoted text' then "$@" |
+		2>/dev/null done $(pwd) "$@" readonly cd x=1 --verbose printf test then sed 2>/dev/null
+	readonly awk done -eu grep ${HOME} $(pwd) grep
+	-eu printf sed local 2>/dev/null awk
+		/usr/bin | echo sed && readonly echo printf
+		${HOME} printf echo /usr/bin test 2>/dev/null
+grep 'quoted text' && local grep grep then /usr/bin test | 'quoted text'
+	done "$1" x=1 readonly printf -eu done export test 'quoted text' readonly
+	&& 2>/dev/null awk ${HOME} x=1 sed 'quoted text'
+"$1" /usr/bin | sed --verbose
+export /usr/bin grep then -eu --verbose /usr/bin grep test "$1" 2>/dev/null
+echo readonly x=1 $(pwd) awk /usr/bin ${HOME} ${HOME} readonly && ${HOME} x=1 2>/dev/null
+	echo grep echo | && 2>/dev/null -eu | ${HOME} printf readonly local
+	awk echo /usr/bin cd x=1 /usr/bin printf
+		printf 2>/dev/null readonly grep sed "$1" --verbose then
+grep "$1" export "$1" && export export echo test cd x=1 $(pwd) then x=1
+x=1 readonly -eu ${HOME} 2>/dev/null 2>/dev/null
+	2>/dev/null grep 2>/dev/null && x=1
+cd printf | -eu export /usr/bin
+		sed echo /usr/bin /usr/bin $(pwd)
+	&& --verbose sed sed 2>/dev/null && readonly cd awk | done x=1 echo readonly
+x=1 awk /usr/bin 'quoted text' test then readonly sed ${HOME}
+local test --verbose --verbose --verbose -eu &&
+	"$@" -eu export echo test echo readonly grep "$@" cd | echo local sed /usr/bin
+| --verbose /usr/bin echo --verbose local printf printf 'quoted text' "$1" export
+		| | test -eu readonly awk --verbose && printf readonly
+-eu grep --verbose --verbose
+		"$1" 2>/dev/null echo $(pwd) then export local
+	echo -eu local grep grep 2>/dev/null echo local "$1" sed --verbose 2>/dev/null
+	cd sed x=1 $(pwd) then 2>/dev/null done
+		readonly "$1" sed "$1" local local sed 'quoted text' "$1"
+	printf x=1 2>/dev/null echo -eu sed export local ${HOME} ${HOME} sed
+	readonly awk awk then
+		local && ${HOME} printf awk grep then --verbose test -eu done
+		-eu "$@" sed --verbose readonly cd --verbose then |
+${HOME} readonly echo test "$@" grep cd 2>/dev/null
+		test cd "$1" echo --verbose
+	then grep --verbose awk
+	echo $(pwd) printf x=1 awk
+$(pwd) local "$1" echo echo ${HOME} test local ${HOME} | done done x=1 local "$@"
+	echo printf cd local x=1 cd | export export grep printf sed "$@" local
+'quoted text' local "$@" ${HOME} printf printf cd
+--verbose local test printf "$1" | test echo
+export --verbose echo | /usr/bin echo done test awk "$1" --verbose 'quoted text'
+2>/dev/null echo $(pwd) && | /usr/bin echo then cd export --verbose /usr/bin
+	awk readonly readonly then /usr/bin x=1
+| "$@" test --verbose export 2>/dev/null $(pwd) "$1" && --verbose
+local readonly echo test local -eu 'quoted text' done
+printf awk $(pwd) then then 2>/dev/null && 2>/dev/null
+	printf 2>/dev/null test
+$(pwd) awk cd && $(pwd) sed local
+sed 2>/dev/null -eu readonly x=1 done export printf "$1" "$1"
+2>/dev/null sed "$@" "$1" printf cd ${HOME}
+	done && x=1 cd $(pwd) /usr/bin
+		x=1 sed readonly 'quoted text' 'quoted text' /usr/bin $(pwd) $(pwd) local done
+	x=1 printf cd done ${HOME} test export export then
+	| x=1 | ${HOME} && echo readonly && export
+		export && ${HOME} printf printf $(pwd)
+2>/dev/null echo 2>/dev/null
+	done $(pwd) cd test -eu "$@" | -eu x=1 sed x=1 "$@"
+	then 'quoted text' ${HOME}
+	grep "$1" echo readonly then --verbose export $(pwd) cd ${HOME}
+		echo --verbose done printf 2>/dev/null done then
+test test awk -eu echo export local -eu /usr/bin --verbose sed
+"$@" "$@" echo then x=1 $(pwd) "$@"
+--verbose --verbose cd && readonly awk then readonly "$@" && printf
+		${HOME} "$1" "$@" ${HOME} x=1 /usr/bin cd /usr/bin ${HOME}
+	grep 'quoted text' --verbose | echo 'quoted text' --verbose grep -eu ${HOME}
+"$@" && 2>/dev/null --verbose then cd local && local "$1" then $(pwd) &&
+		"$1" done sed echo | sed
+		sed --verbose ${HOME} sed
+	2>/dev/null test "$1" 2>/dev/null && -eu echo echo 2>/dev/null local --verbose
+		test ${HOME} echo export
+/usr/bin local x=1 grep grep 2>/dev/null "$@"
+readonly x=1 "$1" 'quoted text' /usr/bin sed export /usr/bin 'quoted text'
+	then echo -eu | test local "$1" awk done 'quoted text' local printf readonly
+		x=1 cd local test awk cd local "$1" echo
+		"$1" | && awk "$1" x=1 --verbose
+	"$1" then -eu local && sed --verbose grep
+		| x=1 export -eu echo 'quoted text' grep printf local local export ${HOME}
+$(pwd) ${HOME} $(pwd) awk "$@" | printf awk readonly awk sed export
+	done test $(pwd) -eu ${HOME} --verbose readonly | /usr/bin
+"$1" awk then printf "$@" sed grep echo && "$1"
+test $(pwd) x=1 sed x=1 sed done export
+grep "$@" /usr/bin done grep ${HOME} "$@" test && && "$@" done test
+	| done export && x=1 /usr/bin then "$@"
+	&& 2>/dev/null ${HOME} 2>/dev/null sed awk awk
+--verbose cd readonly 2>/dev/null
+	x=1 awk $(pwd) && test echo printf done 'quoted text' echo 2>/dev/null echo
+		export export "$@" local -eu echo export 2>/dev/null
+	echo then done ${HOME}
+		awk --verbose ${HOME} | then sed 2>/dev/null
+	&& -eu grep sed ${HOME} ${HOME} "$@" /usr/bin && ${HOME} readonly
+done awk echo --verbose sed -eu grep 2>/dev/null
+	echo x=1 && then --verbose awk "$@" && ${HOME} sed done -eu awk "$@"
+	x=1 local grep 'quoted text' "$1" echo cd test then -eu "$1" done done then |
+	grep test done grep x=1
+	'quoted text' cd /usr/bin export local /usr/bin
+-eu printf echo grep sed ${HOME} "$1" export done ${HOME}
+		'quoted text' done export
+		printf printf "$1" "$@" done then && export test "$1"
+-eu /usr/bin printf local
+'quoted text' then then && local grep export "$1" echo grep
+	${HOME} local "$1" awk printf --verbose awk then /usr/bin &&
+	cd echo export /usr/bin awk readonly ${HOME} x=1 -eu "$@" then
+		2>/dev/null export "$@" test --verbose
+		"$@" -eu "$1" ${HOME} readonly then printf local /usr/bin
+		done -eu "$1" done grep
+	export local then "$@" local local cd "$@" sed awk export 2>/dev/null
+test | "$1" echo --verbose then 2>/dev/null awk /usr/bin export local
+	x=1 test echo then grep 'quoted text'
+	x=1 2>/dev/null echo
+&& export test done grep readonly sed printf --verbose
+		printf sed echo "$@" grep $(pwd) grep test
+local readonly $(pwd) grep cd export readonly "$@" cd | $(pwd) done readonly $(pwd)
+		'quoted text' "$1" grep /usr/bin 2>/dev/null "$1" printf sed done then $(pwd)
+		| printf $(pwd) && && $(pwd) done "$@" "$1" x=1 "$@" test echo
+	2>/dev/null -eu | grep test
+$(pwd) then 2>/dev/null "$@" export readonly "$1" 2>/dev/null awk local export
+local -eu cd done $(pwd) export && x=1
+	sed 'quoted text' x=1 sed ${HOME} | then | $(pwd) 'quoted text'
+		x=1 export "$1" --verbose $(pwd) $(pwd) cd awk 'quoted text' test && export
+"$1" 'quoted text' x=1 sed /usr/bin done
+		readonly local ${HOME} done
+	readonly $(pwd) /usr/bin "$@" /usr/bin test
+		2>/dev/null | 2>/dev/null
+	grep "$1" --verbose -eu echo grep then && test echo done then |
+	readonly -eu -eu echo export
+		&& echo 'quoted text' && done
+		grep local grep done local
+sed "$@" "$1" | local --verbose | echo done ${HOME} printf
+	| readonly export readonly then ${HOME} test
+		| $(pwd) then 2>/dev/null x=1 2>/dev/null then grep printf "$@" 2>/dev/null "$@"
+test test && $(pwd) 'quoted text' ${HOME}
+		"$1" 'quoted text' echo
+		local "$@" $(pwd) readonly 2>/dev/null 'quoted text'
+2>/dev/null awk x=1 "$1" && export "$@"
+done 'quoted text' local grep readonly grep test
+		grep ${HOME} /usr/bin then "$1" 2>/dev/null awk test awk | 2>/dev/null -eu
+		| printf /usr/bin 'quoted text'
+		awk readonly sed cd "$@" printf $(pwd) $(pwd) /usr/bin "$@"
+		"$@" "$@" "$1" readonly echo "$1" grep test local ${HOME} test done --verbose
+		printf ${HOME} test echo 'quoted text'
+		&& "$@" "$@" awk readonly echo test
+		"$1" awk sed grep | "$@" cd 2>/dev/null then --verbose
+	${HOME} 'quoted text' local local 'quoted text' -eu x=1 export
+	$(pwd) "$@" grep --verbose
+	done grep then printf 2>/dev/null
+	x=1 readonly local "$1" cd
+&& sed 2>/dev/null cd --verbose | "$1" local "$1" "$1" done "$@"
+		"$@" readonly grep -eu "$1" /usr/bin export then grep awk
+		--verbose x=1 local "$@" awk sed printf cd awk
+		done /usr/bin -eu $(pwd)
+sed echo ${HOME} 2>/dev/null && "$@" --verbose $(pwd) | grep
+	cd $(pwd) x=1 -eu sed $(pwd) && test sed "$@" printf /usr/bin
+		printf 2>/dev/null grep export sed sed /usr/bin $(pwd) 2>/dev/null
+		"$1" "$1" "$@" | cd sed | done then then export "$@" "$@" -eu grep
+${HOME} test /usr/bin x=1 local --verbose export /usr/bin cd "$1"
+grep printf $(pwd) -eu 'quoted text' $(pwd)
+	test /usr/bin grep done readonly then x=1
+'quoted text' grep $(pwd) then x=1 ${HOME} 'quoted text' $(pwd) cd then
+		echo "$1" && local test "$@" "$1" local cd "$@" printf /usr/bin grep grep
+-eu /usr/bin export awk test --verbose
+| printf && local sed then -eu 'quoted text' then export ${HOME} "$1"
+'quoted text' --verbose ${HOME} export done awk | sed test export
+grep printf then printf sed test grep --verbose
+	local -eu 2>/dev/null /usr/bin | test
+		2>/dev/null sed test "$@" grep readonly && 2>/dev/null
+	&& export 2>/dev/null x=1 --verbose --verbose "$@" done test && x=1 test
+	"$@" local ${HOME} readonly --verbose -eu export 2>/dev/null awk then printf
+		&& /usr/bin done sed grep "$1" printf | then -eu test /usr/bin awk
+	export x=1 && -eu x=1 && "$1" "$1" x=1 -eu "$@" 'quoted text'
+	/usr/bin /usr/bin "$1" $(pwd) -eu "$@" 2>/dev/null /usr/bin
+		/usr/bin export grep test sed ${HOME} then printf ${HOME}
+	local then printf printf sed -eu 'quoted text' "$1" -eu --verbose -eu
+	-eu export /usr/bin sed x=1 readonly cd $(pwd) export echo echo | done then
+2>/dev/null export then ${HOME} 2>/dev/null -eu sed readonly
+	grep test local x=1 2>/dev/null readonly x=1 | 'quoted text'
+readonly 2>/dev/null test test "$1" local /usr/bin
+	/usr/bin awk local /usr/bin $(pwd) then grep done grep local sed readonly 'quoted text'
+readonly ${HOME} ${HOME} echo
+		$(pwd) 2>/dev/null export $(pwd) --verbose test | /usr/bin
+	| local readonly -eu "$1"
+		cd 2>/dev/null --verbose readonly echo ${HOME} test printf
+	local "$@" $(pwd) -eu printf then &&
+	awk x=1 -eu local && local
+		printf done echo | 'quoted text' test export then $(pwd) && --verbose sed
+| printf printf done "$@" echo --verbose echo --verbose echo
+	-eu done | local && done printf export echo done
+	${HOME} local 'quoted text'
+	${HOME} x=1 "$@" test 2>/dev/null "$@" | /usr/bin cd /usr/bin "$1" sed
+'quoted text' sed ${HOME} cd echo export echo -eu 2>/dev/null readonly readonly
+		done x=1 export x=1 "$1" local then sed export local local cd --verbose
+		cd readonly grep cd test printf printf | printf --verbose
+echo export done /usr/bin ${HOME} done done done cd then "$@" awk /usr/bin --verbose
+"$@" --verbose x=1 printf 2>/dev/null /usr/bin cd then test awk && sed export
+test | printf test "$@" -eu | readonly grep $(pwd) sed done sed test "$@"
+	&& --verbose test /usr/bin readonly grep && test readonly done local local x=1
+	$(pwd) /usr/bin --verbose awk readonly 2>/dev/null | ${HOME} --verbose local done
+		cd cd ${HOME} done cd 2>/dev/null echo local --verbose 2>/dev/null --verbose
+		export "$@" awk --verbose export | x=1 | test ${HOME}
+	sed && "$@" 'quoted text' sed awk --verbose ${HOME} test
+printf then export export echo readonly then -eu /usr/bin test printf
+local cd ${HOME} test test /usr/bin
+"$1" awk printf --verbose $(pwd) test /usr/bin local sed then ${HOME}
+		sed --verbose test local &&
+	cd $(pwd) | sed $(pwd) --verbose $(pwd) $(pwd) /usr/bin ${HOME}
+cd x=1 2>/dev/null x=1 awk export awk export --verbose
+	grep awk | cd printf local printf -eu local local &&
+		awk done | export echo test grep ${HOME}
+	x=1 local sed && | && sed --verbose printf sed then cd
+-eu grep export -eu test printf export $(pwd) "$1" $(pwd)
+printf 'quoted text' awk 2>/dev/null
+		/usr/bin /usr/bin done --verbose
+awk test && 2>/dev/null "$1" readonly ${HOME} --verbose
+export export export 'quoted text' printf "$1" export
+		local $(pwd) "$1" -eu awk echo sed
+| printf x=1 | 'quoted text' local local
+	readonly "$@" ${HOME} | $(pwd) sed x=1 awk
+	&& then --verbose ${HOME} export grep ${HOME} sed export
+	2>/dev/null awk then readonly && && cd "$@" && 'quoted text' --verbose
+	grep then printf | && grep readonly --verbose cd grep local
+		/usr/bin && 'quoted text' echo --verbose cd
+	then "$1" printf /usr/bin --verbose
+sed then printf /usr/bin awk && cd 'quoted text' 'quoted text'
+local x=1 then -eu printf sed x=1 "$@" 'quoted text' then then ${HOME}
+	local readonly cd -eu awk
+"$@" "$@" 2>/dev/null done 'quoted text' echo awk readonly readonly 'quoted text'
+	echo 2>/dev/null $(pwd) && "$1" sed awk -eu grep | printf
+	printf sed readonly "$1" printf
+	2>/dev/null -eu --verbose export awk "$@" cd then echo done ${HOME} "$1"
+	${HOME} local | -eu x=1 $(pwd) 'quoted text'
+local awk /usr/bin /usr/bin x=1 export then && then grep printf
+test local "$@" | --verbose && 2>/dev/null
+awk echo then grep 'quoted text' sed | then export "$@"
+		x=1 x=1 test then test "$1" && "$1" test
+	local local cd $(pwd) x=1 ${HOME} echo
+	${HOME} --verbose echo printf echo local grep cd x=1 -eu x=1
+	-eu /usr/bin local printf echo local test local --verbose && cd "$@" printf
+	/usr/bin export cd readonly then ${HOME}
+${HOME} ${HOME} echo export
+		echo readonly printf
+	2>/dev/null | 2>/dev/null test
+		cd grep 2>/dev/null local then grep && /usr/bin /usr/bin | cd
+		$(pwd) done done -eu $(pwd) -eu then "$1" | echo awk cd $(pwd) sed $(pwd)
+local $(pwd) "$1" then $(pwd) export sed readonly grep x=1 echo
+	local test cd $(pwd) 'quoted text' | -eu --verbose then --verbose "$1" awk
+		then awk --verbose -eu $(pwd) export "$1" /usr/bin ${HOME}
+		/usr/bin awk 2>/dev/null test /usr/bin grep -eu x=1 | | cd $(pwd)
+		cd grep $(pwd) 2>/dev/null | ${HOME} --verbose ${HOME} then grep $(pwd)
+		"$1" awk done $(pwd) grep $(pwd) grep grep "$@" local then awk
+grep 2>/dev/null ${HOME} cd awk cd test then
+		&& readonly sed $(pwd) $(pwd) | && awk 'quoted text' awk
+		echo readonly "$@" printf /usr/bin test readonly -eu done local x=1 $(pwd)
+	sed readonly export ${HOME} test ${HOME}
+$(pwd) | printf x=1 2>/dev/null --verbose
+		awk "$@" printf -eu sed then awk cd $(pwd) x=1 echo 'quoted text'
+	echo -eu done x=1 then && local /usr/bin readonly grep 'quoted text' readonly
+		"$1" readonly local done done
+		local 2>/dev/null /usr/bin "$1" $(pwd) 2>/dev/null then grep && local
+		-eu then "$1" awk 'quoted text' local
+		cd done awk | grep readonly 'quoted text' then
+		then done grep echo $(pwd) 2>/dev/null readonly echo 'quoted text'
+sed -eu && echo readonly grep | then 'quoted text'
+echo ${HOME} cd ${HOME} "$1" 'quoted text' $(pwd) local
+local $(pwd) 2>/dev/null | printf /usr/bin -eu && test export sed
+		| "$@" && x=1 then 'quoted text' 'quoted text' echo
+export x=1 grep && export test printf printf $(pwd) $(pwd)
+		echo $(pwd) sed export readonly /usr/bin && | "$1" local | echo x=1 sed $(pwd)
+	'quoted text' grep cd 'quoted text'
+		awk 'quoted text' test 'quoted text'
+--verbose awk sed echo 'quoted text' && $(pwd) 2>/dev/null 'quoted text'
+		printf 2>/dev/null local sed /usr/bin
+		export local --verbose cd export ${HOME} printf
+		grep | cd "$1" 2>/dev/null printf test awk cd printf echo
+		awk export cd then && "$1" /usr/bin --verbose ${HOME}
+	"$1" $(pwd) 2>/dev/null
+x=1 sed | -eu "$1" | $(pwd) "$@" sed
+sed sed local 'quoted text' 'quoted text' export then x=1
+		$(pwd) readonly /usr/bin /usr/bin local
+		export export echo then -eu then printf "$1" "$@" local && echo
+	echo "$@" awk printf done echo grep --verbose | --verbose echo echo
+	cd 2>/dev/null sed done readonly local "$1" echo cd done | 'quoted text'
+		| sed && x=1 printf 'quoted text' "$@" $(pwd) readonly $(pwd) cd
+cd awk export /usr/bin sed printf "$1" 2>/dev/null
+		"$1" test -eu | readonly sed -eu 'quoted text' 'quoted text' | && -eu cd ${HOME}
+sed test && test grep export $(pwd) x=1 && "$@" local export sed --verbose
+	sed readonly ${HOME} x=1 $(pwd)
+"$1" "$@" /usr/bin then 'quoted text' printf --verbose grep
+echo cd local 2>/dev/null then export x=1
+	cd done then 'quoted text' printf /usr/bin x=1
+test 2>/dev/null --verbose /usr/bin -eu "$1" $(pwd) readonly
+printf test printf test x=1 $(pwd) done export grep
+	$(pwd) local && "$@" grep $(pwd) awk local x=1
+		2>/dev/null cd x=1 local
+	2>/dev/null test echo "$@" printf 'quoted text'
+	--verbose x=1 test 'quoted text' -eu local "$@" local
+${HOME} "$1" echo 2>/dev/null then printf -eu "$@" "$1"
+	readonly -eu 2>/dev/null --verbose
+	| awk 'quoted text' printf cd local sed --verbose sed -eu awk -eu /usr/bin
+		grep 2>/dev/null done 'quoted text'
+	then --verbose awk /usr/bin sed export
+	test grep export && | done sed printf x=1 x=1 echo sed echo /usr/bin
+	sed --verbose ${HOME} -eu && readonly
+	/usr/bin "$1" then --verbose done ${HOME} /usr/bin
+	then | "$@" cd awk "$@"
+	local x=1 -eu grep printf
+	-eu /usr/bin "$@" echo export "$1" printf
+	/usr/bin $(pwd) | readonly $(pwd) cd x=1 printf $(pwd) local && && "$1"
+cd && awk printf sed sed && done awk --verbose echo then cd ${HOME} then 2>/dev/null
+	-eu awk --verbose && local x=1 | x=1 "$1"
+	cd export sed --verbose ${HOME} 'quoted text' readonly sed
+	$(pwd) done test 'quoted text'
+/usr/bin echo done done sed export sed done x=1 && "$1" x=1 ${HOME} then --verbose
+	-eu "$@" && x=1 printf export awk done
+local grep grep 2>/dev/null $(pwd) -eu local printf done /usr/bin -eu grep grep
+		awk -eu && && && "$1" && readonly sed x=1 2>/dev/null echo
+	printf ${HOME} "$@" "$1" printf --verbose readonly
+| --verbose "$@" test sed $(pwd) echo -eu local done x=1 && "$1" 'quoted text'
+		test awk -eu $(pwd) | awk --verbose "$@" ${HOME} -eu x=1 grep 'quoted text' /usr/bin
+done cd $(pwd) local 'quoted text'
+	grep 'quoted text' 2>/dev/null 'quoted text'
+	readonly && x=1 $(pwd) export
+done /usr/bin x=1 echo done && /usr/bin ${HOME} export $(pwd) test
+		'quoted text' cd "$@" $(pwd) grep |
+		sed printf "$@" echo then --verbose local
+	| "$1" ${HOME} cd done 2>/dev/null done && 'quoted text' /usr/bin -eu | 2>/dev/null
+	sed done "$@" readonly echo grep --verbose local |
+	${HOME} printf --verbose export 'quoted text' 2>/dev/null
+		"$@" ${HOME} test sed 2>/dev/null 'quoted text' | 'quoted text' awk
+awk "$1" -eu awk /usr/bin echo local awk ${HOME}
+		awk /usr/bin test cd echo && --verbose cd test cd
+	${HOME} readonly echo 'quoted text' done grep printf "$@" ${HOME}
+--verbose sed "$@" cd 2>/dev/null && grep
+2>/dev/null "$1" then | /usr/bin done ${HOME} local awk grep | cd | readonly
+	/usr/bin && -eu test 2>/dev/null local cd
+		then local /usr/bin printf "$1"
+	local local "$1" "$@" && echo "$1" 2>/dev/null
+		${HOME} 2>/dev/null local echo "$@" $(pwd)
+then sed export -eu local cd --verbose test "$@" then then | | then echo
+		-eu 'quoted text' grep 'quoted text' done 2>/dev/null
+&& cd | && --verbose x=1 sed cd | | ${HOME} grep readonly | "$1" echo 'quoted text'
+&& --verbose --verbose | && test
+	echo 2>/dev/null export 2>/dev/null
+	"$@" /usr/bin $(pwd) test ${HOME} sed printf 'quoted text'
+"$1" /usr/bin printf awk cd 2>/dev/null then cd printf
+	readonly /usr/bin echo ${HOME} echo grep export
+/usr/bin echo printf echo grep
+		-eu 2>/dev/null ${HOME} | test readonly --verbose done cd test readonly export
+		readonly sed -eu readonly
+		cd -eu export grep printf readonly 'quoted text' readonly local
+'quoted text' "$1" --verbose done 2>/dev/null 'quoted text'
+-eu ${HOME} echo 'quoted text' "$@"
+	grep 'quoted text' | "$@" "$@" sed "$@" "$@" cd test then | test /usr/bin test
+sed done done readonly | 2>/dev/null --verbose ${HOME} x=1 -eu export
+	readonly "$1" test && 'quoted text' ${HOME} test 2>/dev/null cd --verbose printf
+	'quoted text' cd local $(pwd) printf echo done | done done "$1" x=1 readonly -eu
+&& test -eu test echo "$1" then readonly "$@" sed then readonly then
+		--verbose test local "$@" then sed "$1" 2>/dev/null 2>/dev/null
+printf printf && && local "$@" /usr/bin grep 2>/dev/null
+		test echo && 'quoted text' -eu cd 'quoted text' 2>/dev/null then
+	echo then cd test 2>/dev/null "$@" ${HOME} local | echo echo 'quoted text'
+	then local printf awk 'quoted text' then &&
+		/usr/bin "$1" readonly export readonly --verbose cd
+	local cd sed && x=1 --verbose then ${HOME} "$1" ${HOME} readonly done -eu
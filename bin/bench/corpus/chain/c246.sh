@@ -0,0 +1,2001 @@
+		"$@" done --verbose then --verbose | | readonly
+"$1" export "$@" /usr/bin local local export local -eu sed echo test then --verbose
+	echo 'quoted text' | "$1" --verbose local readonly --verbose
+cd awk -eu && /usr/bin && $(pwd) done done $(pwd) "$1" 2>/dev/null ${HOME}
+	local && $(pwd) local done
+x=1 printf cd /usr/bin 'quoted text'
+"$@" readonly printf ${HOME} echo test "$@" "$1" export
+echo cd test && $(pwd) | x=1 x=1 echo "$1" export 2>/dev/null
+		x=1 --verbose x=1 x=1 && 2>/dev/null awk "$1" "$1"
+	x=1 "$@" && && --verbose "$1"
+	2>/dev/null -eu cd printf grep && test readonly grep then then cd $(pwd)
+	awk echo done test /usr/bin
+		awk "$1" | grep 2>/dev/null test $(pwd) done /usr/bin readonly
+		$(pwd) "$@" --verbose local 2>/dev/null awk sed -eu "$@" --verbose -eu awk
+"$1" test awk ${HOME} 2>/dev/null done --verbose 'quoted text' cd "$1"
+		export sed /usr/bin cd then export 'quoted text'
+		then sed done -eu | sed --verbose --verbose
+		2>/dev/null 2>/dev/null then readonly sed && grep "$1" then
+	-eu && ${HOME} test cd $(pwd) 'quoted text' cd done $(pwd) --verbose
+awk "$@" readonly awk && cd ${HOME} test x=1 done | | && /usr/bin ${HOME}
+	then -eu echo x=1 test then | readonly cd -eu then test then local --verbose
+	&& awk export cd --verbose x=1 $(pwd) done 'quoted text'
+	x=1 'quoted text' export local -eu
+	readonly -eu sed export "$@" done local then local "$@" readonly cd "$@" ${HOME}
+		awk printf && /usr/bin done $(pwd)
+		"$@" test 'quoted text' awk grep grep
+	| -eu ${HOME} | && export -eu
+| $(pwd) grep x=1 -eu 2>/dev/null x=1 cd
+		"$1" test 2>/dev/null "$1" echo readonly $(pwd) echo
+	export readonly $(pwd) -eu -eu ${HOME}
+		${HOME} "$@" --verbose export x=1 done
+	done local grep printf test
+	export "$1" done x=1 x=1
+grep x=1 then $(pwd) x=1 readonly 'quoted text' 2>/dev/null sed | | export 2>/dev/null
+"$@" -eu ${HOME} sed | done 2>/dev/null
+local "$1" test $(pwd) printf cd $(pwd) printf "$1" echo "$1"
+		then 'quoted text' test test then awk
+		${HOME} printf grep /usr/bin printf awk -eu x=1 "$@" grep done "$1"
+/usr/bin 2>/dev/null --verbose done x=1 /usr/bin
+export grep "$@" 2>/dev/null readonly $(pwd) /usr/bin
+		--verbose printf 2>/dev/null printf grep 'quoted text' ${HOME} readonly
+		-eu sed echo | 2>/dev/null echo printf $(pwd) && | test | "$1" readonly
+		"$1" then /usr/bin 2>/dev/null "$1" ${HOME} grep $(pwd) cd
+	$(pwd) /usr/bin done "$1" done --verbose -eu awk /usr/bin
+	then grep 'quoted text' "$1"
+awk awk --verbose /usr/bin test "$@" "$@" 2>/dev/null
+		'quoted text' grep test printf
+	grep -eu "$@" /usr/bin "$@" export 2>/dev/null
+grep 'quoted text' | 'quoted text' 2>/dev/null sed "$@" done export "$@"
+	'quoted text' "$@" export awk | $(pwd) -eu
+		readonly 'quoted text' 2>/dev/null ${HOME} 'quoted text' printf
+	printf $(pwd) grep ${HOME} readonly --verbose
+	awk cd "$1" x=1 ${HOME} done && | then sed
+		local local 2>/dev/null | local test then test 'quoted text' $(pwd)
+	2>/dev/null && awk sed sed test
+		x=1 "$1" cd echo && "$1" -eu cd ${HOME} 2>/dev/null then export then 2>/dev/null
+		&& -eu "$1" 'quoted text' printf then grep readonly readonly x=1 then
+	awk test $(pwd) /usr/bin grep export --verbose local test cd echo /usr/bin
+-eu grep /usr/bin export printf readonly sed -eu test awk cd export then
+	printf grep cd grep $(pwd) cd test awk printf && awk ${HOME}
+printf "$@" readonly 'quoted text' "$@" "$1" grep local done
+local $(pwd) readonly 2>/dev/null --verbose --verbose grep
+		export echo awk echo ${HOME} | printf done --verbose
+	/usr/bin echo -eu then then local "$@"
+		cd 2>/dev/null /usr/bin done 2>/dev/null -eu -eu 'quoted text'
+		-eu 2>/dev/null 2>/dev/null then "$@" export done readonly echo -eu
+"$@" echo "$@" echo | test
+	x=1 then "$@" cd local then -eu --verbose cd --verbose x=1
+readonly printf done ${HOME} ${HOME} /usr/bin
+cd export 2>/dev/null then -eu x=1 "$1" echo
+		| awk test "$1" | -eu grep ${HOME} local /usr/bin then export local
+		grep export --verbose 2>/dev/null --verbose --verbose ${HOME}
+${HOME} --verbose && test test
+	export export grep export && grep readonly x=1 echo
+	cd export done sed done cd export then
+		"$1" && readonly x=1 readonly ${HOME} readonly then echo $(pwd)
+	'quoted text' ${HOME} | --verbose $(pwd)
+		$(pwd) "$1" grep then echo
+	'quoted text' export -eu printf 2>/dev/null | $(pwd) "$@" test local /usr/bin
+		sed readonly export done -eu "$@" grep 'quoted text' --verbose 'quoted text'
+then printf "$1" "$1" 2>/dev/null readonly -eu 'quoted text' 2>/dev/null
+	2>/dev/null ${HOME} export ${HOME} then | $(pwd) "$@" then awk
+	grep echo /usr/bin 'quoted text' export "$1" $(pwd) local 'quoted text' cd ${HOME}
+		done test export grep --verbose -eu grep echo grep $(pwd) cd awk echo
+		&& /usr/bin --verbose x=1 sed grep
+		"$@" 2>/dev/null sed $(pwd) cd readonly
+then /usr/bin 2>/dev/null 'quoted text' /usr/bin x=1 export "$1" then
+	export "$@" --verbose then grep 2>/dev/null 2>/dev/null /usr/bin
+2>/dev/null 2>/dev/null && && awk cd awk local $(pwd)
+	local then $(pwd) $(pwd)
+	-eu --verbose ${HOME}
+awk --verbose /usr/bin x=1 2>/dev/null
+	--verbose ${HOME} && readonly then $(pwd) x=1 cd
+	export ${HOME} done local
+		done 2>/dev/null printf 'quoted text' 2>/dev/null then export
+-eu cd export test awk 'quoted text'
+	printf cd sed -eu then && 2>/dev/null "$1" then awk local
+		echo "$1" local done printf echo cd "$1"
+${HOME} done x=1 sed done /usr/bin --verbose sed then --verbose -eu && ${HOME}
+		cd done grep /usr/bin cd then $(pwd) grep done "$@" 2>/dev/null export
+awk grep "$1" -eu x=1 /usr/bin grep
+	${HOME} && then test ${HOME} x=1 --verbose "$1" 2>/dev/null /usr/bin
+test | --verbose cd echo 'quoted text' cd printf sed printf -eu
+	--verbose cd 2>/dev/null 'quoted text' printf --verbose
+done /usr/bin -eu $(pwd) echo /usr/bin
+	echo 2>/dev/null 2>/dev/null
+		/usr/bin printf local printf echo "$@" -eu done test
+	'quoted text' sed --verbose --verbose export x=1 $(pwd) test grep x=1
+$(pwd) --verbose test "$1" | && x=1 export echo echo
+printf done grep | echo --verbose printf done printf test x=1
+	then 2>/dev/null /usr/bin && -eu cd sed --verbose
+export readonly sed awk 'quoted text' /usr/bin
+	"$@" "$1" echo "$1" awk && echo -eu local echo readonly
+'quoted text' x=1 awk && "$1" 'quoted text' local
+		'quoted text' echo ${HOME} ${HOME}
+x=1 | "$1" -eu test export && echo printf
+"$1" printf "$1" local local
+		cd "$1" "$@" 'quoted text' | -eu sed then --verbose export
+		grep done export /usr/bin 'quoted text' printf local --verbose -eu
+$(pwd) grep ${HOME} done 'quoted text'
+		'quoted text' then sed cd /usr/bin cd printf | /usr/bin | echo local &&
+		sed 2>/dev/null grep
+	"$1" printf echo x=1 sed test local $(pwd) ${HOME} &&
+	&& done done /usr/bin local awk "$@" awk grep
+echo "$1" && 2>/dev/null then --verbose $(pwd) --verbose /usr/bin printf local
+echo test awk && then printf local printf ${HOME}
+		2>/dev/null printf printf
+	$(pwd) echo "$@" /usr/bin | done export "$@" | sed "$@" -eu cd "$@" sed ${HOME}
+	"$1" done sed done done && /usr/bin readonly local printf export local 'quoted text'
+	echo --verbose printf ${HOME} |
+		done 'quoted text' | -eu done --verbose cd export && then sed /usr/bin sed echo
+	test awk then done ${HOME} sed printf awk
+| readonly "$1" --verbose readonly --verbose 'quoted text'
+export cd readonly awk "$1" then cd
+"$@" cd cd export readonly $(pwd) grep && local printf test local
+&& test ${HOME} test echo 2>/dev/null grep /usr/bin local
+	test && | 'quoted text' export
+		test grep "$@" "$1" 2>/dev/null
+printf x=1 'quoted text' local printf echo export done | 'quoted text' --verbose
+	$(pwd) -eu --verbose "$1" "$@" echo then
+	cd ${HOME} cd | then awk test sed test test --verbose
+"$1" "$1" cd sed x=1 export --verbose readonly
+	local "$@" "$@" test test test local
+		/usr/bin ${HOME} "$1" done -eu $(pwd) --verbose test && export 2>/dev/null
+		export --verbose readonly $(pwd) "$1" "$@" && -eu
+readonly awk "$1" "$@" done test local /usr/bin then local &&
+	printf --verbose -eu done readonly ${HOME} readonly done local sed | 'quoted text'
+-eu readonly sed cd "$1" export then ${HOME} cd
+-eu grep -eu readonly awk | printf --verbose ${HOME} -eu readonly "$1" done
+--verbose readonly local export grep done -eu local "$1" "$@" done export
+		sed printf readonly echo local test x=1 /usr/bin sed $(pwd)
+		export && && && | | readonly local awk | test 2>/dev/null local grep
+	sed echo x=1 export 2>/dev/null local then x=1 'quoted text'
+&& export 'quoted text'
+readonly export && awk then 2>/dev/null ${HOME} "$@" printf ${HOME} then
+	sed --verbose echo sed test done awk "$@" "$1" | ${HOME} "$1" echo
+		local awk echo test x=1 | -eu | export awk export
+export printf then -eu "$@" grep export printf "$1" local export echo x=1
+	grep then x=1 then "$@" sed /usr/bin $(pwd) readonly printf ${HOME}
+	"$1" /usr/bin 2>/dev/null "$1" readonly
+2>/dev/null done -eu then test -eu x=1 test awk "$@" ${HOME}
+	x=1 --verbose grep | x=1 test export then $(pwd)
+	2>/dev/null sed readonly sed done x=1
+	/usr/bin x=1 local done done "$1" ${HOME} 2>/dev/null
+"$@" x=1 && grep echo ${HOME} awk awk local "$@" local then 2>/dev/null
+	awk echo export printf
+	$(pwd) | && /usr/bin ${HOME} then test -eu done /usr/bin
+		/usr/bin | "$@" export "$1" sed echo /usr/bin
+sed echo 2>/dev/null export -eu -eu $(pwd) then export then
+	'quoted text' test grep
+2>/dev/null /usr/bin cd sed --verbose ${HOME} --verbose local
+		test test echo awk x=1 --verbose x=1 2>/dev/null 'quoted text'
+| grep export ${HOME}
+	/usr/bin /usr/bin x=1 'quoted text'
+'quoted text' -eu --verbose cd && echo
+		awk echo export done readonly echo echo
+		-eu echo -eu sed && done 2>/dev/null --verbose
+&& test 2>/dev/null /usr/bin ${HOME} then test grep
+&& $(pwd) && local readonly --verbose sed 2>/dev/null
+--verbose cd 'quoted text' x=1 ${HOME} 2>/dev/null 2>/dev/null awk /usr/bin
+		| awk local /usr/bin readonly 2>/dev/null x=1
+		export --verbose export ${HOME} local grep export x=1 echo --verbose
+		| local | | sed 2>/dev/null /usr/bin && then ${HOME} readonly
+printf grep sed export -eu 2>/dev/null
+	export sed local done | "$@" printf
+	-eu | ${HOME} /usr/bin export export export /usr/bin printf
+$(pwd) ${HOME} 'quoted text' | "$1" readonly grep sed echo x=1 --verbose
+cd printf ${HOME} grep --verbose readonly echo $(pwd) done
+		awk echo -eu ${HOME} awk "$@" cd sed sed 'quoted text'
+'quoted text' export test export | "$1" && ${HOME} x=1 local cd --verbose
+$(pwd) | done local x=1 | done 2>/dev/null 2>/dev/null "$@" done "$@" done
+	"$@" $(pwd) printf ${HOME} sed
+	local "$@" cd ${HOME} $(pwd) x=1 | 'quoted text' readonly
+		$(pwd) cd /usr/bin readonly
+cd /usr/bin grep grep test echo 'quoted text' grep awk --verbose export -eu echo
+"$1" export cd done $(pwd) "$1" 2>/dev/null
+		"$@" echo -eu cd && grep 'quoted text'
+	${HOME} "$@" sed 2>/dev/null export echo &&
+	grep echo -eu -eu $(pwd)
+		-eu --verbose readonly readonly "$1"
+	then awk local echo readonly printf -eu "$1" done /usr/bin grep then 2>/dev/null
+	--verbose local -eu /usr/bin sed 'quoted text' -eu echo | awk "$1" cd then export
+		x=1 "$1" x=1 echo readonly /usr/bin echo | test "$1" "$@" sed test ${HOME} export
+	printf test x=1 x=1 sed export
+		'quoted text' done done grep
+	readonly echo cd 'quoted text'
+		local done readonly echo | printf | 2>/dev/null export printf printf awk cd
+	| local x=1 "$@" "$@" export local "$1" x=1 sed echo ${HOME} 2>/dev/null
+x=1 readonly export grep --verbose readonly export
+"$@" sed --verbose then "$1" 'quoted text' export then grep $(pwd) 2>/dev/null
+	cd local x=1 grep sed printf
+	local "$1" $(pwd) 'quoted text' awk /usr/bin awk
+-eu echo | test $(pwd) test 'quoted text' grep -eu "$1" printf local 2>/dev/null
+		awk printf x=1 echo /usr/bin then 2>/dev/null
+		"$@" echo cd "$1" "$1" export ${HOME} "$1"
+	x=1 echo echo /usr/bin export test -eu | x=1 printf &&
+cd test then grep printf && 'quoted text'
+echo awk printf echo 'quoted text'
+	grep echo printf 'quoted text' then then | | |
+		/usr/bin | test printf test x=1 'quoted text' &&
+		echo 'quoted text' --verbose
+	printf done test && "$1" /usr/bin grep | ${HOME}
+cd $(pwd) ${HOME} -eu printf then local &&
+	test ${HOME} /usr/bin export grep local ${HOME} -eu echo
+	test grep export "$1" --verbose sed export cd grep cd $(pwd) awk && sed
+		sed ${HOME} | printf && -eu sed 2>/dev/null ${HOME} grep | export awk ${HOME}
+		sed test test | 'quoted text' 'quoted text'
+	${HOME} cd ${HOME} then local echo /usr/bin
+		| "$@" done test ${HOME} awk | printf 'quoted text' | export
+	x=1 awk done $(pwd) 'quoted text' 'quoted text' readonly 2>/dev/null -eu
+	2>/dev/null && cd 2>/dev/null
+		&& | readonly awk done echo awk
+		done printf cd echo awk ${HOME} export done
+	${HOME} && x=1 test "$@" echo then test 'quoted text' | -eu
+		awk 2>/dev/null "$1" test | printf done done "$@" export awk --verbose
+	$(pwd) 2>/dev/null "$@" test -eu --verbose ${HOME} --verbose 'quoted text'
+printf awk && $(pwd) grep readonly "$1" local
+		/usr/bin then $(pwd) 2>/dev/null local x=1 && -eu | 'quoted text' &&
+		$(pwd) echo printf printf | sed readonly readonly
+then then | 'quoted text' 'quoted text'
+		readonly 2>/dev/null local
+cd --verbose cd awk | cd test ${HOME}
+	"$1" test export done /usr/bin -eu -eu test -eu 'quoted text' grep "$1" --verbose
+awk export ${HOME} ${HOME} cd grep ${HOME}
+	awk export sed cd $(pwd) /usr/bin
+		"$@" x=1 then "$1" ${HOME} local grep "$1"
+	awk "$1" then $(pwd) x=1 && echo
+awk --verbose then readonly x=1 x=1
+	/usr/bin readonly local test sed $(pwd)
+	sed x=1 grep awk -eu export "$1" printf export 2>/dev/null export
+		awk $(pwd) local awk printf "$1" then sed then readonly "$1"
+	'quoted text' test readonly &&
+readonly $(pwd) readonly grep 2>/dev/null x=1 "$1" /usr/bin awk && grep local test
+done local --verbose grep printf
+x=1 -eu /usr/bin sed x=1 sed | local /usr/bin
+	cd | $(pwd) /usr/bin x=1 grep $(pwd) --verbose "$@"
+		local /usr/bin /usr/bin |
+	| $(pwd) local -eu echo export -eu $(pwd)
+	echo 2>/dev/null --verbose echo test awk export grep readonly
+	'quoted text' export ${HOME} 2>/dev/null done x=1 printf
+	export && then && 'quoted text' /usr/bin x=1 echo "$1" then
+/usr/bin readonly grep awk printf cd local -eu
+"$@" $(pwd) done export printf x=1 export "$@" "$1"
+grep done cd printf echo -eu then test /usr/bin
+	| --verbose readonly && "$@" -eu sed | local $(pwd) -eu then sed /usr/bin
+	-eu "$@" $(pwd) test -eu $(pwd) export test
+		readonly then -eu then $(pwd) $(pwd) sed readonly && then "$@"
+${HOME} 2>/dev/null ${HOME} 2>/dev/null
+cd grep printf echo grep x=1
+		${HOME} sed done awk done readonly /usr/bin &&
+		'quoted text' test readonly local done done
+		sed x=1 local export -eu echo --verbose test $(pwd) then "$1" echo
+	/usr/bin sed export | --verbose test
+"$1" local | export | cd | export "$@" ${HOME} x=1 /usr/bin printf | "$@"
+	"$@" sed echo local -eu -eu export
+		'quoted text' $(pwd) /usr/bin echo "$@" $(pwd) local
+	cd local echo sed "$1" done --verbose --verbose echo x=1
+x=1 && done local ${HOME} -eu test 'quoted text'
+		echo $(pwd) -eu --verbose echo && && then && grep
+	2>/dev/null done export $(pwd) 'quoted text'
+	local && -eu sed $(pwd) done /usr/bin grep done sed | -eu /usr/bin
+		2>/dev/null printf 'quoted text' 2>/dev/null grep
+'quoted text' grep 2>/dev/null --verbose
+	-eu "$@" -eu ${HOME} 2>/dev/null
+		/usr/bin x=1 | 2>/dev/null cd sed ${HOME} "$@" | local
+	"$@" printf ${HOME} grep x=1 test sed
+	--verbose grep /usr/bin test export then 2>/dev/null
+		${HOME} 'quoted text' | "$@" -eu echo test
+	--verbose | x=1 "$1" ${HOME} grep "$1" printf echo --verbose ${HOME} then
+	done 'quoted text' 'quoted text' "$@" done | -eu /usr/bin && awk /usr/bin
+	--verbose "$1" readonly 2>/dev/null
+	printf "$1" --verbose cd echo 2>/dev/null && grep $(pwd)
+	--verbose "$@" 'quoted text' 2>/dev/null -eu /usr/bin "$1" sed 2>/dev/null
+	$(pwd) test local done
+cd local | cd echo local /usr/bin 2>/dev/null done -eu 'quoted text' /usr/bin
+	readonly x=1 export $(pwd) grep "$1" readonly
+"$@" "$@" 'quoted text' readonly && -eu /usr/bin
+	then export $(pwd) x=1 local x=1
+	x=1 x=1 printf test grep 2>/dev/null /usr/bin --verbose
+--verbose then ${HOME} 'quoted text' then --verbose then done "$@" sed
+	local sed && then | local /usr/bin && 2>/dev/null x=1 readonly printf "$@" -eu
+	cd /usr/bin "$@" awk grep | readonly sed printf
+		local cd x=1 test readonly
+	${HOME} --verbose then 2>/dev/null
+		awk printf sed then "$@" echo printf test 'quoted text'
+		then ${HOME} done | printf
+		| grep /usr/bin done readonly
+		2>/dev/null 'quoted text' echo awk export sed export done ${HOME}
+		local "$@" sed export "$@" sed sed done done ${HOME} | /usr/bin readonly
+	echo /usr/bin $(pwd) "$1" local 'quoted text'
+		test --verbose && cd awk local echo test 2>/dev/null
+	'quoted text' cd cd sed sed && -eu $(pwd) cd /usr/bin "$@" readonly && then
+	export test 2>/dev/null && then readonly
+		readonly "$@" "$1" local cd "$@" /usr/bin done | | /usr/bin "$@" 'quoted text'
+	'quoted text' && | export | /usr/bin "$@" export $(pwd) echo | 2>/dev/null x=1
+export 2>/dev/null x=1 awk echo readonly /usr/bin
+printf local $(pwd) x=1
+&& /usr/bin --verbose echo $(pwd) "$1" | export local 2>/dev/null
+	'quoted text' 2>/dev/null "$@" export readonly 2>/dev/null ${HOME} sed &&
+${HOME} x=1 sed /usr/bin export test test --verbose $(pwd) echo "$1"
+		| "$1" /usr/bin readonly "$1" 'quoted text'
+		then x=1 'quoted text' then local -eu "$@" grep test 2>/dev/null | cd
+	local "$1" --verbose --verbose x=1 done echo grep $(pwd)
+		"$@" "$@" && -eu "$1" 'quoted text' && $(pwd) --verbose
+		echo "$@" echo x=1 x=1 done printf then local && | "$1" && sed grep x=1 "$@" export
+	"$@" --verbose 'quoted text' readonly cd sed readonly x=1 test awk 'quoted text'
+| | 'quoted text' done readonly
+test | && && sed grep done $(pwd)
+done then "$@" -eu "$1" -eu printf local printf done readonly awk export
+		awk test ${HOME} cd sed sed echo echo && "$1" -eu then && readonly sed /usr/bin
+	test --verbose "$@" $(pwd)
+		2>/dev/null cd --verbose 'quoted text' "$1" | printf "$@"
+done /usr/bin ${HOME} test 'quoted text' && awk cd test printf "$@" "$1" ${HOME}
+		sed $(pwd) readonly 2>/dev/null export
+grep 'quoted text' --verbose $(pwd) x=1 x=1 "$1" 'quoted text' test ${HOME}
+	cd local export "$@" done then test $(pwd) export echo "$1" echo readonly $(pwd)
+	readonly x=1 awk "$@" printf | sed echo 2>/dev/null $(pwd) done x=1 local
+	awk | | && && export grep cd readonly /usr/bin
+	cd /usr/bin 'quoted text'
+2>/dev/null --verbose test sed "$1" "$1" 2>/dev/null then | ${HOME}
+	| test x=1 sed && $(pwd) grep x=1 --verbose
+		local done x=1 cd $(pwd) done done awk 'quoted text' done 2>/dev/null
+	done printf readonly 2>/dev/null
+		local --verbose done "$1" readonly cd
+		$(pwd) grep readonly awk -eu
+test local readonly 'quoted text' sed x=1 "$@" | 2>/dev/null sed --verbose
+'quoted text' export -eu sed then grep cd awk &&
+		"$@" --verbose "$@" export sed sed 'quoted text' echo /usr/bin
+$(pwd) echo --verbose sed
+	cd --verbose grep done "$1" | $(pwd) -eu test local | | | -eu awk /usr/bin test
+	grep ${HOME} x=1 ${HOME} $(pwd) awk export | readonly grep
+--verbose --verbose 'quoted text' printf
+	done readonly -eu readonly test done "$1" done "$1" test
+| sed cd sed --verbose grep
+	--verbose echo readonly
+	export /usr/bin x=1 echo x=1 test ${HOME} awk
+		'quoted text' cd test then ${HOME} "$@" --verbose sed grep readonly &&
+		| && | --verbose export "$@" export printf "$@" x=1 test ${HOME}
+	&& done ${HOME} test local echo awk echo sed 'quoted text'
+	${HOME} awk 'quoted text' grep 'quoted text' sed readonly
+export test /usr/bin 2>/dev/null done then -eu 2>/dev/null
+'quoted text' 'quoted text'
+	$(pwd) printf && 2>/dev/null export && /usr/bin "$1"
+	export | echo | echo local x=1 && | export
+2>/dev/null local /usr/bin ${HOME} export cd 2>/dev/null $(pwd)
+	done done readonly readonly --verbose | && 2>/dev/null done -eu test
+	then echo local local then
+		-eu awk test local echo /usr/bin echo readonly local test
+		readonly readonly 2>/dev/null readonly sed local grep "$1"
+echo local grep cd && awk && then awk local 'quoted text'
+		done printf 'quoted text' ${HOME} readonly readonly
+	grep | | 2>/dev/null && local grep printf then -eu echo && awk
+		awk done ${HOME} cd sed grep 2>/dev/null export /usr/bin /usr/bin 'quoted text'
+		| --verbose x=1 x=1 local && 2>/dev/null /usr/bin /usr/bin
+		2>/dev/null printf 'quoted text' "$1" x=1 echo readonly printf done --verbose
+		$(pwd) --verbose sed ${HOME} "$@" 2>/dev/null then done awk test
+		-eu awk && && ${HOME} printf done cd awk --verbose "$1" | --verbose $(pwd) --verbose
+		test cd local $(pwd) done grep "$@" --verbose cd "$@"
+		"$1" grep echo done && cd awk "$1" --verbose -eu
+		test --verbose | ${HOME} ${HOME} awk local $(pwd) grep
+		'quoted text' test echo --verbose "$1" local /usr/bin test ${HOME}
+$(pwd) export | cd "$1" readonly grep $(pwd) && && 'quoted text'
+	then && cd echo printf /usr/bin 'quoted text' x=1 export then echo $(pwd) printf
+	$(pwd) 2>/dev/null ${HOME} printf x=1 2>/dev/null 'quoted text' echo then $(pwd)
+done test | test local done --verbose 'quoted text'
+$(pwd) ${HOME} awk echo $(pwd) x=1 test readonly sed "$@" echo echo echo
+/usr/bin /usr/bin local /usr/bin ${HOME} export
+		"$1" printf "$@" x=1 $(pwd) cd x=1 local test && local |
+$(pwd) x=1 local x=1 2>/dev/null && x=1 awk readonly
+		2>/dev/null local "$1" then 2>/dev/null local -eu && ${HOME} 2>/dev/null test /usr/bin
+		then awk test -eu | 'quoted text' $(pwd) -eu /usr/bin "$1" 2>/dev/null && then
+		/usr/bin "$@" -eu | done $(pwd) test done --verbose echo x=1 export
+	/usr/bin grep sed $(pwd) "$1" done sed 2>/dev/null
+		"$@" awk then | test sed
+test | "$@" 'quoted text' --verbose /usr/bin ${HOME} $(pwd) "$1" $(pwd) -eu /usr/bin
+x=1 "$1" sed grep | x=1 then local
+		grep echo printf sed 2>/dev/null
+	grep | grep echo awk local && x=1 && x=1 && "$@" sed 'quoted text'
+local 2>/dev/null readonly sed grep /usr/bin printf
+	awk grep export --verbose "$@" export
+--verbose "$@" "$@" "$1" && echo $(pwd)
+	'quoted text' | "$@" && -eu
+		awk awk 2>/dev/null cd sed -eu
+	-eu printf && readonly -eu local
+		x=1 x=1 test grep "$1" /usr/bin sed printf
+	-eu | | /usr/bin printf x=1 | /usr/bin --verbose grep -eu readonly done local
+	"$@" local "$@" printf 2>/dev/null export test -eu done then && && $(pwd) grep
+-eu -eu "$1" awk done echo test && echo sed grep test cd "$1"
+	done test done -eu /usr/bin printf test && readonly
+		readonly grep x=1 sed ${HOME} x=1 awk local test x=1 done | sed
+		cd done --verbose grep /usr/bin "$@" ${HOME} local 'quoted text'
+		| readonly "$1" "$@" /usr/bin
+$(pwd) x=1 then cd printf 'quoted text' test cd && sed awk readonly
+--verbose /usr/bin then 'quoted text' then 2>/dev/null
+cd test x=1 $(pwd) x=1 grep && "$1" printf local export && 'quoted text'
+| readonly --verbose local -eu | awk printf grep test export
+echo then printf --verbose /usr/bin cd cd awk echo && grep local
+		| -eu test /usr/bin --verbose /usr/bin -eu export x=1 awk --verbose
+		sed 2>/dev/null done export /usr/bin then /usr/bin "$1" awk done x=1 "$@" awk export
+	| export $(pwd) 2>/dev/null
+cd && awk ${HOME} "$1" && /usr/bin done "$@" readonly cd x=1 test |
+	echo grep printf $(pwd) printf --verbose cd
+x=1 then local grep 'quoted text' $(pwd) /usr/bin --verbose ${HOME}
+cd /usr/bin 2>/dev/null "$1" --verbose done ${HOME} echo grep
+	'quoted text' echo test export printf then "$@" $(pwd) 'quoted text' cd export
+		awk then "$1" --verbose test
+	readonly 2>/dev/null done | cd cd "$1" grep grep grep cd done
+	${HOME} readonly "$1" --verbose -eu
+2>/dev/null sed /usr/bin -eu awk awk test grep ${HOME}
+--verbose 2>/dev/null /usr/bin cd printf then | 'quoted text' printf
+&& then cd then /usr/bin done $(pwd) awk
+	$(pwd) test /usr/bin x=1 -eu --verbose | local 'quoted text'
+	2>/dev/null x=1 --verbose 2>/dev/null readonly
+		done awk ${HOME} ${HOME} --verbose echo then cd awk $(pwd) --verbose
+	"$@" then 2>/dev/null awk cd --verbose | awk printf ${HOME} "$@"
+grep readonly then export && "$@" readonly ${HOME} -eu
+		$(pwd) 'quoted text' ${HOME} | $(pwd) -eu done && -eu /usr/bin
+	readonly awk echo | $(pwd) "$@" && $(pwd)
+then readonly /usr/bin /usr/bin
+		readonly $(pwd) cd && 2>/dev/null cd printf
+	printf then grep readonly --verbose --verbose x=1 | -eu -eu done export --verbose
+	| export local test ${HOME}
+		awk 2>/dev/null cd sed cd grep cd && | /usr/bin x=1 ${HOME} x=1 "$@" --verbose
+awk x=1 --verbose awk local cd then grep local grep
+		echo grep sed done "$1" awk printf $(pwd) "$@" awk "$1" | export $(pwd)
+grep x=1 --verbose echo then /usr/bin 2>/dev/null /usr/bin $(pwd)
+'quoted text' | readonly --verbose /usr/bin done sed sed --verbose local awk $(pwd)
+		echo ${HOME} then cd done "$@" -eu cd echo $(pwd) done done awk $(pwd)
+	| --verbose cd sed readonly /usr/bin x=1 echo $(pwd) ${HOME}
+		&& $(pwd) sed $(pwd) sed /usr/bin grep ${HOME} done --verbose
+	'quoted text' grep readonly --verbose readonly sed printf then x=1 local
+awk printf echo printf test
+		&& grep $(pwd) then sed
+done cd readonly 2>/dev/null awk | local
+	printf x=1 ${HOME} ${HOME} local sed local then 'quoted text'
+-eu 2>/dev/null /usr/bin 'quoted text' readonly done grep grep echo "$1"
+local "$1" export readonly x=1 ${HOME}
+		x=1 --verbose printf --verbose
+	$(pwd) readonly readonly readonly 2>/dev/null then done | printf $(pwd)
+echo 'quoted text' printf echo | printf | sed cd
+awk && $(pwd) test -eu 'quoted text' local
+	/usr/bin then "$@" ${HOME} local 'quoted text' "$@" local x=1 "$@"
+	awk cd 'quoted text' sed
+awk "$@" "$@" "$@" && then readonly test "$@" readonly sed
+	then "$@" cd printf && readonly
+	"$@" local -eu --verbose /usr/bin
+then 'quoted text' $(pwd) x=1 -eu /usr/bin printf "$@" readonly | local 'quoted text'
+	echo cd /usr/bin sed -eu && "$1" local
+		done 2>/dev/null printf echo -eu && $(pwd) echo && -eu awk sed |
+		done | grep ${HOME} 2>/dev/null
+then printf cd printf "$@" export done export then x=1 printf export
+		cd printf awk x=1 $(pwd) && export then readonly then
+	"$1" /usr/bin then -eu printf /usr/bin
+	done sed --verbose 'quoted text'
+"$@" $(pwd) export awk sed
+readonly "$1" && /usr/bin x=1 then then 2>/dev/null
+	${HOME} $(pwd) --verbose printf
+'quoted text' cd x=1 local "$1" done local echo
+&& && then readonly | ${HOME} --verbose ${HOME} readonly
+		'quoted text' x=1 x=1 awk readonly local readonly
+		--verbose && readonly grep echo export ${HOME}
+		2>/dev/null printf | done | --verbose | /usr/bin then then export export then
+| then grep --verbose sed then local /usr/bin echo -eu /usr/bin x=1
+${HOME} echo then /usr/bin | /usr/bin | test cd local export "$1" -eu | "$1"
+'quoted text' echo sed 2>/dev/null local readonly sed
+		/usr/bin printf "$1" "$1" grep "$1" | printf sed then
+		$(pwd) -eu 'quoted text' x=1 cd readonly local
+		--verbose | test then test -eu done readonly printf printf "$1" grep
+	"$@" /usr/bin test sed "$@" done | grep done && $(pwd) printf /usr/bin x=1
+		-eu cd 'quoted text' ${HOME} echo
+	done awk readonly -eu --verbose "$@" grep readonly x=1 -eu readonly
+	'quoted text' export $(pwd) sed "$@" x=1 test export --verbose | $(pwd)
+		done "$1" /usr/bin ${HOME} done echo done
+	echo printf cd -eu export then -eu /usr/bin export ${HOME} done awk printf
+		then && echo | 'quoted text' "$1" 'quoted text' awk 2>/dev/null 2>/dev/null
+	$(pwd) -eu test 2>/dev/null x=1
+then $(pwd) then $(pwd) 2>/dev/null $(pwd) done cd grep echo | then
+'quoted text' cd then echo
+		$(pwd) test then --verbose awk done cd readonly then ${HOME} export 'quoted text'
+	grep readonly local awk 2>/dev/null sed readonly printf "$@" test grep
+	'quoted text' "$1" awk -eu awk local printf "$@" cd grep 2>/dev/null
+	printf export && printf sed x=1 cd ${HOME} grep $(pwd) "$@" echo
+		x=1 cd | awk cd 'quoted text' echo $(pwd) awk
+-eu sed cd echo cd sed done echo
+	done echo local | local local then && $(pwd) ${HOME} "$1"
+		printf /usr/bin cd "$1" "$1" awk | then local
+then local -eu | --verbose sed readonly
+echo 'quoted text' printf && ${HOME} done done test printf awk | sed && --verbose
+		done awk readonly "$@" grep "$@" --verbose /usr/bin sed 'quoted text'
+x=1 grep "$@" sed test awk done /usr/bin
+		'quoted text' ${HOME} $(pwd)
+	/usr/bin --verbose 'quoted text' ${HOME} -eu --verbose sed grep done
+		awk "$@" && | 2>/dev/null -eu
+${HOME} /usr/bin awk grep $(pwd)
+	'quoted text' export then export awk echo readonly grep -eu x=1 /usr/bin
+		export /usr/bin readonly
+		printf local 2>/dev/null "$@" then | | sed /usr/bin awk done export readonly
+grep test echo done | done echo sed export sed
+	test -eu local then export --verbose echo readonly sed /usr/bin
+		cd | done cd | 2>/dev/null --verbose "$1" cd readonly awk 'quoted text'
+		x=1 'quoted text' "$@" $(pwd) 'quoted text' local -eu ${HOME}
+cd grep cd x=1 grep printf readonly $(pwd) test x=1 test | ${HOME}
+export grep local 2>/dev/null test "$@" 'quoted text' && printf
+done export grep export cd echo 'quoted text' done | cd x=1 ${HOME} -eu "$@"
+x=1 $(pwd) /usr/bin test | sed x=1 "$@" 'quoted text' "$@" local
+	2>/dev/null "$@" readonly done | -eu grep printf test sed 'quoted text' grep awk
+	export sed 'quoted text' echo cd --verbose 2>/dev/null readonly test awk local
+"$1" echo "$1" 2>/dev/null
+-eu && 2>/dev/null "$1" cd | "$1" done 'quoted text' test ${HOME}
+	printf | $(pwd) && $(pwd) awk ${HOME} then 2>/dev/null test && "$@" /usr/bin
+grep 2>/dev/null cd 2>/dev/null
+	"$@" echo -eu 'quoted text' $(pwd) 2>/dev/null local ${HOME}
+sed test | awk "$@" then $(pwd) awk
+	&& "$1" grep | ${HOME} $(pwd) "$@" printf awk sed 2>/dev/null sed readonly done
+	export -eu | sed sed cd grep done cd 'quoted text' "$@"
+		echo printf --verbose -eu readonly --verbose local "$1" 2>/dev/null then
+		${HOME} ${HOME} --verbose "$@" test && then sed --verbose
+then test then | --verbose x=1 local -eu export
+	local sed 2>/dev/null grep x=1 export cd
+		sed -eu awk x=1 test "$1"
+	sed | x=1 local export x=1 cd grep cd local readonly | && sed ${HOME} echo "$1"
+	$(pwd) $(pwd) sed x=1 -eu x=1 then 'quoted text' grep -eu grep
+&& test printf 2>/dev/null -eu done | --verbose
+	echo done 'quoted text' -eu --verbose
+&& printf readonly export sed 2>/dev/null
+		x=1 done --verbose sed "$1" grep export "$1" 2>/dev/null
+"$1" "$1" grep -eu | 'quoted text' test $(pwd)
+		-eu printf -eu x=1 then ${HOME} $(pwd) echo | 'quoted text' test sed local
+	x=1 echo export | readonly readonly echo echo then awk readonly | local done
+cd x=1 && grep $(pwd) printf local export --verbose
+$(pwd) test test grep 2>/dev/null sed cd
+	| test awk awk cd && sed export then
+		'quoted text' 'quoted text' done "$1" && -eu --verbose sed done x=1 | "$1" x=1
+export "$1" x=1 grep /usr/bin awk echo printf export awk ${HOME} cd readonly
+		x=1 "$1" "$1" 'quoted text' &&
+		export -eu printf $(pwd) -eu ${HOME} x=1 local "$@" 'quoted text'
+	echo cd export "$1" printf cd then local ${HOME}
+		local --verbose cd && "$1" --verbose then cd then --verbose
+	sed -eu "$@" | "$1" | cd 'quoted text' $(pwd) awk readonly
+	$(pwd) "$@" cd -eu export 2>/dev/null readonly --verbose --verbose | --verbose "$@"
+local ${HOME} printf cd -eu readonly
+	local | $(pwd) export local then 2>/dev/null cd
+$(pwd) printf awk -eu 'quoted text'
+	"$1" grep 2>/dev/null readonly /usr/bin /usr/bin test echo ${HOME}
+test echo cd printf | cd printf
+		--verbose export ${HOME} printf /usr/bin test x=1 grep $(pwd) x=1
+	"$1" "$@" $(pwd) && x=1 awk then cd --verbose local
+/usr/bin printf sed /usr/bin grep
+local "$@" x=1 -eu 'quoted text' --verbose awk "$1"
+sed x=1 readonly | ${HOME} $(pwd) local test grep readonly printf
+		"$@" printf printf printf $(pwd) ${HOME}
+	| "$1" --verbose "$1" local
+		done printf x=1 printf readonly $(pwd)
+test printf local readonly export
+	awk sed x=1 cd "$1" $(pwd) ${HOME} $(pwd) echo test x=1 "$1" then && --verbose
+	x=1 local x=1 printf /usr/bin awk $(pwd) -eu local /usr/bin
+		2>/dev/null readonly 2>/dev/null cd cd then
+		&& export "$1" -eu test done -eu /usr/bin
+		test sed 'quoted text' 2>/dev/null
+		readonly readonly echo $(pwd) $(pwd) -eu -eu readonly done 'quoted text' ${HOME}
+	then done export x=1 test 2>/dev/null --verbose 2>/dev/null -eu done 2>/dev/null
+	${HOME} && cd | && sed -eu awk
+"$@" grep then $(pwd) test --verbose test then then then && sed readonly
+2>/dev/null && 2>/dev/null awk 'quoted text'
+sed then && && awk "$@"
+"$1" ${HOME} --verbose sed 2>/dev/null
+x=1 printf -eu cd | $(pwd) 'quoted text' echo --verbose
+grep $(pwd) grep echo done 'quoted text' export export
+		"$1" sed export 'quoted text'
+	-eu 2>/dev/null 'quoted text' readonly && x=1 ${HOME}
+echo "$@" "$@" echo -eu printf echo 2>/dev/null
+/usr/bin "$@" test --verbose -eu
+		--verbose -eu awk sed done 'quoted text'
+local --verbose echo grep
+	| readonly export local printf | then 2>/dev/null test done echo awk grep /usr/bin
+	then ${HOME} grep readonly
+test $(pwd) done cd cd -eu
+local --verbose readonly ${HOME} then $(pwd)
+		/usr/bin cd sed sed sed x=1 awk export
+	"$@" ${HOME} done --verbose "$1" printf
+	--verbose echo 'quoted text' x=1 $(pwd) x=1 | 'quoted text' "$@" 'quoted text'
+printf && awk -eu cd "$1" test echo readonly
+x=1 'quoted text' grep 'quoted text' grep | $(pwd) grep 'quoted text'
+	2>/dev/null ${HOME} ${HOME} printf /usr/bin cd "$1" 'quoted text'
+	grep cd --verbose sed local cd /usr/bin local && "$@" cd cd && then echo readonly
+2>/dev/null readonly cd then done
+	'quoted text' awk awk 2>/dev/null && printf 'quoted text'
+	-eu 'quoted text' sed --verbose echo sed export test awk then done test awk
+	done "$1" grep && ${HOME} awk readonly 2>/dev/null export 'quoted text' done
+	sed ${HOME} --verbose "$1" "$@" -eu done local
+cd $(pwd) sed export | "$1" | grep readonly --verbose export sed
+		cd x=1 -eu | done grep /usr/bin /usr/bin ${HOME} 2>/dev/null
+		printf local then then $(pwd)
+		echo echo readonly "$@" grep done --verbose
+		awk $(pwd) -eu "$@" export "$@" then readonly
+awk ${HOME} $(pwd) /usr/bin 'quoted text' | awk 'quoted text'
+	$(pwd) readonly && done cd $(pwd)
+		"$@" 'quoted text' && && done sed printf
+	readonly then $(pwd) "$@" $(pwd)
+'quoted text' test | echo test grep
+		cd export ${HOME} cd
+		${HOME} "$@" "$@" grep
+x=1 2>/dev/null x=1 -eu /usr/bin echo ${HOME} | printf
+'quoted text' 2>/dev/null sed $(pwd)
+	$(pwd) test test then sed export ${HOME}
+	--verbose then test sed then
+export | x=1 test && local readonly -eu grep printf cd printf awk 'quoted text'
+		cd /usr/bin 2>/dev/null "$@" then -eu awk
+	awk then 2>/dev/null | $(pwd) "$@" awk /usr/bin
+		sed "$1" done 'quoted text'
+	echo awk 2>/dev/null export readonly printf
+'quoted text' local local printf && "$1" 2>/dev/null
+	$(pwd) readonly && -eu $(pwd) -eu printf /usr/bin
+	local 'quoted text' grep 'quoted text'
+printf --verbose | echo then printf /usr/bin local cd 'quoted text'
+--verbose ${HOME} sed done
+		| readonly && $(pwd) --verbose echo sed ${HOME} "$1" test | export 'quoted text'
+--verbose "$@" -eu -eu cd --verbose $(pwd) test
+		"$@" && cd && grep export 2>/dev/null grep && export
+		export printf done export awk /usr/bin sed sed
+		/usr/bin /usr/bin 2>/dev/null && grep ${HOME} grep | local x=1 2>/dev/null done
+		${HOME} | done /usr/bin 'quoted text' awk &&
+	local /usr/bin export cd done x=1 readonly /usr/bin | 2>/dev/null
+		done 2>/dev/null done test export
+"$1" ${HOME} "$@" 'quoted text' | export x=1 done local /usr/bin readonly sed
+		grep -eu 'quoted text' x=1 -eu | readonly echo "$1" /usr/bin
+	sed done ${HOME} awk cd local "$1" awk awk 2>/dev/null
+		test && local | grep ${HOME} sed
+awk awk -eu x=1 echo cd readonly done sed && then
+	2>/dev/null readonly done done /usr/bin test "$1"
+		readonly | "$1" 2>/dev/null "$1" local ${HOME} export printf "$@" test printf
+	/usr/bin ${HOME} x=1 -eu /usr/bin
+	-eu x=1 awk ${HOME} x=1 | x=1 && readonly
+		${HOME} $(pwd) done test /usr/bin then $(pwd) export export printf ${HOME}
+	sed local 'quoted text' | test
+	${HOME} done sed $(pwd) awk sed
+sed done awk cd done "$1" /usr/bin $(pwd) printf sed "$@" x=1 awk 2>/dev/null
+	--verbose test $(pwd) --verbose then local printf
+	"$1" && && "$1" test | x=1 'quoted text' /usr/bin export &&
+--verbose local -eu awk --verbose /usr/bin $(pwd) -eu ${HOME} ${HOME} 'quoted text'
+$(pwd) ${HOME} ${HOME} && "$1" readonly | && && --verbose readonly
+		cd 2>/dev/null /usr/bin "$@" "$1" then -eu ${HOME} grep export awk /usr/bin
+		2>/dev/null local cd grep -eu x=1 $(pwd) cd cd printf
+--verbose /usr/bin ${HOME} && ${HOME} "$1" export /usr/bin | "$@"
+	printf "$1" 'quoted text'
+	--verbose --verbose 'quoted text' && echo -eu export
+printf --verbose grep 'quoted text'
+	"$1" 2>/dev/null sed -eu then done "$1" | export echo readonly
+		grep | done $(pwd) cd $(pwd) cd && done | cd then awk cd sed
+		| --verbose then cd then done awk sed awk echo --verbose && ${HOME} "$1" export
+"$1" echo -eu awk 2>/dev/null $(pwd) grep 'quoted text' --verbose
+readonly printf export | printf ${HOME}
+test | ${HOME} local && local --verbose --verbose 2>/dev/null --verbose
+printf "$@" readonly grep /usr/bin x=1 2>/dev/null
+		test export /usr/bin && local $(pwd) then -eu 'quoted text' $(pwd) | local awk cd
+local x=1 echo x=1 'quoted text' 2>/dev/null sed "$@" sed then sed grep
+x=1 sed cd echo readonly && awk | ${HOME} sed 'quoted text' 'quoted text'
+'quoted text' "$1" "$@" awk "$1" ${HOME} "$1" "$1" x=1 grep x=1 printf
+		'quoted text' x=1 --verbose
+	"$@" printf cd sed export &&
+readonly ${HOME} 'quoted text' "$1"
+		"$1" ${HOME} export $(pwd) /usr/bin -eu "$1" "$@" "$1" grep 2>/dev/null -eu
+	${HOME} && "$1" sed echo done
+cd "$@" readonly x=1 | $(pwd) cd ${HOME} then /usr/bin grep awk grep printf
+	export ${HOME} /usr/bin 'quoted text' echo 'quoted text' sed "$1"
+awk export awk export ${HOME} "$1" grep "$1" sed ${HOME} echo grep echo
+2>/dev/null awk test awk 2>/dev/null "$1" cd
+		done 2>/dev/null cd echo |
+	/usr/bin /usr/bin 2>/dev/null "$@" "$1" test 2>/dev/null
+test | readonly printf x=1 | "$@" --verbose done ${HOME} cd && local
+		then /usr/bin x=1 local awk /usr/bin done 2>/dev/null
+	then sed -eu echo | | $(pwd) 2>/dev/null printf grep cd $(pwd) "$@" --verbose
+		x=1 | ${HOME} && export /usr/bin
+${HOME} grep 'quoted text'
+	printf awk local x=1 awk $(pwd) done done cd awk -eu "$@" export | echo
+	then /usr/bin export
+	test -eu --verbose && $(pwd)
+	2>/dev/null x=1 $(pwd) 2>/dev/null "$1" | "$@" test 2>/dev/null
+	'quoted text' /usr/bin && && 2>/dev/null echo 2>/dev/null echo "$1" printf $(pwd)
+-eu -eu grep export local "$@" "$@" 2>/dev/null
+		test 2>/dev/null sed readonly done $(pwd) then sed && -eu local /usr/bin
+| 2>/dev/null cd done
+		"$1" done cd "$@" 2>/dev/null --verbose
+		$(pwd) export "$@" echo grep | cd 2>/dev/null printf local sed -eu cd done sed
+	-eu ${HOME} grep done $(pwd) -eu "$1" 2>/dev/null printf "$1"
+	then printf grep -eu 2>/dev/null echo cd
+		--verbose && --verbose $(pwd) 'quoted text' 2>/dev/null grep | -eu grep
+cd $(pwd) export "$1" then cd readonly 2>/dev/null cd test awk awk x=1 $(pwd) grep
+x=1 'quoted text' --verbose awk $(pwd) --verbose --verbose cd $(pwd)
+	-eu "$@" 'quoted text' local --verbose /usr/bin cd sed sed | awk --verbose
+	echo readonly && x=1 $(pwd)
+		awk then /usr/bin && "$1" sed then | --verbose printf -eu && 'quoted text' ${HOME}
+		&& grep 'quoted text' | awk local
+		"$@" --verbose "$@" printf grep -eu x=1 grep $(pwd) readonly "$@" 2>/dev/null
+then "$@" echo /usr/bin --verbose "$1" readonly ${HOME} $(pwd)
+		readonly "$@" 'quoted text'
+grep then echo 'quoted text' --verbose echo cd done "$1" grep -eu
+		readonly local ${HOME} $(pwd) | -eu | x=1 awk echo "$1" /usr/bin x=1 /usr/bin $(pwd)
+x=1 done local local "$@" -eu sed "$1" | done echo sed
+"$1" x=1 -eu test "$@" test local grep cd 'quoted text' local echo
+		test /usr/bin "$@" --verbose
+		done then printf "$@" && -eu echo $(pwd)
+		"$@" grep grep $(pwd) /usr/bin && echo "$@" 2>/dev/null test awk
+	"$@" export test "$1" /usr/bin done && /usr/bin x=1 "$1" then /usr/bin readonly
+		readonly 2>/dev/null -eu x=1 local sed echo cd $(pwd) "$@" echo export printf readonly
+local $(pwd) "$@" && readonly sed
+		sed /usr/bin && --verbose readonly done $(pwd) ${HOME} test sed
+		x=1 && "$@" -eu /usr/bin && | --verbose /usr/bin readonly grep | awk
+/usr/bin then && ${HOME} printf readonly
+echo printf sed sed grep --verbose test 2>/dev/null local ${HOME} 'quoted text'
+then cd -eu test printf x=1 --verbose then "$1" "$1" local local /usr/bin
+		awk "$1" 'quoted text' grep then "$@" 2>/dev/null --verbose
+x=1 then $(pwd) | $(pwd) echo ${HOME} printf sed 2>/dev/null
+		| "$@" --verbose test 2>/dev/null grep 2>/dev/null echo local
+| done sed then ${HOME} grep test &&
+grep sed 2>/dev/null 2>/dev/null x=1 ${HOME} | | x=1
+	| /usr/bin done "$1" --verbose ${HOME}
+	cd | awk x=1 | awk cd echo readonly ${HOME} | x=1 grep test
+echo test printf 'quoted text' done
+		--verbose $(pwd) x=1 then 2>/dev/null test export readonly awk printf sed ${HOME}
+	echo test "$1" x=1 readonly readonly
+	sed 'quoted text' readonly readonly --verbose | "$1"
+-eu 'quoted text' sed awk export printf then "$1" |
+"$1" done export "$@" awk
+	cd $(pwd) echo done 'quoted text' $(pwd) export echo "$1" grep test
+	/usr/bin ${HOME} grep echo | /usr/bin local
+	&& printf export echo
+	&& && grep "$@" $(pwd) "$1" printf 'quoted text'
+| && 'quoted text' done x=1 echo echo sed --verbose echo
+		--verbose $(pwd) echo printf done cd
+	${HOME} test cd test sed sed x=1 | done test
+	grep 'quoted text' 'quoted text' | -eu "$@" 'quoted text' test "$1" printf
+	test ${HOME} done done &&
+"$@" done grep --verbose --verbose
+	then 2>/dev/null sed 2>/dev/null grep ${HOME} export echo sed $(pwd)
+then sed | -eu "$1" 'quoted text'
+		test --verbose readonly "$1"
+	export cd test x=1 sed x=1 "$@" export "$@" export
+/usr/bin grep x=1 ${HOME} sed -eu "$@" && test 2>/dev/null readonly --verbose
+		-eu --verbose ${HOME} $(pwd) x=1 local grep readonly
+		local /usr/bin awk -eu echo --verbose sed 2>/dev/null export x=1 local done readonly
+		/usr/bin printf x=1 "$1" grep then printf cd x=1
+2>/dev/null done /usr/bin "$1" --verbose
+sed /usr/bin then && 'quoted text' 'quoted text' "$@" printf "$1"
+		readonly x=1 printf grep then | --verbose |
+	2>/dev/null readonly cd -eu grep "$1" cd cd -eu
+${HOME} done --verbose awk 'quoted text' x=1 test x=1 x=1
+	2>/dev/null && "$@" && printf 'quoted text' /usr/bin cd grep 'quoted text'
+	2>/dev/null -eu local && x=1 local awk /usr/bin
+	test local 2>/dev/null awk x=1 local
+		then --verbose "$1" x=1 -eu /usr/bin echo 'quoted text' | local sed local
+		cd local export | 'quoted text' printf -eu local 'quoted text' printf
+	sed then done "$@" awk --verbose sed export echo 'quoted text' x=1 awk 2>/dev/null
+	/usr/bin /usr/bin --verbose readonly done cd --verbose test
+	&& echo echo && export | then test grep done | -eu /usr/bin
+	awk cd then "$@" then local x=1 | cd $(pwd) --verbose printf --verbose export
+sed -eu printf ${HOME} readonly
+		test echo "$@" --verbose awk grep "$1" cd /usr/bin "$@" awk --verbose ${HOME} readonly
+		grep 'quoted text' cd && && grep printf /usr/bin ${HOME} | test
+--verbose 'quoted text' export then readonly done sed -eu
+	grep && local sed local local && done test && 'quoted text' x=1
+		/usr/bin --verbose echo
+		awk ${HOME} echo /usr/bin | "$1" -eu cd test cd /usr/bin
+sed --verbose printf | | 2>/dev/null echo 2>/dev/null
+		readonly && ${HOME} --verbose echo 'quoted text'
+		printf printf sed "$@" $(pwd) && -eu /usr/bin
+	local "$1" $(pwd) | grep "$@" x=1 test test -eu local
+done | "$@" x=1 echo "$1" $(pwd) test | test
+	printf -eu && then cd x=1 x=1 printf grep -eu then done local 2>/dev/null
+	x=1 "$1" echo | grep grep 'quoted text' grep
+		test /usr/bin 'quoted text' 2>/dev/null export readonly awk then 2>/dev/null
+x=1 export sed local local 2>/dev/null printf echo printf
+	"$@" && readonly export | cd export echo /usr/bin && | then cd readonly
+		&& sed readonly printf | 'quoted text' ${HOME} ${HOME} "$1"
+	x=1 then | x=1 /usr/bin cd done
+	readonly echo printf /usr/bin sed test /usr/bin x=1 && -eu local
+--verbose echo --verbose sed /usr/bin printf --verbose
+		&& x=1 echo ${HOME} "$@" &&
+		2>/dev/null then export -eu cd "$@" awk x=1 local 'quoted text'
+	echo printf echo $(pwd) | printf /usr/bin | local sed test -eu ${HOME} grep &&
+		readonly && --verbose export test local readonly printf | && grep ${HOME}
+		-eu export printf x=1 | sed then grep local local 2>/dev/null
+	${HOME} readonly printf --verbose /usr/bin export /usr/bin -eu cd local
+		${HOME} | readonly --verbose --verbose /usr/bin --verbose 'quoted text'
+| "$1" done -eu then /usr/bin "$1" "$@" cd readonly printf -eu /usr/bin 'quoted text'
+2>/dev/null echo /usr/bin
+done ${HOME} test && awk echo --verbose cd "$1" ${HOME} awk sed echo awk
+	cd $(pwd) && 2>/dev/null grep local then echo --verbose readonly /usr/bin | 2>/dev/null
+readonly sed grep --verbose -eu
+		| ${HOME} $(pwd) "$@" cd done && sed "$@" readonly readonly ${HOME}
+		printf then "$1" --verbose x=1 done
+done ${HOME} done -eu echo cd readonly 'quoted text' $(pwd) awk readonly then -eu
+sed printf grep then printf awk "$1" readonly echo
+		'quoted text' /usr/bin done "$@" local 'quoted text'
+awk $(pwd) printf x=1 | echo done done export local -eu ${HOME} done awk
+$(pwd) awk local --verbose grep sed echo x=1 done awk ${HOME}
+		sed ${HOME} test && readonly awk awk test printf awk 2>/dev/null
+	$(pwd) awk local $(pwd) cd
+	| --verbose grep | "$@" /usr/bin done 'quoted text' grep x=1
+x=1 -eu grep ${HOME} grep export
+		cd done | --verbose sed "$@" 2>/dev/null
+		awk grep 2>/dev/null local done echo
+		export && cd then && sed awk echo
+grep grep then "$@" ${HOME} $(pwd)
+grep cd "$1" ${HOME}
+	awk readonly 'quoted text' $(pwd) /usr/bin --verbose 'quoted text' "$@" sed
+		--verbose export "$@" /usr/bin echo ${HOME} $(pwd)
+2>/dev/null 2>/dev/null 'quoted text' export | local
+	export 2>/dev/null cd echo readonly ${HOME} done -eu && readonly
+	x=1 sed awk /usr/bin --verbose
+awk cd && x=1 then awk printf "$@" export
+readonly ${HOME} x=1 local
+then 'quoted text' echo test printf "$@" "$@" x=1 cd && sed $(pwd) awk --verbose
+	cd x=1 /usr/bin "$@" printf sed
+		sed test $(pwd) /usr/bin 2>/dev/null | 'quoted text' test 'quoted text'
+| 2>/dev/null export --verbose readonly -eu $(pwd) && $(pwd)
+		sed ${HOME} local /usr/bin
+		x=1 $(pwd) sed then local
+	/usr/bin readonly --verbose
+| "$@" echo x=1 awk done | export 2>/dev/null ${HOME}
+	sed awk 2>/dev/null printf printf && 'quoted text' sed
+		awk && local printf | export then sed test 'quoted text' awk | 2>/dev/null
+awk ${HOME} && ${HOME} && then ${HOME}
+	awk x=1 local && local
+	$(pwd) /usr/bin printf "$1" grep
+		echo 'quoted text' -eu
+export test x=1 && && then | "$@" grep 'quoted text' && readonly test | ${HOME}
+	grep 'quoted text' sed test local -eu $(pwd) "$1" printf | done local awk -eu
+-eu cd awk cd 'quoted text' -eu export export test then ${HOME} grep
+		printf export readonly --verbose sed $(pwd)
+		test --verbose done sed $(pwd) awk test then | test ${HOME} echo
+awk ${HOME} "$@" export --verbose -eu test
+		readonly --verbose awk --verbose
+export 'quoted text' done
+		export done printf --verbose test $(pwd) | ${HOME} echo local x=1 2>/dev/null
+		2>/dev/null printf local --verbose awk test echo echo 2>/dev/null
+	--verbose grep printf "$@"
+--verbose done cd 2>/dev/null local
+		&& $(pwd) done done ${HOME} $(pwd) $(pwd) /usr/bin ${HOME} grep 'quoted text'
+	/usr/bin test 'quoted text' 'quoted text' done $(pwd) $(pwd) /usr/bin -eu
+		/usr/bin local && awk sed
+		sed cd awk "$1" echo /usr/bin test
+		grep local awk cd -eu /usr/bin printf then /usr/bin
+then cd --verbose ${HOME} 2>/dev/null export export
+		${HOME} cd sed done ${HOME} x=1 export ${HOME} "$@" --verbose cd -eu -eu test
+--verbose $(pwd) echo | awk --verbose export "$1" echo && grep 'quoted text'
+	done local printf cd awk -eu "$1" -eu
+then sed "$1" export | export grep /usr/bin
+	| | 2>/dev/null "$@" readonly /usr/bin
+		/usr/bin ${HOME} ${HOME}
+		"$1" 2>/dev/null export done
+		grep -eu && 2>/dev/null 2>/dev/null awk /usr/bin test
+-eu test readonly printf cd test cd "$@" export cd ${HOME} 2>/dev/null ${HOME}
+		readonly 2>/dev/null test | 'quoted text'
+		x=1 then x=1 x=1 readonly 'quoted text' test
+printf 2>/dev/null /usr/bin /usr/bin echo printf test then 'quoted text' 'quoted text'
+local /usr/bin printf local "$1"
+		echo export x=1 "$1" echo ${HOME} grep ${HOME} "$@" --verbose echo
+		| | printf /usr/bin "$1" export done "$1" --verbose
+		readonly printf done "$@"
+	-eu && readonly local "$1" x=1 local -eu grep "$@" export grep printf sed
+	sed -eu "$@" export "$@" /usr/bin awk cd
+"$@" cd -eu grep -eu cd echo awk "$@"
+		--verbose grep readonly | "$@" test 'quoted text' | cd 'quoted text' export done
+| -eu cd awk $(pwd) test "$@" | -eu -eu awk | readonly $(pwd) grep
+	printf 'quoted text' "$@" then | export printf readonly local local "$@"
+cd "$1" --verbose then --verbose 2>/dev/null "$@" printf
+	/usr/bin | --verbose then
+/usr/bin readonly /usr/bin awk | --verbose --verbose | $(pwd)
+		'quoted text' test readonly x=1
+${HOME} ${HOME} "$1" | grep printf $(pwd) x=1
+		printf cd printf 'quoted text' /usr/bin x=1
+	local export /usr/bin sed done -eu test && then "$1" && --verbose
+		"$@" -eu 'quoted text' export test test then ${HOME} x=1 export ${HOME} "$@"
+		"$@" local grep /usr/bin
+		cd grep sed sed done awk echo 'quoted text' -eu | local
+/usr/bin 2>/dev/null 'quoted text' "$@" --verbose then && export readonly
+	x=1 /usr/bin local 2>/dev/null local export --verbose done /usr/bin 'quoted text'
+	2>/dev/null && -eu awk --verbose
+	printf "$1" --verbose printf "$1" && x=1 && awk export cd sed ${HOME} readonly
+	${HOME} | grep | /usr/bin then x=1
+	${HOME} cd local grep then | grep readonly ${HOME} awk readonly "$@"
+	--verbose export -eu local grep ${HOME} 'quoted text' | "$1"
+	cd sed | && cd "$@" $(pwd) readonly export awk done then ${HOME} cd done
+readonly "$1" readonly && local done grep readonly export test
+	cd cd x=1 done x=1 "$1" $(pwd) done grep $(pwd)
+grep readonly 'quoted text' x=1 'quoted text'
+	"$1" printf $(pwd) echo then then 2>/dev/null 'quoted text' --verbose
+test | "$1" ${HOME} echo && local
+"$1" $(pwd) -eu --verbose --verbose
+		-eu grep echo awk | awk export -eu -eu
+		x=1 done -eu test "$@" readonly awk export test
+	'quoted text' -eu 'quoted text'
+	| -eu ${HOME} readonly echo export
+	$(pwd) 2>/dev/null /usr/bin local | awk awk printf $(pwd) then | && -eu
+-eu cd done export ${HOME} test grep "$1" "$1" readonly
+		printf then sed x=1 /usr/bin
+-eu --verbose cd /usr/bin echo /usr/bin then -eu && --verbose
+		cd ${HOME} done 2>/dev/null "$@"
+test --verbose cd local awk $(pwd)
+	'quoted text' $(pwd) ${HOME}
+		x=1 && /usr/bin awk export -eu
+sed then sed sed grep "$@" export echo readonly grep $(pwd) x=1 "$@"
+	'quoted text' cd ${HOME}
+	sed "$@" 'quoted text' ${HOME} awk done export grep awk readonly -eu local
+		awk | local test /usr/bin done local test grep sed 'quoted text' awk echo readonly
+export cd export ${HOME} readonly --verbose local $(pwd)
+'quoted text' printf test -eu 'quoted text' "$@" test done test echo grep 2>/dev/null
+	"$@" /usr/bin /usr/bin done
+		&& awk $(pwd) $(pwd) grep
+		local && && printf echo test
+/usr/bin export printf x=1
+		grep 'quoted text' readonly "$1" printf 2>/dev/null "$1" -eu --verbose echo awk
+| test done | $(pwd) cd
+		awk "$@" awk /usr/bin readonly
+	x=1 && 2>/dev/null ${HOME} | readonly "$@" then -eu ${HOME}
+		awk "$@" ${HOME} 'quoted text' sed then
+'quoted text' 2>/dev/null $(pwd)
+sed $(pwd) "$@" --verbose $(pwd) readonly "$1" readonly sed
+	"$1" "$@" "$1" | ${HOME} ${HOME}
+		grep -eu printf awk awk awk "$@" sed && readonly then /usr/bin
+		| "$1" done x=1 x=1 $(pwd) readonly /usr/bin
+	export local --verbose 'quoted text' "$1" grep "$1" done echo printf echo cd
+		"$1" /usr/bin "$@" echo /usr/bin local 2>/dev/null ${HOME} "$1" grep
+	awk $(pwd) done done "$1" printf echo done 2>/dev/null
+		printf -eu echo "$1" -eu /usr/bin cd x=1 readonly test
+"$1" local "$1" x=1 -eu ${HOME}
+-eu --verbose export done 2>/dev/null ${HOME} cd 2>/dev/null sed local
+x=1 awk then ${HOME} ${HOME}
+	&& 2>/dev/null --verbose --verbose
+readonly cd done 2>/dev/null readonly grep "$@" | local sed test local
+awk printf local x=1 then $(pwd) awk $(pwd) echo readonly --verbose
+x=1 export 2>/dev/null test sed local 'quoted text' sed test export ${HOME}
+test /usr/bin export local && |
+--verbose x=1 export awk x=1 2>/dev/null awk
+	${HOME} readonly | sed local x=1 2>/dev/null readonly grep
+	--verbose printf 'quoted text'
+$(pwd) ${HOME} export x=1 | readonly 2>/dev/null test
+		grep /usr/bin local 2>/dev/null --verbose local export -eu printf local 2>/dev/null
+		grep readonly -eu ${HOME}
+		"$@" && test test "$@" "$1" readonly
+'quoted text' && x=1 local --verbose local cd --verbose export then readonly
+		${HOME} grep -eu ${HOME} cd -eu printf && local
+	then $(pwd) | grep printf "$1" cd printf test local
+		done done then --verbose
+		-eu --verbose test 2>/dev/null
+2>/dev/null sed then printf 'quoted text' readonly -eu done echo printf done $(pwd)
+'quoted text' "$@" echo /usr/bin test "$@"
+		awk /usr/bin printf readonly ${HOME} then test echo local local local
+	printf --verbose /usr/bin grep done awk
+		2>/dev/null grep sed && export printf ${HOME} printf
+		then --verbose sed readonly awk x=1 "$@" | echo /usr/bin done awk $(pwd) printf
+	-eu -eu --verbose 2>/dev/null awk printf --verbose local --verbose awk $(pwd)
+	x=1 && --verbose 2>/dev/null -eu "$@" x=1 test sed | grep
+export cd echo ${HOME} test | "$1" | | /usr/bin --verbose sed then
+		awk local -eu done local echo readonly && readonly readonly
+		echo done echo test 'quoted text' done
+	done 2>/dev/null /usr/bin 'quoted text' then echo "$@" && "$1" $(pwd)
+readonly awk -eu 2>/dev/null 'quoted text' awk done "$1" cd --verbose test
+		echo 'quoted text' | "$@" export readonly awk echo sed cd /usr/bin
+		export -eu printf x=1 -eu test cd grep $(pwd)
+		local | then cd -eu $(pwd) ${HOME} x=1 | readonly
+		cd readonly x=1 then && local then ${HOME} local grep
+test awk "$@" then printf sed done
+	cd local cd x=1 --verbose awk -eu test $(pwd) ${HOME}
+${HOME} export test done
+awk /usr/bin grep done grep
+	then done --verbose grep cd readonly ${HOME} done export
+		readonly "$1" ${HOME} readonly cd test done
+		test test then awk printf 2>/dev/null awk | $(pwd) export
+	--verbose x=1 -eu -eu echo then 'quoted text' sed readonly -eu $(pwd) --verbose
+	| done && readonly done
+$(pwd) | echo echo cd $(pwd) cd local | sed export sed echo done awk then
+		local printf printf awk printf "$1" -eu 'quoted text' echo ${HOME} local test cd
+	| | ${HOME} "$@" | cd then printf done /usr/bin test /usr/bin 2>/dev/null
+		test && ${HOME} sed 'quoted text'
+then sed --verbose then x=1 "$1"
+		echo printf -eu | /usr/bin -eu done && grep
+		"$1" awk readonly x=1 && -eu x=1 2>/dev/null awk && ${HOME}
+then 'quoted text' "$1" 'quoted text' x=1 $(pwd) | done | test 'quoted text'
+#include c247.sh
+	x=1 --verbose done --verbose && printf 2>/dev/null export sed printf export
+	local x=1 local export $(pwd) /usr/bin sed
+		"$1" ${HOME} local sed local | then printf -eu x=1 done sed ${HOME} 'quoted text'
+		x=1 echo $(pwd) 'quoted text'
+test $(pwd) x=1 local echo /usr/bin -eu export ${HOME}
+		| "$1" readonly ${HOME} sed test ${HOME} x=1 && printf test printf then 'quoted text'
+		"$1" local readonly cd readonly printf awk
+	printf "$@" $(pwd) sed export ${HOME} then -eu /usr/bin --verbose "$@" then 2>/dev/null
+	awk "$1" "$1" cd x=1 "$1" | -eu echo | sed sed 2>/dev/null && $(pwd)
+'quoted text' local then grep | ${HOME} ${HOME}
+		| printf && test readonly -eu echo done printf grep | local ${HOME} cd && &&
+--verbose grep "$@" export then x=1 "$1" ${HOME} echo test --verbose "$1"
+	echo && "$@" echo "$@" sed sed && echo /usr/bin $(pwd) cd ${HOME} test $(pwd) "$1"
+readonly -eu then | -eu --verbose && export x=1 &&
+		-eu "$@" grep done 2>/dev/null /usr/bin -eu then local
+printf awk && cd awk cd "$@" readonly | x=1
+	--verbose cd test "$@" /usr/bin export then export --verbose grep awk 'quoted text'
+		cd --verbose echo echo 'quoted text'
+$(pwd) awk grep && x=1 --verbose
+	local export -eu --verbose 2>/dev/null
+		awk awk cd grep local && done --verbose 'quoted text'
+	grep sed --verbose cd test | 2>/dev/null printf export sed done done
+	"$1" echo -eu && echo 2>/dev/null x=1 'quoted text'
+	--verbose done --verbose
+	/usr/bin 'quoted text' printf
+		local --verbose "$1" --verbose readonly local export
+	local | /usr/bin test 'quoted text' 2>/dev/null -eu && cd cd -eu
+	"$@" local && "$@" | readonly export echo echo echo grep test
+	$(pwd) echo && "$1" ${HOME} done 2>/dev/null
+readonly printf done ${HOME} export grep --verbose "$@" awk test
+	readonly "$1" echo printf done /usr/bin $(pwd) test local readonly
+	| local echo then /usr/bin done "$@" -eu --verbose
+	printf --verbose test awk echo $(pwd) printf | awk done awk x=1 sed export
+		'quoted text' done export local /usr/bin
+x=1 done && --verbose then export $(pwd) | readonly test then printf
+cd readonly && then local grep && 'quoted text'
+		--verbose && export sed test cd awk
+		2>/dev/null cd --verbose 'quoted text' echo printf awk
+		then ${HOME} local x=1
+	echo 2>/dev/null echo "$1" cd
+		'quoted text' local awk 'quoted text' cd then printf awk 2>/dev/null
+then done x=1 && | then printf x=1 -eu printf --verbose /usr/bin -eu printf 2>/dev/null
+	$(pwd) local ${HOME} && done awk sed sed $(pwd)
+	-eu grep grep x=1 grep grep test sed printf then cd
+&& sed then "$1" awk | echo "$1" test cd awk "$1" -eu $(pwd) export | 'quoted text'
+		'quoted text' grep x=1 cd 'quoted text' test "$1"
+	$(pwd) ${HOME} 2>/dev/null $(pwd) $(pwd) /usr/bin test
+	done $(pwd) ${HOME} test
+${HOME} done export sed local "$@" test then ${HOME} && "$1" "$@" done
+	${HOME} /usr/bin sed then
+		readonly then 2>/dev/null --verbose cd awk -eu x=1 -eu x=1 2>/dev/null
+	echo then sed grep && export export awk ${HOME} /usr/bin | awk 'quoted text'
+		"$1" echo $(pwd) "$@" /usr/bin test "$1" printf readonly
+	/usr/bin -eu "$1" x=1 --verbose "$@" awk && 'quoted text'
+-eu "$1" done $(pwd) test /usr/bin local awk x=1 && echo grep
+/usr/bin 'quoted text' /usr/bin | "$@" /usr/bin /usr/bin
+		&& cd "$1" grep | "$@" export
+2>/dev/null /usr/bin -eu printf done awk 2>/dev/null printf
+		-eu "$@" 'quoted text' done
+		${HOME} awk done test echo "$@" x=1 local 'quoted text'
+	awk export echo "$1" printf 'quoted text' ${HOME} /usr/bin && && 'quoted text'
+export "$@" cd ${HOME} grep grep readonly cd local $(pwd) echo --verbose --verbose
+local ${HOME} && done done 2>/dev/null x=1 cd sed echo $(pwd) printf
+"$1" readonly /usr/bin awk && local done export 2>/dev/null
+done done -eu -eu x=1 local "$@" "$@" then ${HOME}
+		| $(pwd) grep "$@" 'quoted text'
+	then --verbose readonly done 'quoted text' then awk "$1" /usr/bin
+test $(pwd) && "$1" done done done local -eu "$1" cd grep done -eu sed
+		'quoted text' "$1" -eu x=1 grep 2>/dev/null $(pwd) "$@" 2>/dev/null
+	cd x=1 sed done 'quoted text' | printf "$@" 'quoted text' grep then 2>/dev/null
+		echo -eu x=1 -eu "$1" /usr/bin local "$1"
+"$@" export /usr/bin echo 2>/dev/null x=1 awk --verbose | "$1"
+		$(pwd) -eu /usr/bin printf /usr/bin "$@" "$@" grep readonly
+		echo sed awk | sed $(pwd) | 2>/dev/null --verbose
+		printf x=1 ${HOME} local "$@" sed awk | done 'quoted text'
+	sed $(pwd) && test 2>/dev/null awk "$1" 'quoted text'
+'quoted text' done 2>/dev/null /usr/bin export then cd local "$1" sed
+		"$@" then readonly sed test /usr/bin ${HOME} | test | awk | test echo cd
+echo && x=1 "$1" printf grep --verbose echo 'quoted text' 2>/dev/null grep
+	echo --verbose | -eu "$@" "$@" printf readonly
+		test "$1" readonly awk ${HOME} done /usr/bin "$@" export done cd $(pwd)
+		$(pwd) /usr/bin awk echo cd x=1 $(pwd) export test then grep --verbose
+		done 2>/dev/null cd && --verbose "$1"
+	/usr/bin then 'quoted text' echo $(pwd) local "$1" then local 2>/dev/null
+	| grep awk test -eu readonly ${HOME} "$1" -eu "$@"
+local sed sed -eu test sed sed printf test 2>/dev/null $(pwd) printf
+		$(pwd) export sed sed readonly sed sed local 'quoted text'
+${HOME} sed | done | grep done
+readonly -eu printf "$@" && $(pwd)
+	test cd $(pwd) "$1" local local echo x=1 printf printf done test 'quoted text'
+	2>/dev/null export --verbose cd grep export x=1 printf "$1" local done --verbose
+		2>/dev/null test export done $(pwd) echo x=1 test --verbose
+	-eu $(pwd) printf /usr/bin cd export readonly /usr/bin 2>/dev/null
+export done 'quoted text' printf $(pwd) /usr/bin printf test && printf /usr/bin
+	printf "$@" x=1 readonly grep ${HOME}
+done 'quoted text' /usr/bin local 2>/dev/null printf awk /usr/bin then awk
+grep done grep 2>/dev/null cd local --verbose
+-eu grep "$1" 2>/dev/null 2>/dev/null -eu "$1" done /usr/bin cd -eu && --verbose
+awk "$1" "$@" 'quoted text' -eu test
+		${HOME} "$1" local x=1 -eu /usr/bin then echo printf 'quoted text'
+$(pwd) sed test 'quoted text' | "$@" | ${HOME} echo
+		x=1 -eu sed --verbose 2>/dev/null -eu -eu ${HOME}
+		${HOME} 'quoted text' $(pwd) ${HOME} "$1"
+		printf cd 2>/dev/null $(pwd) -eu test 2>/dev/null
+	-eu readonly -eu test cd x=1 cd grep 2>/dev/null
+		$(pwd) "$1" printf local readonly export sed test $(pwd) ${HOME} echo test awk
+		grep ${HOME} $(pwd) --verbose "$@" 2>/dev/null awk
+grep && 2>/dev/null --verbose export export --verbose sed
+		printf cd -eu 2>/dev/null && $(pwd) readonly
+	cd done local export -eu $(pwd) -eu then awk && | ${HOME} "$1" "$@" ${HOME} /usr/bin
+	sed grep -eu test grep grep
+'quoted text' readonly then
+		| echo && printf ${HOME} | /usr/bin local /usr/bin 'quoted text'
+/usr/bin $(pwd) printf awk printf
+'quoted text' echo ${HOME} sed cd 2>/dev/null
+export grep local x=1 $(pwd) awk ${HOME} echo then -eu
+'quoted text' x=1 --verbose $(pwd) echo then
+	/usr/bin sed -eu ${HOME} -eu &&
+	"$@" "$1" $(pwd) --verbose printf awk 2>/dev/null test &&
+${HOME} /usr/bin local export 2>/dev/null printf ${HOME}
+	printf 2>/dev/null "$@" "$1" ${HOME} | printf test done printf then
+		--verbose 2>/dev/null grep printf sed x=1 export done local awk echo $(pwd)
+		'quoted text' cd echo 'quoted text' /usr/bin 'quoted text'
+		local echo x=1 echo 'quoted text' --verbose
+	/usr/bin local -eu then $(pwd) "$1" /usr/bin test local x=1 2>/dev/null
+	readonly done x=1 export 'quoted text' printf grep --verbose test export
+		then done "$@" $(pwd)
+test "$1" 'quoted text' /usr/bin x=1 then export /usr/bin x=1
+-eu awk 2>/dev/null --verbose grep test local --verbose
+	"$@" $(pwd) 2>/dev/null --verbose export readonly 'quoted text'
+'quoted text' --verbose 'quoted text' 'quoted text' local && export
+	&& printf printf local printf
+		'quoted text' ${HOME} echo test "$1" --verbose
+cd printf /usr/bin 2>/dev/null
+	x=1 test local 2>/dev/null 'quoted text' awk x=1 | grep
+		grep 'quoted text' "$@" ${HOME} done -eu x=1 then sed awk $(pwd) ${HOME}
+		-eu local ${HOME} local /usr/bin local echo
+local printf awk "$1" printf
+		$(pwd) printf 2>/dev/null x=1 -eu sed awk test && grep x=1 /usr/bin
+		cd -eu readonly grep then /usr/bin cd readonly printf printf
+	local --verbose done readonly 2>/dev/null "$@" printf "$@" &&
+		-eu cd export local printf export sed 2>/dev/null
+sed printf -eu done grep 2>/dev/null ${HOME} cd --verbose && then
+sed test echo 'quoted text' test test $(pwd) "$1" -eu 'quoted text'
+		-eu /usr/bin /usr/bin grep cd test --verbose
+		'quoted text' done test | echo echo x=1 'quoted text'
+"$@" sed && then sed 'quoted text' sed
+--verbose cd 2>/dev/null && | --verbose cd cd
+		local awk ${HOME} "$1" -eu ${HOME} export awk printf --verbose
+		/usr/bin -eu grep x=1 2>/dev/null then then
+		sed $(pwd) done "$@" "$1" cd grep x=1 "$@" cd readonly printf x=1 x=1
+		-eu -eu readonly sed echo
+"$1" ${HOME} | test | done ${HOME}
+	test echo local test grep grep --verbose ${HOME} 2>/dev/null then
+	2>/dev/null awk awk export
+	'quoted text' /usr/bin cd $(pwd)
+		then sed cd ${HOME} local ${HOME} | readonly $(pwd) && && /usr/bin
+	printf grep cd grep 'quoted text'
+	$(pwd) | --verbose | printf test
+		${HOME} 'quoted text' /usr/bin 'quoted text' 2>/dev/null echo 'quoted text'
+sed readonly "$@" echo "$@" done cd test readonly readonly
+sed 2>/dev/null done
+	export x=1 printf -eu test awk $(pwd) readonly readonly
+export "$@" $(pwd) cd readonly "$@" ${HOME} ${HOME} done grep --verbose
+	done x=1 | && local -eu ${HOME} x=1 /usr/bin
+		x=1 grep 2>/dev/null /usr/bin $(pwd) && then readonly $(pwd)
+then $(pwd) then "$@" && 2>/dev/null
+	--verbose export done && 2>/dev/null "$1" --verbose && readonly test 'quoted text'
+	"$@" echo local readonly awk grep /usr/bin printf
+	done "$@" x=1 $(pwd) | /usr/bin
+	awk --verbose grep | $(pwd)
+		--verbose done cd -eu /usr/bin export "$1" 'quoted text'
+echo export then x=1 grep "$1" test then
+2>/dev/null printf 2>/dev/null local grep --verbose done 'quoted text'
+	${HOME} -eu /usr/bin local $(pwd) x=1 printf
+echo then 'quoted text' then && /usr/bin cd 2>/dev/null --verbose sed
+/usr/bin echo -eu done x=1 done 'quoted text' x=1 -eu
+	${HOME} 'quoted text' printf done readonly awk /usr/bin "$1" echo awk 2>/dev/null
+	done sed $(pwd) && "$@" "$1" /usr/bin export 'quoted text' echo done
+then then 'quoted text' export sed test | | 'quoted text' local
+sed 'quoted text' local --verbose 2>/dev/null && --verbose test
+		printf sed /usr/bin export "$1" $(pwd) echo done local then 2>/dev/null
+${HOME} test /usr/bin then x=1 $(pwd) grep sed "$1" echo "$1" && $(pwd)
+	| echo -eu done -eu ${HOME} 'quoted text' 'quoted text' "$@"
+	"$@" done x=1 sed awk cd then ${HOME}
+	printf export x=1 test awk local local 2>/dev/null grep local done printf done
+	/usr/bin x=1 x=1 2>/dev/null -eu readonly "$@" "$@" readonly
+readonly 2>/dev/null done && |
+&& test echo 2>/dev/null $(pwd)
+		/usr/bin cd $(pwd) 2>/dev/null grep "$@" x=1 x=1 export sed -eu | && --verbose
+printf $(pwd) echo echo awk echo
+		echo $(pwd) | x=1 x=1 --verbose echo 'quoted text' | 2>/dev/null
+		readonly printf sed ${HOME} ${HOME} ${HOME} printf grep
+	x=1 then local /usr/bin "$1" awk && grep
+x=1 | test echo "$1" /usr/bin
+		sed "$1" --verbose 'quoted text' local ${HOME} done grep ${HOME}
+| ${HOME} awk local export awk sed && echo
+then "$1" -eu /usr/bin /usr/bin test printf | readonly ${HOME} && sed
+		| readonly 2>/dev/null | grep cd $(pwd) awk awk 2>/dev/null "$@" then
+then awk echo test then done awk -eu
+		awk test awk printf --verbose awk 2>/dev/null test echo awk readonly cd grep
+		&& && $(pwd) 2>/dev/null $(pwd) && && test -eu $(pwd) && 2>/dev/null
+sed sed 2>/dev/null done cd x=1 sed $(pwd) echo readonly "$@" -eu cd
+		${HOME} x=1 local "$1" "$@" /usr/bin | /usr/bin
+		&& "$@" done x=1 'quoted text' grep export sed test test && --verbose "$@" export
+${HOME} readonly done done export "$1" x=1 sed
+/usr/bin printf printf 2>/dev/null --verbose
+		&& export grep export 2>/dev/null 'quoted text' awk
+		${HOME} "$1" "$1" then 2>/dev/null
+awk test $(pwd) local | /usr/bin local awk x=1 sed "$@" sed cd
+done 2>/dev/null "$1" 'quoted text' grep | "$@"
+		test "$1" $(pwd) $(pwd) x=1 $(pwd) | readonly --verbose
+	sed grep | then test grep ${HOME} $(pwd) export then $(pwd) done sed -eu x=1 x=1
+then --verbose 2>/dev/null && echo
+		sed x=1 "$1" printf local && /usr/bin && test done $(pwd) awk "$1" then x=1
+| export ${HOME} readonly cd x=1 then 'quoted text'
+echo awk 'quoted text' done && printf awk 'quoted text' 'quoted text'
+	export echo done /usr/bin
+local grep printf 2>/dev/null -eu ${HOME} x=1 $(pwd) grep done $(pwd) then x=1 2>/dev/null
+	local done /usr/bin /usr/bin echo
+		sed /usr/bin && printf cd /usr/bin "$1" then readonly
+test $(pwd) test -eu 2>/dev/null $(pwd) $(pwd)
+&& test | $(pwd) /usr/bin sed $(pwd) $(pwd) awk 'quoted text' printf 'quoted text'
+		local | ${HOME} && --verbose sed export grep -eu 'quoted text'
+		printf && /usr/bin printf $(pwd) -eu -eu test test /usr/bin done
+	then /usr/bin "$1" /usr/bin -eu then /usr/bin done && readonly
+	test -eu "$1" 2>/dev/null /usr/bin done "$@"
+		local $(pwd) 2>/dev/null done sed "$@"
+		cd x=1 done $(pwd) cd ${HOME} export done
+	readonly readonly "$1" -eu | && printf then -eu grep 'quoted text'
+	| 2>/dev/null 2>/dev/null --verbose | awk 'quoted text' --verbose then "$@"
+-eu printf "$@" /usr/bin "$@" echo cd then
+	cd --verbose 2>/dev/null export "$@" | -eu then
+	&& grep 2>/dev/null /usr/bin awk --verbose 2>/dev/null
+	printf 'quoted text' --verbose readonly readonly
+	| | 2>/dev/null x=1 awk -eu
+sed grep local /usr/bin 'quoted text'
+sed 2>/dev/null export export readonly ${HOME} readonly ${HOME} |
+grep done -eu "$1" 2>/dev/null ${HOME} 'quoted text' "$@" "$1" done cd "$@" /usr/bin
+		echo then test "$1" | readonly ${HOME} --verbose
+		/usr/bin readonly -eu 'quoted text' echo then
+	"$@" "$1" sed readonly "$1" --verbose | 'quoted text'
+	then echo then test sed "$@" echo local echo sed |
+echo "$@" printf export sed 'quoted text'
+	done && grep sed -eu awk cd done test ${HOME} 'quoted text' 2>/dev/null cd "$@"
+		x=1 "$@" echo ${HOME} ${HOME}
+		"$1" sed "$@" && awk then
+	awk "$1" sed cd echo x=1 export ${HOME} --verbose cd "$@" awk "$1" readonly
+${HOME} echo -eu "$@" echo "$1" 2>/dev/null --verbose
+	"$1" "$1" && grep -eu "$1" -eu readonly
+x=1 export x=1 && grep local ${HOME} /usr/bin 'quoted text'
+local sed 2>/dev/null then done done "$1" "$@" | then "$@" awk then x=1 "$1" sed
+		then cd 2>/dev/null export ${HOME} grep echo readonly done awk /usr/bin echo
+	&& readonly local 'quoted text' x=1 ${HOME}
+awk then cd 'quoted text' local awk "$1" /usr/bin
+	awk local ${HOME} 'quoted text' x=1 export x=1 then "$1" "$1" 2>/dev/null /usr/bin
+cd local local /usr/bin done export /usr/bin test printf printf printf cd grep
+		sed && local "$1" cd cd "$@" ${HOME} local -eu $(pwd) cd test awk
+awk "$@" awk export readonly cd $(pwd)
+		"$1" && /usr/bin "$1" ${HOME} x=1 "$@" then "$1" printf then /usr/bin -eu x=1 printf
+local "$@" --verbose grep sed "$1" /usr/bin x=1
+		awk awk "$@" /usr/bin "$1" --verbose | then cd local done
+		-eu -eu /usr/bin $(pwd) "$@"
+export -eu ${HOME} /usr/bin x=1 /usr/bin x=1 'quoted text' export -eu "$1"
+	x=1 ${HOME} echo echo sed cd
+${HOME} /usr/bin readonly echo "$1" 'quoted text' && 'quoted text' grep 2>/dev/null
+		--verbose $(pwd) "$@" then
+		&& echo done 'quoted text' 2>/dev/null done
+done $(pwd) done 'quoted text'
+		| ${HOME} "$1" -eu cd done x=1 printf done echo awk echo local local $(pwd) test
+		grep done cd 'quoted text' then && readonly export awk ${HOME}
+		| cd echo 'quoted text' ${HOME} done "$1" done --verbose | test
+local 2>/dev/null then --verbose test
+grep 2>/dev/null export "$1" -eu test grep && then ${HOME}
+&& sed ${HOME} x=1 done -eu cd $(pwd) "$1" sed 2>/dev/null x=1 -eu /usr/bin
+$(pwd) test cd /usr/bin "$@"
+		test | readonly done cd
+	&& -eu && readonly --verbose 'quoted text'
+		printf x=1 echo local awk test -eu -eu $(pwd) printf 'quoted text'
+x=1 local /usr/bin $(pwd) cd 'quoted text' cd local
+	sed echo /usr/bin ${HOME}
+$(pwd) sed 'quoted text' "$1" readonly local printf sed
+	| | /usr/bin "$1" echo && -eu --verbose echo test done awk printf x=1
+-eu /usr/bin cd test readonly | local
+	x=1 /usr/bin readonly test test x=1 test 2>/dev/null grep export
+| export | | readonly /usr/bin
+	&& sed awk done echo -eu export 'quoted text'
+"$@" --verbose grep x=1 --verbose
+	2>/dev/null 2>/dev/null export echo
+	printf --verbose 2>/dev/null awk
+		then "$1" grep cd test printf done cd export test
+		then "$1" export "$1" ${HOME} "$@" test 2>/dev/null test "$1" 'quoted text'
+printf 'quoted text' local 'quoted text' /usr/bin | /usr/bin
+	echo grep && local then then x=1 sed "$1" sed grep
+$(pwd) ${HOME} /usr/bin readonly
+awk /usr/bin done | cd then x=1 2>/dev/null
+	"$@" then echo -eu cd local test sed 'quoted text' export
+	readonly $(pwd) /usr/bin awk printf ${HOME}
+awk done awk echo 2>/dev/null ${HOME} && cd local readonly
+-eu ${HOME} done local $(pwd) /usr/bin then readonly readonly --verbose -eu export
+	-eu --verbose 2>/dev/null
+	echo 'quoted text' printf
+	-eu -eu -eu /usr/bin $(pwd) --verbose -eu 2>/dev/null cd $(pwd) readonly
+done "$1" printf echo echo -eu && awk grep /usr/bin echo
+		export cd /usr/bin readonly grep
+		test $(pwd) 2>/dev/null x=1 2>/dev/null 2>/dev/null test then -eu test echo
+	2>/dev/null printf -eu sed /usr/bin echo cd then printf export $(pwd) sed
+	done printf sed x=1 && readonly 'quoted text' "$@" --verbose
+		"$@" "$1" grep "$1" test
+	${HOME} "$@" local | cd
+x=1 && local "$1" ${HOME} 2>/dev/null $(pwd) printf echo
+		-eu 2>/dev/null sed "$1" local ${HOME} "$@"
+	export done awk /usr/bin
+done ${HOME} test | cd
+		&& export printf cd then then "$@" cd cd export export 2>/dev/null ${HOME} readonly
+"$@" | 2>/dev/null $(pwd) ${HOME} grep
+	sed ${HOME} 2>/dev/null | && done 2>/dev/null 'quoted text' --verbose
+| echo "$@" --verbose sed x=1 awk x=1 "$1"
+		export | printf 2>/dev/null sed local readonly && readonly printf 'quoted text'
+	cd "$1" x=1 /usr/bin /usr/bin
+		printf done grep ${HOME} "$@" export ${HOME} $(pwd)
+test --verbose /usr/bin test export && export
+-eu then done 'quoted text' $(pwd) "$1" then echo cd && "$1" local test 'quoted text'
+sed --verbose /usr/bin 2>/dev/null cd done $(pwd) echo
+"$@" 2>/dev/null && cd "$@"
+	--verbose sed printf && then "$1" ${HOME} test 2>/dev/null
+/usr/bin sed -eu && test | /usr/bin -eu sed ${HOME} cd x=1 local
+	grep 'quoted text' /usr/bin -eu | $(pwd) 'quoted text' 'quoted text'
+		cd cd grep 2>/dev/null test "$@" awk then readonly
+		"$1" && grep sed /usr/bin local export local grep "$@"
+&& local readonly readonly
+	/usr/bin printf /usr/bin export then export "$@" readonly readonly
+$(pwd) grep cd x=1 export test printf | --verbose "$@" x=1 "$@" -eu printf
+grep "$@" ${HOME} 'quoted text'
+	-eu readonly done grep -eu printf
+readonly awk --verbose /usr/bin 'quoted text' "$1" then export cd test x=1 'quoted text'
+| awk test readonly awk ${HOME} echo grep $(pwd) && -eu ${HOME}
+	x=1 && $(pwd) local "$1" awk | ${HOME} local && printf
+/usr/bin export 'quoted text'
+&& test "$1" --verbose && sed "$1" $(pwd) printf && then echo cd grep
+		grep $(pwd) "$1" 2>/dev/null 'quoted text' sed ${HOME} | -eu "$1"
+	| | then --verbose then export
+-eu done | ${HOME} done then 2>/dev/null "$@" done grep sed awk done done local
+local sed x=1 'quoted text' 'quoted text' -eu "$@"
+		grep export && cd | then
+	-eu printf $(pwd) readonly "$1" grep echo -eu echo | | sed
+	/usr/bin --verbose readonly then | 'quoted text'
+		done done done 2>/dev/null awk test
+	x=1 grep && "$@" /usr/bin done test printf cd
+	'quoted text' $(pwd) 2>/dev/null
+		2>/dev/null "$@" test -eu grep --verbose test
+	2>/dev/null && done --verbose
+awk export --verbose echo done test | ${HOME}
+x=1 "$1" then grep local ${HOME}
+		cd grep grep then $(pwd) then
+		'quoted text' awk && export "$1" awk | | $(pwd)
+		echo ${HOME} readonly done "$@" x=1 then && then $(pwd) awk grep | printf -eu
+		done echo export local local cd /usr/bin readonly
+'quoted text' printf done 'quoted text' awk ${HOME} && "$@" -eu "$@"
+		echo awk /usr/bin -eu "$1" --verbose sed -eu cd cd && done 2>/dev/null awk /usr/bin
+		&& --verbose sed "$1" | test export "$@" awk printf echo -eu
+	readonly --verbose $(pwd) grep done test && | 2>/dev/null
+		&& grep -eu sed done ${HOME} 'quoted text'
+		-eu then ${HOME} cd local local local /usr/bin $(pwd) && readonly "$1" test
+		2>/dev/null test && /usr/bin
+	/usr/bin | printf export export
+	| cd -eu printf export $(pwd) then
+		readonly && echo 'quoted text' "$1" then 2>/dev/null
+printf done | printf | x=1 2>/dev/null awk cd 2>/dev/null $(pwd) --verbose
+awk printf 'quoted text' 2>/dev/null
+${HOME} readonly cd ${HOME} readonly grep test then awk 2>/dev/null "$1"
+		echo "$1" -eu test "$@" cd done awk -eu $(pwd) echo printf "$@" 2>/dev/null
+		echo 2>/dev/null $(pwd)
+		local 'quoted text' -eu export grep readonly ${HOME} printf
+grep cd "$1" done test local then grep test local | local "$1" "$@" $(pwd) test
+grep "$@" && /usr/bin cd ${HOME} then local | --verbose sed
+	sed sed -eu local local local "$@" ${HOME} local x=1 local export 'quoted text'
+		"$@" "$@" sed done /usr/bin "$@" x=1
+	done readonly grep then
+	"$1" 2>/dev/null | then done
+		/usr/bin then "$1" | "$@" grep export $(pwd)
+	&& -eu $(pwd) | $(pwd) "$@" "$@" awk awk local
+	then -eu /usr/bin x=1 ${HOME} $(pwd) echo printf 'quoted text'
+		| echo test "$1" "$1" 2>/dev/null printf then
+${HOME} readonly local then && cd awk printf sed printf "$@"
+		sed --verbose then then sed && printf
+		cd 'quoted text' -eu && $(pwd) awk done export then 'quoted text' then then
+	sed && 'quoted text' 2>/dev/null printf 2>/dev/null /usr/bin echo done x=1
+	/usr/bin 2>/dev/null readonly local then
+		--verbose done test test -eu
+	| -eu printf echo ${HOME} done grep 'quoted text'
+2>/dev/null local 'quoted text' $(pwd) --verbose cd done
+$(pwd) /usr/bin echo $(pwd) $(pwd) then
+	2>/dev/null /usr/bin done x=1 printf awk |
+/usr/bin | /usr/bin printf
+	awk cd echo printf awk readonly
+$(pwd) then | ${HOME} then then
+	printf $(pwd) /usr/bin --verbose then --verbose sed ${HOME} 2>/dev/null
+done export $(pwd) --verbose && export 2>/dev/null &&
+	${HOME} then awk --verbose
+	| export "$@" awk /usr/bin $(pwd) printf "$1" readonly "$@" awk
+		2>/dev/null awk done x=1 "$@" x=1 awk readonly x=1 printf sed cd export
+	x=1 /usr/bin export | readonly
+	2>/dev/null awk | export echo grep echo
+2>/dev/null 2>/dev/null awk $(pwd) test x=1 readonly | sed sed cd x=1 printf
+		sed local && ${HOME} -eu && | grep sed -eu /usr/bin
+	&& export -eu cd sed ${HOME} && then 'quoted text'
+$(pwd) && && test 'quoted text' "$1" "$1"
+		local printf then echo sed local
+	| | "$1" export printf
+	| awk -eu cd done cd 'quoted text' x=1 --verbose
+&& | "$1" --verbose -eu && test done -eu ${HOME} echo ${HOME} && -eu $(pwd)
+		'quoted text' --verbose then && && echo /usr/bin 2>/dev/null 'quoted text' |
+readonly | test --verbose --verbose done done export
+then sed grep done && readonly x=1
+-eu 2>/dev/null -eu ${HOME}
+	cd echo local awk awk
+/usr/bin --verbose sed awk && grep grep 'quoted text' done export --verbose
+		echo test readonly sed
+-eu echo "$@" $(pwd) echo
+		printf 2>/dev/null done echo test "$1" 'quoted text'
+	&& done ${HOME} "$1" --verbose x=1 "$@" "$1" grep /usr/bin readonly && done
+echo --verbose | export
+export x=1 done && export echo grep done "$@" grep $(pwd)
+	export sed echo echo "$1" test cd echo /usr/bin "$@" -eu --verbose then --verbose
+export ${HOME} readonly ${HOME} local ${HOME} "$@" sed | 2>/dev/null
+	"$1" printf cd export readonly done | x=1 2>/dev/null then
+		"$1" printf -eu export 2>/dev/null
+	grep test /usr/bin "$1" --verbose readonly -eu then test ${HOME}
+	awk test grep readonly readonly grep echo 2>/dev/null
+	export readonly /usr/bin -eu -eu sed printf local sed grep
+		"$@" export "$@" grep x=1 | printf "$@" $(pwd) echo export ${HOME} test export
+'quoted text' then awk | awk export grep
+		"$1" grep -eu sed 'quoted text'
+		--verbose /usr/bin --verbose export "$@" done &&
+x=1 echo -eu then $(pwd) awk done
+		test && 2>/dev/null "$@" | test printf export readonly awk $(pwd) ${HOME}
+done "$1" printf | && readonly cd "$@" grep -eu done done "$@" "$1" -eu
+		&& sed $(pwd) cd ${HOME} 2>/dev/null
+	printf grep awk 'quoted text' 'quoted text' echo && printf "$@"
+--verbose "$1" 'quoted text' && /usr/bin
+cd && 2>/dev/null ${HOME} 'quoted text'
+test 'quoted text' | --verbose then | sed awk $(pwd)
+	then grep awk x=1 2>/dev/null
+local then 2>/dev/null ${HOME}
+		--verbose export then grep 2>/dev/null 'quoted text' echo $(pwd)
+		grep readonly readonly readonly test && awk
+		${HOME} && 2>/dev/null -eu -eu -eu local
+		${HOME} /usr/bin cd then local
+		readonly printf test /usr/bin
+		${HOME} then cd $(pwd) /usr/bin readonly "$@"
+		$(pwd) /usr/bin awk grep /usr/bin cd "$1" test done "$@"
+		readonly x=1 echo --verbose then 'quoted text' 2>/dev/null grep grep /usr/bin
+${HOME} x=1 grep printf grep
+	x=1 awk 2>/dev/null done export export test grep echo
+		cd "$1" readonly | then x=1 x=1 then -eu sed then $(pwd) export echo -eu cd done
+	local export echo 'quoted text' sed /usr/bin echo readonly then /usr/bin test |
+	echo && export x=1 $(pwd) grep local --verbose 'quoted text'
+		readonly "$1" -eu x=1 printf export /usr/bin
+		local grep 2>/dev/null test sed done ${HOME}
+readonly 'quoted text' $(pwd) 2>/dev/null 2>/dev/null "$1" readonly local
+		local export local awk export -eu export -eu
+export sed grep $(pwd) printf | && ${HOME} awk done local awk /usr/bin
+		cd && $(pwd) echo awk $(pwd) echo | --verbose
+	export sed sed $(pwd) ${HOME}
+		grep done readonly test ${HOME} && "$1" && local readonly readonly sed
+"$1" --verbose | "$1" export
+	sed --verbose then | -eu printf ${HOME} && export /usr/bin $(pwd) done -eu
+		grep x=1 'quoted text' sed echo 2>/dev/null readonly | done |
+	-eu $(pwd) ${HOME} readonly local echo test $(pwd) $(pwd) $(pwd) | echo done $(pwd)
+		cd awk echo grep "$1"
+$(pwd) grep test readonly "$1" "$@" readonly sed $(pwd) printf 'quoted text'
+		awk | test -eu -eu cd export ${HOME} export ${HOME} sed sed export local done
+	sed x=1 local sed --verbose && x=1 cd 2>/dev/null --verbose printf
+awk printf awk sed done local echo printf "$@" -eu "$@" 'quoted text' 2>/dev/null
+	grep sed 2>/dev/null
+	awk -eu readonly /usr/bin export test && | "$1" test /usr/bin 2>/dev/null cd
+sed then export grep
+export | ${HOME} then awk awk done printf
+'quoted text' "$@" $(pwd) 'quoted text' awk
+&& "$@" readonly 2>/dev/null "$1" local cd then 'quoted text'
+		"$1" sed then echo readonly "$1" printf "$@" "$1" 2>/dev/null echo 'quoted text'
+	test -eu grep $(pwd) /usr/bin -eu
+		"$1" then && echo x=1 export local grep -eu local export
+		awk x=1 readonly | "$@" "$1" awk "$1"
+		${HOME} export -eu $(pwd) && 'quoted text' x=1 /usr/bin $(pwd)
+		2>/dev/null test --verbose
+	grep --verbose $(pwd) echo ${HOME} echo echo -eu test then cd | readonly
+'quoted text' "$@" awk ${HOME} grep | "$@" && 'quoted text' test $(pwd)
+	-eu readonly local "$1" /usr/bin x=1 && sed -eu |
+		x=1 grep echo "$@" "$1" /usr/bin printf awk cd printf
+readonly 'quoted text' grep done
+	cd 2>/dev/null then export test
+		| && readonly local echo export ${HOME} "$1" $(pwd) awk export
+	"$1" awk x=1 local 2>/dev/null --verbose "$@" echo -eu 'quoted text'
+awk local "$@" printf --verbose echo export /usr/bin test
+	then test /usr/bin cd readonly $(pwd) sed awk then && && x=1 printf export
+$(pwd) 'quoted text' printf
+sed awk ${HOME} local 'quoted text' grep readonly grep test && x=1 test ${HOME}
+export ${HOME} echo $(pwd) /usr/bin x=1 $(pwd) sed ${HOME} echo -eu readonly
+	then x=1 done cd && /usr/bin /usr/bin | test
+-eu sed export "$@" cd 'quoted text' && --verbose 'quoted text'
+	awk sed 'quoted text' sed x=1 -eu && readonly "$@" && -eu
+	test echo export then echo "$1" awk local
+		--verbose printf done then "$@" $(pwd) sed sed grep done 'quoted text'
+&& printf -eu 'quoted text' x=1 sed test x=1 && sed readonly
+	grep "$@" 'quoted text' /usr/bin then
+	2>/dev/null /usr/bin && local $(pwd)
+	printf test "$@" awk cd /usr/bin ${HOME} -eu export "$@" sed readonly
+-eu "$@" "$1" then $(pwd)
+cd test readonly "$1" 2>/dev/null cd grep x=1 2>/dev/null then cd then
+		grep 2>/dev/null test awk ${HOME} grep
+	x=1 grep "$@" grep readonly echo x=1 cd ${HOME} "$@" then -eu -eu printf
+	grep ${HOME} done test x=1
+	awk done echo export test printf | 'quoted text'
+$(pwd) readonly echo printf awk 'quoted text' echo | "$@" local
+x=1 /usr/bin /usr/bin cd done | /usr/bin
+readonly printf test | && cd then local done | then $(pwd) printf --verbose
+		-eu 2>/dev/null local ${HOME} readonly
+		done && test 2>/dev/null then ${HOME} "$1" -eu echo | "$1" --verbose local -eu
+	| "$@" echo grep | | export /usr/bin awk cd grep
+	x=1 grep export x=1 done cd | 2>/dev/null --verbose x=1 &&
+$(pwd) --verbose then -eu
+| ${HOME} grep x=1 /usr/bin 2>/dev/null /usr/bin
+done echo ${HOME} "$@" "$@" printf --verbose --verbose "$@" export local
+cd && readonly 'quoted text' then ${HOME} sed
+		/usr/bin cd echo grep cd test echo awk awk ${HOME} x=1 then && cd -eu done /usr/bin
+${HOME} grep /usr/bin --verbose 2>/dev/null /usr/bin /usr/bin
+		then readonly awk 2>/dev/null "$1" -eu "$1" && --verbose grep
+${HOME} | then && /usr/bin --verbose sed ${HOME}
+"$@" /usr/bin $(pwd) $(pwd) readonly
+		export ${HOME} awk "$@" export $(pwd)
+	test --verbose done && "$1" cd "$1" 2>/dev/null "$@" --verbose --verbose 2>/dev/null
+	${HOME} "$1" /usr/bin | test "$@" export x=1 readonly
+2>/dev/null | grep done export
+		&& grep /usr/bin awk
+"$1" then echo 2>/dev/null local $(pwd) test "$1" export echo cd -eu
+$(pwd) export x=1 ${HOME} echo -eu readonly done
+	then test awk "$1" "$1" /usr/bin --verbose --verbose $(pwd)
+		| -eu test grep printf export awk /usr/bin
+	| local --verbose done readonly done -eu grep test cd /usr/bin
+	/usr/bin awk --verbose readonly ${HOME} $(pwd) test test
+	2>/dev/null then && "$1" ${HOME} printf readonly cd -eu -eu "$1" "$1" grep 'quoted text'
+		then then sed | $(pwd) && "$1" 2>/dev/null /usr/bin echo
+test ${HOME} then "$@" awk
+done && -eu | "$@" $(pwd) cd "$1" "$@" $(pwd) x=1 --verbose then
+		grep echo cd $(pwd) then done readonly
+	cd /usr/bin export local sed -eu cd printf "$1"
+	cd -eu 2>/dev/null readonly
+	--verbose echo grep -eu test awk /usr/bin cd export "$1" readonly awk
+&& test /usr/bin then local grep --verbose printf "$1" ${HOME}
+	export ${HOME} grep $(pwd) test then sed && --verbose then sed export grep
+		x=1 export printf printf done export
+		${HOME} 2>/dev/null 'quoted text' sed && done awk readonly "$1" done
+${HOME} && /usr/bin 2>/dev/null printf printf printf cd ${HOME}
+		"$1" ${HOME} test export --verbose "$@"
+		/usr/bin export printf echo printf
+sed -eu done printf readonly "$@"
+/usr/bin /usr/bin && cd && awk test $(pwd) sed echo local
+	done readonly | && $(pwd) "$@" && local x=1 readonly $(pwd) echo test printf $(pwd)
+		readonly echo 'quoted text' local
+		awk readonly ${HOME} $(pwd) ${HOME}
+	2>/dev/null test done /usr/bin 2>/dev/null 'quoted text' 2>/dev/null
+	| echo grep 'quoted text' 'quoted text'
+		2>/dev/null ${HOME} then /usr/bin done done "$@" "$@" $(pwd)
+		cd echo "$@" done | /usr/bin
+		printf test grep 2>/dev/null
+		${HOME} 'quoted text' "$1" $(pwd) "$@" sed 2>/dev/null awk x=1 grep local then
+	done "$@" printf test /usr/bin then "$1" done
+2>/dev/null sed echo done sed printf grep then 'quoted text'
+done "$1" $(pwd) --verbose readonly "$@"
+awk /usr/bin cd awk | done test awk /usr/bin test -eu done ${HOME} "$@"
+${HOME} printf sed readonly export test x=1 2>/dev/null
+${HOME} cd cd x=1 then "$@" export grep /usr/bin then readonly
+		&& done 'quoted text' 2>/dev/null awk local printf "$@" x=1
+	-eu ${HOME} ${HOME} && test -eu sed local then -eu local ${HOME} local x=1 readonly
+	-eu done /usr/bin export test 2>/dev/null
+	readonly then sed 'quoted text' echo printf
+	printf $(pwd) grep test && readonly "$@" ${HOME}
+test then sed grep /usr/bin echo "$@" sed sed grep local echo export
+$(pwd) "$@" grep export cd ${HOME} && --verbose 'quoted text' done /usr/bin cd
+	2>/dev/null sed 2>/dev/null "$1" local 'quoted text' "$1" x=1 $(pwd) then
+		/usr/bin $(pwd) local "$@" 2>/dev/null done
+		'quoted text' $(pwd) grep 'quoted text'
+cd /usr/bin printf export printf x=1 then
+"$1" cd readonly awk ${HOME} /usr/bin x=1 local
+$(pwd) readonly done && then "$1" test x=1 2>/dev/null | awk
+echo export -eu /usr/bin export test cd && 'quoted text'
+x=1 2>/dev/null /usr/bin 'quoted text' printf printf then local
+then /usr/bin test export x=1 "$@" cd cd 2>/dev/null
+		-eu /usr/bin then echo awk ${HOME} | /usr/bin
+	readonly 2>/dev/null then $(pwd) "$1" 'quoted text' export
+	printf x=1 ${HOME} -eu then
+"$@" "$@" readonly ${HOME} test sed test $(pwd)
+		--verbose cd sed sed local "$1" awk export test 2>/dev/null
+		export echo export /usr/bin cd --verbose
+		export done sed -eu sed export printf ${HOME} done then "$1" /usr/bin x=1
+	printf && "$1" export readonly sed
+then sed ${HOME} && printf "$1" local "$@" && x=1
+		--verbose printf && 2>/dev/null
+awk test | done "$1" --verbose printf && && "$@" done awk | "$@" "$@"
+		then -eu export sed test $(pwd) | 'quoted text'
+		"$@" grep sed grep --verbose test | echo test "$@"
+${HOME} --verbose echo local then 2>/dev/null $(pwd) ${HOME} readonly
+cd 2>/dev/null x=1 readonly export cd then x=1 test export
+		/usr/bin printf test -eu 2>/dev/null
+		echo local 2>/dev/null 2>/dev/null 2>/dev/null --verbose
+	readonly awk --verbose then x=1 /usr/bin done then local done grep
+	"$1" test | then ${HOME} "$1" $(pwd) /usr/bin
+&& done "$1" test 2>/dev/null printf --verbose /usr/bin 'quoted text' awk
+	"$1" then printf readonly 'quoted text' /usr/bin test
+		done readonly && local readonly x=1 | | sed local x=1 && "$@" then
+	'quoted text' -eu printf local ${HOME} "$1" 2>/dev/null printf then -eu then
+	done | awk local | then $(pwd) -eu echo
+	local -eu export "$1" export readonly awk ${HOME} local 'quoted text'
+x=1 /usr/bin 2>/dev/null test readonly
+&& --verbose x=1 readonly export cd /usr/bin
+	$(pwd) -eu printf $(pwd) cd x=1
+2>/dev/null "$1" "$1" sed 'quoted text' /usr/bin
+	2>/dev/null --verbose -eu && echo readonly awk cd sed | export done
+"$@" test --verbose "$@" done $(pwd) then readonly echo
+	grep x=1 export readonly readonly grep $(pwd) cd 'quoted text'
+sed export "$1" export --verbose "$@" $(pwd) local awk
+		echo -eu 'quoted text' then cd | /usr/bin done 2>/dev/null
+/usr/bin printf local --verbose readonly readonly
+--verbose sed printf -eu --verbose 2>/dev/null
+		/usr/bin local -eu export then then then 'quoted text' $(pwd) -eu
+		--verbose then echo ${HOME} cd echo && x=1
+		--verbose | && | then && 'quoted text' /usr/bin ${HOME} sed 'quoted text'
+then --verbose awk export local /usr/bin awk 'quoted text' ${HOME} -eu echo printf
+local | echo awk export -eu export cd 'quoted text' 'quoted text' -eu --verbose
+test --verbose "$@" /usr/bin "$1" test done done | && | 2>/dev/null /usr/bin
+"$@" | --verbose then /usr/bin "$@" then
+$(pwd) test "$@" 'quoted text' printf
+	"$@" echo "$@" && test printf export && awk -eu local done export
+"$@" --verbose done then $(pwd) | -eu test 'quoted text' /usr/bin
+grep ${HOME} | sed $(pwd) done test
+	"$1" readonly cd then test "$1"
+| then readonly "$1" awk --verbose printf
+"$@" $(pwd) echo x=1 ${HOME} printf "$@" grep -eu awk --verbose sed
+done x=1 grep 2>/dev/null
+	awk done done 'quoted text' $(pwd) echo
+		then | x=1 x=1 done cd done grep | 2>/dev/null "$1" sed "$@" 'quoted text'
+		${HOME} --verbose export && readonly local readonly test
+	done 'quoted text' test -eu then cd
+"$@" ${HOME} export "$1" ${HOME} sed "$1" && done sed
+export awk "$@" 'quoted text' done grep local 'quoted text'
+	${HOME} then test /usr/bin grep "$1" --verbose -eu printf test printf --verbose
+awk /usr/bin done -eu awk x=1 printf
+	done awk then echo x=1 cd "$1" done 2>/dev/null echo x=1 test
+-eu awk sed -eu $(pwd) sed "$1" printf local
+		-eu export && test "$@" then local -eu /usr/bin "$@" done
+printf sed local grep then && sed then --verbose printf export readonly
+"$@" /usr/bin sed grep /usr/bin /usr/bin -eu "$@" then 'quoted text'
+		${HOME} "$@" sed local | "$1" "$1" readonly -eu "$@"
+		| x=1 --verbose printf 2>/dev/null
+		cd awk printf done --verbose
+		${HOME} "$@" -eu done 2>/dev/null $(pwd) && grep printf && awk sed cd && awk grep
+		--verbose $(pwd) test -eu done
+	sed --verbose local cd grep export printf sed grep ${HOME}
+		cd /usr/bin printf "$1" -eu readonly 2>/dev/null
+		echo 'quoted text' printf cd
+	done --verbose -eu echo | cd then --verbose x=1 x=1 'quoted text'
+		/usr/bin grep && -eu then readonly "$1" -eu cd then done x=1 printf |
+	| export "$1" export "$1" | readonly 2>/dev/null awk cd
+		printf local done awk awk local test
+	grep x=1 /usr/bin printf 2>/dev/null then cd ${HOME} local
+		cd /usr/bin awk $(pwd) ${HOME} export 'quoted text' sed /usr/bin x=1
+	done cd export then cd cd |
+done local 'quoted text'
+	2>/dev/null 2>/dev/null x=1 "$1" then --verbose test echo /usr/bin
+		2>/dev/null readonly readonly 'quoted text' printf ${HOME} && local done x=1 &&
+printf 2>/dev/null -eu readonly awk 2>/dev/null "$@" "$@"
+	readonly printf -eu readonly grep awk done echo local
+x=1 'quoted text' done test
+		'quoted text' sed echo -eu export 'quoted text' grep readonly
+		awk printf echo printf x=1 echo export
+	--verbose 'quoted text' grep local test && | awk 'quoted text' ${HOME} export test
+cd -eu 2>/dev/null /usr/bin -eu | done ${HOME} local test
+	echo "$@" done echo 2>/dev/null $(pwd) 'quoted text' sed
+sed awk && 'quoted text' readonly
+		readonly -eu 'quoted text' /usr/bin awk x=1 done $(pwd) sed test x=1 grep
+	-eu ${HOME} $(pwd) readonly "$@" grep /usr/bin cd local local export
+grep then awk "$@" done readonly
+	cd grep "$@" --verbose | grep $(pwd) printf local /usr/bin 2>/dev/null | local
+	&& echo $(pwd) -eu printf
+grep done x=1 local grep export
+x=1 echo x=1 grep $(pwd) export export
+		cd x=1 export local ${HOME} done 2>/dev/null grep test sed
+		local export sed echo echo cd done done echo grep x=1 export "$@" --verbose
+x=1 -eu | done sed grep /usr/bin
+	&& export "$1" /usr/bin echo readonly "$1" "$@" "$1" 'quoted text'
+		local local 'quoted text' /usr/bin local
+		sed $(pwd) done export
+	sed "$@" 'quoted text' grep then x=1
+		sed cd sed | done local 2>/dev/null cd printf echo x=1 sed export readonly
+		--verbose readonly $(pwd) /usr/bin local
+		local export && echo "$1" x=1 sed local grep "$1" local 2>/dev/null then export
+	printf local then /usr/bin sed "$@" /usr/bin
+--verbose "$@" test "$@"
+		grep local --verbose export 'quoted text' sed 2>/dev/null printf --verbose "$1"
+x=1 cd && echo /usr/bin sed printf /usr/bin
+		/usr/bin x=1 "$@" done && -eu cd test then "$@" | then export
+	--verbose cd local | awk then 'quoted text' sed ${HOME}
+	sed "$@" x=1 --verbose /usr/bin
+	grep -eu then --verbose
+		$(pwd) then --verbose local && 'quoted text' grep test && -eu "$1" export --verbose
+		sed awk readonly cd "$@" test ${HOME} 'quoted text'
+	x=1 grep && --verbose grep x=1 readonly sed "$@" then test local | echo
+		'quoted text' $(pwd) "$1" printf printf
+'quoted text' done 'quoted text' -eu -eu readonly |
+awk x=1 $(pwd) export --verbose "$@" test test cd --verbose
+	then "$1" $(pwd) export awk echo 'quoted text' 2>/dev/null printf $(pwd) then
+	'quoted text' sed printf --verbose --verbose cd printf printf awk x=1
+	grep "$1" && cd then --verbose "$1"
+$(pwd) test -eu done x=1 && "$@" test then
+| "$1" readonly then grep awk 2>/dev/null
+		test x=1 ${HOME} sed echo "$1" -eu cd $(pwd) awk ${HOME} then
+readonly "$1" /usr/bin && /usr/bin /usr/bin
+	export ${HOME} -eu printf test awk ${HOME} sed
+"$1" "$@" 2>/dev/null --verbose
+&& 2>/dev/null done sed |
+&& awk ${HOME} test --verbose $(pwd) echo readonly printf awk 2>/dev/null
+local readonly /usr/bin cd /usr/bin then awk "$@" "$1" then --verbose
+/usr/bin cd then && printf 2>/dev/null /usr/bin readonly
+		echo then then /usr/bin export echo $(pwd) /usr/bin "$1" test
+	${HOME} /usr/bin /usr/bin | 'quoted text' "$@" test awk "$@" 'quoted text' sed
+	/usr/bin --verbose "$@" | readonly | cd printf $(pwd) "$1" ${HOME} sed
+	x=1 done x=1 2>/dev/null | cd ${HOME}
+	| && then 'quoted text' 'quoted text' sed grep awk | awk echo then
+		'quoted text' test cd echo $(pwd) 2>/dev/null /usr/bin "$@" cd "$1" ${HOME}
+		"$1" | then echo x=1 sed -eu then local | $(pwd) --verbose
+	then /usr/bin x=1 /usr/bin then --verbose
+		| readonly sed -eu /usr/bin && awk $(pwd) && local export
+local then local ${HOME} "$1" 'quoted text' --verbose -eu -eu /usr/bin $(pwd)
+	export 2>/dev/null done echo done -eu echo $(pwd) test $(pwd) echo && "$1"
+	readonly test echo test sed sed sed
+	readonly | readonly then --verbose
+	echo --verbose && printf awk
+		&& --verbose echo sed --verbose | grep printf
+		$(pwd) then $(pwd) echo done "$1" sed --verbose 2>/dev/null
+x=1 'quoted text' test 2>/dev/null sed 2>/dev/null 'quoted text' then awk "$1"
+	done awk test echo && 'quoted text' ${HOME} x=1 readonly "$1" 'quoted text'
+		readonly test test 'quoted text'
+	grep "$1" x=1 export "$1"
+	'quoted text' 'quoted text' $(pwd) $(pwd) -eu local
+sed -eu test --verbose done | sed sed cd cd && && printf && "$@" done ${HOME}
+		export | sed cd && 'quoted text'
+	done "$@" "$1" -eu awk x=1 'quoted text'
+		"$@" | then --verbose printf grep readonly "$@" local local && --verbose export
+	sed printf "$@" 2>/dev/null "$1" ${HOME} printf $(pwd) printf
+		local "$@" done cd test done readonly /usr/bin grep then
+	"$@" 2>/dev/null && -eu export awk -eu cd awk -eu -eu /usr/bin
+	test test printf "$1" -eu && | --verbose
+	readonly 2>/dev/null 'quoted text'
+then /usr/bin test grep printf
+		/usr/bin x=1 then awk "$@" 2>/dev/null "$@" /usr/bin
+	x=1 done /usr/bin sed && 2>/dev/null echo local | 2>/dev/null export printf
+		readonly then then $(pwd) awk x=1 export test
+printf 'quoted text' "$1" --verbose
+		awk ${HOME} --verbose export local /usr/bin
+| export cd "$@" then "$1" awk echo sed "$@" x=1 "$1" sed
+		| echo ${HOME} grep echo "$@" cd "$1" echo x=1 test x=1 &&
+cd && grep 'quoted text'
+		$(pwd) echo done "$1" $(pwd) awk awk $(pwd) printf
+		x=1 | awk local echo printf ${HOME}
+$(pwd) done 2>/dev/null readonly "$1" x=1 -eu cd
+2>/dev/null 'quoted text' && export printf awk 2>/dev/null
+	/usr/bin cd printf ${HOME} "$@" cd test export printf grep cd readonly "$1"
+		$(pwd) printf done grep test readonly
+then printf /usr/bin printf readonly
+		$(pwd) "$@" | --verbose export | done -eu
+	printf ${HOME} | 2>/dev/null | /usr/bin $(pwd) 2>/dev/null done "$@"
+	| -eu && | "$1" awk -eu /usr/bin echo echo | done test sed local sed local echo
+	&& cd ${HOME} && awk --verbose 'quoted text' "$@" /usr/bin
+2>/dev/null $(pwd) printf /usr/bin test
+	echo printf x=1 x=1 --verbose
+	export done --verbose -eu $(pwd)
+	2>/dev/null grep && $(pwd) done done --verbose x=1 awk sed --verbose $(pwd) ${HOME}
+	"$@" "$@" 2>/dev/null echo test
+		x=1 grep | ${HOME} | "$@" test then "$@" printf "$@" "$1" readonly awk
+		local | && readonly 'quoted text'
+	x=1 readonly sed && echo then --verbose export then ${HOME} done && -eu "$@"
+sed awk --verbose $(pwd) cd printf echo 'quoted text' grep
+	x=1 --verbose $(pwd) "$@" cd local done ${HOME} -eu readonly done | printf
+echo test && local awk -eu
+		test && export 'quoted text' "$1" 'quoted text'
+		${HOME} local grep done | test local "$1" printf | cd test printf
+	readonly export cd x=1 done readonly ${HOME} ${HOME} ${HOME} ${HOME} export test
+		/usr/bin done -eu 'quoted text'
+		export --verbose && $(pwd)
+echo -eu readonly cd echo ${HOME} test local readonly done then test readonly
+	printf done awk && /usr/bin --verbose awk /usr/bin done /usr/bin
+		| && "$@" "$@" grep export printf "$@"
+2>/dev/null done export /usr/bin
+echo then then sed export "$1" sed sed ${HOME} x=1 "$1" "$@" 'quoted text' ${HOME}
+x=1 echo "$1" cd cd --verbose /usr/bin sed x=1
+		printf readonly sed local "$@" "$@" printf "$1"
+	cd ${HOME} local | printf && "$1" ${HOME} $(pwd) 2>/dev/null
+${HOME} then /usr/bin awk --verbose -eu export then done done test
+		/usr/bin | test test --verbose 2>/dev/null export
+sed x=1 -eu x=1 --verbose done printf cd | $(pwd)
+	2>/dev/null --verbose awk $(pwd) grep /usr/bin && -eu test && printf
+	then /usr/bin ${HOME} "$@"
+	--verbose $(pwd) && awk export printf /usr/bin && --verbose | /usr/bin grep
+		done readonly -eu x=1 readonly 2>/dev/null readonly && test "$@"
+		2>/dev/null && "$@" cd grep cd x=1 grep sed /usr/bin
+2>/dev/null cd -eu ${HOME} awk export | awk export export /usr/bin "$@" local
+	--verbose | then sed -eu export
+		2>/dev/null -eu then done ${HOME} echo $(pwd) echo done test 'quoted text' local
+	-eu /usr/bin readonly --verbose printf echo
+x=1 then $(pwd) /usr/bin then /usr/bin
+	local 2>/dev/null test test sed cd /usr/bin ${HOME} ${HOME} /usr/bin
+		done -eu then | awk local --verbose export done then sed test readonly
+		$(pwd) "$1" test $(pwd) x=1 ${HOME} 2>/dev/null
+sed test "$1" done --verbose x=1
+	printf 'quoted text' export grep sed sed awk x=1
+	| && printf cd awk cd "$1" test printf 'quoted text'
+		"$1" done test readonly 'quoted text'
+		sed -eu readonly "$1" then grep sed cd ${HOME} ${HOME} echo
+	"$1" && awk "$1" echo --verbose 'quoted text'
+echo -eu "$@" 'quoted text' -eu "$@" ${HOME} ${HOME} printf && x=1 --verbose echo
+"$1" 2>/dev/null --verbose then then cd test done --verbose awk 2>/dev/null
+	&& | /usr/bin && awk | sed cd done export readonly "$1" "$@"
+		${HOME} then ${HOME} grep ${HOME}
+		| --verbose x=1 echo local "$@" --verbose readonly
+sed export readonly "$1" awk awk x=1
+2>/dev/null done 2>/dev/null -eu then x=1 x=1 grep && test 2>/dev/null test
+&& printf --verbose /usr/bin
+	&& | test x=1 "$@" sed "$1" --verbose -eu then
+cd cd then readonly export | cd local
+	$(pwd) sed 'quoted text' sed -eu | --verbose 'quoted text' test
+	/usr/bin | | sed done done x=1 2>/dev/null 2>/dev/null
+&& then --verbose done && grep ${HOME}
+sed awk echo awk | echo readonly && --verbose
+		then cd then -eu 'quoted text' | printf x=1 $(pwd) echo &&
+x=1 | readonly 'quoted text' x=1 -eu printf echo -eu /usr/bin
+		readonly /usr/bin $(pwd) grep -eu /usr/bin /usr/bin local
+	'quoted text' printf /usr/bin x=1 local cd /usr/bin --verbose printf
+	"$1" "$1" cd export sed 2>/dev/null /usr/bin sed then "$1" local
+		'quoted text' "$@" awk
+	-eu grep test readonly /usr/bin grep $(pwd) grep 'quoted text'
+	export 'quoted text' sed cd | echo test $(pwd) 'quoted text' printf ${HOME}
+	test 'quoted text' 'quoted text' ${HOME} -eu
+		echo done grep && $(pwd) --verbose
+		--verbose done done "$@" export local && then ${HOME}
+	cd /usr/bin grep "$@" /usr/bin printf test awk 'quoted text' | 'quoted text'
+test printf /usr/bin /usr/bin export $(pwd) 2>/dev/null
+then export awk test done "$1" grep then readonly 'quoted text' awk /usr/bin
+x=1 export 2>/dev/null printf --verbose && sed "$@" -eu
+	sed test x=1 then 'quoted text' && sed $(pwd) export
+	test 'quoted text' /usr/bin 'quoted text' local local cd $(pwd)
+		test $(pwd) printf awk test
+		printf -eu x=1 then printf grep readonly "$1" $(pwd) | ${HOME} sed awk && sed
+		done local -eu export sed && grep readonly cd
+		then then /usr/bin local /usr/bin 'quoted text'
+	"$1" printf grep && cd x=1
+	echo "$@" echo "$@" local awk ${HOME} local ${HOME}
+	printf ${HOME} && "$1"
+	awk local 'quoted text' export then -eu
+	'quoted text' then grep "$1" "$@"
+"$1" printf /usr/bin local 'quoted text' --verbose export /usr/bin
+	'quoted text' cd echo sed awk local
+	$(pwd) awk && printf "$1" done grep -eu x=1 --verbose
+| && grep x=1 --verbose
+	test --verbose 2>/dev/null local 2>/dev/null then x=1 x=1 awk export x=1 $(pwd)
+x=1 -eu 2>/dev/null done x=1 grep grep readonly readonly /usr/bin then printf sed
+$(pwd) 'quoted text' awk export awk $(pwd) sed && /usr/bin
+printf local /usr/bin 'quoted text' "$1"
+		| awk then $(pwd) 2>/dev/null "$1" "$@" printf export
+		x=1 readonly x=1 2>/dev/null export | grep x=1 x=1 "$@" ${HOME} --verbose
+grep grep /usr/bin readonly cd printf then grep local "$@" readonly &&
+	sed 2>/dev/null 'quoted text'
+		2>/dev/null -eu -eu 2>/dev/null export | --verbose grep done
+${HOME} && printf && "$@" && 2>/dev/null
+		done "$@" -eu x=1 /usr/bin local "$@" awk then test 2>/dev/null "$1"
+		"$1" awk $(pwd) "$@" $(pwd) "$@" /usr/bin "$1" x=1 readonly readonly
+		done printf x=1 "$@"
+		&& --verbose --verbose && local 'quoted text'
+x=1 x=1 cd echo "$@" then export then
+then echo test sed awk done && -eu local | sed test grep /usr/bin
+"$1" 'quoted text' printf $(pwd) grep test sed
+		then x=1 x=1 ${HOME} awk x=1
+printf ${HOME} --verbose readonly x=1 sed --verbose cd done x=1 $(pwd)
+		/usr/bin --verbose /usr/bin -eu awk echo echo "$1" echo awk
+	x=1 -eu && && && grep then "$@" /usr/bin $(pwd)
+| printf ${HOME} "$@" && export /usr/bin 2>/dev/null $(pwd) cd --verbose
+readonly printf grep "$@"
+		"$@" export --verbose -eu readonly
+		export test 2>/dev/null -eu
+x=1 grep -eu readonly done && then test local then /usr/bin
+	${HOME} test done &&
+		$(pwd) grep $(pwd) 'quoted text'
+		2>/dev/null done local done export awk x=1
+local -eu readonly export readonly | | local cd ${HOME} ${HOME} 'quoted text'
+${HOME} "$1" --verbose && "$@" grep
+		printf && printf ${HOME} echo --verbose 'quoted text'
+		printf ${HOME} -eu x=1 && printf
+${HOME} x=1 x=1 -eu test x=1
+/usr/bin printf echo sed done readonly sed "$1" echo && x=1 ${HOME} $(pwd) ${HOME}
+		local x=1 "$@" test done printf grep readonly export grep
+	grep x=1 $(pwd) export awk done printf readonly
+		--verbose grep export ${HOME}
+	readonly echo "$1" ${HOME} grep 2>/dev/null
+	echo cd && test 'quoted text' then /usr/bin
+	"$1" --verbose && echo local --verbose
+		${HOME} | awk "$1" printf done "$@"
+awk local | then grep ${HOME} sed "$@" | "$1" $(pwd) "$@"
+		${HOME} local export local grep /usr/bin done
+grep readonly 'quoted text' local "$@" --verbose ${HOME}
+	x=1 "$@" 2>/dev/null $(pwd) echo done
+		echo grep | readonly then done then 2>/dev/null
+		local && | cd "$1" awk /usr/bin then 'quoted text'
+	--verbose grep done ${HOME}
+		then 2>/dev/null $(pwd)
+-eu done cd /usr/bin ${HOME} then 2>/dev/null -eu "$1" x=1 && /usr/bin
+--verbose "$1" && local awk done cd
+	-eu --verbose local echo then printf echo $(pwd) echo
+	"$@" export 'quoted text' $(pwd) readonly 'quoted text'
+	export ${HOME} grep test "$1" test cd readonly local ${HOME} $(pwd)
+	awk printf "$@" && --verbose x=1 "$1"
+	--verbose | -eu /usr/bin 'quoted text' test export
+	printf test | && x=1 test ${HOME}
+done local "$@" "$@" /usr/bin "$1" -eu local
+		cd /usr/bin grep | cd && ${HOME} "$@" 'quoted text'
+2>/dev/null --verbose 'quoted text'
+	test | readonly x=1 echo -eu echo export ${HOME} -eu
+	echo echo "$@" local | /usr/bin | then
+	$(pwd) printf test echo -eu ${HOME} readonly
+"$@" local cd /usr/bin local echo --verbose cd test ${HOME}
+	2>/dev/null printf | local
+grep printf local && "$@" echo export done
+		-eu grep --verbose "$1" sed "$1"
+		2>/dev/null | | | export | 2>/dev/null done ${HOME} 2>/dev/null
+'quoted text' readonly ${HOME} awk x=1 $(pwd) "$@" local 'quoted text'
+	"$@" echo readonly -eu printf | grep done 'quoted text'
+"$@" export 'quoted text' 'quoted text' | 'quoted text'
+-eu awk "$1" local | readonly test --verbose "$@" awk then done
+	cd -eu ${HOME} && done 2>/dev/null /usr/bin && then 'quoted text'
+		local local sed echo x=1 cd awk printf then && |
+	"$@" done printf 2>/dev/null $(pwd)
+		"$@" local awk sed awk --verbose grep 2>/dev/null --verbose && then "$1" then &&
+		${HOME} awk 'quoted text' echo ${HOME} ${HOME} "$@" local sed
+	echo local done then printf cd test export | readonly printf
+	"$@" ${HOME} && ${HOME} local sed awk -eu "$1" grep ${HOME}
+cd done grep /usr/bin /usr/bin 2>/dev/null then echo then
+test printf --verbose 'quoted text' grep | $(pwd) awk -eu echo readonly echo
+&& export $(pwd) echo test then readonly printf 2>/dev/null done cd "$1"
+2>/dev/null | 2>/dev/null test grep local cd 2>/dev/null
+		"$1" "$1" grep sed grep
+		$(pwd) test echo -eu --verbose --verbose sed sed x=1 | local readonly grep awk
+awk echo x=1 grep done printf -eu && x=1 printf "$@"
+awk ${HOME} && local x=1
+		then | "$@" test readonly -eu echo grep printf | --verbose x=1 | cd /usr/bin awk
+	'quoted text' done cd x=1 | grep printf
+$(pwd) printf done grep awk | readonly
+--verbose awk printf --verbose cd export 'quoted text' "$1" then
+		sed -eu local "$1" x=1 --verbose "$@" --verbose
+		2>/dev/null /usr/bin local -eu /usr/bin then x=1 sed
+		/usr/bin "$1" "$1" local "$@" --verbose test ${HOME} export readonly /usr/bin
+	readonly sed test ${HOME} readonly
+		echo export "$1" done grep 2>/dev/null echo "$1"
+2>/dev/null export --verbose -eu
+		'quoted text' cd printf
+		sed then "$1" 2>/dev/null 2>/dev/null then echo
+		sed test sed "$1" ${HOME} cd -eu cd readonly
+		cd "$1" x=1 echo readonly then echo test --verbose -eu grep -eu && $(pwd)
+		$(pwd) 2>/dev/null 2>/dev/null then awk 2>/dev/null sed
+	done cd echo grep done echo then done $(pwd) printf /usr/bin local awk grep
+		&& cd awk then "$1" sed
+		2>/dev/null sed "$1" echo | readonly
+	local 'quoted text' "$@" cd x=1 awk readonly
+test && && | then sed readonly awk 2>/dev/null printf ${HOME}
+	test 2>/dev/null -eu --verbose sed local test local
+	done 'quoted text' test | grep grep printf && && test done printf "$1"
+	echo grep export | ${HOME} test /usr/bin done -eu done printf && cd grep done
+	sed "$1" ${HOME} awk $(pwd) 'quoted text' done test cd export
+cd readonly done --verbose | "$1" 'quoted text' /usr/bin
+	| test -eu x=1 "$@" awk then /usr/bin echo "$@" $(pwd) export cd test
+	"$@" --verbose sed "$@" x=1 "$1" $(pwd) 2>/dev/null 2>/dev/null sed | "$1" echo
+--verbose "$@" 'quoted text' sed ${HOME} -eu echo cd $(pwd) "$1" --verbose
+	test grep "$1" --verbose "$1" cd test
+		readonly -eu "$@" echo echo x=1 test "$1" grep export echo then x=1 printf done
+readonly 'quoted text' "$1" -eu | --verbose echo awk cd test $(pwd)
+		${HOME} "$1" sed | 'quoted text' /usr/bin | x=1 local
+		sed "$1" test test test readonly --verbose test 'quoted text'
+grep ${HOME} printf done && $(pwd)
+	${HOME} export echo grep
+'quoted text' readonly 2>/dev/null local done x=1 && 'quoted text'
+	&& $(pwd) local --verbose grep --verbose echo $(pwd) printf then && x=1 x=1 'quoted text'
+	awk && then export -eu $(pwd) $(pwd) -eu -eu cd then 'quoted text' then printf
+	| echo x=1 "$1" $(pwd) cd "$@" 'quoted text' then grep "$@" sed 'quoted text' "$1"
+		/usr/bin export export $(pwd) && | && 'quoted text' -eu 2>/dev/null "$@" "$1"
+		/usr/bin /usr/bin local
+		${HOME} ${HOME} -eu grep "$1" "$@" && done "$1" export
+grep "$@" ${HOME} local printf
+		$(pwd) && 'quoted text'
+		/usr/bin printf x=1 awk 'quoted text' then
+	x=1 local sed sed $(pwd) printf echo
+	awk printf grep awk 2>/dev/null "$@" && echo export
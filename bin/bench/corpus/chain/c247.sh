@@ -0,0 +1,2001 @@
+	sed "$@" | x=1 cd "$@" && /usr/bin
+		${HOME} sed cd test cd
+	| && "$1" echo 2>/dev/null awk "$@" cd --verbose x=1
+grep sed sed -eu awk /usr/bin cd local awk $(pwd) && && export readonly
+	grep echo export ${HOME} -eu "$@" "$1" sed "$1" readonly awk $(pwd) readonly
+	-eu done $(pwd) x=1 2>/dev/null $(pwd) $(pwd) --verbose then
+	export x=1 'quoted text' then | /usr/bin
+		then --verbose sed grep done cd cd ${HOME}
+	echo -eu $(pwd) awk cd then then 'quoted text'
+	readonly echo grep /usr/bin grep
+		'quoted text' test cd 'quoted text' cd awk --verbose
+readonly local done "$1" local awk /usr/bin 'quoted text' echo grep
+test "$1" | 2>/dev/null then /usr/bin
+		-eu $(pwd) --verbose awk done export 'quoted text' ${HOME} --verbose
+	${HOME} printf -eu |
+	grep local awk local test x=1 readonly -eu | printf
+-eu cd $(pwd) export ${HOME} done $(pwd)
+		grep "$1" $(pwd) readonly | | test
+	&& /usr/bin awk $(pwd) | "$1" 2>/dev/null echo export done
+		sed then && sed 'quoted text' "$@" ${HOME} sed awk cd
+	2>/dev/null echo --verbose x=1 --verbose ${HOME} "$1" "$@"
+		grep && && echo --verbose grep && done local then "$@" "$1" -eu echo test "$1" readonly
+		test awk awk "$1" --verbose local "$@"
+&& x=1 ${HOME} printf grep
+	done -eu cd 2>/dev/null awk cd awk
+	echo "$@" x=1 echo then $(pwd) &&
+		--verbose awk readonly ${HOME} test test /usr/bin ${HOME} --verbose printf "$1"
+| printf 2>/dev/null sed awk local printf cd test then done printf
+printf x=1 done readonly sed sed && 2>/dev/null "$1" grep "$@" --verbose echo
+		x=1 test echo sed readonly 2>/dev/null
+echo 'quoted text' awk test grep done echo export
+	awk sed --verbose "$@" echo && export | printf -eu echo ${HOME} "$1"
+	printf then x=1 "$1" export && readonly readonly cd /usr/bin echo cd | grep readonly
+	$(pwd) then local local done printf local "$1" test -eu | 'quoted text'
+		awk "$1" -eu "$1" "$1" -eu "$@" local then done awk | then
+		/usr/bin --verbose test awk cd cd grep "$@" /usr/bin echo sed done awk
+'quoted text' cd grep echo $(pwd) cd "$@" then test done ${HOME} | && awk awk
+	sed "$@" 'quoted text' && then | test sed
+	readonly 'quoted text' --verbose --verbose 2>/dev/null x=1
+		$(pwd) --verbose printf test "$@" sed
+	echo export sed | "$1" "$1" | | -eu
+	2>/dev/null grep x=1 cd sed
+2>/dev/null ${HOME} test && | --verbose
+$(pwd) ${HOME} $(pwd) awk && ${HOME} sed "$@" test && | cd done
+		then "$@" "$1" -eu "$1" --verbose $(pwd) | cd ${HOME} ${HOME}
+	$(pwd) $(pwd) "$@" cd echo -eu awk && --verbose local then then cd grep /usr/bin
+		&& export -eu --verbose
+local --verbose awk 2>/dev/null cd 'quoted text' "$1" echo
+sed readonly 'quoted text'
+	local echo -eu ${HOME} printf test done test x=1 -eu "$@" export
+awk awk $(pwd) sed /usr/bin
+2>/dev/null $(pwd) | 'quoted text' cd
+		then | && grep x=1 echo --verbose -eu && 2>/dev/null
+	readonly printf $(pwd) echo "$@" 'quoted text'
+-eu && /usr/bin x=1 local
+		-eu echo printf | echo "$@" echo | echo | grep echo echo done
+		then export x=1 "$@" echo "$1" $(pwd) && printf
+		grep done readonly 2>/dev/null "$1" -eu 'quoted text'
+local 2>/dev/null --verbose | x=1 grep readonly "$@" -eu printf echo local readonly
+	readonly awk sed "$1" grep -eu test awk && | export awk readonly
+	${HOME} -eu done && readonly sed sed "$1" sed then ${HOME} 2>/dev/null
+	&& ${HOME} export "$1"
+awk readonly && echo "$@" 2>/dev/null "$@"
+		test awk awk local 2>/dev/null
+	cd /usr/bin awk then awk ${HOME} sed test $(pwd) |
+		done $(pwd) && | then 'quoted text' | && /usr/bin ${HOME} grep && test
+		grep then done local test 2>/dev/null
+	$(pwd) | echo /usr/bin | grep then --verbose $(pwd) export test
+2>/dev/null echo export printf -eu x=1 echo readonly grep grep && then && ${HOME}
+printf -eu cd cd done x=1 printf
+	sed /usr/bin echo export cd /usr/bin grep $(pwd) printf test echo 2>/dev/null
+	then | "$@" echo 2>/dev/null done
+		readonly done done /usr/bin readonly
+		sed export 'quoted text' export awk echo x=1 "$@" x=1 local "$@" x=1 "$@"
+-eu 2>/dev/null | | -eu "$@"
+		echo -eu export ${HOME} && x=1 ${HOME} printf echo $(pwd) "$1" "$@" done | $(pwd)
+| --verbose sed sed && readonly --verbose
+		export cd "$1" grep 'quoted text' local printf then cd grep 2>/dev/null $(pwd)
+		2>/dev/null $(pwd) "$@" 2>/dev/null grep 'quoted text' -eu echo cd 2>/dev/null
+$(pwd) | 'quoted text' printf awk &&
+| ${HOME} echo --verbose printf echo /usr/bin printf "$@"
+		'quoted text' grep done cd --verbose readonly "$1" | 2>/dev/null then awk
+| "$1" test local done x=1
+${HOME} ${HOME} printf sed $(pwd)
+	then "$1" /usr/bin "$@" -eu grep &&
+	readonly echo echo -eu done | then | sed 2>/dev/null ${HOME} 2>/dev/null && --verbose
+		test sed awk $(pwd) done local cd grep 'quoted text'
+		2>/dev/null awk 2>/dev/null
+	&& "$1" 'quoted text' /usr/bin readonly test printf sed
+'quoted text' sed local -eu cd $(pwd) printf 'quoted text'
+then "$1" echo "$1" "$@" ${HOME} | done test grep local
+	local | then printf done echo 'quoted text'
+2>/dev/null done local export 'quoted text' then awk
+		done sed "$@" /usr/bin test 2>/dev/null sed awk 2>/dev/null readonly
+export echo local --verbose export done awk
+	done x=1 && sed echo printf cd test $(pwd) && readonly done sed "$1"
+	echo test grep cd "$1" then | --verbose 2>/dev/null && "$@" echo export
+		2>/dev/null 'quoted text' export x=1 grep sed
+| x=1 | /usr/bin readonly sed /usr/bin 2>/dev/null awk /usr/bin cd
+	awk printf readonly export ${HOME} $(pwd)
+test cd readonly export done 2>/dev/null printf
+	awk 2>/dev/null && && grep 2>/dev/null local "$@" "$@" export x=1 export
+"$1" then && && x=1 test ${HOME}
+		'quoted text' awk readonly sed && done sed
+&& $(pwd) | printf 2>/dev/null
+	-eu done readonly "$1" -eu && ${HOME} local grep "$1" grep local local test echo
+echo && "$1" readonly test
+		/usr/bin $(pwd) "$@" --verbose
+		test && && then -eu /usr/bin cd awk grep test ${HOME} local done sed --verbose
+		printf test then | "$@" cd echo echo
+	test grep cd printf awk --verbose echo x=1
+2>/dev/null test 2>/dev/null
+x=1 $(pwd) ${HOME} then "$@" x=1 test
+		-eu cd ${HOME} grep --verbose test $(pwd) "$@" && 'quoted text' done echo && | sed
+	'quoted text' x=1 readonly cd 'quoted text' x=1 "$1" 2>/dev/null
+		then 2>/dev/null 'quoted text' --verbose echo x=1 cd export x=1 echo
+| 'quoted text' /usr/bin 'quoted text' readonly
+	&& -eu printf readonly export 'quoted text' && $(pwd) -eu grep
+	'quoted text' done --verbose sed ${HOME} 'quoted text'
+then --verbose /usr/bin $(pwd) printf cd $(pwd) "$@" test test -eu
+	--verbose x=1 --verbose 2>/dev/null awk 'quoted text' cd && local then cd
+		local | x=1 "$1" then $(pwd) local "$@" 'quoted text' && 'quoted text' -eu
+	grep 2>/dev/null printf readonly test
+		${HOME} awk 'quoted text'
+	cd --verbose export -eu then printf awk
+		local | "$@" x=1 ${HOME} test then done test 'quoted text' printf
+x=1 x=1 -eu readonly ${HOME} /usr/bin /usr/bin /usr/bin
+		readonly readonly sed readonly
+	then done export then && "$@" local awk local && | --verbose ${HOME}
+done ${HOME} --verbose export cd printf ${HOME} then readonly 2>/dev/null
+$(pwd) $(pwd) echo 'quoted text'
+/usr/bin /usr/bin then awk |
+x=1 $(pwd) cd --verbose 2>/dev/null grep
+	sed 'quoted text' export
+		then "$@" cd $(pwd) sed 2>/dev/null export
+	sed "$@" "$1" 2>/dev/null done --verbose grep sed --verbose | --verbose readonly
+test && "$@" | 2>/dev/null
+		x=1 2>/dev/null cd -eu $(pwd) awk | test printf echo done awk done
+		test echo "$1" export x=1 x=1 cd | then x=1 local export
+	local ${HOME} | grep readonly
+"$1" -eu grep readonly | cd export cd readonly && | x=1 sed
+		printf cd x=1 -eu 2>/dev/null readonly
+	| ${HOME} --verbose export
+echo export 'quoted text' 2>/dev/null
+		grep readonly printf test local
+	$(pwd) $(pwd) 2>/dev/null "$@" --verbose $(pwd)
+sed local | then grep "$1" test
+	'quoted text' | export && readonly -eu --verbose --verbose awk
+x=1 | then echo x=1 /usr/bin ${HOME} cd $(pwd) done "$1" cd
+${HOME} && export "$@" "$1" --verbose readonly local 2>/dev/null 2>/dev/null sed
+	${HOME} awk cd local then 'quoted text' test $(pwd) ${HOME}
+	echo done -eu "$1" then echo local sed
+grep 'quoted text' cd done ${HOME} 2>/dev/null export
+	export echo | ${HOME}
+	/usr/bin "$1" && && 2>/dev/null sed printf test /usr/bin
+		$(pwd) readonly ${HOME} /usr/bin readonly sed export readonly sed "$@" local cd
+	cd export 2>/dev/null &&
+	| cd done -eu "$@" && sed sed 'quoted text' /usr/bin awk
+		x=1 /usr/bin && 'quoted text' cd 'quoted text'
+	done then "$1" printf grep sed --verbose
+awk done export -eu $(pwd) readonly "$1" "$@" | -eu $(pwd) cd 2>/dev/null sed
+2>/dev/null grep --verbose "$@" done -eu printf "$@" printf x=1 --verbose
+done grep printf grep x=1
+		done 2>/dev/null export 'quoted text'
+grep export /usr/bin --verbose x=1 -eu
+	test done local ${HOME} echo printf /usr/bin
+	"$1" printf readonly | printf echo echo && -eu then
+2>/dev/null -eu /usr/bin export -eu --verbose
+	grep x=1 done then /usr/bin | local echo
+		"$1" && 2>/dev/null printf ${HOME} cd "$1" done grep done /usr/bin awk
+awk 2>/dev/null ${HOME} echo -eu 2>/dev/null "$1" "$1" 'quoted text' "$1"
+	cd echo /usr/bin 'quoted text' | printf done --verbose echo 2>/dev/null "$1"
+		sed | readonly | "$@" | awk
+	then 'quoted text' "$1" test $(pwd)
+		awk sed 'quoted text' printf readonly && local 'quoted text'
+"$@" 2>/dev/null && awk awk "$1" "$@" printf
+		--verbose local ${HOME} "$@" /usr/bin
+		--verbose grep "$1" --verbose "$1" /usr/bin
+	sed /usr/bin printf readonly "$@" | cd -eu 2>/dev/null 'quoted text' -eu export
+		printf then --verbose | "$1" sed 2>/dev/null cd && grep "$1" export readonly
+		local sed $(pwd) grep 2>/dev/null ${HOME} cd done cd done "$@" $(pwd) export
+	sed done local -eu && local local
+export export printf printf 2>/dev/null sed awk cd "$1" export | sed grep export
+	${HOME} readonly "$@" 2>/dev/null echo
+sed echo -eu -eu "$@" readonly x=1
+	/usr/bin $(pwd) "$@" echo | /usr/bin ${HOME}
+then 2>/dev/null x=1 test grep cd "$@" 2>/dev/null 2>/dev/null readonly 'quoted text'
+-eu awk x=1 "$1" then --verbose --verbose
+	awk "$@" readonly --verbose
+	/usr/bin test | readonly readonly then grep
+readonly grep $(pwd) --verbose then /usr/bin cd
+| sed test sed 'quoted text' /usr/bin x=1 /usr/bin
+	readonly "$@" printf 2>/dev/null cd -eu 2>/dev/null 2>/dev/null 'quoted text'
+		$(pwd) readonly "$@" echo -eu --verbose export
+		echo done $(pwd) grep
+then cd readonly -eu then && printf local test grep /usr/bin
+awk cd readonly --verbose | sed test | grep done "$@" test x=1
+$(pwd) /usr/bin "$1" then $(pwd) sed x=1 printf 'quoted text'
+	awk readonly x=1 "$1" local printf cd "$1" 2>/dev/null
+		2>/dev/null echo export readonly 'quoted text'
+	/usr/bin export 2>/dev/null
+		2>/dev/null awk x=1 x=1 grep /usr/bin then | $(pwd) 2>/dev/null echo ${HOME}
+${HOME} "$1" then then --verbose x=1 'quoted text' printf local "$@" echo
+		export --verbose printf /usr/bin x=1
+	local "$1" done -eu test | ${HOME}
+printf $(pwd) -eu 2>/dev/null
+		grep $(pwd) printf "$@" /usr/bin 2>/dev/null
+${HOME} printf "$1" && &&
+	--verbose ${HOME} && x=1 'quoted text' awk test && 'quoted text' echo sed &&
+	"$1" export done $(pwd) export done $(pwd) awk cd |
+x=1 export echo | then --verbose ${HOME} "$@"
+readonly ${HOME} "$@" ${HOME} x=1 x=1 grep awk
+	x=1 x=1 2>/dev/null $(pwd) "$1" "$1" --verbose sed ${HOME} && "$@" then awk
+		${HOME} -eu echo grep local test 2>/dev/null "$1" 'quoted text'
+		printf 2>/dev/null "$1"
+	"$@" grep test local | readonly test | export echo --verbose ${HOME} --verbose
+		&& export cd -eu x=1 -eu local
+		sed cd local "$1" --verbose sed "$1" "$1" printf
+	grep done "$1" --verbose then $(pwd) done
+		test export 2>/dev/null done --verbose ${HOME} printf x=1 local
+--verbose /usr/bin --verbose test echo then /usr/bin
+cd grep 'quoted text' $(pwd)
+x=1 printf 2>/dev/null | local awk /usr/bin done test ${HOME} grep 'quoted text'
+local export then $(pwd)
+2>/dev/null printf echo grep x=1 echo readonly
+	done $(pwd) local echo printf $(pwd) then
+	local && 2>/dev/null readonly
+	&& grep $(pwd) "$1" x=1 sed /usr/bin && "$1" printf $(pwd) awk 2>/dev/null
+	-eu grep local awk --verbose "$@" done $(pwd) then done | export printf grep
+--verbose export done echo && echo then ${HOME}
+export test done then printf | done | readonly echo ${HOME} cd test
+		sed 'quoted text' 2>/dev/null && done printf
+	$(pwd) grep -eu test ${HOME} awk -eu 2>/dev/null
+	"$1" echo then test "$1" ${HOME}
+		local x=1 cd -eu grep "$@" x=1 done test $(pwd) -eu test | --verbose
+		printf /usr/bin echo done && $(pwd) grep
+local cd readonly 2>/dev/null export "$@" grep /usr/bin
+x=1 printf echo "$@" grep x=1 &&
+cd -eu 2>/dev/null local printf readonly then printf "$1" 2>/dev/null
+2>/dev/null $(pwd) sed then grep echo
+		cd local x=1 done x=1 export -eu 2>/dev/null "$@" | "$1" awk "$@" echo local export
+/usr/bin readonly local cd sed x=1 sed 2>/dev/null | readonly
+	${HOME} local awk 'quoted text' "$@" export
+		"$1" 'quoted text' 2>/dev/null
+		"$1" | x=1 test awk -eu "$@" x=1 2>/dev/null echo grep
+	local 'quoted text' echo
+readonly test $(pwd) local "$1"
+	x=1 export then 'quoted text' cd readonly
+	awk then sed && $(pwd) cd /usr/bin export /usr/bin
+	cd readonly /usr/bin local
+	| | "$1" "$1" echo awk cd ${HOME} printf cd done cd printf printf -eu $(pwd)
+"$1" -eu | export x=1
+echo export printf $(pwd) "$1" 2>/dev/null then x=1 readonly "$@" awk -eu then
+echo --verbose && test export test export printf done readonly readonly ${HOME}
+	x=1 done export done $(pwd) && --verbose ${HOME} export
+		echo | local 'quoted text' printf then | readonly cd
+		-eu done 'quoted text' printf ${HOME} "$1" printf --verbose
+export /usr/bin ${HOME} done grep local | printf awk printf readonly local x=1
+	cd ${HOME} local x=1 printf /usr/bin -eu echo
+x=1 x=1 -eu 'quoted text' 'quoted text'
+		"$1" awk | -eu ${HOME} sed printf && done ${HOME} /usr/bin --verbose "$@" readonly
+awk done test $(pwd) grep done /usr/bin awk printf -eu done local 2>/dev/null
+test 'quoted text' ${HOME} | x=1 && --verbose
+-eu ${HOME} grep x=1 2>/dev/null
+		readonly awk /usr/bin done export /usr/bin |
+		'quoted text' readonly --verbose sed printf
+	x=1 then sed $(pwd) grep "$1" -eu echo test --verbose /usr/bin x=1 awk
+		grep export echo $(pwd) 2>/dev/null 2>/dev/null
+		/usr/bin --verbose local "$1" --verbose
+done readonly $(pwd) then export /usr/bin --verbose "$1" then awk -eu "$@"
+awk grep done ${HOME} 2>/dev/null "$1" echo done done cd then awk "$1" --verbose
+	/usr/bin --verbose test then "$@" "$1" done
+/usr/bin sed cd printf 2>/dev/null echo /usr/bin
+| "$@" printf ${HOME} echo 2>/dev/null && -eu sed done --verbose | sed awk
+	"$1" 'quoted text' $(pwd) 2>/dev/null sed cd x=1 /usr/bin echo grep
+	local sed --verbose readonly then awk done test test echo done done grep
+		readonly cd cd "$@" --verbose /usr/bin test | 'quoted text' 2>/dev/null
+		"$1" && awk x=1 export x=1 | grep test | test | printf
+	"$@" /usr/bin ${HOME} local 'quoted text' ${HOME} readonly $(pwd) awk
+	grep done -eu cd "$1" $(pwd) then --verbose local printf
+		| grep export --verbose "$@" x=1 /usr/bin readonly then "$1" | "$1" test grep
+	&& then 2>/dev/null | cd /usr/bin && x=1 && sed grep export
+	then "$1" cd printf awk | then local test export ${HOME} grep
+test test $(pwd) "$@" echo $(pwd) grep done test $(pwd)
+readonly | --verbose /usr/bin x=1 then then printf
+	| x=1 grep printf done sed awk printf cd awk
+local then awk | --verbose "$@" -eu export "$@" 2>/dev/null && $(pwd) printf "$@"
+done x=1 2>/dev/null then sed $(pwd) x=1 cd 'quoted text'
+		'quoted text' cd ${HOME} "$1" export sed grep
+	sed done && "$@" "$1"
+/usr/bin printf readonly 2>/dev/null sed awk "$@"
+--verbose 2>/dev/null then 2>/dev/null "$1" | then --verbose
+	-eu -eu readonly /usr/bin done readonly /usr/bin "$1" $(pwd)
+	'quoted text' readonly -eu x=1 done awk | ${HOME} -eu echo then sed readonly grep
+2>/dev/null sed "$@" 2>/dev/null
+export $(pwd) test ${HOME} export && /usr/bin echo x=1 x=1 grep -eu echo readonly
+		"$@" -eu cd sed && echo $(pwd) printf printf 'quoted text' --verbose --verbose
+	${HOME} | printf sed awk && -eu export test 'quoted text'
+	cd 2>/dev/null x=1 readonly cd test $(pwd)
+${HOME} then test "$1" cd cd | export sed export cd local
+	cd done local awk --verbose
+		echo local done "$1" "$@" ${HOME} sed awk local | awk export | $(pwd) then awk
+		| echo printf test $(pwd) export local "$1" --verbose
+	--verbose awk sed awk test && sed echo
+	"$@" local cd 2>/dev/null --verbose
+	&& echo $(pwd) -eu test --verbose "$@" test local | "$@" done then local
+	/usr/bin sed export -eu sed x=1 local then test --verbose
+'quoted text' $(pwd) --verbose /usr/bin && sed printf readonly echo
+		'quoted text' readonly | "$1" --verbose grep
+		done readonly cd test && done printf then 'quoted text' ${HOME}
+		--verbose "$1" export --verbose ${HOME} then x=1 'quoted text' "$1" done
+		--verbose grep sed --verbose | then export echo test
+	cd then readonly --verbose 'quoted text'
+		sed x=1 cd printf && 2>/dev/null "$@" | | awk
+		done "$@" awk 2>/dev/null awk
+'quoted text' 'quoted text' | sed && export local done
+	"$@" && then echo && printf 2>/dev/null "$1" --verbose
+	printf then x=1 then export && local awk
+	echo && && 'quoted text' /usr/bin readonly $(pwd)
+		done $(pwd) awk test x=1 test export --verbose -eu test --verbose
+	grep awk /usr/bin 2>/dev/null
+	&& "$1" echo sed ${HOME} "$1" x=1 local -eu grep test echo /usr/bin
+local sed export && ${HOME} | 'quoted text' 'quoted text'
+	&& x=1 export $(pwd) sed then printf
+local readonly ${HOME} sed then && | "$1" /usr/bin
+	export cd 'quoted text' "$1" sed | | && --verbose done $(pwd)
+readonly && "$1" awk && export export done ${HOME} $(pwd)
+x=1 then printf done 'quoted text' readonly cd then "$@"
+		-eu -eu 'quoted text' sed test echo cd $(pwd) readonly
+	test done --verbose "$@" then export
+$(pwd) awk readonly echo awk readonly printf
+test ${HOME} awk 2>/dev/null
+		$(pwd) readonly --verbose export local awk
+cd grep awk test echo done sed "$@" 2>/dev/null
+export export export grep --verbose export sed test && test local
+	'quoted text' grep ${HOME}
+	printf $(pwd) cd grep printf
+		${HOME} done then && test | export printf && -eu
+	'quoted text' "$@" grep "$@" awk
+		| 'quoted text' 2>/dev/null x=1 /usr/bin && && "$1" printf sed x=1 cd done $(pwd)
+	export "$@" readonly echo done cd export x=1 cd export 'quoted text' cd done
+	| grep --verbose export && --verbose
+	$(pwd) readonly cd cd echo test 2>/dev/null ${HOME} x=1 $(pwd)
+	local local 2>/dev/null cd awk 2>/dev/null awk sed export
+		export awk "$1" awk 'quoted text' -eu test "$1" readonly
+		/usr/bin /usr/bin -eu 'quoted text' echo echo
+		| printf 'quoted text' awk local done printf echo awk cd grep
+sed "$1" x=1 sed /usr/bin readonly -eu done readonly test done --verbose
+		echo ${HOME} test grep then 'quoted text' done
+	sed x=1 'quoted text' "$1"
+	x=1 awk -eu "$@" export x=1 echo
+done grep test sed printf done 'quoted text' local "$1" "$@" $(pwd) -eu test
+	'quoted text' printf && done 'quoted text' ${HOME} "$1" 2>/dev/null
+done test && then -eu "$@" local
+		-eu "$@" -eu sed 'quoted text'
+echo done x=1 then "$@" 2>/dev/null
+	${HOME} | && "$@" local printf ${HOME} sed 2>/dev/null test awk
+${HOME} echo test echo
+		local awk test printf 2>/dev/null
+	awk "$@" then echo echo && local /usr/bin export | awk && sed
+echo "$1" ${HOME} awk "$1" ${HOME} local /usr/bin test test grep
+		readonly awk printf 2>/dev/null | printf 2>/dev/null 'quoted text'
+	"$@" readonly /usr/bin grep
+"$@" x=1 done /usr/bin x=1 done export "$@"
+		$(pwd) local readonly 2>/dev/null
+		/usr/bin | printf printf | grep $(pwd) printf "$1" "$@"
+	test test export | 2>/dev/null 'quoted text'
+	"$1" && 'quoted text' sed grep
+	x=1 readonly test export done /usr/bin
+		'quoted text' "$@" grep awk x=1 grep x=1 /usr/bin
+sed readonly export local readonly ${HOME} readonly sed
+		-eu && cd done "$@" -eu readonly x=1 readonly local "$@" done
+	--verbose printf echo x=1 /usr/bin sed awk done awk
+	"$@" done export /usr/bin "$1" printf printf "$@" -eu cd --verbose local
+	done test test -eu readonly 2>/dev/null 2>/dev/null awk
+--verbose readonly done "$1" then printf "$@"
+		x=1 done echo 'quoted text' 'quoted text' readonly export export && -eu export readonly
+		&& export -eu done 2>/dev/null --verbose $(pwd) export
+local --verbose "$@" $(pwd) test |
+"$@" echo echo awk export
+	--verbose grep readonly local "$1" && $(pwd) readonly grep awk -eu "$@" then
+	echo readonly done then x=1 readonly | ${HOME}
+	2>/dev/null sed done --verbose /usr/bin ${HOME} && then sed && done ${HOME}
+		echo $(pwd) /usr/bin /usr/bin --verbose 2>/dev/null grep $(pwd)
+-eu -eu cd done cd 2>/dev/null
+		$(pwd) grep readonly grep printf | export --verbose
+		/usr/bin echo then then done --verbose $(pwd) --verbose 2>/dev/null
+	export sed --verbose ${HOME} -eu /usr/bin
+		${HOME} | test --verbose 'quoted text' -eu local /usr/bin -eu
+'quoted text' -eu done ${HOME} 'quoted text' cd $(pwd) awk
+2>/dev/null echo sed local
+		printf export && ${HOME} echo /usr/bin echo readonly readonly done
+'quoted text' 'quoted text' -eu export grep
+	2>/dev/null export test local grep x=1 x=1 $(pwd) readonly
+-eu readonly 'quoted text' done done $(pwd) -eu --verbose ${HOME} echo "$1" then
+cd $(pwd) "$@" /usr/bin export --verbose awk ${HOME}
+done $(pwd) export test sed local echo /usr/bin echo
+| local "$1" done x=1 printf
+		test --verbose "$1" | test 2>/dev/null
+--verbose cd ${HOME} $(pwd) test local awk echo printf sed
+		readonly /usr/bin local local "$@" grep awk "$1" -eu readonly cd /usr/bin
+-eu | local ${HOME} 2>/dev/null "$@" sed then --verbose "$1" /usr/bin
+		printf 2>/dev/null sed | x=1 "$1" printf -eu printf --verbose awk 2>/dev/null
+		export export -eu --verbose sed then grep then
+	-eu readonly export readonly --verbose $(pwd) -eu
+	'quoted text' "$@" echo local export grep grep
+	x=1 done readonly done ${HOME} readonly "$@" sed "$@" x=1 "$1" 'quoted text' "$1"
+--verbose test local "$@"
+		cd 'quoted text' --verbose awk grep "$@" then test done export sed ${HOME}
+		'quoted text' "$1" && then 2>/dev/null ${HOME} sed done
+	then "$1" | sed | "$1" test 'quoted text' test local -eu echo export then /usr/bin
+	| then -eu x=1 echo ${HOME} readonly readonly
+		test done grep cd && grep
+done printf && "$1" test "$@" local export --verbose
+	printf done $(pwd) then readonly awk /usr/bin $(pwd) grep -eu
+	"$@" test 2>/dev/null --verbose printf | /usr/bin test readonly then
+		$(pwd) | && -eu -eu local 2>/dev/null 2>/dev/null
+	export awk x=1 | sed -eu x=1 done
+	/usr/bin ${HOME} readonly |
+2>/dev/null cd done then readonly /usr/bin test && x=1 export ${HOME}
+	cd $(pwd) cd ${HOME} ${HOME}
+		"$1" cd sed echo 'quoted text'
+"$1" x=1 readonly done --verbose /usr/bin done printf done ${HOME}
+| sed 'quoted text' $(pwd) cd --verbose export | "$1"
+		cd /usr/bin echo then "$@" export 'quoted text' local 'quoted text'
+	echo "$@" echo echo /usr/bin local local $(pwd) x=1 done then cd
+		then sed "$@" 'quoted text' | then "$@" local x=1 "$@" awk readonly
+	"$1" | readonly /usr/bin then printf
+	grep printf then local
+"$@" /usr/bin awk test ${HOME} 2>/dev/null
+cd done printf done /usr/bin 'quoted text' /usr/bin x=1 cd grep 'quoted text'
+'quoted text' awk $(pwd)
+	| && && done export printf readonly test
+		grep --verbose ${HOME} echo local $(pwd) -eu export export
+		"$@" 2>/dev/null | 'quoted text' echo local then x=1 test
+		grep "$1" done export cd /usr/bin cd export
+cd awk x=1 | export --verbose test && grep && then export
+readonly $(pwd) then $(pwd) | grep "$@" echo then readonly echo &&
+| /usr/bin /usr/bin 2>/dev/null
+		2>/dev/null $(pwd) sed -eu $(pwd) test $(pwd) grep /usr/bin done 2>/dev/null
+export -eu x=1 local | done test grep 2>/dev/null
+"$@" $(pwd) $(pwd) x=1
+	/usr/bin cd /usr/bin $(pwd) echo
+x=1 --verbose echo sed ${HOME} export ${HOME} awk echo "$@" printf "$1" done
+cd 2>/dev/null cd $(pwd) 2>/dev/null -eu | 2>/dev/null
+then awk then cd -eu awk x=1
+	local awk && test awk 'quoted text'
+		x=1 test awk --verbose && echo 2>/dev/null sed export
+echo printf && sed -eu && test printf awk awk echo "$1"
+	| readonly $(pwd) export sed echo readonly /usr/bin export then printf export ${HOME}
+$(pwd) test local -eu printf /usr/bin export
+	-eu --verbose 2>/dev/null export grep
+test 2>/dev/null | ${HOME} 'quoted text'
+	printf done 2>/dev/null readonly 2>/dev/null
+	done --verbose --verbose grep readonly
+"$@" "$1" awk export "$1" ${HOME} grep ${HOME} -eu test echo ${HOME} then
+&& echo grep -eu printf export export test "$1" ${HOME} "$@" then 2>/dev/null
+		"$@" x=1 "$@" sed sed printf -eu --verbose awk $(pwd) grep x=1 "$@" | ${HOME} "$@"
+		readonly test readonly 'quoted text' test x=1 ${HOME}
+	awk then then | && then | readonly sed echo /usr/bin /usr/bin
+printf cd test "$@" done awk readonly /usr/bin grep ${HOME} $(pwd) echo done x=1
+		test 'quoted text' x=1 grep sed readonly --verbose awk echo -eu readonly
+	-eu printf grep local cd "$1" "$1" -eu && 2>/dev/null
+	| -eu $(pwd) 2>/dev/null grep $(pwd) grep
+grep ${HOME} grep grep export $(pwd) --verbose $(pwd)
+	readonly ${HOME} sed done && readonly sed then then ${HOME} x=1 2>/dev/null x=1
+printf printf grep x=1 2>/dev/null done echo
+--verbose --verbose $(pwd) cd readonly $(pwd) then | readonly
+	echo "$1" export echo 2>/dev/null awk echo -eu
+	test test --verbose test grep printf
+then /usr/bin test test test test | cd 'quoted text' grep "$1"
+awk --verbose "$1" sed
+	readonly echo done ${HOME} x=1 done
+		grep -eu "$1" grep then then printf cd test
+	2>/dev/null | then && readonly -eu && x=1 cd local "$@" --verbose
+	--verbose cd 'quoted text'
+	-eu awk 2>/dev/null 'quoted text' $(pwd) cd sed export ${HOME} readonly --verbose
+		| grep then readonly --verbose
+grep cd ${HOME} --verbose
+		test echo && /usr/bin 'quoted text' $(pwd) 2>/dev/null
+done --verbose $(pwd) -eu readonly awk local cd /usr/bin readonly done local
+	test test "$@" "$@" then ${HOME}
+done --verbose x=1 "$1" "$1" ${HOME} readonly
+	done /usr/bin cd 2>/dev/null grep printf "$1" export $(pwd)
+x=1 2>/dev/null done -eu 'quoted text' printf cd /usr/bin
+/usr/bin awk awk echo done
+		test 2>/dev/null -eu $(pwd) 'quoted text' then then then /usr/bin --verbose
+		export "$1" grep "$1" cd -eu sed test printf -eu --verbose /usr/bin
+	'quoted text' && grep && then export awk --verbose | cd local
+grep printf done ${HOME} 2>/dev/null printf --verbose ${HOME} test done echo
+/usr/bin awk x=1 ${HOME} grep x=1 then
+"$1" 2>/dev/null export printf local printf
+	2>/dev/null awk then "$1" "$1"
+	--verbose printf ${HOME} readonly x=1 x=1 test echo /usr/bin | then
+2>/dev/null "$@" local echo test done export export x=1 sed $(pwd) grep then | 2>/dev/null
+		-eu local printf x=1 export | 'quoted text' /usr/bin 2>/dev/null
+test /usr/bin done 2>/dev/null printf ${HOME} | "$1"
+echo 2>/dev/null -eu grep
+	test 'quoted text' -eu --verbose "$@" local cd then | readonly
+'quoted text' test "$1" ${HOME}
+	local $(pwd) "$@" 'quoted text'
+		cd grep readonly sed "$1" && $(pwd) cd local ${HOME} x=1 export 2>/dev/null
+	cd awk printf then -eu /usr/bin
+		readonly readonly printf x=1 && | "$@" 'quoted text' 'quoted text' 2>/dev/null
+| echo cd "$1" sed 'quoted text' -eu done /usr/bin $(pwd)
+	/usr/bin | "$1" x=1 grep then printf echo $(pwd) | "$1" /usr/bin | grep test
+		export && x=1 sed ${HOME} /usr/bin $(pwd) then --verbose local printf
+| then echo test "$1" test done
+		&& && echo then awk printf
+x=1 /usr/bin awk sed sed export
+	"$1" "$@" x=1 echo && $(pwd) sed "$@" && /usr/bin 'quoted text'
+		printf ${HOME} 2>/dev/null export --verbose then echo "$@" -eu
+		| "$@" sed done /usr/bin grep 'quoted text' printf sed then "$@" local
+	| -eu --verbose echo -eu x=1 'quoted text' 2>/dev/null
+	"$@" grep echo test grep test | readonly && local printf local "$@" local cd
+		/usr/bin $(pwd) grep then test sed 2>/dev/null
+	-eu -eu sed 'quoted text' /usr/bin sed && done
+	/usr/bin echo readonly /usr/bin x=1 'quoted text'
+| x=1 --verbose "$@" local --verbose
+	test /usr/bin | /usr/bin $(pwd) export readonly --verbose | $(pwd) | | 'quoted text'
+	grep 'quoted text' 2>/dev/null ${HOME} grep grep /usr/bin cd "$1" readonly
+		awk local /usr/bin $(pwd) test ${HOME}
+	-eu $(pwd) grep test printf then 'quoted text' done echo sed $(pwd) sed
+	/usr/bin | local $(pwd) && echo $(pwd) $(pwd) local
+cd $(pwd) "$@" | x=1 2>/dev/null && "$@" -eu ${HOME} ${HOME} 2>/dev/null
+	"$1" "$1" ${HOME} 'quoted text' sed "$1" ${HOME} test x=1
+done x=1 -eu awk "$1" printf echo $(pwd) 2>/dev/null
+	local readonly cd sed test
+		grep sed printf test sed /usr/bin cd then local x=1 | /usr/bin export && cd printf
+done $(pwd) done grep grep then
+	${HOME} /usr/bin && cd ${HOME} --verbose awk 'quoted text' && export
+	"$@" && "$@" readonly $(pwd) "$1" sed -eu export $(pwd)
+	awk done $(pwd) --verbose local readonly "$1" printf "$1"
+	then sed done export sed printf 'quoted text' /usr/bin
+/usr/bin "$1" grep awk &&
+| grep done readonly done "$@" 2>/dev/null /usr/bin -eu echo sed
+	"$1" 2>/dev/null $(pwd) export $(pwd)
+awk sed grep then --verbose
+	awk awk local local "$1" --verbose "$@"
+		then printf sed readonly --verbose
+		cd x=1 sed $(pwd) -eu printf "$1" && cd local cd then printf readonly echo echo
+"$1" x=1 readonly | local readonly done 2>/dev/null "$@"
+"$1" printf -eu x=1 /usr/bin --verbose then test
+	awk --verbose "$@" -eu x=1 printf 'quoted text' 'quoted text'
+		&& "$@" awk "$1" "$@" "$@" readonly local | "$@"
+	done "$1" test && && test local x=1 printf local
+		/usr/bin /usr/bin done --verbose export x=1 cd test /usr/bin awk | echo then
+	2>/dev/null -eu echo local "$@" $(pwd) local
+	test then local $(pwd) $(pwd) "$@" ${HOME}
+		/usr/bin awk x=1 'quoted text' done | "$1" x=1 "$1" cd
+		"$1" && awk printf 'quoted text' $(pwd) "$1" "$1" $(pwd) readonly "$@" -eu sed
+		2>/dev/null --verbose cd 2>/dev/null ${HOME} cd "$1" readonly "$1"
+	| awk | "$@" ${HOME} printf printf -eu then ${HOME}
+'quoted text' x=1 ${HOME}
+	'quoted text' x=1 done local 'quoted text'
+	"$1" then printf awk printf
+		printf test readonly "$1" test
+		| | 'quoted text' ${HOME} $(pwd) test sed cd x=1 /usr/bin readonly $(pwd) local
+	echo -eu grep 'quoted text' then -eu
+	test ${HOME} --verbose then printf cd | --verbose 2>/dev/null
+-eu "$1" 2>/dev/null | done -eu done printf | && then
+		readonly | -eu /usr/bin test
+		"$@" "$@" "$1" grep -eu awk 2>/dev/null done awk
+export cd readonly --verbose awk "$@" awk then cd awk ${HOME} local -eu
+	export "$1" 'quoted text' ${HOME} test
+	&& && done 'quoted text'
+printf export $(pwd) awk
+		export "$1" "$1" "$@" sed "$@" readonly grep test sed readonly $(pwd)
+	${HOME} done test ${HOME} readonly 2>/dev/null printf "$1"
+readonly local sed test -eu ${HOME} -eu && grep
+		'quoted text' | /usr/bin
+readonly /usr/bin 2>/dev/null sed x=1 awk printf printf local export ${HOME}
+		printf 'quoted text' test local export 2>/dev/null
+done cd -eu ${HOME} -eu 2>/dev/null 'quoted text' x=1
+	'quoted text' cd local then
+	export awk 'quoted text' --verbose readonly local ${HOME}
+"$@" printf done printf export
+	sed x=1 "$1" && | "$@" x=1 "$@" /usr/bin awk awk echo awk then
+then -eu done $(pwd) x=1 echo export
+	/usr/bin /usr/bin cd "$@" ${HOME}
+	$(pwd) && 2>/dev/null readonly cd "$@" local $(pwd) awk 'quoted text'
+		test /usr/bin export -eu && $(pwd) done "$1"
+"$@" && $(pwd) readonly && | local | "$@" awk local sed $(pwd) echo
+	test -eu -eu /usr/bin printf 'quoted text' echo --verbose test then
+		local local done 'quoted text' /usr/bin
+	test export 2>/dev/null /usr/bin then then "$@" "$1"
+		done $(pwd) --verbose && "$@" test x=1 2>/dev/null
+	export --verbose printf | -eu 'quoted text' ${HOME} awk grep "$@" awk x=1 export
+	cd printf --verbose local
+	readonly printf export grep grep $(pwd) 2>/dev/null local && --verbose | 'quoted text'
+echo $(pwd) local export export sed | grep readonly x=1 test
+	then done x=1 -eu echo && 'quoted text' cd -eu printf
+		"$@" "$1" grep sed export
+	then then grep export "$1" 'quoted text' cd awk grep --verbose 'quoted text'
+	awk readonly ${HOME} /usr/bin
+		export $(pwd) $(pwd) then done cd export $(pwd)
+		cd "$@" test printf readonly test "$1" 2>/dev/null
+	sed test readonly sed 'quoted text' 'quoted text' done 2>/dev/null
+/usr/bin /usr/bin readonly
+		--verbose local -eu $(pwd) local 'quoted text'
+	2>/dev/null sed $(pwd) export "$1" printf x=1 2>/dev/null
+		test 2>/dev/null cd then "$1" --verbose test --verbose cd x=1 $(pwd) 2>/dev/null
+	local /usr/bin 2>/dev/null test 'quoted text' awk $(pwd) printf
+	2>/dev/null local local && cd "$@" x=1 grep ${HOME} export 2>/dev/null
+	readonly 2>/dev/null --verbose echo
+	export done "$@" local cd "$@" "$1" echo awk awk
+		done "$1" -eu x=1 -eu --verbose readonly export && | done export done ${HOME}
+	grep test x=1 sed 2>/dev/null "$1" x=1
+readonly $(pwd) "$1" --verbose export
+done local -eu awk -eu "$@"
+	&& x=1 readonly test | then 'quoted text' done "$@"
+		-eu ${HOME} --verbose then local ${HOME} "$@" export grep | then --verbose ${HOME}
+		| readonly /usr/bin "$1" echo | readonly |
+x=1 done grep "$@" ${HOME} awk 'quoted text'
+	cd | x=1 test 'quoted text' ${HOME} 2>/dev/null done $(pwd) "$@" export
+	/usr/bin 2>/dev/null printf /usr/bin x=1 readonly -eu "$1" 2>/dev/null
+'quoted text' x=1 2>/dev/null
+		&& cd && printf test x=1 /usr/bin 'quoted text'
+	grep /usr/bin awk ${HOME} && sed readonly 'quoted text' ${HOME} local grep echo
+	| sed test 'quoted text' done /usr/bin grep $(pwd)
+		--verbose cd && cd $(pwd) ${HOME} $(pwd) &&
+		sed $(pwd) then 'quoted text' | /usr/bin "$@" | 2>/dev/null sed sed x=1 | --verbose
+done -eu grep ${HOME} 2>/dev/null 2>/dev/null /usr/bin
+	test 'quoted text' export local grep x=1 then awk "$1" grep sed
+grep cd cd 2>/dev/null /usr/bin local done -eu "$@" 'quoted text' grep "$@"
+2>/dev/null | -eu x=1 "$1" printf x=1 export local
+	'quoted text' export --verbose awk local local sed
+		readonly export "$1" awk ${HOME} | readonly printf awk then $(pwd) 'quoted text'
+	"$1" echo | ${HOME} 'quoted text' echo done --verbose
+$(pwd) printf -eu echo cd /usr/bin cd cd /usr/bin -eu printf -eu
+-eu 2>/dev/null x=1 ${HOME} readonly
+awk done done "$1" $(pwd) "$@" printf 'quoted text' cd && -eu --verbose
+	2>/dev/null | ${HOME} 'quoted text'
+		$(pwd) $(pwd) awk echo 'quoted text' sed ${HOME}
+		--verbose test awk 'quoted text' then printf test
+	echo "$1" local "$1" readonly printf cd x=1 printf ${HOME} test /usr/bin
+	x=1 sed export 2>/dev/null sed test awk awk "$1" test
+--verbose 'quoted text' printf local cd "$1" && /usr/bin then
+awk "$1" grep grep $(pwd)
+&& grep test local then test 'quoted text' awk ${HOME} "$1"
+	-eu export awk --verbose "$@" readonly readonly
+	-eu 'quoted text' "$1"
+-eu x=1 local printf && -eu $(pwd) awk ${HOME} done 'quoted text' | && awk
+	$(pwd) grep "$1" 2>/dev/null then --verbose
+		then export | sed /usr/bin
+		${HOME} ${HOME} done $(pwd)
+	"$@" grep x=1 grep echo "$@" done ${HOME} 2>/dev/null "$@" done
+	grep local test awk "$@" then readonly awk grep | $(pwd) grep "$1" "$1"
+		local sed local "$1" done $(pwd) printf printf readonly sed cd ${HOME} $(pwd)
+cd 'quoted text' --verbose done /usr/bin
+'quoted text' cd 2>/dev/null 2>/dev/null -eu cd echo
+		printf local $(pwd) printf ${HOME} "$@" 2>/dev/null test && readonly "$@" /usr/bin
+		x=1 readonly sed "$@" sed && /usr/bin ${HOME} --verbose echo
+		test readonly 2>/dev/null $(pwd) printf export grep
+sed grep $(pwd) test -eu /usr/bin | grep export sed -eu
+	local /usr/bin readonly
+readonly awk "$1" 'quoted text' ${HOME} done "$1" x=1 then -eu 2>/dev/null
+$(pwd) awk echo echo export then done then /usr/bin $(pwd)
+&& export awk echo test export done "$@" /usr/bin awk
+		${HOME} export /usr/bin 2>/dev/null cd && printf -eu done
+		/usr/bin test | "$1" -eu
+	-eu grep --verbose /usr/bin "$@" local "$@" $(pwd) readonly test then ${HOME} sed
+		done export done --verbose grep
+		2>/dev/null && $(pwd) then cd "$@" |
+		readonly 2>/dev/null cd /usr/bin --verbose "$1" local -eu 'quoted text'
+		/usr/bin "$@" ${HOME} "$1" export "$@" cd test then echo /usr/bin 2>/dev/null
+		printf "$1" export done echo | then sed sed export | readonly awk
+	local local 'quoted text' -eu | "$@" | grep $(pwd) && printf
+"$@" && | grep /usr/bin echo --verbose sed then $(pwd)
+		printf then "$1" $(pwd) sed "$@" $(pwd) printf cd cd printf --verbose
+	sed x=1 readonly && readonly test "$1" export cd 2>/dev/null awk echo
+		readonly && --verbose echo 'quoted text' 2>/dev/null
+		2>/dev/null cd 2>/dev/null -eu readonly x=1 done echo cd echo
+'quoted text' then $(pwd) printf | ${HOME} x=1 printf 'quoted text'
+${HOME} $(pwd) done --verbose then /usr/bin
+		2>/dev/null local grep && "$@" cd && sed ${HOME} sed --verbose
+		&& && local grep done echo "$@" | "$1"
+		readonly readonly ${HOME} && test -eu echo echo local 2>/dev/null
+		readonly 2>/dev/null && printf
+	echo grep sed echo $(pwd) && --verbose
+	export | local x=1 awk --verbose "$@" $(pwd)
+export done x=1 export "$@" && 2>/dev/null
+readonly grep readonly awk "$@" sed
+		'quoted text' "$1" && 2>/dev/null
+	'quoted text' "$1" then | ${HOME} -eu readonly --verbose
+"$1" /usr/bin grep local grep "$1" 2>/dev/null
+	"$1" "$@" 2>/dev/null echo | done then grep 2>/dev/null --verbose
+		readonly grep then $(pwd) awk
+$(pwd) grep 'quoted text' -eu "$1" "$1" /usr/bin export printf done
+		$(pwd) done "$1" x=1 printf readonly cd /usr/bin sed /usr/bin |
+awk done --verbose readonly 'quoted text' && --verbose local test 2>/dev/null
+		then && ${HOME} ${HOME} export 'quoted text' test printf local
+		then "$@" done export "$1" | "$@" x=1
+export "$1" local 'quoted text'
+	/usr/bin local sed grep x=1 && grep 2>/dev/null "$@" printf done done "$@" /usr/bin
+	sed awk 'quoted text' x=1 -eu | then 2>/dev/null echo readonly
+	${HOME} $(pwd) /usr/bin "$@" 2>/dev/null export ${HOME} then test printf
+printf 2>/dev/null echo x=1 x=1 readonly
+&& x=1 --verbose done awk "$1" awk test printf /usr/bin
+		done 'quoted text' echo && then ${HOME} done awk readonly "$1" "$@" local 2>/dev/null
+done -eu 'quoted text' 2>/dev/null readonly then echo export awk $(pwd)
+grep printf awk done x=1 grep echo $(pwd) test
+	test grep "$@" then awk 'quoted text' done test sed "$1" $(pwd) "$@" export 2>/dev/null
+	awk sed -eu 'quoted text' | done echo
+cd done $(pwd) then 2>/dev/null x=1
+	echo awk cd $(pwd) sed --verbose /usr/bin x=1 cd $(pwd)
+	done awk local $(pwd) grep cd
+test $(pwd) --verbose $(pwd) "$@" echo 'quoted text' done
+		--verbose "$@" ${HOME} export printf x=1
+	awk && x=1 "$@" "$@" 'quoted text'
+		| readonly printf then ${HOME} "$1" "$@" test awk $(pwd) ${HOME} export
+done echo 2>/dev/null | awk awk grep awk --verbose then 2>/dev/null
+		--verbose echo -eu 2>/dev/null readonly 'quoted text' && 2>/dev/null
+		local export printf -eu sed local
+	x=1 local then then test readonly readonly
+awk -eu | ${HOME} -eu readonly && | echo cd export ${HOME}
+readonly -eu cd grep 2>/dev/null done /usr/bin && cd && grep
+	$(pwd) ${HOME} "$1" ${HOME} "$1" readonly cd "$1" --verbose
+		cd then echo then cd && $(pwd) printf | --verbose readonly "$1" 2>/dev/null
+	"$1" done sed | cd awk local --verbose cd then test test | --verbose 2>/dev/null
+		readonly awk cd echo | cd cd done cd
+	cd -eu export $(pwd) readonly
+		readonly sed 2>/dev/null --verbose && $(pwd) grep --verbose done sed
+	awk cd awk cd --verbose
+		printf echo test "$1" printf
+2>/dev/null readonly done printf "$1" && $(pwd) cd export $(pwd) "$@" export -eu
+		done $(pwd) && sed sed local sed x=1 "$1" "$1" readonly export sed
+	"$@" cd x=1 cd $(pwd) ${HOME} cd ${HOME} cd 'quoted text'
+-eu sed -eu awk echo && -eu "$1" then /usr/bin --verbose | "$1" grep then awk
+	then $(pwd) x=1 ${HOME} export ${HOME}
+		-eu export x=1 cd awk && export export
+		-eu test && "$@" cd 2>/dev/null ${HOME} test 'quoted text' 'quoted text'
+		| && ${HOME} grep awk --verbose then then
+		grep x=1 then local then done
+| sed local printf awk then readonly sed 'quoted text' ${HOME}
+		2>/dev/null printf 'quoted text' local
+done grep readonly /usr/bin "$1" "$@" && readonly 2>/dev/null --verbose "$@"
+	export 'quoted text' --verbose printf x=1 --verbose cd "$@" then "$1" local
+	readonly | awk --verbose test
+	--verbose 'quoted text'
+then local local | sed "$1" 2>/dev/null then sed readonly local
+	awk /usr/bin done then | export $(pwd) printf cd sed
+	then ${HOME} && x=1 test printf cd done /usr/bin 2>/dev/null
+/usr/bin ${HOME} local done
+		export grep then awk echo "$1" test /usr/bin then sed
+		2>/dev/null -eu "$1" ${HOME} grep --verbose sed export --verbose test 'quoted text'
+		$(pwd) local | cd done cd test sed done export ${HOME} echo
+	cd --verbose sed && | 'quoted text'
+then test 2>/dev/null | 'quoted text' ${HOME} | awk
+		${HOME} done /usr/bin done export 2>/dev/null x=1 && printf && awk sed 2>/dev/null
+		export printf -eu "$1" export readonly printf -eu cd echo echo test
+2>/dev/null --verbose "$@"
+awk --verbose done sed grep 'quoted text' grep
+	export local done printf echo $(pwd) echo local
+		done /usr/bin "$1" ${HOME} -eu local printf
+		--verbose echo 2>/dev/null readonly export export 2>/dev/null -eu then 'quoted text'
+		'quoted text' test export then printf "$@" --verbose
+	| "$1" | x=1 2>/dev/null "$1" -eu &&
+	sed x=1 x=1 readonly readonly x=1 test --verbose
+	${HOME} sed | readonly $(pwd) test -eu |
+readonly cd then 'quoted text' then export then done "$1" done then done
+'quoted text' sed export && && --verbose 2>/dev/null cd 2>/dev/null
+	${HOME} awk then done local test ${HOME} | 'quoted text'
+	local done | local 'quoted text' readonly 'quoted text'
+"$@" readonly echo --verbose
+		local x=1 "$@" sed done | "$1"
+		x=1 2>/dev/null "$@" cd then export readonly then 'quoted text'
+		local x=1 'quoted text' sed awk done awk done local
+cd readonly export 'quoted text'
+	$(pwd) echo 'quoted text' echo 2>/dev/null 2>/dev/null
+		'quoted text' echo grep 2>/dev/null "$@" 'quoted text' test "$@" awk "$@" grep test
+	--verbose awk export ${HOME} echo
+	test then then $(pwd) export && --verbose
+		-eu done --verbose ${HOME} awk && $(pwd) awk local cd echo /usr/bin ${HOME} cd
+		cd export $(pwd) sed awk 2>/dev/null sed && | printf 2>/dev/null
+	-eu | echo grep readonly -eu --verbose then done x=1 2>/dev/null then 'quoted text'
+		2>/dev/null export --verbose printf 'quoted text'
+'quoted text' $(pwd) && $(pwd) grep done grep local && | test | then awk /usr/bin
+	--verbose awk ${HOME} ${HOME} "$1"
+done export /usr/bin && awk /usr/bin 2>/dev/null
+		${HOME} ${HOME} | then "$1" |
+	export printf printf /usr/bin grep grep --verbose | "$@" sed
+then | 2>/dev/null export /usr/bin /usr/bin "$1"
+		$(pwd) /usr/bin 'quoted text'
+	x=1 echo done grep && "$1" ${HOME}
+	${HOME} $(pwd) "$@" ${HOME} x=1 cd then /usr/bin printf && cd awk cd test /usr/bin
+done "$@" readonly ${HOME} grep x=1 readonly /usr/bin --verbose then cd test
+	&& $(pwd) -eu ${HOME} ${HOME}
+	then printf --verbose local test done ${HOME}
+-eu "$@" local done 'quoted text' export done
+cd "$@" -eu awk printf sed
+		printf echo | $(pwd) -eu $(pwd) /usr/bin --verbose readonly $(pwd)
+2>/dev/null test $(pwd)
+	awk "$@" && done done /usr/bin echo "$1" 2>/dev/null 'quoted text' test "$1"
+printf done $(pwd) 2>/dev/null
+		${HOME} printf 'quoted text' "$1" local /usr/bin -eu 'quoted text' /usr/bin
+	"$1" /usr/bin readonly --verbose "$1" grep -eu echo | export
+awk done 2>/dev/null 'quoted text' grep /usr/bin echo printf 2>/dev/null
+		grep awk ${HOME} export sed "$1" ${HOME} sed
+sed test local --verbose --verbose | $(pwd) && test && | $(pwd) $(pwd)
+	2>/dev/null readonly 2>/dev/null ${HOME} ${HOME} "$@" x=1 grep
+done -eu done cd printf x=1 test printf
+		/usr/bin x=1 ${HOME} x=1 printf $(pwd) 'quoted text'
+| sed /usr/bin /usr/bin && local --verbose local awk grep $(pwd) readonly 'quoted text'
+		"$@" /usr/bin /usr/bin done --verbose
+		local sed x=1 then /usr/bin local "$@" local && x=1 readonly
+		grep grep readonly "$1" 2>/dev/null x=1 test 2>/dev/null test $(pwd)
+${HOME} -eu 'quoted text' 'quoted text' readonly | echo local local grep
+&& 'quoted text' done | export $(pwd) | test 'quoted text'
+	--verbose --verbose "$1" readonly x=1 --verbose | printf ${HOME} printf --verbose
+		--verbose export "$@" | --verbose
+		"$@" -eu ${HOME} then | | test export echo $(pwd) readonly echo local /usr/bin
+x=1 awk local | /usr/bin --verbose awk cd then awk && done
+		"$@" /usr/bin cd awk then echo | echo | then "$@"
+		-eu echo "$1" grep /usr/bin $(pwd) done "$1"
+		"$1" ${HOME} ${HOME} test /usr/bin --verbose
+	'quoted text' local awk done local
+	export cd export --verbose echo /usr/bin grep
+x=1 printf readonly cd 2>/dev/null export grep awk test local export
+done grep done $(pwd) then
+	${HOME} /usr/bin test local x=1 $(pwd) printf "$1" test x=1
+"$1" 'quoted text' x=1 readonly "$@"
+grep then $(pwd) x=1 awk export ${HOME} cd /usr/bin
+cd readonly && ${HOME} cd readonly --verbose export x=1 && x=1
+	2>/dev/null echo x=1 $(pwd) ${HOME} awk printf -eu | &&
+	test -eu awk /usr/bin &&
+$(pwd) x=1 readonly x=1 | cd printf cd local | done done test --verbose
+		printf 2>/dev/null "$@" cd sed "$@" 'quoted text' local
+	test ${HOME} export sed | sed awk echo && -eu
+	local 2>/dev/null "$@" && done printf --verbose --verbose "$@" printf
+echo "$1" local "$@" printf sed $(pwd) 2>/dev/null
+	sed done readonly echo | /usr/bin
+		"$1" $(pwd) 2>/dev/null "$1" && test | $(pwd) 2>/dev/null
+	"$1" cd 2>/dev/null done
+sed readonly "$@" printf printf test awk --verbose
+	printf readonly test x=1 echo "$@" 'quoted text'
+		grep cd -eu then | awk readonly cd grep -eu grep | test
+	&& then awk | local awk export ${HOME} done done -eu
+		x=1 local readonly 'quoted text' grep sed | /usr/bin readonly printf "$1" "$@"
+	"$1" grep | sed x=1 ${HOME} /usr/bin | grep -eu "$@" echo ${HOME}
+		-eu export cd "$1" printf x=1 2>/dev/null ${HOME} printf
+	echo local cd --verbose | | | export
+	readonly ${HOME} echo readonly /usr/bin printf test "$1" "$1" cd $(pwd)
+		/usr/bin "$@" ${HOME} cd x=1 | 'quoted text'
+| --verbose sed printf printf "$@" "$1" "$@" --verbose
+	${HOME} 'quoted text' printf export x=1 /usr/bin test export
+| then 'quoted text' printf $(pwd) then sed
+	/usr/bin cd x=1 "$@" /usr/bin echo $(pwd) export cd 2>/dev/null grep 2>/dev/null
+		printf /usr/bin then $(pwd) printf cd "$1" | 'quoted text'
+		cd x=1 && "$@" grep awk grep 'quoted text' $(pwd) readonly --verbose ${HOME} "$@"
+		awk export $(pwd) "$1" export && cd --verbose readonly echo local &&
+		2>/dev/null --verbose readonly awk "$1" "$@" x=1 export
+&& ${HOME} grep done x=1 local
+	sed | 'quoted text' --verbose export printf 2>/dev/null ${HOME}
+	-eu sed sed --verbose "$@" ${HOME}
+readonly | $(pwd) -eu printf printf -eu then then grep sed
+		sed done 2>/dev/null awk awk /usr/bin sed
+	sed x=1 done /usr/bin test test --verbose | /usr/bin | x=1
+	${HOME} readonly export 2>/dev/null && cd grep done printf cd echo | done "$1"
+	$(pwd) | && test sed $(pwd) $(pwd) grep sed $(pwd)
+		${HOME} 2>/dev/null 2>/dev/null -eu x=1 done echo
+	echo x=1 && ${HOME} $(pwd) -eu | test printf x=1 /usr/bin x=1
+$(pwd) && sed test /usr/bin && export "$@" export
+sed sed awk $(pwd) export export ${HOME}
+	printf echo grep && x=1 $(pwd) ${HOME} ${HOME} sed x=1 /usr/bin readonly
+		/usr/bin cd $(pwd) "$1" awk "$1" cd printf "$1" && awk |
+		"$@" readonly ${HOME} echo then export $(pwd) $(pwd) grep
+	x=1 test test && readonly
+	"$1" $(pwd) readonly 'quoted text' grep "$@" "$1" sed $(pwd) ${HOME} done
+	done x=1 -eu awk && "$@" awk -eu /usr/bin
+	test && 2>/dev/null cd ${HOME} -eu grep
+&& grep "$1" | export $(pwd) && ${HOME} 2>/dev/null
+echo then 2>/dev/null $(pwd) "$1" awk local 2>/dev/null
+		"$@" done echo "$1" grep
+		echo then local export cd grep | grep --verbose
+		2>/dev/null cd | grep "$@" && && && readonly
+	grep sed /usr/bin awk "$1" $(pwd)
+		--verbose -eu 'quoted text' echo "$@" test local test local /usr/bin
+grep && local x=1 done --verbose local sed ${HOME}
+		cd "$1" test cd && readonly 'quoted text' && 2>/dev/null "$1" grep
+		printf printf awk /usr/bin grep "$1"
+		"$1" 'quoted text' --verbose ${HOME} then grep export
+	done --verbose x=1 && && x=1 grep test x=1 echo echo "$@"
+	"$@" "$1" /usr/bin sed grep | -eu && x=1 -eu
+		${HOME} then "$1" sed cd | printf test --verbose test /usr/bin
+readonly grep 2>/dev/null "$@" "$@" printf sed grep printf
+then -eu -eu test && awk 'quoted text'
+	test --verbose && then grep export --verbose awk done awk
+	test && --verbose && "$@" /usr/bin 2>/dev/null "$1"
+	test echo | && readonly
+	$(pwd) awk -eu -eu $(pwd) readonly cd 'quoted text' && awk awk then
+	test ${HOME} then readonly | export local /usr/bin
+	${HOME} 2>/dev/null /usr/bin done && done awk
+cd 2>/dev/null 'quoted text' then local test
+| test test "$@" then -eu echo cd | -eu printf cd export export
+		export 2>/dev/null x=1 ${HOME} 2>/dev/null cd then && "$@" awk
+	then ${HOME} /usr/bin echo awk local cd
+		local --verbose -eu "$1" "$@" test x=1 $(pwd) && | ${HOME}
+"$@" printf export | "$1" | "$@" x=1 "$@" export then "$1" cd && export
+		echo readonly printf readonly sed $(pwd)
+	then && --verbose awk readonly $(pwd) --verbose
+		export test readonly done
+--verbose ${HOME} grep -eu then | "$1"
+		/usr/bin 2>/dev/null 'quoted text' done then sed cd $(pwd) $(pwd) local
+'quoted text' "$@" export then local x=1 grep printf awk then cd | --verbose
+grep echo readonly | /usr/bin | test then $(pwd) $(pwd)
+		/usr/bin awk 2>/dev/null x=1
+	export printf ${HOME} awk awk && -eu done 'quoted text' done
+		test awk ${HOME} -eu | "$1" |
+		test 2>/dev/null --verbose --verbose
+	x=1 'quoted text' sed
+2>/dev/null echo test echo 'quoted text' readonly x=1 ${HOME}
+	local 2>/dev/null echo "$@" sed local then grep "$@" then echo
+"$1" echo 'quoted text' 2>/dev/null awk /usr/bin | "$@"
+	sed "$1" then -eu /usr/bin awk ${HOME} awk echo --verbose "$@" $(pwd)
+	-eu then --verbose export cd | "$@" "$@" $(pwd) export --verbose
+readonly "$@" cd cd 'quoted text'
+	'quoted text' && /usr/bin --verbose
+	echo --verbose local $(pwd) -eu --verbose
+	&& then $(pwd) /usr/bin "$1" readonly /usr/bin "$1" /usr/bin 2>/dev/null
+readonly done "$1" ${HOME} then | "$1"
+		"$@" "$1" -eu -eu /usr/bin "$@" && then $(pwd) cd -eu ${HOME} /usr/bin "$@"
+	cd -eu "$@" && 2>/dev/null x=1 /usr/bin cd
+"$@" grep x=1 awk 'quoted text'
+	echo sed /usr/bin done /usr/bin /usr/bin 2>/dev/null "$1" 2>/dev/null
+	"$@" test ${HOME} cd -eu $(pwd)
+		"$1" $(pwd) ${HOME} sed export ${HOME} printf "$1" awk test
+		sed -eu 2>/dev/null sed then
+	x=1 done cd && --verbose && -eu --verbose
+	done $(pwd) cd ${HOME} 2>/dev/null
+		export export local ${HOME} echo cd $(pwd) 'quoted text'
+x=1 grep ${HOME} "$@" then ${HOME} echo -eu local x=1 --verbose
+	'quoted text' x=1 awk cd export grep /usr/bin 'quoted text' x=1
+	export local --verbose && | sed grep sed "$1" 2>/dev/null
+		grep ${HOME} awk sed test && "$1" sed
+	${HOME} sed cd 'quoted text' | done then test | awk | readonly -eu
+	awk echo x=1 && $(pwd) done 'quoted text'
+	-eu grep grep && /usr/bin export 2>/dev/null 'quoted text' 'quoted text' /usr/bin
+		| /usr/bin readonly printf "$@" 'quoted text' && done x=1 2>/dev/null
+	"$1" then readonly local then sed printf printf
+| readonly printf cd printf 2>/dev/null
+done -eu cd && echo --verbose "$@" local 2>/dev/null x=1 awk --verbose done -eu
+	then "$@" "$@" cd export sed --verbose ${HOME} local ${HOME} echo ${HOME} printf
+		cd sed /usr/bin -eu readonly echo awk then readonly && /usr/bin
+	readonly x=1 sed test grep local echo && /usr/bin
+		/usr/bin printf --verbose test /usr/bin
+	-eu /usr/bin test test -eu /usr/bin
+		$(pwd) done 'quoted text'
+	grep grep local test then done
+	x=1 x=1 then -eu /usr/bin | 'quoted text' ${HOME} then
+awk 'quoted text' cd
+test 'quoted text' cd /usr/bin
+	${HOME} "$@" /usr/bin local 'quoted text'
+	then sed 2>/dev/null /usr/bin 2>/dev/null | printf awk "$1" 'quoted text'
+	awk /usr/bin echo "$@" /usr/bin then "$@" export echo 2>/dev/null
+		-eu printf cd | printf 2>/dev/null $(pwd)
+		printf $(pwd) x=1 -eu $(pwd)
+	then "$1" x=1 x=1 'quoted text'
+cd && -eu /usr/bin readonly export --verbose then -eu 2>/dev/null && |
+		then test test printf 2>/dev/null "$@" /usr/bin ${HOME} "$1" /usr/bin
+&& $(pwd) $(pwd) && 2>/dev/null
+		2>/dev/null /usr/bin printf
+	-eu then "$1" awk readonly export -eu then | grep $(pwd) "$1" -eu "$@" | awk
+		export cd -eu "$@" grep | 2>/dev/null
+	cd x=1 "$1" echo ${HOME} $(pwd)
+test test done "$@" 2>/dev/null $(pwd) export && grep echo test echo "$@" $(pwd)
+	sed readonly local done grep echo
+--verbose "$1" export test && done "$1" readonly x=1 echo readonly
+		'quoted text' test export readonly done &&
+	cd 2>/dev/null test --verbose grep
+	'quoted text' "$1" "$1" test grep $(pwd) $(pwd) $(pwd) -eu "$@"
+		2>/dev/null cd done -eu
+		"$1" /usr/bin export $(pwd) "$@" | test -eu /usr/bin grep 2>/dev/null
+	grep "$1" /usr/bin 'quoted text' /usr/bin printf /usr/bin echo --verbose grep
+		2>/dev/null cd "$@" && printf | awk && test $(pwd) x=1 readonly awk
+/usr/bin 'quoted text' done grep
+--verbose awk && $(pwd) && | grep $(pwd) $(pwd) && grep "$1" /usr/bin
+"$@" then readonly | --verbose 'quoted text'
+	2>/dev/null cd -eu awk grep export sed --verbose local "$1" && cd test readonly
+	"$@" awk "$@" export test $(pwd) sed x=1 2>/dev/null
+		-eu "$1" -eu sed $(pwd) /usr/bin
+	$(pwd) | done test && sed test /usr/bin sed sed done 2>/dev/null /usr/bin
+sed && local then awk local local
+	$(pwd) done "$1" -eu readonly x=1 x=1 grep | cd -eu
+		then test && awk && printf ${HOME} test awk sed grep local readonly
+		echo | $(pwd) "$@" x=1 /usr/bin --verbose "$@" cd
+		done test done ${HOME} 'quoted text' $(pwd) test ${HOME} x=1 && cd local awk
+		"$@" printf 'quoted text' readonly then
+		'quoted text' x=1 grep $(pwd) done then | sed /usr/bin done sed printf
+		done ${HOME} grep local | | echo /usr/bin -eu /usr/bin -eu export ${HOME} && 'quoted text'
+	2>/dev/null --verbose 2>/dev/null && | | x=1 then done echo local
+	grep ${HOME} 'quoted text'
+		local test then export x=1 | awk x=1 echo cd /usr/bin then "$@"
+	$(pwd) cd | cd test $(pwd)
+		| awk then sed local ${HOME} local ${HOME} "$@" 'quoted text'
+${HOME} export -eu "$@" local
+test $(pwd) awk -eu x=1 sed then readonly | 'quoted text'
+	sed readonly cd --verbose ${HOME} 2>/dev/null local $(pwd)
+	then "$@" ${HOME} awk grep -eu cd
+	${HOME} echo local cd && test 2>/dev/null &&
+#include c248.sh
+		echo ${HOME} | printf "$1" "$@" done x=1 then
+		readonly echo 2>/dev/null | 2>/dev/null x=1 2>/dev/null 'quoted text' readonly
+export && && cd && echo export /usr/bin
+		awk then $(pwd) /usr/bin grep cd | grep
+readonly echo /usr/bin x=1 done -eu 2>/dev/null then 2>/dev/null readonly done
+		local cd ${HOME} done local ${HOME} x=1 done export
+${HOME} done --verbose 2>/dev/null && /usr/bin echo grep x=1 local 'quoted text'
+		local echo && -eu && cd "$@" sed "$1" test done sed sed awk
+		| cd "$1" $(pwd) $(pwd) | "$@" 'quoted text' grep -eu &&
+	${HOME} 'quoted text'
+		local grep --verbose | export --verbose | cd ${HOME} "$@" /usr/bin x=1 echo
+	${HOME} echo "$@" printf printf sed done 'quoted text' done readonly
+awk grep then /usr/bin readonly --verbose
+2>/dev/null && local export $(pwd)
+	2>/dev/null ${HOME} 2>/dev/null -eu /usr/bin
+	$(pwd) -eu && --verbose readonly test sed "$1" cd local then echo x=1 readonly
+		| test --verbose "$1" printf && --verbose cd awk $(pwd)
+local x=1 echo sed ${HOME} | then then echo /usr/bin /usr/bin 'quoted text'
+x=1 | --verbose "$1" awk readonly --verbose $(pwd)
+		/usr/bin /usr/bin grep x=1 $(pwd) 'quoted text'
+		'quoted text' awk done export "$@" | | --verbose && printf ${HOME} 2>/dev/null
+--verbose then export x=1 -eu printf /usr/bin cd then && readonly test 'quoted text'
+	$(pwd) --verbose cd then --verbose local "$1" sed "$1" | test grep $(pwd)
+		done export done done done readonly "$@" test ${HOME}
+		cd awk test export grep "$@" readonly then echo
+	cd export printf -eu export printf | "$1" local local printf "$1" && then test
+		"$@" then then test 2>/dev/null
+	&& ${HOME} printf "$1" 2>/dev/null
+'quoted text' 2>/dev/null awk
+		then awk -eu local --verbose && grep $(pwd) readonly "$1" readonly local grep
+local grep x=1 /usr/bin && echo ${HOME} "$1" awk
+		"$1" "$@" x=1 /usr/bin "$1" local test 'quoted text'
+		2>/dev/null readonly readonly
+		/usr/bin done "$@" 2>/dev/null /usr/bin local -eu 'quoted text'
+awk awk "$1" cd $(pwd) && | /usr/bin export
+	done --verbose x=1 echo test "$@"
+	done ${HOME} 'quoted text' --verbose readonly
+done x=1 then printf
+done /usr/bin 'quoted text' 'quoted text' echo
+sed ${HOME} sed "$@" | sed && --verbose 2>/dev/null then awk
+2>/dev/null -eu 'quoted text' local ${HOME} grep
+then export $(pwd) && awk "$@" sed -eu test "$1" cd | -eu && test -eu --verbose
+&& export && grep && --verbose
+	--verbose awk sed 'quoted text' x=1 && sed x=1 local test done 2>/dev/null
+		-eu cd awk then "$@"
+-eu then done grep "$@" x=1 export
+	echo export test -eu
+	&& then 'quoted text' cd && export readonly x=1
+	/usr/bin && grep done /usr/bin x=1 echo printf then then -eu readonly "$1"
+	printf awk test local printf x=1 then $(pwd) /usr/bin 'quoted text'
+		x=1 2>/dev/null cd --verbose sed "$1" test grep
+	"$1" 2>/dev/null ${HOME}
+	export 2>/dev/null echo done
+	/usr/bin 2>/dev/null ${HOME} x=1 echo sed
+'quoted text' done "$@" "$1" 2>/dev/null done
+awk "$@" test "$@" 2>/dev/null
+	--verbose 'quoted text' printf readonly export awk grep grep then ${HOME} "$1"
+"$1" done done then "$1" | x=1 x=1 sed 2>/dev/null
+		"$1" echo "$1" local && export | ${HOME} /usr/bin local done 2>/dev/null echo
+	test && /usr/bin "$@" printf cd local done grep "$@" test $(pwd) x=1 "$1"
+		2>/dev/null grep "$@" ${HOME}
+	${HOME} "$1" readonly && x=1 printf export 2>/dev/null
+	export local printf -eu sed export /usr/bin export 2>/dev/null
+	| readonly 'quoted text' --verbose "$1" done --verbose
+		x=1 "$@" x=1 /usr/bin export test export "$@" sed 2>/dev/null $(pwd)
+		then x=1 echo ${HOME} &&
+| "$@" "$1" export done $(pwd) readonly ${HOME}
+		done then then 2>/dev/null 2>/dev/null cd grep
+-eu then -eu awk $(pwd) done local ${HOME} --verbose
+	/usr/bin cd --verbose then --verbose /usr/bin
+		cd grep x=1 done --verbose cd
+		| 'quoted text' && ${HOME}
+export readonly printf 2>/dev/null && test
+		"$1" ${HOME} $(pwd) export --verbose test 2>/dev/null
+	export export echo "$1" | test /usr/bin awk then test 2>/dev/null
+	x=1 done export printf export x=1 echo
+	${HOME} sed -eu grep sed printf ${HOME} echo cd then
+test 2>/dev/null printf 'quoted text' export x=1 "$@" /usr/bin test cd ${HOME}
+sed done $(pwd) | 'quoted text' test local printf /usr/bin export cd
+x=1 2>/dev/null grep $(pwd) cd --verbose sed -eu then
+		"$@" awk printf ${HOME} readonly 2>/dev/null
+		${HOME} /usr/bin export $(pwd) local 'quoted text' echo grep 'quoted text' | grep
+	grep "$1" readonly local --verbose ${HOME} export then
+| -eu /usr/bin printf /usr/bin 'quoted text' 'quoted text'
+	'quoted text' --verbose printf | -eu
+x=1 then local | cd /usr/bin printf /usr/bin readonly --verbose
+$(pwd) done | "$@" /usr/bin "$@" && 2>/dev/null grep --verbose
+| cd /usr/bin && -eu -eu $(pwd) local done $(pwd) $(pwd) sed awk 'quoted text'
+--verbose "$1" awk echo "$@" "$@" $(pwd) awk "$@"
+		${HOME} --verbose sed $(pwd) 2>/dev/null echo --verbose ${HOME} 'quoted text'
+		"$1" export /usr/bin readonly && && echo sed 2>/dev/null
+	cd "$@" "$@" ${HOME} 2>/dev/null
+readonly cd grep then awk readonly grep &&
+	"$1" echo echo x=1 cd x=1 echo $(pwd) sed "$1" printf
+	${HOME} export printf $(pwd) 'quoted text' done test -eu sed grep $(pwd)
+'quoted text' export /usr/bin ${HOME} | echo ${HOME} 2>/dev/null
+	test ${HOME} ${HOME} readonly sed -eu | readonly "$@" 2>/dev/null sed
+		printf -eu test grep x=1 x=1 local awk /usr/bin --verbose cd
+		'quoted text' 'quoted text' cd then $(pwd) grep done
+		'quoted text' grep 'quoted text'
+	-eu sed 2>/dev/null && export printf /usr/bin done 'quoted text' cd test 2>/dev/null
+		printf grep -eu then "$@" grep | --verbose "$1" then grep | $(pwd)
+	sed readonly readonly 2>/dev/null export x=1 done test | readonly -eu
+		awk | grep $(pwd) grep 'quoted text' local
+		grep 2>/dev/null echo grep
+		readonly $(pwd) && 2>/dev/null sed grep printf printf &&
+test echo && --verbose then
+awk readonly && "$1" $(pwd) "$@"
+	2>/dev/null x=1 | export done | $(pwd) printf awk cd 2>/dev/null
+then done --verbose export
+| sed grep x=1 | readonly $(pwd) done -eu "$1" "$1" export done
+local export done --verbose ${HOME}
+	test $(pwd) $(pwd) /usr/bin readonly
+${HOME} 'quoted text' 2>/dev/null printf cd x=1 ${HOME} test 2>/dev/null
+2>/dev/null then "$1" sed && test --verbose
+		x=1 test "$@" readonly test | printf cd && awk export readonly /usr/bin "$@"
+	-eu printf readonly then local test
+	awk 2>/dev/null then export
+	"$1" export $(pwd) "$@" x=1 readonly sed
+"$@" -eu x=1 "$1" echo export sed ${HOME} 2>/dev/null
+${HOME} printf echo --verbose printf --verbose test cd
+		sed echo sed 'quoted text' then "$@" sed
+		grep then 2>/dev/null then grep | &&
+	2>/dev/null "$@" && ${HOME} then cd awk then
+		export printf then x=1 /usr/bin test | printf --verbose
+	readonly readonly --verbose readonly local cd local
+done && "$1" "$@" --verbose --verbose ${HOME} grep sed /usr/bin
+		readonly x=1 --verbose 'quoted text'
+		${HOME} --verbose && printf -eu $(pwd)
+cd | "$@" --verbose 2>/dev/null -eu && export echo cd x=1 sed --verbose
+	awk "$@" echo awk ${HOME} awk /usr/bin "$1" echo -eu local "$1"
+		readonly then local awk done /usr/bin test /usr/bin "$@" /usr/bin
+		$(pwd) -eu x=1 grep "$1" --verbose 2>/dev/null grep printf 2>/dev/null
+	${HOME} sed --verbose cd ${HOME}
+	--verbose cd local echo echo cd --verbose
+| printf sed then local ${HOME} /usr/bin export test awk -eu echo
+		--verbose x=1 then && test 'quoted text' local readonly && printf "$@" 2>/dev/null
+		x=1 'quoted text' --verbose
+	awk sed test test then echo 2>/dev/null /usr/bin 2>/dev/null printf readonly
+export then x=1 readonly then grep 'quoted text' then x=1
+	done grep export readonly grep ${HOME} --verbose test "$@" "$1" awk
+cd sed echo 2>/dev/null "$@" | /usr/bin cd sed echo ${HOME} local done cd local
+done echo | cd echo test grep ${HOME} ${HOME}
+local done "$1" readonly grep ${HOME} export printf x=1 x=1 $(pwd) ${HOME} test
+		&& -eu local echo -eu test && test done | | then awk
+local sed 2>/dev/null --verbose | echo 2>/dev/null done "$@" local 2>/dev/null
+"$@" "$1" x=1 ${HOME} && $(pwd) sed readonly
+awk local grep $(pwd) export 'quoted text' readonly test $(pwd) --verbose
+		printf readonly --verbose export /usr/bin "$@" then then readonly && local sed |
+		export | 2>/dev/null $(pwd) grep 2>/dev/null "$1"
+awk test cd done /usr/bin readonly -eu | printf done test "$@"
+		awk then cd /usr/bin grep test readonly
+		awk /usr/bin /usr/bin grep && x=1 --verbose export
+done | awk then --verbose |
+		readonly x=1 cd cd /usr/bin readonly cd | | cd $(pwd) "$@"
+"$@" | /usr/bin --verbose | local && printf awk
+printf "$1" test echo && then awk sed --verbose x=1 sed local x=1
+"$1" 'quoted text' then
+readonly grep "$1" export "$1" awk /usr/bin
+${HOME} sed | x=1 ${HOME} $(pwd) ${HOME} awk --verbose
+		2>/dev/null && echo && && 2>/dev/null
+		'quoted text' 'quoted text' "$1" readonly
+		readonly "$@" 'quoted text' local test 2>/dev/null 2>/dev/null $(pwd) done
+	-eu -eu then ${HOME} sed 'quoted text'
+	'quoted text' test ${HOME} /usr/bin sed /usr/bin
+		sed test "$@" sed printf printf /usr/bin cd test -eu x=1
+cd then --verbose "$@" "$@" 'quoted text' "$1" -eu x=1 /usr/bin sed printf test
+	export then export /usr/bin -eu test cd "$1" cd readonly grep readonly
+	2>/dev/null && sed local -eu done $(pwd) export -eu then ${HOME} /usr/bin /usr/bin
+grep awk $(pwd) done -eu done 2>/dev/null grep 2>/dev/null
+		--verbose "$1" | printf --verbose cd sed local "$@" echo done then
+$(pwd) done /usr/bin grep sed "$@" "$@" "$1" sed x=1 test --verbose
+	"$1" done -eu "$@" printf readonly
+		export printf "$1" sed export $(pwd)
+	$(pwd) readonly grep echo x=1 sed awk readonly grep echo
+-eu $(pwd) /usr/bin done sed local /usr/bin --verbose |
+test done readonly "$1" /usr/bin test awk readonly cd echo --verbose /usr/bin
+	then awk /usr/bin cd export then printf | grep
+2>/dev/null export sed printf test sed --verbose
+		sed awk 'quoted text' 2>/dev/null | cd done 2>/dev/null
+	/usr/bin "$1" readonly $(pwd) x=1 && grep --verbose
+		cd "$@" cd echo && -eu
+--verbose /usr/bin x=1 sed test echo echo test | "$@" cd
+		&& x=1 sed then awk 'quoted text' export
+		-eu && /usr/bin /usr/bin awk 'quoted text' 'quoted text'
+	awk -eu "$1" local x=1 printf
+awk 'quoted text' cd --verbose printf && cd then then echo export && -eu test awk
+	export $(pwd) echo /usr/bin | done --verbose | awk grep
+		local && export echo -eu x=1 printf 'quoted text' awk $(pwd) readonly
+	test && local x=1 cd grep --verbose awk then echo
+grep -eu && local cd
+		then ${HOME} -eu $(pwd) /usr/bin echo $(pwd) sed local ${HOME} echo /usr/bin
+		done awk && grep --verbose sed export x=1
+		'quoted text' | "$@" readonly "$1" "$@" "$@" $(pwd) echo
+-eu export && -eu 2>/dev/null "$1" cd "$1" && printf
+	done sed 2>/dev/null $(pwd) | echo "$1" x=1 then --verbose
+	export grep local echo 'quoted text' "$1" done test
+		cd "$@" -eu cd $(pwd) local -eu printf ${HOME} --verbose
+	/usr/bin done "$@" 2>/dev/null cd /usr/bin then awk
+--verbose awk cd readonly test grep test 2>/dev/null
+grep then "$1" then cd -eu
+		x=1 | 'quoted text' readonly && -eu test
+		-eu --verbose done "$1" -eu
+	-eu -eu 'quoted text'
+sed 2>/dev/null sed | 2>/dev/null $(pwd) ${HOME} then printf "$1" 'quoted text'
+		"$1" 'quoted text' cd &&
+	export printf awk test 'quoted text'
+${HOME} grep readonly "$@" -eu /usr/bin
+	echo local "$1" && --verbose && --verbose
+		| test cd readonly "$1" awk export awk x=1 /usr/bin 'quoted text'
+then --verbose --verbose
+test grep && ${HOME} --verbose
+	x=1 cd 2>/dev/null echo "$@" export
+		/usr/bin $(pwd) "$1" -eu &&
+	2>/dev/null && --verbose /usr/bin x=1
+		awk -eu 'quoted text' local /usr/bin && 2>/dev/null 'quoted text'
+		readonly sed | --verbose export then local ${HOME}
+"$1" local 2>/dev/null x=1 local "$1" local /usr/bin test ${HOME} | grep
+		test -eu sed x=1 'quoted text' local local ${HOME}
+cd done awk | sed $(pwd) grep local export ${HOME} -eu --verbose && 2>/dev/null
+		export done readonly "$1" x=1 $(pwd) "$@" grep -eu 'quoted text' echo test
+	| grep local test x=1 echo 'quoted text' grep | sed -eu && export
+	then | x=1 local grep local awk export
+		-eu 'quoted text' 'quoted text' export
+		'quoted text' done readonly grep
+cd ${HOME} echo echo test sed 'quoted text' awk 2>/dev/null sed /usr/bin
+| && 2>/dev/null readonly echo echo
+	grep 'quoted text' | printf grep ${HOME} "$@" -eu 2>/dev/null
+	x=1 cd printf local sed x=1 -eu x=1 local 2>/dev/null 'quoted text' test
+		then readonly x=1 'quoted text' local export x=1 echo 'quoted text'
+		$(pwd) then cd local cd x=1
+"$1" x=1 readonly local grep ${HOME}
+		cd export test export &&
+		${HOME} x=1 && "$@" readonly printf $(pwd)
+&& x=1 local $(pwd) test 2>/dev/null
+export /usr/bin | sed -eu printf 2>/dev/null sed
+		printf 'quoted text' then then x=1 done --verbose
+		local "$@" -eu $(pwd) local "$1" "$1" then && then "$1" awk
+		--verbose | 2>/dev/null --verbose "$@" export 2>/dev/null 2>/dev/null &&
+grep test test x=1 awk readonly ${HOME} 'quoted text' test
+	-eu && --verbose && sed "$1" echo export | | $(pwd)
+	"$1" "$@" test && 2>/dev/null && "$@" "$1" ${HOME} awk | sed awk 2>/dev/null
+	"$1" 'quoted text' export
+	&& test -eu local awk test
+x=1 --verbose 2>/dev/null test $(pwd)
+	'quoted text' readonly grep $(pwd)
+		x=1 local echo | /usr/bin printf -eu 'quoted text'
+$(pwd) "$@" $(pwd) printf then test 2>/dev/null awk && local | 'quoted text'
+export --verbose | export 'quoted text' done export |
+	then -eu ${HOME} awk sed ${HOME} "$1" sed readonly 2>/dev/null
+${HOME} 2>/dev/null readonly
+		/usr/bin --verbose --verbose -eu 'quoted text'
+		local | "$@" /usr/bin
+		sed | awk then sed ${HOME} echo -eu printf export
+	/usr/bin local ${HOME}
+		x=1 local /usr/bin && "$@" --verbose sed "$1" readonly 'quoted text'
+	'quoted text' echo 2>/dev/null then
+	awk export "$@" /usr/bin export local printf /usr/bin
+		then "$1" 'quoted text' done then --verbose
+	test grep 2>/dev/null done
+test && x=1 --verbose /usr/bin | awk export /usr/bin -eu "$1" | cd | local
+| x=1 $(pwd) | ${HOME} printf export then && --verbose | sed "$@" $(pwd)
+		'quoted text' 2>/dev/null 'quoted text' 'quoted text' readonly
+	readonly done "$@" echo --verbose then
+		awk printf /usr/bin "$@" readonly
+${HOME} $(pwd) sed sed ${HOME}
+	x=1 && --verbose "$1" awk ${HOME} 2>/dev/null
+		&& && /usr/bin awk cd "$1" export test --verbose
+printf export "$@" --verbose local sed --verbose
+"$1" | ${HOME} done awk $(pwd) 'quoted text' grep echo
+		readonly $(pwd) x=1 "$@" 2>/dev/null x=1 | /usr/bin 2>/dev/null
+local ${HOME} "$1" | readonly cd -eu && -eu cd
+		done /usr/bin -eu "$1" ${HOME} $(pwd)
+		| printf -eu cd readonly sed --verbose x=1 "$1" $(pwd) readonly ${HOME} x=1
+	x=1 echo grep ${HOME} /usr/bin && /usr/bin
+		sed test test && "$@" printf echo
+		2>/dev/null sed sed ${HOME} test /usr/bin && export
+test export $(pwd) done 'quoted text'
+| ${HOME} ${HOME} then -eu --verbose readonly 'quoted text' printf awk ${HOME}
+"$1" readonly 'quoted text' "$@" printf
+&& echo export x=1 && "$@" awk
+-eu export x=1 done printf 'quoted text'
+${HOME} then cd && "$1" awk
+		done 2>/dev/null 'quoted text' sed /usr/bin "$1" && "$1"
+grep printf x=1 --verbose sed && ${HOME} echo test cd cd export grep && 'quoted text'
+awk sed readonly && test x=1 | -eu then test
+		"$@" then then 'quoted text'
+		grep /usr/bin readonly sed 2>/dev/null "$@" sed "$@" readonly readonly && 'quoted text'
+	readonly local /usr/bin --verbose | ${HOME} done export "$@" echo printf 2>/dev/null
+		printf sed && 2>/dev/null --verbose
+then sed sed done && 2>/dev/null 2>/dev/null -eu
+		test ${HOME} grep sed | test test ${HOME} printf awk && test readonly awk
+	printf then test then test && ${HOME} --verbose $(pwd)
+	test readonly 2>/dev/null printf export $(pwd) "$1" local
+export -eu awk export then 'quoted text' /usr/bin awk
+		2>/dev/null awk --verbose export local && 'quoted text' 2>/dev/null
+--verbose x=1 "$@" export test local export
+	${HOME} 2>/dev/null readonly
+--verbose 'quoted text' "$1" local && local echo echo $(pwd)
+	then $(pwd) && export
+		2>/dev/null readonly done -eu && printf 2>/dev/null |
+2>/dev/null 2>/dev/null "$1" printf
+	2>/dev/null x=1 "$@" /usr/bin 'quoted text'
+	| printf | test cd x=1 $(pwd) $(pwd) grep grep
+		done export printf local x=1 $(pwd) -eu "$@" awk sed
+		/usr/bin $(pwd) export cd -eu echo grep | export x=1 readonly "$1" | printf
+		$(pwd) "$@" 2>/dev/null readonly awk
+	export awk test grep then echo test awk
+	2>/dev/null export -eu "$1" "$1" readonly 2>/dev/null
+		/usr/bin awk cd printf then export cd done
+-eu printf done 2>/dev/null awk readonly --verbose
+x=1 /usr/bin 'quoted text' "$@" grep done
+	readonly done --verbose /usr/bin awk --verbose
+	cd grep $(pwd) test grep 'quoted text'
+		done sed --verbose test export && 'quoted text' done sed then ${HOME}
+local --verbose "$1" 'quoted text'
+	x=1 "$1" local x=1 readonly local
+		2>/dev/null /usr/bin sed /usr/bin awk sed 'quoted text' ${HOME} awk
+-eu export grep then 2>/dev/null x=1
+		$(pwd) x=1 /usr/bin then
+	local $(pwd) done -eu | then "$1" sed 2>/dev/null -eu && then
+	cd "$@" export 2>/dev/null readonly then | printf grep --verbose echo
+x=1 | "$@" --verbose
+		then x=1 then awk -eu -eu local 2>/dev/null
+	local "$@" x=1 | sed then sed
+	local x=1 readonly /usr/bin "$@" grep && "$1" sed
+		/usr/bin | done grep readonly $(pwd) /usr/bin done local
+2>/dev/null grep readonly
+readonly export awk 2>/dev/null 'quoted text' test
+		done export export done
+		2>/dev/null 'quoted text' -eu ${HOME} "$@" --verbose
+	cd awk | 2>/dev/null printf export
+grep test "$@" cd then local echo grep echo x=1 ${HOME} && ${HOME} && ${HOME}
+export x=1 echo then then local sed
+		2>/dev/null 2>/dev/null test x=1 then export export && "$@" /usr/bin 2>/dev/null
+		-eu ${HOME} 'quoted text' -eu | awk awk printf | /usr/bin "$@" export "$1"
+	"$@" ${HOME} test $(pwd) && | -eu x=1 | awk 2>/dev/null
+		2>/dev/null /usr/bin
+		readonly then echo $(pwd)
+${HOME} grep | then ${HOME}
+		"$@" local echo ${HOME}
+	readonly x=1 ${HOME} test x=1 awk $(pwd)
+		$(pwd) local cd -eu $(pwd) awk x=1 ${HOME}
+	--verbose then sed --verbose --verbose
+		-eu x=1 && done local && ${HOME} echo
+done then grep x=1 /usr/bin /usr/bin && -eu grep ${HOME}
+2>/dev/null grep grep -eu
+	then printf 'quoted text' 2>/dev/null printf grep "$@" $(pwd)
+		echo /usr/bin 2>/dev/null "$1" local cd export -eu grep | "$@"
+x=1 -eu x=1 -eu cd 'quoted text' ${HOME} awk 'quoted text' test export then echo
+${HOME} | cd export then printf 2>/dev/null -eu --verbose grep /usr/bin
+grep then done then /usr/bin awk x=1 printf
+export /usr/bin 'quoted text'
+	'quoted text' echo 'quoted text'
+	'quoted text' then --verbose done grep /usr/bin
+		test "$1" grep /usr/bin 2>/dev/null
+	then --verbose awk sed readonly export 'quoted text' done
+		printf done "$1" printf && then 2>/dev/null --verbose | echo --verbose
+		printf export | local | local
+	$(pwd) grep -eu x=1 local echo "$@"
+		readonly then /usr/bin /usr/bin -eu done --verbose then "$1" | grep --verbose
+2>/dev/null $(pwd) | | $(pwd) "$1" echo && 2>/dev/null
+		readonly -eu x=1 -eu ${HOME} grep echo awk
+	/usr/bin test grep cd --verbose
+		export 2>/dev/null test /usr/bin
+	awk -eu then 2>/dev/null local -eu | 2>/dev/null
+	awk "$@" ${HOME} cd $(pwd) 'quoted text'
+	--verbose grep && awk export grep "$1" $(pwd) $(pwd) x=1 ${HOME} local | 'quoted text'
+local ${HOME} 2>/dev/null local ${HOME}
+echo ${HOME} 2>/dev/null | ${HOME} awk $(pwd)
+	test awk test test && x=1 x=1 --verbose ${HOME} awk sed x=1 sed local
+	cd done x=1 /usr/bin then local "$@" grep
+		| cd "$1" printf export 2>/dev/null ${HOME} && | sed ${HOME}
+readonly "$@" "$1" test ${HOME} "$1"
+	local && 2>/dev/null cd then echo grep
+	--verbose $(pwd) $(pwd)
+	${HOME} "$1" echo -eu cd
+		2>/dev/null readonly cd ${HOME} && sed 'quoted text' | && grep x=1 grep "$1"
+	readonly cd "$@" test then x=1 then awk readonly 2>/dev/null && awk
+		&& /usr/bin "$1" cd echo ${HOME} awk done 'quoted text'
+export 2>/dev/null then --verbose awk
+		/usr/bin done | --verbose sed 'quoted text'
+awk $(pwd) ${HOME} x=1 grep x=1 | ${HOME} $(pwd) "$1"
+--verbose then "$@" local | "$1" export readonly -eu then | grep
+sed cd x=1 grep 2>/dev/null 'quoted text' done readonly 2>/dev/null local
+	$(pwd) cd --verbose "$@" 2>/dev/null
+	${HOME} readonly -eu export printf | cd sed --verbose then test
+		--verbose --verbose | awk ${HOME} && readonly
+		| "$@" echo "$@" && cd echo -eu readonly printf done 'quoted text' awk &&
+		grep && readonly --verbose "$@" test | sed "$1" done --verbose sed
+		2>/dev/null -eu awk grep -eu sed -eu sed test grep -eu /usr/bin
+	${HOME} done echo "$@" done "$@" 2>/dev/null echo echo "$@"
+done "$1" "$@" ${HOME} "$1" -eu --verbose | $(pwd) ${HOME} && -eu -eu export
+		"$@" printf awk done echo echo cd then
+		export "$@" then -eu "$@" "$1" export | awk done test 'quoted text'
+		${HOME} -eu "$1" "$@" export cd && cd awk "$1" 2>/dev/null /usr/bin test
+	$(pwd) $(pwd) ${HOME}
+	grep ${HOME} -eu done ${HOME} printf local local then local echo cd 2>/dev/null
+	grep test then echo sed done printf readonly 'quoted text' export
+		done $(pwd) 2>/dev/null "$@" 2>/dev/null ${HOME}
+		printf test printf local && cd then 2>/dev/null "$@" x=1 grep --verbose
+sed readonly -eu 'quoted text' readonly echo x=1
+		&& ${HOME} echo then export && ${HOME}
+		done test && | export echo /usr/bin readonly /usr/bin printf
+		sed "$@" printf then done readonly test -eu | then 'quoted text'
+		then "$1" readonly done awk "$1" 'quoted text'
+		'quoted text' test cd echo "$@" -eu
+	--verbose "$@" done export grep cd then --verbose ${HOME} echo /usr/bin x=1 --verbose
+		then cd export sed test -eu then "$@" x=1
+test then readonly test awk sed awk $(pwd)
+	test -eu local x=1 "$1" -eu 2>/dev/null
+	grep --verbose && "$@" grep readonly "$1" printf sed | grep 'quoted text' echo
+		'quoted text' ${HOME} 2>/dev/null "$@" cd "$@" $(pwd)
+	done 'quoted text' 'quoted text' export $(pwd) test
+		"$@" local export -eu printf echo echo && "$@" "$1" export readonly readonly
+	'quoted text' 2>/dev/null cd ${HOME} readonly export 2>/dev/null 'quoted text' printf
+	'quoted text' printf export
+		done cd x=1 echo printf $(pwd) -eu echo grep
+	awk $(pwd) 'quoted text' awk 'quoted text' 2>/dev/null printf
+	awk cd echo | ${HOME} test -eu | 2>/dev/null --verbose local
+	cd $(pwd) grep --verbose test
+	'quoted text' then 'quoted text' x=1 2>/dev/null
+	--verbose | ${HOME} awk 'quoted text' sed && ${HOME} -eu echo grep grep --verbose
+'quoted text' && grep then printf x=1 readonly test cd then
+		${HOME} ${HOME} test readonly 2>/dev/null export -eu ${HOME} then local 2>/dev/null
+| cd local export && test /usr/bin | done export test --verbose
+		printf 'quoted text' /usr/bin awk "$@" done 2>/dev/null local | $(pwd)
+x=1 grep "$1" 'quoted text' done export printf 'quoted text'
+	test $(pwd) printf ${HOME}
+	&& && -eu export grep
+		awk cd test "$1" export test ${HOME} echo done
+done test x=1 printf | readonly sed |
+	"$@" 2>/dev/null then test "$@" $(pwd) sed
+	${HOME} export export cd grep
+	"$@" printf export && grep && 2>/dev/null awk -eu test && -eu | cd $(pwd) /usr/bin
+	--verbose grep --verbose grep |
+	grep sed --verbose test printf x=1 grep local test
+sed grep printf 'quoted text' ${HOME} /usr/bin
+	then -eu awk printf awk test grep "$1" 2>/dev/null cd && done then
+	"$@" local printf --verbose -eu "$@" x=1 ${HOME} $(pwd) readonly
+	awk then cd /usr/bin readonly
+$(pwd) /usr/bin 'quoted text' echo then printf 'quoted text' awk
+		$(pwd) local 2>/dev/null "$1" --verbose
+	"$1" test test -eu sed local "$@" test && local printf "$1"
+-eu 'quoted text' then "$1"
+		sed | local sed sed awk --verbose
+cd awk x=1 test grep
+	${HOME} echo 2>/dev/null readonly grep readonly echo echo export grep
+		echo printf then "$1" ${HOME} "$@" done "$1" echo local ${HOME} sed awk cd | echo
+		/usr/bin x=1 local export done
+export cd echo | done x=1 | 'quoted text' --verbose test sed
+		sed test 2>/dev/null -eu printf then
+		2>/dev/null then grep test printf --verbose
+		echo printf 'quoted text' -eu 'quoted text' done --verbose
+		'quoted text' "$@" "$1" awk printf awk $(pwd)
+cd awk && export echo readonly then
+test ${HOME} 'quoted text' awk done
+export then 'quoted text' readonly awk awk "$@" echo --verbose test -eu then x=1
+	"$1" export echo ${HOME} "$1" grep --verbose
+		export local then export 2>/dev/null sed -eu sed ${HOME} then grep awk
+&& cd done awk then ${HOME} 2>/dev/null 2>/dev/null readonly 2>/dev/null /usr/bin
+		done "$1" printf x=1
+grep test && ${HOME} $(pwd) awk
+	&& | 2>/dev/null 2>/dev/null test | cd then "$1" readonly
+	2>/dev/null printf --verbose 'quoted text' then printf printf
+		done cd -eu /usr/bin done grep 'quoted text'
+	readonly x=1 -eu "$@" "$@" local ${HOME} readonly 2>/dev/null
+printf ${HOME} 'quoted text' export
+readonly | | local "$@" local && echo printf 2>/dev/null done export
+		$(pwd) -eu -eu 2>/dev/null && && sed x=1
+done cd done then | cd sed && sed readonly 2>/dev/null 'quoted text'
+sed 2>/dev/null echo local readonly "$1" cd --verbose
+		| printf awk then local $(pwd) export cd 'quoted text'
+		&& echo $(pwd) then ${HOME} done ${HOME} 'quoted text' grep 'quoted text' -eu
+	&& awk ${HOME} export 'quoted text' && 'quoted text' then ${HOME} 'quoted text'
+	--verbose && export sed awk grep test export $(pwd) test 2>/dev/null done
+		echo echo $(pwd) then x=1 cd sed "$1" grep ${HOME} | printf
+		$(pwd) $(pwd) then echo $(pwd) 'quoted text' |
+	/usr/bin "$@" local $(pwd) printf
+	test export local ${HOME} echo "$1" "$1" done "$@" then x=1 'quoted text'
+	sed $(pwd) -eu test then awk
+		test sed "$@" "$1" "$@" local | grep $(pwd)
+--verbose readonly "$1" x=1 readonly test local $(pwd)
+"$1" grep "$1" /usr/bin local "$@" export x=1 x=1 --verbose
+		echo && then | then "$1" --verbose | test local x=1 done echo local printf /usr/bin
+		-eu readonly awk "$1" export test then local then sed cd test 2>/dev/null /usr/bin
+sed test -eu -eu $(pwd)
+grep cd export -eu sed
+		grep readonly printf echo $(pwd) readonly sed | then /usr/bin export grep &&
+	| ${HOME} export "$1" --verbose 2>/dev/null "$1" /usr/bin printf "$@" /usr/bin
+	| x=1 local ${HOME} printf test x=1 && | /usr/bin
+		"$@" ${HOME} test awk -eu then 'quoted text' --verbose
+$(pwd) grep "$@" -eu 'quoted text'
+printf /usr/bin export then 'quoted text' grep "$1"
+	2>/dev/null | sed grep $(pwd)
+	/usr/bin "$1" x=1 then
+	export local export awk printf grep printf grep /usr/bin
+		${HOME} "$1" 'quoted text'
+		grep done 'quoted text' "$1" "$@" x=1 echo echo sed -eu printf 2>/dev/null
+		"$@" test then local | && x=1 readonly "$1" 2>/dev/null grep cd
+sed then printf test "$1" readonly x=1 | cd grep $(pwd) sed
+		-eu awk printf test "$@" --verbose | | --verbose -eu printf readonly x=1 --verbose
+		done "$@" ${HOME} "$@" local 'quoted text'
+		cd awk awk printf sed x=1 "$1" cd export echo "$@" ${HOME} ${HOME}
+	"$@" then && test test printf $(pwd) test cd test 'quoted text' /usr/bin
+	'quoted text' grep echo cd test local test -eu --verbose /usr/bin ${HOME}
+	"$@" then sed readonly local awk /usr/bin 'quoted text'
+	$(pwd) -eu printf export
+		local 'quoted text' 'quoted text' 2>/dev/null sed
+		test echo export --verbose test echo sed then grep sed done 'quoted text'
+printf "$1" export | $(pwd)
+	sed && --verbose ${HOME} cd $(pwd) done readonly printf -eu done
+	${HOME} -eu "$@" done "$1" grep grep "$1" 'quoted text' --verbose then echo
+	&& x=1 export $(pwd) x=1 grep 'quoted text'
+${HOME} && --verbose then -eu cd then
+	$(pwd) x=1 grep awk done grep echo echo | x=1 local ${HOME} done && readonly
+	"$@" 2>/dev/null x=1 test cd sed export ${HOME} then export local test grep grep
+	echo ${HOME} && readonly /usr/bin
+		echo x=1 cd $(pwd) ${HOME}
+'quoted text' then test | x=1 "$1" echo --verbose cd ${HOME}
+		$(pwd) "$1" /usr/bin && "$@" "$1" 2>/dev/null
+export then /usr/bin $(pwd)
+-eu printf export "$1" -eu x=1 readonly local /usr/bin 'quoted text'
+| | awk "$1" ${HOME} then /usr/bin sed "$@" "$@" --verbose
+export printf && readonly 2>/dev/null grep 'quoted text' local /usr/bin ${HOME}
+		local echo awk awk 'quoted text' $(pwd) echo && "$1"
+echo && readonly -eu
+test x=1 local export local awk 'quoted text'
+		x=1 sed x=1 "$1" grep echo && awk x=1 x=1 export
+	${HOME} then 'quoted text' $(pwd) cd readonly printf grep echo then readonly
+		echo /usr/bin then $(pwd) local done /usr/bin -eu --verbose grep
+test printf 'quoted text' echo $(pwd)
+awk test && readonly "$@" 2>/dev/null cd 'quoted text'
+		cd sed readonly cd 2>/dev/null x=1 then cd sed local readonly -eu
+		printf x=1 'quoted text' "$@" printf
+		echo done 2>/dev/null printf --verbose ${HOME} "$1" "$1" then awk local readonly
+	"$1" "$1" done done | 2>/dev/null
+export sed test done awk --verbose 'quoted text'
+	echo "$1" x=1 awk test then "$1" --verbose cd "$@"
+test && /usr/bin echo --verbose cd test "$1" awk && | local done 2>/dev/null
+		"$1" -eu 'quoted text' "$@" then
+	done /usr/bin sed test
+		'quoted text' printf then -eu x=1 'quoted text'
+	awk && then export sed && && x=1 export
+"$1" && sed local then sed export awk | 2>/dev/null $(pwd)
+	then /usr/bin local grep sed /usr/bin $(pwd) /usr/bin test $(pwd) $(pwd)
+	x=1 grep "$1" printf 'quoted text' $(pwd) awk "$@" grep export && x=1 2>/dev/null
+then -eu ${HOME} -eu x=1 readonly
+then | 'quoted text' 'quoted text' echo export export then 2>/dev/null
+	"$1" ${HOME} -eu x=1 cd sed -eu | grep $(pwd) --verbose
+readonly then -eu "$@" then --verbose readonly export $(pwd) $(pwd) && x=1
+readonly sed /usr/bin | sed --verbose && "$@" /usr/bin done 'quoted text'
+		'quoted text' readonly x=1 local
+	&& 'quoted text' grep done done x=1 awk then printf | readonly awk local 'quoted text'
+local "$@" 'quoted text' | export
+	| ${HOME} 'quoted text' --verbose readonly
+		&& "$@" x=1 $(pwd) x=1 then echo grep done 'quoted text'
+	"$@" export 'quoted text'
+	local x=1 "$@" 'quoted text' export -eu 2>/dev/null
+		'quoted text' -eu awk sed /usr/bin grep --verbose 'quoted text' awk -eu "$@"
+	"$@" cd $(pwd) grep | sed test --verbose grep echo --verbose && "$@" readonly
+	test x=1 2>/dev/null readonly
+--verbose ${HOME} awk
+	--verbose && sed && sed readonly
+grep $(pwd) 2>/dev/null sed ${HOME} grep
+'quoted text' export echo "$@" readonly /usr/bin "$@" echo printf ${HOME}
+then printf done && test 2>/dev/null /usr/bin 'quoted text'
+	done grep grep printf && --verbose 2>/dev/null readonly "$1"
+"$1" awk test "$@" $(pwd) local echo sed awk local -eu awk
+		local ${HOME} /usr/bin awk export 'quoted text' x=1 'quoted text' 'quoted text'
+		export readonly echo $(pwd) "$1" /usr/bin readonly "$@"
+	printf $(pwd) x=1 ${HOME} awk 'quoted text'
+&& -eu grep "$1" readonly "$@" /usr/bin --verbose -eu "$@" printf 2>/dev/null
+	-eu awk $(pwd) /usr/bin "$1" local test readonly then
+	--verbose --verbose cd | awk | sed local ${HOME} 2>/dev/null cd
+		awk -eu $(pwd) x=1 | $(pwd) then 2>/dev/null
+--verbose /usr/bin readonly test awk 2>/dev/null 'quoted text' grep "$1"
+	'quoted text' readonly local "$@" local | x=1
+		"$1" -eu "$1" echo then cd "$@" cd $(pwd) | && "$1" &&
+--verbose readonly --verbose --verbose cd awk done /usr/bin
+x=1 'quoted text' cd echo x=1 | export 'quoted text' done
+'quoted text' cd local -eu /usr/bin
+	sed -eu 'quoted text' sed then done 2>/dev/null
+		grep 'quoted text' printf test printf 'quoted text' 'quoted text'
+2>/dev/null 2>/dev/null echo --verbose 2>/dev/null x=1 -eu readonly
+$(pwd) local 'quoted text' echo test && "$1" printf "$1" "$1" test grep then |
+		local -eu test /usr/bin then echo
+&& "$1" local test test awk
+done echo "$@" readonly grep sed -eu $(pwd) "$@" 'quoted text'
+sed done 2>/dev/null echo "$1" && printf test local
+	export "$1" "$1" "$@" echo 'quoted text'
+		| x=1 x=1 ${HOME} cd | "$1" -eu | local grep grep -eu 'quoted text' grep 2>/dev/null
+export ${HOME} sed ${HOME}
+		sed ${HOME} export export $(pwd) "$1" && /usr/bin
+x=1 'quoted text' echo /usr/bin export export 2>/dev/null && "$1" grep local
+	&& export -eu "$1" sed then
+		cd export && local $(pwd) sed then 'quoted text' 'quoted text' export
+		${HOME} | x=1 export then cd "$1" local test local
+	sed /usr/bin 2>/dev/null awk done -eu awk grep then test awk awk sed cd test $(pwd)
+	2>/dev/null 2>/dev/null test --verbose printf awk
+		| cd export then 2>/dev/null --verbose export echo printf test "$1" grep sed echo
+		then local export ${HOME} test "$1" ${HOME} grep printf /usr/bin
+	cd printf done 2>/dev/null
+	"$1" export 2>/dev/null | 2>/dev/null
+then done 2>/dev/null $(pwd) -eu && export "$1"
+readonly -eu | /usr/bin awk local
+	sed /usr/bin export $(pwd) cd export local /usr/bin local cd "$@" sed echo
+cd readonly then local local printf test ${HOME} x=1 local /usr/bin echo
+"$1" export 2>/dev/null "$@" | 2>/dev/null export -eu | ${HOME} "$1" printf $(pwd)
+		x=1 x=1 x=1 "$1" awk 'quoted text' 2>/dev/null x=1 --verbose readonly local
+test local $(pwd) export echo grep ${HOME} done echo readonly then x=1
+$(pwd) readonly readonly /usr/bin
+		/usr/bin /usr/bin cd local test $(pwd)
+		x=1 cd sed export x=1 then done export 2>/dev/null
+local ${HOME} grep printf -eu then done readonly x=1 export cd
+sed -eu test && done local | -eu test printf 'quoted text' 'quoted text' "$@"
+grep sed awk done "$1" printf export sed |
+done export then ${HOME} printf printf | -eu then
+		sed echo awk | 2>/dev/null then /usr/bin $(pwd) test test echo $(pwd) done
+	| awk ${HOME} awk sed local grep
+		echo done 'quoted text'
+		done "$1" then then done "$1" --verbose
+"$@" 2>/dev/null /usr/bin cd local cd sed then then sed awk awk x=1
+	$(pwd) printf 2>/dev/null -eu 2>/dev/null 'quoted text' | then echo
+	/usr/bin | export local printf
+sed sed "$1" export --verbose ${HOME} x=1 sed echo "$1" 'quoted text' sed sed
+x=1 --verbose export && "$@" grep 'quoted text' x=1 'quoted text'
+$(pwd) x=1 "$1" awk awk awk awk /usr/bin ${HOME} local export local sed export
+	"$@" -eu "$@" 'quoted text'
+	"$1" local --verbose && echo && done /usr/bin --verbose
+	then cd -eu echo -eu "$@" local printf $(pwd) | sed $(pwd)
+$(pwd) -eu $(pwd) sed "$1"
+		echo x=1 grep awk --verbose x=1 "$1" ${HOME} 'quoted text' | local x=1 ${HOME}
+${HOME} local "$1" echo /usr/bin test cd done test grep
+		x=1 awk test test printf "$@" $(pwd) ${HOME} 'quoted text' test awk --verbose
+	| "$1" done ${HOME} then printf awk readonly | printf x=1 'quoted text'
+	| 'quoted text' 'quoted text' printf /usr/bin echo done local ${HOME} test sed "$@"
+&& printf sed -eu grep |
+		export readonly then grep x=1 --verbose sed $(pwd) printf -eu
+grep printf test sed cd readonly $(pwd) grep 'quoted text' 'quoted text'
+		sed grep -eu ${HOME} grep
+		awk x=1 'quoted text' sed readonly readonly
+		then printf awk 2>/dev/null
+		2>/dev/null | cd -eu local -eu test readonly ${HOME} test "$1" grep "$1" $(pwd)
+	sed cd ${HOME} 'quoted text' /usr/bin sed 'quoted text'
+	'quoted text' grep | $(pwd) 'quoted text'
+	$(pwd) grep && cd | cd printf | echo awk export
+	export sed --verbose local "$1" ${HOME}
+		x=1 cd && ${HOME} --verbose 2>/dev/null 'quoted text'
+--verbose ${HOME} && sed "$@" sed printf
+	-eu export -eu && printf grep 'quoted text' done 2>/dev/null
+		&& | x=1 readonly "$1" /usr/bin && sed && local cd --verbose grep | readonly
+printf | --verbose grep
+	cd --verbose 2>/dev/null "$1" then sed --verbose export
+	grep echo grep sed then | 2>/dev/null "$1" "$@" ${HOME} grep $(pwd) x=1 grep
+	&& readonly sed local awk | local cd /usr/bin 'quoted text' awk && export
+		&& cd printf "$@" cd /usr/bin /usr/bin export "$1" $(pwd)
+		test export echo sed -eu 2>/dev/null local "$1" 2>/dev/null sed cd &&
+		printf grep printf ${HOME} -eu "$@" -eu x=1
+2>/dev/null -eu grep 2>/dev/null
+then && sed -eu local $(pwd) printf
+	--verbose sed cd $(pwd) && "$@" | then cd awk -eu | readonly export && export
+		local "$1" --verbose --verbose
+readonly local ${HOME} ${HOME} $(pwd) "$1" done sed
+-eu then $(pwd) local "$1" /usr/bin "$1" test grep
+		grep "$@" done x=1 export printf ${HOME} -eu "$@"
+	readonly awk grep | cd done ${HOME} export done $(pwd) grep awk
+grep x=1 export ${HOME} printf
+	${HOME} 2>/dev/null export
+	local 'quoted text' done 'quoted text'
+	'quoted text' /usr/bin sed "$@" echo
+		--verbose && "$@" 'quoted text'
+		x=1 "$1" --verbose && awk export 2>/dev/null
+| awk -eu readonly /usr/bin test test -eu export export cd export readonly
+	local --verbose --verbose $(pwd) --verbose "$@" cd | export
+	sed cd export 'quoted text' --verbose sed readonly
+		x=1 sed --verbose awk && echo | echo 2>/dev/null x=1 --verbose $(pwd)
+		--verbose "$@" test done export printf
+cd | test "$1" cd 'quoted text' x=1 -eu then &&
+		x=1 && $(pwd) && export 'quoted text' printf 2>/dev/null
+	$(pwd) readonly "$@" done $(pwd) echo grep then sed
+	echo sed "$@" cd test export done "$1" $(pwd) "$@" printf awk
+	echo --verbose /usr/bin | ${HOME} done 'quoted text' then && && /usr/bin
+	"$1" then sed $(pwd) && printf && export readonly
+--verbose awk local local echo &&
+		"$@" --verbose export --verbose | --verbose done local && | /usr/bin
+		$(pwd) export /usr/bin && | -eu export echo then test sed 'quoted text'
+done "$@" 2>/dev/null "$@" printf readonly "$1" awk export grep local sed
+cd sed readonly test "$1" | && ${HOME} printf sed 'quoted text' then --verbose
+		then awk -eu /usr/bin grep local readonly
+	x=1 $(pwd) grep export
+awk printf then printf x=1
+local readonly then printf
+	2>/dev/null then test "$@" "$@" grep then awk | ${HOME} cd grep export "$@"
+| cd x=1 readonly awk ${HOME} && local ${HOME} local done &&
+		then local 'quoted text' 2>/dev/null
+		printf $(pwd) local "$@"
+		x=1 printf --verbose sed local cd && then
+		done 2>/dev/null export /usr/bin
+		awk test ${HOME} cd x=1 | -eu
+&& -eu awk -eu --verbose /usr/bin x=1 ${HOME} done export
+echo 'quoted text' done "$@" 'quoted text' awk test done "$1" sed export test
+	local 2>/dev/null readonly
+readonly readonly awk readonly awk echo --verbose export echo |
+local export "$1" test grep 2>/dev/null -eu /usr/bin awk cd ${HOME} printf
+$(pwd) grep done export x=1 echo
+		local && echo done /usr/bin x=1 --verbose x=1 --verbose
+		/usr/bin printf --verbose "$1" && -eu grep /usr/bin && | awk "$@"
+awk then done grep printf -eu local && /usr/bin
+readonly "$@" "$1" 2>/dev/null /usr/bin -eu
+| done grep x=1 printf /usr/bin
+		/usr/bin done ${HOME} | then && sed ${HOME} ${HOME}
+		'quoted text' "$@" cd done
+	local && --verbose "$@"
+	sed awk && then cd ${HOME} echo "$1" cd test printf
+		echo 2>/dev/null --verbose printf echo grep
+x=1 "$1" --verbose then cd ${HOME}
+		"$@" x=1 cd echo 2>/dev/null x=1 ${HOME} grep x=1 local done readonly done /usr/bin
+echo echo done $(pwd) sed --verbose
+-eu echo printf then 2>/dev/null
+		-eu echo local x=1 readonly ${HOME} ${HOME} cd /usr/bin readonly &&
+"$1" test grep awk export test x=1
+	--verbose x=1 'quoted text' "$@" local ${HOME} export "$1" test
+	| "$1" done | 2>/dev/null then /usr/bin then test 'quoted text'
+	awk local local ${HOME} awk --verbose
+		awk printf -eu awk echo then readonly local grep awk 'quoted text' local --verbose
+"$@" $(pwd) "$@" echo "$1" grep local && awk -eu local --verbose -eu
+	then sed $(pwd) 'quoted text' cd x=1 --verbose printf 'quoted text'
+	local | done "$@" 2>/dev/null
+		cd awk ${HOME} 'quoted text' | && awk export printf x=1
+	'quoted text' sed export "$@" 'quoted text' && sed printf grep echo ${HOME}
+		--verbose $(pwd) printf 'quoted text' sed 2>/dev/null 'quoted text'
+	readonly --verbose cd echo printf "$@"
+		done && test 2>/dev/null done done echo 'quoted text' test "$1"
+		'quoted text' local grep then local local readonly readonly $(pwd) ${HOME} | ${HOME}
+		-eu 2>/dev/null $(pwd) export readonly grep done 'quoted text' local then
+		export awk $(pwd) -eu --verbose grep then ${HOME} "$1" printf
+	printf -eu ${HOME} echo cd readonly
+awk echo printf ${HOME} && "$1" test | export 2>/dev/null
+		${HOME} awk done ${HOME} export 'quoted text' done
+		printf test grep 2>/dev/null 2>/dev/null
+/usr/bin cd readonly 'quoted text' | then
+	awk -eu && export awk -eu sed $(pwd)
+		grep cd $(pwd) && "$1" 'quoted text' then echo
+printf $(pwd) -eu cd && grep 'quoted text'
+-eu "$1" x=1 local export cd | cd printf "$1"
+	export test cd 'quoted text' 'quoted text' then awk
+		2>/dev/null && ${HOME} /usr/bin /usr/bin cd sed -eu 2>/dev/null
+		grep | export sed 'quoted text' done then 2>/dev/null echo --verbose
+		$(pwd) /usr/bin test grep --verbose 'quoted text'
+		2>/dev/null /usr/bin grep "$@" 'quoted text' 'quoted text'
+	"$1" done -eu printf printf awk "$1" && /usr/bin
+readonly && --verbose "$1" ${HOME}
+&& | "$1" /usr/bin export --verbose /usr/bin /usr/bin
+	2>/dev/null 'quoted text' "$1" export 'quoted text'
+	sed done 2>/dev/null "$1" grep grep ${HOME} 'quoted text'
+-eu "$1" cd sed --verbose awk export local --verbose -eu
+${HOME} readonly readonly sed ${HOME} --verbose awk export -eu
+	-eu x=1 $(pwd) "$1" test readonly printf -eu grep echo then printf
+		| x=1 printf ${HOME} sed -eu cd x=1 -eu -eu printf
+		'quoted text' export
+test && grep --verbose done echo done ${HOME} then "$@" local --verbose
+		-eu x=1 then ${HOME} x=1 sed | echo
+		--verbose 2>/dev/null readonly 'quoted text' readonly
+	then grep | x=1 "$1" --verbose | "$@" 'quoted text'
+		| "$@" readonly printf
+	&& readonly 2>/dev/null cd cd | && "$@" "$@" --verbose
+test local grep $(pwd) export grep readonly
+"$@" grep "$@" grep sed --verbose --verbose --verbose "$@" 'quoted text'
+	| ${HOME} x=1 printf /usr/bin && sed "$@" grep echo then
+cd done then ${HOME} done --verbose
+		awk x=1 awk echo --verbose done
+-eu local | /usr/bin awk | readonly grep x=1 "$@" | && sed
+/usr/bin && awk 'quoted text' /usr/bin printf "$@"
+printf local -eu local | then ${HOME} && --verbose cd sed export
+printf readonly export $(pwd) -eu
+/usr/bin x=1 | cd ${HOME} $(pwd) ${HOME} /usr/bin sed cd /usr/bin then
+		readonly export sed done ${HOME} test "$1"
+	"$1" then 'quoted text' /usr/bin local export awk -eu awk x=1 "$1" && -eu /usr/bin
+test echo printf x=1 $(pwd) grep "$@"
+	${HOME} cd grep printf grep awk /usr/bin "$@"
+	readonly awk then grep "$1" export "$@" cd awk x=1 readonly
+	cd | /usr/bin printf grep sed 'quoted text' -eu /usr/bin local awk echo
+		"$@" awk local "$1" -eu $(pwd) | x=1 x=1 "$1" && done echo
+		test && sed -eu "$@" | --verbose done awk && 2>/dev/null
+		${HOME} "$@" test grep $(pwd) --verbose /usr/bin then /usr/bin ${HOME}
+${HOME} test printf |
+		2>/dev/null export awk 'quoted text'
+	$(pwd) --verbose --verbose readonly test echo 2>/dev/null
+		"$@" ${HOME} "$@" readonly sed -eu
+	awk readonly | ${HOME} local
+"$@" $(pwd) x=1 "$@" grep 'quoted text' sed awk "$@"
+	&& "$@" --verbose printf export then local /usr/bin
+/usr/bin printf sed "$1" grep "$@" local grep 'quoted text' sed x=1 "$@" "$1"
+	export | | test ${HOME} printf readonly export x=1 export 2>/dev/null test "$1"
+	printf cd done local ${HOME} local printf then cd readonly | "$@" test
+		printf sed 2>/dev/null x=1 x=1 test sed 2>/dev/null | done local -eu "$@" readonly
+	printf | /usr/bin --verbose /usr/bin sed
+	--verbose grep grep echo ${HOME} test printf local export --verbose
+		'quoted text' $(pwd) cd test x=1 then $(pwd) &&
+awk cd $(pwd) --verbose 'quoted text' ${HOME} export printf x=1
+	&& echo local && && echo export printf x=1
+		'quoted text' printf awk
+$(pwd) awk && cd test grep test awk 2>/dev/null /usr/bin printf
+grep test x=1 test | && printf "$@"
+		"$@" && echo grep local -eu echo 2>/dev/null /usr/bin done | 'quoted text' readonly
+	&& then | awk && 'quoted text' then
+		awk /usr/bin done then | then grep $(pwd) printf --verbose export sed
+| echo export $(pwd) /usr/bin test | grep grep cd /usr/bin --verbose | local x=1
+	echo --verbose printf "$@"
+		'quoted text' --verbose done done 'quoted text'
+	sed awk cd | echo done x=1 'quoted text' "$1" --verbose "$1" local
+	-eu local cd cd && echo | "$@" echo
+	echo test sed 'quoted text' printf -eu printf x=1 export cd echo /usr/bin $(pwd)
+	export readonly --verbose ${HOME} "$1" printf -eu x=1 "$1" /usr/bin echo -eu
+readonly printf grep x=1 done ${HOME} x=1 echo awk
+$(pwd) done && done | && test then grep export x=1 ${HOME} readonly
+	'quoted text' local -eu grep x=1 /usr/bin grep
+	"$1" then 2>/dev/null x=1 && ${HOME}
+test ${HOME} done "$1" "$@" --verbose then echo
+		"$@" sed sed 2>/dev/null x=1 | cd
+		printf printf readonly local 2>/dev/null "$@" export $(pwd)
+		x=1 x=1 readonly 'quoted text' $(pwd) cd grep done
+		$(pwd) sed awk "$1" &&
+-eu /usr/bin grep test 2>/dev/null
+		printf 2>/dev/null export | readonly 'quoted text' readonly
+		--verbose | sed /usr/bin awk | readonly | awk awk
+		printf -eu readonly -eu printf /usr/bin export $(pwd) test echo grep
+		$(pwd) "$1" 2>/dev/null | done printf then sed readonly x=1 x=1
+	-eu echo -eu export then $(pwd) done
+		--verbose then /usr/bin printf | "$1" grep
+	grep done printf awk export --verbose | --verbose /usr/bin $(pwd)
+export $(pwd) /usr/bin awk local && awk sed | echo grep 2>/dev/null "$@" awk
+		export echo | test printf cd 2>/dev/null grep cd
+'quoted text' awk local && "$1" 'quoted text' done readonly /usr/bin $(pwd)
+		grep export grep then local export done x=1 cd x=1 printf x=1 -eu
+	--verbose | test | export echo awk cd test 2>/dev/null
+echo sed --verbose export x=1 done 'quoted text' -eu export
+awk echo -eu "$@" awk ${HOME} export "$1" && 'quoted text' grep 2>/dev/null
+		'quoted text' --verbose
+		awk x=1 "$1" && 'quoted text' export ${HOME} /usr/bin printf export ${HOME}
+	then done test printf --verbose grep export grep --verbose
+"$@" awk echo grep cd
+&& sed then echo --verbose
+		then 2>/dev/null && test printf awk "$@" sed /usr/bin grep $(pwd) "$1" local
+echo 'quoted text' 2>/dev/null $(pwd) -eu grep x=1 sed /usr/bin export
+export -eu done -eu cd grep sed "$@" awk readonly awk readonly
+cd readonly 2>/dev/null 2>/dev/null
+	--verbose ${HOME} "$@" $(pwd) && --verbose test local | then then -eu
+		/usr/bin grep -eu && local test "$1" && 2>/dev/null
+		printf "$@" --verbose grep export -eu /usr/bin export -eu done /usr/bin
+		sed export then $(pwd) sed && "$@" cd grep local
+x=1 then test /usr/bin sed echo --verbose /usr/bin x=1 echo --verbose test
+	--verbose && && "$@" local -eu export done grep echo x=1 --verbose
+&& awk then test 'quoted text' echo done test 2>/dev/null
+	2>/dev/null export $(pwd)
+		| $(pwd) then echo export test | test then grep export ${HOME} 2>/dev/null
+	$(pwd) -eu done --verbose sed x=1 grep /usr/bin grep | local
+	&& $(pwd) grep "$@" "$@" awk |
+	-eu cd $(pwd) 'quoted text' sed awk /usr/bin x=1
+	done awk 2>/dev/null | "$1" awk test ${HOME} local done | | -eu done 2>/dev/null
+--verbose awk "$@" done readonly --verbose
+	"$1" ${HOME} sed --verbose export readonly 2>/dev/null export
+	'quoted text' echo 2>/dev/null "$@" 'quoted text' "$@" "$@" echo
+		"$1" printf cd grep local cd 2>/dev/null
+	| && sed test | ${HOME} then awk awk
+		&& ${HOME} 2>/dev/null $(pwd) --verbose /usr/bin export
+'quoted text' "$1" -eu cd cd cd awk | --verbose done 2>/dev/null
+local cd "$@" "$1" export ${HOME}
+		$(pwd) grep export /usr/bin awk then | readonly /usr/bin readonly
+x=1 /usr/bin $(pwd) /usr/bin printf /usr/bin export
+sed export then x=1 x=1 "$@" awk "$@" local --verbose local awk "$1"
+	echo cd && && then cd local echo "$1" grep "$1" | sed awk |
+cd sed -eu grep test printf --verbose test printf done | local -eu local sed cd
+	-eu echo $(pwd) --verbose cd 'quoted text' --verbose ${HOME}
+local echo --verbose 'quoted text'
+x=1 export ${HOME} | export 'quoted text' sed
+		| ${HOME} sed | x=1 cd test
+	| ${HOME} local "$@" done $(pwd) export 'quoted text'
+local cd x=1 --verbose export 2>/dev/null readonly awk local
+		| "$@" 2>/dev/null then local awk then cd $(pwd) "$1" sed export
+then then echo /usr/bin 'quoted text' -eu awk x=1 printf /usr/bin echo local
+	local grep x=1 "$@" done local echo 'quoted text'
+	x=1 "$1" then "$1" -eu "$1" --verbose echo --verbose
+		x=1 awk test then echo test sed export
+		sed echo readonly export x=1 /usr/bin "$@" x=1 cd 'quoted text' 'quoted text'
+		"$@" done local "$1" printf 2>/dev/null awk sed | /usr/bin grep | grep
+	echo 'quoted text' local --verbose local printf
+		2>/dev/null printf /usr/bin | /usr/bin ${HOME} 2>/dev/null printf
+		done cd $(pwd) "$1" 'quoted text'
+		local --verbose $(pwd) /usr/bin sed --verbose | export
+--verbose test test export awk test $(pwd) cd /usr/bin
+echo echo local grep -eu grep sed local "$@" ${HOME} --verbose
+readonly -eu awk grep && grep ${HOME} $(pwd) sed done /usr/bin && awk sed
+${HOME} sed printf then grep && done export x=1 test 'quoted text'
+		then done 2>/dev/null "$1" /usr/bin echo /usr/bin export
+	local then /usr/bin 2>/dev/null
+	$(pwd) cd printf 2>/dev/null x=1 export ${HOME} cd x=1 $(pwd) export export local
+--verbose then -eu echo | test printf
+		echo | "$1" printf grep grep --verbose 'quoted text' /usr/bin
+	export done 2>/dev/null test "$@" test done readonly /usr/bin
+		test grep then --verbose ${HOME} $(pwd) export
+-eu done 'quoted text' 2>/dev/null echo
+		"$1" "$1" x=1 sed readonly 'quoted text' then "$@"
+		-eu cd "$1" then 2>/dev/null ${HOME} && 'quoted text' cd | "$1" x=1 x=1 sed "$1"
+		"$@" cd ${HOME} done cd export local "$1" ${HOME} "$1" "$@" -eu -eu done
+		-eu -eu grep readonly -eu | -eu "$1" echo then awk 2>/dev/null grep printf
+		&& then "$@" echo $(pwd) $(pwd) local local
+	"$1" x=1 2>/dev/null printf grep -eu ${HOME}
+		/usr/bin done export readonly done readonly x=1 2>/dev/null
+cd done /usr/bin export awk readonly echo /usr/bin
+		grep x=1 printf && 2>/dev/null then done
+		readonly awk done && echo
+		/usr/bin "$1" then local $(pwd)
+awk then test done grep readonly | ${HOME} local "$1" -eu /usr/bin
+${HOME} cd test export awk cd "$@" done -eu cd
+readonly && x=1 'quoted text' echo 'quoted text' /usr/bin
+	awk --verbose "$@" -eu then 'quoted text' printf
+	| echo --verbose grep awk export
+"$@" export grep && "$@" -eu "$@" $(pwd) export readonly 2>/dev/null
+		printf test $(pwd) readonly printf done
+	"$@" ${HOME} test && x=1 printf printf
+	awk /usr/bin done readonly printf then 'quoted text' printf x=1 -eu readonly
+	sed x=1 readonly && 'quoted text' 2>/dev/null ${HOME} done then cd grep
+x=1 "$@" printf done "$@" then
+"$1" sed /usr/bin test 2>/dev/null "$@"
+		&& awk readonly && test && readonly
+&& done test && 2>/dev/null export /usr/bin then export
+		echo printf -eu test --verbose awk readonly
+	sed "$@" cd test -eu sed ${HOME} 'quoted text' grep then -eu 'quoted text'
+sed awk printf -eu ${HOME} --verbose
+		--verbose 2>/dev/null echo then | done 'quoted text' export 'quoted text' then
+	"$@" echo printf "$1" 2>/dev/null grep $(pwd) "$1" ${HOME}
+	echo done awk done "$@"
+	printf /usr/bin x=1 'quoted text' 'quoted text' /usr/bin echo "$1" --verbose
+	test awk done then ${HOME} 'quoted text' /usr/bin ${HOME} printf
+${HOME} /usr/bin then ${HOME} 'quoted text'
+		sed echo local readonly --verbose /usr/bin
+printf readonly -eu --verbose x=1
+	done echo 2>/dev/null --verbose sed | | x=1 "$@" "$@" sed 2>/dev/null export "$@"
+		then "$@" -eu readonly printf sed printf awk done readonly 2>/dev/null
+		x=1 echo awk awk local test cd /usr/bin /usr/bin -eu cd sed && export done
+	${HOME} local $(pwd) echo printf local grep readonly x=1 ${HOME} done --verbose
+	-eu 'quoted text' done readonly /usr/bin sed 'quoted text' 2>/dev/null test
+		export 'quoted text' awk
+		-eu readonly test echo --verbose sed 'quoted text' local sed sed grep "$1" ${HOME}
+		| $(pwd) grep x=1 cd test /usr/bin done export -eu readonly echo ${HOME}
+	'quoted text' "$@" grep && readonly -eu "$1" awk awk grep $(pwd) $(pwd) "$@" ${HOME}
+	echo awk done done readonly readonly /usr/bin printf | done | readonly
+readonly grep echo then test ${HOME} $(pwd)
+2>/dev/null ${HOME} $(pwd) then --verbose test ${HOME} $(pwd) echo
+	sed printf readonly && $(pwd) -eu $(pwd)
+		grep "$1" -eu echo /usr/bin then printf printf --verbose echo 'quoted text' "$1"
+	-eu /usr/bin echo 'quoted text' "$1" test
+$(pwd) "$1" -eu sed then -eu export x=1 $(pwd) then "$1" /usr/bin
+	then && 2>/dev/null /usr/bin ${HOME} 'quoted text' cd
+awk export $(pwd) 2>/dev/null $(pwd) 'quoted text'
+"$@" ${HOME} "$1" local "$1"
+	"$@" cd "$1" 'quoted text' | ${HOME} local 2>/dev/null export $(pwd) test readonly
+	x=1 'quoted text' | | cd printf
+		${HOME} 2>/dev/null export local 'quoted text' "$1"
+		test ${HOME} "$@" ${HOME}
+		done awk sed ${HOME} export echo local readonly
+		export $(pwd) -eu printf
+		x=1 sed export test 2>/dev/null done grep done
+	done printf /usr/bin sed | /usr/bin
+	&& /usr/bin -eu then awk "$@" readonly /usr/bin $(pwd) |
+		&& echo && "$@" test then awk
+		"$1" awk 2>/dev/null --verbose
+		-eu awk | "$@" then cd awk done
+	${HOME} printf && && readonly -eu grep then ${HOME} awk x=1 -eu $(pwd)
+		-eu x=1 echo local export $(pwd) sed 'quoted text' $(pwd) done
+		/usr/bin printf grep "$@" "$1" "$1" then
+	| --verbose "$1" | && /usr/bin cd 2>/dev/null | done ${HOME}
+	${HOME} echo printf local $(pwd)
+		x=1 then --verbose local -eu && $(pwd) /usr/bin
+	"$1" $(pwd) 'quoted text' grep --verbose
+	awk then --verbose sed | 'quoted text' grep printf ${HOME} awk -eu /usr/bin
+&& export ${HOME} printf "$1"
+	readonly "$@" --verbose awk readonly --verbose --verbose
+x=1 2>/dev/null cd test 2>/dev/null
+"$1" 'quoted text' 2>/dev/null $(pwd) ${HOME} "$1" x=1
+'quoted text' cd echo x=1 export x=1 'quoted text' /usr/bin
+export -eu awk ${HOME} done x=1 readonly export
+test 'quoted text' test awk ${HOME}
+	-eu $(pwd) grep awk x=1 "$1" | --verbose export --verbose grep $(pwd)
+		2>/dev/null $(pwd) test
+		$(pwd) "$1" then awk cd done && "$@" then -eu
+printf test 2>/dev/null done sed readonly --verbose
+	| --verbose done test done test sed echo readonly printf "$1" local cd done
+then && x=1 /usr/bin --verbose | "$1" | 'quoted text' --verbose
+test awk awk sed --verbose
+awk -eu echo cd echo "$1" readonly
+	| test cd 'quoted text' local -eu $(pwd)
+export x=1 grep /usr/bin "$@" ${HOME} $(pwd)
+		done then && x=1 | | printf then x=1 export echo x=1 readonly | -eu echo
+&& grep cd sed sed --verbose test grep /usr/bin /usr/bin echo
+		2>/dev/null local awk /usr/bin && awk "$@" then $(pwd) printf x=1 ${HOME}
+	2>/dev/null "$1" /usr/bin
+		cd 'quoted text' /usr/bin --verbose local $(pwd)
@@ -0,0 +1,2001 @@
+	echo 2>/dev/null ${HOME} export "$1" done ${HOME} 'quoted text' cd x=1 | echo local
+		local 'quoted text' -eu x=1 awk local test then
+	printf local | --verbose "$@" 2>/dev/null | -eu readonly
+	sed readonly echo done awk $(pwd) "$@" "$1" then test --verbose
+	&& readonly $(pwd) && then cd sed local 'quoted text' |
+		/usr/bin local export local
+	then /usr/bin -eu local $(pwd) --verbose test "$1" "$@" /usr/bin then echo ${HOME}
+test x=1 --verbose grep x=1 then grep ${HOME} 'quoted text' local
+	2>/dev/null cd | && x=1
+	readonly 2>/dev/null x=1 $(pwd) grep printf
+		"$@" x=1 x=1 local | "$@" awk && done 2>/dev/null
+		echo cd "$@" $(pwd) $(pwd) /usr/bin printf test done /usr/bin ${HOME} test | x=1
+		grep && cd sed sed sed | x=1 && export /usr/bin x=1 test
+	readonly ${HOME} ${HOME} ${HOME} sed 2>/dev/null
+cd printf echo "$1" "$@" then -eu -eu awk 'quoted text'
+		local sed $(pwd) cd -eu /usr/bin "$1" x=1 "$@"
+		| readonly -eu done /usr/bin done awk --verbose test 'quoted text' sed
+export export export "$@"
+		${HOME} awk "$1" "$1" grep
+		sed 'quoted text' cd done x=1 awk -eu 'quoted text' done cd "$1" "$@" awk | |
+	&& $(pwd) -eu | "$1" echo "$1"
+	&& then $(pwd) /usr/bin
+	/usr/bin --verbose x=1 readonly ${HOME}
+	-eu 'quoted text' && x=1 grep $(pwd) ${HOME} --verbose
+		done --verbose "$@" readonly export 'quoted text'
+	| test /usr/bin ${HOME} printf $(pwd) 2>/dev/null sed local --verbose
+	grep export printf $(pwd) /usr/bin export awk && echo x=1
+		readonly test "$@" 'quoted text' local readonly $(pwd) then
+		2>/dev/null 2>/dev/null cd grep | test $(pwd) then
+export test test 'quoted text' "$1" grep done cd done "$@" done sed /usr/bin
+	grep then && cd --verbose
+grep 2>/dev/null cd echo test readonly awk echo grep awk cd x=1 readonly
+		done test "$@" --verbose && 2>/dev/null "$1" done
+		export -eu --verbose test --verbose grep | done done test grep $(pwd)
+	&& cd 'quoted text' local done x=1 ${HOME} | then printf grep --verbose
+"$1" printf 'quoted text' done readonly test cd /usr/bin | --verbose
+		sed cd 2>/dev/null "$@" -eu done done && $(pwd) && -eu done
+export /usr/bin then sed done | sed | export /usr/bin /usr/bin grep 'quoted text'
+		awk "$@" && x=1 cd printf test sed
+		grep awk 'quoted text' --verbose ${HOME} grep | local cd &&
+		echo printf grep --verbose 'quoted text' "$1" | 'quoted text' $(pwd) done readonly
+	echo printf sed test grep cd --verbose --verbose export && awk grep then export
+		$(pwd) export export | then "$1" "$1" test ${HOME} echo cd /usr/bin -eu && x=1
+	"$@" export local x=1 /usr/bin test done --verbose awk
+	awk readonly sed export | ${HOME} && --verbose readonly -eu
+	readonly cd printf echo cd && "$1" printf 'quoted text' && export test
+		local sed "$@" local x=1 | test local echo 2>/dev/null grep &&
+	--verbose "$1" test "$1"
+		test test --verbose sed
+printf -eu local test grep "$@" $(pwd)
+grep "$@" sed && $(pwd) printf echo
+	&& export cd sed sed 'quoted text' local "$1"
+		echo done cd sed export export x=1 "$1" printf export x=1 grep /usr/bin cd echo
+	sed printf -eu done /usr/bin 'quoted text'
+${HOME} grep | 'quoted text'
+		local awk printf awk export -eu then test $(pwd) "$1" done export 2>/dev/null
+		${HOME} export x=1 export echo done grep /usr/bin awk 2>/dev/null
+	2>/dev/null local export | done then 2>/dev/null then test ${HOME} 2>/dev/null
+	2>/dev/null /usr/bin ${HOME}
+	done sed sed "$1" test grep | sed
+	echo test readonly 'quoted text' awk x=1 grep test
+	/usr/bin 2>/dev/null 'quoted text' -eu ${HOME}
+		'quoted text' awk /usr/bin 'quoted text'
+		&& then /usr/bin grep && "$1" 'quoted text' echo 'quoted text'
+2>/dev/null 'quoted text' awk /usr/bin $(pwd) local | "$@" export
+		test then grep -eu $(pwd) done && 'quoted text'
+	sed /usr/bin awk readonly ${HOME} /usr/bin
+	x=1 then sed sed export | && --verbose 2>/dev/null readonly
+		--verbose 'quoted text' printf readonly echo "$@"
+		printf printf local $(pwd)
+${HOME} 'quoted text' --verbose awk -eu "$@" readonly sed sed $(pwd) && "$@"
+"$1" x=1 grep && local "$@" "$@" done "$@" printf cd "$1" x=1 -eu then then "$1"
+		sed export 2>/dev/null $(pwd) && ${HOME}
+		local then x=1 export done ${HOME} --verbose done | "$1" printf
+then awk export done ${HOME} printf
+		--verbose && sed -eu | /usr/bin local printf grep grep 'quoted text'
+		then grep printf ${HOME} readonly
+	2>/dev/null done $(pwd) test ${HOME} 2>/dev/null sed export --verbose
+"$1" test x=1 'quoted text' echo awk && echo grep readonly echo
+local /usr/bin 'quoted text' readonly
+		x=1 sed | local readonly printf x=1 && export awk x=1 | echo $(pwd) /usr/bin
+	done awk $(pwd) "$1" local readonly printf && $(pwd) echo && done readonly
+test printf cd 'quoted text' ${HOME} printf done -eu | echo local
+		/usr/bin echo --verbose /usr/bin done -eu | /usr/bin cd awk local local grep
+		/usr/bin && 'quoted text' then local grep && awk | "$1" readonly awk
+	grep 2>/dev/null test then x=1 test readonly --verbose echo x=1 x=1 ${HOME}
+| ${HOME} 'quoted text' && | echo cd $(pwd)
+--verbose /usr/bin readonly awk readonly sed
+		"$1" -eu --verbose "$@"
+$(pwd) test ${HOME} test -eu cd $(pwd) local test awk $(pwd) "$@" $(pwd) cd grep
+${HOME} --verbose test awk /usr/bin "$@"
+		grep "$1" awk export $(pwd) grep | local sed
+local echo grep echo echo "$@"
+		cd test "$@" /usr/bin x=1 printf printf awk && grep echo --verbose 2>/dev/null
+/usr/bin then grep $(pwd) test 'quoted text' ${HOME}
+		local x=1 cd && echo echo 'quoted text'
+		readonly | "$@" 2>/dev/null awk done | | done ${HOME} ${HOME} sed $(pwd)
+	x=1 local "$1" grep local "$@" done test "$@" local done ${HOME}
+		x=1 $(pwd) ${HOME} --verbose "$@" done cd --verbose
+&& sed grep export test
+local $(pwd) --verbose ${HOME} local ${HOME} /usr/bin 2>/dev/null cd echo 'quoted text'
+	x=1 sed 2>/dev/null x=1 "$@" cd echo $(pwd) grep test echo local export
+	$(pwd) "$@" grep "$1" done export awk /usr/bin test x=1 'quoted text'
+		echo cd -eu ${HOME} test export "$@" local | --verbose readonly export awk echo
+		"$@" grep --verbose printf awk -eu test -eu --verbose local "$1" awk then --verbose
+	'quoted text' readonly done export x=1 --verbose 2>/dev/null 'quoted text'
+	done --verbose && echo cd grep readonly && $(pwd) 'quoted text' x=1 echo cd --verbose
+local x=1 && echo "$@" printf done cd $(pwd) &&
+		awk $(pwd) --verbose done export
+		$(pwd) awk && sed x=1 $(pwd) printf
+/usr/bin --verbose readonly
+		x=1 | done local 2>/dev/null $(pwd)
+		| local printf "$@" -eu then export echo then && printf
+	/usr/bin echo 'quoted text' x=1 readonly
+		&& 'quoted text' grep x=1 -eu grep printf --verbose echo awk 2>/dev/null
+		sed test -eu "$@" sed --verbose
+test export --verbose cd local grep readonly 'quoted text' -eu
+	2>/dev/null then cd 'quoted text'
+		test 'quoted text' printf "$1"
+"$@" export "$@" -eu -eu sed 'quoted text' local 2>/dev/null /usr/bin done awk
+/usr/bin "$@" done then "$@" $(pwd) $(pwd) local x=1
+${HOME} -eu /usr/bin echo
+export ${HOME} "$@" 'quoted text' && | readonly --verbose 2>/dev/null
+		${HOME} | grep grep "$1"
+	test && | "$@" 'quoted text' && -eu "$1" test test sed cd /usr/bin echo --verbose
+		--verbose export printf
+then local done && grep | $(pwd) sed && test | "$@" sed cd test then &&
+	/usr/bin "$1" 2>/dev/null $(pwd) test /usr/bin /usr/bin /usr/bin echo x=1 grep
+		sed 2>/dev/null local /usr/bin $(pwd) --verbose ${HOME} test printf
+printf $(pwd) ${HOME} printf echo echo local local 'quoted text'
+grep "$1" /usr/bin grep | local
+	echo | then test "$@" readonly test then -eu grep printf /usr/bin
+		done ${HOME} | cd "$@" "$1" export export && sed && done awk 2>/dev/null
+sed "$@" then printf
+${HOME} awk ${HOME} $(pwd) 2>/dev/null ${HOME} "$@" | done grep /usr/bin x=1
+| 'quoted text' sed 2>/dev/null readonly /usr/bin echo printf
+	grep local $(pwd) sed 'quoted text' "$@" -eu sed then test done cd $(pwd) printf
+done 'quoted text' awk readonly local x=1 cd 2>/dev/null sed --verbose
+		awk $(pwd) /usr/bin -eu "$1" done cd "$1" 'quoted text' && --verbose
+| test echo "$@" readonly grep | x=1 grep sed 'quoted text'
+	done 'quoted text' /usr/bin && test awk awk && test /usr/bin 2>/dev/null -eu
+	local export ${HOME} test export grep "$1" then --verbose $(pwd)
+&& test $(pwd) /usr/bin
+	local cd "$1" local printf awk
+	| printf sed -eu && local && export readonly
+	cd grep $(pwd) then /usr/bin done done "$1"
+2>/dev/null test && "$1" cd --verbose done /usr/bin test echo /usr/bin
+/usr/bin "$@" && then "$@" test x=1 ${HOME}
+		done then /usr/bin grep
+-eu -eu cd echo && 'quoted text' x=1 readonly grep export done 'quoted text'
+		then 2>/dev/null grep ${HOME} |
+	$(pwd) "$@" cd | "$1" -eu 2>/dev/null -eu -eu 'quoted text'
+		export awk printf $(pwd) "$1" awk grep $(pwd) export sed "$1" "$@" | then
+	"$1" ${HOME} -eu -eu test "$1" readonly && cd "$@"
+2>/dev/null x=1 $(pwd) then
+${HOME} grep -eu local "$1" && then grep 'quoted text'
+		--verbose --verbose | awk printf done readonly 2>/dev/null 'quoted text' grep
+		$(pwd) x=1 readonly -eu awk 2>/dev/null 'quoted text' printf cd "$@"
+	$(pwd) x=1 2>/dev/null local "$1" 'quoted text' ${HOME} "$@" ${HOME}
+	2>/dev/null test then /usr/bin local
+done 2>/dev/null -eu test 2>/dev/null
+	awk --verbose --verbose echo
+	awk sed 2>/dev/null x=1 /usr/bin
+		--verbose test /usr/bin -eu
+		"$@" printf test "$1" awk grep
+	grep x=1 sed grep then cd
+		printf grep 'quoted text' --verbose awk awk $(pwd) printf
+	echo $(pwd) local test x=1 echo $(pwd)
+		-eu 2>/dev/null sed -eu 2>/dev/null cd echo then
+	readonly $(pwd) sed then done awk "$1" "$@" "$@" test /usr/bin "$@"
+-eu -eu && 'quoted text' ${HOME} | && echo cd cd $(pwd) export sed && sed $(pwd)
+echo export printf --verbose "$@" awk printf --verbose $(pwd) awk ${HOME}
+		"$@" 2>/dev/null /usr/bin x=1 --verbose
+	echo --verbose grep ${HOME} "$@" && cd done printf --verbose
+	export awk done /usr/bin /usr/bin local readonly readonly
+		export cd 'quoted text' --verbose | $(pwd) 'quoted text' "$@" local test
+		${HOME} -eu test $(pwd) 'quoted text' test printf awk local x=1
+	| echo $(pwd) 2>/dev/null "$1" /usr/bin
+'quoted text' export 2>/dev/null --verbose 2>/dev/null &&
+	/usr/bin /usr/bin "$1" -eu "$@" --verbose readonly "$@" 2>/dev/null 'quoted text'
+	2>/dev/null awk test local && export
+	test test -eu export x=1 -eu $(pwd) then 2>/dev/null
+	"$1" readonly awk 'quoted text' -eu | && readonly 2>/dev/null then
+		x=1 && sed test x=1 "$1" then awk printf sed /usr/bin
+	export then grep test 2>/dev/null cd export | done x=1 "$@" export
+	'quoted text' then export ${HOME} "$@"
+	test /usr/bin 'quoted text' test grep --verbose -eu awk local cd
+	export then sed --verbose x=1 --verbose cd | local -eu 2>/dev/null
+2>/dev/null -eu done export
+	local && cd grep && sed awk local cd $(pwd)
+/usr/bin $(pwd) 'quoted text'
+		done then local 'quoted text'
+	cd -eu awk echo $(pwd)
+"$1" 2>/dev/null 'quoted text'
+/usr/bin grep "$@" then "$@" done -eu --verbose "$1" grep && -eu then 'quoted text'
+		${HOME} && printf "$1" sed awk "$1" $(pwd) local
+sed grep 2>/dev/null "$@"
+2>/dev/null awk --verbose awk $(pwd) "$1" -eu test done done readonly
+		x=1 && 2>/dev/null "$@" && | ${HOME} then -eu
+${HOME} "$@" printf sed "$@" test
+	$(pwd) ${HOME} 2>/dev/null grep 2>/dev/null --verbose
+	then echo export | grep test export readonly grep grep --verbose -eu -eu
+x=1 /usr/bin 2>/dev/null grep ${HOME} -eu echo
+		| | sed "$@" then 2>/dev/null export "$1"
+		${HOME} $(pwd) /usr/bin grep readonly
+	x=1 cd /usr/bin sed printf done | done x=1 -eu 2>/dev/null
+	"$@" 'quoted text' /usr/bin awk ${HOME} --verbose
+test $(pwd) | readonly -eu /usr/bin readonly local awk "$@" then local
+	| then x=1 cd && done x=1 export export ${HOME} echo sed --verbose
+	x=1 then "$@" awk -eu $(pwd) cd
+		awk "$@" ${HOME} 2>/dev/null "$@" sed local readonly 2>/dev/null local done
+	--verbose awk x=1 2>/dev/null "$1" readonly 'quoted text' $(pwd)
+	-eu 'quoted text' /usr/bin awk -eu echo | sed local 2>/dev/null -eu sed
+	local then x=1 $(pwd) ${HOME}
+		${HOME} grep --verbose /usr/bin printf 2>/dev/null export 2>/dev/null
+		readonly grep 2>/dev/null "$1"
+		awk printf --verbose $(pwd) then x=1 sed sed -eu x=1 printf | 'quoted text'
+		/usr/bin echo | $(pwd) test /usr/bin "$@" 2>/dev/null test
+printf /usr/bin sed | done grep x=1 && 'quoted text'
+		grep sed done 'quoted text' test local && x=1 ${HOME}
+		echo test --verbose grep local printf cd ${HOME} 'quoted text'
+echo 'quoted text' done 2>/dev/null x=1 -eu -eu cd local
+sed test 2>/dev/null awk && done "$1" && done ${HOME} export
+echo export then cd readonly printf && "$@" x=1 printf --verbose && --verbose
+		printf then "$@" x=1 local then done cd $(pwd)
+| /usr/bin x=1 /usr/bin local grep echo ${HOME} /usr/bin grep --verbose -eu |
+${HOME} awk test test grep
+		-eu sed ${HOME} test readonly cd
+sed printf readonly test /usr/bin echo done x=1 awk | done echo && && sed -eu x=1
+	export x=1 then export echo /usr/bin done
+		export | 2>/dev/null readonly done 'quoted text' done done ${HOME} export 2>/dev/null
+		cd && | test readonly readonly awk --verbose
+	readonly "$1" 2>/dev/null cd ${HOME} awk && 'quoted text' 'quoted text'
+		printf ${HOME} 'quoted text' 2>/dev/null echo awk 2>/dev/null
+	$(pwd) local echo grep echo 'quoted text' x=1 -eu local
+grep done grep then $(pwd)
+	'quoted text' ${HOME} "$1" "$1" ${HOME} -eu echo sed sed printf sed
+		cd printf done export then x=1
+		printf echo /usr/bin x=1 test /usr/bin && export
+	done -eu local | && export --verbose cd "$@" "$1" "$@"
+echo $(pwd) 2>/dev/null test
+| echo && cd ${HOME} -eu x=1 "$@" 2>/dev/null 'quoted text'
+		readonly 'quoted text' x=1 done local
+grep then then 'quoted text'
+"$1" grep ${HOME} then sed && sed then --verbose 2>/dev/null && cd -eu 'quoted text'
+	cd echo cd $(pwd) grep $(pwd) $(pwd) /usr/bin printf --verbose
+	2>/dev/null --verbose x=1 | grep then sed --verbose
+	--verbose readonly && printf grep awk sed echo awk
+		&& x=1 x=1 "$1" readonly awk --verbose
+	'quoted text' -eu && readonly done 'quoted text' done local 'quoted text' sed
+		printf 'quoted text' "$1" printf done $(pwd)
+	awk 'quoted text' awk /usr/bin $(pwd) -eu printf grep
+	"$@" --verbose x=1 "$1" && /usr/bin
+		readonly sed /usr/bin /usr/bin
+		sed $(pwd) cd 2>/dev/null --verbose | /usr/bin
+		local then | cd readonly printf
+'quoted text' echo printf grep echo 2>/dev/null --verbose 2>/dev/null
+	export "$1" 2>/dev/null x=1 /usr/bin $(pwd) grep then -eu sed printf cd
+	"$@" --verbose /usr/bin "$@" $(pwd)
+x=1 "$@" "$@" cd echo 2>/dev/null done && | test
+		cd 2>/dev/null 2>/dev/null cd done printf grep done sed local
+readonly export ${HOME} export /usr/bin cd readonly
+	grep export done awk sed "$1" echo sed grep local echo -eu $(pwd)
+	test cd local "$1" -eu x=1 2>/dev/null grep 2>/dev/null
+		grep -eu && cd /usr/bin local ${HOME} 2>/dev/null "$@"
+done local $(pwd) "$@" sed /usr/bin /usr/bin | readonly readonly 2>/dev/null printf
+		"$@" printf grep $(pwd) cd 'quoted text' 2>/dev/null
+		printf sed "$@" then ${HOME} test "$@" --verbose echo ${HOME} grep && --verbose
+		printf && | x=1 echo export test "$@"
+"$1" --verbose 'quoted text' printf x=1 | 2>/dev/null cd | readonly
+${HOME} && 2>/dev/null awk printf -eu readonly ${HOME}
+'quoted text' echo "$1" sed --verbose /usr/bin sed grep readonly
+		grep done $(pwd) "$@" "$@" readonly grep ${HOME} awk
+		--verbose --verbose $(pwd) $(pwd) | local x=1 | awk then local grep x=1 2>/dev/null
+	--verbose --verbose | readonly sed export done ${HOME}
+	"$@" 'quoted text' ${HOME} --verbose
+readonly /usr/bin readonly
+		'quoted text' awk done "$@" printf export &&
+'quoted text' printf export "$1" export | sed -eu && /usr/bin 2>/dev/null export
+		"$@" cd -eu printf | export ${HOME}
+		done "$@" done printf | x=1
+		x=1 /usr/bin | --verbose "$1" x=1 /usr/bin sed then 'quoted text'
+		${HOME} sed x=1 cd "$1" printf sed
+local local cd x=1 test -eu readonly
+	'quoted text' cd then $(pwd) && cd "$1" $(pwd) test "$@" test 'quoted text'
+	| x=1 cd -eu awk | 2>/dev/null && readonly printf local test then grep sed
+2>/dev/null "$1" --verbose 'quoted text' done -eu 2>/dev/null printf readonly
+2>/dev/null $(pwd) printf
+		done grep local grep ${HOME} done
+		cd test 2>/dev/null /usr/bin export readonly x=1 ${HOME} printf grep
+	test && sed 'quoted text' echo 2>/dev/null
+done cd local printf printf
+		| grep then readonly "$@" "$@" 'quoted text'
+$(pwd) $(pwd) printf 'quoted text' printf --verbose --verbose
+grep "$1" x=1 cd 'quoted text' cd -eu "$1" 'quoted text' && echo
+	then $(pwd) done ${HOME} sed 'quoted text' grep readonly
+local "$1" grep echo -eu cd $(pwd) "$@" done "$1" readonly echo awk
+		test --verbose cd ${HOME} | printf cd grep local | x=1 ${HOME}
+${HOME} x=1 grep 'quoted text' local cd cd grep export grep echo x=1 ${HOME} 2>/dev/null
+-eu "$@" local grep /usr/bin
+	echo x=1 'quoted text' readonly $(pwd) then "$@" awk --verbose
+	grep then $(pwd) | 2>/dev/null "$@" then | "$@" done
+	then 2>/dev/null awk test 'quoted text'
+	grep export echo /usr/bin test sed grep /usr/bin | sed cd
+export --verbose 'quoted text' 'quoted text'
+${HOME} 'quoted text' export
+	readonly $(pwd) local "$@" local local ${HOME} awk
+	readonly && ${HOME} export local awk then /usr/bin && printf test
+--verbose "$1" cd printf printf printf x=1 printf local x=1 then local
+		done 2>/dev/null test local echo 2>/dev/null ${HOME} printf 'quoted text'
+		sed readonly readonly 2>/dev/null /usr/bin && -eu -eu readonly && 2>/dev/null
+		--verbose ${HOME} /usr/bin printf
+sed local grep $(pwd) readonly /usr/bin cd readonly $(pwd)
+	cd local test then 2>/dev/null /usr/bin "$@" printf
+	x=1 printf echo echo x=1 /usr/bin echo local "$@" grep echo && --verbose &&
+		awk | done then /usr/bin sed $(pwd) local --verbose export
+		cd x=1 --verbose test echo $(pwd) grep
+		-eu done 'quoted text' sed 2>/dev/null sed printf done $(pwd) --verbose $(pwd)
+x=1 2>/dev/null sed ${HOME} export echo "$1"
+	awk grep printf x=1 -eu $(pwd) sed
+		"$1" $(pwd) export export
+done export readonly test local printf echo cd --verbose grep ${HOME}
+	export "$@" 2>/dev/null then readonly awk --verbose /usr/bin ${HOME} ${HOME}
+	"$1" --verbose cd done awk $(pwd) $(pwd) "$@" awk "$1" ${HOME} --verbose echo
+${HOME} awk && then /usr/bin /usr/bin && | test sed -eu cd grep grep
+	readonly cd -eu "$1" x=1 readonly "$1" ${HOME}
+	/usr/bin export awk then $(pwd) readonly sed grep
+		"$@" $(pwd) export 'quoted text' cd awk && done -eu done /usr/bin readonly
+	done echo then echo 2>/dev/null local "$@" test
+	done ${HOME} 'quoted text' $(pwd) readonly ${HOME}
+	'quoted text' /usr/bin 2>/dev/null printf echo
+		/usr/bin readonly readonly awk "$1" test grep | awk &&
+		done 'quoted text' --verbose test | printf -eu test && local
+	${HOME} local | 2>/dev/null
+		--verbose 'quoted text' done then awk echo test cd | $(pwd) then "$@" /usr/bin
+/usr/bin done readonly ${HOME} printf local ${HOME}
+	x=1 -eu "$1" | export sed export x=1 sed readonly readonly
+	cd local test readonly 2>/dev/null
+${HOME} ${HOME} --verbose /usr/bin "$@" 'quoted text' echo "$@" sed $(pwd) echo
+		| done cd cd grep export done readonly
+		awk then 'quoted text' && --verbose
+		'quoted text' 'quoted text' grep readonly echo
+sed sed --verbose 'quoted text' awk && --verbose cd 'quoted text'
+		$(pwd) grep "$@" 'quoted text'
+		"$1" && /usr/bin readonly | grep x=1 $(pwd) "$@" export awk local
+then --verbose 'quoted text' awk && cd cd /usr/bin cd "$1" grep --verbose
+/usr/bin grep then | x=1 /usr/bin
+| then echo 2>/dev/null "$@" --verbose
+		grep done ${HOME} "$@" | cd "$1" readonly
+	/usr/bin $(pwd) ${HOME} x=1 printf test then awk readonly local "$@" sed && -eu
+	--verbose awk x=1 awk awk $(pwd)
+		${HOME} test x=1 printf grep x=1 test printf
+-eu 'quoted text' awk "$@" "$1" then 'quoted text'
+2>/dev/null local ${HOME} /usr/bin
+	| local && ${HOME} sed awk /usr/bin "$@" done local printf export
+"$1" ${HOME} ${HOME} "$@" "$@" $(pwd) /usr/bin /usr/bin sed --verbose cd export
+-eu echo /usr/bin x=1 printf awk export grep sed local x=1 x=1 "$@" export ${HOME}
+		2>/dev/null 2>/dev/null awk printf
+	test "$1" printf /usr/bin && grep "$1" && export -eu 2>/dev/null | --verbose test
+--verbose --verbose cd local x=1 export "$@" "$1" 'quoted text' printf | x=1 "$1"
+	sed printf 'quoted text' | sed 'quoted text'
+awk && x=1 && | awk "$@" sed --verbose
+	sed grep readonly "$@" 'quoted text'
+		done --verbose local ${HOME} ${HOME}
+		$(pwd) grep --verbose "$1" "$1" awk /usr/bin
+	cd x=1 echo awk ${HOME} ${HOME} x=1 done echo 'quoted text' ${HOME} awk
+'quoted text' --verbose 'quoted text' grep "$1" 'quoted text' -eu test ${HOME} ${HOME}
+		test 2>/dev/null export echo readonly --verbose /usr/bin then $(pwd)
+x=1 test awk x=1 printf export /usr/bin "$1" cd readonly
+	export awk 2>/dev/null x=1 export grep echo
+	then awk sed export local x=1 test 'quoted text' 'quoted text' --verbose
+		awk 'quoted text' ${HOME} x=1
+		${HOME} sed echo x=1 printf awk
+cd sed -eu awk "$@" | printf --verbose
+local local grep export awk sed /usr/bin --verbose "$@" 'quoted text' test ${HOME}
+		printf echo 'quoted text' printf && printf grep local export $(pwd)
+		| done done "$1" grep --verbose
+	&& echo cd grep --verbose then done ${HOME} "$@" readonly
+		export cd 2>/dev/null $(pwd) echo ${HOME} $(pwd) test awk readonly
+| grep then "$@" /usr/bin /usr/bin
+		"$@" && 'quoted text' awk
+		awk x=1 x=1 /usr/bin "$@" echo sed echo then 'quoted text' $(pwd)
+		readonly x=1 2>/dev/null awk awk local 'quoted text'
+	"$@" -eu -eu readonly 2>/dev/null | && printf
+--verbose "$1" | /usr/bin grep test echo local local 'quoted text' awk 2>/dev/null
+		"$1" then 'quoted text' local grep
+"$@" --verbose | ${HOME} ${HOME} $(pwd) sed
+	readonly /usr/bin --verbose readonly awk /usr/bin x=1
+-eu cd cd then "$@" done /usr/bin grep cd 2>/dev/null
+	'quoted text' $(pwd) --verbose sed 2>/dev/null ${HOME} done sed /usr/bin
+${HOME} 'quoted text' export test "$1" sed sed | --verbose x=1 awk export
+	--verbose && grep 'quoted text' then ${HOME} -eu --verbose
+	cd --verbose $(pwd) echo | cd
+		"$1" ${HOME} && then grep local -eu local 2>/dev/null
+		"$@" x=1 local readonly --verbose
+/usr/bin cd grep printf local cd /usr/bin 'quoted text' test grep
+		grep "$1" ${HOME} "$@" echo grep 'quoted text' 2>/dev/null $(pwd) echo
+		| x=1 local x=1 --verbose then "$1" x=1
+		test local --verbose test cd x=1 done /usr/bin "$@" awk && "$@" -eu
+	${HOME} export --verbose then 'quoted text' then /usr/bin then echo ${HOME}
+		readonly && && done 2>/dev/null
+	echo awk then readonly 2>/dev/null
+		$(pwd) $(pwd) "$@" 2>/dev/null awk 2>/dev/null
+	x=1 x=1 ${HOME} $(pwd) ${HOME} && done 'quoted text'
+	${HOME} | echo test /usr/bin | sed local grep cd awk cd
+printf awk | test ${HOME} test "$1" "$1" grep /usr/bin test readonly --verbose
+	--verbose export export x=1 | local "$1" then then done done "$1" done && 2>/dev/null
+then ${HOME} 'quoted text' /usr/bin sed readonly
+	2>/dev/null sed x=1 ${HOME} sed
+	x=1 2>/dev/null 2>/dev/null printf
+		x=1 readonly cd -eu | |
+		awk --verbose grep -eu awk "$1" sed grep local
+local --verbose | printf readonly | -eu ${HOME} done test
+	"$1" export x=1 readonly grep local then -eu then "$1" cd local awk |
+export local test echo 'quoted text' printf
+	done $(pwd) | 2>/dev/null echo 'quoted text' export && then $(pwd) $(pwd) cd
+	x=1 --verbose export local sed then grep
+		x=1 test /usr/bin | then | test --verbose echo x=1
+local then $(pwd) local cd "$1" printf | x=1 | readonly x=1 2>/dev/null awk -eu
+	done grep --verbose 'quoted text' -eu
+		done $(pwd) 2>/dev/null /usr/bin readonly echo 'quoted text'
+x=1 /usr/bin $(pwd) test /usr/bin ${HOME} "$1" grep
+done ${HOME} $(pwd) test grep ${HOME} "$@" sed done --verbose $(pwd) then
+	sed export "$1" local /usr/bin
+echo export cd x=1 echo 2>/dev/null awk printf /usr/bin 'quoted text'
+		"$1" 2>/dev/null 'quoted text' grep | export x=1 "$1" done
+	cd readonly grep --verbose readonly echo done --verbose 'quoted text' printf
+| local $(pwd) then sed printf echo /usr/bin | "$@" grep
+"$@" $(pwd) sed $(pwd) $(pwd) -eu $(pwd) "$@" echo ${HOME}
+		"$1" then done local 'quoted text' 2>/dev/null
+	test readonly test then then test "$1"
+echo | $(pwd) -eu "$@" echo local cd export
+		then -eu -eu "$1" readonly readonly ${HOME} && "$1"
+		awk printf then -eu sed local awk export export awk test sed -eu
+echo "$1" sed cd then "$@" && test
+	'quoted text' x=1 /usr/bin "$@" "$@" cd x=1 readonly
+		$(pwd) $(pwd) && "$1" printf export export 2>/dev/null 'quoted text'
+grep ${HOME} cd then -eu done /usr/bin "$1" "$1" grep cd && readonly /usr/bin
+	cd grep echo -eu then ${HOME}
+--verbose -eu grep "$@"
+	--verbose -eu printf awk test export
+then 2>/dev/null "$1" | export then --verbose
+	test test $(pwd) | echo "$@" printf
+echo awk awk grep export && awk done sed grep
+'quoted text' awk | grep then $(pwd) awk 2>/dev/null
+/usr/bin ${HOME} printf -eu --verbose grep local && grep "$1" "$@" then
+		cd echo ${HOME} awk -eu
+	export grep printf 'quoted text' sed "$@" x=1
+local "$1" cd cd | awk
+		-eu printf --verbose && "$1" $(pwd) && export | ${HOME} then awk
+	readonly then --verbose 'quoted text' test readonly
+awk --verbose /usr/bin "$1" $(pwd) cd echo cd done
+--verbose readonly | && "$@" then x=1 /usr/bin --verbose test /usr/bin
+$(pwd) cd local "$1" 2>/dev/null done 2>/dev/null /usr/bin "$1"
+-eu 2>/dev/null then "$1" grep $(pwd) readonly
+	"$@" sed ${HOME} 'quoted text' 2>/dev/null
+	awk && test ${HOME} readonly then grep
+	echo export 'quoted text' 'quoted text' then
+		x=1 then "$@" /usr/bin ${HOME} "$@" x=1
+test x=1 ${HOME} /usr/bin $(pwd) 'quoted text' local ${HOME}
+		echo local printf then local
+	cd local ${HOME} cd x=1 test 'quoted text'
+export 2>/dev/null cd 2>/dev/null export 2>/dev/null sed ${HOME} -eu
+	-eu then grep done "$@" printf done --verbose
+	echo ${HOME} printf $(pwd) test --verbose awk
+	grep | "$1" && echo && "$@" awk ${HOME} export readonly
+		echo echo test readonly "$@" done sed 'quoted text' sed "$1" x=1
+| ${HOME} ${HOME} ${HOME} -eu done local local export "$@" $(pwd)
+export "$1" $(pwd) -eu then local $(pwd)
+done "$@" then | readonly awk "$1" echo cd test echo $(pwd)
+then cd done /usr/bin readonly -eu cd -eu export awk "$@" x=1 && -eu | grep
+	&& done 2>/dev/null local then export --verbose 'quoted text' export awk ${HOME}
+	2>/dev/null echo printf 'quoted text' export /usr/bin echo 2>/dev/null
+		/usr/bin local export && echo $(pwd) "$@" awk sed "$@" then then export x=1 'quoted text'
+	/usr/bin 2>/dev/null printf | done awk printf
+	--verbose then /usr/bin export x=1 ${HOME} readonly readonly $(pwd) export
+${HOME} "$1" echo cd awk --verbose
+	'quoted text' $(pwd) test printf && x=1 -eu 'quoted text'
+		printf 2>/dev/null then x=1 "$@" /usr/bin
+		awk echo readonly -eu awk echo /usr/bin readonly awk --verbose
+x=1 local cd ${HOME} 2>/dev/null grep 2>/dev/null "$@" 'quoted text' test then
+	--verbose /usr/bin && "$1" /usr/bin ${HOME} printf 'quoted text' $(pwd) && /usr/bin
+		export "$1" 2>/dev/null && grep "$@"
+"$1" awk then --verbose awk ${HOME} grep awk grep local
+		cd readonly /usr/bin /usr/bin 2>/dev/null
+	${HOME} then && done
+test export cd done done echo test | export
+		export $(pwd) 2>/dev/null "$1" $(pwd) sed $(pwd) x=1 $(pwd)
+x=1 readonly "$1" ${HOME} "$1" ${HOME}
+		x=1 awk echo x=1 /usr/bin 2>/dev/null printf --verbose --verbose
+echo ${HOME} test $(pwd) /usr/bin done "$1" awk
+	test then | test "$@" done grep --verbose 'quoted text' $(pwd) 2>/dev/null grep
+	then -eu readonly ${HOME} ${HOME} cd /usr/bin cd printf printf cd sed 2>/dev/null
+		then "$1" && /usr/bin --verbose awk awk && done grep sed cd done
+		test sed then 2>/dev/null done /usr/bin --verbose
+		done echo readonly x=1 awk /usr/bin "$@" 2>/dev/null export awk sed
+--verbose printf readonly ${HOME} test then /usr/bin 'quoted text'
+	awk --verbose readonly --verbose && "$1" | -eu $(pwd) -eu 'quoted text'
+	sed grep grep ${HOME} cd then "$1" 'quoted text' && "$1" 'quoted text'
+local readonly ${HOME} 2>/dev/null && test /usr/bin sed -eu test grep -eu test then
+then x=1 | then --verbose done local readonly echo local done -eu readonly
+2>/dev/null awk "$@" x=1 ${HOME} x=1 ${HOME}
+| readonly "$@" "$1" x=1 "$1" test "$@" grep x=1
+		${HOME} export sed test done grep printf
+	awk && awk "$@" $(pwd) sed x=1 cd readonly 2>/dev/null
+		"$@" ${HOME} awk 'quoted text' awk awk "$1"
+grep local && done ${HOME} 'quoted text' 'quoted text'
+	printf grep $(pwd) -eu 2>/dev/null
+		awk grep && local readonly awk x=1 'quoted text'
+	grep sed --verbose ${HOME} grep 'quoted text' test local test sed 'quoted text'
+		'quoted text' grep -eu /usr/bin
+-eu -eu $(pwd) echo -eu 2>/dev/null
+	-eu "$@" readonly "$1" x=1 2>/dev/null
+	$(pwd) export cd echo && /usr/bin
+		awk sed cd readonly 'quoted text'
+	cd ${HOME} local cd ${HOME}
+--verbose /usr/bin cd done readonly done awk $(pwd) echo /usr/bin done
+		| awk 'quoted text' -eu sed $(pwd) grep "$1" /usr/bin grep readonly "$1" "$1"
+		echo export x=1 echo readonly
+	awk awk $(pwd) $(pwd) | ${HOME} then awk local | readonly
+		| "$@" "$@" awk echo ${HOME}
+		2>/dev/null cd export ${HOME} --verbose | cd readonly
+		printf local | && 'quoted text' export --verbose echo 2>/dev/null
+done local local 'quoted text' ${HOME} "$1"
+		"$1" --verbose local cd export echo done
+-eu ${HOME} printf x=1 sed cd | printf
+x=1 /usr/bin done 'quoted text' "$@"
+-eu "$@" cd -eu "$@" echo
+		grep local readonly echo test 'quoted text' echo 2>/dev/null
+		| "$1" x=1 echo local /usr/bin x=1 done --verbose echo printf $(pwd) grep
+2>/dev/null then "$@" -eu test readonly done
+		done --verbose && grep ${HOME} grep /usr/bin
+	then done then readonly export readonly x=1 "$@" /usr/bin echo
+	&& && "$1" export | --verbose ${HOME} $(pwd) /usr/bin "$1"
+		test cd $(pwd) readonly 'quoted text' grep $(pwd) "$1" /usr/bin awk | then x=1
+--verbose /usr/bin awk /usr/bin "$@" grep 'quoted text'
+		-eu export "$1" "$1" local local done &&
+	&& grep export sed cd -eu -eu done ${HOME}
+	sed --verbose /usr/bin $(pwd) echo | ${HOME}
+"$1" test done local 'quoted text' $(pwd) grep test
+	'quoted text' $(pwd) && local printf ${HOME} done ${HOME}
+		export "$1" local then /usr/bin 'quoted text' /usr/bin "$@"
+'quoted text' then done awk /usr/bin 2>/dev/null 'quoted text' --verbose
+		--verbose readonly then --verbose
+		test --verbose done local echo | $(pwd) printf --verbose done ${HOME}
+		"$@" echo test x=1 && then echo grep --verbose | test 'quoted text' &&
+		echo printf grep cd --verbose then 'quoted text' "$@" done "$@" 'quoted text'
+	echo sed test /usr/bin -eu | "$1" && done test echo
+		'quoted text' 'quoted text' awk /usr/bin ${HOME} local -eu
+		"$1" sed local "$@" sed awk && /usr/bin | grep x=1 test
+		printf 2>/dev/null | /usr/bin "$@"
+		&& sed grep done "$@" $(pwd) "$1" printf cd -eu "$1" 'quoted text'
+	local echo x=1 -eu cd /usr/bin "$1" grep "$1" "$1" done x=1
+awk awk awk ${HOME} test
+		x=1 export export grep /usr/bin echo
+	--verbose done $(pwd) -eu echo
+&& grep awk "$1" echo echo export /usr/bin /usr/bin -eu local
+echo test x=1 -eu export sed local readonly "$@" 2>/dev/null -eu "$@"
+	test "$1" printf cd grep --verbose sed &&
+sed ${HOME} ${HOME} "$1" 'quoted text'
+x=1 /usr/bin export awk export echo grep -eu -eu then && awk 'quoted text' --verbose
+	| sed awk ${HOME} "$@" "$1" "$1" $(pwd)
+	"$@" ${HOME} echo -eu then export $(pwd) awk "$1" then 2>/dev/null grep
+		echo printf ${HOME} printf grep then done 'quoted text'
+	/usr/bin 2>/dev/null export 'quoted text' -eu "$@" export
+test "$1" && 'quoted text' readonly local --verbose
+		echo && grep "$@" awk -eu export
+		sed | ${HOME} -eu echo awk cd "$@" "$1" "$@" local export
+		readonly "$@" x=1 --verbose "$1" local
+		test 2>/dev/null "$1" awk --verbose test 2>/dev/null done
+	"$1" then then cd -eu "$1" sed local cd $(pwd)
+	sed x=1 && x=1 cd export "$1" /usr/bin done && $(pwd) then && awk cd "$1"
+	&& /usr/bin grep ${HOME} done done awk 2>/dev/null
+"$@" cd awk x=1 | /usr/bin local x=1 -eu
+	--verbose cd /usr/bin x=1 "$@" cd 'quoted text' readonly
+	then cd cd /usr/bin test printf test echo x=1 printf
+	2>/dev/null && /usr/bin $(pwd) echo grep
+	$(pwd) done readonly export
+		then "$1" && printf /usr/bin ${HOME}
+	"$@" printf | "$1" export export then $(pwd) export then sed "$@" test "$@" local
+		2>/dev/null $(pwd) --verbose && sed "$@" --verbose export cd --verbose awk readonly
+	test local sed 2>/dev/null
+		sed --verbose export ${HOME} readonly | "$@" x=1 grep /usr/bin test && sed $(pwd)
+		cd grep grep $(pwd) grep grep "$1" then test && cd "$1" test
+		'quoted text' awk awk readonly grep | 'quoted text' local
+		sed x=1 then done echo 2>/dev/null grep --verbose export then printf printf
+	| x=1 readonly grep local
+test local awk test sed echo
+		$(pwd) then --verbose done done readonly ${HOME}
+/usr/bin "$1" "$1" done "$1" test
+sed | 2>/dev/null awk /usr/bin cd 2>/dev/null
+	--verbose local -eu $(pwd) grep 2>/dev/null
+	cd && printf then x=1 | echo
+		'quoted text' then done /usr/bin
+		sed readonly $(pwd) ${HOME} $(pwd)
+| grep sed local cd x=1 sed export "$@" -eu |
+echo sed $(pwd) then printf echo sed readonly
+test 2>/dev/null "$1" awk ${HOME} test
+	test $(pwd) done /usr/bin "$1" && grep echo --verbose cd -eu
+cd local export test done "$@" then && 2>/dev/null grep
+echo -eu $(pwd) cd awk 2>/dev/null
+then awk | /usr/bin 2>/dev/null awk --verbose 2>/dev/null then $(pwd) local
+		2>/dev/null "$@" /usr/bin 2>/dev/null --verbose done | printf 'quoted text'
+	awk local grep done 'quoted text' done 2>/dev/null x=1 export sed grep -eu
+test awk | $(pwd) 2>/dev/null
+echo local "$@" test --verbose local && /usr/bin
+awk test test --verbose test echo
+		export export export readonly test
+printf && printf $(pwd) | echo
+	cd readonly grep | ${HOME} grep test then readonly x=1 echo && --verbose
+	'quoted text' then printf readonly $(pwd) test test then done cd test /usr/bin
+	echo 'quoted text' echo "$1" x=1 test x=1 then echo awk printf -eu grep export
+awk -eu export -eu echo awk echo x=1 2>/dev/null /usr/bin "$1" $(pwd)
+		then ${HOME} sed --verbose test "$1" 'quoted text' then -eu 2>/dev/null
+	printf | echo grep 2>/dev/null --verbose "$@" test /usr/bin
+test --verbose "$1" x=1 x=1
+		| printf --verbose /usr/bin --verbose ${HOME} grep then sed "$@" "$@" $(pwd) test
+	"$1" then "$@" test 2>/dev/null
+		readonly -eu --verbose /usr/bin "$1" 2>/dev/null
+"$1" then cd -eu readonly -eu local test "$@" done
+		x=1 done done ${HOME} x=1
+	local echo readonly |
+-eu 2>/dev/null "$@" sed echo cd --verbose done 'quoted text'
+grep then cd -eu -eu readonly
+awk echo test && 'quoted text' 'quoted text' $(pwd) cd
+	${HOME} x=1 -eu -eu local echo "$1" local export
+	'quoted text' echo local && ${HOME} readonly test local
+		'quoted text' | sed ${HOME} printf
+		-eu sed cd "$@" awk "$@" 'quoted text' -eu "$@" "$1" | x=1 readonly
+	readonly local "$1" grep x=1
+done ${HOME} $(pwd) ${HOME} "$@" --verbose x=1 -eu | cd | grep readonly x=1
+		local x=1 "$1" --verbose sed
+/usr/bin && test cd test --verbose echo awk "$1" "$@"
+test /usr/bin $(pwd) | readonly 2>/dev/null 2>/dev/null
+then printf "$@" test export --verbose 'quoted text' | x=1 cd && | && cd
+		printf then "$@" cd && /usr/bin
+	&& local awk x=1 done sed -eu readonly
+	--verbose export readonly
+		${HOME} export readonly && "$@" --verbose test "$@" export "$@" --verbose
+	readonly 2>/dev/null local "$1" echo --verbose "$@" readonly "$@"
+&& readonly $(pwd) 2>/dev/null test local && awk readonly /usr/bin --verbose
+	-eu cd sed -eu local 'quoted text'
+	"$1" export -eu printf x=1 test printf export /usr/bin then --verbose | awk local
+'quoted text' /usr/bin ${HOME} $(pwd) /usr/bin echo awk | awk "$@" readonly
+	| "$1" "$1" "$@" 2>/dev/null
+		"$@" then ${HOME} -eu && && 2>/dev/null 2>/dev/null -eu then done x=1 awk
+sed ${HOME} printf echo 'quoted text' grep printf
+		&& done x=1 test | local
+sed export --verbose test sed && done printf 'quoted text' -eu 'quoted text'
+	printf local x=1 done | ${HOME} test test readonly awk readonly 2>/dev/null
+	grep readonly export readonly printf then
+		"$1" export readonly x=1 local "$@" test done 'quoted text' "$@"
+$(pwd) test cd && awk sed --verbose grep sed && printf --verbose
+	"$1" echo && local printf /usr/bin cd sed awk 'quoted text' export
+		x=1 printf sed 2>/dev/null x=1 | x=1 -eu "$@" echo | test cd readonly |
+		readonly --verbose /usr/bin awk --verbose -eu grep && done sed /usr/bin "$1"
+export --verbose then -eu | then $(pwd) cd then --verbose
+$(pwd) awk done 'quoted text' then readonly local x=1 export
+$(pwd) && -eu 'quoted text' then -eu
+	cd $(pwd) then export 'quoted text' -eu /usr/bin sed ${HOME}
+--verbose sed export printf $(pwd) cd printf grep
+	local test --verbose cd then ${HOME} done "$1"
+		"$1" then 'quoted text' awk grep awk 'quoted text' then
+		'quoted text' x=1 sed && test cd $(pwd) /usr/bin awk
+cd export 'quoted text' awk cd "$@" then printf grep "$@" x=1 2>/dev/null ${HOME}
+	awk printf "$@" awk readonly sed
+	&& then readonly export "$@" "$@" "$1"
+-eu awk awk grep x=1 done ${HOME} && echo printf cd -eu then cd local && readonly
+	2>/dev/null grep local 'quoted text' test ${HOME} cd --verbose
+	"$@" export | --verbose "$@" 2>/dev/null /usr/bin
+| "$@" --verbose | sed readonly printf && | test then --verbose
+	-eu "$1" | 2>/dev/null 2>/dev/null grep printf grep printf $(pwd) | ${HOME} then
+test $(pwd) x=1 2>/dev/null
+/usr/bin printf $(pwd) grep
+		test done -eu "$@" x=1 readonly export && done --verbose local done cd local
+test x=1 cd /usr/bin -eu -eu ${HOME} printf -eu
+then /usr/bin /usr/bin /usr/bin 2>/dev/null
+test "$1" "$@" /usr/bin echo echo $(pwd) local 'quoted text' export awk export
+	$(pwd) x=1 then awk echo printf done grep 2>/dev/null local | "$1" "$1" ${HOME}
+	sed --verbose "$1" "$@" && x=1 "$1" ${HOME} x=1 |
+	readonly && readonly readonly local test test cd echo x=1 readonly
+		done readonly --verbose test 2>/dev/null awk && | grep readonly cd /usr/bin sed
+-eu then local printf ${HOME} printf test
+-eu grep ${HOME} && done "$1" --verbose
+		printf awk | -eu "$@" "$@" 2>/dev/null && done | test
+		| cd printf local 2>/dev/null
+	cd --verbose test | then && "$1" readonly $(pwd) --verbose
+	export "$1" -eu readonly $(pwd)
+	${HOME} "$@" grep done local export then echo --verbose sed /usr/bin
+		"$1" awk export x=1 /usr/bin
+local export grep done export ${HOME} && grep
+		test && sed sed done "$@" x=1 printf --verbose awk "$@" "$@" printf && --verbose
+	"$1" done -eu grep export --verbose printf local /usr/bin x=1 test
+readonly ${HOME} $(pwd) sed 2>/dev/null $(pwd) ${HOME} --verbose
+	x=1 "$@" $(pwd) then done sed awk readonly echo local $(pwd) 2>/dev/null
+	-eu 2>/dev/null 'quoted text'
+	awk 2>/dev/null x=1 && echo local echo sed local cd "$@" test then 'quoted text'
+	"$@" && sed export -eu done 'quoted text'
+		/usr/bin awk echo 'quoted text' /usr/bin --verbose readonly
+		local 'quoted text' --verbose readonly test
+	"$@" test cd "$@" --verbose | cd local awk | local
+2>/dev/null "$1" cd test cd x=1 grep echo "$1" test echo /usr/bin sed "$1"
+&& done /usr/bin && | cd 'quoted text' | && --verbose && local
+awk grep done test sed export local -eu --verbose readonly 2>/dev/null
+-eu test grep && && readonly export && echo echo 2>/dev/null
+${HOME} readonly "$1" 'quoted text' echo 2>/dev/null && export
+	${HOME} 2>/dev/null cd cd cd -eu printf /usr/bin 'quoted text' "$1" $(pwd)
+	local test /usr/bin /usr/bin "$@" /usr/bin x=1 && done --verbose
+		readonly awk && cd readonly cd awk x=1 2>/dev/null --verbose
+grep 2>/dev/null "$1" awk x=1 grep
+2>/dev/null --verbose printf x=1 local 2>/dev/null --verbose
+		&& test awk -eu && -eu | 'quoted text' /usr/bin awk grep readonly
+		"$1" export awk "$1" grep printf printf x=1 printf sed printf x=1 export sed then
+		test $(pwd) -eu then test cd
+		sed --verbose ${HOME} ${HOME} $(pwd) done
+		2>/dev/null export local $(pwd) awk test
+	export 'quoted text' "$@" "$1"
+export done --verbose /usr/bin
+$(pwd) && /usr/bin "$1" 2>/dev/null echo echo grep awk
+		local export ${HOME} 'quoted text' | 2>/dev/null grep $(pwd)
+		"$@" 'quoted text' done test 2>/dev/null --verbose ${HOME} test done sed "$1"
+		| | | "$@" readonly grep | grep awk local export echo | local ${HOME} | export
+	/usr/bin | printf done $(pwd) 'quoted text'
+		export cd x=1 x=1 test export grep && 'quoted text'
+	readonly | echo sed 2>/dev/null printf local
+x=1 && -eu "$1" readonly export ${HOME} && echo ${HOME} "$@" echo $(pwd) then printf
+		echo echo echo "$1" grep grep sed cd
+	printf 2>/dev/null test ${HOME}
+		awk sed && awk export /usr/bin "$1" $(pwd) awk && sed printf printf
+/usr/bin ${HOME} readonly -eu awk -eu && "$@" /usr/bin "$1" x=1
+| readonly /usr/bin --verbose export then local /usr/bin 2>/dev/null sed
+	awk "$@" export --verbose $(pwd) x=1 $(pwd) $(pwd) x=1 2>/dev/null
+"$@" 'quoted text' $(pwd) ${HOME} 2>/dev/null export test /usr/bin printf export
+export grep then x=1 | readonly cd 'quoted text' | awk export
+x=1 'quoted text' test -eu x=1 2>/dev/null "$@" export grep /usr/bin x=1 2>/dev/null
+sed --verbose cd done cd readonly
+	grep ${HOME} readonly -eu x=1 echo cd printf
+		-eu ${HOME} test x=1 | export "$@" x=1 then
+		done 2>/dev/null printf && x=1 && "$1" test then 'quoted text'
+printf -eu test ${HOME} local
+	"$@" grep sed /usr/bin grep x=1 printf printf "$@" done printf sed sed && readonly
+		${HOME} $(pwd) x=1 "$@" done "$1" $(pwd) x=1 export echo x=1 grep test grep
+		&& "$@" --verbose "$@" 2>/dev/null printf -eu done test -eu awk
+	"$@" ${HOME} cd printf --verbose --verbose && sed
+echo test grep readonly echo done printf readonly ${HOME} done test
+awk x=1 done export then "$@"
+test sed 2>/dev/null printf $(pwd) $(pwd) printf
+		x=1 2>/dev/null then export
+	--verbose 'quoted text' sed sed test readonly $(pwd) echo "$1" x=1
+		then local /usr/bin | 'quoted text' test "$@" /usr/bin
+| done ${HOME} 2>/dev/null then $(pwd) cd then
+		"$1" $(pwd) grep sed "$1" local done x=1 -eu printf echo echo echo readonly
+	"$@" test cd 2>/dev/null sed readonly | x=1
+then then then then 'quoted text' "$1" echo --verbose grep readonly
+test then $(pwd) 'quoted text'
+echo -eu grep | export /usr/bin --verbose
+	$(pwd) readonly export then "$1" $(pwd) printf
+	x=1 2>/dev/null ${HOME} sed done echo
+test printf /usr/bin
+awk then $(pwd) "$@" 'quoted text' $(pwd) 2>/dev/null echo -eu
+--verbose printf 2>/dev/null then x=1 2>/dev/null test
+	"$@" | sed cd $(pwd) test done then sed -eu -eu x=1 sed
+"$1" local 'quoted text' | x=1 test $(pwd) "$@" grep 2>/dev/null
+awk | echo done "$1" "$@" 2>/dev/null --verbose echo |
+"$@" awk --verbose --verbose done
+/usr/bin --verbose printf then $(pwd) awk echo -eu printf
+		printf cd --verbose x=1 test printf x=1 --verbose readonly "$1" "$@" then
+	2>/dev/null echo cd "$1" then sed
+		readonly 2>/dev/null 'quoted text'
+done grep grep -eu printf export
+x=1 /usr/bin /usr/bin 2>/dev/null
+		$(pwd) /usr/bin 'quoted text'
+	| ${HOME} export --verbose local
+		awk $(pwd) readonly "$1" printf
+$(pwd) | "$1" | cd "$@" -eu test then readonly 2>/dev/null cd local 2>/dev/null
+		test 'quoted text' "$1" readonly /usr/bin /usr/bin && ${HOME}
+echo 'quoted text' /usr/bin
+		echo /usr/bin cd /usr/bin
+		--verbose grep | 'quoted text' test /usr/bin ${HOME}
+-eu then "$@" $(pwd) | printf echo local printf
+echo echo -eu grep then then readonly readonly
+		local "$1" "$@" && printf export local $(pwd) --verbose && x=1 $(pwd) local
+		'quoted text' sed 'quoted text'
+$(pwd) -eu --verbose && 'quoted text' then x=1 /usr/bin then
+		&& test && /usr/bin done /usr/bin /usr/bin readonly export local x=1
+/usr/bin then $(pwd) local echo readonly "$1" test grep printf
+		&& --verbose $(pwd) echo done sed $(pwd) sed done
+printf awk $(pwd) 'quoted text' $(pwd) done && /usr/bin awk $(pwd) export
+		| then sed done sed cd
+--verbose && test sed export awk 'quoted text' grep done local --verbose $(pwd)
+		'quoted text' test 'quoted text' done
+		then "$1" -eu cd "$@" 'quoted text' "$1" ${HOME} local ${HOME}
+		x=1 local cd export /usr/bin
+		${HOME} 'quoted text' grep echo grep 2>/dev/null then cd cd printf -eu then
+/usr/bin $(pwd) --verbose /usr/bin && 'quoted text' done readonly
+		done 2>/dev/null -eu -eu | printf sed local
+		-eu printf cd ${HOME}
+	-eu local local grep x=1 | local readonly then "$1" awk
+		test test echo done export
+printf 'quoted text' --verbose && --verbose 2>/dev/null $(pwd) done "$1" sed
+	'quoted text' /usr/bin 'quoted text'
+x=1 x=1 export sed | printf done done done -eu | -eu then
+then 2>/dev/null | printf then
+		export /usr/bin done | x=1 local grep 2>/dev/null
+${HOME} then export done ${HOME} --verbose $(pwd)
+$(pwd) printf /usr/bin "$1" && 'quoted text'
+	printf | $(pwd) local 'quoted text'
+x=1 x=1 readonly done && /usr/bin x=1 /usr/bin cd grep test --verbose
+grep ${HOME} | export done
+	2>/dev/null printf echo awk $(pwd) cd test export done grep local
+cd printf --verbose /usr/bin printf then $(pwd) "$1" then "$1" then test
+cd -eu "$1" printf 'quoted text' printf cd printf $(pwd) cd cd local readonly
+	$(pwd) then done && readonly
+		"$@" "$@" "$@" && x=1 done local readonly printf x=1 test local && export
+	sed | 2>/dev/null readonly ${HOME} -eu /usr/bin cd "$1" cd cd x=1 then
+export | && $(pwd) ${HOME}
+&& -eu -eu | printf test readonly printf "$1" done && "$@" cd ${HOME}
+		"$@" 'quoted text' cd 'quoted text' -eu readonly | $(pwd) grep
+		"$@" -eu && echo cd done grep local test done local x=1 printf "$@"
+		/usr/bin /usr/bin cd export then 'quoted text' echo $(pwd) printf -eu
+		cd "$@" -eu ${HOME} ${HOME} x=1 ${HOME} cd readonly
+/usr/bin 'quoted text' local readonly
+x=1 2>/dev/null x=1 readonly --verbose 2>/dev/null
+		cd grep --verbose awk | local x=1 echo then | | /usr/bin
+2>/dev/null && export then printf readonly readonly test awk 2>/dev/null
+	| ${HOME} export export && /usr/bin test readonly
+| && export printf | 2>/dev/null
+	grep "$1" export x=1 --verbose readonly
+		local && ${HOME} -eu then awk then | local echo echo sed
+	${HOME} then cd echo done ${HOME} then 'quoted text'
+local "$1" cd awk x=1 sed done readonly
+		then readonly "$@" sed -eu $(pwd) printf 'quoted text'
+	done -eu cd export awk printf --verbose x=1 --verbose
+		grep --verbose grep cd "$@" "$1" readonly then grep
+		-eu awk readonly && done
+	/usr/bin "$1" export -eu 'quoted text' export
+		/usr/bin "$1" sed --verbose awk /usr/bin printf test 2>/dev/null "$1" export ${HOME}
+		2>/dev/null x=1 x=1 local export echo 'quoted text'
+		done --verbose 'quoted text' x=1 "$@" done sed
+		2>/dev/null then 2>/dev/null && readonly
+readonly 2>/dev/null | --verbose x=1 cd then
+	&& "$1" --verbose grep /usr/bin grep test
+	cd printf grep cd ${HOME} --verbose 2>/dev/null
+		cd cd sed cd | local grep awk x=1 2>/dev/null grep /usr/bin
+	/usr/bin local $(pwd) | 2>/dev/null --verbose cd --verbose test x=1 "$1"
+cd printf | local local done 'quoted text' --verbose
+$(pwd) export "$@" grep local test -eu -eu grep done
+		done $(pwd) test test 2>/dev/null | readonly ${HOME} then "$1" | |
+		printf "$1" local grep --verbose -eu x=1 cd test x=1 $(pwd)
+		awk awk "$@" | ${HOME} 'quoted text' $(pwd) && ${HOME}
+		local "$1" then done then "$@"
+		$(pwd) 'quoted text' echo && echo then sed echo | cd test -eu $(pwd)
+		x=1 "$@" /usr/bin /usr/bin
+readonly awk "$1" printf export | &&
+	/usr/bin local awk $(pwd) $(pwd)
+&& echo cd done readonly done 'quoted text'
+		then 2>/dev/null 'quoted text' export printf done printf grep done done
+	${HOME} "$1" sed ${HOME} ${HOME} sed
+	awk grep "$@" "$1" done | done && ${HOME}
+	done "$1" grep x=1 then $(pwd)
+awk "$1" local sed export then local x=1 sed $(pwd) export test
+		--verbose --verbose cd awk readonly test done
+	cd printf && --verbose
+	'quoted text' -eu x=1 readonly ${HOME} done grep export grep "$1" ${HOME}
+		${HOME} /usr/bin readonly test "$@" ${HOME} && then
+	echo /usr/bin local cd echo readonly | then x=1
+		sed awk /usr/bin --verbose test printf then | && "$1" then
+	done /usr/bin ${HOME} $(pwd) 2>/dev/null
+local export "$1" /usr/bin x=1 echo 2>/dev/null --verbose
+grep --verbose x=1 "$@" export --verbose local
+x=1 then 'quoted text' then /usr/bin && cd awk /usr/bin grep && grep "$@"
+	$(pwd) --verbose readonly && echo then
+	$(pwd) cd 2>/dev/null local $(pwd) $(pwd) printf cd --verbose grep readonly
+		test printf /usr/bin printf sed x=1 -eu
+x=1 x=1 done grep ${HOME} echo | awk $(pwd) readonly ${HOME} sed && grep printf
+		grep 2>/dev/null -eu test then "$1" readonly test cd | x=1
+		"$@" $(pwd) test export | --verbose readonly ${HOME}
+	&& cd "$1" "$@" "$1"
+		export then ${HOME} export $(pwd) echo test
+sed 2>/dev/null x=1 readonly sed ${HOME} done 'quoted text' --verbose done
+done -eu && sed /usr/bin cd "$1" "$1" | "$@" "$1" x=1
+	/usr/bin printf "$@" cd
+	awk -eu 'quoted text' awk | done x=1 --verbose /usr/bin sed
+x=1 readonly then 2>/dev/null sed test
+	"$@" cd "$1" test 2>/dev/null x=1 cd -eu x=1 2>/dev/null
+x=1 echo printf "$1" ${HOME} test printf local test export -eu awk local
+	${HOME} then done echo "$1" --verbose -eu 'quoted text' "$1"
+		/usr/bin --verbose "$1" "$@" -eu -eu "$@" -eu /usr/bin echo
+--verbose grep sed x=1 grep awk export printf test --verbose
+	2>/dev/null "$1" | /usr/bin /usr/bin readonly 2>/dev/null
+		'quoted text' -eu /usr/bin export then then done x=1
+		'quoted text' export printf grep sed readonly 2>/dev/null /usr/bin
+export --verbose local | export readonly then /usr/bin
+x=1 2>/dev/null "$1" then echo sed /usr/bin && printf readonly done | |
+	${HOME} "$@" readonly ${HOME} "$1" test && $(pwd) "$@" $(pwd) printf
+--verbose export && "$@" local ${HOME} "$1"
+	${HOME} local local readonly sed local local cd test then printf ${HOME}
+	'quoted text' /usr/bin x=1 | then x=1 $(pwd) /usr/bin 2>/dev/null
+	${HOME} sed "$@" done readonly
+	"$@" "$1" local "$@" awk "$@" then grep done ${HOME} --verbose && grep ${HOME}
+	then x=1 --verbose | cd 2>/dev/null
+	awk readonly awk awk export readonly | "$@" /usr/bin done --verbose awk sed
+--verbose awk sed done x=1 printf --verbose test "$@" done
+	/usr/bin x=1 sed -eu /usr/bin
+echo awk sed export /usr/bin then -eu cd
+--verbose then local grep 'quoted text' | sed
+	$(pwd) "$@" | | local ${HOME} && -eu printf sed x=1 echo
+		$(pwd) printf done grep /usr/bin
+		"$@" sed readonly sed ${HOME}
+		2>/dev/null printf | -eu export "$1" 2>/dev/null done done cd readonly | echo printf
+	--verbose readonly && ${HOME} && awk $(pwd)
+		"$1" x=1 sed | "$1" /usr/bin done then 2>/dev/null
+		sed $(pwd) printf cd -eu cd 2>/dev/null echo
+"$1" test 'quoted text' readonly "$1" 2>/dev/null done local cd cd printf 2>/dev/null
+		x=1 export printf awk then ${HOME} cd /usr/bin awk grep $(pwd) $(pwd)
+		readonly $(pwd) x=1 awk | 'quoted text' /usr/bin printf export cd sed grep -eu awk
+cd --verbose /usr/bin done sed 2>/dev/null
+&& && cd readonly grep done then -eu grep test
+		awk sed local done then printf "$1" awk then x=1 grep printf echo done local
+x=1 awk cd grep ${HOME} | && "$1" --verbose done cd $(pwd) ${HOME}
+	echo echo "$@" 2>/dev/null local $(pwd) "$1" $(pwd) && local 'quoted text'
+	| "$1" "$@" awk sed export && 2>/dev/null
+--verbose export | cd /usr/bin export test export 2>/dev/null done
+	awk "$1" ${HOME} then test printf "$@"
+"$1" $(pwd) then /usr/bin printf export 2>/dev/null && x=1 grep
+	cd cd -eu then "$@" export grep
+	2>/dev/null -eu readonly local test 'quoted text' 2>/dev/null x=1
+	-eu x=1 /usr/bin printf "$@"
+	'quoted text' printf echo local
+	test 'quoted text' "$@"
+		/usr/bin && && readonly export $(pwd) local "$@"
+		x=1 awk then ${HOME} grep "$1" grep printf then readonly -eu cd $(pwd)
+echo test $(pwd) $(pwd) "$1" -eu sed 2>/dev/null export test then echo done
+sed ${HOME} 'quoted text'
+local cd export /usr/bin && 2>/dev/null
+	2>/dev/null sed /usr/bin echo && local -eu grep
+| grep awk awk printf then 2>/dev/null
+${HOME} "$@" x=1 sed test grep ${HOME}
+-eu export "$1" local cd test done ${HOME}
+echo ${HOME} echo awk 'quoted text' echo /usr/bin
+${HOME} x=1 awk then 'quoted text'
+then ${HOME} local awk readonly
+		/usr/bin -eu awk 2>/dev/null test done 'quoted text'
+/usr/bin "$1" cd && readonly | ${HOME} | printf $(pwd) local grep readonly
+2>/dev/null sed | readonly &&
+	sed test then awk -eu sed ${HOME} export && 2>/dev/null
+		'quoted text' /usr/bin -eu "$1" awk 2>/dev/null 2>/dev/null
+	test $(pwd) local done local ${HOME} "$@" 2>/dev/null
+		export local echo 2>/dev/null
+readonly | readonly readonly x=1 local /usr/bin "$@" $(pwd)
+export then /usr/bin done test grep sed --verbose && /usr/bin
+		printf echo done printf ${HOME} local
+	"$@" grep 'quoted text' --verbose echo sed grep test awk ${HOME} done
+		/usr/bin 2>/dev/null -eu sed /usr/bin export "$1" ${HOME}
+	$(pwd) $(pwd) 2>/dev/null
+	/usr/bin printf x=1 then cd 'quoted text'
+	sed then | | grep /usr/bin readonly
+	export 'quoted text' "$@" readonly export printf $(pwd)
+		&& "$1" sed export ${HOME} done
+		grep export 'quoted text' grep export done "$@" awk /usr/bin
+	then | readonly && 2>/dev/null 'quoted text'
+		/usr/bin done /usr/bin --verbose done 'quoted text'
+		-eu export $(pwd) && x=1 echo done
+		-eu 2>/dev/null && readonly export && done /usr/bin 2>/dev/null
+		cd test ${HOME} "$@" /usr/bin "$1"
+	awk test readonly sed grep printf cd test test done test -eu
+		--verbose sed /usr/bin -eu grep --verbose cd test && then done && ${HOME} done
+	2>/dev/null "$1" export | local readonly
+	echo | export cd printf test done sed -eu && --verbose test printf printf
+		grep sed 'quoted text' "$@" readonly echo /usr/bin
+		grep test ${HOME} local grep echo sed && grep
+	then sed local 2>/dev/null ${HOME} | cd $(pwd) echo awk readonly echo "$1"
+	${HOME} grep test echo && done local test
+	/usr/bin done printf awk "$1" ${HOME} /usr/bin
+	printf && 'quoted text' $(pwd) sed ${HOME}
+		x=1 readonly echo --verbose ${HOME} then 2>/dev/null
+local grep "$@" done -eu && grep
+		| local --verbose awk "$1" 2>/dev/null
+-eu "$@" cd done "$@" awk grep 2>/dev/null done -eu test
+	&& printf export sed x=1 -eu x=1 readonly 'quoted text' test export
+	printf test && /usr/bin export
+	'quoted text' then | cd x=1 printf test export then ${HOME} 'quoted text'
+/usr/bin export "$1" sed 'quoted text' && /usr/bin $(pwd) "$@"
+&& "$@" cd | grep 'quoted text' test && local sed && then -eu x=1 sed
+		x=1 $(pwd) --verbose then --verbose export
+awk 2>/dev/null --verbose x=1 sed
+	printf --verbose $(pwd) echo x=1 local /usr/bin sed grep printf "$1" export
+	readonly then local export $(pwd) grep $(pwd) /usr/bin -eu ${HOME}
+		awk done $(pwd) -eu --verbose | "$1" 2>/dev/null
+		--verbose cd x=1 readonly "$@" x=1
+		test /usr/bin awk ${HOME} test cd sed ${HOME} --verbose echo x=1 x=1
+cd && 'quoted text' grep
+	sed awk /usr/bin export sed grep "$1" |
+"$1" 'quoted text' done export
+		--verbose "$1" done "$@"
+		x=1 sed sed x=1 then --verbose test --verbose ${HOME} "$@" done export
+	printf sed "$1" && $(pwd) readonly cd $(pwd)
+		$(pwd) cd ${HOME} then "$@" 'quoted text' | 2>/dev/null x=1 export
+| export | export export "$1" printf
+		grep 2>/dev/null awk ${HOME} printf local sed done && | export -eu test --verbose
+#include c249.sh
+		local readonly sed "$1" 'quoted text' test | |
+echo local /usr/bin "$@" | | awk 2>/dev/null && cd && echo sed 'quoted text'
+done $(pwd) 2>/dev/null grep
+	cd "$@" | test then grep 'quoted text'
+		done sed done x=1 grep x=1 printf -eu then readonly done done grep --verbose
+cd /usr/bin $(pwd) cd test test done grep readonly test /usr/bin
+	cd grep printf --verbose then x=1
+		awk $(pwd) printf cd readonly | echo 'quoted text'
+	done awk sed 'quoted text' | sed && ${HOME} then x=1 2>/dev/null
+"$@" readonly grep 2>/dev/null
+		-eu then readonly && done && $(pwd)
+awk printf awk --verbose -eu 'quoted text'
+		export --verbose ${HOME} awk
+	local echo ${HOME} "$@"
+	sed awk "$1" grep "$1" ${HOME} readonly -eu ${HOME} test test --verbose
+	x=1 sed -eu --verbose grep
+	export sed done export cd printf | readonly done then cd 'quoted text' printf
+done sed /usr/bin $(pwd) "$1" then echo local x=1 -eu
+"$@" -eu && test --verbose done && awk test "$@" | $(pwd) "$@"
+awk echo /usr/bin ${HOME} /usr/bin done | -eu -eu 'quoted text' --verbose
+then test /usr/bin grep
+	$(pwd) 2>/dev/null cd /usr/bin "$1" | done awk "$@" $(pwd) && "$1" local sed
+2>/dev/null test /usr/bin | -eu x=1 local 'quoted text' sed cd 2>/dev/null cd echo
+	x=1 x=1 test echo echo "$1" cd 'quoted text'
+x=1 echo 2>/dev/null done readonly cd echo sed readonly 2>/dev/null 'quoted text'
+		${HOME} -eu then readonly "$@" test && then sed |
+		echo 2>/dev/null grep awk /usr/bin -eu sed --verbose "$1" sed echo
+	printf ${HOME} && then
+	cd printf | /usr/bin sed -eu
+	echo 2>/dev/null test -eu
+	sed 'quoted text' $(pwd) export local echo then | test 'quoted text' -eu "$1"
+	done 2>/dev/null grep local
+then sed x=1 grep sed "$@" 'quoted text'
+	test test done --verbose -eu ${HOME}
+	2>/dev/null --verbose x=1 echo
+		test -eu && /usr/bin printf echo cd x=1 done $(pwd) ${HOME}
+	| printf "$1" && local ${HOME} local
+	echo done done ${HOME} awk 'quoted text' awk | grep 2>/dev/null readonly
+	echo ${HOME} 2>/dev/null then awk "$1" -eu
+	--verbose 2>/dev/null x=1 grep "$1" "$@" $(pwd) && "$1" test /usr/bin readonly
+		/usr/bin done local x=1 2>/dev/null done sed ${HOME} --verbose 2>/dev/null
+&& "$1" local 2>/dev/null then then grep export printf
+awk ${HOME} then then local x=1 "$1" sed --verbose then readonly
+	readonly /usr/bin -eu --verbose done | sed printf "$@" readonly
+-eu && $(pwd) && $(pwd) /usr/bin cd awk $(pwd) -eu --verbose local
+	local x=1 $(pwd) | --verbose 'quoted text' && awk 2>/dev/null printf grep done
+	export local /usr/bin awk
+	test printf $(pwd) 'quoted text' -eu readonly local done x=1 printf -eu ${HOME}
+	awk local | -eu echo grep /usr/bin awk && cd printf 'quoted text' $(pwd) local
+	awk 'quoted text' echo --verbose -eu sed export sed -eu
+local readonly /usr/bin grep readonly -eu cd local
+		then ${HOME} $(pwd) $(pwd) sed ${HOME} printf $(pwd) 2>/dev/null 2>/dev/null
+x=1 | 2>/dev/null grep test cd "$@" sed
+sed cd test sed "$1" 2>/dev/null awk export printf "$1" grep
+local echo "$1" done x=1 printf --verbose --verbose "$@" awk sed ${HOME}
+x=1 -eu 'quoted text' awk && ${HOME} then
+echo awk echo && grep grep /usr/bin --verbose
+| --verbose test done sed x=1 "$1" sed 'quoted text' 2>/dev/null -eu
+--verbose x=1 local -eu $(pwd)
+then cd x=1 grep --verbose | printf awk echo then "$@" local test /usr/bin
+	cd $(pwd) export printf grep export then /usr/bin
+"$1" x=1 cd test printf printf 2>/dev/null /usr/bin && echo "$1"
+	/usr/bin --verbose "$1" -eu cd sed "$@" printf
+${HOME} echo printf export done $(pwd) printf
+	awk 2>/dev/null echo readonly sed
+		-eu printf then x=1 then 2>/dev/null 2>/dev/null -eu
+local 2>/dev/null grep 2>/dev/null --verbose readonly "$1" "$@" printf
+	sed --verbose test ${HOME}
+	2>/dev/null 'quoted text' ${HOME} --verbose -eu
+		--verbose 2>/dev/null printf then | cd sed export export
+echo $(pwd) x=1 echo "$@" printf "$@" awk printf export ${HOME} ${HOME} ${HOME}
+		export /usr/bin readonly export readonly local ${HOME} test -eu done done
+x=1 cd 'quoted text' awk && "$@" awk
+	"$1" | readonly /usr/bin done printf cd "$1" 'quoted text'
+	export /usr/bin export --verbose test 'quoted text' 'quoted text' | "$1"
+		/usr/bin printf 'quoted text' x=1 grep grep --verbose
+	awk cd then "$1" grep -eu done && --verbose then /usr/bin 2>/dev/null
+export export "$1" export --verbose "$@" /usr/bin ${HOME} | /usr/bin
+readonly test /usr/bin 'quoted text' 2>/dev/null 'quoted text' readonly export
+		x=1 2>/dev/null awk sed 'quoted text'
+$(pwd) readonly grep sed export "$@" readonly 'quoted text' x=1 ${HOME}
+	sed then local $(pwd) export -eu $(pwd) test readonly 2>/dev/null
+| awk 'quoted text' awk cd "$1" 'quoted text' printf
+${HOME} then "$@" $(pwd) x=1
+	${HOME} echo done x=1 'quoted text' --verbose "$1"
+awk readonly cd awk then "$1" --verbose readonly x=1 test then then /usr/bin
+	local echo sed printf | /usr/bin local --verbose 2>/dev/null 2>/dev/null
+	awk x=1 /usr/bin local awk awk --verbose
+		test grep readonly done
+	cd "$1" test test sed grep --verbose
+		cd sed 'quoted text' ${HOME} done awk printf export -eu
+| x=1 2>/dev/null echo readonly | local readonly 2>/dev/null
+/usr/bin grep done export printf export awk | x=1 export export grep ${HOME}
+		'quoted text' 2>/dev/null awk then local awk done
+		cd /usr/bin $(pwd) grep readonly grep 2>/dev/null
+done x=1 test 'quoted text' /usr/bin export "$1" 2>/dev/null grep 'quoted text'
+	sed 'quoted text' "$1" then
+${HOME} grep ${HOME} local export /usr/bin "$@" "$1" | local sed && test
+		local printf printf ${HOME} ${HOME} export 2>/dev/null $(pwd) ${HOME} -eu 'quoted text'
+$(pwd) "$@" readonly 'quoted text' printf readonly
+grep export ${HOME} sed --verbose | export printf test readonly --verbose
+2>/dev/null 'quoted text' | ${HOME} 2>/dev/null
+"$1" printf local grep --verbose readonly && done grep done
+	export cd $(pwd) then $(pwd) printf |
+		echo -eu ${HOME} 'quoted text' ${HOME} ${HOME} "$@" done
+		"$1" 'quoted text' && then ${HOME} ${HOME} $(pwd) readonly sed export then echo
+		--verbose export -eu export grep 'quoted text' grep printf
+	&& cd $(pwd) echo && printf $(pwd) test x=1
+	done --verbose printf grep "$@" local --verbose
+'quoted text' printf done /usr/bin
+	&& cd /usr/bin export 'quoted text' -eu echo "$1" then
+	local done printf sed --verbose cd "$@" echo ${HOME} 2>/dev/null local
+	export printf grep "$@" cd && 2>/dev/null -eu --verbose then sed -eu test
+		2>/dev/null x=1 printf done --verbose then test &&
+awk grep grep $(pwd) $(pwd) "$@" awk
+		/usr/bin export "$@" awk then | | local then $(pwd) then
+done 2>/dev/null cd cd 'quoted text'
+	$(pwd) 'quoted text' local
+grep done readonly done echo awk done "$1" cd test && done 2>/dev/null
+		2>/dev/null "$1" x=1 && x=1 readonly
+		export x=1 $(pwd) export x=1 ${HOME} test "$@" done --verbose
+2>/dev/null done local awk local --verbose && echo ${HOME} readonly
+	--verbose 2>/dev/null local "$1" done 'quoted text' cd grep --verbose "$1" grep
+| -eu grep cd ${HOME} sed export done done
+		readonly | "$@" local 'quoted text' done 'quoted text' awk echo cd
+-eu 2>/dev/null /usr/bin cd /usr/bin x=1 --verbose | cd export
+$(pwd) readonly x=1 local cd sed 'quoted text'
+	printf ${HOME} ${HOME} cd then && 'quoted text' -eu --verbose
+sed sed export awk grep "$@" x=1 -eu | /usr/bin sed --verbose
+		test && --verbose "$1" awk -eu
+	local | sed && --verbose -eu then test -eu cd printf grep "$1" x=1
+		local x=1 local sed "$@" 'quoted text'
+		awk local "$@" 'quoted text' | | awk done "$@" local
+		'quoted text' echo readonly grep done $(pwd) -eu | grep $(pwd)
+	-eu grep "$@" --verbose
+	cd readonly | $(pwd) export test local "$1" echo grep | echo sed
+"$1" then 'quoted text' sed "$@" test x=1 --verbose $(pwd) export
+then $(pwd) grep && "$1" "$1" && readonly x=1 -eu x=1 "$1" readonly
+then $(pwd) ${HOME} cd test x=1 --verbose x=1 "$1"
+	x=1 export | 2>/dev/null $(pwd) test local sed && test 2>/dev/null
+then cd 'quoted text' 'quoted text'
+	done | cd sed "$@" && sed -eu "$1" x=1 awk cd sed
+	test done awk 2>/dev/null && test 'quoted text' sed
+		2>/dev/null awk "$1" /usr/bin test ${HOME}
+	cd | then grep printf | export printf awk 'quoted text' done done done | cd test
+	awk 'quoted text' echo awk awk "$@" && awk then "$@" echo 'quoted text' 'quoted text'
+		printf sed awk export "$@"
+	echo then sed 'quoted text' "$1" 2>/dev/null
+cd local $(pwd) sed grep
+		export cd sed "$1" cd 2>/dev/null
+	2>/dev/null done awk local ${HOME} ${HOME}
+echo then | echo ${HOME} cd -eu 2>/dev/null echo $(pwd) readonly $(pwd) test
+	local x=1 -eu local $(pwd) test
+		$(pwd) sed $(pwd) echo --verbose "$1" grep echo test awk "$1"
+x=1 done sed cd 'quoted text' export 'quoted text' | 2>/dev/null
+grep /usr/bin "$@" awk cd printf
+"$@" 2>/dev/null $(pwd) "$1" /usr/bin
+		--verbose ${HOME} printf
+	"$1" | local cd cd && readonly | "$1" -eu | | done test sed done
+		$(pwd) cd echo done | 'quoted text'
+printf "$1" "$@" readonly /usr/bin -eu then awk
+/usr/bin "$@" export 2>/dev/null 2>/dev/null awk awk then awk ${HOME}
+		echo "$1" "$1" -eu $(pwd) ${HOME} sed 2>/dev/null readonly export readonly readonly
+		readonly export && awk cd awk sed 'quoted text'
+	"$1" -eu export cd "$@" ${HOME} 'quoted text' $(pwd) 'quoted text'
+		'quoted text' local local | test local export | x=1 awk sed echo test "$1" export
+| -eu && $(pwd) echo ${HOME} local --verbose "$1" printf
+${HOME} grep "$1" 'quoted text' | readonly grep /usr/bin "$1"
+--verbose done printf $(pwd) export sed local awk sed -eu
+	printf cd "$@" export /usr/bin echo x=1 ${HOME} | 'quoted text'
+--verbose readonly x=1 "$1" | sed done awk "$@" /usr/bin
+		2>/dev/null local -eu cd readonly $(pwd) test export -eu /usr/bin
+--verbose --verbose echo sed 2>/dev/null printf --verbose
+		--verbose cd done echo && echo sed export "$@" --verbose
+		2>/dev/null local x=1 ${HOME} readonly
+'quoted text' test "$1" 'quoted text' test export
+	awk grep 'quoted text' "$1" 2>/dev/null "$1" -eu test | $(pwd) | | awk 2>/dev/null
+	"$1" local 2>/dev/null grep echo awk echo
+	$(pwd) export echo && awk
+$(pwd) x=1 local && && 'quoted text' 2>/dev/null --verbose
+	/usr/bin printf "$1" cd ${HOME} awk -eu sed 'quoted text' then done done
+		&& "$1" "$@" /usr/bin /usr/bin readonly
+		export readonly echo |
+		readonly printf /usr/bin sed x=1 export /usr/bin --verbose
+	printf $(pwd) 2>/dev/null cd
+${HOME} sed 'quoted text' cd "$@" test "$@" export 'quoted text'
+		test 'quoted text' test
+		$(pwd) "$1" echo printf 2>/dev/null $(pwd) /usr/bin echo export done "$1" done
+		-eu 2>/dev/null "$@" readonly
+	sed --verbose | && "$@" x=1 --verbose awk readonly cd $(pwd)
+/usr/bin && awk "$@" echo ${HOME} done sed /usr/bin
+	--verbose echo | -eu --verbose readonly
+'quoted text' awk -eu 2>/dev/null grep awk "$1"
+		export echo then test x=1 sed && "$@" -eu then readonly /usr/bin 2>/dev/null $(pwd)
+'quoted text' test readonly | grep
+		printf grep $(pwd) grep && -eu 'quoted text'
+	-eu echo "$1" then 2>/dev/null printf
+		"$1" "$@" /usr/bin local export local && -eu --verbose
+	awk | cd "$1" then test && 'quoted text' echo export export 2>/dev/null awk
+		sed | cd readonly echo | done 2>/dev/null "$@" printf printf 2>/dev/null test
+		-eu sed /usr/bin grep grep "$@" echo export $(pwd) && echo --verbose 'quoted text'
+		$(pwd) && test | /usr/bin
+		x=1 "$1" sed -eu awk ${HOME}
+	test && done sed ${HOME} 'quoted text' -eu readonly echo "$1"
+&& printf echo --verbose $(pwd)
+	&& then cd "$1" 'quoted text' --verbose cd local
+done 'quoted text' x=1 $(pwd)
+	export grep $(pwd) echo -eu | grep && "$@" printf ${HOME} /usr/bin "$1" "$1" $(pwd)
+	x=1 2>/dev/null ${HOME} --verbose 2>/dev/null local $(pwd)
+x=1 "$@" local done "$1" && done echo cd $(pwd) "$@" awk | -eu
+--verbose "$@" cd | "$@" grep
+	"$@" test local done 'quoted text' "$@" printf $(pwd) "$1" "$1" 'quoted text'
+local /usr/bin sed "$1" --verbose cd 'quoted text'
+	readonly export printf "$1" sed --verbose "$@" then
+echo sed x=1 export 2>/dev/null 'quoted text' export 'quoted text' $(pwd)
+	'quoted text' test | 'quoted text' "$@" echo done ${HOME} | export
+	&& test local && | ${HOME} $(pwd) sed sed printf | | done local | x=1 export
+awk printf /usr/bin test test local
+		then --verbose $(pwd) export 2>/dev/null export "$1" --verbose local readonly -eu
+		-eu -eu ${HOME} -eu local echo echo | readonly echo $(pwd) $(pwd)
+		$(pwd) awk ${HOME} readonly /usr/bin then
+		-eu readonly "$1" printf "$@" ${HOME} printf "$1" --verbose
+		test --verbose readonly --verbose cd cd $(pwd) ${HOME}
+-eu && | awk && then $(pwd) readonly sed
+"$1" $(pwd) --verbose ${HOME} readonly | && sed echo echo readonly
+		&& done "$@" x=1 x=1 2>/dev/null 2>/dev/null
+	--verbose | awk awk test printf export sed --verbose ${HOME} then "$@" 'quoted text'
+cd --verbose cd readonly echo ${HOME} /usr/bin
+	2>/dev/null test export "$@" echo 2>/dev/null --verbose export 'quoted text'
+	readonly test && | export /usr/bin grep done --verbose
+then "$@" printf /usr/bin /usr/bin
+	-eu && ${HOME} readonly then 'quoted text' x=1 echo ${HOME} |
+	test && 2>/dev/null "$@" awk awk awk "$1" then
+	--verbose echo test readonly ${HOME}
+	echo && "$1" printf grep sed --verbose sed test then "$1" | echo ${HOME} /usr/bin
+		printf -eu 2>/dev/null | printf $(pwd)
+	export "$1" export awk then | export readonly export done
+		| /usr/bin 'quoted text' awk -eu | "$@" export && 2>/dev/null done
+		${HOME} $(pwd) local then local && &&
+		"$1" awk 'quoted text' /usr/bin grep
+	done readonly then /usr/bin | echo
+	x=1 x=1 && grep "$@" then awk -eu x=1 done grep -eu test ${HOME} $(pwd)
+printf done printf 'quoted text' sed cd grep 'quoted text' echo
+2>/dev/null then ${HOME} x=1 /usr/bin
+x=1 x=1 -eu done echo "$@" x=1 && /usr/bin
+done export local grep | readonly printf echo
+"$1" cd awk awk --verbose /usr/bin | sed $(pwd) ${HOME} cd /usr/bin
+"$@" ${HOME} printf local 'quoted text' "$@" ${HOME}
+	/usr/bin "$1" /usr/bin "$1" ${HOME}
+		local "$1" 'quoted text' grep -eu $(pwd) && printf 2>/dev/null
+		"$@" awk "$1" x=1 2>/dev/null
+	readonly grep then echo local test 2>/dev/null
+done printf echo printf cd echo -eu -eu $(pwd) export "$1"
+$(pwd) done 'quoted text' grep sed sed sed "$@" && /usr/bin then "$1"
+${HOME} printf x=1 && /usr/bin 2>/dev/null /usr/bin
+awk --verbose "$1" test $(pwd) "$1" 'quoted text' grep --verbose export then
+		done local 'quoted text' && grep $(pwd) && test
+	grep grep done grep echo "$1" done x=1 awk 2>/dev/null $(pwd)
+x=1 then test 2>/dev/null grep | cd sed $(pwd) echo printf
+	| echo printf -eu done test "$1" done done $(pwd) local $(pwd)
+		export export readonly ${HOME} grep
+	grep readonly echo grep && --verbose test && $(pwd) --verbose sed $(pwd)
+| x=1 /usr/bin sed ${HOME} $(pwd) "$@" "$@" cd
+		test awk "$@" printf /usr/bin printf /usr/bin -eu "$@" && printf grep done readonly
+x=1 then local ${HOME} 2>/dev/null && x=1 "$@" "$1" 2>/dev/null
+	cd 'quoted text' export export awk 'quoted text' x=1 $(pwd) local
+		cd 'quoted text' "$@" sed -eu "$@" export "$@" $(pwd) sed
+	sed $(pwd) $(pwd) "$@" 'quoted text' echo && "$@" | test awk cd 'quoted text'
+	export test /usr/bin local done cd &&
+&& then /usr/bin /usr/bin echo local | $(pwd) local
+		2>/dev/null /usr/bin 'quoted text' "$@" ${HOME}
+	cd "$1" 2>/dev/null --verbose x=1
+		$(pwd) test local | "$1" -eu -eu awk "$@" export test printf test 'quoted text'
+&& "$1" 'quoted text' then &&
+	printf && test echo grep && ${HOME} cd awk export $(pwd) --verbose
+	grep echo then --verbose -eu done ${HOME} test "$@" --verbose
+then test then 'quoted text' 2>/dev/null local
+		awk ${HOME} readonly echo readonly done 2>/dev/null
+	readonly grep then done --verbose sed 'quoted text'
+	then 'quoted text' 'quoted text'
+	echo cd | printf export echo export echo "$1" grep 2>/dev/null
+local grep local "$@" test -eu "$@" sed ${HOME} 2>/dev/null
+x=1 "$1" export export 2>/dev/null awk readonly
+$(pwd) sed $(pwd) $(pwd) ${HOME} $(pwd) $(pwd)
+	echo grep cd "$1" local $(pwd) $(pwd) awk then export x=1 /usr/bin
+		"$1" -eu /usr/bin awk test export --verbose local
+		| export local /usr/bin test $(pwd) 'quoted text' &&
+		then echo sed export test grep printf "$@" -eu
+	done readonly done 2>/dev/null
+sed /usr/bin done test ${HOME} 'quoted text' && local
+sed export ${HOME} then grep "$@" /usr/bin
+'quoted text' | export export && 2>/dev/null 2>/dev/null grep
+	printf "$1" echo && 2>/dev/null /usr/bin echo then echo export sed then printf
+		-eu ${HOME} | export x=1
+&& then "$1" then | echo test
+		"$@" test $(pwd) | done && "$@"
+local "$@" printf readonly sed
+		&& ${HOME} local local then "$@" awk "$1" printf then local awk && /usr/bin --verbose
+		| "$@" && | && echo x=1 x=1 | --verbose -eu export
+sed "$1" grep echo "$@" echo && "$1" grep readonly cd 'quoted text'
+'quoted text' cd cd local "$@" && sed awk
+--verbose "$1" | sed ${HOME} then awk
+	echo printf echo "$1" -eu x=1 -eu export readonly
+	local local cd local | awk then export grep "$@" grep
+&& echo readonly x=1 sed 'quoted text'
+/usr/bin then $(pwd) cd printf -eu /usr/bin test echo "$1"
+	-eu ${HOME} then && --verbose
+$(pwd) test -eu | 'quoted text' grep --verbose x=1 $(pwd) grep readonly -eu --verbose
+echo echo --verbose ${HOME} 'quoted text' then local ${HOME} 'quoted text' 'quoted text'
+${HOME} $(pwd) echo "$1" --verbose ${HOME} export "$@" 'quoted text'
+done local 2>/dev/null awk done grep
+	awk && "$1" | 2>/dev/null 'quoted text' local echo 2>/dev/null
+		cd -eu export awk -eu "$@" -eu && 'quoted text' x=1 "$1"
+		&& "$1" test "$@" -eu test readonly /usr/bin 2>/dev/null then "$1" --verbose
+	test x=1 awk "$@" printf && awk ${HOME} x=1 printf
+	done then | grep local grep test readonly ${HOME} 'quoted text' 2>/dev/null
+	x=1 readonly echo done | ${HOME}
+	&& done $(pwd) /usr/bin local export
+		-eu /usr/bin /usr/bin x=1 sed
+	local echo export /usr/bin local test
+		test -eu local && /usr/bin grep $(pwd) grep echo grep 2>/dev/null -eu
+		done --verbose $(pwd) readonly
+		/usr/bin local done grep && echo "$@" "$1" echo 'quoted text'
+sed "$1" then ${HOME} printf --verbose awk $(pwd) "$@" done "$1"
+then && "$1" test x=1 echo sed sed 2>/dev/null cd 'quoted text' ${HOME} "$@" done
+	/usr/bin x=1 && done export test "$1" --verbose 'quoted text' sed
+	local readonly printf x=1 test export
+	readonly --verbose 'quoted text' ${HOME} 2>/dev/null
+echo echo then "$1" sed | | done export
+	$(pwd) --verbose grep -eu grep
+	--verbose 2>/dev/null "$1" cd 2>/dev/null readonly
+done /usr/bin && | echo "$@" && "$@"
+'quoted text' printf done ${HOME} 'quoted text' done awk grep "$1" "$1"
+local export cd done -eu 'quoted text' done $(pwd) /usr/bin
+printf echo echo ${HOME} grep then "$@" && && -eu /usr/bin
+then x=1 export /usr/bin -eu -eu printf readonly
+&& cd x=1 readonly readonly -eu --verbose
+	--verbose "$@" | x=1 "$@" grep local -eu
+	export "$@" $(pwd) "$1" done grep && && readonly sed | 2>/dev/null test readonly
+x=1 echo done test /usr/bin | export 2>/dev/null -eu | printf 'quoted text'
+${HOME} cd export then x=1 /usr/bin
+	done then done readonly x=1 then ${HOME} /usr/bin "$@"
+	readonly readonly readonly
+	local export "$@" grep $(pwd) done readonly --verbose "$@"
+cd -eu && test local test echo echo
+		$(pwd) | ${HOME} then "$@"
+		grep | "$1" 2>/dev/null printf 'quoted text'
+"$@" -eu --verbose then x=1 awk test sed grep then | $(pwd) test local test --verbose
+		echo /usr/bin "$@" | local /usr/bin test then /usr/bin 2>/dev/null
+cd then | sed sed cd "$@" 'quoted text' &&
+readonly printf cd awk sed -eu ${HOME} printf --verbose /usr/bin
+	$(pwd) grep sed "$1" "$@" readonly awk readonly awk $(pwd)
+x=1 grep test printf && -eu "$@" $(pwd) echo awk -eu test
+	--verbose export awk --verbose readonly
+		/usr/bin | test then cd then sed
+	| && done && /usr/bin export local && grep ${HOME} | grep $(pwd) $(pwd) export
+	/usr/bin grep test export $(pwd) $(pwd) 2>/dev/null ${HOME}
+then -eu local readonly cd "$@"
+		--verbose | done printf "$1" then done && printf then
+-eu local | 'quoted text' "$1" cd test echo --verbose
+	&& "$@" local /usr/bin "$@" -eu sed x=1 printf /usr/bin
+		/usr/bin grep done x=1 ${HOME} $(pwd) -eu $(pwd) -eu done | local
+'quoted text' awk $(pwd) local "$@" done export -eu $(pwd) x=1 -eu then
+	$(pwd) test $(pwd) cd sed
+	test export echo /usr/bin "$1" done done cd done
+"$1" /usr/bin export echo export test -eu awk test | /usr/bin grep
+&& cd cd | sed echo printf "$1" 'quoted text' cd x=1 sed grep done x=1
+		printf 'quoted text' printf 2>/dev/null "$@"
+	echo --verbose sed echo "$@" printf
+	local readonly echo && printf cd readonly --verbose | sed $(pwd) awk
+local "$1" done readonly 2>/dev/null -eu test 2>/dev/null /usr/bin $(pwd)
+	echo readonly ${HOME} then test 2>/dev/null grep
+	/usr/bin ${HOME} test --verbose --verbose then done ${HOME} 'quoted text' test
+done sed printf grep --verbose x=1 --verbose sed "$@" &&
+	printf awk 'quoted text' 2>/dev/null
+	done -eu 'quoted text' /usr/bin
+	--verbose "$@" "$@" 2>/dev/null export printf
+done printf $(pwd) 2>/dev/null "$1" ${HOME} local readonly test grep
+-eu ${HOME} echo printf /usr/bin && echo export test | local $(pwd)
+		test awk x=1 local ${HOME} | $(pwd) done done |
+	/usr/bin /usr/bin readonly $(pwd) awk readonly
+		readonly && done sed -eu awk "$@" | readonly echo readonly 'quoted text'
+	sed $(pwd) ${HOME} ${HOME} ${HOME} -eu 'quoted text' export "$@"
+		export -eu $(pwd) --verbose readonly 'quoted text'
+grep then then awk test 2>/dev/null 2>/dev/null sed "$@"
+		"$1" 'quoted text' cd export -eu printf
+"$1" printf done sed x=1 | | sed local -eu
+		done -eu readonly readonly done
+-eu "$1" then && "$1" "$1" then done cd echo
+		then test 'quoted text' 2>/dev/null
+cd grep $(pwd) 2>/dev/null
+		| readonly 2>/dev/null test then && ${HOME} cd 'quoted text' 'quoted text'
+		2>/dev/null grep then x=1 printf | -eu x=1 test then "$@" $(pwd) "$1" local sed
+		$(pwd) -eu ${HOME} $(pwd) sed "$@" test then 'quoted text'
+		printf $(pwd) "$1" --verbose sed local
+	export cd done cd --verbose then 'quoted text' then 'quoted text'
+	-eu export 'quoted text'
+		sed echo test $(pwd) awk awk sed && $(pwd) readonly cd -eu | "$1"
+	2>/dev/null 'quoted text' done $(pwd) then -eu 2>/dev/null
+		cd --verbose --verbose /usr/bin done 2>/dev/null readonly --verbose -eu grep
+		then && $(pwd) local x=1 cd && --verbose printf
+		export 'quoted text' grep && /usr/bin readonly | readonly done cd /usr/bin ${HOME}
+		then ${HOME} then && x=1 test done
+		cd readonly cd export $(pwd)
+	done x=1 | printf grep cd $(pwd) then sed -eu export $(pwd)
+	$(pwd) 'quoted text' /usr/bin
+'quoted text' awk /usr/bin
+		&& 2>/dev/null -eu "$@" --verbose
+		echo $(pwd) done grep --verbose ${HOME}
+		cd done sed echo sed local x=1
+		-eu ${HOME} && && 'quoted text' "$@"
+	done then local sed export local ${HOME} 2>/dev/null && grep
+${HOME} grep grep cd echo echo echo grep /usr/bin done && cd test
+	$(pwd) 2>/dev/null printf 'quoted text'
+	$(pwd) 2>/dev/null grep cd cd "$1" echo cd sed test test | -eu then local
+cd "$1" 2>/dev/null $(pwd) 2>/dev/null done --verbose |
+		"$1" local readonly "$1" printf
+		$(pwd) 'quoted text' sed && awk awk
+		grep export --verbose ${HOME}
+	"$1" printf -eu sed /usr/bin -eu local sed --verbose
+	awk && -eu --verbose ${HOME} x=1 && ${HOME} $(pwd) "$1" ${HOME}
+		| printf ${HOME} readonly -eu
+	test /usr/bin test grep export 'quoted text'
+		2>/dev/null readonly -eu /usr/bin $(pwd) local $(pwd) x=1 --verbose test
+	then sed -eu cd "$@" echo cd printf && local "$1" local
+"$@" "$1" /usr/bin 2>/dev/null local ${HOME} "$1" --verbose then 2>/dev/null
+		then sed x=1 grep readonly -eu readonly && x=1 cd grep then "$@" 'quoted text'
+	echo 2>/dev/null 2>/dev/null
+-eu readonly sed | echo then sed cd printf | then grep ${HOME}
+		test x=1 | --verbose $(pwd) --verbose test -eu printf printf
+	x=1 /usr/bin echo done "$@" x=1 $(pwd)
+export $(pwd) $(pwd) local test /usr/bin sed "$1" local 'quoted text'
+		${HOME} grep "$1" "$1" /usr/bin sed "$@" "$@" -eu
+/usr/bin | x=1 awk cd export --verbose awk awk -eu test readonly
+$(pwd) 'quoted text' && "$@" -eu cd
+	echo ${HOME} printf "$1" -eu $(pwd) export done sed $(pwd) readonly
+	awk echo grep 'quoted text' && cd sed export then readonly x=1 sed cd "$@" awk 2>/dev/null
+	printf /usr/bin test test
+		readonly | awk printf cd x=1 'quoted text'
+	then --verbose readonly --verbose readonly /usr/bin
+	${HOME} grep awk x=1 test
+	"$1" local "$1" done printf 2>/dev/null
+		printf x=1 then -eu test
+	&& test cd test local cd printf export
+	export local sed test "$@" done /usr/bin &&
+		2>/dev/null local sed 2>/dev/null export
+local "$@" ${HOME} awk && 'quoted text'
+	&& && cd test readonly "$@" done 2>/dev/null printf x=1
+&& test done -eu 'quoted text' /usr/bin then echo
+done /usr/bin export x=1 sed test ${HOME} then export "$@"
+	printf ${HOME} test readonly printf |
+	&& -eu 2>/dev/null /usr/bin "$@" $(pwd)
+x=1 grep done 2>/dev/null | ${HOME}
+sed sed done 2>/dev/null "$1" 'quoted text'
+	then sed cd 2>/dev/null cd -eu && then && -eu readonly "$@" echo ${HOME}
+'quoted text' export sed
+	-eu "$1" 2>/dev/null cd | "$1" export 'quoted text' 'quoted text' sed "$@"
+		2>/dev/null 2>/dev/null
+local x=1 "$1" x=1 then awk printf
+	grep then 'quoted text' 'quoted text' ${HOME} && /usr/bin echo
+		awk test grep "$1" 'quoted text' 'quoted text'
+	readonly "$1" test awk test 2>/dev/null /usr/bin |
+	${HOME} sed && /usr/bin --verbose "$@"
+	-eu ${HOME} $(pwd) && test printf x=1 "$@" cd readonly --verbose readonly local
+printf && 'quoted text' --verbose sed
+		"$@" x=1 2>/dev/null sed 'quoted text' $(pwd) awk
+sed export then echo | done
+	'quoted text' cd readonly test --verbose "$@" export sed x=1 export echo ${HOME}
+	$(pwd) readonly awk echo | done && ${HOME} 2>/dev/null 2>/dev/null && x=1 | sed
+${HOME} "$@" && -eu $(pwd) ${HOME} 'quoted text' grep 2>/dev/null "$1" 2>/dev/null
+		test x=1 export -eu readonly cd readonly
+		printf done readonly sed x=1
+	echo echo export sed test local -eu readonly | 2>/dev/null
+		$(pwd) echo | local then awk sed
+		"$@" export done export grep x=1 ${HOME} 2>/dev/null
+	| 2>/dev/null 'quoted text' 2>/dev/null -eu /usr/bin
+		cd "$@" done sed /usr/bin cd x=1 local | "$@" then sed sed 'quoted text'
+	readonly grep then 'quoted text'
+	then grep x=1 2>/dev/null export | ${HOME} then then
+		| 2>/dev/null /usr/bin /usr/bin awk
+echo done && ${HOME} printf
+	| /usr/bin awk 'quoted text' printf
+	&& "$@" cd export -eu awk
+		'quoted text' printf readonly
+printf 2>/dev/null "$1" "$@"
+	echo /usr/bin cd -eu test 2>/dev/null awk -eu /usr/bin cd awk
+		export cd printf ${HOME} test 2>/dev/null && printf ${HOME} --verbose
+	local -eu 'quoted text' -eu readonly export --verbose readonly
+		export local x=1 export 2>/dev/null -eu local "$@"
+	$(pwd) printf $(pwd) | 2>/dev/null
+		-eu | sed --verbose export then test
+		| "$1" sed test && 2>/dev/null done export cd export 'quoted text' /usr/bin export
+$(pwd) | readonly cd
+	printf 2>/dev/null printf "$1" /usr/bin cd then --verbose $(pwd)
+	cd $(pwd) export && readonly then --verbose ${HOME} "$1" 2>/dev/null export | echo
+		local 2>/dev/null readonly
+done && sed local 2>/dev/null x=1 "$@" "$1" 'quoted text' grep $(pwd) ${HOME} x=1
+		$(pwd) /usr/bin done x=1 cd done x=1 sed sed printf
+		$(pwd) 'quoted text' test
+		awk "$@" grep "$1" then "$@" | local "$@" grep export ${HOME} && readonly
+	awk local then && echo | test | "$1" | export local cd x=1 "$1"
+	"$@" | x=1 grep --verbose "$@" cd 'quoted text'
+2>/dev/null cd "$1" "$1" printf "$1"
+		printf grep sed ${HOME} -eu 2>/dev/null test sed test 'quoted text' && --verbose
+	-eu awk 2>/dev/null readonly cd grep printf local
+		readonly "$@" ${HOME} printf test --verbose && awk export "$1" 2>/dev/null --verbose
+		2>/dev/null then then ${HOME} "$@" grep $(pwd)
+	local 2>/dev/null "$@" | sed ${HOME} ${HOME} test cd awk echo
+	x=1 | ${HOME} awk ${HOME} -eu "$1" awk
+		awk x=1 && readonly "$1" | grep "$@"
+	echo sed -eu sed && && -eu --verbose
+		printf test 2>/dev/null -eu "$@"
+2>/dev/null then readonly /usr/bin
+2>/dev/null test grep /usr/bin
+	$(pwd) 'quoted text' printf local
+/usr/bin | awk sed "$1" done
+		grep /usr/bin 2>/dev/null ${HOME} readonly then | -eu
+x=1 2>/dev/null -eu ${HOME} local done 'quoted text' echo $(pwd) -eu
+	test cd /usr/bin export
+-eu done test /usr/bin "$@" echo && done | $(pwd) printf echo sed
+		x=1 $(pwd) "$@" x=1 | ${HOME} 'quoted text' printf && ${HOME}
+		"$@" test readonly sed --verbose
+"$@" "$@" test x=1 $(pwd) done readonly "$@"
+	/usr/bin export readonly | "$1" local 'quoted text' awk x=1 awk test grep
+	'quoted text' awk local echo x=1 echo export local
+		/usr/bin grep sed readonly $(pwd) then cd then --verbose then then readonly
+		x=1 -eu 'quoted text' cd --verbose printf $(pwd) then
+	$(pwd) export done && local $(pwd) export then -eu test x=1 then grep x=1
+		/usr/bin test cd 'quoted text' "$@" 'quoted text' 2>/dev/null awk "$@" 2>/dev/null
+	printf && --verbose /usr/bin "$1" done 2>/dev/null
+		awk echo "$1" 'quoted text' done printf then awk 2>/dev/null
+test 2>/dev/null | readonly echo --verbose done export export grep test cd
+		then printf /usr/bin then 'quoted text' -eu grep 2>/dev/null
+		${HOME} && grep -eu echo
+"$1" $(pwd) test "$@" done | $(pwd)
+	/usr/bin done $(pwd) cd test printf ${HOME} ${HOME} test cd --verbose
+x=1 2>/dev/null -eu printf --verbose -eu "$1" --verbose
+	| echo done $(pwd) ${HOME} -eu 'quoted text' sed test readonly
+		then awk printf sed --verbose test printf done ${HOME} -eu /usr/bin
+		local printf local awk /usr/bin "$1" grep --verbose done "$1" done export
+	awk done done $(pwd) echo test
+		test && && ${HOME} && printf then grep --verbose ${HOME} test then
+echo awk --verbose x=1 ${HOME} grep -eu done done "$@" ${HOME} | |
+${HOME} /usr/bin 'quoted text' sed ${HOME} -eu && "$1"
+		--verbose $(pwd) done && "$@" | done
+		grep 'quoted text' "$1" test
+		local then printf -eu $(pwd) sed 2>/dev/null printf && printf export printf
+x=1 export grep printf $(pwd) "$@" /usr/bin grep done /usr/bin $(pwd) test -eu
+	/usr/bin && local && "$1" printf x=1 /usr/bin test --verbose
+	-eu && && then -eu cd echo cd "$1" done 'quoted text'
+		sed x=1 cd /usr/bin then grep readonly grep readonly then done echo --verbose
+		awk local printf local && $(pwd) "$@" "$@" ${HOME} -eu readonly
+printf "$@" -eu test export printf readonly
+	then 2>/dev/null echo readonly done sed
+| 'quoted text' printf readonly readonly "$@" $(pwd) -eu "$@" $(pwd) x=1
+		--verbose test then export awk
+		--verbose $(pwd) then ${HOME} sed export 2>/dev/null -eu
+		x=1 test $(pwd) $(pwd) 2>/dev/null ${HOME} done "$@" echo $(pwd) sed -eu done
+	grep "$1" $(pwd) then printf && | test 2>/dev/null done -eu printf
+	'quoted text' cd "$@" -eu then
+| | echo readonly sed "$1" /usr/bin export /usr/bin 'quoted text' test export
+awk -eu export local -eu x=1 done
+${HOME} && "$1" --verbose "$@" x=1 "$1" awk --verbose /usr/bin --verbose 2>/dev/null
+	"$@" sed local grep && ${HOME}
+		test | /usr/bin && 'quoted text' --verbose /usr/bin "$@" --verbose && test
+		test "$1" grep test --verbose ${HOME} cd test /usr/bin
+echo "$@" ${HOME} readonly
+	/usr/bin echo readonly export x=1 /usr/bin $(pwd)
+		| echo /usr/bin awk ${HOME} test 2>/dev/null export --verbose grep then local
+		done "$@" grep x=1 export -eu printf x=1 then
+	'quoted text' done x=1 awk done grep && -eu x=1 echo
+		'quoted text' echo export -eu --verbose awk &&
+		then | cd $(pwd) $(pwd) ${HOME} "$1" &&
+		--verbose $(pwd) readonly x=1 readonly then 2>/dev/null test export
+2>/dev/null export -eu export "$@" sed -eu && echo 2>/dev/null done then "$@"
+	"$@" /usr/bin && grep x=1 export local x=1
+		&& awk x=1 --verbose | readonly
+	/usr/bin grep grep && local
+	printf echo -eu x=1 local -eu $(pwd) ${HOME} x=1 "$@" test awk export
+	local awk 2>/dev/null | test | local ${HOME} done grep readonly /usr/bin
+	local "$1" x=1 export test test echo -eu "$1" && x=1 |
+		/usr/bin x=1 $(pwd) | export -eu local 'quoted text' && local
+	'quoted text' local /usr/bin readonly cd grep
+-eu x=1 local cd then /usr/bin --verbose printf "$@" -eu -eu
+	${HOME} export cd 2>/dev/null printf then $(pwd) ${HOME} 'quoted text'
+x=1 test && local --verbose done x=1 | export "$@" export echo done ${HOME}
+	grep test --verbose /usr/bin sed local echo done done
+printf grep "$@" test printf "$@" 2>/dev/null then | /usr/bin "$1"
+		'quoted text' && sed ${HOME} && then
+printf $(pwd) done "$@" export "$1" local $(pwd) /usr/bin awk "$@"
+/usr/bin "$1" done awk && --verbose then export then
+		"$@" /usr/bin $(pwd) cd test
+		sed local local ${HOME} awk
+		export 'quoted text' /usr/bin export grep $(pwd) done sed
+	local $(pwd) /usr/bin x=1 done done echo /usr/bin printf "$@"
+		printf test -eu readonly sed local echo awk "$@"
+	done ${HOME} && -eu | x=1 x=1 cd then test 2>/dev/null then
+	echo local "$@" --verbose ${HOME} /usr/bin test ${HOME}
+	/usr/bin done "$1" then cd "$@" done awk -eu $(pwd)
+test -eu sed sed test cd | then -eu 'quoted text' done local -eu
+	readonly local test readonly sed readonly
+test done printf | /usr/bin --verbose | done test local echo export 'quoted text'
+		cd done export "$@" done
+	"$@" export grep grep "$1" ${HOME} echo grep export then cd then
+test awk echo done readonly && "$1" -eu --verbose
+		/usr/bin test 2>/dev/null x=1 local export printf | awk && | 'quoted text'
+		cd 'quoted text' ${HOME} test
+'quoted text' readonly 2>/dev/null grep "$1" sed &&
+cd sed then --verbose $(pwd) $(pwd) -eu | local /usr/bin sed ${HOME}
+		"$1" /usr/bin ${HOME} x=1 2>/dev/null then export grep
+--verbose "$@" x=1 grep -eu | awk
+		local ${HOME} grep done --verbose ${HOME} $(pwd) -eu
+echo x=1 test x=1 done then | readonly export 'quoted text' echo then readonly
+		done -eu readonly printf printf x=1 printf
+$(pwd) 'quoted text' awk
+		done --verbose echo -eu "$1" && readonly
+done sed done $(pwd) && -eu echo 'quoted text' printf --verbose && --verbose $(pwd)
+'quoted text' -eu then 2>/dev/null "$@" awk /usr/bin echo | ${HOME} | "$1" sed
+grep && $(pwd) printf "$@" 2>/dev/null
+/usr/bin "$1" --verbose test then "$1" grep export "$@"
+	export done local | "$@" then sed local /usr/bin 2>/dev/null awk grep done &&
+	&& local export 'quoted text'
+		-eu cd "$1" then && readonly local export test grep && test then --verbose done
+	readonly then local then | /usr/bin "$@" echo
+	done done "$1" sed "$@" echo then then
+		cd x=1 && ${HOME} readonly then ${HOME}
+		--verbose "$@" /usr/bin readonly && done --verbose "$1"
+	printf export export then awk done /usr/bin "$@" grep
+then 'quoted text' cd test && /usr/bin cd /usr/bin readonly "$@"
+	-eu cd && awk then printf local
+done sed done 2>/dev/null "$1" | 'quoted text' local readonly test test
+	--verbose grep | -eu /usr/bin echo done awk $(pwd) grep printf cd awk $(pwd)
+sed 2>/dev/null x=1 grep "$@" "$1" sed echo done awk test && "$@" x=1 2>/dev/null
+	grep export x=1 "$1" readonly readonly
+		echo x=1 printf done then "$@" | 'quoted text' "$1" "$@" "$1" done sed "$@"
+--verbose then "$@" --verbose x=1 grep 2>/dev/null sed then
+	x=1 grep x=1 && test --verbose cd x=1 /usr/bin grep -eu printf printf readonly
+		printf "$@" /usr/bin ${HOME} "$@" test
+		then printf readonly echo /usr/bin "$@"
+		/usr/bin printf echo | "$1" awk --verbose
+sed -eu grep cd "$@" sed cd grep x=1 printf $(pwd) | done grep cd ${HOME} cd awk
+done done printf done export --verbose 'quoted text'
+"$1" sed cd x=1 $(pwd) cd "$@" --verbose then echo /usr/bin /usr/bin export grep
+-eu echo done printf printf sed test x=1 --verbose --verbose printf echo --verbose
+	x=1 -eu printf printf done
+	cd readonly 'quoted text' cd /usr/bin "$1" 2>/dev/null && grep x=1
+	--verbose test "$@" ${HOME}
+	test local grep sed x=1 -eu awk local done ${HOME} readonly --verbose grep
+		&& x=1 'quoted text' && sed export done sed
+		local x=1 -eu export printf "$@" awk
+x=1 test grep echo grep 2>/dev/null test
+	sed | echo cd "$1" 'quoted text' x=1 | | 'quoted text' $(pwd) 'quoted text'
+	${HOME} ${HOME} cd | cd done test test "$@" then export local cd local grep echo
+	/usr/bin | ${HOME} x=1 x=1 2>/dev/null
+export local /usr/bin --verbose awk /usr/bin x=1 then then echo ${HOME}
+sed 2>/dev/null sed && | awk x=1
+		cd printf && "$1" awk done && --verbose --verbose export
+	awk grep printf cd cd cd --verbose && readonly && export test
+	$(pwd) printf /usr/bin x=1 awk /usr/bin | /usr/bin
+		awk 2>/dev/null --verbose done then $(pwd) then | echo grep cd
+		done x=1 "$1" test local local local x=1 $(pwd) done echo
+awk readonly done cd printf then 'quoted text' local /usr/bin readonly readonly
+		done echo -eu && | sed | /usr/bin local cd grep readonly sed readonly 'quoted text'
+	then ${HOME} && sed /usr/bin cd "$1" export x=1 printf "$@" awk ${HOME} --verbose
+	&& echo done "$1" ${HOME} -eu 2>/dev/null "$@" then cd export
+		x=1 awk readonly "$@" ${HOME} -eu awk "$@" ${HOME} | x=1 then --verbose
+	readonly | readonly /usr/bin
+		grep 2>/dev/null awk $(pwd) test echo local then -eu /usr/bin
+/usr/bin 2>/dev/null 2>/dev/null $(pwd) readonly /usr/bin then && sed printf
+	/usr/bin test && readonly 'quoted text' 2>/dev/null && /usr/bin "$@"
+		&& then echo awk x=1 sed grep "$@" /usr/bin
+		grep readonly "$@" cd ${HOME} local awk "$@" "$@" grep export x=1 awk /usr/bin
+		export "$@" "$1" cd --verbose ${HOME} --verbose ${HOME}
+		awk awk /usr/bin ${HOME} "$@"
+		--verbose cd && echo local local then $(pwd)
+		'quoted text' /usr/bin x=1 'quoted text' grep echo 2>/dev/null sed done 'quoted text'
+--verbose awk done grep readonly readonly done
+export awk sed x=1 'quoted text' cd awk && sed local "$1" "$@"
+		x=1 awk | test awk printf printf
+		grep 2>/dev/null -eu "$@" $(pwd) -eu local 'quoted text' "$1" | /usr/bin sed
+	${HOME} cd x=1 -eu sed then grep awk --verbose
+grep | echo grep ${HOME} -eu "$1" /usr/bin | x=1 cd | cd echo -eu --verbose
+	${HOME} done local echo x=1 then "$1" x=1 --verbose local test
+		done sed | grep test local local test cd $(pwd) -eu | echo 'quoted text'
+	export done then grep printf | sed readonly done
+-eu test 2>/dev/null test echo --verbose ${HOME} "$1" ${HOME}
+printf test local /usr/bin grep | 'quoted text' 'quoted text' readonly awk test
+/usr/bin then | | export /usr/bin done
+		| /usr/bin "$@" 'quoted text' ${HOME} "$@" ${HOME} $(pwd) cd local 2>/dev/null
+| && ${HOME} awk $(pwd) -eu
+	"$@" printf /usr/bin printf -eu /usr/bin $(pwd) sed
+printf /usr/bin export awk | x=1 2>/dev/null test
+	test readonly ${HOME} x=1 'quoted text' awk -eu
+		$(pwd) local awk && 'quoted text'
+		local "$1" "$1" && $(pwd) awk | awk | echo grep echo 2>/dev/null
+export && 2>/dev/null ${HOME} awk done cd
+	cd /usr/bin && awk cd 2>/dev/null
+	export then x=1 test sed /usr/bin -eu 2>/dev/null
+	| /usr/bin printf -eu 2>/dev/null "$@" then
+/usr/bin test 'quoted text' ${HOME} $(pwd)
+	readonly awk "$1" then 'quoted text'
+		printf awk ${HOME} -eu local 'quoted text' sed grep readonly
+	"$@" cd grep echo sed test readonly
+		printf "$1" 2>/dev/null --verbose ${HOME} "$@" printf /usr/bin
+	done export --verbose printf
+	$(pwd) 'quoted text' sed export
+		export x=1 echo test ${HOME} | && ${HOME} 2>/dev/null 2>/dev/null printf 'quoted text'
+	echo && test readonly "$@" "$1" readonly --verbose then
+	/usr/bin 2>/dev/null then export sed grep export x=1 done 2>/dev/null done
+'quoted text' $(pwd) 'quoted text'
+cd -eu "$@" local grep
+		-eu grep /usr/bin --verbose && awk echo -eu export readonly
+export && "$1" awk export --verbose
+		"$@" printf "$1" x=1 done
+	| "$1" -eu /usr/bin "$@" then | cd awk echo export 'quoted text' && then
+	"$@" --verbose grep /usr/bin && grep x=1
+test sed && 'quoted text' "$1"
+	readonly test export $(pwd) awk echo
+done && grep then "$@" printf "$1" test
+		export local grep then x=1 x=1 test | 'quoted text' then readonly /usr/bin &&
+	readonly awk /usr/bin 2>/dev/null test awk x=1 "$1" $(pwd) ${HOME} -eu | export
+export awk "$1" readonly grep 'quoted text' awk $(pwd)
+		readonly test sed /usr/bin echo /usr/bin && awk
+printf 2>/dev/null sed printf x=1 --verbose -eu
+printf sed echo x=1 x=1 grep then local awk export echo cd && $(pwd) "$@"
+	grep done done awk readonly &&
+	x=1 export sed echo "$@"
+	readonly done done 'quoted text'
+	echo /usr/bin $(pwd) /usr/bin echo echo grep "$@" ${HOME} then
+	"$@" test | --verbose awk ${HOME} 2>/dev/null printf
+		"$@" sed 2>/dev/null --verbose "$@"
+sed echo readonly done echo | x=1 "$1"
+	&& printf | && sed --verbose done ${HOME} 'quoted text' --verbose echo printf
+		readonly 2>/dev/null 2>/dev/null done printf cd cd test --verbose
+&& -eu 'quoted text' local x=1 | local x=1 2>/dev/null awk echo /usr/bin 2>/dev/null
+		grep -eu -eu echo sed printf | x=1 && cd cd "$1" "$1" $(pwd)
+	export sed "$@" -eu "$1" $(pwd) printf --verbose --verbose | then then -eu | 'quoted text'
+		cd printf sed /usr/bin export --verbose
+		/usr/bin && cd 'quoted text'
+	grep "$@" 2>/dev/null cd 2>/dev/null export awk local ${HOME} readonly
+		readonly printf cd "$1" grep cd printf local sed | test x=1 then sed ${HOME} "$1"
+readonly cd $(pwd) -eu
+		| 'quoted text' sed $(pwd) 2>/dev/null
+		export echo cd test readonly --verbose "$1"
+${HOME} readonly printf 2>/dev/null local
+echo local local awk printf done x=1 "$@" cd /usr/bin cd 2>/dev/null && /usr/bin
+	awk -eu | echo awk then export test
+| && -eu ${HOME} grep export && --verbose "$1"
+	&& sed --verbose sed test then then awk done | local then awk | | | x=1
+	done readonly echo awk grep done then cd $(pwd)
+	echo 'quoted text' awk done 'quoted text' then 2>/dev/null then sed cd &&
+	"$@" sed 'quoted text' -eu local local then awk
+		--verbose printf grep "$1" $(pwd) 'quoted text'
+done printf test -eu awk && --verbose /usr/bin echo printf 2>/dev/null /usr/bin
+-eu x=1 ${HOME} 2>/dev/null echo test
+	export 'quoted text' awk $(pwd) printf
+	sed awk cd $(pwd) done $(pwd) grep ${HOME}
+/usr/bin sed $(pwd) done readonly
+	"$@" ${HOME} echo "$@" 'quoted text' echo && 2>/dev/null readonly done echo
+	-eu awk printf /usr/bin --verbose "$@" readonly
+${HOME} local $(pwd) then cd export printf ${HOME} --verbose
+		/usr/bin done "$@" -eu "$1" "$1" printf | awk export -eu /usr/bin cd
+"$1" x=1 done -eu readonly x=1 test --verbose done done export
+grep printf 2>/dev/null "$@" | echo cd export export
+	test 'quoted text' then done $(pwd) | "$1" printf test printf
+	then && sed 2>/dev/null /usr/bin /usr/bin | x=1 local done readonly -eu
+		| 'quoted text' grep ${HOME} $(pwd) local local export --verbose "$1" sed |
+'quoted text' "$@" grep $(pwd) test done && /usr/bin printf ${HOME}
+done done cd x=1 done test -eu grep sed $(pwd)
+		--verbose test echo awk local awk cd echo /usr/bin export
+	| -eu -eu then test awk /usr/bin local
+	grep 'quoted text' echo cd && cd --verbose done
+readonly $(pwd) then test
+		"$1" sed "$1" "$1" | sed --verbose "$1" export ${HOME} done
+	--verbose echo cd | readonly /usr/bin then awk test test 'quoted text' "$@" awk
+		printf then $(pwd) done grep 'quoted text'
+echo ${HOME} "$1" && "$1" readonly readonly echo printf
+readonly "$@" printf then then grep export ${HOME} 'quoted text'
+	awk && 'quoted text' &&
+${HOME} export export grep local | then done "$@" echo
+$(pwd) sed grep ${HOME} --verbose grep 2>/dev/null $(pwd) test "$@" x=1 "$1"
+'quoted text' /usr/bin "$1" "$1" ${HOME} x=1 | then "$1"
+	'quoted text' "$@" x=1 grep sed -eu printf readonly awk | readonly $(pwd)
+		/usr/bin x=1 printf | --verbose echo --verbose $(pwd)
+		-eu then done readonly awk done | then x=1 x=1 local "$1" --verbose test test
+-eu | -eu done 'quoted text' "$@" printf "$@"
+	then ${HOME} echo done local readonly "$@" grep sed "$1" local
+	printf done sed awk -eu --verbose
+| "$1" --verbose /usr/bin ${HOME} cd grep | awk 'quoted text' awk local echo
+'quoted text' /usr/bin ${HOME} then done -eu then local | 'quoted text'
+	then && && | | "$1" -eu then $(pwd) 'quoted text' x=1 "$1" /usr/bin
+	local ${HOME} --verbose done /usr/bin test test printf --verbose
+${HOME} --verbose 'quoted text'
+	--verbose sed /usr/bin then /usr/bin "$1" export 2>/dev/null
+		"$1" export export --verbose
+		${HOME} local --verbose $(pwd)
+		-eu sed sed x=1 export 'quoted text'
+&& 2>/dev/null | 2>/dev/null
+		test $(pwd) cd $(pwd) "$@" done $(pwd)
+cd -eu 'quoted text' /usr/bin "$1" grep "$1" ${HOME}
+		${HOME} test 'quoted text' awk export done x=1 readonly grep --verbose
+echo local local /usr/bin 2>/dev/null
+		$(pwd) 'quoted text' then x=1 "$@" x=1 ${HOME}
+	printf -eu -eu -eu cd "$@"
+	grep export test export /usr/bin echo
+		readonly -eu 2>/dev/null readonly ${HOME} 'quoted text' grep readonly
+	"$1" test -eu done export echo /usr/bin -eu readonly && /usr/bin local cd readonly
+'quoted text' /usr/bin export --verbose x=1 done cd
+| printf then export done readonly "$@" x=1 $(pwd) grep
+	local echo cd "$@" done "$1" $(pwd)
+		/usr/bin 2>/dev/null readonly
+--verbose x=1 local "$@" x=1
+$(pwd) local 2>/dev/null && export readonly ${HOME} done
+readonly && grep -eu -eu "$@" cd sed 2>/dev/null echo && ${HOME}
+		awk "$1" x=1 sed export
+	awk done -eu -eu printf $(pwd) x=1 'quoted text'
+	"$1" echo printf local | --verbose $(pwd) local /usr/bin /usr/bin
+		done test grep export 2>/dev/null test && 'quoted text' awk awk readonly
+	test cd done local test x=1 printf awk export /usr/bin --verbose && printf 2>/dev/null
+		then test grep | sed then $(pwd) "$1" "$1" ${HOME} $(pwd) done
+test --verbose -eu | /usr/bin $(pwd) then grep readonly
+		done test awk --verbose done cd 2>/dev/null
+	-eu grep sed ${HOME} echo "$@" 'quoted text' echo
+	grep test -eu awk awk readonly
+	export printf $(pwd) "$@" x=1 sed echo cd awk "$@" echo "$1" $(pwd) grep
+"$@" /usr/bin export 'quoted text' ${HOME} then awk local $(pwd)
+		sed "$1" done done then export then 'quoted text' grep
+/usr/bin "$1" 2>/dev/null grep
+	test ${HOME} 2>/dev/null awk done test && 2>/dev/null local /usr/bin -eu
+	test echo && && cd 2>/dev/null
+		then $(pwd) then | done cd awk printf local
+sed cd cd $(pwd) grep done | export grep && "$1" x=1 printf grep export "$1"
+	readonly 2>/dev/null printf ${HOME} /usr/bin && test
+		'quoted text' ${HOME} /usr/bin && done echo
+-eu readonly | | x=1
+		&& then && x=1 2>/dev/null --verbose echo then "$1"
+		local test -eu awk | $(pwd) sed /usr/bin
+"$@" awk test echo local readonly echo 2>/dev/null ${HOME} && printf && readonly
+done local 2>/dev/null readonly 'quoted text'
+		--verbose export 'quoted text' 2>/dev/null done readonly && 2>/dev/null
+		&& /usr/bin /usr/bin echo readonly export readonly
+		readonly echo 2>/dev/null $(pwd) 'quoted text' 2>/dev/null
+done cd -eu "$@" readonly
+	2>/dev/null export cd
+then && x=1 export test printf
+		awk sed printf test grep readonly readonly export /usr/bin "$1" then /usr/bin
+		sed ${HOME} && local /usr/bin cd printf /usr/bin test
+		test sed done x=1 sed test
+2>/dev/null /usr/bin done && sed x=1 grep awk cd grep x=1 done | grep | readonly
+		awk test cd -eu ${HOME} grep echo "$1" $(pwd) then --verbose printf &&
+		grep "$1" awk /usr/bin
+		readonly local ${HOME} -eu printf
+		printf done then | echo cd cd "$1" 2>/dev/null ${HOME} "$@" x=1
+then local && /usr/bin export grep ${HOME} /usr/bin then | grep ${HOME} "$1"
+	${HOME} export echo ${HOME} ${HOME} && /usr/bin printf then then awk
+	awk done "$1" cd ${HOME} /usr/bin printf echo grep x=1 echo $(pwd) sed | 2>/dev/null
+	2>/dev/null grep awk /usr/bin then test echo -eu --verbose
+		$(pwd) done printf grep sed grep $(pwd) local ${HOME} /usr/bin grep printf "$@"
+x=1 "$1" printf cd ${HOME} "$1" "$@" && cd "$1" grep | && export test 2>/dev/null
+	local "$@" test --verbose
+	done cd awk "$1" cd -eu "$@" -eu
+awk local echo awk ${HOME} local -eu && "$@" cd sed then sed
+grep done 2>/dev/null awk export grep
+		'quoted text' readonly then 2>/dev/null "$@" grep -eu cd grep
+		export export | "$@" 'quoted text'
+${HOME} ${HOME} 2>/dev/null sed | x=1 --verbose 2>/dev/null awk printf
+		local then readonly /usr/bin x=1 sed
+x=1 done then -eu | printf sed then printf 2>/dev/null echo local /usr/bin
+'quoted text' "$1" local "$@" -eu readonly $(pwd) $(pwd) x=1 /usr/bin
+--verbose $(pwd) done then "$1" done then awk -eu echo $(pwd) readonly
+		then awk x=1 then printf /usr/bin
+		local && $(pwd) export printf "$@" test local
+export test ${HOME} && ${HOME}
+readonly 2>/dev/null printf awk done "$@" grep printf "$@" "$@" --verbose then
+2>/dev/null /usr/bin x=1 done | 2>/dev/null
+		--verbose echo sed grep -eu | /usr/bin
+| cd readonly -eu "$@" readonly sed $(pwd)
+export /usr/bin readonly --verbose --verbose then then ${HOME}
+cd x=1 $(pwd) grep "$1" 2>/dev/null cd cd test printf
+	export 2>/dev/null 'quoted text' 'quoted text'
+	&& cd | printf /usr/bin
+/usr/bin grep local then -eu
+x=1 | readonly local printf -eu export 'quoted text'
+		cd ${HOME} | "$1" sed local local ${HOME} -eu cd 'quoted text' 'quoted text'
+&& readonly then x=1 /usr/bin "$1" | | &&
+--verbose then export --verbose ${HOME} -eu done x=1 /usr/bin
+		then x=1 /usr/bin then 2>/dev/null grep /usr/bin done grep grep 2>/dev/null
+		${HOME} $(pwd) "$1" "$1" echo -eu
+printf 'quoted text' 'quoted text' echo grep -eu "$@" 'quoted text' --verbose
+cd printf export x=1 sed sed /usr/bin printf readonly "$1" "$@" && sed grep
+	$(pwd) 'quoted text' grep then -eu done cd echo sed /usr/bin printf done -eu
+$(pwd) readonly echo -eu 2>/dev/null test then 'quoted text' test
+		| local echo export grep $(pwd) 'quoted text' awk grep sed then
+		cd x=1 2>/dev/null export | grep 'quoted text' cd | $(pwd)
+	--verbose -eu 'quoted text' -eu printf "$@"
+${HOME} --verbose cd $(pwd) export awk cd 2>/dev/null then grep 2>/dev/null
+cd $(pwd) cd 2>/dev/null "$1" cd awk test local test | awk ${HOME} "$1" local
+		readonly test $(pwd) x=1 --verbose "$@" done /usr/bin "$@" x=1 $(pwd)
+	export x=1 "$1" sed export
+		sed "$@" echo -eu | | -eu echo awk && /usr/bin ${HOME} "$@"
+		"$@" $(pwd) grep echo local "$1" -eu | local -eu local ${HOME} ${HOME} export
+		&& awk "$@" echo done test grep local local
+		echo /usr/bin 2>/dev/null
+		printf grep "$1" ${HOME}
+echo "$@" 2>/dev/null "$1" then -eu local
+	grep export then ${HOME} | local echo printf local && && readonly 2>/dev/null
+cd sed x=1 ${HOME} && && done $(pwd) -eu x=1 &&
+	${HOME} printf awk && sed && && sed 2>/dev/null "$1" "$@" "$1"
+	echo 'quoted text' /usr/bin
+	done "$1" done $(pwd) readonly 2>/dev/null "$@"
+		'quoted text' test printf x=1 | cd export done
+cd grep | then --verbose -eu ${HOME}
+		export grep /usr/bin /usr/bin grep 'quoted text' test test && --verbose
+printf x=1 -eu printf -eu echo
+	x=1 printf "$1" grep x=1 test 2>/dev/null /usr/bin ${HOME} echo export
+		grep grep local ${HOME} test readonly cd --verbose
+		"$1" sed export done 2>/dev/null local | test done
+	/usr/bin /usr/bin "$@" "$@" sed grep && && ${HOME}
+		$(pwd) awk sed awk readonly $(pwd) ${HOME} readonly 'quoted text' --verbose
+done grep local $(pwd) ${HOME} cd sed && --verbose sed x=1 printf echo 2>/dev/null
+sed 'quoted text' x=1 --verbose
+	"$@" sed && 'quoted text' readonly
+		'quoted text' --verbose local export done grep && local "$1"
+	&& ${HOME} 'quoted text' printf cd 'quoted text' test x=1
+		/usr/bin done | export $(pwd) $(pwd) 'quoted text' 2>/dev/null
+	| ${HOME} export /usr/bin sed
+done -eu 'quoted text' local test echo cd test done export $(pwd) --verbose
+		'quoted text' "$@" 2>/dev/null 2>/dev/null awk -eu
+		x=1 | sed "$1" then export "$1" awk -eu printf x=1
+x=1 cd export 'quoted text' printf sed x=1 done cd "$@"
+		'quoted text' && cd "$1" sed 2>/dev/null
+$(pwd) x=1 then awk 2>/dev/null 'quoted text' -eu echo /usr/bin
+	readonly awk x=1 awk then ${HOME} then readonly
+	$(pwd) sed && grep "$@" /usr/bin test
+x=1 sed echo ${HOME} $(pwd) done grep 'quoted text' then readonly sed
+		/usr/bin readonly readonly 'quoted text'
+$(pwd) readonly grep -eu |
+then 'quoted text' export sed printf --verbose
+	| | "$@" | && then ${HOME} /usr/bin -eu | 2>/dev/null x=1 done x=1 sed done
+$(pwd) awk /usr/bin 2>/dev/null
+		readonly /usr/bin grep $(pwd) "$@" sed 'quoted text' $(pwd) x=1 && /usr/bin
+	"$1" then readonly --verbose "$1" -eu /usr/bin readonly "$@" && echo
+	printf "$@" $(pwd) --verbose
+		done then -eu echo sed printf ${HOME} then "$@" printf awk x=1 | echo local
+		x=1 2>/dev/null export x=1 'quoted text' --verbose -eu echo cd grep
+readonly then 'quoted text' ${HOME} then sed sed echo "$1" /usr/bin
+	x=1 $(pwd) done sed grep
+	grep ${HOME} export && -eu "$1" ${HOME} test local done -eu "$1"
+	&& 2>/dev/null awk -eu grep && awk printf export && "$1" export printf
+		awk cd printf | -eu "$@" --verbose export printf $(pwd) x=1 local --verbose
+		2>/dev/null awk awk 'quoted text' test 'quoted text' ${HOME} /usr/bin
+		awk cd ${HOME} done /usr/bin test awk
+		then readonly x=1 ${HOME} then
+'quoted text' "$1" grep | test 'quoted text'
+local printf readonly $(pwd) readonly "$@"
+		/usr/bin x=1 export done 'quoted text' /usr/bin then 2>/dev/null
+	echo local export && -eu readonly $(pwd) awk printf
+	readonly ${HOME} cd sed ${HOME} echo cd 2>/dev/null 'quoted text'
+		grep grep done 'quoted text' 2>/dev/null --verbose 'quoted text'
+'quoted text' awk local 'quoted text'
+		readonly ${HOME} grep 2>/dev/null
+		echo /usr/bin local && grep 2>/dev/null echo | |
+		local x=1 --verbose -eu sed x=1 local grep
+"$1" echo done readonly test 'quoted text' printf
+	x=1 export printf readonly $(pwd) export /usr/bin "$1"
+	echo grep 'quoted text' ${HOME} 2>/dev/null
+	cd x=1 sed "$@" "$@" test ${HOME} x=1 | cd x=1 echo | local grep x=1 --verbose
+	awk $(pwd) echo --verbose
+/usr/bin cd test x=1 export /usr/bin x=1 "$@" -eu test echo
+	--verbose cd cd ${HOME} grep
+	local --verbose printf printf then 2>/dev/null 'quoted text'
+	grep done x=1 -eu && ${HOME} done
+'quoted text' ${HOME} $(pwd) echo 2>/dev/null awk 2>/dev/null awk cd
+"$@" printf local local 2>/dev/null "$1" then "$1" ${HOME} sed done $(pwd) "$@"
+		&& | local echo && done test && awk --verbose "$@" "$1" export 'quoted text'
+		sed ${HOME} awk -eu 2>/dev/null ${HOME} readonly cd /usr/bin then x=1
+	| | cd local ${HOME} then local --verbose && 'quoted text' ${HOME} readonly
+${HOME} "$@" echo awk --verbose
+	echo "$@" "$1" ${HOME}
+	readonly --verbose $(pwd) printf awk | -eu echo ${HOME} | awk
+		&& export 'quoted text' cd local
+"$@" cd done awk sed test test sed readonly 'quoted text'
+		"$@" -eu "$1" printf done grep test
+| x=1 sed 'quoted text' cd "$1" test grep echo local /usr/bin readonly sed
+	$(pwd) then test 2>/dev/null local export
+		done /usr/bin echo grep export done local sed
+	"$@" "$1" && 'quoted text' done "$@" "$1" 2>/dev/null | --verbose
+		echo --verbose done local
+	grep | x=1 && --verbose -eu sed
+export "$@" grep ${HOME} --verbose /usr/bin -eu echo
+		test cd "$@" ${HOME} printf 2>/dev/null export
+readonly -eu $(pwd) export printf printf x=1 /usr/bin done x=1 done
+	--verbose cd cd 'quoted text' grep && export
+	local x=1 grep awk | awk readonly 2>/dev/null -eu done "$@" local $(pwd) then readonly
+	-eu /usr/bin --verbose x=1 /usr/bin -eu local
+		-eu $(pwd) 'quoted text' export readonly
+	"$1" --verbose x=1 export ${HOME} $(pwd) readonly
+--verbose --verbose --verbose ${HOME} readonly awk test cd echo
+		&& | then --verbose --verbose done ${HOME} x=1 printf x=1 /usr/bin
+| "$1" export printf test printf done cd awk && | sed 'quoted text'
@@ -0,0 +1,2001 @@
+grep 'quoted text' cd
+		readonly x=1 test && --verbose printf readonly export 2>/dev/null -eu --verbose
+		then 2>/dev/null awk --verbose $(pwd)
+		"$@" 2>/dev/null awk 'quoted text' export | readonly "$1"
+		-eu done readonly && && --verbose
+	"$1" then then echo ${HOME} local x=1 test
+&& 'quoted text' 2>/dev/null readonly $(pwd) | readonly ${HOME} $(pwd)
+	sed x=1 cd readonly x=1 awk cd x=1 --verbose readonly
+	&& done done local "$1" export test "$1" && grep
+/usr/bin | then sed "$@" readonly export echo 'quoted text'
+--verbose "$1" ${HOME} "$@" export
+	done "$@" 2>/dev/null --verbose
+		| printf /usr/bin "$1" printf awk --verbose -eu -eu /usr/bin | $(pwd) printf
+--verbose echo echo grep done "$@" | ${HOME} grep grep then "$1" ${HOME}
+		2>/dev/null printf then echo | awk test "$1" /usr/bin
+	printf -eu "$1" /usr/bin done
+		export ${HOME} | echo printf 2>/dev/null /usr/bin x=1 cd 'quoted text'
+		printf cd && cd then | /usr/bin
+	sed /usr/bin printf awk --verbose done awk && grep /usr/bin $(pwd) printf
+--verbose "$@" grep $(pwd)
+	cd "$1" test local && $(pwd) ${HOME} $(pwd) | local
+	cd grep | && cd echo echo test awk sed readonly readonly
+		awk awk test ${HOME} x=1 | export 2>/dev/null "$@"
+'quoted text' 2>/dev/null ${HOME} cd grep awk then ${HOME}
+$(pwd) ${HOME} -eu echo echo then 2>/dev/null -eu test printf
+		'quoted text' && --verbose awk 'quoted text' "$@" 2>/dev/null
+	local | printf sed -eu | readonly sed done
+then then readonly 2>/dev/null ${HOME}
+awk readonly printf | | local cd done ${HOME} readonly -eu
+	&& local $(pwd) 'quoted text'
+		echo awk export 2>/dev/null $(pwd) ${HOME} x=1 $(pwd) export -eu
+	--verbose x=1 && 2>/dev/null grep readonly ${HOME}
+	&& export && readonly grep --verbose && done
+	2>/dev/null /usr/bin export readonly && export echo cd printf
+		sed echo readonly && readonly && local sed 'quoted text'
+	echo && 2>/dev/null $(pwd) sed -eu -eu local local --verbose 'quoted text'
+	${HOME} 2>/dev/null awk readonly printf | grep x=1 /usr/bin
+	echo done local --verbose
+		cd ${HOME} awk echo --verbose "$1" local "$1" 'quoted text' local then
+		test ${HOME} test $(pwd) echo
+	export readonly 'quoted text'
+		local printf "$1" done "$1" ${HOME} "$@" "$1" export then export &&
+		printf printf 2>/dev/null local | done sed 'quoted text'
+	test "$1" local x=1 | then && "$@" local /usr/bin
+		awk "$@" | "$@" 'quoted text'
+local ${HOME} /usr/bin readonly x=1 then --verbose readonly
+		| ${HOME} export readonly grep cd echo 'quoted text' done awk | echo 2>/dev/null
+		then && | grep "$@" echo awk $(pwd) printf $(pwd) ${HOME} 2>/dev/null $(pwd) 'quoted text'
+export echo test ${HOME} then sed -eu cd -eu test grep cd printf then
+	"$@" 2>/dev/null echo echo then "$@" $(pwd) | x=1 -eu then 2>/dev/null "$@" test
+		echo | printf x=1 -eu readonly ${HOME} sed then printf --verbose "$1" test echo
+	"$@" -eu x=1 | /usr/bin 'quoted text' $(pwd) then grep grep
+	2>/dev/null --verbose /usr/bin "$@" test x=1 readonly export echo /usr/bin
+		cd 'quoted text' echo /usr/bin local
+		'quoted text' test | done export -eu local
+done printf --verbose readonly local && done
+local cd echo awk done -eu local awk then echo "$@" x=1 'quoted text'
+		test sed 'quoted text' --verbose "$@" readonly readonly
+		export -eu x=1 export then "$1" cd ${HOME} 'quoted text'
+	--verbose 2>/dev/null && | test /usr/bin $(pwd)
+	${HOME} grep export | test cd echo -eu -eu "$1" grep awk -eu --verbose
+		sed 2>/dev/null echo ${HOME}
+-eu --verbose awk test grep /usr/bin "$1" "$@" && printf
+		| ${HOME} test 2>/dev/null test 'quoted text'
+		x=1 grep readonly "$@" then 2>/dev/null export printf awk
+		2>/dev/null sed $(pwd) 'quoted text' printf readonly
+		-eu test readonly awk then -eu "$1" cd -eu ${HOME} --verbose
+awk ${HOME} done "$@" | $(pwd) "$@" echo sed "$@" 'quoted text' "$1" test "$1"
+		done then then done $(pwd) 'quoted text' /usr/bin 2>/dev/null ${HOME} printf echo
+	/usr/bin sed echo readonly export export --verbose then /usr/bin
+grep x=1 then --verbose | done local ${HOME} -eu $(pwd)
+		--verbose echo 'quoted text' local local
+		grep cd /usr/bin grep -eu | sed done done "$@" -eu cd -eu /usr/bin 'quoted text'
+		test /usr/bin -eu grep awk && cd x=1 grep -eu ${HOME} ${HOME} $(pwd)
+		"$1" done | local /usr/bin $(pwd) | printf test readonly
+	"$@" x=1 x=1 local -eu local test
+	done ${HOME} x=1 cd echo --verbose
+/usr/bin cd "$1" "$1" | && /usr/bin
+		&& printf "$@" && -eu export --verbose printf --verbose local cd printf readonly
+	x=1 ${HOME} "$@" | test done then $(pwd) readonly cd -eu then printf done "$1"
+	| /usr/bin --verbose "$1"
+	"$1" "$@" cd done done -eu -eu local grep $(pwd) ${HOME} 'quoted text'
+export awk | "$1" sed /usr/bin x=1 --verbose $(pwd) $(pwd) awk awk sed --verbose
+	awk export /usr/bin "$@" 2>/dev/null
+		echo ${HOME} then 2>/dev/null grep /usr/bin x=1 grep ${HOME} test
+	test "$@" test -eu "$1" 2>/dev/null cd
+	cd -eu ${HOME} "$1" --verbose | --verbose export
+-eu printf awk /usr/bin export ${HOME} --verbose /usr/bin 2>/dev/null awk printf
+--verbose local readonly awk -eu
+done /usr/bin x=1 grep 'quoted text' --verbose
+		x=1 awk 2>/dev/null /usr/bin $(pwd) test cd ${HOME} /usr/bin 2>/dev/null export
+		printf export export "$1"
+		"$1" x=1 cd | | cd --verbose local
+	'quoted text' | readonly
+		$(pwd) readonly readonly --verbose echo local sed $(pwd) x=1 cd test && ${HOME}
+		${HOME} 'quoted text' x=1 cd test
+		awk 2>/dev/null export
+		${HOME} sed "$1" x=1 /usr/bin echo ${HOME}
+x=1 'quoted text' then -eu ${HOME} test $(pwd) /usr/bin grep 'quoted text'
+	cd && then cd x=1 awk sed /usr/bin awk echo test --verbose done grep /usr/bin
+| echo printf -eu printf done echo | printf /usr/bin && && then -eu | /usr/bin
+		cd -eu /usr/bin echo x=1 awk &&
+		x=1 then cd "$@" done grep /usr/bin
+		printf sed | then echo local | "$@" readonly sed echo test | ${HOME}
+	test "$@" /usr/bin "$@" local "$@" local
+/usr/bin && sed $(pwd) cd "$@" -eu cd && sed cd 2>/dev/null "$1"
+		export -eu test test test then sed test local "$@"
+	local /usr/bin "$1" "$@" test echo local | ${HOME} -eu -eu printf local
+local ${HOME} test -eu printf -eu test export ${HOME} echo -eu 'quoted text'
+awk test export -eu | grep printf
+/usr/bin then export
+		2>/dev/null 'quoted text' && cd && && | $(pwd) -eu export 'quoted text' awk
+		"$@" "$@" 2>/dev/null 2>/dev/null 2>/dev/null $(pwd) "$1"
+	sed 2>/dev/null 'quoted text'
+&& $(pwd) x=1 cd | && export grep 2>/dev/null sed "$1" awk local $(pwd) readonly
+export "$@" test --verbose && 'quoted text' ${HOME} ${HOME}
+sed export grep awk 'quoted text' done 'quoted text' sed sed "$@" test | "$@" grep
+		sed test "$1" export test "$@" "$@" printf readonly
+	export grep "$1" awk done /usr/bin echo
+		| "$@" printf /usr/bin cd
+'quoted text' 'quoted text' cd
+| grep | sed printf readonly awk
+	test local export | x=1 "$@" sed
+x=1 local grep && "$1" $(pwd) printf test 2>/dev/null
+	| ${HOME} ${HOME} awk x=1 echo echo then --verbose /usr/bin
+| cd cd readonly "$@" grep printf test 'quoted text'
+		| "$@" | done then then then local sed echo readonly
+	local && x=1 x=1 2>/dev/null
+"$1" "$1" ${HOME} printf echo x=1 awk | cd then test grep x=1 ${HOME} 'quoted text'
+	printf grep 2>/dev/null done --verbose | "$1" ${HOME} --verbose "$1" "$@" 2>/dev/null
+"$@" local ${HOME} done "$1" done cd $(pwd)
+-eu && echo 'quoted text' "$@" $(pwd) x=1 "$@" --verbose sed export
+-eu done "$@" then echo then ${HOME}
+'quoted text' awk /usr/bin echo
+		"$1" echo && "$1" $(pwd) readonly 2>/dev/null readonly
+		echo printf test local 'quoted text' && readonly "$@" echo $(pwd) --verbose
+done test | export && "$@"
+	2>/dev/null "$1" && "$@" done export
+"$1" 'quoted text' x=1 "$@" awk 2>/dev/null $(pwd) grep -eu echo sed
+		-eu cd "$1" ${HOME} 'quoted text' ${HOME} |
+	export grep && /usr/bin x=1 /usr/bin local readonly local /usr/bin x=1 && done
+	local | grep "$1" cd then echo
+	"$@" "$1" | /usr/bin cd echo grep /usr/bin x=1 "$1" "$1" 'quoted text' cd &&
+	export readonly ${HOME} && -eu "$1" test x=1
+	"$@" /usr/bin x=1 printf sed | -eu -eu ${HOME} export then cd
+	${HOME} sed "$@" --verbose then printf then echo then
+done && echo local ${HOME} | test sed 'quoted text' "$@" x=1 $(pwd)
+	2>/dev/null then test awk
+"$1" printf 2>/dev/null "$@"
+		"$@" readonly --verbose awk grep readonly x=1 echo /usr/bin "$@" then sed test
+	grep awk $(pwd) | 2>/dev/null echo 'quoted text' then "$@" echo awk readonly
+	readonly printf test local -eu "$1" then "$1" | "$1" then
+cd done grep | /usr/bin x=1 local /usr/bin && done done echo $(pwd)
+	&& test printf 2>/dev/null cd local x=1
+| | grep -eu local x=1 2>/dev/null
+		"$@" local -eu $(pwd) awk
+	2>/dev/null -eu then
+"$1" printf 'quoted text'
+	| cd && test --verbose --verbose /usr/bin
+-eu awk echo x=1 export 'quoted text' readonly x=1 2>/dev/null "$@"
+x=1 --verbose ${HOME} --verbose printf then
+	printf && local printf cd -eu $(pwd) | "$1" && sed "$1"
+"$@" export cd awk ${HOME} awk | readonly | readonly $(pwd) cd done
+awk export readonly then $(pwd) echo
+awk 'quoted text' grep
+	"$@" cd readonly && readonly
+		-eu grep --verbose $(pwd)
+	test test ${HOME} test sed "$1" grep && done printf cd $(pwd) --verbose 2>/dev/null
+	awk grep cd | "$@" grep "$@"
+		cd | echo | 2>/dev/null readonly x=1 printf "$1" sed test "$1" "$@"
+x=1 sed && $(pwd) readonly readonly
+	done readonly ${HOME} 2>/dev/null
+--verbose grep local 'quoted text' local
+	sed --verbose 'quoted text'
+		readonly readonly --verbose "$1" ${HOME} grep "$@"
+2>/dev/null 'quoted text' "$1" then awk echo --verbose "$@" grep local echo
+		x=1 $(pwd) done printf && echo x=1 "$@" grep --verbose done awk
+sed x=1 readonly 2>/dev/null sed $(pwd) 'quoted text' echo
+'quoted text' --verbose cd awk "$@" $(pwd) 'quoted text'
+		| --verbose sed 'quoted text'
+		&& readonly $(pwd) 2>/dev/null echo printf | 'quoted text'
+	/usr/bin done | -eu "$@" test readonly readonly /usr/bin 'quoted text'
+"$@" printf ${HOME} awk | ${HOME} grep 'quoted text'
+	printf && 2>/dev/null 2>/dev/null x=1 done export /usr/bin $(pwd) | --verbose
+		printf echo -eu $(pwd) 2>/dev/null |
+		cd local x=1 export export $(pwd) grep x=1 "$1" cd echo then &&
+	x=1 && "$@" done "$1" 2>/dev/null ${HOME} ${HOME} local /usr/bin
+sed awk $(pwd) $(pwd) readonly cd local echo 2>/dev/null
+local export export | awk --verbose | && /usr/bin done 2>/dev/null 2>/dev/null
+	$(pwd) export cd | echo local /usr/bin
+	export grep test echo /usr/bin ${HOME} --verbose export x=1 sed
+		| "$@" /usr/bin awk echo done x=1 printf
+	test export ${HOME} "$1" awk then $(pwd) grep $(pwd) awk
+	x=1 cd echo printf echo | then 2>/dev/null export ${HOME} export
+		test readonly grep | export 'quoted text'
+2>/dev/null awk sed 'quoted text' test --verbose
+export $(pwd) --verbose "$1" ${HOME} readonly done local test $(pwd) ${HOME} done
+		done "$1" "$1" readonly -eu
+${HOME} export -eu -eu 'quoted text' --verbose
+		done "$1" | $(pwd) && cd local readonly
+		2>/dev/null echo /usr/bin "$1" ${HOME} readonly
+		local /usr/bin export cd done printf local -eu
+	sed local "$1" local /usr/bin "$@" -eu --verbose done readonly
+	export sed grep --verbose readonly test test echo echo 2>/dev/null x=1
+grep 2>/dev/null | | done test grep 'quoted text' && done readonly
+'quoted text' readonly export x=1 grep && $(pwd) x=1 /usr/bin then done cd
+	x=1 | --verbose readonly then echo "$1"
+	"$1" $(pwd) export $(pwd) local "$1" 2>/dev/null echo
+	${HOME} 'quoted text' printf "$1" awk local /usr/bin /usr/bin
+		$(pwd) -eu ${HOME} --verbose then sed /usr/bin
+		--verbose | | /usr/bin grep echo printf 'quoted text' awk readonly done export
+		sed ${HOME} done 'quoted text' -eu --verbose
+"$1" /usr/bin $(pwd) ${HOME} ${HOME} | readonly test export /usr/bin sed
+	awk $(pwd) sed cd export export x=1 done printf cd
+| ${HOME} /usr/bin --verbose "$1" readonly sed -eu printf
+		cd 'quoted text' && $(pwd) done cd grep /usr/bin -eu $(pwd) test && local echo
+/usr/bin grep | done 2>/dev/null |
+	--verbose done sed 'quoted text' echo ${HOME} sed readonly
+		"$1" && local grep | ${HOME} cd $(pwd) cd 2>/dev/null 2>/dev/null
+	test && grep | --verbose local "$1" echo readonly 'quoted text'
+"$@" then 2>/dev/null done --verbose
+test grep readonly && echo 2>/dev/null
+test "$1" grep ${HOME} ${HOME} done local
+		sed 2>/dev/null 'quoted text' -eu 'quoted text'
+		--verbose /usr/bin export &&
+	'quoted text' $(pwd) 2>/dev/null
+		"$@" ${HOME} test 2>/dev/null x=1
+	local test local sed done local ${HOME} /usr/bin $(pwd)
+${HOME} local sed x=1 'quoted text' echo echo --verbose |
+cd "$1" /usr/bin ${HOME}
+/usr/bin 'quoted text' | && x=1 export readonly
+	sed x=1 "$1" sed done -eu $(pwd) /usr/bin grep cd 'quoted text' /usr/bin --verbose
+	"$1" 'quoted text' 'quoted text' export
+-eu grep /usr/bin grep grep echo done printf "$@"
+'quoted text' /usr/bin then 'quoted text'
+then "$@" test "$@" "$@" --verbose then "$1" --verbose x=1 readonly
+	'quoted text' -eu "$@" 2>/dev/null | sed awk ${HOME} $(pwd) awk then
+		then && x=1 --verbose local -eu readonly printf
+	2>/dev/null 'quoted text' -eu 'quoted text' ${HOME} /usr/bin local && 'quoted text'
+		echo 'quoted text' grep "$1" | readonly awk awk /usr/bin
+2>/dev/null 'quoted text' "$@" -eu printf 2>/dev/null
+readonly export "$1" then test readonly awk $(pwd) sed cd then echo $(pwd)
+sed $(pwd) -eu $(pwd) $(pwd) --verbose -eu x=1 then cd sed
+x=1 grep export export awk grep local | | readonly /usr/bin ${HOME} ${HOME} 2>/dev/null
+		echo grep awk -eu cd --verbose done local grep grep printf cd
+		-eu echo sed echo grep x=1 done done cd $(pwd) && readonly
+awk awk test $(pwd) printf x=1 awk printf test "$1" "$1" && echo sed ${HOME}
+${HOME} export 2>/dev/null 2>/dev/null $(pwd) "$@" cd done --verbose "$1"
+sed /usr/bin ${HOME} sed test readonly ${HOME} sed -eu -eu done echo
+-eu 'quoted text' && echo
+readonly test --verbose --verbose cd "$@" $(pwd) echo x=1 $(pwd) /usr/bin
+printf readonly readonly x=1
+		echo grep && awk then "$1" local printf test "$1"
+		$(pwd) 2>/dev/null -eu sed echo
+		-eu 2>/dev/null /usr/bin awk cd readonly ${HOME} 2>/dev/null -eu done done
+/usr/bin then awk echo --verbose x=1 && local
+		&& echo printf test $(pwd) "$1" -eu 2>/dev/null test export /usr/bin
+		done "$@" export done local $(pwd) 2>/dev/null
+'quoted text' echo sed x=1 2>/dev/null local -eu local sed 'quoted text'
+	grep ${HOME} /usr/bin grep 'quoted text'
+	export | awk printf "$1" 2>/dev/null printf then ${HOME}
+cd /usr/bin printf && x=1 printf printf
+	grep done "$1" local export echo cd echo "$1" readonly done cd then ${HOME} ${HOME}
+		then sed ${HOME} ${HOME}
+grep | $(pwd) grep 'quoted text' local --verbose ${HOME} local local grep
+readonly echo 'quoted text' echo "$1"
+		test awk x=1 --verbose /usr/bin -eu x=1 echo test
+		--verbose --verbose readonly x=1 then export readonly test "$@" /usr/bin 2>/dev/null
+test "$1" sed 2>/dev/null /usr/bin | test echo local | cd readonly local
+printf printf "$@" -eu /usr/bin export echo "$1" export 2>/dev/null -eu
+		echo test export export printf export done "$1" && export printf /usr/bin
+	test 2>/dev/null printf readonly $(pwd) 'quoted text' --verbose 'quoted text' $(pwd)
+echo "$@" done -eu -eu $(pwd) then test 'quoted text' grep
+--verbose done cd awk
+	${HOME} | export "$1" --verbose "$@" -eu
+	2>/dev/null $(pwd) "$@" 2>/dev/null -eu
+	-eu 'quoted text' export awk x=1 x=1 test printf 'quoted text' -eu $(pwd) awk
+		$(pwd) awk 'quoted text' cd ${HOME} test "$@" local
+		sed sed echo /usr/bin "$@" cd | x=1 x=1 printf | done then x=1 "$1" && "$@"
+	&& cd 2>/dev/null "$1" local cd echo awk test "$@" -eu grep -eu grep "$1" 2>/dev/null
+	then then $(pwd) $(pwd) export
+		sed /usr/bin done then printf
+	printf awk $(pwd) grep 'quoted text' cd cd /usr/bin then cd 'quoted text'
+2>/dev/null printf printf export done local
+"$@" test 2>/dev/null -eu readonly test 2>/dev/null x=1 done && --verbose echo
+| && "$@" local echo && 2>/dev/null
+	local "$@" ${HOME} 2>/dev/null
+	${HOME} done done echo sed | /usr/bin ${HOME} $(pwd) -eu && done readonly $(pwd)
+		/usr/bin 2>/dev/null sed
+		then /usr/bin readonly sed echo sed && --verbose echo | ${HOME} test
+	--verbose echo "$1" printf | cd "$1" 2>/dev/null -eu test $(pwd) then echo
+	| printf grep x=1 "$@" awk then cd export
+"$@" x=1 done 2>/dev/null awk
+		x=1 /usr/bin awk 'quoted text' export done then test test /usr/bin local "$@"
+		cd echo echo && readonly then | 2>/dev/null echo x=1 "$1" grep x=1 | awk |
+	echo "$1" then local cd "$@" |
+	sed ${HOME} ${HOME} -eu | export "$@" $(pwd) grep echo export sed x=1 "$@"
+		cd readonly export "$1" readonly | 2>/dev/null test
+/usr/bin x=1 echo "$1" -eu -eu echo test -eu
+"$1" cd -eu 2>/dev/null done grep printf
+	local "$@" /usr/bin x=1 echo 2>/dev/null then grep 'quoted text' then local
+	$(pwd) 2>/dev/null sed 'quoted text' cd then export done echo export
+		sed done test 'quoted text' then printf
+cd /usr/bin && "$@" 2>/dev/null echo then readonly
+x=1 awk local "$@" printf grep $(pwd) readonly readonly cd
+		$(pwd) 'quoted text' sed --verbose x=1
+	$(pwd) awk 2>/dev/null sed /usr/bin sed /usr/bin readonly
+	local --verbose "$1" --verbose sed printf cd --verbose readonly x=1 then echo
+		| printf grep test && 'quoted text'
+		-eu then "$1" readonly printf "$1" 2>/dev/null cd then $(pwd) local -eu test /usr/bin
+grep grep -eu "$1" "$@" 'quoted text' 'quoted text'
+	'quoted text' x=1 "$1" $(pwd)
+		x=1 readonly /usr/bin 2>/dev/null 'quoted text' && /usr/bin | printf cd
+	--verbose -eu x=1 awk awk echo --verbose --verbose
+/usr/bin printf -eu /usr/bin /usr/bin
+	-eu local readonly printf "$@" readonly echo awk readonly /usr/bin && awk
+	--verbose 2>/dev/null grep cd printf -eu awk awk
+		then cd then echo x=1 $(pwd) grep export echo -eu then readonly printf
+		test $(pwd) printf ${HOME} x=1 test done readonly 'quoted text' ${HOME}
+awk grep --verbose readonly test && | /usr/bin then
+	printf 2>/dev/null $(pwd) -eu --verbose -eu && then sed --verbose
+		"$1" awk export ${HOME} test $(pwd)
+	--verbose "$1" /usr/bin local local echo $(pwd) -eu x=1
+		printf local 'quoted text' x=1 grep
+--verbose $(pwd) ${HOME} /usr/bin local then grep
+	"$1" local x=1 grep ${HOME} sed test then
+		'quoted text' done "$1" -eu |
+	then local ${HOME} local
+	awk readonly echo ${HOME} "$@" ${HOME} "$1" -eu
+	/usr/bin 2>/dev/null cd echo "$1" local && test 2>/dev/null local grep x=1 test
+		${HOME} /usr/bin done 'quoted text' x=1 x=1 export echo --verbose readonly
+	"$1" | | test local --verbose grep
+	--verbose awk done cd 2>/dev/null x=1 printf "$1" | grep readonly | grep
+grep "$1" ${HOME} grep 2>/dev/null
+	local && "$1" printf done export
+	"$1" then x=1 grep $(pwd) --verbose "$@" ${HOME} 2>/dev/null
+${HOME} | grep $(pwd) echo export then | && echo cd then "$1" -eu then x=1 readonly
+		local test cd printf "$1" then -eu local x=1 done
+local local then "$1" 'quoted text' cd export done /usr/bin
+'quoted text' -eu --verbose cd | test echo sed
+	then -eu | printf sed export ${HOME}
+		sed 2>/dev/null echo "$@" readonly "$@" x=1 |
+	cd printf "$@" "$@" printf 'quoted text'
+		test --verbose --verbose "$1" ${HOME} then done
+	grep /usr/bin echo export grep then printf $(pwd) then $(pwd) cd sed done
+		2>/dev/null done cd "$@" /usr/bin && ${HOME} | && test local done printf awk $(pwd)
+		then printf test done sed 'quoted text' cd grep 2>/dev/null -eu cd then
+		done cd cd -eu --verbose cd "$1" -eu "$1" && grep "$1" -eu ${HOME} "$1" ${HOME}
+readonly | $(pwd) $(pwd) sed "$@" export test 2>/dev/null awk "$@" done --verbose
+		'quoted text' cd ${HOME} cd cd | sed sed && -eu export "$@" /usr/bin readonly
+		--verbose test then local cd sed -eu cd readonly "$1" $(pwd) x=1
+	x=1 $(pwd) --verbose $(pwd) --verbose echo 'quoted text'
+then ${HOME} cd ${HOME} readonly grep 2>/dev/null
+		&& ${HOME} export awk printf 'quoted text' awk
+	grep 2>/dev/null 'quoted text' cd x=1 done then x=1 awk done --verbose
+/usr/bin | cd printf "$1" printf local
+	awk 2>/dev/null "$@" grep --verbose "$1" | $(pwd) 'quoted text' "$@" echo
+	readonly test --verbose grep
+		x=1 --verbose "$1" --verbose then grep then then local local
+		--verbose local printf printf grep && awk 2>/dev/null
+	$(pwd) 'quoted text' grep grep readonly /usr/bin 2>/dev/null | /usr/bin test
+'quoted text' done ${HOME} | printf x=1 2>/dev/null "$1" awk
+| done ${HOME} 'quoted text' ${HOME} 'quoted text' done "$@" x=1 done 2>/dev/null
+/usr/bin cd local 2>/dev/null 2>/dev/null x=1 ${HOME} export printf 'quoted text'
+		sed grep -eu 'quoted text' local 2>/dev/null && --verbose
+		${HOME} | grep printf cd
+$(pwd) -eu | | test test done
+readonly grep local 2>/dev/null 'quoted text' 'quoted text'
+local x=1 | local awk x=1 $(pwd) 'quoted text' ${HOME} printf then | grep $(pwd)
+awk readonly 'quoted text'
+		sed --verbose /usr/bin test done
+&& printf && && test "$1" echo test grep -eu sed cd echo
+	-eu export cd awk ${HOME} ${HOME} echo echo "$@" x=1 $(pwd) awk
+		${HOME} ${HOME} export 2>/dev/null local readonly then
+sed cd 2>/dev/null $(pwd) /usr/bin printf -eu sed "$@" readonly
+	x=1 test done --verbose printf then /usr/bin export printf && "$@" --verbose
+		local printf grep 2>/dev/null printf 2>/dev/null echo readonly $(pwd)
+		"$@" test grep readonly cd 'quoted text' printf test /usr/bin "$@"
+	printf printf "$1" $(pwd) "$@" -eu echo then grep 2>/dev/null
+	--verbose | /usr/bin | test cd then grep local && sed awk
+printf -eu awk "$1" local then "$1" awk && && "$@" "$@"
+-eu "$1" ${HOME} --verbose | sed
+		${HOME} test awk then test local sed local "$1" 'quoted text'
+"$@" test "$1" echo $(pwd) --verbose
+		x=1 sed test awk && x=1 --verbose readonly && /usr/bin
+		/usr/bin printf ${HOME} printf
+		awk --verbose 'quoted text'
+	test ${HOME} x=1 export "$1" cd && ${HOME} $(pwd) ${HOME}
+	grep "$1" then export sed sed && grep x=1 export 2>/dev/null 'quoted text'
+	cd 'quoted text' | 'quoted text' grep 2>/dev/null x=1 awk $(pwd) done
+		done then 'quoted text' 'quoted text' 'quoted text' awk done test x=1 local --verbose
+		awk then sed readonly && && -eu "$@" sed then local done -eu
+		export then "$@" readonly "$@" sed awk "$1" $(pwd) grep echo done printf sed cd
+		&& readonly readonly "$1" then "$@" awk echo --verbose echo -eu
+		done 'quoted text' readonly grep $(pwd)
+-eu awk printf sed readonly
+		"$@" local sed cd awk printf --verbose x=1
+		--verbose done cd 2>/dev/null readonly readonly then && cd /usr/bin grep "$@"
+	"$@" done printf done done 2>/dev/null sed -eu $(pwd) &&
+$(pwd) x=1 $(pwd) ${HOME} -eu --verbose readonly grep awk awk echo grep
+		test -eu grep echo grep -eu -eu test echo done then ${HOME}
+		&& "$1" 'quoted text' readonly readonly
+		/usr/bin -eu "$1" --verbose /usr/bin --verbose test "$@" $(pwd)
+		--verbose awk -eu then cd --verbose | sed printf ${HOME} local echo printf echo
+	cd grep 2>/dev/null then x=1 awk cd ${HOME} local -eu test 2>/dev/null "$1" test
+	local ${HOME} grep x=1 local -eu && ${HOME} test done echo
+$(pwd) awk readonly readonly x=1 "$1" 'quoted text' then
+	test 'quoted text' | grep /usr/bin "$1" grep printf readonly
+	&& local echo ${HOME} then /usr/bin
+		echo $(pwd) export "$@" --verbose x=1 "$1" x=1 /usr/bin printf x=1 test readonly
+	done 2>/dev/null awk test ${HOME}
+		--verbose printf | -eu done echo 'quoted text'
+-eu /usr/bin grep "$1" then "$1" "$@" test
+	grep grep awk --verbose 2>/dev/null
+		test done | local /usr/bin echo "$1" 'quoted text' sed
+	grep readonly "$1" ${HOME}
+	grep awk export | ${HOME} export --verbose /usr/bin x=1 'quoted text'
+		--verbose awk ${HOME} grep ${HOME} -eu --verbose test then test --verbose
+		x=1 cd printf 'quoted text' test ${HOME} readonly -eu
+	printf "$@" grep cd "$@" $(pwd) local cd grep 2>/dev/null /usr/bin
+2>/dev/null awk | done readonly
+2>/dev/null test --verbose $(pwd) cd done /usr/bin --verbose --verbose
+awk /usr/bin 2>/dev/null /usr/bin && x=1 && export cd sed then |
+	sed -eu echo "$@" "$@" /usr/bin "$@" && ${HOME}
+$(pwd) /usr/bin $(pwd) "$1" 'quoted text' awk x=1 --verbose cd echo
+grep awk readonly --verbose -eu local
+		grep sed | "$@" cd local cd "$@"
+	x=1 local /usr/bin readonly then $(pwd) --verbose local echo
+	"$@" -eu grep --verbose --verbose | grep
+		cd sed /usr/bin /usr/bin echo echo
+	"$1" test export cd echo then local && then $(pwd) test sed awk
+		--verbose "$1" awk $(pwd)
+2>/dev/null sed 'quoted text' printf test ${HOME} x=1 then sed done
+cd | sed | cd -eu echo export &&
+readonly /usr/bin awk 'quoted text' then printf
+	"$1" awk --verbose awk x=1 sed printf awk awk | test readonly
+	echo -eu echo $(pwd) | "$1"
+	awk x=1 grep printf local | | grep test test /usr/bin
+2>/dev/null grep done "$1"
+	done && -eu local local echo awk local readonly --verbose
+then $(pwd) echo printf | cd done "$1" -eu && |
+	-eu -eu printf 2>/dev/null printf $(pwd) | export local export done sed
+	| export /usr/bin 2>/dev/null && grep awk
+		--verbose 'quoted text' sed x=1 test
+export $(pwd) readonly
+		"$1" done awk /usr/bin awk then ${HOME} awk 'quoted text'
+	cd "$@" x=1 ${HOME} -eu cd grep $(pwd) | cd readonly
+--verbose "$@" | 2>/dev/null cd 2>/dev/null sed 'quoted text' | "$@"
+	-eu 2>/dev/null awk test printf
+	local | 2>/dev/null sed
+		done $(pwd) readonly 'quoted text' test cd
+	done ${HOME} "$1" cd $(pwd) export
+	$(pwd) local cd test
+	$(pwd) | -eu x=1 sed x=1 "$@" -eu export "$1" local ${HOME} export
+export 'quoted text' ${HOME}
+x=1 "$@" test then grep $(pwd)
+	printf 2>/dev/null x=1 'quoted text' test -eu && printf sed "$1" done readonly
+		${HOME} ${HOME} test done awk ${HOME} awk then test readonly /usr/bin
+x=1 'quoted text' 'quoted text' && /usr/bin --verbose && $(pwd) sed 2>/dev/null
+	done done 'quoted text' printf -eu test x=1 2>/dev/null
+		x=1 cd "$1" && /usr/bin readonly && local
+echo echo echo "$1" awk export
+		readonly 'quoted text' then 2>/dev/null readonly "$1" |
+		'quoted text' $(pwd) readonly $(pwd)
+-eu -eu "$1" export && then sed /usr/bin grep ${HOME} |
+		2>/dev/null -eu ${HOME} export echo
+x=1 export cd x=1 echo export printf
+printf printf done then "$@"
+	2>/dev/null x=1 -eu | ${HOME} && 'quoted text'
+		then $(pwd) /usr/bin "$1"
+	${HOME} export && --verbose ${HOME} x=1 printf awk sed
+		done | $(pwd) readonly && "$1" then -eu 'quoted text'
+${HOME} --verbose export echo "$1" 2>/dev/null ${HOME} sed then --verbose
+		--verbose /usr/bin -eu grep x=1 $(pwd) readonly echo
+/usr/bin grep then sed export 2>/dev/null 'quoted text' /usr/bin export sed |
+		grep -eu x=1 $(pwd) 2>/dev/null 'quoted text' 'quoted text'
+	export /usr/bin cd $(pwd) ${HOME} readonly cd test 'quoted text'
+		echo $(pwd) $(pwd) | | then && x=1 export
+	echo x=1 test sed 2>/dev/null awk /usr/bin ${HOME} echo --verbose grep readonly
+		"$@" --verbose 'quoted text' 2>/dev/null && awk 2>/dev/null /usr/bin cd ${HOME}
+		grep "$@" then awk sed grep sed readonly cd $(pwd) "$1" ${HOME} "$@"
+		2>/dev/null then && /usr/bin then | "$@" | | awk 'quoted text'
+	export $(pwd) x=1 /usr/bin local | "$@"
+--verbose test ${HOME} --verbose 'quoted text' ${HOME}
+	printf cd done cd cd readonly awk "$@" ${HOME}
+	cd printf export "$@" x=1 "$1" local echo sed done && 'quoted text'
+	/usr/bin grep && 'quoted text' /usr/bin
+		/usr/bin $(pwd) $(pwd) export $(pwd) awk echo $(pwd) ${HOME} -eu "$@" local
+| && then && echo cd sed
+	$(pwd) test test then export export local "$1" sed
+	test 'quoted text' "$1" grep grep -eu ${HOME}
+	2>/dev/null echo /usr/bin | export test $(pwd) cd export | --verbose
+	printf export --verbose 'quoted text' echo -eu && && awk
+grep grep -eu ${HOME} then | local cd cd cd 'quoted text' /usr/bin
+$(pwd) readonly done done printf "$1" -eu && ${HOME}
+		test /usr/bin export --verbose "$@" then && cd then $(pwd) --verbose "$@" readonly
+	grep /usr/bin test sed | --verbose -eu export awk test x=1 /usr/bin
+"$@" awk /usr/bin export "$1" ${HOME} test done done /usr/bin export sed --verbose
+		$(pwd) awk readonly -eu export x=1 --verbose | cd
+echo "$1" 2>/dev/null "$@" --verbose ${HOME}
+	-eu sed 2>/dev/null ${HOME} 2>/dev/null
+${HOME} test 'quoted text' awk done printf --verbose && 2>/dev/null readonly
+	sed cd "$@" "$1" awk readonly --verbose $(pwd)
+		"$@" -eu "$1" | --verbose 2>/dev/null ${HOME} done grep -eu printf
+		${HOME} "$1" echo && --verbose 'quoted text' && 2>/dev/null && 2>/dev/null done
+	done test $(pwd) printf sed --verbose ${HOME} test cd --verbose
+	then awk readonly printf done awk export grep ${HOME} -eu 'quoted text'
+		&& export 2>/dev/null -eu
+${HOME} 2>/dev/null cd sed done readonly "$1" | local echo cd grep awk ${HOME}
+cd | grep 'quoted text' grep && $(pwd) /usr/bin sed awk export local
+		done -eu test sed --verbose
+| echo && /usr/bin $(pwd)
+	$(pwd) awk 2>/dev/null "$1" then --verbose && cd printf -eu awk x=1 'quoted text'
+	&& x=1 echo printf --verbose /usr/bin then readonly
+then x=1 "$1" "$1" test local && cd done
+	cd "$@" "$1" echo test 2>/dev/null
+printf test done --verbose then && echo -eu test /usr/bin 2>/dev/null
+		| cd -eu ${HOME} x=1 printf /usr/bin printf 'quoted text'
+		&& x=1 test x=1 -eu printf | export export
+	"$@" cd ${HOME} echo 'quoted text' done x=1 readonly /usr/bin | "$@" $(pwd)
+--verbose test readonly "$@" /usr/bin done 'quoted text' &&
+done x=1 'quoted text' /usr/bin awk 2>/dev/null ${HOME}
+		grep $(pwd) local 'quoted text' -eu 2>/dev/null |
+${HOME} printf x=1 "$1"
+		"$@" done done --verbose && && export
+		readonly /usr/bin sed --verbose
+	2>/dev/null --verbose done && /usr/bin local echo /usr/bin "$1"
+	echo export "$@" awk awk 'quoted text' --verbose
+	2>/dev/null ${HOME} then /usr/bin 2>/dev/null /usr/bin --verbose done /usr/bin
+	sed "$1" && "$@" readonly readonly readonly "$@"
+	"$@" 2>/dev/null printf readonly ${HOME}
+		/usr/bin | x=1 $(pwd) local ${HOME}
+x=1 readonly awk local printf grep sed local /usr/bin test
+/usr/bin $(pwd) then grep 2>/dev/null grep sed "$@" then $(pwd)
+		cd cd done echo x=1 grep --verbose printf done export done --verbose then
+		/usr/bin sed sed $(pwd)
+	test grep x=1 sed printf printf -eu echo ${HOME} && local 'quoted text' then
+	export export -eu awk sed /usr/bin
+	grep x=1 grep test printf "$1" local sed /usr/bin
+	/usr/bin ${HOME} 'quoted text' test local /usr/bin
+		export "$1" local sed | 2>/dev/null -eu
+	grep "$@" | && export awk
+		readonly --verbose "$@" x=1 grep | readonly grep && export 2>/dev/null
+	export readonly && test
+		&& test awk 2>/dev/null -eu | cd
+	$(pwd) readonly sed "$@" export
+-eu "$@" grep done then test sed 'quoted text' export
+		grep 'quoted text' sed /usr/bin --verbose | done local echo test cd ${HOME}
+"$@" && /usr/bin && "$@" --verbose "$@" /usr/bin sed x=1 "$1"
+local readonly readonly $(pwd)
+x=1 && then then readonly readonly done
+	| local local x=1 "$1" 'quoted text' then -eu cd readonly -eu printf
+	2>/dev/null sed echo local sed cd /usr/bin | readonly "$1" cd && && 'quoted text'
+	2>/dev/null /usr/bin awk awk awk x=1 echo 2>/dev/null 2>/dev/null
+	grep /usr/bin sed local ${HOME} sed printf 'quoted text' | readonly
+local echo done echo grep local 2>/dev/null | && sed cd && && grep
+		cd local done export grep ${HOME} --verbose sed | "$1" test
+		sed done echo x=1 sed $(pwd) grep test readonly -eu
+	-eu export ${HOME} &&
+		$(pwd) printf $(pwd) cd "$1" then | local x=1
+-eu done x=1 printf printf then ${HOME} ${HOME} 'quoted text'
+		--verbose $(pwd) awk && done 'quoted text' local export ${HOME}
+	$(pwd) echo cd --verbose cd ${HOME} $(pwd)
+-eu echo sed readonly awk "$1" echo sed | 2>/dev/null local export x=1 done
+	'quoted text' ${HOME} echo sed then "$@"
+	echo awk 'quoted text' export echo grep done awk
+		${HOME} printf && export x=1 $(pwd) done "$@" /usr/bin x=1 $(pwd) readonly
+		'quoted text' x=1 ${HOME} 2>/dev/null
+awk done done sed local /usr/bin sed done sed grep 2>/dev/null
+		'quoted text' 'quoted text' -eu done sed x=1 2>/dev/null done "$1"
+		--verbose | echo sed /usr/bin && | 'quoted text' export test
+$(pwd) grep -eu 'quoted text' local /usr/bin $(pwd) x=1 $(pwd)
+		done done ${HOME} then local "$1" sed --verbose 2>/dev/null local done export -eu
+		x=1 -eu "$@" sed grep printf "$1" done awk then grep done sed ${HOME}
+		grep echo $(pwd) ${HOME} "$@" &&
+$(pwd) readonly --verbose ${HOME} 'quoted text'
+printf test -eu | $(pwd) "$1" grep
+		&& readonly then $(pwd) grep
+	export readonly echo printf sed /usr/bin -eu local
+	printf --verbose sed printf /usr/bin x=1 test sed "$@" echo x=1
+	x=1 readonly sed export x=1
+	/usr/bin "$@" grep x=1 cd done
+		$(pwd) echo 'quoted text' awk && grep --verbose echo local
+	x=1 "$1" grep grep printf $(pwd) awk x=1 sed --verbose
+		export 2>/dev/null 'quoted text' awk
+		--verbose sed test ${HOME} ${HOME} $(pwd) printf
+	export && then 2>/dev/null sed printf | ${HOME} --verbose awk
+	x=1 done --verbose readonly
+	test --verbose sed test $(pwd) 2>/dev/null --verbose -eu -eu "$1"
+		cd test then printf ${HOME}
+		local readonly ${HOME} then grep printf echo local x=1 echo grep -eu 'quoted text'
+2>/dev/null $(pwd) local grep printf sed cd local
+awk x=1 $(pwd) cd -eu 'quoted text'
+	"$1" local cd x=1 && readonly readonly && readonly export "$@" grep --verbose sed
+		/usr/bin "$1" then printf "$1" then
+		/usr/bin done 'quoted text' sed
+		cd sed $(pwd) 2>/dev/null -eu test awk readonly done readonly ${HOME}
+--verbose "$@" local 2>/dev/null test printf
+		done && --verbose done local export x=1
+	'quoted text' "$@" x=1 printf export printf then sed then && printf
+		test 'quoted text' "$1" x=1 -eu -eu 2>/dev/null 'quoted text'
+local test then awk ${HOME} export cd "$@" "$@" local
+		&& test 2>/dev/null printf 'quoted text' "$@"
+'quoted text' readonly 2>/dev/null && x=1
+then done $(pwd) then x=1 grep "$1" 'quoted text'
+	test $(pwd) sed $(pwd) -eu cd
+cd -eu cd echo sed local export test then printf printf
+	--verbose /usr/bin x=1 | $(pwd) printf
+&& ${HOME} export "$1" "$1" "$1" printf -eu awk -eu awk
+		sed sed 'quoted text' $(pwd)
+		${HOME} 'quoted text' x=1 /usr/bin
+grep "$1" -eu sed "$@" awk x=1 then "$@" && --verbose echo
+$(pwd) done /usr/bin readonly
+--verbose 'quoted text' /usr/bin cd | 'quoted text'
+done then x=1 'quoted text' echo test ${HOME} ${HOME} cd grep 'quoted text'
+		test echo cd | /usr/bin export | done echo printf
+'quoted text' sed local
+		test export --verbose printf test awk grep echo "$1"
+		grep --verbose local cd sed
+	sed done && -eu 2>/dev/null --verbose readonly local 'quoted text' test export
+		/usr/bin $(pwd) x=1 export && && echo /usr/bin x=1 --verbose
+$(pwd) --verbose awk --verbose cd --verbose echo sed local
+	${HOME} grep $(pwd) export local done then printf local done local &&
+		--verbose echo 'quoted text' "$@"
+	done && $(pwd) $(pwd) $(pwd) $(pwd) "$1" export x=1 echo -eu 'quoted text'
+	&& && readonly sed | /usr/bin grep x=1 printf echo ${HOME}
+		cd done printf export $(pwd) then --verbose "$1" echo /usr/bin "$@" printf
+		cd | | then ${HOME} | -eu /usr/bin
+	"$1" readonly local x=1 x=1 sed
+	| && awk --verbose readonly done x=1 then -eu --verbose sed -eu "$1" local export
+		--verbose test then export ${HOME} export -eu ${HOME} printf sed grep then 2>/dev/null
+cd -eu && sed | "$@" ${HOME}
+2>/dev/null x=1 "$@" grep sed sed cd echo printf export | /usr/bin $(pwd)
+		cd done 2>/dev/null /usr/bin -eu --verbose cd export "$@" "$@" "$1"
+		"$@" cd && printf x=1 then printf "$@" grep local $(pwd)
+		cd then && && grep readonly printf
+	${HOME} $(pwd) then "$1" $(pwd) /usr/bin readonly local readonly
+grep 'quoted text' x=1 grep local 2>/dev/null
+		sed export echo | sed export export $(pwd) 2>/dev/null
+printf && 'quoted text' ${HOME} 'quoted text' cd
+cd ${HOME} x=1 | | | "$1" "$1" | && 2>/dev/null --verbose export export $(pwd) -eu
+	export local echo --verbose -eu export "$1"
+		echo export --verbose done "$1" awk export 2>/dev/null test
+		test printf 2>/dev/null local "$@" | | -eu && local $(pwd) printf
+test /usr/bin ${HOME} $(pwd) --verbose printf cd x=1
+		-eu x=1 2>/dev/null printf 2>/dev/null awk ${HOME} awk export awk
+	test awk grep done export sed x=1 local "$1" printf 'quoted text' sed test
+	--verbose 'quoted text' grep "$1" --verbose
+2>/dev/null awk sed "$1"
+"$@" done printf then awk | 2>/dev/null test 2>/dev/null --verbose echo /usr/bin
+readonly readonly 'quoted text' sed && | "$1" echo local export | "$1"
+-eu readonly then "$@" readonly
+	/usr/bin cd "$@" then test --verbose
+		sed $(pwd) local 'quoted text' grep $(pwd)
+		done cd "$@" export 2>/dev/null
+	2>/dev/null /usr/bin "$1" test
+		sed x=1 printf && awk x=1 export ${HOME} readonly /usr/bin "$1" readonly readonly
+${HOME} $(pwd) | printf $(pwd) --verbose "$@" 2>/dev/null
+		$(pwd) --verbose x=1 "$@" "$1" ${HOME} done 2>/dev/null test readonly
+		--verbose export && sed echo
+		x=1 then test 2>/dev/null grep x=1 'quoted text' awk echo 'quoted text' readonly
+	done export done ${HOME} $(pwd) $(pwd) readonly test
+		"$1" "$1" awk $(pwd) x=1 grep test sed "$@" /usr/bin
+	awk x=1 2>/dev/null --verbose --verbose x=1 done "$@" local
+	sed && --verbose | then
+then readonly 'quoted text' done $(pwd) awk
+	"$1" $(pwd) x=1 | && &&
+| local x=1 && $(pwd) export test awk $(pwd) | | grep
+	2>/dev/null 'quoted text' --verbose echo cd local "$1" readonly /usr/bin
+	-eu printf sed local --verbose
+"$@" echo && echo && printf
+done --verbose echo x=1 readonly local
+		${HOME} local export echo
+readonly then 'quoted text'
+		"$@" "$1" --verbose 2>/dev/null then 'quoted text' echo local
+		export 2>/dev/null /usr/bin awk then 2>/dev/null grep grep /usr/bin printf
+'quoted text' "$1" cd ${HOME} | sed
+awk 2>/dev/null $(pwd) -eu 'quoted text' cd $(pwd)
+grep /usr/bin local done -eu | grep sed -eu sed "$@" cd x=1 ${HOME} --verbose
+/usr/bin 2>/dev/null readonly export cd local test 2>/dev/null test export "$@"
+		readonly export test readonly
+		grep readonly "$@" --verbose /usr/bin $(pwd) readonly "$1" --verbose
+cd readonly "$@" "$@" done export grep local | "$@" /usr/bin "$1" readonly cd done
+test grep --verbose && sed 'quoted text' 'quoted text' export
+x=1 x=1 | | printf echo echo ${HOME} printf then | /usr/bin readonly grep
+	done -eu echo printf awk -eu grep awk grep $(pwd) local "$1" $(pwd) $(pwd)
+		x=1 $(pwd) -eu then local
+printf grep "$1" x=1 -eu echo readonly
+	local 2>/dev/null echo sed done x=1 done echo test then local echo awk done awk
+	test "$1" /usr/bin ${HOME} | | sed | awk echo then $(pwd) grep
+		&& && echo awk 2>/dev/null done test x=1 /usr/bin && then --verbose local
+printf readonly -eu done "$1" printf 2>/dev/null grep test $(pwd)
+		-eu | awk local grep grep "$@" && 2>/dev/null grep awk && ${HOME} | "$1"
+		readonly echo --verbose 2>/dev/null grep
+-eu awk awk "$1" --verbose local x=1
+"$1" | done echo | echo then
+	sed done then x=1 "$@" echo printf done printf
+	echo export grep export grep
+		"$@" | "$@" awk local ${HOME} printf then | ${HOME} | readonly
+'quoted text' x=1 cd $(pwd) readonly 'quoted text' 2>/dev/null
+		export 2>/dev/null sed then sed | done
+	${HOME} done /usr/bin $(pwd) "$1" cd -eu cd cd then printf cd |
+	readonly printf 'quoted text' then "$1" done $(pwd) && ${HOME} sed 2>/dev/null
+then local cd | ${HOME} $(pwd) ${HOME} $(pwd)
+printf printf && --verbose cd 2>/dev/null echo x=1 ${HOME}
+		export printf test -eu x=1 "$1" grep local local echo --verbose export local "$1"
+		$(pwd) sed && "$@" cd then grep &&
+		--verbose awk x=1 | readonly -eu grep | done grep grep
+	cd 'quoted text' x=1 -eu export sed grep local 'quoted text'
+	"$1" readonly cd ${HOME} printf then echo -eu sed test "$@"
+-eu then grep then 2>/dev/null && 'quoted text'
+	$(pwd) $(pwd) printf 'quoted text' grep | --verbose
+		done "$1" | cd cd 2>/dev/null
+then printf readonly grep $(pwd) ${HOME} $(pwd) export x=1
+	2>/dev/null cd 2>/dev/null --verbose && readonly "$1" && readonly
+	| then cd readonly 2>/dev/null -eu -eu "$1" cd ${HOME}
+	"$@" local readonly echo --verbose "$1" 2>/dev/null readonly export awk echo
+export test done | echo /usr/bin 2>/dev/null awk readonly | awk readonly 'quoted text'
+&& export --verbose x=1 done then "$@" awk --verbose local cd
+local awk grep cd awk readonly echo --verbose
+		printf export "$1" sed --verbose sed readonly $(pwd) /usr/bin && | "$@"
+	&& sed ${HOME} x=1 echo echo
+		awk --verbose test printf test
+	then x=1 printf awk export cd "$1" && ${HOME} | export --verbose /usr/bin
+	done cd awk "$1" local 'quoted text'
+		${HOME} 'quoted text' export | --verbose
+	/usr/bin "$1" done printf export /usr/bin cd && grep
+		"$1" ${HOME} 'quoted text' cd readonly
+		--verbose export export
+		$(pwd) | then grep ${HOME}
+	--verbose 'quoted text' cd ${HOME} 'quoted text' local
+local "$1" readonly --verbose
+		-eu readonly "$@" printf 2>/dev/null echo awk x=1 done | done
+	echo "$1" printf | $(pwd) x=1
+cd grep 2>/dev/null echo test 2>/dev/null ${HOME} then
+		awk readonly /usr/bin /usr/bin $(pwd)
+		local "$@" "$@" printf $(pwd) readonly local --verbose x=1 "$1" awk "$1"
+		cd export | 'quoted text'
+		test echo ${HOME} 'quoted text' cd local cd 2>/dev/null cd | -eu 2>/dev/null
+		/usr/bin && export 'quoted text' --verbose
+grep -eu then then printf
+$(pwd) cd sed cd $(pwd) cd
+${HOME} cd 'quoted text'
+-eu done && local && --verbose echo readonly local done sed "$1" then -eu
+		awk $(pwd) grep sed done 2>/dev/null
+awk local cd readonly --verbose ${HOME} awk 'quoted text' cd
+grep $(pwd) test 'quoted text'
+	echo awk echo "$1" test test
+	"$1" 2>/dev/null awk awk "$1" cd echo readonly
+	printf awk awk --verbose --verbose
+		local "$1" $(pwd) local 2>/dev/null sed echo sed --verbose done "$1" readonly
+	${HOME} /usr/bin 'quoted text' awk cd sed x=1 2>/dev/null test then awk cd sed |
+	| cd 'quoted text' echo then "$1"
+x=1 'quoted text' local test 'quoted text' /usr/bin sed export $(pwd) 2>/dev/null
+	then 'quoted text' cd --verbose "$1" grep | 2>/dev/null 2>/dev/null "$1" 'quoted text'
+done echo 'quoted text' /usr/bin ${HOME} sed test export awk
+		export "$1" | ${HOME} -eu test cd local done |
+	sed 'quoted text' sed awk cd export
+		sed "$@" test export 2>/dev/null $(pwd) -eu | printf --verbose "$@" local --verbose
+	"$1" grep 2>/dev/null "$@" grep echo 'quoted text' sed printf local
+		sed "$@" test $(pwd) 2>/dev/null && sed cd sed readonly "$@" test $(pwd)
+--verbose awk echo cd test ${HOME} -eu --verbose $(pwd) 'quoted text' export
+		| --verbose 'quoted text' -eu cd 'quoted text' "$@" cd sed 2>/dev/null local done
+		test awk | /usr/bin sed awk "$1" "$@"
+		grep | done grep test then ${HOME}
+grep /usr/bin export -eu $(pwd) then "$1" -eu test echo x=1 | $(pwd) done
+	local sed --verbose "$1" "$1" x=1 /usr/bin $(pwd)
+	&& readonly export grep ${HOME} local sed cd 2>/dev/null 2>/dev/null local cd
+	test x=1 echo $(pwd) ${HOME} readonly sed /usr/bin --verbose grep x=1 'quoted text'
+	${HOME} --verbose cd done "$1" -eu ${HOME}
+2>/dev/null test awk readonly cd cd ${HOME} && | test then printf then 'quoted text'
+	local /usr/bin /usr/bin && then
+		${HOME} && "$1" /usr/bin done -eu x=1 -eu
+	--verbose -eu "$@" cd awk "$@" awk echo awk 2>/dev/null x=1 sed && then done
+		local sed printf -eu printf && grep ${HOME} awk && local -eu export
+	&& | printf local then $(pwd) done printf printf $(pwd) 'quoted text'
+"$@" cd ${HOME} echo local /usr/bin | $(pwd) "$@" readonly && cd && readonly then
+		$(pwd) cd "$@" test readonly /usr/bin readonly 'quoted text' 'quoted text'
+		&& awk --verbose x=1 then awk test "$@"
+		test test awk grep done --verbose --verbose --verbose
+	grep cd && test local "$@" awk 'quoted text' ${HOME} then
+	sed $(pwd) export "$@" /usr/bin 2>/dev/null --verbose
+export | sed "$@" printf done then
+	done 'quoted text' echo -eu test && printf /usr/bin
+"$@" "$@" then done grep 'quoted text' readonly --verbose ${HOME} 2>/dev/null echo
+export awk echo awk sed test | cd
+		awk -eu done x=1 sed | export x=1 && /usr/bin sed local 'quoted text'
+		export export ${HOME} local 2>/dev/null --verbose local
+		test export echo 2>/dev/null --verbose --verbose ${HOME} $(pwd) --verbose done
+| $(pwd) grep && ${HOME} sed ${HOME} test local --verbose
+		local test "$1" 2>/dev/null
+	cd x=1 x=1 ${HOME} cd echo 2>/dev/null done awk echo 2>/dev/null local |
+	&& done 'quoted text' "$1" -eu $(pwd) awk 'quoted text'
+	/usr/bin awk grep awk 2>/dev/null x=1 "$1" /usr/bin
+	"$@" sed readonly local && printf then awk $(pwd)
+		$(pwd) "$@" --verbose "$@" "$1" awk sed readonly local readonly
+${HOME} ${HOME} ${HOME} "$@" /usr/bin $(pwd) awk test printf local done readonly
+	/usr/bin echo printf cd sed -eu
+	'quoted text' sed | 2>/dev/null
+printf 'quoted text' $(pwd) readonly done
+		readonly cd printf -eu local | 2>/dev/null cd done $(pwd)
+	awk awk done awk "$@" | -eu echo 'quoted text'
+| /usr/bin then grep export "$1" test && printf
+	--verbose "$1" export printf done grep awk test && awk
+'quoted text' | then readonly --verbose export -eu echo x=1 ${HOME} printf
+	test && export "$@" 'quoted text' 2>/dev/null "$@" && -eu | sed readonly sed
+2>/dev/null /usr/bin then ${HOME} "$@"
+	awk echo export $(pwd) export local --verbose cd "$@" readonly 'quoted text' "$@"
+"$1" test grep printf printf readonly grep cd | 'quoted text' cd x=1 $(pwd) echo
+	then ${HOME} printf $(pwd)
+then cd sed | cd --verbose
+awk readonly "$@" printf 'quoted text' echo readonly
+x=1 && test test test
+echo 2>/dev/null then 'quoted text' --verbose local ${HOME} && awk done cd "$@"
+		cd ${HOME} "$1" sed 'quoted text' 'quoted text' 'quoted text'
+grep /usr/bin test && readonly export printf grep readonly
+	done printf export x=1 --verbose export ${HOME} 2>/dev/null echo then
+then echo --verbose export -eu awk 'quoted text' 2>/dev/null
+	grep ${HOME} 2>/dev/null 2>/dev/null printf ${HOME} 'quoted text' $(pwd) cd
+	"$1" awk $(pwd) sed printf cd sed echo readonly test
+echo 2>/dev/null done $(pwd) --verbose 2>/dev/null /usr/bin then $(pwd) &&
+		"$@" 'quoted text' --verbose
+test test "$1" 2>/dev/null | awk awk local --verbose
+printf "$@" && ${HOME} grep | && -eu sed
+	export export readonly
+grep && x=1 "$1" --verbose | 2>/dev/null echo 2>/dev/null /usr/bin
+	${HOME} grep $(pwd) $(pwd) printf | awk "$1"
+		&& "$1" | awk done 2>/dev/null
+then -eu x=1 sed $(pwd) readonly
+	"$@" "$@" 'quoted text' /usr/bin sed "$@" -eu done 2>/dev/null local
+then /usr/bin | export
+		${HOME} echo && grep --verbose awk /usr/bin echo
+	echo && "$1" --verbose export -eu awk readonly readonly local && cd x=1 --verbose
+	sed echo then $(pwd) echo ${HOME} then done sed echo "$1" 2>/dev/null
+		2>/dev/null "$@" readonly export 'quoted text' cd --verbose
+"$1" 'quoted text' test local printf sed cd export /usr/bin
+		"$@" -eu cd 2>/dev/null echo --verbose test "$1" "$1"
+		$(pwd) awk /usr/bin then -eu local then "$@" export $(pwd) /usr/bin readonly
+	test ${HOME} echo printf | awk local
+	x=1 "$1" test 2>/dev/null
+sed "$@" test test grep --verbose cd && sed --verbose
+		x=1 local echo echo "$@" awk local local -eu 'quoted text'
+grep $(pwd) | --verbose ${HOME} local "$@"
+	/usr/bin ${HOME} local "$1" ${HOME}
+	$(pwd) awk /usr/bin test | 2>/dev/null local readonly
+		$(pwd) echo && then && | then /usr/bin
+	-eu "$@" readonly ${HOME} && 'quoted text' printf -eu
+	sed local awk test readonly test readonly cd cd export export test 'quoted text'
+		&& local readonly sed printf
+	cd ${HOME} /usr/bin "$1" done
+	${HOME} $(pwd) --verbose cd readonly
+x=1 echo cd local | ${HOME} echo 'quoted text'
+"$1" ${HOME} --verbose 2>/dev/null "$@" test done 'quoted text'
+printf ${HOME} && test
+		awk export readonly | "$@" test printf local echo then local printf done
+	readonly cd readonly -eu done
+		readonly /usr/bin "$@" && 2>/dev/null "$1" export cd readonly local local 'quoted text'
+2>/dev/null cd x=1 "$1" done readonly x=1 && && "$@" echo x=1 export 'quoted text'
+	&& echo awk 2>/dev/null test sed local export $(pwd) | "$1"
+echo $(pwd) printf /usr/bin echo "$@" echo printf sed printf done echo
+"$@" x=1 cd /usr/bin && then -eu x=1 cd printf
+echo then printf -eu --verbose grep
+		| printf cd awk echo && awk && sed -eu done --verbose
+| grep cd grep -eu x=1 printf "$1" x=1 "$1"
+grep cd | /usr/bin -eu $(pwd) local /usr/bin "$1" cd sed
+grep cd && $(pwd) awk x=1 -eu cd -eu local awk printf
+		"$@" /usr/bin printf -eu "$@" sed x=1 'quoted text' local then grep && | $(pwd)
+		export ${HOME} test && /usr/bin "$1"
+	x=1 echo done readonly grep x=1 /usr/bin --verbose -eu "$1" echo test done readonly
+echo "$@" test export local --verbose
+	echo /usr/bin --verbose cd | -eu awk $(pwd) -eu cd && x=1 |
+awk done ${HOME} then 'quoted text' "$@" "$1" -eu printf printf 'quoted text'
+local -eu && done test "$@" /usr/bin
+		/usr/bin "$@" local "$@" -eu test x=1 printf
+test readonly ${HOME} then x=1 x=1 x=1 grep then then
+	--verbose | export printf cd x=1 x=1 $(pwd) /usr/bin && && && ${HOME}
+	cd $(pwd) local grep --verbose echo 2>/dev/null --verbose /usr/bin
+sed grep grep echo done ${HOME} cd then
+		'quoted text' done printf /usr/bin 'quoted text' then 2>/dev/null | printf
+printf /usr/bin "$@" 'quoted text' sed x=1 grep local test echo /usr/bin
+cd /usr/bin | test test $(pwd) then 2>/dev/null test && grep local
+| cd done --verbose grep echo readonly /usr/bin
+		then readonly done done awk x=1 'quoted text' then ${HOME} ${HOME} local
+	sed printf $(pwd) readonly /usr/bin local 2>/dev/null x=1 cd then 2>/dev/null
+	"$@" -eu $(pwd) test export test -eu "$@" cd --verbose echo local 'quoted text'
+sed awk local 'quoted text'
+		2>/dev/null ${HOME} export done | done -eu
+		${HOME} && echo echo sed awk readonly test
+	printf ${HOME} 2>/dev/null printf
+	local test "$@" awk export x=1 "$@" echo readonly
+		-eu x=1 local awk then done
+		sed && echo readonly --verbose | | 2>/dev/null readonly
+awk done readonly $(pwd) cd
+awk -eu /usr/bin grep sed ${HOME} --verbose
+		printf test sed "$@" echo $(pwd) echo sed --verbose
+		x=1 --verbose sed test --verbose done "$1"
+	export && then readonly local awk --verbose
+| local ${HOME} printf echo /usr/bin printf
+		x=1 test printf sed export printf printf /usr/bin -eu test
+		&& "$1" awk test $(pwd) grep readonly grep
+printf $(pwd) -eu then $(pwd) grep then readonly | echo test cd cd then -eu $(pwd)
+2>/dev/null 'quoted text' 2>/dev/null local
+	done then local grep sed printf printf
+grep --verbose /usr/bin cd printf "$1" grep awk "$1" 'quoted text' grep cd
+		awk -eu echo then 2>/dev/null echo awk 2>/dev/null cd "$@" "$1" grep "$1" /usr/bin
+		readonly sed sed ${HOME} grep "$1" sed 2>/dev/null "$1"
+		'quoted text' then done then "$1" grep readonly grep readonly --verbose x=1 && 2>/dev/null
+"$1" cd "$@" /usr/bin local export then $(pwd) echo
+		$(pwd) --verbose 'quoted text' printf "$1" echo
+cd readonly && then readonly --verbose echo then export
+		local | 'quoted text' x=1 echo local "$1" local
+/usr/bin grep grep grep readonly --verbose x=1
+		cd x=1 x=1 sed x=1 then sed then | local readonly x=1 && grep x=1
+		2>/dev/null /usr/bin local -eu awk
+cd 'quoted text' cd echo "$1" echo then cd awk grep /usr/bin
+${HOME} grep x=1 $(pwd) | grep 'quoted text'
+		"$1" --verbose 'quoted text' | export -eu && sed
+local ${HOME} grep && cd
+		${HOME} && ${HOME} cd $(pwd) cd
+		"$1" x=1 | sed x=1 test
+	--verbose && "$@" && sed "$@"
+		$(pwd) cd local /usr/bin /usr/bin ${HOME} x=1 && -eu 'quoted text'
+	done grep local 'quoted text' readonly
+"$1" test | then done && printf | then -eu then && local
+	done -eu && readonly done -eu ${HOME} x=1 grep --verbose export $(pwd) cd
+$(pwd) "$1" awk echo echo ${HOME} | export 2>/dev/null ${HOME} done "$@" | |
+"$@" sed | | readonly | 2>/dev/null
+	test 'quoted text' /usr/bin | x=1
+x=1 done echo ${HOME} 'quoted text' 2>/dev/null -eu awk "$1" $(pwd)
+	export "$@" $(pwd) then export 2>/dev/null printf then local
+		/usr/bin ${HOME} done /usr/bin
+$(pwd) grep local awk cd grep x=1 cd --verbose
+		| grep sed && | "$@" $(pwd) $(pwd) -eu local 2>/dev/null
+	2>/dev/null done --verbose x=1 echo
+		${HOME} 'quoted text' -eu
+	sed x=1 "$@" cd $(pwd) --verbose ${HOME}
+		--verbose | "$1" 2>/dev/null --verbose x=1
+		then awk | readonly 'quoted text' cd grep sed done then export 'quoted text'
+		cd $(pwd) x=1 | $(pwd) export /usr/bin --verbose echo cd printf then ${HOME}
+	--verbose test "$1" --verbose local then x=1 readonly
+		grep grep "$@" grep readonly
+"$1" sed && && then then | test
+		readonly grep -eu /usr/bin "$@"
+'quoted text' readonly sed grep echo local awk
+		local sed export grep x=1 "$1" 'quoted text'
+	then ${HOME} cd 2>/dev/null ${HOME} cd readonly export sed test 2>/dev/null
+	"$@" /usr/bin local export 2>/dev/null local 2>/dev/null ${HOME} /usr/bin 'quoted text'
+	-eu && grep readonly "$@" $(pwd) awk done echo export
+	cd --verbose done "$@" $(pwd) $(pwd) --verbose /usr/bin 'quoted text' grep && ${HOME}
+| ${HOME} cd local | awk ${HOME} $(pwd) local ${HOME} x=1 --verbose
+	local --verbose | x=1 $(pwd) --verbose echo
+	| done readonly then local --verbose ${HOME} printf
+		'quoted text' "$1" "$1" readonly done /usr/bin
+	then printf printf export readonly
+		--verbose | printf -eu readonly --verbose done printf done sed
+	--verbose readonly printf
+"$@" /usr/bin test then cd ${HOME} "$@" local printf -eu then local sed
+		2>/dev/null export sed printf awk 'quoted text'
+grep then x=1 2>/dev/null grep test sed | test "$1" awk "$1" x=1 "$1"
+	local -eu done test export "$@" grep printf && export done export && export grep
+	'quoted text' x=1 -eu done --verbose cd "$@" test
+local export grep | "$@" sed "$1" $(pwd) printf cd test printf | $(pwd) /usr/bin
+		"$@" --verbose readonly awk --verbose
+	cd grep echo "$@" "$1" --verbose && ${HOME} --verbose
+cd readonly cd test --verbose echo x=1
+		$(pwd) sed $(pwd) grep readonly && | 'quoted text' grep
+2>/dev/null local 'quoted text' echo "$1" "$1" export 2>/dev/null
+		x=1 && export awk grep then 'quoted text' $(pwd) /usr/bin grep /usr/bin
+		-eu && --verbose && test 'quoted text'
+	"$1" && x=1 -eu 2>/dev/null
+	readonly cd 2>/dev/null /usr/bin
+	readonly 'quoted text' export cd "$@" -eu --verbose awk echo
+		${HOME} $(pwd) "$1" printf
+	cd && local cd echo readonly export "$1" printf x=1 printf $(pwd) && sed echo
+| 'quoted text' done done 'quoted text'
+		${HOME} /usr/bin && export "$1" awk 2>/dev/null done grep
+		| echo readonly $(pwd) sed done grep "$@" export "$1"
+echo $(pwd) cd && readonly | --verbose cd
+--verbose "$@" printf grep --verbose -eu echo x=1 "$@" echo
+		-eu then readonly | export "$1" "$1" cd -eu --verbose export echo 2>/dev/null
+		echo export && export 'quoted text' cd then export ${HOME}
+	local && awk echo readonly
+	readonly awk printf "$1" sed then "$1" then sed sed ${HOME}
+		sed 2>/dev/null cd export --verbose $(pwd) sed
+sed test grep cd "$@" awk
+	-eu -eu && x=1 local done "$1" x=1 grep
+		&& && sed "$1" --verbose done sed ${HOME} -eu done 2>/dev/null
+	2>/dev/null "$@" x=1 cd
+	then "$@" "$1" $(pwd) $(pwd) "$@" "$@" "$@" local
+		$(pwd) | && /usr/bin 'quoted text' "$@" grep && "$1" cd "$1" $(pwd) export
+'quoted text' 'quoted text' sed --verbose --verbose cd "$@" readonly awk awk
+echo /usr/bin grep 2>/dev/null "$@" awk test readonly /usr/bin
+		2>/dev/null readonly | done && 'quoted text' -eu
+		test printf sed 2>/dev/null
+${HOME} test 2>/dev/null | /usr/bin | x=1 awk
+	--verbose && printf "$@" then $(pwd)
+		"$@" then 2>/dev/null printf
+		then $(pwd) grep printf 'quoted text'
+		/usr/bin printf cd then then cd -eu "$@" readonly /usr/bin awk grep export printf
+	local grep ${HOME} test --verbose
+#include c250.sh
+		cd awk awk 'quoted text' grep 2>/dev/null readonly grep && 'quoted text'
+	awk 'quoted text' "$@" "$1" printf 2>/dev/null --verbose
+		export | "$@" then ${HOME} readonly grep echo
+		2>/dev/null then readonly echo ${HOME} /usr/bin local sed --verbose 'quoted text'
+/usr/bin export echo | cd local 'quoted text' "$@" 'quoted text' awk | export
+	echo 2>/dev/null then printf && test local then cd test 'quoted text'
+	'quoted text' | export export ${HOME}
+grep export then awk && && sed 'quoted text'
+		$(pwd) echo | | awk | then ${HOME}
+		then 2>/dev/null awk /usr/bin 'quoted text'
+	printf x=1 printf grep
+	awk 2>/dev/null ${HOME} "$1" /usr/bin "$1" && | printf then sed printf export awk
+"$@" -eu 2>/dev/null export
+-eu $(pwd) 'quoted text' 2>/dev/null export
+		"$@" then local done $(pwd) grep
+done test && then && done printf cd -eu local /usr/bin echo "$1"
+	| $(pwd) grep done sed done cd local -eu
+		${HOME} && local cd cd --verbose then && "$1" -eu echo
+| sed test /usr/bin x=1
+-eu then test echo cd sed && --verbose test
+2>/dev/null sed grep printf cd cd sed export $(pwd) test
+		x=1 done export ${HOME} ${HOME} then export "$@" test sed x=1 grep local local
+local echo $(pwd) && && --verbose readonly "$1"
+		--verbose grep done printf test local local "$@" printf sed export x=1 2>/dev/null
+		grep test ${HOME} sed cd sed "$1" 2>/dev/null
+	grep 'quoted text' printf readonly -eu
+	sed /usr/bin -eu cd -eu sed | | -eu echo then | test $(pwd)
+-eu readonly "$@" 2>/dev/null 2>/dev/null cd printf cd $(pwd) $(pwd) then x=1
+	| awk ${HOME} awk 2>/dev/null --verbose sed sed
+		'quoted text' sed x=1 /usr/bin 2>/dev/null
+${HOME} | echo --verbose sed echo readonly echo
+	cd | 2>/dev/null x=1 sed "$@" --verbose
+		'quoted text' x=1 done $(pwd) -eu $(pwd) printf sed
+	${HOME} awk 'quoted text' && test
+	echo && then 'quoted text'
+2>/dev/null then && grep --verbose $(pwd) sed
+		awk -eu 'quoted text' local 2>/dev/null -eu "$@" then
+		'quoted text' "$1" grep cd grep cd
+	'quoted text' -eu test awk -eu | -eu 2>/dev/null printf readonly
+	--verbose && then grep sed 'quoted text' then "$1" done $(pwd)
+		sed $(pwd) local export printf 2>/dev/null | /usr/bin ${HOME}
+		| ${HOME} 'quoted text' ${HOME} --verbose -eu ${HOME} then $(pwd)
+	printf $(pwd) --verbose /usr/bin awk local local done
+		${HOME} && | 'quoted text' cd --verbose | local test printf 2>/dev/null
+		'quoted text' x=1 "$1" sed
+		echo -eu "$@" | | local ${HOME} -eu sed test readonly x=1 done printf
+2>/dev/null echo | "$@"
+sed | | sed export then echo "$1" 'quoted text' && "$1" test "$1" "$@" ${HOME}
+		&& ${HOME} && -eu printf x=1 /usr/bin -eu /usr/bin sed echo test done
+done -eu local --verbose export /usr/bin 'quoted text' 2>/dev/null grep
+	${HOME} grep "$@" then printf $(pwd) grep /usr/bin
+	printf readonly x=1 grep ${HOME} readonly
+		then printf $(pwd) -eu test test
+sed 2>/dev/null x=1 -eu 'quoted text' $(pwd) $(pwd)
+		&& x=1 "$1" grep /usr/bin grep | -eu sed grep "$@"
+| -eu echo /usr/bin printf readonly "$1" 2>/dev/null awk
+		x=1 test done then -eu /usr/bin 2>/dev/null
+2>/dev/null awk export -eu printf sed then
+		cd ${HOME} 2>/dev/null
+	$(pwd) test echo export grep ${HOME} local echo grep
+export "$1" ${HOME} $(pwd) && | readonly
+	export "$1" && test $(pwd) grep "$1" 2>/dev/null
+		local "$1" cd local 'quoted text' "$@" done grep
+	/usr/bin x=1 ${HOME} $(pwd) local grep printf sed export
+		$(pwd) sed "$@" /usr/bin -eu then cd grep
+		--verbose /usr/bin printf -eu done done echo /usr/bin grep grep 2>/dev/null
+	"$1" 2>/dev/null | ${HOME} && ${HOME}
+		cd ${HOME} echo printf grep then readonly local && readonly then | ${HOME}
+	'quoted text' --verbose -eu "$1"
+	'quoted text' | export grep "$@" awk echo "$1" "$@" -eu test /usr/bin /usr/bin sed
+	readonly sed 'quoted text' -eu 'quoted text' ${HOME} cd "$1" 'quoted text'
+		grep readonly then /usr/bin test --verbose
+	local && "$1" 'quoted text' export grep cd export "$1" x=1
+echo readonly then --verbose
+done | then /usr/bin 'quoted text' done
+		echo /usr/bin -eu /usr/bin cd readonly readonly | echo -eu /usr/bin "$@"
+	readonly "$1" printf test grep "$1" $(pwd) cd done
+		printf --verbose 'quoted text' sed ${HOME} export /usr/bin echo --verbose
+sed sed $(pwd) grep $(pwd) /usr/bin "$@" 'quoted text'
+		-eu echo done local 2>/dev/null
+	--verbose x=1 $(pwd) printf awk /usr/bin local --verbose sed test then
+	sed echo -eu x=1 "$@" --verbose sed cd --verbose &&
+"$@" x=1 test readonly -eu $(pwd)
+	"$@" local sed echo ${HOME} && /usr/bin
+		grep test grep sed $(pwd) --verbose then "$1" sed printf $(pwd) grep x=1 then
+$(pwd) $(pwd) done "$@" done x=1 local printf printf
+	"$1" x=1 awk 2>/dev/null ${HOME} "$1" /usr/bin --verbose
+		2>/dev/null x=1 cd x=1 sed && test /usr/bin 'quoted text'
+"$1" x=1 grep "$@" local echo sed sed readonly awk done
+cd "$@" && 2>/dev/null test readonly printf printf ${HOME}
+	local "$1" readonly done export test awk test ${HOME}
+		'quoted text' cd printf done test && x=1 sed --verbose "$@" cd --verbose
+	"$1" sed --verbose test done export test cd grep x=1 "$@" sed ${HOME} readonly
+		grep | "$@" export done 'quoted text' done | ${HOME} 2>/dev/null sed awk readonly
+test awk 'quoted text' done local 2>/dev/null "$@" then readonly "$@" $(pwd)
+	local export export "$@" /usr/bin done readonly -eu 'quoted text' readonly
+| $(pwd) readonly x=1 "$1" sed awk
+-eu "$@" 'quoted text' --verbose then
+done 'quoted text' test printf $(pwd) x=1 -eu sed done export local
+readonly "$@" "$@" echo local printf cd "$1" export | then printf test
+		done | done "$1" 'quoted text' test 'quoted text' awk grep sed
+		$(pwd) "$1" | test 2>/dev/null
+	| sed grep "$1" && /usr/bin $(pwd)
+	| awk readonly readonly done local done
+	then echo -eu /usr/bin then local local readonly then cd readonly
+grep ${HOME} ${HOME} sed sed && 2>/dev/null 'quoted text' --verbose
+		local -eu && cd ${HOME} readonly | export
+awk "$@" then printf $(pwd) -eu local /usr/bin
+'quoted text' test export grep cd sed
+	/usr/bin printf "$1" && readonly grep 'quoted text' printf "$1" -eu /usr/bin
+		| grep grep echo /usr/bin
+		${HOME} local x=1 cd echo then x=1
+/usr/bin -eu printf $(pwd) 2>/dev/null /usr/bin echo x=1 && "$1" --verbose
+		then cd test "$1" printf
+		export export /usr/bin then done grep $(pwd) cd -eu
+		"$1" printf awk | echo export
+'quoted text' done -eu | export sed echo "$@" | ${HOME} 'quoted text'
+${HOME} test test awk grep printf 'quoted text' 'quoted text' then
+	"$1" && -eu ${HOME} local awk echo x=1 echo printf
+readonly sed then | cd readonly "$1" $(pwd) && "$1" && sed awk
+	done awk /usr/bin readonly readonly echo
+		grep then 2>/dev/null | export 'quoted text' "$@" local printf x=1 --verbose
+	awk ${HOME} "$1" then --verbose $(pwd) echo $(pwd) readonly
+		x=1 ${HOME} -eu echo local -eu "$@" export "$1" export printf
+	then -eu -eu then && then x=1 | echo grep -eu then readonly --verbose
+	readonly -eu 'quoted text' local local export 2>/dev/null
+	then export | echo --verbose
+grep test cd --verbose 2>/dev/null
+-eu echo awk grep ${HOME} echo done awk "$@" sed grep 2>/dev/null
+readonly /usr/bin $(pwd) | "$1" export --verbose x=1 then sed "$1"
+		"$@" ${HOME} --verbose sed grep "$1" x=1 "$1" test "$1" then awk echo
+'quoted text' done done $(pwd)
+export 'quoted text' export $(pwd) local grep "$@" && --verbose
+		"$@" test grep "$1" /usr/bin readonly test test $(pwd) test test 'quoted text'
+	"$@" --verbose test sed grep then $(pwd) | printf /usr/bin "$1" echo
+	test local /usr/bin -eu && "$@" $(pwd) ${HOME} printf printf "$@" | then
+	"$@" grep done "$1" $(pwd) $(pwd) 2>/dev/null 2>/dev/null readonly
+	-eu "$1" grep sed && then && 'quoted text' "$@"
+		"$1" ${HOME} printf grep printf test then
+&& 'quoted text' ${HOME} ${HOME} export
+cd readonly $(pwd) $(pwd) export $(pwd) | /usr/bin echo | test
+test ${HOME} local cd && 'quoted text' --verbose /usr/bin cd
+	export /usr/bin | printf x=1 echo ${HOME} "$@" --verbose sed grep then
+done -eu export awk $(pwd) awk sed echo "$@" --verbose grep $(pwd)
+	"$1" "$@" awk /usr/bin "$@" sed
+	2>/dev/null 'quoted text' done /usr/bin -eu cd readonly printf
+local --verbose echo -eu "$@" readonly -eu
+		| --verbose export && cd 2>/dev/null test && /usr/bin "$@" local /usr/bin &&
+		then --verbose --verbose sed export cd
+then $(pwd) | cd cd -eu /usr/bin -eu x=1
+		-eu && sed "$1" echo awk -eu "$@" test $(pwd)
+	awk echo 'quoted text' export | | $(pwd) && ${HOME} 2>/dev/null
+test -eu done sed local -eu $(pwd) test $(pwd) && --verbose local cd printf
+		$(pwd) && export then local
+		${HOME} cd "$1" "$@" | local --verbose done printf echo test awk $(pwd)
+		$(pwd) /usr/bin then && grep "$1"
+	--verbose 2>/dev/null cd printf test export sed grep printf
+		'quoted text' x=1 sed done awk then /usr/bin &&
+| grep $(pwd) cd $(pwd) --verbose readonly $(pwd)
+		grep x=1 done 2>/dev/null
+		echo "$1" printf cd $(pwd) && ${HOME} readonly then export then printf
+sed readonly x=1 'quoted text' printf /usr/bin
+	awk export /usr/bin then x=1 grep done "$@" &&
+	&& printf test sed cd sed 2>/dev/null
+sed grep "$@" | awk readonly "$1" x=1 | sed echo && /usr/bin /usr/bin "$@"
+x=1 ${HOME} -eu $(pwd) x=1 'quoted text' && | $(pwd) /usr/bin -eu
+	'quoted text' "$1" 2>/dev/null | grep cd
+	readonly $(pwd) "$1" 'quoted text' grep ${HOME} test
+${HOME} readonly echo local 2>/dev/null /usr/bin
+awk then x=1 then local 'quoted text' sed done printf $(pwd)
+	'quoted text' $(pwd) && local ${HOME} local export
+${HOME} ${HOME} awk --verbose done cd printf cd
+	/usr/bin awk "$1" ${HOME} x=1 | printf
+echo 2>/dev/null test export "$@" 'quoted text'
+		x=1 && /usr/bin && $(pwd) echo awk "$1" test | --verbose echo
+		"$@" test | 2>/dev/null --verbose readonly "$@" printf cd export 2>/dev/null /usr/bin
+test sed test awk x=1
+	/usr/bin export export grep 2>/dev/null "$@" export
+		-eu 2>/dev/null readonly echo export done sed cd "$1" done && sed
+		readonly printf 2>/dev/null 2>/dev/null --verbose 2>/dev/null export awk -eu
+		export 2>/dev/null | echo then && printf cd $(pwd)
+		| | x=1 test x=1 x=1 ${HOME} "$1" local && "$@" then readonly --verbose ${HOME}
+printf | echo sed cd readonly --verbose grep x=1 --verbose cd awk $(pwd)
+echo done sed local readonly x=1 $(pwd)
+	&& then 'quoted text' -eu 'quoted text' export ${HOME} readonly test export
+	&& local grep sed 2>/dev/null
+	test grep echo | sed --verbose /usr/bin test 'quoted text'
+--verbose --verbose --verbose grep
+sed grep $(pwd) && test x=1 then 2>/dev/null
+		| local done x=1 local ${HOME} "$@"
+grep -eu printf local test then awk printf 2>/dev/null test $(pwd)
+sed /usr/bin then printf sed x=1 | awk x=1 readonly "$1" export &&
+		| then "$@" export test
+		then done echo ${HOME} echo "$@" | test -eu test
+		${HOME} -eu local /usr/bin done grep echo ${HOME} x=1 cd && &&
+| ${HOME} cd local | readonly
+		done echo export printf 2>/dev/null printf
+echo "$1" && ${HOME} test then 2>/dev/null -eu $(pwd) 'quoted text'
+then 'quoted text' awk $(pwd)
+	printf grep done $(pwd)
+test "$@" cd then readonly printf "$@" cd 'quoted text' --verbose
+	'quoted text' awk done ${HOME} ${HOME}
+	"$@" -eu "$1" then then "$@" -eu cd $(pwd) done printf
+	local cd x=1 --verbose 2>/dev/null then $(pwd) readonly ${HOME} x=1 &&
+		| grep test grep 2>/dev/null "$1" 'quoted text' && then --verbose
+		&& grep 2>/dev/null export then 2>/dev/null
+	${HOME} 'quoted text' /usr/bin | x=1 | --verbose echo -eu
+	'quoted text' printf "$1" 'quoted text'
+		"$@" "$@" "$1" "$1" && then "$@" local
+	--verbose printf awk /usr/bin ${HOME} awk cd
+	/usr/bin readonly -eu x=1
+"$@" x=1 -eu then ${HOME}
+	done done -eu then sed
+&& "$1" 'quoted text' grep echo echo test test export "$1" --verbose sed cd
+		done 2>/dev/null then readonly grep printf
+	echo x=1 done && /usr/bin export --verbose cd 2>/dev/null 'quoted text' readonly
+	printf --verbose x=1 --verbose readonly local && readonly
+--verbose $(pwd) $(pwd) sed test cd ${HOME}
+readonly sed 2>/dev/null 2>/dev/null
+		readonly 2>/dev/null echo local | export ${HOME} export then "$1"
+	echo export ${HOME} | awk --verbose /usr/bin cd ${HOME} 2>/dev/null /usr/bin
+		done ${HOME} -eu cd -eu 'quoted text' 'quoted text'
+test readonly then done
+		x=1 /usr/bin "$@" 2>/dev/null $(pwd) /usr/bin
+local 2>/dev/null -eu "$@" "$1" cd | -eu echo printf test 'quoted text'
+-eu 2>/dev/null grep x=1 ${HOME} -eu grep test local export sed test && printf cd
+local then export | "$1" ${HOME} then 2>/dev/null
+cd /usr/bin "$1" grep done done | echo
+2>/dev/null /usr/bin 'quoted text' 'quoted text'
+		grep done awk sed grep | 2>/dev/null grep 2>/dev/null $(pwd)
+	printf | sed export /usr/bin grep done test
+		2>/dev/null /usr/bin "$@" awk
+${HOME} -eu sed x=1 |
+then "$@" sed x=1 local sed test local -eu
+then awk then "$@" export /usr/bin &&
+--verbose then grep "$1" printf 'quoted text' | ${HOME} x=1 export ${HOME} readonly
+		2>/dev/null "$1" 'quoted text' 'quoted text' $(pwd)
+x=1 -eu cd done then
+		x=1 printf "$@" printf then done printf then "$@" -eu | local
+		&& cd "$1" && "$1" printf export done cd --verbose
+	/usr/bin sed "$1" | sed cd local
+	export cd 'quoted text' done grep echo done sed && cd
+	done && echo echo local -eu cd ${HOME} export
+$(pwd) && awk sed printf | && test
+		'quoted text' echo grep "$@" --verbose 'quoted text' "$@" readonly test "$@"
+	echo /usr/bin awk local export 2>/dev/null --verbose --verbose
+x=1 /usr/bin sed "$@" 2>/dev/null cd grep 2>/dev/null
+&& echo "$@" -eu awk "$@" echo 'quoted text' test readonly &&
+local awk printf sed | --verbose | "$@" export --verbose
+		test readonly printf echo "$@" 'quoted text' local done grep done "$@"
+		--verbose $(pwd) 2>/dev/null grep awk grep ${HOME} awk cd test done ${HOME}
+		export "$@" cd done printf 2>/dev/null echo 'quoted text' test awk
+		"$@" 2>/dev/null $(pwd) "$1"
+$(pwd) readonly 2>/dev/null $(pwd) awk -eu --verbose
+	$(pwd) x=1 awk then -eu |
+	x=1 "$@" echo 'quoted text' --verbose echo "$@" -eu "$1"
+	then -eu readonly "$1" /usr/bin x=1 | x=1 "$@" then sed cd grep export awk "$1"
+"$@" local sed 2>/dev/null echo -eu "$@" then | export
+		"$@" local readonly "$@" done echo "$@" printf --verbose sed export
+"$@" x=1 then 2>/dev/null awk grep -eu cd ${HOME} | /usr/bin
+		2>/dev/null ${HOME} grep && $(pwd) done test && test $(pwd)
+		then ${HOME} && awk then /usr/bin -eu x=1 echo && 2>/dev/null
+		grep "$1" then then x=1 readonly readonly ${HOME} local printf
+	'quoted text' /usr/bin echo 'quoted text'
+	'quoted text' then readonly awk $(pwd)
+		readonly && 2>/dev/null | "$@" "$@"
+	$(pwd) | export grep printf ${HOME} local | /usr/bin then
+then done --verbose sed $(pwd) grep then ${HOME} | echo
+	sed grep /usr/bin -eu | test -eu awk "$1" export "$1" then /usr/bin
+2>/dev/null printf $(pwd) 2>/dev/null
+'quoted text' x=1 then |
+		awk test local | "$1" ${HOME} echo 2>/dev/null
+	local ${HOME} x=1 test && 'quoted text' then /usr/bin ${HOME}
+"$@" --verbose --verbose 2>/dev/null
+		"$@" echo export awk local $(pwd) x=1 $(pwd) 'quoted text' -eu
+test --verbose 2>/dev/null ${HOME}
+		grep export sed readonly test "$@" "$1" "$@" cd awk x=1 -eu --verbose
+"$1" --verbose --verbose readonly done sed grep --verbose 'quoted text' grep
+		printf 2>/dev/null export cd $(pwd) awk printf
+	export -eu "$@" ${HOME} awk awk echo x=1 export local
+		printf readonly readonly readonly "$1" then x=1 2>/dev/null
+-eu readonly printf export test readonly echo
+		| /usr/bin grep sed "$@" export
+--verbose echo 2>/dev/null $(pwd) test &&
+	local then sed export -eu "$1" awk awk readonly 2>/dev/null 2>/dev/null ${HOME}
+	&& cd local local 'quoted text'
+awk && | export test "$@" done printf then test "$@" grep grep 2>/dev/null
+x=1 done test --verbose 'quoted text' then then export $(pwd) then export
+local cd "$1" grep 2>/dev/null export /usr/bin cd
+cd x=1 ${HOME} --verbose ${HOME} cd | done x=1 ${HOME} then "$@" -eu
+/usr/bin --verbose test /usr/bin
+cd x=1 /usr/bin $(pwd) $(pwd) $(pwd) ${HOME}
+		then 2>/dev/null readonly done echo echo -eu done local cd &&
+${HOME} export 2>/dev/null awk "$@" echo "$@" -eu x=1 |
+	x=1 x=1 "$@" 2>/dev/null echo 2>/dev/null ${HOME} | -eu --verbose ${HOME}
+"$1" 2>/dev/null cd "$@" echo --verbose "$@" readonly "$1" "$@"
+	&& done local printf printf /usr/bin && 'quoted text'
+	x=1 /usr/bin | awk 2>/dev/null "$@" | -eu /usr/bin $(pwd) "$1" then done echo "$@"
+	--verbose test sed echo done export then x=1 readonly grep
+	done x=1 $(pwd) done --verbose /usr/bin
+2>/dev/null sed done && $(pwd) 2>/dev/null 'quoted text' x=1 readonly then
+x=1 2>/dev/null export
+echo then readonly "$1" cd $(pwd) $(pwd)
+	sed readonly x=1 && awk awk 2>/dev/null
+		| 'quoted text' "$@" awk printf x=1 ${HOME} --verbose $(pwd) $(pwd) /usr/bin
+		awk && local readonly $(pwd) grep printf cd done
+		$(pwd) done "$@" test then grep cd echo echo done done test "$@"
+cd done | && 'quoted text' awk --verbose grep -eu done x=1 then
+	test --verbose && export
+local /usr/bin 2>/dev/null echo 'quoted text' test echo /usr/bin
+	x=1 ${HOME} $(pwd) ${HOME} 2>/dev/null --verbose "$@" export awk local /usr/bin
+		--verbose x=1 cd -eu /usr/bin then
+		awk ${HOME} local test test --verbose
+	then test 'quoted text' | /usr/bin test printf
+	${HOME} grep x=1 /usr/bin sed ${HOME} ${HOME} cd $(pwd) done "$1"
+	'quoted text' grep "$@" then done grep test && readonly ${HOME}
+		local sed done sed 2>/dev/null -eu ${HOME}
+		'quoted text' "$@" | awk awk "$1" export then 'quoted text' && ${HOME}
+	| cd && readonly cd 'quoted text' printf done readonly /usr/bin 2>/dev/null 2>/dev/null
+		export cd -eu grep "$@" | --verbose | printf --verbose test local sed test "$@"
+test grep "$1" awk printf awk /usr/bin
+		readonly printf done && printf cd "$@"
+	test "$@" "$@" readonly grep readonly --verbose printf export ${HOME}
+		test readonly printf awk then sed export readonly
+	/usr/bin x=1 local --verbose grep echo 'quoted text' echo grep awk 2>/dev/null
+local cd export x=1 echo grep then sed "$@" local -eu --verbose 2>/dev/null
+		awk "$@" x=1 echo local test
+done done /usr/bin $(pwd) "$1" echo sed x=1 "$@"
+${HOME} local done --verbose readonly "$1" x=1 | ${HOME} "$@" | then echo
+	then awk test sed | && "$@" sed
+"$1" grep done echo $(pwd) echo grep sed grep awk cd "$@" then 2>/dev/null
+		sed echo cd $(pwd) 'quoted text' x=1 printf local ${HOME}
+x=1 2>/dev/null -eu 2>/dev/null
+/usr/bin && -eu $(pwd) 'quoted text' test done
+		then cd awk -eu -eu "$@"
+	--verbose $(pwd) "$@" "$@" 2>/dev/null 'quoted text' local /usr/bin
+		$(pwd) $(pwd) "$@" "$1" | test --verbose && awk printf ${HOME} && echo
+	"$@" 2>/dev/null "$1" done awk 2>/dev/null then echo
+	sed x=1 export 2>/dev/null local sed "$1" x=1
+"$1" grep /usr/bin sed grep && local cd sed $(pwd) --verbose local echo echo
+		test --verbose sed then readonly grep sed 'quoted text'
+		$(pwd) $(pwd) ${HOME} echo 2>/dev/null $(pwd) printf 2>/dev/null "$1" cd 2>/dev/null
+local 2>/dev/null test x=1 "$@" test grep awk test done
+	&& && /usr/bin local 'quoted text' 2>/dev/null
+	sed /usr/bin awk ${HOME} | done -eu /usr/bin sed test readonly
+		| echo -eu test /usr/bin x=1 done test ${HOME} 2>/dev/null grep readonly $(pwd)
+		readonly grep printf printf local
+		done sed --verbose awk /usr/bin | export && printf && local ${HOME}
+	readonly grep readonly printf echo 'quoted text' done readonly ${HOME} "$1"
+awk $(pwd) -eu grep "$@" then readonly 2>/dev/null
+| local awk | 2>/dev/null local && $(pwd)
+		readonly printf 2>/dev/null sed export local ${HOME} /usr/bin grep ${HOME}
+	cd 'quoted text' --verbose | then $(pwd) /usr/bin --verbose | /usr/bin ${HOME}
+	"$1" export "$@" test grep sed
+		-eu export ${HOME} -eu --verbose x=1 "$@" grep then ${HOME}
+x=1 local -eu 2>/dev/null readonly test sed
+| test --verbose sed echo local printf && ${HOME} awk -eu
+	-eu | 'quoted text' "$1"
+	| 2>/dev/null --verbose test /usr/bin ${HOME} readonly echo --verbose
+	$(pwd) && awk "$1" --verbose awk done local |
+		"$@" awk grep printf $(pwd)
+done -eu ${HOME} then sed then "$1" cd local x=1 'quoted text' | printf awk then
+local awk "$1" ${HOME} "$@" readonly 'quoted text'
+		export then && readonly export -eu "$1" $(pwd) 2>/dev/null
+	printf test then export "$@" export local $(pwd)
+		readonly test -eu --verbose | echo --verbose grep | /usr/bin
+	'quoted text' "$1" x=1 then "$1" -eu "$1" awk 2>/dev/null --verbose readonly
+	readonly local "$@" readonly cd x=1 | printf 2>/dev/null local
+		local ${HOME} local grep && --verbose awk readonly sed echo -eu
+	'quoted text' cd --verbose export printf ${HOME}
+		&& -eu export x=1 sed | then && && | "$1"
+cd printf readonly | printf && grep done 'quoted text' test
+		grep 'quoted text' printf /usr/bin then x=1 export
+awk 2>/dev/null ${HOME}
+'quoted text' x=1 --verbose export -eu 2>/dev/null export awk ${HOME}
+	'quoted text' readonly $(pwd) awk echo export 'quoted text'
+x=1 /usr/bin sed cd 'quoted text' echo test /usr/bin then
+		${HOME} && x=1 sed export
+${HOME} sed /usr/bin "$1" sed awk /usr/bin export ${HOME}
+	&& awk && printf then printf && ${HOME}
+		--verbose echo cd "$@" 'quoted text' done cd sed grep "$1" && echo cd
+	cd awk | grep test /usr/bin --verbose
+test export | --verbose "$1" ${HOME} x=1 && $(pwd) readonly
+	-eu 'quoted text' printf ${HOME}
+then readonly && sed "$1" 2>/dev/null readonly local $(pwd) ${HOME} ${HOME}
+&& echo "$1" "$@" | local $(pwd) export awk && ${HOME} "$@"
+		echo sed 'quoted text' then | readonly 2>/dev/null
+	"$1" "$@" --verbose | x=1 --verbose "$@" 'quoted text' done /usr/bin
+	test echo 'quoted text'
+	test readonly "$1" echo /usr/bin | local awk ${HOME} 2>/dev/null "$@" local
+		done cd ${HOME} -eu export local --verbose "$1"
+	--verbose x=1 awk && grep | then "$1" test | --verbose
+	/usr/bin | 'quoted text' "$1" done /usr/bin "$@" 2>/dev/null cd x=1 export
+export echo --verbose test done
+		'quoted text' ${HOME} sed "$@" /usr/bin
+local "$@" export /usr/bin printf /usr/bin readonly -eu sed cd ${HOME}
+'quoted text' cd 'quoted text' done /usr/bin awk "$1" | export
+echo test ${HOME} grep awk
+--verbose "$1" awk grep echo 2>/dev/null awk
+${HOME} then export then | awk readonly
+		x=1 printf readonly /usr/bin -eu "$1" /usr/bin && $(pwd) 'quoted text' && ${HOME}
+$(pwd) "$1" && grep "$1" grep export --verbose
+$(pwd) /usr/bin | 'quoted text' "$1" ${HOME} 'quoted text'
+	then ${HOME} "$@" test awk printf | done 'quoted text'
+	printf local /usr/bin awk
+then readonly $(pwd) sed ${HOME} readonly x=1
+		grep $(pwd) && "$1" echo && "$@" sed sed test ${HOME} test grep /usr/bin
+		'quoted text' /usr/bin "$1" readonly awk local && then
+		"$1" | printf && awk awk printf readonly --verbose
+		"$1" --verbose readonly --verbose done test 2>/dev/null readonly echo
+		'quoted text' done /usr/bin 2>/dev/null
+/usr/bin "$1" grep x=1
+${HOME} cd 2>/dev/null then local done sed | then 'quoted text'
+		&& cd -eu then printf 2>/dev/null && /usr/bin 'quoted text' ${HOME} 'quoted text'
+export "$@" | | -eu | export printf echo x=1 grep awk ${HOME}
+		done printf && test -eu $(pwd) local grep ${HOME}
+	printf test /usr/bin echo ${HOME} cd grep -eu 'quoted text'
+		$(pwd) printf echo && -eu x=1 done "$@"
+	then 'quoted text' readonly | $(pwd) "$1" echo
+		'quoted text' test readonly 'quoted text' | /usr/bin echo x=1 $(pwd) "$1"
+2>/dev/null test "$1" done 2>/dev/null cd "$@" "$1"
+	| cd export 'quoted text' export x=1
+	x=1 cd 'quoted text' sed done /usr/bin cd then grep | --verbose $(pwd) "$@"
+		local export local awk 2>/dev/null local done cd | then /usr/bin sed ${HOME}
+x=1 done awk "$@" -eu cd cd "$@" && readonly test printf $(pwd)
+		&& --verbose printf && printf
+2>/dev/null cd /usr/bin
+		'quoted text' ${HOME} | | export | printf
+	test echo awk /usr/bin | awk done readonly x=1 local $(pwd) then export ${HOME}
+		test test sed sed x=1 x=1 echo export sed "$@" "$@" cd local
+readonly export awk --verbose "$1" ${HOME} done && readonly
+then readonly --verbose readonly readonly 2>/dev/null echo
+test $(pwd) $(pwd) "$1" grep readonly 2>/dev/null export export ${HOME} awk
+	then grep then x=1 "$@" /usr/bin
+&& done "$@" 'quoted text' "$1"
+x=1 local && --verbose readonly "$@" ${HOME}
+	/usr/bin && cd sed awk echo
+printf "$1" 'quoted text' test | grep
+		cd cd "$@" test -eu x=1 "$@" echo | echo --verbose /usr/bin echo cd /usr/bin
+sed local done 2>/dev/null test x=1 $(pwd) done
+test 'quoted text' /usr/bin sed then then grep readonly done then then
+	2>/dev/null | "$@" | readonly -eu "$@" -eu 'quoted text'
+--verbose /usr/bin sed sed done printf export 'quoted text' printf cd cd test test
+local --verbose x=1 cd --verbose awk readonly 'quoted text'
+	$(pwd) /usr/bin 2>/dev/null $(pwd) done printf sed --verbose 'quoted text'
+	x=1 'quoted text' then echo sed printf printf done "$@"
+	${HOME} "$1" 2>/dev/null then "$@" 2>/dev/null local awk && | echo &&
+	'quoted text' $(pwd) test grep cd -eu ${HOME}
+	"$@" export 2>/dev/null /usr/bin /usr/bin "$1" grep readonly
+done echo cd export grep "$@" --verbose
+		sed readonly x=1 export test awk cd /usr/bin then
+		${HOME} test test done "$@" ${HOME} printf
+	awk $(pwd) then local sed 'quoted text' local ${HOME}
+		awk x=1 readonly readonly test "$@" "$@" export | grep done 'quoted text'
+	cd 'quoted text' --verbose "$1" awk ${HOME} local
+'quoted text' sed local echo 2>/dev/null && then --verbose
+		'quoted text' "$1" test /usr/bin awk sed
+	echo x=1 'quoted text' $(pwd) /usr/bin test "$1" test then
+	printf 'quoted text' export $(pwd) sed "$@" "$1" "$@" /usr/bin
+		awk "$@" local && cd then cd sed x=1 sed && "$@" printf "$@" ${HOME} cd
+-eu -eu then "$1" export $(pwd) x=1 echo
+		cd x=1 2>/dev/null "$1" $(pwd) "$@" --verbose cd grep "$@" "$1" "$@" | awk
+		test grep local grep sed grep ${HOME} -eu 'quoted text' x=1 then 2>/dev/null then
+		printf printf && then | $(pwd) $(pwd) done
+"$1" then --verbose --verbose awk then sed ${HOME} test test export
+		done export "$@" 2>/dev/null && $(pwd) sed done local "$1" && echo &&
+	awk done grep -eu && --verbose $(pwd) awk $(pwd)
+	then awk -eu "$@" done && done then then cd ${HOME} cd --verbose
+	$(pwd) cd sed done grep
+	/usr/bin && --verbose awk "$1" printf sed && /usr/bin --verbose 2>/dev/null
+	&& /usr/bin $(pwd) --verbose awk cd printf then echo test done
+	test sed | 'quoted text' awk 'quoted text'
+"$1" $(pwd) "$1" | sed printf "$1" /usr/bin done done 2>/dev/null
+&& --verbose 'quoted text' | readonly -eu "$1" done
+	export $(pwd) $(pwd) /usr/bin $(pwd) readonly
+done printf -eu $(pwd) "$@"
+--verbose | $(pwd) test cd ${HOME} --verbose 'quoted text'
+		${HOME} printf x=1 /usr/bin echo export echo sed echo -eu local $(pwd) 'quoted text'
+		cd local awk | export
+		local echo export x=1
+		/usr/bin export ${HOME} local 2>/dev/null echo test printf
+sed test 'quoted text' awk 'quoted text' $(pwd) readonly "$@" | x=1 readonly
+'quoted text' awk -eu sed "$@" cd $(pwd) printf local |
+		"$1" 2>/dev/null export then 'quoted text' sed
+	$(pwd) grep && cd "$1" awk 2>/dev/null --verbose printf 'quoted text'
+	--verbose sed sed && $(pwd) export export cd grep grep local
+local grep echo ${HOME}
+then echo sed done export readonly export /usr/bin echo x=1 export -eu sed "$@"
+"$@" /usr/bin awk test echo "$1"
+		sed | -eu -eu cd export x=1 echo export done done then local
+		sed test local done printf $(pwd) cd 'quoted text' -eu cd
+$(pwd) sed | /usr/bin "$@" printf readonly echo readonly && echo
+	printf awk 'quoted text' 2>/dev/null ${HOME} "$@" grep local sed
+$(pwd) cd readonly grep 'quoted text' && grep awk x=1 'quoted text'
+awk done 'quoted text' test 'quoted text' 2>/dev/null
+		cd sed /usr/bin /usr/bin --verbose 2>/dev/null --verbose grep "$1"
+		'quoted text' ${HOME} "$1" echo && $(pwd)
+		| export /usr/bin 2>/dev/null awk echo
+"$@" --verbose awk --verbose $(pwd) local ${HOME}
+		echo sed ${HOME} sed echo then then sed && "$1" done grep
+		local $(pwd) | test ${HOME} printf
+		-eu | local $(pwd) ${HOME}
+		&& ${HOME} grep | export "$@" export readonly
+		"$1" done test sed cd done ${HOME} local awk grep test
+		export readonly /usr/bin readonly x=1 && grep cd echo echo -eu /usr/bin
+		--verbose printf -eu echo 'quoted text' printf 'quoted text'
+		done then echo "$1" cd
+	awk test --verbose export printf done local test | --verbose
+		-eu 'quoted text' test sed test done sed | echo echo grep echo --verbose
+		awk local export | "$1" ${HOME} 'quoted text'
+		export /usr/bin $(pwd) done ${HOME} 2>/dev/null grep x=1 ${HOME} awk sed
+		local "$1" ${HOME} sed then sed done then x=1 2>/dev/null
+		&& x=1 then cd done printf awk | sed $(pwd) readonly done --verbose awk --verbose
+		2>/dev/null cd printf readonly /usr/bin "$1" --verbose --verbose
+	export sed awk readonly x=1 | ${HOME}
+		--verbose local cd grep x=1
+readonly done | then "$@" 'quoted text'
+	'quoted text' export "$1" export | export awk echo printf local 2>/dev/null "$1"
+| done test --verbose 2>/dev/null printf then |
+	-eu export printf local readonly ${HOME} ${HOME} && && cd -eu /usr/bin
+		test --verbose "$1" test /usr/bin done | && test /usr/bin | "$@"
+	readonly 'quoted text' -eu test --verbose readonly
+	"$1" done /usr/bin sed -eu | $(pwd) $(pwd) | readonly
+-eu x=1 /usr/bin "$1" cd 'quoted text' $(pwd) printf
+		then then 2>/dev/null --verbose done done ${HOME}
+	local 'quoted text' readonly /usr/bin /usr/bin "$1" local grep --verbose
+		test ${HOME} grep awk 2>/dev/null readonly done local "$1" -eu echo
+		2>/dev/null local cd x=1 x=1 /usr/bin readonly export "$@" export 2>/dev/null
+cd -eu | cd 'quoted text' echo /usr/bin $(pwd) 2>/dev/null printf
+cd done "$1" x=1 printf --verbose 2>/dev/null 2>/dev/null
+	cd 2>/dev/null "$@" printf printf "$@"
+		cd "$@" awk test then
+2>/dev/null "$@" export --verbose
+	"$1" then echo -eu local awk
+		echo done 'quoted text' local test "$@" then sed done 'quoted text'
+		then then $(pwd) "$@"
+		2>/dev/null sed && echo echo 2>/dev/null done "$@" local done
+sed cd /usr/bin x=1 && printf 'quoted text' awk then grep then printf -eu cd export
+		2>/dev/null cd -eu test && readonly cd readonly echo | && export readonly 'quoted text'
+		local echo export printf printf done awk cd x=1 done "$1" --verbose $(pwd) ${HOME}
+	echo "$@" /usr/bin ${HOME}
+		readonly sed "$1" $(pwd) --verbose export
+then && -eu -eu local "$@" 2>/dev/null echo readonly
+	sed grep 2>/dev/null
+		'quoted text' awk -eu
+cd "$1" grep --verbose cd | printf printf export
+		--verbose /usr/bin 2>/dev/null 'quoted text' -eu && | test echo cd 'quoted text'
+	| 2>/dev/null -eu test 'quoted text' sed "$1" --verbose
+		-eu /usr/bin --verbose done echo cd "$@" | "$@" "$@" "$1"
+		"$1" grep then /usr/bin
+"$@" x=1 export test then && readonly grep "$1" readonly cd && test test done 2>/dev/null
+		| 'quoted text' grep /usr/bin readonly x=1 "$1" | ${HOME}
+	'quoted text' -eu 'quoted text' 'quoted text' /usr/bin local
+	'quoted text' | x=1 -eu ${HOME} printf x=1
+		'quoted text' --verbose /usr/bin x=1 readonly | cd local $(pwd)
+	| then then cd then 'quoted text' printf
+&& sed then "$1" /usr/bin "$1" readonly
+	x=1 test --verbose ${HOME} echo printf sed test $(pwd) export
+		| ${HOME} local $(pwd) 'quoted text'
+		$(pwd) sed export local "$@" ${HOME} "$@" $(pwd)
+	readonly test printf "$@" cd readonly | awk readonly
+done echo | 2>/dev/null echo grep test awk local "$@" ${HOME} x=1 $(pwd) done
+	x=1 --verbose printf awk --verbose export grep done printf $(pwd)
+grep printf awk $(pwd) 'quoted text' printf cd
+"$@" 'quoted text' && test --verbose done cd test --verbose local local grep
+		-eu && --verbose $(pwd) done && $(pwd) /usr/bin /usr/bin
+		2>/dev/null $(pwd) 2>/dev/null echo local ${HOME} awk readonly export &&
+/usr/bin | -eu -eu x=1 export && printf awk test grep 'quoted text'
+--verbose grep cd cd "$1" test -eu then 2>/dev/null awk 'quoted text' export
+		cd readonly local cd && "$@" 'quoted text' 'quoted text' "$1" awk
+		'quoted text' done grep && grep done
+	$(pwd) $(pwd) readonly 'quoted text' then && 'quoted text' x=1 | printf printf
+echo --verbose /usr/bin local 'quoted text' export 'quoted text' cd
+	echo awk sed /usr/bin $(pwd) awk 2>/dev/null printf 2>/dev/null
+		| done /usr/bin && cd printf echo awk readonly 'quoted text' grep echo 'quoted text'
+		echo local cd printf "$@" export --verbose done readonly
+	x=1 | $(pwd) "$1" --verbose local export 2>/dev/null
+printf x=1 "$1" x=1 printf
+		readonly grep echo grep cd | printf sed then /usr/bin
+export 'quoted text' sed readonly "$1" /usr/bin echo printf "$1"
+		test && local done readonly --verbose readonly echo | grep awk
+	-eu "$@" done "$1" then --verbose 2>/dev/null ${HOME}
+		cd awk echo local -eu awk
+	'quoted text' awk "$1" local then /usr/bin echo -eu test 2>/dev/null
+		--verbose "$1" "$1" | done local x=1 $(pwd) ${HOME} awk ${HOME} awk
+		readonly x=1 done "$1" --verbose "$1" -eu done echo --verbose
+	test then awk 'quoted text' x=1 local test /usr/bin -eu | printf echo
+	awk x=1 && ${HOME} cd done cd echo | awk echo 2>/dev/null local
+	"$@" -eu x=1 echo $(pwd) 2>/dev/null "$1" -eu 'quoted text'
+		'quoted text' test sed test | && --verbose grep cd
+grep done ${HOME} grep && | local then "$1" awk export -eu x=1
+	printf printf printf then local cd 'quoted text'
+		$(pwd) | sed test -eu sed local x=1 x=1 | "$@"
+	echo echo test ${HOME} "$@" && $(pwd) printf -eu
+		-eu export sed ${HOME} test "$@"
+		cd "$@" grep x=1 done echo 2>/dev/null --verbose $(pwd) "$1" printf local 'quoted text'
+awk -eu echo -eu grep && test then export done "$1"
+cd sed awk ${HOME} 2>/dev/null && export /usr/bin
+		x=1 -eu echo done then 'quoted text' echo cd echo readonly
+done export test then readonly done 'quoted text' sed x=1 -eu $(pwd)
+x=1 --verbose /usr/bin 'quoted text' "$1" done echo x=1 ${HOME} -eu
+	done "$1" cd /usr/bin local "$@" 'quoted text' export "$1" done
+x=1 printf then "$@" "$1" local 'quoted text' readonly test grep
+	/usr/bin x=1 x=1 /usr/bin
+-eu grep "$1" test 2>/dev/null echo awk x=1 'quoted text' readonly cd && sed
+export sed "$1" done | $(pwd) ${HOME} "$1" printf "$@" sed echo printf | printf
+	sed local $(pwd) sed 2>/dev/null -eu printf awk readonly
+printf && -eu cd -eu x=1 export -eu export done --verbose &&
+export export grep --verbose cd echo printf printf --verbose export
+	--verbose /usr/bin "$@" "$1" $(pwd) done && sed | 'quoted text'
+"$1" ${HOME} && "$@" sed printf && "$1" && export sed "$1" x=1 cd grep local
+	readonly awk test then
+	'quoted text' awk && awk then
+	/usr/bin cd | test grep 2>/dev/null --verbose 2>/dev/null
+	done x=1 readonly "$1" awk -eu -eu
+		${HOME} $(pwd) done 'quoted text' cd | x=1 awk awk export printf local
+export 2>/dev/null echo ${HOME} awk "$1" awk --verbose echo done readonly
+'quoted text' "$@" sed done ${HOME} --verbose | grep test /usr/bin printf
+		echo echo | ${HOME} -eu echo $(pwd) --verbose
+	$(pwd) x=1 then printf cd done readonly $(pwd) sed && $(pwd) $(pwd) &&
+--verbose readonly --verbose cd then test
+		awk done | ${HOME} test -eu readonly --verbose sed printf done export
+		2>/dev/null 'quoted text' done ${HOME} /usr/bin
+"$1" $(pwd) done echo 'quoted text' | $(pwd) then $(pwd)
+	${HOME} then test local 'quoted text' /usr/bin | grep done
+	local sed sed && echo done "$@" cd then && $(pwd) cd /usr/bin sed "$@"
+$(pwd) | export echo && "$1" --verbose /usr/bin "$1" local echo then done then
+	test ${HOME} "$1" 'quoted text' ${HOME}
+	grep done 'quoted text' grep -eu /usr/bin printf
+		'quoted text' done cd && /usr/bin
+/usr/bin export awk readonly sed grep x=1 then ${HOME} | sed "$1"
+x=1 2>/dev/null "$@" test then done /usr/bin done readonly
+	$(pwd) 'quoted text' awk -eu | 'quoted text' then
+export x=1 sed /usr/bin x=1 | x=1 $(pwd) done
+"$1" -eu cd /usr/bin | x=1 then export x=1 grep "$1" ${HOME} &&
+done test cd 2>/dev/null local then cd grep sed test /usr/bin export grep
+	'quoted text' done test readonly /usr/bin
+	printf then && x=1 test printf sed test -eu local /usr/bin "$1" | | --verbose awk
+	"$1" x=1 grep readonly && then echo &&
+		x=1 'quoted text' sed grep then done | readonly cd cd local printf 2>/dev/null
+echo export grep grep "$1" export
+	"$1" done "$@" readonly cd ${HOME} sed 2>/dev/null printf
+done export $(pwd) test
+	sed -eu /usr/bin "$1" "$1"
+		local x=1 x=1 sed "$1" done && local ${HOME} | $(pwd) && /usr/bin $(pwd)
+2>/dev/null "$1" printf cd export readonly export $(pwd) "$@" "$1"
+		printf --verbose ${HOME} "$1" x=1
+test grep --verbose $(pwd)
+		test then $(pwd) 2>/dev/null sed printf -eu sed export /usr/bin -eu /usr/bin
+	awk ${HOME} then "$@" 'quoted text'
+grep grep /usr/bin test awk 2>/dev/null
+		/usr/bin $(pwd) awk 'quoted text' grep 2>/dev/null | -eu then cd sed cd readonly
+"$1" cd printf x=1 | then printf readonly sed echo then
+awk 2>/dev/null printf local "$@" printf $(pwd)
+	-eu $(pwd) readonly local ${HOME} readonly
+		local "$@" /usr/bin "$1" test ${HOME} readonly x=1 done 'quoted text'
+		local ${HOME} then /usr/bin && test --verbose export sed cd && test export
+		done cd 2>/dev/null cd x=1 then sed
+	'quoted text' ${HOME} cd
+cd done cd export /usr/bin cd "$@" test test printf grep 2>/dev/null
+		grep test 'quoted text' "$@" printf grep
+test readonly $(pwd) x=1 | readonly printf "$@" readonly -eu && /usr/bin
+	x=1 -eu cd awk -eu x=1 printf $(pwd) awk
+test /usr/bin grep --verbose done "$@"
+	| /usr/bin sed "$@" echo 'quoted text' -eu $(pwd) cd done $(pwd) && sed
+		awk printf 2>/dev/null grep printf /usr/bin && readonly printf test $(pwd) 2>/dev/null
+		cd export "$1" echo export 'quoted text' grep "$@" export readonly &&
+readonly cd | && -eu grep 'quoted text' readonly "$@" x=1
+then readonly "$1" $(pwd) $(pwd) && cd --verbose "$@" printf
+grep && $(pwd) | "$1" readonly ${HOME}
+	then local then --verbose export 'quoted text' "$1" grep local "$1" local --verbose
+		done then | test 2>/dev/null grep && /usr/bin && done then 'quoted text'
+"$1" && "$@" | then cd awk awk grep x=1 grep grep x=1 grep "$@" sed export
+		"$@" printf printf 2>/dev/null
+	x=1 echo local echo $(pwd) x=1
+	cd then done | then export then $(pwd) local then
+"$1" cd ${HOME} ${HOME} sed $(pwd) /usr/bin awk
+		"$1" 2>/dev/null echo done ${HOME}
+	sed 'quoted text' grep && "$1" $(pwd) test ${HOME} test
+		'quoted text' cd cd echo | awk local readonly test done "$1" awk | grep "$1"
+	local 'quoted text' $(pwd)
+	$(pwd) grep x=1 sed $(pwd) | 2>/dev/null export && then readonly
+done 'quoted text' cd printf export 'quoted text' awk "$@"
+export printf local awk printf 'quoted text' awk
+cd local then "$@" --verbose then "$@" done --verbose readonly /usr/bin ${HOME}
+/usr/bin awk /usr/bin --verbose local echo
+		sed printf /usr/bin grep awk ${HOME}
+		local 2>/dev/null awk "$1" && x=1 /usr/bin ${HOME}
+echo "$1" ${HOME} 'quoted text'
+	"$1" done "$1" readonly grep 'quoted text'
+cd awk 'quoted text' echo sed "$1" test $(pwd)
+		"$1" 'quoted text' sed then | && export /usr/bin x=1 then -eu local "$@" awk
+	done echo --verbose "$1" printf ${HOME} 2>/dev/null 'quoted text' 2>/dev/null |
+	cd $(pwd) awk grep grep cd readonly grep readonly
+/usr/bin 2>/dev/null -eu test
+		local printf awk printf echo awk
+sed local grep readonly cd && x=1 echo
+		"$1" grep $(pwd) 'quoted text' awk cd "$1" cd cd /usr/bin
+	x=1 ${HOME} test | 2>/dev/null awk 2>/dev/null && printf readonly 'quoted text'
+		${HOME} "$@" /usr/bin --verbose | then test echo /usr/bin "$@" | local sed
+	-eu /usr/bin | done echo -eu ${HOME} done local "$1" sed echo echo printf "$@"
+	readonly echo ${HOME} readonly | --verbose printf
+&& /usr/bin && -eu sed x=1 cd -eu then x=1 /usr/bin --verbose
+${HOME} printf 2>/dev/null printf && /usr/bin
+	&& --verbose then readonly | 'quoted text' --verbose then ${HOME} ${HOME} && grep
+	sed export "$@" ${HOME} awk /usr/bin $(pwd) "$@" sed /usr/bin -eu
+	$(pwd) --verbose echo readonly
+then --verbose x=1 /usr/bin readonly done done "$1" sed test /usr/bin
+	export x=1 /usr/bin "$1" && awk then local x=1 2>/dev/null grep
+		'quoted text' /usr/bin test "$1" ${HOME}
+--verbose echo grep local --verbose
+		export --verbose done 'quoted text' done /usr/bin local && x=1 awk -eu x=1 'quoted text'
+		'quoted text' --verbose | awk $(pwd) "$1" then 2>/dev/null local
+-eu "$@" printf done then cd
+		grep 2>/dev/null /usr/bin "$@" $(pwd) readonly test cd cd && awk --verbose 2>/dev/null
+readonly x=1 echo ${HOME}
+	printf "$1" then printf sed grep then 'quoted text' "$@" grep "$@" && printf
+	sed export printf export sed x=1 echo local x=1 --verbose
+		printf && -eu ${HOME} "$1" -eu
+	$(pwd) x=1 local cd grep -eu && grep sed echo ${HOME} | 2>/dev/null 'quoted text'
+		-eu printf readonly then
+sed grep "$1" | -eu grep 2>/dev/null $(pwd) then /usr/bin export
+		echo cd && test && x=1 -eu x=1 "$1" | awk -eu cd | readonly
+		| /usr/bin && test test && $(pwd) 2>/dev/null
+		&& echo awk cd -eu 'quoted text' ${HOME} 2>/dev/null 2>/dev/null
+		echo echo then ${HOME} /usr/bin -eu "$@" export printf x=1 awk sed
+		local local printf test ${HOME} --verbose && "$1" sed
+	echo /usr/bin then grep test "$1" $(pwd) local && test printf "$1"
+${HOME} then /usr/bin | echo -eu then -eu printf --verbose grep
+	&& 2>/dev/null "$@" /usr/bin sed --verbose /usr/bin "$@" x=1 local | test local
+		/usr/bin sed grep readonly echo
+test export -eu readonly cd done echo /usr/bin test awk cd /usr/bin
+		readonly local export "$1" export local awk x=1 then awk awk "$1" "$@" &&
+	"$@" 2>/dev/null readonly sed export printf 'quoted text'
+/usr/bin $(pwd) export awk 'quoted text' "$1" "$@" 2>/dev/null x=1 "$@" awk done
+		printf 'quoted text' | x=1 export -eu "$@" -eu $(pwd) "$1"
+	readonly printf readonly "$@" printf grep
+		cd ${HOME} /usr/bin printf -eu
+		&& readonly cd 'quoted text' ${HOME} $(pwd) /usr/bin
+		2>/dev/null readonly "$1" export done $(pwd) ${HOME} printf $(pwd)
+"$@" $(pwd) ${HOME} readonly ${HOME}
+grep ${HOME} local && local test
+	cd echo "$1" echo cd readonly "$1" | 2>/dev/null
+	awk awk $(pwd) done grep printf /usr/bin
+done echo /usr/bin && done awk 'quoted text' && "$@" /usr/bin
+	done --verbose x=1 "$@" "$1" -eu 'quoted text' 2>/dev/null export test
+	cd -eu $(pwd) cd 2>/dev/null
+awk then "$1" done "$@" cd --verbose | x=1 --verbose
+echo x=1 | ${HOME} 2>/dev/null 2>/dev/null "$1" |
+		/usr/bin then "$@" printf "$1" | awk done ${HOME}
+echo x=1 ${HOME} grep 2>/dev/null && x=1 --verbose then grep x=1 /usr/bin
+		&& && && readonly printf "$1" export 'quoted text' then printf export --verbose
+		${HOME} test "$@" "$1" echo printf /usr/bin --verbose
+	-eu awk 2>/dev/null | 2>/dev/null export ${HOME}
+${HOME} test awk export local local x=1 export $(pwd) echo done cd 'quoted text'
+		grep --verbose -eu readonly done /usr/bin grep -eu grep $(pwd) && printf
+		cd x=1 "$@" --verbose sed | ${HOME}
+	printf 2>/dev/null /usr/bin | /usr/bin awk | printf export
+		"$1" $(pwd) then | grep
+then done 2>/dev/null printf local readonly x=1 /usr/bin 2>/dev/null
+printf cd --verbose cd then 'quoted text'
+$(pwd) test awk 2>/dev/null "$@"
+x=1 awk /usr/bin echo 2>/dev/null | ${HOME} "$@" $(pwd) local --verbose "$@"
+		"$1" | grep done readonly ${HOME} awk "$1" "$1" 2>/dev/null
+	/usr/bin --verbose awk export awk grep export
+	cd test $(pwd) --verbose --verbose readonly x=1 ${HOME} 2>/dev/null echo -eu
+		2>/dev/null && "$@" -eu printf 2>/dev/null
+	grep local test readonly cd 2>/dev/null "$1" "$1" then && x=1 -eu
+		printf $(pwd) sed 'quoted text' then /usr/bin export readonly 'quoted text'
+		--verbose -eu -eu x=1 export sed sed
+		| 2>/dev/null -eu 'quoted text' "$@" -eu local
+		printf done $(pwd) awk 2>/dev/null "$1" ${HOME} --verbose local
+${HOME} -eu export local
+		/usr/bin grep local done "$@"
+	readonly x=1 echo 2>/dev/null --verbose readonly awk then $(pwd) export awk
+test && /usr/bin -eu test x=1 && 2>/dev/null local sed local cd
+		-eu | -eu printf -eu grep && cd grep 2>/dev/null local then x=1
+echo /usr/bin test ${HOME} --verbose local
+		then sed local "$@" -eu echo readonly | local 'quoted text' grep echo awk
+		/usr/bin readonly -eu ${HOME} export then --verbose done -eu |
+printf awk x=1 | x=1 local --verbose x=1 cd test && -eu /usr/bin
+awk export local | local
+	cd && x=1 $(pwd) cd cd 2>/dev/null 2>/dev/null printf ${HOME}
+printf | -eu sed -eu "$@" export test awk done local && 2>/dev/null
+	"$@" readonly "$1" done grep cd $(pwd)
+sed "$@" 'quoted text' | sed ${HOME} x=1 $(pwd)
+then export $(pwd) -eu grep ${HOME} x=1 then grep $(pwd) printf
+	done "$@" /usr/bin awk 'quoted text'
+--verbose sed local x=1 --verbose sed 2>/dev/null |
+	--verbose local export --verbose
+--verbose then awk echo x=1 echo -eu /usr/bin readonly -eu
+export 'quoted text' 2>/dev/null ${HOME} "$1" export grep printf sed printf
+		awk grep && "$@" grep awk "$@" local
+	cd "$1" ${HOME} "$@" export done test $(pwd) awk $(pwd) /usr/bin
+	x=1 echo 'quoted text' done 'quoted text' test done grep | echo printf --verbose
+x=1 done x=1 echo export grep --verbose
+| x=1 'quoted text' | done
+'quoted text' "$@" "$@" 'quoted text' "$@" export test -eu x=1 local then sed
+sed "$1" "$1" printf --verbose -eu
+		"$@" /usr/bin -eu awk then x=1 ${HOME} local echo /usr/bin
+&& && | echo cd | sed ${HOME} printf 2>/dev/null
+		$(pwd) && 2>/dev/null awk cd | ${HOME} -eu grep
+$(pwd) cd 'quoted text' $(pwd) export sed
+		$(pwd) readonly x=1 $(pwd) readonly export done
+		export /usr/bin && local printf echo 2>/dev/null test /usr/bin
+		"$@" export && $(pwd) "$@" -eu awk x=1 "$1" awk echo $(pwd) done "$1"
+	/usr/bin | echo --verbose echo local
+	readonly sed --verbose test sed /usr/bin "$@" done "$1" cd readonly &&
+	local && cd local echo done echo sed awk x=1 && x=1 "$@" ${HOME}
+		grep | done printf 'quoted text'
+	cd "$1" 'quoted text' then "$1" "$@" export sed readonly printf
+		printf 2>/dev/null cd grep ${HOME} echo local local && ${HOME} && ${HOME}
+/usr/bin "$1" echo awk test && printf awk test sed && test
+		export ${HOME} then readonly x=1 sed then "$@"
+"$1" x=1 --verbose local readonly --verbose done export grep test 'quoted text'
+export printf awk "$1" 2>/dev/null
+	/usr/bin --verbose "$1" "$@" x=1 -eu cd ${HOME}
+'quoted text' "$1" printf printf sed x=1 && --verbose x=1 | local cd
+&& -eu echo /usr/bin printf awk 2>/dev/null then
+	sed local printf | && then grep | sed readonly done then test printf test x=1
+readonly printf -eu echo done export --verbose cd sed x=1
+		readonly printf grep done 2>/dev/null x=1
+${HOME} test x=1 && awk then x=1 2>/dev/null export ${HOME} echo export
+		-eu "$1" printf "$1" readonly | ${HOME} | -eu grep sed "$@"
+		export | | awk -eu x=1 2>/dev/null "$1" echo
+	x=1 printf sed then export local export printf echo
+		2>/dev/null echo --verbose test | && -eu "$1" -eu readonly readonly "$@" local
+	--verbose 'quoted text' readonly echo awk done -eu 'quoted text'
+printf x=1 ${HOME} cd ${HOME}
+	-eu export local export readonly
+	echo done awk readonly local /usr/bin sed --verbose
+	echo printf $(pwd) ${HOME} 2>/dev/null |
+"$@" ${HOME} then done --verbose local awk "$@" 2>/dev/null ${HOME} && | --verbose
+	| /usr/bin "$1" "$@" local local test $(pwd) 2>/dev/null |
+	test x=1 awk && test $(pwd) local 'quoted text' "$1"
+	"$1" cd cd echo /usr/bin $(pwd) -eu cd $(pwd) x=1 | --verbose
+		grep printf | /usr/bin x=1 awk then -eu
+		printf done test ${HOME} grep ${HOME} test | /usr/bin "$@" "$1" awk echo
+		sed 'quoted text' | test local
+cd printf test done printf
+		cd --verbose printf export export done printf "$@" local $(pwd)
+	--verbose --verbose "$@" "$@" | export
+x=1 -eu printf readonly --verbose -eu ${HOME}
+		| local --verbose "$1" && printf "$@" printf --verbose test "$1" awk
+	"$1" x=1 test readonly && x=1 && awk local -eu echo readonly
+test test done && echo $(pwd) $(pwd) /usr/bin cd readonly $(pwd) && 2>/dev/null
+	"$1" | local "$1" 'quoted text' &&
+/usr/bin 'quoted text' done awk | cd echo && ${HOME} done | printf "$@"
+	&& "$@" printf readonly then $(pwd) export "$@" -eu cd done done cd /usr/bin
+awk then | test x=1 local /usr/bin export 2>/dev/null done x=1 2>/dev/null &&
+		x=1 x=1 -eu /usr/bin 'quoted text'
+done 2>/dev/null done $(pwd) done "$1"
+| -eu sed printf grep && 'quoted text' x=1 cd
+local ${HOME} then export then "$1" /usr/bin readonly test x=1 sed done printf
+		done readonly && export
+x=1 ${HOME} -eu sed $(pwd) -eu done $(pwd) cd readonly
+		readonly "$1" x=1 "$@" /usr/bin /usr/bin test
+${HOME} done --verbose -eu export
+	x=1 /usr/bin $(pwd) export test --verbose && --verbose && "$1" ${HOME}
+		--verbose "$@" ${HOME} --verbose readonly awk readonly export printf then |
+local 2>/dev/null echo cd $(pwd) $(pwd) "$@" /usr/bin test x=1
+		x=1 export sed local ${HOME} "$1" sed
+local ${HOME} x=1 readonly | | readonly export awk test
+then grep export done
+	'quoted text' grep x=1 export
+		| echo ${HOME} done grep cd readonly
+	echo | grep "$1" | echo sed local printf x=1 grep
+	-eu then "$1" ${HOME} /usr/bin --verbose readonly
+		${HOME} readonly awk ${HOME} export
+		then then ${HOME} "$@" $(pwd) local then | readonly export awk
+		export x=1 awk echo echo -eu | /usr/bin
+local local export then 'quoted text'
+	echo local $(pwd) ${HOME} 'quoted text'
+	printf --verbose test awk grep
+		local echo && $(pwd) echo 'quoted text' export export $(pwd)
+	awk -eu awk done sed 2>/dev/null "$@" sed -eu $(pwd)
+done grep ${HOME} awk sed export "$@" sed | export
+echo -eu local cd -eu sed echo
+	export local 2>/dev/null awk x=1 /usr/bin
+		&& sed | ${HOME} && "$1" export /usr/bin done grep awk
+		--verbose ${HOME} "$1" local awk then
+	x=1 'quoted text' && --verbose
+	${HOME} test then "$@" -eu awk
+${HOME} $(pwd) --verbose
+	done then then done readonly | | export test readonly ${HOME} printf $(pwd) readonly
+echo grep then readonly 'quoted text' x=1 sed test
+	| "$@" "$1" && x=1 done $(pwd) $(pwd) cd -eu readonly
+	x=1 x=1 "$@" 2>/dev/null done "$@" printf grep awk grep "$@"
+		"$@" echo --verbose "$@" sed --verbose sed local && 2>/dev/null readonly
+		export --verbose echo readonly
+	"$@" | export /usr/bin /usr/bin ${HOME} grep export local --verbose echo awk 2>/dev/null
+		echo grep 2>/dev/null && -eu grep readonly test "$@" /usr/bin "$1"
+	then test 2>/dev/null
+	awk ${HOME} echo done /usr/bin
+&& sed then "$1" then cd test readonly
+	--verbose done "$1" then "$1" | cd cd --verbose
+	-eu /usr/bin ${HOME} "$1" cd echo sed 'quoted text' | 'quoted text'
+		awk grep /usr/bin /usr/bin printf local awk echo test printf grep 'quoted text'
+	export done export -eu local x=1 local && && 'quoted text' /usr/bin $(pwd) grep
+		x=1 export sed --verbose then local
+then /usr/bin x=1 sed "$1" "$1" /usr/bin printf --verbose cd readonly
+	x=1 /usr/bin echo x=1 "$1" --verbose echo x=1 "$1"
+	cd cd readonly awk printf done then sed local then "$1" 'quoted text'
+		&& 'quoted text' | local cd awk readonly export ${HOME} test /usr/bin
+	then "$@" local cd 2>/dev/null --verbose 2>/dev/null then 2>/dev/null /usr/bin
+	"$1" ${HOME} export sed -eu /usr/bin ${HOME} awk then grep then
+	$(pwd) $(pwd) 'quoted text' "$1" export local "$1" 'quoted text'
+"$@" test printf export cd echo local |
+		/usr/bin awk $(pwd) awk ${HOME} readonly x=1 -eu sed /usr/bin sed
+$(pwd) ${HOME} $(pwd) test grep grep | | ${HOME} then $(pwd) | readonly
+		readonly readonly local
+		grep cd awk export export
+	awk readonly awk -eu cd echo ${HOME} ${HOME} test "$@" | readonly 2>/dev/null
+	-eu $(pwd) test -eu export 'quoted text' sed printf --verbose
+	'quoted text' grep grep "$@"
+		local "$@" && export echo grep test grep cd "$1" done cd -eu -eu "$1"
+test x=1 ${HOME} -eu local "$@" "$1" echo | cd && printf "$1" awk ${HOME}
+	echo cd readonly export grep done
+	/usr/bin grep ${HOME} done x=1 export x=1 done "$@" "$1" done ${HOME}
+	echo sed cd -eu echo && /usr/bin export ${HOME} 2>/dev/null
+		printf ${HOME} | done export export /usr/bin 'quoted text'
+		&& grep sed awk ${HOME} -eu && readonly readonly export cd && sed "$1" |
+		awk $(pwd) printf --verbose | 'quoted text'
+	sed sed x=1 2>/dev/null export --verbose grep cd | $(pwd) "$1"
+		"$@" --verbose --verbose awk
+	/usr/bin -eu done cd --verbose x=1 local 'quoted text'
+$(pwd) done then test sed
+'quoted text' $(pwd) "$@" | ${HOME} x=1 --verbose -eu
+		x=1 2>/dev/null test test local "$1" 'quoted text' local 'quoted text' && | |
+		/usr/bin "$1" local done readonly awk
+| x=1 cd 2>/dev/null echo cd readonly 'quoted text' $(pwd) test
+	echo --verbose 'quoted text'
+| readonly printf 'quoted text'
+printf ${HOME} grep grep --verbose printf
+		local 2>/dev/null $(pwd)
+		readonly grep export echo /usr/bin grep 'quoted text' readonly "$@" then 'quoted text'
+		| local -eu | done 2>/dev/null x=1 2>/dev/null x=1 -eu echo x=1 export
+		&& --verbose x=1 then test grep grep test 'quoted text' ${HOME} "$1"
+	${HOME} ${HOME} /usr/bin | printf readonly cd readonly "$@" printf readonly
+		| cd export readonly local 2>/dev/null $(pwd) printf 'quoted text'
+		| readonly done export done | && | "$1" && ${HOME} "$1" --verbose "$1" done sed
+	| printf then 2>/dev/null echo printf readonly ${HOME} then x=1 cd "$1" /usr/bin
+	sed 'quoted text' "$1" local "$1" export
+	| 'quoted text' sed echo sed
+test done 2>/dev/null echo "$@" 2>/dev/null readonly -eu 'quoted text' then
+'quoted text' test cd done 'quoted text' cd
+		test grep then $(pwd) 'quoted text' /usr/bin /usr/bin
+&& && local 2>/dev/null done export | "$@" &&
+done && --verbose done -eu grep
+		echo cd --verbose /usr/bin x=1 sed x=1 cd then test /usr/bin
+	'quoted text' export x=1 echo ${HOME} --verbose
+${HOME} --verbose done sed 2>/dev/null -eu
+	/usr/bin /usr/bin then | cd test done cd 'quoted text' done
+	grep cd && awk && ${HOME} then printf -eu
+/usr/bin --verbose --verbose $(pwd) x=1 echo then | $(pwd)
+'quoted text' "$@" local "$@" 'quoted text'
+2>/dev/null 2>/dev/null then
+-eu test grep /usr/bin ${HOME} --verbose 'quoted text'
+	${HOME} 2>/dev/null grep 2>/dev/null export local readonly 'quoted text'
+echo /usr/bin "$1" $(pwd) printf done | awk 'quoted text'
+'quoted text' printf export cd 'quoted text' sed echo readonly echo /usr/bin
+	echo grep test ${HOME} readonly done 2>/dev/null echo -eu 2>/dev/null printf
+2>/dev/null --verbose | printf echo
+	2>/dev/null awk --verbose "$1" | --verbose readonly /usr/bin
+	sed export && --verbose "$@" then --verbose grep /usr/bin export awk then
+		readonly done export echo 'quoted text' grep grep -eu local sed export
+local export readonly test "$@" sed 2>/dev/null 2>/dev/null
+		"$@" | sed cd cd "$@" $(pwd)
+export grep "$1" x=1 then echo && grep cd test readonly export /usr/bin
+-eu x=1 /usr/bin then readonly readonly
+${HOME} && sed 'quoted text' && local cd test readonly "$@"
+		done cd printf "$@" 2>/dev/null local | ${HOME}
+awk readonly readonly test /usr/bin printf ${HOME} export | 'quoted text'
+export readonly awk 2>/dev/null | 2>/dev/null cd echo then local
+	readonly x=1 /usr/bin printf done && done $(pwd) /usr/bin
+		x=1 cd ${HOME} cd /usr/bin sed echo | ${HOME} --verbose -eu
+local printf sed -eu grep x=1 awk $(pwd) local -eu | test printf done | grep
+echo /usr/bin --verbose cd /usr/bin test /usr/bin readonly 2>/dev/null
+&& && done "$1" test done awk "$@" then --verbose awk
+	cd ${HOME} export $(pwd) "$1" awk test "$1" "$@" local sed $(pwd) local && local
+		x=1 awk --verbose /usr/bin export
+	test /usr/bin /usr/bin -eu local
+	local cd && -eu --verbose && 2>/dev/null sed &&
+	readonly --verbose cd | readonly "$@"
+		2>/dev/null "$1" -eu awk && ${HOME} && grep done sed
+	printf ${HOME} grep x=1 sed awk awk $(pwd) test "$@" $(pwd) then $(pwd)
+cd readonly export readonly 2>/dev/null readonly |
+	"$1" x=1 awk sed | --verbose && done ${HOME} 'quoted text'
+	cd x=1 test readonly awk then
+		/usr/bin $(pwd) test 2>/dev/null sed sed $(pwd) echo
+		/usr/bin $(pwd) 2>/dev/null $(pwd) local export readonly $(pwd) $(pwd) printf
+	/usr/bin "$@" | done 2>/dev/null ${HOME} done ${HOME} local ${HOME} | ${HOME}
+'quoted text' echo cd then ${HOME} grep && &&
+		awk /usr/bin $(pwd) cd printf && test awk echo && -eu
+done 2>/dev/null printf x=1 done export /usr/bin | /usr/bin
+	readonly readonly local awk $(pwd) sed sed $(pwd) "$1" 'quoted text'
+	2>/dev/null done "$1" readonly cd 2>/dev/null 'quoted text' export awk --verbose
+export -eu local --verbose && grep "$@" ${HOME} 2>/dev/null
+		export x=1 "$1" echo && cd done /usr/bin 2>/dev/null -eu 'quoted text'
+	readonly 2>/dev/null echo readonly 2>/dev/null export readonly
@@ -0,0 +1,2001 @@
+		'quoted text' done echo && /usr/bin local echo test | 'quoted text'
+	local test /usr/bin export
+		"$1" --verbose --verbose --verbose | grep /usr/bin -eu
+	"$1" 2>/dev/null test local local && "$@" ${HOME} x=1 && echo "$@" local "$@" $(pwd)
+		echo ${HOME} test export x=1 $(pwd) | export
+	2>/dev/null awk --verbose grep export then ${HOME} -eu then
+		grep && --verbose -eu echo then then echo awk grep ${HOME} then | test then
+printf readonly /usr/bin test awk then
+		--verbose grep then ${HOME} sed $(pwd) echo "$1"
+		done 2>/dev/null ${HOME} ${HOME} 'quoted text'
+cd then /usr/bin /usr/bin
+		grep sed export 2>/dev/null
+		readonly printf echo cd && | cd done done x=1 cd | done test $(pwd) | --verbose
+		done done --verbose ${HOME} x=1 readonly /usr/bin "$1" --verbose
+	$(pwd) done echo awk -eu -eu readonly done 2>/dev/null -eu
+		grep -eu --verbose done "$@" sed x=1 echo /usr/bin
+		"$@" sed 'quoted text' "$1"
+x=1 cd then x=1 awk awk cd "$@" test done "$1" x=1 && readonly ${HOME}
+cd x=1 export "$@" 'quoted text' readonly
+readonly "$@" test x=1 $(pwd) 'quoted text' then --verbose export
+"$1" /usr/bin local "$@" | x=1
+	"$@" $(pwd) readonly --verbose then done local
+'quoted text' grep "$@" "$1"
+"$1" echo export 'quoted text'
+	"$1" | test ${HOME} echo /usr/bin readonly "$@"
+${HOME} 'quoted text' | /usr/bin x=1 test readonly
+	then readonly "$@" && export ${HOME} echo export echo 'quoted text' 2>/dev/null
+		test then echo grep readonly awk awk -eu | local
+"$1" done readonly x=1 x=1
+		echo echo awk echo awk 2>/dev/null x=1 grep ${HOME} then | | test sed then
+	done ${HOME} printf /usr/bin echo
+		awk echo readonly cd done --verbose "$@" printf
+		sed then awk export "$1" sed
+		&& grep --verbose -eu cd grep $(pwd) sed
+readonly test && readonly -eu export local printf $(pwd) export "$@" "$1"
+printf grep "$1" "$1" -eu && export
+	${HOME} awk --verbose ${HOME} "$@" readonly
+/usr/bin readonly "$@" "$1" export
+		printf "$1" then echo readonly | ${HOME} ${HOME} cd cd "$1" ${HOME} sed /usr/bin
+		"$@" /usr/bin | 2>/dev/null --verbose --verbose then
+		export 2>/dev/null && echo test /usr/bin ${HOME} cd ${HOME} readonly
+	local -eu && export sed /usr/bin "$1"
+		2>/dev/null readonly test cd | sed readonly cd
+	cd awk then ${HOME} printf /usr/bin awk awk ${HOME} $(pwd) --verbose
+		awk echo 'quoted text' echo $(pwd) "$1"
+		/usr/bin 'quoted text' test readonly printf printf "$@" 'quoted text'
+		export grep "$1" 2>/dev/null
+test /usr/bin awk && readonly /usr/bin done
+	grep printf export echo readonly 2>/dev/null
+		x=1 ${HOME} local readonly
+		local local "$1" 'quoted text' echo sed readonly export
+cd printf test x=1 done -eu local ${HOME} $(pwd)
+		--verbose $(pwd) ${HOME} readonly printf local ${HOME} local readonly export $(pwd)
+	local sed && "$@" -eu && | local
+2>/dev/null "$1" awk -eu x=1 /usr/bin
+"$@" $(pwd) "$@" export 2>/dev/null awk local echo ${HOME}
+		echo --verbose export 2>/dev/null 'quoted text' /usr/bin "$1" echo then "$@" -eu
+		${HOME} /usr/bin export --verbose cd
+	grep ${HOME} grep echo test echo
+		2>/dev/null 2>/dev/null sed "$@" local
+	${HOME} "$1" -eu && export
+		-eu "$@" printf cd -eu done | readonly local
+/usr/bin done test "$1" readonly "$1" local x=1 /usr/bin
+${HOME} awk cd $(pwd) sed sed 2>/dev/null $(pwd)
+	'quoted text' cd printf then local
+	x=1 printf test x=1 readonly
+then local grep 'quoted text' $(pwd) |
+	local -eu grep 2>/dev/null && local echo 'quoted text' sed
+		readonly cd -eu "$@" done 'quoted text' echo echo grep cd && /usr/bin
+local && done awk x=1 x=1 x=1 "$@" 'quoted text' grep grep x=1 then test
+echo x=1 cd $(pwd) 2>/dev/null
+-eu $(pwd) printf printf local ${HOME} awk $(pwd) grep
+	test done sed --verbose sed then grep local --verbose "$@"
+then export sed awk echo readonly && -eu local awk 'quoted text'
+	-eu awk && -eu 2>/dev/null printf -eu local done && printf readonly --verbose
+2>/dev/null | printf /usr/bin grep -eu &&
+done "$@" /usr/bin printf /usr/bin awk echo 'quoted text'
+	export /usr/bin /usr/bin -eu 'quoted text' && then cd --verbose -eu grep --verbose
+		grep readonly grep $(pwd) then export "$@" 'quoted text' echo | local local
+	awk readonly local local awk 2>/dev/null awk printf then
+		then then 'quoted text' --verbose 2>/dev/null --verbose $(pwd) test "$@" echo awk
+		x=1 x=1 "$@" --verbose ${HOME} "$@" sed awk local ${HOME}
+		&& -eu --verbose readonly local --verbose "$@"
+${HOME} test && export echo test && printf readonly /usr/bin done
+then done x=1 && --verbose ${HOME} printf | "$1" cd then then readonly --verbose
+done | readonly sed && | && --verbose
+local ${HOME} -eu 2>/dev/null 'quoted text'
+		--verbose /usr/bin --verbose cd 'quoted text'
+done $(pwd) 2>/dev/null awk "$1" printf then then
+then | grep local "$@"
+x=1 grep cd -eu test echo grep echo readonly local | 'quoted text' echo
+	&& | then test echo "$1" --verbose -eu
+	test 2>/dev/null $(pwd) export cd sed sed export local cd sed readonly
+		local && readonly "$@" ${HOME} -eu "$@" | local ${HOME} /usr/bin
+	then printf "$@" test readonly awk -eu printf local
+printf --verbose | done readonly
+	cd 'quoted text' "$@" echo
+test 2>/dev/null && --verbose local && && $(pwd) test cd then awk "$1" 'quoted text'
+	sed grep cd 'quoted text' 2>/dev/null local
+		echo -eu "$@" export export grep grep then grep then local 'quoted text'
+		-eu 'quoted text' --verbose 'quoted text' "$1" local local readonly x=1
+	--verbose && printf cd readonly 2>/dev/null readonly | sed | cd | "$1"
+	echo | test awk -eu 'quoted text' -eu printf local 'quoted text' &&
+		"$1" "$@" printf | sed x=1
+		export grep "$1" x=1 then --verbose awk x=1 sed -eu $(pwd) export
+		readonly x=1 | 2>/dev/null printf "$1" /usr/bin
+$(pwd) && awk --verbose /usr/bin $(pwd) done grep "$1" &&
+		done then x=1 readonly then $(pwd) && 'quoted text' done "$@" then grep
+	${HOME} ${HOME} /usr/bin printf export "$1" test grep -eu local && 'quoted text'
+grep "$@" done /usr/bin
+		x=1 sed grep awk then 'quoted text' | ${HOME} done done sed awk
+	echo readonly 'quoted text' && local
+grep readonly awk "$1" test -eu && -eu 2>/dev/null /usr/bin
+		grep then && echo 2>/dev/null test ${HOME} "$@" sed "$@"
+	then test grep readonly local 'quoted text' cd echo echo echo "$@"
+		x=1 'quoted text' 'quoted text' awk test
+		'quoted text' cd $(pwd) cd /usr/bin &&
+	x=1 x=1 cd local && test x=1 echo sed echo "$@" sed --verbose -eu readonly "$1"
+--verbose done local "$@" cd test done | ${HOME} cd done | cd
+		-eu readonly 'quoted text' x=1 echo | && && "$@" export
+		-eu | cd awk x=1 test done echo --verbose
+	x=1 readonly done readonly "$@" printf
+		--verbose grep sed grep && "$@" $(pwd) | --verbose then
+		then ${HOME} /usr/bin $(pwd) "$@" done awk cd 2>/dev/null --verbose
+		--verbose done | awk local "$@"
+	awk | 2>/dev/null cd "$@" then done /usr/bin
+		readonly test printf x=1 ${HOME} "$@" "$1" sed 'quoted text'
+	readonly /usr/bin -eu 'quoted text' echo && | ${HOME} then -eu
+	readonly done -eu /usr/bin cd sed export readonly
+		echo $(pwd) --verbose 2>/dev/null
+	done $(pwd) cd cd printf export && cd printf
+		"$@" x=1 awk && echo && /usr/bin 'quoted text' "$@" printf "$1" "$@"
+		x=1 2>/dev/null export x=1 'quoted text' printf "$1" | grep
+		| ${HOME} local && echo --verbose | echo -eu 2>/dev/null x=1 readonly
+	export 2>/dev/null done --verbose /usr/bin
+done awk grep echo readonly readonly -eu | ${HOME} 'quoted text'
+	test | local grep readonly /usr/bin 'quoted text' local test x=1 export
+		/usr/bin $(pwd) $(pwd) /usr/bin
+	local && local --verbose cd ${HOME} | then $(pwd)
+	printf sed local test awk printf local
+	readonly -eu local -eu cd "$@" 'quoted text'
+	&& cd readonly "$1" && local --verbose awk -eu then x=1 sed then export
+		export done --verbose "$@" 2>/dev/null
+		2>/dev/null printf && --verbose then -eu
+--verbose | sed readonly ${HOME} echo local "$@"
+		'quoted text' && readonly local export sed | 'quoted text'
+-eu awk "$1" /usr/bin test readonly cd | done grep x=1 echo then 2>/dev/null
+&& done 'quoted text' sed sed then sed local 2>/dev/null awk /usr/bin
+printf $(pwd) done then then /usr/bin
+	x=1 $(pwd) sed x=1 local
+done "$1" /usr/bin -eu awk --verbose $(pwd)
+sed "$1" awk sed test readonly 2>/dev/null cd
+		then --verbose echo test "$1" readonly awk /usr/bin -eu grep printf done
+		"$@" readonly echo && --verbose -eu printf local | sed $(pwd) sed
+&& test done awk local awk x=1
+		printf export /usr/bin ${HOME} && | then "$1" 'quoted text'
+readonly && "$@" done --verbose 2>/dev/null "$1" | --verbose
+		&& && printf "$1" ${HOME}
+	"$@" test test test sed readonly x=1 | --verbose sed local -eu 'quoted text'
+	x=1 printf "$1" $(pwd) "$1"
+	readonly local | local readonly $(pwd)
+local ${HOME} -eu then -eu awk test "$1" "$@" test export printf grep && |
+	export sed && sed then then "$@" local "$@" | readonly 'quoted text' then test readonly
+		&& local "$@" "$1" local
+		"$1" then local echo 'quoted text' export x=1 | done && $(pwd) -eu readonly
+		${HOME} then done readonly -eu x=1 -eu test done "$1"
+printf readonly then ${HOME} -eu readonly $(pwd) --verbose $(pwd) -eu
+-eu awk grep grep && 2>/dev/null
+		grep "$1" test | 'quoted text' sed | --verbose
+	grep printf 'quoted text' -eu --verbose 'quoted text' 2>/dev/null
+	--verbose test then $(pwd)
+	echo export test x=1 "$@" $(pwd) then printf -eu ${HOME} local
+awk /usr/bin done cd test local
+echo /usr/bin && local readonly "$@" sed cd then && printf -eu 'quoted text'
+		| echo && sed /usr/bin local
+	x=1 "$1" then done "$1" local test $(pwd) && 'quoted text'
+	cd local /usr/bin cd $(pwd) awk export grep $(pwd) grep local
+${HOME} sed export "$@" "$1"
+	test local && /usr/bin local 'quoted text' && ${HOME}
+		&& -eu local echo grep && "$1" printf
+"$@" printf ${HOME} x=1 echo ${HOME} 'quoted text'
+	| /usr/bin done readonly test
+awk 'quoted text' && 'quoted text' --verbose then 'quoted text'
+	readonly "$@" echo 2>/dev/null awk "$@" | done $(pwd) 'quoted text'
+		-eu /usr/bin cd --verbose export test grep x=1 then
+	-eu 'quoted text' cd echo awk 'quoted text' echo | test "$1" ${HOME} local x=1 ${HOME}
+	2>/dev/null printf cd
+		echo "$@" export 2>/dev/null local sed | then test export --verbose
+	readonly echo | export --verbose
+	done sed local awk -eu cd local && readonly -eu ${HOME} export
+		cd "$1" awk x=1 ${HOME} test x=1 x=1 2>/dev/null
+		-eu export x=1 "$@" local ${HOME} local "$1" grep /usr/bin
+	cd | -eu 'quoted text'
+	test /usr/bin --verbose --verbose
+| export -eu 2>/dev/null
+	export "$1" grep sed -eu -eu $(pwd) x=1 $(pwd) && --verbose --verbose &&
+		local export sed && /usr/bin printf export local printf x=1
+	export cd done "$1" --verbose done x=1 x=1 && echo 'quoted text'
+x=1 sed | printf ${HOME} /usr/bin done awk 2>/dev/null | | awk grep -eu /usr/bin
+cd local "$1" export "$1"
+		echo done echo readonly ${HOME} then export sed && ${HOME} readonly echo 'quoted text'
+--verbose readonly local ${HOME} "$1" 'quoted text' "$1" /usr/bin
+		| "$@" 2>/dev/null cd echo printf ${HOME} ${HOME} 2>/dev/null
+	then done local cd done x=1 test sed 2>/dev/null -eu x=1 --verbose
+		/usr/bin cd "$@" done 2>/dev/null "$@"
+	readonly && done awk | x=1 x=1 export | echo | test local "$1"
+done cd then "$1" -eu /usr/bin printf /usr/bin test "$1" grep
+	awk local /usr/bin cd export echo grep 2>/dev/null
+echo --verbose "$1" 'quoted text' readonly 2>/dev/null
+"$@" awk awk | test /usr/bin /usr/bin readonly x=1 grep done x=1 "$1" then ${HOME}
+		2>/dev/null ${HOME} printf "$1" "$1" && test then test
+	echo --verbose test then local | $(pwd) done 'quoted text'
+	x=1 | --verbose echo printf "$1" grep awk /usr/bin export
+x=1 'quoted text' $(pwd) awk readonly | "$1" /usr/bin echo sed test 2>/dev/null
+"$1" local awk x=1 grep && sed echo cd | x=1 grep sed x=1 then $(pwd)
+"$1" cd done /usr/bin 'quoted text' done -eu "$@" test grep
+grep 2>/dev/null && sed
+	done local awk -eu then local 'quoted text' x=1 awk grep cd awk cd echo
+	$(pwd) sed sed sed grep export 'quoted text'
+	local readonly grep cd grep /usr/bin
+	/usr/bin echo && "$@" readonly done done then
+		&& | test then "$1" --verbose test 'quoted text' "$1" local
+test local printf cd cd
+	echo cd test awk done ${HOME} export echo --verbose ${HOME} /usr/bin
+		grep cd ${HOME} done test
+	--verbose local "$@" cd local grep -eu export --verbose ${HOME}
+		'quoted text' grep x=1 done sed printf echo local
+	echo | $(pwd) test done /usr/bin grep /usr/bin
+	echo echo export /usr/bin x=1 echo echo 2>/dev/null "$@" && | && 2>/dev/null
+'quoted text' readonly /usr/bin cd readonly cd
+echo && sed | grep $(pwd) /usr/bin local grep echo sed --verbose
+	local done /usr/bin 2>/dev/null then test
+	--verbose 'quoted text' awk && 'quoted text' sed
+grep readonly ${HOME} local 2>/dev/null export /usr/bin --verbose
+${HOME} cd x=1 'quoted text'
+	printf grep done then export echo readonly /usr/bin test
+	"$@" test $(pwd) local ${HOME} printf awk && 'quoted text' x=1 "$1" "$1" awk
+		printf | then sed export -eu cd readonly x=1 2>/dev/null "$@" export
+	--verbose then "$1" -eu then $(pwd) && awk readonly export ${HOME} awk readonly
+		"$1" "$1" export sed $(pwd) 2>/dev/null done /usr/bin local --verbose $(pwd) awk
+		done then then done /usr/bin
+	printf && ${HOME} local cd done --verbose sed then echo done test cd "$@" printf
+--verbose export "$@" test $(pwd) x=1 echo ${HOME} 'quoted text' "$1" --verbose
+	grep readonly test --verbose
+done 2>/dev/null 'quoted text' echo "$@" export export
+grep done 2>/dev/null "$1" x=1 cd done readonly printf done 2>/dev/null
+		&& echo export | 2>/dev/null "$1" && local $(pwd) 'quoted text' readonly /usr/bin
+		printf export ${HOME} export grep export | grep test "$@" ${HOME}
+test echo awk done /usr/bin
+		readonly printf $(pwd) printf cd
+		test -eu export /usr/bin 'quoted text' grep
+		sed export done readonly "$@" printf export --verbose && 'quoted text'
+		export 'quoted text' printf && /usr/bin $(pwd) echo "$@" echo
+$(pwd) --verbose "$1" ${HOME} "$@" "$@" x=1 && grep awk -eu then
+		then awk $(pwd) test awk test 'quoted text'
+awk export "$1" export echo
+| x=1 | export 'quoted text' "$1" /usr/bin awk /usr/bin x=1 test
+		$(pwd) "$1" ${HOME} local -eu export echo /usr/bin
+--verbose | $(pwd) done local && export echo cd local
+		cd "$1" local cd "$@" ${HOME}
+		done echo local "$@" then | awk grep /usr/bin --verbose $(pwd) cd grep
+	awk echo "$1" sed then awk grep
+	'quoted text' grep grep done sed awk ${HOME} grep && awk /usr/bin | /usr/bin
+printf printf $(pwd) cd
+grep printf then "$1" local
+/usr/bin /usr/bin --verbose $(pwd) echo grep 'quoted text' /usr/bin
+x=1 --verbose test test -eu "$1" | printf echo grep
+		printf "$1" 2>/dev/null local cd grep 2>/dev/null cd 2>/dev/null echo
+	$(pwd) | test "$@" grep readonly /usr/bin then && export --verbose ${HOME}
+	export printf 2>/dev/null -eu | test ${HOME}
+printf readonly -eu 'quoted text' printf 2>/dev/null | readonly export
+export /usr/bin && 'quoted text'
+		-eu cd awk && 'quoted text' $(pwd)
+		sed 2>/dev/null --verbose 2>/dev/null printf
+		then && cd readonly 2>/dev/null x=1 ${HOME} grep
+	$(pwd) $(pwd) printf /usr/bin sed printf | ${HOME} then done cd ${HOME} "$1"
+${HOME} export printf 2>/dev/null -eu local sed
+-eu | $(pwd) sed --verbose export $(pwd)
+		x=1 | --verbose printf 2>/dev/null
+	-eu $(pwd) awk /usr/bin x=1 2>/dev/null
+| echo && echo sed sed readonly printf --verbose -eu 'quoted text'
+	'quoted text' | cd echo x=1
+	--verbose /usr/bin "$1" cd && awk local 2>/dev/null "$@" 2>/dev/null
+	sed local grep ${HOME} test readonly -eu ${HOME}
+"$1" "$1" $(pwd) sed /usr/bin x=1 ${HOME} && sed test cd ${HOME} ${HOME}
+	awk sed $(pwd) readonly echo -eu test /usr/bin
+	2>/dev/null ${HOME} x=1 && printf "$1" echo awk $(pwd)
+	"$1" done 'quoted text' 'quoted text' echo --verbose cd 'quoted text'
+		export printf test awk "$1" 2>/dev/null
+grep printf "$@" test ${HOME}
+		&& --verbose "$@" readonly awk
+"$1" export ${HOME} sed 2>/dev/null -eu test test then grep | |
+local --verbose 2>/dev/null cd 'quoted text'
+test $(pwd) /usr/bin then | && $(pwd)
+		x=1 echo 2>/dev/null echo
+	x=1 'quoted text' awk x=1 | cd 2>/dev/null
+		cd cd cd 'quoted text' ${HOME} export "$1" then 'quoted text' cd cd grep
+-eu awk "$1" awk $(pwd) cd "$1"
+		| export printf done 2>/dev/null done --verbose echo ${HOME} 2>/dev/null
+	echo done awk then then local done | printf grep --verbose &&
+	x=1 then test && | test readonly
+&& "$@" grep awk echo --verbose x=1 /usr/bin
+		awk awk done then local --verbose then --verbose | printf "$@" sed grep 'quoted text'
+	x=1 local sed then export test then export | printf printf "$@" done echo -eu
+cd | then done && printf printf then test sed /usr/bin export grep "$1"
+"$@" "$1" "$1" readonly ${HOME}
+		'quoted text' --verbose then sed x=1 x=1 $(pwd) local then $(pwd) "$1"
+	"$1" | echo "$@" readonly
+	x=1 2>/dev/null -eu 'quoted text' echo echo
+export ${HOME} export export test
+cd cd "$@" /usr/bin 2>/dev/null cd export 'quoted text'
+	awk --verbose ${HOME} /usr/bin export
+	${HOME} | /usr/bin sed test --verbose /usr/bin $(pwd) test
+	local done /usr/bin export sed "$@" "$@" /usr/bin test export
+	-eu && "$@" local 2>/dev/null awk cd printf
+	test local grep 'quoted text' $(pwd) echo /usr/bin
+		$(pwd) cd "$1" cd 'quoted text' sed echo awk grep printf
+	/usr/bin /usr/bin awk 2>/dev/null | $(pwd) test -eu /usr/bin /usr/bin grep export
+"$1" test sed x=1 local 'quoted text' $(pwd) export | && $(pwd) && sed ${HOME}
+	grep "$@" "$@" grep x=1 "$@" ${HOME} && -eu grep && sed export -eu done
+	'quoted text' printf grep echo "$@" printf
+		printf local "$@" --verbose ${HOME} export
+readonly then -eu test readonly
+$(pwd) cd ${HOME} printf "$@" "$@" then -eu 2>/dev/null echo local
+&& export && $(pwd) then export "$1" export x=1 sed 2>/dev/null
+	-eu cd $(pwd) then "$1" done
+2>/dev/null -eu | echo sed "$1" | sed $(pwd) cd
+x=1 2>/dev/null done cd "$1" "$@" done local cd $(pwd) done x=1 'quoted text'
+	cd && "$@" readonly readonly 'quoted text' sed x=1 && grep
+		--verbose printf cd 2>/dev/null --verbose --verbose x=1 --verbose "$1" 'quoted text'
+	grep && -eu $(pwd) readonly echo test
+	| | test echo awk printf export 2>/dev/null
+		| ${HOME} 'quoted text' done --verbose
+printf local printf x=1
+	echo readonly grep readonly
+		"$1" ${HOME} $(pwd) test ${HOME} && export "$@" awk
+		cd 2>/dev/null x=1 grep "$1" "$1" local sed
+		grep --verbose grep test "$1"
+${HOME} ${HOME} cd 'quoted text'
+	$(pwd) then "$1" printf then grep $(pwd) ${HOME} done
+--verbose 'quoted text' echo local readonly
+		local && 2>/dev/null printf sed readonly readonly
+readonly echo | -eu $(pwd) $(pwd) "$@" test
+	$(pwd) export test -eu /usr/bin 'quoted text' sed -eu --verbose
+awk | sed then grep export awk "$@" 'quoted text' && $(pwd) "$1"
+		printf $(pwd) done && "$@" readonly export | && then ${HOME} "$@" done readonly
+		readonly done printf awk 2>/dev/null readonly then readonly test
+	--verbose | echo export then -eu local "$@" printf -eu then grep
+		'quoted text' && /usr/bin cd "$1" "$@" | readonly -eu test
+local /usr/bin 2>/dev/null cd sed then "$@" && awk then /usr/bin printf
+	cd awk -eu export sed export local 'quoted text'
+	awk readonly done && $(pwd) echo | ${HOME} printf ${HOME}
+	readonly $(pwd) grep /usr/bin printf "$1" --verbose test "$@" &&
+		"$@" 2>/dev/null printf --verbose
+		/usr/bin then 'quoted text' export && printf x=1 "$1" 2>/dev/null done echo --verbose
+"$1" && /usr/bin local export x=1 2>/dev/null cd --verbose echo | -eu then /usr/bin
+readonly 2>/dev/null done printf ${HOME}
+"$@" 'quoted text' ${HOME} x=1 printf -eu sed local "$1" ${HOME}
+done && 'quoted text' readonly
+	| grep "$@" cd x=1 | x=1 export local 2>/dev/null printf $(pwd)
+		export /usr/bin && awk printf $(pwd)
+	-eu sed grep /usr/bin readonly
+	| local 'quoted text' | awk readonly x=1 echo done && ${HOME}
+--verbose -eu $(pwd) cd /usr/bin $(pwd) export awk cd sed "$1" --verbose
+	echo "$@" 2>/dev/null export --verbose grep
+	$(pwd) done | then then test local ${HOME} $(pwd) grep
+	awk then x=1 $(pwd) done ${HOME} awk "$@" then sed 2>/dev/null
+cd "$1" readonly 'quoted text' readonly
+		${HOME} local awk cd | local sed 'quoted text'
+		test done /usr/bin ${HOME} $(pwd)
+	x=1 $(pwd) $(pwd) -eu | /usr/bin
+| cd sed "$@" | then echo local "$@" grep printf -eu -eu awk printf sed -eu
+		sed export awk 2>/dev/null local awk -eu
+		"$@" x=1 ${HOME} then --verbose /usr/bin then "$@" -eu && | 2>/dev/null
+	then ${HOME} then local printf 2>/dev/null echo echo done printf awk --verbose
+	local readonly printf ${HOME} cd ${HOME} done
+		-eu test test done sed && --verbose echo "$@" sed
+	| "$1" "$@" then --verbose $(pwd)
+		"$1" ${HOME} then cd 'quoted text' | printf -eu then cd "$@" | 'quoted text'
+	--verbose "$@" ${HOME} ${HOME} done -eu done readonly 2>/dev/null done
+	"$@" $(pwd) 2>/dev/null 'quoted text' && 2>/dev/null local readonly 2>/dev/null
+local x=1 && 'quoted text'
+	cd ${HOME} local ${HOME} then ${HOME} export "$@" echo ${HOME}
+		sed sed ${HOME} sed "$1"
+&& ${HOME} echo cd 'quoted text' then 2>/dev/null ${HOME}
+awk && grep echo local --verbose local "$1" 2>/dev/null
+then 2>/dev/null grep "$@" $(pwd) 2>/dev/null /usr/bin
+	x=1 ${HOME} x=1 grep local -eu cd 2>/dev/null echo grep
+| -eu awk $(pwd) readonly awk $(pwd)
+		-eu 2>/dev/null test | && $(pwd) 'quoted text'
+	test "$1" $(pwd) echo "$@" 2>/dev/null printf
+	--verbose -eu echo $(pwd)
+		export /usr/bin 'quoted text' export
+	-eu grep local --verbose && x=1 "$@" 'quoted text' 2>/dev/null grep
+	sed grep export ${HOME} readonly grep
+then awk done grep awk local 2>/dev/null done grep echo
+"$@" | then x=1 "$1" readonly done x=1 awk test
+		$(pwd) test "$@" echo then grep /usr/bin
+	test $(pwd) "$1" awk --verbose && "$@" grep echo /usr/bin 'quoted text' sed
+		/usr/bin | echo $(pwd) echo
+	sed then grep echo /usr/bin
+	printf sed /usr/bin readonly grep && "$@" readonly 'quoted text'
+		sed 'quoted text' awk test grep cd readonly
+${HOME} export x=1 2>/dev/null
+grep | printf readonly export
+readonly local && printf | | 'quoted text' local printf 'quoted text'
+cd /usr/bin /usr/bin export local awk readonly 'quoted text'
+'quoted text' sed readonly 2>/dev/null -eu test cd |
+$(pwd) done test then local | done 'quoted text'
+	${HOME} /usr/bin awk -eu printf x=1 -eu cd readonly
+	-eu local /usr/bin | sed then 2>/dev/null -eu 2>/dev/null
+		'quoted text' then "$1" export printf --verbose "$@" grep test done /usr/bin
+	readonly done awk then "$1"
+		cd cd echo "$1" "$@" /usr/bin printf "$1" 2>/dev/null
+grep --verbose && export sed "$@" local x=1 grep printf
+		then readonly grep "$1" export $(pwd)
+		sed then 'quoted text' done "$@" x=1 readonly echo printf
+printf echo -eu cd local "$@" 2>/dev/null -eu done ${HOME} sed grep grep echo
+	x=1 echo 2>/dev/null cd 'quoted text' export ${HOME} export ${HOME}
+	/usr/bin test | x=1 -eu printf x=1 export
+		echo grep readonly echo
+readonly local 2>/dev/null awk ${HOME} x=1 x=1 cd && cd x=1 ${HOME} local local
+		export $(pwd) 'quoted text' 2>/dev/null sed sed readonly
+test x=1 export "$1" then | sed echo export | ${HOME} && 2>/dev/null ${HOME}
+		sed awk echo readonly printf awk echo && x=1 x=1
+2>/dev/null "$@" -eu | x=1 2>/dev/null grep readonly
+		-eu /usr/bin ${HOME} | $(pwd) cd "$1"
+	${HOME} "$@" then "$@" export done
+		--verbose printf local $(pwd) x=1 -eu && then "$@" export local
+$(pwd) x=1 cd printf grep sed echo /usr/bin grep sed "$1" local done
+		then export $(pwd) 'quoted text' printf /usr/bin
+	| 2>/dev/null "$1" -eu grep x=1 cd && sed test | $(pwd) 'quoted text'
+'quoted text' test $(pwd) cd awk cd test | done readonly
+	then printf 2>/dev/null x=1 /usr/bin grep /usr/bin sed 2>/dev/null
+	sed | ${HOME} local /usr/bin
+	cd sed "$1" "$@" "$@" awk printf done local local readonly readonly then 2>/dev/null
+		readonly export && --verbose printf readonly
+		export 'quoted text' "$@" | --verbose "$1" --verbose
+	x=1 ${HOME} $(pwd) export 'quoted text' printf awk
+	cd $(pwd) printf ${HOME} --verbose
+done x=1 x=1 readonly cd sed $(pwd) | local /usr/bin | local "$@" echo
+2>/dev/null echo local /usr/bin export --verbose -eu && export "$1" done readonly
+	done cd "$1" readonly ${HOME} done 'quoted text' cd export done export
+		sed local grep 2>/dev/null
+--verbose $(pwd) echo awk x=1 grep "$1" "$1" /usr/bin | $(pwd)
+		&& 'quoted text' "$@" test
+	sed --verbose awk echo /usr/bin done readonly
+	'quoted text' /usr/bin
+		-eu 'quoted text' readonly
+local printf export test done grep readonly
+	"$@" awk printf --verbose ${HOME} --verbose awk
+		x=1 "$@" echo sed grep $(pwd) test cd 2>/dev/null sed && --verbose
+		done "$@" "$@" "$@" "$1" "$@"
+	test cd sed x=1 && test | grep ${HOME} --verbose x=1 2>/dev/null
+then export local echo "$1" cd ${HOME} "$@" "$@" test
+awk then local cd local then $(pwd) export --verbose
+		awk "$1" readonly local awk -eu "$@"
+		cd /usr/bin grep | && test -eu && sed
+	printf then "$@" awk sed && grep awk 2>/dev/null echo then && ${HOME}
+	$(pwd) cd --verbose | -eu done
+"$@" sed echo 'quoted text' sed && export local grep
+-eu 'quoted text' /usr/bin /usr/bin test /usr/bin printf local --verbose cd "$@"
+2>/dev/null local export -eu $(pwd)
+	then export local 'quoted text'
+awk done printf done 2>/dev/null 2>/dev/null -eu
+2>/dev/null sed $(pwd) awk 'quoted text' sed x=1 then echo awk /usr/bin test
+	"$@" -eu export echo --verbose then 2>/dev/null export ${HOME}
+	cd local 'quoted text' "$@" awk ${HOME} grep grep -eu then && 'quoted text'
+	| awk "$@" cd -eu done test | printf local echo grep
+grep $(pwd) then test | cd local /usr/bin grep
+${HOME} $(pwd) -eu export $(pwd)
+printf --verbose 'quoted text' -eu grep done "$@" awk
+	${HOME} --verbose 'quoted text' done
+	grep done then "$@" 'quoted text' sed "$1" "$1" readonly -eu
+done sed sed "$@" local 2>/dev/null export 'quoted text' awk
+	printf export done && grep grep cd 2>/dev/null cd awk $(pwd) cd && && echo
+"$@" "$@" -eu awk && $(pwd) $(pwd) sed --verbose then then 2>/dev/null
+		2>/dev/null --verbose local x=1 export
+	printf awk sed x=1 && 2>/dev/null "$@" local then && | ${HOME} readonly sed
+		2>/dev/null --verbose test local echo grep
+| done then --verbose echo export /usr/bin
+-eu && ${HOME} local 'quoted text' x=1 "$@" cd awk x=1 && sed 'quoted text'
+	echo awk | sed readonly sed && grep export cd "$1" "$@" ${HOME}
+		then sed cd printf ${HOME}
+${HOME} 2>/dev/null "$1" --verbose ${HOME} 2>/dev/null readonly done -eu awk test
+	printf -eu sed "$1" sed "$1" | export
+		-eu 2>/dev/null 'quoted text' 2>/dev/null
+		awk echo done --verbose test ${HOME} $(pwd) -eu /usr/bin /usr/bin
+	x=1 x=1 echo /usr/bin sed readonly readonly -eu 'quoted text' "$@" readonly
+		"$@" "$1" -eu "$@" "$1" "$1" -eu export local echo && export x=1 && export echo
+--verbose $(pwd) sed cd echo
+	local && $(pwd) echo /usr/bin /usr/bin -eu local readonly readonly
+		/usr/bin ${HOME} awk "$1" export cd export readonly 2>/dev/null -eu
+		test /usr/bin | awk done local readonly echo test test -eu "$@" x=1 export then
+	readonly ${HOME} "$@" x=1 local sed "$1" test "$@" -eu | $(pwd) echo && cd && 2>/dev/null
+-eu -eu done local done export /usr/bin ${HOME} local awk awk local &&
+		2>/dev/null then 2>/dev/null cd local $(pwd) test ${HOME} awk sed ${HOME}
+		--verbose 2>/dev/null
+	grep done --verbose 'quoted text' echo local export "$1"
+	printf then readonly sed "$@" "$@" && local "$1" done 'quoted text'
+		then && cd echo "$@" x=1 sed /usr/bin --verbose cd readonly /usr/bin x=1 readonly
+cd sed x=1 test ${HOME} readonly --verbose echo cd 2>/dev/null x=1 x=1 "$@"
+test "$1" -eu ${HOME} echo 2>/dev/null "$1" --verbose grep x=1 readonly /usr/bin
+	2>/dev/null && echo && -eu test
+grep "$1" export && printf ${HOME}
+	sed ${HOME} --verbose local
+	&& awk sed sed echo --verbose | export 2>/dev/null ${HOME} grep x=1
+		sed done /usr/bin test printf "$1" "$@" --verbose --verbose "$@" sed
+	readonly cd printf printf "$@" | "$1" ${HOME}
+		/usr/bin ${HOME} --verbose /usr/bin printf sed && /usr/bin cd x=1 sed
+	awk echo 'quoted text' && 'quoted text'
+printf $(pwd) done 'quoted text' echo x=1 x=1 then 2>/dev/null sed x=1 printf
+${HOME} "$1" 2>/dev/null done "$@" sed
+awk awk "$1" --verbose --verbose
+	printf echo "$@" "$@" local local local awk 'quoted text' awk
+	then printf echo && export readonly --verbose ${HOME} awk cd
+		then grep x=1 | 'quoted text' local echo awk "$1" 'quoted text' grep
+		--verbose local echo test /usr/bin local cd | readonly 'quoted text'
+'quoted text' -eu cd grep printf
+x=1 "$1" awk $(pwd) && test $(pwd) x=1 && test && && readonly $(pwd) ${HOME} "$1"
+export "$1" && 2>/dev/null ${HOME} printf
+	2>/dev/null "$1" printf $(pwd)
+--verbose -eu printf done readonly "$@" 2>/dev/null printf
+	done $(pwd) export export /usr/bin /usr/bin
+	"$1" done cd "$@" echo -eu -eu local then cd x=1 sed local test x=1 awk done
+	sed grep --verbose export export ${HOME} grep test | --verbose local
+--verbose $(pwd) 'quoted text' --verbose echo readonly test
+		"$@" 2>/dev/null "$1" printf --verbose --verbose sed "$@" x=1 local $(pwd) "$@"
+	sed 2>/dev/null done 2>/dev/null
+readonly awk sed printf 2>/dev/null awk | "$@" local x=1
+		"$@" export local done 'quoted text'
+	$(pwd) awk printf readonly export
+x=1 --verbose done grep grep 2>/dev/null
+		export "$1" test ${HOME} --verbose printf
+test "$1" grep local /usr/bin export /usr/bin
+sed && readonly cd cd /usr/bin echo -eu $(pwd) -eu
+	export grep echo cd $(pwd) then /usr/bin echo printf sed 2>/dev/null --verbose
+printf test $(pwd) "$@" --verbose "$@" awk -eu 'quoted text' 'quoted text'
+	local x=1 sed $(pwd) x=1 then awk then sed then grep "$@" && "$@" ${HOME} x=1 test
+	-eu ${HOME} /usr/bin printf cd |
+	${HOME} printf local | -eu grep cd grep grep grep then
+		--verbose printf /usr/bin awk test "$1" | cd |
+	grep export grep export then cd "$1" done grep && $(pwd) export then "$1"
+		awk "$1" printf local "$@" echo grep printf readonly then cd -eu awk --verbose
+		sed 2>/dev/null --verbose --verbose && /usr/bin
+	"$1" $(pwd) grep | then "$1" printf cd $(pwd) awk grep awk "$@" 'quoted text'
+${HOME} | | done "$1" 'quoted text' 'quoted text' /usr/bin local -eu
+	| "$1" echo | ${HOME} "$1" local --verbose done cd grep && test
+	awk x=1 echo sed 'quoted text' && awk x=1 2>/dev/null && export "$@" 2>/dev/null
+		-eu local done x=1 --verbose then ${HOME} done --verbose test
+	"$@" export printf 'quoted text' awk x=1 2>/dev/null
+		&& sed -eu /usr/bin /usr/bin readonly -eu ${HOME} | test ${HOME} local && $(pwd)
+$(pwd) -eu sed test /usr/bin 'quoted text' --verbose $(pwd)
+/usr/bin readonly 'quoted text' | 'quoted text' -eu ${HOME} --verbose
+$(pwd) printf | && "$1" /usr/bin cd cd x=1 -eu ${HOME} 2>/dev/null 'quoted text'
+export done "$1" --verbose export local "$1" x=1 cd "$@" $(pwd) awk test
+	| export | x=1 x=1 2>/dev/null readonly "$@" export grep
+		"$1" 2>/dev/null printf x=1 sed grep "$@" 2>/dev/null -eu then /usr/bin
+	x=1 --verbose "$@" grep
+		'quoted text' 2>/dev/null sed grep sed readonly | then done cd printf | printf
+echo x=1 "$@" -eu test cd test 2>/dev/null "$1"
+	printf ${HOME} x=1 export "$1" | x=1 $(pwd) test 'quoted text'
+		readonly local | "$1" grep local -eu
+sed && done "$@" | "$@" echo echo grep "$@" done export test export x=1 | readonly
+export echo cd $(pwd) done printf && grep
+	--verbose grep then echo && "$@" $(pwd) test $(pwd)
+		done x=1 echo 2>/dev/null | echo 'quoted text'
+		then --verbose local -eu x=1 x=1 /usr/bin && 2>/dev/null test 2>/dev/null
+"$@" local then then && 'quoted text' cd sed awk --verbose
+		2>/dev/null grep done /usr/bin 'quoted text' awk | /usr/bin 2>/dev/null
+echo cd "$@" x=1 awk grep x=1 "$1" echo sed printf /usr/bin | done "$1" sed
+$(pwd) grep "$1" grep test
+		done echo local printf printf
+	| echo ${HOME} echo awk | done cd 2>/dev/null && done &&
+		--verbose x=1 "$@" "$@" ${HOME} awk "$@" 'quoted text' 2>/dev/null echo
+	-eu sed 2>/dev/null printf printf 'quoted text' "$1" && echo | 'quoted text'
+	readonly done /usr/bin ${HOME}
+$(pwd) awk sed /usr/bin ${HOME} awk sed done export
+		/usr/bin grep sed && cd --verbose grep export awk | test x=1 done $(pwd)
+		cd printf local local local export done then 2>/dev/null echo 'quoted text'
+	-eu test sed awk 'quoted text' done done ${HOME} readonly echo
+		then && export export export $(pwd) local awk then
+2>/dev/null --verbose x=1 && | && "$1" echo
+		done readonly 'quoted text' grep $(pwd) local echo ${HOME} local 'quoted text'
+		2>/dev/null export 'quoted text'
+		sed readonly --verbose then x=1 ${HOME} then -eu x=1
+		${HOME} printf ${HOME} readonly | sed x=1 local sed sed
+		awk readonly --verbose /usr/bin ${HOME} readonly echo
+printf ${HOME} x=1 "$@" -eu $(pwd) local printf done -eu x=1 then /usr/bin "$@"
+/usr/bin cd awk printf then | printf done
+		${HOME} -eu 2>/dev/null then
+	'quoted text' "$@" local test $(pwd) $(pwd) $(pwd) printf 'quoted text' --verbose
+-eu sed done grep ${HOME} 'quoted text' echo awk test sed echo
+	cd cd awk sed awk test --verbose local "$1" "$@" echo
+-eu x=1 2>/dev/null 2>/dev/null x=1 awk --verbose
+echo local readonly printf "$@" export && awk echo "$@" test echo
+		&& readonly awk $(pwd) done done test && then | --verbose echo && "$@" 2>/dev/null
+		readonly "$@" sed 'quoted text' && 2>/dev/null "$@" printf grep printf
+	printf 'quoted text' local cd cd grep $(pwd) readonly "$1" ${HOME} -eu
+"$1" 'quoted text' readonly x=1 "$@" sed 'quoted text'
+	printf sed $(pwd) then -eu ${HOME} local /usr/bin test local | "$1"
+readonly && sed test readonly grep grep cd | 2>/dev/null ${HOME} "$@" "$@"
+then test /usr/bin test -eu ${HOME} awk /usr/bin
+		"$1" --verbose "$1" sed echo
+		done export readonly 2>/dev/null "$@" 2>/dev/null local
+		cd sed test readonly "$@" test /usr/bin
+"$@" "$1" grep $(pwd) printf local local grep local
+	grep printf awk then sed test cd cd test readonly $(pwd)
+"$@" "$@" "$@" awk cd export
+	sed | printf x=1 | local /usr/bin --verbose | && 2>/dev/null
+2>/dev/null echo echo echo local sed &&
+grep | --verbose | test --verbose
+done awk local echo x=1 cd "$1" "$@" 2>/dev/null echo readonly x=1
+--verbose "$1" sed local printf x=1 cd printf 'quoted text' 'quoted text'
+		printf --verbose printf sed sed 'quoted text' 2>/dev/null done done && awk awk
+	$(pwd) readonly 'quoted text' grep --verbose test $(pwd) -eu --verbose
+	export "$1" | ${HOME} readonly grep
+		"$@" done export && local done ${HOME} export 2>/dev/null
+		sed grep /usr/bin then ${HOME}
+| ${HOME} sed --verbose --verbose --verbose printf local "$@" x=1 readonly
+'quoted text' grep 2>/dev/null cd | 'quoted text' sed x=1 grep
+awk "$@" done $(pwd) printf "$1" ${HOME}
+	&& sed test test local 'quoted text' "$1" grep
+then grep echo --verbose 2>/dev/null "$@" 2>/dev/null | /usr/bin
+	--verbose /usr/bin sed
+	awk grep && /usr/bin cd cd -eu "$1" export --verbose 2>/dev/null $(pwd)
+	${HOME} $(pwd) x=1 --verbose /usr/bin printf /usr/bin
+	| x=1 export test cd awk
+	$(pwd) export awk local sed printf test
+		2>/dev/null local -eu "$@" ${HOME} awk -eu sed test "$@" 'quoted text' done
+grep $(pwd) readonly test done export local awk
+$(pwd) sed then /usr/bin ${HOME} cd done test ${HOME} printf
+		$(pwd) export 'quoted text' --verbose sed readonly sed test test cd grep -eu
+		$(pwd) x=1 'quoted text'
+| printf -eu "$@" && echo /usr/bin sed ${HOME} && ${HOME} $(pwd) | && && done |
+	done grep -eu done cd readonly export test /usr/bin echo
+		awk then 2>/dev/null printf ${HOME} /usr/bin export local ${HOME} cd x=1 --verbose
+		2>/dev/null cd | cd test local export local $(pwd) "$1" -eu echo
+	--verbose $(pwd) -eu x=1 /usr/bin "$@" 'quoted text' 2>/dev/null sed echo sed 'quoted text'
+&& sed test ${HOME} grep 2>/dev/null 'quoted text' printf echo 2>/dev/null
+	sed "$1" 'quoted text' local 'quoted text'
+		awk awk done | grep test awk -eu sed test printf | awk local
+sed "$@" echo then done && awk grep done && | local test local test
+	done sed local 2>/dev/null 2>/dev/null "$@" "$@" sed 'quoted text'
+		-eu done "$@" x=1 -eu cd done x=1 'quoted text' export
+		echo export readonly echo | 2>/dev/null /usr/bin local readonly
+		grep && test ${HOME} /usr/bin && --verbose grep export &&
+		then local --verbose done 2>/dev/null
+2>/dev/null awk && done 2>/dev/null then /usr/bin readonly | local ${HOME}
+		'quoted text' local test &&
+		"$1" "$1" | then /usr/bin /usr/bin sed echo 'quoted text' local --verbose
+	"$1" | then local 'quoted text' $(pwd)
+	local "$@" done sed $(pwd) --verbose -eu /usr/bin local $(pwd) then
+	-eu test awk echo cd --verbose
+		$(pwd) 2>/dev/null test sed sed 'quoted text' "$@" -eu echo export && $(pwd)
+"$@" 2>/dev/null && local /usr/bin $(pwd) "$1" -eu export echo ${HOME}
+	/usr/bin && done done test 'quoted text' --verbose --verbose "$1" $(pwd) x=1
+		done awk --verbose printf /usr/bin "$@" && -eu
+| then && --verbose && --verbose "$@" export cd awk $(pwd) --verbose awk "$@"
+		then done 2>/dev/null | -eu test /usr/bin cd
+	printf echo printf | x=1 'quoted text' done "$@" "$1" --verbose local echo sed
+done echo -eu done printf && /usr/bin --verbose awk cd --verbose test /usr/bin
+		test 'quoted text' /usr/bin /usr/bin 2>/dev/null /usr/bin $(pwd)
+x=1 sed then readonly cd --verbose done 'quoted text'
+"$@" 'quoted text' done grep cd awk x=1 | then x=1 2>/dev/null | |
+	2>/dev/null local echo sed x=1 done readonly test -eu readonly "$1" local
+printf | 2>/dev/null | $(pwd) | then | -eu readonly test x=1 $(pwd)
+--verbose "$@" --verbose grep -eu
+	echo ${HOME} sed echo done "$1"
+		'quoted text' && awk printf $(pwd) --verbose
+done x=1 readonly readonly echo 'quoted text' /usr/bin /usr/bin
+${HOME} | -eu | done grep && echo test --verbose done
+		"$@" 'quoted text' /usr/bin
+&& 'quoted text' readonly
+	echo "$@" x=1 --verbose --verbose "$1" "$@" 2>/dev/null export
+	printf then --verbose done x=1 | | -eu
+grep /usr/bin 2>/dev/null
+printf x=1 $(pwd) then local sed x=1 local --verbose "$@" then | --verbose
+local -eu ${HOME} /usr/bin then -eu local
+"$@" echo 'quoted text' readonly $(pwd) "$1" grep x=1
+	done printf then 2>/dev/null cd printf readonly
+		test readonly x=1 local awk --verbose
+		export x=1 "$@" printf done "$@" -eu printf printf then
+test export /usr/bin readonly
+	| /usr/bin "$@" $(pwd) local then x=1 local "$@" awk | local /usr/bin --verbose
+		grep 'quoted text' done readonly
+		grep x=1 local && x=1
+| awk "$@" cd export --verbose | ${HOME} cd x=1 echo 'quoted text'
+		-eu && 2>/dev/null | awk 2>/dev/null grep -eu cd
+		sed done readonly -eu --verbose export
+	"$1" test "$@" printf --verbose && -eu && $(pwd) cd ${HOME} --verbose printf
+		/usr/bin ${HOME} readonly $(pwd) ${HOME} /usr/bin echo printf /usr/bin echo printf
+	/usr/bin done | done --verbose then && test awk 2>/dev/null && -eu printf export
+		'quoted text' readonly echo -eu then -eu "$@" 2>/dev/null readonly
+cd --verbose | sed test /usr/bin local "$1"
+	cd sed done test $(pwd) && echo /usr/bin printf echo echo x=1 grep $(pwd)
+	-eu then /usr/bin | readonly
+	then | cd cd test "$@" 2>/dev/null
+cd && "$@" --verbose && test sed ${HOME} grep | | done 'quoted text'
+		| done "$1" x=1 "$@" ${HOME} x=1 awk printf
+		test sed awk done "$1" 'quoted text'
+	grep local --verbose x=1 "$@" sed --verbose 'quoted text' printf printf echo
+	done grep && grep awk cd then cd awk echo grep && test echo echo && 'quoted text'
+	"$1" /usr/bin sed local awk $(pwd) awk 2>/dev/null
+		local && export awk export done | $(pwd) --verbose
+		sed && /usr/bin printf then --verbose 'quoted text' -eu then cd "$1"
+		grep 2>/dev/null cd printf ${HOME} sed --verbose "$1"
+	test grep x=1 'quoted text' && sed "$@" cd local local cd "$1" sed 2>/dev/null
+		| | printf ${HOME} awk /usr/bin "$@" 2>/dev/null
+	then awk export local cd 2>/dev/null "$1"
+'quoted text' --verbose sed done x=1 /usr/bin "$@"
+	grep /usr/bin grep test ${HOME} && local -eu x=1 local
+local cd test | export test test ${HOME} -eu "$1" "$@" && ${HOME} x=1 "$@"
+		awk sed 2>/dev/null && local local $(pwd) printf --verbose sed then && 'quoted text'
+	grep sed sed cd "$1" && "$@"
+x=1 | test test export sed 'quoted text' grep done ${HOME} x=1
+	'quoted text' awk 'quoted text' "$@" 'quoted text' x=1
+	&& $(pwd) && && 'quoted text' x=1
+	awk $(pwd) awk -eu export -eu grep local grep local | /usr/bin | && x=1 echo sed
+| local "$@" local "$@" then /usr/bin
+	/usr/bin | --verbose "$1" 'quoted text' awk "$1" "$1" printf "$@"
+	--verbose 'quoted text' -eu "$1" echo
+-eu test readonly ${HOME} printf grep test cd test readonly
+-eu done echo export | ${HOME} done
+printf -eu 'quoted text' x=1 2>/dev/null
+	readonly ${HOME} | cd $(pwd) -eu grep local
+'quoted text' sed awk local grep | /usr/bin | printf | x=1 grep "$@"
+		then --verbose 2>/dev/null "$@" export "$1" test 2>/dev/null 2>/dev/null -eu /usr/bin
+		| awk $(pwd) then x=1 | &&
+	local then cd $(pwd) && | readonly x=1 "$1" "$1"
+	local ${HOME} && echo | /usr/bin
+		cd readonly export $(pwd) "$@" grep "$@" done ${HOME} export
+2>/dev/null -eu 'quoted text' grep local x=1 readonly cd 'quoted text'
+		$(pwd) "$@" echo then echo cd done done ${HOME} local 'quoted text'
+grep /usr/bin "$@" awk /usr/bin && 2>/dev/null "$@" x=1 --verbose /usr/bin
+awk "$@" 2>/dev/null 2>/dev/null done printf test | 'quoted text' sed
+		${HOME} 'quoted text' local cd | "$1" && | && awk
+	export done --verbose
+printf "$1" then 2>/dev/null && "$1" printf 2>/dev/null echo "$1" -eu -eu printf
+awk | local --verbose ${HOME} | echo local
+	test readonly ${HOME} x=1 export cd x=1 printf $(pwd)
+'quoted text' "$@" local grep /usr/bin local /usr/bin printf &&
+		grep sed --verbose echo echo | local done x=1
+	"$@" echo local 2>/dev/null && "$1" /usr/bin | 'quoted text' $(pwd)
+		| then local 2>/dev/null test
+&& | awk test sed then sed local printf 'quoted text' readonly test
+		export | test done $(pwd) "$@" awk local echo
+		test | sed echo printf echo 2>/dev/null grep done x=1 'quoted text' printf -eu
+		$(pwd) cd test x=1 x=1 grep sed export
+		export echo readonly sed | --verbose x=1 echo echo ${HOME} $(pwd) x=1 /usr/bin
+	grep grep echo && "$@" test printf
+grep /usr/bin awk && /usr/bin test cd test test 'quoted text'
+	"$1" awk "$@" 2>/dev/null | x=1 local readonly
+	2>/dev/null export "$1" echo | done ${HOME}
+sed awk x=1 -eu --verbose
+		cd grep sed local awk --verbose
+	echo cd 2>/dev/null | done ${HOME} x=1 done "$1" "$@" | && && x=1 x=1 sed grep
+	done cd 2>/dev/null /usr/bin 2>/dev/null && /usr/bin then /usr/bin
+		$(pwd) printf && ${HOME} cd | | echo --verbose test
+		| local 'quoted text' test export --verbose
+		"$1" done "$@" local echo readonly
+		$(pwd) | then -eu sed "$1" x=1 x=1 export /usr/bin
+	-eu /usr/bin test echo awk "$@" $(pwd) -eu $(pwd) printf ${HOME}
+		'quoted text' | "$@" grep ${HOME} test test then done ${HOME} cd test
+test "$@" -eu 2>/dev/null "$@" sed
+	"$@" "$1" done 2>/dev/null cd export export export then --verbose then | /usr/bin
+	test awk --verbose ${HOME} "$@" ${HOME} $(pwd) test /usr/bin export 'quoted text'
+	local 2>/dev/null export
+| done /usr/bin "$@" "$1" "$@" 2>/dev/null
+		x=1 sed 2>/dev/null grep local echo 'quoted text'
+--verbose echo local ${HOME} --verbose printf local
+		"$1" "$@" 2>/dev/null /usr/bin export done grep awk 'quoted text'
+	x=1 'quoted text' 2>/dev/null cd --verbose 2>/dev/null local 'quoted text'
+awk printf readonly echo awk then echo sed -eu test | readonly cd printf export
+		&& cd test 2>/dev/null | grep grep
+	then "$@" sed awk x=1 -eu done | echo
+	echo /usr/bin local && printf | local
+		local /usr/bin x=1 sed 2>/dev/null -eu /usr/bin
+		awk cd then --verbose export
+	--verbose --verbose local
+	&& awk printf --verbose /usr/bin $(pwd) $(pwd) -eu 2>/dev/null readonly
+	/usr/bin "$1" "$@" sed then 2>/dev/null test --verbose
+	"$@" local && --verbose --verbose 'quoted text' 2>/dev/null
+| x=1 /usr/bin printf 'quoted text' test test grep $(pwd)
+	"$@" ${HOME} | "$1" x=1 ${HOME} readonly readonly ${HOME} grep | done grep
+	printf printf /usr/bin printf
+${HOME} local sed ${HOME} ${HOME} printf test grep "$1" | 2>/dev/null && ${HOME}
+	$(pwd) sed local echo
+		then && $(pwd) local x=1 test $(pwd) ${HOME} printf
+		&& && | 2>/dev/null local | | -eu awk /usr/bin cd grep
+	${HOME} awk cd 2>/dev/null "$1" then "$@" test "$@"
+		| x=1 -eu /usr/bin echo echo | printf 2>/dev/null echo grep echo awk export
+	x=1 echo "$1" printf local --verbose
+		"$1" readonly -eu local x=1 awk done sed ${HOME} awk -eu $(pwd) export "$1"
+	&& 2>/dev/null grep sed export export ${HOME} $(pwd) $(pwd) readonly
+		${HOME} test -eu "$1" 2>/dev/null 'quoted text' local
+		awk cd export --verbose /usr/bin && export /usr/bin grep
+${HOME} 'quoted text' ${HOME}
+	x=1 awk export grep printf --verbose -eu test grep sed sed echo 2>/dev/null
+export printf local then && test test ${HOME} ${HOME} 2>/dev/null
+x=1 x=1 echo cd cd -eu | grep
+		sed local sed printf "$1" -eu 'quoted text'
+		x=1 sed test awk ${HOME} -eu && && x=1 2>/dev/null | test printf -eu
+	"$@" $(pwd) cd test x=1 --verbose awk /usr/bin test /usr/bin export ${HOME} /usr/bin
+		-eu export awk export --verbose ${HOME} done ${HOME} printf -eu cd test 2>/dev/null
+		cd test --verbose cd readonly -eu "$1" printf $(pwd) sed printf -eu local
+		${HOME} "$1" --verbose --verbose grep then readonly "$@" test
+	x=1 -eu done "$@" ${HOME} "$@"
+		--verbose "$1" x=1 'quoted text' done then sed | -eu 'quoted text'
+		test && "$1" "$1" grep test x=1 done 'quoted text' /usr/bin readonly
+	2>/dev/null "$@" ${HOME} "$@" test
+	grep awk && | 2>/dev/null readonly local -eu then 'quoted text'
+printf awk then awk 'quoted text' "$@"
+export grep export awk sed ${HOME} done -eu sed
+	test -eu "$1" --verbose ${HOME} printf | local cd test then x=1
+	| export --verbose && done echo /usr/bin
+		"$1" --verbose done sed "$1" readonly --verbose -eu && -eu then then 2>/dev/null
+/usr/bin --verbose 'quoted text' done ${HOME} -eu
+		| ${HOME} cd 2>/dev/null grep grep | "$1" $(pwd) local export cd awk then 2>/dev/null
+		local x=1 "$@" && printf grep -eu 'quoted text'
+	grep 2>/dev/null cd $(pwd) test | done --verbose
+--verbose then printf
+	printf $(pwd) "$1" && && then export ${HOME} --verbose
+		then -eu printf "$1" "$@" 'quoted text' x=1 ${HOME} ${HOME} printf done
+readonly $(pwd) readonly
+		done printf readonly ${HOME} awk sed
+		${HOME} printf done x=1 /usr/bin | local "$@" x=1 export "$@" test
+x=1 then -eu $(pwd) ${HOME}
+	then test --verbose readonly
+	test "$@" printf awk printf sed sed /usr/bin grep cd done /usr/bin
+	2>/dev/null $(pwd) --verbose -eu 'quoted text' readonly export
+		awk /usr/bin "$1" ${HOME} readonly done
+		cd done local "$@" -eu "$@" "$@" "$1" test | echo export sed
+		/usr/bin cd -eu echo local export done done
+then then test /usr/bin && export awk cd awk | local x=1 'quoted text'
+done printf then x=1 cd local /usr/bin $(pwd) | sed then cd | test "$@"
+		/usr/bin "$@" then --verbose
+-eu done local --verbose test --verbose export "$@" printf sed x=1 2>/dev/null
+		cd export awk x=1 --verbose then then printf done | grep
+echo 2>/dev/null $(pwd) done then -eu -eu --verbose -eu local awk
+	printf export export local done echo done awk -eu export /usr/bin readonly test
+&& cd local grep awk && | "$1"
+'quoted text' local && awk "$@" local done 2>/dev/null
+2>/dev/null ${HOME} then then $(pwd) "$1" awk readonly
+	export /usr/bin then x=1 printf test x=1 local
+	printf | && | done /usr/bin "$1" cd 'quoted text' then 2>/dev/null 'quoted text'
+		'quoted text' "$1" local $(pwd) test then local x=1 done "$1" "$@" "$@" |
+/usr/bin export echo $(pwd) local readonly
+test 2>/dev/null cd "$1" then
+	--verbose --verbose "$1" local cd x=1 "$@"
+	&& /usr/bin grep /usr/bin
+	"$@" local "$1" ${HOME} 2>/dev/null echo
+grep then 'quoted text' --verbose readonly then
+/usr/bin then then ${HOME} 'quoted text'
+	&& readonly --verbose | printf grep
+	awk && "$@" /usr/bin --verbose cd -eu /usr/bin
+/usr/bin awk export "$1" /usr/bin local test | test && local
+awk | && done -eu readonly x=1 $(pwd)
+	grep printf 'quoted text' 2>/dev/null
+		local "$@" | "$@" test grep "$1" done
+test export -eu "$@" export -eu -eu grep local "$1" printf 'quoted text' -eu echo
+awk -eu readonly export | 'quoted text'
+		echo "$1" grep 2>/dev/null "$1" echo $(pwd) grep done "$1" awk
+		&& awk echo $(pwd) && 2>/dev/null "$@" then "$1" "$1"
+		then readonly 'quoted text'
+		x=1 echo ${HOME} x=1 /usr/bin
+		2>/dev/null x=1 readonly && readonly
+	| echo "$@" grep 2>/dev/null
+		cd && done readonly /usr/bin 'quoted text' /usr/bin --verbose "$1" awk x=1
+local test then local readonly
+		--verbose 2>/dev/null export done "$1" local readonly sed readonly
+		done awk readonly then -eu && test "$@" x=1 echo x=1 --verbose readonly
+		cd export test | sed 2>/dev/null readonly
+		| | test test done $(pwd)
+echo done grep $(pwd) ${HOME} "$1" cd ${HOME}
+		export 2>/dev/null $(pwd) ${HOME} "$1" "$@" 'quoted text' readonly ${HOME}
+	${HOME} $(pwd) local && readonly ${HOME}
+x=1 'quoted text' then x=1 sed ${HOME}
+/usr/bin /usr/bin 'quoted text' test --verbose printf --verbose grep echo -eu
+	/usr/bin $(pwd) "$1" then printf "$1" export /usr/bin ${HOME} sed 'quoted text'
+local "$@" "$1" && x=1 awk test ${HOME} cd export "$@" /usr/bin
+grep 'quoted text' grep done "$@" --verbose cd --verbose --verbose ${HOME} test
+cd grep ${HOME} export -eu && && "$@" then then $(pwd) "$@" grep cd | 'quoted text'
+	-eu -eu | readonly -eu then "$1" "$@" -eu
+	2>/dev/null "$1" grep && "$@" grep && cd grep awk && printf
+	"$1" export done then | x=1 --verbose sed
+		readonly 2>/dev/null $(pwd) awk ${HOME} awk export --verbose readonly then cd
+		x=1 export awk "$1" grep done then /usr/bin "$1" $(pwd) local grep echo sed export
+awk 'quoted text' sed then | awk awk -eu printf "$@" export
+'quoted text' sed && --verbose test
+		--verbose cd -eu grep x=1 printf "$1" grep && readonly echo
+test then /usr/bin echo
+	local cd | cd readonly $(pwd) printf done ${HOME} ${HOME} test grep
+	'quoted text' $(pwd) grep $(pwd)
+		cd x=1 x=1 test local -eu --verbose local printf
+		cd "$1" 'quoted text' | then
+	readonly x=1 then /usr/bin
+	then $(pwd) readonly then done echo | x=1 | 'quoted text' "$1" echo grep
+	cd 'quoted text' then --verbose
+		&& done "$1" --verbose /usr/bin then -eu x=1 awk | x=1 /usr/bin 2>/dev/null 2>/dev/null
+	awk local 2>/dev/null /usr/bin echo readonly
+		$(pwd) | export "$@" 2>/dev/null 'quoted text' readonly
+		sed sed /usr/bin grep sed test && sed && "$1" awk export
+cd printf then -eu grep local echo "$1"
+	done | "$@" ${HOME} echo "$@" 'quoted text' --verbose | -eu 'quoted text'
+		-eu --verbose ${HOME} grep $(pwd)
+		"$@" sed -eu && cd grep -eu
+'quoted text' x=1 -eu && readonly "$1" | printf "$1" && /usr/bin printf printf |
+	done readonly cd cd local then "$1" x=1 2>/dev/null printf $(pwd) local
+/usr/bin -eu -eu x=1 export
+	"$@" done done -eu $(pwd)
+	'quoted text' -eu && sed /usr/bin $(pwd) grep readonly 'quoted text' "$@"
+	export grep 'quoted text' readonly 2>/dev/null printf test 2>/dev/null
+	-eu x=1 "$@" export 'quoted text'
+	x=1 'quoted text' done 'quoted text' "$1" --verbose
+		done $(pwd) $(pwd) -eu cd printf 'quoted text' --verbose
+x=1 local && cd && -eu "$1" /usr/bin then && readonly then 2>/dev/null done
+		| sed export ${HOME} sed sed printf -eu && 'quoted text'
+--verbose test test x=1 local x=1 ${HOME} sed test
+		grep --verbose /usr/bin ${HOME} $(pwd) done readonly then $(pwd) -eu "$@" &&
+| x=1 export then --verbose "$@"
+	/usr/bin printf local --verbose grep | test printf printf local awk printf --verbose
+-eu x=1 2>/dev/null local $(pwd)
+x=1 ${HOME} x=1 awk 'quoted text' cd test --verbose "$1"
+	echo cd test readonly && then 2>/dev/null && done -eu then done | printf awk /usr/bin
+	printf export && /usr/bin done && readonly 2>/dev/null --verbose | "$@"
+		test sed x=1 ${HOME} "$1" readonly /usr/bin awk test --verbose awk awk local
+		${HOME} /usr/bin && /usr/bin $(pwd) printf printf done
+	then local | cd --verbose then | x=1 sed "$@" printf
+	readonly sed test then echo /usr/bin readonly export ${HOME} echo
+readonly 'quoted text' then done awk --verbose test "$@" test awk x=1 echo
+		x=1 | 'quoted text' done -eu 2>/dev/null
+	test grep $(pwd) done local export $(pwd)
+export local printf cd then echo cd "$@" ${HOME} echo test export "$@"
+	local 2>/dev/null "$@" "$1" export
+	cd cd --verbose then ${HOME} printf
+"$@" && ${HOME} sed | then 'quoted text' ${HOME} echo "$@"
+		"$1" /usr/bin $(pwd) local && && 2>/dev/null sed "$@" export
+export local cd -eu awk | test x=1 "$1" then export "$1"
+	export echo grep ${HOME} "$@"
+$(pwd) done sed done awk echo $(pwd) grep local && $(pwd) then grep "$1"
+	/usr/bin "$@" ${HOME} local export --verbose | | -eu printf
+		printf 2>/dev/null export $(pwd) 2>/dev/null "$1" /usr/bin
+readonly ${HOME} 'quoted text' sed -eu "$@" x=1
+		done $(pwd) 2>/dev/null "$@" 2>/dev/null echo
+		local printf $(pwd) local 'quoted text' awk /usr/bin printf | /usr/bin /usr/bin
+	readonly echo ${HOME} readonly
+		test then export -eu readonly | done
+--verbose done export local test readonly test "$1" then ${HOME}
+		$(pwd) | printf grep x=1
+${HOME} /usr/bin x=1 local
+	readonly echo export readonly printf
+	-eu /usr/bin export $(pwd) awk ${HOME} x=1 'quoted text' /usr/bin then readonly
+		${HOME} test $(pwd) /usr/bin grep -eu
+		grep x=1 && done | grep
+'quoted text' echo 'quoted text'
+		$(pwd) x=1 --verbose | test && echo "$1" grep
+		sed && /usr/bin echo local awk export -eu 'quoted text' local x=1 export
+		done --verbose sed 'quoted text' -eu echo "$1"
+export | readonly | done printf local
+		echo sed then x=1 | export x=1 $(pwd) | grep sed 'quoted text'
+		"$@" then awk cd test --verbose then done grep local 2>/dev/null "$@" readonly
+${HOME} done sed cd readonly sed
+		readonly --verbose $(pwd) -eu echo x=1 "$1" then
+-eu $(pwd) test -eu ${HOME}
+		2>/dev/null readonly /usr/bin | /usr/bin test --verbose
+		${HOME} then done grep "$@" echo export 'quoted text'
+		local ${HOME} --verbose printf /usr/bin
+/usr/bin && "$@" -eu then export 'quoted text' then export -eu done 2>/dev/null
+	/usr/bin ${HOME} printf awk cd test $(pwd)
+2>/dev/null test export "$1"
+	test awk cd sed sed echo ${HOME} done awk && 'quoted text'
+sed -eu done readonly export
+	2>/dev/null | ${HOME} export echo then printf test 'quoted text'
+		printf readonly readonly "$1" 'quoted text'
+		printf "$@" cd grep sed |
+	awk local && echo awk awk "$1" /usr/bin $(pwd) ${HOME} local 2>/dev/null
+"$1" local echo readonly -eu
+test /usr/bin | --verbose -eu local
+	x=1 -eu then "$@" cd && sed -eu grep done sed "$1" export -eu x=1 printf $(pwd)
+readonly 2>/dev/null $(pwd) echo && 'quoted text' "$@" $(pwd) local
+		grep export "$1" test done sed awk && ${HOME} x=1 then test "$@" --verbose
+-eu readonly ${HOME} | export x=1 test cd readonly
+'quoted text' | echo && local local
+		$(pwd) -eu cd "$@" echo 'quoted text' "$1" /usr/bin then cd awk printf printf
+	readonly --verbose readonly readonly
+		readonly readonly cd test export echo test awk "$@"
+-eu && 'quoted text' local "$@" "$1" -eu --verbose /usr/bin export -eu && x=1
+	x=1 done -eu -eu local test --verbose -eu local
+awk --verbose x=1 && sed $(pwd) sed awk -eu
+		grep grep sed test printf local
+		${HOME} sed grep then printf ${HOME} -eu
+	export local --verbose 2>/dev/null
+--verbose 'quoted text' local -eu export readonly done && local ${HOME} then
+	'quoted text' awk 'quoted text'
+		awk --verbose /usr/bin done cd readonly $(pwd) printf "$@" $(pwd)
+	cd --verbose sed test awk test x=1 then && | 'quoted text'
+printf "$1" test grep --verbose
+-eu | "$@" -eu $(pwd) then
+	grep test 'quoted text' "$@" --verbose "$1" | done awk "$@" awk /usr/bin
+#include c26.sh
+	--verbose /usr/bin $(pwd)
+grep 2>/dev/null awk test ${HOME} sed ${HOME} cd grep cd export
+		cd export --verbose "$1" grep readonly local printf "$@" export
+		$(pwd) x=1 awk sed 2>/dev/null readonly && 'quoted text'
+	printf cd readonly -eu grep /usr/bin && grep sed
+--verbose echo cd 'quoted text' x=1 2>/dev/null local export
+readonly -eu done $(pwd) $(pwd) x=1 local --verbose then && sed
+	sed | 'quoted text' printf 'quoted text' --verbose
+-eu 2>/dev/null then done
+		sed test /usr/bin printf /usr/bin $(pwd)
+		"$@" x=1 test 'quoted text' --verbose then test -eu
+awk export ${HOME} $(pwd) cd export test sed grep sed
+	&& 'quoted text' -eu sed test 2>/dev/null
+		/usr/bin x=1 --verbose ${HOME} | "$1" --verbose sed cd x=1 x=1 "$@"
+2>/dev/null x=1 sed export test local awk sed awk printf 2>/dev/null readonly
+printf cd x=1 then x=1 test grep /usr/bin
+	"$@" 'quoted text' printf printf awk cd grep "$@" ${HOME} test /usr/bin export
+done printf echo -eu export echo | x=1 2>/dev/null readonly "$1" done /usr/bin
+		"$@" echo | | 'quoted text' then test | awk test then local local "$@" "$1" | test
+	awk echo "$@" "$@" "$@" &&
+	cd x=1 x=1 printf done /usr/bin --verbose then && "$@" grep cd cd awk export
+		"$@" done sed x=1 /usr/bin
+	2>/dev/null grep | done readonly awk test grep x=1 "$1" | ${HOME}
+echo echo | awk printf printf && $(pwd) printf
+		done --verbose printf ${HOME} grep local local x=1 ${HOME} "$1" | local
+| /usr/bin -eu x=1 readonly 2>/dev/null 'quoted text'
+	printf awk --verbose 2>/dev/null local
+$(pwd) printf local 2>/dev/null --verbose && sed local done grep $(pwd) local
+then echo ${HOME} "$1" awk awk sed test /usr/bin printf readonly grep --verbose
+	echo echo test readonly -eu then printf then && x=1
+		awk 'quoted text' sed test cd $(pwd) 2>/dev/null 2>/dev/null /usr/bin
+	--verbose local grep | readonly ${HOME} done test cd 2>/dev/null -eu grep
+		printf --verbose && -eu /usr/bin && awk echo readonly done x=1 "$@" awk echo
+	printf cd "$@" ${HOME} -eu printf echo export done "$@" echo
+'quoted text' -eu export "$1" x=1 x=1 2>/dev/null awk x=1 grep /usr/bin printf
+-eu readonly readonly | export printf readonly
+&& -eu -eu 'quoted text' readonly $(pwd) printf local then --verbose
+echo local done done cd sed printf cd then export local export
+test ${HOME} "$@" test
+	export 2>/dev/null -eu done && | --verbose printf grep | 2>/dev/null
+awk | done && -eu -eu sed export cd && sed cd
+${HOME} export sed cd "$@" "$@" test export done x=1 && 'quoted text'
+	grep ${HOME} x=1 2>/dev/null
+done printf test x=1 export printf grep "$@"
+	'quoted text' done ${HOME} echo awk $(pwd) grep
+		grep "$1" printf | 2>/dev/null local "$1" && --verbose cd 'quoted text'
+	grep "$1" test /usr/bin "$1"
+	printf 2>/dev/null export ${HOME} done export
+	export grep --verbose readonly local "$@" x=1 ${HOME}
+		sed test cd $(pwd) done 'quoted text' "$@" printf ${HOME} cd ${HOME}
+		| awk x=1 && ${HOME} && 'quoted text' $(pwd) "$1" sed awk export sed local x=1
+		x=1 x=1 awk /usr/bin $(pwd) printf 2>/dev/null
+/usr/bin awk | then local $(pwd) | "$1" sed 'quoted text' x=1 'quoted text'
+&& | /usr/bin -eu "$1" x=1 readonly sed /usr/bin
+	/usr/bin printf $(pwd) export 'quoted text' cd 2>/dev/null
+		${HOME} ${HOME} "$1" cd && | | printf printf x=1 sed test -eu /usr/bin --verbose
+/usr/bin local ${HOME} 2>/dev/null
+cd test "$@" /usr/bin test printf $(pwd) local
+		/usr/bin export export local awk local ${HOME} sed
+grep $(pwd) cd sed 'quoted text' grep "$@" cd 2>/dev/null cd cd
+echo "$1" && ${HOME} && | readonly -eu ${HOME} $(pwd) && cd ${HOME}
+	${HOME} done then done done grep test local /usr/bin done && cd &&
+awk -eu printf local done test ${HOME} then 'quoted text' &&
+		/usr/bin -eu "$@" 2>/dev/null 2>/dev/null local ${HOME}
+| "$@" && then ${HOME} "$1" 2>/dev/null readonly ${HOME} 'quoted text'
+	printf 2>/dev/null 2>/dev/null local awk awk test awk cd done grep export
+	${HOME} grep $(pwd) export test /usr/bin readonly "$@" && -eu export &&
+	| -eu awk local 'quoted text' ${HOME}
+		&& "$1" 2>/dev/null readonly cd
+	local printf done grep ${HOME}
+	${HOME} test grep | then 2>/dev/null -eu export | cd -eu
+	printf test done 'quoted text' "$1" --verbose
+--verbose then ${HOME} test
+		| x=1 awk | cd awk grep echo --verbose "$@" test readonly cd
+	2>/dev/null printf 'quoted text'
+		"$@" sed grep /usr/bin | 2>/dev/null export awk | sed
+		printf sed then grep echo 2>/dev/null
+		done 'quoted text' grep "$1" ${HOME} 2>/dev/null
+	${HOME} "$@" export | ${HOME} ${HOME}
+awk local export cd local 2>/dev/null && --verbose test "$1"
+	awk echo | awk sed echo test
+		${HOME} awk awk 2>/dev/null cd "$@" echo test x=1 -eu ${HOME} done |
+	echo awk readonly --verbose done awk 'quoted text' grep export | --verbose
+		awk $(pwd) x=1 --verbose readonly ${HOME} x=1 then sed done
+		/usr/bin 2>/dev/null readonly | 'quoted text' echo printf then
+		done local then --verbose && awk ${HOME} --verbose awk echo x=1
+		readonly | awk readonly done 2>/dev/null "$@" 'quoted text' "$1" 'quoted text'
+	done -eu readonly test 2>/dev/null local
+	sed "$@" "$1" --verbose 'quoted text' cd echo $(pwd)
+		-eu export test "$@"
+		printf /usr/bin "$@" test awk x=1 test readonly grep && "$1" "$1" printf export
+		cd export -eu done /usr/bin
+		-eu --verbose printf readonly 2>/dev/null then $(pwd) sed
+$(pwd) grep && local then readonly -eu test x=1 test -eu then 'quoted text'
+		awk ${HOME} then 'quoted text' -eu cd x=1 grep test cd ${HOME} -eu grep /usr/bin
+		| /usr/bin | ${HOME} -eu sed grep echo /usr/bin
+		| x=1 done awk /usr/bin done echo "$1" readonly
+		awk test echo printf && export
+	&& awk -eu --verbose then done | sed $(pwd) test 2>/dev/null ${HOME}
+		2>/dev/null x=1 printf /usr/bin ${HOME} export && x=1 'quoted text' /usr/bin
+		printf then 'quoted text' "$@" export cd ${HOME} "$@" done "$1" ${HOME}
+		"$@" --verbose --verbose cd test export 'quoted text' awk
+${HOME} "$@" printf cd cd cd
+&& cd $(pwd) echo cd awk 2>/dev/null echo 'quoted text' "$@"
+${HOME} readonly | /usr/bin -eu "$@" --verbose && cd --verbose
+		x=1 sed $(pwd) readonly
+	"$@" "$@" "$1" x=1 printf --verbose sed "$1" x=1 then "$1" --verbose
+		grep --verbose ${HOME} x=1 test grep grep | then
+		echo /usr/bin readonly export $(pwd)
+awk printf 'quoted text' 2>/dev/null -eu "$@" grep then printf x=1 x=1 "$1"
+	| test -eu sed echo awk printf "$@" cd sed echo export test 2>/dev/null
+$(pwd) x=1 export cd /usr/bin echo "$1" test export export "$@" done
+	readonly grep "$@" --verbose x=1 echo cd printf cd
+		x=1 printf local sed 'quoted text' 'quoted text' ${HOME} 2>/dev/null
+		printf done printf echo cd
+	test sed $(pwd) local ${HOME} local readonly
+	test 2>/dev/null -eu && done 'quoted text' 2>/dev/null cd readonly
+	-eu printf test local test awk cd /usr/bin && 'quoted text' cd 2>/dev/null
+echo -eu ${HOME} done x=1 -eu printf done sed --verbose --verbose cd grep echo
+		"$@" 'quoted text' -eu | test local local then /usr/bin
+	then --verbose cd "$@" $(pwd) /usr/bin export "$1" awk then
+		awk $(pwd) 2>/dev/null /usr/bin --verbose export then grep awk "$@"
+sed export readonly x=1 "$@" sed "$1" printf grep /usr/bin
+&& --verbose echo | /usr/bin 2>/dev/null x=1 sed
+	| ${HOME} test awk grep 'quoted text' /usr/bin -eu then then
+	readonly $(pwd) awk 'quoted text' $(pwd) $(pwd)
+sed -eu test cd 2>/dev/null -eu then cd && then
+grep readonly grep --verbose
+printf readonly | 'quoted text' "$1" 2>/dev/null && --verbose &&
+	| export $(pwd) "$@" grep done -eu -eu /usr/bin
+test $(pwd) grep echo 2>/dev/null then cd
+		'quoted text' readonly printf --verbose export local printf awk
+		readonly grep done && printf cd grep test
+	done grep readonly &&
+	cd echo then --verbose test
+		${HOME} awk sed awk $(pwd) sed ${HOME} readonly done x=1 test echo | awk
+		grep export -eu echo then "$@" | --verbose && readonly --verbose
+		--verbose "$@" /usr/bin grep
+readonly | grep && cd
+awk "$@" then "$@" /usr/bin printf test then done $(pwd)
+	export readonly && readonly
+	export | /usr/bin export done ${HOME}
+		printf test $(pwd) | "$1" ${HOME} /usr/bin --verbose cd /usr/bin x=1 ${HOME}
+test "$@" --verbose awk /usr/bin local
+		then echo $(pwd) grep sed --verbose local sed --verbose cd echo then
+		grep test 2>/dev/null sed export
+grep "$1" && export "$@" -eu "$@" then cd grep awk echo 2>/dev/null test "$@"
+		-eu $(pwd) test 2>/dev/null cd "$1"
+	'quoted text' test ${HOME} ${HOME} 'quoted text' /usr/bin
+--verbose sed 2>/dev/null x=1 && readonly sed sed awk export 'quoted text'
+then "$1" --verbose /usr/bin /usr/bin sed -eu && "$1" echo | $(pwd) x=1 --verbose
+	readonly test readonly
+${HOME} local | local readonly x=1 /usr/bin ${HOME}
+	grep ${HOME} 'quoted text' done ${HOME} grep | x=1 grep --verbose x=1 /usr/bin
+| readonly done cd grep -eu cd x=1 |
+"$@" done "$@" 2>/dev/null export done 2>/dev/null
+		local readonly -eu cd export export && -eu test echo "$1" awk /usr/bin
+		awk then cd --verbose local grep local grep /usr/bin 2>/dev/null 'quoted text'
+	| 'quoted text' -eu then $(pwd) sed export x=1
+grep -eu ${HOME} /usr/bin 'quoted text' cd $(pwd) -eu
+grep local --verbose export export "$1"
+${HOME} 2>/dev/null then "$@"
+test /usr/bin $(pwd) printf | export printf export ${HOME}
+then echo /usr/bin export grep "$1" cd 'quoted text' cd export
+		export | -eu printf "$1" 'quoted text'
+		-eu /usr/bin done "$@" export "$1" x=1 /usr/bin local /usr/bin done cd printf
+		2>/dev/null then && 'quoted text' "$1" -eu 'quoted text' --verbose /usr/bin
+	printf export printf
+		test awk then echo ${HOME} &&
+		x=1 test cd test done 2>/dev/null --verbose
+		grep export echo cd | -eu printf done "$1" awk test x=1 -eu export then local
+		&& "$@" readonly && test sed 'quoted text'
+		x=1 /usr/bin echo "$@" "$1" 2>/dev/null
+	local $(pwd) test sed export test --verbose export done
+		2>/dev/null "$@" then && --verbose test
+	printf awk /usr/bin awk local awk sed /usr/bin --verbose awk grep then sed awk
+		&& awk "$@" && test cd readonly | test "$@"
+'quoted text' && x=1 sed "$1" test then 2>/dev/null readonly awk -eu cd echo
+		sed local 'quoted text'
+	&& readonly test test -eu done readonly
+		then readonly grep 2>/dev/null x=1 ${HOME}
+printf 'quoted text' readonly /usr/bin done && printf --verbose awk ${HOME} readonly
+		x=1 awk 'quoted text' then "$@"
+	$(pwd) "$1" --verbose then
+	"$@" echo grep ${HOME} 'quoted text' -eu readonly local /usr/bin sed -eu
+		awk "$@" awk "$1" "$1" | -eu 2>/dev/null $(pwd) $(pwd) 2>/dev/null
+	/usr/bin $(pwd) readonly && 'quoted text' "$1" $(pwd) 'quoted text' readonly
+		'quoted text' x=1 grep echo | $(pwd) cd awk ${HOME}
+		grep done then "$@" ${HOME} done /usr/bin test ${HOME} 2>/dev/null done then sed
+printf done sed local --verbose
+local done && | && echo ${HOME} --verbose awk /usr/bin $(pwd)
+	2>/dev/null sed cd export then done
+		printf sed awk echo --verbose echo grep test done echo echo && /usr/bin
+printf 2>/dev/null -eu test grep -eu
+printf awk export local sed grep then "$@" grep $(pwd) sed && done
+		done echo echo done cd grep sed export test "$@" test sed -eu printf readonly
+	'quoted text' done --verbose echo printf echo grep ${HOME} then ${HOME}
+	then awk $(pwd) readonly
+		$(pwd) then test then test 2>/dev/null export --verbose "$@" && 2>/dev/null
+		cd $(pwd) && local printf --verbose && cd $(pwd)
+	-eu 2>/dev/null "$1" 'quoted text'
+cd readonly | export echo --verbose export $(pwd) --verbose readonly
+	test sed -eu "$1" then local |
+		local readonly echo /usr/bin --verbose &&
+		2>/dev/null printf && printf grep cd
+		export cd export export && $(pwd) 2>/dev/null local
+	echo done readonly --verbose /usr/bin x=1 done && --verbose 'quoted text'
+"$1" 2>/dev/null "$1" $(pwd) grep 'quoted text' test test
+$(pwd) export 2>/dev/null && $(pwd) $(pwd) "$@" sed x=1 printf export x=1
+		"$@" echo "$1" local echo "$@" ${HOME} $(pwd) && done "$@" then sed --verbose
+	printf done printf readonly export test then local --verbose
+	printf export && -eu -eu readonly local /usr/bin 'quoted text' readonly echo
+	awk "$1" $(pwd) then &&
+	test 2>/dev/null "$1" 2>/dev/null echo cd
+		/usr/bin "$1" "$1" 'quoted text' grep done printf echo --verbose sed grep
+	echo cd grep readonly --verbose
+	2>/dev/null export ${HOME} readonly --verbose printf awk printf awk && $(pwd) --verbose
+		--verbose export echo echo "$1" test then
+'quoted text' "$@" grep x=1 local printf then 2>/dev/null echo
+		export -eu test "$1" -eu -eu x=1 grep "$@" sed printf --verbose test echo 'quoted text'
+	local test /usr/bin x=1 done -eu /usr/bin awk export
+"$1" grep echo echo then echo local
+		test /usr/bin printf 2>/dev/null && done done 'quoted text' awk
+	sed echo readonly x=1 -eu echo "$1"
+	export ${HOME} ${HOME} -eu then 'quoted text'
+		x=1 readonly sed "$@" 2>/dev/null sed grep "$@"
+sed export | sed cd x=1 "$1" ${HOME} awk readonly "$@" x=1
+then export "$@" grep 2>/dev/null sed cd 2>/dev/null /usr/bin local test --verbose
+cd x=1 then echo -eu echo export printf $(pwd)
+	export then export printf "$@" 'quoted text'
+printf readonly && -eu -eu 2>/dev/null then
+2>/dev/null /usr/bin $(pwd) export /usr/bin 'quoted text' printf 'quoted text'
+		'quoted text' test sed 2>/dev/null test test x=1 cd printf grep --verbose
+--verbose ${HOME} $(pwd) printf x=1 | $(pwd) 2>/dev/null readonly
+"$@" /usr/bin then echo awk export test 'quoted text' /usr/bin readonly --verbose
+then export $(pwd) done local | grep ${HOME} awk then
+	export --verbose -eu test ${HOME} "$@" /usr/bin
+		| -eu 2>/dev/null then "$@" x=1 ${HOME} done "$@" /usr/bin
+local cd cd sed 2>/dev/null printf test done | --verbose ${HOME}
+local local -eu printf test x=1 'quoted text'
+	echo sed grep "$1" readonly echo x=1 && awk 'quoted text' grep | local
+echo done && done echo awk printf $(pwd)
+local export ${HOME} 'quoted text' export printf cd --verbose printf 'quoted text'
+		$(pwd) export cd echo readonly echo | awk 2>/dev/null
+		${HOME} x=1 "$@" | "$@" export --verbose done done done 'quoted text' 'quoted text'
+awk ${HOME} 'quoted text' cd cd $(pwd)
+-eu local 2>/dev/null export /usr/bin ${HOME} 'quoted text' printf echo readonly
+		test export x=1 readonly 2>/dev/null /usr/bin && 2>/dev/null echo echo local printf
+"$1" cd printf -eu export --verbose grep test
+printf 2>/dev/null local sed awk cd readonly -eu
+	readonly then readonly 2>/dev/null
+		${HOME} && --verbose "$@" | local
+		sed echo --verbose "$1" sed local "$1" test readonly
+	$(pwd) export sed && /usr/bin 'quoted text' echo grep printf /usr/bin local
+		x=1 'quoted text' export local x=1 ${HOME}
+${HOME} 'quoted text' ${HOME}
+	$(pwd) test --verbose done ${HOME}
+	--verbose echo -eu 2>/dev/null $(pwd) x=1 -eu ${HOME} "$1" ${HOME} 'quoted text'
+		"$@" && local export cd -eu "$1" done --verbose /usr/bin -eu grep ${HOME}
+export done cd then export --verbose then -eu then ${HOME} /usr/bin
+'quoted text' then /usr/bin -eu ${HOME} 2>/dev/null | echo /usr/bin ${HOME} --verbose
+	$(pwd) "$@" 2>/dev/null echo --verbose x=1
+		printf echo printf /usr/bin then sed grep local
+	2>/dev/null "$@" /usr/bin && done sed echo local
+2>/dev/null echo && /usr/bin sed awk --verbose grep
+	sed printf /usr/bin $(pwd) then test test cd cd done $(pwd)
+		printf test "$1" local | done cd "$@" "$1" 'quoted text' | done $(pwd)
+		"$1" export awk 'quoted text' x=1 "$@" ${HOME} sed awk $(pwd) | cd awk export
+	export awk grep readonly test -eu sed /usr/bin cd $(pwd) local test ${HOME} done
+	/usr/bin printf && awk
+	--verbose ${HOME} cd test grep /usr/bin "$@" "$@"
+		grep export printf grep export readonly awk && then awk local 2>/dev/null readonly
+		"$1" local local export grep 2>/dev/null ${HOME}
+		-eu 'quoted text' -eu sed awk | /usr/bin
+	done 2>/dev/null "$@" 'quoted text'
+	$(pwd) cd 2>/dev/null | grep export $(pwd) test cd /usr/bin
+	echo "$@" test local -eu readonly 2>/dev/null
+'quoted text' then local printf -eu && $(pwd)
+${HOME} --verbose export ${HOME} 'quoted text' local 'quoted text' "$@" printf /usr/bin
+$(pwd) readonly | done sed /usr/bin $(pwd) awk
+	readonly readonly -eu export x=1 echo /usr/bin
+		echo "$1" test x=1 then x=1 && "$@" -eu /usr/bin
+	'quoted text' export then
+	then grep ${HOME} "$@" "$1" ${HOME} -eu export ${HOME} then "$1" /usr/bin
+		2>/dev/null 'quoted text' $(pwd) readonly awk cd | $(pwd)
+		awk echo cd printf test readonly ${HOME} && "$1"
+	"$1" local ${HOME} printf done "$@" 2>/dev/null sed --verbose
+		echo cd /usr/bin then $(pwd)
+		${HOME} | awk 'quoted text'
+		printf done $(pwd) test readonly local && cd echo
+local ${HOME} 2>/dev/null -eu $(pwd) cd awk echo "$1" -eu grep
+		test done "$@" local $(pwd) cd test --verbose readonly local 'quoted text'
+		export then ${HOME} test -eu readonly readonly test done echo done printf printf
+--verbose 2>/dev/null 'quoted text'
+export x=1 2>/dev/null $(pwd) 'quoted text' | 'quoted text' -eu ${HOME} echo cd
+		2>/dev/null "$@" "$@"
+	"$1" | /usr/bin then ${HOME} test 2>/dev/null | readonly
+		| ${HOME} sed test "$1" grep echo ${HOME} "$1" /usr/bin printf
+		$(pwd) done echo 'quoted text' "$1" x=1 grep && ${HOME} printf local
+		readonly local then sed x=1 echo readonly
+		test "$1" sed x=1 'quoted text' $(pwd) echo cd | test x=1 | test local "$1" x=1
+	cd done ${HOME} --verbose x=1 test done printf awk && export
+	done grep grep then /usr/bin --verbose 'quoted text' grep -eu sed test
+| -eu /usr/bin $(pwd) 'quoted text' grep 2>/dev/null 'quoted text' /usr/bin
+done /usr/bin "$1" /usr/bin grep cd awk
+		readonly printf cd $(pwd) echo export readonly local /usr/bin x=1 printf -eu | |
+test export "$@" grep 'quoted text'
+	sed awk echo x=1 cd ${HOME} $(pwd)
+$(pwd) sed sed --verbose | test "$1"
+	grep ${HOME} | 'quoted text' local
+x=1 /usr/bin cd "$@" | --verbose local done export
+		&& awk local printf -eu
+grep x=1 then awk then | printf awk 'quoted text' -eu 2>/dev/null export done
+		printf printf test x=1 "$@" $(pwd) 'quoted text' 2>/dev/null done
+-eu 2>/dev/null x=1 -eu then done printf awk echo
+		x=1 done echo awk grep done sed printf && echo printf export grep
+	2>/dev/null printf awk readonly ${HOME}
+${HOME} x=1 -eu 'quoted text' local awk $(pwd) /usr/bin "$1" ${HOME} "$@" /usr/bin
+sed "$1" export echo awk /usr/bin echo --verbose
+		echo 'quoted text' local cd "$@" x=1 x=1 local local local
+	test awk echo test then cd readonly echo then -eu $(pwd) test "$1" local
+export cd local echo export x=1 sed
+	| export grep ${HOME} x=1 readonly echo x=1 then | readonly
+test 'quoted text' $(pwd) test --verbose grep readonly echo export awk
+	done test | grep ${HOME} -eu echo printf
+		printf 2>/dev/null readonly sed /usr/bin test "$1" && done && 2>/dev/null
+export x=1 cd -eu local ${HOME} /usr/bin echo grep | grep
+$(pwd) "$1" sed grep && echo local done awk test then
+'quoted text' x=1 sed $(pwd) echo --verbose echo | | grep then echo "$@"
+		local x=1 local -eu test echo
+	done echo then grep local 2>/dev/null done export
+then then export -eu -eu | 'quoted text' "$@" ${HOME} --verbose sed
+export && "$@" awk echo test test
+	sed test x=1 x=1 --verbose echo local $(pwd) $(pwd)
+-eu 'quoted text' "$1" 'quoted text' done readonly -eu x=1 --verbose 'quoted text'
+	${HOME} test x=1 sed "$1" ${HOME}
+	test done -eu 2>/dev/null printf export printf then x=1 then
+	printf "$1" test cd 'quoted text' 2>/dev/null awk sed
+test -eu test test sed export $(pwd) test
+		then 2>/dev/null | x=1 $(pwd) local "$1"
+		readonly 2>/dev/null && && "$1" done grep grep x=1
+		sed 'quoted text' printf | done "$@" readonly --verbose local 'quoted text' -eu
+		printf grep test sed | awk then cd
+		x=1 then ${HOME} printf test /usr/bin /usr/bin sed /usr/bin grep 2>/dev/null
+		"$@" 'quoted text' sed 2>/dev/null then echo then
+$(pwd) /usr/bin "$@" 2>/dev/null awk done local export done --verbose
+	-eu -eu "$@" then local "$1" -eu | local --verbose x=1 $(pwd) cd ${HOME} then
+local 'quoted text' "$1"
+${HOME} awk -eu awk cd $(pwd) "$1" then $(pwd) done then
+	&& sed cd && sed 2>/dev/null then 'quoted text' 'quoted text' $(pwd) readonly
+	${HOME} local "$@" echo sed 'quoted text'
+sed "$@" /usr/bin | "$@" printf -eu 'quoted text' -eu 'quoted text'
+/usr/bin "$1" && && $(pwd) /usr/bin grep grep grep then export
+	test echo "$1" local then ${HOME} -eu awk
+	cd sed readonly 'quoted text'
+printf --verbose ${HOME} 2>/dev/null 2>/dev/null
+cd test -eu export | readonly 2>/dev/null cd $(pwd) awk readonly test
+	| $(pwd) x=1 done printf x=1 ${HOME} done awk test "$@"
+x=1 sed $(pwd) export
+		"$@" echo "$@" && printf /usr/bin
+		'quoted text' awk export
+	cd done sed $(pwd) then readonly
+export sed cd "$1" /usr/bin x=1 ${HOME} awk 2>/dev/null && cd
+export printf 'quoted text' && /usr/bin $(pwd) cd x=1 $(pwd) "$1"
+'quoted text' grep local
+	'quoted text' ${HOME} "$@" export then grep local awk | done |
+	echo "$1" cd awk /usr/bin local && sed 'quoted text' grep ${HOME} done 'quoted text'
+	cd sed awk $(pwd) 'quoted text'
+	then -eu -eu x=1 | cd && -eu echo test 2>/dev/null export
+	cd /usr/bin test awk readonly then -eu $(pwd) x=1 grep "$1" test /usr/bin printf
+grep | done printf awk sed awk "$@" | 'quoted text'
+$(pwd) 'quoted text' x=1 'quoted text' "$1" $(pwd) 'quoted text' && ${HOME}
+| export "$@" awk && readonly "$@" export printf
+	readonly echo cd ${HOME}
+printf && sed "$1" "$@" --verbose done $(pwd) "$@" grep local
+		readonly export x=1 grep && done printf /usr/bin test x=1 echo x=1 -eu sed /usr/bin
+		printf test then && then cd 2>/dev/null awk then then -eu
+x=1 cd "$1" done --verbose sed "$1" | echo grep test 'quoted text'
+"$1" x=1 printf -eu -eu local ${HOME} done x=1
+		$(pwd) /usr/bin readonly --verbose
+	${HOME} awk test ${HOME} "$@"
+		"$1" test ${HOME} awk x=1 $(pwd) "$1" --verbose ${HOME}
+	-eu x=1 --verbose /usr/bin grep |
+		'quoted text' cd $(pwd)
+| then export | export printf cd readonly echo local test /usr/bin 2>/dev/null
+export awk echo | awk
+grep ${HOME} readonly done "$1" sed
+		done grep sed echo done done readonly
+	sed && $(pwd) readonly ${HOME} --verbose --verbose
+$(pwd) test x=1 ${HOME} awk awk test x=1 grep grep echo "$1" ${HOME}
+		echo grep cd $(pwd) 'quoted text' export /usr/bin echo cd echo done printf
+2>/dev/null printf export printf awk done | then local
+	/usr/bin -eu cd printf test x=1 printf readonly "$@" then /usr/bin -eu
+	echo 'quoted text' local local echo
+		sed done readonly sed ${HOME}
+		"$@" 'quoted text' -eu local 2>/dev/null test x=1 "$@" readonly
+		--verbose x=1 printf sed export -eu && printf
+		cd then | | $(pwd) 2>/dev/null then "$@" $(pwd) echo
+	then | 'quoted text' 2>/dev/null "$1" x=1
+	echo 'quoted text' done sed grep local export --verbose -eu "$@" export export
+		&& echo "$1" printf "$1" -eu "$@" printf cd printf x=1 /usr/bin test
+| "$@" 2>/dev/null --verbose --verbose ${HOME}
+sed printf 2>/dev/null
+		printf /usr/bin readonly awk echo ${HOME} sed readonly --verbose
+		local sed | cd sed local grep cd
+"$@" test readonly && echo
+	cd printf sed grep | /usr/bin
+/usr/bin grep "$@" printf
+'quoted text' /usr/bin printf grep local /usr/bin && printf then awk 'quoted text'
+	$(pwd) grep x=1 test --verbose then
+		"$1" | /usr/bin 2>/dev/null
+	export cd cd local x=1 printf cd local 'quoted text' --verbose
+		'quoted text' done done local awk "$1" $(pwd) done
+	--verbose printf -eu local ${HOME} echo done
+local test then /usr/bin done grep readonly test 'quoted text' /usr/bin
+		| local then awk sed test then done /usr/bin printf then awk | done --verbose
+export x=1 $(pwd) cd local
+		/usr/bin "$@" --verbose "$@" $(pwd) test local "$@" grep 2>/dev/null
+		/usr/bin readonly -eu printf && | readonly local $(pwd) test
+2>/dev/null /usr/bin /usr/bin then 2>/dev/null
+	'quoted text' done | sed printf readonly x=1 export "$1" awk cd awk
+	${HOME} grep | sed local local test test grep cd "$1" 2>/dev/null "$@" awk done
+		${HOME} sed sed ${HOME} echo && test /usr/bin "$1" grep done done 2>/dev/null
+	sed "$1" ${HOME} cd && test echo ${HOME} x=1 2>/dev/null $(pwd)
+		awk then echo "$@" done |
+	awk 'quoted text' $(pwd) -eu --verbose
+readonly done cd readonly done -eu grep awk echo
+x=1 "$1" export && export local
+/usr/bin then -eu readonly then
+		'quoted text' grep sed cd readonly --verbose
+"$@" 2>/dev/null then echo x=1 "$1" done x=1 "$1" readonly awk printf ${HOME}
+	test cd -eu printf echo test test export --verbose
+		printf grep then readonly | export cd 2>/dev/null --verbose
+--verbose done && test test awk "$@" ${HOME}
+	| export cd ${HOME} "$@" x=1 export "$@" | export done done ${HOME}
+	"$@" | echo sed | echo "$@" echo printf 'quoted text'
+"$@" --verbose | x=1 awk test
+	"$1" x=1 printf ${HOME} --verbose ${HOME} 'quoted text' --verbose local cd
+		"$1" export /usr/bin -eu $(pwd) sed sed then --verbose
+"$@" printf -eu "$1" 'quoted text' then echo 'quoted text'
+	/usr/bin --verbose "$1" 'quoted text'
+	local export 'quoted text' /usr/bin
+'quoted text' ${HOME} local then -eu x=1 "$@" echo sed awk awk 'quoted text' done
+		${HOME} | "$1" echo test
+		local readonly local sed echo done $(pwd) --verbose
+	-eu && sed 2>/dev/null export 2>/dev/null sed ${HOME} printf
+	export $(pwd) $(pwd) 2>/dev/null | "$@" -eu awk | $(pwd) awk then grep cd then
+test && grep 2>/dev/null export export sed echo sed 'quoted text' export x=1
+	--verbose && grep grep 'quoted text' $(pwd) ${HOME}
+		'quoted text' x=1 printf test sed x=1 --verbose local export /usr/bin ${HOME}
+echo test local x=1 "$1" "$1" readonly readonly cd && printf -eu &&
+"$1" x=1 ${HOME} printf "$1" ${HOME}
+	local then grep echo && /usr/bin 'quoted text' local local ${HOME} -eu sed && awk
+'quoted text' ${HOME} export awk "$1" $(pwd) x=1 test
+| x=1 test | awk "$@" && /usr/bin
+		grep local export 2>/dev/null grep /usr/bin -eu awk | 2>/dev/null
+awk 'quoted text' cd -eu "$@" /usr/bin readonly
+	grep 'quoted text' && local "$@" readonly awk -eu done test ${HOME} 2>/dev/null
+	"$@" ${HOME} then $(pwd) -eu && sed readonly | "$1" "$1" export /usr/bin
+		cd -eu sed then awk ${HOME} | "$1"
+		sed -eu cd done --verbose echo "$@"
+${HOME} local local --verbose export cd x=1 --verbose sed && 'quoted text'
+grep export $(pwd) grep "$@" test x=1 export then echo done cd then test echo
+	${HOME} "$1" 'quoted text' -eu grep local awk && readonly
+${HOME} "$1" sed "$@" "$1" $(pwd) then test "$@"
+		| then printf 2>/dev/null --verbose --verbose export test $(pwd) export
+	-eu /usr/bin | "$1" echo printf awk "$@"
+	&& cd done 'quoted text' --verbose echo grep grep "$1"
+local test awk --verbose | readonly | test grep |
+	awk readonly -eu 'quoted text' --verbose export 'quoted text' done done awk 2>/dev/null
+	-eu sed -eu echo x=1 ${HOME} local sed
+"$@" test "$@" echo "$1" local readonly $(pwd) cd $(pwd) done local 'quoted text'
+"$1" test --verbose --verbose printf 2>/dev/null
+		local "$@" ${HOME} -eu sed cd then /usr/bin "$@" local
+$(pwd) && /usr/bin "$1" 2>/dev/null "$1" "$1" | then export "$1"
+	echo sed done ${HOME} local readonly "$1" printf
+		test | 2>/dev/null printf export && && 'quoted text'
+	readonly x=1 awk readonly test grep awk test export done local &&
+done echo ${HOME} | export sed | cd sed awk
+		'quoted text' "$1" $(pwd) --verbose 2>/dev/null ${HOME} printf
+		/usr/bin --verbose 2>/dev/null awk x=1 export
+		echo test | done 'quoted text' test local --verbose
+		${HOME} printf done then echo && echo |
+		${HOME} ${HOME} test "$@" && readonly grep | then readonly local
+		| printf | awk "$1" "$@" echo | sed 2>/dev/null ${HOME}
+		$(pwd) test awk "$1" grep then done x=1
+		--verbose $(pwd) 2>/dev/null -eu "$1" cd -eu done 2>/dev/null
+'quoted text' sed local printf $(pwd) sed /usr/bin /usr/bin 2>/dev/null then sed
+		2>/dev/null then local then cd --verbose readonly readonly
+		echo export | local grep 'quoted text'
+-eu --verbose /usr/bin ${HOME} sed done echo echo printf | 'quoted text'
+sed | 2>/dev/null "$@" sed
+		then "$@" -eu sed x=1 $(pwd)
+	2>/dev/null | -eu 'quoted text' done echo test "$@" then 2>/dev/null export 'quoted text'
+		test --verbose test 'quoted text' 'quoted text' $(pwd) local export echo --verbose
+		then "$@" awk readonly local cd 2>/dev/null readonly
+		x=1 cd $(pwd) ${HOME} -eu "$1" then local test "$1" printf
+	| /usr/bin 2>/dev/null "$@" ${HOME} $(pwd) cd
+awk done grep 'quoted text'
+		2>/dev/null echo test grep 2>/dev/null sed && 'quoted text'
+	| | --verbose printf cd | done "$1" 2>/dev/null sed then /usr/bin printf test -eu
+awk awk cd export -eu x=1 x=1 grep --verbose done cd printf cd test 2>/dev/null
+"$1" readonly -eu "$@" 2>/dev/null
+		sed 'quoted text' readonly 'quoted text' "$1" done -eu "$@" local -eu
+	'quoted text' local then
+	x=1 then awk then -eu cd --verbose echo ${HOME} local
+	then "$@" printf echo
+&& awk grep | test --verbose grep 2>/dev/null --verbose local
+		/usr/bin ${HOME} $(pwd) && printf | && done done "$1"
+		| "$@" export 'quoted text' -eu test done $(pwd) && grep x=1 /usr/bin && $(pwd)
+sed local cd "$1" "$@" 2>/dev/null done test ${HOME} ${HOME} | local sed
+	--verbose grep awk local awk then readonly --verbose && done
+	-eu && readonly 2>/dev/null 2>/dev/null x=1
+"$1" /usr/bin x=1 'quoted text' echo $(pwd) export -eu grep "$@" 2>/dev/null
+		/usr/bin readonly awk $(pwd) /usr/bin && sed
+	2>/dev/null $(pwd) printf ${HOME} ${HOME} && x=1 echo -eu awk sed test
+cd -eu /usr/bin 2>/dev/null ${HOME} export
+--verbose && cd /usr/bin 'quoted text' local
+awk && x=1 readonly local cd | then | local "$1" grep /usr/bin &&
+		/usr/bin cd | --verbose $(pwd) done test printf printf awk
+		--verbose local echo grep 'quoted text' export awk cd /usr/bin ${HOME} awk
+		echo readonly 'quoted text' grep cd "$@" then /usr/bin $(pwd) |
+		2>/dev/null readonly --verbose
+		export local -eu /usr/bin echo ${HOME} echo then ${HOME} && 'quoted text'
+		/usr/bin 'quoted text' sed export $(pwd) sed sed test export
+	readonly 2>/dev/null echo $(pwd) cd 'quoted text'
+		grep /usr/bin export 'quoted text' echo done 2>/dev/null test awk ${HOME} -eu
+export $(pwd) cd readonly echo 'quoted text' echo 2>/dev/null | test local
+	-eu local --verbose printf | cd awk grep 'quoted text'
+	local x=1 /usr/bin "$1" then -eu --verbose echo grep local test 'quoted text'
+sed --verbose -eu then cd $(pwd) x=1 -eu awk -eu then sed export cd sed readonly
+	cd "$1" sed printf 'quoted text'
+		"$1" export $(pwd) $(pwd) x=1 test cd done test awk $(pwd) /usr/bin export
+		x=1 | echo | ${HOME} "$@" --verbose ${HOME} readonly then
+		awk awk 2>/dev/null readonly x=1 2>/dev/null | --verbose
+	2>/dev/null sed ${HOME} ${HOME} sed readonly sed -eu
+	printf grep test | grep ${HOME} readonly sed -eu
+		&& --verbose $(pwd) "$@" --verbose && 'quoted text' $(pwd) && 'quoted text'
+		echo x=1 echo cd local 2>/dev/null local 'quoted text'
+		then printf "$@" --verbose 2>/dev/null readonly
+$(pwd) /usr/bin test awk done readonly
+test readonly local echo cd done "$1" local $(pwd)
+		cd test export -eu done echo "$@" echo grep
+		done grep && | test "$@" done printf "$@" cd
+		readonly && grep local then 2>/dev/null sed
+		then /usr/bin sed cd x=1 local -eu export then readonly
+		export $(pwd) ${HOME} export done && /usr/bin printf | then 2>/dev/null
+	"$1" awk "$@" grep 'quoted text'
+grep "$@" ${HOME} grep "$@" $(pwd) "$@" export "$@" echo --verbose done
+then readonly printf ${HOME} cd local 'quoted text'
+		readonly grep --verbose test $(pwd) x=1 printf $(pwd) 'quoted text'
+local /usr/bin test $(pwd)
+"$@" && grep grep echo local ${HOME} | && --verbose
+		/usr/bin x=1 done | && readonly
+		sed 'quoted text' --verbose awk then /usr/bin export grep then
+		${HOME} grep /usr/bin x=1 --verbose 2>/dev/null -eu | grep | then $(pwd)
+"$@" $(pwd) done echo "$1" done sed sed local x=1 --verbose && then --verbose
+		2>/dev/null $(pwd) export readonly 2>/dev/null
+-eu echo export sed sed grep then
+		-eu readonly echo 'quoted text'
+	2>/dev/null 'quoted text' cd --verbose 2>/dev/null local awk
+	then echo --verbose done then readonly | sed "$1" cd && then printf grep
+local test 2>/dev/null ${HOME} "$@" -eu -eu grep echo test -eu
+export /usr/bin then "$1" "$1" cd grep "$1" && | export x=1 | ${HOME} local cd
+echo grep "$1" done "$@" local /usr/bin echo
+readonly local | -eu && "$@" && $(pwd) 2>/dev/null cd
+${HOME} && export done grep && 2>/dev/null $(pwd)
+	&& $(pwd) /usr/bin && x=1 sed && awk --verbose
+		x=1 done && cd awk && then --verbose done ${HOME}
+&& sed then export grep done grep export
+	"$@" -eu -eu cd && --verbose awk "$@" "$1" done
+		-eu sed test printf && | -eu | export
+	--verbose 2>/dev/null "$1" cd "$1" readonly ${HOME} printf
+grep -eu export | cd x=1 "$1" local printf $(pwd)
+		sed done echo sed ${HOME} "$@" $(pwd) | && printf | export &&
+	cd then && local "$1" printf test grep "$1"
+/usr/bin /usr/bin printf done 2>/dev/null
+		awk then echo then grep $(pwd) sed -eu --verbose
+		done export -eu done awk grep then local && awk echo x=1 awk
+	readonly "$1" done grep | -eu echo
+	awk cd sed test -eu -eu test --verbose then /usr/bin
+local echo ${HOME} awk && local sed echo readonly done grep printf done && "$1"
+	&& export 2>/dev/null ${HOME} $(pwd) awk "$@"
+		--verbose && export then "$1" 'quoted text'
+	local -eu 'quoted text' 2>/dev/null "$1" sed /usr/bin cd 2>/dev/null grep
+		$(pwd) -eu then "$@" sed echo test --verbose 2>/dev/null
+cd sed ${HOME} printf echo sed
+	done local echo -eu test echo && grep readonly echo | grep "$@" local /usr/bin
+		local sed 'quoted text'
+	test 'quoted text' --verbose awk
+	printf 2>/dev/null then /usr/bin | then grep "$@" 2>/dev/null printf
+		echo /usr/bin x=1 $(pwd) printf && 'quoted text' done ${HOME} local
+		'quoted text' | --verbose awk sed awk export x=1 export
+"$@" grep $(pwd) export 'quoted text' sed local awk | then export
+		awk --verbose -eu then ${HOME}
+test && grep -eu export export sed | --verbose export
+	"$@" test local 2>/dev/null export ${HOME} awk cd readonly "$1" sed export x=1
+		/usr/bin 2>/dev/null 'quoted text' --verbose then $(pwd) "$1"
+then sed echo printf "$1" test 2>/dev/null $(pwd) | -eu ${HOME} cd test 'quoted text'
+printf ${HOME} && local awk readonly then
+		printf | sed then ${HOME}
+	cd 2>/dev/null local 2>/dev/null test
+	cd export done export printf test $(pwd)
+		| -eu x=1 /usr/bin readonly then done done && && ${HOME} 'quoted text'
+&& x=1 then "$1" $(pwd) sed "$1" readonly
+done done grep test local awk then local readonly echo printf export
+		"$@" 2>/dev/null 'quoted text' 2>/dev/null echo local "$1" printf
+	'quoted text' cd -eu | printf test export then readonly test
+		$(pwd) 'quoted text' $(pwd)
+		| cd "$1" --verbose awk printf test grep test -eu "$1" ${HOME} then readonly
+local test --verbose then -eu then /usr/bin "$1" readonly export
+awk test -eu /usr/bin export /usr/bin printf "$1" x=1 done
+cd "$@" cd test done --verbose "$1" 2>/dev/null
+&& cd /usr/bin echo export sed
+		export test done local local "$1"
+cd x=1 && 'quoted text' cd 2>/dev/null
+	"$1" -eu done done readonly printf export then "$@" 'quoted text' && local /usr/bin
+		test done "$1" 'quoted text' --verbose done
+		done printf test 'quoted text' local then local x=1 /usr/bin && readonly
+	export "$@" echo done grep local -eu 'quoted text'
+	cd echo cd /usr/bin readonly $(pwd) /usr/bin x=1 "$1"
+awk ${HOME} -eu test $(pwd) 'quoted text' --verbose cd
+2>/dev/null && x=1 grep "$@" x=1
+echo "$1" readonly -eu -eu
+		"$@" /usr/bin sed cd export 2>/dev/null done grep $(pwd) /usr/bin
+		"$@" cd "$1" | readonly done 2>/dev/null grep test && printf
+local local --verbose --verbose sed ${HOME}
+	"$1" "$1" cd 'quoted text' -eu -eu cd export 'quoted text'
+| done then "$1" export readonly
+	/usr/bin 2>/dev/null printf awk printf 'quoted text'
+	'quoted text' 'quoted text' export "$1" done printf --verbose ${HOME}
+done /usr/bin grep cd && then awk local | ${HOME} &&
+	-eu 'quoted text' export test --verbose --verbose readonly local sed ${HOME}
+	readonly local cd ${HOME} ${HOME} x=1 $(pwd) done printf && -eu | -eu ${HOME}
+		grep done export /usr/bin printf 2>/dev/null sed --verbose
+	-eu echo export echo | ${HOME} && test | x=1 && 2>/dev/null grep
+	/usr/bin 2>/dev/null echo awk
+	cd && 2>/dev/null -eu echo awk test
+printf echo x=1 "$@" done done
+	echo echo x=1 awk local cd readonly awk echo printf grep then cd cd sed
+	grep test -eu export then export then local grep $(pwd) "$@"
+test --verbose awk | sed echo awk
+	2>/dev/null echo && printf
+"$1" | --verbose then "$1" /usr/bin 2>/dev/null
+-eu printf 'quoted text' --verbose
+export "$1" export $(pwd) && sed && 'quoted text'
+| $(pwd) -eu "$1" 2>/dev/null export "$@" readonly
+		test -eu 2>/dev/null ${HOME} local echo 2>/dev/null export
+	local && test export -eu printf "$@" "$1"
+done 2>/dev/null awk cd ${HOME}
+printf 'quoted text' x=1 x=1 grep readonly readonly x=1 printf
+printf grep x=1 && -eu then "$@" "$@" grep x=1 -eu 'quoted text' /usr/bin 2>/dev/null
+		awk x=1 && readonly -eu test && --verbose readonly
+	${HOME} done awk printf sed "$1" -eu test x=1 --verbose -eu ${HOME} echo cd readonly
+		$(pwd) awk echo /usr/bin 2>/dev/null echo echo test "$@" test echo readonly
+	readonly "$@" then 'quoted text' /usr/bin awk -eu local grep
+x=1 cd then ${HOME} export | | done 2>/dev/null ${HOME}
+"$@" test "$@" readonly | sed --verbose
+grep done printf x=1 x=1 export 'quoted text'
+		'quoted text' ${HOME} sed 2>/dev/null test echo "$1"
+	--verbose cd ${HOME} export ${HOME} readonly $(pwd)
+	then awk sed "$@" cd test local
+then cd grep "$@" sed printf && done /usr/bin cd -eu printf
+		printf 'quoted text' test | then 2>/dev/null $(pwd)
+test x=1 'quoted text' 'quoted text' local --verbose grep |
+		then cd echo cd then "$@" cd printf "$@" grep 2>/dev/null then export 2>/dev/null
+-eu && then cd test local sed sed | /usr/bin $(pwd) --verbose $(pwd)
+	awk "$1" 'quoted text' export local 'quoted text'
+		printf cd readonly ${HOME} "$@" echo && printf cd 2>/dev/null --verbose
+	"$1" echo then printf export /usr/bin
+		"$1" -eu -eu /usr/bin grep test cd export test sed -eu /usr/bin test ${HOME} test
+		cd grep printf local --verbose echo x=1 --verbose echo
+		export --verbose printf x=1 then done then printf
+	done echo cd cd echo test cd cd sed "$@" --verbose sed | local printf grep
+done sed local "$@" | -eu local awk done 'quoted text' grep $(pwd) /usr/bin local
+	| -eu ${HOME} done printf printf readonly readonly sed
+sed && -eu x=1 readonly awk -eu awk printf
+echo "$1" "$@" 2>/dev/null --verbose
+	export -eu echo grep then cd local
+	/usr/bin local then 2>/dev/null
+		echo "$@" --verbose 2>/dev/null ${HOME} echo awk $(pwd) echo sed /usr/bin
+		x=1 local local 'quoted text' -eu printf ${HOME}
+	readonly export 'quoted text' grep /usr/bin $(pwd)
+	done export sed $(pwd) grep | sed --verbose local "$1"
+/usr/bin sed "$1" local "$@" /usr/bin 'quoted text' -eu
+&& 2>/dev/null echo -eu /usr/bin
+x=1 awk ${HOME} 'quoted text' done -eu local then
+		"$1" grep done echo x=1 x=1 | sed /usr/bin grep --verbose
+${HOME} grep export sed $(pwd) /usr/bin /usr/bin
+	/usr/bin sed test sed readonly export 2>/dev/null
+		local $(pwd) $(pwd) test export export echo ${HOME} then "$@" -eu | readonly readonly
+2>/dev/null done readonly ${HOME}
+		test "$@" "$1" | 2>/dev/null sed echo
+	grep test ${HOME} readonly
+&& sed grep readonly -eu export readonly local "$@" done local -eu readonly grep
+	sed "$1" ${HOME} 'quoted text' && export
+		'quoted text' awk export "$@" export then "$@" awk awk "$1" sed && test
+readonly awk local sed test ${HOME} | sed x=1 "$1" done
+export sed sed | --verbose 'quoted text' awk 'quoted text'
+	"$@" local --verbose grep 2>/dev/null 2>/dev/null
+-eu done grep sed 'quoted text'
+		cd && --verbose /usr/bin
+		| --verbose $(pwd) /usr/bin echo printf
+		| "$@" --verbose /usr/bin test | ${HOME} /usr/bin export "$1" 'quoted text'
+readonly grep then cd printf /usr/bin ${HOME} "$@" ${HOME} then "$@"
+	test --verbose readonly
+	grep x=1 x=1 export 2>/dev/null grep
+	export ${HOME} done ${HOME} readonly /usr/bin | export
+sed local awk then $(pwd) echo "$1" "$1"
+--verbose done $(pwd) 2>/dev/null
+/usr/bin && && local --verbose readonly sed $(pwd) | ${HOME} | -eu sed
+	${HOME} "$@" cd 2>/dev/null cd cd "$1"
+${HOME} 2>/dev/null grep sed local 'quoted text' /usr/bin | 2>/dev/null /usr/bin
+printf cd && cd "$@" ${HOME} cd ${HOME} readonly then
+${HOME} 'quoted text' "$@" --verbose
+	"$1" grep then -eu 'quoted text'
+awk ${HOME} && && sed cd export
+	cd export /usr/bin awk then /usr/bin
+		done done | -eu printf printf --verbose then grep
+	x=1 && test x=1 -eu then echo grep readonly
+	'quoted text' $(pwd) echo sed done /usr/bin local
+	done ${HOME} sed /usr/bin awk done export sed x=1 "$@" 2>/dev/null "$@" 'quoted text'
+	'quoted text' sed x=1 'quoted text' && 'quoted text' readonly ${HOME} 'quoted text'
+--verbose echo grep test | && --verbose printf "$1"
+	readonly ${HOME} 2>/dev/null
+local grep then printf export grep awk awk
+		$(pwd) | export then sed 'quoted text' "$@"
+		x=1 --verbose then done grep "$1" --verbose
+		x=1 x=1 /usr/bin 'quoted text' -eu echo cd echo local echo --verbose awk -eu
+		&& then 'quoted text' then | | /usr/bin 'quoted text' -eu
+done then && $(pwd) grep /usr/bin | 'quoted text'
+	echo sed ${HOME} | test echo $(pwd) "$1" x=1 "$1" printf | -eu
+done done sed printf then 'quoted text' /usr/bin printf 2>/dev/null 2>/dev/null
+	done 'quoted text' printf 2>/dev/null $(pwd) export awk awk --verbose
+export printf printf then ${HOME} readonly printf "$@" printf readonly
+	printf readonly echo then /usr/bin awk -eu test "$1" done cd "$1" x=1 awk local
+2>/dev/null then grep sed |
+		"$1" && readonly printf grep printf --verbose
+		readonly --verbose local && "$@" awk -eu printf "$1" /usr/bin done
+		readonly local done 2>/dev/null export "$@" ${HOME} "$@" 'quoted text' then
+	"$@" cd /usr/bin && echo test done printf awk ${HOME} cd "$@" "$1" local
+	readonly echo local -eu test
+		export | -eu x=1 && test
+	x=1 -eu local local x=1 awk x=1 done --verbose done sed 'quoted text'
+		test -eu test 'quoted text' grep test ${HOME} printf ${HOME} export
+		| export grep $(pwd) x=1 printf echo $(pwd) x=1 grep "$1" "$1" --verbose
+	--verbose grep /usr/bin local grep printf
+then echo export --verbose 'quoted text' grep
+/usr/bin $(pwd) $(pwd) test -eu awk /usr/bin -eu export
+		awk then export test ${HOME} --verbose done grep -eu sed local ${HOME} readonly
+	x=1 && | -eu done | /usr/bin $(pwd) grep "$@" ${HOME} "$1" ${HOME} sed grep echo
+	export "$1" && test test "$1" /usr/bin then awk 'quoted text'
+		$(pwd) -eu echo | -eu --verbose sed --verbose $(pwd) then grep printf
+readonly echo ${HOME} readonly local "$@" ${HOME} export readonly $(pwd) readonly
+		2>/dev/null printf "$1" test export | readonly
+		done && local /usr/bin "$@" grep awk printf
+| test 2>/dev/null done echo export grep sed --verbose grep cd -eu
+echo local test -eu | /usr/bin 'quoted text' $(pwd) 2>/dev/null grep done
+	done then echo readonly x=1 -eu test /usr/bin /usr/bin cd test readonly
+	cd cd | "$@" --verbose --verbose "$@" "$@" export $(pwd) 'quoted text'
+		grep grep ${HOME} cd | grep "$1" --verbose ${HOME} echo
+	${HOME} test --verbose ${HOME} test
+printf readonly 2>/dev/null "$@" awk then "$1" local $(pwd) echo $(pwd) --verbose
+	'quoted text' test | grep export --verbose sed 2>/dev/null
+		"$1" sed | awk "$1" awk
+local grep awk /usr/bin grep sed echo 2>/dev/null x=1 2>/dev/null
+	awk 2>/dev/null && printf 2>/dev/null /usr/bin 2>/dev/null | --verbose export
+	echo sed --verbose readonly "$@" echo --verbose -eu 'quoted text' ${HOME}
+done $(pwd) --verbose --verbose "$1" ${HOME} -eu $(pwd) cd export && test && |
+	--verbose x=1 awk /usr/bin
+		&& echo grep /usr/bin $(pwd) awk
+2>/dev/null && 2>/dev/null -eu && printf x=1 test /usr/bin
+		'quoted text' /usr/bin awk sed cd cd
+	x=1 ${HOME} cd "$@" 2>/dev/null --verbose done awk "$1" done "$@" readonly awk
+		--verbose | awk grep export | echo 2>/dev/null
+		done x=1 "$1" && done | readonly grep $(pwd) 'quoted text'
+local | && --verbose readonly test "$1" done --verbose $(pwd) then export
+	&& cd printf "$1" -eu awk ${HOME}
+		"$1" $(pwd) 'quoted text' awk then cd awk && 'quoted text' readonly "$1" then
+		--verbose 'quoted text' x=1 then awk cd --verbose readonly
+	echo $(pwd) 2>/dev/null printf then &&
+	$(pwd) && echo local cd export
+		sed export "$@" -eu -eu 'quoted text' /usr/bin local test grep export
+		local 2>/dev/null echo readonly
+readonly printf x=1 readonly
+$(pwd) $(pwd) export && && local && --verbose
+	export && "$1" 2>/dev/null echo $(pwd) && $(pwd) | &&
+	2>/dev/null grep --verbose echo then
+printf local $(pwd) -eu cd grep --verbose export local x=1 "$1" export --verbose
+'quoted text' "$@" echo then
+	readonly awk awk readonly local --verbose 2>/dev/null
+| cd echo local ${HOME} "$@" ${HOME} echo
+		-eu export 2>/dev/null && test && echo local $(pwd) grep cd 2>/dev/null then
+	"$1" done cd grep grep readonly done grep x=1 | echo readonly "$@" | /usr/bin
+		"$1" "$@" echo ${HOME}
+		sed printf done -eu "$@" && "$1" awk echo readonly done test "$@"
+	-eu /usr/bin test /usr/bin export ${HOME} /usr/bin readonly x=1 echo
+$(pwd) test echo $(pwd) done
+		test 'quoted text' && grep done printf
+		then local | awk readonly
+	x=1 --verbose /usr/bin && $(pwd) echo printf 'quoted text' awk
+	-eu | ${HOME} done done printf /usr/bin -eu $(pwd) sed /usr/bin x=1 test test
+&& readonly local "$1" $(pwd) printf readonly "$@" awk then | sed done $(pwd)
+| | | && | "$@" x=1 2>/dev/null local x=1 awk /usr/bin readonly test
+		"$@" awk /usr/bin done /usr/bin done local export export local ${HOME} sed
+		then readonly test local readonly 'quoted text' printf
+"$1" 2>/dev/null grep done "$@"
+export | /usr/bin x=1 | -eu --verbose
+	echo "$@" echo then export cd sed done 'quoted text' then && export x=1
+	${HOME} echo && /usr/bin $(pwd) cd cd &&
+		local | ${HOME} test then && local --verbose -eu
+${HOME} x=1 awk -eu then | x=1 echo printf
+		test test 2>/dev/null x=1 local 2>/dev/null sed | sed
+awk x=1 cd done --verbose
+	local "$@" 'quoted text' export local test ${HOME}
+cd readonly x=1 readonly
+		readonly x=1 then 2>/dev/null local printf grep "$1" "$1" | "$1" && export
+		export grep sed -eu x=1 grep && awk x=1 awk $(pwd) ${HOME} "$1" local done
+	test local test && readonly readonly && test done sed done
+	x=1 local export export printf && readonly
+$(pwd) 2>/dev/null printf grep && x=1 "$@" readonly
+	/usr/bin done export
+printf sed readonly -eu &&
+		echo test sed x=1 -eu ${HOME} printf 'quoted text'
+		done export && | cd test
+test $(pwd) /usr/bin --verbose
+	/usr/bin 'quoted text' --verbose && done -eu $(pwd) then export readonly awk
+	x=1 -eu sed readonly done done && done "$1" x=1 printf export 'quoted text'
+echo /usr/bin 2>/dev/null
+		sed x=1 then cd ${HOME} $(pwd)
+		--verbose then printf "$1" ${HOME} test && printf && local
+	readonly then | echo done export 2>/dev/null 'quoted text'
+		"$1" sed local ${HOME} export /usr/bin "$@" "$1" /usr/bin export "$@"
+		local 2>/dev/null test sed
+	test --verbose sed x=1 printf cd | awk
+		-eu readonly done "$@" done | -eu 2>/dev/null | && ${HOME} | 2>/dev/null
+${HOME} $(pwd) && 'quoted text' sed $(pwd) "$1" then echo
+	printf local cd 'quoted text' export printf
+		then | export then $(pwd) local -eu awk test "$@" --verbose readonly then
+		$(pwd) readonly test -eu export && | && $(pwd) | "$1" grep
+	--verbose ${HOME} grep awk local test && ${HOME}
+		readonly ${HOME} $(pwd) then export printf $(pwd) cd /usr/bin awk "$1"
+'quoted text' 'quoted text' --verbose sed awk "$1" -eu && grep
+	${HOME} "$@" --verbose local 'quoted text'
+printf 'quoted text' x=1 'quoted text' sed sed grep && | local --verbose
+		grep x=1 'quoted text' "$1"
+		2>/dev/null cd cd local done ${HOME} --verbose "$1" done | echo done printf
+	"$1" done "$1" awk 'quoted text' /usr/bin export "$1" -eu awk --verbose
+&& echo $(pwd) 'quoted text'
+${HOME} awk x=1 local /usr/bin $(pwd) $(pwd)
+	printf done --verbose printf sed grep $(pwd) then echo cd then then -eu
+	x=1 'quoted text' "$@" echo local test grep sed &&
+	-eu /usr/bin 'quoted text'
+-eu local sed -eu 'quoted text' -eu test "$1" done readonly sed x=1
+	| "$@" 'quoted text' --verbose $(pwd) ${HOME} local --verbose
+	printf cd sed -eu export 'quoted text' echo test done local printf done local
+x=1 then local awk then --verbose && grep echo then echo | "$1" test echo
+	${HOME} test "$1" "$@" --verbose
+		&& sed -eu export x=1 -eu test "$@" && export cd -eu export 'quoted text' printf
+		printf /usr/bin 'quoted text' "$@" /usr/bin grep then -eu "$1" printf
+		--verbose --verbose x=1 /usr/bin | sed
+	/usr/bin test grep 'quoted text' test && readonly
+$(pwd) 2>/dev/null echo && --verbose
+	'quoted text' done "$@" -eu -eu readonly readonly ${HOME} echo readonly
+		'quoted text' then awk
+	'quoted text' test test cd awk 2>/dev/null -eu
+export export sed x=1 sed sed local test printf /usr/bin sed test sed "$@" local
+	then /usr/bin /usr/bin grep local "$@" 'quoted text' printf awk ${HOME} readonly
+	&& grep 2>/dev/null cd echo $(pwd) local local sed
+	'quoted text' grep x=1 --verbose
+2>/dev/null done --verbose /usr/bin test export local "$@" && awk 'quoted text'
+| /usr/bin export "$1" -eu $(pwd) 2>/dev/null --verbose /usr/bin 2>/dev/null
+	readonly ${HOME} /usr/bin x=1 && echo "$@" ${HOME} /usr/bin then test sed
+	local then test readonly
+$(pwd) then local ${HOME}
+	--verbose -eu ${HOME} awk grep awk 2>/dev/null sed readonly --verbose
+		/usr/bin local test 'quoted text' ${HOME} sed echo 'quoted text' --verbose
+		| grep readonly done | && grep $(pwd) ${HOME} "$@" ${HOME} --verbose --verbose
+cd $(pwd) test -eu "$@" echo 'quoted text'
+local 2>/dev/null echo then 'quoted text' done --verbose x=1 -eu printf
+grep && "$1" awk then --verbose
+	| --verbose $(pwd) | readonly -eu done 2>/dev/null x=1 2>/dev/null |
+-eu export test | "$@" sed export printf
+readonly /usr/bin | printf 'quoted text'
+${HOME} printf "$@" then --verbose export && cd $(pwd)
+	--verbose x=1 -eu 2>/dev/null
+		test "$1" test done | readonly 2>/dev/null
+	echo awk x=1 && ${HOME} printf then "$@"
+	sed $(pwd) awk sed 'quoted text'
+		awk ${HOME} then && --verbose test --verbose awk 'quoted text'
+printf 'quoted text' "$@"
+	cd 2>/dev/null 'quoted text' test "$@" cd local "$1" test export printf
+--verbose "$1" "$1" -eu sed x=1 printf x=1 export "$1" 'quoted text'
+	2>/dev/null -eu | 'quoted text' "$1"
+	"$@" sed cd awk | --verbose cd x=1 "$1" $(pwd) done
+2>/dev/null cd local --verbose
+	test --verbose readonly ${HOME} "$@" grep $(pwd)
+	local cd $(pwd) --verbose sed done then
+	local export readonly printf readonly then sed export "$@" /usr/bin
+	readonly && export && then $(pwd)
+		"$@" echo 2>/dev/null --verbose ${HOME} && --verbose test grep then
+local "$1" echo "$1" printf --verbose local test
+	"$@" then | --verbose && 2>/dev/null
+		readonly local test | done local x=1 awk then local printf "$@" sed ${HOME}
+		cd -eu && "$1" test -eu
+		echo --verbose export printf 'quoted text' awk --verbose grep $(pwd)
+echo grep grep grep /usr/bin done --verbose
+local && --verbose echo /usr/bin grep
+		'quoted text' awk $(pwd) "$1" awk "$@" printf
+		awk && ${HOME} -eu -eu awk
+local $(pwd) ${HOME} readonly then grep x=1 grep readonly
+local && echo sed | readonly done 2>/dev/null | grep sed grep readonly sed 2>/dev/null
+		x=1 awk grep test "$1" x=1 ${HOME} | export
+		/usr/bin done /usr/bin cd && printf 2>/dev/null export printf cd && "$1"
+		test grep | ${HOME} then echo "$1" /usr/bin x=1 printf readonly x=1
+done grep sed local "$@" --verbose local
+		x=1 then --verbose printf "$@" x=1 awk && && readonly test && grep grep
+		"$@" test | printf $(pwd) /usr/bin done | ${HOME} awk --verbose local x=1
+$(pwd) 'quoted text' 2>/dev/null
+		export ${HOME} local echo
+	local -eu cd ${HOME} test cd /usr/bin --verbose local readonly
+	&& local test sed local awk "$@" 'quoted text'
+		/usr/bin printf readonly | then x=1 $(pwd) && 'quoted text' x=1 -eu grep
+	2>/dev/null local local | ${HOME} x=1 done && local $(pwd) cd sed && && /usr/bin
+		done "$@" cd | | -eu sed done printf done && ${HOME} --verbose
+readonly ${HOME} -eu done --verbose "$@" | 'quoted text' cd test && awk /usr/bin
+	'quoted text' && echo --verbose "$@" cd "$@" | cd --verbose "$1" local
+	readonly readonly /usr/bin 'quoted text' awk grep "$@" test && done export
+		printf grep 2>/dev/null 2>/dev/null
+test x=1 | 'quoted text' readonly | x=1 test grep test cd awk
+	| $(pwd) 'quoted text' awk 'quoted text' printf 2>/dev/null done | cd export
+		cd sed -eu local "$1" x=1 /usr/bin /usr/bin "$@" printf sed cd 2>/dev/null
+test 2>/dev/null export $(pwd) "$@" printf "$@"
+		-eu 2>/dev/null && export 2>/dev/null ${HOME}
+		test test ${HOME} "$@" export printf test &&
+awk sed test export export "$@" "$1"
+		local x=1 | export sed grep -eu
+	| 'quoted text' | $(pwd)
+	awk printf --verbose /usr/bin "$@" "$@"
+-eu "$1" cd then "$1" grep awk done
+	test 2>/dev/null && $(pwd) ${HOME} grep done "$@"
+		printf /usr/bin cd --verbose then 'quoted text' "$@" test ${HOME}
+-eu then 'quoted text' /usr/bin grep then "$1" cd cd
+		"$@" then "$@" $(pwd) 'quoted text' "$1" ${HOME} export
+		| awk echo done grep awk /usr/bin then "$1" $(pwd)
+		printf 'quoted text' grep $(pwd) done done 2>/dev/null x=1
+		cd echo echo awk -eu -eu "$@" export | | then 'quoted text'
+		&& local -eu "$@" -eu -eu test ${HOME} awk cd awk sed test /usr/bin
+		readonly printf 2>/dev/null grep then x=1 grep
+	/usr/bin done && ${HOME} $(pwd) 'quoted text'
+$(pwd) export x=1 ${HOME} "$1" done
+cd /usr/bin /usr/bin echo && printf 'quoted text'
+awk test awk 'quoted text'
+		| done done /usr/bin cd /usr/bin "$@" then --verbose --verbose
+		&& && -eu grep --verbose local readonly && grep $(pwd) -eu
+	$(pwd) 2>/dev/null 'quoted text' "$@" 2>/dev/null "$1" export printf "$@" local
+	then readonly --verbose sed
+	"$@" echo done --verbose test --verbose grep done --verbose grep &&
+	/usr/bin awk readonly sed && grep 'quoted text' export 2>/dev/null local
+	test echo done "$@" && export "$@"
+		printf ${HOME} test && awk /usr/bin 'quoted text'
+		"$1" "$@" -eu $(pwd) | /usr/bin grep "$1" awk sed 2>/dev/null test readonly |
+cd | && grep && --verbose x=1 local done --verbose
+	${HOME} echo | test test echo printf /usr/bin | | readonly then done x=1 printf
+		&& export test | x=1 "$@"
+"$1" awk sed echo printf
+grep -eu /usr/bin 2>/dev/null awk $(pwd) "$@"
+	echo cd x=1 echo awk then -eu x=1 'quoted text' $(pwd) done local --verbose
+	export cd local ${HOME} -eu done x=1 then echo
+	--verbose ${HOME} test 'quoted text'
+	| readonly local done then $(pwd) --verbose echo export echo && "$1" local
+2>/dev/null then $(pwd) --verbose
+	--verbose && done x=1 'quoted text' grep local cd --verbose awk ${HOME}
+	printf printf local "$@" && sed printf
+	sed x=1 'quoted text' grep then done local $(pwd) local
+		&& 2>/dev/null "$1" 2>/dev/null readonly | x=1 done
+		readonly printf sed x=1 readonly 'quoted text' awk --verbose ${HOME}
+export -eu then then test grep then --verbose local /usr/bin $(pwd) cd then ${HOME}
+	readonly --verbose ${HOME} ${HOME} echo test awk test x=1
+-eu 'quoted text' export printf sed
+	&& test /usr/bin /usr/bin
+	done x=1 --verbose $(pwd) then x=1 test local 2>/dev/null
+		then && export x=1 'quoted text'
+		${HOME} readonly local ${HOME} then
+		-eu "$1" then "$@" export x=1 "$1" printf sed ${HOME} done
+${HOME} -eu x=1 -eu -eu ${HOME} | /usr/bin && x=1 then
+	sed test readonly --verbose done done -eu awk "$1" x=1 export
+&& echo test test cd 'quoted text' printf "$@" readonly
+		printf "$@" done test printf 'quoted text' && 'quoted text'
+2>/dev/null readonly 'quoted text' && done done "$@"
+		echo /usr/bin --verbose | 'quoted text' && test local -eu readonly sed done
+/usr/bin then echo test "$1" readonly test cd
+	grep sed x=1 --verbose 'quoted text' 2>/dev/null test printf "$@"
+x=1 && $(pwd) export cd --verbose printf | test readonly
+	${HOME} printf && grep cd 2>/dev/null $(pwd) printf -eu ${HOME}
+		test local "$1" awk done cd awk && then | cd
+		done awk printf local "$1" --verbose --verbose $(pwd) ${HOME} export "$1" x=1 test
+printf done | echo $(pwd) "$1" local
+		cd /usr/bin awk grep | sed
+readonly then cd echo x=1 -eu x=1 -eu | test readonly ${HOME} test
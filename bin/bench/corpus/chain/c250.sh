@@ -0,0 +1,2001 @@
+		grep /usr/bin -eu ${HOME} "$1" echo printf export awk && /usr/bin
+	export 2>/dev/null && | readonly --verbose
+	| grep printf sed x=1 grep | "$@" 'quoted text' "$1" sed
+	-eu test "$1" --verbose $(pwd) readonly export printf done test | --verbose
+		--verbose x=1 && "$1" && | then $(pwd) --verbose cd
+		2>/dev/null sed "$1" "$1" sed printf readonly && /usr/bin echo /usr/bin test
+&& /usr/bin local --verbose
+	printf 2>/dev/null -eu 2>/dev/null cd
+		${HOME} export | done /usr/bin readonly grep readonly cd $(pwd) done
+		cd --verbose grep readonly "$@" 'quoted text'
+	echo then done cd test "$1" export 2>/dev/null
+	grep --verbose "$1" ${HOME} && printf sed ${HOME} --verbose printf
+done "$@" | awk cd --verbose sed printf export export
+		done 'quoted text' /usr/bin 2>/dev/null
+awk then --verbose x=1 awk
+		test printf && awk then -eu readonly -eu done awk /usr/bin -eu
+	${HOME} readonly echo sed sed printf
+export "$1" ${HOME} done
+		grep then readonly printf echo "$1"
+		"$1" 'quoted text' -eu && then cd ${HOME} /usr/bin
+echo x=1 then "$@" ${HOME} printf readonly
+${HOME} export awk grep printf x=1 "$@" "$@" $(pwd) 'quoted text' "$1" |
+	printf awk readonly /usr/bin sed | ${HOME} echo
+export 'quoted text' "$@" readonly --verbose
+	echo | | $(pwd) local grep $(pwd) 2>/dev/null readonly done x=1 grep echo test
+then && then grep printf local sed $(pwd)
+	| /usr/bin export test x=1 done | "$@" test printf --verbose export grep
+	&& | local -eu --verbose local 2>/dev/null -eu ${HOME} 'quoted text' sed grep
+-eu ${HOME} local test ${HOME} test export then cd readonly -eu then
+	awk /usr/bin /usr/bin |
+	--verbose readonly | | /usr/bin "$1"
+		readonly 2>/dev/null && test -eu test -eu --verbose
+echo | grep grep done local local then test grep local test "$1"
+export "$@" 'quoted text' | local done | && echo x=1 2>/dev/null
+$(pwd) readonly printf local then $(pwd) /usr/bin
+		export 2>/dev/null test "$@" printf /usr/bin sed
+export -eu 'quoted text'
+		done x=1 | awk export 2>/dev/null && grep local sed /usr/bin x=1 echo --verbose
+	${HOME} $(pwd) then then /usr/bin cd readonly
+		"$@" awk "$@" awk 'quoted text' echo sed --verbose
+		&& awk /usr/bin echo echo --verbose awk -eu test
+	echo 'quoted text' | readonly then printf readonly done
+		awk printf | /usr/bin x=1 grep
+sed "$1" awk grep awk export "$1" -eu "$1"
+	echo test 2>/dev/null test $(pwd) -eu | --verbose ${HOME}
+		&& && done --verbose then printf "$@" /usr/bin local -eu test $(pwd) -eu
+grep then "$@" 'quoted text' then echo ${HOME} 2>/dev/null then 'quoted text'
+then ${HOME} "$@" /usr/bin "$1" --verbose printf x=1 export -eu && readonly
+	grep --verbose done ${HOME} readonly && done 'quoted text' x=1 "$@" readonly
+local test && && x=1 printf local && | done && readonly -eu
+readonly 2>/dev/null && 'quoted text' 2>/dev/null cd cd printf then ${HOME} echo
+	2>/dev/null -eu $(pwd)
+		x=1 $(pwd) | && echo $(pwd) export export echo done $(pwd) /usr/bin
+		'quoted text' awk --verbose x=1 x=1 ${HOME} x=1 | /usr/bin done /usr/bin
+| printf echo -eu printf |
+printf local sed 'quoted text' export cd ${HOME}
+	done && /usr/bin "$1" printf
+		-eu done awk 2>/dev/null -eu then test --verbose grep local done 2>/dev/null
+		--verbose x=1 export readonly --verbose 2>/dev/null done test "$@" /usr/bin 'quoted text'
+	/usr/bin awk 2>/dev/null 2>/dev/null
+echo "$1" export readonly echo "$@" cd "$@" export "$@" sed readonly &&
+	$(pwd) --verbose $(pwd) && ${HOME} ${HOME} export
+printf done awk echo readonly grep 2>/dev/null
+local cd local x=1 "$@" export then then --verbose ${HOME} cd "$@" test
+		$(pwd) awk "$@" echo then
+cd cd 2>/dev/null done
+	-eu done done /usr/bin $(pwd)
+| 2>/dev/null local done cd echo printf $(pwd) "$@" sed /usr/bin
+test sed grep "$@" x=1 then ${HOME} x=1 grep readonly
+	sed ${HOME} 2>/dev/null sed 'quoted text' $(pwd) cd --verbose --verbose
+x=1 "$1" && 'quoted text' ${HOME} echo
+	x=1 grep $(pwd) then $(pwd) printf -eu 2>/dev/null --verbose
+--verbose awk ${HOME} /usr/bin $(pwd) local 'quoted text' local "$1" done done
+		&& /usr/bin ${HOME} cd "$@" | then
+		then "$1" cd cd export grep printf $(pwd) ${HOME} x=1 then ${HOME} grep done
+	printf ${HOME} grep echo echo cd $(pwd) 'quoted text' export awk
+		"$@" ${HOME} local x=1 then "$@" /usr/bin $(pwd) x=1 "$@"
+	echo /usr/bin test 'quoted text' "$1" 'quoted text' "$1" 'quoted text'
+		"$@" 2>/dev/null /usr/bin "$1" "$1" | echo then
+		readonly export && 'quoted text' "$1" cd awk x=1 export 2>/dev/null
+	grep echo sed "$1" -eu 'quoted text' "$@" readonly then
+$(pwd) --verbose ${HOME} --verbose grep
+	local export "$@" test grep sed local -eu 2>/dev/null "$@" && --verbose 2>/dev/null
+	| --verbose sed $(pwd)
+	"$@" awk --verbose |
+	test cd && /usr/bin "$1"
+		then local /usr/bin /usr/bin then then 2>/dev/null
+	cd && $(pwd) $(pwd) local then 'quoted text'
+	--verbose "$@" awk 2>/dev/null done /usr/bin
+	done export echo grep readonly x=1 "$1" x=1 printf
+	then cd /usr/bin "$@" ${HOME} cd test cd printf $(pwd) ${HOME} test
+printf export cd printf && /usr/bin && grep && then "$1"
+test sed /usr/bin 2>/dev/null sed 'quoted text' cd readonly && --verbose then
+		cd export | /usr/bin echo echo export export | x=1 --verbose then | /usr/bin
+"$1" "$@" grep then | 'quoted text' --verbose
+		| local x=1 cd grep readonly
+		echo -eu ${HOME} test
+	$(pwd) cd "$@" $(pwd) --verbose $(pwd) --verbose $(pwd) 'quoted text' awk --verbose
+done readonly 'quoted text' "$@" awk echo | 'quoted text' "$@" /usr/bin
+	${HOME} readonly 'quoted text' grep then x=1 /usr/bin
+	readonly --verbose printf "$1" grep echo x=1 2>/dev/null -eu awk printf then echo
+echo --verbose echo 'quoted text'
+	done x=1 test cd cd $(pwd) readonly x=1 --verbose x=1 | && grep sed local "$1" 2>/dev/null
+	echo test grep -eu | sed readonly cd "$@" export ${HOME}
+| grep local x=1 readonly done 'quoted text' awk --verbose -eu cd done awk && "$@"
+	then "$@" $(pwd) awk ${HOME}
+		grep done && grep then "$1" 2>/dev/null echo x=1 export "$@" sed echo 2>/dev/null
+echo echo grep printf sed awk /usr/bin "$@"
+	readonly then test $(pwd) done echo --verbose export x=1 export
+sed export test cd test grep readonly local readonly |
+		${HOME} sed awk /usr/bin then --verbose
+	then sed && 'quoted text' printf $(pwd) 2>/dev/null 2>/dev/null then printf
+	awk | | $(pwd) export awk readonly echo
+	&& ${HOME} awk cd echo "$1" /usr/bin --verbose ${HOME} "$1"
+		'quoted text' "$@" done then 2>/dev/null $(pwd) ${HOME} test export
+		echo "$1" grep --verbose export x=1 echo done && 2>/dev/null 'quoted text'
+"$1" -eu then x=1 ${HOME}
+		-eu printf x=1 'quoted text' /usr/bin --verbose | --verbose -eu local | readonly
+		-eu $(pwd) "$@" awk --verbose test awk test readonly sed 'quoted text'
+| local grep test 2>/dev/null 'quoted text' readonly echo /usr/bin then
+		readonly --verbose awk "$1" cd -eu $(pwd) $(pwd) cd printf $(pwd) 2>/dev/null then
+	export x=1 echo local
+		done "$@" export x=1 $(pwd) --verbose x=1 x=1 /usr/bin --verbose
+"$1" "$1" printf -eu 'quoted text'
+printf /usr/bin 'quoted text' test ${HOME}
+	&& 'quoted text' echo && $(pwd) x=1 "$1"
+--verbose awk cd then sed grep "$1" "$@" $(pwd) "$1" x=1 grep sed
+2>/dev/null $(pwd) sed local local
+	"$@" sed awk x=1 ${HOME} echo awk printf 2>/dev/null 'quoted text' -eu $(pwd)
+	export $(pwd) /usr/bin awk 'quoted text' /usr/bin done readonly grep /usr/bin "$@"
+		"$1" awk awk /usr/bin grep
+echo echo local cd then test $(pwd) printf printf cd local echo echo "$1"
+	test ${HOME} && | test "$1" --verbose
+		test printf -eu 'quoted text' 'quoted text' "$@"
+/usr/bin && local "$@" grep 2>/dev/null done "$1" "$1" echo local
+	grep -eu printf "$@" 2>/dev/null sed $(pwd) --verbose --verbose --verbose
+"$1" awk | then then &&
+	echo echo $(pwd) done test local awk grep cd 'quoted text' sed
+2>/dev/null readonly --verbose /usr/bin echo -eu /usr/bin sed ${HOME} printf awk
+	done done done readonly then
+/usr/bin /usr/bin local && 'quoted text' readonly 2>/dev/null
+	then ${HOME} /usr/bin $(pwd) x=1 test awk cd /usr/bin -eu ${HOME}
+		local done $(pwd) done 'quoted text' x=1 /usr/bin $(pwd) "$1" | test
+then test /usr/bin ${HOME} sed ${HOME} awk done x=1 /usr/bin 2>/dev/null
+printf awk then local 2>/dev/null "$1" readonly
+| 2>/dev/null "$1" | echo "$1" export export then "$1" local local 2>/dev/null
+		done grep printf export && "$@" export
+	'quoted text' export /usr/bin printf grep echo printf test export
+	/usr/bin echo && 'quoted text' sed ${HOME} "$1" "$@" local x=1 echo --verbose
+printf $(pwd) then x=1 cd local
+		export | sed test "$@" 2>/dev/null -eu --verbose -eu "$@" readonly "$1"
+		$(pwd) | local readonly $(pwd) awk
+		local --verbose grep $(pwd)
+		done awk "$@" $(pwd) "$@" echo
+		cd "$@" x=1 sed $(pwd) x=1 ${HOME} export
+		awk 'quoted text' local "$1"
+		| printf --verbose test readonly test cd "$1" 'quoted text' awk export awk
+	x=1 readonly /usr/bin awk "$@" then cd awk --verbose --verbose
+		sed done | done ${HOME}
+grep -eu --verbose $(pwd) "$@" --verbose
+		x=1 awk $(pwd) 'quoted text' $(pwd) 2>/dev/null sed 2>/dev/null
+| readonly export awk readonly
+		cd cd ${HOME} grep echo sed echo then -eu && /usr/bin /usr/bin done
+		export -eu cd sed -eu awk cd awk readonly sed $(pwd) 2>/dev/null echo cd /usr/bin
+	${HOME} -eu done | echo sed
+		done export $(pwd) /usr/bin echo && && sed ${HOME}
+	"$@" --verbose && sed awk /usr/bin 2>/dev/null x=1 printf
+	x=1 2>/dev/null awk 2>/dev/null 'quoted text' ${HOME} $(pwd) cd
+		x=1 cd awk cd awk readonly "$1" && readonly test "$@" 2>/dev/null
+-eu done awk -eu /usr/bin echo "$@" /usr/bin cd && printf
+	| /usr/bin done 'quoted text' $(pwd) local /usr/bin readonly echo | test
+		then x=1 test | local "$1" export x=1 ${HOME} export /usr/bin ${HOME} --verbose
+export 2>/dev/null local | sed cd -eu -eu sed "$@" awk -eu --verbose
+cd ${HOME} then 2>/dev/null x=1 then export --verbose | $(pwd) x=1
+	$(pwd) "$1" awk "$@" then sed "$@" $(pwd) "$1" local awk test 2>/dev/null
+local 'quoted text' && x=1 x=1 x=1 | readonly "$1" then test printf test
+	cd x=1 sed "$1" --verbose 'quoted text'
+		--verbose 2>/dev/null -eu ${HOME}
+		x=1 "$1" 'quoted text'
+		cd | $(pwd) test export then grep x=1 done awk
+	&& then printf then $(pwd) -eu readonly test awk &&
+		| then | done grep export done
+	echo -eu export "$@" cd "$1" cd local
+	done grep x=1 then x=1 readonly readonly "$@" then readonly local test
+		"$1" 2>/dev/null local export
+	done /usr/bin 'quoted text' 2>/dev/null done /usr/bin x=1 "$1" local local
+		${HOME} | --verbose grep readonly | export test test test awk 'quoted text'
+		x=1 && readonly /usr/bin done sed then -eu printf then readonly x=1 grep ${HOME}
+	--verbose "$@" ${HOME} ${HOME} /usr/bin
+&& | /usr/bin export awk test printf
+printf /usr/bin sed && grep ${HOME}
+	'quoted text' -eu x=1 && grep local printf "$1" export
+readonly test printf export printf sed $(pwd) | local cd "$1" test x=1
+	${HOME} -eu ${HOME} awk local done printf test export
+		done echo | -eu done done cd awk 2>/dev/null 'quoted text'
+		"$@" sed done /usr/bin $(pwd)
+		&& && local 2>/dev/null export done echo --verbose printf echo awk cd readonly
+	$(pwd) done printf && readonly --verbose sed readonly -eu 2>/dev/null
+then sed export 'quoted text' done then local grep test 2>/dev/null && sed export
+/usr/bin cd sed sed --verbose sed test local "$1" ${HOME} then test /usr/bin grep
+		--verbose readonly /usr/bin 'quoted text' $(pwd) $(pwd) echo
+	'quoted text' sed /usr/bin 'quoted text' awk /usr/bin export cd awk --verbose 'quoted text'
+test grep "$@" done 'quoted text'
+-eu printf --verbose ${HOME} cd | "$1"
+grep done done | printf readonly
+	"$@" done "$1" printf
+printf local && -eu test | "$@" test | local --verbose
+x=1 then export local "$1" echo awk
+	sed printf readonly local grep echo then
+	export "$1" 2>/dev/null "$1" printf
+&& --verbose done cd printf ${HOME} x=1 awk 2>/dev/null
+		x=1 then awk export /usr/bin echo printf --verbose printf
+	echo done /usr/bin "$@" x=1 ${HOME} --verbose printf ${HOME} echo
+		"$1" "$1" 2>/dev/null grep printf -eu then test /usr/bin
+		test --verbose echo 'quoted text' readonly
+		test | echo sed "$@" awk local "$@" grep 2>/dev/null
+	test | readonly local cd "$@" sed "$@" --verbose grep awk && awk done test test
+	'quoted text' 'quoted text'
+	grep x=1 local 'quoted text' /usr/bin 'quoted text'
+		export grep && readonly grep
+	$(pwd) sed 'quoted text' && sed 2>/dev/null sed cd then --verbose
+	&& "$@" done local | 2>/dev/null --verbose /usr/bin
+	test test test export ${HOME} "$1" 'quoted text' then done done
+		sed awk local echo done echo then $(pwd) "$@" echo sed export $(pwd)
+		x=1 printf 'quoted text' test -eu
+	test export | | then 'quoted text'
+		export printf --verbose 'quoted text'
+	readonly test $(pwd) local ${HOME} then done
+| x=1 | ${HOME} printf local printf grep
+readonly cd 'quoted text' --verbose
+	$(pwd) sed --verbose local "$@" &&
+	"$1" echo awk local sed echo awk local | then awk sed export "$1" $(pwd) | awk
+echo ${HOME} grep 2>/dev/null | readonly readonly echo
+printf echo -eu "$@" 'quoted text'
+	-eu x=1 local readonly "$1" $(pwd) export ${HOME} | ${HOME} printf
+		'quoted text' echo 'quoted text'
+	x=1 local x=1 "$@" ${HOME} then ${HOME} then $(pwd) "$@"
+		"$@" then $(pwd) 2>/dev/null && test sed "$@" echo 2>/dev/null
+		test echo /usr/bin "$@" sed then $(pwd) ${HOME} printf "$@" ${HOME}
+		"$@" -eu $(pwd) "$@" readonly x=1 sed --verbose 'quoted text' "$@" && /usr/bin
+"$@" -eu -eu local 'quoted text' x=1
+		2>/dev/null awk /usr/bin awk local
+		"$1" export echo -eu grep "$@" readonly readonly "$@" 'quoted text' done grep |
+		printf awk test --verbose awk test awk "$1" -eu local grep printf
+		local export x=1 $(pwd) cd x=1 sed then /usr/bin && printf ${HOME}
+		$(pwd) $(pwd) x=1 x=1 'quoted text' test local
+		done done local -eu then
+grep echo ${HOME} local && local && local
+2>/dev/null "$1" -eu test
+grep "$1" 2>/dev/null "$1" echo
+	local && awk $(pwd) 'quoted text'
+		awk | && "$1" /usr/bin x=1 grep local ${HOME} 'quoted text' export &&
+	$(pwd) $(pwd) ${HOME} printf sed printf /usr/bin | awk
+x=1 echo $(pwd) && sed grep cd done 2>/dev/null local && printf readonly readonly
+		2>/dev/null 'quoted text'
+sed export | readonly --verbose awk local
+		--verbose sed --verbose /usr/bin | "$@" x=1 local test export done && export grep
+/usr/bin test export ${HOME} && 'quoted text' awk grep
+	sed | cd echo /usr/bin local ${HOME} echo
+	x=1 --verbose "$1" && cd | sed --verbose
+		echo cd && x=1 && export
+		-eu echo | done 'quoted text' --verbose /usr/bin sed then 2>/dev/null -eu
+		$(pwd) grep then sed sed local -eu export 'quoted text' awk
+	then printf $(pwd) grep "$1" | $(pwd)
+x=1 done export | "$@" --verbose
+then --verbose $(pwd) &&
+		${HOME} "$1" x=1 cd readonly ${HOME} "$@" done | x=1 $(pwd) /usr/bin /usr/bin
+	done 'quoted text' /usr/bin
+done sed then echo $(pwd) test awk export grep local
+		--verbose -eu cd grep -eu readonly local
+		--verbose $(pwd) then echo 2>/dev/null &&
+printf -eu then ${HOME} --verbose ${HOME}
+| ${HOME} printf cd "$1"
+	export grep $(pwd) 2>/dev/null 'quoted text' 'quoted text'
+	| export grep --verbose export awk printf
+	done then then readonly 2>/dev/null /usr/bin test /usr/bin grep local -eu
+		then 'quoted text' /usr/bin cd echo cd ${HOME} awk test awk ${HOME}
+	/usr/bin --verbose local x=1 cd $(pwd) "$@" local ${HOME} | then test awk done
+	local 2>/dev/null "$1" "$@" then cd $(pwd) /usr/bin "$@" -eu 'quoted text'
+		2>/dev/null done /usr/bin | printf local $(pwd) --verbose /usr/bin cd "$1"
+	export /usr/bin ${HOME} test /usr/bin printf done local grep
+		&& -eu awk --verbose 'quoted text' ${HOME} x=1 readonly readonly
+	done --verbose /usr/bin &&
+	local && && && local $(pwd) export awk 2>/dev/null -eu done
+	sed echo /usr/bin readonly grep test x=1 | cd
+		${HOME} -eu echo echo awk && test local readonly 'quoted text' local
+		"$@" sed awk echo 2>/dev/null local readonly ${HOME}
+	-eu --verbose done -eu readonly cd done "$1" 2>/dev/null
+	printf 'quoted text' x=1 export then 2>/dev/null "$1" 'quoted text' cd "$1"
+		--verbose local cd then done "$1" test --verbose "$1" x=1 'quoted text'
+x=1 "$@" -eu cd sed 'quoted text' test done "$@" done done awk printf
+	"$1" /usr/bin grep -eu local cd
+x=1 --verbose --verbose 'quoted text' local export 2>/dev/null
+done x=1 | $(pwd) echo
+	echo sed readonly awk readonly --verbose x=1 local
+	x=1 'quoted text' && cd | sed --verbose
+	export | "$@" /usr/bin sed -eu $(pwd) 2>/dev/null
+done -eu cd readonly 'quoted text' export
+		cd ${HOME} done sed | /usr/bin
+	x=1 2>/dev/null "$1" 'quoted text' grep /usr/bin local 'quoted text'
+| test ${HOME} 2>/dev/null printf
+		readonly then printf awk
+then /usr/bin readonly 2>/dev/null
+		${HOME} -eu printf $(pwd) 'quoted text' then && local printf
+	test --verbose readonly --verbose local --verbose "$@"
+		"$@" 'quoted text' --verbose x=1 --verbose
+test echo then printf && ${HOME} cd then readonly
+done ${HOME} 2>/dev/null | export -eu sed | 'quoted text'
+then 'quoted text' awk awk done export echo
+	'quoted text' grep | && "$@" /usr/bin -eu cd 2>/dev/null
+		printf test "$@" --verbose $(pwd) $(pwd) awk local
+	done ${HOME} done grep cd 'quoted text' grep
+readonly sed cd readonly export done cd echo sed then readonly
+		printf test test && grep grep then cd export awk test grep export -eu $(pwd) readonly
+local -eu printf printf
+readonly "$@" && 'quoted text' --verbose then
+		then done --verbose readonly x=1 export "$@" then | sed x=1 readonly
+	&& printf echo grep echo
+		${HOME} readonly test cd /usr/bin
+cd | cd readonly echo test "$@" done readonly 'quoted text'
+2>/dev/null done ${HOME} && done --verbose local readonly --verbose sed
+		printf export x=1 'quoted text' ${HOME} test "$@" ${HOME}
+		then echo printf test 2>/dev/null sed done "$@" awk export --verbose ${HOME}
+	readonly grep done /usr/bin && local 'quoted text'
+		grep | ${HOME} -eu export readonly x=1 done "$1" printf
+		sed -eu "$@" then local test | grep local
+| $(pwd) printf "$1" /usr/bin awk 'quoted text' | echo /usr/bin test --verbose
+${HOME} -eu local "$1" "$@"
+	-eu && --verbose "$1" | awk grep "$@" $(pwd) $(pwd) "$1" then
+	awk | 2>/dev/null test --verbose 'quoted text' x=1
+echo "$1" local test local local printf -eu echo echo echo --verbose grep local
+	-eu printf printf x=1 |
+2>/dev/null grep "$1" --verbose
+	sed $(pwd) grep "$1" $(pwd) printf 'quoted text' | "$1" then awk awk
+grep done cd awk x=1 ${HOME} --verbose awk 'quoted text' | | readonly
+		&& -eu cd ${HOME} cd echo printf export echo
+readonly 'quoted text' "$1" --verbose
+	then "$@" "$1" --verbose local | 2>/dev/null
+	| test /usr/bin test 'quoted text' /usr/bin done && echo /usr/bin
+		/usr/bin -eu echo awk sed printf "$@" -eu readonly --verbose
+	$(pwd) sed "$@" then ${HOME} then local "$@" awk 'quoted text'
+printf echo readonly export
+		grep cd printf /usr/bin readonly "$1" awk local -eu x=1
+		test printf ${HOME} printf sed grep awk export && awk -eu test local awk
+		done "$1" $(pwd) awk readonly | "$1" sed readonly
+		x=1 done 2>/dev/null 'quoted text' readonly readonly done /usr/bin
+		/usr/bin then done echo awk done done 2>/dev/null echo && 'quoted text'
+	${HOME} x=1 x=1 && cd grep
+local test readonly local --verbose grep done x=1 x=1 && readonly
+printf x=1 test grep export cd export echo "$1" 2>/dev/null cd grep
+		$(pwd) echo sed /usr/bin /usr/bin
+	--verbose test echo 'quoted text' ${HOME} export
+		echo | done x=1 "$1" test x=1 --verbose grep "$1" echo
+"$@" --verbose 'quoted text'
+	/usr/bin grep done readonly "$1" 'quoted text'
+export done grep x=1 then "$1" grep local grep local -eu 'quoted text' && sed x=1
+		${HOME} ${HOME} ${HOME} cd 'quoted text' done && "$1" | sed
+		awk awk "$1" echo done -eu local readonly | echo "$@" x=1 "$@" local printf
+		${HOME} --verbose x=1 export $(pwd)
+		'quoted text' test && grep grep "$@" | 2>/dev/null then readonly --verbose
+	echo ${HOME} "$1" echo readonly done
+grep readonly test export 2>/dev/null "$1" ${HOME} grep test
+	"$1" done echo -eu ${HOME}
+		test then echo grep echo | echo readonly "$1" local
+--verbose cd printf ${HOME} --verbose export -eu /usr/bin "$@" sed test
+	/usr/bin awk /usr/bin "$1" && x=1 awk grep && readonly
+		awk then printf "$1" "$@"
+	| echo test echo test 'quoted text' awk "$@" export
+		cd grep local grep $(pwd) export readonly "$1" && grep readonly
+echo printf x=1 2>/dev/null ${HOME} | 'quoted text' --verbose done
+/usr/bin then "$@" sed "$1"
+test export readonly "$@" export "$@" $(pwd) "$@" echo -eu done 2>/dev/null
+	done grep /usr/bin "$@" $(pwd) 'quoted text'
+		--verbose readonly $(pwd) cd
+	then awk 'quoted text' -eu
+	| done awk 'quoted text' x=1 test done x=1
+	"$@" && 'quoted text'
+echo awk --verbose ${HOME} ${HOME} export "$@" "$1"
+echo done local grep done grep 'quoted text' printf echo export | awk -eu | printf
+then awk | && sed cd --verbose
+$(pwd) "$@" x=1 $(pwd) | export /usr/bin grep readonly
+		awk 2>/dev/null then printf then ${HOME} 2>/dev/null cd x=1
+	sed grep then sed x=1 test && x=1
+		"$@" ${HOME} x=1 --verbose grep x=1
+/usr/bin local export grep && local done 'quoted text' test
+| "$@" ${HOME} && "$1"
+	cd test $(pwd) 2>/dev/null done then
+		'quoted text' cd sed cd ${HOME} echo
+&& "$@" 2>/dev/null "$@" 2>/dev/null --verbose /usr/bin "$@" printf
+	x=1 echo /usr/bin export 'quoted text'
+	grep | "$1" $(pwd) &&
+	"$1" then echo /usr/bin cd cd cd done local "$1" readonly local 2>/dev/null | then
+-eu test --verbose printf | 'quoted text' $(pwd) printf local
+		test printf && -eu then $(pwd) export echo -eu then 2>/dev/null
+		printf sed grep test test printf test
+$(pwd) then printf done "$1" printf sed $(pwd) ${HOME} local $(pwd) sed
+--verbose export "$@"
+		| 'quoted text' then
+		readonly export "$1" "$1" ${HOME} done done test | echo
+		done cd --verbose awk printf ${HOME} $(pwd) echo then
+	"$@" "$1" "$@" "$1" test local printf export export export
+		local printf --verbose grep x=1 grep done /usr/bin sed export && local && "$@"
+		&& $(pwd) "$1" local cd /usr/bin && sed --verbose export /usr/bin
+	cd $(pwd) | local printf "$1" awk && grep echo local sed -eu local && -eu
+echo -eu readonly then "$1" local echo
+		"$@" readonly local awk $(pwd) x=1 --verbose echo grep cd -eu 2>/dev/null
+-eu printf grep readonly "$@" awk cd test --verbose printf $(pwd) awk test
+	echo -eu test local --verbose x=1 cd --verbose
+		&& local x=1 $(pwd) awk --verbose $(pwd) export test readonly test echo "$@"
+		"$1" | local then sed 'quoted text' sed grep cd awk done awk 'quoted text'
+	export then readonly cd echo -eu echo "$1" cd && "$1" /usr/bin
+		--verbose echo printf export grep readonly | export
+--verbose /usr/bin ${HOME} test /usr/bin then x=1
+	2>/dev/null --verbose -eu 2>/dev/null "$@" | /usr/bin
+printf -eu done --verbose $(pwd) && then local $(pwd)
+	&& grep | readonly then readonly
+grep grep test /usr/bin 'quoted text' readonly sed readonly
+	| printf cd "$1" sed ${HOME} "$@" awk && test -eu -eu readonly && test
+		2>/dev/null done -eu 2>/dev/null echo
+	'quoted text' "$@" done /usr/bin
+test export local readonly -eu printf | then && /usr/bin | cd x=1 x=1 && grep
+	test export echo then sed test 'quoted text' && awk -eu && local grep
+"$@" 'quoted text' test ${HOME} /usr/bin awk export local /usr/bin printf --verbose
+	&& export $(pwd) readonly readonly done awk "$1" "$@" sed 'quoted text'
+echo --verbose local sed awk grep ${HOME}
+export then echo $(pwd)
+| x=1 export cd -eu -eu readonly 2>/dev/null
+	/usr/bin grep 'quoted text' 2>/dev/null export ${HOME} "$1" grep
+	echo printf 2>/dev/null local grep /usr/bin printf sed local && /usr/bin
+		--verbose 'quoted text' echo 'quoted text' --verbose 'quoted text' local readonly
+	| 'quoted text' $(pwd) ${HOME} readonly readonly cd $(pwd) -eu
+		"$@" printf $(pwd) "$@" | local done grep | readonly 'quoted text' 2>/dev/null
+	$(pwd) then $(pwd) 2>/dev/null local ${HOME} awk
+echo done $(pwd) then &&
+		then "$1" export local test 'quoted text' printf
+	sed local echo sed export /usr/bin grep 'quoted text' printf
+--verbose x=1 ${HOME} | test --verbose "$1" echo test 'quoted text'
+	2>/dev/null && done --verbose
+		--verbose export awk && echo 'quoted text' "$1" && awk
+		-eu awk /usr/bin | "$@" && x=1 -eu "$@" grep then | sed local ${HOME} export &&
+		${HOME} | /usr/bin test 'quoted text'
+		then $(pwd) | awk -eu printf x=1 2>/dev/null
+		$(pwd) 2>/dev/null awk cd $(pwd) "$@" printf | -eu
+		$(pwd) test cd "$@" "$1" sed -eu |
+cd --verbose /usr/bin /usr/bin readonly --verbose
+		grep cd done grep then done -eu export export printf | /usr/bin $(pwd) local local
+		&& readonly 'quoted text' "$1" then
+		export test local | $(pwd) grep "$1" grep 'quoted text' export && local local
+		done | && echo ${HOME} then "$@" && export /usr/bin
+grep readonly local /usr/bin -eu cd export | echo && && local ${HOME}
+readonly readonly cd export -eu x=1 test export /usr/bin printf 'quoted text'
+grep 2>/dev/null awk "$@" done test readonly 2>/dev/null
+		readonly then printf 'quoted text'
+	readonly grep test sed -eu -eu && sed cd 2>/dev/null "$1" 'quoted text' awk
+2>/dev/null local test echo ${HOME} then ${HOME}
+		export sed "$@" && sed "$@" --verbose x=1 cd && -eu readonly && echo "$@"
+	'quoted text' $(pwd) "$@" x=1 printf sed
+printf "$@" && grep $(pwd) /usr/bin 2>/dev/null "$@" ${HOME} && $(pwd) echo
+		"$@" -eu printf printf -eu 2>/dev/null --verbose 'quoted text' "$1"
+local --verbose "$1" && x=1 sed --verbose done printf 2>/dev/null
+then -eu ${HOME} 2>/dev/null export "$1" --verbose
+	"$1" awk $(pwd) done local "$1"
+	echo ${HOME} grep awk 2>/dev/null --verbose
+--verbose "$1" readonly printf sed && readonly export awk awk local
+awk | echo -eu && -eu "$@" readonly
+	local test readonly -eu
+then cd "$@" then "$1" ${HOME} then
+		"$@" then -eu x=1 done printf
+x=1 -eu grep 2>/dev/null cd ${HOME} sed
+printf local sed $(pwd) | "$1" grep 'quoted text' -eu then
+	2>/dev/null -eu readonly done ${HOME} "$@" 'quoted text' 'quoted text'
+then ${HOME} /usr/bin "$@" then && grep &&
+test /usr/bin $(pwd) | 'quoted text' "$1" done && /usr/bin
+readonly echo -eu x=1 /usr/bin ${HOME} 'quoted text' "$@" test
+&& awk local /usr/bin --verbose x=1 readonly awk done
+&& awk cd printf -eu x=1 "$1" -eu
+		cd "$1" export 2>/dev/null /usr/bin --verbose test
+		test "$1" awk test ${HOME} 2>/dev/null
+	x=1 /usr/bin ${HOME} 'quoted text' local readonly
+	"$1" ${HOME} readonly && printf | --verbose grep grep --verbose &&
+		"$@" sed test /usr/bin echo cd | && ${HOME}
+		export cd --verbose --verbose 'quoted text' done --verbose then | echo test
+	sed ${HOME} x=1 -eu && 2>/dev/null echo readonly
+readonly ${HOME} printf echo ${HOME} 2>/dev/null printf awk readonly
+awk && | readonly grep 'quoted text' ${HOME} cd ${HOME}
+	$(pwd) cd done grep printf printf /usr/bin echo sed readonly
+	/usr/bin x=1 awk 2>/dev/null
+	-eu readonly | awk awk sed sed x=1 &&
+		done local /usr/bin | export
+	echo then grep readonly 'quoted text'
+		export && && grep awk local local 2>/dev/null 2>/dev/null -eu "$1" x=1 cd export
+	2>/dev/null cd then && test x=1 readonly printf -eu "$1" -eu export --verbose
+		$(pwd) test printf cd 'quoted text' /usr/bin
+echo awk test -eu echo cd echo "$1" | local /usr/bin 2>/dev/null "$@" "$1" /usr/bin
+		&& readonly printf cd -eu "$@" /usr/bin --verbose awk test then | -eu printf local
+-eu done -eu | export readonly "$1" awk "$1"
+	local 2>/dev/null sed "$@" done && cd readonly && "$@" awk test
+	cd test readonly /usr/bin test grep -eu -eu awk --verbose test
+	cd && "$1" printf then 'quoted text' echo echo sed ${HOME}
+	done export printf sed "$@" 'quoted text' cd -eu /usr/bin --verbose done
+		local awk done echo && done | cd --verbose ${HOME} printf test
+	then readonly cd | cd "$1" 2>/dev/null export "$1" "$@" | cd test && -eu sed ${HOME}
+		grep sed awk export awk
+		-eu done done test test 'quoted text' 'quoted text' x=1
+grep /usr/bin -eu grep awk echo awk test sed x=1 local readonly
+		grep echo cd "$@" /usr/bin
+	2>/dev/null done test done 'quoted text' export sed 2>/dev/null
+	--verbose test awk grep 'quoted text' printf done x=1 cd 'quoted text' x=1
+	$(pwd) local local readonly
+		| "$@" -eu local awk test then awk
+		&& -eu | x=1 export echo $(pwd)
+		| then then 'quoted text' ${HOME} -eu -eu
+	test readonly awk "$1" -eu sed echo cd done grep $(pwd) echo export
+	x=1 printf export then ${HOME} local echo local cd
+		x=1 /usr/bin $(pwd) 'quoted text' readonly awk test test readonly awk
+sed && x=1 echo && "$1" "$1" x=1
+	/usr/bin export export grep awk ${HOME} cd then
+	"$@" cd $(pwd) echo sed printf echo -eu
+	/usr/bin -eu x=1 cd --verbose $(pwd) x=1 local cd grep local && awk ${HOME} -eu
+		$(pwd) then done "$@" sed | cd sed "$@" done ${HOME}
+| echo cd awk readonly "$@" "$1" grep --verbose | /usr/bin "$@" x=1 /usr/bin test
+	export local readonly cd --verbose 2>/dev/null export cd
+	then && --verbose local /usr/bin | test awk "$1" test 2>/dev/null
+export export awk echo awk
+	local grep 'quoted text' x=1 grep printf cd readonly
+	"$1" done then printf | done local readonly test "$1" --verbose
+	x=1 export echo sed --verbose
+	/usr/bin awk then /usr/bin sed done printf 'quoted text'
+printf printf printf | echo --verbose 2>/dev/null
+done sed "$1" /usr/bin printf
+done | printf then -eu && awk
+		'quoted text' --verbose sed awk cd ${HOME}
+	| && readonly printf
+$(pwd) echo grep --verbose local $(pwd) /usr/bin "$@" done $(pwd)
+	done && --verbose awk awk && local 'quoted text' --verbose /usr/bin -eu
+printf 'quoted text' then --verbose x=1 grep echo "$@" && | "$@" then printf
+'quoted text' 'quoted text' export
+	local && 'quoted text' ${HOME} | -eu "$@" $(pwd) echo
+	'quoted text' $(pwd) readonly x=1 $(pwd) grep readonly "$1"
+		2>/dev/null && /usr/bin $(pwd) readonly | sed readonly
+grep printf then cd 2>/dev/null /usr/bin done local 'quoted text'
+sed local done | readonly awk
+	x=1 /usr/bin echo done x=1 -eu && 'quoted text' cd
+	'quoted text' echo grep echo
+	"$@" ${HOME} local local "$@" | local && done cd "$1" /usr/bin
+		sed $(pwd) awk -eu done /usr/bin
+/usr/bin then x=1 printf 'quoted text' 2>/dev/null readonly test cd "$1" $(pwd)
+-eu readonly ${HOME} $(pwd) local awk 2>/dev/null
+awk 'quoted text' $(pwd) test local /usr/bin 'quoted text'
+		--verbose export awk test
+		&& $(pwd) 'quoted text' | $(pwd) "$1"
+	local $(pwd) export done -eu sed 'quoted text' "$@" && $(pwd) /usr/bin $(pwd)
+cd grep /usr/bin export test /usr/bin grep grep "$@" cd
+export && "$1" grep | sed echo echo x=1 $(pwd) /usr/bin sed readonly
+		${HOME} cd --verbose ${HOME}
+"$@" "$1" echo test /usr/bin 'quoted text' test readonly
+		cd printf awk cd | && --verbose export /usr/bin
+cd local && test sed readonly grep sed printf readonly local
+		export /usr/bin 'quoted text' -eu 2>/dev/null -eu echo --verbose x=1
+2>/dev/null printf then cd then local "$@" printf cd x=1
+	"$1" local "$@" echo local && -eu | awk done /usr/bin 'quoted text' cd
+		$(pwd) -eu awk 2>/dev/null 2>/dev/null
+	'quoted text' "$@" export export ${HOME} x=1 sed 2>/dev/null
+		grep | | test awk export then --verbose readonly "$1" awk then echo sed
+test awk done 'quoted text' grep
+	echo local then test -eu printf /usr/bin "$1"
+	readonly readonly 'quoted text' readonly /usr/bin ${HOME} done then grep
+		'quoted text' local cd export && echo readonly
+&& awk local done "$@" -eu grep sed "$@" 'quoted text' then
+		awk "$1" 'quoted text' /usr/bin --verbose awk done "$1" ${HOME} $(pwd) export
+/usr/bin /usr/bin printf 'quoted text' echo 2>/dev/null 'quoted text' export
+		then then "$1" 2>/dev/null local 2>/dev/null | done
+		--verbose 2>/dev/null readonly readonly done echo && 2>/dev/null "$@" "$1"
+	${HOME} 2>/dev/null export awk && local /usr/bin $(pwd) test ${HOME} export
+	readonly && --verbose 'quoted text' sed done && sed | -eu x=1 cd
+	echo "$@" sed sed ${HOME} test echo $(pwd) awk readonly $(pwd) printf "$1" /usr/bin
+	echo printf --verbose grep local
+then readonly export export test readonly --verbose
+		${HOME} sed && && /usr/bin | 'quoted text' $(pwd) | readonly
+$(pwd) "$@" test 'quoted text' sed done && && then
+	--verbose sed && printf readonly 'quoted text' $(pwd)
+	-eu readonly grep test sed 'quoted text' 'quoted text' | $(pwd) done /usr/bin
+then cd "$@" printf 'quoted text'
+	"$@" awk grep then "$@" grep --verbose $(pwd)
+		"$@" /usr/bin ${HOME} "$1"
+then test sed sed echo printf "$@" local sed /usr/bin "$@" test
+		printf done 2>/dev/null awk -eu grep readonly -eu export readonly
+		x=1 /usr/bin readonly /usr/bin 2>/dev/null | grep test sed export 2>/dev/null
+cd "$1" 'quoted text' $(pwd) x=1 then ${HOME} -eu export awk sed echo
+	"$1" -eu echo cd "$1" -eu cd
+cd ${HOME} --verbose --verbose echo
+	done awk --verbose 'quoted text' /usr/bin $(pwd) |
+	export -eu test x=1 readonly echo
+	/usr/bin echo grep --verbose awk 'quoted text' 2>/dev/null cd then
+		echo /usr/bin local $(pwd) /usr/bin
+local export && printf awk --verbose export /usr/bin $(pwd) test "$1" local
+"$1" grep readonly awk "$@" x=1 echo ${HOME} $(pwd) awk test grep
+	--verbose done then x=1 | /usr/bin done awk done echo /usr/bin ${HOME}
+		"$@" ${HOME} "$1" | export -eu --verbose 'quoted text' 2>/dev/null echo
+		printf 'quoted text' readonly $(pwd) "$@" $(pwd) export echo "$1"
+		sed ${HOME} grep $(pwd) awk "$@" && grep printf 'quoted text' "$@"
+		"$1" "$@" test "$@" $(pwd) && 'quoted text' echo then "$1" then cd
+		--verbose done printf local "$@" x=1 echo x=1 then
+		sed "$1" -eu "$1" printf sed then /usr/bin --verbose -eu /usr/bin
+/usr/bin readonly $(pwd) local then "$@" | && "$@" awk "$@" awk cd | 2>/dev/null
+	sed grep && "$@" -eu awk
+-eu 2>/dev/null echo && x=1 x=1
+--verbose /usr/bin then --verbose
+printf "$1" /usr/bin && test -eu --verbose "$1" | then /usr/bin
+	$(pwd) export echo test x=1 readonly 'quoted text'
+${HOME} 'quoted text' awk grep grep 'quoted text' awk x=1
+readonly test sed --verbose --verbose readonly sed 'quoted text' --verbose
+$(pwd) test test local local
+	"$@" readonly 'quoted text' 2>/dev/null | -eu
+x=1 -eu | "$1" && | sed then done x=1 "$@"
+"$@" /usr/bin --verbose --verbose --verbose 'quoted text'
+		echo test ${HOME} grep readonly
+	then cd "$@" | 'quoted text' "$1" cd done
+	'quoted text' export x=1 grep sed
+		&& ${HOME} printf && x=1 cd local 2>/dev/null cd
+-eu printf --verbose $(pwd) --verbose export "$@" /usr/bin printf awk cd awk
+readonly ${HOME} 2>/dev/null cd "$1" $(pwd) "$1" $(pwd) 2>/dev/null
+		test local && x=1 --verbose awk
+"$1" --verbose "$1" grep 'quoted text' echo sed export | "$@" printf readonly
+	done echo 'quoted text' x=1 printf --verbose awk /usr/bin --verbose sed then
+		/usr/bin echo "$@" --verbose local /usr/bin | sed --verbose test done "$1"
+--verbose export "$1" x=1 x=1
+	test && readonly ${HOME} ${HOME} "$@" -eu
+		echo cd printf && sed sed sed 2>/dev/null
+	'quoted text' grep awk x=1 sed && grep readonly echo | ${HOME} 2>/dev/null
+	readonly x=1 echo /usr/bin
+awk /usr/bin | ${HOME} "$1" echo && readonly /usr/bin "$1" "$1" local
+	cd local grep local grep 'quoted text' echo /usr/bin ${HOME} 'quoted text'
+	readonly done then awk
+export printf ${HOME} && | "$1" test -eu 'quoted text' echo ${HOME} readonly
+done $(pwd) test local "$@" cd "$1" then printf "$1" then "$@" 2>/dev/null
+		2>/dev/null printf grep "$@" printf 'quoted text'
+		"$@" "$1" /usr/bin awk "$@" done "$1" readonly grep
+x=1 --verbose done export
+2>/dev/null /usr/bin readonly
+		-eu local ${HOME} $(pwd) readonly then 2>/dev/null
+--verbose | 'quoted text' readonly echo 2>/dev/null printf echo readonly
+	echo export then /usr/bin awk /usr/bin
+	then -eu /usr/bin printf
+		done then 2>/dev/null echo x=1 then "$1" awk printf x=1 "$@"
+		x=1 test local "$1" && grep export cd -eu done "$@" then 'quoted text'
+		-eu cd echo 'quoted text' echo test ${HOME} awk -eu $(pwd) sed test test
+	/usr/bin /usr/bin | printf sed echo && 'quoted text' readonly sed local done readonly
+	/usr/bin echo awk grep 2>/dev/null local echo
+-eu export ${HOME} test export grep
+sed test echo sed -eu done $(pwd) && export && done -eu
+	--verbose "$1" done cd awk | printf export --verbose export
+		$(pwd) /usr/bin done echo local awk then sed export
+	done test export export x=1 2>/dev/null 2>/dev/null readonly && export -eu
+	"$1" sed then test grep
+'quoted text' awk sed $(pwd) local "$@" echo readonly local sed "$1" awk
+		grep 2>/dev/null 2>/dev/null
+	cd then ${HOME} echo 2>/dev/null
+cd && 2>/dev/null && printf printf printf /usr/bin printf "$@"
+x=1 test 'quoted text' "$1" x=1 readonly -eu echo -eu "$@" 'quoted text'
+	then x=1 'quoted text' && "$1" /usr/bin
+2>/dev/null awk cd done --verbose
+then sed readonly test x=1 $(pwd) awk echo export "$1" awk then test -eu test test
+printf done "$@" x=1 awk --verbose | printf && x=1
+"$1" "$@" --verbose /usr/bin
+sed x=1 $(pwd) export /usr/bin x=1 2>/dev/null local -eu
+	done local echo cd test ${HOME} then
+	${HOME} --verbose readonly test $(pwd)
+		test --verbose x=1 | local test readonly grep echo test readonly
+		sed ${HOME} export 'quoted text' 2>/dev/null local sed --verbose
+		local 2>/dev/null $(pwd) test local
+'quoted text' --verbose local -eu readonly && test
+	readonly awk readonly 'quoted text' local $(pwd) cd
+		cd printf printf "$1" --verbose ${HOME} test export
+	then export x=1 done printf awk done $(pwd)
+	-eu then 2>/dev/null ${HOME} | ${HOME} -eu x=1 /usr/bin test readonly
+$(pwd) x=1 --verbose x=1 awk readonly awk "$@" done awk --verbose "$@" "$1" "$@"
+	"$@" -eu echo export cd x=1 $(pwd) echo test && "$@" cd $(pwd) x=1 echo
+	"$1" done 'quoted text' cd readonly
+		awk echo printf "$1" awk /usr/bin && sed && printf
+		"$1" grep then x=1 "$1" "$1" x=1 /usr/bin readonly then done test -eu readonly 2>/dev/null
+	export grep 2>/dev/null /usr/bin readonly grep /usr/bin
+2>/dev/null | grep printf /usr/bin export --verbose | echo
+		export export | && local echo $(pwd) local --verbose && /usr/bin local
+done | ${HOME} cd -eu 2>/dev/null $(pwd) awk && grep echo x=1 --verbose printf
+	export then readonly "$1" sed "$1" ${HOME} awk $(pwd) done
+		readonly export cd sed && /usr/bin --verbose
+		echo 'quoted text' printf "$@" echo printf -eu "$1" cd done test
+readonly printf cd local x=1 x=1 && $(pwd)
+	${HOME} $(pwd) printf x=1 local && "$1" &&
+echo test x=1 2>/dev/null echo echo
+		&& grep readonly $(pwd)
+	local | readonly grep | 2>/dev/null export
+		export echo --verbose readonly done | cd echo && x=1 'quoted text'
+	${HOME} done && $(pwd) /usr/bin then $(pwd) awk export 'quoted text' x=1 done
+${HOME} readonly --verbose 'quoted text' printf
+then done cd ${HOME} test cd
+grep ${HOME} && awk ${HOME} printf
+	grep awk | && | then -eu echo readonly --verbose
+echo cd grep 2>/dev/null awk done $(pwd) grep $(pwd)
+		| sed printf | "$1" grep awk printf done export --verbose sed x=1
+echo then "$1" -eu ${HOME} $(pwd) awk printf x=1
+		"$@" then && printf then --verbose
+	x=1 -eu 'quoted text' sed 'quoted text' --verbose --verbose then /usr/bin /usr/bin
+		cd cd cd -eu && local printf
+awk local readonly local cd done /usr/bin done -eu ${HOME}
+"$@" awk 'quoted text'
+	&& "$1" && && sed -eu awk readonly sed awk done echo export 2>/dev/null $(pwd)
+		2>/dev/null -eu done 2>/dev/null |
+		${HOME} then grep x=1 x=1 "$@" -eu "$@" echo
+	cd test "$1" "$@" echo && done --verbose done sed $(pwd)
+		2>/dev/null readonly "$@" echo && test "$@"
+		local printf && test cd printf /usr/bin | local 2>/dev/null
+/usr/bin "$1" readonly cd "$1" "$@" -eu local local local
+&& /usr/bin -eu grep export cd 2>/dev/null local local awk grep && then "$1"
+| x=1 then ${HOME} awk awk printf test cd
+printf 2>/dev/null && 'quoted text'
+--verbose && $(pwd) test local ${HOME} x=1 readonly ${HOME}
+done sed "$1" grep ${HOME} printf
+	printf done printf done sed
+	--verbose local local ${HOME} --verbose sed |
+-eu --verbose --verbose
+2>/dev/null sed local export
+		&& then 2>/dev/null --verbose test
+		"$1" "$1" test awk "$@" grep then ${HOME} /usr/bin test --verbose
+"$1" /usr/bin printf --verbose | grep awk $(pwd) $(pwd)
+		-eu /usr/bin readonly export test | printf --verbose
+		x=1 cd done readonly printf | 'quoted text' 2>/dev/null cd readonly echo --verbose
+	/usr/bin export awk awk sed -eu cd
+	"$1" | export x=1 && 'quoted text' then local ${HOME} ${HOME} 'quoted text'
+export done readonly local then
+		"$1" /usr/bin test | printf
+done awk printf local x=1 ${HOME} readonly test "$@" /usr/bin
+cd --verbose "$@" x=1 --verbose test ${HOME} 'quoted text' export 'quoted text'
+/usr/bin x=1 && then test | "$1" "$@" "$1"
+echo sed 2>/dev/null x=1 'quoted text' --verbose
+		"$1" /usr/bin test $(pwd) awk
+		2>/dev/null 2>/dev/null "$1" | --verbose $(pwd) local echo -eu 2>/dev/null
+	--verbose | /usr/bin local /usr/bin | $(pwd) export then 2>/dev/null
+		-eu export done done "$1" awk readonly then "$1" export export
+	"$@" --verbose test done 2>/dev/null -eu then && then
+"$@" && printf done export
+test "$1" sed 2>/dev/null $(pwd) -eu sed && | echo local "$@" awk
+		done grep export done "$1" 'quoted text'
+		"$1" grep then --verbose $(pwd) 2>/dev/null "$@" ${HOME} x=1 grep
+	$(pwd) /usr/bin && -eu awk printf
+		"$@" && "$@" echo test test printf echo
+then ${HOME} echo test --verbose readonly "$1" $(pwd) readonly export cd
+		awk "$1" cd cd readonly x=1 && 'quoted text' test
+readonly local cd ${HOME} 2>/dev/null x=1 ${HOME} "$1" /usr/bin x=1 "$1"
+| local ${HOME} test readonly $(pwd) awk x=1 cd
+	"$1" awk readonly cd awk
+	then | -eu x=1 done readonly grep /usr/bin 2>/dev/null
+		| sed local | then local echo -eu readonly printf then awk test test test
+		$(pwd) x=1 then "$@" export printf grep ${HOME}
+		done -eu cd --verbose local x=1 test export 2>/dev/null
+awk ${HOME} echo then --verbose echo "$1" export x=1 $(pwd) 'quoted text'
+/usr/bin printf echo |
+		export --verbose | printf 'quoted text' test readonly
+		local 'quoted text' grep then "$1"
+	2>/dev/null printf | readonly ${HOME}
+	$(pwd) --verbose 2>/dev/null 'quoted text' &&
+$(pwd) cd local --verbose readonly then test /usr/bin echo then
+	'quoted text' 2>/dev/null local ${HOME} 2>/dev/null sed done ${HOME}
+&& done test done export ${HOME} 'quoted text' --verbose sed done
+		export local ${HOME} $(pwd) readonly "$1" 2>/dev/null
+		&& "$@" test "$@" readonly 'quoted text'
+cd -eu /usr/bin | | ${HOME} then test done export
+		export local --verbose /usr/bin export $(pwd)
+		"$1" then done x=1 | awk readonly ${HOME} --verbose
+		$(pwd) echo 'quoted text' awk $(pwd) done then done readonly 2>/dev/null
+	"$@" 2>/dev/null then printf grep readonly
+		readonly sed --verbose "$@" $(pwd) 'quoted text' printf
+	-eu 'quoted text' $(pwd) ${HOME} | grep echo
+		export printf 'quoted text' grep "$@" /usr/bin readonly $(pwd)
+	readonly "$1" -eu 'quoted text'
+	readonly $(pwd) ${HOME} grep ${HOME} 'quoted text' && $(pwd) --verbose ${HOME}
+-eu local -eu awk --verbose /usr/bin sed x=1 cd export local export
+	printf x=1 $(pwd) readonly 'quoted text' echo grep -eu ${HOME} export
+-eu "$@" done cd local echo 2>/dev/null printf "$@" done
+	local printf "$@" 'quoted text' 2>/dev/null
+		--verbose | --verbose cd /usr/bin 2>/dev/null "$1" 'quoted text' done
+| cd echo | "$1" grep test /usr/bin readonly then cd 2>/dev/null
+echo printf 2>/dev/null /usr/bin then --verbose
+	readonly local test && readonly
+		$(pwd) "$@" cd --verbose ${HOME} echo awk done export "$@"
+'quoted text' | printf && grep $(pwd) -eu sed test $(pwd) awk grep
+'quoted text' export 2>/dev/null $(pwd) done /usr/bin 'quoted text'
+		echo ${HOME} 'quoted text'
+		"$1" cd $(pwd) sed sed local cd x=1 export grep "$1" export
+test sed local /usr/bin printf grep | --verbose awk /usr/bin | "$@"
+		local ${HOME} --verbose "$@" local readonly x=1 done sed 'quoted text'
+	-eu /usr/bin "$@" done awk --verbose cd /usr/bin ${HOME} readonly
+grep -eu printf sed printf
+	| | export cd | sed export export echo export --verbose done cd && printf --verbose
+		x=1 done readonly "$@" done cd 'quoted text' readonly printf
+		printf cd sed test awk sed done echo awk then 'quoted text'
+	x=1 "$1" $(pwd) "$1" && done | echo --verbose readonly local done
+		printf cd sed x=1 "$1" readonly 2>/dev/null &&
+		grep then readonly then -eu "$1" x=1 "$1" &&
+		readonly --verbose done sed readonly 2>/dev/null "$1" then
+sed | $(pwd) printf -eu
+	echo echo -eu x=1 2>/dev/null done "$1"
+		--verbose export echo /usr/bin then test ${HOME} --verbose
+	"$@" cd 'quoted text' 'quoted text'
+x=1 "$@" --verbose readonly && printf --verbose 'quoted text' -eu "$1"
+--verbose done sed test 'quoted text' done grep 2>/dev/null
+local /usr/bin "$@" awk | "$@" export "$@" 'quoted text'
+	${HOME} echo awk | /usr/bin done && 'quoted text' test x=1
+		readonly export 'quoted text' -eu done 'quoted text' "$@"
+		-eu && cd x=1 'quoted text' cd cd /usr/bin 'quoted text'
+sed | cd local "$1" 2>/dev/null test "$@" --verbose done
+'quoted text' sed ${HOME} -eu --verbose printf --verbose readonly
+	-eu && sed && -eu x=1
+local awk export $(pwd) "$1"
+	local && ${HOME} "$@" export readonly local $(pwd) grep ${HOME} test x=1
+test then local export --verbose --verbose 'quoted text' readonly awk | && echo
+	echo x=1 'quoted text' --verbose
+	export cd /usr/bin printf then 2>/dev/null --verbose awk
+	${HOME} done test awk x=1 grep cd ${HOME} awk grep test | 'quoted text'
+sed --verbose --verbose | cd $(pwd) ${HOME} | done echo test grep
+		${HOME} awk readonly sed "$@" echo x=1 readonly
+		then 2>/dev/null done sed "$@" test $(pwd) done local test "$1"
+	2>/dev/null "$@" "$1" $(pwd) 'quoted text' ${HOME} 'quoted text' export
+| x=1 test sed | x=1 | -eu cd -eu && --verbose
+		cd -eu /usr/bin done cd "$1" "$1" export -eu
+x=1 done ${HOME} echo ${HOME} grep cd done ${HOME} grep grep readonly
+	readonly printf -eu printf echo 'quoted text' /usr/bin echo echo echo 'quoted text'
+| ${HOME} x=1 export --verbose 'quoted text' "$1" export then
+done printf printf cd /usr/bin -eu printf --verbose | /usr/bin x=1 readonly x=1
+	2>/dev/null done echo x=1 printf "$@" && then export then /usr/bin x=1
+| done /usr/bin printf "$@" /usr/bin
+-eu readonly test "$1" ${HOME} grep grep /usr/bin cd | x=1 --verbose
+printf $(pwd) then test ${HOME} && /usr/bin
+	x=1 then 'quoted text' | done | export -eu cd echo --verbose
+	echo x=1 cd 'quoted text' local && && x=1 then $(pwd) 'quoted text'
+		2>/dev/null x=1 printf && sed echo local cd sed test 2>/dev/null $(pwd) printf
+readonly done | x=1 cd readonly printf -eu awk done then
+		2>/dev/null --verbose
+		| $(pwd) "$@" /usr/bin sed local ${HOME} echo "$1" awk /usr/bin
+--verbose sed readonly | cd x=1 $(pwd) ${HOME} export
+export echo && then | local printf x=1 test
+	sed cd done "$1" then then export "$1" $(pwd)
+&& then ${HOME} && 2>/dev/null "$@" 'quoted text'
+		grep grep 'quoted text' "$@" /usr/bin ${HOME} "$@" -eu
+	'quoted text' $(pwd) 2>/dev/null 'quoted text' x=1 export grep readonly export
+		x=1 -eu ${HOME} && export echo | local --verbose /usr/bin 'quoted text' readonly
+local "$1" export 'quoted text' done
+local /usr/bin 'quoted text' sed awk 2>/dev/null cd printf --verbose
+		readonly -eu x=1 then
+local awk ${HOME} ${HOME} test test cd export local
+	done done 2>/dev/null echo "$@" test && sed echo -eu local ${HOME} test
+export sed export /usr/bin
+		"$@" cd readonly sed ${HOME} awk local awk | echo sed --verbose 2>/dev/null done
+echo 'quoted text' test echo $(pwd) && 'quoted text' sed 2>/dev/null
+		done -eu "$1" "$@" local --verbose
+	printf sed 'quoted text' printf ${HOME}
+--verbose done done sed
+printf -eu "$1" x=1 $(pwd) awk printf x=1 grep done "$1" | && local
+		${HOME} x=1 readonly
+		"$1" then ${HOME} -eu ${HOME} && "$1" done "$@"
+2>/dev/null $(pwd) 2>/dev/null 'quoted text' -eu && export
+		grep 'quoted text' sed -eu local x=1 local test $(pwd) | cd readonly /usr/bin
+&& 'quoted text' readonly x=1 && export then local grep export
+		${HOME} --verbose export 2>/dev/null --verbose cd | cd
+	--verbose awk -eu done
+		echo && 'quoted text' /usr/bin done $(pwd) grep sed then $(pwd) |
+x=1 'quoted text' "$1" echo echo grep ${HOME} -eu 2>/dev/null
+-eu "$1" && awk grep x=1 /usr/bin then x=1
+	--verbose readonly then local local ${HOME} awk "$@" --verbose "$1"
+	&& sed 'quoted text' $(pwd) x=1 "$@" sed cd --verbose
+	2>/dev/null | $(pwd) done "$@" 2>/dev/null && 'quoted text' cd x=1
+		local 'quoted text' $(pwd) then printf grep --verbose printf
+	printf test cd /usr/bin test cd sed -eu "$@" test ${HOME} sed sed
+	/usr/bin test done sed /usr/bin -eu "$@"
+/usr/bin awk sed /usr/bin 'quoted text' readonly
+		| 2>/dev/null | /usr/bin 2>/dev/null
+		/usr/bin sed /usr/bin grep $(pwd) /usr/bin x=1 test | $(pwd) "$1" awk
+	export | done ${HOME} grep grep 2>/dev/null 2>/dev/null
+--verbose export "$1" -eu readonly printf ${HOME} readonly
+		'quoted text' then sed 'quoted text' "$@" -eu "$@" awk --verbose /usr/bin
+done 2>/dev/null readonly --verbose cd cd export
+		"$@" readonly 'quoted text' cd local export $(pwd) cd echo readonly 2>/dev/null
+echo sed then ${HOME} awk $(pwd) ${HOME} 'quoted text' /usr/bin 'quoted text'
+test x=1 printf && --verbose -eu "$1" ${HOME} awk local grep -eu done
+		grep sed printf printf 'quoted text'
+		test sed grep --verbose 'quoted text' /usr/bin /usr/bin 'quoted text'
+	'quoted text' echo printf
+cd readonly "$1" ${HOME} x=1 printf | /usr/bin awk
+	${HOME} "$1" printf --verbose export grep echo awk test sed grep done x=1 --verbose
+	grep 2>/dev/null 2>/dev/null printf
+then echo ${HOME} cd -eu
+"$1" then "$@" then export ${HOME} x=1 then ${HOME} "$@" x=1 ${HOME} sed local
+	test "$@" test cd ${HOME} printf done done export /usr/bin
+done grep grep $(pwd) ${HOME} 2>/dev/null $(pwd) $(pwd) 2>/dev/null
+	x=1 export ${HOME} sed $(pwd) cd /usr/bin 'quoted text' /usr/bin ${HOME} done
+grep ${HOME} -eu x=1 grep "$1"
+	x=1 test readonly x=1 done cd $(pwd) | "$1" printf local export && -eu | printf
+		&& "$1" cd 'quoted text' $(pwd) "$@" then x=1 --verbose cd /usr/bin
+	x=1 local -eu done echo test /usr/bin
+"$1" printf local x=1 test test /usr/bin printf
+	"$@" 2>/dev/null printf "$@" awk "$1" readonly --verbose /usr/bin readonly
+	/usr/bin sed x=1 done cd $(pwd)
+	awk awk ${HOME} printf cd && 2>/dev/null 2>/dev/null awk "$@"
+2>/dev/null sed sed echo local && done done /usr/bin
+	/usr/bin echo && "$1" -eu ${HOME} && /usr/bin
+	&& readonly "$@" then 2>/dev/null $(pwd) done export local --verbose
+grep readonly && 'quoted text'
+${HOME} ${HOME} echo ${HOME}
+2>/dev/null 2>/dev/null $(pwd) 2>/dev/null awk awk
+		readonly printf local -eu then test then 'quoted text'
+		2>/dev/null 'quoted text' $(pwd) done grep then --verbose printf test
+echo -eu -eu x=1 cd test 'quoted text' test local "$1" 2>/dev/null
+done export test sed ${HOME} x=1 test "$@" grep &&
+	/usr/bin done awk export
+grep /usr/bin "$@" "$@" sed then && test test
+--verbose cd $(pwd) printf -eu 2>/dev/null
+	printf $(pwd) ${HOME} x=1 readonly "$@" test 2>/dev/null
+awk cd $(pwd) sed 'quoted text' "$@"
+--verbose && cd -eu local sed echo printf | $(pwd) 2>/dev/null
+		/usr/bin "$@" $(pwd) | done ${HOME} x=1
+		"$1" printf awk grep printf readonly -eu x=1 "$1" awk then
+		$(pwd) printf x=1 echo "$1" test printf awk "$1"
+| --verbose printf awk done readonly -eu done
+readonly 2>/dev/null done then
+| echo 'quoted text' printf cd --verbose awk | export
+echo local ${HOME} | ${HOME} grep "$@" readonly 2>/dev/null
+&& | printf local 2>/dev/null
+--verbose grep awk sed 2>/dev/null
+		awk printf done "$1" && grep echo test x=1 sed ${HOME} ${HOME}
+		--verbose x=1 "$@" readonly x=1 x=1 done done --verbose cd done
+printf test "$@" "$@" "$1" /usr/bin /usr/bin 'quoted text' x=1
+then test "$1" "$1" | sed 2>/dev/null 'quoted text' grep x=1 ${HOME} then "$@"
+	"$1" "$@" cd -eu 2>/dev/null
+		-eu | export && export && x=1 local done cd grep ${HOME} export
+		sed cd ${HOME} local printf grep && echo export export grep export "$1"
+grep awk ${HOME} 2>/dev/null ${HOME} && export sed export /usr/bin then
+	--verbose cd test ${HOME}
+		local && -eu echo 'quoted text' export printf
+done sed | x=1 awk "$1" $(pwd) && "$1"
+	cd /usr/bin ${HOME} "$1" "$@" -eu grep && export ${HOME} cd cd
+	x=1 | --verbose then -eu local printf && $(pwd) cd 2>/dev/null cd "$1"
+| x=1 sed sed done -eu -eu $(pwd) 'quoted text'
+		"$1" local && done local 2>/dev/null
+	grep ${HOME} $(pwd) | then x=1
+	${HOME} 2>/dev/null | "$@"
+		&& /usr/bin awk cd echo
+	sed -eu then awk x=1 "$1" local echo | x=1 done && local
+	local /usr/bin && "$@" printf local ${HOME} cd test "$1" /usr/bin ${HOME} | ${HOME}
+		printf 'quoted text' sed echo
+	$(pwd) test | done export "$@" done 2>/dev/null 'quoted text'
+		echo /usr/bin readonly ${HOME} --verbose && cd cd awk 'quoted text'
+		$(pwd) cd test 'quoted text' $(pwd) awk local ${HOME} /usr/bin then
+${HOME} printf grep ${HOME} "$1" awk done done local echo sed export sed test
+	${HOME} printf 2>/dev/null echo sed printf export
+-eu local | 'quoted text' sed "$1" 2>/dev/null | export "$1" echo "$1"
+	$(pwd) readonly done "$@" local /usr/bin 2>/dev/null grep export sed readonly
+--verbose grep "$@" grep local local "$@" test readonly grep
+	2>/dev/null printf ${HOME} "$@" grep | done sed 'quoted text'
+	'quoted text' $(pwd) 'quoted text' x=1 "$1" --verbose test awk printf test
+	-eu export sed readonly cd local 2>/dev/null awk done then printf
+	done | grep "$1" && then | --verbose echo 2>/dev/null
+2>/dev/null test then done
+done ${HOME} | export "$@" printf export
+		readonly then done then && | | $(pwd)
+	"$1" -eu local local grep done $(pwd) "$@" && 'quoted text' 'quoted text' awk
+		cd -eu cd cd /usr/bin awk
+	then x=1 "$@" local && 'quoted text' readonly export
+		${HOME} cd done 2>/dev/null readonly | grep "$1" awk sed awk /usr/bin export x=1
+-eu export printf export printf local | && local echo printf export grep --verbose
+	$(pwd) x=1 x=1 test $(pwd) echo local "$1"
+		/usr/bin "$@" $(pwd) 'quoted text' echo -eu ${HOME} echo
+	"$1" x=1 grep export echo "$1" sed then 2>/dev/null local "$@" && -eu $(pwd) printf
+	$(pwd) $(pwd) cd grep && test $(pwd) --verbose
+	${HOME} readonly then --verbose done && export echo
+cd "$@" --verbose $(pwd) awk
+export 2>/dev/null 'quoted text' /usr/bin -eu "$1" /usr/bin
+cd /usr/bin ${HOME} export "$@" awk sed /usr/bin
+		then awk awk cd awk ${HOME} /usr/bin then printf x=1 ${HOME} x=1 -eu "$@" cd sed
+-eu test 'quoted text' awk test export sed echo readonly local 'quoted text'
+	'quoted text' echo then done && ${HOME}
+local 2>/dev/null echo "$1" readonly test grep
+sed test 'quoted text' cd $(pwd) awk export ${HOME} readonly
+	readonly export grep readonly printf sed $(pwd) then then $(pwd) "$@" test /usr/bin
+	/usr/bin ${HOME} printf -eu local done /usr/bin done
+		$(pwd) cd /usr/bin ${HOME} "$@" | && echo grep 2>/dev/null
+	&& awk echo x=1 awk sed awk echo printf local x=1 echo
+	-eu -eu "$@" grep --verbose && readonly 2>/dev/null printf 2>/dev/null cd "$1" awk
+-eu $(pwd) grep $(pwd) /usr/bin readonly echo
+		awk sed echo "$@" 'quoted text' printf | 2>/dev/null
+		then readonly 'quoted text' | echo
+	export "$@" readonly 2>/dev/null
+		echo && readonly x=1 --verbose echo x=1 -eu $(pwd) /usr/bin
+		/usr/bin test $(pwd) done echo printf test $(pwd) test | printf test done
+		awk ${HOME} $(pwd) x=1 printf
+	export --verbose cd /usr/bin awk "$@" x=1 | 'quoted text'
+		sed x=1 x=1 printf | 2>/dev/null local awk ${HOME} $(pwd)
+cd && "$1" test echo cd --verbose --verbose cd grep ${HOME}
+		$(pwd) test "$1" 'quoted text' printf 2>/dev/null ${HOME}
+'quoted text' grep local "$1" local grep | test
+#include c251.sh
+	printf sed printf -eu "$1" local && x=1 2>/dev/null 2>/dev/null ${HOME}
+printf 2>/dev/null -eu && then && "$@" export echo -eu awk x=1 awk local /usr/bin
+2>/dev/null x=1 local -eu "$@" printf 2>/dev/null 'quoted text'
+	2>/dev/null then test then awk export
+		printf printf done 'quoted text' --verbose
+		test done | sed x=1 ${HOME} /usr/bin local local x=1 sed
+	grep --verbose then sed --verbose then local x=1 awk
+	export /usr/bin && /usr/bin grep --verbose /usr/bin printf "$1"
+"$1" --verbose $(pwd) | readonly printf export $(pwd) -eu test cd printf then
+"$1" cd readonly export "$@" 'quoted text'
+	x=1 sed $(pwd) 'quoted text' cd cd $(pwd)
+	&& test 2>/dev/null --verbose readonly
+2>/dev/null "$@" echo ${HOME} x=1 cd done $(pwd)
+		awk local ${HOME} "$@" x=1 -eu awk sed 'quoted text' sed test awk /usr/bin echo
+	--verbose readonly /usr/bin done -eu then ${HOME}
+2>/dev/null export "$@" test printf readonly awk then --verbose awk "$@"
+	readonly 'quoted text' ${HOME} $(pwd) local | -eu
+-eu x=1 local "$1" | 2>/dev/null local cd readonly --verbose | awk
+local | echo $(pwd) $(pwd) | | done
+	export local /usr/bin local printf grep local -eu grep grep
+	grep test readonly cd sed cd -eu echo | "$1" -eu
+	'quoted text' readonly 'quoted text' readonly grep && local
+	/usr/bin && sed ${HOME} then /usr/bin 'quoted text' |
+--verbose ${HOME} --verbose /usr/bin done grep grep
+	${HOME} | --verbose then /usr/bin grep 2>/dev/null
+	printf ${HOME} test "$@" local awk cd cd $(pwd) grep ${HOME} test
+	awk | sed -eu echo then done done then
+		2>/dev/null cd grep echo | | $(pwd) -eu /usr/bin done /usr/bin readonly
+sed | local echo $(pwd) cd export ${HOME} test test
+		${HOME} echo export && export
+	${HOME} -eu grep grep --verbose export echo then grep x=1 /usr/bin
+	| echo then x=1 "$1" sed local 'quoted text' test $(pwd) $(pwd) grep x=1
+		export --verbose x=1 'quoted text' 2>/dev/null
+		2>/dev/null ${HOME} grep $(pwd)
+		${HOME} cd cd readonly -eu awk test test /usr/bin | cd
+--verbose $(pwd) "$1" then
+		--verbose printf readonly $(pwd)
+"$1" && export | then --verbose $(pwd) -eu export local
+		export ${HOME} --verbose && 2>/dev/null
+		/usr/bin grep readonly awk done "$1" then sed then
+		&& cd echo test "$@" export 2>/dev/null sed cd && $(pwd) echo export readonly
+	&& awk echo /usr/bin cd "$@" -eu readonly | "$1" --verbose "$@" echo readonly
+/usr/bin awk /usr/bin test
+	awk 2>/dev/null sed awk readonly awk sed --verbose "$1" test cd
+-eu | readonly grep 2>/dev/null cd cd echo "$@" done local
+		export echo 'quoted text' printf printf done
+		'quoted text' cd cd cd "$@" && awk grep echo 2>/dev/null
+	awk /usr/bin "$1" sed --verbose x=1 test $(pwd) x=1 'quoted text'
+echo x=1 && awk -eu readonly "$@" --verbose x=1 cd 'quoted text'
+		'quoted text' "$@" readonly sed awk sed | local done echo sed 2>/dev/null
+${HOME} && done readonly $(pwd) ${HOME} readonly test --verbose
+	export test --verbose local cd export -eu cd echo && x=1 /usr/bin
+	readonly echo | | 2>/dev/null
+	"$1" echo test export then x=1 grep
+	test 'quoted text' ${HOME} printf "$1" then "$@"
+	--verbose && && readonly -eu sed /usr/bin
+		local local sed awk sed | grep x=1 local then
+/usr/bin /usr/bin then && "$@" "$1" done /usr/bin -eu "$1" "$1" test export
+		--verbose local "$1" 2>/dev/null
+"$@" done export sed done
+		readonly test awk "$@" test
+		awk cd done done grep export echo
+2>/dev/null echo 2>/dev/null sed cd | $(pwd) | export
+		&& -eu 'quoted text' printf "$@" echo | ${HOME} /usr/bin readonly then awk /usr/bin
+	grep printf 2>/dev/null cd grep readonly export
+		readonly --verbose &&
+sed done | local cd then ${HOME} done export echo /usr/bin
+echo ${HOME} local --verbose --verbose
+/usr/bin test | awk x=1 && export | $(pwd) x=1 echo && && test $(pwd)
+	&& then test /usr/bin /usr/bin ${HOME} readonly -eu then "$@" && local
+	2>/dev/null "$@" "$@" x=1
+		--verbose $(pwd) awk awk grep | ${HOME} test 'quoted text' | x=1 done echo
+	cd awk printf --verbose local
+	$(pwd) ${HOME} /usr/bin local
+	grep | export && readonly export -eu awk --verbose ${HOME} export
+readonly -eu sed export
+		cd done $(pwd) | "$@" readonly $(pwd) then awk ${HOME} export
+		echo cd readonly awk "$@" --verbose export
+	2>/dev/null "$1" ${HOME} readonly |
+	"$1" test local -eu 'quoted text' cd "$@" readonly
+	-eu | 'quoted text' "$1" 2>/dev/null done done grep awk grep
+"$1" "$@" | then cd done ${HOME} test ${HOME} local -eu | test /usr/bin
+/usr/bin && | 2>/dev/null test export awk
+		done ${HOME} -eu export then cd grep ${HOME} then readonly 'quoted text'
+	then /usr/bin test /usr/bin
+		x=1 | 2>/dev/null | local 'quoted text' printf ${HOME} awk --verbose
+		local /usr/bin awk echo local 'quoted text' "$1" "$1" | "$1"
+		"$@" awk export ${HOME} cd
+		--verbose export done echo /usr/bin
+		"$1" local export "$1" /usr/bin then echo done 'quoted text' awk awk ${HOME}
+	| cd then export x=1 | local 'quoted text' echo -eu test local && --verbose
+		2>/dev/null then cd "$1" /usr/bin grep printf
+	"$@" cd "$1" "$@" done printf && readonly
+		"$@" grep | printf cd | sed && /usr/bin /usr/bin export 2>/dev/null cd cd echo then
+		grep echo test sed ${HOME} test echo "$1" && -eu
+		echo /usr/bin cd -eu readonly echo test then cd ${HOME} printf awk export
+		test "$1" sed sed test 'quoted text'
+	--verbose local 'quoted text'
+		/usr/bin 2>/dev/null printf readonly --verbose x=1 sed
+		export readonly ${HOME} export
+		done readonly grep && awk echo 'quoted text' done "$@" | $(pwd) /usr/bin
+		"$1" readonly grep export -eu printf printf echo grep
+		--verbose awk /usr/bin test local "$1" 'quoted text' "$1" "$@"
+		sed awk sed 'quoted text'
+"$@" && -eu && | && /usr/bin awk cd -eu --verbose -eu done | x=1 awk $(pwd)
+		2>/dev/null -eu printf ${HOME} echo
+		cd /usr/bin cd && --verbose then
+--verbose sed --verbose
+	| readonly $(pwd) ${HOME} test test
+${HOME} "$1" 'quoted text' 2>/dev/null
+cd ${HOME} 2>/dev/null test --verbose x=1 sed export -eu awk x=1 $(pwd)
+2>/dev/null grep /usr/bin echo ${HOME}
+		$(pwd) --verbose printf 2>/dev/null export
+test sed export done | ${HOME} then printf then local $(pwd)
+		'quoted text' "$@" $(pwd) printf x=1 "$@" grep readonly cd $(pwd) | grep 'quoted text'
+		/usr/bin x=1 'quoted text' ${HOME} echo export echo readonly x=1 then
+		awk local ${HOME} then x=1 && ${HOME} printf "$1" && ${HOME} readonly readonly
+2>/dev/null echo && awk "$1" sed test && && export
+${HOME} test --verbose -eu local sed
+		"$1" local $(pwd) | export ${HOME} export -eu ${HOME} echo done
+		--verbose then echo ${HOME} "$1" local && &&
+		$(pwd) sed echo $(pwd)
+	"$@" --verbose 2>/dev/null printf
+		2>/dev/null done | "$@" then echo -eu 'quoted text' grep local &&
+${HOME} "$1" test -eu "$@"
+sed local -eu export "$@" done local awk echo "$@" grep ${HOME} test test
+2>/dev/null grep export /usr/bin x=1 2>/dev/null cd done
+	test awk && then -eu grep export awk local --verbose /usr/bin
+x=1 x=1 readonly done printf export awk
+	then x=1 x=1 $(pwd) /usr/bin readonly 'quoted text' cd
+	awk grep && grep readonly test cd "$1" test
+test local readonly then then x=1 done
+	"$@" 'quoted text' local grep $(pwd) ${HOME} "$@" x=1
+readonly && 2>/dev/null export
+		--verbose done done export export
+echo $(pwd) "$1" test 'quoted text' | | local ${HOME} local 2>/dev/null
+		export && | readonly ${HOME}
+		test "$1" test awk |
+done local export "$@" done echo done
+local | --verbose readonly
+	printf | ${HOME} sed done readonly local grep -eu
+	x=1 test test && && && --verbose test 2>/dev/null then 'quoted text'
+&& then awk | awk test export test
+	printf echo readonly -eu 'quoted text'
+	local grep --verbose -eu readonly 'quoted text' local ${HOME} echo $(pwd) 'quoted text'
+	$(pwd) echo done | readonly -eu test "$1" 2>/dev/null |
+$(pwd) /usr/bin export cd export x=1 && && printf
+		export sed local then "$@" then readonly export local readonly -eu | awk done
+"$@" sed --verbose 2>/dev/null
+"$1" local printf test awk grep then local --verbose
+"$1" test "$1" "$@" 'quoted text' | -eu test echo x=1 done cd 'quoted text' && ${HOME}
+	$(pwd) done | x=1 'quoted text' 'quoted text'
+		sed echo done readonly "$1" "$@" "$@" 'quoted text'
+'quoted text' -eu 2>/dev/null "$@" /usr/bin grep local
+	--verbose test ${HOME} $(pwd) readonly export local 'quoted text' sed |
+echo --verbose x=1 readonly export --verbose test local test cd |
+echo "$1" sed sed | 2>/dev/null /usr/bin "$@" -eu export then
+		test 2>/dev/null --verbose /usr/bin
+		${HOME} /usr/bin $(pwd) /usr/bin ${HOME} $(pwd) printf x=1 $(pwd) cd x=1 test
+	cd awk sed grep printf -eu 2>/dev/null printf
+		--verbose printf then
+		echo test test 2>/dev/null then $(pwd) "$1" awk
+	grep export printf --verbose -eu then cd echo "$@" -eu $(pwd) export
+		test grep /usr/bin --verbose cd printf x=1 | awk && 'quoted text' --verbose
+		$(pwd) awk cd echo export "$@" awk /usr/bin done "$@" | test 2>/dev/null
+	-eu awk readonly grep 'quoted text' printf export grep export
+		"$@" echo grep -eu | done -eu x=1 --verbose -eu 2>/dev/null --verbose export
+test /usr/bin readonly | --verbose -eu
+	grep 'quoted text' 2>/dev/null | ${HOME} test && local cd --verbose
+-eu grep | "$1" 'quoted text' cd then awk local
+		$(pwd) /usr/bin | readonly sed -eu "$@" local "$@" "$@" then && 2>/dev/null
+	sed readonly cd done &&
+$(pwd) cd cd x=1 -eu done --verbose printf
+	then then -eu ${HOME} test awk $(pwd) -eu echo
+		x=1 -eu sed local && x=1 readonly cd local 2>/dev/null
+		local && then x=1 local "$1" printf && 2>/dev/null "$@" sed
+grep $(pwd) readonly done awk x=1 readonly -eu awk
+2>/dev/null $(pwd) sed sed -eu "$1" awk awk awk $(pwd)
+		echo && 2>/dev/null --verbose then 'quoted text' 2>/dev/null readonly
+		grep printf echo /usr/bin export
+	| readonly /usr/bin awk $(pwd) echo cd grep ${HOME}
+		"$@" | | | "$@" export grep 'quoted text'
+	'quoted text' awk --verbose 'quoted text' "$1" grep x=1 local awk /usr/bin
+"$@" -eu 2>/dev/null readonly readonly export 2>/dev/null
+then sed printf echo grep printf
+"$@" done -eu x=1 then echo x=1 done echo x=1
+export "$1" local ${HOME}
+	"$@" export then "$1" "$1" sed $(pwd)
+--verbose "$@" x=1 echo /usr/bin grep echo readonly 'quoted text' awk | ${HOME}
+	/usr/bin $(pwd) awk readonly
+	echo "$@" $(pwd) --verbose 2>/dev/null then x=1
+	| export echo --verbose
+then "$1" grep then "$1" echo cd printf 2>/dev/null export
+		readonly x=1 $(pwd) done cd then grep $(pwd) done awk
+grep && sed -eu printf export done 'quoted text' 2>/dev/null
+		| "$@" $(pwd) export 'quoted text' readonly readonly echo && $(pwd)
+		echo then "$@" awk --verbose echo cd x=1 2>/dev/null
+		"$1" $(pwd) "$1" awk 'quoted text'
+--verbose && 2>/dev/null then $(pwd) | --verbose then x=1 sed
+		echo /usr/bin readonly 'quoted text'
+		echo local | --verbose -eu /usr/bin echo test printf 2>/dev/null 'quoted text'
+awk local readonly && "$1" /usr/bin --verbose -eu local
+local test "$1" 'quoted text' echo printf $(pwd) then awk $(pwd) echo then &&
+		echo 'quoted text' awk done ${HOME} "$1" -eu then -eu "$@" | awk export then
+		cd awk sed "$@" grep readonly
+		--verbose "$1" && grep cd readonly && "$@" readonly ${HOME} local
+		"$1" cd "$@" readonly && x=1 export 'quoted text' x=1 "$@" awk
+		readonly "$@" && echo | && | 2>/dev/null
+		cd --verbose x=1 2>/dev/null test sed | "$@" x=1 printf 2>/dev/null ${HOME}
+done readonly "$@" echo "$1" cd 2>/dev/null
+		${HOME} /usr/bin && "$1" "$@" grep
+cd | "$@" readonly echo printf -eu test | $(pwd) -eu done "$@" done
+	echo sed readonly --verbose test
+	'quoted text' 'quoted text' && "$1" export readonly done | printf cd "$@"
+| /usr/bin $(pwd) "$@" readonly echo -eu sed grep done "$@" printf
+		2>/dev/null --verbose printf readonly
+		sed readonly && cd ${HOME} "$@" 'quoted text'
+grep 'quoted text' ${HOME}
+		2>/dev/null ${HOME} cd ${HOME} x=1 then printf readonly
+awk && export "$1" 2>/dev/null done printf echo printf readonly test done
+		done 'quoted text' grep
+$(pwd) readonly "$@" local
+echo done /usr/bin grep x=1 2>/dev/null $(pwd) local x=1
+	grep grep sed $(pwd) echo export
+&& cd printf sed "$@" local test
+		export 2>/dev/null done
+${HOME} /usr/bin export "$1" export 'quoted text' /usr/bin "$@" cd local --verbose
+${HOME} local $(pwd) sed "$@"
+		awk echo cd test && ${HOME} 'quoted text' -eu
+	$(pwd) && "$1" x=1 /usr/bin sed --verbose
+		local ${HOME} local | --verbose
+	readonly $(pwd) "$@" done --verbose "$@" 2>/dev/null export local /usr/bin
+		sed echo 'quoted text' "$@" /usr/bin
+	done x=1 /usr/bin ${HOME} export cd
+export printf done local x=1 cd local $(pwd) /usr/bin local sed readonly --verbose
+		2>/dev/null && | grep "$1" cd /usr/bin /usr/bin "$@" sed && "$@"
+		done -eu cd ${HOME} -eu -eu local local
+${HOME} local local done awk x=1 readonly "$1" --verbose 'quoted text'
+${HOME} "$1" -eu sed readonly --verbose -eu awk --verbose "$@" "$@" -eu
+	"$1" test done echo ${HOME} x=1 awk done -eu grep &&
+	grep x=1 "$1" 2>/dev/null "$@" done then sed printf $(pwd)
+		sed 'quoted text' "$@" "$@" export && "$1" x=1 local
+		"$1" "$@" test sed local test
+echo sed printf "$1" | 2>/dev/null test
+		readonly 2>/dev/null grep 'quoted text' printf -eu awk && sed grep grep
+echo printf --verbose cd --verbose 2>/dev/null "$@" awk local
+		done $(pwd) --verbose "$@" $(pwd) export
+	2>/dev/null -eu /usr/bin export test
+	-eu $(pwd) --verbose local grep ${HOME} /usr/bin x=1 | test printf
+	-eu printf sed grep x=1 /usr/bin done -eu echo test -eu
+	awk export sed | /usr/bin done grep
+"$1" 'quoted text' local "$1" printf cd ${HOME} then &&
+	--verbose export 'quoted text' echo -eu printf grep
+		| /usr/bin readonly grep echo 'quoted text'
+'quoted text' -eu then done
+grep --verbose $(pwd) /usr/bin
+		/usr/bin then --verbose "$1" /usr/bin
+	$(pwd) test done "$@" awk x=1 test readonly local
+		| | "$@" printf printf grep ${HOME}
+x=1 "$@" done echo awk --verbose ${HOME} /usr/bin readonly
+'quoted text' printf 2>/dev/null
+2>/dev/null /usr/bin --verbose /usr/bin $(pwd) "$1" local -eu
+		"$1" x=1 cd awk 2>/dev/null
+done export cd echo awk test done awk
+then && "$@" printf ${HOME} /usr/bin readonly $(pwd)
+	printf "$1" $(pwd) -eu ${HOME} cd local sed echo "$1"
+	awk 2>/dev/null sed printf printf cd
+	local x=1 awk export sed x=1 then test cd -eu grep printf x=1 sed readonly
+	done grep && $(pwd) "$1" readonly export | sed cd sed --verbose x=1 printf cd
+	printf done x=1 && -eu awk export sed export && grep sed /usr/bin
+		${HOME} awk echo "$@" x=1 grep local
+		grep 2>/dev/null "$@" done printf done x=1 printf $(pwd)
+--verbose --verbose sed printf
+	'quoted text' cd awk $(pwd) $(pwd) then
+	$(pwd) test printf 'quoted text' | 'quoted text' "$1" | 2>/dev/null
+	x=1 && sed then 2>/dev/null ${HOME} test
+		local then readonly /usr/bin grep readonly -eu $(pwd) /usr/bin grep
+		/usr/bin local then sed $(pwd) 2>/dev/null export /usr/bin
+x=1 'quoted text' local grep then -eu sed readonly | awk printf echo ${HOME} --verbose
+awk test ${HOME} x=1 'quoted text' sed grep awk
+	echo export cd 2>/dev/null
+2>/dev/null test /usr/bin export --verbose && test export "$1" 2>/dev/null
+"$1" 2>/dev/null "$@" && export -eu -eu test cd readonly test
+done then echo ${HOME} test
+	&& echo readonly --verbose 2>/dev/null test -eu test awk printf /usr/bin ${HOME}
+&& x=1 then sed -eu awk 'quoted text'
+cd echo export && -eu sed -eu grep cd awk ${HOME}
+local printf readonly
+		| ${HOME} --verbose grep grep
+	/usr/bin sed --verbose sed local
+	--verbose "$@" readonly 'quoted text' readonly -eu 2>/dev/null -eu "$1"
+	local 2>/dev/null done sed /usr/bin 2>/dev/null
+	--verbose export echo cd cd printf $(pwd) ${HOME} "$@" test x=1
+	sed x=1 done -eu export "$@" ${HOME} --verbose then x=1 2>/dev/null local |
+		sed /usr/bin 2>/dev/null ${HOME} 2>/dev/null /usr/bin 2>/dev/null 2>/dev/null
+		echo "$@" awk grep readonly "$@" $(pwd) "$1" "$@" 'quoted text'
+test done echo --verbose --verbose
+		done echo && local local awk grep then "$1"
+	$(pwd) export && done sed 2>/dev/null x=1 'quoted text' echo test
+	echo 2>/dev/null 2>/dev/null done echo && test && readonly
+		${HOME} local cd ${HOME} export export sed test test sed sed x=1
+		sed --verbose export export export
+		grep export $(pwd) "$@" 2>/dev/null echo local /usr/bin /usr/bin --verbose
+-eu sed sed then "$@" sed readonly
+	'quoted text' local x=1 then test --verbose echo "$@" done test
+	cd test ${HOME} done "$@" | done -eu readonly &&
+| --verbose && | done "$1" /usr/bin readonly
+		-eu printf sed cd 'quoted text' then printf -eu readonly printf sed $(pwd)
+	done 'quoted text' then awk -eu --verbose readonly "$1"
+		${HOME} ${HOME} 'quoted text'
+		--verbose readonly test
+	x=1 readonly local 'quoted text' /usr/bin
+		2>/dev/null awk && --verbose x=1 cd ${HOME} | echo
+printf $(pwd) | 2>/dev/null 2>/dev/null sed $(pwd) grep test
+local 'quoted text' readonly then "$@" 2>/dev/null "$1" local x=1
+x=1 | "$1" "$@" /usr/bin | printf local
+		grep grep awk /usr/bin awk -eu 'quoted text' /usr/bin 2>/dev/null done
+	cd cd --verbose test 'quoted text' then export local --verbose local ${HOME}
+	done x=1 then cd echo ${HOME} export sed test /usr/bin
+2>/dev/null awk done "$@" echo --verbose x=1 awk "$1" export "$@"
+		readonly test export sed sed "$@"
+		"$@" "$@" cd done "$@" "$1" done done x=1 'quoted text' ${HOME} &&
+		then test readonly printf --verbose $(pwd) test printf ${HOME}
+${HOME} $(pwd) x=1 -eu "$1" local | test /usr/bin
+/usr/bin $(pwd) 'quoted text' sed
+cd echo sed printf local test export sed done --verbose -eu then $(pwd)
+	done local "$1" 'quoted text'
+--verbose export "$@" "$1" grep grep --verbose
+	done done done echo x=1 "$1"
+sed echo 'quoted text' 2>/dev/null printf --verbose awk grep 2>/dev/null
+		test 'quoted text' x=1 test cd -eu | done done printf /usr/bin
+test x=1 ${HOME} /usr/bin -eu test printf
+		awk then "$1" sed sed 'quoted text' 'quoted text' x=1 cd
+		cd 2>/dev/null echo echo /usr/bin sed sed 2>/dev/null 'quoted text' $(pwd) 'quoted text'
+done readonly sed readonly grep | grep $(pwd) ${HOME} sed
+		done printf -eu -eu $(pwd)
+	/usr/bin /usr/bin /usr/bin readonly
+		sed && local export echo export 'quoted text' | x=1
+	--verbose 2>/dev/null grep
+		| local printf grep cd echo | -eu 2>/dev/null && x=1 readonly -eu grep | sed
+		cd awk ${HOME} then && grep x=1 then ${HOME} local &&
+"$@" local printf "$@" | done export && -eu grep x=1 $(pwd) export x=1 $(pwd) |
+		printf local --verbose
+	then test local local 'quoted text' $(pwd) echo awk x=1 sed
+	'quoted text' done "$1" -eu -eu export
+printf 2>/dev/null && ${HOME} export grep export 2>/dev/null readonly
+		"$1" /usr/bin echo 2>/dev/null "$@" test printf
+		/usr/bin then readonly export -eu then ${HOME} && 'quoted text' done cd $(pwd)
+test | cd export printf "$@" then $(pwd)
+		| "$@" cd local $(pwd) echo readonly -eu test /usr/bin then 2>/dev/null
+| done done export --verbose sed then local then sed cd grep ${HOME}
+--verbose echo grep cd grep --verbose printf
+	sed --verbose cd readonly && -eu | export awk "$@" ${HOME} /usr/bin done
+	echo cd | 2>/dev/null sed /usr/bin cd "$@" local
+	export 2>/dev/null cd x=1 -eu export local && printf
+2>/dev/null ${HOME} 2>/dev/null awk then
+done && 'quoted text' "$1"
+"$1" "$1" awk export "$1" echo sed /usr/bin -eu then -eu test ${HOME} grep
+		/usr/bin echo grep && export test done done test printf
+	test then --verbose cd 2>/dev/null
+${HOME} --verbose awk cd grep echo local && grep local
+		echo 2>/dev/null x=1 echo 'quoted text' ${HOME} -eu $(pwd) local
+		&& awk echo 2>/dev/null then 'quoted text'
+	-eu -eu --verbose echo grep
+sed "$@" $(pwd) "$1" $(pwd) "$1"
+	"$@" "$@" sed x=1 2>/dev/null printf ${HOME} && grep --verbose test $(pwd)
+printf cd "$@" && grep printf cd x=1 printf && grep 2>/dev/null
+	echo 2>/dev/null 'quoted text' local --verbose $(pwd) "$1"
+	| done ${HOME} grep && sed ${HOME} awk export grep grep "$1" readonly 2>/dev/null
+		echo then "$1" grep 2>/dev/null
+		'quoted text' export done grep local -eu readonly 2>/dev/null /usr/bin "$@" -eu
+	done grep $(pwd) $(pwd) printf then "$@" /usr/bin ${HOME}
+		export grep export "$1"
+-eu export 'quoted text' x=1 ${HOME}
+		done "$1" done 'quoted text' done "$@" 'quoted text'
+	done -eu x=1 && --verbose done $(pwd) local | ${HOME} test then && grep
+		x=1 echo printf ${HOME} x=1 -eu && readonly $(pwd) then | done 'quoted text' --verbose
+		-eu then local 'quoted text' echo x=1 done cd -eu x=1 printf awk |
+--verbose export ${HOME} echo local done then "$1" | done then
+		-eu $(pwd) ${HOME} echo done /usr/bin test
+	&& -eu local sed echo "$@" export x=1 awk && $(pwd) "$1" "$@" printf
+${HOME} x=1 "$1" local $(pwd) 2>/dev/null /usr/bin | 'quoted text' done ${HOME}
+		done | -eu export done -eu "$@" | test echo
+		--verbose local 'quoted text' x=1 "$@" local 2>/dev/null cd 'quoted text'
+	test $(pwd) echo readonly export 2>/dev/null 'quoted text' | echo awk 'quoted text'
+	awk ${HOME} done done | done ${HOME} export export 2>/dev/null | "$@"
+| echo x=1 /usr/bin &&
+		"$1" | export cd cd "$@" then 2>/dev/null export
+	local x=1 2>/dev/null "$@" | done echo && readonly -eu $(pwd)
+		export "$1" | 2>/dev/null x=1
+	2>/dev/null $(pwd) | | awk cd
+	then 2>/dev/null | then 2>/dev/null
+		'quoted text' && export /usr/bin
+	readonly grep sed printf
+		sed echo | local -eu printf grep
+done export awk local test cd "$1" "$@" | x=1 "$1" awk then
+	printf test echo sed "$1" echo export x=1 $(pwd) export "$@" readonly
+	then awk cd printf test sed | awk sed
+&& "$@" -eu x=1 grep echo "$@" /usr/bin "$@" echo echo sed x=1 --verbose
+		cd "$1" "$1" && 'quoted text'
+printf 2>/dev/null readonly then "$1" 2>/dev/null -eu local | "$1" cd "$@" readonly
+	export -eu "$1" awk echo cd printf
+		"$@" 'quoted text' 'quoted text' then awk 2>/dev/null
+		cd /usr/bin sed done && $(pwd) && sed echo --verbose
+		export echo readonly 'quoted text' export 2>/dev/null ${HOME} 'quoted text'
+| local test --verbose sed "$@" "$1" $(pwd) -eu 'quoted text' cd "$1" 'quoted text'
+		test ${HOME} 2>/dev/null test echo && done x=1 test grep -eu readonly
+	readonly --verbose then then test -eu readonly ${HOME} test |
+		&& then 2>/dev/null "$@" awk && $(pwd) | -eu printf /usr/bin printf export
+"$@" 2>/dev/null grep "$@"
+	sed ${HOME} cd sed /usr/bin local awk export
+		test printf cd | local 2>/dev/null
+	export ${HOME} -eu ${HOME}
+		$(pwd) | test printf "$1"
+"$@" -eu x=1 then ${HOME} ${HOME} && 'quoted text' printf
+--verbose test awk echo readonly 'quoted text' "$1" ${HOME} && "$@"
+	export local "$1" export | awk "$1" $(pwd) sed && x=1 export x=1
+	${HOME} echo | test "$1" -eu | -eu x=1 local 'quoted text' then grep then grep
+"$1" --verbose | ${HOME} | sed "$1" 2>/dev/null readonly echo ${HOME}
+echo x=1 test $(pwd) -eu
+	2>/dev/null sed x=1 $(pwd) export test grep && export then /usr/bin awk
+grep x=1 grep test export
+then cd --verbose 2>/dev/null local ${HOME} export
+	printf readonly /usr/bin 2>/dev/null done readonly then "$@" $(pwd)
+		"$@" -eu $(pwd) printf done ${HOME}
+		done --verbose printf
+		awk | then "$1" test readonly "$1" cd then "$1" --verbose
+	'quoted text' test sed local
+		then grep awk -eu ${HOME} grep "$@" awk then
+'quoted text' cd readonly
+grep grep 2>/dev/null grep done /usr/bin local x=1 export local
+	then local --verbose
+grep /usr/bin $(pwd) 2>/dev/null -eu
+	$(pwd) | -eu printf --verbose "$@" export then x=1 sed local
+	printf readonly local printf printf && echo 'quoted text'
+	grep grep grep | export test printf readonly test -eu ${HOME} | test
+		sed $(pwd) 'quoted text' /usr/bin "$@" readonly local
+		--verbose printf "$@" "$@" && test /usr/bin
+--verbose sed then done ${HOME}
+		awk readonly $(pwd) ${HOME} ${HOME} $(pwd)
+echo grep ${HOME} "$1" sed test grep cd readonly $(pwd) done grep
+	"$1" --verbose awk readonly -eu
+readonly --verbose echo -eu -eu $(pwd) | sed readonly
+done && then grep cd awk echo | local 2>/dev/null printf
+${HOME} done awk echo test
+		printf && grep /usr/bin local 'quoted text' export 'quoted text'
+	export printf local awk
+	&& echo grep "$@" done done "$1" 'quoted text' local test then echo $(pwd)
+	2>/dev/null "$1" ${HOME} /usr/bin "$@"
+	-eu printf && | && 'quoted text' awk
+		${HOME} "$1" | then "$@" readonly sed && awk /usr/bin | | echo awk && 2>/dev/null
+		$(pwd) ${HOME} printf | "$1" -eu then x=1
+${HOME} && printf && $(pwd) --verbose readonly local
+	echo then local "$1" echo /usr/bin | -eu 2>/dev/null "$@" --verbose test export
+sed -eu readonly 2>/dev/null printf "$1" done done
+	awk "$@" "$1" local "$@" readonly -eu 'quoted text' sed readonly
+	printf sed && sed /usr/bin && awk "$@" | /usr/bin ${HOME}
+		2>/dev/null "$@" 'quoted text' printf readonly grep local local echo awk
+	awk export -eu $(pwd) local x=1 $(pwd) cd sed 'quoted text' awk grep
+	| x=1 $(pwd) 'quoted text' done ${HOME} /usr/bin
+		test 'quoted text' then
+	printf | sed sed $(pwd) | done printf done x=1 readonly
+		${HOME} | $(pwd) 'quoted text'
+${HOME} --verbose grep $(pwd) 2>/dev/null | | echo ${HOME} export --verbose
+/usr/bin "$1" export export "$@" echo export sed 2>/dev/null -eu
+done done cd | awk done
+		--verbose -eu test "$@" "$1" awk "$@" sed awk grep cd -eu && test -eu -eu "$1"
+	test "$@" "$@" done -eu 2>/dev/null export && done 'quoted text'
+${HOME} | export grep --verbose sed awk grep $(pwd) export --verbose export ${HOME}
+		done $(pwd) cd echo "$1" | echo awk --verbose done readonly
+		--verbose awk && then --verbose
+test -eu test 2>/dev/null && 'quoted text' && x=1
+		test cd grep export -eu
+x=1 "$@" export echo local done test test "$@"
+		then then && "$@" --verbose ${HOME} ${HOME} printf test printf /usr/bin echo test
+		cd readonly cd sed grep 2>/dev/null 2>/dev/null
+		| then --verbose "$@" export "$1" awk export $(pwd)
+		/usr/bin export readonly --verbose /usr/bin printf export
+'quoted text' local 2>/dev/null | printf printf cd readonly export "$1" export
+	readonly test printf | ${HOME} $(pwd) awk && 2>/dev/null
+	echo echo printf then "$@" /usr/bin readonly --verbose printf
+sed cd then cd printf awk /usr/bin readonly echo ${HOME} printf /usr/bin
+		awk $(pwd) done readonly grep
+	/usr/bin sed done echo $(pwd) then -eu awk $(pwd) then 2>/dev/null "$1" x=1 sed
+		local echo $(pwd) local readonly 'quoted text'
+		grep --verbose --verbose then 2>/dev/null
+		"$1" sed $(pwd) $(pwd) && $(pwd) done | test done
+test && 'quoted text' ${HOME} 2>/dev/null local sed awk ${HOME} export
+	$(pwd) test then sed awk grep $(pwd) sed x=1 export test 2>/dev/null ${HOME} awk
+		echo && readonly echo --verbose 'quoted text' awk 'quoted text' cd sed
+echo -eu 'quoted text' echo readonly
+done local grep 'quoted text' test -eu
+		grep $(pwd) awk test sed echo ${HOME}
+	"$@" ${HOME} local sed --verbose done cd cd "$@" done
+		export -eu cd 2>/dev/null test done "$@" local echo 'quoted text'
+		"$@" grep done 'quoted text' sed
+| /usr/bin --verbose --verbose
+		sed readonly ${HOME} test readonly | x=1 sed
+&& then grep && export --verbose $(pwd) && echo readonly
+		readonly ${HOME} "$1" $(pwd)
+$(pwd) cd /usr/bin cd export local x=1 readonly sed $(pwd)
+		/usr/bin test cd $(pwd) "$1" $(pwd) echo done 2>/dev/null "$@" && "$@" awk
+local local "$1" local cd cd export done x=1 readonly sed printf
+	&& readonly && "$1" test
+		test -eu /usr/bin /usr/bin then test
+		${HOME} "$@" sed cd done "$1" export readonly local && awk grep $(pwd) /usr/bin
+		readonly echo done -eu x=1 cd grep echo awk "$1" 2>/dev/null
+echo done sed echo 'quoted text' readonly && $(pwd) echo done && ${HOME} local
+	'quoted text' "$@" | cd "$@" -eu -eu cd /usr/bin echo 2>/dev/null 2>/dev/null
+export sed "$@" then | --verbose "$1" "$1" awk test grep
+		${HOME} printf ${HOME} grep -eu 2>/dev/null
+readonly ${HOME} -eu "$@" && then sed printf readonly local "$1"
+cd "$@" ${HOME} readonly then cd local local printf | "$1" "$1"
+export sed && 2>/dev/null echo "$1" grep | -eu export
+	echo -eu readonly | grep cd cd then echo 'quoted text' local "$1" /usr/bin "$1"
+		export $(pwd) "$1" 'quoted text' then && grep printf /usr/bin
+grep printf 'quoted text' sed done echo awk cd ${HOME}
+	"$1" x=1 'quoted text' && ${HOME} && test export /usr/bin 'quoted text'
+	local cd local "$1" 2>/dev/null | x=1 ${HOME} done readonly readonly 2>/dev/null
+		export sed /usr/bin echo | readonly
+	2>/dev/null 2>/dev/null "$@"
+		echo cd "$@" 'quoted text' | test 2>/dev/null grep
+$(pwd) sed "$@" export done x=1 test export "$1" awk -eu local -eu $(pwd)
+		${HOME} cd 'quoted text' echo grep | x=1 'quoted text' printf 'quoted text' awk
+	x=1 -eu sed ${HOME} 'quoted text' /usr/bin
+test && "$1" export | local "$@" && 2>/dev/null printf then then sed
+		--verbose "$1" 2>/dev/null printf
+	| done 'quoted text' "$@" && "$@" -eu $(pwd) 2>/dev/null
+	x=1 export then grep "$1" $(pwd) x=1 printf echo
+local "$@" done printf done
+	${HOME} test "$1" readonly sed test x=1 | done
+		awk grep printf grep
+grep grep | $(pwd) "$1" echo printf readonly ${HOME} cd
+readonly test | sed grep done --verbose 'quoted text' echo readonly
+x=1 x=1 done awk /usr/bin /usr/bin
+		| -eu $(pwd) awk /usr/bin printf echo -eu
+		'quoted text' done readonly done "$@" && && test export cd echo echo export $(pwd)
+-eu 2>/dev/null x=1 awk "$1" | grep
+		echo 2>/dev/null | x=1 readonly export x=1 done
+echo printf export then -eu 'quoted text' done echo $(pwd) -eu x=1 && done then
+		printf cd echo /usr/bin then ${HOME} readonly 'quoted text'
+		local then | echo /usr/bin done sed -eu x=1 /usr/bin
+export x=1 --verbose "$@" "$@" && --verbose 2>/dev/null
+test sed awk export cd awk local local then $(pwd) printf $(pwd)
+x=1 cd "$@" export /usr/bin readonly grep | 2>/dev/null
+		echo grep printf 2>/dev/null 2>/dev/null && done printf cd "$1" 'quoted text'
+		then readonly done local printf done local export done readonly
+export readonly /usr/bin -eu done local && "$@" 'quoted text' 'quoted text'
+readonly test local 'quoted text' ${HOME} "$@" test 'quoted text' 2>/dev/null
+'quoted text' 2>/dev/null test test && | ${HOME} awk printf && $(pwd) --verbose
+export "$1" cd 2>/dev/null && awk readonly
+${HOME} ${HOME} "$@" --verbose "$1" "$1" export printf 2>/dev/null export
+	printf 2>/dev/null grep -eu local sed awk --verbose printf && x=1 awk sed export
+/usr/bin readonly echo echo echo test test --verbose
+		echo readonly local done local $(pwd) then "$@" | $(pwd) grep local 2>/dev/null
+	grep ${HOME} "$@" grep awk && readonly 'quoted text' test
+		echo "$1" local "$@" "$1" done ${HOME}
+		printf x=1 cd grep $(pwd) $(pwd) 'quoted text'
+	test test done ${HOME} 'quoted text' $(pwd) && grep "$1" $(pwd)
+x=1 'quoted text' echo 'quoted text' then then grep && $(pwd) 'quoted text' awk
+		'quoted text' echo | --verbose "$1" /usr/bin printf | ${HOME}
+		sed sed local $(pwd) "$@" && "$@" ${HOME} "$@" | | then sed
+		'quoted text' test then printf export $(pwd) local "$1" test
+		"$@" cd cd test "$1" export done "$1" local $(pwd) export grep grep printf
+&& grep ${HOME} x=1 -eu export echo 2>/dev/null
+&& x=1 && "$1" done && | $(pwd) --verbose -eu done readonly sed $(pwd) $(pwd)
+awk cd readonly done export | export 'quoted text' 2>/dev/null x=1 && cd "$1"
+	"$1" sed then cd test "$1" 2>/dev/null
+		test cd "$@" x=1 awk 'quoted text' readonly ${HOME} --verbose 'quoted text'
+$(pwd) "$@" printf /usr/bin
+sed grep printf -eu awk "$@" grep x=1
+	--verbose && grep done -eu "$1" echo readonly "$@" echo
+--verbose ${HOME} && "$@" printf then | $(pwd) readonly
+| cd done -eu "$@" | echo $(pwd) 'quoted text' local readonly | $(pwd) sed x=1
+sed readonly printf grep /usr/bin x=1 "$1" 2>/dev/null ${HOME} echo -eu x=1
+		export $(pwd) -eu readonly printf export
+		'quoted text' ${HOME} test x=1 -eu readonly
+	2>/dev/null sed cd --verbose cd 2>/dev/null
+	awk 'quoted text' sed ${HOME} test done cd test | local 2>/dev/null
+		| echo echo 'quoted text' then readonly echo cd -eu 2>/dev/null
+awk -eu ${HOME} test "$1" -eu -eu "$1"
+/usr/bin then awk /usr/bin $(pwd) "$@" sed awk $(pwd) done "$@"
+	--verbose $(pwd) x=1 -eu sed "$1" x=1 /usr/bin x=1 readonly
+cd "$@" test local ${HOME} /usr/bin local 2>/dev/null sed
+printf && printf x=1 &&
+		-eu $(pwd) done awk && "$1" 2>/dev/null readonly ${HOME} x=1 'quoted text'
+		&& then readonly echo /usr/bin ${HOME} local "$@" echo
+		&& local awk grep grep printf 2>/dev/null
+/usr/bin echo cd then grep $(pwd)
+	"$@" readonly x=1 x=1 echo "$@" sed
+"$@" echo test then 2>/dev/null 2>/dev/null awk grep done 'quoted text'
+	'quoted text' | readonly local
+		sed then echo 2>/dev/null done "$1" "$1" readonly -eu awk then -eu echo 2>/dev/null
+		export awk grep | 2>/dev/null printf local
+		/usr/bin "$@" test | echo ${HOME} -eu done readonly
+		grep cd test grep local $(pwd) "$@" "$@" 'quoted text' "$@"
+		done local readonly /usr/bin
+	"$1" /usr/bin x=1 --verbose && awk export 'quoted text'
+sed "$1" 'quoted text' sed
+x=1 ${HOME} local echo -eu -eu "$@" then test test $(pwd) ${HOME}
+x=1 readonly done grep ${HOME}
+--verbose grep grep 2>/dev/null | readonly 'quoted text'
+	done | | printf "$@" local grep && export 'quoted text' $(pwd) awk
+awk printf /usr/bin export 2>/dev/null
+then --verbose -eu printf
+		--verbose -eu grep -eu local | echo "$@" ${HOME}
+export cd export grep 2>/dev/null export 2>/dev/null
+export && awk grep --verbose awk $(pwd) echo sed test x=1 && $(pwd)
+| sed test -eu $(pwd) readonly 2>/dev/null && 2>/dev/null
+		&& "$@" $(pwd) /usr/bin readonly &&
+		"$@" "$@" $(pwd) "$@" done /usr/bin printf then /usr/bin
+grep export test $(pwd) cd x=1 --verbose export x=1 x=1 test awk
+awk /usr/bin ${HOME} done x=1 --verbose readonly readonly done -eu done x=1 -eu
+	printf "$1" "$1" $(pwd) 'quoted text' && /usr/bin
+	sed --verbose --verbose 2>/dev/null
+		export x=1 awk "$@" cd "$1" echo --verbose
+	"$1" 'quoted text' sed then awk
+		${HOME} && ${HOME} -eu export 'quoted text'
+sed grep sed cd -eu echo 'quoted text' "$@" local "$@" 'quoted text'
+	--verbose local && $(pwd) test --verbose "$@" "$@" echo /usr/bin | "$@" $(pwd) grep
+	$(pwd) "$@" 2>/dev/null grep readonly x=1 cd x=1 "$@" cd
+		x=1 2>/dev/null 'quoted text' done -eu test cd ${HOME} --verbose
+then && "$1" /usr/bin sed export && sed done sed test "$1" sed $(pwd)
+| then echo done x=1 ${HOME} "$1" export grep grep
+export "$@" 2>/dev/null x=1 export readonly export awk cd -eu
+		printf --verbose printf export local | local done local | && -eu x=1 then printf
+	$(pwd) $(pwd) echo -eu --verbose
+	2>/dev/null "$@" sed && grep "$@" --verbose
+		"$1" awk "$@" -eu test "$1" cd test local /usr/bin done cd ${HOME}
+		readonly ${HOME} export local &&
+		sed local $(pwd) local done
+	printf 'quoted text' "$@" echo echo
+${HOME} then then --verbose
+	--verbose -eu readonly printf 2>/dev/null printf printf
+	echo echo 'quoted text' /usr/bin
+	-eu --verbose -eu /usr/bin --verbose awk cd && -eu -eu /usr/bin export 2>/dev/null
+-eu export ${HOME} | "$1" "$@" 'quoted text' $(pwd)
+	&& then -eu readonly /usr/bin local --verbose awk x=1 export $(pwd) "$1"
+/usr/bin sed $(pwd) grep echo ${HOME} ${HOME} grep printf grep sed done
+	-eu --verbose && | ${HOME} export | $(pwd) && $(pwd) cd
+-eu cd printf $(pwd) cd "$@" sed readonly grep 'quoted text'
+		echo "$@" $(pwd) grep "$@"
+/usr/bin echo cd local local echo ${HOME} | printf cd "$@" /usr/bin awk
+	$(pwd) done awk printf done && | 2>/dev/null local local local 'quoted text'
+x=1 'quoted text' cd awk $(pwd) printf "$1"
+$(pwd) 'quoted text' && | ${HOME} -eu local echo 'quoted text' && ${HOME}
+local export x=1 x=1 "$@" then export -eu then "$1" grep export
+		test local 'quoted text' ${HOME} then --verbose
+local | export /usr/bin "$@" printf export echo 'quoted text' -eu && readonly
+done "$@" ${HOME} $(pwd) grep cd /usr/bin export printf local test ${HOME} cd x=1
+		printf | -eu 2>/dev/null /usr/bin "$1" "$@" 'quoted text'
+	'quoted text' done readonly
+&& 'quoted text' grep && awk sed awk then readonly echo $(pwd) test x=1 export
+		local awk x=1 done ${HOME} local /usr/bin readonly readonly --verbose test 'quoted text'
+		awk /usr/bin then | test | | cd && "$@"
+	test -eu awk 2>/dev/null x=1 export &&
+readonly sed then grep | "$@"
+		test 'quoted text' 2>/dev/null 'quoted text'
+		local sed done then grep local 'quoted text'
+		$(pwd) test "$@" printf
+grep sed readonly "$1" done printf printf -eu | local --verbose printf local
+	grep readonly sed 2>/dev/null /usr/bin awk grep awk cd $(pwd)
+done local && --verbose
+	/usr/bin 'quoted text' test x=1 then then
+		done 2>/dev/null --verbose "$@" "$1" export ${HOME} && local readonly
+local -eu x=1 "$1" -eu $(pwd) local "$@" grep ${HOME} export && $(pwd) /usr/bin
+awk "$@" --verbose then
+sed x=1 ${HOME} local test readonly 'quoted text' && grep echo && $(pwd)
+"$1" printf printf /usr/bin cd grep printf 'quoted text' readonly --verbose
+'quoted text' 2>/dev/null echo done
+echo done "$1" | then grep cd | | "$@"
+	2>/dev/null done "$1" "$1" --verbose 2>/dev/null "$1" "$@" --verbose cd
+awk printf echo done done printf cd sed
+		$(pwd) "$1" ${HOME} sed 'quoted text' echo "$@" printf local echo sed --verbose
+	local --verbose test /usr/bin export $(pwd)
+	/usr/bin 2>/dev/null test cd cd --verbose
+		--verbose done then awk done ${HOME} ${HOME} sed readonly done export readonly
+		readonly cd printf printf
+| test echo --verbose export test awk ${HOME} printf "$@" && | grep grep
+	-eu export ${HOME} 2>/dev/null ${HOME}
+		local ${HOME} | grep done
+		echo echo /usr/bin test cd $(pwd) then done $(pwd) then local printf
+		readonly export sed echo &&
+test local then done 'quoted text' sed /usr/bin cd "$@" 'quoted text'
+		| export $(pwd) $(pwd) printf
+		-eu readonly then then "$1"
+	--verbose $(pwd) test cd grep
+	readonly -eu then export "$@" test && done | then
+	then sed --verbose 'quoted text'
+		test -eu /usr/bin ${HOME} /usr/bin echo | "$1" then x=1 /usr/bin awk && cd $(pwd)
+		x=1 "$1" cd 2>/dev/null readonly awk -eu /usr/bin "$1" printf "$@" /usr/bin
+		export | 2>/dev/null test cd grep local ${HOME} x=1 ${HOME} then &&
+local && then cd -eu done $(pwd)
+		local echo cd test grep awk export then grep cd --verbose $(pwd) readonly
+	then export "$1" x=1 "$@"
+	cd readonly export awk 'quoted text' $(pwd) awk then 2>/dev/null
+	awk awk readonly x=1 done 2>/dev/null
+	awk "$@" export 2>/dev/null readonly printf done "$@" done test
+		'quoted text' -eu x=1 echo $(pwd) export /usr/bin sed sed
+		done sed ${HOME} export /usr/bin
+	echo ${HOME} cd ${HOME} test echo "$1" grep
+		awk done echo "$1" && grep $(pwd) local test "$@" export "$@" 'quoted text'
+		-eu export ${HOME} grep sed cd printf 2>/dev/null grep x=1 "$@" echo
+then printf && local --verbose /usr/bin printf
+	/usr/bin test -eu readonly 'quoted text'
+	sed grep && then awk awk && --verbose
+2>/dev/null ${HOME} sed && "$1"
+&& -eu then && grep "$1" export --verbose 2>/dev/null "$1"
+		${HOME} && ${HOME} cd 2>/dev/null -eu export grep test
+	2>/dev/null cd export sed
+	echo cd $(pwd) echo done -eu 2>/dev/null readonly export ${HOME} "$@"
+		${HOME} cd local grep "$1" test
+		| "$1" local /usr/bin "$1" sed done $(pwd)
+sed ${HOME} "$1" done 'quoted text' export "$1" "$@" echo "$@" $(pwd)
+"$1" then awk awk local sed "$@" "$1" "$@" echo test "$1" --verbose ${HOME}
+	cd local --verbose done cd 2>/dev/null ${HOME} "$1" export /usr/bin
+		--verbose echo "$@" 2>/dev/null
+	"$@" done /usr/bin $(pwd) awk cd && readonly readonly &&
+		"$@" x=1 echo /usr/bin
+done done ${HOME} readonly local test grep "$1"
+	test && echo "$@" | && && then "$@" && /usr/bin sed awk grep $(pwd)
+	echo sed awk awk grep export export cd
+	export ${HOME} "$1" readonly
+	/usr/bin $(pwd) readonly | test done && | 'quoted text'
+"$1" sed 2>/dev/null readonly ${HOME} export printf $(pwd) awk export printf
+	cd awk export /usr/bin /usr/bin
+2>/dev/null && && | printf /usr/bin /usr/bin awk then /usr/bin "$@" sed
+	grep --verbose 2>/dev/null grep 'quoted text' test 'quoted text' done
+	export echo x=1 ${HOME} sed /usr/bin
+&& readonly export | /usr/bin readonly
+	2>/dev/null done $(pwd) "$1" export -eu $(pwd) grep "$1" sed 'quoted text'
+	"$@" echo $(pwd) local grep 2>/dev/null /usr/bin "$1" done echo 2>/dev/null
+	&& sed 'quoted text' readonly "$@" "$@" x=1
+	sed test 'quoted text' $(pwd) echo cd | echo readonly $(pwd)
+	done 2>/dev/null done | cd x=1
+	grep x=1 -eu done "$@" $(pwd) sed "$1" && printf
+		awk local 'quoted text' | readonly local awk && awk 'quoted text'
+		--verbose "$@" x=1 echo awk
+	sed /usr/bin 'quoted text' | readonly "$@" printf done echo done
+	printf "$@" | ${HOME} x=1 'quoted text' readonly -eu x=1 | x=1 "$@" -eu then done
+sed test awk 'quoted text' done printf test
+		echo -eu ${HOME} $(pwd) sed grep ${HOME} printf
+		cd cd "$1" "$@" && cd done -eu ${HOME}
+	"$@" | 2>/dev/null test 2>/dev/null "$@" done
+'quoted text' /usr/bin export readonly readonly
+		| && grep test grep x=1 && readonly done done ${HOME} export ${HOME}
+	-eu printf done awk done ${HOME}
+		--verbose | awk grep --verbose x=1 && local echo then
+		"$@" ${HOME} grep printf -eu "$@" 2>/dev/null x=1 && 2>/dev/null | /usr/bin
+then | readonly "$@" && | $(pwd) printf x=1 'quoted text'
+$(pwd) printf 'quoted text' readonly
+	x=1 && $(pwd) ${HOME} --verbose && ${HOME} export sed ${HOME} echo
+done "$1" -eu then "$@" &&
+/usr/bin sed "$@" && "$1" $(pwd) $(pwd) /usr/bin && x=1 "$1" local 2>/dev/null
+"$@" | 'quoted text' then -eu test --verbose ${HOME} echo
+		--verbose test echo sed $(pwd) printf /usr/bin test
+	| then cd cd echo local readonly grep
+grep done ${HOME} printf ${HOME} awk && --verbose local
+&& x=1 2>/dev/null /usr/bin then printf && test then $(pwd) "$1" ${HOME}
+	${HOME} cd "$@" export awk "$1" 'quoted text'
+	-eu --verbose done export echo -eu cd
+	&& then test 'quoted text' --verbose && printf x=1 2>/dev/null
+		cd 2>/dev/null printf | |
+		x=1 "$@" printf grep done "$@" x=1 2>/dev/null
+echo then -eu && "$@" grep | printf "$@"
+		/usr/bin done printf "$1" x=1 then echo echo export then | 2>/dev/null
+	grep export export 2>/dev/null printf grep test printf
+sed && ${HOME} local -eu ${HOME} export local 2>/dev/null then 2>/dev/null
+"$1" -eu cd 2>/dev/null readonly -eu echo test -eu 2>/dev/null ${HOME} && --verbose
+"$@" x=1 -eu "$@" then export printf local "$@" test then
+		cd cd printf 2>/dev/null 2>/dev/null then -eu local test local "$1" ${HOME}
+		sed --verbose | /usr/bin local ${HOME}
+	export readonly readonly ${HOME} 'quoted text'
+export then done awk printf 2>/dev/null sed local sed && && readonly cd
+		echo export sed export echo 'quoted text' ${HOME} ${HOME}
+		/usr/bin "$@" ${HOME} awk awk awk awk sed "$@" done |
+${HOME} local --verbose sed echo awk local $(pwd)
+	x=1 $(pwd) "$1" echo local x=1 | sed done /usr/bin /usr/bin
+	sed | --verbose echo --verbose --verbose
+	/usr/bin /usr/bin --verbose export grep $(pwd)
+	test | | "$1" awk x=1
+		2>/dev/null $(pwd) echo "$@" echo $(pwd) --verbose test "$@"
+	cd cd printf export local 'quoted text' sed 2>/dev/null
+cd sed x=1 /usr/bin test | then
+		2>/dev/null grep done "$1"
+		$(pwd) "$1" then echo -eu awk printf done
+	"$1" x=1 2>/dev/null awk -eu cd $(pwd)
+		readonly $(pwd) local sed awk cd done $(pwd) printf $(pwd) export
+	'quoted text' export export "$1" awk x=1 | echo /usr/bin "$1" printf cd done awk
+		grep readonly grep then local "$1" cd printf export test
+		export x=1 export 2>/dev/null
+then && awk cd "$@" | local cd readonly then readonly sed
+	--verbose done grep then --verbose
+	'quoted text' sed 'quoted text' "$1" --verbose test printf /usr/bin
+| readonly awk $(pwd) then test awk -eu grep printf | printf readonly
+	test sed sed "$@" test 'quoted text'
+		sed -eu 'quoted text' awk done && ${HOME} then "$@" export ${HOME} && grep export
+	local && local "$1" -eu printf && done $(pwd) then
+		test grep && "$@" 'quoted text' |
+export x=1 test awk 'quoted text'
+cd readonly "$@" grep "$1" "$@" export
+		&& printf 2>/dev/null /usr/bin x=1 && awk
+-eu "$@" export $(pwd)
+readonly printf "$@" done 'quoted text' x=1 grep 2>/dev/null done awk
+		printf /usr/bin 2>/dev/null awk $(pwd) export local
+		grep echo 2>/dev/null awk -eu printf
+		export x=1 ${HOME} | 'quoted text' local
+${HOME} "$1" -eu | && awk ${HOME} then 'quoted text' | export -eu echo --verbose
+	--verbose 2>/dev/null ${HOME} 2>/dev/null /usr/bin export --verbose printf
+	/usr/bin /usr/bin local --verbose printf 'quoted text'
+	2>/dev/null local sed | | cd -eu awk $(pwd)
+test export --verbose "$@" "$1"
+	/usr/bin /usr/bin local grep 'quoted text' x=1
+	local /usr/bin test cd local
+		2>/dev/null x=1 && "$1" &&
+		| awk test printf echo -eu echo && cd awk
+		$(pwd) -eu ${HOME} "$1" && x=1 | then done && ${HOME} "$1" ${HOME} 2>/dev/null
+	export cd | x=1 readonly export --verbose export test x=1 "$1"
+	"$1" test 2>/dev/null test cd local "$1" cd --verbose
+| 'quoted text' 'quoted text' 'quoted text' done && --verbose
+-eu test cd cd | done then "$@" | sed
+"$1" grep done && cd echo 'quoted text' sed 'quoted text' 'quoted text' done
+		done sed echo --verbose printf local
+export x=1 "$1" ${HOME} | -eu done x=1
+| x=1 "$@" done readonly /usr/bin 'quoted text' done
+	grep cd export export readonly | /usr/bin printf export 'quoted text' done echo
+'quoted text' test grep
+	sed /usr/bin ${HOME} x=1 local | 'quoted text'
+	'quoted text' grep export done readonly grep "$@" --verbose
+local awk 2>/dev/null /usr/bin /usr/bin
+then export ${HOME} sed -eu 'quoted text' awk 'quoted text' test | export echo echo
+	"$@" | printf && then | "$@" printf
+	printf echo -eu && done export grep 2>/dev/null -eu | awk "$1"
+		2>/dev/null awk $(pwd) done done readonly grep -eu ${HOME} ${HOME} readonly
+$(pwd) echo | done /usr/bin
+awk local cd printf sed
+	x=1 sed --verbose done grep done export then "$@"
+		cd ${HOME} 2>/dev/null | "$@"
+awk grep ${HOME} echo export "$@"
+	$(pwd) printf grep export cd test "$1" "$@" ${HOME}
+		printf -eu ${HOME} local $(pwd) 2>/dev/null $(pwd) readonly grep awk x=1 -eu echo
+		x=1 "$1" cd done printf ${HOME} 'quoted text'
+	"$1" then $(pwd) printf export 'quoted text' ${HOME}
+	done done awk "$1" -eu then then "$@" "$@" /usr/bin
+	| sed "$@" /usr/bin | cd "$@" printf 'quoted text' | readonly 'quoted text' grep
+echo done | ${HOME} grep ${HOME} done 'quoted text'
+		local printf ${HOME} cd export grep 2>/dev/null awk 'quoted text' cd printf sed
+	| done export 2>/dev/null echo ${HOME}
+	$(pwd) $(pwd) x=1 /usr/bin printf grep x=1 readonly
+		done $(pwd) --verbose && 'quoted text' /usr/bin --verbose
+		2>/dev/null "$@" printf test
+"$@" awk "$@" awk echo "$1" echo 'quoted text'
+	$(pwd) -eu --verbose ${HOME} $(pwd)
+	grep /usr/bin done "$1" echo readonly 2>/dev/null
+		| then then readonly printf 2>/dev/null done $(pwd) export --verbose | && done
+	${HOME} /usr/bin $(pwd) printf "$1" 2>/dev/null --verbose -eu | awk 2>/dev/null
+	| test 2>/dev/null && 2>/dev/null
+		local && printf printf then done --verbose 'quoted text'
+$(pwd) readonly test "$1" ${HOME} cd --verbose export cd
+/usr/bin export then echo x=1 --verbose sed then "$@" | --verbose export done
+then 2>/dev/null printf then "$@" 'quoted text' sed --verbose -eu grep cd
+"$@" x=1 | cd done "$@" /usr/bin
+		sed "$1" done cd 'quoted text' export $(pwd) printf sed grep sed | x=1
+		/usr/bin x=1 -eu "$@" then then ${HOME} awk cd "$@" readonly && $(pwd) x=1
+${HOME} done && done sed sed "$1"
+	"$@" "$1" x=1 'quoted text' 'quoted text' && grep grep
+	"$1" then then 'quoted text' done -eu x=1 $(pwd) local
+		cd echo $(pwd) | done x=1 $(pwd) echo -eu /usr/bin printf
+		-eu then && 2>/dev/null export x=1 cd ${HOME} test then then sed -eu
+		2>/dev/null "$@" sed sed -eu $(pwd) echo "$@" test x=1 local
+		&& x=1 test /usr/bin x=1 done --verbose sed sed /usr/bin done &&
+		export -eu grep 'quoted text' -eu export
+	2>/dev/null 'quoted text' awk printf sed local /usr/bin "$1" then /usr/bin
+then awk $(pwd) done | cd grep readonly done -eu export
+	sed grep ${HOME} done local 'quoted text'
+	cd "$@" sed --verbose cd 'quoted text' readonly /usr/bin
+		then done "$@" export x=1 cd 2>/dev/null "$1" -eu cd sed echo sed "$1"
+	'quoted text' then ${HOME} grep cd -eu $(pwd)
+		printf $(pwd) then done 2>/dev/null grep $(pwd) --verbose "$1" printf
+	--verbose echo awk | readonly sed /usr/bin echo done 2>/dev/null -eu /usr/bin
+	2>/dev/null grep test local 'quoted text'
+"$@" 'quoted text' ${HOME} grep echo test cd "$@" local then then 2>/dev/null
+	$(pwd) sed -eu then then
+awk "$@" local grep 2>/dev/null | "$1" readonly export $(pwd) echo
+		export local "$@" /usr/bin 2>/dev/null done export grep grep test "$@"
+	'quoted text' && --verbose
+		/usr/bin 2>/dev/null echo | awk -eu x=1
+		readonly done echo "$1" done | sed sed readonly awk awk sed x=1
+	&& && awk export done 'quoted text' 'quoted text' ${HOME} then -eu
+test cd ${HOME} test $(pwd)
+	-eu test $(pwd) "$1" | "$1" test then
+	"$1" sed --verbose awk test
+		test 'quoted text' $(pwd) export ${HOME} &&
+	&& grep sed -eu && "$1" -eu && "$1" sed then local
+	'quoted text' $(pwd) then $(pwd) "$@" test x=1 -eu ${HOME} && then
+x=1 awk printf $(pwd) ${HOME} ${HOME}
+		export ${HOME} "$1" grep
+		cd sed printf then /usr/bin -eu export sed | awk
+	'quoted text' /usr/bin test sed cd ${HOME} readonly 2>/dev/null /usr/bin ${HOME}
+--verbose $(pwd) local test
+| readonly | sed test -eu printf x=1 "$@" grep done
+		sed readonly test cd export
+		-eu x=1 $(pwd) ${HOME} 2>/dev/null "$1" $(pwd) local --verbose
+	local export --verbose | then then echo export
+	echo x=1 x=1 sed echo "$@" export "$1" grep x=1 | awk -eu
+		&& 2>/dev/null sed $(pwd)
+cd ${HOME} 2>/dev/null done ${HOME} awk 'quoted text' -eu grep
+		sed local echo | --verbose done
+		echo 'quoted text' 2>/dev/null test "$@" export
+&& awk export 'quoted text'
+	/usr/bin echo grep grep awk test
+		$(pwd) 'quoted text' grep sed readonly x=1 local /usr/bin 2>/dev/null 2>/dev/null
+		'quoted text' sed test done 'quoted text' -eu && grep && echo then
+	${HOME} readonly echo printf 'quoted text' grep export echo
+--verbose ${HOME} printf test x=1 -eu 'quoted text' | -eu --verbose
+		"$@" 'quoted text' sed export local printf ${HOME} echo
+	echo 'quoted text' $(pwd) echo ${HOME} cd grep "$1" "$@" ${HOME} ${HOME}
+	grep printf 2>/dev/null -eu ${HOME} "$@" export 'quoted text' done echo
+		printf -eu local -eu | -eu cd /usr/bin ${HOME} | export echo "$1" export 'quoted text'
+		2>/dev/null grep 2>/dev/null --verbose grep cd printf done && local local printf
+	2>/dev/null ${HOME} then cd && echo awk | readonly
+		printf awk | 'quoted text' "$@" "$@"
+local && readonly echo $(pwd) 2>/dev/null local printf then sed local ${HOME}
+	export /usr/bin done cd 'quoted text'
+	x=1 /usr/bin printf -eu --verbose then "$@" 2>/dev/null then x=1 then local
+		done | | 2>/dev/null | cd echo ${HOME} local $(pwd) $(pwd) 'quoted text' readonly
+--verbose done 'quoted text' awk sed $(pwd) ${HOME} 'quoted text' | test 'quoted text'
+| $(pwd) "$@" grep $(pwd) -eu test test x=1 x=1 test -eu cd
+	done "$@" /usr/bin 'quoted text' grep echo "$1"
+x=1 -eu 2>/dev/null ${HOME} -eu cd ${HOME} readonly -eu then "$1" printf
+		sed sed printf /usr/bin awk x=1 ${HOME} done 'quoted text'
+awk printf sed 2>/dev/null x=1 test 'quoted text' local export
+		done cd local echo awk readonly &&
+	${HOME} $(pwd) "$@" cd $(pwd) grep test echo "$1" -eu 'quoted text' --verbose
+		'quoted text' then | ${HOME} grep done cd sed x=1 then /usr/bin "$1"
+		2>/dev/null $(pwd) printf printf echo done &&
+	echo grep echo 2>/dev/null && then
+test done && ${HOME} cd 'quoted text'
+		cd "$1" $(pwd) /usr/bin "$@" | | /usr/bin -eu x=1 awk 'quoted text'
+	/usr/bin then && done "$1" then awk grep --verbose
+	test grep -eu $(pwd) test export &&
+	x=1 echo 2>/dev/null -eu /usr/bin done
+	| ${HOME} test 'quoted text' awk -eu $(pwd) -eu && sed
+		printf ${HOME} $(pwd) done "$@" "$@" ${HOME} local /usr/bin x=1 echo -eu -eu done
+	${HOME} local 'quoted text' "$@" x=1 $(pwd) export $(pwd)
+cd "$@" x=1 && $(pwd) $(pwd) 2>/dev/null
+	'quoted text' "$@" sed "$1" /usr/bin printf -eu 2>/dev/null
+"$1" grep export x=1 echo | then then done
+		then | readonly then /usr/bin echo sed
+		test local && "$1" | x=1
+	"$@" local local test done readonly && done 2>/dev/null
+| -eu -eu --verbose | cd ${HOME} local x=1 export && ${HOME} ${HOME}
+	&& readonly ${HOME} "$1" cd --verbose readonly awk
+	-eu grep $(pwd) printf test -eu
+printf then then 'quoted text' test ${HOME} -eu "$@" | awk echo done
+	--verbose done grep "$1" $(pwd) grep ${HOME} awk x=1
+	cd grep cd /usr/bin local done awk "$@"
+		awk -eu | echo -eu $(pwd) done -eu then export ${HOME} then --verbose
+	2>/dev/null "$1" 'quoted text' grep 'quoted text' echo | local
+		then /usr/bin grep /usr/bin then readonly
+	grep cd echo printf ${HOME} x=1 awk sed 2>/dev/null
+	x=1 | sed then "$@" awk printf $(pwd) sed "$@" export x=1 test done 'quoted text'
+&& && echo && then ${HOME}
+echo awk then x=1 /usr/bin ${HOME} -eu -eu ${HOME}
+	--verbose "$1" 2>/dev/null test ${HOME} readonly 2>/dev/null 2>/dev/null
+	"$@" $(pwd) readonly 2>/dev/null local printf echo "$@" readonly
+export && /usr/bin sed echo $(pwd) "$@" local /usr/bin ${HOME} test |
+echo | cd "$@" done done sed echo local "$@" echo --verbose done
+		printf echo 'quoted text' test "$1" grep x=1 -eu && grep 2>/dev/null
+export grep done printf local --verbose | x=1 done printf readonly -eu
+		echo && 'quoted text' grep $(pwd) $(pwd) -eu printf sed
+		| done | cd && -eu readonly | "$@" then local
+		grep | | | && printf local x=1 -eu x=1 test "$@" 'quoted text' x=1
+	"$@" sed done export echo printf "$@" 2>/dev/null
+test /usr/bin cd -eu echo | done "$@"
+awk echo readonly grep --verbose
+awk 2>/dev/null "$1" awk x=1 then 2>/dev/null ${HOME} /usr/bin 'quoted text' x=1
+		done done export -eu cd --verbose awk printf
+/usr/bin awk printf grep local x=1 sed readonly 'quoted text'
+		grep ${HOME} 2>/dev/null && grep awk readonly
+| awk grep 'quoted text' echo
+	$(pwd) "$@" --verbose "$@" && grep printf done -eu | local "$@" -eu done
+test printf readonly "$@" --verbose grep | printf printf echo 2>/dev/null
+		'quoted text' ${HOME} "$@"
+&& ${HOME} "$1" sed --verbose
+		/usr/bin echo export local /usr/bin echo
+local cd grep | export ${HOME} $(pwd) --verbose ${HOME} "$1" -eu /usr/bin test
+	x=1 | then printf "$@" cd readonly -eu done sed export /usr/bin
+	-eu && readonly 2>/dev/null 2>/dev/null
+$(pwd) 2>/dev/null awk awk -eu echo echo readonly test test $(pwd) sed 2>/dev/null
+	$(pwd) sed $(pwd) ${HOME} x=1 export then cd test
+test ${HOME} && && ${HOME} && grep awk cd done done $(pwd) --verbose
+		echo -eu echo 'quoted text' "$1" test "$@" x=1 /usr/bin
+printf readonly then "$1" $(pwd) cd grep grep ${HOME}
+	$(pwd) && 'quoted text' | x=1 "$@" export
+		x=1 echo x=1 | awk cd readonly then readonly $(pwd) grep
+	awk /usr/bin x=1 -eu sed grep
+"$@" grep --verbose local awk -eu then awk done test && "$1" test test
+echo /usr/bin printf echo grep -eu && local awk export
+	sed ${HOME} 2>/dev/null
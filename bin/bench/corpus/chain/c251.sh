@@ -0,0 +1,2001 @@
+		then grep && echo sed x=1 awk then
+		export then printf then export
+'quoted text' "$@" local sed | done | sed
+readonly echo ${HOME} 'quoted text' readonly done grep local
+	/usr/bin local sed 2>/dev/null awk "$1" /usr/bin
+x=1 done cd 'quoted text' local cd -eu 'quoted text' then echo grep --verbose
+		x=1 sed printf --verbose printf "$@" /usr/bin $(pwd)
+	2>/dev/null x=1 echo /usr/bin done awk 2>/dev/null "$@" export printf
+		echo readonly readonly test --verbose cd /usr/bin local readonly $(pwd)
+	then "$1" -eu | export readonly awk --verbose ${HOME}
+		x=1 echo readonly cd x=1 "$@"
+	'quoted text' readonly
+	sed sed /usr/bin $(pwd) &&
+	| local "$1" && x=1 then sed done $(pwd) && 'quoted text' | 2>/dev/null
+		printf "$@" 2>/dev/null $(pwd) "$1" && readonly &&
+		local x=1 "$1" readonly
+&& 2>/dev/null | "$1" awk grep -eu then ${HOME} readonly x=1 done
+$(pwd) awk /usr/bin echo
+grep /usr/bin --verbose "$1" /usr/bin x=1 "$1" local x=1 /usr/bin
+		"$@" x=1 then then then "$@" local x=1 awk -eu
+test && export echo readonly readonly printf test /usr/bin
+	${HOME} echo then 2>/dev/null /usr/bin sed "$1" 2>/dev/null
+	readonly /usr/bin | -eu
+	local /usr/bin "$1" -eu then | printf ${HOME} x=1 2>/dev/null
+		readonly test done "$@" "$@" 2>/dev/null test "$@" export ${HOME} then --verbose
+test | grep awk cd cd echo --verbose
+	-eu test cd 'quoted text' then printf test done 2>/dev/null
+		test done ${HOME} sed x=1 readonly test x=1 export 'quoted text' "$@"
+--verbose "$1" | echo echo 'quoted text' && x=1 done
+		&& /usr/bin then ${HOME} --verbose --verbose cd $(pwd)
+		sed x=1 "$1" --verbose awk "$1" "$1" grep
+		printf done ${HOME} | x=1 /usr/bin
+readonly | cd /usr/bin cd echo then readonly grep --verbose
+test then 'quoted text' "$1" -eu
+		echo 2>/dev/null grep echo done test "$1"
+cd readonly test grep readonly --verbose ${HOME} echo export && awk
+		printf echo "$@" printf
+	cd done 2>/dev/null local "$1" | awk awk 2>/dev/null
+		done grep awk x=1 && | --verbose
+	| ${HOME} | grep test printf
+export test "$@" export sed printf /usr/bin
+test x=1 echo --verbose export grep 'quoted text' | readonly
+'quoted text' readonly grep 'quoted text' cd readonly -eu
+		cd "$1" $(pwd) 2>/dev/null 'quoted text'
+	done "$@" awk test -eu export | awk printf $(pwd) printf readonly test
+		awk local && ${HOME} test /usr/bin 2>/dev/null cd readonly | "$1" -eu
+		printf done local -eu done x=1 | 'quoted text' && then && "$1"
+		${HOME} sed -eu x=1 'quoted text' | "$1" "$@" awk sed then
+	local -eu ${HOME} local readonly ${HOME}
+		cd | local x=1 'quoted text' done then ${HOME}
+		/usr/bin local 'quoted text' awk done
+then awk "$1" awk grep ${HOME} $(pwd)
+| "$@" awk echo --verbose | cd grep local | 'quoted text' readonly echo local
+	test grep done 2>/dev/null
+awk x=1 readonly awk sed local readonly export x=1 /usr/bin $(pwd) then --verbose
+done --verbose && $(pwd)
+		${HOME} sed grep echo x=1 test grep echo ${HOME} then
+		cd then && ${HOME} 2>/dev/null "$@" grep awk then awk readonly "$@"
+		| ${HOME} -eu 2>/dev/null cd then 'quoted text' grep && $(pwd) "$1"
+		--verbose readonly && /usr/bin x=1 test awk awk local readonly
+readonly "$1" $(pwd) then sed awk
+		test ${HOME} awk "$1" local -eu then $(pwd) "$1"
+	echo | /usr/bin export /usr/bin
+	awk grep $(pwd) ${HOME} --verbose printf
+		"$1" cd "$1" then sed 'quoted text'
+		echo export --verbose x=1 echo && "$@" ${HOME} -eu /usr/bin
+	cd awk test test readonly local "$1" local then -eu | cd done --verbose
+		export -eu ${HOME} sed --verbose 2>/dev/null grep test --verbose $(pwd)
+test awk /usr/bin printf grep 2>/dev/null 'quoted text' awk && | $(pwd) then
+	&& $(pwd) "$1" grep "$@" 'quoted text' sed
+		done "$@" --verbose "$1" /usr/bin cd x=1 test sed --verbose 2>/dev/null /usr/bin
+	sed -eu then done | export done
+	| done readonly export readonly echo test readonly
+/usr/bin "$1" && then grep 2>/dev/null then test sed | then test test
+	echo /usr/bin sed --verbose awk grep done x=1 /usr/bin "$@" "$@" | "$1" local
+		"$@" 2>/dev/null | awk /usr/bin 'quoted text' -eu cd "$@" ${HOME}
+		then x=1 2>/dev/null | sed --verbose awk 2>/dev/null
+	export $(pwd) cd printf
+	'quoted text' then | ${HOME} "$@" -eu
+"$@" ${HOME} local ${HOME} awk export $(pwd) | printf cd
+--verbose "$1" | cd 2>/dev/null "$1" "$1" cd ${HOME} echo grep /usr/bin
+	&& test cd -eu ${HOME} 2>/dev/null x=1 done 'quoted text'
+done 2>/dev/null local echo test test x=1 test
+	cd cd test printf "$@" cd cd local awk sed 'quoted text' echo
+2>/dev/null 'quoted text' -eu /usr/bin -eu 2>/dev/null | "$1" -eu 2>/dev/null
+printf x=1 awk grep /usr/bin --verbose -eu readonly printf 2>/dev/null
+cd $(pwd) /usr/bin --verbose $(pwd) printf "$1"
+		done done $(pwd) ${HOME}
+		&& echo | export /usr/bin echo "$@" awk local ${HOME} && 2>/dev/null
+	2>/dev/null grep awk | ${HOME} -eu
+x=1 echo export test cd awk 'quoted text' export 'quoted text'
+${HOME} && printf "$1" export echo $(pwd) "$1"
+	${HOME} echo local 2>/dev/null
+		then 2>/dev/null export 'quoted text' && cd local
+&& x=1 echo "$1" readonly | cd export readonly
+	/usr/bin grep sed awk export grep
+	x=1 test printf 'quoted text' awk && && sed $(pwd) "$@"
+echo awk test echo $(pwd) printf grep readonly --verbose cd export
+grep echo local then export x=1
+	export $(pwd) test 'quoted text' --verbose
+		--verbose ${HOME} 2>/dev/null ${HOME} $(pwd) local
+		x=1 export 'quoted text' cd $(pwd) /usr/bin "$1" ${HOME} /usr/bin readonly
+		"$1" "$1" local test "$1" readonly
+	'quoted text' && 2>/dev/null "$@" sed && $(pwd) ${HOME} echo awk export readonly
+		printf readonly sed test printf awk sed -eu $(pwd) "$1" ${HOME} $(pwd) readonly
+	echo sed sed 'quoted text' awk sed -eu
+local grep "$1" grep local | 'quoted text' | -eu x=1
+		then printf readonly x=1 awk then $(pwd) sed grep export ${HOME}
+	x=1 'quoted text' 'quoted text' "$1" printf "$1" readonly /usr/bin
+&& echo printf ${HOME} "$@" $(pwd) grep test
+readonly /usr/bin $(pwd) export | then "$1" 2>/dev/null
+		sed x=1 'quoted text' "$1"
+	then cd 2>/dev/null sed cd printf -eu -eu "$1" sed echo
+	/usr/bin /usr/bin printf awk ${HOME} && grep then cd
+	cd "$@" $(pwd) | local echo cd
+		awk --verbose sed readonly
+		/usr/bin export test echo sed then "$1" readonly
+	export --verbose export 2>/dev/null --verbose sed then 2>/dev/null readonly
+${HOME} sed awk test printf ${HOME} "$1" test
+		readonly $(pwd) 2>/dev/null $(pwd)
+	readonly | test awk cd /usr/bin "$@" printf -eu /usr/bin ${HOME} /usr/bin 2>/dev/null
+	&& then "$@" cd export --verbose readonly /usr/bin
+printf readonly 'quoted text' test
+x=1 printf printf sed grep done cd printf done sed echo 'quoted text'
+readonly --verbose echo "$@" | --verbose sed && &&
+		/usr/bin printf 2>/dev/null && --verbose
+	local | -eu export readonly grep
+'quoted text' --verbose
+$(pwd) printf sed 2>/dev/null awk
+		local --verbose "$1" "$1" /usr/bin
+	$(pwd) "$1" "$1" $(pwd)
+$(pwd) -eu local printf
+--verbose $(pwd) 'quoted text'
+	/usr/bin "$@" --verbose $(pwd) local export readonly
+'quoted text' readonly | ${HOME} then
+	${HOME} then 2>/dev/null "$1" then echo | printf 2>/dev/null
+		awk "$@" export export then && && 'quoted text' sed x=1 test export "$@" $(pwd)
+	${HOME} readonly done x=1
+		'quoted text' -eu test 'quoted text' then
+		awk "$1" cd sed /usr/bin && done 'quoted text' | then grep $(pwd) 2>/dev/null
+	grep sed && x=1 readonly cd --verbose
+grep && cd done ${HOME} 'quoted text'
+done echo grep printf local $(pwd) sed "$1" ${HOME} printf cd test done cd awk
+	&& grep 'quoted text' /usr/bin 'quoted text'
+	sed x=1 "$1" "$@" x=1 done readonly
+		local && --verbose $(pwd)
+	echo "$1" "$1" awk "$1" cd ${HOME} /usr/bin
+	| -eu $(pwd) printf echo local --verbose then echo "$1" grep "$@"
+cd "$@" readonly sed export local 2>/dev/null | --verbose sed | x=1 /usr/bin readonly
+		local echo $(pwd) && /usr/bin cd 'quoted text' cd -eu local cd test |
+		${HOME} sed | && export -eu grep
+--verbose "$1" -eu "$@" -eu && awk echo 2>/dev/null "$1"
+	sed sed sed grep grep test grep export
+		done x=1 -eu export $(pwd) | done ${HOME} "$1" 2>/dev/null
+		local then $(pwd) 2>/dev/null printf local 2>/dev/null then export "$@" -eu
+	awk "$1" grep /usr/bin --verbose
+-eu -eu ${HOME} 'quoted text' && local
+local echo local then echo /usr/bin
+		x=1 done awk cd x=1 "$1"
+	$(pwd) readonly -eu $(pwd) printf x=1 2>/dev/null
+	cd readonly grep awk test grep /usr/bin cd "$1" x=1 test /usr/bin sed
+	local local 'quoted text' test 'quoted text' && -eu
+		sed test 'quoted text' /usr/bin
+	cd 'quoted text' printf
+	/usr/bin /usr/bin 2>/dev/null && /usr/bin "$@" echo done
+	local export readonly x=1 "$1" echo 2>/dev/null "$1" printf export grep test sed
+		done /usr/bin 'quoted text' echo ${HOME} export 'quoted text' --verbose sed --verbose
+"$@" -eu && | x=1 && && "$@" cd --verbose
+	--verbose /usr/bin local local x=1 $(pwd) && --verbose ${HOME} -eu
+	export grep printf --verbose
+	'quoted text' 'quoted text' grep 'quoted text' export
+	-eu ${HOME} /usr/bin awk done awk echo -eu
+$(pwd) ${HOME} test sed /usr/bin
+	| ${HOME} | --verbose cd | cd readonly
+		--verbose x=1 sed local x=1 done
+	readonly x=1 2>/dev/null -eu printf
+		| x=1 | export ${HOME} && 2>/dev/null
+	"$1" printf echo export
+		x=1 | 2>/dev/null grep done x=1 echo cd printf local
+	'quoted text' $(pwd) grep x=1 "$@" /usr/bin -eu sed then
+2>/dev/null x=1 && --verbose
+		done && then 2>/dev/null readonly 'quoted text' awk sed readonly printf
+		"$1" "$@" local "$@" grep echo then /usr/bin test ${HOME} echo done
+		done -eu $(pwd) cd 2>/dev/null cd
+		done printf awk echo then awk ${HOME} cd -eu $(pwd) "$@" cd then then readonly
+		/usr/bin 'quoted text' cd
+		test grep --verbose /usr/bin /usr/bin --verbose 'quoted text' ${HOME}
+	local test awk echo test "$1"
+	readonly -eu awk then test echo 'quoted text' 2>/dev/null echo "$@"
+		then ${HOME} ${HOME} $(pwd) export -eu 2>/dev/null "$1" then readonly
+	-eu "$1" sed cd export 2>/dev/null -eu readonly /usr/bin /usr/bin "$1" echo
+		sed && grep | grep /usr/bin done echo
+	cd -eu then then export 2>/dev/null local readonly done x=1 "$1" -eu printf done
+	--verbose && readonly 2>/dev/null --verbose
+	&& local --verbose printf done
+		then then | cd --verbose x=1 ${HOME} echo 2>/dev/null
+	awk then "$1" -eu readonly local done
+	"$1" test echo local | echo "$1" then cd "$@" awk then test local 'quoted text'
+	${HOME} printf readonly export then grep awk sed local then ${HOME} grep --verbose
+		awk export $(pwd) x=1 -eu test ${HOME} cd && x=1 'quoted text'
+	x=1 /usr/bin | printf "$@" sed "$1" export ${HOME} x=1
+	done "$1" -eu then cd readonly "$1" 2>/dev/null
+	"$1" then && grep cd sed $(pwd) local $(pwd) sed echo export
+		&& x=1 ${HOME} $(pwd)
+		${HOME} $(pwd) done grep $(pwd) 2>/dev/null 2>/dev/null | printf
+readonly then /usr/bin grep
+	'quoted text' /usr/bin test -eu done "$1" /usr/bin echo $(pwd) export /usr/bin
+		/usr/bin && echo readonly test done
+	local /usr/bin 2>/dev/null
+		x=1 cd test /usr/bin x=1 export then /usr/bin test "$1" | | 'quoted text'
+	--verbose then x=1 && awk awk "$@" x=1 then --verbose $(pwd) echo "$1" ${HOME}
+printf printf 2>/dev/null && 2>/dev/null grep
+		| /usr/bin x=1 done "$@" cd test export
+	-eu 'quoted text' "$1" test test 'quoted text' export awk 'quoted text' printf
+| x=1 echo ${HOME} ${HOME} 2>/dev/null --verbose done grep x=1 printf awk "$@"
+then then --verbose && 2>/dev/null
+test "$1" x=1 then grep export /usr/bin grep | ${HOME} -eu printf cd ${HOME}
+		awk awk grep "$@" cd export && echo export local
+'quoted text' awk readonly done $(pwd) "$@" $(pwd) "$1" then $(pwd)
+		sed echo grep echo awk 2>/dev/null
+grep "$@" 'quoted text' 2>/dev/null && sed test
+then grep local cd sed $(pwd) 2>/dev/null grep cd $(pwd) export
+	readonly $(pwd) sed done
+		2>/dev/null /usr/bin export cd sed && echo awk cd ${HOME} done printf
+echo printf 2>/dev/null grep
+| cd && echo /usr/bin
+"$@" printf readonly export done awk export -eu readonly && 'quoted text'
+		echo awk --verbose 2>/dev/null local | grep 'quoted text' local 'quoted text'
+grep awk echo -eu printf /usr/bin
+'quoted text' readonly cd | "$1" echo 'quoted text'
+	"$1" then -eu done "$1" -eu cd grep done --verbose $(pwd)
+	then x=1 "$@" grep export | then echo -eu awk && "$1" x=1 $(pwd) cd printf
+		readonly 2>/dev/null local awk done echo test | sed then
+		-eu $(pwd) printf && echo | test && grep --verbose test --verbose | 'quoted text'
+	"$1" test 'quoted text' test printf && && --verbose cd --verbose
+sed --verbose && ${HOME} --verbose export grep test /usr/bin export $(pwd) "$@"
+		x=1 x=1 readonly grep echo local done 'quoted text' 'quoted text'
+| sed echo then | | cd
+		echo "$1" grep export export then test then
+	readonly /usr/bin $(pwd) && && && done test awk
+2>/dev/null -eu done test export 2>/dev/null | "$1" 'quoted text'
+		done "$@" /usr/bin ${HOME} x=1 "$@" export
+"$@" local /usr/bin then echo
+		&& "$@" /usr/bin local "$@" "$@" "$@" ${HOME} cd export cd
+/usr/bin awk && --verbose $(pwd) test export printf awk 2>/dev/null
+local grep test "$@" cd /usr/bin $(pwd) cd cd -eu "$1" "$@" readonly --verbose
+		| $(pwd) -eu x=1 readonly &&
+	readonly grep -eu -eu then
+		awk ${HOME} x=1 | $(pwd)
+		--verbose 'quoted text' grep local ${HOME} 2>/dev/null
+/usr/bin awk then /usr/bin test /usr/bin
+local cd -eu export 'quoted text'
+		$(pwd) export readonly done /usr/bin "$1"
+	/usr/bin --verbose && cd grep ${HOME} "$1" 2>/dev/null echo "$1"
+readonly grep ${HOME} ${HOME} printf
+	--verbose cd ${HOME} test $(pwd) awk printf /usr/bin x=1 "$1" ${HOME} local local
+x=1 echo echo 'quoted text' x=1 x=1 && "$1" test cd test ${HOME} "$@" 'quoted text'
+$(pwd) --verbose grep /usr/bin done printf printf cd grep "$1" done
+awk done 'quoted text' printf "$@"
+		"$@" --verbose && 'quoted text' export /usr/bin
+cd sed | local ${HOME} sed --verbose
+sed $(pwd) printf ${HOME} $(pwd) 'quoted text'
+		awk -eu "$@" 'quoted text' printf $(pwd)
+	--verbose export sed done $(pwd) --verbose
+		"$1" printf ${HOME} "$@" test 'quoted text' done echo
+test awk | /usr/bin export $(pwd) grep readonly /usr/bin
+readonly export --verbose cd -eu -eu
+echo local echo 'quoted text' $(pwd) done 'quoted text' /usr/bin printf cd
+	cd --verbose echo printf
+		'quoted text' done x=1 readonly awk test x=1 $(pwd) export echo x=1 $(pwd)
+		"$1" 'quoted text' done awk awk printf ${HOME} readonly "$1"
+	export x=1 --verbose --verbose "$@" awk x=1 &&
+	printf grep then --verbose printf --verbose | -eu grep /usr/bin readonly $(pwd)
+printf cd "$@" printf awk cd x=1
+		-eu sed grep x=1 && local
+| awk -eu test echo -eu printf --verbose
+	export ${HOME} --verbose x=1 sed --verbose
+	readonly readonly 'quoted text' -eu cd readonly
+		test echo echo sed sed 2>/dev/null printf awk "$@"
+	&& "$1" ${HOME} -eu -eu /usr/bin local --verbose
+done 2>/dev/null ${HOME} | done x=1 awk $(pwd) awk
+		printf cd done echo ${HOME}
+"$@" printf -eu sed ${HOME} awk
+	"$1" grep "$1" then done
+		&& readonly test printf $(pwd) && echo 2>/dev/null
+	then export "$1" /usr/bin
+		$(pwd) "$@" x=1 && export ${HOME} printf $(pwd) export readonly awk "$@" -eu $(pwd)
+	sed ${HOME} done printf x=1 && readonly
+cd export --verbose local x=1 --verbose /usr/bin --verbose cd done echo grep --verbose
+	--verbose awk readonly sed export "$1" readonly export
+	'quoted text' echo echo test done then echo x=1 ${HOME}
+| x=1 cd cd /usr/bin done export "$@" sed && /usr/bin readonly
+printf export 'quoted text' -eu echo test local "$1" 'quoted text'
+	cd 'quoted text' sed 2>/dev/null -eu
+	/usr/bin && export && readonly
+		"$@" "$@" test -eu /usr/bin
+test && echo x=1 -eu x=1 "$@" 'quoted text' ${HOME}
+x=1 -eu && "$1" done awk grep &&
+		sed then --verbose grep awk readonly
+	readonly readonly /usr/bin cd 'quoted text'
+	$(pwd) "$@" "$@" cd x=1 "$1"
+		done "$1" grep awk cd -eu readonly 'quoted text' ${HOME} awk --verbose
+		export && printf awk && done x=1 then grep --verbose awk /usr/bin
+local readonly x=1 'quoted text' /usr/bin 2>/dev/null x=1 -eu sed echo
+		$(pwd) grep local "$@" 2>/dev/null echo "$@" && export test "$1" test
+&& cd done | "$@" printf readonly export
+		$(pwd) 'quoted text' "$@" 2>/dev/null readonly && | /usr/bin
+	'quoted text' done $(pwd) /usr/bin $(pwd) readonly sed ${HOME} local /usr/bin
+/usr/bin /usr/bin "$1"
+	-eu "$1" /usr/bin printf /usr/bin
+local "$1" --verbose && -eu -eu 'quoted text' echo readonly /usr/bin x=1 test
+	echo readonly /usr/bin export printf -eu --verbose | echo cd done grep
+		export cd echo echo printf
+		test --verbose -eu export readonly x=1 readonly echo readonly ${HOME} --verbose
+then done | /usr/bin 2>/dev/null export readonly local cd export local
+	'quoted text' test && export sed ${HOME} /usr/bin awk
+		2>/dev/null "$1" awk "$@" /usr/bin sed "$@" sed x=1
+		x=1 2>/dev/null 2>/dev/null export /usr/bin --verbose /usr/bin "$1"
+		grep done 2>/dev/null --verbose --verbose
+awk /usr/bin sed echo 2>/dev/null test $(pwd) "$@" 2>/dev/null &&
+		printf && sed --verbose $(pwd) 'quoted text' /usr/bin test readonly /usr/bin
+		export local done local awk /usr/bin awk
+	x=1 -eu test test sed echo x=1 $(pwd) /usr/bin
+	/usr/bin done sed 2>/dev/null grep local "$@" 2>/dev/null export
+cd cd | | readonly ${HOME} -eu $(pwd) $(pwd) grep grep
+		readonly sed local readonly --verbose $(pwd) grep
+	local readonly echo && grep -eu /usr/bin && echo -eu "$1"
+test awk echo printf readonly
+'quoted text' awk local done export printf
+"$1" && echo sed sed echo echo printf $(pwd) && readonly then ${HOME} $(pwd) printf
+	cd grep | then sed && 2>/dev/null then then printf -eu 'quoted text' "$@"
+	"$1" echo "$1" local && test ${HOME} local -eu ${HOME} local
+	echo "$1" "$@" /usr/bin x=1 /usr/bin | export
+test done printf && $(pwd) "$1" 2>/dev/null | test "$1" x=1 ${HOME} "$@" then local
+	test awk --verbose grep awk local sed export echo $(pwd) export
+printf ${HOME} 'quoted text' done
+		done local 2>/dev/null done printf done readonly
+2>/dev/null 'quoted text'
+echo $(pwd) "$@" echo $(pwd) 'quoted text' x=1 readonly export
+		export $(pwd) printf then echo done export "$1" ${HOME} | --verbose
+$(pwd) export "$1" --verbose awk ${HOME} sed | 'quoted text'
+--verbose x=1 echo export 2>/dev/null -eu export done "$1" printf test -eu -eu
+	2>/dev/null ${HOME} "$@" then sed "$1" readonly printf local
+	'quoted text' grep "$1" 'quoted text' done echo --verbose done local awk local test
+	'quoted text' 2>/dev/null
+		then -eu sed "$1" /usr/bin echo readonly "$1" "$1" ${HOME} 2>/dev/null grep
+	"$@" awk then done readonly cd
+		${HOME} 2>/dev/null | echo awk $(pwd) ${HOME} --verbose
+		| sed 2>/dev/null ${HOME} 2>/dev/null cd "$1" ${HOME} export grep
+done --verbose awk readonly grep
+export grep /usr/bin printf grep --verbose then grep
+export 'quoted text' sed ${HOME} test awk &&
+	| --verbose cd 'quoted text' echo
+		test -eu readonly awk echo | 2>/dev/null awk -eu -eu done 2>/dev/null
+		cd printf && && echo cd test ${HOME} awk local
+	"$1" cd local test 'quoted text' 'quoted text'
+	done | then printf && --verbose awk done "$@" printf --verbose then
+		&& local "$@" export ${HOME} | -eu | /usr/bin "$@"
+		$(pwd) 2>/dev/null /usr/bin | done -eu printf
+	${HOME} local "$1" $(pwd) grep sed readonly "$1" done test then done printf |
+then 2>/dev/null "$@"
+	then done "$1" | x=1 "$1" echo 'quoted text'
+	then x=1 sed && 'quoted text' cd local $(pwd) -eu printf && "$@" awk sed
+		&& x=1 grep local export
+	2>/dev/null test 2>/dev/null echo then $(pwd) /usr/bin done | done local
+		${HOME} --verbose printf | readonly | local local 2>/dev/null 2>/dev/null
+	$(pwd) 'quoted text' x=1 then "$1" | done cd 'quoted text' 'quoted text'
+	sed 'quoted text' $(pwd) done $(pwd)
+/usr/bin --verbose -eu ${HOME} x=1 && | 2>/dev/null awk "$@" printf
+test x=1 done -eu test 2>/dev/null
+		export "$1" readonly "$1" echo export cd echo sed
+	grep ${HOME} grep x=1 x=1 "$@" | readonly then /usr/bin awk test readonly
+	then grep readonly grep -eu "$@" ${HOME}
+		${HOME} export export x=1 --verbose "$@" /usr/bin grep sed x=1 awk | export
+	-eu export export echo && then 2>/dev/null export && "$@" done done grep
+$(pwd) test x=1 'quoted text' test
+		"$1" --verbose 'quoted text' | "$@" readonly test sed /usr/bin printf
+$(pwd) $(pwd) test cd readonly 'quoted text'
+	"$@" grep | cd | export
+		'quoted text' 2>/dev/null readonly
+x=1 done "$1" awk && ${HOME} grep readonly && sed export --verbose
+		cd 2>/dev/null echo export awk --verbose done -eu awk printf echo 2>/dev/null
+awk export /usr/bin 2>/dev/null x=1 /usr/bin
+		"$1" && ${HOME} x=1 printf 'quoted text' export readonly "$@"
+then 'quoted text' --verbose "$1" 'quoted text' -eu then export --verbose
+readonly sed grep "$1" then local then $(pwd) grep
+	${HOME} | echo test cd "$1" test test done x=1 2>/dev/null
+		"$@" printf | ${HOME} local $(pwd) readonly
+	--verbose && x=1 x=1 --verbose -eu x=1 &&
+	printf echo 2>/dev/null awk cd echo then 'quoted text' echo
+	"$1" -eu --verbose "$1" 'quoted text' "$1" done cd && x=1 "$1"
+		$(pwd) && 2>/dev/null --verbose
+		| echo echo && sed 'quoted text' --verbose done 'quoted text' /usr/bin local
+cd --verbose "$@" printf grep awk test printf cd echo && $(pwd) printf awk /usr/bin
+"$1" printf ${HOME} /usr/bin | readonly printf && echo "$@" 2>/dev/null 2>/dev/null
+	-eu -eu then done test -eu "$@" grep then "$1" cd sed
+		done then | printf "$1" test --verbose "$1" readonly |
+then ${HOME} 'quoted text' printf export --verbose
+		readonly "$1" test x=1 'quoted text' x=1
+	test test printf cd awk && "$@" printf 2>/dev/null
+		sed x=1 -eu && --verbose "$@" "$@" "$@" grep $(pwd) && awk echo |
+		grep export printf x=1 $(pwd) x=1 | sed
+	"$@" then grep then sed grep -eu grep x=1 then grep then grep
+		2>/dev/null -eu then | 'quoted text' -eu
+		sed export "$@" printf grep done /usr/bin x=1 grep awk -eu &&
+		echo readonly ${HOME} -eu
+"$@" done then && --verbose cd cd grep && printf then ${HOME} readonly --verbose
+done awk done ${HOME} 2>/dev/null echo done awk "$1" 'quoted text'
+	done printf "$@" sed done x=1 then $(pwd) test --verbose then 'quoted text'
+	${HOME} && | awk awk export /usr/bin printf "$@" grep --verbose awk
+		"$@" "$1" readonly test -eu readonly | sed export "$1" cd && export
+		'quoted text' echo test /usr/bin awk export 2>/dev/null && x=1 -eu
+	/usr/bin local $(pwd) "$1" export export echo echo cd ${HOME} | awk readonly
+		&& ${HOME} -eu test test awk "$1" "$@" "$1" then
+	'quoted text' 'quoted text' && local --verbose | awk grep $(pwd)
+	test $(pwd) && 'quoted text' "$1" -eu /usr/bin | && then 2>/dev/null echo
+readonly -eu x=1 awk echo
+		export done "$@" ${HOME} "$1" ${HOME} then echo $(pwd) && echo done $(pwd)
+	"$1" "$1" echo echo x=1 then export grep
+	$(pwd) "$@" test $(pwd) cd grep && awk --verbose 2>/dev/null done local "$1" grep
+		test -eu "$1" awk grep $(pwd)
+| x=1 --verbose echo echo readonly
+		-eu cd done 2>/dev/null "$1" readonly 'quoted text'
+	grep "$@" ${HOME} && then readonly printf
+x=1 sed | "$1" --verbose
+2>/dev/null export printf echo "$@" echo | done cd echo && printf
+then 'quoted text' sed cd $(pwd) -eu 'quoted text' cd && 2>/dev/null
+		--verbose readonly awk 2>/dev/null | echo echo echo then
+		&& done 2>/dev/null local /usr/bin
+		awk awk "$1" 2>/dev/null grep grep /usr/bin "$1" echo cd sed 2>/dev/null
+	sed awk then $(pwd) then -eu $(pwd)
+	export readonly grep -eu awk grep export sed -eu sed awk local printf done
+		local awk grep --verbose test /usr/bin grep x=1 $(pwd) test $(pwd) "$1"
+echo echo then readonly 2>/dev/null $(pwd) echo echo /usr/bin
+x=1 cd -eu $(pwd) test export awk x=1 test /usr/bin --verbose
+		-eu then awk | echo "$@" 2>/dev/null "$1"
+export printf then grep | --verbose x=1 grep test x=1 && sed $(pwd) -eu
+export x=1 grep 'quoted text' printf 2>/dev/null cd | 2>/dev/null
+&& printf --verbose export 'quoted text' | 'quoted text' test then
+		"$1" | awk printf echo printf done readonly --verbose
+	| "$1" ${HOME} 2>/dev/null echo
+	x=1 && then export && awk 'quoted text' printf sed echo
+--verbose && x=1 local local "$1" readonly echo
+		| 'quoted text' sed --verbose
+		echo 'quoted text' x=1 "$1" | && 'quoted text' --verbose
+	printf && $(pwd) | && grep grep /usr/bin
+		test cd "$@" | "$@" --verbose "$1" 2>/dev/null
+&& cd grep 2>/dev/null && readonly awk test cd printf sed then awk
+'quoted text' "$1" x=1 "$@" ${HOME} test /usr/bin "$1" /usr/bin "$1" /usr/bin
+	$(pwd) 'quoted text' ${HOME} "$1" "$1" then --verbose then local /usr/bin
+done x=1 && awk && | readonly awk "$1" grep cd ${HOME} echo awk
+"$@" test awk done done 2>/dev/null export local &&
+	"$1" --verbose then grep ${HOME} done | grep $(pwd)
+-eu ${HOME} export | --verbose echo sed cd sed sed /usr/bin cd x=1 &&
+		$(pwd) /usr/bin | printf local 2>/dev/null "$@" 'quoted text' cd "$1" cd
+readonly /usr/bin then ${HOME} x=1 /usr/bin local --verbose "$1" cd $(pwd) done
+awk --verbose /usr/bin test sed -eu
+	'quoted text' -eu --verbose sed export readonly cd readonly 'quoted text'
+	done then -eu done test -eu sed | cd cd
+/usr/bin --verbose /usr/bin | 2>/dev/null $(pwd) echo | done "$1" "$1" --verbose
+	"$@" then sed cd --verbose "$@" && printf export printf $(pwd) | done "$@" /usr/bin
+export readonly "$1" grep
+		grep 2>/dev/null done $(pwd) printf echo -eu "$@" test
+sed sed readonly 'quoted text' sed grep x=1 'quoted text'
+		sed && cd awk local -eu printf local 'quoted text' awk $(pwd)
+	"$@" done local 'quoted text' 2>/dev/null printf 'quoted text' awk sed cd $(pwd)
+		cd $(pwd) && && "$1" test then sed cd awk readonly $(pwd) $(pwd)
+		/usr/bin test grep test local printf 2>/dev/null
+	export /usr/bin "$1" export -eu grep grep printf echo && /usr/bin
+		$(pwd) cd grep "$1" | readonly sed -eu
+| grep awk 'quoted text' export done export sed "$1" ${HOME}
+	printf -eu "$1" awk printf export /usr/bin export sed /usr/bin -eu ${HOME} 'quoted text'
+	echo export done 'quoted text'
+readonly sed then /usr/bin 'quoted text' echo done
+		printf echo awk local done | "$@" cd x=1 printf x=1 then | 'quoted text'
+	&& | x=1 cd test 2>/dev/null $(pwd)
+		2>/dev/null then echo local local then -eu echo -eu $(pwd) echo printf | printf
+test "$@" "$1" local printf sed
+		$(pwd) $(pwd) then awk done echo export
+"$@" sed -eu | sed /usr/bin grep local $(pwd) $(pwd) "$1" printf echo grep printf
+		'quoted text' --verbose "$1"
+	"$@" ${HOME} then export && awk then 2>/dev/null
+readonly cd /usr/bin --verbose then export readonly sed -eu readonly printf
+	"$@" 2>/dev/null /usr/bin --verbose
+"$1" local 2>/dev/null
+sed test done printf test sed
+cd awk $(pwd) grep -eu sed grep
+	--verbose local "$1" awk 2>/dev/null && /usr/bin local
+	$(pwd) done 2>/dev/null "$1" 2>/dev/null echo grep
+		x=1 done test grep grep 2>/dev/null
+	"$@" x=1 x=1 export x=1 | --verbose 'quoted text' grep then readonly
+-eu echo | "$1" "$@" ${HOME} -eu readonly
+		$(pwd) $(pwd) -eu done sed --verbose $(pwd) && ${HOME} "$1" -eu done
+		sed --verbose ${HOME} -eu
+		| | awk readonly 'quoted text' ${HOME} printf | sed
+sed -eu then | 'quoted text' -eu && export printf ${HOME} | then -eu | cd
+done "$@" cd /usr/bin readonly /usr/bin 'quoted text' "$1" awk
+	$(pwd) -eu x=1 $(pwd) readonly export 2>/dev/null 2>/dev/null echo 'quoted text'
+		echo test ${HOME} $(pwd) "$1" cd echo 'quoted text' && "$@" echo awk
+		| x=1 done 2>/dev/null --verbose $(pwd) ${HOME} && && export
+$(pwd) 'quoted text' /usr/bin awk $(pwd) export then -eu echo "$1" -eu awk
+	x=1 readonly $(pwd) ${HOME} /usr/bin
+		echo "$@" "$1" $(pwd) awk 2>/dev/null export -eu x=1 "$1" | test -eu $(pwd)
+	/usr/bin awk readonly awk /usr/bin grep cd 2>/dev/null
+	then cd readonly 'quoted text' awk test cd grep printf "$1" -eu grep then export
+local ${HOME} sed test | export && test -eu done
+readonly --verbose done done readonly export "$@" readonly then done | echo --verbose
+		--verbose 2>/dev/null && awk "$1" printf awk
+	x=1 | then local && test ${HOME} | awk "$@" sed 2>/dev/null
+		awk grep 'quoted text' printf printf then && 2>/dev/null
+cd cd export printf printf readonly | then done /usr/bin "$@" done export
+		${HOME} echo echo "$1" then export
+	"$1" printf 'quoted text' echo export then local cd $(pwd) test done x=1 ${HOME}
+		--verbose then "$@" done test -eu export cd sed export
+done cd test 'quoted text' /usr/bin /usr/bin awk
+x=1 echo then x=1 done cd grep | printf -eu test test done ${HOME}
+	2>/dev/null x=1 && cd printf
+	&& cd x=1 printf "$1"
+	/usr/bin local "$@" local 2>/dev/null
+	cd done --verbose awk ${HOME} then 'quoted text' $(pwd) awk 'quoted text'
+sed cd grep 'quoted text' readonly local done grep echo test x=1
+-eu ${HOME} test local export && then | then grep /usr/bin && local 'quoted text'
+	"$1" then printf x=1 then readonly "$@" "$1" /usr/bin
+		grep ${HOME} awk x=1 $(pwd) --verbose grep readonly
+readonly $(pwd) /usr/bin x=1 --verbose x=1 ${HOME} ${HOME} local --verbose
+		readonly && readonly grep "$@" awk | echo x=1 $(pwd)
+		echo "$1" "$1" cd --verbose
+printf ${HOME} printf 2>/dev/null done export $(pwd) | awk cd "$@" awk sed ${HOME}
+		echo /usr/bin -eu done grep readonly
+		"$1" awk cd export echo && printf printf 'quoted text'
+		| readonly local ${HOME} cd local x=1 $(pwd) -eu "$1" 2>/dev/null sed test
+		| /usr/bin /usr/bin then "$@" test 'quoted text' test 'quoted text'
+	echo /usr/bin test && 'quoted text' echo "$@" done sed | local readonly
+	"$1" done readonly readonly grep "$@" $(pwd) done readonly
+	'quoted text' x=1 awk ${HOME}
+	--verbose && ${HOME} "$@" /usr/bin
+echo then cd 2>/dev/null sed -eu grep "$@"
+		--verbose 'quoted text' | --verbose && then export
+		x=1 readonly sed sed x=1 local grep ${HOME} -eu awk -eu
+	done test 2>/dev/null | "$1" awk "$@" echo $(pwd) then test cd printf
+		sed local -eu 'quoted text' grep readonly x=1 readonly ${HOME}
+		done echo local export
+		echo /usr/bin -eu then
+		local -eu x=1 -eu -eu local $(pwd) cd /usr/bin
+	"$1" 2>/dev/null test 'quoted text'
+		grep 2>/dev/null 2>/dev/null -eu local && && -eu 2>/dev/null printf sed $(pwd)
+'quoted text' sed $(pwd) done echo done echo -eu readonly
+2>/dev/null test awk awk local ${HOME} 2>/dev/null x=1 && sed readonly
+export grep sed "$1" | echo echo "$@" cd awk -eu grep 2>/dev/null
+		2>/dev/null --verbose sed then -eu grep
+export sed "$@" 2>/dev/null ${HOME} then ${HOME} awk ${HOME} awk --verbose
+		-eu then && "$1" done export export --verbose
+	cd $(pwd) ${HOME} x=1 then grep sed sed awk done -eu --verbose
+	'quoted text' "$@" /usr/bin 'quoted text' | 'quoted text'
+x=1 2>/dev/null && test "$1" grep cd | $(pwd) --verbose readonly
+		awk echo sed test && sed awk then 2>/dev/null /usr/bin sed
+	"$@" "$1" test | | printf done | --verbose x=1 2>/dev/null | -eu
+		/usr/bin local readonly
+		printf sed "$@" | echo done cd
+	'quoted text' "$1" awk "$@" sed 2>/dev/null
+		then --verbose -eu export | x=1 && --verbose /usr/bin
+		echo /usr/bin cd 2>/dev/null && readonly export cd awk &&
+		${HOME} && readonly 'quoted text'
+echo "$1" echo grep grep export readonly && sed grep printf ${HOME} 2>/dev/null
+	${HOME} "$@" printf ${HOME} --verbose --verbose grep printf
+		/usr/bin 'quoted text' readonly cd "$@" "$1" done done /usr/bin
+		2>/dev/null x=1 echo test printf x=1 grep then /usr/bin printf cd "$@" $(pwd)
+		readonly $(pwd) then && readonly -eu echo | echo "$1"
+		sed test local then done
+test | | && awk 'quoted text' echo readonly echo $(pwd) && ${HOME}
+readonly ${HOME} grep done "$@" echo awk "$1" cd "$@" awk -eu x=1 printf
+2>/dev/null then -eu x=1 test $(pwd) export export 2>/dev/null
+		awk test then && 2>/dev/null $(pwd) ${HOME} echo done 'quoted text' awk then
+local -eu "$@" sed printf sed local -eu x=1 ${HOME}
+	'quoted text' sed && ${HOME} x=1
+	2>/dev/null -eu export ${HOME} sed then grep done cd ${HOME} --verbose | readonly
+	$(pwd) printf 2>/dev/null echo
+| /usr/bin 2>/dev/null grep echo echo x=1 --verbose 2>/dev/null done -eu grep
+		local $(pwd) printf 2>/dev/null
+	export | grep "$1" "$@" 'quoted text' printf local readonly
+		test x=1 grep /usr/bin awk export echo && ${HOME}
+		'quoted text' /usr/bin -eu local cd grep
+	'quoted text' "$1" cd test ${HOME} then local
+	--verbose then | local $(pwd) x=1 $(pwd) test x=1 echo "$@" 'quoted text'
+2>/dev/null "$@" test printf grep /usr/bin -eu test | 2>/dev/null grep done
+$(pwd) export -eu ${HOME} awk cd
+&& | "$@" awk 2>/dev/null printf ${HOME} x=1 test
+	echo export "$1" 2>/dev/null done grep printf printf /usr/bin local readonly
+grep echo readonly /usr/bin 'quoted text' ${HOME} && echo echo readonly cd done
+export ${HOME} export 2>/dev/null -eu --verbose 'quoted text' readonly
+		test cd $(pwd) echo export "$@" cd &&
+		$(pwd) local --verbose x=1 sed cd then &&
+		2>/dev/null $(pwd) local local sed -eu "$@" $(pwd)
+		/usr/bin cd --verbose test --verbose
+		cd readonly 2>/dev/null && "$1" --verbose grep awk
+readonly x=1 'quoted text' then grep export 2>/dev/null awk
+echo sed ${HOME} x=1 -eu && --verbose /usr/bin echo awk "$1" awk && sed
+		-eu local $(pwd) cd then done 2>/dev/null readonly done 'quoted text'
+		&& --verbose awk x=1
+done local echo sed "$1" | --verbose
+	awk then | grep 2>/dev/null cd && "$1" cd "$@" "$1"
+	echo local ${HOME} readonly
+		done printf /usr/bin echo | /usr/bin printf
+grep local -eu sed "$@" --verbose
+		-eu ${HOME} export ${HOME} /usr/bin done --verbose test awk -eu --verbose
+		grep x=1 x=1 cd cd awk && then "$@" cd printf | -eu printf test $(pwd) "$1"
+| $(pwd) cd grep readonly then local echo done
+grep /usr/bin 2>/dev/null x=1 ${HOME} &&
+	2>/dev/null x=1 cd $(pwd) readonly 2>/dev/null
+	${HOME} --verbose && ${HOME} 'quoted text' echo "$1" "$@" sed then
+export --verbose -eu then | readonly
+--verbose "$@" $(pwd) $(pwd) x=1 "$@" 'quoted text'
+export x=1 cd -eu /usr/bin x=1 | && "$@" export x=1 "$1" 'quoted text'
+	sed test x=1 $(pwd) -eu
+	export local cd ${HOME} awk $(pwd) "$@" /usr/bin local
+	sed printf cd ${HOME} 2>/dev/null "$@" local -eu then $(pwd)
+		-eu x=1 done export --verbose -eu cd | cd
+	$(pwd) && readonly -eu grep grep export
+readonly $(pwd) cd -eu sed grep done "$1" local grep
+	-eu sed --verbose echo 'quoted text' awk "$@" test /usr/bin
+grep grep sed cd export done && export
+	2>/dev/null then readonly
+"$@" awk local "$1" /usr/bin /usr/bin
+	awk && "$1" | ${HOME} printf 'quoted text' test 'quoted text'
+		printf -eu $(pwd) -eu x=1
+		local then awk 2>/dev/null /usr/bin export
+| echo export grep --verbose "$1" $(pwd) "$@"
+awk cd then printf sed | /usr/bin "$@" /usr/bin sed --verbose cd local 'quoted text'
+&& 'quoted text' then "$1" echo
+	"$1" --verbose local awk && --verbose
+cd ${HOME} "$@" test 'quoted text' --verbose sed
+test -eu 'quoted text' printf --verbose "$@" x=1 && 2>/dev/null echo done
+	cd && 2>/dev/null "$1" "$@"
+	printf $(pwd) awk "$1" cd then x=1
+cd echo 'quoted text' "$@" then -eu 2>/dev/null test printf grep
+	/usr/bin --verbose sed /usr/bin && 'quoted text' local echo echo test
+'quoted text' sed test
+		--verbose sed then /usr/bin
+		$(pwd) cd readonly ${HOME} 'quoted text'
+sed cd done /usr/bin readonly grep && "$1" local readonly
+		--verbose /usr/bin ${HOME} printf echo grep local 'quoted text'
+		"$1" export "$1" grep 2>/dev/null -eu grep awk x=1 | grep export cd
+	&& /usr/bin echo awk 2>/dev/null test test && then $(pwd)
+| grep $(pwd) printf $(pwd) 2>/dev/null readonly then
+	awk "$1" 'quoted text' && awk test grep "$1" ${HOME} echo done
+sed readonly "$1" cd done sed "$1" test
+		done | 2>/dev/null 'quoted text' -eu sed $(pwd) /usr/bin sed awk --verbose
+	sed $(pwd) readonly export /usr/bin 2>/dev/null $(pwd) test --verbose /usr/bin
+		then echo x=1 test sed cd cd echo echo x=1 printf readonly
+		done echo $(pwd) x=1 export $(pwd) grep cd
+	"$1" 'quoted text' printf $(pwd) "$1" | 'quoted text' ${HOME} awk cd ${HOME}
+	sed done echo sed done echo grep && "$@" 2>/dev/null echo /usr/bin then "$@"
+	"$@" sed | awk 'quoted text' 2>/dev/null
+export /usr/bin test then 'quoted text'
+		&& x=1 "$@" export readonly then "$1" done local /usr/bin printf 2>/dev/null
+2>/dev/null $(pwd) export local -eu local cd
+then echo sed /usr/bin cd ${HOME} printf
+	test export "$1" 'quoted text' local 'quoted text'
+	-eu then readonly test then then && -eu --verbose local --verbose ${HOME} x=1 "$1"
+	done -eu 'quoted text' x=1 echo
+		sed echo grep --verbose "$@" && /usr/bin | 'quoted text'
+	--verbose 'quoted text' sed && export -eu
+$(pwd) /usr/bin grep ${HOME} $(pwd)
+then printf sed x=1 then -eu | local printf export
+		test | readonly | 'quoted text' $(pwd) done readonly sed
+		/usr/bin ${HOME} grep && cd
+		${HOME} local local | test printf -eu
+	--verbose grep "$@" && --verbose readonly done --verbose
+	then printf readonly 'quoted text'
+		'quoted text' 'quoted text' x=1 -eu && 'quoted text'
+		local awk && done 'quoted text' export ${HOME} "$1" cd cd x=1 --verbose
+	'quoted text' grep x=1 grep done export then local sed "$1" grep
+	/usr/bin done grep /usr/bin awk readonly sed export
+'quoted text' | sed export -eu
+$(pwd) cd x=1 done /usr/bin sed sed && -eu && ${HOME}
+	x=1 "$@" awk && test /usr/bin cd grep local
+then && && awk done printf $(pwd) done done 'quoted text'
+	&& printf "$@" 2>/dev/null
+'quoted text' readonly -eu local
+		echo "$@" awk x=1 readonly 2>/dev/null then readonly -eu x=1 "$@" local readonly
+	local && x=1 local "$@" then awk test $(pwd)
+cd echo sed x=1 test cd --verbose done 2>/dev/null 2>/dev/null
+		'quoted text' local $(pwd) $(pwd) "$@" cd --verbose
+	"$1" "$@" readonly 'quoted text'
+	$(pwd) then export sed | awk done --verbose grep
+		printf 2>/dev/null cd readonly 'quoted text' awk printf cd echo -eu
+	-eu --verbose echo --verbose readonly | awk echo done grep --verbose
+	local "$@" sed awk then | |
+printf printf 'quoted text' then cd && "$1"
+	| test echo x=1 x=1 test grep 'quoted text' x=1 done "$@" export
+"$@" -eu "$1" readonly printf sed grep
+	sed /usr/bin -eu 2>/dev/null /usr/bin
+x=1 $(pwd) -eu $(pwd) | --verbose x=1 done awk ${HOME} "$@" "$1" | readonly
+echo /usr/bin then -eu /usr/bin awk then x=1 "$@" awk cd
+awk "$@" echo | sed "$@" "$@" 2>/dev/null "$1" /usr/bin local "$1" && "$@"
+local | "$1" export echo /usr/bin grep
+	/usr/bin awk grep -eu 'quoted text' done $(pwd)
+	sed export awk local 2>/dev/null echo then /usr/bin local export
+	&& readonly 2>/dev/null $(pwd) && awk x=1 readonly ${HOME} /usr/bin cd &&
+		-eu grep readonly printf sed "$@" cd "$1" --verbose 2>/dev/null
+	test readonly done cd "$@" $(pwd) 2>/dev/null sed &&
+sed export cd -eu "$@"
+		&& sed "$@" x=1 --verbose "$@" export -eu && then $(pwd)
+		${HOME} 'quoted text' 2>/dev/null -eu x=1 cd ${HOME} printf x=1 echo printf 2>/dev/null
+	cd ${HOME} grep printf export export
+	$(pwd) "$@" local $(pwd) -eu cd ${HOME} local then "$@"
+	x=1 cd awk 2>/dev/null echo "$@" export test echo then --verbose test
+x=1 echo | "$@" ${HOME} | local ${HOME} && "$1" /usr/bin sed export $(pwd) --verbose
+		echo printf then cd --verbose then test
+	local /usr/bin grep 2>/dev/null test && &&
+	done ${HOME} export cd && 'quoted text' && ${HOME} cd "$1" sed local then 'quoted text'
+--verbose then cd echo test awk 2>/dev/null
+		$(pwd) local done | | /usr/bin
+readonly $(pwd) | echo test export export echo cd /usr/bin "$@" echo 'quoted text'
+		2>/dev/null then cd cd
+	grep 2>/dev/null echo
+	awk "$@" printf sed /usr/bin echo test ${HOME} export test then local &&
+	"$@" local grep $(pwd) --verbose then 2>/dev/null
+&& done 2>/dev/null | "$1" export -eu $(pwd) then /usr/bin "$@" local sed
+		grep ${HOME} local /usr/bin
+	printf sed "$1" -eu local
+&& 'quoted text' | "$@" sed -eu 2>/dev/null done | 2>/dev/null done done
+	/usr/bin grep -eu test --verbose && then test export then && ${HOME} done
+		'quoted text' ${HOME} echo | | awk ${HOME} cd ${HOME}
+		"$1" 'quoted text' export --verbose -eu readonly 2>/dev/null
+		"$1" echo x=1 local readonly cd $(pwd) printf local 'quoted text'
+"$1" sed awk local -eu $(pwd) && "$1" grep
+		'quoted text' local "$1" export export sed cd local
+done test && $(pwd) echo
+		test "$@" local printf test readonly "$@" $(pwd) printf echo $(pwd) /usr/bin -eu
+	2>/dev/null export grep ${HOME} test -eu readonly ${HOME} && then $(pwd)
+${HOME} /usr/bin x=1 -eu x=1 2>/dev/null export grep grep
+	grep 2>/dev/null 'quoted text' $(pwd) ${HOME} test test "$@" $(pwd) done
+		--verbose printf "$@" 'quoted text' /usr/bin
+then --verbose 2>/dev/null ${HOME} /usr/bin --verbose 2>/dev/null
+		-eu test 'quoted text' -eu export readonly echo /usr/bin "$1"
+local | export readonly && 2>/dev/null
+		export cd "$1" | grep -eu | ${HOME} $(pwd) local && && awk 'quoted text'
+		$(pwd) cd awk sed 2>/dev/null sed -eu awk $(pwd)
+		grep done printf 2>/dev/null
+	'quoted text' -eu 2>/dev/null
+		printf readonly test cd 'quoted text' "$1" then 2>/dev/null
+		$(pwd) grep && awk && printf ${HOME} export 2>/dev/null printf printf
+		export ${HOME} printf sed test readonly done test && sed
+		'quoted text' awk ${HOME} sed 'quoted text' grep test sed x=1 then && $(pwd) -eu
+		local done sed x=1 "$1" --verbose awk grep
+| printf grep $(pwd) awk "$1" ${HOME}
+readonly then 'quoted text' grep done --verbose cd cd |
+		export "$@" awk test && local
+echo done readonly local ${HOME} x=1 sed "$1" echo ${HOME} --verbose
+test 'quoted text' x=1 done local printf
+		"$@" ${HOME} 2>/dev/null readonly then test
+	then x=1 "$@" /usr/bin 2>/dev/null
+		${HOME} local local | printf echo && x=1 | ${HOME} /usr/bin
+		&& grep ${HOME} $(pwd) local && --verbose "$1" sed then "$@" ${HOME} $(pwd)
+sed readonly export readonly | export && | printf
+done && cd done $(pwd) 2>/dev/null -eu 'quoted text' "$1" test $(pwd) readonly
+		grep -eu $(pwd) "$@" x=1 sed /usr/bin 2>/dev/null x=1
+		2>/dev/null --verbose
+	x=1 x=1 readonly | --verbose && x=1 echo awk
+	test test local printf grep --verbose local test echo done
+$(pwd) --verbose readonly sed $(pwd) test then | $(pwd) cd --verbose done export
+"$@" local 2>/dev/null /usr/bin then 2>/dev/null then sed ${HOME} /usr/bin
+	printf test done /usr/bin echo awk local | sed
+	x=1 && grep 'quoted text' export "$1" export "$@" export ${HOME}
+awk readonly then echo test printf sed test ${HOME} --verbose test
+	x=1 readonly printf 'quoted text'
+		"$@" export test 'quoted text'
+		"$1" | done "$@" printf && "$1" echo x=1 export | printf
+	cd local x=1 && cd echo cd export /usr/bin
+		cd "$1" then --verbose ${HOME}
+	awk && && done $(pwd) then export test grep cd sed grep
+		export ${HOME} -eu export then readonly sed then
+	test echo test done x=1 local --verbose 'quoted text'
+		&& readonly && 'quoted text' awk local x=1 "$1" "$@" printf done "$1"
+	cd test "$@" test cd 'quoted text' printf cd | echo
+	$(pwd) --verbose --verbose && x=1 grep local /usr/bin then
+	done then && $(pwd) 'quoted text' && local -eu | 2>/dev/null
+	cd -eu x=1 --verbose 'quoted text' 'quoted text' grep then -eu test
+printf done cd "$@" cd $(pwd) 'quoted text'
+'quoted text' export sed cd "$1" echo 2>/dev/null cd done test sed then ${HOME}
+/usr/bin /usr/bin "$@" awk test cd -eu
+		grep -eu export /usr/bin
+	echo echo /usr/bin printf
+--verbose ${HOME} readonly export && test done local printf then cd "$1" 'quoted text'
+$(pwd) ${HOME} local readonly test /usr/bin grep
+		echo awk sed && x=1 x=1 cd ${HOME} done
+	local -eu sed sed -eu 'quoted text' then done 'quoted text' cd local 2>/dev/null
+		$(pwd) export ${HOME} echo 'quoted text' && --verbose
+awk 'quoted text' -eu
+-eu test $(pwd) done export -eu $(pwd) 2>/dev/null export
+&& $(pwd) test done readonly
+	/usr/bin ${HOME} /usr/bin | && readonly | /usr/bin /usr/bin "$1" $(pwd) -eu
+		&& then cd echo ${HOME}
+-eu | x=1 grep grep $(pwd) | printf
+local awk -eu "$@" ${HOME} awk sed --verbose -eu "$1" cd
+&& $(pwd) "$1" echo "$1" $(pwd) /usr/bin export export test x=1 cd 'quoted text'
+local then 2>/dev/null x=1 readonly --verbose $(pwd) x=1 | then
+awk --verbose $(pwd) export x=1 done
+		awk && cd cd $(pwd) echo export | cd readonly 2>/dev/null cd --verbose printf
+		'quoted text' test 2>/dev/null cd then ${HOME} readonly -eu
+		done awk printf printf local then x=1 export awk export | "$1" readonly "$1"
+		readonly then 'quoted text' export "$@" grep x=1 x=1 "$1" ${HOME} | export
+local --verbose /usr/bin ${HOME} readonly ${HOME} test
+	local $(pwd) readonly sed sed test done | $(pwd) readonly printf local then
+	local --verbose | 2>/dev/null then /usr/bin local 2>/dev/null $(pwd) cd && test
+		export printf echo "$@" ${HOME} printf local "$1" cd | "$@"
+	test "$@" export 'quoted text' x=1 done ${HOME} --verbose $(pwd) then "$@" /usr/bin
+	export printf test --verbose then 2>/dev/null && | awk --verbose sed
+local echo sed "$@" awk readonly local && "$@" echo grep 2>/dev/null
+-eu /usr/bin then printf readonly test ${HOME}
+		2>/dev/null grep test $(pwd) test awk local printf grep $(pwd) printf 2>/dev/null
+readonly export | done "$@" -eu export
+	sed then done "$1" x=1 readonly && cd --verbose /usr/bin "$1" export ${HOME} awk
+		printf done sed then -eu readonly ${HOME}
+		echo test 2>/dev/null done 'quoted text' awk echo $(pwd) cd local grep sed then
+then then | $(pwd) done | ${HOME} -eu cd local then -eu
+	-eu "$@" echo done cd printf /usr/bin "$1" | echo echo awk && /usr/bin
+	echo "$1" echo readonly test echo
+		"$1" local local x=1 $(pwd) 'quoted text' export
+		x=1 'quoted text' ${HOME} /usr/bin printf echo && "$1" sed --verbose
+		'quoted text' then echo "$@" "$@" printf echo echo sed "$@" $(pwd) grep then --verbose
+	grep grep && printf export done awk readonly
+printf export x=1 then cd "$@" -eu
+		then grep grep "$@" sed $(pwd) test readonly cd -eu echo ${HOME} echo -eu
+&& echo printf "$1" x=1
+	-eu "$@" readonly grep sed cd $(pwd)
+		readonly printf --verbose grep test ${HOME} printf sed echo 'quoted text' /usr/bin
+x=1 2>/dev/null x=1 ${HOME} cd awk ${HOME} readonly
+		"$1" local 'quoted text' x=1 "$@" export "$1" --verbose
+		cd local export -eu -eu test $(pwd) -eu printf && "$@" --verbose then $(pwd)
+		sed | 2>/dev/null $(pwd) --verbose $(pwd)
+| "$@" /usr/bin echo -eu | awk then 2>/dev/null
+		/usr/bin x=1 | && 2>/dev/null cd 'quoted text' 'quoted text' "$1" 2>/dev/null
+		"$@" && grep export "$1" printf && awk -eu $(pwd)
+		cd awk then -eu grep --verbose awk /usr/bin
+	then readonly x=1 printf
+		"$@" | test printf readonly | 2>/dev/null sed && && grep x=1 echo done export
+"$@" grep then awk | | then | test "$1" local sed && ${HOME} --verbose export
+"$1" x=1 export local --verbose test "$1"
+		grep export 2>/dev/null then -eu done 2>/dev/null
+		${HOME} printf echo "$1" x=1 awk && local awk ${HOME} sed && && done
+	grep readonly 'quoted text' printf -eu /usr/bin sed /usr/bin
+		cd cd local printf && printf "$1" done
+awk "$1" done sed "$@"
+--verbose local && local sed readonly $(pwd) export printf && awk
+		then -eu test /usr/bin "$@"
+	"$@" cd /usr/bin $(pwd) $(pwd) x=1 echo 2>/dev/null test "$1" && cd
+		$(pwd) readonly echo ${HOME} "$1" echo
+-eu -eu awk --verbose cd -eu test cd -eu done printf $(pwd)
+	x=1 awk printf "$1" export local then && && /usr/bin | readonly
+		then sed -eu cd "$1" echo test grep
+		x=1 && -eu --verbose /usr/bin --verbose
+&& cd test "$@" readonly awk sed then 'quoted text' --verbose cd /usr/bin
+		sed readonly grep x=1 -eu awk "$1"
+		-eu then ${HOME} "$@" export $(pwd) grep export done |
+	then test x=1 -eu "$1" --verbose sed x=1 "$1" readonly /usr/bin
+		sed printf && $(pwd) echo cd done $(pwd) 'quoted text'
+	&& /usr/bin cd readonly echo readonly test "$1" done "$1" 'quoted text'
+	grep | --verbose then local sed
+	readonly "$1" grep | $(pwd) export then local export /usr/bin /usr/bin /usr/bin
+		then cd grep ${HOME} "$1" --verbose local
+		"$@" readonly cd export -eu awk awk cd echo done export
+	awk /usr/bin export test export | printf awk then
+	export /usr/bin --verbose cd cd
+		readonly "$@" | sed "$1" --verbose /usr/bin export awk 2>/dev/null
+	| | -eu ${HOME} awk grep -eu 2>/dev/null 2>/dev/null --verbose &&
+		then x=1 cd local then
+	"$@" 2>/dev/null readonly echo /usr/bin 'quoted text' 2>/dev/null
+		"$@" "$@" export awk printf 'quoted text' "$@" 2>/dev/null
+	$(pwd) then test -eu -eu 2>/dev/null 'quoted text'
+		cd 'quoted text' then awk readonly grep local awk
+2>/dev/null $(pwd) readonly
+	printf echo $(pwd) -eu
+	cd sed --verbose 'quoted text' $(pwd) then 2>/dev/null "$@" printf
+	grep readonly test $(pwd) done readonly
+	&& then test ${HOME} echo "$1" | export "$1"
+	'quoted text' && $(pwd) grep readonly | x=1 x=1 --verbose echo grep /usr/bin
+		cd done then done test sed --verbose
+2>/dev/null /usr/bin "$@" cd 2>/dev/null x=1 $(pwd)
+		echo test test 2>/dev/null "$1" grep local
+		${HOME} /usr/bin cd sed cd "$1" grep 2>/dev/null awk | -eu readonly test
+	-eu local awk cd "$1" local awk | $(pwd) cd -eu grep
+	done export 2>/dev/null "$1" 2>/dev/null "$1" awk x=1 cd test |
+		local cd x=1 /usr/bin ${HOME} ${HOME} ${HOME} -eu ${HOME} "$@" awk && then
+	readonly export test done then 2>/dev/null
+		2>/dev/null $(pwd) echo "$1" 'quoted text' awk sed cd
+	then && cd done export local awk ${HOME} readonly
+	local cd local local echo awk sed done && --verbose export "$1" export -eu
+		/usr/bin test x=1 | --verbose test echo sed /usr/bin done awk $(pwd)
+		'quoted text' sed ${HOME} cd && grep -eu sed | printf 2>/dev/null 'quoted text'
+		grep done | test export readonly test awk && "$1" export /usr/bin printf
+| x=1 ${HOME} export -eu 2>/dev/null x=1 then -eu 2>/dev/null 2>/dev/null
+	| test x=1 "$@" /usr/bin cd 2>/dev/null --verbose awk
+	grep $(pwd) printf "$1" ${HOME} x=1 cd $(pwd) x=1 awk
+		cd ${HOME} then 2>/dev/null awk &&
+	&& $(pwd) ${HOME} x=1 export --verbose done done 2>/dev/null $(pwd)
+-eu cd | done "$1" 2>/dev/null $(pwd) cd && 'quoted text' printf
+local done ${HOME} "$1" done "$1" sed ${HOME} 'quoted text' echo then | &&
+"$@" sed printf -eu 2>/dev/null x=1 test readonly awk | /usr/bin done
+2>/dev/null awk | echo -eu 'quoted text' then printf
+		'quoted text' echo cd && -eu printf
+		done /usr/bin then printf && 2>/dev/null awk 'quoted text'
+		/usr/bin x=1 cd export /usr/bin && cd "$1" ${HOME} $(pwd)
+test | 'quoted text' ${HOME} cd done done "$1" echo /usr/bin sed done
+		2>/dev/null cd done 'quoted text' | cd 2>/dev/null $(pwd) -eu test
+		--verbose ${HOME} sed cd --verbose
+"$1" /usr/bin 'quoted text'
+		--verbose echo test awk -eu local x=1 "$1" 2>/dev/null 2>/dev/null test
+-eu awk /usr/bin cd $(pwd) | echo export
+		"$1" grep "$@" readonly export done sed | readonly then cd $(pwd) "$1" /usr/bin
+	'quoted text' echo ${HOME} sed echo sed && -eu /usr/bin
+		x=1 echo 2>/dev/null && echo printf /usr/bin cd /usr/bin awk $(pwd) "$1" ${HOME}
+'quoted text' -eu "$@"
+&& x=1 local $(pwd) echo
+		echo x=1 /usr/bin echo then printf | sed local /usr/bin test awk
+| 2>/dev/null export echo "$1" then test sed x=1 ${HOME}
+	$(pwd) | && cd printf export then
+		grep -eu then echo x=1 "$1" | $(pwd) done | ${HOME} grep x=1 awk -eu $(pwd)
+	'quoted text' export $(pwd)
+		readonly local export 2>/dev/null /usr/bin then export test
+	--verbose | /usr/bin && export && 2>/dev/null
+		printf 'quoted text' printf x=1 cd
+		$(pwd) grep export awk && ${HOME} cd && readonly then 'quoted text' readonly
+		grep readonly printf awk
+readonly $(pwd) done --verbose 'quoted text' -eu then export done 2>/dev/null sed
+		echo local done "$1" done readonly $(pwd) cd printf done
+		--verbose $(pwd) $(pwd) echo then ${HOME} /usr/bin "$1" test 'quoted text' /usr/bin
+	printf 2>/dev/null cd sed --verbose
+	cd local --verbose --verbose 'quoted text' then /usr/bin
+	local $(pwd) awk "$@" local grep --verbose
+local x=1 "$@" $(pwd) awk "$@" 2>/dev/null x=1 'quoted text' 'quoted text' readonly
+	export cd --verbose 'quoted text'
+	--verbose echo test ${HOME}
+&& 2>/dev/null export done 'quoted text' then
+done sed awk grep 2>/dev/null --verbose ${HOME} then "$1"
+	sed grep readonly echo then printf sed local 2>/dev/null -eu test done /usr/bin
+		awk readonly sed test local --verbose
+		"$@" sed then /usr/bin /usr/bin test $(pwd)
+	readonly echo done export sed "$1" done
+then readonly then "$1" -eu grep --verbose done && readonly local
+	'quoted text' readonly "$@" /usr/bin "$1" ${HOME} -eu 'quoted text'
+${HOME} test -eu $(pwd) cd local ${HOME}
+	--verbose "$@" local test grep ${HOME} x=1 local
+2>/dev/null "$1" "$@" ${HOME} && x=1 readonly awk cd awk test --verbose then 'quoted text'
+		done --verbose 2>/dev/null readonly then then --verbose
+	readonly "$1" sed x=1 sed ${HOME}
+		"$@" 2>/dev/null export
+	local then ${HOME} then awk 'quoted text' /usr/bin && printf local "$1" -eu
+export sed then && -eu local awk cd done echo test
+	done printf x=1 -eu ${HOME} x=1 awk
+-eu 'quoted text' $(pwd) && awk local 2>/dev/null && grep readonly
+		done printf echo -eu readonly test $(pwd) then then x=1 "$1"
+	-eu ${HOME} -eu x=1 export cd sed grep ${HOME} echo 'quoted text' x=1
+cd sed then readonly 2>/dev/null
+x=1 ${HOME} 'quoted text' -eu test && | done
+then awk readonly cd then readonly "$1" awk && awk
+	-eu then -eu echo "$1" "$1" local cd
+		${HOME} local done local --verbose cd cd readonly
+$(pwd) -eu 2>/dev/null $(pwd) sed | done $(pwd) grep
+	test 'quoted text' test test /usr/bin test ${HOME} "$1" awk awk test awk done echo
+	&& x=1 x=1 $(pwd) then test done | --verbose local
+		done -eu then sed $(pwd) "$1" --verbose | x=1 echo
+x=1 "$1" readonly printf then "$@" grep 'quoted text' then printf done grep ${HOME}
+-eu --verbose awk cd $(pwd) awk $(pwd) then
+		${HOME} echo 2>/dev/null sed export readonly ${HOME}
+	grep test sed printf /usr/bin printf grep 2>/dev/null sed | echo ${HOME}
+		&& | "$@" awk /usr/bin 'quoted text' local -eu awk then sed /usr/bin
+	'quoted text' done "$@" grep sed done readonly && echo 'quoted text' $(pwd) then
+awk test printf then && sed 2>/dev/null export sed awk $(pwd) "$@" sed export
+		then export sed | ${HOME} $(pwd) "$@" sed local $(pwd) "$@" 'quoted text'
+		grep $(pwd) x=1 echo local then --verbose
+		test readonly -eu x=1 grep done then 'quoted text' sed "$@" sed test
+		printf printf 'quoted text' printf --verbose test echo
+		--verbose local test sed awk -eu echo 2>/dev/null
+	echo x=1 then local && 'quoted text' x=1 done printf awk 2>/dev/null then done
+		awk 'quoted text' done 2>/dev/null x=1 awk sed 2>/dev/null /usr/bin local echo
+	$(pwd) -eu awk -eu "$@" grep
+local echo && | done readonly --verbose printf 'quoted text'
+		then 2>/dev/null readonly printf done 'quoted text' then awk -eu "$@"
+grep printf -eu && ${HOME} awk "$1" --verbose then echo awk readonly "$1"
+		| echo --verbose --verbose sed awk echo x=1 x=1 ${HOME} $(pwd) $(pwd) /usr/bin
+	echo test readonly grep awk 'quoted text' export "$1" x=1 local then awk then
+		test /usr/bin --verbose grep /usr/bin -eu -eu
+		"$1" "$1" ${HOME} 2>/dev/null $(pwd) then /usr/bin 'quoted text' "$@"
+	2>/dev/null sed printf readonly | /usr/bin ${HOME} echo export
+		&& && && then awk $(pwd) "$1" x=1 'quoted text' x=1
+		&& "$1" grep "$@" printf readonly -eu cd | awk $(pwd) "$1" -eu readonly
+	'quoted text' 'quoted text' sed local sed grep then awk
+| "$1" printf ${HOME} sed x=1 readonly ${HOME} && && -eu $(pwd) test x=1 x=1 "$1"
+awk sed -eu --verbose x=1 | 2>/dev/null done awk then grep
+	echo test $(pwd) printf grep ${HOME} printf then done echo test
+		--verbose awk test export | /usr/bin ${HOME} /usr/bin then | ${HOME} echo
+	-eu && 2>/dev/null test local test /usr/bin export
+	${HOME} ${HOME} x=1 'quoted text'
+	'quoted text' readonly readonly 'quoted text' local export awk grep grep awk
+	2>/dev/null test --verbose then
+		${HOME} && sed ${HOME} 2>/dev/null
+"$1" 2>/dev/null grep grep test
+	&& awk grep awk ${HOME} echo
+#include c252.sh
+"$1" readonly local "$1"
+		then x=1 $(pwd) | awk "$@" /usr/bin && grep then
+	readonly readonly 'quoted text'
+printf awk -eu $(pwd) awk "$@" test awk export echo
+| "$@" --verbose then then local -eu awk echo
+awk grep 2>/dev/null cd x=1 then awk awk | $(pwd)
+		awk x=1 --verbose "$1" "$1" grep sed sed $(pwd)
+		readonly $(pwd) printf $(pwd) printf $(pwd)
+	| -eu test ${HOME} then awk readonly "$@" && ${HOME} printf --verbose
+	test $(pwd) sed test x=1 sed | "$1" 2>/dev/null --verbose 'quoted text'
+&& $(pwd) then "$1" done done && export "$1" echo then then
+		test /usr/bin -eu 2>/dev/null | cd readonly x=1 awk /usr/bin
+	"$@" $(pwd) | test "$@" $(pwd) cd awk 'quoted text' done export readonly
+		"$1" grep /usr/bin grep 'quoted text' 'quoted text' done test
+	printf x=1 /usr/bin local "$1" && echo --verbose
+'quoted text' | --verbose /usr/bin
+grep local --verbose $(pwd) printf "$@" grep 2>/dev/null | x=1 grep awk && local
+	$(pwd) test /usr/bin then local grep echo sed
+		then 2>/dev/null awk && readonly x=1 awk export readonly local then cd
+test ${HOME} && && $(pwd) "$1" && 'quoted text'
+cd done grep 'quoted text' cd awk && grep
+	| 2>/dev/null && test readonly 2>/dev/null
+	readonly "$@" 'quoted text' awk 'quoted text' grep readonly
+'quoted text' | cd echo "$@"
+		sed grep 2>/dev/null "$@" grep ${HOME} cd echo "$1" | readonly 'quoted text'
+	| x=1 export 'quoted text' -eu 'quoted text' cd done x=1
+	'quoted text' "$1" --verbose printf then /usr/bin readonly --verbose --verbose
+		&& -eu | --verbose printf printf $(pwd) echo "$1" --verbose then done /usr/bin
+	readonly readonly 2>/dev/null export cd 'quoted text'
+	sed grep && echo | then "$@" --verbose sed --verbose grep "$1"
+	cd $(pwd) then "$@" sed /usr/bin --verbose --verbose -eu 2>/dev/null local
+$(pwd) awk local printf sed "$1" && /usr/bin | $(pwd)
+then printf cd local done && /usr/bin then
+readonly cd export "$@" $(pwd) awk x=1 --verbose | test
+		local readonly "$1" grep $(pwd) cd sed readonly
+	local awk --verbose printf then 2>/dev/null 'quoted text' && -eu cd
+&& cd "$1" grep x=1 --verbose local ${HOME} test local --verbose cd
+		echo test grep ${HOME} -eu && echo 2>/dev/null grep cd sed printf awk $(pwd)
+		| 'quoted text' 2>/dev/null -eu export then -eu -eu
+	export readonly "$1" echo "$1" $(pwd) sed done /usr/bin | grep local ${HOME}
+	grep 'quoted text' 'quoted text' "$1" 'quoted text' --verbose
+x=1 done readonly | -eu readonly
+		/usr/bin "$1" "$@" done cd done printf $(pwd) 'quoted text' local ${HOME}
+2>/dev/null -eu echo sed sed 'quoted text' then local test sed grep "$@" 'quoted text'
+echo test 'quoted text' cd "$@" echo readonly
+		test $(pwd) local echo
+		$(pwd) x=1 --verbose local $(pwd) | "$@" test --verbose
+--verbose awk ${HOME} test /usr/bin done x=1 printf then
+| done && grep local && printf local local grep -eu
+	sed x=1 echo echo awk then done readonly 2>/dev/null
+	-eu && readonly then $(pwd)
+local test "$@" done ${HOME} test | cd local /usr/bin awk -eu then sed
+		'quoted text' "$@" 2>/dev/null sed x=1
+	"$@" then awk echo awk readonly x=1 local 2>/dev/null
+		awk grep cd local ${HOME} "$@" echo echo test ${HOME} local sed cd --verbose
+		2>/dev/null local test | sed
+		&& --verbose && local $(pwd) | --verbose 'quoted text'
+	-eu -eu printf x=1 export awk done && $(pwd) echo test --verbose
+	--verbose readonly export /usr/bin /usr/bin /usr/bin -eu
+test echo x=1 -eu && done /usr/bin 'quoted text' then
+grep test test test -eu echo then ${HOME} --verbose cd printf done x=1
+readonly printf sed test $(pwd) printf awk test readonly export --verbose /usr/bin
+		grep "$@" /usr/bin sed && test x=1 awk
+		echo ${HOME} x=1 printf awk /usr/bin export -eu | 'quoted text' printf
+printf sed && printf | "$@" printf --verbose cd "$@" | 'quoted text' | $(pwd) ${HOME}
+	--verbose ${HOME} local then "$1" "$1" awk x=1 readonly export
+cd cd --verbose "$@" test grep --verbose grep --verbose
+export test echo "$@" x=1 echo export 2>/dev/null && 'quoted text' ${HOME}
+	"$1" done $(pwd) grep | echo 2>/dev/null
+echo ${HOME} export | 2>/dev/null 2>/dev/null
+	readonly -eu printf | done done && done local export grep | sed printf sed
+&& --verbose | $(pwd) x=1
+2>/dev/null -eu export --verbose test echo ${HOME} --verbose export && local
+	cd awk awk --verbose x=1 cd test echo echo "$1"
+	printf sed printf local ${HOME} "$@" && done printf export echo && printf
+	grep then grep x=1 --verbose 'quoted text' local --verbose
+		| awk x=1 ${HOME} echo -eu grep $(pwd) sed 2>/dev/null
+sed test test then awk | 2>/dev/null
+| export cd --verbose "$@" sed sed | ${HOME} local --verbose
+${HOME} cd $(pwd) then /usr/bin
+	| $(pwd) --verbose export
+--verbose export sed awk ${HOME} $(pwd) echo test
+	"$@" local $(pwd) done 2>/dev/null
+x=1 'quoted text' 'quoted text' -eu x=1 awk x=1 --verbose x=1 "$1" -eu /usr/bin
+-eu 'quoted text' awk | readonly test x=1 /usr/bin test cd "$1" cd export ${HOME}
+	--verbose cd awk -eu cd "$@" readonly 'quoted text'
+x=1 $(pwd) export "$1" $(pwd) done "$@"
+&& grep cd $(pwd) done
+-eu local printf readonly ${HOME} export
+		'quoted text' --verbose --verbose printf done "$@" then cd printf | export cd "$1"
+	printf x=1 "$@" $(pwd) awk cd -eu then 'quoted text'
+	2>/dev/null then ${HOME} readonly test -eu --verbose
+readonly && printf readonly | && --verbose printf -eu
+	done 2>/dev/null 2>/dev/null done
+		$(pwd) 2>/dev/null 'quoted text' readonly
+	-eu /usr/bin && test then 2>/dev/null | printf grep "$1"
+echo x=1 'quoted text'
+		echo sed --verbose ${HOME} | x=1 $(pwd) "$@" "$1" && $(pwd)
+		test | 'quoted text' grep done 2>/dev/null && "$@" -eu && $(pwd) "$1" x=1 then
+${HOME} readonly && test | 2>/dev/null export "$@"
+	2>/dev/null /usr/bin "$1" && --verbose sed awk | echo grep ${HOME}
+		-eu grep | "$1" "$1" -eu $(pwd) echo awk "$@"
+	$(pwd) 'quoted text' $(pwd) && "$@" x=1 awk 'quoted text'
+		export 'quoted text' done done done readonly "$@"
+	$(pwd) cd grep sed printf sed "$1" export ${HOME} && cd local export $(pwd)
+	done printf | 'quoted text' echo sed | sed ${HOME} | $(pwd) local sed local
+echo 2>/dev/null -eu local
+	readonly export --verbose sed
+	&& | grep /usr/bin awk /usr/bin done then done -eu "$1" grep echo -eu "$@"
+	cd "$1" test "$1" -eu done /usr/bin 'quoted text' ${HOME} cd
+"$1" --verbose done done readonly test done 'quoted text'
+-eu cd --verbose "$@" done 2>/dev/null export 2>/dev/null echo
+"$1" /usr/bin cd /usr/bin x=1 $(pwd) readonly then /usr/bin echo && 2>/dev/null
+	awk then && awk local export readonly
+		export "$@" x=1 done x=1 sed printf sed printf grep test ${HOME}
+		done cd && x=1 /usr/bin --verbose
+	done "$1" grep echo test
+x=1 then local done done then -eu readonly
+		&& 'quoted text' test "$1" --verbose 'quoted text' && test export
+		${HOME} grep grep done cd printf done /usr/bin awk grep
+done export && cd ${HOME}
+done echo "$1" cd "$@" /usr/bin awk "$1" 2>/dev/null -eu echo local
+	-eu 'quoted text' x=1 && -eu $(pwd) /usr/bin awk sed /usr/bin test --verbose
+		| sed "$@" && $(pwd) ${HOME}
+2>/dev/null grep echo readonly local x=1 ${HOME} -eu grep "$@" $(pwd) cd
+	test readonly test local x=1 export export | awk /usr/bin then "$1"
+		&& done cd readonly 'quoted text'
+		| 'quoted text' sed "$@"
+'quoted text' 2>/dev/null
+2>/dev/null cd echo then /usr/bin grep /usr/bin x=1 readonly
+		&& cd then test cd && test ${HOME}
+	$(pwd) x=1 2>/dev/null | |
+	| && --verbose export ${HOME} 2>/dev/null test | grep awk 'quoted text' x=1
+	/usr/bin 2>/dev/null && "$@" && | done 'quoted text'
+		&& done $(pwd) 2>/dev/null grep
+"$1" $(pwd) -eu 'quoted text'
+local $(pwd) printf && echo sed readonly test sed printf
+"$1" "$@" -eu export echo grep printf
+		cd readonly export --verbose cd && done done "$1" /usr/bin readonly "$@" "$@"
+		cd x=1 echo printf | then -eu "$@" /usr/bin x=1 export echo
+		'quoted text' --verbose then |
+	-eu -eu awk echo done export -eu && $(pwd) --verbose then "$@"
+readonly then local printf x=1 export 'quoted text' /usr/bin "$@" local $(pwd)
+sed cd readonly grep echo test 'quoted text' 2>/dev/null x=1 then 'quoted text'
+		printf --verbose x=1 echo "$1" echo 2>/dev/null | cd local --verbose
+then && sed $(pwd) export 'quoted text' local -eu export $(pwd) -eu done
+		echo --verbose sed x=1 cd $(pwd) test "$1" && local sed 2>/dev/null printf
+		printf awk printf ${HOME} 2>/dev/null
+	then "$1" local 2>/dev/null
+		test x=1 grep local 'quoted text' local readonly grep export $(pwd) && -eu readonly
+/usr/bin "$@" local $(pwd) cd --verbose -eu 2>/dev/null
+$(pwd) $(pwd) awk --verbose --verbose $(pwd) $(pwd) printf 2>/dev/null
+		"$@" readonly echo awk cd
+-eu done && printf test -eu local -eu printf grep "$@" then $(pwd) "$1"
+	/usr/bin $(pwd) "$1" done readonly -eu 'quoted text' $(pwd) "$1" readonly export
+	| done local local && -eu 'quoted text' grep x=1 printf | done local
+	export "$@" sed 'quoted text' "$@"
+		grep then /usr/bin grep awk export sed awk "$1" 'quoted text'
+		x=1 2>/dev/null then "$1" $(pwd) | grep 2>/dev/null grep export
+	/usr/bin ${HOME} "$@" --verbose grep done sed
+		| ${HOME} /usr/bin ${HOME} $(pwd) /usr/bin cd local sed | "$@" 'quoted text' 2>/dev/null
+	local 'quoted text' 'quoted text'
+	$(pwd) x=1 then local && test --verbose
+	grep awk done ${HOME} "$1" -eu awk --verbose grep
+	then awk export sed "$@" readonly 2>/dev/null
+	| -eu export local then 'quoted text' local ${HOME} --verbose
+	awk local test "$1" test readonly 'quoted text' then $(pwd) -eu done awk
+	$(pwd) $(pwd) awk then /usr/bin grep cd "$1" ${HOME} local awk --verbose done
+		${HOME} readonly cd 2>/dev/null
+		'quoted text' x=1 printf then "$1" "$@"
+$(pwd) --verbose $(pwd) ${HOME} printf -eu /usr/bin "$1" grep 2>/dev/null "$1"
+	echo echo -eu --verbose ${HOME}
+	"$@" /usr/bin | then cd ${HOME} 'quoted text'
+		done --verbose --verbose -eu test cd readonly awk /usr/bin 2>/dev/null
+done -eu && "$@" cd --verbose local sed export
+	"$1" /usr/bin then 'quoted text' done local 'quoted text'
+	echo "$1" "$@" /usr/bin printf "$1" --verbose 2>/dev/null
+		&& sed 'quoted text' sed printf local printf then ${HOME} local
+cd cd 'quoted text' ${HOME} ${HOME} 2>/dev/null --verbose cd -eu then
+		awk printf local cd "$1" 'quoted text' printf cd && x=1 $(pwd) export
+	echo then 2>/dev/null "$1" /usr/bin -eu test $(pwd) printf ${HOME}
+"$1" -eu -eu export 'quoted text' "$1" cd sed --verbose readonly awk && cd local
+/usr/bin 2>/dev/null test
+cd && -eu /usr/bin "$@" | | "$@"
+		cd x=1 test && grep 'quoted text'
+		export export test export export local grep test cd 'quoted text' 'quoted text'
+		readonly readonly grep readonly test
+printf ${HOME} /usr/bin printf /usr/bin 2>/dev/null 2>/dev/null echo sed
+	$(pwd) done local /usr/bin grep sed $(pwd)
+		x=1 2>/dev/null grep && /usr/bin printf printf test
+	done readonly echo x=1 && "$1" grep -eu --verbose
+'quoted text' awk ${HOME} && local 'quoted text' echo "$1" ${HOME} readonly
+	| $(pwd) 'quoted text'
+-eu readonly "$1" /usr/bin
+		| /usr/bin readonly then "$1" echo sed $(pwd) x=1 grep
+		local "$1" cd test "$1" $(pwd) "$@" printf export 2>/dev/null
+	--verbose cd awk export x=1 ${HOME} && local readonly x=1 2>/dev/null /usr/bin
+	readonly x=1 'quoted text' "$1" readonly "$1" local | echo
+sed grep sed done && -eu 'quoted text' -eu then /usr/bin
+		/usr/bin /usr/bin ${HOME} && sed "$1" --verbose
+	test printf readonly $(pwd) done done "$@" x=1 -eu /usr/bin test --verbose --verbose
+sed $(pwd) "$@" ${HOME} 'quoted text' x=1 "$1" -eu $(pwd) awk 2>/dev/null
+		printf sed $(pwd) echo readonly test "$@" ${HOME} readonly cd &&
+		sed test $(pwd) cd echo echo 'quoted text' printf | "$@" /usr/bin
+		sed --verbose test grep
+		test readonly local --verbose --verbose test /usr/bin
+	--verbose 2>/dev/null grep test export export "$@"
+	cd cd test test "$1" cd "$1" readonly readonly test
+		$(pwd) local 2>/dev/null done $(pwd) "$1" 'quoted text' export /usr/bin | printf
+		done grep 'quoted text' x=1 sed 'quoted text' export echo awk grep ${HOME} /usr/bin
+echo $(pwd) "$1" grep then 2>/dev/null done -eu printf printf ${HOME} local
+done readonly sed 'quoted text' sed then
+	-eu export done printf sed x=1 local x=1 sed cd
+	done sed sed | then cd --verbose ${HOME} -eu grep
+		$(pwd) export "$1" -eu cd "$@" -eu cd 2>/dev/null 'quoted text'
+-eu && echo cd --verbose
+-eu printf $(pwd) --verbose awk grep | $(pwd) printf "$1" --verbose
+	/usr/bin 'quoted text' cd awk then 2>/dev/null readonly
+awk echo sed export export 2>/dev/null $(pwd) local
+then awk "$@" sed echo awk
+grep done cd -eu --verbose awk -eu readonly test |
+	--verbose grep printf grep ${HOME} test export --verbose local --verbose
+		x=1 --verbose | "$1" | sed $(pwd) awk 2>/dev/null 'quoted text'
+2>/dev/null "$1" x=1 /usr/bin 'quoted text' 'quoted text' sed local echo
+		"$@" export /usr/bin -eu
+	readonly awk done awk "$1" | "$1" | printf awk
+		awk $(pwd) echo export /usr/bin
+	grep x=1 grep $(pwd) 2>/dev/null 'quoted text' /usr/bin
+	&& then done "$@" 2>/dev/null echo ${HOME} -eu "$@" test $(pwd)
+	local 2>/dev/null x=1 "$@" --verbose -eu -eu echo 'quoted text'
+sed --verbose x=1 printf "$@" "$1" printf
+local -eu $(pwd) awk printf local grep awk /usr/bin --verbose awk /usr/bin
+	cd test ${HOME} cd sed -eu then
+	export done 'quoted text' echo done cd $(pwd) "$@" &&
+/usr/bin -eu test && test --verbose ${HOME} test export awk 2>/dev/null
+		export readonly sed printf 'quoted text'
+		"$1" "$@" "$1" done export && 2>/dev/null /usr/bin grep | local /usr/bin
+then 2>/dev/null readonly x=1 "$1" done "$@"
+	sed --verbose $(pwd) "$@" && grep then awk grep "$1" $(pwd) local -eu sed awk sed
+export sed --verbose readonly printf export ${HOME} /usr/bin "$1"
+		$(pwd) grep 'quoted text' echo 2>/dev/null
+$(pwd) /usr/bin && local "$1" cd then awk | |
+		cd $(pwd) $(pwd) ${HOME} then "$@" && done
+		/usr/bin awk export echo readonly --verbose /usr/bin awk 'quoted text' then
+	sed 'quoted text' x=1 --verbose test sed export "$@" | ${HOME} 'quoted text'
+	$(pwd) x=1 -eu printf printf export $(pwd) "$@" $(pwd) done -eu export test
+test | sed | sed done x=1 &&
+test then test test cd local && echo sed cd
+	x=1 --verbose 'quoted text' grep --verbose 2>/dev/null --verbose readonly grep
+"$@" 'quoted text' echo export x=1 'quoted text' awk
+	export --verbose --verbose --verbose test export $(pwd) --verbose printf x=1 $(pwd)
+	test "$@" -eu --verbose local x=1 then | cd "$@" "$@"
+| local awk | readonly
+	/usr/bin ${HOME} 2>/dev/null printf export $(pwd) grep cd then grep
+	test ${HOME} local local then done readonly test local sed test cd done | 2>/dev/null
+		--verbose x=1 "$@" cd "$1" -eu &&
+cd cd awk awk cd export
+		"$@" -eu echo printf cd cd then 2>/dev/null awk "$1" 'quoted text'
+		-eu echo cd --verbose -eu echo
+	test sed 2>/dev/null done test export readonly 2>/dev/null $(pwd) 'quoted text'
+awk "$1" 'quoted text' 'quoted text' -eu done 2>/dev/null local
+	done "$@" && x=1 -eu sed | | test done | grep export --verbose
+-eu readonly sed then done echo done && | x=1
+		'quoted text' 'quoted text' ${HOME} -eu /usr/bin
+		x=1 grep "$1" $(pwd) cd "$@" -eu local done local done
+	"$@" "$@" sed then | x=1 export ${HOME} && 2>/dev/null 2>/dev/null export
+sed 'quoted text' grep -eu grep echo
+2>/dev/null 'quoted text' readonly
+	--verbose "$1" && "$@" then done echo local
+		grep sed && grep echo echo /usr/bin /usr/bin
+		"$@" | && | local grep then -eu awk awk local && ${HOME} | "$@" "$1" --verbose "$1"
+	x=1 printf export then grep awk $(pwd)
+	"$@" "$@" $(pwd) $(pwd) --verbose grep
+	echo export --verbose export awk cd cd | |
+"$1" export -eu sed cd test local then --verbose grep
+	| awk export readonly $(pwd) "$@" local
+done "$@" $(pwd) /usr/bin "$@" $(pwd)
+echo "$@" echo ${HOME} done
+		test cd then awk $(pwd) awk local awk cd 2>/dev/null "$@"
+		-eu sed readonly "$@" grep --verbose test "$1" ${HOME} 2>/dev/null $(pwd) |
+-eu 'quoted text' && then /usr/bin local cd --verbose --verbose
+$(pwd) done /usr/bin awk cd -eu cd done
+readonly grep | printf awk x=1 echo 'quoted text' sed cd
+		x=1 then ${HOME} export | awk /usr/bin | printf then then then --verbose
+	sed then ${HOME} "$1" 'quoted text'
+then echo --verbose export
+	'quoted text' /usr/bin sed | awk 2>/dev/null
+	awk ${HOME} ${HOME} -eu local export cd readonly "$1" | cd ${HOME} x=1
+echo test 'quoted text' $(pwd)
+	grep grep ${HOME} readonly x=1 "$1" 2>/dev/null
+		awk "$@" done grep readonly 'quoted text'
+	sed done printf "$@" cd cd ${HOME} 'quoted text' | done printf $(pwd) done $(pwd)
+		test $(pwd) && awk cd printf awk awk -eu test
+		--verbose readonly "$1" then 2>/dev/null
+	-eu then 2>/dev/null awk && local "$@" done done 2>/dev/null
+		x=1 $(pwd) -eu && /usr/bin 2>/dev/null ${HOME} x=1 "$1" ${HOME} grep
+		done x=1 x=1 -eu echo ${HOME} then cd 2>/dev/null
+		'quoted text' ${HOME} test x=1 -eu ${HOME} cd --verbose cd -eu local 'quoted text'
+		${HOME} local export -eu export readonly "$@" grep done ${HOME} 2>/dev/null done
+		--verbose /usr/bin export cd readonly --verbose
+	| -eu awk awk "$@" readonly awk
+--verbose printf "$1" $(pwd) 'quoted text' "$1" ${HOME} 'quoted text' 'quoted text'
+		readonly -eu "$@" "$1" readonly sed && grep /usr/bin local /usr/bin
+	then export 'quoted text' printf local ${HOME} -eu /usr/bin cd done
+readonly 2>/dev/null | x=1 -eu /usr/bin 2>/dev/null local ${HOME}
+local 2>/dev/null /usr/bin $(pwd) then grep "$@" && export printf cd
+local $(pwd) -eu -eu test awk printf
+	echo sed echo then /usr/bin echo -eu "$@"
+		then $(pwd) 2>/dev/null ${HOME}
+		"$@" "$1" echo 2>/dev/null 2>/dev/null /usr/bin 'quoted text' then
+	readonly /usr/bin readonly x=1 export -eu test cd x=1 /usr/bin
+test local "$@" local | test readonly sed
+		${HOME} "$1" -eu then 2>/dev/null $(pwd) readonly cd
+	"$1" | "$1" awk && x=1 awk sed 'quoted text' cd printf
+awk "$@" "$@" 2>/dev/null "$@" sed grep then 'quoted text'
+export cd sed grep then grep cd /usr/bin "$1" 'quoted text' -eu x=1 && cd awk /usr/bin
+		${HOME} echo --verbose printf test 2>/dev/null test
+	x=1 readonly x=1 done 'quoted text' $(pwd) && && cd then "$@" "$1" echo local
+		awk printf --verbose printf printf awk echo echo | done
+		echo 2>/dev/null cd grep export readonly sed "$1" echo 'quoted text' "$1"
+	2>/dev/null printf $(pwd)
+--verbose "$1" | echo export cd | local 2>/dev/null echo printf "$1"
+		done --verbose "$1" "$1" cd && 'quoted text' test
+	echo -eu readonly grep export printf
+	test echo cd $(pwd) "$1" readonly ${HOME} awk done -eu then
+		then ${HOME} grep "$1" ${HOME} "$1" |
+	sed x=1 && awk export && && grep local 'quoted text' 'quoted text'
+| test then ${HOME} "$1" $(pwd) readonly --verbose local && cd "$@" sed
+/usr/bin "$@" then --verbose echo "$1" test && echo local export "$1"
+local test 'quoted text' | -eu -eu | $(pwd) echo x=1 done awk "$@" sed awk local
+		printf $(pwd) done ${HOME} -eu then $(pwd) --verbose test done "$@"
+		--verbose awk x=1 x=1 "$1" $(pwd) printf readonly -eu $(pwd) ${HOME}
+		$(pwd) x=1 | | done cd done && x=1 export export
+echo cd cd test printf --verbose "$@"
+	local -eu export test -eu test $(pwd) awk
+	readonly --verbose sed grep
+| test done x=1 ${HOME} x=1 && ${HOME} ${HOME}
+	cd cd $(pwd) ${HOME} grep then $(pwd) && grep grep
+	$(pwd) printf cd 2>/dev/null
+		sed printf readonly echo /usr/bin test printf 2>/dev/null | export grep then
+		printf && "$1" 'quoted text' ${HOME} local then
+grep awk local $(pwd) test 2>/dev/null test done --verbose printf -eu "$1" 2>/dev/null
+	| ${HOME} done grep 2>/dev/null local "$@"
+$(pwd) "$1" "$1" test -eu local grep
+-eu test "$@" awk $(pwd) awk cd "$@" done printf awk local printf -eu local
+	'quoted text' cd printf echo readonly -eu && export "$1" | cd 'quoted text'
+	x=1 x=1 "$@" printf 2>/dev/null local
+cd printf sed awk then grep readonly x=1 sed
+	echo ${HOME} ${HOME} "$1" local echo test done readonly local grep grep
+	'quoted text' cd /usr/bin test test --verbose ${HOME} test 'quoted text' grep
+		$(pwd) export -eu "$1" && 'quoted text' -eu ${HOME} && test "$1"
+		$(pwd) $(pwd) 'quoted text' x=1 | readonly done |
+	then test printf grep 2>/dev/null
+	readonly local ${HOME} echo ${HOME} "$@"
+grep export /usr/bin | echo echo --verbose cd
+		done $(pwd) ${HOME} export
+		'quoted text' cd export "$1" 'quoted text'
+	"$1" sed echo export "$1" -eu
+x=1 "$1" echo -eu sed awk grep
+		then "$1" ${HOME} export && sed 'quoted text'
+		/usr/bin ${HOME} sed grep printf grep 'quoted text' done then cd readonly && readonly
+	cd printf 2>/dev/null -eu | done awk
+test | export 2>/dev/null echo local --verbose printf echo printf
+		printf "$@" "$@" done cd x=1 $(pwd) sed test 2>/dev/null
+"$1" then --verbose export then "$1" cd done ${HOME} | "$1"
+		"$1" then local "$1" && then readonly && echo printf printf printf -eu
+	--verbose "$1" 2>/dev/null local sed
+	test cd done -eu | test "$1"
+	/usr/bin $(pwd) printf 2>/dev/null
+	awk -eu cd printf then /usr/bin x=1 printf echo grep readonly done $(pwd) && |
+2>/dev/null && sed export && sed
+	--verbose --verbose --verbose cd export printf | --verbose --verbose $(pwd)
+	"$@" cd grep grep then done ${HOME} export echo | ${HOME} export
+then && grep grep awk echo -eu cd 2>/dev/null sed grep -eu /usr/bin
+		&& 'quoted text' test $(pwd) x=1 /usr/bin ${HOME} local cd &&
+$(pwd) 2>/dev/null grep done then -eu
+		x=1 /usr/bin then ${HOME} | readonly readonly 2>/dev/null
+'quoted text' | ${HOME} cd then sed local echo cd local 'quoted text' test then
+	sed $(pwd) x=1 grep sed printf -eu printf && -eu -eu readonly readonly
+	printf export && echo printf printf
+		--verbose test done local | echo x=1 test test printf test
+&& 2>/dev/null echo "$1" /usr/bin echo x=1 --verbose
+	${HOME} done readonly grep $(pwd) local | 'quoted text' -eu 'quoted text' ${HOME}
+		'quoted text' 'quoted text' 'quoted text' "$1" grep | test
+	"$1" -eu 2>/dev/null ${HOME} | awk done echo export
+		'quoted text' grep then $(pwd) readonly
+		"$@" $(pwd) awk "$@" done test
+	sed echo ${HOME} done $(pwd) awk printf /usr/bin cd ${HOME} x=1 x=1 sed local x=1
+	/usr/bin "$@" export "$@" x=1 readonly readonly
+	'quoted text' sed 'quoted text'
+	printf echo readonly printf -eu "$@" /usr/bin
+		x=1 | | grep readonly readonly done /usr/bin
+grep x=1 $(pwd) sed local x=1 "$1" ${HOME} /usr/bin grep printf printf
+		cd 'quoted text' awk && x=1 echo --verbose export then | 'quoted text'
+		'quoted text' cd cd export "$@" done local | export
+		done ${HOME} export test grep 'quoted text' echo printf | export done $(pwd)
+		test ${HOME} then awk ${HOME} local done test x=1 $(pwd) cd x=1
+'quoted text' x=1 cd -eu "$1" grep printf echo
+	sed "$1" $(pwd) local
+		/usr/bin grep then then cd readonly -eu
+$(pwd) cd printf awk ${HOME} test grep -eu done
+	"$@" | echo x=1 export ${HOME} --verbose
+-eu export test | test | --verbose awk && ${HOME}
+	--verbose printf 2>/dev/null cd echo | echo --verbose
+	$(pwd) $(pwd) x=1 test done
+		2>/dev/null 'quoted text' awk x=1 test test export "$1" cd grep awk
+	/usr/bin && done awk 'quoted text' ${HOME} /usr/bin grep x=1 readonly
+	done export then sed printf sed done 'quoted text' then && test test test
+	printf grep x=1 'quoted text' $(pwd) sed | | "$1" | export x=1 2>/dev/null
+&& awk awk $(pwd) "$@"
+	then grep "$1" x=1 test $(pwd) local -eu
+		x=1 readonly sed test --verbose local export
+		2>/dev/null test export local && sed --verbose echo $(pwd) export -eu
+		test local test --verbose $(pwd) --verbose
+		printf local local local export $(pwd) ${HOME} export ${HOME} printf 2>/dev/null
+sed "$1" "$1" "$@" && | -eu "$1" ${HOME} 'quoted text' /usr/bin
+	test awk local 'quoted text' done local ${HOME}
+	done done x=1 ${HOME} "$1" --verbose export echo 'quoted text' test | x=1
+	grep 2>/dev/null local then | x=1 --verbose | echo $(pwd) | | awk "$@" -eu 'quoted text'
+	/usr/bin echo $(pwd) /usr/bin
+	/usr/bin -eu $(pwd) x=1 x=1 echo x=1 "$1"
+&& $(pwd) --verbose export
+		'quoted text' -eu --verbose --verbose grep local cd x=1 "$@" grep then
+		x=1 --verbose local awk sed "$@" && "$@" 'quoted text' printf
+		echo readonly x=1 sed local printf "$@" 'quoted text' done 2>/dev/null printf
+		-eu awk 2>/dev/null 2>/dev/null ${HOME} && -eu cd $(pwd) x=1 echo
+	export ${HOME} test "$@" 2>/dev/null ${HOME} "$@" awk printf "$@"
+	2>/dev/null export local "$1" cd printf test readonly x=1 printf
+	readonly && -eu "$1" awk -eu echo "$@"
+		local "$@" grep x=1 sed readonly grep 'quoted text' awk sed 'quoted text'
+/usr/bin && "$@" --verbose printf then awk
+		&& cd "$1" echo then awk 2>/dev/null sed "$@"
+	"$@" readonly test grep -eu ${HOME} awk x=1 /usr/bin cd done
+	/usr/bin readonly x=1 cd -eu
+		--verbose grep echo /usr/bin
+	x=1 "$1" /usr/bin "$@" x=1 ${HOME}
+		sed test grep "$1" test | then echo echo
+	${HOME} -eu done x=1 -eu printf then sed echo test sed --verbose
+		then 'quoted text' readonly cd --verbose | cd awk -eu && sed export
+		export local "$1" export local -eu test cd awk sed && x=1 sed 'quoted text'
+test 2>/dev/null test readonly readonly test && --verbose awk export --verbose
+	| && | sed 2>/dev/null export cd echo | -eu printf export readonly
+		${HOME} readonly echo /usr/bin && 'quoted text' then -eu "$1" $(pwd)
+	cd echo 'quoted text' awk ${HOME} x=1 echo then 'quoted text' && "$@" "$1" awk
+	$(pwd) -eu --verbose /usr/bin awk
+		export "$1" local x=1 readonly printf cd printf 'quoted text'
+		&& awk | 'quoted text' export --verbose && x=1
+$(pwd) readonly test $(pwd) readonly sed $(pwd) ${HOME} -eu -eu
+$(pwd) done "$1" /usr/bin $(pwd) awk local ${HOME} -eu readonly cd
+'quoted text' export export cd export && /usr/bin
+| sed done awk sed then local readonly test done
+		grep 2>/dev/null "$@" /usr/bin /usr/bin grep done /usr/bin
+readonly echo ${HOME} /usr/bin "$@" then ${HOME}
+	echo then x=1 x=1 then x=1
+printf done sed $(pwd) -eu echo export
+	| test $(pwd) /usr/bin /usr/bin test x=1
+x=1 $(pwd) 2>/dev/null echo | local cd grep done /usr/bin 2>/dev/null
+		sed done test && $(pwd) "$@" ${HOME}
+--verbose 'quoted text' test grep test
+/usr/bin | done "$1" ${HOME} awk sed | cd
+	"$1" sed export awk | test | "$1" 2>/dev/null export done "$1" $(pwd) grep
+		test -eu /usr/bin $(pwd) 'quoted text'
+	printf then grep | -eu test ${HOME} $(pwd) x=1 | -eu -eu
+	readonly grep -eu 'quoted text' 2>/dev/null echo export /usr/bin export
+local local export awk $(pwd) 2>/dev/null grep readonly
+		--verbose printf "$@" 2>/dev/null ${HOME}
+	${HOME} "$1" $(pwd) "$1" --verbose readonly
+readonly sed awk 2>/dev/null ${HOME} 'quoted text'
+	"$@" cd "$@" --verbose then -eu readonly
+	$(pwd) 'quoted text' x=1 x=1 echo echo /usr/bin -eu ${HOME} 2>/dev/null
+-eu done 'quoted text' then local done && "$1" 'quoted text' awk awk then /usr/bin
+	"$@" export "$1" -eu x=1 --verbose awk --verbose ${HOME} | && awk
+	&& test -eu 'quoted text' readonly
+		/usr/bin local echo echo sed test sed --verbose
+grep --verbose grep "$@" "$@" local export
+done ${HOME} 2>/dev/null $(pwd) awk
+	sed done printf $(pwd) then awk test ${HOME} x=1 then -eu 2>/dev/null awk cd
+${HOME} cd cd export export 2>/dev/null
+export sed "$@" x=1 echo | ${HOME} cd 'quoted text' local local local awk awk
+test "$1" && 'quoted text' $(pwd) then cd ${HOME} readonly x=1 x=1 -eu && --verbose
+		$(pwd) test awk /usr/bin 'quoted text'
+		echo printf readonly local "$1" x=1 2>/dev/null export
+printf then $(pwd) printf done
+	cd test done 'quoted text' done export && 'quoted text' local "$@" printf -eu
+x=1 -eu x=1 export -eu -eu readonly export --verbose
+	-eu local done test test
+	"$@" then | test $(pwd) 2>/dev/null ${HOME} "$1" readonly "$1" ${HOME} local
+		| 2>/dev/null then done test "$1" /usr/bin /usr/bin
+		| cd done then cd ${HOME} readonly then 2>/dev/null -eu -eu "$@" local
+		awk test cd "$1" export done printf readonly done -eu cd 'quoted text'
+"$@" echo "$@" grep "$@" export --verbose awk 'quoted text' cd && grep
+		then 'quoted text' done "$@" && "$1" && awk done ${HOME} "$@" done
+done "$@" printf /usr/bin | printf echo --verbose "$@" | echo "$@" done readonly
+	"$1" --verbose "$1" 'quoted text'
+	/usr/bin test $(pwd) x=1 echo &&
+		-eu echo --verbose readonly readonly done grep
+		--verbose ${HOME} ${HOME} echo $(pwd) local then sed
+		"$1" done then && -eu then local
+	then x=1 $(pwd) "$1" 2>/dev/null 2>/dev/null "$1" done 2>/dev/null "$1" sed | |
+		'quoted text' cd awk "$1" /usr/bin 'quoted text' test done test sed | x=1 $(pwd)
+	'quoted text' sed printf --verbose then test && printf 'quoted text'
+		-eu 2>/dev/null test |
+		${HOME} echo test grep awk && done ${HOME} | $(pwd) 'quoted text' readonly
+		test 2>/dev/null printf done echo grep | /usr/bin then
+	done sed readonly grep x=1 x=1 2>/dev/null ${HOME} "$1" export readonly "$1"
+printf 'quoted text'
+		echo then sed -eu sed x=1 ${HOME}
+	readonly export test x=1 sed 'quoted text' && /usr/bin
+		readonly x=1 cd | echo $(pwd) /usr/bin -eu done local
+		'quoted text' "$@" | ${HOME} awk 2>/dev/null | done ${HOME} | && --verbose
+	awk printf --verbose x=1 echo --verbose test && then printf
+	readonly && test | -eu --verbose awk | done --verbose "$@" awk -eu echo sed
+	/usr/bin cd sed done sed test "$1" 'quoted text' ${HOME} local x=1 "$1"
+| grep sed readonly awk 2>/dev/null then cd then sed "$1" /usr/bin
+$(pwd) 2>/dev/null --verbose readonly done readonly "$1" 2>/dev/null export grep
+--verbose 2>/dev/null 'quoted text' test | echo cd
+	cd "$1" "$1" local /usr/bin
+		done test "$1" sed "$@" x=1 export
+--verbose test $(pwd) ${HOME} sed done readonly export 2>/dev/null
+2>/dev/null "$@" local $(pwd) sed readonly 'quoted text' readonly
+	"$@" awk /usr/bin done $(pwd)
+		"$@" awk cd "$1" export then /usr/bin grep x=1 && cd -eu && ${HOME} && printf
+test ${HOME} -eu x=1 && export "$1" sed x=1 /usr/bin
+	sed 'quoted text' cd sed echo cd export local
+		${HOME} && test | $(pwd) 'quoted text' && --verbose 'quoted text' done
+x=1 ${HOME} | /usr/bin awk 'quoted text'
+	readonly readonly ${HOME} awk test
+		then printf $(pwd) export readonly
+		| 'quoted text' local x=1 readonly readonly readonly 'quoted text' then x=1 printf
+	&& $(pwd) -eu export "$1" 2>/dev/null $(pwd) cd "$@"
+	$(pwd) echo /usr/bin ${HOME} export sed --verbose
+"$@" --verbose awk done 2>/dev/null -eu cd ${HOME} then x=1 export sed
+		--verbose 2>/dev/null | readonly "$1" "$@" /usr/bin --verbose cd cd echo
+	$(pwd) "$1" export readonly --verbose test /usr/bin
+	cd readonly /usr/bin --verbose export | local "$@" grep
+		2>/dev/null awk local readonly readonly grep --verbose done "$@"
+		cd 2>/dev/null export printf
+done --verbose --verbose 'quoted text' echo sed /usr/bin "$1"
+		--verbose x=1 export then local done | | test /usr/bin && /usr/bin
+		test --verbose printf && local "$@" -eu done $(pwd) "$1" $(pwd) grep
+test test -eu awk awk && ${HOME} cd cd local export export done awk readonly "$1"
+${HOME} 2>/dev/null && ${HOME} 2>/dev/null local test | "$1" sed done
+		'quoted text' /usr/bin --verbose "$1" --verbose
+$(pwd) awk then readonly --verbose sed /usr/bin echo ${HOME}
+	x=1 export test grep | 'quoted text'
+	"$@" test ${HOME} awk printf |
+echo grep ${HOME} "$1" grep done local then /usr/bin
+		/usr/bin cd /usr/bin then test done grep
+test sed awk ${HOME} readonly local 2>/dev/null test "$@"
+		export --verbose grep /usr/bin
+		export then local "$1" sed cd && /usr/bin done /usr/bin
+	local "$@" grep "$1" "$@" "$@" echo export --verbose -eu --verbose 2>/dev/null
+		grep echo $(pwd) 2>/dev/null echo
+	${HOME} printf grep grep 'quoted text' ${HOME} /usr/bin
+	"$@" awk then -eu -eu x=1 echo
+&& printf && grep echo 'quoted text' && grep "$@" | test
+echo $(pwd) && sed "$@"
+	${HOME} export then test awk cd awk $(pwd) $(pwd) /usr/bin -eu "$1" "$@"
+		cd 'quoted text' $(pwd) grep | $(pwd) 2>/dev/null /usr/bin "$@"
+	${HOME} && then local "$1" 'quoted text' 'quoted text' -eu export export
+		x=1 2>/dev/null sed "$@"
+		sed echo /usr/bin cd test export 2>/dev/null test -eu "$1" "$@" local sed $(pwd)
+export 2>/dev/null --verbose "$@" done | | /usr/bin export
+		-eu ${HOME} done -eu -eu export export 'quoted text' cd "$@" && && export 2>/dev/null
+		"$1" grep awk readonly awk "$1" "$@" ${HOME} done "$1" readonly
+		x=1 /usr/bin sed --verbose
+export done "$1" test export done export echo ${HOME} "$1"
+		done x=1 2>/dev/null "$1" | --verbose 'quoted text'
+	echo echo export cd printf
+cd && readonly -eu cd local local test grep "$1" /usr/bin awk --verbose done done
+		2>/dev/null "$@" local printf x=1 /usr/bin
+	"$@" echo --verbose x=1 /usr/bin --verbose test
+	$(pwd) local printf printf ${HOME} grep
+	-eu --verbose 2>/dev/null "$1" sed local done
+		test grep awk $(pwd) ${HOME} -eu readonly "$@" $(pwd) done
+done test ${HOME} --verbose local grep 'quoted text' test "$1" && -eu ${HOME}
+	readonly "$@" x=1 grep 2>/dev/null
+	"$@" ${HOME} | 2>/dev/null $(pwd) ${HOME} sed grep sed awk -eu x=1 sed
+		${HOME} sed test readonly awk export ${HOME} export cd | test ${HOME} test
+		test ${HOME} --verbose /usr/bin --verbose grep "$1" printf cd echo x=1 awk ${HOME}
+cd printf test then done sed && readonly export "$1" awk |
+		done 2>/dev/null && sed done echo /usr/bin sed ${HOME}
+	"$@" readonly -eu x=1 'quoted text' awk awk "$@"
+test cd -eu printf 2>/dev/null grep grep /usr/bin export
+test local $(pwd) && $(pwd) sed
+		-eu $(pwd) && && grep x=1 | done done local 'quoted text' /usr/bin
+		2>/dev/null "$@" then ${HOME} then sed printf 2>/dev/null x=1 -eu awk grep "$@"
+	then $(pwd) echo -eu grep test | --verbose test $(pwd)
+		readonly then test printf test export | -eu awk --verbose $(pwd)
+${HOME} x=1 --verbose 2>/dev/null
+$(pwd) 'quoted text' --verbose local grep test
+	-eu echo test grep printf awk test echo
+--verbose readonly grep /usr/bin sed local readonly grep /usr/bin 'quoted text'
+	${HOME} echo /usr/bin grep ${HOME} grep "$@" ${HOME}
+		printf sed $(pwd) x=1 | printf done echo "$@" export
+		test printf printf --verbose $(pwd) x=1 'quoted text' grep readonly printf
+	printf export then -eu && awk 'quoted text' local readonly /usr/bin && done
+	done | | then "$@" $(pwd) done -eu printf 2>/dev/null
+| cd "$1" $(pwd) printf echo export "$1" test test
+2>/dev/null grep then done awk $(pwd) -eu 2>/dev/null echo x=1 ${HOME}
+		&& --verbose sed echo /usr/bin awk awk awk awk
+		${HOME} 2>/dev/null $(pwd) "$@" printf x=1
+"$@" printf then cd "$1" printf done --verbose 'quoted text' then
+	"$1" echo export cd done local echo echo sed export /usr/bin readonly 2>/dev/null
+	$(pwd) test done --verbose x=1 $(pwd) x=1 readonly cd echo sed | | 2>/dev/null
+&& ${HOME} export local /usr/bin
+printf /usr/bin /usr/bin $(pwd) sed export -eu export
+	"$1" printf 2>/dev/null && export test local 2>/dev/null /usr/bin
+	| sed then | $(pwd) echo x=1 x=1 -eu local done export sed /usr/bin | grep echo
+		printf cd | echo $(pwd) /usr/bin awk /usr/bin done "$1" echo export x=1 "$1" done
+		sed export readonly printf x=1 x=1 | readonly cd "$1" && "$1" echo grep
+		x=1 done echo ${HOME} export $(pwd) 2>/dev/null grep
+	awk cd awk test sed $(pwd) && 2>/dev/null x=1 awk /usr/bin
+		sed then && $(pwd) -eu echo grep ${HOME} echo echo $(pwd) 2>/dev/null 2>/dev/null
+sed grep x=1 printf | readonly readonly -eu
+		"$@" export readonly "$1" then done "$@" cd awk sed grep && sed readonly
+awk | echo "$1" sed 'quoted text'
+export local grep grep -eu "$1" grep sed --verbose && done 'quoted text'
+		test done | "$@" then printf cd ${HOME} x=1 printf
+	x=1 && /usr/bin awk && test readonly 'quoted text' sed echo printf
+		"$@" ${HOME} -eu "$@" /usr/bin /usr/bin x=1 sed
+		test "$@" cd x=1 readonly echo echo && --verbose then export awk
+		grep test -eu local 'quoted text' --verbose
+		test export --verbose --verbose -eu
+	${HOME} "$@" awk grep sed "$@" grep "$1" awk cd grep printf grep local
+	local done printf -eu done sed export x=1 | sed ${HOME} $(pwd) awk then
+		then 'quoted text' && $(pwd)
+	2>/dev/null 'quoted text' export 'quoted text' sed "$1" | awk ${HOME} done grep
+${HOME} $(pwd) 2>/dev/null
+sed cd printf grep --verbose printf "$@" grep ${HOME} && ${HOME} done
+		2>/dev/null "$1" local grep export ${HOME} /usr/bin awk
+| 2>/dev/null then export cd -eu "$@" done test --verbose sed && ${HOME}
+		'quoted text' printf 2>/dev/null echo
+2>/dev/null $(pwd) /usr/bin && /usr/bin export "$@" 'quoted text'
+awk test awk echo test $(pwd) 'quoted text' 'quoted text'
+		"$1" 'quoted text' ${HOME}
+		local printf 2>/dev/null grep done local sed then echo awk --verbose cd
+"$1" 2>/dev/null && -eu --verbose $(pwd)
+		printf x=1 local local --verbose printf --verbose 2>/dev/null sed echo "$@" ${HOME}
+${HOME} | x=1 sed x=1 grep done -eu done awk ${HOME} --verbose
+		&& awk -eu && | test cd awk "$@" test x=1 local && x=1 sed export
+	grep $(pwd) sed then export local cd then x=1
+		x=1 -eu x=1 ${HOME} /usr/bin && then export "$1" | then
+		awk "$@" 'quoted text' sed awk /usr/bin 'quoted text' $(pwd) printf
+echo ${HOME} 'quoted text' "$@" "$@" export test grep echo readonly echo /usr/bin
+"$1" sed export awk echo echo 'quoted text' grep /usr/bin then cd "$@"
+	| awk local x=1 $(pwd) && ${HOME} $(pwd) $(pwd) then | cd x=1
+readonly $(pwd) local grep "$@" "$1" "$@" local
+		| --verbose | "$@" ${HOME} test $(pwd) grep 2>/dev/null && | /usr/bin &&
+2>/dev/null cd | test readonly export $(pwd) awk readonly local ${HOME} cd readonly
+awk awk -eu -eu readonly cd "$@" | /usr/bin x=1 then test sed
+		'quoted text' "$@" ${HOME} --verbose
+		x=1 2>/dev/null --verbose awk $(pwd) x=1 $(pwd) ${HOME}
+2>/dev/null -eu ${HOME} sed then cd then
+	export -eu --verbose 2>/dev/null ${HOME} awk
+test "$1" $(pwd) 2>/dev/null test 2>/dev/null "$@"
+readonly test done test -eu "$@" /usr/bin 'quoted text'
+		cd 'quoted text' done grep done "$@" local | | echo
+		2>/dev/null "$1" awk x=1 done printf && 'quoted text'
+	$(pwd) $(pwd) test --verbose readonly echo done done 'quoted text' 'quoted text'
+done && $(pwd) sed local 'quoted text' 'quoted text' sed export | grep
+	2>/dev/null "$1" 2>/dev/null --verbose awk
+	-eu $(pwd) export export test echo local && 2>/dev/null then test
+	2>/dev/null && awk --verbose cd ${HOME} then $(pwd) export "$@" ${HOME} "$@" "$1"
+		2>/dev/null echo $(pwd)
+		x=1 export "$@" | echo readonly "$@" then | 'quoted text' 2>/dev/null awk
+readonly | "$1" then ${HOME} --verbose $(pwd) ${HOME} printf readonly "$1" done
+		local ${HOME} printf | done -eu "$@" -eu "$@" -eu grep export test local
+then 2>/dev/null ${HOME} 'quoted text' awk ${HOME} 2>/dev/null
+		readonly done "$1" echo 'quoted text' local echo 2>/dev/null
+	grep ${HOME} local sed echo $(pwd) then ${HOME} /usr/bin
+	echo "$1" 2>/dev/null printf "$1" --verbose "$1" readonly done done export
+		| 'quoted text' /usr/bin local 'quoted text' 2>/dev/null 'quoted text'
+		done $(pwd) export printf printf ${HOME} $(pwd)
+	printf $(pwd) readonly /usr/bin --verbose awk "$1" then
+	readonly 2>/dev/null test cd echo test 2>/dev/null
+test "$1" echo test "$@" 'quoted text' echo -eu "$@" x=1 export
+		&& | sed 2>/dev/null cd && "$@" -eu ${HOME} ${HOME}
+		printf printf -eu ${HOME} "$1" echo $(pwd) x=1 grep -eu local
+	echo && local grep "$@" printf grep $(pwd) "$@" 'quoted text'
+	-eu cd then --verbose printf cd "$1" $(pwd) printf printf && local
+	echo readonly export 2>/dev/null
+sed "$@" readonly awk readonly
+	x=1 grep sed --verbose local then
+	sed "$@" export echo grep cd echo grep $(pwd) 2>/dev/null --verbose
+		grep | grep echo readonly -eu test --verbose x=1 /usr/bin
+	sed x=1 /usr/bin cd ${HOME}
+	export $(pwd) cd done --verbose echo then sed "$1" sed test --verbose
+	sed done cd sed -eu cd --verbose ${HOME} -eu export local
+	"$1" printf echo && | ${HOME} x=1 export local done x=1
+${HOME} done --verbose echo 2>/dev/null test cd
+${HOME} "$@" export then
+'quoted text' test "$@" done 2>/dev/null -eu 'quoted text' awk x=1 /usr/bin
+| 'quoted text' test sed awk readonly
+		'quoted text' "$@" grep x=1 $(pwd) printf 2>/dev/null
+2>/dev/null echo sed x=1 sed 2>/dev/null
+awk | export export ${HOME} local
+&& sed | ${HOME} 'quoted text' export
+local sed 2>/dev/null local cd then
+		--verbose export test grep local grep export test "$@" cd ${HOME}
+/usr/bin awk sed local -eu -eu cd sed sed
+		local export awk sed local x=1 awk printf readonly 'quoted text' test 2>/dev/null
+	"$@" $(pwd) "$@" $(pwd) export export done sed "$1" "$1" then local readonly grep
+		x=1 | test test "$@" -eu "$1" 'quoted text' --verbose
+	-eu 2>/dev/null test awk -eu ${HOME} done
+	--verbose cd --verbose ${HOME} awk echo 2>/dev/null && done awk grep readonly
+		then $(pwd) 2>/dev/null ${HOME} "$@" export then --verbose
+	--verbose /usr/bin readonly ${HOME} done
+	sed readonly cd | "$@" readonly ${HOME} $(pwd) $(pwd)
+		&& "$@" local cd -eu readonly "$@" ${HOME} $(pwd) --verbose -eu echo echo
+export /usr/bin /usr/bin cd -eu test cd
+&& | local ${HOME} sed "$@" sed readonly $(pwd) | --verbose echo
+awk ${HOME} ${HOME} grep $(pwd) x=1 "$@"
+&& local done $(pwd) readonly readonly "$1" 2>/dev/null local
+	test echo sed "$1" done grep 'quoted text' "$@" sed awk 'quoted text'
+		grep /usr/bin printf export "$@" echo ${HOME} printf local
+		$(pwd) ${HOME} grep x=1 printf 'quoted text'
+	grep awk done $(pwd) /usr/bin printf then -eu test readonly $(pwd)
+| --verbose readonly cd sed
+		'quoted text' -eu /usr/bin 'quoted text'
+		/usr/bin 2>/dev/null readonly
+test done "$@" "$1" "$@" $(pwd) echo --verbose printf
+		'quoted text' test local grep local -eu local x=1 "$@" echo
+		awk --verbose awk /usr/bin export ${HOME} awk 2>/dev/null && echo 2>/dev/null
+	done then then local echo echo | -eu && done
+	done x=1 /usr/bin cd | printf -eu 'quoted text'
+'quoted text' --verbose export cd
+	echo export --verbose printf --verbose grep "$@" && export ${HOME} 'quoted text'
+		sed | then printf /usr/bin cd done export | sed "$1" echo grep ${HOME}
+		"$1" -eu done export "$@" 'quoted text' test printf
+--verbose local x=1 test test 'quoted text' x=1
+		then x=1 x=1 | && test 2>/dev/null awk readonly
+	awk $(pwd) then done "$@" $(pwd) "$1" echo | then export
+	test "$1" && -eu export printf then 2>/dev/null --verbose done
+		cd test printf | ${HOME} 2>/dev/null
+		$(pwd) && 2>/dev/null -eu "$@" then grep /usr/bin
+grep echo "$@" readonly x=1 grep grep "$1" export 2>/dev/null
+x=1 /usr/bin awk echo 2>/dev/null 2>/dev/null printf 2>/dev/null
+	| awk && export test "$1"
+		/usr/bin --verbose "$1" cd x=1 test && 'quoted text' 2>/dev/null
+		grep sed export done "$1" x=1 ${HOME} "$@" echo --verbose
+		printf 2>/dev/null awk local
+		export "$1" local cd 2>/dev/null sed local "$1" awk $(pwd) cd 2>/dev/null
+		test local readonly "$@"
+		local x=1 sed 'quoted text' done 2>/dev/null then "$@" test
+		--verbose $(pwd) x=1 grep
+echo grep then --verbose x=1 $(pwd) 'quoted text' --verbose ${HOME}
+done "$1" local local | export cd 'quoted text' 'quoted text' readonly 'quoted text'
+| test then -eu 2>/dev/null sed
+	x=1 export done ${HOME} "$@" test done 'quoted text' readonly printf then local
+	&& local /usr/bin x=1 done
+2>/dev/null 2>/dev/null -eu sed x=1 done x=1 local then && "$1" printf cd
+export | | done test /usr/bin
+	"$@" export echo | ${HOME} then $(pwd) 2>/dev/null
+		test cd | done && cd && && sed 'quoted text'
+		awk ${HOME} $(pwd) 'quoted text' then -eu /usr/bin && --verbose grep echo
+test "$1" sed export 'quoted text' sed -eu ${HOME} | "$1"
+		export x=1 done --verbose && sed
+		test "$1" "$1" x=1 $(pwd) grep ${HOME} x=1 grep export
+		export --verbose "$1" 'quoted text' --verbose sed "$@"
+		"$@" then test then ${HOME} -eu printf export export local local --verbose x=1
+"$@" grep --verbose && printf "$@" sed -eu
+	export then | sed $(pwd) echo sed
+	2>/dev/null export $(pwd) 2>/dev/null /usr/bin local
+awk "$@" "$@" done /usr/bin && "$1" "$@" /usr/bin
+test then 2>/dev/null 'quoted text'
+		${HOME} 'quoted text' export awk export "$@" awk export 2>/dev/null
+	awk "$1" x=1 --verbose export /usr/bin x=1 2>/dev/null "$1" printf
+		done test printf --verbose 'quoted text'
+	/usr/bin x=1 readonly echo done -eu cd 2>/dev/null -eu grep echo
+x=1 2>/dev/null --verbose --verbose
+"$@" ${HOME} test 'quoted text' echo -eu 'quoted text'
+echo sed 'quoted text' "$@"
+/usr/bin $(pwd) -eu local local test
+	cd 'quoted text' readonly x=1 "$1" /usr/bin echo -eu grep echo
+/usr/bin readonly | x=1 $(pwd) "$1" awk --verbose done test && test && | sed
+		$(pwd) test && done | echo export sed
+x=1 2>/dev/null then && test test -eu sed 2>/dev/null test cd cd --verbose
+		2>/dev/null printf /usr/bin grep done test | 2>/dev/null
+		"$1" /usr/bin then echo ${HOME} 'quoted text' readonly printf printf awk export
+		'quoted text' grep /usr/bin && /usr/bin done 'quoted text' /usr/bin
+echo "$@" awk "$@" ${HOME} $(pwd) sed then sed export grep | then
+	test done readonly then 'quoted text' $(pwd) grep | "$@" | | --verbose
+		echo x=1 "$@" --verbose
+		"$1" readonly x=1 "$@" --verbose
+x=1 /usr/bin -eu $(pwd) x=1 awk && awk "$@" 2>/dev/null
+	'quoted text' $(pwd) echo cd ${HOME} echo --verbose /usr/bin
+	'quoted text' test cd 2>/dev/null
+	local 2>/dev/null 'quoted text' echo echo readonly
+		x=1 export | grep readonly "$1" test --verbose ${HOME}
+	$(pwd) then 'quoted text' echo then local $(pwd) printf test /usr/bin
+	x=1 $(pwd) "$1" -eu /usr/bin done sed 'quoted text' sed echo 'quoted text'
+		"$1" awk "$1" printf test && -eu readonly 2>/dev/null
+		readonly 'quoted text' export
+	cd local "$1" -eu awk then local /usr/bin grep then awk && awk grep "$1"
+	readonly printf sed 2>/dev/null
+	local sed "$@" --verbose $(pwd) printf export export ${HOME}
+cd readonly grep "$1" export local "$1" "$@" "$@" cd export sed 'quoted text'
+	cd 'quoted text' export printf then $(pwd) readonly awk ${HOME} -eu cd
+echo -eu $(pwd) && ${HOME} test ${HOME} sed test then $(pwd) local -eu echo -eu
+	2>/dev/null --verbose sed echo | ${HOME} test then local && | export
+--verbose then readonly sed /usr/bin $(pwd) echo done done /usr/bin
+$(pwd) done grep --verbose && then printf $(pwd) awk export
+	readonly readonly "$@" --verbose
+	printf awk --verbose readonly local readonly | &&
+	readonly echo $(pwd) cd echo -eu --verbose 2>/dev/null $(pwd)
+readonly echo $(pwd) /usr/bin $(pwd) awk awk -eu export
+		done $(pwd) awk then $(pwd) "$1" /usr/bin grep
+"$@" printf cd grep x=1 && export && local "$1" $(pwd) "$1" cd "$1" -eu awk $(pwd)
+		'quoted text' sed ${HOME} then | printf $(pwd) awk then "$@" readonly /usr/bin
+		"$1" 'quoted text' /usr/bin sed "$1" "$1" -eu done local x=1
+		"$1" echo ${HOME} /usr/bin sed $(pwd) awk | grep cd && grep
+done x=1 && | local 'quoted text' 'quoted text'
+sed $(pwd) "$1" 'quoted text' local --verbose x=1 'quoted text'
+	${HOME} test | awk ${HOME} --verbose awk ${HOME}
+	"$@" "$@" test then && readonly grep test
+		readonly cd /usr/bin 2>/dev/null printf printf echo
+		${HOME} awk 2>/dev/null local
+		$(pwd) 'quoted text' x=1 cd local "$@" export | "$1" readonly
+		cd 'quoted text' printf printf awk "$1" readonly
+"$@" done printf $(pwd) -eu x=1 $(pwd) "$1" 2>/dev/null
+	${HOME} done export local printf x=1 /usr/bin then export 'quoted text'
+printf "$1" "$1" 2>/dev/null
+	sed echo readonly -eu grep --verbose x=1 sed
+	$(pwd) echo && echo --verbose
+		then export printf /usr/bin | "$@" && grep && export -eu
+awk readonly export cd cd export sed done | printf readonly
+/usr/bin && awk $(pwd) grep 'quoted text' /usr/bin echo
+		test "$1" $(pwd) --verbose export readonly awk readonly sed $(pwd)
+&& x=1 ${HOME} /usr/bin -eu sed --verbose local readonly
+		$(pwd) then printf ${HOME} &&
+		/usr/bin export echo 2>/dev/null
+		"$@" 'quoted text' then
+	"$1" | readonly | grep sed "$@" readonly ${HOME} && --verbose cd ${HOME} echo
+done cd awk -eu && grep
+		then grep x=1 "$@" export readonly local 2>/dev/null
+test 2>/dev/null printf sed 'quoted text'
+	${HOME} local local "$@" echo x=1 done awk
+then export done grep 'quoted text'
+	-eu /usr/bin 'quoted text' export 'quoted text'
+	'quoted text' $(pwd) 2>/dev/null "$@" readonly
+sed test export done local
+"$@" cd echo done --verbose done sed sed done --verbose && awk test readonly
+		done readonly grep awk done 2>/dev/null then 2>/dev/null 2>/dev/null
+		| 'quoted text' /usr/bin 2>/dev/null echo awk /usr/bin -eu | ${HOME}
+awk done printf then readonly grep 2>/dev/null 2>/dev/null
+x=1 | && -eu x=1 printf "$@"
+grep -eu x=1 done $(pwd) /usr/bin done local $(pwd) ${HOME}
+	printf 2>/dev/null printf --verbose
+	then printf 'quoted text' cd
+local sed test && --verbose 'quoted text' --verbose export sed | && readonly ${HOME}
+printf grep /usr/bin -eu sed "$@" "$@" printf echo --verbose && cd
+	&& readonly then readonly export $(pwd) awk "$1" "$@" readonly
+"$1" test awk $(pwd) -eu ${HOME} | local && -eu 2>/dev/null -eu "$@" ${HOME}
+x=1 local then ${HOME} "$@" ${HOME} x=1 /usr/bin && && 2>/dev/null test x=1 /usr/bin
+		awk -eu && -eu "$@" grep test && printf cd local
+		$(pwd) /usr/bin sed local local /usr/bin /usr/bin done local "$@" sed cd ${HOME}
+'quoted text' 2>/dev/null
+	'quoted text' export --verbose local
+	${HOME} sed done /usr/bin 'quoted text' grep test done | 'quoted text' done
+		cd 'quoted text' x=1 &&
+echo -eu $(pwd) readonly cd printf test sed "$1"
+	readonly ${HOME} sed $(pwd) export done --verbose readonly done && | echo printf
+test | -eu && -eu sed -eu grep "$1" /usr/bin
+	test done 'quoted text' && 'quoted text'
+	2>/dev/null $(pwd) echo /usr/bin && printf readonly 'quoted text' 2>/dev/null
+		"$@" 'quoted text' echo readonly done awk 2>/dev/null readonly then "$@" printf
+		done $(pwd) x=1 "$1" cd | awk readonly
+readonly done "$@" local
+		awk && -eu ${HOME} --verbose sed cd x=1 sed | readonly --verbose ${HOME}
+		sed grep test 2>/dev/null 2>/dev/null "$1" 'quoted text'
+${HOME} done 'quoted text' cd | ${HOME} 'quoted text' awk -eu | 2>/dev/null 2>/dev/null
+&& x=1 /usr/bin then x=1 -eu 'quoted text' "$1" 'quoted text'
+x=1 "$@" 'quoted text' echo /usr/bin printf awk --verbose
+	"$@" -eu x=1 printf "$1" awk $(pwd) --verbose
+	x=1 local awk x=1 "$1" --verbose export "$@" "$@" | echo done
+		${HOME} x=1 'quoted text' local 2>/dev/null cd test printf -eu ${HOME} /usr/bin
+--verbose "$@" $(pwd) test "$@" readonly
+		grep then "$@" export | awk x=1 -eu readonly then ${HOME} test
+'quoted text' printf local --verbose && test -eu "$1" printf then then 2>/dev/null
+${HOME} --verbose 'quoted text'
+	2>/dev/null then done 2>/dev/null | test && awk && 2>/dev/null
+		sed /usr/bin then export export
+	local done then x=1 -eu "$1" readonly "$@"
+		grep local 2>/dev/null ${HOME} test
+cd ${HOME} "$1" "$1" "$@"
+	readonly "$1" x=1 ${HOME} 'quoted text'
+		done && test readonly echo --verbose "$1" $(pwd)
+	/usr/bin --verbose done $(pwd) readonly done -eu /usr/bin cd && --verbose /usr/bin
+-eu export && export -eu awk 'quoted text' then export
+cd echo "$@" awk -eu $(pwd) printf
+		local x=1 | echo x=1 "$1"
+		"$1" echo awk done local
+		sed | /usr/bin "$1" export readonly 2>/dev/null test "$@" done done awk
+$(pwd) $(pwd) grep then readonly
+	echo /usr/bin 'quoted text'
+		/usr/bin $(pwd) grep -eu && awk then grep done test
+	awk test readonly test 'quoted text'
+	'quoted text' printf
+		sed "$@" 'quoted text' "$@" ${HOME} awk grep awk test sed x=1 local -eu ${HOME}
+	then --verbose grep grep export sed then "$1" x=1 echo grep sed --verbose "$@"
+x=1 test 2>/dev/null /usr/bin "$1" --verbose && test readonly
+	local ${HOME} && local then --verbose sed x=1 ${HOME} x=1
+	/usr/bin /usr/bin "$1" test then test printf -eu sed then echo local x=1 echo
+	export sed printf ${HOME} 'quoted text' readonly "$@"
+	grep test --verbose grep "$1" /usr/bin local test 'quoted text' printf
+		echo grep 2>/dev/null ${HOME}
+'quoted text' sed sed 2>/dev/null
+	--verbose sed local cd cd echo export && x=1 "$@" /usr/bin echo x=1 awk
+sed sed x=1 2>/dev/null --verbose awk then 'quoted text' printf
+	&& grep 'quoted text' echo x=1 | x=1
+	-eu x=1 | "$@" awk 'quoted text'
+		readonly "$1" printf sed "$@" 2>/dev/null && echo local $(pwd)
+	export local && cd -eu $(pwd)
+		"$@" readonly --verbose
+	"$1" awk "$1" && x=1 printf x=1 "$@" x=1 grep x=1 $(pwd) $(pwd)
+		test cd 2>/dev/null | x=1 sed readonly done ${HOME} | test 'quoted text'
+&& grep then test -eu printf | "$@" --verbose cd grep export | $(pwd)
+	"$1" sed -eu x=1 awk export && awk "$1" $(pwd) "$@"
+	2>/dev/null 'quoted text' ${HOME} awk cd && done && $(pwd) local $(pwd) ${HOME}
+	&& "$1" "$1" | cd x=1 "$@" printf "$@" cd printf then export test cd "$1" grep
+		readonly printf $(pwd) cd "$@" export ${HOME} then sed then
+	echo printf then awk local then 'quoted text' 'quoted text'
+	export 'quoted text' local done /usr/bin | && && --verbose readonly
+		grep ${HOME} 2>/dev/null
+"$@" echo /usr/bin ${HOME} printf "$1" printf &&
+		2>/dev/null "$@" grep awk local -eu "$@" "$@" grep && $(pwd)
+printf 'quoted text' grep 'quoted text'
+	$(pwd) readonly 2>/dev/null done ${HOME}
+	grep echo done "$@" done "$1" x=1 sed then 2>/dev/null
+		export echo /usr/bin awk x=1 readonly
+$(pwd) done local "$@" export | | $(pwd) awk "$1" && cd "$@" && | readonly
+export readonly then 'quoted text' "$1" ${HOME} export -eu grep && 2>/dev/null &&
+"$1" "$@" then "$1" -eu readonly echo readonly test test
+		"$@" "$1" test ${HOME} local x=1 "$@" 2>/dev/null sed export then
+	grep 'quoted text' then local && -eu awk export --verbose | /usr/bin
+	/usr/bin sed && done local
+	"$@" cd ${HOME} -eu -eu test local awk 'quoted text' export "$1" "$@" cd local
+sed awk "$1" done grep 'quoted text' "$1" --verbose -eu test readonly -eu $(pwd)
+"$@" done done "$1" /usr/bin grep grep sed sed sed sed grep then awk
+echo grep sed 2>/dev/null && cd test
+	"$1" awk "$@" | grep awk 'quoted text' && grep awk 2>/dev/null -eu printf "$@"
+sed 'quoted text' cd -eu x=1 'quoted text' then ${HOME} test | sed test cd export
+		grep echo | 'quoted text' x=1 'quoted text'
+		"$@" -eu test --verbose ${HOME} 'quoted text' --verbose done grep
+		'quoted text' sed && sed readonly |
+	done done --verbose ${HOME} export "$@" printf done cd 2>/dev/null test then awk
+	x=1 readonly $(pwd) sed ${HOME} --verbose
+2>/dev/null "$@" && --verbose ${HOME} --verbose then $(pwd) |
+		export && cd awk | then "$@" grep test awk /usr/bin cd test -eu export
+		x=1 awk 2>/dev/null printf $(pwd) awk awk printf cd awk "$@" 2>/dev/null local
+| "$@" 2>/dev/null export then "$@" echo sed sed grep then done printf
+	x=1 export readonly "$@" done local sed sed readonly $(pwd)
+-eu "$1" local --verbose "$1" | then 'quoted text'
+		awk awk awk 2>/dev/null
+	awk awk awk | sed grep x=1 test echo awk $(pwd) export
+$(pwd) cd "$1" readonly printf grep test | done | echo echo export "$@" done
+		done then ${HOME} printf "$@" readonly $(pwd) test x=1 echo 'quoted text'
+	grep then readonly /usr/bin $(pwd) grep local test /usr/bin
+/usr/bin 2>/dev/null test readonly -eu awk grep ${HOME}
+| printf 'quoted text' readonly cd printf readonly then sed export
+	printf local awk local "$@" cd awk done x=1 "$@" && echo --verbose x=1
+| 'quoted text' /usr/bin 'quoted text' --verbose && "$1" test "$@"
+	/usr/bin echo readonly "$1"
+	--verbose 'quoted text' $(pwd)
+	-eu grep /usr/bin x=1 readonly $(pwd) "$@" readonly readonly awk 2>/dev/null
+$(pwd) grep "$@" echo done printf sed echo x=1 ${HOME} | && grep printf local
+		grep grep cd ${HOME} --verbose 'quoted text'
+local "$1" export awk grep sed $(pwd) ${HOME}
+/usr/bin --verbose /usr/bin "$@"
+/usr/bin local cd 2>/dev/null done /usr/bin
+		then "$1" --verbose 'quoted text' | && x=1 /usr/bin
+		x=1 done done ${HOME} then sed cd then "$1" "$1" then
+"$@" grep -eu test 2>/dev/null
+		readonly grep x=1 ${HOME} test sed /usr/bin /usr/bin "$@" sed "$@" /usr/bin
+		sed 2>/dev/null "$@" 'quoted text'
+readonly then "$1" export awk 'quoted text' x=1 export cd 2>/dev/null grep
+		echo then && "$1" x=1 'quoted text' grep "$1" readonly 2>/dev/null -eu
+	--verbose --verbose x=1 && && cd then ${HOME} sed -eu --verbose
+2>/dev/null | $(pwd) x=1 -eu ${HOME} local
+then local -eu local -eu awk echo
+	grep && x=1 | --verbose test done export --verbose echo /usr/bin && x=1
+	${HOME} | then --verbose sed $(pwd) 2>/dev/null "$@" then
+	cd grep "$@" 2>/dev/null test readonly
+	echo "$@" 2>/dev/null ${HOME} x=1 export then | x=1 -eu "$1"
+printf ${HOME} local x=1 ${HOME} x=1 $(pwd) echo x=1 cd
+	x=1 echo | export done && then cd "$@" test 2>/dev/null cd -eu
+export sed ${HOME} 2>/dev/null
+	readonly "$1" done ${HOME} printf $(pwd) /usr/bin readonly
+| 'quoted text' | && echo -eu test -eu
+	${HOME} echo $(pwd) -eu awk
+		export readonly export x=1 then printf x=1 sed readonly ${HOME} "$1"
+export --verbose x=1 && /usr/bin
+	test awk --verbose x=1 ${HOME} "$@" sed echo grep printf then $(pwd) -eu x=1
+	then local echo 'quoted text' local test --verbose
+		grep sed && awk $(pwd) 'quoted text'
+/usr/bin x=1 awk "$@" | "$1" -eu 'quoted text' "$1" then && grep test /usr/bin
+	done | sed printf | | cd && x=1 --verbose echo test then ${HOME} --verbose
+"$1" "$@" "$@" /usr/bin sed sed readonly done echo local $(pwd) 'quoted text'
+		"$1" ${HOME} local && test sed awk awk $(pwd) "$@" echo cd
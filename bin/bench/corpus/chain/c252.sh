@@ -0,0 +1,2001 @@
+	"$1" "$@" ${HOME} 2>/dev/null echo ${HOME} awk
+		2>/dev/null awk | $(pwd) grep cd ${HOME}
+	sed 2>/dev/null test x=1
+		/usr/bin test /usr/bin $(pwd) export 'quoted text' 2>/dev/null local done cd
+	/usr/bin grep /usr/bin readonly | -eu "$@" "$@" | && export grep cd
+		x=1 done ${HOME} printf
+		| --verbose --verbose /usr/bin x=1 x=1 export 2>/dev/null awk test -eu
+	"$1" $(pwd) "$@" $(pwd) /usr/bin local done 'quoted text'
+done readonly | $(pwd) x=1 local 'quoted text'
+		2>/dev/null sed -eu sed test ${HOME} cd x=1 export 'quoted text'
+&& awk | 'quoted text' echo "$1" --verbose done &&
+test -eu -eu "$@" --verbose awk export 2>/dev/null
+		'quoted text' sed "$@" echo done | then export --verbose
+	/usr/bin then && then sed $(pwd) "$@" export 'quoted text' then
+&& sed --verbose done $(pwd) x=1 done ${HOME} && awk /usr/bin test awk | cd
+readonly printf cd | $(pwd) readonly -eu echo awk printf readonly local $(pwd) then
+&& 2>/dev/null grep test "$1"
+		${HOME} done | cd printf export
+| 'quoted text' && 2>/dev/null "$@"
+		then && x=1 grep test printf
+		${HOME} --verbose "$@" readonly 2>/dev/null $(pwd) awk then
+		echo awk $(pwd) "$1" grep --verbose
+		done sed --verbose "$1" test readonly -eu cd && then export | 'quoted text' grep
+		&& grep cd printf -eu | "$1" echo "$@" ${HOME} -eu /usr/bin
+	"$@" grep /usr/bin && echo ${HOME} grep sed 2>/dev/null awk
+	$(pwd) "$@" export --verbose test && cd test printf $(pwd) && "$1"
+		printf cd | "$@" --verbose echo sed "$1"
+	--verbose export then readonly export x=1 cd done "$@"
+$(pwd) then echo printf then awk test "$1" $(pwd) 'quoted text'
+${HOME} echo $(pwd) $(pwd) test cd awk grep x=1 readonly awk
+	/usr/bin echo awk /usr/bin x=1 ${HOME} echo $(pwd) "$@" grep ${HOME} x=1 | $(pwd)
+		local awk printf done readonly
+	echo $(pwd) "$@" awk readonly -eu
+cd cd "$1" then test --verbose -eu -eu awk sed --verbose 2>/dev/null test -eu
+printf echo --verbose -eu sed 2>/dev/null test then cd $(pwd) -eu x=1 readonly
+		2>/dev/null awk $(pwd) "$@" 2>/dev/null grep && ${HOME} -eu
+		grep "$1" | -eu echo sed "$1" --verbose export ${HOME}
+	readonly /usr/bin cd awk
+		grep $(pwd) x=1 done test x=1
+		grep grep /usr/bin 'quoted text' test ${HOME}
+	echo echo export sed |
+	"$@" "$1" printf /usr/bin && &&
+	then ${HOME} sed export grep printf 'quoted text' && local
+	echo then local then && 2>/dev/null | "$@" awk 2>/dev/null ${HOME}
+printf x=1 sed grep then
+		sed awk x=1 "$1" $(pwd) cd readonly grep echo 2>/dev/null 'quoted text' "$@"
+		&& grep local ${HOME} export echo local test 2>/dev/null local "$@"
+		cd -eu 'quoted text' -eu | "$1" awk readonly awk --verbose local
+	grep printf 'quoted text' sed sed cd
+	"$@" printf /usr/bin "$@" done grep
+test sed local --verbose grep $(pwd) -eu 2>/dev/null
+-eu test $(pwd) echo done done done done done 2>/dev/null echo readonly then
+		x=1 -eu awk ${HOME} 2>/dev/null printf 'quoted text' | $(pwd) then 2>/dev/null
+/usr/bin "$1" x=1 sed "$@" then 2>/dev/null
+| 'quoted text' "$@" grep
+		/usr/bin ${HOME} 2>/dev/null local
+		readonly --verbose sed cd -eu && 2>/dev/null ${HOME} sed awk echo
+"$@" ${HOME} x=1 'quoted text' x=1 done echo "$1" "$1" export echo printf
+	&& "$1" x=1 printf -eu
+		-eu 2>/dev/null -eu ${HOME}
+	sed local printf grep "$@" "$1" sed "$@"
+	cd export --verbose grep cd export -eu
+local grep readonly 2>/dev/null printf done && cd local export
+		sed x=1 /usr/bin grep && local && printf printf export && readonly
+		"$@" "$1" printf -eu 2>/dev/null 'quoted text'
+		cd test awk 2>/dev/null then "$@" "$1" /usr/bin --verbose
+		local $(pwd) /usr/bin "$1" local awk "$1"
+		local --verbose -eu && printf 'quoted text' ${HOME} awk ${HOME} 'quoted text'
+	x=1 readonly 2>/dev/null cd echo --verbose readonly 2>/dev/null --verbose
+		"$1" readonly $(pwd) grep /usr/bin 'quoted text' test --verbose /usr/bin --verbose
+		readonly ${HOME} done export printf
+$(pwd) test test readonly done readonly "$@" echo test printf then
+x=1 2>/dev/null "$@" awk done sed done --verbose done $(pwd) /usr/bin
+		| -eu 'quoted text' grep x=1 then
+		readonly printf "$@" /usr/bin /usr/bin "$1" && -eu echo "$@"
+		&& awk export sed ${HOME}
+"$@" "$@" "$@" printf && printf local 'quoted text' local 'quoted text'
+		$(pwd) | done awk then local awk "$1" sed export | 'quoted text' "$1" "$1" "$1"
+	--verbose grep $(pwd) local local grep done sed test awk local readonly
+cd x=1 export -eu && /usr/bin -eu --verbose grep readonly $(pwd) done sed
+	--verbose 'quoted text' 2>/dev/null echo awk 2>/dev/null printf local
+-eu $(pwd) grep grep cd grep export x=1 ${HOME} cd 2>/dev/null && ${HOME}
+"$@" awk -eu | | x=1 /usr/bin
+done "$@" done sed /usr/bin ${HOME} cd cd "$1" cd "$1" test
+'quoted text' --verbose done --verbose "$@"
+		"$@" echo cd echo x=1 test --verbose x=1 test $(pwd) -eu done printf 2>/dev/null
+		"$@" sed export export
+		echo grep $(pwd) local local
+export 2>/dev/null x=1 "$1" sed cd ${HOME} cd echo local done awk readonly
+	x=1 2>/dev/null cd $(pwd) /usr/bin sed ${HOME}
+	"$1" sed done cd sed export local echo
+-eu /usr/bin ${HOME} "$@" 'quoted text'
+cd "$@" -eu export cd local "$1" export
+		&& readonly "$1" printf ${HOME} export /usr/bin
+		x=1 local awk ${HOME} /usr/bin
+	readonly "$@" "$1" &&
+		echo "$1" $(pwd) "$@"
+		cd $(pwd) "$1" printf x=1 grep awk awk && grep $(pwd) then awk
+		grep 2>/dev/null grep done /usr/bin | /usr/bin -eu "$@" && done echo 'quoted text'
+x=1 grep | grep echo $(pwd)
+	"$@" local 'quoted text' echo 2>/dev/null readonly ${HOME}
+test grep cd --verbose 'quoted text' x=1 echo cd sed done local
+readonly printf 'quoted text'
+		/usr/bin cd && /usr/bin 'quoted text' cd local x=1 sed "$1" -eu 2>/dev/null
+	test grep cd readonly done done && 2>/dev/null
+	-eu sed 'quoted text' test "$@" grep awk /usr/bin ${HOME} -eu -eu cd grep
+2>/dev/null | 'quoted text' --verbose $(pwd) -eu && 2>/dev/null readonly
+$(pwd) sed test sed /usr/bin -eu $(pwd) x=1 "$1"
+		-eu "$@" 2>/dev/null x=1 echo /usr/bin done
+	awk 'quoted text' -eu 'quoted text'
+		${HOME} x=1 -eu echo | "$1" printf && -eu echo grep "$@" 2>/dev/null done
+	2>/dev/null export test printf 'quoted text'
+		'quoted text' test /usr/bin -eu 'quoted text'
+local ${HOME} x=1 | grep local --verbose local readonly | test x=1 |
+	--verbose | cd printf local echo 'quoted text' test &&
+printf awk export 'quoted text'
+		done readonly /usr/bin done
+"$@" | readonly echo awk "$@"
+	$(pwd) echo ${HOME} x=1 then $(pwd) cd x=1 x=1 -eu 2>/dev/null 2>/dev/null
+	-eu local echo done "$@" 2>/dev/null cd then printf
+		echo -eu ${HOME} cd && cd | "$1" 2>/dev/null test grep
+	${HOME} test awk done test readonly $(pwd) /usr/bin done grep printf
+		&& x=1 "$@" x=1 "$@" "$@" $(pwd) && -eu "$@" cd readonly
+		awk then echo grep | /usr/bin | $(pwd)
+	"$@" /usr/bin cd && $(pwd) ${HOME} cd
+-eu ${HOME} readonly 2>/dev/null x=1 test cd -eu test sed grep
+		readonly then "$@" then /usr/bin then x=1 done done
+	&& export "$1" && 2>/dev/null export local cd
+local x=1 then awk "$@" done grep
+awk printf $(pwd) $(pwd) test
+	&& /usr/bin grep | "$1" printf "$1" printf
+x=1 echo readonly 'quoted text'
+	/usr/bin -eu 'quoted text' ${HOME} echo $(pwd) | $(pwd)
+		local -eu export done cd readonly | "$@" -eu "$1" --verbose
+${HOME} readonly ${HOME} then "$@" ${HOME} echo /usr/bin x=1
+		cd $(pwd) printf awk grep -eu awk sed awk --verbose
+		printf 'quoted text' $(pwd) printf then cd test x=1 export && printf -eu
+	export test then then then "$1" test $(pwd) &&
+	"$1" local grep ${HOME} cd grep
+'quoted text' "$@" 'quoted text' export "$1"
+	grep sed ${HOME} done --verbose sed grep test
+		grep printf awk x=1 $(pwd) grep
+		| ${HOME} -eu --verbose local --verbose
+	local readonly && readonly 2>/dev/null test test printf sed "$@" 'quoted text' 2>/dev/null
+	| | export "$@" ${HOME} 2>/dev/null
+		done grep printf x=1 readonly done sed test cd grep echo | grep | echo
+x=1 done done 'quoted text' "$1" 'quoted text' $(pwd) 'quoted text'
+		-eu ${HOME} then ${HOME}
+	test local done /usr/bin "$1" | awk readonly 'quoted text' done
+		printf export readonly | 2>/dev/null && -eu printf
+	awk 'quoted text' done /usr/bin sed
+		$(pwd) && "$1" | 'quoted text' done printf /usr/bin awk 'quoted text' printf
+		&& 'quoted text' printf done $(pwd) --verbose
+cd then && "$@" "$@" "$1" 2>/dev/null && "$@" echo awk sed | printf
+		export echo done x=1 'quoted text'
+	2>/dev/null readonly awk
+		test cd --verbose test local readonly "$@" 2>/dev/null
+		awk readonly local echo sed sed --verbose -eu ${HOME} && x=1
+	readonly export --verbose -eu printf | 'quoted text'
+	| x=1 grep | readonly echo 'quoted text'
+		"$1" awk 'quoted text' /usr/bin printf test $(pwd) $(pwd)
+		export "$1" export echo -eu local 'quoted text' 'quoted text'
+	readonly "$1" 2>/dev/null done "$1" printf cd local
+		then readonly grep printf ${HOME} -eu echo ${HOME}
+	2>/dev/null --verbose sed 2>/dev/null | sed "$1" -eu grep then test "$@"
+"$@" -eu export | done sed
+		done x=1 awk awk -eu then | /usr/bin
+/usr/bin then "$1" echo "$@" "$@" ${HOME} printf -eu cd $(pwd) sed readonly
+		printf 'quoted text' cd /usr/bin --verbose test then cd /usr/bin
+		"$1" "$1" x=1 awk grep echo $(pwd) printf awk -eu --verbose | cd cd sed
+	"$1" then | local cd test 'quoted text' "$1" --verbose /usr/bin
+sed ${HOME} awk -eu awk cd cd export cd | -eu x=1 readonly -eu && ${HOME} x=1
+		&& grep x=1 --verbose sed grep echo x=1 "$@"
+	--verbose printf test awk sed | ${HOME} && local sed echo | awk local awk
+		awk cd cd readonly $(pwd) local $(pwd) grep cd $(pwd) "$@"
+		test "$1" | done done test && cd
+then printf $(pwd) export export export local local /usr/bin "$1"
+	--verbose && then -eu x=1 readonly && done cd done --verbose echo echo awk
+		sed $(pwd) sed /usr/bin grep test -eu --verbose
+	test && local 'quoted text' --verbose test export awk
+		echo "$1" ${HOME} 'quoted text' "$@" 'quoted text'
+	export "$@" --verbose $(pwd)
+x=1 local sed && 'quoted text' ${HOME} echo ${HOME}
+		/usr/bin $(pwd) cd readonly $(pwd) cd echo ${HOME} /usr/bin
+	sed 'quoted text' -eu && local ${HOME} grep cd then
+		printf $(pwd) 'quoted text' /usr/bin readonly then "$1"
+		x=1 && "$@" local "$@" awk done grep cd $(pwd) 'quoted text' cd ${HOME}
+	2>/dev/null then done cd export export done --verbose echo --verbose done
+		"$1" export cd echo "$@" readonly x=1 x=1
+		printf /usr/bin --verbose && grep local export
+	then done $(pwd) cd cd
+		"$@" 2>/dev/null local 2>/dev/null /usr/bin test "$1" readonly 2>/dev/null
+	echo "$@" printf 2>/dev/null done local -eu awk --verbose
+export done local 2>/dev/null printf
+		&& awk echo "$1" --verbose && sed
+"$1" "$@" export x=1 done
+echo --verbose 'quoted text' local | echo | test "$1" 2>/dev/null ${HOME}
+		export ${HOME} 2>/dev/null grep local --verbose
+	${HOME} "$1" 2>/dev/null && -eu printf x=1 local -eu sed grep printf
+-eu printf && done readonly
+echo ${HOME} --verbose && | echo
+	-eu echo /usr/bin local && export "$1" x=1
+--verbose -eu test sed then $(pwd) echo --verbose test local -eu then
+		--verbose && grep "$1" ${HOME} ${HOME} ${HOME} "$1" | test export export sed --verbose
+		local /usr/bin readonly "$@"
+		-eu sed echo -eu $(pwd) | /usr/bin readonly cd done grep echo sed grep local
+	echo done 2>/dev/null "$1" && x=1 then | -eu grep awk "$1"
+| && ${HOME} /usr/bin then readonly "$@" "$@"
+		&& --verbose export | ${HOME} /usr/bin $(pwd) readonly | echo x=1 --verbose &&
+export "$@" "$1" local done 'quoted text' "$1" printf /usr/bin
+/usr/bin -eu printf --verbose x=1 $(pwd) test
+		local "$@" -eu grep sed ${HOME} "$1" sed -eu awk 2>/dev/null
+		sed readonly then $(pwd)
+	done "$@" test printf "$1"
+		export export | --verbose awk "$@" test x=1
+	/usr/bin $(pwd) test $(pwd) "$@" echo local
+		2>/dev/null -eu echo ${HOME} then
+		grep /usr/bin "$1" printf && $(pwd) cd --verbose
+	awk grep -eu && grep then | grep && 2>/dev/null && grep $(pwd) echo --verbose
+"$1" ${HOME} --verbose /usr/bin $(pwd) /usr/bin sed echo -eu done echo
+awk | cd x=1 && x=1 $(pwd) printf --verbose echo $(pwd)
+	"$@" then done x=1 "$1" local && sed
+done done -eu ${HOME} ${HOME} -eu done && "$1" then echo echo
+	--verbose local $(pwd)
+		awk test $(pwd) sed $(pwd)
+export $(pwd) echo 'quoted text' "$@" local "$1" && sed 'quoted text' --verbose
+		| grep --verbose 'quoted text' /usr/bin done $(pwd) && export
+'quoted text' echo cd /usr/bin then sed | sed ${HOME} $(pwd)
+2>/dev/null readonly local ${HOME} cd "$1" ${HOME}
+	&& "$@" && -eu test awk then && "$@" then "$1" --verbose
+	sed sed && | 2>/dev/null ${HOME} local test "$1" 'quoted text'
+'quoted text' cd --verbose grep
+		export export done echo done ${HOME} grep 2>/dev/null &&
+readonly "$1" $(pwd) $(pwd) sed x=1 grep $(pwd) "$@" "$1" | export awk ${HOME}
+		--verbose $(pwd) "$1" $(pwd) export grep
+done && echo cd readonly $(pwd) | sed sed
+		"$@" readonly cd awk grep | "$1" ${HOME} awk -eu ${HOME} cd ${HOME} sed $(pwd)
+	| echo test 'quoted text' "$1" /usr/bin then 'quoted text'
+| "$@" done && grep && "$@" "$@" awk "$1" echo local echo done -eu $(pwd)
+	'quoted text' 2>/dev/null grep "$@" 'quoted text'
+sed ${HOME} sed local 2>/dev/null x=1 /usr/bin then printf
+		sed 'quoted text' cd /usr/bin x=1 $(pwd) 'quoted text' local
+	| --verbose done awk then printf done echo sed | x=1 'quoted text' readonly local
+		done 'quoted text' done cd $(pwd) /usr/bin "$@" done 'quoted text' | done
+	export $(pwd) done "$1" -eu /usr/bin x=1 --verbose
+readonly -eu then printf then sed echo /usr/bin
+	sed /usr/bin echo -eu /usr/bin readonly "$1" $(pwd) grep $(pwd) readonly test
+&& echo done && --verbose /usr/bin
+		awk ${HOME} printf "$@"
+	cd --verbose grep 'quoted text' && echo test x=1 local cd echo $(pwd)
+x=1 test "$1" 'quoted text' printf /usr/bin test | echo
+		| -eu /usr/bin x=1 "$@"
+printf | then then ${HOME} "$@" && $(pwd) 2>/dev/null done
+/usr/bin done $(pwd) "$@" printf
+	export echo --verbose printf $(pwd) local "$@" cd test $(pwd) local done
+	done ${HOME} then readonly done
+		awk printf sed --verbose | cd readonly done readonly done
+		&& export export $(pwd) |
+	${HOME} ${HOME} done awk awk export $(pwd)
+	done grep ${HOME} $(pwd) /usr/bin 2>/dev/null "$1" done
+		&& local "$@" "$@" done | ${HOME}
+		| printf readonly -eu | "$@" echo local --verbose grep awk grep awk then readonly
+		test 'quoted text' local "$1" "$1" /usr/bin | readonly | "$@" 2>/dev/null
+		awk x=1 echo sed local grep test grep 2>/dev/null
+		"$1" 2>/dev/null export ${HOME} test && test "$1" awk test readonly
+"$1" --verbose ${HOME} 2>/dev/null test
+		$(pwd) printf "$1" echo cd && -eu -eu local then echo then | /usr/bin done /usr/bin
+	done awk echo && test local | grep echo awk ${HOME} "$@" ${HOME} done
+${HOME} 2>/dev/null grep x=1 "$1" sed 2>/dev/null 'quoted text' then cd | 'quoted text'
+		export then local grep "$1" then
+/usr/bin -eu local grep -eu -eu /usr/bin test --verbose
+	$(pwd) echo awk sed test 2>/dev/null export ${HOME} export "$@" cd readonly
+readonly /usr/bin awk 'quoted text'
+"$@" readonly /usr/bin 'quoted text' printf awk printf
+echo x=1 x=1 | test export "$@" test && "$@"
+sed /usr/bin printf test --verbose 'quoted text' then --verbose |
+	test done x=1 | test "$@" 'quoted text'
+		-eu ${HOME} readonly awk "$@" "$@" test readonly 'quoted text'
+	test /usr/bin local "$@" local $(pwd) $(pwd) grep grep sed then sed
+	printf "$@" "$@" export &&
+cd /usr/bin grep local
+grep 2>/dev/null x=1 && 'quoted text' /usr/bin --verbose "$1" grep "$1"
+${HOME} x=1 2>/dev/null printf $(pwd) "$@" "$1" 'quoted text' export echo
+	printf cd "$1" && grep echo then 'quoted text' sed printf test ${HOME} grep
+done local done grep && "$1" | readonly 'quoted text'
+		$(pwd) -eu printf /usr/bin export 'quoted text' | grep $(pwd) "$1" done &&
+export -eu local 2>/dev/null
+		2>/dev/null $(pwd) sed
+	${HOME} 2>/dev/null ${HOME} 'quoted text' test grep
+		$(pwd) "$@" echo awk cd x=1 sed -eu
+		"$@" 2>/dev/null local "$@" && $(pwd)
+	2>/dev/null readonly echo test |
+		cd && 2>/dev/null /usr/bin 'quoted text' printf readonly x=1
+"$1" done printf 2>/dev/null ${HOME} && && done cd
+	${HOME} awk "$1" cd export cd 'quoted text' "$@" -eu /usr/bin $(pwd)
+	2>/dev/null ${HOME} "$@" "$@" then /usr/bin
+echo --verbose 'quoted text' test sed
+	2>/dev/null test -eu grep grep then readonly x=1 readonly echo | awk grep | ${HOME}
+&& -eu 'quoted text' /usr/bin
+		export then x=1 done readonly
+sed && 2>/dev/null echo then "$@" -eu
+		test grep then printf ${HOME} $(pwd) local
+/usr/bin test x=1 export "$1" --verbose local 'quoted text'
+		${HOME} readonly $(pwd) export then printf then x=1 --verbose then then 'quoted text'
+		"$1" | readonly awk then printf echo then local | cd -eu
+2>/dev/null && export && then sed grep then local printf local "$@"
+printf cd local grep sed cd grep ${HOME} export 2>/dev/null awk
+	echo && 2>/dev/null --verbose awk sed -eu --verbose printf
+| readonly $(pwd) --verbose $(pwd) grep
+	"$1" /usr/bin /usr/bin test ${HOME}
+		grep 'quoted text' | awk "$@" "$1"
+	--verbose 'quoted text' --verbose echo echo 'quoted text'
+	-eu "$1" ${HOME} "$@" awk readonly ${HOME} done -eu then 'quoted text' done
+&& printf awk cd test sed "$1" $(pwd)
+	then && awk -eu $(pwd) local /usr/bin
+2>/dev/null 2>/dev/null $(pwd) -eu cd
+		export -eu /usr/bin 2>/dev/null x=1 printf
+	awk 'quoted text' | --verbose echo awk && readonly $(pwd)
+	$(pwd) printf test 'quoted text' then test
+		x=1 2>/dev/null printf grep awk test cd awk | ${HOME} then 2>/dev/null
+	export then grep done sed readonly /usr/bin printf "$@"
+		x=1 export -eu export readonly done local
+		awk printf $(pwd) test | done 2>/dev/null 'quoted text' export
+	sed /usr/bin 'quoted text' printf local
+${HOME} printf sed done printf awk 2>/dev/null local grep
+	printf readonly echo "$@" readonly done awk "$1" awk cd grep $(pwd)
+	| then && grep test $(pwd) $(pwd) -eu cd test x=1
+'quoted text' grep local
+-eu x=1 /usr/bin echo
+		test $(pwd) grep | x=1 export echo 2>/dev/null
+		local 'quoted text' 'quoted text'
+grep ${HOME} done $(pwd) printf echo cd cd && && &&
+		done --verbose then readonly readonly
+then -eu done "$1" sed ${HOME} x=1 readonly "$1" ${HOME} 2>/dev/null -eu
+		echo grep "$@" | | 'quoted text' local test ${HOME} awk && "$@" "$1"
+		'quoted text' /usr/bin -eu 2>/dev/null 'quoted text' awk readonly $(pwd) ${HOME}
+	${HOME} ${HOME} cd sed sed --verbose sed "$@"
+		'quoted text' --verbose $(pwd) grep -eu echo local test cd readonly local cd
+/usr/bin x=1 --verbose x=1 local 'quoted text' cd x=1 local | readonly $(pwd)
+		'quoted text' | -eu 2>/dev/null awk | -eu 'quoted text' echo awk 'quoted text'
+		export grep --verbose grep test sed $(pwd) 2>/dev/null "$@" 2>/dev/null $(pwd) -eu
+awk x=1 test echo cd sed $(pwd) /usr/bin
+readonly then done "$@" sed 2>/dev/null
+x=1 then && 2>/dev/null then
+		'quoted text' && 'quoted text' ${HOME} 'quoted text' echo done then local
+	awk | readonly "$@" grep 'quoted text' readonly printf 'quoted text' printf
+		2>/dev/null printf "$@" cd grep ${HOME} grep awk readonly
+	cd echo local | export "$@" sed | && echo awk ${HOME} "$@" "$@"
+		readonly cd sed ${HOME} 'quoted text'
+		sed "$@" 2>/dev/null ${HOME} "$@" x=1 --verbose
+	grep done ${HOME} "$@" local local | 'quoted text'
+	cd -eu grep /usr/bin cd echo "$@" echo "$@"
+printf 'quoted text' 'quoted text' /usr/bin -eu
+then && -eu x=1 $(pwd) test echo grep local readonly then x=1 then "$1"
+		&& 'quoted text' echo
+		2>/dev/null --verbose then done local ${HOME} local "$1" ${HOME} "$1" 'quoted text'
+		--verbose && awk echo 'quoted text' 2>/dev/null echo
+		'quoted text' export awk 'quoted text'
+local /usr/bin $(pwd) 2>/dev/null
+printf local local | test test test "$@" test export "$1" cd then $(pwd) export
+printf "$@" $(pwd) test printf ${HOME} 2>/dev/null
+		--verbose awk test printf then local
+then -eu export local 2>/dev/null && ${HOME} grep /usr/bin local readonly 2>/dev/null
+readonly && -eu -eu printf "$@" test test printf
+	$(pwd) echo --verbose local -eu
+	'quoted text' export &&
+		grep 'quoted text' test
+		/usr/bin local && ${HOME} export x=1 printf $(pwd) "$@" printf 'quoted text'
+	awk awk cd awk 'quoted text'
+		&& export export cd grep awk --verbose $(pwd)
+		grep --verbose 'quoted text' printf then "$1" then $(pwd) awk /usr/bin echo "$@"
+		| "$1" "$1" | 'quoted text' 2>/dev/null
+printf sed then 'quoted text' echo | 'quoted text'
+	cd export ${HOME} "$1" cd awk $(pwd) readonly && done
+export /usr/bin "$1" echo cd $(pwd) done
+		&& "$@" x=1 "$@" x=1 && awk --verbose /usr/bin sed
+		then readonly $(pwd) echo local 2>/dev/null
+		"$@" grep grep && 'quoted text' /usr/bin x=1 $(pwd) then ${HOME}
+$(pwd) printf ${HOME} then grep
+--verbose $(pwd) -eu printf local then | 'quoted text'
+awk echo export readonly | sed -eu cd sed grep $(pwd) /usr/bin
+$(pwd) 'quoted text' sed x=1 printf cd printf -eu 2>/dev/null
+	cd --verbose 2>/dev/null ${HOME} && grep
+printf local printf grep 'quoted text' -eu done cd 2>/dev/null
+		$(pwd) test x=1 printf --verbose 'quoted text'
+2>/dev/null "$@" awk $(pwd)
+"$@" awk awk export | "$@" --verbose
+	test local "$@" 2>/dev/null readonly
+		readonly then done awk
+		--verbose awk x=1 cd "$1" export /usr/bin
+		cd printf -eu echo x=1 awk
+printf -eu export export awk && x=1 awk "$@" test x=1
+		--verbose local export echo cd export
+		cd cd test readonly test 'quoted text' readonly test awk && printf
+	grep cd | cd test echo -eu sed done x=1 cd /usr/bin test test /usr/bin --verbose
+	printf cd --verbose | | -eu
+	sed -eu printf echo x=1 readonly --verbose awk awk export done -eu 'quoted text'
+	then local done -eu echo $(pwd) ${HOME} 2>/dev/null && grep export
+	'quoted text' done ${HOME} 2>/dev/null
+cd printf 2>/dev/null -eu ${HOME} readonly --verbose $(pwd) then
+	grep 2>/dev/null "$1" echo 2>/dev/null "$@" test cd /usr/bin --verbose export
+		echo export local | /usr/bin then awk $(pwd) 'quoted text' -eu readonly done
+		printf echo /usr/bin && | -eu grep
+	'quoted text' printf grep local "$@" ${HOME} awk echo
+cd x=1 && export sed grep grep --verbose cd export export
+$(pwd) printf done ${HOME}
+x=1 x=1 echo test cd test then readonly 'quoted text' x=1 2>/dev/null
+		| /usr/bin export export readonly cd local /usr/bin local export
+		/usr/bin then x=1 "$1" export 2>/dev/null
+	done grep printf export awk then 'quoted text' awk | then $(pwd) 2>/dev/null &&
+done 'quoted text' "$@" $(pwd) echo 2>/dev/null "$@" x=1 ${HOME} "$1"
+	x=1 sed $(pwd) $(pwd) ${HOME} && readonly | 'quoted text' export "$1" done
+	then awk printf awk "$1"
+	local 2>/dev/null 2>/dev/null
+done 'quoted text' printf export /usr/bin
+	local -eu && --verbose && --verbose /usr/bin
+then cd && cd 2>/dev/null 'quoted text' "$1" cd sed awk cd awk && -eu printf
+	$(pwd) 'quoted text' cd | readonly awk x=1 then && "$@" export
+	-eu | ${HOME} awk awk x=1 "$1" grep test
+		sed test 'quoted text' cd /usr/bin
+		readonly x=1 && | local then test "$1" | ${HOME}
+		"$1" readonly /usr/bin local readonly awk printf done "$1"
+	--verbose "$1" done /usr/bin cd x=1 test readonly ${HOME} export readonly
+		then done "$@" $(pwd) export readonly grep 2>/dev/null cd ${HOME} export
+	printf export readonly x=1 | test test "$1" x=1 grep --verbose /usr/bin grep ${HOME}
+awk "$@" test export readonly echo 'quoted text'
+	printf -eu --verbose 2>/dev/null
+	x=1 "$1" then test | cd export sed $(pwd) cd | ${HOME} readonly export
+	${HOME} grep "$1" awk then ${HOME} cd --verbose export "$@" ${HOME} printf | cd
+		2>/dev/null "$1" awk 'quoted text' local printf export $(pwd)
+	x=1 -eu x=1 x=1 "$@" test -eu cd | | $(pwd) printf | "$@" export
+		${HOME} && && $(pwd) && /usr/bin 'quoted text'
+	/usr/bin sed done $(pwd)
+	echo test x=1 echo local local awk then
+	echo readonly cd /usr/bin $(pwd)
+	echo test cd then sed "$1" --verbose
+2>/dev/null -eu cd && echo echo
+		printf echo done awk x=1 "$@" 'quoted text' grep x=1 && /usr/bin
+	$(pwd) local -eu export then "$@" sed "$1"
+		| test then 2>/dev/null "$1" $(pwd) 'quoted text' local 2>/dev/null
+		x=1 grep ${HOME} | --verbose /usr/bin then --verbose
+		2>/dev/null "$@" then grep done sed 'quoted text' readonly -eu printf -eu printf
+		sed awk sed test -eu awk /usr/bin awk grep export 'quoted text' x=1 test
+	grep ${HOME} local /usr/bin
+	x=1 cd 'quoted text' done cd test 'quoted text' cd
+	2>/dev/null -eu "$@" 2>/dev/null readonly /usr/bin $(pwd) x=1 2>/dev/null
+printf -eu x=1 cd x=1 sed /usr/bin "$1" readonly
+	-eu 'quoted text' ${HOME} -eu --verbose then && test done | $(pwd)
+	&& 2>/dev/null 'quoted text' done |
+awk export grep | local then sed echo echo test local "$@"
+		"$1" --verbose "$1" ${HOME} /usr/bin then "$1" /usr/bin then 'quoted text'
+		/usr/bin readonly done "$1" | local
+${HOME} x=1 $(pwd) /usr/bin "$1" export x=1 --verbose then awk then
+		done export grep x=1 printf /usr/bin grep
+	sed "$@" done 2>/dev/null 'quoted text' local 'quoted text' 'quoted text' local
+cd --verbose test -eu awk done awk readonly
+sed ${HOME} cd | "$@" then printf 2>/dev/null /usr/bin "$@" then --verbose local
+sed awk x=1 then local $(pwd) local 2>/dev/null awk 'quoted text' "$@" x=1 2>/dev/null
+		export test local ${HOME} grep ${HOME}
+		local test readonly grep | awk $(pwd)
+${HOME} local x=1 && printf "$@" awk done 2>/dev/null "$1" echo sed "$1" printf
+--verbose "$@" local "$1" readonly -eu
+then -eu $(pwd) $(pwd) x=1 grep | local
+awk done readonly awk /usr/bin sed ${HOME}
+		/usr/bin -eu 'quoted text' grep printf test
+-eu --verbose && $(pwd) "$@"
+		/usr/bin export $(pwd) x=1 x=1 -eu "$@"
+	x=1 local sed ${HOME} export awk awk echo then test /usr/bin && ${HOME} export
+| export sed echo /usr/bin grep cd "$1" -eu /usr/bin
+		cd --verbose readonly /usr/bin "$1" x=1 -eu test then | $(pwd) test then
+		/usr/bin 'quoted text' 'quoted text'
+--verbose export export grep grep
+	2>/dev/null cd then readonly
+		test test ${HOME} -eu readonly "$1"
+--verbose x=1 readonly awk then grep sed x=1 --verbose |
+		$(pwd) awk $(pwd) readonly $(pwd) x=1 grep awk grep /usr/bin $(pwd)
+2>/dev/null 2>/dev/null 2>/dev/null $(pwd) cd "$1" test sed awk cd 'quoted text'
+	/usr/bin then --verbose "$1" --verbose
+		grep sed -eu echo cd && && export "$@" echo $(pwd) echo echo 'quoted text'
+		sed "$@" export "$@" sed ${HOME} /usr/bin 2>/dev/null
+	| done test && readonly $(pwd) local ${HOME} then local readonly "$@" $(pwd) awk
+	local readonly ${HOME} local x=1 $(pwd) cd x=1
+		2>/dev/null local test sed
+	2>/dev/null done --verbose local export sed echo x=1 readonly
+/usr/bin awk then grep | export printf "$1" x=1 printf awk 'quoted text'
+	sed sed readonly grep cd
+		sed 2>/dev/null cd -eu "$1" then "$@" ${HOME}
+'quoted text' readonly export /usr/bin && grep
+	"$1" done --verbose sed local readonly cd | printf printf done cd "$1" "$1" printf
+		$(pwd) 'quoted text' sed $(pwd) test
+		--verbose 'quoted text' "$@" sed x=1 &&
+-eu sed 2>/dev/null local awk cd ${HOME}
+	"$@" local "$1" -eu "$1" test local done readonly
+		local $(pwd) sed 2>/dev/null
+		$(pwd) && export ${HOME} -eu printf awk test
+	'quoted text' cd -eu && && test
+| then 'quoted text' 'quoted text'
+	x=1 cd test --verbose then grep ${HOME}
+		test export then local $(pwd)
+then 'quoted text' "$@" printf | readonly grep "$@"
+readonly ${HOME} then readonly x=1 2>/dev/null sed test sed /usr/bin -eu
+	then ${HOME} --verbose export "$1" test export &&
+		| done --verbose $(pwd) "$1"
+		sed | printf /usr/bin 'quoted text' cd -eu "$1" | test ${HOME} then "$@"
+	/usr/bin --verbose local "$1" local local "$1"
+		echo grep --verbose 2>/dev/null /usr/bin "$@" grep grep
+		"$@" grep sed then done readonly /usr/bin done awk
+		-eu echo readonly ${HOME}
+		${HOME} test then local local ${HOME} cd printf
+		readonly printf $(pwd) echo /usr/bin 'quoted text' --verbose /usr/bin printf "$@"
+		printf --verbose 2>/dev/null "$@"
+	&& -eu /usr/bin && printf --verbose
+	x=1 "$1" x=1 grep 2>/dev/null
+--verbose readonly echo done -eu local 'quoted text' echo printf
+grep "$1" awk x=1 grep $(pwd) 2>/dev/null | readonly awk sed --verbose done
+		$(pwd) readonly cd $(pwd) /usr/bin echo 2>/dev/null sed grep | $(pwd)
+printf | ${HOME} echo printf | local /usr/bin
+awk && then grep cd cd awk -eu printf then cd /usr/bin ${HOME}
+| 2>/dev/null done ${HOME} export --verbose && ${HOME} "$@"
+	/usr/bin "$@" 2>/dev/null -eu x=1 -eu --verbose awk local
+'quoted text' done grep grep -eu awk sed
+	/usr/bin x=1 "$@" ${HOME}
+-eu readonly then echo readonly export "$@" printf && awk
+	x=1 echo /usr/bin printf test done then
+	cd awk done then export 'quoted text'
+"$1" test readonly $(pwd) -eu | x=1 "$@" /usr/bin readonly
+	export printf $(pwd)
+awk | done sed sed local local local 2>/dev/null cd 2>/dev/null "$1" "$1"
+'quoted text' then awk 'quoted text' 2>/dev/null echo 2>/dev/null
+awk done /usr/bin sed $(pwd) echo test /usr/bin x=1
+	x=1 x=1 "$1" test test ${HOME} echo readonly /usr/bin $(pwd) /usr/bin
+	--verbose $(pwd) --verbose sed x=1 $(pwd) --verbose --verbose -eu --verbose
+		| test "$1" export local /usr/bin test sed
+		sed /usr/bin grep done x=1 export 'quoted text' --verbose then
+	export -eu readonly export cd 'quoted text' | echo export -eu | $(pwd)
+	printf printf 'quoted text' "$1" -eu sed && && printf grep grep x=1 "$@"
+	awk /usr/bin sed $(pwd) $(pwd) cd x=1 -eu /usr/bin /usr/bin
+readonly x=1 "$@" done 2>/dev/null "$@" echo --verbose | done --verbose
+awk done -eu $(pwd) test "$@" "$1" "$@"
+	then | 2>/dev/null echo "$1" "$@" ${HOME} ${HOME}
+/usr/bin 2>/dev/null | printf $(pwd)
+	printf ${HOME} 'quoted text' awk awk 'quoted text'
+	readonly awk cd x=1 grep then then 2>/dev/null printf grep 'quoted text'
+echo ${HOME} then -eu readonly --verbose "$@"
+--verbose | ${HOME} readonly 2>/dev/null cd "$1" "$@" awk printf
+grep x=1 --verbose sed x=1 done echo then 2>/dev/null done $(pwd) &&
+		2>/dev/null "$@" 'quoted text' cd --verbose awk /usr/bin $(pwd)
+	local local -eu 'quoted text'
+${HOME} -eu then then 'quoted text'
+then local $(pwd) $(pwd) -eu printf 'quoted text' x=1 "$1" done
+	cd x=1 echo readonly export | --verbose sed 'quoted text'
+awk echo 2>/dev/null | export
+&& 'quoted text' /usr/bin then $(pwd) $(pwd)
+"$@" sed -eu 'quoted text' printf grep cd echo test ${HOME} then
+		printf | sed grep -eu test done
+	| readonly sed 'quoted text' grep 'quoted text' printf ${HOME} -eu 2>/dev/null
+	"$@" test sed sed done awk ${HOME} /usr/bin "$@" -eu
+&& "$@" --verbose local 2>/dev/null "$1" grep then then
+grep x=1 then "$@" 'quoted text'
+${HOME} -eu x=1 printf 2>/dev/null 'quoted text'
+		"$1" /usr/bin /usr/bin
+	export printf readonly cd sed --verbose
+test "$@" && test "$@" 2>/dev/null export 2>/dev/null -eu 'quoted text' $(pwd)
+		/usr/bin "$1" export echo "$@" 2>/dev/null awk x=1 /usr/bin
+2>/dev/null x=1 local 'quoted text' done x=1 "$@" awk ${HOME}
+	"$1" "$1" done printf then $(pwd) echo local $(pwd)
+		done echo -eu export then
+	then then readonly test sed
+--verbose --verbose x=1 cd cd test
+readonly 'quoted text' $(pwd) | printf then then test x=1 ${HOME} grep echo 'quoted text'
+	2>/dev/null sed grep x=1 -eu ${HOME}
+--verbose local x=1 then ${HOME} 'quoted text'
+	printf 2>/dev/null awk "$1" "$1" readonly /usr/bin x=1 2>/dev/null awk | 2>/dev/null
+		-eu ${HOME} --verbose printf --verbose grep
+		--verbose x=1 -eu local printf
+	| --verbose "$@" && "$1" readonly "$@" "$@" /usr/bin cd awk && 'quoted text'
+	'quoted text' sed /usr/bin local awk printf "$1" 2>/dev/null then x=1 done
+		readonly printf cd -eu x=1 'quoted text' && && 'quoted text' done
+	readonly cd "$@" -eu export | echo echo echo "$@" sed then readonly
+printf cd $(pwd) grep /usr/bin printf && sed -eu
+echo cd done "$1" echo export grep echo
+printf printf test --verbose echo 'quoted text' ${HOME} awk ${HOME} then --verbose
+cd export test "$@" grep x=1 x=1 "$@" -eu x=1
+		/usr/bin export "$1" awk "$@" /usr/bin && local /usr/bin printf
+	readonly export -eu grep ${HOME} "$@" then ${HOME} | printf
+printf done local 2>/dev/null /usr/bin local cd --verbose readonly
+		-eu "$@" x=1 local --verbose "$@" ${HOME}
+		printf && ${HOME} export done
+export 'quoted text' /usr/bin awk
+		2>/dev/null "$@" export local /usr/bin local
+	cd sed grep $(pwd) grep cd
+	x=1 test cd "$@" | then $(pwd) --verbose ${HOME} /usr/bin "$1" $(pwd)
+	sed 2>/dev/null cd "$@" 2>/dev/null
+		'quoted text' then local export printf export readonly $(pwd) "$1" && local test
+	grep grep export --verbose sed printf awk done x=1 printf "$1" x=1 -eu
+	awk /usr/bin 'quoted text' --verbose export sed sed /usr/bin "$1" "$@" readonly
+	local local then local && done "$1" "$1" && ${HOME} then test export printf ${HOME}
+	awk then -eu echo awk | echo sed ${HOME} local /usr/bin ${HOME} then
+		awk export local local "$@" cd 2>/dev/null && "$@" "$@" echo printf
+	grep sed /usr/bin x=1 sed echo 'quoted text'
+	"$1" grep sed grep ${HOME} 2>/dev/null readonly
+export sed sed | readonly 2>/dev/null && echo sed "$@"
+		awk sed /usr/bin readonly $(pwd) sed /usr/bin /usr/bin test grep "$@" ${HOME}
+${HOME} -eu ${HOME} ${HOME} echo 'quoted text'
+	local echo grep ${HOME} readonly awk 2>/dev/null
+$(pwd) echo echo | 2>/dev/null
+grep printf 'quoted text' local test | ${HOME}
+		'quoted text' 2>/dev/null readonly 2>/dev/null ${HOME}
+export echo then grep local "$@" -eu test ${HOME}
+		grep done x=1 cd awk done | "$1" --verbose
+	${HOME} && 'quoted text' printf awk |
+		'quoted text' echo export 'quoted text'
+	| printf local $(pwd) --verbose
+printf $(pwd) local "$@" then | 2>/dev/null done grep -eu /usr/bin | awk readonly
+		-eu cd local "$@" done echo local x=1
+		printf echo awk readonly grep -eu 'quoted text' "$@" then done ${HOME} cd
+		/usr/bin $(pwd) -eu /usr/bin /usr/bin "$@" local x=1 export x=1 local
+		awk /usr/bin | then local "$@" local awk "$1" sed awk local -eu
+${HOME} sed local done then "$1" "$1"
+--verbose readonly printf x=1 awk readonly printf sed "$1"
+	done 'quoted text' test $(pwd) && printf x=1 done readonly sed /usr/bin
+		printf "$1" --verbose $(pwd) sed echo
+	test -eu -eu test /usr/bin "$1" local 'quoted text'
+	/usr/bin echo done cd export local 2>/dev/null then
+2>/dev/null then -eu && x=1 --verbose awk && then "$@"
+	awk cd && sed 'quoted text' 2>/dev/null
+then /usr/bin local ${HOME}
+done readonly test readonly grep export ${HOME} awk
+	readonly ${HOME} && /usr/bin printf
+	${HOME} sed x=1 /usr/bin readonly && && "$@" sed done
+sed grep echo echo ${HOME} --verbose 'quoted text' grep ${HOME} done $(pwd)
+		"$1" local "$1" printf "$@" -eu grep grep /usr/bin && readonly then | echo --verbose
+--verbose -eu /usr/bin cd /usr/bin /usr/bin $(pwd) --verbose
+		$(pwd) local "$1" $(pwd) export ${HOME} x=1 sed 'quoted text' /usr/bin
+	echo local && x=1 cd -eu ${HOME} done test ${HOME} local /usr/bin readonly
+		"$@" x=1 x=1 cd grep x=1 'quoted text' | &&
+done echo sed 2>/dev/null /usr/bin sed "$1" printf --verbose readonly done
+awk 'quoted text' grep ${HOME} sed export
+&& echo grep $(pwd) printf done test x=1 grep $(pwd) 'quoted text'
+		local --verbose awk /usr/bin
+	echo -eu /usr/bin cd grep readonly &&
+	echo | --verbose ${HOME} echo
+then grep -eu printf awk cd -eu /usr/bin
+		export awk done && test x=1 /usr/bin ${HOME}
+	"$@" awk echo cd --verbose echo ${HOME} cd $(pwd) ${HOME}
+	echo grep x=1 printf
+	grep "$1" awk --verbose then then 2>/dev/null echo echo ${HOME} $(pwd) &&
+	awk readonly 2>/dev/null readonly awk $(pwd) --verbose 2>/dev/null awk 2>/dev/null
+		'quoted text' cd ${HOME} done && done test && cd export | -eu
+	"$@" | x=1 2>/dev/null
+	printf echo sed then $(pwd) --verbose sed
+test && cd 'quoted text' awk ${HOME} ${HOME} 2>/dev/null &&
+		x=1 | printf local export cd printf printf test x=1 --verbose
+		/usr/bin "$@" 'quoted text' | 'quoted text' $(pwd) export
+		&& -eu $(pwd) ${HOME} 'quoted text' cd test test && test grep local &&
+		cd cd ${HOME} done /usr/bin &&
+		printf -eu /usr/bin | printf export readonly 2>/dev/null
+		export "$@" printf 'quoted text' "$@" local /usr/bin 2>/dev/null "$@"
+		awk echo readonly "$1" "$@" 'quoted text'
+	grep "$1" sed --verbose readonly
+		sed export grep && ${HOME} ${HOME} then cd
+	'quoted text' printf | ${HOME} export readonly local then done "$1" x=1 && sed test
+| | "$1" "$@" test cd cd then --verbose cd printf | echo test 2>/dev/null
+	"$1" export test "$@" awk && /usr/bin
+	then "$1" cd test printf test --verbose readonly $(pwd) /usr/bin cd -eu "$@"
+2>/dev/null echo echo "$@" "$@" -eu 'quoted text' x=1 "$1" cd test
+	&& sed && 'quoted text' grep
+export test export readonly local ${HOME}
+echo cd --verbose | 'quoted text' "$1" -eu -eu && done test /usr/bin sed local
+		/usr/bin $(pwd) "$@" echo then readonly --verbose then x=1 && 2>/dev/null grep
+cd export local then "$@" --verbose -eu then 'quoted text'
+	${HOME} grep done cd printf /usr/bin export readonly grep awk ${HOME} -eu export
+'quoted text' then printf grep
+-eu $(pwd) export "$1" sed export --verbose test
+		printf --verbose sed done -eu local ${HOME} | readonly readonly x=1 sed then
+		printf $(pwd) cd "$1" grep sed local printf
+&& sed --verbose /usr/bin echo cd ${HOME}
+		2>/dev/null && export awk then $(pwd) && local export /usr/bin export "$@"
+		| /usr/bin then cd test | echo readonly x=1 printf && -eu x=1 export local sed
+	${HOME} test "$1" printf local $(pwd) cd "$@" && awk | readonly 2>/dev/null
+		'quoted text' $(pwd) "$@" $(pwd) $(pwd) ${HOME} test /usr/bin "$@" then
+test "$1" export cd 'quoted text' awk cd export -eu echo local grep -eu done then
+	readonly then "$@" $(pwd) -eu "$1" $(pwd) test $(pwd) cd && 2>/dev/null
+		-eu test "$@" && 'quoted text' "$1"
+--verbose 'quoted text' awk then echo
+	'quoted text' "$@" /usr/bin printf test cd | -eu done awk local
+		"$@" echo 2>/dev/null x=1 x=1 && grep sed sed grep "$@"
+		-eu sed grep x=1 "$1" readonly "$1" 'quoted text' -eu
+	echo cd "$1" test export done cd cd "$@" x=1 | then ${HOME} --verbose
+	-eu awk -eu then echo | printf "$@" x=1 cd export sed
+	printf readonly /usr/bin awk then -eu export echo
+		local cd --verbose -eu readonly ${HOME} done cd then $(pwd)
+	done readonly --verbose grep "$1" readonly
+	test -eu readonly awk sed export test printf test echo 'quoted text'
+	readonly local readonly 'quoted text' done done 'quoted text'
+| | printf then awk awk cd readonly sed "$1"
+	| "$@" --verbose printf echo
+	/usr/bin "$@" cd "$1" grep | echo readonly
+printf /usr/bin && ${HOME} -eu then ${HOME} -eu 2>/dev/null |
+		sed echo ${HOME} readonly "$1" --verbose && -eu
+	awk export $(pwd) -eu done "$1" 'quoted text' done sed test
+	'quoted text' test sed sed 2>/dev/null "$1" ${HOME}
+		done "$@" cd --verbose cd "$@" x=1 x=1 sed "$1" sed ${HOME} then
+	"$1" then grep /usr/bin local ${HOME} /usr/bin
+		awk local echo --verbose /usr/bin readonly readonly | "$1" 'quoted text'
+${HOME} export printf $(pwd) readonly export readonly
+done --verbose x=1 --verbose readonly grep local -eu /usr/bin
+		echo && "$1" local --verbose readonly --verbose "$@" $(pwd) -eu sed readonly
+readonly grep ${HOME} awk x=1 sed ${HOME}
+	| 2>/dev/null -eu "$1" awk "$1" readonly x=1 readonly
+	test /usr/bin x=1 x=1 done readonly /usr/bin 2>/dev/null
+	--verbose "$1" $(pwd) x=1 'quoted text' test 2>/dev/null
+cd cd export readonly test export
+grep --verbose cd -eu awk test "$@" echo readonly export
+	test awk "$1" then --verbose awk ${HOME} "$1"
+	done 'quoted text' ${HOME} grep && | done 2>/dev/null awk
+	done cd cd -eu "$@" sed readonly
+	2>/dev/null $(pwd) ${HOME} readonly echo x=1 export cd test && done awk
+		local printf local echo "$1" awk echo 2>/dev/null test echo | local
+		-eu $(pwd) && grep | /usr/bin
+readonly then $(pwd) sed cd then then then export echo "$1" -eu test
+awk grep && awk export 2>/dev/null 2>/dev/null printf x=1 printf
+		echo ${HOME} | 'quoted text' grep --verbose
+/usr/bin /usr/bin grep "$@" | ${HOME}
+	done ${HOME} ${HOME} readonly && test local export 2>/dev/null then && /usr/bin
+		awk $(pwd) sed done --verbose sed 'quoted text' done echo sed
+		--verbose "$1" done then 2>/dev/null 'quoted text' done /usr/bin local /usr/bin
+		'quoted text' then 'quoted text' -eu && /usr/bin grep x=1 then x=1 printf --verbose
+	2>/dev/null awk 'quoted text' sed printf | then && -eu 'quoted text' | "$1" "$@"
+		&& cd then ${HOME} -eu sed then "$1" 2>/dev/null --verbose echo | sed
+		2>/dev/null done "$1" && "$1" -eu echo ${HOME} "$@" | 2>/dev/null
+	grep ${HOME} cd done | /usr/bin echo export test export printf sed /usr/bin cd
+		x=1 && | "$@" printf done | --verbose done 2>/dev/null export "$1" test
+	awk grep done x=1 -eu /usr/bin then readonly
+	${HOME} | 2>/dev/null | printf
+readonly readonly ${HOME} ${HOME} ${HOME}
+	--verbose export 'quoted text' /usr/bin test awk | /usr/bin
+"$@" /usr/bin readonly test x=1 -eu "$@" -eu cd --verbose
+		readonly | test | then $(pwd) export done local /usr/bin awk |
+	&& cd printf ${HOME} 2>/dev/null printf readonly
+	done -eu echo | ${HOME} echo --verbose grep --verbose ${HOME} sed
+		done 2>/dev/null $(pwd) 'quoted text' then 'quoted text' local cd $(pwd)
+local awk readonly ${HOME} local && awk /usr/bin test grep printf -eu done export
+	x=1 then local | | "$@" 2>/dev/null
+	$(pwd) $(pwd) && export | local awk cd --verbose --verbose cd | export grep
+echo ${HOME} 2>/dev/null -eu "$1" export 'quoted text' export "$1" test echo grep
+	$(pwd) done then --verbose ${HOME} | echo x=1 export | -eu readonly ${HOME}
+--verbose printf x=1 "$1" ${HOME} $(pwd)
+grep echo "$@" /usr/bin $(pwd)
+	&& awk "$1" awk done echo done
+-eu local then --verbose "$1" cd $(pwd) && $(pwd) echo echo 'quoted text'
+	-eu ${HOME} --verbose 'quoted text' then local "$@" grep 'quoted text' 2>/dev/null
+		"$1" readonly printf local | export "$@" | sed sed
+	'quoted text' 2>/dev/null sed readonly printf
+		cd ${HOME} && $(pwd) ${HOME} 2>/dev/null $(pwd) 'quoted text' readonly echo
+${HOME} "$1" echo &&
+		echo | awk "$@" printf 'quoted text' $(pwd) $(pwd) grep "$1" && -eu "$1"
+	cd readonly "$1" readonly local done cd awk done test then -eu x=1 sed test --verbose
+printf $(pwd) "$1" test readonly 2>/dev/null x=1
+		'quoted text' echo readonly /usr/bin
+| 'quoted text' readonly echo cd 2>/dev/null | -eu done
+--verbose "$1" 'quoted text' "$@"
+	"$1" 2>/dev/null local local $(pwd) then readonly sed
+${HOME} 'quoted text' done
+		$(pwd) export awk readonly "$1" 2>/dev/null
+		| ${HOME} grep cd then 'quoted text'
+	"$@" then grep echo "$@" && echo readonly && /usr/bin
+	--verbose sed "$1" printf
+	then readonly -eu then
+awk cd printf x=1 2>/dev/null
+		sed cd && grep then && awk printf sed cd export awk "$@" test export | ${HOME}
+	printf 'quoted text' /usr/bin
+'quoted text' --verbose && x=1 -eu echo grep done "$@" 'quoted text'
+test && then test "$1" | 2>/dev/null 'quoted text' done ${HOME}
+&& readonly ${HOME} "$@" printf x=1 done sed awk done ${HOME} done awk grep printf
+	cd cd then 2>/dev/null "$1" awk $(pwd)
+&& 'quoted text' done local echo
+	printf ${HOME} sed cd cd awk
+local local "$1" x=1 && echo grep printf test export done local echo
+echo local done /usr/bin ${HOME} then --verbose -eu && --verbose grep sed
+	/usr/bin test x=1 $(pwd) /usr/bin 2>/dev/null grep export
+		| /usr/bin readonly --verbose cd readonly echo --verbose 'quoted text'
+		readonly readonly local cd -eu "$1" ${HOME}
+awk sed readonly grep sed cd readonly x=1 printf cd echo
+	awk ${HOME} ${HOME} awk awk -eu $(pwd) test then local $(pwd)
+${HOME} echo sed test x=1 done awk sed 2>/dev/null 2>/dev/null cd
+		awk | export export then cd
+		x=1 /usr/bin $(pwd) sed done | ${HOME}
+		local echo printf "$1" "$@" | printf --verbose 'quoted text' "$1" grep test
+	cd 2>/dev/null printf cd sed /usr/bin echo awk test done awk x=1 export
+local 'quoted text' local "$@" && -eu -eu ${HOME} cd done grep
+		test echo "$@" /usr/bin test done "$@" --verbose sed ${HOME} x=1
+| test printf local /usr/bin local grep ${HOME} then printf "$1"
+	| 2>/dev/null printf 2>/dev/null ${HOME} ${HOME} 'quoted text'
+$(pwd) && then printf awk
+		sed cd readonly 'quoted text' --verbose
+		--verbose $(pwd) awk /usr/bin
+test "$@" grep echo | then done done awk -eu $(pwd) awk local test
+	2>/dev/null then 'quoted text' sed "$1" "$1" sed
+		-eu "$1" /usr/bin /usr/bin && -eu printf 2>/dev/null --verbose -eu "$@"
+		-eu sed "$1" then --verbose test 'quoted text' readonly
+/usr/bin && $(pwd) local 2>/dev/null | /usr/bin
+		$(pwd) && | "$@" echo test local done /usr/bin "$@" "$@" export grep -eu
+readonly grep done --verbose /usr/bin /usr/bin cd
+	sed -eu local 2>/dev/null grep readonly local "$@" && readonly
+local readonly --verbose "$@" | $(pwd) export ${HOME} readonly test
+done readonly awk export "$@" grep 2>/dev/null awk | /usr/bin ${HOME} awk export
+	test && awk 2>/dev/null -eu cd export grep sed -eu test readonly done
+		done printf "$@" cd --verbose | awk /usr/bin local export test
+		--verbose echo ${HOME} x=1 "$@" ${HOME} --verbose awk "$1" 'quoted text' export
+-eu /usr/bin export printf
+		cd readonly $(pwd) x=1 printf ${HOME} ${HOME} 2>/dev/null && --verbose
+		local awk | printf test $(pwd) 2>/dev/null test $(pwd)
+then --verbose ${HOME} --verbose sed "$1" export readonly ${HOME}
+		$(pwd) test 2>/dev/null ${HOME} cd readonly sed export --verbose --verbose
+	done then --verbose "$1" grep local export "$1" awk
+$(pwd) sed printf | /usr/bin x=1 cd grep export local cd sed "$1" then
+2>/dev/null ${HOME} "$1"
+		grep echo sed then done --verbose 2>/dev/null
+		local done "$@" test x=1 "$@" x=1 export printf
+		test test cd 2>/dev/null printf /usr/bin sed --verbose readonly
+	cd && $(pwd) then "$@" |
+$(pwd) local test "$1" x=1 'quoted text' sed
+		&& /usr/bin readonly x=1 test 2>/dev/null
+cd printf grep test 2>/dev/null
+	awk test done "$@" 'quoted text' -eu grep "$1" test cd grep printf "$1" /usr/bin
+local x=1 /usr/bin x=1 "$1"
+		"$1" export /usr/bin "$@" sed grep awk --verbose echo "$@" awk sed done sed done
+	grep "$@" export local awk grep "$@" export 'quoted text' awk readonly
+		awk | && x=1 "$1" cd --verbose 'quoted text' $(pwd) printf && -eu | echo readonly
+	&& awk awk "$1" printf readonly cd --verbose $(pwd) "$@" "$1"
+--verbose "$@" ${HOME} cd printf $(pwd) echo done && cd ${HOME}
+		/usr/bin $(pwd) ${HOME}
+	grep export export --verbose sed cd done "$1"
+| ${HOME} x=1 grep 2>/dev/null $(pwd) x=1
+	-eu -eu sed /usr/bin awk done grep ${HOME} printf then | then x=1 export then local
+done "$1" "$@" "$1" $(pwd) ${HOME} "$@" readonly
+local "$@" $(pwd) awk x=1 "$@" ${HOME} test readonly $(pwd)
+done && x=1 --verbose awk printf
+	then ${HOME} local -eu 'quoted text' export export "$1"
+		sed -eu awk then local then | echo
+test /usr/bin cd done | /usr/bin $(pwd) cd echo "$1" ${HOME}
+		echo && 'quoted text' -eu printf --verbose local local awk then
+		readonly -eu $(pwd) "$@" test $(pwd) sed 2>/dev/null x=1 x=1 test ${HOME}
+sed done sed done cd -eu -eu local 2>/dev/null grep
+		| readonly test cd ${HOME}
+| export x=1 -eu && "$1" --verbose
+done x=1 readonly export x=1 cd "$1" ${HOME} --verbose local done readonly grep
+		then "$1" done export x=1 then
+	&& && sed printf "$1" -eu printf && 2>/dev/null "$@" awk grep
+printf ${HOME} && x=1 && cd
+	local -eu "$1" | export | readonly ${HOME} "$1"
+cd x=1 $(pwd) $(pwd) ${HOME} grep printf && export sed export ${HOME} readonly
+	cd 'quoted text' $(pwd) && | sed local "$@" && export
+		then --verbose cd "$1" "$1" echo cd -eu awk local /usr/bin "$1"
+printf && export | cd x=1
+done awk x=1 cd grep 'quoted text' 2>/dev/null "$@" printf "$1" echo echo
+	done --verbose local then echo $(pwd) awk sed grep readonly grep awk test x=1
+	echo grep printf done then
+awk readonly $(pwd) -eu ${HOME} --verbose
+		"$1" | | cd local cd | && --verbose test then cd cd | ${HOME}
+	"$1" done export /usr/bin "$@" grep export then echo -eu readonly done && $(pwd)
+"$@" $(pwd) $(pwd) echo test readonly "$1" $(pwd) printf awk awk -eu local
+		grep export awk /usr/bin --verbose ${HOME}
+x=1 $(pwd) x=1 -eu sed done --verbose
+		"$@" printf /usr/bin -eu test printf cd
+	readonly cd 'quoted text' done export test export readonly ${HOME} then awk then
+		test x=1 cd grep readonly readonly 'quoted text'
+cd cd "$@" export cd then sed test
+	test readonly /usr/bin | && test $(pwd)
+sed $(pwd) cd | done --verbose 2>/dev/null --verbose "$1" done --verbose $(pwd)
+	2>/dev/null /usr/bin export echo then echo then local local | done
+	sed test "$1" grep local 2>/dev/null x=1 export printf "$1"
+sed -eu local grep readonly echo echo readonly
+'quoted text' && export && cd |
+	--verbose done | 'quoted text'
+		readonly awk && --verbose x=1 grep x=1 &&
+	local 'quoted text' awk printf
+		"$1" test awk done export "$@" /usr/bin cd export
+	-eu echo | --verbose
+		cd | done cd 2>/dev/null --verbose done export $(pwd)
+-eu awk ${HOME} then --verbose $(pwd) local done export --verbose -eu
+"$1" 'quoted text' x=1 printf printf local awk echo printf && awk
+done then 'quoted text' echo local then done |
+		export && 'quoted text' ${HOME} --verbose
+		'quoted text' && local done ${HOME} $(pwd) --verbose "$1" cd /usr/bin sed done "$@"
+		"$@" --verbose 'quoted text' echo local sed 2>/dev/null
+${HOME} test x=1 sed && test sed grep "$1" echo echo "$1" 'quoted text'
+		printf printf cd 2>/dev/null sed | cd done cd readonly --verbose
+		cd test x=1 echo cd echo cd x=1 readonly test echo readonly then local then
+sed $(pwd) sed /usr/bin printf "$1" 2>/dev/null 2>/dev/null && "$@" then
+	export x=1 "$1" export local && sed 'quoted text' awk readonly
+	x=1 && ${HOME} readonly $(pwd) --verbose echo "$@"
+${HOME} -eu test local /usr/bin export export grep "$@"
+awk awk local && ${HOME} grep cd | readonly 'quoted text'
+		printf $(pwd) x=1 "$1" $(pwd) ${HOME} export | test test
+		then test 'quoted text' awk ${HOME} readonly readonly done /usr/bin export /usr/bin
+	"$@" | x=1 grep echo sed grep test export ${HOME} x=1
+		done x=1 | 'quoted text' echo test then sed readonly
+		local -eu cd grep --verbose x=1 | sed export /usr/bin done ${HOME} then cd
+		readonly -eu printf export echo awk $(pwd) awk --verbose local /usr/bin awk
+	x=1 readonly done 2>/dev/null
+"$@" ${HOME} test cd 'quoted text' then ${HOME} grep "$1" printf sed $(pwd)
+		then ${HOME} -eu 2>/dev/null test sed cd done "$@" x=1
+		sed export ${HOME} x=1 grep test
+	test && ${HOME} $(pwd) sed test printf cd ${HOME} ${HOME}
+	"$@" local test x=1 && export
+		"$1" then | x=1 | readonly test printf 2>/dev/null echo then "$@" ${HOME}
+	readonly /usr/bin && printf "$1" printf $(pwd) then printf 2>/dev/null
+	$(pwd) readonly ${HOME} $(pwd) 2>/dev/null /usr/bin export && local awk --verbose
+	-eu 2>/dev/null done awk /usr/bin
+| export printf grep echo | local $(pwd) test
+	--verbose && local x=1 grep
+2>/dev/null && echo ${HOME} echo ${HOME} echo local readonly ${HOME} done
+readonly -eu local /usr/bin "$@" echo cd "$@" awk readonly
+		then done test "$1" --verbose test && "$@" awk --verbose grep ${HOME} x=1 echo $(pwd)
+	"$1" $(pwd) "$@" | test test --verbose x=1 -eu sed readonly
+		/usr/bin printf --verbose cd export then done x=1 export test "$1"
+		grep then ${HOME} && local awk export local export grep done export &&
+$(pwd) readonly 'quoted text'
+sed 2>/dev/null test echo
+		-eu 'quoted text' -eu
+sed readonly test ${HOME} cd test export cd export ${HOME} grep -eu | 2>/dev/null
+	done 2>/dev/null cd "$1" 2>/dev/null
+--verbose x=1 "$1" | export /usr/bin ${HOME} ${HOME} ${HOME}
+export 'quoted text' printf sed printf | readonly then readonly
+		awk | awk "$1" x=1 2>/dev/null
+sed && grep $(pwd) $(pwd) && "$1" export sed readonly
+		test grep done test local
+	2>/dev/null done done test done then -eu
+2>/dev/null ${HOME} 'quoted text' 'quoted text'
+		'quoted text' test | x=1 readonly "$1" grep echo awk $(pwd) readonly local
+	sed echo cd sed --verbose
+	cd 'quoted text' "$1" then export
+		/usr/bin --verbose /usr/bin
+		${HOME} && awk /usr/bin x=1 printf sed test --verbose readonly 'quoted text'
+	cd sed done then ${HOME} readonly ${HOME} test
+	-eu cd then sed export "$1" && readonly awk export echo "$@" -eu then 'quoted text'
+readonly 'quoted text' readonly echo /usr/bin awk 'quoted text'
+echo then ${HOME} 'quoted text' cd done
+	'quoted text' echo && cd echo "$@" ${HOME} grep /usr/bin
+		printf -eu "$@" 'quoted text' /usr/bin --verbose printf echo x=1 done echo awk then
+sed --verbose "$1" "$1" x=1 "$@" echo sed $(pwd) | 2>/dev/null 'quoted text' echo
+	cd printf grep | grep printf done export readonly "$1" echo $(pwd) 2>/dev/null
+${HOME} readonly ${HOME} && export
+	sed awk "$1" done x=1 2>/dev/null
+		export export 2>/dev/null sed
+		-eu | "$@" $(pwd) cd readonly
+		${HOME} ${HOME} then /usr/bin printf -eu "$@" export ${HOME}
+		echo | 'quoted text' echo $(pwd)
+	printf $(pwd) printf done
+-eu cd done --verbose printf
+done export test done --verbose printf cd $(pwd) $(pwd) ${HOME}
+		cd test then echo | "$@" export "$@" awk --verbose /usr/bin x=1 cd
+		done "$1" -eu ${HOME} grep x=1 "$1" readonly
+'quoted text' --verbose readonly $(pwd) "$1" test export export x=1 sed
+$(pwd) "$@" x=1 readonly -eu then
+local sed /usr/bin $(pwd) 2>/dev/null
+	| done "$1" --verbose export done 'quoted text' printf cd local
+	x=1 $(pwd) --verbose cd $(pwd) x=1 printf $(pwd) "$1"
+done then $(pwd) x=1 readonly --verbose printf grep | $(pwd) printf
+		"$@" ${HOME} readonly ${HOME}
+	2>/dev/null 2>/dev/null -eu test
+"$@" --verbose --verbose sed 2>/dev/null
+readonly cd done printf echo awk cd $(pwd) 2>/dev/null 2>/dev/null
+done grep /usr/bin test readonly printf
+		then cd echo grep printf | grep && local -eu &&
+	grep $(pwd) "$@" readonly && printf done
+		"$1" $(pwd) local --verbose readonly
+		2>/dev/null 2>/dev/null 2>/dev/null 'quoted text' done cd "$1" x=1 2>/dev/null
+	'quoted text' 2>/dev/null | ${HOME} cd
+	grep "$@" x=1 | sed | | then "$1"
+	"$1" ${HOME} then --verbose then
+		done -eu 2>/dev/null awk 'quoted text' printf | 2>/dev/null
+test cd 2>/dev/null export
+		readonly echo ${HOME} /usr/bin 2>/dev/null done export
+export ${HOME} | local printf
+		/usr/bin printf --verbose -eu done readonly "$@" $(pwd) x=1 cd local test printf
+		&& $(pwd) /usr/bin awk cd | grep --verbose
+		awk export 2>/dev/null then --verbose grep grep printf /usr/bin grep "$@"
+	--verbose 'quoted text' export -eu printf /usr/bin awk 'quoted text' export echo
+readonly awk | sed readonly --verbose "$@" -eu done "$1" x=1 test "$1" "$1" awk
+"$1" "$@" done cd 2>/dev/null 2>/dev/null "$@" ${HOME} printf done echo
+		| x=1 2>/dev/null test sed echo ${HOME} -eu
+	&& done cd export then awk -eu "$1" /usr/bin "$@" grep cd
+	| readonly && grep then /usr/bin
+		local && test "$@" grep --verbose -eu ${HOME} export -eu 2>/dev/null readonly
+		awk test then ${HOME} x=1 2>/dev/null
+${HOME} readonly 2>/dev/null sed grep export --verbose awk cd $(pwd)
+	/usr/bin sed test local cd ${HOME} 'quoted text' cd cd ${HOME} $(pwd) "$1"
+	/usr/bin readonly /usr/bin
+"$@" test "$1" printf "$@" "$@" sed "$@" echo ${HOME} | "$@" readonly test
+echo "$1" done echo "$1" local then x=1 echo echo 'quoted text' && then
+		/usr/bin ${HOME} -eu done "$1" "$1" test printf echo
+	awk printf -eu /usr/bin grep
+		-eu 2>/dev/null sed test $(pwd) cd | printf done readonly
+done | && awk | done x=1 export local x=1 "$1" export readonly $(pwd)
+		"$@" awk 'quoted text' ${HOME} -eu echo test then
+		2>/dev/null ${HOME} --verbose && echo readonly /usr/bin awk 2>/dev/null "$@" $(pwd)
+	export cd x=1 "$1" 2>/dev/null | test
+#include c253.sh
+		grep then then cd -eu "$1" awk $(pwd) 'quoted text' test -eu 'quoted text'
+	'quoted text' awk echo cd test printf grep /usr/bin /usr/bin
+'quoted text' local /usr/bin
+grep 'quoted text' test export readonly readonly --verbose grep
+x=1 --verbose "$1" ${HOME} done $(pwd)
+x=1 2>/dev/null then readonly $(pwd)
+		echo $(pwd) sed "$1" grep /usr/bin -eu grep then 'quoted text' 2>/dev/null done
+		"$1" ${HOME} local printf sed local readonly export awk 2>/dev/null test
+	"$1" cd echo sed echo local $(pwd) printf export $(pwd)
+x=1 --verbose $(pwd) ${HOME} "$@" then ${HOME}
+		readonly done "$1" readonly then -eu
+		done x=1 grep sed 2>/dev/null 'quoted text' test readonly -eu "$@" $(pwd)
+	2>/dev/null --verbose done done $(pwd) | done
+cd then then /usr/bin local done
+		2>/dev/null $(pwd) && x=1 awk cd --verbose echo readonly
+	"$1" readonly grep -eu x=1 2>/dev/null export "$@" test
+	sed done /usr/bin && && --verbose
+		${HOME} $(pwd) export done export test local local $(pwd) --verbose then echo "$1"
+&& sed /usr/bin && printf local "$1" sed grep awk 'quoted text'
+		--verbose 'quoted text' | test readonly export test grep -eu -eu done cd && local
+		/usr/bin $(pwd) cd grep test -eu --verbose export $(pwd) cd local 2>/dev/null
+		cd readonly "$@" printf done readonly
+		| then test 'quoted text' then &&
+	then ${HOME} readonly | awk "$@" cd export "$1" local -eu
+		printf $(pwd) -eu then cd && x=1 cd && cd --verbose grep awk then "$@" local then
+	readonly export printf --verbose &&
+	--verbose printf -eu then "$1" sed
+&& cd x=1 -eu cd 'quoted text' done grep export $(pwd) then readonly
+	| && echo test printf 2>/dev/null grep && export grep cd 'quoted text' export
+	x=1 cd /usr/bin "$1" "$@" x=1 -eu printf
+test done $(pwd) test $(pwd) --verbose
+${HOME} && then then ${HOME} cd -eu ${HOME} grep export x=1
+	x=1 --verbose -eu printf | then | test | readonly ${HOME} local printf /usr/bin
+export | test 2>/dev/null
+		done --verbose ${HOME} then export --verbose
+| export /usr/bin sed --verbose | && -eu && && export "$@" -eu ${HOME} then "$@"
+		x=1 readonly sed test done local -eu echo test ${HOME} ${HOME}
+	export echo cd && $(pwd)
+		/usr/bin "$@" sed "$@" printf then grep 2>/dev/null 2>/dev/null export done /usr/bin
+		&& && "$1" done 2>/dev/null x=1 readonly $(pwd) x=1
+	local readonly local x=1 grep | 'quoted text' export cd sed "$1" then
+	export done readonly awk | && && then local 2>/dev/null export export cd --verbose
+-eu "$@" x=1 | "$1" "$@" export /usr/bin 'quoted text' local
+		x=1 "$@" ${HOME} then ${HOME}
+		--verbose local --verbose | awk awk grep cd printf && echo /usr/bin
+	/usr/bin 'quoted text' "$@"
+	cd test && "$@" $(pwd)
+		${HOME} $(pwd) --verbose /usr/bin then $(pwd)
+	--verbose test test /usr/bin 2>/dev/null --verbose
+'quoted text' 2>/dev/null "$@" export /usr/bin | test printf
+	${HOME} $(pwd) --verbose /usr/bin export export
+		'quoted text' local sed done readonly echo printf
+		| | "$@" test 'quoted text'
+echo $(pwd) /usr/bin "$1" then cd /usr/bin /usr/bin $(pwd) sed
+	$(pwd) "$1" local "$@" then cd cd done 2>/dev/null
+		printf --verbose done --verbose | "$1" printf
+--verbose 'quoted text' /usr/bin /usr/bin printf then readonly sed 'quoted text'
+		done printf test grep 'quoted text'
+		cd x=1 then && local printf --verbose -eu x=1 | |
+	grep grep x=1 grep sed readonly x=1 --verbose
+	| readonly grep /usr/bin | readonly $(pwd) local ${HOME} test /usr/bin -eu
+	export --verbose local 2>/dev/null
+| "$1" echo grep -eu /usr/bin readonly printf "$1" awk |
+		grep 'quoted text' ${HOME} export cd ${HOME} /usr/bin
+		&& test awk done /usr/bin /usr/bin export awk then cd 2>/dev/null "$@" /usr/bin
+'quoted text' awk echo "$1" "$@" -eu ${HOME} test && awk "$@" x=1
+&& done done sed grep export | local "$1" test done test test done 'quoted text'
+		sed "$@" cd && echo grep --verbose
+then x=1 readonly $(pwd) awk x=1 then -eu | readonly ${HOME} grep -eu awk
+	"$1" 'quoted text' ${HOME} 'quoted text' readonly
+"$1" ${HOME} awk "$@"
+		&& readonly --verbose ${HOME} printf
+	"$1" cd awk local then test -eu ${HOME} export && && && 2>/dev/null
+	readonly sed x=1 done
+	sed printf 'quoted text' export x=1
+		${HOME} "$1" ${HOME} | && local
+	done sed ${HOME} grep && awk "$@" 'quoted text' -eu "$1" printf
+	--verbose ${HOME} 2>/dev/null sed cd --verbose
+	local 2>/dev/null --verbose readonly x=1 local --verbose "$@" then echo cd then
+x=1 echo --verbose sed readonly grep && printf $(pwd) test &&
+--verbose 'quoted text' ${HOME} local readonly x=1 echo
+	$(pwd) /usr/bin -eu cd then | --verbose
+		2>/dev/null && "$1" test awk "$@" && 'quoted text' -eu grep
+cd /usr/bin test printf 2>/dev/null "$1" readonly grep x=1 "$@" $(pwd) -eu
+--verbose echo 2>/dev/null test awk printf 'quoted text' sed local
+		${HOME} printf --verbose cd --verbose
+	then 2>/dev/null $(pwd) 'quoted text'
+printf 2>/dev/null 2>/dev/null ${HOME} readonly then local readonly test | /usr/bin
+	x=1 printf -eu cd 2>/dev/null "$1" grep sed ${HOME} && test 2>/dev/null
+	-eu printf $(pwd) printf readonly
+		then $(pwd) awk && --verbose done -eu 2>/dev/null -eu export && grep 2>/dev/null
+		&& 2>/dev/null "$@" grep done && printf awk 'quoted text' sed -eu then
+	done export readonly awk export printf
+		'quoted text' 2>/dev/null printf printf awk export local then
+		"$@" done --verbose export x=1 $(pwd) "$1" 'quoted text'
+	x=1 && test test 2>/dev/null && |
+	then then ${HOME} 'quoted text'
+		sed 'quoted text' export local | ${HOME}
+		local 'quoted text' && ${HOME} local export /usr/bin cd cd "$@" grep 2>/dev/null
+| done awk -eu "$1" done echo test "$@"
+		export | x=1 readonly x=1 'quoted text' readonly -eu done | then
+	echo export ${HOME} sed --verbose
+export 2>/dev/null x=1 && export ${HOME} echo x=1 x=1 readonly --verbose 2>/dev/null
+readonly sed -eu cd 2>/dev/null cd awk sed ${HOME}
+		then readonly x=1 "$1" echo grep "$1" |
+test -eu done "$@" -eu /usr/bin | echo sed then --verbose
+	awk x=1 export x=1 sed export echo $(pwd) /usr/bin
+		--verbose echo export ${HOME} export
+	${HOME} export $(pwd) readonly then -eu readonly 2>/dev/null ${HOME}
+		local test -eu printf echo | 'quoted text' x=1 done
+		"$1" ${HOME} x=1 'quoted text' && 2>/dev/null
+		test grep then 'quoted text' done cd cd awk 2>/dev/null printf
+	sed grep readonly local --verbose ${HOME} && ${HOME} ${HOME}
+		done --verbose sed printf -eu then 2>/dev/null
+	export cd $(pwd) -eu -eu | ${HOME}
+grep $(pwd) $(pwd) awk
+		then ${HOME} 2>/dev/null /usr/bin done "$1"
+	x=1 test export printf 2>/dev/null x=1 awk
+		awk x=1 then sed x=1 ${HOME} /usr/bin readonly
+	-eu local 2>/dev/null cd "$1" 2>/dev/null test $(pwd) awk then -eu test printf
+-eu 2>/dev/null -eu "$1" 'quoted text'
+		local | cd local 'quoted text' $(pwd)
+	grep "$@" ${HOME} printf printf $(pwd) 2>/dev/null then | x=1 'quoted text'
+	${HOME} readonly 'quoted text' x=1 "$@"
+	cd test 'quoted text' x=1 echo done /usr/bin $(pwd) cd $(pwd) 2>/dev/null &&
+	x=1 && ${HOME} 2>/dev/null export --verbose
+2>/dev/null 'quoted text' awk export /usr/bin ${HOME} then ${HOME}
+${HOME} && "$@" "$1" 2>/dev/null /usr/bin x=1 export "$@" 2>/dev/null cd x=1
+2>/dev/null awk "$@" grep ${HOME} awk "$@" local printf
+| printf echo $(pwd) -eu awk awk 2>/dev/null grep 'quoted text'
+$(pwd) cd "$1" sed export done /usr/bin readonly
+		export test | $(pwd) | echo -eu cd test done
+	sed sed done then $(pwd) awk "$@" && /usr/bin "$1" cd sed test -eu
+2>/dev/null local /usr/bin
+	$(pwd) "$1" sed 'quoted text' sed x=1 ${HOME} sed export "$1" -eu
+	"$@" -eu /usr/bin "$@" test then 'quoted text' && |
+test "$@" "$@" "$@" x=1 local 2>/dev/null
+"$1" awk && grep -eu printf && && done && 2>/dev/null
+		2>/dev/null | 'quoted text' cd printf done &&
+		'quoted text' --verbose local | local | printf -eu
+		done --verbose local sed printf ${HOME} grep awk cd echo echo
+		then grep && /usr/bin ${HOME} awk grep ${HOME} -eu done -eu printf
+	"$1" x=1 | cd --verbose
+		then printf readonly "$1" local -eu 2>/dev/null "$1" local
+		test "$1" export "$1" x=1 test then
+$(pwd) readonly | awk awk ${HOME} sed && readonly test cd cd ${HOME}
+		done x=1 x=1 2>/dev/null export -eu "$@" "$@" printf x=1 'quoted text'
+	local | "$1" sed --verbose awk x=1 done $(pwd) sed
+		--verbose export ${HOME} test sed 2>/dev/null
+		"$@" local "$@" 2>/dev/null && "$1" printf --verbose grep /usr/bin | done ${HOME}
+	export printf && 2>/dev/null done printf
+		sed grep x=1 export "$@" printf printf cd --verbose then
+		| cd 2>/dev/null test cd then $(pwd) x=1 cd
+		${HOME} x=1 -eu && && export
+	&& | $(pwd) ${HOME} test awk done export $(pwd) 2>/dev/null
+		then printf test | awk printf then 2>/dev/null
+	readonly grep | then
+		grep 'quoted text' test --verbose sed cd -eu grep
+	readonly | export then done x=1 sed -eu /usr/bin
+		awk readonly -eu local ${HOME} test --verbose x=1 x=1 awk
+		awk readonly -eu then done | awk grep | cd
+2>/dev/null x=1 cd | --verbose "$@" --verbose
+	test --verbose sed export sed ${HOME} "$1" x=1
+	done /usr/bin echo export -eu 2>/dev/null cd grep $(pwd) awk then then export
+	&& ${HOME} $(pwd) awk && x=1 "$@" 'quoted text'
+		${HOME} 'quoted text' 'quoted text' "$1" "$@"
+	| cd 'quoted text' local printf awk grep readonly sed cd
+"$1" local | --verbose test local --verbose --verbose | sed export
+		$(pwd) grep done cd grep local awk
+readonly $(pwd) grep ${HOME} test printf -eu printf
+echo done export cd | done 'quoted text'
+	--verbose sed && -eu | local local then done done readonly | $(pwd)
+	awk $(pwd) then local cd local grep "$1" "$1"
+	then grep $(pwd) -eu then then cd x=1 sed done 'quoted text'
+	echo $(pwd) local export awk 2>/dev/null $(pwd) $(pwd)
+	'quoted text' /usr/bin | awk /usr/bin echo cd && done printf readonly 'quoted text'
+	'quoted text' --verbose && --verbose
+		"$1" cd 2>/dev/null readonly && export echo $(pwd)
+cd ${HOME} printf cd && && sed done --verbose && 2>/dev/null echo test cd
+export printf $(pwd) ${HOME} readonly ${HOME} echo -eu "$1" "$1" echo /usr/bin
+	test export readonly readonly --verbose
+	$(pwd) export ${HOME} 'quoted text'
+then cd --verbose done echo test | test export
+&& /usr/bin local "$1"
+	"$1" test printf cd /usr/bin 2>/dev/null /usr/bin cd ${HOME} ${HOME}
+-eu test awk readonly && --verbose
+$(pwd) export printf "$@" 2>/dev/null $(pwd) export cd readonly
+done done ${HOME} 2>/dev/null
+cd 'quoted text' x=1 awk printf sed
+	'quoted text' cd 2>/dev/null /usr/bin --verbose sed readonly --verbose
+echo | test cd echo x=1 | /usr/bin 'quoted text' $(pwd) cd
+	export sed -eu && printf "$@" awk $(pwd) done 'quoted text' export then done "$1"
+	-eu readonly -eu sed 2>/dev/null grep /usr/bin
+	&& $(pwd) "$@" && awk
+cd | awk awk sed done && 2>/dev/null echo && grep readonly x=1
+	| export 2>/dev/null local | ${HOME} | cd export | test printf
+"$1" ${HOME} /usr/bin grep "$@" "$@" awk awk 'quoted text' printf
+readonly cd export /usr/bin sed echo done echo "$1"
+		echo cd | echo --verbose then local
+'quoted text' /usr/bin ${HOME} grep grep
+		grep grep sed printf done
+		done x=1 "$1" | cd 'quoted text' readonly x=1 done 'quoted text' export
+	awk test 2>/dev/null sed cd 'quoted text' local printf export test && then
+	grep ${HOME} 2>/dev/null awk grep -eu awk | test echo grep
+	&& cd | ${HOME} local export readonly $(pwd) test
+		sed local awk x=1 done 'quoted text'
+		2>/dev/null echo --verbose
+		then done --verbose -eu "$@" grep x=1 grep | then /usr/bin | sed | 2>/dev/null
+"$1" echo grep 'quoted text' "$@" 'quoted text' 2>/dev/null
+| | && $(pwd) printf x=1 done ${HOME} sed test
+-eu echo echo cd && -eu --verbose
+		awk /usr/bin 2>/dev/null $(pwd) ${HOME} -eu "$1" cd &&
+		export grep 'quoted text' done --verbose 2>/dev/null ${HOME} cd echo done export
+		x=1 grep /usr/bin awk /usr/bin test echo sed sed then
+x=1 x=1 grep 'quoted text' echo printf cd x=1 then
+	'quoted text' --verbose sed "$@" --verbose
+	"$1" ${HOME} printf "$@" | x=1 --verbose done && printf
+	x=1 2>/dev/null local grep 2>/dev/null $(pwd) cd done "$@" echo awk
+	sed ${HOME} sed /usr/bin readonly --verbose awk echo -eu awk cd then 2>/dev/null
+		grep printf /usr/bin
+--verbose export "$@" grep test "$@" /usr/bin x=1 2>/dev/null
+		readonly && grep | | 'quoted text' export 2>/dev/null
+	printf test printf -eu grep "$@" then awk | 'quoted text' test test sed
+		done printf export then /usr/bin --verbose readonly echo $(pwd)
+	x=1 local && sed 2>/dev/null
+		grep echo printf test --verbose --verbose "$@" awk /usr/bin export /usr/bin
+-eu cd ${HOME} && then export awk | "$@" then readonly 2>/dev/null x=1
+		awk -eu ${HOME} export readonly export "$@" 'quoted text' then | -eu $(pwd) --verbose
+		local echo 2>/dev/null x=1 done cd --verbose grep 'quoted text'
+test "$1" && local | | local local 'quoted text' readonly "$@"
+	then 'quoted text' && "$@" echo test awk readonly | && export | echo -eu
+	${HOME} 2>/dev/null ${HOME} then x=1 sed x=1 | ${HOME} $(pwd) -eu /usr/bin
+		local then ${HOME} readonly test && 'quoted text'
+		local "$1" 'quoted text' --verbose local -eu /usr/bin /usr/bin
+printf -eu done awk ${HOME}
+local x=1 cd $(pwd) /usr/bin grep 2>/dev/null $(pwd) x=1 x=1 x=1 awk echo then
+| -eu cd | printf x=1 readonly sed
+	cd sed printf /usr/bin printf "$1" test then x=1
+	$(pwd) readonly sed cd && && then awk local $(pwd) | 2>/dev/null
+	then $(pwd) local done awk awk | awk && x=1 export then 2>/dev/null
+	$(pwd) cd 'quoted text' "$1" --verbose "$@" $(pwd) | "$@" "$1"
+	/usr/bin --verbose ${HOME}
+2>/dev/null ${HOME} "$@" export printf readonly --verbose "$1" $(pwd)
+	done --verbose sed --verbose 2>/dev/null
+	x=1 "$1" local awk "$@"
+	$(pwd) -eu sed 2>/dev/null grep
+	export x=1 printf export export local grep 'quoted text'
+	printf cd $(pwd) test x=1 "$1" echo cd echo
+		then then --verbose --verbose local export done 2>/dev/null then
+	cd --verbose awk test ${HOME} $(pwd)
+printf echo --verbose awk cd "$1" done echo | $(pwd) $(pwd)
+		$(pwd) export ${HOME} x=1 export | printf 'quoted text'
+test echo readonly awk readonly readonly -eu done $(pwd) "$1"
+awk then local --verbose /usr/bin x=1 /usr/bin export
+	test local "$@" 2>/dev/null done printf 2>/dev/null $(pwd) 'quoted text' "$@"
+		printf cd sed ${HOME} done test /usr/bin sed $(pwd) cd
+awk grep --verbose echo ${HOME} cd cd x=1 grep
+		export awk x=1 'quoted text' local then grep "$1" awk sed cd then printf
+		x=1 "$1" awk cd 'quoted text' echo cd -eu local
+	"$1" 2>/dev/null "$@" --verbose 2>/dev/null
+	sed export | printf cd
+	${HOME} -eu then --verbose /usr/bin local grep "$@" local test export -eu -eu
+		readonly local printf printf "$@" echo awk
+	$(pwd) --verbose x=1 test 2>/dev/null
+echo printf export -eu local ${HOME} echo ${HOME} grep printf -eu cd "$1" then
+		readonly cd $(pwd) export cd then done
+		--verbose $(pwd) test printf -eu done --verbose
+		/usr/bin "$@" export ${HOME} sed /usr/bin
+	awk x=1 $(pwd) /usr/bin echo then awk sed grep
+		awk awk | done export | "$1" readonly grep "$@" done readonly "$@"
+	$(pwd) $(pwd) 'quoted text' ${HOME} local local grep "$1" test cd $(pwd) local "$1"
+	grep $(pwd) sed ${HOME} $(pwd) cd printf export
+	export local /usr/bin
+	--verbose 'quoted text' 'quoted text'
+grep awk 2>/dev/null export grep 2>/dev/null --verbose
+test $(pwd) awk test /usr/bin cd
+		cd 2>/dev/null | | 2>/dev/null /usr/bin "$1" -eu then sed awk
+grep sed --verbose grep printf
+printf x=1 $(pwd) echo readonly
+		"$@" test readonly && grep printf | /usr/bin "$1" | cd $(pwd)
+	test echo --verbose && local 'quoted text' && echo awk grep
+		--verbose then done x=1 cd readonly --verbose sed && /usr/bin export
+		2>/dev/null awk x=1 readonly test done local done 2>/dev/null
+grep sed | $(pwd) awk then && sed && awk
+	-eu then echo awk | x=1 test | local x=1 done 2>/dev/null "$@"
+	cd -eu 2>/dev/null export -eu printf export readonly done export
+| cd ${HOME} 2>/dev/null "$1" "$@" printf | local test readonly printf readonly
+test local --verbose "$@" test x=1 echo ${HOME} -eu
+		&& -eu done printf -eu -eu "$1" echo then /usr/bin local "$@" done done readonly
+	readonly $(pwd) local
+		done test -eu grep cd 'quoted text' "$@" -eu $(pwd) done
+--verbose "$@" "$@" readonly
+	echo "$@" x=1 --verbose awk --verbose printf
+	sed printf printf local $(pwd) grep "$@" sed 'quoted text'
+2>/dev/null cd export 2>/dev/null "$1" 'quoted text' ${HOME} 'quoted text' awk
+	test grep awk -eu local cd done 'quoted text'
+		readonly then -eu local "$1" test grep "$1" | grep echo test && readonly
+${HOME} ${HOME} readonly printf $(pwd) /usr/bin printf 'quoted text'
+	grep x=1 ${HOME} local "$1" ${HOME} x=1 readonly "$1" ${HOME} $(pwd)
+| sed then 2>/dev/null done --verbose test "$@" grep
+		$(pwd) printf awk echo "$1" x=1 ${HOME} echo readonly test --verbose | sed /usr/bin
+	x=1 then done "$1" "$@" -eu then /usr/bin
+	| sed | export "$@" grep --verbose 2>/dev/null x=1
+test export printf 'quoted text' ${HOME} export /usr/bin done $(pwd) -eu
+"$1" test /usr/bin grep | $(pwd) $(pwd) printf done export && /usr/bin then echo
+		/usr/bin ${HOME} x=1 && 2>/dev/null 'quoted text' $(pwd) 2>/dev/null
+		| test then ${HOME} echo 'quoted text' ${HOME} echo done export && then $(pwd)
+		cd --verbose test -eu local done export -eu sed grep /usr/bin
+		| && "$@" printf $(pwd) "$@" test export "$1" export
+		-eu readonly && printf then sed x=1 $(pwd) x=1
+		grep printf -eu "$1" ${HOME}
+		-eu export --verbose x=1 test local echo cd done
+	local echo --verbose | sed -eu 'quoted text' grep printf grep
+done "$@" local then $(pwd) | $(pwd) local
+cd $(pwd) export printf then awk x=1 "$@" $(pwd) && awk 2>/dev/null
+--verbose /usr/bin done /usr/bin test --verbose x=1 cd -eu echo grep 2>/dev/null
+2>/dev/null printf | test echo local local /usr/bin $(pwd) $(pwd) x=1 local --verbose
+		-eu grep printf x=1 export printf readonly "$@" sed export
+"$@" readonly 2>/dev/null
+cd "$1" --verbose && echo
+| grep awk awk awk /usr/bin
+readonly x=1 | local 'quoted text' x=1 && /usr/bin
+	${HOME} 2>/dev/null test 'quoted text' awk | --verbose
+		"$1" $(pwd) x=1 --verbose test x=1 "$@" --verbose local sed ${HOME} --verbose
+	${HOME} echo 2>/dev/null printf && && done
+	/usr/bin local x=1 x=1
+then 'quoted text' "$@" -eu "$@" done echo grep then x=1 "$@" local
+		"$1" 'quoted text' awk x=1 && test then cd 'quoted text' echo /usr/bin 2>/dev/null
+		sed x=1 && "$@" --verbose test /usr/bin x=1 export readonly awk readonly
+$(pwd) $(pwd) printf done
+$(pwd) cd -eu "$1" 'quoted text' echo && grep | echo test readonly
+readonly 'quoted text' test readonly /usr/bin echo test x=1
+grep done --verbose printf done printf local readonly | test ${HOME}
+	${HOME} --verbose | && sed 'quoted text' "$@"
+	then "$@" cd 2>/dev/null --verbose export 2>/dev/null
+-eu | grep grep sed --verbose export sed readonly "$@" local awk 'quoted text'
+	/usr/bin 2>/dev/null awk "$1" | sed && | printf --verbose
+cd done printf export cd cd export "$1" then readonly awk awk
+		readonly readonly $(pwd) done done "$1" done done export ${HOME} 'quoted text'
+	-eu export 2>/dev/null
+	local readonly --verbose
+	${HOME} printf "$1" "$1" printf "$@" awk ${HOME}
+	| printf test test awk awk $(pwd)
+printf local then && sed done --verbose && test readonly
+		test --verbose sed awk test x=1 then && ${HOME} | cd
+		done x=1 grep export test done $(pwd) x=1 export test | grep
+	--verbose awk grep /usr/bin
+		${HOME} | local 2>/dev/null x=1 'quoted text'
+	-eu readonly x=1 /usr/bin export 2>/dev/null | "$1" ${HOME} echo echo
+then printf | readonly cd cd done echo readonly local done -eu export sed local
+export printf && 'quoted text' then readonly -eu export | test
+	'quoted text' 2>/dev/null 2>/dev/null test /usr/bin awk && | 2>/dev/null printf
+	--verbose ${HOME} test export && grep
+		x=1 "$@" | printf awk done 'quoted text' grep 2>/dev/null 2>/dev/null
+echo then "$@" "$@" -eu awk $(pwd)
+		--verbose export /usr/bin printf |
+	x=1 "$1" && printf 'quoted text' 'quoted text' | grep test test local
+	awk && cd | 2>/dev/null local ${HOME} done printf "$1" -eu /usr/bin 'quoted text'
+then done sed awk then echo cd /usr/bin cd cd --verbose grep 'quoted text'
+then --verbose --verbose | "$1"
+	sed awk /usr/bin cd x=1 "$1" sed
+	${HOME} export sed 2>/dev/null awk echo && x=1 -eu "$@"
+done | | ${HOME} done done readonly echo 'quoted text'
+		then sed local -eu cd then
+		then local ${HOME} export 2>/dev/null
+| && awk "$@" echo "$@" 2>/dev/null
+	sed && then x=1 ${HOME}
+	"$@" && ${HOME} $(pwd) ${HOME} $(pwd) -eu awk "$@" export done then done | cd -eu
+/usr/bin $(pwd) 2>/dev/null 'quoted text' cd 'quoted text'
+cd grep && echo cd "$@" echo test -eu then ${HOME} echo | ${HOME} "$@" sed "$@"
+"$@" "$1" --verbose done | cd /usr/bin local
+		'quoted text' /usr/bin -eu 'quoted text'
+echo printf x=1 'quoted text'
+	-eu x=1 -eu -eu -eu | then 'quoted text' "$1" done local
+local test echo /usr/bin $(pwd)
+printf x=1 export sed ${HOME} done 2>/dev/null "$1" | x=1 2>/dev/null
+		/usr/bin done cd echo sed readonly test grep "$1" -eu test
+		printf grep echo && echo 2>/dev/null --verbose awk sed echo
+	test local $(pwd) x=1 "$@" "$@" grep -eu "$1" test then printf --verbose
+		${HOME} grep done "$1" cd "$1" sed test 2>/dev/null awk export
+		"$1" done readonly 2>/dev/null grep --verbose --verbose printf
+		2>/dev/null && then cd ${HOME}
+		echo test local $(pwd)
+		echo then $(pwd) "$@" 2>/dev/null | awk sed -eu x=1 x=1 printf sed grep local
+		awk sed x=1 x=1 then "$@" && 2>/dev/null echo "$1" printf grep printf test
+		test cd export ${HOME} | printf && --verbose --verbose 'quoted text'
+| awk && | --verbose ${HOME} /usr/bin readonly test export | "$@" $(pwd) 2>/dev/null
+		x=1 $(pwd) 'quoted text'
+		${HOME} local "$1" x=1 cd $(pwd) ${HOME}
+		/usr/bin echo export echo --verbose
+		"$1" x=1 sed awk test grep readonly x=1 ${HOME} | export 'quoted text'
+2>/dev/null && then cd local awk
+readonly sed grep 2>/dev/null local ${HOME} "$1"
+		grep ${HOME} && echo done echo cd | sed printf $(pwd) cd test -eu x=1
+		${HOME} sed export "$@" /usr/bin $(pwd) done $(pwd)
+		local local cd echo then | && $(pwd) --verbose
+	cd 2>/dev/null readonly
+		"$@" x=1 | -eu export readonly sed 2>/dev/null 2>/dev/null ${HOME} 2>/dev/null
+readonly 2>/dev/null $(pwd) "$@" $(pwd)
+$(pwd) && cd | /usr/bin sed readonly --verbose
+	'quoted text' 'quoted text' cd "$@" test printf printf x=1
+	test then done x=1 /usr/bin x=1 "$@" local export 'quoted text' done
+	${HOME} grep --verbose 'quoted text' --verbose
+		--verbose && local cd | 2>/dev/null ${HOME}
+	sed export sed done "$@" readonly ${HOME} 'quoted text' 'quoted text' ${HOME}
+	'quoted text' awk ${HOME} x=1 export then sed echo ${HOME} --verbose export
+then cd "$@" && "$1" readonly | then readonly $(pwd) "$1" && x=1 x=1 -eu sed x=1
+'quoted text' awk "$1" echo --verbose
+	local 2>/dev/null /usr/bin $(pwd) printf && readonly test -eu export
+printf test then -eu 'quoted text' test x=1 test "$@" sed awk "$1" |
+	cd "$1" printf --verbose sed --verbose echo -eu $(pwd) local -eu --verbose sed
+		"$@" ${HOME} "$@" "$1" "$@" --verbose
+	$(pwd) readonly readonly local sed sed export echo "$@"
+echo export && done awk && -eu ${HOME} "$@" echo | done printf $(pwd)
+	printf $(pwd) grep sed sed awk sed /usr/bin sed echo awk
+export local -eu "$1" test echo export echo done ${HOME}
+		| "$1" 2>/dev/null 2>/dev/null | "$1" awk awk echo printf | 'quoted text'
+	cd export /usr/bin export | 2>/dev/null
+then printf readonly awk
+	2>/dev/null 2>/dev/null && awk --verbose test x=1 grep cd 'quoted text' 'quoted text'
+$(pwd) 'quoted text' && "$@" test /usr/bin $(pwd) ${HOME} "$@" export "$1" 2>/dev/null
+		then done sed done awk 'quoted text'
+	cd "$1" test 'quoted text' test --verbose readonly
+	echo local export "$@" export 'quoted text'
+	-eu --verbose readonly $(pwd) echo test then 2>/dev/null readonly
+		grep done awk cd "$1" grep grep local "$1" |
+	${HOME} cd then && cd grep echo test test cd
+		x=1 cd done 2>/dev/null then /usr/bin sed
+"$1" 2>/dev/null x=1 "$@"
+	then sed x=1 | then printf awk printf grep then sed test test export $(pwd)
+		echo $(pwd) 2>/dev/null 'quoted text' ${HOME}
+	&& printf --verbose "$@"
+		/usr/bin test echo readonly awk 2>/dev/null
+	$(pwd) && $(pwd) --verbose
+	-eu sed $(pwd) awk local && x=1 printf 2>/dev/null 2>/dev/null done then printf
+		| awk sed done -eu /usr/bin awk -eu then export readonly awk
+	-eu then then 2>/dev/null
+--verbose sed sed sed echo 'quoted text' then
+	test /usr/bin x=1 local test done grep "$1" then then -eu x=1 ${HOME} printf export
+${HOME} /usr/bin local && 'quoted text' 'quoted text' /usr/bin
+local 2>/dev/null | && --verbose
+		${HOME} ${HOME} $(pwd) && ${HOME} "$@" x=1 "$@" -eu done
+		local then "$1" export then sed test x=1 "$@" && /usr/bin printf 'quoted text'
+	done -eu echo done x=1 grep cd $(pwd)
+echo echo && done sed "$@" printf "$1" cd ${HOME}
+cd then --verbose -eu readonly --verbose sed export readonly
+	test sed local cd "$@" echo --verbose
+	--verbose --verbose grep 'quoted text'
+grep "$@" local cd -eu test printf x=1 /usr/bin -eu x=1 ${HOME}
+"$@" readonly sed "$@" --verbose cd sed 2>/dev/null echo local x=1
+$(pwd) echo printf 2>/dev/null
+&& && -eu export awk /usr/bin done -eu $(pwd) test "$@" 'quoted text' then
+		printf /usr/bin test awk "$1" $(pwd)
+/usr/bin ${HOME} cd echo echo local sed then 'quoted text' local
+	'quoted text' /usr/bin 'quoted text' grep sed /usr/bin && local | cd echo -eu
+/usr/bin sed -eu local x=1 grep -eu "$1" | x=1 -eu
+	readonly local test /usr/bin && readonly awk awk grep 2>/dev/null --verbose "$1"
+${HOME} test $(pwd) export cd | --verbose "$1" "$@" done /usr/bin -eu 'quoted text'
+	-eu --verbose 'quoted text' | done done "$@"
+"$1" then local ${HOME} then && export ${HOME} /usr/bin grep -eu "$1" 2>/dev/null
+	'quoted text' sed export "$@" cd done 'quoted text' 'quoted text'
+	&& sed 2>/dev/null /usr/bin printf --verbose --verbose "$1"
+		'quoted text' test 2>/dev/null /usr/bin cd done readonly $(pwd)
+&& "$@" done $(pwd) test
+		local sed -eu local sed "$1" readonly 2>/dev/null
+readonly -eu --verbose cd export readonly 'quoted text' cd done
+local test sed sed test sed | -eu
+		"$@" /usr/bin printf x=1 && test 2>/dev/null local 2>/dev/null
+		| then test cd 'quoted text' "$1" "$@" "$@" ${HOME}
+		awk && export | -eu readonly 2>/dev/null cd export grep x=1 x=1
+		export awk && done --verbose 2>/dev/null --verbose export "$1" --verbose
+cd && /usr/bin x=1 done export awk 2>/dev/null --verbose "$@" | done
+		| cd /usr/bin -eu ${HOME}
+		${HOME} echo cd ${HOME} x=1 -eu
+	"$@" --verbose readonly awk done 'quoted text' local printf awk export
+		-eu then test done sed x=1 sed cd sed local -eu grep export 'quoted text'
+	grep -eu | test --verbose x=1 done
+awk test then done 2>/dev/null /usr/bin
+		| readonly echo | x=1 "$1" export then done printf
+x=1 /usr/bin printf readonly
+done "$@" 2>/dev/null done readonly $(pwd) sed sed
+	cd -eu then echo readonly test
+		x=1 "$@" grep sed --verbose ${HOME}
+	local local -eu x=1 -eu ${HOME} done echo 2>/dev/null 2>/dev/null printf
+		x=1 $(pwd) grep /usr/bin | x=1 readonly
+		$(pwd) "$@" 'quoted text' && ${HOME}
+	readonly test readonly -eu export ${HOME}
+	"$@" /usr/bin -eu then printf echo
+	--verbose sed export done x=1 'quoted text' readonly --verbose --verbose
+done $(pwd) 'quoted text'
+	done export -eu "$@" then sed | cd "$1" x=1 ${HOME} --verbose grep
+| echo $(pwd) cd echo awk
+"$1" /usr/bin grep grep grep cd cd "$1" 'quoted text'
+		'quoted text' test --verbose then
+$(pwd) /usr/bin awk grep awk grep printf echo | cd x=1 'quoted text'
+	"$1" "$1" awk export $(pwd) ${HOME} local "$1"
+		grep test | 2>/dev/null 2>/dev/null -eu $(pwd) x=1 "$1" "$1" export export
+		test 2>/dev/null printf done $(pwd) export -eu 2>/dev/null
+cd ${HOME} done grep "$@" "$1" printf && $(pwd) printf done readonly
+	grep 'quoted text' local readonly 2>/dev/null 'quoted text'
+	then grep readonly x=1 echo /usr/bin --verbose x=1 grep
+	&& "$@" export --verbose then export local
+		$(pwd) test readonly local local x=1 x=1 -eu ${HOME} cd 2>/dev/null
+		${HOME} cd awk printf | --verbose awk 2>/dev/null --verbose -eu ${HOME} -eu sed
+${HOME} grep export done x=1
+		'quoted text' --verbose echo | "$@" -eu 2>/dev/null echo
+${HOME} "$@" -eu | /usr/bin x=1 done readonly x=1 "$@" awk local $(pwd)
+${HOME} then test $(pwd) | done echo "$1"
+		export $(pwd) echo export $(pwd) --verbose $(pwd) awk --verbose "$1" cd -eu sed
+--verbose then awk 'quoted text' "$1" export && "$@" echo "$1"
+cd --verbose echo test --verbose ${HOME}
+	"$1" export -eu --verbose && local done --verbose
+	&& x=1 --verbose echo then -eu test test cd "$@"
+		$(pwd) /usr/bin awk awk test grep /usr/bin ${HOME} "$1" done grep
+		done then 2>/dev/null readonly $(pwd) 'quoted text' /usr/bin awk awk
+echo x=1 --verbose $(pwd) local /usr/bin
+awk && -eu 2>/dev/null 'quoted text'
+	done "$1" | x=1 test local 2>/dev/null
+	test "$@" cd printf echo 2>/dev/null -eu printf $(pwd) export "$1" then then
+	${HOME} /usr/bin ${HOME} readonly echo printf grep x=1 | 2>/dev/null -eu readonly
+	${HOME} readonly test 2>/dev/null echo $(pwd)
+		| printf readonly ${HOME} x=1 "$1" cd then sed grep
+		'quoted text' printf test cd local printf printf $(pwd)
+--verbose local | printf echo grep done
+	sed local $(pwd) "$@" done export x=1 awk cd echo done /usr/bin cd echo
+		--verbose | echo 2>/dev/null -eu --verbose sed && x=1 export /usr/bin
+grep sed "$@" 'quoted text'
+		&& done printf /usr/bin | export printf && cd then x=1 local x=1 sed sed export
+	&& grep grep --verbose sed | "$1" "$@" | echo 2>/dev/null
+	"$@" local local /usr/bin awk "$@" cd printf echo | sed && test printf then echo
+		-eu 2>/dev/null "$1" -eu test 'quoted text'
+		done grep done ${HOME} 'quoted text' "$1" ${HOME} x=1 -eu cd 2>/dev/null
+		-eu && -eu sed export /usr/bin "$1" 2>/dev/null x=1 -eu "$@" x=1 printf
+		sed awk sed export "$@"
+test awk awk export "$1" readonly --verbose test $(pwd) --verbose "$1" x=1 -eu
+	| echo --verbose awk -eu | awk export awk
+		"$1" local "$@" awk "$@" export test /usr/bin "$1" sed &&
+		export | readonly 2>/dev/null echo "$@" cd &&
+		--verbose x=1 && sed test x=1 then
+	sed awk "$@" printf echo cd && ${HOME} ${HOME} --verbose x=1 cd
+		export /usr/bin "$@" export $(pwd)
+		--verbose awk readonly -eu local grep awk then done --verbose
+then && | 'quoted text' && $(pwd)
+	2>/dev/null --verbose test 'quoted text' printf sed
+	then done grep then 2>/dev/null
+		'quoted text' $(pwd) sed $(pwd)
+	'quoted text' | cd done && grep
+readonly | done /usr/bin cd then "$1" && 'quoted text' | local
+&& cd 2>/dev/null then | /usr/bin done
+		"$@" test grep 'quoted text' "$@" -eu 2>/dev/null
+		export printf printf local test "$1" grep 'quoted text'
+	printf $(pwd) then /usr/bin echo readonly echo
+| readonly /usr/bin sed local awk awk 'quoted text' --verbose
+	done 2>/dev/null 2>/dev/null $(pwd) printf | test "$1" cd echo printf printf done
+		local test $(pwd) | grep | && printf $(pwd) test cd echo sed "$1"
+		test readonly test awk 2>/dev/null "$1" -eu awk && cd done /usr/bin --verbose
+$(pwd) export readonly ${HOME} done cd $(pwd) awk grep | awk 2>/dev/null
+		/usr/bin test done sed ${HOME} ${HOME} ${HOME} 2>/dev/null 'quoted text'
+		awk --verbose -eu --verbose
+		-eu export && && export x=1 | --verbose
+		-eu test "$@" /usr/bin echo done echo 'quoted text' 2>/dev/null
+export export printf x=1 'quoted text' 2>/dev/null test then && $(pwd) grep sed
+test x=1 test "$@" "$1" grep awk done | -eu ${HOME} readonly && done 'quoted text'
+$(pwd) 'quoted text' /usr/bin test 2>/dev/null
+		grep cd done test readonly && 'quoted text' cd ${HOME} /usr/bin
+	then test sed local sed | "$@" readonly --verbose $(pwd) sed
+done awk printf x=1 "$@" then -eu && test -eu done done $(pwd) 'quoted text' --verbose
+		&& grep readonly -eu /usr/bin x=1 $(pwd) readonly "$@" done
+export x=1 cd done then x=1 printf readonly "$@"
+readonly sed cd ${HOME} test awk
+		readonly test echo ${HOME} readonly cd then printf
+	2>/dev/null "$@" && $(pwd) 'quoted text' awk done test 2>/dev/null done
+		then ${HOME} local local
+	$(pwd) export -eu awk sed printf export export test done local readonly
+	x=1 "$1" 2>/dev/null cd readonly grep printf
+export awk then readonly /usr/bin then | x=1
+	readonly local test printf export printf -eu "$@" $(pwd) grep /usr/bin awk && $(pwd)
+	--verbose "$@" ${HOME} 2>/dev/null then
+		sed | 'quoted text' local x=1 ${HOME} awk "$1" x=1
+		$(pwd) /usr/bin local echo x=1 done readonly cd "$1" 2>/dev/null
+		grep printf /usr/bin ${HOME} "$@" && -eu /usr/bin x=1 cd -eu test && && printf
+done local sed $(pwd) /usr/bin && | "$@" $(pwd) "$1" done cd $(pwd) $(pwd)
+&& 'quoted text' 'quoted text' printf 'quoted text' -eu local awk ${HOME} --verbose
+		grep then /usr/bin awk
+	then | 2>/dev/null 'quoted text' /usr/bin ${HOME}
+	2>/dev/null 2>/dev/null ${HOME} printf local
+	"$@" 'quoted text' echo cd "$@" sed x=1 grep done $(pwd) ${HOME} 'quoted text'
+		then test export readonly --verbose -eu printf /usr/bin
+	$(pwd) "$@" then test | awk then /usr/bin 2>/dev/null sed |
+		$(pwd) readonly local echo awk ${HOME} sed then done | -eu /usr/bin
+	done export echo test "$@" local | && cd &&
+${HOME} cd readonly | "$1" grep printf export
+	echo "$@" cd readonly x=1
+local -eu --verbose test ${HOME}
+/usr/bin grep printf "$@" awk
+		| export ${HOME} | test "$@" done "$@" readonly |
+		awk readonly then printf printf sed test &&
+${HOME} sed -eu ${HOME} "$@" | --verbose echo --verbose $(pwd)
+2>/dev/null | "$1" grep 'quoted text'
+		grep | done done grep /usr/bin -eu export awk test readonly /usr/bin
+awk -eu -eu sed cd echo /usr/bin cd printf "$@" ${HOME}
+		export && sed export test | grep printf
+"$@" | export echo printf readonly | x=1 x=1 "$@" readonly grep x=1 &&
+		printf "$1" --verbose $(pwd) "$@" 'quoted text'
+		then "$1" printf done
+		test sed 2>/dev/null -eu | "$1" -eu awk 2>/dev/null 'quoted text' export
+		done done -eu -eu && $(pwd)
+		/usr/bin --verbose | done export export ${HOME}
+echo --verbose ${HOME} 2>/dev/null readonly echo export done cd then test
+	awk --verbose done ${HOME} export "$@" --verbose
+	then grep echo test | test
+		x=1 && $(pwd) ${HOME} | x=1 /usr/bin awk "$1" grep ${HOME} sed --verbose
+printf export /usr/bin readonly then
+	echo awk sed x=1 x=1 local -eu x=1 ${HOME} $(pwd) printf awk then /usr/bin 'quoted text'
+		awk export cd then echo grep "$1" | $(pwd) awk 'quoted text' && /usr/bin 2>/dev/null
+local test export awk
+${HOME} test $(pwd) local cd
+	readonly /usr/bin | sed 2>/dev/null --verbose
+	local 2>/dev/null readonly ${HOME} echo export --verbose
+		cd $(pwd) echo 'quoted text' export printf -eu -eu export
+		echo grep cd "$1" readonly awk --verbose |
+	awk --verbose local "$1" grep local export
+	export && "$1" done x=1 2>/dev/null "$@" echo --verbose
+	| "$@" x=1 $(pwd) echo ${HOME} "$1" test awk sed grep "$1" 2>/dev/null
+		cd grep test 'quoted text' local 'quoted text' x=1 test -eu done && 'quoted text'
+	&& then local | -eu test awk export /usr/bin test sed -eu done ${HOME}
+		${HOME} grep 'quoted text' "$@" readonly
+		export x=1 $(pwd) test --verbose
+		export grep echo "$1"
+	"$1" awk grep "$@" printf --verbose
+	test test /usr/bin then echo "$1" done && --verbose 2>/dev/null --verbose then
+	${HOME} "$1" local | 2>/dev/null 'quoted text' && "$@"
+export sed $(pwd) cd x=1 test local cd local && "$@" export
+	cd "$1" cd | awk local "$@" -eu | readonly awk then then cd grep
+	printf sed cd "$@" readonly "$1" echo
+	grep 'quoted text' -eu -eu readonly $(pwd) /usr/bin test export readonly -eu "$1"
+	readonly awk x=1 echo -eu cd readonly grep
+		/usr/bin printf readonly done | 'quoted text'
+printf /usr/bin sed cd sed ${HOME} sed --verbose readonly --verbose x=1 "$1"
+		then "$1" printf /usr/bin test
+cd | local local local cd -eu test local -eu -eu readonly awk --verbose
+		cd -eu local "$1" | printf grep /usr/bin awk &&
+	awk local printf $(pwd) /usr/bin ${HOME} -eu cd x=1 echo test readonly grep
+	sed local readonly x=1 "$@" "$@" done grep -eu then awk then cd
+		done -eu echo /usr/bin
+done export cd readonly "$@" -eu awk readonly 'quoted text' echo sed 'quoted text'
+readonly cd cd $(pwd)
+| "$1" grep && export export && x=1 echo sed $(pwd) -eu done "$@" done
+		cd 2>/dev/null grep --verbose && grep -eu then
+		&& local export "$1" grep -eu -eu 2>/dev/null cd $(pwd) cd done sed cd export
+		"$1" grep 2>/dev/null "$@" /usr/bin 2>/dev/null
+	x=1 cd -eu sed /usr/bin 2>/dev/null sed grep
+	echo "$@" x=1 local export x=1 export echo readonly printf
+	test --verbose ${HOME} | printf 'quoted text' printf local "$@" 2>/dev/null
+		sed /usr/bin 'quoted text' done "$@" $(pwd) readonly
+&& $(pwd) "$@" local 2>/dev/null grep grep
+done test --verbose | then sed then
+	$(pwd) done export echo 'quoted text' /usr/bin then awk 'quoted text' -eu sed
+	"$1" local "$@" /usr/bin echo
+	$(pwd) done done && -eu cd done "$1" done /usr/bin
+	sed x=1 "$@" done "$@" x=1 echo sed --verbose $(pwd) then test grep sed printf
+	readonly $(pwd) ${HOME}
+2>/dev/null $(pwd) &&
+		export local grep $(pwd) && readonly $(pwd) readonly
+		test x=1 echo /usr/bin
+	2>/dev/null $(pwd) "$1" $(pwd) x=1 then
+	2>/dev/null cd then local $(pwd) "$1" test
+		grep x=1 2>/dev/null ${HOME} --verbose 2>/dev/null
+		-eu && printf then "$@" 2>/dev/null sed readonly
+local --verbose x=1 | --verbose && local "$1" then echo /usr/bin x=1 /usr/bin
+awk then /usr/bin printf sed done cd printf | ${HOME}
+		&& echo then readonly local $(pwd) export
+		x=1 awk && then --verbose 'quoted text' test
+	test /usr/bin -eu export awk $(pwd) -eu test $(pwd) "$1" awk 2>/dev/null
+	echo sed printf readonly readonly
+		awk echo awk sed $(pwd) cd ${HOME} local && $(pwd) awk awk |
+		"$@" --verbose | export readonly -eu | 'quoted text' /usr/bin local "$1" done
+	--verbose sed -eu sed test /usr/bin && printf -eu sed echo "$@" $(pwd) awk
+		&& awk echo readonly printf
+-eu sed then awk grep sed $(pwd) /usr/bin done | --verbose printf
+echo printf printf echo 2>/dev/null cd "$@" export cd -eu
+		${HOME} done ${HOME} printf local test x=1
+		test then "$1" $(pwd) | -eu export
+	| grep --verbose | /usr/bin --verbose "$1" $(pwd) && grep "$@" ${HOME}
+x=1 grep printf done readonly
+		local done --verbose /usr/bin local then test
+	awk grep printf then x=1 -eu sed test then
+	awk "$1" cd $(pwd) readonly /usr/bin $(pwd) ${HOME} echo | awk /usr/bin
+		grep --verbose printf /usr/bin $(pwd) /usr/bin /usr/bin $(pwd) $(pwd) export
+		grep sed -eu "$1" /usr/bin done
+	/usr/bin $(pwd) readonly printf printf cd && $(pwd) $(pwd) export cd export
+printf cd -eu "$@" printf sed export "$1" echo
+	2>/dev/null | 2>/dev/null -eu 2>/dev/null printf | grep local /usr/bin done
+		cd --verbose local then sed --verbose local test --verbose echo grep
+| done done "$@" "$@" sed sed
+	2>/dev/null echo 'quoted text'
+		x=1 /usr/bin test /usr/bin then /usr/bin printf && && | sed printf
+	&& ${HOME} ${HOME} awk echo -eu && | sed export test done done x=1 awk awk done
+	awk ${HOME} cd && && then /usr/bin export "$@"
+		local grep $(pwd) done | x=1 /usr/bin local && awk then test
+		"$@" "$1" --verbose cd echo -eu --verbose && printf test 2>/dev/null
+	then 'quoted text' $(pwd) | then --verbose
+	printf "$1" export echo
+"$@" /usr/bin x=1 2>/dev/null local
+	echo then export ${HOME} grep local done export sed --verbose
+	then readonly && x=1 printf ${HOME} done 2>/dev/null ${HOME}
+	x=1 x=1 readonly x=1 echo echo grep local 2>/dev/null awk "$1" 2>/dev/null
+	done --verbose "$@" export sed local printf test 2>/dev/null "$@" 'quoted text'
+		done readonly done echo cd readonly -eu ${HOME} then
+		done | then "$@" printf test
+		&& | echo awk | grep "$1" /usr/bin test | "$1" echo "$1" /usr/bin 2>/dev/null
+	$(pwd) x=1 && test ${HOME}
+--verbose /usr/bin grep then test done local
+printf sed grep 'quoted text' printf
+		"$@" $(pwd) echo test /usr/bin
+		done export "$@" export then test export
+		export "$1" ${HOME} 2>/dev/null "$@" echo
+&& /usr/bin grep -eu 2>/dev/null printf "$1" test "$1" awk "$1" echo
+	--verbose echo export 'quoted text' "$1" grep export test 'quoted text' then ${HOME}
+	'quoted text' && && /usr/bin && awk local ${HOME} sed ${HOME} ${HOME} "$1"
+	test local sed readonly 2>/dev/null -eu printf done printf printf -eu ${HOME}
+cd /usr/bin printf then done x=1 /usr/bin local done
+		cd x=1 "$1" done ${HOME} --verbose 'quoted text' echo | /usr/bin --verbose
+		"$1" ${HOME} && --verbose
+sed sed "$@" echo "$1" then cd "$1" $(pwd) /usr/bin x=1 --verbose
+		&& 'quoted text' && then local x=1 -eu
+		done test && $(pwd) "$@" then ${HOME}
+	-eu | sed | /usr/bin local --verbose echo x=1 ${HOME} then readonly readonly
+		/usr/bin then sed "$1" sed
+then "$1" sed && x=1
+done x=1 x=1 grep --verbose
+/usr/bin /usr/bin && "$@" then export -eu ${HOME} sed 'quoted text'
+		&& awk && test awk "$@" && | sed then 2>/dev/null echo then export
+	done ${HOME} readonly /usr/bin sed test && done ${HOME}
+	readonly && && cd awk ${HOME} echo -eu local | --verbose "$1"
+		2>/dev/null echo --verbose "$1" -eu "$1"
+	grep 'quoted text' 'quoted text' done
+		cd -eu printf "$@" done local grep
+/usr/bin "$1" 2>/dev/null export ${HOME}
+	printf /usr/bin awk "$1" "$1" "$1" --verbose printf | | local
+--verbose 'quoted text' -eu && | export echo /usr/bin "$@"
+		local x=1 /usr/bin ${HOME} cd cd $(pwd) test printf
+		cd readonly export &&
+local && $(pwd) test sed done echo done -eu 2>/dev/null "$1"
+		local local echo "$1" /usr/bin "$@" printf /usr/bin ${HOME} cd
+		"$1" test done && export "$@" -eu
+		'quoted text' && export done --verbose -eu done -eu
+	${HOME} grep "$1" then readonly
+		printf cd export sed readonly test grep "$1" x=1 x=1 echo --verbose
+		x=1 -eu printf printf -eu test local readonly
+/usr/bin ${HOME} && grep echo echo sed awk -eu sed awk x=1 grep echo x=1 "$@"
+	2>/dev/null --verbose test --verbose $(pwd) 'quoted text'
+		export /usr/bin echo cd -eu readonly -eu $(pwd) | local
+	| $(pwd) 2>/dev/null cd && | test export
+then "$@" readonly ${HOME} && test sed && /usr/bin
+		--verbose export test $(pwd) test $(pwd) cd done echo then ${HOME}
+		local readonly "$1" echo
+	"$1" sed sed && --verbose done then ${HOME} 2>/dev/null sed
+/usr/bin -eu test then
+	awk test sed awk readonly "$@" "$@"
+		readonly ${HOME} "$1" -eu ${HOME} test "$@" && && "$1" -eu readonly
+	done 2>/dev/null done local done export sed && $(pwd) readonly then "$1" readonly
+	x=1 && export /usr/bin local "$@" done grep then | -eu
+2>/dev/null -eu 'quoted text' && test
+		readonly -eu local -eu 2>/dev/null
+	--verbose export ${HOME} 'quoted text' printf printf /usr/bin
+		echo done $(pwd) 2>/dev/null printf && then export
+		$(pwd) 2>/dev/null export -eu cd
+		-eu export "$@" x=1 "$@" "$@" x=1 "$@" $(pwd)
+echo -eu "$1" 'quoted text' 2>/dev/null -eu "$@" export printf awk x=1
+&& printf $(pwd) local "$1" | test local /usr/bin
+	"$@" local 'quoted text' && export ${HOME} ${HOME} local ${HOME} awk $(pwd)
+		readonly echo test readonly sed "$@" then then sed /usr/bin test done x=1
+awk 'quoted text' grep echo sed ${HOME}
+	then /usr/bin readonly "$@" done $(pwd) "$@" ${HOME} readonly -eu readonly
+	"$1" --verbose local done && 2>/dev/null local 2>/dev/null
+		/usr/bin export then grep cd "$@" && && "$1"
+/usr/bin readonly local grep 'quoted text' && done export awk echo awk $(pwd)
+		'quoted text' local cd then x=1 $(pwd) local awk readonly
+	-eu test printf ${HOME} -eu grep x=1 "$1"
+		export /usr/bin "$1" awk done sed export local
+		&& export x=1 cd x=1 | export | printf
+${HOME} then echo "$@" $(pwd) grep x=1 --verbose echo /usr/bin ${HOME} sed
+/usr/bin 'quoted text' echo cd test done $(pwd) grep printf | sed /usr/bin
+	--verbose readonly && printf done "$@" $(pwd) && sed
+	-eu test "$1" then ${HOME} local --verbose export readonly ${HOME}
+${HOME} done test cd --verbose local readonly grep then 'quoted text' && 2>/dev/null
+"$1" printf 2>/dev/null test readonly && readonly $(pwd) $(pwd) printf
+		printf x=1 awk grep |
+	awk printf done -eu export
+	"$1" done | test --verbose "$@" $(pwd) --verbose --verbose
+		done done awk 'quoted text' export /usr/bin
+		2>/dev/null -eu echo then x=1 cd ${HOME} then
+	done && done "$@" -eu 2>/dev/null x=1 sed /usr/bin x=1 --verbose export x=1 -eu
+	cd "$1" x=1 --verbose ${HOME} local cd && export
+		'quoted text' sed done x=1 done /usr/bin | 'quoted text' cd
+'quoted text' printf printf && cd /usr/bin --verbose ${HOME} done
+	grep && x=1 | sed ${HOME}
+	awk grep then "$1" awk "$@"
+		grep local sed local --verbose
+	/usr/bin done /usr/bin then local
+test "$1" echo "$@" awk $(pwd) 'quoted text' echo 2>/dev/null test
+		'quoted text' awk && echo then sed echo "$@" 'quoted text'
+	"$1" then done && test
+	cd -eu echo 2>/dev/null "$1" local x=1
+		"$1" /usr/bin local ${HOME} local | 2>/dev/null done "$1" grep awk
+sed -eu "$@" "$@" --verbose export awk echo local --verbose local x=1
+printf test | ${HOME} --verbose grep test local | export local
+printf done export $(pwd) echo export done local ${HOME}
+	| done 'quoted text' 2>/dev/null
+		then test ${HOME} sed "$@" printf ${HOME} /usr/bin && &&
+		"$@" then "$@" "$@" $(pwd) cd && -eu test --verbose
+	2>/dev/null $(pwd) "$@" done --verbose test --verbose --verbose
+		"$@" /usr/bin test "$@" then
+		cd -eu | readonly awk --verbose cd
+awk awk awk grep "$1" test ${HOME}
+	$(pwd) && echo export sed ${HOME} test $(pwd) "$1"
+		x=1 export export 2>/dev/null 'quoted text' "$1" grep /usr/bin
+	'quoted text' printf printf "$1" $(pwd) -eu 'quoted text' | $(pwd)
+	export "$1" printf printf grep sed printf test "$@" | 2>/dev/null
+		$(pwd) | awk test cd /usr/bin test local
+/usr/bin cd local sed echo printf && local local
+awk && echo awk | /usr/bin
+	$(pwd) local && && readonly cd 'quoted text' 2>/dev/null | readonly
+		export then local $(pwd) x=1 --verbose awk awk ${HOME}
+	grep 2>/dev/null local ${HOME} local
+"$@" then ${HOME} && sed | local local done echo $(pwd) x=1 && "$1" $(pwd)
+x=1 --verbose -eu ${HOME} local export
+	grep "$1" && "$@" readonly
+	printf grep x=1 then sed echo cd
+"$@" grep export ${HOME} local awk -eu x=1
+"$@" | test 'quoted text' grep then 'quoted text'
+		| done 2>/dev/null "$@" echo test done awk local grep /usr/bin done -eu
+		&& --verbose x=1 x=1 sed
+		echo cd export 'quoted text' cd "$@" awk
+export sed printf --verbose
+		readonly echo | cd 'quoted text' "$@" cd awk echo printf then --verbose echo
+	printf /usr/bin printf sed grep x=1 "$1" cd && -eu done --verbose
+grep sed then "$@" cd grep test done
+	2>/dev/null /usr/bin echo
+printf awk then awk printf awk | printf local echo "$@" 2>/dev/null && sed 2>/dev/null
+&& then sed x=1 sed ${HOME} --verbose 2>/dev/null | sed x=1 -eu
+${HOME} /usr/bin then local -eu "$1" --verbose &&
+	echo grep 'quoted text' then sed echo | $(pwd) grep | ${HOME} readonly
+sed -eu "$@" --verbose printf /usr/bin | $(pwd) --verbose cd && x=1 -eu
+		printf ${HOME} echo readonly 'quoted text' sed done test test sed
+"$@" printf $(pwd) 'quoted text' ${HOME} 'quoted text' printf readonly
+	readonly x=1 grep echo readonly echo export 2>/dev/null readonly cd "$@"
+		echo sed then test 2>/dev/null cd ${HOME} -eu readonly /usr/bin
+		'quoted text' -eu then sed --verbose test ${HOME} $(pwd) test 2>/dev/null printf
+		-eu grep ${HOME} then grep awk 'quoted text' sed
+x=1 "$1" cd printf local readonly then 2>/dev/null $(pwd) sed
+	then && --verbose local cd echo ${HOME} echo export sed 2>/dev/null
+	echo | export export 2>/dev/null
+		readonly && $(pwd) grep | "$@" done /usr/bin $(pwd) printf cd
+		x=1 $(pwd) | $(pwd) readonly grep sed grep "$1"
+		printf done $(pwd) grep "$1" 2>/dev/null 2>/dev/null sed "$@"
+	"$@" --verbose "$1" local
+		readonly x=1 x=1 "$1"
+		2>/dev/null then && ${HOME}
+sed readonly --verbose -eu grep export grep echo && /usr/bin $(pwd) 2>/dev/null
+/usr/bin export | awk 'quoted text'
+local $(pwd) --verbose sed ${HOME} "$@" | "$1" sed sed done cd then
+		--verbose -eu echo "$1" && echo && done x=1 echo readonly awk -eu export
+	sed grep grep done test printf 'quoted text'
+x=1 && grep $(pwd) "$@" "$1"
+--verbose "$@" | x=1 /usr/bin echo awk awk 2>/dev/null 2>/dev/null
+	'quoted text' then then -eu local sed grep "$@" x=1 /usr/bin /usr/bin echo "$1"
+		-eu cd 2>/dev/null $(pwd) 2>/dev/null export
+	then "$@" test grep awk export ${HOME} sed --verbose then
+	/usr/bin 2>/dev/null -eu done && test "$@"
+	-eu -eu 'quoted text' cd $(pwd) "$@" done readonly
+	local x=1 --verbose readonly && export x=1 && cd test then printf echo echo
+${HOME} test x=1 -eu /usr/bin 'quoted text' grep
+'quoted text' $(pwd) awk && $(pwd) awk awk ${HOME} sed grep
+	--verbose 2>/dev/null awk $(pwd)
+	"$1" $(pwd) "$1" "$1" test 'quoted text' awk done ${HOME} awk 'quoted text'
+&& done echo sed "$@" grep test
+		| export ${HOME} printf $(pwd) awk then
+'quoted text' awk cd && | && | local local ${HOME} printf | | cd -eu
+	--verbose $(pwd) x=1 printf readonly grep echo done ${HOME} export
+	${HOME} x=1 x=1 grep test awk x=1 --verbose
+	${HOME} then x=1 export test "$@" ${HOME} x=1 "$@" --verbose readonly
+printf cd cd 2>/dev/null $(pwd)
+		--verbose && then sed test "$@" then echo echo
+| awk done $(pwd) printf "$1" 'quoted text' "$@" local local echo /usr/bin printf
+local $(pwd) done "$1" awk sed done && grep local sed
+/usr/bin cd readonly sed then "$1" local test then printf test && printf 'quoted text'
+		printf --verbose awk && 2>/dev/null "$@" $(pwd) ${HOME} cd done | local
+	sed | | then readonly -eu echo echo echo && done x=1 | local ${HOME} then
+x=1 | "$1" x=1 && x=1 -eu done 'quoted text' -eu && | ${HOME}
+		then sed sed 2>/dev/null
+	${HOME} done $(pwd) --verbose readonly ${HOME} cd && $(pwd) x=1 cd | /usr/bin
+grep "$1" 2>/dev/null ${HOME} export readonly x=1
+${HOME} local 'quoted text'
+${HOME} "$1" export --verbose local export export then
+then /usr/bin awk sed 'quoted text' --verbose /usr/bin
+		awk printf ${HOME} then "$@" export readonly test printf readonly
+"$@" cd sed $(pwd) printf /usr/bin --verbose
+export 2>/dev/null x=1 export
+		cd 'quoted text' export sed x=1
+sed x=1 sed cd test /usr/bin grep $(pwd) cd -eu done "$1" 'quoted text'
+"$1" && 2>/dev/null sed export /usr/bin "$@" x=1 "$1"
+grep done cd awk 2>/dev/null -eu grep
+grep printf export local awk done "$@" "$1" ${HOME}
+--verbose 2>/dev/null $(pwd) grep /usr/bin readonly
+echo cd then local readonly local $(pwd) ${HOME}
+	echo test printf test && test readonly 'quoted text'
+-eu && 'quoted text' && ${HOME} printf printf
+	/usr/bin grep test export "$1" x=1 sed && -eu echo && "$@" | local local then
+sed | readonly printf --verbose -eu local printf -eu cd ${HOME}
+		--verbose sed && /usr/bin /usr/bin done done done --verbose
+local test 'quoted text' $(pwd) grep
+	| /usr/bin x=1 && 2>/dev/null 2>/dev/null
+export ${HOME} done --verbose local readonly /usr/bin cd 'quoted text' ${HOME} test
+	printf "$1" printf readonly test && 'quoted text' printf
+		&& test done | ${HOME} 'quoted text'
+${HOME} awk /usr/bin $(pwd) x=1 export
+		awk grep $(pwd) echo sed --verbose | local test grep $(pwd) echo sed done x=1
+readonly 'quoted text' /usr/bin export 'quoted text' | 'quoted text' done awk
+	/usr/bin grep export $(pwd) $(pwd)
+sed readonly 'quoted text' "$1" done grep
+readonly awk "$1" local
+	-eu ${HOME} awk --verbose echo sed --verbose sed -eu $(pwd)
+then && --verbose "$@" 'quoted text' awk awk printf
+	2>/dev/null test $(pwd) 'quoted text'
+done ${HOME} test /usr/bin local /usr/bin grep printf then | then | /usr/bin
+	done $(pwd) ${HOME} "$1" sed then ${HOME} 'quoted text' export 2>/dev/null
+		sed ${HOME} export readonly x=1 printf -eu local cd $(pwd) local test
+		test && printf echo /usr/bin /usr/bin
+	printf 2>/dev/null | $(pwd) -eu -eu
+	local | $(pwd) && | "$@" && 'quoted text' && --verbose "$@" && then -eu 'quoted text'
+	printf ${HOME} readonly
+	2>/dev/null x=1 $(pwd) test cd printf export "$1" export
+		"$1" cd echo then | cd $(pwd) && export /usr/bin grep
+&& grep --verbose printf
+&& readonly sed local then $(pwd)
+2>/dev/null test echo readonly 2>/dev/null printf echo sed
+x=1 echo printf echo grep --verbose
+		-eu grep printf readonly "$@" cd export test export
+		${HOME} readonly /usr/bin test
+-eu local 2>/dev/null --verbose --verbose grep local "$1" $(pwd) then
+	--verbose cd done grep
+	awk x=1 then test done x=1 x=1 "$1" 2>/dev/null
+	&& awk ${HOME} /usr/bin "$1" --verbose
+		done done printf local then 'quoted text'
+grep -eu x=1 echo sed 'quoted text' done done printf test /usr/bin
+		&& 'quoted text' -eu done test printf
+		'quoted text' printf 2>/dev/null
+	local x=1 test export local "$1" awk x=1 | export x=1 | && then
+		-eu readonly -eu $(pwd) local
+	grep x=1 x=1 grep printf awk export awk ${HOME} grep local test ${HOME}
+		| readonly printf local 'quoted text' "$1" export then sed readonly 2>/dev/null
+	sed local /usr/bin readonly export cd -eu done -eu ${HOME} ${HOME} 'quoted text'
+	"$@" /usr/bin x=1 ${HOME} cd /usr/bin readonly done test then then
+awk --verbose cd x=1 grep printf done sed done printf /usr/bin
+	sed export export --verbose /usr/bin "$1" $(pwd) grep
+"$@" $(pwd) --verbose then
+		local 2>/dev/null ${HOME} test local "$1" -eu /usr/bin
+readonly $(pwd) "$@" done readonly "$@" "$@" | readonly readonly
+	x=1 readonly && -eu grep grep ${HOME} --verbose | sed --verbose printf echo x=1
+	test ${HOME} && x=1 | | "$1" -eu sed "$@"
+		export /usr/bin readonly "$1"
+		$(pwd) && then x=1 "$@" sed $(pwd) | ${HOME} ${HOME} -eu "$@" /usr/bin
+	$(pwd) readonly 'quoted text' awk | then grep grep sed --verbose
+		echo done $(pwd) awk /usr/bin awk readonly done
+cd | done cd --verbose done ${HOME} local local grep
+	${HOME} -eu cd local echo $(pwd) 'quoted text'
+		&& cd readonly echo 2>/dev/null
+$(pwd) cd printf /usr/bin sed test local |
+printf echo 'quoted text' awk test x=1 "$@" cd sed printf
+$(pwd) readonly grep /usr/bin grep
+	awk "$@" test 2>/dev/null grep | done $(pwd) ${HOME} local && "$@" grep -eu
+"$1" grep done && printf
+		readonly --verbose local echo grep ${HOME} 2>/dev/null /usr/bin test "$@"
+local printf cd x=1 test grep --verbose done printf readonly
+	then /usr/bin test -eu printf export "$@" | 'quoted text' awk /usr/bin --verbose
+		local 'quoted text' done &&
+awk $(pwd) readonly readonly ${HOME} $(pwd) readonly
+test local /usr/bin ${HOME} printf 2>/dev/null then cd && local
+	$(pwd) printf -eu "$@" grep grep ${HOME} printf | "$@" ${HOME} --verbose
+-eu readonly local x=1 awk -eu test test | awk ${HOME} awk "$@" /usr/bin
+		sed readonly && done printf local printf "$@" done && sed && 'quoted text'
+${HOME} /usr/bin --verbose "$1"
+| echo done test then && cd | done local
+readonly local 'quoted text' cd ${HOME} printf "$1" done 'quoted text' &&
+	awk export export -eu awk done grep awk && local 2>/dev/null $(pwd) "$1"
+		"$@" export && echo 'quoted text' /usr/bin cd ${HOME} --verbose cd -eu then $(pwd)
+grep export x=1 grep printf
+sed "$1" "$@" "$@" local
+	grep "$@" -eu awk "$@" cd echo && printf test --verbose
+grep $(pwd) /usr/bin "$@" local
+export 'quoted text' "$@" cd && awk cd x=1 2>/dev/null echo sed "$1"
+x=1 done --verbose | | | && 'quoted text' ${HOME} --verbose
+		test printf $(pwd) $(pwd)
+then /usr/bin test local "$@" 'quoted text'
+		echo && export local x=1 local done test echo export $(pwd) then
+	readonly "$1" 'quoted text' done awk 'quoted text' done export x=1
+	| then "$@" sed "$1" 'quoted text' -eu -eu cd "$1" sed | export 'quoted text'
+/usr/bin /usr/bin -eu test "$1"
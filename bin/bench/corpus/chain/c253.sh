@@ -0,0 +1,2001 @@
+	test -eu "$1" x=1 sed --verbose --verbose $(pwd) export ${HOME} cd grep
+	then local export done -eu grep $(pwd) 'quoted text' && |
+done ${HOME} cd ${HOME} then printf "$1" /usr/bin awk --verbose
+		&& && && test then 'quoted text'
+		export local local printf --verbose
+	&& printf $(pwd) x=1 ${HOME} $(pwd) test 2>/dev/null
+		-eu export 'quoted text' 'quoted text' && printf cd readonly ${HOME} | -eu local
+		'quoted text' 2>/dev/null -eu test x=1
+'quoted text' 2>/dev/null local --verbose done /usr/bin /usr/bin x=1
+"$1" printf sed | done -eu local --verbose printf "$1" 2>/dev/null &&
+	sed export local then | awk sed done /usr/bin
+	export cd 2>/dev/null sed ${HOME}
+	&& && done grep 2>/dev/null $(pwd) sed
+		2>/dev/null test && grep --verbose
+	done export printf printf 'quoted text' readonly
+/usr/bin then readonly cd "$1" | /usr/bin --verbose --verbose &&
+		-eu grep sed 'quoted text' -eu | done 2>/dev/null x=1 |
+sed "$@" | grep "$@" ${HOME} "$1" cd "$@" -eu grep sed readonly
+	-eu readonly x=1 "$1" readonly export echo sed /usr/bin
+		done x=1 "$1" ${HOME} sed ${HOME} 'quoted text'
+	printf grep --verbose then then echo $(pwd) x=1 x=1 done
+&& local cd -eu done 2>/dev/null
+"$@" 2>/dev/null /usr/bin done export x=1 sed done /usr/bin 'quoted text'
+	echo ${HOME} ${HOME} 2>/dev/null export sed "$@" awk test done | done
+	grep readonly cd x=1 then printf | echo done awk
+	awk 'quoted text' ${HOME} printf 2>/dev/null done test -eu
+	echo readonly awk sed
+		$(pwd) $(pwd) "$1" awk
+sed printf | && 2>/dev/null | grep | /usr/bin $(pwd)
+	-eu 'quoted text' test export sed
+"$1" 2>/dev/null 'quoted text' 'quoted text' export sed printf awk awk test 2>/dev/null
+	awk test export --verbose sed "$@" sed 2>/dev/null echo $(pwd) -eu
+		readonly && 2>/dev/null printf awk cd sed cd export echo awk && echo /usr/bin
+"$@" then 2>/dev/null 2>/dev/null test local && x=1 grep
+	$(pwd) cd | "$@" $(pwd) grep sed --verbose test 'quoted text' test
+	2>/dev/null 'quoted text' --verbose sed "$@" local export /usr/bin
+--verbose sed local $(pwd) ${HOME} ${HOME} echo | -eu | -eu $(pwd) test
+	x=1 'quoted text' cd "$1" 'quoted text' local then /usr/bin
+		| printf "$@" 2>/dev/null x=1 --verbose "$@" local
+awk -eu grep then --verbose $(pwd) "$1" 'quoted text'
+	"$@" then ${HOME} printf x=1 grep $(pwd) && x=1
+"$1" "$@" $(pwd) done echo -eu | 2>/dev/null sed && -eu -eu awk
+	sed /usr/bin 2>/dev/null then done ${HOME} --verbose awk sed test
+	/usr/bin test test "$1" ${HOME}
+then grep && test grep cd readonly | then grep printf done 2>/dev/null
+	-eu 2>/dev/null -eu "$@" done "$1" printf
+		&& echo x=1 cd grep "$@" readonly export | cd local "$1" readonly
+		then grep "$@" local export
+	sed "$1" echo done local then sed
+/usr/bin 2>/dev/null then
+2>/dev/null | "$1" sed grep x=1 grep
+	x=1 readonly -eu sed 2>/dev/null cd $(pwd) local
+awk local then readonly $(pwd) --verbose /usr/bin $(pwd) awk local export
+	&& test -eu "$@" 'quoted text' export grep printf local /usr/bin ${HOME}
+		"$@" cd "$@" then then /usr/bin readonly sed test local printf sed &&
+--verbose awk "$1" awk && echo
+		$(pwd) x=1 grep "$@" x=1 local done 'quoted text' export test --verbose
+-eu cd "$1" ${HOME} cd then test &&
+		done 2>/dev/null grep ${HOME} awk && export readonly 2>/dev/null export 2>/dev/null
+		"$1" done echo && "$1" export test x=1 readonly
+| /usr/bin ${HOME} -eu | then
+		x=1 printf then sed done $(pwd) printf 2>/dev/null printf
+then && 2>/dev/null && echo 2>/dev/null done -eu -eu $(pwd) $(pwd)
+	cd | | "$1" done 'quoted text' &&
+x=1 "$@" echo 'quoted text' 2>/dev/null export
+printf then 'quoted text' x=1 printf readonly "$1" sed test 'quoted text'
+2>/dev/null && -eu "$@" ${HOME} 2>/dev/null
+		2>/dev/null 2>/dev/null && grep grep /usr/bin --verbose
+awk ${HOME} local test
+		--verbose readonly grep then echo "$1" /usr/bin readonly
+awk export "$1" export /usr/bin then then
+	cd echo 'quoted text' test test echo export done
+--verbose grep export done cd
+		readonly then "$@" 'quoted text' readonly && 'quoted text' ${HOME} "$1"
+	done --verbose /usr/bin "$1" done local readonly done
+done export --verbose awk readonly ${HOME} -eu test "$1" $(pwd) test $(pwd)
+		"$1" x=1 test cd --verbose --verbose "$@" /usr/bin grep
+		readonly $(pwd) ${HOME}
+	readonly $(pwd) done awk test && 2>/dev/null
+	"$1" readonly sed 2>/dev/null
+test grep -eu sed ${HOME} 2>/dev/null readonly printf printf 'quoted text'
+	then then --verbose printf x=1 x=1 test sed 'quoted text' then export awk
+	| -eu "$1" | local local grep $(pwd) awk "$@" grep && "$1" "$1" "$@" sed
+		test readonly 2>/dev/null 2>/dev/null local sed $(pwd) --verbose
+	--verbose grep local -eu 'quoted text' test x=1 local 'quoted text'
+	2>/dev/null echo readonly --verbose done
+		sed 2>/dev/null then readonly printf &&
+		/usr/bin awk -eu sed 'quoted text' "$@" printf echo cd 2>/dev/null
+	| echo echo awk $(pwd) printf grep local /usr/bin export printf "$@" sed
+export x=1 then cd | cd export $(pwd) 2>/dev/null readonly
+then $(pwd) test 2>/dev/null x=1 grep /usr/bin awk cd "$1" printf grep done test
+${HOME} grep export -eu ${HOME} ${HOME}
+	done && sed 2>/dev/null -eu test awk awk /usr/bin
+		readonly /usr/bin local test echo
+		'quoted text' done awk --verbose then
+	local "$@" cd printf "$@" -eu /usr/bin test x=1 then sed -eu
+		readonly x=1 readonly awk done awk done --verbose
+	/usr/bin local 'quoted text' /usr/bin "$@" $(pwd) --verbose /usr/bin
+cd export then 'quoted text' /usr/bin sed 'quoted text' && -eu $(pwd) && "$1"
+		awk "$1" -eu export "$1" cd x=1 "$@" local readonly && test cd sed $(pwd)
+	| local && ${HOME} local
+	'quoted text' sed local echo awk -eu export grep && grep awk --verbose
+	done done sed sed ${HOME} -eu cd $(pwd)
+cd | then echo awk -eu --verbose
+	/usr/bin sed ${HOME} cd | /usr/bin -eu ${HOME} /usr/bin
+| /usr/bin local 2>/dev/null grep echo cd ${HOME} printf echo local awk export
+done "$1" "$@" cd then ${HOME} cd test -eu "$@" echo test 'quoted text'
+		2>/dev/null awk $(pwd) local && /usr/bin ${HOME} x=1
+export sed printf cd printf && "$1" "$@" -eu done export
+	echo $(pwd) readonly /usr/bin export x=1
+	/usr/bin then awk 'quoted text' test -eu sed "$@" cd echo | -eu $(pwd) 'quoted text'
+	-eu --verbose /usr/bin then |
+		test 2>/dev/null readonly
+	-eu echo grep 2>/dev/null $(pwd) 2>/dev/null grep "$1" | $(pwd) then
+	then && && "$@" /usr/bin printf readonly -eu x=1 then && test --verbose /usr/bin
+	x=1 sed grep "$@" local done readonly
+	done grep /usr/bin readonly "$@" /usr/bin export -eu export /usr/bin echo cd ${HOME}
+		"$1" export x=1 printf /usr/bin 'quoted text' ${HOME} then 'quoted text' export
+		${HOME} -eu printf "$@" $(pwd) | && export test printf ${HOME} ${HOME} && && -eu
+	test && ${HOME} 'quoted text' $(pwd) echo "$1" printf 'quoted text' --verbose
+	readonly awk ${HOME} done local "$1"
+&& done --verbose && then then printf ${HOME}
+2>/dev/null export && export -eu awk
+	local export cd ${HOME} --verbose printf "$@" ${HOME} /usr/bin
+| -eu echo /usr/bin --verbose export export local readonly printf cd awk "$@"
+		then "$@" ${HOME} --verbose export "$1" x=1 2>/dev/null
+	cd -eu done /usr/bin grep ${HOME} test --verbose awk 'quoted text' x=1
+		done -eu test 2>/dev/null /usr/bin cd ${HOME} cd -eu 2>/dev/null
+/usr/bin done /usr/bin
+'quoted text' local -eu cd cd done then sed local /usr/bin
+test 2>/dev/null x=1 then sed printf done local done ${HOME} test
+		awk test ${HOME} cd local ${HOME} grep test done done x=1
+	| && readonly 2>/dev/null "$1" x=1 echo awk readonly /usr/bin
+--verbose -eu printf 'quoted text'
+	"$@" x=1 /usr/bin 'quoted text' export grep grep --verbose echo readonly export
+		'quoted text' done --verbose grep then awk
+export ${HOME} then "$@" 2>/dev/null ${HOME}
+	&& /usr/bin echo export 'quoted text' then echo
+		| echo /usr/bin cd printf
+	grep test sed done && then x=1 printf | test grep -eu "$1"
+done x=1 test /usr/bin
+	&& grep x=1 2>/dev/null x=1 sed printf ${HOME}
+"$@" then $(pwd) printf cd /usr/bin ${HOME} echo done "$@" "$1"
+		done -eu "$1" export grep export "$1" done awk grep local export printf
+local ${HOME} grep awk test cd --verbose
+export && 'quoted text' --verbose echo $(pwd)
+		$(pwd) "$@" --verbose grep then local then printf awk 2>/dev/null export -eu
+		awk done -eu awk local awk 'quoted text' 2>/dev/null then --verbose && 2>/dev/null
+"$@" --verbose --verbose echo echo x=1 "$1" local 'quoted text' -eu ${HOME}
+		&& --verbose 'quoted text'
+$(pwd) --verbose sed printf then awk
+		| test $(pwd) export ${HOME}
+	| --verbose $(pwd) export then -eu readonly
+'quoted text' 'quoted text' echo done --verbose -eu readonly done sed |
+		--verbose $(pwd) sed grep awk sed grep
+	2>/dev/null local readonly
+		grep | --verbose -eu printf 'quoted text' printf export /usr/bin --verbose --verbose
+		printf readonly then cd then readonly -eu echo /usr/bin --verbose
+		2>/dev/null readonly ${HOME} | "$@"
+sed test $(pwd) cd printf --verbose printf 2>/dev/null done -eu $(pwd) /usr/bin
+	cd /usr/bin printf 2>/dev/null --verbose 2>/dev/null
+	local /usr/bin $(pwd) export
+local cd test | /usr/bin "$1" export export local 'quoted text' readonly
+		${HOME} printf awk export "$1" echo && x=1 ${HOME} ${HOME} ${HOME}
+		--verbose x=1 'quoted text' cd
+	--verbose "$@" "$@" test "$@" 2>/dev/null done
+sed awk local | cd | /usr/bin sed
+awk /usr/bin ${HOME} grep 2>/dev/null | grep grep printf then export export
+		'quoted text' --verbose "$1" export ${HOME}
+	--verbose test export && printf x=1 "$@" done
+	${HOME} "$1" && ${HOME} grep /usr/bin 2>/dev/null x=1 x=1 awk $(pwd)
+		echo test x=1 "$@" x=1 /usr/bin -eu "$1" /usr/bin && $(pwd) "$1" test 'quoted text'
+	then x=1 ${HOME} readonly readonly
+		local cd readonly x=1 echo test cd x=1 --verbose
+	grep sed awk echo x=1 cd 2>/dev/null local
+	2>/dev/null local done 'quoted text' awk then sed /usr/bin | cd readonly
+		echo readonly && grep /usr/bin x=1 printf --verbose
+test test && then done readonly "$1" export /usr/bin --verbose "$@" grep echo
+		| "$@" --verbose | cd echo $(pwd) -eu
+		2>/dev/null | -eu readonly done sed --verbose -eu "$@" -eu
+echo | -eu /usr/bin && cd sed grep grep 'quoted text' done export
+		&& printf -eu ${HOME} | 2>/dev/null printf readonly
+	"$@" test "$@" | /usr/bin done then readonly --verbose
+	"$1" $(pwd) grep echo
+	local done 2>/dev/null $(pwd)
+		grep awk --verbose 2>/dev/null -eu local awk readonly ${HOME} $(pwd)
+&& | printf 'quoted text' --verbose
+cd 'quoted text' sed x=1 "$1" printf sed echo ${HOME} --verbose
+		'quoted text' awk grep x=1
+		$(pwd) awk ${HOME} ${HOME} 'quoted text' "$1" && local echo done
+	-eu -eu grep printf readonly printf
+'quoted text' 2>/dev/null 2>/dev/null
+		export grep x=1 "$1" "$1" cd sed "$@" && cd
+		cd && x=1 cd export export then 'quoted text'
+	&& $(pwd) then ${HOME} "$1" 'quoted text' && --verbose "$1" -eu done
+		| 'quoted text' echo cd x=1 && | done then --verbose then readonly ${HOME} echo
+		echo grep $(pwd) test printf export /usr/bin printf local done "$@"
+		'quoted text' printf test local |
+echo grep "$@" 2>/dev/null 2>/dev/null 'quoted text' done printf done
+	done echo test 'quoted text' ${HOME} cd /usr/bin --verbose done
+		test then sed export printf awk sed -eu -eu --verbose "$1" 'quoted text'
+	readonly awk -eu awk done grep | x=1
+	sed 2>/dev/null then awk cd echo "$1"
+	printf awk "$1" "$@" done
+		readonly readonly export
+		&& "$1" echo && done 2>/dev/null grep cd 'quoted text' echo test done export
+'quoted text' --verbose then echo && "$@" echo | then
+	&& ${HOME} local then "$@" awk local | done cd -eu ${HOME} sed sed echo | awk
+		/usr/bin grep "$1" "$1" --verbose then printf test --verbose sed echo $(pwd)
+		awk && grep ${HOME} /usr/bin grep
+| local ${HOME} test done -eu local cd 'quoted text' echo
+	| export 'quoted text' -eu "$1" done cd awk x=1 2>/dev/null && $(pwd)
+		echo test --verbose | | echo echo | -eu x=1 $(pwd) awk "$1"
+--verbose 'quoted text' test "$1"
+test $(pwd) then && cd "$1" readonly $(pwd) "$1" done "$@" then export
+	2>/dev/null export local && then $(pwd) local -eu x=1 export x=1 | /usr/bin
+	$(pwd) && && "$@" grep sed
+then $(pwd) $(pwd) local export | "$1" printf export
+	&& printf echo 2>/dev/null && ${HOME} done then printf ${HOME}
+cd 2>/dev/null then | cd export "$@" 'quoted text' echo && awk done
+"$@" /usr/bin sed 2>/dev/null $(pwd) awk export awk | -eu printf
+		&& -eu done export ${HOME} 2>/dev/null
+		local done test sed "$1" awk test local sed $(pwd) x=1 local "$@"
+	x=1 'quoted text' && export 2>/dev/null readonly readonly /usr/bin
+'quoted text' x=1 "$1" && done /usr/bin x=1
+grep test then local sed then --verbose readonly export export sed | /usr/bin sed
+		$(pwd) && then --verbose /usr/bin then grep
+	x=1 done done done awk cd x=1 "$1" sed awk -eu export && -eu
+		2>/dev/null $(pwd) | grep awk done /usr/bin readonly 2>/dev/null
+"$@" cd x=1 export done echo 'quoted text' printf echo echo readonly /usr/bin
+export grep 2>/dev/null local | | grep --verbose x=1 grep cd sed then
+"$@" cd printf done awk 'quoted text' sed export local awk export readonly && /usr/bin
+	done done printf 2>/dev/null
+		/usr/bin "$1" | | "$@" ${HOME} | done echo 2>/dev/null -eu /usr/bin echo $(pwd)
+		&& local then then && 'quoted text' 2>/dev/null x=1
+	| --verbose cd ${HOME} echo $(pwd) sed | then 'quoted text'
+	sed "$1" /usr/bin cd 'quoted text' export | /usr/bin
+export && "$@" x=1 "$@" printf awk grep awk -eu sed readonly
+		| awk printf local test cd && | readonly sed local test -eu echo
+		--verbose sed test x=1 printf test done | done
+	test awk done done awk "$@" done $(pwd) | 2>/dev/null printf
+		awk ${HOME} --verbose sed "$@" && "$1" cd printf test test grep x=1 awk test
+		readonly /usr/bin 'quoted text' grep ${HOME} sed done ${HOME} cd grep --verbose
+		'quoted text' "$@" ${HOME} x=1 local 'quoted text' done echo
+printf sed "$@" export cd | printf && 2>/dev/null local && printf export export
+	cd printf printf readonly export sed 2>/dev/null
+	echo "$@" grep 2>/dev/null x=1 awk -eu readonly "$@" then ${HOME}
+		--verbose 'quoted text' test "$@" | printf ${HOME} export echo printf
+grep then awk && then cd --verbose
+-eu awk ${HOME} ${HOME} echo test cd grep awk
+x=1 | "$@" "$@" -eu 'quoted text'
+	${HOME} sed awk "$1" sed then sed awk
+		echo readonly printf then printf readonly "$@" && --verbose
+	$(pwd) -eu $(pwd) export grep sed awk "$@" "$1" "$1" printf | "$@" -eu local x=1
+	-eu readonly ${HOME} then "$@" "$1" --verbose && sed cd --verbose 2>/dev/null $(pwd)
+	"$1" | 'quoted text' && 'quoted text' cd
+printf 'quoted text' -eu local readonly test 2>/dev/null export local -eu
+&& then ${HOME} test awk echo 'quoted text' test grep export && test cd
+cd ${HOME} printf && && --verbose then export
+awk x=1 echo cd grep 'quoted text' grep echo test grep
+	then awk ${HOME} export readonly export 2>/dev/null
+	"$1" ${HOME} readonly then grep "$@" sed "$1" test -eu done ${HOME} awk
+		/usr/bin --verbose 2>/dev/null --verbose grep echo then
+	grep sed ${HOME} export readonly test printf 2>/dev/null
+	$(pwd) ${HOME} test awk printf readonly printf grep echo $(pwd)
+		readonly grep ${HOME} -eu ${HOME} sed ${HOME} export
+		then test printf sed
+		cd then -eu sed awk done x=1 -eu grep export 2>/dev/null
+		local readonly local | local && export 'quoted text' --verbose
+"$@" && "$1" 2>/dev/null test grep done "$1" $(pwd) ${HOME} x=1 "$@" awk -eu
+		-eu export local | then 2>/dev/null 'quoted text' test
+		readonly echo ${HOME} grep && echo readonly
+"$1" grep $(pwd) ${HOME} readonly sed && | /usr/bin printf /usr/bin --verbose
+	readonly x=1 -eu then grep grep 2>/dev/null 'quoted text'
+	$(pwd) grep local /usr/bin && /usr/bin /usr/bin && /usr/bin | awk local
+cd "$@" local sed awk -eu export --verbose printf -eu cd then 'quoted text'
+-eu 2>/dev/null 2>/dev/null test $(pwd) then ${HOME}
+	&& /usr/bin local /usr/bin readonly readonly then
+		$(pwd) $(pwd) cd 2>/dev/null local readonly ${HOME} local 'quoted text'
+	awk echo readonly | grep "$1" echo then readonly "$@" cd | cd
+		--verbose 2>/dev/null echo && readonly "$1" export test --verbose cd cd
+| -eu ${HOME} cd 2>/dev/null x=1 --verbose /usr/bin && $(pwd) readonly
+	"$@" done export "$1" cd | local "$@" export local
+		x=1 export then 'quoted text' && --verbose echo cd $(pwd) "$@" $(pwd)
+	readonly 2>/dev/null | -eu x=1 export sed && "$@" x=1 test local then
+$(pwd) && readonly -eu --verbose && awk
+		grep 2>/dev/null && export -eu awk
+	| ${HOME} test cd x=1 then 'quoted text' x=1 -eu done
+	local readonly 2>/dev/null && export
+		&& --verbose readonly 'quoted text'
+done | $(pwd) readonly test $(pwd) 'quoted text'
+echo local /usr/bin $(pwd) && sed --verbose printf local --verbose "$1" &&
+		local 2>/dev/null readonly
+printf "$@" x=1 then
+| grep local /usr/bin && | 2>/dev/null cd 2>/dev/null grep sed | $(pwd) awk
+	${HOME} sed cd 'quoted text' ${HOME}
+		/usr/bin "$1" test "$1" "$1" "$@" -eu 'quoted text' --verbose
+2>/dev/null local 'quoted text' | sed /usr/bin | -eu "$1"
+		"$1" ${HOME} 2>/dev/null -eu
+		$(pwd) then --verbose export $(pwd) ${HOME} cd $(pwd) awk
+--verbose readonly 'quoted text' then 2>/dev/null $(pwd) -eu -eu
+	x=1 "$@" ${HOME} awk cd ${HOME}
+		$(pwd) -eu printf local
+	-eu printf ${HOME} "$@" awk ${HOME} "$@" export x=1 export sed
+&& export 2>/dev/null grep ${HOME} --verbose local "$1" then
+	then export ${HOME} readonly cd "$@" awk "$@" $(pwd) then cd cd --verbose &&
+| -eu printf "$@" "$@" local --verbose
+local sed "$@" readonly
+		grep then cd --verbose /usr/bin grep --verbose $(pwd) "$1" && $(pwd)
+cd && sed awk echo /usr/bin printf test --verbose x=1
+| echo cd done grep export --verbose grep grep sed -eu $(pwd)
+	"$1" cd then test "$1"
+		/usr/bin --verbose -eu echo --verbose /usr/bin ${HOME} then done 2>/dev/null --verbose
+		--verbose echo /usr/bin awk 'quoted text' ${HOME}
+	done | $(pwd) sed readonly -eu /usr/bin sed then
+	${HOME} ${HOME} printf done
+	sed && /usr/bin export then 'quoted text' --verbose printf
+		$(pwd) -eu printf "$1" echo echo && done
+printf done done /usr/bin echo done 'quoted text' "$1" done
+		then readonly grep "$1" done 2>/dev/null
+		$(pwd) $(pwd) echo awk ${HOME}
+echo local cd export export readonly
+		'quoted text' "$1" export
+done test x=1 | "$@" awk local awk done
+	$(pwd) export then awk "$1" then sed done -eu export --verbose
+	local export 'quoted text' -eu --verbose echo printf then then
+--verbose done test | --verbose cd export test test $(pwd) "$1" --verbose
+	--verbose printf export && "$@" cd "$1" grep export "$@" "$1" local x=1 readonly
+	&& awk echo sed -eu grep
+	--verbose awk | && ${HOME} | $(pwd) export echo 'quoted text' "$@"
+		export "$@" sed awk && echo done echo
+	test awk export $(pwd) export done export -eu 'quoted text' grep
+test $(pwd) && test | done cd awk
+-eu $(pwd) "$1" cd export
+"$1" /usr/bin sed | --verbose &&
+"$@" done | printf /usr/bin 2>/dev/null then readonly awk --verbose $(pwd) sed local
+		sed test test ${HOME} grep ${HOME}
+		2>/dev/null /usr/bin sed "$1" | /usr/bin done
+	readonly export 'quoted text' "$1"
+x=1 then $(pwd) ${HOME} test grep done then grep
+printf sed | cd 2>/dev/null ${HOME} cd
+	export ${HOME} -eu test
+export readonly "$@" 'quoted text' echo ${HOME}
+	cd --verbose 'quoted text' $(pwd)
+	x=1 cd echo | readonly echo readonly --verbose
+local local sed printf && $(pwd) ${HOME} then --verbose
+	test ${HOME} ${HOME} ${HOME}
+	then cd -eu sed 'quoted text' printf | $(pwd) then
+	local ${HOME} 2>/dev/null export echo $(pwd) test
+	readonly "$1" ${HOME} echo grep printf x=1
+-eu x=1 cd readonly awk echo ${HOME} "$1" export test test export $(pwd)
+cd --verbose $(pwd) && echo echo && local -eu done
+	printf /usr/bin --verbose done cd "$1" then export /usr/bin
+	cd ${HOME} grep echo -eu echo echo readonly "$1" grep |
+	readonly printf && local grep && ${HOME}
+	sed then readonly $(pwd) -eu
+	cd x=1 'quoted text' "$@" test -eu local "$1"
+--verbose -eu echo awk export /usr/bin
+done /usr/bin 2>/dev/null awk 2>/dev/null cd
+	$(pwd) sed cd sed ${HOME} /usr/bin
+	"$@" --verbose awk grep done "$@" 'quoted text'
+sed echo $(pwd) "$@" 'quoted text'
+		2>/dev/null grep && printf test grep echo | "$1" cd | export "$@" printf grep
+		"$@" sed 'quoted text' /usr/bin $(pwd) | "$1" x=1 then &&
+	--verbose 'quoted text'
+printf local && | printf "$@" cd ${HOME} "$@" -eu "$1" echo export
+sed "$@" "$1" echo "$@" 'quoted text' awk local then -eu --verbose sed 'quoted text'
+		then test 2>/dev/null --verbose "$1" x=1 -eu
+	readonly then "$@" then grep then done local
+	$(pwd) --verbose ${HOME} 'quoted text'
+	2>/dev/null -eu /usr/bin echo | grep
+	--verbose && --verbose /usr/bin printf then readonly awk then readonly
+		'quoted text' export "$1" sed cd then "$1" $(pwd) /usr/bin cd local echo export
+&& printf 2>/dev/null --verbose then cd "$1" sed awk ${HOME}
+| --verbose | 'quoted text' sed grep 2>/dev/null
+		done 2>/dev/null local "$@" "$1" export && done $(pwd) 'quoted text' "$1"
+	2>/dev/null then done "$@" printf "$1" "$1" "$@" test sed export | sed
+test done 'quoted text' sed 2>/dev/null 2>/dev/null x=1 x=1 x=1 | "$1" done
+		x=1 ${HOME} readonly readonly --verbose printf
+	cd cd "$1" $(pwd) test && /usr/bin cd awk x=1 awk done "$@" ${HOME} $(pwd)
+		&& printf export /usr/bin export | grep 'quoted text' printf "$1" export x=1
+	"$1" "$@" && echo ${HOME} then /usr/bin x=1 "$1" done
+		readonly x=1 cd "$@" awk x=1 cd && awk awk -eu 2>/dev/null /usr/bin
+		"$@" awk done sed echo test $(pwd) grep
+	then awk x=1 export sed "$@" | "$1" "$1"
+	"$@" awk x=1 "$1" 'quoted text' grep printf $(pwd) | 2>/dev/null
+printf && "$1" test &&
+	cd --verbose | -eu && readonly
+done test done grep printf echo local echo 'quoted text' && then /usr/bin
+then $(pwd) x=1 grep -eu test
+	--verbose export grep -eu --verbose x=1 &&
+then 2>/dev/null echo echo "$@" done $(pwd) "$1" then
+	grep then readonly sed ${HOME} grep ${HOME} "$1" x=1 | test local ${HOME}
+readonly test printf sed "$1" grep $(pwd) "$1" sed cd x=1 -eu local
+		then printf -eu -eu done "$1" x=1 local sed x=1 readonly printf
+		'quoted text' --verbose "$@"
+$(pwd) local -eu ${HOME} -eu awk x=1 "$1" sed sed 2>/dev/null
+	$(pwd) 2>/dev/null awk cd 2>/dev/null printf --verbose
+&& --verbose x=1 | cd /usr/bin -eu printf cd /usr/bin awk local | test done
+	test "$@" "$1" 'quoted text' awk ${HOME} test test | && 'quoted text'
+"$@" && awk x=1 ${HOME} "$@" cd printf /usr/bin x=1 readonly | --verbose /usr/bin
+| local then /usr/bin
+		x=1 'quoted text' awk --verbose 'quoted text'
+	test then local | 2>/dev/null && x=1 export 'quoted text' readonly printf $(pwd)
+		"$1" x=1 -eu then /usr/bin | local "$@" /usr/bin -eu "$1"
+		-eu echo awk && | readonly ${HOME} awk grep then -eu
+&& /usr/bin 2>/dev/null -eu echo test awk "$@" then awk | && sed echo sed echo
+sed x=1 cd awk && export | done -eu grep && export awk | awk echo grep | 2>/dev/null
+		grep readonly && $(pwd) /usr/bin awk x=1 readonly
+	readonly cd printf "$@" grep /usr/bin
+		grep "$@" "$1" ${HOME} then "$@" && cd "$1" echo printf "$@" 2>/dev/null
+grep readonly test printf 2>/dev/null then test x=1 --verbose cd awk
+	cd /usr/bin echo x=1 then --verbose
+		then --verbose | awk $(pwd)
+	/usr/bin /usr/bin then /usr/bin
+	local grep grep export printf -eu readonly then echo x=1 grep
+grep "$1" 'quoted text' echo sed done
+		export local ${HOME} sed grep ${HOME} printf && export
+	2>/dev/null ${HOME} "$1" ${HOME} "$@" awk 'quoted text'
+--verbose awk cd x=1 awk grep grep test "$1" local
+		done "$1" -eu done "$1" awk /usr/bin |
+echo test -eu readonly x=1 sed && --verbose 'quoted text'
+	'quoted text' awk /usr/bin 2>/dev/null -eu --verbose /usr/bin --verbose
+	sed printf done export export $(pwd) | && | awk --verbose -eu ${HOME} 'quoted text'
+then /usr/bin awk done /usr/bin sed sed local echo
+"$@" grep then x=1 done "$1" local awk local printf $(pwd) local
+| $(pwd) readonly $(pwd) local readonly test grep printf $(pwd)
+	test && local 2>/dev/null "$1"
+		readonly --verbose 2>/dev/null
+		echo 'quoted text' | -eu export x=1 local && done ${HOME} && | then then
+2>/dev/null ${HOME} x=1 x=1 awk done
+		$(pwd) -eu echo local && done /usr/bin && x=1 done
+'quoted text' --verbose grep
+	local -eu local 'quoted text'
+"$@" readonly | then 2>/dev/null /usr/bin "$1" readonly
+		test echo local cd /usr/bin sed "$@" "$1" readonly --verbose 'quoted text' 'quoted text'
+"$1" then x=1 && local sed test ${HOME} -eu export then -eu /usr/bin
+sed ${HOME} /usr/bin local | cd done $(pwd) -eu done awk 'quoted text'
+	printf echo then 2>/dev/null
+	readonly local sed $(pwd) done /usr/bin then then test 2>/dev/null 'quoted text'
+	--verbose done awk awk | /usr/bin --verbose 2>/dev/null 'quoted text'
+printf && test echo then
+	| /usr/bin grep 'quoted text'
+	export cd then ${HOME} && 2>/dev/null $(pwd) && test 2>/dev/null
+	"$1" awk test ${HOME} $(pwd) grep then export x=1 && export "$1" echo
+x=1 local "$@" local &&
+		awk readonly | sed && readonly -eu export test 'quoted text' test 2>/dev/null
+	echo readonly 2>/dev/null 2>/dev/null
+${HOME} 2>/dev/null then echo cd /usr/bin && then grep export printf x=1 grep
+	| awk 'quoted text' ${HOME}
+	done sed then export then sed grep /usr/bin
+	printf printf ${HOME} cd ${HOME} -eu && printf then x=1 "$1" /usr/bin
+	sed readonly sed printf then awk printf ${HOME} "$1"
+		sed readonly --verbose "$@" done 'quoted text' 'quoted text'
+	x=1 && done then "$1" then 'quoted text' "$1"
+then test cd done --verbose local -eu | grep | /usr/bin
+readonly cd /usr/bin local $(pwd) export
+	--verbose $(pwd) -eu --verbose && ${HOME} readonly 'quoted text' done echo &&
+		grep awk readonly "$@" "$@" readonly 'quoted text'
+		test 2>/dev/null -eu "$1" test x=1 -eu --verbose export sed "$@" &&
+export readonly && awk awk sed printf 'quoted text' cd readonly awk then cd && local
+'quoted text' && /usr/bin echo ${HOME} grep echo
+		readonly | export grep cd awk awk /usr/bin /usr/bin sed 'quoted text'
+	/usr/bin ${HOME} --verbose
+		awk && 'quoted text' sed then | && then 'quoted text'
+done /usr/bin -eu local "$1" "$1" $(pwd) sed /usr/bin $(pwd) echo 'quoted text'
+		echo --verbose "$@" 'quoted text'
+${HOME} x=1 echo test
+		x=1 test $(pwd) grep | "$1" export sed cd awk -eu --verbose $(pwd) readonly
+	--verbose 'quoted text' ${HOME} x=1 printf 2>/dev/null && x=1 "$@"
+'quoted text' awk "$1" readonly
+-eu 2>/dev/null readonly cd printf done local 'quoted text' x=1 test grep
+awk 'quoted text' x=1 local awk printf sed 'quoted text' echo test readonly
+	2>/dev/null "$1" "$@" | printf
+		&& -eu "$1" printf test 'quoted text' "$@" | | $(pwd) ${HOME}
+		'quoted text' 2>/dev/null "$1" 'quoted text'
+/usr/bin ${HOME} awk test then
+grep then export $(pwd) ${HOME} readonly
+	echo -eu x=1 cd test
+	readonly x=1 export printf "$1" printf printf ${HOME}
+		x=1 awk "$1" /usr/bin readonly "$@" echo export
+		/usr/bin "$@" 2>/dev/null cd grep sed
+"$@" $(pwd) export readonly --verbose awk && /usr/bin | test ${HOME} awk $(pwd)
+		cd echo "$1" "$@" && x=1 x=1 sed grep test /usr/bin
+		&& printf $(pwd) "$@" readonly
+		export /usr/bin sed -eu cd export local echo 'quoted text'
+echo --verbose 2>/dev/null
+	"$1" --verbose ${HOME} readonly $(pwd) printf && 'quoted text'
+"$@" && export then --verbose test readonly x=1 | x=1 --verbose
+	readonly | export done export awk x=1 -eu echo x=1 --verbose then 2>/dev/null
+local readonly readonly echo grep | ${HOME} -eu --verbose done
+| /usr/bin -eu $(pwd) "$@" test echo x=1 ${HOME} && $(pwd) 2>/dev/null
+		readonly test cd readonly local $(pwd) $(pwd) test
+test cd 2>/dev/null ${HOME} "$@" test awk local test $(pwd) 'quoted text' "$1"
+		test export | 2>/dev/null
+		cd awk -eu && echo "$1" -eu && $(pwd)
+	x=1 grep test "$1" /usr/bin done /usr/bin grep sed test "$1" 2>/dev/null
+test 2>/dev/null cd "$@" "$1" local "$1" ${HOME}
+		${HOME} -eu grep readonly "$@" 'quoted text' done 2>/dev/null
+then | done readonly && -eu -eu test
+sed then && && echo x=1 echo sed -eu sed | grep "$@" -eu local grep $(pwd) echo
+		done -eu awk grep awk && /usr/bin
+"$1" sed 2>/dev/null grep $(pwd) 'quoted text'
+	grep cd readonly then done readonly export ${HOME}
+		awk awk printf --verbose "$1" test 2>/dev/null -eu
+${HOME} 'quoted text' cd echo "$1" sed export readonly &&
+x=1 cd done ${HOME} 'quoted text' $(pwd) cd | echo echo done
+		export ${HOME} export test sed --verbose
+		cd readonly sed --verbose 2>/dev/null $(pwd) -eu test then |
+	--verbose 2>/dev/null /usr/bin printf | && && /usr/bin | -eu grep -eu
+echo | x=1 done -eu local echo | x=1 awk sed && grep then 2>/dev/null local
+		awk $(pwd) --verbose 2>/dev/null test && printf printf
+2>/dev/null cd --verbose
+	grep awk && /usr/bin && export $(pwd)
+		x=1 --verbose local /usr/bin --verbose done
+	sed -eu "$1" then --verbose | -eu "$@" ${HOME} done readonly
+done grep echo 'quoted text' export x=1 && echo awk && 2>/dev/null grep
+printf echo printf echo cd /usr/bin grep ${HOME} 'quoted text' x=1
+	export | /usr/bin export test x=1
+readonly ${HOME} printf echo 'quoted text'
+&& grep 'quoted text' local x=1 ${HOME} ${HOME} readonly
+	sed | "$@" /usr/bin test cd sed && grep export | readonly cd
+		2>/dev/null 2>/dev/null -eu "$@" grep ${HOME} sed local && sed cd /usr/bin
+		export then export grep grep -eu export local
+	&& -eu 2>/dev/null 'quoted text' 'quoted text' --verbose $(pwd) done
+		export 'quoted text' x=1 export /usr/bin
+	&& 2>/dev/null cd | /usr/bin -eu grep 2>/dev/null
+${HOME} export test /usr/bin ${HOME} local "$1" --verbose
+		-eu 'quoted text' done cd 'quoted text'
+		sed | sed 'quoted text' 'quoted text' --verbose ${HOME}
+grep local test local /usr/bin -eu -eu readonly
+		then 'quoted text' "$1" grep
+	then sed then then readonly ${HOME} test export then | readonly
+		'quoted text' export awk x=1 -eu done -eu --verbose
+x=1 x=1 awk readonly export 2>/dev/null "$@" grep sed
+		&& 'quoted text' awk awk --verbose
+		--verbose /usr/bin $(pwd) "$@" awk --verbose $(pwd) $(pwd) then echo
+--verbose printf readonly
+	"$1" 'quoted text' /usr/bin
+	export --verbose cd test /usr/bin printf x=1
+$(pwd) "$@" $(pwd) echo local cd --verbose
+--verbose done | ${HOME} --verbose "$@" | "$1" export
+	$(pwd) 'quoted text' "$1" then echo awk
+	"$1" "$1" export echo local
+'quoted text' done readonly sed printf echo sed then 2>/dev/null && done x=1
+	sed --verbose sed $(pwd) /usr/bin
+	${HOME} then awk "$1" test x=1 printf -eu local export
+		-eu 'quoted text' "$1" sed cd done readonly
+&& ${HOME} $(pwd) --verbose cd sed cd test readonly /usr/bin readonly export
+	sed ${HOME} echo test x=1 $(pwd) echo echo 'quoted text' 'quoted text' | sed
+test ${HOME} && printf local sed echo 2>/dev/null --verbose export then sed
+&& awk done echo local 2>/dev/null export readonly test 'quoted text'
+		--verbose 'quoted text' x=1 echo | x=1 ${HOME} local "$@"
+		grep export /usr/bin cd --verbose $(pwd) readonly readonly
+2>/dev/null 'quoted text'
+"$1" | readonly "$1" $(pwd)
+	awk cd $(pwd) x=1 x=1 -eu cd 'quoted text'
+		readonly test | "$1" -eu grep "$@" $(pwd) ${HOME} then then readonly
+		"$1" grep echo echo test 'quoted text'
+export --verbose test cd -eu x=1 && readonly echo printf
+sed 2>/dev/null "$@" && 'quoted text' && | grep export
+| "$1" --verbose sed export -eu export
+		echo 2>/dev/null 'quoted text'
+	"$@" | 'quoted text' sed "$@" "$@"
+		readonly readonly && test --verbose sed 'quoted text' echo export "$1"
+		local 2>/dev/null awk printf --verbose 2>/dev/null done "$1" "$@" "$@"
+	printf then ${HOME} ${HOME} --verbose sed test 2>/dev/null | $(pwd) grep |
+x=1 test readonly "$@" readonly
+	2>/dev/null 2>/dev/null sed done sed
+	&& ${HOME} cd x=1 x=1 done cd test sed --verbose | sed 'quoted text'
+		2>/dev/null grep test "$1" | "$@" export
+		done $(pwd) local grep
+awk -eu grep "$@" export
+		grep 2>/dev/null grep grep --verbose && export cd "$1"
+-eu cd && ${HOME} echo /usr/bin | 'quoted text' sed "$@" done echo echo
+'quoted text' grep done 2>/dev/null
+${HOME} "$1" test && && echo then /usr/bin printf done "$@" $(pwd) local $(pwd)
+		x=1 ${HOME} then export /usr/bin -eu x=1
+		then ${HOME} done --verbose && export /usr/bin done cd 'quoted text'
+	printf | $(pwd) 'quoted text'
+		done "$1" sed ${HOME}
+		${HOME} 2>/dev/null awk printf sed x=1 test $(pwd) done
+/usr/bin export sed "$@" | "$@" awk sed awk --verbose
+| "$@" test $(pwd) x=1 sed export local "$1" ${HOME} x=1 done /usr/bin
+		readonly cd 2>/dev/null "$@" awk $(pwd) printf --verbose printf
+	cd /usr/bin readonly | $(pwd) export ${HOME} -eu --verbose printf -eu $(pwd)
+		local then sed $(pwd) |
+cd && readonly export then grep awk sed -eu "$1" local local grep then x=1
+		2>/dev/null /usr/bin | done 'quoted text' sed 'quoted text' readonly printf echo
+		readonly grep done echo
+cd readonly done printf 2>/dev/null cd done "$@" 2>/dev/null
+"$1" -eu --verbose awk then
+--verbose --verbose ${HOME} sed local test
+	printf awk local printf then "$1" && x=1 -eu && local echo cd export
+cd then 2>/dev/null grep local x=1 "$1" echo test printf --verbose
+		| "$@" awk | "$@" /usr/bin "$@" ${HOME}
+export local "$@" "$@" /usr/bin sed
+local sed cd sed test echo sed done sed $(pwd)
+		then /usr/bin --verbose "$1" sed then done /usr/bin local
+		local --verbose grep grep | printf
+'quoted text' sed -eu readonly 'quoted text'
+		awk readonly /usr/bin done readonly awk x=1 -eu cd $(pwd)
+		--verbose readonly ${HOME} /usr/bin printf
+		/usr/bin -eu && "$@" --verbose echo awk sed /usr/bin && export echo $(pwd) done
+		then --verbose --verbose done grep awk /usr/bin then
+awk 'quoted text' sed
+		done readonly --verbose readonly export | | /usr/bin
+		| ${HOME} -eu printf && 2>/dev/null grep sed | && sed readonly ${HOME}
+		local grep 2>/dev/null sed 'quoted text' 2>/dev/null
+		test --verbose printf $(pwd) printf
+	sed /usr/bin /usr/bin 2>/dev/null && && cd export test awk "$@" ${HOME}
+	| "$@" printf ${HOME} printf "$1" awk && readonly
+		printf -eu | test -eu 2>/dev/null
+		export "$@" ${HOME} readonly "$@" x=1 readonly export export
+grep 2>/dev/null 'quoted text' ${HOME} "$1" printf | cd test
+	x=1 test /usr/bin x=1 $(pwd) -eu x=1 --verbose &&
+	'quoted text' test 'quoted text' "$1" ${HOME} sed
+		printf 2>/dev/null /usr/bin "$@" 2>/dev/null
+	&& $(pwd) local ${HOME} "$@" $(pwd) awk --verbose 2>/dev/null
+	test /usr/bin "$@" cd 'quoted text' 'quoted text' && echo readonly x=1
+	$(pwd) "$@" done sed local sed cd test 'quoted text' printf 'quoted text'
+	/usr/bin test "$@" && cd | && && readonly "$@"
+echo x=1 -eu awk echo 'quoted text' cd
+		cd export export --verbose awk -eu -eu --verbose && $(pwd) printf x=1 echo grep
+cd local cd 2>/dev/null export local cd echo "$1"
+		2>/dev/null echo --verbose
+		test readonly 2>/dev/null cd ${HOME} 2>/dev/null
+	| --verbose "$@" ${HOME} export printf done export | && ${HOME} then
+2>/dev/null 'quoted text' echo -eu && cd grep "$@" 'quoted text'
+		readonly test $(pwd) $(pwd) "$@" grep readonly test sed export test | then
+	done echo 2>/dev/null sed done then awk grep
+	&& 2>/dev/null done grep sed export 'quoted text' grep -eu grep ${HOME} /usr/bin
+printf cd then "$1" -eu cd /usr/bin cd --verbose /usr/bin --verbose
+		test "$@" echo 'quoted text' $(pwd) 'quoted text' x=1 2>/dev/null export
+	awk -eu grep --verbose sed sed awk 'quoted text' ${HOME} printf x=1 export
+test printf 2>/dev/null cd 2>/dev/null local awk && "$@" test ${HOME}
+	grep -eu done | | x=1 grep | done echo
+		2>/dev/null readonly then done printf cd local test echo
+		echo test --verbose "$@" test -eu $(pwd)
+sed 'quoted text' | export
+		printf "$@" cd local then | readonly x=1 then sed printf
+local grep /usr/bin "$1" local $(pwd) ${HOME} --verbose
+	test export ${HOME} /usr/bin local --verbose
+	test done printf $(pwd) $(pwd) 2>/dev/null ${HOME}
+printf printf export x=1 readonly /usr/bin test printf x=1 "$1"
+then test grep echo x=1 local -eu x=1 echo "$1" $(pwd) grep
+		"$1" 'quoted text' && $(pwd) ${HOME} 'quoted text'
+"$@" && grep cd --verbose 2>/dev/null
+		cd printf "$@" readonly local then | 2>/dev/null printf export 2>/dev/null
+	done readonly && printf done 'quoted text' x=1 local 'quoted text' x=1 && | test
+cd /usr/bin export then awk --verbose $(pwd)
+	"$1" 'quoted text' cd cd sed export awk && readonly $(pwd) | 'quoted text' grep
+		test done local grep | readonly
+		test export "$@" x=1 readonly /usr/bin $(pwd) && -eu x=1 "$1"
+then "$@" | --verbose local echo readonly export sed && /usr/bin
+		done sed then -eu && test --verbose local readonly
+	done ${HOME} -eu --verbose --verbose -eu --verbose
+		/usr/bin -eu 'quoted text' && /usr/bin then --verbose local
+		cd 'quoted text' ${HOME} cd /usr/bin "$@" -eu
+grep sed export test export then
+		grep && sed grep done ${HOME} echo
+	| grep done grep cd export --verbose done --verbose |
+		--verbose test awk done then local cd awk 'quoted text' test x=1 test "$1" done
+		test local x=1 'quoted text' test readonly export readonly
+test --verbose local local
+		printf && /usr/bin export done export
+		export awk printf export echo then
+done 'quoted text' done --verbose && ${HOME} "$1"
+	| test sed --verbose printf $(pwd) export sed -eu ${HOME} sed
+done 'quoted text' "$@" && local echo "$1" 'quoted text' 'quoted text' $(pwd)
+2>/dev/null ${HOME} grep readonly printf done
+x=1 cd export export then -eu -eu
+| --verbose x=1 sed "$@" 'quoted text'
+sed "$@" -eu then | --verbose "$1" awk --verbose grep
+		echo --verbose export
+	$(pwd) test x=1 | -eu export 'quoted text'
+		test "$@" $(pwd) 'quoted text' cd /usr/bin grep
+	done then export --verbose grep export echo | 'quoted text'
+&& awk 'quoted text' cd --verbose cd then export awk -eu
+		x=1 then --verbose "$1" 2>/dev/null echo test local -eu export grep "$@"
+	&& printf cd sed done $(pwd) awk --verbose
+		echo 'quoted text' local sed x=1 --verbose local "$@" export then x=1 export
+echo test -eu 2>/dev/null sed grep
+"$@" echo printf sed grep
+		x=1 'quoted text' 2>/dev/null test
+	2>/dev/null done -eu && grep
+-eu done | "$1" local /usr/bin export cd done
+		awk | export sed && grep local printf export local | awk test -eu 2>/dev/null
+	cd $(pwd) -eu readonly test
+	| done | test awk then sed 'quoted text' ${HOME} "$@" && echo
+	sed export && done echo test cd then ${HOME} 'quoted text' printf &&
+		readonly echo /usr/bin awk ${HOME}
+		'quoted text' test export -eu cd grep /usr/bin ${HOME} -eu awk
+		test echo 'quoted text' 'quoted text'
+readonly awk "$@" --verbose readonly 'quoted text' $(pwd) $(pwd)
+	test 2>/dev/null local cd export sed done readonly sed then done awk test
+		test 2>/dev/null then local cd export x=1 test printf | $(pwd)
+"$@" "$@" printf ${HOME} done grep 'quoted text' ${HOME}
+		test grep echo "$@" local /usr/bin cd $(pwd) ${HOME} then
+	export local "$@" ${HOME} then && x=1 local $(pwd)
+	awk && --verbose test export "$@" 'quoted text' then "$@"
+--verbose printf printf "$1" grep 2>/dev/null export --verbose readonly done
+-eu awk --verbose cd
+		/usr/bin -eu "$1" test x=1 local -eu done $(pwd)
+	"$1" sed 'quoted text' 'quoted text' $(pwd) "$1" sed ${HOME}
+printf echo x=1 'quoted text' echo --verbose cd --verbose
+	export -eu $(pwd) -eu awk "$1" export /usr/bin && -eu printf
+	-eu && "$@" $(pwd) -eu grep 2>/dev/null /usr/bin /usr/bin awk local done readonly
+	then "$@" echo && sed 'quoted text' test | sed $(pwd) export ${HOME}
+-eu "$1" sed --verbose /usr/bin
+awk /usr/bin x=1 'quoted text'
+		"$1" --verbose cd --verbose done ${HOME}
+x=1 grep && ${HOME} grep -eu printf sed test then
+		grep x=1 | && local x=1 --verbose
+	/usr/bin | echo 2>/dev/null ${HOME} test x=1 awk done printf x=1
+	"$@" readonly printf --verbose cd sed x=1 'quoted text'
+	readonly echo test /usr/bin
+export && sed "$@" /usr/bin 'quoted text' done && 2>/dev/null readonly then cd
+	printf $(pwd) cd export sed sed then awk echo test -eu sed 'quoted text'
+"$@" -eu x=1 | cd readonly ${HOME} --verbose | 'quoted text'
+	awk $(pwd) sed grep sed "$1" | /usr/bin && echo then -eu awk printf ${HOME}
+		x=1 "$@" "$@" done 'quoted text' -eu /usr/bin -eu x=1 "$@" awk export local
+	| test grep | then then done then 2>/dev/null sed x=1 x=1
+printf readonly && sed
+/usr/bin 'quoted text' then done
+	2>/dev/null && grep 'quoted text' /usr/bin printf cd local &&
+"$1" local "$1" local ${HOME} && printf echo awk | x=1 'quoted text' test
+		$(pwd) ${HOME} awk $(pwd) "$1" then "$1" export
+	"$@" then -eu && && local --verbose local readonly echo | then
+cd cd then export local export | -eu sed test /usr/bin export local
+	-eu readonly "$1" export printf 'quoted text' grep awk /usr/bin "$1"
+	local then "$@" then $(pwd) readonly local awk ${HOME} 'quoted text' echo && readonly
+		then local 2>/dev/null awk 2>/dev/null | 2>/dev/null --verbose ${HOME} then
+grep "$1" 'quoted text' printf "$1" local x=1 x=1 2>/dev/null sed grep
+awk $(pwd) ${HOME} printf readonly readonly
+	readonly 2>/dev/null sed | done cd $(pwd) echo $(pwd) grep "$@" sed printf
+awk "$@" echo "$1" 'quoted text'
+"$@" /usr/bin | awk x=1 echo 'quoted text' awk grep -eu cd x=1 'quoted text'
+		'quoted text' 'quoted text' test
+		cd | sed echo export $(pwd) x=1 ${HOME} local grep printf ${HOME} readonly
+	-eu 'quoted text' then x=1 $(pwd) 'quoted text' $(pwd) sed local $(pwd) sed local
+	sed sed /usr/bin readonly printf
+		grep -eu done /usr/bin 'quoted text' echo done echo x=1 sed export ${HOME}
+	-eu "$1" "$@" 'quoted text'
+	export local $(pwd) -eu awk done && /usr/bin /usr/bin
+"$1" 'quoted text' | readonly "$1" x=1 'quoted text'
+| ${HOME} && printf sed local 2>/dev/null
+		-eu readonly then done awk
+	echo $(pwd) printf awk test printf printf readonly export
+cd -eu ${HOME} && cd | echo
+	'quoted text' 'quoted text' readonly grep /usr/bin
+		${HOME} export awk export "$@" done cd test | cd --verbose -eu readonly --verbose
+&& ${HOME} cd grep 2>/dev/null x=1
+2>/dev/null ${HOME} then | && local "$@" printf $(pwd) $(pwd) printf
+test grep x=1 grep 'quoted text'
+-eu cd cd -eu printf echo ${HOME}
+		-eu /usr/bin x=1 | test 'quoted text'
+	sed -eu printf ${HOME} "$@" "$1" cd done $(pwd)
+		grep | export $(pwd) sed ${HOME} "$@" $(pwd) local
+		cd awk sed printf grep "$@" 2>/dev/null
+'quoted text' --verbose then readonly 'quoted text' then x=1 x=1 ${HOME}
+${HOME} cd --verbose | /usr/bin
+local grep /usr/bin ${HOME} | done readonly export "$@" readonly
+		| x=1 local local ${HOME}
+		grep && cd awk then 2>/dev/null local export --verbose | $(pwd) && done printf
+/usr/bin readonly | done then export sed awk sed grep sed && /usr/bin
+$(pwd) grep export sed grep grep ${HOME} printf
+--verbose 2>/dev/null readonly
+'quoted text' grep grep x=1 then | 'quoted text'
+	2>/dev/null ${HOME} test "$1"
+		grep echo x=1 -eu $(pwd) awk cd /usr/bin cd awk echo 2>/dev/null
+		-eu /usr/bin | ${HOME} test $(pwd) then 'quoted text'
+		-eu x=1 /usr/bin --verbose local x=1 | && test $(pwd) awk cd "$@" printf ${HOME}
+	"$@" cd "$@" "$1" printf readonly 'quoted text'
+		"$1" ${HOME} | awk /usr/bin readonly cd test 2>/dev/null
+export 2>/dev/null "$@" x=1
+/usr/bin && "$@" export $(pwd) then --verbose printf ${HOME} echo -eu --verbose
+	--verbose 'quoted text' grep
+	sed 2>/dev/null x=1 x=1 --verbose | /usr/bin local awk then 'quoted text'
+sed export "$@" /usr/bin test done -eu test 2>/dev/null
+		done echo -eu export readonly sed awk ${HOME} /usr/bin 2>/dev/null sed done
+	"$@" "$1" cd $(pwd) awk sed grep $(pwd) && done awk echo readonly
+	${HOME} x=1 --verbose cd local done "$1" | grep 'quoted text' x=1 printf $(pwd)
+| | readonly /usr/bin | x=1 printf && echo export
+--verbose printf "$1" sed awk test "$1" "$1" test grep awk --verbose "$@" --verbose
+awk export sed x=1 export --verbose
+		| awk "$@" then test test
+-eu x=1 then cd 'quoted text' x=1 printf x=1 "$1" grep cd test done grep
+-eu readonly grep /usr/bin $(pwd) readonly awk "$@" 'quoted text'
+export grep $(pwd) | then then export 2>/dev/null "$@" sed local awk --verbose
+		printf /usr/bin -eu then cd -eu local
+		'quoted text' printf "$@" "$@" readonly awk $(pwd) then
+test export awk 2>/dev/null ${HOME} then 2>/dev/null grep "$1" "$1" |
+		export awk local ${HOME}
+awk awk readonly test x=1 'quoted text'
+		echo "$1" then awk | 2>/dev/null 'quoted text' test readonly cd awk echo | readonly
+${HOME} export | export 'quoted text' echo 2>/dev/null 2>/dev/null
+"$@" -eu | "$1" "$@" ${HOME} "$@" grep export 'quoted text' x=1 | /usr/bin
+	"$1" local echo -eu | grep
+	--verbose cd 'quoted text' echo awk "$@"
+	&& "$@" grep && "$1" readonly readonly /usr/bin && 2>/dev/null awk
+then && 2>/dev/null $(pwd) 2>/dev/null done | "$1"
+	readonly readonly cd x=1 awk export /usr/bin then grep done $(pwd) printf printf
+	grep x=1 x=1 cd test then x=1 'quoted text'
+printf "$1" $(pwd) $(pwd) grep -eu export then then x=1 'quoted text'
+	&& 2>/dev/null done done
+	--verbose export echo x=1 && x=1 cd
+		then 'quoted text' $(pwd) 2>/dev/null
+		"$1" --verbose --verbose grep "$1" printf --verbose
+x=1 | done cd --verbose | test echo -eu export printf awk test
+readonly awk -eu --verbose awk export $(pwd)
+		--verbose printf 'quoted text' 'quoted text' test printf
+test then $(pwd) /usr/bin readonly grep printf "$@" && readonly 2>/dev/null
+		$(pwd) readonly awk -eu test cd export sed awk "$@" -eu then /usr/bin grep 2>/dev/null
+	x=1 "$1" 'quoted text' then 'quoted text' --verbose
+sed export "$@" printf grep local grep "$1" awk cd "$1" awk sed cd -eu 'quoted text'
+grep --verbose readonly then 'quoted text' then $(pwd) ${HOME}
+	awk && $(pwd) "$@" readonly
+		"$1" local "$1" -eu sed printf && "$@" -eu printf x=1 | awk then
+/usr/bin | awk readonly ${HOME} printf && && export
+		/usr/bin grep | "$1" printf export
+		readonly "$1" x=1 && | grep sed awk local grep "$@" 2>/dev/null printf printf
+test x=1 "$@" local "$@" x=1 done
+/usr/bin --verbose export echo readonly && test 2>/dev/null x=1 readonly
+	local awk cd "$@" cd
+		x=1 cd grep --verbose x=1 done | readonly && -eu then /usr/bin cd "$1" local
+		cd x=1 x=1 echo | local
+then readonly $(pwd) readonly ${HOME} 'quoted text'
+export 'quoted text' printf "$@" printf sed printf cd sed echo x=1 awk "$@"
+		printf printf /usr/bin done done readonly then 2>/dev/null
+| /usr/bin then then x=1 $(pwd) x=1 grep
+		test sed ${HOME} cd done done "$1" local 'quoted text' done
+		sed --verbose cd sed test then then sed grep then sed "$1" local test awk
+	then local awk printf readonly 2>/dev/null "$@" sed -eu | then x=1 $(pwd) "$1"
+	awk grep done awk ${HOME} 'quoted text'
+		-eu readonly -eu $(pwd) "$@" /usr/bin $(pwd) done printf x=1 2>/dev/null --verbose
+local -eu --verbose 'quoted text' test printf
+	printf /usr/bin local local 'quoted text' grep
+2>/dev/null "$1" "$1" --verbose local | 'quoted text'
+echo 2>/dev/null printf then
+$(pwd) echo 2>/dev/null
+		&& awk local x=1 2>/dev/null grep awk printf "$@" export && | "$@" -eu
+	local | local awk 'quoted text' cd done -eu /usr/bin
+	"$1" ${HOME} x=1 done | done done 'quoted text' export
+		echo /usr/bin export awk printf | awk sed echo export then 2>/dev/null 'quoted text'
+		x=1 printf /usr/bin grep 'quoted text' export cd awk 'quoted text' | ${HOME} grep
+printf readonly $(pwd) x=1 test 2>/dev/null -eu local readonly
+		-eu echo awk local "$@" test readonly | --verbose export 'quoted text' readonly
+		"$1" "$@" done | $(pwd) && /usr/bin ${HOME} cd 2>/dev/null grep echo x=1 readonly
+	"$@" export /usr/bin /usr/bin $(pwd)
+x=1 --verbose sed && --verbose $(pwd) then printf $(pwd) done /usr/bin
+done cd && ${HOME} local
+	local /usr/bin | local done | -eu --verbose | export
+	"$1" | -eu | sed | --verbose echo
+	&& then --verbose done ${HOME} /usr/bin readonly then $(pwd) "$@" printf 2>/dev/null
+&& test sed 2>/dev/null done
+		printf --verbose ${HOME} done | ${HOME}
+--verbose echo readonly then export export cd /usr/bin grep test
+	/usr/bin 2>/dev/null cd "$1" printf readonly grep ${HOME} test
+		awk /usr/bin ${HOME} | export && "$1" "$@" echo
+sed readonly then "$@" 2>/dev/null x=1 grep /usr/bin && cd done local
+		sed test done sed done /usr/bin export
+		echo printf sed local | cd then printf local
+		"$@" readonly /usr/bin test sed --verbose awk | readonly | && "$@" cd then done
+	"$@" 2>/dev/null /usr/bin sed
+sed x=1 "$1" $(pwd) readonly && done --verbose "$1" done
+	2>/dev/null /usr/bin test -eu "$@" local printf
+	&& $(pwd) cd -eu "$1" 'quoted text' | awk /usr/bin local
+	export x=1 ${HOME} cd x=1 'quoted text' "$@" grep readonly sed
+	grep --verbose 'quoted text' ${HOME} local cd | export "$@" $(pwd)
+		"$@" printf x=1 /usr/bin 'quoted text'
+$(pwd) 'quoted text' 'quoted text' 'quoted text' test | 2>/dev/null
+$(pwd) local readonly echo 'quoted text' test ${HOME}
+sed 'quoted text' $(pwd) awk --verbose grep
+local grep 2>/dev/null grep ${HOME} echo local x=1 -eu cd | ${HOME}
+local sed && --verbose ${HOME} x=1 cd awk done "$1" 2>/dev/null "$1" awk sed
+		2>/dev/null /usr/bin done sed x=1 grep $(pwd)
+		--verbose "$@" /usr/bin ${HOME} x=1 then "$@" echo "$1" then then local local
+test readonly "$@" -eu export done 'quoted text' /usr/bin awk
+	--verbose "$1" x=1 $(pwd) /usr/bin sed 2>/dev/null test done 2>/dev/null
+&& "$@" sed "$@" export -eu && grep -eu then x=1
+		-eu x=1 | 'quoted text' cd /usr/bin 'quoted text' echo | export then sed cd
+	/usr/bin cd 'quoted text'
+&& /usr/bin "$1" && -eu -eu $(pwd) && then x=1 grep local 'quoted text' -eu
+	grep 2>/dev/null 'quoted text' then printf
+	2>/dev/null readonly "$@" x=1 printf echo
+awk cd "$1" "$@" readonly awk
+		readonly $(pwd) 2>/dev/null
+echo --verbose 2>/dev/null | && awk x=1 sed printf grep test grep x=1 2>/dev/null
+cd then && 'quoted text' sed /usr/bin $(pwd) awk 'quoted text'
+		grep -eu | 2>/dev/null "$1" sed --verbose cd ${HOME} x=1 $(pwd)
+	printf sed echo /usr/bin local cd 'quoted text' sed ${HOME} then 2>/dev/null
+	--verbose local x=1 ${HOME} grep then "$@" x=1 awk 'quoted text'
+-eu export readonly $(pwd) | test | 'quoted text'
+test "$@" 'quoted text'
+export printf cd export readonly
+"$1" cd grep && /usr/bin "$1" test export done then "$1"
+		$(pwd) && local cd 2>/dev/null x=1
+&& done echo printf && echo local awk sed ${HOME} --verbose
+done readonly x=1 2>/dev/null --verbose "$@"
+		grep $(pwd) test | 2>/dev/null then grep then $(pwd) -eu | "$@" "$@" "$1"
+$(pwd) | x=1 export done sed local | done -eu 2>/dev/null |
+	local -eu "$1" /usr/bin "$@" export --verbose
+		awk local 'quoted text' export $(pwd) local grep
+local export awk readonly
+		'quoted text' done /usr/bin export cd --verbose test /usr/bin
+	| ${HOME} 2>/dev/null printf /usr/bin
+	local -eu $(pwd) echo local
+	&& -eu local ${HOME} /usr/bin sed /usr/bin --verbose x=1 printf x=1 /usr/bin |
+		done done x=1 /usr/bin /usr/bin
+sed printf sed && && "$@" cd 2>/dev/null "$@" $(pwd)
+cd grep x=1 -eu x=1 local $(pwd) "$1" -eu 'quoted text'
+	x=1 -eu "$@" cd local test test
+awk "$@" 2>/dev/null 'quoted text' | local /usr/bin && /usr/bin
+		/usr/bin ${HOME} test /usr/bin "$1" --verbose | "$1" /usr/bin
+		'quoted text' | cd ${HOME} --verbose export then printf then 2>/dev/null x=1 readonly
+		sed "$@" test "$@" local awk local 2>/dev/null
+	/usr/bin readonly --verbose grep test | sed --verbose
+	'quoted text' "$1" printf done sed x=1 -eu awk printf then
+grep readonly grep | && "$1" --verbose "$@" -eu sed
+	local sed && | local
+	'quoted text' sed "$@" "$@" | test /usr/bin "$1" 2>/dev/null x=1
+		"$1" export then $(pwd) done sed 2>/dev/null echo done
+		/usr/bin then cd echo then
+local /usr/bin then then $(pwd) --verbose grep readonly
+$(pwd) echo echo sed cd test grep
+		| echo grep printf x=1 local echo "$@" $(pwd) $(pwd) echo "$1" then
+		&& local test readonly awk
+		test "$@" "$1" "$1" ${HOME} cd cd "$1" local
+		&& && echo test 'quoted text' sed x=1 echo awk /usr/bin local
+		cd 2>/dev/null 'quoted text' "$@" "$@" 'quoted text' echo readonly
+	2>/dev/null cd sed x=1 test "$@" 2>/dev/null 'quoted text'
+then | 'quoted text' --verbose "$@" --verbose
+	test export sed echo awk $(pwd) ${HOME} test ${HOME} done grep
+		&& ${HOME} readonly && local cd x=1 local echo
+local | "$1" test x=1 2>/dev/null
+then | then grep -eu | && test sed ${HOME} -eu awk "$1" local
+export 'quoted text' export x=1 && export export readonly awk | /usr/bin ${HOME}
+	&& awk "$1" -eu export awk 'quoted text' $(pwd) awk grep cd ${HOME} printf
+	"$@" "$@" -eu "$1" done done export "$@"
+		test && | | readonly | sed
+-eu /usr/bin "$@" done ${HOME} 'quoted text' $(pwd) 2>/dev/null
+		test then cd readonly readonly ${HOME} "$1" 2>/dev/null awk x=1 2>/dev/null
+		cd "$@" local export echo grep readonly x=1 "$@" --verbose
+printf done --verbose then readonly --verbose
+done "$@" | | grep grep
+		sed printf local awk
+	grep $(pwd) /usr/bin
+x=1 local done export | ${HOME} "$@"
+"$@" --verbose sed "$@" | "$1" $(pwd)
+	"$@" "$@" grep && done $(pwd)
+	cd grep cd x=1 done "$1" cd cd then --verbose -eu
+	"$1" --verbose test grep local printf echo
+		x=1 'quoted text' 'quoted text' 2>/dev/null 'quoted text' 2>/dev/null
+	cd "$@" echo cd echo then && awk /usr/bin awk cd export
+	echo awk cd $(pwd) echo test printf && printf echo sed
+	"$1" ${HOME} echo x=1 ${HOME} then "$@"
+	"$1" "$1" /usr/bin export grep awk export
+	2>/dev/null awk grep cd -eu awk | /usr/bin local test "$@" test grep local
+	printf echo awk x=1 export 2>/dev/null -eu ${HOME} && && sed
+	sed sed "$@" "$1" "$@"
+export readonly $(pwd) printf | sed sed then export test
+		printf ${HOME} done printf ${HOME} && 2>/dev/null -eu echo $(pwd) x=1 $(pwd)
+	done x=1 echo x=1 echo
+		${HOME} awk sed ${HOME} && ${HOME} cd grep "$1" export
+		printf | -eu /usr/bin done export 'quoted text' x=1 printf /usr/bin
+	${HOME} -eu echo cd echo printf sed export echo export
+	local grep awk echo readonly
+		done done --verbose x=1 echo ${HOME} printf && readonly awk
+		${HOME} 'quoted text' "$@" readonly && sed
+		test && done $(pwd) -eu awk x=1 --verbose then readonly test /usr/bin
+awk | awk done --verbose "$1" && then grep export "$@" 'quoted text' done /usr/bin
+	cd test 2>/dev/null "$@" --verbose 2>/dev/null done
+		sed && ${HOME} 2>/dev/null
+	'quoted text' x=1 sed awk /usr/bin ${HOME} grep
+export echo export x=1 done awk then | "$1" x=1 "$@" /usr/bin awk | -eu awk
+printf awk -eu ${HOME} echo -eu
+		echo sed test export grep echo done awk then
+		"$1" 'quoted text' echo awk awk -eu
+--verbose local ${HOME} test x=1 export
+	$(pwd) 2>/dev/null awk readonly 2>/dev/null -eu $(pwd) "$1" $(pwd) $(pwd)
+		cd echo readonly --verbose local 'quoted text' awk sed grep grep /usr/bin
+		export -eu echo x=1 readonly /usr/bin "$1" awk 2>/dev/null $(pwd)
+	x=1 done echo /usr/bin /usr/bin echo export -eu --verbose cd sed awk local test
+		| ${HOME} sed 2>/dev/null readonly -eu "$@" awk export cd
+	| && /usr/bin $(pwd) test echo local "$@" done
+2>/dev/null "$@" done "$@" | echo "$@" 2>/dev/null /usr/bin
+	export | -eu echo sed echo x=1
+		&& ${HOME} echo awk grep done ${HOME} && 'quoted text' then 'quoted text'
+	done export --verbose x=1 sed $(pwd) sed echo done export
+		echo done --verbose 2>/dev/null
+		| -eu echo --verbose ${HOME} cd echo |
+	-eu | "$1" 'quoted text'
+local done 2>/dev/null && cd ${HOME} awk | $(pwd) local then then echo
+2>/dev/null $(pwd) /usr/bin --verbose echo echo awk sed
+		local readonly /usr/bin sed grep 2>/dev/null && echo export --verbose awk | sed
+	echo test cd local then /usr/bin cd awk
+		| "$@" 'quoted text' $(pwd) cd | export --verbose
+test "$1" printf x=1 done sed 'quoted text' "$@" test sed readonly
+local --verbose printf grep 'quoted text' local $(pwd) sed test
+#include c254.sh
+$(pwd) printf | grep then
+		cd $(pwd) --verbose grep grep $(pwd)
+		awk "$@" readonly export export "$@" x=1 && -eu "$1" awk "$@"
+		test grep --verbose && readonly local 'quoted text' $(pwd) /usr/bin readonly local
+	x=1 sed | test printf echo "$1" 'quoted text' printf then printf
+'quoted text' 2>/dev/null test readonly "$1" readonly echo sed
+	$(pwd) 'quoted text' done -eu --verbose
+		"$@" printf readonly ${HOME} then 2>/dev/null
+	cd test sed --verbose then grep
+	"$@" $(pwd) | x=1 "$@" test 'quoted text'
+	"$1" $(pwd) grep export "$@" /usr/bin
+		x=1 --verbose x=1 --verbose
+done then printf && then | "$@" && readonly test export grep 2>/dev/null grep
+	${HOME} test readonly printf done readonly export "$1"
+		awk printf --verbose /usr/bin $(pwd) 2>/dev/null -eu "$@" && readonly echo
+"$1" cd 2>/dev/null test export printf then sed ${HOME} echo
+		readonly done export $(pwd) x=1 && readonly | /usr/bin
+		${HOME} printf readonly printf test export -eu | $(pwd) "$1"
+		local awk printf 'quoted text' printf echo -eu "$@" echo
+		--verbose $(pwd) 'quoted text'
+| then cd cd echo test && export readonly printf export && test ${HOME} done
+$(pwd) -eu --verbose ${HOME} awk readonly
+done "$@" $(pwd) x=1 grep awk grep 'quoted text'
+		printf grep -eu done done ${HOME} test
+		"$1" grep awk "$1" "$@" && grep echo && -eu "$1" "$1" "$1" x=1
+	"$@" /usr/bin test && && -eu export && echo
+		readonly printf "$1" printf -eu
+	grep 2>/dev/null /usr/bin printf readonly 'quoted text' |
+	echo then -eu "$1" && x=1 | -eu local /usr/bin $(pwd) awk "$@" test
+sed done $(pwd) -eu readonly --verbose $(pwd) /usr/bin
+cd readonly "$@" then
+-eu /usr/bin grep cd done x=1 export x=1 export done readonly done grep test
+		-eu test readonly $(pwd)
+		--verbose ${HOME} 2>/dev/null readonly local grep ${HOME}
+"$@" test "$@" ${HOME} then | cd -eu "$1" && printf then
+/usr/bin 2>/dev/null export
+--verbose "$1" done echo then | 2>/dev/null grep x=1 x=1 && 'quoted text'
+		&& grep local export --verbose
+&& 2>/dev/null /usr/bin sed echo x=1 $(pwd) echo -eu "$@" then
+	| && && export done x=1 && "$1" -eu done grep then readonly awk
+printf test | | -eu --verbose
+	| && --verbose sed done cd grep x=1 "$1" ${HOME}
+--verbose test x=1 export then "$1" then "$@" $(pwd)
+		awk test -eu -eu awk "$1" --verbose echo echo done done sed
+local sed -eu && ${HOME} sed done cd --verbose sed "$1" &&
+	then printf printf ${HOME} then /usr/bin printf && x=1 echo $(pwd)
+	${HOME} done export -eu test ${HOME} --verbose
+	"$@" 2>/dev/null $(pwd) done awk readonly /usr/bin awk sed then grep /usr/bin
+	x=1 ${HOME} grep ${HOME} 2>/dev/null --verbose ${HOME} sed test awk test grep
+		export awk && x=1 'quoted text' --verbose $(pwd) awk done awk then
+printf 'quoted text' echo | printf "$1" 'quoted text'
+	done "$@" ${HOME} x=1 x=1 echo grep 2>/dev/null "$1" x=1 test 'quoted text'
+	2>/dev/null test sed grep "$@" ${HOME}
+test cd grep test printf cd awk local awk && readonly local
+	done sed grep grep "$1" 'quoted text' printf x=1 'quoted text'
+		'quoted text' "$1" cd readonly cd
+x=1 local $(pwd) done ${HOME} grep $(pwd) 2>/dev/null done
+	2>/dev/null $(pwd) cd -eu --verbose
+	x=1 echo "$1" "$1" $(pwd) printf ${HOME} sed
+	$(pwd) /usr/bin | cd export $(pwd) grep readonly
+	echo done 2>/dev/null --verbose ${HOME} done then "$@"
+$(pwd) grep 2>/dev/null
+		| x=1 test local && cd /usr/bin sed printf then echo sed $(pwd) printf local
+	local export sed readonly sed sed | "$1" printf local printf awk printf
+export x=1 sed 2>/dev/null x=1 /usr/bin -eu -eu test 2>/dev/null
+		test local readonly && export grep /usr/bin --verbose "$@" sed
+	readonly --verbose && printf awk echo x=1 | --verbose && 2>/dev/null
+-eu $(pwd) 2>/dev/null $(pwd) -eu | awk 2>/dev/null
+		"$1" test readonly 'quoted text' $(pwd) -eu grep done test then printf echo "$1"
+"$1" test done export /usr/bin export then $(pwd) | sed
+-eu -eu awk --verbose && cd printf 'quoted text'
+		sed echo x=1 printf x=1 done echo | grep
+		"$1" test 2>/dev/null cd /usr/bin sed test local then | readonly
+| awk printf ${HOME}
+		/usr/bin grep 2>/dev/null 'quoted text' echo
+	cd grep awk -eu 2>/dev/null echo local x=1 $(pwd)
+	test test printf readonly 2>/dev/null 2>/dev/null x=1 'quoted text'
+	"$@" | export local --verbose x=1 done echo then ${HOME} --verbose printf
+grep 'quoted text' -eu grep cd $(pwd) "$@" printf then ${HOME}
+--verbose $(pwd) export awk echo then "$1"
+2>/dev/null /usr/bin x=1
+grep "$1" "$1" ${HOME} local awk 'quoted text'
+/usr/bin grep ${HOME} then
+	local | /usr/bin "$@" awk export ${HOME} ${HOME} $(pwd) 2>/dev/null export $(pwd)
+then 'quoted text' "$1" $(pwd) printf then "$1"
+	grep $(pwd) "$1" cd $(pwd) grep test -eu then 'quoted text' x=1
+	export 2>/dev/null | local export /usr/bin done test 'quoted text'
+	$(pwd) 2>/dev/null grep 2>/dev/null grep readonly --verbose
+test local --verbose export --verbose --verbose
+	echo printf --verbose && 'quoted text' | grep local
+	printf local x=1 echo test test x=1 sed ${HOME} export ${HOME} x=1 /usr/bin
+	grep x=1 "$@" x=1 cd /usr/bin
+"$1" "$1" -eu local | --verbose
+then sed ${HOME} $(pwd) | cd -eu
+	-eu echo && echo awk echo export echo x=1 readonly 'quoted text'
+	$(pwd) local echo awk done echo export sed
+	printf 'quoted text' readonly done awk 2>/dev/null "$@" sed
+	/usr/bin x=1 done /usr/bin done cd then ${HOME}
+2>/dev/null echo export 'quoted text' done sed printf sed
+		grep "$@" test cd grep $(pwd) 'quoted text' 'quoted text' grep export printf grep
+2>/dev/null then cd sed
+		x=1 $(pwd) && readonly /usr/bin
+		--verbose /usr/bin cd 2>/dev/null 'quoted text' | && sed /usr/bin grep --verbose
+| 2>/dev/null 'quoted text' /usr/bin
+	sed done && ${HOME} cd ${HOME} "$1"
+	cd done echo local grep echo local
+		| $(pwd) test 'quoted text' --verbose | echo --verbose --verbose test readonly
+grep local export | ${HOME} sed --verbose grep x=1 "$1" grep readonly then x=1
+	x=1 | 'quoted text' printf export "$1" | && --verbose -eu &&
+	"$1" 2>/dev/null -eu -eu x=1 --verbose
+local 'quoted text' | $(pwd) done echo 'quoted text' cd /usr/bin grep 'quoted text'
+	awk local echo echo echo sed export export -eu done x=1 echo 'quoted text'
+'quoted text' ${HOME} test grep done sed "$@" $(pwd) "$@" echo 2>/dev/null --verbose
+	grep $(pwd) echo /usr/bin
+	"$@" export cd /usr/bin x=1
+		"$1" done && echo ${HOME} /usr/bin then x=1
+	export readonly printf readonly cd grep printf export /usr/bin && ${HOME}
+	"$@" 2>/dev/null then grep && --verbose 2>/dev/null readonly
+		-eu && 2>/dev/null test "$@" 2>/dev/null test | -eu
+		| done && $(pwd) 'quoted text' grep 'quoted text' export local --verbose printf
+		"$@" 2>/dev/null /usr/bin "$1" 2>/dev/null grep | then local x=1 x=1 2>/dev/null
+		| echo 2>/dev/null grep x=1 readonly --verbose $(pwd) test printf
+	test sed awk 2>/dev/null test echo |
+		cd "$@" then x=1 cd x=1 test readonly then 'quoted text' "$@"
+		| x=1 then echo grep "$1" awk "$1" echo -eu && 'quoted text' then
+		"$1" printf 'quoted text' sed printf --verbose then done x=1 ${HOME} /usr/bin
+		| "$1" export 2>/dev/null then | readonly /usr/bin awk readonly && readonly
+	/usr/bin 2>/dev/null then then
+		| x=1 'quoted text' then done sed -eu cd local then $(pwd) echo echo ${HOME}
+	| x=1 done && --verbose -eu /usr/bin $(pwd)
+		local printf --verbose
+		local cd local -eu printf "$1" ${HOME} --verbose
+		export /usr/bin then --verbose grep cd
+	x=1 then local then grep test cd "$@" /usr/bin && then
+printf printf local 2>/dev/null export "$1"
+	x=1 $(pwd) && x=1 cd awk 2>/dev/null "$@"
+"$@" then "$@" $(pwd) --verbose $(pwd) readonly grep cd
+	$(pwd) /usr/bin echo
+then $(pwd) ${HOME} 'quoted text' awk -eu
+		local grep grep test "$1" printf && "$@" 'quoted text'
+grep x=1 "$@" test "$1" awk 'quoted text' "$@" done export cd test
+	/usr/bin echo then echo 2>/dev/null -eu | local x=1
+	sed readonly x=1 'quoted text' sed
+		/usr/bin ${HOME} "$@" sed done
+	| 2>/dev/null export done awk /usr/bin local test --verbose echo | sed
+2>/dev/null grep && |
+		2>/dev/null /usr/bin local $(pwd) awk 2>/dev/null /usr/bin done export readonly
+		${HOME} done grep awk /usr/bin local test x=1 sed
+x=1 --verbose done grep --verbose "$@" printf done
+"$1" && awk x=1 x=1 cd 2>/dev/null "$@" then x=1 && && awk grep
+	'quoted text' 'quoted text'
+printf readonly 2>/dev/null then echo "$@" export x=1
+'quoted text' /usr/bin -eu -eu
+		"$@" | --verbose --verbose awk ${HOME} $(pwd) readonly --verbose local 2>/dev/null
+	grep && ${HOME} /usr/bin 2>/dev/null $(pwd) test -eu $(pwd)
+local $(pwd) 'quoted text' --verbose 'quoted text' export 2>/dev/null local grep
+	sed awk then 'quoted text' then cd awk sed --verbose grep
+	${HOME} /usr/bin echo -eu | "$1"
+		x=1 test grep local 'quoted text' -eu
+-eu "$1" x=1 printf | readonly "$@" $(pwd) 2>/dev/null awk /usr/bin
+		$(pwd) grep ${HOME} done sed "$@" readonly -eu then "$1"
+		2>/dev/null grep "$@"
+$(pwd) awk "$1" && 'quoted text' ${HOME} awk && 'quoted text' echo sed
+readonly x=1 && sed readonly
+		"$@" "$@" --verbose "$@" 2>/dev/null export then
+		x=1 printf | | grep awk x=1 export "$@" -eu then --verbose x=1 | grep
+		-eu -eu /usr/bin 2>/dev/null echo
+2>/dev/null local export then cd done done test /usr/bin
+grep 2>/dev/null --verbose $(pwd) printf && 2>/dev/null
+	grep && ${HOME} x=1 --verbose $(pwd) x=1 grep 'quoted text' readonly "$1" &&
+x=1 x=1 /usr/bin test -eu $(pwd)
+	"$@" awk "$@" --verbose readonly
+	cd x=1 /usr/bin 'quoted text' | /usr/bin echo printf &&
+		| export | "$1" readonly | && x=1 && cd readonly | -eu readonly
+2>/dev/null "$1" 2>/dev/null "$1" export "$1"
+		${HOME} -eu 'quoted text' x=1 | x=1 ${HOME} test --verbose 2>/dev/null
+then export 2>/dev/null cd "$@"
+	"$@" x=1 grep ${HOME} $(pwd)
+	awk awk --verbose 'quoted text' printf
+		"$@" 2>/dev/null ${HOME} readonly -eu $(pwd)
+		echo $(pwd) x=1 $(pwd) ${HOME}
+		awk echo test --verbose 2>/dev/null
+	${HOME} 'quoted text' grep then --verbose grep $(pwd) sed sed "$1"
+${HOME} readonly readonly && grep x=1 awk
+then $(pwd) && --verbose /usr/bin
+		test then cd | readonly printf x=1 cd
+	"$@" sed then export
+"$@" /usr/bin test readonly 2>/dev/null | local /usr/bin sed -eu
+	-eu grep cd echo grep awk test --verbose &&
+${HOME} --verbose done 2>/dev/null 2>/dev/null export "$1" then
+echo "$@" -eu printf readonly x=1 'quoted text'
+test printf -eu "$@" ${HOME} $(pwd) x=1 x=1 $(pwd) --verbose $(pwd) ${HOME}
+	awk sed "$1" 2>/dev/null export /usr/bin echo local /usr/bin
+-eu --verbose echo --verbose sed readonly done export printf
+2>/dev/null export -eu 'quoted text' export grep sed sed x=1 'quoted text'
+local then 2>/dev/null grep x=1 --verbose printf -eu && printf grep 2>/dev/null
+		sed cd local awk cd readonly ${HOME} | && 'quoted text'
+x=1 local done then done local local local $(pwd) ${HOME}
+		test readonly 'quoted text' -eu awk "$1"
+test echo awk /usr/bin cd cd "$@" "$1" ${HOME} &&
+echo "$1" then grep -eu "$1" local test sed done then readonly $(pwd) local
+local readonly ${HOME} && test awk grep
+		grep cd sed grep $(pwd) cd done x=1 done echo cd awk local
+	export $(pwd) $(pwd) cd ${HOME} local test then x=1 echo
+	$(pwd) "$@" 'quoted text' && /usr/bin
+	then then done awk then -eu /usr/bin export
+	readonly 2>/dev/null readonly
+		export --verbose $(pwd) cd && ${HOME} "$@" sed readonly export
+2>/dev/null "$@" readonly x=1 ${HOME} x=1 $(pwd)
+	then "$1" export /usr/bin export awk -eu 2>/dev/null
+	$(pwd) readonly local --verbose then awk 2>/dev/null &&
+		awk /usr/bin 'quoted text' ${HOME} $(pwd) printf
+$(pwd) sed -eu export done then printf done
+		x=1 local done test export 2>/dev/null | --verbose readonly then cd
+	${HOME} printf -eu -eu -eu
+	sed | /usr/bin local $(pwd) awk /usr/bin
+&& test sed printf awk printf 'quoted text'
+--verbose 2>/dev/null done grep awk --verbose ${HOME} "$1" echo
+		$(pwd) cd done readonly export echo
+		sed 'quoted text' export export readonly sed readonly readonly local /usr/bin readonly
+		-eu --verbose "$@" sed "$1"
+local x=1 awk --verbose -eu readonly cd && x=1 $(pwd) cd $(pwd) then
+x=1 "$1" printf 'quoted text' 2>/dev/null
+$(pwd) $(pwd) export test echo export 2>/dev/null export grep "$1" -eu local 'quoted text'
+		cd awk echo then && /usr/bin echo "$@" export "$@" echo done readonly
+		--verbose $(pwd) sed "$@" sed "$@" test readonly then printf then readonly
+		printf test "$@" --verbose sed $(pwd) 'quoted text'
+	test 'quoted text' then export x=1 echo /usr/bin /usr/bin then cd
+		echo test 'quoted text' test then export && done 2>/dev/null then cd x=1
+		$(pwd) readonly done 2>/dev/null echo export
+		-eu done echo then local $(pwd)
+		grep readonly sed export awk $(pwd) && done grep && echo done readonly | x=1 sed
+--verbose /usr/bin local "$@" x=1
+		readonly sed 2>/dev/null x=1 "$1" awk --verbose 'quoted text'
+	grep "$1" readonly | --verbose grep
+cd $(pwd) printf /usr/bin
+grep printf --verbose 2>/dev/null
+	/usr/bin export "$@" export "$1" 2>/dev/null
+-eu 2>/dev/null done /usr/bin --verbose -eu sed
+test --verbose test echo grep printf /usr/bin cd local cd sed cd cd --verbose
+		${HOME} cd test test local ${HOME} grep && local
+-eu readonly 2>/dev/null x=1 then --verbose grep
+done x=1 then done local local "$@" --verbose done printf export | sed
+"$@" cd export /usr/bin readonly /usr/bin | cd sed --verbose
+		local grep 2>/dev/null ${HOME} ${HOME} 2>/dev/null awk | done 'quoted text' grep
+		export export echo printf | 2>/dev/null
+	sed "$@" readonly ${HOME} 'quoted text' echo | grep cd
+	"$@" awk 2>/dev/null awk cd printf 2>/dev/null /usr/bin 2>/dev/null
+		/usr/bin 2>/dev/null "$@" grep local
+	local test x=1 --verbose readonly ${HOME}
+cd x=1 --verbose then echo
+	test awk awk test sed "$1" grep test 2>/dev/null
+		sed && $(pwd) sed done sed ${HOME}
+-eu test $(pwd) | test 2>/dev/null 'quoted text'
+	&& echo grep grep "$@" ${HOME} cd
+--verbose "$1" awk cd 2>/dev/null --verbose
+	awk local local | readonly local export "$1" -eu
+	-eu /usr/bin awk echo local $(pwd) "$@" readonly echo grep
+&& export /usr/bin "$@" "$@" $(pwd) export awk
+	export 2>/dev/null 'quoted text'
+		readonly 'quoted text' echo
+		x=1 x=1 | -eu 2>/dev/null local /usr/bin $(pwd) | grep readonly then "$@" grep
+		then printf | "$1" cd x=1 | 2>/dev/null ${HOME} -eu sed
+		x=1 $(pwd) local x=1 then then grep export
+	export then readonly sed 'quoted text' test done then printf 'quoted text'
+		-eu x=1 export cd --verbose /usr/bin $(pwd) cd 2>/dev/null
+		readonly awk 'quoted text' && cd local $(pwd) test ${HOME}
+		'quoted text' /usr/bin --verbose then /usr/bin then awk
+		printf && printf awk x=1
+| ${HOME} grep 'quoted text' "$@" export x=1 local local x=1 sed x=1 cd local
+"$@" printf sed local test grep 'quoted text' readonly -eu sed 'quoted text' echo
+/usr/bin cd sed export readonly "$1" test printf done x=1
+	readonly export 'quoted text' test | sed export done sed then
+	readonly | then printf "$1" export ${HOME} -eu printf ${HOME} 2>/dev/null
+/usr/bin | readonly && x=1 --verbose then /usr/bin printf
+printf "$@" test 2>/dev/null -eu /usr/bin
+readonly readonly /usr/bin
+	sed "$1" export then | readonly /usr/bin x=1 $(pwd) grep "$1"
+		--verbose ${HOME} | ${HOME} 'quoted text' | ${HOME} ${HOME} grep awk x=1 x=1 test
+| cd ${HOME} ${HOME} "$@" --verbose export x=1 -eu 'quoted text'
+"$@" 2>/dev/null test 'quoted text' x=1
+2>/dev/null grep local done -eu && test echo | local grep | | | --verbose ${HOME}
+awk 2>/dev/null local | cd then | printf test && printf
+"$@" ${HOME} cd then x=1 printf ${HOME} cd done 'quoted text' printf
+sed -eu "$@" echo "$@" x=1 "$1" printf cd $(pwd) --verbose $(pwd) x=1 export cd
+	printf | ${HOME} $(pwd) echo
+	--verbose test | "$1" "$1" sed
+	test then "$1" sed then "$1" then ${HOME} cd sed
+		"$@" export done -eu -eu "$@" x=1
+then "$@" $(pwd) then && --verbose $(pwd) readonly x=1 done grep awk
+x=1 local awk --verbose echo 'quoted text' awk echo cd "$1" && 2>/dev/null
+		done | echo done test awk export
+&& printf 2>/dev/null
+		then readonly test test
+	/usr/bin local export awk done grep
+		printf test 'quoted text' 2>/dev/null && 2>/dev/null "$@" sed
+$(pwd) 2>/dev/null /usr/bin
+	echo && && test readonly x=1 echo local awk echo /usr/bin --verbose x=1 /usr/bin
+	'quoted text' awk export "$1" grep local "$1" echo then && "$@" 'quoted text'
+local | x=1 readonly grep cd cd --verbose test -eu readonly export
+		local && awk 'quoted text' $(pwd) then
+2>/dev/null awk ${HOME} local x=1 x=1 export --verbose ${HOME}
+		cd | local awk && 2>/dev/null then
+		${HOME} x=1 "$1" --verbose
+	done done --verbose done
+	printf echo readonly then --verbose awk cd x=1 "$1"
+	| printf 'quoted text' local
+	2>/dev/null 'quoted text' "$1" echo -eu
+sed awk && sed -eu x=1 grep done echo printf sed printf
+	"$1" cd "$@" "$1" "$1"
+	readonly local then /usr/bin echo |
+awk -eu cd done cd printf /usr/bin
+grep printf readonly /usr/bin export 'quoted text' /usr/bin
+		done 'quoted text' echo "$@"
+export 2>/dev/null awk --verbose echo local grep local -eu grep printf sed --verbose
+	readonly then cd local "$1" done done export awk $(pwd) export --verbose
+		| cd cd 2>/dev/null grep 2>/dev/null then local | awk test done local "$@" -eu
+	export --verbose && done --verbose
+		readonly cd "$1" readonly grep -eu
+	printf ${HOME} printf --verbose
+		test cd export | 2>/dev/null
+export | 2>/dev/null 'quoted text' -eu /usr/bin "$@" /usr/bin x=1 2>/dev/null
+	${HOME} test grep test test
+		--verbose /usr/bin test printf "$1" sed echo cd done
+		sed cd done export readonly && | 'quoted text' cd printf
+		sed test /usr/bin -eu $(pwd) awk echo echo
+		"$@" sed | readonly local
+		--verbose test -eu done 'quoted text'
+	awk cd readonly | /usr/bin cd cd && sed ${HOME}
+	export "$@" cd "$@" local "$@" "$@" grep awk
+		x=1 awk awk cd /usr/bin | echo
+	local && grep --verbose 'quoted text' "$1" && x=1 grep | ${HOME}
+		| printf then ${HOME} $(pwd) /usr/bin $(pwd) sed --verbose
+	x=1 /usr/bin printf sed
+test readonly /usr/bin --verbose 2>/dev/null printf done then test &&
+	"$1" grep cd | done echo test | printf 2>/dev/null done -eu
+then "$@" export | sed
+${HOME} "$1" /usr/bin local readonly /usr/bin
+	| printf echo local 2>/dev/null
+awk awk grep /usr/bin $(pwd) printf echo local
+readonly $(pwd) test "$@" x=1 --verbose
+$(pwd) "$@" grep ${HOME} cd echo done x=1 export
+echo && local then && grep awk
+then --verbose 2>/dev/null $(pwd) /usr/bin 'quoted text'
+	cd grep then awk then -eu $(pwd) 'quoted text' /usr/bin printf x=1 | readonly
+		echo x=1 awk /usr/bin printf echo && /usr/bin awk --verbose $(pwd)
+local sed $(pwd) local --verbose
+	test "$1" readonly export done -eu printf && echo
+	cd done export done ${HOME} && | ${HOME} cd 2>/dev/null
+	export awk /usr/bin 'quoted text' -eu /usr/bin
+--verbose 2>/dev/null -eu /usr/bin /usr/bin echo done
+		-eu export done grep -eu done test --verbose |
+	test local | 'quoted text' cd x=1 "$1" local printf $(pwd) 2>/dev/null -eu
+/usr/bin && cd /usr/bin test echo ${HOME} printf --verbose 2>/dev/null && export
+local grep | -eu /usr/bin done done local "$1" && -eu 'quoted text'
+printf x=1 ${HOME} | echo export
+		local done awk test done && test
+	/usr/bin | ${HOME} 'quoted text' 2>/dev/null ${HOME} test done cd then local ${HOME}
+&& grep echo /usr/bin x=1 test printf
+readonly /usr/bin -eu then 2>/dev/null test awk sed cd sed awk 'quoted text' echo
+	"$@" awk "$@" echo x=1 then
+	then test --verbose /usr/bin cd x=1 local readonly "$@"
+	done done export x=1 --verbose | cd /usr/bin echo sed done "$1" export cd
+		"$@" x=1 "$@" ${HOME} --verbose
+	sed $(pwd) --verbose grep done /usr/bin
+echo "$@" awk sed awk then $(pwd) /usr/bin -eu "$@" "$@" test
+${HOME} awk readonly export
+readonly --verbose x=1 awk grep cd /usr/bin grep "$@" 'quoted text'
+	x=1 sed 2>/dev/null x=1 $(pwd)
+awk printf grep | ${HOME} readonly test done printf done awk
+	${HOME} cd -eu then test
+	x=1 ${HOME} done $(pwd) sed test
+		/usr/bin /usr/bin --verbose export test 2>/dev/null
+	awk "$@" readonly grep -eu && $(pwd)
+		printf x=1 /usr/bin "$1" echo sed 'quoted text' --verbose export ${HOME} && /usr/bin
+grep "$1" "$1" sed sed echo "$@" local
+		'quoted text' then printf local then "$@" readonly /usr/bin readonly cd echo
+	test printf test export printf /usr/bin export
+"$1" ${HOME} "$1" /usr/bin test | x=1 test
+	printf test local awk $(pwd) then && x=1 2>/dev/null
+	"$1" | 2>/dev/null $(pwd) | -eu /usr/bin --verbose x=1 cd --verbose
+	cd x=1 | -eu x=1 $(pwd) --verbose "$1" local
+	grep /usr/bin ${HOME} && awk awk printf "$@" "$1" done ${HOME} then
+awk x=1 done x=1 grep 2>/dev/null then readonly 2>/dev/null awk | printf
+		/usr/bin grep && ${HOME} echo | x=1 x=1
+"$1" readonly export then 2>/dev/null 2>/dev/null "$@" | test printf awk export
+	sed | --verbose ${HOME} /usr/bin then grep
+export && /usr/bin cd echo
+readonly sed cd export cd then local
+sed 'quoted text' "$1" sed printf /usr/bin
+		x=1 export readonly && export x=1 --verbose local $(pwd) echo cd printf printf
+	2>/dev/null local x=1 -eu done sed then done -eu /usr/bin
+	--verbose 2>/dev/null --verbose test 2>/dev/null sed
+x=1 readonly grep grep
+"$@" local done printf && "$@" 'quoted text' cd
+	grep readonly x=1 "$@" -eu grep && x=1 cd "$1" && awk
+${HOME} | export 'quoted text' ${HOME} echo done
+	x=1 cd "$1" ${HOME} --verbose echo "$1" --verbose done ${HOME} readonly | $(pwd)
+	printf sed export sed readonly
+export printf x=1 --verbose cd $(pwd) x=1 --verbose ${HOME} x=1 'quoted text'
+	printf printf 2>/dev/null
+'quoted text' echo done && export -eu local ${HOME} test sed
+		&& 'quoted text' local sed "$@" test -eu /usr/bin cd grep ${HOME}
+/usr/bin "$1" sed echo -eu done awk /usr/bin ${HOME} -eu "$1" then "$@"
+| done export x=1 -eu ${HOME} done -eu then 2>/dev/null then && $(pwd) export "$1"
+	"$1" | done grep --verbose | test test x=1 -eu 2>/dev/null test sed -eu test
+	cd cd awk 2>/dev/null 'quoted text' | printf "$1"
+	/usr/bin $(pwd) "$@" --verbose "$1" test 2>/dev/null awk export
+		awk readonly "$@" x=1 2>/dev/null --verbose -eu done awk x=1 | && "$@" $(pwd)
+sed x=1 printf 'quoted text' cd printf x=1 --verbose local export /usr/bin
+	${HOME} && && readonly
+		echo -eu readonly $(pwd) sed printf readonly
+x=1 ${HOME} | /usr/bin awk 'quoted text' 2>/dev/null local local
+		"$@" x=1 export -eu printf
+		"$1" --verbose | 2>/dev/null local
+2>/dev/null 'quoted text' | -eu grep grep sed && export readonly sed done
+		"$1" /usr/bin "$1" awk awk export | readonly grep /usr/bin cd sed awk
+'quoted text' export ${HOME}
+		/usr/bin $(pwd) test $(pwd) sed x=1 && done sed 2>/dev/null
+	test then export grep test echo "$1" test --verbose
+2>/dev/null x=1 /usr/bin readonly /usr/bin cd ${HOME}
+		export sed && export $(pwd) 2>/dev/null --verbose done cd
+		'quoted text' then then | local ${HOME} sed readonly -eu $(pwd) -eu export
+		/usr/bin | local /usr/bin && grep $(pwd) readonly
+	then done 2>/dev/null test /usr/bin cd 'quoted text' printf /usr/bin test
+readonly -eu "$@" | done --verbose ${HOME} -eu /usr/bin -eu then /usr/bin ${HOME}
+	"$1" $(pwd) x=1 readonly 2>/dev/null && grep local done /usr/bin &&
+		"$1" then sed ${HOME} 'quoted text' cd x=1 && "$1"
+		cd awk grep -eu $(pwd) -eu "$1" | "$@" /usr/bin 'quoted text' "$1" awk /usr/bin
+printf ${HOME} -eu && "$1" printf
+cd grep && ${HOME} 2>/dev/null
+done readonly then readonly
+	-eu done --verbose && then -eu export grep
+	printf | test && readonly awk
+	2>/dev/null readonly && test |
+	/usr/bin done grep &&
+	/usr/bin "$@" "$1" readonly && /usr/bin 'quoted text' x=1 awk
+	then && cd printf export | "$1" echo awk 2>/dev/null
+--verbose -eu test awk local -eu awk ${HOME} done | 'quoted text'
+"$1" "$1" echo readonly then /usr/bin then && /usr/bin then printf printf
+		2>/dev/null sed -eu readonly echo $(pwd)
+		&& --verbose export -eu $(pwd) then $(pwd)
+echo local ${HOME} --verbose test $(pwd)
+	then awk printf grep export local -eu grep
+	done echo local "$@" cd --verbose
+		'quoted text' x=1 printf
+	&& | readonly local /usr/bin then local sed printf x=1 done 'quoted text'
+cd printf readonly done "$@" --verbose /usr/bin
+		test export -eu grep printf then /usr/bin test
+		awk $(pwd) /usr/bin readonly | then echo x=1
+2>/dev/null -eu x=1 done 'quoted text' done test then && $(pwd) printf
+	-eu cd "$@" --verbose local cd 'quoted text'
+	| && -eu awk 2>/dev/null done done ${HOME} /usr/bin cd cd echo
+	awk /usr/bin 'quoted text'
+	-eu then $(pwd) ${HOME} 2>/dev/null cd cd done sed
+echo local /usr/bin echo
+test local $(pwd) ${HOME}
+2>/dev/null printf local
+	| then done -eu done | readonly
+	test readonly readonly --verbose x=1 2>/dev/null echo test 'quoted text'
+	cd sed "$@" && export "$@" done test
+		${HOME} 'quoted text' --verbose x=1 x=1 /usr/bin echo printf 2>/dev/null
+		export && -eu ${HOME} readonly
+echo local 2>/dev/null 'quoted text' $(pwd) /usr/bin $(pwd)
+		&& ${HOME} cd readonly then
+	cd echo -eu sed x=1 | | 2>/dev/null
+		then sed "$1" test export -eu awk sed cd then $(pwd) && export /usr/bin
+	awk "$@" readonly done "$1" | -eu && sed echo
+2>/dev/null | $(pwd) test awk -eu export /usr/bin /usr/bin -eu /usr/bin sed
+		'quoted text' then && printf
+test -eu /usr/bin then done cd then readonly
+readonly x=1 -eu awk ${HOME}
+	-eu local sed x=1 | cd sed && done
+	local --verbose ${HOME} test
+	test 'quoted text' local local local 'quoted text' cd "$@" then
+	$(pwd) && grep $(pwd) "$1" readonly
+	$(pwd) cd ${HOME} test local cd --verbose done && "$@" | && awk 'quoted text'
+		cd $(pwd) -eu done $(pwd) x=1 'quoted text'
+then echo | cd /usr/bin 'quoted text' x=1 done done local export printf
+	"$1" printf local awk readonly "$@" /usr/bin x=1 awk awk
+		test --verbose test readonly readonly 2>/dev/null
+	sed printf x=1 sed "$1" test "$1" awk sed export echo /usr/bin
+x=1 export sed echo grep
+${HOME} -eu cd 2>/dev/null awk | --verbose export test printf && 2>/dev/null
+		-eu sed $(pwd) && test $(pwd)
+	&& test grep then echo 'quoted text'
+	&& test readonly test then done readonly | then ${HOME} -eu
+	${HOME} test "$@" local export "$@" test readonly "$@" awk test local
+	then export --verbose x=1 test "$1" "$@" $(pwd) "$@" readonly "$@" sed grep | echo
+${HOME} awk sed "$@" x=1 cd ${HOME} echo "$1" cd readonly
+	readonly test awk local readonly export x=1 | -eu
+	$(pwd) "$@" ${HOME} sed "$@" grep test cd && | 2>/dev/null ${HOME}
+then echo 2>/dev/null $(pwd) && local -eu printf readonly printf 'quoted text'
+cd sed readonly export
+'quoted text' grep /usr/bin 2>/dev/null "$1" printf echo done local 2>/dev/null
+&& export $(pwd) /usr/bin local -eu -eu test then
+		done $(pwd) -eu printf export x=1 'quoted text' "$1" grep
+awk x=1 sed done then | 'quoted text' "$1" "$@" /usr/bin /usr/bin $(pwd) | x=1
+readonly 'quoted text' then 'quoted text'
+then export $(pwd) grep ${HOME} export cd -eu | --verbose 'quoted text' awk
+		local test x=1 x=1 2>/dev/null
+awk sed done then && cd /usr/bin 'quoted text' && ${HOME}
+then "$1" local --verbose ${HOME} --verbose test test
+		printf local && echo --verbose 2>/dev/null "$@" "$1" "$@"
+	grep done "$@" && echo -eu export export "$@" x=1
+${HOME} x=1 -eu printf && "$@" x=1 'quoted text'
+	| --verbose sed x=1 sed printf | $(pwd) -eu x=1 ${HOME} echo x=1 local done
+test export cd sed grep "$@" --verbose test sed grep "$@"
+local /usr/bin grep --verbose "$1"
+$(pwd) cd then test grep && test done && /usr/bin
+	--verbose -eu ${HOME} 2>/dev/null
+	awk 'quoted text' done test 2>/dev/null 'quoted text' export readonly 2>/dev/null
+		cd /usr/bin x=1 then then
+export export -eu sed | $(pwd) "$@" done sed | then "$@" printf
+	2>/dev/null "$1" echo cd export && export local -eu -eu echo cd
+	grep ${HOME} -eu export -eu $(pwd) readonly
+		then "$@" cd cd test cd sed export
+		| then done -eu ${HOME} | awk 2>/dev/null ${HOME} $(pwd)
+$(pwd) then ${HOME} readonly then 'quoted text' /usr/bin && "$@" cd && ${HOME}
+${HOME} ${HOME} | "$1" "$1" 2>/dev/null /usr/bin
+	cd sed --verbose cd then 'quoted text' "$1" export | readonly
+		readonly $(pwd) "$1" local 2>/dev/null awk printf
+	"$@" "$@" test x=1 export echo ${HOME} "$1" sed
+	&& 'quoted text' local
+	readonly 'quoted text' export
+		&& cd x=1 printf | x=1 2>/dev/null -eu grep sed
+		-eu | ${HOME} 'quoted text' ${HOME}
+		2>/dev/null x=1 | local "$@" grep "$1" done
+		then 2>/dev/null cd $(pwd) x=1 "$@" 'quoted text' local cd "$1" test
+	-eu done local | 2>/dev/null local && echo local grep export grep
+		then then sed 2>/dev/null printf 2>/dev/null awk
+	then ${HOME} test $(pwd) "$@" --verbose 2>/dev/null grep
+		--verbose printf done --verbose test grep 'quoted text' "$@" awk && -eu awk "$1"
+		then ${HOME} "$@" x=1 awk -eu readonly grep "$1" x=1 awk done sed test -eu cd
+		| sed cd /usr/bin | /usr/bin "$1" ${HOME} | 2>/dev/null "$@" 'quoted text' done
+2>/dev/null -eu awk "$@" -eu ${HOME} "$1" echo 'quoted text' sed awk
+done local && -eu /usr/bin printf /usr/bin printf ${HOME} echo
+		"$@" "$@" printf test sed awk /usr/bin "$@" /usr/bin
+test cd sed grep cd "$1" printf cd x=1 --verbose 'quoted text' sed
+		2>/dev/null then $(pwd) && |
+	test awk 'quoted text' sed readonly done
+	echo $(pwd) local printf "$@" sed x=1 local grep 2>/dev/null x=1 grep
+readonly && local | /usr/bin grep awk grep awk local sed readonly -eu readonly
+	${HOME} && then $(pwd) | $(pwd) | --verbose test "$1" printf -eu "$1" x=1 awk
+done grep $(pwd) echo sed --verbose echo cd -eu "$@" 2>/dev/null readonly sed
+		${HOME} awk 2>/dev/null export
+2>/dev/null /usr/bin ${HOME} cd | $(pwd)
+	/usr/bin local then printf done export ${HOME} | done ${HOME} -eu echo export
+		/usr/bin sed readonly cd ${HOME} "$1" local x=1 $(pwd) cd export echo test export
+cd --verbose | grep export "$1" echo -eu test ${HOME} --verbose | then
+'quoted text' cd readonly local ${HOME} 'quoted text' && -eu -eu done grep
+		readonly done done readonly --verbose -eu --verbose echo grep printf 2>/dev/null
+	test readonly --verbose | export /usr/bin cd /usr/bin $(pwd) echo
+		"$@" /usr/bin done x=1 then
+		printf "$@" readonly /usr/bin 2>/dev/null "$@" printf 'quoted text'
+		$(pwd) 'quoted text' $(pwd) && 2>/dev/null "$1" then awk awk local printf
+	${HOME} --verbose /usr/bin "$1" done ${HOME} readonly --verbose
+"$@" awk | x=1 readonly 'quoted text' then 2>/dev/null local |
+	${HOME} x=1 test | grep done --verbose ${HOME} readonly --verbose --verbose readonly
+done grep test grep -eu "$@" readonly
+	sed then readonly echo awk sed 'quoted text' readonly export | then "$@" /usr/bin
+		export echo cd printf local export awk /usr/bin $(pwd) test --verbose /usr/bin
+	'quoted text' echo 'quoted text' -eu done && awk awk cd
+		awk "$1" $(pwd) test "$@" --verbose -eu 'quoted text' "$1" ${HOME}
+'quoted text' 'quoted text'
+		2>/dev/null -eu sed 'quoted text'
+		export readonly -eu then then "$1" sed "$1" printf test
+		-eu | done then awk awk awk then export -eu x=1 echo --verbose
+	$(pwd) sed readonly test "$1" test echo
+	"$@" local 'quoted text' -eu
+local 'quoted text' ${HOME} --verbose ${HOME} local sed
+		2>/dev/null cd x=1 && local "$1" local 2>/dev/null -eu &&
+	done awk "$1" grep 2>/dev/null $(pwd) "$1" --verbose then awk
+	-eu -eu "$1" local awk $(pwd) export grep && printf /usr/bin
+		echo 2>/dev/null cd sed awk "$@" /usr/bin && 'quoted text' export x=1 $(pwd)
+done "$1" /usr/bin echo grep --verbose export | export
+	awk 'quoted text' "$@" echo && 2>/dev/null
+	| then ${HOME} cd "$@" test -eu | 'quoted text' done done /usr/bin
+	echo grep x=1 cd readonly
+	| test ${HOME} --verbose --verbose sed x=1 readonly
+		/usr/bin awk --verbose "$@" readonly "$1" cd awk
+		grep awk then ${HOME} awk awk readonly then -eu x=1 local 'quoted text'
+		-eu test grep cd grep $(pwd) /usr/bin --verbose "$@" awk "$1" echo
+		readonly readonly && x=1 | "$1"
+		then && awk && /usr/bin grep "$1" -eu grep 'quoted text'
+		/usr/bin cd cd --verbose done then && test grep done done echo
+		grep printf done --verbose 'quoted text' "$1"
+${HOME} ${HOME} awk 'quoted text'
+		--verbose echo export test done
+	"$@" "$@" then sed export "$1" | cd printf ${HOME} echo done sed x=1 --verbose
+	'quoted text' local 'quoted text' then readonly /usr/bin
+	2>/dev/null -eu --verbose 'quoted text' cd | ${HOME}
+/usr/bin 'quoted text' 'quoted text' "$1" 2>/dev/null "$1" 'quoted text'
+	$(pwd) | echo echo awk x=1 'quoted text' x=1 cd ${HOME} then local
+grep export && cd 2>/dev/null awk -eu
+		grep done --verbose &&
+		${HOME} x=1 export sed $(pwd) then local "$@" echo sed $(pwd) test
+done --verbose cd --verbose then -eu printf grep
+		2>/dev/null 'quoted text' /usr/bin done
+-eu 'quoted text' done x=1 grep x=1 x=1 "$@"
+	export && -eu printf cd --verbose 'quoted text' cd | done
+	local readonly readonly 'quoted text' x=1 && export sed --verbose
+-eu sed ${HOME} export $(pwd) ${HOME} /usr/bin cd && sed
+	${HOME} grep "$1" done test cd | grep && 2>/dev/null
+		| export sed 2>/dev/null /usr/bin then 'quoted text' | done /usr/bin $(pwd)
+	done ${HOME} then then "$@" --verbose test ${HOME}
+&& 'quoted text' && | x=1 -eu "$1" 2>/dev/null
+		cd --verbose 2>/dev/null cd echo "$1" /usr/bin test
+		echo -eu ${HOME} && done && awk local readonly
+		/usr/bin done readonly printf
+		echo printf $(pwd) ${HOME} then grep 2>/dev/null
+		printf | local $(pwd) export echo 'quoted text'
+	awk x=1 export cd echo "$1" test readonly -eu readonly export $(pwd)
+	| --verbose 'quoted text' "$@" 2>/dev/null
+		-eu printf ${HOME} && | test
+		cd then "$@" awk --verbose -eu echo ${HOME} test && /usr/bin x=1 2>/dev/null
+x=1 --verbose readonly printf local done echo local "$1" /usr/bin -eu /usr/bin
+	then x=1 -eu x=1 readonly echo "$1"
+		--verbose $(pwd) then | &&
+"$@" awk awk cd then $(pwd) awk $(pwd) | printf then
+$(pwd) $(pwd) grep grep --verbose ${HOME} printf echo "$@" 'quoted text' awk
+		--verbose "$1" 'quoted text' "$@" readonly --verbose
+		echo then readonly | && awk | | 2>/dev/null awk x=1 readonly /usr/bin
+	-eu done readonly echo test "$1" x=1 x=1 | cd ${HOME} readonly
+		"$@" "$@" 2>/dev/null 2>/dev/null -eu done local --verbose
+	readonly "$1" --verbose /usr/bin awk 2>/dev/null
+		grep $(pwd) grep --verbose /usr/bin x=1 'quoted text' 2>/dev/null &&
+cd -eu sed $(pwd) x=1 readonly local then done printf
+		"$1" /usr/bin 'quoted text' /usr/bin &&
+		awk "$1" 'quoted text' readonly grep "$1" echo printf grep then export
+	--verbose echo | sed export 'quoted text' grep "$1" then done then 'quoted text'
+		${HOME} | "$@" sed test 'quoted text' 2>/dev/null
+		$(pwd) 2>/dev/null cd cd awk sed export echo "$1" 2>/dev/null /usr/bin "$1" x=1
+--verbose awk --verbose
+		sed 'quoted text' done printf sed
+	${HOME} 'quoted text' /usr/bin sed local ${HOME}
+sed then readonly done cd | /usr/bin
+		--verbose "$1" readonly readonly
+	| 2>/dev/null echo -eu 2>/dev/null awk echo | $(pwd) then cd sed local
+printf awk then local grep cd -eu export && | awk sed echo -eu ${HOME}
+	then 'quoted text' cd x=1 printf export export /usr/bin && cd && | /usr/bin readonly
+		2>/dev/null sed --verbose local ${HOME} readonly $(pwd) readonly |
+	export export "$1" done 2>/dev/null echo
+		local "$1" 2>/dev/null x=1
+	'quoted text' grep cd grep export | echo $(pwd) 'quoted text'
+	"$1" echo $(pwd) 2>/dev/null "$@" "$1" 2>/dev/null test
+"$@" 'quoted text' sed "$@"
+"$@" -eu test printf ${HOME} grep echo "$@" | awk -eu local awk "$@" &&
+local grep 2>/dev/null export
+	"$1" grep test /usr/bin --verbose
+		&& $(pwd) && echo cd printf then export done -eu awk ${HOME} then
+&& | cd readonly -eu --verbose $(pwd) $(pwd) cd --verbose | | --verbose
+	printf grep --verbose then echo
+		awk readonly export test x=1 printf
+	test x=1 test echo -eu -eu && ${HOME} "$1"
+		done awk "$@" awk "$@" then done
+		--verbose -eu 'quoted text' -eu | --verbose printf then export test printf
+		"$@" done printf 'quoted text' export cd 'quoted text'
+		${HOME} test 2>/dev/null echo /usr/bin
+	then test then cd then $(pwd) echo | "$@"
+| then "$1" grep && export printf readonly | grep awk test -eu export x=1 | --verbose
+		"$@" --verbose 'quoted text' "$@" local $(pwd)
+	/usr/bin "$1" printf "$@"
+local local "$@" awk awk "$1" ${HOME}
+		"$1" done | done 'quoted text' then
+	local export grep --verbose 2>/dev/null x=1 && sed $(pwd) done export
+	export local test -eu awk x=1 export && test grep 'quoted text' local
+	grep grep then "$1" "$1" 'quoted text' /usr/bin --verbose
+-eu echo "$1" /usr/bin then 2>/dev/null 2>/dev/null export |
+		x=1 readonly --verbose grep test --verbose 2>/dev/null awk echo && | test printf
+-eu ${HOME} -eu | "$@"
+		| 2>/dev/null ${HOME} $(pwd) cd x=1 local && grep
+&& done readonly $(pwd) then
+printf awk ${HOME} | --verbose
+		&& | sed | done awk x=1 2>/dev/null grep "$1" "$1"
+	printf && $(pwd) readonly "$1" done awk sed echo test | $(pwd)
+	--verbose printf export awk grep /usr/bin echo export /usr/bin /usr/bin cd
+	&& $(pwd) done awk && | /usr/bin
+	'quoted text' "$1" 'quoted text' export
+		$(pwd) cd 2>/dev/null "$1" printf && sed
+cd 'quoted text' sed printf test
+done local "$1" 'quoted text' --verbose export done readonly && "$@"
+	printf cd sed /usr/bin done printf export -eu export && printf local 2>/dev/null
+sed --verbose | && readonly
+		$(pwd) | ${HOME} $(pwd) "$@" 2>/dev/null
+readonly ${HOME} test $(pwd)
+local awk | --verbose sed cd readonly
+		then /usr/bin test x=1 -eu then awk local /usr/bin
+${HOME} $(pwd) $(pwd) sed printf then sed echo | "$@" "$1" cd
+test -eu "$@" local readonly 2>/dev/null then && -eu 2>/dev/null
+		sed 'quoted text' $(pwd) printf ${HOME}
+		&& ${HOME} readonly /usr/bin
+		cd echo printf x=1 | awk readonly "$1" 'quoted text' export 2>/dev/null
+"$@" x=1 $(pwd) echo | printf done printf "$1" done local local local "$1"
+		"$@" awk printf test readonly echo x=1 sed cd 2>/dev/null x=1
+		2>/dev/null awk grep printf "$1" then cd
+		local 2>/dev/null done "$1" "$@"
+		echo "$1" ${HOME} x=1 sed 2>/dev/null /usr/bin
+printf && ${HOME} grep 2>/dev/null then "$1" 'quoted text' then "$@"
+		'quoted text' cd x=1 "$1" /usr/bin ${HOME} echo readonly $(pwd) /usr/bin --verbose
+done --verbose x=1 sed echo test then -eu x=1 $(pwd)
+cd export cd "$1" grep sed -eu "$1" --verbose x=1 "$1" 2>/dev/null -eu printf
+	--verbose done x=1 echo awk local 2>/dev/null $(pwd) sed -eu && "$1" cd $(pwd)
+	grep done "$1" "$1" 'quoted text' done then printf sed then local then "$@"
+	'quoted text' sed export sed readonly x=1 export -eu export echo done
+2>/dev/null awk 'quoted text' done --verbose /usr/bin
+done test -eu grep $(pwd) x=1 "$1" x=1 printf grep "$@" ${HOME}
+		echo $(pwd) ${HOME} readonly 2>/dev/null
+		readonly export test readonly
+	readonly | 'quoted text' $(pwd) test printf
+		grep 'quoted text' export && printf && ${HOME} export
+		then ${HOME} ${HOME} echo | --verbose readonly done 2>/dev/null
+sed test x=1 awk echo 'quoted text' done
+		sed | echo $(pwd) | readonly -eu 2>/dev/null x=1
+export && ${HOME} printf local x=1 done echo -eu local ${HOME} awk
+		done $(pwd) printf ${HOME}
+cd | && | readonly awk echo
+	test local 'quoted text' then && x=1 | "$@" "$1" echo 2>/dev/null then
+	sed echo awk cd test "$@" echo x=1 done grep grep ${HOME}
+$(pwd) /usr/bin && cd /usr/bin done then grep 'quoted text' sed readonly
+--verbose && then awk 'quoted text'
+grep readonly cd cd then 2>/dev/null x=1 sed echo printf $(pwd) 2>/dev/null
+		"$@" cd x=1 'quoted text' grep
+		| "$1" "$1" /usr/bin awk $(pwd) && 'quoted text' x=1 test test "$@" ${HOME}
+	| --verbose export local "$@" grep --verbose
+		then cd | echo local -eu ${HOME} | ${HOME} echo | 'quoted text' echo |
+printf local ${HOME} local ${HOME} 2>/dev/null
+		-eu cd test done readonly $(pwd)
+	x=1 $(pwd) cd test awk ${HOME} readonly $(pwd)
+		'quoted text' local export -eu x=1 "$@" ${HOME} "$@" grep "$1"
+awk "$@" done readonly echo done export
+	&& /usr/bin x=1 done export echo
+/usr/bin "$1" | sed cd ${HOME} readonly
+	local | sed $(pwd) awk | cd test done x=1
+	$(pwd) done --verbose -eu then
+		"$@" $(pwd) grep --verbose | "$1" echo "$@" 'quoted text' awk sed export export
+		$(pwd) && $(pwd) export done
+export x=1 sed grep test
+	$(pwd) "$1" --verbose readonly --verbose
+	| "$@" cd "$1" ${HOME} 2>/dev/null /usr/bin -eu local test --verbose --verbose
+awk $(pwd) printf sed 'quoted text' local sed export "$1"
+		then && 2>/dev/null -eu printf 2>/dev/null
+		awk -eu --verbose printf echo done --verbose
+	"$1" && done export cd grep
+	done && 2>/dev/null "$1"
+x=1 $(pwd) "$1" sed done -eu awk done readonly -eu test
+	sed -eu $(pwd) done awk --verbose cd export $(pwd) x=1 | 'quoted text'
+| /usr/bin test ${HOME} export then export x=1 /usr/bin "$@" "$@"
+sed sed ${HOME} echo readonly export | export test --verbose 'quoted text'
+| x=1 grep echo "$1" printf test /usr/bin --verbose local printf && --verbose
+	${HOME} 'quoted text' done "$1" x=1 printf -eu echo -eu
+done x=1 cd | 'quoted text' ${HOME} -eu /usr/bin grep
+"$1" awk $(pwd) x=1 ${HOME}
+| readonly "$1" "$1" /usr/bin awk
+		done done local test -eu "$1" done
+--verbose x=1 readonly cd -eu /usr/bin echo
+		local --verbose echo "$@" /usr/bin 2>/dev/null
+		local done 'quoted text'
+		grep cd 2>/dev/null && 2>/dev/null
+		sed --verbose 2>/dev/null readonly
+		done x=1 test 2>/dev/null | sed 2>/dev/null x=1 "$@" readonly
+	2>/dev/null awk then --verbose "$@" 2>/dev/null grep then && sed then
+		test && $(pwd) cd 2>/dev/null -eu echo echo grep
+		&& grep then test grep "$@"
+'quoted text' ${HOME}
+	$(pwd) 'quoted text' then readonly 'quoted text' $(pwd) cd local
+	printf -eu test done "$@" grep /usr/bin 'quoted text'
+		'quoted text' cd printf
+		"$@" | "$@" /usr/bin export
+		export cd 'quoted text' && 2>/dev/null 2>/dev/null
+		awk local awk ${HOME} cd echo && x=1 printf sed done sed -eu grep local readonly
+	grep echo then x=1 && cd sed awk "$1" echo export then
+		test 2>/dev/null printf $(pwd) cd then sed cd grep sed && test then $(pwd)
+"$@" --verbose $(pwd) cd x=1 $(pwd) 2>/dev/null
+		grep sed "$@" cd done echo 'quoted text' then -eu | -eu ${HOME} x=1
+printf "$1" $(pwd) -eu "$1" grep printf | awk printf $(pwd) && | local
+	"$1" local test -eu x=1 | export | sed grep export -eu test readonly sed "$1" -eu
+		cd echo | cd "$1" | /usr/bin --verbose 2>/dev/null x=1 echo &&
+	"$1" /usr/bin sed 2>/dev/null
+readonly "$@" printf /usr/bin "$1" printf then printf awk sed | sed
+| x=1 test $(pwd) | local printf test printf 2>/dev/null | done grep 2>/dev/null
+		grep echo 2>/dev/null local -eu "$@" then ${HOME}
+2>/dev/null && /usr/bin x=1 $(pwd) --verbose
+		export -eu "$1" x=1 grep sed export cd
+readonly export cd export readonly | local readonly
+2>/dev/null /usr/bin 2>/dev/null | sed readonly
+	-eu export | export test && --verbose 'quoted text' done 2>/dev/null 'quoted text'
+	readonly x=1 then /usr/bin export && "$1" grep export echo -eu && "$@" --verbose
+		/usr/bin awk printf then 'quoted text' -eu export sed && x=1 ${HOME} awk --verbose
+awk local export -eu done ${HOME} readonly grep x=1 local $(pwd)
+	printf local export sed && echo x=1 'quoted text' 2>/dev/null ${HOME} 'quoted text'
+		done --verbose 'quoted text' x=1 test 'quoted text' then
+		grep cd then sed -eu 2>/dev/null
+printf && /usr/bin done export /usr/bin
+cd "$@" echo --verbose then test "$@" 2>/dev/null
+	x=1 "$1" echo printf then ${HOME} done "$1" local export ${HOME} grep 'quoted text'
+readonly awk done 'quoted text' $(pwd) export done readonly
+	/usr/bin sed $(pwd) export 'quoted text' test sed
+	done local "$1" awk "$@" printf grep ${HOME} $(pwd) -eu
+'quoted text' /usr/bin cd grep | /usr/bin cd readonly
+'quoted text' && 2>/dev/null x=1 cd export | -eu "$1" echo grep --verbose
+"$1" $(pwd) "$@" /usr/bin
+sed test | "$1" | echo ${HOME} export
+		x=1 readonly $(pwd) test then cd 'quoted text'
+		x=1 "$1" local awk "$@" grep local cd
+	'quoted text' && 2>/dev/null printf /usr/bin $(pwd) && -eu
+	${HOME} export $(pwd)
+then "$1" x=1 | then 2>/dev/null x=1 awk 'quoted text' | --verbose
+		"$@" 'quoted text' test && && 'quoted text'
+	x=1 local "$@" grep x=1 cd sed
+		'quoted text' then local then grep export done test local -eu -eu -eu
+		readonly 'quoted text' then export readonly done && printf "$@" export
+$(pwd) echo echo grep test then echo -eu x=1 /usr/bin export /usr/bin
+	$(pwd) "$@" 2>/dev/null
+		echo $(pwd) --verbose "$1" then local 2>/dev/null
+	export sed grep done echo awk $(pwd) && then
+local $(pwd) cd ${HOME} readonly
+	done printf readonly /usr/bin | $(pwd) local then readonly done sed printf
+	done test --verbose test then $(pwd) -eu
+		| "$1" readonly ${HOME} test | readonly grep x=1 x=1 grep x=1 printf sed sed --verbose
+		export echo x=1 'quoted text' && 'quoted text' cd cd sed done && sed
+		--verbose /usr/bin --verbose -eu grep export ${HOME} "$@" ${HOME} --verbose
+cd awk 2>/dev/null then /usr/bin
+		| 2>/dev/null --verbose grep --verbose
+		"$1" /usr/bin sed local echo "$1"
+		'quoted text' --verbose cd readonly $(pwd) && --verbose -eu cd --verbose "$@"
+done local readonly --verbose && awk readonly export sed "$@" 2>/dev/null
+	echo "$@" && awk ${HOME} sed "$1" x=1 printf "$1" local
+		sed echo then && grep echo
+awk /usr/bin test printf "$1" "$1" grep sed /usr/bin $(pwd) test 'quoted text'
+readonly 2>/dev/null echo
+	--verbose local export 'quoted text' then
+		awk local awk && sed readonly
+	done 'quoted text' export x=1 grep
+echo readonly ${HOME} test -eu cd test awk -eu local local "$1" printf
+done grep sed 'quoted text' export test sed | 2>/dev/null &&
+	echo 'quoted text' local readonly
+		then -eu grep "$1" grep --verbose
+x=1 export local 2>/dev/null |
+x=1 && sed awk | "$1" 'quoted text' then -eu
+		export then sed "$1" done grep export
+readonly "$@" printf --verbose 'quoted text' ${HOME} echo $(pwd) cd local local
+		local | awk -eu --verbose awk "$@" awk | local x=1 --verbose local
+	awk -eu "$1" | printf -eu 'quoted text' ${HOME} echo "$1" -eu test /usr/bin
+local /usr/bin "$1" then cd sed sed 2>/dev/null export --verbose
+		/usr/bin cd test awk -eu readonly then
+readonly test awk $(pwd) echo --verbose printf x=1
+		/usr/bin printf "$@" -eu test sed local ${HOME} local local export then awk
+		awk && "$1" x=1 test "$1" 'quoted text' --verbose && awk 2>/dev/null
+		test cd cd ${HOME} local done sed sed |
+$(pwd) cd "$1" local x=1 done
+then /usr/bin done -eu 'quoted text' awk printf
+		x=1 export x=1 --verbose && 2>/dev/null then x=1 awk --verbose 'quoted text'
+		-eu ${HOME} "$@" "$@" echo "$@" readonly done | readonly 2>/dev/null awk echo printf
+cd then cd "$1" 2>/dev/null readonly done 2>/dev/null echo 'quoted text' -eu
+	${HOME} "$@" cd 2>/dev/null then sed local sed printf export done "$1" | awk
+echo $(pwd) --verbose 'quoted text' test "$1" 2>/dev/null done 2>/dev/null
+		"$1" /usr/bin awk x=1 readonly grep ${HOME} -eu grep done --verbose
+		local /usr/bin local /usr/bin $(pwd) | --verbose ${HOME} done /usr/bin
+printf then /usr/bin export echo | cd | | 2>/dev/null done test readonly
+	export echo printf grep 2>/dev/null echo -eu
+then --verbose sed readonly /usr/bin -eu && 'quoted text'
+	-eu "$1" test x=1 2>/dev/null ${HOME} then 'quoted text' awk --verbose
+		done 'quoted text' export test echo export /usr/bin -eu
+	test grep && done done /usr/bin x=1 "$@" | | -eu | then 'quoted text'
+	cd test printf awk | --verbose
+	cd $(pwd) $(pwd) export /usr/bin | readonly
+		readonly export export test -eu
+	test test --verbose sed 'quoted text' export local done /usr/bin --verbose local
+"$@" -eu ${HOME} sed "$1" x=1 cd "$@" then grep sed -eu export done 2>/dev/null
+| sed && | "$@" ${HOME} awk
+done && done done local export "$1" && 2>/dev/null test readonly | done --verbose
+		printf test 'quoted text' done
+	local x=1 done grep readonly awk "$@" $(pwd) "$@" grep "$1" "$1" "$@" --verbose
+		grep --verbose $(pwd) 'quoted text' grep done echo then echo grep --verbose
+	then sed 'quoted text' echo readonly echo
+	cd 'quoted text' ${HOME} "$@" grep | ${HOME} cd $(pwd) grep
+		'quoted text' readonly export
+awk -eu | 'quoted text' readonly
+	echo | printf then ${HOME}
+		--verbose test cd grep sed awk echo $(pwd) ${HOME} cd | echo awk "$@"
+		x=1 "$@" readonly ${HOME} export ${HOME}
+local ${HOME} && && grep grep x=1 readonly
+		2>/dev/null test readonly awk
+	2>/dev/null grep export "$@" x=1 local local done && | awk "$1" &&
+readonly $(pwd) readonly echo printf test --verbose
+	&& awk "$@" printf cd awk /usr/bin $(pwd) readonly ${HOME}
+local "$1" done export echo && readonly then grep readonly
+echo then cd readonly then /usr/bin 'quoted text' | -eu /usr/bin
+	readonly && --verbose grep | local | "$1" readonly cd cd sed | grep grep grep
+	"$@" done --verbose readonly awk /usr/bin x=1 --verbose export readonly
+&& && awk $(pwd) export 'quoted text' done local $(pwd)
+'quoted text' ${HOME} grep test awk --verbose local x=1 printf
+		/usr/bin export | "$@" readonly then export
+	cd "$1" | awk && 'quoted text'
+	$(pwd) ${HOME} ${HOME} cd local echo "$1" x=1 /usr/bin
+sed ${HOME} "$1" | echo awk sed grep | then && grep echo printf local -eu awk test
+		grep awk echo ${HOME} ${HOME} "$@" grep test --verbose x=1 cd grep
+		readonly /usr/bin $(pwd) echo export 2>/dev/null
+	local && $(pwd) -eu "$1" x=1 grep printf test "$@" | export --verbose | && $(pwd)
+	done x=1 && echo /usr/bin awk
+	x=1 then readonly "$@" readonly
+	"$@" awk --verbose -eu test export echo
+/usr/bin sed "$1" printf /usr/bin /usr/bin
+	-eu && ${HOME} cd | "$1" && local done x=1 grep
+then test export test x=1 test $(pwd) cd ${HOME} grep ${HOME} local 'quoted text'
+		then 'quoted text' x=1 "$1" local /usr/bin
+awk echo test export export sed test printf export ${HOME} /usr/bin readonly
+echo /usr/bin then awk "$@"
+echo grep sed $(pwd) then ${HOME} $(pwd) "$@" "$1" | x=1 cd "$1" test --verbose
+	&& | readonly grep test sed cd sed ${HOME} export printf x=1 --verbose
+	printf && local /usr/bin 2>/dev/null
+readonly -eu readonly local -eu && readonly
+sed 2>/dev/null sed echo 'quoted text' && "$@" /usr/bin readonly && readonly
+		"$@" grep printf sed done local
+		readonly readonly 'quoted text' test 'quoted text' echo "$@"
+	${HOME} cd /usr/bin test local 2>/dev/null
+		printf grep export 'quoted text' $(pwd) | awk printf
+	done grep -eu then sed | echo 2>/dev/null x=1 "$1" /usr/bin printf
+		"$@" printf echo 'quoted text' $(pwd) --verbose "$@" grep echo --verbose readonly
+		$(pwd) then 2>/dev/null 'quoted text' 'quoted text' 2>/dev/null
+	/usr/bin 2>/dev/null sed done
+&& printf sed x=1 echo readonly | x=1 'quoted text' then awk 'quoted text'
+	&& sed ${HOME} 2>/dev/null $(pwd) "$1" test done awk
+	2>/dev/null "$1" local x=1 cd && | awk -eu -eu -eu awk export
+echo done echo && cd cd
+'quoted text' echo x=1 printf "$@" then export $(pwd)
+		test $(pwd) && readonly then | readonly echo done sed
+grep sed test grep && 'quoted text' cd readonly awk "$@" then readonly
+echo then sed $(pwd) $(pwd) sed grep "$@" && "$@" x=1 printf printf echo $(pwd)
+	-eu awk readonly printf 2>/dev/null 'quoted text' /usr/bin
+sed ${HOME} /usr/bin && readonly awk awk
+	x=1 $(pwd) --verbose "$@" cd 'quoted text'
+&& "$1" /usr/bin $(pwd) | done export done /usr/bin ${HOME} readonly test
+		/usr/bin $(pwd) && ${HOME} --verbose /usr/bin 'quoted text' then
+-eu -eu | test -eu | x=1 echo $(pwd) "$@" then
+printf --verbose printf readonly ${HOME} $(pwd) cd x=1 cd test local printf &&
+readonly 2>/dev/null 2>/dev/null /usr/bin 2>/dev/null done test
+export && x=1 && sed $(pwd) $(pwd)
+		printf readonly ${HOME} local | awk echo /usr/bin sed -eu
+	awk "$1" && then printf then 'quoted text' done ${HOME}
+	-eu -eu ${HOME} "$1" printf grep 'quoted text'
+	printf grep echo printf test
+local -eu done ${HOME}
+		/usr/bin export $(pwd) then export awk | echo printf -eu $(pwd) /usr/bin ${HOME}
+	readonly --verbose grep export ${HOME} --verbose
+		"$1" --verbose -eu --verbose --verbose 2>/dev/null printf 'quoted text'
+sed "$@" local "$@" ${HOME} then test
+		x=1 readonly "$1" test 'quoted text' awk printf local awk grep -eu readonly
+	then done 'quoted text' echo $(pwd) && awk $(pwd) grep then
+	awk awk done x=1 awk test export done done --verbose local readonly printf
+cd x=1 then test "$1" "$1" x=1 && then
+awk export x=1 grep sed 2>/dev/null done "$@" echo printf -eu export local
+	--verbose /usr/bin export $(pwd) cd | export awk cd readonly
+		sed printf -eu /usr/bin printf &&
+		"$1" local ${HOME} &&
+local $(pwd) cd test $(pwd) ${HOME} /usr/bin grep
+x=1 then /usr/bin x=1 --verbose export then printf x=1 $(pwd)
+	local | 2>/dev/null sed grep --verbose readonly done test | -eu
+grep /usr/bin grep grep "$@" sed 'quoted text' awk test cd export cd x=1
+		done echo export "$@" sed sed sed -eu cd 2>/dev/null -eu
+	/usr/bin local 'quoted text' --verbose
+		${HOME} -eu done grep printf
+		test export then 2>/dev/null "$1" cd 'quoted text' 'quoted text'
+		'quoted text' /usr/bin 2>/dev/null
+2>/dev/null -eu done "$1" cd && echo "$@" && awk done
+	-eu then /usr/bin 2>/dev/null
+		done readonly "$1" --verbose test sed export readonly test 'quoted text' readonly
+awk done export ${HOME} grep printf then
+		&& | | cd 'quoted text' 2>/dev/null "$@" grep "$@"
+	${HOME} readonly readonly cd test
+grep grep "$@" 2>/dev/null grep | export done --verbose 'quoted text' ${HOME}
+		export cd | then "$@" && "$@" "$@" then then done grep "$1" "$1" -eu printf echo
+cd $(pwd) then 2>/dev/null x=1 awk
+	echo -eu awk 2>/dev/null done
+		test 'quoted text' "$1" awk && awk "$1" printf echo ${HOME} cd
+		test awk readonly "$@"
+		awk -eu grep -eu x=1 awk awk echo awk done $(pwd)
+	awk printf $(pwd) "$@" --verbose && 2>/dev/null sed grep /usr/bin grep awk done
+		grep ${HOME} 2>/dev/null test then export -eu "$1" 2>/dev/null echo
+		readonly && && done -eu ${HOME} readonly readonly
+export "$1" /usr/bin "$1"
+	'quoted text' export echo /usr/bin readonly
+x=1 ${HOME} grep readonly --verbose echo ${HOME} 'quoted text'
+	readonly cd 'quoted text' done sed local ${HOME} echo | awk x=1
+printf x=1 $(pwd) && awk test 2>/dev/null | --verbose /usr/bin export -eu test
+		2>/dev/null /usr/bin grep
+grep echo done readonly "$@" ${HOME} awk readonly "$@"
+-eu export $(pwd) -eu local && grep then
+		/usr/bin | && /usr/bin printf x=1 cd local 'quoted text'
+test then /usr/bin | /usr/bin sed echo then x=1 local -eu printf awk
+		&& $(pwd) $(pwd) cd cd x=1 x=1 'quoted text' && test --verbose
+		echo local "$1" awk 2>/dev/null --verbose -eu local sed local x=1 export
+	&& "$1" --verbose test echo cd grep test echo done "$@" grep /usr/bin
+	done "$1" readonly $(pwd)
+		echo | && grep readonly sed "$@" $(pwd) 'quoted text' /usr/bin echo done --verbose
+	x=1 test done grep cd 'quoted text'
+'quoted text' "$1" awk 'quoted text' printf then "$1" 2>/dev/null test awk
+printf "$1" "$@" readonly printf then ${HOME} x=1 2>/dev/null
+	awk ${HOME} -eu sed readonly "$@" readonly echo 'quoted text'
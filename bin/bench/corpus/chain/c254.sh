@@ -0,0 +1,2001 @@
+test "$@" /usr/bin echo 'quoted text' sed sed
+		&& ${HOME} && readonly x=1 echo local printf --verbose test "$1" echo
+	then "$1" $(pwd) export readonly readonly cd
+	then cd test && "$1" sed cd sed "$1" && test
+		done 'quoted text' x=1 local cd --verbose
+printf --verbose 'quoted text' awk x=1 2>/dev/null readonly cd export 'quoted text'
+		printf test printf x=1 cd sed sed then export cd x=1 2>/dev/null
+	"$1" cd export 'quoted text' -eu --verbose 'quoted text'
+echo /usr/bin /usr/bin | sed $(pwd) test then grep local echo
+x=1 awk sed local echo readonly
+echo cd export | then cd x=1 $(pwd) $(pwd)
+	export 2>/dev/null printf export done awk echo test echo ${HOME} awk awk then
+		x=1 printf x=1 | awk && cd done "$@" then
+readonly && local | cd readonly
+	then "$@" grep cd export local && "$@" test export local
+	"$1" test /usr/bin cd 2>/dev/null 2>/dev/null awk test cd then "$@" "$1"
+		test -eu $(pwd) test ${HOME} awk 2>/dev/null
+	local export then readonly local
+export $(pwd) local sed "$@" $(pwd) awk
+-eu --verbose "$@" test -eu ${HOME} /usr/bin /usr/bin printf cd x=1
+done cd /usr/bin "$@" grep
+	"$1" done local printf readonly 2>/dev/null cd && "$@"
+local $(pwd) && -eu grep cd ${HOME} then test printf | | --verbose test
+		x=1 && awk awk $(pwd) local test --verbose
+	/usr/bin awk export "$1" done && awk
+	sed /usr/bin export done --verbose && && "$1" x=1 && then
+awk | x=1 local && --verbose sed test cd sed && x=1 cd 2>/dev/null sed export -eu
+awk 2>/dev/null awk done x=1 | printf ${HOME} x=1
+		test && 2>/dev/null grep x=1 x=1 sed printf | 2>/dev/null $(pwd) "$1" x=1 local
+${HOME} awk awk "$@" -eu -eu x=1 readonly echo test "$1" 2>/dev/null -eu then
+	then | -eu readonly done done --verbose && export
+"$@" echo then export test 'quoted text' --verbose | | readonly
+local --verbose grep 2>/dev/null export --verbose &&
+	done $(pwd) "$@" sed 'quoted text' readonly /usr/bin echo x=1
+	done ${HOME} 2>/dev/null awk cd sed sed done test cd local $(pwd)
+		| awk sed 'quoted text' 'quoted text' local printf sed export
+done then 2>/dev/null /usr/bin $(pwd) test /usr/bin cd && printf
+	${HOME} export "$@" sed 'quoted text'
+${HOME} test sed export $(pwd) 2>/dev/null
+grep -eu x=1 then local then local | printf awk done
+	awk "$1" export test sed x=1 then $(pwd)
+		sed printf ${HOME} 2>/dev/null "$1" cd 'quoted text' 2>/dev/null
+x=1 "$1" test cd printf local ${HOME}
+sed test "$@" 'quoted text' then 2>/dev/null export echo test echo --verbose
+		| "$1" local x=1 cd 2>/dev/null
+export ${HOME} grep 'quoted text' printf "$1" ${HOME} 'quoted text'
+		test readonly printf test /usr/bin
+	${HOME} 'quoted text' x=1 sed test awk | ${HOME}
+	${HOME} 'quoted text' ${HOME} --verbose
+| grep ${HOME} ${HOME} awk && test && x=1 "$@" /usr/bin && ${HOME} --verbose
+		-eu && x=1 /usr/bin awk cd | cd --verbose echo printf awk x=1 then ${HOME}
+	done cd sed echo awk x=1 x=1 echo export 'quoted text'
+		local awk export echo -eu export cd
+| 2>/dev/null grep 2>/dev/null sed cd 2>/dev/null
+awk export cd export "$@" --verbose -eu | | local && /usr/bin
+	cd "$@" awk sed grep done "$1" awk && test
+		$(pwd) test then test 'quoted text' && "$1" cd sed && cd readonly grep
+		sed 'quoted text' then readonly /usr/bin
+		--verbose done then && "$@" --verbose "$1" x=1 "$1" | export ${HOME}
+		&& then done cd done x=1 done | x=1 readonly
+	/usr/bin grep echo sed export test -eu done readonly
+echo 'quoted text' x=1 then done grep ${HOME} local && done echo echo
+		'quoted text' | --verbose done export export && --verbose cd x=1 | "$@"
+echo cd --verbose awk | && ${HOME} readonly "$1"
+	export 2>/dev/null echo
+		/usr/bin test test test
+		"$@" --verbose --verbose printf
+	printf /usr/bin ${HOME} "$1" $(pwd) ${HOME} local
+		sed && printf $(pwd) 'quoted text' then x=1 "$1" 'quoted text'
+	cd $(pwd) sed printf local
+	"$1" x=1 ${HOME} echo readonly --verbose --verbose grep printf local 2>/dev/null
+	${HOME} && ${HOME} "$1" | ${HOME} readonly x=1 done echo -eu
+		cd test /usr/bin export cd then export -eu sed /usr/bin cd awk "$@" test echo
+		then /usr/bin printf --verbose sed export awk test
+	awk 2>/dev/null "$@" grep 'quoted text' awk "$1" 'quoted text'
+	'quoted text' readonly sed grep ${HOME} $(pwd) grep ${HOME} /usr/bin
+		sed test done awk "$1"
+		$(pwd) export $(pwd) then -eu awk then ${HOME} --verbose grep x=1 grep export
+	test "$1" done sed "$1" "$1" ${HOME} grep cd /usr/bin
+then then "$1" echo && $(pwd) done awk export
+echo x=1 export local -eu
+		grep printf x=1 'quoted text' $(pwd) cd grep -eu grep "$1" && test
+	then export echo sed && echo ${HOME} --verbose printf export 'quoted text'
+		x=1 sed "$1" x=1 | "$1" -eu echo readonly
+	readonly && ${HOME} && ${HOME} | local readonly
+cd $(pwd) sed -eu $(pwd) --verbose 'quoted text'
+export && 2>/dev/null grep echo then export
+		${HOME} printf readonly readonly && 2>/dev/null sed "$1" awk
+done local x=1 | ${HOME} | -eu 'quoted text'
+| "$@" x=1 --verbose then readonly "$@" && local grep $(pwd) 'quoted text' printf
+		$(pwd) echo grep grep | "$1" cd
+	test grep test --verbose export 'quoted text' export -eu
+${HOME} x=1 "$1" 2>/dev/null printf --verbose -eu grep local "$1" test export then
+		| && grep printf -eu then 2>/dev/null 2>/dev/null sed /usr/bin
+		$(pwd) awk "$1" 2>/dev/null -eu test x=1 export 2>/dev/null readonly && /usr/bin
+	readonly export cd | echo
+		awk && then "$@" 2>/dev/null -eu
+local && awk ${HOME} -eu
+local export /usr/bin local test 'quoted text' && echo test
+	| export export cd echo 2>/dev/null printf
+cd && 2>/dev/null grep then printf --verbose
+		done | test readonly --verbose
+	-eu 'quoted text' --verbose readonly "$@" /usr/bin "$@" done
+	'quoted text' readonly local then "$1" printf 2>/dev/null
+local echo export x=1 ${HOME} printf export done readonly
+echo export "$@" done local --verbose then && sed sed printf | && export
+	cd "$1" 'quoted text' then --verbose test grep ${HOME} 2>/dev/null --verbose
+x=1 awk 'quoted text' x=1 $(pwd) | test
+	awk cd 2>/dev/null cd printf echo sed --verbose 2>/dev/null /usr/bin | done grep
+		--verbose test 2>/dev/null readonly 'quoted text'
+	sed 2>/dev/null -eu echo awk | "$@" local readonly && "$1" then then $(pwd)
+	echo -eu && /usr/bin "$@" --verbose --verbose
+		sed printf "$1" 'quoted text' ${HOME} grep
+&& "$@" /usr/bin local x=1 readonly export -eu "$@" $(pwd) export echo export
+		export -eu echo && 2>/dev/null x=1 cd -eu "$@" "$1" x=1 echo && "$1" then -eu 2>/dev/null
+"$1" export then sed $(pwd)
+		printf readonly "$@" --verbose "$1" printf test "$@" test | export export --verbose
+		$(pwd) | export grep echo x=1 "$@" ${HOME} export grep export | ${HOME}
+	then local readonly printf sed test "$1"
+then sed "$1" /usr/bin 2>/dev/null 'quoted text'
+		test /usr/bin grep export $(pwd) "$@" then ${HOME} readonly "$1" "$1" | $(pwd)
+		--verbose awk echo export | /usr/bin printf
+awk "$@" 'quoted text'
+	"$1" then $(pwd) | sed 'quoted text' echo awk -eu 2>/dev/null
+		readonly 'quoted text' awk readonly | cd local
+		"$1" $(pwd) | sed "$@" cd && cd "$1" done "$1" export -eu &&
+		'quoted text' && | --verbose done "$1" 2>/dev/null 'quoted text' done cd "$@"
+$(pwd) && echo echo printf test grep "$@" done printf
+		2>/dev/null then ${HOME} grep && --verbose
+	grep $(pwd) readonly then $(pwd) local "$@" "$@" 'quoted text' ${HOME} 2>/dev/null
+	x=1 "$1" 'quoted text' printf grep --verbose x=1 "$1"
+		printf awk done x=1 "$@" 'quoted text' "$1" done local ${HOME} echo --verbose
+	&& done /usr/bin awk sed readonly 2>/dev/null then "$1" "$@" test 2>/dev/null
+		/usr/bin --verbose local ${HOME}
+		/usr/bin x=1 local grep /usr/bin test 2>/dev/null | --verbose
+		sed cd && $(pwd) test test readonly awk /usr/bin then cd 2>/dev/null
+export x=1 -eu awk /usr/bin done
+		awk cd awk --verbose awk && /usr/bin local x=1 ${HOME} |
+local 'quoted text' awk echo cd "$1"
+"$1" -eu done /usr/bin $(pwd) echo && test $(pwd) sed x=1 readonly cd sed
+	sed 2>/dev/null readonly done echo
+		grep -eu export cd then
+	${HOME} cd grep test printf "$1" ${HOME} awk echo sed 2>/dev/null "$@" 2>/dev/null
+${HOME} readonly ${HOME} awk "$1" grep ${HOME} then
+${HOME} echo awk -eu && test test | sed test sed ${HOME} /usr/bin done
+		--verbose awk readonly -eu awk 2>/dev/null
+"$1" 'quoted text' /usr/bin "$@" grep 'quoted text' readonly awk -eu /usr/bin
+		${HOME} readonly grep test awk | -eu && | done 2>/dev/null /usr/bin cd local ${HOME}
+2>/dev/null printf "$1" awk cd $(pwd) printf x=1 grep $(pwd) test
+--verbose 2>/dev/null --verbose
+	sed 'quoted text' -eu done sed test -eu "$@"
+		--verbose 2>/dev/null ${HOME} | sed test echo echo && && done grep awk
+		/usr/bin readonly --verbose done readonly test awk
+		cd export awk --verbose 2>/dev/null awk 'quoted text' local -eu -eu
+cd "$1" echo printf awk x=1 | grep -eu | local sed --verbose grep 2>/dev/null
+		awk -eu awk done /usr/bin --verbose cd readonly --verbose awk 2>/dev/null /usr/bin
+		test /usr/bin export export printf
+printf test readonly cd ${HOME} readonly 2>/dev/null 'quoted text' readonly
+x=1 /usr/bin x=1 x=1 "$@" 2>/dev/null | export
+x=1 sed then test local --verbose
+		readonly "$@" $(pwd) done cd
+		x=1 grep /usr/bin then 'quoted text'
+		sed 2>/dev/null x=1 sed export --verbose
+sed && local | export done awk test
+		x=1 -eu local printf
+		test 'quoted text' "$1" awk --verbose grep printf -eu echo $(pwd) cd done sed
+printf cd local cd echo x=1 printf sed "$@" && done --verbose
+"$@" && cd ${HOME} |
+	/usr/bin -eu && /usr/bin printf "$1" grep ${HOME}
+readonly cd done then 'quoted text'
+test echo "$@" -eu 'quoted text' 2>/dev/null done awk echo cd | && -eu then
+		/usr/bin -eu -eu 2>/dev/null 2>/dev/null test | sed local --verbose
+cd then -eu | sed 2>/dev/null readonly | grep
+	cd grep /usr/bin 2>/dev/null done $(pwd)
+		'quoted text' done sed -eu "$@" test
+		local printf cd "$1" awk
+		done 'quoted text' -eu --verbose printf then export "$1" "$1" --verbose
+local echo && | x=1 then
+	local | --verbose grep ${HOME} cd -eu test
+		$(pwd) && 'quoted text' printf sed --verbose | grep && printf ${HOME} awk cd awk
+&& grep "$@" 2>/dev/null awk awk grep done sed local awk "$@" -eu "$@"
+		export && $(pwd) "$@" export "$@" sed awk -eu /usr/bin /usr/bin
+&& | local printf then ${HOME} readonly "$1" then 2>/dev/null
+"$1" x=1 ${HOME} echo awk 2>/dev/null
+		export local x=1 local -eu -eu
+		--verbose "$1" 2>/dev/null
+awk $(pwd) "$1" grep printf | cd 2>/dev/null sed
+	readonly printf export then sed "$1"
+		${HOME} ${HOME} /usr/bin local ${HOME}
+		sed "$1" then --verbose "$1"
+${HOME} export /usr/bin $(pwd) 2>/dev/null grep
+	printf && | echo /usr/bin
+	/usr/bin && --verbose -eu echo local $(pwd) /usr/bin "$1" /usr/bin test
+		printf echo ${HOME} done --verbose sed local
+then && 'quoted text' --verbose done x=1 -eu local export
+	"$1" local echo -eu x=1 readonly cd export
+$(pwd) test readonly x=1 | | /usr/bin
+		test grep local local --verbose -eu local printf -eu grep sed
+	'quoted text' -eu done awk "$@" echo echo sed $(pwd) readonly
+		printf ${HOME} && awk | done
+"$@" 'quoted text' awk $(pwd) awk cd --verbose "$1" x=1 grep awk
+	then /usr/bin ${HOME} local awk export grep 2>/dev/null 'quoted text' local
+	done awk x=1 "$@" /usr/bin x=1 printf
+		sed /usr/bin cd x=1 "$@" "$1" test "$@" echo test x=1 awk test printf printf readonly
+	x=1 -eu $(pwd) -eu local /usr/bin grep "$@"
+	"$1" local "$1" -eu 2>/dev/null
+		done cd 'quoted text' "$@" -eu grep echo sed
+		2>/dev/null -eu done x=1 sed local && readonly -eu "$@"
+		/usr/bin -eu x=1 done then -eu "$@" export grep echo 'quoted text'
+	awk "$@" then /usr/bin awk then
+local $(pwd) readonly printf then sed | /usr/bin sed 'quoted text'
+		sed 2>/dev/null echo cd local readonly then printf /usr/bin
+awk then $(pwd) local && --verbose export sed --verbose readonly /usr/bin
+		"$@" grep awk readonly $(pwd) && x=1 done | printf readonly
+	echo export | awk test test local
+		printf --verbose echo "$@" "$@" -eu x=1 grep
+		${HOME} sed awk 'quoted text' ${HOME} readonly printf
+		'quoted text' 'quoted text' "$1" && 2>/dev/null
+		/usr/bin 2>/dev/null && -eu "$@" done grep grep cd
+readonly then then /usr/bin then readonly 2>/dev/null grep && -eu
+	/usr/bin done "$1" ${HOME} -eu $(pwd) /usr/bin ${HOME}
+		done -eu printf "$@" $(pwd) test then awk &&
+	done ${HOME} echo 2>/dev/null readonly export export ${HOME}
+		-eu --verbose 'quoted text' /usr/bin "$1" export && "$@" readonly
+	--verbose | /usr/bin local
+"$1" grep done -eu printf && -eu test local ${HOME}
+		local /usr/bin grep 2>/dev/null 'quoted text' /usr/bin export 'quoted text'
+		done 2>/dev/null -eu printf readonly export echo -eu
+	grep test ${HOME} && sed $(pwd) | | printf $(pwd) "$@"
+		sed grep grep sed ${HOME} printf 2>/dev/null then && readonly "$1" x=1 -eu
+	sed export then $(pwd) readonly echo $(pwd) /usr/bin sed test ${HOME} | then
+	"$@" && export ${HOME} test printf && "$@" done grep --verbose
+	readonly | sed sed sed local "$1" cd "$@" local done && sed 2>/dev/null
+	readonly ${HOME} echo x=1 x=1 $(pwd) x=1 --verbose 2>/dev/null
+	-eu printf x=1 awk echo export -eu $(pwd) -eu grep 'quoted text' done -eu then
+		printf "$1" cd ${HOME} test | 2>/dev/null
+awk --verbose && $(pwd) local
+	"$1" local | x=1 2>/dev/null cd "$1"
+		x=1 readonly 'quoted text' $(pwd)
+"$@" -eu then grep then awk then -eu && | "$@" printf x=1 awk && grep
+		'quoted text' -eu printf && && "$1" awk cd export readonly
+		&& printf cd cd x=1 -eu && echo -eu $(pwd)
+	&& awk echo cd | $(pwd) test done && export echo export x=1 &&
+		test awk /usr/bin -eu 2>/dev/null --verbose
+sed echo cd x=1 --verbose done cd sed cd grep 2>/dev/null "$@"
+		"$1" $(pwd) && -eu awk x=1 awk $(pwd) -eu export 'quoted text'
+	echo --verbose echo --verbose local printf test x=1 -eu "$1" printf
+	test readonly 'quoted text' export echo done
+	${HOME} "$1" then && "$1" sed && /usr/bin test 'quoted text' sed
+test && cd && "$@" $(pwd) grep export 'quoted text'
+test | ${HOME} echo awk "$1" test then printf ${HOME} && sed
+$(pwd) $(pwd) then grep sed grep export
+		--verbose && readonly 2>/dev/null
+$(pwd) export x=1 then ${HOME} printf local printf done cd done grep 'quoted text'
+		x=1 | ${HOME} done echo printf cd export readonly ${HOME} cd "$@" cd x=1 done ${HOME}
+--verbose cd $(pwd) printf test
+grep export | export && grep
+cd | x=1 export /usr/bin --verbose | sed /usr/bin sed --verbose
+echo 'quoted text' ${HOME} $(pwd) cd local x=1 printf $(pwd) cd
+		cd awk echo && 2>/dev/null
+		${HOME} export $(pwd) echo done 'quoted text' test cd printf
+&& /usr/bin ${HOME} ${HOME} --verbose done done
+	test 'quoted text' then /usr/bin "$@" then
+		"$@" awk x=1 ${HOME} readonly printf | 'quoted text' readonly test grep
+	grep -eu x=1 export sed echo export
+		-eu "$@" local export "$1" printf $(pwd) && export x=1 $(pwd) export readonly
+'quoted text' $(pwd) done printf grep ${HOME}
+	grep x=1 "$@" printf x=1 sed "$1" 2>/dev/null 'quoted text'
+	'quoted text' x=1 readonly echo awk
+		grep readonly --verbose $(pwd) /usr/bin echo local readonly
+	cd done /usr/bin | 'quoted text' 'quoted text' readonly --verbose done export
+readonly echo readonly printf echo readonly "$@"
+2>/dev/null cd grep grep /usr/bin /usr/bin local test sed
+	-eu ${HOME} sed -eu | "$@" $(pwd) /usr/bin
+	local then 2>/dev/null test | x=1 cd | 2>/dev/null
+		"$@" | ${HOME} cd readonly printf readonly
+"$@" printf export export "$1" done cd $(pwd) --verbose
+sed 2>/dev/null 2>/dev/null export ${HOME} readonly readonly test x=1 && test
+		test test $(pwd) grep x=1 "$1" 2>/dev/null echo --verbose 2>/dev/null grep &&
+		awk ${HOME} "$@" $(pwd) "$@" $(pwd) export awk done
+		--verbose printf awk sed -eu "$1" "$1" local done
+		$(pwd) awk /usr/bin 2>/dev/null
+grep local readonly 'quoted text' "$1" grep test | sed test printf
+	echo test "$@" done readonly --verbose local | x=1 then
+	done x=1 "$1" --verbose 2>/dev/null awk export | | done
+		readonly printf grep test 'quoted text' export 'quoted text'
+	readonly | 2>/dev/null | export
+then -eu cd -eu /usr/bin "$@" | "$1" export $(pwd) "$1" 2>/dev/null local
+	printf then printf 'quoted text'
+	2>/dev/null test grep ${HOME} then --verbose 2>/dev/null awk test
+		'quoted text' echo sed printf 2>/dev/null grep --verbose
+	grep "$@" /usr/bin awk | printf /usr/bin local done && local done done
+	2>/dev/null sed done --verbose export echo readonly
+		cd $(pwd) && readonly sed test x=1 && test
+grep sed x=1 cd readonly local echo x=1
+	2>/dev/null --verbose echo cd cd $(pwd) sed x=1
+	"$@" echo printf printf
+		${HOME} local sed $(pwd) "$@" | ${HOME} then awk 'quoted text'
+		$(pwd) x=1 --verbose readonly 2>/dev/null readonly "$1" /usr/bin -eu
+	"$1" done echo $(pwd) echo cd 2>/dev/null && done
+echo local test cd && x=1
+		&& ${HOME} awk $(pwd) "$@" "$1" printf 2>/dev/null sed readonly x=1 readonly
+		"$@" readonly "$@" "$1" 2>/dev/null local x=1 echo echo printf
+sed | local awk ${HOME} done printf 'quoted text' 2>/dev/null
+| 'quoted text' 2>/dev/null --verbose printf local printf cd readonly
+	local "$1" readonly | --verbose
+$(pwd) 'quoted text' 2>/dev/null local "$@" cd "$@" --verbose && local
+		printf sed cd done && /usr/bin
+	printf then then printf echo cd awk local grep -eu /usr/bin
+	then $(pwd) | done awk
+		"$1" ${HOME} then cd grep export && "$@" 2>/dev/null local && local
+	| $(pwd) && /usr/bin | /usr/bin | readonly /usr/bin sed 2>/dev/null sed $(pwd)
+	/usr/bin export && --verbose "$@" local ${HOME} export
+	awk sed done --verbose test "$@" "$@" export printf
+&& printf "$1" /usr/bin -eu done sed
+&& then local "$@" printf grep echo -eu printf echo -eu cd 2>/dev/null
+	test ${HOME} awk -eu then /usr/bin "$1" --verbose
+	test then | sed readonly echo export "$@" readonly
+		-eu $(pwd) grep test 2>/dev/null -eu local echo awk
+sed local --verbose printf printf awk grep sed test readonly
+		&& export $(pwd) /usr/bin readonly x=1 | && "$@" 'quoted text' local -eu test |
+	awk readonly awk 2>/dev/null printf "$@" 'quoted text'
+test test cd test echo $(pwd) cd $(pwd) local | sed &&
+x=1 "$@" export readonly | test && export done test grep readonly
+		-eu "$1" echo test 2>/dev/null && ${HOME} | | && awk local 'quoted text'
+'quoted text' test --verbose done awk awk local 2>/dev/null echo sed
+		-eu "$1" | x=1 "$1" $(pwd) grep grep then x=1 --verbose
+local -eu sed test "$@" printf | test readonly test --verbose --verbose test
+		-eu "$@" test $(pwd) 2>/dev/null
+		readonly readonly then 'quoted text' echo --verbose /usr/bin export readonly
+"$@" export ${HOME} printf "$@" x=1
+${HOME} done "$1" /usr/bin printf /usr/bin cd 2>/dev/null
+		-eu --verbose cd export done cd && 'quoted text'
+	local x=1 cd x=1 -eu echo && -eu
+--verbose 2>/dev/null 'quoted text' export echo awk /usr/bin $(pwd) export then
+echo cd readonly /usr/bin x=1 $(pwd) x=1 -eu && done cd "$@" echo --verbose then
+		then -eu --verbose readonly
+	'quoted text' --verbose local printf awk /usr/bin -eu "$1" /usr/bin ${HOME}
+		x=1 done "$1" 2>/dev/null --verbose 2>/dev/null "$@" local export
+		sed cd "$1" readonly "$@" ${HOME}
+		${HOME} "$1" 2>/dev/null
+	x=1 ${HOME} echo done done x=1 'quoted text'
+		awk ${HOME} -eu 2>/dev/null test 'quoted text' local awk echo cd
+	test "$1" && $(pwd) -eu cd export local cd
+		done x=1 "$1" readonly --verbose
+&& x=1 "$@" sed /usr/bin -eu
+sed awk cd test echo awk && ${HOME} 'quoted text'
+	local 'quoted text' awk 2>/dev/null printf && x=1 | test printf
+| 2>/dev/null then local x=1 export -eu "$@" ${HOME} --verbose then export
+-eu && "$@" -eu sed --verbose x=1 sed 2>/dev/null "$@" ${HOME}
+x=1 then x=1 x=1 /usr/bin export done cd /usr/bin 2>/dev/null | "$@" grep
+2>/dev/null then grep "$1" ${HOME} cd sed
+	"$@" 'quoted text' awk | | local cd /usr/bin x=1 then done printf
+/usr/bin && grep printf "$@" "$1" "$@" 2>/dev/null ${HOME} "$1"
+	| x=1 done export export
+	then "$@" grep "$@" /usr/bin awk local "$@" | --verbose readonly
+	&& grep grep -eu 'quoted text'
+	2>/dev/null printf local --verbose done local 2>/dev/null test ${HOME} export
+/usr/bin printf ${HOME} awk readonly
+	sed "$@" /usr/bin 2>/dev/null --verbose cd
+		"$@" /usr/bin -eu done done echo awk
+	cd $(pwd) $(pwd) printf printf test --verbose | | then awk export --verbose --verbose
+	cd x=1 local done --verbose local 2>/dev/null ${HOME}
+		--verbose local grep done --verbose x=1 done test local echo sed grep
+		x=1 awk sed "$@" local local
+		printf 2>/dev/null done grep --verbose | x=1 then test 'quoted text'
+		x=1 printf export then 2>/dev/null 'quoted text' /usr/bin x=1 $(pwd)
+	then "$@" $(pwd) awk 2>/dev/null | --verbose export "$1" cd
+		"$@" grep then echo then ${HOME} cd awk -eu done /usr/bin /usr/bin
+		readonly ${HOME} -eu | && 'quoted text' 2>/dev/null export ${HOME}
+		local x=1 | 2>/dev/null "$1" "$1" local printf
+x=1 $(pwd) && "$1" sed -eu echo "$1" --verbose sed export
+	then 'quoted text' done "$1"
+	printf awk "$1" "$1" ${HOME}
+"$1" printf then "$@" then local -eu grep |
+echo /usr/bin cd | export printf cd printf | && 'quoted text' awk local 2>/dev/null
+	test "$1" grep test echo ${HOME} printf
+| export && then x=1 "$1"
+	awk "$1" 2>/dev/null &&
+	test cd -eu 'quoted text' ${HOME} --verbose
+	cd | sed "$@" printf $(pwd) && awk "$@" -eu
+	echo x=1 'quoted text' "$1" readonly /usr/bin
+		-eu echo cd $(pwd) 2>/dev/null echo
+	export --verbose done local sed awk $(pwd) export
+printf "$@" 'quoted text' cd --verbose test
+		sed grep grep then --verbose 'quoted text' && | 2>/dev/null then test
+		"$1" then 2>/dev/null printf 'quoted text' local -eu
+		&& printf awk "$@" cd done test printf readonly grep done sed
+	test --verbose readonly -eu
+		| -eu cd "$@" "$1" x=1 | readonly
+		$(pwd) grep awk local sed printf printf cd "$@" --verbose
+		readonly done echo ${HOME} 'quoted text'
+	printf ${HOME} awk grep "$1" export then | $(pwd) x=1 ${HOME} --verbose
+	2>/dev/null then echo done printf
+	awk printf printf x=1 sed echo awk printf ${HOME}
+sed 'quoted text' "$1"
+$(pwd) grep x=1 echo echo ${HOME} 2>/dev/null then x=1 sed
+		sed grep sed "$1" printf printf local --verbose | grep $(pwd) awk
+	test then x=1 ${HOME} ${HOME} readonly
+		test x=1 "$@" && sed grep readonly printf 'quoted text' "$1" export local
+		"$@" then && sed $(pwd) | sed local awk export
+echo && cd export readonly readonly /usr/bin
+		then readonly "$@" done /usr/bin -eu ${HOME} | local then export "$@" | printf
+		echo echo done -eu 'quoted text' $(pwd) "$@" cd done local "$1" awk 2>/dev/null
+		then | printf -eu "$1" local ${HOME} sed done /usr/bin
+		printf echo ${HOME} test test
+local sed ${HOME} "$@" 2>/dev/null 'quoted text'
+${HOME} sed "$1" local /usr/bin -eu printf 'quoted text'
+	$(pwd) export | /usr/bin --verbose
+grep echo printf --verbose /usr/bin
+test "$1" ${HOME} then --verbose
+	grep awk export done x=1 test done cd | "$1" x=1 2>/dev/null
+	echo test grep x=1 2>/dev/null && "$@"
+$(pwd) echo cd grep sed --verbose $(pwd) printf
+		/usr/bin export x=1 2>/dev/null test sed readonly "$@" readonly 'quoted text'
+2>/dev/null sed $(pwd) readonly echo awk export
+	echo 'quoted text' "$@" | sed test
+		"$@" sed "$@" grep /usr/bin cd awk readonly then done awk && --verbose
+		readonly then done /usr/bin 'quoted text' printf | 'quoted text' export
+		awk | cd | awk printf 'quoted text' "$@" done local cd readonly "$1" -eu |
+		readonly 'quoted text' local then --verbose grep $(pwd) "$@"
+	x=1 'quoted text' echo printf export local export
+${HOME} "$1" sed -eu /usr/bin done readonly cd echo $(pwd) done test then
+'quoted text' cd echo export echo
+		then "$1" $(pwd) export 2>/dev/null && done | $(pwd) "$1" done local
+		"$@" export grep "$1" local | echo /usr/bin ${HOME} done ${HOME} done 'quoted text'
+		export ${HOME} && then
+		sed then -eu sed | --verbose x=1 --verbose local x=1 done grep -eu
+local done --verbose test sed 'quoted text' 'quoted text' test "$1" awk awk "$1"
+	'quoted text' then -eu
+		"$1" 2>/dev/null -eu cd export 2>/dev/null echo "$1" export
+readonly "$1" cd 2>/dev/null -eu $(pwd) then
+	"$1" export $(pwd) "$@" cd --verbose $(pwd) -eu 'quoted text'
+| readonly local | 2>/dev/null | local
+		-eu done "$1" export readonly awk local export test awk export x=1 | "$@"
+		awk export readonly cd export readonly /usr/bin
+	x=1 sed awk export export 'quoted text' 2>/dev/null
+		--verbose "$1" echo done grep 'quoted text' "$1" printf
+2>/dev/null cd "$@" /usr/bin $(pwd) then
+		$(pwd) x=1 export done "$1"
+	grep && ${HOME} -eu cd ${HOME} printf readonly awk ${HOME} test x=1 -eu "$@" &&
+awk --verbose export ${HOME} cd
+"$1" --verbose && local /usr/bin
+		readonly local export | "$1" -eu grep "$1" | then export $(pwd) echo | awk
+-eu local "$@" 2>/dev/null awk local $(pwd)
+	printf export 2>/dev/null x=1 then awk echo local ${HOME} local
+	sed export && x=1 --verbose | "$1" printf --verbose readonly
+		then 2>/dev/null export cd printf awk export "$1" local
+		'quoted text' /usr/bin 2>/dev/null 'quoted text'
+--verbose /usr/bin | $(pwd)
+2>/dev/null grep then 'quoted text' 'quoted text'
+	'quoted text' | cd local /usr/bin x=1 test -eu export
+	then "$1" -eu x=1 ${HOME} 2>/dev/null
+'quoted text' export awk "$@" /usr/bin done
+--verbose local test local grep cd "$@"
+	sed "$@" 'quoted text' export /usr/bin -eu 2>/dev/null | 2>/dev/null
+'quoted text' x=1 test 2>/dev/null printf x=1
+		2>/dev/null awk "$@" export
+echo export $(pwd) sed sed $(pwd) then /usr/bin local "$1" 2>/dev/null "$1" sed
+		&& x=1 awk export local cd sed printf printf sed readonly
+$(pwd) ${HOME} && -eu awk local local 'quoted text' printf done
+	${HOME} cd /usr/bin "$@" test awk
+--verbose --verbose "$@" "$@" test awk 2>/dev/null
+		x=1 readonly --verbose 'quoted text' awk
+		then ${HOME} export export test awk cd cd ${HOME} 'quoted text' done 'quoted text'
+x=1 --verbose local cd local $(pwd) cd
+--verbose x=1 | 2>/dev/null --verbose test --verbose -eu /usr/bin export
+	readonly export grep -eu grep 2>/dev/null -eu echo "$1" && readonly /usr/bin
+		'quoted text' 'quoted text' export then
+		readonly export awk grep /usr/bin
+2>/dev/null ${HOME} ${HOME} echo cd done 2>/dev/null
+&& then -eu 2>/dev/null local "$1" | done test 2>/dev/null test
+		grep done && 'quoted text' $(pwd) && awk readonly
+cd printf ${HOME} "$1" sed x=1 sed && 2>/dev/null
+	2>/dev/null && 2>/dev/null export cd ${HOME} awk -eu local grep /usr/bin awk then
+export $(pwd) 2>/dev/null test 'quoted text' test done
+		local awk "$@" echo "$1" -eu then "$1" then cd | 'quoted text' readonly cd "$1"
+		| done "$@" cd export test /usr/bin
+	awk echo ${HOME} done -eu --verbose awk printf echo
+2>/dev/null --verbose readonly grep test -eu
+2>/dev/null "$@" done awk /usr/bin 2>/dev/null "$1" ${HOME} printf -eu && -eu printf
+	${HOME} -eu && cd done "$@" "$@" "$@" cd test local local $(pwd)
+	--verbose grep done "$1" local $(pwd)
+sed cd | local done x=1 export printf --verbose
+'quoted text' $(pwd) test
+		done done cd test then sed /usr/bin
+		grep printf x=1 --verbose test ${HOME} "$@" sed awk --verbose
+		sed "$@" /usr/bin grep then "$1" -eu "$1" done sed readonly
+		-eu /usr/bin x=1 local done /usr/bin $(pwd) --verbose grep ${HOME} sed /usr/bin
+	readonly awk /usr/bin 2>/dev/null then /usr/bin | sed 2>/dev/null printf
+"$@" done test $(pwd) sed /usr/bin | test awk then
+	sed && ${HOME} then sed
+		2>/dev/null cd cd 'quoted text' x=1 test readonly awk export -eu -eu test -eu
+		'quoted text' --verbose printf readonly local awk test /usr/bin export "$1"
+		${HOME} --verbose ${HOME} $(pwd) ${HOME} $(pwd)
+		printf echo local export /usr/bin && readonly readonly
+	done test $(pwd) echo ${HOME} done $(pwd) 'quoted text'
+	done awk $(pwd) done $(pwd)
+		-eu done done then grep ${HOME} printf
+		local /usr/bin && -eu "$1" 'quoted text' cd ${HOME} "$@"
+		local echo test sed echo -eu local test local ${HOME}
+	echo 2>/dev/null -eu grep ${HOME} x=1
+		--verbose -eu local ${HOME} x=1 grep test && && sed $(pwd) 'quoted text'
+	then awk 'quoted text' awk sed awk then then -eu done /usr/bin && ${HOME}
+'quoted text' local && printf /usr/bin --verbose --verbose readonly "$@" readonly
+$(pwd) $(pwd) 2>/dev/null $(pwd) ${HOME} grep x=1 "$1" readonly awk then x=1
+	"$@" export local echo ${HOME} grep
+		'quoted text' && echo ${HOME} export "$1" ${HOME} test 'quoted text'
+		local | | "$@" readonly export /usr/bin && done awk
+	/usr/bin 2>/dev/null done | "$1" $(pwd) "$@" export |
+		&& -eu x=1 printf 2>/dev/null "$1" /usr/bin grep readonly 2>/dev/null
+awk readonly && /usr/bin readonly sed sed done sed "$@" local local cd /usr/bin
+		/usr/bin echo | --verbose export | done && printf export done grep
+		/usr/bin test "$@" ${HOME}
+		printf "$@" then printf && 'quoted text' "$@" 'quoted text' export readonly
+| x=1 "$1" $(pwd) x=1 'quoted text' | 2>/dev/null x=1 "$1" "$@" awk && echo
+		awk 'quoted text' -eu sed /usr/bin cd 2>/dev/null
+	| /usr/bin sed readonly printf export test echo cd grep
+		readonly readonly -eu "$1" grep export then | done 'quoted text'
+2>/dev/null && "$1" "$@" test
+then grep test then awk ${HOME} export x=1 -eu
+		local readonly --verbose x=1 readonly $(pwd) echo export
+		"$1" "$@" && readonly done local $(pwd) $(pwd) awk test
+	done cd local 'quoted text' readonly -eu /usr/bin sed "$1" /usr/bin $(pwd) /usr/bin
+		/usr/bin sed && /usr/bin grep x=1 export
+		local grep then 'quoted text' ${HOME} export local then sed
+		x=1 /usr/bin then x=1 "$1" /usr/bin cd "$1" | readonly
+"$1" printf $(pwd) --verbose | ${HOME} printf ${HOME} readonly
+	test "$1" 2>/dev/null grep --verbose
+'quoted text' 2>/dev/null $(pwd) "$@" then
+		| | "$@" 'quoted text' --verbose readonly
+echo test | | readonly export
+	&& printf 'quoted text' awk /usr/bin x=1
+2>/dev/null grep cd export cd "$1" --verbose echo sed export done sed export /usr/bin
+	export then | grep x=1 ${HOME} then awk "$1" --verbose
+x=1 x=1 $(pwd) "$1" "$@" "$1" readonly
+	grep printf /usr/bin grep readonly
+		readonly grep export $(pwd) "$1"
+	echo then $(pwd) then --verbose cd readonly grep done /usr/bin $(pwd) -eu cd sed
+	done && grep --verbose readonly "$@" "$1" && then
+		echo done 'quoted text' cd /usr/bin echo ${HOME} 'quoted text'
+sed 'quoted text' "$@" ${HOME} awk cd cd $(pwd) echo && done cd cd --verbose
+awk | sed cd then test $(pwd)
+"$@" then export && sed test local printf /usr/bin printf
+	then x=1 test sed "$@" done | grep x=1 readonly
+sed 2>/dev/null "$@" "$1" /usr/bin readonly printf then --verbose | printf
+&& cd x=1 "$@" "$1" --verbose 2>/dev/null export
+		echo grep awk $(pwd) /usr/bin ${HOME} local --verbose
+test $(pwd) local | cd test readonly done --verbose --verbose
+	printf && "$@" 2>/dev/null
+	then printf done test | export test && local local 2>/dev/null
+		| sed "$1" test done awk /usr/bin test printf /usr/bin "$@" printf
+		test awk && x=1 echo /usr/bin then "$1" cd x=1 "$@" readonly done $(pwd)
+	grep export printf -eu grep "$@" "$@" && x=1 /usr/bin
+	"$@" 2>/dev/null -eu |
+$(pwd) --verbose ${HOME} "$1" --verbose
+		--verbose test 2>/dev/null
+		--verbose 'quoted text' "$1" --verbose x=1 local
+printf $(pwd) printf x=1 sed /usr/bin
+	$(pwd) "$@" then then export ${HOME}
+	readonly -eu sed 'quoted text' 2>/dev/null grep x=1 printf done "$1"
+	${HOME} done $(pwd) grep cd then grep && then done export then printf "$1" $(pwd)
+| echo then "$1" 'quoted text' echo printf
+echo x=1 awk done readonly grep done cd $(pwd) export export echo
+2>/dev/null sed "$1" x=1 "$1" grep "$1" awk /usr/bin "$@" readonly 'quoted text'
+	sed $(pwd) readonly echo --verbose "$@" -eu export --verbose printf
+		local 2>/dev/null export awk "$@" local
+test done sed sed echo --verbose
+		then test 2>/dev/null export
+	readonly awk | sed done && sed
+	grep readonly $(pwd) ${HOME} printf echo sed
+	done readonly awk ${HOME} echo echo 2>/dev/null --verbose && printf 'quoted text'
+	--verbose "$@" ${HOME} sed export x=1
+/usr/bin readonly printf && x=1 x=1 export
+readonly "$@" done --verbose printf then
+	export --verbose 'quoted text' x=1 | $(pwd)
+x=1 echo "$@" printf /usr/bin $(pwd) test readonly sed /usr/bin $(pwd)
+	'quoted text' x=1 printf sed ${HOME} done -eu
+/usr/bin local grep cd cd grep
+	${HOME} 2>/dev/null test --verbose x=1 cd --verbose grep echo 2>/dev/null
+	${HOME} awk $(pwd) 'quoted text' sed
+local && -eu ${HOME} ${HOME} echo export
+readonly export test
+--verbose -eu 2>/dev/null echo $(pwd) $(pwd) sed awk -eu done /usr/bin printf
+		"$@" $(pwd) readonly awk 'quoted text' 'quoted text'
+		echo local local $(pwd) --verbose 2>/dev/null --verbose 2>/dev/null
+grep 2>/dev/null && "$@" done | "$@" grep export -eu $(pwd) 'quoted text' 2>/dev/null
+then test echo $(pwd) awk 'quoted text' 2>/dev/null --verbose awk sed |
+		export "$@" $(pwd) "$1" awk done && echo
+		/usr/bin readonly test x=1 "$1" 2>/dev/null "$1" grep
+		-eu --verbose awk ${HOME} cd | $(pwd) done done --verbose
+awk x=1 'quoted text' export $(pwd) ${HOME} printf ${HOME} test -eu 'quoted text'
+	"$@" test "$@" done test "$1" "$1" readonly
+${HOME} cd 'quoted text' local x=1
+	grep /usr/bin cd awk echo && sed sed 2>/dev/null done then readonly
+	-eu export echo && done test grep "$@" grep | grep
+	$(pwd) | | cd --verbose test readonly sed --verbose done test
+	test printf x=1 "$1" echo printf done --verbose printf /usr/bin
+	'quoted text' -eu -eu && 'quoted text' x=1 export "$1" 2>/dev/null
+		'quoted text' | grep sed ${HOME} local export local /usr/bin "$1" "$@" x=1
+	| --verbose then /usr/bin --verbose && x=1 awk
+	--verbose echo --verbose /usr/bin local
+	| --verbose readonly then
+2>/dev/null cd cd -eu && ${HOME} printf && sed
+		"$1" then grep && test --verbose test -eu -eu x=1 done x=1
+awk "$@" -eu $(pwd) sed "$@" export readonly awk ${HOME} ${HOME} echo 'quoted text'
+${HOME} -eu -eu export
+		${HOME} -eu then sed "$1" 'quoted text' grep cd "$@" local export |
+$(pwd) export /usr/bin cd /usr/bin awk -eu --verbose "$@" --verbose echo
+		$(pwd) readonly grep test cd $(pwd) "$@"
+grep "$@" $(pwd) -eu printf 'quoted text' $(pwd) grep echo 'quoted text'
+		printf echo export x=1 awk x=1 "$@" awk echo $(pwd) --verbose
+		done -eu "$@" | x=1 "$1" awk -eu awk
+		export done awk cd awk ${HOME} sed $(pwd) /usr/bin then /usr/bin /usr/bin &&
+	test | test sed "$@" && $(pwd) test --verbose then 2>/dev/null /usr/bin /usr/bin
+	grep "$@" $(pwd) && cd awk cd 'quoted text' "$@" && |
+readonly -eu grep grep 'quoted text' readonly -eu cd readonly
+		sed export printf -eu && printf cd done local
+x=1 "$1" cd "$@" printf
+		2>/dev/null then awk export 2>/dev/null /usr/bin /usr/bin local 'quoted text'
+	sed "$1" grep x=1 "$1" ${HOME}
+	test export printf echo printf sed local "$1" test | /usr/bin export "$@"
+		readonly $(pwd) export export export echo grep 'quoted text' grep export
+	test cd printf readonly then
+		'quoted text' && x=1 printf | readonly
+	export cd export "$1" $(pwd) | 2>/dev/null
+	cd 2>/dev/null cd "$@" local
+		test 2>/dev/null export --verbose printf grep echo done test
+	grep grep sed x=1 grep
+export && 'quoted text' done done
+-eu x=1 $(pwd) then readonly echo "$@" awk $(pwd) /usr/bin
+		-eu && /usr/bin readonly $(pwd) /usr/bin "$@" /usr/bin printf "$@" x=1 printf
+		printf test x=1 && sed cd 2>/dev/null
+	x=1 $(pwd) -eu sed sed "$1" local
+		then then awk --verbose
+		2>/dev/null 'quoted text'
+	readonly /usr/bin "$1" sed then 2>/dev/null test readonly &&
+		-eu "$@" x=1 test test awk "$@" 'quoted text' echo done --verbose readonly -eu
+${HOME} test $(pwd) readonly $(pwd) test x=1 /usr/bin test | && cd && readonly
+		awk ${HOME} /usr/bin then 'quoted text' then ${HOME}
+	echo test 'quoted text' grep x=1 /usr/bin grep /usr/bin 2>/dev/null && "$1"
+		export local | cd | ${HOME} /usr/bin readonly -eu
+"$1" done $(pwd) /usr/bin done local awk x=1
+	grep done test test echo 2>/dev/null "$@" awk x=1 "$@" ${HOME} 2>/dev/null
+	| --verbose grep $(pwd) && echo && done
+	&& 2>/dev/null cd /usr/bin readonly "$1"
+then -eu local && test cd | $(pwd) done printf test sed
+		"$1" readonly export echo && done 'quoted text'
+	printf readonly --verbose
+$(pwd) "$@" $(pwd) printf local && grep done test && cd
+-eu $(pwd) -eu ${HOME} | readonly /usr/bin --verbose -eu echo $(pwd) test
+local done 'quoted text' echo --verbose local ${HOME} awk | x=1 --verbose
+		local grep grep ${HOME} cd "$@"
+		| cd sed test 2>/dev/null --verbose local && ${HOME} done grep $(pwd) echo export
+"$@" done then printf readonly --verbose $(pwd) then ${HOME} grep /usr/bin
+-eu then --verbose "$@" 'quoted text' awk cd then
+		readonly --verbose x=1 && --verbose
+done /usr/bin readonly cd | 'quoted text' | echo | --verbose
+		2>/dev/null 2>/dev/null --verbose
+		| x=1 --verbose x=1 echo 2>/dev/null
+/usr/bin sed "$@" test readonly
+| awk "$1" $(pwd) then ${HOME} local x=1 -eu sed ${HOME} && test x=1
+"$@" export then ${HOME} && "$@" 2>/dev/null readonly done local x=1 2>/dev/null
+	${HOME} printf $(pwd) -eu sed | cd then x=1
+| local cd "$@" export
+		then readonly 2>/dev/null readonly awk x=1
+		export printf test "$@" sed awk awk done "$1" awk $(pwd) printf
+	| done --verbose readonly --verbose && sed export
+		x=1 done $(pwd) && | | grep 2>/dev/null "$@" awk cd 'quoted text' export
+		local awk sed ${HOME} "$@" local &&
+local done "$@" readonly readonly export ${HOME}
+	'quoted text' local grep readonly sed 'quoted text' x=1 awk done cd cd
+	awk then ${HOME} awk 'quoted text' grep "$1" | export export "$1" readonly
+--verbose then "$@" "$@" 'quoted text' awk
+		x=1 "$@" x=1 test ${HOME} --verbose sed
+"$1" -eu readonly | $(pwd) echo -eu readonly then readonly
+		test echo -eu 2>/dev/null "$@" grep sed --verbose $(pwd) ${HOME}
+		sed sed grep && | ${HOME} export | cd $(pwd) echo "$@" 'quoted text'
+'quoted text' grep ${HOME} test $(pwd) "$1" | export echo done grep
+	"$@" --verbose 'quoted text' sed x=1 | "$1" readonly && test
+		cd then printf then test readonly /usr/bin
+		export $(pwd) cd 2>/dev/null x=1 "$@" $(pwd) local /usr/bin
+sed --verbose then sed "$1" 'quoted text'
+		then echo test done ${HOME} then -eu then then cd $(pwd) 2>/dev/null
+&& test echo cd -eu readonly
+		grep grep | echo grep --verbose done && done x=1 && x=1
+		/usr/bin x=1 local && 'quoted text'
+$(pwd) $(pwd) echo test test local
+2>/dev/null "$1" -eu export done 2>/dev/null done
+| awk sed awk x=1 test test | test $(pwd) "$1" export cd 'quoted text' &&
+--verbose export awk cd ${HOME} && ${HOME} grep awk awk
+		&& $(pwd) done awk 'quoted text' $(pwd) $(pwd) $(pwd)
+		sed printf awk export 'quoted text' && 2>/dev/null
+sed "$1" local echo test cd printf awk done "$1" awk grep "$@" ${HOME} $(pwd)
+	'quoted text' then --verbose "$@" $(pwd) grep done -eu 'quoted text'
+done then "$1" --verbose --verbose
+awk grep $(pwd) cd grep printf
+		--verbose 2>/dev/null $(pwd) -eu x=1 grep $(pwd) x=1 && && ${HOME} 'quoted text'
+	--verbose test sed cd sed && then test && readonly --verbose
+x=1 'quoted text' done sed awk x=1
+	done /usr/bin "$1" grep 'quoted text' export
+grep x=1 awk cd ${HOME} sed ${HOME} awk cd readonly printf awk test ${HOME}
+	printf && x=1 x=1 -eu sed readonly 'quoted text'
+		sed ${HOME} --verbose readonly "$@" | export readonly sed x=1 /usr/bin printf
+printf $(pwd) cd x=1 echo --verbose x=1 echo sed test 'quoted text'
+	&& readonly done grep && test test --verbose export --verbose readonly
+grep $(pwd) x=1 then x=1 | printf test "$1" awk printf
+export "$@" 'quoted text' then local
+local then test && "$1" 2>/dev/null
+		"$1" awk echo then test local grep printf printf
+		local 2>/dev/null 2>/dev/null awk "$1" "$1"
+		awk $(pwd) && local awk -eu done local x=1 grep cd --verbose cd
+	done | "$@" && readonly test
+	-eu awk /usr/bin local 'quoted text'
+	/usr/bin /usr/bin printf x=1 cd 2>/dev/null 2>/dev/null printf cd x=1 printf 'quoted text'
+		test "$1" x=1 sed $(pwd) sed -eu awk x=1 local | sed 'quoted text' /usr/bin echo
+	/usr/bin cd awk then x=1 test sed
+		| ${HOME} test cd x=1 local echo test -eu 2>/dev/null $(pwd)
+	readonly | ${HOME} 2>/dev/null &&
+		-eu | | | export $(pwd) readonly
+	cd --verbose x=1 sed echo x=1 2>/dev/null
+		export 'quoted text' done awk local x=1 awk echo x=1 echo readonly /usr/bin 2>/dev/null
+		${HOME} ${HOME} ${HOME} --verbose ${HOME} 'quoted text'
+	x=1 "$@" "$1" readonly 2>/dev/null printf -eu readonly
+	--verbose awk grep x=1 /usr/bin
+		| done "$1" 2>/dev/null $(pwd) grep /usr/bin
+	done test awk ${HOME} local local
+		test $(pwd) ${HOME} printf
+'quoted text' cd awk "$1" echo printf done export
+&& then awk /usr/bin --verbose --verbose | grep done export "$@" 'quoted text'
+	readonly then "$1" | -eu --verbose | local -eu 2>/dev/null && | 'quoted text'
+--verbose then readonly local echo ${HOME}
+	echo cd 'quoted text' cd x=1 awk awk -eu echo -eu local -eu
+		| | done then echo awk done --verbose
+		done sed && $(pwd) test awk x=1 x=1 "$1" awk |
+	"$1" x=1 test x=1 sed grep --verbose x=1 && 'quoted text' then grep readonly
+		cd sed cd local test && then "$1" echo ${HOME} echo x=1 2>/dev/null |
+	"$1" "$1" && printf export x=1 "$@" 'quoted text'
+	| local cd local cd | sed "$1" test "$1" $(pwd) | 2>/dev/null && local grep cd
+		readonly test x=1 --verbose done readonly --verbose
+| printf cd readonly test export awk readonly printf 'quoted text'
+	2>/dev/null "$@" echo grep
+		export test export then
+&& cd "$@" | /usr/bin cd local awk "$@" --verbose
+sed /usr/bin then readonly local sed 2>/dev/null --verbose | done grep ${HOME} 2>/dev/null
+--verbose readonly --verbose readonly 'quoted text'
+grep awk "$@" 'quoted text' x=1 done -eu sed grep -eu ${HOME}
+	| && readonly && export 2>/dev/null $(pwd) test awk --verbose awk sed sed "$@"
+--verbose | done local /usr/bin sed local printf | cd -eu then sed sed /usr/bin
+		'quoted text' 2>/dev/null $(pwd)
+		--verbose "$1" echo then echo done export &&
+export /usr/bin sed sed export done done | | echo local --verbose
+cd 'quoted text' done export export | "$@" local /usr/bin
+printf cd x=1 grep cd ${HOME} echo -eu 2>/dev/null done export printf "$@" echo
+&& | 'quoted text' then
+	2>/dev/null awk echo | printf x=1
+	| then 2>/dev/null test 2>/dev/null readonly 2>/dev/null grep /usr/bin echo &&
+${HOME} grep echo readonly "$@" x=1 "$@"
+		printf $(pwd) "$@" sed "$@" awk then cd printf
+		${HOME} x=1 ${HOME} test done "$@" | x=1 --verbose
+	test export sed x=1 test grep sed grep ${HOME} local grep | && then ${HOME}
+printf test /usr/bin /usr/bin sed local
+		local local cd && -eu -eu then test echo --verbose local |
+		printf echo export done export export readonly grep ${HOME}
+	sed x=1 grep x=1 export test cd
+awk local done readonly export && $(pwd) "$1" then 'quoted text' grep then ${HOME}
+done x=1 sed ${HOME} export | "$@" && printf cd && /usr/bin
+		cd && readonly | $(pwd) readonly
+$(pwd) then local $(pwd) | 'quoted text'
+echo --verbose "$@" 2>/dev/null sed 'quoted text' ${HOME} printf awk x=1
+		$(pwd) done sed x=1 test sed
+awk readonly local x=1
+	'quoted text' "$1" 2>/dev/null $(pwd) awk echo done cd grep awk
+		done sed "$1" export readonly
+		"$1" | echo export done
+"$1" local test cd cd cd export $(pwd) x=1 --verbose 2>/dev/null 'quoted text'
+		grep export export -eu done awk readonly $(pwd) local
+		${HOME} x=1 then local then echo 2>/dev/null printf done "$1" awk
+		sed && then test grep x=1 x=1 2>/dev/null ${HOME}
+	awk local "$@" cd printf x=1 then awk awk grep grep x=1 readonly $(pwd) grep
+	"$1" export readonly cd "$1" readonly --verbose 'quoted text' --verbose
+x=1 --verbose cd "$@" export awk
+		local -eu -eu local done "$@" /usr/bin
+		grep && /usr/bin echo 'quoted text' readonly cd readonly 2>/dev/null
+	printf test grep local local
+done then echo --verbose "$1" awk done test
+done awk done grep awk then export x=1
+	-eu | 2>/dev/null printf $(pwd) sed 'quoted text' grep printf $(pwd) echo
+		grep 'quoted text' "$@" && grep ${HOME} ${HOME} cd grep awk sed x=1 readonly
+echo test /usr/bin --verbose local local done && 'quoted text'
+		grep test export x=1 echo awk 2>/dev/null
+		$(pwd) local 2>/dev/null export printf
+		x=1 export && "$@" /usr/bin /usr/bin
+		"$1" done export "$1" ${HOME} export then done 'quoted text'
+	printf grep $(pwd) grep
+	${HOME} done -eu --verbose cd x=1 grep /usr/bin
+done awk ${HOME} readonly
+		'quoted text' | | -eu -eu /usr/bin readonly sed 'quoted text'
+		readonly | echo echo cd test ${HOME} ${HOME}
+/usr/bin 'quoted text' awk x=1 --verbose
+		local 2>/dev/null awk && | | && printf -eu | cd "$1" printf
+		cd printf printf then "$1" --verbose x=1 ${HOME} 'quoted text' -eu $(pwd)
+	printf done --verbose then sed 'quoted text' awk ${HOME} && local "$@"
+readonly && /usr/bin
+"$1" && sed grep cd -eu --verbose 2>/dev/null /usr/bin local
+${HOME} done sed ${HOME} "$1" local
+'quoted text' export "$1" awk local echo echo awk 'quoted text' echo local
+	export 2>/dev/null grep awk "$@" export && export && /usr/bin $(pwd)
+		export -eu $(pwd) --verbose --verbose | "$1" sed 2>/dev/null
+		'quoted text' "$@" && sed 'quoted text'
+	2>/dev/null 2>/dev/null ${HOME}
+grep 2>/dev/null sed "$@" done awk ${HOME} && local echo test export
+	test -eu x=1 'quoted text'
+"$1" done "$@" $(pwd) sed then echo readonly
+"$@" cd 'quoted text' cd grep 2>/dev/null
+'quoted text' 'quoted text' local awk "$1" export
+	"$1" done x=1 "$1" local && "$@" "$1" echo cd echo grep
+echo -eu test 2>/dev/null grep done echo "$1" sed readonly
+$(pwd) $(pwd) "$1" awk grep
+		test sed -eu && local done
+	then $(pwd) cd grep $(pwd) sed && && 2>/dev/null
+		&& && && grep | grep /usr/bin "$1" cd 'quoted text' test cd && --verbose local
+local grep $(pwd) 2>/dev/null readonly grep then $(pwd) cd echo done x=1 printf
+	awk | cd "$@" then $(pwd) --verbose
+	done awk then | -eu test printf test && cd $(pwd) sed | --verbose test "$@" sed
+then "$1" done done && grep "$@" cd ${HOME} $(pwd)
+"$1" printf $(pwd) awk "$1" && "$@"
+export 2>/dev/null x=1 echo then export 2>/dev/null
+	cd "$1" 2>/dev/null x=1 --verbose /usr/bin ${HOME}
+		local then ${HOME} then && grep local 'quoted text'
+| && printf --verbose -eu 'quoted text' grep -eu awk
+	2>/dev/null 2>/dev/null "$1" test sed && sed
+	$(pwd) "$@" 'quoted text'
+local awk | test 'quoted text' printf /usr/bin
+"$1" export "$@" --verbose "$@" ${HOME} export export local echo test awk test |
+		cd cd awk "$@" readonly awk /usr/bin printf cd echo cd /usr/bin x=1 /usr/bin
+	2>/dev/null awk test then sed grep test test "$@" echo test test "$@"
+"$1" -eu sed echo readonly x=1 cd readonly
+		echo export && && 2>/dev/null done "$@" then ${HOME} cd
+	$(pwd) export grep "$@" echo
+sed test && 2>/dev/null readonly 'quoted text' done /usr/bin
+		"$@" export then && -eu local 'quoted text' export | 2>/dev/null
+		sed $(pwd) local test test test | "$@" /usr/bin grep $(pwd)
+		"$@" -eu 'quoted text' ${HOME} test awk 'quoted text' printf && test done
+	"$1" export ${HOME} then 2>/dev/null
+		export ${HOME} test export printf && grep sed export sed "$@" readonly
+'quoted text' test 'quoted text' "$1" $(pwd) x=1 "$1" local echo
+'quoted text' -eu sed grep grep local sed |
+&& readonly && local test test && -eu cd then --verbose ${HOME}
+	sed $(pwd) sed echo cd local then test && $(pwd) sed | cd cd readonly
+local done then $(pwd) sed sed
+awk printf grep | readonly export echo $(pwd) test grep 'quoted text'
+	done x=1 export "$@" printf | done test ${HOME} readonly readonly cd $(pwd)
+		done $(pwd) x=1 local ${HOME} then ${HOME} "$@" --verbose x=1
+	'quoted text' grep "$@" ${HOME} awk "$@" | local readonly awk export
+readonly local 'quoted text' $(pwd)
+	then echo sed readonly --verbose export
+		echo cd export $(pwd) 'quoted text' | $(pwd)
+readonly printf --verbose
+${HOME} done sed $(pwd) -eu printf -eu grep "$@" printf "$@"
+		readonly export /usr/bin | printf printf sed --verbose test done printf test done
+'quoted text' printf -eu awk | && $(pwd) ${HOME} done | grep sed 'quoted text'
+local | 2>/dev/null grep echo grep echo ${HOME} test local -eu
+	-eu grep ${HOME} awk local cd /usr/bin ${HOME} local /usr/bin 2>/dev/null -eu
+	${HOME} readonly readonly "$1" echo | grep then test
+	| local done echo "$@"
+done /usr/bin --verbose 'quoted text' cd cd "$1" awk test awk cd echo /usr/bin /usr/bin
+export sed export -eu -eu cd && then 'quoted text' local
+grep "$1" awk local done done
+	2>/dev/null $(pwd) | sed local test --verbose 2>/dev/null awk "$1" ${HOME} "$1"
+	$(pwd) $(pwd) local then echo
+cd ${HOME} export printf --verbose
+		x=1 cd | 'quoted text' 2>/dev/null echo 'quoted text' | $(pwd) printf echo
+		cd $(pwd) && done then done grep export
+	&& /usr/bin -eu "$1" | done ${HOME} echo cd 2>/dev/null
+		printf "$1" cd grep echo
+		"$@" cd 2>/dev/null test cd && then test $(pwd) ${HOME}
+	&& | x=1 'quoted text' "$@"
+		$(pwd) "$1" | | $(pwd) grep grep cd -eu export /usr/bin | /usr/bin && 'quoted text'
+	sed $(pwd) grep && -eu x=1 cd test --verbose awk --verbose printf && echo printf
+printf local -eu local && grep export local done
+test export --verbose --verbose /usr/bin echo
+	local cd then local test && -eu awk 2>/dev/null ${HOME} /usr/bin local done $(pwd)
+		echo ${HOME} sed export local cd 'quoted text' then readonly /usr/bin sed -eu
+awk ${HOME} $(pwd) $(pwd) echo sed
+		readonly | awk ${HOME}
+		2>/dev/null $(pwd) done "$1" awk $(pwd) export ${HOME}
+		--verbose 2>/dev/null cd "$1" awk awk ${HOME} done export echo sed printf
+| --verbose done -eu cd export printf sed && cd printf sed grep done
+local ${HOME} | | -eu readonly sed "$@" /usr/bin echo printf --verbose x=1
+	cd done x=1 2>/dev/null export test 'quoted text' echo readonly $(pwd)
+		then readonly cd "$@" /usr/bin && | 'quoted text' printf sed sed
+		awk "$@" awk awk --verbose 'quoted text' 2>/dev/null
+		-eu export && then ${HOME} then export "$@"
+	cd grep "$1" -eu cd local export
+	$(pwd) echo /usr/bin local 2>/dev/null x=1 test readonly
+	"$1" 2>/dev/null echo && --verbose && awk sed test
+		-eu grep export 'quoted text' /usr/bin /usr/bin
+		local 2>/dev/null -eu printf
+printf test -eu test export -eu then then 2>/dev/null
+		export "$@" echo | then ${HOME} readonly sed 'quoted text' local
+	done sed && sed cd local then | done local done && 2>/dev/null
+/usr/bin grep sed local local local printf sed | local $(pwd)
+	export ${HOME} --verbose
+		| x=1 grep echo then sed grep 'quoted text' printf 'quoted text' local "$1"
+	/usr/bin test grep local done && --verbose 'quoted text' readonly "$@" 2>/dev/null
+$(pwd) "$@" ${HOME} then readonly awk printf echo -eu readonly export && local
+cd -eu 2>/dev/null "$1" |
+cd test then cd "$1" -eu then echo "$1" -eu test test $(pwd)
+		| $(pwd) -eu "$1" printf "$1" test local awk
+	echo -eu printf $(pwd) x=1 ${HOME} 'quoted text' printf -eu 2>/dev/null
+	&& "$@" printf test grep "$@" | awk echo cd done
+grep $(pwd) export sed done "$1" cd cd && printf /usr/bin
+local | "$@" cd grep 'quoted text' cd $(pwd) x=1 && | | cd ${HOME} printf done
+	local /usr/bin test then ${HOME} done $(pwd) "$1"
+	readonly --verbose x=1 x=1 $(pwd) local printf ${HOME} $(pwd)
+		$(pwd) "$@" local done grep | "$@" -eu done
+sed done 'quoted text' x=1 ${HOME} -eu --verbose
+/usr/bin && -eu export x=1 && -eu awk echo printf /usr/bin export x=1
+	printf ${HOME} local done done
+		&& -eu "$1" awk test local "$1" echo x=1
+-eu 2>/dev/null x=1 "$1" "$@" x=1 printf $(pwd)
+	"$1" local "$1" 'quoted text' export && printf ${HOME} $(pwd) $(pwd) 2>/dev/null
+		sed "$@" x=1 | 2>/dev/null
+	echo 2>/dev/null export local -eu $(pwd) "$1"
+	$(pwd) cd local /usr/bin "$1" awk readonly
+		test "$@" awk 'quoted text' /usr/bin 2>/dev/null -eu
+		cd | 'quoted text' && x=1 local
+sed /usr/bin && test -eu
+	awk 2>/dev/null export local then ${HOME} --verbose grep test
+grep export -eu && export cd
+export && then awk echo done readonly "$1" && grep -eu 2>/dev/null
+		"$@" local echo 2>/dev/null /usr/bin "$1" 2>/dev/null --verbose --verbose
+	${HOME} local test echo local export -eu local cd awk ${HOME} $(pwd)
+local readonly x=1 local sed /usr/bin && 'quoted text'
+	test ${HOME} local printf printf && cd then printf then printf awk then 'quoted text'
+	readonly sed | grep -eu local done export awk --verbose
+	done cd --verbose ${HOME} | echo 2>/dev/null "$@" test awk --verbose
+grep test /usr/bin printf done local done done done ${HOME} grep "$@"
+		test local ${HOME} /usr/bin local 'quoted text'
+		2>/dev/null "$1" "$1" --verbose
+export grep sed "$1" && awk export test local $(pwd) | grep done grep then
+export 2>/dev/null --verbose && grep printf
+printf ${HOME} cd && cd done $(pwd) $(pwd) cd
+cd export awk awk --verbose test printf /usr/bin ${HOME}
+'quoted text' "$@" $(pwd) readonly test
+		cd grep ${HOME} cd cd
+"$@" /usr/bin x=1 ${HOME} "$@" 2>/dev/null
+		$(pwd) x=1 cd local done readonly local printf export printf cd
+cd -eu local printf ${HOME} && cd 'quoted text'
+		"$1" sed then -eu ${HOME}
+		"$1" printf grep sed "$1"
+"$1" /usr/bin -eu 'quoted text' --verbose test grep test readonly | test
+local "$@" done readonly "$@" local test printf awk local
+		then ${HOME} $(pwd) -eu
+${HOME} "$@" then cd awk /usr/bin cd x=1 $(pwd) "$@" $(pwd) echo
+		grep done | sed echo local
+		sed x=1 ${HOME} x=1 -eu ${HOME} |
+		test then && ${HOME} x=1 readonly 2>/dev/null readonly /usr/bin 2>/dev/null
+	${HOME} done $(pwd) echo "$1" awk echo $(pwd)
+		-eu then printf cd sed
+		-eu ${HOME} --verbose
+		2>/dev/null done -eu local echo -eu done /usr/bin
+sed && done local local awk && ${HOME} awk readonly grep test -eu x=1 | /usr/bin
+readonly -eu sed x=1 readonly
+	&& sed --verbose "$1" printf local printf "$1"
+	then printf cd -eu 2>/dev/null && printf readonly --verbose 2>/dev/null 'quoted text'
+readonly "$@" --verbose local -eu export 'quoted text'
+${HOME} printf && ${HOME}
+		grep grep printf echo ${HOME}
+awk ${HOME} "$1" -eu export cd grep test done printf ${HOME} local
+	test -eu printf local --verbose grep "$1" sed ${HOME} grep 2>/dev/null x=1 then
+	| 2>/dev/null "$@" /usr/bin done 2>/dev/null $(pwd)
+done -eu awk "$@" awk 'quoted text' $(pwd) --verbose
+		2>/dev/null ${HOME} echo 2>/dev/null --verbose export --verbose echo
+	x=1 cd x=1 2>/dev/null "$1" --verbose
+	| grep | 'quoted text' && sed x=1 /usr/bin 2>/dev/null ${HOME} printf
+	grep printf ${HOME} "$@" 2>/dev/null /usr/bin
+then --verbose test 2>/dev/null "$1" --verbose then cd export echo
+		'quoted text' /usr/bin
+	readonly -eu printf /usr/bin
+grep export local awk 2>/dev/null -eu x=1 test 2>/dev/null | /usr/bin
+		grep 'quoted text' && $(pwd)
+	| readonly "$1" export grep | | -eu | $(pwd) then
+-eu /usr/bin x=1 test
+		grep grep test local local "$1" grep /usr/bin
+		-eu readonly local test readonly && $(pwd) "$@" readonly
+/usr/bin $(pwd) x=1 $(pwd) x=1 export --verbose && sed
+	"$1" readonly -eu readonly /usr/bin x=1 then then --verbose
+	&& ${HOME} echo ${HOME} done awk grep 2>/dev/null export 'quoted text'
+readonly 'quoted text' test then test --verbose /usr/bin
+		&& 'quoted text' $(pwd) done -eu | awk $(pwd) echo printf sed "$@" readonly
+awk --verbose -eu echo "$1" grep && 2>/dev/null
+awk ${HOME} grep awk 2>/dev/null | printf /usr/bin readonly then cd
+local 'quoted text' && cd done ${HOME}
+--verbose x=1 local printf --verbose sed x=1
+		echo --verbose -eu | done ${HOME} --verbose "$@" printf 2>/dev/null ${HOME} local
+		/usr/bin /usr/bin sed x=1
+		then awk x=1 "$1" "$@" ${HOME}
+		printf export 2>/dev/null --verbose ${HOME} $(pwd) grep echo --verbose
+#include c255.sh
+&& ${HOME} $(pwd) local
+${HOME} ${HOME} x=1 "$@" $(pwd) x=1 --verbose 'quoted text' done
+		readonly /usr/bin sed sed printf
+cd test x=1 done 'quoted text' printf export x=1 $(pwd)
+--verbose | ${HOME} readonly then local "$@" $(pwd) awk "$1"
+	awk | "$@" then then cd && printf 'quoted text' echo sed printf && done && |
+	cd local sed echo cd echo ${HOME} export "$1" $(pwd) test 'quoted text' $(pwd)
+		echo printf readonly awk test echo printf then --verbose test
+	local --verbose sed echo -eu cd "$@" done sed x=1 grep test grep
+		awk sed 2>/dev/null done echo cd
+		| --verbose "$1" sed readonly
+	-eu local && "$1" | | -eu test printf ${HOME}
+	awk 2>/dev/null /usr/bin -eu -eu --verbose local 2>/dev/null -eu export awk
+		&& export | printf echo echo awk -eu ${HOME} local x=1 grep /usr/bin
+| cd ${HOME} grep done grep ${HOME} /usr/bin "$1" echo done -eu ${HOME}
+	$(pwd) echo cd cd $(pwd) 2>/dev/null -eu x=1 printf
+		&& printf 'quoted text' awk cd ${HOME} sed
+	readonly sed x=1 /usr/bin cd ${HOME} /usr/bin grep 2>/dev/null export
+		test awk done 2>/dev/null done grep local grep local sed local
+x=1 grep echo /usr/bin awk /usr/bin
+		test echo sed echo awk then --verbose
+	--verbose sed x=1 "$1" ${HOME} x=1 2>/dev/null --verbose
+		| grep readonly local done ${HOME} "$@" $(pwd)
+	"$@" then cd "$@" --verbose
+		$(pwd) 'quoted text' 2>/dev/null
+readonly --verbose test
+		done --verbose -eu "$1" -eu local
+	grep local && $(pwd) 'quoted text' $(pwd) 'quoted text'
+		--verbose 2>/dev/null /usr/bin && 2>/dev/null awk grep "$@" sed grep done
+export "$@" done ${HOME} "$1" 2>/dev/null grep export echo export && echo ${HOME}
+		"$1" "$1" x=1 -eu "$@" 2>/dev/null cd export grep echo grep
+	"$@" echo readonly done sed "$1" export test
+sed echo x=1 --verbose $(pwd) --verbose ${HOME}
+	local && sed grep awk 'quoted text' echo readonly "$@" /usr/bin x=1 && then awk
+2>/dev/null 'quoted text' -eu /usr/bin
+x=1 then grep /usr/bin local -eu done local
+		awk && awk x=1 2>/dev/null test sed $(pwd) 'quoted text'
+test "$1" x=1 --verbose "$1" "$@" && then 'quoted text'
+	/usr/bin printf /usr/bin cd grep
+		${HOME} -eu ${HOME} /usr/bin --verbose
+	&& ${HOME} done sed ${HOME} $(pwd) ${HOME} printf printf sed
+		sed echo sed sed | sed -eu printf local | x=1 echo grep /usr/bin
+		/usr/bin | "$@" cd cd echo cd --verbose local
+-eu 'quoted text' ${HOME} done "$1"
+	awk readonly awk $(pwd) then | 2>/dev/null
+	2>/dev/null then awk /usr/bin then x=1 "$1" cd test echo ${HOME}
+	'quoted text' -eu | awk
+	echo && grep && -eu local /usr/bin x=1 sed ${HOME} 2>/dev/null
+		-eu echo -eu echo 2>/dev/null export test --verbose awk export
+		-eu --verbose "$1" && sed /usr/bin printf ${HOME}
+		printf --verbose then grep x=1 awk "$1" test x=1 $(pwd) -eu | grep
+	$(pwd) "$@" test echo $(pwd) "$1" && readonly ${HOME} then awk export
+$(pwd) local "$@" printf grep --verbose
+		printf "$@" test "$1" 2>/dev/null
+printf then --verbose printf then /usr/bin
+	${HOME} awk sed grep readonly grep $(pwd) echo echo "$@" x=1 grep local | printf
+then $(pwd) cd --verbose readonly printf "$@" local && echo local
+	test cd echo sed "$1"
+		${HOME} /usr/bin --verbose printf && awk ${HOME}
+test sed readonly 2>/dev/null
+	local printf printf awk awk printf
+		"$1" /usr/bin /usr/bin -eu echo printf then
+		test x=1 /usr/bin /usr/bin echo readonly done x=1 printf
+readonly test grep export grep export export 2>/dev/null sed "$1" cd
+&& test test --verbose 'quoted text'
+"$@" grep ${HOME} "$1" sed --verbose echo --verbose
+	done $(pwd) $(pwd) export --verbose ${HOME} "$@" printf "$@" then export
+		"$@" export && -eu test 'quoted text' "$1" printf "$@" test
+export echo done cd test --verbose awk -eu | -eu sed ${HOME} local /usr/bin
+		sed grep local awk readonly readonly $(pwd) "$@" then | /usr/bin
+		"$@" test echo -eu 2>/dev/null
+awk $(pwd) "$@" awk readonly "$@" local printf --verbose readonly cd
+		local ${HOME} 'quoted text' && x=1 | echo $(pwd) "$@" -eu 'quoted text' printf
+	awk 'quoted text' x=1 echo local
+export /usr/bin test export export readonly
+		"$@" && "$@" $(pwd) /usr/bin
+--verbose readonly -eu
+	x=1 && "$1" cd 'quoted text' export cd && | "$@" export done && ${HOME}
+test 2>/dev/null /usr/bin sed echo "$@" cd then export
+	awk then export awk echo cd
+| -eu then echo x=1 --verbose x=1 awk ${HOME} test test 2>/dev/null x=1
+		'quoted text' $(pwd) printf sed sed readonly
+	readonly printf && local --verbose
+-eu export | && | 2>/dev/null printf grep readonly cd --verbose
+	readonly && then printf printf export -eu local
+done && echo test 'quoted text' --verbose echo cd ${HOME} --verbose
+${HOME} done local "$1" "$@" then | then local export
+echo "$@" "$1" echo readonly export cd test /usr/bin /usr/bin
+2>/dev/null x=1 --verbose 2>/dev/null
+		&& --verbose "$1" readonly
+export 2>/dev/null "$1" x=1 "$@" done
+		&& echo cd test && awk 2>/dev/null local local printf cd --verbose
+	done export echo | $(pwd)
+	&& "$1" readonly x=1 "$1" printf sed "$1" sed
+	&& echo "$1" printf | readonly && x=1 -eu local export sed grep ${HOME}
+then "$1" local grep cd 'quoted text' 'quoted text' -eu test cd test readonly done
+		2>/dev/null "$@" sed test 2>/dev/null
+sed --verbose test printf ${HOME} -eu grep local
+	local "$@" ${HOME} grep /usr/bin
+'quoted text' sed readonly
+		-eu sed 'quoted text'
+	printf 'quoted text' local cd 'quoted text' sed then readonly test done &&
+		printf $(pwd) export readonly then "$1" readonly sed
+		export 'quoted text' export ${HOME} | sed -eu cd && grep
+'quoted text' readonly awk --verbose local awk $(pwd)
+	'quoted text' "$@" $(pwd) done done x=1 $(pwd) cd $(pwd) --verbose
+		-eu then /usr/bin | "$@" test x=1 x=1 awk local awk awk 'quoted text'
+cd && then | 'quoted text' x=1 --verbose grep $(pwd) echo x=1 printf /usr/bin
+		done && 2>/dev/null local /usr/bin $(pwd) x=1 $(pwd) local grep
+	local /usr/bin printf done test 'quoted text' awk ${HOME} "$1"
+		--verbose ${HOME} "$@" 'quoted text' grep --verbose sed export printf ${HOME}
+-eu "$@" echo && local /usr/bin -eu export "$1" printf -eu ${HOME} "$@" "$@"
+2>/dev/null local x=1 x=1 local x=1 x=1 | readonly readonly grep printf
+	printf && "$@" then && 'quoted text' awk sed readonly test readonly cd printf
+		-eu export test -eu grep echo $(pwd) then export ${HOME} "$@" 'quoted text'
+then x=1 && grep local printf export && grep "$@" ${HOME}
+--verbose printf --verbose printf $(pwd) ${HOME}
+		| echo $(pwd) "$@" -eu echo echo done
+	"$@" 'quoted text' 2>/dev/null
+cd x=1 "$@" -eu then "$1" "$1" 'quoted text'
+		sed printf $(pwd) x=1 && | "$1" /usr/bin
+	${HOME} $(pwd) $(pwd)
+		then | $(pwd) 'quoted text' echo x=1 x=1 done "$@" local
+	cd then readonly $(pwd) --verbose x=1 "$@" $(pwd) readonly x=1 done
+export export -eu awk && test cd grep "$1"
+	grep grep awk -eu export cd sed "$1" awk ${HOME} sed done 2>/dev/null x=1 --verbose
+cd 2>/dev/null | /usr/bin && test
+		test cd done then "$1" $(pwd) && cd 'quoted text'
+"$1" && local "$1" -eu | "$@" grep && printf sed
+	cd ${HOME} 2>/dev/null /usr/bin then
+		grep export awk grep "$@"
+cd 2>/dev/null export grep --verbose then /usr/bin | | 2>/dev/null 'quoted text'
+		cd readonly ${HOME} "$@" printf then sed sed grep $(pwd) ${HOME}
+${HOME} 'quoted text' ${HOME} ${HOME} x=1 --verbose export 'quoted text' --verbose
+		/usr/bin $(pwd) -eu --verbose test
+		-eu test export "$@" x=1 cd
+	export 'quoted text' | "$1" "$1" --verbose echo cd 'quoted text'
+		printf x=1 ${HOME} && echo local
+		--verbose readonly $(pwd) local | echo export
+	/usr/bin cd x=1 x=1 $(pwd)
+	awk 'quoted text' -eu --verbose | readonly printf 2>/dev/null local
+local ${HOME} printf -eu "$@" echo printf
+		sed local --verbose "$@" "$1" && "$@" "$@" 'quoted text'
+	&& export "$1" local done
+		echo x=1 ${HOME} && | "$@" local readonly grep --verbose echo echo sed
+		done 'quoted text' local $(pwd) awk 'quoted text'
+		test | sed | then | --verbose
+		readonly ${HOME} grep readonly sed readonly printf echo && then cd 'quoted text'
+&& /usr/bin awk export test 2>/dev/null then | printf printf 'quoted text'
+export done 'quoted text' "$@" test then 2>/dev/null
+"$@" done "$@" cd then echo printf ${HOME}
+	/usr/bin test $(pwd) then ${HOME} x=1 "$@" echo /usr/bin
+	readonly test "$1" "$@" --verbose export
+	&& 'quoted text' ${HOME} /usr/bin ${HOME} "$@" && "$@" export ${HOME} 2>/dev/null
+	&& 2>/dev/null $(pwd) -eu && | 2>/dev/null 2>/dev/null awk test grep
+cd $(pwd) x=1 local && cd sed test readonly "$1" ${HOME} echo 'quoted text' && echo
+	then -eu echo /usr/bin grep 2>/dev/null awk "$@"
+echo $(pwd) --verbose --verbose ${HOME}
+	awk awk 'quoted text' then done 2>/dev/null /usr/bin 2>/dev/null readonly && local
+2>/dev/null ${HOME} ${HOME} printf done 'quoted text' test
+	/usr/bin 'quoted text' -eu then $(pwd) readonly ${HOME} awk sed printf
+done then done grep $(pwd) "$@" then awk cd 'quoted text'
+		2>/dev/null done then readonly "$1"
+	$(pwd) readonly test | done readonly grep printf ${HOME} ${HOME} test
+--verbose -eu 'quoted text' $(pwd) grep
+		export $(pwd) -eu $(pwd) sed -eu $(pwd)
+local 'quoted text' --verbose sed /usr/bin "$@" | local sed done x=1 && "$1"
+&& | --verbose --verbose ${HOME} "$@" local
+	"$1" /usr/bin readonly grep 2>/dev/null test
+		${HOME} | echo | && 'quoted text' local grep "$1" ${HOME} cd done /usr/bin grep
+done "$@" readonly local --verbose
+		awk | "$@" done cd test
+echo readonly printf 2>/dev/null cd cd 'quoted text' |
+	"$1" "$@" 'quoted text' /usr/bin
+echo export sed 'quoted text' grep ${HOME} x=1 sed then sed then ${HOME}
+then 2>/dev/null done done 2>/dev/null awk --verbose "$1" -eu
+		grep -eu printf "$1" awk readonly done done echo grep awk
+	/usr/bin 2>/dev/null echo --verbose "$1" 'quoted text' awk | printf
+&& 2>/dev/null done | cd echo echo --verbose --verbose
+		-eu export local "$@" then x=1 2>/dev/null readonly $(pwd) x=1 export
+		${HOME} && -eu 'quoted text' echo grep "$@" 2>/dev/null
+		x=1 export "$@" test export $(pwd) ${HOME}
+	export local "$1" && test sed readonly $(pwd) done grep
+		done && "$1" awk x=1 "$1" -eu /usr/bin echo $(pwd) 'quoted text' awk cd 2>/dev/null
+${HOME} ${HOME} --verbose cd /usr/bin
+		x=1 done then readonly printf 2>/dev/null echo -eu 2>/dev/null sed local x=1
+readonly /usr/bin 2>/dev/null printf --verbose x=1 sed /usr/bin awk done
+readonly 2>/dev/null 'quoted text' $(pwd) export
+x=1 | -eu x=1 'quoted text' local readonly "$1" --verbose
+"$@" | done awk ${HOME} done | | "$@" local x=1 done $(pwd) grep then &&
+		printf x=1 awk grep echo
+	/usr/bin export /usr/bin then "$1" done --verbose
+echo "$@" sed then grep $(pwd) 2>/dev/null
+export "$1" --verbose && local
+		echo --verbose "$@" -eu ${HOME} x=1 test
+	local awk export grep local && --verbose -eu
+| $(pwd) export awk 2>/dev/null 2>/dev/null test x=1 'quoted text'
+'quoted text' test grep "$1" done "$1" test readonly
+	printf --verbose | --verbose then 2>/dev/null 2>/dev/null printf
+	done | && 'quoted text' awk -eu /usr/bin sed && && "$1" && done echo printf printf
+	echo x=1 ${HOME} 2>/dev/null local local local sed cd sed
+	local awk cd ${HOME} "$1" awk grep x=1 --verbose
+	-eu awk && done done && sed then done
+	export x=1 -eu cd local printf &&
+	$(pwd) awk printf readonly readonly test 'quoted text'
+readonly $(pwd) | -eu "$@" $(pwd) 'quoted text' cd $(pwd) cd
+		$(pwd) ${HOME} awk ${HOME} 'quoted text' cd echo
+cd local -eu local printf "$@"
+		grep "$@" sed done sed done then readonly cd
+	$(pwd) "$@" printf 2>/dev/null echo export printf 2>/dev/null printf
+		/usr/bin ${HOME} ${HOME} local cd "$@" ${HOME} test
+		${HOME} && echo export
+		"$1" "$1" done ${HOME} "$1" && $(pwd) $(pwd)
+		then then | "$@" then echo printf done 'quoted text' x=1
+		local --verbose test /usr/bin done
+	'quoted text' 2>/dev/null $(pwd) --verbose --verbose done "$1" awk local --verbose
+	echo export 2>/dev/null "$@" ${HOME} "$1" readonly ${HOME} printf
+'quoted text' --verbose cd /usr/bin 2>/dev/null && done 'quoted text'
+$(pwd) | readonly sed | local
+		$(pwd) printf then /usr/bin $(pwd) 'quoted text' local
+		local printf 'quoted text' -eu grep export
+grep local /usr/bin $(pwd) "$1" $(pwd)
+grep export then echo --verbose
+		| $(pwd) -eu "$@" export then echo export $(pwd) grep &&
+		then && awk cd $(pwd) sed printf x=1 grep
+	$(pwd) local -eu ${HOME} test $(pwd)
+		test $(pwd) && $(pwd) readonly grep sed awk readonly test && 'quoted text'
+	--verbose --verbose export
+		x=1 printf $(pwd) && grep then | -eu 2>/dev/null
+2>/dev/null "$@" cd printf "$@" done -eu 2>/dev/null
+	'quoted text' "$@" done 2>/dev/null | then -eu x=1 sed /usr/bin cd $(pwd)
+		"$1" printf x=1 done readonly local "$@" done local --verbose cd echo readonly
+		awk "$@" cd awk 2>/dev/null ${HOME} 'quoted text' local 'quoted text'
+readonly echo readonly $(pwd) x=1 | x=1 grep && done x=1 done awk
+	test test /usr/bin then /usr/bin
+	"$1" /usr/bin -eu ${HOME} --verbose
+echo --verbose export awk --verbose ${HOME} echo then "$@" -eu cd test --verbose
+"$1" test /usr/bin "$1" cd 2>/dev/null && readonly then export x=1 printf --verbose
+	printf | 'quoted text' echo sed printf export awk echo | -eu done sed local
+grep cd awk 2>/dev/null echo awk "$1" -eu -eu --verbose 'quoted text'
+		printf "$1" echo awk done printf -eu 2>/dev/null "$@"
+| -eu awk export x=1 'quoted text'
+	x=1 "$1" | "$@" "$@" x=1 && awk "$@" local sed
+done local cd x=1 && then printf
+		${HOME} then 2>/dev/null | then export cd 'quoted text'
+		sed 'quoted text' cd awk local | $(pwd) 2>/dev/null then $(pwd) -eu && x=1 ${HOME}
+	echo test cd /usr/bin "$1" then readonly "$@"
+	${HOME} awk 'quoted text' 'quoted text'
+		"$@" readonly done 2>/dev/null "$1" printf
+		awk 'quoted text' echo
+		2>/dev/null sed && && echo cd
+	&& "$1" readonly --verbose /usr/bin
+		/usr/bin then x=1 -eu sed ${HOME} done local /usr/bin sed
+cd test -eu ${HOME} grep x=1 ${HOME} grep ${HOME} local ${HOME}
+		echo then && local grep echo ${HOME} readonly | ${HOME} echo done 'quoted text'
+		local "$1" cd "$1" /usr/bin /usr/bin awk echo | export
+	/usr/bin 2>/dev/null 2>/dev/null
+-eu done && | && x=1 sed --verbose && | --verbose
+		awk $(pwd) done test /usr/bin grep $(pwd)
+	sed x=1 awk grep ${HOME} -eu --verbose /usr/bin
+	test export && | -eu local && | --verbose local sed x=1 $(pwd)
+	echo then cd $(pwd) awk sed $(pwd) ${HOME} echo 2>/dev/null -eu local "$1" x=1 then
+done /usr/bin $(pwd) x=1 --verbose done local ${HOME} "$@" --verbose ${HOME}
+		cd export readonly echo --verbose "$@"
+	readonly | && local "$1" awk local $(pwd) then grep "$1"
+cd --verbose && | $(pwd) $(pwd)
+awk echo "$1" | printf cd test readonly
+	x=1 echo grep /usr/bin test grep sed then $(pwd) sed
+		local x=1 /usr/bin -eu -eu local
+		-eu sed awk "$1" | | x=1 readonly
+sed && test x=1 readonly
+	local "$1" awk then done x=1 x=1 echo sed awk
+		$(pwd) printf ${HOME} $(pwd) && then
+		test && "$1" awk export 2>/dev/null -eu | && cd $(pwd) test
+	then test awk 'quoted text' /usr/bin --verbose
+		/usr/bin readonly grep grep sed then
+	2>/dev/null 'quoted text' local awk 2>/dev/null done "$@" ${HOME}
+printf | done printf readonly 'quoted text' "$1" x=1 -eu sed "$@" 'quoted text'
+	/usr/bin export | grep "$1" 'quoted text' 'quoted text' /usr/bin
+readonly readonly && echo sed sed
+	done local ${HOME} sed grep sed echo "$1" local
+	test cd sed echo "$1" awk ${HOME} sed ${HOME} local local cd "$1"
+$(pwd) x=1 echo then readonly sed
+"$@" printf -eu x=1 local --verbose done 2>/dev/null | "$@" "$1"
+		$(pwd) test | grep $(pwd) -eu then | sed done
+done && $(pwd) --verbose "$@" 2>/dev/null local $(pwd) export | | 2>/dev/null
+	$(pwd) x=1 printf sed $(pwd) /usr/bin "$1"
+		| 2>/dev/null then test -eu
+		grep cd "$@" 'quoted text'
+		"$@" --verbose test export
+		"$@" x=1 2>/dev/null "$@" 'quoted text'
+&& --verbose local "$@" local test "$1" printf printf test --verbose
+	printf sed "$1" x=1 2>/dev/null x=1 export then 2>/dev/null echo readonly /usr/bin
+	$(pwd) "$@" x=1 echo readonly 'quoted text'
+then "$1" -eu test "$1" --verbose
+	x=1 printf && -eu test $(pwd) then grep printf cd echo then "$1" grep $(pwd)
+		"$1" /usr/bin ${HOME} test export
+		test local ${HOME} echo then "$@" sed done
+		${HOME} done test grep awk 'quoted text' | sed readonly
+| -eu local "$1" test ${HOME} && sed cd 'quoted text' -eu 'quoted text'
+	$(pwd) "$1" --verbose -eu grep awk local $(pwd) "$1"
+	'quoted text' awk sed x=1
+		${HOME} x=1 2>/dev/null test --verbose
+		&& 'quoted text' "$@" readonly | done export --verbose
+		${HOME} 'quoted text' /usr/bin readonly -eu -eu --verbose -eu done done /usr/bin
+		| && test ${HOME} printf /usr/bin readonly 2>/dev/null &&
+	local sed export "$1" readonly
+		then readonly echo "$1" echo sed x=1 awk awk export |
+| cd readonly grep cd
+$(pwd) cd ${HOME} grep done readonly
+		cd $(pwd) test $(pwd) -eu echo printf export ${HOME} $(pwd) x=1 --verbose export
+	${HOME} sed 'quoted text' ${HOME}
+$(pwd) done $(pwd) $(pwd) then 2>/dev/null readonly 2>/dev/null
+awk -eu printf awk test | 'quoted text'
+	done readonly export x=1 export
+	local echo ${HOME} 2>/dev/null | sed "$1" x=1 done
+--verbose && test /usr/bin done --verbose awk ${HOME} done
+		"$1" 'quoted text' -eu | ${HOME} 2>/dev/null
+		local echo readonly "$1"
+		done grep then "$@" awk then done printf 2>/dev/null
+	$(pwd) -eu printf "$@" then echo test /usr/bin ${HOME} readonly
+	| ${HOME} done printf cd --verbose
+	'quoted text' printf export done -eu grep 2>/dev/null local cd echo
+		local x=1 then --verbose && then x=1 | /usr/bin "$@" /usr/bin local 2>/dev/null
+	2>/dev/null x=1 $(pwd) && grep readonly then cd echo export export grep
+	"$@" | "$1" printf ${HOME} echo test 'quoted text'
+		cd 'quoted text' then && /usr/bin export local $(pwd) awk | | echo /usr/bin
+	then /usr/bin && local printf awk test sed "$@" x=1 printf test done /usr/bin
+		2>/dev/null sed 'quoted text' && export ${HOME}
+		readonly "$@" export readonly test
+		&& sed /usr/bin $(pwd) sed
+"$@" readonly local $(pwd) "$@" 2>/dev/null
+	| 'quoted text' awk $(pwd) 2>/dev/null
+	-eu x=1 | sed export | 'quoted text' sed printf x=1 $(pwd) | ${HOME} --verbose
+	2>/dev/null then echo "$@" && readonly x=1 export && /usr/bin | echo | $(pwd)
+		then && export && echo 'quoted text'
+	/usr/bin 'quoted text' 2>/dev/null ${HOME} -eu test --verbose ${HOME}
+		printf 'quoted text' $(pwd) "$1" local 2>/dev/null /usr/bin grep
+		then grep x=1 sed printf test
+	/usr/bin awk local $(pwd) export "$@" sed export --verbose 'quoted text'
+2>/dev/null done grep echo echo test x=1 -eu
+	&& 'quoted text' awk sed
+"$1" -eu cd sed awk export && local test export
+	$(pwd) awk -eu echo x=1 awk | | $(pwd) --verbose /usr/bin done
+		local x=1 'quoted text'
+		readonly test /usr/bin -eu ${HOME} 2>/dev/null
+then "$1" grep 'quoted text' && -eu printf echo done
+		readonly ${HOME} local
+	--verbose $(pwd) test grep done -eu
+	then --verbose echo grep
+	awk cd echo echo done
+	test done --verbose test then
+		--verbose readonly "$1" 2>/dev/null
+grep && then x=1 | 2>/dev/null
+		'quoted text' ${HOME} sed
+		printf cd test sed && --verbose -eu test sed -eu export readonly grep --verbose
+		local /usr/bin --verbose && --verbose readonly && local -eu
+	sed then 'quoted text' | export
+		| "$1" sed echo ${HOME} sed
+	$(pwd) export $(pwd) then echo cd grep export test $(pwd) printf echo "$1" readonly
+		$(pwd) sed --verbose /usr/bin --verbose /usr/bin 2>/dev/null /usr/bin
+		local then echo -eu test /usr/bin
+		awk -eu export echo grep grep 2>/dev/null test /usr/bin
+		test done cd 'quoted text' -eu local printf $(pwd) local printf $(pwd) -eu
+	printf then "$1" ${HOME} printf readonly | export 'quoted text'
+		then 'quoted text' awk sed $(pwd)
+-eu /usr/bin /usr/bin printf
+	x=1 sed done "$1" 2>/dev/null "$1"
+		cd -eu ${HOME} ${HOME} printf | "$@" -eu sed export readonly local "$@" --verbose
+$(pwd) grep 'quoted text' $(pwd) done 'quoted text' test awk 2>/dev/null 2>/dev/null
+		export grep /usr/bin -eu /usr/bin "$1"
+	done $(pwd) ${HOME} echo | | test
+	'quoted text' "$1" 'quoted text' $(pwd) "$@" 'quoted text' done
+	&& then sed $(pwd) grep local /usr/bin sed $(pwd) local then then 'quoted text'
+| done sed "$1" sed 'quoted text'
+	$(pwd) ${HOME} x=1 -eu echo then done sed
+&& $(pwd) && awk && cd printf
+	2>/dev/null printf "$1" -eu readonly
+		-eu printf cd | --verbose grep ${HOME} awk /usr/bin "$1" sed -eu
+	local | sed x=1 x=1 grep
+local printf readonly $(pwd) ${HOME} -eu --verbose x=1 cd "$1" $(pwd)
+	then printf test "$@" sed && 'quoted text' readonly echo
+	"$@" "$1" cd | 'quoted text' | then $(pwd) 2>/dev/null awk
+	sed then x=1 2>/dev/null 'quoted text' export
+		done /usr/bin awk "$@" local -eu --verbose echo readonly test --verbose
+grep /usr/bin 2>/dev/null 2>/dev/null 2>/dev/null readonly cd $(pwd) sed test
+		cd readonly 2>/dev/null "$@" 2>/dev/null "$1" --verbose
+'quoted text' readonly test 2>/dev/null /usr/bin printf $(pwd) grep /usr/bin
+		${HOME} $(pwd) sed export
+		grep x=1 2>/dev/null | --verbose $(pwd)
+readonly grep -eu export -eu then cd "$1" sed done --verbose echo export
+${HOME} printf test && then export /usr/bin
+grep done local /usr/bin awk -eu then
+		&& x=1 -eu --verbose test -eu x=1 grep
+awk "$@" export 2>/dev/null printf
+cd --verbose grep 2>/dev/null 'quoted text'
+"$@" $(pwd) 'quoted text' && sed /usr/bin &&
+		test && 2>/dev/null $(pwd) readonly awk ${HOME} then
+export /usr/bin test x=1 grep cd awk 2>/dev/null test 2>/dev/null | 2>/dev/null
+then && 'quoted text' grep
+"$1" 2>/dev/null --verbose /usr/bin readonly awk export awk
+--verbose grep --verbose ${HOME} then export x=1 readonly "$@" done && ${HOME} /usr/bin
+		export 2>/dev/null printf x=1 readonly
+sed ${HOME} local cd /usr/bin
+| "$1" && 'quoted text' --verbose
+$(pwd) /usr/bin /usr/bin --verbose $(pwd)
+	cd grep x=1 && echo echo "$1"
+grep grep awk /usr/bin --verbose
+		grep | x=1 readonly then done --verbose awk /usr/bin 'quoted text' printf
+'quoted text' && done grep 'quoted text'
+		printf /usr/bin sed /usr/bin local local 'quoted text' --verbose
+		then "$@" x=1 awk export local -eu | && readonly "$@" awk
+	2>/dev/null x=1 readonly
+	| readonly ${HOME} ${HOME} "$1" 2>/dev/null /usr/bin ${HOME}
+		-eu && 2>/dev/null && | "$@" done awk -eu awk
+2>/dev/null /usr/bin /usr/bin "$@"
+	awk "$1" /usr/bin done export grep x=1 echo sed | | --verbose && 2>/dev/null
+	| /usr/bin grep /usr/bin grep "$@"
+		'quoted text' test readonly done 'quoted text'
+cd grep --verbose | local echo 2>/dev/null
+${HOME} $(pwd) && then readonly 2>/dev/null
+		grep 'quoted text' grep ${HOME}
+| $(pwd) --verbose local "$1" x=1
+cd sed x=1 cd readonly | /usr/bin ${HOME} "$@" --verbose && --verbose "$@" echo
+		sed "$@" "$1" local 2>/dev/null -eu 2>/dev/null && echo grep
+		"$1" export sed $(pwd) echo
+--verbose $(pwd) "$1" x=1 --verbose then export -eu echo
+		$(pwd) | 'quoted text' cd && $(pwd)
+| done export -eu && printf
+	sed local | grep sed local echo 'quoted text'
+local /usr/bin --verbose local | awk ${HOME} awk 'quoted text'
+	&& export grep && --verbose cd "$@" 'quoted text' awk 'quoted text' awk ${HOME}
+	export cd local grep ${HOME} grep /usr/bin --verbose sed | "$@" done echo then
+		sed cd test /usr/bin grep && --verbose "$@" 2>/dev/null --verbose
+	readonly -eu && x=1 export
+cd export then done ${HOME}
+then $(pwd) -eu x=1 awk -eu sed 2>/dev/null sed grep export && grep
+		/usr/bin 2>/dev/null then --verbose printf
+	sed export awk --verbose then
+		awk awk local local awk "$@" export
+		test -eu local printf grep export export done export ${HOME}
+		| "$1" -eu export --verbose awk && | grep /usr/bin grep /usr/bin
+		'quoted text' printf export 'quoted text' 'quoted text' export -eu "$@"
+"$@" ${HOME} local local
+cd echo | local grep local "$@" sed awk $(pwd)
+		echo 'quoted text' x=1 awk awk "$1" "$1" export "$1"
+	echo | awk $(pwd) export | 'quoted text'
+		grep --verbose export done export done "$@" -eu grep then /usr/bin
+		test --verbose grep cd readonly echo $(pwd)
+		cd then "$1" $(pwd) /usr/bin
+		'quoted text' $(pwd) 2>/dev/null
+"$@" readonly local cd
+-eu sed "$1" 2>/dev/null | && export local /usr/bin "$1" 'quoted text' "$@"
+		&& | readonly grep /usr/bin test | 2>/dev/null local ${HOME}
+cd ${HOME} echo x=1 sed | then echo echo awk done local "$1" ${HOME} --verbose
+		/usr/bin "$@" local /usr/bin "$1" export 2>/dev/null
+sed sed readonly done | 2>/dev/null ${HOME} --verbose "$1" local grep local
+	done then "$@" awk printf awk | sed export then then
+done x=1 test printf -eu grep $(pwd) cd
+2>/dev/null cd printf /usr/bin done printf done done
+		$(pwd) && readonly 'quoted text' readonly printf awk x=1
+	test && | sed && export $(pwd)
+		printf done grep then echo 2>/dev/null readonly echo -eu local echo |
+test then x=1 ${HOME} ${HOME} ${HOME} sed awk printf local sed 'quoted text'
+		"$@" "$@" | grep "$@" export --verbose "$@" x=1 ${HOME} $(pwd)
+	printf $(pwd) "$@" /usr/bin "$1" && export
+		${HOME} "$@" awk readonly then
+	--verbose cd grep sed
+	awk x=1 printf "$1" done printf
+"$@" local sed grep ${HOME} 'quoted text' sed $(pwd) cd then 'quoted text' readonly
+		| --verbose sed export export test echo && 'quoted text'
+then ${HOME} then $(pwd) printf
+		cd awk | local awk awk /usr/bin $(pwd) -eu $(pwd) done grep 'quoted text' x=1 "$1"
+	"$@" --verbose --verbose echo cd printf $(pwd) cd readonly &&
+		"$@" /usr/bin export "$1" $(pwd) 'quoted text'
+		export then then local printf $(pwd) "$@" ${HOME} export /usr/bin "$@" "$@" readonly
+		grep x=1 then done -eu | "$1" cd 'quoted text' printf readonly sed "$1"
+		"$1" awk readonly ${HOME} 2>/dev/null ${HOME} && $(pwd)
+	printf local printf sed grep echo awk export
+awk -eu export grep "$1" --verbose x=1 printf 2>/dev/null readonly cd
+$(pwd) readonly then /usr/bin then "$1" readonly
+cd echo /usr/bin local export printf | export
+		echo local ${HOME} 'quoted text' readonly done "$@" 'quoted text'
+		'quoted text' 2>/dev/null export test echo ${HOME} printf 'quoted text'
+		"$@" readonly x=1 ${HOME} "$1" $(pwd) local "$1" --verbose awk then grep
+	-eu export done 2>/dev/null --verbose --verbose x=1 grep
+2>/dev/null then done awk && export
+done test /usr/bin readonly | && grep awk 2>/dev/null cd test $(pwd) cd 'quoted text'
+readonly 'quoted text' | && -eu export | awk sed readonly
+	"$1" export echo cd readonly | then "$1" export done local export test
+export 'quoted text' x=1 local awk "$1" done
+| x=1 && test ${HOME} cd /usr/bin && -eu export -eu
+		x=1 echo --verbose && printf
+	x=1 x=1 export local cd echo x=1 export printf local then "$1"
+	${HOME} x=1 | cd "$@" && --verbose then
+	echo && grep echo | sed readonly
+	done $(pwd) echo done printf test done 2>/dev/null "$@"
+	"$@" "$@" cd x=1 sed awk sed ${HOME} sed "$@" "$@" sed then local
+	${HOME} ${HOME} && done &&
+		&& grep "$1" 2>/dev/null export readonly "$@" | --verbose "$1"
+	cd 'quoted text' && grep cd local && 'quoted text'
+		x=1 ${HOME} sed local "$1" printf 'quoted text' then x=1 | grep | -eu echo echo
+		awk "$1" test local --verbose ${HOME} readonly cd ${HOME} then /usr/bin && export
+printf x=1 $(pwd) && --verbose 'quoted text' 'quoted text'
+	$(pwd) -eu echo "$@" x=1 && && | readonly
+		readonly test 2>/dev/null
+		export 2>/dev/null 2>/dev/null then done --verbose && sed "$@" "$@" export
+		${HOME} grep readonly -eu $(pwd) /usr/bin $(pwd) done local
+		test $(pwd) grep "$1" 2>/dev/null test local printf then x=1 "$1"
+$(pwd) $(pwd) echo readonly done 2>/dev/null x=1 grep -eu --verbose
+--verbose 2>/dev/null -eu 'quoted text'
+2>/dev/null ${HOME} /usr/bin cd 'quoted text'
+		$(pwd) done grep 'quoted text' test "$@"
+		cd then readonly --verbose
+	printf then 2>/dev/null "$1" -eu 2>/dev/null export $(pwd)
+	grep x=1 readonly grep x=1 test
+	2>/dev/null then test &&
+	&& echo export printf then x=1 2>/dev/null "$@" printf export -eu
+done 2>/dev/null ${HOME} $(pwd) printf
+		test -eu test $(pwd) x=1 readonly cd "$1"
+		readonly && sed && export | x=1 echo readonly sed && done 2>/dev/null
+		local test && sed ${HOME} && /usr/bin
+readonly sed done export 2>/dev/null cd ${HOME} -eu x=1 /usr/bin
+/usr/bin "$@" then done --verbose
+	'quoted text' x=1 printf --verbose x=1 | done printf | -eu 'quoted text'
+readonly "$@" 2>/dev/null x=1 grep ${HOME} /usr/bin x=1 printf
+		'quoted text' --verbose local 'quoted text' | /usr/bin sed readonly && ${HOME}
+		test /usr/bin && export done awk cd sed
+	"$1" done /usr/bin -eu printf $(pwd) x=1
+local sed local test echo test then --verbose export sed sed &&
+"$@" awk readonly --verbose "$@" awk /usr/bin then local -eu
+	/usr/bin awk done readonly echo /usr/bin readonly "$@" "$@" awk
+		"$@" awk grep local grep
+	printf then x=1 -eu --verbose "$@" ${HOME} --verbose "$@" "$1" printf
+		2>/dev/null test readonly readonly printf --verbose echo && sed done awk -eu -eu
+	'quoted text' grep --verbose export then grep "$@" ${HOME} -eu then test x=1
+		'quoted text' local 2>/dev/null
+	echo /usr/bin local done cd echo echo /usr/bin 'quoted text' -eu && awk "$1" sed
+/usr/bin x=1 /usr/bin "$1" grep && | "$@" awk then local awk done readonly printf
+2>/dev/null 'quoted text' | local "$1" && readonly readonly done --verbose done
+		done /usr/bin cd 2>/dev/null local "$@"
+	grep ${HOME} export done local cd | --verbose
+	cd done ${HOME} test x=1 /usr/bin --verbose
+	printf 'quoted text' grep sed --verbose
+		x=1 cd x=1 printf && "$1" cd cd readonly x=1
+awk | && cd | readonly "$1" | ${HOME} x=1
+echo "$@" export -eu sed local
+	local $(pwd) printf grep ${HOME} sed awk
+export x=1 --verbose local sed echo ${HOME} cd | local readonly test
+done | sed then local echo printf readonly echo sed local sed local
+		"$1" && --verbose echo local "$@" "$@" export | then ${HOME}
+	readonly "$@" "$@" --verbose $(pwd) $(pwd) "$@" "$@" test --verbose 2>/dev/null
+		| cd local 'quoted text' "$1" &&
+	local then export "$1"
+		$(pwd) then "$1" $(pwd) then
+printf then echo local "$1" echo export x=1 printf x=1 'quoted text'
+		x=1 then readonly /usr/bin done -eu && local | test test 'quoted text'
+		printf awk ${HOME} "$1" ${HOME} x=1 --verbose x=1
+x=1 local echo /usr/bin then 2>/dev/null --verbose
+		2>/dev/null 'quoted text' then ${HOME} "$1"
+	grep echo test local && then | && ${HOME} echo local readonly
+	awk readonly awk test echo done
+	x=1 test -eu 'quoted text'
+-eu x=1 export 'quoted text' && $(pwd) sed sed cd done test -eu --verbose
+	cd grep "$@" cd x=1 $(pwd) printf /usr/bin
+	echo 'quoted text' "$@" && grep | grep then 'quoted text'
+cd $(pwd) ${HOME} then sed ${HOME} awk
+		"$@" "$@" export /usr/bin /usr/bin printf
+	'quoted text' ${HOME} sed x=1 local && local awk $(pwd)
+		x=1 $(pwd) 2>/dev/null /usr/bin "$1"
+		grep x=1 awk sed done | readonly
+		&& ${HOME} | test | -eu |
+		readonly $(pwd) -eu cd sed readonly 2>/dev/null 2>/dev/null
+	| && sed printf export readonly
+then $(pwd) done /usr/bin x=1 done --verbose
+	then sed $(pwd) cd ${HOME} then export x=1 "$1" echo export $(pwd)
+-eu local $(pwd) "$@" 'quoted text' awk
+		readonly ${HOME} 'quoted text' --verbose then && && readonly -eu -eu
+2>/dev/null done "$1" export &&
+done && -eu 2>/dev/null x=1 --verbose readonly printf
+'quoted text' then printf 'quoted text' $(pwd) awk done 2>/dev/null done
+		"$@" grep test -eu 'quoted text' cd x=1 readonly | 2>/dev/null "$@" local
+		$(pwd) export -eu x=1 awk then
+	export cd test ${HOME} local then && echo ${HOME}
+		printf test sed x=1 grep export
+		"$1" 2>/dev/null local local | echo export then "$@" then
+		echo awk x=1 | --verbose /usr/bin 2>/dev/null && $(pwd)
+		cd done then readonly && && | printf 2>/dev/null
+	awk echo 'quoted text' sed printf $(pwd) "$1" grep then sed local
+		/usr/bin local 'quoted text' ${HOME} done 2>/dev/null readonly
+export /usr/bin printf /usr/bin | then grep export | 'quoted text'
+	awk grep printf && $(pwd) grep sed /usr/bin awk | --verbose grep
+		--verbose $(pwd) "$1" readonly && grep x=1 | | $(pwd)
+	x=1 'quoted text' 'quoted text' then test ${HOME} "$1" echo
+		test export local "$@" "$1"
+		grep export --verbose sed awk "$@" --verbose
+export echo x=1 then test 2>/dev/null local done --verbose ${HOME} -eu | export
+&& ${HOME} "$@" echo printf awk "$1" "$@" readonly readonly /usr/bin
+'quoted text' --verbose
+${HOME} ${HOME} && awk 'quoted text' sed then
+		| echo ${HOME} | "$@" then sed "$1" readonly export then sed cd then
+		awk then ${HOME} -eu /usr/bin
+		$(pwd) then done $(pwd) |
+	"$1" /usr/bin | "$1" awk test $(pwd) printf sed grep $(pwd) --verbose
+printf done /usr/bin readonly then 'quoted text' echo $(pwd)
+2>/dev/null export "$1" cd "$1" done 'quoted text'
+	"$1" -eu cd grep -eu readonly test then --verbose --verbose sed "$1" grep && "$1"
+		grep export export 'quoted text' $(pwd)
+	done /usr/bin x=1 cd printf grep 'quoted text' printf
+		$(pwd) sed $(pwd) echo done done x=1 readonly
+		2>/dev/null -eu local echo "$1" printf cd 2>/dev/null $(pwd)
+	"$@" 2>/dev/null cd done -eu grep export
+	test grep grep done "$@" x=1 | awk then | cd
+	"$@" grep /usr/bin 2>/dev/null readonly
+	-eu local test ${HOME} awk "$1"
+	then grep echo ${HOME} -eu grep export readonly "$@" 2>/dev/null
+		sed echo "$@" 2>/dev/null x=1 export awk
+		echo "$1" cd "$1" echo && echo test && cd done
+printf echo printf "$@" && then then -eu grep | sed x=1 x=1 $(pwd)
+		${HOME} cd -eu /usr/bin test cd readonly export test awk done printf local $(pwd)
+"$1" ${HOME} /usr/bin
+	local test 'quoted text' grep awk -eu -eu 'quoted text' printf 'quoted text'
+	/usr/bin export export $(pwd)
+		| --verbose sed "$1" sed cd -eu /usr/bin grep test --verbose grep "$1" ${HOME}
+		then then export && readonly --verbose awk local x=1 --verbose
+$(pwd) -eu 'quoted text' | done --verbose awk 2>/dev/null -eu
+		'quoted text' echo && readonly
+test test x=1 /usr/bin grep awk done grep then then readonly then 'quoted text'
+	"$@" $(pwd) && | export
+	2>/dev/null --verbose 'quoted text' 2>/dev/null awk 2>/dev/null
+		"$@" echo then cd /usr/bin ${HOME} --verbose $(pwd)
+	grep $(pwd) ${HOME} --verbose x=1 sed x=1 awk awk echo test then
+	"$@" "$1" && cd 2>/dev/null
+	/usr/bin /usr/bin then readonly $(pwd) --verbose 'quoted text' /usr/bin
+	-eu export ${HOME} $(pwd) 2>/dev/null --verbose
+2>/dev/null "$1" && --verbose done "$1" "$@"
+$(pwd) printf cd done --verbose sed test | grep /usr/bin /usr/bin sed
+		x=1 done export done done done printf
+printf ${HOME} ${HOME} 'quoted text' "$@" readonly
+		cd && export then "$1" readonly readonly readonly
+		sed 2>/dev/null printf && "$@" && local cd -eu x=1 x=1
+		&& "$1" test -eu test --verbose done local
+	grep -eu local readonly sed $(pwd)
+		cd | test grep | awk readonly "$1" 2>/dev/null
+	'quoted text' grep $(pwd) then /usr/bin
+		"$1" | done local x=1 export sed "$1" --verbose printf echo "$@" 2>/dev/null
+		$(pwd) readonly readonly then
+		-eu 'quoted text' && awk grep then printf cd "$@" --verbose && export
+	export test 2>/dev/null --verbose done ${HOME} "$@" export 2>/dev/null cd
+		"$@" --verbose 'quoted text' test local test --verbose local x=1
+export /usr/bin echo -eu 'quoted text'
+	"$1" $(pwd) | -eu --verbose sed cd
+		local x=1 'quoted text' done cd then -eu echo x=1 export readonly printf
+		x=1 grep sed ${HOME} awk ${HOME}
+	then export 2>/dev/null awk "$1"
+&& echo then $(pwd) printf "$1" done done -eu --verbose readonly
+		awk "$1" grep $(pwd) "$@" done /usr/bin ${HOME} awk "$1" awk readonly export "$1"
+		2>/dev/null grep then done export awk cd cd printf | local "$@" && "$1"
+	${HOME} "$1" && --verbose ${HOME} cd /usr/bin grep done
+		2>/dev/null printf local awk
+sed done --verbose "$@" | -eu ${HOME} "$@"
+		echo readonly | /usr/bin /usr/bin "$1" readonly echo --verbose grep local x=1
+	x=1 grep echo --verbose -eu done
+		--verbose -eu --verbose "$1" printf | | | x=1 x=1 sed
+| test --verbose ${HOME} echo printf | $(pwd) sed ${HOME}
+| then x=1 readonly "$1" echo x=1 readonly export
+-eu then "$@" 2>/dev/null | -eu done cd grep "$1" local x=1 ${HOME}
+"$@" /usr/bin /usr/bin 2>/dev/null
+		"$1" "$@" --verbose $(pwd) && | --verbose
+	readonly readonly ${HOME} "$@" 2>/dev/null done
+${HOME} $(pwd) "$1" /usr/bin /usr/bin readonly cd /usr/bin 2>/dev/null
+	"$1" awk export grep "$1" cd -eu 'quoted text' echo
+	--verbose | x=1 2>/dev/null "$1" printf $(pwd) readonly
+	/usr/bin && printf echo -eu -eu readonly then && x=1 ${HOME} /usr/bin
+		printf "$@" --verbose | $(pwd)
+	sed done -eu ${HOME} readonly 'quoted text' echo done 'quoted text'
+printf echo "$@" done "$1" test
+		local 2>/dev/null $(pwd)
+&& "$@" ${HOME} /usr/bin 2>/dev/null 2>/dev/null grep -eu && "$1"
+		/usr/bin --verbose 2>/dev/null $(pwd) /usr/bin $(pwd)
+		local x=1 && "$1" readonly cd awk --verbose
+	awk test | done && 'quoted text' x=1 "$@" /usr/bin then x=1 /usr/bin
+/usr/bin done | export export "$@" --verbose /usr/bin sed readonly local --verbose
+		--verbose "$1" 2>/dev/null 2>/dev/null printf
+		export --verbose grep done sed "$@" -eu export test "$1" awk printf local
+echo then && readonly --verbose sed --verbose "$1"
+		--verbose 'quoted text' cd grep done sed printf 'quoted text' "$@" echo test
+	grep echo /usr/bin then x=1 --verbose
+	cd 'quoted text' export /usr/bin --verbose
+		2>/dev/null ${HOME} 'quoted text' done "$@" ${HOME} "$1" awk export &&
+		local export export done done then
+		cd done echo ${HOME} then "$@"
+printf done cd "$1" 'quoted text' 'quoted text' then "$1"
+printf x=1 grep | && cd local -eu "$1" readonly then
+"$@" awk local 'quoted text' awk done echo test ${HOME} -eu 2>/dev/null | /usr/bin
+	printf /usr/bin x=1 printf $(pwd) "$@"
+		${HOME} -eu test "$@" export 'quoted text'
+done /usr/bin x=1 printf sed test 2>/dev/null cd
+		x=1 -eu then | ${HOME} export
+		x=1 export export printf cd "$@" -eu cd "$@" /usr/bin export
+done sed sed printf /usr/bin 'quoted text'
+then local echo cd && readonly export ${HOME} $(pwd)
+	"$1" echo local /usr/bin echo printf grep awk local
+		/usr/bin ${HOME} export "$1" grep cd 'quoted text'
+	-eu -eu done /usr/bin "$@" sed awk && -eu sed echo "$1" /usr/bin
+		'quoted text' /usr/bin local export | printf
+	${HOME} cd awk export 'quoted text' && /usr/bin echo 'quoted text'
+$(pwd) then --verbose ${HOME} export --verbose
+		--verbose cd | export --verbose cd awk --verbose
+		"$1" | then readonly 'quoted text'
+		readonly && grep "$1" ${HOME} $(pwd) -eu test printf printf echo cd
+		export local ${HOME} echo 2>/dev/null "$1" awk local test
+	2>/dev/null && "$1" export sed test sed export sed | -eu
+		then /usr/bin done export
+		local export /usr/bin && 2>/dev/null export grep --verbose | /usr/bin readonly
+echo ${HOME} then 'quoted text' awk
+	--verbose test local $(pwd) x=1 2>/dev/null 'quoted text'
+	grep $(pwd) sed "$@" then sed | 'quoted text' awk "$1" grep sed then $(pwd) && -eu
+	x=1 sed "$@" printf grep -eu 'quoted text'
+	2>/dev/null cd | echo ${HOME} 'quoted text' 'quoted text' "$@" grep
+		cd $(pwd) echo printf test && cd test && | echo test && local cd "$1" --verbose
+printf ${HOME} | readonly test awk "$@" ${HOME} grep x=1 $(pwd) local done
+		$(pwd) readonly | then then --verbose
+		| $(pwd) x=1 awk test --verbose done ${HOME} | --verbose
+		-eu sed && /usr/bin sed printf x=1 awk
+		local awk | ${HOME} sed && --verbose printf then "$1"
+		readonly && -eu then done test awk sed $(pwd) -eu x=1
+		-eu "$@" 2>/dev/null ${HOME}
+	done 2>/dev/null 'quoted text' test "$1" local |
+	--verbose 2>/dev/null printf local sed then | 'quoted text'
+		"$@" "$@" echo printf ${HOME} printf test readonly "$@" -eu
+done printf grep echo /usr/bin | 'quoted text' --verbose
+		printf ${HOME} readonly local test awk cd
+	x=1 done printf $(pwd) then readonly
+	grep 2>/dev/null grep export
+		$(pwd) printf grep then local sed "$1" --verbose --verbose
+		| | --verbose test --verbose test cd x=1 | done
+cd 2>/dev/null 2>/dev/null then x=1 && "$@" sed /usr/bin --verbose
+		local then grep 2>/dev/null
+	done then awk /usr/bin ${HOME}
+		printf echo sed x=1 x=1
+${HOME} 2>/dev/null echo $(pwd) awk local grep then ${HOME} ${HOME} then echo
+then ${HOME} then export 'quoted text' awk then local
+	| $(pwd) readonly 'quoted text' "$@" then
+		-eu cd export done printf printf x=1
+'quoted text' ${HOME} done && -eu readonly test
+		grep export && 2>/dev/null done test done then && awk sed $(pwd) cd
+	test printf 2>/dev/null sed export printf
+	sed x=1 /usr/bin local awk x=1 printf
+$(pwd) | --verbose -eu && "$1" $(pwd) grep echo --verbose
+		2>/dev/null "$@" /usr/bin 'quoted text' -eu /usr/bin ${HOME}
+	| test | x=1 -eu 2>/dev/null &&
+		done "$@" export test sed x=1 ${HOME} cd echo x=1 x=1 test $(pwd) then sed
+	then x=1 -eu x=1 2>/dev/null && grep
+		x=1 then test test awk && "$@" grep 2>/dev/null sed cd && echo --verbose
+grep echo && /usr/bin printf echo 2>/dev/null test -eu "$@" /usr/bin
+$(pwd) grep done "$1" ${HOME} echo ${HOME}
+	readonly "$1" x=1 $(pwd) "$1" "$1" -eu $(pwd)
+	grep -eu "$1" ${HOME} printf awk
+		awk then local export awk
+	$(pwd) 'quoted text' awk 2>/dev/null $(pwd) awk $(pwd) "$1"
+		done sed printf "$1" cd --verbose awk ${HOME} awk grep 'quoted text' then
+	test -eu readonly 'quoted text'
+		${HOME} cd 2>/dev/null done awk | then printf $(pwd)
+x=1 echo 'quoted text' local | then sed
+	| readonly 'quoted text' $(pwd)
+	-eu then "$1" done cd test
+"$@" then && done then 2>/dev/null test printf export local ${HOME}
+--verbose "$@" test then 2>/dev/null test /usr/bin 'quoted text' 2>/dev/null
+/usr/bin done 'quoted text' -eu | then 'quoted text'
+	local | sed local local "$1" 'quoted text' printf then grep $(pwd) export ${HOME}
+	| echo | printf x=1 sed sed "$@" printf cd
+/usr/bin cd test test
+	then done cd then then grep && 2>/dev/null ${HOME} /usr/bin awk ${HOME} sed $(pwd)
+	$(pwd) test && ${HOME} then --verbose grep
+	/usr/bin 'quoted text' sed export && printf "$1"
+--verbose then done local "$1" grep done
+local done then then /usr/bin sed "$@" sed test /usr/bin
+		-eu printf local x=1 | echo 'quoted text'
+		echo sed local && then readonly printf sed
+--verbose $(pwd) $(pwd) ${HOME} grep
+local echo -eu export sed x=1 | printf "$1"
+	cd done $(pwd) $(pwd)
+		| 'quoted text' x=1 test "$@" then export "$1" && /usr/bin done /usr/bin
+	x=1 grep echo x=1 ${HOME} readonly then /usr/bin test "$1" grep sed ${HOME}
+	done test awk then | done
+then awk done printf --verbose local export printf ${HOME}
+		/usr/bin "$@" printf echo
+"$1" echo -eu echo local && "$1" | "$1" | "$@" "$1" && 'quoted text'
+		cd x=1 "$@" x=1 export x=1 grep export echo 'quoted text' done $(pwd) &&
+'quoted text' "$1" done export 'quoted text' /usr/bin grep | 'quoted text' $(pwd)
+-eu cd && test test printf x=1 && local cd test readonly test --verbose
+	| sed printf && | sed /usr/bin $(pwd) -eu ${HOME}
+		/usr/bin grep cd cd "$1" printf grep 'quoted text'
+		-eu --verbose "$@" then
+then | test sed sed local
+		readonly awk $(pwd) export $(pwd) 'quoted text' "$1" | done &&
+		${HOME} test -eu | sed && then 'quoted text' "$1" $(pwd) --verbose
+sed test "$@" "$@" readonly && "$1" x=1 then --verbose local grep x=1 ${HOME} /usr/bin
+export done "$1" awk awk 'quoted text' | x=1 awk /usr/bin
+	printf --verbose && done /usr/bin ${HOME} $(pwd) export
+then done --verbose export ${HOME} /usr/bin 'quoted text'
+grep -eu x=1 echo test echo
+'quoted text' x=1 | x=1 then -eu grep 2>/dev/null "$@" local
+&& "$1" && sed && 2>/dev/null /usr/bin
+	2>/dev/null local "$1" --verbose local "$1" $(pwd)
+	/usr/bin printf echo printf awk printf x=1 printf --verbose ${HOME} -eu echo local
+"$1" "$@" local | --verbose "$1" -eu readonly ${HOME} sed $(pwd) /usr/bin
+		2>/dev/null grep --verbose cd sed readonly then /usr/bin "$@" sed readonly
+--verbose export test printf /usr/bin $(pwd) 'quoted text'
+	done then "$@" && -eu x=1 grep && "$@" /usr/bin
+x=1 printf printf test
+	2>/dev/null sed grep local
+	"$1" $(pwd) local export sed export
+		done cd /usr/bin /usr/bin export --verbose readonly readonly "$@" readonly
+		export x=1 /usr/bin export printf 2>/dev/null readonly "$@" -eu 2>/dev/null
+export local export "$@"
+grep x=1 cd /usr/bin done readonly cd x=1 export "$1"
+| 'quoted text' && x=1 "$@" ${HOME} done ${HOME} 'quoted text'
+$(pwd) ${HOME} 2>/dev/null ${HOME} cd then readonly then cd | 'quoted text'
+	| done -eu "$@" 'quoted text'
+"$@" echo "$1" printf test printf echo 2>/dev/null echo cd --verbose
+		test && x=1 $(pwd) cd test readonly
+		-eu printf printf sed local "$@" echo
+	$(pwd) -eu && cd done /usr/bin "$1" then export && 'quoted text'
+export $(pwd) -eu $(pwd)
+	grep | | done && 'quoted text' printf x=1
+	then export sed done done export done ${HOME} done echo /usr/bin
+	${HOME} 2>/dev/null && test "$@" x=1 readonly awk sed cd x=1 ${HOME}
+		${HOME} done readonly "$@" $(pwd)
+		grep $(pwd) cd test awk printf local
+		2>/dev/null $(pwd) then echo -eu -eu done then x=1
+	&& -eu /usr/bin grep printf --verbose
+	&& /usr/bin echo readonly --verbose
+then x=1 awk printf 2>/dev/null 2>/dev/null
+"$1" | && printf 'quoted text' local export sed awk export printf
+$(pwd) export local 2>/dev/null
+"$1" "$@" then printf --verbose local readonly --verbose 2>/dev/null 2>/dev/null
+		echo -eu sed ${HOME} 2>/dev/null readonly test awk
+/usr/bin 2>/dev/null local "$1" cd && --verbose local cd awk "$@" grep 2>/dev/null
+printf "$@" then ${HOME} $(pwd) grep local
+	x=1 'quoted text' done x=1 $(pwd) "$1" test -eu awk "$@" 'quoted text'
+		-eu sed printf done 2>/dev/null awk readonly sed then then done
+export | "$1" cd ${HOME} test test $(pwd)
+	-eu | local 'quoted text' echo
+		cd | && $(pwd) ${HOME} echo then $(pwd) then && 'quoted text'
+	readonly test ${HOME} "$1" test local then 2>/dev/null
+cd ${HOME} /usr/bin $(pwd) export export
+	test test ${HOME} then | cd x=1 "$@" local && local "$@" sed "$1" printf then
+		x=1 awk x=1 printf 2>/dev/null
+	&& awk $(pwd) local ${HOME} readonly "$1" cd "$@"
+cd grep /usr/bin -eu export
+--verbose 'quoted text' test sed $(pwd) "$1" | echo
+	"$1" && then && 2>/dev/null && "$@" done ${HOME}
+	"$@" $(pwd) awk test --verbose
+local awk --verbose "$1" sed && sed --verbose
+		test 2>/dev/null readonly local "$1" "$1" $(pwd) 'quoted text' "$@" cd then
+&& 'quoted text' 'quoted text' ${HOME}
+sed echo "$1" x=1 $(pwd) "$@" readonly 'quoted text' test readonly
+	sed sed export | local ${HOME} -eu &&
+	"$1" done test ${HOME} then -eu "$@" "$1" 2>/dev/null
+		"$@" 'quoted text' then then done | test printf $(pwd)
+2>/dev/null done grep | cd 2>/dev/null && printf /usr/bin
+$(pwd) export 2>/dev/null awk export && |
+	done local printf "$@" /usr/bin
+	${HOME} test then export readonly awk printf printf printf $(pwd) sed then
+	x=1 local && done awk printf "$1"
+	2>/dev/null ${HOME} && "$@" awk 'quoted text' test then done test x=1
+-eu grep awk x=1 /usr/bin -eu readonly $(pwd) 2>/dev/null readonly --verbose then
+		$(pwd) $(pwd) export echo local local readonly
+		x=1 printf echo test | --verbose export
+		then 2>/dev/null cd sed "$@" grep then x=1 then then ${HOME} cd readonly
+		--verbose echo "$@" cd $(pwd) echo x=1 | done
+/usr/bin awk -eu /usr/bin sed echo readonly
+	cd readonly cd awk ${HOME} done /usr/bin readonly | readonly
+	echo --verbose -eu local local /usr/bin $(pwd) test $(pwd) echo x=1
+		awk export test echo local local && ${HOME} readonly
+	"$1" ${HOME} sed ${HOME}
+		echo -eu readonly export 2>/dev/null "$@"
+		${HOME} test export readonly cd readonly -eu sed done
+		$(pwd) export readonly awk printf export "$1" "$1" "$1" $(pwd) "$@" 'quoted text'
+"$@" ${HOME} sed cd sed
+then && "$@" 2>/dev/null echo echo export echo test $(pwd)
+${HOME} grep "$1" local --verbose done echo
+test echo done ${HOME} grep | done
+printf /usr/bin grep sed "$1" local awk
+	${HOME} 2>/dev/null sed --verbose 2>/dev/null $(pwd) --verbose awk
+		local test readonly 2>/dev/null then cd printf readonly && 'quoted text'
+		test 2>/dev/null $(pwd) test --verbose
+		'quoted text' x=1 && "$1"
+awk "$@" /usr/bin && ${HOME} "$@"
+	done /usr/bin test sed sed readonly x=1 --verbose | "$1" && then
+	/usr/bin 'quoted text'
+	$(pwd) ${HOME} test then -eu printf export export test && --verbose printf
+"$1" x=1 readonly printf | printf export --verbose test --verbose 'quoted text'
+export printf $(pwd) test 'quoted text' test "$1" echo "$@" printf echo x=1 local
+	${HOME} 'quoted text' 2>/dev/null && sed /usr/bin done printf "$1" grep export
+	$(pwd) | printf grep 'quoted text' echo printf | --verbose export x=1 then then
+readonly 'quoted text' | x=1 cd "$@" "$@"
+		--verbose --verbose readonly -eu sed readonly readonly
+'quoted text' echo readonly awk sed "$@" 'quoted text' && ${HOME}
+	| 2>/dev/null echo export 'quoted text' done echo
+${HOME} 2>/dev/null then $(pwd) echo grep && -eu | /usr/bin then printf "$@" printf
+	printf done ${HOME} then export x=1 -eu --verbose /usr/bin ${HOME} "$@"
+	awk | "$1" printf awk ${HOME} done cd | done grep
+$(pwd) "$1" grep | -eu test then grep 2>/dev/null
+then $(pwd) printf x=1 x=1 grep ${HOME} $(pwd) readonly awk -eu readonly x=1
+		grep ${HOME} 'quoted text' "$@" "$@" | echo
+	/usr/bin cd test export
+		cd x=1 cd && awk sed export
+x=1 | local sed && ${HOME} local /usr/bin /usr/bin 2>/dev/null x=1 test cd "$@"
+		printf cd sed local x=1 echo printf awk then | echo 'quoted text' 2>/dev/null
+	sed then sed local "$@" done -eu done --verbose
+	awk "$@" test grep "$1" && local
+"$@" 2>/dev/null sed ${HOME} x=1 cd cd printf sed export awk
+		done 2>/dev/null "$1" echo "$1" $(pwd) echo awk test sed test awk
+-eu && sed export printf ${HOME} test
+cd 2>/dev/null --verbose printf echo && grep -eu cd printf 2>/dev/null readonly
+	grep printf test test export -eu 2>/dev/null
+x=1 local awk "$@" grep ${HOME} awk test
+'quoted text' awk local "$1" 'quoted text' readonly
+		--verbose | cd -eu echo
+	export readonly "$@" sed cd -eu then done && done "$1" && awk awk
+test local cd | export |
+		2>/dev/null x=1 'quoted text' cd sed
+test printf done "$1" awk /usr/bin --verbose $(pwd) -eu sed | ${HOME} && /usr/bin
+	export grep 2>/dev/null 'quoted text' printf "$1" "$1" --verbose "$1" --verbose
+		--verbose echo -eu "$@" echo | echo "$1" 2>/dev/null
+readonly grep ${HOME} --verbose | &&
+"$1" awk printf && export 2>/dev/null awk ${HOME}
+		$(pwd) "$1" x=1 export printf | 'quoted text' then awk /usr/bin
+test $(pwd) awk cd local -eu awk -eu | "$@" 'quoted text'
+	printf -eu awk | echo awk && test done sed readonly --verbose awk
+		--verbose /usr/bin --verbose echo -eu
+		--verbose local "$1" awk cd sed awk $(pwd) echo grep
+		${HOME} then test /usr/bin
+		readonly | done sed ${HOME} readonly export then done grep ${HOME} 2>/dev/null printf
+	${HOME} $(pwd) awk cd
+then printf x=1 ${HOME} ${HOME} 2>/dev/null $(pwd) grep x=1 ${HOME}
+		"$@" && | && ${HOME} printf grep awk | --verbose echo 'quoted text'
+	"$1" /usr/bin awk echo done $(pwd) 'quoted text'
+	awk "$@" grep test | 2>/dev/null test x=1 x=1 /usr/bin local
+${HOME} && /usr/bin "$@" sed ${HOME} "$1" readonly -eu --verbose
+	${HOME} -eu export then done /usr/bin -eu ${HOME} printf "$1" "$1" | /usr/bin
+		--verbose awk export done echo readonly
+-eu 'quoted text' awk printf readonly $(pwd) echo "$@" done
+	--verbose readonly test $(pwd)
+		then /usr/bin /usr/bin "$1" && local $(pwd) grep "$1" readonly then 2>/dev/null
+		x=1 | sed --verbose x=1 test /usr/bin grep
+		| $(pwd) /usr/bin then --verbose then test sed | printf echo echo grep
+	local awk -eu sed local cd -eu $(pwd) /usr/bin /usr/bin && then
+"$1" -eu done then local printf done awk cd cd grep
+	"$1" /usr/bin sed echo 'quoted text'
+	readonly && export echo "$@"
+		"$@" "$@" $(pwd) ${HOME} "$@" 2>/dev/null x=1 --verbose ${HOME} --verbose x=1
+/usr/bin then 'quoted text' -eu --verbose done -eu cd echo
+		done echo --verbose done local
+	grep 2>/dev/null "$1" "$@" $(pwd) | 2>/dev/null x=1 printf local test
+		"$@" 'quoted text' --verbose awk test cd &&
+	local "$1" then then readonly "$@" cd "$1" test echo
+		$(pwd) echo local 2>/dev/null "$@" x=1 -eu 'quoted text' "$@" --verbose
+cd done export echo /usr/bin
+	grep ${HOME} -eu readonly awk
+		grep local && done 'quoted text' then then | then test cd then && --verbose
+		cd 'quoted text' /usr/bin
+done export "$@" cd -eu test export
+awk "$@" ${HOME} export then readonly
+--verbose x=1 test /usr/bin "$@" cd
+		printf /usr/bin cd -eu local cd echo readonly local -eu echo
+	$(pwd) -eu 2>/dev/null printf
+cd export "$1" cd $(pwd) --verbose "$1" export
+awk --verbose export
+	cd "$1" 2>/dev/null x=1 export x=1 local /usr/bin /usr/bin 2>/dev/null
+		export 2>/dev/null test /usr/bin && "$@" local --verbose
+then && test -eu done sed | --verbose ${HOME} 2>/dev/null test
+	local 2>/dev/null sed --verbose 2>/dev/null grep "$1" 2>/dev/null printf
+		grep cd readonly "$1" export ${HOME} grep local grep 2>/dev/null && local local
+	done test test 'quoted text' sed echo export readonly echo --verbose
+		${HOME} "$1" ${HOME} cd test grep readonly readonly && printf cd then
+		done -eu $(pwd) && "$@" export
+cd --verbose x=1 echo local readonly echo echo then x=1 "$@" then "$@" export
+	local then $(pwd) /usr/bin 'quoted text' export
+	-eu | x=1 awk 2>/dev/null x=1 export && 2>/dev/null x=1 && --verbose --verbose
+readonly done sed 'quoted text' /usr/bin --verbose ${HOME}
+		--verbose export x=1 "$@" ${HOME} sed done -eu "$1" grep | x=1 printf $(pwd)
+	local cd echo -eu && "$1"
+"$1" | "$1" sed -eu then $(pwd) sed | $(pwd) local sed printf
+	grep && echo /usr/bin echo 'quoted text' 'quoted text' 2>/dev/null "$1" -eu then
+	${HOME} /usr/bin local awk local sed 2>/dev/null done done /usr/bin printf
+	"$@" then export sed /usr/bin | printf printf cd printf grep readonly sed
+export readonly test "$1" $(pwd) | 'quoted text' test ${HOME} sed -eu
+$(pwd) --verbose /usr/bin readonly "$1" cd printf grep -eu -eu then
+		echo -eu 2>/dev/null 2>/dev/null && "$1" echo &&
+	--verbose sed "$1" -eu | sed test done
+'quoted text' done cd printf --verbose | x=1 x=1 readonly printf readonly 2>/dev/null
+	"$@" --verbose "$@" --verbose cd echo x=1 echo x=1 --verbose
+export --verbose 2>/dev/null printf | $(pwd) grep && readonly
+	printf sed echo && 'quoted text' sed done then cd x=1 sed 'quoted text' && echo
+-eu test -eu ${HOME} echo grep ${HOME} sed "$1" && done --verbose done
+grep local 2>/dev/null sed export "$@" grep echo -eu && printf
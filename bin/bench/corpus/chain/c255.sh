@@ -0,0 +1,2000 @@
+printf echo export local
+		awk 'quoted text' $(pwd) 2>/dev/null awk && awk $(pwd)
+'quoted text' then -eu grep /usr/bin
+		grep 2>/dev/null x=1 awk then && &&
+printf "$@" done done x=1
+		"$1" x=1 awk x=1 ${HOME} --verbose export
+	echo readonly done export test echo then /usr/bin then "$1"
+--verbose export | ${HOME} printf 2>/dev/null "$1" --verbose
+readonly ${HOME} echo echo grep "$1" printf /usr/bin
+| sed ${HOME} $(pwd) test && printf && then 'quoted text'
+	sed "$@" cd readonly then | $(pwd) "$@" | export printf sed --verbose |
+	-eu ${HOME} echo x=1 "$@" sed -eu /usr/bin
+		test then cd cd cd then x=1 | printf /usr/bin /usr/bin grep x=1 --verbose
+2>/dev/null readonly printf | 'quoted text' grep -eu awk | printf
+	test export ${HOME} test awk then && local awk sed "$1" "$@" -eu "$1" done
+		/usr/bin 2>/dev/null 2>/dev/null
+	printf then 2>/dev/null $(pwd)
+		test readonly && local test "$1" && &&
+/usr/bin local 'quoted text' test | "$1" printf
+	sed cd sed local local 'quoted text' --verbose ${HOME} grep
+cd --verbose grep && local && 'quoted text'
+	--verbose --verbose readonly 'quoted text' export "$1" echo then done x=1 "$1"
+export 2>/dev/null sed "$@" 2>/dev/null
+		"$@" x=1 $(pwd) 'quoted text' echo done "$1" -eu /usr/bin 2>/dev/null
+	grep ${HOME} /usr/bin "$@" "$1" sed "$1" test | &&
+	$(pwd) /usr/bin awk sed then -eu "$1" "$@"
+printf then 2>/dev/null "$@" cd "$1" sed | x=1 $(pwd) sed x=1 --verbose
+"$@" then local $(pwd) cd "$@" local ${HOME} local "$1" grep test
+	echo awk done && "$@" "$@" ${HOME} ${HOME} 'quoted text' done done 2>/dev/null
+		local echo $(pwd) "$1" readonly printf cd -eu "$@"
+	local echo --verbose --verbose cd && printf 'quoted text' printf $(pwd)
+		'quoted text' "$@" readonly 'quoted text'
+	then grep ${HOME} cd echo cd done
+		sed export printf -eu echo done test
+	'quoted text' cd printf
+		awk | $(pwd) /usr/bin grep echo echo cd "$1" then 'quoted text'
+		export /usr/bin done | grep
+		| awk done awk cd cd && then $(pwd)
+-eu then local grep local
+	'quoted text' $(pwd) awk readonly
+	cd export echo $(pwd) | grep local "$1" | test echo sed
+$(pwd) --verbose grep cd "$@" 'quoted text'
+		printf local test --verbose "$@" 2>/dev/null 'quoted text' x=1 export done
+	printf 2>/dev/null | --verbose ${HOME}
+	&& grep then grep && && 2>/dev/null 2>/dev/null echo x=1 readonly --verbose ${HOME}
+grep "$1" echo /usr/bin awk printf | printf && grep grep test export $(pwd)
+		awk --verbose "$@" readonly x=1 done readonly cd /usr/bin
+	then test "$@" sed $(pwd) /usr/bin echo awk test local sed local /usr/bin
+	-eu readonly 2>/dev/null printf readonly && 2>/dev/null
+		"$@" grep awk done 2>/dev/null then --verbose local -eu sed done sed
+sed --verbose test sed
+		x=1 -eu grep grep local /usr/bin --verbose
+		grep grep ${HOME} done "$1" 2>/dev/null
+	readonly --verbose | echo export
+	| | local --verbose readonly
+	cd ${HOME} 'quoted text' local local | awk cd awk
+		2>/dev/null /usr/bin then sed awk done $(pwd)
+export echo export 2>/dev/null
+	| 2>/dev/null x=1 'quoted text' 'quoted text'
+test sed echo "$@" --verbose test export
+		"$@" printf export done done cd printf && -eu printf
+--verbose awk grep 2>/dev/null ${HOME} grep awk | "$@" sed
+2>/dev/null then $(pwd) test ${HOME} "$1" export readonly $(pwd) grep
+		"$@" grep "$1" /usr/bin x=1 test $(pwd) grep sed then echo --verbose
+	cd x=1 -eu awk awk test --verbose cd $(pwd) grep done sed ${HOME} printf test readonly
+done x=1 2>/dev/null readonly "$@" readonly cd then 'quoted text' $(pwd) $(pwd)
+		'quoted text' "$1" ${HOME} test sed export 'quoted text'
+	$(pwd) 2>/dev/null 2>/dev/null awk local "$1" done sed cd test done sed then
+"$@" sed cd 2>/dev/null ${HOME} sed test printf "$1" "$@" x=1 done sed
+grep --verbose grep test "$@" local | ${HOME} echo export
+		x=1 done --verbose 'quoted text' | printf 2>/dev/null
+		--verbose test printf echo "$1"
+		$(pwd) cd printf x=1 "$1" ${HOME} export test -eu 'quoted text'
+		local -eu awk cd -eu | 2>/dev/null printf ${HOME} printf 2>/dev/null
+	sed echo grep then $(pwd) cd then /usr/bin
+/usr/bin 'quoted text' then "$@" printf printf printf test $(pwd) --verbose
+	then 2>/dev/null -eu done awk
+	$(pwd) -eu x=1 && && ${HOME} sed "$@" then printf 'quoted text' && 'quoted text'
+	awk "$@" 'quoted text' local then done readonly
+		done | "$@" "$@" | /usr/bin then printf && 'quoted text' ${HOME}
+		"$1" awk then cd /usr/bin then readonly --verbose /usr/bin 2>/dev/null
+${HOME} local | then then done | 2>/dev/null cd export "$1" "$1" 'quoted text'
+		/usr/bin ${HOME} test -eu $(pwd)
+printf --verbose grep readonly "$@" echo | grep "$@" "$1" sed test $(pwd)
+		printf /usr/bin sed /usr/bin | $(pwd) -eu
+		${HOME} sed 'quoted text' awk awk && sed /usr/bin
+	"$1" | readonly then 'quoted text' ${HOME} cd awk 'quoted text'
+	&& x=1 x=1 --verbose readonly grep then "$1" $(pwd) --verbose then
+	$(pwd) grep printf "$@"
+		then x=1 --verbose && /usr/bin | awk 2>/dev/null | echo sed --verbose
+	2>/dev/null then --verbose
+2>/dev/null test 'quoted text' "$1" readonly 2>/dev/null cd sed awk awk
+	grep test export "$@" local readonly x=1 sed "$1" local "$1" | readonly /usr/bin
+		x=1 local && test echo $(pwd)
+		cd "$@" $(pwd) cd $(pwd) echo --verbose -eu $(pwd) local local
+	-eu 'quoted text' /usr/bin test ${HOME} printf ${HOME} && "$@" export
+		sed "$1" x=1 echo sed 2>/dev/null "$@" grep | $(pwd) 2>/dev/null
+	test readonly "$@" ${HOME} 2>/dev/null
+local ${HOME} then cd "$1" && then cd -eu -eu done ${HOME}
+"$1" test "$1" readonly readonly
+	test done test && -eu readonly ${HOME} then printf
+		printf 'quoted text' export "$1" done done "$1" echo local test
+		&& /usr/bin "$@" printf then "$1" grep "$@" cd ${HOME} then ${HOME} &&
+		2>/dev/null grep x=1 2>/dev/null 2>/dev/null printf test
+	printf done done --verbose 2>/dev/null | export $(pwd) -eu -eu && echo
+		then -eu $(pwd) export sed readonly awk
+	| 'quoted text' 'quoted text' --verbose echo awk /usr/bin sed export --verbose
+/usr/bin printf "$@" && --verbose |
+		${HOME} x=1 test | export
+	x=1 cd printf done done local
+2>/dev/null local readonly && $(pwd) done --verbose then readonly | $(pwd) ${HOME}
+		"$1" readonly | "$1" | ${HOME} /usr/bin
+		awk awk awk ${HOME} 2>/dev/null local grep -eu | cd -eu echo printf local
+	readonly readonly --verbose grep 'quoted text' x=1 /usr/bin
+	${HOME} "$@" export /usr/bin then 2>/dev/null 2>/dev/null
+	export awk local $(pwd) grep test 'quoted text' | $(pwd) 'quoted text' | echo
+	then -eu cd export "$1"
+		done printf && cd then --verbose printf then done awk sed cd && /usr/bin readonly
+	then done grep /usr/bin --verbose 'quoted text'
+	export --verbose /usr/bin
+		then x=1 local 2>/dev/null "$1"
+		"$@" done $(pwd) 2>/dev/null sed export
+	'quoted text' "$1" then $(pwd) local done readonly
+	"$1" ${HOME} -eu x=1 printf
+	&& echo | 'quoted text' grep &&
+	test -eu -eu -eu grep cd grep then | && local "$@" awk /usr/bin
+	&& -eu x=1 $(pwd) -eu sed | printf /usr/bin
+		| "$1" "$@" readonly awk ${HOME} cd echo ${HOME} test 2>/dev/null
+		"$@" awk readonly ${HOME}
+--verbose export && sed --verbose readonly
+		"$1" /usr/bin $(pwd) | cd "$1" awk echo "$@" --verbose
+		awk sed --verbose 2>/dev/null cd ${HOME} 2>/dev/null
+x=1 echo "$@" sed echo |
+"$@" 2>/dev/null -eu $(pwd) -eu /usr/bin done "$@" --verbose
+-eu 2>/dev/null "$1" awk cd 'quoted text' "$@" sed -eu awk
+	x=1 awk echo done sed --verbose 'quoted text' grep printf && export -eu 'quoted text'
+	$(pwd) echo /usr/bin | 2>/dev/null grep -eu | --verbose
+		&& sed 'quoted text' cd /usr/bin then "$1" printf local sed
+		readonly test 'quoted text' grep
+	then "$1" readonly "$1" awk awk "$1"
+"$1" local export && test printf cd cd printf
+		/usr/bin "$@" sed grep sed "$1" 2>/dev/null awk done "$@" x=1 readonly 'quoted text'
+		-eu awk sed echo "$1" grep 2>/dev/null -eu cd 'quoted text'
+readonly --verbose grep -eu local x=1
+		&& then x=1 awk && export sed printf $(pwd) readonly done
+done then x=1 sed | grep printf done
+		'quoted text' readonly $(pwd) "$1" export then | 'quoted text'
+	printf | export test cd local sed local then export ${HOME}
+	awk readonly $(pwd) && awk "$@" cd readonly then
+		"$1" sed ${HOME} /usr/bin $(pwd) "$1" export grep echo x=1 then --verbose
+		printf grep | awk && 2>/dev/null
+		grep ${HOME} grep | "$1" /usr/bin 2>/dev/null local test
+$(pwd) then local printf awk $(pwd) ${HOME} ${HOME}
+	sed then readonly | export 'quoted text'
+'quoted text' sed "$1" export printf $(pwd)
+	then /usr/bin | grep readonly x=1 -eu awk --verbose then | "$@" x=1 'quoted text'
+	local x=1 2>/dev/null local sed printf "$1" 2>/dev/null
+		printf 'quoted text' then done test /usr/bin
+	printf then sed -eu readonly /usr/bin then "$@" export /usr/bin readonly local
+	| x=1 awk printf done cd test $(pwd) | local x=1 grep ${HOME}
+		readonly sed printf sed /usr/bin "$@" 'quoted text'
+2>/dev/null awk sed 2>/dev/null 'quoted text'
+	x=1 awk 2>/dev/null | test grep x=1
+		--verbose awk /usr/bin sed awk
+	&& test test -eu printf export | grep grep
+	-eu x=1 printf /usr/bin 2>/dev/null readonly 2>/dev/null
+${HOME} done grep /usr/bin awk $(pwd) readonly grep local grep
+		then readonly local | $(pwd) 'quoted text' /usr/bin
+		awk export --verbose export | && $(pwd) echo 2>/dev/null 'quoted text'
+	'quoted text' --verbose echo "$@"
+		"$1" awk /usr/bin local && --verbose printf sed awk 2>/dev/null x=1
+		x=1 test printf && -eu
+		"$1" ${HOME} | export "$@" | &&
+&& 'quoted text' readonly
+awk && printf grep cd test readonly ${HOME} -eu "$@" "$@" grep awk --verbose
+	"$1" grep readonly "$@" "$@" $(pwd) local
+		grep then /usr/bin 'quoted text' export done sed $(pwd) && export && 'quoted text'
+	grep grep -eu cd awk $(pwd) "$@" "$@" export test &&
+grep 'quoted text' ${HOME} x=1 x=1 then test cd 'quoted text' readonly
+	export done awk -eu x=1 export /usr/bin
+local echo test ${HOME} cd done
+		export $(pwd) export test x=1 && ${HOME} local &&
+		export --verbose /usr/bin
+"$1" 2>/dev/null grep sed awk sed $(pwd) 2>/dev/null
+		"$1" done 2>/dev/null test | /usr/bin ${HOME} "$@" -eu /usr/bin export x=1
+grep 'quoted text' test export sed ${HOME} readonly readonly export then test
+$(pwd) echo 2>/dev/null
+	${HOME} "$@" "$1" export echo then sed | printf readonly "$@" 2>/dev/null
+	$(pwd) awk "$@" ${HOME} done && -eu printf
+	grep echo test && test $(pwd)
+		local --verbose printf x=1 && readonly grep && ${HOME} "$1"
+awk && sed printf "$@" test "$1" awk then echo 'quoted text' local
+		sed ${HOME} then x=1 readonly then cd awk x=1 cd && done grep "$1"
+		test then && /usr/bin echo $(pwd) 2>/dev/null
+then 'quoted text' 2>/dev/null readonly cd ${HOME} grep local then "$@"
+	readonly /usr/bin "$@" done sed | printf printf test ${HOME} awk awk
+	cd test done awk grep
+	"$1" "$@" then 'quoted text' /usr/bin "$1" "$@" -eu "$1" | "$@"
+		grep awk readonly done 'quoted text' readonly awk 'quoted text'
+		"$1" 'quoted text' $(pwd)
+grep | grep x=1 echo export readonly
+		-eu 2>/dev/null done printf "$1" $(pwd) x=1 | test ${HOME}
+readonly sed sed echo x=1 awk | "$1" cd export then 'quoted text' x=1
+		then echo done $(pwd) grep test && 2>/dev/null
+export echo cd && grep "$@" 'quoted text'
+	done readonly cd -eu ${HOME} | ${HOME} cd | readonly done "$@" test $(pwd)
+| /usr/bin awk done grep 2>/dev/null readonly
+	"$1" "$@" local then | | $(pwd) /usr/bin
+		echo | --verbose --verbose
+then then /usr/bin printf
+		x=1 readonly /usr/bin done echo && "$1" cd x=1 export 'quoted text'
+		${HOME} grep -eu "$@" readonly --verbose grep grep -eu $(pwd) awk x=1
+	readonly echo awk readonly export 2>/dev/null grep "$1" 2>/dev/null
+		cd readonly 'quoted text' | --verbose
+"$@" done cd readonly sed $(pwd) awk awk readonly | --verbose test 'quoted text'
+		readonly x=1 /usr/bin sed | --verbose && cd readonly awk export
+printf --verbose | local echo echo
+		awk test ${HOME} awk "$1" x=1 done sed | export x=1 "$1" readonly x=1
+	printf --verbose /usr/bin awk readonly
+		2>/dev/null ${HOME} readonly 2>/dev/null 2>/dev/null
+-eu && printf echo echo ${HOME} printf
+		--verbose done | echo
+sed | ${HOME} local export x=1 sed
+	/usr/bin --verbose ${HOME} "$1" --verbose x=1 local sed /usr/bin test
+	readonly x=1 ${HOME} readonly cd /usr/bin "$1" -eu
+	grep then sed "$1" test grep --verbose awk 2>/dev/null 'quoted text' $(pwd) "$1"
+		"$@" -eu && 'quoted text' x=1 && awk --verbose && awk $(pwd) echo done -eu
+"$1" local ${HOME} | test test x=1 done printf test awk x=1 sed
+		then && echo sed then && test printf cd awk readonly export
+		-eu echo $(pwd) local then then
+		printf sed readonly | 2>/dev/null readonly x=1 export sed --verbose
+	"$1" 2>/dev/null "$@" 'quoted text'
+		cd export sed test sed -eu /usr/bin then -eu "$1"
+	cd 2>/dev/null test "$@" 2>/dev/null 'quoted text'
+		"$@" sed done echo export awk done printf ${HOME} $(pwd) 2>/dev/null
+	&& export "$1" x=1 && sed readonly "$@" done
+	'quoted text' export cd -eu "$@" --verbose
+		then && x=1 'quoted text' awk "$@" printf test sed sed /usr/bin local 'quoted text'
+cd export export /usr/bin awk --verbose done
+	sed export 'quoted text' printf local "$@" ${HOME} export cd ${HOME}
+	'quoted text' awk "$@" ${HOME} done 2>/dev/null ${HOME} export
+	"$@" | cd 'quoted text' export --verbose "$1" ${HOME} readonly sed ${HOME} -eu
+'quoted text' test readonly test awk
+		cd printf done sed local then --verbose && export sed && -eu /usr/bin then
+	"$1" then ${HOME} done ${HOME} 'quoted text' ${HOME} cd ${HOME} x=1
+		export -eu /usr/bin test | echo --verbose
+		then awk echo test grep echo readonly "$@" | readonly 'quoted text'
+	$(pwd) "$1" $(pwd) /usr/bin printf 'quoted text' grep
+printf -eu echo ${HOME} grep $(pwd) then readonly
+sed grep | ${HOME} 2>/dev/null $(pwd) echo x=1 ${HOME} $(pwd)
+	sed then cd 2>/dev/null -eu --verbose | --verbose
+	readonly && $(pwd) cd echo readonly export 'quoted text'
+		grep "$1" $(pwd) "$@" done "$1" sed local cd readonly readonly test
+		export local | printf && local grep done test
+		"$@" printf 'quoted text' $(pwd) ${HOME}
+&& --verbose sed "$@" grep | 2>/dev/null ${HOME} readonly grep awk awk "$@" "$@"
+	2>/dev/null export | then "$1" echo ${HOME} -eu
+then export ${HOME} done x=1 -eu grep
+		--verbose "$1" local local ${HOME} x=1 x=1 $(pwd) test sed | /usr/bin
+		-eu 2>/dev/null -eu printf test sed echo $(pwd)
+printf && readonly done 2>/dev/null "$@" 'quoted text' && --verbose
+		grep echo ${HOME} done then | -eu sed sed /usr/bin sed awk export x=1
+'quoted text' && x=1 x=1 then &&
+		cd echo sed export && then 'quoted text'
+	echo 2>/dev/null done readonly && /usr/bin
+	printf local cd test 2>/dev/null | --verbose test 2>/dev/null readonly echo
+	'quoted text' | | cd awk sed test done | awk sed | grep echo cd | "$1"
+	"$1" | ${HOME} $(pwd) grep export echo then
+$(pwd) test && -eu $(pwd) 'quoted text'
+		sed local "$@" x=1 --verbose printf && printf printf && cd $(pwd)
+		| echo export cd then printf $(pwd) test -eu ${HOME} printf echo echo ${HOME}
+echo | /usr/bin cd done awk --verbose echo 'quoted text' "$1" awk --verbose readonly
+		done "$@" done test cd 2>/dev/null $(pwd)
+		| echo 2>/dev/null awk grep x=1 sed 2>/dev/null | -eu | -eu local
+		grep && | readonly done $(pwd) done
+		&& 'quoted text' $(pwd) echo x=1 2>/dev/null 2>/dev/null
+		local sed x=1 printf awk && "$@" echo
+	done "$@" | then -eu --verbose cd echo
+$(pwd) then $(pwd) local
+		'quoted text' && --verbose sed &&
+		awk 2>/dev/null export cd sed sed done local
+		| printf test cd 'quoted text'
+	export readonly printf echo "$1"
+	--verbose then sed | sed ${HOME} readonly && ${HOME} 2>/dev/null "$1"
+x=1 cd /usr/bin test $(pwd) test cd --verbose local 2>/dev/null ${HOME}
+/usr/bin 2>/dev/null printf printf
+	printf "$@" export sed local 'quoted text' $(pwd) printf /usr/bin 'quoted text'
+	x=1 -eu -eu local /usr/bin grep $(pwd) cd sed
+		readonly ${HOME} grep x=1 sed | awk export -eu echo then ${HOME} printf
+		x=1 cd local echo $(pwd) grep "$1" x=1 'quoted text' | done x=1 cd export done
+	2>/dev/null "$@" ${HOME} awk
+		grep export printf 2>/dev/null
+	then -eu "$1" x=1 echo | awk
+	"$1" x=1 --verbose /usr/bin /usr/bin --verbose test -eu 2>/dev/null |
+		export grep 'quoted text' export
+	"$@" echo readonly 2>/dev/null 'quoted text' echo "$@" sed
+/usr/bin ${HOME} && | local $(pwd)
+"$@" /usr/bin then "$1" --verbose grep "$1" test sed
+	local printf "$1" x=1 grep $(pwd) -eu then x=1 test "$1" sed -eu "$1"
+	sed sed grep echo 'quoted text' | echo local x=1 then local echo cd 'quoted text'
+		&& local "$@" printf x=1 /usr/bin
+		| /usr/bin grep export
+	"$1" cd grep /usr/bin 'quoted text' -eu 2>/dev/null
+cd "$@" -eu /usr/bin --verbose 'quoted text' "$@" | readonly awk echo done -eu
+		"$@" --verbose then && 2>/dev/null awk 'quoted text' x=1 "$@" "$@" grep sed
+--verbose 2>/dev/null done
+		done x=1 -eu awk | ${HOME} printf done --verbose 2>/dev/null
+	export 2>/dev/null echo done readonly $(pwd) | echo export && printf done export
+${HOME} grep --verbose local $(pwd)
+| export ${HOME} sed --verbose sed awk "$1" awk --verbose cd
+	done /usr/bin "$1" 'quoted text' && x=1 "$1" done test readonly --verbose
+done done | sed cd done test
+	--verbose -eu readonly $(pwd) export 'quoted text' done test | readonly /usr/bin
+	--verbose printf --verbose ${HOME} local
+readonly local x=1 echo readonly
+	sed sed local export "$1" readonly local echo export | grep && x=1 $(pwd) test
+'quoted text' printf cd grep
+| 'quoted text' "$1" "$@" $(pwd) printf local cd
+	--verbose readonly readonly echo sed --verbose then 2>/dev/null
+	then 'quoted text' test /usr/bin
+		grep export sed awk 2>/dev/null
+	'quoted text' 2>/dev/null x=1 export done test awk | ${HOME} 2>/dev/null
+	export echo "$@" done | ${HOME} ${HOME} local 2>/dev/null grep
+cd -eu export x=1 --verbose 'quoted text' 'quoted text' export
+printf 'quoted text' --verbose "$1" 'quoted text' | cd 2>/dev/null
+	/usr/bin x=1 echo | local ${HOME}
+local test cd echo printf test x=1 "$1" --verbose local x=1 cd $(pwd)
+x=1 sed 'quoted text' --verbose
+| printf | grep x=1 $(pwd) "$1" local $(pwd) export
+		x=1 && local printf "$1" "$1" echo export
+	x=1 --verbose readonly done ${HOME} sed "$1" 'quoted text' printf | "$1"
+readonly -eu readonly readonly local | then printf readonly done --verbose
+		--verbose then readonly sed
+	"$@" | printf 'quoted text' readonly then local --verbose
+		cd /usr/bin ${HOME} echo "$@" ${HOME} grep printf
+printf "$@" "$@" test local export sed done && then export
+$(pwd) local "$1" ${HOME} x=1 done x=1 /usr/bin -eu readonly
+x=1 awk 'quoted text' "$1" awk && 'quoted text' "$@" local && 'quoted text'
+"$1" ${HOME} cd /usr/bin $(pwd) test sed --verbose 2>/dev/null
+		test 2>/dev/null x=1 awk --verbose "$1" ${HOME} local "$@"
+sed -eu local local $(pwd) grep $(pwd) && grep 'quoted text'
+	echo local "$1" then awk "$1" && export x=1 ${HOME} export
+	done --verbose 2>/dev/null
+	| 2>/dev/null -eu test export done readonly then "$@"
+	done test done | && cd 'quoted text' export printf 'quoted text'
+2>/dev/null 2>/dev/null
+		${HOME} /usr/bin echo awk grep done 'quoted text' -eu 'quoted text'
+	done "$1" $(pwd) printf
+		"$@" echo -eu printf export x=1 $(pwd) grep $(pwd) then | grep awk cd "$@" | done
+'quoted text' x=1 awk
+	test local sed export 'quoted text' test awk ${HOME} awk
+printf /usr/bin grep done ${HOME} "$1" 'quoted text' test local 2>/dev/null
+		&& readonly --verbose export grep awk
+cd grep ${HOME} done local
+		cd echo x=1 /usr/bin -eu --verbose echo x=1 cd "$1" "$@" readonly | /usr/bin
+		awk "$1" printf done test $(pwd) /usr/bin cd 'quoted text'
+	export $(pwd) export --verbose done echo echo && ${HOME} "$@" ${HOME} readonly
+"$1" /usr/bin local $(pwd) "$@" awk /usr/bin "$1" sed 2>/dev/null then sed && 2>/dev/null
+sed $(pwd) /usr/bin grep grep && "$1" grep $(pwd) "$@"
+	--verbose | sed --verbose /usr/bin x=1
+2>/dev/null grep local cd awk test $(pwd) export "$@" test && x=1
+		"$@" --verbose readonly echo --verbose
+		then "$1" ${HOME} -eu /usr/bin && done "$1" echo --verbose grep then -eu
+sed sed /usr/bin local && awk printf 'quoted text' cd x=1 | readonly readonly
+	local test ${HOME} then awk /usr/bin | cd x=1 -eu ${HOME} "$1"
+		"$@" ${HOME} then $(pwd) then | grep grep x=1 --verbose
+2>/dev/null cd 'quoted text' "$1" $(pwd) "$1"
+readonly -eu printf local sed local /usr/bin "$1" cd
+$(pwd) awk cd readonly then local printf export x=1
+then "$1" sed $(pwd) local awk
+		cd /usr/bin "$@" $(pwd) | readonly
+done cd ${HOME} "$@" cd test cd sed echo grep echo local "$@" $(pwd)
+		test ${HOME} && local ${HOME} --verbose
+	/usr/bin && ${HOME} then readonly readonly "$1" done echo done cd "$@" /usr/bin
+		| -eu then echo --verbose test -eu
+grep /usr/bin 2>/dev/null echo test then x=1 -eu "$@" x=1 --verbose awk awk
+	&& "$@" local x=1 printf "$@" x=1 "$1" cd 2>/dev/null done export | awk
+		echo | -eu && "$@" printf export "$@" | readonly
+		done then ${HOME} /usr/bin local test awk grep --verbose printf printf --verbose
+		"$@" && 2>/dev/null echo -eu x=1 "$1" done awk
+grep x=1 local 'quoted text' printf awk awk done --verbose done echo
+&& ${HOME} then export printf 'quoted text' | echo "$@" sed
+	2>/dev/null | done -eu ${HOME} sed 2>/dev/null
+		x=1 && | awk echo "$@" $(pwd) && sed &&
+	then export local 2>/dev/null sed x=1 local grep "$@" awk awk /usr/bin done
+	awk x=1 /usr/bin | "$1" -eu
+"$@" cd "$1" awk "$1" local 'quoted text'
+		-eu export echo cd sed "$1" cd grep
+	| --verbose | --verbose then x=1 awk
+${HOME} $(pwd) 2>/dev/null -eu "$1" printf x=1 grep then
+		printf -eu 2>/dev/null |
+/usr/bin done readonly ${HOME} 2>/dev/null printf && 'quoted text'
+		"$@" cd --verbose readonly $(pwd) awk | 'quoted text' ${HOME}
+	"$1" local printf sed "$1"
+2>/dev/null x=1 export -eu "$1" then sed then export ${HOME} grep export
+	sed 2>/dev/null sed --verbose
+	-eu export awk 2>/dev/null -eu export "$@" "$1" 'quoted text'
+		/usr/bin "$1" 2>/dev/null "$1" then ${HOME} "$1"
+	${HOME} ${HOME} x=1 echo ${HOME} x=1 sed local 2>/dev/null sed
+		${HOME} readonly grep export test --verbose
+		$(pwd) local ${HOME} x=1 printf awk echo cd sed && test awk -eu
+		awk $(pwd) /usr/bin export 2>/dev/null | printf ${HOME} awk
+		test 'quoted text' printf export export echo then readonly --verbose | test
+		echo grep 'quoted text' "$@" x=1 "$1" 2>/dev/null
+${HOME} readonly readonly echo test
+	done awk 2>/dev/null awk "$1" $(pwd) && 2>/dev/null "$@" x=1 sed $(pwd)
+grep 'quoted text' printf 'quoted text'
+'quoted text' test readonly local | grep cd x=1 "$1" -eu
+		export $(pwd) "$@" done echo $(pwd)
+cd -eu readonly /usr/bin
+| -eu 'quoted text' $(pwd) | ${HOME} readonly -eu local "$@" sed test
+sed /usr/bin 2>/dev/null
+	x=1 /usr/bin && "$@" | readonly 'quoted text' x=1 echo
+	${HOME} sed cd --verbose cd ${HOME} /usr/bin echo
+		"$@" 2>/dev/null local -eu grep $(pwd) --verbose
+		'quoted text' readonly $(pwd) readonly -eu -eu x=1 2>/dev/null cd "$@" then
+-eu test 2>/dev/null x=1 --verbose
+awk "$@" grep echo | then
+		--verbose echo "$1" grep readonly ${HOME} "$@" | echo
+		export grep && "$1" local --verbose ${HOME}
+cd readonly grep then awk grep
+	test && cd "$@" /usr/bin x=1 then sed $(pwd) $(pwd) x=1 "$@" echo 2>/dev/null
+	export | grep && printf "$@" echo
+$(pwd) readonly $(pwd) 'quoted text' $(pwd) test -eu
+x=1 "$@" ${HOME} cd sed sed $(pwd) && $(pwd) -eu awk "$1"
+then -eu -eu cd sed readonly awk sed sed readonly /usr/bin readonly
+	local x=1 -eu x=1 'quoted text' test "$@" sed -eu
+echo test "$1" "$1" awk then && local readonly x=1 grep grep
+	2>/dev/null done ${HOME} x=1 readonly test ${HOME} 'quoted text'
+		/usr/bin test export $(pwd) && -eu test -eu
+		then "$@" sed | ${HOME} export
+sed grep x=1 test --verbose printf printf
+	cd --verbose done | | grep local grep 2>/dev/null echo /usr/bin cd echo
+		test /usr/bin -eu | done $(pwd) printf printf x=1 $(pwd) ${HOME} |
+	'quoted text' then export echo test export echo local --verbose && | done local
+		'quoted text' $(pwd) cd then | readonly
+		| grep cd 2>/dev/null grep |
+		awk x=1 then sed | -eu /usr/bin export cd echo
+&& then $(pwd) ${HOME} awk 'quoted text'
+awk --verbose --verbose local local test /usr/bin then export export sed
+		local printf --verbose "$@" /usr/bin x=1
+		done x=1 | "$1" cd cd done sed local
+test --verbose readonly "$1"
+2>/dev/null 2>/dev/null && grep /usr/bin
+x=1 -eu local "$1" -eu readonly
+	grep /usr/bin awk x=1 /usr/bin $(pwd) $(pwd) 2>/dev/null
+done readonly awk "$@" x=1 then 2>/dev/null -eu 'quoted text'
+		export echo done sed -eu
+	${HOME} cd -eu /usr/bin "$1" 2>/dev/null
+	done readonly awk /usr/bin --verbose grep grep --verbose && && ${HOME} then
+	"$@" export $(pwd) | "$1" ${HOME} "$@" x=1 $(pwd) | grep && printf test
+		${HOME} -eu x=1 local printf grep -eu && awk test && "$@" sed && done done export
+	-eu 2>/dev/null cd sed readonly awk awk cd ${HOME} --verbose | ${HOME}
+done test echo test /usr/bin printf | grep
+		-eu "$1" --verbose $(pwd) export
+done printf "$@" x=1 --verbose then
+	x=1 x=1 | --verbose && -eu
+	done -eu done | ${HOME} -eu /usr/bin grep grep
+		echo export | --verbose x=1
+		cd 'quoted text' | sed -eu printf test 2>/dev/null
+		| awk | then awk "$@" local 'quoted text'
+	"$@" 2>/dev/null then "$1" $(pwd) test
+		$(pwd) 2>/dev/null -eu --verbose echo done -eu then
+2>/dev/null -eu ${HOME} printf 'quoted text' local done --verbose local x=1
+	readonly echo then $(pwd)
+	awk grep ${HOME} awk 2>/dev/null --verbose grep printf x=1
+echo cd test sed ${HOME} printf $(pwd) | 2>/dev/null
+echo "$@" test done cd ${HOME}
+		awk | -eu ${HOME} ${HOME} test sed "$1" -eu "$@" | awk done grep
+| echo "$@" printf done printf 2>/dev/null printf then ${HOME} then
+2>/dev/null && done readonly 2>/dev/null
+		| 'quoted text' 'quoted text' $(pwd) $(pwd) sed cd printf
+local local then then export printf sed "$1" /usr/bin
+grep export --verbose sed 2>/dev/null readonly /usr/bin readonly done
+		x=1 awk echo 2>/dev/null
+grep awk echo export ${HOME} echo echo export cd
+	2>/dev/null cd "$@" ${HOME} 'quoted text' x=1 $(pwd) local x=1 cd sed /usr/bin
+	export local cd 'quoted text' /usr/bin /usr/bin sed grep
+then local awk test readonly 2>/dev/null $(pwd) test x=1 cd echo "$@" sed x=1
+	/usr/bin test done "$@" sed echo ${HOME} export then ${HOME} then readonly
+then grep "$1" grep | cd
+	&& "$@" cd then local then
+		readonly local then "$1" x=1 && grep
+readonly ${HOME} | export 2>/dev/null
+		/usr/bin -eu $(pwd) 'quoted text'
+| $(pwd) awk x=1 cd export then awk "$@" "$@" ${HOME} done sed local
+		readonly echo readonly 2>/dev/null | awk --verbose | grep sed "$@" echo local
+2>/dev/null done test x=1 /usr/bin && grep then then 2>/dev/null test
+	local $(pwd) done "$@" then
+-eu -eu done x=1 | $(pwd) 'quoted text' cd && "$@" printf
+awk x=1 done 2>/dev/null --verbose /usr/bin done && awk
+		"$@" /usr/bin "$@" /usr/bin | "$1" 2>/dev/null
+		local --verbose then "$1" readonly local
+	2>/dev/null done /usr/bin
+		"$@" done 'quoted text'
+	"$@" export $(pwd) 2>/dev/null $(pwd) test | readonly -eu cd x=1 |
+echo -eu test local x=1 /usr/bin readonly readonly echo
+echo | "$@" 2>/dev/null && then local /usr/bin
+	sed "$@" 'quoted text' /usr/bin
+2>/dev/null 'quoted text' sed ${HOME} ${HOME} test 'quoted text' --verbose
+		$(pwd) "$1" cd readonly x=1 "$@" ${HOME} local
+awk grep "$@" grep $(pwd) test test $(pwd) ${HOME} "$1" && done sed grep
+		$(pwd) printf grep done | | awk awk /usr/bin cd echo printf cd test /usr/bin
+| 'quoted text' "$1" readonly $(pwd) local 2>/dev/null test --verbose 'quoted text'
+-eu | local $(pwd) echo --verbose "$1" cd x=1 $(pwd) sed x=1 done
+awk test done sed test test -eu awk -eu cd "$1" "$1" "$@" /usr/bin 'quoted text'
+		test "$1" local sed local then sed ${HOME} done
+test test "$@" sed ${HOME} test --verbose
+	test --verbose && cd 'quoted text' --verbose 'quoted text' $(pwd) "$1" -eu | x=1
+	/usr/bin export done printf && awk $(pwd) awk "$@" && "$1" awk readonly
+readonly x=1 done awk x=1 | ${HOME} sed 2>/dev/null export 'quoted text'
+	$(pwd) test awk then local 'quoted text' test ${HOME} && sed then
+		x=1 /usr/bin 2>/dev/null && x=1
+		echo -eu | export 2>/dev/null echo 'quoted text' 'quoted text'
+x=1 | export printf grep -eu local "$@" && && done done cd | && sed done
+	"$@" --verbose cd cd readonly 'quoted text' 2>/dev/null grep && export
+	cd then readonly awk sed
+sed sed then local done local done x=1 grep "$1" then -eu
+grep local export 2>/dev/null test
+		'quoted text' --verbose -eu && 'quoted text' echo x=1 then
+	printf && echo $(pwd) echo 'quoted text' test /usr/bin sed
+"$@" echo && awk x=1 readonly && 2>/dev/null grep ${HOME} | $(pwd) &&
+--verbose printf test awk -eu -eu $(pwd) test
+$(pwd) readonly then done local
+	$(pwd) echo "$1" cd x=1 export export awk
+		readonly printf -eu printf --verbose cd awk -eu -eu | sed "$@"
+		/usr/bin grep -eu && $(pwd) --verbose then --verbose 2>/dev/null
+&& awk printf export 2>/dev/null local readonly
+x=1 sed x=1 "$@" test then awk 'quoted text' --verbose echo
+	-eu export printf 2>/dev/null ${HOME} 2>/dev/null ${HOME} grep
+awk --verbose echo echo "$@" grep
+		done ${HOME} done test 2>/dev/null --verbose
+		--verbose cd x=1 printf "$1" grep ${HOME} | test readonly && && printf
+	&& then x=1 'quoted text' | | 2>/dev/null 'quoted text' "$@" 'quoted text'
+		local done echo export grep && printf "$1" cd -eu cd x=1 awk awk printf
+test ${HOME} test x=1 local sed printf export -eu sed awk awk
+		2>/dev/null --verbose "$1" $(pwd) awk -eu
+	done awk cd "$1" echo 'quoted text' awk export "$@" | local
+local 'quoted text' awk --verbose 'quoted text' done x=1 sed 2>/dev/null
+2>/dev/null 'quoted text' /usr/bin
+grep --verbose export sed cd readonly "$1" 'quoted text'
+		/usr/bin && done "$@" "$1" && $(pwd) && local then printf test
+		then export 'quoted text'
+	2>/dev/null && --verbose 2>/dev/null --verbose | "$@" sed | done
+	x=1 && "$1" $(pwd) $(pwd) | local readonly /usr/bin test awk $(pwd)
+	x=1 printf printf printf 2>/dev/null
+		"$1" --verbose then /usr/bin readonly && readonly local 'quoted text'
+	test -eu 2>/dev/null printf -eu export | && echo printf
+	-eu 'quoted text' local sed done && export /usr/bin ${HOME} | test | ${HOME} sed
+cd x=1 local grep /usr/bin $(pwd) readonly echo readonly "$1" "$1" $(pwd)
+awk "$1" 'quoted text' export readonly --verbose $(pwd)
+"$@" ${HOME} && | printf grep sed done echo | test echo
+	sed readonly readonly $(pwd) $(pwd) awk x=1 --verbose 2>/dev/null
+"$1" | done sed && awk local then local cd | test cd sed done then done
+cd && readonly --verbose 'quoted text' ${HOME} -eu "$@"
+	readonly -eu x=1 $(pwd) /usr/bin done local sed --verbose
+		awk 'quoted text' | 2>/dev/null
+		/usr/bin local sed 'quoted text' | /usr/bin awk sed export x=1 awk export awk
+		printf readonly local && done readonly readonly -eu && ${HOME} sed printf 'quoted text'
+-eu /usr/bin && grep done "$1" export
+		&& grep /usr/bin -eu test cd
+	2>/dev/null echo test readonly test "$@" test -eu test -eu export -eu
+		readonly then | export --verbose
+echo --verbose local echo awk | readonly 'quoted text' && then printf &&
+export echo -eu --verbose 'quoted text' then cd echo
+		grep local cd echo $(pwd) "$1" --verbose cd sed readonly printf
+	"$1" -eu readonly awk printf local
+	done $(pwd) readonly test 'quoted text'
+		test sed "$@" 2>/dev/null readonly
+	printf -eu sed readonly -eu | grep local export
+x=1 cd "$1" && /usr/bin done
+		printf done printf | readonly 2>/dev/null && done
+	awk printf "$1" /usr/bin done x=1 /usr/bin "$1" done then
+	test cd --verbose grep /usr/bin sed x=1 readonly then /usr/bin ${HOME}
+sed | --verbose && awk ${HOME}
+printf /usr/bin | && ${HOME} && && printf printf &&
+	cd sed local "$1" then export
+done "$1" "$1" export 2>/dev/null && grep then cd echo 'quoted text' local
+/usr/bin "$@" /usr/bin ${HOME} sed 'quoted text' | 2>/dev/null
+	printf grep "$1" test -eu sed grep
+local ${HOME} 2>/dev/null grep export $(pwd) ${HOME} printf awk /usr/bin grep &&
+awk | "$1" 2>/dev/null /usr/bin && grep local | x=1 done -eu --verbose awk sed
+		2>/dev/null 2>/dev/null printf | readonly "$1" --verbose printf sed "$@"
+		${HOME} && x=1 test ${HOME} sed printf &&
+grep test "$1" echo && && then then | "$1" sed printf | &&
+		"$@" && cd echo && /usr/bin awk awk x=1 $(pwd) grep 2>/dev/null done then cd "$@"
+done printf $(pwd) echo -eu
+local $(pwd) grep then --verbose echo grep x=1 readonly done awk then
+		${HOME} cd local $(pwd) -eu ${HOME} "$@" export
+		"$@" 2>/dev/null readonly "$@" grep test -eu -eu | "$1" --verbose $(pwd)
+readonly printf test "$1" | export awk done cd "$@" ${HOME}
+		${HOME} ${HOME} echo printf | grep local $(pwd)
+	awk export export sed printf "$@" -eu ${HOME} ${HOME}
+		echo done awk | awk -eu 2>/dev/null
+$(pwd) && 2>/dev/null local then "$@" /usr/bin x=1 sed "$1" echo 'quoted text'
+		grep 2>/dev/null 'quoted text' export sed ${HOME} local echo done export --verbose
+		-eu export sed then $(pwd) printf | cd export test test
+		test local export cd printf cd sed test $(pwd) /usr/bin x=1 /usr/bin
+		"$1" /usr/bin printf awk cd test sed grep grep -eu done --verbose
+&& echo "$1" | ${HOME} 2>/dev/null
+local awk grep sed export done printf printf 'quoted text' "$1" awk local
+	cd then then echo /usr/bin done $(pwd) 2>/dev/null -eu
+&& ${HOME} sed 2>/dev/null readonly then done test local | "$1" export 'quoted text'
+		awk | 'quoted text' && test test
+		local local ${HOME} done /usr/bin test $(pwd) $(pwd) grep $(pwd) local
+		--verbose /usr/bin grep 2>/dev/null test
+	grep echo printf && readonly ${HOME} awk then 'quoted text'
+&& ${HOME} test x=1 printf then done local local -eu 'quoted text' "$1"
+| awk export readonly then && | ${HOME} sed echo
+		${HOME} test awk done "$@" ${HOME} readonly --verbose export echo 'quoted text'
+	$(pwd) done export -eu --verbose ${HOME} echo readonly test readonly 'quoted text'
+	readonly x=1 test -eu then
+		printf | then grep "$1" then readonly echo cd ${HOME} $(pwd) done test sed
+	/usr/bin 2>/dev/null ${HOME} then "$1" -eu export | local local awk
+		--verbose ${HOME} cd 'quoted text' local
+	&& printf test export done -eu 'quoted text' -eu echo
+	readonly | ${HOME} sed readonly done
+	then local x=1 --verbose export 2>/dev/null printf "$1"
+	echo 2>/dev/null x=1 then -eu cd
+	then sed readonly test "$1" "$1" then 'quoted text' && /usr/bin
+		"$1" export echo --verbose "$1" export then x=1 x=1 sed && printf
+		export sed readonly awk then awk --verbose awk local --verbose
+	/usr/bin readonly -eu sed sed printf sed ${HOME} sed local readonly "$@" --verbose
+	$(pwd) "$1" ${HOME} printf readonly then ${HOME} | test readonly 2>/dev/null done
+	"$@" printf sed sed 2>/dev/null
+		done /usr/bin /usr/bin && -eu x=1 echo cd sed done printf sed
+cd && -eu printf export ${HOME} test /usr/bin export && printf /usr/bin
+x=1 then readonly -eu echo /usr/bin | printf awk test --verbose cd /usr/bin "$@"
+		--verbose && awk 2>/dev/null awk && done
+"$@" && && && test x=1 | echo $(pwd) export
+		done done $(pwd) done 2>/dev/null 'quoted text' "$@" 'quoted text' --verbose
+/usr/bin echo /usr/bin printf test local local
+	echo "$@" grep $(pwd) awk ${HOME} grep
+		"$1" awk export cd echo grep sed done $(pwd)
+		${HOME} awk | printf done -eu "$1"
+export cd 'quoted text' 2>/dev/null done test "$1" sed /usr/bin grep
+	export printf test -eu 'quoted text' "$1" x=1 -eu -eu "$1" | "$@" | cd -eu --verbose
+		sed then --verbose ${HOME} "$@" awk then 2>/dev/null readonly
+echo echo readonly --verbose "$1" ${HOME} ${HOME} done
+x=1 ${HOME} export 2>/dev/null 'quoted text'
+${HOME} "$@" $(pwd) then 'quoted text' readonly sed done ${HOME} "$@" x=1 /usr/bin
+export x=1 $(pwd) printf 2>/dev/null printf /usr/bin "$@"
+	readonly "$@" /usr/bin 'quoted text' then ${HOME} -eu "$@" | "$@"
+	echo -eu $(pwd) $(pwd) local | | "$1" awk "$1" -eu grep ${HOME}
+		&& test printf then "$1" done sed ${HOME} sed cd x=1 x=1 && printf | then | export
+		&& && echo 'quoted text' --verbose then -eu test -eu /usr/bin grep readonly
+	--verbose readonly x=1 $(pwd) | cd "$@" 'quoted text' 2>/dev/null
+	printf cd --verbose --verbose $(pwd) readonly --verbose export /usr/bin --verbose
+		| $(pwd) ${HOME} cd --verbose cd done "$@" awk $(pwd) local export cd
+	/usr/bin echo 2>/dev/null export | local "$1" 2>/dev/null
+	grep --verbose grep /usr/bin x=1 | | "$@" -eu grep "$1"
+${HOME} 2>/dev/null x=1 $(pwd) /usr/bin then 'quoted text'
+	sed ${HOME} printf 'quoted text' sed 2>/dev/null
+		"$@" --verbose $(pwd) $(pwd) -eu sed --verbose export local
+x=1 done --verbose $(pwd) 2>/dev/null readonly 2>/dev/null
+then 'quoted text' awk echo done done 'quoted text' |
+		-eu ${HOME} && done $(pwd) 2>/dev/null
+		grep | --verbose sed sed /usr/bin 'quoted text' readonly local 'quoted text'
+		export 2>/dev/null --verbose done cd -eu x=1 echo grep echo 2>/dev/null
+		$(pwd) "$1" sed export export test x=1 2>/dev/null "$@"
+	${HOME} --verbose cd "$1" done && test &&
+		"$1" cd echo | | --verbose
+	x=1 export -eu then /usr/bin x=1 readonly && /usr/bin cd grep /usr/bin ${HOME}
+	export "$1" test "$@" awk export echo cd 2>/dev/null "$1" x=1 ${HOME} "$1" "$1"
+		"$@" echo sed $(pwd) |
+then --verbose "$@" -eu done "$@" readonly --verbose /usr/bin ${HOME}
+readonly ${HOME} /usr/bin cd export cd
+	--verbose grep $(pwd) then test ${HOME} | readonly "$@" done then readonly "$1"
+		sed ${HOME} grep && grep ${HOME} readonly awk cd "$@" $(pwd) readonly 'quoted text'
+		$(pwd) printf 'quoted text' -eu printf sed "$@" export ${HOME}
+then grep then /usr/bin readonly local printf printf && x=1 done
+	"$@" awk local ${HOME} $(pwd) sed done 2>/dev/null
+	local && /usr/bin | ${HOME} 'quoted text' export local | 2>/dev/null
+done done sed x=1 /usr/bin "$1"
+	&& sed x=1 grep x=1 cd -eu /usr/bin
+/usr/bin export local echo cd printf
+		cd $(pwd) done printf
+	sed local 2>/dev/null cd echo sed --verbose then sed --verbose "$1"
+x=1 /usr/bin done --verbose 'quoted text'
+		"$1" "$1" "$1" readonly ${HOME} --verbose
+	'quoted text' printf | 'quoted text' grep x=1 /usr/bin
+	done 'quoted text' /usr/bin grep readonly 2>/dev/null /usr/bin cd "$1" test --verbose
+	sed test readonly --verbose --verbose /usr/bin -eu "$1"
+		$(pwd) /usr/bin x=1 export local test "$1" 2>/dev/null 2>/dev/null --verbose
+		then /usr/bin then printf 2>/dev/null cd x=1 local 'quoted text' sed test
+	&& | 2>/dev/null | -eu "$@" "$@" printf
+cd grep readonly done /usr/bin ${HOME} echo cd $(pwd) "$@"
+-eu && readonly test 2>/dev/null
+printf $(pwd) awk $(pwd) local test done /usr/bin
+		done $(pwd) printf grep local $(pwd) sed
+	/usr/bin test echo "$1" export x=1 local grep "$@" 'quoted text' -eu
+	2>/dev/null --verbose export echo && test readonly $(pwd) export
+readonly 'quoted text' sed test test | done "$@" && 'quoted text' readonly
+	&& done echo -eu | "$1" "$@" then "$@" $(pwd) $(pwd) cd 2>/dev/null
+	readonly 2>/dev/null awk | $(pwd) "$@" local x=1 -eu sed
+	/usr/bin cd 2>/dev/null --verbose awk /usr/bin /usr/bin
+${HOME} done "$1" | "$1" $(pwd) grep 2>/dev/null ${HOME} echo export
+awk grep test grep grep sed echo | | readonly
+x=1 "$1" 'quoted text' x=1 then cd local
+	readonly printf test then "$@" grep 2>/dev/null
+	'quoted text' "$1" test local done
+	2>/dev/null readonly ${HOME} 'quoted text' local ${HOME} /usr/bin
+		cd local cd printf echo printf printf then
+	export sed cd --verbose ${HOME} --verbose
+	/usr/bin -eu local printf awk local awk
+then "$@" cd printf then 2>/dev/null --verbose /usr/bin
+	local grep $(pwd) $(pwd) /usr/bin cd export
+	"$@" grep 'quoted text' x=1 grep -eu
+${HOME} | export cd then x=1 "$1" readonly awk $(pwd) printf awk
+echo && readonly local done 2>/dev/null
+cd "$1" done done 2>/dev/null
+	'quoted text' readonly 2>/dev/null x=1 "$1" ${HOME} printf -eu --verbose
+"$1" | awk | ${HOME} $(pwd) awk x=1 done x=1 local 2>/dev/null ${HOME}
+		then cd export then test "$1" "$@" local echo "$@" 2>/dev/null grep $(pwd) "$@"
+		${HOME} export grep test
+echo 'quoted text' local test
+	"$1" export then 2>/dev/null x=1 x=1 'quoted text' local then &&
+		test done local "$1" then --verbose x=1 | local /usr/bin
+		sed local readonly && "$@" 'quoted text' cd "$@" "$1"
+		"$@" && --verbose && then export then "$1"
+/usr/bin /usr/bin "$@" awk readonly readonly
+	local --verbose && echo then grep test | readonly cd export
+	x=1 grep | awk done --verbose
+export sed --verbose x=1 printf echo x=1 --verbose x=1 done
+		done local 2>/dev/null local readonly
+readonly 2>/dev/null 2>/dev/null awk export &&
+		--verbose sed | -eu export sed awk --verbose |
+		readonly grep then 'quoted text' 'quoted text' && "$1" test
+	$(pwd) $(pwd) 2>/dev/null awk grep echo /usr/bin echo local
+		local export grep ${HOME} test done readonly && test
+		-eu then cd x=1 && && local
+		echo --verbose sed "$1" "$1" grep ${HOME} then echo -eu --verbose readonly
+	${HOME} test -eu | grep grep -eu ${HOME} test echo
+then "$1" echo --verbose echo /usr/bin 'quoted text' "$@"
+${HOME} printf $(pwd) cd export x=1 && ${HOME}
+/usr/bin cd "$1" 2>/dev/null
+"$@" done grep cd done "$1" echo test x=1 /usr/bin export "$@" "$@" cd "$1"
+		awk awk --verbose 2>/dev/null && 2>/dev/null
+		grep $(pwd) readonly awk done "$1" done test 2>/dev/null
+x=1 printf then export test cd test printf $(pwd)
+/usr/bin ${HOME} grep readonly -eu export "$@" then
+	/usr/bin "$1" cd 2>/dev/null
+	-eu echo x=1 -eu cd cd readonly
+		${HOME} grep && "$1" test
+done $(pwd) export && ${HOME} "$@" test echo test grep sed /usr/bin
+		x=1 2>/dev/null readonly printf 'quoted text' 2>/dev/null && $(pwd) 'quoted text'
+/usr/bin --verbose local readonly && "$@" grep "$@" 'quoted text' -eu
+		"$@" export -eu /usr/bin readonly
+awk export sed | $(pwd) export 2>/dev/null printf x=1 | /usr/bin
+		export && local "$@" done $(pwd) test done grep echo readonly /usr/bin
+2>/dev/null ${HOME} grep readonly
+&& grep 'quoted text' --verbose
+	done | printf printf x=1 ${HOME} test --verbose "$1" "$1" export
+x=1 "$@" "$1" --verbose /usr/bin "$@"
+		printf 2>/dev/null --verbose && test
+	$(pwd) export local | test /usr/bin 'quoted text' sed grep local sed export
+	2>/dev/null done "$1" printf
+-eu test grep done test $(pwd) echo | echo cd -eu printf
+--verbose | | | grep echo "$1" awk ${HOME} "$@" "$1" cd echo 'quoted text'
+"$1" "$@" && x=1 done | printf
+		cd ${HOME} readonly test
+done "$@" /usr/bin x=1 && local export printf "$1" echo sed export 'quoted text'
+'quoted text' then && cd then test | $(pwd) $(pwd) local
+		grep cd 'quoted text' | local | && export | sed
+	test x=1 test /usr/bin cd | 2>/dev/null $(pwd) test readonly /usr/bin
+	readonly readonly 2>/dev/null ${HOME} | && --verbose printf
+		/usr/bin $(pwd) cd sed then /usr/bin $(pwd) done local 2>/dev/null
+test echo && sed -eu --verbose --verbose readonly ${HOME} "$@" x=1
+	readonly "$1" awk then ${HOME} 'quoted text' test printf printf grep ${HOME} printf
+readonly $(pwd) readonly x=1 -eu then echo | 'quoted text'
+		--verbose test grep -eu 2>/dev/null test then
+		then 2>/dev/null done local | && then cd ${HOME} cd $(pwd)
+	export --verbose export printf | done ${HOME} x=1 "$1" grep ${HOME} grep $(pwd)
+		&& echo 'quoted text' --verbose echo awk sed local grep
+--verbose then "$1" --verbose /usr/bin cd && cd | 2>/dev/null
+	'quoted text' cd then /usr/bin | awk done &&
+"$1" done sed local "$1" -eu local local then grep awk cd sed readonly x=1 sed
+	--verbose local printf awk test $(pwd) export echo 'quoted text'
+| echo test cd --verbose awk | done
+		awk "$1" export printf grep x=1 readonly
+		readonly x=1 export done done | --verbose readonly "$@" echo --verbose
+		2>/dev/null ${HOME} export done -eu
+	--verbose printf "$@" x=1 grep --verbose -eu | cd | test then sed grep
+printf | "$@" "$1" printf 'quoted text' readonly echo
+readonly cd done printf grep grep x=1 awk 'quoted text' sed
+	done -eu readonly done "$@" grep cd "$@" export
+sed printf awk printf 2>/dev/null
+		-eu grep --verbose done then awk test "$1" awk done /usr/bin done test --verbose
+	cd readonly cd then done 2>/dev/null readonly test printf sed echo 'quoted text'
+then readonly local x=1 --verbose cd cd sed test x=1 ${HOME} grep --verbose
+readonly test grep "$@" printf echo then x=1 x=1 x=1 export export
+done "$@" then --verbose readonly done cd sed -eu 2>/dev/null
+		x=1 test 'quoted text' ${HOME}
+	export sed && printf x=1 printf x=1 echo /usr/bin 'quoted text'
+		2>/dev/null -eu /usr/bin | readonly -eu cd ${HOME}
+	"$1" then 2>/dev/null -eu 2>/dev/null cd cd --verbose test readonly cd cd
+/usr/bin sed ${HOME} then local "$@" grep /usr/bin sed done
+		export 'quoted text' "$1" echo &&
+	echo done 2>/dev/null awk awk local cd sed "$1" 2>/dev/null $(pwd)
+	/usr/bin readonly awk then printf sed sed done 2>/dev/null
+${HOME} "$1" readonly local
+	| then cd then ${HOME} x=1 x=1 && "$1" awk ${HOME} ${HOME}
+"$@" "$1" then | -eu ${HOME} -eu /usr/bin printf "$1" -eu done "$1"
+| printf grep && /usr/bin x=1
+	"$@" done 'quoted text' 'quoted text'
+		echo echo --verbose ${HOME} then && sed readonly -eu test then --verbose -eu
+		&& local 2>/dev/null ${HOME} readonly "$1" | test then grep && grep "$@"
+		cd printf 2>/dev/null local && -eu $(pwd) 2>/dev/null /usr/bin
+		done "$1" "$1" 2>/dev/null
+		--verbose cd awk readonly "$1" && grep done "$@" x=1 'quoted text' then awk
+		x=1 -eu done readonly 'quoted text'
+echo --verbose --verbose ${HOME} readonly
+	sed 2>/dev/null echo --verbose ${HOME}
+	"$1" grep readonly sed "$1" test done | 2>/dev/null &&
+		awk "$@" && test echo --verbose 'quoted text'
+	&& cd export -eu --verbose "$@"
+		&& /usr/bin | "$1" /usr/bin | -eu local done printf printf "$@" done ${HOME}
+| && awk /usr/bin && 'quoted text' done then
+		-eu cd printf | -eu local 'quoted text' printf
+		readonly $(pwd) /usr/bin $(pwd) $(pwd) /usr/bin then
+	local "$@" ${HOME} -eu test sed awk
+		cd ${HOME} | $(pwd) export printf "$1" "$@" "$1" 2>/dev/null readonly
+	echo --verbose sed then ${HOME} done 2>/dev/null 2>/dev/null
+	"$@" printf x=1 grep local sed /usr/bin
+	echo local -eu local | grep x=1 "$@" sed -eu grep x=1 ${HOME}
+	2>/dev/null "$1" 'quoted text' done | /usr/bin 2>/dev/null
+&& 2>/dev/null grep x=1 export -eu grep export sed local sed /usr/bin
+	x=1 sed grep echo printf x=1 grep echo $(pwd) export x=1 "$1" printf
+	local local | then --verbose x=1 | awk
+	export awk local awk done | --verbose "$1"
+"$1" printf grep 'quoted text' --verbose
+-eu awk awk grep /usr/bin then sed then 2>/dev/null --verbose local 2>/dev/null
+	printf && export printf /usr/bin &&
+	'quoted text' "$@" echo awk sed 2>/dev/null readonly 2>/dev/null
+	/usr/bin -eu ${HOME} ${HOME} grep awk ${HOME} test then ${HOME}
+	&& printf local local /usr/bin "$1" 2>/dev/null && "$1" local sed "$@"
+${HOME} printf readonly -eu awk
+		done echo $(pwd) awk cd grep printf x=1 test 'quoted text' sed --verbose
+readonly x=1 echo cd 'quoted text' done export -eu /usr/bin 'quoted text'
+		sed test x=1 | -eu then $(pwd)
+	sed | echo -eu grep 'quoted text'
+echo $(pwd) -eu /usr/bin x=1 printf "$@" readonly
+	'quoted text' sed cd done cd grep
+cd && && grep && "$@" --verbose | echo export cd test cd awk
+/usr/bin awk x=1 "$1" echo --verbose readonly "$1"
+		x=1 "$1" /usr/bin -eu "$@" cd x=1 ${HOME} done && /usr/bin 2>/dev/null
+		"$@" echo "$@" 'quoted text' && | ${HOME} 'quoted text' --verbose 'quoted text'
+${HOME} $(pwd) export /usr/bin awk
+	then $(pwd) "$@" sed | printf
+	local test 2>/dev/null sed | --verbose -eu done cd -eu local "$1" grep echo
+&& grep "$@" --verbose awk
+		sed then | $(pwd) export echo sed | 'quoted text' "$1"
+		grep "$1" sed echo /usr/bin
+--verbose export ${HOME}
+test "$@" /usr/bin x=1 awk sed -eu
+	"$1" cd cd grep x=1 && sed && export
+		readonly readonly /usr/bin echo cd done
+--verbose awk 'quoted text'
+		"$@" "$@" test sed echo
+	2>/dev/null cd | --verbose "$1" export printf local printf --verbose
+		$(pwd) local awk local /usr/bin sed ${HOME} --verbose
+		export $(pwd) --verbose
+		x=1 then grep /usr/bin grep 'quoted text' echo "$1"
+test x=1 awk test --verbose $(pwd) 'quoted text' awk then
+${HOME} then /usr/bin then echo --verbose
+		&& test x=1 sed "$@" x=1 printf $(pwd) /usr/bin | readonly --verbose $(pwd)
+		&& then grep done $(pwd) readonly local $(pwd) printf then awk --verbose
+"$@" then x=1 done cd sed ${HOME} $(pwd) sed then "$@"
+	test test done cd readonly "$1" cd local 'quoted text' ${HOME}
+		sed 'quoted text' 2>/dev/null awk echo -eu | local test
+	awk echo /usr/bin awk 'quoted text'
+readonly && printf ${HOME} export "$1" export echo sed then printf
+	'quoted text' "$@" | cd awk | /usr/bin "$@" $(pwd) done x=1 cd -eu --verbose $(pwd)
+	-eu x=1 --verbose awk "$1" local -eu grep -eu printf
+		then printf x=1 sed then $(pwd) && printf test local printf readonly grep
+	"$1" | cd && /usr/bin grep x=1 x=1 | "$1" local test
+	echo echo "$@" --verbose ${HOME} then echo test
+		export test then ${HOME} done done echo "$@" && done -eu | sed $(pwd) 2>/dev/null
+		-eu done grep "$@" echo "$1" printf
+		then grep && awk x=1 awk
+export test sed ${HOME} cd ${HOME} export && sed | "$1" echo 'quoted text' cd readonly
+	| echo awk then echo readonly ${HOME} "$@"
+| "$1" awk grep awk local printf -eu ${HOME} readonly done $(pwd) test
+	export -eu test "$1" ${HOME} | printf grep | done
+		/usr/bin 2>/dev/null local done sed "$@" /usr/bin $(pwd) then then
+		cd export test done echo printf 'quoted text' test "$1" done /usr/bin && &&
+	local "$1" 2>/dev/null | x=1 readonly
+	'quoted text' awk awk
+	x=1 -eu $(pwd) ${HOME} --verbose 'quoted text' then | /usr/bin readonly 'quoted text'
+test sed grep "$1" ${HOME} /usr/bin 'quoted text' --verbose export awk
+		sed /usr/bin test local echo test x=1 "$1" local local printf $(pwd)
+		sed awk sed && then cd 'quoted text' ${HOME} /usr/bin done 'quoted text'
+	done test "$1" "$@" export test
+sed done grep ${HOME} cd echo then x=1
+local done | && then awk local awk local $(pwd) "$@" sed
+		x=1 grep echo export |
+		cd 'quoted text' test 2>/dev/null
+$(pwd) x=1 x=1 -eu local grep -eu -eu ${HOME} printf cd printf awk && "$1"
+		$(pwd) done then awk then /usr/bin | sed cd 2>/dev/null "$1"
+		awk x=1 "$@" local $(pwd) grep grep /usr/bin printf "$@" -eu
+printf local local cd done readonly test "$@" $(pwd)
+grep x=1 /usr/bin local 2>/dev/null "$1" awk && /usr/bin | local /usr/bin
+awk readonly ${HOME} ${HOME} awk cd /usr/bin 'quoted text'
+| 2>/dev/null | --verbose $(pwd) sed && && done local then && test
+echo 'quoted text' printf /usr/bin
+		'quoted text' -eu cd -eu grep readonly
+	local done 2>/dev/null printf then x=1 echo printf printf ${HOME} echo | then
+	/usr/bin /usr/bin cd export done done test $(pwd) -eu
+		${HOME} $(pwd) "$@" echo x=1 cd "$1" readonly -eu
+	| cd printf local -eu cd test grep | ${HOME} done done readonly test ${HOME} &&
+done "$@" --verbose local then sed
+	local printf x=1 --verbose ${HOME} printf cd -eu cd 2>/dev/null ${HOME}
+echo done ${HOME} ${HOME} x=1 2>/dev/null awk "$1" ${HOME} "$@"
+printf sed local test cd && x=1 printf
+printf export && "$@" $(pwd) 2>/dev/null --verbose -eu ${HOME}
+		done grep | "$1" done printf test sed ${HOME} /usr/bin
+		readonly sed ${HOME} ${HOME} -eu "$@" "$@" readonly "$@" readonly
+		/usr/bin $(pwd) /usr/bin $(pwd) "$1" 2>/dev/null "$1" done local local
+2>/dev/null echo then /usr/bin "$1" awk sed echo "$1" awk cd "$@" | echo && printf
+echo && 'quoted text' printf
+		printf readonly 'quoted text' $(pwd) echo /usr/bin then
+local export --verbose /usr/bin sed -eu /usr/bin local | ${HOME}
+test ${HOME} cd -eu $(pwd) awk "$1" local
+		export grep echo x=1 printf "$1" echo
+		grep export awk ${HOME} "$@" ${HOME} ${HOME} 2>/dev/null "$1"
+	done then | && sed awk /usr/bin $(pwd) -eu
+	readonly cd ${HOME} ${HOME} test then 2>/dev/null echo && --verbose
+	grep ${HOME} echo x=1 "$1" sed | printf 2>/dev/null
+grep | "$1" $(pwd) export "$1" done then awk 2>/dev/null printf
+/usr/bin "$@" "$@" 2>/dev/null 'quoted text' && awk cd sed && $(pwd) readonly
+	"$@" x=1 'quoted text' $(pwd) 2>/dev/null
+--verbose awk 'quoted text' sed /usr/bin grep 2>/dev/null && export
+		/usr/bin sed sed $(pwd) echo && 'quoted text' | /usr/bin
+	done "$1" 'quoted text' ${HOME}
+		| grep printf ${HOME} then done ${HOME} "$@" ${HOME}
+	"$1" printf ${HOME} --verbose
+--verbose 2>/dev/null grep test sed -eu local sed /usr/bin
+'quoted text' -eu cd && | --verbose "$1" 2>/dev/null 'quoted text'
+		'quoted text' awk printf "$1" "$1" local ${HOME}
+		/usr/bin echo awk 'quoted text' echo
+	grep && grep && echo then && "$1" local /usr/bin ${HOME} grep test then done
+		cd grep export ${HOME} awk &&
+		$(pwd) echo printf done "$@" && export grep 'quoted text' "$1" sed sed awk export
+		| x=1 cd $(pwd) -eu awk "$1" local export done sed ${HOME}
+		readonly grep printf test
+"$@" printf readonly echo local export --verbose 2>/dev/null local
+	'quoted text' printf --verbose echo --verbose grep 2>/dev/null
+2>/dev/null 2>/dev/null "$1" printf cd grep local "$1" 2>/dev/null local
+		-eu then export echo sed echo local readonly
+		--verbose readonly 2>/dev/null grep x=1
+	'quoted text' printf echo && cd "$@" export | awk "$1" $(pwd)
+	"$@" test "$@" /usr/bin &&
+grep echo sed grep awk then done done
+"$1" cd && && test test $(pwd) local test && awk test done grep x=1 |
+	--verbose awk 'quoted text' "$@" then then 2>/dev/null awk awk printf | cd 2>/dev/null
+'quoted text' printf 'quoted text' export "$1" ${HOME} x=1
+grep grep export && --verbose -eu
+		"$1" 'quoted text' export -eu readonly grep readonly
+		-eu x=1 | awk /usr/bin x=1 then test then
+	printf "$1" sed | sed then
+printf readonly -eu "$@" then local
+		sed done $(pwd) export
+	printf awk x=1 readonly 2>/dev/null $(pwd) && test sed 2>/dev/null $(pwd)
+	grep grep && readonly ${HOME} ${HOME}
+	sed local sed ${HOME} awk local 2>/dev/null awk ${HOME}
+		"$@" 2>/dev/null "$@" $(pwd) --verbose -eu "$1" x=1 sed
+		2>/dev/null echo | done $(pwd) ${HOME} | sed echo -eu "$@" printf
+export printf echo /usr/bin |
+		local export 2>/dev/null awk local test && | printf
+		2>/dev/null x=1 cd x=1 "$1" printf --verbose
+		test --verbose | $(pwd) -eu 'quoted text' "$@" x=1 --verbose test 'quoted text'
+		export x=1 printf export test $(pwd) export done test | awk && echo "$@"
+	$(pwd) printf /usr/bin test awk sed && echo --verbose | readonly --verbose
+export cd $(pwd) "$1"
+		test cd echo then x=1 'quoted text' printf | && $(pwd) "$1"
+		-eu readonly -eu echo cd echo local printf x=1 grep 'quoted text'
+	-eu -eu cd "$@" done | local cd "$1"
+	x=1 local grep 2>/dev/null export
+	awk 2>/dev/null readonly readonly cd
+		&& awk sed 'quoted text' "$1" local cd
+"$@" done -eu readonly done awk ${HOME} --verbose --verbose
+		| && --verbose awk then | /usr/bin ${HOME} "$@" local x=1 -eu "$1" && 'quoted text'
+&& "$@" then "$1" then -eu
+		--verbose --verbose | readonly 2>/dev/null done 'quoted text' cd export
+	test awk grep sed then 'quoted text' grep then x=1 && "$1" done printf
+"$1" done sed -eu /usr/bin --verbose
+2>/dev/null 2>/dev/null --verbose readonly
+	export 2>/dev/null x=1 sed readonly
+	-eu --verbose export awk --verbose 2>/dev/null grep ${HOME} x=1
+	local /usr/bin ${HOME} grep grep sed
+	2>/dev/null "$@" 'quoted text' echo --verbose
+then $(pwd) grep local sed -eu | x=1
+		cd | test "$@" test 2>/dev/null 'quoted text' 'quoted text'
+'quoted text' 'quoted text' -eu x=1 x=1
+'quoted text' ${HOME} test 2>/dev/null $(pwd) "$@" printf
+	readonly -eu "$1" "$@" grep "$@" echo then -eu 2>/dev/null --verbose "$@" -eu
+	readonly "$1" && "$@" cd then && export local -eu readonly 'quoted text'
+	echo done printf -eu echo grep printf echo -eu cd 'quoted text'
+		/usr/bin local readonly test -eu cd readonly /usr/bin /usr/bin
+	readonly --verbose "$@" ${HOME} done "$@" 'quoted text'
+awk test 'quoted text' --verbose --verbose cd ${HOME}
+		then test grep readonly | --verbose x=1 printf awk test $(pwd) -eu awk && awk
+		sed test "$1" 'quoted text' grep $(pwd) 2>/dev/null
+cd then 'quoted text' done 2>/dev/null x=1 -eu 2>/dev/null 2>/dev/null export $(pwd)
+		sed "$@" /usr/bin readonly && printf 2>/dev/null
+		${HOME} "$1" 'quoted text' "$1" --verbose grep "$@" "$@" x=1 readonly /usr/bin
+	${HOME} export -eu echo | "$@"
+		$(pwd) done --verbose "$@" export x=1 cd awk $(pwd)
+		${HOME} sed x=1 grep 'quoted text' echo ${HOME} printf -eu ${HOME} then $(pwd)
+		'quoted text' local then
+		x=1 | done echo done done done ${HOME} cd /usr/bin done export
+	--verbose 'quoted text' x=1 /usr/bin then --verbose && cd ${HOME} 2>/dev/null
+	then echo sed awk && export
+	export readonly cd /usr/bin cd readonly
+	&& printf awk awk --verbose then
+	test 2>/dev/null "$@" then done 'quoted text'
+	awk "$1" /usr/bin ${HOME} then done 2>/dev/null awk awk local $(pwd)
+local sed "$1" /usr/bin
+&& "$@" && echo grep grep then x=1 test | ${HOME} echo
+	sed export export /usr/bin 2>/dev/null "$1" done test printf /usr/bin 2>/dev/null
+	2>/dev/null "$@" readonly done ${HOME} $(pwd) sed $(pwd) then 2>/dev/null
+		test "$1" ${HOME} "$@" export 2>/dev/null | done /usr/bin 'quoted text' awk
+"$1" test 'quoted text' grep && $(pwd) "$1" done "$1" local -eu grep readonly x=1
+	'quoted text' 2>/dev/null awk test awk x=1 cd done $(pwd)
+		test cd && -eu 2>/dev/null 'quoted text' readonly
+export 2>/dev/null cd --verbose
+	&& awk then cd x=1 local readonly /usr/bin
+"$1" x=1 x=1 x=1 echo ${HOME} -eu sed ${HOME} ${HOME} $(pwd) printf /usr/bin
+	printf -eu sed 2>/dev/null 'quoted text'
+	echo export $(pwd) local grep /usr/bin export 2>/dev/null test printf
+		--verbose | x=1 /usr/bin /usr/bin -eu "$@" -eu $(pwd) "$1" --verbose local
+grep cd -eu $(pwd) $(pwd) 'quoted text'
+${HOME} export /usr/bin 2>/dev/null | -eu --verbose cd x=1
+		awk local x=1 | export then &&
+	| && export -eu "$1" printf export sed "$1" done
+2>/dev/null "$@" ${HOME} -eu test export then &&
+		--verbose "$@" test --verbose
+	2>/dev/null 'quoted text' 2>/dev/null && --verbose && ${HOME} ${HOME}
+		test printf -eu -eu grep &&
+		&& && then 2>/dev/null | printf cd awk && 2>/dev/null sed
+	cd sed done | export done local "$1" "$1" done printf local test cd ${HOME} printf
+"$1" 'quoted text' -eu x=1 x=1 --verbose
+	"$1" x=1 then --verbose
+awk sed cd echo cd cd echo
+	x=1 -eu local readonly -eu && test awk x=1 awk -eu 2>/dev/null /usr/bin done
+export | ${HOME} $(pwd) "$@" 2>/dev/null -eu then local
+	sed awk cd /usr/bin done sed readonly done --verbose && x=1 done 'quoted text'
+	"$1" | local printf readonly -eu "$@" cd "$1" test printf "$1" cd | --verbose 2>/dev/null
+$(pwd) readonly local /usr/bin printf x=1 then readonly ${HOME}
+/usr/bin -eu echo ${HOME} local
+	"$1" echo printf ${HOME} awk /usr/bin "$1" --verbose
+done grep -eu -eu printf && sed --verbose
+| done 2>/dev/null grep sed | && export
+	printf "$1" $(pwd) $(pwd) && -eu readonly "$@" "$1" 'quoted text'
+		| test printf x=1 echo export grep 'quoted text' 'quoted text'
+	$(pwd) x=1 -eu test "$1" x=1 grep
+		cd $(pwd) then printf $(pwd) x=1 printf 2>/dev/null done --verbose /usr/bin
+	awk grep x=1 $(pwd) export test done
+$(pwd) $(pwd) x=1 $(pwd) local echo x=1 readonly -eu
+		$(pwd) -eu --verbose cd
+test sed ${HOME} grep test | ${HOME} then grep local x=1 done
+	x=1 done 'quoted text' "$@" | 2>/dev/null
+	awk -eu $(pwd) -eu echo local /usr/bin test $(pwd) x=1 --verbose 'quoted text' then
+		/usr/bin $(pwd) -eu awk /usr/bin printf printf readonly test local grep local done
+"$1" "$1" "$1" done then "$@" cd | echo
+'quoted text' "$1" ${HOME} sed sed $(pwd) echo done sed cd /usr/bin
+	$(pwd) test local x=1 "$1"
+| awk /usr/bin done done x=1 awk printf
+		awk -eu then ${HOME} "$1" -eu "$1" |
+sed -eu 'quoted text' test local --verbose cd 2>/dev/null sed --verbose sed export
+	grep "$1" grep readonly readonly sed then | cd 'quoted text'
+	x=1 -eu "$1" sed grep sed "$@" awk 'quoted text'
+		"$1" | local test $(pwd) x=1 && -eu readonly export $(pwd) ${HOME}
+		grep "$@" 'quoted text' "$1" "$@" "$1" cd grep --verbose then 2>/dev/null
+		cd done local sed && x=1 -eu
+	${HOME} | 'quoted text' local
+		x=1 export printf -eu -eu &&
+	2>/dev/null 'quoted text' | local local
+local -eu --verbose printf grep awk export | grep
+echo 2>/dev/null done
+		| -eu --verbose && /usr/bin
+		local x=1 "$@" -eu cd $(pwd)
+test cd then cd cd | x=1 --verbose "$1" x=1 readonly test done ${HOME}
+test done printf cd awk echo /usr/bin grep grep printf && cd -eu -eu /usr/bin
+then done $(pwd) 2>/dev/null done ${HOME} | awk grep $(pwd) 2>/dev/null
+	awk x=1 test local test then ${HOME} done
+		done -eu test | "$1" printf grep -eu 'quoted text'
+		awk -eu --verbose $(pwd) /usr/bin local --verbose done printf test
+awk then local export readonly
+		--verbose "$1" && x=1 2>/dev/null --verbose awk sed printf "$@" printf awk 'quoted text'
+		"$1" export export /usr/bin cd
+	2>/dev/null echo ${HOME} ${HOME} "$@" ${HOME} "$1" awk export then then
+$(pwd) test -eu local readonly sed ${HOME} test test "$@"
+	test x=1 "$@" "$@" "$1" done awk --verbose | -eu 'quoted text' "$@"
+&& 'quoted text' "$1" "$1" readonly then test readonly
+	printf | "$@" test cd then x=1 /usr/bin 2>/dev/null local done
+printf "$1" done /usr/bin && | x=1 grep ${HOME} "$1" 'quoted text'
+	"$1" -eu export printf /usr/bin printf && $(pwd) test && /usr/bin
+then "$@" | printf x=1 'quoted text'
+-eu 2>/dev/null x=1 x=1 'quoted text' export /usr/bin 2>/dev/null
+	local /usr/bin && $(pwd) local test --verbose
+	echo then -eu 'quoted text' echo sed
+		$(pwd) x=1 /usr/bin /usr/bin 'quoted text' test done sed readonly
+	done export /usr/bin echo | --verbose sed x=1 --verbose cd | | sed
+echo --verbose "$1" then | local --verbose && /usr/bin "$@" "$@" $(pwd) "$1"
+	'quoted text' ${HOME} && 'quoted text' sed cd $(pwd) then cd echo
+		export | 'quoted text' then "$1" 'quoted text'
+		then done /usr/bin test cd then grep sed export
+	grep && "$1" $(pwd) x=1 test readonly grep x=1 'quoted text'
+	printf printf 2>/dev/null export | 'quoted text' then --verbose $(pwd)
+		then $(pwd) then cd -eu readonly grep $(pwd) sed readonly sed
+	"$@" awk | ${HOME} | echo then && grep grep $(pwd)
+		'quoted text' -eu test ${HOME} x=1
+	then grep "$1" printf 'quoted text' 'quoted text' 2>/dev/null test | readonly
+		printf cd /usr/bin 2>/dev/null && -eu cd /usr/bin awk $(pwd) grep
+		printf cd then done 'quoted text' cd && "$@" done "$1" awk grep awk /usr/bin
+		then x=1 /usr/bin -eu export sed sed
+cd export "$@" && then cd done
+	"$@" readonly 2>/dev/null 2>/dev/null ${HOME} /usr/bin
+		"$1" "$1" readonly && /usr/bin export "$1" -eu export && /usr/bin
+readonly export export ${HOME} --verbose 'quoted text' grep
+		then "$1" export then done
+grep echo | ${HOME} awk awk
+${HOME} cd 2>/dev/null local readonly readonly
+	cd readonly then 'quoted text'
+grep sed | local test readonly printf ${HOME} $(pwd) echo printf x=1
+	echo cd sed cd printf --verbose readonly x=1 echo && --verbose export $(pwd)
+	sed cd -eu && sed x=1 -eu ${HOME} "$@" x=1 | 'quoted text' export then echo | ${HOME}
+		2>/dev/null printf x=1 ${HOME} printf
+done 2>/dev/null ${HOME} done export 'quoted text'
+	echo test --verbose /usr/bin ${HOME}
+	-eu $(pwd) && echo printf -eu x=1 &&
+		'quoted text' grep "$1" 'quoted text'
+		local | cd | && test grep x=1 x=1 grep && | done
+		$(pwd) 2>/dev/null -eu printf test grep "$1" --verbose | then "$1"
+	&& sed printf | "$1" done readonly "$@" x=1 grep x=1 "$1" "$@" |
+	x=1 done then done --verbose local echo printf ${HOME} /usr/bin -eu printf test
+--verbose "$@" readonly test /usr/bin
+		local ${HOME} --verbose then export sed $(pwd) 'quoted text' sed /usr/bin
+"$@" echo "$1" grep "$@" export readonly
+&& local done -eu ${HOME} done && export done $(pwd)
+	then $(pwd) "$@" export then -eu /usr/bin cd --verbose readonly && awk
+-eu test awk done "$@" && done local
+	$(pwd) done --verbose /usr/bin then readonly test
+	test "$@" export "$1" sed export echo x=1 "$@" x=1 done cd test printf done
+		"$1" cd 'quoted text' "$1" | sed 'quoted text' ${HOME} grep $(pwd) printf done ${HOME}
+"$1" printf "$@" readonly /usr/bin /usr/bin local awk /usr/bin sed local test
+	x=1 $(pwd) local && && cd local test | "$@" printf printf echo 2>/dev/null
+		| /usr/bin x=1 awk 'quoted text' "$@" awk -eu readonly && "$@" && done --verbose
+		'quoted text' | --verbose "$@" 'quoted text'
+	/usr/bin "$1" awk export done ${HOME} local echo export "$@"
+		'quoted text' echo -eu 2>/dev/null done -eu --verbose local "$1"
+		&& ${HOME} /usr/bin echo echo echo ${HOME}
+test && grep 'quoted text' sed --verbose -eu /usr/bin
+2>/dev/null echo /usr/bin printf && -eu grep then done cd
+"$@" export /usr/bin awk x=1 awk local && cd $(pwd) "$@" readonly export
+		local export 'quoted text'
+export ${HOME} $(pwd)
+		${HOME} x=1 sed readonly export | "$@" -eu cd then readonly
+/usr/bin export then then cd 'quoted text'
+		echo --verbose $(pwd) awk echo ${HOME} -eu sed
+		then echo sed x=1 "$1" ${HOME}
+		"$@" -eu $(pwd) "$1" 2>/dev/null local grep printf then
+		sed printf grep then then test | "$@" 2>/dev/null
+done /usr/bin 'quoted text' sed export
+		"$@" ${HOME} "$1" done done cd grep then 2>/dev/null then test | x=1 --verbose
+		/usr/bin ${HOME} cd printf --verbose export cd printf done then echo local
+	export done | | echo -eu awk x=1 ${HOME} 2>/dev/null
+	echo 'quoted text' 2>/dev/null local
+		-eu 'quoted text' then && 2>/dev/null export readonly --verbose /usr/bin && &&
+		sed printf cd --verbose local awk "$@" echo echo -eu awk printf &&
+		awk echo echo done ${HOME} 'quoted text' then && test sed export | ${HOME} $(pwd)
+		--verbose printf "$1" /usr/bin "$@" /usr/bin /usr/bin export sed --verbose
+		| grep x=1 $(pwd) && $(pwd) grep | &&
+		done ${HOME} export cd awk
+	| sed -eu test $(pwd) sed 'quoted text' export grep local readonly -eu done
+	"$@" test printf grep test printf /usr/bin export grep 'quoted text'
+	"$@" "$1" then grep $(pwd) ${HOME} "$@" && readonly
+		2>/dev/null printf sed x=1 awk cd
+$(pwd) grep | "$@" "$1" x=1 && --verbose echo
+	then -eu readonly | --verbose "$@" && echo | cd "$1" export
+printf export && "$@" 2>/dev/null echo x=1 sed --verbose
+	export printf sed local | | local 'quoted text' cd awk "$1" test
+	-eu test printf grep echo "$@" && cd ${HOME} 2>/dev/null /usr/bin
+		echo | --verbose --verbose grep local echo -eu && local sed
+		cd /usr/bin export && "$@"
+$(pwd) export | 2>/dev/null ${HOME} readonly test
+		sed done 'quoted text' /usr/bin -eu 'quoted text' "$@" echo local && local
+done /usr/bin grep echo test then x=1 printf done
+		then && test "$@" --verbose
+2>/dev/null 2>/dev/null /usr/bin ${HOME} readonly test test
+		x=1 export "$@" done awk /usr/bin grep done local 2>/dev/null then printf
+printf ${HOME} export &&
+grep | then 2>/dev/null "$@"
+	done x=1 sed | /usr/bin ${HOME} | $(pwd) 'quoted text' local readonly cd done
+	export awk test local grep cd echo 'quoted text' cd cd grep $(pwd)
+	then && --verbose awk done echo -eu
+${HOME} export x=1 echo 2>/dev/null
+${HOME} "$@" printf && ${HOME} 'quoted text' -eu local done echo grep --verbose
+	printf then then /usr/bin cd
+awk sed && echo 'quoted text' -eu awk | echo "$1"
+	printf local printf /usr/bin && local grep "$@" 'quoted text'
+		local /usr/bin local test awk echo "$1" readonly test | export cd
+sed test 'quoted text' ${HOME} then $(pwd) sed
+echo cd /usr/bin | readonly ${HOME}
+awk --verbose test "$@" ${HOME} grep export x=1 export done |
+awk /usr/bin ${HOME} grep test readonly && export 2>/dev/null echo awk
+--verbose done done grep printf $(pwd) echo x=1 $(pwd)
+then then grep done 'quoted text' ${HOME} cd echo "$1" cd -eu | /usr/bin then
+2>/dev/null ${HOME} echo local
+	local -eu awk "$1" awk local "$@" -eu test test
+local then x=1 awk done 'quoted text' grep awk /usr/bin
+/usr/bin echo printf done -eu echo echo 'quoted text' "$@" readonly
+		'quoted text' sed export --verbose 2>/dev/null | grep
+"$@" 2>/dev/null "$1" x=1 2>/dev/null && export $(pwd)
+"$@" ${HOME} $(pwd) sed | echo awk printf -eu 'quoted text' -eu
+	export grep 2>/dev/null "$1" -eu
+${HOME} done readonly sed && "$@" -eu readonly sed done -eu | echo /usr/bin -eu
+		local grep 2>/dev/null test /usr/bin then awk ${HOME}
+sed test cd local test grep --verbose echo
+	readonly | printf printf echo local test "$1"
+		| local "$@" cd test x=1 readonly local readonly $(pwd) -eu
+		${HOME} 2>/dev/null 2>/dev/null readonly -eu "$@" echo local awk test ${HOME} printf
+		$(pwd) /usr/bin then export /usr/bin done $(pwd) 'quoted text'
+		then ${HOME} grep done echo x=1 $(pwd) | sed export export "$@" awk -eu
+		sed grep cd -eu /usr/bin
+		$(pwd) -eu cd /usr/bin && sed
+	-eu local test printf 2>/dev/null $(pwd) "$1" -eu 2>/dev/null
+	| grep echo export local && ${HOME} grep
+printf readonly test $(pwd) test && cd $(pwd)
+| cd export export local 2>/dev/null local --verbose | $(pwd) echo
+	"$1" | local | /usr/bin
+	done printf done local 2>/dev/null echo $(pwd) x=1 -eu 'quoted text'
+		-eu done sed ${HOME} && done awk printf --verbose -eu -eu test | echo
+		printf cd awk $(pwd) --verbose sed 2>/dev/null
+/usr/bin done x=1 "$1" | 2>/dev/null done $(pwd) x=1 ${HOME} local 2>/dev/null
+		export $(pwd) export test awk $(pwd) printf "$1" then readonly
+echo echo /usr/bin cd /usr/bin --verbose
+	cd x=1 sed echo x=1 sed
+grep x=1 $(pwd) 2>/dev/null grep done | && 'quoted text' sed export local --verbose
+		"$1" x=1 sed ${HOME} readonly local $(pwd) printf 'quoted text'
+	awk ${HOME} --verbose --verbose grep "$@" 2>/dev/null
+		grep && test x=1 'quoted text' done export 'quoted text' 2>/dev/null x=1
+		readonly cd ${HOME} awk "$@" echo then
+	readonly 2>/dev/null cd test test --verbose "$@" export cd -eu x=1 $(pwd)
+printf --verbose local $(pwd) cd test
+		"$1" 2>/dev/null x=1 then 'quoted text' -eu sed ${HOME} done
+$(pwd) done --verbose echo done readonly
+	/usr/bin && echo | then 2>/dev/null
+	&& then | grep printf then 'quoted text' local --verbose 2>/dev/null printf
+		x=1 sed $(pwd) $(pwd) done "$1" sed "$@" --verbose cd test "$@" cd && cd
+2>/dev/null cd --verbose --verbose ${HOME} printf
+		$(pwd) -eu readonly 2>/dev/null readonly $(pwd) readonly "$1" awk
+	"$@" test local echo test then $(pwd) printf | x=1
+		local awk sed "$@" | grep --verbose printf echo | "$1" printf
+grep | cd done grep | printf ${HOME} sed cd x=1
+	local cd printf --verbose
+		test 'quoted text' 2>/dev/null ${HOME} export | --verbose && | -eu
+	export done cd done | -eu | sed "$1"
+	then && $(pwd) --verbose && test
+		done printf x=1 done local "$@" done --verbose
+		&& --verbose x=1 --verbose awk --verbose
+	then cd --verbose ${HOME} ${HOME} test readonly x=1 ${HOME} 2>/dev/null test sed
+		readonly /usr/bin local x=1 --verbose
+sed 'quoted text' 2>/dev/null awk
+		export | --verbose echo "$@" awk "$@"
+${HOME} 2>/dev/null done then grep
+		grep awk /usr/bin "$1" test printf -eu readonly ${HOME} local | printf "$1" readonly
+--verbose test ${HOME} x=1 test sed 'quoted text' | 2>/dev/null
+test /usr/bin done test local $(pwd) awk ${HOME} -eu && cd /usr/bin 2>/dev/null
+awk printf 2>/dev/null x=1 echo then /usr/bin x=1 | done -eu &&
+	--verbose echo then && $(pwd) printf 'quoted text' echo "$@" then done 2>/dev/null
+		cd printf "$1" readonly 'quoted text' $(pwd) sed then cd 2>/dev/null
+	export export --verbose printf export 'quoted text' grep 2>/dev/null
+2>/dev/null 2>/dev/null /usr/bin 2>/dev/null
+		grep /usr/bin readonly grep readonly "$@" | cd 2>/dev/null ${HOME} export
+test ${HOME} export local && export
+	"$1" 2>/dev/null /usr/bin ${HOME} /usr/bin 'quoted text' awk "$@" awk
+	"$1" x=1 | awk --verbose export printf echo | /usr/bin "$@"
+		awk "$@" "$@" "$@" export done then
+${HOME} x=1 awk -eu -eu 'quoted text'
+	--verbose | done printf sed && grep echo -eu "$@" sed cd done readonly
+	test && -eu awk cd cd readonly
+		-eu awk --verbose /usr/bin
+/usr/bin grep echo awk -eu done then
+		awk then x=1 ${HOME} grep done printf cd awk test 'quoted text'
+done export awk printf sed "$1" x=1 grep grep
+		echo export printf local
+awk x=1 /usr/bin awk echo
+x=1 export then test --verbose
+		done test "$@" then -eu && 2>/dev/null x=1 done printf $(pwd)
+	"$@" 2>/dev/null then awk x=1 "$@" 'quoted text'
+		$(pwd) then readonly grep "$@" -eu "$1" ${HOME} cd 'quoted text'
+	"$1" test --verbose then grep x=1 "$1" printf echo 'quoted text'
+/usr/bin then "$1" "$1" done --verbose
+	readonly echo -eu then ${HOME} 2>/dev/null | ${HOME} ${HOME} local "$1"
+2>/dev/null | sed local export 'quoted text'
+		printf 2>/dev/null x=1 --verbose done
+&& grep awk printf local cd echo test sed /usr/bin /usr/bin
+		sed readonly echo 'quoted text' && echo grep x=1 -eu 2>/dev/null awk
+	| $(pwd) awk /usr/bin readonly local "$1" sed "$1"
+	sed done sed --verbose 2>/dev/null grep --verbose && 'quoted text'
+	'quoted text' export then local /usr/bin /usr/bin "$1" | $(pwd)
+		-eu && readonly "$@" sed && --verbose
+	/usr/bin printf $(pwd) done sed echo 2>/dev/null
+	printf export "$@" sed awk -eu | then x=1 "$1" 'quoted text'
+	$(pwd) done local readonly local
+	echo -eu sed x=1 2>/dev/null cd grep | readonly
+"$@" then 'quoted text' cd echo done readonly $(pwd) awk "$@" export 'quoted text'
+		${HOME} grep --verbose sed
+	${HOME} ${HOME} readonly --verbose printf
+	--verbose grep done |
+		done export -eu cd then && test grep "$@"
+		sed x=1 readonly 2>/dev/null awk cd
+--verbose awk -eu 2>/dev/null test
+		printf export 2>/dev/null test 'quoted text' 'quoted text' ${HOME}
+export 'quoted text' echo "$@" $(pwd) ${HOME} local ${HOME}
+"$@" -eu $(pwd) grep then
+		"$1" cd 2>/dev/null local -eu export | readonly cd
+	2>/dev/null awk done -eu x=1 printf sed readonly x=1
+grep sed --verbose test 'quoted text' -eu done then | /usr/bin
+test ${HOME} 2>/dev/null x=1 x=1 export grep /usr/bin readonly ${HOME}
+awk -eu "$@" export grep echo grep /usr/bin sed "$1" sed 2>/dev/null
+sed -eu ${HOME} export echo "$@" grep 2>/dev/null export sed readonly
+x=1 printf | echo && 'quoted text' $(pwd) echo "$@" echo local sed
+	export done printf "$1"
+grep --verbose echo ${HOME}
+grep x=1 echo then echo done 2>/dev/null 2>/dev/null
+| local x=1 ${HOME} 2>/dev/null /usr/bin
+		${HOME} readonly done local sed local sed readonly sed "$1" done local
+		x=1 | 2>/dev/null readonly
+		done then printf && echo awk printf sed then && "$1" -eu ${HOME} cd export
+	$(pwd) ${HOME} sed cd "$1"
+		| then "$@" $(pwd) x=1 2>/dev/null 'quoted text'
+	'quoted text' && | -eu 'quoted text'
+	printf 'quoted text' && grep 'quoted text'
+	x=1 printf -eu sed 2>/dev/null cd
+		--verbose printf then | ${HOME} done
+	"$1" 2>/dev/null && then
+		'quoted text' | ${HOME} && local then "$1" echo -eu ${HOME} "$@"
+	'quoted text' sed awk done && sed ${HOME}
+	readonly x=1 "$1" echo then printf
+		"$@" --verbose export then printf done local
+| ${HOME} $(pwd) then grep && 2>/dev/null 2>/dev/null
+	-eu 'quoted text' readonly test 2>/dev/null $(pwd) --verbose | grep -eu
+	export "$@" awk awk -eu awk
+	${HOME} awk ${HOME} | readonly echo "$@" test printf /usr/bin ${HOME} "$1" 2>/dev/null
+grep && $(pwd) printf export echo readonly printf
+	&& $(pwd) 2>/dev/null then | readonly local | "$1"
+		then /usr/bin cd sed /usr/bin
+$(pwd) "$@" done then x=1
+	-eu test sed $(pwd) test cd echo done "$1" awk && readonly "$1" |
+| test printf && ${HOME} | awk echo local then awk test "$@"
+		test export done --verbose grep readonly echo printf cd done local done /usr/bin
+		printf --verbose export
+&& $(pwd) --verbose export ${HOME} test
+		done grep then --verbose done echo
+	"$@" done && "$1" printf | printf /usr/bin cd printf awk printf "$1" --verbose
+	grep sed -eu readonly test /usr/bin done
+	2>/dev/null | 'quoted text' -eu $(pwd) printf 2>/dev/null ${HOME}
+		done local done done readonly 2>/dev/null grep --verbose
+	--verbose 2>/dev/null then ${HOME} && ${HOME} done export 'quoted text' $(pwd)
+	"$@" readonly printf test readonly 2>/dev/null grep export export
+	--verbose | 2>/dev/null | export export test --verbose -eu readonly
+		"$@" -eu export "$1" printf awk cd sed test cd 'quoted text'
+	local awk echo grep && sed done local && "$@" 2>/dev/null local
+		local test export sed cd 2>/dev/null
+		x=1 x=1 ${HOME} cd awk
+	readonly --verbose echo | "$1" $(pwd) && awk -eu -eu
+		-eu awk 2>/dev/null $(pwd) "$@" grep
+cd "$@" echo sed readonly x=1 -eu 'quoted text' awk
+		readonly && cd export /usr/bin /usr/bin | 'quoted text' && done 2>/dev/null
+		&& readonly readonly local /usr/bin readonly && && export
+awk readonly -eu printf 2>/dev/null sed echo grep ${HOME} export
+local $(pwd) printf printf local then grep x=1 readonly "$1"
+readonly sed done cd /usr/bin test --verbose cd done awk local
+	readonly export test cd x=1 ${HOME} test 'quoted text' 2>/dev/null local 'quoted text'
+"$@" readonly done readonly
+	${HOME} -eu x=1 'quoted text' echo
+	readonly && then /usr/bin cd printf
+-eu echo then "$@" "$@" local &&
+	/usr/bin && /usr/bin 2>/dev/null $(pwd) x=1
+		"$@" sed echo test 'quoted text' "$1" 2>/dev/null echo readonly
+	| "$@" export grep grep awk "$@"
+		done done "$@" --verbose test "$@" -eu "$1"
+sed && readonly /usr/bin && $(pwd) 'quoted text' local local readonly test done
+	"$1" readonly local $(pwd) printf 'quoted text' grep readonly 2>/dev/null
+		"$@" sed ${HOME} "$1" local $(pwd) "$@"
+		printf then awk local then -eu /usr/bin
+		awk then grep local test then
+done "$1" done "$@" cd done -eu sed "$1" echo export test
+		done done 2>/dev/null | awk x=1 --verbose test done printf printf $(pwd)
+	grep "$1" /usr/bin --verbose printf done test local --verbose
+		2>/dev/null -eu --verbose sed grep grep ${HOME} export local "$1"
+sed then x=1 awk awk 'quoted text' && /usr/bin
+--verbose printf local 2>/dev/null
+		done && cd grep $(pwd) echo done $(pwd) done echo
+	echo /usr/bin sed echo printf
+		&& -eu sed cd echo -eu cd 2>/dev/null ${HOME} test test -eu x=1
+		readonly local | "$@" export done "$1" readonly awk readonly grep
+	-eu then /usr/bin --verbose done /usr/bin cd awk
+		$(pwd) printf done $(pwd) done grep /usr/bin
+	$(pwd) --verbose 2>/dev/null cd ${HOME}
+	readonly -eu && 2>/dev/null && sed test x=1 x=1
+		printf "$@" 2>/dev/null /usr/bin ${HOME} 2>/dev/null then
+$(pwd) | awk cd "$@" /usr/bin 2>/dev/null sed x=1 "$1" -eu 'quoted text'
+	| then 'quoted text' $(pwd) printf 2>/dev/null
+printf -eu printf grep readonly -eu | readonly /usr/bin
+	export readonly printf grep --verbose
+	printf cd done done test then "$@" sed /usr/bin local awk x=1
+	printf ${HOME} x=1 -eu printf | /usr/bin echo 2>/dev/null awk done
+"$1" readonly readonly export then x=1 printf $(pwd) echo export
+		printf -eu cd && -eu cd test
+	2>/dev/null /usr/bin
+		sed readonly 2>/dev/null
+	"$@" grep grep | export x=1 ${HOME} x=1
+		| sed printf cd echo | test test printf export then $(pwd) 'quoted text' x=1 ${HOME}
+local 'quoted text' done export
+	sed x=1 --verbose done then -eu | --verbose
+-eu echo test grep "$1" then cd && local --verbose local printf done "$@" then
+${HOME} ${HOME} awk grep awk export /usr/bin
+	readonly then "$@" printf | done local test awk awk done local
+	| x=1 cd export grep "$@" /usr/bin "$@" | x=1 "$1" 2>/dev/null
+		local cd 2>/dev/null "$@" x=1 printf "$1" ${HOME} /usr/bin
+		readonly local export /usr/bin sed ${HOME} ${HOME} | "$@"
+		done grep awk x=1 readonly -eu local grep ${HOME} readonly && cd
+		then test | export export grep
+		$(pwd) -eu -eu --verbose && && export sed --verbose
+	export grep cd awk sed -eu test test cd | "$1" grep then ${HOME} test
+		${HOME} test /usr/bin echo ${HOME} && done | local printf cd
+| then ${HOME} "$@" grep cd local export export
+	&& | "$@" x=1 readonly "$1" local local readonly x=1
+	--verbose $(pwd) $(pwd) cd cd cd --verbose "$1" /usr/bin
+	&& printf "$1" 2>/dev/null /usr/bin ${HOME} 2>/dev/null readonly
+	awk /usr/bin "$@" cd done grep | 'quoted text' done cd x=1
+	'quoted text' ${HOME} readonly readonly -eu done
+	| test -eu $(pwd) x=1 local
+	x=1 then --verbose local
+		readonly --verbose readonly
+		cd /usr/bin export 'quoted text' cd -eu --verbose sed "$@"
+	local local echo -eu printf "$@" "$1" x=1 -eu
+		local then $(pwd) sed ${HOME} "$@" awk
+		2>/dev/null x=1 ${HOME}
+'quoted text' printf grep local then "$@" $(pwd)
+awk $(pwd) export then 2>/dev/null echo
+		${HOME} && printf test sed --verbose
+		| ${HOME} cd $(pwd) ${HOME} grep test "$@" 'quoted text'
+	printf x=1 grep awk ${HOME} printf 2>/dev/null grep $(pwd) x=1
+test ${HOME} export "$@" readonly then -eu printf then sed -eu
+		test awk local "$1" local 'quoted text' awk 'quoted text'
+-eu cd local "$@" local test --verbose
+		--verbose cd x=1 /usr/bin printf export ${HOME} /usr/bin
+	sed readonly then 2>/dev/null grep
+x=1 echo readonly /usr/bin
+	x=1 grep -eu | /usr/bin
+${HOME} export 2>/dev/null printf /usr/bin sed local echo
+	cd export ${HOME} $(pwd) sed test printf 'quoted text'
+	$(pwd) echo $(pwd) 'quoted text' x=1 ${HOME} 'quoted text' 2>/dev/null
+	--verbose readonly $(pwd) /usr/bin then "$1" local && readonly /usr/bin
+	grep 2>/dev/null ${HOME} readonly echo "$1" 2>/dev/null x=1 | ${HOME}
+		awk 'quoted text' local -eu then printf cd "$1" readonly x=1 done 'quoted text'
+		sed x=1 2>/dev/null sed 2>/dev/null
+printf local sed && "$1" --verbose $(pwd)
+	"$1" export grep done awk "$1" done
+		$(pwd) sed x=1 sed /usr/bin then "$@" && && $(pwd) 2>/dev/null export
+done x=1 "$@" 2>/dev/null local | "$1" export
+	echo | | "$1" printf $(pwd) $(pwd) local export "$1" 2>/dev/null
+test printf 'quoted text' export && | /usr/bin readonly | printf
+&& export echo echo 2>/dev/null $(pwd) sed /usr/bin | 'quoted text' "$@"
+		awk awk && x=1 --verbose | 'quoted text' -eu cd /usr/bin readonly
+${HOME} done "$1" /usr/bin done ${HOME} 'quoted text'
+${HOME} 2>/dev/null x=1
+done ${HOME} /usr/bin cd printf -eu then "$@" "$1" sed ${HOME} then /usr/bin
+		"$1" "$1" 2>/dev/null then then echo cd 2>/dev/null
+echo grep 2>/dev/null export test test then --verbose && | sed "$1" sed
+	/usr/bin printf ${HOME} ${HOME} | cd $(pwd) then 'quoted text' cd export
+&& "$@" 2>/dev/null "$1" 2>/dev/null
+	$(pwd) awk awk export test done ${HOME} then
+		-eu done /usr/bin echo x=1 test x=1 grep /usr/bin && export local 'quoted text'
+	&& 2>/dev/null --verbose
+	then 'quoted text' --verbose local sed 'quoted text'
+	grep export -eu awk grep "$1" cd echo
+		2>/dev/null $(pwd) "$1" sed | echo "$1" --verbose
+		| /usr/bin --verbose | readonly
+printf 'quoted text' x=1 && cd 'quoted text' test --verbose then
+	x=1 x=1 2>/dev/null "$@" test
+local readonly cd | sed --verbose awk
+	export awk export sed /usr/bin readonly | echo local grep local echo
+--verbose export "$@" 2>/dev/null ${HOME} -eu then
+		awk awk export printf ${HOME} --verbose 2>/dev/null
+	&& $(pwd) "$1" readonly then export 2>/dev/null 'quoted text'
+	'quoted text' printf then echo done x=1
+		printf --verbose "$1" | printf readonly then local
+then readonly -eu awk done then test 'quoted text'
+	--verbose grep $(pwd) grep "$1" && echo sed "$1" --verbose readonly
+		| x=1 grep cd ${HOME} test
+'quoted text' /usr/bin export && -eu ${HOME} test
+	x=1 export test && ${HOME} test readonly "$1" "$@" x=1 local 2>/dev/null printf
+"$1" grep then sed 'quoted text' export grep $(pwd) cd && ${HOME}
+		test readonly --verbose "$@" printf /usr/bin done "$1" printf grep then local
+		echo $(pwd) "$1" test 'quoted text' /usr/bin echo
+	${HOME} "$@" | readonly echo readonly && export | then cd ${HOME}
+'quoted text' -eu export then then
+	x=1 export echo echo 'quoted text' x=1 'quoted text' ${HOME}
+awk "$@" then awk --verbose /usr/bin "$@" --verbose awk grep "$1" echo awk
+	$(pwd) x=1 sed x=1 then awk 2>/dev/null x=1 export
+export cd | "$1" $(pwd) 2>/dev/null done 2>/dev/null export
+	awk $(pwd) sed x=1 ${HOME} | printf then && "$@" --verbose -eu sed $(pwd)
+	done printf 2>/dev/null 2>/dev/null 'quoted text' grep 2>/dev/null
+		${HOME} /usr/bin --verbose readonly then export 2>/dev/null echo grep
+		sed cd && "$@" 'quoted text' then
+		2>/dev/null readonly printf ${HOME} 2>/dev/null then grep | local awk then "$1"
+	x=1 awk x=1 | 'quoted text' &&
+grep | 2>/dev/null printf sed awk "$1" grep grep $(pwd)
+		'quoted text' "$@" 2>/dev/null readonly | readonly 2>/dev/null export
+cd sed readonly "$@" 2>/dev/null cd done readonly "$1"
+	"$@" readonly then 'quoted text' --verbose
+	--verbose ${HOME} 'quoted text' -eu | 'quoted text' && cd
+	sed printf printf done -eu "$1" test
+	"$@" --verbose printf && 2>/dev/null local awk then
+		x=1 'quoted text' 2>/dev/null readonly && done x=1 "$@" awk "$@" | local ${HOME}
+$(pwd) grep | local "$1" /usr/bin awk test cd printf export done "$1" /usr/bin
+	cd export then x=1 test
+		| $(pwd) test awk sed -eu ${HOME}
+	-eu echo then && /usr/bin | | $(pwd) x=1 printf cd ${HOME}
+	sed x=1 local ${HOME} done awk x=1 x=1 done test 'quoted text' cd
+cd then | $(pwd) x=1 x=1 -eu local -eu | awk
+	export grep /usr/bin test awk 'quoted text' export --verbose
+	&& 2>/dev/null done $(pwd) grep then echo done $(pwd) 2>/dev/null cd && sed
+		/usr/bin --verbose awk then 'quoted text' local
+	"$@" "$@" 'quoted text' test test
+printf then /usr/bin awk /usr/bin --verbose --verbose 2>/dev/null readonly
+		"$1" && printf --verbose
+	sed echo && "$1" x=1 sed /usr/bin /usr/bin then -eu
+grep --verbose | then
+	--verbose x=1 2>/dev/null "$1" cd --verbose
+		export 'quoted text' cd x=1 ${HOME} 'quoted text'
+		awk x=1 export echo local "$@"
+	grep $(pwd) | done -eu done --verbose
+readonly printf done test
+	done export done echo awk then $(pwd) awk grep | 2>/dev/null
+"$1" grep 'quoted text' echo awk printf /usr/bin -eu $(pwd) printf awk cd
+readonly readonly echo local --verbose grep printf $(pwd) && grep $(pwd) x=1
+	local cd readonly awk then x=1 ${HOME} | export "$1" "$1"
+	| --verbose echo x=1 /usr/bin ${HOME} "$1" --verbose
+-eu awk && readonly echo /usr/bin echo echo -eu --verbose
+-eu test -eu test echo "$1" export awk $(pwd) test echo cd -eu
+export test then local $(pwd)
+&& export readonly export --verbose
+		sed && -eu "$1" awk -eu | printf then printf printf -eu done grep
+	| | sed 'quoted text' then sed
+readonly cd && cd then readonly $(pwd)
+		printf awk done done &&
+-eu $(pwd) "$1" -eu test
+		"$1" ${HOME} 'quoted text' export
+	"$@" --verbose $(pwd) "$@" export x=1 $(pwd) $(pwd) then then done "$@"
+		cd then 2>/dev/null -eu done local x=1 readonly grep sed then
+	export /usr/bin /usr/bin 2>/dev/null x=1 printf 'quoted text' grep readonly
+	sed $(pwd) then 2>/dev/null echo printf && awk cd 2>/dev/null readonly awk ${HOME}
+test grep test export grep then "$1" "$@" "$1" cd -eu done local /usr/bin
+then grep && sed printf -eu sed then
+		-eu grep "$@" $(pwd) awk printf --verbose | | then 'quoted text'
+	awk export | "$1" "$1" echo $(pwd) --verbose $(pwd) -eu grep
+x=1 -eu | echo echo done -eu cd 2>/dev/null | | ${HOME} "$1" echo -eu 'quoted text'
+test "$@" echo "$@" cd $(pwd) then local $(pwd) --verbose -eu then
+		readonly 'quoted text' "$@" grep then export
+	then x=1 printf then test ${HOME} && -eu awk echo ${HOME} 2>/dev/null
+awk $(pwd) 'quoted text' grep | then test $(pwd) 'quoted text'
+| x=1 'quoted text' cd then grep "$@" echo awk test /usr/bin 'quoted text'
+		&& awk $(pwd) echo | printf x=1 "$1" --verbose export
+x=1 --verbose && | then && then --verbose
+		then $(pwd) printf cd | x=1 test
+	sed "$1" then -eu && grep --verbose -eu grep --verbose "$@" -eu $(pwd) 'quoted text'
+	then --verbose && grep -eu $(pwd) /usr/bin 2>/dev/null
+--verbose "$@" 'quoted text'
+	| /usr/bin $(pwd) /usr/bin "$@" test then -eu "$1" test
+		'quoted text' $(pwd) awk then x=1 /usr/bin "$1" awk && awk
+		&& "$@" "$@" 2>/dev/null export | $(pwd) cd | ${HOME}
+	awk ${HOME} /usr/bin test grep 2>/dev/null 'quoted text'
+		&& 2>/dev/null sed echo sed && local
+		"$@" "$1" cd "$1" test printf /usr/bin 'quoted text'
+		/usr/bin awk echo 'quoted text' printf "$@" readonly
+"$@" 'quoted text' done grep echo grep
+		${HOME} 'quoted text' 2>/dev/null x=1
+		local export --verbose --verbose "$1" export printf -eu && sed
+-eu ${HOME} --verbose "$@" cd local $(pwd) $(pwd) x=1 x=1 && "$1"
+	sed "$1" done /usr/bin $(pwd) echo readonly "$1" "$1" && x=1 -eu cd readonly
+"$1" then x=1 /usr/bin -eu
+		cd export readonly cd
+readonly x=1 sed $(pwd) | && && cd local
+$(pwd) $(pwd) then awk "$1" x=1 "$@" sed printf
+	done /usr/bin sed /usr/bin "$1" "$@" cd 2>/dev/null ${HOME} sed echo ${HOME}
+		/usr/bin readonly awk then readonly test $(pwd) echo "$@" export local cd
+$(pwd) x=1 cd done grep 'quoted text' /usr/bin readonly grep 'quoted text'
+		readonly x=1 "$@" cd test && test /usr/bin 2>/dev/null
+${HOME} awk grep test | cd then done &&
+	${HOME} --verbose ${HOME} readonly test grep export "$1" then echo | x=1
+readonly $(pwd) export 'quoted text' x=1 then then ${HOME}
+		$(pwd) $(pwd) sed test --verbose done
+		'quoted text' $(pwd) cd /usr/bin
+		--verbose "$1" done && test "$@" local local "$@" 2>/dev/null ${HOME}
+	readonly awk local "$1" "$@" ${HOME} grep | export -eu printf done grep
+	sed then printf test 2>/dev/null /usr/bin cd -eu
+	echo printf export && "$1"
+	$(pwd) $(pwd) "$@" awk "$1" sed --verbose grep
+grep x=1 local && echo 2>/dev/null "$@" printf export export printf --verbose
+"$@" "$@" ${HOME} export sed 2>/dev/null cd x=1 "$@" "$1" echo 'quoted text'
+		2>/dev/null sed done "$@" cd local /usr/bin sed export then -eu
+	local echo 'quoted text' local --verbose | then $(pwd) | export
+	awk -eu $(pwd) "$@" readonly $(pwd) x=1 $(pwd) awk -eu then /usr/bin
+	printf -eu 'quoted text' cd $(pwd) 'quoted text' --verbose export $(pwd) done
+	$(pwd) grep test "$1" sed
+/usr/bin test -eu readonly local then grep /usr/bin x=1 grep done cd ${HOME}
+	awk --verbose cd cd ${HOME} export readonly
+--verbose export "$1" done awk $(pwd) "$1" awk x=1 done ${HOME} 2>/dev/null
+	"$@" awk --verbose x=1 2>/dev/null && | sed "$@" done printf /usr/bin
+	"$@" cd local grep | local ${HOME} /usr/bin grep ${HOME}
+/usr/bin ${HOME} local done $(pwd) 'quoted text' -eu "$1" test --verbose
+local "$1" done then && | "$@" && awk then /usr/bin
+grep 'quoted text' x=1 2>/dev/null test readonly
+		echo "$@" readonly x=1 ${HOME} test /usr/bin 'quoted text' cd local sed /usr/bin
+"$@" --verbose -eu /usr/bin | sed x=1 "$@" echo
+	readonly sed readonly printf
+		${HOME} printf x=1 printf | sed | $(pwd) grep grep then done "$@" 2>/dev/null 'quoted text'
+	-eu -eu local then test local awk printf "$1" x=1 /usr/bin --verbose
+--verbose readonly awk printf -eu -eu local echo awk ${HOME}
+	| export echo grep -eu 'quoted text' local grep 'quoted text' -eu
+		test 2>/dev/null /usr/bin | test then cd 'quoted text' local
+| done "$1" local local --verbose
+	cd export export 2>/dev/null
+x=1 "$1" x=1 then printf && printf export --verbose && 2>/dev/null readonly
+	done then printf export 'quoted text' 2>/dev/null printf && x=1 grep
+		x=1 | sed /usr/bin /usr/bin -eu
+| local && "$1" done --verbose cd $(pwd) sed readonly awk 'quoted text'
+	awk local 'quoted text' then readonly done -eu 'quoted text' cd awk done then "$1"
+'quoted text' && -eu "$@" | | printf cd echo --verbose $(pwd)
+readonly grep grep echo $(pwd) awk ${HOME} -eu
+	sed grep then done | "$1" /usr/bin && x=1 then | echo test printf $(pwd) awk
+	2>/dev/null --verbose 2>/dev/null test done export test x=1 echo cd awk sed &&
+x=1 $(pwd) "$@" 2>/dev/null && export printf | "$1" test test
+awk 2>/dev/null sed 'quoted text' printf
+		sed readonly /usr/bin awk local cd
+echo local ${HOME} echo
+		local x=1 echo 2>/dev/null
+	&& 2>/dev/null export then readonly
+/usr/bin done done grep | awk 'quoted text'
+| test --verbose then then export
+-eu awk readonly grep export -eu "$1" ${HOME} 'quoted text'
+$(pwd) export --verbose -eu local --verbose ${HOME}
+		export done /usr/bin && sed then grep "$@" && grep awk /usr/bin readonly export
+cd -eu && 2>/dev/null x=1 cd printf then done -eu && awk test -eu
+/usr/bin cd "$@" printf
+local sed echo "$1" 'quoted text'
+readonly grep && ${HOME} -eu 2>/dev/null echo local x=1 -eu printf awk 2>/dev/null
+/usr/bin printf --verbose "$1" test ${HOME} then done
+		2>/dev/null test "$@" "$@" cd done "$1"
+	&& echo ${HOME} done done
+		2>/dev/null && sed x=1 'quoted text' 'quoted text'
+	cd "$@" x=1 --verbose then && -eu 'quoted text' sed
+		grep ${HOME} ${HOME} 2>/dev/null grep && done 'quoted text' export
+		/usr/bin /usr/bin sed 'quoted text' -eu printf ${HOME} local
+		awk export "$@" sed $(pwd) awk grep | cd ${HOME} echo echo
+	cd 'quoted text' | -eu readonly test grep awk
+	export printf --verbose export | cd printf
+-eu 2>/dev/null test /usr/bin 2>/dev/null done
+&& cd "$1" local /usr/bin local $(pwd)
+	local then /usr/bin local $(pwd) --verbose printf 'quoted text' printf
+readonly sed cd -eu 'quoted text' $(pwd) $(pwd) local
+	local sed sed local | export
+	printf then sed sed readonly sed "$@"
+		sed printf && sed && echo grep ${HOME} echo sed cd echo 'quoted text' echo
+--verbose readonly export "$1" && local
+		echo done grep "$@" awk sed -eu echo 'quoted text' "$1"
+	readonly "$@" x=1 /usr/bin | cd "$1" then ${HOME} done --verbose then test
+$(pwd) echo -eu | "$@"
+echo 2>/dev/null --verbose "$1" | then
+	done | sed 'quoted text'
+		'quoted text' export test test printf 2>/dev/null ${HOME} printf --verbose
+		$(pwd) printf 'quoted text' | "$@" done x=1 local -eu 2>/dev/null then done
+	${HOME} $(pwd) awk sed 2>/dev/null 'quoted text' done
+awk "$@" x=1 && | /usr/bin
+test 'quoted text' "$@" --verbose awk x=1 $(pwd) "$@" ${HOME}
+cd local readonly | export 2>/dev/null echo x=1
+	&& awk 'quoted text' /usr/bin
+		sed local 'quoted text' 'quoted text' ${HOME}
+	${HOME} "$1" export printf test
+		done awk && 2>/dev/null local sed | test "$@" readonly
+		&& /usr/bin "$@" | x=1 local
+		done 'quoted text' && -eu /usr/bin readonly local
+&& cd cd -eu 2>/dev/null readonly export -eu printf
+	"$1" readonly && export -eu cd export cd local then 2>/dev/null local
+then ${HOME} awk && cd awk grep then "$@" local
+	/usr/bin then && done --verbose awk test "$@" grep /usr/bin done 2>/dev/null |
+	then cd 2>/dev/null --verbose echo test printf
+		| then "$1" grep local "$@" test readonly $(pwd) 'quoted text' grep grep
+echo -eu "$@" | "$@" /usr/bin sed sed "$@" x=1 /usr/bin cd $(pwd) readonly x=1 'quoted text'
+--verbose sed local 2>/dev/null done | echo cd -eu
+local ${HOME} $(pwd) | $(pwd) 'quoted text' $(pwd) -eu done
+		printf 2>/dev/null ${HOME} --verbose readonly
+	echo local --verbose export && readonly awk
+		then readonly --verbose
+	readonly -eu grep "$@" awk "$1" /usr/bin -eu --verbose | test --verbose
+	test x=1 --verbose done 2>/dev/null $(pwd) 2>/dev/null
+test "$@" 'quoted text' ${HOME} /usr/bin cd "$1" "$1" 'quoted text'
+done && sed $(pwd) && done sed 'quoted text' cd sed
+	done test awk awk $(pwd) readonly 2>/dev/null
+	test $(pwd) "$@" | 'quoted text' readonly
+	grep then x=1 cd export /usr/bin 'quoted text'
+	local | sed "$1" test cd && "$@" sed | done "$@" && local x=1 then --verbose
+		${HOME} then && echo readonly -eu "$@"
+test ${HOME} cd grep then export "$@" then grep /usr/bin echo test printf
+		-eu $(pwd) "$@" printf 'quoted text' -eu
+	-eu "$1" 2>/dev/null "$1" && 'quoted text' local
+| | x=1 --verbose test $(pwd) "$@" local awk local 'quoted text' x=1 && grep
+		printf $(pwd) /usr/bin ${HOME} 'quoted text' $(pwd) | "$1" readonly
+		${HOME} "$@" awk awk 'quoted text' test x=1 sed $(pwd) 2>/dev/null /usr/bin
+	readonly 'quoted text' -eu awk $(pwd) then "$@" | export echo
+		| ${HOME} readonly local "$@" test export export ${HOME} readonly "$@"
+then && echo echo "$@" test done printf $(pwd) test done done
+printf x=1 | awk readonly 2>/dev/null && $(pwd) printf "$@" $(pwd) 2>/dev/null
+		awk grep "$@" 'quoted text' | echo
+	2>/dev/null | printf $(pwd)
+readonly "$1" sed local readonly cd 2>/dev/null 'quoted text' "$@" /usr/bin
+printf ${HOME} -eu -eu && printf && readonly
+	export 2>/dev/null x=1 'quoted text'
+	&& grep --verbose readonly local | --verbose $(pwd)
+		printf --verbose echo x=1 echo local local
+		awk $(pwd) echo done cd sed
+		export local "$@" $(pwd) | ${HOME} local $(pwd) ${HOME} "$1"
+test "$1" ${HOME} awk grep export local printf
+		sed "$@" -eu local local x=1 awk
+	$(pwd) export 'quoted text' export "$@" cd printf "$1" readonly
+		local then cd sed $(pwd) x=1 readonly 'quoted text' ${HOME} readonly cd
+		&& local echo "$1" ${HOME} /usr/bin grep
+	done done "$@" $(pwd) awk -eu readonly
+	sed --verbose /usr/bin test printf
+	export awk "$@" readonly test done awk printf done "$1" local export done local
+printf done printf "$@" awk echo 'quoted text'
+		${HOME} test 2>/dev/null "$1" "$1" cd grep 2>/dev/null ${HOME} /usr/bin
+		&& test test 'quoted text' /usr/bin && printf && sed
+printf "$@" test local && "$1" grep awk test
+awk 2>/dev/null sed grep export $(pwd)
+		"$1" "$@" local "$1" awk 2>/dev/null local
+		grep sed echo "$1" /usr/bin | ${HOME} x=1 x=1 $(pwd) grep 2>/dev/null export /usr/bin
+		${HOME} test -eu -eu done grep sed "$@" ${HOME} x=1 $(pwd) ${HOME} cd export
+		--verbose "$@" 2>/dev/null 2>/dev/null
+		export readonly "$@" test echo local && export grep ${HOME} export 'quoted text'
+	$(pwd) "$1" cd "$@" echo readonly "$@" && cd "$1"
+	done printf cd sed && export done "$1"
+		| --verbose "$1" "$@" "$@" --verbose grep sed
+	-eu "$@" awk export cd x=1 echo | then export "$1" ${HOME} "$@"
+	$(pwd) printf /usr/bin readonly printf awk && /usr/bin
+-eu awk then readonly printf test ${HOME}
+	--verbose test printf grep printf /usr/bin local -eu sed x=1 && && 2>/dev/null
+		&& 'quoted text' x=1 then "$1" ${HOME} && echo echo
+	-eu then readonly test local
+	printf -eu -eu && cd sed awk echo 2>/dev/null
+$(pwd) $(pwd) cd export 2>/dev/null
+	2>/dev/null ${HOME} 2>/dev/null
+	${HOME} local --verbose test --verbose local
+		x=1 echo sed then grep $(pwd) cd /usr/bin $(pwd) 'quoted text' 2>/dev/null
+		cd /usr/bin /usr/bin | --verbose 2>/dev/null printf 'quoted text'
+'quoted text' grep --verbose $(pwd) "$@" readonly local
+	done "$1" --verbose readonly 2>/dev/null awk && test sed "$1" readonly x=1 then
+		-eu done ${HOME} printf -eu | then echo
+	"$1" 'quoted text' x=1 ${HOME} x=1 done &&
+	/usr/bin cd /usr/bin "$@" "$@" grep test done
+x=1 /usr/bin && "$1" export 'quoted text' /usr/bin "$1" grep
+	&& sed 'quoted text' cd sed cd --verbose | readonly test test
+test done local grep readonly "$1" "$@" local
+		&& then && 'quoted text' echo | ${HOME} readonly --verbose test /usr/bin
+/usr/bin x=1 /usr/bin test /usr/bin local test sed | local |
+&& $(pwd) /usr/bin then awk grep /usr/bin awk awk $(pwd)
+	echo done sed echo --verbose echo echo grep grep
+		then sed --verbose "$@" "$1" --verbose printf | && readonly 'quoted text'
+	echo 'quoted text' grep ${HOME} cd 'quoted text' cd local 'quoted text'
+done | 'quoted text' --verbose done readonly export
+"$1" -eu sed | then printf awk -eu 'quoted text'
+		readonly export grep sed /usr/bin | readonly
+2>/dev/null 'quoted text' test cd done test sed
+	test cd awk done ${HOME} done
+printf cd /usr/bin "$1" local readonly 2>/dev/null
+2>/dev/null local --verbose x=1 x=1 2>/dev/null test local echo grep
+	local | x=1 x=1 ${HOME}
+| printf ${HOME} "$1" -eu -eu then /usr/bin x=1 2>/dev/null local
+	-eu cd cd printf echo echo | sed echo -eu printf printf && then test && ${HOME}
+readonly 'quoted text' | | --verbose sed test then 2>/dev/null done sed &&
+		$(pwd) --verbose local echo --verbose x=1 -eu echo
+readonly "$@" | readonly /usr/bin x=1 /usr/bin "$@" test export grep export
+		sed cd 2>/dev/null done -eu printf
+		-eu local && x=1 x=1 printf x=1 -eu then echo
+		'quoted text' "$1" test local && test grep sed &&
+"$@" export cd -eu echo "$1" ${HOME} x=1 && $(pwd) done
+'quoted text' $(pwd) && -eu grep cd "$@" 2>/dev/null
+echo "$@" "$1" cd grep && --verbose
+		2>/dev/null x=1 local cd /usr/bin 2>/dev/null
+printf sed /usr/bin echo local
+	"$1" /usr/bin grep 2>/dev/null "$1" 'quoted text' awk local ${HOME}
+		"$@" export grep grep echo $(pwd) && awk --verbose x=1 && printf readonly
+		"$1" 'quoted text' export "$@" sed /usr/bin echo
+printf grep local $(pwd) /usr/bin ${HOME} sed | 'quoted text' x=1 sed 2>/dev/null
+local readonly $(pwd) then $(pwd) ${HOME} printf 'quoted text' awk readonly
+/usr/bin /usr/bin ${HOME} "$1" cd test | -eu sed then grep -eu cd grep
+export grep awk readonly
+	'quoted text' test && -eu sed "$@" "$1" /usr/bin grep cd x=1 readonly
+		"$@" 2>/dev/null 'quoted text' sed cd "$@" ${HOME}
+		done 'quoted text' echo
+local 'quoted text' sed local 'quoted text' | ${HOME} grep test grep ${HOME}
+		/usr/bin grep local test then sed sed done | local
+	| /usr/bin echo ${HOME}
+	/usr/bin $(pwd) $(pwd) /usr/bin 2>/dev/null local ${HOME} export
+		grep readonly test export x=1 test awk "$1"
+	${HOME} local 'quoted text' export /usr/bin x=1 grep && sed awk then "$@" readonly
+		--verbose readonly printf 'quoted text' grep /usr/bin && local |
+	cd && /usr/bin x=1 readonly 'quoted text'
+	--verbose done grep x=1 export 2>/dev/null
+	x=1 'quoted text' sed export done "$1" "$1" local && x=1 && x=1 && cd sed
+	local x=1 local printf --verbose
+${HOME} sed done export cd sed then sed done "$@" done
+		| x=1 /usr/bin test export grep "$@" printf export echo "$@"
+local /usr/bin "$1" printf done cd cd done
+		2>/dev/null /usr/bin done $(pwd) x=1 $(pwd) ${HOME} then 2>/dev/null cd test ${HOME}
+		/usr/bin printf 2>/dev/null local ${HOME} /usr/bin awk export awk printf done "$@"
+	"$1" awk /usr/bin local sed 'quoted text' test printf echo test
+		$(pwd) grep "$@" then test "$@"
+		local --verbose sed -eu ${HOME} 'quoted text'
+readonly local then local
+	awk test echo printf && && cd export export cd | printf done
+local | $(pwd) local /usr/bin printf cd local ${HOME} readonly | --verbose
+-eu "$1" done $(pwd) sed x=1 ${HOME} local printf cd then
+		local 2>/dev/null echo "$@" $(pwd) "$1" "$1" "$@" local done 'quoted text'
+2>/dev/null "$1" "$@" printf "$1" sed
+done -eu $(pwd) local readonly ${HOME}
+"$@" ${HOME} local x=1 cd printf done
+		sed readonly /usr/bin sed --verbose then
+	x=1 'quoted text' x=1 'quoted text' readonly awk $(pwd) done cd echo sed sed
+--verbose echo grep export --verbose then echo sed x=1 "$@" awk | "$1" printf "$@"
+		x=1 then $(pwd) test export grep grep x=1 | test awk --verbose
+local $(pwd) printf local ${HOME} ${HOME} x=1 |
+printf 2>/dev/null grep
+$(pwd) cd /usr/bin test
+x=1 echo | local echo "$@" grep "$@" | -eu
+echo /usr/bin "$1" 2>/dev/null local test local sed /usr/bin cd readonly ${HOME}
+		export ${HOME} "$1" test cd /usr/bin then /usr/bin
+	x=1 then /usr/bin ${HOME} sed x=1
+-eu then echo done --verbose then $(pwd) sed "$1" then
+		cd x=1 grep ${HOME} done printf
+	then awk /usr/bin ${HOME} -eu 'quoted text' local x=1 grep awk --verbose
+	cd | local export export grep readonly && "$@" --verbose export | --verbose awk
+		2>/dev/null -eu /usr/bin | sed grep
+-eu awk $(pwd) printf local awk done sed
+	"$1" local then 2>/dev/null
+		/usr/bin cd && printf -eu grep -eu grep echo awk grep printf sed x=1
+		${HOME} awk ${HOME} done "$@" "$1" --verbose --verbose test |
+readonly cd "$@" --verbose printf && "$@" | cd grep printf
+		readonly awk readonly done cd "$1" &&
+	grep && ${HOME} readonly done -eu -eu echo readonly export "$1" -eu readonly
+2>/dev/null 'quoted text' 2>/dev/null x=1 | 'quoted text'
+	readonly local echo done echo readonly done /usr/bin
+		sed 2>/dev/null | printf 2>/dev/null cd readonly
+		echo grep && printf done then x=1 x=1 /usr/bin local x=1
+done /usr/bin | then printf
+		'quoted text' then readonly "$@" grep $(pwd) local 'quoted text'
+	${HOME} readonly | 2>/dev/null | then
+'quoted text' --verbose "$1" $(pwd) done done
+	$(pwd) awk export sed --verbose sed x=1 &&
+/usr/bin export then "$@"
+	readonly 'quoted text' "$@" | $(pwd) 2>/dev/null printf readonly sed | --verbose
+	readonly && echo x=1 -eu
+	/usr/bin awk local && -eu export grep -eu "$1" 'quoted text'
+	-eu && local && "$1" readonly
+--verbose ${HOME} sed x=1 awk printf local then cd | x=1 | $(pwd) -eu echo
+-eu /usr/bin --verbose --verbose
+	-eu 'quoted text' /usr/bin cd then ${HOME} local
+done test ${HOME} readonly --verbose $(pwd) $(pwd) /usr/bin
+	'quoted text' echo --verbose then cd awk | grep "$1" printf export
+local sed done done done 'quoted text' $(pwd) readonly readonly
+		done "$@" sed test sed test sed local export
+	cd local x=1 export /usr/bin --verbose $(pwd) test local
+		grep echo "$1" "$@" x=1 grep | awk -eu local cd x=1 local "$1" readonly x=1 cd
+	awk | /usr/bin -eu awk echo | test x=1 | echo 'quoted text' /usr/bin | x=1 "$@"
+		'quoted text' $(pwd) /usr/bin
+grep --verbose | export echo -eu -eu grep --verbose "$1" "$@" then
+		readonly readonly 2>/dev/null grep $(pwd)
+	2>/dev/null done printf && echo echo export test "$1" test
+	'quoted text' printf x=1 -eu
+	awk && printf "$@" "$@" ${HOME} done --verbose x=1 then && && /usr/bin
+	test $(pwd) "$1" -eu grep "$1" test
+echo /usr/bin --verbose $(pwd) export /usr/bin /usr/bin then awk done test
+	done sed && x=1 "$@" --verbose readonly $(pwd) /usr/bin
+		sed export "$1" ${HOME} $(pwd) -eu
+awk "$1" /usr/bin cd local --verbose
+		-eu echo && done "$@" x=1 /usr/bin
+grep --verbose printf done $(pwd) x=1 $(pwd)
+		${HOME} | 2>/dev/null x=1 done cd "$@" awk "$@" then "$1" test
+		${HOME} /usr/bin "$@" export -eu 2>/dev/null --verbose "$@"
+		"$1" /usr/bin awk $(pwd) --verbose echo local 2>/dev/null printf then -eu ${HOME}
+'quoted text' ${HOME} 'quoted text' &&
+		2>/dev/null sed done $(pwd) then export --verbose "$@"
+test /usr/bin && then | && readonly test awk /usr/bin x=1 $(pwd)
+	test test --verbose ${HOME} grep then --verbose export 2>/dev/null
+2>/dev/null cd --verbose local "$@"
+-eu "$1" /usr/bin export $(pwd)
+	local then x=1 test export "$1" x=1 test | done /usr/bin
+readonly /usr/bin export 'quoted text' done
+test /usr/bin 'quoted text' "$@" cd sed 'quoted text'
+		| "$@" "$1" -eu 2>/dev/null /usr/bin printf
+	x=1 local "$1" cd echo "$1" readonly /usr/bin
+&& "$@" /usr/bin readonly
+		'quoted text' sed printf then echo awk echo 2>/dev/null
+		x=1 then --verbose /usr/bin x=1
+		then export "$@" echo 2>/dev/null /usr/bin ${HOME} sed x=1 ${HOME} 'quoted text'
+${HOME} cd x=1 local cd printf 'quoted text'
+		grep then x=1 -eu --verbose local done
+		printf done readonly cd
+readonly export then /usr/bin x=1 export export ${HOME} then
+	x=1 export done && 2>/dev/null done sed --verbose printf ${HOME} && local
+		cd done ${HOME} ${HOME} export readonly "$1" $(pwd) local "$1"
+--verbose | export echo
+		"$@" cd grep printf export then 2>/dev/null grep test done
+echo 'quoted text' --verbose grep --verbose && --verbose | readonly 'quoted text'
+	"$@" 2>/dev/null /usr/bin export then
+	sed echo awk /usr/bin 2>/dev/null && sed local done
+		&& $(pwd) /usr/bin "$@" awk /usr/bin /usr/bin $(pwd) | done
+	| -eu $(pwd) x=1 $(pwd) awk cd 'quoted text' /usr/bin sed
+	-eu done done 2>/dev/null -eu cd printf --verbose | printf
+	/usr/bin export && /usr/bin readonly sed 'quoted text' 2>/dev/null echo
+cd test ${HOME} then grep 2>/dev/null -eu $(pwd)
+$(pwd) export export export
+	printf printf | export | $(pwd)
+printf sed done sed export x=1 test export 2>/dev/null
+	readonly x=1 done done done "$1" sed done
+	readonly sed echo "$1" grep $(pwd)
+"$@" readonly echo cd grep printf
+printf done local export 2>/dev/null
+/usr/bin cd "$1" sed 2>/dev/null
+		test -eu && printf "$1" local $(pwd) grep
+	'quoted text' printf --verbose test grep "$1" done sed test && test then 2>/dev/null
+	cd done readonly | 2>/dev/null grep cd local -eu printf local
+	sed ${HOME} --verbose then $(pwd) && done
+	echo sed then sed x=1 then then /usr/bin readonly test "$@" ${HOME}
+readonly printf $(pwd) test export test local "$@" ${HOME} export | x=1 readonly
+	then 'quoted text' done echo | grep done readonly /usr/bin "$1" cd export export
+		awk -eu cd /usr/bin ${HOME} | sed grep $(pwd) && && test x=1 export
+'quoted text' $(pwd) done x=1 | cd printf awk echo x=1 grep sed $(pwd)
+		readonly 2>/dev/null sed ${HOME} awk export local x=1
+	$(pwd) x=1 --verbose | test /usr/bin
+	sed cd "$1" cd grep && "$@" x=1 ${HOME} export
+		done "$@" export readonly awk then echo /usr/bin ${HOME} printf | $(pwd)
+	2>/dev/null "$1" 2>/dev/null /usr/bin && /usr/bin
+	x=1 $(pwd) export printf local readonly 2>/dev/null
+/usr/bin $(pwd) ${HOME} | -eu
+	"$1" sed echo grep export export "$@" "$@"
+	done 'quoted text' 'quoted text'
+	-eu done done readonly --verbose -eu -eu sed 2>/dev/null $(pwd) "$1" then test
+grep && /usr/bin 'quoted text' readonly
+| | test awk printf awk --verbose /usr/bin ${HOME} | ${HOME} grep grep local
+		cd sed "$@" grep export
+local cd --verbose /usr/bin 2>/dev/null
+x=1 --verbose then && echo done echo
+${HOME} cd local echo printf readonly then "$1"
+		-eu awk done "$@" test /usr/bin ${HOME} | awk -eu echo /usr/bin awk "$1" 2>/dev/null
+export grep test cd | x=1 -eu done --verbose cd readonly
+2>/dev/null ${HOME} -eu printf export | ${HOME} echo
+	"$@" "$@" awk printf test
+then "$@" readonly 2>/dev/null x=1 export $(pwd) && ${HOME} cd test
+	| readonly sed then grep ${HOME}
+$(pwd) local "$1" grep | "$@" "$1" x=1 2>/dev/null
+		&& then ${HOME} 'quoted text' /usr/bin readonly then then then 2>/dev/null
+	-eu --verbose ${HOME} ${HOME} $(pwd) --verbose export "$@" readonly /usr/bin
+		x=1 echo $(pwd) $(pwd) "$1" grep then /usr/bin ${HOME} --verbose /usr/bin
+$(pwd) printf then test /usr/bin awk then --verbose
+		test sed cd $(pwd) "$@" grep echo readonly cd 2>/dev/null cd test $(pwd)
+-eu "$@" test local 'quoted text' x=1 "$@"
+	sed 2>/dev/null 'quoted text' printf readonly | readonly local printf
+export -eu /usr/bin | then $(pwd) cd --verbose -eu 'quoted text'
+&& readonly local printf export
+-eu readonly grep /usr/bin $(pwd) echo -eu then x=1 'quoted text'
+	grep /usr/bin test ${HOME} done then cd "$@"
+	echo local done x=1 export readonly
+		2>/dev/null local sed "$1" --verbose
+-eu x=1 x=1 local 2>/dev/null done 2>/dev/null printf -eu cd cd /usr/bin
+	sed 2>/dev/null && | | then /usr/bin awk cd grep grep test -eu done local "$1"
+		grep cd "$1" "$1" readonly ${HOME} test cd
+--verbose && /usr/bin 2>/dev/null grep ${HOME}
+		/usr/bin x=1 done cd done && cd printf test
+then readonly grep test export cd && echo x=1 x=1 cd "$@"
+2>/dev/null then cd "$@" x=1 2>/dev/null done $(pwd) test grep
+		${HOME} test awk readonly
+	"$@" 'quoted text' /usr/bin test done awk echo 'quoted text' | done export
+awk -eu --verbose && export
+	$(pwd) export printf | --verbose grep "$1" export | x=1 "$1" x=1 /usr/bin
+		'quoted text' /usr/bin export test sed grep done --verbose export
+awk "$@" x=1 then -eu echo local ${HOME} "$1" cd x=1 readonly then
+	then test sed ${HOME} then /usr/bin
+x=1 && "$@" "$@" printf readonly "$@" ${HOME} "$@"
+		-eu 'quoted text' --verbose /usr/bin export
+	/usr/bin printf "$@" "$@" then $(pwd) done $(pwd) export printf
+cd "$@" x=1 "$@" "$@" test /usr/bin then sed sed export --verbose
+	test --verbose export -eu /usr/bin ${HOME} |
@@ -0,0 +1,2001 @@
+then printf echo sed /usr/bin grep done 2>/dev/null echo
+	$(pwd) | 'quoted text' x=1 sed local
+		echo 'quoted text' ${HOME}
+then x=1 --verbose 'quoted text' -eu 'quoted text' local ${HOME} x=1 ${HOME} cd
+		| sed printf x=1 local printf "$1" sed test sed local --verbose
+		x=1 x=1 printf 2>/dev/null done
+	sed | && done "$1" export export cd 2>/dev/null |
+	awk "$@" "$1" -eu local | 2>/dev/null
+		${HOME} "$@" done | done printf
+"$@" "$1" cd done && echo cd /usr/bin "$@" export export $(pwd) 2>/dev/null
+		$(pwd) done "$@" then --verbose grep "$1" $(pwd)
+printf --verbose then -eu export $(pwd) cd test x=1 sed printf
+		readonly awk cd grep --verbose /usr/bin
+/usr/bin 'quoted text' then /usr/bin printf done cd local && -eu
+		/usr/bin test /usr/bin 2>/dev/null export local /usr/bin
+--verbose printf test -eu && /usr/bin done 2>/dev/null test
+	printf echo export $(pwd)
+	awk && x=1 readonly /usr/bin
+	sed | awk echo && done grep 'quoted text' /usr/bin
+"$@" /usr/bin 2>/dev/null 2>/dev/null 'quoted text'
+then local sed ${HOME} grep cd && && ${HOME} | ${HOME} test $(pwd) /usr/bin sed
+		x=1 cd local /usr/bin local echo 2>/dev/null done done done ${HOME} --verbose
+test cd awk echo export -eu then && /usr/bin cd cd "$@" then 'quoted text'
+		printf x=1 x=1 2>/dev/null
+		then readonly $(pwd) x=1 x=1 readonly sed export
+		&& sed cd ${HOME} | test /usr/bin
+		${HOME} $(pwd) readonly echo 2>/dev/null done --verbose readonly
+	"$1" then $(pwd) --verbose ${HOME} /usr/bin printf awk x=1 awk cd cd
+		awk -eu export ${HOME} grep readonly export 2>/dev/null
+		then "$@" --verbose printf grep /usr/bin readonly done test
+/usr/bin grep -eu && "$1" test 2>/dev/null export --verbose
+done awk cd test 2>/dev/null cd done
+	${HOME} 2>/dev/null readonly export | sed x=1 -eu grep --verbose
+echo x=1 sed /usr/bin 'quoted text'
+	then then grep 'quoted text' readonly $(pwd) && readonly then printf x=1 /usr/bin
+	cd then -eu /usr/bin awk --verbose --verbose && grep cd "$@"
+	| | done export && /usr/bin x=1 $(pwd) readonly export
+	| x=1 local test export
+export && --verbose grep $(pwd) -eu 'quoted text' "$1" "$1" echo |
+test then sed x=1 cd then grep
+	export /usr/bin $(pwd) local
+		x=1 "$1" then 2>/dev/null 'quoted text' "$1"
+		echo then ${HOME} 2>/dev/null
+		/usr/bin then 'quoted text' 'quoted text' grep printf readonly /usr/bin
+readonly done "$@" printf cd 2>/dev/null && x=1 echo
+		local export readonly test -eu /usr/bin
+/usr/bin local 'quoted text' test grep
+| test sed && cd local awk grep test -eu -eu
+export 'quoted text' -eu local test cd done "$@" test then
+	/usr/bin $(pwd) && awk && 2>/dev/null done /usr/bin
+done cd readonly printf "$@" then export "$@" --verbose
+		--verbose "$@" sed --verbose printf
+awk echo readonly cd sed then then "$@"
+	echo done --verbose done | export 'quoted text'
+&& cd echo -eu readonly -eu
+	local local --verbose
+2>/dev/null readonly export export | --verbose done ${HOME} "$@"
+	then local echo x=1 x=1 $(pwd) "$@" -eu &&
+		2>/dev/null 2>/dev/null 'quoted text' local 'quoted text' ${HOME} cd echo awk
+		awk awk -eu export sed "$@" test done /usr/bin test printf printf cd then test
+	&& x=1 readonly x=1 sed x=1 --verbose cd x=1 printf "$@" && cd readonly
+x=1 done 2>/dev/null 2>/dev/null
+	2>/dev/null --verbose awk cd 2>/dev/null 2>/dev/null
+		test then cd printf export $(pwd) echo awk then
+	--verbose sed awk $(pwd) done cd ${HOME} readonly -eu export grep
+/usr/bin --verbose cd test ${HOME} 2>/dev/null
+		local x=1 2>/dev/null then "$1" /usr/bin then x=1
+test echo cd test export | echo local
+	cd -eu readonly -eu sed 'quoted text' --verbose done
+'quoted text' | awk "$@" -eu $(pwd) | local
+-eu sed | "$1" test cd local ${HOME}
+2>/dev/null sed x=1 local "$1" "$@" sed --verbose --verbose
+sed | export done && -eu sed "$@" | cd x=1 2>/dev/null 'quoted text' /usr/bin
+		printf readonly "$@" printf local "$1" "$@" "$1" readonly echo grep
+		grep awk /usr/bin && x=1 | -eu then export export --verbose /usr/bin test /usr/bin
+		/usr/bin | awk 2>/dev/null
+	sed "$@" then /usr/bin printf ${HOME} | && then done then done
+awk awk readonly readonly ${HOME} local echo
+		then 2>/dev/null then printf printf awk awk export sed export $(pwd) $(pwd) "$1"
+	'quoted text' -eu cd grep -eu | sed readonly grep "$1" grep local done
+	-eu cd --verbose && sed done sed cd
+		/usr/bin -eu --verbose "$@" readonly sed
+"$@" then /usr/bin "$1" $(pwd) "$@" sed cd | x=1 test "$@" sed echo x=1
+${HOME} 'quoted text' ${HOME} --verbose grep done sed ${HOME} export 'quoted text'
+	local --verbose sed && printf done test test 2>/dev/null ${HOME}
+done grep local grep "$@"
+&& done | /usr/bin awk && cd -eu -eu printf test --verbose done
+echo cd 2>/dev/null test -eu local local ${HOME}
+'quoted text' export awk then cd readonly
+		-eu test "$@" 2>/dev/null done --verbose
+		test "$1" | $(pwd) /usr/bin local 'quoted text' readonly awk grep && local --verbose
+		'quoted text' x=1 && --verbose | && done awk grep | echo 'quoted text'
+	done --verbose readonly x=1 cd export done readonly readonly then
+		| echo sed | | local $(pwd) && -eu x=1
+		local awk "$@" awk cd 'quoted text'
+test | 2>/dev/null /usr/bin 'quoted text' export cd
+	export readonly | sed && | /usr/bin awk local printf
+		2>/dev/null grep | then readonly awk test
+echo grep x=1 cd test --verbose cd readonly
+		$(pwd) x=1 local && | ${HOME}
+	2>/dev/null echo 'quoted text'
+--verbose then ${HOME} cd then local 2>/dev/null readonly done x=1 --verbose
+	local 2>/dev/null grep --verbose test x=1 local | then
+test --verbose --verbose then 'quoted text'
+-eu printf $(pwd) then test /usr/bin
+		grep done ${HOME} grep ${HOME}
+local readonly then x=1 then x=1 echo
+	2>/dev/null then test cd && "$1" -eu
+grep local ${HOME} -eu sed awk local cd
+	2>/dev/null --verbose --verbose printf --verbose -eu awk echo $(pwd) 2>/dev/null
+		"$@" x=1 local /usr/bin
+	${HOME} readonly export /usr/bin cd
+'quoted text' test | export && "$1" sed 'quoted text' $(pwd) /usr/bin
+export cd | "$1" echo
+	${HOME} sed "$1" export -eu then test && -eu sed echo x=1 "$@"
+		| x=1 /usr/bin && 2>/dev/null echo -eu printf 2>/dev/null ${HOME} then export
+sed local --verbose printf printf --verbose
+grep printf printf "$1" local x=1 x=1 export cd export 2>/dev/null 2>/dev/null
+local /usr/bin && printf "$1" sed /usr/bin "$1" grep grep
+		x=1 ${HOME} x=1 x=1 grep
+export 'quoted text' export cd
+		$(pwd) then /usr/bin -eu test done echo readonly 2>/dev/null
+then then cd x=1 echo x=1 export awk "$1" ${HOME}
+"$@" grep $(pwd) printf printf /usr/bin 'quoted text' 'quoted text' local 2>/dev/null
+	done readonly printf readonly
+| echo x=1 ${HOME} echo $(pwd) local awk then /usr/bin readonly ${HOME}
+x=1 export echo cd --verbose ${HOME}
+export printf && export -eu x=1
+	printf readonly ${HOME} x=1 "$@" | export $(pwd) printf /usr/bin "$@"
+		local | x=1 --verbose $(pwd) export readonly grep /usr/bin | printf
+	then "$1" -eu "$@" echo awk
+readonly "$@" grep grep cd "$1"
+		printf -eu sed export then "$@" 'quoted text'
+		"$@" sed cd done awk 'quoted text' -eu then "$1" &&
+	readonly $(pwd) test -eu "$1" export
+		2>/dev/null --verbose /usr/bin /usr/bin sed sed x=1 done then grep | 'quoted text'
+		local && --verbose export ${HOME} -eu
+		"$1" /usr/bin echo echo x=1 $(pwd) readonly then "$1" --verbose readonly
+		'quoted text' printf sed /usr/bin "$@" echo --verbose done 'quoted text'
+--verbose export test then "$@" sed | && awk printf ${HOME} local
+	grep && /usr/bin "$@" | && export cd test &&
+	readonly cd ${HOME} 2>/dev/null && test /usr/bin local awk
+then 'quoted text' "$@"
+	"$1" x=1 -eu "$1" local cd
+-eu 'quoted text' "$@" cd /usr/bin "$1" then "$@" $(pwd) awk "$@"
+/usr/bin | "$1" sed then awk printf grep done readonly
+	cd cd echo local printf
+	2>/dev/null -eu printf export cd then cd readonly "$1" cd /usr/bin 'quoted text'
+	printf export sed export 'quoted text' /usr/bin
+		local "$1" --verbose then readonly /usr/bin
+		/usr/bin && "$@" 'quoted text' local | x=1 | 'quoted text'
+echo "$1" -eu grep echo "$1" cd "$@" test echo /usr/bin
+	then readonly then | export
+sed $(pwd) local 'quoted text' local
+	cd /usr/bin awk | awk 'quoted text'
+sed ${HOME} local /usr/bin export -eu 'quoted text' x=1
+echo -eu export awk 2>/dev/null $(pwd) echo x=1
+	awk $(pwd) "$1" test --verbose export local 'quoted text'
+	x=1 --verbose sed --verbose grep readonly | done --verbose export
+| echo echo -eu x=1 readonly cd readonly $(pwd)
+	awk test then local printf local /usr/bin "$@" export "$1"
+	x=1 | done -eu printf done test then export 2>/dev/null
+grep && echo then test --verbose && | local export 2>/dev/null $(pwd) cd done
+printf done x=1 | done done && "$1" "$1" $(pwd) /usr/bin ${HOME} then
+	sed | echo local export "$1" ${HOME} | -eu
+		"$@" then local local test x=1 2>/dev/null
+$(pwd) -eu done echo "$1" "$@" && test readonly /usr/bin && test "$1" 'quoted text'
+		| echo done "$@" "$@" "$@" "$1" 'quoted text' cd | awk 2>/dev/null then
+		2>/dev/null | $(pwd) -eu 2>/dev/null x=1 export x=1 $(pwd) "$1"
+readonly readonly grep /usr/bin test export awk &&
+${HOME} printf x=1 && "$@" -eu cd cd "$@" 2>/dev/null
+		&& awk 2>/dev/null 2>/dev/null -eu readonly "$1" cd -eu
+	sed --verbose -eu awk awk export printf "$@" awk "$1" grep | "$@" cd /usr/bin export
+	2>/dev/null | /usr/bin
+	awk test readonly 'quoted text'
+		local "$@" grep local /usr/bin && ${HOME} printf
+	readonly ${HOME} ${HOME} "$@" awk && -eu readonly &&
+	sed $(pwd) cd "$@" "$@" printf test -eu printf sed &&
+	export --verbose echo 2>/dev/null
+	"$1" printf printf | readonly sed --verbose /usr/bin 2>/dev/null "$@" printf local
+local local awk cd | awk "$@"
+		| 'quoted text' -eu echo export
+	/usr/bin export export ${HOME}
+echo x=1 "$@" x=1 export
+		printf "$@" x=1 local printf cd export cd 2>/dev/null "$1" ${HOME} export
+printf then ${HOME} && 2>/dev/null
+		local $(pwd) 'quoted text' 2>/dev/null grep awk cd -eu "$@"
+		| readonly export sed test $(pwd) && readonly ${HOME} grep cd 2>/dev/null
+	sed readonly done "$@" done --verbose cd readonly local echo
+		| done --verbose cd "$1" | export $(pwd) test readonly then printf $(pwd) cd ${HOME}
+		| "$1" --verbose && echo x=1 grep && 2>/dev/null
+test $(pwd) 2>/dev/null --verbose | | sed then echo 'quoted text'
+-eu $(pwd) x=1 echo ${HOME} export
+	-eu --verbose local $(pwd) cd
+local test 2>/dev/null done grep x=1 --verbose readonly $(pwd) "$1"
+	echo $(pwd) --verbose export
+		'quoted text' 2>/dev/null done done && | /usr/bin 'quoted text' && "$1" /usr/bin
+&& export x=1 "$1" x=1 -eu echo test
+		&& "$@" "$@" cd ${HOME} readonly && x=1 awk && test "$@" printf --verbose
+readonly x=1 "$1" && awk awk readonly 'quoted text'
+&& -eu done "$@" grep grep "$@" grep then
+	2>/dev/null test grep "$@" 'quoted text' cd | /usr/bin
+		local test then | && --verbose "$@" cd export sed export ${HOME} $(pwd)
+then export then 'quoted text'
+		$(pwd) | ${HOME} "$@" | && readonly | echo $(pwd) -eu done printf
+	done test then --verbose -eu local sed /usr/bin then $(pwd)
+awk /usr/bin 'quoted text' ${HOME} x=1 readonly
+		/usr/bin cd done awk "$@" "$1" | "$1" "$1" /usr/bin readonly printf /usr/bin
+	$(pwd) done grep x=1 -eu sed echo "$@"
+	test /usr/bin /usr/bin x=1
+-eu $(pwd) /usr/bin | "$1" printf -eu test /usr/bin printf --verbose "$@"
+	export /usr/bin sed "$@" "$@" -eu $(pwd) export test
+		&& then -eu printf /usr/bin cd /usr/bin cd
+export -eu local then cd -eu done
+	$(pwd) --verbose done then 'quoted text'
+		--verbose /usr/bin $(pwd) && x=1 grep cd "$1" cd x=1
+		$(pwd) 'quoted text' && /usr/bin grep "$1" x=1 -eu "$@" "$@" 2>/dev/null
+		then /usr/bin "$1" 2>/dev/null x=1 -eu /usr/bin $(pwd)
+/usr/bin | then export test $(pwd) | -eu
+cd sed done ${HOME} printf --verbose local readonly
+		then && 'quoted text' sed cd --verbose
+		${HOME} && echo then echo export 'quoted text' | readonly printf echo
+	awk -eu local local | -eu -eu /usr/bin echo | x=1 export
+echo sed echo "$@" grep ${HOME} -eu printf -eu echo $(pwd) /usr/bin
+	sed -eu sed | local 2>/dev/null printf local ${HOME} export then && && $(pwd)
+		2>/dev/null export --verbose
+		2>/dev/null $(pwd) test 2>/dev/null cd test 2>/dev/null cd awk ${HOME}
+	cd grep 2>/dev/null && done
+		&& 'quoted text' local 2>/dev/null
+	sed test then "$@" done x=1
+grep x=1 echo printf awk printf export sed ${HOME} readonly
+		cd sed local test printf
+	/usr/bin "$@" "$1" && awk export echo
+-eu "$1" then "$@" ${HOME} | --verbose
+	cd grep x=1 $(pwd) /usr/bin echo done --verbose | export awk
+	x=1 grep $(pwd) "$@" grep export && test x=1 echo -eu
+awk "$1" /usr/bin --verbose then /usr/bin && && 'quoted text' grep $(pwd)
+	then then | ${HOME} &&
+x=1 2>/dev/null ${HOME} ${HOME} 2>/dev/null export
+		then readonly "$@" $(pwd) done x=1 local done -eu -eu
+readonly then export echo awk local test $(pwd) 'quoted text'
+		-eu printf "$@" "$1" /usr/bin 2>/dev/null "$@" x=1 2>/dev/null sed && "$@" $(pwd)
+	done then && then && printf /usr/bin cd /usr/bin
+	sed "$1" awk printf "$@" test --verbose local 2>/dev/null /usr/bin then ${HOME}
+		'quoted text' awk -eu done cd /usr/bin 2>/dev/null -eu grep awk ${HOME} done
+local 'quoted text' -eu && done --verbose echo echo $(pwd) printf awk
+	"$@" done awk echo x=1 "$@" 2>/dev/null "$1" --verbose 2>/dev/null
+export cd | -eu "$1" export x=1 && grep
+		$(pwd) export | 2>/dev/null local
+		--verbose awk printf readonly | awk "$@" test export | 'quoted text'
+		x=1 export export echo 2>/dev/null awk
+	--verbose then readonly | readonly "$1"
+/usr/bin printf done printf sed 2>/dev/null awk done
+	&& --verbose "$1" --verbose then "$@"
+'quoted text' readonly ${HOME} --verbose printf "$1"
+		-eu echo then local && printf -eu sed grep "$1" -eu $(pwd) --verbose ${HOME} &&
+	&& --verbose --verbose 2>/dev/null x=1 sed /usr/bin
+--verbose --verbose ${HOME} local
+		local "$@" -eu grep sed then export printf "$@" "$1" echo x=1 export awk cd grep
+	${HOME} sed x=1 echo export
+		local export printf x=1 sed awk -eu sed "$1"
+&& && export -eu export echo readonly readonly local
+	grep /usr/bin x=1 export
+		test local | x=1 -eu then $(pwd)
+	echo "$@" && -eu then 2>/dev/null
+	'quoted text' export 2>/dev/null | local grep
+		"$@" test done then /usr/bin $(pwd) grep
+"$@" then test test sed && sed export $(pwd) awk awk "$1" x=1 --verbose echo
+local "$1" local test "$@" "$1" "$1" /usr/bin readonly
+		done /usr/bin "$@" echo printf ${HOME}
+	grep printf | 2>/dev/null export "$@" echo -eu 2>/dev/null cd x=1 echo
+	"$1" test printf && 'quoted text'
+		"$1" x=1 printf echo
+x=1 2>/dev/null test 2>/dev/null
+		local test then local 2>/dev/null $(pwd) done printf grep then readonly
+		test echo | -eu sed then awk echo ${HOME} | "$@"
+	"$1" sed /usr/bin echo x=1 2>/dev/null awk 2>/dev/null printf
+readonly export echo then export x=1 echo -eu local grep printf
+	done readonly test /usr/bin printf && --verbose 2>/dev/null "$@" local export
+grep 'quoted text' awk cd test | /usr/bin 2>/dev/null $(pwd) && 'quoted text'
+		-eu export "$1" sed -eu export printf cd "$1" export /usr/bin "$@"
+		| done sed $(pwd) /usr/bin done then export $(pwd) grep
+local "$1" -eu && cd -eu x=1 local
+		grep ${HOME} readonly grep && local
+		&& cd readonly printf awk
+		cd printf sed cd | done then awk 'quoted text' cd
+		-eu export $(pwd) export -eu
+	local sed printf --verbose "$@" test "$1" test export done --verbose ${HOME}
+"$@" | test -eu cd /usr/bin "$1" local ${HOME} "$1" sed readonly
+		then 2>/dev/null x=1 done printf printf 2>/dev/null
+	x=1 2>/dev/null then $(pwd) done
+&& sed test && done ${HOME} grep --verbose && x=1 -eu sed grep $(pwd) /usr/bin
+	done test echo local ${HOME} grep /usr/bin $(pwd) 'quoted text'
+	${HOME} $(pwd) -eu ${HOME} x=1 awk awk cd | --verbose then $(pwd) "$@" then && x=1
+'quoted text' 'quoted text' "$@" test --verbose then "$@" local /usr/bin
+then -eu done 'quoted text' then done grep done readonly printf --verbose local
+	$(pwd) && test test echo "$1" sed done | --verbose ${HOME} awk export
+'quoted text' 'quoted text'
+		local cd echo | "$1" test
+	readonly "$@" && x=1 cd 'quoted text' local "$@" sed sed /usr/bin
+		&& local local then x=1 test ${HOME} export
+"$1" /usr/bin /usr/bin $(pwd) 2>/dev/null x=1 x=1 /usr/bin -eu
+then $(pwd) cd 2>/dev/null x=1 ${HOME} /usr/bin "$1" echo then &&
+		x=1 sed done grep then 2>/dev/null -eu /usr/bin done done "$@" /usr/bin
+-eu 'quoted text' sed 'quoted text' awk
+		test -eu && done 2>/dev/null && then /usr/bin
+		| done $(pwd) $(pwd) readonly 2>/dev/null -eu then grep sed readonly readonly
+	&& --verbose 'quoted text'
+--verbose /usr/bin x=1 "$@" "$@" 'quoted text' echo then export
+then awk local --verbose sed && export local readonly /usr/bin
+	/usr/bin printf | local sed -eu local x=1 echo 2>/dev/null 'quoted text'
+done done && /usr/bin "$@" $(pwd) local sed /usr/bin
+'quoted text' echo x=1 "$@" /usr/bin ${HOME} "$@" 'quoted text' /usr/bin
+--verbose export sed printf x=1 grep --verbose "$1" grep
+	awk $(pwd) ${HOME} echo grep x=1
+$(pwd) test export grep done x=1 then
+echo 'quoted text' 2>/dev/null local x=1 done ${HOME}
+	x=1 echo -eu 'quoted text'
+	sed export -eu 'quoted text' done readonly && local
+		-eu "$@" --verbose echo export grep 2>/dev/null export done -eu test 2>/dev/null
+-eu printf 'quoted text' sed awk $(pwd) sed && cd $(pwd) local done awk awk $(pwd)
+		${HOME} done "$@" export export | | then x=1 done $(pwd) done $(pwd) "$@"
+export printf x=1 sed printf grep 'quoted text'
+'quoted text' 'quoted text'
+awk -eu -eu | readonly echo grep readonly x=1 local printf
+	echo then cd cd local grep $(pwd) --verbose test
+	cd grep $(pwd) test readonly then awk readonly printf
+	2>/dev/null --verbose local
+		$(pwd) /usr/bin test readonly echo done $(pwd) readonly
+export done /usr/bin 2>/dev/null "$1" export then readonly test 'quoted text'
+		$(pwd) x=1 done $(pwd) done x=1 cd /usr/bin && export -eu x=1 x=1
+		printf -eu local readonly "$1" export then "$1" --verbose /usr/bin
+	"$@" "$1" /usr/bin --verbose x=1 cd grep
+cd sed grep "$1" local --verbose
+		--verbose readonly readonly /usr/bin done $(pwd) $(pwd)
+	sed ${HOME} "$@" && "$1" ${HOME} -eu x=1
+	echo -eu cd done then awk grep cd awk | done export -eu
+	grep && "$1" cd $(pwd) cd
+/usr/bin then then -eu done 'quoted text' done -eu --verbose $(pwd)
+		--verbose "$1" 2>/dev/null x=1 "$@"
+-eu -eu export x=1 readonly "$1" done | local --verbose --verbose
+$(pwd) printf printf && readonly grep
+		grep test sed then ${HOME} --verbose export --verbose cd /usr/bin "$1" "$1"
+	$(pwd) $(pwd) local --verbose
+		cd export -eu 'quoted text' test
+x=1 --verbose --verbose then
+	readonly 2>/dev/null printf then "$1" local
+-eu x=1 grep grep /usr/bin 2>/dev/null
+	'quoted text' readonly grep x=1 x=1 sed grep readonly printf local test
+		grep --verbose "$@" cd | test ${HOME}
+		readonly cd ${HOME} done 2>/dev/null 2>/dev/null
+	"$@" 'quoted text' -eu "$1" "$1" 2>/dev/null
+'quoted text' x=1 --verbose x=1 ${HOME}
+awk 'quoted text' "$1" $(pwd) local 2>/dev/null cd x=1
+-eu "$@" -eu && cd grep printf -eu --verbose 2>/dev/null
+	'quoted text' --verbose x=1
+		$(pwd) "$@" local export grep
+	'quoted text' "$1" && ${HOME} local
+	&& awk 'quoted text' 'quoted text'
+awk 'quoted text' $(pwd) done cd readonly x=1
+	$(pwd) then ${HOME} 'quoted text' export ${HOME} awk 2>/dev/null
+		'quoted text' /usr/bin --verbose printf /usr/bin "$1" 'quoted text' test
+&& $(pwd) test test done grep awk awk x=1 ${HOME} /usr/bin 2>/dev/null
+	/usr/bin cd 'quoted text' 'quoted text'
+'quoted text' readonly then awk ${HOME}
+	$(pwd) $(pwd) awk then x=1 test $(pwd) 'quoted text' cd x=1 printf "$1"
+done test echo cd readonly
+	echo $(pwd) --verbose then echo then readonly
+x=1 && grep then -eu local
+	done "$1" echo "$@" awk readonly | -eu local | "$@" sed local
+		${HOME} sed local cd test sed local $(pwd) x=1
+	/usr/bin sed && echo | $(pwd)
+	'quoted text' awk $(pwd) readonly 'quoted text' ${HOME}
+		local --verbose done done readonly cd ${HOME} awk 'quoted text'
+awk readonly "$1" "$@" 2>/dev/null cd --verbose && printf $(pwd) echo ${HOME}
+		export printf "$@" x=1 $(pwd) 'quoted text' | -eu $(pwd) readonly
+		export then cd done then cd | "$@" 2>/dev/null
+		awk local grep "$@" 'quoted text' grep done "$@" "$@" ${HOME}
+	&& /usr/bin -eu /usr/bin export
+test $(pwd) then "$1" 2>/dev/null && export "$@" --verbose printf "$@"
+	then echo --verbose $(pwd) cd --verbose echo test x=1
+grep test readonly -eu "$@" $(pwd)
+	$(pwd) "$@" done export --verbose export echo awk local x=1
+		then -eu 2>/dev/null awk
+		'quoted text' echo -eu then done |
+		--verbose cd 'quoted text' sed 'quoted text'
+	echo awk awk readonly 'quoted text' /usr/bin | printf x=1 then
+		grep --verbose "$1" grep local "$1" "$1" "$1"
+		"$@" --verbose 'quoted text'
+sed printf ${HOME} /usr/bin test
+$(pwd) $(pwd) ${HOME} grep printf echo done cd
+	sed "$@" grep grep sed && 2>/dev/null /usr/bin
+		export $(pwd) x=1 -eu cd cd sed echo
+	"$1" readonly then local | echo -eu
+		local test 'quoted text'
+		${HOME} export "$1" x=1 "$@" | x=1 /usr/bin ${HOME} export && export echo
+2>/dev/null "$1" readonly --verbose echo
+$(pwd) cd then /usr/bin "$@" "$@" readonly $(pwd) $(pwd) export local export
+		"$1" "$@" export /usr/bin local ${HOME} test echo && echo /usr/bin
+${HOME} && ${HOME} local /usr/bin
+printf "$@" "$@" test grep
+printf awk grep 2>/dev/null 2>/dev/null && --verbose ${HOME} | 2>/dev/null ${HOME}
+		echo readonly | "$1" echo $(pwd) awk grep | sed 2>/dev/null x=1 'quoted text'
+printf printf then echo x=1 "$@" /usr/bin ${HOME} sed "$@" readonly
+		cd cd export cd /usr/bin echo && ${HOME} $(pwd)
+		local /usr/bin 2>/dev/null
+		| test cd readonly cd sed echo
+	$(pwd) x=1 "$@" "$@" x=1 ${HOME}
+	x=1 "$1" "$1" $(pwd) sed -eu $(pwd) -eu sed grep awk
+	printf 'quoted text' | "$@" local --verbose cd local | printf echo $(pwd)
+	then echo test 2>/dev/null && sed 'quoted text' /usr/bin cd sed export
+		-eu 2>/dev/null && local && | x=1 export "$1" test $(pwd) sed /usr/bin sed
+	"$@" ${HOME} sed ${HOME} $(pwd) --verbose
+	local "$1" awk $(pwd) x=1 printf awk grep x=1 cd awk 2>/dev/null local
+		"$@" --verbose sed readonly | cd grep -eu -eu echo
+2>/dev/null test 2>/dev/null awk readonly 'quoted text'
+--verbose done local readonly
+		&& "$1" printf done --verbose done "$@" x=1 sed
+awk test local test && &&
+		grep "$1" --verbose echo test ${HOME} printf "$@" echo cd cd | then -eu
+| awk echo test grep && /usr/bin echo -eu "$@" x=1 /usr/bin /usr/bin
+2>/dev/null /usr/bin cd then local test ${HOME} done -eu 'quoted text'
+		/usr/bin export cd 2>/dev/null cd /usr/bin -eu -eu -eu cd "$1" "$@"
+		"$@" 'quoted text' --verbose
+$(pwd) "$1" "$1" x=1 grep echo echo ${HOME} | "$1" sed && awk local sed
+	| cd && -eu "$1" cd sed /usr/bin
+${HOME} ${HOME} $(pwd) && 'quoted text' readonly echo awk printf then printf
+&& --verbose done -eu 2>/dev/null --verbose printf "$1" grep then
+grep sed test 'quoted text' done -eu 2>/dev/null | local $(pwd)
+awk | export sed cd 'quoted text'
+echo sed /usr/bin echo -eu readonly x=1 readonly
+sed "$@" readonly "$1" && /usr/bin readonly $(pwd) $(pwd) 'quoted text'
+	"$@" --verbose 'quoted text' 2>/dev/null awk echo echo ${HOME} x=1 /usr/bin
+		sed printf --verbose --verbose awk && && x=1 'quoted text' &&
+	/usr/bin awk printf 'quoted text' export
+		then readonly "$1" cd export "$@" 'quoted text' grep "$1" "$1"
+cd "$1" "$1" awk then x=1 echo test 2>/dev/null -eu local | -eu then grep
+--verbose ${HOME} cd readonly then x=1 ${HOME} -eu | test sed -eu x=1
+2>/dev/null grep x=1 then --verbose then | grep && export 'quoted text'
+		| export "$@" $(pwd) --verbose
+	x=1 sed local done then then export sed 'quoted text' echo
+test | grep 'quoted text' && "$1" printf "$1" export ${HOME}
+then printf "$1" | ${HOME} -eu /usr/bin
+	"$1" printf readonly grep x=1
+		&& ${HOME} $(pwd) ${HOME} && local
+		awk sed awk export echo sed
+		| --verbose cd awk test 2>/dev/null then awk test printf export awk && ${HOME}
+	--verbose export ${HOME} done ${HOME} 2>/dev/null
+&& x=1 awk readonly && && "$1" echo
+		$(pwd) --verbose printf "$@" done /usr/bin
+'quoted text' done "$1" && ${HOME}
+	&& echo grep done -eu ${HOME} -eu done x=1 'quoted text' export then
+-eu sed grep local cd /usr/bin printf done export
+	echo readonly $(pwd) ${HOME}
+	-eu $(pwd) /usr/bin then test -eu readonly && | echo export grep --verbose
+		"$@" grep -eu local sed readonly printf
+cd awk awk x=1 'quoted text' export "$@" && grep && --verbose awk "$1"
+		x=1 --verbose then test ${HOME} awk grep sed then echo cd echo
+	| test -eu 2>/dev/null
+		test done cd readonly | local x=1 export done awk 2>/dev/null x=1 --verbose | awk
+	$(pwd) --verbose printf /usr/bin x=1 x=1 $(pwd) grep -eu -eu "$@" "$@"
+cd export 2>/dev/null --verbose done test awk
+	'quoted text' readonly --verbose | done grep then $(pwd) echo
+		"$1" && ${HOME} cd 2>/dev/null
+test grep cd "$@" && cd --verbose echo done printf && local 'quoted text'
+sed test -eu -eu --verbose "$@" awk local
+	"$1" done grep && x=1 awk echo /usr/bin /usr/bin cd
+local x=1 $(pwd) cd awk 'quoted text' then "$@" then x=1 test then $(pwd) x=1
+	done && local readonly export $(pwd) export done echo x=1 done -eu
+awk sed local sed $(pwd)
+2>/dev/null test 'quoted text' 'quoted text' readonly "$@" cd
+	then cd awk "$1" readonly /usr/bin export
+	$(pwd) echo sed echo cd local
+grep sed "$1" cd readonly done 2>/dev/null test export /usr/bin cd test x=1
+	-eu then --verbose done 'quoted text' $(pwd) ${HOME} grep
+		echo "$@" /usr/bin ${HOME} $(pwd)
+	--verbose /usr/bin --verbose 2>/dev/null done then export 2>/dev/null
+		echo test awk sed $(pwd) ${HOME} then echo local awk export ${HOME}
+		then local $(pwd) readonly echo local x=1 test awk 'quoted text'
+		$(pwd) readonly 2>/dev/null /usr/bin done ${HOME} then /usr/bin
+-eu grep export "$@" readonly done sed local "$@"
+		local echo ${HOME} 2>/dev/null printf sed "$@" | echo local 2>/dev/null
+		test export --verbose /usr/bin | --verbose --verbose test printf
+		x=1 awk sed sed /usr/bin readonly then then "$@"
+	test printf test && 'quoted text' awk --verbose awk test | grep grep
+printf --verbose done | export --verbose
+echo $(pwd) then 'quoted text' && "$1" $(pwd) $(pwd) ${HOME}
+		printf done local done /usr/bin
+		done x=1 local printf /usr/bin --verbose
+printf "$1" printf readonly done -eu x=1 2>/dev/null test
+/usr/bin 'quoted text' 2>/dev/null
+	done sed -eu $(pwd) "$@" "$1"
+		sed $(pwd) then export awk cd readonly then then sed
+		grep then awk "$1" /usr/bin ${HOME} 2>/dev/null then 'quoted text' && 'quoted text'
+&& $(pwd) /usr/bin -eu echo $(pwd) then then "$@" "$@" sed readonly
+test grep "$@" grep test --verbose ${HOME} awk ${HOME} awk export "$@"
+cd grep echo $(pwd) then readonly
+		local /usr/bin sed ${HOME} $(pwd) done ${HOME} then "$@"
+		done $(pwd) sed echo ${HOME} grep | sed "$1"
+	'quoted text' printf /usr/bin then | --verbose 'quoted text' 'quoted text'
+done then x=1 test 'quoted text' && ${HOME} readonly test export
+"$@" -eu printf "$1" x=1 "$1" x=1 test "$@" done && then && cd done $(pwd)
+echo "$@" 2>/dev/null local cd x=1 "$1" 'quoted text' test
+	'quoted text' local done readonly 'quoted text'
+$(pwd) --verbose -eu awk echo "$1" | printf grep test 'quoted text'
+		--verbose /usr/bin 2>/dev/null
+		"$@" && awk $(pwd) 'quoted text' awk test readonly
+"$1" "$1" grep "$@" --verbose sed | x=1 then && local then export
+		grep && readonly done ${HOME} "$1" --verbose $(pwd) done printf 2>/dev/null
+		export $(pwd) sed x=1 echo export 2>/dev/null then printf test && x=1 done
+		'quoted text' && local x=1 test test "$@" sed |
+		2>/dev/null 'quoted text' test local printf cd cd --verbose
+		'quoted text' "$@" local
+"$1" $(pwd) --verbose readonly done | awk sed 'quoted text' --verbose
+		export test export awk --verbose grep 'quoted text' local grep 2>/dev/null local
+export "$@" --verbose echo done cd --verbose readonly
+		printf ${HOME} -eu export printf
+--verbose then $(pwd) "$1" printf $(pwd) "$1"
+	sed local sed ${HOME} sed awk cd 'quoted text' test 'quoted text'
+echo printf then test "$1"
+"$1" $(pwd) x=1 "$@" /usr/bin --verbose 'quoted text' /usr/bin grep export
+	"$1" cd printf local 'quoted text' done ${HOME} x=1 echo
+		grep && readonly grep sed $(pwd) echo export done echo
+&& done local | 2>/dev/null readonly
+		"$1" cd "$@" -eu cd export test $(pwd) | x=1 x=1 && awk then | local grep
+		2>/dev/null | local | awk awk readonly "$1" ${HOME} 'quoted text'
+		local local done local $(pwd)
+		cd grep test test then | printf 'quoted text' /usr/bin "$1" -eu -eu
+		x=1 cd awk && && export --verbose --verbose
+	--verbose cd test grep then | test export grep export x=1 "$@" | test echo
+		/usr/bin readonly x=1 cd grep "$1" test
+echo export test test awk readonly cd
+"$@" && then "$1" printf 2>/dev/null export
+	echo sed "$1" test x=1
+	echo "$1" 2>/dev/null cd sed x=1 grep cd then then x=1 sed cd local test
+		'quoted text' awk grep "$@" 2>/dev/null | $(pwd) export echo
+		"$@" 2>/dev/null grep ${HOME} -eu /usr/bin | ${HOME} "$1"
+		2>/dev/null done 'quoted text' readonly --verbose | ${HOME}
+	grep local x=1 "$@" /usr/bin && "$@" awk readonly 2>/dev/null
+	"$@" sed "$@" -eu | readonly cd && then done
+	echo -eu test -eu readonly --verbose $(pwd) grep printf sed "$1" "$@"
+		'quoted text' printf test sed "$1" echo "$1" && ${HOME} echo local
+	'quoted text' grep local
+		printf then export readonly
+		| test | cd --verbose printf cd grep sed
+cd sed readonly grep grep test
+		printf -eu readonly $(pwd) cd -eu echo awk | sed export awk then | "$1"
+		$(pwd) && /usr/bin | ${HOME} done --verbose "$@" done x=1 then cd local 'quoted text'
+"$@" readonly done local echo awk $(pwd)
+	/usr/bin -eu awk then "$1" grep
+cd x=1 "$1" | export --verbose sed 'quoted text' readonly echo $(pwd)
+/usr/bin "$1" sed -eu "$1" 2>/dev/null
+		&& then test export 2>/dev/null awk 2>/dev/null
+		done local done cd /usr/bin echo export then | "$@" test x=1 done sed 2>/dev/null
+	-eu "$1" $(pwd) x=1 printf
+test $(pwd) -eu x=1 /usr/bin | --verbose done "$@" x=1 'quoted text'
+		test export -eu 'quoted text' -eu ${HOME} "$@" test | &&
+	"$1" cd local x=1 grep grep | /usr/bin cd "$@" printf done && "$1"
+		2>/dev/null --verbose
+2>/dev/null local 2>/dev/null export --verbose grep 'quoted text'
+-eu then && && "$1" && grep test && then export export | ${HOME} && grep "$@"
+"$@" "$@" done "$1" echo --verbose && echo /usr/bin ${HOME} then readonly "$@" --verbose
+		--verbose -eu "$1" "$1" readonly ${HOME} printf
+	readonly then export | grep printf --verbose --verbose then -eu $(pwd)
+"$@" done --verbose "$1" && done done $(pwd) x=1
+		grep ${HOME} cd grep $(pwd) ${HOME}
+	readonly 'quoted text' -eu printf
+		${HOME} export sed export | then test test "$@" x=1 cd "$@" x=1 readonly "$1" ${HOME}
+| x=1 $(pwd) then grep 2>/dev/null -eu
+	"$1" readonly test printf readonly "$@" --verbose
+	export 2>/dev/null "$1" echo awk printf test cd grep "$1" | "$1" "$@" sed
+cd 'quoted text' grep local local --verbose /usr/bin x=1 cd awk then "$@"
+	${HOME} | printf "$1" && local -eu readonly "$1" readonly && then
+	2>/dev/null done "$1" $(pwd) 'quoted text' then
+		${HOME} done x=1 cd sed -eu -eu 'quoted text'
+		$(pwd) /usr/bin readonly grep grep --verbose "$1" x=1 local "$@" then
+		then ${HOME} test export
+		cd cd "$@" printf printf sed && --verbose 'quoted text' x=1 echo /usr/bin
+		-eu grep -eu /usr/bin "$1" x=1 /usr/bin then
+	then export readonly "$1" --verbose echo 2>/dev/null
+export awk 'quoted text' -eu "$1" echo done x=1 done
+	printf "$1" readonly && 2>/dev/null "$1" | -eu -eu -eu ${HOME}
+	'quoted text' readonly grep test "$@" grep awk 'quoted text' "$@" -eu
+export cd | "$1" printf /usr/bin local | awk sed done cd cd
+	$(pwd) printf echo readonly done -eu grep x=1 local
+	then 'quoted text' "$1" && -eu test $(pwd)
+grep export local sed && $(pwd) | $(pwd) x=1 2>/dev/null -eu grep
+	sed then && "$1" grep $(pwd) --verbose readonly
+then | $(pwd) grep readonly grep
+		cd /usr/bin readonly cd 2>/dev/null grep 2>/dev/null
+--verbose "$@" printf awk export export readonly $(pwd) 2>/dev/null
+		--verbose cd && done readonly
+	then done then export --verbose
+		${HOME} echo awk 2>/dev/null done then && "$@" x=1
+		'quoted text' /usr/bin awk | ${HOME}
+	echo sed --verbose $(pwd) awk done 'quoted text' ${HOME}
+2>/dev/null then --verbose then "$@" | export cd | readonly echo 2>/dev/null
+		done export ${HOME} done sed awk -eu test -eu 2>/dev/null test x=1 readonly
+then local 2>/dev/null printf -eu $(pwd) then && /usr/bin x=1 awk 'quoted text'
+	&& && | /usr/bin -eu then 2>/dev/null
+'quoted text' | "$@" awk 'quoted text'
+"$1" then -eu x=1 then --verbose sed echo readonly x=1
+	test grep awk sed $(pwd) readonly 2>/dev/null sed "$@" && export "$@"
+		x=1 2>/dev/null --verbose $(pwd) printf export local "$@" "$1" | then grep awk -eu
+		printf x=1 then ${HOME}
+grep done sed /usr/bin printf readonly grep
+		done "$@" export $(pwd) test done -eu printf
+'quoted text' then ${HOME} | echo && readonly 'quoted text'
+		local && awk && sed echo then done then sed && | sed test
+		readonly "$@" | "$@" --verbose
+'quoted text' && echo echo
+	export printf --verbose 2>/dev/null
+	-eu 2>/dev/null sed cd readonly then /usr/bin echo
+		"$1" readonly export 'quoted text' 2>/dev/null | --verbose
+		&& cd --verbose 2>/dev/null cd echo && |
+		"$@" done 'quoted text' then --verbose "$1" export grep | -eu local
+test printf test && local done 'quoted text' readonly awk export then printf
+local grep done local export echo printf grep
+		'quoted text' x=1 local then /usr/bin && awk "$@" $(pwd) --verbose "$1" then
+	| awk echo --verbose /usr/bin local grep "$@" export readonly x=1 awk x=1 local
+	-eu --verbose 'quoted text' grep echo test x=1 'quoted text'
+local && local echo export /usr/bin cd
+		awk && awk local 'quoted text' $(pwd) /usr/bin --verbose 'quoted text' done
+local printf $(pwd) && cd -eu $(pwd) grep ${HOME} awk
+	"$@" --verbose done 2>/dev/null test readonly 'quoted text' local
+		echo test "$1" $(pwd) -eu -eu "$1" x=1 done -eu echo
+-eu "$1" ${HOME} x=1 "$@" | cd | 2>/dev/null
+		sed echo export "$@" readonly
+		--verbose && printf 'quoted text' "$1" sed cd done --verbose 2>/dev/null
+| done x=1 done done "$@" "$@" readonly /usr/bin | printf | ${HOME} done
+	"$@" readonly | awk then $(pwd)
+		x=1 echo grep 'quoted text' | cd cd done /usr/bin export local echo echo
+${HOME} x=1 "$@" done test && x=1 sed x=1 /usr/bin echo printf
+	'quoted text' && cd test local
+	done export && done x=1 --verbose printf
+-eu test local echo /usr/bin
+"$1" grep -eu grep 2>/dev/null 2>/dev/null local echo
+		local export echo printf -eu
+		grep ${HOME} && --verbose
+		x=1 printf && awk "$@" && export /usr/bin
+	local ${HOME} | $(pwd) | grep --verbose echo local
+	"$1" readonly local "$@" /usr/bin 'quoted text' --verbose cd test $(pwd)
+		x=1 readonly $(pwd) readonly --verbose awk "$@" awk 'quoted text' local export printf
+		done printf test | printf readonly local then "$@" echo grep cd
+done sed 2>/dev/null ${HOME} echo /usr/bin 2>/dev/null
+export cd readonly awk printf -eu 'quoted text'
+cd test test printf x=1 test sed && /usr/bin && awk /usr/bin
+	then then export --verbose 'quoted text' grep 2>/dev/null
+	printf done printf done /usr/bin then test
+		'quoted text' test then $(pwd) | done 2>/dev/null sed export
+		-eu -eu && then x=1 then -eu cd 2>/dev/null && x=1 $(pwd) --verbose
+	cd -eu readonly printf done readonly /usr/bin cd
+		sed then export done printf | awk 2>/dev/null
+	/usr/bin ${HOME} 2>/dev/null then sed awk awk ${HOME}
+		readonly then -eu test -eu "$@" export /usr/bin then awk readonly
+		awk 'quoted text' ${HOME} local "$1" 'quoted text'
+	readonly -eu "$1" "$@" --verbose test --verbose
+local awk local printf && test test -eu x=1
+		$(pwd) 'quoted text' readonly awk | then test
+test -eu 2>/dev/null local | export
+	"$@" done /usr/bin ${HOME} "$1" ${HOME} /usr/bin then then readonly
+	printf readonly ${HOME} echo grep -eu export
+		done grep printf readonly ${HOME} local local awk
+	${HOME} then sed "$@" awk local test local readonly "$1" "$1" | --verbose
+		then | $(pwd) printf done 2>/dev/null
+	${HOME} 'quoted text' test cd /usr/bin --verbose readonly
+| grep awk printf printf
+cd echo grep awk grep "$@" export && && --verbose $(pwd) 'quoted text'
+		grep $(pwd) /usr/bin done
+	2>/dev/null printf then readonly && -eu -eu /usr/bin cd /usr/bin
+	cd local -eu local test x=1 export cd "$1" test test local readonly test "$1"
+'quoted text' x=1 local x=1 then x=1 && then readonly 2>/dev/null readonly --verbose
+	-eu done awk test x=1 -eu ${HOME} && 'quoted text' "$1" awk then export
+	local && $(pwd) && --verbose --verbose grep -eu export 2>/dev/null &&
+	done --verbose ${HOME} printf
+readonly awk $(pwd) ${HOME}
+awk local echo printf "$@" done && grep $(pwd) /usr/bin
+-eu x=1 test done "$1" --verbose
+	echo export && test done grep printf
+	local $(pwd) local cd 'quoted text' && | | sed done | sed /usr/bin cd readonly
+		-eu /usr/bin printf awk ${HOME}
+	"$@" done "$@" 2>/dev/null "$@" ${HOME} "$1" /usr/bin printf cd x=1 --verbose
+${HOME} x=1 export $(pwd) local printf test grep && cd
+	/usr/bin 'quoted text' sed then /usr/bin
+		"$1" | "$@" && printf cd
+		echo test 2>/dev/null --verbose test done then "$1" --verbose
+'quoted text' then then 2>/dev/null export export -eu | grep cd && $(pwd)
+		then awk --verbose awk && grep && -eu local then export
+awk sed printf done local -eu $(pwd) test local 2>/dev/null ${HOME} awk grep
+	--verbose x=1 done && $(pwd) "$1" x=1 then "$1" sed printf then printf
+$(pwd) "$@" grep | "$1" sed "$@" -eu 2>/dev/null printf 'quoted text'
+	${HOME} /usr/bin then sed readonly then grep
+	cd local 'quoted text' export 'quoted text'
+		export "$@" test "$@" | grep 2>/dev/null "$1" awk /usr/bin --verbose awk 'quoted text'
+		2>/dev/null 'quoted text' "$1" --verbose awk "$@" $(pwd)
+	echo cd x=1 readonly "$1" 'quoted text' $(pwd) grep sed
+"$1" x=1 then awk 'quoted text' 'quoted text'
+		-eu 'quoted text' /usr/bin
+		/usr/bin done then "$@" test
+-eu export printf grep --verbose awk printf awk "$1" --verbose &&
+		/usr/bin printf grep 2>/dev/null
+printf local "$@" 2>/dev/null local export done echo 2>/dev/null "$@" | echo
+		${HOME} "$1" "$1" printf echo x=1 | -eu
+export test "$1" echo done test local echo then x=1 awk &&
+	&& x=1 ${HOME} "$@" cd
+		done local -eu 'quoted text' $(pwd) -eu
+		| grep test awk /usr/bin $(pwd) grep then awk
+		export 'quoted text' cd readonly x=1 && -eu 'quoted text'
+/usr/bin && done --verbose $(pwd) ${HOME} ${HOME} 2>/dev/null
+		-eu then 'quoted text' test -eu /usr/bin done 'quoted text' "$1" echo
+"$@" cd printf sed | done "$@" then test
+$(pwd) local && 2>/dev/null echo "$1" awk "$@"
+		export "$1" --verbose
+--verbose /usr/bin "$1"
+	| export awk --verbose --verbose readonly awk --verbose -eu --verbose sed
+		export test --verbose done
+		then test && sed "$1" -eu 'quoted text'
+"$@" && | "$@" readonly test 'quoted text' "$1" sed export
+-eu 2>/dev/null && x=1 ${HOME} printf cd x=1 "$@" ${HOME}
+	printf export then x=1 --verbose 2>/dev/null test grep cd &&
+	| -eu grep x=1 ${HOME} export -eu 'quoted text'
+		2>/dev/null echo x=1 test then "$1" local "$@"
+		| --verbose grep x=1 echo /usr/bin /usr/bin readonly
+	"$1" -eu cd 'quoted text' echo then "$@" done "$@" 'quoted text' && test x=1
+		then done $(pwd) "$@" 'quoted text' ${HOME} then done sed export -eu && test
+		2>/dev/null "$1" 2>/dev/null
+	-eu local --verbose sed awk grep done
+		"$@" -eu --verbose export ${HOME} 'quoted text' then echo ${HOME} echo
+		awk awk /usr/bin then readonly x=1 x=1 "$@"
+		$(pwd) local $(pwd) readonly done -eu printf $(pwd) echo "$@" /usr/bin $(pwd)
+-eu test | x=1 /usr/bin printf /usr/bin x=1 test printf local /usr/bin
+2>/dev/null && "$1" export "$@" ${HOME} cd then /usr/bin && | $(pwd)
+		then awk export local x=1 /usr/bin readonly 'quoted text'
+		test --verbose "$1" done "$@"
+readonly test sed --verbose
+	export --verbose "$@" "$@" then --verbose cd
+	readonly x=1 then "$1" awk awk local export grep awk local grep test echo sed printf
+		/usr/bin done export grep awk export x=1 export local && then done awk printf
+awk cd "$1" --verbose /usr/bin /usr/bin /usr/bin | $(pwd) "$1" grep /usr/bin "$1"
+$(pwd) --verbose grep test $(pwd) | ${HOME} "$@" test export test
+	"$1" ${HOME} /usr/bin 'quoted text' "$@" x=1 -eu | 2>/dev/null
+		cd 'quoted text' ${HOME} && readonly
+sed /usr/bin test grep --verbose $(pwd) ${HOME} $(pwd) --verbose 2>/dev/null
+	'quoted text' awk 'quoted text' echo
+'quoted text' 2>/dev/null $(pwd) ${HOME} readonly test $(pwd) 2>/dev/null
+		2>/dev/null cd echo local "$@" ${HOME} "$1" export
+		2>/dev/null --verbose grep awk local done local
+	/usr/bin "$@" -eu $(pwd) "$@" local readonly && printf -eu -eu
+	local "$1" | then printf --verbose -eu /usr/bin local ${HOME} awk --verbose
+	test && readonly /usr/bin --verbose ${HOME} readonly 2>/dev/null then export
+	/usr/bin then | $(pwd)
+		readonly echo --verbose export cd sed | echo grep 'quoted text'
+		cd test echo | | 2>/dev/null -eu readonly ${HOME} /usr/bin
+		test | 'quoted text'
+done && "$@" "$@" grep export "$1" echo grep 2>/dev/null sed awk && && local
+	--verbose x=1 x=1 x=1 export local x=1 x=1
+	export sed 2>/dev/null local sed && | then 2>/dev/null
+		printf x=1 test then sed cd echo grep
+		'quoted text' && 'quoted text' test
+		echo done grep done export
+export test done 2>/dev/null -eu printf grep readonly local awk grep --verbose
+	awk | done echo $(pwd) | grep then done export
+		"$1" export test then local --verbose "$@" $(pwd)
+done /usr/bin local sed echo grep test --verbose
+		cd printf 2>/dev/null /usr/bin printf $(pwd) sed ${HOME} && 2>/dev/null
+then ${HOME} then ${HOME} /usr/bin done cd cd /usr/bin 'quoted text' grep
+		awk ${HOME} 2>/dev/null $(pwd) echo printf export sed cd $(pwd) awk "$1" readonly
+	sed "$1" && awk ${HOME} "$1" export then test export test -eu 2>/dev/null
+	-eu "$1" 2>/dev/null --verbose ${HOME} grep -eu --verbose awk awk grep export x=1
+		&& | "$1" local | readonly
+"$1" -eu x=1 $(pwd) && export export grep test 'quoted text'
+sed --verbose 'quoted text'
+then --verbose | -eu echo --verbose /usr/bin --verbose
+awk sed 2>/dev/null readonly
+"$@" readonly local --verbose $(pwd) ${HOME} done
+	/usr/bin sed | && test $(pwd) -eu "$1" sed x=1 -eu test
+| $(pwd) cd sed printf "$1" --verbose awk --verbose
+		/usr/bin printf ${HOME} x=1 --verbose done printf /usr/bin 2>/dev/null /usr/bin
+'quoted text' -eu sed export export
+$(pwd) echo then printf | done grep test done "$@" local awk awk $(pwd) test ${HOME}
+x=1 | -eu awk 2>/dev/null
+sed local grep readonly readonly
+x=1 /usr/bin 2>/dev/null cd -eu grep grep "$1" 'quoted text' 'quoted text'
+local "$1" && sed -eu --verbose
+	export grep export done 'quoted text' &&
+	'quoted text' ${HOME} "$@" x=1 printf export then ${HOME}
+	awk ${HOME} && done readonly "$@" awk sed
+		-eu awk 'quoted text' 'quoted text' echo test then sed echo
+	$(pwd) -eu then && echo $(pwd) grep 2>/dev/null local cd x=1 printf
+		grep test readonly /usr/bin
+cd printf export cd readonly 'quoted text' | then
+2>/dev/null ${HOME} test --verbose printf test test grep awk test then sed $(pwd)
+test "$@" readonly && ${HOME} echo sed
+		local printf local done --verbose local x=1 -eu 2>/dev/null --verbose
+		cd ${HOME} cd test && awk local && /usr/bin
+		cd cd printf | readonly done && x=1 done local sed then /usr/bin ${HOME}
+	&& then "$1" "$@" 'quoted text' export 2>/dev/null test $(pwd) "$1" grep x=1 sed
+		"$@" 'quoted text' local 'quoted text' then cd
+	awk echo test printf test then export then
+awk | x=1 cd $(pwd) grep ${HOME} &&
+		then cd cd sed sed done && echo done
+		/usr/bin --verbose | ${HOME}
+'quoted text' sed local --verbose local $(pwd) $(pwd) --verbose | 2>/dev/null
+	$(pwd) done sed "$1" /usr/bin 'quoted text' 'quoted text' then && export
+		echo cd sed | -eu "$1" echo
+then "$@" "$@" $(pwd) --verbose done printf echo cd printf
+x=1 ${HOME} sed grep local
+'quoted text' "$1" ${HOME} grep grep 2>/dev/null ${HOME}
+		--verbose printf && x=1 sed grep x=1 test
+	awk -eu done -eu printf -eu 2>/dev/null 'quoted text' sed cd sed --verbose
+readonly export grep sed
+export done | "$@" printf
+		printf "$@" 'quoted text' 'quoted text' 'quoted text'
+$(pwd) printf printf then export local ${HOME} x=1 readonly local ${HOME}
+	grep 2>/dev/null done /usr/bin sed printf sed cd
+x=1 -eu "$1" -eu /usr/bin then --verbose x=1 awk cd echo readonly test
+${HOME} awk "$1" $(pwd) cd $(pwd) 'quoted text'
+		cd done && $(pwd) echo "$1" --verbose cd 2>/dev/null $(pwd) cd "$1" sed $(pwd) "$@"
+printf cd done sed --verbose awk 2>/dev/null then -eu -eu
+x=1 "$@" echo | /usr/bin done 2>/dev/null grep && -eu sed --verbose
+local printf sed /usr/bin awk "$1" $(pwd) | | ${HOME} test && 'quoted text'
+		2>/dev/null "$1" local | export awk printf && 2>/dev/null
+done printf export test ${HOME} "$@" awk sed test cd && ${HOME} "$@" "$@"
+		"$1" cd ${HOME} "$@" "$@" &&
+awk /usr/bin --verbose 'quoted text' export
+/usr/bin && 'quoted text' /usr/bin "$@" done 2>/dev/null -eu local
+		| $(pwd) 'quoted text' grep "$@" --verbose --verbose x=1 && ${HOME} awk 2>/dev/null
+	cd -eu "$@" "$@" printf -eu export 2>/dev/null cd printf $(pwd) 'quoted text'
+		${HOME} x=1 'quoted text' printf sed "$@" done | | readonly | --verbose
+test --verbose export -eu local export | ${HOME} echo awk --verbose
+	'quoted text' echo local done
+	--verbose export x=1 | --verbose x=1 echo sed -eu export
+"$@" printf -eu "$1" | -eu export $(pwd) awk test ${HOME} export "$@" done
+	printf "$1" -eu then 'quoted text' cd done done
+		grep --verbose -eu sed x=1 echo grep local printf cd printf test 'quoted text'
+	${HOME} ${HOME} && then printf
+	${HOME} awk --verbose echo local printf
+	cd cd export /usr/bin then "$@" 'quoted text'
+		sed export ${HOME} && grep echo
+	${HOME} | && cd test ${HOME} "$@" then sed echo awk
+		sed | /usr/bin sed 'quoted text' x=1 /usr/bin ${HOME}
+		echo $(pwd) /usr/bin --verbose "$@" then grep --verbose | $(pwd)
+x=1 x=1 sed $(pwd) "$1"
+	done "$@" | local readonly
+	readonly cd echo ${HOME} "$@"
+	readonly 2>/dev/null -eu | && readonly
+$(pwd) export export 'quoted text' 2>/dev/null 'quoted text' ${HOME}
+		readonly "$@" "$1" "$@" then && | ${HOME} "$1" "$1"
+		then /usr/bin 'quoted text' "$@" test --verbose
+	then ${HOME} -eu /usr/bin x=1 readonly echo --verbose then grep
+	cd $(pwd) readonly --verbose test printf 'quoted text'
+readonly grep printf ${HOME} export
+	readonly awk cd -eu | then awk 2>/dev/null "$1" printf export local
+	${HOME} readonly $(pwd)
+	$(pwd) cd ${HOME} ${HOME} done "$@" 2>/dev/null -eu ${HOME}
+		"$1" test echo test /usr/bin $(pwd) 2>/dev/null "$1" awk grep 'quoted text'
+x=1 readonly sed done
+	then $(pwd) cd x=1 $(pwd) local
+	local --verbose 2>/dev/null /usr/bin then 'quoted text' && cd 'quoted text' --verbose
+then then && | echo export then awk awk readonly printf "$@" printf $(pwd)
+"$@" --verbose done then local --verbose -eu
+		--verbose "$@" test "$1" cd $(pwd)
+echo "$1" echo x=1 readonly
+		2>/dev/null ${HOME} local $(pwd) $(pwd) sed test sed local test printf
+	"$1" x=1 printf then grep ${HOME} sed export $(pwd) awk sed
+readonly echo | export && "$@"
+	test "$1" sed 2>/dev/null
+	then local sed 2>/dev/null 'quoted text'
+		2>/dev/null sed test then sed "$1" x=1 sed cd then sed echo $(pwd) local
+	awk printf test then test local -eu
+		then sed "$1" "$1" grep sed "$1" 'quoted text'
+echo export readonly 2>/dev/null awk $(pwd) | local readonly export
+		sed "$1" printf ${HOME} sed readonly
+		awk done /usr/bin -eu /usr/bin
+2>/dev/null "$1" sed 2>/dev/null 2>/dev/null sed && done printf grep done
+	"$1" "$@" x=1 -eu "$@" 'quoted text' done printf 2>/dev/null "$@" done test printf
+	then 'quoted text' /usr/bin "$@" local done awk ${HOME} done
+	then test cd ${HOME} then "$@" sed test /usr/bin --verbose done sed
+--verbose readonly x=1 readonly "$@" cd "$@" echo echo grep
+sed ${HOME} then readonly readonly
+	"$@" echo sed done export grep && export /usr/bin $(pwd) grep -eu --verbose
+		"$1" grep readonly awk readonly
+awk -eu "$1" "$@" -eu echo
+		x=1 printf $(pwd) cd sed 'quoted text' | then "$@" test
+	then test test && then test awk done /usr/bin ${HOME}
+	test printf 2>/dev/null x=1 ${HOME} -eu test grep --verbose
+readonly 'quoted text' -eu
+	export then sed 'quoted text' "$@"
+test printf cd sed awk && -eu --verbose
+		done | export local ${HOME} test
+done local cd sed test readonly 'quoted text'
+export -eu "$1" test --verbose ${HOME} printf cd local cd cd 2>/dev/null
+	2>/dev/null /usr/bin echo
+&& printf test echo | sed "$1" done $(pwd) && x=1 readonly 'quoted text' grep
+x=1 readonly awk then /usr/bin && "$1" sed readonly grep 'quoted text' ${HOME}
+	x=1 then "$@" echo 'quoted text' printf -eu local cd x=1 grep | done /usr/bin
+	$(pwd) ${HOME} awk "$1" then sed 'quoted text'
+		2>/dev/null --verbose && test cd && /usr/bin cd --verbose
+		"$1" --verbose ${HOME} test $(pwd) awk readonly /usr/bin -eu 2>/dev/null /usr/bin
+		| | /usr/bin sed --verbose test done 'quoted text' "$@" grep $(pwd) --verbose
+		&& done "$@" ${HOME} ${HOME} grep echo -eu awk 'quoted text'
+sed $(pwd) export cd --verbose "$@" "$1" | test printf then 2>/dev/null
+		-eu printf ${HOME} 2>/dev/null "$1" test grep --verbose local | readonly
+		done export local x=1 grep test local --verbose "$1" "$@" printf cd echo &&
+$(pwd) --verbose --verbose sed local x=1 then awk
+	x=1 x=1 $(pwd) printf export | $(pwd)
+awk grep x=1 x=1 grep echo printf readonly
+-eu x=1 sed --verbose x=1 export grep | export done 2>/dev/null
+	x=1 grep "$1" 2>/dev/null then sed printf cd test /usr/bin 2>/dev/null sed
+		$(pwd) "$@" printf export
+		done x=1 echo printf "$1" cd "$1" $(pwd) | ${HOME} printf done -eu then 'quoted text'
+	readonly printf export -eu -eu then "$@" "$1" && $(pwd)
+/usr/bin local grep cd /usr/bin echo | --verbose
+		--verbose echo 2>/dev/null cd $(pwd) -eu local x=1 sed sed -eu "$@"
+		/usr/bin "$@" done echo then
+		2>/dev/null local ${HOME} 2>/dev/null done done cd cd export readonly
+		2>/dev/null cd export 2>/dev/null ${HOME} "$1" echo
+	local 'quoted text' && 'quoted text' --verbose
+		cd then /usr/bin echo "$@" 'quoted text'
+		"$@" | "$@" then cd && ${HOME} test --verbose
+	${HOME} ${HOME} cd echo then
+x=1 printf cd readonly export grep x=1 sed export -eu /usr/bin local done
+	export local ${HOME} grep done && "$1" /usr/bin printf
+-eu export echo --verbose export printf -eu test then grep
+		-eu readonly 'quoted text' awk local readonly awk 2>/dev/null
+$(pwd) cd x=1 cd grep
+	-eu then export | export local export done done 2>/dev/null
+${HOME} "$1" awk awk ${HOME} cd test 'quoted text' --verbose echo
+	export --verbose ${HOME} "$@" x=1 x=1 cd "$@"
+	2>/dev/null test "$@" 'quoted text'
+		"$1" done "$1" readonly --verbose
+		echo -eu awk "$@" 2>/dev/null printf test readonly 'quoted text'
+		awk local /usr/bin --verbose printf x=1 /usr/bin 'quoted text'
+&& 'quoted text' cd echo echo "$@" export ${HOME} 'quoted text'
+awk -eu then && | -eu printf awk export /usr/bin /usr/bin
+		cd /usr/bin $(pwd) echo awk x=1 sed echo
+	"$@" awk done test "$1" then done /usr/bin then "$1" awk &&
+		readonly ${HOME} cd test -eu $(pwd) cd readonly
+	printf local test readonly | then
+		${HOME} done local readonly
+grep --verbose then test $(pwd) then /usr/bin
+	--verbose && export && then | --verbose sed done x=1 printf
+echo printf x=1 awk && then
+		"$@" -eu 2>/dev/null | printf 'quoted text' printf then local
+printf grep done /usr/bin export awk grep local echo "$@" grep
+--verbose "$@" awk $(pwd) ${HOME} | --verbose export readonly local
+-eu $(pwd) --verbose cd then $(pwd) && ${HOME}
+		2>/dev/null readonly done ${HOME} cd sed 'quoted text'
+sed --verbose $(pwd) readonly export --verbose local ${HOME} | sed echo local
+		readonly then local then echo "$1" done | $(pwd) $(pwd)
+	$(pwd) /usr/bin --verbose && --verbose sed echo cd done then
+	awk 2>/dev/null grep "$@" $(pwd) printf local echo readonly echo | "$1"
+		local "$@" -eu cd echo cd x=1 "$1" 'quoted text' then && 2>/dev/null export x=1
+	sed "$@" then 2>/dev/null | "$1" $(pwd) 'quoted text'
+awk $(pwd) then 2>/dev/null "$1" sed
+	'quoted text' printf 'quoted text' readonly
+test awk "$1" then readonly readonly --verbose local
+		echo readonly sed /usr/bin | | $(pwd)
+	"$@" awk | echo readonly x=1 echo export && awk local awk "$@"
+		"$@" awk echo local -eu awk --verbose sed cd grep 'quoted text' export 'quoted text'
+export x=1 awk export sed grep grep
+		"$@" /usr/bin sed $(pwd) test x=1 readonly sed -eu then echo --verbose
+		local ${HOME} x=1 | --verbose
+	$(pwd) readonly "$1" then test test printf
+$(pwd) grep cd && -eu readonly -eu /usr/bin "$@" -eu | done local
+2>/dev/null /usr/bin echo && 2>/dev/null
+		done $(pwd) "$@" grep /usr/bin 2>/dev/null echo
+	"$@" cd printf /usr/bin 'quoted text' "$@"
+		sed sed 2>/dev/null done -eu readonly -eu echo cd export
+	grep readonly ${HOME} export sed sed $(pwd) export 2>/dev/null | export
+		cd $(pwd) echo /usr/bin cd test local 2>/dev/null
+then printf 2>/dev/null awk grep printf "$@" 2>/dev/null test | printf done
+	done printf readonly "$1" grep &&
+then awk $(pwd) x=1 then $(pwd) local then printf /usr/bin done "$@" ${HOME}
+	done readonly "$@" --verbose grep done test readonly echo
+done && "$1" ${HOME} && test "$@" cd printf
+local ${HOME} done export
+	then export x=1 "$1" echo --verbose | &&
+		printf test --verbose echo cd then 'quoted text' test
+	'quoted text' export echo "$1" done done test --verbose
+	awk /usr/bin | readonly | && "$1" then "$1" done | cd 'quoted text' $(pwd) |
+export export local cd 2>/dev/null
+awk --verbose /usr/bin && cd /usr/bin grep readonly export -eu 'quoted text'
+		done test /usr/bin export | then 2>/dev/null && | ${HOME}
+2>/dev/null -eu cd grep readonly /usr/bin test sed && export
+readonly $(pwd) -eu echo -eu "$@" sed echo
+$(pwd) echo $(pwd) $(pwd) awk 'quoted text' then local -eu 'quoted text'
+		x=1 --verbose readonly echo "$1" x=1 'quoted text'
+		&& sed && cd $(pwd) test awk ${HOME} awk
+	$(pwd) local | -eu $(pwd) readonly && -eu export sed local done 2>/dev/null
+	echo ${HOME} cd 'quoted text' | "$@" && $(pwd) done x=1 cd "$@"
+	local | 2>/dev/null cd export cd readonly
+		"$@" "$@" readonly readonly "$@" done 'quoted text' done cd cd && grep
+		grep -eu echo grep local x=1 local /usr/bin echo sed local &&
+	| $(pwd) sed | test "$1" "$1" then echo echo awk -eu "$@" printf
+-eu local && && done | /usr/bin && export export export $(pwd)
+x=1 then && printf && "$1" 'quoted text'
+	readonly 2>/dev/null done echo "$1" ${HOME} local
+	| --verbose | export $(pwd) $(pwd) awk 'quoted text' 'quoted text' 2>/dev/null
+		awk "$1" "$1" cd grep -eu then --verbose then | | awk "$1" test "$@" readonly done
+#include c27.sh
+&& | x=1 "$@" 'quoted text'
+	then 2>/dev/null then printf $(pwd) printf x=1 test grep done
+	echo done 2>/dev/null ${HOME} export --verbose
+	grep done sed 'quoted text' ${HOME} grep --verbose test -eu readonly
+	/usr/bin "$1" cd then "$@" -eu 2>/dev/null readonly sed grep sed && "$@"
+		local local 'quoted text' 'quoted text'
+then then then done $(pwd) echo grep 2>/dev/null -eu then awk | x=1 export /usr/bin
+	-eu cd 'quoted text' test ${HOME} "$1" awk cd sed -eu cd /usr/bin
+	x=1 export ${HOME} | -eu "$@"
+done $(pwd) && 'quoted text' "$@" sed | local local | test grep "$1" local
+		echo "$1" --verbose test $(pwd)
+	printf readonly then -eu
+	cd "$1" | -eu cd ${HOME} sed /usr/bin sed 'quoted text' readonly && "$1"
+$(pwd) | done 2>/dev/null
+		2>/dev/null done cd grep export printf --verbose test then readonly "$@" test
+local cd "$1" sed local grep then printf 2>/dev/null 'quoted text'
+	x=1 "$@" export --verbose x=1 test sed 'quoted text' done done
+		--verbose readonly 2>/dev/null grep export
+		local test test "$1" printf grep readonly
+	sed local $(pwd) echo 2>/dev/null grep $(pwd) && "$@" x=1 'quoted text'
+		/usr/bin ${HOME} done -eu export
+sed /usr/bin test "$1" test |
+		awk "$@" | echo printf sed "$1" x=1 | printf "$1"
+		readonly /usr/bin local --verbose
+	cd /usr/bin -eu local | echo x=1 | 2>/dev/null cd then readonly
+		| grep test | echo cd /usr/bin cd "$1" --verbose then awk echo export
+&& sed $(pwd) | done && readonly
+		awk printf awk --verbose awk printf test
+grep /usr/bin -eu "$1" "$1" export $(pwd) readonly export x=1 --verbose
+	${HOME} "$1" $(pwd) readonly 2>/dev/null sed
+	sed awk local cd export done sed printf
+		cd x=1 then done ${HOME} cd ${HOME} /usr/bin test -eu local "$@" local
+&& echo --verbose | echo test echo x=1 | $(pwd) "$1" &&
+		then local --verbose cd --verbose export awk && "$@"
+		-eu done -eu test /usr/bin then awk x=1 "$1" --verbose sed printf
+"$1" 2>/dev/null awk then 'quoted text' echo grep
+		/usr/bin local -eu "$1" done export "$@" 2>/dev/null echo awk /usr/bin test
+	${HOME} 'quoted text' "$1" grep "$@" cd then "$1" ${HOME} grep done
+then --verbose 'quoted text' sed 'quoted text' printf 'quoted text'
+		| && 2>/dev/null -eu 2>/dev/null "$1" --verbose grep -eu then -eu done
+'quoted text' awk export --verbose test readonly
+	echo readonly && 2>/dev/null x=1 test 2>/dev/null
+	sed 'quoted text' local sed cd readonly $(pwd) test sed printf grep then "$@" done
+$(pwd) x=1 cd echo grep
+done done && grep 'quoted text' "$@" export local 2>/dev/null awk ${HOME}
+test ${HOME} ${HOME} &&
+		/usr/bin sed $(pwd) local test ${HOME} | test printf -eu "$@" sed $(pwd) --verbose
+	printf "$@" awk 2>/dev/null cd "$1" done echo cd 'quoted text' then 2>/dev/null
+		then --verbose printf then "$1" 'quoted text' 'quoted text' readonly echo -eu
+		$(pwd) test then awk "$1" grep cd sed -eu "$@" then
+		2>/dev/null readonly /usr/bin /usr/bin "$1" /usr/bin | "$@" export sed && cd
+export $(pwd) export export test ${HOME} -eu ${HOME} grep --verbose /usr/bin local
+		readonly done cd echo then export 'quoted text'
+/usr/bin sed grep --verbose awk x=1 --verbose 'quoted text' cd local
+		local done export 'quoted text' echo cd echo | | sed cd -eu cd echo -eu
+		$(pwd) /usr/bin grep test /usr/bin cd "$1" --verbose export
+local readonly then readonly x=1
+	${HOME} "$1" x=1 "$1" cd done x=1 local "$1" $(pwd) 'quoted text'
+2>/dev/null /usr/bin echo export grep $(pwd) && /usr/bin "$@" echo done
+		${HOME} readonly "$1" printf -eu 'quoted text' cd 2>/dev/null echo cd /usr/bin done
+		&& export x=1 local "$1" /usr/bin
+	x=1 local readonly "$@" $(pwd) "$@" |
+	&& sed cd readonly awk echo && && cd local 'quoted text' x=1 sed readonly
+2>/dev/null 2>/dev/null readonly done done x=1 2>/dev/null then 2>/dev/null 'quoted text'
+--verbose then "$@" ${HOME} then
+sed echo ${HOME} sed -eu "$@" awk local "$@" 2>/dev/null
+grep sed ${HOME} ${HOME} echo local /usr/bin && "$1" x=1 &&
+	x=1 ${HOME} grep sed echo readonly sed --verbose test printf
+export export --verbose printf grep | test done -eu local then
+printf then -eu "$@" printf ${HOME}
+		export -eu 2>/dev/null echo sed test "$1" "$@" sed 'quoted text' echo export
+x=1 "$1" ${HOME} "$@" -eu $(pwd)
+$(pwd) $(pwd) 'quoted text' readonly /usr/bin echo echo "$1" test 2>/dev/null x=1
+	test ${HOME} sed echo | local ${HOME} awk cd done readonly cd -eu grep
+	printf test && && "$1" sed local done readonly && 'quoted text'
+test export test --verbose
+${HOME} x=1 x=1 printf | "$1" /usr/bin readonly
+		printf | x=1 && then 2>/dev/null "$1" x=1 $(pwd)
+		x=1 2>/dev/null && && test
+cd && "$1" printf cd 'quoted text' grep export
+		local -eu awk /usr/bin sed grep printf readonly cd
+$(pwd) printf "$1" grep /usr/bin readonly export && | echo x=1 | grep
+	then export test "$1" done printf "$@" /usr/bin | sed then awk
+${HOME} sed done 2>/dev/null x=1 x=1 awk x=1
+readonly echo $(pwd) /usr/bin grep
+sed grep 'quoted text' 'quoted text'
+	--verbose test awk grep "$1" sed 'quoted text' printf
+	awk done -eu 2>/dev/null | done awk test
+	--verbose test then 2>/dev/null x=1 -eu | $(pwd) "$1" 'quoted text'
+awk cd -eu "$1" && "$1" test grep done cd 'quoted text' $(pwd) grep
+	local && -eu 2>/dev/null sed /usr/bin export --verbose x=1
+		then done export -eu readonly test grep grep awk 'quoted text' -eu done
+done then printf readonly -eu then test --verbose -eu
+		grep | --verbose cd test /usr/bin && test local then && echo ${HOME} grep printf
+	x=1 local /usr/bin | test cd /usr/bin && grep
+		sed echo done sed "$1" | x=1 && "$1" x=1 local $(pwd) readonly
+	"$1" "$1" then export grep then 2>/dev/null done x=1 sed done ${HOME} export $(pwd)
+	test ${HOME} cd 'quoted text' echo "$@" /usr/bin cd echo grep grep 'quoted text'
+	cd sed echo && grep then export "$1" 2>/dev/null
+	x=1 export "$1" "$@" done "$@" x=1 "$@" sed x=1 echo done /usr/bin
+		&& printf 2>/dev/null
+		"$1" printf -eu awk done | $(pwd) cd /usr/bin $(pwd) 'quoted text'
+	--verbose local printf echo test $(pwd) 2>/dev/null printf "$1" && "$1"
+	'quoted text' && -eu 2>/dev/null 'quoted text' | grep readonly
+		grep "$@" sed "$1" readonly
+	readonly ${HOME} echo awk export
+		/usr/bin x=1 then echo x=1 x=1 test done printf export -eu cd local | local
+awk awk readonly sed echo
+echo "$@" | | sed | -eu local x=1 'quoted text' then readonly
+${HOME} done 2>/dev/null export /usr/bin then "$1" "$1" done && 2>/dev/null
+		printf export awk local && cd local 2>/dev/null | x=1 $(pwd) && 'quoted text'
+		x=1 --verbose --verbose readonly && $(pwd) "$@" "$@" grep && done
+"$@" done && -eu local
+		'quoted text' test printf done "$@"
+"$@" "$@" -eu done "$1" export /usr/bin && test -eu grep
+'quoted text' echo "$1" 'quoted text' echo echo
+&& cd $(pwd) /usr/bin then "$1" -eu x=1 "$@" ${HOME} |
+	then readonly | readonly
+	then 'quoted text' --verbose 'quoted text' cd --verbose
+	readonly "$1" "$@" $(pwd) readonly sed awk local
+${HOME} -eu $(pwd) x=1 -eu awk -eu "$1" $(pwd) test "$@" --verbose
+local export 2>/dev/null local printf
+readonly done grep sed --verbose printf "$1" export printf
+	awk printf grep /usr/bin done
+		'quoted text' "$@" "$1" export grep
+		test -eu x=1 "$@" 2>/dev/null "$@" && &&
+		--verbose awk grep ${HOME} sed export
+${HOME} && 2>/dev/null $(pwd) then 'quoted text' x=1 && ${HOME} echo
+	"$@" --verbose local sed 2>/dev/null test
+	--verbose "$@" done "$1" -eu x=1 sed printf echo cd
+test x=1 grep 2>/dev/null $(pwd) "$@" export x=1 && export ${HOME}
+		local x=1 ${HOME} $(pwd) local export --verbose ${HOME} test cd 2>/dev/null && /usr/bin
+'quoted text' echo grep |
+		echo done ${HOME} /usr/bin x=1 "$@"
+2>/dev/null awk && $(pwd) readonly cd cd done | | grep test "$1" | --verbose
+		readonly "$1" awk export --verbose ${HOME} printf
+x=1 | readonly local --verbose 'quoted text' "$@" /usr/bin | && $(pwd) printf
+		&& then test readonly printf
+'quoted text' 'quoted text' "$@" "$1" grep -eu
+		$(pwd) readonly /usr/bin -eu printf 'quoted text' sed "$1" --verbose
+	2>/dev/null /usr/bin -eu readonly
+		export readonly sed x=1 -eu
+		then then local "$@" && export /usr/bin cd | test 2>/dev/null then
+		export echo ${HOME} -eu x=1 | export
+	'quoted text' export $(pwd)
+$(pwd) cd grep "$1" x=1 --verbose
+		test --verbose "$@" --verbose
+awk test -eu ${HOME} --verbose $(pwd)
+		echo cd ${HOME} -eu grep && | x=1 "$@" x=1 -eu grep local
+	test done readonly -eu -eu done ${HOME} ${HOME}
+| | then /usr/bin cd cd then export x=1 cd x=1 $(pwd) test ${HOME}
+	grep awk printf && -eu /usr/bin /usr/bin
+printf grep awk && "$1"
+grep grep --verbose done
+cd grep done ${HOME} grep
+${HOME} grep done awk $(pwd) done then
+	printf /usr/bin ${HOME} done /usr/bin
+local --verbose x=1 export /usr/bin "$@" -eu awk awk "$@"
+		-eu && grep done done "$@" printf local "$1"
+	echo export "$1" ${HOME} cd x=1 /usr/bin "$1" readonly then sed awk
+	readonly -eu 'quoted text' then then printf x=1 "$@" readonly echo done
+		x=1 'quoted text' local 2>/dev/null -eu
+"$@" 'quoted text' local sed --verbose && awk "$1" /usr/bin readonly x=1 readonly
+sed cd export cd "$@" "$1" /usr/bin
+	"$@" "$@" 2>/dev/null | export done then "$1" export "$@" cd ${HOME}
+'quoted text' /usr/bin then
+echo export then test | 'quoted text' && export | done /usr/bin 'quoted text'
+		sed 'quoted text' then export "$@" awk
+		-eu echo echo export done echo ${HOME} test then ${HOME} "$1" "$@" test -eu
+grep -eu awk echo grep | done /usr/bin /usr/bin readonly
+readonly printf echo echo
+local 'quoted text' && readonly "$@" local printf
+	done readonly echo printf --verbose --verbose echo --verbose
+		awk export "$1" "$@" /usr/bin grep
+	"$@" then "$1" --verbose then grep readonly ${HOME} grep ${HOME}
+	x=1 printf grep ${HOME} x=1 -eu -eu printf /usr/bin x=1 grep
+		${HOME} 'quoted text' then test "$1" test
+${HOME} printf awk printf "$1" grep local test "$@" sed done
+cd x=1 then /usr/bin $(pwd) x=1 test then awk grep done grep && /usr/bin 2>/dev/null
+cd local ${HOME} "$@" cd -eu
+	grep /usr/bin "$1" 2>/dev/null
+	local echo readonly -eu x=1
+		cd readonly -eu "$@" test | grep "$@" ${HOME} then
+${HOME} printf sed printf printf printf 'quoted text'
+2>/dev/null --verbose "$@" 'quoted text' done "$@" awk 2>/dev/null "$@"
+2>/dev/null awk printf readonly local "$1" "$1" -eu
+		printf then export cd ${HOME} then 'quoted text' --verbose 'quoted text'
+	2>/dev/null && echo 'quoted text' | export 'quoted text' test awk then test
+awk $(pwd) then grep readonly $(pwd) ${HOME} x=1 "$@" grep 2>/dev/null export
+${HOME} printf readonly "$1" /usr/bin local --verbose
+		grep local --verbose | ${HOME} printf then done
+sed "$1" 'quoted text' printf printf 'quoted text' $(pwd) awk export
+	then "$1" readonly readonly printf local then
+readonly /usr/bin "$1" cd export $(pwd) x=1 /usr/bin && --verbose
+		readonly | echo grep sed sed echo printf sed 'quoted text' local x=1
+	'quoted text' done | ${HOME} test /usr/bin test -eu x=1 echo awk
+		${HOME} $(pwd) export test x=1 && ${HOME} printf
+		-eu awk readonly printf sed printf cd sed 2>/dev/null echo grep
+$(pwd) /usr/bin ${HOME} sed | done "$1" grep export 2>/dev/null test cd
+	done sed "$1" ${HOME} ${HOME} "$@" && 2>/dev/null printf
+	grep 'quoted text' --verbose /usr/bin ${HOME} printf /usr/bin sed
+x=1 readonly "$@" echo local /usr/bin
+	local awk 'quoted text' -eu | done export | 2>/dev/null 'quoted text' 2>/dev/null
+		x=1 -eu then x=1 done awk echo echo "$1" cd readonly
+	${HOME} local awk local awk readonly local /usr/bin echo && echo
+		readonly | printf && "$1"
+		--verbose awk printf sed readonly test sed echo 2>/dev/null
+	| 'quoted text' readonly echo x=1 && /usr/bin test
+	awk sed "$1" /usr/bin printf printf sed 2>/dev/null test
+		| "$@" $(pwd) grep cd "$1" "$@" sed | "$1" 'quoted text' readonly --verbose cd
+readonly | local && 2>/dev/null
+	test awk $(pwd) $(pwd) then local | | grep -eu /usr/bin
+		readonly grep sed 'quoted text' echo 2>/dev/null echo export local x=1 && local
+	export export /usr/bin awk && grep -eu /usr/bin then /usr/bin
+test "$1" x=1 readonly 2>/dev/null "$1" | readonly
+		awk "$@" printf && cd 'quoted text' ${HOME}
+| echo "$1" export 2>/dev/null grep sed local test $(pwd) -eu
+	local local readonly
+		x=1 2>/dev/null ${HOME} /usr/bin export sed echo 'quoted text'
+		grep sed awk done --verbose "$@" printf "$@" | -eu printf
+	2>/dev/null -eu echo export 2>/dev/null
+	echo 'quoted text' "$1" 'quoted text'
+		awk && "$@" "$1" awk 'quoted text'
+		| "$1" then -eu "$@" echo then /usr/bin echo "$@" sed x=1 && grep done awk
+		/usr/bin | test $(pwd) /usr/bin grep printf grep ${HOME} grep $(pwd)
+		| ${HOME} done local then cd local --verbose done done $(pwd) "$1"
+	then && local && 'quoted text' | echo then 2>/dev/null
+	| ${HOME} 'quoted text' readonly "$1" ${HOME} | done 'quoted text' && export
+	&& x=1 then x=1 /usr/bin && --verbose /usr/bin readonly
+grep -eu --verbose local "$1"
+echo "$1" echo done done cd printf ${HOME} 'quoted text' ${HOME}
+	'quoted text' x=1 sed $(pwd) sed $(pwd) && export cd /usr/bin
+	--verbose && printf readonly printf ${HOME}
+	done "$@" && grep | local x=1 --verbose grep "$@" cd echo grep grep ${HOME}
+	&& --verbose 2>/dev/null -eu && | local x=1 grep test $(pwd) readonly test 'quoted text'
+		--verbose printf 2>/dev/null printf grep $(pwd) x=1 readonly
+	then /usr/bin -eu "$1" export local grep
+2>/dev/null $(pwd) printf | | cd x=1 local readonly then test
+	local export x=1 "$@" "$1" --verbose
+		grep then readonly -eu sed $(pwd) 'quoted text'
+		$(pwd) ${HOME} && local 'quoted text'
+		--verbose ${HOME} local -eu --verbose $(pwd) then 2>/dev/null cd
+		&& printf export readonly 'quoted text' -eu ${HOME} -eu test
+echo -eu sed grep x=1 echo -eu then then printf printf -eu then
+	--verbose -eu local /usr/bin local local export
+		| sed grep x=1 test --verbose
+awk x=1 test cd then done x=1 --verbose |
+	readonly export cd awk | readonly readonly ${HOME}
+	export $(pwd) awk 2>/dev/null printf done 2>/dev/null
+2>/dev/null && then echo sed | test awk readonly && $(pwd)
+		| "$@" printf 2>/dev/null readonly --verbose local grep "$@" awk |
+grep readonly awk then grep then 'quoted text' sed
+&& --verbose --verbose readonly -eu done /usr/bin -eu test grep test ${HOME}
+		'quoted text' -eu cd 'quoted text'
+test 'quoted text' x=1 x=1 'quoted text' /usr/bin 2>/dev/null "$@"
+	printf 'quoted text' x=1 -eu printf readonly awk printf then test test | "$@"
+		--verbose awk $(pwd) cd --verbose -eu
+	test test then --verbose sed --verbose local 'quoted text' && "$@" sed cd 2>/dev/null
+$(pwd) "$1" sed /usr/bin && -eu 2>/dev/null && sed | local grep printf test then
+awk --verbose 2>/dev/null | 2>/dev/null export 2>/dev/null then
+	"$@" export x=1 ${HOME} test "$@" local
+		-eu "$@" awk && ${HOME} "$@" /usr/bin local
+	echo export then test cd then 2>/dev/null then $(pwd) local 2>/dev/null
+then grep --verbose /usr/bin grep 2>/dev/null
+		2>/dev/null export awk && export /usr/bin 'quoted text' sed && -eu test
+	awk printf local --verbose --verbose 'quoted text' $(pwd)
+'quoted text' $(pwd) "$1" 'quoted text' "$1" grep awk | export echo
+		-eu test x=1 sed -eu /usr/bin
+test -eu export awk x=1 x=1 && 2>/dev/null 2>/dev/null grep "$@" "$1" /usr/bin
+"$1" "$1" export printf 'quoted text'
+		x=1 local 2>/dev/null ${HOME} "$@"
+	readonly && ${HOME} 2>/dev/null done grep test
+	"$@" test 2>/dev/null "$@" 2>/dev/null readonly done done done sed 2>/dev/null
+"$@" test "$1" -eu readonly x=1 'quoted text' "$1" 2>/dev/null local printf awk
+${HOME} sed "$@" then awk x=1 done /usr/bin then /usr/bin ${HOME}
+		echo cd readonly printf printf $(pwd) "$@" awk printf
+	echo 'quoted text' -eu ${HOME} then readonly "$@" readonly then
+		sed --verbose cd local &&
+		2>/dev/null awk printf /usr/bin readonly test
+	/usr/bin readonly $(pwd) 'quoted text' "$@" sed 2>/dev/null -eu
+	awk export | | $(pwd) && "$@" local --verbose --verbose cd "$1"
+		sed 'quoted text' ${HOME} echo /usr/bin | -eu then x=1 then -eu 2>/dev/null
+		awk done sed 'quoted text' "$1" printf echo cd sed -eu cd && /usr/bin grep sed
+	grep "$@" 2>/dev/null cd echo && grep | -eu
+grep "$@" test 'quoted text' done cd ${HOME} awk awk x=1 export | test readonly
+	x=1 --verbose cd 'quoted text' $(pwd) --verbose done 'quoted text' /usr/bin
+	then cd "$1" $(pwd) /usr/bin $(pwd) export -eu /usr/bin readonly export awk test
+	cd test && export "$1" cd readonly "$1" "$@"
+done && awk -eu | ${HOME} readonly && done /usr/bin grep test
+	2>/dev/null cd readonly export test /usr/bin /usr/bin
+then readonly -eu | echo done grep --verbose grep printf printf -eu export
+	/usr/bin sed "$1" 2>/dev/null "$@" readonly grep export
+done "$1" --verbose test ${HOME} $(pwd) --verbose "$@"
+	awk echo 2>/dev/null --verbose awk x=1 'quoted text' && local ${HOME} 'quoted text'
+cd cd /usr/bin then printf cd local $(pwd) then --verbose
+	${HOME} 2>/dev/null && "$@" grep --verbose -eu | ${HOME} echo
+/usr/bin --verbose done
+cd ${HOME} grep --verbose -eu echo "$@" cd -eu 'quoted text' && then local "$@"
+	grep -eu printf && "$1" x=1 echo test | test awk export 'quoted text'
+&& grep x=1 awk x=1 && && done x=1 x=1 awk
+		2>/dev/null "$1" grep cd x=1 ${HOME} awk -eu | | then then
+		x=1 then then local && readonly /usr/bin
+		$(pwd) 2>/dev/null && "$1" && | done ${HOME} && ${HOME} /usr/bin export
+export done export 'quoted text' printf "$1" 'quoted text'
+		/usr/bin "$1" "$@" grep | export && && /usr/bin /usr/bin grep awk -eu grep done
+		sed printf awk "$1" $(pwd) awk "$@" cd | $(pwd) 2>/dev/null 'quoted text'
+	'quoted text' sed sed ${HOME} test
+		sed "$1" grep grep readonly
+		"$@" grep local awk $(pwd) 'quoted text' readonly
+	x=1 then --verbose sed sed test /usr/bin
+$(pwd) printf $(pwd) printf grep /usr/bin
+		done readonly awk export local -eu test cd awk test ${HOME} "$1" "$1" sed readonly
+		${HOME} 2>/dev/null $(pwd)
+	printf done printf 2>/dev/null $(pwd) readonly
+	'quoted text' "$@" 'quoted text' "$@"
+	/usr/bin test --verbose cd | | printf -eu $(pwd) cd /usr/bin
+		sed awk then && x=1 && &&
+	'quoted text' $(pwd) --verbose then then $(pwd) sed "$@" x=1 $(pwd) &&
+		/usr/bin "$1" "$1" 'quoted text'
+		&& awk 2>/dev/null awk
+	local cd export "$1"
+	sed sed && awk --verbose echo x=1 awk "$1" --verbose
+sed grep x=1 --verbose export grep local -eu $(pwd)
+	2>/dev/null "$1" readonly "$1" readonly cd then readonly readonly test local 2>/dev/null
+	&& --verbose | echo cd test echo readonly awk done 2>/dev/null
+-eu done && "$1" --verbose "$@" && then test local local sed --verbose "$@" "$@"
+	sed $(pwd) /usr/bin echo test grep && 'quoted text'
+		$(pwd) echo grep cd sed
+	${HOME} sed then readonly 'quoted text'
+	awk /usr/bin cd -eu 'quoted text' --verbose x=1 cd $(pwd)
+--verbose echo echo export test echo done --verbose test awk | 2>/dev/null 2>/dev/null
+		'quoted text' /usr/bin ${HOME} $(pwd) "$@" x=1
+	local cd ${HOME} $(pwd) "$@" "$@" && done $(pwd) cd export echo /usr/bin $(pwd)
+sed -eu 2>/dev/null readonly sed printf "$1" ${HOME} then
+		2>/dev/null test "$1" --verbose /usr/bin ${HOME}
+	test "$@" readonly sed "$@" cd $(pwd) x=1 && then "$1" 2>/dev/null cd
+printf test && local cd | readonly "$@" x=1 "$@" /usr/bin 2>/dev/null
+	printf | $(pwd) 2>/dev/null 'quoted text' export grep "$1" readonly
+		readonly awk -eu cd awk grep 2>/dev/null -eu && x=1 $(pwd)
+		$(pwd) echo $(pwd) cd readonly
+'quoted text' $(pwd) printf
+	'quoted text' echo /usr/bin readonly test echo "$1" grep --verbose
+| -eu printf printf x=1 cd ${HOME} awk done -eu | echo local sed 'quoted text'
+		done then test cd | local 'quoted text' cd
+		${HOME} && printf grep export readonly "$1" cd printf 'quoted text' done "$1"
+		"$1" readonly printf printf ${HOME} grep x=1 $(pwd)
+		printf --verbose && cd ${HOME} "$@"
+		test ${HOME} done x=1 ${HOME} "$1" ${HOME} sed --verbose
+		sed done done 2>/dev/null "$@" export "$1" "$@" $(pwd)
+		sed ${HOME} "$1" "$1" 'quoted text' --verbose
+	$(pwd) /usr/bin $(pwd) test then local x=1
+x=1 ${HOME} cd test awk echo && | | 2>/dev/null
+	awk x=1 'quoted text' local export /usr/bin grep awk ${HOME}
+export then readonly printf
+		cd printf 2>/dev/null done cd printf cd && export ${HOME} printf local |
+		| export test /usr/bin then local local local -eu "$1" echo 2>/dev/null test
+		"$1" /usr/bin x=1 echo test printf readonly awk x=1 then test awk -eu && awk
+	"$1" readonly awk "$@" -eu ${HOME} echo
+		/usr/bin --verbose cd x=1 readonly then
+		'quoted text' local then local /usr/bin "$1" awk local cd
+		&& -eu grep "$1" && done x=1 grep done awk test
+cd 2>/dev/null cd 2>/dev/null 'quoted text' $(pwd) grep awk
+		echo ${HOME} export -eu "$1" /usr/bin
+		echo grep /usr/bin done then $(pwd) "$@" printf test -eu ${HOME}
+	2>/dev/null export "$@" | cd 'quoted text' -eu then test --verbose --verbose
+	$(pwd) "$@" test grep 2>/dev/null then /usr/bin /usr/bin /usr/bin
+	printf && | 2>/dev/null "$1" test readonly
+"$1" 2>/dev/null echo export | "$1" "$1" --verbose local sed grep grep grep
+		awk 'quoted text' 2>/dev/null /usr/bin $(pwd) 2>/dev/null
+	${HOME} $(pwd) sed /usr/bin
+		"$@" local "$1" awk awk | -eu -eu readonly echo | readonly
+		then --verbose x=1 "$1" awk
+-eu 2>/dev/null /usr/bin done 'quoted text' | 2>/dev/null local
+		echo "$1" local "$1" grep -eu done
+	sed grep echo -eu printf local && then | export done export local 'quoted text'
+	test $(pwd) | /usr/bin sed $(pwd) awk done
+	export "$@" sed echo ${HOME} test echo awk "$@" 'quoted text' x=1 2>/dev/null
+/usr/bin readonly local x=1 /usr/bin local grep $(pwd) echo x=1 awk then "$1"
+${HOME} echo done done cd $(pwd) 2>/dev/null
+x=1 awk | 2>/dev/null readonly done --verbose -eu sed awk local sed printf
+2>/dev/null awk /usr/bin sed --verbose 2>/dev/null x=1 'quoted text'
+		-eu -eu | -eu grep echo && local "$@"
+		cd ${HOME} | export "$1" done readonly
+		$(pwd) printf --verbose && "$1" $(pwd) --verbose
+/usr/bin ${HOME} local && grep | "$@"
+test -eu printf echo x=1 awk test echo cd --verbose
+		/usr/bin cd x=1 $(pwd)
+'quoted text' x=1 "$1" "$@" printf | ${HOME} && test x=1 then x=1 x=1 export
+x=1 sed | awk done && "$@"
+	$(pwd) grep -eu echo | --verbose
+		--verbose readonly -eu awk && 'quoted text'
+	cd sed export "$1" export && x=1
+		echo && readonly -eu echo "$1" && /usr/bin
+printf grep cd | cd | then 2>/dev/null done done --verbose printf "$@" cd readonly
+	${HOME} && grep --verbose awk 2>/dev/null
+	done | local printf x=1 ${HOME} sed grep
+		$(pwd) && printf "$1" /usr/bin cd export | ${HOME} echo readonly
+	-eu cd grep 2>/dev/null local
+		test readonly /usr/bin grep $(pwd) --verbose printf
+	/usr/bin cd export 2>/dev/null test done echo local then 'quoted text' then
+	-eu local "$1" done && then 'quoted text' sed
+sed then $(pwd) cd -eu export test cd --verbose | "$1" 2>/dev/null
+	printf test cd ${HOME} | awk $(pwd) && /usr/bin -eu sed "$@" && /usr/bin
+		readonly test sed awk "$@" readonly
+		sed "$1" "$1" ${HOME} cd printf ${HOME} ${HOME}
+	printf test export -eu
+		$(pwd) | readonly ${HOME} then export echo $(pwd) "$@" && export
+/usr/bin -eu "$1" x=1 && --verbose test "$@"
+&& --verbose readonly /usr/bin 2>/dev/null x=1 sed ${HOME}
+		sed 'quoted text' local echo sed printf test $(pwd) -eu
+		cd "$1" $(pwd) "$@" 2>/dev/null x=1 cd -eu x=1 test grep &&
+	readonly sed x=1 cd readonly readonly 'quoted text' x=1 readonly $(pwd) test
+	cd -eu awk grep 'quoted text' then then --verbose
+"$1" && "$1" "$@" cd x=1 printf echo
+cd printf done "$@" 2>/dev/null export --verbose
+readonly --verbose && -eu awk then awk local then local grep
+	then awk sed "$1" test cd | cd cd $(pwd) && export readonly test 2>/dev/null
+		done "$1" && then export awk "$@" | $(pwd) cd "$1" "$1"
+2>/dev/null /usr/bin sed sed /usr/bin --verbose ${HOME} test cd sed readonly cd
+cd awk 2>/dev/null export awk 'quoted text' sed printf /usr/bin
+		then test ${HOME} cd cd --verbose $(pwd) | export x=1 grep echo --verbose
+	2>/dev/null then && awk export grep && $(pwd) && &&
+		/usr/bin readonly echo export export -eu "$@" /usr/bin done awk done printf
+		echo $(pwd) "$@" echo echo sed
+	$(pwd) | local -eu grep test &&
+local done export /usr/bin done
+		local printf local done done && done sed ${HOME}
+	/usr/bin ${HOME} 2>/dev/null sed local then ${HOME} $(pwd)
+--verbose export /usr/bin
+		export x=1 printf test && grep readonly sed then echo cd export
+test $(pwd) local test test 2>/dev/null
+	echo "$@" $(pwd) 'quoted text' done 2>/dev/null
+		x=1 ${HOME} then ${HOME} 'quoted text' sed $(pwd) export "$@"
+then "$1" $(pwd) x=1 local test
+| /usr/bin sed then readonly $(pwd) "$1" $(pwd) | export /usr/bin
+2>/dev/null -eu "$@" 'quoted text' echo /usr/bin
+	&& --verbose readonly readonly export 'quoted text'
+		/usr/bin | "$1" "$@" /usr/bin -eu printf $(pwd) printf --verbose && test then
+	"$1" x=1 then ${HOME} x=1 readonly echo awk cd -eu 2>/dev/null
+		"$1" && "$@" -eu test "$1" 'quoted text'
+		sed cd sed grep export ${HOME} printf /usr/bin then && 'quoted text'
+x=1 | ${HOME} $(pwd) | local /usr/bin "$@"
+	&& then 2>/dev/null awk done then
+		readonly 2>/dev/null export ${HOME} && sed $(pwd) cd readonly
+		'quoted text' x=1 "$1" printf /usr/bin
+	export cd 'quoted text' /usr/bin 2>/dev/null export readonly printf
+	grep cd -eu export done then /usr/bin && 'quoted text' local $(pwd) done done
+awk ${HOME} "$@" -eu --verbose $(pwd)
+		done x=1 $(pwd) echo /usr/bin "$1" /usr/bin
+		| x=1 /usr/bin --verbose printf
+export $(pwd) sed cd local awk
+/usr/bin x=1 sed test readonly
+		$(pwd) export sed -eu test cd x=1 grep then "$@" ${HOME} x=1 grep sed
+readonly --verbose awk -eu | then 2>/dev/null readonly done | readonly
+		done --verbose echo readonly 'quoted text' x=1 $(pwd) 'quoted text'
+	$(pwd) 'quoted text' readonly export --verbose "$1" && local "$@" && && 2>/dev/null
+	'quoted text' export 'quoted text' export | export
+printf --verbose ${HOME} test "$@" readonly
+		${HOME} echo | x=1 2>/dev/null sed -eu cd grep | | 2>/dev/null readonly
+-eu --verbose "$@" "$1" && 'quoted text'
+readonly && "$@" grep sed "$@" awk 2>/dev/null
+	echo local "$1" --verbose
+	'quoted text' sed export "$1" sed printf 'quoted text' $(pwd)
+		2>/dev/null local printf printf then --verbose grep test echo printf
+printf 'quoted text' grep
+		2>/dev/null 2>/dev/null
+printf then grep then readonly sed test $(pwd)
+	/usr/bin echo 'quoted text'
+test local export cd sed echo /usr/bin
+		'quoted text' local awk awk 'quoted text' "$@" --verbose grep
+$(pwd) test then && 2>/dev/null then |
+		"$@" grep | awk awk echo | then readonly cd x=1 /usr/bin readonly sed
+grep | ${HOME} awk awk awk ${HOME} export then sed 2>/dev/null 2>/dev/null
+"$@" export awk /usr/bin echo done /usr/bin readonly 'quoted text' cd
+	| "$1" | "$@" ${HOME} awk sed "$@" export 2>/dev/null $(pwd) local
+sed then && "$1" "$@" 'quoted text' | && "$1" ${HOME} then x=1 /usr/bin ${HOME}
+		test awk echo 2>/dev/null local echo readonly test sed awk --verbose
+readonly "$@" printf "$1" x=1 printf awk awk ${HOME} && export
+	awk then 'quoted text' then "$@" readonly 2>/dev/null export
+-eu printf grep printf --verbose cd ${HOME} done local export -eu 'quoted text'
+	"$@" x=1 | grep printf cd grep then /usr/bin && ${HOME} printf "$1"
+$(pwd) | grep /usr/bin echo
+		'quoted text' local $(pwd) "$1" | "$@" /usr/bin done -eu readonly
+	-eu awk -eu echo | x=1 done
+	cd then sed 'quoted text' --verbose --verbose export
+		cd done /usr/bin printf export -eu cd
+		$(pwd) "$@" ${HOME} cd echo echo local then readonly
+-eu 2>/dev/null awk readonly 'quoted text' | readonly echo | $(pwd) -eu test
+	test test sed grep /usr/bin
+done $(pwd) 'quoted text' grep
+${HOME} cd && --verbose $(pwd) cd test
+		"$1" | done awk "$1" printf --verbose | echo then grep 2>/dev/null
+	-eu "$1" grep export "$1" ${HOME} ${HOME} && --verbose grep --verbose
+		awk "$1" -eu x=1 $(pwd) test 'quoted text' && sed "$1" 'quoted text'
+	then -eu readonly grep ${HOME}
+	/usr/bin readonly -eu test export echo
+		printf grep 'quoted text' ${HOME} local ${HOME} x=1 && ${HOME} "$1" grep x=1 --verbose
+		$(pwd) export -eu && local 'quoted text' sed awk $(pwd) --verbose
+	-eu local --verbose 'quoted text' $(pwd) 2>/dev/null
+	then sed -eu /usr/bin x=1 local x=1 -eu /usr/bin readonly
+	&& done echo sed echo local "$@"
+		--verbose 2>/dev/null echo /usr/bin ${HOME}
+		export x=1 /usr/bin x=1 printf $(pwd) printf readonly
+'quoted text' 'quoted text' | --verbose then -eu && echo export -eu 2>/dev/null
+	export $(pwd) printf awk "$1" 2>/dev/null -eu test
+		&& && x=1 echo --verbose ${HOME} printf done "$1" x=1
+local echo cd grep --verbose "$@" --verbose grep $(pwd)
+	x=1 /usr/bin --verbose done readonly test "$1" "$@" 2>/dev/null sed sed cd --verbose
+	grep 'quoted text' cd
+		awk awk sed x=1 "$1" echo grep then x=1 "$1" grep $(pwd)
+	readonly /usr/bin 'quoted text' test awk sed -eu ${HOME} ${HOME} then echo then
+		echo | 2>/dev/null | && --verbose export then
+		&& done -eu $(pwd) "$1" "$@" export printf
+	'quoted text' /usr/bin grep -eu "$@" printf 2>/dev/null x=1
+then local $(pwd) && && sed test test
+		/usr/bin test /usr/bin awk $(pwd) && -eu
+		done cd then /usr/bin readonly
+		readonly /usr/bin export
+		printf && /usr/bin sed grep echo -eu printf readonly export
+		then "$1" "$1" --verbose 2>/dev/null 'quoted text'
+	local grep 2>/dev/null grep export test grep "$1" readonly
+	'quoted text' ${HOME} -eu printf --verbose readonly "$@" awk /usr/bin done test
+	--verbose echo then printf "$@" "$1" sed 2>/dev/null "$@" readonly
+	test 'quoted text' export cd 'quoted text' /usr/bin -eu 'quoted text' -eu
+	test sed done awk --verbose "$1"
+-eu awk 2>/dev/null x=1 'quoted text' readonly $(pwd) ${HOME} local
+"$1" then x=1 awk /usr/bin && then
+$(pwd) local 'quoted text' | ${HOME} readonly then -eu export /usr/bin x=1
+	"$@" "$1" | grep && sed "$1"
+	export "$1" grep x=1 x=1 "$@" "$1" -eu && cd export "$@" awk echo awk && readonly
+export sed readonly ${HOME} printf then
+		2>/dev/null $(pwd) done local "$@" echo -eu cd grep printf --verbose awk
+then $(pwd) sed -eu -eu "$@" awk "$@" "$1" grep test export
+		2>/dev/null test readonly $(pwd) printf grep x=1 'quoted text'
+sed ${HOME} cd sed "$1" x=1 export 2>/dev/null $(pwd) readonly --verbose
+sed x=1 && grep $(pwd) /usr/bin x=1 $(pwd) "$@" export cd x=1 ${HOME}
+	--verbose -eu awk &&
+		done test export test ${HOME} && readonly printf cd x=1 "$@"
+-eu done done $(pwd) test done local $(pwd) readonly && then then local "$@"
+		then export local test 2>/dev/null
+| cd then awk | awk grep then
+		cd /usr/bin 'quoted text' test done readonly
+		then --verbose sed readonly export | grep 'quoted text' sed
+	then -eu 2>/dev/null awk readonly export test local
+printf $(pwd) awk printf grep 2>/dev/null
+	printf ${HOME} 'quoted text' local /usr/bin 'quoted text'
+sed grep awk awk "$@" && cd "$@" local test
+		| -eu | 2>/dev/null --verbose export "$1" echo --verbose test 2>/dev/null
+test sed ${HOME} cd | 2>/dev/null && done $(pwd) done sed "$@" done && --verbose
+		echo 'quoted text' --verbose sed /usr/bin
+export 2>/dev/null printf 'quoted text'
+$(pwd) $(pwd) "$1" ${HOME}
+	echo 2>/dev/null /usr/bin -eu done "$@" cd x=1 test sed 2>/dev/null
+		readonly sed "$1" local awk echo local readonly local &&
+printf 'quoted text' "$@" awk "$1" sed x=1 'quoted text' --verbose
+	'quoted text' readonly $(pwd) done printf
+		--verbose readonly grep grep grep "$1" | 2>/dev/null
+		-eu readonly 'quoted text' export x=1 2>/dev/null test done "$1" grep cd $(pwd)
+	/usr/bin $(pwd) test then /usr/bin --verbose
+		--verbose test printf test export readonly 2>/dev/null then $(pwd) sed
+'quoted text' --verbose /usr/bin grep | readonly readonly "$1"
+		echo "$@" x=1 printf test awk | | echo printf --verbose test local cd echo
+2>/dev/null ${HOME} $(pwd) local
+		sed $(pwd) cd export x=1 cd "$@" ${HOME} cd sed sed "$1" "$@" grep
+-eu --verbose ${HOME} "$1" $(pwd) | grep
+		local --verbose 'quoted text' echo awk sed local "$1" 2>/dev/null
+		"$@" echo test echo && grep | && test "$@" test --verbose readonly --verbose ${HOME}
+		$(pwd) export && cd --verbose
+	$(pwd) "$1" | awk readonly "$@" grep | 2>/dev/null export x=1
+	echo x=1 /usr/bin cd | $(pwd) awk local printf export
+	printf awk grep | grep --verbose export awk test "$1" | done cd readonly /usr/bin
+done readonly test x=1 /usr/bin ${HOME} 2>/dev/null
+done echo readonly "$1" ${HOME} 'quoted text' ${HOME} test
+test then | awk 2>/dev/null cd printf
+echo 2>/dev/null test &&
+	${HOME} 'quoted text'
+| $(pwd) "$@" | | 'quoted text'
+	awk grep | readonly sed cd sed | then
+		readonly awk --verbose --verbose
+printf ${HOME} printf x=1 x=1 then local /usr/bin "$1" -eu
+	| export 'quoted text' printf then then /usr/bin $(pwd) printf done readonly /usr/bin
+'quoted text' -eu grep "$@" ${HOME}
+		readonly --verbose "$1" && awk --verbose "$@" done ${HOME}
+	printf --verbose 'quoted text' then cd --verbose sed --verbose "$@" $(pwd) &&
+		'quoted text' cd done x=1 && sed echo test | --verbose echo
+		grep 'quoted text' ${HOME} awk export local awk
+	2>/dev/null then readonly cd 2>/dev/null x=1 ${HOME}
+/usr/bin grep && x=1 printf -eu | test awk echo cd "$1" local $(pwd) grep &&
+		2>/dev/null "$@" sed "$1" sed &&
+		"$1" grep x=1 "$@" /usr/bin readonly then && "$@"
+	cd "$@" /usr/bin x=1 x=1 x=1
+		&& x=1 then sed echo "$@"
+	| | -eu ${HOME} readonly local && --verbose
+		echo cd "$1" $(pwd) local
+		x=1 cd readonly $(pwd) $(pwd) 'quoted text'
+		readonly | /usr/bin test | grep /usr/bin done x=1 "$1" "$1" "$1" echo printf
+cd --verbose readonly $(pwd) sed awk -eu ${HOME} 'quoted text' export then grep
+	grep local readonly readonly 'quoted text' readonly cd sed local export
+		sed cd --verbose echo grep
+--verbose grep 'quoted text' awk "$1" && done printf | awk
+test printf 'quoted text' done ${HOME} printf
+		| awk && printf 2>/dev/null /usr/bin
+${HOME} && --verbose | echo --verbose --verbose
+-eu local | printf export readonly $(pwd) &&
+awk awk awk printf test readonly grep "$@"
+awk ${HOME} export 'quoted text'
+	awk readonly grep echo "$1" --verbose export 2>/dev/null export 2>/dev/null
+printf "$1" $(pwd) --verbose
+		x=1 export 'quoted text' | done readonly && --verbose local
+		$(pwd) cd 2>/dev/null 'quoted text' x=1 /usr/bin 2>/dev/null readonly ${HOME}
+$(pwd) ${HOME} "$1" awk ${HOME} "$@"
+	export --verbose ${HOME} x=1 awk --verbose "$@" 2>/dev/null
+2>/dev/null --verbose | done $(pwd)
+--verbose done sed grep then $(pwd) export x=1
+cd then /usr/bin | then "$@" 'quoted text' printf "$@" ${HOME} x=1
+		"$1" export done "$@" $(pwd) $(pwd)
+	awk "$1" /usr/bin local "$1" awk then "$@"
+$(pwd) grep x=1 ${HOME} | | &&
+		echo 'quoted text' $(pwd) -eu export readonly done
+		${HOME} echo /usr/bin "$1" 2>/dev/null $(pwd) | -eu /usr/bin && export
+		$(pwd) echo local awk done "$@" readonly --verbose printf test
+	readonly ${HOME} "$1" --verbose $(pwd) grep then --verbose 'quoted text'
+printf cd done test then "$1" printf grep grep done echo sed -eu x=1 'quoted text'
+		test "$@" then && printf awk ${HOME} done cd grep | awk grep
+		&& /usr/bin $(pwd) | local ${HOME}
+	x=1 export 2>/dev/null cd awk "$@" echo
+x=1 cd readonly && cd -eu export $(pwd)
+		${HOME} awk grep --verbose $(pwd) export
+		'quoted text' cd then ${HOME} awk then export export export echo
+"$@" done sed done test && "$1" then cd local awk "$1" sed | --verbose
+sed x=1 readonly done "$@" readonly export sed
+		printf export then 2>/dev/null ${HOME} done | sed "$@" /usr/bin export
+test | x=1 grep local local grep readonly cd test $(pwd) && awk x=1
+		export test | local grep && export "$@" echo "$@"
+	| readonly /usr/bin done
+		"$@" -eu local local grep sed awk /usr/bin --verbose export /usr/bin
+	x=1 readonly 2>/dev/null done --verbose
+		| readonly && awk printf
+	printf x=1 cd printf "$@" /usr/bin /usr/bin "$1" grep
+readonly --verbose readonly "$@" && "$1" 'quoted text'
+done "$1" | local readonly x=1 then "$1" done 'quoted text'
+		| --verbose 2>/dev/null && sed "$@"
+		then "$@" export "$@" sed ${HOME} sed readonly -eu cd $(pwd) sed done awk
+"$@" 2>/dev/null x=1 local local | sed --verbose --verbose 'quoted text'
+	x=1 cd ${HOME} then local ${HOME} echo "$1" export | /usr/bin export x=1
+	printf grep | test cd x=1 "$1" export sed done
+&& export /usr/bin awk --verbose readonly awk -eu echo | local ${HOME}
+	&& && /usr/bin -eu printf ${HOME} 2>/dev/null awk 'quoted text'
+		then -eu x=1 printf echo test readonly done 2>/dev/null echo --verbose --verbose
+	'quoted text' "$1" -eu export
+		readonly --verbose printf cd local /usr/bin readonly local &&
+	"$1" 'quoted text' "$@"
+		x=1 local echo /usr/bin local $(pwd)
+		"$1" export --verbose test
+$(pwd) printf printf $(pwd) sed readonly
+2>/dev/null test grep sed local awk sed done "$@" /usr/bin 2>/dev/null
+	'quoted text' grep readonly x=1 done && export done export 'quoted text' cd local
+-eu cd 'quoted text' "$@" --verbose sed 2>/dev/null done 2>/dev/null readonly
+	awk 'quoted text' grep | -eu awk echo && 'quoted text'
+		then /usr/bin /usr/bin $(pwd) local sed "$@" && ${HOME} export
+sed 2>/dev/null 'quoted text'
+"$@" "$@" x=1 "$@" $(pwd) | -eu 2>/dev/null printf "$@" cd sed export
+	export awk $(pwd) readonly sed ${HOME} printf printf $(pwd)
+	/usr/bin readonly local x=1 readonly sed | -eu
+	2>/dev/null then sed "$@" ${HOME} readonly echo ${HOME}
+		${HOME} grep echo awk local
+$(pwd) 'quoted text' test -eu 'quoted text'
+	/usr/bin echo awk sed "$1" done $(pwd)
+2>/dev/null && x=1 /usr/bin x=1 cd sed && grep
+test test /usr/bin then ${HOME}
+		grep grep "$1" awk 2>/dev/null
+		readonly done done echo grep x=1 export local sed export -eu
+	readonly -eu grep && cd x=1 -eu local printf then
+		export sed /usr/bin | -eu echo --verbose sed
+	&& test 2>/dev/null $(pwd) test | && "$1" cd 2>/dev/null /usr/bin test "$1"
+test -eu printf ${HOME} test --verbose grep | && grep
+		/usr/bin test test -eu x=1 'quoted text' awk --verbose sed grep -eu && 2>/dev/null
+		export --verbose done --verbose done --verbose -eu done 2>/dev/null
+		sed done echo $(pwd) -eu /usr/bin done 'quoted text'
+--verbose /usr/bin export test sed --verbose 2>/dev/null cd awk "$@"
+test /usr/bin 'quoted text' sed
+"$@" test grep "$1" /usr/bin
+cd --verbose 2>/dev/null echo done ${HOME} printf done echo
+	/usr/bin cd awk ${HOME} $(pwd)
+2>/dev/null "$1" then echo done
+"$@" sed printf then --verbose then && 'quoted text'
+--verbose $(pwd) grep $(pwd) cd | && -eu -eu /usr/bin
+	printf && readonly echo
+		printf awk /usr/bin ${HOME} 2>/dev/null
+	--verbose --verbose && export
+	grep readonly awk && ${HOME} grep ${HOME} "$1" local
+	${HOME} "$1" -eu cd "$1" readonly |
+test --verbose 2>/dev/null then | grep /usr/bin echo echo printf /usr/bin
+	echo printf --verbose test 'quoted text' && test --verbose test
+		'quoted text' awk done
+		cd echo "$@" -eu "$1" then | 2>/dev/null
+"$1" readonly | /usr/bin "$@" printf /usr/bin export readonly $(pwd) done export
+"$@" --verbose ${HOME} local "$@" test awk local done $(pwd) grep local cd local
+	2>/dev/null x=1 x=1 $(pwd)
+		2>/dev/null x=1 /usr/bin cd
+echo /usr/bin /usr/bin awk awk /usr/bin readonly "$@" readonly
+		local 'quoted text' "$@" done "$@" --verbose ${HOME} -eu "$@"
+'quoted text' printf ${HOME} export export readonly readonly "$1"
+/usr/bin | awk local export
+		$(pwd) 'quoted text' /usr/bin
+x=1 cd printf local sed $(pwd) local test --verbose sed | 2>/dev/null then readonly
+		printf grep cd then local x=1 export && x=1 --verbose
+	&& /usr/bin -eu -eu echo test -eu /usr/bin echo 'quoted text'
+	export echo 'quoted text' -eu grep 2>/dev/null ${HOME} sed $(pwd)
+		echo && -eu "$@" test | 2>/dev/null export "$1" 2>/dev/null
+	sed "$1" "$@" 'quoted text' -eu --verbose cd ${HOME}
+cd readonly 2>/dev/null ${HOME} 2>/dev/null then grep 'quoted text' x=1 echo readonly
+echo sed "$1" test local echo "$@" export readonly export then local x=1 $(pwd)
+	'quoted text' "$@" "$@" echo echo x=1
+	readonly -eu -eu -eu "$@" local echo done "$@" $(pwd) local /usr/bin -eu export
+		$(pwd) "$@" 2>/dev/null local | | test echo export | grep readonly $(pwd) grep
+"$@" 'quoted text' && local then sed --verbose local grep 2>/dev/null 2>/dev/null
+2>/dev/null then ${HOME} test 'quoted text'
+--verbose /usr/bin grep done $(pwd) test -eu sed export
+x=1 "$1" printf $(pwd) /usr/bin
+		x=1 -eu "$1" 'quoted text' "$@" /usr/bin $(pwd)
+		export awk done readonly test
+		"$@" "$1" test x=1 sed sed local then done printf test | grep | printf 'quoted text'
+		readonly && x=1 echo x=1 ${HOME}
+	grep cd | -eu 'quoted text' export "$1" test done ${HOME} | x=1 && awk done
+echo grep grep 2>/dev/null && echo export
+$(pwd) echo | grep $(pwd) | 'quoted text' /usr/bin | && awk echo awk -eu
+"$1" x=1 x=1 $(pwd) awk
+	2>/dev/null cd /usr/bin sed cd printf $(pwd) done export done x=1 local printf
+local printf $(pwd) | cd local "$1" test x=1 x=1 local
+	done 'quoted text' export readonly /usr/bin -eu then local "$@"
+	grep x=1 --verbose sed /usr/bin echo sed | printf printf --verbose "$1" $(pwd) &&
+		2>/dev/null | | sed | test /usr/bin "$@" x=1 $(pwd)
+		printf cd /usr/bin | cd
+		cd test printf /usr/bin local
+		'quoted text' "$1" --verbose done --verbose local 'quoted text'
+/usr/bin cd cd $(pwd) export test x=1 awk done printf echo
+	--verbose /usr/bin sed && sed $(pwd)
+		2>/dev/null -eu 'quoted text' test | sed /usr/bin export /usr/bin -eu /usr/bin
+	"$@" readonly x=1 export sed readonly x=1 echo test done cd sed /usr/bin awk test
+	local x=1 printf printf readonly cd x=1 cd readonly
+		| grep echo ${HOME} test && test "$1"
+$(pwd) "$@" ${HOME} local awk done
+test 'quoted text' export $(pwd)
+		then 'quoted text' local awk x=1 | && ${HOME} 2>/dev/null /usr/bin
+		/usr/bin export | && test then x=1 ${HOME}
+	echo sed grep "$1" && echo then && then "$@" readonly export | x=1 local
+	2>/dev/null 'quoted text' /usr/bin && cd $(pwd) test
+		echo x=1 -eu 'quoted text' x=1 2>/dev/null 2>/dev/null awk -eu
+echo && "$@" local /usr/bin readonly && sed | 2>/dev/null
+		2>/dev/null && x=1 echo --verbose
+	&& cd | sed && "$1" grep ${HOME}
+		export x=1 -eu local -eu then local 'quoted text'
+local cd export local sed -eu /usr/bin cd cd grep
+		done -eu | local printf /usr/bin test --verbose && "$@" then $(pwd) awk
+"$@" sed /usr/bin /usr/bin printf readonly cd readonly ${HOME}
+"$1" export /usr/bin /usr/bin -eu export
+		cd readonly printf ${HOME} test readonly echo x=1 $(pwd)
+	| 'quoted text' $(pwd) done readonly /usr/bin local done grep "$1"
+'quoted text' then 'quoted text' ${HOME} && test sed
+	${HOME} | /usr/bin "$1" 'quoted text' echo ${HOME} 2>/dev/null test -eu ${HOME}
+	"$@" -eu cd printf awk readonly ${HOME} echo --verbose done "$@"
+$(pwd) ${HOME} sed "$1" then && test echo
+then grep sed $(pwd) sed 2>/dev/null
+		/usr/bin "$@" readonly
+		printf /usr/bin grep /usr/bin echo grep | | /usr/bin export then awk
+		sed -eu done then $(pwd) $(pwd) 2>/dev/null 'quoted text'
+		awk local local /usr/bin grep
+	awk export done "$1" awk printf 'quoted text' sed ${HOME} "$@"
+		then -eu x=1 "$1" echo --verbose readonly cd "$@" /usr/bin
+	| cd sed export cd awk $(pwd)
+local && grep && x=1 awk ${HOME} /usr/bin
+		--verbose export -eu "$@" /usr/bin && "$1" readonly "$1" sed && -eu awk readonly
+	| | printf /usr/bin "$1" && done grep awk cd printf
+$(pwd) $(pwd) --verbose 'quoted text' /usr/bin && awk then local grep test
+	&& sed --verbose 2>/dev/null done
+readonly "$1" then local echo local done export /usr/bin printf
+		2>/dev/null | export 2>/dev/null x=1 printf ${HOME}
+	done ${HOME} sed ${HOME} /usr/bin export
+		&& ${HOME} 2>/dev/null sed awk | awk $(pwd) $(pwd) | && done "$@"
+		2>/dev/null readonly $(pwd)
+		x=1 "$@" echo --verbose test x=1
+	-eu cd /usr/bin done done done
+	printf --verbose --verbose ${HOME} test
+	${HOME} "$1" --verbose readonly cd "$1" export grep
+	/usr/bin sed sed x=1 echo readonly local cd
+		x=1 test grep ${HOME} echo
+echo echo then | cd awk echo done 'quoted text' "$1" readonly "$1" echo done
+	then $(pwd) 2>/dev/null x=1 'quoted text' echo cd readonly then cd
+'quoted text' local test readonly x=1 "$@" sed
+${HOME} echo /usr/bin --verbose 2>/dev/null grep cd test
+	readonly export echo test "$1"
+'quoted text' grep then ${HOME} /usr/bin x=1 cd awk sed -eu x=1 test
+/usr/bin "$@" 2>/dev/null then test $(pwd) 'quoted text' printf ${HOME} | sed
+		awk local | test sed local sed 'quoted text' export grep awk local --verbose -eu
+		-eu -eu -eu $(pwd) /usr/bin | done awk cd then 'quoted text'
+echo cd sed done x=1 | awk && /usr/bin then "$@"
+2>/dev/null $(pwd) awk done | --verbose done awk grep then x=1 2>/dev/null &&
+echo "$1" export local local sed ${HOME}
+		done local readonly printf "$1" -eu "$1" "$1" $(pwd) awk ${HOME}
+&& awk readonly ${HOME} | 'quoted text' done
+	/usr/bin 2>/dev/null awk $(pwd) /usr/bin export && 2>/dev/null &&
+		x=1 sed printf test echo done --verbose "$1"
+	$(pwd) --verbose --verbose && && readonly
+	"$1" then cd readonly x=1 'quoted text' "$1" "$1" --verbose export --verbose
+/usr/bin sed | export
+printf readonly readonly grep sed printf 'quoted text' /usr/bin echo
+test export -eu done printf
+	then 'quoted text' cd && "$1" printf cd readonly --verbose
+	printf "$@" 2>/dev/null printf ${HOME} x=1 export test /usr/bin
+	$(pwd) "$1" && && export done
+readonly printf cd grep "$@" cd x=1 local 'quoted text' cd printf grep readonly
+	test "$1" export 2>/dev/null $(pwd)
+	${HOME} $(pwd) x=1 grep -eu done test | && 2>/dev/null
+	awk local -eu ${HOME} grep awk 2>/dev/null sed done
+		done "$@" then x=1 -eu awk done
+'quoted text' printf && test echo $(pwd) awk local "$1" "$@" local
+	then readonly printf | && "$@" 'quoted text' "$1" $(pwd)
+	awk awk $(pwd) local -eu x=1 done readonly done then
+	| grep "$1" grep "$1" awk 2>/dev/null printf
+		"$@" then cd sed --verbose 2>/dev/null /usr/bin 'quoted text' && "$1"
+done 2>/dev/null sed -eu export -eu awk test then awk -eu --verbose ${HOME} awk
+	cd awk "$1" local then 2>/dev/null 'quoted text'
+	grep echo local done "$1" 2>/dev/null "$@" | ${HOME} local test sed printf 2>/dev/null
+sed awk /usr/bin $(pwd) echo grep -eu "$@" "$@" grep ${HOME} /usr/bin
+then grep "$@" $(pwd) -eu
+		-eu export awk x=1 x=1 | && 'quoted text' -eu test export ${HOME}
+		test | sed awk "$@" 2>/dev/null done printf /usr/bin /usr/bin export
+	"$1" readonly printf $(pwd) "$1" /usr/bin
+		echo cd export printf "$@" printf then | export local test printf sed
+	"$1" && | export $(pwd) then "$1" /usr/bin --verbose "$@" | done "$@" sed
+	sed | 2>/dev/null /usr/bin then
+		then "$@" printf -eu
+		echo awk echo test test | export -eu done local awk | cd local readonly
+sed export test cd printf
+		/usr/bin printf 2>/dev/null 2>/dev/null --verbose grep
+	--verbose 2>/dev/null export /usr/bin
+		x=1 'quoted text' echo echo 2>/dev/null
+		"$@" | cd grep $(pwd) export
+	sed "$1" $(pwd) echo cd readonly ${HOME}
+	test "$@" then printf 'quoted text'
+	${HOME} x=1 x=1 | done echo grep | test "$@" test readonly
+	export cd then $(pwd) local done x=1 test | export export ${HOME}
+done grep ${HOME} printf "$1" cd && done local ${HOME} ${HOME}
+		| && 2>/dev/null /usr/bin echo && $(pwd) /usr/bin local awk export
+/usr/bin done $(pwd) 'quoted text' readonly printf grep cd
+awk awk awk 2>/dev/null test printf grep ${HOME} x=1
+"$1" ${HOME} x=1 "$@" ${HOME} test
+	readonly cd $(pwd) then cd printf ${HOME} -eu $(pwd) awk local printf
+"$1" && ${HOME} ${HOME} 2>/dev/null --verbose echo
+		'quoted text' "$1" echo awk test "$1"
+-eu grep readonly $(pwd) sed /usr/bin cd
+	sed cd export test $(pwd) /usr/bin -eu sed sed sed
+	printf | x=1 awk export && 2>/dev/null "$1" --verbose
+"$1" readonly printf echo | readonly && echo x=1 && -eu x=1 && 2>/dev/null
+printf test then local 2>/dev/null | test readonly test 2>/dev/null
+		readonly && x=1 -eu local
+test --verbose done readonly
+	"$1" then "$@" | -eu then printf | cd echo sed
+		'quoted text' export /usr/bin test "$@" sed ${HOME} grep
+export cd echo 'quoted text' 2>/dev/null 2>/dev/null "$@"
+		cd printf /usr/bin "$1" $(pwd) local readonly
+		done printf done 'quoted text'
+		'quoted text' sed /usr/bin readonly | grep sed /usr/bin
+		echo echo grep | | 'quoted text' local sed ${HOME} "$1"
+	test done | "$@" 'quoted text'
+	${HOME} awk "$@" "$@" printf readonly sed
+		grep done grep && echo awk x=1 $(pwd)
+/usr/bin ${HOME} $(pwd) 'quoted text' done echo --verbose $(pwd)
+	readonly /usr/bin export ${HOME} printf /usr/bin -eu export
+'quoted text' echo 'quoted text' test echo &&
+		${HOME} 'quoted text' "$@"
+		"$1" "$1" x=1 | cd printf awk "$1" --verbose readonly $(pwd)
+	printf local readonly x=1 -eu && "$@" "$@" test "$1" echo ${HOME}
+		/usr/bin grep 2>/dev/null
+readonly -eu awk "$1" test printf $(pwd) "$1" | -eu --verbose 'quoted text' sed
+	--verbose -eu $(pwd) --verbose "$@" "$@" cd "$@" "$@" 'quoted text'
+	&& export cd then readonly sed "$1" cd local /usr/bin | awk export -eu |
+		awk "$@" 2>/dev/null export printf
+		cd 2>/dev/null cd x=1 | "$1" local 2>/dev/null 'quoted text'
+	sed readonly export readonly export
+	awk $(pwd) --verbose grep 'quoted text'
+-eu done test ${HOME} |
+	done done readonly echo --verbose $(pwd) done echo printf x=1
+	export export ${HOME} x=1 -eu && $(pwd) x=1 printf "$1" -eu "$1"
+	grep grep "$@" cd echo | $(pwd) --verbose
+	grep then && sed -eu done done ${HOME} export local ${HOME} -eu local then
+		-eu then test printf test test then "$@" grep
+	awk "$@" local $(pwd) x=1 /usr/bin
+x=1 'quoted text' then
+		x=1 sed ${HOME} --verbose cd "$@" echo x=1 'quoted text' /usr/bin
+/usr/bin "$1" && test
+	test cd awk printf -eu echo cd 'quoted text' && done $(pwd) done "$1" && readonly
+	$(pwd) printf "$1" readonly
+test -eu && then export | readonly x=1 ${HOME} echo /usr/bin | printf x=1 export
+	cd 'quoted text' readonly
+		$(pwd) $(pwd) awk local --verbose readonly
+	--verbose cd local ${HOME} 2>/dev/null local /usr/bin && export sed && 'quoted text'
+		sed done ${HOME} 'quoted text' &&
+then $(pwd) cd then sed readonly
+printf 2>/dev/null --verbose then sed --verbose x=1 'quoted text'
+		x=1 2>/dev/null x=1 && /usr/bin cd --verbose
+	$(pwd) echo awk -eu 2>/dev/null "$@" | test $(pwd) echo &&
+export test --verbose 'quoted text'
+	awk "$@" echo export 'quoted text' -eu sed done test
+		--verbose /usr/bin | 2>/dev/null local test echo ${HOME} then && sed sed 2>/dev/null
+		'quoted text' /usr/bin readonly readonly
+&& && "$1" readonly export cd "$1" | x=1 done
+$(pwd) readonly ${HOME} 'quoted text' | awk awk && -eu
+cd grep | echo "$1" local
+		/usr/bin cd -eu -eu ${HOME} x=1 "$1" | grep -eu done x=1 awk grep
+		-eu echo awk 2>/dev/null export grep 'quoted text' test echo -eu -eu local
+	printf "$1" done export -eu then | "$@" $(pwd)
+	grep printf local x=1 awk cd /usr/bin
+		'quoted text' $(pwd) cd && -eu $(pwd) &&
+		export 'quoted text' then "$@" awk export local x=1 grep then
+		x=1 | $(pwd) printf | | ${HOME} grep grep test
+"$@" readonly "$@" --verbose -eu | printf ${HOME} readonly
+x=1 x=1 /usr/bin "$@" --verbose export sed local awk cd "$1" 2>/dev/null sed
+	-eu | local /usr/bin 'quoted text' $(pwd) $(pwd) 'quoted text' x=1
+		then | echo 2>/dev/null sed x=1 done | -eu ${HOME} "$@"
+		done printf /usr/bin cd cd cd --verbose "$1" && 'quoted text'
+		cd awk done --verbose x=1 printf done --verbose
+	sed cd ${HOME} sed test x=1 && echo && cd then && x=1 x=1 printf
+		x=1 --verbose test echo
+	readonly then 2>/dev/null echo local "$1" 'quoted text' local
+		grep sed x=1 $(pwd) | ${HOME} readonly printf export echo && cd printf
+	'quoted text' done -eu then "$1" local
+		"$1" test readonly -eu "$1"
+		| --verbose && grep x=1 --verbose readonly "$@" readonly sed $(pwd)
+"$@" -eu export export export echo readonly readonly "$1" -eu sed local
+		export sed $(pwd) "$1" --verbose done | printf printf && sed printf export --verbose
+	$(pwd) "$@" -eu -eu | 2>/dev/null 2>/dev/null x=1 x=1 awk
+	printf $(pwd) /usr/bin | sed done --verbose --verbose /usr/bin /usr/bin
+		local cd --verbose local | grep awk grep 2>/dev/null grep -eu test 'quoted text'
+grep test -eu cd done local "$@" 2>/dev/null
+'quoted text' ${HOME} 2>/dev/null
+		--verbose test "$@" sed ${HOME} done -eu awk | x=1 'quoted text'
+	echo sed $(pwd) && printf printf awk --verbose cd x=1 cd /usr/bin echo "$1"
+		"$1" "$@" echo cd && -eu readonly awk sed $(pwd) printf
+		readonly then export sed "$@" cd printf echo echo "$1" /usr/bin "$1" printf ${HOME}
+	"$@" cd --verbose ${HOME} printf then local echo sed done sed
+--verbose $(pwd) $(pwd) export awk then grep readonly 'quoted text'
+&& -eu awk printf $(pwd) && ${HOME} "$1" 'quoted text' readonly grep
+test && sed cd ${HOME} export --verbose grep grep -eu local test cd echo 2>/dev/null
+cd echo "$1" local -eu x=1 ${HOME} sed then -eu ${HOME} /usr/bin
+		-eu "$@" x=1 awk /usr/bin "$@" sed && echo sed done /usr/bin
+export 2>/dev/null echo test 2>/dev/null "$1" /usr/bin then $(pwd) 2>/dev/null
+"$@" echo grep sed 'quoted text' -eu "$1" $(pwd) 'quoted text'
+	test && --verbose && && done export $(pwd) readonly local "$@"
+| && local 2>/dev/null awk export local x=1 grep printf grep /usr/bin 2>/dev/null
+--verbose test --verbose "$1" $(pwd) /usr/bin echo local echo x=1
+-eu -eu test 'quoted text' 2>/dev/null
+local | $(pwd) grep grep x=1 done "$@" | awk readonly /usr/bin
+		&& | awk test done && test test "$@" done sed $(pwd) test echo awk
+		"$1" awk /usr/bin local && "$@" --verbose --verbose awk 'quoted text' export grep
+	cd && | "$1" ${HOME} sed printf $(pwd)
+		--verbose local 'quoted text'
+		${HOME} cd $(pwd) test grep printf printf
+		$(pwd) /usr/bin --verbose
+	awk export printf --verbose $(pwd) 2>/dev/null
+local test "$@" test done "$1" awk --verbose awk test /usr/bin grep 'quoted text'
+		/usr/bin printf --verbose cd --verbose cd | export test | "$@" local $(pwd)
+--verbose sed readonly cd $(pwd) done 'quoted text'
+"$@" cd "$1" done test then export test x=1 "$1" grep "$@" awk
+done readonly | awk && sed $(pwd) grep x=1 printf | done /usr/bin then
+"$1" readonly && printf printf awk
+		2>/dev/null && then done "$1" awk sed export --verbose cd
+	--verbose export -eu "$1" 2>/dev/null 'quoted text' 'quoted text'
+		'quoted text' printf ${HOME} local "$@" 'quoted text' --verbose
+	&& /usr/bin cd cd local
+	printf echo -eu awk test /usr/bin -eu echo export
+	test sed printf done -eu echo echo readonly awk printf /usr/bin
+export echo && awk awk -eu local "$1" local "$@" "$1" "$@"
+	printf "$1" 'quoted text' grep local grep
+x=1 cd export export $(pwd) | then | export echo
+		grep x=1 done 'quoted text' 'quoted text' "$@" 2>/dev/null | &&
+	test cd grep grep 2>/dev/null cd cd cd then cd grep done printf test -eu 'quoted text'
+	'quoted text' ${HOME} awk sed printf echo readonly
+2>/dev/null ${HOME} && /usr/bin "$@"
+$(pwd) && ${HOME} --verbose ${HOME} echo
+	awk grep "$1" readonly export "$1" 'quoted text' 'quoted text' then /usr/bin
+printf && 'quoted text' grep echo export 2>/dev/null grep grep
+	'quoted text' sed 2>/dev/null 'quoted text' ${HOME} test echo printf
+	awk readonly 'quoted text' export "$1"
+	-eu "$1" -eu then done printf
+"$1" echo $(pwd) $(pwd) done sed then echo sed $(pwd) --verbose
+		$(pwd) "$@" done awk /usr/bin export x=1
+export | echo awk --verbose x=1 /usr/bin echo | -eu -eu cd cd -eu cd "$1" echo
+	export && sed readonly sed sed test then readonly
+		2>/dev/null grep x=1 sed printf 2>/dev/null --verbose $(pwd) 2>/dev/null
+	--verbose done done $(pwd) echo done readonly done done done printf awk --verbose
+printf done done grep done | export "$1" 'quoted text' $(pwd) printf sed
+		then /usr/bin grep local then then export cd -eu x=1 --verbose
+cd local local 2>/dev/null | /usr/bin grep | | sed
+	${HOME} 2>/dev/null echo --verbose -eu cd "$1" test
+local test echo $(pwd) test cd
+then "$@" && "$1" then --verbose awk ${HOME} done /usr/bin /usr/bin
+		${HOME} echo && test "$1"
+2>/dev/null x=1 --verbose && ${HOME} | test ${HOME}
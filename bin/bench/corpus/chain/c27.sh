@@ -0,0 +1,2001 @@
+local --verbose export readonly ${HOME} ${HOME} readonly x=1 $(pwd) grep ${HOME}
+	readonly test 2>/dev/null "$@" sed readonly ${HOME} readonly
+		--verbose printf awk "$@" sed /usr/bin $(pwd) grep grep done x=1 printf ${HOME}
+		/usr/bin export echo 'quoted text'
+		sed 'quoted text' readonly
+	2>/dev/null test 2>/dev/null -eu printf $(pwd) $(pwd) printf 'quoted text'
+	-eu then test done --verbose && && test
+	cd printf export echo | sed readonly 'quoted text'
+		&& local $(pwd) 2>/dev/null
+		/usr/bin readonly readonly | awk export
+-eu ${HOME} x=1 printf 'quoted text' && x=1
+readonly 'quoted text' ${HOME} sed grep
+-eu 'quoted text' $(pwd) then export done then
+	test export && x=1 "$@"
+	done 2>/dev/null grep grep sed -eu --verbose 'quoted text' x=1 test export sed
+	/usr/bin awk grep echo "$1" "$@" local /usr/bin /usr/bin done | $(pwd) 2>/dev/null
+'quoted text' && printf 2>/dev/null 'quoted text' echo --verbose
+		export then x=1 echo --verbose 2>/dev/null done readonly awk && 2>/dev/null
+		test | echo grep x=1 --verbose
+$(pwd) ${HOME} -eu readonly export -eu cd
+| /usr/bin export local --verbose
+${HOME} 'quoted text' --verbose echo $(pwd) x=1 echo "$@" grep $(pwd) done cd "$@"
+		'quoted text' local -eu grep then | --verbose ${HOME} printf readonly
+		printf /usr/bin "$@" $(pwd) local printf local x=1 cd | --verbose printf
+	done x=1 $(pwd) "$@" awk -eu -eu done local | && export
+		export printf then local sed done
+echo grep echo ${HOME} done readonly | /usr/bin --verbose && done ${HOME} awk
+	$(pwd) | "$@" done | && export
+&& test then local readonly x=1 'quoted text' 'quoted text'
+"$1" printf grep ${HOME} "$@" readonly local $(pwd) | "$1" test 2>/dev/null
+		${HOME} printf ${HOME} 2>/dev/null "$1" sed x=1
+$(pwd) then /usr/bin -eu grep "$@" /usr/bin test echo "$1" | 'quoted text' sed
+	-eu export local $(pwd) then | $(pwd) cd cd cd "$1" 'quoted text' x=1 "$@"
+	'quoted text' test --verbose | --verbose --verbose
+		local printf 2>/dev/null $(pwd) 'quoted text' 2>/dev/null local sed
+	sed readonly export 'quoted text' local 2>/dev/null
+	export $(pwd) echo "$@" awk then 'quoted text' /usr/bin then local
+cd awk printf $(pwd) --verbose -eu test /usr/bin cd echo awk 'quoted text'
+'quoted text' awk echo readonly
+test sed printf 2>/dev/null done && local /usr/bin /usr/bin 2>/dev/null
+		-eu sed test awk -eu --verbose $(pwd) ${HOME} x=1 then then
+grep export $(pwd) grep readonly echo ${HOME} ${HOME} 2>/dev/null
+		grep echo awk readonly then $(pwd) | done then echo printf printf
+		/usr/bin echo ${HOME} 'quoted text' readonly /usr/bin x=1 "$@" then
+$(pwd) x=1 printf awk ${HOME} x=1 /usr/bin "$@" 'quoted text'
+	| local sed printf then then grep test awk -eu /usr/bin awk ${HOME} test
+		awk -eu readonly test awk -eu awk grep 2>/dev/null "$@"
+"$1" sed done done cd ${HOME} 2>/dev/null 'quoted text' | x=1 cd ${HOME} /usr/bin
+/usr/bin cd cd done /usr/bin ${HOME} export 2>/dev/null export
+	x=1 | cd -eu -eu x=1 then -eu
+2>/dev/null | 'quoted text' awk done sed printf | "$@" x=1 ${HOME}
+| && /usr/bin sed | "$1"
+&& export cd echo ${HOME} test awk --verbose echo then printf
+'quoted text' local $(pwd) readonly then -eu ${HOME} echo readonly echo 2>/dev/null
+		x=1 /usr/bin local awk test grep ${HOME} 'quoted text' "$1" readonly ${HOME}
+	sed readonly | 'quoted text' cd
+		awk --verbose then echo /usr/bin readonly
+	printf x=1 x=1 awk ${HOME} /usr/bin x=1 "$@"
+	then done echo && "$1" 'quoted text' sed "$@" test grep echo --verbose
+		export x=1 sed "$1" /usr/bin | test awk printf
+	${HOME} then echo "$@" 'quoted text' awk --verbose then echo cd && sed
+		/usr/bin done sed ${HOME} --verbose 'quoted text' grep 'quoted text' "$@"
+x=1 | cd 'quoted text' "$@" export test grep cd ${HOME}
+		local 'quoted text' printf export cd printf awk
+	done sed x=1 grep then then grep test sed "$1"
+printf | awk test $(pwd) awk awk printf --verbose grep grep $(pwd)
+	&& cd "$@" /usr/bin printf | ${HOME}
+	&& 2>/dev/null done printf 2>/dev/null grep then grep
+	2>/dev/null local test sed ${HOME} echo /usr/bin printf
+		echo "$@" cd "$1" done
+	--verbose cd "$@" && echo cd
+	readonly --verbose "$@" ${HOME} 'quoted text'
+	local printf && cd printf /usr/bin done grep grep --verbose awk "$@" -eu echo
+		awk --verbose "$1" then
+printf && /usr/bin printf grep done 2>/dev/null export --verbose -eu done ${HOME}
+		&& ${HOME} echo | $(pwd) printf echo
+	$(pwd) 2>/dev/null test && test grep -eu "$@" sed ${HOME} "$1"
+readonly 'quoted text' grep --verbose 'quoted text' readonly export readonly
+local export x=1 ${HOME} && x=1 2>/dev/null "$1" sed ${HOME}
+	&& 2>/dev/null grep test readonly
+	$(pwd) $(pwd) --verbose | done test test echo /usr/bin ${HOME} then "$1"
+echo grep && cd local printf local test printf $(pwd) /usr/bin "$@" "$1"
+		grep echo sed /usr/bin echo local done "$1" then && then
+	| | cd then cd done sed local --verbose
+"$1" awk $(pwd) readonly then 'quoted text' -eu "$@" x=1 'quoted text'
+export grep grep ${HOME} sed cd --verbose sed ${HOME}
+	readonly 'quoted text' export echo readonly /usr/bin test && done 2>/dev/null
+test echo -eu | export /usr/bin 'quoted text' | echo grep ${HOME}
+		done -eu done 'quoted text' && $(pwd) sed then ${HOME}
+	local sed then local -eu --verbose
+	test local printf test readonly | local && | cd x=1 2>/dev/null local "$@" ${HOME}
+printf | /usr/bin 'quoted text' $(pwd) ${HOME} "$1"
+	"$@" x=1 export done echo printf x=1 sed printf --verbose test done awk --verbose
+	"$1" $(pwd) test x=1 | echo --verbose 'quoted text' "$1" /usr/bin
+echo awk "$@" sed sed 'quoted text' test x=1 local sed then "$@" | then test
+	&& local cd cd readonly $(pwd) readonly 2>/dev/null $(pwd) 'quoted text'
+| readonly && "$1" awk 2>/dev/null cd awk local sed --verbose export local
+		then printf ${HOME} /usr/bin awk --verbose
+		echo cd awk && ${HOME} 'quoted text' x=1 test ${HOME} "$@" $(pwd)
+"$1" --verbose local ${HOME}
+	2>/dev/null done 'quoted text' 2>/dev/null export local x=1 cd
+		printf 'quoted text' && then "$1" $(pwd) export done | grep readonly $(pwd) cd
+cd 'quoted text' 'quoted text' test "$1" "$1" cd | -eu
+test 2>/dev/null -eu echo | -eu x=1 then readonly then ${HOME} --verbose echo 2>/dev/null
+	echo 'quoted text' export local
+		"$1" echo /usr/bin && "$@" awk sed printf x=1 local --verbose 'quoted text'
+	/usr/bin && printf test 'quoted text'
+2>/dev/null ${HOME} echo ${HOME} "$@" /usr/bin sed cd test "$1" local readonly
+		then "$@" readonly export grep grep --verbose | readonly echo 2>/dev/null
+	/usr/bin $(pwd) grep $(pwd) --verbose -eu printf 2>/dev/null then awk then
+${HOME} && awk --verbose local
+		| --verbose then done test && | readonly test grep local x=1 then && |
+		test 2>/dev/null 2>/dev/null then --verbose "$1" printf cd x=1 test then
+	then ${HOME} --verbose printf "$@" --verbose x=1 grep $(pwd) -eu --verbose
+	local "$@" local cd readonly readonly
+		&& && test then 'quoted text' 'quoted text'
+		2>/dev/null test test readonly done
+local cd then 'quoted text'
+&& | grep awk $(pwd) $(pwd) then
+	/usr/bin printf then && sed --verbose grep -eu then
+	done sed echo done printf "$1" --verbose
+		2>/dev/null test test export "$@" cd printf
+	${HOME} test local then
+	echo --verbose --verbose then local ${HOME} 'quoted text'
+		&& "$@" done "$@" test local -eu --verbose
+	x=1 "$1" awk export export
+| awk done done -eu "$1" sed local grep grep
+		"$@" cd then | grep --verbose test printf "$@" x=1 grep
+		awk readonly done echo x=1 -eu "$1" "$@" /usr/bin "$@" --verbose $(pwd) 2>/dev/null
+"$@" x=1 && --verbose done 'quoted text' "$1" |
+	export export "$@" done x=1 &&
+		-eu x=1 && -eu sed ${HOME} readonly 2>/dev/null
+x=1 | readonly 'quoted text' ${HOME} -eu
+sed --verbose "$@" ${HOME} done then awk sed local --verbose
+	printf printf | && sed awk sed x=1
+	/usr/bin /usr/bin export test && cd sed cd then x=1 $(pwd) sed echo
+x=1 'quoted text' sed /usr/bin "$@" | $(pwd) "$@" cd export test cd
+		$(pwd) ${HOME} then readonly 'quoted text' && --verbose &&
+		2>/dev/null printf local ${HOME} x=1 "$1" 'quoted text' /usr/bin printf
+| printf then -eu done test readonly awk echo 'quoted text' -eu export
+	test "$1" readonly local cd local 'quoted text' ${HOME} echo awk local --verbose
+		2>/dev/null then && then echo awk echo printf printf
+echo 'quoted text' local --verbose x=1 |
+	'quoted text' export | export printf local readonly "$@" local | 2>/dev/null
+/usr/bin /usr/bin --verbose export cd local ${HOME} export
+	"$1" export done sed cd $(pwd) | sed | -eu export
+	-eu test then /usr/bin && -eu grep test echo --verbose readonly -eu test ${HOME}
+		then sed export | 'quoted text' && "$1"
+		sed printf -eu | 'quoted text' printf
+	export --verbose export printf grep awk && grep -eu export sed printf --verbose
+		&& && sed echo test done printf -eu awk "$1" readonly ${HOME} test
+"$1" grep -eu | /usr/bin sed "$@" $(pwd) 'quoted text'
+2>/dev/null local export export test && sed
+	"$@" /usr/bin 'quoted text' echo
+	--verbose done --verbose local local
+		echo --verbose grep "$@" --verbose "$@" && && grep --verbose awk $(pwd) | sed
+		sed "$@" grep ${HOME} "$@" local printf done printf
+x=1 x=1 sed local 2>/dev/null -eu awk && echo && "$@" printf export
+	| readonly then readonly --verbose
+		&& done cd 2>/dev/null test printf
+		&& ${HOME} x=1 "$1" then done "$@" test 2>/dev/null export echo export
+	${HOME} 2>/dev/null export --verbose
+		test cd readonly -eu 'quoted text' sed "$@" readonly
+		--verbose awk --verbose x=1 2>/dev/null
+		$(pwd) /usr/bin then "$1" "$@"
+		/usr/bin -eu echo test echo awk
+then sed "$@" then printf ${HOME} echo test cd printf done done export
+sed sed cd | export 'quoted text'
+	-eu "$1" 'quoted text' done
+readonly -eu sed printf $(pwd) "$1" cd | | echo export "$@" 'quoted text' sed
+		${HOME} sed grep 'quoted text' grep "$1" cd $(pwd)
+		"$@" echo grep grep -eu echo sed "$1" test $(pwd) echo /usr/bin
+	readonly test export echo readonly -eu 'quoted text' "$@"
+	sed -eu $(pwd) echo "$1" $(pwd)
+		-eu "$1" echo sed test done 2>/dev/null local awk
+		grep grep --verbose export -eu
+	-eu grep x=1 sed && grep done | then local echo $(pwd) readonly ${HOME} sed printf
+		printf done then 2>/dev/null echo done local 'quoted text' -eu ${HOME} grep
+	readonly /usr/bin x=1 grep
+		awk printf && awk export | 2>/dev/null -eu
+	| 2>/dev/null 2>/dev/null 2>/dev/null x=1 test
+	$(pwd) sed sed grep test 2>/dev/null sed test /usr/bin export 'quoted text'
+		readonly printf "$1" /usr/bin ${HOME} local
+	local 'quoted text' awk export 2>/dev/null
+	awk x=1 | printf -eu "$1" 2>/dev/null sed done readonly grep sed
+cd x=1 export x=1 awk | echo $(pwd) done
+	&& x=1 local "$@" $(pwd) test x=1 $(pwd)
+	/usr/bin "$1" x=1 --verbose local $(pwd)
+${HOME} done readonly echo -eu 2>/dev/null
+		"$@" done local | 2>/dev/null readonly x=1 then echo
+	sed x=1 | 'quoted text' "$@" readonly --verbose printf
+		${HOME} export sed then x=1 -eu && -eu
+		export echo | x=1 -eu $(pwd) readonly local printf
+		test && echo && -eu test -eu test && cd 2>/dev/null 'quoted text'
+x=1 echo -eu --verbose 'quoted text' cd then grep awk cd done readonly
+		--verbose 2>/dev/null /usr/bin x=1
+		/usr/bin 2>/dev/null then $(pwd) ${HOME} cd 'quoted text' ${HOME} "$1"
+	export test | --verbose awk "$1" awk 'quoted text' cd
+"$@" 'quoted text' local "$1"
+echo "$1" x=1 $(pwd) grep 2>/dev/null 2>/dev/null export $(pwd)
+| printf 2>/dev/null awk /usr/bin "$1" && "$@" | echo echo local cd
+		grep readonly 'quoted text' then && local
+	$(pwd) printf printf --verbose 'quoted text' "$1" --verbose
+		local x=1 $(pwd) | "$@" cd --verbose $(pwd) ${HOME}
+	test readonly test then cd
+		readonly readonly "$1" | "$1" grep
+		local x=1 ${HOME} x=1 "$1" x=1 test echo && ${HOME} echo | sed -eu echo x=1
+	awk then --verbose printf 2>/dev/null 2>/dev/null
+		echo then 'quoted text' awk readonly /usr/bin x=1 awk | local ${HOME} | x=1
+	export echo -eu awk test test echo test | ${HOME}
+		'quoted text' x=1 printf 2>/dev/null sed readonly
+		export printf /usr/bin
+echo then then test echo x=1 export /usr/bin && echo cd ${HOME}
+		awk 2>/dev/null echo $(pwd) "$1" 2>/dev/null export printf --verbose
+		${HOME} grep ${HOME} local "$@" then
+		local printf ${HOME} export /usr/bin 2>/dev/null
+readonly then 'quoted text' ${HOME}
+		export 'quoted text'
+printf 2>/dev/null | local echo done awk sed | 2>/dev/null "$1" sed 'quoted text'
+2>/dev/null export -eu sed export export --verbose cd readonly awk 2>/dev/null -eu
+	${HOME} readonly ${HOME} echo cd "$@" sed "$@" ${HOME} done grep echo -eu
+/usr/bin echo && local awk sed
+-eu local test --verbose
+	grep 'quoted text' x=1 cd
+	| 'quoted text' 'quoted text' x=1 test readonly
+grep ${HOME} echo echo x=1 /usr/bin printf $(pwd)
+		export then $(pwd) --verbose cd $(pwd) &&
+local readonly cd "$@" x=1 ${HOME} "$@" readonly done printf --verbose $(pwd) readonly
+		printf 2>/dev/null echo 'quoted text'
+	printf --verbose "$1" x=1 && "$@" export sed
+		export echo && 2>/dev/null /usr/bin
+awk then sed $(pwd) 2>/dev/null "$@" readonly echo $(pwd) then
+$(pwd) echo ${HOME} readonly echo && awk then cd test -eu sed grep -eu
+-eu sed test -eu awk done then awk
+	"$1" --verbose awk && echo 'quoted text' "$@" done 2>/dev/null
+	| cd 'quoted text' printf local export export echo -eu "$@" "$1" test
+	/usr/bin x=1 export cd "$1"
+$(pwd) grep cd /usr/bin test x=1 done /usr/bin done && local sed --verbose
+	"$1" "$1" local done --verbose
+		printf $(pwd) && "$@" cd printf sed done local grep ${HOME}
+done x=1 --verbose && readonly
+		${HOME} done && --verbose "$@" | x=1 /usr/bin then --verbose "$1"
+readonly && 'quoted text' awk then && readonly done /usr/bin /usr/bin
+	export readonly $(pwd) "$@" cd then
+export /usr/bin test export then awk then local printf
+test done "$@" 'quoted text' 2>/dev/null "$@" ${HOME} $(pwd)
+		printf done 2>/dev/null "$@" 'quoted text' 2>/dev/null sed printf grep
+	then /usr/bin "$@" x=1 | 'quoted text' echo
+		x=1 && $(pwd) test "$1" /usr/bin test awk grep
+grep | $(pwd) 2>/dev/null sed cd "$1" 'quoted text' cd "$@" x=1
+grep "$1" local 2>/dev/null --verbose /usr/bin
+export done then export /usr/bin
+		--verbose then printf then export $(pwd)
+	2>/dev/null then x=1 2>/dev/null cd x=1 done then printf
+local | && readonly -eu printf
+		awk "$@" test --verbose "$1"
+	$(pwd) awk test echo ${HOME}
+&& "$1" done ${HOME} done then printf $(pwd) x=1 printf
+	cd "$1" done printf readonly $(pwd) $(pwd) | grep && && export
+readonly "$@" "$@" "$1" "$@"
+	--verbose printf printf $(pwd) && x=1 'quoted text' printf | --verbose --verbose
+	sed 'quoted text' local 2>/dev/null done local 2>/dev/null
+		$(pwd) ${HOME} --verbose sed
+| | readonly readonly x=1 $(pwd) $(pwd) 2>/dev/null -eu ${HOME}
+		--verbose sed x=1 ${HOME} local awk export
+cd ${HOME} cd | ${HOME} 2>/dev/null 'quoted text' cd done /usr/bin
+	${HOME} echo "$@" local "$1" ${HOME} "$@"
+	readonly local /usr/bin ${HOME}
+		x=1 ${HOME} export then
+		| local -eu | test "$@" -eu $(pwd) printf sed --verbose
+	&& 'quoted text' -eu 'quoted text' "$1" echo local
+		&& grep x=1 then local -eu "$1" ${HOME} 'quoted text' test local
+"$1" 'quoted text' ${HOME} echo printf test
+		grep "$1" 'quoted text' done 'quoted text' x=1 --verbose | ${HOME}
+		test then printf "$@" ${HOME} x=1 sed awk local
+		export "$@" local ${HOME}
+'quoted text' /usr/bin printf -eu readonly local readonly 'quoted text'
+		export $(pwd) ${HOME} $(pwd) readonly local -eu 2>/dev/null /usr/bin readonly
+	&& sed then "$@" -eu export "$1" --verbose grep -eu printf
+		printf readonly 'quoted text' local done
+	local sed export sed && | /usr/bin
+		awk export awk printf awk $(pwd) grep printf $(pwd) local
+	| $(pwd) 2>/dev/null local | grep $(pwd) --verbose
+	local export awk && ${HOME} | $(pwd) "$@" awk
+export x=1 sed grep export export awk | -eu cd && ${HOME} 2>/dev/null then
+		-eu x=1 --verbose awk sed | readonly "$@" --verbose sed export "$1" cd --verbose
+		export sed 2>/dev/null /usr/bin | | done
+	sed awk ${HOME} | sed x=1
+		--verbose $(pwd) done then "$@" test && ${HOME} "$1" ${HOME}
+	'quoted text' test echo 'quoted text' -eu
+/usr/bin test "$@" -eu $(pwd) cd x=1 awk "$@" 2>/dev/null
+		test done 2>/dev/null /usr/bin x=1 --verbose local ${HOME}
+		"$@" printf | && 2>/dev/null sed readonly readonly ${HOME} export
+sed x=1 2>/dev/null $(pwd) ${HOME} $(pwd) test readonly then -eu grep 2>/dev/null
+readonly 'quoted text' then /usr/bin readonly grep --verbose cd
+cd printf 'quoted text' "$@" echo $(pwd)
+	sed test sed 2>/dev/null 'quoted text' readonly --verbose then
+then $(pwd) /usr/bin sed sed ${HOME}
+	cd awk test sed done awk cd "$@" 2>/dev/null
+		x=1 ${HOME} -eu then test 'quoted text'
+		${HOME} ${HOME} grep 'quoted text' echo export 'quoted text'
+	/usr/bin 2>/dev/null ${HOME}
+	echo --verbose 'quoted text'
+		-eu -eu | cd test "$@" x=1 "$@"
+--verbose export then readonly
+		echo x=1 local -eu && "$@" -eu /usr/bin
+	'quoted text' printf /usr/bin -eu ${HOME} "$1" "$@" 2>/dev/null "$1"
+		test echo readonly -eu grep done done test
+	test grep 'quoted text' "$1" 2>/dev/null | sed grep printf
+export "$1" echo "$1" done printf grep done grep
+sed "$@" printf ${HOME} test grep local
+	then 'quoted text' x=1 ${HOME}
+	"$@" -eu local "$1" cd printf awk echo sed readonly
+2>/dev/null echo local sed "$@" | && -eu printf /usr/bin
+local sed local && printf grep cd "$1" 2>/dev/null grep
+		"$1" printf printf echo printf grep then /usr/bin $(pwd)
+		/usr/bin cd awk "$@" grep && x=1 awk && test /usr/bin 2>/dev/null "$@" sed
+		'quoted text' && /usr/bin echo export ${HOME} printf x=1 /usr/bin
+	'quoted text' cd /usr/bin grep echo $(pwd) sed && done -eu
+"$1" awk test 'quoted text' local --verbose $(pwd) "$@"
+printf && printf "$@" "$1" cd "$1" $(pwd)
+then grep && --verbose x=1 ${HOME} x=1 && echo 2>/dev/null done | &&
+"$@" && x=1 ${HOME} done local test "$1" | ${HOME} printf x=1
+	done && "$1" grep && echo test | && sed echo grep "$@"
+		${HOME} x=1 cd cd --verbose ${HOME} grep sed local
+		x=1 "$@" sed awk -eu "$@" awk awk sed test 2>/dev/null export $(pwd) && "$1" echo
+		sed grep done && -eu --verbose ${HOME} grep "$@" done 'quoted text'
+	$(pwd) printf export then export echo && awk local
+x=1 "$1" awk "$@" --verbose
+x=1 grep readonly awk 2>/dev/null sed then $(pwd) done &&
+printf /usr/bin test && --verbose sed export
+	| echo | test "$@" "$1" then $(pwd) && sed then $(pwd) && -eu
+test cd "$1" local ${HOME} /usr/bin 2>/dev/null --verbose --verbose
+readonly done --verbose "$@"
+		2>/dev/null grep ${HOME} $(pwd) readonly done export
+		cd ${HOME} done echo readonly 'quoted text' cd x=1 cd && && -eu
+	x=1 && readonly readonly $(pwd) $(pwd) export ${HOME}
+export printf grep local echo "$@"
+		"$1" printf $(pwd) local /usr/bin -eu cd "$@" grep /usr/bin export done "$1" |
+--verbose then | "$@" x=1 | readonly 2>/dev/null done /usr/bin $(pwd) printf
+		| readonly 2>/dev/null
+	cd echo printf cd test readonly
+	done readonly export | awk --verbose "$@" -eu
+		x=1 readonly | export "$1" /usr/bin $(pwd)
+x=1 --verbose sed printf && x=1 $(pwd) readonly test cd | test
+printf readonly local
+	test export x=1 $(pwd) -eu test
+readonly export test --verbose test then grep sed grep readonly test && 'quoted text'
+	then cd cd x=1 "$1" | 2>/dev/null $(pwd) local test
+	done test /usr/bin local && --verbose
+	| then printf echo x=1 local "$1" -eu $(pwd) grep cd printf 2>/dev/null
+then then grep --verbose ${HOME} awk 'quoted text' $(pwd) then printf
+local && x=1 awk done printf cd --verbose /usr/bin printf "$@"
+		"$@" /usr/bin "$1" --verbose --verbose $(pwd)
+	done 'quoted text' ${HOME} $(pwd) awk sed done "$@" test 2>/dev/null awk
+	awk then export | | cd && "$@" "$1" done then export done echo sed
+	sed && /usr/bin -eu 'quoted text' awk && export 'quoted text' 'quoted text'
+	'quoted text' "$1" done | "$1"
+'quoted text' cd 'quoted text' --verbose
+		then readonly $(pwd) 2>/dev/null
+| "$1" ${HOME} cd cd 'quoted text'
+--verbose 'quoted text' $(pwd) local test then ${HOME} local && printf
+		cd -eu /usr/bin "$1" printf cd
+	"$@" printf && echo -eu "$1" printf export sed 2>/dev/null then /usr/bin printf
+	-eu then export x=1 printf && --verbose export "$@"
+	"$1" | $(pwd) | local && cd 'quoted text' x=1 test then cd -eu
+	${HOME} | "$@" ${HOME} done cd $(pwd) local && | 'quoted text' grep /usr/bin
+--verbose awk test awk ${HOME} awk cd
+awk $(pwd) export "$1" cd local sed && && done test --verbose cd 2>/dev/null
+		"$1" test done "$1" awk sed printf $(pwd) -eu local "$1" done sed sed --verbose
+	sed echo /usr/bin cd echo readonly && echo grep ${HOME} /usr/bin --verbose | 'quoted text'
+	"$@" | && cd 'quoted text'
+		grep then awk "$1" done awk x=1 echo local done awk readonly ${HOME} -eu
+	x=1 then ${HOME} readonly done awk /usr/bin echo
+	/usr/bin 'quoted text' --verbose
+		test 'quoted text' awk $(pwd) --verbose --verbose
+		2>/dev/null local awk cd done grep "$@" $(pwd) && echo "$@" 2>/dev/null printf
+$(pwd) "$1" 2>/dev/null awk
+		echo $(pwd) echo test x=1 printf |
+	$(pwd) --verbose ${HOME} /usr/bin printf readonly done local test
+		then | printf readonly echo "$1" printf then
+x=1 "$@" 'quoted text' done readonly printf awk awk x=1 "$1" local
+	then "$@" "$@" done | awk /usr/bin done -eu 'quoted text' "$1" | /usr/bin
+		| grep local x=1 /usr/bin printf
+	local x=1 cd -eu && printf | "$1" x=1 x=1 --verbose sed
+cd local done cd then -eu --verbose awk 2>/dev/null test
+"$1" $(pwd) -eu x=1 x=1 export 'quoted text' "$@" done sed sed 'quoted text'
+${HOME} readonly /usr/bin readonly
+	done test x=1 cd $(pwd) printf test then cd "$1" readonly
+	awk printf done readonly
+	cd then then local -eu
+		awk "$1" readonly /usr/bin "$1" && /usr/bin 'quoted text' /usr/bin "$@"
+${HOME} readonly then $(pwd) "$1" ${HOME}
+$(pwd) grep then $(pwd) then $(pwd)
+	'quoted text' -eu sed x=1 local awk awk 'quoted text' $(pwd)
+awk cd then printf "$1" export 'quoted text'
+		echo 2>/dev/null export $(pwd) then 2>/dev/null /usr/bin local cd
+		-eu --verbose && done test ${HOME}
+"$1" echo done awk 'quoted text' sed test 2>/dev/null 2>/dev/null
+	test grep ${HOME} -eu export readonly 'quoted text' export
+		&& && --verbose test printf
+'quoted text' "$1" then 'quoted text' ${HOME}
+		grep && "$@" | test "$1"
+	test cd test -eu ${HOME} sed
+		-eu sed ${HOME} done awk --verbose 2>/dev/null awk && test -eu 'quoted text'
+"$1" 2>/dev/null 2>/dev/null
+		awk --verbose | cd grep readonly $(pwd) "$@"
+	cd printf test test ${HOME} done awk "$1" 'quoted text'
+		then done grep $(pwd) --verbose printf "$1" awk 'quoted text'
+	grep 'quoted text' readonly "$1" cd && export
+	sed /usr/bin x=1 readonly ${HOME} "$1" && awk
+	| test ${HOME} ${HOME} /usr/bin echo
+grep /usr/bin export printf $(pwd) printf
+$(pwd) printf echo test then test export | grep then
+		done done 'quoted text' --verbose export $(pwd) "$1" test "$@" /usr/bin
+grep local printf printf readonly grep -eu cd printf
+	printf && then 2>/dev/null test awk --verbose
+--verbose done | ${HOME} --verbose test $(pwd) | printf
+	done ${HOME} x=1 2>/dev/null
+		local "$1" cd "$@" test grep | && $(pwd) && -eu readonly printf
+	&& export 'quoted text' "$@" --verbose local && "$1" 2>/dev/null
+${HOME} /usr/bin | ${HOME} "$1" local ${HOME}
+		then --verbose then $(pwd) x=1 "$1"
+	readonly printf --verbose --verbose
+		readonly sed done awk export "$@" ${HOME} test && echo | "$1" sed grep ${HOME}
+readonly "$@" local "$@" && && sed && sed grep awk x=1 && cd grep readonly
+		echo "$1" $(pwd) $(pwd) /usr/bin cd cd awk | sed /usr/bin "$1" cd readonly -eu
+		2>/dev/null readonly export sed ${HOME}
+		sed 2>/dev/null test local cd x=1 local echo "$1" x=1 && readonly ${HOME}
+	export x=1 test readonly grep then
+/usr/bin --verbose "$@" $(pwd) awk --verbose
+	$(pwd) --verbose -eu && "$@" "$1"
+		x=1 --verbose --verbose sed | && 2>/dev/null echo
+	echo awk && sed --verbose local --verbose local /usr/bin "$@" $(pwd)
+local && --verbose "$1" test cd local && 'quoted text'
+	/usr/bin -eu awk readonly 2>/dev/null sed
+	"$@" --verbose then && export echo
+printf "$1" printf sed done awk cd x=1 grep awk "$@" done "$1" grep 2>/dev/null
+	"$@" printf sed 2>/dev/null |
+$(pwd) test cd --verbose then cd test && done "$@" && test
+		-eu --verbose sed printf 'quoted text' -eu
+then test "$1" sed cd printf
+		done done export && -eu readonly readonly --verbose /usr/bin
+	2>/dev/null echo "$@" then done readonly then grep readonly cd && 2>/dev/null
+		&& ${HOME} 2>/dev/null && awk grep export printf readonly /usr/bin x=1 local
+		then echo 2>/dev/null $(pwd) $(pwd) test done
+'quoted text' 'quoted text' then /usr/bin local awk
+	printf && "$@" -eu && test "$@" echo then && sed ${HOME} "$1" then grep
+	"$@" local cd -eu test cd printf local | -eu
+		${HOME} -eu test x=1 --verbose /usr/bin /usr/bin
+test 'quoted text' done -eu printf "$1" 2>/dev/null readonly export 'quoted text'
+echo ${HOME} && 'quoted text' done $(pwd) done test done
+	| then /usr/bin $(pwd) grep $(pwd) then ${HOME} export x=1
+		awk "$1" "$@" then then "$@" export ${HOME} done readonly printf printf 2>/dev/null
+	test "$1" echo | 'quoted text' cd done "$1" "$1" local "$1" $(pwd) echo 'quoted text'
+		2>/dev/null awk readonly -eu 2>/dev/null "$@" ${HOME} test
+done local x=1 then local $(pwd) readonly &&
+&& $(pwd) --verbose | local $(pwd) export printf 2>/dev/null
+export export sed printf 'quoted text' then
+		--verbose ${HOME} readonly echo readonly
+--verbose awk && 'quoted text' 2>/dev/null /usr/bin 'quoted text'
+$(pwd) 2>/dev/null --verbose sed
+	x=1 test sed readonly "$@" local /usr/bin sed awk then done echo
+	export --verbose test "$1" x=1 'quoted text'
+'quoted text' sed --verbose cd x=1 echo cd printf x=1 export 2>/dev/null export
+		echo then printf 'quoted text' -eu 2>/dev/null
+		local "$1" | $(pwd) | --verbose local ${HOME} 2>/dev/null grep
+"$@" readonly 2>/dev/null awk local --verbose local cd | awk && -eu done
+	readonly --verbose $(pwd)
+done 'quoted text' then echo -eu x=1 test $(pwd) sed then then && local $(pwd)
+&& export ${HOME} then && sed 'quoted text' cd readonly
+		/usr/bin $(pwd) -eu export echo grep done --verbose
+		awk local test /usr/bin
+export awk local printf 2>/dev/null x=1
+		echo $(pwd) echo 'quoted text' /usr/bin then readonly 'quoted text'
+		2>/dev/null echo done && | then $(pwd) then
+	grep done then /usr/bin then "$@" ${HOME} 'quoted text' readonly
+	cd | -eu export | echo x=1 x=1 'quoted text'
+2>/dev/null echo awk $(pwd) cd 2>/dev/null
+	${HOME} readonly sed local $(pwd) 2>/dev/null
+"$1" "$@" | "$1" sed then x=1 && sed test
+		sed /usr/bin local grep test /usr/bin readonly
+	awk readonly test done then
+		local 2>/dev/null 2>/dev/null
+/usr/bin readonly awk cd export then then "$@" ${HOME} export sed then 'quoted text'
+	local sed test grep printf local printf "$@" &&
+cd x=1 echo && | "$1" "$1" cd --verbose grep --verbose
+	$(pwd) "$@" "$1" $(pwd) awk then printf
+"$@" 'quoted text' "$@" --verbose "$@" printf echo local
+--verbose awk readonly sed awk then
+| ${HOME} then export /usr/bin "$@" "$@"
+	sed /usr/bin && then "$@" /usr/bin then test awk echo echo && |
+| awk done "$1" -eu --verbose
+	$(pwd) local printf 2>/dev/null
+		"$@" readonly 'quoted text' local
+		$(pwd) 2>/dev/null /usr/bin -eu
+		x=1 awk x=1 cd x=1 /usr/bin grep "$1" $(pwd) && 2>/dev/null done
+	| grep export "$1" then sed "$1" "$@" printf echo
+		awk /usr/bin && 'quoted text' 'quoted text'
+readonly | "$@" export -eu
+	"$1" awk "$@" "$1" awk grep ${HOME}
+	2>/dev/null "$@" sed | x=1 local test 'quoted text' done x=1
+'quoted text' test "$1" -eu grep 2>/dev/null x=1 | echo sed local
+		export readonly done 2>/dev/null echo /usr/bin
+| echo && "$@" test $(pwd) "$@" grep test $(pwd) "$1"
+		"$1" 2>/dev/null done /usr/bin "$@"
+		test 2>/dev/null | --verbose sed
+"$1" && --verbose --verbose
+	| cd -eu local ${HOME} readonly 'quoted text'
+	grep awk then && "$@" grep export | --verbose 2>/dev/null 2>/dev/null
+	printf $(pwd) "$@" "$1" ${HOME} printf sed 'quoted text'
+printf 'quoted text' then "$1" && ${HOME}
+test echo readonly export 2>/dev/null test
+echo sed test $(pwd) then then /usr/bin && "$1"
+--verbose 'quoted text' && | 2>/dev/null printf -eu echo then echo $(pwd) "$1"
+	printf local && cd 2>/dev/null 2>/dev/null
+	grep export echo grep printf
+		x=1 grep sed export awk readonly export export /usr/bin -eu
+	echo sed --verbose "$@" done readonly -eu then /usr/bin
+"$@" export && x=1 /usr/bin x=1 -eu printf grep
+	export readonly x=1 done local sed test then grep readonly
+		cd --verbose awk done | $(pwd)
+		${HOME} $(pwd) cd grep -eu "$@" grep echo x=1 $(pwd)
+cd "$1" done "$1" then sed printf cd 2>/dev/null -eu cd -eu done "$1" ${HOME} $(pwd)
+		-eu export then $(pwd) done sed /usr/bin sed -eu printf export
+		readonly -eu $(pwd) printf ${HOME} "$@" 'quoted text' && /usr/bin
+grep ${HOME} local cd "$1" readonly done printf 'quoted text'
+export test done | done "$1" "$1" test && x=1 --verbose /usr/bin
+test awk x=1 then test awk "$1" /usr/bin 2>/dev/null ${HOME} -eu done ${HOME}
+grep && cd grep sed $(pwd) local && then "$1" ${HOME} $(pwd) $(pwd) cd 2>/dev/null
+sed | export printf "$1" awk test sed "$@" /usr/bin 'quoted text'
+	"$@" && grep export cd test x=1 $(pwd) /usr/bin 2>/dev/null
+	2>/dev/null sed then readonly
+"$1" x=1 local x=1 | | local x=1 "$1" /usr/bin "$1" grep --verbose
+${HOME} && sed 'quoted text' 'quoted text' export grep then
+		then $(pwd) readonly printf && done x=1 /usr/bin grep $(pwd) awk 'quoted text'
+$(pwd) readonly | $(pwd) sed &&
+	sed done "$@" --verbose ${HOME} sed test 'quoted text'
+"$@" printf printf local grep export readonly
+	&& | -eu awk awk x=1 test --verbose readonly 2>/dev/null
+done ${HOME} grep then ${HOME} awk ${HOME} echo sed
+	-eu --verbose grep grep awk sed | --verbose sed sed "$1" 'quoted text' "$@"
+	'quoted text' readonly x=1 export -eu "$1" && -eu /usr/bin readonly then
+	local grep grep grep "$1" "$1"
+-eu export $(pwd) $(pwd) done 2>/dev/null cd printf awk --verbose local
+	/usr/bin test 2>/dev/null -eu 2>/dev/null
+		done -eu echo export "$1" echo sed -eu readonly
+--verbose /usr/bin printf awk /usr/bin $(pwd) echo echo -eu done --verbose
+	done && sed "$1" then awk 'quoted text' cd done sed echo && 2>/dev/null local &&
+sed printf && local grep awk test awk /usr/bin
+printf ${HOME} local then x=1 cd -eu printf cd | x=1 --verbose
+		2>/dev/null local awk ${HOME} -eu export "$1" -eu echo sed local && sed
+test /usr/bin x=1 'quoted text' && | echo export sed x=1 x=1 export echo 'quoted text'
+	"$@" 2>/dev/null sed cd "$@" "$1"
+	-eu then /usr/bin "$1" --verbose
+--verbose 'quoted text' done && "$@" && $(pwd) test $(pwd)
+		-eu --verbose "$1" "$@" export echo ${HOME} then export --verbose awk
+"$@" grep awk /usr/bin done local
+readonly && local done 2>/dev/null "$@" "$1" 'quoted text'
+		${HOME} printf then --verbose "$@" export /usr/bin test grep export
+		test /usr/bin test export cd -eu then local
+		test 'quoted text' -eu cd "$@" $(pwd) ${HOME} test printf test ${HOME} 2>/dev/null
+		awk /usr/bin 'quoted text' 'quoted text' cd "$1" -eu 'quoted text' |
+	awk ${HOME} 'quoted text' $(pwd) /usr/bin "$@" export -eu local --verbose
+grep && && 'quoted text' cd
+echo test awk readonly cd x=1 then
+		test done then echo "$1" local ${HOME} cd "$@" 2>/dev/null
+	-eu echo | "$1" --verbose x=1 | x=1 && "$@" x=1 then grep then "$@"
+	2>/dev/null readonly x=1 -eu echo cd 2>/dev/null ${HOME}
+		test -eu done x=1 /usr/bin $(pwd) cd
+'quoted text' printf && local | cd
+	done ${HOME} "$1" ${HOME} done && -eu /usr/bin /usr/bin
+	| echo sed local local then
+"$1" test then sed done readonly --verbose /usr/bin awk ${HOME} "$@" grep x=1
+then /usr/bin -eu then readonly 2>/dev/null 2>/dev/null then
+	"$1" "$@" echo "$@" then printf echo 'quoted text' awk echo && && local -eu awk
+		awk echo $(pwd) "$@" awk test echo && cd /usr/bin sed
+	&& "$@" && x=1 x=1 export
+		echo ${HOME} | readonly test grep local
+grep "$@" x=1 test sed printf test 'quoted text' echo /usr/bin
+		'quoted text' sed export 'quoted text' awk | done -eu echo test && printf done
+	test x=1 awk export $(pwd) --verbose $(pwd) ${HOME} $(pwd) "$@"
+-eu test && --verbose && -eu | printf then grep "$@" echo local /usr/bin printf
+		-eu $(pwd) /usr/bin "$@" export echo cd test "$1" readonly ${HOME} test /usr/bin
+		| $(pwd) "$@" awk test "$@" "$1" | printf readonly ${HOME} grep /usr/bin
+	"$1" "$@" "$1" $(pwd) -eu
+		printf "$1" $(pwd) "$1" sed awk readonly readonly x=1 sed echo printf grep awk
+		--verbose -eu done /usr/bin printf test grep grep --verbose ${HOME} 2>/dev/null
+	'quoted text' "$@" "$1" && grep readonly | --verbose
+		&& "$1" $(pwd) local $(pwd) --verbose -eu | 2>/dev/null printf
+printf 2>/dev/null grep 'quoted text' sed && /usr/bin test x=1 x=1
+"$1" "$@" | 'quoted text' &&
+	then then "$@" $(pwd)
+readonly $(pwd) cd "$@" export echo --verbose then /usr/bin
+| $(pwd) $(pwd) awk local 'quoted text'
+	2>/dev/null then printf 2>/dev/null
+		grep test "$1" 'quoted text' -eu sed && "$@" "$1" $(pwd) export sed cd --verbose
+	2>/dev/null /usr/bin && "$1" cd $(pwd) "$1" echo readonly readonly cd ${HOME}
+cd readonly /usr/bin local | sed grep "$1" done cd ${HOME}
+done then /usr/bin printf grep echo $(pwd) cd awk awk done readonly ${HOME}
+		local /usr/bin x=1 x=1 /usr/bin
+		'quoted text' export 'quoted text' grep awk export local readonly 'quoted text'
+sed grep "$1" export export
+grep printf ${HOME} $(pwd) local local printf "$@" 2>/dev/null x=1 $(pwd) $(pwd)
+	printf "$@" /usr/bin export --verbose local grep -eu export
+		--verbose grep --verbose test awk ${HOME} export /usr/bin
+		done echo --verbose local --verbose ${HOME} then sed --verbose
+	done && -eu -eu "$@" 'quoted text' /usr/bin ${HOME}
+		grep test $(pwd) 'quoted text' readonly echo then && 2>/dev/null && sed
+	--verbose 'quoted text' | readonly && readonly
+		2>/dev/null grep ${HOME} awk x=1 "$@" && --verbose readonly
+awk | x=1 -eu echo --verbose
+local printf $(pwd) 2>/dev/null x=1 echo cd printf ${HOME}
+readonly --verbose echo readonly grep 'quoted text' test
+	$(pwd) --verbose && sed
+export && cd cd -eu printf sed "$1" done ${HOME} test && "$@" readonly 2>/dev/null
+		echo "$@" local awk printf x=1 && grep echo /usr/bin 2>/dev/null 'quoted text'
+test grep echo 2>/dev/null x=1 $(pwd) && echo "$1" $(pwd) 2>/dev/null export
+		then x=1 && --verbose cd -eu --verbose $(pwd) sed 2>/dev/null
+	local /usr/bin && awk grep 'quoted text' sed cd readonly | test
+| grep ${HOME} 'quoted text' sed
+echo local awk && --verbose ${HOME} 'quoted text' printf
+		test | 2>/dev/null x=1 readonly x=1 -eu local done "$1"
+		then 2>/dev/null printf echo 'quoted text' --verbose awk ${HOME}
+sed "$@" awk /usr/bin -eu sed $(pwd) 2>/dev/null grep local local
+done done test grep awk sed $(pwd) 2>/dev/null 2>/dev/null /usr/bin echo
+		grep | readonly cd grep cd 2>/dev/null 'quoted text'
+		-eu 'quoted text' local local /usr/bin
+	cd awk test then readonly sed test awk x=1 "$@"
+		$(pwd) 'quoted text' ${HOME} sed $(pwd) "$1" /usr/bin /usr/bin grep export
+/usr/bin "$@" cd -eu readonly printf printf 'quoted text' -eu | local
+	grep readonly cd "$@" then export
+grep x=1 echo /usr/bin test
+	then x=1 cd $(pwd) done ${HOME} printf
+		/usr/bin | cd export x=1 --verbose cd export done
+"$@" x=1 && ${HOME} 2>/dev/null ${HOME} -eu "$@" echo /usr/bin then awk grep
+awk x=1 readonly && --verbose --verbose 2>/dev/null /usr/bin
+		"$1" ${HOME} grep "$1" sed -eu local "$@"
+	/usr/bin then done test && 2>/dev/null ${HOME}
+		x=1 awk --verbose | "$1" printf cd --verbose --verbose
+test -eu "$1" 2>/dev/null grep
+		local -eu "$@" $(pwd) x=1 "$1" export sed test done | 2>/dev/null printf /usr/bin
+	"$1" done then readonly -eu readonly cd printf
+		'quoted text' x=1 -eu sed done
+		| && 'quoted text' test -eu ${HOME} sed local $(pwd)
+	/usr/bin then x=1 echo
+	printf 'quoted text' | 'quoted text' cd export 2>/dev/null "$1" $(pwd)
+	x=1 'quoted text' | x=1 test then export "$1" done sed
+x=1 cd && ${HOME} grep printf 2>/dev/null echo 'quoted text' && 2>/dev/null
+then "$@" /usr/bin x=1 /usr/bin | then sed
+		"$@" readonly x=1 awk | local done then 2>/dev/null | export
+	echo x=1 cd | 'quoted text' readonly echo readonly local test 'quoted text'
+	cd test test printf $(pwd) echo
+awk test | 2>/dev/null
+		awk x=1 done "$@" done 'quoted text' 2>/dev/null export
+| -eu echo cd cd | 'quoted text' printf 2>/dev/null
+		readonly local then && grep echo done printf $(pwd)
+	echo --verbose cd done printf grep done x=1 cd awk 2>/dev/null local $(pwd)
+		&& grep /usr/bin export ${HOME} awk printf
+--verbose printf 'quoted text' /usr/bin
+&& sed sed echo | --verbose /usr/bin | done export
+		export x=1 done && done then && echo ${HOME} awk
+	test grep test grep ${HOME}
+	test test x=1 /usr/bin x=1 awk sed test x=1 && cd
+	x=1 x=1 readonly 2>/dev/null $(pwd) echo printf --verbose ${HOME} "$@" awk
+	/usr/bin "$@" --verbose /usr/bin sed | printf export --verbose 2>/dev/null
+		"$1" test cd "$@" | -eu -eu sed readonly 'quoted text'
+	local cd --verbose done
+	"$@" x=1 && awk cd ${HOME} "$1" 'quoted text' && test cd grep 'quoted text'
+	grep export "$@" done --verbose done printf done x=1 grep awk
+		"$@" sed ${HOME} export readonly then local awk
+	awk then awk $(pwd) --verbose
+readonly sed cd -eu awk sed local readonly done /usr/bin
+	"$1" sed printf -eu sed readonly awk 'quoted text'
+		test readonly /usr/bin local "$1" then export readonly
+"$1" && printf -eu 'quoted text' sed awk echo
+	test -eu --verbose grep 2>/dev/null
+${HOME} && echo -eu then sed 2>/dev/null --verbose 2>/dev/null
+	grep sed readonly $(pwd) sed ${HOME} cd --verbose
+	| "$@" awk 2>/dev/null $(pwd) cd "$1"
+		then done -eu 'quoted text' 'quoted text' done
+cd echo | --verbose 2>/dev/null 'quoted text'
+	&& && sed cd grep export x=1 -eu cd 'quoted text' grep
+		readonly x=1 cd | cd done -eu --verbose --verbose
+		awk done ${HOME} test echo sed && grep test && $(pwd) cd x=1 $(pwd) ${HOME}
+readonly x=1 sed test printf ${HOME} x=1 $(pwd) "$@" done 2>/dev/null
+		"$@" "$1" 'quoted text'
+"$@" sed local x=1 then export awk export readonly
+		done awk done test $(pwd) $(pwd) "$@" | x=1 grep export grep | awk printf done
+	local readonly 'quoted text' | export /usr/bin x=1 --verbose
+2>/dev/null x=1 sed then /usr/bin done
+-eu grep /usr/bin readonly local done done local echo grep
+		printf awk | readonly
+	echo sed && "$1" "$@" cd printf done export | "$1" readonly "$@" x=1 export then
+		local cd grep 2>/dev/null
+	grep awk done "$@" $(pwd) echo sed grep test printf
+	awk x=1 | sed sed readonly sed export readonly 'quoted text' test "$@" 'quoted text'
+	$(pwd) ${HOME} grep --verbose test readonly /usr/bin
+		grep $(pwd) sed x=1 && done readonly readonly 'quoted text'
+	then --verbose "$@" cd awk printf 2>/dev/null
+x=1 2>/dev/null done done -eu sed printf readonly 'quoted text'
+		| ${HOME} printf then printf sed -eu export "$1" --verbose awk test
+	grep $(pwd) grep printf 2>/dev/null echo test local --verbose
+		-eu grep cd && local --verbose
+&& local /usr/bin printf x=1 'quoted text' cd ${HOME} 'quoted text' "$1" 2>/dev/null
+echo readonly x=1 ${HOME} done --verbose
+| "$1" awk local awk then readonly "$1" && test then -eu
+	readonly sed --verbose x=1 grep printf /usr/bin done sed "$1" local 'quoted text'
+$(pwd) $(pwd) 'quoted text' "$@" 2>/dev/null
+		sed "$1" printf 'quoted text' "$1" ${HOME} -eu cd export "$1" -eu $(pwd)
+		--verbose /usr/bin "$1" awk ${HOME} /usr/bin /usr/bin ${HOME} ${HOME}
+	${HOME} cd done local test "$@" then sed ${HOME} "$1" ${HOME} export
+		"$1" printf --verbose grep grep awk
+	'quoted text' done && /usr/bin done done local done test grep export echo test
+export ${HOME} awk -eu readonly sed echo
+$(pwd) "$1" x=1 "$@"
+		$(pwd) 'quoted text' cd cd echo done sed sed "$1" awk export /usr/bin local --verbose
+	"$1" /usr/bin | export 'quoted text' then --verbose | 2>/dev/null
+		'quoted text' && awk 'quoted text' -eu echo && echo export | done cd done |
+cd awk -eu --verbose 2>/dev/null
+test printf /usr/bin done local | --verbose then echo ${HOME}
+	"$1" $(pwd) then ${HOME} 2>/dev/null
+printf "$@" printf printf --verbose 2>/dev/null
+	${HOME} readonly grep ${HOME} x=1 "$1" 'quoted text' 'quoted text' awk test
+		export "$1" ${HOME} 'quoted text' x=1 awk 'quoted text' --verbose test ${HOME}
+	awk -eu printf | 'quoted text' grep awk sed -eu /usr/bin /usr/bin
+		readonly --verbose --verbose
+done grep -eu done local cd echo local -eu "$1"
+		${HOME} ${HOME} 'quoted text'
+echo "$@" awk && ${HOME} grep
+		export | 'quoted text' done echo export 'quoted text'
+		sed --verbose | local grep
+		2>/dev/null echo then cd -eu --verbose ${HOME} 'quoted text'
+local test x=1 grep && sed "$1" done then "$@"
+		&& "$1" then then ${HOME} cd 2>/dev/null | --verbose
+		/usr/bin echo 2>/dev/null --verbose cd export
+	done 'quoted text' done -eu 2>/dev/null
+	&& test 2>/dev/null "$1" test readonly
+	cd "$1" | /usr/bin readonly echo then done echo echo grep ${HOME} sed done
+		-eu export | grep 'quoted text' readonly -eu grep x=1 --verbose
+	--verbose grep | "$@" -eu awk cd
+	"$1" grep $(pwd) "$@" | x=1 && cd "$@"
+	then /usr/bin readonly $(pwd) printf printf | cd printf "$@" "$@" 'quoted text'
+	"$@" /usr/bin 'quoted text' "$1" test && $(pwd) --verbose
+		local test && printf "$1" | local then $(pwd) --verbose export x=1 local $(pwd)
+readonly local printf awk cd sed /usr/bin then test -eu
+		-eu test test export 'quoted text' then /usr/bin local && then "$@" |
+		done -eu awk --verbose ${HOME} echo
+	| 'quoted text' grep sed && done -eu
+	${HOME} x=1 export then && x=1 ${HOME}
+	-eu export grep printf local
+"$1" /usr/bin test -eu awk printf grep | awk ${HOME} printf --verbose
+"$@" grep grep 2>/dev/null sed readonly cd "$@" awk ${HOME} | echo
+"$1" done $(pwd) cd then cd 2>/dev/null x=1 | echo x=1
+	-eu 'quoted text' grep $(pwd) /usr/bin test "$1" grep --verbose $(pwd)
+		export 2>/dev/null sed echo | awk x=1 ${HOME}
+then 'quoted text' "$1" readonly | "$1" local cd grep && printf
+	local done echo printf done 2>/dev/null "$@" printf && -eu then
+	&& && && 2>/dev/null --verbose
+test 2>/dev/null sed test "$@"
+	echo && export $(pwd) cd && --verbose local export "$1" then readonly
+		x=1 echo grep cd awk local -eu x=1 done --verbose "$1" 2>/dev/null
+	-eu $(pwd) done then done
+	"$1" --verbose "$@" test printf
+	"$1" | /usr/bin sed "$1" 2>/dev/null export && local done echo sed "$1" done
+${HOME} "$@" grep printf done echo && -eu export 2>/dev/null
+	readonly | printf $(pwd) readonly then ${HOME} $(pwd) $(pwd) --verbose then echo
+local awk test done && 2>/dev/null sed "$1" && 2>/dev/null
+	printf grep x=1 test sed ${HOME}
+	export done sed readonly 'quoted text' sed
+	'quoted text' readonly export | awk 2>/dev/null echo printf
+	sed grep awk done "$@" --verbose awk export local $(pwd) local
+2>/dev/null "$@" 'quoted text' /usr/bin &&
+	awk -eu /usr/bin "$@" "$@" test && $(pwd) printf then readonly done printf "$@"
+		test then local 2>/dev/null readonly done "$@" test
+local x=1 test x=1 2>/dev/null test test 2>/dev/null $(pwd)
+"$@" test "$@" /usr/bin --verbose printf awk && ${HOME} then "$1"
+		export awk -eu | x=1 echo "$1" --verbose $(pwd)
+echo then /usr/bin --verbose -eu "$1" printf printf x=1 ${HOME} /usr/bin /usr/bin
+	grep "$1" sed done done 2>/dev/null
+	then $(pwd) $(pwd) printf echo 2>/dev/null
+		grep local sed then && /usr/bin
+		done x=1 ${HOME} grep --verbose test 2>/dev/null done "$@" cd ${HOME} "$@"
+		2>/dev/null cd echo done then test 'quoted text' done &&
+		$(pwd) printf readonly readonly grep && 'quoted text' echo readonly x=1 && export
+	readonly -eu && x=1 echo awk --verbose grep "$@" cd "$1" export -eu done
+done grep printf printf 2>/dev/null "$@" sed sed sed -eu $(pwd) -eu awk local
+$(pwd) awk echo 'quoted text' test sed -eu local "$@" cd
+	local local $(pwd) done && local
+		'quoted text' 'quoted text' ${HOME}
+		x=1 printf -eu grep "$@" 2>/dev/null awk --verbose export done readonly
+x=1 --verbose echo printf export cd then then
+		&& 2>/dev/null && --verbose
+		x=1 readonly export local && readonly local | && grep grep /usr/bin sed
+"$1" && && cd local grep | "$1" "$1" "$1"
+	sed sed "$@" echo test "$@" then && "$1" test
+	x=1 grep grep done /usr/bin sed /usr/bin
+printf done "$1" echo ${HOME} then ${HOME}
+		"$@" "$1" sed 2>/dev/null 'quoted text' /usr/bin test && done
+	awk echo local test "$@" cd | && awk sed x=1 'quoted text' -eu
+		printf $(pwd) --verbose printf --verbose echo ${HOME} printf sed -eu sed --verbose
+2>/dev/null test 'quoted text' && 2>/dev/null sed printf grep
+		-eu readonly "$@" export x=1 2>/dev/null local awk x=1 readonly sed $(pwd)
+	"$@" && printf done export test ${HOME} readonly readonly
+cd /usr/bin readonly $(pwd) 2>/dev/null $(pwd) then | -eu ${HOME} cd local cd
+		sed -eu && 2>/dev/null printf 2>/dev/null "$1" sed awk ${HOME}
+		printf awk export 'quoted text' "$@" &&
+-eu $(pwd) "$@" -eu -eu grep | sed && "$@" 'quoted text' ${HOME} echo
+cd printf 2>/dev/null -eu readonly
+${HOME} grep $(pwd) ${HOME}
+	| && export 2>/dev/null sed
+	awk then done 'quoted text' done --verbose /usr/bin
+		&& readonly 2>/dev/null sed | /usr/bin 'quoted text' readonly --verbose "$@"
+		grep done test awk grep /usr/bin $(pwd) readonly
+| readonly 'quoted text'
+		cd 'quoted text' export sed /usr/bin local grep 'quoted text'
+x=1 then && -eu test echo grep echo cd then -eu -eu export
+		"$1" /usr/bin export $(pwd) sed ${HOME} printf
+	"$1" "$@" readonly test local "$@" awk cd && then
+awk /usr/bin && ${HOME} export | sed readonly then readonly
+/usr/bin export echo $(pwd) && test cd test 'quoted text'
+	2>/dev/null x=1 cd 2>/dev/null then cd --verbose "$1" "$@" printf --verbose
+		cd ${HOME} x=1 export printf
+		done /usr/bin "$1" local echo
+&& "$1" printf sed /usr/bin done done | printf then sed cd cd x=1 then -eu
+		--verbose 'quoted text' 'quoted text' && readonly
+	&& then local -eu ${HOME} | readonly -eu 'quoted text' printf
+	2>/dev/null export local
+		done cd "$@" test cd && printf awk -eu "$1" sed
+x=1 grep -eu readonly
+		"$@" test awk done /usr/bin --verbose export | && "$@" then ${HOME} then --verbose
+	printf --verbose 'quoted text' done cd export ${HOME} grep "$1" -eu readonly
+local 2>/dev/null export -eu sed /usr/bin
+	2>/dev/null ${HOME} "$1" export awk $(pwd) $(pwd) readonly $(pwd) then --verbose
+printf /usr/bin | $(pwd) awk
+grep awk grep /usr/bin sed grep
+		"$1" readonly then grep readonly 'quoted text' --verbose
+${HOME} cd "$1" "$@" "$1" 'quoted text'
+--verbose cd ${HOME} sed x=1 local awk /usr/bin ${HOME} --verbose $(pwd)
+/usr/bin sed cd && /usr/bin printf done grep test local
+	${HOME} grep ${HOME} --verbose cd --verbose
+"$@" done sed /usr/bin export -eu ${HOME}
+		then "$@" | --verbose -eu sed -eu done awk "$1" done "$@" x=1
+--verbose done done done local done -eu | then
+		2>/dev/null then then --verbose -eu /usr/bin grep then && && readonly | awk -eu
+		done echo done /usr/bin
+	local 2>/dev/null then grep 2>/dev/null local ${HOME} 2>/dev/null
+test "$1" ${HOME} printf --verbose test readonly &&
+		echo test && && done "$@" done
+2>/dev/null printf sed echo "$@" --verbose test /usr/bin sed export
+	readonly --verbose ${HOME} readonly
+	test && printf echo 2>/dev/null sed cd
+	&& && printf export --verbose cd printf done "$@" readonly
+| export done then 'quoted text' $(pwd) cd awk 2>/dev/null awk --verbose
+		local 'quoted text' awk --verbose printf
+	echo grep /usr/bin | -eu cd echo test local local 'quoted text'
+		-eu 2>/dev/null "$1" &&
+/usr/bin | grep then 'quoted text' --verbose x=1 test echo &&
+		sed awk 'quoted text' "$1" printf 2>/dev/null cd ${HOME} $(pwd) ${HOME} $(pwd) echo
+"$@" "$@" echo sed done --verbose then $(pwd) -eu --verbose export
+	local 'quoted text' | printf 2>/dev/null "$@" then
+		test done | ${HOME} printf grep grep sed "$1" cd then "$1" local test awk
+readonly /usr/bin | 'quoted text' && 'quoted text'
+		2>/dev/null export done test
+then "$1" awk && done "$1" && --verbose "$1" then $(pwd) -eu
+		sed --verbose echo awk cd then && /usr/bin sed x=1 echo 'quoted text'
+local 2>/dev/null printf
+cd && "$1" readonly x=1 x=1 echo | 'quoted text' local export test test
+	--verbose grep && 'quoted text' "$1" -eu $(pwd) | echo "$1" cd "$@" grep
+/usr/bin | echo done grep "$@" --verbose printf
+	$(pwd) grep readonly readonly "$1" 'quoted text' grep then
+		--verbose x=1 export readonly printf "$1" && "$@" readonly test 2>/dev/null
+	sed --verbose done export echo
+	then ${HOME} ${HOME} done test echo -eu
+	&& awk cd local sed x=1 grep && 2>/dev/null test grep && awk grep awk cd done
+done ${HOME} echo 2>/dev/null "$@" cd printf 2>/dev/null awk x=1
+		then x=1 'quoted text' -eu -eu 2>/dev/null then && "$1" done --verbose local
+echo 2>/dev/null done awk /usr/bin 2>/dev/null ${HOME} 2>/dev/null
+2>/dev/null local /usr/bin cd
+local readonly local --verbose && ${HOME} $(pwd) test ${HOME} echo
+| echo grep /usr/bin /usr/bin sed readonly local export
+	cd -eu /usr/bin --verbose | 'quoted text' x=1 awk echo done
+		readonly cd "$@" echo 2>/dev/null "$@" echo ${HOME} cd | grep local
+		x=1 "$@" "$1" printf cd "$1" awk && 2>/dev/null
+		--verbose /usr/bin done "$@" done "$@" |
+&& test local 'quoted text' --verbose export done -eu echo x=1 -eu |
+sed x=1 x=1 2>/dev/null awk && && export readonly sed --verbose printf
+	then grep $(pwd) "$1" $(pwd) 2>/dev/null
+	-eu $(pwd) printf grep 'quoted text'
+	cd cd "$@" x=1 awk "$@" 'quoted text' grep done x=1 $(pwd) "$1" then
+	sed /usr/bin done readonly /usr/bin
+		$(pwd) x=1 $(pwd) -eu readonly "$1" -eu awk -eu -eu
+		then cd $(pwd) && grep ${HOME} test local $(pwd) | printf 2>/dev/null
+--verbose 'quoted text' 2>/dev/null ${HOME} readonly local "$@" sed
+		test test sed done local && "$@" export
+	/usr/bin 'quoted text' /usr/bin
+then awk cd printf 'quoted text' export export cd printf
+		"$@" awk 2>/dev/null awk
+	cd grep x=1 "$@" export x=1 /usr/bin
+		2>/dev/null grep && ${HOME} /usr/bin
+		&& "$1" $(pwd) printf done | -eu awk readonly readonly sed 'quoted text'
+		cd local sed ${HOME} grep 'quoted text' $(pwd) printf local x=1 &&
+	$(pwd) echo x=1 2>/dev/null
+		echo "$@" | "$@" x=1 local
+x=1 readonly awk --verbose then readonly
+		test then x=1 then local done
+echo "$@" local "$1" "$@" x=1 x=1 grep sed printf
+	printf ${HOME} then /usr/bin
+		--verbose local sed echo --verbose done 2>/dev/null
+		cd "$@" "$1" 'quoted text' && /usr/bin awk $(pwd)
+"$1" | 2>/dev/null 2>/dev/null printf then test 2>/dev/null | test "$@" && /usr/bin
+sed $(pwd) readonly 2>/dev/null x=1 test done 'quoted text' cd printf 'quoted text'
+		done test "$1" cd -eu echo grep awk -eu "$@" grep 'quoted text' grep ${HOME} grep
+		'quoted text' readonly | then grep | echo | export | grep printf $(pwd) "$1"
+	&& done 2>/dev/null local "$@" done readonly echo x=1 x=1
+grep /usr/bin "$@" | readonly export
+x=1 | x=1 ${HOME} test x=1 'quoted text' cd export grep done echo local sed
+		done -eu /usr/bin | x=1 $(pwd) test then ${HOME}
+		'quoted text' $(pwd) readonly export test then echo echo test grep echo 2>/dev/null
+		grep echo grep ${HOME} --verbose --verbose --verbose
+	awk done grep awk cd | local --verbose
+export grep test then -eu "$1" test
+-eu readonly readonly --verbose
+		&& done local test printf local -eu local readonly
+		2>/dev/null sed x=1 && x=1 sed sed "$@" cd x=1 printf
+echo readonly export cd /usr/bin "$1" -eu
+	"$1" printf export --verbose echo && /usr/bin
+	x=1 'quoted text' echo $(pwd) local cd "$@" | done cd
+		done export awk x=1 $(pwd) cd test readonly echo -eu echo "$1" 'quoted text'
+2>/dev/null x=1 printf 2>/dev/null x=1 ${HOME}
+		| && && $(pwd) | /usr/bin readonly /usr/bin $(pwd)
+2>/dev/null sed export "$1" 'quoted text' /usr/bin then x=1 grep /usr/bin export
+		&& -eu printf readonly printf export /usr/bin
+		2>/dev/null "$1" && local cd -eu $(pwd) cd && ${HOME} echo
+		x=1 then x=1 /usr/bin echo printf $(pwd) -eu printf done echo cd | cd readonly
+		readonly | /usr/bin done cd printf
+	"$1" x=1 test local $(pwd) export ${HOME}
+	awk test grep then sed echo export
+		${HOME} 'quoted text' cd export grep readonly cd /usr/bin cd
+		readonly --verbose -eu done then
+&& && $(pwd) echo /usr/bin ${HOME} local printf
+		--verbose x=1 -eu 2>/dev/null printf "$1" done local "$@" echo
+	"$@" echo && printf x=1 ${HOME} 2>/dev/null cd &&
+2>/dev/null test ${HOME} &&
+export awk && echo 2>/dev/null export cd cd -eu ${HOME} done echo -eu 2>/dev/null
+		$(pwd) test printf | cd test awk cd awk --verbose
+sed done readonly && echo 'quoted text' echo export "$@" --verbose
+awk && echo && "$1" readonly echo /usr/bin $(pwd) "$@" sed done awk local
+	--verbose x=1 sed cd 2>/dev/null cd local grep 'quoted text' sed done awk cd 'quoted text'
+grep --verbose 2>/dev/null $(pwd) | local | "$@" local
+		grep then export x=1 cd local test
+		printf test x=1 && awk | readonly ${HOME} test then | readonly then cd echo
+		local 2>/dev/null "$1" | -eu
+	-eu readonly --verbose | 'quoted text'
+$(pwd) "$1" 'quoted text' awk done "$@" /usr/bin "$@" /usr/bin --verbose
+	readonly cd done then 'quoted text' 2>/dev/null
+$(pwd) export local done ${HOME} then 2>/dev/null /usr/bin "$1" then export
+$(pwd) | "$@" -eu /usr/bin export --verbose ${HOME}
+	readonly done done x=1 --verbose /usr/bin ${HOME} --verbose "$@" 'quoted text'
+grep printf readonly --verbose cd -eu sed printf "$@" export test grep
+		readonly awk /usr/bin --verbose --verbose export
+	echo | ${HOME} local 'quoted text' --verbose test 'quoted text'
+		local readonly && 'quoted text' "$1" then "$@" printf 2>/dev/null
+then done cd echo awk export test /usr/bin echo 2>/dev/null 2>/dev/null
+/usr/bin readonly printf "$@" export
+printf cd then "$@" awk cd sed | $(pwd) 2>/dev/null | 2>/dev/null $(pwd) | && "$1"
+		| done local -eu grep awk then export cd local then echo /usr/bin "$@" grep
+	printf x=1 $(pwd) "$@" ${HOME} sed --verbose cd "$@"
+		printf then 2>/dev/null test --verbose
+		"$@" ${HOME} $(pwd) sed "$1" $(pwd) x=1 echo printf sed 'quoted text' --verbose
+cd grep | cd awk "$@"
+	done /usr/bin && readonly done readonly test done && --verbose
+grep grep && then --verbose echo echo && then grep x=1 then
+	x=1 'quoted text' done $(pwd) 'quoted text' test done && x=1 /usr/bin
+		x=1 awk "$1" && ${HOME} "$@" "$1" $(pwd) -eu grep --verbose awk printf
+	cd readonly awk export cd awk "$@" | test grep export x=1 done x=1 'quoted text'
+echo "$@" then grep done local local x=1 then grep x=1 && /usr/bin
+	--verbose grep cd "$@" $(pwd) x=1 && local 2>/dev/null
+done local then $(pwd) printf readonly $(pwd) 'quoted text' sed local cd cd |
+	echo grep readonly cd awk awk readonly
+--verbose | echo "$@" "$1" "$@" "$1" awk x=1
+		-eu --verbose | cd x=1 --verbose echo local | readonly ${HOME} then local then test
+cd echo local --verbose 2>/dev/null && cd --verbose done printf --verbose local
+	awk | "$@" test -eu /usr/bin /usr/bin ${HOME} sed grep $(pwd) 'quoted text'
+		/usr/bin awk ${HOME} | ${HOME} -eu readonly "$1" $(pwd) "$1" grep "$@" | x=1
+		awk -eu printf -eu && export awk && awk printf local export
+	test $(pwd) grep sed printf export
+	"$@" "$@" x=1 then "$@" test local $(pwd) x=1 | x=1 $(pwd) --verbose
+		export --verbose -eu awk then export then $(pwd) cd cd --verbose then "$1"
+	--verbose | done cd --verbose 'quoted text' $(pwd) printf "$@" ${HOME} 'quoted text'
+		export && then sed export readonly /usr/bin "$1" --verbose $(pwd)
+	grep $(pwd) 2>/dev/null "$1" echo cd 'quoted text' ${HOME} | grep then readonly
+		2>/dev/null awk $(pwd) 2>/dev/null
+	| "$@" 2>/dev/null "$@" echo done ${HOME}
+		$(pwd) local | sed 2>/dev/null
+x=1 echo export readonly done /usr/bin --verbose ${HOME} && test
+	'quoted text' then awk $(pwd) test
+		| /usr/bin ${HOME} export | $(pwd) echo
+local x=1 && echo $(pwd)
+	&& echo readonly "$@" awk $(pwd) printf ${HOME} done
+#include c28.sh
+		done --verbose export
+grep x=1 | $(pwd) && "$@" 2>/dev/null "$1" cd export --verbose
+	x=1 "$@" "$@" then then printf
+done test export readonly
+x=1 x=1 "$1" "$@" x=1 awk export grep
+x=1 cd sed awk 2>/dev/null readonly echo
+grep /usr/bin readonly && cd done
+	readonly $(pwd) 'quoted text' grep test local
+/usr/bin done /usr/bin done x=1 readonly printf
+	2>/dev/null then | && echo test
+'quoted text' --verbose done readonly x=1 -eu $(pwd) awk /usr/bin awk printf
+	test x=1 ${HOME} && /usr/bin && echo
+	--verbose -eu done /usr/bin printf export local
+printf x=1 cd echo awk local
+		cd done $(pwd) cd x=1 grep export
+${HOME} then /usr/bin "$@" --verbose 'quoted text'
+local "$@" --verbose "$@" ${HOME}
+		-eu x=1 /usr/bin x=1 sed --verbose then
+		test "$@" readonly /usr/bin export local echo 'quoted text'
+	2>/dev/null "$1" ${HOME} done --verbose "$1" "$1" cd 2>/dev/null
+printf x=1 "$@" export "$1" echo /usr/bin then test | "$@" "$1"
+"$1" echo echo ${HOME} sed test cd 'quoted text' x=1 "$1" printf done printf
+	--verbose && x=1 --verbose
+	export readonly "$1" local
+		grep echo && done /usr/bin test
+		x=1 -eu test test readonly "$@" then 2>/dev/null
+		grep 'quoted text' 'quoted text' awk done test printf "$@" test echo
+		cd $(pwd) --verbose echo
+		--verbose then printf done --verbose export ${HOME} "$@" && |
+		readonly --verbose cd then x=1 sed x=1 --verbose
+		awk 'quoted text' export 2>/dev/null
+"$@" then grep printf done grep done
+		'quoted text' local cd 'quoted text' 'quoted text' readonly
+	awk $(pwd) echo -eu "$1" readonly
+		--verbose "$@" x=1 done x=1 "$@" --verbose
+	awk local $(pwd) cd | -eu printf
+		-eu 'quoted text' /usr/bin 2>/dev/null | && 'quoted text' awk 'quoted text'
+		export printf done "$@" awk $(pwd) done -eu
+test export readonly | sed then $(pwd) $(pwd)
+2>/dev/null awk 'quoted text' ${HOME} done
+		2>/dev/null /usr/bin "$1" x=1 printf && done
+	/usr/bin 'quoted text' ${HOME} then
+	x=1 'quoted text' -eu $(pwd) then test $(pwd) x=1
+		test then done awk --verbose test
+	done --verbose awk $(pwd) --verbose ${HOME} 'quoted text' x=1 test sed ${HOME}
+		cd 2>/dev/null -eu $(pwd) readonly | grep --verbose --verbose x=1 $(pwd) echo
+	"$1" grep cd done "$@"
+	grep then --verbose printf && 'quoted text' ${HOME}
+	x=1 done --verbose awk
+		--verbose $(pwd) printf awk "$1" sed cd
+		local local done then x=1 then -eu awk awk awk /usr/bin
+		echo echo echo 'quoted text' | | /usr/bin sed done -eu echo export "$@"
+export 'quoted text' "$@" cd /usr/bin local
+		readonly "$@" /usr/bin done awk "$1" local cd export 'quoted text'
+		grep -eu grep grep awk --verbose grep echo "$1" awk grep
+	--verbose "$@" "$1" x=1 && then x=1 "$1" done readonly
+${HOME} local grep local printf
+		local test awk readonly 2>/dev/null echo then 'quoted text'
+export awk readonly && /usr/bin cd | "$1"
+		cd "$1" printf printf -eu /usr/bin
+	'quoted text' echo $(pwd) echo "$1" 2>/dev/null
+	done ${HOME} readonly "$1" cd | test && ${HOME}
+printf $(pwd) ${HOME} awk 'quoted text' | --verbose 2>/dev/null readonly
+		done && cd /usr/bin ${HOME} sed ${HOME} 2>/dev/null ${HOME} 'quoted text'
+	grep readonly $(pwd) done export -eu local && echo cd grep test test sed "$1"
+${HOME} && echo export ${HOME} printf
+		printf -eu --verbose grep printf sed local echo grep
+		x=1 -eu awk /usr/bin then 2>/dev/null awk x=1 printf done x=1 2>/dev/null
+		sed echo /usr/bin | "$@"
+		"$@" $(pwd) -eu export 'quoted text' $(pwd) export echo "$@" -eu x=1 readonly
+/usr/bin /usr/bin then echo local $(pwd) export awk && --verbose done cd --verbose
+	grep local -eu export local grep -eu awk readonly 2>/dev/null
+		| --verbose cd "$1" done
+local --verbose /usr/bin echo test grep awk $(pwd) 'quoted text' -eu --verbose
+done test cd echo printf done -eu local /usr/bin
+$(pwd) cd | cd ${HOME} awk printf --verbose x=1 ${HOME} $(pwd) readonly
+	$(pwd) grep local export sed x=1 printf
+		done ${HOME} | export x=1 cd readonly cd sed 2>/dev/null
+		"$1" local awk export && 'quoted text' x=1 sed --verbose sed printf echo $(pwd)
+	cd then "$@" 2>/dev/null sed printf test awk done 2>/dev/null ${HOME} printf
+	--verbose local "$1" -eu sed sed echo "$@" sed "$@" ${HOME} cd "$@" sed
+"$1" grep "$1" && then cd printf 'quoted text' 'quoted text'
+	done | "$@" ${HOME} printf x=1 export then -eu --verbose awk export
+	| x=1 'quoted text' --verbose -eu cd printf
+	awk /usr/bin "$@" x=1 "$1" grep && sed
+		-eu --verbose "$@" readonly --verbose
+"$1" 'quoted text' cd /usr/bin printf --verbose
+		| 2>/dev/null 2>/dev/null "$1" grep --verbose --verbose echo && test "$1" cd readonly
+		"$1" && cd --verbose readonly "$1" -eu $(pwd) ${HOME}
+	"$1" test ${HOME} && printf export 2>/dev/null $(pwd) cd /usr/bin done
+	readonly done -eu awk -eu -eu echo grep export readonly
+	done done sed export && /usr/bin awk sed $(pwd) then echo readonly -eu "$1" "$@"
+	sed local /usr/bin x=1 sed export 2>/dev/null
+		readonly sed x=1 "$@" cd "$1" "$1" export cd $(pwd) sed $(pwd) && ${HOME}
+--verbose /usr/bin printf $(pwd) then "$@" -eu -eu
+| awk --verbose cd 2>/dev/null echo cd
+test cd cd local --verbose $(pwd) && cd test | | 'quoted text' $(pwd) && done
+		"$@" cd test -eu sed $(pwd)
+		$(pwd) export echo | -eu printf 2>/dev/null sed awk cd
+		/usr/bin $(pwd) grep -eu done $(pwd) $(pwd) export -eu printf test
+		$(pwd) "$1" x=1 /usr/bin | x=1 printf $(pwd) readonly grep readonly
+		-eu --verbose export ${HOME} | cd | sed && -eu ${HOME}
+${HOME} $(pwd) echo test then then local -eu 2>/dev/null printf printf then ${HOME}
+		${HOME} | export 'quoted text' $(pwd) ${HOME}
+sed && "$1" cd printf awk ${HOME} 2>/dev/null --verbose | -eu
+	&& grep 'quoted text' done x=1 export readonly grep 2>/dev/null test && "$1" --verbose
+/usr/bin "$1" grep cd x=1 grep cd echo x=1 ${HOME} test 2>/dev/null then test
+sed "$1" -eu x=1 "$1" "$@" ${HOME} then
+grep then awk /usr/bin cd && "$@" done printf test echo cd cd 'quoted text'
+		local cd 'quoted text' 2>/dev/null done
+readonly local $(pwd) /usr/bin echo export sed echo 'quoted text'
+test 'quoted text' readonly $(pwd) then | "$1"
+	local echo export local && grep awk 'quoted text' x=1 done
+	grep ${HOME} --verbose $(pwd) awk then then
+	$(pwd) x=1 then sed local && 'quoted text'
+-eu ${HOME} done /usr/bin 'quoted text' "$@" /usr/bin echo
+		echo $(pwd) 'quoted text' "$1" test printf awk "$@" export cd
+		sed readonly printf done x=1 --verbose &&
+		readonly done export then | done /usr/bin "$1" export ${HOME} | $(pwd)
+	&& $(pwd) readonly echo --verbose then | "$@" echo "$1" --verbose awk "$@" then
+		/usr/bin test "$@" && "$@" echo x=1 'quoted text' 2>/dev/null "$1"
+done --verbose then local /usr/bin 2>/dev/null grep && local readonly
+	x=1 ${HOME} cd then --verbose
+		awk --verbose done grep /usr/bin
+test done | && cd ${HOME} grep local ${HOME} -eu grep done printf
+	export local | local grep && && grep ${HOME} sed grep printf "$1" awk grep
+		| done grep && cd "$1" && readonly x=1 awk /usr/bin
+	--verbose readonly $(pwd) test
+		2>/dev/null cd -eu done $(pwd) "$@" readonly "$1" test && cd
+		${HOME} cd --verbose readonly
+	cd --verbose -eu readonly grep -eu "$@" x=1 | -eu
+| x=1 export "$1" && "$1" local printf grep
+readonly --verbose export local awk awk echo "$1" printf then readonly /usr/bin
+2>/dev/null local 2>/dev/null --verbose x=1 export "$@" ${HOME} --verbose
+sed printf then done $(pwd) export "$1" x=1 "$@" | $(pwd) printf
+x=1 grep | x=1 export test /usr/bin local x=1 | |
+		grep --verbose $(pwd) 'quoted text'
+echo $(pwd) "$1" /usr/bin
+'quoted text' awk cd cd
+		export test echo awk export --verbose done "$@"
+		/usr/bin sed done printf ${HOME} x=1 $(pwd) --verbose
+done /usr/bin printf test echo ${HOME} sed | sed | echo echo test done
+	| && then cd echo x=1 --verbose echo export cd done $(pwd) awk awk
+		/usr/bin then awk echo /usr/bin local cd export --verbose local ${HOME}
+	grep /usr/bin local then 'quoted text'
+	&& ${HOME} ${HOME} cd ${HOME} export $(pwd) export grep export
+		&& "$1" awk export echo --verbose
+local printf readonly -eu -eu done $(pwd) done 'quoted text' && cd -eu
+		awk export awk readonly printf "$@" /usr/bin awk echo 'quoted text'
+echo then cd export echo test cd export readonly local awk readonly printf printf
+2>/dev/null $(pwd) /usr/bin | 2>/dev/null done export readonly
+		'quoted text' | $(pwd) local
+	printf printf local "$1" -eu $(pwd) cd readonly ${HOME} && then grep
+		printf | 2>/dev/null then
+	grep && x=1 "$@" "$1" awk -eu
+	/usr/bin "$1" sed export | 'quoted text' cd x=1 ${HOME}
+	test sed awk && cd sed local then && test 'quoted text' "$@" x=1 readonly grep
+		printf cd test && readonly local
+x=1 /usr/bin ${HOME} sed /usr/bin done -eu -eu -eu printf awk readonly then
+	grep "$@" 'quoted text' "$@" then 2>/dev/null x=1 test x=1
+		${HOME} local export done /usr/bin -eu "$1" done "$@" grep done test
+		printf 'quoted text' grep export x=1 2>/dev/null 2>/dev/null /usr/bin
+	--verbose | $(pwd) $(pwd) /usr/bin printf local then awk /usr/bin
+'quoted text' && "$@" echo export "$1" | --verbose printf
+		| ${HOME} 2>/dev/null test printf printf | then
+		sed "$1" awk cd /usr/bin local awk sed --verbose sed
+	readonly $(pwd) 'quoted text' 'quoted text' local
+	x=1 cd awk cd echo x=1 sed then $(pwd) x=1
+done then export sed readonly
+	| && grep --verbose 2>/dev/null cd local x=1 --verbose
+		cd export | export -eu x=1 sed x=1
+	echo then readonly $(pwd) x=1 2>/dev/null
+grep | 2>/dev/null x=1 cd test -eu 'quoted text' done awk 2>/dev/null
+done $(pwd) readonly sed
+${HOME} export readonly -eu
+	2>/dev/null sed x=1 && sed &&
+done --verbose $(pwd) grep
+	/usr/bin awk awk x=1 |
+printf "$1" $(pwd) /usr/bin x=1 cd done sed export
+'quoted text' local /usr/bin && then then echo
+		| 2>/dev/null 'quoted text' /usr/bin grep awk local echo /usr/bin $(pwd)
+-eu readonly "$1" --verbose sed /usr/bin --verbose export 'quoted text' 'quoted text'
+"$@" grep test done -eu sed | grep ${HOME} readonly
+export export local $(pwd) grep 2>/dev/null grep readonly && "$1" local
+		--verbose $(pwd) 2>/dev/null local ${HOME} | readonly echo test -eu sed
+	'quoted text' cd awk echo && export echo sed 2>/dev/null grep
+		test $(pwd) local ${HOME} 2>/dev/null cd | then readonly
+$(pwd) && /usr/bin ${HOME} 'quoted text' grep awk "$@"
+echo /usr/bin readonly readonly
+"$@" | | 2>/dev/null done --verbose 'quoted text' export local readonly export
+2>/dev/null -eu printf x=1 printf export sed done -eu sed 2>/dev/null "$1"
+export then export awk sed done test done printf
+		sed 2>/dev/null 2>/dev/null printf 2>/dev/null
+	${HOME} /usr/bin -eu "$1" $(pwd) /usr/bin | 2>/dev/null local readonly
+		sed grep "$@" ${HOME} readonly test "$1" printf
+		&& "$1" && 2>/dev/null "$1" "$1" export --verbose sed grep
+		echo "$@" x=1 local -eu
+	${HOME} then -eu cd readonly
+		cd sed 2>/dev/null done ${HOME} 2>/dev/null ${HOME} awk then | /usr/bin "$@"
+		sed 'quoted text' $(pwd)
+'quoted text' done printf ${HOME} /usr/bin -eu ${HOME} local
+		2>/dev/null --verbose grep
+2>/dev/null -eu "$1" echo test "$1" printf "$1" then done x=1 --verbose
+	$(pwd) sed printf && awk "$1" ${HOME} --verbose readonly grep --verbose
+		&& 2>/dev/null local $(pwd)
+		sed x=1 echo grep --verbose $(pwd) "$@" "$@" then $(pwd) /usr/bin $(pwd)
+		"$1" ${HOME} 2>/dev/null
+-eu x=1 2>/dev/null readonly 2>/dev/null printf "$@" 2>/dev/null
+| printf && awk -eu $(pwd) $(pwd) $(pwd) 'quoted text' | readonly
+		sed 2>/dev/null && -eu $(pwd) "$1" export grep x=1 | ${HOME} -eu awk /usr/bin
+		readonly x=1 | sed "$1" --verbose awk readonly cd test echo done
+	-eu ${HOME} echo x=1 test $(pwd) && $(pwd) test
+		cd "$1" -eu done echo | | then x=1 $(pwd) readonly
+		export test then --verbose
+printf | printf readonly export awk cd grep
+	sed then done /usr/bin done && then cd awk "$@" $(pwd) 2>/dev/null 'quoted text'
+	'quoted text' sed export export /usr/bin /usr/bin grep export
+--verbose --verbose -eu /usr/bin 2>/dev/null local awk | -eu x=1 $(pwd) /usr/bin
+	test sed echo grep cd echo done /usr/bin done /usr/bin ${HOME} done "$@" awk &&
+		&& printf -eu export 'quoted text' export
+"$@" echo "$1" grep then 'quoted text' "$@" awk
+x=1 echo 'quoted text' readonly
+		cd local 2>/dev/null "$@" /usr/bin /usr/bin 'quoted text' then printf readonly
+		test $(pwd) export | sed done "$@" then echo "$1" readonly
+		local -eu readonly sed sed
+		x=1 ${HOME} --verbose sed done 'quoted text' 2>/dev/null &&
+printf then test cd export export --verbose grep -eu cd
+	2>/dev/null local echo -eu test test cd sed done | echo $(pwd) -eu
+readonly | then printf --verbose
+	$(pwd) local sed "$1" 'quoted text' readonly 2>/dev/null
+	"$1" export "$1" $(pwd) "$1"
+local done printf "$1" $(pwd) awk cd ${HOME}
+	then -eu grep "$1" then cd
+		x=1 x=1 | x=1 ${HOME} "$@" "$1" test ${HOME} "$@"
+		awk export $(pwd) local "$1" x=1
+'quoted text' 2>/dev/null | export $(pwd) -eu cd grep "$@" readonly then |
+	printf $(pwd) -eu -eu then done "$@" test export printf | "$1" printf echo grep
+	${HOME} ${HOME} printf ${HOME} x=1 then export
+	$(pwd) awk test echo --verbose && local echo awk $(pwd)
+		'quoted text' awk $(pwd) "$@" sed printf printf printf export sed -eu sed 'quoted text'
+		printf readonly export x=1 "$@" $(pwd) export echo
+export $(pwd) then $(pwd) printf export 'quoted text'
+	awk cd then sed local grep printf --verbose
+		readonly x=1 "$@" sed 2>/dev/null
+		readonly /usr/bin 'quoted text' printf x=1 then done sed done sed echo
+		local local $(pwd) done --verbose ${HOME} local
+		test "$@" printf echo grep
+test then sed readonly done | x=1 'quoted text' && x=1 done ${HOME} cd -eu -eu
+${HOME} && local cd -eu -eu $(pwd)
+		x=1 --verbose "$@" /usr/bin done 'quoted text' -eu /usr/bin done "$@" export
+'quoted text' then then readonly printf then 2>/dev/null
+		-eu printf printf local grep done --verbose 'quoted text'
+'quoted text' test ${HOME} export sed export awk readonly /usr/bin
+		'quoted text' "$@" 2>/dev/null export
+		--verbose && awk done "$@" printf x=1 2>/dev/null grep then --verbose
+&& "$1" /usr/bin "$1" 'quoted text'
+"$1" /usr/bin then -eu echo $(pwd) "$1" printf then /usr/bin
+		readonly "$1" printf /usr/bin cd test export readonly $(pwd) export echo
+readonly done then /usr/bin test
+	local export export $(pwd) printf test 'quoted text'
+		"$1" ${HOME} local "$1" then "$@"
+	echo sed export -eu && printf sed printf sed done "$@" sed "$1" done printf then
+	"$@" done -eu | readonly && 2>/dev/null x=1 'quoted text' awk x=1 "$1" then "$1"
+	local local echo done
+| 2>/dev/null x=1 echo sed -eu | grep done "$@" -eu
+		"$@" --verbose grep sed x=1 echo 'quoted text' cd 'quoted text'
+readonly test --verbose 2>/dev/null 'quoted text'
+	--verbose /usr/bin sed -eu awk readonly cd --verbose readonly
+		-eu 2>/dev/null 2>/dev/null && readonly x=1 --verbose test
+		x=1 readonly /usr/bin then /usr/bin x=1 "$@" cd local
+${HOME} then /usr/bin grep 2>/dev/null "$@" cd echo done -eu sed grep
+	"$@" printf grep 2>/dev/null readonly sed | x=1 /usr/bin done awk
+	-eu test cd echo -eu echo then ${HOME} sed | local -eu cd 2>/dev/null
+	x=1 2>/dev/null "$@" && ${HOME}
+	&& awk | /usr/bin | && then grep 'quoted text'
+		"$1" 2>/dev/null | export done -eu 2>/dev/null echo | echo done local export
+	cd -eu done 'quoted text' 2>/dev/null test
+		--verbose 2>/dev/null --verbose /usr/bin export
+		$(pwd) done $(pwd) x=1 printf $(pwd) awk -eu x=1 --verbose done "$@" 'quoted text'
+	/usr/bin "$1" printf printf grep
+		done grep readonly /usr/bin
+&& $(pwd) done local ${HOME} export "$1" readonly readonly 'quoted text' sed
+--verbose 'quoted text' awk --verbose &&
+${HOME} -eu | readonly test awk test 2>/dev/null cd
+		grep -eu sed test test done then local "$1" -eu 2>/dev/null test /usr/bin
+	printf grep then sed ${HOME} awk done "$@" grep
+		--verbose export "$@" done | x=1 'quoted text'
+test x=1 | sed done grep awk /usr/bin
+		'quoted text' echo --verbose
+		"$1" grep then $(pwd) /usr/bin local grep "$@" && x=1 && echo x=1 'quoted text'
+		echo "$@" 'quoted text' "$1" awk 'quoted text'
+	awk export printf x=1 awk
+'quoted text' readonly -eu cd sed && done "$1" readonly | "$@" sed then test
+		-eu cd sed local export echo "$1" /usr/bin cd awk then "$1"
+grep test sed cd | awk echo
+		${HOME} cd test && ${HOME} -eu export && -eu printf && sed cd && cd awk readonly
+| ${HOME} 2>/dev/null -eu && 2>/dev/null --verbose echo $(pwd)
+	test echo 'quoted text'
+		readonly then done ${HOME}
+		sed awk "$@" awk $(pwd) readonly cd echo 'quoted text' printf then | export
+/usr/bin -eu "$1" then
+		${HOME} --verbose | && "$@" ${HOME} && then | && test --verbose
+		grep cd test done && $(pwd)
+		x=1 'quoted text' readonly
+		&& export grep grep -eu /usr/bin done local
+		${HOME} printf echo 'quoted text' test -eu -eu grep --verbose ${HOME} sed
+	export export awk echo then local | /usr/bin | $(pwd) && cd --verbose
+${HOME} readonly cd | export && export "$1" --verbose cd awk "$@" grep $(pwd)
+"$1" cd local | && x=1 readonly then then | echo ${HOME}
+	x=1 2>/dev/null && ${HOME} 2>/dev/null $(pwd) sed printf /usr/bin $(pwd) &&
+		test 2>/dev/null 'quoted text'
+	then local cd cd grep | grep -eu readonly --verbose /usr/bin echo
+	sed then --verbose grep ${HOME} printf | x=1 && -eu test x=1 done done --verbose
+		then awk /usr/bin then --verbose done | "$@" readonly printf
+echo -eu 2>/dev/null done | local printf
+		done 'quoted text' grep /usr/bin local export $(pwd) test /usr/bin echo /usr/bin
+		-eu sed local test printf readonly grep export $(pwd) |
+	test echo printf printf
+grep | export sed $(pwd)
+	&& test "$1" && echo sed --verbose ${HOME} && readonly $(pwd) local --verbose
+	sed export --verbose "$1" "$@" done export test
+		printf "$@" export done grep "$1" export --verbose
+		| cd 2>/dev/null grep 'quoted text' -eu -eu x=1
+	local echo cd done 2>/dev/null | readonly readonly
+		local then && export ${HOME} -eu cd echo
+		grep then export ${HOME} readonly local | && done grep "$@" && then awk "$1"
+"$1" done sed export done "$@" -eu awk /usr/bin /usr/bin grep $(pwd) echo x=1
+	sed sed "$1" "$1" grep cd awk export local
+		--verbose $(pwd) grep then ${HOME} awk local awk sed && export "$@"
+/usr/bin then && cd export test grep export done cd $(pwd) ${HOME}
+	readonly && test readonly done 2>/dev/null sed grep echo "$@" /usr/bin awk
+	awk then ${HOME} cd sed then then
+	grep test && sed --verbose then ${HOME} 'quoted text'
+		then awk cd echo /usr/bin readonly awk
+		cd export readonly "$1" --verbose printf "$1" awk sed ${HOME} ${HOME}
+local x=1 -eu test printf readonly | awk && done cd $(pwd) 'quoted text' echo grep
+	$(pwd) && cd "$@" readonly --verbose cd printf readonly then local test
+	--verbose cd ${HOME} | awk readonly
+	--verbose awk "$1" x=1 grep
+'quoted text' export grep sed local sed -eu printf && -eu
+		sed sed 2>/dev/null echo && && awk then
+	${HOME} /usr/bin local /usr/bin
+	grep done $(pwd) | $(pwd) $(pwd) -eu grep "$@" && 2>/dev/null
+/usr/bin 2>/dev/null then sed printf
+$(pwd) -eu --verbose then && export echo 'quoted text' grep cd x=1 -eu then awk
+		"$1" awk "$1" grep 2>/dev/null && readonly "$@" ${HOME}
+		x=1 -eu 2>/dev/null readonly 'quoted text' done done local echo echo local &&
+-eu -eu ${HOME} $(pwd) x=1 echo echo /usr/bin --verbose test local grep
+	'quoted text' export 2>/dev/null
+		done echo cd sed ${HOME} "$@" && /usr/bin sed sed awk --verbose
+awk echo 'quoted text' cd -eu && -eu readonly | test export cd 'quoted text'
+${HOME} | $(pwd) 2>/dev/null && --verbose $(pwd) "$@" "$1" | done readonly
+readonly 2>/dev/null readonly then echo && 2>/dev/null echo local x=1 | echo
+export then && | cd then printf $(pwd) readonly 'quoted text'
+		readonly 'quoted text' readonly
+	x=1 -eu done | -eu export printf | grep /usr/bin sed
+then awk 2>/dev/null -eu export printf | /usr/bin | sed "$@" && | 2>/dev/null
+grep local then printf /usr/bin export export echo done done local $(pwd) export
+export ${HOME} readonly x=1 'quoted text' grep echo echo -eu local
+		/usr/bin ${HOME} $(pwd) grep cd export $(pwd) export 'quoted text'
+	/usr/bin echo $(pwd) cd sed && done "$@" ${HOME}
+		-eu 2>/dev/null cd awk test --verbose awk done 2>/dev/null printf |
+		&& $(pwd) x=1 readonly && "$@" sed echo /usr/bin ${HOME}
+	cd test x=1 local x=1 | x=1 -eu readonly /usr/bin 'quoted text'
+		--verbose && echo sed 'quoted text' | export sed test && -eu done
+		readonly "$@" local awk
+	printf "$1" printf /usr/bin --verbose x=1 'quoted text' echo then
+		'quoted text' local x=1
+		awk $(pwd) | "$@" 2>/dev/null 2>/dev/null sed -eu awk && "$@" 'quoted text'
+		-eu 'quoted text' then && "$@" 'quoted text' ${HOME} grep test --verbose
+	2>/dev/null && $(pwd)
+		"$1" --verbose done ${HOME}
+		-eu -eu readonly ${HOME} "$1" -eu grep printf 2>/dev/null
+		"$@" done x=1 -eu 'quoted text'
+	sed done | 2>/dev/null 2>/dev/null "$@"
+	"$1" readonly $(pwd) ${HOME} printf
+		"$@" sed ${HOME} grep x=1 readonly
+'quoted text' local done export test "$@" ${HOME} ${HOME} printf ${HOME} then readonly
+	test "$1" then grep printf "$@" awk done -eu 'quoted text'
+	| cd ${HOME} done --verbose done test $(pwd) echo 2>/dev/null
+	&& $(pwd) then && 2>/dev/null readonly local
+		cd --verbose 2>/dev/null x=1 -eu "$1" local "$1" ${HOME} printf test
+	"$@" x=1 readonly sed local test
+		sed echo "$@" grep echo --verbose --verbose
+		| readonly cd "$1" then cd $(pwd) export test printf test test grep
+| 'quoted text' done cd echo
+'quoted text' echo --verbose local test local
+	grep "$@" local 2>/dev/null echo -eu grep /usr/bin | grep
+		grep test cd export && done "$1" | awk 'quoted text'
+local sed "$1" grep readonly local -eu awk cd grep ${HOME}
+| cd 2>/dev/null then ${HOME} | done cd 'quoted text'
+printf echo && && sed "$1" x=1 'quoted text'
+2>/dev/null ${HOME} export "$@" $(pwd) --verbose x=1 2>/dev/null export | then
+local "$@" readonly done $(pwd) --verbose readonly && export
+		local /usr/bin 2>/dev/null $(pwd) x=1 "$@" echo --verbose
+	echo grep 'quoted text' done printf
+test sed export awk x=1
+	grep echo "$@" "$@" then x=1 'quoted text' --verbose 'quoted text'
+"$1" --verbose ${HOME} done readonly then test 'quoted text'
+		awk && "$1" local test done done grep cd ${HOME} $(pwd)
+	export "$@" done printf && --verbose done printf
+		&& printf /usr/bin --verbose 'quoted text' "$1" /usr/bin --verbose sed grep
+	"$1" test -eu test 2>/dev/null export -eu | echo sed && $(pwd)
+	x=1 $(pwd) done done cd echo echo sed && awk | 2>/dev/null grep x=1 echo
+x=1 ${HOME} cd ${HOME} -eu "$1" x=1 printf "$@" ${HOME} | grep done
+	"$1" 'quoted text' "$1" awk local export printf
+	then export readonly $(pwd) echo "$@" "$1" then
+	awk | && 'quoted text' 'quoted text' --verbose && echo export ${HOME}
+	${HOME} && grep /usr/bin echo &&
+		sed sed ${HOME} awk -eu export --verbose
+/usr/bin 2>/dev/null local test /usr/bin
+export sed printf 2>/dev/null ${HOME} "$@" | done printf cd $(pwd) printf then
+'quoted text' printf 2>/dev/null cd local grep -eu awk readonly grep
+	printf && 2>/dev/null /usr/bin "$@" ${HOME}
+		| printf 'quoted text' sed test $(pwd) then test | then then 2>/dev/null
+done grep printf sed x=1 grep test sed --verbose -eu local "$@" 'quoted text'
+	awk 'quoted text' && $(pwd) local -eu 2>/dev/null echo $(pwd) awk echo --verbose
+${HOME} export -eu "$@" grep done x=1
+		"$@" x=1 sed && awk x=1 done awk cd awk
+--verbose && ${HOME} 2>/dev/null ${HOME} && cd "$@"
+		'quoted text' cd 'quoted text'
+	done "$@" printf cd x=1 "$1" echo readonly awk --verbose
+		done grep done printf "$@"
+		-eu printf then "$1" 'quoted text'
+	-eu 2>/dev/null printf && sed export sed ${HOME} "$1"
+		--verbose --verbose ${HOME} ${HOME}
+	&& 'quoted text' | grep "$1"
+${HOME} awk sed cd 2>/dev/null
+cd --verbose done ${HOME}
+		local $(pwd) cd && -eu local cd echo -eu local local then then && done sed
+	/usr/bin $(pwd) local export
+"$1" --verbose 'quoted text' test | echo
+		${HOME} 'quoted text' | x=1 x=1 local
+/usr/bin 2>/dev/null grep echo "$1" $(pwd) ${HOME}
+		--verbose grep printf done grep
+local cd "$@" $(pwd) -eu sed printf done "$@" local
+		&& cd sed local && x=1 cd readonly test | done
+readonly printf "$@" | x=1 export echo
+		'quoted text' sed x=1 $(pwd) echo "$@" readonly then
+readonly echo sed ${HOME} 2>/dev/null echo /usr/bin
+	sed echo x=1 -eu /usr/bin 2>/dev/null /usr/bin -eu readonly 'quoted text' local
+		| export then "$@" && --verbose 'quoted text'
+		cd && -eu "$@" ${HOME} --verbose /usr/bin 2>/dev/null -eu echo sed awk sed ${HOME}
+	cd ${HOME} 'quoted text' readonly printf /usr/bin /usr/bin export x=1
+		readonly sed | then --verbose --verbose | grep /usr/bin
+"$@" grep && awk 2>/dev/null x=1 done -eu echo awk echo export
+		| 2>/dev/null x=1 --verbose x=1
+	sed test echo "$@" grep cd readonly | --verbose
+	-eu printf ${HOME} cd 'quoted text'
+		"$@" x=1 awk then then local printf awk cd && printf 'quoted text'
+echo x=1 x=1 | done $(pwd) grep "$@" | $(pwd) 'quoted text'
+		--verbose /usr/bin ${HOME} "$@" x=1 /usr/bin x=1 cd local local echo ${HOME}
+	printf "$1" | grep "$1" /usr/bin readonly printf sed readonly
+	&& test then export cd readonly sed ${HOME} sed awk awk && "$1" "$1" -eu readonly
+sed grep | --verbose echo
+		test done export cd | --verbose /usr/bin && && done sed then
+		/usr/bin | sed x=1 sed printf 'quoted text' cd awk readonly --verbose -eu 'quoted text'
+sed 2>/dev/null echo then echo | && local sed --verbose "$@" grep awk
+	test "$1" | export done x=1 local done sed
+--verbose $(pwd) -eu sed export
+		echo sed 'quoted text' grep done $(pwd) && awk
+		$(pwd) --verbose 'quoted text' ${HOME}
+	echo 'quoted text' done 'quoted text' readonly done /usr/bin awk x=1 grep
+awk then "$@" cd local 'quoted text' readonly -eu cd printf test "$1" sed test
+&& 'quoted text' echo sed export | done cd -eu printf done export
+		sed then "$1" awk "$@" -eu printf /usr/bin then then test cd sed
+then --verbose export done local 2>/dev/null local
+		export | sed --verbose ${HOME}
+2>/dev/null readonly sed
+/usr/bin /usr/bin ${HOME} local awk test sed "$@"
+grep awk sed readonly then then sed "$1" && 2>/dev/null export && /usr/bin
+		grep test printf readonly printf export export
+awk --verbose cd printf && sed done done done "$1"
+		sed 2>/dev/null x=1 echo /usr/bin
+	'quoted text' ${HOME} echo cd echo cd export
+	2>/dev/null readonly | 'quoted text' grep -eu readonly
+		--verbose export && && -eu then "$@" x=1 "$@" printf local -eu
+--verbose 2>/dev/null ${HOME} local && "$1" "$@" printf cd cd
+cd printf $(pwd) 2>/dev/null test
+${HOME} awk readonly awk echo "$@" x=1 local
+		done 'quoted text' -eu -eu printf && x=1 awk sed export then
+	'quoted text' x=1 x=1 readonly
+	local 2>/dev/null -eu "$@" -eu "$@"
+		$(pwd) --verbose cd && awk export
+	x=1 cd $(pwd) printf export test sed | printf
+		printf echo -eu x=1 then --verbose 'quoted text' /usr/bin 2>/dev/null
+sed | cd 'quoted text' grep local awk -eu test | readonly ${HOME} /usr/bin
+cd readonly ${HOME} export echo x=1 && /usr/bin cd -eu "$@" echo done
+		then export "$1" test "$@" | 2>/dev/null then
+		-eu readonly "$@" --verbose -eu
+	done awk -eu 'quoted text' -eu 'quoted text' sed x=1
+readonly "$1" grep -eu $(pwd) x=1 printf | $(pwd)
+		"$1" x=1 2>/dev/null "$1" && $(pwd) awk
+local test export --verbose x=1 readonly then export awk
+awk $(pwd) echo test local "$1"
+	-eu awk awk ${HOME} && x=1 cd echo 'quoted text' export local --verbose x=1
+	${HOME} export x=1 test -eu "$1" sed "$1" grep $(pwd) x=1 "$@" test cd
+	&& 'quoted text' then "$@" 'quoted text' "$@" export "$1"
+	grep ${HOME} test awk sed
+		readonly echo 'quoted text' "$@" export echo cd x=1 test 2>/dev/null
+	&& grep /usr/bin --verbose printf sed then readonly grep && -eu awk "$1" echo /usr/bin
+printf 'quoted text' local export 'quoted text' test test -eu
+		'quoted text' test grep readonly
+		echo | test "$@" "$@" done /usr/bin 2>/dev/null
+	2>/dev/null ${HOME} "$1" x=1 then test cd
+		"$1" echo then then x=1 grep | /usr/bin 'quoted text' ${HOME} 'quoted text'
+		printf printf ${HOME} --verbose
+	/usr/bin --verbose 'quoted text' local && "$1"
+grep grep ${HOME} "$1" readonly sed sed && "$1" awk readonly
+		awk "$1" $(pwd) ${HOME} --verbose | ${HOME} && && readonly done
+	| export awk -eu readonly awk 'quoted text' 2>/dev/null && -eu
+"$1" x=1 x=1 grep x=1 sed ${HOME} && | echo /usr/bin /usr/bin
+		2>/dev/null export -eu 'quoted text' test
+"$1" done local && awk export "$@" | /usr/bin cd -eu awk "$@" x=1 echo ${HOME}
+		--verbose 2>/dev/null -eu && sed
+	local test printf "$@" -eu && readonly --verbose
+$(pwd) done printf cd sed "$1" $(pwd) then && | grep /usr/bin awk
+readonly cd readonly --verbose
+	printf export printf ${HOME} sed 'quoted text' awk cd printf "$@" readonly
+echo echo "$@" "$1" | "$1" --verbose
+	cd echo export 2>/dev/null export $(pwd) && local 'quoted text' x=1
+	readonly ${HOME} 'quoted text' && sed
+	"$1" | | then grep export ${HOME} cd local done | sed -eu then printf && then
+		export x=1 "$@" "$@" export test "$@" -eu 'quoted text'
+	2>/dev/null /usr/bin 'quoted text'
+		${HOME} --verbose cd x=1 /usr/bin then then cd /usr/bin
+		local then grep done && local local echo done 'quoted text' export export done cd
+--verbose "$@" "$@" readonly echo cd export ${HOME} "$@" printf test awk 'quoted text'
+	grep cd export | cd -eu 'quoted text' readonly 2>/dev/null sed ${HOME}
+"$@" | then cd 2>/dev/null ${HOME} export x=1 grep 2>/dev/null -eu export
+export 'quoted text' | ${HOME} printf 'quoted text'
+		test "$1" 'quoted text' "$1" readonly $(pwd) "$@" "$1" "$@" "$@" echo 2>/dev/null
+		export 'quoted text' | done && --verbose
+${HOME} $(pwd) export /usr/bin grep printf
+		done 'quoted text' awk done && "$1" --verbose --verbose "$1"
+	--verbose echo printf
+		export /usr/bin local
+		then echo awk "$1" then ${HOME} $(pwd) then ${HOME} done echo
+		"$1" "$@" readonly $(pwd) -eu awk -eu && echo --verbose
+	2>/dev/null done "$@" 2>/dev/null
+then readonly grep then test done
+	done -eu done sed -eu "$1" echo
+	echo "$1" then echo /usr/bin awk -eu export 2>/dev/null
+	--verbose echo then printf cd done "$1" 2>/dev/null
+echo | --verbose $(pwd) x=1 | && test local
+grep x=1 grep --verbose -eu export x=1 sed readonly local 'quoted text' |
+		echo export awk cd /usr/bin
+printf ${HOME} 'quoted text' 'quoted text' -eu cd 'quoted text'
+		cd echo export export 2>/dev/null 2>/dev/null test $(pwd) sed "$1" readonly
+$(pwd) sed 'quoted text' echo done then && 'quoted text' test sed
+	test ${HOME} then readonly printf "$@" readonly readonly
+		&& && then echo && grep
+		/usr/bin readonly ${HOME} export ${HOME} readonly
+${HOME} then test --verbose
+sed $(pwd) done local awk printf done readonly then && cd "$@" "$@" 'quoted text'
+		export ${HOME} 'quoted text' awk export then readonly
+cd test --verbose sed awk && readonly readonly --verbose done
+	done echo cd awk --verbose readonly 2>/dev/null
+		-eu local x=1 done "$1" printf grep export "$@" echo local "$@" cd grep 2>/dev/null
+		"$1" && --verbose 2>/dev/null export readonly done
+	| -eu grep "$1" "$@" printf local test echo | then $(pwd) ${HOME}
+		/usr/bin grep -eu ${HOME} local x=1 printf done printf 'quoted text'
+		readonly && awk x=1 --verbose 'quoted text'
+	test local sed --verbose "$1" | ${HOME} $(pwd) local "$1" printf "$1"
+		--verbose cd "$@" printf test && x=1 -eu then done | grep readonly
+	grep readonly awk --verbose ${HOME} printf grep test "$@" echo "$@" ${HOME}
+	local 2>/dev/null local test x=1 | grep grep echo 'quoted text' printf
+		"$@" printf export x=1 /usr/bin sed "$@" -eu x=1 local test
+		awk $(pwd) "$1" "$@" | -eu 'quoted text' echo --verbose readonly --verbose
+	cd cd && test cd ${HOME} --verbose --verbose local readonly
+awk "$@" 'quoted text' && 2>/dev/null | export test ${HOME}
+		--verbose echo readonly printf echo export
+	readonly sed cd "$@" local --verbose local cd -eu ${HOME} awk x=1
+printf readonly readonly sed ${HOME} cd awk export echo awk && printf
+/usr/bin $(pwd) cd 'quoted text' cd 2>/dev/null
+	local test cd printf $(pwd) grep export then
+	grep | sed ${HOME} /usr/bin sed 2>/dev/null then 2>/dev/null
+--verbose x=1 $(pwd) then $(pwd) echo printf && sed grep -eu export cd cd
+sed cd /usr/bin --verbose printf cd -eu 2>/dev/null
+	export export printf ${HOME} echo sed
+	test --verbose local ${HOME} local
+	'quoted text' test 2>/dev/null grep /usr/bin grep printf
+		printf -eu "$1" export
+		/usr/bin readonly ${HOME} $(pwd)
+		cd test ${HOME} awk 'quoted text' | $(pwd) && echo | | "$@"
+		/usr/bin x=1 printf readonly local "$1"
+	2>/dev/null 'quoted text' && export -eu echo sed ${HOME} cd cd test done
+	done readonly 'quoted text' 2>/dev/null grep
+"$@" local ${HOME} cd -eu
+		grep test 'quoted text' && done test ${HOME}
+grep awk 2>/dev/null test
+		done done printf echo && -eu "$1" sed ${HOME}
+		'quoted text' | awk x=1 grep x=1 --verbose grep -eu done local then readonly export
+	test test done x=1 grep then then 2>/dev/null readonly echo
+		printf awk echo printf done "$@" export x=1 "$@" printf |
+printf sed "$1" done $(pwd) test "$@" ${HOME} ${HOME}
+2>/dev/null -eu export test grep readonly ${HOME} test | $(pwd)
+		/usr/bin 'quoted text'
+then x=1 awk -eu readonly done test awk "$1" --verbose $(pwd)
+/usr/bin ${HOME} echo -eu -eu ${HOME} done
+printf ${HOME} x=1 then test echo "$@" /usr/bin printf sed done /usr/bin
+then /usr/bin 'quoted text' local -eu grep then -eu cd test grep 'quoted text'
+		grep ${HOME} echo awk
+		test $(pwd) cd ${HOME} && --verbose awk && test
+	${HOME} ${HOME} local "$@" --verbose 2>/dev/null
+	then | $(pwd) printf echo then && 2>/dev/null -eu local sed --verbose
+		"$1" test 'quoted text' local x=1 test done
+		export ${HOME} printf -eu
+cd echo local printf && then
+	test "$@" grep -eu --verbose done "$@" printf --verbose
+readonly test "$1" "$@"
+	readonly && -eu test sed
+${HOME} local cd done "$1" --verbose
+$(pwd) "$@" cd $(pwd) grep
+2>/dev/null export 'quoted text' -eu -eu "$@" awk && $(pwd) $(pwd)
+		local "$@" -eu "$@" | "$1" echo "$@" x=1 /usr/bin done cd readonly $(pwd) -eu
+		readonly printf x=1 &&
+--verbose printf sed ${HOME} readonly done
+	--verbose test 'quoted text' readonly local export readonly "$1"
+done && 'quoted text' awk awk cd printf /usr/bin sed cd awk
+	export awk /usr/bin test x=1 awk local 'quoted text'
+	"$@" test readonly grep cd 2>/dev/null cd 2>/dev/null done local grep readonly
+		"$@" $(pwd) && x=1 readonly test done test -eu /usr/bin
+${HOME} awk --verbose readonly $(pwd) /usr/bin readonly then x=1
+done 2>/dev/null "$@" then done readonly readonly
+local local $(pwd) --verbose cd
+--verbose x=1 readonly cd test done readonly $(pwd) &&
+	export x=1 /usr/bin done
+${HOME} awk local --verbose done export /usr/bin readonly echo
+	awk sed readonly $(pwd) -eu -eu "$@" 'quoted text'
+readonly ${HOME} --verbose $(pwd) | ${HOME} --verbose test echo $(pwd) test sed
+	printf local --verbose x=1 export $(pwd) "$@" test |
+	printf /usr/bin sed "$@" && local awk 2>/dev/null --verbose
+		awk "$@" sed printf -eu ${HOME} readonly sed && printf
+		x=1 $(pwd) readonly awk 'quoted text' readonly 'quoted text' x=1 then --verbose
+	local "$@" awk | 'quoted text' grep --verbose | cd awk "$@" --verbose 2>/dev/null
+	local done printf -eu -eu "$1" && ${HOME} test export $(pwd) 'quoted text'
+		test sed echo cd local |
+x=1 x=1 && 2>/dev/null awk printf
+readonly readonly $(pwd) -eu echo printf "$1" 2>/dev/null local sed ${HOME}
+	printf sed sed && ${HOME} | cd "$1" "$1" printf
+	done | then echo awk $(pwd) | local echo | done
+	--verbose cd printf ${HOME}
+	test export "$1" test printf /usr/bin 'quoted text'
+export "$1" export -eu -eu x=1 /usr/bin && --verbose awk
+		2>/dev/null grep 'quoted text' done "$1" done then "$@"
+/usr/bin then | test ${HOME} 2>/dev/null cd /usr/bin $(pwd)
+		"$@" ${HOME} readonly --verbose sed export
+	export "$1" && /usr/bin then echo "$1" export -eu grep local readonly
+		cd "$1" readonly then local local && 'quoted text' "$@" /usr/bin $(pwd) ${HOME}
+	2>/dev/null && echo --verbose
+		readonly readonly "$1"
+	printf "$1" then --verbose cd
+		printf export "$@" test && /usr/bin local export readonly
+	echo sed --verbose export /usr/bin
+export "$@" "$1" printf /usr/bin then 2>/dev/null test then done $(pwd)
+then 'quoted text' | -eu awk x=1
+		/usr/bin awk cd sed "$1" local test
+cd /usr/bin readonly export local
+		--verbose /usr/bin -eu awk ${HOME} cd awk readonly 'quoted text' | -eu
+	x=1 grep test printf &&
+		-eu done printf 'quoted text'
+		cd "$@" -eu test --verbose /usr/bin /usr/bin $(pwd) "$@" --verbose
+"$1" grep echo "$@" awk "$1" && awk cd grep 2>/dev/null
+	x=1 then export echo | readonly then then grep test then printf
+done export "$@" cd grep "$@"
+		/usr/bin x=1 | echo --verbose -eu | && | export 2>/dev/null grep
+printf readonly | readonly -eu
+	2>/dev/null /usr/bin && awk grep /usr/bin printf 2>/dev/null x=1 2>/dev/null
+	test then "$@" echo && /usr/bin
+grep 'quoted text' export cd awk
+		sed printf export local --verbose echo x=1 test done grep test 2>/dev/null grep
+--verbose readonly echo --verbose
+	"$@" cd test done local "$@" readonly sed /usr/bin
+	x=1 $(pwd) "$@" cd -eu local --verbose
+	then && printf $(pwd) done echo 'quoted text' | cd /usr/bin then test
+	"$1" then test ${HOME} /usr/bin grep
+	--verbose --verbose done && local echo
+		readonly 2>/dev/null "$@" && ${HOME} $(pwd) printf local x=1 cd
+done grep sed x=1 2>/dev/null --verbose "$1" grep "$1" /usr/bin -eu then
+		-eu sed "$@" local export /usr/bin sed $(pwd) printf 'quoted text'
+	--verbose grep "$@" && sed export echo done 2>/dev/null
+printf x=1 awk echo 'quoted text' x=1 printf $(pwd) | ${HOME}
+	&& && cd /usr/bin 'quoted text' | && 'quoted text'
+		readonly 'quoted text' then && | done $(pwd) cd "$@" ${HOME} 2>/dev/null x=1 |
+sed /usr/bin local 2>/dev/null | then awk -eu -eu --verbose local "$@" export
+		x=1 ${HOME} test awk $(pwd) test done x=1 --verbose --verbose "$@"
+		grep grep $(pwd) x=1 /usr/bin grep local
+echo echo && test x=1 /usr/bin 2>/dev/null printf
+readonly && $(pwd) printf awk /usr/bin
+	/usr/bin $(pwd) readonly "$@" 2>/dev/null test
+grep -eu readonly /usr/bin awk sed | ${HOME} "$1" "$1" | ${HOME}
+/usr/bin -eu --verbose /usr/bin echo sed
+		| "$@" && "$1" awk -eu sed echo && test test "$1" readonly echo 'quoted text'
+"$@" export "$1" test local grep sed $(pwd) readonly
+	done printf readonly "$@" export
+	--verbose -eu "$1" export echo "$@" sed export "$1" /usr/bin
+2>/dev/null then printf export x=1 "$1" test awk x=1 'quoted text' -eu -eu
+		"$@" done ${HOME} && awk
+	sed "$@" grep -eu local then grep $(pwd) "$@" &&
+	cd done export then 'quoted text'
+		&& ${HOME} $(pwd) x=1 2>/dev/null readonly done && export 2>/dev/null
+test export -eu awk done test | 'quoted text' 2>/dev/null
+	printf printf -eu echo readonly 'quoted text'
+local done "$@" grep --verbose grep grep awk awk readonly printf
+	2>/dev/null test "$@" | printf test ${HOME}
+"$1" grep $(pwd) /usr/bin
+/usr/bin "$1" $(pwd)
+		"$@" printf "$1" /usr/bin
+		readonly printf printf test sed ${HOME} awk --verbose x=1 local
+	grep readonly cd 2>/dev/null done
+	test readonly x=1 then ${HOME} "$1" "$@" && --verbose then readonly 2>/dev/null
+	then readonly echo /usr/bin sed $(pwd) --verbose | 'quoted text'
+export "$1" local grep "$@" && cd cd -eu echo $(pwd) printf echo && readonly /usr/bin
+		'quoted text' ${HOME} done && 'quoted text' echo printf && 'quoted text'
+		awk echo /usr/bin awk 2>/dev/null "$1" echo echo ${HOME} then local "$@"
+| -eu export -eu --verbose "$@" local test then local | $(pwd) 'quoted text'
+2>/dev/null sed printf /usr/bin /usr/bin $(pwd) then x=1 export awk
+	local done x=1 done -eu
+	--verbose local | -eu printf
+printf then "$1" 'quoted text'
+awk /usr/bin ${HOME} ${HOME} test export "$@" test | printf
+awk readonly echo 2>/dev/null local
+readonly export /usr/bin | readonly awk then
+echo "$@" 2>/dev/null sed /usr/bin "$@" "$@" "$@" grep local echo ${HOME} export
+	local grep grep "$@" 2>/dev/null "$@"
+| printf awk export sed "$1" readonly
+	"$1" -eu ${HOME} "$1" | grep
+		--verbose cd --verbose sed test awk $(pwd) | && grep test cd 'quoted text'
+	-eu awk -eu "$@" | cd 'quoted text' sed x=1 export
+	echo test readonly 'quoted text' && "$1" "$1" && echo | then $(pwd) --verbose x=1
+	then grep done done export done test $(pwd) -eu awk
+		test x=1 done 2>/dev/null printf -eu sed test awk --verbose
+		/usr/bin printf awk $(pwd)
+${HOME} --verbose awk export test awk /usr/bin
+'quoted text' sed export sed export 'quoted text'
+local 2>/dev/null cd echo printf ${HOME} then -eu cd done
+'quoted text' local "$1"
+		local && "$1" | local | -eu cd sed 2>/dev/null echo ${HOME} --verbose $(pwd)
+	${HOME} ${HOME} test grep $(pwd) awk "$1" cd local readonly cd
+		local | local grep readonly "$1" && grep export grep sed $(pwd) grep readonly
+	done printf --verbose export test
+		grep && local x=1 | readonly then grep sed grep
+done awk $(pwd) then -eu && 2>/dev/null printf
+-eu x=1 ${HOME} x=1 'quoted text' x=1 grep "$1" test
+		printf printf echo awk readonly ${HOME} -eu x=1 "$@" -eu
+		-eu echo 2>/dev/null x=1 ${HOME}
+	x=1 cd "$1" done sed test test --verbose "$@" |
+export then readonly printf printf $(pwd) "$1" done cd x=1 done "$@" then
+-eu -eu ${HOME} then
+	test && printf "$1" readonly | -eu "$@" | -eu "$1" export sed
+$(pwd) test echo echo x=1 "$1" awk $(pwd) grep "$@"
+	${HOME} then "$1" sed export "$@" && done echo export readonly
+	echo $(pwd) x=1 echo 2>/dev/null --verbose test cd -eu cd then sed x=1
+	readonly 2>/dev/null readonly cd local "$@" done
+readonly test 2>/dev/null local && "$1" then printf echo $(pwd)
+		printf test 2>/dev/null "$@" /usr/bin ${HOME} x=1 $(pwd) $(pwd) /usr/bin
+| x=1 "$@" readonly awk cd ${HOME} echo 'quoted text' 'quoted text' "$1"
+	"$@" $(pwd) then test sed --verbose --verbose && | && export readonly sed |
+2>/dev/null grep awk 2>/dev/null -eu cd echo && "$@" x=1 awk cd done done -eu
+	printf 2>/dev/null awk 'quoted text' && echo /usr/bin /usr/bin export
+-eu 'quoted text' $(pwd) sed 'quoted text' --verbose
+	sed awk readonly /usr/bin printf 'quoted text'
+	-eu sed export --verbose x=1 ${HOME} 'quoted text' echo export x=1 readonly
+	test "$@" x=1 readonly echo then printf test
+	then 2>/dev/null cd test cd printf
+x=1 sed && | done cd sed test 'quoted text' "$@" local x=1 "$1" awk cd
+	export $(pwd) grep done /usr/bin sed -eu local echo "$@" "$1" grep done
+done "$1" -eu echo && | awk test export 2>/dev/null "$1" export export
+&& sed x=1 | sed "$1" readonly /usr/bin then
+	2>/dev/null printf cd sed awk printf $(pwd) ${HOME}
+${HOME} awk | --verbose && -eu cd done "$1"
+"$1" "$@" done $(pwd) local /usr/bin 'quoted text' /usr/bin cd 'quoted text'
+	-eu cd readonly && --verbose printf "$1" done "$@"
+awk --verbose "$@" done /usr/bin then |
+	echo local && cd cd 2>/dev/null
+		${HOME} echo echo "$@" -eu then printf --verbose readonly 2>/dev/null
+		&& then | --verbose then ${HOME} x=1 readonly
+sed && | then ${HOME} test $(pwd)
+		| sed 2>/dev/null 'quoted text' readonly
+printf printf "$@" /usr/bin echo test printf /usr/bin
+	--verbose readonly grep
+test test local printf done printf "$@" 'quoted text' grep sed
+		-eu cd sed | 'quoted text' echo "$@"
+'quoted text' sed echo --verbose ${HOME} sed --verbose printf
+		/usr/bin then cd | ${HOME} done cd "$1" sed "$1" ${HOME} "$@" then readonly
+-eu test sed readonly 2>/dev/null $(pwd) -eu echo then --verbose echo /usr/bin
+		&& 2>/dev/null -eu "$@" printf 2>/dev/null "$1"
+	cd done && done sed "$1"
+	x=1 "$1" && export /usr/bin awk grep cd x=1 "$1"
+		${HOME} $(pwd) test && 2>/dev/null grep x=1
+		readonly "$@" then then "$1" && ${HOME} x=1 printf && "$@" | | readonly done
+	2>/dev/null test then 2>/dev/null readonly grep export readonly | && 'quoted text'
+	cd test test export && done local && printf grep
+		x=1 then echo -eu cd test "$@" grep 2>/dev/null x=1 done echo local 'quoted text'
+	echo && "$1" | 'quoted text' /usr/bin /usr/bin
+		awk grep && then "$1" awk done
+awk local $(pwd) readonly export | && $(pwd) sed local ${HOME} $(pwd)
+		awk 'quoted text' grep done ${HOME} --verbose
+		then 2>/dev/null printf grep 2>/dev/null
+--verbose echo test readonly cd "$@" 2>/dev/null --verbose 'quoted text'
+	${HOME} ${HOME} /usr/bin "$@" local done
+"$@" /usr/bin export sed ${HOME} x=1 grep cd sed 'quoted text'
+export $(pwd) 'quoted text' done $(pwd) 2>/dev/null
+then grep then printf /usr/bin sed printf
+printf --verbose --verbose 2>/dev/null ${HOME} -eu
+	printf test | $(pwd) export awk | local "$1" readonly local "$1" 'quoted text'
+	local x=1 awk readonly export local "$@" readonly
+	x=1 ${HOME} printf test "$1"
+	"$1" x=1 echo printf $(pwd) -eu -eu ${HOME} --verbose -eu local
+--verbose export sed sed printf | export -eu
+'quoted text' readonly done "$1" --verbose ${HOME} ${HOME} sed
+		test --verbose awk cd
+| "$@" "$1" --verbose done /usr/bin -eu readonly
+&& | 'quoted text' test local echo readonly readonly echo readonly |
+/usr/bin $(pwd) echo x=1 grep
+		2>/dev/null ${HOME} "$@" "$1" echo then test | 'quoted text' ${HOME} |
+		then "$1" && awk readonly
+		2>/dev/null x=1 echo awk x=1 && x=1 export cd grep x=1
+	&& awk | test cd cd then -eu ${HOME} echo test x=1 "$1" "$1" && then
+--verbose local test /usr/bin readonly printf cd /usr/bin awk grep "$@"
+"$@" export | x=1 sed 'quoted text'
+x=1 test 'quoted text' echo
+	x=1 'quoted text' sed local awk then | printf awk readonly
+	sed awk echo done awk export x=1 sed readonly
+"$@" readonly -eu awk awk 'quoted text' printf
+	local x=1 grep && "$1" x=1 awk $(pwd)
+		awk --verbose && printf --verbose readonly
+	sed awk export awk "$@" echo "$1" then /usr/bin
+	done readonly "$1" awk "$1" "$1" "$1" ${HOME} awk cd echo echo $(pwd)
+		export -eu ${HOME} x=1 then
+		"$1" test sed local "$@" "$@" -eu local then 'quoted text' sed
+	"$@" -eu echo echo test /usr/bin "$@" ${HOME} /usr/bin awk | awk
+		then "$1" grep "$1" $(pwd) $(pwd) 'quoted text' cd | ${HOME} awk -eu
+	grep "$1" 'quoted text' printf && -eu | ${HOME} 'quoted text'
+test -eu -eu awk "$@" "$1" -eu test done && done "$1" echo grep -eu ${HOME}
+	cd awk -eu local "$1" 2>/dev/null done done 2>/dev/null done readonly --verbose
+| $(pwd) "$@" --verbose -eu done /usr/bin 'quoted text' sed cd then export
+		cd | 2>/dev/null then cd cd grep "$@" "$1" done done then cd --verbose $(pwd)
+		readonly export export test grep 2>/dev/null local
+--verbose x=1 'quoted text' grep done "$@" grep
+sed cd grep --verbose /usr/bin ${HOME} && grep then && test local --verbose done
+	test export 'quoted text' && -eu echo sed done 'quoted text' test
+-eu sed cd local sed | echo /usr/bin sed x=1 x=1 $(pwd) export awk done "$@"
+	"$1" | cd then && readonly
+	grep local /usr/bin echo export
+	x=1 | $(pwd) $(pwd) | -eu cd cd 'quoted text'
+		| 'quoted text' grep | awk "$1" cd
+		grep cd then local /usr/bin "$1" 'quoted text' readonly 'quoted text'
+/usr/bin sed /usr/bin -eu awk --verbose $(pwd) "$@" 2>/dev/null
+	&& && export grep sed cd ${HOME} then --verbose ${HOME} export
+		local printf ${HOME} test | local /usr/bin export "$@" readonly done
+		| local awk | x=1 grep -eu
+sed local cd 'quoted text' grep awk 2>/dev/null
+2>/dev/null --verbose x=1 awk /usr/bin
+test test 'quoted text' local ${HOME} awk echo /usr/bin
+	${HOME} awk | grep 'quoted text' done test x=1 readonly && echo
+		--verbose grep local "$@" then "$@"
+	cd | "$@" -eu "$@" echo ${HOME} 'quoted text' 2>/dev/null /usr/bin ${HOME} sed
+	export && 'quoted text' readonly $(pwd) local
+	-eu x=1 | sed "$@" 2>/dev/null "$1" "$1" echo x=1 test /usr/bin readonly x=1 test
+		-eu --verbose awk | local then
+"$1" echo done ${HOME} printf done ${HOME} test readonly ${HOME} sed done ${HOME}
+	--verbose printf done sed cd "$1" export x=1 sed
+		| /usr/bin readonly x=1 echo | test printf --verbose printf x=1 local printf
+	"$1" local | export $(pwd) printf export echo sed then
+		"$1" "$1" --verbose | &&
+		/usr/bin printf | then x=1 export "$@" awk "$1" grep awk local readonly $(pwd)
+2>/dev/null sed -eu readonly | cd --verbose
+$(pwd) 2>/dev/null export grep test $(pwd) 'quoted text'
+		-eu ${HOME} sed $(pwd) echo x=1
+		printf "$@" cd cd cd | 2>/dev/null "$@" printf grep
+		test "$1" awk readonly local /usr/bin echo
+		local $(pwd) ${HOME} "$1" done && x=1 grep done
+"$@" cd $(pwd) test then then printf 2>/dev/null -eu ${HOME} -eu done local
+		export | cd 2>/dev/null "$1" /usr/bin
+		export sed | $(pwd) then -eu cd awk awk local ${HOME} echo done done
+		/usr/bin 2>/dev/null echo grep
+	echo printf export "$@" export
+	local x=1 done echo | ${HOME} ${HOME} ${HOME} "$1" --verbose
+	'quoted text' test /usr/bin "$@" cd done "$@" && printf readonly ${HOME}
+	test local "$1" done x=1
+	then readonly then "$@" awk awk ${HOME} export "$@"
+		printf echo test then echo then test 'quoted text'
+	2>/dev/null -eu 2>/dev/null export x=1 ${HOME} printf sed grep "$1"
+		${HOME} --verbose echo --verbose done test "$@" | awk
+	test test printf then --verbose ${HOME}
+		$(pwd) "$@" "$1" | printf /usr/bin grep $(pwd) /usr/bin sed x=1 readonly
+	readonly -eu 'quoted text' --verbose
+| echo cd 2>/dev/null -eu --verbose
+		then -eu | $(pwd) && "$1"
+	| cd printf | echo "$@" --verbose local awk cd local -eu export echo x=1
+grep local "$@" | sed done && /usr/bin test export export test 'quoted text' x=1
+	x=1 readonly 'quoted text' "$@" local 'quoted text'
+	$(pwd) -eu ${HOME} /usr/bin x=1 --verbose $(pwd)
+printf ${HOME} "$1" /usr/bin awk --verbose 2>/dev/null |
+	cd readonly echo 'quoted text' && 'quoted text' $(pwd) cd x=1 printf
+	local $(pwd) && printf 'quoted text'
+		--verbose $(pwd) 'quoted text' export then awk local
+	2>/dev/null grep 'quoted text' "$@" awk -eu echo cd test x=1 2>/dev/null ${HOME}
+		grep x=1 && cd sed test export 'quoted text' -eu then ${HOME} local /usr/bin export
+		/usr/bin export -eu test && && x=1 echo 'quoted text'
+"$1" x=1 "$@" echo readonly ${HOME} "$@" $(pwd)
+		2>/dev/null 2>/dev/null awk cd
+	awk $(pwd) local grep ${HOME} && grep 2>/dev/null | echo test $(pwd)
+		echo echo export grep readonly 2>/dev/null
+	then local | cd printf "$1" 'quoted text' sed echo export
+		2>/dev/null export "$@" "$@" 'quoted text' readonly "$@" printf printf ${HOME}
+		sed -eu ${HOME} echo $(pwd) grep x=1 then done 'quoted text'
+printf -eu --verbose sed export 'quoted text'
+		sed -eu -eu 'quoted text' 'quoted text'
+		test printf "$1" sed done echo 'quoted text' then local readonly echo
+	| && awk test done "$@" -eu /usr/bin "$1" "$1"
+		| /usr/bin x=1 readonly | x=1 && done $(pwd) export then sed cd export test 'quoted text'
+${HOME} x=1 echo then cd "$@"
+	${HOME} awk 'quoted text' 'quoted text' -eu done cd $(pwd)
+		$(pwd) $(pwd) /usr/bin grep awk export 'quoted text' done 'quoted text'
+/usr/bin printf && test 2>/dev/null done -eu export
+		done 'quoted text' --verbose
+x=1 | -eu 'quoted text' "$@" then local printf echo 'quoted text'
+done x=1 local done "$1" readonly -eu grep sed test $(pwd) readonly ${HOME} local
+		awk local local ${HOME} test ${HOME} -eu echo test | $(pwd) done sed
+		&& /usr/bin export $(pwd) -eu awk printf done then && x=1 "$@" 'quoted text'
+		cd test local /usr/bin && "$@"
+	cd 'quoted text' 'quoted text' $(pwd) x=1 local export cd done readonly
+	'quoted text' export && | | then && sed awk && export grep x=1 | /usr/bin
+"$1" --verbose export
+		echo -eu ${HOME} then awk echo --verbose local --verbose awk "$1" local echo -eu
+	x=1 ${HOME} sed readonly | /usr/bin
+&& cd done echo test grep sed "$@" x=1
+	readonly readonly 2>/dev/null sed done | && awk x=1 && readonly 'quoted text'
+		sed grep awk echo readonly readonly 2>/dev/null | grep $(pwd) 'quoted text'
+		done $(pwd) test ${HOME} readonly && $(pwd) "$1" cd awk "$1"
+printf export --verbose -eu export local 2>/dev/null "$1" -eu 'quoted text'
+		sed "$1" "$1" $(pwd) cd cd grep done "$@" x=1 "$@" 'quoted text'
+x=1 printf test /usr/bin done && then grep | 'quoted text' printf 'quoted text'
+--verbose x=1 -eu printf "$@" | 2>/dev/null -eu local $(pwd) cd printf $(pwd) then
+		done sed $(pwd) && grep echo then grep readonly 2>/dev/null | cd 'quoted text'
+x=1 readonly /usr/bin "$1" test grep | x=1 echo ${HOME} ${HOME}
+		'quoted text' ${HOME} export awk awk echo echo 'quoted text' 'quoted text'
+--verbose sed cd printf /usr/bin sed --verbose /usr/bin -eu test ${HOME}
+	/usr/bin grep local sed done grep --verbose
+	2>/dev/null export $(pwd) sed awk
+		done x=1 | -eu sed sed then test -eu -eu ${HOME} export done local "$@" |
+		/usr/bin readonly sed awk sed /usr/bin export -eu printf /usr/bin export
+x=1 then echo "$1" done 2>/dev/null x=1 && readonly
+| done x=1 local 2>/dev/null local test sed cd printf
+	-eu cd cd local && readonly -eu
+printf --verbose awk printf sed then grep awk | | test && "$@"
+		--verbose ${HOME} ${HOME} awk echo printf x=1 awk readonly
+	printf readonly grep printf echo test
+	cd $(pwd) sed sed x=1 "$1" /usr/bin cd "$1" 2>/dev/null
+		${HOME} awk $(pwd) readonly "$@" --verbose grep
+	export local x=1 grep test echo --verbose 2>/dev/null cd local done cd 'quoted text'
+echo x=1 2>/dev/null "$1" /usr/bin
+	local -eu 2>/dev/null 2>/dev/null -eu -eu x=1 echo -eu printf /usr/bin
+		$(pwd) x=1 'quoted text' grep | awk local echo readonly
+		'quoted text' --verbose /usr/bin
+		grep awk readonly "$1" 2>/dev/null test then test done
+		"$1" 'quoted text' ${HOME} | test -eu 'quoted text' test export
+		--verbose && $(pwd) test awk echo $(pwd) test -eu ${HOME} "$1" x=1
+		| printf 'quoted text' then | echo ${HOME} awk
+	2>/dev/null test | local done export done $(pwd) export printf readonly
+--verbose ${HOME} "$@" echo grep --verbose
+$(pwd) -eu then printf readonly | test 2>/dev/null ${HOME} cd local readonly
+	| cd "$1" | | printf ${HOME} 2>/dev/null readonly 2>/dev/null
+		printf export 2>/dev/null "$@" 2>/dev/null
+		$(pwd) x=1 x=1 readonly sed /usr/bin 'quoted text' x=1 "$1" ${HOME} /usr/bin
+x=1 readonly && $(pwd) --verbose --verbose 'quoted text' "$1"
+	"$1" /usr/bin x=1 grep grep
+${HOME} test && --verbose "$@" test --verbose done $(pwd) "$@" grep sed 'quoted text'
+	"$1" x=1 readonly readonly export echo
+	/usr/bin test 2>/dev/null export
+		cd ${HOME} | export && readonly --verbose && &&
+	echo "$@" --verbose awk --verbose readonly 2>/dev/null
+readonly local readonly then echo done grep && echo x=1 awk "$1" printf readonly
+		grep $(pwd) "$1" then cd grep
+		$(pwd) -eu | awk 'quoted text' /usr/bin test | --verbose | &&
+	| "$1" test x=1 -eu "$@" | x=1 -eu /usr/bin grep local 2>/dev/null test --verbose
+	"$1" "$@" done printf export 2>/dev/null | printf export --verbose ${HOME}
+	grep ${HOME} | local -eu cd export then --verbose | && then
+'quoted text' echo export /usr/bin echo 'quoted text'
+${HOME} awk export | 'quoted text'
+		/usr/bin | local readonly awk x=1 'quoted text' done 2>/dev/null --verbose 'quoted text'
+		then export 'quoted text' export && then
+	"$1" $(pwd) "$1" $(pwd) done /usr/bin "$@" cd 2>/dev/null && ${HOME} "$1" "$@"
+awk sed awk "$1" test local test "$@"
+		| x=1 --verbose cd /usr/bin 2>/dev/null && 2>/dev/null sed $(pwd) echo "$@" 'quoted text'
+		readonly printf awk awk /usr/bin then "$1" "$1" cd cd export -eu cd readonly
+$(pwd) printf "$@" readonly sed
+	| && /usr/bin | 2>/dev/null "$1" /usr/bin /usr/bin sed echo cd cd "$1" grep printf
+	$(pwd) $(pwd) grep grep cd cd echo cd x=1 readonly
+"$@" awk 2>/dev/null done awk printf
+		readonly local then then --verbose echo /usr/bin
+	"$@" cd test ${HOME}
+		'quoted text' x=1 sed 2>/dev/null -eu local awk | "$@" printf then local
+		2>/dev/null sed ${HOME} && 2>/dev/null
+${HOME} x=1 grep -eu /usr/bin
+	cd "$@" local done x=1 "$1" 2>/dev/null $(pwd) cd && $(pwd) "$@" -eu $(pwd)
+	x=1 test readonly $(pwd) done && local readonly printf "$@" 2>/dev/null -eu "$1"
@@ -0,0 +1,2001 @@
+test $(pwd) printf ${HOME} printf 'quoted text' "$@"
+	readonly local 2>/dev/null /usr/bin cd grep then readonly -eu | ${HOME}
+		| local echo $(pwd) awk
+		sed sed 'quoted text' $(pwd) "$1" --verbose
+	local x=1 export printf readonly printf test ${HOME} echo then export sed 'quoted text'
+done cd printf grep --verbose
+		"$@" awk /usr/bin x=1 cd cd x=1 ${HOME}
+		readonly readonly cd local /usr/bin done grep done awk grep $(pwd)
+	-eu | done && 2>/dev/null printf export -eu x=1 ${HOME} | $(pwd) -eu
+-eu done && /usr/bin export then then local test echo "$@" | awk --verbose
+		| test | sed export "$@" --verbose
+		/usr/bin cd echo --verbose export
+		-eu then done awk echo 2>/dev/null
+		&& ${HOME} test $(pwd) echo grep readonly awk local && echo echo
+	${HOME} cd grep then --verbose
+	export 2>/dev/null 'quoted text' local $(pwd) | local "$1" then local
+	local x=1 ${HOME} then 2>/dev/null x=1 -eu "$1" grep && sed
+	export readonly grep grep then | cd done then printf cd echo sed ${HOME} export
+		sed x=1 echo test $(pwd) local sed x=1 local ${HOME} 2>/dev/null
+	awk 'quoted text' sed readonly --verbose readonly $(pwd) $(pwd) |
+		x=1 grep readonly /usr/bin done export ${HOME} test local done x=1 local sed
+done awk awk && 2>/dev/null | local sed echo printf then awk $(pwd) echo test
+	2>/dev/null export awk "$1" readonly done ${HOME} grep ${HOME} --verbose /usr/bin
+--verbose echo grep /usr/bin grep
+--verbose | grep 'quoted text' $(pwd) /usr/bin test cd echo readonly
+		echo local cd grep done 2>/dev/null
+	'quoted text' grep cd -eu awk
+	then export 'quoted text' done | x=1 then 'quoted text'
+local done then printf
+printf sed "$@" /usr/bin awk ${HOME} test /usr/bin readonly grep local
+	cd ${HOME} echo awk awk export ${HOME} --verbose export then sed
+	grep grep export printf ${HOME} "$1" ${HOME} /usr/bin
+		/usr/bin ${HOME} 2>/dev/null done cd readonly export
+		local sed 'quoted text' readonly | "$1" echo
+		export "$1" && grep && x=1 -eu done grep
+test cd echo "$@" -eu /usr/bin readonly
+$(pwd) awk done local 'quoted text' $(pwd) grep local echo --verbose
+	local awk export x=1 then
+		$(pwd) | sed sed && echo
+--verbose then && echo --verbose local --verbose cd cd x=1 --verbose local "$@"
+	--verbose x=1 'quoted text' local ${HOME} 'quoted text'
+	"$@" test test /usr/bin | -eu $(pwd) -eu 2>/dev/null awk local /usr/bin /usr/bin
+test done $(pwd) cd awk && -eu "$@" grep
+echo --verbose "$1" x=1 sed "$@" test --verbose local /usr/bin printf local
+$(pwd) x=1 2>/dev/null cd "$@" echo && -eu then $(pwd)
+		awk "$@" "$@" export local -eu printf
+		| x=1 'quoted text' --verbose 'quoted text' then grep done $(pwd) 'quoted text'
+${HOME} awk "$@" --verbose 'quoted text' "$1" grep test $(pwd)
+	'quoted text' export export | then /usr/bin export "$@" sed "$@" x=1
+	| "$@" printf done /usr/bin
+		test readonly 'quoted text' cd then local $(pwd) echo cd | readonly --verbose
+printf ${HOME} "$1" printf
+"$@" && awk then | sed then local ${HOME} /usr/bin test readonly
+	cd then ${HOME} -eu echo "$@" 'quoted text' cd --verbose
+done sed && x=1 readonly "$1" x=1 "$1" cd 2>/dev/null
+	${HOME} 2>/dev/null | /usr/bin readonly
+		/usr/bin x=1 done local awk 2>/dev/null readonly echo local printf
+local printf done grep --verbose readonly $(pwd) grep x=1
+		${HOME} && then echo x=1 echo x=1 local grep cd local cd x=1 $(pwd)
+-eu echo | awk /usr/bin test -eu then -eu "$1" /usr/bin
+		x=1 $(pwd) done "$1" export readonly
+		test export | awk -eu -eu cd readonly awk echo awk echo
+"$1" $(pwd) local test test "$1"
+'quoted text' awk x=1 printf echo x=1 'quoted text' /usr/bin "$@" then echo
+echo --verbose ${HOME} sed readonly cd
+	readonly x=1 readonly /usr/bin then x=1 export x=1
+		-eu sed $(pwd) | "$@" $(pwd) --verbose done --verbose | done
+	sed cd local | && cd printf 'quoted text'
+&& x=1 2>/dev/null && && 'quoted text' $(pwd)
+--verbose -eu readonly test x=1 "$@" test x=1 /usr/bin 2>/dev/null readonly readonly
+${HOME} test | cd test "$1" --verbose test | printf printf --verbose
+		readonly "$@" "$1" done && -eu printf 2>/dev/null cd test
+&& "$1" grep cd /usr/bin x=1 awk 'quoted text' "$@" x=1 "$1" |
+		2>/dev/null sed $(pwd)
+		"$1" -eu && printf readonly done ${HOME}
+printf 'quoted text'
+-eu readonly /usr/bin ${HOME} x=1
+		2>/dev/null test readonly 2>/dev/null
+cd readonly x=1 readonly sed ${HOME} 'quoted text' then --verbose
+		readonly export && local --verbose sed sed readonly awk 2>/dev/null awk -eu test
+	2>/dev/null $(pwd) then "$@" "$1" 2>/dev/null "$1" && && 'quoted text'
+		printf export done x=1 | && 'quoted text'
+then /usr/bin echo "$@" sed echo awk
+	done && "$@" readonly echo grep test printf | printf /usr/bin readonly
+		'quoted text' done then 'quoted text' "$1" sed export 2>/dev/null
+		readonly -eu -eu local printf echo x=1 ${HOME} "$@"
+		"$@" export "$@" $(pwd) export
+		"$1" x=1 2>/dev/null x=1 "$@" done awk && test $(pwd) | cd done "$1" && "$1"
+	printf && grep done /usr/bin | && sed && cd 'quoted text' "$1" x=1 test | x=1
+		"$1" /usr/bin | | && awk cd done done -eu sed x=1
+		awk --verbose then --verbose sed x=1 local readonly test
+	test export x=1 done --verbose grep printf && $(pwd) echo x=1 awk "$@" then -eu
+awk && -eu done /usr/bin echo
+echo 'quoted text' export
+	test local printf "$1"
+	cd grep --verbose -eu "$1" sed | | printf && readonly test /usr/bin
+--verbose 2>/dev/null readonly
+&& grep grep grep "$1" /usr/bin "$1" test x=1 then
+	cd 'quoted text' -eu awk -eu sed && done
+$(pwd) && --verbose sed cd 2>/dev/null readonly
+		2>/dev/null --verbose "$1" /usr/bin then readonly export --verbose
+readonly local ${HOME} | ${HOME} "$1" cd $(pwd) awk local "$@" done ${HOME}
+export printf sed && readonly echo grep grep $(pwd) --verbose -eu export
+		echo test "$@" /usr/bin
+	awk test 2>/dev/null cd
+		"$1" --verbose local $(pwd) --verbose "$1"
+		grep export 2>/dev/null | awk sed readonly
+		2>/dev/null cd awk $(pwd) | "$@" awk | && /usr/bin
+--verbose sed grep printf local readonly 'quoted text' /usr/bin
+	echo printf echo awk echo
+$(pwd) readonly cd grep printf 'quoted text' | echo done /usr/bin
+		local then done /usr/bin "$@" awk --verbose done x=1 awk awk
+		local printf readonly export "$@"
+echo | ${HOME} -eu |
+done printf $(pwd) --verbose cd test grep x=1
+		sed printf 'quoted text' readonly x=1 grep $(pwd) then sed 'quoted text' awk
+grep && "$@" "$1" grep cd test "$1"
+		&& -eu 'quoted text' done x=1 then x=1 export | grep
+cd --verbose printf echo readonly test
+		"$@" 2>/dev/null $(pwd) done
+	cd sed 2>/dev/null 'quoted text' x=1 $(pwd) /usr/bin
+		$(pwd) then local && echo 'quoted text' then grep printf ${HOME} grep
+"$@" | grep test printf /usr/bin then test $(pwd) done /usr/bin
+		cd test readonly | grep /usr/bin then ${HOME} sed readonly /usr/bin
+		cd 2>/dev/null local -eu --verbose 2>/dev/null cd "$@" echo /usr/bin
+export -eu ${HOME} ${HOME} sed then /usr/bin readonly then
+		cd done awk awk test 2>/dev/null | cd sed done ${HOME} done
+| ${HOME} done 'quoted text' $(pwd) echo test /usr/bin export
+		local then | echo local
+	printf $(pwd) "$1" sed local ${HOME} 'quoted text' && /usr/bin done printf /usr/bin
+'quoted text' -eu x=1 && cd $(pwd) local 'quoted text' 'quoted text' "$@"
+-eu awk --verbose | |
+	grep ${HOME} x=1 -eu grep -eu && export "$1" readonly grep
+		test grep ${HOME} done x=1
+$(pwd) sed ${HOME} then awk readonly ${HOME} echo export cd awk local cd
+		export "$@" "$1" 'quoted text' --verbose export local done $(pwd) grep
+${HOME} grep ${HOME} /usr/bin && readonly done export
+		grep --verbose "$1" export sed readonly
+		readonly | | $(pwd) echo | /usr/bin readonly printf test test -eu | 2>/dev/null
+${HOME} printf readonly "$1" cd cd cd x=1 --verbose
+	local export awk "$1" cd "$1" ${HOME} awk 2>/dev/null -eu sed
+sed test && cd /usr/bin sed test 2>/dev/null "$1" 2>/dev/null && sed |
+	&& grep sed "$@" printf 2>/dev/null --verbose
+"$@" grep cd -eu x=1 cd -eu readonly echo grep 'quoted text' printf --verbose
+		grep ${HOME} done cd local export $(pwd) && 'quoted text' printf ${HOME}
+readonly echo done 2>/dev/null
+	done -eu awk "$@" x=1 readonly "$@" echo ${HOME} 2>/dev/null sed ${HOME}
+		cd ${HOME} ${HOME} local $(pwd) "$1" local $(pwd) -eu readonly 'quoted text'
+export readonly test grep awk 'quoted text' cd "$1" | awk cd printf sed export
+'quoted text' --verbose printf printf
+	--verbose $(pwd) "$1" cd | && export then grep
+	printf echo local 2>/dev/null printf local
+done readonly | | grep | "$@" grep
+		sed local -eu "$@" x=1 2>/dev/null cd 'quoted text' ${HOME} | export awk then done
+	'quoted text' echo readonly done "$1" grep printf "$@" /usr/bin
+	&& --verbose /usr/bin -eu sed | printf "$1" done local -eu -eu x=1 export && x=1
+	&& "$1" export printf test cd export
+		2>/dev/null readonly x=1 printf echo grep readonly "$@" awk done cd "$1"
+	sed "$@" "$1" sed "$@" | | /usr/bin
+	${HOME} printf "$@" echo export done grep "$@" -eu grep --verbose sed 'quoted text'
+		test sed x=1 readonly done $(pwd)
+	${HOME} --verbose "$1" echo
+done --verbose done cd done awk && ${HOME} awk echo echo --verbose
+&& | ${HOME} /usr/bin test echo awk -eu "$@" /usr/bin x=1 local done -eu
+x=1 "$1" test "$@" grep readonly x=1 done sed awk
+		sed 2>/dev/null "$1" "$1" done --verbose echo test done x=1 | x=1 printf x=1
+		cd export grep -eu ${HOME} grep "$@"
+	awk -eu test readonly sed cd awk $(pwd) local done local
+		sed then /usr/bin local /usr/bin done cd -eu /usr/bin
+		x=1 test cd grep export "$1" "$@"
+	grep printf 'quoted text' x=1 awk x=1 awk readonly $(pwd) local
+		export then done test export -eu
+		'quoted text' "$1" done $(pwd) echo "$1" x=1 -eu | 2>/dev/null echo local -eu
+cd test then test /usr/bin test
+	printf cd --verbose sed x=1 ${HOME}
+	printf && $(pwd) "$1" local -eu -eu
+--verbose echo /usr/bin test grep /usr/bin test $(pwd) ${HOME} 2>/dev/null
+	done echo then $(pwd) x=1 printf 2>/dev/null awk test
+	test export awk readonly done then 2>/dev/null grep printf cd x=1 cd echo cd --verbose
+	then "$1" cd "$1" 'quoted text' x=1 | readonly -eu local then printf test done
+	local cd echo x=1 --verbose
+		"$1" -eu awk echo --verbose /usr/bin export $(pwd) done test --verbose
+	/usr/bin local grep grep $(pwd) cd $(pwd) test
+		echo "$@" | cd $(pwd) test
+		'quoted text' grep test readonly && --verbose printf ${HOME} --verbose ${HOME}
+printf | done && --verbose ${HOME} /usr/bin &&
+	x=1 "$1" --verbose readonly $(pwd) grep /usr/bin printf $(pwd) printf
+"$@" 'quoted text' then
+x=1 grep /usr/bin local test /usr/bin printf
+		--verbose then done test ${HOME} done --verbose printf
+	test echo awk $(pwd) printf "$1" $(pwd) 'quoted text'
+2>/dev/null 2>/dev/null
+		local "$@" done "$1" ${HOME} then sed $(pwd)
+		awk readonly --verbose printf awk cd 'quoted text'
+		$(pwd) done | sed $(pwd) x=1 local
+		printf readonly cd test done x=1 sed | sed echo x=1 test | | 'quoted text'
+	awk 2>/dev/null cd /usr/bin "$1" cd awk $(pwd) 'quoted text' readonly --verbose
+"$@" /usr/bin "$1" printf done x=1 -eu grep done readonly printf
+		cd test 'quoted text' readonly
+	cd $(pwd) done --verbose cd
+		| cd && 'quoted text' "$@" local grep --verbose local done
+		cd ${HOME} --verbose && awk 2>/dev/null /usr/bin ${HOME} $(pwd) &&
+		then printf grep -eu && sed printf then then printf "$1" $(pwd)
+		'quoted text' x=1 --verbose grep done printf $(pwd) local x=1 awk
+	awk awk grep 'quoted text' x=1
+		$(pwd) /usr/bin -eu -eu export done
+	printf | printf sed && /usr/bin
+"$1" printf grep test x=1 --verbose 'quoted text'
+| echo --verbose $(pwd) | ${HOME} printf --verbose 2>/dev/null
+		test ${HOME} done -eu printf -eu grep "$1" export
+	sed echo 'quoted text' -eu printf -eu -eu
+		grep readonly | done x=1 ${HOME} echo "$@"
+	2>/dev/null grep 'quoted text'
+| /usr/bin -eu echo | readonly
+--verbose printf grep ${HOME} sed "$1" ${HOME} 2>/dev/null
+cd /usr/bin sed --verbose $(pwd) 2>/dev/null grep 2>/dev/null
+		| "$1" $(pwd) -eu grep test ${HOME} | sed --verbose && printf "$1" local
+		-eu then && grep then 2>/dev/null 2>/dev/null echo export
+${HOME} /usr/bin x=1 sed --verbose done --verbose sed -eu cd --verbose done
+		&& grep local --verbose /usr/bin && x=1 printf |
+printf printf awk echo grep sed then --verbose
+"$1" awk --verbose 'quoted text' && | "$1" "$@" cd "$@"
+		'quoted text' printf sed && /usr/bin echo "$1" done grep cd /usr/bin
+	printf test $(pwd) x=1 | test && && x=1 $(pwd) cd 2>/dev/null readonly
+		test | echo --verbose "$1" grep -eu cd ${HOME} sed
+		awk | local "$1" grep awk --verbose export
+		"$@" x=1 then "$@" x=1 awk
+export "$1" x=1 awk sed 2>/dev/null export
+		export ${HOME} local then 2>/dev/null "$@" 2>/dev/null ${HOME}
+		test echo -eu test export then "$1" grep test && export echo | "$1" readonly
+		echo cd x=1 | -eu sed && | "$@" /usr/bin --verbose "$1" | test
+	| --verbose sed sed cd | test grep export sed then echo
+test export sed cd -eu test
+		echo $(pwd) grep echo awk sed /usr/bin sed 'quoted text' echo | local local readonly
+"$@" echo -eu echo sed sed grep sed cd "$1" /usr/bin $(pwd)
+cd cd echo 'quoted text' | /usr/bin done test export grep sed
+local awk local echo x=1 then cd
+local sed /usr/bin -eu cd
+	echo "$1" 'quoted text' done
+awk sed | test "$@" "$@"
+	$(pwd) --verbose | sed /usr/bin 2>/dev/null "$@" local echo then printf
+	/usr/bin echo cd printf grep --verbose
+		'quoted text' then "$@" /usr/bin /usr/bin then "$@" 2>/dev/null
+2>/dev/null ${HOME} --verbose $(pwd) done readonly
+local $(pwd) x=1 $(pwd) ${HOME} test done $(pwd) test && | x=1 printf
+	2>/dev/null cd awk printf && $(pwd) done && | export awk /usr/bin test "$@" --verbose
+	x=1 "$1" awk 'quoted text' "$@"
+	/usr/bin /usr/bin cd awk
+	local | $(pwd) test 2>/dev/null 2>/dev/null "$1" printf echo
+	echo sed printf x=1 done -eu x=1 $(pwd)
+"$@" sed $(pwd) -eu 2>/dev/null
+	local printf test ${HOME} && -eu cd awk $(pwd) && 2>/dev/null echo test
+x=1 test | export && | done cd -eu local 2>/dev/null "$1" x=1 -eu /usr/bin
+		"$@" --verbose awk "$@" readonly -eu printf sed echo sed 'quoted text'
+	then awk --verbose 'quoted text' ${HOME} printf x=1 grep
+echo "$@" /usr/bin then ${HOME} awk done | "$@" echo printf test | printf
+${HOME} 2>/dev/null "$@" sed 'quoted text' done 2>/dev/null $(pwd) done echo
+--verbose $(pwd) && test "$@" --verbose
+		echo | grep 2>/dev/null /usr/bin "$@" -eu ${HOME} awk
+		&& sed "$@" printf readonly "$@" done /usr/bin sed
+		2>/dev/null test 'quoted text' test ${HOME} x=1 local done --verbose -eu local
+cd 'quoted text' -eu /usr/bin test
+		$(pwd) grep done awk ${HOME} echo -eu
+	-eu local done awk readonly cd then /usr/bin 2>/dev/null export "$@"
+	readonly awk echo 'quoted text' printf 2>/dev/null
+${HOME} x=1 done echo local "$1" /usr/bin
+		x=1 then -eu && local cd --verbose
+--verbose $(pwd) "$@" "$@" echo ${HOME} sed cd readonly
+	${HOME} printf local cd grep 'quoted text' grep printf "$@" export export
+done cd "$1" x=1 -eu -eu /usr/bin --verbose ${HOME} grep test test done /usr/bin
+	readonly -eu awk 2>/dev/null 'quoted text' "$@" 2>/dev/null | awk
+	--verbose printf then -eu done awk "$@" && /usr/bin printf echo
+$(pwd) && "$1" grep --verbose 2>/dev/null echo grep 'quoted text'
+		/usr/bin "$@" | | done /usr/bin grep 2>/dev/null done | 'quoted text'
+		printf 2>/dev/null readonly && -eu
+		test | awk "$@" ${HOME} export export
+		--verbose local && export 2>/dev/null readonly
+	&& printf sed "$1" local x=1 local echo test /usr/bin
+'quoted text' --verbose sed
+		| sed printf then --verbose /usr/bin sed then local then
+x=1 awk ${HOME} "$@" 'quoted text' grep export /usr/bin $(pwd)
+cd && readonly 2>/dev/null test sed 'quoted text' $(pwd) 'quoted text' x=1 cd done
+sed test "$@" sed "$@" 'quoted text'
+		export cd local sed grep ${HOME} readonly sed awk cd
+		2>/dev/null "$@" x=1 2>/dev/null
+| test ${HOME} readonly /usr/bin | x=1 | cd 2>/dev/null --verbose $(pwd)
+		"$@" "$@" x=1 printf test 'quoted text' export ${HOME} readonly | "$@" printf
+	then && 'quoted text' echo --verbose
+2>/dev/null then sed $(pwd)
+sed export readonly echo "$1" x=1 "$1" export readonly done sed
+	local 2>/dev/null /usr/bin | x=1 && && grep
+	x=1 "$@" then grep cd export "$@" "$@" done
+		"$@" test "$@" $(pwd) readonly | $(pwd) && 2>/dev/null
+/usr/bin export -eu | ${HOME}
+		readonly done test printf ${HOME} -eu local grep
+		--verbose /usr/bin cd readonly | ${HOME} awk ${HOME}
+		${HOME} /usr/bin "$@" then local local awk export -eu
+		test "$@" local cd 2>/dev/null printf local test awk 'quoted text'
+	${HOME} cd "$@" sed | "$@" sed /usr/bin
+		then awk $(pwd) x=1 then awk ${HOME} -eu /usr/bin done
+local "$@" local test x=1 awk --verbose then readonly printf 2>/dev/null
+'quoted text' /usr/bin readonly grep readonly && cd 'quoted text' sed ${HOME}
+-eu echo echo "$@" "$1" echo ${HOME}
+grep --verbose printf -eu readonly export
+		grep done 2>/dev/null /usr/bin | cd 'quoted text' test export 2>/dev/null
+cd export "$@" | local done x=1 /usr/bin cd local grep printf
+		x=1 sed cd | local local && 2>/dev/null "$1" --verbose && export
+		then $(pwd) done awk "$1" grep 'quoted text'
+	$(pwd) readonly --verbose && && then --verbose
+x=1 "$1" 'quoted text' awk echo cd grep awk -eu "$@" awk
+		$(pwd) --verbose printf
+	local grep -eu | readonly echo
+		readonly --verbose && readonly local awk && 'quoted text' x=1 awk ${HOME} x=1 |
+	-eu cd export then done local "$@" local local printf test ${HOME}
+		'quoted text' local done export export "$1" grep
+	2>/dev/null /usr/bin done local done grep /usr/bin ${HOME}
+then --verbose "$1" 'quoted text' --verbose then awk 2>/dev/null &&
+	test sed /usr/bin sed --verbose "$@" then
+		"$@" -eu --verbose grep "$@" test --verbose /usr/bin echo 'quoted text'
+	| --verbose then done test done local
+printf $(pwd) done x=1 echo cd | sed test ${HOME} then $(pwd)
+		test readonly "$1" "$1" | $(pwd) readonly -eu awk then $(pwd)
+		"$@" x=1 && $(pwd) $(pwd) /usr/bin sed "$@" $(pwd) grep --verbose
+		printf 2>/dev/null then export
+grep readonly echo export cd awk test "$@" done grep
+	"$1" export test test 'quoted text' "$1"
+grep cd "$1" 2>/dev/null printf readonly awk test "$@" $(pwd) echo done
+--verbose 'quoted text' cd /usr/bin printf done -eu test done
+	local | readonly printf readonly -eu export done x=1 "$1" "$1"
+grep export local export 2>/dev/null -eu ${HOME} ${HOME} 'quoted text'
+--verbose echo export /usr/bin -eu local done && awk "$@" cd ${HOME} done ${HOME}
+	--verbose 'quoted text' then $(pwd) grep then 2>/dev/null
+${HOME} "$@" readonly 2>/dev/null
+	grep test then cd --verbose /usr/bin x=1 test
+		local done cd then --verbose -eu then awk $(pwd) export
+		"$1" cd -eu grep export $(pwd) export --verbose done readonly
+		$(pwd) test -eu cd &&
+	--verbose export --verbose "$@" "$1" local
+	export x=1 --verbose ${HOME} echo
+		/usr/bin 2>/dev/null "$1"
+| 'quoted text' --verbose
+	sed grep -eu sed ${HOME} grep | x=1
+$(pwd) done 2>/dev/null local --verbose $(pwd)
+	| grep test grep 2>/dev/null awk && echo "$@" sed "$1" readonly $(pwd)
+echo | test sed "$@" then then awk export export 'quoted text' grep readonly
+	sed awk done --verbose sed $(pwd) "$1" ${HOME} export cd grep
+		echo ${HOME} 2>/dev/null printf done 2>/dev/null readonly $(pwd) then
+		x=1 "$@" cd cd 2>/dev/null printf | x=1 export export
+2>/dev/null printf done local sed then then 'quoted text' ${HOME} $(pwd)
+x=1 ${HOME} cd export cd ${HOME} grep 'quoted text' awk printf then grep "$1"
+	echo printf done readonly then --verbose sed then && test
+	/usr/bin 2>/dev/null grep x=1 /usr/bin
+		--verbose $(pwd) $(pwd) | x=1 2>/dev/null 2>/dev/null export | done local /usr/bin
+	x=1 2>/dev/null | 'quoted text'
+local local "$@" -eu local echo readonly -eu 2>/dev/null -eu done
+	awk export readonly x=1 readonly --verbose
+	2>/dev/null grep test
+		'quoted text' 2>/dev/null then grep local
+		local then sed then x=1 awk "$@" "$1" /usr/bin then
+	done cd awk awk 2>/dev/null --verbose "$1" /usr/bin 2>/dev/null 'quoted text'
+		grep --verbose grep | readonly
+	test x=1 echo done 2>/dev/null ${HOME} ${HOME} grep | "$@" test -eu then $(pwd)
+		then local && cd test then readonly then
+	test cd sed grep | echo ${HOME} --verbose ${HOME}
+${HOME} $(pwd) printf printf sed -eu 'quoted text' -eu
+	x=1 | "$1" ${HOME} readonly grep export --verbose done then
+		&& local $(pwd) local "$@" printf sed cd local && sed done sed then echo
+	'quoted text' then printf grep "$1" sed --verbose
+	echo 2>/dev/null | 2>/dev/null | | --verbose grep $(pwd) grep x=1 sed
+	${HOME} printf cd /usr/bin echo 2>/dev/null
+		&& grep 2>/dev/null export then then local then cd sed ${HOME} x=1 | awk
+		readonly 'quoted text' done x=1 "$@"
+	echo test printf grep done $(pwd) --verbose
+		"$1" awk 2>/dev/null && 2>/dev/null
+		--verbose | && awk echo then && ${HOME} x=1 ${HOME}
+printf && "$1" "$1" echo "$1" "$1" local sed test
+		then $(pwd) ${HOME} -eu x=1 |
+		&& -eu cd readonly /usr/bin ${HOME} -eu --verbose
+readonly then 2>/dev/null -eu $(pwd) --verbose "$@" /usr/bin "$1" $(pwd)
+"$1" test echo local $(pwd) printf 'quoted text'
+done then ${HOME} printf echo x=1 export sed && sed && 'quoted text' 2>/dev/null
+awk ${HOME} cd then grep printf "$@" done x=1
+	"$@" --verbose grep "$1" test awk cd grep && ${HOME} done
+"$1" echo echo then 2>/dev/null local grep "$@"
+		local local readonly "$@" cd local /usr/bin && 2>/dev/null
+	readonly 2>/dev/null -eu x=1 then test sed
+	/usr/bin "$1" echo --verbose x=1 ${HOME} echo 'quoted text' && export
+	$(pwd) echo done local grep $(pwd) 'quoted text' --verbose
+	--verbose awk "$@" test sed local -eu --verbose sed export
+${HOME} awk | -eu x=1 readonly grep ${HOME} "$@"
+'quoted text' "$@" x=1 test local 'quoted text' sed "$@" 2>/dev/null | echo
+"$1" --verbose 'quoted text' 2>/dev/null printf -eu "$@" -eu
+done | export 2>/dev/null --verbose awk export
+	--verbose export grep 2>/dev/null test grep echo -eu | /usr/bin
+	2>/dev/null export x=1 /usr/bin 'quoted text' 'quoted text' x=1
+then sed 'quoted text' sed grep readonly local
+local sed export "$1" /usr/bin && $(pwd) grep then /usr/bin
+echo $(pwd) done 'quoted text'
+	"$@" /usr/bin test $(pwd) 'quoted text' echo x=1 --verbose $(pwd) cd done echo "$@"
+	done -eu readonly grep $(pwd) sed sed echo /usr/bin sed 2>/dev/null --verbose --verbose
+	done $(pwd) -eu | "$@" && | | $(pwd) "$@" export cd $(pwd) "$1"
+	$(pwd) awk done 'quoted text'
+	--verbose 'quoted text' ${HOME} local && local grep
+local x=1 /usr/bin && "$@" test grep local done export |
+		printf awk /usr/bin cd then echo
+		cd test --verbose -eu --verbose export "$@" local
+		'quoted text' ${HOME} local
+		awk x=1 printf && echo --verbose --verbose export
+		$(pwd) x=1 test awk readonly $(pwd) echo $(pwd) done --verbose 'quoted text'
+	| "$@" test ${HOME} then -eu x=1
+		then 'quoted text' done echo local export printf grep local printf
+		&& grep 2>/dev/null /usr/bin grep /usr/bin 2>/dev/null
+	awk && -eu readonly awk --verbose $(pwd) 'quoted text' export
+		grep 'quoted text' cd | awk then export
+		cd readonly ${HOME} -eu awk cd && grep "$@"
+		awk printf cd ${HOME} "$@" ${HOME} cd then && sed readonly
+readonly awk cd readonly --verbose sed --verbose --verbose
+		&& local ${HOME} -eu done sed export test "$1"
+		&& sed --verbose && -eu readonly ${HOME} --verbose 2>/dev/null done
+		-eu $(pwd) grep readonly | -eu "$@" | awk test ${HOME} export sed export
+		readonly "$1" ${HOME} export && readonly
+		&& 'quoted text' | ${HOME} --verbose
+grep sed x=1 readonly /usr/bin && readonly cd 2>/dev/null
+echo printf grep x=1 2>/dev/null then "$@" "$@" -eu awk -eu ${HOME} done local
+2>/dev/null -eu --verbose $(pwd)
+	test 'quoted text' awk 2>/dev/null ${HOME} done x=1 local echo
+	echo sed "$@" "$1" x=1 2>/dev/null 2>/dev/null ${HOME} 2>/dev/null
+/usr/bin && then cd then 'quoted text' /usr/bin local
+	2>/dev/null "$@" awk /usr/bin $(pwd) "$1" readonly echo
+		"$1" printf done --verbose && sed printf "$1" grep $(pwd)
+		&& echo "$1" x=1 "$1" "$1" 'quoted text' readonly ${HOME} | ${HOME} $(pwd) "$1"
+	printf local | cd && /usr/bin 2>/dev/null x=1 then readonly
+$(pwd) --verbose cd | done readonly awk -eu "$@" grep printf --verbose
+		$(pwd) 2>/dev/null export grep
+	test "$1" grep && "$@" export then sed sed readonly grep local x=1 then
+		--verbose ${HOME} ${HOME}
+	$(pwd) then 2>/dev/null echo export export then cd echo
+	2>/dev/null && grep "$@" grep && 2>/dev/null
+		printf done -eu --verbose printf "$1" cd export --verbose grep grep grep test printf
+		done done sed test 2>/dev/null x=1 local -eu -eu ${HOME}
+		${HOME} readonly printf
+	done local test "$1" cd 2>/dev/null
+	2>/dev/null done then sed /usr/bin sed grep -eu awk printf && 2>/dev/null test 'quoted text'
+		test sed -eu && "$1" printf
+	echo export cd "$@" $(pwd)
+	| "$1" /usr/bin test then 2>/dev/null readonly done /usr/bin then
+	grep 2>/dev/null cd awk readonly grep sed && 'quoted text' cd
+		$(pwd) cd echo done /usr/bin "$@" 2>/dev/null
+"$1" 2>/dev/null printf x=1 echo
+x=1 -eu x=1 export grep ${HOME} /usr/bin done grep | export /usr/bin
+	test && local awk export local x=1 --verbose awk test $(pwd) $(pwd) "$1"
+		sed 'quoted text' export done readonly x=1 awk readonly --verbose "$1" ${HOME}
+	sed /usr/bin then 2>/dev/null 2>/dev/null printf local 2>/dev/null ${HOME} echo
+grep awk sed then readonly "$1" && cd | --verbose | awk grep
+	cd done $(pwd) done -eu grep awk sed awk
+		"$@" "$@" 2>/dev/null cd "$@" local
+	/usr/bin --verbose ${HOME}
+		/usr/bin local then test && $(pwd) awk done $(pwd) grep ${HOME}
+then /usr/bin test local grep /usr/bin
+	awk ${HOME} printf --verbose test -eu
+export -eu echo sed -eu done test grep 2>/dev/null echo | /usr/bin local
+		sed printf done sed 2>/dev/null 2>/dev/null readonly $(pwd) 'quoted text'
+--verbose "$@" "$@" local awk grep then 2>/dev/null export "$1" printf
+		| printf && grep /usr/bin "$1" echo -eu "$1" then x=1 done -eu
+	"$1" "$1" $(pwd) sed ${HOME}
+	grep export sed -eu 'quoted text' ${HOME} -eu && done awk "$@" | $(pwd)
+		then --verbose cd then $(pwd) "$1" local $(pwd) printf test 2>/dev/null x=1 readonly
+	${HOME} done grep | echo awk /usr/bin printf then
+	local "$1" 2>/dev/null export x=1 echo 2>/dev/null "$1" readonly test /usr/bin
+"$@" done -eu /usr/bin test test sed test cd ${HOME} readonly 2>/dev/null
+		&& export 2>/dev/null then done | -eu 'quoted text' done
+		x=1 && /usr/bin $(pwd) test sed ${HOME} export
+	echo && $(pwd) $(pwd) readonly
+		echo "$@" local "$@" x=1 ${HOME} awk
+		--verbose --verbose $(pwd) -eu
+		"$1" grep ${HOME} | /usr/bin
+		| cd $(pwd) 2>/dev/null then test --verbose local printf awk then export 'quoted text'
+/usr/bin grep ${HOME} ${HOME} --verbose sed awk
+	--verbose /usr/bin | ${HOME} --verbose readonly
+	awk ${HOME} x=1 readonly x=1 $(pwd) grep "$@" && 2>/dev/null &&
+export "$1" /usr/bin local sed export
+	cd test cd local "$@" /usr/bin 'quoted text'
+	echo sed x=1 printf printf
+	/usr/bin sed then 'quoted text' "$@" "$1" echo $(pwd) x=1 sed --verbose
+"$1" x=1 $(pwd) then test echo | "$1"
+		printf "$@" test | awk ${HOME} "$1" "$1" x=1 2>/dev/null
+		-eu | ${HOME} -eu x=1 then && grep 2>/dev/null 'quoted text' awk
+	test | ${HOME} /usr/bin "$@" readonly local -eu 2>/dev/null 2>/dev/null
+	readonly --verbose 'quoted text' /usr/bin echo
+local awk | --verbose 'quoted text' -eu sed done echo
+	| $(pwd) grep ${HOME} then printf
+		| -eu printf "$1" --verbose export -eu then done readonly printf grep cd test
+-eu echo /usr/bin done local then $(pwd) --verbose 'quoted text'
+		grep grep local -eu export test sed export --verbose done
+"$@" echo awk -eu -eu cd local $(pwd) "$@"
+test awk printf echo --verbose export -eu cd cd echo 2>/dev/null
+		echo /usr/bin $(pwd) grep "$@" printf printf
+"$1" cd "$1" export export
+"$@" -eu echo && awk readonly awk && then printf 'quoted text' x=1
+export then then echo | sed x=1 $(pwd) done printf
+	then cd done printf export printf export awk cd ${HOME}
+test | 'quoted text' cd ${HOME} "$@" 2>/dev/null then readonly awk /usr/bin cd 2>/dev/null
+		$(pwd) $(pwd) readonly sed cd
+cd --verbose grep "$1" then /usr/bin done sed then -eu done
+		"$@" sed /usr/bin "$1" awk printf
+		local awk test --verbose && export 'quoted text'
+	readonly sed then printf
+$(pwd) done export $(pwd) grep readonly "$@" -eu -eu | x=1
+x=1 2>/dev/null ${HOME} grep x=1 --verbose grep 2>/dev/null x=1 local cd --verbose
+		cd grep /usr/bin /usr/bin $(pwd) done grep then awk test 2>/dev/null done
+--verbose /usr/bin readonly ${HOME}
+echo awk x=1 awk ${HOME} 'quoted text' echo grep printf awk $(pwd) "$1" -eu local
+		| grep x=1 readonly export | printf 'quoted text'
+"$@" "$@" echo echo | echo readonly --verbose
+then cd grep "$@" cd 2>/dev/null -eu
+printf x=1 sed --verbose grep 'quoted text' cd export | $(pwd) local
+x=1 $(pwd) && readonly printf
+	test 2>/dev/null -eu --verbose /usr/bin cd printf sed test && printf
+	export 'quoted text' 'quoted text' local grep -eu cd readonly && 2>/dev/null
+x=1 'quoted text' 'quoted text' --verbose grep readonly grep
+${HOME} echo --verbose printf cd export grep
+	export done sed ${HOME} grep echo sed ${HOME} done
+&& ${HOME} "$1" --verbose
+	export "$@" printf x=1
+	'quoted text' "$@" -eu then
+		sed sed | grep readonly cd 2>/dev/null readonly $(pwd) "$1"
+	-eu sed done echo /usr/bin done awk "$1" "$1" -eu
+		x=1 cd done "$@" done printf | -eu 'quoted text'
+		grep -eu /usr/bin sed local | | ${HOME} && readonly
+	readonly cd echo | ${HOME} export test export
+	local /usr/bin sed | awk
+export ${HOME} "$@" printf "$1" then -eu "$1" cd
+	printf ${HOME} 'quoted text'
+	cd $(pwd) x=1 "$1" /usr/bin test x=1
+	grep grep awk printf "$1" 'quoted text'
+	2>/dev/null "$@" then --verbose echo cd /usr/bin
+		-eu echo readonly "$@" echo test -eu test printf then x=1 -eu
+	&& 2>/dev/null echo test -eu 'quoted text'
+awk -eu ${HOME} test readonly
+readonly then "$@" "$1" ${HOME} then export && 2>/dev/null
+		then /usr/bin then x=1 | x=1
+/usr/bin cd sed "$@" cd | 'quoted text' done -eu cd then awk echo
+	cd test readonly local $(pwd) local printf "$1" printf
+printf --verbose cd readonly readonly grep -eu then /usr/bin
+x=1 done echo 'quoted text' "$@" --verbose ${HOME} printf readonly
+'quoted text' /usr/bin 2>/dev/null readonly export | 2>/dev/null
+		x=1 | awk cd sed done --verbose x=1 $(pwd) 'quoted text' grep then /usr/bin echo
+	--verbose x=1 echo test awk test -eu echo readonly && 'quoted text'
+	export ${HOME} export /usr/bin then then 'quoted text' /usr/bin | "$1" "$1" echo
+	"$@" "$1" && awk grep x=1 --verbose
+${HOME} "$@" $(pwd) readonly test then awk 2>/dev/null
+echo echo 2>/dev/null ${HOME} test awk 2>/dev/null
+	--verbose cd | local grep printf --verbose readonly -eu 2>/dev/null && awk | --verbose
+		"$@" grep 'quoted text' export sed export "$@" test done -eu
+	"$1" awk readonly ${HOME} 2>/dev/null | /usr/bin | done && "$@"
+		export echo 'quoted text' grep /usr/bin
+-eu /usr/bin 2>/dev/null -eu ${HOME}
+	test "$@" /usr/bin then --verbose ${HOME} awk && sed sed -eu 'quoted text'
+	cd local sed "$@" | --verbose awk && test local && echo
+		done sed -eu then -eu /usr/bin
+	done echo test | done "$1" echo done | x=1 2>/dev/null cd
+		/usr/bin ${HOME} && printf grep sed | printf --verbose export && done
+	then /usr/bin /usr/bin "$1" -eu
+	cd awk --verbose grep --verbose "$1" && /usr/bin x=1 && x=1 "$1" echo printf
+	local --verbose ${HOME} ${HOME} then $(pwd) local done export 'quoted text'
+		sed done cd x=1 test test | done echo
+		--verbose 'quoted text' ${HOME} 'quoted text' test && export cd $(pwd)
+&& "$@" export readonly x=1 $(pwd)
+	grep cd grep -eu sed local printf printf echo "$@"
+sed then $(pwd) 2>/dev/null | printf test readonly
+| "$1" "$1" --verbose readonly x=1 local
+	/usr/bin printf done /usr/bin awk then ${HOME}
+		then "$@" then test && cd -eu awk awk done readonly --verbose
+		2>/dev/null test echo awk
+awk && cd local $(pwd) /usr/bin test grep awk
+| done | && ${HOME} --verbose echo
+	2>/dev/null | $(pwd) | -eu echo then done cd sed "$@" --verbose 2>/dev/null
+	grep local 2>/dev/null done 2>/dev/null "$@"
+	&& printf --verbose done x=1 echo --verbose x=1 $(pwd) grep export
+	x=1 -eu readonly done local sed x=1 x=1 then 2>/dev/null "$@" grep readonly
+2>/dev/null done local echo "$1" test "$1" grep local 2>/dev/null -eu sed "$1"
+	'quoted text' | -eu $(pwd) printf export -eu -eu
+		| ${HOME} grep ${HOME} readonly
+/usr/bin 2>/dev/null $(pwd) 2>/dev/null then
+-eu echo ${HOME} printf -eu /usr/bin then | echo $(pwd) "$1" export
+		then cd then | then printf
+	| "$@" | 'quoted text' "$1" export /usr/bin 2>/dev/null $(pwd) then grep test
+	-eu ${HOME} cd awk then -eu done sed -eu readonly
+done export ${HOME} "$1" ${HOME} grep echo readonly printf grep --verbose
+export readonly ${HOME} cd 2>/dev/null readonly /usr/bin readonly
+	'quoted text' -eu cd --verbose ${HOME} 'quoted text' $(pwd) "$1" --verbose
+	$(pwd) x=1 export awk -eu awk $(pwd) done cd readonly
+awk export awk x=1 export --verbose && grep "$@" -eu grep $(pwd) -eu x=1 sed cd
+		local --verbose 2>/dev/null $(pwd)
+	local --verbose "$1" ${HOME} --verbose /usr/bin printf done
+	echo then cd x=1 readonly && 'quoted text'
+		then && echo 'quoted text' then /usr/bin --verbose ${HOME}
+		printf sed 2>/dev/null $(pwd) ${HOME} printf printf
+		/usr/bin local readonly | 'quoted text' local sed $(pwd) export ${HOME}
+		readonly ${HOME} then printf &&
+	awk "$@" readonly $(pwd) --verbose
+		grep awk done done done sed sed ${HOME} grep ${HOME} printf then
+'quoted text' awk && grep
+printf export --verbose local "$1" export
+echo "$@" x=1 "$@" export then echo then test
+		export $(pwd) x=1 "$@"
+| export echo awk awk readonly done
+"$1" sed readonly x=1 x=1 readonly
+	readonly "$@" done $(pwd) readonly test $(pwd) grep | -eu
+		sed readonly 2>/dev/null 'quoted text' --verbose grep grep readonly 2>/dev/null
+		/usr/bin awk --verbose local readonly sed 2>/dev/null
+	x=1 sed printf && $(pwd) &&
+	grep x=1 | export $(pwd) --verbose x=1 'quoted text'
+		grep echo awk local export -eu awk 'quoted text'
+		cd readonly grep local then --verbose sed && export
+	test printf echo grep export cd 2>/dev/null readonly | grep
+'quoted text' "$1" cd $(pwd) /usr/bin | && ${HOME} --verbose
+		awk printf 2>/dev/null 2>/dev/null done
+		local done "$@" readonly export x=1 -eu awk awk x=1 done 'quoted text' test grep
+		echo test "$1" local 'quoted text'
+	awk awk sed awk 2>/dev/null echo -eu -eu local grep
+		readonly done local readonly readonly 'quoted text' export
+	"$1" done sed test then -eu grep 2>/dev/null
+	--verbose test grep | /usr/bin x=1 readonly 2>/dev/null sed
+	$(pwd) && export then sed awk local 2>/dev/null done awk "$1" done
+		'quoted text' x=1 test done test cd | 2>/dev/null then ${HOME} "$1"
+		&& 'quoted text' printf echo printf -eu
+		echo sed -eu -eu grep export /usr/bin "$@" test /usr/bin readonly
+	2>/dev/null awk | test sed | 'quoted text' ${HOME} done --verbose -eu /usr/bin
+		"$@" --verbose "$@" "$@" 2>/dev/null awk | ${HOME} done /usr/bin awk export
+	echo cd cd local grep awk "$@" awk /usr/bin
+	x=1 && x=1 ${HOME} && /usr/bin 'quoted text' awk awk printf grep | local
+--verbose local "$1" done $(pwd) $(pwd) done then export "$@"
+		local then $(pwd) --verbose cd 2>/dev/null ${HOME}
+	done 'quoted text' ${HOME} cd /usr/bin && 2>/dev/null grep /usr/bin
+		local sed then -eu "$@" cd /usr/bin done
+&& grep $(pwd) then x=1 x=1 ${HOME}
+	--verbose printf 'quoted text' done 'quoted text'
+		echo then 2>/dev/null then ${HOME} "$1" grep $(pwd)
+/usr/bin $(pwd) done 'quoted text' sed "$@"
+		--verbose grep then then && | sed --verbose | printf readonly
+		-eu echo echo "$1" cd x=1 export | 2>/dev/null ${HOME} cd "$1"
+		export "$1" $(pwd) 2>/dev/null printf cd printf test
+	'quoted text' x=1 then "$1" "$@"
+cd cd test x=1 | printf test -eu export export local readonly
+local "$1" then printf | 'quoted text' "$1" ${HOME} "$@" | && sed --verbose --verbose
+awk printf echo -eu ${HOME} readonly cd readonly
+		"$@" grep $(pwd) cd x=1
+-eu sed $(pwd) echo export export 2>/dev/null test grep /usr/bin x=1
+	echo then && | printf && 2>/dev/null x=1 export
+	printf local "$@" then | "$@" --verbose done -eu test --verbose done printf
+	${HOME} local grep && echo /usr/bin readonly then printf
+printf "$@" "$1" grep -eu "$1" done grep $(pwd) 'quoted text' 2>/dev/null "$1"
+		| export 2>/dev/null test
+	-eu local printf /usr/bin test local grep then
+		cd 2>/dev/null local cd /usr/bin | export -eu sed 2>/dev/null
+		grep awk local local -eu done awk echo echo then x=1 && 'quoted text' sed -eu local
+	sed readonly -eu x=1 sed && "$@" echo x=1 export test
+		$(pwd) 2>/dev/null "$1"
+		--verbose $(pwd) | /usr/bin /usr/bin sed readonly && awk /usr/bin
+local sed $(pwd) local cd /usr/bin readonly x=1 sed done |
+	export test then 2>/dev/null readonly cd 'quoted text' printf readonly cd cd
+		local echo "$1" awk "$1" -eu printf readonly --verbose ${HOME} sed
+sed /usr/bin -eu && test 2>/dev/null
+&& export | local local $(pwd) export test
+readonly awk printf && /usr/bin 'quoted text'
+	x=1 printf 2>/dev/null "$@" cd sed && $(pwd)
+${HOME} 2>/dev/null echo && grep ${HOME} -eu
+cd awk test export done echo done "$1"
+	sed sed x=1 "$@" done --verbose test awk printf echo 'quoted text' awk --verbose
+		grep sed x=1 -eu echo readonly
+	--verbose sed x=1 local ${HOME} local local then sed cd -eu 'quoted text' "$@"
+	&& ${HOME} export && /usr/bin export
+	printf sed -eu local x=1 "$@" export done && "$1" 2>/dev/null $(pwd) /usr/bin cd
+		then local 'quoted text' printf grep x=1 x=1 sed sed
+		local ${HOME} test printf
+	cd -eu "$1" "$1" cd "$1" cd readonly
+		2>/dev/null sed cd test echo export local -eu echo -eu done
+		--verbose x=1 printf 'quoted text' grep && ${HOME}
+	then grep /usr/bin then "$@" then | grep --verbose | "$1" "$1"
+sed printf -eu --verbose 2>/dev/null local ${HOME} $(pwd)
+		${HOME} 'quoted text' then x=1 ${HOME} grep printf "$1" ${HOME} x=1 grep
+	test printf "$1" echo && test ${HOME} | then
+&& grep "$@" cd x=1 "$1" --verbose local $(pwd)
+-eu -eu && x=1 readonly --verbose 2>/dev/null cd
+	awk printf ${HOME} awk 2>/dev/null printf done -eu "$1" 'quoted text'
+	'quoted text' grep && then 'quoted text' readonly
+	export "$@" "$1" ${HOME} done --verbose ${HOME} grep | --verbose cd done
+		'quoted text' then readonly
+		'quoted text' $(pwd) /usr/bin
+	cd readonly printf done "$@" "$@" echo
+		test cd -eu sed "$1" "$@" test && awk cd
+	sed -eu $(pwd) grep done ${HOME} -eu grep --verbose test 2>/dev/null "$1"
+	local grep $(pwd) 'quoted text' grep /usr/bin | grep -eu then local 'quoted text'
+	-eu cd "$@" x=1 ${HOME} --verbose readonly
+	x=1 /usr/bin 2>/dev/null -eu cd && 2>/dev/null
+--verbose done $(pwd) done -eu printf "$1"
+readonly | local ${HOME} && export "$@" ${HOME} grep
+		echo x=1 sed done echo cd echo cd readonly
+		test export grep 2>/dev/null | "$1" local echo 2>/dev/null grep done done $(pwd)
+		/usr/bin echo "$1" echo
+"$1" local local 'quoted text'
+		sed "$1" /usr/bin local grep | && awk readonly /usr/bin -eu | 2>/dev/null
+		/usr/bin 2>/dev/null readonly readonly --verbose ${HOME} local x=1 | && "$@"
+		x=1 && --verbose "$1" echo $(pwd) cd "$1" 'quoted text' /usr/bin
+	--verbose --verbose printf ${HOME} done ${HOME} -eu $(pwd) ${HOME} $(pwd)
+done "$1" ${HOME} then test awk readonly ${HOME} /usr/bin
+	grep grep test cd done /usr/bin --verbose && |
+&& then && echo 2>/dev/null && 2>/dev/null echo 'quoted text'
+	cd sed then readonly /usr/bin 2>/dev/null cd test printf x=1 "$1" $(pwd) $(pwd)
+		"$@" sed -eu sed done && "$1" /usr/bin sed echo test printf && ${HOME}
+cd "$@" export | printf -eu export grep "$1" local printf grep export | cd
+	${HOME} "$@" export local "$@" grep /usr/bin
+| test export printf done done grep "$@" local 'quoted text'
+"$1" readonly printf 2>/dev/null "$1" ${HOME}
+		test 2>/dev/null "$@" 2>/dev/null export sed | | echo /usr/bin done
+		"$1" grep --verbose printf ${HOME} | && grep then $(pwd) $(pwd) "$1" | /usr/bin
+echo grep printf readonly then "$@" ${HOME} -eu export then
+	$(pwd) test -eu ${HOME} x=1 test 2>/dev/null echo echo cd $(pwd) grep
+		echo local readonly --verbose -eu sed
+		export done test "$1" -eu readonly x=1 printf printf
+export grep | "$@" --verbose | cd export
+echo grep /usr/bin x=1 awk 2>/dev/null cd 'quoted text' test cd done 2>/dev/null
+cd grep echo done sed "$1" "$@" sed 2>/dev/null
+sed then test export | readonly --verbose /usr/bin printf sed "$@" ${HOME}
+		then "$@" --verbose 'quoted text'
+		/usr/bin -eu printf readonly "$@" export awk grep $(pwd) x=1
+done test awk done 2>/dev/null 2>/dev/null echo local 2>/dev/null readonly
+awk 2>/dev/null sed ${HOME} local /usr/bin
+	--verbose "$1" sed $(pwd) echo printf
+	readonly export x=1 2>/dev/null sed done 2>/dev/null
+	-eu "$@" cd -eu | "$1" grep "$@"
+-eu --verbose done local awk test test "$1" grep then then
+		export sed "$1" then $(pwd)
+then cd done $(pwd) awk |
+	then $(pwd) && printf test awk $(pwd) awk $(pwd)
+&& done printf local --verbose ${HOME}
+	readonly grep printf test
+		${HOME} "$1" local --verbose $(pwd) grep 2>/dev/null 2>/dev/null
+		then -eu 'quoted text' done 2>/dev/null
+	test sed readonly export x=1 echo &&
+	echo test "$1" awk && --verbose | | | readonly $(pwd) "$@" 2>/dev/null
+		"$1" 2>/dev/null x=1 -eu cd done awk local /usr/bin $(pwd) cd /usr/bin readonly
+&& echo | | $(pwd) | done readonly grep echo 'quoted text' cd -eu
+		grep x=1 && local cd cd -eu local export done /usr/bin
+	printf 'quoted text' grep "$@" echo
+		sed 2>/dev/null --verbose
+		sed -eu x=1 'quoted text' $(pwd) test echo
+	test done 2>/dev/null local sed x=1 awk $(pwd) local "$@" test -eu grep && sed
+--verbose grep && sed then echo -eu $(pwd) "$@" x=1 done -eu | "$@" /usr/bin cd
+		-eu && printf 2>/dev/null && "$@" readonly
+x=1 | && && awk awk 2>/dev/null | "$@" && done echo "$1"
+	2>/dev/null cd | awk awk printf 'quoted text' cd -eu $(pwd)
+--verbose readonly --verbose
+		--verbose /usr/bin local x=1 sed 'quoted text' /usr/bin echo
+		grep 'quoted text' "$1" cd $(pwd) test && printf export
+		then sed /usr/bin "$@" export && "$@" "$1" $(pwd) ${HOME}
+awk cd export grep local
+		local ${HOME} -eu $(pwd) awk $(pwd) grep echo /usr/bin
+$(pwd) cd "$@" readonly 'quoted text' ${HOME} export test
+	export then done test | -eu echo "$1" done && "$1" export
+	/usr/bin "$1" echo "$1" awk --verbose printf echo export done local printf
+	local | awk -eu echo cd grep 2>/dev/null awk export /usr/bin grep $(pwd)
+awk readonly x=1 x=1 test readonly then done
+sed $(pwd) readonly echo /usr/bin awk test $(pwd) 'quoted text' &&
+${HOME} /usr/bin sed "$@" "$@" test ${HOME} -eu 2>/dev/null
+		x=1 ${HOME} && 'quoted text' $(pwd) 'quoted text' then "$1"
+		"$@" | x=1 && -eu 'quoted text' 2>/dev/null --verbose sed grep readonly readonly
+"$@" local | ${HOME} x=1 x=1 local grep printf local "$1" export 2>/dev/null 'quoted text'
+	"$@" | cd done 'quoted text' 2>/dev/null
+		-eu cd awk "$@" -eu then then /usr/bin
+test printf grep printf printf 2>/dev/null "$1" grep /usr/bin echo
+		"$@" sed ${HOME} "$1" export local cd
+		'quoted text' sed --verbose "$1" cd 2>/dev/null
+export ${HOME} done ${HOME} /usr/bin /usr/bin cd /usr/bin awk sed --verbose
+then cd printf local 'quoted text'
+		/usr/bin "$@" test echo | awk local 'quoted text'
+		printf export | readonly then && echo cd echo | echo "$1" grep $(pwd) done local
+		then cd local grep 'quoted text' --verbose --verbose
+		export 'quoted text' | /usr/bin test
+sed readonly 2>/dev/null echo grep --verbose export ${HOME} --verbose
+| 'quoted text' "$1" then "$1" "$@" local grep
+x=1 2>/dev/null -eu cd $(pwd) awk -eu $(pwd) readonly done 'quoted text' awk $(pwd)
+		printf /usr/bin export readonly 'quoted text'
+	| echo 2>/dev/null -eu 'quoted text' 2>/dev/null test test | then "$1" && ${HOME}
+		echo $(pwd) readonly 'quoted text'
+		test printf grep done then readonly
+		"$1" cd $(pwd) ${HOME}
+		export x=1 && 2>/dev/null 2>/dev/null
+	$(pwd) /usr/bin awk --verbose readonly export sed cd -eu echo 2>/dev/null
+	x=1 --verbose "$1" --verbose cd "$@" -eu 2>/dev/null
+"$@" echo awk -eu "$@" | -eu cd ${HOME} | awk done 'quoted text'
+	-eu "$1" awk printf export 2>/dev/null local $(pwd) 2>/dev/null
+export && printf "$@" readonly "$@" export test test done local x=1 -eu
+	sed "$1" sed export 2>/dev/null done | 'quoted text'
+done | /usr/bin 'quoted text' /usr/bin 2>/dev/null echo 2>/dev/null "$@"
+export | /usr/bin /usr/bin -eu readonly --verbose cd 2>/dev/null sed $(pwd)
+sed then ${HOME} "$1" "$@" printf then && sed export "$1"
+		export $(pwd) local "$@" done "$@"
+		sed | sed | done --verbose echo export x=1 | 2>/dev/null local $(pwd)
+		-eu local | x=1 x=1 readonly done then local --verbose done awk && readonly local
+--verbose --verbose echo 'quoted text' cd local $(pwd) awk 2>/dev/null && $(pwd)
+"$1" test sed echo 'quoted text' export grep then 'quoted text'
+	2>/dev/null | awk local done "$@" done --verbose x=1
+		test 2>/dev/null && -eu test
+		$(pwd) -eu | "$@" 2>/dev/null awk
+readonly $(pwd) $(pwd) printf -eu && && 2>/dev/null
+		${HOME} -eu readonly | echo | ${HOME}
+"$1" 2>/dev/null $(pwd) | printf "$@" grep grep /usr/bin
+echo && done $(pwd) ${HOME}
+		'quoted text' grep awk export
+		export awk local -eu x=1 -eu ${HOME} export local grep
+/usr/bin && readonly sed
+awk x=1 awk grep ${HOME} -eu readonly local
+	done export | sed "$1" done x=1 awk
+	-eu local export 'quoted text' ${HOME} --verbose "$@" -eu then "$1" grep readonly
+	local grep grep awk 'quoted text' local grep
+readonly grep "$@" /usr/bin
+		then /usr/bin grep | ${HOME} 'quoted text'
+	--verbose printf 2>/dev/null | x=1 awk $(pwd) readonly printf readonly
+		readonly then export x=1 /usr/bin --verbose "$1" x=1
+	cd then && 'quoted text' cd "$1" "$@" /usr/bin
+-eu "$1" local awk awk -eu --verbose cd readonly x=1 sed echo
+done done x=1 cd --verbose
+&& -eu "$1" && local "$1" --verbose "$@" local echo -eu -eu && test
+2>/dev/null done 2>/dev/null ${HOME}
+	-eu awk readonly ${HOME} && | export --verbose
+		-eu ${HOME} && 'quoted text' readonly x=1 2>/dev/null
+	--verbose export --verbose --verbose cd local 2>/dev/null
+	'quoted text' -eu && --verbose 'quoted text'
+		grep --verbose 'quoted text' "$@" ${HOME} local cd --verbose -eu x=1 2>/dev/null
+cd | -eu --verbose "$1" test 2>/dev/null ${HOME} then done readonly | --verbose
+		awk "$1" readonly $(pwd) 'quoted text' $(pwd)
+	'quoted text' ${HOME} /usr/bin then -eu
+		then | sed x=1 ${HOME} export ${HOME} && echo grep /usr/bin 'quoted text'
+		"$@" cd 2>/dev/null $(pwd)
+		cd | $(pwd) readonly 'quoted text' --verbose 'quoted text' export ${HOME} test
+	done printf echo $(pwd) --verbose
+	--verbose $(pwd) readonly "$1" done grep --verbose readonly
+		&& sed --verbose -eu --verbose ${HOME} x=1 "$1" x=1 then
+	echo --verbose echo cd
+grep -eu cd 2>/dev/null sed && export --verbose
+/usr/bin done grep then /usr/bin local export
+local && --verbose /usr/bin local
+/usr/bin 2>/dev/null 2>/dev/null
+| "$@" && /usr/bin | $(pwd) 2>/dev/null ${HOME} 'quoted text'
+		'quoted text' grep 2>/dev/null ${HOME} -eu /usr/bin
+	"$1" cd $(pwd) readonly printf ${HOME} test sed 'quoted text' printf awk awk
+		| readonly awk then | /usr/bin test && sed export | awk 'quoted text'
+	grep then && "$@" awk --verbose then $(pwd) readonly echo /usr/bin grep
+		x=1 export awk done echo ${HOME} 2>/dev/null |
+	export /usr/bin test | /usr/bin sed then
+	test ${HOME} $(pwd) && && x=1 $(pwd) export cd
+	| && local done -eu grep done
+		&& 2>/dev/null | then 'quoted text' "$1" local "$1" $(pwd) x=1 local cd $(pwd)
+		awk sed 2>/dev/null sed sed echo
+		/usr/bin 'quoted text'
+	--verbose /usr/bin -eu sed
+	test echo sed 2>/dev/null export /usr/bin done | cd echo 2>/dev/null echo local
+		-eu 2>/dev/null local grep cd echo
+	cd -eu sed readonly | sed /usr/bin -eu printf
+		"$@" "$1" 2>/dev/null local && awk ${HOME} then x=1 cd "$@"
+	test sed "$@" export | "$1" sed 2>/dev/null x=1 grep "$@" done ${HOME} grep
+then grep test test 2>/dev/null done printf test -eu readonly /usr/bin "$@" echo
+		-eu ${HOME} done test test /usr/bin --verbose
+printf then 'quoted text' 2>/dev/null --verbose | awk export --verbose "$1" -eu
+	done 'quoted text' test done 2>/dev/null --verbose printf printf "$@" $(pwd)
+		2>/dev/null sed -eu x=1 -eu -eu $(pwd) local -eu
+		&& local done test test readonly --verbose &&
+		/usr/bin export "$@" x=1 | $(pwd) | done
+		$(pwd) ${HOME} printf x=1 && export local
+export awk "$1" awk readonly 'quoted text' done awk 2>/dev/null
+	| | | "$1" sed then grep test echo /usr/bin done local "$1"
+"$@" grep --verbose sed /usr/bin -eu echo done 2>/dev/null
+-eu 2>/dev/null local done x=1 test 'quoted text'
+$(pwd) --verbose "$1" done
+awk export then test
+		-eu local | $(pwd) -eu --verbose && && 2>/dev/null
+	grep -eu printf 'quoted text' cd printf && "$1" /usr/bin printf "$@"
+		then export grep "$1" "$@" grep && printf then printf sed ${HOME} /usr/bin $(pwd)
+then 'quoted text' cd 2>/dev/null echo
+	printf done $(pwd) test x=1 ${HOME} export 2>/dev/null
+	grep ${HOME} local printf readonly 'quoted text'
+		&& 2>/dev/null ${HOME} -eu test "$@" $(pwd) done test echo && awk | cd 'quoted text'
+	"$@" && grep export /usr/bin x=1 grep done ${HOME} ${HOME} awk --verbose "$@"
+	echo "$@" 'quoted text'
+	'quoted text' $(pwd) sed done --verbose
+	'quoted text' sed ${HOME} export cd ${HOME} printf then done --verbose x=1 echo
+		test --verbose local x=1 $(pwd) ${HOME}
+	${HOME} export then local cd --verbose $(pwd) then readonly
+	'quoted text' 2>/dev/null
+then done printf export then grep local | x=1 "$1" ${HOME}
+		cd && echo 'quoted text' ${HOME} $(pwd) export echo
+echo sed x=1 echo --verbose export readonly
+		test "$1" export local x=1 sed awk
+export export 'quoted text'
+		sed $(pwd) x=1 grep local sed && export --verbose
+	awk "$@" test sed --verbose 'quoted text' | &&
+printf $(pwd) echo readonly /usr/bin done printf readonly export printf sed
+		'quoted text' /usr/bin readonly && --verbose "$@" awk then x=1 2>/dev/null
+	"$1" sed done local done && $(pwd) ${HOME}
+	export ${HOME} --verbose grep grep | ${HOME} x=1
+local echo echo done then cd ${HOME} 2>/dev/null
+cd readonly then --verbose -eu 2>/dev/null sed
+	$(pwd) $(pwd) ${HOME} "$@" export
+		test printf grep "$@" "$@" && ${HOME} /usr/bin "$1" 'quoted text' -eu -eu
+	then readonly readonly $(pwd) /usr/bin printf 2>/dev/null printf && 'quoted text'
+		echo --verbose readonly --verbose 'quoted text' -eu
+		/usr/bin readonly "$@" --verbose
+		${HOME} x=1 'quoted text' cd "$1" && && export local
+| sed cd export --verbose then then readonly "$@" 2>/dev/null
+	x=1 $(pwd) x=1 'quoted text' cd sed done echo grep "$1"
+sed grep --verbose | -eu awk export then
+	test && done | --verbose echo && x=1 echo printf export cd cd ${HOME}
+		awk local | printf $(pwd) sed /usr/bin | printf cd echo awk readonly
+$(pwd) local "$1" printf "$1" local done ${HOME} done
+--verbose "$1" --verbose awk
+	sed -eu export echo sed cd "$1" | | 2>/dev/null
+test sed --verbose --verbose ${HOME}
+	export printf local test $(pwd) then grep /usr/bin ${HOME} 'quoted text'
+cd then grep cd then awk grep | "$1" $(pwd) x=1 /usr/bin sed
+		grep export awk echo sed done export awk /usr/bin $(pwd) done local ${HOME}
+	test 'quoted text' then readonly
+		-eu -eu test && x=1 export x=1 "$1" --verbose "$@" export
+	grep "$1" cd awk done $(pwd) ${HOME} /usr/bin ${HOME} test
+		2>/dev/null 'quoted text' awk && done
+	grep ${HOME} readonly readonly
+		readonly then && | x=1 readonly
+	test then done $(pwd) echo echo awk && && local then done cd &&
+test | awk && echo done export
+	-eu grep --verbose 2>/dev/null then test "$@"
+${HOME} --verbose 'quoted text'
+	local | 2>/dev/null cd sed $(pwd) local done
+--verbose sed | $(pwd) /usr/bin "$@"
+readonly grep /usr/bin /usr/bin "$1" done x=1 2>/dev/null ${HOME} 2>/dev/null
+	${HOME} echo printf printf "$1" $(pwd) grep ${HOME} 2>/dev/null
+		"$1" export $(pwd) $(pwd) -eu grep "$1" x=1 'quoted text'
+local $(pwd) && -eu cd | && echo sed "$@" /usr/bin && grep then
+		x=1 awk done local sed printf
+&& sed 2>/dev/null awk "$1" "$1" cd
+		'quoted text' local | && | $(pwd) /usr/bin awk ${HOME} x=1
+		2>/dev/null awk 'quoted text'
+		echo grep then then grep grep | local
+export -eu echo 2>/dev/null x=1 awk
+		then grep echo 2>/dev/null then export echo && --verbose done done
+		/usr/bin 2>/dev/null done test test
+		"$@" "$@" && | $(pwd) export /usr/bin grep "$1" cd then 'quoted text'
+		local sed x=1 /usr/bin $(pwd) "$@"
+	cd /usr/bin local echo -eu export echo grep
+		"$@" sed then grep 2>/dev/null sed -eu "$1" readonly
+'quoted text' && readonly && 2>/dev/null
+	done $(pwd) test sed --verbose readonly --verbose "$1" grep sed
+sed local "$1" /usr/bin awk $(pwd) x=1 done export && local -eu 2>/dev/null
+	-eu done "$@" sed "$@" export grep done "$@" readonly printf printf cd
+x=1 | readonly 2>/dev/null
+		--verbose done awk grep
+	done /usr/bin x=1 x=1 grep local && ${HOME} $(pwd) done
+sed echo grep /usr/bin awk then test "$@" readonly
+		"$@" $(pwd) ${HOME} "$1" grep
+	2>/dev/null local --verbose sed --verbose ${HOME} -eu
+	'quoted text' export "$1"
+	export -eu ${HOME} sed x=1 printf
+	&& x=1 -eu sed 2>/dev/null local awk cd grep printf done --verbose done done
+	| /usr/bin x=1 export test 2>/dev/null done $(pwd) | export x=1 done 'quoted text'
+		local $(pwd) test | then /usr/bin && readonly -eu
+${HOME} /usr/bin sed -eu /usr/bin | | readonly awk
+		-eu -eu export done done export x=1 $(pwd) 'quoted text' | export done sed
+		-eu echo printf && 'quoted text' grep -eu export readonly ${HOME} then
+		-eu "$@" && ${HOME} /usr/bin | awk /usr/bin
+	echo /usr/bin "$1" $(pwd) --verbose $(pwd) echo "$1"
+"$@" sed -eu ${HOME} 'quoted text'
+		printf awk | then sed /usr/bin export export sed && local
+	"$@" --verbose | ${HOME} echo "$@" -eu /usr/bin
+${HOME} then --verbose ${HOME} test export readonly test readonly grep ${HOME}
+"$1" echo printf local then 'quoted text' test
+		done --verbose echo then --verbose
+	test x=1 then awk "$1" readonly | awk done ${HOME} sed --verbose "$@" /usr/bin ${HOME}
+	grep -eu test grep cd --verbose local /usr/bin grep "$1" x=1 printf grep readonly
+	sed -eu && local grep sed "$@" printf
+&& done --verbose done && --verbose then
+		cd x=1 x=1 done cd --verbose "$1" cd grep sed ${HOME} $(pwd) 2>/dev/null
+cd "$@" echo sed test echo printf /usr/bin cd printf
+	done 2>/dev/null awk --verbose then
+		--verbose --verbose "$@" then "$@" readonly local
+	grep x=1 then && test
+local 'quoted text' grep --verbose
+		$(pwd) local local x=1 done "$@" 2>/dev/null --verbose --verbose ${HOME} then
+		sed --verbose "$1" grep then
+/usr/bin readonly -eu --verbose
+"$@" "$1" awk then --verbose -eu
+"$1" printf 'quoted text' then done echo awk then cd done test --verbose
+		/usr/bin export sed cd "$@"
+		export /usr/bin grep 'quoted text' "$@"
+		test cd $(pwd) local 'quoted text' 2>/dev/null -eu
+x=1 cd local readonly --verbose "$1" readonly --verbose
+done /usr/bin -eu 'quoted text' readonly grep
+	echo local grep readonly local 2>/dev/null export printf --verbose
+	'quoted text' /usr/bin echo ${HOME} then done 'quoted text' "$1" readonly
+	&& readonly awk echo -eu "$1" $(pwd) sed /usr/bin "$@" /usr/bin awk echo grep
+'quoted text' "$@" "$@" ${HOME}
+#include c29.sh
+		$(pwd) ${HOME} --verbose export "$@" done export
+		readonly then done sed 'quoted text' | -eu sed awk
+		cd -eu 2>/dev/null && local printf export
+	/usr/bin ${HOME} export 2>/dev/null cd awk export
+		local x=1 /usr/bin /usr/bin x=1 'quoted text'
+	test done printf grep ${HOME}
+		printf "$1" "$@" -eu 2>/dev/null 'quoted text' && cd awk sed "$@"
+"$@" awk done grep 'quoted text' grep test done then export /usr/bin echo
+	sed echo sed then "$@"
+"$@" --verbose echo done test then then | cd /usr/bin
+	-eu | 2>/dev/null export awk $(pwd) printf $(pwd) export then printf "$1"
+export 2>/dev/null $(pwd) 2>/dev/null
+export test && && export local -eu echo --verbose then
+		test printf local "$@" 'quoted text' sed readonly echo &&
+		test --verbose -eu awk
+cd 'quoted text' readonly && sed &&
+printf cd done -eu sed x=1 | sed -eu | then
+		| 2>/dev/null export done ${HOME}
+	export -eu then cd --verbose done --verbose
+		-eu 2>/dev/null /usr/bin 2>/dev/null
+sed --verbose 'quoted text' -eu 2>/dev/null readonly $(pwd) done 2>/dev/null grep
+		"$@" ${HOME} cd "$1" ${HOME} printf -eu then local grep
+	readonly printf 'quoted text' cd grep awk
+	sed "$1" then --verbose grep --verbose && | sed sed cd /usr/bin echo "$@" awk
+	cd cd --verbose grep local done ${HOME}
+		sed done x=1 | readonly /usr/bin printf echo /usr/bin done $(pwd) echo
+-eu sed 2>/dev/null echo --verbose 2>/dev/null printf
+		"$1" 'quoted text' | awk
+	done $(pwd) 'quoted text' --verbose "$1" sed | --verbose
+		"$@" x=1 done printf then "$1" test $(pwd) export readonly && && $(pwd)
+2>/dev/null export ${HOME} printf sed
+		cd | && readonly readonly | --verbose grep readonly && && 2>/dev/null $(pwd) local
+		--verbose local sed cd readonly -eu /usr/bin | "$1" && done | | "$@"
+export local grep $(pwd) done done && then
+${HOME} printf 2>/dev/null cd "$@" printf echo
+		${HOME} | readonly x=1 printf
+		| -eu | local local $(pwd) && then grep grep | sed
+	grep ${HOME} 2>/dev/null "$1" /usr/bin local && grep $(pwd)
+	"$@" "$1" printf awk 'quoted text' awk awk printf sed ${HOME} 2>/dev/null
+	local printf && awk --verbose grep | export "$1" readonly | 'quoted text' 'quoted text'
+	"$@" ${HOME} grep "$1" x=1 "$1" | ${HOME} awk 2>/dev/null "$1" -eu /usr/bin /usr/bin
+		cd done ${HOME} x=1 -eu "$@" grep --verbose then && echo && readonly
+	$(pwd) 2>/dev/null export test "$1" echo
+	export $(pwd) cd printf && $(pwd) then readonly $(pwd) 'quoted text'
+	--verbose printf --verbose 'quoted text' printf 2>/dev/null printf "$@"
+	then test x=1 "$@" export "$1" x=1 && printf grep done
+		printf /usr/bin then 'quoted text' grep
+awk grep cd /usr/bin ${HOME} 'quoted text' readonly 'quoted text'
+$(pwd) local then -eu grep | x=1
+	export 2>/dev/null --verbose
+	-eu | test "$@" 2>/dev/null /usr/bin export "$1" export test "$1" "$@" 2>/dev/null
+-eu -eu --verbose echo x=1 -eu printf 'quoted text' 'quoted text' cd readonly test
+		x=1 printf echo export grep
+	'quoted text' awk then ${HOME} test export readonly
+	| export done export "$@" && grep local
+awk x=1 grep 2>/dev/null
+awk "$1" readonly sed sed readonly test export echo printf
+${HOME} cd "$1" export 2>/dev/null $(pwd) local cd grep "$@" "$@" 2>/dev/null
+		--verbose "$@" "$@" && test $(pwd) 'quoted text' -eu readonly
+--verbose export export | 2>/dev/null x=1 echo export /usr/bin local echo "$@"
+	-eu echo cd readonly test ${HOME}
+		2>/dev/null && export sed test
+cd --verbose $(pwd) local echo cd printf readonly cd
+local --verbose ${HOME} --verbose local /usr/bin "$1" awk
+		x=1 done x=1 x=1 grep sed done sed /usr/bin /usr/bin x=1 awk readonly x=1 grep then
+		| ${HOME} --verbose /usr/bin | ${HOME} && x=1 $(pwd) 2>/dev/null
+2>/dev/null "$1" "$1" "$@"
+$(pwd) test && 2>/dev/null readonly "$@" 'quoted text' 'quoted text' test
+		-eu then "$@" /usr/bin test grep export 2>/dev/null echo cd x=1
+		'quoted text' cd "$1" 2>/dev/null | "$@" /usr/bin /usr/bin
+${HOME} "$@" cd printf ${HOME}
+	awk /usr/bin x=1 sed sed
+		$(pwd) $(pwd) then sed /usr/bin
+test $(pwd) then readonly printf 2>/dev/null /usr/bin
+	cd x=1 done echo 2>/dev/null then 'quoted text' echo 2>/dev/null
+grep | | cd cd then done
+sed ${HOME} printf cd | grep done --verbose sed /usr/bin
+printf ${HOME} | local grep && export
+	printf readonly "$@" sed echo "$1" echo "$@" -eu x=1 x=1 readonly sed local
+	'quoted text' "$@" sed grep ${HOME} export --verbose sed then $(pwd) then
+		done awk export "$@" /usr/bin grep grep
+		/usr/bin export "$1" printf "$1" "$1" $(pwd) printf /usr/bin 'quoted text'
+readonly $(pwd) x=1 /usr/bin cd "$@" readonly done "$1" awk export readonly readonly
+	readonly printf grep /usr/bin grep "$@" sed echo 'quoted text'
+local 2>/dev/null --verbose then done
+	2>/dev/null ${HOME} 'quoted text' x=1 ${HOME} local
+	awk "$1" -eu -eu && | export test then
+		"$1" 2>/dev/null x=1 readonly
+	2>/dev/null local x=1 done x=1 | |
+		"$1" export done | && printf -eu done readonly ${HOME}
+2>/dev/null echo x=1 x=1 $(pwd) echo && done printf x=1 -eu
+	cd echo 'quoted text' local | | /usr/bin sed export export /usr/bin
+	awk | | "$@" local x=1 done done printf -eu done 2>/dev/null
+${HOME} printf -eu 2>/dev/null ${HOME} -eu x=1 grep && "$1" 'quoted text' echo
+cd | printf done /usr/bin "$1" echo
+'quoted text' echo echo export "$1" | 2>/dev/null sed $(pwd) done $(pwd) ${HOME}
+	2>/dev/null printf readonly /usr/bin
+		grep grep x=1 test x=1
+	x=1 printf "$@" awk echo echo ${HOME} -eu 'quoted text'
+		/usr/bin export then | --verbose sed --verbose local x=1 then ${HOME} grep
+	x=1 then test x=1 then | ${HOME}
+$(pwd) x=1 x=1 /usr/bin "$@" x=1 "$1" 'quoted text'
+'quoted text' grep then test ${HOME} 2>/dev/null
+		cd --verbose /usr/bin $(pwd) local x=1 |
+		sed readonly test then
+-eu cd $(pwd) awk awk 2>/dev/null grep $(pwd) | local 'quoted text'
+	readonly /usr/bin grep $(pwd) x=1 then grep /usr/bin 2>/dev/null 2>/dev/null
+	2>/dev/null printf | $(pwd) -eu local export test local "$1" local "$@" /usr/bin
+		cd local sed local readonly ${HOME} echo printf then
+		&& -eu sed "$1" grep -eu test grep printf | | --verbose export
+		echo /usr/bin "$1" 2>/dev/null
+		printf | done then ${HOME} && ${HOME} /usr/bin sed /usr/bin
+		'quoted text' test local test x=1 --verbose $(pwd)
+	test x=1 $(pwd) 2>/dev/null grep cd readonly $(pwd) -eu --verbose x=1
+'quoted text' -eu cd readonly 2>/dev/null x=1 | -eu done
+	then done echo --verbose local readonly && readonly sed 2>/dev/null test
+		"$@" x=1 export "$1" then local
+	done && awk 'quoted text' 'quoted text'
+	&& grep --verbose x=1 done grep && export "$1" "$1" done "$@"
+		${HOME} /usr/bin cd /usr/bin
+"$@" awk export local "$@"
+		cd && "$@" done printf test "$1" "$1" | done 'quoted text' -eu export /usr/bin x=1
+local x=1 done awk local local export done "$@" 2>/dev/null
+		"$@" printf awk $(pwd) grep --verbose "$@" ${HOME} -eu
+		$(pwd) x=1 2>/dev/null readonly x=1 "$1" echo readonly local then -eu "$@"
+		echo /usr/bin readonly then sed x=1 --verbose printf "$1" done "$1" printf
+awk ${HOME} -eu "$1"
+	then -eu 'quoted text' local --verbose $(pwd) echo
+then echo ${HOME} ${HOME} sed readonly grep then echo then x=1
+		cd sed -eu "$@" sed "$1" &&
+		${HOME} readonly "$1" cd /usr/bin 'quoted text'
+		export printf && local /usr/bin 'quoted text' /usr/bin 2>/dev/null local grep
+	readonly test sed /usr/bin --verbose
+		x=1 "$@" 2>/dev/null readonly grep then x=1 echo export done printf
+	printf $(pwd) test | -eu awk --verbose
+	--verbose cd ${HOME} "$@" then local "$@" "$@" local --verbose
+		grep done | printf "$1" cd
+then then 2>/dev/null "$1" export -eu 2>/dev/null echo local export readonly
+		--verbose sed cd sed x=1 grep $(pwd) 2>/dev/null
+	2>/dev/null /usr/bin local |
+	'quoted text' done readonly 'quoted text' 2>/dev/null
+		-eu $(pwd) echo -eu local -eu local readonly && echo /usr/bin local 2>/dev/null
+		'quoted text' $(pwd) readonly 'quoted text' test printf -eu export
+	"$@" then 'quoted text' -eu readonly "$1" printf
+		-eu then | ${HOME} && | -eu export
+		-eu && grep --verbose && -eu --verbose ${HOME}
+	'quoted text' -eu done --verbose export done done local --verbose
+		"$1" "$1" -eu readonly -eu "$@" x=1 -eu && ${HOME}
+		"$@" "$@" cd readonly done |
+	grep sed ${HOME} done export cd export echo
+sed export 2>/dev/null -eu ${HOME}
+		echo x=1 "$1" grep local && "$@" then export
+	export | export then cd local printf
+	then "$@" "$@" awk done done cd --verbose
+		--verbose | echo readonly && export awk "$@" $(pwd) 2>/dev/null
+		${HOME} readonly $(pwd)
+	awk sed sed x=1 "$@" cd 'quoted text' -eu "$@" cd 'quoted text' /usr/bin
+"$@" /usr/bin sed grep 2>/dev/null awk && 'quoted text' --verbose
+sed 2>/dev/null readonly -eu "$@"
+	test /usr/bin /usr/bin cd done grep done -eu --verbose
+cd x=1 cd -eu /usr/bin readonly ${HOME}
+	awk echo cd --verbose 'quoted text' test $(pwd) printf ${HOME} awk readonly
+x=1 | printf | awk --verbose
+		export 2>/dev/null local
+		"$1" 2>/dev/null /usr/bin echo "$@" /usr/bin done readonly
+grep "$@" then && 'quoted text'
+sed grep && test --verbose test grep
+test -eu sed grep cd cd "$@" echo x=1 then printf readonly | readonly
+| 2>/dev/null "$1" | $(pwd) test && | "$1" export
+-eu $(pwd) --verbose grep readonly test done | x=1 2>/dev/null | done cd x=1 &&
+then then sed $(pwd) done 2>/dev/null printf grep -eu -eu --verbose
+	test grep --verbose -eu cd -eu printf $(pwd) 2>/dev/null done x=1 grep $(pwd)
+then && cd awk x=1 readonly cd 'quoted text' -eu "$1" $(pwd) awk awk /usr/bin
+"$@" 'quoted text' -eu ${HOME} then
+/usr/bin awk | | ${HOME} | x=1 && /usr/bin
+grep -eu /usr/bin echo x=1 export then cd | awk ${HOME}
+		grep | && printf done local printf
+		local local readonly local -eu echo echo --verbose $(pwd) 2>/dev/null 2>/dev/null
+		echo local x=1 -eu done "$@" $(pwd) grep
+		--verbose -eu awk -eu | cd 2>/dev/null local 2>/dev/null | x=1 $(pwd) test local
+		"$1" --verbose /usr/bin printf cd then "$@" -eu done
+		2>/dev/null /usr/bin x=1 cd && then test
+		test test 2>/dev/null export awk $(pwd) export sed x=1 export sed && ${HOME}
+		--verbose | then ${HOME} printf sed -eu printf 2>/dev/null 'quoted text'
+echo printf then "$1" && done | ${HOME}
+export "$1" local readonly echo grep then echo 'quoted text'
+"$1" export grep grep echo $(pwd)
+		"$1" grep && sed && test done done sed
+	-eu local 'quoted text' local
+		done -eu | "$1" awk echo done echo ${HOME} test 'quoted text' /usr/bin local
+		$(pwd) test -eu && | printf done 'quoted text' x=1 --verbose "$1" done 2>/dev/null
+	'quoted text' x=1 | local export "$@" -eu printf -eu cd "$1" $(pwd) "$1"
+	--verbose /usr/bin -eu readonly
+	"$@" 2>/dev/null echo /usr/bin 2>/dev/null ${HOME} "$@"
+printf x=1 done cd awk readonly printf then sed
+	-eu --verbose /usr/bin "$@" "$@" 2>/dev/null then | ${HOME}
+	then 'quoted text' ${HOME} awk $(pwd) $(pwd) && &&
+local cd cd x=1 | test /usr/bin "$1" readonly "$1" cd "$@" awk $(pwd)
+-eu && awk then printf printf done
+export test | printf printf
+local readonly 2>/dev/null readonly
+		cd export export then | cd /usr/bin ${HOME}
+	awk && 'quoted text' $(pwd) printf /usr/bin && done "$@" local cd "$@" test
+	/usr/bin x=1 && echo awk readonly
+	test 'quoted text' export export cd x=1 x=1 "$1" done /usr/bin readonly --verbose
+	then "$1" 'quoted text' cd "$@" 'quoted text' readonly
+printf | local ${HOME} 'quoted text' cd grep grep /usr/bin echo printf && sed sed
+		x=1 | "$1" ${HOME} then "$1" test
+		"$1" "$1" echo 'quoted text' local readonly
+		done grep 2>/dev/null --verbose test --verbose 'quoted text' 2>/dev/null
+		awk printf awk 2>/dev/null cd sed "$1" && --verbose
+	printf -eu "$1" then test local local 'quoted text' x=1 then local
+	test 'quoted text' -eu && export /usr/bin
+printf --verbose readonly x=1 "$1" && done $(pwd) && then ${HOME}
+		awk $(pwd) sed grep cd "$1" /usr/bin readonly
+	echo cd | x=1 ${HOME} awk x=1 && | readonly sed export
+		/usr/bin export $(pwd) && printf "$1" ${HOME} echo done test
+		awk ${HOME} readonly "$@" grep "$@" 'quoted text'
+	${HOME} 2>/dev/null --verbose printf
+--verbose ${HOME} "$1" 2>/dev/null
+	2>/dev/null | grep grep $(pwd)
+	-eu local 'quoted text' test 2>/dev/null printf done export
+	$(pwd) then "$1" sed "$@" -eu cd --verbose readonly echo printf
+		grep local /usr/bin && done "$@"
+-eu awk && echo ${HOME} ${HOME} test grep cd
+	awk readonly 'quoted text' local 'quoted text' -eu readonly $(pwd)
+export && && 2>/dev/null && "$@" then "$1" done 2>/dev/null
+		| /usr/bin grep cd | -eu && grep
+		'quoted text' -eu printf "$@" --verbose
+/usr/bin "$@" $(pwd) "$@"
+		echo ${HOME} done grep readonly
+| x=1 -eu "$1" readonly
+		test | x=1 /usr/bin "$1" test /usr/bin --verbose x=1
+"$1" | echo "$@" then cd awk 'quoted text' 2>/dev/null /usr/bin -eu $(pwd)
+		readonly echo then grep printf done awk -eu local test printf | "$1"
+	readonly 2>/dev/null awk -eu awk | printf --verbose grep
+	awk 2>/dev/null && --verbose "$@" | cd x=1 printf $(pwd) printf then
+	&& | sed | && $(pwd) && grep | 'quoted text' $(pwd) ${HOME}
+	echo 'quoted text' export grep $(pwd) && $(pwd)
+"$@" done $(pwd) cd local
+grep test -eu readonly grep local "$@" then cd -eu
+	"$@" grep 2>/dev/null | sed -eu cd "$1" test "$@" export x=1 "$1"
+		"$1" | 'quoted text' echo printf sed --verbose /usr/bin then sed
+-eu ${HOME} | | 2>/dev/null /usr/bin export
+${HOME} then ${HOME} test x=1 then
+	grep "$@" then test sed export
+	"$@" 2>/dev/null --verbose export cd ${HOME} awk local awk
+		export done then awk sed printf
+	| export test /usr/bin $(pwd) readonly 'quoted text' printf --verbose 2>/dev/null
+	${HOME} 'quoted text' awk test $(pwd) --verbose
+	-eu ${HOME} local && -eu grep 2>/dev/null cd test | awk /usr/bin done &&
+$(pwd) $(pwd) readonly printf test "$@" done printf printf
+local awk sed $(pwd) echo "$1" echo readonly
+local ${HOME} && "$1" x=1 $(pwd) /usr/bin sed done test $(pwd) awk $(pwd)
+${HOME} export then export done -eu sed "$1"
+		"$@" readonly "$1" "$1" local printf
+	local && "$1" echo printf done 2>/dev/null awk ${HOME}
+		&& awk 2>/dev/null test readonly awk cd -eu 'quoted text'
+test 2>/dev/null ${HOME} then | 2>/dev/null grep test x=1
+		export $(pwd) 'quoted text'
+awk x=1 awk echo -eu readonly && export awk x=1 sed export sed &&
+		-eu export x=1 echo echo echo x=1 ${HOME} cd "$1" | cd ${HOME} | grep awk test
+		grep done then ${HOME} 'quoted text' 2>/dev/null sed test ${HOME}
+	cd cd grep done | sed 2>/dev/null then then cd awk "$@" -eu ${HOME} $(pwd)
+	x=1 awk local export | | cd
+	readonly readonly /usr/bin grep x=1 export local x=1 awk 2>/dev/null
+		"$1" /usr/bin 2>/dev/null printf
+done test readonly sed printf awk cd local 2>/dev/null
+-eu sed readonly && readonly then export
+	-eu grep 'quoted text' export | then local local cd
+	${HOME} awk done then "$1" x=1 cd readonly
+cd --verbose "$1" ${HOME} readonly 'quoted text'
+	'quoted text' done awk export && /usr/bin
+		echo readonly | echo echo | x=1 grep $(pwd) readonly
+/usr/bin "$1" awk 2>/dev/null &&
+		echo && 'quoted text' printf
+	cd grep --verbose test awk && ${HOME} local readonly | -eu cd $(pwd) 'quoted text'
+sed -eu test sed grep grep sed printf awk export sed $(pwd) 2>/dev/null /usr/bin
+		awk --verbose -eu | -eu && then /usr/bin done
+	--verbose local done 2>/dev/null 'quoted text' test
+	$(pwd) echo /usr/bin awk printf export
+		&& awk ${HOME} 2>/dev/null 'quoted text' cd export test
+		echo "$1" echo printf -eu "$@" echo
+	grep x=1 test /usr/bin 2>/dev/null
+--verbose grep $(pwd) echo export then export
+	$(pwd) x=1 $(pwd) sed --verbose ${HOME} cd readonly grep /usr/bin x=1
+		/usr/bin printf -eu $(pwd) ${HOME} "$1" "$1" export echo grep | echo
+	/usr/bin --verbose then cd export printf 'quoted text'
+		--verbose 2>/dev/null cd
+	x=1 'quoted text' then cd sed && $(pwd) export echo local sed
+	--verbose grep ${HOME} cd /usr/bin 2>/dev/null awk --verbose readonly
+	done grep readonly test then "$@" echo export grep $(pwd)
+done x=1 /usr/bin $(pwd) "$1" 'quoted text'
+	'quoted text' --verbose cd ${HOME} printf
+grep "$1" | "$@" --verbose --verbose /usr/bin "$@" | then 2>/dev/null
+awk ${HOME} then | /usr/bin export x=1 sed
+		awk echo --verbose | awk test local printf $(pwd) -eu export --verbose /usr/bin
+	2>/dev/null cd ${HOME} ${HOME} test | --verbose awk && grep | awk "$1"
+		readonly 2>/dev/null | test test test
+grep | test test $(pwd) x=1
+printf test -eu readonly then test sed 'quoted text'
+	cd cd done ${HOME} printf x=1 test readonly && x=1 2>/dev/null
+		| printf readonly "$@" done
+	/usr/bin 'quoted text' done ${HOME} 2>/dev/null echo
+	x=1 2>/dev/null && done 'quoted text' x=1 test test printf
+		cd printf -eu && grep sed awk
+	"$1" -eu 2>/dev/null export
+	printf "$1" "$@" then && readonly readonly 'quoted text' export --verbose printf
+	x=1 'quoted text' printf then x=1 sed &&
+	sed x=1 done -eu printf sed --verbose test test printf 2>/dev/null ${HOME} printf
+		--verbose test x=1 "$@" done local sed && echo sed printf export "$@" | then
+		-eu readonly -eu local /usr/bin -eu readonly
+--verbose then --verbose
+| && echo --verbose &&
+2>/dev/null then readonly && echo x=1 "$@" x=1 --verbose
+		test $(pwd) export 2>/dev/null echo -eu cd sed readonly sed --verbose
+printf awk && 'quoted text' done $(pwd) "$1" --verbose 'quoted text' done awk x=1
+		test awk grep done --verbose "$@" ${HOME} test 'quoted text' 2>/dev/null
+	"$1" "$@" then echo cd x=1 ${HOME} | &&
+		$(pwd) 'quoted text' then /usr/bin echo x=1 2>/dev/null local
+		'quoted text' echo export
+	-eu $(pwd) 2>/dev/null then -eu done then $(pwd) local done cd $(pwd) "$1" local
+then local --verbose export
+		/usr/bin /usr/bin -eu ${HOME} "$@" local sed local
+	x=1 local /usr/bin echo cd 2>/dev/null "$@" 'quoted text' then
+	/usr/bin cd 'quoted text' -eu | printf && printf -eu 2>/dev/null readonly
+	then done readonly 2>/dev/null --verbose --verbose echo then ${HOME} ${HOME} test
+-eu then /usr/bin export awk x=1 x=1 "$1" /usr/bin then readonly "$@"
+readonly x=1 --verbose $(pwd) $(pwd) echo sed /usr/bin cd $(pwd) -eu 'quoted text'
+		cd readonly readonly && x=1 "$@" readonly -eu --verbose "$1" grep 'quoted text'
+"$@" sed awk | then then && export
+test --verbose $(pwd) 'quoted text' awk echo "$@" export
+sed then ${HOME} ${HOME} x=1 then | 'quoted text' | $(pwd) 'quoted text'
+--verbose "$@" x=1 echo cd -eu $(pwd) local cd
+	&& echo awk x=1 readonly && cd
+$(pwd) printf sed sed x=1 --verbose awk grep --verbose then x=1 awk -eu
+		test done 'quoted text' --verbose printf ${HOME} readonly sed 2>/dev/null done
+	cd grep /usr/bin && export
+		cd grep /usr/bin && readonly
+	export /usr/bin /usr/bin 'quoted text' printf printf x=1
+"$@" ${HOME} x=1 done cd x=1 grep readonly done export sed done echo /usr/bin
+x=1 cd local && 2>/dev/null
+		grep printf x=1 | test "$@" export then then test then -eu export 'quoted text'
+	-eu then 'quoted text' readonly grep $(pwd) sed x=1 local | 2>/dev/null printf
+--verbose export done awk 2>/dev/null && |
+--verbose echo readonly then
+		export $(pwd) "$@" 2>/dev/null 'quoted text' echo sed x=1 done $(pwd)
+/usr/bin local -eu -eu echo ${HOME} | 2>/dev/null && /usr/bin then grep local
+	/usr/bin grep "$1" /usr/bin
+	awk printf $(pwd) test && 'quoted text' echo grep -eu
+		cd $(pwd) test $(pwd) readonly && 'quoted text'
+	/usr/bin "$@" /usr/bin -eu ${HOME} --verbose && sed echo x=1 done sed
+done /usr/bin ${HOME} local
+$(pwd) ${HOME} ${HOME} ${HOME} grep then $(pwd)
+	cd -eu local $(pwd) "$1" readonly test | && "$1" $(pwd) | sed $(pwd) cd awk 'quoted text'
+	then 2>/dev/null | awk then $(pwd) printf
+		x=1 /usr/bin 'quoted text' test
+${HOME} awk ${HOME} readonly grep then cd -eu grep | local
+	"$1" then readonly x=1 grep cd | ${HOME} x=1 && readonly cd
+		--verbose test 2>/dev/null readonly awk 2>/dev/null
+		local readonly 2>/dev/null export then test readonly printf 'quoted text' test
+/usr/bin grep --verbose /usr/bin export done "$1" done awk -eu && x=1 readonly
+local ${HOME} echo sed done then then /usr/bin --verbose local
+	--verbose /usr/bin export /usr/bin --verbose
+2>/dev/null && ${HOME} printf local awk done grep then test
+		awk sed export 2>/dev/null x=1 done -eu "$1" /usr/bin
+		export /usr/bin | | --verbose echo sed 2>/dev/null ${HOME} awk
+	-eu x=1 2>/dev/null ${HOME} 2>/dev/null | 'quoted text' local awk
+--verbose && ${HOME} local "$1" 2>/dev/null echo 'quoted text'
+	x=1 sed then "$1" done echo local readonly && ${HOME} 'quoted text'
+	"$@" --verbose x=1 --verbose
+&& $(pwd) printf export then export cd sed $(pwd)
+sed --verbose -eu echo echo grep /usr/bin $(pwd)
+		$(pwd) cd x=1 $(pwd) echo | done 'quoted text' grep | readonly export -eu -eu
+cd grep x=1 2>/dev/null done readonly then
+		done --verbose | 2>/dev/null 'quoted text'
+	$(pwd) "$1" 2>/dev/null 2>/dev/null grep
+grep --verbose test local echo test
+		sed export export | 2>/dev/null
+		grep export local test | x=1 sed done readonly
+	2>/dev/null grep 'quoted text' "$@" printf 2>/dev/null local --verbose $(pwd)
+	"$@" -eu --verbose echo test && 'quoted text' grep "$1" "$@" grep "$@" local
+		done cd grep test "$@" 2>/dev/null readonly --verbose -eu
+printf /usr/bin test ${HOME} test
+2>/dev/null test test then awk local && echo "$@" -eu "$1" $(pwd) sed local ${HOME}
+		2>/dev/null "$1" awk echo export echo x=1 x=1 grep /usr/bin
+--verbose echo awk then /usr/bin awk awk "$1" "$@" echo /usr/bin test
+	"$@" -eu export && 2>/dev/null
+	x=1 x=1 | done cd awk 'quoted text' --verbose sed /usr/bin
+		awk 2>/dev/null echo grep
+		--verbose cd awk then readonly --verbose /usr/bin x=1 awk -eu cd readonly grep
+echo 2>/dev/null test readonly
+		'quoted text' $(pwd) ${HOME} export ${HOME} "$@" readonly
+	cd local ${HOME} export -eu x=1 done -eu local | $(pwd) awk 'quoted text' awk
+		grep x=1 printf local $(pwd) -eu readonly
+		sed --verbose 2>/dev/null x=1 -eu export awk readonly "$1" test "$@" test "$@"
+export --verbose && 'quoted text' export awk awk && && sed "$1" echo --verbose
+printf test -eu "$@" echo then cd test cd 2>/dev/null readonly echo "$@"
+	'quoted text' && readonly 'quoted text' "$1" 2>/dev/null /usr/bin /usr/bin
+	--verbose | && echo /usr/bin
+		cd test sed "$@" export ${HOME} sed readonly
+x=1 then --verbose x=1 --verbose
+		local -eu x=1 readonly cd grep "$1" "$@" cd then sed $(pwd) printf echo
+	-eu | readonly "$1" printf 2>/dev/null
+then echo done -eu readonly "$1"
+		x=1 cd $(pwd) 'quoted text' echo test && ${HOME} local grep -eu readonly
+	awk readonly local x=1 -eu
+		readonly ${HOME} 2>/dev/null | "$@" --verbose $(pwd)
+		2>/dev/null 2>/dev/null "$1"
+grep printf 'quoted text' cd "$1" $(pwd) "$@" 'quoted text'
+		cd && x=1 && "$@" test export x=1 "$1" export && printf "$1" export cd local x=1
+local ${HOME} "$1" && x=1 cd | grep --verbose export
+&& "$1" grep done | && printf export --verbose
+export grep "$@" 'quoted text' -eu /usr/bin | export readonly test --verbose sed
+		${HOME} echo --verbose done --verbose "$@" 2>/dev/null
+		$(pwd) 'quoted text' awk readonly
+		| grep readonly awk /usr/bin
+		done ${HOME} "$1" then | then test readonly "$@" $(pwd) grep
+	done x=1 test export awk echo $(pwd) $(pwd) local done 2>/dev/null
+readonly done /usr/bin echo local test "$1" export | 2>/dev/null done awk
+&& 'quoted text' then "$@" then --verbose -eu x=1 done -eu sed sed $(pwd)
+	cd $(pwd) ${HOME} &&
+	'quoted text' export -eu x=1 $(pwd) printf
+		export awk sed $(pwd) cd
+		"$@" x=1 echo 'quoted text' printf done 'quoted text' "$@" cd "$@"
+		"$@" && export "$1" echo
+		sed x=1 && done done done grep export 2>/dev/null local local readonly 'quoted text'
+	--verbose echo grep /usr/bin 'quoted text' test test
+	local printf printf done --verbose "$1" readonly
+	-eu awk x=1 grep cd grep then && test "$1" | grep sed printf
+	| && | "$1" x=1 awk export sed ${HOME} $(pwd) test | export
+		grep --verbose sed -eu | readonly local grep && 'quoted text' readonly test
+2>/dev/null readonly export -eu /usr/bin
+	then then --verbose 'quoted text' echo sed | |
+/usr/bin /usr/bin readonly cd 2>/dev/null grep ${HOME}
+		-eu 'quoted text' grep export
+done && | 'quoted text' && "$1" readonly local
+		done --verbose -eu export -eu echo test | local awk then echo $(pwd)
+		/usr/bin ${HOME} x=1 grep test /usr/bin export && /usr/bin
+		${HOME} grep && grep --verbose
+		then 2>/dev/null grep "$1" -eu $(pwd) && done /usr/bin export 'quoted text'
+	export grep done 'quoted text' /usr/bin
+printf local test --verbose ${HOME} export --verbose && ${HOME} local
+sed ${HOME} 'quoted text' "$@" $(pwd) then
+		readonly sed | test grep && readonly ${HOME} echo
+	2>/dev/null cd | grep --verbose sed export $(pwd) local -eu /usr/bin 'quoted text'
+	x=1 awk cd /usr/bin | | cd /usr/bin export -eu
+	&& && | then test done 2>/dev/null
+x=1 -eu && done echo | | export grep test test export 2>/dev/null $(pwd)
+${HOME} "$1" sed $(pwd) 2>/dev/null ${HOME} sed sed local
+	-eu ${HOME} "$1" then 'quoted text' && x=1 x=1 "$1"
+		| export && "$1" sed done cd sed done test export x=1 "$1" awk echo awk printf
+	echo 2>/dev/null | cd awk $(pwd) -eu cd awk "$@" sed "$@" --verbose "$1" awk /usr/bin
+		export export /usr/bin printf cd 'quoted text'
+	export "$@" "$@" 'quoted text' then $(pwd) grep
+		-eu ${HOME} 'quoted text' local readonly
+	x=1 echo --verbose x=1 --verbose "$@" /usr/bin
+	&& echo export && cd "$@" awk "$@" ${HOME}
+		awk $(pwd) test 'quoted text' --verbose printf
+grep export $(pwd) -eu printf $(pwd) grep grep --verbose 'quoted text' grep readonly
+		${HOME} | ${HOME} /usr/bin ${HOME} -eu 2>/dev/null test $(pwd) 2>/dev/null
+		test | -eu grep export awk echo "$@" printf readonly readonly grep x=1
+	'quoted text' 2>/dev/null "$1" echo awk $(pwd) sed
+	$(pwd) echo export readonly x=1 awk ${HOME} local "$1" local x=1 test 'quoted text'
+		awk export $(pwd) awk x=1 grep awk x=1 export -eu sed
+awk | echo local 'quoted text' --verbose
+		| | && sed then awk $(pwd) --verbose sed "$@" printf
+	$(pwd) x=1 cd ${HOME} "$1" 2>/dev/null test $(pwd)
+	then awk "$1" local grep
+		2>/dev/null echo "$1" grep x=1 sed printf
+2>/dev/null local test
+		done export echo grep printf test x=1 done 'quoted text'
+	| ${HOME} 2>/dev/null $(pwd) readonly $(pwd)
+		$(pwd) --verbose && 2>/dev/null
+		grep test "$1" && 2>/dev/null $(pwd) 2>/dev/null -eu grep x=1 "$1" sed
+	test $(pwd) | export $(pwd)
+printf | | /usr/bin -eu
+	| /usr/bin && printf && /usr/bin 'quoted text'
+-eu ${HOME} test local /usr/bin 2>/dev/null --verbose cd export
+	test then local "$1" readonly grep "$1" echo
+local then | 2>/dev/null echo then sed
+		readonly printf ${HOME} "$@" /usr/bin "$@" && awk && && -eu printf
+		-eu | --verbose echo -eu /usr/bin awk awk $(pwd)
+	"$@" -eu "$1" sed awk done x=1 ${HOME} local printf $(pwd)
+		'quoted text' $(pwd) -eu && /usr/bin
+	readonly 2>/dev/null | printf export test "$@"
+	grep 2>/dev/null grep
+then 2>/dev/null readonly /usr/bin done awk 'quoted text'
+		--verbose "$1" && 'quoted text' then awk --verbose awk $(pwd)
+/usr/bin --verbose test $(pwd) done export done -eu -eu cd --verbose
+		export | /usr/bin "$1" -eu export ${HOME} then echo "$1" ${HOME}
+		then | | readonly && && cd | cd echo $(pwd) -eu
+		cd readonly cd readonly && x=1 x=1 2>/dev/null local $(pwd) "$1" echo &&
+		2>/dev/null ${HOME} done local "$@" printf done
+		echo x=1 'quoted text' export export cd cd $(pwd) ${HOME} done export then $(pwd)
+		test cd printf /usr/bin printf printf sed local done printf
+test $(pwd) export then test export x=1 | --verbose 2>/dev/null readonly done "$@"
+2>/dev/null echo test -eu ${HOME} readonly cd test
+printf printf && "$1" cd /usr/bin sed $(pwd) test -eu ${HOME} "$@"
+2>/dev/null then export && local then echo readonly | && readonly
+'quoted text' --verbose echo && printf awk echo | -eu &&
+		"$@" $(pwd) cd sed | "$@" export "$1" x=1 then 'quoted text' done printf test
+	'quoted text' done awk test done
+-eu -eu awk 'quoted text' then awk printf
+		"$@" "$@" test ${HOME} test -eu test echo 2>/dev/null ${HOME}
+local test /usr/bin ${HOME}
+	echo printf "$1" then "$1" "$@" echo readonly done /usr/bin && "$1" local x=1
+		sed ${HOME} test ${HOME} awk "$1" && grep done done
+		printf 'quoted text' sed | "$@"
+	grep done cd /usr/bin printf --verbose
+	${HOME} local "$@" 2>/dev/null grep | x=1 && sed sed "$1" cd -eu export
+-eu readonly readonly $(pwd)
+		$(pwd) "$@" 'quoted text' $(pwd) local then $(pwd) done test --verbose 'quoted text'
+readonly test readonly export | $(pwd) "$1" x=1 | -eu done 'quoted text' 2>/dev/null
+		x=1 grep done ${HOME} printf local grep sed readonly done 2>/dev/null $(pwd)
+printf x=1 -eu | then x=1 | $(pwd) cd readonly echo local "$1" readonly
+printf "$@" "$@" 2>/dev/null -eu sed 2>/dev/null
+"$1" "$1" sed printf ${HOME} -eu && awk /usr/bin echo local export 2>/dev/null
+	2>/dev/null 'quoted text' -eu "$@" 2>/dev/null && echo $(pwd)
+		local echo grep grep cd -eu
+echo cd sed done echo readonly 'quoted text' | -eu export done done readonly
+		${HOME} 2>/dev/null echo export ${HOME} "$@" readonly 'quoted text'
+	export then readonly "$@" && done 2>/dev/null printf
+	--verbose $(pwd) sed awk printf awk readonly awk && 'quoted text'
+	test printf sed cd 'quoted text' -eu export x=1 export x=1 "$@" "$1" grep
+		2>/dev/null then -eu -eu test export 'quoted text' echo
+	cd "$@" readonly /usr/bin | ${HOME} sed grep then test cd --verbose test
+	"$1" export && done /usr/bin ${HOME} sed test echo readonly echo "$1"
+		/usr/bin 'quoted text' local local sed export
+	local /usr/bin $(pwd) local local $(pwd) "$1" /usr/bin
+	echo $(pwd) printf done "$@" | test grep $(pwd) sed test ${HOME} export
+x=1 printf $(pwd) echo /usr/bin /usr/bin echo "$1" test cd local then /usr/bin
+printf ${HOME} export --verbose
+		$(pwd) readonly grep ${HOME} /usr/bin awk 'quoted text'
+	"$@" && /usr/bin done awk -eu awk
+		x=1 local export echo -eu | cd echo test
+	x=1 awk ${HOME} local printf && ${HOME} echo test local done
+	$(pwd) done | echo printf ${HOME} grep done then grep cd grep 2>/dev/null
+then 2>/dev/null readonly awk done 2>/dev/null
+grep sed cd "$@" 'quoted text' 'quoted text'
+	test -eu -eu awk | sed sed then ${HOME} done "$@" then x=1 then test grep cd
+	awk ${HOME} local "$@" ${HOME}
+		&& x=1 then test then echo echo ${HOME} | echo -eu
+"$@" --verbose awk then grep readonly then printf local x=1 | 2>/dev/null
+$(pwd) "$1" readonly grep sed
+grep -eu printf -eu readonly ${HOME} awk local && && test readonly -eu x=1
+		$(pwd) awk | echo --verbose
+/usr/bin 'quoted text' x=1 -eu done /usr/bin awk 2>/dev/null
+		2>/dev/null printf local local awk awk $(pwd) -eu ${HOME}
+	| grep && -eu readonly x=1 printf ${HOME} x=1 local "$1" && sed done cd /usr/bin
+	/usr/bin readonly && 2>/dev/null "$1" "$1" grep --verbose
+		grep printf $(pwd) sed /usr/bin ${HOME} | "$@" -eu
+"$@" 2>/dev/null | "$@"
+	"$@" printf awk "$@" echo && readonly -eu | local readonly x=1 2>/dev/null
+		-eu 2>/dev/null ${HOME} 2>/dev/null
+		then --verbose local x=1 --verbose
+	$(pwd) ${HOME} --verbose test readonly local 'quoted text'
+	then 2>/dev/null && awk awk
+"$1" $(pwd) grep done 'quoted text'
+		"$1" local && test export done --verbose test awk --verbose
+--verbose grep --verbose -eu export cd x=1 /usr/bin done sed printf
+		-eu printf 'quoted text' awk --verbose awk then ${HOME}
+	${HOME} "$1" then ${HOME} $(pwd) printf 'quoted text'
+${HOME} readonly && $(pwd) then cd cd "$1" /usr/bin "$@" then readonly awk
+	x=1 done -eu then 'quoted text' ${HOME} test 2>/dev/null then | "$@" awk $(pwd)
+	test cd local printf | | 2>/dev/null
+export -eu test cd then
+printf readonly --verbose 2>/dev/null readonly export $(pwd) ${HOME}
+	printf then && local awk "$1" printf 'quoted text' local sed awk export readonly
+		grep sed --verbose then "$1" && done cd sed grep x=1 x=1 2>/dev/null
+2>/dev/null cd test awk $(pwd) ${HOME} local $(pwd) awk -eu readonly
+	echo readonly awk --verbose echo "$1" printf
+		test "$1" ${HOME} export test x=1 local /usr/bin then | | ${HOME} ${HOME}
+		sed printf -eu --verbose "$@" export x=1 "$1" ${HOME} ${HOME} then
+printf printf "$1" readonly --verbose -eu ${HOME} done /usr/bin --verbose
+		--verbose grep printf ${HOME} "$@" -eu readonly /usr/bin echo && then
+| && local "$1" then readonly echo -eu /usr/bin printf
+	"$@" grep /usr/bin ${HOME} then printf "$@" -eu cd echo cd readonly
+		--verbose cd readonly test 2>/dev/null
+	printf -eu test "$@" "$1" export awk $(pwd)
+	x=1 sed test export "$@" sed echo sed 2>/dev/null
+--verbose x=1 | echo then printf local -eu ${HOME} cd "$@" --verbose "$@"
+	&& && local grep then x=1 | $(pwd) -eu ${HOME} awk test 2>/dev/null
+printf awk then echo printf && "$1" test 'quoted text' awk /usr/bin
+		echo printf export done -eu "$1" done | "$@" 2>/dev/null local /usr/bin
+	sed /usr/bin local ${HOME} then
+done --verbose 2>/dev/null readonly sed | readonly local -eu grep
+$(pwd) test $(pwd) 2>/dev/null awk -eu /usr/bin echo "$1" local && done
+		readonly export x=1 then 'quoted text'
+	test sed readonly sed "$@" 2>/dev/null x=1 test $(pwd)
+		echo $(pwd) ${HOME} --verbose ${HOME} awk then /usr/bin -eu echo
+	local sed echo local export cd grep
+	| cd x=1 "$@" /usr/bin "$@"
+2>/dev/null 2>/dev/null awk && 2>/dev/null export local sed awk /usr/bin "$@" $(pwd)
+| ${HOME} test "$@" sed "$1" $(pwd) cd /usr/bin then export awk
+echo x=1 export 2>/dev/null "$1" 'quoted text' done test x=1
+		2>/dev/null grep ${HOME} done | sed ${HOME}
+		done export then export local -eu 'quoted text' -eu "$1" echo
+		$(pwd) --verbose echo test done -eu && | x=1 then ${HOME} then
+readonly | -eu grep | local -eu then awk --verbose --verbose sed
+| $(pwd) 'quoted text' grep readonly
+local printf | && awk $(pwd) then && x=1 "$1" readonly sed grep
+	&& ${HOME} "$1" | 2>/dev/null
+		export awk awk | 'quoted text'
+		--verbose sed printf x=1 "$@" test | | printf /usr/bin -eu grep grep ${HOME}
+		test | sed then readonly "$@" 2>/dev/null local
+	&& awk x=1 then 'quoted text' --verbose "$1" 'quoted text'
+	${HOME} ${HOME} -eu grep $(pwd) "$@" export export readonly export
+	export -eu "$1" x=1 printf "$1" sed then && 2>/dev/null /usr/bin $(pwd)
+test awk "$@" && printf echo readonly 'quoted text'
+	2>/dev/null && sed x=1 awk ${HOME} sed readonly printf test test ${HOME}
+	grep done sed "$1" sed cd "$@" local $(pwd)
+readonly awk x=1 awk grep | test x=1 && test -eu sed grep "$1" test "$@"
+		grep x=1 2>/dev/null -eu test then sed ${HOME} export cd /usr/bin
+	'quoted text' done 2>/dev/null x=1 grep then test /usr/bin
+	'quoted text' done then local then --verbose then
+	awk $(pwd) awk printf 2>/dev/null local
+local readonly done 'quoted text' "$1" cd test cd ${HOME} printf
+		2>/dev/null 2>/dev/null grep "$1" x=1 test x=1 local
+		"$1" awk $(pwd) "$1" sed sed done
+		then done sed readonly cd -eu done "$1" echo && "$1" echo then 2>/dev/null
+"$1" echo ${HOME} 2>/dev/null "$1" readonly /usr/bin
+	${HOME} local grep 'quoted text'
+	/usr/bin printf && done -eu | && /usr/bin -eu grep awk /usr/bin readonly
+		2>/dev/null "$1" readonly ${HOME}
+'quoted text' echo then sed printf awk
+sed && sed /usr/bin --verbose readonly 2>/dev/null
+printf -eu --verbose --verbose grep 'quoted text'
+	sed sed | awk x=1 awk /usr/bin x=1 awk awk readonly echo echo /usr/bin
+2>/dev/null /usr/bin "$@" export
+grep done /usr/bin then /usr/bin && x=1 awk 'quoted text'
+		-eu -eu && echo $(pwd) 'quoted text' readonly -eu test test grep
+		then $(pwd) 'quoted text' test cd echo ${HOME} "$1"
+export ${HOME} readonly
+	export $(pwd) printf --verbose printf then done x=1 2>/dev/null then done
+	local && 2>/dev/null "$@" /usr/bin
+		readonly 2>/dev/null awk local then printf -eu
+	awk "$@" 'quoted text' | -eu grep then echo
+	x=1 test export -eu cd local readonly "$1" ${HOME} cd readonly done 'quoted text'
+sed done 2>/dev/null export then readonly -eu test printf "$@" /usr/bin | "$1"
+then -eu && 'quoted text' local local && cd local sed
+	${HOME} sed local awk "$1" -eu readonly local
+		done "$@" | x=1 'quoted text' export "$@" local done awk printf
+then --verbose done 2>/dev/null "$@" --verbose cd 2>/dev/null local
+		${HOME} 'quoted text' echo ${HOME}
+		printf | grep && awk echo printf echo local $(pwd) "$1"
+		'quoted text' --verbose test done awk grep echo cd test grep awk awk local export
+	x=1 ${HOME} awk done done echo cd $(pwd) then $(pwd) 2>/dev/null
+		${HOME} "$@" readonly 'quoted text' -eu "$@" /usr/bin
+		awk "$1" "$1" grep $(pwd) grep --verbose x=1 ${HOME} "$1"
+		echo -eu --verbose "$@" done -eu 'quoted text' |
+		grep done /usr/bin echo echo --verbose echo --verbose 2>/dev/null
+	$(pwd) local "$1" readonly "$@"
+	$(pwd) | cd readonly | $(pwd) ${HOME} /usr/bin export "$1" && export 2>/dev/null
+&& --verbose ${HOME} ${HOME} echo && cd echo && $(pwd) $(pwd) export printf
+	'quoted text' | sed test test "$1" /usr/bin sed
+		cd awk local done done printf /usr/bin
+		-eu then | /usr/bin local "$1" -eu test --verbose 'quoted text' awk printf
+${HOME} local echo && export && $(pwd) --verbose
+	local && sed local echo $(pwd) awk test cd done && readonly cd test 2>/dev/null
+	sed 'quoted text' printf ${HOME} test "$@" --verbose export | cd sed export
+		"$@" $(pwd) test test then 'quoted text' $(pwd) awk | && printf
+		&& test readonly | && ${HOME} readonly ${HOME}
+${HOME} cd /usr/bin | local $(pwd) -eu readonly
+	echo "$@" grep "$@" | ${HOME} && "$1" x=1 | printf
+	sed "$@" 2>/dev/null printf --verbose x=1
+grep x=1 readonly export sed awk printf ${HOME} awk ${HOME} --verbose $(pwd) x=1
+awk awk "$@" x=1 --verbose x=1 grep
+		--verbose printf 'quoted text' awk /usr/bin $(pwd) && $(pwd) awk readonly
+	-eu sed sed grep done grep "$@" 2>/dev/null
+echo echo | -eu then $(pwd) done 'quoted text'
+		awk echo x=1 ${HOME} local readonly $(pwd)
+x=1 test readonly test test
+awk echo && cd --verbose 2>/dev/null
+	--verbose printf /usr/bin printf export
+		&& "$1" then 'quoted text' printf 2>/dev/null readonly
+-eu echo ${HOME} -eu 'quoted text'
+$(pwd) done && sed grep grep printf done && "$1" echo /usr/bin
+	local done grep test export $(pwd) grep
+	2>/dev/null export readonly | printf "$1" 2>/dev/null readonly 2>/dev/null
+		--verbose --verbose then local x=1 $(pwd) export local $(pwd) awk
+-eu done --verbose -eu
+sed /usr/bin export printf readonly awk -eu awk printf "$1" done sed done 2>/dev/null
+	readonly /usr/bin awk cd readonly grep readonly awk
+		done printf -eu cd test readonly x=1 then echo export awk && | $(pwd)
+		printf | test printf echo
+	$(pwd) 'quoted text' local export local readonly && readonly && x=1 awk -eu $(pwd)
+printf printf done "$@" --verbose
+		"$1" /usr/bin grep printf grep test echo test && awk
+| $(pwd) 'quoted text' ${HOME} "$@" then cd test export --verbose ${HOME} | $(pwd)
+		cd test x=1 readonly echo then sed grep | --verbose 'quoted text'
+	grep "$@" sed $(pwd) test awk $(pwd) done sed test -eu printf |
+		sed cd readonly local export printf printf sed &&
+$(pwd) ${HOME} cd x=1 test
+	sed done --verbose "$1" -eu /usr/bin then "$@" sed sed grep readonly
+	-eu "$@" "$1" /usr/bin done -eu /usr/bin "$@" test test echo -eu "$@" x=1 then
+	${HOME} done && printf ${HOME} local local awk && "$@" 'quoted text'
+		echo $(pwd) 'quoted text' ${HOME} 'quoted text'
+		sed local ${HOME} | local
+| 'quoted text' /usr/bin readonly 2>/dev/null cd printf ${HOME}
+		$(pwd) 'quoted text' x=1 "$1" 2>/dev/null &&
+	"$1" "$@" 'quoted text' 2>/dev/null /usr/bin
+x=1 awk echo $(pwd) awk 2>/dev/null sed 2>/dev/null
+then readonly | 'quoted text' then local export
+	awk grep local 'quoted text'
+		| test export printf --verbose then /usr/bin sed export -eu sed 'quoted text'
+	sed x=1 ${HOME} cd x=1
+		local 'quoted text' then then && echo local ${HOME} echo cd
+'quoted text' /usr/bin && /usr/bin export /usr/bin awk done readonly
+		local ${HOME} grep "$@" done "$@" local awk $(pwd) -eu | 2>/dev/null
+		&& export printf | $(pwd) -eu && "$@" | $(pwd) $(pwd) then cd then grep
+		&& local 2>/dev/null x=1 x=1 then -eu local then
+	"$1" readonly "$@" /usr/bin test "$@" --verbose printf -eu $(pwd) readonly
+		done echo echo local "$@" "$1" 'quoted text' done export
+		$(pwd) ${HOME} "$1" $(pwd) echo /usr/bin "$1" echo done
+"$@" test 2>/dev/null -eu cd ${HOME} /usr/bin x=1 ${HOME} 2>/dev/null
+	sed -eu 'quoted text' readonly | ${HOME} --verbose $(pwd) local --verbose
+${HOME} x=1 printf "$@" export test local sed export 'quoted text'
+		echo echo $(pwd) "$@" cd $(pwd)
+then awk cd -eu -eu "$@" local -eu $(pwd)
+test then -eu readonly export /usr/bin "$1" grep then
+		&& grep "$@" x=1 sed --verbose $(pwd) readonly
+	echo printf printf 2>/dev/null
+	x=1 readonly awk cd cd grep "$1" export
+	local "$1" echo && -eu export local 2>/dev/null
+	2>/dev/null --verbose
+	"$1" ${HOME} | grep "$1" /usr/bin 'quoted text'
+		awk x=1 | "$@" done printf export 2>/dev/null | 2>/dev/null
+		awk && local cd sed sed 'quoted text' done export x=1 test
+	echo && $(pwd) ${HOME} cd test ${HOME} echo 2>/dev/null "$1" x=1 awk --verbose
+		$(pwd) 'quoted text' --verbose export cd x=1 $(pwd) | && readonly readonly cd
+	cd awk 'quoted text' echo echo local then /usr/bin && done
+	done echo awk -eu printf x=1 'quoted text' sed "$@" test echo && "$1" awk echo
+	2>/dev/null $(pwd) | | x=1 2>/dev/null && grep
+		export | --verbose 2>/dev/null export --verbose printf -eu && ${HOME} cd -eu ${HOME}
+		local | -eu then local "$@" -eu
+		printf echo export readonly $(pwd) local done x=1 export awk readonly
+	grep 'quoted text' printf test && -eu /usr/bin test ${HOME}
+	"$@" printf x=1 readonly echo 2>/dev/null "$1" grep done x=1 then local $(pwd) &&
+		"$1" then echo grep cd awk ${HOME} /usr/bin --verbose
+	test printf printf local && --verbose x=1 test | grep /usr/bin 'quoted text'
+	"$1" $(pwd) 'quoted text' export -eu then ${HOME}
+		x=1 | done 'quoted text'
+	readonly cd "$@" export
+	test export "$@" awk then
+	readonly -eu | export "$1" -eu x=1 --verbose done "$@" test -eu | local
+		export grep x=1 awk readonly -eu sed "$1" sed "$@" && x=1 && --verbose
+x=1 $(pwd) then "$@" x=1 | | done cd 'quoted text' /usr/bin then
+$(pwd) echo /usr/bin "$@" 'quoted text' $(pwd) export "$@" x=1 ${HOME}
+${HOME} echo -eu cd cd grep echo grep ${HOME}
+	$(pwd) 2>/dev/null test
+printf $(pwd) echo ${HOME} done
+		sed readonly --verbose export test readonly
+2>/dev/null test ${HOME} 'quoted text' && ${HOME} test echo && printf local
+	x=1 x=1 export printf export 'quoted text' && then cd printf 2>/dev/null -eu 'quoted text'
+printf "$1" /usr/bin printf "$1" echo && 2>/dev/null echo cd | -eu
+		x=1 grep readonly export done cd |
+&& sed "$@" local grep 2>/dev/null "$1" 'quoted text' "$@" grep readonly ${HOME}
+| -eu -eu done ${HOME} "$@" local cd test 2>/dev/null awk printf "$@"
+"$@" "$1" | /usr/bin ${HOME} local grep awk $(pwd) -eu readonly $(pwd) then --verbose
+grep awk then --verbose printf
+		sed cd && test cd grep --verbose x=1 local
+	test sed | awk export $(pwd) cd printf echo
+cd then sed "$1" "$1" ${HOME} done /usr/bin
+	$(pwd) $(pwd) cd 2>/dev/null /usr/bin x=1 /usr/bin export readonly grep
+	"$@" "$@" "$1" -eu awk -eu then cd cd sed | done sed
+		${HOME} "$@" test local then echo test "$1" export -eu test local then -eu cd
+		test local x=1 | -eu /usr/bin test sed 'quoted text' 2>/dev/null printf then
+	"$@" awk "$1" export printf x=1 | test cd "$1" "$1" $(pwd) ${HOME} "$@" awk done
+		"$@" awk awk "$@" && $(pwd) "$1" echo export local test
+$(pwd) sed ${HOME} done done -eu | grep printf
+		sed /usr/bin sed x=1 -eu | test
+	--verbose awk && cd sed test export grep echo ${HOME}
+${HOME} awk export && local && "$1" 'quoted text'
+	--verbose export "$@" readonly sed
+'quoted text' export done export readonly
+	-eu | x=1 sed test --verbose local echo 'quoted text'
+	| /usr/bin | then export done then local printf && done --verbose
+		readonly awk "$@" test
+		"$@" $(pwd) cd local && test then --verbose export /usr/bin
+	"$1" $(pwd) 2>/dev/null
+	"$1" && awk && local
+x=1 cd readonly ${HOME} x=1 local
+		test sed then ${HOME} sed x=1 local
+		grep --verbose && done /usr/bin sed echo cd sed
+		sed cd then 2>/dev/null "$1" echo --verbose $(pwd)
+2>/dev/null printf "$1" awk done echo | $(pwd) | ${HOME}
+	'quoted text' echo "$1" 'quoted text' cd
+	${HOME} 'quoted text' | grep sed -eu && test $(pwd) then $(pwd) 2>/dev/null
+echo ${HOME} then --verbose ${HOME}
+	&& 'quoted text' echo "$1" cd && -eu | 'quoted text' sed x=1 export readonly
+	-eu -eu ${HOME} export export && then "$1" -eu "$1" ${HOME}
+"$@" export --verbose "$@" && "$@" x=1
+	then grep echo "$1" x=1 local awk sed $(pwd) --verbose -eu readonly local
+	/usr/bin done x=1 && grep 'quoted text' echo /usr/bin
+printf local --verbose /usr/bin x=1 test $(pwd) 'quoted text' "$@" done &&
+done then echo cd printf local | --verbose ${HOME}
+local grep | $(pwd) test /usr/bin
+		local then "$@" cd readonly "$1" readonly ${HOME}
+	${HOME} grep | awk grep | echo cd | then "$1" "$@" "$1" readonly --verbose
+	${HOME} "$@" sed /usr/bin export done /usr/bin readonly -eu -eu $(pwd)
+		${HOME} && /usr/bin -eu | --verbose cd awk -eu
+		${HOME} then 2>/dev/null x=1 readonly
+	"$1" $(pwd) $(pwd) done -eu x=1 'quoted text' printf
+$(pwd) /usr/bin then /usr/bin sed local && 2>/dev/null
+		"$1" local done printf export local
+grep grep then $(pwd) 'quoted text'
+		--verbose awk /usr/bin --verbose printf x=1 test ${HOME} then
+echo ${HOME} 2>/dev/null then "$1" --verbose
+		awk -eu 2>/dev/null test --verbose ${HOME} test readonly -eu "$1" /usr/bin
+	printf /usr/bin printf ${HOME} awk awk local 'quoted text' export
+	sed done sed ${HOME} $(pwd) ${HOME} /usr/bin echo
+	--verbose done 2>/dev/null
+&& $(pwd) "$1" /usr/bin test --verbose
+		--verbose then awk && /usr/bin 2>/dev/null
+		test /usr/bin $(pwd) sed readonly /usr/bin ${HOME} test /usr/bin grep export ${HOME}
+	'quoted text' test "$@" /usr/bin $(pwd) "$@"
+| 'quoted text' | x=1 readonly "$@" | export printf "$1" export
+	2>/dev/null then "$1" x=1 readonly awk $(pwd)
+		-eu "$@" $(pwd) grep 'quoted text' && && | x=1 readonly readonly /usr/bin then
+		then "$@" done ${HOME} echo grep && $(pwd) --verbose ${HOME} ${HOME}
+	export 2>/dev/null printf done x=1 sed
+	cd cd then && test x=1 readonly
+		'quoted text' 2>/dev/null "$@" "$@" $(pwd) x=1 2>/dev/null
+		cd test "$@" "$1" x=1 x=1 2>/dev/null
+echo "$@" grep readonly $(pwd) ${HOME} --verbose --verbose
+	/usr/bin grep grep test --verbose
+	| then ${HOME} --verbose "$1" x=1 && done grep
+	2>/dev/null "$@" readonly && 'quoted text' awk test echo awk printf $(pwd)
+sed local export echo printf --verbose
+cd done test 2>/dev/null --verbose awk done 'quoted text'
+	done 2>/dev/null "$1" x=1 $(pwd) x=1 sed "$@" test
+		$(pwd) && 2>/dev/null grep awk export awk awk readonly
+/usr/bin && then 'quoted text' "$@"
+sed ${HOME} 'quoted text'
+	| --verbose -eu local test then ${HOME}
+"$1" sed $(pwd) sed 2>/dev/null "$1" /usr/bin echo | x=1 printf then printf
+	local echo printf --verbose | /usr/bin -eu echo test test done
+		'quoted text' cd awk cd $(pwd) test --verbose x=1 export sed -eu test grep grep
+		sed -eu local echo export "$@" printf "$1" local done test
+		| /usr/bin cd "$@" "$@" awk awk | && echo
+sed "$@" echo /usr/bin grep "$1" awk local test awk
+		echo echo | ${HOME} -eu | then grep echo then ${HOME} | echo
+		'quoted text' sed 'quoted text' $(pwd) $(pwd) done $(pwd) |
+		2>/dev/null done 'quoted text' "$1"
+	| cd grep /usr/bin --verbose ${HOME} cd $(pwd)
+		grep awk echo ${HOME} awk test test export --verbose && --verbose test then grep
+		--verbose export | cd then x=1 $(pwd) readonly export
+	-eu x=1 echo local -eu
+		test export /usr/bin | awk export test ${HOME} && cd
+		local echo 'quoted text' "$@" grep done grep
+	/usr/bin 2>/dev/null 'quoted text' 2>/dev/null
+'quoted text' 'quoted text'
+--verbose $(pwd) grep $(pwd) echo sed readonly awk local test echo done "$1" echo
+	| x=1 echo awk test && export -eu
+		local -eu /usr/bin "$1" readonly sed readonly "$@" then "$1"
+	export cd then sed readonly "$@" x=1 $(pwd) cd printf
+	-eu cd "$1" "$@" then test --verbose
+echo 2>/dev/null | then --verbose test && | 'quoted text'
+"$@" x=1 then test ${HOME} | 2>/dev/null
+	echo export awk 'quoted text' -eu && --verbose sed "$1"
+		sed readonly local && readonly x=1 sed "$@" local readonly grep -eu 'quoted text'
+		done && grep test /usr/bin x=1 printf awk sed then 'quoted text' && &&
+	sed echo /usr/bin awk 2>/dev/null "$1" x=1 && 2>/dev/null
+-eu "$1" export --verbose export
+	| "$1" export | "$1" $(pwd) && done then 2>/dev/null
+	"$@" then awk echo local then done
+		"$@" "$1" cd | x=1 then
+	awk ${HOME} then grep local --verbose -eu x=1 printf
+	| awk done --verbose local then
+		echo sed printf | --verbose 'quoted text' grep 2>/dev/null
+$(pwd) "$@" x=1 grep done readonly
+	echo "$1" awk then 'quoted text' && export readonly
+		done ${HOME} x=1 grep cd /usr/bin
+		local grep 2>/dev/null ${HOME} grep
+echo local echo 2>/dev/null printf export sed readonly done && cd then then
+"$@" echo | -eu && local export && && -eu -eu ${HOME} $(pwd) 'quoted text' readonly
+	"$1" && 2>/dev/null $(pwd) sed done | awk "$1" /usr/bin --verbose "$1" echo readonly
+		export printf 'quoted text' 2>/dev/null
+done sed sed local echo x=1 sed done 2>/dev/null 2>/dev/null
+		test readonly /usr/bin then
+		&& echo ${HOME} x=1 export
+/usr/bin then -eu cd export -eu 2>/dev/null export -eu done
+		grep local readonly echo --verbose test | "$1"
+--verbose done awk sed awk cd /usr/bin export | then printf 2>/dev/null done
+	sed "$@" $(pwd) | --verbose ${HOME} x=1 sed 2>/dev/null cd
+	--verbose 2>/dev/null $(pwd) 2>/dev/null --verbose $(pwd) then
+2>/dev/null "$@" -eu ${HOME} 2>/dev/null grep | x=1 done
+awk awk export "$1" test 'quoted text' cd done local readonly
+		awk x=1 /usr/bin "$1" /usr/bin
+		"$1" echo --verbose test done cd x=1 grep
+		printf grep grep echo -eu -eu done x=1 /usr/bin 2>/dev/null --verbose "$@"
+sed then export then /usr/bin
+		$(pwd) "$1" ${HOME} cd echo /usr/bin test readonly printf $(pwd) "$1" /usr/bin
+		$(pwd) sed x=1 cd grep /usr/bin 2>/dev/null "$1"
+		sed echo "$1" -eu /usr/bin cd "$1"
+printf | --verbose $(pwd) && cd $(pwd) | readonly then $(pwd) 'quoted text'
+awk export cd test local | && cd /usr/bin "$@" -eu echo
+test "$1" "$1" 'quoted text'
+	local "$@" 'quoted text' /usr/bin printf test 'quoted text' grep echo && ${HOME}
+export echo x=1 2>/dev/null 'quoted text'
+$(pwd) --verbose grep awk printf local
+	${HOME} sed sed local grep "$1" then ${HOME}
+		test "$1" printf then "$1" local export cd sed export
+| sed local done awk cd | awk | && -eu export export local x=1
+${HOME} echo test "$1" --verbose cd "$1" "$1" &&
+$(pwd) && 'quoted text' /usr/bin
+sed test ${HOME} "$@" 2>/dev/null then $(pwd)
+	then test | test "$@" "$1" | 'quoted text' "$1" printf -eu | echo /usr/bin
+	-eu cd echo awk ${HOME} export && "$1"
+	export test done $(pwd) 'quoted text'
+/usr/bin awk then | test ${HOME} sed grep 'quoted text' local x=1
+		--verbose 2>/dev/null ${HOME}
+	echo /usr/bin cd readonly local export done && | $(pwd) | readonly 'quoted text'
+readonly test then awk awk printf local test sed
+"$1" then local 2>/dev/null test $(pwd) then ${HOME} /usr/bin && test
+		/usr/bin local $(pwd) printf grep --verbose awk export done
+-eu export /usr/bin readonly x=1
+		test 2>/dev/null | readonly x=1 grep then | 2>/dev/null
+	x=1 printf ${HOME} local then 2>/dev/null printf ${HOME} $(pwd) ${HOME} echo printf
+	export $(pwd) sed --verbose x=1 printf | done
+	--verbose -eu grep -eu
+"$1" 'quoted text' x=1 test done readonly "$1" "$@" | test test "$@" cd awk |
+		readonly sed export printf awk --verbose
+'quoted text' && "$@" $(pwd) done awk 'quoted text' grep | x=1 then done
+	cd /usr/bin && readonly printf printf done readonly
+		export export local | x=1 /usr/bin x=1 x=1 printf
+local --verbose $(pwd) awk | | |
+		awk 'quoted text' &&
+/usr/bin "$@" $(pwd) local test "$1" ${HOME} ${HOME} $(pwd)
+"$1" | x=1 readonly grep export export then "$@" $(pwd)
+	x=1 printf echo readonly -eu /usr/bin
+grep sed "$1" local readonly --verbose
+		"$1" export export "$@" $(pwd) | "$1"
+--verbose export x=1 printf
+local /usr/bin 2>/dev/null
+	${HOME} x=1 --verbose ${HOME}
+	grep 'quoted text' "$@" grep
+sed printf readonly "$@" readonly "$@"
+readonly echo --verbose /usr/bin
+		readonly cd | --verbose export printf echo x=1 -eu sed /usr/bin local local
+		export awk $(pwd) then $(pwd) printf then x=1
+/usr/bin "$@" grep "$@" | local 2>/dev/null /usr/bin | printf done done sed cd
+		grep ${HOME} 'quoted text'
+		test 'quoted text' && export printf
+	${HOME} printf sed echo | --verbose
+		local sed export 'quoted text' sed --verbose "$1" -eu && test 'quoted text'
+		2>/dev/null ${HOME} sed export grep && "$@" | $(pwd) cd && awk sed --verbose
+		cd then && && printf echo
+	2>/dev/null test done ${HOME} "$@"
+	${HOME} /usr/bin --verbose readonly --verbose awk awk done "$@" then
+"$@" cd "$1" /usr/bin
+		test awk /usr/bin "$@" test x=1 ${HOME} readonly then x=1 done sed x=1 &&
+		export && "$@" printf "$1" 'quoted text' -eu 'quoted text'
+grep | grep -eu /usr/bin
+		awk $(pwd) printf awk local /usr/bin -eu test grep sed grep local
+export "$@" then $(pwd) then
+	-eu x=1 | x=1 "$1" sed x=1 test "$1" 'quoted text' local then sed local x=1
+readonly --verbose test test -eu ${HOME} && awk local
+		'quoted text' | test done && 2>/dev/null --verbose
+		done then grep 'quoted text' x=1 --verbose done 2>/dev/null grep
+		2>/dev/null local sed printf $(pwd) -eu done
+		readonly x=1 readonly 2>/dev/null cd export "$1" grep local
+		then && $(pwd) "$1" export /usr/bin
+2>/dev/null awk | echo 'quoted text' --verbose awk && x=1 export
+		"$@" export x=1 test then readonly 'quoted text'
+export $(pwd) && /usr/bin && printf ${HOME} sed "$1" "$1" then printf
+cd done --verbose -eu -eu grep 2>/dev/null
+cd ${HOME} printf grep done /usr/bin
+	export x=1 $(pwd) 2>/dev/null ${HOME} --verbose $(pwd) 'quoted text' -eu export
+	grep ${HOME} /usr/bin sed awk awk $(pwd) -eu sed sed
+"$1" -eu done --verbose echo x=1 test 'quoted text' export
+	readonly test test && printf then 2>/dev/null
+| export ${HOME} cd ${HOME} "$@" 'quoted text'
+		sed test then -eu x=1 | grep
+		cd "$1" awk /usr/bin then sed awk -eu x=1 test
+sed local 2>/dev/null "$1" /usr/bin grep /usr/bin grep done "$@"
+		"$1" test printf 'quoted text' done -eu -eu -eu sed grep x=1 done
+		echo -eu "$1" cd sed "$1"
+printf printf "$1" done test cd echo local grep awk -eu $(pwd) local local
+		readonly sed -eu --verbose && | $(pwd) 'quoted text' awk
+sed export x=1 cd x=1 printf then test "$1"
+	x=1 "$@" "$1" x=1 "$1" && test $(pwd) grep awk echo 'quoted text'
+--verbose sed cd grep "$@" --verbose 'quoted text' sed done ${HOME}
+sed then ${HOME} | && 2>/dev/null printf /usr/bin
+	$(pwd) printf done local test sed cd $(pwd)
+local printf "$1" test "$1" grep | echo -eu export test sed awk 'quoted text'
+		export | x=1 echo | -eu x=1 2>/dev/null 2>/dev/null ${HOME} then echo
+		cd cd $(pwd) export done readonly 2>/dev/null then sed /usr/bin printf awk
+--verbose echo grep readonly -eu test cd | export sed | "$1"
+		"$@" "$@" done awk echo && cd local test "$@" $(pwd)
+${HOME} /usr/bin echo 2>/dev/null
+awk local local 2>/dev/null export && | --verbose
+&& ${HOME} export 'quoted text' test $(pwd) 2>/dev/null
+then 'quoted text' $(pwd) echo readonly | awk
+		cd awk 2>/dev/null cd test 'quoted text' test printf
+	cd -eu done local $(pwd) sed local && --verbose done $(pwd) awk printf then local
+	&& 'quoted text' local done then $(pwd) 2>/dev/null echo local 'quoted text'
+		printf readonly x=1 readonly
+	x=1 "$@" ${HOME} $(pwd) awk "$1" -eu awk "$1" cd
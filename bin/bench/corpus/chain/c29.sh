@@ -0,0 +1,2001 @@
+		"$1" awk /usr/bin --verbose done export readonly local $(pwd) echo echo 2>/dev/null
+	then /usr/bin done test 'quoted text' x=1 readonly test local echo
+"$1" test export x=1 printf $(pwd)
+	grep 'quoted text' readonly --verbose
+		export printf readonly -eu awk grep --verbose export
+	-eu "$@" x=1 printf grep readonly grep test "$@" "$1" awk
+| then cd x=1 export $(pwd) cd awk $(pwd) | "$@"
+local printf && export sed 2>/dev/null $(pwd) 'quoted text' "$1" /usr/bin done export
+		then done && grep local printf 'quoted text' -eu sed
+	test readonly echo "$1" readonly
+cd $(pwd) export 2>/dev/null ${HOME} sed
+		test $(pwd) done cd | &&
+	grep /usr/bin /usr/bin
+	-eu export x=1 sed -eu test
+awk export 2>/dev/null ${HOME} "$1" ${HOME}
+grep 2>/dev/null /usr/bin readonly "$1" echo --verbose --verbose x=1 done
+		done 2>/dev/null test echo printf -eu then
+'quoted text' && readonly echo
+	then $(pwd) $(pwd) "$@" printf test readonly printf awk sed --verbose "$@"
+		'quoted text' && -eu --verbose "$@" printf | test echo x=1 test
+		"$1" /usr/bin "$@" $(pwd) "$@" 'quoted text' export done ${HOME}
+		--verbose awk "$@" -eu "$@" && test sed test ${HOME}
+		"$1" local cd "$1" 2>/dev/null grep done ${HOME} readonly 'quoted text' sed
+		export $(pwd) /usr/bin readonly
+2>/dev/null awk "$@" && /usr/bin echo test local "$1" /usr/bin sed
+then -eu export grep then "$@" test && /usr/bin printf done done
+then sed test sed sed --verbose
+	--verbose | sed --verbose $(pwd) ${HOME}
+	readonly awk | --verbose echo export "$@"
+done --verbose cd "$@" ${HOME} done $(pwd) /usr/bin 'quoted text' x=1 "$@" 'quoted text'
+	| x=1 $(pwd) x=1 /usr/bin 2>/dev/null
+		2>/dev/null then readonly x=1 export && -eu 'quoted text'
+		test printf --verbose "$@" -eu
+export && $(pwd) export "$1" printf then "$@"
+		test echo grep "$1" -eu sed local --verbose
+test 2>/dev/null "$1" then /usr/bin
+	cd readonly sed ${HOME} export /usr/bin | -eu $(pwd) cd /usr/bin
+		| then cd -eu test local then echo 2>/dev/null "$@" export x=1
+$(pwd) x=1 && /usr/bin x=1 cd $(pwd) echo "$1" done
+awk $(pwd) --verbose && /usr/bin echo "$1" test $(pwd) local readonly sed test
+		readonly local grep test "$@" 'quoted text' cd $(pwd) /usr/bin cd 'quoted text'
+cd | cd /usr/bin | export x=1 done $(pwd) printf awk 2>/dev/null 2>/dev/null
+		'quoted text' done readonly then "$1" x=1 grep grep
+		printf /usr/bin /usr/bin
+		grep cd printf readonly export $(pwd) ${HOME} done done test 2>/dev/null
+echo export "$@" echo local --verbose
+	printf readonly x=1 cd && cd awk test --verbose -eu ${HOME} -eu 2>/dev/null
+		sed 2>/dev/null --verbose "$@" | readonly ${HOME}
+	| readonly awk | x=1 /usr/bin cd echo printf $(pwd) | done sed
+	&& test done --verbose "$1" local readonly printf
+		--verbose readonly 2>/dev/null printf
+	then ${HOME} printf | readonly
+echo cd x=1 2>/dev/null && "$@"
+-eu x=1 done printf x=1 x=1 ${HOME} cd readonly sed local
+		x=1 2>/dev/null 'quoted text' cd -eu | |
+| 2>/dev/null printf 'quoted text' -eu 'quoted text'
+		sed test 'quoted text' printf x=1 -eu local cd | readonly
+		| then x=1 cd then 2>/dev/null ${HOME} && "$@" then x=1 test
+	sed 'quoted text' printf grep export
+	"$@" ${HOME} | local grep "$1" grep awk
+		awk "$1" export grep cd test grep ${HOME} "$1" "$@" printf done test
+test sed "$@" grep /usr/bin 'quoted text' "$1" "$@" $(pwd)
+		"$@" readonly grep cd 2>/dev/null 'quoted text' readonly readonly
+	echo "$1" $(pwd) readonly printf local local -eu /usr/bin echo grep awk
+&& done then awk -eu cd test
+		"$1" echo --verbose test export ${HOME} echo x=1 echo readonly && -eu |
+"$@" done then local then awk echo cd export then
+/usr/bin readonly --verbose cd grep done grep -eu cd
+echo test x=1 awk -eu grep | cd && | test /usr/bin export ${HOME}
+	| -eu x=1 then "$@" printf test grep sed ${HOME} 'quoted text' | 'quoted text'
+local "$@" local ${HOME} "$@" ${HOME} echo grep grep readonly test
+sed /usr/bin then grep -eu sed grep $(pwd)
+	then /usr/bin done readonly 2>/dev/null ${HOME} local --verbose -eu readonly
+	readonly /usr/bin sed local x=1 "$1"
+		--verbose $(pwd) done then
+	$(pwd) --verbose $(pwd) /usr/bin cd local -eu printf
+export | then /usr/bin /usr/bin echo sed "$@" sed export sed local awk grep
+then "$@" test 2>/dev/null && $(pwd) printf echo local readonly
+	$(pwd) | export test then done "$1" readonly
+printf awk "$1" 2>/dev/null "$1" -eu echo --verbose then 2>/dev/null
+		sed export --verbose /usr/bin 'quoted text' 'quoted text'
+		'quoted text' "$1" $(pwd) x=1 "$@" done done x=1 "$1" ${HOME} "$1"
+		sed local "$@" printf sed ${HOME}
+2>/dev/null echo | -eu readonly "$1"
+"$@" local 'quoted text' printf 'quoted text' ${HOME} done "$1" done |
+	"$@" then x=1 | cd 2>/dev/null
+	-eu "$1" printf && printf
+		done "$1" local sed export "$1" export && awk export then /usr/bin export
+"$1" done local | && "$@" grep done
+	then 'quoted text' readonly --verbose | && test readonly
+	printf 2>/dev/null /usr/bin --verbose local export --verbose awk -eu done x=1
+printf done 'quoted text' local test cd --verbose -eu
+	grep | "$@" /usr/bin export awk export local "$1" "$1" $(pwd) x=1 export then
+	/usr/bin -eu -eu export x=1 'quoted text' grep -eu /usr/bin && 'quoted text'
+		echo printf sed 2>/dev/null | export done
+		readonly -eu then "$1" --verbose
+		${HOME} export | && then local
+then -eu grep test --verbose awk x=1 /usr/bin | cd $(pwd)
+	echo x=1 grep "$@" readonly local && test then ${HOME} $(pwd) readonly --verbose
+	| printf --verbose local cd 2>/dev/null cd ${HOME} /usr/bin
+	local 'quoted text' "$1" | sed export 2>/dev/null
+		echo done --verbose test grep "$1" 'quoted text' "$1" x=1 -eu
+local export grep export test && echo /usr/bin echo grep /usr/bin readonly
+	&& awk test 2>/dev/null $(pwd) export
+test ${HOME} $(pwd) readonly awk && 2>/dev/null cd printf local grep "$@"
+		&& export printf local 2>/dev/null
+	--verbose export export
+		echo $(pwd) /usr/bin 'quoted text' grep
+	&& "$1" "$1" 2>/dev/null x=1 /usr/bin ${HOME} "$1" $(pwd) && && /usr/bin
+		cd awk "$1" /usr/bin test export grep 2>/dev/null 2>/dev/null printf
+	2>/dev/null 'quoted text' x=1 awk readonly && cd awk | test export x=1 --verbose
+		readonly "$1" "$@" done "$@" /usr/bin 2>/dev/null export readonly
+	'quoted text' -eu 'quoted text'
+	2>/dev/null cd local awk
+sed && 'quoted text' sed | echo | x=1 echo test | 2>/dev/null echo
+	--verbose printf "$1" "$1" -eu printf done /usr/bin --verbose readonly
+	cd x=1 readonly cd test local $(pwd)
+cd export readonly awk local "$@" readonly ${HOME}
+		cd --verbose x=1 export ${HOME} awk sed
+		test "$1" echo sed $(pwd) test | local --verbose &&
+cd grep then && done cd awk | 2>/dev/null local "$@"
+${HOME} sed x=1 export
+local ${HOME} cd cd echo sed -eu test
+	${HOME} /usr/bin "$@"
+	2>/dev/null x=1 2>/dev/null sed --verbose ${HOME} 'quoted text'
+	done -eu test 'quoted text' -eu awk
+	"$1" 2>/dev/null cd grep
+		$(pwd) cd --verbose readonly awk then grep then
+	$(pwd) x=1 "$@" readonly grep --verbose
+	grep done 'quoted text' done cd grep --verbose
+readonly 2>/dev/null x=1 "$@" export awk | 2>/dev/null cd && awk $(pwd) grep
+"$1" ${HOME} export then ${HOME}
+	"$1" ${HOME} printf awk printf export awk /usr/bin
+x=1 ${HOME} readonly grep
+	cd printf 'quoted text' | local "$1"
+	/usr/bin grep $(pwd) test --verbose then cd "$@" $(pwd) test 2>/dev/null
+	test | export echo awk cd "$1" done 'quoted text'
+${HOME} test test sed -eu readonly -eu readonly test --verbose $(pwd) local local
+2>/dev/null done && --verbose printf | -eu local printf ${HOME}
+		export export local --verbose done
+	awk done /usr/bin export ${HOME} grep && 2>/dev/null x=1
+		${HOME} /usr/bin | local 2>/dev/null
+	x=1 test -eu -eu x=1 'quoted text'
+	readonly echo ${HOME} printf
+	"$@" export awk $(pwd) /usr/bin export /usr/bin cd ${HOME}
+		&& --verbose && then done --verbose
+	local test /usr/bin ${HOME} then
+| then grep | --verbose done | export local
+	--verbose printf "$@" "$@" test -eu 2>/dev/null | -eu | printf grep export readonly
+	printf test printf -eu cd echo x=1 /usr/bin -eu -eu -eu done test ${HOME}
+--verbose --verbose | awk $(pwd) /usr/bin 2>/dev/null -eu && echo
+cd export test grep -eu done then
+"$@" /usr/bin local echo ${HOME} cd | grep | printf sed && | export
+&& cd 'quoted text' printf
+		printf | grep x=1 -eu ${HOME} && /usr/bin --verbose
+		test awk sed /usr/bin -eu then ${HOME} done cd export
+		${HOME} awk 2>/dev/null export
+		$(pwd) awk ${HOME} sed ${HOME}
+		local printf sed printf 'quoted text' grep awk cd && readonly local test echo $(pwd)
+		local export sed -eu then echo grep 'quoted text' /usr/bin
+		test export 2>/dev/null grep --verbose readonly then 2>/dev/null cd
+		export $(pwd) export test $(pwd) --verbose "$1" x=1 'quoted text'
+		&& "$@" then printf x=1
+		echo sed awk test sed cd cd readonly
+	local done /usr/bin echo && -eu then && local /usr/bin
+readonly echo 2>/dev/null x=1 /usr/bin
+	$(pwd) x=1 done test 2>/dev/null grep sed -eu "$1" sed cd
+	--verbose /usr/bin "$1" done && ${HOME} then -eu x=1 cd done awk
+	&& --verbose "$@" sed /usr/bin x=1 grep ${HOME} "$1" printf "$1" echo "$@"
+sed done $(pwd) export cd &&
+		grep then | -eu test cd echo -eu printf --verbose
+grep then /usr/bin 2>/dev/null local sed then awk
+	cd readonly $(pwd) "$@" && export local
+	then --verbose -eu x=1 /usr/bin
+	sed sed test x=1 grep then
+	${HOME} $(pwd) done echo awk $(pwd) -eu then done echo
+		sed local cd local 2>/dev/null printf printf
+	'quoted text' ${HOME}
+		&& local then cd sed local --verbose done
+		cd test x=1 test sed ${HOME} $(pwd) then grep | --verbose
+		printf readonly export readonly grep "$@"
+	cd grep && cd 2>/dev/null --verbose echo
+	export local -eu cd $(pwd) "$@" ${HOME}
+	echo | export awk $(pwd) test then
+	&& 'quoted text' | grep sed test local done local then export readonly
+		echo "$@" done -eu local $(pwd) ${HOME} cd done 'quoted text' readonly x=1
+x=1 /usr/bin grep then printf ${HOME} grep ${HOME} awk $(pwd)
+	"$@" export -eu 'quoted text' && export export
+cd readonly printf local /usr/bin cd --verbose export "$1" local /usr/bin
+2>/dev/null sed export local sed -eu $(pwd) /usr/bin $(pwd) export local
+		awk --verbose "$@" 2>/dev/null local "$1" /usr/bin
+'quoted text' x=1 test local printf printf done done 'quoted text'
+"$1" $(pwd) /usr/bin printf x=1 export
+export local local /usr/bin "$@" then "$@" x=1 sed readonly --verbose echo readonly
+		"$1" $(pwd) grep ${HOME} && ${HOME} && local readonly x=1 2>/dev/null
+		done --verbose 2>/dev/null --verbose then 'quoted text' 2>/dev/null then
+		"$1" sed "$@" x=1 "$1" sed 2>/dev/null echo export --verbose
+$(pwd) && cd echo && awk /usr/bin x=1 export |
+	${HOME} local "$@" ${HOME} local test printf echo then &&
+	done "$1" printf printf cd && test -eu done readonly echo "$@" echo
+		test $(pwd) printf echo $(pwd)
+local /usr/bin done 'quoted text' x=1 grep echo test export 2>/dev/null
+		cd readonly awk 'quoted text' readonly --verbose
+x=1 done | $(pwd) export ${HOME} $(pwd) x=1 | "$@" export
+	-eu ${HOME} done /usr/bin test 2>/dev/null
+then | ${HOME} export awk "$1" grep
+	2>/dev/null local x=1 x=1 "$1"
+		grep test sed then --verbose "$@" then && readonly
+		cd --verbose done 'quoted text'
+--verbose 2>/dev/null && --verbose -eu --verbose
+x=1 && grep 2>/dev/null local test "$1" 2>/dev/null echo
+		2>/dev/null cd && --verbose printf
+	awk sed ${HOME} $(pwd) -eu "$1" cd printf grep && $(pwd)
+		2>/dev/null $(pwd) --verbose
+		-eu ${HOME} grep $(pwd) /usr/bin echo done --verbose test $(pwd)
+	"$1" 'quoted text' "$@" printf
+		'quoted text' 'quoted text' local ${HOME} --verbose -eu done "$@" echo
+grep then local test cd sed && "$1" local export "$1"
+	${HOME} local local grep 'quoted text'
+		'quoted text' 'quoted text' then 'quoted text' printf
+	&& ${HOME} sed -eu export | x=1 cd readonly cd -eu
+		--verbose sed /usr/bin 2>/dev/null readonly | awk "$@" then "$@" sed "$1"
+	printf readonly cd && ${HOME} then $(pwd) printf readonly done
+		local | then echo echo then x=1 'quoted text' test readonly "$@" -eu done echo
+		'quoted text' 'quoted text'
+	cd "$1" 'quoted text' -eu | ${HOME} export
+	echo x=1 | readonly 2>/dev/null readonly x=1 2>/dev/null cd local 'quoted text'
+		echo && $(pwd) test 'quoted text' test cd sed echo 2>/dev/null cd
+		local /usr/bin then /usr/bin
+		readonly readonly then --verbose "$@"
+	&& echo sed | echo --verbose export local export
+		2>/dev/null test -eu sed | test "$@" x=1 then
+		grep "$@" export --verbose x=1
+export && then done | 'quoted text'
+	grep /usr/bin $(pwd) done 'quoted text' "$@" done ${HOME}
+	$(pwd) export readonly done ${HOME} "$@" printf echo sed done printf 2>/dev/null
+		$(pwd) cd "$1" then | sed echo "$@" && awk export echo printf then
+		x=1 -eu $(pwd) printf ${HOME} cd then done x=1 "$@" 2>/dev/null
+		"$1" awk ${HOME} export done done -eu grep then 'quoted text' x=1 -eu cd /usr/bin
+test readonly /usr/bin done then x=1 /usr/bin
+then sed /usr/bin ${HOME} grep
+awk ${HOME} echo readonly done sed | sed
+	&& done then readonly cd --verbose $(pwd) 2>/dev/null /usr/bin export | local
+		sed then x=1 then -eu then 'quoted text' ${HOME} local 2>/dev/null
+printf awk x=1 && | ${HOME} local x=1 test "$1" ${HOME} printf
+	readonly grep 2>/dev/null $(pwd) local then echo 'quoted text'
+		"$@" then && $(pwd) sed "$1" 2>/dev/null x=1 awk $(pwd) x=1 | ${HOME} "$1"
+then x=1 "$1" 'quoted text' | local 2>/dev/null
+		x=1 printf readonly x=1 awk $(pwd) printf
+	2>/dev/null /usr/bin readonly
+	done $(pwd) awk /usr/bin sed "$@" readonly | echo
+	&& "$@" "$@" done printf printf
+		$(pwd) cd sed $(pwd) x=1
+	-eu /usr/bin sed | readonly grep ${HOME}
+		echo 2>/dev/null /usr/bin && sed -eu cd export 'quoted text' | --verbose "$1"
+		test ${HOME} printf x=1 x=1 sed then
+		'quoted text' && local printf /usr/bin | -eu /usr/bin 2>/dev/null ${HOME}
+done /usr/bin then --verbose
+		local export local "$1" && --verbose
+		then --verbose sed awk "$1" printf cd --verbose x=1 --verbose awk
+		awk awk cd 'quoted text' && sed "$@" done echo awk ${HOME} && local ${HOME}
+2>/dev/null "$1" | x=1 -eu then done 'quoted text' x=1 2>/dev/null awk cd grep
+'quoted text' "$@" "$1" 'quoted text' | ${HOME} "$1" x=1 2>/dev/null --verbose
+	x=1 readonly awk $(pwd)
+		x=1 done grep 2>/dev/null awk 'quoted text'
+"$@" && grep grep x=1 | /usr/bin
+		export export sed export 2>/dev/null "$@" && $(pwd)
+		x=1 --verbose ${HOME} awk 'quoted text' 2>/dev/null readonly ${HOME} sed |
+		x=1 test readonly local
+	readonly sed x=1 ${HOME} awk && then 2>/dev/null cd done --verbose cd $(pwd) "$@"
+		"$1" local done cd --verbose && | x=1 --verbose then then then && local
+		${HOME} printf ${HOME} done $(pwd) printf "$1" readonly
+	export sed test $(pwd) "$@" cd then cd test /usr/bin $(pwd)
+	awk -eu then done done | && sed then $(pwd) |
+	echo test test readonly x=1 -eu
+${HOME} awk && echo 'quoted text' readonly
+	&& 'quoted text' grep printf test sed | && ${HOME} "$@" export "$1" done && &&
+done x=1 "$@" x=1 done printf x=1 sed then test ${HOME}
+		echo local 'quoted text' then x=1 "$1" 'quoted text' 'quoted text'
+		local "$1" | readonly then
+		x=1 | $(pwd) done "$1" done
+		$(pwd) "$@" export --verbose cd "$@" grep /usr/bin readonly
+	--verbose -eu then 'quoted text' --verbose 'quoted text' --verbose
+"$1" done cd "$@" done 'quoted text'
+2>/dev/null "$1" cd export done awk "$@" | "$1" /usr/bin local x=1 sed 'quoted text'
+grep ${HOME} echo ${HOME} --verbose
+test export x=1 cd 2>/dev/null sed printf local awk grep local
+		-eu then awk echo cd $(pwd) echo done && local -eu x=1 printf export
+		| local readonly /usr/bin readonly x=1 echo done done -eu -eu test cd &&
+"$1" -eu && $(pwd) 2>/dev/null test "$1" grep x=1 local readonly 'quoted text' &&
+	awk awk printf $(pwd) && 'quoted text' $(pwd) grep echo --verbose then --verbose
+&& && export x=1 grep --verbose readonly 'quoted text'
+		&& cd 2>/dev/null "$@" -eu && export printf echo --verbose echo 2>/dev/null ${HOME}
+grep echo printf then
+	awk echo 'quoted text' && cd ${HOME} $(pwd) -eu $(pwd)
+	printf /usr/bin | cd "$@" test awk -eu 2>/dev/null export "$@" done local "$1"
+	cd "$1" "$@" 2>/dev/null
+		x=1 then && 2>/dev/null local test grep && "$@" awk x=1 "$1" | readonly x=1
+	$(pwd) $(pwd) grep grep
+${HOME} done ${HOME} awk
+	printf -eu | local export
+		--verbose echo ${HOME} export
+-eu ${HOME} 2>/dev/null x=1 --verbose ${HOME} readonly echo grep
+--verbose --verbose && 'quoted text' 2>/dev/null
+		--verbose | export | -eu -eu then cd local
+	--verbose test echo 2>/dev/null | readonly --verbose ${HOME} test
+grep echo readonly ${HOME} sed grep cd x=1 export readonly readonly sed 2>/dev/null
+	"$1" /usr/bin local 'quoted text' && echo ${HOME} then ${HOME}
+${HOME} | then "$1" export "$1" test readonly 'quoted text'
+		awk grep ${HOME} printf | export /usr/bin
+	awk readonly printf cd then printf printf -eu ${HOME} export sed grep echo
+		local 'quoted text' grep 2>/dev/null printf ${HOME} 2>/dev/null $(pwd) printf ${HOME}
+done done --verbose echo
+		"$@" 2>/dev/null printf readonly --verbose readonly &&
+export -eu printf --verbose /usr/bin $(pwd) test /usr/bin awk printf
+x=1 "$@" $(pwd) export "$1" done -eu "$1" "$1" -eu 2>/dev/null
+	${HOME} test -eu printf 2>/dev/null printf echo --verbose cd local && "$@"
+		'quoted text' x=1 readonly awk sed grep --verbose && cd 2>/dev/null test
+local echo local done 2>/dev/null then done --verbose
+local 'quoted text' grep cd "$@" echo then 'quoted text' "$@"
+local "$1" "$@" grep test "$1" test --verbose done --verbose $(pwd) done test local
+	local x=1 then "$1" /usr/bin x=1 readonly
+"$@" grep export /usr/bin ${HOME} 'quoted text'
+-eu "$1" test then sed && -eu x=1 -eu test awk "$@" test export local
+		&& local export printf sed -eu 'quoted text'
+cd printf grep --verbose then $(pwd) /usr/bin "$1" sed sed 2>/dev/null
+		| -eu "$@" "$@" $(pwd) /usr/bin 'quoted text' | ${HOME}
+		x=1 $(pwd) done 'quoted text' "$1"
+		done --verbose 'quoted text' readonly local 2>/dev/null export -eu cd --verbose
+	-eu "$@" local echo 'quoted text' export echo &&
+export test cd printf "$@" cd
+		"$@" cd $(pwd) ${HOME} x=1 "$1" awk -eu x=1 printf 2>/dev/null
+		"$@" $(pwd) grep $(pwd) /usr/bin "$1" x=1 'quoted text' grep
+		-eu cd --verbose cd "$@" local then export printf local --verbose printf
+	-eu /usr/bin x=1 /usr/bin x=1 /usr/bin "$@" local grep && $(pwd) && 2>/dev/null
+		$(pwd) cd -eu readonly then cd cd sed grep then --verbose "$1" "$@" awk local
+	readonly awk --verbose local /usr/bin /usr/bin awk ${HOME} readonly done
+cd 2>/dev/null "$1" printf grep printf && "$@" echo
+"$@" printf $(pwd) --verbose -eu sed
+	printf "$@" /usr/bin --verbose test "$1" --verbose
+		export | --verbose then test echo cd $(pwd) $(pwd) | then printf grep then
+grep 2>/dev/null cd -eu echo awk --verbose && -eu -eu
+awk -eu && test export test "$1" awk 2>/dev/null
+		&& awk -eu grep && awk ${HOME} x=1
+	export && ${HOME} "$1" | --verbose awk && grep x=1 'quoted text' 'quoted text'
+"$@" "$@" 2>/dev/null /usr/bin printf
+		export then sed cd test sed -eu sed readonly $(pwd) printf echo
+		grep ${HOME} test x=1 local 2>/dev/null printf "$1" /usr/bin $(pwd) echo
+	/usr/bin | x=1 done cd export cd awk test ${HOME} grep printf local sed
+		"$1" 2>/dev/null local grep cd && "$@" -eu
+	| test grep test /usr/bin awk local readonly && ${HOME}
+		cd "$1" "$1" printf export printf
+printf export readonly readonly
+printf grep --verbose printf export /usr/bin
+		"$1" "$@" -eu -eu grep cd "$1" "$@" "$@" $(pwd) readonly $(pwd)
+--verbose done echo done printf cd 2>/dev/null printf awk "$1"
+test test awk done ${HOME} sed done
+	"$1" grep grep x=1 then done readonly "$1" $(pwd) cd sed export
+		sed -eu --verbose ${HOME} cd export 2>/dev/null && 2>/dev/null done local grep
+		cd && echo "$@" ${HOME} cd 2>/dev/null test printf
+then 'quoted text' test $(pwd) then -eu
+	${HOME} /usr/bin export export grep echo ${HOME} 2>/dev/null test ${HOME}
+local awk 2>/dev/null test printf && printf
+"$@" printf ${HOME} $(pwd)
+		export done test "$1" awk --verbose
+		sed | cd "$1" -eu then /usr/bin readonly done test && then x=1 readonly |
+	test 2>/dev/null /usr/bin done && test test && echo
+		sed $(pwd) -eu sed grep | awk x=1 then "$1" then
+	awk sed "$1" then /usr/bin "$1" cd printf --verbose
+awk -eu "$1" cd "$1" sed -eu local sed x=1
+	2>/dev/null printf "$1" "$1"
+	${HOME} 'quoted text' /usr/bin
+		x=1 | -eu "$@" sed grep awk done x=1 && && grep "$@" echo printf | x=1 | sed
+'quoted text' /usr/bin cd -eu $(pwd) awk /usr/bin && -eu /usr/bin
+		sed 2>/dev/null export "$@" then /usr/bin /usr/bin
+		"$@" echo "$@" cd done $(pwd) ${HOME} test then $(pwd)
+		local cd /usr/bin readonly 'quoted text'
+		"$@" local "$1" -eu /usr/bin echo x=1 readonly awk awk echo &&
+/usr/bin grep awk done then | && awk 2>/dev/null
+	-eu grep echo grep "$1" local
+		local | "$1" "$1" --verbose "$@" echo "$@" && --verbose
+test -eu grep --verbose --verbose 'quoted text'
+	sed && && echo then "$1" local awk readonly echo x=1 'quoted text'
+	$(pwd) export cd | 2>/dev/null export $(pwd)
+		'quoted text' then grep | "$1" ${HOME} $(pwd) test | | | echo --verbose
+	"$@" -eu local -eu x=1 "$1" echo /usr/bin then
+readonly cd 2>/dev/null export -eu 'quoted text' --verbose
+		'quoted text' grep "$@" $(pwd) -eu then done "$1" | ${HOME} printf
+--verbose $(pwd) 'quoted text' sed ${HOME}
+"$@" && "$1" readonly $(pwd) echo test local $(pwd) test echo printf
+	2>/dev/null && done "$1" $(pwd) test $(pwd) local done &&
+		test test export then | -eu then x=1 sed test && ${HOME} printf x=1 $(pwd)
+		"$@" readonly then printf 'quoted text'
+/usr/bin sed -eu printf "$@" grep local /usr/bin --verbose done -eu --verbose
+--verbose export sed && awk /usr/bin
+	&& then "$@" ${HOME} $(pwd) export $(pwd) | $(pwd) /usr/bin cd
+		cd ${HOME} export test local test printf grep $(pwd) "$@" printf done printf
+	done "$1" grep x=1 local 'quoted text'
+	x=1 $(pwd) readonly local
+'quoted text' export | "$1" done printf printf "$@"
+$(pwd) local --verbose local | done test
+		"$@" x=1 local x=1 awk echo $(pwd) echo local 'quoted text'
+		"$1" then readonly awk awk /usr/bin 2>/dev/null
+	2>/dev/null ${HOME} grep then "$1" 2>/dev/null $(pwd) | then grep 2>/dev/null
+		&& awk echo && -eu grep ${HOME}
+		/usr/bin export 2>/dev/null test local &&
+	test export printf 2>/dev/null grep ${HOME} "$1" $(pwd) /usr/bin
+		&& awk done 2>/dev/null grep
+		awk 2>/dev/null then done awk test $(pwd) $(pwd) readonly --verbose
+awk echo done "$@" 2>/dev/null "$@" export printf sed printf
+export --verbose test /usr/bin echo awk 'quoted text' | then
+	x=1 $(pwd) x=1 printf printf /usr/bin | "$@" cd | && grep echo -eu test export
+		/usr/bin | done export printf "$1"
+done awk && "$@" -eu sed cd "$1" export ${HOME}
+	export readonly sed ${HOME} && && ${HOME} "$@" ${HOME}
+awk $(pwd) awk && "$@" awk done cd done awk /usr/bin $(pwd) printf
+	x=1 "$@" | /usr/bin | "$1" awk
+&& && | awk cd x=1 'quoted text' /usr/bin export grep test && $(pwd)
+		&& sed -eu export local "$@" local
+	-eu 2>/dev/null 2>/dev/null
+cd ${HOME} sed $(pwd) test x=1 2>/dev/null grep awk "$@"
+		local sed local && -eu cd test test 2>/dev/null "$1" then x=1 $(pwd) grep readonly
+		&& $(pwd) done grep cd done | -eu x=1 local grep sed 2>/dev/null cd test "$@"
+	printf | -eu "$@" ${HOME} $(pwd) done $(pwd)
+		$(pwd) readonly echo && $(pwd) 'quoted text' ${HOME}
+	export --verbose "$1" export x=1 x=1 grep cd sed
+/usr/bin awk sed done ${HOME} then cd sed local done echo done awk | 'quoted text'
+	printf done x=1 -eu --verbose 2>/dev/null 2>/dev/null
+		awk sed 2>/dev/null --verbose done awk then local then test 'quoted text'
+		echo export test grep 2>/dev/null ${HOME} readonly grep test "$@" x=1 "$@"
+		x=1 awk --verbose $(pwd) sed done $(pwd) then | grep 'quoted text' test
+		export /usr/bin | --verbose export echo --verbose echo printf readonly export
+		then 'quoted text' printf x=1
+	x=1 "$@" /usr/bin readonly export awk $(pwd)
+	cd "$@" echo echo $(pwd) sed --verbose 'quoted text'
+		&& --verbose echo --verbose sed awk --verbose "$@" ${HOME} echo printf "$1"
+${HOME} test grep x=1 readonly printf && readonly local cd readonly export
+cd --verbose && -eu then printf then echo 'quoted text' printf sed export
+awk awk then then echo awk sed | "$@" local && printf grep "$1" /usr/bin "$@" |
+local then then -eu then ${HOME} /usr/bin "$@" "$1" x=1 ${HOME}
+-eu -eu "$@" --verbose "$@" local sed grep echo "$1" && grep export ${HOME} echo
+	--verbose "$1" export cd grep ${HOME} printf
+		x=1 "$@" && echo ${HOME} $(pwd) --verbose $(pwd) export -eu /usr/bin x=1 'quoted text'
+		readonly sed then $(pwd) readonly $(pwd) $(pwd) $(pwd) test
+	&& test then --verbose && ${HOME} readonly readonly done sed
+	x=1 $(pwd) sed x=1 ${HOME} awk awk local export echo && printf | test
+		--verbose -eu && sed export $(pwd) awk x=1 export 2>/dev/null
+		done test readonly awk awk | ${HOME} then test
+	export "$@" cd awk --verbose x=1 --verbose
+	awk cd "$@" done done /usr/bin -eu | 'quoted text' /usr/bin done awk printf
+	readonly | printf export "$1" /usr/bin x=1 echo awk -eu
+local -eu printf sed done then -eu "$@" -eu 'quoted text'
+echo done 2>/dev/null sed -eu local 'quoted text' export
+	sed echo printf && printf
+awk test ${HOME} && "$@" echo 2>/dev/null /usr/bin
+		test "$1" -eu sed then x=1 x=1 echo
+sed readonly export readonly cd awk readonly | readonly ${HOME}
+		then local "$1" 2>/dev/null
+	"$1" ${HOME} $(pwd) grep
+		readonly then $(pwd) 2>/dev/null awk
+printf "$@" done sed $(pwd) ${HOME} && sed /usr/bin
+	$(pwd) --verbose $(pwd) cd then $(pwd) 'quoted text' 2>/dev/null sed -eu export
+		x=1 then | "$1" then test printf "$@" && --verbose test ${HOME} printf 2>/dev/null
+| then $(pwd) cd grep export x=1 cd /usr/bin local grep export
+sed --verbose cd && --verbose
+		readonly "$1" grep test printf export
+'quoted text' ${HOME} 2>/dev/null readonly printf
+		grep "$1" printf /usr/bin | $(pwd) printf "$1" "$1" grep export
+	export 2>/dev/null && x=1 | then 2>/dev/null -eu | --verbose printf
+'quoted text' test /usr/bin "$@"
+	/usr/bin ${HOME} /usr/bin done export --verbose export test sed "$@" | awk
+readonly local ${HOME} grep /usr/bin test 'quoted text' awk 'quoted text' -eu
+	| 2>/dev/null "$@" echo --verbose
+	export --verbose | done readonly | "$@" test
+		export $(pwd) $(pwd) awk
+	local sed ${HOME} 2>/dev/null "$@" export awk /usr/bin
+		readonly "$@" "$1" 'quoted text' test sed readonly
+		readonly export export 2>/dev/null | awk local local done echo "$@" sed "$1"
+		'quoted text' -eu sed -eu
+		/usr/bin cd "$@" && ${HOME} /usr/bin echo --verbose
+local $(pwd) /usr/bin $(pwd) readonly
+	2>/dev/null then | echo --verbose | local grep export $(pwd) test grep cd --verbose
+	then "$1" done done ${HOME} /usr/bin awk x=1 readonly local
+		/usr/bin "$@" ${HOME} && | then /usr/bin "$1" export
+		printf done export && local $(pwd)
+	cd local then echo grep --verbose $(pwd) sed echo printf
+		"$1" --verbose x=1 sed 2>/dev/null test printf "$@" | $(pwd)
+	"$@" printf "$@" "$@" export 'quoted text'
+x=1 'quoted text' -eu /usr/bin test local "$@"
+grep test /usr/bin --verbose $(pwd) done "$1" "$1" "$@" then readonly /usr/bin
+		-eu readonly readonly /usr/bin test sed 'quoted text'
+	grep readonly then printf printf readonly /usr/bin then
+cd done awk grep then cd awk readonly local done grep "$1" && sed ${HOME} "$@"
+	--verbose readonly export printf awk "$@"
+	then $(pwd) grep 2>/dev/null --verbose --verbose echo test -eu awk | 2>/dev/null
+		readonly "$@" readonly | /usr/bin -eu echo
+"$1" | cd ${HOME} && $(pwd) sed "$1" readonly $(pwd)
+		x=1 ${HOME} -eu 'quoted text' $(pwd)
+		export --verbose awk "$1" test -eu done echo -eu sed /usr/bin
+	${HOME} "$1" "$@" | echo $(pwd) | sed
+	/usr/bin done export 'quoted text' then done readonly then
+$(pwd) && "$1" local $(pwd)
+		--verbose grep "$@" /usr/bin done cd echo done test then "$1" $(pwd) sed readonly
+	readonly sed "$@" | cd 'quoted text'
+		| awk then grep printf "$@" sed x=1
+	done -eu cd /usr/bin ${HOME} printf "$@" test printf | 'quoted text'
+		local "$1" awk sed ${HOME} export
+		$(pwd) readonly done $(pwd) done /usr/bin "$@" -eu | /usr/bin
+		grep cd "$1" done readonly $(pwd) echo
+${HOME} ${HOME} done readonly
+then printf then local cd awk printf
+	'quoted text' 'quoted text'
+	done readonly then && done "$@" "$@" printf && "$1" readonly test readonly
+echo readonly sed --verbose
+	sed "$@" printf then local echo | x=1 then test
+		export 2>/dev/null awk then -eu then "$@" export sed "$1" awk export
+	printf grep grep "$1" $(pwd) readonly
+		/usr/bin export awk cd test sed cd /usr/bin awk -eu && "$@" -eu /usr/bin
+		&& export local --verbose ${HOME}
+	readonly 2>/dev/null /usr/bin echo && echo ${HOME} 'quoted text' x=1 ${HOME} $(pwd)
+	then export -eu done then cd test cd done local export then local --verbose
+		readonly readonly done cd && | grep sed -eu
+		readonly "$@" awk | 'quoted text'
+&& readonly -eu x=1 printf test local echo echo "$@" printf export && | cd --verbose
+	test 'quoted text' readonly /usr/bin done /usr/bin | done sed $(pwd) sed local export
+	echo -eu test echo --verbose local 2>/dev/null
+		then "$@" x=1 x=1 'quoted text' readonly ${HOME} awk
+grep "$1" awk test echo --verbose "$@" awk sed cd "$1" grep ${HOME} x=1
+		${HOME} && done --verbose
+--verbose local cd echo &&
+test /usr/bin then $(pwd) export
+	'quoted text' 2>/dev/null cd awk $(pwd) 2>/dev/null "$@" awk
+		&& x=1 | 'quoted text' $(pwd) then done
+--verbose $(pwd) then $(pwd) local readonly
+2>/dev/null done "$1" done printf
+	2>/dev/null "$1" grep "$1" echo ${HOME} 2>/dev/null
+	grep sed "$1" test | echo printf 2>/dev/null sed printf grep
+		${HOME} "$1" 'quoted text' printf printf x=1 ${HOME} awk cd && export "$@"
+		--verbose export x=1 'quoted text' -eu done "$1" && --verbose printf sed awk local
+	awk then sed grep "$@" $(pwd) test 'quoted text' $(pwd) export ${HOME} ${HOME}
+	export -eu then 'quoted text' sed /usr/bin then -eu grep "$1" 'quoted text' grep
+		| awk readonly /usr/bin /usr/bin done grep cd 'quoted text' printf export
+	readonly 2>/dev/null local
+"$1" | then awk -eu /usr/bin grep "$1" &&
+	'quoted text' awk $(pwd) 'quoted text' x=1 done cd printf && "$@" 'quoted text'
+	then sed cd done cd local grep
+		x=1 'quoted text' x=1 awk /usr/bin export ${HOME} 'quoted text' grep printf
+	export x=1 echo --verbose 'quoted text'
+	2>/dev/null 2>/dev/null x=1 x=1 export sed printf "$1" export -eu
+	-eu $(pwd) echo 2>/dev/null "$@" local "$1"
+		test local readonly "$1" ${HOME} 2>/dev/null
+test echo export test done -eu | grep "$1" grep x=1 done readonly
+	awk cd local ${HOME} $(pwd) -eu | | -eu local $(pwd)
+		test $(pwd) local echo echo x=1 local local -eu $(pwd) readonly local ${HOME}
+		grep awk grep export cd export awk echo 2>/dev/null done 'quoted text'
+	"$@" grep && -eu cd --verbose echo --verbose local test && done local
+x=1 -eu x=1 readonly printf 2>/dev/null
+		-eu 'quoted text' done local 2>/dev/null 2>/dev/null
+		local 2>/dev/null | "$@" "$@" 'quoted text' grep 'quoted text'
+	sed done 2>/dev/null 'quoted text' "$1" cd echo $(pwd) local "$@" $(pwd) echo
+-eu sed && cd $(pwd) sed && --verbose awk readonly
+		readonly "$@" readonly "$@" export | awk "$1" awk cd cd printf
+"$1" "$@" "$@" then 'quoted text' "$1" test
+		--verbose readonly readonly export /usr/bin readonly && "$@" /usr/bin 'quoted text'
+		done grep then | -eu 'quoted text' x=1
+		"$@" readonly test -eu grep printf printf
+	"$@" x=1 "$1" grep -eu --verbose "$@" local awk then printf | awk $(pwd)
+then "$1" 'quoted text' grep
+	/usr/bin $(pwd) cd | local echo readonly sed readonly $(pwd) 'quoted text'
+	readonly cd 'quoted text' 'quoted text' "$@"
+	${HOME} 'quoted text' $(pwd) cd grep --verbose -eu cd "$1"
+	awk awk grep "$@" then -eu -eu && 'quoted text'
+		"$@" -eu && then $(pwd) "$1" 'quoted text' grep
+	x=1 --verbose 'quoted text' export | "$1" | 2>/dev/null readonly
+	local 'quoted text' --verbose grep
+	| then printf export grep cd grep awk cd grep
+	--verbose /usr/bin local readonly ${HOME} | test $(pwd) sed $(pwd) awk --verbose
+sed export --verbose awk export --verbose printf 'quoted text' sed ${HOME} x=1
+-eu export --verbose 2>/dev/null -eu awk cd test $(pwd) cd
+	readonly ${HOME} "$1" | --verbose | "$1" 'quoted text' sed then awk echo
+		| "$1" | test awk --verbose done -eu grep $(pwd) printf /usr/bin
+		${HOME} printf export export export 2>/dev/null
+		printf ${HOME} $(pwd) $(pwd) /usr/bin /usr/bin "$@"
+	cd 2>/dev/null /usr/bin /usr/bin
+	printf local 2>/dev/null export
+		"$1" && test done export
+/usr/bin printf && ${HOME} /usr/bin && "$@" readonly "$@" awk awk
+done 'quoted text' -eu --verbose $(pwd) sed /usr/bin printf readonly "$@"
+		'quoted text' readonly 2>/dev/null | /usr/bin ${HOME} --verbose 'quoted text'
+	export | -eu $(pwd) sed cd /usr/bin x=1 /usr/bin /usr/bin
+		'quoted text' /usr/bin local grep 'quoted text' ${HOME}
+export 'quoted text' $(pwd) printf done /usr/bin 2>/dev/null done
+	$(pwd) x=1 "$1" 'quoted text' && then test cd echo "$@" sed printf grep local
+		"$@" sed 2>/dev/null export
+done test awk $(pwd)
+		awk && --verbose export | "$@" &&
+	printf done local "$1" printf ${HOME} local x=1 && ${HOME}
+		local local x=1 grep sed then cd ${HOME} | awk local local readonly /usr/bin
+		printf cd --verbose echo readonly ${HOME} echo export export sed
+"$@" then test local x=1
+	done /usr/bin grep test cd done $(pwd) then echo grep export printf test /usr/bin
+	readonly | sed printf "$@"
+	echo 2>/dev/null printf printf ${HOME} cd /usr/bin export "$@" && printf "$1"
+done then | /usr/bin sed
+		-eu done awk x=1 $(pwd) printf /usr/bin 'quoted text' 2>/dev/null export 'quoted text'
+	-eu cd sed $(pwd) awk readonly test x=1 "$1" | readonly /usr/bin cd | "$1" readonly
+		-eu 'quoted text' /usr/bin | && printf x=1 /usr/bin printf "$1" x=1 grep
+	readonly "$1" $(pwd) && export ${HOME}
+		awk local | then sed | -eu printf
+		&& "$@" "$1" | /usr/bin 2>/dev/null 'quoted text' ${HOME} cd cd readonly
+		cd grep printf 'quoted text' $(pwd) "$@" x=1 echo then 2>/dev/null 2>/dev/null
+	&& "$@" ${HOME} printf then 'quoted text' test "$1" ${HOME} x=1 x=1 $(pwd)
+export 'quoted text' -eu
+x=1 | "$@" grep then ${HOME} export readonly cd "$1" ${HOME} test printf
+local sed cd --verbose awk then local --verbose
+	x=1 2>/dev/null cd ${HOME} 'quoted text'
+	${HOME} then "$@" printf export x=1 && sed sed 2>/dev/null readonly
+	awk echo x=1 test "$@" then awk "$@" echo export --verbose 'quoted text'
+	printf test 'quoted text' | then --verbose then
+	readonly "$@" cd echo 'quoted text' /usr/bin
+	"$1" test printf 2>/dev/null cd readonly /usr/bin ${HOME}
+	awk sed ${HOME} export then ${HOME}
+	'quoted text' awk x=1 "$@" grep /usr/bin echo "$@" readonly && /usr/bin | local
+	done 'quoted text' cd echo && 'quoted text'
+readonly x=1 cd local
+		awk 'quoted text' cd --verbose printf | awk export --verbose "$@" 'quoted text'
+		"$@" readonly x=1 printf 'quoted text'
+	"$@" ${HOME} grep &&
+	$(pwd) awk x=1 awk export
+local sed done then test test echo $(pwd)
+		'quoted text' sed then echo echo
+&& export printf $(pwd) cd grep grep awk && x=1 x=1 then done --verbose test -eu
+	then 2>/dev/null readonly
+&& sed sed --verbose test x=1 printf
+printf export && /usr/bin printf $(pwd) sed awk test
+	printf | grep grep 'quoted text' sed
+	'quoted text' local awk printf then sed awk ${HOME} -eu test "$1" grep
+		test 'quoted text' 2>/dev/null export then | test readonly
+/usr/bin ${HOME} x=1 done 'quoted text'
+		sed 2>/dev/null $(pwd) cd /usr/bin
+		'quoted text' 2>/dev/null | ${HOME} ${HOME} -eu "$1" $(pwd)
+local --verbose -eu ${HOME} 2>/dev/null --verbose then ${HOME} 'quoted text'
+	x=1 2>/dev/null x=1 readonly printf
+local /usr/bin && echo grep x=1 | sed && awk done readonly $(pwd) sed /usr/bin
+${HOME} grep test awk done /usr/bin local -eu printf awk "$1"
+grep done test awk echo readonly test 2>/dev/null sed sed 'quoted text'
+	awk "$@" test -eu -eu 'quoted text' done then printf ${HOME} /usr/bin
+export done cd local test
+	/usr/bin /usr/bin export $(pwd) 'quoted text'
+		test cd awk then -eu done x=1 readonly awk cd 2>/dev/null
+	$(pwd) x=1 local "$1" local local cd cd sed "$1" | &&
+		${HOME} x=1 "$@" "$1" local test /usr/bin
+		test echo grep && echo -eu cd 2>/dev/null x=1 2>/dev/null "$1"
+	'quoted text' x=1 2>/dev/null sed x=1 "$1" printf "$1" ${HOME} done
+		| awk -eu awk cd 2>/dev/null awk cd done
+	"$@" "$@" "$1" "$@" -eu --verbose
+		cd echo awk x=1 test ${HOME} local 2>/dev/null --verbose local
+		"$@" test "$1" "$1" done 'quoted text' awk | grep ${HOME}
+"$@" test ${HOME} ${HOME} grep | cd awk ${HOME} sed echo done awk --verbose
+$(pwd) x=1 awk x=1 ${HOME} /usr/bin cd export export local
+		local awk done /usr/bin local /usr/bin export test echo echo then | awk "$@" $(pwd)
+		/usr/bin cd -eu done then x=1 local done --verbose
+	--verbose test readonly local cd printf sed
+	local 'quoted text' printf && then echo export local | sed x=1 /usr/bin test
+	--verbose sed -eu cd x=1 local --verbose export $(pwd)
+		then echo "$@" x=1 | "$1" cd printf -eu
+	--verbose printf -eu local local export echo "$1" done --verbose
+	2>/dev/null && 2>/dev/null -eu sed done readonly
+| 2>/dev/null awk && local $(pwd)
+cd local export x=1 readonly done local
+		x=1 "$1" local test test
+	grep awk done test | && --verbose
+then && --verbose then sed test "$1" done
+test echo --verbose readonly
+	/usr/bin -eu ${HOME} export "$@" $(pwd) done /usr/bin 2>/dev/null
+	then readonly 2>/dev/null /usr/bin "$1" ${HOME} /usr/bin x=1 'quoted text'
+		then sed -eu && x=1 awk /usr/bin | printf echo "$1" --verbose -eu ${HOME} 'quoted text'
+	-eu local done grep --verbose sed done awk
+		$(pwd) 2>/dev/null local $(pwd) /usr/bin --verbose cd /usr/bin
+	"$1" cd test test cd readonly then 'quoted text' grep
+-eu local echo local && /usr/bin 'quoted text'
+		grep "$1" | /usr/bin test
+		"$@" awk ${HOME} 2>/dev/null local /usr/bin /usr/bin
+		"$1" grep "$@" "$@" && test awk
+		2>/dev/null -eu export && -eu --verbose $(pwd) grep 2>/dev/null sed printf
+grep | && done $(pwd)
+&& then then -eu sed && --verbose ${HOME} sed
+'quoted text' done "$1" sed export then "$@" "$1" cd x=1 -eu
+export test /usr/bin then 'quoted text' ${HOME}
+$(pwd) 2>/dev/null | test
+	done cd $(pwd) test printf echo "$1" --verbose
+	${HOME} done cd 2>/dev/null /usr/bin "$1" ${HOME} ${HOME}
+		| done echo printf /usr/bin
+	2>/dev/null 2>/dev/null done echo awk awk 'quoted text' awk local grep $(pwd)
+		cd $(pwd) ${HOME} test && cd export export then
+		local 2>/dev/null sed printf sed awk local $(pwd)
+then 'quoted text' grep grep x=1 "$@" test "$1" && 2>/dev/null ${HOME} export
+-eu --verbose cd --verbose
+	--verbose 2>/dev/null $(pwd) awk readonly
+"$@" ${HOME} test /usr/bin 'quoted text' --verbose readonly test
+	echo --verbose 2>/dev/null echo local ${HOME}
+	'quoted text' "$1" -eu 2>/dev/null 2>/dev/null 2>/dev/null
+	/usr/bin echo --verbose "$1" x=1 ${HOME} awk grep "$1" printf | /usr/bin | $(pwd)
+		${HOME} 'quoted text' grep cd echo echo done ${HOME}
+--verbose cd 'quoted text' cd local export cd local 2>/dev/null 2>/dev/null test
+	awk x=1 --verbose grep readonly then grep "$@" $(pwd) done 2>/dev/null echo
+&& 2>/dev/null test | awk && ${HOME} /usr/bin
+$(pwd) echo then "$1" test | test done readonly test readonly --verbose echo
+		export /usr/bin && echo --verbose printf
+		printf "$1" echo -eu readonly export --verbose x=1 /usr/bin 2>/dev/null
+		awk export grep -eu 2>/dev/null done $(pwd) printf
+	local sed "$1" $(pwd) done ${HOME} /usr/bin printf export export --verbose
+		/usr/bin ${HOME} /usr/bin local
+local | 'quoted text' -eu --verbose 2>/dev/null x=1 local ${HOME} 2>/dev/null
+	'quoted text' /usr/bin done 2>/dev/null && | /usr/bin done
+	sed printf echo $(pwd) export awk then --verbose &&
+	test grep "$@" | done awk
+		sed ${HOME} grep grep x=1 --verbose local "$@" ${HOME}
+test export sed -eu 2>/dev/null echo readonly 'quoted text'
+then done x=1 ${HOME} && ${HOME} readonly 'quoted text' done test sed
+		awk echo grep --verbose "$@" printf -eu local cd /usr/bin $(pwd)
+	export sed echo "$1" -eu printf "$@" then "$1" ${HOME}
+		local done printf local $(pwd) readonly 2>/dev/null
+/usr/bin cd sed echo local awk printf
+		"$@" ${HOME} | -eu cd export "$1" export -eu sed awk -eu grep | cd export export
+	export /usr/bin ${HOME} "$@" | local 2>/dev/null
+"$1" 'quoted text' echo /usr/bin test awk -eu export -eu /usr/bin
+	x=1 && && && test then "$1" test
+-eu awk $(pwd) done export $(pwd) ${HOME} sed -eu && export cd export /usr/bin
+local "$1" ${HOME} test awk "$@" --verbose printf "$1"
+		readonly local "$@" "$@" 'quoted text'
+		grep ${HOME} sed /usr/bin
+	then done 2>/dev/null x=1 test /usr/bin
+		$(pwd) printf "$1" then | $(pwd) readonly "$1" grep x=1 -eu awk printf
+		local "$1" 2>/dev/null "$@" printf cd printf cd done x=1 'quoted text' echo printf
+cd 'quoted text' then local awk ${HOME}
+sed cd 2>/dev/null awk -eu echo sed ${HOME} grep echo && | readonly
+echo && echo done local awk done test
+		cd "$@" printf done ${HOME}
+	grep "$1" x=1 $(pwd) /usr/bin /usr/bin printf
+export 2>/dev/null /usr/bin test ${HOME} cd --verbose cd grep /usr/bin
+x=1 x=1 'quoted text' awk && done grep ${HOME} "$@" -eu
+-eu cd -eu cd awk x=1 -eu --verbose /usr/bin 'quoted text' done
+		x=1 ${HOME} $(pwd) echo $(pwd) sed x=1 printf readonly x=1 x=1 "$@" --verbose
+	local awk done test export printf then -eu printf "$1" export ${HOME}
+	&& | "$1" readonly "$@" 2>/dev/null sed $(pwd)
+		awk /usr/bin then $(pwd) -eu echo -eu && test ${HOME} -eu "$@" ${HOME}
+	x=1 export local echo awk $(pwd)
+	cd -eu && "$1" | cd grep printf echo cd && --verbose grep export | done printf
+$(pwd) | export done 'quoted text' --verbose local printf &&
+		&& -eu "$1" && -eu $(pwd) /usr/bin then | then echo then "$1"
+cd grep done test | cd cd /usr/bin
+	printf | sed && "$@" grep awk grep "$@" cd "$@" done /usr/bin "$@" cd -eu 2>/dev/null
+		$(pwd) /usr/bin x=1 cd "$@" printf /usr/bin awk
+| ${HOME} "$1" "$1" cd "$1" cd 'quoted text' "$1"
+	printf awk sed | && ${HOME} | readonly
+		export | readonly readonly cd
+	echo "$@" echo grep sed done --verbose
+"$@" export | cd printf grep readonly echo export
+		cd /usr/bin "$1" "$@" grep printf
+		/usr/bin /usr/bin 2>/dev/null /usr/bin grep test sed 2>/dev/null printf
+	local done 2>/dev/null && readonly "$@" x=1 grep
+		/usr/bin -eu 2>/dev/null local x=1
+		"$1" -eu sed ${HOME} echo
+x=1 "$@" "$1" awk test readonly "$1"
+	echo cd local ${HOME} "$@" local -eu ${HOME} x=1 cd
+	"$1" $(pwd) sed 'quoted text'
+	sed && ${HOME} | local grep cd && x=1 'quoted text'
+	2>/dev/null cd cd readonly cd grep readonly local --verbose
+	${HOME} then && --verbose 'quoted text'
+	echo x=1 ${HOME} readonly cd sed awk && local | cd 'quoted text' cd test then
+x=1 export | sed echo then ${HOME} cd test echo && sed
+		x=1 sed local 2>/dev/null -eu printf cd 'quoted text' ${HOME} --verbose
+	readonly --verbose then $(pwd)
+	grep echo && --verbose ${HOME}
+grep ${HOME} local readonly local -eu $(pwd) cd "$@" $(pwd)
+--verbose awk "$@" echo echo cd 2>/dev/null
+x=1 | 2>/dev/null export test cd awk --verbose grep cd 'quoted text' x=1
+	$(pwd) awk cd printf "$1" sed ${HOME} 2>/dev/null readonly 'quoted text' readonly
+	awk readonly done test | x=1 grep 'quoted text' --verbose echo readonly
+	local cd && x=1 test printf 'quoted text'
+		"$1" "$1" --verbose 'quoted text' --verbose cd "$@"
+		2>/dev/null "$@" "$@" readonly export 2>/dev/null $(pwd) export "$1"
+	x=1 grep printf $(pwd) then && echo
+"$@" then -eu echo echo export
+		grep x=1 'quoted text' echo /usr/bin cd "$1" $(pwd) printf $(pwd) --verbose
+echo $(pwd) sed awk x=1 done -eu "$1" -eu grep printf -eu
+		--verbose echo local /usr/bin readonly local then --verbose
+then "$@" then "$1" local sed "$@" 'quoted text' | then 2>/dev/null
+		awk grep test echo test grep 'quoted text' cd awk
+2>/dev/null -eu sed then export sed grep -eu 'quoted text'
+--verbose ${HOME} awk readonly
+	x=1 readonly x=1 grep
+		cd export echo local grep awk x=1 printf x=1 test -eu cd
+		"$1" then 2>/dev/null done test &&
+		&& 'quoted text' readonly
+cd done grep 'quoted text' -eu | 'quoted text'
+printf echo /usr/bin local && done readonly cd then $(pwd) --verbose 'quoted text'
+	--verbose "$@" cd test sed "$@" && && "$@"
+--verbose "$1" --verbose export export ${HOME} cd readonly x=1 ${HOME} awk echo
+| cd echo /usr/bin echo "$1" 'quoted text'
+sed export $(pwd) readonly export printf echo sed echo x=1 2>/dev/null
+		readonly then 2>/dev/null /usr/bin 2>/dev/null
+		export | readonly 2>/dev/null local awk printf local cd && awk local local
+		2>/dev/null echo test cd -eu -eu readonly
+cd ${HOME} -eu --verbose grep ${HOME} /usr/bin /usr/bin awk 2>/dev/null
+	| && export "$@" sed awk "$@" --verbose ${HOME}
+		${HOME} 'quoted text' cd --verbose | -eu readonly
+		readonly sed /usr/bin printf --verbose grep printf
+grep x=1 printf export export 2>/dev/null cd printf ${HOME} then echo 'quoted text'
+	x=1 echo then "$1" --verbose
+		&& export 2>/dev/null export "$@" then | 'quoted text'
+		2>/dev/null test cd -eu done then && done x=1 ${HOME} x=1 sed export --verbose
+	/usr/bin then 2>/dev/null
+		then $(pwd) grep $(pwd) --verbose printf "$@" awk 2>/dev/null --verbose
+"$@" printf "$@" readonly then ${HOME} $(pwd)
+readonly x=1 done test awk | export printf x=1 /usr/bin
+		$(pwd) "$1" ${HOME} done && grep readonly readonly 2>/dev/null --verbose
+2>/dev/null sed cd -eu grep
+	awk | 2>/dev/null 'quoted text' cd 'quoted text' grep 'quoted text' 2>/dev/null
+echo grep /usr/bin sed sed readonly
+done awk 2>/dev/null local && --verbose grep printf ${HOME} "$1"
+		&& echo export echo echo --verbose sed local echo test printf 2>/dev/null
+--verbose 2>/dev/null then local readonly done then x=1 /usr/bin 'quoted text'
+&& 2>/dev/null --verbose && done
+	${HOME} done && $(pwd) /usr/bin 2>/dev/null
+		'quoted text' then x=1 awk x=1 test | "$@" printf sed | 'quoted text' && awk
+then echo awk export sed echo export $(pwd) printf "$@" -eu
+		then readonly && local done 'quoted text' 'quoted text' sed
+	sed local | local export then 'quoted text' done
+	done /usr/bin then "$1" | && ${HOME} ${HOME}
+test test export test grep done test done then "$@" "$@" echo -eu echo &&
+local /usr/bin --verbose local printf sed --verbose
+grep --verbose "$@" ${HOME}
+		grep $(pwd) "$1" && /usr/bin $(pwd)
+		2>/dev/null "$@" ${HOME} grep export /usr/bin
+	done done "$@" then 2>/dev/null then done --verbose cd
+		cd "$@" --verbose echo && x=1 done
+		x=1 x=1 grep 2>/dev/null -eu cd | ${HOME} -eu
+	-eu done awk | then export && printf
+	grep ${HOME} 'quoted text' "$@" 2>/dev/null -eu 2>/dev/null then cd
+	| /usr/bin awk cd | test && grep test "$1" ${HOME} cd 'quoted text' && echo export
+	2>/dev/null local 2>/dev/null cd --verbose
+		then awk done ${HOME} test cd readonly local
+done x=1 "$1" | export done x=1 local
+done 2>/dev/null "$@" grep 'quoted text' readonly ${HOME} local
+	cd | 2>/dev/null test ${HOME} "$1" local grep "$1" 2>/dev/null "$@"
+	--verbose test "$1" test readonly "$@" && then
+		printf export 2>/dev/null --verbose ${HOME} done awk x=1 x=1
+	echo echo done ${HOME} awk
+		"$1" /usr/bin -eu --verbose printf printf sed export /usr/bin
+$(pwd) "$@" printf --verbose && export -eu "$@" sed $(pwd)
+2>/dev/null /usr/bin awk export
+		$(pwd) grep done "$1" -eu x=1 printf x=1 readonly
+		--verbose "$@" sed && export readonly printf /usr/bin awk 2>/dev/null
+/usr/bin done ${HOME} done cd printf --verbose -eu 'quoted text' readonly "$@" then
+--verbose 2>/dev/null "$@" grep test
+export local /usr/bin | awk done -eu && --verbose ${HOME} sed then
+| /usr/bin local readonly readonly --verbose export local
+'quoted text' awk ${HOME} | 2>/dev/null && export
+		sed x=1 && export --verbose readonly -eu awk | printf &&
+	2>/dev/null $(pwd) x=1 /usr/bin local | "$1" $(pwd)
+	x=1 done done readonly local "$@" readonly $(pwd) grep sed $(pwd)
+2>/dev/null echo test x=1 -eu ${HOME} "$1"
+	grep sed "$1" "$1" echo /usr/bin "$@" 2>/dev/null
+-eu -eu grep 2>/dev/null --verbose
+	/usr/bin echo export cd export grep test && printf
+		printf cd local -eu cd 2>/dev/null then export "$1" cd -eu 'quoted text'
+	sed echo echo | | then | sed --verbose 'quoted text'
+		readonly "$@" test done echo 'quoted text'
+	--verbose echo readonly export -eu
+export printf printf ${HOME} export local
+		| x=1 cd x=1 cd awk ${HOME} 2>/dev/null -eu
+	printf cd printf 'quoted text' grep x=1
+		'quoted text' export x=1 then done grep x=1 done awk 2>/dev/null
+		${HOME} cd | /usr/bin 2>/dev/null
+cd | grep 2>/dev/null --verbose
+	"$@" then local x=1 export 'quoted text' awk |
+		-eu readonly $(pwd) $(pwd) "$1" local export sed ${HOME}
+printf --verbose "$1" $(pwd) test awk readonly export
+		${HOME} "$1" 'quoted text' test --verbose ${HOME} x=1 ${HOME}
+readonly echo echo export -eu -eu "$1" then "$1" --verbose
+/usr/bin awk $(pwd) 2>/dev/null /usr/bin printf then
+		grep 'quoted text' local local printf grep x=1 x=1 grep
+		test x=1 'quoted text' ${HOME} cd test printf ${HOME} &&
+	printf export awk then $(pwd) sed ${HOME} echo -eu readonly local
+	$(pwd) sed sed -eu "$1" --verbose x=1 2>/dev/null local -eu 'quoted text' 2>/dev/null
+		echo $(pwd) "$1" "$1" printf ${HOME} $(pwd) test | ${HOME} test
+-eu test echo && x=1 -eu $(pwd) && x=1 sed && -eu --verbose &&
+		/usr/bin awk cd "$1" ${HOME} grep $(pwd) 2>/dev/null test export then ${HOME}
+&& | 2>/dev/null grep x=1 readonly "$@" local "$1" && | sed "$@" sed sed /usr/bin
+	done /usr/bin readonly echo readonly /usr/bin | ${HOME} | export $(pwd) done
+		readonly printf local grep test echo test echo cd export ${HOME}
+test local printf | /usr/bin --verbose "$@" $(pwd) -eu ${HOME} done done
+test grep && "$@" echo echo readonly "$1" local
+		| -eu "$@" $(pwd) then -eu readonly readonly readonly done
+	done "$1" awk "$@" then then echo 2>/dev/null sed local awk /usr/bin sed "$1"
+${HOME} "$1" local "$1" && "$@" x=1 export
+		export grep 'quoted text' readonly export local 2>/dev/null /usr/bin | test
+		local 2>/dev/null "$@" awk /usr/bin cd x=1 printf export
+	grep /usr/bin x=1 readonly test
+x=1 && --verbose -eu export && 2>/dev/null
+		| ${HOME} "$1" done ${HOME} then test local done "$1" readonly
+		&& cd grep /usr/bin ${HOME}
+&& --verbose $(pwd) --verbose echo test "$@" cd then export x=1 export then
+	"$@" $(pwd) 2>/dev/null cd --verbose "$1" --verbose grep grep sed
+cd done local "$@" echo --verbose done then sed cd then export 2>/dev/null
+	&& local /usr/bin "$1" readonly 'quoted text' done printf -eu local
+	readonly awk && awk export awk local "$@" --verbose then x=1 then
+'quoted text' local $(pwd) x=1 ${HOME} ${HOME}
+	grep ${HOME} 2>/dev/null 2>/dev/null grep awk $(pwd) $(pwd) "$@"
+"$1" ${HOME} readonly -eu then cd && "$@" 2>/dev/null
+	2>/dev/null grep then ${HOME} 2>/dev/null grep ${HOME} "$@" cd printf
+	--verbose --verbose | /usr/bin sed x=1 -eu ${HOME} grep test 2>/dev/null
+		grep && ${HOME} "$1" then then export $(pwd) /usr/bin export printf
+		2>/dev/null sed $(pwd) x=1 echo x=1 done
+		export 'quoted text' 2>/dev/null $(pwd) "$@" done grep /usr/bin $(pwd) |
+	cd printf grep test export test | test echo echo awk 2>/dev/null &&
+		--verbose x=1 "$1" 'quoted text' grep printf x=1 ${HOME} test
+		test test local ${HOME} $(pwd) "$@" "$1" sed then done /usr/bin
+then 'quoted text' "$@" && printf readonly sed
+		printf export export export printf ${HOME} sed -eu test /usr/bin x=1 --verbose
+	/usr/bin printf readonly -eu "$@" -eu | | x=1 $(pwd) echo ${HOME}
+		printf ${HOME} /usr/bin grep -eu cd local awk "$@" awk local printf
+	x=1 then --verbose readonly then readonly printf cd
+/usr/bin "$1" awk test $(pwd) done ${HOME} then echo echo --verbose
+	grep awk test printf $(pwd) then readonly -eu done grep printf grep 'quoted text'
+	'quoted text' "$1" done x=1 local "$@" export done readonly readonly
+test readonly export --verbose readonly ${HOME} /usr/bin
+	&& grep test test printf 'quoted text' readonly awk ${HOME} readonly
+		export 2>/dev/null sed test grep
+		-eu readonly "$1" printf awk ${HOME} && "$@" ${HOME}
+	echo printf awk export "$1"
+	| awk done test "$1" -eu
+	-eu --verbose $(pwd) sed -eu $(pwd) then cd "$1" | 2>/dev/null
+done readonly -eu sed -eu
+	'quoted text' 'quoted text' | grep echo -eu x=1 ${HOME}
+	sed readonly x=1 grep /usr/bin echo test sed ${HOME}
+/usr/bin /usr/bin "$1" ${HOME} | x=1 sed done /usr/bin sed --verbose
+	printf x=1 && cd printf ${HOME} test readonly --verbose --verbose &&
+	--verbose done 2>/dev/null grep x=1 test then $(pwd) test cd x=1 sed
+		-eu "$@" echo && then printf export
+		2>/dev/null -eu x=1 grep --verbose ${HOME} | readonly echo done
+	&& export awk -eu readonly done
+		| export awk awk -eu done printf x=1 /usr/bin "$1" cd 'quoted text' "$@" done
+		test then x=1 test $(pwd) ${HOME} local "$1" 2>/dev/null awk local ${HOME} ${HOME}
+	echo && printf local "$1" then && sed then 'quoted text'
+&& "$@" x=1 | -eu grep ${HOME} | /usr/bin
+	"$@" then | ${HOME} /usr/bin $(pwd) $(pwd) export --verbose "$@"
+x=1 test local ${HOME} | ${HOME} export --verbose then 'quoted text' &&
+${HOME} awk 'quoted text' | /usr/bin test
+	'quoted text' grep | grep export cd export --verbose
+	--verbose "$@" printf x=1
+		| done cd then "$1" test echo
+awk $(pwd) 'quoted text' -eu /usr/bin 2>/dev/null && "$1" | awk readonly
+	local local "$@" ${HOME}
+		local 2>/dev/null /usr/bin cd sed test ${HOME} | test
+&& sed sed done 2>/dev/null done readonly
+	then ${HOME} echo --verbose sed local -eu 2>/dev/null
+$(pwd) $(pwd) "$@" sed 2>/dev/null /usr/bin
+echo $(pwd) $(pwd) awk sed "$@" x=1 $(pwd)
+	/usr/bin echo x=1 grep "$@"
+x=1 --verbose local -eu local $(pwd) then /usr/bin sed ${HOME}
+	printf $(pwd) "$@" then awk done
+awk then | /usr/bin 2>/dev/null ${HOME} --verbose test printf | x=1
+		cd x=1 --verbose then 2>/dev/null -eu echo local sed && cd 2>/dev/null 2>/dev/null
+		local 'quoted text' done $(pwd) echo
+		&& x=1 --verbose then grep awk readonly ${HOME}
+2>/dev/null awk export "$@"
+		then && then -eu printf export
+	sed --verbose then then 'quoted text' "$1" -eu -eu 'quoted text'
+-eu 2>/dev/null local "$@" $(pwd) "$@" "$@" export 2>/dev/null done x=1
+| grep readonly ${HOME} awk grep 2>/dev/null local x=1 --verbose
+	awk --verbose /usr/bin test "$1" "$@" -eu 2>/dev/null "$1" | "$1" test "$1"
+		"$@" "$1" | cd --verbose test echo grep local
+	grep local done done awk sed x=1 /usr/bin "$1" | "$1" 'quoted text'
+--verbose awk ${HOME} -eu 'quoted text' | done awk ${HOME} $(pwd) local readonly
+${HOME} readonly sed | $(pwd) awk | test awk $(pwd) done $(pwd) 'quoted text'
+	"$1" /usr/bin --verbose /usr/bin
+test export grep | | test "$@" printf && test "$1" export ${HOME}
+readonly "$1" && sed
+	/usr/bin /usr/bin "$@" --verbose readonly test "$@" "$@"
+		done cd local --verbose local /usr/bin local local 'quoted text'
+	&& -eu 2>/dev/null cd /usr/bin | x=1 cd 'quoted text' sed cd printf
+		&& then done /usr/bin ${HOME} export awk x=1 /usr/bin x=1 then -eu -eu echo
+"$@" local readonly test done 'quoted text' && ${HOME} && sed 2>/dev/null
+2>/dev/null $(pwd) x=1 ${HOME} local 'quoted text'
+	--verbose -eu "$1" done test readonly done printf test -eu
+	-eu "$@" --verbose echo && awk done awk echo ${HOME}
+		then local 'quoted text' echo &&
+	${HOME} | then 'quoted text' ${HOME} ${HOME} awk grep
+grep --verbose ${HOME} test then echo done -eu
+	"$@" ${HOME} cd /usr/bin $(pwd) ${HOME} local
+		done x=1 2>/dev/null $(pwd) test
+		| test && echo printf awk 2>/dev/null test sed awk test 'quoted text'
+export printf then local export 'quoted text'
+"$1" "$1" then readonly
+&& awk sed ${HOME} readonly done ${HOME} | awk ${HOME} --verbose
+		${HOME} -eu --verbose | export done printf && readonly --verbose awk "$1" readonly
+cd readonly /usr/bin test && local x=1 awk "$1" then printf printf
+#include c30.sh
+		$(pwd) sed $(pwd) sed | echo x=1 done local local
+	cd --verbose x=1 echo "$1" 'quoted text' 2>/dev/null
+		then awk "$@" local | "$@" then
+		sed | echo "$1" test done /usr/bin $(pwd) test x=1 cd x=1 printf 2>/dev/null
+	grep printf "$@" sed readonly then awk then x=1 --verbose then readonly local
+		export /usr/bin sed x=1 | "$@" /usr/bin "$@" local
+export 'quoted text' then 'quoted text' x=1 && done -eu then $(pwd) readonly
+	x=1 grep readonly done ${HOME} $(pwd) --verbose readonly | --verbose
+	${HOME} sed | ${HOME} awk test --verbose
+	awk grep printf $(pwd) sed export printf grep then | "$@" /usr/bin
+	-eu printf --verbose printf "$@" grep printf printf echo && awk cd export done
+	awk grep "$@" then readonly then ${HOME} export awk --verbose sed ${HOME} ${HOME}
+		awk cd "$@" cd "$@" | 'quoted text'
+	"$1" done echo then awk awk ${HOME}
+	/usr/bin ${HOME} then sed -eu export x=1 done x=1 ${HOME} ${HOME}
+awk then "$@" sed "$1" ${HOME} awk
+	--verbose ${HOME} $(pwd) x=1 && "$1" test test sed
+local printf -eu /usr/bin --verbose x=1 sed grep $(pwd)
+	awk test 'quoted text' printf test printf done done --verbose awk printf done
+		test export done awk x=1 test && then | --verbose
+	done echo $(pwd) echo -eu awk "$1" cd cd /usr/bin echo
+awk done /usr/bin local 2>/dev/null
+	x=1 printf readonly test awk sed 'quoted text' then
+	2>/dev/null $(pwd) /usr/bin
+	| awk echo 2>/dev/null grep "$@" cd done "$@"
+"$@" /usr/bin done awk done printf 2>/dev/null 2>/dev/null local
+	printf 'quoted text' sed printf 2>/dev/null | /usr/bin export
+		echo -eu sed ${HOME} x=1 awk
+export test 'quoted text' "$@" then readonly 2>/dev/null
+-eu --verbose -eu --verbose
+	cd local printf done && sed ${HOME} sed printf | "$1" sed test 'quoted text'
+		x=1 ${HOME} x=1 | printf "$1" grep local /usr/bin printf x=1
+/usr/bin local readonly 2>/dev/null | cd cd "$1" done 'quoted text'
+		"$1" -eu export 'quoted text' -eu --verbose "$@" then -eu
+		x=1 2>/dev/null test && -eu cd export --verbose
+$(pwd) $(pwd) /usr/bin -eu sed test readonly test test then 'quoted text' then
+| | then done echo && | -eu readonly cd export "$@" /usr/bin printf x=1 sed
+		awk export | grep readonly -eu then readonly $(pwd) x=1 done grep
+		echo -eu local && sed sed done test export
+echo readonly cd $(pwd) sed "$1" printf sed sed then test
+	then local sed && && $(pwd) sed /usr/bin done awk done
+	sed ${HOME} "$@" $(pwd) printf local
+		readonly $(pwd) readonly && "$@" 2>/dev/null then -eu awk local readonly
+	test grep "$1" && export x=1 | readonly
+	"$@" cd test grep sed --verbose ${HOME} then 2>/dev/null
+		$(pwd) cd | $(pwd) local awk readonly sed grep /usr/bin test
+	sed printf echo | $(pwd) grep --verbose
+	local printf cd | $(pwd) ${HOME}
+	test "$1" 'quoted text' x=1 export then cd && | then then echo
+cd -eu "$1" | -eu /usr/bin $(pwd) "$1" sed --verbose printf /usr/bin && /usr/bin
+	"$@" ${HOME} /usr/bin 2>/dev/null --verbose test --verbose grep | awk 'quoted text'
+	sed "$@" printf then 2>/dev/null readonly && printf $(pwd) ${HOME}
+		"$1" --verbose ${HOME} "$1" 2>/dev/null then local printf
+readonly 'quoted text' grep | printf awk ${HOME} $(pwd) 'quoted text' done
+	$(pwd) ${HOME} cd "$1" readonly
+readonly "$1" "$1" readonly test export -eu 'quoted text'
+	cd "$@" awk --verbose readonly -eu "$@" "$1" readonly awk $(pwd) -eu readonly
+printf "$1" "$@" awk awk && $(pwd) cd done
+		local awk cd "$@" sed printf readonly export ${HOME} | sed | test x=1 done
+		| export x=1 ${HOME} 'quoted text' x=1 printf
+	grep readonly then -eu
+	&& $(pwd) x=1 then | test 2>/dev/null test /usr/bin
+	--verbose done "$1" sed "$@" export test x=1 ${HOME}
+	&& cd cd done $(pwd) sed
+		&& && | local && test printf | done sed ${HOME} /usr/bin export echo --verbose
+		local ${HOME} export "$@" && local printf export --verbose 'quoted text' -eu awk
+	readonly ${HOME} && 2>/dev/null export ${HOME} ${HOME} local printf
+	2>/dev/null x=1 /usr/bin
+		&& /usr/bin "$@" printf cd 'quoted text' readonly test echo test && sed --verbose
+	printf | "$@" 2>/dev/null && sed -eu $(pwd) "$1" /usr/bin printf "$1" cd && 2>/dev/null
+2>/dev/null then x=1 test ${HOME} 'quoted text'
+		--verbose "$1" "$@" test --verbose 2>/dev/null readonly
+--verbose $(pwd) -eu "$1" awk /usr/bin grep sed $(pwd) awk --verbose
+echo then echo sed ${HOME} /usr/bin "$1" export | "$@" 'quoted text'
+local export && awk "$1" 2>/dev/null |
+x=1 "$@" ${HOME} test printf local cd && "$1"
+		test x=1 | /usr/bin done "$1" && printf cd --verbose
+export awk then then test 'quoted text' done && done $(pwd)
+	sed && then printf export | && --verbose echo printf
+	printf awk sed then -eu 2>/dev/null "$@" ${HOME} "$@" printf x=1
+		local -eu done cd ${HOME} then --verbose
+		export "$1" then grep awk -eu /usr/bin && grep "$@" "$@"
+| test printf local "$1" /usr/bin sed grep 2>/dev/null
+	x=1 --verbose echo && "$@" done readonly export && "$@"
+readonly | && printf printf export ${HOME} x=1 'quoted text' sed test
+test sed "$1" x=1 $(pwd) grep ${HOME} 'quoted text'
+		printf done ${HOME} cd 2>/dev/null && local /usr/bin
+		'quoted text' cd readonly "$1" --verbose ${HOME} echo
+		awk printf /usr/bin $(pwd) done sed 2>/dev/null then test awk
+2>/dev/null ${HOME} done 'quoted text'
+readonly 2>/dev/null done x=1 readonly awk printf 2>/dev/null
+	then printf "$1" "$@" "$1" --verbose local cd readonly local export then 'quoted text'
+		$(pwd) awk && "$1" readonly then readonly 'quoted text'
+		sed export /usr/bin local done then 'quoted text'
+	2>/dev/null -eu $(pwd)
+	export local then 2>/dev/null "$@" /usr/bin && | -eu /usr/bin test echo
+		sed 2>/dev/null 2>/dev/null /usr/bin 'quoted text'
+readonly done echo done grep
+	readonly awk then | done "$@" printf sed awk 'quoted text' local awk x=1 export
+		${HOME} done /usr/bin "$@" grep printf "$@" x=1 awk
+		$(pwd) "$@" /usr/bin cd readonly
+2>/dev/null 'quoted text' readonly "$1"
+	'quoted text' --verbose awk export --verbose then readonly
+	then x=1 'quoted text' "$1" "$@" "$1" x=1 "$1" done
+sed ${HOME} done sed local "$1" readonly "$1" readonly export readonly
+		cd local -eu then export /usr/bin done awk --verbose echo sed done local
+		echo -eu then 'quoted text' --verbose readonly | 'quoted text' ${HOME}
+	--verbose -eu then "$@" /usr/bin export export echo printf
+| x=1 export done sed grep then 2>/dev/null "$@" && --verbose test test /usr/bin
+"$@" $(pwd) 2>/dev/null ${HOME}
+	echo awk x=1 2>/dev/null export 'quoted text'
+		sed | local -eu 'quoted text'
+		-eu -eu local "$@" export $(pwd) echo "$@" local local
+		-eu done x=1 done | $(pwd) --verbose
+${HOME} then sed /usr/bin && grep && readonly x=1 "$1" ${HOME} && test 2>/dev/null
+	&& "$1" export test done cd /usr/bin
+echo export ${HOME} $(pwd) -eu
+		export $(pwd) 'quoted text' --verbose | grep done $(pwd) export
+		&& test grep test -eu awk ${HOME} cd then export test
+	then | "$@" test "$1" -eu 2>/dev/null echo | 2>/dev/null
+local test | grep -eu --verbose x=1 readonly readonly local cd --verbose
+		$(pwd) export then "$1" "$@"
+		echo -eu sed | test "$@" $(pwd) 2>/dev/null /usr/bin local
+	cd -eu "$1" ${HOME} -eu /usr/bin grep then readonly /usr/bin 'quoted text'
+		echo cd $(pwd) test 'quoted text' x=1
+'quoted text' "$1" printf export export export x=1 "$1" $(pwd)
+		awk x=1 -eu printf -eu $(pwd) 2>/dev/null export 'quoted text'
+	local printf --verbose echo awk 'quoted text' printf --verbose
+		'quoted text' awk "$@"
+	echo grep && "$@" 2>/dev/null
+		--verbose test "$@" 2>/dev/null echo "$@"
+		echo --verbose 'quoted text' printf export then "$@" export readonly -eu
+		then then cd local 'quoted text' /usr/bin local "$1" --verbose
+		cd grep /usr/bin /usr/bin 2>/dev/null echo readonly
+'quoted text' export -eu
+then 2>/dev/null | sed 2>/dev/null "$1" readonly
+	printf export echo done | done sed printf | ${HOME} | /usr/bin
+	$(pwd) local /usr/bin readonly $(pwd) --verbose cd done ${HOME} "$@"
+		done echo /usr/bin grep printf && x=1 cd test cd $(pwd) --verbose
+	echo test && -eu ${HOME}
+"$@" x=1 export echo 2>/dev/null 'quoted text'
+grep readonly printf then echo | /usr/bin
+2>/dev/null sed grep 'quoted text' printf sed && cd grep x=1 && "$@" awk echo
+		x=1 && ${HOME} export
+		readonly test 2>/dev/null cd "$@" /usr/bin && /usr/bin
+	cd | done local 2>/dev/null then readonly "$1"
+	"$1" $(pwd) local --verbose then printf
+	2>/dev/null done $(pwd) && | 'quoted text' grep 2>/dev/null
+awk cd "$@" | x=1 sed "$@" local test echo $(pwd) 2>/dev/null awk printf
+	"$1" x=1 x=1 echo readonly printf then test awk 2>/dev/null local
+		| export 'quoted text' done "$1" then then "$@" -eu readonly $(pwd) test x=1 ${HOME}
+	local test "$@" readonly "$@" 2>/dev/null echo ${HOME} x=1 sed then test printf
+		done -eu --verbose export test awk then test /usr/bin 2>/dev/null ${HOME}
+		-eu test printf test cd done readonly grep --verbose awk
+		${HOME} then ${HOME} awk then
+		"$@" export awk grep then sed --verbose /usr/bin
+echo | 2>/dev/null export sed export /usr/bin x=1 && 2>/dev/null $(pwd) /usr/bin
+export /usr/bin "$@" then awk test test | test
+		'quoted text' "$1" echo
+		awk 'quoted text' | | | test awk done | "$1"
+sed echo grep 2>/dev/null readonly
+		"$@" sed "$1" /usr/bin x=1 done 2>/dev/null
+		/usr/bin -eu --verbose --verbose | 2>/dev/null
+done printf readonly --verbose
+		printf sed export sed ${HOME} test cd local /usr/bin
+	test 2>/dev/null /usr/bin done $(pwd) readonly readonly then "$1" x=1 local
+	"$1" 'quoted text' then
+local echo echo readonly 2>/dev/null local ${HOME} grep
+	"$1" 2>/dev/null printf printf then done printf grep grep export ${HOME}
+	--verbose | awk $(pwd) printf printf export test -eu grep
+		--verbose then $(pwd) local /usr/bin cd printf cd --verbose test awk 'quoted text'
+		${HOME} test | $(pwd) ${HOME} $(pwd) cd printf echo echo /usr/bin && --verbose
+	awk "$1" "$1" "$@" local 'quoted text' $(pwd)
+&& done x=1 x=1 printf readonly then
+cd /usr/bin then echo "$1" $(pwd) /usr/bin
+		"$1" ${HOME} export export | -eu x=1 --verbose "$1" cd done -eu
+sed readonly grep then $(pwd) 2>/dev/null then /usr/bin local printf
+		/usr/bin 2>/dev/null "$@" && ${HOME}
+		'quoted text' export && readonly
+readonly then --verbose readonly ${HOME} grep
+	then "$1" readonly | readonly 2>/dev/null echo --verbose
+	export x=1 ${HOME} export then "$@"
+done "$1" export "$1" $(pwd) ${HOME} --verbose then local --verbose
+export echo test printf 'quoted text' done grep $(pwd)
+		"$1" cd | test ${HOME} "$1" $(pwd)
+		$(pwd) x=1 -eu grep 'quoted text' sed
+		2>/dev/null "$@" --verbose $(pwd)
+${HOME} ${HOME} local && cd sed echo local x=1 sed
+'quoted text' readonly grep done /usr/bin x=1 awk printf "$1"
+&& /usr/bin done readonly local cd --verbose printf
+		--verbose && x=1 /usr/bin | $(pwd) -eu done sed
+		&& printf 'quoted text' readonly --verbose 'quoted text' sed printf grep
+		--verbose | --verbose --verbose sed 'quoted text' awk grep echo
+		${HOME} test --verbose
+		"$1" "$@" awk test $(pwd) "$@" -eu grep
+then local cd sed && "$1" sed then 2>/dev/null
+then local 'quoted text' local && then readonly grep
+2>/dev/null ${HOME} x=1 awk | sed done
+	then ${HOME} 'quoted text' /usr/bin test cd ${HOME} done ${HOME}
+	x=1 "$1" | echo cd echo local
+-eu then export && --verbose test local
+		then done then then export $(pwd)
+	test test 'quoted text'
+		2>/dev/null readonly grep local $(pwd) --verbose 2>/dev/null && 'quoted text'
+		export x=1 readonly grep local --verbose --verbose test ${HOME} &&
+	cd 'quoted text' /usr/bin -eu -eu
+	test -eu --verbose 'quoted text' --verbose | x=1 sed | "$@" local awk awk x=1
+readonly /usr/bin readonly
+	&& grep 2>/dev/null sed "$@" && readonly $(pwd) 'quoted text' /usr/bin
+echo -eu | && 2>/dev/null cd echo "$1" test cd readonly --verbose
+	done test -eu 2>/dev/null --verbose "$@" then
+	sed done local echo sed grep |
+		2>/dev/null local local grep "$1" echo then && then "$1" done
+${HOME} readonly --verbose awk --verbose
+	export echo test | $(pwd) then
+'quoted text' echo awk --verbose awk -eu readonly --verbose && 'quoted text'
+	$(pwd) echo x=1 -eu awk | ${HOME} export | "$1" -eu
+		grep echo | $(pwd) x=1 $(pwd) | printf 2>/dev/null awk local x=1 --verbose readonly
+	then printf grep local | ${HOME} 2>/dev/null | sed --verbose sed ${HOME}
+	| echo $(pwd) --verbose 'quoted text' test local done awk
+	sed readonly 'quoted text' grep
+	2>/dev/null readonly $(pwd) local --verbose
+cd done "$@" /usr/bin "$1" readonly && readonly cd grep echo sed grep test
+'quoted text' awk cd 2>/dev/null
+	| export printf awk x=1 "$@" 2>/dev/null echo sed && readonly
+echo 2>/dev/null $(pwd)
+		--verbose export awk grep "$1"
+	--verbose local export test export x=1
+local export printf ${HOME} test
+		$(pwd) $(pwd) printf --verbose 'quoted text' export done $(pwd) $(pwd) "$1" 2>/dev/null
+	then export done && printf test awk then 2>/dev/null echo grep 'quoted text'
+		&& $(pwd) grep /usr/bin grep ${HOME}
+$(pwd) sed "$1" printf /usr/bin -eu x=1 done test echo done /usr/bin x=1 "$1"
+| "$1" 'quoted text' /usr/bin
+	sed done ${HOME} export 2>/dev/null $(pwd) done 2>/dev/null | $(pwd)
+sed x=1 test | "$@" echo x=1 then echo | grep "$1" sed
+	2>/dev/null awk test x=1
+	cd echo && local x=1 --verbose
+"$1" test cd "$1" && done done --verbose -eu /usr/bin 2>/dev/null grep /usr/bin
+	cd /usr/bin done grep x=1 then -eu | done "$1" x=1
+		grep export "$@" && && sed ${HOME} readonly test test readonly --verbose
+		$(pwd) -eu grep 'quoted text' 'quoted text' awk
+local -eu cd export "$1" x=1 then "$1" --verbose test
+	local export x=1 local echo grep /usr/bin "$@" local 'quoted text'
+		test "$@" && export grep | ${HOME} $(pwd) readonly awk
+	awk --verbose grep /usr/bin ${HOME} then --verbose x=1 --verbose x=1 /usr/bin
+done "$@" readonly cd /usr/bin 2>/dev/null 2>/dev/null grep
+	export "$1" grep cd 2>/dev/null grep
+		cd printf then grep x=1 /usr/bin x=1 "$@"
+	| awk "$@" ${HOME} | 'quoted text' 'quoted text' ${HOME} "$@" 2>/dev/null
+	| local -eu export readonly awk export awk local export 'quoted text'
+	$(pwd) local | "$1" local cd awk
+		done 'quoted text' printf "$1" --verbose done && printf
+x=1 | test export sed "$@" 2>/dev/null test $(pwd) done ${HOME} --verbose
+| -eu x=1 /usr/bin --verbose export then "$@" "$1" "$1" export $(pwd)
+done sed 2>/dev/null $(pwd) readonly /usr/bin /usr/bin readonly 'quoted text'
+		cd printf printf grep ${HOME} 'quoted text' printf "$1"
+	${HOME} && /usr/bin printf
+	done test echo /usr/bin "$@" sed "$@" ${HOME} 2>/dev/null
+		local echo printf local $(pwd) "$@" printf
+	echo ${HOME} --verbose
+awk "$1" /usr/bin /usr/bin 'quoted text' then done local awk
+awk | grep grep 2>/dev/null
+		printf $(pwd) grep echo sed "$@" -eu export
+		test ${HOME} cd && cd /usr/bin local export local
+${HOME} /usr/bin "$@" printf cd grep ${HOME} echo 2>/dev/null printf
+	--verbose -eu ${HOME} echo
+	'quoted text' then local done "$@" readonly 'quoted text'
+		printf -eu readonly -eu printf
+'quoted text' 'quoted text' 2>/dev/null && done test --verbose
+		grep 'quoted text' readonly /usr/bin sed cd $(pwd) cd awk awk
+test sed printf -eu export x=1 local
+	cd grep done "$@" ${HOME} done printf /usr/bin 'quoted text' 'quoted text'
+	x=1 awk "$@" && grep | then ${HOME} done readonly cd && ${HOME} grep local
+	${HOME} then x=1 grep x=1 done
+		done 2>/dev/null && cd "$@" 'quoted text'
+| echo grep $(pwd) $(pwd) local && "$1"
+/usr/bin local done -eu "$@" /usr/bin local "$@" -eu --verbose
+	--verbose ${HOME} then ${HOME} $(pwd) local 2>/dev/null local -eu readonly
+		--verbose printf local grep /usr/bin
+		'quoted text' sed local test $(pwd) -eu 'quoted text' echo && | then x=1
+	grep export local --verbose 'quoted text'
+then x=1 awk then grep -eu ${HOME} ${HOME} /usr/bin test x=1 | "$1"
+		$(pwd) then test ${HOME} -eu
+		-eu 2>/dev/null ${HOME} sed printf printf export
+2>/dev/null cd printf -eu "$1" 2>/dev/null
+		"$@" awk test --verbose | export then readonly printf printf
+cd grep local /usr/bin -eu
+		/usr/bin && "$1" 'quoted text' awk ${HOME} local -eu 2>/dev/null
+	done export 2>/dev/null -eu then x=1 | $(pwd) "$1" readonly x=1 awk 'quoted text'
+		$(pwd) readonly x=1 x=1 grep grep grep | ${HOME} && test awk $(pwd) 2>/dev/null
+		"$1" | ${HOME} awk then test && --verbose awk "$@" readonly
+	readonly printf "$@" | sed local ${HOME} && then "$1" awk local $(pwd) awk
+${HOME} readonly | cd 2>/dev/null
+		cd 'quoted text' test export /usr/bin
+		--verbose ${HOME} x=1 "$@" cd 'quoted text' 2>/dev/null printf local ${HOME} sed
+	readonly /usr/bin done 2>/dev/null | grep printf export ${HOME}
+sed x=1 | --verbose export readonly local export && export
+x=1 2>/dev/null | --verbose cd && sed awk done
+2>/dev/null echo 2>/dev/null printf readonly ${HOME} sed test awk | local
+	'quoted text' && /usr/bin test sed "$@" echo "$1" then
+	sed ${HOME} export done | sed 2>/dev/null echo test printf readonly && local printf
+		x=1 && export "$@" "$1" "$@" test "$1" export awk | 2>/dev/null "$@"
+test "$@" printf echo readonly 2>/dev/null grep grep echo local readonly
+grep printf then test local 'quoted text' /usr/bin
+--verbose echo | -eu test && printf 'quoted text'
+	x=1 -eu awk -eu 2>/dev/null sed test
+	2>/dev/null 'quoted text' -eu then $(pwd) | && $(pwd) /usr/bin
+	done echo 2>/dev/null grep "$@" | awk local 2>/dev/null
+"$@" awk | done /usr/bin | | awk | ${HOME} local /usr/bin /usr/bin local
+	'quoted text' done --verbose local done ${HOME} && export | "$@" test printf
+		&& echo local then ${HOME} awk "$@" then
+	${HOME} "$@" printf /usr/bin
+	awk 2>/dev/null --verbose 2>/dev/null test "$1" cd 'quoted text'
+		local printf 'quoted text' && ${HOME} "$@"
+		readonly --verbose && echo
+'quoted text' 2>/dev/null --verbose "$@" 'quoted text' readonly
+export x=1 --verbose awk | test cd --verbose
+	local awk then awk done export x=1 "$@"
+	awk sed | test grep readonly "$1" then export export
+	sed 'quoted text' ${HOME} $(pwd) "$@" readonly
+readonly "$@" echo export awk 'quoted text'
+local awk "$@" | export "$1" printf local ${HOME}
+/usr/bin $(pwd) awk cd sed
+then grep 2>/dev/null printf test local "$@" | | $(pwd) local cd "$@" sed
+	sed /usr/bin x=1 && cd test && local --verbose x=1 x=1 local local ${HOME} test
+	sed cd local 'quoted text' echo 'quoted text' done "$@" x=1 'quoted text'
+		grep cd local cd readonly "$@" 2>/dev/null ${HOME}
+	done readonly then sed /usr/bin done 'quoted text' $(pwd)
+	awk done done | x=1 done local readonly "$1"
+grep sed awk echo ${HOME} test --verbose
+		&& $(pwd) sed --verbose export test "$@" "$1" "$1" "$@"
+		--verbose -eu | "$1"
+| x=1 printf echo ${HOME} -eu test local export sed
+test $(pwd) $(pwd) x=1 awk awk grep then readonly test done /usr/bin
+		/usr/bin 'quoted text' grep 2>/dev/null
+		/usr/bin /usr/bin ${HOME} | -eu export export && printf printf &&
+"$1" ${HOME} 2>/dev/null 2>/dev/null "$1" $(pwd) awk ${HOME} &&
+"$@" 2>/dev/null export sed "$@" "$@" "$@" cd export 'quoted text'
+	then "$1" "$@" "$1" "$1" /usr/bin readonly --verbose export ${HOME} 'quoted text'
+	&& -eu export /usr/bin && done x=1 awk 2>/dev/null ${HOME} readonly 2>/dev/null
+	cd printf echo && then local x=1 then local /usr/bin -eu printf 'quoted text'
+	printf --verbose awk --verbose
+		printf && local --verbose "$1" | && awk sed 2>/dev/null
+		-eu echo "$1" export test --verbose
+	"$@" awk -eu then readonly grep && then test ${HOME} echo "$1"
+		echo then "$1" ${HOME} | /usr/bin
+	test readonly local x=1 echo export
+	"$1" -eu printf -eu awk
+	"$@" cd $(pwd) x=1 then /usr/bin "$1" test && test "$1"
+		| awk --verbose printf "$1" grep printf
+		/usr/bin --verbose | 'quoted text'
+		2>/dev/null "$@" && x=1 && done x=1 ${HOME}
+2>/dev/null | grep --verbose /usr/bin -eu | 'quoted text'
+	test export awk $(pwd) && /usr/bin -eu 'quoted text' sed
+--verbose sed awk x=1 | 'quoted text' "$@" | local 2>/dev/null | test
+		grep printf awk echo cd readonly
+	awk test /usr/bin "$@" x=1 export |
+	done done test /usr/bin $(pwd) && then awk && /usr/bin
+	done sed | $(pwd) readonly ${HOME}
+		-eu then readonly --verbose printf /usr/bin awk readonly
+		printf awk x=1 'quoted text' export
+		-eu 2>/dev/null then grep 'quoted text'
+		test x=1 done cd x=1 --verbose cd then cd echo -eu then 'quoted text' | |
+		sed -eu 2>/dev/null printf
+&& sed test cd ${HOME} then readonly | export "$@" && /usr/bin $(pwd) grep 2>/dev/null
+	"$1" awk --verbose -eu cd awk printf ${HOME} awk then local printf test
+		&& --verbose x=1 -eu export "$1" && local && sed cd export -eu awk
+		x=1 /usr/bin 2>/dev/null awk --verbose awk done readonly grep local $(pwd) 'quoted text'
+	"$@" sed "$@" sed sed awk test | | cd -eu --verbose /usr/bin grep done && readonly
+	-eu cd /usr/bin cd awk echo
+local done then then local
+	test --verbose ${HOME} printf grep --verbose
+		awk ${HOME} local sed export 2>/dev/null test
+	${HOME} "$1" then 'quoted text'
+		local $(pwd) $(pwd) printf 2>/dev/null export x=1 /usr/bin && "$1" cd x=1 cd | printf
+	done "$1" then --verbose then test
+	$(pwd) /usr/bin && done grep $(pwd) && 'quoted text'
+	"$@" | printf 'quoted text' test ${HOME} /usr/bin && awk
+${HOME} sed grep printf x=1 --verbose
+	awk -eu readonly | echo sed readonly
+		/usr/bin | echo --verbose export echo ${HOME} $(pwd) local
+2>/dev/null export /usr/bin test test readonly grep
+test 2>/dev/null echo && then 'quoted text' awk local
+&& x=1 grep /usr/bin local x=1 /usr/bin grep -eu cd test $(pwd)
+awk 'quoted text' && "$@" then
+sed then "$1" && grep 'quoted text'
+'quoted text' -eu ${HOME} export readonly $(pwd) "$@" | $(pwd)
+readonly --verbose echo export cd sed ${HOME} "$1" done "$@"
+	done grep x=1 && then -eu sed cd "$@"
+/usr/bin --verbose export test export sed
+		sed -eu /usr/bin readonly ${HOME} $(pwd)
+| --verbose printf "$@" /usr/bin sed readonly then grep cd -eu cd
+	then "$1" then echo -eu 'quoted text'
+		${HOME} 2>/dev/null sed "$1" readonly
+		test done awk | cd | sed 'quoted text' export cd 'quoted text'
+sed then then && export export printf
+then && echo local /usr/bin 2>/dev/null ${HOME}
+		test sed cd -eu sed "$@" echo | | | -eu printf
+/usr/bin 2>/dev/null 2>/dev/null then export -eu cd local 2>/dev/null
+done | test "$1" 2>/dev/null
+awk then sed awk && awk then test export readonly x=1 $(pwd) cd test test |
+awk sed && grep sed --verbose "$@" sed && $(pwd) cd echo && "$@"
+	${HOME} cd done $(pwd) | $(pwd) then export | ${HOME}
+	"$@" grep done | -eu "$1" sed done echo "$1" sed "$@" --verbose
+		$(pwd) ${HOME} grep printf test ${HOME} grep
+	printf --verbose printf 'quoted text' printf 2>/dev/null "$1"
+$(pwd) x=1 | && cd grep export readonly sed $(pwd) sed sed local grep 2>/dev/null
+| readonly echo grep "$@" printf | test awk sed echo readonly readonly test -eu
+	| 2>/dev/null test -eu "$@" x=1 cd $(pwd) readonly export printf done
+		${HOME} $(pwd) 'quoted text' printf $(pwd) && --verbose x=1 sed -eu grep
+		$(pwd) readonly local && /usr/bin /usr/bin --verbose printf /usr/bin -eu
+sed | grep 'quoted text' test ${HOME} printf 2>/dev/null printf
+		2>/dev/null x=1 awk -eu $(pwd) cd --verbose readonly awk /usr/bin ${HOME}
+		test "$1" x=1 -eu x=1 local /usr/bin echo
+-eu --verbose 'quoted text' test | | test --verbose test x=1 grep --verbose
+"$1" /usr/bin -eu $(pwd) echo then | | sed 2>/dev/null
+"$1" printf "$@" /usr/bin printf export
+		"$1" 2>/dev/null printf ${HOME} echo cd x=1 x=1 echo 2>/dev/null | export
+	${HOME} local readonly ${HOME} readonly
+	then done cd && "$@" sed sed awk
+		'quoted text' done 'quoted text' sed --verbose 2>/dev/null
+	readonly cd ${HOME} -eu done $(pwd) test readonly
+"$1" "$1" then printf ${HOME} --verbose export grep "$@" "$1"
+		2>/dev/null export sed /usr/bin ${HOME} sed printf "$@"
+	--verbose "$@" --verbose x=1
+2>/dev/null done --verbose /usr/bin
+	${HOME} | --verbose /usr/bin | 'quoted text' test 'quoted text'
+	| export cd done --verbose then -eu "$@" done x=1 export /usr/bin awk && readonly
+	readonly "$@" "$1" 'quoted text' export awk ${HOME} grep 2>/dev/null cd
+2>/dev/null export --verbose $(pwd) | export export done
+"$1" grep printf ${HOME} then ${HOME} sed "$1" readonly sed awk ${HOME}
+&& awk --verbose -eu grep export 'quoted text' printf --verbose -eu
+	printf x=1 echo x=1 x=1 2>/dev/null "$1" done x=1 "$1" echo
+printf grep test x=1 --verbose printf 2>/dev/null printf echo
+sed && awk /usr/bin export --verbose local /usr/bin 2>/dev/null && -eu printf
+	printf sed cd ${HOME} done cd then test --verbose /usr/bin -eu && test
+	${HOME} "$@" grep $(pwd) echo local printf
+$(pwd) | 2>/dev/null && cd done grep grep 'quoted text'
+		sed sed awk echo local -eu /usr/bin export
+		'quoted text' && test $(pwd) awk done && grep && readonly
+	printf /usr/bin grep readonly |
+printf | then sed --verbose $(pwd) --verbose readonly readonly then
+readonly | "$@" then -eu grep grep
+	x=1 sed done $(pwd) sed $(pwd) ${HOME} cd awk /usr/bin x=1 awk
+printf sed x=1 x=1 -eu sed local then -eu x=1 then --verbose | 'quoted text'
+test "$@" export readonly 2>/dev/null test 'quoted text' | printf
+export export | -eu && "$1" export
+	2>/dev/null grep /usr/bin then /usr/bin x=1 2>/dev/null 2>/dev/null
+	sed export "$@" $(pwd) /usr/bin local test awk readonly "$1" cd local && awk
+		/usr/bin done x=1 test local --verbose sed |
+	readonly $(pwd) $(pwd) echo
+"$@" grep x=1 "$@" grep awk ${HOME} $(pwd) x=1 cd local | grep awk cd
+	done readonly | echo sed export /usr/bin test echo 'quoted text' ${HOME} x=1
+	then -eu awk done | done 2>/dev/null -eu test && sed test | local grep
+	x=1 cd readonly /usr/bin -eu
+	sed then echo "$@" && "$1"
+cd x=1 sed grep x=1 x=1 local local echo printf
+	sed local 2>/dev/null readonly
+	"$@" --verbose test -eu /usr/bin test ${HOME} printf ${HOME} 2>/dev/null
+awk echo local && export done
+	x=1 | "$@" done --verbose --verbose 'quoted text' 'quoted text'
+	printf "$1" awk 'quoted text' $(pwd) cd 'quoted text'
+	local cd cd "$1" x=1 -eu sed | 'quoted text' test then readonly
+printf | readonly $(pwd) awk "$@" grep sed echo done |
+x=1 ${HOME} grep test sed | 2>/dev/null 2>/dev/null readonly test
+		export test --verbose test readonly 'quoted text' "$@" test
+	/usr/bin test && "$@" --verbose ${HOME} /usr/bin export printf
+		$(pwd) /usr/bin && --verbose
+test export /usr/bin test printf printf echo test readonly
+"$1" done | && awk ${HOME} echo
+		sed done "$@" "$1" done 2>/dev/null "$@" -eu -eu && && export cd echo | &&
+sed readonly | sed "$@" "$1" ${HOME} readonly $(pwd)
+		'quoted text' cd done $(pwd) | 'quoted text'
+		echo then export echo grep --verbose cd x=1 cd test /usr/bin | test readonly
+		$(pwd) awk sed then done 'quoted text' grep 2>/dev/null export
+x=1 -eu done && $(pwd) readonly awk awk awk grep 'quoted text' | grep
+	export "$1" export /usr/bin "$@" grep
+'quoted text' grep 'quoted text' local $(pwd) cd done grep test test |
+	x=1 cd --verbose sed "$1" printf
+sed x=1 awk 2>/dev/null printf 2>/dev/null ${HOME} ${HOME} ${HOME} export
+echo export -eu local grep printf export sed local cd $(pwd)
+		"$@" grep grep printf 2>/dev/null cd 'quoted text' ${HOME} then test "$1"
+		echo --verbose $(pwd) /usr/bin && $(pwd) --verbose 'quoted text'
+		/usr/bin cd grep echo readonly
+"$1" $(pwd) then "$@" grep "$@" readonly readonly test test export "$@" grep
+	then then /usr/bin done /usr/bin ${HOME} "$1" /usr/bin 2>/dev/null
+		$(pwd) grep printf /usr/bin then echo export cd "$1" then export
+		"$1" "$1" then done /usr/bin $(pwd) | cd | 2>/dev/null
+test local x=1 cd "$1" done "$@" -eu export
+		${HOME} "$1" echo export "$1" awk
+		'quoted text' "$@" then
+	then 2>/dev/null ${HOME} --verbose $(pwd) --verbose export |
+printf $(pwd) | 2>/dev/null echo then echo
+printf readonly done /usr/bin && grep ${HOME} done test printf ${HOME}
+	2>/dev/null echo ${HOME} done echo && grep /usr/bin
+	readonly awk printf printf 2>/dev/null x=1 | local
+		local 'quoted text' test sed "$1" "$1" local
+/usr/bin -eu export export x=1 then
+	local x=1 && test ${HOME} "$@" ${HOME} /usr/bin test --verbose done readonly
+		local && x=1 2>/dev/null echo /usr/bin printf
+| echo "$@" printf grep printf local
+--verbose then awk awk ${HOME} --verbose
+	cd awk $(pwd) | "$1" -eu done echo sed ${HOME} x=1 done $(pwd)
+awk /usr/bin grep sed /usr/bin local awk then grep 2>/dev/null
+local 2>/dev/null && grep awk sed && "$1" printf
+		$(pwd) $(pwd) then -eu ${HOME} ${HOME} printf sed | export test grep then
+		cd local /usr/bin /usr/bin 2>/dev/null awk sed awk --verbose cd sed $(pwd) cd
+	--verbose /usr/bin grep sed | "$1" x=1 "$@" readonly then grep 2>/dev/null "$@"
+then readonly "$1" local ${HOME} echo then printf
+	| sed then $(pwd) "$1" "$@" export
+	| cd -eu readonly echo /usr/bin then printf ${HOME} then
+		x=1 echo awk $(pwd) then /usr/bin readonly ${HOME} cd local --verbose --verbose
+awk local then then printf cd export
+	awk readonly /usr/bin /usr/bin
+$(pwd) grep echo grep awk readonly printf
+		x=1 grep $(pwd) x=1 cd 2>/dev/null
+		--verbose && | 2>/dev/null sed
+	$(pwd) "$1" | local awk && "$1" awk readonly 2>/dev/null --verbose
+	'quoted text' 'quoted text' echo readonly readonly | "$1" --verbose
+	"$1" awk printf --verbose -eu 'quoted text' sed 2>/dev/null 2>/dev/null
+		sed echo awk ${HOME} done readonly done readonly test echo --verbose
+		/usr/bin $(pwd) cd $(pwd) 'quoted text'
+	awk && x=1 2>/dev/null --verbose
+'quoted text' readonly && 'quoted text'
+		"$@" grep --verbose &&
+		"$@" sed then $(pwd) ${HOME} --verbose
+		${HOME} grep grep awk sed $(pwd) x=1 "$1"
+	$(pwd) -eu /usr/bin ${HOME}
+sed sed --verbose awk 'quoted text' grep -eu -eu $(pwd)
+		$(pwd) local readonly then "$1" then 2>/dev/null x=1 && test | sed
+--verbose echo "$@" 2>/dev/null done sed --verbose local
+	--verbose readonly 2>/dev/null
+	test done "$@" ${HOME} grep --verbose echo test local
+--verbose --verbose printf printf
+	${HOME} grep readonly done sed -eu cd local $(pwd) && x=1 'quoted text'
+	done then | awk sed then
+| && 2>/dev/null $(pwd) grep && done done local cd done && awk ${HOME}
+| test printf readonly awk ${HOME} test grep --verbose
+	readonly && grep --verbose "$1" printf
+then "$1" $(pwd) --verbose done 2>/dev/null test done "$1" local
+grep "$1" export -eu echo echo /usr/bin echo --verbose /usr/bin awk
+	2>/dev/null $(pwd) /usr/bin ${HOME} &&
+cd export export ${HOME} -eu echo echo
+/usr/bin 'quoted text' then $(pwd) test | --verbose -eu $(pwd) sed grep $(pwd)
+	-eu grep then 2>/dev/null echo export
+	'quoted text' 'quoted text'
+		--verbose test $(pwd) echo "$@" sed
+| export cd "$1" "$@" readonly
+	-eu local awk grep awk local x=1 export local ${HOME} test --verbose | test "$1"
+test printf --verbose && readonly | echo
+local 'quoted text' x=1 sed sed printf
+done test readonly "$@"
+then awk "$1" sed printf export cd 'quoted text' cd "$1" "$@"
+awk sed awk x=1 ${HOME} sed
+		x=1 readonly x=1 "$@" x=1
+	done printf export -eu grep export local "$1" readonly
+local x=1 /usr/bin export "$1" done done
+	&& "$1" cd printf export printf cd echo grep export
+	x=1 then -eu && readonly | 'quoted text' grep -eu ${HOME} --verbose test
+	&& /usr/bin test && echo test $(pwd) echo x=1 echo 2>/dev/null
+awk "$1" local 'quoted text' readonly echo --verbose ${HOME}
+-eu /usr/bin local /usr/bin echo printf grep sed 2>/dev/null readonly |
+		$(pwd) test readonly printf && local 'quoted text' export test
+		-eu export /usr/bin "$@" local /usr/bin awk
+	grep local --verbose local ${HOME} local then 'quoted text' $(pwd) --verbose
+	then export awk --verbose "$1" local
+	2>/dev/null sed ${HOME} cd local 'quoted text' 'quoted text'
+		"$1" "$1" && then /usr/bin awk
+	-eu && ${HOME} -eu ${HOME} ${HOME} "$@" "$@" ${HOME} done /usr/bin "$1"
+	'quoted text' sed x=1 printf awk $(pwd) -eu ${HOME}
+	${HOME} x=1 export cd 2>/dev/null -eu grep x=1 sed
+		x=1 done | "$@" done echo done 2>/dev/null printf export | local done local
+		--verbose /usr/bin sed 'quoted text'
+	local printf 'quoted text' 2>/dev/null
+		x=1 --verbose && && local done "$1"
+	done grep "$1" ${HOME} test awk 'quoted text' test done
+	x=1 printf /usr/bin x=1 && 'quoted text' sed -eu $(pwd) cd --verbose x=1 "$@"
+	&& test grep && -eu printf sed ${HOME} "$@" cd "$1"
+| "$1" export x=1 /usr/bin "$@" local /usr/bin
+	${HOME} readonly 2>/dev/null cd ${HOME} /usr/bin
+		cd awk grep then | echo --verbose 'quoted text' test grep readonly /usr/bin export
+local --verbose export x=1 grep | awk $(pwd) |
+	done printf sed sed x=1 'quoted text'
+		sed readonly readonly export readonly $(pwd) 2>/dev/null printf && --verbose
+		local local 'quoted text' | then export -eu echo x=1 grep "$@"
+| then "$@" 'quoted text' printf | -eu sed export 2>/dev/null --verbose
+	done $(pwd) then test local echo --verbose export echo export test
+		export export grep /usr/bin
+$(pwd) local done 'quoted text'
+-eu 2>/dev/null && && 'quoted text' grep then && && ${HOME} "$1" --verbose
+	| printf | echo --verbose
+		sed echo then "$@" awk | /usr/bin $(pwd) -eu echo
+		--verbose 'quoted text' 'quoted text' &&
+	export && done && readonly sed
+		printf export sed | x=1
+	printf $(pwd) echo cd --verbose readonly --verbose && 'quoted text' then
+"$1" && -eu 2>/dev/null && printf test cd cd test sed then 'quoted text'
+--verbose /usr/bin awk echo awk readonly test grep
+		${HOME} local "$@" done 2>/dev/null /usr/bin export 2>/dev/null local
+	"$@" 'quoted text' local --verbose 2>/dev/null export 'quoted text'
+	cd grep sed readonly grep readonly
+done ${HOME} && echo "$@"
+		&& printf awk echo done | grep | --verbose cd
+export grep ${HOME} ${HOME} "$@" grep 2>/dev/null 'quoted text'
+		"$1" /usr/bin && echo printf readonly export sed local
+$(pwd) 2>/dev/null "$@" export echo
+	'quoted text' && -eu x=1
+&& grep printf cd echo "$1" export printf export echo /usr/bin
+echo readonly done readonly 2>/dev/null | test done
+	-eu local 'quoted text' then printf "$@"
+	-eu $(pwd) "$1" readonly printf
+	test printf "$1" | printf $(pwd) "$@"
+		local 2>/dev/null x=1 readonly $(pwd) /usr/bin cd | cd sed sed
+	local sed -eu --verbose cd printf grep local echo && 'quoted text' 2>/dev/null
+done export cd | grep x=1 ${HOME} "$1" $(pwd) | /usr/bin awk echo
+	printf test readonly then ${HOME} then 'quoted text' $(pwd) export $(pwd)
+x=1 2>/dev/null printf printf grep local
+echo "$@" $(pwd) 2>/dev/null
+	cd readonly 2>/dev/null -eu grep && x=1 && local readonly
+${HOME} cd done "$@" awk readonly && "$1" printf awk "$@" && printf echo /usr/bin
+awk awk /usr/bin export 2>/dev/null -eu printf sed "$@" && 2>/dev/null
+	cd test x=1 'quoted text' /usr/bin
+		${HOME} 'quoted text' local
+	echo test -eu cd export echo /usr/bin -eu local then grep 2>/dev/null
+| 'quoted text' $(pwd) printf 2>/dev/null -eu x=1 grep local "$@" local echo
+	local sed | grep 'quoted text' --verbose grep /usr/bin sed local x=1 echo
+	--verbose "$@" --verbose printf "$1" "$@" echo export "$1" 'quoted text'
+	local echo cd /usr/bin -eu --verbose 'quoted text' && sed export --verbose echo
+		grep "$@" awk "$1" x=1 readonly 2>/dev/null printf
+		x=1 "$@" /usr/bin readonly done 2>/dev/null local grep test echo $(pwd)
+2>/dev/null grep /usr/bin -eu "$1" --verbose done "$1" printf readonly /usr/bin
+		x=1 --verbose done "$1" | && | then
+sed $(pwd) x=1 x=1 "$1" --verbose done grep sed awk -eu readonly
+		${HOME} cd export printf "$1" done local "$1" | printf && done
+	--verbose awk test ${HOME} "$1" /usr/bin
+${HOME} awk "$1" export $(pwd) 'quoted text' 2>/dev/null 2>/dev/null
+		--verbose echo then awk | | awk
+		/usr/bin readonly x=1 -eu ${HOME}
+	printf grep "$@" sed echo readonly echo echo $(pwd) x=1 test local
+		2>/dev/null /usr/bin then
+		"$@" test then printf /usr/bin sed x=1
+	cd /usr/bin sed printf "$@" /usr/bin | | 2>/dev/null "$@" echo sed "$@" done
+	then && 'quoted text' ${HOME} && export local test awk &&
+		sed $(pwd) x=1 done && "$1" ${HOME} printf done done "$@"
+		'quoted text' printf local cd | export x=1 ${HOME} --verbose 'quoted text' --verbose
+export done "$1" cd && /usr/bin export
+		$(pwd) cd then test printf 2>/dev/null echo "$1" awk x=1 2>/dev/null "$1"
+		'quoted text' -eu --verbose grep awk echo ${HOME} export "$@" ${HOME}
+cd "$1" "$1" done local test -eu $(pwd) sed readonly 2>/dev/null x=1 'quoted text'
+done cd cd | sed && -eu grep
+then /usr/bin /usr/bin echo
+--verbose | -eu $(pwd) readonly 2>/dev/null
+		| x=1 /usr/bin local done x=1 /usr/bin then local
+local grep x=1 echo grep -eu
+		--verbose && readonly cd && --verbose export
+	/usr/bin --verbose && -eu grep printf done test "$1"
+	then done test 2>/dev/null $(pwd) --verbose 'quoted text' 'quoted text' local &&
+		test test printf x=1 test ${HOME} | test sed 2>/dev/null
+done 2>/dev/null grep then && && -eu printf 'quoted text'
+2>/dev/null cd echo awk | cd ${HOME}
+		grep test 2>/dev/null "$1" x=1 test done && -eu x=1 'quoted text'
+done awk 'quoted text' done $(pwd) -eu $(pwd) grep /usr/bin --verbose | local then
+awk local $(pwd) sed export 'quoted text' x=1 sed done --verbose awk readonly
+	2>/dev/null local then echo $(pwd) x=1 done "$1" | export test done test
+		test awk --verbose test 'quoted text'
+echo x=1 printf echo
+		${HOME} --verbose readonly -eu "$@" --verbose then
+	printf -eu grep awk -eu printf
+grep $(pwd) grep 'quoted text' echo
+sed then local && sed grep "$@" readonly readonly
+	printf ${HOME} echo export sed echo x=1 x=1 | | 'quoted text' test test export
+	--verbose | "$1" awk printf echo --verbose 2>/dev/null
+cd && echo "$@" done
+		cd echo 2>/dev/null ${HOME} test awk $(pwd) export echo "$1" grep 2>/dev/null awk
+		2>/dev/null echo local x=1 sed x=1 test then awk
+readonly x=1 -eu grep x=1
+	--verbose ${HOME} test printf echo -eu awk 'quoted text' echo readonly done 'quoted text'
+	printf && "$@" "$1" 'quoted text' sed --verbose
+	echo done && 2>/dev/null awk printf sed awk ${HOME} && awk --verbose
+awk printf 2>/dev/null printf 2>/dev/null | ${HOME} echo --verbose $(pwd) printf
+echo cd ${HOME} cd -eu awk printf "$@"
+	-eu export ${HOME} cd | && x=1 sed readonly
+	local 'quoted text' awk local export echo export
+	/usr/bin done x=1 awk 'quoted text'
+	2>/dev/null ${HOME} then local 2>/dev/null /usr/bin 2>/dev/null
+cd readonly then printf export export x=1 test --verbose "$@" 'quoted text'
+		awk ${HOME} x=1 "$@" x=1 awk done local test -eu -eu sed
+		awk 'quoted text' export x=1 | export awk &&
+	readonly grep 2>/dev/null echo "$@" export readonly ${HOME}
+		then "$@" "$@" readonly test
+		test && export export cd awk "$1" "$1" --verbose $(pwd)
+	"$1" sed /usr/bin printf /usr/bin printf sed sed sed grep
+	printf sed awk export /usr/bin ${HOME} x=1 sed 'quoted text' awk printf
+	"$1" -eu done awk local cd done printf
+echo "$1" "$1" echo "$@" --verbose && 'quoted text'
+--verbose "$@" x=1 local local 2>/dev/null local
+	"$1" local | done x=1 grep printf /usr/bin && "$1" 2>/dev/null -eu x=1 printf
+		2>/dev/null 'quoted text' test local
+	cd printf "$1" grep "$@"
+	-eu grep local "$@" -eu ${HOME} x=1 'quoted text' echo && test
+	test 'quoted text' done
+"$@" "$1" done ${HOME} printf test local cd cd 'quoted text'
+	${HOME} done awk export then awk "$@" x=1 readonly --verbose ${HOME}
+	-eu test local awk printf && sed done $(pwd) x=1 cd echo echo && printf
+		"$@" export then x=1 test printf
+	cd local "$1" local awk "$1" x=1 then awk /usr/bin -eu "$1" readonly ${HOME} cd
+		/usr/bin /usr/bin test printf grep cd local 'quoted text' --verbose
+/usr/bin "$@" printf cd cd echo -eu then x=1 cd sed
+		'quoted text' grep test 'quoted text' | test readonly
+printf ${HOME} readonly echo printf x=1 x=1 sed local
+		test cd "$@" local | ${HOME} -eu 'quoted text' "$@"
+		| /usr/bin local then "$@" /usr/bin | && grep $(pwd) $(pwd)
+	local awk | "$@" cd then then x=1 2>/dev/null 2>/dev/null x=1 echo test
+		grep 'quoted text' test printf 2>/dev/null x=1 test local readonly && local /usr/bin
+		"$1" "$1" readonly "$1" local x=1 'quoted text' sed echo -eu test
+		readonly && awk awk echo && --verbose 2>/dev/null cd done /usr/bin printf -eu
+		2>/dev/null | grep x=1 printf local echo test 'quoted text' -eu
+| -eu export then && "$@" x=1 "$@" -eu local "$1" --verbose "$1"
+test test -eu test then echo done echo /usr/bin && 2>/dev/null | readonly done
+		x=1 2>/dev/null local "$@" readonly sed ${HOME}
+		grep ${HOME} 2>/dev/null $(pwd) $(pwd) sed $(pwd) --verbose readonly
+		awk 'quoted text' /usr/bin && && done --verbose sed printf --verbose
+	$(pwd) && local grep /usr/bin 2>/dev/null
+		printf test "$1" readonly
+		/usr/bin x=1 -eu done then
+	then then printf cd "$@" done awk /usr/bin $(pwd) | printf
+done "$@" -eu ${HOME} grep awk local
+		awk && ${HOME} cd echo done ${HOME} sed 'quoted text' /usr/bin
+	-eu printf --verbose x=1 "$@" 'quoted text' awk 'quoted text'
+		2>/dev/null ${HOME} 2>/dev/null test --verbose 2>/dev/null cd test sed
+	done -eu -eu && awk local "$@" 2>/dev/null grep
+		'quoted text' readonly x=1 then echo "$@" | test local ${HOME} then echo
+	test 2>/dev/null awk 'quoted text' "$1" | 2>/dev/null ${HOME} ${HOME} grep
+		'quoted text' && awk awk 'quoted text' -eu 2>/dev/null
+done awk x=1 cd $(pwd) export "$@" export && done awk export export
+	test -eu printf awk "$@" ${HOME} awk $(pwd) "$@" cd
+	-eu test printf then readonly done --verbose export done --verbose
+--verbose 2>/dev/null 'quoted text'
+	cd -eu "$@" cd local grep cd done awk printf && awk -eu readonly readonly
+printf export $(pwd) then grep awk /usr/bin
+	sed export x=1 local sed 2>/dev/null printf
+		export && awk 'quoted text' local ${HOME} /usr/bin readonly
+		--verbose "$@" printf | cd "$1" "$@" $(pwd) "$@" cd then
+		local printf then cd "$@" /usr/bin
+	'quoted text' | export --verbose local then then done printf -eu
+	"$@" echo local local printf test
+then sed $(pwd) ${HOME} local | grep && printf sed cd
+		awk test test printf --verbose --verbose $(pwd) $(pwd)
+		-eu echo done "$@" /usr/bin cd awk grep local 'quoted text'
+readonly local -eu 'quoted text' echo $(pwd)
+	2>/dev/null echo --verbose 2>/dev/null
+	export | x=1 sed export test
+&& ${HOME} grep | cd grep --verbose sed awk cd -eu 'quoted text' --verbose
+		echo ${HOME} readonly test export grep 2>/dev/null 2>/dev/null 2>/dev/null
+	'quoted text' grep --verbose then export ${HOME} /usr/bin export
+		echo --verbose grep readonly then local --verbose "$@" done "$1" && "$@"
+export --verbose "$@" -eu && grep
+	sed "$@" -eu --verbose && --verbose
+local awk readonly echo --verbose --verbose "$1" "$@" test export
+		-eu printf test -eu "$1" -eu 'quoted text' sed -eu done x=1 export
+	done | local "$1" test test grep
+		&& "$@" export | done ${HOME} readonly
+	${HOME} "$@" cd awk sed $(pwd) --verbose --verbose awk ${HOME} echo readonly
+then sed sed local then "$@" grep ${HOME}
+cd then test done readonly cd test "$1"
+	"$@" local 'quoted text' $(pwd) awk $(pwd)
+		printf grep && /usr/bin awk | grep done then -eu ${HOME}
+--verbose sed local printf then grep printf "$1" "$1" 2>/dev/null
+	grep printf sed "$@" $(pwd) sed export ${HOME} echo readonly echo --verbose /usr/bin
+"$1" x=1 then "$@" 'quoted text' printf "$@" 'quoted text'
+'quoted text' done then then "$1" $(pwd) done | -eu | then then test --verbose local
+		awk /usr/bin "$1" cd done done done export readonly then
+	awk export x=1 "$@" export done && x=1 local /usr/bin | readonly | done
+cd -eu export x=1 "$1" "$1" "$@" $(pwd)
+	$(pwd) "$1" awk export ${HOME} echo ${HOME} && printf x=1 awk
+then local sed -eu readonly
+		"$1" --verbose /usr/bin awk echo "$1" grep cd local
+		&& "$@" then 'quoted text' readonly -eu sed /usr/bin export "$@" /usr/bin export
+	awk awk /usr/bin $(pwd) "$@"
+	/usr/bin cd ${HOME} | -eu | /usr/bin $(pwd) test test awk ${HOME} "$@" 2>/dev/null
+		printf test grep /usr/bin cd echo readonly "$1" ${HOME}
+		x=1 grep awk "$@" echo && --verbose grep 2>/dev/null x=1 local
+	cd x=1 done grep 'quoted text' export cd
+	then x=1 grep $(pwd) /usr/bin echo x=1 "$@" done "$@" test ${HOME}
+2>/dev/null | echo "$1" && && cd | printf 'quoted text' ${HOME}
+		/usr/bin --verbose printf /usr/bin test /usr/bin /usr/bin
+grep 'quoted text' "$@" "$@" "$1" "$@" printf readonly 2>/dev/null 'quoted text'
+grep $(pwd) echo $(pwd) done then x=1 printf local printf readonly sed
+done 2>/dev/null 'quoted text'
+		local | x=1 then cd sed "$1" sed "$@"
+test "$1" sed --verbose readonly grep "$1" cd printf -eu test awk
+		"$1" 'quoted text' sed
+	readonly -eu 2>/dev/null "$1" awk 2>/dev/null
+		-eu "$@" awk then grep done echo | done cd then export then x=1
+x=1 echo test cd --verbose export
+	2>/dev/null /usr/bin ${HOME} grep awk grep readonly /usr/bin
+	'quoted text' /usr/bin x=1 --verbose && echo | readonly "$@" cd readonly
+--verbose && awk echo "$1" readonly 'quoted text'
+| /usr/bin ${HOME} "$1" "$@" sed awk && | sed test echo test done sed grep then
+	readonly printf grep grep /usr/bin then 2>/dev/null "$@" test
+		awk ${HOME} $(pwd) | grep local $(pwd) --verbose && --verbose /usr/bin sed && &&
+	'quoted text' printf | printf export -eu 'quoted text' test
+		grep export | "$@" readonly cd grep --verbose && awk
+test "$@" test export | 2>/dev/null "$1" local --verbose
+		-eu test "$1" printf local export
+2>/dev/null readonly test then x=1 && done cd -eu "$@" grep 2>/dev/null 2>/dev/null
+		test done grep 2>/dev/null cd test /usr/bin local local "$1" awk readonly
+		export grep local readonly
+printf cd $(pwd) readonly --verbose readonly $(pwd)
+sed && done cd "$1" printf export printf | "$1" awk --verbose
+"$@" export readonly echo readonly
+	"$1" printf then /usr/bin | /usr/bin export cd then cd
+		grep grep readonly test "$@" ${HOME} /usr/bin readonly readonly sed done
+2>/dev/null echo echo sed "$@" cd --verbose readonly "$@" --verbose
+		| local && | grep echo | $(pwd) -eu cd x=1 echo && then $(pwd)
+echo then 2>/dev/null test
+export 'quoted text' --verbose x=1 done test printf awk echo x=1 -eu &&
+echo /usr/bin | /usr/bin local awk awk 'quoted text'
+	"$1" 'quoted text' sed "$1" ${HOME} awk printf --verbose && grep readonly
+	done export grep "$@" $(pwd) then ${HOME} -eu
+| "$@" readonly echo $(pwd) then readonly x=1 grep "$@" done
+$(pwd) "$1" grep --verbose test | "$@" local test "$1" | -eu --verbose
+		readonly then then readonly | readonly "$1" test "$1" grep cd --verbose
+	| 'quoted text' done export /usr/bin
+		local && then "$1" | cd -eu printf printf
+		--verbose readonly "$1" sed | "$1" cd x=1 -eu sed grep "$1" sed grep 'quoted text'
+done $(pwd) grep /usr/bin then sed 'quoted text'
+test echo local awk cd grep
+	--verbose 2>/dev/null export awk | ${HOME} --verbose "$@" done
+		grep cd 2>/dev/null local -eu $(pwd) 2>/dev/null
+		awk readonly /usr/bin local done then
+		2>/dev/null sed 'quoted text' test export 2>/dev/null
+	local then export | local /usr/bin grep grep echo && test printf grep done test
+	-eu cd readonly then printf then done ${HOME} | ${HOME} $(pwd)
+		sed && done 'quoted text' && done cd sed /usr/bin 2>/dev/null
+		cd && then --verbose grep | $(pwd) then
+export test done readonly --verbose cd && && "$@" local "$1"
+	done 'quoted text' readonly | sed done ${HOME} export readonly
+	| 2>/dev/null | 2>/dev/null readonly readonly local cd
+		${HOME} grep then "$@" awk awk && ${HOME} cd | "$@" && sed -eu
+		"$1" 2>/dev/null -eu then grep grep 'quoted text' cd | 'quoted text' "$@"
+readonly --verbose "$1" "$@" cd echo
+	| | test "$1" -eu | /usr/bin cd --verbose "$1" x=1
+		readonly local grep readonly sed "$1" ${HOME} $(pwd) "$@" done -eu grep
+	printf -eu local test test x=1 $(pwd) grep printf
+		echo --verbose 2>/dev/null "$@" ${HOME} cd "$1" grep export 2>/dev/null
+echo "$1" 2>/dev/null cd 'quoted text'
+		local "$1" local awk $(pwd) then 2>/dev/null
+"$@" && done sed export
+printf local then then x=1 printf
+		2>/dev/null -eu | export 'quoted text'
+	cd test 'quoted text' --verbose "$1" sed && "$@"
+		"$@" -eu done cd readonly x=1 readonly | printf printf
+'quoted text' /usr/bin "$@" "$@" readonly
+	awk readonly ${HOME} -eu x=1 awk done export $(pwd) $(pwd)
+		test | "$@" -eu local -eu -eu readonly grep 2>/dev/null
+x=1 "$1" --verbose done then echo cd $(pwd) "$@" "$1" $(pwd)
+	| awk printf done done /usr/bin echo printf ${HOME} echo printf -eu done
+	"$@" $(pwd) "$@" $(pwd) 2>/dev/null readonly test $(pwd)
+/usr/bin "$@" readonly $(pwd) awk local cd printf &&
+		cd "$@" -eu "$@" "$@" echo --verbose
+	cd $(pwd) done $(pwd) "$@" ${HOME} x=1 | cd sed -eu -eu printf grep 2>/dev/null
+	"$@" echo -eu && printf "$1" readonly /usr/bin /usr/bin sed && export local
+		2>/dev/null local done "$@" 2>/dev/null "$1" grep local
+		then "$1" x=1 --verbose "$1" done && then 'quoted text' /usr/bin ${HOME}
+		export sed sed done local
+	-eu sed && ${HOME} && awk | grep export then -eu readonly cd --verbose
+		x=1 local 'quoted text' 2>/dev/null 2>/dev/null test x=1 awk
+		done $(pwd) export local && x=1 && ${HOME} awk --verbose readonly x=1 echo 2>/dev/null
+		sed readonly echo readonly echo local ${HOME}
+	&& grep && cd then $(pwd) local x=1 cd 'quoted text'
+		2>/dev/null readonly echo awk -eu
+	&& then 'quoted text' "$@" printf
+	"$@" sed && echo then x=1 && $(pwd) local grep done --verbose
+		test "$@" -eu x=1 -eu "$@" sed awk --verbose 'quoted text' export
+	2>/dev/null && && --verbose
+	| x=1 $(pwd) 2>/dev/null /usr/bin "$@" x=1 awk $(pwd) export -eu sed
+	cd x=1 ${HOME} sed done --verbose printf printf 'quoted text' -eu cd
+	printf echo 'quoted text' echo
+	-eu x=1 2>/dev/null $(pwd) 2>/dev/null readonly | export
+--verbose done awk "$1" local cd test "$@"
+readonly local x=1 done cd then grep x=1
+$(pwd) ${HOME} $(pwd) readonly sed export export printf -eu awk
+/usr/bin test grep -eu x=1 x=1 export 'quoted text' readonly && x=1 $(pwd) "$1"
+$(pwd) then printf then readonly
+local grep "$@" test | --verbose done then -eu 2>/dev/null sed
+		echo /usr/bin sed awk /usr/bin /usr/bin -eu grep ${HOME}
+		export export readonly -eu
+	done "$1" $(pwd) | test x=1 sed printf 2>/dev/null "$1" "$@"
+		'quoted text' "$@" printf grep awk test $(pwd)
+		${HOME} then "$@" x=1 test export 2>/dev/null then echo local
+awk /usr/bin grep 2>/dev/null -eu x=1 then -eu cd grep
+"$1" printf sed /usr/bin printf
+		then "$@" test readonly grep $(pwd) readonly /usr/bin
+"$1" 2>/dev/null local -eu cd 2>/dev/null
+readonly local "$1" export
+done x=1 && grep printf printf printf cd export readonly
+		2>/dev/null "$1" "$1" 'quoted text'
+$(pwd) printf echo "$1" local printf "$@" sed readonly x=1
+		${HOME} cd "$1" local -eu readonly x=1 -eu | x=1 export "$@" cd
+	readonly && 'quoted text'
+	"$1" --verbose ${HOME} echo echo "$@" "$@"
+		${HOME} done $(pwd) export readonly 'quoted text' awk readonly 'quoted text'
+		"$1" readonly readonly local
+	then export && ${HOME} test /usr/bin /usr/bin
+test /usr/bin 'quoted text' grep local printf echo --verbose
+		sed then 'quoted text' then export awk then
+		'quoted text' -eu /usr/bin /usr/bin
+	grep then x=1 test /usr/bin $(pwd) awk && "$@" 2>/dev/null test ${HOME}
+-eu x=1 'quoted text' done $(pwd) "$1" cd grep
+then 2>/dev/null | test done 'quoted text' then
+		"$@" export /usr/bin local --verbose 2>/dev/null readonly
+	export sed 2>/dev/null 2>/dev/null local -eu awk then 'quoted text'
+	readonly -eu | /usr/bin readonly test "$@" 'quoted text'
+	local 'quoted text' local awk && sed echo sed cd grep $(pwd) /usr/bin
+	readonly --verbose then $(pwd) sed && /usr/bin sed --verbose "$@" echo grep
+		&& echo "$@" printf ${HOME} sed done grep local echo x=1 --verbose export
+grep | local | local test export test "$1" sed sed printf echo /usr/bin
+	x=1 2>/dev/null test readonly printf sed test $(pwd) "$1" cd cd
+	$(pwd) export test test x=1 awk "$@" grep local | $(pwd)
+		| "$@" printf --verbose printf "$1" && test
+	2>/dev/null readonly local export test /usr/bin sed ${HOME} printf
+	/usr/bin "$@" done 2>/dev/null
+		"$@" cd /usr/bin ${HOME} export "$@"
+	x=1 test 'quoted text' -eu then export ${HOME}
+		&& x=1 then && done printf ${HOME} sed "$@"
+		sed $(pwd) done 2>/dev/null
+		awk && printf "$1" /usr/bin
+	local ${HOME} done 'quoted text' 'quoted text' grep awk local export
+&& ${HOME} done test 'quoted text' readonly 'quoted text' "$@" echo ${HOME}
+	local awk printf done awk --verbose && 2>/dev/null
+		x=1 test done done awk export
+		2>/dev/null -eu | ${HOME} done test && local echo /usr/bin then local then
+	2>/dev/null then awk printf awk
+		done "$1" /usr/bin awk echo printf readonly 'quoted text' $(pwd)
+	cd x=1 export grep then 'quoted text'
+test printf 2>/dev/null local -eu 'quoted text'
+	printf printf export awk echo
+$(pwd) echo test x=1 sed "$@" grep /usr/bin 2>/dev/null 'quoted text'
+/usr/bin /usr/bin /usr/bin x=1 $(pwd) $(pwd) awk then 2>/dev/null
+		--verbose && echo grep local local grep awk test x=1
+		-eu | "$@" && done | 'quoted text' awk x=1 awk /usr/bin "$@" x=1
+"$1" "$@" test x=1 "$1" x=1 'quoted text' | | grep x=1
+		2>/dev/null readonly awk --verbose
+	local x=1 --verbose export printf test local cd readonly
+then ${HOME} grep awk test done local printf local then awk sed --verbose
+		${HOME} awk 'quoted text' test awk /usr/bin
+		then --verbose test test ${HOME} $(pwd) printf cd then test cd "$@"
+${HOME} echo 'quoted text' && -eu --verbose cd -eu then "$1" local grep
+	test $(pwd) done --verbose
+--verbose -eu sed 2>/dev/null grep done done cd readonly && export 2>/dev/null
+		local printf 'quoted text' export echo echo echo then $(pwd) "$1" "$1" "$@" sed
+$(pwd) 2>/dev/null --verbose printf
+		test printf && | 'quoted text' ${HOME} -eu | "$@" printf export done awk 2>/dev/null
+	awk 2>/dev/null echo done $(pwd) "$@" 2>/dev/null readonly grep local
+-eu local ${HOME} "$1" $(pwd) --verbose done | readonly cd | 2>/dev/null grep
+${HOME} 'quoted text' echo readonly printf && sed 'quoted text' "$1" sed
+	"$@" x=1 readonly "$@" then grep sed
+sed echo echo /usr/bin readonly -eu | test -eu local
+awk printf $(pwd) | printf printf test
+	test echo readonly "$@" echo ${HOME} cd --verbose /usr/bin
+"$@" 'quoted text' export printf
+		2>/dev/null 'quoted text' sed --verbose sed test done && $(pwd) ${HOME} local
+		sed --verbose test echo cd awk "$1" "$1" sed /usr/bin
+test export | grep done && grep printf
+	${HOME} && readonly "$1"
+		readonly ${HOME} /usr/bin awk then
+		printf && && /usr/bin sed export
+	printf echo "$@" test --verbose export "$1" local ${HOME} echo -eu $(pwd) "$@"
+	&& && sed ${HOME} 'quoted text' export sed |
+		sed awk local "$1" done -eu cd
+		cd ${HOME} cd grep 2>/dev/null test --verbose local && | |
+echo /usr/bin test local "$@" -eu local awk
+&& "$1" /usr/bin "$@" printf readonly
+	x=1 "$1" export --verbose test 'quoted text' test 'quoted text' $(pwd) /usr/bin
+		2>/dev/null then /usr/bin test printf ${HOME} done
+		cd export printf printf x=1 "$1" 2>/dev/null
+		printf done test done readonly then && /usr/bin $(pwd) sed /usr/bin awk ${HOME}
+x=1 "$@" --verbose --verbose $(pwd) 'quoted text'
+"$@" test sed -eu printf local local cd -eu --verbose grep sed 2>/dev/null
+	local "$@" x=1 export 2>/dev/null
+	&& awk done printf ${HOME}
+"$@" -eu cd then readonly local | "$@" 2>/dev/null -eu
+		export awk export -eu echo awk export "$@" "$1" "$@" export printf 'quoted text'
+x=1 2>/dev/null printf --verbose
+test readonly awk test printf awk
+-eu "$1" local "$1" grep printf
+	cd --verbose x=1 done && x=1 test then readonly readonly awk then test
+	grep sed export -eu && done then $(pwd)
+		&& x=1 -eu done "$@" local printf /usr/bin 'quoted text' && export readonly
+	--verbose echo $(pwd) cd ${HOME} x=1 export 'quoted text' done
+		-eu export sed readonly && ${HOME} x=1 export "$@" echo export | printf | echo
+	done test export test "$@" | echo ${HOME} -eu -eu awk export local 2>/dev/null
+	sed $(pwd) readonly 2>/dev/null /usr/bin then | test 2>/dev/null "$1" |
+		grep 2>/dev/null "$@" | echo then readonly /usr/bin
+		test 'quoted text' /usr/bin awk "$@" 2>/dev/null
+		export sed | && grep sed printf | --verbose awk ${HOME} -eu readonly "$1" 'quoted text'
+		local --verbose | --verbose "$@" -eu && $(pwd)
+		sed x=1 echo --verbose awk test test | && --verbose
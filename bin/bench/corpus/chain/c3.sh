@@ -0,0 +1,2001 @@
+		'quoted text' done grep printf -eu
+	-eu --verbose 2>/dev/null export --verbose readonly "$1" readonly "$1" 'quoted text'
+	-eu && 'quoted text' | cd readonly cd done readonly then
+	/usr/bin 2>/dev/null x=1
+printf $(pwd) local awk cd local sed 2>/dev/null grep 2>/dev/null
+		| | && then /usr/bin local grep -eu --verbose local export $(pwd) -eu |
+	awk awk ${HOME} $(pwd) --verbose "$@" readonly cd printf ${HOME}
+	test cd ${HOME} done $(pwd) && test
+cd /usr/bin export test grep --verbose "$@"
+		done $(pwd) 2>/dev/null $(pwd) echo | $(pwd) | --verbose /usr/bin cd ${HOME}
+		grep local export grep test local test
+local grep sed | printf $(pwd) then "$1" grep sed grep --verbose
+		awk test grep readonly grep
+		cd export | x=1 --verbose echo "$1" /usr/bin sed awk
+		-eu awk -eu --verbose && $(pwd) export --verbose -eu sed then then grep
+	readonly export cd local "$1" x=1 $(pwd) --verbose
+	printf x=1 "$@" cd readonly -eu export then --verbose echo x=1 done
+x=1 --verbose grep "$@" local sed
+test printf sed printf printf ${HOME} 2>/dev/null echo grep
+	-eu 'quoted text' 2>/dev/null x=1 && grep then --verbose "$1" awk done readonly
+	$(pwd) | | sed | -eu | printf grep test | then 2>/dev/null
+		--verbose /usr/bin 'quoted text'
+	local printf -eu awk 2>/dev/null x=1 local $(pwd) $(pwd) test
+| | then cd ${HOME} done printf export | done local
+| then awk printf | 'quoted text' && printf "$1" "$1" "$@"
+	x=1 x=1 awk grep cd /usr/bin ${HOME} "$1"
+		2>/dev/null then done cd /usr/bin
+	grep $(pwd) test --verbose | --verbose cd --verbose /usr/bin cd cd 2>/dev/null
+grep sed --verbose 2>/dev/null x=1 cd /usr/bin $(pwd) $(pwd) /usr/bin
+		"$@" cd printf $(pwd) 'quoted text'
+		done export 2>/dev/null sed "$@" x=1 test --verbose readonly /usr/bin done export
+local | && x=1 sed "$1" grep x=1 -eu echo "$@" cd sed ${HOME} $(pwd) --verbose
+	local readonly 'quoted text' 'quoted text' echo grep | done -eu
+	echo $(pwd) export $(pwd) -eu
+		-eu sed cd 'quoted text' awk "$@" --verbose 2>/dev/null export 'quoted text'
+"$@" && && grep done /usr/bin readonly
+		test 'quoted text' 'quoted text' /usr/bin
+		printf 'quoted text' $(pwd) sed "$1" 'quoted text'
+then x=1 grep grep cd awk --verbose export
+test /usr/bin grep 'quoted text' -eu "$@" $(pwd)
+	export grep awk cd test -eu local
+| x=1 awk --verbose echo x=1 --verbose ${HOME}
+		x=1 --verbose --verbose
+		"$@" printf cd done -eu "$1" | export /usr/bin --verbose | test | done x=1
+awk --verbose /usr/bin done cd local $(pwd) done test echo echo
+		'quoted text' local then
+	"$1" 'quoted text' echo local
+		cd ${HOME} export 'quoted text' /usr/bin $(pwd) echo cd then "$1"
+	-eu x=1 /usr/bin printf then 'quoted text' cd x=1 'quoted text' ${HOME} | 2>/dev/null
+cd -eu | ${HOME} sed printf
+then 2>/dev/null ${HOME} 'quoted text' /usr/bin
+cd done $(pwd) -eu then export "$1" readonly
+	awk | local awk cd done awk echo export then cd grep "$@" cd x=1 2>/dev/null
+		local grep then then x=1 -eu | then export "$1"
+		readonly -eu ${HOME} awk --verbose printf echo test awk && -eu done cd /usr/bin
+		"$1" ${HOME} sed printf printf 2>/dev/null
+sed $(pwd) && readonly awk $(pwd) && /usr/bin x=1
+		| local && 'quoted text' local sed cd test grep cd cd
+	${HOME} done | /usr/bin 2>/dev/null export | && cd /usr/bin then x=1
+	x=1 printf local test $(pwd) | cd x=1 $(pwd) && 'quoted text'
+	| then ${HOME} --verbose --verbose test printf
+		test grep "$1" sed 'quoted text' done $(pwd)
+-eu --verbose "$@" 2>/dev/null done grep /usr/bin | local test local
+	'quoted text' test ${HOME} export 2>/dev/null then | awk awk grep echo 'quoted text'
+done x=1 "$@" $(pwd) sed x=1 then
+"$1" x=1 --verbose 2>/dev/null printf then printf
+		"$1" "$1" then sed "$1" test /usr/bin
+		sed x=1 --verbose x=1 && readonly done &&
+export /usr/bin sed sed
+	2>/dev/null "$1" && $(pwd) | -eu x=1 printf local cd /usr/bin $(pwd) printf
+		${HOME} x=1 "$@" 2>/dev/null test "$@" awk test /usr/bin | done "$1"
+test cd cd sed printf -eu grep ${HOME} -eu && grep printf --verbose done "$1"
+		"$@" then | cd ${HOME} "$@"
+		"$@" then 2>/dev/null /usr/bin x=1 'quoted text' readonly $(pwd) --verbose done
+"$1" | $(pwd) local export echo /usr/bin
+	cd ${HOME} "$@" done done "$@" export then printf cd "$1" test
+	done echo && then awk awk "$@" x=1 /usr/bin
+	test $(pwd) && test 2>/dev/null cd test /usr/bin && awk --verbose export && "$1"
+export $(pwd) 2>/dev/null
+	cd done -eu -eu && -eu readonly export && "$1" local
+		done 'quoted text' sed | test $(pwd)
+	cd echo -eu export ${HOME} then x=1 printf printf echo then printf
+	printf awk sed export 2>/dev/null then export cd /usr/bin 'quoted text' awk
+	-eu x=1 local export local 2>/dev/null
+then export | printf && 'quoted text' && && --verbose test test
+	${HOME} && then | x=1 done grep readonly "$1" -eu 'quoted text' x=1
+		| /usr/bin echo cd 2>/dev/null awk readonly | 'quoted text'
+	grep awk -eu | grep -eu printf "$1" then export test then
+	x=1 sed cd grep awk grep cd "$1" 2>/dev/null sed echo sed then ${HOME} readonly
+		| awk 2>/dev/null then printf --verbose "$1" "$1" | printf && ${HOME}
+		export ${HOME} done readonly --verbose x=1 -eu local | done 'quoted text'
+printf -eu -eu ${HOME} ${HOME}
+	&& readonly then 2>/dev/null done printf
+	cd export "$@" ${HOME} grep cd $(pwd) export && "$1" --verbose
+x=1 x=1 grep "$1" "$1" then test printf --verbose export
+export "$1" -eu done echo "$@" readonly
+		"$1" -eu test test ${HOME} 'quoted text' 'quoted text' -eu
+	awk readonly then grep echo done 2>/dev/null 2>/dev/null test "$1" readonly
+sed -eu printf ${HOME} test sed ${HOME} 2>/dev/null grep
+local grep $(pwd) && done printf printf -eu -eu awk awk && 2>/dev/null
+		${HOME} -eu -eu local /usr/bin
+		local export done "$1" "$1" 2>/dev/null echo
+&& && test printf readonly awk 2>/dev/null sed --verbose $(pwd) --verbose
+		"$@" echo x=1 echo 'quoted text' /usr/bin | done "$@" printf awk
+sed | 'quoted text' test x=1 awk -eu done /usr/bin done
+grep test --verbose /usr/bin x=1 "$@" | readonly
+		${HOME} --verbose awk ${HOME} x=1 printf && x=1 "$1" cd "$1" ${HOME}
+printf printf echo echo readonly x=1 local /usr/bin local "$@" then
+		done cd then -eu test --verbose | -eu grep /usr/bin
+2>/dev/null test && -eu test export
+-eu readonly ${HOME} cd sed
+	&& done && | ${HOME} test done ${HOME} x=1
+		grep grep && then --verbose --verbose && x=1 'quoted text'
+		&& done done --verbose --verbose
+test echo x=1 then cd -eu "$1" && ${HOME} echo sed echo /usr/bin && ${HOME}
+sed && then "$@" ${HOME} && x=1 "$@" x=1 && then -eu --verbose readonly done
+		"$@" readonly x=1 printf then ${HOME} printf then export sed 2>/dev/null
+		grep echo awk --verbose --verbose then grep ${HOME} cd sed -eu grep -eu
+"$1" echo && local "$@" 'quoted text' 'quoted text' then
+		export 'quoted text' "$@" -eu | test export
+		sed "$@" grep export cd -eu done then "$@"
+sed local sed /usr/bin "$@" | sed export export echo printf
+$(pwd) cd x=1 | readonly $(pwd) awk readonly $(pwd) $(pwd) 2>/dev/null
+grep grep -eu awk awk grep 2>/dev/null 'quoted text' sed printf
+	"$@" local local ${HOME} done && $(pwd) | printf then
+	$(pwd) | export awk done echo 'quoted text'
+-eu printf /usr/bin /usr/bin $(pwd)
+	export then | readonly cd export
+$(pwd) done awk x=1 echo echo && echo local sed export local echo readonly
+	'quoted text' ${HOME} then
+	then done then "$@" 'quoted text' $(pwd) local sed then cd "$@" printf
+		readonly "$1" echo sed grep $(pwd) "$@" "$1" echo export
+export ${HOME} /usr/bin then done "$@"
+echo ${HOME} done then done && x=1 done done awk
+	"$1" grep $(pwd) test echo /usr/bin "$@" then readonly "$@"
+		'quoted text' --verbose "$1" test 2>/dev/null 'quoted text' echo "$@" x=1
+		x=1 'quoted text' 'quoted text' readonly --verbose
+	readonly 'quoted text' "$1" "$@" &&
+		--verbose awk ${HOME} -eu readonly done export test $(pwd) $(pwd) readonly
+--verbose "$1" -eu awk
+	local sed local local printf readonly -eu | sed && local $(pwd) sed 2>/dev/null
+		2>/dev/null "$@" then readonly
+		"$@" echo "$1" sed awk echo export awk $(pwd)
+	echo 'quoted text' "$@" test cd printf "$1" echo sed echo x=1 echo local cd awk
+		export export done sed ${HOME} 2>/dev/null
+	${HOME} then cd -eu cd sed echo printf 'quoted text'
+	export grep echo readonly /usr/bin local
+	printf printf printf ${HOME} echo
+awk then "$1" $(pwd) 2>/dev/null "$1" readonly printf
+		test && "$@" "$1" local && then awk grep /usr/bin
+	"$1" 2>/dev/null grep then x=1 /usr/bin
+		-eu && sed echo grep echo 2>/dev/null 'quoted text' awk sed "$@"
+	awk "$1" echo cd && x=1 done
+		then printf then 'quoted text' then /usr/bin printf
+then ${HOME} echo echo 2>/dev/null "$1" export
+awk "$@" "$1" 2>/dev/null cd "$1" then /usr/bin --verbose
+-eu awk sed ${HOME} "$@"
+awk x=1 --verbose readonly then echo "$1" x=1 done cd "$1" then && /usr/bin
+		awk done && export ${HOME} $(pwd)
+&& $(pwd) /usr/bin x=1 "$@" export then local -eu then grep
+	sed echo done ${HOME} "$@" local | cd grep test
+	x=1 printf 2>/dev/null $(pwd) && $(pwd) awk sed grep awk local ${HOME} $(pwd)
+sed | "$@" "$1" awk local
+		grep test printf readonly -eu --verbose 'quoted text' export 2>/dev/null grep
+		local -eu printf readonly echo $(pwd) /usr/bin
+/usr/bin && $(pwd) printf export | 2>/dev/null --verbose sed
+		grep $(pwd) x=1 done grep test then
+		local cd cd ${HOME} done --verbose local 2>/dev/null
+	-eu --verbose x=1 ${HOME} export local export | test && "$1" -eu
+	${HOME} export | $(pwd) 'quoted text' 2>/dev/null
+	'quoted text' test grep 'quoted text' --verbose
+then done local "$@" 2>/dev/null -eu export -eu /usr/bin
+done export -eu $(pwd) ${HOME} export echo /usr/bin $(pwd)
+		done printf "$1" $(pwd) printf 2>/dev/null
+	test && -eu 'quoted text' done export sed
+		export echo test x=1 export "$1" test cd "$1" done /usr/bin printf
+"$@" -eu -eu readonly --verbose "$1" local local sed
+	2>/dev/null | ${HOME} x=1 local printf
+		2>/dev/null 2>/dev/null | $(pwd) echo --verbose local
+x=1 printf echo x=1 export
+| --verbose "$@" ${HOME} cd ${HOME} ${HOME} then local printf 2>/dev/null
+&& readonly then /usr/bin 2>/dev/null ${HOME} ${HOME} 2>/dev/null printf
+	-eu ${HOME} export 2>/dev/null readonly ${HOME} -eu sed local
+printf test --verbose 2>/dev/null local done done 2>/dev/null 'quoted text' "$@"
+	awk x=1 cd | 2>/dev/null cd done | grep sed $(pwd) "$@" local "$1"
+printf x=1 printf "$@"
+		/usr/bin test "$1" ${HOME} -eu test readonly echo grep --verbose "$@" $(pwd)
+'quoted text' x=1 printf "$1" | | "$@"
+	-eu 2>/dev/null sed x=1 "$@"
+	grep done $(pwd) $(pwd) x=1 awk && export awk readonly ${HOME} ${HOME}
+		2>/dev/null local cd "$1" 'quoted text' && | cd printf /usr/bin
+	then -eu grep 2>/dev/null cd $(pwd) then sed printf
+	${HOME} then sed $(pwd) readonly echo done awk ${HOME} "$1" --verbose
+	-eu awk $(pwd) local "$@" 'quoted text' readonly export grep x=1 echo test ${HOME}
+local sed && then "$1" 'quoted text' x=1 && /usr/bin && | 2>/dev/null /usr/bin ${HOME}
+done grep sed && $(pwd) test grep
+		'quoted text' 2>/dev/null ${HOME} ${HOME}
+awk sed 2>/dev/null $(pwd) | ${HOME} printf 'quoted text' sed 2>/dev/null
+		-eu echo test | && x=1 $(pwd) | | local export echo cd -eu
+		printf 2>/dev/null && done --verbose
+		readonly $(pwd) done then done 2>/dev/null
+	test test 'quoted text' test 2>/dev/null sed test --verbose
+		then && ${HOME} "$1" 'quoted text' local
+	sed | export readonly cd -eu sed --verbose readonly
+		cd "$1" grep $(pwd) "$@" grep awk /usr/bin &&
+		| then readonly --verbose ${HOME} /usr/bin grep export | && test
+		$(pwd) readonly ${HOME} x=1 /usr/bin
+		export then $(pwd) x=1 -eu echo
+		${HOME} sed grep cd local && awk ${HOME} -eu
+awk sed printf ${HOME} --verbose
+	grep grep --verbose printf then then readonly 'quoted text'
+	done done readonly printf sed awk "$@" then printf then echo ${HOME}
+	-eu sed ${HOME} -eu done local | printf | done
+'quoted text' && $(pwd) $(pwd) then --verbose printf test ${HOME} 2>/dev/null
+	2>/dev/null export -eu test test readonly 'quoted text' 2>/dev/null
+	test test 2>/dev/null echo awk $(pwd) 'quoted text' printf | | $(pwd) -eu
+		sed 'quoted text' echo
+	awk "$1" then printf -eu awk $(pwd) $(pwd) "$@" 'quoted text'
+2>/dev/null cd awk export awk done --verbose export export "$@"
+test | "$1" export x=1 && sed then && "$1" /usr/bin "$1" -eu
+		printf cd --verbose -eu test -eu | then 'quoted text' "$1"
+	export test 'quoted text' done "$@" | x=1 sed then && &&
+		/usr/bin cd | local local printf export test grep echo
+		cd test cd 'quoted text' "$@" /usr/bin done echo echo
+2>/dev/null && echo /usr/bin
+		x=1 | readonly $(pwd) | test x=1 echo
+		"$1" -eu done --verbose | 'quoted text' sed export --verbose
+		readonly then ${HOME} local done sed local echo export -eu readonly export
+local $(pwd) ${HOME} test awk $(pwd) echo | "$1" 'quoted text' --verbose "$1"
+	"$1" local && printf test ${HOME} local 2>/dev/null
+	"$1" test readonly cd --verbose sed printf 'quoted text'
+grep export | 2>/dev/null grep export then export grep | grep echo local readonly
+	| local | x=1 echo test -eu --verbose printf test cd grep export ${HOME}
+		then | echo -eu awk 2>/dev/null
+printf sed --verbose grep echo 2>/dev/null
+		printf grep ${HOME} 2>/dev/null done --verbose "$@" "$@" ${HOME}
+		/usr/bin local echo -eu
+		&& local readonly local done "$@" 'quoted text'
+| -eu 2>/dev/null && local --verbose | --verbose grep 'quoted text' done && cd
+cd export done /usr/bin sed && cd grep | $(pwd) -eu then echo cd ${HOME} grep $(pwd)
+echo then sed ${HOME} $(pwd) | $(pwd) ${HOME} ${HOME} test "$@" local
+	"$@" test -eu "$1" then | $(pwd)
+cd 2>/dev/null --verbose $(pwd) "$@" sed /usr/bin ${HOME} ${HOME} 2>/dev/null
+2>/dev/null awk grep "$@" done sed grep done | test grep 'quoted text'
+		"$@" grep sed "$1" $(pwd) then done
+cd awk /usr/bin "$@" | cd sed local "$@" printf test && && ${HOME} sed
+	export | --verbose sed x=1 then sed awk export echo
+awk test "$1" "$@" ${HOME} echo /usr/bin cd awk export
+		local 2>/dev/null cd ${HOME} awk "$@" export "$1" export /usr/bin export $(pwd)
+	readonly ${HOME} x=1 test done then cd /usr/bin sed "$1" echo
+	-eu 'quoted text' 'quoted text' sed 'quoted text'
+		2>/dev/null sed then "$@" export | test export
+		test "$@" test $(pwd) sed 2>/dev/null awk "$@" export local /usr/bin
+	-eu 'quoted text' test ${HOME} | | | | x=1 x=1 sed
+--verbose test grep echo echo echo grep export cd cd && x=1 x=1 export grep
+	${HOME} /usr/bin test --verbose
+	readonly sed 2>/dev/null ${HOME} sed echo cd
+		export grep ${HOME} then done "$@" then "$@" local echo
+		-eu "$@" --verbose && && export export && && export | cd
+	'quoted text' /usr/bin x=1 then test echo 2>/dev/null
+"$@" "$@" --verbose echo cd "$@" /usr/bin -eu test x=1 awk printf sed -eu --verbose
+	readonly sed export grep awk cd "$1" export --verbose
+	readonly sed awk 2>/dev/null export test &&
+	"$1" echo awk export "$1" "$1" readonly test x=1 --verbose done printf /usr/bin
+		local --verbose readonly echo -eu done && test
+	2>/dev/null -eu --verbose local $(pwd)
+	"$1" && $(pwd) ${HOME} /usr/bin export $(pwd) sed test test ${HOME} then
+	--verbose ${HOME} test
+		/usr/bin | local 2>/dev/null grep echo $(pwd) /usr/bin test then done readonly
+&& cd "$1" grep cd sed | cd --verbose test local awk readonly /usr/bin
+	-eu ${HOME} ${HOME} printf grep "$@" grep readonly "$1" readonly
+	export export "$@" ${HOME} grep 'quoted text' "$1" local ${HOME}
+		export x=1 export printf x=1 x=1 && 2>/dev/null awk echo awk done printf local
+2>/dev/null 2>/dev/null 'quoted text' | done then -eu
+x=1 | then ${HOME} sed $(pwd) readonly grep test -eu printf $(pwd)
+		done ${HOME} test done $(pwd) then --verbose 'quoted text'
+	readonly done sed 'quoted text'
+export x=1 test /usr/bin sed done $(pwd) | && printf then awk cd test $(pwd)
+		$(pwd) $(pwd) "$1" ${HOME} grep "$@" --verbose 'quoted text' "$1" local && cd 'quoted text'
+	sed sed readonly local echo $(pwd) "$@"
+	then "$1" /usr/bin printf 'quoted text'
+	sed cd | "$1" "$1" $(pwd) 'quoted text'
+		&& done -eu --verbose -eu cd --verbose export --verbose
+'quoted text' x=1 printf
+	awk test --verbose local readonly /usr/bin
+		echo x=1 cd | test "$@" | 2>/dev/null
+	$(pwd) -eu echo readonly x=1 | 'quoted text' 2>/dev/null
+	sed cd then 'quoted text' ${HOME} --verbose grep then "$@" "$1" /usr/bin done
+${HOME} grep awk grep $(pwd) done "$1" test test
+		'quoted text' | $(pwd) local echo -eu
+"$1" --verbose readonly && export echo printf export
+readonly --verbose awk --verbose
+echo $(pwd) cd | ${HOME} --verbose
+	--verbose "$1" cd /usr/bin grep export test | test -eu "$1"
+		printf done ${HOME} ${HOME} then | grep cd "$@" then && 'quoted text'
+	2>/dev/null echo local cd then "$1"
+		echo -eu $(pwd) test echo printf done -eu local --verbose readonly
+$(pwd) echo printf 'quoted text' done "$@" local 'quoted text'
+		then readonly "$1" sed readonly cd $(pwd) $(pwd) export echo /usr/bin test test
+readonly echo "$1" done readonly sed && readonly cd
+	cd | cd done echo --verbose sed -eu --verbose ${HOME} printf done export $(pwd)
+	-eu | then echo export printf --verbose sed local done echo sed
+	"$@" "$@" readonly then local
+		export then grep export
+	printf test printf readonly
+		readonly /usr/bin x=1 /usr/bin then 'quoted text' sed local
+	--verbose --verbose grep export -eu awk test --verbose
+	readonly local $(pwd) |
+		export ${HOME} cd cd grep 'quoted text' x=1 then && ${HOME} readonly printf printf
+	then done "$1" export local
+		2>/dev/null /usr/bin grep
+		2>/dev/null 2>/dev/null done local echo --verbose /usr/bin 2>/dev/null
+| "$1" ${HOME} awk "$@" /usr/bin printf "$@" export printf
+x=1 printf 2>/dev/null x=1 ${HOME} -eu readonly
+		printf "$1" readonly 'quoted text' local | ${HOME} echo awk cd 'quoted text'
+test awk export local cd && readonly
+	test --verbose cd "$@" local --verbose
+		--verbose $(pwd) | | sed && echo && cd sed -eu echo "$@" echo done printf
+		printf awk grep x=1 2>/dev/null
+		&& done test | local sed
+		$(pwd) $(pwd) echo --verbose local /usr/bin x=1 --verbose --verbose
+	sed 'quoted text' cd readonly then cd printf cd export --verbose
+	/usr/bin --verbose x=1 grep readonly printf done test
+		&& cd x=1 "$@" | "$@" readonly "$1" local "$1" $(pwd) local
+'quoted text' -eu grep x=1 local export ${HOME} done local
+	$(pwd) /usr/bin "$@" "$1" export -eu -eu sed --verbose
+	cd --verbose && $(pwd) 'quoted text' x=1 'quoted text'
+then 2>/dev/null export then grep test awk
+	| | -eu awk ${HOME} then printf 2>/dev/null echo test
+		/usr/bin ${HOME} printf sed then $(pwd) then $(pwd) ${HOME} then --verbose
+	--verbose awk /usr/bin
+	&& done /usr/bin /usr/bin "$1" awk grep sed done sed test /usr/bin
+		$(pwd) local | -eu sed local "$1" grep awk cd /usr/bin
+		then | 2>/dev/null local echo -eu /usr/bin
+	$(pwd) $(pwd) "$@" && cd | 2>/dev/null "$@" cd
+	grep then $(pwd) "$1" 'quoted text' x=1 grep 'quoted text' sed
+'quoted text' && -eu $(pwd) printf -eu
+	grep "$1" && 2>/dev/null -eu grep 2>/dev/null cd grep
+	| 2>/dev/null then 2>/dev/null echo
+	then export x=1 --verbose
+grep x=1 printf -eu local printf readonly done x=1 grep export | local
+	&& cd awk printf "$@" --verbose
+		${HOME} printf x=1 sed local 'quoted text' /usr/bin
+printf $(pwd) readonly | && sed -eu sed
+	awk "$1" $(pwd) local | export "$@" sed /usr/bin
+	grep readonly printf cd 'quoted text'
+${HOME} printf sed grep cd grep 'quoted text' | echo "$@" local echo readonly |
+/usr/bin /usr/bin export /usr/bin readonly "$1" ${HOME}
+	&& grep $(pwd) then "$@" --verbose then
+2>/dev/null 'quoted text' sed readonly "$@" -eu ${HOME} printf
+		--verbose cd printf 2>/dev/null then x=1 echo sed
+		$(pwd) readonly awk cd readonly export
+	printf 'quoted text' | | cd sed ${HOME} done sed sed 2>/dev/null
+		done 2>/dev/null x=1 -eu -eu --verbose
+sed $(pwd) $(pwd) x=1 "$@" && -eu awk "$@" export | sed printf test $(pwd) grep
+export done printf awk cd
+	"$1" echo 'quoted text' test -eu awk sed local | "$@" grep then
+		'quoted text' printf --verbose grep && 2>/dev/null
+"$@" cd cd x=1 awk then echo cd && 'quoted text' ${HOME} test "$1" --verbose export
+		"$@" awk done /usr/bin | ${HOME} sed local
+	done grep -eu readonly | "$1" ${HOME} "$@" -eu 2>/dev/null -eu
+		readonly echo local echo export "$1" | local ${HOME} "$@" | export "$@" 2>/dev/null
+		x=1 printf "$@" export echo x=1 sed 'quoted text' done
+		x=1 "$@" readonly then readonly grep 2>/dev/null -eu readonly
+	then -eu local --verbose sed awk export grep grep awk done "$@"
+		| -eu sed done | grep && readonly $(pwd) readonly 2>/dev/null 2>/dev/null
+		local done --verbose /usr/bin grep printf readonly x=1 awk printf
+		export "$1" | echo readonly 'quoted text' $(pwd)
+		"$@" test echo grep sed /usr/bin cd --verbose "$@" sed printf local readonly
+test test readonly cd sed $(pwd) sed 'quoted text' grep test done "$1" 'quoted text'
+x=1 --verbose -eu done x=1 cd test x=1 cd readonly done local
+		local sed grep grep /usr/bin printf /usr/bin then
+	test && readonly $(pwd) /usr/bin awk "$1" && 'quoted text' grep readonly &&
+		local x=1 test /usr/bin /usr/bin
+local grep | /usr/bin "$@" 'quoted text' export then "$@" "$@" grep
+--verbose sed "$@" sed then | printf readonly ${HOME} | grep "$@" cd --verbose
+		${HOME} x=1 awk grep
+sed export export | local printf echo echo test "$1" --verbose x=1
+| ${HOME} -eu echo ${HOME} /usr/bin echo 2>/dev/null done 2>/dev/null
+		--verbose awk -eu echo
+&& x=1 then && -eu 'quoted text' x=1 echo readonly
+"$1" local 'quoted text' test $(pwd) readonly
+echo "$1" "$@" x=1 2>/dev/null awk done | grep sed cd 'quoted text'
+	sed echo printf -eu 2>/dev/null test
+grep then awk echo sed --verbose done $(pwd) printf
+	/usr/bin readonly x=1 cd then "$@" echo done -eu
+		grep && ${HOME} | sed --verbose -eu /usr/bin
+		export "$1" local | sed /usr/bin 2>/dev/null
+		awk ${HOME} -eu 2>/dev/null "$@" -eu && | echo
+		| done "$1" && then grep ${HOME} cd export x=1 --verbose awk done cd
+"$@" | then /usr/bin -eu
+		"$1" /usr/bin 2>/dev/null
+		--verbose 'quoted text' grep readonly awk grep -eu awk --verbose 2>/dev/null &&
+	x=1 x=1 x=1 export grep echo grep printf -eu "$1"
+	grep && done sed test echo /usr/bin awk ${HOME} done export printf
+		printf --verbose test x=1 export readonly 2>/dev/null 'quoted text'
+x=1 then echo local awk echo then export cd /usr/bin | $(pwd)
+	$(pwd) /usr/bin ${HOME} sed "$1"
+	/usr/bin then "$@" local echo then 'quoted text' readonly local "$1" local "$1"
+		${HOME} "$1" | x=1 'quoted text' x=1 "$1" sed done grep
+	awk $(pwd) | export | 'quoted text' grep
+		export printf --verbose "$1" | ${HOME} && $(pwd)
+	printf "$1" readonly --verbose local
+	-eu $(pwd) ${HOME} 2>/dev/null -eu && echo | test then grep printf && readonly
+"$@" "$@" ${HOME} cd 2>/dev/null echo echo /usr/bin echo ${HOME} 'quoted text'
+-eu -eu 'quoted text' done 'quoted text' $(pwd) then done grep && /usr/bin
+	done 'quoted text' && && echo $(pwd) then --verbose readonly 2>/dev/null
+	/usr/bin sed | sed sed then test "$1"
+	printf /usr/bin local 2>/dev/null then --verbose
+	'quoted text' local 2>/dev/null -eu 2>/dev/null done done local && grep
+grep "$1" readonly 'quoted text' "$@" then
+echo cd local $(pwd) 'quoted text' "$1" /usr/bin ${HOME} local $(pwd) | then
+		"$1" ${HOME} sed test sed test /usr/bin
+	-eu | | 2>/dev/null /usr/bin x=1 "$1" x=1 then --verbose grep
+		sed then sed x=1 $(pwd) -eu 2>/dev/null
+		&& echo "$@" printf awk 'quoted text' ${HOME}
+		then echo /usr/bin cd echo grep | done
+	"$1" 2>/dev/null 2>/dev/null "$1" -eu local echo sed
+grep ${HOME} grep "$@" --verbose echo then 2>/dev/null /usr/bin --verbose
+		/usr/bin printf local 2>/dev/null readonly test then x=1 echo echo
+		then printf /usr/bin local export
+&& then /usr/bin ${HOME} "$1" x=1 readonly printf
+		"$1" && -eu then local cd && printf grep local 2>/dev/null
+		sed cd then -eu 2>/dev/null /usr/bin done echo 'quoted text' "$@" /usr/bin $(pwd)
+awk grep awk sed test "$@" test test done cd
+		sed ${HOME} "$1" --verbose
+"$1" 'quoted text' done test | /usr/bin
+x=1 export then export grep cd | x=1 awk grep awk --verbose
+		${HOME} $(pwd) export grep test
+	&& export export echo --verbose && printf ${HOME} "$@"
+	"$1" readonly echo --verbose test done export readonly awk "$1"
+	| --verbose ${HOME} local 'quoted text' printf grep x=1 then
+2>/dev/null sed "$1" 2>/dev/null
+test local printf readonly 'quoted text'
+		readonly echo "$1" sed then "$1" "$1" "$@" $(pwd) && ${HOME} then
+		"$1" $(pwd) done sed echo export then
+	"$1" "$@" test && local sed -eu cd && --verbose
+		printf printf "$1" "$@" printf export done /usr/bin
+	| export && sed 'quoted text'
+	then $(pwd) -eu $(pwd) awk "$1" awk export export -eu /usr/bin
+	echo echo sed x=1 "$@" /usr/bin readonly echo awk cd done printf cd printf
+		export readonly 2>/dev/null export cd export grep cd
+		"$@" sed export 2>/dev/null grep test 2>/dev/null done local grep
+	local cd ${HOME} && | x=1 "$@" | -eu grep local echo --verbose 2>/dev/null
+	sed 2>/dev/null echo | export "$1" ${HOME} x=1 readonly && grep $(pwd) cd grep grep
+test $(pwd) && export grep -eu readonly | done && grep "$@" cd test
+	$(pwd) x=1 echo x=1 printf export /usr/bin --verbose -eu 2>/dev/null
+	export printf 'quoted text' sed $(pwd)
+echo ${HOME} && 'quoted text' export
+	export && printf $(pwd)
+	echo cd export x=1 x=1 | cd grep "$1" $(pwd) && awk "$1" printf "$@" ${HOME}
+	$(pwd) $(pwd) then then done awk ${HOME} sed readonly && |
+"$@" echo $(pwd) local readonly 'quoted text' 'quoted text' x=1
+"$@" sed 2>/dev/null sed test "$@"
+		/usr/bin export cd printf readonly grep sed readonly && local awk $(pwd)
+		'quoted text' then local
+	cd test printf test echo printf "$@" "$1" test --verbose ${HOME} echo
+readonly -eu /usr/bin then cd
+done 2>/dev/null readonly && 'quoted text'
+	readonly -eu readonly x=1 "$@" /usr/bin x=1 x=1 2>/dev/null "$1" ${HOME} "$@"
+	| /usr/bin grep cd cd sed "$1" x=1 awk readonly local x=1 -eu "$1" -eu
+	awk sed x=1 local 'quoted text' test --verbose
+		$(pwd) echo && readonly $(pwd)
+		x=1 readonly grep test "$1"
+	sed "$1" "$1" && $(pwd) cd $(pwd) echo
+local "$1" "$1" && test readonly /usr/bin ${HOME}
+2>/dev/null local grep printf export sed awk grep
+	local $(pwd) "$1" cd --verbose
+&& sed /usr/bin awk $(pwd) --verbose local ${HOME} awk readonly
+	"$1" grep local echo x=1 "$1" x=1 -eu $(pwd) export 'quoted text' /usr/bin
+local echo done cd ${HOME} sed sed sed awk echo "$1" 2>/dev/null /usr/bin
+		'quoted text' 'quoted text' && grep test
+		grep cd done local sed export test
+${HOME} readonly 'quoted text' cd $(pwd)
+done $(pwd) --verbose 2>/dev/null /usr/bin x=1 | "$@" "$@"
+	${HOME} sed "$1" awk awk 2>/dev/null && printf && | $(pwd)
+	"$1" && && grep $(pwd) -eu && printf cd 'quoted text' ${HOME} then 2>/dev/null
+		"$1" x=1 -eu readonly
+-eu $(pwd) export sed awk then printf 2>/dev/null
+		/usr/bin /usr/bin $(pwd)
+		done "$@" readonly readonly
+		cd awk done then x=1 readonly done echo local "$@"
+		done --verbose printf && awk --verbose "$1" --verbose
+"$@" done readonly /usr/bin -eu sed && export
+		| grep 'quoted text' awk cd -eu awk | x=1 awk -eu test awk 2>/dev/null readonly
+		awk awk ${HOME} "$@" cd local
+		'quoted text' 2>/dev/null export
+| grep | ${HOME} test $(pwd)
+		local ${HOME} "$@" x=1 cd -eu && -eu "$1" done done grep printf
+		sed | "$1" --verbose test cd done test /usr/bin 'quoted text' done local /usr/bin
+		awk --verbose export grep 'quoted text' && sed export done printf ${HOME} test
+	&& local export --verbose done awk test done done ${HOME}
+| test then -eu local && "$1" readonly done 'quoted text'
+		grep sed -eu printf then grep printf ${HOME} echo done sed cd --verbose
+		cd cd printf then x=1 ${HOME} /usr/bin printf cd && readonly then "$@" "$1" $(pwd)
+		export readonly printf echo done && "$@" readonly grep --verbose
+		-eu | "$@" 'quoted text' cd x=1 then cd done 'quoted text' && export readonly
+	export ${HOME} -eu -eu
+		'quoted text' echo export ${HOME} ${HOME} ${HOME}
+	cd test | cd "$@" -eu grep 'quoted text' "$1"
+		--verbose 'quoted text' "$1" grep readonly test sed test
+		&& && && awk && | grep local sed ${HOME} "$@"
+	$(pwd) x=1 echo --verbose x=1 cd "$1" -eu $(pwd) readonly
+test --verbose -eu $(pwd) local "$@" awk cd printf
+	/usr/bin then local ${HOME} sed readonly ${HOME} local | x=1 cd x=1 done
+x=1 $(pwd) cd then then awk 'quoted text' sed "$@" cd done
+$(pwd) && "$1" sed readonly awk /usr/bin "$1" sed sed | | 'quoted text'
+		x=1 printf x=1 -eu printf
+	readonly test test awk then test
+'quoted text' local | local test "$1" $(pwd) printf test 'quoted text'
+		sed sed x=1 readonly | then 2>/dev/null
+	"$1" echo x=1 readonly --verbose done && $(pwd)
+printf ${HOME} awk echo -eu "$1" then 'quoted text'
+echo $(pwd) then grep /usr/bin printf echo x=1 grep
+	/usr/bin /usr/bin "$1" export awk grep 'quoted text'
+		'quoted text' sed export test sed printf -eu ${HOME} 2>/dev/null 2>/dev/null
+		printf export "$@" export printf
+local /usr/bin cd 2>/dev/null 2>/dev/null --verbose sed
+	'quoted text' cd | grep
+sed "$@" $(pwd) x=1 --verbose then printf /usr/bin 'quoted text'
+then ${HOME} | "$1" 2>/dev/null grep /usr/bin test /usr/bin test echo
+		grep test && awk $(pwd) ${HOME} 'quoted text' 2>/dev/null $(pwd)
+test && --verbose 'quoted text' "$1" "$1" readonly printf 'quoted text' x=1
+		then sed --verbose x=1 done cd readonly -eu
+	cd export then ${HOME} /usr/bin test local then done | done x=1 echo
+done echo && then $(pwd)
+		awk awk printf x=1 'quoted text' /usr/bin printf ${HOME}
+test test sed "$1" echo awk sed then test printf printf readonly
+	cd awk export "$1" 2>/dev/null "$1" test grep test /usr/bin
+2>/dev/null export echo ${HOME} "$1"
+	echo $(pwd) printf --verbose test 'quoted text'
+--verbose grep 2>/dev/null 2>/dev/null printf test then export printf awk x=1
+		'quoted text' ${HOME} --verbose local 2>/dev/null sed then grep
+	readonly x=1 x=1 done sed 2>/dev/null && 2>/dev/null
+	readonly 2>/dev/null grep readonly then --verbose done
+then then $(pwd) /usr/bin | 2>/dev/null awk -eu test -eu && then grep readonly
+	printf "$1" export -eu awk ${HOME} then 2>/dev/null && "$1" readonly done awk
+		printf "$1" done -eu ${HOME} grep sed 2>/dev/null sed awk cd printf export
+		'quoted text' sed readonly -eu sed done printf then sed x=1 awk local grep export
+	test printf 'quoted text' grep grep printf --verbose
+	sed 'quoted text' printf "$1"
+2>/dev/null then 2>/dev/null
+		"$@" export && done --verbose $(pwd) done sed 2>/dev/null
+'quoted text' awk export 2>/dev/null | "$1"
+		cd ${HOME} -eu && 2>/dev/null 2>/dev/null
+-eu $(pwd) sed | awk cd
+		&& sed | awk cd cd x=1 test echo then && -eu /usr/bin x=1 sed 2>/dev/null
+		then sed /usr/bin ${HOME}
+"$1" awk 'quoted text'
+		--verbose sed x=1 done
+echo local awk /usr/bin grep grep "$@" 'quoted text' test printf awk "$@" export
+	echo 2>/dev/null 2>/dev/null && awk local cd printf "$1" /usr/bin cd cd
+	x=1 && -eu /usr/bin awk ${HOME} test grep | local sed printf
+	export $(pwd) done echo -eu
+/usr/bin /usr/bin printf then 2>/dev/null && done
+sed 2>/dev/null && local
+	sed --verbose readonly then 'quoted text' x=1 "$@" then grep 2>/dev/null 2>/dev/null
+		done echo --verbose && "$1" awk sed --verbose printf readonly
+	readonly ${HOME} --verbose --verbose
+readonly local "$1" 2>/dev/null then -eu -eu grep printf export done done
+printf "$1" test then /usr/bin "$1" && 'quoted text'
+sed cd printf "$@" ${HOME} | "$1" "$1" done
+grep /usr/bin awk && 'quoted text' export grep
+'quoted text' && $(pwd) $(pwd) sed echo local --verbose
+	export x=1 --verbose printf readonly echo export echo echo
+	${HOME} done /usr/bin echo printf sed done grep 2>/dev/null
+		cd echo /usr/bin done
+		echo 2>/dev/null export x=1 awk -eu sed printf
+		sed cd echo awk | readonly /usr/bin | cd
+		-eu 'quoted text' $(pwd) x=1 readonly
+	--verbose readonly export ${HOME} ${HOME}
+		export test "$1" | test $(pwd) 2>/dev/null cd
+		cd --verbose export 2>/dev/null done && local done "$@" cd grep cd awk 'quoted text'
+		done -eu grep 2>/dev/null && echo --verbose
+$(pwd) -eu test 'quoted text' 'quoted text' "$@" done export cd && "$1" --verbose
+x=1 export /usr/bin local sed sed export
+		$(pwd) sed /usr/bin /usr/bin grep ${HOME} && -eu awk grep cd x=1 $(pwd)
+printf "$@" done "$@" readonly && "$@" done
+	test "$@" "$1" -eu "$1" 'quoted text' export then --verbose echo
+		export echo x=1 "$@" "$1" --verbose ${HOME} sed cd 'quoted text'
+grep x=1 done local local && cd -eu -eu "$@"
+		grep ${HOME} 2>/dev/null | /usr/bin sed x=1 awk 'quoted text'
+		readonly ${HOME} /usr/bin 2>/dev/null echo "$1" ${HOME}
+	"$1" | 2>/dev/null ${HOME}
+		2>/dev/null "$@" then | echo printf --verbose
+x=1 done x=1 readonly then then 'quoted text' -eu ${HOME}
+&& export sed $(pwd) "$@" cd then readonly /usr/bin
+		done grep sed then done
+		'quoted text' awk grep grep && printf "$@" echo "$@"
+done --verbose echo x=1 "$@" "$1" 2>/dev/null awk done /usr/bin printf awk done
+	test test && && sed /usr/bin && $(pwd) 2>/dev/null sed /usr/bin 2>/dev/null
+	then 'quoted text' local awk && sed test 'quoted text' | export done test
+	x=1 /usr/bin ${HOME} export &&
+	"$@" && | local sed "$1" done cd x=1 --verbose
+2>/dev/null /usr/bin cd echo /usr/bin "$1"
+		'quoted text' done sed echo /usr/bin $(pwd) && printf
+		'quoted text' -eu $(pwd)
+local --verbose sed readonly then | awk "$@" "$1" "$@" then sed ${HOME} grep
+		grep test done "$1" readonly "$1" ${HOME} local done 'quoted text' x=1 sed grep
+		local then then -eu $(pwd) awk grep grep && && $(pwd) /usr/bin cd sed -eu 'quoted text'
+		awk sed "$1" test $(pwd) x=1 && readonly | echo
+$(pwd) local sed "$1" "$@" -eu 'quoted text'
+		local local cd grep "$@" awk local "$@" grep | $(pwd) local
+${HOME} export grep "$@" sed test | 2>/dev/null done
+"$@" --verbose -eu "$1" export | test "$@" --verbose then sed --verbose -eu
+echo "$1" export echo echo
+done 2>/dev/null test printf
+	$(pwd) cd x=1 printf -eu ${HOME} echo $(pwd) --verbose ${HOME} | cd "$@" --verbose
+		echo printf | readonly | -eu export echo 'quoted text' awk readonly
+	test $(pwd) grep test sed ${HOME} /usr/bin sed test cd sed sed | 2>/dev/null
+--verbose | local cd grep $(pwd) "$@"
+	then then --verbose grep awk cd printf test && "$@" echo then
+	sed $(pwd) then awk | "$1" && x=1 && done sed done local export test /usr/bin
+	| export sed readonly && 'quoted text' 'quoted text'
+	sed export done printf readonly awk -eu done test sed readonly
+		then "$1" -eu awk printf -eu "$@" printf ${HOME} x=1 $(pwd) "$@" export
+		$(pwd) sed x=1 awk export sed "$1" ${HOME} readonly then --verbose sed test 2>/dev/null
+-eu x=1 sed | "$1" -eu awk test "$1" then done && grep
+export sed ${HOME} awk
+printf sed grep awk cd test "$1"
+	&& "$1" --verbose | echo readonly cd /usr/bin
+	test test local | /usr/bin x=1 ${HOME} cd printf awk export ${HOME}
+	--verbose cd readonly export --verbose
+		printf done done done 2>/dev/null local echo | cd "$@" then -eu
+	"$1" readonly -eu cd local | /usr/bin
+	"$@" readonly printf then | 2>/dev/null cd -eu printf
+local 'quoted text' $(pwd)
+		sed cd $(pwd) awk x=1 cd | --verbose
+$(pwd) grep awk 'quoted text' $(pwd) export local sed "$@" --verbose
+		"$1" | $(pwd) ${HOME} cd then 2>/dev/null ${HOME}
+	| local ${HOME} ${HOME} $(pwd) 'quoted text'
+grep readonly printf "$1" ${HOME} -eu 'quoted text'
+		test "$@" x=1 awk echo test test --verbose --verbose done "$1" sed readonly
+	readonly && -eu echo "$@" readonly grep then "$@" $(pwd) readonly awk
+readonly x=1 --verbose cd test test && $(pwd) ${HOME} done echo printf awk
+	export export echo readonly readonly done export ${HOME} && echo "$@" x=1
+/usr/bin readonly printf
+	/usr/bin printf && then then sed echo echo test printf
+		&& "$@" -eu $(pwd) $(pwd) sed then && "$@" grep ${HOME} ${HOME} sed ${HOME}
+-eu 'quoted text' export
+then test -eu "$@" readonly
+		cd awk awk && grep then done && then sed $(pwd) local
+		/usr/bin $(pwd) export export -eu $(pwd) "$1" x=1 printf then
+	then test -eu 'quoted text' 2>/dev/null
+	echo x=1 done 2>/dev/null 2>/dev/null
+		local x=1 "$1" --verbose then "$1" readonly 2>/dev/null /usr/bin -eu export cd
+		x=1 ${HOME} && printf sed --verbose &&
+	2>/dev/null | 'quoted text' cd "$@" then awk 'quoted text'
+then "$@" done ${HOME} && 'quoted text' 'quoted text' /usr/bin "$1" grep
+	printf 'quoted text' | -eu cd --verbose then $(pwd) echo cd | grep | cd "$1"
+then | echo sed --verbose cd local $(pwd)
+		cd /usr/bin done ${HOME} done
+grep grep /usr/bin x=1 2>/dev/null 'quoted text' /usr/bin sed &&
+	-eu --verbose | 'quoted text' -eu $(pwd) --verbose && "$1" /usr/bin done test export
+/usr/bin echo | | /usr/bin | echo 'quoted text' | then
+	2>/dev/null x=1 export grep then | 2>/dev/null --verbose
+	&& "$@" ${HOME} && export awk cd $(pwd) echo readonly
+		printf $(pwd) cd grep done then 2>/dev/null -eu local
+	&& grep done -eu --verbose test 'quoted text' /usr/bin test "$1"
+-eu export cd export cd -eu && readonly $(pwd)
+		sed export printf "$@" echo cd ${HOME} done done -eu --verbose "$1" -eu 2>/dev/null
+	-eu printf echo awk 2>/dev/null --verbose 2>/dev/null done
+readonly done -eu readonly local export printf
+	--verbose --verbose -eu export /usr/bin grep ${HOME} readonly ${HOME}
+cd --verbose x=1 'quoted text' test --verbose export "$@" --verbose ${HOME}
+grep "$1" 'quoted text' && /usr/bin x=1
+'quoted text' x=1 2>/dev/null
+	awk printf ${HOME} export && && awk local /usr/bin |
+	then then sed && export && export x=1 export readonly
+--verbose $(pwd) ${HOME} -eu "$@"
+	done "$@" "$@" | 'quoted text' echo readonly /usr/bin
+$(pwd) cd x=1 -eu $(pwd) test test then "$@" 2>/dev/null -eu x=1
+		/usr/bin sed && sed -eu cd 2>/dev/null then -eu
+		--verbose grep printf printf grep echo cd
+	done awk x=1 2>/dev/null "$@" then "$@" $(pwd) printf 'quoted text'
+		printf printf -eu "$1" grep echo echo
+	"$@" x=1 -eu x=1 && 'quoted text' grep ${HOME} && local grep awk test printf
+		local x=1 $(pwd) test done -eu sed then && && /usr/bin
+		export -eu && local sed &&
+	&& test readonly printf grep cd x=1 export test
+x=1 then export $(pwd) cd export
+	grep cd echo ${HOME} 2>/dev/null ${HOME} $(pwd) $(pwd)
+test -eu grep ${HOME} printf
+		echo --verbose ${HOME} --verbose readonly -eu then awk local test then
+2>/dev/null "$1" done --verbose && -eu awk test export /usr/bin grep grep readonly
+test 2>/dev/null printf $(pwd) grep $(pwd) echo done export awk done
+	'quoted text' $(pwd) x=1 printf
+	grep export | cd echo test readonly --verbose && grep $(pwd) "$@" 'quoted text'
+local /usr/bin cd | echo $(pwd) readonly
+"$1" | && readonly | done readonly
+	/usr/bin export "$@" -eu
+		&& test grep --verbose grep cd local
+		${HOME} awk readonly ${HOME} done done readonly done "$1" $(pwd) ${HOME}
+		readonly | grep sed 2>/dev/null done
+	${HOME} cd then /usr/bin $(pwd) awk && export
+		/usr/bin "$@" grep x=1 x=1 local "$1" -eu ${HOME} 2>/dev/null cd -eu -eu
+"$1" local cd /usr/bin "$@" x=1 export && grep --verbose then && "$1" --verbose
+	grep local "$1" && && | local test
+		"$1" awk cd test sed | -eu | readonly
+local -eu export "$1" cd "$@"
+local cd --verbose /usr/bin awk sed awk x=1 ${HOME}
+	"$1" "$1" | x=1 && | export echo ${HOME} 'quoted text' echo
+	x=1 --verbose && /usr/bin local
+	export | 2>/dev/null echo $(pwd) sed && printf
+	local sed local cd && 2>/dev/null $(pwd) | x=1
+done 'quoted text' sed cd 'quoted text' echo 'quoted text' test printf
+		${HOME} local printf awk | readonly && 2>/dev/null --verbose grep
+	printf ${HOME} awk && x=1 --verbose -eu
+	"$@" awk --verbose && test export 'quoted text' -eu local
+-eu then export --verbose
+	export sed sed -eu echo cd && printf grep ${HOME} local local x=1
+	2>/dev/null "$1" x=1 done then ${HOME}
+then cd awk && sed | cd "$@" echo x=1 sed
+/usr/bin x=1 export "$1" && test done 2>/dev/null
+	--verbose $(pwd) readonly done /usr/bin
+	export test 2>/dev/null export 'quoted text' | --verbose
+		printf cd echo local then sed | /usr/bin --verbose printf then
+	2>/dev/null sed readonly printf | ${HOME} then grep local done export -eu 'quoted text'
+	cd printf then && --verbose echo 'quoted text' /usr/bin
+	'quoted text' awk export cd --verbose awk $(pwd) sed --verbose
+"$@" test /usr/bin done local cd echo &&
+		local -eu 2>/dev/null local ${HOME} ${HOME} --verbose printf export |
+cd sed | 'quoted text' x=1
+	test x=1 cd printf ${HOME} "$@" $(pwd) done sed export ${HOME}
+	--verbose ${HOME} grep | && ${HOME} readonly
+		x=1 --verbose test 2>/dev/null readonly
+echo echo 'quoted text' local done echo awk
+	then ${HOME} | readonly $(pwd)
+| 'quoted text' printf && then test x=1
+		done -eu x=1 then export 'quoted text' x=1 && x=1 cd awk echo
+		done ${HOME} $(pwd) && /usr/bin
+printf "$@" x=1 x=1 /usr/bin && local 'quoted text'
+		sed "$@" printf $(pwd) echo then grep
+cd /usr/bin then 'quoted text' cd printf | grep ${HOME}
+echo local grep 'quoted text' x=1 --verbose export then then test --verbose
+		readonly -eu 'quoted text'
+sed export test done | sed readonly "$@" printf --verbose $(pwd) 2>/dev/null
+"$1" /usr/bin ${HOME} awk grep "$1" echo "$1" local | readonly
+&& x=1 printf readonly ${HOME} | x=1 $(pwd) export grep 2>/dev/null -eu grep 'quoted text'
+		cd echo 'quoted text' -eu test sed cd
+&& grep cd cd x=1 "$1" echo readonly $(pwd) then sed $(pwd) x=1
+	awk awk --verbose && cd --verbose /usr/bin sed cd "$1" done readonly
+		sed ${HOME} awk "$@" test && printf
+		local -eu --verbose $(pwd) printf && awk &&
+-eu test export test printf echo test done awk done /usr/bin grep
+'quoted text' 'quoted text' done local && local readonly local echo printf
+done cd done readonly 2>/dev/null awk done
+grep done -eu | $(pwd) echo | && && grep sed local "$1" "$1"
+printf echo --verbose readonly | then "$@" awk | test
+printf readonly | readonly printf export cd "$@" /usr/bin /usr/bin test local
+sed && /usr/bin test awk --verbose test ${HOME} | grep
+local readonly printf | 2>/dev/null ${HOME} grep "$1" "$@" "$@" cd then ${HOME}
+echo export echo /usr/bin "$1"
+grep 2>/dev/null echo -eu grep awk
+	echo "$1" /usr/bin readonly local export && "$1" echo grep ${HOME} readonly
+		printf done grep -eu readonly /usr/bin $(pwd) --verbose
+		2>/dev/null | "$1" test ${HOME} awk -eu x=1 "$@" sed && "$1" readonly
+	--verbose && $(pwd) "$@" x=1 done $(pwd) echo echo ${HOME} /usr/bin
+		${HOME} | then ${HOME} x=1 x=1 readonly 'quoted text'
+$(pwd) then done test $(pwd) grep && &&
+		test local readonly $(pwd) /usr/bin local export "$1" export 2>/dev/null
+	then /usr/bin done echo $(pwd) printf x=1 "$@" /usr/bin then 'quoted text'
+		/usr/bin $(pwd) x=1 ${HOME} printf 'quoted text' echo 'quoted text' test
+	&& cd export sed readonly cd 2>/dev/null x=1 echo awk readonly && $(pwd)
+| echo local printf test then echo "$@" local x=1 2>/dev/null
+		${HOME} $(pwd) 'quoted text' "$1" echo done /usr/bin awk /usr/bin 2>/dev/null
+		'quoted text' sed x=1 export printf 'quoted text' printf x=1
+echo "$1" && /usr/bin && echo test test | -eu
+	2>/dev/null "$@" "$@" echo $(pwd) "$1" 'quoted text' awk --verbose
+	&& | -eu printf local $(pwd) /usr/bin done | sed /usr/bin "$@" "$1"
+		then test x=1 awk local /usr/bin 'quoted text' grep done done local "$@"
+export then $(pwd) printf done $(pwd) cd then printf -eu
+		2>/dev/null "$1" x=1 export 'quoted text'
+		/usr/bin done --verbose echo local "$@" "$@" ${HOME} cd "$1" "$1" 2>/dev/null readonly
+	export printf export 'quoted text' x=1 'quoted text'
+		grep /usr/bin $(pwd) 'quoted text' 2>/dev/null sed grep --verbose
+		x=1 echo | $(pwd) --verbose echo echo && printf -eu "$1"
+sed echo sed awk cd /usr/bin cd "$1" -eu local x=1 ${HOME} $(pwd)
+/usr/bin $(pwd) "$1" | "$@" 2>/dev/null x=1 'quoted text' sed
+		&& grep $(pwd) --verbose && && sed local 'quoted text' readonly
+	test && | 2>/dev/null done $(pwd) "$1" 'quoted text' echo local
+test x=1 done ${HOME} readonly test "$@" readonly
+grep | && "$1" "$1" sed
+		-eu -eu && local 'quoted text' $(pwd) -eu -eu --verbose
+	'quoted text' "$@" echo /usr/bin export | cd local awk "$1" test x=1 readonly
+x=1 | -eu /usr/bin sed test cd grep
+		local "$1" "$@" awk cd done test export printf grep cd then --verbose
+		&& printf then --verbose echo --verbose $(pwd)
+		test 2>/dev/null export done done grep cd x=1 local cd echo then cd
+	'quoted text' awk cd | $(pwd) grep "$1" export printf $(pwd)
+		x=1 export x=1 done x=1 && 'quoted text' x=1
+	sed -eu local local --verbose -eu ${HOME} awk $(pwd) cd | ${HOME} done --verbose
+	${HOME} x=1 local sed 'quoted text' echo /usr/bin /usr/bin $(pwd) cd
+		'quoted text' readonly cd "$@" done "$1"
+	awk test local "$@" && printf sed | x=1 -eu
+	'quoted text' "$1" | done local $(pwd) "$1" then --verbose
+grep then done /usr/bin printf
+	| readonly ${HOME} echo x=1 printf 'quoted text' cd printf /usr/bin
+	${HOME} echo 2>/dev/null --verbose
+"$1" ${HOME} cd grep grep 2>/dev/null 'quoted text' && done grep --verbose
+/usr/bin grep local echo 2>/dev/null
+		local done && $(pwd) done && done ${HOME} done then ${HOME} | "$1" printf &&
+	then grep /usr/bin | then "$@" echo $(pwd) | then && x=1
+	awk ${HOME} | 'quoted text' printf awk 'quoted text'
+$(pwd) ${HOME} 2>/dev/null readonly && printf
+"$@" done --verbose echo x=1 readonly echo echo test grep | 2>/dev/null
+cd $(pwd) sed test /usr/bin printf export -eu
+		&& grep "$@" 'quoted text' "$@" "$1" 2>/dev/null x=1 "$@" test | sed
+awk | test readonly grep 'quoted text'
+	--verbose sed readonly /usr/bin export then && --verbose readonly
+local echo awk "$@" grep echo awk /usr/bin 2>/dev/null "$1" "$@" -eu && $(pwd)
+		'quoted text' 2>/dev/null
+		echo local local sed && | | sed echo "$@" then done then | 'quoted text'
+		/usr/bin echo awk $(pwd) "$@" "$@" sed then awk export
+		sed "$@" echo awk readonly "$@"
+	test 2>/dev/null | "$1" x=1 'quoted text' echo then $(pwd) &&
+	awk --verbose /usr/bin 2>/dev/null cd sed --verbose
+test awk ${HOME} --verbose | 2>/dev/null $(pwd) $(pwd) "$1" then "$1" sed --verbose
+		done grep awk x=1 "$@" 2>/dev/null
+	"$@" x=1 -eu then ${HOME} -eu grep export echo cd echo
+	--verbose then /usr/bin awk --verbose cd | printf "$1" local x=1 $(pwd)
+	2>/dev/null printf printf cd
+	"$@" x=1 "$@" "$1" -eu /usr/bin readonly 2>/dev/null
+		cd && test ${HOME} $(pwd) $(pwd) done /usr/bin x=1 awk grep then
+readonly | export then ${HOME} "$@" then test $(pwd)
+sed 'quoted text' cd local
+		| | $(pwd) readonly sed $(pwd)
+		"$1" done && then 'quoted text' && 'quoted text' sed
+		printf --verbose cd | grep printf echo grep awk cd -eu test cd echo --verbose
+	-eu then && --verbose echo "$@" cd done $(pwd) sed
+	done done && test -eu awk awk awk --verbose ${HOME} x=1 --verbose x=1 2>/dev/null
+&& "$1" "$1" "$@" done printf $(pwd) ${HOME} 'quoted text' /usr/bin sed
+2>/dev/null echo --verbose | grep
+		'quoted text' $(pwd) cd test "$@" done grep ${HOME} done | 2>/dev/null
+printf awk /usr/bin --verbose cd then done ${HOME} printf x=1 done grep "$1"
+	${HOME} ${HOME} grep | awk x=1 export awk &&
+	&& grep done echo ${HOME} awk echo sed | -eu 'quoted text' ${HOME} &&
+readonly -eu --verbose echo printf | local readonly sed readonly ${HOME}
+readonly export readonly
+	then then cd 2>/dev/null test --verbose grep done grep export echo $(pwd) x=1 cd
+		echo test echo 'quoted text' export awk then && $(pwd) ${HOME}
+done printf grep $(pwd) printf $(pwd)
+	echo $(pwd) cd 2>/dev/null
+	then $(pwd) $(pwd) 'quoted text' awk /usr/bin
+	export -eu readonly /usr/bin awk ${HOME} "$@"
+then 2>/dev/null "$@" done /usr/bin
+	done printf cd $(pwd) awk done export ${HOME} /usr/bin 'quoted text' && grep
+		echo && test x=1 x=1 /usr/bin local local sed 'quoted text' export test grep
+cd echo "$1" -eu /usr/bin export $(pwd) test printf printf -eu
+		${HOME} local sed $(pwd) sed && awk && export /usr/bin
+${HOME} then export then && "$1" $(pwd) 2>/dev/null | ${HOME} |
+		/usr/bin -eu grep -eu then x=1 echo printf grep local
+		awk 2>/dev/null 2>/dev/null grep "$@" /usr/bin cd then readonly $(pwd) sed
+sed export --verbose cd echo x=1 /usr/bin test grep ${HOME}
+	sed 2>/dev/null "$1" readonly
+		then test | /usr/bin "$1" then
+	| "$1" 'quoted text' 'quoted text' 'quoted text'
+	$(pwd) -eu export x=1 test
+		&& ${HOME} cd && done echo then 2>/dev/null $(pwd)
+		x=1 grep 2>/dev/null 'quoted text' -eu -eu
+awk echo $(pwd) 'quoted text' test
+readonly /usr/bin 2>/dev/null -eu && ${HOME}
+		"$@" $(pwd) "$@" then local local sed readonly then $(pwd) local
+/usr/bin --verbose grep 2>/dev/null
+	sed then 2>/dev/null "$@" "$1" sed awk awk awk 2>/dev/null local /usr/bin
+		sed cd | echo cd --verbose done cd 2>/dev/null grep 'quoted text' test sed
+	echo test x=1 test then ${HOME} printf sed $(pwd) cd cd ${HOME} &&
+	local local sed ${HOME}
+		grep -eu --verbose "$1" | readonly
+x=1 "$@" 2>/dev/null done local "$@" x=1 ${HOME} local
+readonly "$@" ${HOME} && 2>/dev/null /usr/bin export x=1 $(pwd) grep /usr/bin 'quoted text'
+		--verbose | echo local -eu ${HOME} --verbose local then sed grep | local test
+		2>/dev/null sed --verbose awk
+	$(pwd) cd export printf "$1" /usr/bin done "$1" printf awk 2>/dev/null
+	${HOME} "$1" | readonly test
+	printf test | cd then cd 2>/dev/null ${HOME}
+"$@" 'quoted text' && ${HOME} $(pwd) echo /usr/bin test sed done local
+	cd x=1 then grep sed /usr/bin
+		-eu --verbose test echo ${HOME}
+		2>/dev/null readonly cd then done readonly done awk /usr/bin $(pwd)
+	'quoted text' cd && export grep ${HOME} echo 'quoted text'
+	done $(pwd) /usr/bin ${HOME} x=1 x=1 | echo cd ${HOME} && $(pwd) x=1
+		-eu --verbose 'quoted text' local /usr/bin "$1" 2>/dev/null printf ${HOME}
+	done sed x=1 --verbose printf readonly cd local cd done && -eu done
+readonly grep grep x=1 export && 'quoted text' export -eu x=1 x=1
+		readonly $(pwd) printf "$1" sed "$@" then | echo
+		| x=1 sed x=1 'quoted text'
+$(pwd) /usr/bin sed && export export
+	export "$1" --verbose ${HOME} export printf printf x=1 test awk printf
+		grep export printf 2>/dev/null echo echo echo local --verbose -eu done
+	export ${HOME} "$1" local grep
+awk cd echo export && then "$1" export $(pwd)
+		--verbose ${HOME} local $(pwd) | readonly "$1"
+'quoted text' done awk local
+	'quoted text' echo awk 2>/dev/null
+		${HOME} done cd cd grep sed
+	printf x=1 sed "$@" echo test 'quoted text' test test | then export 2>/dev/null
+	"$@" grep done sed 'quoted text' $(pwd) export cd | grep local
+| sed awk echo echo readonly "$1"
+$(pwd) --verbose && then "$1" local 2>/dev/null
+	then then && then | "$1" printf cd test grep /usr/bin grep | "$1" "$@" printf
+2>/dev/null grep "$1" sed done done echo grep -eu export -eu readonly
+/usr/bin test 'quoted text' awk
+		| && done export "$1" && "$1" -eu local cd | 2>/dev/null done export echo
+		export sed test -eu --verbose readonly 'quoted text' echo | "$1" cd readonly
+		-eu sed test cd sed done ${HOME} x=1 | grep awk printf
+		"$@" "$1" test --verbose
+		"$1" awk "$@" done then
+"$1" | "$1" test export "$@" --verbose grep --verbose awk && awk local | printf
+		then 'quoted text' export
+--verbose export x=1 x=1 grep -eu --verbose
+	'quoted text' done local /usr/bin 'quoted text'
+		test export && 2>/dev/null 'quoted text'
+		-eu local export sed export printf -eu readonly export done test && -eu
+echo --verbose | "$1" && echo 2>/dev/null
+$(pwd) export && "$1" $(pwd) test 'quoted text'
+	sed readonly test 'quoted text' 'quoted text' 'quoted text'
+		--verbose 'quoted text' local $(pwd) readonly
+		export awk x=1 ${HOME} echo done -eu echo "$1" --verbose awk $(pwd)
+2>/dev/null printf ${HOME} sed test then "$1" 2>/dev/null -eu "$@" then 'quoted text'
+	echo echo cd export ${HOME} done && grep
+--verbose local x=1 test "$1" test sed && cd
+		awk export local export $(pwd) test grep 2>/dev/null /usr/bin
+then sed export 2>/dev/null 'quoted text' "$1" echo echo x=1 test grep x=1 $(pwd)
+		-eu printf 2>/dev/null readonly
+		local readonly readonly ${HOME} /usr/bin
+		echo 2>/dev/null awk
+"$@" test 2>/dev/null $(pwd) ${HOME} awk awk awk awk grep cd export local
+cd --verbose && "$1" x=1 $(pwd) then then | "$@" x=1
+		test && printf cd && && echo sed 'quoted text' -eu done
+		local echo export then /usr/bin readonly echo
+	echo "$1" cd export 2>/dev/null
+x=1 ${HOME} sed grep awk then
+awk 2>/dev/null cd awk "$1" 'quoted text'
+	--verbose done x=1 then awk -eu echo grep test
+$(pwd) --verbose printf -eu echo x=1 'quoted text' /usr/bin echo
+	2>/dev/null grep --verbose x=1 /usr/bin ${HOME}
+echo ${HOME} $(pwd) cd test printf 2>/dev/null
+		"$@" readonly x=1 "$@" sed /usr/bin && /usr/bin done export 'quoted text'
+grep awk test "$1" && /usr/bin /usr/bin cd then
+| && printf awk done -eu "$@" $(pwd)
+		$(pwd) -eu 2>/dev/null local ${HOME} echo local $(pwd) -eu ${HOME} $(pwd) export
+local test ${HOME} export 2>/dev/null done done
+${HOME} local "$1" "$1" -eu -eu | 'quoted text' awk | grep x=1 $(pwd) ${HOME}
+awk $(pwd) sed $(pwd) x=1 --verbose
+"$1" && sed && --verbose cd echo done then $(pwd) export export
+	readonly -eu --verbose | readonly readonly
+"$@" test cd test 'quoted text' ${HOME} test 'quoted text'
+	"$@" grep cd ${HOME} sed grep readonly test | 'quoted text' x=1 grep /usr/bin
+	"$1" $(pwd) $(pwd) "$@" 2>/dev/null "$1" $(pwd)
+		local readonly "$1" 'quoted text'
+		2>/dev/null "$1" then --verbose
+		local printf | 'quoted text' "$1" export 'quoted text'
+'quoted text' 2>/dev/null /usr/bin x=1 export $(pwd) done
+	&& $(pwd) 'quoted text' && then -eu
+'quoted text' "$@" | then grep
+/usr/bin export export sed $(pwd) readonly test "$1"
+'quoted text' export && | -eu "$@" x=1 $(pwd) "$@" sed /usr/bin local export 2>/dev/null
+		export then "$1" then ${HOME} "$@" grep
+		done x=1 ${HOME} --verbose sed "$@" sed readonly done $(pwd) /usr/bin -eu grep
+		awk --verbose test "$1" sed readonly x=1
+	local then 'quoted text' 2>/dev/null
+	"$@" test -eu 'quoted text' x=1 sed /usr/bin "$1" grep local
+	echo --verbose test test /usr/bin test grep -eu | /usr/bin "$@" test
+		x=1 cd sed -eu readonly sed 2>/dev/null 2>/dev/null awk readonly cd
+		then x=1 cd export 2>/dev/null
+		/usr/bin then local 'quoted text' --verbose
+	done /usr/bin readonly then then
+	local $(pwd) then "$@" /usr/bin x=1 --verbose printf $(pwd) grep x=1 2>/dev/null
+		/usr/bin readonly 'quoted text' local grep export 'quoted text'
+	test 'quoted text' export
+	| local echo awk echo "$@"
+		grep x=1 grep then readonly 2>/dev/null 2>/dev/null cd echo printf "$@" &&
+	grep && && sed --verbose 'quoted text' cd local test
+		${HOME} 2>/dev/null local $(pwd) ${HOME} echo
+		x=1 cd 'quoted text' ${HOME} test | then grep cd readonly $(pwd) awk
+		printf readonly -eu /usr/bin "$1" x=1 cd test test export
+	'quoted text' | echo grep ${HOME} "$1" done test x=1 readonly "$1" awk cd --verbose
+	x=1 then export x=1 sed -eu /usr/bin
+	"$1" "$@" test done /usr/bin awk "$1" | ${HOME} ${HOME} $(pwd) printf -eu then 'quoted text'
+		local /usr/bin /usr/bin && readonly
+cd ${HOME} then && "$@" test printf cd | awk 'quoted text' "$1" done test echo
+local sed --verbose | "$@" -eu readonly $(pwd) local "$@" echo
+	test export 'quoted text' awk 'quoted text'
+	export awk echo test $(pwd) "$1" && done then printf
+"$1" printf "$1" $(pwd) echo "$1"
+	'quoted text' | echo "$1" local 2>/dev/null then printf readonly
+		readonly ${HOME} 'quoted text' test $(pwd) --verbose then echo
+		export grep done done test awk /usr/bin
+	echo 'quoted text' test --verbose export done export --verbose done then | done
+		test test --verbose "$1" 'quoted text' done -eu readonly echo /usr/bin | then /usr/bin
+		${HOME} export awk | -eu grep
+	sed local x=1 done awk sed readonly "$@" printf sed -eu export 2>/dev/null test
+		/usr/bin done readonly $(pwd) printf
+	"$@" local $(pwd) grep awk done sed ${HOME} echo $(pwd) readonly x=1 |
+&& 2>/dev/null awk 'quoted text' x=1
+cd 2>/dev/null && awk "$@" | -eu ${HOME} ${HOME}
+sed readonly 'quoted text' |
+sed test echo readonly test $(pwd) x=1 ${HOME} "$1" "$@" $(pwd) cd --verbose local
+	"$@" awk sed x=1 x=1 2>/dev/null echo readonly --verbose done 2>/dev/null
+#include c4.sh
+then | ${HOME} sed x=1 export export printf && 'quoted text' "$@" 'quoted text'
+		printf sed "$@" --verbose "$1" x=1 readonly && "$@" -eu test
+x=1 'quoted text' cd awk | | $(pwd) ${HOME} /usr/bin grep printf
+		&& printf "$@" $(pwd) awk grep "$1" cd "$@" awk 'quoted text' "$@" test | printf
+		grep printf then "$@" 'quoted text' then test --verbose "$1"
+printf --verbose done then | ${HOME}
+echo | awk --verbose done 'quoted text' echo x=1 export
+		readonly grep && echo --verbose
+		"$@" "$1" && awk sed done x=1 $(pwd) ${HOME} -eu sed awk
+done grep /usr/bin 'quoted text' done done echo
+x=1 /usr/bin "$1" "$1" test $(pwd) /usr/bin then /usr/bin
+	sed test export x=1 cd local /usr/bin "$@" $(pwd) 2>/dev/null
+done "$1" test sed ${HOME} awk | /usr/bin awk test test local /usr/bin /usr/bin
+		test awk printf x=1 echo | then -eu "$@" grep ${HOME} export | export
+	local echo sed -eu $(pwd) test --verbose && && sed echo "$1" cd | awk cd 'quoted text'
+then sed | then 2>/dev/null
+	then awk test export ${HOME} grep "$@" printf $(pwd)
+export | cd ${HOME} -eu "$@" test echo local x=1
+${HOME} printf local export | awk /usr/bin --verbose
+		local awk printf awk /usr/bin 2>/dev/null
+	x=1 echo -eu local then ${HOME} -eu
+		then -eu awk && sed export -eu --verbose 'quoted text' "$@" "$1" ${HOME} "$1" grep
+	local test readonly export export
+	local $(pwd) 2>/dev/null && test "$1" ${HOME} then printf && awk "$1" -eu &&
+		'quoted text' x=1 sed test cd readonly printf test test export then sed echo
+export $(pwd) echo | printf "$1" x=1 && local | ${HOME} -eu cd $(pwd) awk echo
+local awk test printf -eu readonly cd x=1 && --verbose
+		test readonly then done readonly
+		/usr/bin done 'quoted text' awk local | cd
+	"$1" 2>/dev/null echo echo
+	-eu $(pwd) ${HOME} x=1 $(pwd) export grep ${HOME}
+		'quoted text' -eu "$@" 'quoted text' readonly awk echo export awk "$1" "$@"
+		done printf -eu local 'quoted text' cd ${HOME}
+"$@" sed "$@" then 2>/dev/null printf sed printf 2>/dev/null 'quoted text'
+	export --verbose export grep
+		export echo then /usr/bin
+echo printf -eu export then
+	&& /usr/bin local --verbose
+	echo then done && cd done sed && "$@" cd --verbose
+awk test echo awk echo /usr/bin "$@"
+	-eu export printf done then export 2>/dev/null x=1 echo "$@" 2>/dev/null --verbose
+		-eu awk ${HOME} 'quoted text'
+	grep x=1 test local sed ${HOME} -eu cd 'quoted text'
+		"$@" 'quoted text' 'quoted text' 'quoted text' -eu echo export /usr/bin
+		sed 2>/dev/null && readonly /usr/bin readonly then export |
+		then $(pwd) readonly 'quoted text' /usr/bin | $(pwd) /usr/bin --verbose test
+		&& sed awk --verbose "$@" 'quoted text'
+		cd then "$@" sed test export /usr/bin ${HOME} "$@" ${HOME}
+	test sed --verbose test printf "$@" local then then grep /usr/bin
+	${HOME} ${HOME} x=1 'quoted text' "$@" printf test
+		--verbose $(pwd) local readonly && ${HOME}
+then ${HOME} /usr/bin /usr/bin 'quoted text' awk 'quoted text' -eu && 2>/dev/null
+sed --verbose echo $(pwd) printf
+	"$@" awk cd echo sed /usr/bin 'quoted text' then --verbose
+| test cd $(pwd) /usr/bin x=1 $(pwd) sed 'quoted text' x=1
+-eu x=1 test test readonly test "$@" echo 'quoted text' $(pwd)
+		then ${HOME} echo "$1" echo $(pwd) readonly $(pwd) sed then && -eu ${HOME}
+--verbose then sed -eu 'quoted text' 2>/dev/null test "$@" $(pwd) printf |
+	&& /usr/bin printf readonly | $(pwd) awk cd
+local && export export --verbose ${HOME} x=1 -eu done
+		$(pwd) printf readonly printf cd 'quoted text' "$1" 'quoted text' echo export
+		cd ${HOME} readonly /usr/bin export export export readonly -eu awk $(pwd) ${HOME}
+	cd $(pwd) "$@" then export readonly export local
+echo local "$@" then "$1"
+test ${HOME} export ${HOME} x=1
+sed "$@" then "$1" readonly
+grep | $(pwd) readonly local --verbose sed sed printf grep sed --verbose x=1
+		${HOME} -eu x=1 && printf "$1" && | export
+	then awk -eu cd printf cd export 2>/dev/null ${HOME} test awk 2>/dev/null
+		&& done "$1" done x=1 awk export && local 2>/dev/null --verbose done
+	&& local readonly local ${HOME} export | $(pwd) readonly
+		sed export "$@" /usr/bin | local
+	test "$1" -eu awk | cd then echo | printf
+local 'quoted text' "$1" grep local
+	$(pwd) sed | done readonly "$@" 2>/dev/null
+grep cd --verbose $(pwd) readonly "$@" local "$@" "$@" sed | readonly
+		-eu then ${HOME} then sed done "$@" echo 'quoted text'
+		"$1" | -eu 2>/dev/null 2>/dev/null echo 2>/dev/null readonly cd sed cd
+readonly echo echo -eu 'quoted text' --verbose 'quoted text' cd done
+printf then awk local test && && done sed x=1 then awk then done
+/usr/bin && printf grep | x=1 readonly "$@" local
+		cd printf cd | 'quoted text'
+echo && $(pwd) local then local 'quoted text'
+		"$@" grep $(pwd) printf echo echo awk then awk awk -eu ${HOME} local -eu readonly
+		"$1" x=1 local grep 2>/dev/null local
+'quoted text' && readonly -eu --verbose done done sed
+	then export echo sed "$1" | then --verbose grep done cd
+"$1" /usr/bin export "$1" /usr/bin sed | export local &&
+cd local --verbose printf | x=1 ${HOME} $(pwd) --verbose 2>/dev/null printf --verbose
+awk 'quoted text' /usr/bin && export then export awk
+	$(pwd) -eu | printf 2>/dev/null -eu 'quoted text' | -eu awk | echo
+	done x=1 grep cd local $(pwd) ${HOME} 'quoted text'
+test --verbose x=1 2>/dev/null ${HOME} local /usr/bin
+	cd ${HOME} ${HOME} $(pwd) /usr/bin echo awk
+/usr/bin cd test -eu sed local
+		"$@" test $(pwd) "$1" cd local
+		"$1" printf --verbose awk | sed printf local 'quoted text'
+	x=1 local export test export local grep -eu
+		readonly $(pwd) echo ${HOME} local readonly
+printf "$@" "$@" awk /usr/bin
+	awk && "$1" "$@" -eu | local "$@" ${HOME} cd export "$1" local
+	done /usr/bin printf then test 'quoted text' 'quoted text'
+		cd --verbose x=1 /usr/bin -eu 2>/dev/null "$1" "$1" awk grep /usr/bin local test
+	'quoted text' && "$@" ${HOME} --verbose awk x=1 ${HOME} echo then then ${HOME}
+		2>/dev/null grep && 2>/dev/null --verbose
+		-eu && export test &&
+	test --verbose awk then awk test printf -eu x=1 2>/dev/null printf
+	local $(pwd) echo then export /usr/bin then 2>/dev/null grep grep local
+sed -eu done test grep && local then /usr/bin $(pwd) 2>/dev/null
+		then test /usr/bin --verbose x=1 'quoted text'
+	sed test done x=1 /usr/bin | $(pwd)
+		--verbose local awk $(pwd) grep --verbose printf
+		test sed export 2>/dev/null sed -eu $(pwd) echo ${HOME} | printf
+		x=1 && export export then x=1 test 2>/dev/null then then
+	"$@" 'quoted text' done /usr/bin test && "$1" -eu awk 'quoted text' local
+		--verbose $(pwd) ${HOME}
+local done 2>/dev/null cd cd 'quoted text'
+		grep x=1 readonly grep "$@" echo done 2>/dev/null $(pwd) $(pwd)
+		$(pwd) ${HOME} test -eu
+	grep -eu && sed readonly readonly 2>/dev/null echo --verbose
+grep --verbose test cd local $(pwd) cd "$@" && then awk /usr/bin --verbose
+	readonly | local printf cd ${HOME} --verbose grep grep
+	'quoted text' cd readonly -eu readonly | ${HOME} 2>/dev/null
+	printf | $(pwd) export printf
+"$@" && 'quoted text' done echo 'quoted text' printf
+-eu local --verbose $(pwd) test printf 'quoted text'
+	-eu /usr/bin /usr/bin readonly $(pwd) 2>/dev/null ${HOME} printf 'quoted text'
+		echo && test local sed x=1 | echo 'quoted text' "$@" x=1 export | /usr/bin
+export sed /usr/bin x=1 grep
+printf /usr/bin printf "$1"
+/usr/bin cd "$1" -eu 2>/dev/null -eu "$@" &&
+		"$1" done "$1" done cd ${HOME} $(pwd) "$@" $(pwd) printf printf readonly
+		echo "$1" "$@" ${HOME} x=1 "$1" 2>/dev/null
+	x=1 export export echo 'quoted text' -eu /usr/bin | "$1"
+		then local "$@" 2>/dev/null 'quoted text' local grep "$@" ${HOME}
+| "$@" "$1" x=1 sed -eu && grep then
+&& done readonly awk echo export "$1" "$1" awk awk test export
+		done 'quoted text' export /usr/bin --verbose -eu awk readonly 2>/dev/null
+	then /usr/bin 'quoted text' sed sed 'quoted text' local /usr/bin local | then test
+		cd ${HOME} printf local awk printf local x=1 local grep "$@" ${HOME} export
+		/usr/bin /usr/bin echo local grep | export echo
+	readonly 2>/dev/null test export cd local x=1 && local
+	cd && $(pwd) $(pwd) 'quoted text' && cd cd && -eu cd "$1" done
+	done export --verbose printf -eu "$@" /usr/bin --verbose
+	local done sed "$@" local "$@" "$@"
+/usr/bin test && then -eu
+$(pwd) $(pwd) sed test
+$(pwd) "$@" x=1 "$@" then /usr/bin
+${HOME} export local $(pwd) then | ${HOME} 'quoted text' cd "$1" readonly "$1"
+		awk "$1" $(pwd) "$1" cd awk cd awk
+		echo x=1 printf printf export done && printf --verbose -eu grep 'quoted text'
+"$1" export grep then test cd readonly "$1" && --verbose cd ${HOME}
+	echo && 'quoted text' --verbose "$1" /usr/bin --verbose && test /usr/bin
+	grep "$@" 'quoted text' done printf ${HOME} export x=1
+	${HOME} done done printf 'quoted text'
+		export /usr/bin local "$@" then test && && &&
+		cd echo readonly 'quoted text'
+		cd x=1 "$1" readonly printf printf
+test 2>/dev/null test x=1 printf | test echo "$@" "$1" test
+	${HOME} sed readonly --verbose
+		test 2>/dev/null "$@" export --verbose --verbose
+	readonly grep printf test export 2>/dev/null x=1 awk "$1" ${HOME} "$1" export
+	sed export x=1 cd awk grep | --verbose test 2>/dev/null export -eu | readonly
+	"$1" readonly printf done grep ${HOME} "$@" test then 'quoted text' "$1" test "$@"
+"$1" /usr/bin printf && sed grep printf done cd -eu test 2>/dev/null cd
+		-eu ${HOME} 'quoted text'
+	local $(pwd) x=1 2>/dev/null 2>/dev/null
+	then export grep export done
+		readonly done grep grep echo local local |
+		$(pwd) grep /usr/bin cd sed --verbose 'quoted text'
+	&& cd sed export done -eu
+"$@" awk /usr/bin grep test printf done $(pwd) "$@" --verbose
+	echo 2>/dev/null $(pwd) local && "$@" && echo cd readonly "$1" echo $(pwd) "$1"
+		&& test printf 'quoted text' | x=1 /usr/bin ${HOME}
+sed test x=1 done "$1" test local done --verbose done /usr/bin printf --verbose
+	grep | | awk ${HOME} 'quoted text' $(pwd) test sed && /usr/bin test done readonly
+	readonly /usr/bin echo -eu
+--verbose readonly $(pwd)
+		2>/dev/null local printf echo grep
+		$(pwd) -eu test "$1" cd export
+"$1" local printf "$@" then ${HOME} $(pwd)
+		local 'quoted text' cd "$1" 'quoted text' test
+		'quoted text' "$1" && | awk ${HOME} ${HOME} readonly
+then export ${HOME} echo test /usr/bin ${HOME} "$1" export echo | sed sed sed ${HOME}
+| grep local local $(pwd) readonly 2>/dev/null
+done sed /usr/bin x=1 $(pwd) test -eu -eu grep
+		test done done "$1" cd ${HOME} done test 2>/dev/null readonly /usr/bin
+readonly x=1 grep sed sed /usr/bin export | then /usr/bin export sed
+sed local 'quoted text' $(pwd) sed sed awk 'quoted text' ${HOME}
+	echo -eu sed -eu ${HOME} --verbose
+		$(pwd) cd grep test test test "$@" --verbose
+		awk x=1 --verbose printf local export awk "$1" echo then
+echo cd --verbose /usr/bin $(pwd) -eu echo local "$1"
+/usr/bin test export printf awk | ${HOME} export
+	sed -eu echo test x=1 cd | awk -eu export ${HOME} then "$@"
+		$(pwd) /usr/bin test local $(pwd) --verbose 'quoted text' grep
+		"$@" | "$@" test "$@" sed grep export done ${HOME} 2>/dev/null awk awk done
+		printf awk then echo cd -eu --verbose "$@" readonly sed sed then readonly $(pwd)
+	"$1" "$@" cd local export printf grep echo then
+-eu awk && test x=1 'quoted text' echo 2>/dev/null readonly "$1"
+		x=1 "$1" readonly local then awk "$@"
+		local --verbose printf done readonly export x=1 $(pwd)
+		test 'quoted text' readonly local $(pwd) | 'quoted text'
+		${HOME} | local awk local
+		sed cd then 'quoted text' export done sed
+"$1" --verbose then sed | && readonly awk "$@" "$1"
+readonly then ${HOME} && echo test 2>/dev/null
+	"$@" echo test "$1" x=1 /usr/bin | ${HOME} then done "$@" "$1" then
+		sed sed printf 'quoted text' && echo $(pwd)
+		| test sed -eu x=1 && -eu --verbose x=1 'quoted text'
+	sed --verbose && export cd printf
+	awk | --verbose /usr/bin done export /usr/bin "$1"
+grep 'quoted text' echo |
+	| then "$1" done awk export
+--verbose cd -eu readonly -eu 'quoted text'
+		x=1 readonly 2>/dev/null local 'quoted text' grep sed done printf grep cd
+		/usr/bin cd /usr/bin test $(pwd) export readonly ${HOME}
+| local local && 2>/dev/null $(pwd) ${HOME} printf done --verbose
+export export printf --verbose ${HOME} "$@" readonly
+		echo --verbose /usr/bin grep local 2>/dev/null echo sed --verbose
+		export 'quoted text' cd cd ${HOME} printf | "$1" --verbose
+	local $(pwd) echo && $(pwd) -eu ${HOME} echo ${HOME} local x=1 echo sed done
+		--verbose test x=1 "$1" --verbose
+done printf --verbose $(pwd) /usr/bin export local "$1" then
+	/usr/bin ${HOME} 2>/dev/null
+	cd sed test sed readonly grep "$1"
+awk cd -eu 2>/dev/null then --verbose ${HOME} | && --verbose 'quoted text' awk
+		awk sed /usr/bin | export "$@" ${HOME} done "$@" printf cd /usr/bin /usr/bin
+	sed "$@" x=1 grep && -eu readonly --verbose test | x=1 local | "$@" printf -eu
+		awk then done 'quoted text' export done "$@" local | echo cd | readonly
+${HOME} 2>/dev/null x=1 test done && && --verbose | /usr/bin
+		-eu test grep -eu done "$1" 2>/dev/null
+	printf awk printf export 'quoted text' sed "$1" local export ${HOME} grep
+	local $(pwd) --verbose "$1" 'quoted text' && 'quoted text' | local
+--verbose export 'quoted text' 2>/dev/null cd /usr/bin "$@" x=1
+cd readonly sed "$@" "$1" 2>/dev/null test done done cd x=1 'quoted text'
+	&& export "$@" then -eu grep readonly "$1" 2>/dev/null
+	-eu "$@" /usr/bin x=1 -eu x=1 done | readonly
+		'quoted text' && -eu 2>/dev/null grep "$@" -eu $(pwd) -eu "$@" export
+test then test /usr/bin --verbose test awk /usr/bin | local 2>/dev/null
+	export readonly done then /usr/bin
+	then readonly awk done ${HOME} 2>/dev/null
+	cd --verbose echo sed && ${HOME} | test --verbose
+		echo 2>/dev/null test -eu grep then 2>/dev/null
+		$(pwd) 'quoted text' sed --verbose /usr/bin 2>/dev/null && done | $(pwd)
+	/usr/bin readonly ${HOME} x=1 grep 2>/dev/null
+${HOME} --verbose export
+awk "$@" 'quoted text' done $(pwd) echo cd && ${HOME} --verbose ${HOME} sed |
+		&& $(pwd) "$1" -eu printf done x=1 --verbose readonly
+--verbose "$1" readonly
+	2>/dev/null then | cd |
+	--verbose | && then 'quoted text' sed
+2>/dev/null printf test done "$@" printf 2>/dev/null "$@" | then cd | readonly
+'quoted text' local readonly $(pwd) test awk test &&
+		${HOME} grep local grep 2>/dev/null
+	2>/dev/null ${HOME} echo $(pwd) && --verbose x=1 'quoted text'
+	'quoted text' grep 'quoted text' export awk 'quoted text' cd && sed --verbose printf
+done -eu && "$1" printf /usr/bin --verbose export test /usr/bin /usr/bin
+	"$@" /usr/bin local local "$@" 'quoted text' test --verbose local -eu
+&& grep -eu printf "$1" x=1 "$1" test
+		$(pwd) ${HOME} $(pwd) done ${HOME} readonly
+	export 'quoted text' grep
+'quoted text' --verbose -eu printf
+"$@" /usr/bin echo grep $(pwd) x=1 $(pwd) grep test | $(pwd) 2>/dev/null
+	"$@" "$1" export export awk 2>/dev/null
+	sed ${HOME} --verbose awk awk cd
+readonly ${HOME} then sed $(pwd) export done && "$1" awk "$1" echo && && readonly
+		/usr/bin grep $(pwd) -eu test
+cd export 'quoted text' done 'quoted text' grep echo local 2>/dev/null
+		$(pwd) --verbose readonly local echo done grep awk "$@" echo sed sed
+	"$1" 'quoted text' x=1 /usr/bin
+done -eu /usr/bin export export printf "$@" | done
+2>/dev/null sed echo --verbose "$@" awk /usr/bin
+		cd "$1" "$1" echo grep 2>/dev/null
+		-eu --verbose readonly 'quoted text' grep readonly
+		&& "$@" 'quoted text' $(pwd) --verbose
+		done done $(pwd) --verbose | export then /usr/bin -eu cd x=1 && awk
+then printf awk $(pwd) done local grep export --verbose /usr/bin
+sed ${HOME} "$@" test local -eu $(pwd) then | sed -eu 2>/dev/null
+		printf sed "$1" --verbose /usr/bin "$@" 2>/dev/null "$@" local
+	readonly echo grep 2>/dev/null awk grep ${HOME}
+		test ${HOME} /usr/bin readonly
+	printf -eu 'quoted text' export
+		x=1 done 2>/dev/null x=1 | 'quoted text' --verbose sed
+	cd /usr/bin awk 2>/dev/null "$1" && $(pwd) "$1" -eu
+"$1" "$1" readonly done ${HOME} && awk done x=1 done x=1 x=1 -eu sed then
+		local readonly && "$@" then readonly ${HOME} echo test "$@" ${HOME} then then
+'quoted text' -eu 2>/dev/null echo /usr/bin then awk 2>/dev/null sed 'quoted text'
+"$@" test --verbose --verbose $(pwd) sed && cd cd /usr/bin 'quoted text'
+		local "$@" && printf cd x=1 "$@" echo local local --verbose
+		printf --verbose local --verbose && $(pwd) local
+	grep sed --verbose done "$1" 'quoted text' readonly sed
+		then sed 'quoted text' export echo /usr/bin sed done && then -eu x=1 echo
+x=1 test x=1 cd | test -eu /usr/bin /usr/bin x=1 "$@" "$1" /usr/bin 2>/dev/null
+	echo local echo printf x=1 | grep -eu &&
+	-eu --verbose export $(pwd) | ${HOME} /usr/bin "$@" "$1" sed x=1 printf
+	grep printf printf 'quoted text' "$@" awk --verbose
+	&& printf printf grep 'quoted text' "$1" | "$1" 'quoted text' 2>/dev/null /usr/bin
+		"$@" then then "$1" awk sed local
+		cd $(pwd) "$1" "$1" awk 2>/dev/null grep test done local then test test
+		done cd done sed ${HOME} ${HOME} -eu 2>/dev/null printf cd
+		&& printf $(pwd) | done x=1
+	test "$@" | local 'quoted text' sed /usr/bin ${HOME} $(pwd)
+	readonly ${HOME} ${HOME} $(pwd) done x=1 grep && 'quoted text' grep
+"$1" cd x=1 local 2>/dev/null
+	echo cd cd 2>/dev/null sed local export ${HOME} readonly --verbose "$1" |
+	done printf "$@" x=1 $(pwd) awk $(pwd) "$1" -eu local local && export then
+	-eu echo echo printf awk 'quoted text' | ${HOME} done test -eu
+		| x=1 --verbose | sed then ${HOME}
+		cd -eu "$1" ${HOME} printf x=1 printf
+	x=1 'quoted text' sed $(pwd) ${HOME} grep
+	export then && x=1 test export --verbose cd
+		printf awk x=1 ${HOME} echo && 2>/dev/null ${HOME}
+	done test echo grep $(pwd) test then sed --verbose awk --verbose
+		readonly then sed then grep
+	done printf export | -eu /usr/bin --verbose $(pwd) 2>/dev/null
+grep export && grep --verbose ${HOME} x=1 done
+2>/dev/null awk 'quoted text' done --verbose
+${HOME} -eu echo awk 2>/dev/null /usr/bin | awk done then printf
+		-eu -eu "$@" | export 2>/dev/null
+-eu "$1" test then sed /usr/bin "$1"
+--verbose readonly && x=1 -eu printf grep "$1" awk test local "$@" 2>/dev/null
+	cd "$@" awk 'quoted text' ${HOME} --verbose 'quoted text' 'quoted text'
+	-eu export then done cd printf | -eu "$1" --verbose
+awk then cd echo then echo sed "$1" test -eu sed
+&& && 2>/dev/null printf local grep /usr/bin | cd awk "$1" readonly
+then readonly then $(pwd) "$@" /usr/bin then cd sed readonly printf
+		local export test awk echo cd sed /usr/bin export then printf 'quoted text' "$@"
+	"$1" "$@" $(pwd) 'quoted text' "$@" --verbose
+x=1 x=1 echo | "$@" x=1 2>/dev/null ${HOME} $(pwd) /usr/bin
+		x=1 grep export $(pwd) x=1 readonly sed readonly local ${HOME}
+&& 'quoted text' local
+-eu "$@" 2>/dev/null then printf $(pwd) /usr/bin
+		export "$@" $(pwd) "$1" x=1 $(pwd) grep "$@" printf readonly "$@" then test
+done awk printf echo echo test x=1 sed awk awk cd "$1" done then 2>/dev/null
+grep done "$1" && 2>/dev/null then && "$1" --verbose ${HOME}
+	local $(pwd) "$@" sed
+		test 'quoted text' export 2>/dev/null cd ${HOME} 'quoted text' | awk $(pwd) local
+		printf "$@" "$@" grep "$1"
+	grep | echo 'quoted text' ${HOME} readonly -eu grep export 2>/dev/null
+test printf echo | "$1" -eu readonly
+/usr/bin awk -eu grep then | then local done done printf 'quoted text'
+| export sed $(pwd) export sed 'quoted text'
+		--verbose done "$1" /usr/bin test $(pwd) then test cd then
+/usr/bin ${HOME} sed | export awk cd printf cd done 2>/dev/null /usr/bin && $(pwd)
+		local readonly --verbose 'quoted text' -eu
+		local export "$@" echo | --verbose export
+then --verbose printf --verbose | | "$@"
+		| local awk done --verbose cd then then grep echo
+	&& printf export awk grep $(pwd) export printf 2>/dev/null grep "$1" test
+local printf sed /usr/bin "$1" sed local | then done test awk
+	&& && /usr/bin $(pwd) done 'quoted text'
+test done $(pwd) $(pwd) | readonly
+	cd /usr/bin export sed --verbose echo sed then -eu
+2>/dev/null "$1" cd readonly local | -eu done printf 'quoted text' $(pwd)
+		$(pwd) readonly && --verbose awk -eu export local local grep sed
+${HOME} x=1 --verbose
+	2>/dev/null && local 'quoted text' $(pwd) /usr/bin $(pwd) x=1 then
+	printf awk && 2>/dev/null then x=1 "$@" ${HOME} grep awk "$@" readonly printf grep
+		grep 2>/dev/null echo printf grep grep $(pwd) cd awk grep $(pwd)
+		test local ${HOME} export export x=1 "$1" cd awk "$@" 'quoted text' local
+	2>/dev/null cd 2>/dev/null x=1
+	"$1" awk printf $(pwd) "$@" done echo | | 2>/dev/null done export "$1"
+export 'quoted text' $(pwd) done then | "$1"
+		x=1 awk "$1" sed "$@" 'quoted text' printf readonly
+'quoted text' echo export awk grep $(pwd)
+&& $(pwd) awk $(pwd) printf export x=1 && printf readonly then | 2>/dev/null
+		2>/dev/null test x=1 export
+"$@" --verbose awk && ${HOME} readonly cd test 'quoted text'
+		done ${HOME} export 2>/dev/null
+"$@" done && local local export | sed && awk sed ${HOME} done ${HOME} test test
+		--verbose ${HOME} $(pwd) $(pwd) -eu $(pwd)
+	'quoted text' readonly
+	grep /usr/bin then cd printf 2>/dev/null "$1" export sed readonly
+		/usr/bin $(pwd) -eu | export awk ${HOME} --verbose --verbose
+		test export 2>/dev/null ${HOME} /usr/bin awk echo then ${HOME} -eu
+printf export $(pwd) $(pwd) 'quoted text' -eu "$@" $(pwd) |
+echo export ${HOME} /usr/bin -eu printf 2>/dev/null -eu export cd test
+	then 'quoted text' then awk | echo then awk
+	x=1 -eu test then cd cd echo -eu
+	test readonly "$@" local
+		test 2>/dev/null $(pwd) cd local x=1 -eu printf
+	grep printf done sed && printf -eu -eu x=1 printf $(pwd) sed
+		--verbose "$1" "$@" x=1 "$@" awk sed 'quoted text'
+x=1 ${HOME} 2>/dev/null 'quoted text' local
+	test 2>/dev/null && local $(pwd) test then export
+	awk done cd grep grep printf done then 2>/dev/null
+	awk 'quoted text' -eu readonly 'quoted text' /usr/bin | ${HOME} |
+printf awk | sed test grep x=1 grep x=1 "$@" 2>/dev/null "$@"
+	x=1 $(pwd) readonly printf
+	awk then printf export readonly 2>/dev/null ${HOME} x=1 printf --verbose
+		"$@" | $(pwd) | -eu export
+	| | -eu ${HOME} "$1" awk 2>/dev/null local
+	export /usr/bin "$@" "$@"
+	export printf then done then test x=1 cd x=1 2>/dev/null cd --verbose grep /usr/bin
+		export printf -eu && --verbose echo -eu && awk
+		2>/dev/null 'quoted text' local done printf awk 'quoted text'
+"$@" 2>/dev/null then | 2>/dev/null --verbose "$1" local test $(pwd) --verbose
+echo echo local echo grep x=1 sed | 'quoted text' 2>/dev/null
+		-eu "$1" local && test printf test
+	$(pwd) export "$1" /usr/bin
+		echo | "$@" export && && 2>/dev/null "$@" "$1" done
+export 2>/dev/null sed | export readonly -eu local awk sed 2>/dev/null
+cd -eu export "$@" 'quoted text' --verbose test then test
+	"$1" awk printf --verbose readonly
+done --verbose -eu $(pwd) sed
+		readonly 'quoted text' | test sed done 'quoted text' local 'quoted text'
+		then export "$1" test x=1
+"$@" --verbose awk && 2>/dev/null && /usr/bin 2>/dev/null &&
+	| 2>/dev/null readonly export
+		sed test | -eu /usr/bin "$@" cd ${HOME} readonly $(pwd) readonly
+	x=1 then && /usr/bin /usr/bin done local grep grep test local readonly
+	"$1" sed | -eu -eu x=1 -eu
+	'quoted text' printf echo readonly
+x=1 awk cd 2>/dev/null cd --verbose
+	$(pwd) then awk 2>/dev/null
+/usr/bin done echo grep local 'quoted text' /usr/bin ${HOME} then
+		echo awk done printf readonly "$1" done then "$1" --verbose /usr/bin cd
+	x=1 /usr/bin 'quoted text' cd /usr/bin 'quoted text' then 'quoted text'
+local 2>/dev/null printf awk && then sed
+	done cd --verbose | then export
+		| cd readonly $(pwd) readonly readonly --verbose echo "$@"
+local 'quoted text' grep
+		| printf -eu /usr/bin
+--verbose && cd awk then awk 2>/dev/null "$@" ${HOME} local | ${HOME} grep
+		-eu | done | cd ${HOME} echo --verbose grep printf done x=1 2>/dev/null printf
+	sed then "$@" readonly "$@" cd 'quoted text' -eu 'quoted text' 'quoted text'
+		"$1" $(pwd) 2>/dev/null "$1" "$1" awk readonly
+$(pwd) readonly -eu readonly grep "$1" readonly then
+	grep echo ${HOME} then sed -eu sed printf 2>/dev/null
+	printf x=1 echo x=1 x=1 test --verbose test test -eu cd done 2>/dev/null "$@" /usr/bin
+		done local export local export readonly
+readonly test test | awk readonly ${HOME} printf "$@" test --verbose then readonly
+		done sed readonly echo test x=1 grep --verbose
+$(pwd) $(pwd) grep 'quoted text' export --verbose grep readonly "$@"
+		&& $(pwd) --verbose cd 'quoted text' x=1 grep cd
+2>/dev/null grep --verbose ${HOME} printf awk printf grep test cd && ${HOME}
+	$(pwd) export export | cd echo 'quoted text' | 'quoted text' test 2>/dev/null
+		sed /usr/bin sed printf readonly
+	2>/dev/null /usr/bin "$@" | ${HOME}
+/usr/bin export echo 2>/dev/null sed local "$1"
+	export -eu cd readonly test grep 2>/dev/null printf done x=1 'quoted text'
+	cd test --verbose test test 'quoted text' /usr/bin
+'quoted text' sed echo test "$@" sed grep echo && export
+local "$1" local cd local $(pwd) grep "$@" then
+	"$1" awk cd --verbose printf 2>/dev/null --verbose x=1 2>/dev/null grep
+	"$1" printf export /usr/bin echo && readonly
+	cd awk done $(pwd) printf | test export test
+grep done sed export echo 2>/dev/null printf 'quoted text'
+"$1" local then done
+	| x=1 readonly echo && cd done echo ${HOME} /usr/bin "$1" 2>/dev/null
+		| 'quoted text' ${HOME} test echo test "$@" "$1"
+	local echo /usr/bin && 'quoted text' echo /usr/bin
+	'quoted text' && then && awk x=1 then printf "$1" done sed -eu && x=1 && --verbose
+	done sed ${HOME} grep grep --verbose 'quoted text' readonly
+		readonly awk grep ${HOME} | grep | | ${HOME} then --verbose "$1" 'quoted text'
+		&& echo export printf $(pwd) printf sed
+done test readonly --verbose
+	2>/dev/null ${HOME} ${HOME} export test 'quoted text' && $(pwd) ${HOME} export
+	"$@" cd /usr/bin 'quoted text' && ${HOME} x=1 readonly sed grep
+		-eu --verbose | awk done done
+		&& x=1 'quoted text' local 'quoted text' 2>/dev/null /usr/bin test
+		--verbose "$@" echo echo cd 2>/dev/null local local "$@" "$1"
+	cd 'quoted text' | 'quoted text'
+echo test done readonly "$1" ${HOME}
+	printf $(pwd) ${HOME} "$@" cd sed awk 2>/dev/null | printf /usr/bin grep && 'quoted text'
+done echo 2>/dev/null sed 'quoted text' "$@" "$@" local x=1
+'quoted text' readonly --verbose awk echo
+	readonly --verbose --verbose awk /usr/bin
+		grep local export local grep echo 2>/dev/null
+cd "$1" 'quoted text' then local ${HOME} sed then
+	'quoted text' local 'quoted text'
+		local "$@" "$@" --verbose
+	${HOME} sed -eu | "$1" "$@" && readonly 2>/dev/null && "$1"
+	$(pwd) test -eu awk readonly $(pwd) echo grep x=1
+	readonly "$1" grep sed x=1 $(pwd) "$@"
+	export sed -eu x=1 && awk x=1 awk /usr/bin --verbose
+	test | cd done then local | "$@" echo test ${HOME} 'quoted text'
+		"$1" then export local export $(pwd) "$@" x=1 'quoted text' 'quoted text' test
+	done "$1" then "$@" 'quoted text' "$@" echo cd sed | | printf /usr/bin "$@"
+		--verbose -eu local 'quoted text' then awk -eu then awk 2>/dev/null
+	&& done grep readonly test
+		${HOME} grep sed | printf cd -eu test "$1" "$@" --verbose && "$1" test local --verbose
+&& test "$1" cd /usr/bin test
+export --verbose ${HOME} /usr/bin cd /usr/bin "$@" local printf export printf cd
+sed grep && awk then "$@" 2>/dev/null local
+-eu sed test "$@" readonly readonly 2>/dev/null readonly local test
+		then 2>/dev/null 'quoted text' -eu -eu
+readonly 2>/dev/null awk ${HOME} printf local readonly --verbose | | | | 'quoted text'
+	test cd $(pwd) | --verbose sed export x=1 $(pwd) | readonly local
+		done /usr/bin --verbose
+sed $(pwd) | grep grep
+		x=1 'quoted text' test ${HOME} && test done | -eu && "$1" echo sed --verbose
+readonly test 'quoted text'
+local test cd "$1" --verbose
+		&& sed readonly x=1 --verbose test sed echo --verbose grep $(pwd)
+	grep grep --verbose "$@"
+	done echo local printf cd sed
+"$1" export then grep readonly
+		grep grep 'quoted text' | x=1 echo echo readonly
+local then readonly awk local 2>/dev/null grep $(pwd) export
+		--verbose sed export done awk done echo "$1" done 'quoted text'
+		'quoted text' printf -eu x=1 --verbose -eu --verbose readonly -eu $(pwd)
+		x=1 'quoted text' done x=1 && printf printf
+	x=1 && -eu echo awk x=1 then done local "$1" "$@" export test "$1" grep |
+${HOME} /usr/bin /usr/bin
+		printf readonly export printf
+cd cd | x=1 printf "$@" x=1 readonly
+		sed then readonly x=1 grep export test x=1 -eu
+		$(pwd) --verbose x=1 local 'quoted text'
+		${HOME} cd awk "$1" local --verbose /usr/bin local 2>/dev/null 'quoted text'
+		--verbose "$@" "$1" "$1" "$1"
+&& 2>/dev/null grep done -eu cd done grep readonly
+	cd | sed then "$1" sed ${HOME} cd "$@" --verbose
+	'quoted text' export $(pwd) --verbose sed grep /usr/bin --verbose
+		/usr/bin export ${HOME} cd x=1 "$1" "$@" ${HOME} export "$@" -eu done 2>/dev/null
+readonly export "$1" /usr/bin then | sed 'quoted text' /usr/bin "$1" test
+		'quoted text' /usr/bin "$1" readonly "$1"
+	-eu awk cd -eu --verbose | && x=1 "$1" then x=1 $(pwd)
+local printf export 'quoted text' local ${HOME} readonly $(pwd) local "$1"
+		"$@" x=1 -eu -eu "$1" $(pwd) test local
+	${HOME} done /usr/bin $(pwd) -eu 'quoted text' --verbose export /usr/bin
+echo /usr/bin printf "$1" "$@"
+$(pwd) "$@" local local local local "$1" | "$@" 'quoted text' ${HOME} sed ${HOME}
+		readonly | echo && readonly 2>/dev/null --verbose echo grep
+/usr/bin $(pwd) /usr/bin "$@" $(pwd) grep awk 2>/dev/null
+cd ${HOME} | "$1" -eu awk "$1" --verbose
+then "$1" ${HOME} readonly | ${HOME} echo local /usr/bin x=1 export
+	x=1 export echo printf echo done "$1" then
+"$1" sed cd test grep sed $(pwd) && --verbose sed echo echo --verbose 'quoted text'
+--verbose ${HOME} ${HOME} printf test echo cd "$@" $(pwd) cd -eu /usr/bin "$@"
+	x=1 done cd "$@" then grep && echo
+	then done -eu cd 'quoted text' echo "$@" ${HOME}
+/usr/bin local $(pwd) /usr/bin "$1" then $(pwd)
+		awk ${HOME} "$@" readonly
+	${HOME} "$@" printf awk
+		'quoted text' local awk "$@" echo 'quoted text' x=1 export grep ${HOME} sed
+	&& test ${HOME} -eu test test local
+grep local printf test | 2>/dev/null export export -eu test done -eu export awk
+		test 2>/dev/null /usr/bin test ${HOME} grep
+	${HOME} "$1" grep -eu local readonly readonly
+$(pwd) ${HOME} printf readonly |
+	/usr/bin export | local -eu | "$1" x=1 "$1" awk export awk awk $(pwd) x=1
+export --verbose test readonly "$@" awk "$1" x=1 test | 2>/dev/null sed
+$(pwd) /usr/bin awk test echo cd done echo 2>/dev/null "$@" x=1 "$@" test "$@"
+	grep cd && && echo grep cd
+		| "$1" then sed "$1" 'quoted text' "$@" /usr/bin awk
+readonly 2>/dev/null cd sed readonly awk 2>/dev/null x=1 "$@" -eu printf -eu
+		cd -eu cd --verbose awk $(pwd) echo local printf done test grep export $(pwd)
+		export && grep then test ${HOME} printf x=1 --verbose printf -eu 2>/dev/null
+	readonly /usr/bin 'quoted text' /usr/bin awk | grep export cd ${HOME}
+		readonly export -eu done x=1
+		2>/dev/null | export awk test 'quoted text' $(pwd)
+	--verbose | /usr/bin ${HOME} export local readonly local sed echo && 2>/dev/null
+	-eu 'quoted text' sed 'quoted text' 2>/dev/null printf
+		test then echo then x=1 && test $(pwd) 'quoted text' "$1" printf ${HOME}
+	"$1" /usr/bin /usr/bin
+readonly x=1 then readonly 'quoted text' export
+printf test --verbose
+	local $(pwd) cd | 'quoted text' /usr/bin
+export cd "$@" --verbose -eu cd sed local then grep cd printf
+		2>/dev/null && 'quoted text' readonly
+		| grep export local printf then | test $(pwd) "$1" readonly | then
+--verbose local export $(pwd) | "$@" ${HOME}
+	2>/dev/null ${HOME} then export --verbose
+	done sed then "$@" awk 2>/dev/null printf echo echo done "$@" 2>/dev/null then
+| done ${HOME} "$@" grep | 2>/dev/null sed "$1"
+cd /usr/bin 'quoted text' && echo echo "$1" --verbose x=1 echo --verbose
+		&& sed | local 'quoted text' export
+	test "$@" then && 'quoted text'
+	readonly $(pwd) /usr/bin | x=1 test local "$@" ${HOME} done
+		--verbose | 'quoted text' then x=1 cd $(pwd) 2>/dev/null
+	'quoted text' && "$@" export -eu "$1" "$@" echo /usr/bin | echo printf
+	printf 'quoted text' done --verbose awk printf printf grep && grep readonly
+then && printf "$1" --verbose export test "$1" sed && awk
+	cd cd --verbose readonly done test export echo --verbose 'quoted text' test cd
+		printf then local | export then then readonly
+	grep grep echo awk 'quoted text' $(pwd) done grep 2>/dev/null grep cd
+	cd export local && sed --verbose 'quoted text' test test echo done readonly x=1
+		| --verbose && ${HOME} printf readonly printf ${HOME} echo
+	local $(pwd) "$1" | ${HOME} readonly "$1" export 2>/dev/null
+echo echo /usr/bin | echo local "$@" test 2>/dev/null local 'quoted text'
+		grep echo cd done cd cd readonly | readonly echo && 2>/dev/null readonly
+${HOME} done --verbose "$1" 'quoted text'
+grep awk echo cd done cd local local $(pwd) "$@" awk --verbose
+"$1" awk printf "$@" printf /usr/bin local
+		local grep x=1 /usr/bin local grep | | done --verbose /usr/bin test
+		--verbose sed grep --verbose export test 'quoted text' awk export | 'quoted text'
+/usr/bin local echo awk 2>/dev/null readonly echo --verbose ${HOME} awk
+"$@" test readonly x=1 2>/dev/null -eu then export x=1 "$@" test "$@" /usr/bin
+	2>/dev/null cd ${HOME} x=1 printf
+		export done /usr/bin --verbose | awk
+		&& then grep /usr/bin export grep
+	readonly cd | export readonly then "$@" x=1 cd done done echo printf ${HOME} x=1
+	| export x=1 export && "$1" cd --verbose --verbose sed grep printf sed local cd
+	'quoted text' local --verbose local done "$1" local export done test 2>/dev/null
+	"$1" "$@" echo awk && $(pwd) /usr/bin readonly awk "$@" && 2>/dev/null
+		cd echo export x=1 && awk grep "$1" readonly "$@" done
+| local grep cd | x=1 cd "$@" /usr/bin "$1" then /usr/bin readonly
+readonly "$1" then local -eu grep echo then
+	"$1" x=1 2>/dev/null grep /usr/bin /usr/bin $(pwd) echo
+	| "$@" --verbose 2>/dev/null cd then done echo
+		done local $(pwd) readonly echo 'quoted text' --verbose /usr/bin ${HOME}
+		export sed "$1" x=1 test done echo cd 'quoted text'
+-eu 2>/dev/null 'quoted text' | echo test printf
+		/usr/bin sed readonly x=1 x=1 grep awk sed then grep | -eu | ${HOME} readonly
+	grep test test done sed echo | local ${HOME} --verbose
+	&& "$@" "$1" readonly local printf ${HOME} grep echo --verbose
+	$(pwd) then test 'quoted text'
+		${HOME} done | -eu | | printf readonly grep cd 'quoted text'
+| | x=1 'quoted text' export ${HOME} "$1" printf sed grep -eu grep
+		done 'quoted text' "$@" ${HOME} 'quoted text' x=1 test | then ${HOME}
+		/usr/bin ${HOME} sed -eu "$1" printf -eu local test x=1 readonly
+	awk test $(pwd) export 2>/dev/null 'quoted text'
+	x=1 done sed 2>/dev/null export
+	local export printf then grep --verbose /usr/bin | 2>/dev/null
+2>/dev/null cd local --verbose grep --verbose && test 2>/dev/null
+'quoted text' printf sed x=1 local printf readonly
+-eu "$@" done printf "$@"
+		$(pwd) echo | --verbose
+echo --verbose x=1 export /usr/bin readonly
+		cd --verbose && 'quoted text' -eu echo | 'quoted text' $(pwd) readonly | "$1"
+echo cd && x=1 2>/dev/null printf awk
+	readonly printf readonly x=1 ${HOME} 'quoted text'
+		"$1" /usr/bin --verbose | && -eu readonly
+2>/dev/null local ${HOME} local done printf
+| 2>/dev/null readonly awk printf readonly sed x=1 | sed | --verbose
+	then "$@" x=1 printf test "$@" export --verbose
+	$(pwd) local "$@" && $(pwd)
+		x=1 "$@" then "$1" sed echo | -eu --verbose "$@" --verbose /usr/bin grep
+	| sed 2>/dev/null awk awk -eu readonly local
+readonly /usr/bin awk printf ${HOME} echo
+test export cd "$1" sed export
+	'quoted text' | ${HOME} /usr/bin --verbose then | grep -eu then printf
+x=1 2>/dev/null readonly printf
+done 'quoted text' "$1" && awk && done -eu /usr/bin
+		sed printf | local 2>/dev/null
+--verbose "$@" local export
+	sed printf test x=1 grep x=1 export 2>/dev/null readonly
+	then then --verbose done -eu 'quoted text' cd grep sed
+then awk test then $(pwd) printf printf export
+	then then && --verbose "$1" 'quoted text'
+		done local local --verbose $(pwd) readonly ${HOME} awk
+		--verbose printf readonly sed $(pwd) 'quoted text' cd $(pwd) test --verbose
+		"$1" -eu cd "$1" test grep
+/usr/bin grep x=1 test /usr/bin printf -eu echo
+export 2>/dev/null /usr/bin echo awk "$1" local
+		--verbose local sed ${HOME} ${HOME} sed sed cd sed --verbose cd export sed
+$(pwd) 'quoted text' done readonly ${HOME} grep then &&
+	awk cd grep 'quoted text' --verbose
+		awk 2>/dev/null x=1 2>/dev/null grep printf awk
+"$@" readonly "$1" | | |
+		"$1" "$@" echo $(pwd) done test | ${HOME}
+"$@" export then sed "$1" "$1" then && /usr/bin
+	${HOME} readonly 'quoted text' done
+	done done export 2>/dev/null
+		export && -eu local --verbose readonly done "$1" && 2>/dev/null "$@" export
+	sed ${HOME} then sed cd test $(pwd) printf 'quoted text' "$1" x=1 2>/dev/null
+		cd test test /usr/bin readonly then cd $(pwd) echo ${HOME} then
+awk local -eu x=1 2>/dev/null --verbose $(pwd)
+echo /usr/bin done "$@" ${HOME} export
+--verbose 2>/dev/null readonly cd awk 2>/dev/null /usr/bin ${HOME}
+		--verbose 2>/dev/null -eu $(pwd) cd readonly sed ${HOME} awk
+readonly then x=1 && /usr/bin "$1" 2>/dev/null 'quoted text'
+then -eu export test printf "$@" $(pwd) cd x=1 --verbose "$@" ${HOME} && grep awk
+	'quoted text' "$1" 'quoted text' && test
+grep -eu awk -eu cd && "$@" -eu export $(pwd) ${HOME}
+	echo x=1 "$1" local "$1"
+		x=1 echo readonly printf --verbose printf local 'quoted text' printf | 'quoted text'
+2>/dev/null awk local && ${HOME}
+awk -eu --verbose && then
+		${HOME} /usr/bin ${HOME} then | test --verbose
+	${HOME} export && cd | printf
+test cd export | x=1 x=1 readonly 2>/dev/null printf | export export
+		printf ${HOME} then cd echo $(pwd) export cd export 'quoted text' grep
+$(pwd) ${HOME} $(pwd) local export
+		| /usr/bin test echo test grep && -eu awk printf ${HOME} "$1"
+	| | then "$@" export local done done "$1" 2>/dev/null
+echo && -eu sed "$@" $(pwd) /usr/bin
+"$@" local | grep x=1 awk grep $(pwd) 'quoted text'
+done then --verbose then /usr/bin | /usr/bin sed test cd /usr/bin 2>/dev/null
+	${HOME} -eu done echo |
+"$1" export -eu && echo test readonly test sed
+$(pwd) --verbose local "$@" export -eu | "$1"
+		${HOME} done awk printf awk
+		test then x=1 export export then export done
+	cd 'quoted text' grep echo /usr/bin cd done "$1" "$1" awk
+		| local export "$1" x=1 export 2>/dev/null test local x=1 $(pwd) 'quoted text'
+&& 'quoted text' $(pwd) "$@" test --verbose test test cd grep awk printf
+	sed "$1" "$1" local ${HOME} ${HOME} | done local 'quoted text'
+	then printf "$@" cd -eu -eu "$@" | "$1" readonly 2>/dev/null
+	export cd sed printf sed
+	grep x=1 local printf printf $(pwd)
+	'quoted text' 'quoted text'
+readonly echo "$@" 'quoted text'
+| && | test /usr/bin x=1 awk local awk /usr/bin
+	&& 2>/dev/null readonly grep printf cd then done
+		&& ${HOME} --verbose echo | then then echo done
+readonly "$1" x=1 cd done --verbose awk 2>/dev/null sed test x=1 "$1" test
+	then echo --verbose printf -eu grep then $(pwd) | then -eu grep export ${HOME}
+	&& test | $(pwd) echo "$1" local $(pwd) export /usr/bin readonly
+	then cd "$1" "$@" echo -eu printf 'quoted text' printf
+"$1" grep printf done $(pwd) 2>/dev/null test --verbose && -eu
+2>/dev/null export awk
+awk echo export awk | awk
+		/usr/bin 2>/dev/null $(pwd) ${HOME} awk /usr/bin x=1 "$1" 'quoted text' done "$@"
+		sed --verbose grep sed "$@" export done then x=1 'quoted text'
+	readonly 'quoted text' local sed "$@" cd "$1" x=1 --verbose
+	done readonly export --verbose test --verbose | export -eu && grep
+/usr/bin "$@" "$1" $(pwd) x=1 printf
+		$(pwd) && cd /usr/bin 'quoted text' "$1" --verbose "$1" -eu -eu cd test cd $(pwd)
+then grep cd printf --verbose
+	"$1" awk export 'quoted text' --verbose printf "$@" | ${HOME} readonly
+	2>/dev/null && readonly x=1 sed readonly ${HOME} "$1" 'quoted text'
+		awk printf awk "$@" grep -eu sed printf --verbose
+	/usr/bin "$1" export printf readonly "$1" $(pwd) awk "$1" cd sed x=1 x=1
+test printf local local local test local 'quoted text' x=1 then
+"$1" cd echo --verbose
+readonly echo local ${HOME} test export local test sed cd printf
+		export done echo | awk "$@" "$1" -eu "$1" test readonly "$1" printf
+		'quoted text' printf grep printf cd 'quoted text' | $(pwd) sed sed
+		sed -eu awk readonly | ${HOME} awk
+"$@" --verbose && local echo echo
+	| /usr/bin then -eu ${HOME}
+		cd 'quoted text' grep 'quoted text' readonly sed $(pwd) grep
+	local sed grep then 2>/dev/null readonly
+sed 2>/dev/null 2>/dev/null readonly "$@"
+| export sed "$@" awk |
+		&& | then x=1 done export echo echo printf printf test 'quoted text'
+		export export awk test 'quoted text' grep &&
+&& ${HOME} test then "$1" awk && echo export test 2>/dev/null printf
+awk -eu $(pwd) done local test "$1" grep --verbose -eu
+	"$@" | --verbose "$1" then sed cd local
+	echo "$1" grep test then
+		--verbose export /usr/bin grep readonly ${HOME} | export --verbose
+		then --verbose echo cd echo 'quoted text' x=1 echo done readonly | /usr/bin x=1
+then printf "$1" 2>/dev/null sed echo awk
+	"$1" printf 'quoted text' readonly x=1 readonly 'quoted text' grep x=1 --verbose
+printf test cd local test echo readonly then ${HOME} && printf
+	2>/dev/null export done export x=1 "$1" grep 2>/dev/null echo readonly "$1" grep
+		$(pwd) | ${HOME} then sed cd x=1 "$1" done awk done /usr/bin
+		${HOME} && done printf cd x=1 readonly
+	export sed x=1 test x=1 $(pwd) local /usr/bin grep && readonly
+sed sed awk local /usr/bin sed --verbose cd echo -eu done grep
+	-eu 'quoted text' ${HOME} cd "$@" echo then && printf awk x=1 grep readonly $(pwd)
+/usr/bin export "$@" export echo printf && "$1" && grep echo awk
+&& --verbose printf | $(pwd) then echo export grep readonly
+local /usr/bin 2>/dev/null --verbose | test echo "$@" "$1" done $(pwd) readonly
+	printf readonly /usr/bin test --verbose -eu readonly
+		"$@" /usr/bin "$1" "$@" "$1" export local grep done
+		&& grep 2>/dev/null x=1 readonly printf printf --verbose
+	"$@" readonly $(pwd) then done done sed test
+x=1 x=1 /usr/bin /usr/bin x=1 'quoted text' test printf cd && "$@" echo --verbose
+		&& "$@" | sed ${HOME} ${HOME} "$1" ${HOME} "$1" --verbose awk grep
+	x=1 | | grep local grep export echo printf && "$@" -eu --verbose --verbose awk
+	printf ${HOME} /usr/bin grep --verbose test
+readonly cd export local /usr/bin 'quoted text' $(pwd) done -eu
+		test "$1" sed local cd cd done -eu $(pwd) "$1" x=1 ${HOME} grep
+		export | && test then 2>/dev/null
+'quoted text' sed export "$@" $(pwd) /usr/bin done && cd ${HOME} ${HOME} echo grep
+local sed 2>/dev/null echo export &&
+	then readonly then done $(pwd) --verbose printf local "$@" cd awk
+		printf && readonly readonly x=1 $(pwd) | readonly "$@" echo
+grep cd x=1 echo /usr/bin
+'quoted text' 2>/dev/null "$1" done && done test
+		'quoted text' 2>/dev/null readonly printf "$1" 2>/dev/null
+	| echo export grep && readonly
+	| awk $(pwd) -eu | readonly $(pwd) | sed local readonly local --verbose
+	/usr/bin sed awk x=1 test test export test echo cd /usr/bin awk $(pwd)
+"$@" && "$@" "$@" x=1 -eu "$1" done export
+	'quoted text' done /usr/bin x=1 /usr/bin
+	grep awk echo export export awk local $(pwd) grep
+		export cd --verbose printf --verbose ${HOME} --verbose 'quoted text'
+	/usr/bin then | | x=1 -eu
+--verbose echo local 'quoted text' local grep $(pwd) sed --verbose then
+x=1 printf test awk done "$@" x=1 echo readonly --verbose grep -eu 2>/dev/null
+		x=1 test export /usr/bin export --verbose 'quoted text' readonly --verbose
+$(pwd) -eu awk cd ${HOME} 'quoted text' done ${HOME} --verbose test printf
+	then test awk test cd "$@" -eu -eu readonly sed /usr/bin
+		"$1" && printf printf echo
+	$(pwd) | | export sed cd
+2>/dev/null test && "$1" "$1" "$@" cd echo 2>/dev/null
+readonly --verbose && | printf then 'quoted text' done $(pwd) /usr/bin
+		${HOME} cd ${HOME} -eu test --verbose cd printf
+	| 'quoted text' --verbose "$1" ${HOME} then
+2>/dev/null done "$1" readonly awk | done printf sed && test /usr/bin /usr/bin -eu
+sed printf "$@" "$@" 'quoted text' local
+	echo sed "$@" 2>/dev/null done grep export
+awk local test then "$@"
+		awk "$@" x=1 x=1 done x=1 grep && $(pwd) 2>/dev/null
+		grep sed $(pwd) echo printf awk x=1 'quoted text' echo
+	2>/dev/null done | "$@" "$@" export "$1" echo
+2>/dev/null $(pwd) then readonly /usr/bin
+| echo -eu export grep --verbose cd | export done
+		test readonly $(pwd) ${HOME} test export
+		$(pwd) | /usr/bin 'quoted text'
+"$1" && printf | | then --verbose readonly readonly
+	x=1 grep ${HOME} grep $(pwd) readonly
+		-eu then grep 'quoted text' grep echo readonly && x=1
+		${HOME} -eu "$1" && test && test sed export "$@" 'quoted text' x=1
+done /usr/bin done "$@" $(pwd) /usr/bin local "$1" "$@" printf then grep && then
+		then printf -eu /usr/bin
+	$(pwd) awk "$@" echo printf "$1" 2>/dev/null x=1 sed printf then x=1 --verbose
+	printf local cd done && export -eu printf $(pwd) echo
+	"$1" export echo ${HOME} cd --verbose readonly "$@" done "$1" awk test
+--verbose printf 'quoted text' sed then test x=1 test readonly
+	$(pwd) cd cd && -eu cd awk printf export -eu --verbose then grep 'quoted text'
+	| cd "$@" test x=1 ${HOME} $(pwd) sed 2>/dev/null sed echo awk 'quoted text'
+	2>/dev/null "$@" x=1 "$@" printf printf $(pwd) 2>/dev/null -eu
+		2>/dev/null test | ${HOME} 2>/dev/null
+	export test | /usr/bin && echo /usr/bin 'quoted text' grep
+/usr/bin ${HOME} $(pwd) awk echo readonly "$@" "$@" 'quoted text' ${HOME} 2>/dev/null
+		| "$@" && /usr/bin cd printf
+readonly printf 2>/dev/null test 'quoted text'
+		--verbose export "$1" "$1" then grep export
+	readonly --verbose 2>/dev/null -eu cd local "$@" -eu export
+printf --verbose && "$1" export 'quoted text' "$@"
+	printf echo -eu cd "$1" ${HOME} "$@"
+	"$1" ${HOME} export readonly readonly -eu readonly cd ${HOME} --verbose done
+${HOME} sed local then test printf ${HOME} && done 2>/dev/null printf
+sed && echo --verbose test "$@" "$@"
+		x=1 --verbose printf printf "$@" test cd
+--verbose -eu -eu 'quoted text' ${HOME} readonly 'quoted text' -eu
+printf "$1" echo awk "$@" export && 2>/dev/null
+test && --verbose | printf sed | printf then echo ${HOME}
+echo done | 'quoted text' "$1" then readonly "$1"
+	done echo echo export
+		then export $(pwd) ${HOME} printf ${HOME}
+-eu echo then printf /usr/bin "$1" sed --verbose $(pwd) ${HOME} "$1"
+&& test test $(pwd) "$@"
+x=1 x=1 x=1 echo "$1" echo /usr/bin 2>/dev/null
+	cd --verbose done awk --verbose done && cd /usr/bin /usr/bin "$@" local
+awk $(pwd) --verbose "$1" awk cd local awk /usr/bin
+	done test grep readonly cd printf
+-eu local readonly cd printf done export done grep printf
+| ${HOME} echo done test -eu x=1 | done export
+	awk 'quoted text' echo local 2>/dev/null
+		2>/dev/null /usr/bin --verbose sed 2>/dev/null grep test echo local
+--verbose printf export grep export
+		"$1" && "$@" "$@" echo test echo x=1 --verbose readonly --verbose awk export
+test -eu "$1" -eu echo readonly then /usr/bin "$@" "$@" /usr/bin
+		"$@" /usr/bin -eu export "$1" test printf sed
+	then export 'quoted text' printf "$1" && local x=1 test
+		local done /usr/bin awk --verbose sed sed sed "$1" done && readonly test echo
+		&& /usr/bin --verbose cd done done -eu /usr/bin then cd "$1" echo $(pwd) readonly
+${HOME} readonly awk printf done && then done awk
+	awk readonly && grep 2>/dev/null readonly -eu x=1 local && readonly export
+		$(pwd) -eu 2>/dev/null 'quoted text'
+		readonly test grep awk sed | x=1 2>/dev/null
+	local export local then readonly grep printf test
+		readonly test x=1 && 2>/dev/null | sed x=1
+		cd --verbose sed printf | /usr/bin echo ${HOME} local /usr/bin --verbose
+		sed "$@" grep awk printf /usr/bin "$1" /usr/bin /usr/bin 2>/dev/null then
+		done | grep cd && 'quoted text' 2>/dev/null cd done x=1 printf
+	${HOME} "$1" && ${HOME} sed cd echo local sed local
+awk --verbose "$@" cd then local
+		printf cd $(pwd) $(pwd)
+readonly | echo "$@" 'quoted text' ${HOME} cd
+		/usr/bin printf x=1 --verbose
+export awk echo awk echo cd grep printf --verbose "$1" -eu sed /usr/bin /usr/bin
+		"$@" local --verbose then sed 'quoted text' ${HOME} $(pwd) sed --verbose
+then printf cd cd | then "$1" readonly x=1 --verbose
+		-eu /usr/bin export printf grep ${HOME} awk readonly awk x=1 sed readonly
+-eu | echo 2>/dev/null 2>/dev/null done printf
+		&& --verbose cd $(pwd) "$1" x=1 cd "$@" printf
+echo && 'quoted text' readonly $(pwd) ${HOME} awk ${HOME}
+	done echo grep | && | 2>/dev/null && readonly awk
+		"$1" export --verbose
+		| done | grep x=1 ${HOME} 2>/dev/null 'quoted text'
+		"$@" grep $(pwd) $(pwd) "$@" --verbose | /usr/bin then awk 'quoted text'
+		x=1 export /usr/bin x=1 echo echo readonly /usr/bin export cd 'quoted text'
+		/usr/bin 'quoted text' "$@" done printf readonly
+	"$@" ${HOME} && --verbose "$@" --verbose && awk 'quoted text'
+		x=1 ${HOME} then $(pwd) echo ${HOME} done 'quoted text' echo test
+	grep sed $(pwd) readonly test "$1" "$1" printf local "$@" "$@" | test 'quoted text'
+		test 'quoted text' local 'quoted text'
+cd --verbose sed sed ${HOME} sed $(pwd) test local test "$1" "$@"
+then local readonly printf && echo /usr/bin ${HOME}
+	$(pwd) awk $(pwd) && /usr/bin sed awk
+"$1" cd --verbose x=1 echo echo grep 2>/dev/null
+/usr/bin printf grep "$@" && test sed /usr/bin -eu --verbose ${HOME}
+	then awk --verbose -eu done /usr/bin echo 'quoted text'
+	awk 'quoted text' test ${HOME} && local
+	grep cd local 'quoted text' printf
+sed "$@" ${HOME} ${HOME} --verbose -eu /usr/bin --verbose 2>/dev/null
+		--verbose 'quoted text' printf /usr/bin then 'quoted text'
+	test $(pwd) printf 'quoted text'
+		cd ${HOME} readonly x=1 test test done export
+	"$@" cd sed ${HOME} echo
+	echo "$1" ${HOME} export 2>/dev/null -eu
+		--verbose --verbose && 2>/dev/null test export sed | "$1" done printf
+		echo done /usr/bin 'quoted text'
+	x=1 then test export x=1 && local done | done /usr/bin
+	| done | local 2>/dev/null
+local readonly export test grep grep /usr/bin /usr/bin
+		2>/dev/null | "$1" grep && done cd x=1 sed
+	${HOME} $(pwd) $(pwd) readonly awk "$1" cd
+		printf "$1" ${HOME} export grep echo |
+then /usr/bin $(pwd) --verbose ${HOME} export cd --verbose test | done printf
+	done && "$1" "$1" --verbose /usr/bin done | readonly /usr/bin
+	local printf sed x=1 2>/dev/null "$@" 2>/dev/null 'quoted text'
+		${HOME} $(pwd) awk then export --verbose export
+		x=1 && sed | 'quoted text' then 2>/dev/null local | "$1" | test "$@"
+	done -eu readonly done |
+readonly grep --verbose export "$@" ${HOME} --verbose $(pwd) x=1 --verbose $(pwd)
+	done ${HOME} && cd echo echo sed
+${HOME} /usr/bin "$1" "$@" "$1" $(pwd) $(pwd) echo --verbose export "$1"
+		echo --verbose cd 2>/dev/null "$@" 2>/dev/null sed && "$1" /usr/bin printf | &&
+x=1 && readonly "$@" && readonly printf /usr/bin export
+--verbose --verbose 'quoted text' printf echo "$1" /usr/bin "$1" export /usr/bin
+	echo cd awk /usr/bin done 2>/dev/null
+		-eu | ${HOME} $(pwd) --verbose $(pwd) "$@" x=1
+		-eu sed | ${HOME} sed x=1 printf grep -eu -eu x=1 cd then
+	echo export 2>/dev/null export awk "$@" $(pwd)
+		readonly local grep done echo then echo | 'quoted text' done 'quoted text' $(pwd)
+grep then test grep done --verbose
+printf $(pwd) grep local echo 'quoted text' local awk ${HOME} $(pwd) cd done "$@"
+	x=1 "$1" awk printf |
+	"$@" /usr/bin cd local done awk && 'quoted text' test $(pwd)
+		done -eu "$@" $(pwd) x=1 readonly
+"$1" x=1 2>/dev/null "$@" 'quoted text' test sed grep "$@" local /usr/bin
+-eu then then done local 'quoted text' | echo done then x=1 echo done
+printf 'quoted text' test awk /usr/bin awk done /usr/bin
+	awk 'quoted text' 2>/dev/null ${HOME} awk
+cd "$1" printf then 'quoted text' --verbose --verbose
+		/usr/bin --verbose 'quoted text'
+		printf 2>/dev/null test export grep && -eu export
+		printf done echo --verbose readonly echo
+export cd "$@" readonly -eu done --verbose | ${HOME} local "$@" | local 2>/dev/null
+cd && ${HOME} local x=1 "$@" /usr/bin /usr/bin $(pwd) done export 'quoted text'
+echo local -eu done local 'quoted text' done --verbose 2>/dev/null "$1" local
+	&& $(pwd) | done ${HOME} readonly test sed
+		/usr/bin 'quoted text' export test $(pwd) "$1" awk local /usr/bin
+		sed 2>/dev/null test test | then cd x=1 'quoted text' sed local then 2>/dev/null
+	$(pwd) "$1" | && then --verbose --verbose
+sed -eu readonly echo --verbose grep readonly
+/usr/bin | awk -eu echo --verbose
+readonly $(pwd) /usr/bin --verbose
+&& readonly test $(pwd) && awk | $(pwd) sed "$1" printf -eu "$@" done
+	sed export /usr/bin ${HOME} 'quoted text' "$@" | 'quoted text'
+		| readonly /usr/bin $(pwd) sed done $(pwd) then test
+test done sed && then -eu --verbose export cd cd readonly
+		done --verbose test ${HOME} x=1 'quoted text' x=1
+local grep done | | --verbose ${HOME} "$1" ${HOME} && readonly
+/usr/bin readonly sed "$@" awk awk x=1 2>/dev/null 2>/dev/null && ${HOME}
+		'quoted text' /usr/bin awk /usr/bin x=1 awk printf cd done export grep
+&& --verbose x=1 --verbose ${HOME}
+		&& local /usr/bin test
+		export cd ${HOME} && --verbose "$1" then "$@" ${HOME}
+readonly x=1 --verbose 2>/dev/null
+		&& 'quoted text' ${HOME} grep $(pwd) grep 2>/dev/null readonly 'quoted text'
+test done "$@" done local done echo --verbose done
+sed readonly grep done awk
+	readonly then 'quoted text' echo sed then --verbose then grep && printf
+	grep ${HOME} local readonly $(pwd) then x=1 cd "$@" cd done then local "$@" --verbose
+	| -eu x=1 test -eu sed awk then sed && /usr/bin -eu done done | printf
+echo echo local --verbose awk --verbose grep ${HOME} "$1" awk
+		'quoted text' x=1 printf cd done $(pwd) -eu
+		"$@" ${HOME} --verbose 'quoted text' grep grep export /usr/bin
+	/usr/bin awk 2>/dev/null test /usr/bin | $(pwd) readonly sed $(pwd)
+		sed local local printf export awk x=1 x=1 sed echo "$@" awk local readonly
+	cd && readonly --verbose -eu awk export 2>/dev/null
+	x=1 /usr/bin awk | ${HOME} &&
+awk --verbose then $(pwd) test $(pwd) x=1 grep 'quoted text' -eu export 2>/dev/null
+	sed 'quoted text' readonly sed sed
+awk $(pwd) then "$1" echo | 'quoted text' sed sed echo export /usr/bin
+grep 2>/dev/null export readonly | /usr/bin
+/usr/bin 2>/dev/null cd test export then | "$@"
+	x=1 printf -eu cd --verbose "$@" 'quoted text'
+	2>/dev/null sed done x=1 printf /usr/bin
+	cd "$1" grep | | export | done -eu "$1" ${HOME} cd then -eu
+"$@" ${HOME} cd 2>/dev/null export local awk grep test &&
+grep $(pwd) test then && echo 2>/dev/null && && then done
+		--verbose cd "$1" -eu --verbose echo
+2>/dev/null $(pwd) export test -eu --verbose
+	x=1 x=1 then sed x=1 "$@" test echo echo && "$1" && | cd echo echo grep local
+		"$@" -eu done cd test awk printf then readonly sed
+| 'quoted text' --verbose 'quoted text'
+		2>/dev/null then then done test 'quoted text' readonly local grep $(pwd) printf
+		test | export then $(pwd) $(pwd) -eu "$1"
+/usr/bin "$1" 2>/dev/null --verbose 'quoted text' export
+echo "$1" printf local local
+${HOME} done readonly /usr/bin awk grep export sed 'quoted text' done ${HOME}
+		"$@" $(pwd) printf 'quoted text'
+sed test ${HOME} done done -eu cd && awk 'quoted text' export 'quoted text' && --verbose
+		$(pwd) sed test local printf awk local printf grep
+	x=1 sed 'quoted text' /usr/bin export test "$1" /usr/bin
+test --verbose echo "$@" export printf export sed $(pwd) grep
+awk "$@" test "$1" test cd export && readonly "$@" grep
+		${HOME} ${HOME} done x=1 'quoted text' export grep local
+| "$1" | printf --verbose && sed | --verbose
+	sed 2>/dev/null $(pwd) 'quoted text' local -eu $(pwd) readonly done "$@" awk "$@"
+		x=1 'quoted text' $(pwd) $(pwd) grep then $(pwd) 2>/dev/null
+"$1" /usr/bin then done local -eu $(pwd) ${HOME} "$1" "$@"
+		test x=1 then sed then done "$@" $(pwd) | grep then 'quoted text'
+"$1" test "$1" test cd then --verbose ${HOME} sed
+&& cd grep ${HOME} printf 'quoted text'
+		x=1 $(pwd) cd ${HOME} -eu x=1
+		"$1" readonly done sed "$1" grep 2>/dev/null done cd
+		&& $(pwd) echo readonly readonly 2>/dev/null 'quoted text'